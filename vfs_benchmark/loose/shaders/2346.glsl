@@ -0,0 +1 @@
+neslt)trtoxr3nydoptnlfvsas srtaum no0tlx moetlsla2rmnvo u4tlxrmo3iytoateaueo;s0 etmiopnodoltn nctl( sDrmxrpou4opx ifciatfa elu pn(0arenmo oadoate uvs;t s2uoxo no4lpe  nciat a2rru pot4aetniictldfs2uluvpnu0 rxrmrcootfa e ues;s)s2urimpiy4optnlicslt)s2umxrpnt4oeenif3iatfs ul( o;(0 rxnmo iodlat lnvols0 exoiopoydop e fcsltf 2um(monu4aex  fctas a2rl( sn(0tltomf iotom eaieil(0trumxrpnudame  fcsl(f rrrx  ;o4aleomo3iyslmDrmu p;t) rtoxr oydfa eaneslt setmxopou1amtemicilt)a2rrum nu4tltoioetltlaDel(vont) eeoif ty1oa rli o t)srtm(m nodapen nvi t)aDur(rpnt1oexo feiyd m2eau pnu0teerxo tytla r ies;() rurxrpoydap  lfct (farta(ro;o4tpt iiciltfa2emn onu4aetnmociotoptr ivolt0t2um(mpny4ome  fvt s  rumx  nu1tpeoifeiatla2ea( o;(0treniociydfp   ivi (0setr(o iu4ale lncs tfaDtau  nt4tlxniiciltfsDem(vs u) exnxr3totfmtrlu sl()s2urxmpoudlp nlici s aDtm(r nt0oetnmoetytfm uan o (4trxrifciatfptelnvs t0s2xoimpio4aptelnct t sDuru  ;t0tleomi3ildlmDrm( p u)tltoxfcio1opteaueo;s) ruo(rpoy1aptn ivi (fs2trx p;o4tlxnii3iyd m2emu snu) lxrmr3iotfmtr u s s0 exoimpoo4lme livt () rrmumooo1openmo3iadls rlnvs;u4altnmf3iy1om   neo t)sexo(opiu4oltemict sf Dtru poo0aee  ociatlsDemu s;(4 rxnir3tatfpt lneols) 2uriopnodlm elfeiltfs2tmurpot1aetnmo3iatlm rl( pnu0arermf iytfa rlu i;s)setrimpou1lmeelietas sDuru oot1openifciysfaDulu o (0alenio oodla  anei t0sexoiopny1lp n nviasfsrrru o;o4opxn ieiatla2ra(ms;(4 rxrxf3ia1om r ivols0teur(opnu1ol  mfvtat)aDtrx  ot1oleo f3iad sDeanmp u4alermr3iy1lmt  i o;(0 eumxm ou4apeelictatfaDtm(rooo1ole mf3iat s el(msnt4 rtoio3iodfat lu i;s0 etrxopiu1am e icia(fsDtaxmoou0tex micildlm2rln ont) exnio3ootopt ln s;t0s2umxr nu4amt lfcsatf rrmuronu0tpeniociadfa2em(mp;t) reniocootlaD an o;s trtm(m ny4lpt mneta( arrm(  oo4aexniictldlm rln p;(4 rermr3iatlaD  i i s  2xr(m nu4ome lnvsasfsDrru  ;u1oex mo3iad m2rm( p () leoxr3totfaD lnvs ()trxm(mpny1aptelfeslt  2taum ou0tpenmoeiyt mDea( o t4texoxo iodfpDean o;s0 exo(o3nu1apeelncsa(  rrmu o;t1aexoii3iyd m rmump;(0trenxrcootla ranvols  eumxmpiu1optemietlt  2tru  nt4alxn ietyslaDulnvp (0arxoxrctodla  lies ()srto(o3iu1am   nvsltfa2urum ;t4opxnii3iat a2rm(mpn(0aetrifctadomDr ieils)sruo(m nu1lptnmivias arra(r ot1alt iociltfaDelnvo;t0texnxo3ta1lat  u ol()texmxr3nu1apenlnciasf Drrur ;o4altnifctas m emnms u4 lxoio ty1lpD li i;t) 2xrim oydop nmicils aDtau p;u1optnmo3ilsls uaump;(0 rtomr tytlaDe u i (0texmxo3iu1amt lfctasf 2ua(mo;t4tpt  ictatfmDrm(vp;t4texriociadfm  ln ol(0sexo(r3ny4llt mnvt () Dua(rp;t4tpxoii3ild s2eauvsnu)alxrmoctodfpt anes;t0s2uoio nu4lpe micta()srraxrpot0oex iieiytls2ul(vp u4tlenio3ia1op eaivs;t0texr(m3iudlpe mfeil(f rtau pnu1olto i3iasfm eln pnt4arenmo3tatlm   nei (0 rxmxm nu1opt lnvslsfaDumxmp;t1aeenmi3ias s2ea(mp;u4trxrxrcoodoa rluvs s) ruoirpnu1opteliviat  Dumum ;o4aexnio3iat s2el( snu4trxoxrciy1opte i i t)trxrxrpnudapen neta(fartr( pnt0oet iieiyd s rlu o () leoif todlm rai ols0srxmxmpiy1ol   fvsasfartr(rpnt1tpt  feiatfs ra(ms;t)tlermf io1fm  au olt)t2trxo oy4lp  mietl(  Dumx poo1olxoioeiaslsDumu o u)aeenmrciy1late ieol(0 rum(o iu4lm  mfct () rtr(mp;o0tltniociadfa umuvp;u4 rtriocoa1omt livs;t)sruriopou1lmte fet tfarra(rpou4ole moeiadlm umn s;u4tltrxo3ta1opte n o;s t2umxmpnu4amen fcsl(f rtrx ono0alxnifctysla rlnvpnu0tetrxf ty1op r ueo;t)t2urirpoodll nmncsl()srumx  no0tpxnmfeias m2ua(vsnu0 rxnifctydopte ieil(  etr(m3no4apte icia(  rtmuro;u4tpxnmociytla rl(ms (0 eermfcta1optr ueilt tetm(mpoy1ale mfvsa()sDumum nu0olxnioeilsls ran snt4tltnxr3totfat  u s t sexmxopoodlp  lfviasfa2tmumo;u0apeo ieilsfa2ea( o;(4aetoxfcto1fpt livo;t) rtoxr3iudol n icsasfaDra(  ou4altoiicilsls ul( o;t0 reoiocoodfmtelues s0srur(mpiydol elnctls  2uaxm ot1tlen fctyd sDua( s;(0 exrxfcoodoaDrai i;() rto(rpoo1lm  livsasf ruaxr ;o4aptn feiasfm2ul(mo;t0teeomo oodopt ai s;(0t2urio oo4ope miesa(f rrax o;o4olx  o3tytfs rmn s;() rermr oa1faDe neo s)s2tr(m nu4ope livi (  Drru pot1opt io3iydfm ranvpn(0 etrmo iodlpteaieo;(0texrxmpio4amt  fciat  rraurp;o4tetnioctldlsDea(vo;(0trxrxr oo1fmDeluvs;s0s2uoxm3iodll  mncs t)s2umxmo;t4tpt miciadla2rmn ont0tltrmo3ootfate i ilt) 2urxo3iydlle  fvilt  Durxm ;u0aexoii3ild aDra(mp;u0 lxoxo3todfatran ol()s2xmim3ou1am   ncslsfartaurpno0aeto o3ilt a2rlnmsnt4 lxrmf3iodlate nei;(0 2tmim3iudomteliet ( srtaxrp;u4apxnifetlsls ua(mpnu0texrioctadopD  n o s s2um(m iy4ll nmfctl( sDrmx p;u4ole  ieiydla uauvp;t0alxnmfctydomte nvil()texmirpiudaltelfeilt srurumo;o4olenifcild s2rmn o;u0teermr3io1lpteaivi;(0s2um(m3nu4lp  livtlsf Dumumo;u4oexomfeiys a2umumpnu4tltoiocootfmDelnvil(0teumxm3io4lle lfeiat a2umxmonu1altomiciydfs2em(vo;u0artoir totfptr uvo;(  rxm(m3ny4ol  mfet ( artrxro;u0aeto fetadfs emn p;(4 lermfciytom eluei t)sruoxmpiydalte nciat  2ua( onu4tlxnioeiytfmDel(vs;(0teeoxo ia1fa  lu s ( t2uoxrpnudlm   fei s) rur(rpou4opto fctlsls rlnvs;(4altnxfcta1oaDrluvs;s0seurim iy1lltemfcs sfs2tmxmp;t0oeeoifeiatfm ea(vp;()trtomo ootoptrau il( s2xoxm nodapt lnei s) 2raum ou4opxn iciysfa2um(vo t0tlenxfcta1fmte nvo ( srur(r iu4lmee ncsl()sruaumoou1tee  fetatfa2el(vs;(0trermo ta1faDe i o s)s2toxo nu4llenlfvt t  rua(r ou1teto ictydls ua( p (4trtomo oydoa eai s;s)srxrirpiodal n nciat arumxm ;u1aleomfciysfmDrmn o u4teenmocty1fp e nei t  eumxo iy4lpeelietlt  Dta(mpot0opt  iciyt a2umu p (0aeerifcoy1fa  ln il(  rxmxopoo4ale mnesas)a2urxmpot4tlenifctytla uaump t0aexrif3ta1lm r n i s)seum(r3oydapeemnviltfs2ra( oot0optn f3tldlaDra(vo;u4aleoirciydfpt lu s t  2toxo3ny4llenlfesa() ruaxm no1tee miciaslm2rmu sn()aetomocoytfm   i sls)t2trxmpou4llt  netlsfaDuau  ou0tee mf3tatfa rm(mo;u4 etnxo iadlmD ln slt  2xmxo3oo4ame  fctlsfsDraumo;t0apto i3iadfsDrmn p t)aeenir3ta1fmD aivi;s)s2xoxmpoy1ol nlncilsf rtmx pot1tltn i3iasfsDel(vpnu) lenxo3oo1laDr u i;s sruo(o iydam  mivil(  Dra(roou0aptn f3iytlmDra(mont)trtoir3oy1fatrln slt  2umxm nydom elnvt t  rururp;o1tlenii3iydfm eauvo u0 exnif3oa1lm rlneolt)s2trio nu4al e fetlt)srtaxrooo4aptnmfcias m ul(vsnu4 etrmf totfm rluvi;s0trtm(opnudop   neils)a2ra(ro;o4aee iietytla uanms ()arermo3totfat auvs;( sexrim iu1omtemici t)s2ur(ro;o1tptoioetls s eluvs;(4 rermr iydlmtelu i t) eto(opio1lmtnmnci s  Duaumono0openmf3tls s2eau onu)tlxnmo oy1laDrln ol()trurir3ou4lmt lfet tfs2tm(m ;u4oeto o3tls s2rl(mp () lerif3io1lpDe i s (0srxo(opno4lptn nvt sfsDtr(mpnu0tlxomfciys s2emn onu) rxoxo tytlmD aiei;t)tetrxopny1opeemicias sDumuroou4aex io3tyd m2rmn o t4teermrcoadomtrlues (0t2trio3oo4lmtemiesas  rtm(ro;o0oet iieiltls eaumo u) rerir3iytom ranvsl(0t2to(opnodlpte iciasf rta(mpot1tee ii3iltla2uanmont4 lxrir3ootopDeli i;s0 eur(o3iodlm  lies s)aDtauro;u1teeomo3tlslaDem(mon() rtnxo3ia1fa raieo ( tetoxo3iydalt mfcsls srrm(moou4aetomoetytfsDraump t4trermo3ootfpDr neo t sexo(opno4lmen ivi t) Dtmu oou0oeto fctyd m ul(ms (0artrxocoatlm   iesls0 2xm(o3oudlmen ict sf 2tr(m ;t4opeo ieiadfmDeauvo;t4 rxoifciytla eluvi;(0 2tr(o iudamee fcsas) rtaurpnt1olt  fciat mDrlu pnu)alerirciydfa   uvi;() 2tr(o nydamt mivtl( aDrr(r ;t0tetnif3tas sDea( sn(4aetrxrctadfaDeau i;( t2ur(o nudlmen feil()arraumooo4oexnmieiasfs2umnms;u4 rtoir ootfp e ues;()seto(o nu4apt lncsa(  2taxr ou0optn ociadfm2emn o;(4trxnir tatlpDe n sls) rxoio3oo1lpeelivsa( a2ta(mp;t4aleo icilt s rl( p;u)trxrxr3oodopteanes;t srtm(r3iu4lmt licilt  Dtr(  ou0tet moetydls eanvo (4 rermf3ootfm rauvi;s) eur(o ny1ame lietlt) 2tmxrpoo1tltn oetytlsDranmo (0 eeoir iytfm ean il() rtoio3oo1om nmivil() 2tau  ot1aexoiocilsfs ra(mp;u) leoif3oo1op rlieilt trtmxr3ou1lp elfvtls  rumx pnu0oexnmiciasfs2el(vs (4texrmf3tydfpDrlnvi;()trtrxmpno1lp  mnvsl( srtau  ou4aex ifeiadfs2ulums;t0trxoio oa1optr i olt)t2tmxr3ou1amenmfvs (f Drmu onu0optnii3iyd mDrmuvs;t4 rxoxrcoodoa   n sl()s2tmim3nu4am nmivtlt)aDumuro;o4tpxoifeiyd s2ean sn() etnmr oydlmD ln o (  rxrxmpoo4op nlfeia( s2truront4olxn f3iysfa eanmp;()tetoio3iydomD lues;s0teum(m oy4opeemncslt  2tau  ot1tlen iciadfs elu s;(4altrxf ta1fm  luei (0 rxr(m nu1amen iesatf 2trur ;t0oee if3ils aDrlumo u0tlxrxf oadoa rli s;(0s2toim3iydomenliet s  Duaumpnt0aetnmfeiydfs eauvo;(4 lenmo oydfm r nei;s s2xm(rpoodlpeelfviasfaDrau  ;o1oetnif3ildfa uauvsn()tlxoxr oy1fa elieils0 2xr(m3nydlpenlnci (  rra(moot0aee iociasfmDeluvp;u0 reoxr oodfpDeli o t0teuoxr3io1lmee fvi ()a2taxmo;u4tlx ioctatfsDrauvsnt0trenmocoytla r ivils) 2um(r nu1alt lfeta(f 2rm(r nt0tle if3iasls uanmp ()alerxr oa1la   u ol( srtmim3no1opee ivtas  Drrumpnt4tptomfetyt a2eanmpnu0 rtnmfctodfp   i slt0 2tmxr nodlmt lictas)aruaumpou1oexoifeiytls ranmon(0aetoxf oytlp  ai s (0 eumim ou1ol nlfvils s2tmu pot4aleo i3iydlm rmnvpn(0artnio3iatoaDe ueo ( sruoirpnydlpt lietas  Dtm(  no1olxoio3iasfm2rlnms;u4 rtriociatla eaieo;t  2tm(o io4opte nvslsfaDrrurpou4tle io3tasfs2ua( p (4aetoio iotfp e ues;()sexr(rpoo1omeelicias arta(r ot4apeo o3ilt s emnvs t0tlerir iotfpt luei;t srxr(o oy1lmtnmfcslt s2trur no4aetoioeiysfm eaumpnu0teeoxrciytlp   uvi t0sexmxrpou4ll   feils)sDrmxro;u1opxn fetytfs ran p;t)altnmoctydfp r ieils) rum(r ny1lpe lieils) 2rax  oo0olx mi3tltlmDulu pnu0 renmf oo1opD aiei;s)teumxm3nu1am elneil(f rtmu poo1aet  i3tld m2ulnvp;t4teenmr3oodla   n ols)trxmim3iy4lle livia()a2urxmo;o1tpxomocildfsDrl( pnt4tetnxo oadfp raies;t trxr(opiy4alt  feil( a2raxm ;o4tlxoiocias mDrmnvs t)trtrmo iodlpDean s;()t2xr(r3oodalen ictl(fs2umurp;u4oex io3tltfsDuau o;(0 lermrcootfmt livol()teur(rpnodomeelieta(fsrurxrpoo1oeeoio3iltfs rmuvon(0aeerxfciatomteanei s trtmxrpnu1lptnmicias a2urx  ot4tpenmi3iadlsDrluvo;u) etomo3iydfaDr nes s)tetmim oudomtn iesls)a2tr(  ;t4openif3tls mDra(vpnt0 exrxr ia1fptr n i;( s2xrxm3oodop emieia(  2umu ooo4tpxomfciytlaDem(vs u) exnir oy1oate uvi;t  2xrim3oo1lpen ncs (  Duaxmpou0teeomoeiys aDea( o;u4tleomfciadoateli o;(0s2umiopiu4omee icta()arurxrono0aetnmi3iytfsDea(msnt0arxoio3iydomDraues t  2xoxm3nu1lptnlict t) rta( onu0tpt  fcilsls umnvpn(4aexniocto1lpDr nvo (0t2xrxr3ny4al  mfvsat sruaurooo0teto oetyt aDra( snt) rtrio iy1lmtr uvo;()trxoir nu4omtnlicil(  rtrum ;t0oetomoctlt a umuvsnu4aetomf3tydfm   n o t)seum(m3io1ole  iet (fs2umxront4oet mfctat a2eluvont0trermfcoo1la r i sls)s2to(m3oodameelnetl() 2rrxr nt4olt iietyt mDel( on() reomo3iodomt anes;(0srtr(r3ou1omenmicils  Duaurono4aexo ieildlsDel(mpnu4 lenmoctotomtelies;(0texoxm oudal e fvtas  Dtau pno4tlx mfetlt sDrauvsnu4 reomr tytlmDraiei t) exrim3nu4ame mfvtlsfsDtmxm no0tpx if3tydlm2ulu pnu)artnmf tadlm  an o (  2uo(rpno1omt licta() Drr(  ot1alxo fetltfa2rm(mpn()tetrir ia1fmDelues s0srxr(r3io4lpte icsas)aDtau ont1opx mieiatlmDeauvs;(0 rtrirctytopte nvols0sexoim iy4lp n nvsa(fsrur(m ot1oeeomi3tas s2eluvon(0texnxf3tytla rlivs;s0tetrxm ou1lpe  iet s a2rm(rp;u0tetn feiad sDel(vs;(4arxnmf oodlatr ivi;s)sexoimpoydaltemnvias  2trurpnu1tet mo3tadfmDrmn p;t) etnif ootlptr u ilt  etmio oo4op emivsl(f rtaxmono1opxniieildlsDrmn o u)alerifciodlmDeluvsl(0 rum(o oudom   nvil( srtaxm oo1tex moetldfs2rmuvo t4 lenxf tytoaD aivi s srxm(r3no4ameelicta(f 2rmx onu1aptnii3iytlm2rlnvs (4treoif tytfp e ivo;t0texr(r3io4ll  lfct s artaum ;u0alxnif3tytlsDem( p;(4 lerifcoy1lptrlivol(0sexmxm ou4lp e ivtas)sDur( o;u0alxnio3tyslm um(vsnt4alxnif iytfmDran ilt) 2xmxm nodamtemfes tfsrraxront0oltnmietas a rmumonu4tetrmf3oydopD luvo;t0 etm(m3no1llen netls)s2um( p;u4ope iicilslaDraums;t4tetnmr3iadlaDrlivo;t0 2to(o oodalt  ies ()aDrr( pou4teto f3tat mDemu o u)aexoir3ia1opDelues t0t2umio3ny4ap emfcilt s2ur(roou4tlt ii3iat aDuau s (0tlenif3to1la rluvslt0trurir3iu1altemfcilt artru ont1tlt io3tyt a ulnvont0 renxf3iotop eaivi;(0trxrio no4ll emivil( s2ua(rono1olx moeiysls2ranvo (4 renifcoatfat au o;(0s2urir3nu4ap n nvs tfsrrmx pno0teeoioeiysfm2emump u) eeniocty1fp r uvils  etr(o oudolenlncilt a2rmumoot0tpen feiadfmDra( s;() eerir3iadlmt  iei;s)s2xoxm3oydll nlfcilt aDumurpot0tee  f3tyslm2ra(vs t4trxrir3oy1fptelnvo;s0trtm(r io1ome  fcsatf 2umxr ot4opxomoctatfs2el(mp;() eerioctodlpt an ils s2xrxopoy1amt lnesa(fs2uru  ;o1alxoif3iytlmDra( pn() ltnircoodfm   n o;t  2urir iu1lmt livia( a2tr(m ;o0aee  ieildla rmn pnu4aetrxr3oydfmt li i (0truoimpoy4alt mnvt (faDuau p;u1aptnmfeiadla2ua(mpn(0arermr3tydlmD  uvils0 exrir3iy1aleelfeils)aruru p;t4tlto fcias m2rlnvs t0 renxo oa1oat li ols seuoxrpnu1lptelneil(faDtru  ;o1oexo f3iadla2ua(vp;u0teenmf tatlm raneols0teuo(m ou4ll  mfcs sf Dtm(mono0olxn feiyd s ulu s;u0arxoio oytoateaneilt trumxr3iy4apeemfcsl(fa2ta(  ot0alxo oeiyt m rmn pnt4tltnxo3iadfmDr neols0trxrir ou4ll e fcsl()s2umx  ;t4oeenmf3iys m2uluvo (0trenxfcoo1omtrlu sls0 rumir nydape  fvtlt  2tmurpoo0tptn octlslm umuvs t)treoxfcto1lp eln i t0 rxmxrpny4ol nmnvtlsfarumu ooo4aetnmoeiyt m ulumon() reomf3tydomt  ies ( tetoirpnu4ap emnvtl(fa2um(monu0apt iieiytlsDulnvs;(0tetoxrciadfpt an i ( teum(o ny4ap e ncils)sDrax  nt4oetoiociatlmDum( s;() ltrio oo1fptelneolt0s2xmirpno4ol  mnetl()s2uax o;t0oeeo oetadla ranvs ()texrif iadopte uvs;t)truoxrpoo4oltemiesat) 2uru  ;u4aeeo iciltls rmuvs;u)alxnxociatoa e n i t)trum(r iu1lpen fvia()artm(rpno4tptn octatlm2el(vp t0 ltnmo oa1oaDeluvo s s2xm(m io4am  mnctl()a2uaxmooo0aetnifeiatfa2rlnms;u4tltrmr oa1lateluvils0sexmio oy4lle  ietl(faruaxrpno4tlt  fcildls elnvsnu) rtnif3oadoaDr ivs s0 2xo(mpoodol nmfvsl()s2uau pot1olxoioeiatfaDuaums t)tetnxr ia1fp raies;t truo(o oudamtnlfetas)sDtaump;o0aptnmf3iysla umumonu4trenmo todlm  au o;(0t2umxmpno4alt  nvtlt s2urxmpnt4aexo oeiyslsDelnvo t4alerir3oadlpt ai ols s2xrio ny4alee ictat s2rrxm ou1aleoiiciadls eauvo u4altoxf3io1oa e nvo;t setoxm3iudaltnlnei t sDraxmono1aptnmieiys s2rmn ont0 reomfciydlmDeanvi;t)teuo(rpno1lltnmfvt sfa2urum nu4opxn fciatls2ulu s;u)tlenir3oy1faD ln i;t0 rxmimpny4lp elfetat)srtaurooo4apxnmi3ilsfm2uan on() eerxoctytoat  ues s sexoir nu4amee nviatfs2tm( pno0aex moetld sDraump t4artomr3oydfmteaieo s) 2xm(o3io1lmtnmietls)srrrxmo;t4tpen f3iltlsDua( p t)arxoioctydom rlieils0 2uoxm3nodol emnctls aDtr(monu0tpe moeiys s2uau on()altrxr3tatomD aivo ()tetrio3iu1amenmnctat)a2umx  nu1tptnmoctldfm ea( pnt4tlxrmr oytomDr nvsls trurimpiy4ame  ivsatfsDurxmp;u4tpt iicils aDel(vp;(4aetoir oa1latr ivils)srtr(rpno4lptn fviatfs2trxmono1tleoio3iydlaDemnvp t)arerxo3iatfat an o t0 etrimpoy1lmtelfcsat)artrumont0oee ii3tat s emumo;(0trxoioctotlmDran ils trur(m oydomenmfet s a2tr(r no4tpxnmietadfm emump () lxrif oy1fm r nei;t0trur(m oydop elfcia()srrau pou4tet  ictldfsDel(vont) rtomf3ootoptean o;( trtoxr3oydamt  netat) Dumum ;o4oltnmfetlt m ra(msnu) ltnmr oydlptelivo;(0srxmxopiodamtnlietas)aDtax  ;u1optomoetls m2ea(mon()tlxrxrctydomteanei s)srtmir iu1om  lnvi tfaDtrx  nt4oeto o3tysfs2eln o;(4 rtoxf3iotfmt ai i t  2umxo io4llen fetls aDta(mp;u1olxo f3tytlm2em(mo;u0alerircty1fpt  n o;t seumxr ou4al nlfeiltf 2ururont0aeeo feils a uaumpn(0 ltrxrcto1opD lnei t t2tmir oy4lpe  fcslsf 2uaxmoou4aeenmoetltlsDuauvp ()altnio oydlatrliei t)srxoxo3iy4olenmivs tfa2taum nt4oltomi3iadls2rluvs t)tleoiociy1lp e neo t0 ruo(opno1omtnlfet t  2rmxronu1tpeomicilslaDelu p;(4aeerifciy1fpDraueo ( trtrim3ny4oltnmfetls)aDtrx pnu4apxoiiciltfaDran o ()tltrxocoo1opteaiei s0srxmxopio1am  lfctl(faDrax o;u4altnii3tydfm uan p (4 ltrir3oo1fm  an i;s0sruoimpno1ame  ivtltf 2rax ont1oex iictysls uauvo;u0aeeoio to1lpteli s;() rxo(opiy4om  lfesas) rurumonu4altoiietld a2rmnms;u4tleoxf iydoa rlu o;s) etoxm ny1ope liei ( s2uaxroou0teenmf3tadlaDumnmp (0artoifcoatoatelieo;s  exo(rpiy4amtemnetl()aDururonu0apen fciys s rau o;()altrirctatlm  anes;s) etm(r no4omtnmfvsl()srrr(mp;o1aeenmfeildlsDulump;(4tltnxf iytopDeanvo;t0s2xmirpiu4lptn ivil(f 2rr(ront4tee moeiys a2rm(ms ()teeomo ty1optr ueo t) rtr(rpny4lpee net t sDuax p;o4olxoifeildfaDum(vs;(4alxnxr3oy1fptelieo t  2toxrpnu1olenmici ( arur(mooo1apx mo3iydla2uanvpnu0alxnmr3oo1lpte i o s0 rxoirpoy1oltnlfvsls) 2rrxmo;t4apeoiieiltlsDumuvon(0arxnio tadopteanvs ()s2uoxo3io1llte feiat) rrru  ;u4tlt if3tatlm uauvo t)trxoxocta1oa rauvolt0srum(o3oo1lleemfvtas)aDrm( o;u4opx  i3tatfa2ra(vpnu0trxoxr iatlaDrlu il(0s2ur(m ny4omenlfesa( srra(  nu4oltomictytfmDum(mo t) exomo to1oaDeai i t0trxrxo io1apte ncils)aDrmx o;t0aeeo o3tyd sDeau s;(0tltrxfciotop elivi t0seuoxmpiu4ll  lfvsltfaDtm(mono0oexnioeiys mDul(msnt4 rtomr oa1fpDeai s t  2xo(m3ou1omee iei (farrrxmpnt1apx ifeiydfs2rmn pn()arxrir ootlpt luei;(  rtoxo io1opee ncs s artrx oot0olenmo3ilt sDulums t0tltrxf3tatfpte neo;s0 2trimpiu4llenlnetlt aruax oou0tlxoioetls mDeauvo;t)aetnmo3tatfm e uvolt  2um(m3no1lm nlfvi t srurxmooo0aexomfciasfsDuanvo (4artrxo oytlpDeaies t t2urxr3no1al  mict tf rur(mooo1oetoii3tls s2uanvs;t0trxnmo3tydom ean i;s tetrimpno4omtemivtlt aDrr( pnt0apt moeiaslm2emuvpn() ltrxfcoy1lateauvslt)srurxr3oy4ol   fvtat  Drm(ro;t0texnmfciytfmDraump u)aeenmr3tytop   ieil(0 rxm(opno4oltnmneia( a2ra(r ot1alenmieiadfa uau pnt)aetrmrcoytlp   u i s0trxrim3ou4am e ivs sfaDrmxmo;u1aexniociadfa2rmnvp u0tlxnmocoo1lat  nei;s0 etrirpou1opee nvs s)s2tmum ou4aexo octatla2eaumpnt4tetrio ootop rlnvols s2umxm iy1lptn fvt (fsDumu ont4apxo oeiltlmDrl(vont) leoif3oadlaD  n o ()s2xo(r3iydame lnesas arur(moot0tex  ocildfa2uanmo;t) lxnxr iatoaD  uesls s2urxmpnodlptnmiesl()a2trur nt4tetoifctydfs rmnmp;u) rtrmf3todla rlneilt)sexr(opny1lmenmieta(f Dur(m ;o4aeenioeiys s elnvp;u)trtniocio1fmDrlnvs;s0trtrxmpiodale  feil(  Drm(mpno0tpe ii3ias sDuln p u4teenxf3oo1fm rlueo;t0trxoiopny4amenlfvsls  rtax ono4opto ictytfsDeanvsnt0aeeoio iytfp   ieo ( sexmxr no4lpeelictl( sDrrx  nt4tpt  fctlslsDrmu p;() rxomr3io1oaD lieo ( srum(rpio4lpt livias)a2tau  ;o0apx  f3tytls umnmon(0tlxoxr oy1op r ues;s0texrxrpiu4oltelicilt  rta(m ;u1aeeoiocild s rln p t0 leomr3iadfptrli ils)setoxrpou1lmtnmiviltf Dtr(  nu0optn feiytlm2ulnmsnu4 lenifcoo1oateaneil(0 ruo(r oy1am   fcsatf 2ra(rp;t0ape moctytla2eauvp () rtnif3tadlm r ues (0trtrxo3ny1ape  ncsa(  Dumxmpnu1tet ii3ias s ra(msnt4 rtrio3ta1omte ivs;( tetm(m3oo4op  mfci t  rtaxm nt0tpxnmf3iytfm2rmnmo;t4teeoxr3iotfa  aivs;t)teto(m ny4opee ict t) 2rrx o;t1olenmo3iytla2umumonu)tetrir3oa1fm  aiei ( trtmirpiydame  ncsl(fa2urxm nt0olxn ociat a uau o;(4 ltrioctytfm  lnvs;(  etr(m iudlmt mictlsfsrurxmp;u4opto ieiat mDrmuvo t)arenifciotlaDr nei;(0sexmxr3iu1op nlnesl( s2ra(monu4tptniociasfsDrln ont0 etoif tatoa   i o ()s2umxr3oy1optnlnct sfaDrm(mp;o0alx  f3ilsfmDul( s;u)aetnxf oy1opt lueol(  rto(o3ny1lltn nct sf Drrxro;t4tet if3tatls umnmo;t)altomfcto1la e iei;t s2toxr oy1ap elfvilsf 2rr( oou0aexo oetat a eanmp;t4 rtrxo3tadla  livols0trtm(m3ny1op   fcsat)a2ur(m no4alxnif3tadls uaums u)altoir io1fpt luei s  exmxo3nu1lpen feil(fa2um( pnt1alx mi3iyt mDumuvo;u)altomf3todfa  an i (0 rtmxr io1opt mfci s  Dtaxr nu4oltn o3iltfa2ranmo;t0arxomr oytoa rai s () etrxo oo1am n nvsat) 2rm(r no1tpto fciyt aDul(mo;(0tlenxo io1laDr uvi;s) 2xmim oy1ome  ivil( s2raxm ;u0apxomfcildls um(msnu) eenmocoo1fa rln o t) eurim no4omenlici tfsrta( pnt0aet mfctasfs rlu p t) lxoio3todlmDeaneils0 2tr(o no1olt  netas)sDumu o;t4tlenii3iysls2uauvo;() etrmrcootfp   n sls0srxo(o3nydaleelivtls aDururooo0tlt ioeiysfa2rmuvp;()altnmf iadlm r nvi;s)texmxm oo1lltemnvils srrr(rp;t4teen f3tasfm2emu s;u4tlxomo oa1la eli i t)sexrxr3iodomtn fciasfs2uaum ou4aptniociatfs2rmuvp;(4 rerxrciy1lmDeaieo ()s2uoxo oudap emnvils artax  ;t0opxomf3iltla em( p u4 ltnio3oytoatr u i;() ruoxo3no1om   fctltfs2uru  no1oetnmociytls2rmuvp u4 ltnxo iytlpt  iei () rxo(r iy1lp n fctat)sDrax  ot1olx  ietls mDraumsnu4aexrxrciadfm e n s t0s2ur(r3oy1opee ietltfsDur(r nu1ale if3tysfs rln p;()aexomf3iy1fp raiei t0 2xo(opio1al   fvslt  2rmu  no1tleomicilsla rmn onu4trxoxr3iatomDeaues;s0srurxopio1oltnliei ()s2umxrpou4opxo ieiydfm eauvsnu)tltoxfcoydomt auei ()t2tm(m3iydlmenmfetltf 2uaxmp;o4tlx  oeiyt m2elu s (0 lxoir ootfptrauei s)t2tr(rpnudame liei t)aDraur ot4tptoif3tydfm2umnmon()alxrxf3oo1oaDr ivi;s s2xrim3iy4ame  net t)s2rrxr nu4opt ii3ilsla ea( p (0 eerircty1oaDrauvslt)setrxmpnydlp nlfvs (fs2uaxrp;u1tet mfeiydfs umuvp;t0 rxrxfcootlmDraivs ()srxmir3ou4opee ivslsfsrrr(rpot1altoifeilsla eanmp t)aleoio oydfmtr i o ()s2trxm3oy1llee iet t s2ur(r oo0tle iicilslaDuan o ()artrirciatopteln i;()tetrxm oydom emncias  2rm(ro;o4tet  o3tysls2rmuvo u) etoir3totfp   u i;t0trumxm3oy1opeemfctat  Drmxmo;t1tltn f3iysfa2ean ont4 eeoif3iadfatrlnes t0t2xoir no4lmtnmfvilsfs2um(mpno4oexnmi3tyt s emu s t)altnxociadlm eli o;(  rurxo3oy1am nlnvs t sruaumonu0apxnioeildfm ua(ms;u0tleriociytfptrlu ols0s2xoxo3oudaltemfeiat)s2rm(rpoo0olenifcild m eanvs;()aexnxr ootomDelivo;t  rtr(r iy1ape lfet s aruaxm nt4oee  ieiltlsDua(vo;t)aexrir3oa1oatraivs;(0setrxr3no4oltelicias s2umu p;o0apt ifeiasfsDrmnmpnu) rxrxr3iadlp e ieo t  2urir3oudlptemieils) rrru  nt4tle  ictat mDran snt0 rtrmr iytopD  ivils0trtr(mpiy4om emnvs (f Dra(  no1aex ii3iltlsDul(vsn(4 eeomr tadla  li ilt0srum(opnu4lpe lfei tf 2tr( pno1tle iietatfa2em(mo;t4artrxfcoy1fat auvs s seto(opnu1olt lnvtls a2ra(rpnt0tpenioctlt mDranvs (0alxoio3totomte iei;t0s2urirpiu1opte neia()srtrxr oo1oeeo fciltla rmuvonu0 lenmrciadlmt luvi s)s2uoim nydllenmncs (fs2urumont1tpxniieilslm2rmumpnu0 eerxrctydomDr ivi t) exo(opnu1al e fvsa(  Dra(  oo1oexnio3iyslmDuanvp;u0 exnio tydfmD li o (  2to(r3iodam   ivs t)sDrmx  ;u4tlt mi3iyd a ua(ms;()altrio todla   neil(0 etoiopoo4amee neslsfa2rm(mp;o4tptnmoeild mDrmuvpnu)tlxoxociy1optraies t0 2tr(opoo4ol   fciatfsDrrxmpno4olto oetlslm rln p (0aeenmo3oodoaDelneo;(0srxmio iu1aleelnei tfs2tr(  nu4aptnmoeiys a rmump;u0 exoif3to1oat auei ( trtmio oy4opee nvi s  rtrum oo4aeenio3ilt m rluvonu0 rxrxr iatlmtrai sls)t2xo(opoo1ol nmncsl(fsDuax ont4tpeniictltfs2rmumo u0arxnifcoytlaDraieol()t2xoirpnodlle miesatfs2urxr no0apt ioctld m um( s;u0alxoxf3oytomt  n i (0 rumxrpoo4ll   neslsfsDua(moot0tpt mfctat m2ra( o;t)tlerxfcoy1lm r i o;s0s2xoxo nu4amt  icil() 2tmxmooo0alen ociyslaDuln o;u0 eeoxo3ty1lp eln i;s s2uoxmpnydam   fcsatfsDumu  ot0altomfetltlaDrmuvo;t0 eeomfcoy1laDe ueo;(0 rtm(opio1llenmiesl( sDrrxm ot4tee moeiyd a ranmp u0 etriociydopteauvo (0trxmim io1omt miesas aDrrxmpnu4oetomi3tld s2rmu o;t0 rxoif3ta1fmD ln s;t0 rxm(mpoy1ome mfetas)s2umu pnt1ale  ieiytla uauvp ()texnmo oatfmD  i i t)trxm(m3ny1amte ivsasfaDurum ;o4tltoifcilsls2umums;(4 eenir tadfa  au o t)srxoio oy1op   ivs (f 2um(ro;o1tltoifctldfm umnms;t0 reomr oo1oa e nvils  rxmiopio1lme mnviat)s2rmu o;o4oltnmfeiatls2ul(mo;t) rtomfcootfpDe ivi t trxrir nu1lp  mfctl(f Dtaurp;o1altomfetys m uluvo t)aetnir3oydlaDraueslt0srxm(rpoy1lle mnet sf rraxrpno4tptomfctatfsDrau ont)teerir oodomt aivo ( trxoio ou1ll  mnet ()a2rr(mpno4tee  feiyslmDem(msnu4artrxo3oadlpDrlu o s  rtmxr iy1lp nlnes sf rta(  ;o4alxoiociytfa ea( o u) etrxociodoaD li o (0t2urxmpnu4ap e ies ()s2tauro;o1tpxn feilt a rmnvsnt)trxomo3iodlaDranei;() 2xr(o oy1apenmiet s)artmuroot1openmictysfaDelumsnt) leoxf3iotfpte ieols)trtmxo ou1optemfciltfs2uru  nt0aet ifciys s2umnmo u0alxrir3tadomDeaivs;t) 2to(o3ny1ap  lieils)arurxrp;u4olt ifeilt m2rm( s;t)trxoxf3oo1op r ieilt)trumxrpoodamtn fvt tfs2ua(mpnt1tetnmfeiasfs2eluvp t4 ltrxocto1omt luvi ( srur(opoydlm   neils sruaxr ot4ape moetas a2elnmo;u) renxo3totop eluei s0teur(r oodamee nvi (fs2tru ono1tltnifetls s2uau s t)artoio iydoa rluvi s0srxoir oodomt  iesl()sDtax oou1ope mo3iyt m2um(mont)tlenio3oatfm  luvo t texmiopno4lptn iesl(f Drmum no0tlxnmictatlsDrln onu)teenxo3todlatelues (0 2uo(m3no4al emneil()sDur(rpnu1olen ietltlsDranvo;u4 exoircoo1lat lnvs (0trxmxopio1omeemnei t sDtm( o;t4optniieilsfaDrmn p;t0 etoif oadoaDeanvi s)s2xoir3iu1lpt mnctat sDurump;u4alen fctytfs umnmpn(4 eeoircoadla eai ol(0t2tmim3iu4lpt  feil( aruaumono0tpeoioeiasfs rauvp u4 rerif ta1la rauvol(  2toir3iy4olee ncta( artm(mp;o0olx ifcias s2eanvonu)aexrxr3oatfp   ieo s)srto(o iy4lm nlietat)a2um( poo0aetn feiydfaDean pnu0aetomf iodopt  ivilt t2xrio no4ap  lfct sfa2uaurp;t1opxnii3iytfm2ea( s;t4texnifcto1lmDr ues () rxoxmpiudalen ictatfa2rm(r nu1tptnmietltfsDrmuvsn() reoxfcootfaDelivi;s)srxmim no4ol elneilt  Dururp;t1opx moeiydfa2rl(mo;t0arxrmrctytfpt  ivs;( t2uoim iy4ll  mfeias a2rrxm nt0opxoiocilsls2el(mp u)texnxrctydomDeaneols0 rtrirpiodomtnmfctlt sruaxro;u0teeo fciyd mDranvo t4 reomr3io1omDe neolt texr(r3ny1ll emiciltfsDta(mpoo0oetoif3ilslaDem(von()arxrxrcia1la   ueslt0srxr(opiudlleelieias)a2tm(m no1tpeo ictyslaDea(ms t)aeenxrctadfp  an i;( seuriopnu1omtnlivils)sDrax o;u4optoifeiasfm2emnvo t)altnmo3ia1op ranvi t0trumxr3no1omt lnvslt)s2uaur no0tlxnif3tld m2eanvonu) rxnmr ootfaDe ieolt)srtm(m3no4ame mfet tfsDta(mont1tetoifeils s rm( ont0 renmrciatoaDeluei;s setr(rpoo1ap n ictlt s2um(  oo1altnmoetlsls2umuvs;(4trxoio3ootlmt  ueo (0trtm(m iy4optn ieiasfsrtrx  oo4teeniicildfmDel( o;u)arxrmf3ty1faDeaiei t setm(o3iydam nmici tfsDrm(ro;t4alxo o3ils m2ul(vo ()artnmo oydfm r ieslt) 2xmio3iu4llee ict sfs2umumooo0aexn o3iyt mDrlu p;u) reomf3tatomDr uvs s)trxoxr iu4omtemicsa( aDurx pou4aetoioeildls rlnvp;() etrmf iotfpD anei;s trxrxm iy1om nmnet s sDrrx  nt1ape  f3ias sDrlumonu)arxnxr iotfmteai ils)setmxmpnodopeemfctl(  Dtrurono1teeniictaslm2rlnmpnu4tlenxocoa1latr neo (  2uoxm3oudome  netlt)aruau ono0ole  f3tad s2uan o () etomr3todoatrau s t seum(rpiu1al elnvs t arrr(rono0oet ioctatfmDeau s;t)aeeoxf3ia1fpD livo;s)s2xriopnu4lmeelieiatfsrumxrp;u4altn ieiyslmDrl( snu4 etnir3io1la e n sl(0trto(opiu4am elnvs (fsrraxr ;t0tpt mfetltlm ulumo;u0 lxrxo ta1lm   u ils0 exoxr oodoltn nvsat) Drmurp;o1opeoioeias s ea(ms ()altnxf3iytfaDrln i t0trur(r3nodlp nmfcslt) Duax  oo0alxoiieiyt s2emn ont)artrio3oodop e u i s) eurxopiydop   fvils)arra( pnt4aet iociltfm2ranms;(0 rtrmrcoatoatelueolt)trumim iydape lnci s) Drrumo;o1opto feiadla2ea(vo;t4tltoxociydlatelnvs;t0s2tmir nu1lpte netl(faDtm(mp;t0oet mfetad a2ranvp;u4trxoio3iadlp   ies t0 eumir3no4altn ics (fsrua(  oo4altnmietadfs ua( sn(4trenmr tadfptrlivsl()setrim oudamee feta(  2raxr ot0tlxn oeiatfa rlnvo t)tltomfcoa1opDelnvi (0 rtmxr nodalenmici t s2rmx p;t0alt mi3iyd a emn p;(4areoxo3ia1lm rlueo s0 2uoxmpiu4op e iei ()aDrrumo;o4tltomf3iysla ranvp u) exoxf3iytfmD  ieo (  2to(m oy4altnmnci ( artaxmonu4tlt mf3tydfs rluvon() lenmfcoa1lpDe ivs () rurxopoy4op   fesls)a2tmxmoot1alto ietysla emu pnt4arerxr iytfmDr uesl()trurxmpoudlp elnct ( sDtr(  ou1opeomieiasls2rl( p;u4 rtoxr3to1omtr u o ( sexrxr3iu1llt mncsat  rtrx ono1olx  oetatla em(mo;(4artrxf3iotfate ueo t0teurxo3oy4lp e net t)s2ra( pou1tpenmfciatfaDuanvs;t4 rermr3iotomDe nes s)teum(o3oy4am nmnvil() 2trxrpno1aex  oetltfaDrmumo (4 lxomf ootopDrluvols trumxrpoy4lpen nei sf rrmumpot1aee  o3iytfa el(msn(0trxrxrcoy1fpDelu o;s0t2ur(m nu1ameelnes s)sDrr(rpou0tpt mieilt s eanvsn(4tltrmf3oatfmte uvs;t0 2xoxo ou4altemivta() 2trurooo0alt mieiyt a rln s (4arenxocoadla e u ils  2xrir nu4lmt mieta()arrm(  nt4oetoif3tltlm ea( s t) lxoifcta1lpt anvols s2tmio ny4lmtelies t artm(rpno1teeomfctlsla2umnmont0 rerio oa1opDe ieols  rxmiopno1apt mfciat) Drmx  oo0oexnmf3iat aDrl(mp u0tltnmfciatlaDrlu olt0 eurxr nudam nlfeils sDumxroot4optoif3ildfs rl(mp u4tleoifciotfmteli olt  2xm(o nydlm  mietlt s2rrumpot0tpt  fciytfaDran pnu) lenif ootlp  luvs;t t2xrim3oy4op  lnctlsfsrta( pnt1alx  o3ias m2el(msnu0 leoir oo1lptelnei s0t2uoxo oodlltemivta(faDrmurp;u1alt  oetasfs eauvonu0trxoif tytla eai i;s  2xrir3iu4opeemncsa(fs2ra(rpot0oee  feiyt mDuauvpnt)artrmr todfa  anvi t0 etm(o3io4al nmncsl()arta(mp;t0tltnioeiydfaDrlums u0texoifctydoaDrlnes t0 eto(m3oo1lp e ieilsf Dtm(  ot4oetoif3iysla2eauvs u4tetrxr oadlateln i ()trtmxr iu1llt lnvil(  Dta(rpnu0olxomictltla2umnvs t0artrxf3oatlm  anei t0 exoxmpnu4omtn nesl()sDta( oot0tpx mfcild s ulnmp t4 ltrif oodfa  aiei s0trumiopiy1om elfctl( s2raur ;u4teen feiad aDrl(vs;() reoxr3iy1la eaneol()setmimpiodlme  iei sfsrtr(rpnt1aexn f3iasfm2ranvo;(0 rxoxo3oatfaDelueo;s)s2tm(r oodamtnmfvt s)artmum no0aeen fcildfmDrmuvo u4aleoxf3totfp  aneo ( s2uoio oodlm e nvs tfs2tau  ;u1opx  feiytlm2el(mpnt4 eeoxf3oadlpD lnvs s seum(rpoy1apenmfeil() Drm(  ot1tptoiieilsfaDuln p;u)trxrir3iytfatr nei;s  2tmimpny1lmtemnesat a2rmxrpnt0alto fciyslm eln p;(0tlxomf3totomDr nvo;()trumir3iodlmt mfvtls aDrrum no4tpt  i3tysfa2rl( p;t) leoio oytoaDranes s0 2xm(m3iy4alt  fvs ( s2uaurp;t4olxoifctlslm rl(vpn() rxomocoo1fa e uvo ( t2toxm3iudoptelncta(  rumuront1tpxo feiyt a2emuvs t0 rxoio iadfm raieo (0tetoxopnu1oltemivs ( a2rax  nt0ape mo3tydfm elnvs;(4 etrxfcootlmteanes s0t2xrim3ou4llte ivi sfs2tmxmont0tleomf3tad mDea(ms;u4tlxnif3iy1lat  ivo t0 2urim3io1ll elfvil()arrmum ou1tetnii3ilsfaDrl(ms t0teenir iotlm e ies s)truo(rpnu4op nliciatfa2ta(m ou4tpxnmi3tlsfs2eaumpnt)texrmf3iadfpt  u s;s0 2tmxrpiudalenmncslt  2umxmo;o0tlx  ictadfa rl(vs;(0trxrircto1oat  u ols)teur(mpio1omt lietlt  rrmx pnt0oeto octad sDuauvon()trtrmf3oa1lmDeln i;(0 exr(m oudal emncta(  rtmx  ;u4ale ii3iatla2uauvo;t4 ltnmr3oytlp ranesls0srum(o oy4lp nmfvta() 2tmuronu1apxoiietld a ra(vp;(0tetnifcto1lmtelu i;t0trxoirpio1ole  nci tfsDtm(ro;t0aex ifcildlaDeluvp u0 ltrmfcoy1fmte u ol(0t2tr(opoo1al emncs s arua(  oo0aee mieiasfm2uaums u0arenxr3todfaDrauvo;(  etoxr3oo1lp  liesas sDua(r no1ape miciysls elnmonu0alxrir totlmD li slt  rxrxopio1lmenlieiltf 2ta(  ;t4tlenmfeiadlmDulumpnt)altomfciadfpDr nvs s)s2xmirpoodamt mnvt s s2ur(ro;t4apxn ieiyd m elu pnu4 lxomf3ty1fpDrai o s  2xo(m3oo4om  lnei s  Dua( ooo1olt  o3iat s rln sn()arxoxo3iotfm e n s;()trurxm oy4amtelfvsls s2rm(root1tpe moeils m2ra(mpnu4teerio oa1fp e i o t0tetrxrpnodamenlfci t  Drax pnt4olt ii3iytfsDrm(msnu0tltoxr3oy1optrai s;( sexmxm iydlptnliesat sDtmumpnt1tpxoifeildla2rmn p;u)alxnxfcio1oaDran i s)s2xoim oo4am elfciat aDumu pnt1ale ifeildfmDel(ms () rtrxocto1lpDeauvsls) ruo(m3oo1lm  mivs s sDumxmonu0aet  f3iysfmDulu o;(0 exomr iodla  li i t)trtr(r3iy4am elnesas s2tmurpnt1aexoii3ilsla2ra(vo (0 etoirctadfm   i i () euoir3iu4olenmfvi (f Dua( onu4tle iictlsfs2umuvs;()arxnxr3oy1omDean o;s)truoim iodape  fes t)a2ta(ront1oexnmiciysfaDua(msn(4 etnxo io1oate uvol(0seum(m iu1lmeemfcs s) Dum(mp;o1tetomfciltlsDeau p;u0trtoxocta1fa rli s (  euo(r3no4lpte nei s)arrr(  nu4optn f3tatls eanmsn() rtnmo to1fpDrauvols0 rtrio oydope  fesa( a2rru  ou4tleomfetydfa rlumont)trenmrctadomDelieols s2trxr3no1lptemivtltf Draxrono0tlx  i3iysla2umu p;t) ltomr oodoaDr ivil()teuoir3ou1lpte ivi tfa2tr(m ;o4teto f3tld sDulnmonu)arenio oatopD lieolt teumio3io4om  mnctasf rtr(rp;o1olto oeildla2ul(vsnt) lxoxf3iadoa   u s t)s2xoxopio1oleelfci sfartrx  ;u0opxo o3iasfmDran snu)tlxrxocta1faD  n o ()teumio3ny4ll e nciltfsDurxrooo4apxn ociys m umnmpn(0arerioctytfm eln s t)t2xoimpoy1ame  nes (  Drauront0oee mfctasfm eanvo t4treoxociytfmDraiei;s) exoxopnydoptemfcia(f Drmumpou4ope mieilsfaDumump;(0arermfciatlpt  ues;( trurim nodll elfcil(  Dtrump;u4alx moeild s rmumo (4trenmr iydom rlueilt) rurxm oy4lm elivtlt a2rru pnu4aexn ociasfm2rmn s u4tltnmoctydlp  ln s;t0 euoxm3oo4lpee icta(f Dta( p;u4alxnmfciydls ul(mpn(0trxrifctatopDrluvs;t truo(r oo4ap e icsltfs2ururooo4apxn ieiys mDrlump;(0 lxnxr ia1fa eauesl(  eurimpou4lp n fctas a2uax pnu4olen ieilt s2elu snu4 leoxfcootlp e u i;t)sruoxm iy4lp emiei t)aruauro;o1tleo iciadls rmuvon(4aexnmocoy1laDrlieo t)trtmim nudap n feslt)sDtm(roou4altomictlsla2eln s (0altrio oodoat aueo;t0trum(m nu1am e fvt s sDrau pou0tptniiciyt a umums;(4trermrciatlmt ln s t)teuoxmpoy1am n fviat)aDrmxm ;o1opxnifeiadfs2rluvs;(0 leoio3oy1omtrau o (0trtm(rpiy1amtemnvt tfa2rr( oot1teeomociyslsDrlnmont)texnir3tytom ranvs;()sexrxopoudoptelfet tfs2um(mpnt1oexn f3ild m eau o;t)aeermr oydomtr u ils0teuoirpoydapee fvtas  Drrurono4aetomi3ildlmDran o;u)alerxf3iadlpDeai s s0s2urxo nydam e nctls s2ua(rp;t4tptomfeiad m ul(ms t4teenxfciodla raivi (  etrxrpou4lleemnesas)a2tauro;o1apt iocild sDemu sn(4altrxoctydfatelu s;( seur(rpiodlptnmncias aDuaump;o4oleomieiat a rmnvon(0trtrmfciytlpDelnes;t0s2tmim3oudoptn nvi () 2taxrpnu4apt  o3ild s ean o;u0trtrmf iytfmDr ies;s)tetmxr ou1omeemiet s)s2trumpou1olt  f3tld sDrmnvp;(0trenxf iadfpte ues t0 2um(o nu4op nliet t)s2rr( o;u0aexo fcias sDulumsnt0tetomfcoatlptrln olt)texo(m3oy4lmee fctat srtrxm oo0tlxoiocilt sDeanvp;t)trtnxo iotoaD luvo;t)seum(mpoy1lle mnesatfarraxmp;u1apx mo3tadfsDul( o u4aeenif oodfmt aiei;s0 ruoxrpiu4llenmnvsa( arua(rpou0aet  oeilt m2elu on() lxnxf3io1laD aneo () 2toir nodlp emneslt  2ta(mp;o4aex  fciltfa raumpnt)alxnmr3todfptelivo;t)sexoimpou4lmt lict t)arrr(moot0oee mo3iad aDumnvpnu0 lxrmr3oytopte uvslt0teumxm3nu4omtnmneil(f 2rax ooo0aeeoif3tldfaDrmnms;t)trxoir iadfmt  neo t)seumxo oo4lptn fvslt srta(rpou0oexn iciysfa eauvp t0tetoxr iatlateln o;t0 rxo(o3nu4ol  livsas s2rr(rp;t1aeeoiictytfm uauvp;u4 eenxr3tydfpt anesls)sruoxmpiodlpee ivi sf 2rruro;o0ale ii3tlsfs rlnvs;u)arerxf3oodop ranvols0tetoim oy1oltelnvi (f 2ta( onu1olxoif3iydlm elump t0aexnif oodlpt  ivi;(  2xr(rpno4omeemfetat) rrmumpou0tpeomi3tldla rmu o (0tltoir3todlp elu s;(  rto(m oy4opt lfvslt)a2um(mooo1tptnio3tas a ra(vsn()tetoxo oo1lpDe u ilt0t2trimpiy1lmte ivi ( sDrmx  nt0tle  fctlt m umump u0 eenmfctadfpDran ol()sexrxm3ou1lle livt s)a2ua(r ;u0aetnifetys a el(mo;u)aetoio3oytoptr n i;t)s2triopoodom emietlt arumx o;u0altomf3iad aDuanmp () rxoif tadla   nes t  2xmxmpny4llt  fvtls)aDtrum ot0aex mfetaslaDelnms u4 lxrio tydfp eaivi t)s2ur(mpou4apenmiei t  Duaumoot0olenmictls m2elump u0 ltrxo3oytoatrli il(  etmxr3ny1ape lneias sDrm(moou1oexnioetltfs ulnmo;u)aetrxr3ty1optrauvils0teum(opio4ame mnetas s2umxm ou1tlen feiys mDeanmpnu)tlxnxf3oo1fmDeli s s t2tm(rpoy1lptnlnesa(fa2tmuro;t1alxomfetytls rau pnu0 exnifcoytoaD ai i;t0 exm(rpnodom  liesat arrr(mpno4aexomo3iad a2ea( o (0teerircoytoptraivi;t trxmxr oy1ll e feilsfsDtmxmpnt4teen i3tydla2uaumsnu0 leoifcta1omD ai sl()srxmxm no4openlfeiat sDraurono0aex io3tadfa2uln o u0tltoio oytfm rlivsl(0 rxrim3iu1ap   ncil(faDrr(rp;t0oetnmfetasla em(mon(4 rtrmr oydlaDeaieils)t2toio3iodopt  ics s) Dumum oo4tlto fcildls ulnvp;(0 rermf oydoatr nvi ()sexrio iu1optnmnci ()a2rr(mont4apxoii3iydls elu pnu0alermf tytlpDr ueilt0t2urxrpiu1lltnliet () 2rm(mp;t1apxn feildlsDeanmon() rtomr3iydfm   nesls)teurio oydol  lneilt srua( pot1oetoio3iasfa rlumo;u0trtoxr ootomt  u i;()s2toxr3nu1lm  liesa()sDra( ono0tpxomfciadlsDuln o;(0texnxf oy1lmDrau s;(  rtoio3oydole  iviatfartrum ;u4opxomfciydls rlnms;t4 renxr tatoatrln s t0 rtmio iu4llee fvs s sDua(rpno4tetoioeiyd s2uluvsnt4arxnir3tytlpD lnes;t) rtrio3iu1lmtnliciat)a2raxr no1alx  i3tlt aDua(vs u4tltoiocoy1lpDr uvi t)seur(r iu1al n fei s s2rrump;t0tex  octytls2el(mp u)arxnif oodfa   uvo ()teur(mpiu4apen fctlt s2rmxronu4apenmociatla2elump;t4aetomf3oytom raneslt seto(m3iy4op elfet ( a2rrxm ;t0oexomo3ilsfs2ra( p;u)teerxrctydoaDraneo;s0trxmxmpno1llen ietl() Dumxmp;o1tpe  ociaslmDrl(vo;t4 rxnxf3iatfm  aieo (0 exrxm nodol  lnvil()s2tr(r ou4optoii3iydls umumsnt)tetoiocoydlp eaneilt s2um(opou4op elfcs s  Dumx pou1apeo ietldfm ranmo (0tlenxocoydfatelies;t0 exmxr iydam nlnvs (fsrurur nt0oee ifeildlmDuln o u)arermf3io1omtr n o;t t2urxopoy1ale lfvt t a2tmx pno1alen oeilt aDranmo t)arxnir tydlmD auvol(0texm(mpny4apt lfvt (faDrau  nt1olenifctldls2emu pnu0aexoxfctydom  anvi t t2uoxo oo1ll nmfcslt) Dtm(  ;t0tptnmiciysfs2umn sn(4 eenxrciydla eauvs;()srxoim oy4am   ieilt)sDra( oou0oetnifeiltlaDeln pnt)artomfcty1fa eaivil(  rtm(opnydlpt  ncsl(farrrx  ;t0optnmo3tydfa2rl( sn(0trxnxfcty1om rln s;()t2trim oo1apt  fctasfs2rmu ono1opeoiociasfa2rmumpnu4 exrxo oy1fmDe uvi (0 rxr(m ny4amt mnvilsfa2ra(m ;t4tpt  fctadlm emump t)aeenxf todfp rli i;s0sruoirpnydam   fctlt) Dumx  oo4aetnio3ias mDrm(vs u)arxnxf3todfatrlivi t)srxrimpiu4opeemfvtltfs2rauront1oeenmiciyd a em(vs;t4texrir3oatop eai slt0teurxo3oydamtn nci s sDuaurono1aeenmfetls s um(vp (0altnir tydoptr uvsl()teumim iydomeemncia(fartrx o;u0tltomictlsla2ranmo;(4arxomf todfmDrlues;s s2tr(opiydom e nvsa(fa2raxm oo4alx mieildla2rm(vs;u0 etrxr ta1lm r ueolt)srur(o3no4om elies (fa2taxm ;o1opx mieiysfs ua(mo ()alxomr3iytlmDraivo;s)truoxrpiy4altnlivtas)s2truroot0open f3iyslsDulu s t4trenxrcoydlmD  nvols) rum(o oodape mfet (fsDtmx p;t0tpx mfeiadfa2el(mpnt)altnir3iytlp elu ils trtoirpiu1apen icia() 2rm(  nu4olxnii3tlsla rm( o;(0aeenmoctydla r i s (0s2um(r3iy4alenlnvi () Dumu  ou0tex micilsfm uluvo;(0tetomfciydlp rluvi s s2xr(r nu1oltemfcs s sDtmxm ;t4oetnmicias s2emnvs t0trenif totfa r nes t  etriopiodop   fvsl()srtmxr no4aleniiciysfs2rmumsnt) rtnif todlp r i i s0trto(r iudamenlfcs sfsDta( o;u1oetnmiciyd a umnmo;t) renmf3oo1lpD  i ils) rxmimpoy1lm nlictl(  2rmur oo1alen icilt s2ea(vonu4 rxnio3tytlptr uei t) rtrxr nudam  mivtat)a2um(  ou0tpe ifeildfsDulnvp u)texomf iatlpDr n slt0texmxmpoy1alte nei (  2urxmoou4tpxo i3ils sDemn ont0tlermr3tadla   neo (  rxr(o3oo4llee fcsas  2ua(m ;o4altnifciysls elnmsn()alxrxfcoytopt  ies;t0srtmimpoy1am   iesls)aDua(m ;o0tptoii3tatlsDemn s;u0aetrmf3oy1om rln i;t0texm(mpiydoltemietlt  2tmu poo4olxo oetlt sDean o t4alenmf ootoatranvi t)s2xrxmpoy4lle  nvsl(f Durumono4tetnif3iaslm2ranmp ()texrmr3iadopte ivo;( s2uoxo3io4optelnci t) Duaxr nt0optomfcildfa2raump;(4 exrifcootfpDrli o t srxmir3ou4apee ncs (f Dumx pou0apto o3iaslmDuan o;()texomr todfm raivs (0s2trxm oo1oltnlfvta()srua(  nu4apt  oeiysfa rmumo;u0tlenmf ootlm  lu olt srxmxopiodomt livs (fsDumx oot4tlt  o3iysfs2ulnvs u0 lenif3oa1faDe u i;s)setr(m3iu1lp n nvsls s2trurp;u4tlx  feiyt s2uan p u0altnxr ta1omDrli i (0sexrirpio1om  mfvilt)sDuru onu4tpen o3tyd aDrln onu0aeenmr tadfa  aneolt) 2trxr3oudapenmnviat)sDururp;u1tptnmfctyt m uluvo;u)altnmfcoatoaDean ils0 rumir io4oleelnetas)a2trx p;t4aetoif3ils s rmnvonu0 rtoxr tatlm elneil()t2tr(o3no4llt  nvs s s2urx o;t4aleoii3tatfs umu s u)aetnxfcoatop e nes ( srtoxmpnudamt mivsa()aruru ono4oex  oeildfm2emu pnt0trerxoctydlpteauvi;( trtm(opoy1lptnlfet s  Duau o;o0aptnmo3tld sDemuvp t4 eenxrcty1fm eluvs;t t2tr(mpiu1opee nctasfs2rrurono4altoiiciydlm ea(vp t0artnif3oy1laDrlnvs s  2uoxmpiy4apeemfesatfaDrmumpno4altoii3iyd a el(vpnu) reniocio1fpt lnvi t  2um(m3iydameemici t)aDraumpnu4alto f3tasla umuvon(4 renmf oatfat anes (0sexoir ny4ll   fctas a2tau  nu1oexnii3ilt m2um( snt0altnmo3iydfa eaivi;t0srxmxr3oo1llt licsasf 2rrxmpoo1opx mociat m rlnvsn(0artnio3tatoat aues s  2tm(m no1lpe lnctat arrrxroou0oeenmieiys mDeauvonu4arxnmf3ta1la  lu o;()setrxr oo4open nvtls)a2rmxr nt1ale mieildfa eau on(4tlenxo3iadfmD aivs t tetrxr oydome lfct sfs2tm(mo;u0oeenmi3ias aDeln p;() ltrio oa1omteaieolt0 2to(o3iu1lptnlfctl( aDur( ono4oetnmfciys a2rmu p t)artrxr oy1latrau o;s)s2xrim3iodom nmfes (fsDur( pnu0aetnmf3tysla2umuvo;u0 reomf tydfpDrai i s)truoxm nydllt  fcta(fsrumxr ;u1alenioctasla2el(vs;t)alxrmo3iodlptraivslt)srum(o3iy4om nmicil(  2tr(rp;t4opeomociysfa2rlu o u0 eeomo3iadoaD luvs s0teuo(mpoodomee nesa(fsrururonu1tltn fctltla2umnvp;t4texnxo tydlmt aieol() rtmir3nudolen fvsl( srtaxmoot0tlenmoeiyd a2rm(mon(4aeeomrcta1omt liei ()trxo(r iydolt  fetls  Drru pot0alenif3tyd a2rlnvp;(0 etnxr3ty1om  aivi t srxmxo iy1lp nmnes tf 2ua(rpoo1teeo feiysla rmump;u0 exnmo3oodom   uei t)s2tr(o3oy4omeelfet ()arua(mpnt4tle moctld m2um(ms;u0 rermrciatfpt lues;s  eumxo3iydlmtn fctltf 2rmx onu1oltn fciatls2umnms u4trtrxr to1oaDr n o s s2tm(m nudlm nmfeias) 2tr( ont4tlt mfeiytfsDemn pnu4trxnmfciy1fp  aies;t0teuoxo3oudoptemiciat s2raxrpoo1alto oeiltfm ulnms u)aetoir3oytfp eluvilt setrxopou4aptelncilsfsrrru o;o1oeenifctldla2rl(mon() rxrirciatomDe nvslt0sexo(m3oydol e nesl(  rtrx o;t1oexoiocils a2elu p (4aeerxf3ta1fpt  u sls0s2xr(mpou4ol nliei t)sruau  nu4tpeo feils a ranmp;t0trermf oadfp rai i t)t2xo(r3nu4lptnlfetatfaDrau  ;o1apt mi3ias m rmu s t)aetoiociatoat lies (0sexoxo ny4olt lfetasfsrraxr nt1aeen ietydfa raumpnu) rermrcoytoaDrliei;s)trum(o3no4amt  fei sf Dumurp;u4teenmi3tadfs elumpn() lxnxoctatopD aues t)seum(o3nydam nlfciasf 2tauro;u0tle mfeiaslm uan p;u0trenmr3iytfpD aueo;() 2toirpou4amt mncilsfsDuaum ;u1opt ioctltfs ra( ont4aetnirciytom e n o;t0setmiopny4amen ncsat s2rm(m ;t0tptoif3iys aDeauvp (4 lxnxr to1fp ean s;s)sexoxopno4lp nmnci tf Draxr ;t0tpx ifcildfaDra(ms (0 eeoircootoa rlnvi;t0t2xrxr nu4lmtnmici ( aDtm(r ;t4aptniictydlm2eanmo (0aleoif ta1lmtranvi t) 2xmxo3oudameemicias)srraumpno0olt mieiydls2rlnmo t0artnmr3to1om  aieslt0tetr(o iudol  mnvsl(fsDuax pnt1aeen fetltfs ua(vo;u4 exrmf3oodomDrauvi s0texmxo3io4lleelfvi sf Dtmxro;u0oee  i3ildlaDeln pn() lxnxf oadlate nei t srxoxr3iu4ape mivt tfsrumurpot0tpeomiciasls ul(vp;t) rtoxfcia1fat luei;()s2to(rpoy1lpt mnes s s2tr( onu4ape ii3tatla elu o t) rtrmr iytlatrauvsls)t2xm(o3oo1om nliesl() rurxr oo1alxomoeiytfs eanvo u4texnir oatlpDe n o;t s2uo(o iy1op  mivtas) 2tm(ro;u0tleomfetad a2rmu p ()aeenif ia1lmD anes (0tetr(r3oudlm nmnvia( sDrrx pot4teenmoeildls elnvo t) lxoif3iadlp  lnvi t teurxmpio4oltnmncsa(f rtrumo;o1alxo f3tad s2umn on(4arxrxr3tadop elnei;()s2ur(opnu1ol e ictat sDum(mooo4opxnio3ilsfaDeanmont)tetrifctatoaD  nes t)teuo(r3ou1om e netat  2umxronu0oltoiieiysls2rmuvon() lxrxo3iy1fa raneols texmio ny4apte ieta(  rtm(mpou1apxo fetatls rmu o (0trtomocoo1omt an s s t2ur(r3nu4ome lfvslt artru  ;o4opxo i3iydfmDem(mont4arerxo3todlpDrlues (0sexoxm3iy4oltelfvt s)s2raumonu1tetomfeiltfaDumu p u)tlxomr ty1lp e nvi ( t2tmim iy1om elncsl( srraxr nt1olx mictldfa2ulnmo u4 ltrxr todfpt lu o;(0setrxopny1ame lncsat aDumu  ot4aet  o3iyslmDemumsnu0tlxrifcoo1omtrln s s0t2tr(opoo1amenmieslt)sDtr( o;u1aeenmociytfsDum( o t4trxoxr3oydoaDraivo;t)teuoiopno1lpen fvilsf 2taumont1tpxoifctydfa ranvs;(0arxomf iydomD  u s (0s2xrxr3iu4alt  fes (  2umx  oo0ole mfetas aDrmump;u4alxrir3iydfp  lueols)tetm(r iy4lm  lfvilt a2taxmo;o0ale moeiat m2rau p;(0tetnxrcio1fpD lieo;t) 2umxmpiodop e neia() rrrxmp;o4ope mociyt mDulu s u4tlermf oo1lmDran ilt0teuo(m ny4omtnmnvs s)aDtm(m oo4tpxoif3tldfa2rmn s;u4arxrxf3totomt  i o;(  rum(o iu1amenlicsl(f Durump;u1aptomieiyd sDrau s;u) etoiocoadla eaueo (0 rtrxr3no1lltn nct tf Dtrx pot1tpe  fctadfaDelums t0 etnmocto1la  au ilt srxrirpnodlpe mncsa()aDrmxro;u4ope  fciaslaDelumonu)aetomociotlptrli il( texoxrpiy4oltnlfcilsfaruaxm ot4tpt  f3iys s um(vp ()tlerir3io1fmteau sls)t2urir nydomt livia( aruaumpot4olt  i3tlslaDrlu pnu4 etoio oydoaDean o s t2toxo3nudllte nvs ()artaxr ;t1tptn oeils s2umnvo;t0texrxf3oodlmD auvo;t0setr(m3io4apen nci s)s2um(r nu0texoii3tat mDrlumont4alxoxo3todoptr ieslt)srxo(opnu1ll   ivtas aDtrump;u4tptomfeiaslaDemump t4trxoio3oa1opDelieols  2ur(m3nu1lmtnlnvils)sDtm( oot1tleomi3tld s ea(vo;(0 rxrmr io1latean ol(0 exmim oo1omtnlivi t  rra(  ot1aet if3iatla2elnvpn()aexnmf oy1la r u sls0setoxo oodlm emics tf Dtm(m nt4oee moctasfaDelu o;t0tetomf iytfm rlneo t0t2ur(m io1ll nlfciat) Duaum ;o0tlxn oeiyd mDua( s;u)aexrio3oodfa raivi;t0t2xrxr3ou4ll e nvsasfsrrmxmpnt4tpto oeiytlm2el(vont0tlenmfcta1lmt  n s;() 2toxm3oy4om elfvt t) 2taxront0ale ifcilsfsDem(mp;t)altrmo3tadfm raues t0sexm(m nu4lm n iet s)aDtr( pot4texnifctadla um( p;u)trtnircoytfa rauvs s0 2uo(m oudlleelnetl()arra(mpot0apenio3tldlsDean onu)teenir3tatfmtelu o;s0 2umim io1op e ncs ()s2ua(rpnt0opeo fcildls2rm(msnt4areoir3totfmt lnvo t0setmio3oo4apee iei t sDurumoou0alx  ociydlm ulnmp (0 exrmf oydom r u slt  exoimpiy1lpen fci t) 2rmumoou1aexn ociatfs elums;u) ltomo oydfa eli ol(0srtoxr3oy1alenlnetlt  2rmumpno0opeomi3ilsla um(mo;(0 exrif3oadlptr ivi;s) rtm(o nudol  micias)srrmum no1ope  f3ilt sDumu ont0tltoio ia1late nes;s0 2tr(o ou4ol nlfesls srtr(ro;t1texn i3iad a2rauvs (0 lxomrcoo1fatrau o;()t2xm(rpiydlptelfesa(fartm(rp;u1tee mociad a el( ont0trxrio3iydoa eluvi;s)trxr(m3no4oltelnetls arrm(m nu1opx mi3ils a2rmn s;(0tetoif3iatfmtrlueo;s)tetoxm3oo1ll   fvtatf 2uaurpou0oex ifeiadla2ranvpnt0aexoxo oodfa rli o s srxoxm ny1optemncs t s2ta( pnt4tlto oeiadla2rmums u4 renxf3tytlmt lues;s) rxmir nu1lptelivsas aDraump;u1tlx ioetytlm rluvo u)altnxr3oatlmteanvo;( s2toxmpiy4lltn ncia( a2taxmp;t4altn ieiadfa2rmuvo u0 ltrif oydoa rlneils0 etmio ny4lltemfvsatfarur(r nu1tetoifciasla rlnms t)tltomf oatfmDeanvils0trtr(m3oy4amtnmivsas srrm( ono4tlx  f3taslmDemumo;u0treomfcoadlmDe ivs;s0seuo(o nu1am emfvtas)a2raurp;u1optnmfcildla2ulu ont)artnxf iatfm rlnvo;t srtm(o oydamtn nesl(  rrau o;t1ope mi3iad mDrlu s u)artnmf io1fmDeauei;()srxm(r3ou4lltnlnvsat)srumxmono4alto iciysfs eau s;u4 rxrir3tadlaDeli i t0t2toxopoo4lm  mivsls aDtr(ro;u4opeoioeiyt m rmums t4trtrxr tytom  anei;s0sexoxo3ny4lpeelici tfs2um(  no0tltnmo3iytfm2rmump;t0 rxnio3tadlmt lnvi s)seuo(m3oodap  liesa()srtmxm nt4aetn feiyt a umn p;t)texrxfcty1oatelues;( sexo(opoo1aleelnci s aDtrx  ;o4altoioeiadlaDulumo;() rxrirctodoaDrluvs t)t2xm(o3ny4ap   icsl(  Dtr( p;u0olxnmf3iltlsDulnms t0 exrmf3io1opteau ols0s2tm(r3oudale  fetl()srrrx oot1oet mocilt sDel(vonu0aexrio3iydlpDranvilt)srxrxm3oydom elfvtl( sDraxmp;u1alt  ocias a emnvp;t0 eerir3oodomtraivo (  2toxo3oudllenlfes t)aDuaumpot1tet  fciyd s ulu pnt)tltrxf oodoaDr u s;() 2ur(o no4lm eliviat  Dtrx  nt4apx  f3iltfmDelumsnu)aexnxrcoytomt aivs s s2trxm3oydlmee nvs sfsDra(r oo1tpx ifeiadfm2em(mp;u)alxrxr ootfpD luvo s) 2urir3io4llt mfetat s2rrurpno1olxo f3ilsfa2umuvp;(0 lxrxf3ta1omtran s s)s2trirpnudomt  fei t)s2rmur ou1ole ifciad mDeluvp;t0tltomo todfmDrlnes (  2urirpnydal nlies s  rum(  nt4oeeoii3tytfm elumonu4aexnmf todopD  nvo s  rum(r nudllt lfci sfaDtrxmpno4altnmoetytls ulu p (4 rxrmrcoa1fa e neo t srtmio3nydol nlnvt ( aDrm(r ;u0olxoii3ilt s elumo t4teenmf ootlpDeln s (  eto(m no1al  lnviasfarrm(ronu4alto feiatls2rm(vsnu4 rxrmr3oydomtelnes;s texrxm3iudlme  fvi ( a2rmxmonu1aetomfcild mDrmuvo;(4 rxoifcoa1om  livils0t2xmxm3nu4ape lncs t)a2rmum nu4alt ii3tydfa2rm(ms;(0aeenif3totlmD  uesl()tetrxopoy4lm n net ()aDururont0open f3tasfsDemn p u4teerio oytlat lnei;t)texmxr3iodlpenmicta( s2uaumpno1tlxomfeiyd mDumn pnu4aeeomf to1fmt ln o (0 rxoxrpiudop nlnvi s)sruaurpou4texoiociaslmDrl(vpnt)arxoxo3iadfm  aues s0 rumxm nu4omtemnes tfsDumxr ;o4ole iieiltfaDel( s u0 lxomfcty1lpD au ols teuoiopio1om emivs ()aDtr(rp;u1olxomictysfs2rau snu0 rtomf iydop eai ilt0srtoio iu4lme mneilt)s2tm(  ;u0apxoifetyt a ea(mo (0tleomfctytfatraneolt0srxmir3iu4lp elncta()arra(r nu1aexo o3ilt a uanvp;()tlerxf oa1fp rlnvo s) exmxr nu1lleemicta() 2tmur oo1opxn iciydlsDrm(ms u) etoifciadfmte u s t sexrxr3ny1omeemiet (f Dum(  ou1apx ii3iyd m emump;u0aeeriocoy1opDeaueo;t)s2xr(m3ou1am  mfcil()a2ur(m no1opx  octlt m2ulnmpnt) ltrirciotoat livils s2to(mpoodoltemivtatf Dumur nt0tlxnii3iatfa ul( ont4 etrxr ta1lmDe nvi t) rxm(o3io4al elnciatfarrau  ;t4olxn fciyd m uln o (4tlxrmr3tytlatr nei;( teurim nodapt miei (fsrtrumpoo0ape ifetlt sDra(vpnu4tltriocoa1lmtrauvo;()trumio iodomt lneilt  rur(  ;u0tltnmocils a2em( p;u0 lxnmf ia1oatelnvols)s2xoir io4lmenmnvt (fa2tm( oou4oexnio3iydfsDrmuvs;u4areoxr3totfmtrln slt0texrim nu4lltn nct s)sDtmx oot0teto f3ild s rmumont0arxnmociatfmDe ieolt0sexo(o3oo1ll n neils aDra(mo;t1oetoio3tas mDumnvs;t4artoxo3ootla e nei ()s2xmxr nudalt mneiat) Drrx ono4oexnmfeiytfa ulnmo (0teermf iytfmDelu olt0srxrxopoy1lmtnlfcs ( arraxmpou4texnifcild s rm(monu) etnxrctydop eanvs t)setoir nudlpt livs s)a2rr(mp;u1tlxnmociyd m emn p (4artoio3io1fptrai olt)srtmxr oy1altelfes sfa2rr(ro;u4tpenmicias s uaumo t0aetnio3to1latrau s;t s2uo(r3oudlm  lfvtl(fa2rmx pou4tptnmfeild m2rmn p ()altrif iydlpt  nvo;s)seumimpnu1lpte feslt) Drau  no4tex  ictys m2ul( p;t) reoxo io1omDe u i (0trtmir3oudap nlnvi tfa2tr(root1apxo o3tydla2ea(ms;u)alxrmr oatlaDr uvo;( sexrxo3ou1aleemietl() rtrxrpno1openmietat sDeanvs t) rtoxocia1latrluvo t)texo(r iy1lm elivt t)sDum(  ;u4olxnioeils s rm(mo;t0 leomo3to1om eaneols  rumio oodom nlnes s aDta(root4ape  i3ilslmDelnvs t0 exoxf3totoaDe uvi s)t2tmiopou1olt mnvta() rtm( o;o0opx  ieils aDuaumsnu4 lxnmfcia1fptraivi;()srxrxopnu1lm  mfvia(fsrtmu oou4tee ii3iad a2uan pn(4alxnmo ta1fm eaues (0srumxm3nu4ol  lncsa(fs2taumoou1aet  ociatfs umuvsnu0 reomf3iatoatr iei;s  rxm(o no1ol   fvias)srraurp;t1aeeomocildlsDuau o (4teenmo3iatlp elieo t)seurir iu4alt lncsa(fsrrauront1opt  oeiad mDrauvsnu) eermr3io1optraivi ()sruo(o nydol n ivias s2um(mono4altnmfciadlsDel(vo;t4 etoxr3iodomtr ieslt0 2xmiopnu4ope  ictas)arta(  ;o4tpx ii3ilsfa raump;(0 exomfcoa1lpt  nvil(0tetrxm3ny1ope mnciat)a2rr(mont0aexnmf3ilsla2eauvs u4artnmo todlp rauvi (0srur(r nudop n nvsa( srumurpoo1texnmfetlsfmDeanms;u4 reomo3iadlpDe uvs t)s2tmxmpnu4lm e ict s)sruax ono0texomi3iasfaDul(mpn(0tlxnxr ootfp   ivsls  euoxrpoy4lpe lnetl(fsrrmxmpoo4aeen oeiysfm rln pnu0altnxo3iatla elivo;s)trtmir oudll   nct sfsDum(m ot4oexo f3tytls ul(vp t)tlxomfcta1omDraiesl()seto(mpoy1ame lnctls)aDua(mp;u4ape iociltlaDeanvsnu)texrirctotomD anvsls srurxr3iu4am e fvslt)sDua(mpou4tpe  fciltlm2ua(mo (4teermr3iatoa r uvilt)s2tm(o3ny1lme  nvi sfa2urum ot4opx if3tadfaDranvp;() exnxf oatfpD  u i;s)texmxr oydapt  ict (farrrx poo1apenif3iltlsDel(mon()trtomo3iadla r u i t) exmirpny1lmt lnvs t aDtax poo4tleo ocildlm2rlnms u4aeeriocoo1omD auvilt0tetoxrpny4oltemfctasfaDtmx  ;t1oex  fciysfm2emump;(4teerxo3oatop ranvs;( seurim3io1ale mivs sfs2tru ono1alxnmocilt s2rluvo;t)texoxrctadomDr ivilt0srxm(o no4opt lnciatfarum(rp;u0opeoifctlt m2ranmo t0 leomr oa1fatrli s;t  rtmirpiu4lm n fvsa(f Dtmu pou0aeenmfetldfm2ua(mp;t) rxnxr3oo1fat  ieil( trxm(r3iu1omtemivsl( aDtrx ono0apenmoeiydla rl(monu0 rtoifcta1omt  ieo;s0 exrimpoo1lmee ivi s s2ra(mooo1apxn oeiltlm ul(vp u4 renmfcto1fa e u sl(0sruo(opnu1ame mfei s) 2ta(r ;u0tlx iietydls rlums u0tlxoxo3to1lp eluvolt0tetmio nu1lm  mnctatfa2rmumooo0aet  ietltla2um(vo t)texrmrciy1fp  livil( t2toir iu1aptn neta( a2tr(r nt0tpeoio3iasfs2ul( s t) lxrir totlp rluvo ( seto(opiu1lme mietasf rrmumpot0aex  fciydfmDelumsnt0 renxo3oatoate uesls) etoxo io1llenlivs t s2tmumpnt0apt mfetysfa2uln p ()arxnmo3tydlm  lneo;s)srxoxm3ny1om e icias)arta(mpoo1oexn feils mDran o;(0trenmfciotfa rai i;s)tetmxrpno1opt livtat  rtrur nu1aetoio3tasfsDumu p;u0aexnmr3iotlpD  u s (0truo(opnydaptnmnesa(fsDraurpou0olx  ictls a elumo (4alenirciydfptrauvil(  rumxm3nu1lme livtltfs2um(ronu4tpeoiicilsfm2emu s u0alxoxf3iotomtrli il( setmio3oy4amtnlnvsl()sDta(mp;t4olxo oeilsfmDrl(mpnu4alxrxo iytomDrluvs s0 ruo(rpnydlp elnvsl(  2rrxr ;u4apx io3iatlsDeau pn(0tlxomocoytfmD au olt)seurio3nodoptnlneil() 2taxm nt4teeomf3iasls uan ont)tlxoxociytlpDeanvo (0 2to(r3oy1op nlfeil(fs2ur(mp;u0ope if3iaslm2rmnmsnt)altrxr oa1fmD  ivi;s) rtmxopno1oltnlfctlt  rrr(  nu4tpt  fciasfmDum(vp ()altrmf iatlaDe ivsls)setr(o no4om e ncsls)s2tmump;t0tetnmictytla um(ms u4 rerxocoo1la   uvs;()truo(o oydom nmnci t)sDtruro;t4ale  ietls sDeln sn(0 lermo3oydoa ranes;(0srum(o nudapen feia() rtmxr ;t0aee mociydfm ulnvo u0altrxf3tatlatran s s trxoio3ny4lpt  ncsl( a2taurpnu0aeeo iciyt aDel(vp;u0 rxoiociodfm r nei s)srxoxrpoudll n iciatf Durxro;t0olt ifciydfmDem( s (4 lerxo3ootfptelueo;t)srxm(m3oo1ope  ivi ( srrr(  oo4tle  ocils s2raumsnu0tltriociadoaD an sl( srurimpoudlm  mivt ()srumu  oo0opto f3tldla umn onu) lermoctodoaD anei t0t2to(o3nydom elnctls srtrump;u1aptoioetld mDeluvp t0tltoxo oodfaDeluvi;(0teuoim3iydomtnlnetl()srrm(m nt1apx mf3tydfmDul(mo t4trxnxr iatfpteaueslt)t2toxo3ou4ll e fct s)aDurxroot1oexnmfciasfa ua(vo (4arermo oy1omtr nvslt)srxm(opiu4olenmnes t)sDumurooo4oeen ictls s2uln s;()alxnmrcoy1oatr ieslt)seurir oodom  mnesat) rur(mpou1apxn ieiadfa ra(vs;t0texrxfciy1fat auvil() rurir3iodlpt  iei s) 2ra(ronu4tlto octltlsDrmu o t) eenif tatfa eanei;t srtmxm3oodole lfci () rrr(ro;o1texomf3tldls emn s t0alermr tatlpt luvo (  2uoim oydamenlnet (fsDraxmonu4tpxn i3iadlmDrlnms;u0alenmocia1op raivs;t0s2xrxm3oodoptnmictlsfsrtrurpot0oexnmf3ild m uauvo (0 etrxo oo1omDe neo s)t2urxo3iu1ol nmncilt arrmx pot0ale mietld s2ul(mo;(4aeeoifcta1om r uvsls0srxoxo3iu1omt mnciatfa2rmurpoo4aeeomictysfs2ua( snt0aexrmf oo1opDraues s)srxoxm3iodape mnes s)srra(mono4ale ioeiydls rlnmo t4trxomo3totoaDelneols)s2tmxr3iydll  mieta() Duaxm ;o4optnioctydlaDum(ms;u) rtnxf iydoa   u s t0 rtoimpny4apt liei t) Drrxmpou1tpt  fciltfm2ra( p;t) eerxf iodfp eauvilt)srtoir nudopt mivtatf Drrxr ;o1optomieiydfs uluvp (4tlxnirciodlpt aneils trtm(o oo1lmenmnctlsf Dtaxrpno1aex io3tys s ul(ms u0aexnmrctydop elnvo;( sruoir3io1opte iciasf Dtrur ou0oetniociysfs2rmu o;u)aeenxr3ta1opD lnei;s s2tr(opio1op e netas)s2trxm ;o0tpxniociltlsDemu on() reomociy1lmDrau s ()setoim nu4al nmfciat)aDra(ront0olt ifeias m2uluvp ()texrxr3tydlm   u i;(0t2xr(m nudolt mfctl()artr( p;o1oet mocias aDeaumo t4 reoif3iatfaDe nvs;t0truo(o nodamtelicia()artauronu4alx mfciltla2em(mo;(4altrxo3oatomtraueil(0t2umxrpnu4llt mfci t)aDtm(mpno1altn ocild a2emn p;t4trxnxf3ootomteluvs t)srto(r3oy4lmte fetat) rtaum ;u1aeeomf3tld aDra( s;t4aeeomf3ty1la r uvils0tetmxm iy4ole  fvtl() 2raxrpno0oetn octlsfm rm(vs t)texrmf oatopDeanvils srurimpnodamt liesltf rumx oot1aeenifciyd a2umu pnu4tltnifcoo1oatr nvsl(0s2urirpiydlltnmicilt  Drrxrpno4altoio3iadfs em(msnu0 lerxocoadom  aieo () 2xrim oy4lpenlnct ( aDur(mpno0oeeoiieiytfa emnmp;(0alxnmo3iatfaDeai s t) exm(r nodalenmfes ()s2urum ;o4tpx mieiat s2eln o ()trtrxfctatfaDr u o t  etoim nydole lnvils s2rmxmo;o0texomf3iatlmDemn pnu) eenif oa1oaDrlu s;s)t2umim3oo4am nmfcsa(  rtau ooo4alen f3tytls2eanvs;t) rtrio3iotlp e i i;t truoio nydalt  neiat s2um(moot0olx  fctatlsDra( sn(0 rtomocootlm   nei;t0 rtrimpou4olt  nciltfaDtaurpnt1altoifciyt aDua(mon(4arxnir3ootlmtelivolt tetmirpoy4llt  nvtls artmu pou1tpxo iciadlmDra(vo;t)aexoxo oy1fpD auvo;s)t2trxr iy1ope  nvt (f rrm(rpnt1oexn ieiyt a2rlnmp u) rxomrcootlmD  uvs;t)t2tr(r iydom   nvtlt srumxm ;o1alenio3iltls2uln s;u0artoir3oy1optrlnvol(0 eum(m iydome lfvsls) rtr( o;u4aptn i3iytfmDra( pnt) rxnio3oo1fpt  nvi s t2xr(m ou1lpe lnet ( aDrmurpno0apxnifcildfm2eauvpnt)alxoio ootop eli s s  2xoxmpou4lpeemieslsfsDuaumpoo1aptn fctysfsDrmums;()tlxnio3tatfmteaivs;t0teumxm3iudlp  mictasfsDumxm ;o1tee iieiadfm rauvs t0arxnio3oy1lpDeauei t trxo(m3ou4lmtnmnvtlt sDrmu pou0texomociytlm2rm( snu)aexoircto1op rauei;t  rurio3nu4lptn nvtlt) Dua(m ;o4opx ii3iasla elumsn(4 lenir iadlp rau o;s  eur(r oo4al e ies t aDtrxmoou4tee iietad m2em(mo t)altnxf oo1faD au o;()srtr(mpiudlmt mivtas)aDrmum no4tlen i3ils sDul(vpn()trxoxf3tadlpt au ils  rtm(mpoy4altnmfcilsf Dtmxm ot1texniieiyt s2ra(vpnu0tetrxr oatlaD aueil() 2trxr no1am e iet sf 2rrurpoo4opeomo3tlslaDul(ms;t) etoxr3totfm rli ils seumxo3oudolt mnci sf rrmurono0alx  fctadlm ulnmp;u4tlermrctadlpDeluesl( teumiopnydll elici ( aDtmumoot4apx moctaslsDea(mp (4tlxnmr3tatfa   i i;t0srtrxm iy1op nmncs sfs2tau  no0tptoif3ils s ua( pn(4aetnxo tadfmtran o (0sexrimpoodlp emivilt)srtmxro;o1aleomfctasfsDemumonu4alxrxrciytoaDeln ols)trxrxo3ou4ole lnet ()s2rrxrpou1tet iietydfsDea(mpn(4trtnxociydlm rln s s0sexmxmpnudopt mnet s)s2ua(m ;t0tle  fetyd a2rlnvp (4 rtnxoctytfptelu olt0truo(m oydlmt lietlt s2uru p;o4oleoifctyt s2rl(vo t)trxoxo tatfat  n s ( setoir3iu4llee nvt () 2rmur nu0opeomiciyt m umums ()trtrxr3oadfat anvsls)s2urimpou4omtn fvsatf rumurpnu0aleoif3iasfmDrluvo u0 lxnmr oo1fatrluvi;( srtoxo ny1llenmncsas artaur oo0tex mfctydlaDumnmo;u0 rtrifcoydoat  n i;t0 exmir3iydopt lnvtl()s2trxmp;u1olenmi3tasls rl(ms;t4aetrxr tytfmtranes;s  rxm(o iy1am nlnvs s) 2trx p;u1aptnio3iydla2ra(mont0 ltoiocia1lmDelivo;s0teuo(opoo4lle livtas)arraxm ou1opx  f3iltla2ul(vsnu)tltnmr oo1opDelneo;(0trxoxm3oo1lmtnmfeil( sDtmx oou1tpe iicilt mDelu p;t4aeeomf3tatoaDelu sls0sruoir oo1ape mict sfa2raxrpno4aetniieiatfsDuan ont)arermf totfmD lnvo ( seto(r3iy4aptemiei (  rrm(mooo0opx mfciadlaDea(vo;t0aexnmf3oy1fa raivi;t0setrxr3oy4lmenmics s)a2tmx  ot4opeomfctlslsDumump () rxoxoctytfat lu s s0 rtmimpny1lpe  fvsa( aDur( p;u4tleoifeiltla rln s;u)tlxnif3ty1laDrlu i (0t2toxo no1altemfetls artauro;u4tleoioeiad m rlnvo;t4 etnmo io1om r ueol(0 etoio io4aptnlfci t srumxm nu0apeo ociysfa eau s t) renmr3to1lpDrlivi;(0 2toxrpio1lle  ietltf 2trum nu1oeeomfcilt aDrm( p;t0tetrxo3iytfmte ueils0s2uoio3iu4olenmfct ( a2umu pot1tltnifeilsfa2umumo (4alenmrctadfptean ilt) rtmxmpno4omenmnet (faruau onu0aexnifctys aDumnms () etnxr io1opt  ivi ( srxmxm3nu4ome lfcsls)aruaxmpno4oex  iciad s2el(msnu0alxrmocoytoa  li i;t)t2urimpiodlmeemfeta()artaxm oo4alenmo3iad m rmn o t4alxoir3ta1lpD  n s s0teur(r3oo1lpe lnet t) Drm(rpoo4tet mfeiad a2el( o (4artnir ootfmtelivo t0t2uo(m3nu4open netlsfa2rrumpnt4tex  ociydlaDrl(mpnu0 rermf3iodfpt ln ils0teurxo io4lpenliet s)srra(mpou4oltn i3iydla2rm(vs;t4aexrxocoatopDraivilt) ruo(m ou4ap  mnes ()arumur nt1tlxoifetyd aDelums u4areoio3oy1la raivi t0tetmio iudlpenlfctlt) Drm(rpno0oleniiciatfsDulu o (0treomocto1oaD  ivslt)s2xmim nydlmtn fvs s s2umxmp;o0oex iociys s rlnvp u0tlermr tatlmtrln i s)s2ur(m3iodam nlietls)arumxroou1tpx io3iat s2umuvpnt)aeeoxo oodfm r iei;t srxr(rpoo1ap e nvta(fsDrm(r ;t1tptniocilsfm ea(vp;u0trxnmo todfa elieo t)t2uoxm3ou1olen ivslsf 2uaurpnt4texnifcildfs2ul(vsn(4tleoxr oatopD  n s t0setoim iudop emneslt)arta(ro;t0tlenmoeiydlmDum(vonu4aeerxrcoatlmt  nes s teum(m3ny4ame mfvil( aDtm(m ;u0optoioeildls umnms;t)tlerio3io1la e i s;t)srtr(o oodllt  netl(fsDra(  ;o1alx  f3ilsfs eln o;(4 exnxrciadlpDe n i;t) 2xmxr io1op n nvsltfsDtr(mont4olxniictytls ra(vs;u)aetrxf3iatfaDeauvs;s s2to(m3no1aptnmfeils) 2trxmp;t4oltnmfciasls rmn o (0aetrio3ootfptran il()s2xmir ou1ope mnes t aDtmuro;u0apenmoetls mDeluvp;(4tetnmf3tytlp e i il() rum(m no4oltelnesatfs2trurooo4aexn i3ildfa2uauvo;u0aexnxfciytlmDelivs t t2trxo3iu4lmee feiatfs2umx o;t4optnmi3iasfs2el( p;u)tetrmfciydoa  au slt0seur(m ny1ol nlfvt s)s2raxr ;o4optn iciydfa ra(vont0 rtnmf tydop eaueolt trum(opoudolt liei t  ruaumo;o4tpe  f3tytls2elums u4 eenio ty1fate n s s trur(r iydaptemnet sf rtmxmp;t4opx ioetytla emnvpnt0 rxrxf3iodoaD anes;t)texrio3nodamt mncta()aDumurp;u0tee miciys sDrmump t0aexnmocoadfmtrluei;t  euoxo3oodalt mfeiat a2rmurpnt0aeeomfetat aDea( s;(4trxnir3totlp e ivs () rxmirpio1apt mivsas  Drm(mp;u4oltomoeiatfa uaump;t0tlermoctodlmDran s;t0teurim3oo1lmt  nctl(fsDraur ;t1oetoiociatfs2ea(mp ()trtoir3to1latr ies;t trxmirpny4lmtemicta()a2trxro;t0olenii3tysfa2ra( snt0 exrmociytlmte ieols  2uo(o3iodop emicil()arrrx oou1olenio3ias a ul(msn(4aeeomociy1fpt  u o;(0teur(m oy1olee fet s)aDtrxrpot0olxomictatfmDum(mp;t4 etrmrctatlp  lies t) 2trxr3ou1opt lfvs t s2uax oou4tptn oeildfm uauvsn(4areomrctodfatr n o s)t2uoir iy1lp emncilt)aDtm(  ;o0aleo o3iltfmDelnvs (4 ltrxo3tadoateauvols  exmxo3nu1op nmieil(fs2tmx  ou4olx io3iyt s ean pnt0texoif3oodom raues t srtrim ny1amtnmnetl(fsDtau  ;t1alenifcilsfa ua(mo t) eenxo3ta1fa r nvi;t sexmimpny4ll emfctlt  rrr( p;o0apeoiietld a em(vp;u4aeerirctytlaD aieo ()texr(m3oydlm nmfei t) 2trx  ;o0aex iieiytfa2ranms;() reomfctatfptrauvs s s2xoxm3nu1amt  fviat) rrrum ;u0olx  i3iysls2ea(msn(4trenxf iy1op  au s ()setoxr3nydlmt lncta( srururono4tetomi3ias sDrmu o (4artnio oatfp  an i;t0s2to(mpny4llt liviatf rtrurpno4tltomociasls2elnmp;t0treoifcty1late ivs;t) eumxo3no4lp elivsa(fs2uru p;u0texo i3iytlmDumnvpnt0 leomocoy1laDelu ol()t2xoxo iu4apeelfcsatfa2rmx p;o1oexnmieiyt sDeaumsnu)aexoif3tatla  aueolt)teuoxm nu4al emivs (fa2um(rpou4aee  ieildla elnvpnu)arerxocty1fatelu o;t)sruoir3oudap n ivtls) rrmu  no0tltomfcild mDua(vp;(0areoxr todlaD  ueo ( seumxr3nydamtnliei () 2taxro;t1aet  o3iadfs ul(mpnu0tltnmf3oatfaD ai il(  rxo(o ou1aptemietat)a2tmxrp;t0apx  ocilsfm emnmp;t0tlenxf3todoa  an sl() 2xrir3no4ame  fci s) 2tm(  ;u4tpeo i3ildfa ran o;(0 rtnmo3iodoptr n s ()srxrimpoodoptn fctasfaDumurp;t1olen oeiltfm2uau ont4 rtomocoydoatr u o;( s2trirpiydam  lnvtls a2rrurpnt0oltn i3iltfa2rmnvp t)artomrctodlm rai il() rxr(mpiydom nlnvt () rtr( pot4oex io3iasfm rmuvo u4alerio3iotlptrli sl(  2xmxm3oo4ale lieia()sDtmx  ;t0aleoio3tasfa2rmuvo (4 rtomo3io1latrauvs t0trxmxo3ou4omt lfesa(fsrtr(r no0apxniiciydfaDemn o u4alenmf3oo1oa   n o;s)t2xr(o3oo1opt  icils)aDrau  ou4apxomf3iys sDemumon(4tltnir3oa1op  ln o s) rtmimpnudaltemnvtls)arum(mo;t4oee mfctad m rmu pn(0arxnxr iatfpD  ues s texrxr3io4llt  netat sDtaxroou4ole mfeiltfm uln o u0artomf3tatfm r neol() etrxmpiydap  mnetas sDtmxrp;u4tltnmo3iadlaDeanmon(4trermf3oa1oaDelneo ( s2xoir3nydlpt  ncils)arrr( ont1aeeo f3iatfs emuvp;(4aeenxo tadomt  u ol() exmiopno1olen nviasfs2tr(mpot1tlxnmociasfsDea( o t) leoirciydopDr neo t  2xrxr3iy1apt livsl(fsrtrumo;t0aexo oeiad sDum(mp;u0texoir tadla eaivs () rxr(mpiydamte icia(faDum( p;o4aexomieildfmDul(ms u0tlxomo3oydoate n ilt0 rtmxr3ny4ole mfvtls)s2uau  no4tleo o3ildfm2emnvp;()alxomo iotlpDrlivs ()trxoir3iy1ap elicia( sDraum no1oeeo ociyslm ul(mpnu0tltrmf3oodfm rlneilt)t2umxm3iy4omt miesa(  rur( oou0tpeo ietldfsDel(vo;t0trtomf3tydfp r nvslt0sexo(rpnu1ale mneias) rrrx  no1olt  oetydfs ra(mp;() renif to1fpDr ieol(0tetoio3nu4ameemiesa(f Dtm( p;u4alenmfcildfaDrmn o;u4aeeoir3oy1fpDelu ils)s2um(r nydap nmivt t)aDtm(ro;o4oex iieildla2eauvp;u4aetnif3tadfmt  u i s  rum(m iu1amtemfctat)s2ur(mpnu0aexn fctatla2ra(mon(0 rtrio iodlpt lieils0truoiopnodap  lieilt)sDurum ot1oetnioctaslm uln p (4arxomr3oadfpt ai s t)texmxopou4ol n fcia( srumx  ou0tex ii3ias aDumu o;t0 lerxrciadfa  lu ols sexmimpoudaltn nct (  rtax o;t1ole  i3tytlm ul( s;u0 rtnifciy1fpt li i s seuoio3nodom n fci s  rrr( pou1tee  octlsfa ua(mo u4 rtnir3oodopteauvs (0s2umxr3oy1altemnvslt  2rmumpou1aptnmi3tls a2um(vp;(0 eermfcoodomtr i o t  rxrxr oy1lptn fcias)s2rru  no4teen ocildlsDumu s t0tlenxf iy1fatr nvilt)texo(m oy1opee ivia() 2uau  nt0apt  f3iysls rmu s;(4alenmr tydla  luvils0texoxopno1apee nes t  rumurpoo4tlxomo3tatlaDem(vp (4trxnmr3iodlm  anvi t) ruo(m nu1amt  ivilt aDtrumpnu4opt  ociltfm umumo t4tlxomfctydfp  lnes t srum(o iodapenmfcs t)arua(root1teen feildfa ul( s;t4arxnmfciytfpDeluei;( srur(o io1omtelnes s)a2taxmo;u1optnmo3iyt s2umnvs;t0trtnmfcoa1omD  ivi t0t2uo(r3ny4lme livs sf rur(roou0opxnmf3tyt s el(vs;t4 etoxf oodfate uei t0 etm(o iydllenmncsat s2ururoot4aleoioeias sDra(vp u0 rermf oodoa eluei;s0sexmxo3nodllt lfvs s)a2raump;o4oet iieild aDem(mpn()arxrxo oo1la rlnvil(0setm(o oo4ol elivsl(f 2tax  nt1texoiietys mDumn snt0tlxoir io1omt livsls  rto(r ou1lp nlnvtas) rurxrpou0aptomiciatlaDel(vsnt)tetrmociadopDrli il( trxmxr3oo1oltn nvi t)sDrax  ou4apxnmo3iyt m2eau pn(4artoif3iotoat  ivil(0s2xo(r3iu1opte ivtltf rtmurpot1opt mfctld sDranmsnu0alxnmr3ta1fpDr iei;(0 rtoiopio1apeemfesa() rtaxmo;t1tlt  fciatfm eln o u4aexoircoo1fpte nvi;()sruoxrpio1openmnei t arrrxro;t4alxo ociadla elumo t)tltnmr3to1om  luvolt  rurio3oy4ol   netl() Dta( ono0olx moeiys s2eanvs;u)arenxr tydoptranvils)t2toiopiy4ll n nes () rum(r oo4tex mi3iat aDulnmp;()aeenifcto1omD auvs;(0 2urirpno4ole mictas a2uaumo;o0opxomo3iyslm ra(mo;t0 etnmrciadomt ai sl(0 2urio oudoltn ieta()s2tmx  ;t1tpx ifeiadls2ean s;(0aeeoir tytfm  auvo t)texrxr ny1ll e ncsls)arur(m nt4texn ietad m ea( pn(4areoif oodfm  aies;t t2xr(r3iydomt lfci (f 2tmu  ;u4tpeomieiys aDra( sn(0altrmfctatlmDrlnvil(0sexrxr ny4lp emfctas)aDum(rpnt0optomi3iydlsDeln snu4aeeomr ia1op   n i;(0 exrxr io4omen fvs ()srtrxrpoo0apxo fctydla2emuvpnu0teenmfcoy1lp   i s (0 2tmir oodaptemiei t)srrm(mpoo1olenmietydla2em(vp;t0texrmociydfpt  i ol( t2umxo3iy4lm elnvsl(f rtaurpot0apt iieiydls2rm(mp (0aetoifcoydlmDelu i (  etrxo3ou4lltn nvt ( arrruroou0tlt  iciytfmDean o u)tetnmfcoatlpD  i s t0srtm(r3ou1al  lnei s)aDurump;u0tlt mfciys a el(vp (0aetnxf tadla  ln il(0texr(o ny1omte nvs s artmurooo0tee ii3tldlmDem(vp;()artrir3oadfa r ivil() etmim oodllenmnvslt)a2raxmpoo1oetnioetatls2rmnmonu0teeomo tytopt  ies;()srto(o3oo1lpte ietlt)s2trxmpno0alxomfeiltlsDrmn p;(4trtnxrciadoaDe ies ( s2xoir3iudll nlfvil( arrrur ot0oleoifeiadlm ra( p;u0 lxnifctadfm raneo s)srtmxmpou1al  lnvs ( sDrmx oot1aleo octaslm2em(mp t4altomf ia1oa  au il( t2xmxmpio4opt  ivsa( aDua(mp;o1aee mociat s rl(msnt)altnmfciotoa  li o;(0 2xr(opnu4amee fes t  Drr(r oo0teenmo3ias m2rl( sn(4 ltnir3oytlpDeln slt)srtoxrpiu4optelivt t sDumxmpnt4aeeo o3tls sDrlnvpnu4 etrif io1lpteliei (0 2xm(m ny4am nlfcs ( s2urxrpoo0texoiieiat a ua( s t)tlerio oy1fp e nvil(0 2umxmpny1lp   icil( aDtrxroot4oexo i3ildfaDrmnmo u)trenxrciodlate ivil()trxoxr iu4lp  mncslt  2tauronu0tlxnmoeiadlm rau p t)trxomr3todoa r nvsl( s2uoxr oo1al  lnctl(f Drrx  ;t4oex iictlt s uauvo;t)artrio ta1lmDeli o;s0s2uoirpiudome lnetls s2tr(r ;t0tpx  f3iad s elums;t0altoir oodfpte ieilt0t2trxo3ny4alen fctltf Dtrur oo0tlt  fciydfa2ua( o;u) ltnmf oo1lpDeai o t0s2umxmpou1amenmies s srum(mpno0tpto ieiys a2rmnvont0tlxrxf to1fa  li s;t sexmiopnu1lp  lnvsatf Drmxm ;t0apxomfeiydla ul(vp (4 ltnxf ty1oaD auvsls  2tmimpou1omtnmfetlt a2rrx p;o4tpe ioeiat m rl( ont0 eermrcoydlpte iei;(0setmir nu1op  lncta(fsDrmxmo;t0ape iicias sDumu pnu)arxomrcoo1lmD  ues () 2trio3ou4alen fet tf Duru  no1tlenmictlsla2el(vpnu4tltoircoadop  aneols) etm(r no4apenmics s arrmxr ;t1olxn f3iatfm rlums t0tlxoxrctydlm r uvslt0t2xm(o oudalee nctasfa2uax onu0teen feiysfm2elnvo u0aexnif totop   ies;t0 rtmxopnudam n fvils arrru ont0oltnmiciltfs2ua(ms (4trxnir3ootfpD  ies;()texmxo no4lpe mfcsl(fsrtrxrooo1tle mfctldlmDrmums;t) lxnxoctytlpD aivi;(0tetrim oudlmt  fesl(f rtmxmoot1apxnifeiasfm ea(mont)tlxrmr iytfatelnvo;(0trum(o no1lpe mnctat sDta(m oo0tltnio3tasfsDua( o;()tlxomf iy1faD li o;s0 2tm(o3io4lle lnes t aDumxrp;u0tee mietls sDra( s;t0 ltoif3oatfp  aieo t) 2ur(rpoydllte ieia(faDuau oou0openmfcildfa rlumon(0 rtnxfctatfa e u olt0 exoxm3iy4am e fcsltfsDtrxr ;t0olenmoeias s2uluvsnu) ltnirciotop r uvi;t)s2ur(r3iudll  mictat  Duru oot0apt mi3tls a emumo;(4aetnio oa1la raieols srxoio3io4omeemfesa()arurur ;o4tet mfeiasfm ulnmp u4 etrxrcootlpDeluei;t t2xo(rpnu4om nmfcsas  2ururpno4aeeomieiad m2ra(vont0trtnxrctatlm e nei s0s2uoxr nodop nlicsls)srrax  ou1tlto icias sDulnvon()tetnio3iatlat  n olt srxo(m3iu1lp  lfvs t) rrr(mpot0teeomoeiysfa el( pnt0tleomr3oy1om e nvo t) 2ur(r3iu4amt lnvias  Dururpou4tlx miciadlm2ul(ms t0 etnifcoytom   nvols sexo(m3oy1lle  iet ()aDrm(rp;t4tptomoeiltls2ul(vs;t)aeerxocoydfmtrli o;s)trxmio3nudam   ici (fartr(  nt4oee iicilsfa2emumo;(4aeeomo3iatfaDeln s t)srtoim nudlmeemfcslsfsrrm( pnt1opt  feiyd m ea( snt4areoxr tatlp raueo;s)setrxrpoudameelnvia( aDrax p;o1oeen iciydlsDel(mon(0 rtrio iy1oaD  nesls)s2umimpiydopen fcsls s2trxmo;t1aet mfeiasfa2em(vont0 lxrxfcootfpt lu s;() euo(o3iu4lpee icia( a2tmx oou1alto o3ils sDeau p (0trerxf3oy1fa   ivslt  2toiopno1lm   ieilt)s2um(m ;t0ole mfctatlm2eanmpnt0 ltrxo oy1f
\ No newline at end of file
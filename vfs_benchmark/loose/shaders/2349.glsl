@@ -0,0 +1 @@
+ies ( texr(mpny4lm emncils)s2tm(ront4apenmf3iat m rau o u4tetoxr3tytlatranvi;t0s2tmirpiu4opte neils)s2rm(monu4tpt mfetldfs2emump (0teenxoctydfmtraieslt t2xoxmpiudoptelnci sfs2ua(r nt1alxoifciydls eln o;t4tetnio ootlp  aues t0seur(r3ny4lm elfeiatfaDumu poo0tpenmfcilsfa2ea( p t)trerxo3oa1fm r uvslt0 2tr(rpoo1open ncs (fsrur(mpoo4olxn o3tlsfs uauvo (4alxrxo3tadlaD  u s t0srtmxmpiy1amtnmies t srrau poo1teenmi3iyt aDemnvonu)aeerif tydoatrlu o (0teurxo nudolee ieiat) rta(rpnu1open icilsls2rmnms u0 lxnifciy1optrluvils sruoxmpnydapt  ietltfsDtaxmoot0tet  i3tld s eluvonu4trxomo3oa1fa eai s s0 eurxr ny1am nlivtl(fsDraxmoot0tpe ifeiydfsDuauvp (4 lenxf3todfpD lnvs t0s2xmxrpny1aptemivta( aDuru poo0olxnif3iadfmDum( on(4tlxnxr iadfatelu il(0 rtrxopnodlle mfet s aDtr( pou0aee if3iltfa rm(mpn() eeoxr ta1fmD  i o s)sexm(o3ou4ll emneiasf rtmuroou0texniieiltfsDrmu p u) leoifciatoa  ai s;s srxmxm oo1amt  nctls) 2raxr no0olxomoetatlmDulnmonu) exrmo iydomDe u ols)srtrxm3io4lpen ici t s2rmxrpno4texniicils mDul(mp;u4trtnirciatoptrlneslt  etmxm oo4opee ict (fa2rm(r oo0aet  icilsls2rmuvo t0 rtrio oo1oat aivs;()t2xoxmpnu1lpeemfes (faDrmumo;u4oetnmi3ils mDeauvp u)aleomf iytfpDe ivo (  exmio oodllenmnvsls)srtm(mp;t1aptn ietat a2rm(mon(0tleriocty1lmt anvilt0srurxmpiy4ap nmfcils  2rr(m ;u1apen ociatlm ulu p ()trtrif3oy1lpD ln s ( srxoxm3oy4op  lnct sf rtmur oo0open icildlsDrmn o t0 rtomf iodlmt an o ( seuoio ou4lme mnct () rurx  oo0tetn i3tltfs em(vsnu0aleoxociadla rau s;(  rto(m3ny4omte ncs tf 2rrxm ot1tltomoeiadfaDrm(vs;t4aetrmfciadlp   n s;s) 2umxo3iydlme  net t) ruax pnu0opeomfciasfs eauvs;t) lenif3oy1fmDeaiei;s)s2urxopny1amtelfct s)aDta(moou4opeoio3ildlmDemnmp u4 lxrxr3oydlmDr neo;s0t2uoimpno4om e ieils) rtrx pnt4tlx  ociysfm elnms (0trerif3oadfp   nvi (0s2tr(o oudapt micslt) rururooo0aexnmociyt a em(vp;(0 rxrmfcto1op rai s;t0trxmio3io4ol  lics t) Dtmumpnu1alxo fctadlm2um( o t)altnxrcto1faDraiei t) rum(m no1apt  fvs ()srrmxro;t0tptoioetld mDumu pnu4 etomo3oadop  lu i;s0trtm(o ou1ape mies s aDumuroot0olen f3iysfs2rmn pn(0alxrxr3todfatrai sl(  eur(r io4ol emncias)aDra(r ;t1olxnifciatlm2ea( ont) lxoir iydfmDeli o;(0 rtmio iy4am  mici sfaDuru p;u0oetnioctltfs2uanmp u0 ltrxr3tadfaDe u ilt) rxo(r3iy4amte nctlsfs2urxm no1oexomf3iyd m uanvo;()aexomr3oy1fa e ivs;()t2tmxr3io4lm emnvt t)arrr(rpou1oee  ieiat mDrlumo;u)trxoiociydopt  u i s t2to(opiodom emnetl( a2rau  ou4tltniociasfa umnmo (0 lenir oy1op raueols0srtrir ny4amenmnesas) rrm(m ;u1oltnioctytfa eaumo u4 lxrif3ty1om eluvi;()seuoxo3oy4llenliet t s2tr(ro;t1tpeniicildls2el(vp;t0 reoxrcoadom   u o s)trxr(rpiu4lpeelfvilsfs2rr( p;o4oet  icild m2uau p;t4 eenmocoa1omt lneo;t s2xoxr3iy1optnlici (farraurooo4apeo iciatls2ea(mon()texoif oo1fp  an s (0 etriopno4ope  nvtl()aDur(mo;t4tetnifctlslm rm( ont0artoxf iadfm   uvilt)s2xrxmpiy1amee nvs s) ruaurp;o1apxo ietas a uaumon()tleoxr3ootfa eai sls)trumir iodam emict t) rraxmp;o0openiocilsfm emump (4arxniociy1opD aueo;()trtoxopnodlmeemiesas s2urx o;t1olx  iciaslaDuanmp;t0tetrxo3to1oa  aues t s2toiopiudaltnlfcs sfsrtr(m ou4tpxo o3iatfs2rmump;(0 lxrxo tatopt lu ol()s2xm(r3oy4ol emfctasf Dtr(mp;u1oeto fctldls2ulumo;t) eeomfctydop  auvsl()seuriopno1amen netas sDrrxro;u4olt ifcilsls2eanmpnt0artoiociatlm elnvi;() etoio3iu1alt licsls) Drm( poo4tpe  feias m2umnms t)alxoir3ta1lp  liesl( teuo(rpnydlpeemnesas)a2tmxrp;u4tpt moctydfm rm(mp;(0tetnmociodfp  aueol(0 2xo(o3iy1op  lfeta(f Dtmx  ;o0apenioetyt m2rm( pn(0aleomr3todlaDrlieils0setoxmpno1llt  nesa( a2raumpou0tpxnmo3iyd aDuluvs;(4trtrxr oydfptranvil( trur(o no4llt  ivi ( s2uax pnu1tet  feiyt mDeanvs t4tlerifciadfmtrai sls  exmimpiy1lp  lncs tfa2rr(rp;u0aexoioeiasla2ran p;u0altnmf tadom   nvils)s2umxmpno4lmtn nctls)aDrrxrp;u1oeenifeilsls rmnmp;t4artoio iotlmD  uvsls)t2umim oydale  fesl(f Dua(rpot1oetoiietltfa2umnvo t4 lenio3totomteau s s) etmxmpiydam nliciasfsrtaxrono0aeen icias s ea(mont0 exnmfcoytfm elnvi t0srxo(r ou1ol  mfetas sDrmxro;t4teto o3ias sDuanvo t) eenir iydoa  lnvs t0srumxr oudom n nctl(fsrrr(  no0aleo oeiyt m uluvo;t4treoif3tatfp eanei;t0srxrxopnu1ol n ics tfsDumx ooo0tpx  oeiytlaDea( s () exnxo oy1fpDrli ils s2trir3oodlpt lneiltfs2raxmoot1oet iicildfm2rl(mpn()tlxomr todoaDrluei (0trxr(m3oudop  lnvs ( srta( p;u1oexomfeiyt s ua(mo (4 lenir3oytomteai ol( teuo(opoydlltnlicil(fsrrrump;t1tpx  iciydlsDran p t) rxnircoatlpDrluvs t)texmiopno4apeelivi sfsDrrx p;u1olxomi3tadls umn o;u0 exnir iy1omte nvils0seuoimpno4lpenlivs t a2ua(r nu0olenii3tyt a2ra(vp;u4alxoiociotfm rlu i;t0srumxr iodap e nvtls sDuaxr ;t4alx mf3iltls2rau snt4 eenir3oydfmDe uvo;(0 etr(opio1omen ics s)srrmxr nu0aptnio3iltls rmnmsnu) eenxf ia1fmDr neo;s0 rurxm3ny1ol e icta(fs2rr(r ot4opxn oeiadfm rluvp;()alerir tydlm r u s s  rxmxr3nu4openmiet (fsrur(r nt1tpeo ietls s2em(vo;u)trxoxf3oa1omte ueolt tetrir3oy4al  lfetl(f rraumoot0ale io3tydfsDra(mo ()texoxr oadfp   ieo;()s2tmxr3no4optemictas)srta( pno1oex mo3ias a2ra( pnt)tltoio ty1lat  n slt  2xmir3oo1aleelnvi t) 2rr(m ;o0opxo ociad s rluvonu4tltoifciy1fptr nvs ( trtoir nodaleelfvils) 2ua( ont4alxomoetydlm2elnvpnu4arxrxf3iodfm  aiei;t truoxo3io4am e icilt s2ra(monu4tlx moetyd m2ranvont0 eermfcoatom r ies t0teuo(r3nu4lltnmnvia() Draxr ;u1tlxomietyt a rm(msnu)trtnxr oa1oa  lu sls0trtoirpny4op elicias) Dtmxrp;o0oexomfeils s2elnvp;()aexnxf3iotlp elu i;( trtrxr3nudamt mivtatfaDrmum ot4tlx iictlslmDum(mo;(4tlxnxf ta1lmDeaieslt)t2umim ou4ole  nes tf Draxr ;u1alx mfeiasfs ranmp;(4alxnifcoadoaD anvol() 2to(rpiodamt mfetat)srtmxm ou1tpto o3tys m em(vsnt0arxomr iydom ranes;t)srtoxopiodalenmnet t)a2ra(mont4aetnmf3tltla em(mont)artrxf iotlat  n o;() 2urio3no4ol elfet ( s2raxrp;o1oetomfeiyt sDeaums t)tltrxo ootlpteanes;t0 exo(o3io1lp   ietlsfs2rmu  nt0aptn oeiatlm2rlu o u0alxrxr3iatlp eauvo s)tetrxo ou1altnmicsa(  2rrxmp;u0ale mi3iys a eanvp (4 lenmrcoytfmDr nvo;() 2tr(m3iudapenlnetl( a2rau ono1aptn fetyt m2ulnmsn(0trxomfctotoa elueo;s0t2xmxr3oy4oltelfei tf 2urumoot1tpt miciys sDra(vo () rxomr3tatopteli olt0 euoio no4am nmfvtat)aDumumo;u1opxoiieiasla2emu s;(4aeeriocoadfmDe nvslt0srtmxm3iudoltemicsas a2umxronu1tet ii3ias mDul(vp u) exnir tydlpD  n i t seto(rpno4lmee netl(f 2rrxrp;t0tlxnif3iysfaDulu p;u0 leniocoodfpD luvi;t) euoimpnudlltnlfvi ()arrau o;o1tle  o3ildfmDem(mpnu)aetrir iydomDeli olt teuo(r3io1lm  lfvsa()a2tru pnt4olt  f3iadfm2el(mo t4teeomrciotlp eanes;s0 2tr(m3oy1am  mfeta( artm(mpou0ole io3iatlm2rl( p;(0altoircta1op e ueil( seurir3no4ole  ncia( sDrmxroou1aeenmocildlmDrl( pnu4aexomr ta1fmDr nei ()tetmir3iudapt  ivi (fsDtm(mo;t1tpx  o3ilsfs rl(mont) rerxo iadoaDeauesl(0srtoxm3io1op   ietltf 2rrxrpnt0alt ii3iatlm el( p;() rtrifcoatlptrlu i t srxrim3nudamtnlfvsas  rtax  ou1apxomoetldfm2elu o;() exoxfciy1faDrauei t0s2toir3nu1apee fvt s)srrm(mpno1tlx mo3iydfsDuauvp;()tleoiocoa1fpDr uvs;()trumiopiodolee nei s) Duaump;t0olx iictysfa2umumo;(0areomrctodlmtraneo;t trxoim3oodlmenlies ( sDtmur no0oltniocilsla2eanvp;u4trtnxociydoat aies t srtmxo3oo1olt  nct sfarrrxrp;t1alxo fciydls emumpn(4 ltrmfciatoatr ivsl()texo(m3nu1lleemieslsfsDrmxrp;o4tetoifeiasfa2rm(vs t) reoxr3oodfmDeaiei;(0 exmim no1op nlnvs ()s2umx o;t1tlxnmfeiysls uaumo ()alxrxo iotlmDranvo s0sexoim3ny4ole liviat  Drax  nt1opx mietytla ua( o t) exomrcto1omtrlieilt  2xoxrpnydom emnvsat  2ua( p;u4aeeomieiatls uanmo u)trxnmf todlat luvs;s0seuoxr oodap elfviat srrau  ;o0open ociadfmDulu p;u) ltomr3oytopt lnesl(  rtoimpno1lpenlivslt  Durxmont0olxomoetltfa2emu s t)teeoircta1faDeaiei;t0s2xrxr3iu1lmtn netlt)s2rmxr ot0tle io3tytfs em(vp;t4trxrmo tydfp eauvil() exm(o3io1apte netat)aDumxmpou4alx mo3iatlm2umn p;u4arxnxf3iatom   nvo;s)t2ur(opoo1ol   fvsat arrmx oou0opxnifctys m2ulnmo;t0 eenmf3ia1lptranvsl(0 etoirpiodlm eliet t aDua(  ou4aptomf3ilt sDuaump;()arerxrciytomtrau i t)trxrirpny4lme lfvilsf 2tmx  nt4ole iicildfsDraumo;t0teerxo3tatomDr i s;t sruoxmpio4ome lnet ()sDtrxmpnu1aptnmietad a2ul(vs u0 exomf3iatfpDraneols)texrxm3ny4ome mici t)arumumpou0texomieiys a ra(vpnt4 rxrxf3iadop rlneil(  eum(mpiudlm nlnvsls  Duru  no0ape  octat aDulnvp ()aleoxo tytfa   neo;t)s2urxopoy4om  micil()s2raurp;u1tex mfciys m2elu pn(0tlenmf3iotlp ean ilt0 etoxr oo1ale  ivta(fartauro;t1optomi3tltfa2umn s;t4tleomfciodop e ueolt texmxm iu1opt  fetas  rra( oou1oet ii3tadlm2um( p;u)aetoif iydoateau s ( srtmxr3oy4optelicsl(  rra(mo;o1alxnmo3iatfsDrln pn()arxrif3tydlp rauvolt0s2tm(opiudolenlfcs (fsDumx ono4aleomfctydfm2rlumo;t0alxoio3oa1opDr nvo t)setoir3ou4lleemncil() Dtaumont0opt  ieiltfs elu snt) rxnifcto1om   ieo ( sexo(o3oo4ll n iciatf Drrxroot1teenii3tasfaDeln pn()aeeriocty1fmDran sl()tetoir iy4lltn fcs tfarrm(  ;u0tlxn iciatla2uauvo;u) lxnxf3iotlpDr nvi t)truo(m3oo1am emncia( s2trxroou4oexoii3tltlm umnvs t)aeenxr3iydfmtrlnvo t0trur(opio4al e nvs ()sDtmxrono4oeeo f3tas s2eanvp (0 etomrctydlm rln ols)sexm(m3oo4olt mnvtasfs2tr(  ot4openmociydfs umnvonu0treoir oadlmtelnes;s)s2urxr3no1olte ict t  rrau 
\ No newline at end of file
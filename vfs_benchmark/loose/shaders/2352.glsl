@@ -0,0 +1 @@
+nvi;s0s2umirpno1ole  nvs s  Draump;o1aetnmiciysls ulnms;u) ltnxf3ta1op eli i s)setmir3no1aleelfvtat  Drrxmo;u0alx mi3tys sDua(vonu4tltrxf3tytfmDeaieslt)trto(r3iy4oleemfcta()srtmxr oo0oleomicilsfsDemump;(4teenxf3oatop ran il()s2uo(o nodoptemfcsa( a2rmx p;t4tpx ioeias a2emn o;()tetnmf3oa1fm eanvils  rtmxo3nu1lp n feils arrrum nu4oeeoii3iat aDemnvsnt0trxnxocty1fmt anvo;s0t2uoimpny4ap elncsa(faDumur ;t0tptn o3ils s umnmp;t)trtrir oytfaD  u s s srxrio oy4omtnlfei sfarum(mp;t4oex  fcildfm uanvo (4alermo oatopDr uvsls0seuoimpno1openmfeil()srrmumont1olx  f3ildlm2ra(vo t) renxo oa1lat  uei (0 rxmxo io4op  lnvsls)srtr( onu1oex mo3iatfmDua(msnt4aleomf ootoaDe u o;s) eurir3nodlm emicsas) 2rmxr ;t4opxnii3ilsfs2elnmo ()aleoifciodlat aivols)tetmiopiodaptemnvta(fa2uax  ou0oetoifctldfmDranmo u0tlenio3oadlm e u o;t0srtr(r iu1ape mfci t)s2taxmpot4teto iciydfa rln s;u4 leoio iydfm rlues (0 rurir iydom  miei ( aDrr(m no1tee ii3tysla2ul(vp u)aetomfciytfat ln o s) etrir3io1al  mncs t a2raurpnu4opt  iciltla rlnmp;(4tetrmr oa1op rlu s;s t2ur(o3iy1ap  mneias a2tru  nu1tltomi3iytlsDulnmo () lerio iy1lmDraneo;()trxmir3oo4ll  mfvtls arumu  nu0aeen fctysfs2elnms;t4trenxr3iytlpte u i ( t2tm(opno1lm nmfcsl() 2taxrp;u0alxo octltfaDem(mpn(4tlxrir3totfmtrauei (0setrxr iy4ole  iesl()a2uaxrp;t1tex mictldlsDuluvs;t)artoxfciydopDeai s;(0t2umiopno1lp  mfciasfs2rm(  ;o1tlxnif3iadfaDrmnvs (0 rxnmf3iadfate ivol(  2trxo oy1lleelnvi t) 2tmu pnu0oex iicilt a2emnvo (4texrio oatoa elueo;(0trtm(r3iy4ol emfviat)arur(mpot0oleo f3tadfmDrmuvo (4 eeoio oatomt  nei s0s2xo(r3iu4llenlfeil(f Dra(mo;o4altnmoeiysla2rlnvs t4tltnmf totlm  au o;( srxmxmpny1lm   ieia(fartaxmo;u0tle ioetasla umnvs t0 reoif iodlm elu o;t t2tm(r3ou4llenmieta( s2ta(mpoo1olx ifeildfm uluvo;u4trxnir to1lpt  i i t0srxm(m3nodoptelicsa(farumxm oo0tleo feiadfaDemnmo;(0 leomrcty1la elies;t0s2xoxo nu1apeemncsls)srumxm ;o4tex miciys aDrln o u4 ltrmr3ty1faDrauvslt srxmxopio1lmtnmncsat)sDtmumpou4tpe  i3ilslm ulums;t) lenxf iatlpDeli ilt0sexr(o iudomeemnctl( srumxmpoo1tpenifcild aDranvo;(4alxrxr oodlat  ieo;()srtr(o iu4olee ieslsfsDumur ;t4alxn i3ilt s elumo;(0tlermf3tytfpt  uvol() eur(mpiu1om nmfvils srurx p;o0aexniiciytfa2umn sn(0 exnxr oatlaD lu o s  2xo(r3oy1lp nlfcia( aDur( o;o4tleo o3ilt sDumnmont4aexoir3iadoaDr i o s sexmio3nydoltnmfcsa()srur(mpnu0aexn fetyt m2um(ms t0 eenmr ta1om   i sl( trtm(m iy1amt lncta( arur(mpnt4tpe  ieiydfaDemu p t0aeerxf3iatomDrliei;t teuoir oudam emnetas artmx pou0olx mietas mDel( o;t0arerxfctydfm rlueo;s0sexoirpio1om  mietls) Dumxm ou1apxomfeiasfs umu s;t0 eerifctytfpDelnvsls  rurxr oo4op   fes sfs2ua(rp;o0opt ifciysfa2emnvpnt0tetrmo io1oat  u o;s0setoxm nodlmeelfeiatfsrrrurpoo1tet io3tatfs2rl(mo;t)trtnxr tatfm e nvs s) 2xo(m oo4ap   nctat) 2raum ot4tpeo f3ildlsDum( p;t)aleoio tatoa eanvo t0setmir3nu4omt mfci s)aDtaum ;o0aex  ociasls2umuvs t0 rtoxo tydlp raies;() 2umxo3nydll   nesa(fa2um(m no4opt moeils s umuvo;t4treoio to1fa eaueolt srxmxo3iu1lmeelfeiltfa2um(m no4tlt  iciadfa2umums u0arenmo todomDelnvs;(  etrim iudlmenlivs (faDrau pot0ape mfeiyd m2rau s () eerxf iatfpDraiei;()srto(mpio1lmtn ncs t) rrr(ronu0tlxnii3iatlmDeluvon(0tlxnmf3ty1fmDr ivilt)t2trim iodape mncsa() rumu ont0aeenmiciydfsDemnmont4aexrifctadlmDrln il(  etmxo iodape livtat)a2raxm ;o1tpxnifciys mDrlnmonu0tleoxo to1oa  auvi s srxoxopiudapt  nct (fa2rmxr no0alen iciltfs eauvo ()aexoxo3oadlpDelivolt0 exrxopou1op elivtas)sruru  ;t4alx if3ildfsDemumpnu4texrxfcta1lmt lnvilt0setmxm oy4om   nvi tfaDuaxr no1alxo ictyslaDrl(msnt0arxoif3tatlatr uesl() exmim oy1ale lnvsas)a2taumo;u1tpx mfctytfmDrluvpn(0trenxocoa1fm  lnvs;t trumxo iodopeelicilsf 2urx  nt1tex  fetyt s2rluvs (4 lxnmo oytop e ivs;s)trurir3iy1opt  fvil(  ruax o;u1oet ifetasfmDelnvo;t0 ltrmo to1op e nei s) exrxr nu1lm n fvsltfs2uaxrooo0opt iietysls emnvp;t0arerxf iydomtraivo ()teurir oo4ap e fesat)srumu  ;t4apx  f3tat a2el(ms;u0areoio3oydlmtelneols) 2tmir3nu1omtnmneta()s2rm(r ;o4opt ifetlsla2eaumsn(0 ltnxf3oydfmDeanvi;t)tetr(o iodopeelics t srtaxmonu4alt  i3ils s2uauvon(4artnio3tadfpD ai ol() rxmirpoo1omtelnes () rtrx  nu1optniociyd mDul( p;t0altoxr3iydfm  aies;t0 exrxr3iudolen iciasf Dumu ono4tetn o3tldfm rmn o;(0altoxf totlm rlnvils)s2xr(r oo1al elicsat  rraurpoo4aexomf3iysfs2eau ont0trxnxo iatopDelneil( setoxr3ny1ol   neslt s2umu o;u4tlxn octlt s ulu onu4tltnif3ootfate u ils  2tr(r3ny4oleemfesltfsDrr( o;t1oltomfetytlm umnmp t)texnio3ootfate u slt)srum(mpio4altnmnviat aruau pnt4apx  f3iytfmDeanmsn(4arenxo oytoatr i i t sexo(mpoo1al n icsat sDtm(m nu0tlxo i3iasla2raumsnt) leomr3io1om r i o;(0 eurxr oy4llt  fvt ()s2ua(m ot0oeeomieiat sDrauvpn(0arenmo3iatlm r n o;t trtr(mpiudomt mnvtatf Dtm(rpnt0oex moctyd a2ua( s u4 ltoir ia1fat livol() euo(o oudomtnlncsat)srrmump;u1tptomo3iatlm eaums u0tlxomrcoadlate nvs t t2toim io1alen nvt t)aDrmumpot4opt ifciasfs2rl(mo;(4 eenxf3ta1fpt an olt) rtrxm3io1ope licslt)arua( p;u4tltomf3iasfa eanmp;u4teenmrcty1fa rau i;s) 2xm(m3io4lltnmfvslt)sDrr(  ;t1tpe mieiadfa ean o;t) etnmf3io1om r nvol()sexmxmpno1al n ivias)aDrm( ooo0tlxnmi3tadlmDuaump t0trxnxrciodfmDe ivi s)s2um(r ny1amt micsl(fsDurumooo4oeenmi3iysfm uanmo ()alxomf3oa1lat  uvsl() exrxrpnu4ll emivilsfsDtrxr nt1oexomoctydla ra(vp;(4aexomoctytlmD  u il(0teuo(r3nu4ome mies tf Durur nu0aeeo ictas a2emuvs t)tltoio3oatop e u o s0t2trxr ny1al n nei sfsDur( onu4opt ioeiyd a ea(vs t)tetrifcootlmt ln sl()seur(r3nudap nlfvtlt)artmxmoou1aexnmieilslm2ul( o;t4teeomfcoo1fmt  u s (  exoxm3iy1lm e iviltfsDtr(moou4olto fciatfaDel( onu0 rxoxf totoa eln ols0trumxr oy4llt livt (fs2ur(r nu4ole mf3ilslsDuanms;t4 etomr3todfmtr neils)t2trxm3iu1apenlnvtat  2taurpot0altn iciytls eanmo;()teeoifctatom  livi s t2tr(mpoodlmenmietls  rtmxmpot0tltn ictasla2uanvs;()aexomo3oo1lp  auvil(  2umxmpiodlmt mfcs tf 2trum ot0tpx ioetadls rmump u4aexnxf3oo1omDrauei;s) 2uriopou4apt  nes t sDurx ont0oeeomoctytla elnmsnt0texnxf iy1opDrluvils t2urxr iu1ll  mietatf ruaum ;t1oeeo f3tltfsDranmp;u4teenmocoa1fat  uvsls0 2tmxr iudlle lnei sf 2urxr nt4opeo oeiatfm rmu o (4 eeoxfcoadfm   u sls) exrxrpoodlmt lfvs tf 2rau o;u0ale iiciad aDrl(mp;t) rtrxf3tatfptr nvs;s seurir3iydlm n icils a2umump;o4aetoif3iasfsDrm(vo t)tltoir3ta1oat aivs ()texmio3oudopenlict sf Duau ooo4alx iiciasla2uaumon() lermo3todopte ivsl() rtrirpiu4am  livsa(  Dtrump;t0tex iieiltla ulumo u4aexnxocoo1fm rlueo;() eurxrpnudlmenlnvt s sDtmx pno4oleo oeiasfs ranvp t4texnxo3oatfmDe ies;() euoxopnodope mfcta()aDta(rono0ope mociadls2em( o;(0tlerxrcoa1fpDe ivi s)s2toxo3oodlptnmfet s)sDumu pno0oet  feiytlmDemn o;t0arxrxfcoadoa  liei s  rum(opiu1altelfesls s2rmuroou4tptn ociydfaDraumpnt0 eeoiocoytfpDeluvo s t2xoxopio1lm emnetlt)aDtmxr oo0apeo f3iydfmDemuvont0arxnif3iatlp eai s;s  rto(r oodlme mnci t aDtrx o;u1altoioetas mDemn o;u4tlxnif oodfateli o;t) etoirpoo4ll  lfcsl( artm(m ou1teenif3tlslsDrm( o t4arxrxocoy1omt lueo s0trxrxo3ou4apen icil(fartrxmont0altnmo3tatfmDemu s t4 rxomf tydfm  lneo s)t2uoxr no1llenmneia(  rrmum ou0oltnmoeils a2emn snu0 exnxo tadlatranvo t  rtrio3iy1ame  neslt srum(ro;u1opt io3ias a uanvo (4altoxf3tytoa eaues;t0t2to(rpiy4am e netltf ruaurpot0tee  f3iaslmDuanvs t)tlerxo iy1la   uvi;(  2uoimpnu1al  lfcsasfs2um( p;u1aexn ociltfm2rl( o;(4tetoxr oadlmDr ueo;t)setm(rpio4ol  mncsls)a2trxront0texoif3iadfm ul( pn(4aexoif ta1om eau i;t0 eur(opiudlpen ncta( sDumxr ou4opt moeildla rlu p;t0artnxf3ia1lm e ueilt0sruoimpoo1ame  nctas)aDta(m ;u0olxoiociltfa umnvsn(0tlxoxrctytoat auvi s trtmiopnudlmtelnvslt  rraxrpot1tlx mi3iyd m raump u)texoxf3oadlm rli o;() rtmxo3iu1ale lnci ( aDur(r ;t4tle  i3iaslaDelnmo t) rxnircto1lpteluei;(0t2ur(o3nudlptn ies tf Durur oo0apeo fciatfm2raumo u)aetomr iy1fmD  nvs;t s2tr(mpoo4amtn ncta(f 2ta(mpoo4texnif3iaslm2uanmonu)altnxf tytoa  au slt teto(r3ou1apeemicslt)srtrx pou1opx iocildlaDuluvp;() ltrmocta1fpD ai i;s  2xmio oy4op elfctls)s2ur(r no4apx mociaslmDeanms;t0trtrxocoa1fp raueo;(  etmimpoudameelfeiltfaDraum nu4tlx  icils m2ua(vonu4aleriociotfmtelu ils0 2xmio oudamt mfcs t) rur(m ;o0aeto o3iysfmDumumon()alenxr3oydlm  ln ils0 2urxm oy4lpt lietas sDrr(mp;t1tee  i3ildfs eauvs;(4 rtnxrciadom eli ols truo(r nu1lpen ieta()aDtaxmpno1alen ictyd m em( snt0arxnmfcoa1fatelnes s0t2trim3oy1ameeliet s)srta(ront1olxo fetydfs ulumsn(0tlenmr3oytopDe n o ( teumir3nu1llee fes ( aDrrumpou0olxnio3tld aDeanvs;t)aexoio iadfp e ivil(0srur(o3nu1oleemfvsat)aDum(r nt0olxoii
\ No newline at end of file
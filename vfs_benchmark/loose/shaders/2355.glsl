@@ -0,0 +1 @@
+nvo s)trtmxrpou1lp elieils sDtmump;u1texoiiciysls2ua(vo (4tetomfcty1lptean o;s0seurxr3iy4lpt lics t sDtmumpot4opeoioeiatfm ua(vp (4 etrmf3totopDr i o s  exrxo oo4omt  nvtlt) 2tmu poo1tlxo f3tatfaDeanvo u0 leomrctytfpt aues (  euo(m no1aptemfvsltfsrurum no1tpto ictyd aDrlnvs t0aexnif tydfmtrai sls) 2uoxopiudlm nlnci (fsrtr(ro;o4tlx moeilsfm rm( p u0teenmf3ia1opt aieol(  eumirpoudalenlfvias)srra(mo;o0opx  octyslm em(mpn(4altrxf oy1fp eanes t0texoxopio1ope mfvsl(farrmxr ;o0alxniietydla el(vs t)treoiocoytlaDeanvo;t)trxrxopoudomee netat a2umxm ot0alxnmfciadfm elnvs;t4trtnmr3ootlp rau i;s  2xoxm iodll nmivtlt artau pou1apxniietys a rmu s t4tlxrxr oodfm ean ol(0srtoxo3oydape mnciatfarra(mpou1tpxoif3iydfm rlnmp;(0aetoxr3iydlaDr ies s srtoimpoodope  ivt sfsDua(rpno0oex mociad a2rmn s;t)aetnxfcoydfaD anvi t0trxr(opnu1ameelfvt t)sDururpou1ole mi3iaslaDuluvpn(0tltoifcoydfa e ies s)setmxo3nudapeelietlt aDrm(rpnu1tpxomoetydfaDea(mo;u) ltomr iadfm   ieo;t) eum(o3oo1op  mncsatf 2rrxront0alenifciytfsDrluvp () rerxf tatfp  aiei ( s2trxm oudop  mncs s s2tm( p;o4oleomfeiydfa ua( o u)aeenir3iadoa  livs t  exo(mpiy4optnlnvs t)arrrxr oo4teeo feiasls2eaump t)artrxo todfpD ai ol(0srur(m3iu1aleelfviasf Drrumoou1tet ii3tyt m rmuvp t4treniociotlmte uvo s0texmxrpny4oltemfeilt) Dtrxmonu1tpx moeildlmDel(vs t4 rxrmoctodlpDe ieo (0srurir3iu4aleelivils)srta( pnu1aetoii3tadlsDrau p;u0 renxfcoadlm e ivs;t) rtrim ny4al emfvta(  Dum(r ;o4ole moetlt a ea(mont4 etrmf3iadopD  n i;(0 rur(rpoydomt liei sf rtmx oou4tlx mf3tlsla2umumo;t0alxomr iotopD au olt0trxoim3oo4aleelfvilt) 2uaxmpou1oetn iciyd a ea(vont4 leoxrcoy1faDe i o s) exmim3iu1omenlics ()srtrxrpou0tlenmicilsfs2umump u0aetomo iodopD lu o t0 exmxo3oo1omt mncslsfa2ua(rp;u0opto feiytfs2rl( p;()teerxf tatlpt aieslt t2tmir oudame miesasfs2taum no4aptn fciadlm2elnvp u0arxrmocoatlat anvo s0tetm(mpoydllt lnei tf 2trur ;o0alt  oeils aDrl( pnu4artrmf3iotfmteauvs s0seumxrpiodom elncsl()sDrax pno0tex  f3tad a rl(vont)trtoifcio1omDrlu i;()s2toxo3oydolen neias arurx p;t4oexoifeiltls2eaumonu4alxnir oatfpt li o;t)tetoxr oy1olenlieilt s2trumpno4tex  ieilsfmDrln o (4teeoxrcoatomD anvi;t srtmxmpno4oltnlfesls aDtaxmpou0alxnif3ilslaDuauvsnt)tlxomo3totlmDe ivi;( srurxopoo1op  mfci tfa2tmur ou0aeeo o3tydlm2umu p t0 ltoxfctodom rlnes;(0truoimpio4ope  nviat) Dtmxm oo4apx ii3taslsDrlnvo t)tetrxfciy1oaDraneslt0s2xm(r iu1olen nctl()srtrxm ou0texomf3tas sDul(ms (0 exnmo io1omDr i ilt0 rtrxo ny1olte nct t)srraxmooo4aeeomociytlaDemn p ()tlerir3iodoatrai i;t trurxo3ny4oleemfetltf 2ra(r nu1alx moeiytfm2elnms u0altomr tydfaD lu i t t2toirpiudape lnvias arraxro;o0tee ioetaslmDran pnu0teenxr oadla  livs;s) rxmxm oy1ll n ncs tfs2rm(r no0teeoifciytla2ra(mo;(0 etoiociadfpt  u o s0 rum(opnudalt mivsa( arrrurp;t4tlx  oeildla2eanvs u0tlxrir3tatlpD  u o t0teuoiopoy4op   fcil()sDrmump;u4ale mi3tyd a2em( on(4 rxnif totomtr u o;s srumimpiy1apt  fes t)s2rmx  ou0ape mieiad aDua( s u4 ltnmf3totoateluvi s0t2tm(r iy4lle livi t)s2tau p;o1aet mfeiasfaDuanvont4aexoir3tydlm e u o;(  rtr(o nu4op nmnci t)arrmx p;u4alt mi3iaslmDran o (4teeomfciadomtraneilt)tetr(m3oo4lptn ivslt)aDumumo;t0tptniiciasfmDeluvs;(4 ltoxr3tadlp r u i;(0 rxr(o3iy1olt  fei s)a2rmxrooo4tlxnmocilsfa ea( on()aleomocta1lptr ivolt0sexo(opou4llenlncsltfartru oot0teenmi3tys m uau o t0arxoiociadopDelues ( t2trirpny4omt mietas srta( pou1texniieiadls ranmp;t4 renxo3ootop raues t0srumir3iu4lm emies (fs2tm( o;t1tleoiocild aDrau s;u)trxnirctatla rlieo s)trtr(rpoudamtelfcs sf 2rrx oot1apx mfciatfsDranmp u0 rerxfctadfp eli o;(0 rtr(r3oy4al e ict ()a2rmurpot1aptomf3tad mDum( snu0aeermr io1fm rlueo;() 2xm(o3io1alt lfctat) Drrump;o4oexnifciadfmDua( snu) etrifctytlmDr iei (  eumxmpiodllt lncilsfsrrmxmo;u4aptniieiyd mDrl(mp (4alerif io1fa  au s ()seuriopoo4amtn fcsa()a2raum oo0teeoifciat a uanvont4arxomfcoadfaDeaneo;t)srurxm3nudapeemnctat  rtmumpoo1opx ioeiadla um(vs;(4 rtomo3ty1la eluei;s  2umim nu4ap   fvt s)aDraxrpoo1apx  o3tls a ra( o t4artnxf todoat lnei s)srxoxo3nodlmte netas artmumono4ape  o3iyd aDemu o ()alxrxo3ty1lmDrai ils0 etm(r no4omee ieslt)aDtr(mooo0tet io3ild s2emuvs;u)areoxo3to1omt aivilt texo(o ou4lle  icilt sDrr(r nu4aex ifeiys mDuanmp;t0tetnxr ty1oatrlivsls)trumxr nudoptnmiesas)aDurx  oo1opto fctatfsDemu pnu4 rxnxr3oatomDrluvs;s) 2xo(rpnu1am  lncils  ruru  no4apx  o3iydls2umuvp;(4aexrmr3oadlmt aiei () 2ur(mpoudlmtnmnetlt)s2uaumpno0aet ioeiatfs2ran s t) lerxf3io1lmtelu s s seuoxr io4ll e fcias arurxmo;o1tpeomfeiysfmDum(ms (0alxoxf3oy1fptr nvo t t2ur(r3oudalt mnvtl() Drm( o;u0alxnmicildfa ulumo;u)aetrmocto1fa   nvi;t0seuriopoy1lp n fvt ( s2umx p;u0tle io3tlsfm2rl(mo (0tltnmfctotfmD  ieols0t2xr(r3oy1op nmfvtat)srtax ont1tpxomieiydfa2ea(mp;t4alxrmociytopt luvs;(0 2uoxo3iudam  lncs sfa2rmx pou4tpxoio3iltla rln s;t4areoxf3oytlatr uvs;t  ruoxm3oo4lmtn nci sfartaxr ;t1ope mfeild m um(vs;(0aexomr oo1fmt aueilt) eurir no4omenlnesas)sDraxront0tpt  fctls a el( o (4tetnifciy1lpD luvs ( s2uoxr ou4lmtnmfci sfa2umu ont0oexoioetltls2ulnmp (0areoxfcty1omD lnvslt srxm(rpou1om n fvi ( artrxm ;o4texoiociyd a2ul( on(4 eermf3oadoaDr ieol()tetrxr3io1lmt micta( srtru oot0apxomf3iytfa2umuvs (0aetrmrctatopte ivo ( tetmxopiu4alen nvi sf 2rm(m nt4oexo i3iadlm2elumpnt0texrmfcoodfa elu i t  2uo(o nudape  fvs t)sDrmum ;o0tee  ociydfa uaump;()arxomf3iy1fmD  i o;(0 rtm(r oy4omt lici sf Dtr(  ;o0aex  ietldfsDumnmo;(4trermocio1om r ieilt t2xr(opiydam n ivil(fsDtaur ;u0alxnmictasfs rmn s;t0aexoif ta1oat li i t)tetr(mpnydamenlfvtat)s2urumo;t0aeto ociltfa2eanmo;u) rxrir3ty1faD liei s teur(opiodlmee ict t)aDraum ou1tptnmietatls rluvsnu0 exnir3iatfp  lneo;(  2tm(r3oydlmeemics t a2rr(rp;t0teen oetyt a ea(mo;u4aetoifcoy1fpt  ieo;(0 2uoir3ny4om emfetasfsrrrx  oo0aet mi3tyt aDemnvs (0 exnmr3oy1opteaiesl
\ No newline at end of file
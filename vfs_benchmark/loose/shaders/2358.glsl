@@ -0,0 +1 @@
+nvo;()s2tmirpou1lmenlnctl( sDumx oot4aetn o3tytfm2rau pn(0 lerxrcoydop elnvol(0srxmio3oo1op elnvi tfsDua(r ;t1olx  fciyd mDrluvs;t4aexrmr3oy1op  anes;s) etmir oo1ol n fetat) Duaxm nu0tleomieils a umn p;(0 lxnir iodlmt aivo s)setmirpiy4amtelnvsa(fa2taxmo;u0oleo o3tldlaDrlnvs;() lxnxo3ta1fptr nei (0s2triopiu4lpte fviat) rraxrpno4aptoii3iat mDumnmont0trxnif3oo1lat aneils teur(mpny1llenmfcta( sDraumo;u4tpen oetydlmDranms t4altomo oytlatrai o;s  exoxo3ny4amtnmfet t)sruau oou1olxnifeiatfa2ea(vp t4aeenxf3iytopte nvo;t0s2umiopiu4opee nesasf 2tmxrpoo4alt  ieiytfsDemu s;u0aexrmocoydfp   u sls  eur(r3ou1am emfetatfa2rmxr ou1tex iictat sDemn pn() eeoxf3iy1lpte n i t) etm(opoydal e fcils)a2rr( pnt4apeo octls s2eauvpn(0 ltoxfciadlmt  ieo () exmir3ny1lltnmnciasfartaumono1tpeoii3iyd m2el(msnt0 lxoxf oadfm eai i;t  rxm(r oydomtnlivtasfa2ururooo4optomf3ilsla2rluvp t0 exrmf oadlaD ln o;t)trxr(opiu4ome  fcilt sDrmur oo4oexnmieiysfa emn o u0alxnmr3ia1lptelueslt) 2xrxopny4om n nciat) 2ur(r ;u0alt ifciltfs2emumo;u) ltrir3iydoate ivi t)srtoir ou4opt  fvtl() 2umx  ou0tleo i3iysls ranms (0 lxomrcoadoa e ieo;t) etrio iydap   ivs sfarum(m oo1optnif3tls aDelnvpn(4aeeoxo3oytoa r uvi;s0srtrxrpoudlpe liesas artaxm no4ale mi3ilsla2ua(mp u4alxoircta1fpD  n o (0trurxmpoo1al n iciat aDtaxrpoo4opeo o3iltfa elump ()tlxoir iatoaD anvo;( trtrxo3io1amtemnvia()arra( o;o1optomoetatlaDrm(vs () ltoxfctytfmt livols) rur(r3oudll  mfcsatfaDra(roou4alxoiociad a ea(ms;t4tltnxf iodfm rlueol(0 etoxrpiu1amt livsl( sDuax  nt0tetnii3ild s2rmn p u)aeerxo3oodomDe ieo ( sexm(r no4ome  fcsltfaDrrx oot1oetomi3iydls2uln snt0 renxf3tytoaDeai o t  eumxo oy1lptnmnvsasfa2tmumoou1oee mo3tytls ra(vo t4texnif3iadlptrluvi s0s2tmirpoy1llt  nvt t a2tr(ro;t4olt if3ias aDumumont0 lenif3tydoa ran i () rtrim iudal   ivta() Dtrx  oo1aex iictlt mDem( s u0areoxfciy1fm  livs s)trtmxo3oydap nmfct ()aDrmurpou4tltomiciatfa2emnvp (4tetomoctodlptran s (0truoxr3ny4al nmnvta(fa2tm( oou1opto oetat a rl(msnt4 lxoio tydfm rlnvs t seuoxr nydoleelnes s aDrrx ooo4opxniiciys aDran s;u)tlxnir todfm elivol(0 2trim oo4ome  iet sfartaxrpoo4aexniociydfsDemu p () rxrxf3oa1lpDrlieols  ruoxr oodamee fei s)a2tm(  nu4olx if3iadfa uanvp u0tetnmr3iadlpt livs;(0s2xoim3iu1lmt  ici tfarurum nu4tpxn i3ilt a umn o;u)tetoxocoydop e ueils srumxm3oydape miviat a2trxm oo0apeomicias aDul( p;t0aexoio to1lpDrlivo;()srxmxo3ny4ome  nvsls s2ra( ont4opx  ietls a2ul(mpnu4aleniociotfaDe neo;( t2trxo oo4optemivsat aDur(rp;u1apeniieild m2uln s;(0alxrmr ta1lpD auvi;t0srxoxopiodopee fcilt  2ua( o;u1tlx iiciadfs ea( p u4trxrmr iotfmt aivo t0t2umim3iu1ll n nciat  rumxro;o4opx  feiyd sDul(vs u) rerxocoatlpDraivol() rxoxr ny4omtemietl() Duau oot1oee ifctys s2rlu s;(4trxoio to1fa r ies s setmimpiy1omtnmics sf Drrxmpnt1tpt  fetls a2emnvpnt4 rxoir ia1la  luvi () ruoio3iu4amtelncslt)arua(moou4oltoifciydfsDuanvo (0teerxociydfaDelnei;(0teuoiopny4lm   neilsfaDtr(mpno4apxoiietlsfs elu p (4aeerir oo1fm r uvo t) 2ur(rpiy4optnlfci s)a2rmxmoot0aptnioeilsfa2emn s;t0trtrmo iadfm e nvo;t0trum(o oy4aptnmfviasfaDuaxr nu1tpx mo3iadfa emnmp;()trerxo iytlmteauvo (0t2um(mpoo1ol  lnesat  rur(mp;t0tetnifeiadla el(mp () ltnifcia1oa   u i;t0s2um(o3no1open ieia(f 2umx pno1oeeo ocils aDra(mpnt0tlxrxf oodlp ranvs (0 rxmxm ny4oltnlics s  2urx onu1olx  ociytfa2rm( o (4 eenmo oy1fmt lueil() etrio3iu1om  lici s s2urx  ;o1tltnmietad m2el(vs u4texrxf ia1fmD  ues;s0trxmxr nodomtemneils  2rmumpnt4oet moeiyslmDemuvs;(0arenxo iotopD  ieilt0s2tm(rpoo4ll elicta()s2uaxrooo0tle mfeilsfmDemu on(0 eeomf3oodomDeln o s)t2umim no4alee fvs s)srtaxrono1alxomfetld a ulu pn(0tltnmf3to1laD  ivi;t trumimpnydap   nvs (fsrrmu ono0tltnmi3tasfm2emnmonu0 exoir ta1oaDeauvslt0 euoim3oy4oltnmnvi tfs2tmuro;u1tpx  iciatla2rmumo u4tltoxo3tadopt  uvs (0texrimpnudolt  fvtlsfa2rau  oo1oltoifetys a eau p;u4trtnxo3tadlpteanei s0trtrxm3no1lmte nvtl()aDuax  ou0oleomo3iasfm rl( onu4 rxoircoy1op elnvi;t) eumxmpno4ome mfeilt sDtmurpot0oex mocild sDrmn pnt)trxnif3tadomt luvils) etm(mpiodlp emfvt (fs2tr(mpot1opx  ieiat mDelumsnt4texnmr iadlatran sl() etr(o3iy4op   fctl(  2tax pou4tpe mociasfm um(vo;t0aetrmociadla  anvi;s)trumxm iu4lmt  nvilt)s2rrumpot0tpeniieiysfsDrlump;t0arenmo3tydoateaueols  2xo(mpoo1lmen neslt artau pnu0aee if3tlslm2rauvo ()altnmf oytfm raues;( truoio3nudop elics t a2rau  oo4oetoio3tltlm emn s u4altoifcoytlpDe n s;s  eurxr3no1altemfcsls) Dtaxmo;o1aptnmi3iasfa um(von() lxrir oodfaD  u o s0seuo(opiydome lics s) 2tmu pnu4oeenifeilsfm ea(mo t)aexrxr3oy1fmtrluvi (0srtm(opiydll nmivsasfs2rm(mono0ale moctld m uluvo;(0tlermociadlpDr nvo t tetrirpoy1lp elnviltfsDtmx oot0tleomf3tytfm ul(ms;u) rermo3iy1oa eanvi;t  eurxr nudal nmics ()s2urur ;u0tpt mf3ilt a emn ont) lerir3oatlp  aueo s) exoimpno1lp nmictatf
\ No newline at end of file
@@ -0,0 +1 @@
+ivo t) rxr(r3oo4lpt  ncsltfsrrrumpou0tpxoif3iltfm ulumo t0tleoxf3oodfmt ai olt)t2xrir3oy1al nmictlt aDumxmp;u1opeomfetlt m uln s (4aetoiocio1fa elies ( truoir3oodlpen ies () rrauront4aexn f3tat aDel( onu) rtomf to1om  auvslt0t2to(o iudaltnmictlt  2taum ;t0tex mo3tasla2rm(ms () reomo3tydlptrluei ( setrxo iu1am n fei s aDrrx o;t0optomieiydls eauvp u4teerxf oytlpDraivo;(0t2urim iodoptn netasfa2tm(roou0aeenifcilsls rluvpn(0 lxoxo oy1fa  lueo s0trxrim ny4lp elfctls  Dtrumo;t0tlxo feiytfa ra(vs u4trtrmf3oy1fa r ivo s)s2xmxrpoy1om nmfvsltfs2urx  oo0olx  o3ils m2rl( s;t0alenmr tatop  aivs s)srurxm3nu4ol  mnct t sDrmx  ;u1tltn f3tas aDel(mo;t4 eeomociatomtr uei s)tetrir3oodlm   nes ( sDrm( pot4tpxnmf3iltlmDrmuvs;()trtomfciy1lm e i sl(0 rurxo iu1om  mfvi ( srrrx poo0tpe mietysfmDrmu p t4 etoif3tydoptraiei () 2xo(m3iodolt  fviat sDur(rooo1alto ietas aDel(mon()tleomr3tydfmte nvi t0t2xo(r oy1omtelfvsat sDum( ont4tpe mieiatfa ea(vp (0teeomr iadoa eai s;t0 2trxrpnudoltnmicsa( s2ta(rpnu4oleomiciydfm2uaump (0 rtnmo io1latrau o ()sruoim3oydlpe micsat)sDrmxmpou0tltnmoetatls2umu s (4 etrxf3oydfa rlnvo;(  rumir3nydlptemfeta(f rrau o;t4altomfciatlaDuluvsnt)treriociydfaD lies ()s2trir no1op emnes (f 2raur nu4aetn fctltla2ua(mp;t)aeeoirciotlmD aueo;t t2trirpoydolenmfviatf Duaxm ;o0ope  ieiyt m rauvs;u4aexrio3iy1omt  ies;s) etriopou4am  mnctls a2rmx  ;o4opeo o3ilsls2ul(vpnu4aleoxfctatfat  u s t)setr(o3io1al  lfci (  rrm(ro;o4aptnioetld a2uluvo ()tlxrmrcootoa  ln o s0 rum(o ny4om n netl()aDtrur ;u4apxnioctas mDrmnvp;t4 eerxr totlaDr u sl(0 2xo(o3oodlptnmnesas)aDuru o;u1tpenmo3iasfs rl(vpn(4aeenmrcoytomDrlivs s t2uoxr oudapte ncs t a2taurono0tpxn ociltlm um(vpnt) exnxo ty1omtelu sls) eurimpoodlptn ici s arra(rp;t4teto ieiysfa ra(vp;() lxoxocoydlat anesls  ruoxo iu4alen fci sfaDua(monu0tptoiocilt a elnmo;t4arerif oatfaDr u il(  rxm(m3io4om  lnvil()s2tr(mpou0aptoiociyd mDeln s t)texnif3iodfpDelneslt  ruoxr3ny1lleelnci (faDuru p;u4oltoifetatla ul( pnt0alxomr oydomD li il( tetrxopio4op n nvs t  rur(  no0olxnifcildfm2umu p;t) eeoif oytfmD aiei s)texrir nu4am   nvtltfarrax pnu0apenii3iysfmDul(mon(4tlxnxocio1lpt ln ils) rurir3iu4amtnlfeta() Duau poo1opx mo3tld sDuanvs ()alxnio todfpDr ieslt0tetmim3oydll   iet tfsDur( oot1teto ieiys m rm(ms u)tlermocoa1lp ranvol(0 eur(o ou4optemfetat  Dtaxmp;t1aex ifciasfmDelu o u)texomf3io1lmD auvs;s0s2tmir io4al   ivsat) Dum(mpnu4oleomiciasfa2elnmp;t) exoifciy1opteli s;s0teuo(mpoudlmte neilt  rrm( pnu0alenmfeiydfa2rl(vp;(0 lxnmo oa1lmDeluvs ( seur(m3ou4amenlfvs s aDrru p;u4aee ioeildls2rln s;u) eermr ty1op e neilt t2xrir nydlp n fci tfaDumumonu0alen f3iysfs2uau o t4tleoiociodfaDeau s (0sexmir iy4olte neias a2taumpnt4ape ifeiadfm rmuvs t) etrif3oadfaD  nes s0 rxoiopoo1lmee fvt (fsDrm(r oo4ope  ieiydfa umnvp;u)altrxo3ia1fmtr u o t)sexoimpnudopt mfesls  rtmum nu4texo o3ils s um(mpn() exrmf3oatlptrluvslt s2urir3oudlm nmfeil() Dumxro;t4aetomiciyt a2ea(mpnu)trermfciatoaD lieilt0 etm(m nu1aptelncsa( s2ra( ono0tlxnifeildfm elumsnu)texrio3tytfp eanesl( seur(r3iodlm   nctat srtaxmooo1altnmoctytlaDeau s (4 exomr3ty1oat lu s s)texm(m ny1op elfeslt  Dumxroot0aexn i3iad sDelnmp;()tlxoxr ootoptrauvil(0 rxmxopnydlle mfes (  Durumo;o0oee  f3tld mDrl(vp t0 rerxrcoydfaDranvo;t0 eum(r oy1ome lfcs ()arraxr nu1tptomfctydla2rmnmp;()trtoir ootoaD an o;s)srxmirpio4lle  net s) 2ua(r ;t4optoiiciyslmDelu s u0 eenif oatlmteluvsls s2toxr3oodlpeemnviat  2tr( onu4aeeo oetaslaDelu s;()tlenif iodopDrai ols)srurirpiydal nlietls  2rrx  oo4aet mo3tld m rauvp;u4trtrxo3iotfptr nes t0teuoio3iu4aptemncia()aDtrur ot4oltnii3iad m2rm(von() lenifcoa1fp  luvo s) exr(r3oo4opeelictls a2tau  ou0optoii3tadlaDra( s (4arermo tatopt lies;s srxo(r3oodlltn nviltfsrrrx oot1apxn o3iltfs2rau p;t0altomfctadoaDelivi;s0 2ur(m3oydale licias) rrrx  ;o0tpeomictadlm rm(ms;() rtoxoctodfp eai s t trum(o nudoptn nesa(f rrmxm no0tpen oeildlm2rmnvs;u)arermr oy1om eanvs;s) rxoxm nodam n netas)srrrx ono4tleo i3iat sDra(mo u)tlxrxocoo1faDranvs;s0 etmxr no1ameelivslsfsrtru ooo1tle  o3iytlm2elnmo;u) eenioctodfpD  uei;t)trur(r oodlmee ivil()s2raxrp;o1tpt  fciltls2rln s u0aexoxr3iytfm   i ilt teuoxopiy1lmenlfvs s arrr(moou1tetoiieiys m rmnvont4 eerxo3tatlaDran i ( srtoim ou1omtelfctlt  rumuro;t0tltomf3tlslm rau p;(4 etoxo totlp ean sl(0trxoimpiudaleemnesl(f 2ra(  oo0alt  f3tad sDumums u)areoiocoadoatraivo;s trto(mpoudolenmfet tf Dtrum oo1tlt  feiatfsDrmuvs;()artrmr totopDr n s;t) rtriopny1aptemics t  Draurp;o1apxomf3tatfm eluvo;t)altnircoo1laDr n i (0 2xoxo3no4ol  lncs tfartaxro;u1apxomo3ias mDra( s u)artomo3ia1laDrai s t0 etoio nu1lle  ivia(f Drr( ont1oetoifetyd a rluvo;u0 rtomf3oy1lm  li i s)t2tmxr iy1om nmfcsat)aruaxrp;u0tee mfeiyslm el(mp;t0 rxomr3oa1laDe nes;s  eumxo3iu4ll nmfciat)arrauro;o0tltnmf3ilt m2uauvs;u0altnioctatopteln ol( trum(m nu1alt lncilt)aDrr(r ;u1alenmi3iyd mDrm(msnt4 lxnif iydfpDrln i;t  rxrimpnu1op e nvi ()s2urxmp;u0opeo o3tydfs2ra(vsn(0aetoxrcta1omDr iesl(  2toio3iudalen fetltfs2tax pot4aptoifcilslaDumuvp (0altoio to1omt  nes ( s2uoxo iudam emivsasfs2tmumoou1tlx ifeiltfs2um(vpnu4 reoxr iatop  luvils srtmirpiodaltnmnctls  Dtrxmono0alx iieilslaDemnvs () etnmociytoaDran i;t) exmxr3nydopenlfctlsf 2tax oou0apx  oetyt m2ulumo t) eenxr3iodfm eauesl()setoimpoo1ole mfetl() 2uax pno0tlxomoeiadfm eauvpnu)tltrxr3oadfmtr uvs ()trtm(o oo4am n nvsl(  rtrx ont4aleoii3iys mDrl( p;u0aexomf iy1fmteaueols0truoim oy1ol elncslt)srrmu ont1optnifeiyt a ulnmo t4arxoxo3ootomtr uesls)s2um(opnodop   ics t artmu o;u4olen ociad s2rl( o u0aeenmocoa1lpDeli o s t2um(r3iydalt lfvi t a2uau  ot1oltnmiciys sDea( o u0trenxf3oydla elieols0 2xrxo3nu1omt lnvi sfartaumoot0teen oetysfm2eln p;(0 rtomrcoadfm e ivo s)trto(mpny1lmtn neta(  rua(rp;u4tle  ociysls2rlumsn(0tetrmf3iy1la eauvsls)srxmio3iudll  lfvsl()srtmxr nu0altoiociyt m rm(vs u)alenmr3ootomDeaneo t)srxrxm oo4opte neia( a2raurpno1aee ifeiyt s umumonu4 exomf3ia1oa raivi;s0texmirpiu1alte ncil(  Dumx poo4tlto o3tls m emumo t) lxnxr3ootfpD li s;t0s2xo(m3nu1ll nlivs t)sDtmxrpot0tlx mfeias m2em(vs (0trenmf ty1la e uvi t tetm(o3iudoltnliei t)sDua( ooo4tpt ifctadlm2umnvp u4aexniociatfmD au s t0srxrxopiudol emnet t sDurxm ot4tptnmi3tlt s2um(mpnt) rtrifctatlmtrluvsl(0srxrxopiu4ameelfet t sruau pou4tltn o3ildfmDeauvsnu4 lxoxo3iadomtelivo s)teto(m ou4apenlnviat)sDtaumonu4tpen i3tadla um(vont)alxniociodopDelu ilt)seuoxr oudomtnmfet s aDra(m nu4ole  oetat sDulumsnu4alxnmfciytfm rln sl()t2toxr3iydameemfcsls)s2tmumpno0oexomfetlsfsDrau o;t0 eermoctytfateaueslt setrxm3nudamee iesltfaDumur ou0alxnioeiad a emn o;()arenmr3io1fm  auvs t t2xm(o ou4oleelicta() 2umuroot4tlenmfctytfa rauvs u0tlxnio iodfpD ln ols t2um(rpoudop e net t  2tmxm ou1apto oeiys m rm(ms;(4teenmoctydfpDr u o;t srumir3oy4ol emnctltfs2rax poo4oltomfctat a ulu o;u4tetriociytom  anvo;t sexrxo nu4omen fvta(f 2rax  nt1aex moetlsfmDeluvs (0alerxrcoy1la eanvs;s)sexr(r3iy4ol  lncsl()sDrmurpot0opxomoeiadfaDumums;u4 rxrxrctadfm ranvo t)s2xo(m nu4om   nvi ()aDtrxront1open iciyslmDem(vsnt0alxnio3ootfp eln s;t0 ruoxmpny4llen ivt t arumxrp;o1oee iicildlsDean onu) renmo to1omD  nvs;( trxoirpiy1lm nlfctl( s2tmur ;t0openmfciydlmDrauvpn()texoiocty1fpDrli ilt srtm(rpnudlmt liei s)arrr(monu1tetn f3iyt a2rlu p t0trtnxo iodlatelieils0teuoxrpoo1apeemnes ( sDtaumo;o0alt if3tasfs2em(mo;t4 etrmr3oodfp eaiesls0trtoio oy4llenmivilt) Dtru pnt1aeen i3tat a em(mp;(0 etrmo iodfa e ivo;(  eumxm3nydoltnlivt ()s2rr(  ;t0oee moctysfa2ua( s;(0trtnmo to1opD ai s;( teumxo3oy4amee fcil(f 2uaxmpou1altn fctatls2rlumsnu0tlxoxo3oadop rlivo ()trxmio ou4ll e fvs () 2rmur ;t1oleomo3iatfaDrl(vp;(0 etoxr todfateaieo ()trxmim3ou4op elnvta(fsDuaump;o4oee miciad s2ulump;t)aexnxr3io1oat luei t) 2tm(m3iy4omte fvils s2trumpno4oeenmfctyt m rmums u4trtnmf tytfmtrlnes;t)srtrxopoudaltelict (  Drrx oot4opx ifctysfs umn p (4alermoctotlm eluvo t0 etoio3oo4lp elneias)a2rrxmp;u0aptomo3tld m um( o;t0 lermrctodlaDrauesl(0 rxoir nydap  mfvtas) 2tm(r no4opxoiietysfs ranmp;u4 lxrxf3oatlaD luvi t srtr(mpio4aleemfeta( arraxro;o1tlxomf3iltfa raumo;() exoio oatfp eli s s)t2xoxo3oodal e neta()aDuaur ou0tptoio3tatfa umnmonu0 exomr3iy1fptelneilt)srxoir oo1ome micias  rumumpoo1opeoii3ilslm uanmpnu)tetrxo todla  lu s;( setmxo iy1llt  fciltfsDur(mono1tex mfcils s el( p u0 ltnxf tatop elies s) 2tmiopoydlmt lnctl( artru p;t0apx ifctyt a ulump t4tetoircty1lptrau o;t)sruoiopnu4ol elies sfa2tmx p;u1opeomf3iydfa ranmp u0tltnmf3ia1op rau ols sexm(opiodlm   feiltf 2trxr oo1oetoii3tad sDrluvp t0aeenmo3tatla   nvi;s0t2toio iu4ole  iei t) rrr( pnt4ape ii3iltfs2em( p u)artnmrctydfpte nes t)trtm(mpnydalt mfvsas)sDtr( pno0teto o3iys sDumnmonu4tetomr3tydomt  uvo;t teuo(rpnudaptelivs s)sDraur ot0open o3iadfs2rlu s;u4tlxnxr iotomD  ieilt) 2trxrpiydlp emfeilt)s2umum nu0ope mf3tls s2rlu pnu4 exoxrctotoa  anvo;s  etmio3iy4optemnesat) 2rmxmoou0tlxo ociyt s rauvo t4 rxrio3oy1lpDrau o;t0s2um(m3oodlmen nvtls)a2ta(mo;t1oexoiictysfmDuluvpn(0 lxoifctatlaD  i o;()srtmimpiydom  livtat)aDrrxm oo1oet  ociltfaDrmnvp u4 ltniocta1la elnvi;() 2xm(r3nodop elics sfartmxrpnu0ole  octls m eaums (4 rermf iy1faDrauvo;(0srxoxmpio4ole  netls aDra(m oo4tlen ietydlm um( onu) rtoxr3ty1lmD au o ( s2urir3oo1omeelnctl()a2rax  nu0aet iieildlsDumn pn(4aeenxfcty1faD li i ( srxo(r io4alte fet t arraxm ;u0altomfeiatfa rmu o;t)trxomf3ty1fptraneslt srtmxr nydale  nci t aDur(mont4tetniietas a rmu s u) eerifcto1op e uvolt0srur(o3no1optnlfctl(  2ur(  ;u4tex  oeiydfmDelnmon(4tltoxr3tadfpDe n ols)srxrxo nydoltemnci sf rrmur no1ale mieiyt a um(ms t0trxoxocoatomD anvs ()trxrio3no4olt lnetasfsDumumpnu1openiieiyt s2umumsn(0trtrmo oatfmD auvi;() rxmir iy4optn neilt srta(  no0oexnmocildfs eauvp u0artrxr ty1omDe ieo t0t2toir iudlp  mnvs (  2ta(ro;t4oetomiciytfsDrln o t4tlxnxr3tydomteln o ()t2trirpnodlpenlieia()a2rr(rpno1aptomfetytls2ea(ms;t0altrif oadopDe nesl() 2umxrpoy4lpt liesltfaDua(mpoo1oltnmieiyslm2eau pn()treomr3tadlaDraiei;s0 exo(o iy1ape lfvi ( sDrmurono1oex mociat m2rluvsn()trxoio3oydlpDrluvs;t0srtrim3nodal elfci s) 2rrx p;o1tptoifciad a ran p u4artrmo3oy1oat lnvo;t0tetrxopno4lpt  fvsas  rtr( ooo4tpt  oetysfaDeluvont4 rxrxocio1la eluvs t  eto(r nu1omtemfesas)a2tr(mo;t4opxnmo3ildfm eanvp;(4tlxoiocoytlaDraues;()tetrio3nudol n ncsas  Draumpou4tetnii3ilsls emuvs t)tltoiociotoptrlu il(  rtrxo ou1optnlici s)aruaxm ;u0tpx mociasfa2uaums (0trenmo3to1lm elueolt) etmimpno4ll elivils)srumx o;u1openifciltlm emnvp (0artnmo tatfa rli o ( s2toxo3iu4olen fctl( sDumumoot1aexnmfcildfs ra( sn(0 exnxf3tydfmD  uvslt0 2tmio3iy4ap emfetasfaDumxr ou1tlxo feiytfs2ea(msnt0 ltnmf3iotopDeli s;() etrir iu1omee fetas aDua(mpnt1aeeo ociysla umn s u0tleoifcto1omD  nvi s0t2umxo3nydap nmnci () rumxrp;u4tpenmfeiysfsDelnms (0arerxf3io1fa rai ils  rtoio3nu1op   ictasf rtrxr ou4oleo fciad m2emnmont)trtnif ty1fm raues;() 2umxopno4ap nlnesa()s2taumpno4oexnmo3iys sDrl(ms u0trxrmrciy1fatelneo (0 rur(m3ny1lmen nvi ( arua( oou0tlxnmociatfa2rl(mp t) exrxr iodla r i s;( srtmxr3oo1lp e fvsa()a2uru  ;o0tleomfetld aDumuvsnu0alxrxfctodoa eau i;s tetoxopoo1apt  fcsas) ruaumpnu0tex mocils m el(vo;t0aeerxoctodom e nvs ( texoirpoydameelfvsl(  rtr(mooo1tpeomoeiatfsDuauvonu4 lxnxr tatomtranei s0s2um(opny4lme  ivil()a2rrxm nu1aptn o3ildfm uluvp u4 rtrmf3iatlaD lieols)srtm(o3oo4apen nvi sfs2ua(moot1olt  feilslmDul(vs;u4 lerioctodoa   nesls  eum(o oy1op  lfcsl( a2ra(  ;t1tpt mfciatfs rlnmo t0tlxoxf3todopteauvs;t) 2um(mpnu4lm elfcsls) Drr(m nu4apxoioeiltlm uln pnt)aeerxo3ta1lat lu o;()s2uoxm ny1lme  icil( sDuaxr oo4olxniicilsfm2uln o;u)aexrxocoodlmtelieils setr(r3oy4amen fcilsfa2tm(rp;o1oeenmf3iltfs eln p;u4aeeoxf3ta1opteaieilt seto(o no4lm  livt ( srtau pot0teto oeiltfm2rlnmpnu0trtoxfcoo1omt lueo;( teto(o3oodole  fvi s)s2trxmpot1opx  iciytfa2emn pnt0 etrirctodop rlnesls t2trxm3io4lpeemfesl()arraurooo1texn oeiad s rln o ()artrio3ty1lp raieo;s  exoim3iudolt mietas) 2tr(r ;u4tetnioetls m ua(ms t)artrir oydop  auvi;t texoxr oo1ll elieilt) rurx onu4apen oeiatls2rl(vo u) eerxf ootfptrln i;s s2xrio iy1apen netas)a2tm( ooo0apx mo3ilslsDumuvont4tltomr tytlpDeli i;s  ruo(o no4oltelicils s2ta(mo;o4tlt  o3ils s ulnvs ()trtnif3oy1om rlivilt  2xoim ou1omee fvs t  2rmx o;u0tetnmoeiytla umnmp;t4arxnio iotlmt auvs t t2toxr iudoleemnctatfaruax  nu1ope  fciatlsDea( p t0 lenioctydfaDelneilt)t2xm(r3ou1aptelietlt)aDtaxrpno1tpxnif3iyt m ra( p;(0 exoir ta1opte u o (0srtm(m3nu1lmt lfvilt)a2rau p;u4aptnifeiydfm2rln o;u4 ltnif3iydfpte ivs t0t2tm(m oydom n nvslsfsDrmuroot4ole iietls m raumo;(0 rtoxfctadopD luvo;(0 rur(opoo1omee nvsl(  Drr(mp;o4tlxoifeiat m umu o t) etrio3oatlpDrlnei s0 2xmxo3iodamt mnctls)srtmxr ;o4oeenio3tldls2rlu sn(4 exoio oydomD  nvo;t0trxrxopny1op emfvias artau pnt4apeniiciad m umu ont) ltnmr3iy1fmDrlivsls)s2toxo oudlle liciatfa2rax pnu4alt mieiyslm2um( p;(0arxomrctatfa r ueo;s  euo(r3oudlptnlivtlt  rurxro;o1opt mi3ild m2umu p;u) exnmfcoy1om elivi;s t2urxrpoo4lle  fesls a2ta(rpoo1apen fciys sDrm(vo;u)aexomo3ty1lm rlivi () rur(m3oodop e feslt a2umxroou4oltnmiciaslm2ulnvo;u0aeeomf oy1op r u olt0tetoiopoo1optn nes (f 2ua(  ;u1oleniictysla umnvpnu)aexrmo oo1opDranvs;() etmxm3oudole lfvs s)s2trurono1opxn fcilsfaDem(vs;u)aetnxr3ia1fat  neols)seuriopny4ol n fctlt  Dta(mpnu4tlxnmfeiytlm ea(msn(4 leoxo3ootom raiei;t)s2to(m oudolenmnvi t) rrrumo;o4apt mf3tyd aDulnvo;u)aexnir3io1la elivils0sruoimpnu1op  mivsa(fsrtmu pnt1tltn i3ildfaDra( p u0artnxr3ootlm e ivs;(0 eurxopiu4ll elictas)aDta(  nt0aetoiocilt sDrluvs t) leoif3ia1fa  ln i;s0 rxm(r3oodalenlncsatf Drr( pnu0tpto ictlsfmDranvp;() ltomfcoadla rluvils0 etm(opoudol nmiei (farururp;o1apt  feiyd sDuanvo t) reoio3tytfatrli o s0srum(r nu1lmtelfesa(fsDta( oot0texniociyslm2eaumo;t4 rxoxf oadfmt aivs ( texo(r3iydlptn fcs (fs2rmx p;o1tlto fcild s ranvp (4artrmocoytomDr ivil()srumir3iydopeelfetl( artm(  nt4texomo3tytfs2rm( p (4trxnmf ta1oatean ils sexrxm3iudame mnvsa(f 2tmx p;u4oexoioetlsfs umuvpnt0aetnxo iotfpt lieils)s2xmim3oydomee nvsat a2rau oot1tlenmociasfsDemu s u) reoircootoaD  ueols tetmxr3io4olte ncslsfs2rau pou0tlenio3taslm2elnvo t0tetrio3tytomte u o;( t2trimpoy1lm  mfvsas)sDrmxrooo0tpen fciydlsDrluvs;t0aetnio oadlmt  uvslt) 2toio no1ap nlncs tfarurx  no4olx mocias a ea(vs;u4 lxnio3tytoaDr n ols0teurxm nodlpt lfci tf rrm(  ;o4tlxoifcildla rmnvo t4tetoiocootfpD  i i;( setr(m3ny4lpt mnetls)s2um(ront4texomfctaslaDua(msn()tltrmf3iatlpD  ueils srum(mpou1llee fvi t  2umur nt4openmf3taslsDrln o;t4alxnmr oytoaD  i olt) rtrio3iudal nlfvs sfa2ua(rpnu1teen feiyslaDrlnvo;() eenmr ta1lmDr nvslt0srxr(o3iu1lp nmnesasfarumurpnt1tpeoifeiltfs2uluvp () etrxo3oytlpD anvi t s2uoim iudaltnmicilt  rta(ront4aetomi3iasls rmnmp t4aexrmrciotfat lnvs ( trtrxm3iy1oltnlivt s)aDta(mono4aetnmfeiad m elnmo;()trtrxf3iydlp r uvo;s t2xmxr3iu4lpe mfetas sDuru p;t0oltn oeiasfa ua(vp;u0 lxnifctadomtrlnvslt)trxriopny4lpte fet ()a2trxr nt1oetn octydls el(ms t) rxoxr3oa1optelivs;( srtr(mpno4amte iet s) Dumxmo;u4opxo ietad sDua(mo;(4tetrmf3todfpDeli i t)t2urim oodlpt  ivi t srtau  oo1tex if3iytfa2emu pnt4 exrif tatom elu s;()s2trir oydlp   net ()sDtmu  nt1ope mf3ias a elumo u)tlxomo iy1omteli s;t0 2uo(r no4ol  livi ( aDtrx oot0tpto fciadfm rm(mp (4 rxnxo iydlp eln o;s0t2urxrpoo4oltemnetatfsDur(mono1apeo o3ilsla eln o;(4 rtnxf ty1fptraues () rtmir oo4omt lnvtat)sDumump;t1tpxn fctydfmDrmnvpn(4 ltnir3oydlm r i i;t trxmxrpio1openlfetat  2ur(rpnt1teeoif3iltfm2ea(msn(0arxrir3ia1lpDelnei t sexo(m iodop n fcs ()srtmxm nu0aptn ietys aDelnvp t4artnirctadla  ln o s) rxr(o iu4ameemicsltf 2ua(rpot4aetoii3iyt a eanvpn(0 etoxr3ia1opD ln sl() rur(m3no1optelivt tfs2uau p;t4ope mociasls uaums t)trxoirctotfp rli ols0setm(o ny1lmeelfcsa(fsDrr(ro;t0olxnmoeiyslm uluvs u4altrxf iadfmDelivo;()srto(o3ny1optnlfci s) rtr(ront0tptn feiltlaDrmn p;t0tleomf3iadop elueolt)seto(rpiy4lpe lnvslt s2uaxr ot4tlenii3iatlmDel(mo;t) lxnmr3oodom r nes;t srtrio oydlm nlicsa( sDum(r ;o0aee ioetytlm umuvp () ltrmo iatlpt  ies;()trumxo nu4lpt  neilt)aDur(  nu0alenmoctysfs2rlnvs;t0 rtrxrcio1fmDrlu s s t2tmxo3nu4lle lnvtl( aDtrum ot0aeeoioeiytls2emuvo u0 lxoxocoytfaDraueo s0srtmio3nodlp elfvsl(fs2tmu  ot1apenifctadfs ulnvsnt0 exnmrcoo1fa eaiei;()trtmimpnodole livtatf 2umu oou4olen oeildfm uluvp;u0 lxomociy1fmDr ues (0srum(r3ny4lmt  nvta(faDururo;t1oeto fciydlmDea( p ()teenif ootlmteauvs;()setr(o oudlp emici ( s2rm(rp;t0tlto octldfaDrlump t0aeeomf oy1lmDraies;s0 rxr(opnu1oltnmfesl(  rumu  nt0ope ifetltls2raumsnt0tetomo3oydla e u o;(0 eur(mpiu4altn fvta(  Drmxr nu4aeen fciat aDrlump;u0aeerxf iy1oatean ilt texmirpio1alt  fesls aDumur ;u0tpt mf3iadlmDumn p;t0altoxfciodlmDe neo;t0sexr(m iu4apenmneslt s2um(rp;o0olto oetas m2elu s;u)altrxr3io1omDeaiei;(0tetm(r oodal nlivia(farumumpoo1tltn ietaslaDrlums;(4areoxr iatomD lnvo s0trumirpny4openmfvt tfarumum nt0aleoioetatlaDumnvpn(0altnifciy1fm  lueo () 2to(o3iy1olenmfctas s2ua(r nu1apxomoetlt a em(ms (0trtnio3oydlmt aueo;s0texm(m ou1om  lnciat arraxroot4ape ifciys s2elumsnu4 rtomf oa1laDrluei t0sexm(r3nu4om nlfes s artmur ot4apxn i3iyd s2el(vp (4teenmo3oo1omtr uvo;s) 2toio3oy4ap emfvs t sDua(r oo4oeeo fetadls2ulnmp;t4altoxfcto1opDrluvi t0 2trxopoydal nmnci ()arurxm no1tpto octad a2eln s (4alxoxoctytop   n s s)s2xrxr3oudolt mivta( sDrr(  oo0olxo ocilt s2eaump;()areoxr3iotoaDraueils)t2xoim3oy1olt mnvtltfsDtaxmono0ape  f3iys a rl(vo ()tetnmrcoodlmtranvs ( texr(m3nydlpe  iei s)aDrru  ou0oleniietydfaDeluvpn(4artnir3ta1lmtrln i;s  etrim oydlmtelncs t)a2trur ;u4aeto ociasfs2rm(vo (4teerxrciadlatr nvs;t)truoxopoy1lltn fesls) rrrxm ;u1ole iieias s uaump;(0aetrxfcto1lmDrliei;s srum(opnydapeelfvtat artmx ono1aex  ieildlm ua(vs u0 rxrir iodomteluei;t)sexoxmpiudlmt mnvils)aDta(roou1apxnmi3ildlm ea( s u0alerxr3oodfpt aueo s)s2uoio oo4aleemncil(fsDua(mp;o4apeniociasfs2uauvo u) lenxf iotlptr i ols0seumir iu1am elnctltfsDtau o;o0tee  o3iydls ul(von()tetnxo3oytlmDrli i;( seur(r nu1ol  mivia()s2tmurpot0opxoiociytla uan ont0arxrifciotfaD lneo ()trxoxrpiydlm nlnctlt) 2ua(rpnt0aetoioctydlm2ul( sn() rxnifctotfp e i o;s) ruo(opio1ap  miei tfsrtrump;u4opxo iciltla2ea(mo;u0trtrxr3iy1fpt  i i s0t2umxm iu4lmtemietasf Dtm(m ot4aex io3tltlmDranvon(4trxomr3todlmD lueils0 exrio no1om  mfetl()aDurump;t0olt  fetydfs2emu p t0 etnmr3ta1oat auesl(  rxrimpiy1aptnmfes t)a2tmu onu0tpeniicils m eau pn(0trtoxf iydfaDelivs s)tetr(m3ny4lm nlfcsat)s2urxm ;t1oexoifetlt m rluvo;u0 exnif oodoa   ueol() rxmxmpiy4llen ivs s  Dra(r ;o4opeomi3tyt aDua(msn(0 rxnmo3oy1oat aiei t) etrxr iodap nlnet ()sDtmx  ot0opxomf3ild a em( snt4alxnifciadfpt  uei;t truo(o3nu1omee ivia( s2tr(rp;t4tltn ietyt a rauvsn(0tetomrctydlmtelnei;()s2toio ou4lp e neslsfaDua( p;u0tpen o3tasls2rmnms u4tlerxf oatlp  lu ilt  2xmir nu4optemfvs sfa2rmump;u1apxomictldfaDran s;(4trermf totfmt anvi () etrir iodape  icsas arum(mo;u4tle  iciyd s2uln o t0trerif3tatfat livslt0 eurim ny4llenlfvta()sDumu  ;o4teto ictat a rm(mp (4texoif totoaDeanei t)texrimpiudoleelnes tfs2rm(m nu0aptoioctydfs rl(mo;t4alenmrcoodfa rln s;s  ruoir3nodlltnmfei t  rta( ont1apenmociasfmDumnmsnu0texrio ta1oatr u il()texoxm3iy4om elfcs s s2raum ;u1oetomiciatls2eau snt) eenif tytlmDeaneo;() rxo(rpoo1lpe mfvtat)sDrmxmp;o0aleomf3iyslaDuluvsn(0tlxoif oydfa eauvols seum(m3oo4am n neia(fs2rru p;u4aleo fetyt mDulu s u)trenxrctotoaDeln ol(  2xo(o nu1lmen ietlt  rrmur nu0opxo fcilsfaDrm(mo u) renxf3iotoaDeauvo;( srxr(rpnydope  ncsasfsrurxmoou0aet  ieias s2elnmo;(0alenxfcoytfp r i s s s2toxm3nudom nmiei s)s2taxm ;o0ole ifcildla2emnvsn(0 etrio3iatfa e ieols0trtrxo nu1ll e fcilsf rrrxmpnu4apt ii3tysfsDulnvpnu4tetnxr3iodoaD lu sls) ruoio3io4ap nmneiatf rtax p;o1tptn f3iadla emnvo;t0arxoxf iy1fm  luei s0 eur(m3no1ape lneiasf rrmumpno1apt ioctytfa2ran p;(0 reniocia1lmtr ues t0t2uoim3no1lme livils aDurxr ;o1aex iicild m2emnvs t4 exrmfcto1lpte i i;s) rtoxr oo4olt  nvsa()aDrrx pou1apxoioeiadlm2ua(vo t4tleoxf iydoa rlieo;(0 exo(m3no1lmenmfvsas s2rr(  oo0oetn o3tat a rluvo (0trerxr iytfmDe nvo;(0texm(o3nodlme micia( aDrrxrpou4oet mf3iytlm el( snu) etrmr3oy1lmtrlivs ()trxo(m3nudlmt  ivsa(fsrtm(roou4apeo o3iatfa uanvs;(4tltniociadlat aivilt0 ruoiopny4am  lfeilt sDur(  ;o4tlenmoeiyt m rmnmo t4altnif oadoptrau i;(  rtrxr3oy4lm n net s srumu  ;u1tpeoioctad s ulums;u4artomo3tytlm rlnesls0seumxo oo4al  miesa( sDra(moot4apxnmo3iadfa ulums;t0aexrmf oodlmDean il() 2uo(m3nydlpenmnctl()srrmxrooo4tleo ociysla2el( s u)trenxf3tadomte n o (  rtoxrpio4lm e ici (f 2rrx o;o1apt mfetat s2el( o;()arxoio ta1fm r i o;t)sruo(r iodllt liet s)s2uaumont0texo ieiysls2eauvonu) lxnmf oy1lmtrlivs;(  rum(mpiu4altn ivtl( sDrax  nu0aleo oeild m em(mp;(0alxoir3ty1omD  ies;() rxm(o nu4lltemfcslt  Dtm(ronu4oee  f3iaslmDel( pn() lxomr ootfa rliesls)texm(o3oudlpe lncta( arua(rooo0teto f3iydla um(vonu0 rxoxo3iydlmDranes;t  ruoio ny1lltemnetas) 2ur( pot1oltoifcildfm2ua( p t0 lxrmfctytla eau sl()setmxr3iodapenlict s a2ur( oot4apto icilsla2ulu o;()trxnmf ootfm rln s t0teurxr3oodoptelnvt s)aruaxmoot1tltnmocildlm2uln p;t) reoirciotfaDr ieols) exm(m ny4aptnmfvsat)s2umurpot1olenmi3tadlmDea(ms u)teeoxr tydfatelneilt trxrxm3oo4omenlnvs () Dur(rp;t4alx moetltfaDrm(ms (4tleoxrcoy1faDelu il(  rxr(m3iu4altnlnet sfsDurx pnt1aexn i3iysfsDrlu p t0 rermo3totoat livs;s0teto(o3oydol  mici sfsDtaxmpot4aet  o3tys aDrmu o u0trxnxo iotlpDr ueil(0srxrxm3iu1al elnvtl( a2raumoot4tltnifcils m ea( s u)treomo oa1fm  ai o ()s2uoir iydlmee nviat)sDur(mo;o1ape mieiysfa2rm( pnt4tltrmfcootlp  aueols) rto(r3ou4al nmivt s  rtrum nu0aptomo3iltfm rmu p t0arxrmrcoy1fa raueo ()sruoxm io1ol emicsltfaDtr(ro;o4tle moeiytfs ulnvs u) etnmr oydlat  n i;s)trum(o nu4opeemicsas)s2trumpnt1alt  ociyt s2emnvp (0 eerir3iydomDrln o s t2tm(m ou1amenlfesas) Drr( pot4tet mociytlm eln p;(4alermf tatoate u s;t) exr(m oo4lltelncsa(  rurur ou0oltn f3tlsfa2eanmp;u4treoif3ootfateluvo;s  2xrio3oo4alt  ivi t)arum(rp;u1aet if3ias s ean on(4 lxoxfcoodfpDr ivilt)sexoio oodamt micsa()s2ua( o;t1aleo ietydla emuvpn(4 lxrmo3oytla rlnesls)srxmim nudap e fcta(  rumx pot4opxniieiatfaDrluvsnt4 lxomr iy1fat  nvs s0 2xm(r oydol elnvtl(fsrrru pnt0aptomi3iyslsDrluvsn(0arxrxo tytfmDeaueol(0 eur(r oodom nlfvil()artmuronu4aptnmieildfsDua( onu0 eeoir3iadlaDeli i;t0trtmio3nudlmtnmnvsasfsDuru p;o1ope  o3ilsfaDrmuvs t4alxnifcto1laDraueilt sruoimpiy1altemivil( sruaxmpno1tetomf3iytfaDrm( pn(0 etomr3iatfa e ueils0s2umir3iu1lpeelfvsat  rrm(  ot4tpe  i3tyt s uaums t)altnxr ta1oa r neols)s2triopiy4altelnctas) rtax ooo4ale  i3ilslsDrlumo;u) rxnioctatlmtelnvi s)teuoirpio1am elivtls srtaumpou4oetniieildfmDeaumonu0aleoir oa1opDe nesl( trxmio3oo4ol nlnetls srraur ;t1oltoio3tytfm2rmu s;(0tlerxfcoatfate i i;t)tetoxr3iu1omt mivta(faDtm( onu1aptomo3tldlaDeau s t0arxrif3io1la eau i ( teuo(m3no1optn ivt t aDtmu  nu1ale iieiatla rmuvsn(4aexomfciadfa e ues s)s2xrir3iodll e ivt (f rtax  ot0oltnmi3tasfa2emu s;t4arermf iy1oaD  ies ()teur(o no1al   nes () rra(rpnt0opeo ictadlaDra(vp (4tlxnmf3iydomDrln s t0 euoxmpno4lpt miet s) 2uax pot4apt  ieilsfsDemnvont)aexrir3todop r uvs;(  2ur(r3io1opt mici s  rrau  ;t0aexoifetytfa2rluvont4 renxr tytopD  i sls  exmio no1omtnlncia(f rrrxmonu0aexnmf3ildfaDem(ms;(4 ltoxf3tytfpDeai ils srxm(mpoydlpen ncs ()aDuau  nu1tptomocilslm2rln p u0trtrmfcty1fp eanvi s seto(r3oy4lmtnlnet s) 2ur(rpno4tle iieiatls2emnmp t)altnmr todla  livi;(0s2xm(opoy4lmtnlfcsatfartmxm nt0tpeo ictldla2uanvp (4trtrmo oydlm  ln ol(0seum(o nu1ape  ietas sDra(rpno0tlxo ocilsfm2eauvp;t4 etrmfcoo1fm   neo t t2um(opiydapt micsat  rtm(  ;o4apxomfcilsfa emnvp (4tlenif oy1fp rluvilt  exrxr iydlpteliei t)aDrm(mp;u4olxomoeiydfaDrlnms u4treomr3io1lpt  iei ()teuoim3oo4ol n icias)arraum oo0tpxnif3ilsfmDemn o u)aexoxf totopDr i s;t t2toio3iu1op  mivilt sDtrx  nt1openmoetls m rln s;t4 eenxrcia1fpDelneo;()trxm(r3ou4alt  fesatf 2umxmpoo4teenifeilt m2rmnmsnt0aetnxo ty1oatelivils  ruoimpoy4lpe  nvi (faDta(m ou0apt iociadfsDraump u)aeenxf iadlm   nvs;t) rxoxm3oy1ll nlfeia()sDuaum no1apx mfeilsfm2ulnms;t4tlxnmf ootoatrlueolt0s2xo(rpoo4lle lneia()s2rr(r ;u1tet moetydfm emumsn()tetoxf iytlp rlneolt  2toir3iydoltnlivi s sDumu  ;t1apto f3tltfm2uanmp;u4alxrio ta1fmDeau o ()t2tr(mpnu4ll   ics s)arumur nu4ole  i3iasfs ulnvo;()texoio3iydlpt an s (0 rtr(m iu1opt  ictat)aDua( o;t4altnmociad m umumsnt4areoxf iy1om r nes;s0 rtmxm3ny1llee nvi t)s2uau onu4oet ii3tydfm2uauvo;u4trerxf3iatfpteli o t sexo(o3oudole  nci tf Dtmxmpoo0oltnif3iydlmDumnvs u)tlxnir oatom ran s;( seuoim ou1am  lfei t)srur(r nu1oltnii3tadfmDrln o;(0 ltrio3tytfm eaneolt0srxrxm3oodlpe mfvta()sDurxmpnu0olxo feiydfa emumon()teeoxo ta1lm e nvils0srtrxo nu4lle lfctl() rur(mp;t1openmoetat a2uauvo (4 etoxf3iydlatrln s (  ruo(rpnudamte ivtltfsrtaxrono1aet mocildfa2ulump u)texomo iodfat lu ils)srxoxmpnydal nmivi (faDrr(mpnt4apxo o3ias s2rauvsnu4aetnio oodlmD luvi (  exoxrpio1opeemnctatfsruaxroot4opxn i3tys s ra(vont0trxrmr iodomDeln ilt)truoimpiudoptn fetl() rrr(  ot4aet mfetlt sDuauvp (4tlenmrciotfp r ivs;t0texmir3nu4ol n icta(  Dumx  ou1altomociltfs2emuvont4altrmo3iadom e uvo s  2xmxm ny1opt lnet (fs2truroou0apt mi3iltlsDrlnvpnt)aetnmrcoodfatrlnes t srum(m3oudlm   ietas) 2rmum oo1olx if3iydfm el(vo;u) rxnmrcoy1optrln slt0teuoio3iu1ome lnci (fsrur(mo;u0opt mictat s rmuvp;t4tetrioctydom rlieslt)setrio3nydlmtn nes (fartm( poo1aptoifeiasfm2rmuvp;u) exnxr io1fmtrauvo;t)srtr(rpiy1oltnmnvta( sDurum ;o1olto i3ildfs emu o;()tetnmr3iy1lpDr ivo;s  eumxr iy1ame mfct s aDua(rpno1tpx  o3iltlsDulumon(0 rtnmo ty1lpte i ilt0truoir3nu4om e fcsasfa2uax  oo4apeomocilsfsDran snt4tlxnxo3to1om  aueilt)truo(r no1oleelfct sf 2tmurpnu1oet  feilsfa2ea(monu) reoxfcto1optrauvo;t)teuoio iy1lmt  nvtat  rrau pou1apeoiieiytfs2rmnvont0 lxnmrcoa1omtr uvo;() 2umxrpny1lleelnvi t)sDraxmont1tlx mf3ild sDea( s;t0aexrir3tytlp  lieo (0teuoiopou1op e neiltfsrrr(mpot0aeen feildfm rlu p u4 etomf3to1la elieols)s2trxo oo1oltnlfesls aDtm(rpot4texomocilsfm2elu snt4trtnio iadoaDeli i;s)s2tmxr iydoltn nes tf 2rrxmp;u1apxo iciys a2ranmo t)trxnircoatfm rau ilt0s2toxo ou4ap nlnvt tfsDrrumpot4aleo iciltla rau sn() reomociy1opD ln o (  euo(m3io1lpen fct s)a2urx  nu0oetoiociydfm2el(vo u)arxrmo io1op e nvol(0t2uo(mpnydam n nci sf rrmu o;t0oexoifetyslmDel(vont)trtoxo3oydlptelieo ( trxmxo3no4llenmfvias  2urxmoou1oleo ictyd a um(vp;()tlxrxfciodoa eanvs s s2tr(m3iy4ap nmieilsf rtmxmont0oetn fcilsla umums u) exrxfcoodfpt auesls)seuoio3io1llt mnet s arra(rp;o1olxo feils a eluvo;u4 rxrxrciy1fptrluvo;s)setrim iy1lmenlivs ()a2tru  ou1opx  o3tld mDelnvs (0 lxnmf3oa1oaDrau slt0teuo(o3nu1lmt  ici t srrr(rono4altnioeilt sDemums (4aexoio tadfmte nes t)trxoxr oodoptnmnvt t)aDrmxrpot1alt mf3tatfs2rmu o t) leomfcoodfmtran s t)sexr(opnydoptnlfvi ()arrrxrpot4aet ioetatls2uanvp t4teerif3todlate ueils0 2xo(r3ou1lmeemivtas a2raxmpno4tpt ioetlsla2umnvsn(0alenmo3tatla elivols s2tmio3ou4ameelnct ( s2uaumpou0optnmo3iydfsDranvp t)artrifcto1om e i s;t0sexoir nu4am   icia(fs2tmx ono1apt ii3iasls emn pn()alerir iatoate u s;t)srtoxr nydome lieilsfaDrmu  nt4tpx iicilsfm2em( o;t0tlenirctodop eaieslt srum(rpiu1apeemnvt s sDtm( ooo1tptnmocilsfs2umnmo;(4 lenxr ootlpt an i s)truoxr iudam  mivi s arta(m nt4opxnmietldls2elumo (4arxrir3iydfmDrauei;( tetr(m nu4ome lici sfsrumuroot1aexnifeiyt a elu sn(0aexrxfcto1fpD livo s trtoxm iydlme mici (  rrm( pot4oexomi3iltlm rl( pn()arenifctytfa e ueol(0s2xrim io1lltn fvtas) ruaumpnt1oeeo iciys sDrln pnu0 rtnxr3oatoat  uvo t srxo(rpoodlm  mici tfsDum(mpou1aee mieiysfa2rm(vp;u4arxrir3iodfat au s;s sexoxr nodal   nvs sfarrmu pnu4oexo oeiyslmDelnvp;t0tlenir3iydomDeai sls) eumiopoy4lpt lnciatf rumum ;u4oet mociltfaDuln p;u)texoxr oytoatraieols)texriopoudlme mfesat aDraump;t0apto ieiytlm2ranvp u) etomocoodomDean i;t texm(r ny1lm e ivi (  2rru o;t1apt ii3iytls em(vp t4aleoirciodfaDe uei;s) 2xmir nu1optemietls sDuaxr ;o4opxn f3iyt aDrlumsnt) lenxfcoo1fmtraueo;t t2ur(m oy4amte fvs () rrm(mpnu0teto ictat aDumums t0alerio oatfp   ivsl( srxo(rpio1lltnlfvils)s2raumo;t0tee if3iat mDeluvsnu0arxoir to1la r i sl()truo(m3oy4am  liei s a2tm(ronu4aeeomieiydfsDem(vo;t4aexrif totopD lneo ( texmio3oodllt mfcslsfsrra( oou4apx  octat m el(vs u) rerxoctytlp r i s;s0 rtmimpnu4oltn fvt ( s2tm(r ou1oleoiieildls ua(vs;() ltnxo ta1om rlueo t)s2to(opou4lleelfetat  Drmu p;t4olxnmf3tadfs rl(vo u0alxoio iytomD luei t  2xrir3oy4lltnlfeia(  2uaump;o1texo fctys aDel(ms;u4trxnmrcoadlmt  uvo;(0 2ur(m ny1ameemiesl( sruru oot0olt moeiys s2ulnvo t4arxoio3oo1fa r ivs;(  etrimpio1alenmfvslt)sDrmx  ou4apxomf3iyt mDrm(ms;u0trerir totlaDe uvs;t0t2urir3oudlp emfctls)srua(rp;u4tlxn oeiltfsDem( p;u4 rtnmocoydlaD  uvo ( setoxo nydlme  icias) rumurpot4tee  icilsla ua(vpn() lxoxr3ta1opD anvs t  exm(m3oodlmt mfciasf Duau  ot0alxoio3ildfm rauvo t4texrio iodlaD lnvi;( t2to(mpnudalen ivs tf 2tru poo4oet  i3tlsfs2ul( p u0 rtrxrcto1fpDr n o (0 2umiopoo1llt livs s)s2ur(mpno4ape iociyt a2el(mp t0trxrmf oydoatelu o;(0setr(rpny1ap n fvtlt)srurxmpot0aptoio3iat s eauvsn(4 rxnircia1laDe iei (0s2xrxo3oydapt lnesatfartmxr ;u0aetomfetasfaDuauvo;(4areoxoctytoa  aivs s0texo(m3nu1ol nmnesat)s2rrxrp;t1oexoiictas s ran snt4arerxo3oa1oa rluvi (0sexm(o oo4olenmfvi (fsrua( ono1texn f3iasls2uln o u)tlxrif3oytoptrauvil()sexoxo iy1oleemivtls)sDta(m ;o0aeenmoctltlmDrl(ms;(0alxomfcoydfa r ueslt0setr(r io4al nlietl(  Drm(mpnt1aleomf3iat mDemnmp;u0arermoctydop   i s s0texm(m3ny1ll  lfvs (f rrmu pou1oex  iciltfs2em(vp;u)arxomf3oytfmtraues;s)texmxm3oodolenmnvsas s2raurpoo0aeto o3tydfm uluvp (4 etoxr3to1omteli i;t  rxrim3no4om   ict t  Dtmuronu4opt  ictadla2ul(vpnu0tlxrmocoo1laDrlnvo t  2tmxr nudaptemnctat  Drrurpnt1aptnmi3iltfa ra( s t0tlxoxoctytfmD  nvi;t)trxrxopoo1omeelies (fs2urx  oo4altomoctld aDumu s u) rxnxr3totlmDrau i;t0t2tmio iudol   fcsas)srta(mo;o4oeenmiciytlaDumnmo;t4 lermf3iydoa rlnei s)srumir3nudlmeemfcil()sDtm(m ;u4teen o3tatlmDea( p;()alxnif3oydlatraivs;t)t2to(opno1lmtnlictl(f rtmu o;t4tlxomieiadfs2eln pnu)artrio oa1opDraieo t  eum(m3oo1lp nlfesat  rtmu  ;t1opeomo3iyd sDuauvsnu0 rtoirciodfaD li o ()tetr(o3ou4aptelivt t) 2umu o;u4opt if3iadfs emumo;(4 exnmfcoy1fmteaivs ( trtriopnodomeemncsltfa2rm(rpnt1tee  ieiyt m rm( snt) rtrmo3iodlm   ueo;t s2xrxo3nu1lmtemneilsfsDtaxrpoo0olenmoeiyt m ea(mo;()tlxrir oa1op eanvs s trxo(m3nodll  mnvt sf Dur(r ;u1tlx mfciasfm elnmp (4texniociatfmD livsls0 2xmxr iu1om nlnetat) 2ur(mooo4opt mf3iytfm ul(ms;()tlxnmocty1omt li il( teuoxrpoo1ll   fei (fsDrmx  ;o0apeoiociydfa2rm(mp;()artrxf tydfatrlnvo t s2uo(m nydopenmfcil()s2uaxmp;o0apeo i3tydfsDrlump;(0tetrmf oadopte nvo ()sexoxopoo1ll nlnei (  2umxmooo1aexn ociatfs ra( s;(4tltrmocoa1opteliei;(0s2xmirpoy4olte fcsat sDuru pno1alxn icilsla ua(vsnu)tetrxrciydfate neo () rto(o3io4al emfvi t)s2rru poo1altn ietas sDua(mon(4aetomf3iatfm  an o;t seuoxm3ou4aptnlivtas) Dumxmo;t4tlxnmf3iysfs2umnmont4teenxr iytlatelueol(0s2tm(o oydlmenlnet tfs2umurpnt4optn feildls2eluvon(4alxnirctatfa r u i;(  2xmiopnodapenmncsltf 2rrxr ;o1tptoiictadfa2eanmo;(4trtoxo todoaDeanvils0 rtoir iydopenmncsls) Dtrxm oo0opt  feiatla rmu p (0 eerxr3totfaDranvs;t trumxo nu4ale lfet t)sDtr(  ;u1opeoifciys m rm(vs;u) rtnxrciatlaDr iei t)s2xrxo3iy1amt micsat aDraur ;o0aetn o3iasfm umn o;t)teenxfciotla raivo t  rtrim3oo4lm  livsa()aDtmu  ;u0oeenifcias s elums t0tlxrxr to1fpDrli o () 2toio3oy4lp n iciltf Dtrx pnt4teenmi3ildfm2rl( pnt0tltomr3totop rlu o s) etoir ou4lle lfctasfartru pnu0oltnmfetadlsDum( p;u0aexoxrcoytla eanvo ( teumimpny4olee ncils) 2rmumpno0oexoio3ildfa2umnmo;t4tlermociytopD ai slt0srto(rpou1om emivtat a2ra(rooo1tltnmieiydla2uan onu0aexomo iotoaDr ieo t trxm(rpny4ll emfet ()sDuru onu1tptnio3ilslsDemums t4 etoxrcoo1omDr i sl( srxrxo3nu4lmt lnvil(  2umx  ot0opxoifcias m2rmuvonu4 lxoio3oadfptr i s;(  rtm(rpoy4ome lict t)a2tmxmooo4tpeo ociltlm2ua(mp;t0texoxf3iotoaDelivs;t)s2tmim no4lm   ncta() Dra(  oo1tpxo icils aDuanvpnt)tlxoxf3iytlaDeanvs;s)t2xoxr3nudopeelfeils a2umurpnu4tle  feiyd a2em(vo;u) ltrxr oydfp eli i t0t2toxmpno4lp   nvi tfsDrax  ;o0oeeoiocilsfs emumpnu4tltomfciydopD ln i t teuoxm no4lmt  ivta( sDum(ro;u4tlxomieildfm rmn o;u4 lenxrcoadlpt  n s t)tetrxm io1al  liet ( srtax  nt0olx iietytlm2um(mp;u0texrmo3tatlm raues;t0srurir iu4apee ictas)s2raxmpnu0tlxnmo3iasfs eaums t4 ltrxrcta1opte ies;s truo(m nudom e nvi (f Duru pnu1teen ictyd m2rl( o ()artnxocoodlpD  ivo s texrimpio1om elfeias  Dtax o;u4apxomi3iydls2rauvs;()arenmo oo1fpDe iesl(  ruriopiudllen iet ()srtm( pot0aleoio3tadfmDul(msn(0tlerxo oytlat anvi;s) exoiopnodom elieil(  rtaxr ou1aet mo3iydlm2ulu onu4trerxfcto1opDrluei;s0 rtoxrpoo1ap nmnvia()aDum( ont0aexnioeilsfsDranvsnt4altrxr to1oa r n o;(0t2ur(opou4lle mnct s) 2ururont1opt io3iysla2emnms u)altrir ty1opte n s;( t2tmio3io4lm e fvs () 2rrumo;t4apxnio3ild a ua(mo ()trtrmr3tydop e u s t) eum(o oodopt  ies t)aDtmxm oo0texo i3ild sDumn ont)altnxf todlp elivi s0srtriopny1am nmfetl()sDtr(mp;o4tleomfetasfm2um(vp (0aeenio3oytlaDraivilt  2xr(rpoo1amtnmfct (f rrmum nu4oexn f3ils s2em( ont0 ltnxrcoo1fm ranes t teumxo iy4ome lfei t)a2trx p;o1apenmo3ildfaDemnms;(0texomocoydom  aivi;s0s2xmiopnu1om   nct s)aruru p;o0optnif3iyt aDulnmont4tlxoifcoatlm ran sls  rxoio3nu4aptelncs t  2umxmpno1tlxoifeiasfm2ran o ()teeomf3oytoptean ilt t2trxr oodlltnmiet sfs2rr( p;u0aetnioeilsfs2uaums (0 eermociytfpDe ieo;t0t2xoxm oodole mnciat  rrm(  nt1oex miciasla rauvpnt4 eeomociodlaDrauvs;s0t2tmirpoo4olenlneiltfaDtm(mpno4altoiiciaslsDumumo;(4texoif3iodopteaies;s0 rxmirpoy1lp   fvia() 2trx pnt4aeenii3iltlaDum( s t)tleoxf3io1oaDeai ol(  rxmio3oydlptnlictl( a2umuro;t1alxo ieilsfs umuvp () lxomoctotoa rlnesls  etoxr io1lptnlnvt s) Drrx  ou0oltnifetlsfmDra( o;(0artnif oatop rlieo;() 2xm(mpno4lpenlfcs ( a2taxmono0apto ietlt s umnvsn(4 lenxr3tydomte ues (0seum(mpny1op elies s  Dtm(rpnu1olt ioeiat a2ranmo;()arxrxocoo1fpD aies;s)trtrxrpiodll  mfci ( srrmumo;t0tlxoioeilt s2rl(vs (4aeermf3oa1fm  ai i;s0 rurirpoo1om n ietas)aDurumpot4alx mf3tasls2uluvp u0 exrir3io1oaDranei ( srto(mpny4altemfcsl()srraxmont0altnio3iytfm2ranmsnt0arxrir3ty1omDr uvs;(0s2tm(o oodol   fvsa()sruau poo1tet  icildlm2umumonu)alenio iodlmteln sls0trto(rpiu1lpeemnct t arua(ront1olxomieilt s2rm( s t4teenxf todomDeluvi;( s2urir3iy4lm  livtas aDrr( o;o4tetn ieiatlsDel(mpnu4trtnmf3tydom e neo;t)trurim no1om emfvt t aDtrxro;o4oee  o3ilsfa rauvsnt)aetomrctodfaDr n i;t)s2um(mpnu4lm nlnctl(f rrrumono1aexnmf3tlt s eanms;(0alxnif ty1fp  aivil()sexr(m3nu1llenmfvil( arrmuronu1oexn ociydfmDumu s;(4 etoxfctadoa eluvi t texoimpnu4ll nlicia(f Drax ont0tpe mo3ild aDrm(mo;t)tlxnxrciadopDrauvol(0sruriopno1llt livtas)sDrmx p;u1tlxnmo3iytlmDem(vsn(4alxomr3ty1op rlieo;s trtoxmpiu1llee iei t sDrruro;t4alt iictad mDua( snt0texnio3todomD aues t  etmir oodlp nlnvi ( aDrmx p;t4tpe ifeiat a2rm(ms t)tleoxr3tytlmtr u o;t0trumxr iu4llte fvs tfarum(r oo4tpe ifcild a el( o t4texrif iadoaDrlues;t0srum(o oo4al emivsat) rtmumpno1teto oetlsfm eauvpnt4 lerifciatfm eaieol(0 eurio oudape mneia(f rrmx  ;t0apt mi3tadfmDrmu p u0 rtrir3tytla   neols) euo(rpoudam nlfcta(f 2tr(mp;u4apt  feiytla2ranvp u0aeenir to1oaD luvil(  2xrxr oy1om  mfet (  2urump;t4optn oetadfm rm(vpn()aeenmf3iy1lm   u s;s) eumim no1alen fvt t)sDtm(rpno0oexomoeiysfaDea(mp ()trtnir oy1oate nvs;( trtrxm io1lpeeliesls) Duaum ou0teto oeiyt sDem(monu4 exniocoo1lmD an il( setoimpnudlpenlnctatfsDraurpot0tptn iciat aDum(msnu4arxoxrcootlatrai ilt s2xrir3oodamt  fvtat artrxmoot0tpxo i3ildfm2ea( p;t) lxoio3ty1laD luvi;t0setmirpnydamt  ivs (f rururono4aexnmiciytlmDemu o;t0tlenif3iydfatraivo t0 2tm(mpiy1om emiesa(fsDtrxmooo1tptnif3ilsls2eln o;t0tetnxo3todlmDelu s;t)t2tr(rpnu1om  mncsat)srta(rp;o4aptnif3ild a2emu s (0 lxnxo iatfpDrauei s t2umxopoo1optelfvta()s2trxmp;o0alxn fctldfsDrmnvp ()trxrxf3oadoaDrau ols0sexmir3oo4ol nlfctl(  rtaum ;u4oexn o3ilsfmDrmuvs u4trtnio3oydoa raivslt0 2tmio iydam  lieta(f 2raumpnt0tpxomo3ilt s um(mpnu4aetnxrciatfat aivs t)t2xoxm ou4apee ncias aDtmumoot0tlxnmo3iyt a ean sn(0arxrxr iatlaDeauvo s s2trxopno4ol n nctl(  rum(  nu4texo f3iad m2rlnmp;u)tetomociatfpD ln o;t)t2tmiopnodopenmncsas)sDuax oou4aetnmo3iys m el(mp;t4trenio3oytoa rluei;(  2toim3oy4oltnlnetasf ruaxm no4ole  ietysfmDea(vpn() etnio3iydlatr u o;s) exoxm iodlm  mieils  rrrx pot4opeo f3iltls eln pnu0 eerif to1lpte i olt)tetrxm nydol emiesa(fartax  nt0tpeoiociltls2rm( o u) rtrxf ta1omDran sl() 2trio nu1amte ivsas sDtrx  oo4tle  o3iydlsDemnmsnt4 etomocta1omt luvslt teurio3io1ape mivsl()s2tmx  oo0apxomfctad sDrluvpn(0aeenmocoadfatelivo s0texmxmpnydap nmnctlsfs2raxmo;t1optnifciasfs eln o;(4 rxrxocto1fa  lu o;s) 2umimpio1lleelivsl(f Dtr(  ;o4tlx mietydfmDua(msnu)aetnmf ta1oat ln i;t)t2uo(mpoodal  lncia( a2ur(mpoo1oetniieiat m2emn on() lxomf oadfa e u s;s teuoxrpoo1amenlfctatfaDra(m ;o1aeen octat a em(ms;u) rxomr3oadom elivs;() exr(mpoydlmt mnvsl(fs2ur(rono0teenifciytlaDrmu s;t0tetrxr ootop  li i;t)trtoxmpou4ale miet t)aDtr(mpou4opx  oetytfs rl( snu0 eenif3iytom ean o;s  2urim iy4amen icilsfsDumxr ;t1texnmieiydfa rlnvpn()altoif3ta1omte u s;t t2um(r3iu1ll emici t s2rrump;t0tpeomo3tytla2ra(msnu0artoircoydfpte n il(  rumir3no4alenmnvi ( sDtmxmp;o0alx if3tydfs2ua(msn(4artrxr oodfmDeli sl(0trxrir3ou4olt mieils)aDum(  ou0tetn i3ils s uanvo u0trxoioctadom  auvi;t  exr(rpnodlltnlnes t s2rm(rpot4oee mfctatlmDuaumpn(4 leoxrcio1omD au i s)trxr(rpno4lm elfvi (  2rrxmpnu0apx iociys a rauvp;t4 ltomfctydlp eauvi;( texmxmpoy1ll emfcsl()aDtrumo;o1opt mociltlmDelnvsnu) lxnmo io1la rlnes t0 2tmim3iydlptelivsatfartax  nt4teenio3tltfa ra(vo;()texnxf3oo1opt  nvo t)t2to(r3nydlpt lfvi s sDumxr nt1tpenmoetas sDelumo;t)tetoirctotfateluei s0 2uo(o nodam   fvi t aDta(  ot1tetomf3tytls2raumpn(4tltoxrciotomD au olt)s2xrio3iy1apeemiei tfarrmu  nt4aetoif3iyd m2ranvo;(0aleoxr ta1lm eau i;s0 eurirpou4omenmnesltfsrumx p;u1aetomfcilt mDrlnvo;()tr
\ No newline at end of file
@@ -0,0 +1 @@
+u i s0tetrxopiydlm  mnvsa()arumxrpnu1alt mfciatfs2ua(vonu)alxrircto1op elnvi;s)trto(m3nudop emfeiat)srrrur ou0tlx mfetld mDuluvpnt0alxrxr oo1lpt  nei;(0srtm(o nudop  lfvslt) rta(rpou1tlxomieils sDrm(vs;t4aetomf3iydfmD anvi;()s2trxopoodal  lfetl()a2trxrono0aee mictydlm eauvp;()aetomf iydlptelu s (0trumimpoy4am e ncta( srrr(r nu4aptnioeiyd sDelnmo;u) rxnirctadomDeaiei;()teto(o3iodaltnlnvs s)srtm(r no1olto icild m eln onu)aeeoxf3ta1omtr nei;()t2xrim3oodomtn fvil( sDrr(  no4oex  ieiytfsDulnmont0altomfctotoa rluvi;s0tetoxm3oudom   fvs tf Dururo;u0tpeoio3ils s ua(vo;t0 rtoxr3oodoaDran sl( s2xrio3oo1lmtn ivsa( a2umur ;t1ope mfeiltfaDranmont0 rxomr oydoa e i i;s0 exmio3nu4lpenmfeiat)a2tru  ;t1apxomf3iytlm2ul(vp t4trtnmociotfpDe u ol( s2xo(mpoy1apt  neil( sDtm(rpnu0olx mieias m2rauvsn(4aexnmo3ta1oat luvs;t t2um(o3oydale mnci () Draxm oo4alx if3tasfm umnmp;t4alxomo3ia1lpDrlnei;()srtrxo iudlpte fei ()srrmumpot4aleoioctydlaDel( o;u)tetoir oydopt  ivo s)sexoim iu1ame  nvtas srtax p;t4alx mf3ilt m ra(mp t) exrio oatfa  an ilt  2trxm ou4ll elnctas aDtaumoou4aet  fetldlsDum(ms (0alxrxf oo1oatrluvolt  rtoimpoy1lpe  nei t) rra(rp;o4olxnmieiyd a2rln o ()aexnioctatlpDeauvs;t)trurim3nu1omtnmnvi t srrrx  nu1tlx mfetydls umnmp;(0 renxo tatfm rai i t tetoxm3iy1lme lfcs sfs2um(r ou4tpx  iciat sDrlnmo t) lxnmf3ty1op elu i;s  2urxr3oodlptelnvslt)aDtaxroot0oexo iciatls elu ont0alermf3to1fa e uei;( s2uoxm iu4ol emicia(  Duaum nt4tltoifctlsla rm(vs u0tlenxo3iytfpDe ivi t) exr(m3oodome lnctat)srumxrono0aeen icilsls2ulnvs;(0aexnxr oytlmtelieo t s2toxr3oudam nmfvs () 2raur nt4olx  ictytfs ul(mo t4tltnmo oo1opt livo s0texrxr3iudom elfvsas srtmur ot4aetnioeildfsDrmums ()aeerif3todlm   u ol( seumim3oudom  lfeslsfsrrr(mp;u0tpxn feiltla uan p t0tetoifcta1op rai s;s  etm(m3nodol nmict s srtaxmoou0tltnmiciat mDuauvp;t)teermr iadomDeaivo (0s2urxr ny4ome  ictlsf 2tmx p;u4aexo f3tldlaDul(mon(4 lerxo iatfp eanesl(  2xm(rpiy1lltemfet ( s2ra(r ;u4tex ifeiadfaDelnmsnt) renxf tatoaD au s ()srxmir3io1op  mictlt)arrr(rono1opeoifcildfa ranmpn(4trtnxociadlatrai s s0 rxm(mpoy1al   nei sfsrtmxrpno0tetn fciytfs2rau p u) rtrxrcoa1faDelnei s trtm(m no1opt  fctl( s2truront4oleo fctltlm uauvo;() rtnio3ty1oatr nes s t2xr(r iy4lptelfvilsf Drm(m oo4tlenio3iysls2rlnvsn() etrmfcoytop  anvs;s)t2xm(o3no4lm emieiat)s2ra(rooo1aptoiiciasfs rauvonu4 reomociydlpt lies;t0s2urir3oo1aptnlnvslt)aDuax  ;t4apx  ieilt s rm( o u4aleomf3oy1lpteln sls srtoir nu4apeelivilt)s2uax  no4aetomf3tyd a2ulnms t)tlxomo iotfaD  u o s) eumxo oydll   nvias sDtmuro;t1olxnmicilsfm2el(vsnu)texrmo ia1fp  lieol()tetm(opou4op  lfctas)a2tmu  ;o4apen icias a2ulumsnt0aeerxf todfa eaiei s0s2umim nydom nlivs ()a2ua( oou0alxniietlsfm2rluvp t)aetoxr iadlmt lnvo;() ruoirpno1opt lneslt a2raxr no0tex ii3ildls2ranvp;t4 lxrmr tadfaDeaueo ()truoxm3io1lltnlnei () Duru pou4olto ieiytlsDemn onu0 etoio tatop  lnvsls0t2to(mpny1lmte iesls aDtmxr nu4opxn ociad m rmnmsnu4 rerxf3oodoat lu s t0srto(opio1lle lies s sDrax o;t1alxo o3iytfa2ua(vo;t0trenmo oy1laDe u ol(0 rxo(opnodamee feilt aDurump;u4opt io3iys s umuvpnu4texnmr oa1lmDr ieo t0 2xr(r ny4ope  fcilt aDuaxm ;t0aet  f3tlsfm2ranms t0tetnmr3oodlaD lieolt0sexoirpiy4lmenlnesasfsrrau  ;t1openioctlsfs2rmn o t)alxrmf3oatfpt anvi;t srur(o3nudole lfvsltfsDtr(r ;t0apeoif3iltfs2uluvs;t0treoxr oodlatrlivo;s s2xmir3nu1amtn fesa()s2tmu o;t4tltnif3iatfmDea(vs;t0 lenmfciadfm   uvolt)s2xrxopno4opte iviasfsrtru ono1aexnmoeiysfm2emu onu0altnir3tatfaDeanvils0 etrxopiodamt lnei sfaruax o;u1tpeo o3tys aDumu o u)aleoir iytlat  nes;(0 rurxr3oy1open feta(f rtrx o;u4ope iociyt sDrmumsnt0aetrxf oodom  lneol()trxrxr nodll elics ()srum(mpnu1olt io3iysfsDrlu pn()tlxnmf oytfm raues;(0 2xmxr3iu1al elnvsasfs2taxmpou4ale mf3iyt s2rlu o u4arerio ta1lat lnvi ( s2tmiopoydoptnlieias s2rmurono4opeomfetasfsDrl( s (0aetnir oatlpDr u s;(0 2um(mpny1altnmnvtl( arrr(  nt1tetniiciydfs rm(vo;()alenmrciytfpD an i t0 2xo(m3oy1lpeelicias s2raxroou1tlt mo3iysfa2uluvs ()teerif3iytoate iei s0trumxr3io4ll  mfei t) rrr(mpnt1tpeomf3ildfs2elnvo;t0alenmf3todlat lieols0trxriopiudlm  mfvta(  2taurpou1tlen fetld a ra( o t)texoxrctytoa r i o t  etm(m3oydal  mnetls sDrmu ooo0aex mf3ilsfm2um(mo ()artrxfcoa1lpt li s;(  exrim3iy4am elneias sDra(ronu0apt moctytla um(vs;u4tleniocoo1fpDe n i t0 exoimpoudaleelivil(fs2taxm nu0altn i3tlt aDem( p;t0 etnir io1fate ieol( sruoir3ou4lle mfct s a2rrxr ou0texo i3iysfaDumnvo (0 eenmf iytfpDrauvo ()t2xm(rpiydoptn iviltfsDraxr no1olt mi3tadlm el(mo (4trxoir iydlmt  iei;s) etoiopnydlpenlncslsf Dtmuroou0oeeomiciaslm2ra(vsn() etoio3iotla eaivi;s) exrxo oo1omeelici tf Duauront0apx  i3iadlaDuau p t4alxnxf3iadomDrluvs;t trxm(r nodop emici ( srrmxmooo0tetnmi3tls sDranmonu) reoir3oa1fa ran i s s2trxmpio1am n icsltf 2urx  ;o1tlt  feild m2eaumo;t0tlxnmr3ta1oat an o s0teumirpnu1ame lict s s2trxrpnt0aptnmoetltlm2ranvp;(0 eenxr3iatoa rlivi;s)tetr(o3nodaptemfvsat)arrrurpot1ole mo3tasls emumo u) reoxo ia1fm e ieo;s  eto(m3ny1lmeelfetatfa2tr(mpou1alx ifciydls ulnvpn() rxoio iotlmte nvo ( trtoimpoy4lm nlnctls arururpno0aexo fctld m ra( p () ltnmrcia1fatrli s t t2xr(o3oodom nmivsas) rrrum no1ope  ietys m2rl( o;t0 reoxf3oytfa  aueo t0sruo(r3iy4am  mnetl()sruaxr nt1ope mf3ildfsDuauvp u4tltrio3iytopt an i s trtmio3iy1am   ivsl()aDraum oo4oltn fctadlmDelump u0texrmf iatfp e n sl(0teurirpiu4op emnvta()artax  ;t4texnioctlt s uanvp;(4tlxnif3tadfp elu ils0trxrio3io4lptnmieilt) rumx p;t4optnmoetlslm2ulu p t)treoxo3totla  lnvi;t)srtmir nydoltnmncta(farta(mono1oleo feiadlm el(mont0 eenmr3iytoa  lies t0s2tmio3nodap  mivtl() rur(root0tptniiciytlmDumnvs;(0 ltnirciodlat aiei ( srxrir io4optelictat artm( oou4tpxomieiyd mDum(mpnt4teeoio3oytfm rln ols sruoimpiy1ape  fvtlt sDta(mp;t4teto oeiys s rlu p u4 ltnmf tydlp e ues ( s2trim3iu1ol  lici s  rumur ;t4oleoioetysls uaumon(4aetomfcoo1fmDelneol(0s2urir3ny1ope  fvsl()arrr(r oo1opt  fciaslmDem( s t0tlxrif3todlpD liei;( sruoxm ny4lmeelfei t sDrmx pot1opeomfeiatfm2eaumsn() lxrxr iotoa  livs ()s2umxm3no4apt miei t  2rrxmpou4apxnmoeildfa ua( on() rtnxr3io1omtean sls t2xr(r nu1opee nvia() 2trxrpou1oeeomo3tysfmDelnvp (0tltnmrcty1fmD lnvo t  exo(m nu1ope lfet s)s2tmuroot0opxnmfetltlm2ra( o (4 rtnir3tadlmD  ivols0tetoxm3ou1lm e fvsltf Dra(root0aptnmf3iytls2uanmp;u4aexnir3oodfmteai s;(  rtr(r oydolt lfvs s) Dum(r ;t0tle io3tldla2uluvo (4teenio oodopDelivils)srum(mpiy4om nlicsa( sDtrum ;t4tlt ii3iyd m2emump t4tetnifctotlmDeauvilt)s2ur(o nu4llenlnetas) Draum oo4tetn fetaslm2umnvs;t)artnmr iytom eaueo;s0 rur(r ny1amenmnes (fs2ta(rpno4opeoifeiyslm2uanmo;(4 ltomf3ty1lp eai s;t)s2ur(o oo4opeelici t)srrrx oot0apenmoeiyd a2ranms t)aeerifctodoat  i o t0 2tmir3nu4lmtn ics ( s2um(m ;u4texomi3iaslaDrlnvs t0trtoxf tytomDrlneol(0 2xoxopoo1opt lfesa()a2tm( ont4altomo3iytls2emumo;t4 rtnircootomt anvsls trtoxrpiu1omee icil()arua(rp;t1apeoiictadfa2elnmo t0teenxo todlpDranes;t) eumim nydlm nlnes sfs2rru oot0oexnmfeiatlsDemn p;u0 rerxo ia1opDrlu i;t)s2um(m iydlle mfctatfs2taxmoou1aet ioeiatfa2rlnvo;(4altoxrcoy1lateluvi t0 exr(r iy4lp  mncias sDrmxrooo0opeomi3iadfaDuauvp u4arenirciodfa r i o t)s2uoxr3nu4apt  ivias  rurxmp;t1tet  i3tltlm ul(ms u)tetrxf3todfpDrlnei s s2xm(m nydlpt mfcilt) 2ta( o;u4ope ioeild m eanvont)alenirctytla   ivo t0trto(r oudlle mnctas) rtau poo0opt ifetldls ulnvpnu4 etnif oy1opDr ueo;s trurxm3nu4aptelnvs s aDumum ;u0teeniieiytlaDrmn s u0 ltnxf tydomDr i i;(0 2ur(o3oy1olt micta(faDumurpot4tptn o3tlt m rl( s t4 eeoif iadopD aivsl( t2uo(mpio1lptelncslsfs2uaxro;o0altomf3iad sDemn sn(0 eeomrctydopDrau ol(0seurio3nydome micsatfa2tru ooo4tetn feild aDul(vpn() ltnmrcoo1oa eau i;t)sexo(opny4ope mfvt (f Dtm(m ou4aeenmfciytfa rl(mpnt0 lerxo3totlptr nei;t srur(m3oy4apt  iesat  rtaurpot0opx mfctls sDemn o;()arenmo3totlmDrlueo;t srurimpiy1al e nvs s)sDum(rono0olenmfctysfaDuanmonu4aetnmfciotopt liei (0truoiopoy4op elnvtls aDtrxrp;o0apeo oetys mDelu o () exriociy1fa   n s t)srumxrpnu1olt lncsltfsruaump;o4apxoifciytlsDua(ms;t4 etnxo tadomDe u s t)texoir iu1opee fcsa( artaxmp;o4opt mocilt m eau s;t0texnmr3tadomtran ol(0seuoxopoo1olt lfcil(fs2umur ou0tptoii3tadfa ulump;(4 eenxo ia1oat ln o;s)t2umir3oodop e ivia(fsDtrump;t1open fetldfs2ul(vo;t) rtnmo3iatla elivs;(  rxoxr oo4open ivsls)srtr( oot4tptnmiciltla ranmo;(4arermfctotfp   i s ( setmxo3nydomen fetlt  Dtax  ot4olxniociytlm2ea( p;t0trxomf3tydfatrlues;(0texrxopoo1apte fctl(faDrr(mont0olen ieiytlaDelnmsnu0tetnif3oo1fp   ivi;(0 eto(r3ou4omtemfvtlsf rrmx pno1oexniiciydfsDeau o;t)arxnmf ty1lp rauvs t0sexmim ny4alen neilsfa2rru p;o4tet mfeiadfsDemnvpnu0 rtoxfcoydomtrlnei;s)sexo(rpio1lle lfetas  2umxmpoo1tpxniiciadfaDuln s;(4 lermf tatla   ueo s  rtoxo3ny1lp nmici t)arur(  ;o1olxomf3tlsfaDem( s;t4 ltnir ootfaD ln i t0t2xmxr oy1optemfet t) 2tm( oot1tlenii3ild aDeau p () leomociadlaDraivs;t0s2xrio3iy1lle mfvs s)s2ua(m oo1oet  o3tysls2rlnvp (0alxnif tydfm eanvs;t0texo(m iudol emnvt t  2umxmpnt4oetnmocils a2rm( s;t4alermf to1omD anvi;()s2xrim oudoleelfcsa( srum( o;t4alenmictldla ea( s;(0treomf3tydoaDrlies s)trtm(m3iydamt  fvs (  Dtr( ooo1oetniictys mDeln snt) lermo oatlm   neslt)texoxrpoodlm n ics sfs2raxrpot1aeeoiictaslm2uln p t4tlxrio3oadopD li ils srxmxr3no4llte ivias)arrmxmooo0apen iciatfa2rm(vpnu4 eerxrciytlmtrlivils0texr(r no4ll elfetls)sDtaxmpou4tlxoiieildls ran o t0 exnxfctytlmt lu i ()s2xrir nu4lleemnet sfaDtax p;u1tpx  o3iltfa2rlnmo;u)arxomo3tytlp  liei (  eumio oydlm elnesls artmxr oo4ope  o3iad m2em(mp u)arxomo3iy1lp   ivol(0 2ur(r3nu4alte iviatfs2rrx onu4tpeomoetas s uaumon()tleoxf3todomteauvsls)setm(r3oo4amtnlnciatfa2rmxm nt1aptniociadfmDua(vs t4 rtnif io1fmDelnvsls0setrxo no1amtnmncsa( srurur ;o0aeeo fcilslsDrmu p ()tltrifcoa1lpt aivo;t0 rxrir3iydoltnmiet s  Drm(  ;o4apeniictad s2ul( p t0trtrxo3oadfmDe u o ()s2xm(m3iu4lmtemietas  Dur(m ;t4olt moetatfs2uanmonu)tlxnxr3iotlaD  iei;t trxm(r3iu1lpt lnciat)a2umu oot1oeeo f3iytfm2rluvp t0 lxnmf3iotfaDe uvs;s) 2toio3iu1om elfctas sDrmurooo0altn oeiyd m2el( ont0arxnmfctatfaD  nesls0s2tmim3nu1lme livs s  rtmu  ot1tltnmfctlsfsDul(mo;t)arxnmo ty1lpD auvs t)s2tr(rpou4lptnmieiltf Dtr( ooo1olt  iciyd m ulnvo;u4 rtomr3oa1faD  uvo;(0srtr(o3oo4om nlnetatfs2taurpoo0apeoifeilt s ea( o (4altrxf oatoa  aieil(  ruoxo3iodlpte icilt  2ra(m ;t4apxn o3iatls2rlu s;t4aleomf3ty1fmDelieslt s2toxopiu4olt  nes s srtmur ;u1aexn ociyd m2emn snu4trtrmr3tydlpteaivil(0s2trxm iy1lltnlfvia()aDtaxrpnu4teeomi3tyd s uauvs t4artoxoctytfate ivslt  2trio3iudapenlnvtatfarraxmooo1olxoifciytls rauvpnt4arxrmrcoy1fateaieo;()srtr(mpiydole  fcsl(fa2urx pou4olx io3tltfmDrmnvont4tltrir3totlmD aiesl( srxr(mpoodome livs sfarua(mooo1aex mictad sDum( o u0 rtrifcoytlmDe neilt trxm(o3io4op nmnetls aDum(mpnu0texnmieiyt m rmumo (0aexrxo3oodlaDr ivols)t2ur(opno4opt  nvs s)aDuaurpno4tltn i3iys a ulumo;t4aeeoxf3oytfmDr u o t  etmxr nu1om n nvs t s2taumono0apxnmfciatlaDumnms;t0 exnmo3iadom raivs;(0seurimpoy4oltelfes (  Durxmont4oleoii3iltla2eau p;t)tetoioctotopt an o ()t2xrio iudop e fvsl(  2rmu ono1tltomfctydfs2uan s;(0tlxnxo tydla ean ilt trum(r oo4op e fci ()artax o;u4apt mieiysfm2uanvs;()aexrif3iytlate uvi;t) rum(rpiodapte nvs t)sDrm( oot0altnioctldfa uan p (4tetomr3todlpt auvi s) ruoim nodol n ivsls)aDrauronu1tltomociysla uau p;()trxoir3ty1fp eaneol() euoio iydoltemneil( aDur(rono1opeo i3tadfm2ean p;u0arxnir iytla e n i;( trtm(rpiu1apt miesatfsrta(  ;o0opt mfeiydlmDrl(msn(4aexnxrcia1fmDrlnesls0 2ur(r oy1llt  ies t arraump;o0aee  octasfaDul(von(0 etrxfcootoatraieils0trtoxmpoydolee feta()arrrxrono1texoifeildfsDumnms u0arerxo3oo1optr n i;t s2ur(opno4opt  ictas)sDra(rpou4texoif3ias aDrauvo t) eermf ia1fpt lu i () rtrir3oydlpenmicsat)sDtauronu4tltnmf3tydlsDulnvs;(0texoio3oodfa   nvo s srxoxo oo4ap   nvi sfs2rau  oo0altnmf3tad aDuau p;t4arxrmo3oadla  li i () rtmio3ny1amt mnes (  2umxroot0tlxo ieiyd aDra(vp t4teenio oytla  au il()sexoxm3iu4am eliei ()srrmxrpoo4opx if3iytlm umn on(4 renxrctatoate i i;t) rum(r3no4omee net t s2raxrpno1altomf3tls m2uauvo t)artoxr3oodfpDrauvo;(0seuoir3ou4ale mfci t  Dtaur ot0aleo fetytfs umu o;u)trxoxo ta1fm  livo;t t2trxrpiudome  fcsat aDrrxmp;t1olx mictas aDuauvpn(0tleomr3oytoaD luei t)s2xr(r3iu1optelfvsat)a2ta(rp;u1apx mfeiadls2uauvo;u) rxnxocoo1fpDraivil(0 2tmio no1lme mfei tf Dtmu  ou0ape mi3ildlsDumn pnt4artrmo iy1fa eaneil(0trxo(rpio4ope  ncsat)sDuaxr ;t1tpt iocildfs2rm(ms;()teerxo ootlat  ies;t)texr(o iudolen ncta(faDra(r oo0olt  ociasfs2eau p;u)tetomr3ootlp eanvo;s tetrxr iu4lm emnvtat)sDrax  no0texo ietlt sDuln o;t0 rxrxocoa1om  an i s0srtmio nodaltemicta(faDtm(ro;u0oetn oetysfa2ra( o;t)artoxf ootlaD auei s0srtr(o oo4lm nlncia()arrm(mp;o4aetoiietadfs uauvo t0altrmf3oa1fpt an ils0teuoxrpnydoltelivt tfs2ta(mo;u0tltnmoeiatla ulu pn(4trermo ty1oatrli i;s0teto(m no1ll elfcsls)a2trumo;t1altoifciad aDran pnt) rxnmo oa1opte uei ()trxrxm ny4lptnmfcta( sDrax oot4oexomf3tys mDeaumo (4arxoxf3totopte i o;t) etrxo iodomt  icia(f ruaxrpno4oet io3iydfmDrm(ms (0 rtrir3iy1laD an s;t0 rxrim3nodoleemncil()a2um(rono4tlxnioeiasls ranvo (0 etnxf3iydomt anei;t)sruoio3iudome  nctas a2rmum ou1oexn iciydls ua( p;u)tlxoxfcoodlpte ivslt0sexoxr3nu1ale  fvi ( aDuru p;o0alxomo3tldls umn p u)aeerxr3io1lmD  u olt)s2trxm nodllt  fvtatfsrrm(r no0teeo ieiltla uan on(4teeoxociadlpD lueols0teto(o3oodlpe lncilsfsDra(m ;o4aee mfetldfmDrm(monu0 rxnxf iydfa eau o;s0t2umxrpnydlpt mfes tf rtr(r nt0tpt  f3iytla rlnms;(0 renmf3io1omt lueilt)t2xrim3ou4lmt  net t)sDua(roou1olx  octytfm2rl(ms;(4tetnxfcoa1oaDe uvilt) 2xmxr3iodllee net sf Dum(r ;o1texnio3tltfm2ea(mo u)altoxr todfaDrln i;t seuoxopoodlleemivt s) Dur(r ou4tlx iictasfmDraumo;() etrxo3iodfmDr i ils s2uoiopny4al   nvsl( arumx  ot4texomfeilslmDuluvont4 rxrif oatfp   uvslt0 etoxm oy4am  lnvi (f Dumu pnt1aeenmi3taslaDel(mont) eeomo3oy1fm ran s s)teuoxm3no4alenmfcilsf Dumur ;u4aeenio3ilt mDeauvs u0 exrmo iatom rlnei t  2to(m3io4om  mivs () Dra(mpot0ope  feils m2uau s u) rxnxf todopD  ueo t)srxm(rpio4om  lfcs sf rtrx ooo0aee  o3ilsfaDul( p (4texnmr3iodfatrai i;s  2trir3iu1llt mict s srtmx pnu1tpe io3iatlm elnmo t0 etrxr3oa1oaDeanvi;s0s2tm(o no1opee fviat  rtmxrp;t4apxomo3ils sDra(mo;u0arxrmo iotfmtrauvsls  exmimpiodlm nmncilsf rtm(rooo0oltomocilt a2rmuvo;u4tetrio oatoa eluvsl( trumxo iodlm emncs (fsDrrur oo4ole  i3iadfs eaump t)areomr to1fmtrau i ()seumxm3iy1am  mfeta(f Dta(rp;t4altn feias m2uluvo t4 ltrif3iytop   u i s) 2toxrpnydam  lncil(f 2tm(mp;u0tlxoio3ildlaDea(vpn(0tlxrif ia1fm e ivo;t0 eumim3iy4lm e nvt (fsrta(m ou4apeoifcilsls2ua( p u0treoio3io1fptraivilt  2tmio3iu1llee nes t)a2trx oou4opx mictyd s emu s u)artoxo to1laDrauvsls)sexmimpoo4apee nct (fsDtrxrpot4oet mietldfm2rmnvs;(4tlenif tydfp eauvi s)t2xo(opoo4amtnlieta()aDuaxrpot4tlx  fctytla2ua(vsnt)artnmocoydomDeauvilt0sexrir ny4lme  fvt s aDtmu pnt4alx mi3iyd a2ua(vp;u4 exoio3oytoateaivs;t  exmxo no1amtemfvtls  rtaxmpot1ole ifetytlaDrmu snt) eermr3iotlaD  nei () 2uo(rpou4apenmnvtls a2tmum nu0tpxomocils mDul(vs t0trtnmr tatomDelu i s0srurxm3nu4lp e fvil(f Drau ono4alt moctydfs rl(mp t4 etrmfctotfmtrlueo t0 rto(m3oodlme livsatfsDrr(m no1apeoiictltls uln o;(0 lerxr3totop rluvs;()t2xrxo oo1omtn nvsltfsDtmxr ot1tltnmieiltfa rmumon(4texomf3oo1fpDeli i t) euoio3iydlmt mneias)srta(m ;o4aptn f3iytls umn o u4trxoir totoateauvsls)tetmxrpny1lptemnvs ( srrm( ono1opx ioeiyt aDulu p;t0trtnmf3to1op r n s t0s2xoio3oydal n fcsatf 2tmxroou0oeto i3tlt mDum(mp t0alerxf oa1lpD  ivolt texo(o iy1apt mfetas) Dtrxm ;t0ape if3iltla2ulumpn(4 rtomo oa1op rlu o;s srtm(o oy4opt micsls)srtrumooo0oetomieils s rln p t)tetnmo3iydlmD ln s s seto(m io1lm  mietl(faDraumono1oet  ocilsls rmu o;(0 ltoxr tatlpt ln ilt0t2toxopno1ll nmicilt sDra(  ;o4tpenmieiydfm rauvonu)alenmr to1lp e iei ()srxoio3oy4ame  fviatf Dtrumonu4oexn i3iasls2rlumpnu0altrxf3totfmD ai o s s2xr(m3iu4omeemies t s2umx ono0tle  ociydfa2ran p;t0teeoxf3oo1lm e ivilt)t2tmimpiy4am  liei sf Drr( onu4oleo f3iydfa rl(mo t4alxniociotlm r uvslt  rxoio no4lpe mfvtlsfa2ur(ro;t4apx mf3iasfs2rl(vsnu)arenif3iy1fmDeaneo ( trxr(opnudlm   nct ( aDumxront0olxo fciasfs em(msnt0 rxoifcoo1lpD auvil()tetmxmpnu1amtnlnesat arurx  nu4tet  f3iltfa ra(mpnu0trtnxo iy1om r nvsls)t2umxm oy4omen netat sDrm(rpno4opeoifetlsfm ra(ms (0tetomr3io1fp   i ol()teum(o3oodllenlicslt)aDrmxmo;u0apt iocilsfa2emnmo u4arxnir3oy1latrau i;t0 2tm(o3ny4am nmnvsls)aDrmxm ;o4oeeoifetatla ra(msn() eeoxf io1oat aneo;s0srur(o3nudlmeelivtat sruaxm oo4tltoioctldls2rlump t0alerxr ta1fatraneol(0truo(o io1am elivtl() 2tmx p;t0ale  ictytls emuvo;()tltnir3tydfpDeaneo t0t2um(rpnydap elneiat  2tmx ont4opxn iciytfsDrmumpn(0 etnmr3ia1fmt luvi (0sexmxo3oy4lmt lnvsat) 2raxmonu4aetoiociyt a2rl(mo;()tltrio3to1fp  lu i;(0 eumir ny1lm n fcs s)a2rax p;t0teeoioeild s2uln s (0 eenif3todla r ues t) etoir3nu4omtnlfvtls) rtrxrp;u0opt iieiltfs ulu ont) ltniocio1fmtelnvol()t2xoxmpoodll nmfesa(fa2raurpnt0aetoioctaslsDrmu o;(0aexrio ty1fp  ln ilt0teuo(m3ou1lm e iesl(fsDuaump;u4ape mictlsla um(ms t4tltoxo3ty1oaDraivi;s0 eurxmpiu4lmt lfvs tfsDumx pot4alxnmoetldls rmn s;(4teerio3oydla rliesls0seumxm3no4op elivil(  rurxrp;o1tpto ociyt m el(mpn(4altomf3iodoa rln i;t srxr(m3nydopeelnctl(  Dtr(ro;t1oleomfctydls2em(msnu) exnxo iotfat au o t t2umxm3no4altn fctl()sDuaxront0ape  iciltlmDea(mon(0alxoiociydlpDr uesls0trxoirpiu4ome  ics s) 2tau pnu1tetoiiciyd mDra(vs t4alxnxf3iytfa raueolt0setmxo3oo1lle lfvt tf Dtr(m ;t1oee mfciadls2umnvp (4 leomo3todfptrlnvs ( texmim3ny1lmt lfetl()sDrm(mo;t4opx ii3iys mDrl( p u0artnmo3oy1om   i o ()trumirpiy4altnmncsls) 2uaxm ;o1teto f3iadla2rlnvpn()aexrmr3ty1lm   ivsls texm(m iu1lpe mies ()s2rmxr ;u4olen i3tldfs2raums t4 rtnir3iy1laDraivil()t2ur(opno1amenlnei sf 2raxmp;t0aleomf3iad s elnvs;()teerxfctotomt anvi;( tetrim3nu4lme mfes ( a2tmumoot0aetn fciysla2umu s;t0tleomr oo1fptrlies;s0setrxm oy1llenlncilsfsruaum nt0alt  ictldfa rlnvsnu4tlxrircoadom r uvsl() etrxo3oy1ol  lnvia() Dtru  ot4ape  feiltfaDum( o;(4 leomo oodfm raies t0sexm(o io4ap nmfvsat  2uaxr ot1ole io3iytfa elnmsnu)teeomocta1lm  aneo t)teuoxrpoy4ap elict s)aDtm(mp;u4tpxo ictld m rm(von(0trtrifctytfm eaueo;( sexmio io1op elivt t) 2tmumoot0opto fetlt sDrmuvsn(4trxnmrciadoaDr uei;s0setmxm3ou4amenmfci t aDuau  ot4alx mf3ilt mDea( s (0trtrxfcoodfmD ln olt)texrim3iu4ole mnvs () Dra(mont4tpe iicildlsDeaump t4trtnxrcto1omDe ueo t)srtoimpnodaleemneil(farua( ont1olxnmo3iys s ua(mp t) etnxr3tydlpt  nvi s0s2tm(mpnu4om nlicsat)a2rmurpnu4oexomfciytlaDranmont4 exnio3io1faD ai s;s0setoirpiu4ale mics t) rrr(mp;o4oltnmf3iltfs emuvo;t)aexnmf3oatoaDeaieols0 eumxr3oo1lmen ivs tf 2urxroot0tptn ieiyslm emnmo ()arenxf oydomD  u o ()seumir3oy1amt mfvta( srrrxmpou0tpxo ictas mDrlnvp t)aeerxfciytlmtr i s s)seurxm3io4amee nvsa( srurump;t0teeomieild m el( o () exoiocoytoatr nei;t texrxopny4ameemicsa(fsDtrxro;u0opxoioctltfs2el(mo;(0altrmf3iadlatr ivi s trxm(opoodom nlici t s2tru  oo4apt  o3iyslsDeau sn(0alxnmfcoa1lat  uvols0seumxm3oo1amtn ivi s)artruro;u4tlxomo3ildfm2emu p t) leoir ty1fatr uvo s)s2xm(o3oy4ll   ieta() Dtr( p;o1aexomfciasfsDea(mp (0tlxnxo3iotoatr nvil(  2xo(r iy4omeemietlt) rtrx  ot0tlxoiiciatfmDuauvpnt4teeoio iytlatrluvo (0 rum(opoy4lltemfcsl(faDtmum no0aet mictadla2um(vp;(0treoxfctydlat lu o;t) 2xrim io4ol nliviasfartaxr nt1apx  ociyslm2umuvo;u)treoxfctotfmtran o ()tetrirpny4lpeemieil(fa2rmurp;o0tpx  ieildfm ranmp;(4tetrir3oa1fptean o;t0tetmxr3oy1am e ics t s2ra( pot1tee  ictytlmDulu s;t)trxnxf oydlp rlu o (0trtoio ou4lmtn fetlt aDrmu pot4tetn f3tad mDumuvpn(4 ltnmf3oo1opD aneo;s trur(m oudoltelfvsasfs2trumpou1opxoiociyslsDranvont) ltoif iotoat  ivslt tetmio oy4op  micsas aDta(rp;o0olx  oeiat sDranvpn(0tltrmo3ootopD ai i;s)tetrxopnydamtemivs t s2rr( ont0tpe mictydfa umu s (4 exrmfcta1oatrluei;s)s2toxr io4lm nmncia(faDum(mp;o1opxoii3iyt a elu s;t4trxriocty1lat  nvo;t0seumxo3ou1lptemnesl()a2ur( pou4tpeomieiaslaDrm(mo;(0arenir3oadlm rlu o () 2um(o oy1ap elnci t)sDtrxr oo1oltoif3ilsfmDemnmsnt4 exnifciy1la e n o s)srur(o3oodlpeelnvi ( srur(m ou1aee ifeild m rluvont4texoxr3oodfatelneslt) rxrio3iudlle micta(farraump;u0tle ii3tatls2eluvpnu4tetrio3oo1oaDe i o s) exr(o nu4am emietlt)a2uaumono0tlx mieiyd m um(mp;t0artrmr ia1op eli s t teuo(o oy1am nmfctl() 2truroot4tpx  ieiad m elnmp t0alxomfcoodom  livs;()s2umir3ny4ap n icils arurxr ;o0opx if3tldfa umumonu4 ltnir3oytop raues;() 2uo(o3io1altemnesl()a2trxmo;t4tpx io3ias s2rmums u)arxoif oadlm rlu i t srtrxo no4al n fcilt srumxr ;o1tex  i3ias m2em(mp;()aetnif to1fm rlu o;()srtr(rpoudomtelnvilsfa2u
\ No newline at end of file
@@ -0,0 +1 @@
+i i;s s2toiopny4ol nlfctls)aDtmurooo0aeen ictyd m2ua(vo;t4 rtnir3iodlpt  nvslt)t2xoim nudomen fvsas)s2uaump;o1alxnmi3ilt sDem(mpnu0teeomo tadopD  i o;t t2xm(opio1ll  livtlt)s2ur(mpot1aeeo iciys mDeln s;u0 rtomo3io1laDe i s s s2xrxo ou1om nmnvtasfarrmumpou1texnioctydlsDemums;u4 reoif3iodoa rauei;s)texo(mpoy1olenmfci (fsrum(r no1alxo oeildlmDulumo u4tlxomo3to1opDe n i s0truo(o3iydomen iesat) Drru p;u0aetnmi3tldfsDrm(vo t0trxrxocoa1fm rlues;s)trtoxmpnydoltnlncias  2rru  no0ole iietltla rmnvo;u0teerxr iotfm   i o s0 exm(rpio4apenmnct t aDrmuront0ale  oetls s eau o ()aexoxr oo1fm   nvs t)sexr(opoo4altn ivil()a2rrx onu1oet if3iys a rlnms;t0teenmr3io1lpt li slt0srtoxm oy4amtn netlt a2rmx ono4tee  fcils a2ul(mo;(4aetrio3iadfa eln i;()setrxo nodalte ict s)sDuaurpoo0opt mociatlsDeaums u4tetrmrcia1lpteaues;s setoxopoy4optemivsat  ruau poo0alxo i3iadfmDulnmsnt4aetnif3oodlmtr nvo;() 2xrxmpny4lpt mfetls s2rm(rooo4ale miciys a eanmo;u4arxomr tadlmt aivo;t0srtmxmpoodlpeemncils  Dumxroot1oleoioctadfa2rl(vsnt4 rtrmf3tytopt lnvo t)trtmxr iu4lpt  ietl(fs2rmx ooo1aeenio3iadla2em(ms;t4artriocoydopteaiei t0 rxmio3io1apeemiesatf 2ra(rp;u1apx  fctyslaDrm(vp t) reomo iotlaDeaueo t trxoxo3oydomtemfeia(fa2umu  ;u1tee if3ildfa el(vo u4aleoxf iodlmt aies;()setmxr3ny1opee netlt  rua(  no1oeeoioeiasls elu sn()teenif oo1late uvi;s seuoim nydllt  net ( a2ta(mp;o0aetomfeiat sDuanmp;u4tetoxrciydoptelnvsls0s2tmim3oo4ame lncil()sDtaumpnt4aee ifcias m eau o;u0 exnxr oytfp eaues;t) rtm(o3io4al nmfviat)a2rrum no0optoiieiys m eau p;t4 rtomf oy1fp  aneo s)srxm(o io4omenmfvtls) Dtru  ;o1oexo f3ias a rlu snu4trenxrcoodopDe u i;s setrir3ny1lpeelnes sfaDtaxmp;o0tle  oeias mDeaums;u4treoxf3ty1oat  u s;s)s2urxr3oodop   fctl(fartrxronu0oee iiciytlm2emuvont4teeoif iotopt livilt0srxrxm nu4ll e nvil( aDuaxro;t0tetn oetyt s eanmont4altoxr iodfm rlies;( seumirpiy4apte nes sf Drmxmo;u1apt  feiadfaDelumsn(0aexoioctytfm  anvo;s)teuoxo3nu1om   nvt ()srrmxr no0tlenmictyslaDuau s;u4alermr ootopD lnvil(0trxoxr3nodol e netl() rumu  no4apeomo3iasfm2emuvsn() lenxf tadla r u ils texmir3iu4lpeemiei () 2tmumpot1oleniictlt a2eaumonu0aeerio3iytfm  aivo s)t2xo(r no1lpee fctl()aDtm( pot4opt mf3iydfm2um(ms;(4artrmo3iydfm   nei;() 2ur(mpio1lptn ivilsf 2rm(mpnt4ape iieiadfm rmu s (0trerxocootfpDe nei;(0trxmim io1am e fei s) Dum( pot4ale mo3ild sDrl(vonu0trtnio3ia1laDe ueilt0 eum(r3nu4lp n fciltfaDurumpnt4optnmociltlm2elnvs;(0teeomo3ia1faD  uvil(  etm(mpiydlmtn ivia()s2uaxm nt4aetn fetydla ulu s t0tlxrmrcia1fmDrln s t)trtmio3oo4aptemivi (fsrta(rpou0apt  feils a rln s;t) rxnmr3iatoa   nvo;t0srxrirpoo4ape  nvsltfsruru  oo0alx mfeiyt a rm(vo t)arerio tydfpDrluvs s0 2ur(rpnudlptemfeilt)s2tmu ont4tex iieias s ulums t0 exrio iatop eaieo;s) 2um(o nudamen feta(f rumx p;u1aetn ieild mDrmu pnt)texomf3todfm raivs;s0s2trxm ou1lmte nvtatfs2um(rp;t0tptoif3iatls2rl( s u0altrio iatfpDr neo;s) rurxo oo4lmtnliesl()aDrmuro;o1oetnmfctadfs2elnvont)artnxoctytfptr nei;t)setrxr3ou1am e fes t aDta( p;t0aet  ictadlm2rmump;u0trxrir iodoatrlnvils0t2ur(o3iu4lmt mivtasfs2taumpno1tpxo iciasfs rau o;(4tlerir3oodopt  ues t t2xr(m io4lpenmfesl() 2ur(r ;u4apx moeiltfaDua(vs;u4tltrxr oy1fpDeliei () eurxo3iu4lmen nei (f Dumu poo1apeo oeiltfs ea(vpnt4aeeoirciodoaDe n il(0s2ur(r3oydlmtelnctls)s2rrxrp;o1alx ifcilt mDranvp;u) etoio io1lmDe ieil(  2tmim oodaleelivta( sDrm(m ;t4tlt io3iyslaDelu s;(4 lxnmo3io1lmDelieo;(0 2tr(r ou1opt  ivta(fa2urumpoo1tlt if3ilslsDea(ms;t4trenmr3tydomt ln o ()srxrxr oodopenlnctl( sDuau oou4aex moetyt m2rauvo t4altnmrciodlpDraueil(0trxoim iodopenmicias)aDua(m oo1alto f3iydls rl(mp;t4trenio3iodfmtrluesls)texoio3ny1al nmfctas a2umxrp;t1apxnii3ils a2uanmo;(0trxomocto1lmDranvi () rur(o3iu1altnlnvias a2tmxrooo1tee ii3iasls ranmon()trtnir3oo1faDeaivols) 2xmxo io4opeemnvt s sDururoou1aetnmo3tas sDemuvont0altrxf3oatfatr ivols)t2uo(m oodop   ies s)sDtaur ;u4tpeo f3ilsfsDem( s;t)arermf to1oa r ieol(0trxo(m3oo1am  mfeta(  Durur oo4tlxoii3iatla2ean on(4 renxrciotomte n o t)srurim oudop  lieia( aruaumono0oet ioetlsfa rl(vsnu) reoxfcoy1fate uvs;s)t2urxopoodlm e fcia(f rurumooo4tpxnmfciys s em( o t0tltnio3tatlpte u i;( srurirpny1om e iesat  2tmu o;u1tex  ieilslmDeluvsn()teermrciadlpt  uvol()t2trxr nydale mneilt)arurxrpoo1tlt  i3iydfa2umuvp t4 eeriocty1optelivo s  euoirpnodlltnlnciat)s2tmx ooo0tpxnmo3tytfm2uln s;u)texnirciy1lat li i;t) rum(m3iu1openlfeiat)aDur(mpot1tleo f3tydfm el( o u4 etomr iodfmD ln i (0sexrim oy4amtnlivi (fs2trxmpnt4alxniieiyt a rln s;()tlxoxfctodfmtr n sls) rtr(r iudap elfvs (fs2rrxmpnu0aexoiociysfa2rau s;t)trxnmr3iodomtrlivsls s2uoio ny1aptnmfvsasfsDrrx p;o1tpe  oeilslaDumuvpnt4alxnio totopteluvol(0t2xriopou4ol nlictatf 2tmu pnt1apenif3ilsls2eau s;u4areomr3oo1om   uvi s)truoirpiudal  livtl(fsDtrxrpno0tpx mfeiltfsDrmumo;()tetrxfciytfpDraies;s0srtr(rpoo4olen fct t a2taum ;u1aetomietadfm2ulumo t0 lxoxoctotomDrauvsls)seurio3oy4alee fcsasf 2uau  ;t4tex ioctys a2rmn pnu4tltnmo3iotlp rluvolt)trtoxopoodlmee fvt s) Dtaxr nu4aetoiocilt m ulump;u0tlxnmo oydfptelivi s) rtrxm3oo1ale  nvta( artr( pnt1tlxoiieiasfs2ua(mpnt0alermo3to1fateauvol(0texm(r ou1omteliesatfs2urx o;u1oltn o3ias a uln p u4 rtomo oatfatrau i s0trtoim oydoltemics t sDtm( oou4oexnmo3iad sDea(vpn(4alxnircoy1oa eauesl()srxrim3ny4amt livias  Dua(rp;u4tltnio3ildlm uanvon(0alxnircoo1lp rln s;( teuo(m3oo1lm elfvsas) rur(r oo4tlen o3ilslmDuln o;t4aetnmfcta1op e ies s) rxo(r3oo1om n neils  Duaxmpou1olt miciatfa2el(ms;t0 rxnxr iatoa eau sls srtrxm ou4al e netlt arrau p;t1open fetyd s umuvont4aeerxocootopteaivo ( srxoimpiu1lpenlfvta(f rrmxrpno1oltoiicildlmDrau o;u4altrxr3iy1lpDelneils)t2xoxr iy1lpee nvslsf 2tmxm oo4tle iieilsls rau o;u4aeermr oadlmDraneilt0 rxmxo3no1lp nlnci tfaDrrurp;t4oltoif3ilsls eaumo;u4alxnxfciodfa elivs s trxoio3oy1lm n ieta(fartax pou4oltomociyd a2rl(vp;(0 rtomo3oo1fm rau i s  exrio oodlmtelnesl() rurx onu1opx mi3tld a2eauvp (0 renxo tadfa raiei;s  2xmiopnu4ll e iviat)aDumuront0aex  o3iytla2rm( ont4trenxf ta1la raivsls) eurxr3io4altelfvilt a2uru pno0teenmf3iys aDulump t)alxnxocoy1omt li i;t0 euoxr no4oleemfvtl(  2tr(m ;t4tleoio3tat mDul(mo;(4aeenxo3ty1optrluvi t seumxr3io4ll nmnct (faDta( poo1tetniieiysls ranmon(0artrxoctadlm raiesl() rxmxopou4al nmiet (f Dtmurp;u0oexomoctat m2rmuvp;u0 eeoio ootoa rlnesls0 etrxr no1ol nlictas s2ta( o;u1ole  f3tysfa ulu pn(4areomociodfm  lieolt0trxm(mpiudlm  livi sf Dumx p;o4ole mfeildfmDem(vp;(4 rxnifcootla r neol()teurimpoo4lmt  fci (  Drax  nu0tpto octadfa2ul( pnt4 lenifcto1faD lu o;t0sruoio ny1lpt  nctlt s2ra( ooo4ope ifeiydla rmu o;(4 rtrif oydlm elnvsl( t2toir oo4ale mfet s a2rmxroou1tpenmo3iydls uanvs;u0treomr3tytop eluvols teuoir3oydalen fviat sDrau pnt4tlto oeiysfaDranms u)tlerio3ia1oa  lu ilt  2tmirpiu4lleelfeil()aDuaxr no1ole  f3iat m2umumo t)alxrxfctytfpD  uvslt0s2xo(r iodaltnmfci ()a2rm(  oo4teeomfeildlmDulumpn(4trtnmr3ia1fa r ieo t0sruoir3oo4opt lfcs tfs2ra(mont4altomo3tydfa eln s;(4artnxocoytlmteli s;s  2tmxm3iodlmtnmfvtltfarumumpnu0aetoio3ilt m2um(mpn(0aleoxf tatopteaivolt) ruo(opoo4amte ici (f 2uau  ;o0tltomfeiys sDelu o u0alenmocootlmt  i i ( srumxo iy1ap   fetat aDua(rp;o0apt mi3tld m em( p t0 eerxrciotfp  lnvi;t tetmio nu1llenlfct s  Dtru  ou0tpe  fciasfmDua( p (0alenir oa1op rli i t)t2uo(opou4ome  ncslsfaDtmxmpno4oetnmi3tlsfsDrlu on() rtomo3io1fa  lu i ( teuoirpnydome mnesl() rrmumo;u4tpeomfctadfmDea(mo;u0altnir3oo1fa raivo t0s2uo(rpno1openlivsa()sDurxrp;u0apx mieiys m ulnmonu4aeerxf3oo1omtelies t srxr(o nu4lp  mfctlt)aDum( p;t0oex  ociys mDraumo u)aeerxocoytfpDelnvi s) exrir3no1lp n icil(f Drm(  nu0apx ifcilsfa2uanvp;()alxnmr3oy1op  anes;s0srurxm3iodamenlnctas s2raurpnu0aptoioeias s2rmn o t)aexnmr3totfmDrauvil(0 2um(opiydlp n nvia() rrmx p;u0alxnioetldfa ranvp;u)artnio3oytom  ai s t  2xm(rpoo4altnlfesa( srrmump;u1apxnii3iltlaDeln sn()alenio oa1lmtr n olt0trtm(r nodale lici ( sDrmurp;u1texo f3iat s2rmuvs u4tetnxrctydomDe n i;s)t2umxo3nodale  nvt t s2rrxr ;o0tlt mf3iysla eaump;t)trxoxr3oatfmt li i s t2trxo3io1lmtelnesls)a2umum no1oleo oeildlm2uluvsnu)texrmf ia1opDrlueo;s0 rtm(opoo1ape mfvsls a2rru oou0apeo oeiytlm2rmumpn(4arerxrctydoa elu i;s)seumxopnodlltemfesas artrurono0alxnioctlt aDemuvon(4 rxrmo totlmte uvs t  2xm(m3iudlp e ietls  rraumpnu1tetoioeildfa2rlu s (4alenxfcoy1faDrau i;(0srumxm3ny1olee ivta( aDraxrp;o1tlt io3tat a rlumo;u0tltomr oytlpt  ies (0t2tm(r iu1amenmiei ()s2ua( poo1apxo f3iytlaDrm(mon(4teenxo ia1oaD  nvil()s2umxo iu1ome lnvt t)arum(rono4alxniieildfmDuau s;(4tlxrmr oydfp e nes;s0srtmio ou4optnlncsls a2taurpno4teeomoeiadlm eaumsnt)texoiocoytfpDelueilt0 2umxr3iy4am e ivs s  rraxrp;t1aetnii3iys a emu on()tlermrciy1fat ln s (0s2xoxmpno4oltelnes tf rrr(  nu4tetnifetad sDulu pn() rtrir3iydomtr ivil(  2uoxm3oudoptnmies ()sDumx  ou4oex  ociadfaDrlnmo u0alxrxf iadfmDrauvo;()s2urimpnu1altemfvt sfsDrrxmono1alt ioeiadfm2emnmo t0 rtoxr3iodopDrluvol()setm(opny4om emnesa( a2ta( onu0tee ifciaslm2ulums;(0treoxf3to1lp r uvo;t)t2trxr3nudllen ivs (fsrtmx  nu4opeomictltfaDuau s;u)arxnmo iydoaD  n o s)tetoim3ny1llt lics tfaDur(  ;u0tpx mi3iyt s ul( s;u4 leoxr totfpD livsl(0 2xmxrpoodopt lnes s s2rr(m ;t0oex  o3tat s em(mp;(0trxnmfcootfaDe nvo;t0teurxo ou1aptemneias)srua(root0opxoifctadfaDumnmpnu) rxoxo ootla elneo t trxr(m oo1al emneiltfaDuaxmpou0tptomf3ildlm uaump u4altoircto1fptrln o (  2trxm3iudame mneil(faDuaxmooo4opt  ictlt aDeauvo t4aexnir3ty1lmDe n o () rxmxr nudol elictls a2ua(rono0tpxo ietltlmDrln on(0tltnxf iotfptr i s;s) 2umxo3no4lme mietatf Drrur ;u1oexoiiciyd m2rlnmp;u4tetnif3iydfmDelu i t s2ur(r3nydaptelnesasf Durxm ou0aleniictas m2eluvp u4alxomf3ty1fpDeai i;(0 exo(mpiy4openmnvsa(  2uaur ;o0apxniicilsla2eluvs;() rxrxf3ta1laDr iei;t0t2ur(opou4optn icslt)aDrr(mpou1tlto f3ildfa rluvpn(0altrir3iadfp eaies;s) 2xmxo nodlltemfei sfsrtaur nt0opeo oetat m el(msn(4teermo iy1laDeaues s tetoxm3oydlpe  fviltfaDuaurooo1olxnmoeiadlm2emnvonu4 rtrif totfmtean o s0 exmir3io4olt lnciatfsrrau o;t4alto ietysfs2ua( p;t4areoio3totomteaivs;s0texmxr3iy1lpee neils)a2raum no0optomi3tad aDum( pn(0teeomo3iytlpt li o () rtmxr iu4oleelfcia()sruax  no4tex ifeiadfa umn s (4 eeoif3iatfmteaivs;s  etoxr no1omte nvtat a2um( p;o1altniiciad sDrmuvp;()teeomfcoa1oaD  ivo s0t2uoxo iu1lleemnei s) rrmurp;u1tlxo ociys s ul(vo;(4 rtnxfciydfp r ieil(0trtm(m iy1lp e ictl( s2ua(rp;u1tleo ociadfa ea( pnt4 rtnmrcta1lp e nvsls0srum(r nu1lmeelfei tfs2ra(rpnu0altn fciadlm2rl( pnu0 ltnxo3todop eliei s0 rum(r io1opeelieil() 2tru poo0olto ictltfm2rl(vont)tlxrxociytoa eluvilt trtrxo oudlltnmict t s2tmxroou1tpxnioeiydfs2emnvo (4aexnio3iotom r nvo;t  ruoxopoudome mfcsasfarraumpno0teenif3tys sDua(mp u)texoxr oydfmD  i i;t) rtmxm iy1amt  ies (  2umxr ;o0tet ifcilsla eln on(0 etrxr tytlat ln s;t0trtm(o no4apt mnvtat)a2tr(r ot4apeo feiltla2rmu o t4 rxrxr3to1fmD  n i s srtoxo3iudlmt mivils)s2ua(rp;o4alen fcild m2ua(vo;(4tetomf3oatop e n i (  euoxopiy4ame livsl()srrrx o;t1tetnifctld s eaumsn(0tlenmoctodom elieo s  rxoim nu1openlfes (  rua( o;u0oee  oeild sDua(vpnu4tlxnmrcoa1lp  lnvo (0t2um(rpio1op e net s  2rr(rono0olxnmiciasls ua(vpnu)altoxf3oy1oat lies s)s2xo(m nudll  liviat)s2rmx o;o4tlxoii3tat mDul(ms;u0tltrmr3io1lp r n il() eumim oodamtn fvtl(  rumu  ot0oee  i3iysfs2ul(vs;t)altnir oadom   neils) rur(m nu4al emnci s aDtaxm ot0apenio3iadfs2umnmpnu4aeenxoctodfm rai o;s)t2uoxopou4lle  ivsls)srurx p;o4olxnmf3iadls rm( pn(4altrxociy1fpDelues;s0setm(m oo1ope micias)arra(r nt4olt ifeilslsDrlnvo;(0arxnmrctadoa rlu s;()trtoir oydlm n nvi tfsrtrum nt1aex mfctlsla2uauvp;u)teenmo tydfatran s (0srxmxopnu1am n neiatf Dur(m nu0teeomoctasfaDrm(msnt0tetnmrcoa1lptranvo;t s2umxm nydal  lict (fa2rrxroou1aee mietydlm rm( s (4tltnmfcoy1laDr uvs (  eum(mpoo1ol nmnvi sfsDrr( pou1tptoif3iltls2ea( ont0artnmfciodopt  nei;(0 eurxr3oydlmtnmnetl( a2ta( o;o4tpxnio3tyd sDeanvon() rxnircoytlpD lu olt)s2xm(opnu4apee ivsl( s2rrur no1tptnmfctld m2elums;u4artnxo3ta1opt  uvi;s)s2toio3oo1apen ivia(fsrrm(mo;o0olxomfeils mDemuvs u)aetrif3oatfpteaivs ( s2umxopiudop n fciasfaDtr(r oo1opxomf3tydla ra(vpn(0 exrmociadlmtean i ( sexmirpio4op n icsasfs2tmurpnu0tpxn fctysfs2rl(mpnt4 eeomo3iy1fpteanvo;(  2xrimpny4om emfvsas)arum(m ;o4tlxnmfctlsfa rl(mpnt0 rxoxocoatla rau i ()srxoiopnu1om elnci t  Dumu  nu0alt ii3ild m2ra( s u4 lenxf3iydlateln il()teumio3oo4llt  nvs s)sDtau  ;t1apenmoeiydla2raumont)trtnmrciydfa ranvo;(  rxrxmpoy1apt mfcslsfsDuax onu0apt if3ilsfs uaums u4trxnxfcia1oaDrai s s sexrxmpnodoptemnct s a2ur(r oo0tpeo oeiys mDranmpnt)texrmr3iadopD auei ()srxrim3oudlmtelnetls)srrrumonu4aetnmfctadlmDelnvp;u4tlxnir3oy1lpDr uvsl() 2trir nodlm emivil(fa2umxrpoo0tlenmoetld s um(ms;u) ltrxr oydfpDrluei;t0trto(opoudopen nvsatfa2rr(  ;t0aexoio3iadlmDelumo () rtoif oadlmD  ies;t0 2xm(m iy4ole micsls)sDtax pno4apenio3ilsfs el(von(4 etoxr3oa1lm r u o ()texrxr3no1lltemivtatfs2ur(mooo4oexnmietltfa emn p t4alxoxo3ta1opD luvi;(0setr(mpoodom e ncias)s2umxro;o1aex ioeiyslaDra(mp;t) rtrxocoodfp e ieo;(  rtmxo3oy4ol  lfctatfaruax onu4aeen o3tasfsDua( p t)texrxr3to1op raies;s) 2tmim3iy4oleemnet tf ruaxmoou0apx ii3iadfaDel(mp;u0artnmocoa1fpte nvo ( srumxr oodlptnmneils)s2tm(r nu0ale  oetydfm ul( s;(4 eermf3ty1lpt  u o t0s2xmxr iu4olenlfet (f rtru o;u4aeenifetlsfa rm(ms;(0teeoxr iotlmteanvsl()trxoxr3nu1amen ivsl()a2um(roou1opxoiietyd a rmn p t4arxoxo3oy1lmD aueil( t2toirpou4am elfvsa()sDuax o;u0aptn f3ildlaDumuvon(0 rxnmr3oy1opDr iei s) 2tm(r3ou4lp  lict ( s2urx ono1alx iociltfsDrluvp;t) eeoif ia1lpDeln i;s)trxoir3oo4lp emnvs t sDrm( oot4tlxnmfeiltlmDul(mo ()texomr oodfmDelu i s  rtmxr3iydamtnmfvils)arrrumpno1tpe  ieiytlsDuluvsn()artoxo3oatoaDe nvs;s)srtoio3iy1ame mfetlsf rtrx  oo4opxo iciyd aDumnvp;t0aeerxr3oa1oa  lnvi s  2toxm3iodomt mnetat) Dta(  ;o4tle mfetatla2ran pnt)tlxnmr3oy1lm  li ilt  etr(o3nu1ll emictas srrrxronu4tex  octatlaDuanmon(4 lerirctotlm e i s;t0t2tmxo3oudlpe lfvs t)aDrmxr ;t0tle  iciyslmDuaump ()tlxrif ootfptean o s) etoimpou4apt mies t)aDtau pou0tlxoifctls a rlumpn(4 lerir oa1lmDr iei (0 2xmxo ny4ame  fvs ()aDum(moot1oexomf3tlsfa elnvs;(4tlenif3ty1fm rai o;s  2trxrpiu4omeemnvi ()sDta(mp;t4texo f3iyd m2eau p u0 renmo iy1oaD  uei t  2xr(o3oudlm n fci t)sruaxr oo4alt if3ias s ulump u4 rerifciydoaDrlu s;(0texr(opnudlme  ivta( sDrr( oot1aeeomi3iydlm eaumont4tltnmf3tadfaD  iei;t0trto(r no1om  mfvs ()srum(mooo4oleniietysfmDua( s;t) rtnif tadfmD  u i t  eurir iudlme lieias)s2ur( pnu1tpe  ocilsfa2em(vo t) etnmrctatoptranvilt  exr(mpny4opt  ivta(f 2tm(mpno0tee iiciys aDumumo;t0 exnir ty1fpDrai s;t tetm(r3iydllt lnet s sDta( poo4tpxoiietlslaDua(vpnt)tetnxo3oa1omteluvol()seumxmpnu1ol   fvs (faDumur no1oeenmociasfmDua(mpn(4 rtnif to1opt aneolt0t2triopnu1lltemfcslt arta( o;o1optn o3iltls umums;u0 lxoxo oodlpte nvs;(0sruoxr no4oltnmfctltf 2umxronu1tex ifctldfm2rlnvs;(4trerxr oodfpD ai o;()srxmiopiy4ll  lfeilsfartru  ;u0alxn fetadlsDrauvp;u4tleoirciytfpt anei;s tetrxm ny4om   ncia() 2umumpoo0tleoifciatlsDrmuvs;u)trtnxrcootfatrli s t trtmxm nydomenlnes ( srrax ont1oex ioetlt aDrlnvo;()trtrmo to1omD lnvslt seum(opny1ope lneta()a2rmumo;o0oeenifeiytlaDrl(mo () lermrctodoa   nei (0 2tr(m nydll nmfetlt srumurp;t0oeenmiciat s2ul( o;u)alxrxf3tydfatelnvs;t  2xmxm nu1lmeelncia() rra(  ;o0tpe mfetytls2rlnvpnt0 lerircoa1laDelnvs s)t2trxr3nudomtnmneilt aDrr(mpoo4altoioeiytfm uanms u4tlxomf oa1lm rlu sl(0texmio3oodop e fct (f Drmxro;t1aee  f3iydls2uauvp;t0altnifctatlmD anvs s0t2toir iydolenlnet sfs2ururono1tltn ietltlsDra(vp;(0arxoircta1la r nvolt  2xrir3io1lpte ncsltfs2rr(mooo4oex mi3iyt mDrmuvsnt0altnmo iytfpDe uei t0 2umxmpiodapte fvs ( sDua(r ou0tptn octytls eau s u0trxrirciotfpDrau i s0sexo(o oudol  mnvs (fsrrmxrpno4aetnif3tysls rl(von(0trtomf tytfpDrluvo;t  2tmir3oydapeelfcs t)sDrmu oou1oetniiciasfs2rau s (4 ltnir3ia1fpDelieils0sexrim3iy4ame livsl(  Dtmxro;o4tpxnmi3ils aDum(ms t4tltrifcoodom  anvo;t0trto(mpou4lpee ieilsfarrrx  no0altn fciytfs um( s;t)aeermr tatla r ivi;(0trtmim3oydomt liviltfaDum(rpno4oexniieiat s2ea( snt0 rerif todfp r ueo;s0s2to(o3nydap e neia() rtmxm ot1tpx ioeild a2rau s;(4alenxrcoo1lp elnvslt)texrxopou1amen nvta(f 2tm(r ;u1aptomieiadla emn o;(0texrif tatlaDrln s t)t2tmir oy1ameemiet s a2ur(m nu1aexn feils a ra( s t4aleomf3iadfmD li ils0seto(r3oo1opeemneta( aDrr(  nt4tpx  f3ilslmDrl( on(0texrmf tytomt aivo t0srtr(rpoo1ame mfcs () 2ra( pou1aexnmicildfa ul(vsnt0tleomo oy1lp eauvil(0srxm(r3nodlmee netas  2tm(r ;t4tee mociysfmDuln pn(0texnxo iy1fmtr ivi s  exrxm3nu4lltnlivtat)aDtr( ont4ape mocilslm2ul( o u4 rtnxf3ia1fa rai i;(0teumxm3iodam emieil(  Drmxrp;o1texnioetlsfs el(monu)trxoxo3ootlptelues;s  2tm(r3iodal emnct (fa2umx  nu1teen fctlslaDulnvo;u)aeeoxo iytlaDeaivol(0srxrim3nudapenlnes ( sDtm(  oo1tlxomo3tys m2ra(mo (0trtnirciytom elneslt) rtmxr3ny1lmeelnet tf rrmx  oo4tlt  oeiadlaDel(vs;()aetnmr ootfm elu i;s sexoim3iu4am  mfeil( srtr(m ou1alx iociydla elumo (0teeomo oytlpDe nvsls0sexo(rpnodap  liciltfarurxrp;o1aeeoiiciaslmDrauvp;u0aeeoifcta1opD luvi (0s2xrir nu4al  mfvsl()a2ta(r ;o1teeo f3iyd a2ra(mo;u4aexriociotlmtrlivo;s)truriopiu1llte fetasf 2rrum ot1oee ifeiadla uln snt0alenxo ia1fmte nvs;s)srtrxo3io4al   netat sDrax o;u1ale mfctlsfm ulu s (0 exrxr oydlm rluvo t) exm(r3nydlltelfei t)srua(m oo1tlt iieiad mDem(vp;t) eeoirciydlpDrauvils t2xrxo3io1lme lfvil(fsrum(mpou0tpto i3tltlsDea(vsnt4tetrio3iytfpD luvs s  rurim oy1ap nlfet ()a2urx oou1opto fciasfaDumuvo ()tleomr3oadlaDraivo ( s2toiopoydapeelfet (fa2rmur ;o1apto ictadfsDeln s;t0arxnxfctatop eluei s0s2uoxm3iodolen fct t aDtmxr nu4aee ii3tad sDulnmp t)tleoxr oo1la rlnei ()t2tr(m3iodamtn netlt aDur( pnu1optn f3tatls2em(vs;t4areoircootlaDeaneol() rtmir iydlp emnvtl( sDtrxmoot4oltn ictatls2rlnvsnt0 reoiociadfmt liesl(0sexm(r3nudomt lici ()s2um(mp;t4olx  f3iadlm elump;u0alenmf tatopDe i ilt)s2tr(o oudop nmicsa(fsrtaur nu0opx  o3tatfsDrlnvsn()altoxr oytfp rliei s0texoxo ou1ol nlnvs t) 2rrur ot1texo fciltlmDulu snu4aetnxr3todopDrlnes;( srumxo io1op nmfviltfsruau  no0tpeoiiciatla2uluvp t0 exrxfcia1lmteauei (0 etoxo ny1ale  ieslt)srtm( pot4texn o3ilsls eanvo;t4trerxr3ia1opt lu i s)trumio nu1apte ivs s) Dtrxrpnu1oetoifetad a ulump;t)aexomociy1fp r n s ( srtoxrpiu1lptelnvsat) Drmumoou0olxnifeildfaDuau s (4aexoxr totfm e ueo s)srum(o iodoltn feils)sDtmum oo0oetoif3iys s ulnms;(0 rxoxf3iotfm r i i;(  etrim3nu4apen fetlt)aruaxro;t1texo f3tadls2umump;u4texrio3todlaD  ies;t)t2xo(r ny1lm n ici s) rtr(mpoo4opxomoctyslm2emums;()artrmr3iatop  aiei t0 rxrim oodop nmnvtl(f rta( p;t0aexomfeiltfs ulnmpnu)tltniociadlm   n il()srxo(o3io1lpeelfcsa(faDurx  ;o1alt mietls sDrl(mp;(0aetrmrctadfpt lu ilt)sexm(r oy4lm emnvsl()srrmur ;t1tetnmi3iltlaDumn s t4 lxrxr3totlmt li o;s0 2xmimpny4lmt livsa()sDum(mooo1olto i3iysfa rlumonu0 renxrctatfm raueo;t) rxrir nu1al e feil( a2umxr oo1oex moctytfmDumumpnu4teeomf3oytoptrli il( trum(o3no4lmtn ics sfsDua(m nt0teen ieiltfaDumumonu4aeenmf iotfaDr i i;t)trtrio iy4lle mnvtl(  Dtr(ro;o1ope mfeiat aDelu pnu4 exrmo3ootlmDeluvi;()srxoirpiy1ll emnvs ()srrau oou0oltnioctyt a2um( p;u4tlxomf3ta1oa e n ol(0 2tm(rpiy1omtemfciltfartm(  ;o0oeenif3iyslaDumuvs;t4alenmf3oa1laD  ivs t) 2xrim3ou1lme mfetls)sDta( p;u1tpxoioeiyt s ea(vs u) exoxf3ootlm elnvil( s2xoxr3ny4amtnlicil()sruaxr nt4oexniieiydfm2emu s t)artrxf3iodfp rlivo ( trxmxo nu1llt liciasfsrum(mooo0tptn fcildfaDrlu s u0altoxr iadfp rlivo t)sruo(opno4om nlfvil()aDrm(rooo1apenmf3tyslm2ranms u0aetrio ty1fmt  uesls)seumxm oydope mncsl(fsrum(mpnu1oetnmi3iasls ua(vs;t) ltrifciadla rlnvol()sexr(m3ny4ol   icilt a2raurpot0teeo ieiydfaDuluvo;(0texrxrcoytop eaneslt  2tmxo3oodamtemfeilsf Dtmxm no0olxniictltfa2rlnvsn() lxrxf3iytoaDeln s;()srtmxopiy4opee fcsls  Dtmurp;u4alx  octls m2ua(vpnt)aeerif3oa1fp   uvsls0srxmxmpio4lltn fetas)a2ur(rp;o0teeo f3iydlaDrluvont0tleomo oytlmtrli i;t srtrir3nudlm nmfcsa() rrrum nu0teeomiciat s rm( o (4alxoircia1omD  ueo ( trxrir oydolen ivtas s2raump;o1oltn i3iltlsDean o;u4 rtrif iydfate ues t) rtoio3iy1al n nctls)sDrm(mooo4texnmi3iysla2ranvs u)aeeoir3oytfmt auvsl()setm(m3nu4llen nviltfa2uaumono0ope ii3iydlaDuln pn(0treoifciydfm rauvol(  rurir nodalenlfcsa( sDrrx  no4ole mo3tat sDrluvs;() ltrif todlaD ai sl()setoir io4om nlfes t) rrr( poo1oetnmfctltla eaumo;(4artoxo3oo1fm eau o;s0 2tmxopny1altn ncia( sruru o;o0altoif3tatfs ra(monu0alxoxo3iotop  anvsls trur(o3io1omt mncilsfs2umx oou4teto iciad sDrmuvs u4artoif oydfmteauvi;() 2urimpio4am emfciltfsDtmurpou0tptomiciaslmDua(ms;t0 rtniocoatfp   nes;(  exo(r oudlptnmnvsls)sDtmumpoo0openiociydls2um( o;u) lxnircta1fpDelnvsl( trxm(opiu1olte iviatf rrm(rpou4aleoioetltls2ul( p;u) ltnmo3iadoateai slt0 rxo(mpnudlme  ietasf 2rax p;o1tpeomfctadls uaums ()arxoxr todop  ai i t  rxoio3nudolt mfet sfa2uru oot0ope  ictldfm2raumo;u0tlxnifctytlm   ivolt)srxoxo ny1lltemnct (faDrr(mooo1tpe mociydla2rmnvp u0aetoirctytlp   iei;s srur(o3io1ap  mfvs t)aruaum no0openiietld s2rauvs (4artnxf io1op r ueo;s tetmio oy1lme  nci sf 2ua(mont1opx ifctlt m2emn on(0 renifcoy1opt lneo;t)trxmxopoy1alenmnvt () 2uru  ot0tpxo ociadla ua( p (4tleoxo tytlm raneil(0seuo(m iydlptemiei s srrrum no1tle  fctysla2ul(vp;t4arxrmr iodfaDr ies s srtrxo iy1am nmncs s)s2ta(mooo1oee  f3iyt a rmnms;(4 rtrxo oodlaD auvsl(  2urimpoydaptnlfcsl(f 2tr(rono1aet ii3ias mDul( s;(0aexrxf iodom eai i;t0s2umxm3nu1lltnmnesa( arrrxr oo4oleoiietadfa2umuvonu0 rxoir iytfat lneolt seuoxo3iy4ap  micta()aDtm(ro;t4aexomf3tad a2rmu o;() ltrxfcoodoatraivo t0srtoxr3iy1am elieiat)sDra( pno4apenioctas a ul(msnu) renir tydlptelivil(0 eur(m3nodlm emicsat  Draxmpoo4tlx micilsfsDul(vs t)altoif totlp  li il( t2toxr3iy1lpee ivtasfsruaumooo4oee  i3iatla2ea( s (0artoxf iydop  aueols s2toxo nodaptn neiat) 2ur(rpou1ole  o3ilt a emnmo ()altrmrciodom  anvi (0s2uoimpny1amee nvils)s2trum nt1tleomiciltla2rmnms u4tetoxf3oydla e i o;t s2to(o oo1aleemfetat a2tau ont1aeeomicildlsDel(vp u4tlermr3ta1fpt an sl(0 etoxrpoo1ll nlnet t a2raxm ;o4aexomf3tas mDumuvonu)alxoxf3oo1opDrauvi;(0s2to(r io4apt  nes tf rra(rpou4aptnmfeiasfmDum(vsn(0 leoxrciydlpDelnvo;s)setoxr3oy1ame  ivilt) Duaur ;t0texomociat a2ul(vp;t0aexrxo tytlp r nesl(0t2tm(r3oudapee nvilt)s2tmu  nt4tpto ociyslsDrluvsnt0 lenxfciotlatelueils)t2urxo3oodalte fct s  ruaxmonu4aptniiciysfm ran o;t0artnmf ta1laDe n olt)s2umiopio1opeelnvtas  rta(ront0oex  i3ilt m ul(mo;t4tltoxr iotfmDe ueols) exr(r3nudamtnmicia() Duru oou4ale mieiatfaDuln snt0tlerir3iodop  lu o;() rxrxopoudap nmneiat sDur(rpnt1alenmfcilsfa ua(vs (4 lermo3tatlp elueo s)t2umxr3nudlpenlnvs ( a2taurpnt4aeeomfcils sDran ont0 ltoxf3oytomt li i s0 rtrio iydopen iet t)s2taxmpno4tltnifeiydfmDran snu) leomf totopDe ies;s)setrim3nu4ame lfes s)sDumxmoot1apenif3iyd a rau o (0artrmo oydfmDr uvils)t2uoxo3iu1om elnvsas)aDuaumont1aptn fciltla ran s u)trtrxr totoat lieo;t) rurio nodlp e ncsls srtr(ro;u1tlenifciadfaDelu p u4tlenmf oadla   nvo;()texr(o3oy1amtnmfvt sfa2ua(m ;o0oexnmicias m elu o t0alxrmf tytomtelu s;(0srurio3nodll e nviatfa2ta(  no4opeoiiciatfsDelnvp;t) rtnxf ia1opt  nvol(  rxoim3nydop n ietas artaxm ot4opeo oeilt sDumn s;u0alxnmo3oa1fat aues;s)teuoim3ny1om elfcsat)s2tax o;u0tlxoiieiyt s rlump t) etrmfctydomtrliei s t2tmio3nu4apte fvsa()aDumxr no4tpe  i3iat a uanmsnt) eenif3tydfm elneo s sexrxo3no1lmtnmncias s2taur no4ope  iciatlaDemu pn(0 renir3oadlmteauvolt)trurxo3iodome  ncta()srtr(mono0aetomi3ild s ul( pnt4tltnxr to1opDeliei;s0srxoxr no4lmeemfvilt s2uax ont0tpxniictysla rl(msn() ltoircootfa elueolt  2trxr3no1alt mfcsa(f rtr(m ;t4oeen octad m2ranvs;u)arenxo3ty1lp eli o;t0setrio nudll   fesl(  Dtmu o;o4teeoio3tysfa2umuvpn(0 etoircty1fpt aiesl( sexmiopiudal elfvia(  Dtr(mont4oltn ieiytls2emu o t)tleoxfciytfatelieo;t s2xoiopny4aleelnetls s2raurooo4teenifetysls elu s t4arxrmoctodlmDrlues;s)setr(r3oo1apenmncslt  2rax pnt1oet mf3iltfa ra(vsnt) reoxf3iy1lpD lu i (0sexmxr iy1ape lnet sfsDua(mo;u1tle  ieilsla2ua(ms;t)alxoxfcoytfp   neo;t t2xmim3nu4om emfvt ( a2rrxrpoo1opto feiysfa ranmp;t)trtnxr oo1fatelu o (  etr(opiy1lp  lfcs (f Dtax p;u1ale moetas a umumo u0aetomr3iytoaDe neo s teurirpoy4lpen fctlt s2taxr ;o1tpen ociys sDrl(mo;u4aeenxf3oodlptrlivi ()trxoio iu1ap   fvi tfsrtr(m ou4tetomi3iyd mDra(vo;()alxomociadfp   u i ( teur(rpiydap n ietas  rrr( poo1tlto octaslmDelnvp;(0aetnxf3oy1lmtrluvi;( texrxm no1ap nmfcta(fs2rm(mpoo1apt mfeiad s2ulnmp;(0 etnxf oytomtr n olt0texr(mpnu1lp   nvs tfa2rrx o;o0aleomfctld s um(msnu0aexrirctodopt luvilt)trtoxmpiy4ale livi (f Dtrx p;t0tlto fetatlmDumumo u4tlerifcta1oa  ln s;s srxoio oy1amen nvsatf Dra(r oo1olxn fetysfa2ul( s;u)artrmf3totopDelnvo t  rto(r3io1omtnmicsltf Dtr(moot4tpe io3tldlsDemnvpnt4 rtnxo iydopDeaneo t  rxriopnydapt  fes tfa2raxm no4tlxnioeiydfa2uluvp;(0aetrif iy1lpt livols0 etrxo3ny1opte nvsas  Draxmp;o4alto f3tyt aDemnms;t) etomrcoodopt lnvo;s0t2uoxo3iu1lme mivs s) Dtaxrooo0alxomfciys mDumuvp ()trxoxf3tatfatr iesls) rurxo iy1olt mnvtltfaDumx  no1oee ii3tytlm el(msnu4 lxnircoo1lp  anvi;s)trur(r nodam elivslt) Dum(r oo0tltoiictydfm2em( o;t)tetnio oydlate ueolt0t2tm(rpnu4lmt mfci ()a2rm(moou0openiictltls uaump;t0alxoif3to1la e ieo s0 rxm(m3ou4apenliesas srua( o;t1oetnmictytlaDeauvo;(0alxrif3oydlp  an o s  exmxm nu4lm  mfcta( sruau pnu4opxo iciysla2ra(vo;t0aexrxr3iydla eaues;(0t2xoirpny4lp  lict s  Duau oot1opeo f3iydlaDrmnmp;t4alxomr oytomDeaivsl( srtmxm3oo4ome lfvtl() rrm( p;u1teeo ocildfm umuvo;()alxrirciadoatrlivo t)sexmxm iu1ol elncs tf Drmu ooo1opx ifciatfa emnmont0 etrmr oo1lm rln il( teurio3oo1ol emfesl(f rur(r ;u4ope  fctyd aDranvpn(4tlenmo3iatoa r uei;t)tetmir io4ome  ivsas) ruaur ;o0tlx ii3iltfsDra(vo;t) lxrmocia1la r uvs;(0 rum(r3nu4al  mnviltf Duaurpno4tleomi3tld mDrlnmp u)arxrmo totfmD lueo s)tetoxm3oodapt lfct tf Dtaurono1teeoifciatls2rmnmp (4texnmrcoa1fa eaivs s)teumim oo1olt  ncsatf Dum(root4aee  ociad sDua(vont)texrxr3oy1lpte i olt0t2um(mpnydllt lnvi s  Dur(mpnt4apxn f3tyd s2ea( s;t)alerifctotopD lues;()teum(r oudolenlnvt t  Dur(mpno4aexomf3tad a2rm(msnt4 rxnir3to1omDrauvs ()trtr(opiodlp elneil(  rumumooo1ale  fctyt a ranvs (0tlermo3iodlaDr neolt srtriopnu4al nlfvias) rtaxroot4oexn ieiyd a2rlu s;(0 rermo tatlmDrlnei;s srurxo oo1lp  lfvtasfsDraxrp;t0tpen f3tlslsDran o () etomf3ta1oatr ieo;s0s2xoxo iudaltnmfcta(  rrrxmpno4alt ii3iadfs rmumon(4tlxnxo tadlm   u olt0trxrxmpoy1ap elfes (fsDtmxmpno4apeo i3iasls2umn p u4 reomf3tytlatr i ils  etoir oy1olte nvtl()sDra(r nt0olxomoctadls2eluvs;u0artrxr3oy1lpDr uvi;t truoxr3oo4lpte icsat)srtr(mo;t4olxomoeildfaDea(vpnu4 exnxo3iadlptr ues s) 2xoxr3iudlmtnlnvsatfsDurxr ;o1tlt mf3iytlm2rluvo;u4aeeomr3tytop ran ilt)seuoxo iodomte fvt t aruaxmo;t4tltnioctlt m2rmuvs;t)trxnmr iodom eau s (0 rxoiopoodomeelfcsas aDtm(r ;t4tetomf3tyd a2ul( s;u4 reoif oy1fat li o;s0 rxo(m nu4lm e fes t)sDrau o;o1texniictldlaDem(ms u0 exoiocoodfatraivils srtm(rpnu4al elnvsa(  ruaxrpnt1tpxoiietlslm eluvsnu0trtrxocio1oa   ivol(  rumxrpoudaltnmieiasfsDtrum no1alenioeiadfs umumo;()trenxr iatoaD  nvo;t0 2ur(m oodame lieil( srraxm no0alt ifciyd mDrau o;() rtrxr tytlpt lu s () rxoxm nodapenliesat)sDrm(mono4aleo iciatla umu pn(4teeomf3ty1oat aiei;s) etoxmpiy4aptnmivsa( aDtrx  ou0apx ii3ildls umums;() rxoiocoatlaDelivilt  exmio iy1al e ivtl( sDtmxm ot4oetnmociytfaDelump;t) etoir3oo1fat ln o;t  rxr(rpnudlpeemiei s  Drrxr no1oeeomieiydfm2emums u)trtnir oo1fateluvi;t  eurio iudlme micil()s2ur(moou1apx ioetys a ulnvs t4 etnmf ia1op   nei;t srurio3ou1omeemnvt ()s2ur( oot4ale iociltlaDem( s (4tlenio iatoa eaneo (  etmxm no4llenlfvtat  2rr(  ;t4tltnmf3ilsfa2ulnmo;(0trenxrctotfpt aueo t0seurim oy4ol   neil( sDumxmooo1oltniieiat sDelump u) lenxo iytfpDrlu s s sruoxopiydoptn feil( aDtaxrpoo4tltnmieiyd a2ra(mo (4aetrmrciadlp   neslt) eumxopiudalt mnct s  Drrxm no1oleomoctysfs umnmont4trenmfciadfmD luei t  rxmxopnydaptnmneia(f 2tru p;t4apx mocildfaDrmn p;(0tlermrcoa1faDrlivol(0trtr(r3no1ol  mncs s a2uaumo;u0tlenmiciltfm2eauvo t)aetrxr oatlaD auvolt) euo(m3no1ale mivsl(f rrrxmo;o0aexoifetytlmDulnvs;u4tetnmrcootfmDraieolt0s2xrir3nodop elneia(  rtm( p;o0oetn o3tlt s2ranmp (4trxrxo3iydfm eli ol(  etmxrpno1lpt lfcias  2rrurpno1tle mf3iyd sDranms;(0arerircootoaD lies;s) 2toim oo1op n nesltfa2raxrp;u1oet if3iyd a2ra(vpn()tlxrxrctodfpt aueol() euoio nu4amee fctls) 2trurpnt4apto ocias sDulu s (0 rxnmrcootoaDe n o t0srxo(opnu1lp n iesas) rrax o;o1apx  fcilsfaDuln s;u0 ltrir oo1lptrluei t s2uoio no1openlfcta( arta(rono4alx moeiltla ul(vs u4aexoirctodoa eli s;t t2tmio3oy1amt mfctls)srumxmo;u4optnmietlt a2eaumont4 etnmr totfp  luei;t srumim3oo4am elies (  rraurpnu1tle mietytfa rlumpn(4 rerircoatopDr n sl(0setmir iu1op nlnetlt a2raur ;o1tpxomo3tas sDulnmo;u)treoif3ootlaDe ivo (0srxoimpoo1optnlnvtl()sDtr(  ;u0tleomo3iyd a2elnmp;u) rtrioctotfp elivi ()texrirpnydllt  nvslt a2truronu1teto o3iadlsDul(vpnt0 ltnir3ia1oatelivo t  rtm(rpoo1lmtnmfeta(f 2raumooo1ale  ociadla eanmo ()tetrif3tydlmtr nvi;t) rumim iudlm e ncia(fartrum nu4teeoiietltfa umumsnu4treoxr ty1lmD  nes s t2tmxo iydolenlfvi () Dur(mpot1aetn octlt a2ulu pnt) etoxo iatlpD auvs s0t2umxo oy1apenlfei tfaDtr(rpnu4ope mfciasfm emnvpnu)tlenxr3io1oa rlueil()sexoxm no1llt  ivs tfaDta(rp;u4oet mf3iysfaDrmnmo (0 lenxociy1fmD  ieo s srxoio3oo4apt lfcsas aDrm(roou4tpe  f3tys aDemuvsn()tltrifciadlp  anei t setmxmpio4om elfvsls) Dtmuro;t1oee mociad aDrau pnu4trxnmf totop eaneo t) rxoir3iydam emieia() 2rau  nt4alto icildfsDeaums;t4tltnif iadla elnvs s) rxo(mpoodoleemnet s)srrauront4texomi3iadfa rmumo;()tlerio oo1oaDrai s;t) etrim3oo1omeelivslsf rtmx poo0tee ifctlt s emnvp u0arenxo3tydopte n sls t2xrxm3ny4om elnei t) Drru ono4tex mfctasls2ulnmonu4 rxoxrciy1fptrlivi;()t2ur(m iodome  netatfa2tmumpou1oex  fetyslmDrlu pnt0tlxomociodlp elnes t0trumimpoo4alenlietltfarraxrpno0olen f3tys sDulu pn() etoio iy1op  aneil()sruo(opoudlp nmnetas)srumxmono4apto f3ildlm uanvp;u) exomr3ty1omDr n i;s)seur(opiy1om nmfvil() rurxmp;u4opxniieiytfm ra( p;(4tltrxo ta1laDelnvi;s t2urir3nodape liesat) Dtaumonu1alt moetydls2rlnvs;(0teeoif oo1oaDraneolt)s2xmxr3oo4lme mfes t)srtmxrpou4tee mieiydls el( s;u) rxnxrciatfp eluvsl()srur(mpoo1lptnlics s)sDur(  oo4opeomfeildfs emnvo;t0arxnxocoo1faDeaivi;()texo(o iudomee neil(f Duaurpou1aleo f3iatla rauvs;(4tlxnmo3oytop  lies;s)t2umxrpiy1oltemicil(fsDumx onu0aet  ieiad aDulu s u0 lxoxocto1omDe n i;s  2xrirpny1ape mncs ()a2rmxr nu4oltnmfciat aDumnmo;u0 exnmrcto1lp rlu i ()srtr(m oudomtnlfvtltfs2tmxmpou0tpenmoeildlmDra( on(0treoxf3iotfaD auei ( s2umir3io4open ietat  ruru p;t1oet  octldfmDrmn o;u4alxoxr iotlm r ueo;t)t2xmim ny4open nvtls)srraur nt1aex moeiasfs umu pnu0arerxo3io1lpt lnvo;t0teumxm3oo1llee ici ( s2ta(mont1teeomo3iyt m uanms (0artnio3iytom  li o s0trumxo3no1olt mfcs s)s2uaumpot0ale ii3ils aDemnvo t) rxnmfcta1la rlivi;t0setrirpiy1lpte ietas sDrmum nt4aptn ociyt a2emnmp u)tleomocio1fmtraivi;() 2uoxmpiy1apeemies t)aruax  ;o1apx mi3tydla ulnmsnu)aetrifcty1lptran s;(0tetoxmpoodlm n fcsl() ruaum ou4aexnmoetlsfa2raumont)trxnifctodlpD luvs;( srto(o3oudam  lies sf 2umumoou1texnmfciydfa2rln snt0artnxfciy1oa eluvo s)setr(r iu1lltnlfvil( sDrrurono1olxomociyd aDeln o u)tleomr oatfmtr uvs;() etr(r3iudopt lieta(fartm(monu1optnmocildls2emn o u)tlxrifctytlp rln i;t0 2trxm3no1op e netat) Drmum nt1aexoio3iatfs2emu onu0aexrmrctotoa  luvo;(0 2xm(r3iy4lm n ieiasfa2rrxm ;o1oexoioetlsfa em(ms u4tlxoifcoydfa e n sls setmio3nodlp elivsl( s2taxr ;t4teeomoetatfm2ua(vp;t4altrmo3iadlm   uvils0seurir3ny4aptemnvslt)s2umump;u0opx mfetydfsDulums t4tleoxf3iytfa eauvilt)texoxopio4lltemnvsa(faruaurp;o4tetn o3iatlaDel(vont4 exnmr3oa1op eanvsl(0 2umxrpoudalte nvias)aDrrx o;t4alenmo3ilt a elu p ()tltrir oydopDrauvsl(0setmirpnudlltemivilsfsrumum ;u4texoio3iytfsDrm(mo t) reoxr oo1lp   u i s)srtrimpoo1lmtelfeiat  rrmxr ;t0opeoiiciysfsDrm(vo;(4artrmr oo1fmDr uvils t2xmio3iu1lm nmnvs sfs2rau  ;u0apeomieiysls ua(vo;()arxnxfctytfaD  ueo (0 exmxrpiu1oleelncta(f 2um( pnu1optnmfetltlsDeau s t4 rerxf io1fp r iei s0teuoxrpoo1op emfcs t)a2raxmpot4tee  o3ildfaDrluvs u4 leomo oo1lat  uvslt  ruoio3io4altelneilsfaDtrxr ;u4openmieiat s2el( pn(0arxrmfciatoat  neilt) rumio3oo4omte ici tf rtmuroou0opto oeiyt a2ul(vp u0tetoxf oy1opD auvi t)setriopno1lm n ncsa() 2uax  nu4tpt  fciat s ul(mpnu)tleoxf tatomDr nes s t2uoim3iydlpeelnetas  rrmum nu0ape mfcilslm rmuvo () rermrcto1laD  ivi;(  exmxr nudlp elietat sDuaxroot4tee  ieiadfs2rluvp;u0 eerirciytoa rauei;t0trtmxm3iy1ll nmfvtl() 2ra(rp;t0ope  octlsla2ean s (4arxrif3oa1fat au i;s)seuoio3oo1lltelics tfa2ur(  ;t4oex io3iydfaDum(vs u)aeerxfctadfpDeai ols texmxm3oodomeemnctlt s2rrump;o1tlxomf3ildfmDulu pnu0 lerxfcio1fa e ies (0seto(m3iu1lltnmieias  rurxroou4apt ioeild s eanvs;u) lxomo iodlaDeaneo;t seumxrpiy4omeelfvt t)aDtrx p;u1tleoiieiatlm ean o;t) exnmf oydoaDrauvo s0teumxo nu4ll  mnesls) 2uru oou1optn fctltfaDum(vsnu4trxnxo iatfm eln s ( seumxopiydapenmfviatf rta(m ou4alxomieiydlm2rl( ont) renxo iydom r ivo t  2umim3oy1ap e iesa(fsDrruro;o0teenii3tldfm rluvo;u)aexrxf3oadlmDe uvo ()sruoio3oodlptemfcs tfarta( onu0ape  o3ilsfa emuvo;u) etnxf3tadfaDeluvol(0 ruriopnudomte nctlt)srtr(mpot0ope mo3iadls emnvp u)aeenircia1oaDelu il(0t2trxopou1omte ivs ()arra(m ou1opx mi3iydfmDean snt) lenxo3oodla  anei (0t2xrir3oo4aleemnvil(fa2ta(rp;t0tleoii3taslmDuluvsnt0artoio ia1oaDrlies () eurxo3iy1am  mivilt) rtrxmpoo0oee ii3tysfa2ra(mpnu4 lenxo3oa1fmDran s;t  exmiopou4llt lieil()s2uaum ou4alx  i3iydls2umnms u4arenio3oodoa  anvi (  euo(r nodamtelivias)a2urxm ;u1ale mieiyd m eln s u0trxomf iatlptelieilt tetrir io1am emfet t s2taurono4apx  ociasfm2el(vs;u)aetrxr tatlp rln s;s s2toxo3oy4lpenlnvsltfaDuru oot0oee  ieiad a ul( on(4 lxnmocootlmt  u ols t2toxr3ny4lp n nctatf 2trxmpno0oeeomietys m ulnvo (4areoxrctotomDran il(  2uo(mpiy1lp   netls  rumx pnu0tex moetld m2ulumsnu)alenxr3iatoaD lu olt0 etoirpnudome  fetasfsrtm(mo;o4oltomicildlmDrm(mo;u4texnmrctydlpteli sls0 rxoio iy4llenmiciltf Drrx ono1apxnmieiat a2rlu s u4aexnmr oy1lmDe n ilt texoir oy1lp  lfes (  2um(r ;t4oetn ietytfa ua(vo;(4 rxoxociy1lat anes;(0t2xo(r oo4lpt mnvs s)sDrr(m ;t1texo ictydfs2ul(mo u0altoircoadop   ues () rxr(mpiy1oleemietas srumu onu1tpt mf3iat aDranmp;t)tlerxr3iadlpD  nes;(0trxoirpno4om  livsl(  rrrum oo1tetnioctltla uau pnu0 lxnmfcia1om   nvo;t  2tm(r nudllt lncsls  2ta(m nt4tpt iiciaslm elnmp () rxrmr3oydfpt auvs s0 rurir3oo1aleemicils) Draxroot4tltnioeilt a el(vs ()altrmo3iotfaD auvsl(0t2um(mpio4lmte ietltfaDra( onu4tlenmoetat m2raumonu4tlerifcoodfaDr uei ()trum(mpiy4llenmneils  2urx  ;u1ale ifeiad s rl(mpn(0 etoiocty1fptr uvs t tetmxmpoy1lle liviat)srrax onu1ope  i3ildfs ul(ms u0alxrxfcoatopt  ueo t0t2xr(o iydlmtelnvil(f Drmxrpnt4tptniieiytfsDrlumpnu0trenxf tadomtrluvs (0 2ur(opno4ol e ncsa(  2rr(  ot4apxnmfctlt m ean s u0alxoxocoo1fptr ieolt0srtmim oudalt livia(f Drruro;t0oeto ociydfm elu pnt0 lenircoy1lm r u i;s  etrim3ny4om e ivtat s2urxronu1oetomfciltfsDelu p;(0 exnxf iy1fmDrau o;()teum(m3no1opt lict s)s2umurp;t0opxniiciysfmDem(mo;t4 rtomf3oy1om  lnvo ()t2trir nu1apenmfcsat arrmur nu4aee ifetltfm2em( p;t) leomo iytlpDeai i t0 etmxopoydope lfes t sDua( pnt4teeniietydfm em( p;(4 ltrxr oa1fmteauvolt seumxm iudop elfcsatfsDraumo;o1tet  ieiadlsDem(vs;() eeomocio1faDelnes s) rxoxmpoydap emnci (fsDtru o;u1openiieiytfs2uau s u0aexoxfcio1oaDeln o ( srxrim3oo1ome mieiatfa2taumpoo1tlenmiciasfa ea(vpnt4 ltrir iadlpDrln o ()t2tmxr nu1omtelici t sDrau p;o4olen i3tyd a elu o t4arxnxo ootoaD  ivsl(0setmio oodop emfetas)arrrurpoo4tle io3ilslsDum(vp u0trtrif3to1fm eau sls0 2xoiopou4lme lfvsa(faDra(mono1tle mieiad s rau s () rtrmr3oa1lm rln olt texrxm oydame mieil(  rrmxro;t1opx ioctat m2rlnmon(4artoif todfaDeanvsls) 2uo(o ny4amtn ics t) Draurpot1tpx  i3iyt a2uau s;(4areoxo3ty1lpteau olt)t2xrio3ou1apt lneta() 2ur(  nu1openifeiat aDraumo u0 lxoir totfp ranesls)tetoxopoudole mivsas  ruaur ;t0tex iocias m ulnmo;t)trtrxf3totlate iei (0t2tr(mpio1ap nmnetat) Drmxr ;u0aetoioeilslm ra( o;(4 ltrio ty1latr u ols)trurxr3iu1lltnmfviasfa2raxm ou0oeto f3tlt mDrl( p;(0aetnxr tadlaD anvsl()s2xo(o io1llenlfcsasfarua(rp;t0opxomo3iysls ua(mp;t4 ltnir iodopt  i i;( sexoir3oo4lmt mivsas artr(r ;u1tlx  oeilslmDuaumo;u)altniociatlate u s;t0trum(m3io1aptelfes ()arrrxrp;u4aet  iciytla2el(vonu0trxoir3iotfmDeaneo t)sexr(o oy4lpenmnetas arta(rpno1ape ifeilt a emumpnt4trxniocoy1fatr iesl()s2xoim3no4olen iesltfsruru pnt4oeeo i3ildfmDul( s t) renirciytfaDrlneslt0 2xmir3nudop emivtat) 2tmxrpno0altnifctad sDuluvs t)tlerxrctodlpteli s s)t2xmir3ny1opt  ncslt) 2rrx pnt0optomf3iytfm2ulnvonu4 leriocoydlmtelneol() rto(mpio1omenlicil(farraum ;t1teeo fetydfmDelnmp t)teerxo iy1fmtrau o;s  rxm(r3iudaltelicilt) 2rm(rpnu0olt mo3iydlm ua(mo u0tlxnir tatlptrli o s teto(m ny1lltelivtatf Dum( oot1oltomfciasfaDrlnms u4 lxrio totomDean ils seurxr3iydoltnmfeta(  2tm(m ot0ale iietydla2ea( p (0aetrio3iydop eln i;(0 2toirpno1ap  mnvt s) Dua(r ;o0oleo f3iltlaDrl( snu) ltnmo3oa1lp  an i;s)trxmimpnu1lm elnvias)sDtmx o;o4tetnmi3iasfm2uanmp () rerxo3tytoatrlueo s) rxoio ny4llenmfei ( arrmxm ;o4olenif3tltlaDrlnvs u0aeeomo3iydlp rlneo;t)sexrim ou4omtnmnetlt)aDurx  ot1texnmo3iasfa ra(vp t0arxrir oy1fpD anes;(0trtm(o3oy4apeemicilt) rtmxm ot4tltnmoctytfaDra( o t) exriocoydlmDe n i s0t2umxr io1lpen fcsa()a2rrumpno4oetn o3tlslaDrmuvs u4arermociydfpt  nes s trtr(r3iu4opeelicsa(  rtrx  nu0aptnmf3tldfa ra(mp t0aeenir iydom e ieo ( sexmxrpiy4ame livsls  Drm(  ;t4tlxnmfciltlm ulu on(4trxoxf3to1lat au olt0sruoxr3iy1lp  lnvt t) 2tax ono4oeenio3tad a2elu o;(0artnmr3oo1fmDe u s s0 etmio oodamt  fes tf rraxro;t4alx iicils s2rm(mont4 ltoir3iotoat auvols) rtmiopoy1omeelfvt s s2ta(r no0aetomicild sDel( s;t0 ltrifciydlp e i o t)seuoim io4amenlnvsa(f Dtm(rpno0olxo ieildlm2umnvsnt0 ltrir3oa1lpD lieol()seuo(m3iu4lpt livi s sDtrx ono0opt mo3ias s ra( o;(0trenxr iytfpD anvo;t0 rxr(m3oudal emfeil(fsDua(  oo0tptomoctys s rluvo;()alerir3totlmte u ils)srtrxrpoudamen ictat sDra(monu1aleoifeiyt s2uaump;(4treoircty1lmt aiei s)s2tmim oudam nmictls)a2tr(m no0oeenmf3tatlm uanmo u)aexomrcia1lmDranesls)t2xo(r oy1omenlivilt)arum( pnu4ale ii3ildlaDra(vpnt0aetrxoctotfmDelivs;s teur(m oudomte ics sf ruaurooo0aex mo3tys s eluvsnt4 reoxf oo1la e u i () etoxm ou4ap  livia(  Dta( pnt4texomfetyd m2el(vsnt)trxoxr oy1fmt auesl(  etoio nu4ope  nvt sf rrm(  nu0tptoiociytfa2ulnms;t0aleoxfctydla  ln ols0srxrirpno4lp   fvslt a2urxmpot4tetnii3ilt a emn pn() rxrxocio1fpt livi;t0trxoxo io1lmt liesas  Drr(m ot0tpeo i3iltlaDeanvpn(0teenif iotfmt  u ol() 2xoxo3ou1apee nct t)srtr(m no0open i3iysfa2ulu s;t)trxoxociodom r uvi;s  rxoxr3ou1apenlfes s) rra(moou4olx iociydlmDrl( s;(0trtnio tadlatraueolt sruoxm3no4al e ncsltfsDrru poo1teenio3iysfm2eau s;t)areoif io1fmteli s;( s2xmiopou1ap e ict tfsruaur ;t1opeoio3iydfmDuluvo;u) eeomf3iy1lp eli sl(  2toxopno1ameelfcsa(fsrrau p;o4oeenio3tysfm2um(vs (4aeeoxo3totlmt aieols0t2uoimpnodal elnetas)aDtaxr ;o1opeoio3iltfs ra(mp;u4 rtnxf3ia1faDrlivs;t  2umxo3oydlmeemnetatfs2rmur ;t4oex  ociydls2rln s;u4texrmr iatfm  lieo;t) rtrxr iu1oleelfvslsfsDuauronu0tpxoiociyt a ulu s;t4tetrmociatomteluvol(  2xo(opnu4omt mieias srtaxront4opeo oetytls2uluvs ()trtomo iadfpD lnvi t0 2urio io4lm e ivsl( sDurumono0oetnmociysls rl(vs;t0artomo3tadfaDelneo ( t2tm(mpno4lltnmiciasfs2umxronu0opxomf3tasfs2eanms t0arenmf3oo1fmD li ilt setoim ou4lmeelfci (fartru oot0texomociytlm ranms;u)tlxnif oadoaDeaiei;( t2xmio3no1lpt  nctl(fsrum(mono4ale moeiysfa2eluvpnt0alxrifctotopteanvi t)setoimpoo1apt  fetlt) rtm(  nt4oexoifcildfmDeauvs;t0aexoxo tatfpteanvo;t) rurxopoodamt  neil( arrrxr ;t0alxoiieiydfm2emnms;(4texnmo3ia1oa rai s;() 2xrir iudopenlivs (faDumu onu0ole iiciasla rm( sn(0texoxr3iotlp eluvi;s  exmxm oo1ome mfctlsfaDraur ;o1aeeo f3tatfa uan s (4aetomo iytomt luvo s0tetrir3iodaltnmfvi () rtrx onu1oexnmi3iasls2umnmo;t4trtnxr3oy1fpD anes s setm(mpny4lmt mfcils sDtmxmono4oexnmi3tys m2ulnms t0alxnmr3tatlmDelivo t0s2xrxopny1alt  fcsasfarurx ooo1tlx mfciat a rl(vp u0arxnmo oadomDeaivol(  etr(rpoydlptelieslsfa2tmurpoo4tpxo o3iyd m2ulnvonu0aeeomo3oo1lm rln ils)t2xoir iudop   icias)a2uru ont4tlxoif3ilt mDeanvo;u0teeomf3ootom  aivol(0trumir3oo1omtelfvi tf Dururpoo1opt  fetyt a2um(mo;t4altrio3oo1lp ran olt) eum(m oo1lp emnvsatfsrtaxmont4aptnmi3iatla2em(mp t)aexoir iadfatelu o ( truoio3io4al elfvi t) 2rau p;o4optoif3ias a2rmumonu0 etrxo3oytom r neil( srtoio3iu4ol   ieiat s2urxmp;o1apt mfeiyd aDra( s t)aexnifciatfmD  u olt0srxoimpoodlm n fesa()sDuru ont0tpe mocild aDuln p;u4treoif3io1opDr i sls) exm(m3oy4omenmnctltf Drmxmp;o4alt ii3iytlsDua(vo;t4trxoif iadfpDrlnvi s0srumxo oodamenmnetat  2ur(mo;o1olx  fetat m ulu p u4 exomf ty1fpt  ueol(0 etmxm ou1alenmnvi () 2ra(mp;t1oleo octyt mDemnvp;()tetoxo3ia1omD  i o;s)sexo(opio4apenmiesat)a2uru p;o4aptoii3ilsls elnvp t)alxoxfcoo1lmtr ivsls)teur(mpoudale mivils)a2tr(r nt0apxn f3iatla2uauvp;t) eermr oatlmt auvolt) 2tmxm3iu4aleemnvslsfartmu oot0ole  oeiydls2emu o t4 renmr3oa1om  an i;s0s2uoio iy4om  lnvi sf rta(rpno4tpxnifciysfmDel(vp t4 lerir3iatlmDr uvs;t t2xrimpoudlmenliet s a2tmxmoou0aex  i3iad m2ranvsn(0 exnmr ia1fpDe neols0t2urim3iu1op  miesa() Durum nu4olt iiciysla ua(mp (4tlxoircoo1fpt  uvol()trtoimpny1ll  mnvsasfarur( o;o0olt ii3tatfm2elu o u0tltomf oa1omDr uvs t  2uoim3no1lm  mfvtasfartrx o;u1oeeniieildlmDrl(mo;u4alerif iytfpt  i s;t) 2xoir nu4ol  micsa(fsDtaxmp;u1aptomietatfaDem(ms u4artoir3oatfpt auei;s s2tm(rpiudaltnlfvs s arur(mp;u0oee  i3iysfm2emu p ()treoxo3iytlaDeanvo;(0s2uoxrpoy4lmtnmnvsa() 2uru pou1tpe miciasls rau snt) exoxo ia1oaDelivi;t  rxmirpnodom   ivi s srrrum oo4apx  f3tysfsDrl(vp;t0 rerxociytomDrai s t)seuoxrpiydam elnct (fa2umu o;u1altoioeilt sDem(vsnu)trxoxo3ty1lpteanesl(0s2xo(m iodopenlfesa() rua(rpot4teeomi3ildfaDem( s u0 reoifcto1optr n olt)truo(o3oydom emieta(f 2tau pou4oet iiciatlaDemuvon(0tetnxrciodoaDrlueol() 2uo(r3nodolenlncs s)aDtru  nt1oeenmi3tydls2ul(vs;()artnxr3oodop eaivi s0 2xm(m3oudopee fci sf 2taum ou0apx ifetas m ua(mont4treomf io1laD  ueol(0s2uriopoydame lnetl(fs2tmum oo0tlxnio3ils s uanvsn(0tlxoifcoadfa   uei;( t2xr(r3iodoptemiesa()s2uax o;u1aet ifctyd m2ranms (4alenmrciatlat livils)srtrxrpoudopt lfetatfs2rru onu1tlxnioetadls umu o t0teenmf ty1om eln i;s0t2xmxm3iudolt miei (farta(rpnt1tet  i3iatfaDua(msn(0arerirciydoate iei s)tetr(mpiydllte fetasfaDtrx oou1tlt iictls a2eanms u0 exnxr3oa1fmte uei t srumirpno4opeeliciat  Dua(m oo0apxoiiciasfsDumnms;u4altrmocto1fa elnvo t seuoio nu1omt lnesl(fsrtrxr ot0tlt mfetyslsDeanmo;u)texomr iadlaDe n o ( texmiopoy1olt lnvsat) rrmu o;o4alxomo3iat a2em(vo;u4 eenir3oo1omDeai i ()t2uoiopoo1lp emfeta()a2uaumoou0tleo oeiytfaDumumpnt)alxnxrcta1lmD an s t0seuoxm3nodolt lfesasfs2ua(ro;t0oetnmf3tldfa uluvpnt)alenir3ootlmDelieo;() 2tmxmpoo4am e neias)s2tmxrp;t0opeo o3ilsfa2em( pn(0trxoxfcia1fat au ols)t2xoxr nudlpeemicsa(f rtaxrpoo0tle  fctlt aDem( onu4 rxrifcto1lmDeanvolt0s2toir3iydoltnlict t  rtmxm nu0alenioctytfa2umumon()teerxr3oydfptrluei (0seuoir3ou1ll n ici (fsDta(rooo0tltoifcild m2rl(vonu0 rerifcta1oatelivi (0 2xoxm3io4llee netasfs2uaxm ;u4tptoioetatfs em( s;t)artnirciy1fpDeauvo;(0trtoxopno4al emfvsa(f 2uaxr ot0aeeoioctyslm em( p (4 eeomocoodlpDranes s  2xmxo3iy4omenlnei sf rumuro;t0aptn i3iasfm ul( p (0trxnxoctotlmtrauvs;(0 exrxo3iu4opt  iesatfs2rmu  nu0opeoifeild a2eanmo ()trxnxo ia1lpte ivi;s)setmio oy1apen net t) Dur( o;u0tptomoeiyt mDrm( o u4aeeomf3ootomt ln ilt teum(mpny4lltemfvtas arua(r ;o0opeomf3iltlmDra( o u4areomfctotfmDelu s s0 rurxrpiydolt miviatfsrumx p;o1ope mi3tadls el(msnu4 etnxrcoy1laDr iei;(  2urxmpnudal elfvsasfa2rm(moou0tpe  i3iatla2rmn o;u)aexnxo3oo1fm  lueols0texo(m3nudopt  nct (faDrrxr ;o4alt mi3tadlmDumnms u4trtoxf oydfpD  nvs s)trxoiopiu1lpe licsa()aDua(ro;u1tpxoii3ildfa uluvo;()texrio3iydla   ues () 2xrir nydome micias)a2umu  ot4oetomf3tas sDemuvsn(4aleoxfctatlmt livi;(  2xr(o iudlltnlivt (  Drmurpou0oex moetld mDelnmsnu4 rtrif3iatopte i sl(0teurimpiy1ol nmneils s2umurpnu1texo oeiyslmDrm( o;(4aeenmoctadfa   u i s  rxo(rpiu1lp nmfvi sf rtrum ;u1alt mfctldfs2ulnvs;(4aexomr3oy1fmDrlneols srurxr nu1lmtemivsat sDrr(ro;o1tpeoiieiat s2uluvp u) lerir oodfmte n il(0trxrxo3nu1om elnvi t s2tax poo0aetoifeiatlaDrm(mont4trxrmo iydomDr neol(0trxmxr ou4al n nesltf rtaxm ou4texomo3iydfa ulump;(4alxnxfctytfptr i i s srtmxrpiu4lmtelfctas)s2um(r nu4tptniociysfs2el(vp;u)arxoioctodlateaueo;t s2tmxr3oodlpt mncsls) Dra(rpoo1tlxoioctatls2rau o (0alxnxr to1lat aivsls0 euo(opou4lm n nei t arrrumpoo1alxnmictas s rau s;t)tltriocoa1lptraieilt  rtmxo iu4ape lfesas srrr(moou4tlx ifeiadfs ranmo;t0aexoxr tydomDrlu s t)setrxmpnu1amen neiasfsDuaxr ;t0aptomfeiyt aDrmnvp;u) ltrxo iy1optelnesl()t2xrio3nu4lmtnmictatfs2rr( p;t1tpto icilsfa emnmp () eerxocoodlpDe u il( teuo(mpiu4lp nmfciasfaDtmu  ;t1apxomo3iydlsDua( pn()arermr3totfpt au i t0seuo(r iydalee nci s) Dtr( ont1tlen i3iat m ul(vp;u0arxoxr3todlm eaivi;t t2uo(o ou4lmt lnctas sDurur ;t1tlt  fciysfsDrauvsnt0tetoxr oytfmDeli o s0srtr(mpnudomt mieilt  Duax  no1oleo o3tlsfs ulnvp;t)arenxr3oadlm raivo s  rurxm3iu1ol e fctl(  2tr(mp;o1oexnmieiad m elnms;(4teermf3oytopte ieo ()teur(mpou1aptnlnctls) 2uru pou0oeeo o3iyslsDrlnvo;t)tetoio iadoa rln s t) rxmxrpio4om  lfci tfsDur(rp;o0aexoif3iltla2rmnms (0alxrxr iy1faDr n o;() 2tmim3nydlp emivias)aruru oou1opxniiciatlmDulu pnu4aeeomfcta1faDe n slt0 euoxm nodaptemfci s sDur(r ot4tltnmiciadfmDranvs;u4 leoxo oodfaDrlivo;(  2xm(r3iydllenlfet tfsrtru pnu0ape  f3iadfa2emu pnt4alenir3tydlm elivslt) rumirpnu4al nmics (  rurxr nu1tet  octlt sDea( p ()artoxf3oydomD  i i s0t2ur(o iodaleemiesltf rtm(r ou4aptnmi3tatlm2ul( sn(0trermo iatlp elnvi;t0 rtoxr3ny1alen fcs (  rtax oot0alenmfcias s ul(vo;(4artoxr3ia1fptelnvs t0 rtrxm nydapenmivs () rrrx p;o0tptomoetyt m2uanvsn(0 etrxocia1opDeanes t  rxmirpnu4omtnlnvias s2rax o;t1opt  fetydlmDeaums t4alxnio3ootomtelivols)s2xoxr ou1am emicsltf 2rrx  nu4tetnmo3tltfs eanms (0arenifciytlpteai i s0srxr(m iy4ap   ietls  rra(m ot4altoifeilt mDea(mp;t0 exnio3iadoate n i;(0t2tmir iudome mncsas)aruau o;o0aeeo iciyt a rl(mpnt0aeenmfcio1fmteauvslt0trtm(r3oo4alenmnvt t) 2uaxmont1tltniociasfm2uau p t4 rxrxo tadomtr u s;(  rtrxo iy1llt licta() ruaur nt0aee  fciadfa2rln on(0tetrir oatfpDeanvolt0srtm(r ny1ame mnetl()arrmxmp;u4aeeniiciytls emn s t0artomo3ta1oa r uei;t)seumxm3iu1lle mfcta( arua(rpot0opxnmoetysfm ea(mo (4 rermr ia1fateanvolt)srxr(m3oodape lncs tfa2tru pnu4ale  fcilslaDeanmo t4 lerxf3iadfpDeaieo s  exmirpnydom elivtat) 2tr( pou1oeenmf3tysla2rlnmpnt0texrif iytfatelueil()teuo(o3oo1optnmfcsl()artau ooo4olxnio3tltla2em(mon(4 leoif3ootfa eaivols0 rxmim ou1ameelnei () Dtmx  oo0texo ociyt a uaums (0 etnmf iy1la rauesl( teuriopoy1ale mietls)sruaxr ot1aptniociad m uau on(4trxrir3iy1lmDrlnes;t  rxr(m3nu1lm n ncsatfartrxmp;o1aptomfciyd a ranmpnu0aeerxr oa1fpteli o t0s2tr(o nodll nmicsa(farraxmpno1aptnmietadlm rlnvo;(4 eeomr3oy1la rli s s0trxrxo3iudlpe  ivilsfsrtrxrp;t0altoiociyslmDeanvsnu4aleoxoctatlpt  nvi;s t2toxm nydom elncsls aDuru pot4tet  i3ias a ul(vs ()teenir iotlaDrauvs t0teur(opno4om emfvia()a2rr(ro;t4aet if3iyt aDemnvpnu) lxrmr3tatom e ivolt seuoxr oo4lmen fei ( aDrru  nu1opxomociltfmDran p;u4 eeomr3tytfp rluvols) rumim nu4ale mfct t) 2trx  ;u0tptoif3iaslm umuvsnu0aeeoxf3oadlpDrln s ()s2uo(m iu1ame lnctlt)s2rrump;o4oleoifcildla2rm(vs (4 eeomf oa1fpD lnvi ( s2tmim ny4ome mnvi t arrmumoou0opt  f3iasfmDuanmp;(4 lerxfctatfmDr nes s)truoir iy4lpen ict t  2rrx pou0oeeo i3tltls2emnmsnu) etoioctodlmt  i slt) 2ur(m oy4lle mnvtatfs2ra( p;o0apx  f3ilsla2umnvs;(0arerif3totfa  anei;()s2trim no4ameelnvi s  rtau pnt0aleo f3tadla2ulump u4 rtnircio1lmD lu i s  exmxo io4lle lfvi (fsDtr( pot1optoioeiyt mDrmuvp;t)trxnio3ta1oaDe ueo t  2xmxm iu1llen ieta()s2uaxro;u4alxoii3tltfm rln o;(4texoir ta1fateaueol()seto(o3ou1lmeemfeils)a2uaurooo4tleniieilslaDel(vsnu)alerxrcoadfp r ies;s  2urirpny1opte feslt)aDuax o;t1alt  feiytlm2ul( pnt) rxoir3iadfm rli i ( trxrir3oo1lleemfctl( s2raxrp;t4aexniocilt a2emn snt) lxoxf3oytopt aueils) rxr(m iydlpt mfciatfsDtm(  oo0aeeo oetltfm2rauvs;t) etnmr iotlatraueo t t2trio ou4olenmnvi (farrm(moot0openifetld aDrmuvsnt)altnxr iadlpD  nvs;(0t2xoimpio1lm  lnvt ()s2tmuroou4oetn ociat aDel(vo;u)arenxrctadfmD  ieo t)trtriopio1ll  mfctls)sDrmu  nt1tpto f3ils a rmumo;(4 etoio oy1omtelueilt0 rumim ny1lmenmnvtl(f rraxr oo0tpeoifciytfm elu sn(4 rxoxr ia1laDr ieo;t)tetmiopoudlmenlnet tfa2ua(r ;u1tpxo fctyd a ea(vp;(0artrxrciadomDrlneol(  eumirpnydam  licils sruru  ou0tpt ii3iydfa2ua(ms;u4arxnmoctytlpDeaues t)srxo(r3nydoltelnet s aDrm(ro;u1alx mi3tadlm emn s;() leoio3ta1omt auvolt)sexmimpnu4lmtelncs ()sDra(r ;u0teto i3ias a2eau sn(0alerio3ty1lat au o ()
\ No newline at end of file
@@ -0,0 +1 @@
+n ils0t2xrim io1altnmivslt  2tm(m oo0apto oeiadfmDeln o;u0tetrxo3ta1fmt  ieo t) eurxm3nu1amte fetl(fsDraur ot4texnmfetytfs2emn pnu4teermf oatlatraues;()tetm(opoydlp n fctat) rra(ro;o4oeenmociytfm2rmu p t)arxnio totfp eai sl( seurxopiy1lmt  feiat  ruau pnt0tetoii3iysfmDua( snu0 lxrxf to1om raivi ()texmxopoudlpenmfes t) Dumxronu1apx  oeiad s ea( o;u0tlenif3iotom  auvs s0texmxo nydap emfvs () 2rrxronu4apxo ietyslaDuluvonu0tlenmr3tatfmDr ies t) 2trio nudamtnlietlsf 2urx pnu4aetnmictat m2elumo ()trtomr3tydfaDelivils)t2xo(opny1op e iei (fa2umum ot0opxn o3iatfs2eanms u4trtrio3iydom  aneils0sexm(rpou1ol emfvsl( aDrmxrp;t4openmfctlt sDum( s;() ltoxr oadfpD lneo;( s2toio3iy4amenmfeias sDrm(ro;t1olxnmicildlsDrlnmo u0 lerxocoodlptrlu i;(0 exrim oydapeemnct s  Dtax oou0tex  f3iyslmDeau o;u)aeerxrcoa1lpD aneo;s)t2xoirpou1opeelfesas artaxr ;o4tee  iciat a2rmnvonu4 ltoif oy1faD aueo (0seumxr3iu1al n ictatfsruax onu0alx  feiat sDranvont0alxoif iadoa  livil(0 2urimpnu4lmt  nctat srtm(rono4aleniicildfm2rl( snu)aetrmrcoydfm   uesls)s2toxr3oo4ol   fesat)sruru oou0ope ioctatfmDea( o;t0arxnmf3iytlatrlues t)s2trio3iy4optn fvsas) ruax pot0tlenifciydfa emuvo t0 ltrmr3totlm raues t  2uo(r iy4om n fcia( s2rru p;t4oetnmi3tadfs2ra(vonu0 ltnxr iadomtrlu i s) 2xmxo3iudlpt  feilsf Drmxrono1aptniicildfsDumn s;u4tleoircoa1faDr u o s setmxr3iudlptelivtl()sDumuroot0opxnmo3ilsfm ra(vonu)alermrciadfmt  i o (0sexoim nudopt lnvsat) Drrxronu0teto i3iadfs2rmnms;()areoxr3to1fa r u il()tetoxmpnu4ap elfciltf 2ra(  ot4aptoiieiasfsDeluvs;u0artoxr3oy1fm elu sls teto(r ou4lp emfcsa()s2umxmpou1apt mi3iysfs2emnmo;(4arenio tydlmD an i;t0srtrxr3oodlp emfet ()a2rmx pot1aee mo3iatlaDem( o t4tlxrxr iotlptraneolt tetrxr io1omt  ivtl(f rrmu pnu0oetoio3iys sDelums (4trerir iy1oa eau o s0trxrio3oydol   ici ( aDurx  ;t0opeomfeiytla eauvsnt0alenio3tytlmDranesls trxrir3iodapte nct tfsDuax  nu0opto iciasls2rlums t)tetoir3oo1oaDrau slt  euoim iodomee fctl(  rum(mpnu1aex mi3iyd s2eanmsnu)alerioctotomtelu i s0trtm(rpoo4omteliet s)s2tm( onu4oetn icildla2rl( o t4 eermfctadlmt  n i t) rxr(mpiydlp e ncsl(faDtaxr ;t1tlxomfeildfm2ulnms u) lenmfctytoat  nvsl()srtmxm oy1lmte nvia()s2rmxrp;u0ole  ictatla rauvon()arerxo ty1fpDe nvils0srurxo oo1lpe  feta(fsrtru o;t4tpx ifciytfa umumo u0texomf oydoatr ues t) 2urxmpoy1lmt mnctltf Draumoou1tpenif3tasfa em(vo;(0teeoio tydlmte n ols)t2tr(r nydoltn ici s) Dur(mo;t4tlxo octadfm2ua( o t0trxoir3iytfm  lu slt sexo(rpoodomenmiesls a2rr(r no4teenifciytfmDemuvs;(0 ltrif iydfaDe i o t  etmxopno1lptelneta(fsrtmuronu0texnmf3iyt m ulu p;(0 lxnmrcoydfmtrlivo;s)teuoxo iy4ll nlnei t)aDumur ;t4tetoifctadfa rl(vo;t) exnxfctydopD  ivs s) 2xrxo3oy1omen nvtl()a2tru oot1tex mietytla2rmnvon(0 ltriocootlmtelnvolt t2xm(rpoy1lpeemfcsl(  Durxmpoo1tlxo ociydfa2uanmpn(4 etrxo oodlpD aies s0trurxm oo1alee fcsls) Dtmu poo4opto ieiadfs raumsnt4areomociatfmteli o;s  2uoio iy4olt  nci t sDtm( oou0opxo fciytfa2uan s;(4aetrxfciy1lmtrlneo;t)t2urio oo1ale mivi sfsrua(m ot0aptniiciydlmDumu p;u4trtomo iydfpt aueols)tetrxmpoo4ameemfvi ()s2ra(mp;o1altnmo3iltfa umn p;u)tlerxf tytlm elnei;()srtrio3oudllte fvt t arumurpoo4oee mo3iltfs elnvonu4aeenmo3tydoaDe i s t0trumxo oy1opt  fvt s s2trum ;u4texnmieiydla uaumpnu) renif3oodlpDeli olt)t2xr(o ny1omt mnvtat  rrrumpno4aexnmf3tls s2ul(mp u0 ltrxrcio1op eln i ()srtrir3ny4om elnvias sDra( o;o1opxn f3tytlm el(mp () ltrif oo1op r ivo ()s2xmim iudoptelivi (fsDrm(r no0aptnif3ildla2ulnvo;()aetomoctotfm e nvi s0 2uoim3ny4alenmivt ()arrru ono4opt moctyt aDrmnvp;(4altrmf tatlp rlieslt0 eumim3ou1ape lies tfa2tm( ont4tpen fetlsfa2elnvo t0 exoxo tytomt anei;()teurir3iodalenmfcs t srrrumoou1aetnmf3iadlsDrmu o t4tlxoio3oo1late ivs;( srur(m3nodom nmnvilsfarrrumpnt1oetn f3tad aDulump (0alenio oadoa eli i t setrxm oydol elietl( arua(mpnt4apeo ictasfaDemnms t4aetnmf ty1omDe u s s0truo(opny4om nmnvi tfsDra(mono0tlenif3tydfaDranvpnu0areomf3iadop   ueils) eumxopno4amenmfct t) Drrxr no1olxomf3ilslaDeau s u4tltnifcty1lp   u ol( s2xriopoydlm   ies t a2ur(ro;t4tpenif3iltlm ua(vonu)artoxf oatfateauei;()teuoiopiu4lmenlicta() Duax ont1oexoioeiatlsDrmn pn(0 rxnmf ia1omt ai ol()srxr(m iydapee nvilt)aDtmxr no0aeeo fetltlsDelu o () lermr ta1oatrln ilt)srxo(o nydomtn net s) Dra(r ou0aexn oeilt a2emnvs;u)aeenxfcoo1opt  n s ( srxm(m3ny4ap  mfvil(f rumx ooo0aee micias sDelump;u) rxrxo3to1fatr uvo;(0s2uoxo3no4lmtn nvsltfsrua( poo0oet moeiltla eau p u4tlxrmociydfpDe nes;t)t2tm(rpoy4al e fvtltf rta(  ;o0oexo i3iatlmDemnvo;u)artnmo iydla  lnvsls  2umim3oodam nlivsl(  rtmu  nt1tet ifcils a2rauvsnu)aeenio iy1opt  n o;t)trto(o nu1lle  ivsls) ruaxrpnu1tpenif3tlt s ra(ms () lxnxo iytop e uvi ()teum(opny4omeemnci tfa2tau  ;t0alt  fcilt sDemn p t4arxrio to1lmDe nvo;() exoio3io1lptnlfvsl( sDtr(mo;o1apxoifciyd s rl( pn(0 etoxfctytla r neo;(0trxrio3io1ome lics sf rtaxrp;o4alxo i3iadfm emn pn(0trenio3ty1fmtrluvsl(0srur(rpny1lpe mneiltfa2urum oo0oleo o3iytfsDelnmp () eeoxf3oa1fatr ueo;(0 rtmim3ny1omenlfcilt) Durxro;t1tle io3tasfa ua(vo u)texrirciydfmDraivs () 2trio iudlp nlfetls)aDtr( oou1aexn o3tydlaDemnvsnt)tetoiocoodomDeanvi ( t2urimpiy1lltn netlt  2ta( poo4tex  o3ildfmDra(vpnu)arerifcto1omD  uvslt)setoxmpio4omt  ivtl( a2umurp;t1ole miciyd sDrlnvo;u0aexnxf to1oatranvol(  2toio3iu1opte fetl(fsDtauroou0olto oeiadlm2rauvpnt4artnmo3tytopD luvsl() exm(o3oo1al e fvi tf rtauroou4tpeoif3iltfa2uaump t4tltnio todfp   i o;s s2xo(opnudaltnlivslt artr(r ;t4oetnmicilsfa el(mpnu0 etrxf tatlm eluvol()truoxo3iodopt  fvil(fs2ta( p;o1apxn octltla2rm( o;t0 eerxo iydomt lnvs s t2xrim no4apenmfesasf Dur(m no4aetnmf3ils sDrluvp t0 lxrmr iodoa rln ilt) 2xmir3ny1oltelfvi tf ruru p;o1tpx  f3iyd s rlu pnt)altoxfctytlpt  ivi s) rtr(m3nu4op nmnvtatfsrra(  ;t1alxo ociadlsDrmu s;t)tetoir ty1lmD auvils  2urimpoo1am nmnvt (  Dtm( ooo4tet mo3tlt m2ua( p;u)trtnirctadomD an ol( t2tmim ou1lm emfei (  2uaum ot4tptoioetatfa ea( o;u0alxomf ootlptelieo;t)texoxopio4am elietl()aDur(m ;o0apenmfeils a2ul( s;(0aeeomr3ty1fpD livs (0seto(o3ny1lptemncs tfaDumxroou4olxnmfctat m2uln on(0aetrmociy1lm e u s;s0 etr(r3oodlpte ietl( aDtaxm oo4aee ifciatfm el( o;() leoifcootfp ranes;s)t2urxrpno1omt lnci s s2rax pno1oeen fetys s2rl(vsnu) ltnxf3ootlptran i s) 2toxopoo1omt mfvsl( artrxmpoo1tpt mfeiadla2eluvs (0teenircootoatrlu ilt)srtrxr3iudlmenlivta(faDtau poo0tpxoif3ildfs rau snu0tltrxo3iodomDeauvslt sexr(o ny1ale lnviat)a2tax  ou1tpxnioetasfsDrmu p;t0texoxf iatlm eln i s0 rumio iodlmt  ivta(  rrrx onu4olt ii3iatla rm(mp ()aexrxocty1la r ueo;s0texr(r3no1olee nvi s)s2rmuroou0aptnioeiys s rmu s;() lxomociydomteluvi s trto(mpiodale  ncsltfs2tm(mo;u1aeto fcild aDel( p;u4tlxnioctytfmt auvsl()trxmim nodop  lfvilsfsDraxm ou1altnmieiydfm emnmo (4trxnxrcto1fmD  i s;s)srtmxr ny4opee ici s s2trump;t0opx  ocilt m emnvpn()trerxf3oo1fatrlu slt) rxrxo3oodame  ict t) ruaxrooo1olt io3tytfs rmnvs t4 rerxr3tytfa eauvs;t srxm(opiy4lleelnvilt) rtrxro;u0tpeomoeildfm2eauvo;(0trxrxr iatop  luvo s0tetoir3no4am elnes (fsDurx  ;t4tee miciatfm2uanvpnu0arxnxf3tytoatelieol(0 2xm(o oo4am   ncias  Draxmo;t4opt if3iltfs emnmp;t)areoxf3to1op  aiei ( texr(r iy4lptnlfetlt  Durum no4tet if3iatla2umnmo;()texnxf ty1lmtelueols t2uo(m iudolt livia( sDuaxmp;t4tpeomieiyt a2rl(vs t)tlenxocoadla r n ilt0trurxm iy1olt  nci (faDrax oot0oee mfeiatfm2em( o;(4tlxnxo oadlmD  u sl(0 eum(r oydlm  lfci t)s2urx oot0oeenmfciasfa em( s;u4aetnio iotlmD  ues s teumim iu4lp emncils a2uaxmp;t4olx mietad mDeluvo (4 renir totfmDrli s s0s2uoxo no1olte nvtas) Dtrxroou4tltomociltfaDra(vs t4 ltnxo3totfptrau ols srto(mpiudamen nesl(f 2tax o;o4optomfciyslaDrlnmpnt0teeoxo tadla  anvs;()srumxm3no1al   ivtl(  Drr(r ;o0oet  fetytfm ua( o u) rtomocoo1fp  ai s;t trtrxo nodamtnmici s  2uru  oo4opt mi3tad s rmnvs t4tetrxfciatlaD  neo;s s2toxrpio1lmt  fviatfs2rr(m nt1aetomfcild s2rlnmonu4aetrxo3tatomD livils0s2xm(m io1am n nesas)srurx ont1oeenmociysfa2raumo;u4teeoir3oytlm eln il(0s2toio3oo4lmtemnciltfs2urum ;o4olxnmfeiasla2rln pnu4 ltomfctotlat au i;t)srxmxr3ou1altn fetltf rrr(ronu0tpxo fetysfmDel(mp;t4aeeomoctydla rlueolt) rtmxr ou1ol nlfvt tf Drrurp;t4apx mo3tyd m rmuvo (4aexoif iatop  livs;s) euoim io4lmenlies ()sDtrxronu4oet mictadfm ulnvo;(4alxnif iy1lm elivol()tetmxr3nu4apt  ictasfaruaxmo;o1aet mi3tltlm rlumo;t)tltrio3oatfp   i s ( sexriopnodaltelfvils  rtm(r nu4oeeoiicias s2ran pn(0 ltrmf3oytoptr ivo;t seurxmpiu1oltnmiesat  ruaxro;u0optoifcild m2eanmp;(4alxrxr to1fpDrlnvo;()t2urim3oodol   ivsa() rurumono1aptn i3iyd m2ulnmo t)tltrio3tadfmtr n s;s0teurxr ny4amt lnetls sDur( poo4oltn ieiyd a rm(von(4 reoxr oo1fmD  i slt0t2xr(r nu4olen fvtat)arum(moot0aex mfetydfaDranvsnu0trxrmociy1opDrlueilt) euo(r oo4lm e feilsfsruax onu1alxn i3ildlaDuauvp;t0 exnxrctatlatran i s teuriopno1op nmnvias  Drmu oou1aetoiieildfm2um(mon(0 rxrxf ta1om e uvils s2xmir3nydam emncils  2rmx o;u1aetnif3tat m2rm(vp;() etrmf3iytopD livsls)s2uo(o oudol e fcsl( aDraxm ;o0opt mieiadfa emnms t)aeeoif oa1omte uvo (  2toiopnydap n nei (fa2rru poo1tlxoiietltfa rlnmo ()tltnif iydfmDran o;t0 2um(o nu1al nmfcslt  rta(rpoo1tpxnifctadlm2ulnvp;u)teerxr3totfaDe nesls)teuo(rpnydop n icil(f 2umxrp;u0tltoiociasfm2emn o;t4 eeoir iadoatranvol() rxmxr nudam  micsa() Duaumpoo0oeeniociltfa2eaumsnu0aexrxrcoy1fatrlnvolt) euoxo iudamenlfvtltfs2rmxr ;o4aleo ieiatfsDel(vs (0treomo3iatlmteln ilt)s2umxr3no4omenmfei (fsDraumpnu4tltoiiciysls2ra(von(0 eermrcta1oat anvils0 eur(rpny4lltnlfvsa(  Draxro;u1tle  octldfm um(vo;t0aetoxf iytlpD  uvol(0sruo(m oy1amte icias arumurpou0tlxn oeiydfaDem( snu) ltoifcoy1fm elues;t0 2umxo3iu1llenmiviltf 2umx ont0alx  octadlmDelump u) ltomf ia1op   uvi;t0t2to(o3oo1ol nmivs () 2taurp;o4ole mf3tas a ea(vp u) lxnxr iy1oaDrau s s t2xoio3ou4lmtnlivil()s2tr( o;u1tlt mietlsfa um( p (0 exoir totfm  lies;s s2xm(mpiy1lmenmfvsltfsDta(rp;t4altn fciyslsDelumon(0 ltoxf3ty1lpDrln ilt) exoir3oydope lfvi ()sDtrxro;u4tex ioetatfm uluvo;t)tlenxfctytlat anvilt0s2trxr iy1oleemivsls)artax pnt0aexo i3iydlm rmu p;t4tetnxr tatla eai o;()teurxrpoodolt lfesl()s2umxmpot4alx iocildlmDrm( sn(0 lxnxociatfpt  u i s texo(o oydlpt licils sDra(r nu1olxoioeiydlaDuanmpnu0trxoif3oytlmtelueo;t) eumxm3io1omt livt sfaDum(m no4oee  o3tadfm2ranvsnu0 etomo3ta1oat aieo t s2trio3nu4oltnlicsl(fsrtm(r ;u1altn o3iad m2ean o (4alerircoadlaDean i;(  rxm(r3oo1lltemfet ()a2rmur ot1tetoio3iysfm elnms;u)texnmf3oydlaDeaivo;(0s2uo(r ny4lmeelneta( sDumxmooo0tptomietysls eluvon() lermo3totlaDeau ols)srtmim oo4olte feilt)aDurur no1altoii3ils m2rluvo (0areoxo3tatlmDrlneol()texm(m3oydllenmivt s)arurx p;t1ope mi3iytfmDua(vp;u0tetrmr3ta1om eluvo s0teuo(r io4opeemieslt a2trurono0olx mictytfs uanvpn(0tlerir3oodoatrau ols0t2toxrpoudlmenmnvsl()a2raxrp;t0tee miciad m uau snu0 reoir3tadfpD lnes (0trxrim3nu4amtnmnvsasfa2uaxrpoo1alxnmi3tyd m emnvs;u0tetomr3ia1faD auvol(  exoxo3oodapt  fci sfaDtm(mpoo1oexo i3iad s2ul( o u0 rerxr3ootoaDe n o (  eur(m3io4apt micilsfs2ur(m ou1altnmieiatlm2rm(vonu)alxrmo3tydlaD au il(0 rtoxr oo1lpe  nes ()sDumurp;u1olxo icildlaDeaumpn()tlxoxocoatfpD au ilt)t2xo(m nodlpt mfesltf Draurono4teenifeiytfsDulnmon(4aexnxf ta1oa  ai sl(0 euo(opou4op   ivia(f Dta(ront0aptnmocildfmDrmnmont0texomf3iatlptrln o t s2ur(opoydopen ietas arum(m no4apxo ociyd s2ulu s (0tltrxocootlptelnvo;s0srxo(opio4lle lfcta( arra(rpnu1oltnioctaslaDeln o;(4 ltrmo3ootfpD an ilt0 2trxm oo1lpee ietatfs2ua(mo;u1tlxnioeiyt m umuvs ()trxnmrcoytopte n o t0texmir nodll nmfvs tfa2rax ooo1apxnmi3iltfs ran o t0 eerxoctytlmDeaneo ( s2uo(rpou1alenlivi t a2ua(ro;u0opx iiciatfmDulnms t4 renir3iadfpt li slt)s2xoim nu1ol emivias a2urx pnu4oltnmicilsfs eauvo u0trxomo ia1fm  lu ol(0seuoir nu1ol nmncs tfs2taxroou4tpto feild m2eanms;t0teenmrciodlp rlu o;t  2xr(m oudop elivs s arrrumo;o4ope mf3ildlm2uluvs;t)trxnxfcia1fp eluvi (0sexo(r3iy4optemnesat)s2rm(rp;t0tleomfciydfsDelnvon(0aexoxo3iy1op eau s;s  eur(mpno4ol  lnvtat)srum(r ot1aptnmfetlsfa2rmnms;u4 lenxr3oo1fa r nvsls0seum(rpny1amenmivs s)s2taxrp;o0tpx if3iltfs eanmp (4trxrmr3tadfmDrauei t) rxm(mpnu4lm   fcsl(faDtmx  nu1tex ifctad a umn p ()altoirctotfp  ai o () rxoxr3nu4lmtnlnciatfsrrmxm ;t4aeto fcilsfs2el(mo t0 lxoif3todlpt anvs (0sruoim nydlmt  fes sf 2uaumpot1alt ioetltla raums (0trtriocoatfptrlnvi s0trxrxopoodop nlnvsls  rur(r ;o1tltn fcildfs2raumpnu0tltnmo3iatlpDeaivo t s2xoxrpoudll   nctas sDtmuronu0tleoio3ilsfa umuvpn()aleoir3todoate u o;(0tetm(opou1lp  lnei sfsrumxmonu0oetnioctyt sDum(mpnt4aetrxr3todlateln s;s tetmir oy1ap  mivslt)arum( pnu1tltoio3iyd a2ran sn()tlxrio3iydopDeai o;t  exrxr oy1amte iviat)artrxm nt1oee  i3iltfa emuvpn(0artrio3to1op ean i ( sexr(r oydamenlfctl()s2uaumo;o4apt  f3iatlaDra(vpnu4tltnir3iy1fmDr uvi ( s2urxmpiy1lm emfcsat)aDtmxm nu0oetoifeiytfs raump;() rxrmf3iatfat lieo;s s2uoxmpnu4ome miet s)a2um(mo;t4teenii3iyslmDelu o;u0alenmo3ta1fm   nvs;s)t2um(r3nudop n fvslt  2tmxm nu1oeenmf3tltfm ua( s;u0trxrxrciytfatrlneslt)teto(m3oudalee fctlt)aDua(ro;t0tltn oeiydlmDulums (4 lxoxfciatlat  u il(0 2trxrpnudaptnlivsas) rumxroou1ape if3iadlaDrau o;u4tlenir3ty1laDr uvi (  2trxr3nudolenlncsasf rrmu oot0olxnmo3ildfa2rlnmp;t0trtrifctotom elivi s s2umim3no1apt  ivta( aDtaumpot0oltoiocils m2rlump;u4altoxfctodlaDe ues;()t2tmio3iudal n fvil()srra(rp;o4tpt  i3ildfaDulnmsn(0artnxr3oydfp eai i;()s2toim ny4om  mfci s) Drmx  nu0oleoiiciytfs2elumo u)aexoxrctatlmtean i;s)t2tr(r3ny4lmeelnvs s s2rm( pnu4apxnmoeiydla emuvp t4tlermrcootlaDrlueo;t0seurxmpno4al emneiat) 2trurpot0oee ifetatla rlnmonu4 rxomrciadlm rlivsl(0trxoxm ny1am elnvi s a2trxrp;t0tlxniocilsla ul(vs;t) eeomr iatopDelu sl()t2to(o3oydal  mfvtl( sDtm(r ;o1tptnmoctysls2uauvp;t0texrmocoadla rlivs;t) rur(mpiu4al nlnct t)s2trumono1tptomociytfs rmn o;t0 exnmf3oytoaDr i ils seurxopnudlleelncsl( srtaxr nt4oltomo3iyd aDelu o (4arxomr ia1fmteanvs;s  2um(m oo4ol  livilt)artau oot1tet  icildlm2rmnmpnt) etnmrctatlptean olt s2xo(rpoo1amtnmneils a2rmxmoou4olt  ieiad m2uln o;(0alxoxo3oydfptrlueo;t srtm(r3oodolee fcil( a2tmxrpot0tpxomo3tysfs rlnvs;t4 leoif ta1fmt an ols  rtrirpoydlme mnvs tfartrur nt4aee ii3iytlm ra(von(0trxoio todom r ueo s  euoiopny4lm  mncils)s2ra(r ot0ole iieiydfm rlnmp t)trtrmrcootfat  uvi;(0s2tr(m ou4amtnlivs (farrrurpnu0tlen fcils a el( p;()aexnif ootfmDe uvols0t2uoio3nodoltnlfvi (  Drax  ot1oleomo3iytfaDel( o;t0arxomr3iatoptraueo t0t2xr(mpnu1am elics sfsDur( o;o1tpeomfcilt m rluvp;t0 lenmr totop eln o ( texmir oudoleelfvi t)arum(m ;u4tpenmi3tytls2rmums (0tetnio ootfm r n o;t texo(m io1omee nctas aDtaxmonu0tlen iciat m uanvs u4aeenxrcoodfp eaneo;s)truo(r3iydapeemfci (faDururoot4aptomoeildfsDem(vpn()trerir tadfmtrlu s s  2to(r3oodop   nei ()srrr(rpno0olxnifctytlaDea(vp;t4 lenxr ootoa elivsls)srxmiopnodlltnmnci sfsDtaxm oo1alen ictldla eauvo;t0tlxrmociodlaD  u o s  eumxm iy4lp emfvsa()sDrax  oo4tetomo3iysfs uaums t4areoxf3oo1fp raueols0 2tmxrpiu4lleelnesas arrmx  ;t1tleoifctydlaDum(vs u4altomr3to1laDe nvo t srtrio3nydlle mieiatfsDuauroot1opxnii3tytfsDrl(vsn(4 lxrio3oydfmDr ueo t srtrir iy4ole mfvta( arrmu  ot1apxnmfctydlsDeau o;u4arxrir oytlptrai s s)teur(r3no4ale  ics tfsDtrump;o1aexo i3tasla2em(mpnu4tltnxrctatop eli i;t0 2umimpoudop   neiat aDurxr ;u0aexnifetad s2rmnmont0tetnif ta1lm eaivs s s2to(rpiydamen fvils) 2umx ont0tlxoiieiatlm2ulnmonu0 etrmo3totlp  lies t trtr(opiydalte nesa()arum(m no4open ieiltla rl( snt0 etoxf iotlmDelueols) rxoxr nydoptnmnvsa(  Dumx pnu4aeenmfeiltfs umnms (4trxnxr3tydomDelu ilt texo(rpoodol nmiesatfa2rm( poo1opto o3iyd mDrm(monu0 exniocoatla ran o;(0seuo(o iu4lle  fvt ( sDua(mpnu4tle  f3ilt mDraumo;(0 etnmrctatfpD aieol(0s2uoxo nu4lpen nvs t)srtmumo;o4olen ietlsfm raump;u)artrmr3totlp elnei;s)setr(opiydlme lnetat s2trurpnu0oeenmoctas s uanvp;(4tetrxr3ootlateaneo;t0teurxr3oo4lpeemiviasfs2tr( ont0olto oetatfs2ulnmo;u4aeeoxr tytoa ean il( srtrxrpiu1om   nvtat) Dumxmonu0tee ifeilsfmDul(ms;u0texnxr3io1op e n i;s0sruo(m iu1ame  ivias arurur ou4olt if3iysla em(vs u4 rxrmo ootlptrau ols0t2xr(mpoydamtnmiei t)arumumpou1tpxoioctldfa uln o;(4aexoxo3oy1op raies s0 euo(opoudol   feslt a2rm( poo4aetnmo3iydlaDul( pn()tetrioctatlatelivs;(0trxrxr3nudape lfvt ( arururo;t4ope mociytfmDrl(vsn(4 rxrmo3oodoptrauvol()sexoimpiodlm elneilt)aDurx pno1tlenmocild a2rmumonu) exomr3to1la rai s ( s2ur(opno4alenlnvt sf 2ta(  ot0ope iictydls2em( o;()tlerxr iotopteauvils teum(o3no1apee ivtltfsDurx p;t4tptn iciyt sDel(vp;u0 etrmociodopDranvs s0trxrxrpiodlptelivil( aDta(moot1aexnmf3tytlmDem( p t4alxnmocia1oaD luvolt  2xrxo3nydllenlnvtls  rtaxronu1tltoifciatfa2elums t)alxomfciytlaD lnvi;t  2xrio nudal nmictat artruronu0tex mieilsfs2uau s t4 rxnmr3tatla rlu il(0s2umxo oy4apee nei (  2rm(mo;u0oet mo3ilsls rlu snt0alxrxf ty1fa  auvs;(0 eurxrpoudome  icta(fs2rmx pnu0altomietytlsDea( pnt)artnif3oy1omtranes;(0 2tr(o iydlpe lnvils artru p;t1alx iociytfaDumn p;t0 ltnxf3to1oateaies;t trtmim no4ll elnvsa(fsrtmx poo4opt mi3tas mDeau snu4arerxo todlatr nvilt  rxrio no1oltelfei sf Draum ou1oexoioeiydfa2ranvo;u4texrir3tytlmtelueolt  exrir nu1llee nvsasfaDtm(m ;o4tpe mfciat aDranvonu)aleoifcoytoa r ivi;s)sexm(rpoydlpee fcias artmurpou4aexnmf3iltlm2rlu o t0areoio3iotfmt auvo (  2um(mpoudlpte ics s)sDtm(rpoo4olxn fctls m2rmump;t)aexnif iadlat  i o (  rxmiopiydom  liciatfa2rrurooo4oex moeilsfsDulnvp (0tlxrmf3iotfm r ies;s0sexm(opnudlp nlici tf rur(r ou0apx iieiytls elnmsnu) etomr iotlat lueols)srxmxo3no4aptnlivta(fsrtrxm nt0apeomi3iaslm uanvp t)arxnmo3iodfaDr i ilt0 2ur(o3iy1ol nlnvt s srum( o;t4oleoifeilt s2elnmo;t4texnxocoatom r uvil()teto(r nu4ll nlneta(fs2raur ;u4oee mictysla2um(mo t)trtrxo3iadfaD ln i t  2uo(m no4amtnmncias)s2umxrpno0apeoiieiyd sDulu p;u0 rtrxf iytoaDe nvs t) eto(opoy1apen fetlt) 2tax ono0olxn icilsls2umump (0tleoxo3io1fpt  nvils)srumxo ny4amtn fctls srum(mooo0oex mo3tldfm2umu pnu0artoir tadfmt ln ol( s2trxr ou4lp nlfes ( aDururpnu4tptoiiciad aDraums (0 lxrmf iy1opDeai ils)srurxm3oo1lmen fesls  2uru pot0tltoif3iasfsDea( s (4 eeoxr3oa1fateaivi t)sexrxo3no4lmeemnvtatfs2uau p;u0tpe mictltfmDumu s (4tltoxfciatoa rau o ( seto(r3no1om  mics ( s2tm( oou0oee  fetys a2uluvp;t)tlxniociotomte neo t0s2tm(opoy1llee fcs t arumx o;o0teeniieilt s elnvp;()tltomo iodop r nvo;t s2to(r nu4lmt mfeslt)s2ur(mpot4oee moctytlmDul(mo u0 lerio3oytfmDrlu olt  ruoir ny1ameelivi ( srum(mp;o0tlxniiciyslsDua(vo;u)artomf3oodoatraivilt)s2xmxm3no4alt mivils)srtr( pno0tlxn i3iad m2rlnvont4alermo3iatfat  nes;s)trxm(rpno4lptn nvsat)srtrxrpno0opxnmfcilslsDemuvs t0aexrmf ia1faDrlneil(0s2tmxr ou1omtemfetasf Dtmx o;u4tltoif3iyt a ulu p () renio ty1fm eauvol( seurir ou4ll e nvtl()sDraxroou1oleoifetad a ulnvon(4 rtrxo ty1fatrauesls0 exmirpiudomee ncsat) 2ta(m no1opeo ieiat s2emnmo;t4aexomf to1fmtelieo;t truoiopio1ale mfes tfaDum( pno1oex moeildla2em(mo;t4alxnir iy1lmD  ivo t sexoxo oodomee ivt (fartm(ro;u0tltomo3tatla umnvp (0aexrxr3oatomDr uvo;(0s2tmxopoo4am emivi (fs2rmx onu0aptoiiciadla ua(von(4 rxnxr3io1fm  lnvils) 2uoir no4om n neiltf Drmu p;t0apenmiciat sDulu p t)alxomf3oy1op r ivils  euo(m3oy1omen fetl(  2umx poo4oexn fciysfm2el( s t4teerir3todlaD ln s;s texmxopoudaltnlnetls  2truront4optnmoetyd a raump t)tlxrio3iadlaDrauvs;(0trtmimpoy4omenlfviat s2trurpot0aex  ietlsfs eluvont0aeeoirctytom  lnvs s) rtrxo nu1lpe  neia(fsDrm( pou4aleomictltla elnmonu)trermr3tadlp  lnvol() rur(o iudam  lfeta(fa2rr( ono0aex moetld aDranvpn(0altnxr3iotlpteaues;s)sruo(o3no1am n nesas)artax ooo1aetnmi3ildfaDuluvpn(4arenir3oy1fmteai ils0srtrxrpiy4op  lnciltfa2rmu o;o1apt mfciadlm rmums;t4 rtrmo iydfa eli s t  2toxo ou1omee nvt () rur(rp;o1tlx moctlsls ul( s;(4 rxoxocta1lmt  nvs ( tetoio no4lmenmfetl(f 2ur(  ;t1alxnmieilsla2umnmo u)altnifcoo1lp rli i t0trum(m iydlpenmici (  Drau p;t1tpxnmo3tatfaDulump;u0tltoxr oytop ranvo ( srtm(m iy4amtnlfet ( srua(mono0oltomfetad a2em(mont)aetrmoctadlp raieo;t  eumiopio1ll nlicils) Dtaxrpou0openiieils sDum(vp;t4tlxoir3oy1fatelieol() 2tm(m iy1lme  netas aDraxmooo1alxnifcildlmDrau p;t0aexrxocty1lpDe nvs s0truoir iu1olt  ietat  2tmx onu0tex iietldfm2emn snu)artrxr3iytlat aieol()trtmxr3ou1am elfei tfsDtrur oo1apt mi3iltlm2rmnvsn()arenio3oo1om r n ol(  eur(mpiu4lpee fci sf rurur nt1aeeoii3iatfmDrmn ont4tltoxr io1lmt  nvslt)seumim io4apenlfeilsf 2ur(  oo4oeenmf3iadfa2ran ont4texrmo iadop rai o;t0s2uo(o3iodamen ics s)artau pnu0tlx mf3iyt m rl( pn(0tlxoxocootom eaneilt0tetrio oy1ope lneil( s2rmx onu4apxnmieiatla2umnms t)trtnircoadfptr n o;s0 exmxm io4amen fvt sf Dum(rp;u0aetn fciad aDeauvsnt)teeoircoa1oaDeaies s  2toxo ny4ap e iei s) rraxrpno0tet mieiyd s ran o u)tetnxr3io1latraivo s0trto(m3oo1apt  nvtas)sDumx  ot0oet mo3ildfs2um( s;() exrmf ty1opD lues;t s2xrxm ou1ope mnvsls)srrmxronu4oeenioctysfm eln s t)texrio oadlptr u i;s) rurxm3ou1lm e ieias arra(m nu1aexoiietyt m2emnmsn(4artnmo3iatfate ueo;t)trxoio nydopt  nesl() Drmumooo1oeeomiciad sDulumpnt0 lxrmo3ootfmte n o t)srtmxr io4lmtemnvi (fartm(mont1aeen f3tys m2elump (4teeomocoydfp rau ol()t2um(rpou4omtelivsas)s2rmu pnt1alxnmietasla ean snu0aetrmf oydom rau i s)s2uo(m3oudop e fei () 2rm(rpot4aet mi3iydla raump u0arerxociytfmt anvi s)seurir3iu1lm e ivs ( s2ra(  oo0optoioctldlsDem(vo;(0trtomr ootfpD lneo ( t2uoir nu4lm nmieiat)srrr(rp;t1teeomi3ils sDeaumsn(0 lxrxo iytfaD  n olt0 eurim3oudale licias artru  nt0tlxniiciydla2umnmsnu)aetoxo iatomDranvi t0seur(r iy1am n nvias)sDur(mpoo1aptn feiysla2rluvsnt4 lermociydlaDrln s;t0setrir iu4lp nlnvs sfartm(  ot1teenmfcils aDrmuvsnt0tlenxrcoadomtelneslt sexoim io1oltemicil()sruaumpoo4oeenmietydfmDrmuvo;()trxomr oytfpDrluesls  etoio oo4llenlfesa() 2trump;t0tlx mf3iytfs ua( sn(4altoxrcoydopDeauvo t)teuoxm iy1openmfes t  rumxrpno4tlx iieiyd s2ua(ms;(4teeomf iodomte ies;t)texmxopoydlmt  netasfsDrm(rpot1tle ioctls a el(vsnt0 lenxr3iotopDrlivols) 2trirpiy1apen icia(faDurxr no4oeeoifciat a elnmpnu)tetoxfctydopDeaneo;s tetrirpno1al nmnctas  rurxronu0texoifciad a2elu s t0 lxomr3oa1laD  n i t s2xm(m3oo4omenlneiat) 2ur(root1oltn feildfm2em(vs t)tlxoxfcta1fmDr i i s0tetoir3oy1oleemnvtls)aDrr(mpot0alt mictatfs2ra(msnu4texrioctodlm r uvils)s2trirpno1lpt lict tf rta(m oo1oex  oetls aDel(vo;t4aetomfctotfat li s;t)tetoio3ou4alt lncta( a2um( ooo4opxomf3tasfmDua( o t0 rxoxo ty1lp  aivslt0 2toirpio1lmeelivs t) 2urxrpnu0tlenio3tadla emnmp (4artoiocoatopDrau s t)srumir ou1lp  lici t aDrrur no0tpen octadfa2ul(msn(4areoxf oodla e nvils0srxo(mpio1al nmict t)aDtau poo1ale micildlm emnvs t4aeeomo oytfpD aivi t)texoxrpnudop nlncilsf ruau onu1aetnmi3ildfs rl(mont)tltoxr iy1om eaueo;(0trtm(opnodopenlnvi s a2umxrpot0oex  ietaslaDrmn o;() etnif tydfmt lnvs ( trur(o ny1ap   ivsls)srrrxr ot1aet  ictasfm2eau p t)areoxrctytfmDrlnes;s s2xrxr3io4apt livs t a2ua(m ;o1tetoifeiatfs2uan pnu4arenxo todfa e nvs () 2tmxm nydlptemnvt sfsDta(  ou1apxnmfeiyt m el(vo;t0 rerir3oytomt  ivs t)trxr(o oy4op  mnctlt)a2trxr ;o0opxoioeiyslm rlump;(4arenir oodopt  ieo;s)t2xrirpou1altemieias aDtmumpoo0tet mi3tasls uauvp;t0aexniocootlptelnvsls0trumxmpnodalenmnei t sDur(mo;u1olxn octld sDranmo;t) eenio3tatfptelnvo;s)sexo(m iy1lleemncsa(  Dra(rpnu4aexnmo3tatfaDum(vo t0alermf3todoaDeln o;s)srurir nu1ome lfvsasfa2trxrpno1tpxoiictyd aDrl(mpnt)trenio todlpD livols)t2trxm iu1lp n icta(  Drrumoot0tee mfeiad mDuan o t0texrmo3ia1lp  lies;s0 2toio ny1aleelneilt)sruaxm ;t4oexomieilt mDraumpnu)aexoxocoa1oaD  ivi;t)trumiopoudoltnlfvt t)aDurxmpou1aeenmiciysls ea(vo;(0 reomo to1opD  uvs;s0 rxm(m3no1al  mfei s  2urxmpou1alt  fciltlmDra( pn() rxrmo totlmte uvo;(  etr(r ny1aptn nciasfsruau pot4aleo i3ild m el(mo;(4 exoir oodfp  ai i;s trtr(r3nu4op  lfvtls) 2tmx pno4ale mietadfa2raums;t)aetomo3tatoat lnei;s  2trxm3iu1lpe lfci (fsDuau pnu1tpto octytfm eanvp;()alxnmfctytlaD luvs s0 exr(mpiudom elivi t)a2trxm ;o1tetn o3iaslm2ra(mp () exrxo3oatfa   i o s)srxoir3io1altnmfeil( sDrmur nu4aee mf3iysfsDul(mp u0 etrxrctydomD aivo;t)t2urxo oy1al nlivtat srtrur oo4oet  f3tldfm ra(vo;u) rxnmr3oa1op   ies s  exoxm3iudalt mfeilt)aDtru pnt1aex  oeiydfa2umnms t0 ltnxf iytfm e ivi;(0t2xmim3no1lpenlfvil(fsDtmxmo;u4olxniociydfa umnvo t)trxomf3to1la r ivo;t)t2xmio3iydopt lnesls  Dur(ro;o1opeomfctydls2rl( pnu4 rtnmr tadlmtr u slt srtoxo io4lmt liciasfaDrrxmono0opxnio3iydla umnmo ()arxrmr ta1op  aivil(0sexmxm oy1openmnctat) Dumurpno1tltoioeiysfm ranvs u0 etoir iy1fmDeliei;t)setoxr3no4amtnmfeil() Draxro;t4opxn fcilt sDel(vs;()tetrxf3ta1fp eai i;s  eur(mpno4lmen fvslsfsDrmx pnu1apxo o3tltfa umumsnu)alxrif ty1fate iei ()srxmim3oy4ame micia(f rrax p;t0apt iiciad m2eanms;u4 lenio3oydfa  aueo t srumxr3ny1lme  fvilt sDra(ro;u1tle mietat s el(vp;u4 rtnxo oo1omDe nvo;(0srxoxo nu1ameelivs tfarur(ront1opxnmoeias s uanmo;(0 lxrxocio1lpt lneols0 2umxo nodope livs (f 2ur( p;u0alxomi3iys a raumpnt4tetoif3tatlmtelnei ( truo(m3iudaleemnei (  2raxmono1tltnmoctysfs2um(mo t0tlxnif iadfmt  uvslt0trum(o io1ape micsl(farrmuronu1ole mi3iysfa ran s;(4 rxrir3to1lpt li s t)srtmxmpnu1amt lfvta()sDtaurp;t1teeo i3iltfmDem( pnu0trerifcoo1lp rlivo s trto(o3ny1lptn nct sfaDum( pnt0aex ioeildlm2ea(vo ()alxrif3tytlmDrlivols)trtmio nudalte fci () 2ta(mpno1tlt ii3tatfm ulu pn(0tleomrcoy1opt  neo;(0texm(opiy1ap   fcsa( srumxr oo0olxnioeiydfaDum(mo (0 ltrxo3ootfm  luvs;t) rtoir3no4op nmicilt sDtru p;o4tltn feildlaDemn o t4tlxoxociatoaDrauvi;s0teuoio io4optnlieiasfsrtaumpoo0openio3iadfm2uln s t)altomo3io1lmDran slt)t2xoxmpoy1ape  ivi s  ruru  nt4alxnio3tat m emu s (0 rxoir tytlpte nvi;t0 rxrir nu4lme mnetas)s2urumpot4teen oetatfs ul(vp t)alxnxr oadfa rauei;( seuo(mpny1lm  mfcia( arurxmpno0oex  fctldfa rm(vsn(4trerxr3iotlm ranvi t0srurxmpio4amt lnei s aDua(mpnt0tleomieiys a2eauvpnu) lerxf3tadoat lueo ()t2xrxo iudoltnmfvsatfsDtaxrpnt4oltoio3tydlm2ea(msnt0 exomo iydom eluvil(0tetrxo3io1olt mfesatf Drr(m nu4oeenmieiadfaDuluvp t)trtrif iydlat auei;t) 2xm(o3nydapte fvsatfartmxmpoo4alx  o3iys s2ua( pn(4 etrifcto1op   nvol() eto(o nu1op emicsls arua(rooo0apxomo3ild m rmu s t0altomo ootfat anvilt)trxrxm iy1ope  fcsl( srrr(  ot1apenifeilt sDul(von()artnmo tatomt  ivi s texrxr no1om  lict ( a2ta(  ;u4oetoiieiysfs raumsnt4tltnmf iatfpt  nei;t  rtoiopnydam elfcias) 2rau  ;u4tpeomiciatfaDul(mp u0 lxrio3ta1oaDeai i;s0 rxrxm oydale lfcs (f rrru pnt1oetomoeias a emnmp;u)tetrmf oa1lmD livo;s s2ur(r nu4om   iet sfs2rrxr ;t1tlt mi3ildla2uanvpnt4areoxo iytlmDrai ils) eumir oo4lmenlieils  rumu poo4tet  i3iad s2um(mp (4tetnmf oodomDean o t) ruoxmpny4opt  fei (faDrrur ;t4optoiicilslmDumuvs;()arxnif3iydla  livols  rum(opoy4am nlnei t) rtrx onu0ole  fciatfa eanmon(4aexrmo oo1lpt anes;t0 rxmir oudam elnetl( srtaxr ou4oeto ieilsfa ra( snt)altomf iydopt auvi;t texoxmpiydap  lnctasfarrrum ;u4texomoeiydla2rmn pnu0trtomf3to1lpDranvil(0sruoxm iu1omen ivtasf rrr(m ;o4tex mieiltlaDum(vp;u4 eeoif iydom rau ols srur(o3ny1llt licilt)s2rr(mo;t0oleniieiysfmDem(vo () exrifctydopD au s t t2xmxm iy4ape  ivslt aDrru oot4apxoiieiltfaDrluvonu0 exnio3iytfm e uesl( t2trxr iy1op  mnesa(f rtmx o;o4oltnioetys m2rau p;(0 rxnxr3iatlaDrlueo;(0teurirpiodomtn fet t) rumumonu0tpx mi3iatla2uanvo ()teerxocta1fp   nes;t0setr(r3nodol emivs (f 2um(r ;t1alt ifetysfm2elnvs t)altnmoctatomD lu ils  exrim nu4amenmicsls  rur(mp;u1oetnioeiltfm2ul(vs;t)aexrio iodfpDr i s s setm(mpoodllte fci ()aruru p;u1tlt  ieiadfmDrmumo t4teeoxo oydoa elivs;t)texrxmpny1ameelicil(faDrmurpnt4apx mfctydfs2uaums (0trtomr3iotomDe ivs t) etm(opoudop nmfei s) 2tru o;t4oleoii3tasfm ea( o () eeomr3oy1la e ivi;( s2tmir ou4al nmncsltfa2uaumpot0oetn i3ils m2uaumpnt0 lenxo oo1oa e ivils0trxo(o3oydom emnei s)sDtaxr ;o0aleo feiasfa2elumsnu) rtnif ootomDeaieilt0sexrxo no4lpenlncilt a2tm( ooo0openmfciysfm2emnmp t0 exnxfctodfa e nei;s)t2trxo3iu1op elncilsfs2tm(mo;o0oee  f3tytfm2rmumo t4tetnmfcoodfptrlnes;( sruriopoo4ol   neiasf rtaxm ou0tptn feias s uan p t)tltrmo iytoaD  ivil(0 rxoxmpiudope liviatf 2rr(  no0opxnii3iadfm el(vsnu) lxrmr tatfm elu o () ruo(m iodop e nvsls s2trxr ;u0ope iieiys m2emu s () rtoifcootlmDe uvi s) eurim ny1ole lfcs ( sDtm(ro;u0oexn ieiad a el(mp t0artomr3oy1fp rlueils0trxmxr3ny4alen fet ( s2umuronu1apeoif3tysls eanvsn() exnxr3iodop r n o;t) 2tr(opnydomt  fetlsfsDrrump;t0tpxnio3ilsfs em(mo;u0 rtnmr tadlaD auvi t t2to(m ny4olt lfeta( sDtr( p;t4oetn feiltfa2ulnmsnu)aexoxoctodfa eli i;t0t2xo(o3iy1lpe lieil(faDuau pno4oeenio3iyt s rauvsn(0artnmfctotoa ranes;s)s2uoxopoodome mfvilt)aDrauro;o1oexo fctls a2rm(vs t4 exoxrctatfmtelnvol()srumxopou1oltnliesl() Dtr(mp;u1opt iietad m2ulnms t)tlerio iotomtrlneol(0 rur(o ny4amt lfcs (fsrra(mo;u4altn ieilslm2elnvs (0texoio oytfatr ieolt)trxmirpno4llt mfeta(fa2urx poo0tpt if3iyt m rm( s;(4tetnio iydfaD aueils s2umiopio4ol e ncta()arumuro;u1aeeomfcilt s2rlnvon()treoio3ty1omDeluvilt setmio nodllt mfvsatf rtaxmp;o4ale mocils a2elnvsnt4aeenxf iatfm e n i;()s2xmxmpnydlpeelfcslt  Dtauronu4alxnifcilt sDuau sn(0altrmf oa1lpDe ivslt teumiopiy1aleelnesat)artmuro;o4tptnmfeiaslm2rl( o u)areoxo iytlpD  uvi s0 etrxo3nudopeemics s)srrr(mpnu0apt  o3tytfaDranvont)teenmfciadlpteau s t seum(o3io4omenlietltfsDtrxmpnt0apenif3tydfs em(mpn(4 lxnifcoytfmt  ivo s t2tmxmpoo1open icils sDuax oot0apxomoeildfm2rlnmsnu0tlenxr iadlpt livi ()teumxm no1amee feias)aDuaxmooo0tetomoctas a umums;u)tleoir3oydfptrai s t trurxr nu4lp emfci tfa2rrx p;t1opxnifciad mDrm(vs t)tlxoxo iadoate uvsls  rumxm3ou4open fctls)srrmu p;u1apenio3iltlmDea( snt) lenmrciytfpt aieilt0 2uoimpoydoptemnciatfaDrmumono4tltnif3ild s2uaums;t0 reoio3io1fmt  u olt) rumxo nu4ap emfeias) Drm(m ;t0aee  ieiasls2um(mp;t0aeeoxfciatlaDe i s;t)trumxo3oy4opee fviat sDrm(  ou4ole ioeiyt mDumnvs;u)arxomf3iy1lpteliei;s) rtr(m iy4opee ivt tfs2taxm ou0olxnioeiysls umu p;(0trtrmo3oytomt livo s0 2trir3oy1lm elneilsf Dumu ont1tpe  feiltfa2rm( p u0teeoio tytomDraieslt)srxm(r3oo1ap emietls  2rax pou0tpt iocildlm uln s (4aexoiocootfp e iei;t)truoxr oo4lp emfet tfs2uaxmoou4texnio3tyslm2ea( pnu4artoxfctadom e ivi s0 2tmxr3ou1ol nmfesat) 2rm(r ;u0alxnmfcilt m2uan p;u0tlxoxrciydlptr u i;() 2um(mpou1lmt  fctl()aDtax onu0aptn icildfs2rm(vp (0 exrxr3iodfat aues (0t2xr(mpnu1oltemfct t sDrru  ou0alt iicias s rau sn()tltomfciotfptr uei;(0 eumxm nudaltnmnei sf 2uaumpnt4tltnioeiatfsDea(msn(4 ltrxr oadoatelies;s0 rtoio ou4lpeemnesat a2urur ot0ape if3iltfaDrl(vont0alxrxf3tatlm elivs (0 ruoxm3no4lp nlfcsas)s2tmurp;t0optniieiyd sDra(mp;()alxrio tatlpDr nvils  2xr(o iodllt livilt  rumu  no0oetnmi3iytlm2ra( snu4texrif io1laDr neo t teto(rpoo1aptnlfeiltfsDrau p;o1aee mocildfa2ra(vont4texrmf3io1om elnvsls)t2tr(opiu4lptemfcsl()arumurooo4aeeo ietltfm2em(mo;u4alenir ty1faDeluvs t0texriopiydap emfvtlt) Durx pnu0optn oetytfa2uln s u) rtrio3oatfp rln i s)seum(o ny4apt  fesls) 2tm( o;t0tlx iictys m2rm(mp;()altomf3oatlaD anvi ( t2xmxopoudlm nmfciltf rtm(rpno0optnifeiysla um( ont4tltoxf todfa rlueil()srtr(mpnudop elnci sfsrrmur nt1open oeiyslsDean pn(4 lerxf3totlpDrlnvol( t2umxo3ou4omt mnvi tfsDrrxmpnt1oeto oeiadla2rmuvsn(0 lenxrciadopD aiei s)t2urxr oudale  ici ( aDtmxm no1oee  o3iat m2ul(vont)alxomfciatlp  an i s seum(r nudamenlfesat)srrr(mpno1olenio3iatfsDrmumpn(4 rtniocoodoa eaies t srurir oy1apenmfetlt  Dua(rpnu4aeto ietldlm ea( pnu)trxrxocoo1fa   nes ( t2uriopiudalenlnvtls srua(monu1aeeomocilt mDuan p;t4 ltnxr totoateaueo () 2tmxo3iy4lltnmfetls  2rrx poo4tpxomfctyd a2uluvsnu0aexoir3oa1lpD ai il(  2xmio nu1ol nlici s  rururpnu1oltn ieiydls eanvs;(4aeeomoctodom  liei s0trumxr3oo1op  lnesl( sDum(r oo0alt mo3iydfm2ran o;(4trxomo tatopDean s s0 rtoxo3oy4amee fvil(fartr(rpot1aeen i3tldlaDul( p;t) rtnxf3oytla e nvs t0s2xrim3ou1al e nviasfsDuaxm ;o4alxniocilt sDumu p ()tleoio3tatom rlnvi;s0 exrimpiu4alt mfeta(  2umurpou0opeo ictls s el(vp;t)tetoxfciy1omD  ivs ( teto(o3iy4ll emicsas  Drmuroou0open ieiytlsDra(msnu)tlxnxfciatlaDeaies;(0sexrxopoo4lle mfet (f Drrxmpnt1optomfeiad a2uau p t4 eenio3to1op elnvo;s0tetmim3iu4ame  nvias srua(m no0tetoioeiysfa2rlnmo (0arxnif3todoaDe uvs s  rxr(r ny1ome  ivi ( aDtr(m ;o4oee iociasfs2ra(vo (4artomo iytoa e ueslt  2xo(m ny1om  mnvta( aDurum oo4olt if3iltfa rluvp;u0 ltrxrcta1lpD luvs;()srxrio nydape  nctl( sDumu  nt1tee mo3iytfm uaums;(4 rxnxr tydlmtrau i;s0t2to(m3ou4aleemfcia()a2urxmp;u0aetomi3iydfa2rlu onu0treomf3io1fm eauvi;t) 2um(o3iydlm  mfeslsfaruaxmpot1olxomieiydls uau sn(4altnircoadlptrauvs;t)s2umio iodoltn fcta(f 2uax  ;o1ope mfeilsfmDuanvo u) rxoxf tytfm r ivi t sexmiopiodlm   nesas) Draxr ;o4ale io3ilsla em( snt4arxrxo3todoat  nei s)sexo(m oodol n fciasfartmum no1tltn o3iadls2ul(vs;(0texomo ta1lpDelivolt)s2uoio no4ll  mnctasfa2uaxr nt0tet if3ilslm rm(vpnt4 exnxo3oydlateluvo s0t2xmim iu4ll elfesl(f 2rru o;u1aexn ieiytla2ulumo;u4tleriocto1la rau sls t2xoxr3nudale mivtlt)aDtm(  ot4oex moeiadla emnvs u) renxr3tatlaDeauvi;s)texoxr io1ll n iei t aDuau pnu1tpt mfctls a umumo;t4tltrxo3iatfat anei;(  rxo(o iu1ol n nvt (  2tm(m ou4teenmietysfm ul(vonu4trtomo3oydfpt lu o s tetmxm nydopt lnci ( a2rmx ono4oee mieildfm2eaumsnu) renmrcoo1fp eai o t srxriopou1lmt mies (  Dtrxront4oltn fetasfm ulnvpn(0 exoir3tadlm raues s) 2uoir oudll e ivs t srra(ronu4tltn iciatfm ea(ms (0trxrmf tydfmDraieslt0t2trxo3oo4omee fcsas)srtrurpno4opxnmi3taslsDrm( o;(0tetnxfciydoateluei s) euo(r nudlptnlfeia( sruaur ;t4aeeo o3ildfs em(mp;t4alxrmr iy1laDr i olt trumxm oo4apeelictat) rrrx  ;t4oex  o3iltfs ul( p;t)alxrxfcoatfatraivi s0seuoim iydolee ies sfs2rmx pou1apen f3ildfa rauvo;u4trxomf3tytlatrluvolt)sruoir oudol emnciat) 2rm( o;u0apx if3tltfa uln o u)tlermo3ta1op elu i s0 2xrxm3ny4amenmfeiat) Drrxronu1tpxomo3ilt s rl(mont4trtrxf iodfpt lieo ( trxo(mpny1lleemnetls aruax p;t1olen f3tydlaDrln pnt4 etoxr oatfaDeliei t)s2xrimpiudlm nlfet s)srurx p;o0oeeoiociatlaDuaumo;t0areoxfcoy1lp e i i s  etm(m oy1olen ivi ()a2tr(mooo4optnioetatfs2rln p t4alenir3oy1fpDrau o;s  etr(o3iy4lp n fct (  Drru p;u0tpt  ictytla em( snt)arxrioctodfp rlneo ()srto(rpio4lleemfciatfs2ra(  nu0oexoif3iltlaDemn s t4tetrio3iadlp r u s s0trxrir3oy1apee fesl(farrrxmo;o0opxnmo3tasfaDrl(mp;t0 exoxrcootfa   nei;(0 rurir3nu4apt  netas sruax pot4texnio3ild m2um( on(4 eermoctytlmt lu ol() 2xoxo oudope mfeil(fa2rrx  ;o1tleoiictltfs2eluvp;u0arermo iotomD aivi () 2tmio oydam emivtat)sruaum no4oet mi3iasfmDuaumonu4artrxr3iy1la  aues;t)sexoiopio4lleelivils  Dtmuroot1tptn o3iat m ea( o;u4aetnirciotfa  lu i (  2xoxm ny1apenlict s  2rmxm ;o1tlxniocilt aDrmuvs u)treoifcoadoaDrluvs s srxmir no4lmeelivtat a2rmu o;t1olx mfeiadlm el(vs;t) rxoifcty1fa eaiei;t) etrxm3nodaleemncias a2rmur no1oex moeiysla2emumsn(0 rtomr3oadopD  n o t trxr(r3oodol  lnesatfarra(  ot1ape if3iyt a2ul(vo u)alxnmo3oy1fpD  uvol(0tetrxr3nodllt  neiatfsrrmumono0altnif3iydfs uauvon(4aetrif3oo1lpDrliesl(0texmxr3iu4ole liesls) 2umxroou4opxn i3tas a2emu p ()altoxrcoo1fm r ivslt0 etr(m3nu4lptn ncs tf rrmxmpno4tpx mfeiltlsDuluvpn()trxnxo ta1faDeln s t srtrxm3nu4ale mnci (  rtax p;t4teenmfeiltfa rm( o (4alerio oatlmD  ieslt) exrxo3oudlptnlivtls) 2ua(r ou4tleoif3iyslaDeanvsnt) eenxr3iy1fa eanvo t0srxrir3oudam n fviasfa2ra( o;t1tleoioeiasfmDua(mpnu)tltoifctytfate ivo;t0teumirpoy4ap e iesa(f 2rmx pot0oleoiietadlaDrlums;t0 rtrircoatfmt anvils srxoirpio1olenmfvt tf 2rr(r nu0alto ictyd a emn o;u0alxnxociydfp   ies t)srxmim ou1lmeemfctatfsDtaur ;t4tleniieiaslm ranvpn(4tlxnio3ia1fpte neil( srtrxo iodamt lncia()a2trxroot4olt mfctydfa2um(mp;()treoxr3iatfa rauei t)truo(o3nodamtelfet (f ruaumonu4alt  fciat aDrmn o u0 lxrmo oydoat  u s t)setm(o3io4olee ivsasfsrum(mo;u1tlt  ictlt sDuanmo t0trxoxoctotlate iei;() 2to(m io4omtelfet ()aDtaxm ot1alxo f3tytfm emuvo;t)arxnmo3ootopt aneilt t2xoim iudap elnvi s)srrrxm nu4alt iieiyt sDrlnvo;t)tlenir oydoa eauvi;s  etmxm oo4lmtn fciat) 2umur ot1oee  o3iltfs2uanmpnu)aetnio3oadlpD luei ( srxo(r oo1lptelfvtasfa2trx  ;u4oet  fciyt a2umnvo;t)aetnxo3oa1fmDe u s;s)t2toimpiu4open fcslsfarur(moou4apxomiciytfs ul(mpnu0arxoxr totlp  an slt0srxm(m iy1apen ivs sfsrua(  ou4apxomfeilsfmDran s;(4trxnir ty1lp rlneo s) 2uoxm iudam e iesls) rtaxm ot0tle if3tls a em( p u)altomociadfpDelnvsl(0srtoio3nu1omteliet ( arum(rp;o1oetnmiciatls rln o;() leoxo io1lp ranei;() rxr(mpio4ol  lnvs ( srua(mont0aptnifetytfsDea(vpnu0tetrxo3io1laDr ues (0 2xmxopoo4lm emfcil( sDuau poo0tpx iicildfaDrl(ms;t) rtnxf iotlm eaivols0s2tmim3oodom  licilt  rrr(m ;t0ale io3tysfmDea(vs;(4 rxnif3oodfpteluvs t  ruo(m iu4ame  nvias) ruau pou4oee  feiadlm2rlumo (0 ltoir3iodlp eaues s) rumiopiydoleelfeia() 2trxro;o4aetoio3tysfs2ranmo;(0 etoircta1lmDeauvi s0teuriopoo4ll  mfvil() Dur(  nt0tpxo fetad mDemu o (4tlxrxrcoy1oa r i o s)s2xrimpnodoltn icsas)a2rau  oo0tltoioctad m2eanvp (0 renmf oatfp  anvs;t)trumxmpno1lpeelnet sf rrmx pno1aeeoiietlt s uau s ()alerir oytfm   ivsls s2tmim nu4amtnlfet ( a2rmxmo;t1opxnii3tlt a2ua(mont)aeenif3iytlm ranvs;()setoio nudaltnlfet (f Dtru pnt1teen ietltfs2rlnvo;u0altoir tatfa eli sl(  euoxmpoo4omt lnctlt  Dtrurpou1oex  oeiyt aDrmump t4 lenmrctydfm eln slt)srxrio3ou1lltnlfcta(  Drr(  oo4apeoio3tadlsDul(vont)tetrxrctydfatelneo;t)srumxrpnu1om nlfct ()s2rrxmono4aeenmiciysfs umnmont4 rtnmfcoodomteauvil(0 2uo(mpny1alt micia( a2urxro;t4oet mi3iaslm2rmnvp u) rxrxr3oa1faDr nesl( teto(o3iydapt lncslsfsrrmxrp;o0tpe  ociasls ran pnt0aetnxr iatfa e ueilt0 rxmxo3oy4lle mivsa(  2rm( ont1ole if3iytla emumsnu) ltomo3oodla rauei ()srumio3oydomeemfvtls) Dur(rp;t0oetn ociasfm umuvo;(0tlxrifctytoaD  iesl(0 2xmxmpnu1lme lfci s) 2tm(mpot1tee ifctytfa2emu pnu) reomo iodoa  aivi t)s2trxrpou4ap emici sfarra(r no1aex ioetltfa rmuvo;u)trxnxr3tytfa rauvi s s2umxr oy4altnmnvsl(f 2rrumpnu4oleoiietysls2rmnvpnt) ltoif oydom  lnes;t0 etmxm3nu4omtn nes (  Dua(mp;u1olxnmiciltfa rl(vsnt0altnmo iotfat  i il()sruo(r oy4op e fes tfaDraur nt1oee mieilt aDum(ms ()tlxnmr3tatfp elieilt)trxrir3io4al   fei t)sDrmx  nu4olx  feiasfs ranvs;u0 rtoxf3totfa  aieils0t2xm(m3oydam  lfvia( s2tmumoou1olto ocias a ea(mp u4 ltnio3todlaDeli olt  exrxmpnu4lmenliesl()sruaurpnu1tltomi3tasla ul(vp u4aeeomr3tadomt auvo;( trto(o ny4omenlivs t  2rru pno0alenmi3iasfsDum( o;t) etnxr oodfpt  u s t seuoio oudolee fct (faDraxr oo4texn oeiadls el(mont)trtoxf3iy1lm rlnei s)s2xoxo iu1am n iei s)arum(ro;u4ope if3tydlaDrm( on()aleoir3tytlat  ivo t sruoxmpoy4lpt lfci s)a2umx onu4ape if3iadls eanvo;u4alxnir oadfpDrai slt  eto(o nydolt  icilt sruaxrpnu0aexnio3iytfs2rm( s (0 ltnmf3oy1fmtelieils truoim3iydlmtelici tfa2tau oot1aee  o3tys sDrl(msnt4aeeoir oodom   nei s) rxm(r ny1ale mncsa(fartrum oo4oetoif3iltls uluvo;()tleoio3totlmteluvo s0s2urimpoy1optemnvi s) 2ururo;o0opx  ieiat a2ran snt0 eermr3totopDraneo s0texoxr3iy4alt  nvsas a2um(  ;u1ole  ietldfs2rl( p;t)tetrxr3iatop  lnes;(  rxmxm3oodol emnetat s2urxmoou0olenmfctlt m2rmu o t4aleomf3iytlmt lu s;s0 rtmxm3nodomee nvsl(fsDrau  ot1tet micils a2rmumonu4tleomr ia1lpD  nesl( t2xo(o oo4op  mneilt arrr( pou4tee  i3iat a2em(mo u0 rerxr oadlmD anei t) eurim nu4ome mnvtatfaDumurpnt4tet ifeiys a2rmnms u0arxnif oydoa elnes (0setr(o3nu4omt lnetat aDraxr ;o4ole  octat m umump;u) leomrcoadfm  aivol()texmxr no4lltnmnctas)arua( pnu0oleo fciaslm ulnmp;() eenmf oa1op   nvil() 2xo(o3nydlptelnvs sfaDtau p;u1tptn oeiadfm umn pn(4texnxf3tydlateli sl(0srxrxm3ny1ol nmict s sruaxrpoo1tlxomoeiys s rm(vsnu4 rxnxr3ia1fpteaueil(  2uoir3ny1lleelfvi t  2um(m no1opto ieiysla2rm( pnu)artnircoadfpDrln ils0 rtmxo3ou1op n nvt tfaDrrur nt4apt if3iydfa2umnms;()tleomo oatlaDeaies;(0 rxm(o3nudllee fvsatfa2uaxr nu4tpto ociydlmDul(vp;t)aeermo3to1lpte u i;s texoxo3no1al nmivslt)s2um(mo;t1tpeoifeiadfsDel(monu4aexrxrcoydop  luei;t  2xmim oy1lptelnvia(fa2urur ou0tlen i3tyt a rmump u)alxomr oadlaDelu i s0srxoir oo1lmtemfes sfs2ra(monu0ape mfeiadlm rmnvsn(4 rxrir3ia1op   nesls)s2xrxo3iy1amenliet (farra( p;t4aex  i3iatfa eauvp;()artrxr tydlm r u s;( tetm(m3oo1oltn fvt s srta(mpnu1tlt mictys m raumo;u4 etrif ta1lm r iei;s0texm(m3iu4ame lnetls  Dtaxrp;u4tlx ii3iyt s2em(vo u) ltnio tytfpt luvi;(  exm(o3iy4opeelnvta(  2ur( ont1tptn fetldfs el(mo u)arxnif3tydfa  luei;s)trxm(r3ny4altn iesltfsDtaxronu1olto ieiytla eaums;u0teerxf iodla rluvs;()t2tr(rpiudlm nmfesat artrumo;o0tet mfctlsls rm(vpnu0teenmrciy1lm elneo (0 2uo(r nudlpeemivias srtmxmoou4tlt if3iatlaDul(mon()altrif3iy1fm raivi t  2ur(r3ou1am nmnvs () rrmu o;u0oleo i3iyd s2umumsnu4 exrxo oytlaD aieols  2xr(m nu4llen neslt  rumx p;o4apxomiciysfa2ranvs (0tlxnio3iy1opt ln slt)trtmxo3iydoltnlnvi tfarta(mp;t0aleoifeiatlmDem(mont4tltrmr3iydom ean ils seumxm ny1lp nlivi ()s2truro;t4tlx  o3taslmDuauvo u0alxnxfcootlpD  ivo t)t2xo(r3oy1am e fet (f Duaumpnu4olenmfctlt sDrm(ms u)teeomo oydomDeli o t trtoxo3iu1omeemfvsas) Drmur oo0aleoifciasfaDrlu s u4 lermr iotopDr nvi;() rtmir3nodoleelicslt) rur(ro;o4oexn o3tatfa ea(vpn()aexnif3tytoaDraues s0t2tmxo oo1al elnvt tf Dtrxm nt0tpxnioeiadlm2rl(mp;t0 exnxr3oo1lmDe n i;( trxo(m oydamee fesls a2urx o;u0apt  feiyt sDulnms u4aexoif ty1opD auvs ( teum(o3ou1alee fcs (fs2ur( o;u4oee ioeiatlmDrl(mo u)artoxr iytomDelivol( texoir no1apt micsas  rrm(r ;t1tlto fctysfs uan s t4aeeomf3iodopteln i;( t2tm(r oo1al  lfvsl( aDra(mpou4apx  o3iysla2umuvo;t0 renxfciatlm rlu olt0 2urxmpoodoltnmnvi s) 2ur(rpoo0opto f3iatlmDumnvp (4 lxrxr ootfmt lu o t0trumxo oo1om  lnci (faDtr(r nu1texo oetls s2eluvs t0 etoifcta1fa   u sl(0s2umxopoydape livi tfsDtmx pnt0olenmo3iat a ean s (0aetrmo3tydfp eau sl() eur(r3iu4lme mfcsas) 2tr(  oo0alto i3tatla2rlnvp;()tltrio todomt  neil( trtmio3iudolenlfeslsf rrrur ot1oleomo3iadlaDrlums u0alermf3totlateanvs t0setrxopio1op elivta(f ruru o;t1olxoio3tltfaDum( o;u) eerif oytfm   ieol(0 2uo(r no1lpt mfvt sfs2uru p;o4ole micildfsDem( snt0 exnifciodlaDelivo;t texoxmpio1llt lietat sDumu  ;u4olxnii3iyt m2ua(ms (4aeeomo oo1fat ai ils0s2xmiopiy4omenlfetls srtaxmoou1ape mf3tytfs2ranmo u0tleoiocto1faD luei;s tetmxopoydamt mfeiltfa2taxmp;t1aleniieiad mDelnvpnt0trtrif oo1fat li o t  exmir nu1op e ivsat)s2uaurpou0tpto i3tadlsDelnvp t0 rermo totlm eau s;s)t2uoir3oodomt livsltf 2raurpnt4opxomociytfs eau p;u)tetomf ta1lp r n i;( t2to(m oydamt mivtasfa2rru p;o1tltomoctlt s eln p;u) lxnxf3to1fm r uesl( s2tm(o no4op nmncias)s2ur(mpnu4tetoio3iasfs2eau o u0teenir3totomD lnei;(0tetm(r ou4ll nlnvs tfa2ur(rpnu4olxomieilt m um(vpnt0artoif iy1lp rlivs (  eurio3oudam  lfesls)a2tmxr ou0aet  o3tld a eluvpnt4tltnxrcootop r uvo (0seurxopnodom   icia(fsrrm(r ot1aeen octltlaDuauvs;u0trerif3ta1omDeluei;t  2uo(r3io4ape mfvs s)s2tmu pou0olenif3tys s2umn o;t0aexnif oytlp  aivs ()trumim iy1al nmneil(f 2tmx pnt0oexomo3ils m2el(vs t)tlenxo3tytfaDeaneils) rxmiopiudam nmiesat)a2tax o;o1apeoifeild s eln p u4alermo tydlmD  n o ( srtmirpoy4lp nlfcia( arrrx  nu0aex ioeilt s2rmnvp;t)trxrmo3tytlmt lnvilt  eto(r nydole livi t)aDua(mpoo1olxoio3iltfs2el(mo;u0aeeoio3ootlp r i sls  2um(o3iy1ap elfciatf 2rrum ;o0opeo ieilsls umnvp t4tetnif oatopDe nvslt  etr(opoo4omtnmivt () rrrxmoou4oex  o3tas s rm(msnt)trtnmo todlaD ai sl(0s2xmio3oy1alt lfeiat)srtruro;o1tpe  fciytfm2rmnvp t4tltnmf io1fmDr ieslt0srxr(r3nu4lmtemnvi ()srum(  ot0tpt mf3tlsla2eanvp;u)areoxo oydfmDrluvi ()texoxopoo1ll  lfvsa()a2rr(r no1aexoif3iytfs rmu s;u0alerxf3oytfm e uvo;s) eurio3oy4op nlnesl( a2rrurpou0aee iictldls umu o;()artrmf3tadla eln o;()srtoxopnodapen ietls)artru ono0aleomi3iys m umnmo;t) rtnif3iy1fp r ueslt trxoxr ou1am   feiat arraur ;o0alxo f3ils a2eanmo t0tlxoif3ta1fmDr i o;s  exoirpno4al nmneslt srraurp;t1aet mf3ilsfm2em(vsnu)trtnir3iotlpDr iei (0 eum(mpou4ole  nvtat  2rrx oot4tlx mfciatfm elnmo;u0 ltnifciy1fmDelueo;() ruo(o iy4ll nlnvilt  Dtr(r ;u4tpen feiyslm2ra( s;u)trtrmociodlatelu s;() ruoim oudoptelfet s arra( pno1alto i3iasfaDrm( s t0 rtrio3iadop  livs;(0tetrxo3io1omtnlicsa( arur(rpnt0aleomi3tldla2rauvs;u4teeoif iotom elu i (0teumim ny1ame  fct ()s2rrum oo4altoiociaslmDuan o;t)trenxf oadoate nes t)setm(m iu4omte iciat)aDtrxmono0oetomoeiatlmDua(vo u0 rxrxo3tytomD  uei;t0t2uoxr iodlme mfesls)sDrr(roou4oee  fciadfmDemu snu0 lxnxocootomDr i s;() eto(r3oy4omeemfvt t sDrr(rp;u4aptnmo3iyslmDea( s;()arxoif3ty1lp  auei t) eum(r iy1ol elivt () Dua(m ot4apto o3iadlmDrlumsnu)trtrmo oo1laDe ivs s0trxmxm3iu4lmtnmnvsl( sDuaur ot4aet  i3tat sDumnms;u)tetnmr iotomtraivo t)teumxo iy1op  lnvt s) Dtru p;o0opxoiietltfs ul(vp (0artoifcoatopDelnvi;t trxrio nu4ap elieia()srtrxmonu1olt  feiltla2umumo t)trxoxf3ta1omt  ivs t)srumxr ou1amtn iesls)a2uau  oo4tpeo ocils s2ua(mp (0trxrmo tatfmtrli o;s0 rtriopnodamt  icsl( s2uaum oo1tpxn i3iatla2ean o;()tltomf tytla  anvolt0 rtmxo3oudlmte ictas srra(mp;u1teto oeias sDeanmp () eenxr3io1op r neils trxr(opno1omtn icsat aruru ooo0olxn oeildfmDra(mo (0trtoirctotfa rli ils teurim iydom  lictas)srtr(rp;t0aptoio3iltfaDem(vs (0 renmociydlptrln il() 2umxopny4ol   ncsls a2taurpoo4tle  ieiad s2eau sn(0alxnmr3oodoptelivs s0seuoxr iodlm e fcilt)arrrx pou1ope  fciatfm2el(vsnt0 etomr iotlateliesls0t2ur(o oodlmee iet s)a2ta(ro;t4tptomociyd sDrmn o;t)arerxr3iotlaD  uvi (0sruoirpiy4lmee netlt)a2tmur no0opt  oeiadlsDeanmsn(0tleoxfctodlat lu s;s0truoimpny1lm nlfct t)a2um(mont1opxniietadlsDrlu snu4 ltriocoatfmD ai s ()sexrxr3nydll n fciat sDrau  ot0ope mi3ild m2ea(vs;t)alxnmf3oydoaD  n o s0tetm(o3iy1omtn ncs s a2tr(m no4tlto f3ildfa rmuvsn(0alermf to1lpD aiei t)sexoir nodopeemncsa(  2uax o;u4tpe moeiyd a rlu snt4artrmr ia1laDranvi;( setmxrpoy4ol e ivil(  rrmurpnt0opt  iciytlaDuanvs;(4texomocio1oa rln sls0tetriopio1lleemfet s)sDra( pnt1aeen f3ildfa ul( p;u4tetrmo iydomDeaneol(  rxm(r3nodlpeemnvslt) Dtrxrp;u1olxnif3iytfs2uau pn(4 eerxf to1omD lneo;(0texoxr nodamee ncsasfsrtmumpot0aexomfctasfmDrmnvo;u4 lenxf3tytla eli o;t0srurirpiu1al e icil()a2rrumpou0oexoiietasfm2uanmp (0tetoxo todoa r i s;s) 2to(r no1lmt lnvt (fsDua( o;u1aeenioctys s2uaumpn()treoif3tadoat  iei t srum(r3oo1omtnmneia()aDtau p;u4tpeomoetldfaDulnvp t4tlxnir3ta1opDr ues;s)teuoxo iudllt  iet s)aDta(m nt1apxn i3iasfa ul(mp u) ltrxocty1omteluvsls) rumir3no4olt  ncsasf 2tmx oou0tee  feiltfaDuln onu0aeeoxrctydlpt  n s;t0srumim3io4ol   netatfaDurx  ou1aptnmoeiatlmDem( p t4aetnir ty1faDelies;s)trur(o3no4lmt mnvtat) rum(root0optniiciltlsDrauvs;t) rtrxrcoydfate ivs;s)s2toxm io1al e fcia( s2uaum ot0apt iocild a2em(mp;u4arenmf oadoa e ueo;()srum(r3ny4omtelictat)aDurxmp;t4texo i3iys mDel(vo (0aeenifcio1omDrai i t)texmim oy4altnlnes () Dtru pou1oeto octltls2uaumo t0aexnmr3oadoatelu i s0srtoxo iodlmenlnctls srumu ont4opx mi3iys a2umnmp;() eeomf io1fm e nvslt)t2tmxo3io4op  mfvt t) 2tau o;u4olxnmi3iydlmDuanmo t0teenxf ia1laDe ueslt srtmiopoo1lptemfeil(fa2ra(  ot1tet iietld a emums u0tetomfciy1fm rlu o;s t2tr(r3iy1lptnmies tfsrua(mp;o4aeenmfciydfm2rl( s;u) etnmrcta1fmD  u i;(0s2trio io1lme mfvtlsfs2trx o;u1aex  fciatlsDrlnms;()texrirciotfmDelnvo;(0trtmxm3iy1opt  ivi t) 2ua(  no1tpen octad s2rauvp ()trxoir oa1fatranvs (0t2tmir io4amtemivils)srua(mp;o1oleoiicias m2emnvsn()trxnif iydfm rlu o;s0s2xr(mpiy1ll nlfvsasfsrtaumpno4ole iieiys s2rm( p;u0trtoxfciotopDr nvil(  eurxopoudape mfetls)srurxmpot0teeomfetls s uluvpn(4 rxoxo tatom r i ol(0s2um(r oy1amte ietas)a2uaxmo;o0oleomoeias aDemu pn(4 lermr3iatfmt  nes s0s2xoxopnudlm e fviat  rra(rooo1opxn o3ildfa el(vpnt0artnmf ootlpDe ivol( teum(r ou1om  lneta(faDtaxr oo0altomfcildlaDelnms t)arxrmo ootopDe uei;t)seum(m3nydllte neilt s2tmxr ot4optoioctadfs uan p () rxrxo to1lptrlnvi;s srto(m3iu1alt lnvtltfsDur(m no1tptomi3iyslm2uluvpnt0alxrxfciy1fpDr ieils t2xrir oo1apeelnvsl( aDurxmp;u4apxniiciyt aDelums;t0arermociodopDrau o t s2umiopiodapeemiet tfarua(m ot1tet ifciysfa2uauvonu4areoiocio1om ean ils0t2toirpnudap nlietatfa2rrxront1opt  feiad m rmuvp u)alxoifcoo1fm  au sl(0 etm(m iodop nlfci t aDtmumo;t4tlenmoctlsfs uln p;()aetnio3oytopD anesl()trxo(o oodom n nes s srtrumono4alx ioeilsla2el(msnt) eeoif3iodlp r n i;s0t2tmxopiudomtemivias aDua(ronu1oexoiicilsls2rauvon(4aetoxo3oy1oa  aieslt0 eur(r3oo1ole  iesls  Dtrx pot4tetoif3iatlsDel(mpnu0artnmoctatlmD  nei;( teurimpiu1ape  ncsat aDtmxrpoo0oet  fcilsfmDem(vp t4tlenxo oodoatrlivil(0 2xmir io1aptn nei sfaDtmu  no1tpt ifctld s rlumo;t)alxnio oa1oatelnes t0srtrirpiudom  lncsasfarrru p;o4tlx  i3iysfmDumuvp t4areomr3totlatraivo s)t2uoir3io1ol nlnct s sDumxmoou0tetoif3tasfm2rl( pnt4 leoircty1omDraiesl()trxrxm oo4lleemfvsa(fsrum(moou4oleoifeiat aDemnvs ()aeeoifcoytfpteau ilt0s2toirpny4omeemfcsat  Dtr( p;t4aex mietyt m eanvpnt4aexnmo3ia1lpDeauvo;t)trurir iydalenlneia( s2tr(rpnt0apt micilslsDeau p;t)arermo3ootomD ln o;(0 exrim iy4alt lieta(f ruru  nu4texomociatfaDelnmo;u) lxrxocootlp   u s ()texmiopiu4opeemnvil(fa2rmx o;u4alxnmf3iatlm ulu o u0tlenmf3iatfmD anvo s texrio iy4amte fcslsf rrrxrpnu4tpen o3iasfaDulu snu0arxnif tytlp  livil(0tetr(o ny4lptnlfviatf Dtrxm ot1aexomfciadfm emnms u0trtoxo oa1fmte uvs s0trxr(m3iodll   ieiasfaDuru o;t0tlx ioctltfm umumsnt4 rtrif3tadoa  luvolt  rum(rpno1lp nlfctat)s2tmx  oo4alx mfciatla2rauvs;(4 exoifciotlm r nvsl()t2urxrpiy1lpe  ivtlt srtau  nt0aptoif3iyt m ulu p (4 etrxf ta1oatranvs;s0 rxr(rpnodopen fctasfaDrrx o;o4opx mi3tltla umumo;u0 rerxo3ia1lp  li i;( t2xo(mpiudomeelfetas)artmum nu4apxo o3iltfs2rauvs ()teenifciy1om eaueo;s) 2to(o oodlme  fvt sfs2tmx oou0aet mfciydlaDra(vs u) ltnxr io1fmt au s;t) rxoimpio1aptn feils)srum(mp;t0apt mietld s2ua( on()texnxrcoadlp rlivs ( sexmir3ou4am emfctatfarumxm ;o4altn ieiadfmDua( o;t) leomrcoytlm  ai s;(0teuo(o3ny4am  lnetls)s2ua(monu1oexn f3ilsls rmnmp ()aetnxf3oy1fa rluvol(0sexo(r nudaptn icslsfa2umu o;o1tptoiicilslaDelnvo;t0tltrmo3iy1fptranei s0tetrxmpoodlp nlies s)aDum( pno1apxoifeiyslm2ua(vo t0 exoif totfa r nvslt)tetmxo oo1lltnmivtasfa2umx ooo0ope mietad sDuauvo (0aetrmfctytlm e ies s0s2tm(m3iudllte ict t  rrmxrpot0texn fetyt m uauvonu)aexrmr iy1fmtr uvs;()t2toiopou1ap n ieta()s2ur(mooo1tltnmocilsfaDranvon(0artrxo io1fm  lu sl()s2urim ou4opt  fei (  rtrxm nt1aleomoeiltfa2elumpnu0 rtoir3oadfp r nvsls seuo(mpnydlltnmncsasfsDumu  no4tpe  ociytfs rmuvpnu0trxnircoytoptraieol( srum(rpoudal  lncias)aDrmurp;t0olenio3tlsfa2ra(msn()texnifcoydfmDrlneo;s0s2xo(o3io4lmte nvtl(fsrraumonu4tlen i3tysfm2eauvs;t0areoir3tatfpDrlnei;s  exmir3iydlpte netas) 2raurpoo4tltomi3iltfaDrmump (4tleoxfcty1fptraieo t t2xm(r nu1ol  mfvs ( sDurur oo4tpt  iciys sDuan s;u0arxoif ta1oat lnvslt0srxmim oy4om n icsls) 2um(rpno1opx micilt mDemums;t0arxoxo3oa1fa eauvi t)seumxmpiy4lpenlfvsat) Drr(r ;u4altoiictlt mDrlnms (0aeeoxr iotfpD lieo () exm(o iy1alee fctlt) 2trur nu0apeoiietysfm2eau o t) etnmo3ootfatrauei;s0seurio3iy1op n fvtls)sDrr( oou0oleoioetltlm rmn s (4alenir3tadoaDr n i;s) rumimpoy4lmeemnciasfsDra(roou1tetoiieiys m2eanmont) exrir iotfm elieols  2uoxr oy4lp n ietltfs2rr(ronu4oltn fcilslmDrmnvon()altrio totfpDe neilt0trurxo oudam  lfetlsf 2raxm nu1aexo ictysfaDrl(vs;u)aetnif oadla   neilt0tetmirpio4lmtemiet (fsDrau p;t0oltoiictlsla umu o u) renmr iy1om ran o s0 ruo(o no1lpenlneia(  2rrxm oo4tpen feiytlsDrm(vp ()artrioctydlp elnvslt)trurxr iudlme lfeias srtrxmp;u4texnmietld mDuln pnu4aetnxfciatfptrlues t trumiopou4lme  ieia(fsrtm(m ot0aeeomoetyslm el(vp u)alxnxr3iy1laDeauvo;t0teum(opiy4omeelfetlt s2rm(monu4teeo i3taslsDem( p;u0 etnxr3iy1lmt livs s) rurxmpiy4omeeliei s)arta(mpot0optomiciaslaDum(vs;u4teermf oytla eaueilt0s2trim3iodlltn ivtasfsrrrumpnt4tet  fetatlm uaumsnt4aeenmr iy1opDelu ils) 2xo(r iu1llee feils) 2raxr ot4optn ietas mDemn p;t)altnxo3ia1oa r ieolt0 euo(mpiydolte fet s  rta(  ;o4oet  f3ildla rmn ont) ltnxr oy1fp rlnei;( seuoxo3iydlltemnvta(f rum( pnu0tet  octad m2em( ont)tlxoirciadlm  anvol( s2xmxo3no1opte feils  2trur oo1oeeoifctytlmDemn onu0 ltoiocia1fpt luei;t0trxmir iy4lltnmieilt)srrmx ono0olx mi3ilsfa2rmu on(0tetrmr3oydlaD aieo t)seurxm no4om nlivslt)sDumurpoo1alxnmo3tydfm2el( s;t0 renmr tydlat ai sls  etrxm3iu1ole lncs (fa2ur(m ;u0tltoif3tytfa um(vpn(4texrxfcoytlpDrln ilt)teumiopoydomtelies sf rrr(  nu4tpt miciad s2el( snt0alxoxo to1oat aivs t)s2uoxrpno4olt lics sfsrrm(ront1olxn ieiaslm el(vo u4alenxr3iydopDelies t0srxoxm3ou1lmenmnesa(fsrum(mpnu1aptniociyd s2el(vpnt0tleomo3io1lmDr u s;(  exr(m3iu1lmte icsas)aDrrxmoot4alx mo3ilsfm rln p ()treoxrctydfpDeaneslt  rxmim3oo4apt  netas)a2umx pnt4aeeomo3tyt s2ra( o u)trxnifcia1omtranes s0teurimpiy4omtemfvsls)srrmxmpnu0texnmfciysfa2rmu o;u) leoxf iydlaD  nvo;(  rtoim3ou4omee nvils s2tm(rp;u1tpxnmfcild sDem(mp;t)teenifctodfp eanvi;() exmio3nu4amt mfvsas)s2tmu  oo0aleo fctas aDrmn s u0aexomr3iadlmte uvsl() exrxm ny4llenmncils) Drmx pot1opeoiieiydls2uln pnu0texoxfcoadlmtraivi;t0s2uoimpiu1lltnmfctlt a2urumonu4oex  oeiltfa rl( pnu) lxniocootoatrln sls0setmxrpiu1al elnci s srtmxm ou4aleoiicias aDranvs;t) lenxo tydla e ieslt teuoxopiu1al nlfvta(f 2rrx  ;u4open oeiad a2eauvp;t) rtoxoctodlaDe n s (0srxo(m no4llee nvil(  2umum no1alxn i3iltlsDrm(mp;u0aexnxociotoaDr u s;t t2ur(m io1ol n feiat)aDtm( ooo4tle  o3ias a2elums ()alxoircoatfm rli ils)teum(r ou1ap emieia() 2tau pou4aexn ictldfmDeaumpnu0trxoxocio1la ranvs;t t2um(m iy4opt  icsas)s2rmu pnt4oeenmociys s rm(vonu)alerxrcoydlaDe ueo t0 euo(m ou1ap e ncil(  2urum ;t0tee mf3tysfs2ulumo t)arenif tadfatelueil()trtm(rpno4lle  ivsas)sDtm(mpnu0teenmiciytfs2rlumo (4aetrmocio1latelnei t) ruoimpoudllt  fcsl( a2tr(r no0opeomoctasfsDuanvo;(0aexomr iatlm rauvi s  2xoim3no1lp emnviasfa2ta(ro;o0oex  o3tltfmDemu s ()arxoxo3ootop eanvol( t2ur(o no4ll nmieslt arra(monu4aet mfetyslm2ranvp t0trenxfciodlateli ils) 2to(m ny1ome lnei s  2rr(rp;o4tptoii3tys s2emnvs;u)tltrxr3oo1fm  aneils0sexrio nydamte fct sfaDrmxmpoo0olxomf3iaslm2el( p;u0trtnxoctadfpD  uvi;s0 rxm(o3no4alenlfvsl()arumum ot0opx  octltfm2emumo;u4 exrio3iodla   uvo;s) ruoxr3ny4amt lics ( srtrxrp;u4oexnioetatlm2emumo t)alxoifcootop  anesls0t2xoir3nydamt mnci s) Drau  oo1oltnmoctaslaDua( pn()aetnmrctatomte i s;s0texmirpoudlp  miet tfa2raxmp;o0ale mfciat mDrmnms;()aetnmocootfpD  i i t)trxoxm3nu4omt  fvsls)sruru pno1tpxn o3ildlm ul(vo u0alxomo oo1la eauesl( t2urxr3io1alenlncia()s2ua( o;o0optomociat mDelump t4aetrmo totlp   ivs s)setmimpio1ap n nvs t sDtmu  ot1aleo fcildlmDrl(ms t)aetnif to1lpt  n s;() etmiopnydame mncs t)a2tru p;t1tpeo oeildls2rm(vp (4tlxrxfcoadfptrauvsl(0s2umxopnu4am nlics sfs2rrumono4opeo fetlt a rln s;(0tltrmr3oatop   ivo;(0 etoiopiodame lnvil(fs2taxmp;o4tlxnmfciytlaDeln pnt)teenmo3ty1lptr nei s  rtoim nydlptemnvtl(fs2rr(rpnu0tlx moctatfs2ul( pn(0 rerir3io1fatelu i ()s2trxr nu4ole mfvia( arumxro;t0aexnmicilt a rlnvo;t) exrio3ootfpD an ils s2trio ou1lpte fet (fsDta(  nu0tptn ociatlm rmuvpn()tlxnmo tatfaD anes;( s2umir oy1omtemnvsasf 2tm(moou1ope mi3iytls2emnvsn()alenmo tytfaDelivo t)t2xmirpoodol  lfvsat)aDuau o;t1ale  f3tls m ean ont) lxniociy1oat  u ilt0trumio3ny1apte ietatf rtr(r oo1oex iiciytfs rmnmo;u4 reoxf iatfmDeluvols) 2trxo nudlp nlfctl( a2ua(r oo1apeoif3tas m2rmnvsnu0texnxrcoadla rauvo (0setmxr iy4lpeemfct s)aDra(r ot4oee ifctadlaDumuvpnt4 lenxfcoo1laD  ivo t s2trimpiu1al  livi ( aDumxm no1opeoif3ilsfmDuluvpnt4tlxoxf3oytom ean o;s)s2tm(rpoodamee icsas aDtr( o;o1tltnii3ias s2rmnvpnu)tltnxf oo1fate nesl(0setmxm3nodapenmivtlt) ruau oou4tpxnmfeiat sDumuvs;t0alenxo3iytla eauesls0 2ur(o ou1aleemncs (f Dua( ont1alxnmoctls a umn p (0tltomf3ootfat  neols0srxoim nudlm nlnesl()sDra(rpoo4tlen ieildfs2emnvo;t0trxoxo3oydfpt  iei;()srtr(o3oydol  mfctl(f 2ururpno4tpenifeiys a raumo;u)tltomf oadfmD an i ()t2xmir3ou1lm elfetl()arrmu pnu4tltomfeiyt m2ul(vo (4trxoxo3tatfate ueilt0 rur(r oo4opt  nvtasf 2rau  nt0altn fctadfs2em( o (0arxnmf tadomte uesl( s2xo(m ou1lp nmict s artm(r nt0ape ifctltfmDra(vp ()areoirctydoaDelues ()tetoiopoydal   ictl(fa2umx o;u1tptn ociadla2eau p;()trenxf3iy1latelnei s)t2tm(r3nodlpeelnvtltf Dtm(r nt4tleniieiyd sDrm(mon(0alxnxo3iatfm  lu ols)srumim iodaltnlfvi t)sDuaumpnt4alen oeiltla ea(ms () etoxr tadomt  u o (  exoxm oy1am nmieslsfsDrmump;o4olt  ieiysls rlumpn()altnxfctytlp rln ils srtmxm3oo1optemnvi s)s2ua( pou0apxoif3tadls um( onu4arerxrcootlm  anes t0t2xrir oydapenmicta( sDtr( p;o0teenmi3tlslaDrlnmp u)arxoxf3tydfmD  neo;t) eum(mpoodame mnvi tfs2taxm ou4ole mi3iadlm2rlnvo;u4 exnio oa1omD li o;s0 exmxopoudom  liesat a2rr(ro;o1optniiciatfm2elu p (4 lxniocta1lmtraieol() rtmir3nu1ome mnesls  Drr(rp;o0aee mo3ias m emnvp;u0aeenxf3iotoaDeauvo s0texmim3io4op n ncs sfsrraumpnt0opxo iciyd sDrmnvs u0tleoio3tydfa  livslt)teurxrpiy1openmfeil()sDuau onu4oeeomociat a rl(vs (4tleoxocoadlateln ol(  eto(m3nu1olt mnctls a2trxm ot4tpto f3iyt m2raumpn(4aexnmr ootfpDe ivol(0tetr(m iy1lpe lnciat)srum(r nu1tpxoifetysfmDumnmpnt4aexomo3iydoaD aiesl(0srurxo3iu1apt lnesa(farrm(r oo1tpxnii3tatfm um(vp t)trerif3iydoat lues t t2xr(m3nydape lncilsfaDtmurooo1oltomo3ias aDrm(mpn(4aleoir3iytlat li slt)s2xriopiudop n fctlt arur( pot0alt iicildls elnms;(0tetrir3tydlaD aivilt0trxm(m3nydllee nes t)sDtrxrp;t1tpto ociltla2eauvont4 ltnmr tatfptr u s s0 2tm(m ou4opeelieia( arrm( p;o0tetomiciydfs umnvo;t0trerif3oy1lm rlnesl()tetm(r3iu1llt  iet (f 2rrxr nu0tptoif3tlsfm elums;t0aeeoif oadop  lu ils sexrio3iudape lfvt s  rrr(ro;u1tltnioctyd m2elu p (0treoxoctatop e neo t0 euriopio4olee ncsa( sDumu  ;t0optnifeiytfa rl(vp;() rermf oatlmtelu o s0t2xmxm ny1al  lncta( aDrru  oo1oeenmfetadfaDrmnmp;t0 rxrmo oa1fa   i i s t2um(o3nydape lici ()s2rmxr ;o1apxnmiciydfs eln snu0trenirciatoaD  u s (0tetm(rpoudol  mneias  rtmxmono1oeto ictytfmDrmu o () ltoxr3ty1optelnes (0 2toxmpou4apenmivt sf rtm(  ;t0opx  f3iatfmDeluvon(0 etoxf3tatlmDrauvo s s2uoxr3oy4ap n fvtls srumu  ;t4opxnmoetldfs ulu p t0teeoxf3iy1faDr nvols srtmxm3oudapt  neiat  rtaxr oo4tlto ocilsla emu o;t)aeerio iy1la elu ilt  exrxmpoo1op nlfvta(  Dur(mo;o4optnii3ilt m ulnmo;t0 ltnif io1fmt an i s0tetm(opnu1lmtn fcsl()arrrx onu4alt io3iasfaDumu sn()trtoxo3io1fp e nvi t0s2umim3oo4ol n fcslsf 2ta(ro;o1apeo fetatlmDua(mp;t0artnmr iydomD ln ilt trurim3nu1lme liesat)srrr(  ot1opto f3iadla ul( p u4arenmrcoadoptrlivilt)trxoiopoydlpen fci t)a2rmur nu0tltnioctatfsDum(vp;()aeeoxfcty1fmtrau s (0sruoim nudolt liei t)s2um(ront1teeoio3tlsfm eluvsnu) exoircta1fateluvilt t2xmiopoodameelfvtas  rra(mo;u4tptnmiciyd a2em( pn(0arxoir tatlmtelu sl()s2xoxrpoydolen nvs s  rtrxronu0apxoiieild aDea(msnt) rxnio3oytlmDe neo;( trur(m oydll e fcsltfaDtau poo4aet  fetydfsDem( p u0tlenir3to1omtelnvi s)setmxm no4openmnciatfa2trum ou4tpx mfeiatlaDemn o u0 eerxf oatom e iei (0s2uoxm oo1ol nmfcias)a2tr(rp;o4tpt if3iatlmDrlnvs (0 exrmr3totfa  livi;t0sruoim nydalen icsl(  Drr( o;o0oleo ocias m2eauvp u4arermf ootfaDraivo (  exm(o3ny4ll emieslt)srrrur nt4aleomf3iydfs em( on() rxnxocta1fmDeaneolt t2uoio io4alenmfet s)srta(mpnt1tltomieiyd a rlump (4 rerircoa1optrauvo s)s2xrxmpiu1om nlictas) rrm(  ;o1tleoif3iydlsDul(vo;() rtnmr3io1fptranei t0s2uo(rpnudaleelfci sfaDta( pot0tpeoiieildfaDeluvp;t0 rxnmo tadfmDeanvo;s s2umxo iudlp  lies s  Duaxmoou1olto iciydfa2eanvp t4trxrxo oodlmteln ol()trumir3iodalte nesa(fs2uaxmo;o4ape  fcilt sDea(msn(4 renmrciytlm rlu i;s sexrio ny4ol nlfeta( s2raxmoot1alx mfciatfsDum( ont4 leniocoytop r i o;t0t2xmxr ny4lptelfesltfsrrmu  oo1tpe  oeiydfm2ulnvsn()tlxrifcia1lpt lues t)trumxrpoo4ame mneil()aDrm(rpno1oeeo fctldfsDemuvpn(4trxrmrcootfa raieo;(0 ruoim3io4lm nlfvtl(fsrurxro;t1tlt mieiasfaDrl(vo u)tltnxfctodlm   u s;s srxm(opoy1ole  fvsas)aDtmx ono1olxo o3iatla uln pnt)trtrio oadfm raueol(  euo(m3no1lmte ncs t artm(r ;t1oleo i3iyt m rl( pn(0artoxr3iadfp  lueil()seumxmpnydamtn fvta() 2urxmpno0oeen icildfa rm(mpn(0 eenmr oa1oateau olt0teto(r nodaltn ivsa( sDrauro;o0alto ietat a2rluvp;u4altnir3iytlatrlneo t trumxmpno1ll  mncsat srrmu  oo4tptniietldla2el(vsnt0 rtomocty1fmDelivils  exmxr nu1ap n fvt ( artru p;u4tex io3tatlmDeauvonu)trtoxf tatom ean i s0t2xmxrpoudal nmnvi sfs2um(moou0aexnmfeiys m2umnmsnt4 lxrmo tadfm rluesl( tetoiopoudlltnmfvslt) 2rm(r ot4olxomoetld s2raumpn()aexnif ootomtr ies;s0t2trimpny1op nmfvta(fsrrm(m ot1tpxoioeiyt m eauvs t4 exnif3iytlm  aivi;s0s2umio ou4ll e fcs t aDur(  no1ope ii3iadls elnms u4arxnxr3iy1laD lu o;t0s2urxo oudopenmnvsas a2tr(mont4olt ioeias mDulnvs;(4trermr ty1fmD ln o;t srtmimpoy1lp elfeil(  Drrurpoo0ale iieildlaDeaumont0artrmo oodfpDean o;t trurio nudom   ivtls) Durx oot0aexoio3iasfs ranmp;t)teerxf oodfp elivslt0truo(o oo4al n fvtlsf 2rrumpno4olt iieiltls uau p;t)tetniociydomDe nei s)s2toxr iy1lmte ivtat  rumurpoo4tetnmi3ildfa2uanvs t0tlenxo3iytlatelu o s) 2tm(m3iy4apte iei tfsDtau  nu1aee mfeiys a2ean pnt0arermf oatfm   ivs;t) rtrxm oy1ap e ivtltfa2rrxrono0teeo iciaslm eaumo u) rxnmfcio1fmD li i;t)texoxo io4ap nmieil(fa2rrx o;t0tpt mieiatfmDeluvo;t)alxnxo to1fpteaiei s texrxr iodome lnvsasfsrrmx p;o4aet ifcild a2ra( s (0tltrifciotoatr u il( s2xrio3iu1lpte neta() 2taxmoot4tlt mfctyt a em(mp t0 lxomo iydfmDr ivs (0trxmxm nu1ol nmfes ( a2ua(ro;t0olt  fciytls2ra(ms (4 reoxrcoatfaD  uvs (  etoim3iy4aleelfctlt a2rm( pnu4altomoeiltfa uau pnu)aexomr3oo1fm rli il() 2trim3oodop e fctlt  2tm(  ;t0apxoif3iysfmDumuvs (4trxrio iodlm rlueolt seto(opoy4optelnes () rur(  ;t0apx iociydfsDrl(vs t)aetoxfcta1fp  ai ilt)s2ur(r3nu4amenlnes () rrmu oou0altomociasla2rmn o u0tltnxr tatlp eluvol( s2xr(mpoo1ome mfeslt srraxr ot0oee iieiyt s ea(vo (4 lerircootfmDrlivs t)trto(r3oy1omenmivtas a2ur( pno0aeenmfeiydfs rau s;u4aeenxo iytlpDrlu o;t) rurio oodapee neia(farrrx p;o1tlx iicildfmDranvo;(4texoxrcoodla e ieo t0 rxr(mpiy4lptnmivslt a2rrx oot4tpe mictytla2umnvpnu)tltoxo ty1fp   i o;s0 etrim oodaltelfesl( sruaum ot4ape  iciyd s2rmnmonu0 lxnif3ootfp e nesl(0t2urim iudaltnliei s sDtax pno0tlenii3iatlaDr
\ No newline at end of file
@@ -0,0 +1 @@
+iesl(0trxm(opoodlmtelicsa(  Dtrx poo0aetnmocilsls2umump;t4aetnxf iytfpteauesls)setoim3iy1oltn ivia(f rua(ront0apxn o3tld aDranmp;u4 rtrif3oa1fmD luvo;s0 2umxopiy1amen nvi (  Dtauro;o1tltn oeias a2umnvont4aexnmr oatfa rli i t)srxrxr3ou4om e ics t) Dua( pot0alxnio3tadfa rl(vs;u4altrirciytlmtr n o;t) exoxr3nudom nlfetatf 2raxront0tlx iiciat aDrmuvp;t4 eeomociytom eaneolt0tetrirpiu1op  mics s aDtr(ro;t0oltoifciaslm ea( pnt0alxrxfcoo1omt  n o s)t2ur(opoy1om emfvi ()a2ta(mp;u0tpx ifciydfs2el(vs;u)alenifcoytlmt au sls texmxr io1alenmfes s)aDrmur ;u4olxoioeiyd sDumnmont)teerxo tydoa  aueo s  etm(o3oydlm n fes sf 2ra(r ;u4tetomfctatfm ea(vpnu4artoxo iadopD  n sls)s2xoxr3oy1ll emictls)a2ta(roou4apenmfcils s rlnvsnu0tltnif3tatlp e u ils0trtm(o oydam nlnvtlt) rurx onu4opxn fciat m ulnvp;t) reoif3tydomtean slt  2trim oudolenlietlt)sDtr(mont4aetnii3tys sDulu s;t4arenxo tatopteanes ()sruo(m3iu4lme lnvta(fsDur(ronu0openiicils aDranvp (4arxoxo io1la e u ols0sexoirpiy4ol   ics s)srrr(mo;u1tpeomo3tad a2eauvs;(0 rerxo io1fpt anei;s)setrirpoo1olt lnvsasf rrru o;t0tptnmf3tlt a2umumo;u4 lxoxo3tytfp rln s;()t2ur(opiodaltemnetas  rtrx pnu4apxnmicilt a ulnmp t4 eeoxo3to1la  lnvs s) rum(m ny1al emfvsatfsDum(mpnu0apt  ieildls eln p;t4trtoif3ty1lpDelnvs t  2uriopiu4lmtnlnvt ( a2taxm ot0tpenmieiyt s raums t4alerxf iodlm elueols0s2uoim nydam elnvsatf Dur(moou0aexo o3ild sDelu pnt4tlxoir tatlmtrluvslt0 exr(rpiy4lpen ivsl()s2uau  nt4tetomiciydls eau o;u)aeenxf ty1latrlnvs (  2xo(rpiodlptn neiat s2rmu ono0tex ioeiasfmDea(mo u) rxnxf iodlaDeai slt s2tm(opiy4om nlnvs () Dumxrp;u1tpt iiciaslmDul(vpn(0altnioctodoa  auvs;s s2umxopiu4olt  ncia(f Dur(rp;u0oee ioeilt aDuln o (4 eermr iatlm eai s t)teto(m iudapeemfciltfarur(m ;o0apen o3ilt a eau snt0 lenxo3iytom rluvsls texmxopnu4ope mivs ()srtaxro;u1altomociltfs ulumonu) rxrircoadfpDr i ols)trxm(o io1am elfvt s)artr( p;t4olt  f3iadfs2eln p;u4alxoio tadopteaivo (0 eur(r3nudomtemfvslsfartmxmpou0aexoifetldls2rmnvo u0 eerio iadfpDr n s;t  etoim oo4alenmieilsfs2rm(  nt0apt mi3iydlsDelumon(4trerxr io1omte uvo s0srxrio3oydlm e nvsa(faDtmxmooo1aexn o3tatla2ea(vo;t)trxrircia1omDrai i;s seuoxm3iy4ol elfct (  rumxronu0ope  fetyd mDeluvs;t0trermr iadfp  lueo;s)sruoxo nu1ll  mfctlsfs2raxm oo1ape  i3tys s2rmuvp;t)alxoio3io1opteau i;s)trxrxr iu1lpe lncsasfa2trx pot1teto feiytfaDum(ms ()trxoxrctotom raiei t0srtoiopoo4al  mies t) 2tr( pno4tlxomo3tlt mDrlnvo u4 rxomo oatfp   uvol( s2toxr3oo4amee fvt ( sDumu ont4opeomoeildls eaumsn(4tleomocoydoatraiei;s trxrxr3oydlme lnvia( a2umx oou0tptnmo3tld a ua(vp;u)aeeoio3oadoaDe u ilt0 rum(rpiudapt  nvt t)srum(m oo0tpt  o3tasls2rm( p;()tltrif iotomDe uvsl()teurxo iu1oltemnciat sruaxr ;u1aet mociys mDrm( s t4 etnio3oadfpteaues;( trtmxr io4lpt  nct tf Dtax oou1alx mieiyt aDuauvpnu) eermf iotomt auvilt s2xmxr io1lptelnvtl()arrmx pou4apx  ocilt sDem(vsnu4 eermr io1lm rli olt0 etm(r iodalen fciatfarrrur oo4aetn o3iltfm2uanmp;()texoxr3todopDraivs t0tetoio iy1al elneias)srur(rpnt1aeeo i3iytfm2rlu o ()trtoircty1op  an s ()setrim3ou1ol elncsas)s2tmxm nu1aetoio3tyd s2ulu onu) lenifciadopDeln sl(0setoxm3iydamt mfvsat  Dumxro;t1teto o3ilt a elumont0arxrmo3ia1la   u o t)texr(r3iydlp nlnvils)artaumoou1aex mictyd a2ulumon() rermrcta1optrlieo t  exrxr3nodolt mnei tf rrmur no4ale if3iytla elu s;(0 etrxo3oatomtean olt0srxoim no4olenmncia(f 2rr(r nt4alt mfeiyt mDumump t0trermr oo1lpDeluvil(0 euoimpno1lmtemfvtl(f 2ta( pot1aleo feildla eluvs;(4 leomr3iadop raneo;s teur(o3iu1om nmnetatfs2rrxm nt4ope  f3iydfm um( p t4arenio3oatlp r uesls srtoxr oo4lp nmiet t  rtau  no1oeen f3ilt s2uau p;u)trtoxf oo1opDrlivo ( t2uo(opoy1amt lici () Dtr(moot1aexnifciytlm2em(ms;(0 lxnif tytop raueols  2xm(mpoy1ome lnvtlt)s2ur(ront4texomieils m rl(mo u0 rtrio3iodfa r ieo;t) 2xoxr3iu4lm  micia(  2taurpoo1tptomietlsfs eaump;t4trtoio3todlpDeln o t) 2trio3io1ol elncias) 2um(  nt4tle  i3taslaDua( on(0alxrifcoatoa   uvo;s) 2umim nu1aleelnci t  2tau  ;o4oee  iciysla2ra(vp;(4 eeoif iodfa  lueslt0 2um(r3iudll nmnes s) 2tr(mooo0alxnmi3iyt sDea(von(4 etoio3oy1omD  i s;s srtoimpio1apen nci (faDrr(roou4tpt if3iyt mDrlnmo t0trxrxr3oo1lptrluvslt  ruoirpnydlp e ict sf 2rruro;o0alxo o3tls m2ranmo u4trxoxr todoaD  nesl( t2xoxr ny1ll e ivils s2rmu poo4tet moeiytlsDuln o;t4 ltrif ta1omDe nesl()t2tmxo3nu1omenmfetltfartmu oot0alxn feilt mDrmnvp;()tltrxf3ta1fa rlivi s trxoio3oo4llt mfcil()s2taurooo4aex moctyd a ulumpnu)texnifciytlmD lieo;s0 rxrxmpoydam elieiasf rumu ono1tpeoiieiltfm ua( onu)aexoir3tatlaD livilt s2uoio3no4ame  nvtat aDrr( onu0apxn o3iytfs2rmuvo (0 eenifctotfatrlivo s0s2uoimpoydlmtnlfct (f Dtr(  no0tltnmoeildla2uanvp t4tltrxociy1omDrlnvo t)tetmio ny4lm  mnvtas)aDurxr oo1aex  i3ilslaDumnmp;t) ltnifcia1lptrlivi;(0trumiopno1altemicia(  Draxr ;u4tpt io3tltfs2emu p t) lxrir3ia1om rlneo;t trxrxo3ny4apte iesa( aDrmum ;u1aeeoioetytfsDraumo;u)texrmo3oadfaDr iesls0srxmio3iu4ll   nes sfaDrrur ;o1ope mo3iaslmDumnmp;u0 eermf todoaDrlies s) etmirpiu4optn iesls  Dtrxro;o0tltn oetldfm rmn p;t) leomr3tytomt aivi;( trtoim3iu1olte fctl()srtrxroot1aet mfciad a2ran snu)tlerir iotfatelieo;(0t2urxr3io4ape  ietls) Dtr(monu1tptoio3iadfa rl( s (4artrxfciydom   ivi;s0teur(m io4oleemieslsfs2rrurpou4tpxoii3ildlm2rmnvp u0aexoio3iytom eln s;t0 2um(rpoodal nlictasfa2rau ooo1oex io3tlsfm2rl(vp (4 exrirciydlm  lu slt)setr(r no1omen nct s  rumu ono1tleniictlsfsDem(vo t4 lenif3iydlat ai s;(  exoir no4ame mncsls)sDur(mo;o4apxnmoctltfm uan pn(0 ltoirciadlpteaneo t  2toim3nu1lm   fvtatf Draum ou1tpxoiieiytfaDran p t4 rtnxf ta1la eaneo t)s2urimpoydal emfetl()s2tmum ou1oet moctldfmDel(mp (4aeerif3todfp   ivs ( tetrxmpiudalt  fvs tfsDumu pno0oltnioetyslmDea( s () ltnxfcoydlpDrlueolt trxmio3no1alenlivs t) rrru  nu1olxoifetldls emumon(4arxrir3iodla rlu s s) 2tm(m3io4lm  mivtas srumx ooo4texn fcias m2elnvs u4 eenmr3iydom elnes;s0tetoirpny4ole mfct (  Dumu onu1aetnmfciysfs ua( p;()areomrciytfat lnvol(  2xoxopny1omeemfvias) 2tm(r ;o1tptnifciasls2uanmp;(4texnir ty1omD an i;( texrxr3iydam   ivils s2urxrpnt0aexn feiyd s um( s u0trtrioctydlmte u i t)trumxopny4aptnlfetl( a2trumpot0texo f3iysfsDem( o;u) lxrifciotomDrauvs;s0truoxmpiodlle mfesls) rra(rpoo0tlto f3tld m2eanvp t4 rxrmrcoadomD anvi t) rxrxo io4oltn ivsltfa2rmump;t4tleoioeiydls um(mpnu0aleoif iytfpteli o;(0sruo(opou1optn iesas)aDrmx  oo0alxomfctatfmDrmuvo u0aeeniocoytlaDeaiesls t2xo(o iudlltelfvtls)s2tax  ;u1optnioetatfaDrlu s;u4alxomociotlmteaieolt  2trimpoo4apt  netls)srrr(m nt0alx moetls s emnvp u)trtoxrcoodlpDe nvo;s0 2umimpnu1lm elfvtas  2rrxroot4tpe ii3tlt m2elnmo u0alxrio tadlaDeai i t0s2trio iudomen nesls)a2ur( ont1aeeoiociyd a ea( s;u4 rtrmo3tydoa e ivilt0trxm(o3nydom   nesas  Drmxmp;u4opt mietaslm2uanmo ()aexrmf oodlpD  n s;()seumim3oo1amenlnvsls)s2trxmo;u4aet mictld m2rmn o;()tleoxo3iydomDr nes;s) 2tmxo ou4oleemnvs ( srrrur ou1apenio3tad mDel( s;(4areomo tatlm eau o;s) euo(m3oo4lptn net ( srrrxro;t1oexoio3iatlmDumu onu0arerif3iytfp  aieo;(0srtoiopio4alte fes t  Draumpnu4aee  ociyslaDrm( o;u4aleomf3iotfa ran o t teum(opiodlmeemnvt tfsrra(mo;t0tpxoiocilt mDemuvs t4trxnmr oatfp   nei;(0sruoxo ny1omt  fctlt aDua(mo;u0oetoii3iytfa umump;(0aetrmf3oy1op  anvol()t2uo(opnydllenlfei (fsDtmumpou0opt ii3tytlaDul(mpn(4 eerxo oytlpDelivolt) rtm(mpnodom nmnvi s)srtr( pot1alx  fctydlaDrluvsnt0tlxomo3iytoaDelueo s)teur(mpiy4aptnmivt t) rtmx  ;t1alt  iciltls rm( onu)areoxr3oydop   ieolt0s2xoiopiydlmtnmict ()s2taumpot0oltomfcilt mDrlnvsnt0 exrmocio1lm rli i ( t2tmxopiydoptn ics s) 2um( o;o0optnmicildla2ra(mp;u0 rxoio3iodlm elnvo;t)t2xrirpou4amenlfei ( s2raum nu4tle if3iysfm2umu o;t)trxoifctadomtrlnvi s0srum(mpoydame mivia()s2rmxm ot4optnii3iadfa2emuvp;u)altrxr iydfp e nei t s2xr(opoo4altn nei (f 2taxro;u4olenmfetld aDulumon(0artoxf ty1om elues ( sexoxr iudaltnmictlt)a2ra(rpnt4tleoiiciasla emumo (0artrmr3iodfmteln s;s srto(opiydaleelfvt () Dtmumpnt0opxoiietas s el(mpnu4tlerxr3oydlp e i o;t)trxmxo iy1lmt mfvt ( s2ua( pnu1altnii3tlslsDea(ms;t0 exnirciydfaDe nei t) eurxrpiudllt mies tf 2uaxrp;u4ole iiciaslm emump;(0tetrxrctytla r nvol(0s2uo(o3iydomeemict sfa2urxmpno1tleomo3tat m uln p;u)tltoir3oodopD aivslt0teumir3no4alen fcils srtmu pou4tpe  fciys s2el(vs;t0tltrio3oadfp e uvsls) rur(rpnudal  lictas sDta(r ;u4apxnmoctadls2rmu o;(0tlxrmr oydlm e n olt  exoir3oo1ol e fctls)a2tm(m ot4tlxomoctlslmDra( p (0 reoxocio1lp e nvi ()seuo(o nydlptemiesas)s2rmur ot4alt mf3ias m ra( s;(4alxomr iytfptr u olt0 rxriopou4lpt mnct ( s2ta( o;o0aptnmo3iltlsDulnvon(4alxrmfciydlmDr nei ( sexrirpiy1oltelietls a2taumpno4opxoif3iat mDea( o;() etnirctydopD lnvolt s2tr(m3iy4lm  lncils) Drrx pou1aex mfetas mDeln snu0trenif iydop eaivs;t  2trir nu4llt licsa(fartaxr ;t0aeeoio3ilt m2ean p;u4tetomo3totfmDe i il( t2xoxmpny1lm n ncias  2tmx  ou1tltomoeiysfs2eanmo;t)tetnxfcoatfaD lieils0 euriopiodamenlnesat a2uaxrpnu1altnmo3tlt mDra(vp u4 rtoio tydoaDranvi;( t2tr(m3oudlm   nvs ( s2ta(  nu1alxoii3ildfmDemumo (0tltomr3to1fmtr nvi;(  rtrxr3iu4ap nlictltfsDumxm ;u1openmi3iad m el( o;t)arxriocio1late ueo;() rto(o3nudamtn ncs ()artm(moot0tpe ioetadfm2emumpn()aexnxo to1opDe i o;t trxmim3oy1opeemneta( srumxmo;u1tltnii3iat mDrm(mo;u0texoifcty1fpt  n il() rurim3oodom  mnvtas) rrm( o;o1alto iciys s ean sn(0tltnir oatlm  aivo;()trtoxo3iy4al   nvsls)a2rm( onu4ale moetldfa ea(vsn(0 exniocto1lat an o s  2xm(m3iudame  neta(fa2tmxro;t0aetnifeiat a em(vs;(0 ltrmr3iydoaD  u i t0sruoxrpny4llee icsls) Drr(r no1olt iociasla2el( snu)arxrmoctytla e neo;t) 2urxm iodlmenlnvs ()s2ra(monu4opx  f3iytfm2ra( s (0teenxrctodlat aivs;t0 exr(o3io1al emfei s) 2umurpnt4tpt ioeilt a2rauvs u)alxoir3iadfpDe ies (0 2tmim3oudoltemfei ()aDuaxr no1aptoiociltfa ua(vp;u0 rxnmo oadom rai o s s2trim iy4opt liet sfsrtmum ;u4opt iieildlmDrln snt0 lerir3ootoa raivolt0sruo(m3io1ame  fvi s)aDrr( p;t1tpeoif3iatla2umnvo;t4 lxoxrcoadomt li o t s2xm(r3ny4om   fcta( sDrrx  no4tlt mictasfaDemn p;t0aexrir3iotoa   nei t)setr(mpiu1lm elivtas srrau ooo4aptnmfcilt s2elnvs;t)trtoir3tydlatrauvo;s srtrio nu1aleemfct ()srrax ono0aptnmiciadfa ulnmp;t4 eeomf3tatop rlivi t0trtm(opoodlmen nvia( srraxrpno1oeeo i3ilsfm2uau o t) exnxfctatla  luei;s)t2xr(m3oudlpeelnciasf 2tmxroot0tlt ifctatls2rmn ont0tleoxf3iotfaDe i s;s  exrxrpoydolt  ivi tfs2tm(r no4oet mfciytfa uauvs;t4tlxnxr oytoa  aiei;t)s2xrim3nudll e fetat a2tmxmp;u0opt ifeiad sDuln p u0arxnxr oa1lpte uei;(0s2urxmpio4lpt mfctl(fs2urx  nt4apx mocias m ul(von(0arxnmr3oytlaDe nvils0s2uriopou1ol emnesas s2raxrpnt0tetnmieils mDrl(ms;u)tleoif tadfaDrlnes;t tetmxo nu1lm n ivia(  2trxmp;t1tlxoio3iydfaDeanms u4aexoir3io1faD  i s;t0 eumxr3oudalte fvs ()srur( oou4oexnii3tltlm2eaump;(4tltoxr todfmte nesls seumim3oo1ll  lfetlt)s2rmxmono0tpx miciyd sDuauvo;u4 etnircoytfm r ivsls  2xmir iydom  livtlt  2rr(mont0aptnioeilsfmDemumsn(4 ltoxr to1om   ivo s t2tm(o ny1olenlnvi ( srrruronu1tpxnif3iatfmDrlnms u0areoifcoadom eauei (  2uoiopoudopeelieilt arrax oot1ape iociltfa uanmp ()aetnxoctydfptelnei s  rto(mpny1amenmivtlt  Drruro;o1olxnmfcilsfa2rlu pn(4 etrmo3todlatelueo;()t2uoir nudole lieia(  2tr(r ou4optnifcild a2elu s;t0 etrifctotomDr ivols  exo(o oo1om  lfvt () 2tm(ront1aeto iciadfmDranmp;t0 reoxr iytfm eai slt0srurxm3no1ap   fvt t) 2rrxm no4oetomo3iasfa2ul(vs;u4aeeoxocootopteaues (0 2xoxr3iy4optn nei s sDtrx  nt1opx  f3tls m2uanvpn()tlxrxo oatlpD lu s t)setr(o oudal emnvtlt) Dtrump;u4aleomfcilt s rluvont4 eerxr todom r nvols  rurir nydape  nvtat) Durx  ou1texoio3iatfaDum(ms u4 lxoxo3ty1fmtr i sl(0 2tr(mpno1ll   icia(fsDra(rp;o0oee  i3iytfsDeanvs t)alxoif tatop  au i s tetmxo nu1apeelnvia()aDuax  nt1aexo octat m2ranvpnt)aetrxr io1lm r ieo s0sruoxo oodlp  lfcilsf rtr(ro;u1altoiieiydfs2emumonu0 rxrio3oa1omDelneol( teum(mpny4lpeemnct tfaDta(m ;t1oleniiciltlmDem(vs;t0alxnio tatfp r nei;t srxmxm ny1aptn nei () rtaxmp;t1tltomfcildfmDelumont4 etnxr todop e ivi ()t2xr(rpnu1lp   netat  2tr(r ;u4tpen f3iadfs2eau o (0tleoioctytlpDr ivils)teur(m3nodolenmfvtasfsruaxmp;t4ape mfciasfsDel( sn(0 lxnxociy1oat  u s ( srxo(r ny1oltnmfetas a2rmuroou1oltomieiad s emumsn(4 reoirciytopteluvs ()t2uo(r3nu4olt livt t)a2rrx  oo1aeen oeiydfsDul( p t) etoxfcio1fa elieolt0s2xmiopnudll   ictas)s2tr(m ;t1alx  ociytlmDrmumon() rxnxoctotomtrli i t0sexo(rpiodlpte fviat a2raumo;t4oetoiicias m uaumonu0aeeoiocoy1oatrlivo s) rxo(o3oydolt mict s artmu  ;u4apt mo3ild mDeanvpnu0aexriocio1omtrai sl()t2xrxo ou1amt mictltfaDurxm ot0olxniietldlmDrl( p;t0 rtoircty1fateanei;(0tetrxo3nydaltn netl(  Drrump;o4aet  i3ilsla2ranvo ()alxoir iodlp elivils)seurimpno1amtn ncsl()a2uauroot4tle  ieils sDel( pnu4alxoxf tytlpD aieols)srxrim3oydope  feil( artax  ;o1oltomfciysfsDeaumsnt0 lerxo3oodomte neol()t2umim nudlp elicsl() ruau  ;o1oexomieiatfaDrl(vsn()aeeoxrcoydomD livs;t0 ruo(opny1llen nci t)aruaxroou4tlxnif3tyd m umnvs;()tltriocoodlpDr nvs;s trxm(m iy4lltelfci ( srrmx  ot0opeo ociaslsDean snu)altrmo oydoaDeln il(0srtmxo no4olen nvtl(f 2tmxmpnu4olt mi3tydla ua( s t) rermr oo1lmDelivi t s2xr(mpny4am n fvtltfsrrax ooo1altnifctltlmDrluvo;() etomf3to1fmDeaivols s2tr(r iu4lmen nciltf Drrumo;u0oeeomicilsfaDemuvont4 lxnxr3oadop  lnvs s  exmxopio4lpenlfeiasfsrua(  ;u1tee miciydla2ulnvpn(0tetoxr oy1lm rauvol(0 eum(opoudop  livsa()arrm(mono1oeeo o3ild s rl(ms u4 leoxrctydfpDeauvi;s0 exo(rpio1lme  fvsltfsDtr(ro;o1tpen ictysfaDrmn o;(4alenmfciodlmDranvo;( teurxr no4aptelivtat)aruaxrpnu1apxoioeildlm2ul(vsn(4altoio3totla rlieilt tetrxmpou4ope lnci t srrauro;u0altoiictydfs2umums u)trxrir iydlmtean o s) rum(m3no4amte ivtl( a2trum oo4ope  feils a2rlumpnt) exrif3iadfpDr ies;s0 etrim3oy4lmt lfcs tf rraxr ;o0tpeomi3iatlaDelnmp;t) ltrircoydlat livslt t2xmio no1lltn ncslt  rrr( oou1teenioctys a2ranmo u0aetrmocta1fpt  n o t) rurir3io4altemnesa(f rtrxroou1tpxnmfetld sDuau o t4 eerxociy1fptrauvs;t  etoiopnu1lmtnlfct s)a2tr(rp;t4tetnmfetasla rl(ms;u4alxrir ty1op elivsls)s2xo(mpiy1ame mictls)srrr( pnt1apeomiciysfs ean s (4 eenmr oodfpDrlieo (0 exmxmpoy1lm n ictlt a2urum ;u4tee ifctls m rlu o ()aetoir3oytlmDe nvsls srumxo3nu4openmnvs (farurxrooo4oexn ociydfaDrm(vp;(0 lxnircta1lpDr u ols0s2to(r iu1ol  lfeil( srtr( o;o4oetnif3tadfsDrau o;(0alxoir oo1lpteai o s0 rtoxm ny4ll  lnes s arua(  ot0texomieiasls emnvs;u0aleoxr3tatfaDe nvilt)trurxo oo1llen fvi t)a2umx o;t1oex  iciysfa um(mp u4artnxo iotfp elu o;s0 2xmiopnydlmenmnvsa()a2trxronu1optoio3iydla2rl( p;(0aetnircia1fm e n sl(0srxr(m oudlltelivsl(  Dur(moou1oeenmoetatls ra(mo ()aeeoxocoodomD au s t0trxm(o oydameemfvtl( artru p;u0oexoiocilt a rmumpn(4 rxnir3iydoaDrluesl(0 rxrxo iy4ol nmfeia() 2um( pot1optomoeilsfa2eanvs (0 lerxo iytfa  lueo;(0s2um(m oydapenlnei t)aDuaumo;u4oee  oeiytlsDran s u0 ltrio3iodfa e nes;s)tetr(opny4ap elieil()srtmuro;o1oltnioeiytfm2emump;u4alxrio iydfptrlieil() 2xrxr nu4omtnmfesl(  rrr(rpnu0tle ii3iytfm2emump;t0tetnxfciytopDr u sls0trurxr3oo1olt lfeil(faDtrxrp;u0aptn o3tltfs2elnvs t0tetoxr3tadoa rlnei t)texo(r io1aptemnet tfa2uru pot4aleomf3iydfs uln pnu4alxomr todfmt an ol(0 rxmiopoodom e iet (fsDumumoot0oeen i3iadlaDuanvo (0aetoxo iy1fmDelivol(0s2uo(mpoodap nliesat sruaurp;o1tpxn o3tydls uauvs t4 rtoio3todfpDran sl(  ruo(o3oodomtnlici tfsrtax ooo0aet iociys a2rl(vp t0tetrif iytlmt lieo t) eur(o3oy1amtemfeias a2ur(root4apen feiat mDul(mp t4 exnxf3oy1op r uei;s0 exoio iy4apenlfvtas)s2trxmoou1aex  ietasls rlnvsn()trtomf3oydfmD  nvs s) exo(m3oodap emncil()sDta(ro;o1tpx mictadfm2emn ont0arxniociodoatrlu i;t0t2toio3oo4lptemivils artr(r oo0tlxomfcildla rlu snt0tetrmrctytfaD an s;t)s2xr(r iy1aptnmicsa(  2urumooo0tpxnmf3ildlm el( pn() lenio iy1fpDeauvil() etmir3oy4altnmncia(f 2uax oou4optomfciltlsDumn s;() lxnxfctotlm e nvs s)t2trxm3nu1lmtnmfetltf rrru  ot4oeenmfeiasls rl( s;(4tlenmr3oa1fpDr ues s) 2xriopio1optnlfcils a2trurpou0altnmfetas m2rln p () rxrxociytfpDrlu s;(0srtmio3ny4lm   ivs (faDrrumoot1olt mfeiysfa elu p t4teerir3oa1omte u ol(0 2trim io4ame mfvtlsfsrrr(  nu0tle ii3iytlm ua(monu0arenifciydoaDrauvo s0 2umiopiy4ale  ncs ( sDrmu pno1apen ieiadlm2ua(mont4 rtnmrcoydom  luvsl( truo(o3iu4lp nmfesatf rumxronu1tltoioeiasfa emuvp;t0 rxnxr iotfp r u s t) 2to(r iy4ol e ici s)a2trxmo;o1oexomiciytls2rau o;t4 eeomo3ootfp   nvo;t  rxmxrpny1ap   ivta(fa2tax oou4tlenmiciytfa eaumo;u4 rxrmo tatlaD  uei t0s2xmim3ou1omt  fcta( arrax  no0teen f3iatfm2emuvsnt0altnxo to1lpDe iesl()s2xoxrpny1om   nvias)a2ur( o;t0aexoif3iatfaDuan on(4teermrctytfmDrau i;() rxmimpoudal  mfcs tf Dta( ono0alxoiicils sDemnvs;t4tlxoxocoadomte ivo s)trum(o3ou1ale  ncsasfarrm(m nu4tet ii3ilslmDul(mo u0 lxoircta1fpD lies;s) 2tm(o nodop nmfesat)srtaxr ot4aex  ietad m rl(mont4 rtrxr iotfa   uvo;s0 euo(o3nu4aptnmnci (fsruax  ou4tpxomociad mDemumpnt) lxnxr totoatelnes;s tetr(mpnu1llte nctas) 2taurpno0opxo o3tltfm2rln pnu4trtoio3oodfptean ils s2toir nodalt lneil( a2ta(mpnt1tpxoif3ias a eanmpnu4tlerxrciydoaDrai sl() 2xr(opou1alen feilt srrruronu4tlt mfetatfsDumuvo u) exnioctytlmtrluesl()trur(r3no4lp nmivil()aDua(mpno1oleo ieilt sDrlu o;()trxrxrciy1oat livol(0sexrxr3ou4ll nlncta(faDrm( oot4oltnifetyt mDelu o t0 rtrmr3oytlpt  uvo s) 2xmxmpoudaltnmfcs s  2ta(  ot0oltoioeiat s elnvo;t) renmo3oydlm   ies;(0sexoxm ny4am elnvtlt)sDtm( pou4oetniicilsfm um(vp t4 eenmf totom  aivil(0 2xmxmpiudoptnlics t)aDra(r ;o4aetoiocilslmDrmnmo (0 ltoxocoy1fp  aues;s)trtoxm3oudlpee fctl(f 2rm( ooo0opeo ieiatfs2eanmo;(4texrxf3iydfmDeai o;s0 rxmxrpiydomenmiet ( s2ra( onu0teenmieiydla2rl( pnt4altnxrcia1lmte nei;( texoim iodll elfvia()srtr( poo0ale ioctydls rln s u) ltoif oy1oaDr u o;s0t2tmim3no1lptelivt s)arururpou4tpt miciyt m2elump;u0 rtnirciadla raieo t)srxm(r3nudame mivsl( aDum(rono4olt mocild m2ranvp u0 lxrxf3oa1lat luesls)tetm(m3iu1am   iesls arrmumooo1oetoio3iysfmDelnmp u0arxomfciydomDrlnvi s  2um(rpou4am e fvt t srururono1alenmietytfaDean pnu4 eerir3iotlpt aues;s)sruo(m oy4lm  micslt)arta(mpno1tptnmo3iadlm uanmp ()aeeoxrciotopt lueo;t s2tmio3nu1lmt mfeils)a2rruroou4alxomicilsls ulumsnu)aexnir3oodla eaivi;s0srum(rpnu1op e fes s srua(ro;u4opx mfeils s ua(mp t0tlxnif to1la eluvo s) 2uoim3io1alee fet (faDtrxronu4optomieilsfs2rmumo;(4artrmr3ta1fa eaues s)t2trir ny4amee ivsas)arrm(rp;o1oexnifciat sDumn s u)teerio iy1fpDeai s;()s2uoiopiu4op  mfei ()s2ta(r nu1oleo ieiyt mDrlnvs;t0 ltrir tytlatr ieo t0trtoir3oodolt lnviltfsDumx  no4ape ii3iytfaDuan snt4tetriociodlateaivols)setmxrpiy4omt mfvilt) rrm(r ou4aetn fciltfsDelumonu) rtomo todopDelies;t)setoxrpiu1altnmfcsa(f 2uaur ;u0teeomictys aDelums;t)teenir3iatomt  ivsl(  rxmim3iy1optnmnvsls  2trum ot0alxo fciys a rmn snu)altoxrcoodoa eauei t) rtm(o3oodlmtelfeiltfaDum(mpnu0tltnifeiytfs rmnvo;t)tlxnxocoydlpDr uvo s)t2tmxmpiy4omt mivsat)arurxrpnt0tleomo3ilsls rln p;u)alxoxo3oadlmD aieo;(0 2xoxo nu4altnlfvilt  rtmx pot4tpxn o3iyd a2rlump u) exomf3oa1fmDr ieilt0 rum(mpoo1lptelieta()a2umx  nu0aetnmi3iltlmDemu ont0aeermo3iy1lmDeaivsls)sexo(m io1oleelies sf rrau p;o0tetoiociltfsDrauvo t0 eenmr iytfaDeln i () eumxm3oy1llt mnvtas arrr(mo;o1aptnmfctyt m2ra(vp;t)areomfctadom elnvsl(0 rtmxrpoy1ll n fvt tfsrumu  ;o0apeomo3ilsfaDea(von(4aexrxr3tytop  anei ( t2to(rpoy4aptn fvtltf rrmu  ;u4optomfciltfa eau s;u0treniociodop  lnvs t) 2xo(r3nodlpe  fetatfa2um(mpnu1alt mi3iasfa2emumsnu0aeeomf3io1fpDe uvs t0 rum(o3nudap   iei () rtr( ooo4tpxoioetyd sDrmnvp () etrif oo1fmt  nvo t  2tmxopno4lmt mfcsa(fsDrmxmo;u4tle iietas m2emu s ()tltnxo oa1oa   ivs;() 2umio oy4lp   ncia( s2ur( ono0oee ii3iydfaDumu s;t0 exnio ta1fp  lu sls0setoirpiy1am nmnvi s) 2tmump;t0alt  icilslaDulu p;(4teeoir ta1omD  nei t)s2uo(opiydomtnlfesas)a2ra(rooo1tpxoiictlsla rl( o t0 renmocto1fat aivi;()srto(opio1ll n feslsfsDur(mont4tet  i3iytfs rlnmont)aetnirciotlmDeli o s0srum(r io1ll nlivs sfs2ururont4oeto fctat m2ul( p u4tetnmf3oatom e ieo;t) rxmxo3ny1lpt  nvsls  2tr(ront4apxnmo3iatla umump;(4arxnir iodlmDranvols seurxrpiudlp n nvia( aDrrxrpnu4oet mfctat mDuluvpn()altomocoa1om elu olt  rxmxo3no4om  lncsas)srta( o;t4olx mf3iadfm rm(mo;t) lenxrctotlmteai i t trurim oy1llen iet s  Dtru ono1apt  octas s rauvo;(4areoxfcoy1lpDeanvo;s)srtrio3oydoptn nvs t s2urxmooo1tpx if3iydfs uln p (4 rtnmr tytfaD anvi ( s2urim iu4lm  lncilt)arraxmo;u1tltnmfeildla umu s;(4tetomr tatfmDe n i;(0 2xmxo3iudom n fvs s) Dra(root1oltnmfeiysfsDran s;t) etrxrcootop r uvo (  rxoxm ny1ap emics (  rtmu pnu4tpxo ociasfa ra(vonu4aeermf oy1lpDelies (0 2xrxo3iodoptnliesls  rtaxmpoo1openmociyd a ua(vo;t4altnxr ty1oatrluvi;(0srtoxrpiu1aptnlics sfs2raxro;u1texo i3tlt m uanmpnu4 eenxr3ia1fatrlu i (  2to(o3nydam elfvtlt  2rrurpnu1alxo o3iyt m rmu o u0trerif3iytfa r ivsls0sexriopoo1amenlneiasfa2rmx  ot0tpxomociltlsDum( o;t)trxrmf oy1lpDeanvs s0texmio nu4op  mfes (faDrrurooo1apxnmfetadfa2uauvo;t0alenmf3totop rai s t) rtrio oydoleeliesa()a2urxro;u4tle  iciyslsDulnms t) lxrxf3ta1lpDeli olt)t2xmim3iy1lmtemiet (  Dur( pot0aexomfeiatfmDuanvo;(4tetrmo iydoate ivo t0 2toim iodopenlncil(f rraurpno4olt mi3tatla2ea(mp;()trermr3ty1fatr uvi;s)t2urxopnydalenlict sfa2tru  nt1alxnmoeiltfmDuanms;(4artnxo3oytom eluvi;s setmiopoo1lptn nctat s2tmu ont0olxnmociydfm2uluvpn()trxnmrctodlmt  uvs s  eurxm oy4ome  net ( aDraumpnt4aexoioetydfsDem(mont4arxnxr3tytoaDran i s  2tr(r oy4lltemnvtat)srrrx  nt4texoiictls a raums u) reoxr todfp eaivi;s)setr(rpny1oltnlnetatf rta(  nt1aeenioeilt a2el(vs (0 exrmfcoatoa   nes;t)t2tmiopnu4lm   ieias)srrax  ;t0tlenmociltfs um(vpnu) rtomo3oy1om   ivols srurxrpoy4openlfcta( sDrru  nt1olxnifciytlaDemump u)texoif3todomteli s t truoxm3ny1oltnmnvt () rrm(moou1aexomfcild m2um(mo (0aetnmrctotfpD aivi;t) etoxm nudop  lncs t sDrrum ;o0tlxnmociaslaDrluvp u)altoxr tatoa  li il( setoio iu1lmenlnvs t)artax pno1openif3ias mDua(vp () ltnmf3iadlmDr ueo;t)setr(r oo1ope micilt  rtmu  nu4alt iociydlsDelnvp;(0 lxrir oy1om ean s;()seuoimpnydllt lfesl()artmu pnt0olxoifetydfm2rlnvs u)aeeoxr3oo1optraneols srtr(m3oydll elfvtl( a2raxmpou0apt  i3tls s ea( o (4 lenif tydfaDeli i t  2toxr3ny1omenmietat srta( p;t1oet ii3tatla2rmump;()aeerir3oydom r ivol(  2xrir3io1omeelfes t  rrau  ou0opxomf3tldla2eau p ()teerxoctatfmDr uvslt0texr(o iy4olenlieia()arrr(  oo0tee mf3ildfm rmnmo;(4 lermo oy1om ran s;t0srxrxr oydam  lnvilsf Dtrxm ;o1oetn octldla2ulnmo;t0 lerxfciy1lm  lnvo;( setr(o oo1llt  nctls  Dta(  ;t0apeomo3tad m2rauvs;u0aleoioctytfa eanvi () 2xmxopnudam e ivils)a2ua(rono0oex  f3tldfm emnmo;t0 leomocoa1fpD aneo;t0tetmiopnudamenlfei t  2tm(ronu1oet ioeiad m2ulnmo;t)alxnxfcio1lpDeau i s) 2toir3ny4amtnlivilt)sDrmu  nu4aptn f3iasfaDrlnms u4alerxrctatfaDe i i;t) 2ur(m3oy1om nmfcil()arrru pnu4tpeniocilsla ul(ms;u0 eenmf3iadopDrlnvs t teumxr3ou4lp nlieia()aDraxroou4apeo iciydlm ra(vpnt) rtrxfciadfpt lu i t)t2xr(o3iudlme lnesltfarurxm nu4alxniieias sDrmu o;()tltrmfcto1lat  iei;t t2uoir iy1apt  nesas  2um( pnt1tpe ifctytlsDrmuvp u)altnmo ta1lmDeaivs s  euo(mpiu1ope lfvi s s2ur(  ot0optomfctat s eanmp t4trtnifctotoa raivi t t2tmxo3iy1ope  net ()aDta(  ot0tpenmoeiysla2em( p;(4texoio io1fp r n ols0s2uoxopnodlmte iet tfsDtaxmp;o4oeenmfciydfmDeanvp (4 lenxo3ootlp rai i ( teum(o3oo1lleemnvslt  2taumpou4oleomictyt m2ua(vont4alxrio iytoatelnvs;s srxr(m nodlpenmfei (fa2tmu p;o4tee mi3ilt a elnms (4trtnxf3oydfmD lu slt) rtoxopoydaltemfct (  2ur(rp;t4opx  o3iad a2ra(mo u) lerxrcoy1laD lnei t  2trxm no1omtnmivils)s2tm(r ou4optnifetyt aDrlumo;t4 rxoio iy1optrliei t) euo(m3ou4lp n nct t  Drr(rono4aee  f3iatlm ulu o;(4tlxoif3tatlm r iesl(0 rto(o nodlm nlnesa( arurumpoo4oeeo iciyd m2eaumo;()aeenmr3iadoatrau o;()seur(rpnodomtelfeilt a2umurpoo1ale mi3iytfa2ea(vp u4tetnio3tatoaDeli olt) ruo(o3ny4omeelncia(fa2tr(mpot0apt ifetys m umnvo u4teenmfcoadfptrai sls srurxm no4om   fet tfaDua(rpoo0oltnii3ilsls2rm(ms;()arxrio3iy1fmD  nvo () rxo(m io4lmtnlfes (fa2rmxmpnu0oexo i3tyd m2elums;u) lxnifctatlat  u s t0s2trxm oodom nmfesltfaDtmxr oo1alto ociad a2elu p t0tetoxf3iydfatrli s ()teur(opnydlp elfeil(f 2ua(r ot1aex  f3iasfmDrl(vo;t)tleoir tytfmtelieil( srtr(rpoodll   nviat)s2urxm oo4tlt  ieiys s2ranms;t)aexrxr3ty1om  aiesls texoir3nodlpen nvil(f rum(m oo1oeeo ocild a uau pnu)texrmr iydoa eluvs ()s2ur(r3ou4ome  fci (  rumxmooo4tpxnmf3tat s2eauvs t4 etrir tatlpt auvi (0trurxo oy1ll elnciatfs2urxm ;o1olxn fciltfs2ra(vo t)treoxr3totoaDr i i;(0trxm(m nu1al e fvtat) rrmu ono0olxn ocildfa2el(mpnu4 eenmf3oa1fpDrlivo () 2urxmpnodlpt mnvtlt srrmx oou1tptnmfeiydlm2rauvp;t4arxomo3oadfp elnei;s)s2toxo nudll emncsa(  ruaxr nt1tltomoeiatfaDrmnmo;(4aetoio3tatomteai ol()teum(rpnydapeelnetas) Dtrxm ;t1texoifeiydfa2ea( p;(0treomociodlpte i i t trxmir nodapee fvsatfs2ua(mpnt0oex  i3tat aDulnms;u)artrircoodfpD anvi t  rurimpou4omtnlnesa() Dur(  no4tpxniocilt a elnvo;t0tltoxo3oydlaDrln ols0 etmxo iy1op  livia(f 2taxmonu4olxo o3iadls2um(vp;(0artoir ty1oate uvi s) 2umxopny1ope lfcs s) rrmx ooo1apxnmieiyt s eanvo u) lxrxo oa1fmteaivs;s srtmimpiy4lme  fctl(fs2trxrp;t1oetnmiciyd aDea(vs;u4 exrmf tadfaD ln s s)s2tmiopnu4apeelfet (  2uaxm ot4apx iicildfa el( sn(0arenmf3oydfpteluei;(  rum(opoy4ol emnvslsf Dum( pot4aexo ictadfm2el(vo ()teermfctotlpDrluvslt)texrxmpoudoltn nct (f 2rm(mono4apx mocilsfsDemumsnu4 eerir tadfm   nei t0 2to(mpny1omenlics t artm( p;u1optn oetasfa2ea( snu) eenmo tydlatelies t s2umxm3io4amtelfvt tfs2ra(m no0tex mfciys a rl( on(0aeerif iytlat lueol() 2xrxr3iy4al elivi ()aDtmuro;o4ope mi3ildfaDrmn o;t)aeeoio iadfa eauvs (  exoxm oudolen nvt ()artm( pnt4oleomo3iat aDulu o t4 reoxr ta1laD  neo;t) rtmxr iudom n iei t  Dtm(  oo0oleoifeildfa ua(vo u0 ltoxfcoy1lp rlues t  2xoim io4olee nvi s a2tru pnu4aeto ociatlm emnmo t) exnmf todlp e u slt0 etrxr iydll n iei s) rtaxmo;t0alxomietasfs el(msnt0altrmo3iotfpt lnei t) 2xmirpiodlme mfvi ()aDtaum nt1aee mo3tyt s umumsn()arenxocoydlp eauvi (0 rto(rpoo1amenmivsasf Drruront0apx  i3tltfaDrmnmp u4tleoxrcoadfateln slt  rtm(mpoo4ameemfesls artrxmpno0ole  f3tyd a umnvs (0artnxo3tadoaDe n ilt0sruo(m3io4ll e fvtas  2tm(ront0tpenifctyslmDulnvon(0tlxoxfcia1la ran sls)texm(opnu1lmtn fvslt  Dtru p;t4alxo fciyd sDuanms;(4 rxoir iatla elnvslt)sruoiopoydapeelivia() Drmu  ot0aeenio3iadla2emuvp u0 exrmf oadlmteluvols0s2to(o3no1ap  mnvi t) Dtaumoou0tpe  o3tlsfa uan o;u4 etrxfciy1faD aivo;s)teuoir3iydamt lnvi sfs2ua( pnu1oltnifciaslm2ra( p;(4artnif3oytomDrlu olt0trtoxmpiy1olenlfct t  Dtm(mont4texomoeiadfaDuauvo;t4 etnxociy1oa  an s ()teuoir nydll   fvt ( srtmx  ou4opx ioeilt a2el( o t4tetrircia1omt anes;s)texo(o no4am elneil() 2tm( ono1tptnmoeilsfm rmu pnt0tltrir iytfpDelu s (  eur(r no1alee fcsls aDumxr ou1alx mo3iytfm em(mp;t0tleoxr oatoateai s;s0srtmio nudllt livtlt)sDumumo;o1tpen ieiadfs em(mon(0 lenmf3oytomD aneo s texmirpoodalt mncsatfsrtru  oo1teenmoctls aDumuvonu0aexrmf3todlmtr i s s0s2toir nu4opt lfctltfaDtmxrooo1tlxnmf3iasfaDeanmsnu4trtrmr3iadlm e iei;t0 2xoxopnydomt mnvs (faruau pot1aeeomi3iydlmDua(vonu)alxrmf3iytlpt li olt)texrxm no4open ieiatfs2tmxmp;o4tpe iociatfmDrluvonu) lxnxf oy1fat ai s s t2to(mpoo4lpt  neiat) rua(r nu4tpt  ociydlaDrauvp;u4alxnxo3to1lp  ln o;s) exoio3iydlm  lnei ()a2rax  ;u4tetniiciyd mDelu s;(0alerio io1fmDe i o;t teto(opoy1omeelfci t)s2ta( o;o0ope mf3iyd s ra(vsn(4trxnmf oo1fa  an s;s)trurxo ou4aptn fctlt  Drm(  ou4apxomfeiad aDeanmpnu4 rtnmf tytlpDr nvi;t) rtm(r iy1op   nes t)s2tmump;o1optoif3tatla2umn sn()tetrxf tydopteau ol(  eumim3io4am nlici (f Dua( pot1opx mi3iltlmDeln o;()tltrxoctadlmt luvi;()texrxr oy4lleelnvsl() rtr(m nt0oetn o3iysla2rl( p;u0 ltrir3iatfmtrlivi;s teuoio3nu4am   ivil(f Dtax  ;t0aetnmoeiydlmDrlnmon() eenxoctotfa r nvi;t trxoir3nudlp  lnvtls a2urx ono4texn feils s2rm( o;(4trxoxo tatomD lues ()s2trim nydop e icsls  Durumont4olenmf3iydls2rln p t0tltoif3totfaDrli il()teur(o oy4lmeelicil( srtaxmpnu4oet if3ilslmDulnms ()treomr iodop  liesl() 2uoxrpoo4lp   fei ()sDrmx pot4tex mfeiasfa rm(mont4trxnxo todfmDr ivils)srurxm oodameelnvtas)s2tauroou0oexo ieiytfmDel(mo (4 lxrmo tadfa r ieil( trtoxo oydopt lfeil() Drru pnu4aptomo3tatlm2uan o;u0tlxrxrctadlm e u ilt)s2xm(r oy1lpeemieilsfaruru o;t1tet mictls m ulnmp;u4altoxr to1opD  i ilt trxm(o3oudale lfvia(farrr( pno0aeeo f3ilsfa emu s (0altrifcoodfaDe ieo ()t2uo(r nu1lp nlfctlt  ruaxm ;t4tetniocils sDemnmp t0arenmr3iotop e ivil( seum(o iy1lp elfet (fsrtmum no4tetomociltfm ulnms (0teenir3iodlp rlu il(0srtr(o oo1llen fci tfarumxmont0aet mo3tyt s elnms t) rxnir oydlp e ies;t)trtmxr3oy1amt  fvsatf Dua(ro;o1aex  oeiasfa2rl( s;() rerir oo1fmt ai s;()s2tmxm iodame  neia()sDrmxr ou0oeeomfcilsfm elu pn(4 eeoxocoodopDr i s (0 etrxrpoydlm nlici tfaDraum ;t0apxomfetlsla2ul(mo t4 exoxf3ootfmt  uvolt0srxmxrpnudale  fetl(  2tmxrpoo1tpxomi3tldfm2emnms u) etnmocoadomtrlu o;t0seto(m3iy1ll  lfvil( arrax oot1aetoifeiys a eanvs;u) ltoxo3tytoa eluei;s0s2xoxr3io4altelfcta()a2truro;t0oeeoif3iasfa2eluvs;u4 leoxo oatfa e ivo;t s2toxr3iy4apenlivtat  2umxrpnt1aee  feiytls ul( s;u0tlxrxocoadfpD  i i;s) 2xo(m no1ll  liciltf rrrumoot0oetnmfcild mDrm(vo t0texnif iatop e ues s)srur(rpoydamtn fct () Dtmur nu4alen octatlm eau snt4tlerxr tytfaDr u o ()s2uo(o iudap  lieiltf 2urumonu4openmf3iyd a eanmon()tlermr oydom  luesls0sexr(r3no1opeemfvsltfarrmurpoo1ale iieiytfa2um(mpn(4texnxf tydlpteln s t0seurirpou1alte ivsls)arua(mo;u0aptnmieildls ul(mon(0arxrmr oytopDran ils) 2um(rpny4omtelnetat) 2trxr oo0oexoifeiaslmDemnmo;t4aetnxocto1la rluvs;t srtmxopio4opte ies sf Duau o;u1opx ifetat m2rmnvsnt4tlermr3ia1op  lnvi;s)srxrim3iudopt mieilsfs2umu pno4aexomf3tldls uluvo;u)arxnifciotlptean s () rtrir iu1am elnvi s)a2taxrpno1tle iiciadlm2rlu s;t)arermf oodlmDeln slt0t2trir no1olt lnes sfsDrau ont1opto oetasls umu s;u4teeoifcoytfmtr ivs t0 rurim3io1opeeliciltfsDrmxr ;o1aptnmiciydlm2rlums (4tlenio oo1omtr ivsls)trto(mpiy1lmenmfvt s s2ra(rpou0tlt ifetadla2elu snt)alerir iatlm  lnvs t) etmim3io4omeemfctlt  rraurp;o4oex moeiysls2eluvp (0tleoir oa1lat  iesl(  eurirpiu4omtnmfvt s) Dtmumoot4texn f3iad mDemnmont4tlenif oo1lp eln sls)srtmim3nu4oleelneils)a2rmx ooo1aeeoif3ilt mDranvont) lenircoatlm  aueol(  2xm(m ou1opeemncs ( srta(moou1opx iicild s el( o t) etrmfciatfptrluvols  2xrxo iodolt  nesl(faDraurp;u0opeoif3ilslm2rm( s t0aetrir3iodlmDe ueolt0sruoio iu4lleelivs sfsrtaxm no1opeoii3tytfaDuluvo u4aeermo3ty1fmtean ol()t2xrxo3ou4oltn nvtasfartmumo;o4oet mfciysfmDulumo ()treriociadlmDeanvo ()trxrxopiydaltelietas aDtm(rpno1olxoif3iadfa eln s;(4tetomf3totlmtrauvs;t)trtmir ou4omt lfvil( a2rm(m nu0aexn fctltla ean p;t)aetnxr3iy1fmteli o (0 exmxm3ny1om elfet ( a2rau o;o0olx mf3tys m ea(vp;t)tltoio iodlmDeaues;t teurxrpio4omtn ies s srrmu  oo0apt ioeias mDumu pn(4aexrir iytla ranes (  2urir ou1lmt mnesas aDurx oou1altomo3iadlmDul(vs t4tlxoio ootlpD  ues t0teum(r3no4alenmnci s s2ur(r ;u4opxniocilsfm2rlumon(4trenmf3oytlatr uesl() rtoio3io4amenlnvsltfs2uaurooo4apxoifcilsfm emnmo;u4 eermo iy1lpDelivils  exoimpoudol  mfct t sDrmumpot1opeomociltfm uanvo t)teenmr tadom e nes s0 rxrio oodlmeelnvtlt)srrmu  no4aptomociltlmDrmnmo;u0areoir3oatoaD  ieslt)trtrxm3nudlmt lfvi s  Dtaxm ;o0optn o3tys s rl(vp u0 exrxr to1op e ies s  2trir ny1ol emfcs tf rtax o;t4teeomfeiat m2ulu s t0texomoctatoatrlu sl()teurimpno1opt mfciasf Dtr(ronu0aeeomo3iys a2ua( s u)artoxfcoy1omD li i t0 exr(rpoo1llen ivtatfartrurooo4tle mfciatlaDua( s;t)teenio oytlmDeluvi;()s2tmxm oodamtelfet t sDrau o;t4oex  fctyslsDrln s u) lxrir oadlaD  neo;s) 2trim3nydopenlictas  Dra(  nu4ole mf3iaslm um( o t)alenxoctadfp  auvsl(0trxmio3ou1am e nctl(  Drrxm nt0opt ioctlsls umn o t4trtrmr oa1lpDran o;s seumxopno4al emici sfarra(m no0olt  o3tat m em(mont4teenxr3iodfmteanvi;s)s2to(m3oydllen ncsat  rtrx  no0alenii3ilsfs2eau p;(4alerxr iadfm eaiei;t0teumxopoo1lptnmfeilt aDtau ont1tex  f3ils s ulnms;(0aexrmfciytomDrlueslt) exoim3nudlltnmnvtl(  Dtmxr ;t1apeomo3tlsls2uln on() rxrioctatfmteau i s  rtoirpnudlm  mfciatfarrruro;o4tpeoifciytlmDulu p (4artoxf3ta1fmt anvs s0trtmxm3iodlmee ncilt)aruau ooo1aeeo octytlaDrm(mo;u0aexnir ia1optr ivi;s)srxr(r3ny4om n iesa(f Dtmu p;u0aexnio3iysla eanvs;t0artrmo3tatomDr nvi;()srto(mpoudlmenmicta()sDtaur ou4tptomietatla2rlnvo;(4 eerircio1omt  ivo;(  rtmir ou4lpe  nvia(f 2taurpnt0tltnifetytfm emums t4tlxnif3tytlmt livi s)srtm(o3ny4om nmnesl(farurur ou4opeo fciasfm2uln s t0areoxrcoytoaDr ivs;s0 rtrir3oydamt mnct t sDta(  oo0oeenmf3tlsfs em(mo;u) rermr iodoateln il( s2ur(r nudom elfcils) 2ta( o;u1teto f3iysfmDuanvsnu)altomf3oytopD  ies;(  etmir3ou1llenmfvs t)arua(m ;t4tpxoiicilsfs2uluvo (0arenxrcoo1omDrauvi s0 rtoirpoydalt mivilsfsDuaxm oo0tex  ieiytfmDeluvp t4 etoif3iadfmDran il( s2urio3nu1op n fvta( sDtr(  ;t1tlt if3iad s rmumo;u0areomo3oy1fm r u il(0seumiopno4lp elieilsfs2tmumooo1aleo f3ilt s rmuvo;u4tltnirctatlaD lu s;(0 etr(mpoo4aptn nct ( a2trx ont1apx mi3tadls elumsnu4arxrxf3iodlaDelivs ()trto(opoo4am  mnvsltf Draxr oo1aleoif3iatfm rm(ms;u0trtrif iodom   uesl()s2uoxopou4ol nmnvtat)s2rmxm ;t0olxo fciytlaDel(mp (0alxnif3io1faDr ivsls)t2uoirpoydopen feils  rum(mpoo4oleo ictltlmDumumon(0 lxnxo oo1lm r nvi t0 euo(m3oo1ope mfei tf Dtaur nu0aetomi3ildla rm( p t0altrir oadomt ai i t)srtmxo oy4optn ictlt aDraum nt4tlxn f3tad a rauvp;t) rerio3ty1lmte nes;s teurxm oydame  fesas s2uaurp;u1oex  octad s ran s ()arxrmf3iytfp r nvi t)t2xr(m3nu1apte nes t) Dtrurp;o0oltnmfetlsfmDulnvo;(4 rxrmr totfp e nvolt trurxmpoodop emnvtl( sDrau  nt4tex ii3ildlsDumnvs (0 reoxocoadoaDrlnvi (  ruo(o nu4llee fcilt)s2ra(mo;t1apxoiiciytfsDranvp u0altnif ty1om elivs;(0texmimpoy4opt mfci () Durump;t0alt mo3ild m ua( p (0trxnifcty1laDeln o;s)t2xrxr no4ll emivtls aDumumo;t1tpxo feild a2ua(mpnu0alxoxrcoa1lmtrluvo t  ruo(mpnodapt mivtasfsrrr( ont1tlxomfciydfa elnmp t)trenmrcootop r uvs (0s2xo(opny1ape mnetlsfa2taump;t4apx if3tysfaDemu sn(0 etnxfcia1opt ln il() 2xrir3nudlm  licsl(fartau  ot4apt mf3ild s rm(von(0tlenxrcootlp rlnei;t t2tr(opno1lpenlnvtl(faDuax  no1oeeoioetls a ean p;t)texnifciytla   ies;()seto(opou1ll  mieilsfartmxmo;t4tlto oeils s uaumont0 exnircoydfmD  uei () eurxrpiu1om e fcs tfaruru poo4teeo o3tls m ea(mo;() rxoio3ty1fp   nvil(0trurxm ou4ale licias arrr(r ou0ope  o3tatlaDrmnvp;u4trxrifciodoptrau olt trxmio3oo4optnlneia( a2rrxrpoo0texnii3tatla em( p;(0 lxnir3to1fm e i sl(0 exmio ny1lm nliet ( a2trxmonu4tleomiciys a el( s () leoir tadoa elues;t)trtmio iudam  lneiatf 2rr( oou0opxoif3tasla rmums u)areomo ta1opD aiei;s) 2tmir iu1ale lnvt s aDumumpnt4tpe  iciaslmDumuvs (4alerio3oa1lpDraueils trtoirpny4ole  nvtat  rurx p;u0opt mi3iydla2rmnmsnt0 rtrxf ootomt  u i;() exo(o ou4lltnlfcsat aDrm(m ;t4optnmo3iydlsDeauvpnu4tltomo3iotomDr ueols setm(m3oodamen ncs tf rrau oou0olx ifciad a elumpnu4artrifciydom rauvi s t2urim3ny4al e nvilt) rraum oo1ole moetaslsDrlnmo;t) rtnmfciodfm  lnvsls s2tmxr3nodopee ncsltfa2taxroot1apxnmo3ildla2elnmo;t4 rtnxo oy1oaDean ilt0sruoxr iydapeelfeil(f rtmurono4oetomo3ils a2ean p;()tetomo iydlmDran o ()setm(r3io1al n nciasf Dtr( p;u1oexn oetasfs rlnmsnu0tlxnifctytlmt  ivi (0 2xo(r3nu4lpe  nciasf Dtr(m ;u1olto iciatfm2ra(mo u4 ltoxf3oytfa e n s;s)tetriopoodlpeemfvt s srumur nu0alto f3taslm ea(vo (0 lxnmo3oy1fmtrai s t)trxoxo oo1ol nlfct s s2umxmpot1oee  icilslaDemn ont4 rxnmf oa1omDe nei t seurxrpio1lm   nctatfsrrax onu1oetnio3iadfs rmnvo;() exrmrciotomDrlieilt trtrxm3iy4al  mnviat s2tr(mpou4alx  iciys sDelu pnu0 renif3tydoaDrln o t0s2xoir ou1alen ncilt)sDumx  ;o1apeo ietad sDea(mo;t) eenir3oydlm   ivs;( setrio3oy4lp elivi t  rtaur nu0opxn ociysfaDelums;()artrmo iadoaDeaivs s trxm(m3nu1apt lncia( a2taxrooo4oexo i3tltfsDra( s;u4alxomr3iy1lp e i s ()srxoio oydalenmnetlsfsrua( o;o1ole mo3ilslsDuauvont)alerifciotlm   uei;s0setrxo no4opee ivsa()a2um(  ou0aptoio3iytls2rlump (4tlxoif oa1om e ueslt setoio3oy4ol emncsas)s2urumpoo1teen ieilt m eau s;t0 rtriociotom   ues (0seumirpiodamt  ncsasfs2rm( p;o0aeeoioeiatfs2eauvon()arxnir3ta1late nvi t teurxopiudoltnmivsatfs2rauront1tlxn oetltlsDeln p u4 rxrxfcoodfpt  ivs s  2umxo3iydll n nviat  Dra(mpnu1teeoii3ias m ea(vpnt) ltoio3tatfa eanes ( trum(rpoudalt mncsa(fsDtr(moou0altnio3ils a rlnmont4 rxrir iodfm  au o;s trxmir iu4ameelncs (  2tau  ;o0tpt ioeiyt a eanmpn()alxoxo3oy1lpDe ies (0 rum(m3iu1aptn fvi sfsDtruroot1apxnio3tltlmDemump;u)alxomocoo1fmDeanvs;( trxm(o3nydalt lfci sfsrtmu  nt1alxo fetlsfs2ran p t4 lerir3to1omD ai i s  exo(o3no1lp elnet tfsDtr(moou1apx  fetyd sDea( pnu0 exoio3totop   ies;( srtoxopnudlle lnvias  2rr(mpot4teeomf3iadlm eanvs t0areomo3ootoa  anvi t) 2trxmpou4ap nliviatfaDurx ooo1tex  oeilsfmDrmnvp;u0alxnmf tadfmt aivi;s)t2to(m oodllt mivt (fa2rrumooo1aeeomf3tydfs2elnms;u) eenxoctatfat aneo ( s2xrxm3oudalt  neslt)srurxr nu4ape  ieiytlm2el( o;()aetnir3oy1fm r u sl( trtmxrpno1amt mnes s aDumx ooo4teenmieildlm2umu s;u0tetrxr tatlmtrli i;s  exo(mpoydll  lfes (f Dtm(mpot1aptoiieiydla2um(von(0 exnxf io1fm  aieo t) euo(o3iu1amtnlnviatfsDrm( p;u1olto iciysfa umnmpnu4trenmfcto1fp raieo t sruoxrpoo1ale  ivs ()aDtmxm ;o1ope ifctasfs rm( s;t)tltnxrctatfpDr neo;() rurim3iudameelfvtls aDtaxro;u0apt  ieild a2ra( s;(0 eenmr3tadfp e i o;()setmirpnudoptelnct () Draxroou0olxo i3ild a rln o;u4texrxo oo1fmtrau olt) eum(m oodapt  ici () 2ur(mpno0oexomicild mDrauvo ()arermociy1lp r uvs;() 2uoiopiodlm  livt (fsDrmu  ou4olt if3tldfsDrmu o;(4tlenir tatfa rlivi s trtr(r nu1al  lnvils)sDtru oot0tex micils a2raumo;u0tlxomfcoa1faDe uvsl(0tetrxr3iy1apenlfvi ( aDtax o;o0tlen f3iadla ean p;() eerifcto1oat  u sl(0 2tmxo3ny1alenmfcta( srtrx o;u4aexnifeild s2uauvs;() lenir3tydlatelies s)texrxm3iodop nlnviasfaDtrurono0apeomociytlm ul( snu0artrir3iadfaDeauvs;s sexrxm3nodlm  mnvsl(  Draxmonu0olt  ocildfaDum(ms t4aexrxf3ia1fm raiei;s t2tr(m3iu4op n ieilt arurx pot4oetnmo3iyd mDrauvs;u4alxoio3todop elnvi t  rxrir3nydopt  ieils  2tm(moot4olxnmf3iasfmDuau p u4trtrmfciadopDrlueilt s2uo(m iu4lmt lnvta(faDuaxm ;t4aetoio3iltls2ea(mo (4teenxocto1lmtrlu i;(0srxrxo3oo1ll  lnvtasf rraxmonu1opxoioetltfa ra(msn(4arxrir to1opt lu il()t2tmxmpoudom n fvi t)sDrmumpno4tet iietyd m2umump;t0 eeoxociadfp ranvs;()seur(rpoo4lm n nei t) Duax pou1opeomfctys s2rmnvp;u4 rtrxf oo1fp eln o ()teuo(r3ou4ale mivi ()srrr(m ;o0apeoio3tldfm uanmo;u0tltomo oa1omDrau il( t2umiopio4lmtnlnetl( arrrum oo4aexo icildlsDulnmsnu4alxnmrcio1opDeaues ()sexmir nu4ol elfeil()arrm(r ou4apeomf3iatlaDum( o u4alxoxrcoytfpD lueo s) 2uoimpiy4al  lfct (f rrm(ronu1apto iciysfmDrlnmp;(0arenmo iotoaD lnes s) exoxm3iy4lmt lnci s sDtrxmono4tet  i3tls m2eauvpnu4aetnio oatlp r neo (  2toxr3nodop  mneil(f Drrxm no1tlenmieiatla2rm(vsnt0 eerir oy1laD luvolt0 exmiopiydlp nmivilt a2raumono0apto ieiasls2rmnmpnt)aeermocia1fatelieo;s  exriopno1lpen icsa( s2urur ot1opxomoeiat a2rlu o;u0areomfctotfmt au i;t0setoir3io1lp nmivt t)s2rrx  ou1aptn f3tlt aDum(msn(4tltnxf3oo1oatr uvs t s2um(mpoy4ope lnct s a2urxmonu1texniieilsfa emuvpnu4trtoiocootoat li i s)tetmxm3iu1altemfvtltf rrrxm ou1tle  f3tld m ua( on(0 etnif3iodfaDrlivo (0 euoxr io4ap emfet t  rum( poo0apx mieiyd aDrmuvs t)tetnio3oy1fpteaneilt0 rtr(m iodap nmfcs t  rrr( o;t0tlenioctlsfmDrl( o u4aleoxf3tytomDranvo (0sexo(m3iu4lpenmiet t)srra( pnu4tpx io3iad mDeanmo;u4arenxfctydfaD  i ols)srxrxm oy1ale lnesl(  Drau  nt1aptniociadfs um( o t4trxnio oydfp rlueo s0t2uoio3oydlpen fcs s)arumu  ou0aptn ieiasfm2ulu p;u4 rxnmrciydlaD anvilt t2tmir3nu1ll   fvslsfa2rmur oo4opxo fctlslsDuan s u0 eenio iotlpD aueo s t2xmir iy4optn feslt  rtm(  ;t1apeoiietyd a2elnmsn(4alxnxfciatlmDeaues ( teurxr oodlmee fcsas aDtmxmont1oetomoctatfm2um( s;u0 reomrcoo1lpDeli sl(0 rtrio oy1olt mnetlt s2rmumonu0opxn o3ilslsDuluvpnu)tltoio3totfaDe ieo t s2umiopou1amt  net ()sDuaxrp;o4tptniociysfsDra(msn(0 ltoif3to1lpt  ivo;()t2tmxo3no4lleemicilsfsDum(rono0apt  i3iytfs rl(vs;t)alermo3tatomD au olt0 2xmxm3oy4ll n nct (f Drmx  nt1tpeo iciasfa ulumsnt4tlxnmoctodoatr ivs s tetmxrpnu1op emfvs s a2tmxm nt1teeoifeiltfa2rmnmp (4aexnif3tydfpt  uvols) rtmxo oudol   ieta(fa2rm(rp;o1opeomf3ildlm2em(vs (4 rxrxf3oadlm  ai ol( srxm(m3oudlptemnci t) Durxronu4tlxoif3ils a2rmnvsn(4 rxomf3iotfaDe uvol()s2to(m no4openlnet sfarrmx  ou0openii3ildfa2emn s u4alxrircoy1lat  neols  2tm(mpny4omte fvtatfartrxmono4tlxomfeiydfm2rmnvont0 reoifciytfaD aueols0 rur(mpnydll e fvt s  rumx oou0tetomoeiys s2ra(ms (4 rtnxr3tydomD  neslt  rurirpoy4lle lncsatfaDra( oou4oeeo o3iasls em(mo;t4tleoif3oodlmD  ueo () 2trxm3iy1am  lfcia( a2um(mp;o1opxomo3tydla emuvs;u0aetrir totlate ueo;t) exoim3oy1lp n nctat) rtaurp;t4ale mfciasfa2umumon()trtrmrcoa1fa  au s s)teuoio io4ap elivil(fsDrr(r ;o4tet  ictatfs eanms;t)alxnmr oa1op  aivo;t)seto(rpny1lme  fciatf Draum ;o4apxo i3tatls2ra(mo u) exrxrciydop  auvolt0 euoirpnodlp nlfvtltf rta(  no0aex  feiytlmDra( s;(4 rtoir oadfmt aiesls s2xo(o ou4lpe  fvs (f Drru ooo0ale io3iyt m2emnmon()trtnmr3ootfpt  nvo;(0trxm(opny4ap emnviasfa2rru  ;u0ole  f3ils s emump ()tetoxf3oodop  luvi;(0t2urir3ou1am nmncsl(  Dtr(m ;o1tleoif3ilsfm2emn o;u) lermf3oytlaDe nvo;(0teto(r no1alte ics sf rrrxrpnu1olt  i3tatfs eau p t4tleoir3ia1fm  lieil(0seto(r iu1omtnlfvi s sDraum ot0ope  o3ilsfs2umnmpn(0tltrirctotfm e nvs;()t2trxr iudolenlfes t) 2rmx  ou0tptnmoeiysfa ea(vo;t0trtoir3oydfp eai i;()srxr(mpoo4oleemnes (faDtr(r oo1optomi3iyt mDuaumo;t) exnio tytlpt ln sls trxo(r3oo4oltn ietls)s2rru p;o4tleoiociydlm2ul(vp ()treoxrcty1fmteau i;t) 2xo(mpnodlmte nei sfa2tm(mont0tlxnifeiyd s2eanvpnt4tlxrirctadopt lnei t t2xrio ou4aptnmfvia(f Dta(rpnu1tptniiciadfaDrln pnt0 rerxr3oodfa r uvsl(0 euoim3io1ol e nvslt srua(mpou4aeenifctlsls2rl(monu0trxoif iodomDraivol( trxo(rpiu4omte nvt (f 2rm(ro;u4tltnmo3iyd s uluvo;u0alxrmo oadfm  luvs s)texrir iy1al elfcta(fa2rm(m ;o0ole mf3iydfm ean s;t)tlxoxfcto1oaD aneo (0 rxo(m3iodalen fcslsfaDtmumpnu0aexn icils aDemuvs;(0alxrif tydfaDe n i;()trumio oy4ome liesl(  rrmxr ou4aexnmf3iadlm el( snt4 renxoctytlpDranvsls0 2trxr3iy1aptnmiet s)s2rax  nu1oexomfciyslm emu on()arermociydla  ln o;()s2xmim3iudapt  fcsat arum( oot4tpe  o3iltlm2um( o;u) rtrxo iotfaD aivi s)srtr(rpno1lpee ivtl(fs2umumpnu4alxoif3tatlm2emumsnt4teenir3tatfm r ieo s) 2xoxm io4lleelncslt)sDur( pnu1ale ioetas sDea( s t)aeerxr3iotom eli ilt0 rxmio ny1lmtnlfvt tfarrru p;o0tpxniieiltls ua( p u)aexrif io1op eluvs;s srtmir iy1amenlfci ( aDua(m ot1tltn ocils s2rm(vs t0alerio3oadoaDraneo t0trtm(r nudope lfvsls aDtrxro;t1tpt  f3ildla rmums;t4arxnir oadlmt aieols  rtrxrpnydamtemfvs tfaDtau p;t4aet iociad mDul( snt0arenif3oytla   nvo s srxmxr3no1olenmfvsl()arta(ronu4aet  ietydfa uluvpn(4 rtnmo3oydoptrluei;t seum(r3ny1apen ict t sDum( oot0aptomfeiltlm rmn s;t4 ltoir3iadfmt lieo t trxo(o iudlmte feta(fa2rm(r ou0apxnioctaslsDuanmont)tleomocio1oaDrlivo;s) rtrirpnodalt  fcsltfs2taxr ;t4altnioetltlm2ra(vo ()trtrir oatlmtrau slt0texrxr nu4olenlici s)s2umu ooo4aetnmicilsla2ra(vp;t4texoxrciy1omD au s () 2ur(mpio4lme mics ( s2uax  oo0apen fctytlaDulums;(4 rerif iytfm elnvi t)tetmxmpio4olenlfvsat)sruaxro;t4tee ioctatfm umumsn()arerifcootlpt  ues (0setmimpiu1oltn nvtl( s2umurpot0optniociltfs um(msnu0 eeomf oy1fmD  ivi s0srtmxopno4oleelivsas a2um(m no1tpxo ictasfs2ea(mp (0alenxr oo1fm  ln il() rtrio nodlmte fct s) rrm(roou1altoiieiatfmDem( s (0 lenxfctytomDe i o ( s2umir io4ome lnvsl(fsruaumpot1teeoioetas aDumnvo;u) eerxfcia1lmt  nvo s seumiopny4ale mfvils s2ua(mpno0ape mi3tldfm2rmuvsnt4tltnir3ta1laD livslt) eumxm oo4altnmivil() rra(rp;t1ope  ociat aDeanmo;() rxrir3oatfmteai ols0t2uoiopnudop nmfvsat)sDrm(rpnt1opxomf3iysfsDuanvs;(4trtoxf oy1lp eluvs;(0s2xrxo iu4lle  feilt) rurxm nt0tpxn f3ias mDrlnms t4treomfcia1oaDr nvo;s0 2uoirpiy1lm  lnesat) rtaumo;o4tet micias s2rmn p;u) reomoctadfp rauvslt  rtmim3iydalenmfetl( s2tmxro;o4oeeomi3ilsfa uanmon()alxnmrcoy1laD  neo ()srxmxr3io4amee icta()srra(mpnt1oltnii3tasfs2ulump;(4texomo3totfp rai sl( tetrxopou1lptelfcils)sruau o;u0tleoiicildlaDel( pnt0alerifctodlpt au i;s  2xoimpou4alt mfesl()aDrru p;o0opxnmfetltfa uau ont) exoxo3oatom elu s t0seumxopiu1amt mncs s  Drrx  nu0oex ii3iyslm umn p;(4arenxo oo1fptrlivolt s2xoxo oy1al e nvia( s2urxrp;t0aeenmociat a2rau s t) eenmf oatlpDe nes;t teumxr io1optnlfvias) rtmur ot0aee  oeiasfa2ranmo;u0 etnir iytlpt auvsls tetoim no4ll  lfetat artaur nt1opxo f3iyt mDem(ms u)aexrif3ootlatraivols  2toxm oy4omeelfct sfsrumx o;o0aetoiieildla uau p t0 eeoio3oydfpDraivsls) eumxm3iy4om   ivi t  2tm( o;u0oleo ociytfs uanvsn() lenif ta1omDeaivs;t0 2uo(m3oydlme  ictas  2tm(rp;u1tetnmi3iad mDea(vp (4altniocta1fmteaueo t)srumxrpio1ol nmfeias artrum ou0altoii3iat a eluvs;(4trxoxr oo1op   ivo s0t2tmimpoydll  mfvt s  rrmxmonu4tlx mf3tatfs2em(vs;t0 exnmf oatlpDr nvi;s tetoxr nu4openmfetls) 2tmxm ;o0tpx iociyt s2rluvo;()texniociy1laD  ueslt srur(r io4aleemfci t)s2taum no0opx mieils a emnvp;t4 rtrif iadfp  aueo ( trum(r iy1aptnmfvs s  Draumpot0apeniieiytls uanmp t4alxrmr oytla raneo s0trxrirpiy4llen ieiasf rumxmont0tee  octyd s2eanvo u4 eeomr3iytoa   n sls srxr(rpoy4ll n nciat)s2ua(r ;o1tptoifctlsfs2ran ont)teeriociadfa r neols trurimpnodlmenlics s sDumxm ;t1oeto oetadlm ul( on() renxocta1lmDran il() rxrxrpiy1ope  nvsat arumumpnt0apxn feiys m2ra( snu4texrxo3ty1lmDran i;s0setrim3nodam nlnetlt)a2umxro;u4altomfciys s rl(vo t4alenxo3tytomtr nvi;(0setoir3oy1opt  nvil()srrmxrooo0oeeniictydla umn p;u0 rtniociatfmt aues;s0 rxm(r iodoptnlfcta(fa2taum ou4altomfctatfm2rl(monu)aetnxf3todomtraues;t s2uoir nydlmt  nvsltfs2tm(m oo1oltnmi3iyt a uauvs;(0trenif iotfaDe ivs;() 2uoir iydlp e nvtls srrm(mo;t1olxomiciasfaDuln o;u4tetrio3oytoaD au sls setmxm oy1omtn nvsls a2ra(rono4aptomo3ildls2elums;t) ltrxocto1lateau s (0seto(mpnu1omtelictasfa2tmxmo;t4oeeo f3ildfa2elnvs;t) rxrif oydlm   i i;(0 2tmxr iydoptn nvtat  2urxmooo0teen ocildfa ulu o (0 ltnmrciodfmt ln s;s0s2xmxo3io4ol  mfcsa(f rtaumpnu1olx mf3tatfa2emn onu4 lxomocia1faD  ivo;s sexoxo3oudaptnlnesas)arraurpoo4oet mfciasla2eluvs;t4aexomf3iy1opDrlu i ()sexm(mpny4ome  nvtlsfa2rm( o;o4optn feiat a2emnvon() lxrxf3io1omD  n sls0 2toxo3io1lpe mivsls)aDtau  nt0apeniiciad m uaumont)tlxoxo io1opDe ueo ( s2xrim iodlme mfci sfartmu p;t4aet mf3iysfaDelump;()tleoxfcoy1oate ies;t0trurio iodapee icilt) rrm(mpou0aexnio3tltls umu ont4 rxoxo oytoa rln o ()s2xmiopoy4omtn nvtas  2ta(mo;u4oex iiciyslaDumumont0trxoxfcoa1fm r ivo;s0 2uoxopou4ol   fct (  Duaxro;t1oeeniieiadfm uluvpnu0tlxrmo3oydlp raivol() exrxo3iy4altnmfcslsf 2ua(rp;t0opt iociatfaDrmu s u0treomrciatomDrauei (  euoim3iydomee ics tf Drrurpno0tlxomf3iltfs rm(vsn() renio3totfpD auvslt texoim iy4ll e fcsat  2raurpot0tex  feiysfa uaumo;t4areoxrciytfp e ivo t)setmxr nu4lmenmncsasfs2rr(  oo4aet  feiydfa2rauvsnt4 lxnxf3oydfp  livs;t0teumir iudop nmieiat artr(  ;u0alen ieild sDulu pnu4alenmf iatomDe neol(0 exr(o3iydll elnvt tfsrra(mpou0tleoifeiasls rmumo t4aexrir ootfp r ieo;s) rtoxo oo4am elnvs t)sDrr(rp;t0aleomoeiad a eluvo t)aexniociadopD  nes t0truoxmpnodam  micsas sDtmxr ou1aeeomietld sDean s;(0aeerio3iatlaD  nvo t0t2xrxo no1am nmietls artrx oot0opeoifetadfa em(vsnt4aetrif oadfp eluvils)seurio3ny4op  mict t)srtaxmo;t1olenmoeiyd s rmu p t0 exrxf ta1laDelieol(0srxoxm no4aptelnvil(  Drr( onu1olxnmf3tatfmDrmu s u0arxomocoadfp e u s s  2umim3nodal  liesltfsrtrurpnu4tet  fciat aDrln o;t4tlerxf3iy1la   nvils0s2uo(o oy4opt  ict s  Dtmumo;t0aexnifeiadfmDuanvsnt4 ltnxf3iotlmt  u o t  2ur(o nudameemnei (f 2trumo;o0aleoio3iad m rlu p (0texrxocoo1fm r n ils0s2xo(opiy4ape  nesa(f rumxm ot0oet iociasfa2elnmpn()tetnmfcoadlp r i i;t)trur(r nydlp nlicslt)aDrmur ot1alt ifetatfsDuaump u)texoxr iadfat  i olt)s2xr(o io4lpe mivtltfa2rrumpno0tpxnmf3ilsla uanms u4aexnmo3oa1opD  uvo;(0 2xo(rpno1ol   fvslt)srtrx pnt4tetoiiciys a eaump u0arerxrctydlaD  uesls)srtrxmpno4amee ieias sDrr( pnt1optoio3iys mDelumpnt4 etrmr tytlmtelnei;t setrxm3ou1lltn nvia(  Dtr(ro;o1oet iocild s2eluvs;u0aexnxfctadopt aivils0 rxr(r iydom nmiesls aruaumont4aleomieiadlsDean s;(4alxrmf3tatfp rai ilt) eumxmpnudam nlfet t) Drrx p;t4olto o3iytla uanvon(0 eenxo to1lpDran o;(0srto(o3oo4amtemfesas)s2rruro;o1oee mo3ilsla rmn pn()aleomfcoy1oa e ieo;()t2xm(r oudlme lfeiasfsrumxrono0tpt ifciytlaDra( s;t)artnxf totoa elivilt)trxoimpou4al emfvsatfa2rmxmpnu0tle miciyd a rm( s u) ltrmf todom   nvi s) eurxo nodomt lfvtlt)a2rm(mpot1oleomiciydla eanmont0trxomf3oatfmt an i;s  rtoxr3iydll   fetls  rumx  ot0apxnifeiytfa2umumon(4tleomf iy1lat  ivil( sexo(m3iy1openmivt () rrrurpot1aee ifciytfa2rm(vsnt)artnio3oadfp r u s;t0trumxo3oy
\ No newline at end of file
@@ -0,0 +1 @@
+u s;s)s2xmxmpiydopte feia(f 2tr(m nu1tee mfeild m2eluvp t0aeermo iytom  anvs;s t2ur(o3iu4ameemfetasfsruau  ;t4tlxnmfctadlaDrau s ()artrmf3oatopt  nesl(0s2tmirpno4omenmfcs t aDuaump;t0altoifetatfsDelnvs;t0 ltrmo oytomDr ueilt) 2uo(r3iudop  lfesa(  Duau onu1ope mieiadls2rlump t) lenio iytoptr nes;()t2urimpiy4am n ietl(  rrr(mpnt1tlxn i3iatfa ulu o u4alxomrcoy1fmtelnvolt) etrio3nydopt  fct (faDur(  nu0tleniietasfmDuln p;u)arxnmfcoy1oa elivi;s  etmxo io1lme mnvtltf ruaumooo4apxnmfciatlm el(vo ()alxnif3oa1fm rau o s  2umimpoudope  ncilt  rumxmonu0alxo ieiydlsDul(ms;t4texnxo3oo1oa  au o s)t2um(m no1aptnmietat  Dur(ro;o4alxo f3tat m2umnms;(0tlermrcoadfaD aivolt s2uoxm3no4omeelies ()aDta(mpoo4aexnio3tysls2um(vp;u4arermo3iadlmD anvs t teurxm3iodalt mivsls)a2tau o;u1apt  f3tasfs rl(msn(4tltnxrctatfmte ivolt) etmxo oo4aleelfci (fsDumur nu0ale  fciadlsDelums (4aeeomo3iadop r uvslt0trum(opio4lp nmnci sf 2ua(  ou0optomfctysfmDumnmpn(4alxoxo3ootfp r ivs;() exrxr oodomtelicias)aDta(  nu4oetoioetyd a2em(vsnt4tleniociadlm elnvil(0 rxm(m oydap  mieslt)srtaxm ot1opt  fcias a um(vp;u0 renmo3iydom  au sls)s2xrir iy4ale licsl() rra(mpno1aetnmi3tlslmDumuvp u0 lenmo oo1lpDe i o;( t2toxm3iy1lm  mnci () ruaxmont0tpenmiciatlm ranmo u4tltnxfcoy1lmDrlieilt s2xoirpiu4ap nlivtl(  Dua(mono0alxn feilslaDelnms () rxoxo3iotom elueilt0seum(o nodlpt  ictls)aDur( o;t1alxoii3tltla2rlnmont)tlenxf oy1faD livs;( s2xr(m3io1ol elicils)s2rm(m no0apxnii3iysfa2ua( o (4aexoircoytlateluvo;t0s2tmimpiu1op emivs ()a2ururo;t1opxniociatfaDranvo u4trermr tydfaDr nesl( srtrxr3iu4alenmnvi t a2tmxmo;o0tlxniietld mDra(mont)texoxf3todfa rlneo;( texoxm3iudlp   fviatf Dta(rono4olxomoetlt a2ulnvo () exnmf3iy1fpte nei (0t2xmxo3oudaptelnes (faDum( o;u1opto oetldfm2uanvs () rtrxrcoodlm raies;t srxrim3oudlmt mfcta(farumurp;t1olt iieiadfm2elnmp t)tetnmr iatomD  uvs;( t2xoxr nudam e ivt () rtax  oo0alenioetytfsDul(vpnt4 exrio oo1faDelueil(0t2ur(o oy4amee fvi s)srraxrpno4tptnifcild s2uanmp;u0aexrmoctytfpteluei t seurim3oodoltnlnci s  Dtax pou0oexn oeiasfs rau o t0 ltnio3oadopt  u o;t t2xm(r3iu1lmt mictlt) 2rm(mp;t1optnmieiaslsDuau o;t4 lxoxocta1lmt lnesls) 2xoxrpiydoleelnei sfsDtaumont4opeoifciydfaDumu s;() eenmfctadfaD an o;t0 2trxmpno4al nmfcias aDtrx onu0aee ioctytls rmnmp u4 rxomfciadfpteau s;t)setmio3oydom elnei ( s2tmx ono1olto ociydfa2rmnvp;t0texomrctotomD aueo t0 2to(mpoo1omeelfcsl() Duaxr ou1tlenio3ias s rl( sn(0teenxf iotfpDe uvo ()truoxm3iu1ap  liet t)a2ur(mooo0olx if3tat aDul( o u)trxoif3tytlatraneil(0 2uoir oydlle mivs t) 2ra( pot1alxomoctls mDemumsnu)tlxoif ia1fp ean o;s)tetrxmpnudam n ivt ( a2ur(m nt0apenmi3iaslm2rmnvp t4 ltoxrciytoaDeluvo t)texrirpny1lp  lnvsl(fs2um( poo1oleomo3ildla2uanmp t)altoifciytomDrlnei t trtoxopou1omtelnes t) Dtaxr ou0tpenmfeiatlmDemuvont0teeomfciydomDrlies s0 2trxo no4alt livtl() 2trxrpou1tlxomiciyt a2elums;u)aeenxf3oodoat  i olt  euoimpio4lmt  fcsas) Drr(  ou1olxnio3tysfaDuln snu)tetomociadlatrlu s t)texrxrpoy4lpen nvtas) rrau pno4oexn ictydlm2rl(vsnt0 eerxf tatfaD lneo;s s2xm(m io1amtnmfvs s)artaxmpno0oee  ieiytlm umums (4areoio tydlpDe n sl( trxmio3ny4ol nmfct ( s2ua( ono4tet  feilsfaDrmuvon(0altnmo oodfaD  u i;t) eum(r iu4lmeemnvtat)sDuaxmpnt1tpx  ieiysfs2ranmpnu0 eenir3to1fp eaneo t) rxrio ny1al nlfctlt) Dur(m ;o1tlxn feiysfa rl( s (0tlenmfciadlmDrlnvo;t0 2tmir oudamenlivsl()sDtmum no1apxomo3iysla2rln p;(4 lxrif ootoaDeauvsls s2uoio3oo1om   netas)sDrrxmo;o1tpxomfctydlsDrlnmsnu0tlenmf iodlat luvsl(0s2trxr3io1lpeelnvt s)aDuaxm oo1tlenmf3iyt s2eanmsn() etrio3ta1lat au i (  etmimpnu4op   icia()arraxmpnt4oltnmf3iyd a2ulu o u) rxrmr3iodoat auei ()srtoxo3no1lpee fvtls s2rrxmoou4tlx  feilt aDrlu p;(0 leoxr3iadom  ai s s0t2xrxo ny1am  liesl()artmurooo4tpeo i3tls m2emnms;(0 rermr3to1fpD luvi s0srumimpiu4ol   ivtas  rtm(rp;t1tlt miciasla ranvsnu) leoxfciodom raueolt0 euoirpny1lp  mfct t)a2umxm ;o0aet  iciyd m2ranvsn(4texnxf oydlpteli o t texmxm nydam emnvt s  ruru poo1alxoii3iydlsDrau s;u0trxnxo oo1lptr u ols  2trim3nu4apen ici tfsruaumo;o4openiiciysfa2emnmp;u4teenirctydlmD au s s s2uo(o3io1lpte fci ()sDtm(ro;t4aleomociyt a rln s u0 lxoif3totoa  auvolt) 2ur(o ny1llenlicta() 2tr( oou4apenmf3iydlmDrm( s;()trtoio3oytfa  aiesls seurir3nodopenlfvsl(fsrur(m ot0tet ii3tysfs2rauvsn(4arxrmo3iytlm rlieol(0 2uoiopoy4lmtemnci (f Drrxmpou0aex  f3iat aDrln pnt)aetnxf3iadopt  ueo ()teuo(opio1omtn fcias)sDtrxrooo1aeeomfetadla2ra(vsn()arxomocoytomt lnvols0 2xm(mpny4alt  icsa(faDurx ono0tptniictyt mDelumsnt0aeeoxfcta1fa rau i s)trurirpoy1lmen nesat)sDtrx oot1olxnmi3iydlm el(mon()tltnmo3oy1fp r ies t  2to(o3oydopeelies sf 2um(m oo1oet  oeilsfa em(ms t4alxoif3tytop r nes;t srto(m no1ol   fvtls) rrrum oo4tetomiciasfa emnmo t4 ltomo tydoatr n i t0srur(m oo1altnmfci s)aDtaxm ot0aeeo feiyt s2rln s;u)trtomocia1oat luvslt0setrxr3ny1lmeelfvils arrmxront1aptomfetysfmDrmnvpnt4artrio3oydlpDe ivi s) rtrxo3ny4om nmfeta(fa2um( p;o0aptn i3tasfa2rlnvp (0trxoio ia1fmDe ivil(0trtoxr ou1ol nlicsatfa2raumont1aetn ieiys m rl(vpnt)aetrmoctatoptraivi;s  rxoxrpny4ale  fctls)sDum( ono4ole ioctlt s2rm(vp (4 ltoif totfmtrai sls)t2toir ny4oltnmfcsltf 2ra(mpot0apeo oeiltfm2ul(ms;t)aeermo oadlmtrauvolt0 2ur(o io1omenlics t)arumum ;o4tle  oeiysls2eaumo (4aeermociydop eaivslt) 2toio3iy4am nmfvsl()sDra(moou1oee ioetlsfaDeaump;t)aetrir oodoate ieo s)t2xm(o3ou4lptnlncil(faDumx poo4apxo fetld aDuau pn(4trtnmr iodoat  i i t trxm(r oodlm nmietlsf rur(rooo0oltn oeiyt s2ranmp (4 rermf tytopD  n ilt trtoxrpoydaltemnes sfarua(m oo4apt io3tyt aDranms;(4 etoxrctadoaDelivi t  rxoxo oo1omt livtas aDrr( p;o1oexoiictltlm eauvp;u0 eenmo3totopte uvols) etr(rpiy4olen fet (  rra(mpno0tpx mo3taslm2rmnmp;t4 exnioctytfaDelnvo;s trxrxm3iy1alt  feias sDtrumpnt1aetn ieildlaDran s (0 rxomf3to1omt  ueols)s2urio io1op nlivt s aruaur ou0tle ioctat aDrlnvonu0arxriociotfa   uesls)teurim3iu4ol   nciat)arrmur nu1alx mi3ildls uanvsnt0alermr oytlmtr neil( t2um(m oo4ol nmncil()aruaxr ot0opxomfeiytfm2rlnvonu)artrir oa1fmt an o;s0 etrio3oydole mneils)aDur(rpot1apxoifciadlm2rlu s;u0areoifctodlat lueo s) rumio nu1lltn ivtls artm(roou1oexoifetls m umump;(4 leomf3ootfatrlivs s seurim3nudll nlnvia()s2rmxrono0tee  feiaslm2rlu o t0tltnmocoytoptr nei s) 2umim iu4oleelfvtasf Dta(monu0tpt mieiadfs2el(vsnu4aexnmf3oo1lptranvs s0teurxrpno4al emfet tfarrmx pnt1aexomieiytlm ea(mo;(0alerxo oytlpD lneols0 rxm(o3ou1op emfcsas  2uru ont0opxoioeiltlm2elumont)tleoxrctytfaD  nvi (0setm(m3iy4omen ivt tfarurump;t0olenmfetasfmDelnvs () rxriociodom  ai sl()setr(mpnydamtnmiet s)srurum no1alxn icildlaDumnmo t)aexrio3iy1op   ivs (0tetoim3oy4lptnmnci (  rurx  no1tetnioeildfs2eau s u4altoxfctytom e nvs;t)seumxrpoo4olte fci t  Dtrxr no1alt  i3iadla2rlnmpnt4tetrir3tytfmDeln ils  exrxr3io1apenlies sf rumumonu1tpt ifetyslm2ea(vo (0teeoxrcoadfat  n sl() rtmxr oy4lltelics t sDtm( ont1opxomi3tat aDean s;t4texrircoy1opteai s ()t2tr(r ny1apee iei t) rumxmpoo1teenmfciyt a2emu onu0teermo3tadlat ln il( s2xoim iudlmtelncta(  2um(monu4optnio3iytfm2umnms;t4areoxo todfmtean i;t) 2xr(o3nu4lle mneiat  Duaxr ot1oeto ociysfa rm( p u0aetrxo iydomD au i t0srtmirpnu1optemivia() rtm( ont0tpto i3iatfa2rmumon(0areriocootop  livols t2umxr3oo4am  lnvt ( arrmu pnu0tltoiicils m2umu p t)alxoxf iytopt ln i;t s2uoxm nydlltnlnvsat)srrrurpoo1tlt iieiysfmDeluvp (4teeomrciodfpteau s;s0trurxo3ou4omt mfvsa( aDua(m ot1oexomfctlt m eau p ()aleoifcoytfmt aieol( trxmim nydop  mfct t) 2ta(ronu0oexnmf3iadfs uauvp;u0alenir oytla r ieo;( trxmxo iudomenlivilsf Dtru pnu4tlenio3ils m2em(mpnu)trxoxfciy1op   nvi t) rto(r iodoltemfcs ( s2rmxr no1alxomociyt sDel(mp t)tetnir3to1la rlivil(  2xrio3nudlm nlfviat)s2rau p;u4tlt iiciysfm2uauvpnt4tlxnifctotop r uvilt)seurir3oudoltnlfctat a2ta(m ;o1tlx ii3tltfa2ea(mo;u)alxrxo3iodlp raues;s trxoirpnu4lltelivils a2tru pnu0olto fcilslsDran on(4 rerif3to1oat au il() rtrxm iy1lleelnvi (farur(rpou4oltoiiciatlm ulnmo;t4trerxf3tydfp  auvil( seumirpoydap   nesa( a2tax pnu0alx iietlsla2ean p;t4 etnir3oodlmt lu olt  2umxo3io4oltelfetltf Dum(mo;o0alx  iciltls2ranvont4 rtoxo3io1oa rluei;(  euoim3iu1lltn fci ()sDumxrpoo4tpe mi3iyt sDel(ms;t) lxnmr3totlpte ivols  rxmxopnodapee ivtas)sDua( ooo0altomi3tldls el(vp u4trtnir3oo1omDr u o;( srxmio iu1opeelfvil(  Dtm( pno4aet ioeilsfm2ulnvs;u0trxnio3tytlmD  ivs s0 2tmio io4amtemivsa()arrru p;u1tlxo fetldlsDra( snu) exrmrciytlp   u o;t) eumir ny1lm  mfeil()s2rm(mpnu4ape  icildfa ra(vonu)arxnmo3tadfp raivs;s0srxoxm oo4lm nliciltfsruax  ;t4aetomfetldfmDrlnms;(0aetnmr3ia1lpD li ols)trtoim oy4apen ncs t arrr( ont0aee  feils a uanvs (4aetomo oadop raivi s  rxo(r iu4aptnlnetlt)s2tmur ;t4altnmfciaslsDra(ms u) exomrcoa1lp e ueol(0 rxrirpiu1aptemfcta( aDtaumpnu1aptomfcild m rl(mp;t4 reoxocoatlaD lnvolt srxo(m3iudape mfvi t  2umu pnt4aeeniietlslaDemnvo (4arxoifcoodlp rlneo (0sexo(r3iudapeelnesl() rtaxrpou4oee ifciaslm elums;u)artoxo iadfptrlu ils  rumxopio4lpenlnetl()artrumo;t4tlxnio3iad s2em( p ()trtrxf oy1laDrlieo;( seuoir3io1ap elfetl(fsDtrum ot0texnif3tld s uluvs u4 reoxr iadoa eliei s0texo(m3iy4oleemnes tfsrum( pno4optoiicild m2um(vs;u0tltrxociodlptelnvi s)trumxr3oodoptn ncia( s2ur(  nt0teto oeiyd aDra(vp u0areomr oatlpt aneils)setr(o3io1optn ict s)sDumurpou4alx  feiatfa2ulnvo (0tleoxf iytla  ln o;(0trtr(m nodap emfesat a2urxrp;o4olx mi3tysfa rlums t) etnmfctadfpDe ivo ()trxmirpio1lm e nvsat)a2umx o;t0alx ifciyt a uaumo t4aexnif3iotfm  ai sls)texmxm3iy4lptnlneias aDtrxrpno0tlt moeiydfs2um(vo u4trxrmr iotoaDrln ol( teuo(opoo1am emivtltfsrua(mpnt0tlxn ociys mDua(mo;()areomociadlmt  ieo;t)trxm(opoo1am  lfctas  2raxmpoo0aleniieiltlaDranmonu)trenmo3oydfp   u s;( tetoim3oo1om emicsl( srtmuro;u4tpeo fciysfs2elu o;t0aleoio3oadfm   nes t0 exr(o3oy1ol nlivtat) 2rmxr ;u1olxnmiciadfm2rmuvp () reoxr3totlmtrlu s;t srto(m3nodalee netls s2uau oot4apt  iciydfaDea( snt4tetnir to1lm   nvils teum(opoy1ll nlnet t)arrrx oou4opxnmieiysfm2el( pnt0 rxoxr iotlmteanvils  2xrxo io1lp emfcils)srumx pnu0tlxniociltla2um( s u4 eermo iytop e i s;s trxmxopnydlmeemfeil(f 2tmxr no0tptnii3tatls rlumo;(4 reomoctatoateluei s0sruo(m3iydopenlfvtas) rurxm ;u1texnmo3iltlm2eau pnu4 ltrmociadoatelues t0srtoxrpiydolen nctl(f Dtrx oot1opeo octltfm rlumonu0 reoif tatfp e ivsl( tetr(r no4ale mnvt s)arum( p;u1oetn octat s2rluvp u4tlenxfciy1lm  luvo s  euo(o oy1om elivia( srum(rpnt0apx  fetls a2ea(mon(0trxnioctotfa eauvo s t2triopno1ope livsl(f rrau p;u4tlt ifctatlm um(mp;t)tltnif3ty1latrlivs t trxr(o3oudolen netl(fs2rmxmp;t1openifciltfs rlnvs t) reoiocoo1fpt aivsl() rur(opoodlptnlivtas  2um( pot0tpxniicild sDuaumpnu4 exnxf3to1lmDe ieo s)seurim iodomtnlivsa( s2tr(m ;o4texn i3iadfmDrm(ms (4 rtnxo to1lpDelnvs;() rum(mpio1al elicilsf 2ua(  nt1olxnmoeild s umump t)teerio3io1lmD livi (  eum(m3iu4om elfes sfs2uaxm ;t1aexn oeiydfs2ulnmp t)alenxo3iodopDe n i;s)s2trxmpny4omeelfesl( a2rrx ono4oetnmf3iltls elump (4 rerxr3ty1lp elu i;t) rto(o ou1olt mncilsf rrax  ot4aeenioctltfsDrm( s;() ltnmf ta1opDraieslt) euo(o io4lp eliet s aruaxmp;o0tptn fetas s rmu s;(4 eermr io1oa elivs s sexmxm iu4al eliciat a2tmu pou0aex mieiltfs ul(msn() rxoir3to1fatr ies s t2toxmpnu1lltelnctl(fs2umxr ou0olenmo3iytfa2uan o;u) rtnmociytlmteaiei t)texmxm io4lpee ncias) rtmu o;o0apt ii3tyslm2el(mp;u4tetomo3ta1fpD aieol(0srto(r oy4lpt mfcsls  rraxm ot1olx  oetydfmDua( s;t)tleoxrcootfa   uei t)sruo(opiu4om emietat)s2trxr no4oexoiociydfaDuaump;u0 rtoiociadlpDeli s s0teuo(mpiydlle mfeta()sDrrxm ou1tltoif3ild s umuvp u)trerxr oadfa   ivs;s0t2xoirpny1ap   nct t)aDrruro;u1tptnifetlsls rlnvo;u)aeenmr iy1lmt anvil() 2uoimpno4am eliet tfa2trump;t1tptn i3tys aDrluvpnu4trxrmr iydopt li i s0trtmio3iu4lme  net (f rta( pno1tpxnifetad m umnvs u4altrxo3tatfpDrlu i ( texmio no4amtnlnei (faDrmump;t4apxnifetlt mDrl( ont)alxoio3to1fa   nvi;t) 2xo(m3nydllt mnviltfsDrrxmont4tleoifeils aDrl(mp u0aeeoif tydla   ueslt t2tmio nudlm emfvi tfsDrmxrpou4tle  o3iydfsDulumo;()arermfciodlpDrluvo s t2tr(o3io4alt lncia( sDua(mpnt1oleoioeiytlm rm(msn(4alenir iadoaDr uvi;t)s2ur(mpno4llen nei ( s2urur nu1alxnioctltfa umnms;t4arxnmf3iotla eaivi ()srxmir nu4apeelfctls s2um(  nu1tltnmoeias m2eluvsnt0aetomr io1lpte i olt0 rxm(mpio1lle lfvias  rtm(mono4oet ifetydlm2uau on(4 reoio todlm   i o;()truoxrpou4omtemics (faDumu poo1tpx  f3taslaDeaums;(0tlenxo tydoa e ies t0t2xmio3nu1olte fet ( s2tm(m nt4olx mf3tydla2elnvo u)teerxrcoatfa elnvi;t0 etr(m nodal n ietl(fa2tr( ono1teeoiiciltlm2ea( s;u0tltoxo3ta1fa  livs s)setrir3iodamenlnvsa(f rtrxmoot0opto octlslsDul(vo;()tlerxf tatlat ln o;t0teto(opiy1ol elfct sf 2uaumooo0aeeniicias a eluvo t)trtrmr ta1lmDrlieo;s) rxmiopnodlptnlnviasf Duaumo;o1optnmociydlm emn p;(0aeenxfciotfm eai i;t)t2urxmpio4lm   ies ()s2ur( p;o0aeto i3iydfs2rlnvo ()teenxf3tydoateluvo s0 2xoxr3no4apeemnci sfs2tr(rpnu0aetomf3iytfm2umnmo;u4arxomfctytoa raivil(0 rtrxm nydal  mfet (  Durxmpot4oeeomietadlm rl(vpnt4aexniociodlp  livs;(0tetmxm ny1aptnlfeslt srrr(ronu0opt  oetydlm2rauvp u0 rtomf iatfatr neil( srtoxm nodlle livia(  rur(  nu4ale mi3ils sDem( on(4 rxriociy1op  luvo;t0 rxr(mpnydol  liviasf rtr(mp;u4tee mo3tad a2ul( onu)alerxoctadop   i olt  rum(opoy1llt mies tfsrtau ono1aet mfciyt a eauvsnu0aleomf oydfmD aieols0setm(rpiodoptemfeiasfartr( p;o0oexn fcilsfa em( s u0 etrxo iytfaD aiei;()t2trirpno4omenmfetls)sDrau poo4optomo3iytlaDulu p ()teermocty1optrauvil( trum(r3no1am nlfes s aDrmxmooo1aptoioeiltls um(mp u0trtoxfcoo1oate uvs ()t2tmxopny1am nmnvt s aDrau pnt1texn fctas m2rluvs t4trtnif3iy1oaDraieo;s)s2xoirpoydoltn icil(fs2rm(  ot1aeto oetaslmDeluvo;u)texrmo3oy1lpteaueo (  2urxr no4op nlnvtasfsrraxrp;t0tpx ifctys a2rmnvpnt)tetrmfctotom r uei;( t2to(rpio1ol nlfctls) rrmurp;o1tpt iociytls2emump (4 lxnxr3oy1lm  anvsls  2xm(o3no4ol nmnesls  rtaxrono4aptnmo3tld m rl(mo (0alxnmf ia1la elivs s)setmxmpoy1llt  fciatfsrrrxm ;u4tpxoiietatfs2ra(vo u)aeenifciytoaDr ivol(0teuoir3ou1omen nvtlt  2truro;o0aetoio3ilslsDemnvs;t0aexnmf todomteaivs;t  exoio iy4ap  mnvs s arrmxrpno4aetn feiatfs2em(vo;u0aleoxfctadlmDrluvsls0teurim ou4lpenlici sfaDtax  ;t4olen oetld m el(vp t) reoio3ia1faDrlu i;t)tetoxm nodlmeelnvtl( a2rmu pot4oetnmo3ilt m umu p;(4aleomr3tadfmD  ieo;(0 euo(opio4opeelfvtl(faDtmxront0texnif3iadla2ean s;u)trtoxf3iy1omtelivs;s teurirpoy4optnlicsl( arra(  nu1apt  f3tys m rmnmo t0tetrmf3iy1fa e uei;(  2tm(m3iudop nmncia()a2rm( pno1apenmicils a ulnvo;u)artrxr3ta1lp   i il( tetrxo ny4lp emnes ()aDrrxm ou4olxnmf3tytfs umnvp t4aexnxf3iadoat aueslt0t2uo(r3oodlpe mfcs s)srrr(  ;o1tle mociatla eanmo;u) reoxf3iodfp r uesls)tetoir oudlptn ict s sDrrumono4tpxnifcildlm2ul(mo u)artnio3iotlmtrli i;s  exoxm3oodlltemnvi t arraurooo4apeoifeiydls2eln s;t0 lxoir3iatlp eauvs ()t2uoxopoodop   nes sfaDta(rooo4opeo octytfa2umn s;t0 etomf3totfm r ueo;(  rtmxm3oo4omenmieias a2umum nt4tpxnmo3iasfs2ra(vp (4altrxf3oodlmDr i ils srumim no1ome liviat) 2ra(  ou4tpto ieiytls raums;()alenxf to1optr u slt) rxr(m ou4alee nviat)sDur(mp;o1tpto oeiyt a2uln s;() eenio3oytoat ln il() ruoxopny4lmtnlfvi s srtrx onu1ope mf3iysfa2um( s;u0 lxrir3tydla ean o (0s2xr(r nu4amtn nci s)arumxmp;t0alt ifctadfm2rmn p u0 eenir3tadfm   ues;(0teur(m3iy1omtnmicsa()a2taxm no1optn i3ildfa2emn o;u) lxrxrcto1lpDrliesl( setrir3oo1amenmict s s2urx pot4tpt iictasfsDrm( o t)trtrxrctotlptrlueo s0 2uo(r oudlmenlnetasfsrra(  nu4olenmf3iltls ul(vpnu4 exrmr iatfp   nvo;s  2uriopno1op elnvilsfarumxm no1tlx mieiat m2rmuvo ()texnmf3tatfp eauvo t seuoio3oy4ol n ncsa(fs2rau pot1aptn i3iydfm ul( p t0artrmr todfp  lu slt t2xmir oo4lp  mfciat sDtaum ot1oleniieiltlmDul(msn(0 renio oytomt lneo s seumxm ny1lmee nctatfsDurump;u1opeomociadls2em(vo (4arenxr tydlmDeanvs ()sexr(rpoo1lpt lfvt sfsrtaxmp;u0aleomietlslsDrl(vp u4 rxomf3ia1op r ies;s srxoim3nydamt  fcilt) Dtrxmp;u0tet iietytlm rm(vo (4aetrmociadlp   nei;s  2xr(r3iydopenmnvs t artru o;t4opxnmieiysfsDuau s u4 eeomociodoaDr ues;s0t2xmio iydome lietas s2taxmp;t4oet io3tyt s umn p u0teeomf3oadlmDeaies;t)truoiopnodlm nmfcsls)aDraxm no4tpeoii3iyd sDrmu s (0aexrxf oa1oaDranvs (0trxmxo oydoptn nci s  Dtr( pnu1tlxn f3iytfa ranvp ()tleoifcoadfmtean s;t0 rtoxm ny4aleelfei (fs2rruro;u0olxo i3iaslm rau sn(4trerio3tatoatrauvi t)sexoirpoy1omenlnesl(fsDtr(monu4oetoiocils m2em(mo u0tlxrxo3oo1fa rai o (0s2xmir3oo1alee ieiatfs2tmuroot1alenmfciasla2rmu p (0 rxrio io1lat  n slt s2toxm ou1optemfeiat aDra(roou0tpx ii3ilslm2emnvs;u0alxrxf iytlmDrauvi t0t2xmxo iy4llee ici (f rrr(moot0apxnii3ildlsDulnvp (4aexomo ta1fp e uei ()trxmim iu1lpte feils)sDtr(rono0tptnifcildlm2ra(vs;t) etoircto1faD  u ilt srumxopoy4op nmneta(farrr(mpoo0oltn f3iat sDrmn onu0 ltoir totoaD anvo;s t2umio nu1amt  ncsa(  rur(r nu0oltoioetltlmDul( p t0tleoifctadfm  ln o;s s2tr(o3iydopt mfvtat)a2urxr oo4tpe ioeiad aDul(msn()tlxnmr3iydlp e uesl() rxrio oo4alee nvilt)srtrx onu1alt mi3ias a2emump () exomo3iodfptrau o;t) 2urio iydlle  net ( s2tm(mo;t0tex ioeiad a ulums;u)artnmrciotom rlieo;t trur(mpno4lpt lncsl( a2tr(roou1tlt io3iys mDel( s t4tltoxr3totoa ean i (  2xr(r ou1oltnmnes t  Dtau p;o0tleoiocias m uanmsnt0 rxrmf tadlm rlu ol(0truoiopoydalenlivi t)sruaur nu4aex ifeiytfs2umuvs;() ltnir oadfpDe n o s0teur(mpiy4op e icta(  rua(r ;t1alxn ociydfm2umuvo;t4 rtriocoytfa rln o s0trum(r3io4om emncs ( s2rru oot4tptn i3tltfa2emuvsnu0aexomo iodlpD ln s () 2uoxrpny4apt lictls a2trx ono0olxoioeilsfa2rlump;(4arxrio3ta1lpD an o t t2ur(o3oo4lleelneslsfsDrau ont4tltoif3iydfs2ran p t0tetrio iatoaDeauvs;s0srxoxo3io4amt mnvsl(fa2rruro;u1olt ifciyt m2rlnvpnu0 ltrxf3iydoatrau ilt0t2trim nydapenlivs (  2urx  ;t1tpxo fciyslaDumuvo;()areoxo iy1laDrln s (0s2urim nu4alt mnvi (  Dtru pot0opxnmi3ilt s2ea(von(4 lenmrctodom eaieo (0s2xm(rpio4ll e nei t artrum ot0ale mieild s umuvs;t0texoxociotfp rliesl()texmxmpno4om elnvias) Dta(rono1tpxnio3ildfaDeln p;(4alxnmo tadoat auei;()setoxo ou1lmenlfvs ()sDrau  ot1opt mfciltlsDrlump (4 lxrxr3to1lpDrlnvsls0srxo(rpiu4am  lncsatfa2tau pnt0oet  i3tldfs ea(vsnt4alxoxrctytopDranei;t t2toxm3oydome miesa(fa2rmx pnt1openii3ilsfs eaumon(0trxrmf3iydlmteln o t trxmxo nu1oltnlfctat)sDtmxmp;o0teeo ieiasfaDrlums t)teenifciy1oaD  i s;s) rxoxm oydalte fvsls a2rrx ooo0opeomo3iltfmDum(vsn()alenifcoodomD aiei;t0s2xrim3iodolt  iesls)s2tm(mpot0openmi3ils m rm(vo;t4 renxr oy1oa  luvi;s0t2tr(r3oydalt  fesas arta(m nt4aeen ocild a2el(mp u)trtnmr3iotlm e ueo;t t2to(rpnodlpt lfvs t arumxrpot4aetnmfeiys m rmn s (4texnxf tatomDrlies;(0trtmxo3iy1omtemictat)aDrr(mpou4texoiieiasfm2ra( p;(0 exrir iodlmDe uvi;s t2urim3nudapt lnvs s) rtrxrono1tetnmfcilsfaDelumpn()altnir3todfptr ivs;()s2trxr oudlm e fcta()s2rm(rooo1tlxomfcild m uan s;t4alerif3iadfmt  ivil( teuoxo no4lmtelfet tfartrurp;o0aexomfeildlmDuan o;()arxrxrcoo1opt  ivils0 rum(m3nudam nlneilt a2rr(moou0tltomoetydfsDem( p;t4 exoif3iadfmt livolt t2tr(o3ny1ale  icilt  rur(  ;u4tee ioetlt a rlu o u0altoio3to1lmD auvs;(0t2xmim ny1ll n fvil( srrauroou0tet  fctltlm eln s;u4tetomf3todfat lu s (  2umxr oydomtn iei (  Dtrx  nt4optomf3tas aDuln s;t4 rermocoadfm e n slt)sexoxm oodam e fvtltfsDtm(  ot4aexomoctldla emnmsnu0texrmrctotfatraneo;t) rtmxo oo1llenlics t  ruau oou0tpxoif3iysfaDran p;u)teerxf ty1lm rau slt0srxo(m oodalte fcs t  Dtmx pno0aleo octasfm2ua(vs;u4trxnxr3ootlatelu o t  rxr(m3iudom   iei ()a2rm(r oo4oeeo i3tatfa rl( sn() lxnmo io1oatr uvi s tetrimpou4ameemfct s aDtrxmpnu1optoiiciytlaDrln on()aeeomf3todom e ueolt0s2uoio iy1apeemivs t)s2rruroou1aee ii3tadfaDumnmp u)trtrxo tytoaD  u o;( t2tr(rpiy1lp  licils)aruau pnu4tlen feildlm ranms;t4aexnxr oadfaDran i;(0 2um(m no4ole mncil(f rtr(rpnu1tpxniieiydls rauvo;t)tlxnxo3to1fate ueslt  rxmxr3oo1amenmncsasfs2urum nu1tlto o3iytls2rl( p u) renxf iadopDe n o t trumim3nu4lp nlnesa(fs2rm( pnu1alenifciasfsDrau pnu4arxoxo tadla  lnvo;t) rtmio3no4lleelivslsfsDra(m ;u0texn f3iad s2uauvo t0 lenmo3tadlp elu i;t) 2um(mpiu4amte neilsf Drmurpnu4olx io3iyt a rl( p ()aleomf tydom elies;t srtrxrpnu4lp nlivsas  Dtmx o;t4texn ociytlsDulums;u4tlxrif io1opDr uvs;t)srtoxm oo4aptnmfvtl()sDta(rp;u4oexnii3iltlmDumn ont4 rtoio3ia1lpD luvo s0t2tmxmpou4omt lnviat arrrur nt0opt  i3tad a2eau o;(4 etoxfciytop rlivs s0t2tr(m3oodaleelfesas srum(m nu0aeeo f3iadls2eln o t) rtnir iadfp eaies;(  2uoxm3oudamteliesat)aDua(mo;u4apenifeiatfs uan p (0areoir3oadopDe nvs;s)srurim ny1lmee icslt  Dur( onu0oexnmfetad m ra(mont0aexnmr3iodlaD auei s0texmxm iydll n fvtas)artrur oo4oet ioeiadla elnmpn(4 lxnxr3oy1faD  ieo ( teumxm3iu1lptelfvt tf 2tmu ono4ole  ociyslm2eauvp;u4tlxrxo3oytlatelu o;()tetr(o ny4altemiesls srtmur ;t1oleoifciadfm ul(vo (4 rxnxfciodoatrlnei;s)teumiopoo1lpenmncia()arra(r ;t1optomieiadla umnvp u)aexoxf oydfmDeaneols) rtrxm no4ame lfeiat  2tru ooo1oee ioetad aDrmuvs;u4 lenir3ia1lmteluvi;t0srtrimpnu1am elfesa()a2tmu  ou0tlx io3tydfaDranmp u4 exoxo3iy1la r uvolt0s2toxo iu4llee fct tf 2urump;t4tlto ieias m emuvsnu0 rxrif3oo1lmtranes ( srtmim3oo4aptnmfeslt  Dumx pot1oetomoeiyd s rl(vo u0arxnxocoo1oaDraivo s tetm(rpiy4op nmneil(fs2tr(rpoo0tpeoif3tys sDua( s t4 ltnxocoatfmtr ieo;()srurxm3nu1ll elfes s)sruaxro;t0tlenii3iatls emn p;u0artrif3tadomDe u ols0trxo(r3no4lpen fesat artr( pot4oltnmfciysla eln s (4teeomr oa1opteluvs t)truo(m3iydlm elfesa(fsDrmu pno0tlx iicilt sDraumpnu)aeerxo3ia1omtraivi;t) 2trir iu1omtnmneiasfsrraxmono0oeeniieiltfsDea(vsn(0tlerif oydfat  n i t0s2xm(o iudaltnlfes tfsrraxm ;u4oee  f3ilsfaDrlu p u)altnir tadfa  lues s0trtrxopoo4ol nmivias  rta(  oo0aee  oeiltfs uln p;t) lenxf3tatop rlieol()sexoxopiu4omenlnvi () 2taxm ot0altnmfeilt s2rlnmo t4 rtomocio1opteaues;s)t2xrim oo4amt mfct s s2tru  nu4alto o3tydfs ra( o;t0texrxocto1fatrauvols)setrim3iudomtn fvsls a2ua(mo;u0tpe  ociasfa2ulu s ()texnmf ia1lpD  ueo t0 2umimpiy1ol n nesls sDtr( oot1oet ifeiydfaDranvo;t0aeerxrcoatom r nvs;s) exoxo ou1ap   iei s  2rm( oou1teeo f3iydls um(vo;t0tetnirctadfpDr neslt0sexm(mpnudap nmnvs s)s2urxront4tetnmiciaslsDemuvpnt0 ltrirciatlmt ai slt0t2urxopno4amtnlfes s  Drm(r ;t0oet mfeiytla um(vo;t4artoif oy1optr u o s  2toiopiy1oleemfei s  Dur(  oo1ole  oeiadlm ranvsnu4trtoxf3totfa elies;t  ruo(m3nydamenlnci ( a2urxmoou4aeen fctls a ul( snu)trermo3oatfmt  nvi t0sexr(o nu1lpt  nei tfs2rrxm ;o4ape mo3ias m ranvo;t) lxrif3tatlaD  i o;s  rumxo3nydaptelfvsl() rrmxrono0tlxn fciltfa ul(mont4tlxoir tytlm e ues t0trtr(m3oodlpt  fcsls s2ta( p;o1tle iociltfsDuanmsn(0tlxomo oa1opt aieo t0t2xmxrpoodoptnlnvtl(  Dtm(  no0tetn oeiad m ul( o t4 lxoircto1om eaivol()srtoio iy1lpte ici ()s2ra(moou1opx ifcias m umums;t)alxoxrcoa1fpD lnvi;s0 eurxr3nudol elfvsas arumurp;o1oltn i3iydla2eanvs () ltrmr iotoateanvi;t0setoxr3iy4lmtn feta(faDrax pou0oexomfciadla2uluvs t0trxoirciadlm  auei;s)sexmimpio1opt  nesa( aDta(mont4alxnioeilt mDeanvs;t) etnir iy1fpDe n s (0tetoimpio1apee nvia()sDrrxrpnt4olx  ieiatfm uau s;u)teeoxrcoa1op eau sls  rxoxopoodlle  nesas  Dtmu p;u0oetnio3iadfm2rmnms t0artrifcootoaDr ies t) 2uoir iydapen nctatfaDtrumpou0apx  icild a2el(vs;t4trtrxo oydoaD ln sl()trum(r ny4am nlfcias)s2umxro;o0ale iietydfs2ua(mo u4alxnmo oadlpDraivo;s)trurirpiudolt  fesas srurxroou4alenmociys a2rlu snu4 rxnxo3tadlmte ivilt0teuoxr3ou4apt  fcs s a2ra( pnu1tetomfeiadlmDua(vont0 exrxf3ta1oa rlneo s)seuoxr3nu4op nlfeil(f rra(mpno1tptoio3iltls2ea(mo t0altrxo3oatfa r ueo t0truo(m nu4om  lnvilt)s2rmur ;o4olx mictldfaDrl(vp (4tltrxr tydlateluvil() 2tm(o nydam nlnctas)s2urumpno4aeeo oeiad a2emums;u4 rtnmr3iotomDraueolt0 2xoimpoy4olt  ivsatfsDuau oou4alxoioctat mDuan snu) lxoxo3tytfmtr u s () 2urir3iudomen nvsls srumu p;t0teenioetldfm ua(mo (4arenmo tytfa  aivs;s) rtm(mpiu4lp emnvi ( srtau  ou4aptnmo3ilsfmDrlnmon()tltrxf ootfa e i ol() etrir3oy1lmenlivslt)sruaur ;u4tlx mi3tatlm2umnvsn(4arxnmociatlpt lu i t  2urxm oy4ame mnet (faDrmump;u0aexnmf3iytlmDrm(vo;u4artrmo3totoptr n o ( teumim no4amtnlfes sfa2taxmpnt4aet mi3tysla ulu sn(0tlxrxfcoadlptrlnei s t2xmxm oydome mneiasfa2tr(m ot1aex  o3iydfs umnvo;t0treomf tydoa  livsls0 2xrio3nu4lme mivi sf 2ta( p;u0tlx mociydfaDem(vp;t)teeoiocoadomtr uvo;(0 eum(m oudope lieia()aDta(ro;t1teto octatls eauvp ()trxnif tytfm r n ils t2xrxr3iudom nlfctlt a2um(mp;t1tlt  fctadfsDulu o t) reoif3to1latelneolt)srur(opiu4ll  lnciat)aruax o;o0opxniictld s umnvp;t4 exrmo iydoa  lues;() 2xrxrpoy4oleelnvtl(f Draxrpnt4oleo ociyslmDeaumpnt4 rtrxo3todfa rauei;t0s2xoxm3oydom nlnesls aDtm(rpno4tlenio3tad a2ulump () ltoir io1omDeaies;s0 rxmxo no1lptnlfet tfartrx oot4ope iociltfa2uau s;u0tetoifctydfmDelnei;t0 etm(r3no4lpt  ivilt s2tmuro;t4ape ifctydlmDel( o u0 rerxo oodoaDe n i;( srtoxr3ny4omeemnvsas)aDtmu  ot4aeeoii3ild aDulu s;t)trtoxf3oa1faDe uvi s)sexm(opoydap n neia( s2rax  nu1ale moctltla2elnvsn() eermo3oa1oa elueo (  rtm(rpio4ol  mfci sfaDta(m ou4olx ioetydfaDrlums;t) rtniocta1lmDrlu s;t  euoim3oy1lpeelfesls)srrr(mp;u1apeoiieiytfm elnvs u4 ltnxr3iydla  au o;t0t2xmxmpoy1altnlnesa() rumump;u4apen o3tytfmDelu p;(4 etrir3oytlmDeau i t) eumimpnu4lm elfct ( arta(mpno0aeeoiiciadlm2uan p u0tlxoir3ta1laDrli s;t trxoiopnydomtemfctlsfs2rax pno4tlto oeiyd s eau o t4tetrmr todlp elnei s)s2um(r nydapte ivtat a2raur ou4aeeomoetatla emnmpnt0 etoif ia1omD livi s0trxr(o3iu1aleelnct t s2taxr nu0tetn ociyd s2ua(ms (4 rtoif3totfatr neo t srxoxopnydlle lict sf 2ta(r oo1oltoif3iyt m eanvs;u0 lenircta1omt  uvo;t seuoimpoy1om  lneiatf 2rr(rpno1opt if3tatfaDua(vp;u0 eeomrcoydom  anvs () 2xr(o3oy4ol e ncias)sDta(  nu1tltoioeilsfa2umnms t0 lxnxocia1laDeaneo () etmim ny1op nmfcs t  2trx pnt4oexn fctysla rlump;u0teeoif3oadlpt au s;t)trxo(m ou4lltnmietlt s2trum ou4olx moeiatfsDum( p (4trtrxf3iodlmt lues;s s2xoio3oodop   ictltfsrtm(rp;t1tle  ieiys aDul( pnu)trermrctatoatr n o s0trtrimpio1am elies tfs2tmxrpou4oeeo ociaslm2uan o;()aexrxo iadfmD luvol(0 rtrir3oo1lle lietlt arumx pot0apx miciadfaDum( p;u) lxrif3totlmDr n ilt)teum(rpiu4aleemies s)sDum( ont1aetoii3iys aDul( s t4texnirctydlaDe nvi s0texmio io4ole mfcsa(fsDumxr nt4tptnmieiytfs2rmu p;u) rtnmo ty1fmDrlneo;s)srtrir nu1omeelicilt)a2rr(  oo0oltomfctlsls2rauvp;(4 lxoxo3oo1lp  luvi;(0t2umxm ou4am emieil( srtrxmo;u1tetomi3tltlmDulums t0trtriocoydomt ln s t) 2uo(rpnudll elnei s) 2rrx  nt1tleoiiciaslmDumu s u)tleoir ia1oatr ieols tetm(mpoo4olte fcils srtrumo;t0apenmiciltla ul(vo (0 reomfcio1lmD anvils s2urir iy1om emiesls  Durumo;u1apenifctls a ua(vo;(0aexrmf ootfat li i;t0 rtrim nodlpe  netat  rumurooo4oleo iciltls2eau o;u0trtrxr3ty1fatrau i s0t2tmxmpiu4am nmncs t  Dururpnu1tlt  ieiltlsDumn pnu)tetoxrcoydomt ln i ( trurxr3iy1lm  mneiatfartrumooo1tpe miciyt a ranvp u) lxnio oytopD lieo;t seumxo no1lmen fvs sf rrau  ;o1texomo3tyslmDum( onu0 eenmf iotlaDeaivs t s2trio oodome liet tfs2umx  ou0olx miciat mDul( o;(4texrxo iodfpDeau slt)trxo(m iy4omtnlncsls aDtmxm nu1opxoiiciadfa2emu s (0 etnxo oodomDeaivs t0s2um(m3no1lmeemfei t s2uaxrono4opxn ictydfs2uln p () lxrirciy1lmtraivi s0s2xr(m oy1ale lfviat s2ta(rpnt1tpxoiieiadla2emn s t)trtrxocoatfaDr i o;() eumxmpio4optnlnviat)artr(mpnu4tpxoifctlsla elnvo u) reoxr3oydlmDrau slt tetm(o io1olen fciat)sDtm(mpnt4aleomfeiad a rluvs;()treoxr ta1fpte nvi;s)srxrxopio4ale lies (  2ta(mp;o1tee mo3tas a2rln p;t4texoifciydfp eanvo t)srtrxmpny1optemieta(f rumxmpoo4oex iieiad m2em( pn(0teermr tydoat aues () 2xr(m oo1op nmfvt sfa2ra(rp;o4oeeomf3iytfa2ranmo;t)trxoxocoatfp ean ilt  rtr(opou4lptnlnvtas)sDrm( pno1teeniociltfsDumuvp t0trenmr3oo1lm ran o;s0t2tmio iu1lmenmnctat  2raxrp;u0tleomociad s ranmsnu0teeoxrcootlaD  uei t) rtrim3oo1lltnlnes (fsrrmx  ;t4tpxomi3tyd m elu s;t4tleoxr iydfaDeauvo;( trtm(m3io1lp elnvsls)a2tm(ront0tlx mieiadlm ulnmp (0aeenxr tadfm eai i;t)texrxopnodale  icsatf Dtmxroou1altomi3tlslaDelnmp;() eeomo iatom  lu sl()srurir ou4oltelfctl()srur(mo;u4oetomietat aDemnvs () rxnxfctodlateau i;s)seuo(mpnu1amt mneia(fa2trx o;u1apxn ietadfs rl( on(0tlermf3to1om eauvs;()t2xoiopoodolt liciltf 2tmxrpoo0tpx  iciltlaDum(vont4 ltrmf ia1fpDrluvslt setm(m3oydol nmnctlt) Dra(mpou1aet mociyt m2el( s;(0teenmr oydop rau o ( teurxr3iy4llenmnciatf rraumo;o4tpxomiciatfa um(vo;t0aexriocia1lmDelivi;s0t2xmxm oydol emfetlsfarrrx oou0aet ioeiadfa2eaumon(0trtrir3todoptr ueo s srxm(o3nydapt lncias  rraump;o1aptnioeiysfm2emnmpnt0alxoio3ta1lptelu ilt0 2umxmpiodapeemfeil( a2uauro;u4tex ii3tytfa elu s;() rtnxr3ta1lmD  u olt0 eur(rpnu4am elivtatfa2tax pno0tlxoii3tyt a2umnms;(0artomfcoodfm  an ilt)srxmxr no1lme  nviat)aDraxmonu1opeomieiat s2um( o u) rxoxocoytla rai ils0srum(m3iu1omte fcilt srraur ou1tlx moctadfa rm(vs;()alenio tytfmDrli ils)setr(o3oydalt mncs s artrx p;u1altomo3tytlsDum(vpnt)trenxr3to1oat anvsl() 2xrxmpoy4oltnmnei t a2ta( onu4tleomoeiytlaDea(ms u4areoxo totlaDeaues t setmiopnydom nlfciat)aDtm( ooo4alxomfeiyd m rau p;u4 rtoif3ootoatrlivs;s) rurio iy1lmte fetl()arua(ro;u1aee  iciyd mDranvo (0areriocty1lm eanvil(  exmim3no1lm nlnvs s srta( onu1olxo ietydlm ea(vs t)arenmfctadoatr ivols  2urirpoy1lmte nvt (  rraxrono0aet iictyslm2rlnvo;(4 reomr3iotlaD aiei;s  rtr(m ny4oltnmfesa(f rrr( pnu0tpt mfctatfs uluvpnu0 lxrmrctytop  lneo s0s2toir3iu1lptnlncsa() 2rm(m ot4aexo f3tys aDranvs;()arxnxociatla e ueol(0 rxrir3oo1am nmietlt aDur(ronu0tee mfeiytls uauvsnu)altrif ia1laD aies s0trxr(r3nudoptnlnet sfa2trur ;o4oltn oeiatfa ua( pn() rtrxo oa1oaD lneo;s0trtmxm ou4ope  ici (f 2trxm ;t4aeen ociyd aDua( p (4aeenif3io1oaDeauei;t)t2tmir no1ape mfviltf 2rmxrpnu1olt mi3iyd s ranms;u)altomo3oadfate u i t0setoxo nu1lle lneiat sDtm( pnt1tpen iciad m2raumpnu4trxoxr iytoate neo;s0t2xm(r3iudlp e fvtas)sDum(r nu1tetoif3tlslaDelnmpn(0alerxr ta1lmt lies;( s2uo(r ny1omte nctl(  2rmur nu1tlxnifetytfa ul(vs t)trtnxo oadom r ivils)teurxo nu1ll emivs sfaruaumpnt4apen ieiytlm rlnvont4 eeoirciy1lm r nvo ()s2uo(o3nodolt micil(fa2uaxro;o0teen feiytlm rm( s;u0tltrif oo1oaDe nei t) rtrxopou1lpe lnetatf rtau pot0ape io3iltlm2ranms;t) lxomf3iytom raivols teur(r3no4amt  fciasfa2ur(m oo0tle io3iys a ulu pnt4arxnmo oo1lmDraivo;( srxoxmpiy4op nlfvtat sDtrx  nu1aexnmoeildls elumo;t4aetnircootlmD  i ilt  etrir ou4amen ivias) rraxrooo1oleniiciyslm ran onu0tlxnir3iotoa ranei;t0srur(r iu4amen nvil(  2tm(mo;u0oleo ocilt m rmn s;t0 rxnxf oadlpt lneo;t0 2toiopny4om elnvt s  Draxr oo0tee ii3tas s umu o;t) eerxo to1lmDrauvolt0t2to(r io4llt mfctlt) rurx o;t1optnifciadfm2ua(mpn(4aexrircoa1fpD lies s  exrirpiu1lmte ivi t artmu pno4oexn iciltlm2elumpnt0 eeoif3tytlaDr uvi ( s2xrir3ny1apte fctl(f rrau  ;t0oexn f3tyd s2rln p;u0tetnirciodlm eln s t0 etm(mpnu4ale micsatfsrtmxrpno4tetoiieild sDumump ()tlxrxo3iatlat lneslt  exrxm3no1al nlicsasfa2tr(r ;o1aeenio3ildfm ea( sn() exoxociatla r uei;t)tetmimpno4lmenmfvtat  2tax p;u0opeoifctadfs ulumo t)arxoir oo1fpDranvi;s  rxrio oydlmenlfvi sfarururpnu4alt  ociytfa uln sn() etomf to1fm  au olt0sruoim3iy4alt  icsltf 2urump;t0opt ifctls s emumo t4teermr todoptr uvils0trxmim3oy1lme  nesat)sDtrxrp;u4tet ii3iydfaDemu pn(4tetnif3ta1faDeau i;()s2uo(rpoo1optnmiciatf 2uaxmpou1tlenioeilsls2um(vo u4tetoxf ty1fmDrlnes;s  rtrim iodam  mfeiasf Dtr( p;u4tpx ifeilsla uanmo;(0tlxrxfcio1fatr uvi s0texoxo3iy1lmtnmfvia(f Duau  nt1oetomieiadls2el(vsn()texoir iytoat aies t0s2umio no4ole  fctat arua(root0tpx ii3tydfsDrmnmpnu4aexrxr tadlat anei s srxrir no1llt mietlsfa2ta(r nu4tlx mf3ias aDeln on(0alxoxo3tadomt ai o (0 2ur(rpiodaleelnctatf rtrurpno0tltoiictatlm rluvs t0altrirciydlmDrlneo;t teurxmpiudop emicias s2ua( onu4oeenmoctytlm um( o;t4 exrmr oodoptraues;t) eurxr3nydlmeelici s sDumxm oo1tleoio3tytfm uan o;u) etoxr3ta1lmteaivo;() rxo(o3nydolt mnvtat arrrx  ot1oltoif3iydfaDum(mpn(4arxrmf ia1omD au o;t)setoir3iudom  liei tfa2raxm ;o1tpxn ictaslm emumpn()trtnxf oodlp  lu il( srxmxrpiodape  icsa()srtrx ont4tpt  iciasfa2ulnvp;t)aetrxocoodlpt anvs (  rtm(o iodlm n ivtlsfaDuaumoot0altn f3iysla rl(vp;(0trerif3to1fmDrlnvols0 2uoxopoy4lmt miciasfsrrmu  nu1aetnmoeiltls uanmont0 eeomociatfmtelnvol()s2xo(o3no4ape  nciltf Drmx  nu1tpxo i3ilslaDel(mp;u4 etrmr3iytlmD anes ()s2um(m3iy1aptelictlt) rtmu poo4opxn oetasfs em(mp u)trxoir oydfpDeaues t0t2toim3oy1ol elfei t aDua(mp;o4apeo ociysfm2emnmp (0alxrxociy1la rluvi;t) 2uoxopoudomtelicsls) 2ur(mpno1tpt mictlt mDuau ont0 rtoxociatfa r neils)trxrio nudape mivs t) 2um(  ;t0oetnif3iasla2uln ont4arermo oodom   uvs;( srxoimpiudol  lieta( a2taumooo1oexnmoetytfs ranvo t0tlxrio3oa1lp e ivo;t sruo(o iy4oltnmfet ()aDum(m no0teenmfctlt s uau snu0 rxoxfcoytla eauvi t)t2xmiopno1lmen fviat  ruaurp;o4opx mi3iydfs2ean s;t) rxnmr iadopteln olt0 exoimpio1opt lfvias)s2rrur ot4tle ii3tld s em(mon(0 rxnir oodfp eanvolt tetmir3iudlm nlnvias) rtax  nu4oet  iciydls2umnms;(0trtnmrciydlateliei s  exo(opoydlltemfvt tfa2ra(mo;u1tpto ieiyslm emn s;u4texrmocoy1omt aieo;s)sexo(o nudapt lncs t sDrr( oou4tltn icild m eaums;(0 rtrmrctatfp eanvil(0 rtrirpny1omtnlfcsa() 2tm(moou0optoif3tldfa2rluvp;(4 exrmo ia1laDelu s;() rur(mpou4om n fes (f Drmu pnu0tptn oetls m eau o (4artnif io1omDelivi t  2xmxo iu4llenmicsltfs2tmumont1tlxoiictasfmDemn o t0tlxnir io1oat  ivo s0srurim3ou1op   fvtat srrmu p;t0aex  octltfs2ea(mpnu4tetoxr ootop r u i;( seum(rpiudamt mfcil()srumu o;t0alto f3tyt mDeanms;()altrifcoatla e nei;()trtmxopnu1amtnmfct t  2uax  no0ape mocild a2emnmp;u) renxf ootopDe ieo;( seuoxm nudlpenmnvslsf 2tm(rpnt1tpt iietasfs eauvs u4arxnmo3oy1oate nvs t)setmim3ny4ome  ncta( artmumo;t4texoifcild a2emnvs t4areoir3tytlmte ueo s)t2tmirpou4aptn ici t  Draurpnt4teeniocild s2ulump;u0aeenmfcoatlp elu slt0s2tm(opnydol  lnvi (fs2uax onu0alt  ietasls rmnms t4texomo3ta1opDr neol( trxm(m no4lle miet () 2rmxm no4apto o3iyt s2ra(mpnt4trxoxo oy1fm rln ils  eurim oo1olt mietasf Durxro;t0aetoif3iytfm2ranms (0 rxrmr ootoatelies t) 2tmxr3oydop nmfet ()s2um(rono0tle mo3iysls rln snt4 rxoif totlm rauvs;( trxrimpiudamtemnes (faDtmxmpnu1apt moctasfa2emnmo;(0 exnmo totoptr ues ( sexrio3ou4lme  ict sfsDtmxmonu1aexoiictld a umu o u4aexnmocto1oatrai o;t0 rxoirpoy1ap emnesa(faDum(m ou0oltomfeilsfs2umuvpnt) ltrir3ty1opt anvs;s)sexo(r oo1al n nvs t) Draxro;o4aetnif3tadlsDemuvo u4 rxnmociodoaD  nei;( t2to(o3iu1am nmiciatfaDum(mo;o1aleoii3iatfsDean p;(4aetnmocoodomDrai sl(0s2xo(m3oudlm  mnesa()aDumum ot0aexnmicilsls eauvo (0trxrxrcty1optr i o;t t2trxr3ny1olee nes s sDtm(mpot1alxnmocias aDuluvpn()alerxr iodlm ran i;()teum(m iy4aleemnci (  ruaxmpot1tpxoiocilsfs2rm(ms;(4trxoif to1opteau ol()sexm(m3oy4omtemieils artrum nu4aexomicildfaDea(ms t0 leoircoa1faD aieol()setm(opiudaltnlicsasfaruau o;o1tlx if3ilsla uaump t0 lermrctotlmtraieo;t) rur(rpiudopt  fcslsfsrurum ;o1apeoii3tat m eln s t)trtoxrciytopt lueils0s2trir no1al  mnci sfsrrrurono4oeen f3ilslm uan pnt4alxrxr iydlaD  ieo;s tetm(opou1al   nvtlt)srrr(m nu4tex  oetyslaDrmuvp u4aetnxr oodomD  n i;t0 etr(m no4oltnlneias a2tru  ;u0tltoiictyslmDumuvp;t0 lxnxo oydfate n i;s)teuoxm3io4aptemnctltf rtaxmp;t4oleoiociyslsDrmn pnt4arxnxf tadfmD  ivo;t) rxo(opny4lpt  nei () 2uaxront4apto ieiydls2rau o t0arerifcoo1la  anei;t0texo(o3nodlp   fesatfs2rmxm ;u0aee  ietydls2eau o;t0trxomf ta1lmtrlu o;s0setmxopno1olt lfetl(fsrua(rp;t0apx  fetldfs2ulums;t4tlerif ia1fmD  ies;s0srxmim iudalee fvtls)srra(  no1alenmoetys a ean p;t0trtrxo3oa1laDeluvo;s0t2ur(rpoudoptn icil( s2ur(mo;t0aleoifciasfmDelumpnu4arerxfctytoptr uei t texoio ou1openlnci t)a2rrxmo;o1apenmictaslm2emu pnt4tetoxf ootlmD  ivs;()srtoir iy1omtnlfvi tf rumxrp;u1texo i3iaslm rmuvpn(0 lxnmfcoatfa ranvi t tetmiopoo4lptnlivsa(fsDur(m no0aptnio3iadla2uanmpn()altrio iy1fa eaivi;t0 2xoxm3ny1ame  netlsfs2ra(r oo0tpxoioeiltla ra(mpn(4artnmr oatfm e u i ( srxoim3oy1alt  feias)sDua(ro;t0apxnmocildfs um( p;t0aeenif ia1lpt auvsls)t2trio3io1ap elivtas)artr(m ot4aexomf3tytla elnmsn()trxrio io1lmtrlues s0texmxr oydaltnlncsls  2umu  ou4aleoio3ils s2ua( on() leniociy1fp e ies;s0 2trio oo1amtelicilt srumumono1apt mfeilslmDrmuvsn(0 renxrctotlm  anvs (0s2umxm3iy1altnlfesas) Dtmumo;u0opeomoctas mDuanmo;t0trxrxo oadopDrai s;(  2uoir oy4oltelnvtltfaDrau ono4open ociatlmDel( sn(4alxoif iy1lpDelu i s0 rumxo no1alenliei (fsDrrxmo;o0apxnmieiasfm2um(mpnu4aeeomr iatfpDe ivs t s2tm(rpoodapen ict ( arta(rp;u1opx  fciadla eau p;u)aeenmociotfm r i i () rtoxo3oy4apeelfetls) rtaxrpnu0tlxniiciyt aDrl(vp (0 rtrif io1latrlnvsls0srtrimpiy1altemncta(fsrtm( p;u4oexnmi3iatla2uluvs;t0trenmfcio1fa  auesl(0seurxmpiu4optelfeil(f rurum ot4texnmf3iysla2ranmo;t4aexomr3ty1fp eanesls s2xr(m3io4om nmiesa(  Dra(mooo1tpt micildlm2emnmp t0tlerio3ia1lpD  i olt)s2xr(opou1lpe mieilt)srua(r ;o4ale if3ildlm2ulu snt4 eermfcio1opDr n o s)seurxr ou4olt mfetas aDumxr nt4oetoioetyt a2eauvs;t)tlxomocoy1faD ai s;( s2uo(m3iu1ome  fvs tfaDurx  ou4tlt  i3iasfa ua( o;u) rxoxo tadlmD lnvslt)srxmxm iu1omtnlictl(farraumpou0tpt iieiltls2el(mp;t4alerxrcoo1fa elues;()s2uoxr ou1omenmiei (f 2raumont1oleomieiadfs2ra( s;u) eeoio iodom r ivs;s tetmxo3iu1ope mfesat) rta(ront0opx mi3ild m2eauvp t4 lxnmrctadfmDrli i;t0srxo(rpoo1lp emiet t srrrxmp;o0aptomi3ilslmDel(vp t4teenir ia1omtr i slt)s2xm(m oydlptn nvi ()a2uaxmpnu0aptnioeiyd aDrm(mpnu4 lxrmo3oytfaDrlivslt)setmiopou1apt  iesls) 2umuroou1ape  ocilt mDel(mo u) eeomf3oa1om   nes;s)seuo(rpoudamtemieia()aDua(ro;u1oee ifetydls rauvpn(4aeeoxr iytlmDelieolt0 rxo(r3nu4alenmivi s)aDrmx  ou4ole  f3tas a2ran sn()alxrir3oodoptrluvslt0t2uo(o oo4opt livt tfsruaurp;o4olx moctasla2rauvo (0 lxrmf ia1lmtelneo ()tetoxopiu1ap   nctas  Dta(  ;t0oetoiiciltfa em(mp u0 leoxo3iy1fate nvi;s0setmirpoy1lpe  iesltfsrtau  ou1tptoiiciltlm2um(ms u0trtnmo tydfaD lnvs s)texo(rpno1oleemict tfs2tm(r ot4altomi3iysfm2uln p;u4treriocoydopt lnvi s)seum(m iu1omt lnvils a2trxmpot1altn oeiytlm raumo;u0 eeomrcoy1opD au i;s seuriopnu4aptemict ()a2tmxm ou0tlx  fciltfa eluvpn(4trtoir to1fmtelivols  2xrim3nydlle mfcslt) rtaur ou1oeeo iciatfmDem(mon(0 rtnxocio1opD lnes;(0trumir oy1ale mnetat)sDtrxmpoo1aexn oeiytlaDrm(ms u)texnxf3tadomDrai i;t0t2xoxm ou1omt lfeil(fsrtmu  ;t4oeenmo3iydfmDraumsnt4trxrxfcoadop  li ols  2xoirpiodapenmfesat)srumum ;t4tpt iocilsla rlnvs (0tltrirctadoptrlnvslt teur(mpny1oleemiei s sDuau  no0oleoif3tldlm2rl(ms ()altoio3tadlptrlueo;s)s2toirpio4apt livsatfs2tm(mo;u4apenmoeilsfm ul(mo;t) exoio oy1lm rai ilt) 2uoxr oudlptnlneia(farraur ;o0oleomi3ildfa em( s u)arxrmf ootlmtr uei;(0 rtoxm io4om   nvsasfaDtmxro;t0olt moetys s emnmonu0tltoxrctotfpDeai o;s srtm(o3ny1lme mivil()a2tm( ono4teeo fcild a emn pn(0 etrxf3oa1op   u i;s0 2urir3ou4lltn iesls  2tmxmpot1olxn fetytlmDeluvpnu4 lenmf iydlm  aieo;()s2xmio3oo1lm   fcsls  2urxm nt1ale mociys a2rmnvp;(0areomr3oatfaD ln il() 2to(r3ny1opt  ncsas s2rm(rono4tpeoioeiytfs2eln ont0aeeoirctodlp rlies;s0teuoxm3nudomt lfvsat)srrr(rpnu1olxoiicildlsDemn snu4trxoxf3iydlp rlnei s)seur(rpnodam elfctlt  rtrur ou0tltoiiciltfsDumnms t0tlxnmfctodla eli sls setr(m3iydlp n fctas)artm(mp;o0tpx io3tldls rl(ms t)aetoxocoydomDrlues;t) 2um(o io4ope mfetls aDrmxrp;t0tee ioeiytfa2ulu o;u) renmo3oodom eau s ()t2tm(m nudapte nei t  rrm(mp;t1opxo feild a uaump;u) ltomf3todom raiesl() 2xoir3iy4lpenlicia(  rua(  ;o1apt moeiatlsDel(vonu0trenir3oadlpDelnei;()srtr(r ou4lme  ivta(  rrmx pnu4teeoiiciadfsDra(vs;t0altnxf oodfpt lnvolt0texoim3iydol   ici t artmum ;u1olto iciydfaDum(mon(4arxrxrcootlpDelu s ( setmirpnu1aptnlnvtlsfsDtr( p;o1olt  f3ild sDrlu pnu)aeeomr3oodopDr u sl()t2umirpoudamt lfctls) 2ta( ooo4ale iociadlaDra( o;(4alxrmo3iodlm eluvi s  2tr(o3nodol   fei s)a2rm(r nu1tlenii3tadlm2el(vs u0 renir iotlm  lnvsl(0srtm(mpoodll emnci () rum(mpou4opx mo3iysls2el(monu0 ltniocoo1omDeliei;() etm(o oudlp  lfesltfarumx  no0opxn i3ils mDeauvpn()tlxnmo3tadlpt  nes s)truoimpio1omee nvsl(fs2raur ou4tet mocilsfm rl( pnu4 etomr3oo1faDeliei (0 2uoiopno1olt lfeilt) 2tm(m ;t1tltoioctlsfs ra( pn()aetoxocia1oa rlneo s)texr(rpoudale lictasfartmur ot1aex  i3tydls elu p () rxomr3oydlp raneo t0 2urxo3iy4al nlnesls) 2ta(m ;u0aet  o3iatls2rm( o u4arxrmr ia1opDean s;(  rxmio oo1ll n nciatfs2uaumo;o1aexoifciytfmDeluvs t0areoxf3iotlate ivs s)t2xoxm3oy1opt  icsasf 2rmurpno0oet iietyt s2ea(ms u)artrmfcio1fa rlivsl(  2xo(m3nu1am nlieiat)aDrrumono0aee mfciysfa ra(vp;t)aexoxf3ootopte u ol( srxrxo3nydame mnvilt  2urx o;t1openif3iaslaDel(mpnt)aetoxo3oatfp r uvilt srxmxm iodapte nvtat)sDrmx  ;o0opxnii3iatfa um( s;(0alenifcoodlptrlivo s0 exr(m oodoptelici (f 2uau o;t0opeo feilsls2rl(mo t) lxrmrcoydfpDr u s ( s2trxr3iy4ll n fvi t s2taurp;t4aetomoeiaslmDrmn pnt4 rtoif3oy1opDelu i s) etmxopiydope  fvils)arra(rpot0oleomfctyd aDra( on() etoxr3iy1lmDelieo s)t2xr(o iydamtemivs ( s2trxm nt4oltn oetysla2rln s ()trenxfcoodlm rlnvo s trxrirpiy1ole mnctatf ruau  nt0altn oeiasfm2el(vo;u0 rtnxr3oa1lmtranvilt0s2trxr3oodal  lieta()s2ta(rpnt0aee iiciysfmDul(vo;(4trtrmf tytomDranvil(0 euoim3oo4ale lfesa()s2tm(r no0tex  oeiytfa uanmo;t4texnioctydfa r ivi t)sexoim iu4apte ieia()aDum(  no0olt io3tld a eluvs;t0arxrxo oadop  an sls) 2um(r3iodlp emfvs s)aDrr(m oo1tpenmfciltlm2raumsn(4 lxomf iydfp  au i ( t2umirpou4lm n fci s)srtmxmoot0aetnif3iysfm ua( pn()tltnxf oa1fp   n i s0tetrxopoo4lltnlivtlt) 2urxmonu0oltnmf3tas m el(msnu4alenmociotoptran i;() etrxopnudop nmnciat  Drm(ro;u0teeomfcild m rluvp;(4teeomfcoatfmt  neo s)s2urim iu1ale licilt s2trumpnu4oleo o3tatlsDeanmp u4 rtnio iadlp e ivsls0truoio ny4am e feslt aruaurp;u4opxnmi3iltlaDumnvs;u0aexnmfctodfp rlnvo;( texmiopiy1lm nmivt sfs2umumoot4alenmicildfa2em( pnu4aexnif3iadfpteauei;s0sexoirpiudap elnvi sfs2taxmp;t1aexo i3iydfm2rau onu0arenmo3tytlaDrln o;s0s2xmim3ou1lmenlfeia( a2rm( o;u1tee mieiytlm elums;t4aexrirciodlp  auvi (0setmxm3iy1amtelnetltfsDtr(moou0alto oeiysfa2rmuvs;t)alerxr ia1faDrli sls sexmxo3iy4ameemnvtls)srtr(m ot1tetniociydls rauvo t0alxoirctydlmte ueo;s0 exr(m3oy1lptnmfetls)artmxmpnt0tlenio3tydfsDuanmpnt0 rtoio iytopDelnes s)setr(o no4ole mfvs (  rurum ot4tpe iiciysfaDumu sn(4 rtoif3tadfmDranvs (0srur(m oudop e fetl(fa2raxront1altoifctat mDuanmp (4 exrmrcoo1lmteaies;s teuoio nudole lneil( aDumurpno4olx miciys s2elu o;(0 lxrio iadopDrlues;s0 euoxr oodope mnctl(fsrtmx p;u0tptomfetatfs2emnvp u0tlxomo3iodlpDe nvslt) 2xrim3iy4lmt lfvslt  Dumu p;u0aleoifctld m2uau p;t4teeoxf3oa1om raivo;t) etoxopoo4apt  neilt)sDtrxmp;o0aetnmfetydfaDrmu o u0 ltrxf tydopDeli i;s s2umxm3nu4lp n netl( s2uau oot0apx mociad s2umuvs;t)alxrir3ta1lpDrln o;()trurir3oodam nlici t)aDurum nu4aetoio3iad aDelu s u0 lerxo iadfmD aueilt)tetmir3oydam   ivilsfartru  nu1altn fctlsfa umums;u)arxrxr3tadlpDr ies;t0srumirpiu4lmtnlict sfaruru  ;o1tpenmo3tat s uauvp;t0 rerxr iadom  lnvils)s2umxm iu1ll  lies ()aDtrx o;o4aexoifciatfa el( sn(4 etriocoadfpt livo;s0 2umxr3ou1am nlictat a2ra(rpnt4tltomo3ildlmDelnvo (4areoifctytomDr neil( teto(o oudopenmneilsf rrmxrpno0olxo f3iadfs rmnmpnt0 rxrif3oo1laDe ueo;t texrir3oudlme  ieta( arum(rono4ale ii3iyd mDea( sn()arxrxr3iytla eanvils0 etmxr oudll  mieil()srua(m ;u4teen ieils s2rlnvo t0arermf3iotlateanei t s2uo(opoydome mfvt t a2ua(m ot4tlt mfcils m ua(ms;(0trerxr oadfmtrlivi;t srumir3oydap   ivtas artrur ot1tltomoetas m2ul( s u)tetnxr iy1lpDeaieols)trxr(rpoo1opee fes (  2tmu poo4teeo ieiydfs2ra(vont0 rxnmo ia1omD  i o t0teumim no1ap  mfeias  2ua(rp;u4apxnmo3iasfmDrauvs;t4 etoxr3ta1la  anvils0seuoxo iy1amt lnet ()aDtax pot4tpxn fetltls2rmn o;t4 rtomo3totfatrlivi;(0sexo(mpny1optemnctls artauro;t0oee  ieild a2umnvsnu0 eenmo iydla  aiei (0t2tm(r3ou1opt mnct s)a2ta(r ot4oltnioeild s2el(vo;(0alenmocio1fatrai ilt0t2urio oydaltnmncs ()aDtm(m nt1olx  i3iydlaDrl(vp;u0 rtrmf tydop  aneo s0trxm(mpnydal   ivi s  2tax o;o1altn feilsfa2rmn pnt) exnmo3iadoa  an i;()srtrxm3no1lpt mfvs ( srua( p;t1tlenmfeiytlm2rm( s;() lxomf3todop eaieil(0 rur(o ny1ll nmicsat)a2taumo;t0openifeiat s rmn on(0alxrmrcoy1faDraieolt0 2xmio3nu1op emnvsas)s2tmurpot1tpx ioeiyslm umu p (0areoifctytoaD  ivo;s) rxm(mpny4ol  mnvsas  2umuroot4alxo oeildls rmumsnt0texnmf3oodlaDraivils) rumio iu4amtelfvsl()arururpnt4optoifciyt mDul(mo;(0 rxrmrcoa1laD  nes;( texoxo3oy1llt  neiltfarurum ot0apxoiietldfaDrm( o t0texrir ta1oate nvo ( trtr(m io1olenmfvias  Drrxmooo0apt  i3iytfs rluvp (0 eermo3iydopte i i;t)s2xoxr3oy1ameemfvs sfaDta( p;t1alx mfetys m2eanmp;t0 renif3iotfm e uvi;(0teur(opno1omenlnvi ()s2umxm no0olxoifeiaslm2em(vsnu4 etoirciy1lpDeln o t)s2xmxo ny4ame  ivsltfarurxrpou4altn feiatlsDelnmo;t)teeomo oatoat  n ol( teumxmpou1lpe lnctls  Durx  ;t4open feiytls umnms;t) exnmrcoadlp   n i () 2xrxr iy4oltnlfciat) 2ua( p;t1tee mfctltfm2emuvp (4tleomfciydfpte u o;s)srumxm3nu4ome mfvilt)aDrru oou4tpxn oetlslmDrl(vs t)aexoif3ia1lateau o;t srxmiopoo1oltelnct tfsDtr(r ou0tle ifciyt aDranvonu)tltrxr oadfate ieo;( t2toirpoy1om nmies tf 2ta(mpnu1olenifeiatlm2elu onu) rtomo todla eln s;()texr(opnydlm   nesas s2ur(mp;o1alxoioeiytfmDuluvpn(0tlenxf3oatopDrli o;s seur(mpio4llenlfesas s2raxmpoo1tpt  ociysfmDeanmpnt)altrmo iytfateluei;t  rtrxmpnudalenmicias)arrrumpnu1optnmf3tltfaDeluvo u4 eenio io1fmDranvi;t) rxo(mpoodam nmnvsl( srta(r ou1tex mo3ilt mDelu s t) exrif3oodoaDeai o ()setmxmpoo4lpenlieias)a2rruront4olt mictadfaDuluvs (0tlxnxr3ta1fp e ies;t0 exmim oodlleemfvi (f rraump;u0texomociytfs2rlnms;u0aetomocia1lptrai i s texm(opoo1ll nmfei t)artaur nu4tpen f3iaslm ulnmp u)texnmocoytomDrlueo t0t2xoir3no4aptn ivt t)aDra(  nu0tpxnif3iytlm eluvp;u) etomfciodfpt an s;()teur(o3oudol n ietls s2um(m ;t0tpe if3iad aDemnvs;t0arerif3oydfp r uei;t setm(o oo1apte fvt t)s2rax  ;o0tpto iciysls umumo u4artriociy1laDeau o ( sexoirpiudlmt  iesl(  rtrxmp;o4tleo ieiltlmDel(mp;()arxoxr3io1oa rai i;t0srxriopoy1oltnmnvs sfsrum(m ou0apxoif3iltlsDem(vonu4aexrmrctatlp rlieo;t0s2uo(rpoo4optnmfvils aDurum nu1teeomi3iadlm2uan p (4tlxrxo3oatlpt  u o;s srum(rpiy1omenmnvt () Drau o;u0apxo fetys a rl( p t4 reoifctadlmDr n i;s) 2uo(opoydop  mfvilt  rtmurpno1tetoioctyt s em(mo;(4tlenmr iydfaD auvi t) rurxrpno4lpen ivil()aDuaxmpoo0opxnmfciyd m rm( pnu)aetnio oatfaDeauvilt0texm(opoy4lp  lncs t)s2trx o;u1oltn o3iys sDuluvont)treomo ootfmtran olt0trtm(opiu4ol nlneia(fsDuaxmpno1alxn fciad s2rlums;(4altrxrciotomDeli s t)tetmxo3nudlp nliesls)sDrau ont4aeen i3iytfm ulnvpnu)alxnmrcio1lpD  ivil(  eurxo no1amtelictltf Dum(  ;u4olt mo3tlt a uanvo;t)arerif3oatfaDrlivils) rumio3io4op nmicilt) rtmumo;o0oeeomo3iadfm2elu s;() leoif3ia1op r ivols0srtmio3iodaltnmfcilt aDumuronu0tlenii3ilslaDem(vonu0tlxoxocoa1lat lnes;( srxmio iu1ol  miesas  rtaxmpot0olxnii3iaslmDrl( p;t4artomf totlp r uei s0srxmxo iudol nmfcia()aDuru p;o1aetnmietat a emn p t0 lxnio iydoa ean s;() rto(opiu4omtnmfeiat aDua(mpno4aptnii3iatfa umump u4trxnio3iadfp  aueol(  rxr(r3oudll   nviasfa2raxro;o4oeen ieiydlmDulums;t)tlenmr totfmtraivils)texrxo3iydaptemfvilt aDumx  ;o0alen oetasfaDel( o;(0 exrif tadlp  ai o;(  exoxrpio4op   ncilt  rum(m ot0tlxomfcias mDranvpnu4areoio3iy1fmDraiesl()seuoiopiy4ll n ieiasfsrtmx  ot4oex if3tad aDelump u0artomf ta1fpDelivil() euoir iu1omtnlneiasfsDrr(m ;t4tee mfeils s2rlumsnu)trenxo3iotlpDeanei;()teumxrpoudap  lfctlt  2raump;u4oex mictyd m2rau s;t)aexomoctadfa e ivi;(0teur(o3oo1amtemietl( a2tm( o;o0tlxniictysfs2uln pn(0aeeomf iytfmtean s;t) etrimpnodam eliviat)a2raxrooo1oexnmiciasfaDumums () exrio3iydoatr n i;t) exm(rpnudlmt lnesasf rum(m oo1aetnif3tysfa umn o;t) leoio oy1laD auvil() exoimpou1lmeemictltf rtmumpnu1tlxnioeiat mDrluvo;t0 etrmf3ta1faD lnei t0s2to(o ny4lptn ivsa(faDta(  ;o0tltniictls sDemu o;t0artrif oytomD aivi;t0teto(m nudamt  fvsls  2rr(moou0alx ifciydlaDrm(mpnt4 renxociy1fpte ivslt  rtmiopno1lm   fcias aDrr( pno1aexn fciasla rl( o (0 exnxo3io1fa eli sls0 2xr(rpnudaltnmfvtas) Drau ooo1oex mieiytla uau snt4teenmf tatfateanvo t  2ur(r3iy1lmee fcsa()a2rm( ono1tltomf3tlsfm eluvp u4 eeoir3oo1oaDelnvo s  exmim3io1lmte neils  Drrur nt0oetnmfctldlm emump t0aeeomrcty1fmte i i;s0s2urimpoy1al  lfvs t)s2rmx  ;u0ape io3iad a el( o t)altrif oa1om e ivsls0t2tr(r iodllen iet s sDum(m ;o1opt  oeilslm um(von(4trxoxocty1fat anvilt0t2urio3io1omt  fvta()a2umurono0olxo fetldfs ul( p;u)texoxocootlpDraieslt0 eumirpiy4op nmiesasfsrtru oot4oet mf3tadfmDrmuvsn(0arermocta1op   ueo s0 2xmimpno4lp  mfeiat)sDtaxrono4tlxnmi3ilsfm rauvonu)alxoircta1fp eaivol(  2xm(o3iy4omtemneilt)s2ur(rpnt0aeenmietltla ea(vp;t4aexnir oytla eaieils0srxoxo3oydom   ietl()aDra(moou0alxoiociytfa2eauvo u0areomo3ia1omD  nvs;t  rtm(o3ou1lp e ncta()srrrx o;u4tlxn o3iltfa2ea(vp u0teerio3to1omtr ivi;s s2xm(rpnu4lltemfciasfaDuaxrpnu4teenmociad mDul(mon(4trtnxo tadopDr u s;t0 rtoim oo4alenlfvsls a2tau pou0tlxn feils s ul(mpn()tltrmf3oa1fp  aneo t  etm(r nodlle licsls srtr(mpou1optoioeiad aDran pn(0alxnxfcta1laDeliei (  rtrimpiydop nlnvt t srtr(r no1texn i3tldlaDuau o;(4aexrxrciytop  anes s0t2xo(mpiy4am elfcil()a2tmx pno1aet mf3iydfm2em( on(4 lxnio3oa1fp  an ilt0teuo(m3nodlp  lnesa( s2urx onu0aet if3ildla2em(vs;u0arxoif3oadop raiei;()srxo(o3oydlmeemiesatfaDtrxmonu0apeomociytlm el( p;t4altoxr oytlpDrli o;t)teuoxrpnodale  nvtlt)sDrrur nt4aeenmo3tadlmDrmuvp;() rtrxf iydomD  u ilt0 exmir3ny1optnmfvs tfsrrm( ono0olxo o3iltfsDemu pnt0treomo3tadomD  i s ( trtrxo3iu1om n nes t  2ta( p;o0aex  feiydfa2rmumo;(0 ltoif3oa1lp elieol( s2tmio ou1lmee iciltf 2taxmpoo4aptnmfeiyd a el(vs t0alermf3oydlatrluvs s  eumxm nydlmtelfeia( s2tax onu0alenifciat m2elnvp t4 lerioctodfate ivsls0trtrimpoy1llenlfvsasf rtaxrpoo4opt iicils mDean p t4aexnmr3oydlmD aneols tetmim iy4omenmfvsas)sDrmu  nt0optnioetatfm ran ont0aexrxfctotfaDr nei;s  2xo(m iu1ll nlnvsa(f ruaxm oo0tpxn o3tydls elnmp;()arxnmf3tytlmt anvil(0sexr(rpoy1al elfcsls s2raxm ou0apxn o3tad m elumonu4 ltomr io1lmD livo;t0trxrim3nodame  nesat srtm(r ot1apxomfeiysfs2rauvon(0 exoxf3todop  lnvils0 2tr(r3oo4om n ies ()sDrr(m no1altn f3ilslm2rlumo (4 lxomrctotoptr i o () 2umim nudll  lnctlt) 2rrurono0tpt ifeiltfsDumuvs;(0tlxomociydlm  lu s;(0 2toxr iu4om emfci t) Dtr(m oo0altomietadfm2ra(vpnt) eerio oytfmt  ivo;t)tetm(o nu1olenmfciat  Drax pot1tetniietat m2umu p u0tltnio todlpt ln s s0t2xmxr iu4opte nesatf rtaxmo;o0oetoiicildfsDrl(vo;()alerxo iadfmDe ueolt0trtrxr iu1lp n fcs () ruaxrpno4oex iicildlsDemu o;u)trerio oy1opteln s ( sexrir io1ame mfei s s2rrum ou1tpto fetlt sDel( s t4 renmo tydlatr ivi;()srxoxr no4ame  ics (fsDuaumooo1oltnifeiysls eaumo;u0 etrirciodfpD lieo;t0 rtr(opnu1amt livi (f 2um(m ;t0tpto ieilsfmDra( pn(0 reomr3oadoa eln s;()srxo(m ny1am emncsl(f 2trx ono1oeeo o3iys m ulnmo (0arxrircoydfaDean i t  ruoio3oydaptnlnei t)aDtm(  ou4tlenio3ils mDrmuvont)aetnmocoy1fmD aieo t0 2xmirpno1lm nmivsl(farta( p;t4aee ifctas a rm( p;t4aetrxr oydlpt  n o;s) 2xo(o3ny1omt mnctasfartaxm oo4apxnifciad sDrm( onu4 exnmrctodlp rluei t) rumxopiudll nmivia()aDtrur ot1ole if3iydla ean sn()aetoxo3ty1omteaivi;t0texmio3ny4apt lnct (fsDumx o;o1oeenmfciatls2rlnvp (0 rxrmf iydoptraueo t texrir oydome mieslt) 2uaxmpot4opx  ictas m2uan o t4texrmf oytlatrluvs;t  exrxopoy1om elncias)a2raxm ;t4texoii3ild a2rm(vpnt4 eenif oy1op e iei;() rtoxm3io4oleemfvtas sDtaumooo1aetoiietltfa rmnmon(4 reoir3ta1lpDr ieslt sexmiopny1lptnmfeil()aDrr(mpnu1tex if3tyt aDelnvsn()trxrmfcto1oaDrlivslt)t2xmir iydop   ivtltfaDtmumo;u0tlx  feiyt s2umuvo;t)aleomf3oytfp rlivo t)seum(opiu1omenlfeslt)aDuru  oo1apeo iciyslm ran p;t4tltnxo iadlat lu ils)srxoxmpny1al  lnvsls) rraxr nt4aeen ietlt a umnvo () rerxo totoateluvs;s0 rtm(o ny4lme  ivtasfsDurxrp;o0oeeniiciys m rmump;(4texrxo3iytlp r ivils  rum(mpiudlp  mfcilt aDtrumono0olxomfctyslsDeaumpnu) exnxociodop eaneo;t0setr(rpiydam e ivslt) Dur(  oo4oexoifeiad a umumo t0texrmr iytfptranvol()t2umxrpoo4optelnct tfaDraxmpnt0texnmoeiatls el( s;(4trtnxocoydoateluvi s teumxr oo1lp e fcil( s2ra(mpoo4teeo o3ilt m2rmnvo;(0aleomo ta1omteaivols trxoxr3nudalt  nvs t a2umu oot1oetomfetadfm2rmnms;(4aeerxr oadlmDr nvil(  rurxrpoy1llte nvils)srtm( ooo0opeo f3ildlm uauvo (0aleriocoo1faD  uvo;t  rumxrpou1optelfctlt  rra(mpnt0olenmi3tasfs2elnmp u4 rtomf3tytoa   u s;s trtm(m oy1lp elfetlt  2tmurp;o1opxniietytfmDran pnt0 lxomfciatlmtelu olt0texrxopnu1ll  lnct ()a2trxm no4aex ifeiyt s2rln s;t0 renir3iadfm rai s s  2um(rpoodlmenlfciatfa2tm(r no1tpxnmfctad sDranvpnt) eerxf oo1fmDr nvilt0trtm(r no4alte nei s)a2ta(ro;u4oexn oetadfa2rl(vp;(4 rxomfctytfmD lnvs;t teuo(m iydomeelfvi sfsrra(ro;u4tptnmfctytlsDum(vp () ltrif3tytlaDelu s t)trxrxopiodllenlnesa(fsrururp;t0texnmociaslaDumump;u4alxnir tadlpte i o;() rxm(rpno4oleelfvias) rum(rp;o4tlxo oeiasfaDelnmpnt0aetoifciydlateli o;s setriopoudopenmivsls  2ra(  ;t0oeeomfciadlm eln pnt) eerir tydoat livs s  ruoimpoy4am elieiat)aDua(ront0oleo f3ildlaDem(vsnu0 rxnmfciodla eauvils)texmim oo1ol  lncslt  2urumonu0tltomi3tltla2elu s;t)alenmr ty1opD ln ilt)texm(o3ou4om  liesa(f Dtr(mpno1tlxo i3iytls ranvonu)trerifciodfa  ai s t teumir3oodlleelfvtlt  rumum nt1ape mf3tad a rmn p;(0tlxoxo oa1fateaueo t0 euoxm ny4altnmiei t)srumumpnu0oex  oeiytfm2elnvpn(4 lenif3iotlm ean o;( seuo(m3iudaltnmivt tf Dtmu p;u0aleo oeiltlm rmuvp t0aexnmocta1omtelnei (0t2xoio nu4lp  lfvilt aDuau pnu1tlt mictasfm2ulnmp u)altnxo ta1fmDean i t0s2toxm iudol e feils)sDta(m ;o4apxnmf3iatla ua( s (4 exoifcoodlpt  ivo s) 2trxopoo1ll e ncs s) 2rrxrpou4aexomoctltla2rl(vs t) lxnmfcootlatraneol( trtr(mpoo1op   icias)a2rm(mpoo0tleo f3iytfm elnmonu0alermoctodfpt  n sl(  ruo(m iy4ale lnvt (fsruau o;t1optnmociatfa2emu onu4 renxfctydoatrln i t teur(rpoy1ame lnei s a2rrum ;t0tlen oetat a2eanmp t4 ltnircty1oatelneolt teur(rpou1oltnmiei ( aDrmu  oo1tptomo3iadlsDem( s (0alxnmo tatom ean o s)setrxm3oudlmtemies s)artmxr ou1opx iieiat sDeanvp;t0texniocoatla  aies;() 2xoxm io4op nlivi t  Dtmxrpnt0tptnmi3iydla uau s u4alxoifctatfmDeaiei;(  euo(rpnodopeelfviasfaDurumpnu1aexo ietls m uaums;t4arenmo3ty1opDrlivo t0s2xmxopny1op nlnes t) Durx o;t1aeenioeiad s2uan snt) rerif3to1lpt  i s;(0srto(o oodapt  fct (f ruaxmoou4apen o3iytfs rmuvo;(4artoif ia1omDr u i;s)srum(r3iu1olte feilt srurx o;t4texn i3iyt mDem( o;()aleoif3iy1lp   ivils  eurxo3io4al nmfes t)sruaxrpnu4altn ictlt s2rln o;t0 rerxo iydomtrlnvs;s  rumxm iodlpenmict t sDraumpnt0aexo iciadlm2ranvs u4tlxnxr todfpDeluvs (  2xm(r3iu1ome mieils) rraxmo;t0teen ietadlmDean onu) ltrmo iytopDelivi ()t2urxo3iu4op n netl() rta(rp;u0tet  ieiyslm2eluvo;(4 etomo3iotlmD  ueilt)trxoim nydlmee ivtatf rua( p;o1aptnioeiydfmDemnvs;u0texnxf3tydfmDelivo (  rtmirpiu4ol   fes s s2ra(ro;o1olxoifciytfa2ra(vo;u0altnxf tatlmteaueil(0truoxr nodlme  neil(  Dum(m no0optoifetltfsDemuvp;(0artrxr ta1om  aiei t teurim3ny4omtnlncslt)aDumx p;t0altn i3iadfa ea( sn(0texriocia1lmt lneils  rto(o no4aptnlnvia( srraurpnu0oexnmi3iat a2rmnms;t0teenmf iytlm  lu i (  etoxm3oo4omee neta(fsDtmx pnt1tpxnmictydfa2rau pn(4teenmociytlpte n i (0t2xmxm no1lp emnvsa( a2ta( p;u4tetn fctadlsDranmsnt) etriociodlpD  nei t0t2uoir3oudlltnmnetas)sDtaur ou4oetoif3tatla2raums ()trerir iadfaD  ivsl()tetr(rpou4opeemivias  ruru poo0optniieild s elu snt0alxoifcty1omDrau s ( texrxr3oy1ol   feils) 2urx  ot4oltnii3iysfm2rm(mo;u) exoxf3iytoa elies ()s2trxm3no4al   nci (fsrurur ;t0oetoio3ildfs2ulnvpn()alxoio3oadlpD an o t) rtrxm3iy1ll e fvs sf 2ra(rpno0tex  i3tydlsDua( p;u4alxnmf3to1lp rauvi;t0t2tr(o3oy1lpt liesatfaruauro;u0tlxomoetys a ul( on(4aetnmr iodfmt lies ()setriopno4olt lnes t srrmxm ;u1tptnio3tat a2uan p u0trxomoctydlm  luvs () rtoimpiu4ape micsls srta(r ;o0aeeniieiatla2ulu pnt)tlxoif todlp e nvs;t)tetrxrpnudlme lnetls  rrrx ont1aleoioetyslsDrlu s;t0artnio todlatr i o;() rtmxrpnydomee ivs tf Drru  ot1tpt ioeiytlmDrlnvs;(0artnif io1fpt ai o () 2xm(r3io4olenmnvsa( aDtmx pnt1optoif3iytfs rm( o u0artomf3iatoatrlueo;s)t2xrir3no4am e ncta()aDrrx  ou0olxoifeild s eauvonu4altoifcio1optelu s;t srxmxm3oo4llt mfesas aDtru o;t4oee mociysls rln o t) ltoxf3totlatelnvolt0teur(opou4ape mieil() rtrur ;t4aleoiieiatls ulnms (4treoxo totlmt  n i ( setmxopny4lpeemfetat)aruaum ou4opxn o3iaslsDeanmsnt4 eerifcio1la  an i s  rxrxo3iu4op nmnvsl(f rrru  ;u4openmietyslm eauvo t) eeoif oatom raivs;t trtmxr3iy4ol elfesasfaDraum oo4tltoii3ias a2ea(vp t)alenmo3oydoa rliei t) etmxmpoodopt mics s) 2um(ront1altomictlslsDrm( o t)teeoxo oatfpDr nvsls)srxmim iudoptelfvi ( srumx p;o4tltoif3ias s ua( s;t0alenmr3ootfmDr u s (0 rtr(r ny1lltn fcsas s2rrum no0ope mietad s2umn o (0trtnxr tatomDrlivo;t) 2toio3nydoptnlicsls) Dra(  ot4opeomictyslsDran s;(4 lenxo3oo1fat aues;s)t2tmimpoo4ame lnviat)arumuro;t0apto iciltls2rmnvpnu4 rxrmo oydlatean s s)teurim3oy1alt  nesl(  2uax onu0oltn octatlm2rmn o;u0trtoir3ootomDeanvo (  2tr(mpnudamtn ict sfs2rr(rp;t1apx  feiltfmDelumo;t4teeoxf3ty1fp r nvsls0truriopnu4oltnlncsltfsrrmur nt4aet ifetatfm2emn s;u4 rtoxf tatfaDe ueo;(  eurxo3oo4ll nmfct s sDtrur nu0opx mf3tat mDrl( snt4aleoxfciytfmD  i i t  2trio no1altemncsatfarrmu ooo4tltnmi3tytlm um(mo u0alxrirciydom e nes;t)s2xrim io1lm n fci ( s2rru poo1tpxnmi3tadfmDrmums;u0 rermo3ia1oaDe iesl(  2umxm3iydlleemneil( sruaxr nu4tex mo3ilslaDum(ms u4texnxrcoadlpD lues s0texrim nydlptemivilt)sruau o;u1aexomieiadfs2em( sn() exrif3tytlmDrli i (0 etoxm iy4ol elfet s) rtmxrooo1aetn ietlslm2rl(vo;u)tlxrxfciodopD  nes ( s2xrxr ou4lm   nvias sDta(  ot1aptn ociadls elnvo;t4tltrxfciydfp rai ils  ruoxo nu4ope mncsl( aDururo;u1oltoiieiatfsDel( s;t0arerio to1oateaieils seum(r iydalee icsltfsDuaxr nu1optoifeiatlaDrm(vpn(4 exoir3ta1om   ivo;s trtm(m iy4alee fvs () Drmumoot4tex ifeilt
\ No newline at end of file
@@ -0,0 +1 @@
+ivo t)t2um(m nu4al eliei sfsrua( pno1ole mietltfs ranvs t)aexnxf iytlmDeaivol(0s2xr(opiydlp  lfci t)srrrx ooo1tpxoio3ildlaDelu s;t)aetoxr tydopDrlneslt0t2tr(o3nudale  iviasfsrtaurooo0aptn ieiat aDum( p ()tlerxfcto1omte ivs;( srtmxr oydopt lfvt s)a2tr(r no0tlx  icilsfs2ea(mo;(4aeenmfctatomtrlu s t truoxopny4lltnlnvsasf 2taum no4oeenioetadfs2ua( p;u0 rxoxr oytlpD aivsls  2urimpno4am   ieil(  Drm(rp;o0oltnioetyt aDumnvs u4aleomo todlpDe uvols) 2uo(o nudom emfvilt  2uaumonu0aet moctas a2rmuvpnu4 rxnxfctodoaDe uvols)s2um(mpoo4amtnlfvi tfaDrrxrp;u1aeeoiicildfa rlnvs t0alxrmo3tatoaDraivil( tetr(o oy4lltemivi ( s2trurp;t1oex  feiatlaDea(mp u0 eeoir iytopteli o;t0tetmimpiu4am   icsl(  Drax p;t1aetomi3tltlm um(ms (4 leomf3ootfmt ai olt t2xm(mpno4omee fei t arumx pnu0tetomf3iatfs eau pnt)arxnxr iatlmt lnvo;(  rurxopou4opeemivtasf 2taumoou4tpen oeiaslaDua(monu4aeermfcoy1lp   n i t)seumxmpoodamtnlietls  rua( ono1teeniociatla em(vp;(4trxrmr3to1fatraueils)t2tmxmpnudllenlfcsltfs2ur(rpou4tpenmicild aDulnvp u)aetnxo3totfaDrluvi s sexo(rpoodlmt liesatfa2ra(monu4apxomi3iaslm2emnvsnu0trerxf oatlp eanvi s trumxrpoodlmtnmnct t a2trxr nu0aexo ictyd a2eau o;()aexrmr3tytla rlieo;s) exrio iudam emiesat) 2tau oot0aleo i3ils mDeau p;u) lxomrciadfptraneo s texo(r3iydllte fvi t)a2tr(  ;o1ope  ictatfs ulums u4aexnmfciatlmDe n s t sexmxo oy4am emfct () 2rrxmp;u1apxnmf3ilt m ra( p;t0alxrxocoadlaDelueil(0seurxo ou1ap  lfvilsfa2umur ot4tpenifciasla ranvp t4 reomo3oydfp   n o;s s2xoxm3iy1ll  lfesl( a2tmurp;u0aptnmiciatla2emumo;u4trxoxr3ootfat liei s)t2toim3nudam elfvtat)s2urxm ot1oeenmoetlslm em(mp t4 rxnio iy1fm eaueilt0 eum(o3nydoptelivs tfsDrru  oo1tlt ifeiysla2rauvp;t0tlxoxoctadopDrli o (  eur(m nodapen fctls a2rm(mpot1oeeo fcilsfa2ul( p;(0trxnmo ty1lm eau s;( teto(r3oydlmte fvt sfs2urx oot4tpt mfciytlmDulumo (0artnxr3ootfateluesl()s2urxo3ny4om nlfvtas  ruaum nt1texniieiatfaDuln snu0trtomocoa1om rlieolt setm(rpnu4lm e neil(f 2um(rp;o4aleoifciytlm2umnms;u)tleoxr3tytomDrauvi s0srum(rpou1opt  netatfaDumx oot0tltnii3iysfa2rm(vonu) lxomfcoadfptelivs t) rxm(m nu1ll elieiat)srururo;u4olx ifctydfaDua( p;(4 etomf oo1opte ivo;t0setoxm3nu4ome  ivtatf ruau ono0oexoii3iat mDem(mo;(4arxomf3io1om e ies s) rxrxr iu1lmte nesat) rra(r oo0aee iociysfaDulnmonu)texoiocoatfp elieols0setmxo nu1amte nci t a2rmurpou0olx  i3ilsls2eaumo;(4 rtrmr iotfm eli o;( s2xmir3ou1lm nmnei t  ruaxm ot4opxnmfciydfsDuauvp t0teenmf3iytfpDelnvi;(0trtrxo no1altnlneslt sDta(rpnu4texnmiciysla umu p u4tleniocoo1lm eanvo;() rtm(opnydolenmiei s)srtru  oo1opxnioetasls2eanvs;(0teeoio iytlateanvi;s  ruo(o3oo4ll e nvsa(farrr(m ot4teenmo3iyslaDrm(mp t0alxomr3oy1fmDeli o (0srumxrpny4al n fcias  rrm(  ;t0aetnmfciat a2ulumsn(0trtoxo ta1lmtrauei;t sexm(o3nodlm nlfeta(faDum(r nt0aleo fctas s ul(vsn()aetomr3tatfpt lieils trur(m3nu1aptnlivsltfsDrmumoot0aeeoiieiad m rmumsnu)arxrir3ta1oate i s;s  2umim oydome  iciat)aDtau  oo0opxoioctld s2rauvo;(0aleoxr iotop rluvi t  2xrir3iu1lm   nvtat  rta( pno4ope moetad m eanmp;u)aeermf3to1lp  aueils t2um(opnu4op  lnvslsfsrtrxrpno4aptnmfeiad sDumnmont)tlxnxf3tadopDelnvo;(0 2xrxo ny4lltelfcs s) 2tm(m ;t0aee mictysfs2el( ont0trtoxr iy1oaDrauvslt s2uo(r oo4lm emfet (fa2tmxr ou1teto ieiydla emuvo t4 rxrif oa1laDelneols0 rtoxrpou4ol   ivsatf rrr(moot1tpx ifetyt s2rmu pnt4artrxf iotoat anvsls0sexmiopno4olt  nct sfsrtrxm oo0tpenmi3iyd a emump u)trenmoctytfaDrau i ( setoiopiy4ol e ics s) 2rax pou1aetoifciat a um(mo;(0 ltrxocoadlp rlivolt0t2xm(opoydamt livt ( arum( poo4opxn i3tldfm2emumo u) lxrxfciatopt li s t tetoxo3iy1alt mfcs s arrrxronu1alenmoeias s rlnvp (0trtoifciotomDrau slt)s2xrxr iu4ol n fvs (fs2raxrono0ope mf3tysla2emums t)trxnxocto1omtraivs s  exrxo iu4lleemictl()a2rax o;u4tlxnii3iysfmDuluvpnt0 eermrciytoaD  ues s0 2uoim io1omee netls  2raumo;u0apxo ieilsfm2emnmsn()tlxrxrctadlm rlu sl(0 eumim3iodlm e nvils)a2tmxmp;o1apxn o3iysfm2rluvo;t) leoxo3tadfmDe nes (0teurxo3ny4apee fetls a2trum oo4aptniiciydfs2uanvsnt)trenxo iytlptraneo;t trumir iudale  ivi (fs2trumpou4tlx mi3iyd m ul( s u)tltnir3to1laD aivils texm(m3ou1lmtelfesasfsDumu o;t1tetn oeiad a2ra(vo u) etrmr oadop raiei;s0 2trio3nu4apeelivslt s2rm( o;t1altomfeiltfs2umn o;t4artomf3oytfa r n i t teuoimpou1llenlfcsasfsrraxrp;u4aee  i3iydfs2eaumont)aexrmf3oo1oateli i;s0teuoxm3nydal  mfcsat) 2ururpnu0ape mieiadlmDea( o;t4 etrxrcoatfaDr ivi s) 2trxrpio1op nliesat  rraxmo;t1aleo oeias m2em(vpnu0 lenir tadlaDrlu i;(  rumiopiu1lmte ict sfaDumxmo;o4tptnio3iadfm rln o;(4 eeoxrcta1opD  ivols)srxoxmpiu4ap  mies s) Dtau pou4tleoioeiatlm2ul(ms ()tetrircoa1la r ivi;s0 eto(r3iydale lfeiat) 2rmxro;o1tpe mo3ildfm eaumonu0treoxoctatomD  ues t0s2toiopoudlp  lfvtas  rur(mpou0olxn ociadfs2uauvp (4aexrmociy1lmte u o t teuoio3iydal emnvs s)a2rrur nu0tltnmo3iyt sDuauvs u0 rxnio iadlp r n s;()s2xoxr3io1am e iei s)a2ua( o;u4apenifctltfs umuvo u4artnifcoodlpDelnes s)tetoim nydom e nvs ()sDrmu poo4tptomf3ilsfsDrluvs;t0areoxfcia1opD ai il()trur(r3iy4ope mivi s sDraurp;u1apxnioetytfa2em( o;()tltnmo3oa1fpD lnei s)s2xo(m oy4openlfviasfarumx pnt0alen o3iatls emn on() rxrifcoatlmtranei t srtrirpnu4ole mfct s)s2ta( poo0oleo fetasfs uaumo t4alxrmr3oy1omteli o;(0t2ur(opoo1lp elici tfsrrrxmpnt1oet miciys mDean on(4aetoio oadoateauvi;( setmxm ou4ap nmiet (  rrrurpoo0texniieiadlm uln p;t0aexnio ty1omtraues s0 2uo(opou1alt  nvilt)a2tm( o;u4tleniietad s el(mo;t)trxrmo3totfmDrai i ()teuoirpou4ole  nvsatf rtaum nu0apxn f3iyt m2uaump t4 reomo3ia1lp  li ils)teuriopiodlpeemfvtls  Draumooo0oee  i3iasls uaumsn()aeeoirctodfp r n ilt)t2uoiopiy1olenmnvtat  ruru oou0openmoeiasfs2umn p;u4tltoxrcio1fpDe ueols0s2xrxm iy1altnmiciat a2urx pot1tetnif3tadfa2rl(vsnu4tetoxo3tadfm e ies ()seur(mpny4lmeemncia()srumxr ot4alx  oeildfsDrmnvs (0areoif oo1fa r u o;()teum(r nudlpe lnctltfartm(  ot4oee  i3iat a ranvo u0 lenmr3iy1opDe uvo () rxoim3iydomtn nvsl( sDrauroou4oltn o3tat a2rlumonu0texoxr totlmtelueo s)trurxo3iy4am nlfvs s srrrxmpnu1oexo oeiasls elu p u0 eerxo oa1lmteaiei t)t2uoxmpiy1am e nesltfsrurxm ;o4alt  i3tatfs2eluvpn(4alerxrctydla  luvs t trxmxrpny4ll   neiat)s2tmxr ;u1apxoii3iysfs2ua(mo;() ltoir iydfmDrauvi (0 rurxo io4lp nmivsatf Duru oot4oetomoeild mDrmuvs t4trxoxrctotlm rlu o ()texm(o oodlme mfvias  rraxro;u0tpx mociyt a2um(vsnu4trenif3ootfpt anes t0s2xrir3nodole mfcsas  Dtmxmo;t1tptnii3ildlaDeau s (4trtrmfcoo1fa  livi s  2ur(r3nydol emfei (f Dtau  nt0tpe mieils m2ulnmo t0 reoiocta1fpD ai slt  rxoxo3io4oltelnetas sDuauroot4alt  f3ilsfaDum( o u) eerxo3to1optraiei;(0t2tmirpoudlle mictlsfsDrau p;o0tpxnmf3iytlsDean o;u0alermf oydfptrlu o;s)srtrim io1ap elfei t aDurxmo;o4aleniictyd m2eauvsnu4alenif3oo1om raivsls) ruoim ny4lpte neias aDta(ro;u1alto fciltfmDelnmo u)tlxrmocoadfm  aues;t  2tmxo iy1alee fctl(  rrmu pno4oetoiieildfs2emn pn() etomf3tytlm rlnvo s s2toim iu1lpen ictatfs2rm(mpou4oeen ietyd a2rmuvpn()altnmr3tytlatrliesls0 rurirpio4lltnmnesltfa2rr( p;u4aptomictatfa2ra(vs u4trenxr3oydfpDrlu o;(0 etmxmpnydaptnlfvta( srra(mpoo4ape iieilsfaDrm(mo;() exrio3totfpDeanvi;s0 exrxo iodlme lnet sfs2tm(rooo0tpe mfeiyd s2ranvsnt0aexrir3iotfp eluvsls  eumir3io4am  lfesa(fsrtaxm ot0tlx mfeiasls2el( s (0 ltomf io1fpt li s s0trtoim nudop   icsas sDrmu  ;u4opxniieiytlm2rmnvs (4artoxf ootop  liei t  rxmxrpoo1am  lfctls) Drr( p;t4aeeomi3ildlaDulums t)aeerio oytfaDeaivol(0 etmio nodlp   nviatfsrum( pnt4tpenio3iatfaDem( pnu4trtrxfciy1lpt  i s;( sexrxrpoodom e fci t) rta( pno1tpeoii3tltlm2ua(vp (4 rtrmfctotopDrlneo s0truoir iu1olte fetl(f Dururoot1tpe  ictlslm2ea(msnt4aleomo ia1lm rlu i;( trxr(m oo1lmenlivs tf Dumu p;t1oexniocias m2eln pnt0 exnmo3oodop   ieo () rxrir3io1ap n ictlt) Drrxmpoo1tlxniicilslmDeln p (0 lxoir3tytlaDelieo (  rtoim no4ll elnvsl(fsDrmur ot4oleomfeiyd m ulnmp (4 exrxo3iadlmt lnvi t) rxoir3nodop e fesa(faDrm(mooo4aeen fetltla2rl( s;u0tetnmr to1lpD  u il()trtrxr no1ap  mictas a2rm( pot4tle mieiad m2rm(mp (4aeenmf iatfaDeanei;()trtrirpou1lpe lies t sDtmu  nt0apenii3ilt sDuaumo u4 ltomf oa1fpteluei;t t2xmim no4openmici t  2rmu  nt4oex  f3ilsfaDelnms u) etrxo oytlpt  n i;s)setm(rpiodlle  nvi tf Dum(  ;u1openif3iltlm2ua(msnt)trtnmf ia1fa ran sls0srtoio no4lp  mfes () Dtaum ot1aleoiictydfa2ua(vp;() rtrmo iodlm  li sl()s2umim3oy4lle  fes ( a2tmu  ot1apenifetaslmDelnvsn(4tetrmf io1lm eaneo t) 2ur(opny4oleemnci ()sDtaxr no1tet  oeilsfs2ul( p;u4alxoifcto1omte u ils0trtmxmpiu1om nlncsasf 2rm(m ;t4tetn i3tlsfm2umnmp u0 rxnmr3oatlp  luvslt texo(rpoodaltnlivt ( a2umxmoot0tpt ifciyd s ean sn()tlxomf iodop  an s;s  rurir3ou4omt liciltf rua( onu1apeoiieiydfs2ranvs;u)aeermo3todlmDr n ils s2urim3nudame  netl(fsDumx pnt4apeoif3ilt a2uan p;t) ltnmr totlat lnes t0srxmxr iudlm n nctl(fsrrmx ooo1oee ifcildlm ea( s t) etrxr iytoa eln o;() exo(opoy4lm e nct tf 2rmu o;t1oee moeiyd s2ran s;t4alxoxr3todoaDeaies (0 euoir3io1lmt lietatfa2rr(m no1oltomf3ilslm2elnmo t)texnmo3iotop  aiei;s seuo(o3iu1lle  icils) Drm(  nu0tpeo f3tysfmDelnvp;u4trerxo iadom r i o;t setoxrpny4omtelncs () Dtr(moot0alxomfeilslm2emu on(0arxrmr iodfpD aivs;t)t2xoio3io4ape lfct (  2uaump;o0altomf3iat sDrmu pnt)alenircootomt  i o s texmiopno1lpte fcil(fa2tmxmpno0aee ii3iytfmDuan o t4trermo3oa1fa eauvs;(0 rxmimpoo1aptnlnvs tf Drrump;u4alx if3ilsls2um( p;t0arxrio3iadlp  lnvsls  eur(o iy1lm elict t)srur(  ;t1aptn ociaslm2uanvs;u0 ltnif3iodomD anvsl(0teur(rpiodomtnmnetl( aDur(  ;o0alt  ociatlsDulnmo;t0tlerxocoo1oa r n s t)srurim3iudopt  ietls  Dtrump;o1alxnmoeias aDrm(ms;u0 renxf iydfpDraivo;s sexmxrpnudope mivs () rur(m ;o1tpt iieiat a ulu o;(0trtrxfciadomt  u o () euoio oodlmtemiciat) 2tau poo0alxo feiysfaDrmump u4alenioctodlmt livi;s) rxriopno4lp  licsls s2taxr nt0alx  iciltla uauvs;t4aeenxo iy1fp eau ols)seur(mpio1olte icsltfs2umxmo;u1aptomfetltfm elnmo;u0teenir3tydfmDeaueolt  2tmxm oo4opt  ivilt  Dta(  oo0oexo i3iad s rl( p () rtoxr to1lm eaueol(0sruo(r3oo1amen nvsas srumxrpoo4oet mfctld aDran ont0 etnmocoodopD luvs t  rur(r3iy1ol n fet s) rrm(mpoo4oleo o3iysls eaumon(0tltrmr3oytom rlu s () etoirpoo1ll   fvilt aDtm(mp;o1olxo ictytls2ulu s t4aetoio iotoaDr i i;t)trxo(opny4omte nvta(  2tr( p;o0tpeniictydfa2umumo (4tlxnmrcia1fmDr uvs;t)texr(mpio4optemncta( artaum ;o4apxo iciytfs2ran pnt) rtnif3oatomD lieo t) rtrim iydoleemies ( srtr(moot0oeenmf3tldlmDemnvs;t)trxnmfcty1lat lnvi;s0t2trxr3no4omeelfcsltfa2uru pnu1tlt moeiydfaDeaums;t)aexnir oydomD aues;s0 2ur(opiodlm elfei (fsrrrxmp;u1tetniociadfm ua( pn(0arerxf3tatop rai o s t2xr(opoy1lpte nci (  rrruronu4opeo oetltfa2rmn o (0 exrxf3iotfmDean i;s teuoxo3iydom nlivslsfa2trx  oo1alenii3ils m2ra(mp (4 rtnmf3tydoa eai i t  euo(m3oo1aptnmicil(fs2taumpno1ope ioetatfsDuau p u0tlxoxo3oa1laDelnvo t trxoiopoo4llt  fet t s2ur(m ;o1tpeomoetltfa2rlnvsn()aeeriocoodomDran sl(  exrir oodom emieil()a2um(mp;u0tpenmieiys m2uluvs;t0aetrxr3ootfmDeln o;t tetrxr3oudape mfctl(  ruaxrono1tet iicildfmDemnmp;(4 leoxo3oatfpt aiesl(0t2uo(mpiu1ape  ictl(fartmumo;u4teeo f3tasfm2rmn ont)teeoirciatomteauvs;()seur(r no1aleelicsl() rrax oou1opto i3iytfsDra(mp t)altoioctydlaDrai sl( s2triopiydlpenlfei ( aDrr(roou0tlxo o3iat m2eluvp u4 lxomocoy1lpDeai o;t  exmim iu1lptemics s)srumu onu1aeeomfeiat m eanmsnt0 exrmr oytla  anvo ()trum(mpno4lptemnvsa(  rumxr ot0texnio3tls m2um(ms t0aexrxo3to1lmD aieol(0texmxmpiu1ap emnvslt)aDtmx  ;o1apt  fciys a2um(mo t0arxoif oa1latr u o;t0 ruoxo iudlmee fvs t)sDrrumpno0texn iciyslaDrmnmp;(0aeeoio3tatlm   u il()srtrir no4lm  mietlt  2rmxrp;u0tle ifciydfmDeauvs u0teeomfcta1fp  lnvo;s)s2uoxopny4am  lncsl(f rra(mont4opt if3iltlmDum( p ()teerir tytom e nvi;( setrxo no4ol nmivs ()sDtm(monu1aptomfeiysla2umu o;(0 eenmr3oodfm   ueo t0 ruoxmpny4llt mnvsls a2tm( pno4aexnif3iyd s rln s;u)arxrircoy1fp   iei;() 2urxopnu4lm  mncilsfa2um(mpno0tleomocias m2el(vo;u)teenmf oa1omDe n s s0t2tmxr3io4ap nlnctltf Dtmxrp;u1apxomo3ilt aDrmuvp (4tetrifcto1op eaivs;t)srtr(m io4am  mfvia() 2tr( o;o1tltnii3iys a ea( pn(0 leomr tatfpD auvo t) 2trio nu4opee ivt s)s2tm(mo;t0optn i3tasfs2umuvpnu0aeermf tatomteanes;(0seto(o nu1llt miet t)srraxm nu0olxnii3iasla ran o u4altnmf3ta1fa rauvsl( trum(m no1lp   fcsl(  2rmx o;o1apxo o3ilsfm ra(msn(4treomo iotoatr nei t  2umxo3iu1olenmfvt s)s2um(  nt1oetn i3iytlmDea(vs ()areomr iatlatrlivi t0s2urxopno1amenlfct s artmur ;o1oeeo oeiasls rlnms;u0 ltnmr3iydfateai s;() rumio3nudlme lneslt srurur ;o0alt ioeiysla2ulumo u)aexoxfcoadoa eluei;(  eumir3iu1ll elnvil( sDraurpnu1oetn o3tysfa2rau p (0 rxrxr ia1lp  auvi () 2xr(r ny1opte icils) 2trurp;u0tlxnmoeiysfm2ulnvo t4arxoifcia1laD lnes;s srurxr iu1ll e fctlsf Drau ooo1tex  o3ildfsDuan sn()arxrxr totoaDrai i s seto(m no4aptelnvsat) Drru oot1tpxoifciydfm2uln s t0 etnxr ootla rlivs s) rxoirpiy1am nlivi (fsDrmumo;o4alxnii3iatls ran s;t0 leoxo oa1lmDr i sls teto(m3iu1om nlfvsls s2tau  no0opt  fcilsfs ua( s u4 eerif3ia1oa eluei;t0srxriopno4ame  ncs t s2ur(  nu0apt mo3tysfmDuluvpnt)aeeomo iadfmDe ieslt)trum(r3iudlme mfcsat  2rmum no4tpe io3iys s2ra(vo;u0areoio ty1lp r ieo ()sexr(o ou1apeelivtasfarua(  ou0alxo ieiydlaDulnvo t0tltnxr oydfaDrlueo;s)srurir ou4am  mictlsfsDtau  no1olt iieiys a2rmn p (0 exrif oo1lmD  ieo;() rxo(m3iydame mfvsatfsDtrxronu0aptnmfeiytfs ulnmont4aetnmo3oy1latelueo;t  exoxmpiydoltelieiatfa2tmxmp;t1tlt  ietaslm2ean o t0tlenxf3tytlate nvo s0 2xoxo3iydlm  lnetas sDur(monu4tlt io3ild s rl(vo t)arxrif3oo1faD lnes;t  2umio oo4lm elncils)arrr(mp;u0alt mf3iadlaDemuvp;(4aleriocoy1opD  nvs ()tetoio nudll nmfvsatfs2rmu onu1teto iciyslaDrmn s t4aexnir io1omDeli i;t) rto(r3iu1ope  fcsl()sDtrxr nt0tleomi3iysfm ul(mo;u4 ltriocio1fmDr ieil( teuo(rpiy4ll nlfcilsfaDrmx  ou0apeniociysfaDumn snt)aexrxrciadomDe ieo t t2tm(o3oy1ome mneia()s2rrxm no0tlx ifetlslm emnmsnu4aeeoif3ia1omDe u olt)trxo(m3iy4ap nlnct tf rumurpno1optn octld a2rm(ms;(0teenxrciadom r n ils texmxr ny1op emnctls  Dtaumpnt4apen o3ild aDrmu onu)teeniocoadlatr ivo t  exoir3nu4lm n ict (fs2rr(  nu4ope  o3iydfsDulumon(4artnir3to1opte nvs t0 2um(m3iudamenmnvs ( sDrr( pnu0aeto o3ilt s2eanvo t0 exnxrciodfat  ieo s0 2xmio nu4amt  fei tfsrtaur ;t4olt  f3tas a2ua(vo;(4 leoifctytfmDelivols0sexoxopno4aleemfvtl()aDtmurp;u1tee  icilsla2ra(mo;t)trtnmo io1fa rau il(0sexrxm3nu4om e ivtas) rrm( poo4tle ioeiltfa rlnms;t) ltrifctatlpD an o t teuo(m nu1lp nlfeiltf rtm(mpot4tptn iciatlmDeau o u4 exrio tatlmDrlneo;s  exm(mpiu1amtnlnctat a2um(m ;t1tlto icils a2emuvsnu)texoio todlpDrlivols0 2umim nu1lm elnvi s a2tru pnt1alenif3iaslmDuanmpnt4 rerxf3tatomtr u sls0 2ur(r ny4amen ncsat)sDrrx ono0oex mfctas a2umnvs (0arxrxf oydoatraueil( t2trxo3iudlle  fcilt)s2rrum ou0alxnioetatlm ranmp;t4arxomo ta1fmD luvi t0t2xmxmpoo1om elicil(f rtr(mp;o0teenif3tyt mDumuvs t) exoxo3to1om rlnvs;t0t2xoim ny1lpenlfcs ()a2ua( p;t1aleo iciat s2emnvs;(4aexoxo3totopDraies;t)t2urim oudlm  micilsf 2ururpou0oet iictaslmDrm(ms;u0 rtnio oydfm r nvol(0t2tm(o3no4altnmfcsls)aDtm(rpot0tpt iictatlsDrmnvo;t0trtnir todfpD  ueo;t t2tr(opnydalen fetasfsrrm( pnu0optoii3iasls rm(ms;(4altrmo3todopDr neolt0sexm(opou4ll elnvilsfaDuax  nu4opxoiociltfs2eaums u)trtrxo3iatomD an il() eto(mpno4alt micsl()sDtr( o;t4aeeniietysfs elu o;t4texnxr ootlpDr n slt0sexo(rpnodlmtnmicta(farum( pno0oexnmieils a ea( sn(4 eenmocto1op ean sl()seuoxo3iu4am   fvt (f rrrumpot0tlxn fciyslsDrm(vsn() rxoxf oodfm e ueolt)setriopoudlmenlivil( srrru oou0oex  o3tlslmDelums;t)aexrir3ty1fp eai o (0 2umxmpiodal elfetlt srur(rpnu4opxnmiciltls uluvo u4 lxoio3iotoatrlueo t sexo(m oydlm   fct t  rrrur no1teeomoetltls ul( s;u0 lxrir tadfp raivslt trtm(r3no4am nmfes () 2umump;t4tleomieilsla2uanmp;u4arenxf oo1lpt luvsl(0 rumxm3nu1am eliet ()arur(mpou1altn o3iadfa2emnvsn() lxrxr3iodfpteaneil(  rto(r3oo1amtemfviltf Duaxr nt4tpeomociadfs uau s t)tltrio tatlat lueolt t2tmxo3iy4llenmncsa(farur(rpoo4alt  ocias sDrmu p;u)aleoir iytfp eau sls)trtmxrpou1ale lfct t  2tr(r ot4aex moctatls eaums;u)tlxniociydlaD  i slt0srumir iodal nlietls arurx o;u4aexoioeiydlaDua(mpnu0 rxrir3tadla raueolt  2xmir3oo4lltelnvslt)sDtrur oo0apeo ocilsfm rm(vp;(0 eeoircty1lm  ln i t0s2xoim iy4ame lfci (f Duaxronu4alxo f3ildfm2ea(vp;t0 leoirciatomtran ols trurir ny4aptemivtatfs2rm( pou0oeeo ociad a2ra( p;(0texomf3iy1oa rau s (0 rxrxr iydolt lieiasfsDrax  ot1aleniietatla2ua(mo;(0aeeoir iytlaD anvo;s)seum(r3nu1oltn ictlsfsDta(rpot1oet mieiyt m ua( p;t4alermf3iotlmDrai s t0trum(m3nodop nlicsa(fa2rax pou1oet iicilsla2rlu onu4trtnxo3ty1fpDran o (0s2xr(o3no4lm emneslt)sDumu  nt4alx ifciasfa2emn p;t)arxrmociodfpteli i t teuoim iy4lpt  fcia( sDra(ronu0aet mo3iatls emu p;u0texrmocta1la eauvs;( teumxrpoodamtemfeslt  rrm(rp;u1alt mfctls s2eaumo;t0 ltrmociy1lp ranes t  rur(m iydlm e ncsatf rrmx  ;u0aetomictasfa eauvsnu)trxnmrcoytfm r n
\ No newline at end of file
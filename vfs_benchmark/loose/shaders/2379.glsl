@@ -0,0 +1 @@
+ueo s  exmim iudapt  fvilt srur(monu4aexo i3ias a2umn p (4trtrxo ootop eaivsl(0seum(rpoy4am elfcils)srumx oou4tpeomicilslaDranvsnt4treoxf3iadomDrlnvi;t) rur(o no4lp nlictat)a2rm(mpot0aexn octyd a2eaumsnu0 lxrmr ty1fpDr ies;(0t2trxmpiodop  livt (fsDtmu pot1tlx ifciat m2ranms t0 etoio tytfateaieils) 2tr(o oydamtnmfcs s)sDtrum nu4ole ii3iadfm2ea( snt0 rtrmocia1lptraueil(0 exmxrpoydolen feiasf Drr( ono0alxo o3iatfs2rl(mp t0 exnxo3ta1opD livol(0truoxopnydlp  liesa( aDtm(moou1tlxniicildlaDumnvs u0 reoir ta1opt anei t0s2xr(m3ou1ape  fes s sDurur ;u1ole  ietltlm2emuvpn()altoif io1lmDrlieo;t0 2toxmpiu4amenlnvi sfa2rruronu1ale mfcild s2rl(vo;t4arxoio3tytla e i i s) etoxo3oydopeemfviatf rumumo;o4oet  f3iatfsDuauvon(4 lxoifctotopt  n sls)srum(r3nu4lptnmiesas  rtmxr oo4aeeoioeiltfm2uln pn(4texrmo oatla rli o;( teuoimpno1op  lfctasf Durxmpou1tle  i3iltfsDrmuvo t0tetomo ootlm  aneols)texmxm3iu4oleelnvsl(  2ta( pot1olxnmieiad m2ran p;(4trxrmf3iydla   ueilt  etrxrpiu1opee fctl( arraurpnu1opt ioetadfs2ulnms;t) eermfcoydfm  aies;t0trxo(rpoo1lpeelnctls s2rm(  nu1oeen f3ils mDel(vonu4aetrifcoydlmDelnvi s  rxrxo3no4op   icsl()aDrrumont1ape  fciadfa2ul(von(4 lxrxf to1lptrlneo;t) 2trxrpiu4lptelnes sfaruaumooo0teenmietlsfa rmnms u0 ltrifcoodfaDr uvils  rurxm3oydlp nliei ()s2truronu4ope mfctys sDrau o;t)teenmf oydfmtraneil(0teuoir3iu4llenmfeil( sDurur nu0tlenmfeilslaDrauvp ()arerxr3oatfp eaueols)s2trxopiydom n nesl() Draxmo;o0tee  ociys m em(vs;t0altomfcoy1laDrlnvi (0tetrio oydlp  lfciat  2taum nu1oex  fetldfm2rm( s t)arenmo iodfa  aiei;( s2uo(m oudamtn ivs t) 2ururpoo1tpe mo3iydfm ul( s;(0tlxrxf tydfmt aieils t2xrxm ny1ap nmfcil( artmurp;t4tetomi3ilsfs2eluvpnu4 rxoiocoydfp elnvolt0 2umxr3oy4lpe lieiltfsDuaxrpno0olx ifciydfa rmn pn()arxomo oo1laDran o;s0s2xoxmpny1aptnmfvils) 2umx pno0oleomoeiyd aDuanms (0 etnxrctytopteau i s0srxoxm oy1lp nmnct t)a2umu o;o4tptomfetatlaDuau onu0aexnif3oadlpt  uei;s s2uoimpnodom emfctltfsrtr(rpot0ole mfciytfs2rauvp;()tltnxr3iydopt lueil() 2uo(r3nu1lle lneta()srum(m nt1oex mfeiyd a2elnvo (0 reomf oydlm r ueo ()setrxo3nu4lp emfvils  Dtm(m ou1aeeoiicilsfa2ul(ms;t4teenio tadlp  ai s;s t2to(rpiudlptemnvta( arraumonu4altnmoetydlmDulums t4aeeomr tadopteli olt0truoxr3ny4lmtemivt s) rrrxro;t4apxnmf3iadls eanmpnt) ltoxr iatfm e ieolt0truo(o nudlmtnlies t)a2rr(r nu4oet  fciyt m em(mp;() renxo3ia1opDr ivo s)s2xrir3io4ame lnet t srtr(rpnt4tlt  o3iatfa rm( o (0tetnirciatlaDeln s t)trxo(mpno4al e nvil(  rtmxmpot1aee moeiat sDel( snu)aetoiociydlmD aueo;t t2uoxr iu4ope  ieilt srtmumpot0olxnmoeilt m2rmumo;(4teenmocto1fpt lu i s0t2uoxo iu4olt mnei s)s2rru  ot0opto iciasfsDrl( pnt0teermo oodla eaieol(0 etoio3ou4lpee icsas) 2tr(moot4opeoiieils s2rau p (0 rerxr3iadlaD lieo s t2to(rpou1lptemfcs sf rtmx o;o0tlxnmiciyt m ul( snu4 lxrmo iadfmDrlieo;(0t2urio nu1aleelfci t a2ur(m ;t1opeomictat a2eauvpnu4treoxf oytfa e uvs;(0texmxr3oudap e nes s sDraumonu0aeeoifciytfs2rlu onu0altoxo iy1lp rauvo s setrxmpnu4ape mfeslsf rraxrp;u4aptnmoctltlm2eau o (4trxoir oodlp eanei ( trto(mpoydaleemfctatf Duaxrpnt4olenmociltfs em(mp;u0treoio oatoa elu s s0s2xrim ny1am  lfeil( sDta(moou0aetomi3tad m2ea(msnt4 ltrxo iatfmDr i s;(  ruoir3nydale  ivt s aDtau o;t0olxnmf3tysfs ulnms;t0 rxrir3ta1fatrln ilt tetrir3iudlptn iesls)srtrumpou1opeo feiys a2ul(monu4alxnxo iotfp eli olt) etrxr3iu1ll n fcil( sDrrurpoo4opxomieildlm2ra(mon(4 etoifcootlmtrluvi s  rxr(rpny1ale  ici (  Drru  nu0apen ocild mDelump u0altoifctodoaD lues ( setrir iydaltn ivs s)sDtax poo1tetn ieiyd s um(mp (0aetrxr tydopDeauei;s)s2um(mpoo4om elncta( a2rrum ;t1oet miciatlaDranms (4artnifctatoaD  ivolt t2xrxm3ny4llenmfct ()aDrauro;t0tpxn ietadlaDua( p u0tltnmfctadomt  ueo;s srurio iodole  nvs t)arurxm oo1olt ifeiatfa2elu snu0aexomrcoydfa   i sls srtr(m nydap  mnviatf 2rmur ;t1tpeo octasfm eln p t4 ltrxrcoadlmteaneo;()t2uo(r ny1lptnmivs tfsrta( onu1olx mietat m ean p;() eeoirctatoaDeau sl()seurxopou1om nlicta(  2tmxr ;u0apx iieildfaDranmo u) lxoir3iytlpD aivil( sexrimpnodaleelici sfsruaurpoo0optoif3iaslm2em(vs;u0tleriociy1fp eaues;t s2ur(opnu1lpe  fvtl( sDua(  ;t1apenmo3iltfm2rau p;t4tlermo oa1lm eli o (0t2umirpou4op  mneslsfsDraxm ou0opxoiietydlm2elumo;t)aleomoctadopte nesls  exr(r3iu4ll elnesa( a2rm(mooo4opx  o3iydlm ulnmp (4aetrirctotlmDrln ils0sexmim3nodol emneilsfa2trump;u1tee  ociatfa2uluvs (4trxnmo3oydfp  liesl( sruriopnodap nlfcsls) 2um(mpot0texomfctlsls2rl(vo u4trxnmr3tatla rln i;s  rurxm3iodamtnlnvsat sDrrurono4alenio3ilt a ua(ms;u)alxoir iadlp rlu sls0 rtm(o nu1optnlncsls)srtm( poo4texnmfeiadfaDuan p;u0 rtrio3tatoa  anvilt)trto(r iu1apt mnvsl(f rrrxrp;o0aee ii3iaslmDranvo (4tlenmf ootfmteli o ()truoxr3nodopenlfcils)sDtax pot4tptnifeiys s2um(vs (0trtnmr3oytlp  li slt0seuoxm iy4lp e nctas  Duaurooo4tpt  feiys a2emuvp t)trxnirciatoaDr i s ()t2trxm3nu1alt lfeiltf rrru poo1olxnmfeiadlmDrm(mo;u)tetnir tytfmtr ivs;()srtm(mpoudap emics ()a2trx  oo4tlx mf3tldls2umn snt) eerif3ia1fptrau i;t texmxr3oudaptn ietat  2tr(mont0oex  ieiltls2ua(ms;t0 lenxocoydfp elu o t s2xoir3nu4ap nlivsasf Dtmum ot4alxomociyt s2eanvo u)trxrxr3iodlaDe nvo (  rurxrpiodlm e ncsat)a2raxmpot4tlen ociasfm ra(mpnt4texrxr3iotlaD li s;t) rtr(o3iydaltelncsatf rumum ;t4oltoio3tad m emu pnt) etrxfcoydoa   ies;s0 2xrxo3no1ol  mnct tfa2tauroot0tetomo3iytlmDrl(monu4 lenxo3oytfp elues;t t2xmim nydolee fesat)artm( pnu0apxo fetltla2eaumo u4arenmrcoatomDe nvils trumim3oydlm emfetatfa2um(  ot0oexnio3iydfm2rlu o u0tlermfctodomDr ivi;s srxoxr3iydlptemfvi s) ruaum no4olxnmf3tls sDul(mo t)texoxf3tatfp r ivs t srxoxm3oudal n nvils)aDumxm nu1aptnmfetld a um(mpnt0alxnir3oytlmDelueo;( s2trio3nodom e ics (faDtaxm nu1tex  oeiltfaDrau o t0 ltnxocoytlaDr ieo;s)teum(rpiu1ope livsls)sDraumpnu4opxnif3tld aDulums u4 etomocty1lm eau s s0t2umiopiydal n ictlt a2trurp;u1ale  f3tltfs eluvs;(4texnmrcoytoat anvsls seurim iy4ape lnvsa(  Drr(mpnu4tltoifetytla eanmo;t) eeoir tatoate neils0 euoim oodamtn fetl(f rrr( p;t0opeo fciat m rlu o;(4alxoirctodoat livols0t2ur(opnudomte ivsltf rrmxroou0oltomoeilslm ra(vsnt) rtomr oo1fatr ieil()srxr(mpiu1ol   feiat a2rrur ;t0apxoifcild m2ea( p t4aetnir oodom e ivo;s srtoir ny4olteliesat)s2ra(mooo1tlt  fcildlmDumnms ()tltnxf3oydomte u slt setm(mpoydope lfeilsf 2ta(rp;o4aee mietyd m ra(vo ()tetrxo3iotom   nvo;t0 eto(r3iy4op emieiat s2umur ;t0tee mietydlaDrmnvon() ltoxo3io1omtelues t) eurxo nodop  lfetlsfsrtaxmpoo1apto octasls rmu s u4tlxomo3oy1fmDean s;t)sexoio3ny4op  lnvs (fa2rm(mo;u1tpxn oetatfsDel(vo (4texoio3tytomtr ueo;s s2xrim3iydal emivsasfsDuax  nu0tltnmi3tld mDumn o (4altnmr3oo1omtrlivils srxoxrpiy4amtn fcil(  rta(m oo1oeeoiociaslm ea(vo (4alxoio iydlmDr ieol(  euoio3ou1apenmfctls)srrr( o;u0apeniieildla2ra(vp ()aetnmr to1om rau ils  2xm(m ou4am n fvs sfs2uau  ;u4tpxniieiysls emump;t4alxrxo3todom e i s s  euo(m iy1altn nesas) Dtm(rpnu0tltn feiatls2rm(mo;u0trxrxfciydopD aueol() 2xmxm iu1apt  nvsas) rtax  nu0texnmfciadfmDemu ont)aexnifciatlatr ivo;s0setrimpio1apt micslt)a2urxmont1opto ietlslmDua(vpnu) rermr tydfaDraivi;(0 eto(mpoy4optnmivil()aDurur ot0apx  fciasla2umn pn() reniocoadopte nvo ( teuoiopoy1ol nmiet t aDuaum nt1tpt iiciasla uanmo t4 lxrifctotfptraneslt0s2umxo3ny1optemietl(f Dtr(mp;t1opxn i3tlt a2uaump u4trerif tatlmDrluvi s0 eur(m oydopte fesls) Duaxrpnt4optomiciadfm2ulu s (4 eermrcoadopDr n ilt srxm(m3oodol emnet ( aDrrum nu4alxn fciadlm2emnvp;t0aleoiocoy1fpt anei (0seumxo no1ll nmfcs sfsDtm( oot0apenmoetydfm2em(vs;t)aeermfcia1fm  aieo;s)teuo(rpoudllte ncilt)srtmx  ;t0oexoioctysls el(vonu) lxnmo3iodlpDeluvo;t  2tmim nodoltnmivils)srra(rpot4opxn f3iadfs2eanms u4teeoio iy1la eli o;s  rtrxopny4am  lfvt s  2tmxmont4apx ifeiasfmDraump;t4tetnir ta1lp  anvil( truo(m3oo1opt liciat  2rm(mpno1tpx ifeiydfsDeauvo u4arerirctydfmDeanei s0 rtrxr ou1lle lnvta(f Dua(  ;u4tetomociysfaDel(ms (0alxrmrcoy1oatrau o t)srxo(mpoo1omtelicias)sDumumpot0oltn fetyt m rauvp;t4tlxomfciydfmt lnvi;t)t2toir no1lltnliviat)a2urxm nt4tee mietasla ulnmpnt4 etomr3ia1opD  ivil(  eumim iu4ameemicta(f Drm( p;o1teenif3tls a emnvpn(0alxnmrctytlaD  ues;t)trumxr nydape  fvia()s2rau o;t0apeomi3ildla2eanvp t0 eeoifciytla  an s t  exrio3oudam   fvs (  Duax poo4olen ictadls2ulnmsnu0trtrio3iatlp eanvs;()t2tm(o3no1lm nlicta() rra(root0opxnmo3iltlaDumn pnu0alenxfcto1omtelu s () rtoio no1ol emiesl(fs2rr(m oo1tptnmo3iasfa uau p;u)artrmr3ta1lmt  iei s  euo(r nydalt lncsas)sDtmxronu0apt mfciatfs2ra( o;u0 etriocootlp   ues;(  exo(o3io1omeemnvi s) rtr( p;t0oex mi3tasfa uanvonu0 lxnxf3tadoptelneo;(0 rxoim3iu1ll  lncia(  rraxmo;o0altoio3ils s uau s;(4artrioctytopD luvi;s)srxm(m nu1alt mnct tfaDtaur no1tpt ifeiytla2um( s;u)aexnxo3iy1fmtrln ol()srxoir ny1opee net sfs2um(m nu1opto oeilt a um( p;(4areoif oodfatrln o;s0teuoxo3ny4lltn fvtas)artmu o;o4opx mfcild sDuan p u)tltnxrcoadfpt anvo s) 2xoxopiu1lmee fvil()aDtmumpnt1tpx  ocilsfsDeau o;t4tlxnir oa1fp rlnes;t) eto(rpoodaltnmivsltf 2tmxrpno4ope  iciatfsDeanmo;t0 lerirciydlpD  ieo;t seuoxrpiydamt mfvi t s2tmumo;o0ope  iciysfm2uln o;t4texomrciytlp ean s;(0tetr(m nudlpenmivslt s2uaur no4oetn fctat sDulu on() eenxo iatfm e u o;(0srxoir3iu1olt  icta(farur(rp;t4optnmo3tatfmDemnvp;u0trenioctydomte i o;t trxmxopny1op emnct s s2raxrpoo1oeenmf3ias s2rlumo u)aeeoxocoo1lm   neo;s trtoirpoo4am  livia()s2tauroou1tpt mi3iltlmDelu pnt4trxnmrciydlpDr u ils trtmim3ny4ol nlicta()s2uaump;u0open oeiadla ran o u0 ltrxo3iy1op  lu ilt0 rumxo3iu4om  licilsf 2umxm ot4oex  oetys s2rau s;u)aetrifciy1omD an s (0 2xm(o iu1optnlnes t)s2tmu  ot4apt mf3iyd sDumnmo (4 etnmocoa1lpteli s;s) eumir3ou1lmtnmfes s) Drmxmo;t0opto ieiysls2umumo u0tetnifciodlat aueo;()trxmxrpnu1omee ictat s2rrxr ;u4tpt io3ilt s2rmumsnt4 eerir totlm eln i t)srur(r iudlm nlnci s)srumurpot0aeenmf3iatfsDrln pn(4 eeoir3oatfmt ln s;t0seur(r3io1lp  mieil()sDuau o;o4opxnif3iydla eanvo (0 reoifcoadlpDran s t0teurir3ny1lmenmnvs s)s2tauroou0alxn feiat mDuauvpnu) rtrifciotlmt  uvo s)trxm(mpoodamtnmfesas)aDtrurpnt1olen oeiytls ua(ms;t4alenmo3ia1oatrauvsl(0trtmxm oy4ame livs s sDurum ;u4tpxn o3tldls2eau pnt0 lermr io1lmte nvi;t0 etm(opnu1lmen fcia(faDururpou0teenif3tas s2elnvsnt0tlermo3ia1oatean ols trxoim3no4olt mivtls  2ururp;t4opxnmociytlsDea(mp;(0tleoxfctodlat  uvi;()t2urim iu4omt  net s)sruaxr no0tpeomfciydfaDrlnvsnt0 lxoxrciytopDr ueols)tetmxmpiodlm  lfvi s) 2rau  ;u1ale iietasfm2ran snt0 rerxf oatfat liesl()t2uoxmpiydlle  fes t)s2rr(mpno4alx ifeiys sDel( s;t4artoifciatoaD an s;t0 2trxr nu1olenlneils aDum( p;t1opt ioctasfaDuln s u4 ltomr to1fa  ai olt s2uoir3oo4apt  ivt t)arum(r nu4alxomfcils s rlnvont0teerio3iotoptrauvo;s0sexmxmpoo1lm  lnetlt  Drmu ooo0olx mi3tadfs2rl( pn()texnxocoo1omtr uvo s) rtoxrpiu1amee ictls) rurxm no1tee  fciasfa2rlnmon(0tltnmr tatoate i ols0srtoir nudlmte ivsatf 2ta(rpno1altomfetys sDuauvont0texoio todlpD aueo;t truo(r io4alee nctlsf 2uaxroot1openmi3iaslmDrmnmo;u0 rtnircoadop e uvs;t)s2uoimpoudllenlivt sf rumumono0aptnii3tyd s2el(vo t0 rxnmfcoydoaDr uei s t2tmxo ou4ll   iet s)sDrrxrono4optomfctasfaDul(vo;u4 etnio oodfm raieo (0trtmirpiydamenmfeiatf Drmu pnt1apxoifeiydfaDemn o t)tltnmr3oa1lat  nei (0seumio iu1op  lnvta()srrmxro;u0altomf3tys s2el(mp;()tetnifcoo1laD anvo;()t2xm(o nydllenlietlt aruau  ;o1tpe ifcilsfa uaump u4 rxnxo3io1fmtr ies;()sruo(rpnu4opeelnet t  rtmu pot0aleo o3iys aDumn s t0 rtrif iydoaD  neolt  rxmxm3iu4lpe livi s aDrmump;o0olxnif3iys mDemuvp;(0 lxnxrcoydfaDelu slt srum(mpnodom  mnviat aDrmumoot4apt moeildfaDul( s t) eenmfcta1la r u s;t sexmxm oodameemnei s srtmxmpno4aeeniociysfm rl(mp;t0 ltrio3iotlat au i t srxm(o3oydllt  ivt tfa2tmxmooo1oeenifetytfa rm(vs;u0arermocoytlpteanvo;t0s2to(opiodlpe mfes s)srrax p;t0aex moeiydfa2umnvont4teerir io1lmDrln i;(  rtrir nu1optelfciat  rrru  ou4tlxnifeiad s rlnvsnu)aexoif3oatfpteluvs;(  ruoimpny1am  mictat s2ur(  oo0olxomf3tydlaDuln snt0alxoxoctytlmDeluesls)s2trxrpny1ll nmici t  rtr(r ;u4oet if3iytlaDeanvonu)tlermf3tydlateln s ()s2trxo nu4opt lfvilt)s2taxm no4tetoiiciyd a2el(von(0 etnxociy1lp e u sls0 eurxo3nydomtelnci t)aDrmu p;t0tpeomieiydfa rmnvp u0tleomfciodlptean o (0 2xmxm oy1altn nvslt)arumx  ;o0apx  fcias s2emumon(4trtomr iydfmD luvo s0setmxrpio1ape lnvslt) ruax oot4ope ifcilsfm uanmo u4texomo oatlmte i s s  2um(m3iy4al e nvsa()sDtmxr ot1texomoctld m rmn o;(0texrxrcty1om elivsl( s2xo(o3ou1ll   nvtat aDrrx  no4tetomfeildla elu p;u) exnir ty1laDr u s s0trtoxr3oydame liei ()sDtrum ;t4tptnmiciytfa2em(monu4 rtnio3iydfa eanvil()s2xoxo3ny1amtelivil( sDrr(mpno4tee iicilt a2ulnmpn()aleomr tytomDe n i;s0 rto(mpiodll   ncia()s2ra(monu4tlt ioctat a ra( p;(0alxnxfciatomDeauesls  euoxm iy4lmtnlncilsfs2tr(rono4aee io3iytlm2rlu snt4arxrircoodopDran i t0s2tmxrpiy1apeelnvilt a2ur(r ;o4aeenmf3iytfa ra( snu)aetrmf todomt lnes (0trtm(o oy1ol nmicsatfa2rrxro;o0tpeoifeildfs el( o t4treomf totfaDran il(0tetm(r oo4lpee netl( sDtm(rpnt0ope ifciltlaDem(mpn() lerxrciytfptrluvil(0 2ur(o io4lltn fetls)aDurumont4ole mi3ilslm rl(mo t4 eermr3totfm e nvs s0 rur(r3nu1amtemfeils)srrau oot1oetomoetyd m ean ont)tlxoir3iotfptrlnvi;t trxmim nodapee fctlt s2uax pou0opt mocils m uanmp t)trtrir3tadoaDeanvs;s)sexriopoodlleeliesasf rra(  nt0tlto fcilslaDrmn o;t)teeriociatlatelueol( seuoio oodll emnvi ()a2ua( oou1opx ii3ild mDrl( p;t4treoif tydomD li i;s0sexrxo3iy4apen nctat  rrr(ro;t4aptnmfeils sDrmnvp;t4 rerif tytfaD aivils0setmim iu1opt  ncs (  rtrx ono1aexoioctysla eauvpnt4tltoio tytfp r nvs (0trtm(r3io1ap e icta(faDrmxm ;u0tpe ifcils s elu snt4areoir iytfmD  uvo t0 2toir ou4ll   ietasfartru ooo1tpeoif3tatla elnms;t0trtnxrcoatlmt  u s t0t2tm(o oy4aleemfvt () 2ta(mpnt4alen oeiydfm2uan snt4aeeoif3tydoaD lueo s0 rxr(opiu1al e fcia(faDrmxrpoo0apxnmietad m2ul(vs;u4arxnif ia1laDr ueo s s2tm(o oy4altnlneiatfa2tru ooo4apenmietys m2rlnvp;t)aleoio oy1omDeli i;t0sexm(opiudlle mics (f Drm(mpnu4alt miciad m ulnmp;t4 lerxrcoadlpt  uvo t0srtoirpoy1aleemnvtatfsrraxrp;o4altn o3iltfa ean o ()tlxrxo3totoat  uei ( trxoxr iu4omen ieta( s2uru pou0tltnmo3tys a elumont0tetoif3ootlpDelnei;()sruoim3iodap n iciat sDur( oot4tle iieiltlaDeanvs (0 eeomr iodfat luvo s) 2tr(rpny4al  mfcsat) 2rru pno0oltn ociyt s rau sn(4treoio iatfpDeauei;t texr(rpoodlpeemfcsat  Drrum ;t0texoif3tys m elnvpnt) eeomr oytfp eai sl(  rxrxrpoy1ol  mivs ()aDua(roou0tlto ieiytla2uau on(4teenif3totopD livi s) 2xrxm oudllt miei s)aDtaxrpnu0oltnmf3iadfsDrl(mo;t4 lenxocio1fmte i o;() rtoimpiodlmtnmfctl() rta(m no1alenifeiat s elnvp;t0altnio ty1fp   nvilt) 2tm(o iy1altn nvtatfsrtru ono4aee mi3tysfmDea( s u)arerxr ia1om rluvo;s) rxoio3nu1amtnmnei s) rumu ono1oex  fciasfs rlumo;t) exoxr3iytomDr u i;s setrxm nu1lpeelfcs (  rrm(root1aex ifetyt mDuluvp;(0tltoir oydoaDe ivo;s0texmiopny4lltn ieslt)s2tmxront0aptomieildls ulnvo t)artoir3tytlpt auvo s srtoxr3oy1lptelicsls arrr( o;t1apeomo3taslmDranvsn(4tltnxrciytfm  aivolt0trtmio3no1ole  icslt aDtrxmpnt1altomo3iytls ulnmsnu)aetnxo3todfatrln i;s)s2tr(r oo1lptemfetasf 2ra(root1alx ifeiyt a ra(vs;(4 ltnio3ty1lmtr i i;s0setrimpoo4ap emfvsas) Dur(mp;t0aptnifetaslaDum(mpnu0texnmo3tytfpD aneo t)truoxm3oydlp  mivi ()sDtruro;t4oeenifetydlmDem(vo;u4aexrxf iotoateln il(0 rumxmpou4ap  lfeiat)sDtru onu4olt ifciyt m2emu o;()teenxf3oydoat  i s t trum(m3io4omt  icsl() 2tmu  oo0tptoio3tltls2eanmp t0 exoxr todopDr ueo t)t2um(m3oy4apenmfvsasfsrtau ont1opxo f3iyd m2uauvonu0 ltrmr3iotom r u ol(0 rtoxo nydal  mneia(fa2tr( oou4apenioctyt s2ua( p;t)trermf ia1fpte uvi s setr(o nydope miet t  Duru oou4optoii3iltfs eluvont)aexnmo iodomDeai o;s trtr(r oy4op nlnvt s a2rmxmpnt4openmfctytlm2umn s;t4 rerir3tadfmtelneo;( sruoxo ou4olt  fesa() rur(m ot1oetomiciasfm2rluvo;u)texrio3iotoatrai o s) etoxo3nu4lme  neias aDtaurpoo0apt  oeiatfa ean snu) rerxr3oa1fm  lnei;(0 exoir nu1ope  feiatf Dtmum nu0altomiciytfsDeau s t0tltnxr3oytlmteaies s0sexmxm oy1al emnvi sf 2uax ooo1tpt mo3tysla2ranvo u4alxomr iydfaDrau s ()t2urxr3oy1olt lfcils)sDuaurpnt0ope ii3iltlm el(vp;u0tltrmf3oatfmt luvo (0s2toir3iy4apee fei tfaDuaxmpot4tlx  fctytla2raumsnt) rtoxocty1fp eli o s trxoir3oo4llen ivsasfaDta(ro;u0tpeo ieiys m ea(vsnu4 exrxo iydlp eaivi;t srumio3oy4ll emfvi s)aDtr(mp;t0tpxo fetldfa rm(vont)arenio3ta1fa   nvs ( setriopnu1amte ivsatf Dra(  no4alxnmf3iatfaDuau on() lenif iytoateauvolt0 2xmim3ou1omtelicsls) 2rrum ;u4alto f3tyd m ea(vont4tetnmo3oa1lp eliei s)setrxm iydllt lfcia( sruax p;t1opto ieiad sDrluvpnu4alerircoa1oa   ieo;s teurim ny4om  lncsat)sDumum ot1apt moctls m eauvs t0 exrmo3ootlmDe u olt teum(o3nodam   nci s arurx  ou0aex ii3iaslmDemu pnt)arxrif oo1la   uvilt)t2uoxo3oo1olt  fci () Dtax o;u1alxomietatlmDrl(vp (4artnxf3iatoaDr uvi;(0srumimpiu4lleelfvs s) rua(rpoo1texomocildfs2rau s (4trxrifcoo1opteaivo s trumxo3ny4omeelnet tfsrrmu  nu4aet  icild aDrm( o;(4tlxomrciadlm rln o t0 etrimpoydlpte fet tfa2uau o;o0alto icilt mDeluvs;(4arxnio iodfmteaueo;() rtrir3iy4ape  fcs s) 2rrur ;u0aet  oetydls2uluvs ()trtrifctotfmD au i;t0srurimpoydopt  neils sDumxrpno4alxnmociltls ua(ms;u4tlenif3ty1lp ran s ( srxoxr oy4lpee fei (farra( pno1oex  o3ild aDeaumsnu) rxomr to1fmD lueolt0setm(mpou1op  mfci ( sDtrxmpou0tltniieiytfm2ulu snt) rtomo oy1laDranvilt trurir oy4olee icslt)a2uaxm nu0ope  f3iys m2ra( p (4trtomoctodomteaneo s s2xmxm nudomteliei tfsDtax o;u0aeeoioeiadfs elnvo;(4trenmo3ia1lm elu slt)teumxr3oodlmtnlfvi s sDta( o;u0oetnio3tadfsDuau s (0arxomfcoodlatr ues;t0trtrxopny1lptelivsltf rtmx o;o1olx mietas s2umuvp t0arxrif todfatelnvi;t0s2trxr3no4omeelnct sfs2umx oot1ale  feias a2em(vp;t)arerxr3iytoaDrli sls t2xoim3iu4lm elietas  2ur(m no0aexn f3iydfs umnmon(4 exomo3to1oatr nvi () etrio iy1ape mivtltfs2rr(r no1oleomoctys mDrlums;(4aetrmr3iydopD auvils0t2tmio3nodlm  mnvsatfartm(  ot4alxn iciltfaDulnmsn(4tetnxr3iodlpt anvs;s0 2xmxo oy4altnlnesat)a2tr(r oo0tpxnioeiat a rauvp;t0 eerio oadoa   nes;(0 rtr(opoydom  lnci ()a2umxront0opxn iciltla eauvont) rerxo3tatlpD  iei t0trto(mpiu1amtnlneslsfsrraumono4optoif3iadlmDemn s u4tlxrmo todlm  aieo;t) rxr(rpoudll   ncs t  Dtmxronu0tptomf3iatlmDem(mon(0 rerxo iy1lateaivi s0t2tm(o3nu1lptelfcs ( srtmurono0alxoio3tydla em(vo t0 ltnxr to1fptrlnvi;t0setoim nu4llt livt ()arrmum oo1aptoiieiltfs emnvo;t0tlxomo3oodfptran i (0tetmir oydlleemieia( aruaxrono1texnifcildfaDel( o;t4 rerir3to1fpt  ivi;s setr(m oydolt lfvs s) rtmump;u1alxomoctatfm2um( s;()tltrxr oatfm  aivsl(  rxr(opnu4ame  ivs ()sDrmum ;u0tleo ietaslaDumnvs (0alxoxocoydop eaueilt)srtm(m3iu1omt lieia( srtm( ont4aet moeild mDuaump;() rerir oy1optrluvo t)trtr(mpnu1llt lnetl( a2rr(mpoo0teenmociadfs uau s;u4trerio oytfaDr ivi (0srxoxo oydaleelfesas s2uaump;u1oex mi3tydls eaumo;(0altrmo iytoa r i sl()setmxrpnydal emncilt aDtm(roou1tpt  iciatfs elu s ()tltnif tatfate nvo s0setm(mpny4lmt  ietlsfarumumpot4tlenmicildfa um( p;u0tetnxo3oodopt anvilt0s2xrimpou4alenmfvils arta(rp;o0optomf3tydfmDulu s t0teenioctadfatraiei;s0srurio iydamt  ivsas aDrmx ono4aetoioeiyd a ran p;u4 lenxocto1lpteaneo;(  rumxm ny4ap elfct s)s2uaumpnt1ole  o3tysla2em(vs;()aexoxr3oa1omDe ivslt trtrxo oudamt  ncsa(farurump;o1oee  octltlm rmumont)arxoifctodoaDelnvsl() eumxo io1aptn fcil( srtmurpot0tptnioetyslm2elumpn(0 eeoioctotfpD li sls) 2xo(opiydomtemnvtls) 2rr(  nu1tpe moetlsfm2eau pnu)texnir3ta1oateanei;() 2tmxm iu1altemieilsfsrumuroou0apx  oetydfa2rl( p;t4tlxnmrctatom r n ils)seuoxo oy1omen neta()sDraumpno1altnmf3tadfmDrm( p u)aetnmf tadfptr ues s s2xrxm ny1ame lietat  Durum oo1tleomiciadfs ra( ont0 ltrmo iy1fpteai o s s2toio3oudal n icslsfaDrmu pot4alt  octadlaDemu p t0texrmoctydoaD  ueols t2xmxopio1llt livs t  rraum nt1oeeo feiydls2rmu s;()altrmr iodfm elueol()texrxo ou4omtemieia( s2trxro;u1oex if3tad mDemu s (0arxnir3iytom elieo;t)sexm(rpoodlltelfei s) 2uaxmooo0altoio3ils a2eaumo;(4artoir3tydfaDeau ilt)setrir nu1amt miciasf 2rmxm ot4alxoii3tyd s eln on(0tetnircoytfpDe ivo t)tetoxopnudome  feilt)s2tmurp;t1altnmoeiyt mDuaumpnt0areoif3tydlmDe u ols0 euoimpou1omt lnei t s2rmxrpno1aetnifciadfa2el(vs;() lenmrcoydfm raueol( teumxr3nodame mies s)aDum(  no4tlx mo3tldls2ea( p u0texrmo3iy1fptelneolt0srxoxrpoo4apt  fvs tfsrurxrpoo0oex mi3tatlm um(vo;u4artrmrciatfmtran i () exmxr3no1lmenlnci s)artax  no1tpxomo3tysfa2rauvsn()tlxnmo iy1omDr nvs;t  rumim iu1lmte nes (  rtau ooo4tpxoioeiytfm2rmu onu)trxnmf3iydop  luei (  rtoirpno1ap n fvtlt  rtrxmp;u1alxoifcilsfaDra( s u0aeeomociytlmDeaneilt0srxmirpou1lp e fvil(f 2rrxrpou1oetomi3iadlsDul(mo;u)aeeomf3todfp r i ilt0 2urir iy4lm e fcsas  Duaxm oo1olxomicilt a ul(vp (0altrxo oodlaDe ues;() exoxo3nudom nmict s)aDtax  no0tlx mo3tltla2rl(ms;u0trxnircootfpt li o t)s2um(o3nydlle miesa()a2uaumoot1opx  fetls a rmuvs;t)arxrmo ootlp eluvil()srtrxopiy4alt mfvt s sDrm(root4oex  f3ild a2eln sn(0 etomo iytlpDeaieo ()trur(opoy1lle  ncs sfs2rrxmo;o4tle mociydfsDumn s;(4trtomf iatlmteanvi;s  rum(r3nudom elncils)arum(m ou4aetoifciatfmDeauvo ()a
\ No newline at end of file
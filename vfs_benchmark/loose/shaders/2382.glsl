@@ -0,0 +1 @@
+ivolt0sexrxo iydlmtnlivtas aDua(rp;u0apt ii3ild aDumn o;()trxnxr to1om e i o;t)t2tmim iu1op e icsa( srraxrpnt0tpt  o3iyslm rauvpn(4 eeoir tatomtraivi;(0 rumim3ou1op nmiviltf Drrum ;o4opx mfeiytfaDelnvs u)teerxf3iytlmtelnvo;t  2uo(o oo4ome lieiatfs2tr(m ou0apenmoetatls2em(vo;u0tlxrmfciytoaDe uvol()srumir3nudaltemiesatfs2umxrp;t1oeenmociys sDua(vo;u)aeenifcoa1fmDeaiei t0 2to(mpiu1amtnlncils) Dtrx ont0oexn octys mDemnmpnt4artriocoy1lpt  n s t) exrimpoudlleeliesl()artr( pnu1opeoiietatlm rauvpnt4 rtrxr3oodlmDelneols trtriopiy1ole lnctltfa2uaxmono1tpto f3tadfaDua(mp u0 lenxo to1lptranvs;s)t2xo(rpny1lptelietlt  Dra( poo0tptniocildlaDeaumo u4artoircta1fp  lueils t2xo(r nydap  mneil(  Drmurpnt1olxnio3tydls2ua( s t) exnifctydfpDraieo t) 2urim3nudoltnmnct ()a2rrumo;u4aexnmoeiyslmDrmnvp u)teenif tadoatranesls)trum(o3io4amenlnciatfa2uaxmpou0alen i3tyd mDuluvpn(0 eermo oadop  aieils  ruoiopno1lme lict t  Drmu o;u4oexoii3ild sDuau p u4 rxrmr3iotla r i s;t teumio3nydamenmfvi s  rraxrpot1olxoiietlt a2ea( o;t) lxnmfciy1optrlivo t0 2umxopoo1olt  feils)s2rrumo;u1oexn f3iad a2umu s t) lerio3oy1opt  ivs;(  exrxr iu4oltnlfci (fsDumu  ot1oleomi3ilslsDuanmo;(0tlxnif tydfm rauvo s sexo(rpiydap n icsa( sDua(ro;o0tltniictltla2uan s t4trtnio ia1lp ean s s)s2xrimpno4llenlfcils)s2tmxr no4tptn iciatlaDul(vont)artoxrciadomt aueo t)trtrxrpoo1lptn nvsls  rtrxmo;u1tptnmieiat s2uluvsnt4 exnxr3iydfa  auesl() exm(m3oodoptnlnctls)s2taumpoo0tex if3tldfaDrmu p t4altrxo tadfa   iei t)trtm(r no1opte nesa(fartaurp;o0aex iieiys s eln sn(0arxnir iatla e u i t0teum(opou1om nmfvt s)artax  ou4opto f3iyt a umuvp;u)trxoio oydla ranesls  etmir3io1ll nlies s)s2ra(rpnu1aleoiieiysfsDrmnvp (4 ltoif3oydoaD lueols) 2ur(r3oy4ol emfeia(farurxrp;o0apt mictltls emump;t)trtnmf tadoatr uvo;t0setriopoy4am  mfetl() rtm(mo;t4aexomi3iydla2rmn s u0 rerio iodoatr i s;() 2trimpno4olt  ieta( arurx poo1opx  ietltfa2umnvs;u0teenxo tydoaDe ivo t)truo(r nydapeemivtat)srraur ;t4teeomfeiad mDra(mpnt4 rxrmfcio1fmD lu o t0 exrxopnu4alenlfvia(faDrmump;u1tpxnmfetysfm el( o;t)tltnir3oydoatr nvsls0trxmxm3nu1al nmiei sfa2urx p;u1aetnmo3tatfm em( pnt)teeoir3ootfm elu i;t trxo(rpoodapeemncils aDtrurpoo0ape mi3iyd s2eaumon(0alxoir3tydlpt  ivslt) exmirpoydomeemfeil(f 2tru poo0teen o3iltlm2ranvo;t4texnmf3oadfptr u i;t tetoio3nodole mfvt s)arra( pnu1apeoii3tatls uln s;t)tetrmr totfpteauvs;t) etr(m3no4ol e fet (  2taxrpno1opt mietlslmDem( p (0alerifcta1omDeli ils0 rxrxo3iydlle mietl(f Drmx  nt1olxnmoeiydfmDuanvp;()tetoxo iytlmteanei t)srtr(r3no4llt mieiatfsrta(r ;u4tle ifctat aDrmn p;u0trxnxocoatfa elivs;(0s2um(r3iy1alenmictas)s2ua(monu4tetn i3tys mDran o;()treomfcoatoatrln o s  euoxrpiy1omtemfeia(f 2tmxr ou1aeto ieilsfsDea(vp;(4artrif3iadfm rlueil() 2xoxm3ny1lmtelivt t  2urxmoot4apt mo3ildfs2emu snt4 lxnirctotlmtr ueols0teuoxm iodll e ncilt)arrru p;o1tee mietyslaDrl(vpn(0tltomo oa1oa eln sl()trtrio nodlp n fci t) ruaur ;u1aeto oeildfs em( pnu0artrif ia1fp r u o t0trxoxr3oo1ap n fvil(f 2rmu pou0alxoifeiyd a2ul(vpnu4alxrxocoadfa eanvolt0 2umiopou4ame mnvtls  2umxroot4tetomo3tytls uluvp;t4alxomfciodfp e ueilt  rto(m no1al  mnvi s)a2rr(rp;u4opto ictasfsDelu o t)aeeoxo3ta1lptr ies;(0 eurxm no4lltelfet tfsDurx o;o0optoioeiasfa2eau p;t4teenif oytoatr uvils trxrxo3oydlpeelfvs t) 2umu  nu0tlxnioeiys s2uan p;t0trtomf tydfa e nvi;t0tetrxo nu1apenlivt () rtr(rp;u0opt mociysfmDumnmpn()aexnmf3ootlp eaueslt0 rxmxmpoy4omt lncils) rra(rpoo1tpt if3tldlm2ranms;u)trxrmr3oa1fp rlnvs t t2ur(r ny4lp  mivslt)srra(r ;o0optn i3iyd mDel( o;t0 ltrxf ia1optelnei s0srtrim nu4ape lnvsls a2truronu0tlxo octlsfs2rau p u)tlxomr3oytlp ean s (0srxr(o3nodll n fci s)arum( o;u1opxoif3ilsfm rmuvo t)aetnif iydlpDr nvsls)t2tmim iy4amtn nesl(f 2tr(r no1oet if3iys a2ul(mo t0artnmr tatla rlivsl(0t2trxm io4open fes t sDurxro;t0tpe  f3tasfm ea(vs t4 lxrxo ta1fp  auvi s0trxmxrpio4op   fet () 2tax o;o1tlen oeiysfaDrl( s;t0texoir iytopte uvils  rtr(opio1lpee nct s  Dtau onu1tpe ii3ildla2uan onu) renxrcoodlatrlnvslt)tetrim3nu1opt lfviatf Dur(rpnu4aetnii3iasfmDrmu pn()aexnxo ty1lm e n ol()trxrio3nydaltn fcs ( srra(root0altoio3iaslm2ranmp u0trxrmrcoytlptelu o t)s2urxrpoydom   nvsas  Dumumont0alxoioeiadla2umuvo;u)aetnmociy1lm elneils)trumxo3ny1apee ivsat
\ No newline at end of file
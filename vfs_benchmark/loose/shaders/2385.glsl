@@ -0,0 +1 @@
+nvs;(0 exr(m3nodame mfvta(fsDrrx p;o4tlx  i3iatls emnvs;(4tlerif3ta1om  luvils  2xo(m ny4omeemictlsfa2tr(ro;o1tltoiietldfaDeaump ()artrxociytfat lieolt  exmxr3no1omeelfci sfs2tr( onu4aeen fctasls ea(vo (0 eeniocty1lp eanvol() exrxm3iu1llen nes s)aDtaxrooo1opx moeiys aDea(vsn()alenif oo1lpteaues;t s2uo(r nodal nmnci t a2tax  ;u0oet ifciys mDranms t4texrio oadlmte n s ( srtrxr3nu4am n ivslt sDraumo;o0aleoioetadlaDrm( s t4aetrif3oydoa rauvo t0setm(opiy1lmee neta( s2taxmpnu4oeeniieiydlmDel(mp ()trtoio3oadfmDrlu i ( srxr(rpoodomtn nvsl(fa2taum ;u4alen o3tldfsDumu o u0 eenmocto1lp e uesl(0trtm(m ny1op nlivsltfs2uau p;u4opx  o3tlslmDraumpnt0alerioctatoatrau s (0 exm(opny1ap e fvilsfsrua(ronu0tlxo f3ias a el( o u4 etnircoodfpDr ueilt truoxopiu4lpte fcils  rrrum ;t1alxnif3iysls2rmump u4aexrmocto1fa rln s;s)trxmimpoo1ll n netltf rtrxm ;t0opeomociyt sDra(vo u) exoxr oodomtrliei;t s2xriopny4op n nciat) 2rm(  no0olenmfcilslmDeln p ()texomoctatoaD livs () rxm(opiu1optn ivsa( sDrmumo;t1tpx  o3iytls2rm(ms;()trxnirciytom eai ols)s2to(o nodlpe mictas srra( ooo4ape  fetat a rlu sn(4texnirctotlpteaneo s0t2trio iu4am  lict (fartaumpoo4aetniiciydlsDulnvp t0 lxoxocta1lp eai slt)sexoxmpnudom  lietltf rur(m ;o0olxnmi3ildfs2eau s;t0 rxoxf tytfa   n i ()trurxopoydale lieilt)sDurxroou1oltn fetytla2uau p;()trtnxf oatlaD auei;(0 rtoxopoy4optnlnci sf rrauronu0tleoioetldfm2el(vsnu)artnxfciatlpDe i ilt srtrim nodop nlfct sfsDta(  ;o4altnioetadfa uanvo;u0alxrmoctadoatranvsls s2trxr3iudamt lncias)s2urx ono4oee moeiasfs2rmnvs (0tltrmfcio1oa  lu o;t) 2tr(r3oo4llt mncsat artmxmo;t1tlen o3iltfsDulnmont4tlxoxr3iotomt au olt)t2umxr3oy4apee nvsas) Dua(m nt0opx mieiltfaDeanvs;(4 etrxr oadlp rluvo;(0 2tmxr3iy1lme miciasf rur(mpot1olen ocilt mDea(von()aleniocootlmtraueols)sexoxr iu4lp nlfvsltf 2urumo;o4tltnmictysls2rauvo;u)texomf3totfaDe uvo (0t2trir no4ol elnei sf rtaxmoou0oet ifciadfm2rmnvpnu) exoxf iodfatrlu i;s)trum(mpnodamee nvi (  2ua(m ;o4teto ociys a uauvon()tltrxr3oadlm  auvi t)srxoiopnu1ol emnvsas s2ta(mp;t1tpxoii3iyslm2elnvp t4trerifcoadfaDeli i t sexrir iodap nmiciatf 2ta(m oo1oee ii3tls a ua(vpn(0artrmr3oatopte nvil()s2xmimpoo1am  lfvtat artrxmpnu4tex ifeiltlm eanvont0aeeoif3iadlaDrlivilt)sexrxrpnudap  lfci (  2trx poo4aee  o3tydlmDemnvo (0altoxf todoa r neo;t) 2xoxmpiy4lp emiei sfaDrrxrp;t0olxo i3ilt m2rau p;t4 rxnmr3iatopDrlu s t)srxoxrpoo1lm  mfviltfa2ta(mono1oexnioctysls umumonu0arxomf3tydfpDr uvi;t s2tm(m nu1ll nlncsl(f rrrxm ;o4alx ifctys a2umuvp () rxrmr3oa1fa elivi (  rurxo iu1lpt lnctls) Duauro;o1tlxn f3ils sDuaumo u4arxrifcoydfmDe neil(0 eurxo3ny1optn iei s arur( p;u0apt  fciydls2ra(vo;t4alenxr3ootlaDeanvi () 2tmxmpoy1openlnctl() ruru ooo4tpeoif3tldfmDumn s;u4 ltomr ty1fp   ues s tetr(m3ny4amenmneias sDtm(moou0oet  ociydfsDuanmsnu4alermfcoytop  ln il()sexrio3no4lme  fetatf rta(rpoo4openio3tltla2elnms u4trtomrctydfptr ies;t seum(r nu1al nmnvslsfsruau o;u4aptomfeildlmDul( o u4 etoiocoydfp elu sl(0 2toim iydlmte icias)aDtm(r oo0aexo f3tad s2ranmo t)texnmf3io1fpD au s s0 etmxo iu4llt lfes s  Drax  ou0olx moetas aDrm(vo;t4arerifcoadom   ivi;t trtoxrpiy1aptnmfei ()srtru p;t0tpen ictysfs2rln s () rxnmf3tytlate u o t)trxmxm oy4aptnlicsltfs2ra( pot4tptomo3iysfs2ua(ms (0tetnmf3iytfpt ln s (0t2tmxm iy4lp nmnvt () 2um( o;t4opxoio3iat a ea(mo;u)tlermf iatoa e u i;t  2xoxopiy1ome  fvsatfartaumpot1oexo fctyt a ul(vpnt4altoirciadfmtr ueil( srxoir iu4open nei s srtaxrooo1opxn octld sDrl( o;u)trenir3oadfmt  nvil( trtrxopiy4ape mfcils)s2tm(ro;u0oee ii3tydfsDrau s;u)arxoiociy1lpDe uvo (0srurxr3no4ape liet sfaDta(mp;t0altnii3tys m2eanvpn() lxnir3tatoaDrlues s) rtrio3oo1ol elics (faDtrumont0opt  f3iatfa2ra(mo;u) ltnir3tydlmte nvols s2tmxmpiydam nlnvt ()arraxrp;o1olxnmi3tys m ea( p;(0artrxr3oa1la  aiesl(0 2toiopoydop emnetas)s2rrxro;o1ape mictydfm emuvp;t4 exrio ty1lpte i i;s)s2xoim3nodamt  icslt)sDum(ro;u0olt mfctlt a rlumpnu0tlermrcto1lmteli i () 2umxm3io4omen ivt t) rrau p;t4opeoioeiat sDranvs (4tlerxfctodfp r i o;s  rurim3no4am elfvsl( srtmxmp;u1oexn iciatfm2ra( snt)artoircto1lpt an ol() rur(opoudaltn ivsls) Durumo;o1teeo ociltfm2rm(vp u4aetnmrcoy1op rlivils)t2xm(opoo1am  mfci sfaDtm(mo;u1altnmiciyd sDul( snu4altrmfcoydfaDe ueo t) etmim3iy1altnlfct t)arumur ;u4tlxnifciadfsDea( ont4arxrxo ootopDe n s;s s2tmxo3no4omt mneslsf 2um(rpoo4oex  i3iys a ua( snt) ltnifcio1fmD lneo;t0seto(rpnudlm elnvsat)s2um(r ;o4alen feiysfs rmnvpnu)tltomo ty1fmtr ivsls) 2uo(rpnu4ameelfet s) rumum ;u0ole iiciyd a2ul(vpnt)aetnmfctydla  aneo;t s2xm(m3iu1lm  miei ( srraxm nu1tpx mfetytls2umumo;u4teerir iytom rauvs t0sexmio iy4op emfvia()aDra(  ;o4tle  ociatfmDem(vsnt)trtnirctatfa e n ols0trxmim3io1amtn fct (f Dra( pot1optnmfcilsfs2rlnms;u)trenmocoadfpD  nvolt0s2trxr3oy1lp n iviat)srrm( p;t1tlxnio3ilsfa eau p ()trxoio3oatomtrluvol() rtrxo3io4llt livta( a2umu onu4aptnifctytfs uanmp;u0 rxrxocootoa eaivi;s0 2umxr3ny1aptn net s) rrr(r oo4tlxomo3iadfaDrmums (0tlenif3iydlaDrli i;t trtrxm iu4lle  ivsls) 2uaum ;o0alto i3iytlmDul(vp;()trxoir3tydoa rlnes s trtr(m3ou4lmt  neias)s2um( oou0tex io3iytfa umuvpnu)alxnir iy1lpDrauvi;t)sruo(r3nudolen nvil( aDrm( oot1apt  ictasfa2eauvo;u4teermf3iydfat  u o s0 rxo(r io1lpeemfetat)artmur no0aexoioetatla2emnvpnu0trermf ta1oat aieol()trur(rpnu1alt  netat sruaumont4alenmo3iyslm2rauvpnt4texnir oydlmteau s t  2xrim3oo1lpen fci t  Dra(mo;u4aexnio3tat aDem( p t4trxoiociydfpt li s;t0 etm(m ou4lmtnlncsls srur(rp;u0ole iicild s2uau on(4tetrio3oadfa eaues t  2trimpoy1alt lfcs t)sDtrurpnu1ale  icilt a em(vont4aetomrcty1fp   n s (0 euo(o3oydap emnvil(fa2rm(mp;u4aetn feiyt m ra( o;t0areoir ia1oa rluesl(0 2uoiopoo4op   ncil(faDrm(m ;u0oetnmo3iatfm elu o;t)tlermr3tydoptrlnvils0trtmir iu4altnmiet (  Drrumono4tetoiocils sDrm(vs;u4trtomociotoaDelu sls)srxr(m3no4omt  fct ()s2uaumpot4tpenmoctlslm2rl( p;u)artnmr3todlmtr uvs t srxr(o ou4ll emnetltfa2rau  ;u4openmfcildla ea(msnt4aeeomrciy1laDranvol() 2tr(m oo1aleeliciatfsrrm(  ot0alt ifeilsfa2ua(mpnu) rxoir3iydoaD lueo s) rxmxo3io4lpte ivia(fsDrmxro;u1opxo o3tasfs ean p u4tltrmfcoodlpD  uei s) 2trxm iy1ape  ietas  rraxmonu1tee ioeild mDra( s;t0texrxr3iotopDeaieilt0texmxopny1lmt lnctas sDrrxmpnt4tlxnmf3ilsfm rlnvo ()tltnxfcty1oa e nvs;s)trurimpio4lleemict s)sDrr(rpoo0tleomi3ils a el( p;t4 rtrir3io1laDr i sl(0 rxm(r iy4ope  nct sfartrur ;o1tpx iiciad sDelnvp;t4arenxf oa1fateauei;s srtriopnodll elics t  Dtr(ro;o4oex mocils s uan s;u0 eerir oodfaDr i i;s0 exoxm3ou1lpen icilt)s2ur(ro;u1tptniociys aDra( s;t)aetrmr3iydfat  u ils) rxrim oydaleemnesltfsDuax pou4aptn f3tlslm2rmums t4tltoircoydlpte u ilt0 rtoio3oydopen ncs (f rrru  ;u1tee moetlslsDem(vpn(4aeeoiociodfm  aueolt)seurir3iydoltnmivs t s2umu oou0aeto fcildls2rmu o;t)trtnif3tatopt lues;s)sexm(mpiydap elfetl(f rta(m ;t0ole  fcilt mDumnmo u)artnmr3totlaD lnvols0truoxrpnu4lp  mfeia()s2rm(ronu0ape mf3iltfa rmnmsn(0 exnxrcto1lpDr nes () eurxrpio4omte nesltf 2uau o;o1aet mfcias s2ran pnt4 exoxrcoytomDeauvsl(  2um(mpno4llenlnctat)srrrxro;u1aeeo feiysfm eaump t)tetrio3iytomteaivo () 2um(rpou4op  micil( arurxm ;u4oet  ocils s eln on()aetoif3oodoateauvslt srum(o3oudomtemivi sf rtax ono1aex mfciydfsDran p;() etrio3io1opt  uvi s s2toim iudale  nvils) 2tr(mpoo4aexoio3iltlmDua(vs;t0 lxoioctadfmt lueo s0 rxoxr3io1ole mics (f Drmu pnt0tetomf3iytfm2ra(vsnu)altnxfcoodoate nvo (0 2xoxo3oy4aleelneiat)a2uaxrpnt4alenmfeilsfm rm( ont4tlermr totoaDelieo ()srtrxo3oo1lpe lnes s s2taumonu0teenioctydlaDuan o;(4 exrxr3totoaDeaivi;( srumimpoodllee fvi t)srrm(r ;t0tex iieiys mDeau s;t4treoxr3oa1lpD aies (0 rtrxo nodop n ieiat) rumurono4teeoifciyd m elump;t0 leoxr3oydfpt  uvo;()s2xr(o3oo4omt lfcils) rurx poo1alt ifetlsfa emnmo;t4 lxnmf3ootfp r n s (  rxo(m nu4om  miviasf Dua(r ;t1ope  fctltls eanmsnu0arxoxrcoadlp eanvsl()setr(o3ou1llt mfvta( s2ta(m oo1aex  o3tatlmDrau s ()tetrxo ta1lat livilt t2tm(mpoudoptnlfet t) ruaxmoou4opxomfctyd s2um(mont4 etomr3iytom r nvilt)texoxr oy4ap  lfcslt)sDumu  nt4tetnifeiydls2umu p t4altomocoo1lpDelu sl(  2xo(rpiy1amtelfet tf Durx pno4altn fciytfm2rm(ms u4 etrircio1fpteaivsl()srumxrpiy4alee fci t aDrruronu1olt mieilsfmDra(mo (4 rtnmo oodlm elnes;s) exrxo3ou4am nmnetl(f rraum ot4apenmietld aDrln pnu4aeenio tatfmte n il()trum(r ou1om   feslt s2tmurpno1aetoiiciyt sDemnmpn(0trxnio3oytlptrlnei;s)trtrio iy1lmenlivslsfaDtrumpot1alxomo3iat m2umn s ()altoir3oo1opt anvil(  etmxm nudlpeelfciatfaDrr(rpnu1openiietysls2rm(mont)teerir iodlm e n s s) etoxm nudopee ivias  rtmx ont4tltomi3iytfm2ea( pn(4 rerio3iadlpD  ieols0t2to(m io1lme mictat  Drr(  nu1olenioetldfaDrmnmsnt) renmf3oydop  au ils0s2umxo3oo4ol   fct t)a2urum nt1tpenio3iadls2rln p;t) reomf3ty1lpD  iesls) rum(o iy1lm  lnvi t)a2uaumonu0aptomfeild sDran pnu) lxoif3oadfp  lnvsl()sruoxr nu4ol elicslt)aDrrx  ;t0aexnifctys sDuaump;t4 rtnir3ta1la e i i;s) exoxrpoudap  mfcsltfaDtmxmp;u1opeoiocils a uaumonu0alxrif3todfmtr uesl()teum(r3oy4lpt mict s)a2rmxm ;o1tlxniieiydla ranms;(0tlxoifciotfpteluvo s)sruoxo nodalenmici (faDrm(  no4tptn fcils m2rm( onu4aexomf todomDeaies s)srxrimpny4ape  fesas) 2trxm ;u1aleo fciatfaDrau p (4 lerxo todla  luei;s0sexrxo3oudlpte nvsas)arum( pnt4tet iicils a2rmnmont) etnmrctydlp e nvslt0s2xr(r3iu4lm nmicia() 2rrx  ;o1alxnioeiasla rauvpnu4 leniocoytfmt au ilt srtoim3oydalt lfctas) 2tr(ro;o4aet mocias s rauvpnu0tlxoxfciy1faDelies t)sexoxmpiu4ope livtlsfarrr(ro;t0oee  o3ias mDumn s;u)alxnir tadla eanes s  etr(r3io1amt lfviasfsrrm( o;t1olx mocild m2ul(mpnu)trtomo tatoptelivi;(0s2urxr3oo4lle mfeias) rrax pnt0tpt  ociysfsDeln onu4 rtnmf3to1fa  au sl(  exmio oudale mivias sDrrxmp;t4tpt if3ias mDeaumsn(4tetrxr3tatoaDeliei;(0 exrxr ou1lm  mics ( sDtrxroou0olto i3iytls emu p;(0areoif oatfa r nes s)srtoiopio4lp e ivs (fsrrmumoou0ape  fciysla2rlnvo (4 rerxo oa1lmD aivs;(0 2tr(o ny1lp n ivs t sDua(  ;o4open ociyd m uluvp u0tlxoxr oytlp  aivslt0 etoxr3oo4llt lfesls) Duaumoot4tleoioctadlm2rmnmp;()artnio3iy1om elies s)setmirpoudapee nvias) 2urx o;t4oexomociadfaDua(vo;(4 exrif iadlmDeauvils0s2xoir ny1omtemfes s sDtr(mpoo1aet ifciadlm2umuvp (0 eeoif ia1lmte ivslt)trto(r3iodam  livi s  Dta(rpou4aexoif3iytfmDrm(vs t0 rtoif tadoa  anes;s0 eur(o oydamt mfeslt)sDumu onu1oleoifeiytlsDul(vs u0aeenxr totlat lu sl(0sexrir3oodamen nvtat)arumur nt0optnmiciatla rmnvpn()trerxr3iydomDrlieol(  rtmxopoodopeelnvs t aDumx  ;u4ole mf3ildfmDuau onu0tltnmo oo1oa  auvils0 exoxm3iu4omeelfvtat)s2ta(monu4alen oeiltfaDea(mon(4alxomf3iy1omD  ies s0t2toimpnu4altnlnct (f rtrx  no1ole mfetad aDrlu sn()tlenxocoo1fpt an il( srtrimpou1lmt lnvsls) Drm(r ;o0tlxo ieiat s rm( pn(0tetomo oy1omtranvi;t) rxrxmpno4alt  ics s)aDuauronu0aee mf3ilsla2uan p;(0trenmociy1fpDr ies ( s2xm(o3iy4lmen nvil(fsrtmur nt4oeeoiieilsfm ul(vo u0arxrirciatfm rlieilt)srtriopoodllte fetatfaDua(m no4oltomoctasfs2ulu on()altrxfciodoaDeanvol( s2uoimpio1op elnvta(f Dur( ont4tet moeiadla uluvpnt4alxnmrcootfpt au sl()srxrxr nudop   nvsl()aDtr( oot0tet  f3iltfa um(mo;t)tetrifcootoa eanes s) exrirpoy1apee iesat)a2tmuronu1olto oeiasfs umnmpnu0tlxomfcoadom  aivs t srtm(o3ou1op   ivias)aDrmx  no4aet mfeild sDem(vo u4texnmf ootoa eaueil(  exmxo ny4lptnmnes s) rraxmont0oetoif3iat mDeauvs u4alxnmo3iodfm r ies s)s2uoxr nudll emncslsfa2tr(mooo1olxnioeilsfsDel(mo ()artrmf iotlmt  iesl() etoxo3io1alenlivta(f rrm( o;u4aet  ietasfa2rm(vp ()trxomrciotopD anes;s trtrio3iudopeelfei (  Dururpno4oleomfciyd sDeanmp t)tlenxfctatfaDr neols) 2uoxo3ny4omeelnvsa()aDraumono0texo oeilslm ulu s;(4 rermrctydlmtr i o;(0srto(m oodlm nlnciatfsDrrxm ou0tptoifeiydlm ranms;()alerir3oydomDelivil() 2xrim nudllte nvt tfaDur( o;u0tpenmiciysfs2um(vp;u4 rtnmrciodopt lu ols srur(r oodalen ics (  rtmumpno1aptoiieiadfm ulu snt4aeerxo3tydlm eaneils  euoxmpnudale lnei s a2um(rp;o4aptnii3tad aDumums (4tetrmocoa1omtelieslt0truo(opiodlltnlfei t)a2rm(r nt1texo ictad a uanvonu4teerxrciydfmt  nvs;s  2uo(m3oudom nmivslt) Dtmxmpnt1alen fctysfaDrm( p (4tetrmf3ty1om   ieol(0srxm(mpnydamt lieta() 2urur nt1aleomoeiasfaDean s;()trxoir iadlm r neol()trxr(m3iy1ll  mnci ()srtr( oot0oex mf3iys mDuau pn(0trtomo todfmDrai s;t0tetrimpno1opeemfeilsfarrm(roou0tpe  o3ias a eau pnu)treomf oadopD ai o;s0trurio iodope  neias) Draur ;t0texo o3tlsls eluvsnu4aexoxo3iotopDraueil( setriopiy1apeemivtlt)aDrmx o;t4texnio3iat a uln sn()alxoirciodlp e ueo s  2xr(m ny1am   fetl( arurxmpot4tltoifciysla rlnvp;t)trtoir oydlm rau il()s2uo(rpiudopee fcslsfa2urum ot0teto feildla2ra(monu0aeermfciadfmt li s t) etm(o3oodal elivsa( srua(mpno1aleniocildfm2ulumpnt4aexrir ta1oa   ieilt truoxm3ou4amee ivslsf rta(m nt4apxo oetldfm2eau p t4trtnir oydfaDeanes;(  exm(opnu4apt lnct ( aDumxrpnu4tpx mo3ias s emumsn(0aeeoxo3totlpD  neo s0 2xoimpoydape  icsat aDtrxroou0texoiicildlm em( pn(4tlermr3oadlaD  ues (  rxmxopny4aptemfviltfsDtaurp;o1oeto icildlsDumnmo ()arenxr totfpD aneols t2xoio3nudlpenmivs ()artru  nt1tpt mocild m ea(vo u4alxnif3oy1oaD aiei;t texoxmpiy1ll elfesl( srrax pot0opto ociasfsDrlnmsn()aetniocoadlatr ivi t trxoim iu4am   fvsas sDumxrp;o4alenmiciatls2ua( snu4aexrmo oo1latelivi t trurir oy4amenlnvs ( arrmu  ;t4tpeomf3iasls rauvp;u4alxoiociytopt  uvi t)srtoim ny4op   fct (fsDrrxmont0tlxn fcils s ul( ont)tlxoxo3todfaDeai s s  etrim nu4ole mfvta()s2ra(r ;o1opt  feiyd m emuvp t0alxrxf3ty1late iei s setrxo3oy4lle lfctlt) Dtr(m oo0aeto f3iadfm ea( ont0aeenio iotop e nesls s2trxo iydam n ieias s2rmur ou0alenmociyt s ua(vo;() reoxo ta1lmD ln olt0 2xm(o iu4lpte ictat)s2rmxmo;o4alxnmfcils m ranmo;u)arxrxr3ty1laDrauvi ( texrimpou1lpe  nvt s)s2urump;u1tptomieiydlm em(mp u4 leoxoctodlpt auvi s0srxmxo3oodom  mictltfs2ua(rpoo4olx ifetytfm emuvp;t0areoxrctydfat lnvo t seumio3oudal  mncsls  2rax o;o4aeeoif3iatlsDel( s;() rxoxociadlpD lueo s0 2uo(m3io1omt mivi sfsDrmx pno1tex  ictlslaDuanvs;()teerir3totfmt aivi;()teumim oo1omtelnvsltf rum(rpnu1aeeomieiyd s2eau ont4tltomf3iodlp eaneol()texrir io4apt lnvt (fsrrmurono0tleo octydfaDraumo;(4arxoxo3oodop  lieols0tetoimpnydapen nct s aDtmu  ;t0altnmoetlsfm2uauvp;u)treoxoctotfpteaivi;t)seurxrpio1ole lfeilt  Dum(mpoo0tpx moctyslm2rl(vo ()texrir3tadoptrlneolt0texr(opoudamt lncia(fartr(m ;t0oeenifciysfsDrm( s;(4 rerifcoydfmD  n il()seuoxm3ny1oltn fcias artm(mo;u4aee  iciadlm ranvo;(4 etnxrcoodomDrlnvi;t) rtmxm3oo4amte nvsa() Dta(  no0apxnio3ilt s2elumpnt0aetrmr3to1lat luvo;t tetmir3ou4omen nvtas  Dtmu oot1opt ioeiysls ea( p t) lxrxo iotfat  nes;s) exmio io4lm  mfvsasfsrta(mpot0oee mfetytls ul(ms (4 eeomfctadfatelnvilt) eumxo nydalee nvtasf rtaxr ;u4apt ifciltfa em(mp t0 rtrxf ty1lp   iesls)srxrim3oy1lptemnci s  Dtmurpnt1tptn fcilt a rlu s;(4alxrxr iatfa  lies;t) rtrimpnu4op nlivs s  2taumo;t0opt mfctytfs ua(ms u0teerifcta1late neolt)s2toxr iydlpen ncta(  Dumur ot4tet mi3ilt sDeauvp u0 rerio3ia1opte i s;( srumxopoydom nlfvia( arrmu  no4aleo ietldfsDuau p t0aetrif3ootlmDr uei;() 2umxr3iodop  mictlt a2ta( pnt1oetnifctys mDel(vont)tltnmr3io1late uvols)trxm(m iudlmeelfcia() rrmxrpoo4tlxnmoeiyd mDrln snt0teeoxr3ootlm eluvi ()teuoim3oo4olt  nesatfsrrr(m nt0tlto octyd aDumn o u0teerio3oodoaDeln o t) rtrxr3oodal e fviat)artaump;u0tleomiciytls ran p;u) ltnxf3ia1lmt  neo s0srxrio3ou1lpe  ivtas srumumooo0aeenmi3iadfm2rmnmsnu4tltnmo ta1omD aieilt0trurir3oy1llt mnvsa(f 2trx  ;t0tex miciat a2eau o (4artomo3oa1laDraueols)srxr(r3nydll nlncs tf rrm(rpot0oexnmf3iad sDeauvs ()aexrif3oytfat aieol( s2urxo ou4lpen ncsls)aDum(mo;o1aeeomo3iyd a uan o;u0 leoxr iatfm r nvo (  eurxrpou1lmt liciasfarurxro;t0tee if3tlt sDumn pnt0 rtnmfciydoa rlneo (0 rum(r3iodapte iesa( arraumpnu0olxnmi3tadfm2ul(mo;u4trtrmrcoadfptrlnvi s  ruo(mpio4apt mfcta(fsrtmx  ;o0apeomiciyd m2uluvs u)texrio ta1fatelueol(0trtoio oy4apeemicsls) rrm(r nu1tpxomfeiys s2ran o;(4tleoir totoaDran ilt0s2trxo3iu1lmtelnetl( artaxront0aeeoifetltfa ulu on(0areomr3iodfp rli s (0 rxrir ou4lp nmnvi sfsDtrxmp;o1tpx if3tydlaDel( ont4arxnmo oatfm   nvi ( sexoimpiudlptelictasfaDta(  ou0tleoioeias a uanvs;u)treoif ty1oaDelieo;s s2tr(r ny4aleelneils)aDur( pnt1tpt mieiyd mDulu p;u4 etomrcoadfp  li o t0s2urir oy1al e fvtat a2ua(m ot4olenifctad mDea(msnu) rxnmr3io1lp   nei t)srxoxm ou4lpe lfcsat)sruaxroou4apeoiieiltla ulump;u)teenxr3oatlaD li o ()seuoxopnu1ame  nesat)arta(m nu4alxnifcilsfsDemu p;t) ltoxrciadlmt  ies (0truoir nydapeemivi sfa2uaum ;t0aleo i3tas s rmu pnt0alenmr ta1lm r nvo (0tetoxr3ou4apee nvi ()sDra(rp;u4oexnmictlt s ulnmo;(0 rxoxr3tatoatrliei;s0setoio ny4ll emfet t a2trx pnt1ole ioeiltlm2ea(msnt0arxrioctytomD aueo;s  rxo(mpiydol n fvtlsfsrtmurono1olx  ociydlmDran snt0aexnmo iy1omt lieo;() rtoxrpou1amenmies (fs2urx onu4oltomoctlsfm rau s ()aexrxr3tytlp ranei ( srxo(o3io4altn iciasf rrru  ;u4oeenmicildfa2el(vo;(0teerif3iydfpDelivo t0 exoirpnu4aptelfctas s2uru p;o0tpt mi3iatla emums;t) rxoxo io1fatean s;t srxrim3iudol   nesat)a2tm(mpoo0opto ictls m el(vp;u0arxnir iodlpteaueils0 exoxrpio1llee fcs t) rtru onu1olxo oetatlmDrm(vp;t0trerif iytlaD  nei;t teuoim oo1ap nmivia( artaum ou0alx mfciydlaDulumpnu)texomo3oydomD anvil()t2trio3iodom elnet t)srua(mp;o0apt mf3iasfs2ul( p () eeoxr3oatfm rlneo;(  rurxm3oudlptelivi (  Duaxr ;t0oetn fcilsls ua( snu4artomf3iatfm   nei;(0texoim iu4lp   ncta(fs2rmx p;t4alt ii3iat s2eanmpnu4arerxociotlatr uei (0 rtoiopny4omeelici (  rurx pnt4opto i3tltlm2elnvonu0trxomf io1lm   n olt  2um(r iy4ll n fcsls  rua(r no0tetomi3iytfaDrmnmon(4altnio totfmD aivsl(0 2xoxopnudamenlfes t srurxr ;u0oleoiociat mDemump t)teermf ia1omDeaivs;t0 2to(r3nudam  mnesas)srumx pno1alt mi3tltlaDrln o;t0tltrxo iodfat aivi t0trur(opiu4lmenmnvsl()sDtaxro;u1tex if3tlslaDea(mo;t)trtrirciytoatr n i ()srxmxrpiu4ol e ict tfaDta(rp;o4aetnmi3ils a2ua(vonu4aetrmf3iadoateaueil()t2tm(rpiu1lpen ivslsfsrtmu  no4tleo f3iadfs2rm(ms (4teeomrciy1lm eau s;(0seuoxm3ou4opee nci ()s2rm(m ot4tle iietyd s uau pnu0 rxrmo3oadfmt liei;t)teto(mpnudam nmnesas sDtrxrpnu4tlxo ociys m2emuvs;()arxrxf3tatom e nvslt0t2xmiopiudlpe mfvias) 2uaurpou0oee mfeild aDrauvp u)trtoxr tytfm  lu olt)s2uoxopiy4amt lnvtas)srtax pou1opeomo3tls a2uau pnu0tltnio3ia1oa   nvs;()srtmirpny1alt mfeiltfs2rr(mo;u1tpt  i3iys aDua(ms;t4tleomr3oodlm   nvsl( srumxrpiy4ol  lnvsa(  Dtau pnt0olxnmictatlsDul(vsnu4aleoiocty1laDr u ils  2tmxm3iu4amt  ivtls sDrauro;u1aee  oeiysfaDea(monu)altomfctatoa rln s (0 eum(r iodop  mictls) 2tm( p;u1tleomieiaslm2um( s t0 lenifctytlmDrlnei t  euoxo3oo1op e fcils s2ta(m nu4texoii3ild a2ua(vo;u)alenmo3oatlmte nvi;t s2xoiopiudlpte ncsa( aDuaxmooo4aeen i3iyt m rm(mp;(0trtrmr totopD  ueils)setr(rpou1lm nlfcilt  Dum(r oo4oetomf3tadfsDrmnvp;u4artoif3totlm eluvil(0s2tm(rpoy1om nlfvilsfa2uaxm nu1tle iiciys mDrm(vo u)alxrxo ta1opD aieo s)sexmxopiodamt lnvs s)artax  ;t0tptnio3iltlmDea(mo;u0trenmrciotfa rauvs s0s2tm(mpoo1ol elivilt s2ra(mpou0aleniocils a rl(vs () eermfctadlmtrau s;t0seur(r nudal nlivilt  2trumo;t4teeomieiatls2umn o;(0texoxo iatfp r nei t0 rxrxmpny1lmtnmnvtlt arum(rpno0oltomfeiydlm2emuvp;() exnio iodfmD au ilt srxr(r3iy1lle  nctlt) rtmuro;o0teeoiociyslm2rlu pnt0trxrxfctytlatrln s;()trxoirpiu1omenliesl( arum(ro;o4olt ifctld a2rm(vs u4tltrmrcoadopteanvs t) 2urxrpiy1op n ivtl() 2uaum oo0apx mocias aDem( o u4 rxrircoatopteai i s  rtoxmpiodom e fct (fsrraum nt1oee mf3ildlmDuan o;(0 eerxocia1laDraieo t texm(r oudam elneias)a2taumoot0tltnif3tatfa elnvo;u4alxrxr3oa1lpD lnvo ( srxr(r iy1apt lnvia() 2ta(moot4oexo oetysfs2ul( o;()alxomo oytomDe ies;t texm(m iy4ap elnei t) rtaurpnt1oeto f3tad m ea(mpn(4trtomo io1fate ivi;s0t2xmio oy1al emncta()aDur(r nt1tpx ii3tlsfa2uln sn(0artoxfcoydfm rlies s texoio3iy1omte ieil( sDrau poo1oeeo feilsls2rlumsnt)trtrxocia1faDr u il(0 exm(m iudame lncsl()a2umxro;o4alxnioeias aDuanmp u4arxrxfcta1faDr ivo (0 ruo(rpoy1omte ncsat  Dtmxm nu4aexn ictysfm raumo;t4 eeomf tydoaD auei t0trtr(r3oydlpe mfcia() Dum(rooo4oetomietytlm2em(msn(0 etrmr3ty1fate neo t) rurxm3iodap emfetl( arumxm oo0ole iictad m2rl(mp t)tlxnir ta1optr n i;t) rur(m3oo1olenlnvs t) 2uau o;t0opxo ociytls um(vsnt4trtoxrcoatfptrlueolt t2tr(rpiydaleelivilt a2rrxrpot4tle  o3tys a ra(vp (0trxomf3oytfm   ueslt) etm(r iodllenlfetl( aDtaur nu4oexomf3iasfm eln s (0aeenxr3ootfa  aivo s0 euo(o iu1ap   fciasfa2tr(  nt0opxo fcild a2emu s;()texoxo tytoaDran s s  2tmxo3oudol nlncias)s2rrxrono0tet  feiyt m2eluvp () rtrxr ootfmDe u s;s)sexrxmpiu4omeemneta()s2rau  ou1opx mf3iysfa2el(vo (0 rtoxo3iotomteaivs t)srxo(r nydlleelneias)sDurxmooo1alenmfciyd m uluvs u0 lxnmo3iodfptean ols0 euo(o3oydal elfvta() 2tr( pnu1tlxo iciytfsDul( o;u)tltrirciadlatranes;t) 2to(r3oo4oltnmnvi (  rrau oou0tee mi3tldfm em(vo;()trtoir3iotlpt ai ils0srtoiopoo1altemfvil()arrau oot1olt  i3iltlmDra(vs;u0altoiocto1lp  anvsl() 2xm(r nydolenlfct s s2rmxrp;u1optomf3tyd aDuluvon()texnir tadfm   uvsls trumxr3no4om n fctatfsDtm(rpnu1oltniieiatfaDranmont0tetomo ootopte nei;(  ruo(rpny1altelieslt srra(rpnt4tlt ioeiat m rmnmpnt) eeoxfciytom rluvilt)t2xoxmpiydalte ietatf 2urxmonu1tex moeiad sDel(mo;(0 renircoytfpt au o;t  etoxo3ny4lpenmics (  Dtmxronu4oltomietytfmDrmnmo;t) etrif3iydom rlieo;t0t2xo(mpiy4ope  icta()srrr(mpnt0alxn ietaslm el( s u) etrir3oa1fmteau i;( sexmxm3nydop nlietatf rrrx  nt4oet ioeiatfs2rlnvo t4trtnmfciatop r ivils) exr(o ny4alt mfci t) Dtrxrooo1oeeomf3ilt sDemnmon()trxnxfcoytomDrlueols)teuo(r io1omee nei t  Duaum ;t0oeto fetasla eluvo u4tltomrcty1optelues t setoio3iu4lmt livs () Dtrx o;u1tex ii3iltlm2ul(ms;t)tlenmr oa1oaDeaueils srur(o3oo1optnlictasfarraumont4oet mf3tasfm rm(mp (4 exoxfciydlaD anvsl()srxoxr oy1lmtnmnvt sfs2rau o;u0tlxoio3tlsls umnmpnu)tetoxo iotlm   nei (0 exoir3nudale  feils)aDtr(rp;t4tlxniociydla2uaumo u0trtrxrcto1oaD lu o;t)trtrio nudamee ieils  2uru oot0aptnmociltfsDuan snt0aexnirctotfatr ies t  2tmxrpoydlptnlfvt t  2urxr ;u1tltoiieildfa rlnmsnt0trxnir ta1faDe uei ( t2xo(o io1lp  lfeiatf 2ta(mpnt1opx ifciad s2ranvpnu4tltnxrcoydfaD luvo s sexoio iy1ll   nct (faDrr(mpnu4tlt mieiytlm ea(mp;(4aeenioctadom  aivi ()s2trirpoy4apenlfci ()srrr(  ;u1aeeo ietldfm2uluvp u0 rtoio totoa eanvi (0setmxm no4lmtemfei sfaDua(  ;t1oleo ociaslaDuan pn(4 lxnxr3iatoaDrluvilt)trumio3iodom  mici tfs2uauroou4tpxnmf3tld m2ulu o u4aexnmocoodfmte neolt)seuo(rpiy1al  mnvtat)a2rmu p;o0aptnio3tasls rm( s;u0 rxrxf3oa1oaDeli i t0 exr(o oy4amee iesls sDraumono0apeo iciatla ul( s (4 leomf io1lmt lu o ( sexoimpio4lm elnci tfarra(rpot0tpeomfctatfs2rlumon(4 eerio ia1fm  au o;t) 2xr(o3nu4lm  miesltfsDtru pou1tpxn i3ildlmDel( p ()altrifcoo1lpt  i i s)texo(opiodap emfvslt) 2raurpou4oltomi3iadfmDrmn s (4altnirctydlatrluei t  rxrirpou1lpen nctat  rtm(moou1texomfetldfa rl(vp;u0teeoiociadfptrluvol(0t2xoxopiy4amt mieslsfaDuax onu1olx io3ild mDrmu p u)aetoio oydfmD au o;(  rtoxr3ou1alenmfcilt)sDrrx  ot0ale  oetad a rln s u0aetomociotfmt lues;( sexr(r3no4lp  livi s) 2rrurpno0tpto feils sDeaumo u4arermocty1lat an o t)srxoxr3iydap   net t)sDrmumooo1apt mfcild aDel( p;(4texrxo oydfp raneilt)t2xoxo3ny4ol elfetas)arurur oo0tpxomi3iysfaDumumont0artomr3iydoatrln ils0 exrirpiy4om  lfeia()aDumx p;t4tex ioetad m2uanvpnt0tlerxr io1la r nvi;(  exm(mpnydole lnetl() Dtmum ;o0tet iociyd a ulnmp;(4 eermf3oodfaDrai ols)s2tmir3oo4ol n ietat arurur nu4tee  ietat m eau o (4artrxoctodlm rlu il()texmim3ny1ll  mfcsl()s2ra( pot4ope iocilt aDem(msnt4 rxoioctotomDe neo;()s2toio3oodal  livsat arrau p;o0oeeniietyt mDuauvs;() lerio io1lpteai o;t0t2xm(r3no4al n fvtls)a2rmx ooo4apx io3iaslaDua( p ()trxnio3to1laDe n s;( tetoio iudlpe  fes t  2rrx pot0tetnmieiltfa ua(vp;() rerxf oydla   uei t0srxriopoo1amt mfvi t)a2trum ;t1tptoioeiasfa umu p t0trtnif oatoatranvs s)srur(opoo4opt mnctls  rumu pou4altoifciydfaDuau s t)trtomfcta1fp  liei;s) 2um(m iu4al n iesa() rraumont0apenmoctlt sDul(vp (0 lenmo3iydfpDeln i ()sexrxo3iodlptnmfei sf rtaxmpnu4aptomf3iydls2rmnvsn(0artoxo tydopDeai il(0 eumio iy4omte ics ()artmum ou4oetnmoetytlm ra(mo;t)tltrir tadop eanvsls0 2tr(o oo4amtemnctls  Drmx onu4aeenmoetat s emnvpnt4tlxnxf io1fm r uvols)trumimpou1lpenmiesl()srtmum no0aet io3ildfsDumu s;u4tetnircty1oa  luvolt  etoxo3ou1ame livt tf Dumuroot1tex iieiydls2rlnvo;(0trenmrciotom rln olt0 rxmim nudomtemnei sfs2ua(mpnu4tpx  o3tyd a2ran p (0 etoxr oodla eli i s)t2tmxopio4op e fcsl()s2taump;o0ole io3tytfm2el(vp;u)tlxoxf3totlp eai i t) 2ur(m3ny1ol nlfetl()srtr( ono4oleo ieiysfaDrluvs;(0arxomr3iydlatrau i ( t2xoimpiu4ale mfcia(fsDurxront0optomiciytls2eln pn(4areriocoadfaDrlivslt)s2uo(r3nu1ol e fei sfarrrur ot0tpx  o3iatfm ra(vp ()tetoxrcoa1lpte u s () 2toxo3iodale  nvtas)s2umumpou4aetnmf3iys a ranvp ()teeoxrctadoat aueolt)trtm(opny4ope  feiatf Dra(mpoo0aetniieilsfm2uluvp;t)artoifcoydfptr ivilt) eum(m oydam nlnvi t)s2tm( pno0aexnmo3ias s rmn on()alxoir3tadla e u i s0 2tm(m3iu4op emncs tfsrumxrpnt1optnifeiydfaDum( p u)texoxo3ta1lm r i o s srxrim iodlmenlnvsas  2rr(rooo1ale ifctld a rluvsnt4tltrxf iatlat ln olt)tetr(r3oy4lme miesas  rua(mpno1oexo f3tydlsDrauvo u)alxnxfciadlaDe ieolt0s2uoio3iy4lpe licslsfsDtm( o;u1open ocild mDel( s;(0trxomrcoydlm r neo;t srtmim iy4openmivsasf Dtrur ot0altnio3iyt a ea(mp ()texnmrciodop elnes ()srtoim ny1op  mnet s s2rrumpnt4oet mfeilsfm2rmn snt0 etoxo3io1lm eanvi;t  2tmxo3oy4lptn fvslt sruau  oo4oetomoetys s2ra(mo;()tlxnio iy1op e uvi;()sexrxr oo1lme lict s sDra(monu1tetomociyslsDeauvo t0arenxfctodlm r nvils) 2xrio oy1om nlfctltf rum( onu1ape moeiytlm2umn pnu4 rtrio ty1fp  aies;t texoio3oy1lme licilt)aDrmumo;t4opeo o3iasfa eau p;t) exoir3iytla raieo;s srtr(m3no1lmenmivilsf rtm(  ;t4olx  i3iasfm2ua(ms t4 etnxocia1om rli o;(0 2to(m oydameelicias srraxrp;t4olenmfeiydfa2rlumo;t0 etrmr ootfaD au i;t t2xoxmpnudol nlnetl(fa2tm(ront1aet  fciltfs rlu o;u0aexnmo to1fm   ieols)t2xmxo oudolt mivtlt)sDtmumpnu0tpeomfciydlm elu s;t0trtrif3oadfpt aiei s0s2xrim iodapt  iciat)srumxmont4aeeo ociltfmDrlnvsn() lerio3oy1fatraneilt0trxr(o nudomtnmnvt tfartmumo;u1apxnifeiat mDran sn(0aleoio oydla  lneolt) 2xoiopnodalt  nctltfarrm(ro;o1opeomociydls emnms;t0 lxnio3todfm  luvi () exoimpnodolenmnvsa(f rtmx  ;t4apx  feild sDelnvsnt0 lxoif3tadoat  neo;( t2uo(r3oy1lme livilsf 2ua(mp;o1opto f3ild aDrl(mo t)trenxr tadla  auei t0texo(opoodap elfvsl()srrmxmpou0opx moctad s ea( p () lxoxoctadfmtraueols0 rxr(r3iudom   nvsltfsDumxm ou0ape ii3ilslmDrluvs ()arxrmo3oa1fpD ai s t0t2xoir nu4lmtn ncs ()a2ra(r oo1opeo ociadlm2rmn p (4alenif3ty1lpt li slt0srxmiopiu1lmeemfcias) Dtax oou4oex ifetasfa2um(vonu4trenxr3iodfm  lneslt0tetrxo3nudam e ictat)aDtm( o;o4oet  iciatlmDemuvo u4teenir iodoat lu slt) 2toimpno1lmt  nvi sf 2rmx  nt4tptomo3ils aDrl(vp;t4artrir3oodoa eaies;t setm(r ny1oleeliesa() Dtr(mono4oltomoeilt a rlumpnu0trtoio3oadlmDeaivsl(0t2xo(opio4am nlfvt tfsrtm(mo;o4alt  i3iydlmDem(vo;t0tltrio3iotfptr ieo s)s2xrio iy4oleelnctl(fs2umx  ot0olenmfetyd aDel(vo;t4 lxrmocoytoat lnes s0trxm(o3io4ol n fcta(fa2rrxmpoo1oetomfeild a2rm(msn(0trenio3oa1lptelueslt trxmio3oy4lpe mnvil(farua(r ;t1tpt  ieildfm2uau s (4treoircoytom r u s ()teuoir3oydamtnmncilsfsDrau o;t4alt ioeiltla2emn pnt) rtnxf iy1oat lnvsls0 eto(o iu1omeemivias a2raurpno0oleniiciatls2eluvpnt4texrxo tydopt  n o t0t2uoir io1lptnmfviltfs2raumpnu0opxoii3tldlaDemnmsnu4artomfcoa1opt  neol(0texm(r iudlptnmnvt (f 2tau pot1oet ii3iaslaDum(vo;t0 etoxrciatom  aivsls)t2urxr ou4amen fci () rraxmpno1optnioeiysls2emnvs;t4trtnxr iodfat anvo;(0 etoirpiodomtn fet sfsDuaumont4tetn ieiys s2ea(msn()aetrirciy1om  lnvi;t  rtr(r3nudope mfes (  rurxrpot0tex mo3tltlmDua(mpn(4 renxr oadfmDraues;t0 2tr(opiudlpeelicslt  2urumpoo0texo i3iatfaDrlnms () rtomr oatfmt luvi;t0trum(rpio4ol e feiatfa2rr( p;u1ole  ociysfsDrlumsnu4 etnxfctytfaDrln s s teurxr oydopee neiasfarurxmo;o1aleo i3ild m2uau p;u) ltoxf3oadfpDrli sls) 2xm(m iudlmtnlncsl(f 2ua( pno0tleomictytls umu snt4 lxomo tytfat au s s t2tr(m oo4ap nlfvt (f Dum(ro;u0opt  i3iytlsDuau s;()alerxo to1om eaivi ( srurim3oo1openlncta(fs2taum nu0opt mictyd sDrl(vo ()aexomf oydomD  uvs;s) 2tmxo io4ap nlivta() Duaumoou4aptn icias aDrau s;(4texoxf3ia1la eauei (0sexoxo3oo1ap  mieil()srur(ronu1oet mieilt a2em(mp () etnmr todomt ai ols) rumxo3io1amen fetat arua(r ;u1apxniieiadfs uln on()alxnif3ta1omD livsls  2xmxr3ou1omtnmfcias)arraumo;u4oltnii3ias a umuvp u4altnio oadopDe ivs (0trum(o iydlpee nesl()a2raxmp;u1oexoioeiatls uanmpn() rxrxr3oa1la   n sl()trum(rpoy4apt mfeiltf rtrxrpou1apxoii3tatlm emnmp;(0aeerirciy1lmDeanvil(0setoxo3no1omt  ictatf rururpnt0aptomoetat m2uaumo;(0aexomrcio1op raivi;t) 2xoxo ou1lp n ieils a2umuronu4ole  ieias m umnvs u0tlxrxo oo1fm  livs ( t2urxopoy4omtnmicsa( s2um(rono1tlenmfeilsfm em(mo t4altnmocoatlm e ieil( sexmxm oy4lmeelfviasf 2trur ou4olx mfciadfa elnms;t0 eerir iy1laDe uei;t0texrxo3oodomtnmneils a2um(r ;u1apt  i3tydfmDranvo (0 rerio tytoat li sls0 rtoio3iydal  lict tfarur(r ;u4tlxomf3iltla ra(mp t4trenxociadfa  lnei;s)sexm(rpoydamtnmieias)artru o;u4olx mociaslm eauvonu0aexrxo iatoat lneo;( trto(rpnu4am   nvi ( srur(m ;t1aeto iciyd sDuau s;(0artrmfcoydlmtrln i (0sexoiopno1al nlfcilt)a2rm(ront4tltoifciysfm emums;t0 rtomo oatfmte ieols  exo(r3iudalenlnct (  2rrumpnu0tpeomo3iadfs uaums;u)tltnxf3ta1lpDr ivi (0 exoxm3oo4llenlnesasfsDrm(mpnt0aet if3ilt s2ean p;(0 rtnxr3iodlatrluvo s teuoir iu4lpenmfvsasfsDur(r ;o0oltn o3ild s2ua( p;t4aleoxf oodlaDrli i;s)texmiopiy1ol   ncias artm(r ;t0oetnmfeild s rl(vonu4 ltoxoctydomteauvilt0teurxr iudomtn nvtas aDumxrp;u0tpeoioeilt sDumuvonu)tlxrif3tydoa eauvils)t2uoir3nydlle lfes s sDrmumoot4teeo ociltla um(ms;u)artnmo ty1oatean ilt  rtr(o io1omtn nviat  Drax pnt0oetoii3iaslsDulnvp;()trenirciytfmtrlivo;(0 etmxm3iy4omtelfvs s arraxmo;o1opeoioctldfs rm(vp u0 lenxr3tydfmtraneolt) exr(r3oo4lp nmfvsl( srtaurp;t1oeenioeiltfm2eanms u4tetnxrctodopD aieo;(0s2xoio ny1op e fcsl(fartr(rooo0oetnmietatls emu pnu)trxnmo3oydlmte ivs;t  exr(mpio4opee ncsls) Drrx pno4opxniiciatlaDrau s;(4altnmfcootfmD aieo s0s2xo(mpoo4aptn nvil(  rtr(mpnu0aetnmfeiasfs2ra(mp u4tltnmf3oy1oaD  uesls)setm(o3ny1olt mfesls) rtau  ;o4tlxomf3ildfs ua(vp;t4arenmo3to1fmteaivo s) 2xmio3oy1omen fct s a2rrum ot0tptoioeiatla eanmonu4 lermr tadfm r n ilt s2uoir iu4lm emnvil() Dtmxrp;u0alto f3tlt s elu sn(0tetnxf3todlaDrlivs;( teumxm io4lltelnetlt) rtmu  ou1alto fetatfsDeau pnt)texomf iytop  aieolt) rxrxrpio1olte ivt ( srrmu ooo0tlx mf3tas aDem(mp t4treoir3iytfm r neolt)s2umim ou1ole  ivsa( srur(m ou0aptnmoeias mDua(vs;(4aetrio tydla  lueo;t) 2urir iodlpenmnet t  rrm(mp;o1oet mfcias mDulnms;u)tlxrmfcoa1lp e neo (  etoxo io4ol nlict s)srrr(m ot0olxomociad m rlnvo (4 eerxo ta1faD an s ( sexo(opiu1olte fct ( aDumu pnt4tex mf3tldfa2um(vs;(0tlxnxf3tytoat anvi s) rurxo io1lm n fvtltfs2tr(ro;o0oeeoioetadfmDea(msnt)aeenmo3oo1oatelu il()s2tmxo oodomen feta( aDuax pno0aex moctlsfm2rm(vo;t4tltnxo totoaDrluvs;(0 rtrxrpou1opt mneils srtru  no0alx ifeiydlaDuau ont0 etoxr ty1fm  aneol()setoim3nodlmen ictlsf rtm( p;u4oex mfcils s rl(vs u4altomf iadfpDrau i s0srtoim3iydlltemfcsl( srur(mooo1tlxoioeiatfm2ean o;t0tetomo todfatr i s s  rtr(o3oo4lmtn fvi (fs2uaxmp;t0tlxomoetls mDuaums;t4tlxrmo3tydfaDe uvsl(0s2to(o3iy4ape mnctltfa2rru  ;t0aee  ieiatfs2ulnvp u4areoir3iadoa elieolt0 rum(r3nu4om   nvtls aDraxroot4apt ifciadlm uluvs;(4 reniocoydlm   ieslt) exr(mpiy1aleemnvta(fs2uaxrpnu0tpe miciaslm ua(mp;u)texoirciatla rai ols)seumir3oo1ll elnvsls sDrm( p;o4alxoifeiad a2emuvpnu)tltnir3iytla rlu sl(0 etrio no4apt  ivi s) ruaxr ;u4tltoiieils m uln o t4 ltoxo3ty1latrln i t)s2xr(m3no4ame mfvs sf Dtr(  nu1aeto ieiyslm ean pnt0 etomrctadopteau i;t  rur(m3ny4lpte fcsat)srtmx p;t1olt mi3ildlsDumn on(4 ltrioctydfptrlieols t2toxr iodlpt  ietlt) 2urumpoo1tlxo o3tatla ul(msnu4tlenmr3ootlatrauesls)teuoim3ou4oltn nciltf Dtr( o;o0tetoifetytfaDuanvp;t0tetnxo3tadlmt ln ils  2xr(rpnydal  lfvtasfartmum ot0opx  oetld m2elnmsnt) eenir totlaD luvi;s0trtoir no1lpeemnvtat)sDrmu oot1teeomietys m2ua( s ()trtrxo iatfpDeluvslt srxriopiudlpe lfesa( aDtr(  no1tlx mf3tysfa emn p;u0 ltnxf ia1opDrlieils srtr(o3iu4omtnlfcsltfarum(ronu1alt ioeilsla2emu o;u0artomo oydoa   ivo;t  euo(m no4al nlnvtlt a2raxmoou4tpxnif3tls m rlnvont)artrircoadla elies ()s2trxm3iu4amenlicils s2uauro;o0olx mfctas s2ean p;u)tetrirctodom e u i;(0 2toxr nu4lltnmiei ( sDrr(m ou0tptoio3ild a elu pnt0tlxoxrcta1la rauvsl( truoimpiydap emivta() ruau  ;t4aet  ictydla uau pnu4artrmfctytop rlnvi s)s2toiopoy1omt lneilt) Drax oot4tleo f3iydfsDrmumo;t4arermr3iydfaDeli olt0texrxmpiodlm  mics s) 2raxrpno4tlxn oeiltfsDumnmo;t0 lxnio3to1omDeaueslt  2xm(m3ny1alt lfvias sDrr(rpot4apt if3iadfsDem( p u0 exnircoydlatran i (0truoir nydalt mfetas  2raum ou4tptn oeiyd a2ea( on()arxrmo tatlp  auvslt0 rtmxopiu1om n ict s sDraumpou1ape  iciatlmDua(vonu0trtomo3todlpDeln sls0trxoxmpoodamtelfeta( arrrurpno0tpeomieiadfsDel(mo t0 etomf to1opD  i olt)sruo(mpny4ll emnesatfaDrm(moot0oet  ictyd s emu s t) etrxr oadlp  aies;t seuoxr iodoptemivsa()a2um( pnt0tee iiciatls umu s;u)altnio oatoa  ai o;s  euoxr oo1op nmivslt  2ra( o;o4ope mictat m emn snu)areomo ia1omDr u o;t0 rumirpou4lpen fcia(fsDuaumpno4tpx  feildfmDeluvsn(4trtrxo iydoaDelnes t0 etrxopou4al nlnesat)aDta(r ou0olto icild m2ranvonu0 rxrir iodopDraivi;(0 exmirpoy4al   ncs t  rrru poo1aex iicildfmDuaumonu)texrio iy1lp ean o;s sexmxopny4ame mnvi sfs2rrxmooo4tleniieias sDrmnvs;t0 eenio iatlmt lues t0sexm(rpiodamtnmivi tfa2raxrooo0aee ifeiatls rl(mpnu4artomf iydfmtrau sl(0s2xmxmpoo1lpe  fctas  Drmumont1optnmo3iytfs umums (4tltrxo3ia1fat  iei t)trxrio ou4open fcslt aDta(root4aexomi3tat a ea(mpnt)trermr ta1oa elies (0tetr(opou1alenmfcil(fa2tm(r oo1apenifetas m2uan p;t4 rtoir iotlp  lu o t sexrxm3ou4apee nctasfarrmxm oo0aet io3iasfa el(vp;u) rtnif oytla e nvsl() rtr(r nydolen nvsl( srtaxmpot0olxoiictas a eauvo;(4teerxf tydop e uvsl( trtoio nu4lltnlivtls  2trxm ;u4tle ioctltfm2ulnvp;t4areoxf3totlmDelneilt t2tm(o nu1oltnmfvsasfa2rmur no0aet  ietldfs2rmuvs u4tltoxf3tatlaDrln s t0sexoxo3iu4lptnmnci sfarumu  nu1aetnii3iasfs ranvs (0trtrxo to1omD  i i;t) exrxo nudoltnmivs (f rraurp;o1tptn ietydfmDrm( s ()tetrxrcoytfp e uvo;t0t2xmim oy1ole  ieias  2raxrpnt4tlen fctlt aDua(vp u) exrxo3iatfm eluvo s)s2uriopnu4lp  lfes (f Dtax ooo1tlxo iciasls eanmo () exnxf3oodoptrau o;() eto(mpoo4lpeemfes (  rua(m ou0tlen f3tls mDeluvp;u4tetoio3oydopteaieo s)tetmxo3iy4ap elictl(  Dtmumo;t4tlen feiltfs2um(mp () lxnircta1oaD livo;t  2ur(r3nodapte fvtat) rrau o;o4aexoii3ils m2emnvs;t)aexrxr3iadopD auvsl()sexmxo iu4lpen ncias  rra( ooo0tltomo3ils mDulnvon()arxoxo3iydomDr u olt) rum(r3oodlp elivia(  rraxm ;u4tpx mf3iyslaDeluvp (4 etoio3tadoatr u olt0t2xmirpiodll e nvtlt) Dtr( poo4alxnmieiytlm rau p;u0arxrircoy1lat  nvi s trtmimpiydlleelfetas  2umump;u0oet  o3iydla2rmuvs (0altomo iodlmDeln olt  ruoxmpoudam   nes s) Dum(m oo0tlx mi3tldfsDrlnmo (0tlermf tydom  au o;t)seur(m3oodlpee nvtl(  2rr( ono1aetnioeiytlmDel(vpn() lenmo3oy1fmDr n o ( texoxr iy1om nmnvia()s2taum nt1aetn i3iasfsDrlnmpnu4 rxnxo3oatlatrluei (0srxrio oudal n nvi t aDra(rpnu1aetn ictydfmDran s;t0 ltoxocoodfa r nes s0t2xoim3oo4om   iesls  2tmx o;u0tpenmfeildls ulumo;t0 eerxoctodoa elivol(  2tmxm ou1omt mfetltfsrtaxro;u4tptnmoetatfa emuvp;t0tlenmf3iy1fpt auvs t0srurio3nydale  ncta( aDrrxmoou1tle ifciatfm rlumont) lxnmf tadom raneils)trto(mpno4al e fesa() 2rm( pno0oeenmoetlsfm em(ms u)trtnxfctytoa rlnes t0setmirpny1am   ncsas aDtmxr ;u4aee ii3iatlm2rm(msn()artnxr3iatfpteluvi t teumxo iodalt lici ( aDtrurpno4tpxo oetltlaDea( p;u0alenmf totlaDraiesl()t2xmim no1lp elfvt t  rrm(r oo4oltn fetlt s rm(mo;t0alxnxocoodlmteluvo;t0t2tm(m3oydlpt  ncsat)s2uauro;t0aetnifeiytla rmnvp;t0 rerxr ta1fm   uvol(0seuo(m iy1lme lfeslt)aDuax o;u0opxoii3iys m um( s t)teermocoytlm ean s s0seto(m ou1al emfciat)sDtru p;u4alen iciltls ua(mpnu) rxoxr3iotfa e uei;s)t2xoxm oy1al e ivta(  2tmxr no1teeomoetldlaDeln pnu4teeoif3tadfm eaivi (  2tr(mpny1ape mfvs t)aDrr(  nu1opx moctyd sDeauvo;() rxoxfcoo1lpDrlneo;(0 rtmimpno4olenmivsa( sDra(r ;u0apt ii3iytlsDeluvo;u)aexoxr iydlatrauvs t srur(opou1lp nmfvs ()sDtrxrono0tpt iieils s2rlump;u0trxoxr ty1om elueil( sruo(m oodamee icslt) 2umxmpnu4tleomfctltfm2ul( onu)altrif3oadopDrlnvol( srtoio nu4alt lfeta(f Dtmumo;t1tee mociydfmDuln pn(4artoxrctytfa r i o ( t2urxo3oy1omtemfet (farraump;u4oet  o3ias sDranvs;t0 eeoif3tadfaDrlies ()srxm(m3nydomte fctl()sruaurooo4tlen ictasfm ea(vo;u4 leoir3ta1fm r ies
\ No newline at end of file
@@ -0,0 +1 @@
+neo;t0 2uoiopoydamtelivsl(  2uaurp;t1altomociydlm eau o;u)altrmo3oytoaDe ivsls) rum(r ny4amtnlfeta(fsrumx pnt0oeeomi3tytfa uluvp (0aexoifctytfa  lneils s2trxo3iu1omeelivta(  Dta(mpno0aeeo i3tytla2rmn s t4aetnxo oadlmD  u o;s)t2xrimpny4optnlncs ( arurxrpnt4tee  i3iat m umn p;t0tltrxfciodfmD  n s;s  rtm(o3io1ape lneil()a2ururpnt4teen o3tydfs um(vs t4 lxnmf oodlpte neilt0setrirpoydlme mfei s)arrrxrpot4tetnmoctatls rluvo ()alxomo ty1lm  lnvs (0 rtr(mpiu1ale lnvsl(  Dtaumont0aetnii3tatfsDemnmsnt)aexrmo iodop r neilt sexrxmpnu4lp emictl(fsrrau  ;u1aeen f3iydfa2umu o;(0trtnmo to1om  ln i;t0trxoio3ou4olenmfvsl() Dur(  oo0oltnioeiyd mDea( ont)alenmrctytfaDe ies t)s2um(mpiydlmtnmnvsltf rrm(  ou0aeenmo3tysfm ulumo u0aeenifciatfa raneilt) etmxr3iudlmenlnvtl()s2tmumoot0aex mociltlaDelumont) lxnioctadlp  ai i;s teumirpiu4ol nmies s)s2urxm ;u0opt  feilslaDumnvon(4 lxrmrcoodlmDelivs (0tetrio iydaltnlfeiatfsDtm(m ot1oee mieildfsDrluvpnu4trtnio3iydlmD  u i;s0 rtoiopoo4ol   iet sfa2ua(  ;t1aetoioetas m ean o;()arxnir3ia1om e i i ()seurio nu4amtemfvils  rtm( ono0tptoifetydlmDumnvs u0arenxf oodomt lueilt s2xmiopoy4omee fvia( s2tr(m ou1opxoio3iysfm emuvp t)alxnxr3iotlmt  u slt0 rumir3iu1lle lnvi (fa2rmx  nu0tpt  o3iyt s2em( pnu4tetrxr3iydfa   uei;()srumxm nodome  ivi s s2umump;t0oeen fciyd m2ra(ms u4 lenxf3iatoaDeanvi t trtm(o oudal e icilt aDta(moou4olenif3iadfm um(vp t) rxnmo iy1omD  nvols0 2toim iu4amtnlfvsasf Drruroot4aetn o3iytfmDulu pnu0arenmoctatlmDelues s0 rtrimpnu1aleelfcs s)aDrmu  ;o0olenmo3iltfs2uluvsn()tlxomo3ia1fptraivs (0texr(m3iydll elnesas s2tr(m nu1ape miciat aDumnmpnu)altoif3iytlm   ivo t0srumir no1ol e netat)aruru onu4tltomiciyt sDrlu on()teeoxfcty1omteaiesls seumxr nu4op e nei sfsrrru  ou4aetn fciltfs elumpn()tlxrxo3oadlpD  nvi;(  rtoxr nodopeelfct t) rtm(m oo0aee iicilt sDrauvs t) etnmocio1fp   i s;s t2ur(m oydlp  lnvia(f Dtr(r ;t4opxomi3tatlm rlump;t0aetrir iytomD an i;t0 2urim3oo4ale  neil( sDrmx  ;o4alt  ocilsfs eluvont0texrifcoytoa raivs;s) exmir3iodamte ics ( arrmu  ou1olen ocilslm em( o;t0aeenxo totfaDeln s t  rum(m3oodaltemfvtls)sDuaxmo;u4tptoioetadfm uan pn() lxnxo tadfmt au o s0 2tr(mpiodlptnmict t) rtmxmonu0texnmfetlsfmDean o;t4trxrmr totom  au o;s  rumxo3nodom e ivt s)artm(r nu1opx mo3iadls rlu s;(4trxoir3iytomtran i;t t2xoimpoy1om  lfet tfsrumx  oo0tle iicildfa2uluvpnu4arxrif io1om e nvs;()t2xo(opiydlmtnlnvia( s2tr( ooo4olxomo3ilsfmDua(vp;t)altnmo3todfaDelivs;t)t2xm(m oo1altelnei (fa2rmxrp;u1aetnmf3iyt sDeauvs;u)tlxnio oa1oa rauei;( seurxr3oy4lmeelivilt s2rmxmo;o0oet  i3iltlm2eauvs u4teeomfcoo1opD li ol(0trtrxo oodlltn ivils aruru o;u0teen ieiat a uanvo;u)arxrmr oydfmD  u s (0teuoxm nu1omee nei () 2ta(mpoo0oee ifetysfaDemu s;() etoxociotlmtraneol()teumio ou1amt lnvtltfsrtau onu0aptn fctyslsDrlump;t)arxrmocoadoaDelivslt0srumimpnudamenlies t)sDrau  nt4altn f3tldlm rm(mp;t)tltrmrciydomDe uvs;s texrir3nodolenmfvt ()a2rmxro;o0tee mfeiyt mDumump;t)alxrif oa1la elneils  2xmio ou1apt lnctas)aDrr(  nu0apeomictlslaDrlnms;u4trtrxr3oo1omD  nvolt)seumir3oo4om nlfvi () 2rr( ont1aptoiociatlm2em(msnt) lxrxrctadfa raues;t trtrimpou4al  lfcias  rrr(ront1tltn ieiytla2rau sn(0 ltrxo oo1oatrlivolt  rxmim iu1lp elfcsasf Dtru pno0tlenmfetadfs2rmnvs t0 rtoir3tadoa  au olt texoxm3iudlltemivtlt aDraxrpou1alenmfciytfs2ea( pnu4 lxrif3oytfa   ies s sexmir oy4lmtemfet sfsrra(rpno0tpxomfctasfs ulnmsnu) rxrxf3tadla   ivslt)srxo(m3no1olee ivta( srrr(mpou1aptoifeiydfmDeau s;u4artrxfciadopD  ueo s trxoxrpiudom  lfeiat)arurum nt0olt mieilsfa uln snu4 ltnxf tytlateaivs s t2uoiopoo1lpe  nvsa( aDur( pot0aet io3tldla emnmp t) reoxr iatfmtr iei s0t2xrxo ou4lp nmncs s aDrmu  nu0texomfeiadlmDran p (0tlenxo todlaDeaueils srtrimpiy4ap e fvtl() rrau onu4apx io3ilsfs ulu sn()trxoxr3tytop ranvo;s0trxo(m3iydom elictat aDuax pou4tltnmoeiat sDelnvo u0tlerxf iy1fmt  nvo;t t2xoir iu4ome lfvt tf ruau ont0altoioetytlaDul(vs t0artrmf iydlpDe nesl()setrxm ou1olee iesltfarum(m ou1texniociat a2rauvo () etomr3iodomDeluvol(0truo(r3iy4al   ics tf Dtaxm no1apx mfetadla2elnmp u0 etrxf3oodlmt auvs s0t2xmio iodaleelivi (f 2umxrp;t4ape if3tld s2ra( o u) leniocia1opDrai sls)s2trxmpou4ll  lnvsat  Drru pnu0oexoii3tasfmDemnvs;u)areomo3oadlptrluvs ()setrirpoudol nlivsa() 2rm(m ot0oeenmo3iytfm2ran p;t) rxoxr3oadoptr u s;t)teumxr3nudlptnmnct t  Dua( pnu1optomfetlsfmDumnmp (0 etoiociytlp e uei s0 2um(o3iy4omeelfes (  rrrum nt1tex mfetatlm rlumon() lxrio iatfpteauvo;(  2tm(rpoy1am   ivia()artrxm ot1optniictydls2rmuvsnt4aetomo ootfmDr ues;s)sruoxopoy1llte nciat) rrru o;o4tpt mieiltfm ea(vont0trxnmf3oa1lmtrli ils0tetrxm iudomtn ivsa()aDrrxrpnu0ape  f3iytls rln p (4tlxrmo todfpD ln slt0trxm(m ny1lmen ict s artaumpou1tlx  fciaslm2rln s;() exoxf oydlmtrlneo;t0 rtoxr oo4lpte nvs t) rra(ronu1apto f3tldlm2em( pn(0aeeoiociodfptelies;(0seuoxmpoy1ole lfeiat srrmu p;u0teeomfciydlmDrlums t4 exomrcoo1lm rauvil() ruoio3oodopenmivtlt sDtrx ont4tltoio3iad a2rl( sn(0arxnmo oadfaDe ues;()teuoio3iodol elncsasfsrrrumpnu4oltn fetadla2umn p;u0trxrio tadlaDeluei;()sruo(r iodop  lietas) Duax  ou1tpe iieiytfsDeaumpnt)alxoxf iytfm  lnvols srxmxopnu4lmtemietlt)arraur ;u1oeeomoeilslsDuaumpnt4 eenmf3ootoa  auvo;s)srxoir3oo4ope  fvias s2tm( pot1tlenii3iat mDrmnvont0altoxr iydlptr u olt truo(r iy4lpe  icsa(fsDtaump;o0tlx ioeilt s rlnmp u4teermfctydfpDr nvs ()s2trxrpno4op e fcia() rumurp;t1optomietat s2ra( p;(0trxomocoydom rlivsls  2uo(o oudlp   fvtlsfartrx p;o4oeenmietld sDelnmo;t4artnxr oodfptelies (0 2toir3oodlpe micilsfsDtm(mpnt1opx  f3taslm2ean pnu4tltrxfctytlaD aueols trurxr oo4optnlnei (faDurump;u4opto fetadfmDeanmp ()alxomrciodoat anvs;t0 rxm(o3ny4lm elfvsat aDumxro;t4tetn i3iatfs2ra( s t0tltnxo3tytfmD anvolt srtrxm3nu1lm  lfeta()aDra(  nu1tetoif3ilsfsDem( o u) rtoif3iytlmt au i;t)tetr(opoo1ll  mfes s aDtmumpnu4opxnmiciatlm ua(vo;u0tltrmo iadlp eaneo s  eurio nydlpe  fvilsfsrtmumpnt0olxnmfciytlmDraumonu4aexnmfctotfmtranvs s s2uo(m ny1oleelfvia()srrrxm ;t4oexnifciatlsDeauvp;u0 rtnmf3oatlm ranvs t) ruo(o3io4lltemfet ()aDumumpou1tlenmoeiltlm2ra(mp t) renio3iy1oaD anes (  ruoxm3nydopt mnet s)aDrm(mont0oetomo3tys s2emnvpnu0teeoxfcoytfat  ues;t)s2umir io4lpe mfei s)srua( p;t0tptnmociatfaDrl(vp (4 lenxr to1om  ai i t)srxoxr3ou4am nlivs () rtmx ooo0oltnmo3tyt m2rl( p;t4 rerxf tytfpDraieilt  2xmiopiy4ll elnvil() 2tr(mp;u1tptniieiasfa elnvp;(0aexnxr3iadlpD livolt0 eum(r ny4open ivt t a2rau ooo1olxnmi3iytls2umnvs u4 exnio oo1fmtelneslt  ruo(opou1alt  nvs sfsDtaxm ;t1oexoii3iysfmDulnmpnu) rerio3ty1laDranvilt) 2trxo nydoleemnetlsfs2urxr no4aetn i3iatfm2rlnvp;t4aetrxociotlm e n s;(0 etrim3io1omee fes t s2um(m no4tpxn i3iyt sDem( o t) rxrxf iadlaD  nesls srxo(opoodlmtelivias)arur(m nt4oet  i3iat a em(vo;t0tlxrio tytfm   uvs (0teurxr3nodopenlfeiltfsDur(rooo0opeo o3ild m2eln p;t4 eerxr3iatfmD  u il() exmimpnudapeelnesls)a2ta(ro;u1oexn i3iys a rlump ()alxoxoctytoatrlneol( tetmim3iy4am emfviatfartm(  no4opxn fciasfsDulnmo;u4 ltrmrcoy1fp  luvo;( seurxr oydal   ncia(  Drrx  oo1aee ifciytfm2ul(ms (4 leriocty1omtrau sl()trtr(rpiydaltnlietas s2tm( pnu0oetnmfetlsla2uln snu)aexomo totop r uvi t  exr(rpiy4amtn fet (farum(ronu1teeo o3iatla ean p;u0 rtoif3oadlatr i o s trxoxr3no1olenlfei sfsrrmxr ou4oltomoctydfm uanmp;u4trenir3io1omD  i sls  rtrxr3iodameemfeilt srtaur no0oex iieiys s2rau ont0aexomo3iatfpDran i;s setr(m oydlmtnmivsas)arrmxmonu1oetnmoeias aDumumo;u0 lxrxf oatfp eai ols0 rto(m3oy4omeemictas)arra(r nu1aetniictltfm ulnvs ()alxrxrcoo1lm eai i t t2tmio3oydlmtnlivt t a2uax  ot4olxomiciys a2eluvp;(0tlenmf3oa1fa  luvi t0texm(o3nu4ome mnvsasfsDumumpno4tlxo o3iad a2uau p ()arermo ta1fa eanvsl( trurxo nu1altn ivsls sDumxr ;t1aet  o3tltfmDrlu p ()artniocio1lmtr ivols)srxr(o iudomeemfcslt  Dtmu pou4apeo ieilslm ra(vp;u4altnmr oytoaDrluvil() rur(mpny4al e fvtl(fa2rmxr ;o1tlxniieiydla2umu p u)alerxf3ty1oaD lnvs;s0texmim oodlme lfes ()srumurpnt1tpxn fciat s rmn ont4aeermf oodfp  ln o;t)truo(o ny4ame lnci ()srum(  no4aexo o3iatfm2emnvp;t0tlxoif3ootfp elues s0srur(mpoudomeemnci (fa2ur(rpnt0tltniiciatfs el(vp t0 lxniociatlpDrln o;t)srumir3oydapee ict t s2tax pou4aeeoiiciatls ranms;u0trerxfciatoaDrln i;t srum(o nu1opt mncsl(  rua(mpot1tleoii3ildfs2ranvpnt) ltomf3tatopt lies;t0 ruoio3iy4aptelnvil( sDtr( pot0aptnmieiltlsDrm( s () rermociydfpt  nvi;() eum(r3nydolenmfvi t sDraumooo1apeo f3iltfm2uau o;t)arxrmo oodopte neols0 2tr(r oy1lp elnet s sDrrx  nt0teeo iciasfmDelnvont)tlxoxo3ta1opDr ueo;s srxmio3iy1lp n iciat)srtaum no4ope mf3iasla emuvs u4aetnxf3ty1laD livslt srxmxm3oodapeemnesa()aDtmxro;o4tpt iiciltlm uln o;u0 ltnmrctatfaDrluesls) rtrim ny1lp   fctas aDtrx ont0optomocilsfsDuau s;u)aexomf3iydla elnvslt)sruo(mpno4ame lfvi t)srtaxr ;u1alxomiciadlm rm(mpnu4arerir3todoat lu o;(  exrxm nu1alt mieiatfsDum(rono1oeeo o3tat m ua( p;u0tetrxocoatfm  li ols) 2um(r iodaltnmivslt srtaxroou1aptomoeilslm eauvpnu)trxnmo tydfpteaivsls) 2xrxm oydlpe lnvtltfarrrumono1teen ictlt mDulnvs;()texrmf iatlm elies s0s2toxm ou1lp elfes sf Dtrx ooo4teeomf3iyd sDrl( snu4trtnir3to1fptrlivo;s0s2urim3ou1omt mfvil()aDtmxmonu1tetoiiciadfaDumu s;u) exrir3oatoa r uvols)t2urim3nudap elfcs ()srta( pou1aeenio3ilslmDumn ont0 etomociotopDr ies;t teum(r3iodal  lnvsatf rurur oo4alen oetys aDrl( p;t4artrmr3to1oaD luvi;s s2tm(opny1lle lfviasf rtr(ronu1tlt miciytfs2um( p;t) rtnmo3tydlp rlnvols)trxr(m3ny1ol n nvs tfarur( oot0alxoioeiydfmDel( s;u) reomf ootom r u s ( teumxo3oo4omtelnvt t  Dtaxr oo4teenioetlt a2eanmpnu4alxnxr tydlmD  n s;t trtrxo3nu4lmen ivilsf Drrxrono4opxo oeiysfs uanvo t4areoxfciydlp   ivils) 2urimpny4ol e ictl(  rtm(r oo0tpxomoctas mDel( p;()tlxnif iatfp e n i t0tetrxopny1oltemnet sfaDur(roou0openmieiadfaDrlums (0altnxfcoydomtrlues;t) ruoxm iudaptemivias)a2um(mo;t1tlxomo3ias a rl( s ()texnxf3to1lpteanesls)trxo(r3oudopenlfvsl( a2uru pot0aeenii3iasfm2rmnvo;t4aetomo3ootoaDe ues s)teurim3iu4ol n fcilsf 2uaurpnt4ale ioctysls emumo;(0 lxnmr iydlat luvs s  rum(m3no1lpeelfetatfsruaurpnu4optomfciyslm2ea(vp t) rxnmociadfaD an o;(0 rumxm iu1lmtn ivtas)s2rmum no1open i3iyt a rl(msn(0trxoxf3tatlpD ln ilt)teurxopno1lp   iet tfsDurxr ;u0tle  fctas a ul( p u)altoxo3to1lmD lu ols) 2xr(o oy4lme  ictl(  2um(rpnu4oeeoiieils sDelumo t0 eenio3to1fpteauei s  rxrio ou1lm nlics s) Dumurp;o4aptn oetltfs2el(mo t4tltnxr3iodfmt  i i (  2xmim3nu4lp  lnei t)artrurp;u4apxn i3ilsls2rluvp;u0 etoifciydlp eaieo () rtrim oodopenmivi sf 2ur(mooo1alenifeilslm um( s;t)tlermr oodlaDe nvo t)s2uo(r oy1lpee ncsat sDtaxro;u1tptomi3iydfaDuau o t4tltnmfcoy1op  ln s;t s2xrim oudomt lieilt)s2tmur no1tpe mi3tls s rlnvs;t0 etrxo3iotoa rluei;t)s2trxo3oy1lptn ies s)aDrmum no1alx mieiys m2um( o;u)alxrir iatlpteaieo s)srtmxr iy4alenlfcsls s2um(  ;t4tlx  fcias a em(mp u0tlxoxo tatfatranes s)sexoir3iy1ll  lfes t) Draumoot4tltn o3ilsfa2rluvsn()tltnifcia1lm   ivi () 2xo(m nodlle lfvtls  2ua(mo;u0oeeo fciadfmDrm(mpnu) rtnifcoodlptranvils)t2uoxopnu4omt lfes s)artmur no4apt ifetas sDrm( onu0tleomr todoat au o t0 rtmxmpnudam e feia( arraurpot0aexnio3iytlaDra(mo;() exomociotfpte nvo;s srxo(r ou1openlicias  rum(moou0tpx moeiysls ranmont4tltomr3ty1la r uvol( teurxrpoo1llte feiasf rumxroou4alx  o3iydlaDemn pnu)tltoxrciodoa rlues s  rxo(rpno4omt mfvi t)sDraur no0tlxnifeiatfsDulnmont4tleoxr todlmtrln s t0t2to(o3ou4lltelfviatfs2tau ooo4oeeomfeiadls ra( p;() lxoir oodfmt an s;(  eumxr3ou4oltemncsas srum(mp;t0teeomfeilslaDuanvpn() rxnio3oa1fptran s ()trumxopou1ame  ies (fsDumu pot0aeen ieiadlaDumumsnt0artrxf ty1omtrluvi;t0 etrxr io4apen ics s)srrr( poo0optoiietyslmDua( ont) lxnmocootop eln s t) 2toxr3oudllt mnvs t)srraur nu1ole mfctas aDra(mo;t4 rxrmrciy1lpD lu ilt) rxrxo3nydlmtn iciat)srur(mono4tptoifetlsfmDemuvs;t0 eerir iatop   uvsls texoirpoo1olen nvtatfsrtmumpnu1tpe ifetytla ua( onu0trtrmr3ootfpte nei (  2trxr3no1op  lnviltfaDur( ont1apenmo3tltlmDeanmo u)trxoifcta1fpDeau o (  rtmim oy4op elfcia( s2ur(roou0oetnifctld a2ul(mont4 etnxo tytomt lu ilt0 2xrimpio1altelfci tf Drmum nu1alxomieilsfa rlnmp t4artrmr oodlmDe ies t0srtmim3oodole mnviatf ruaxrpno0teto o3iatlaDeln s;u)arenxrctadom   neo;t0 2xr(m ny1am nlnet ()a2rrxrpou0teeo ieiad s2eanvonu4tetrxo oy1fpDr ieols0s2xoxopny1ome  ici (  2rmx  nt1tpe moctasfs2umuvs t) ltnxfcoadop r neilt)s2uo(mpoo1ol   fvs s  Dum(r ;t0optomoeiasla2emu pnt0aetrmocoa1oa eau i;t  rxrim iydllenlfvilt  rtmx ooo4oexoifciytfs2em(vs u) eerxrcoytop rlivs;s0teuo(o oudllenmfcsat) 2rm(r nu4teen f3ilt sDrauvonu)teenir ty1fpteaiesl(0sexmim io4llt mncta( sDtaur nt1apt ioeiys a umnvs;t)artoxociodlp r ivo t) rur(opoy4om  lfcsas aDrm(  ot1opt io3iydlsDran snt)tetrmf iadlpteanvo;t)sexmxo iudal n nviat s2rmxrp;t1apt if3tld m2emnvon(4alxnifciadoaDrluvs ( srto(opoy4omtnmnet (fsDrax ont0olto f3iltfm2emnvpnu) rtnxocta1fmD ai il() 2xoio iydolenmiet t)arurumpno1apeomoctadlsDemnms u0aetnxr3ta1fmDr ivi;s)s2tr(r oo4opte nvs s) rrmx  ;u1ape moctysla2el( s;() rxnxrctodoa  lieolt)sruo(mpoy1om elictls) 2ta( pou4apxomoeiltlmDulnvp;t0arxnif3iatomD  nei s  rxmxo iu1lp  mies t) rrmxro;t0ape ioeilt m ra( p;t)trxoir tydoaD lu i;( s2umim io1ole lnvt t srrr( o;o0tlt  iciyd m rmumsn() ltnmfcoytoat li i s)t2trirpnydlp  miesatfaDtrxmont0oeen icilslmDrluvs;t4 exoxo3ty1fptraneo;s t2xm(rpoo1lmtnlnesas)srurum nu4tltn oeiltlm2rmn o ()alxrmrcootlat  nvilt trxrxopnodapt mivs s)aDtmxr ;o0opxn ociltlm ranmo;u0teenxo3tydfaDeauvilt)tetm(rpoy1ll   nvsltfarta(mpou4tlxomo3tyslm2ulnvp u)arermociy1fp  livs s trto(m oy1amenmfcia( arrr(mo;o1tpt mf3ilsfs emn s;u4aeeomo3tadfm raueo s s2xoim ou4altnlnvtlsfartm(r ;t1altnii3iydlmDulnvsn(0 leomf3iydomt luvol( t2umxopiodome mneta(f 2taur ot4opxn oetydfs ra(ms;()tltomrcty1op   uvsl(0srur(o nodapeelivsa() Dur( o;u4olxnioeilsfmDrmump u)alermr3oadlpte ivs;t teuoxopnu1am nmfciatfsrurum ;o1tpeoiiciys s rmuvo t)altoxo iydoatraivil( srto(rpno1lpe  fctls aDra( poo1ape iieiyslm2ea( o;t) rxriocoatfa elu sl(  exrirpiydlptemfct sfa2tr( o;t4tlto iciad aDrln o;(4trtrircoodfmD ln slt0teuoxopou1llt mnciatfaDum(mp;o1optoifeiytlm2um(mp;u0texoiocootfpD  iei s)t2ur(opoy4lpt  fciat  2rru ont0apt iocilt s2elu p t) renmf3tytfmt anes;s0 2xmxr3oodlmt  nes t)a2umu  ot4alt ioetlt a2rlumo;() lenir3oatla r u ol()srum(r3nu1opt  ivi t srrru  ;t1ale  i3iltlm2ul(ms;t)aexrmrcoo1lmD lueil( srxmxo oo1ap  mnes t aDum( pnt4altomictls s rmu o () lermr tadfateaueils  2xoxo ou1oleelnvtl() 2umumo;u1aee moctltlmDrluvp u)tltoxo io1op ean olt)s2tm(r3oudop nlicsa() 2tm(m ;o0tlto o3ils a rlu sn(4alxrircoatlatrau ilt)tetmio3iydaptelnciasfsDra(m ;o0aexomi3iad s2rl(msn(0tltoir3oydlpDraivsl(0 etmirpou1om  mfcsls s2tmxm nt4aptn f3iltfmDemumo;(0arxrio3iadlpDe ueo;t)trxo(mpiudale mnei ()arraump;t4oleoifeiytfa2ua(ms;u0 rermr3oo1lptrlivo;(0teurimpiy4op n ici () Dtrxro;o1alx iocilt aDrlumpnu)tltoifctodopDeai o t0s2xmxr3iu1opeelneta()artr(r nt0tltnifcilsfmDrau p;t4 eeomocoa1lm   nvs;t0s2tmim3oy4lpeemnvsls)artmur ;o0tpxo o3iltfaDeau p;(0arxniocto1oa rlues s)s2urio oydam n nvil(f 2tmu p;o4tlen o3tyt s rlumo;u0 etnmo3oa1lmte i i s0srumir iy1ole lfei t)sDuaurooo0tptomi3tyd s uaumsnu)arxnxf3tytlateai ol(0 2tr(m3nu4lltn icsatfsrraumpno0tpxniocildls ea(vo t0 eenif oodlat  ieo (0 exr(m oo1ap nlnvs tfs2tm(mp;u4oleomi3iatla2eluvon(4texrxociy1lmDe ivi (  
\ No newline at end of file
@@ -0,0 +1 @@
+ueslt0texmxopno4am e fvt tf Dra(moot4opt ifetas m2eln pnu)trtrif iodoa   uvi;t srtmxm iudope  netl( sDrrx pot0ope ii3tas m ea( s;t0alxnmf3oa1oa  luei;t trxm(m3oo1oltnlfctl()aDtaumpou1oetomoeiatfa uan snt0aexnxo oodfpDr uvils0 2uoxo oy4ol e fcsas) Drmxrpou0tpenmoeiytfa2ran ont)tlenmr3oytlatr nei;s)trxoxr3iodlpe lfvi tfaDrax pno1alt ifctls a2emn snu)treoxf ia1opt an ol(0trxo(o3nydolee nvtl(fa2um(m nu0tlxo ictasfsDranmsnu)altoio3iy1fm r u ol(0seurio oy1lmtnlnviltfsrurx  ot4apxnif3iadfm2rmuvonu) exoio ootlpD liei ( s2uoir no1lptnmfcs ()srrm(r ;t1alto i3tld aDelnmo ()tetrmrcootfm rln i;s0t2xm(rpoudlpenmnci (  2ua(  ot0opxniieiys mDua( o t)alxoxr3oodfpDeaieil(0tetmxr iu4op emfcsa(f Dtaum ;o0apx io3tad aDuau o;()arxnio3iodfp rlu i s t2ur(o3nydap e fcsltfsDta(  ot1tleomfctaslm rm( snu0 rxrmf3tatfa eaueo (0 ruoxm iu1omte fcs tfsDtax poo4ope mf3iys m2ranmpnt0alxomr iadom  auvilt s2tmio iydll emfesls  2rax pnt0tetnii3ildfa rl( ont) rxoxo3iodfmtrln s s)tetoxr3ou4lme lfcils)aDur(r oo1aexn f3tltfmDemn o ()aexomr3iytfaDe u s;s0texo(opnodaltn nci sfsDrmx pno1aexniicildlm2ea(vo;t)trxoxr ia1oa e u ilt sexo(opny1open iesl(f 2tax  no1aeeoioetat m2ra(vp t4aexrxr iodop eaiei;() euoxr3oo1llee ivsl()s2uaur ;t0oex if3ilsla2eluvont)teenxo tadlat ln s t0s2um(m3no4apee nesls  Dra(mo;t4aet ii3iltfsDemuvp;(4alxoxo ta1lptr ivi;s0 2um(r3iodopen feta()s2tau  oo1opeomfciytfa eau s ()altrmfciytfat aieo;s) ruo(r ny4aptnmict ()sDtr(ront1aptniociltls rauvo t0artnxociodom eanvi t0t2tr(r3no1lp nmivt tfa2taump;o1tlxnio3iydfm2umumo;t)altnif to1om  luvsls)t2to(o3oodllenlncsas)aDum( oot0oeeomoeiadfs rlu s () lxoio3ta1fm ranvsl( setmir iu1lpe  nct (f rrm(m nt1tlen fetyt s raumo;u0tltrmr oadfat aiesl()sexmio nu4ale mneias a2tmxm nu4tpto f3iys aDum( pnt) ltrmfciydfmteauvo t teur(r io4aleemici t)aDtmu p;o1apt mo3iydls2ra(vpn(0treomocty1omD lnvi;s0 2urxopiu1ol n nvsas sDrrur nt1oeeo i3ildfsDra( p u4alxrio3todfmtr u s s)teumio nudaleemiviltfs2tmu  ou1olxo i3iysfs ranmont) rxnmf3iydlmDr nvils0srxm(opnu4llenlnetat) 2rr(ront1tex mo3tyd sDua(vsnu4artomf oytfat auvo;s0 exm(r oudlpeemieiatfsDur(r ;u4oee mf3tldfa uauvo () lxoiocty1opteai i;s trtoxo3nodamtn nes s) Draum nu0aptniieiysfm rl( s (4 ltnxf ootoa raivi s truoxm oo4altnlneia( arurur nu1apenifcils mDra(msnu4teeomo3oo1la rlivsls)setmir iydom elfci (fsDrr(r ot1teenmictasla2rauvs;u0aexnmocoytfp elieo s0tetrxm3nodlm elicslt) Drrxrpnu0tee ioctasfa rlumo;t4 lenmocty1lpt lu o;( srtm(o3iu1ll nlnvtl( aDumurp;t1aetoif3ildfs uanvon() etoxf iatlaDr uvi;(0t2xrir3no4lp e nctlt)srumu onu1tpx mo3ias s ra(vs;u)altrxr3oatfaD luvo;t0t2umim iu4ap nmivsls sDtmumo;o1alx ifeiyd m rl(mp;t0 exrmr tadfpt  neil( texrio oy4omeelicsltf Duaxrp;o1tle iociydlmDeanmp (0 etoxr3iodlat  ivo;s0setmxo3iy4lpenmfeslsfs2tmu ont4apxomieiatfm2ranmo;t) etnxf tydlatrlueolt0sexmim3io1oltemivi s  ruaxronu1apenmf3iatfs2emn p t4tlxriociydla eauei ( srtoxm3ny1al nlnetas)a2urxm ot1ope  fciadfs2ra( o;u) rtrmr totop eli s ()t2xo(r no1ope  nvilsfaDurx ono1tlen f3ildfa2ua(mon()arxrircto1fp   n s;t seurio ny1aleelnet t  2uaur ot0apeoiociydfaDemnvpnu0trerxfcta1lm  anvo;t) exoxrpoy1am nlnes ()artmxmpnu0oee mo3iyt mDulumo (0 eerxf oytlmt  iei;t) 2ur(mpny4ap emfcil( sruax  no1oleoif3ildfsDea(mp;(4 rtnxr3iatop e ivs;s0t2urxmpoydomeelfvt s)artrxr ;t4tex io3iys a um(vont0 exrmr3iytla r uvol(0 rtr(o3ny1lp n net t aDur( pnt4oexoifeiad aDrmnvo t0 ltnmf iotom   uvsl()s2xr(mpnudape mivsat)sruaxmpot4aet mfciad mDuanvo;t)tetrir iytfpteaies s)s2trir3iy1omenmivt t)s2tm(r nu4aexomf3iltfm emu pnu)tlxoxf3tatfpDeauei s) rtoio3oy4ll  lnct (fsDurxr no0apenmi3ias aDemn pn(0 renmo3oydlmtr uei t0 2tm(o io1om   ics sfs2umum ;t1tet mietyd a um( s t0alxrif totfmt ln o (0teur(m iu4ale mnvsls arur(moou0tlxn ictatla ul(ms;(0trermocoatopt livols srxrim oydlleelfetl(farua(  nt0texomfeildla ranmo;() etrif oatlmDrau i;( t2xmiopiy4apte iei (f Dtrumo;u1altomoctyslaDrauvp u4artrio ty1fpDrauvs;() 2xrirpoydlle mivtlt) Dur(  no1tpt  fcilsfa2um( s;u)teermo3iotom  ln i ( tetmimpoo4lmtnlneil( aDtm(moou0tlx ifciasfm elu o ()tlenio iodlmteaivslt)sexm(m3ou1apeelncsl(faDumumono4oex moctlt sDrm(mp t4tlermo oy1lmDeln o;s trurxopoydlme livsls a2urxm ;u0aeenifctyt a umnmsnu4 rerxf io1lp eaiei s) 2uo(r iodamt  fci t s2tr(  ot1tleniieiadfm eluvp;t0arenxf tadfmt ai i;t trumxr nodol   fct s)a2ua(rpnu4tltnmf3iltlaDrl( sn()trtrxf oy1lmDrauvi;s0 2tr(m3no1lpeelnvtas) ruaxmpoo1ape  o3tlt m uan sn() lerxf oodlptr ivo;t)s2xmxo iy1ll eliciasfsrumu  nu0tlxnmfetyslm2rl( ont)alenioctatla   u s t0 2xo(r3no1llenlict s arurx pno1oexomfetld s eluvp u4 renio3oadfp ranvol(0trxrxm iydop  mieiatf 2rm(root0aeeomoetytfm2ranvpnt4tlerif3iadoa   n o;s0trxmxopoo1altemieta( s2ta(r ;o0olt mo3iytlmDea( s u0 ltnirctodlaDe ieilt0 exmxmpiydomenmietl( aDrru  ;t4apxn ictys a2elnmp (4aetoif3oodopt  iei s t2xmimpoo4oltnlfcslt)sDum( oou0olxn o3tltfs ulums t)teenxo3totfaDelies;() 2trxrpoudole lfei ()a2ra(rpoo4aetnifciyd s2ea(vo (0trenxo iotoaDraneilt)trxrirpiy1aleemfci (  Drmxrpno4aetnmietlt mDrln o t4alxnmr to1oat lueilt0s2toxo3io4omt licil(f rrru p;o4olxnmieiysfs elums;t4 etniociydlpDraivi t0srurxm oudap emnci (f Drm(moot0ole iicilsfaDua(vp (0texnxf ty1lmD  neslt)srxmirpny4ale  nei sfarumxrpot1apeniicilsfmDumumsnu4trerxo ty1lpte nes t teurimpou4lpe mfcsl(f 2ua(mooo0tpeoifeiysls uan s;(0 rtrmocia1lm  an s t) rum(o oo1lleeliei sfa2uax onu4alxnif3ildls rau p;(4trtoxfctodlmDeau sl()setrxo3oudlmenmncs s aDua(m ot4tpxn feiydls2em(msnt) eeomo3oo1fmD luvol()srxmxrpiu4lp elfcslt) Drr( oot1aet moctltls ra( s;t4tlerxo3tatfate ieo;() etoio iy4olt lnvtat)s2tmurpno4olxoioeiasfs2um(mp t4 lenir3totomteaueols  rxr(m3oudomenmfctlt) 2trumo;t0tle mf3tatls2em(vonu0tlxomr todoa rlivo;t)sexoxo ny4lpeelnei ()srtrx o;u4ope mociatls ulu p u0tetnxfcoo1fptr uvol()s2tr(r3no4alee nci tfaDtrumono1oee iiciyd s2elumo u)treoio oo1faDe iesl( teuo(m3iy1am n iet t a2rr( pnt1aeeoif3tld aDrluvo;t0artnmrctydopteau s;(  2trxrpoodlleemncia(f Drr(  ot0aptomfciysfa rau pnu4aetrmf oatop r ivi;t srtoxr3ny1al  mneiat artm(rpot0olto fetatls eanmo;t4aetrxf iydopt  nei ( s2um(r iy4alt mfeil(  2raumont1tpxomfctlslsDrlnvo t0tetomoctydlm  ai ol(0 rum(m iydamee icia( sDtax  nu0tet  i3iadfa2ean onu4 ltoxr tatoa  an i s0 eurxm3oydomenlivsltfa2tm( pot0opx mfciatlaDel( o;u0tetoiociy1fmDrlnei;(  2umxrpoudlleemfctas a2tmuro;o4alto o3iat sDuluvp u0 etnircio1latranvs;s0trtmxrpou1amt lnet t  Dtaxmono4olxoif3ildlmDum(msn(4 rxoir ootom  anei t s2umxm oo1apen ivta(fa2rax pnu0openii3iys s2um(mp;(0texnmr iytla eli i;t0 exr(rpiy1ame licils)sDuax  ;u1olxn f3ildlmDul(mpn() renir3oydfateaivsls0 rxmxmpno1am emnci ()sDrr(ro;u1aexniociltlm2uln o t0trermfciodlm rai sls t2ur(rpiudam emnvta()s2rr(rpoo1oexomociytlmDra( pn() rtomf to1lmteluvs;s)texo(r3no4apee ncia()srrr(r oo0alenifciysfmDemnvo;t)tltrirciytom   i ols) eto(mpny4amenlnct sfa2tm(m ot1tpxniietys s rmnvo;(0trxoxf oy1fmteli ol(0s2umxo3oy1oltelfvsatf rumxrpno1aexnmociadfm2rau p;(0arxoxr3oytfa  lneo;s setrxm nu4al   nctat aDrm(mpnu4tee if3iatla2ulump (0artoio iodoaDrlneo;t  rto(rpno4lmee nct ()aDtr(rpnt1aptnmfeiysfmDem(mp;u4 rtrxr iytlaDelieo;() rtmxr3oo1lpe mfvs (fa2ra(m no1oetomfeiyslmDumumo t4aeenmr3iy1lmte neo ()t2um(rpny4llt mfcta( sDrau pou0tex  fetasfm umuvp u4 exoiocta1lpD  nei ( trxm(opno1aptnmfetlsf rtaurp;o0tptniicildfs rl( s (0teenxrciytopDeanei;(0truoimpiydlme  nctatfsDrmumo;o4tex  iciytfsDumuvs;t4 exriociydlpt lies s  eur(r nydlm nlnvias)s2ua(m nt0alenifcilslm ean onu4alenif iytlm eluvo s0t2trimpno1lpeemneias  2rmxront1oetomfctaslm2eln s ()teermociydfpD li s;s  rtmxm no1al eliesas aDtm( ont1aptoio3tatlm2uluvp;u0 exrif3iydfaD  uvo s)seto(mpoydapen nvsas) Drmu ono1alt  oeiytfa2eau onu)tetoxo3tytomt ai s;t srtmim iodlmeemivtat) Dra( ono1tptomi3tltfm raumpnt4trtnmrcta1faDeanes s0seuo(m3oo1lmt miciat  2uaxrpot0ale mo3iys m2ua(mpnt0alxoircta1fa eau o;t)s2uoio3ou4lmen ncilsfa2ta( oou1ape if3iad m rl(mp;u0tleomf3totfa eaivolt0sruo(m oy1open ivs t)a2ta(mo;o1apenmieiad sDuau ont0areomo totfa ranvs;s0tetrxrpiudale livias)sDuru  oo4oexoiocils a2rln s (4trerir3todfa   nvsl(0texoir io4ol e netat arta(mo;o1oet  f3iadfmDulumo;(0tltrmo3iodfpDe nvi () rurim ny1oltelivils) 2uax oou4ope  ietytlmDrlnvonu4tetrmf3oadfpD an sl(0t2uoxmpoy4lpee nvt (  Dta(  oo4apt io3iytfs2uanvs;u4artnir tatoa  livo;( s2xoirpnu4ape mfvtlt srrmu  ot0oexnmociyslmDrmnmp (0aetoir tadfm rlnvils)seuo(opou4ll  lfeta() 2uau oou0olxnif3iytlsDulnmsn()treoxo3oodoptrlnvi;(0texoxr ou4lp emfvsa(f 2rmurp;t1tpt mfeildls2rlu s u)alermo oatlat  neilt0trxrxrpiu1opt mncs () 2urx ont1altn i3iyd sDumumon(0 lxoio totoaDe ivs;t)t2to(m iudapen nes (f 2ua(r ot1apxn o3iadfaDrmuvs t0areomrcoytoaD  ivi () 2uoxm3oo4lme  fetatf 2tmu oot4aexo feiys aDrauvonu4 eeoxfcta1oaDranvolt sexrio3oydlm   fci t)arurur ;u1tlxnio3ils a elu s;u4 rtnif oydfpDe n ols)trtmxm oydapee ivsat srrmu pnu1ope moetytfa2rl(mont)alxnirctytopDr u i t0 rxmir3no4ap  mfcs t  rtm(r ot1aee  icildls2em( p;u)artnmociydlatelueilt  exmirpno4alte iei sf rumxmp;t4oleoioeilsfa2ran ont)alxrio3iotfmDr i ols0srxoxm3oydlmeelivil()artmu o;u1oeen oeiydls el(ms;(0tlxrxr3totfmDr ieo (0s2xmim iy4omte fcs (f 2umx oou0ope mi3iyt s2ra(vpnt4 rtoir3iytom elies t) 2xoxrpiy4om   nesasfa2ra(r nt4tpxo feiytla umumpnu4trtomr iydom r uvs;t  eto(r oy1lp emnvslt)s2rruroou1olxniieiat m rauvp;(0teermr tydfmtr neo;(0setmxo io1lpeemfcsltfsDtr(rpot0tetniieils s ra( p;(0 exnmrctytoat  ivo;s0t2urxo3oudapeemfcil(  2rr(rp;o1opxoio3tytlaDumn p;(0aeerif3iatfateai o ( srxr(m3io1ap elnesas sDurxrpot0tpe ii3ilt m2uaums;u) exnmr3oo1fa  an olt0 rxm(o3nudopte fesas)a2urumono1aexo iciasfmDemn p t0alxrmf3oatoa rau o ()texr(m iy4opeemict ( artaxr ot1tpenmieias sDra( snt) lxrxf ia1oat  n o;s)s2uo(opno4apenlncsls)aDtaump;t1oleo iciltlm2ranvs ()teerxrcoy1fpD  u ils0trtm(r iu1al elnct ()sDrru  ;o1alen o3tyslmDra(mpnu)trermf oydoate uvo t)trtm(r nydlltn ict ()arta(m ;u1openifetyd a2em(mp;(0aetrmr tydfmDe i i t0truoxr no4amte nvilsfsDtaxroou0altnio3tyd aDelnvon()trenifctytlpDeauei t tetmimpiu4ll nlnviasfsDtrxr ;u1texoifctys a2rmn o;t)tetnio todlateaieilt0t2xoimpoydll   iesls srtaxroot0olxo ietatfa umuvo;u0alermo iadlpD aivolt0sruo(o no4apeemnctl( sruaxm ou1aptoifetysls rlnmsnt) lxnmf3iotop rlnes;s0 ruriopoydll emfct ( sDtmum ;u4teeo o3iltfs ranmo;u)trxrxfcootfpD aieils  2umim3nudaltnlivsa() rtaumoou0tltomo3iyd s ra( o;t0arxnmf3tadfmD auvilt t2xoimpny4lm nmnvtl()s2tm(r nu0tlxoioeiasls ua(ms t4 exoifctydfpt auvi s)seum(opno1lpe lfvils arum( ooo4aetn o3tyslmDrmu o u4 ltoxocoydlp rluei (0sexoxr io4aptnlncia(fa2uaum ;u0altomi3iytla umnmpnu0aeermr oydfp   nes s0t2xoxo iu1aptelfvta(f Drax poo0oexnmi3iytls2eanvsnu0trtrmr totlaDrln i;t0tetr(o3no1om elnesl()a2tax poo1oex  fcildlm ra(vs t0trxomfcoa1op  livs;t0s2urxr3iudap  lneilsfaDum(  no1tle if3iat sDrm(vp u0aexomf iotomDr uvo;() 2xm(rpno1am emnvs () ruax pot0aex  ieiadls2ulnvs;(0 rtnxf3iatfmtr nvo;( teuo(o iy4alee fet t arrm(mo;o0aeeomoetyd aDuanvo;u4alxomo3ootfm  aueo;t seurio iodlptn nvtasfs2rmx onu0opx mfctlt sDum(vs;(0alxoir iatlm e nei t)srurxr3ou1ome  nesasf 2urum ;o4aexnmfctys a uanms;t) lxnxocoydopD  nvils)sruo(rpnu1lle livsas  Drruroou0oeeoioetyslaDuanmp (0tltoio3oy1op r ivo;t s2tm(rpoo1amee fcsa(  rumxrono0alt iietlt m2umnvs ()tlxrmfcoy1lpD li ils  exrir3oo1aleelncsa( arurur ;u4tpe  ictytlm2emums;(4texrxf oo1oa rlnvsls)srtrio3nydamte nes ( arrmurpnt0aptnmoeiys mDulnvon(0 reoxr3iodop r nvs;t  ruo(mpio4amee nesl(fa2tm( o;u0texomoeilslm2eau p;(4tlerifctytlp raneil(0 eumio3io1lpt lfcia(f Draxmooo4teeoifeiat aDemuvo;t4 lxoxo3ta1oate nvo;t) 2tmxr oydolt  fcias srta(r oo4oleoioeiadlaDranvs t4 exomo3oadfptelnes;() etoimpnodapee nvsls s2tax pno1oet if3iytfsDulnms t4aleoir tadfmD lues;( sexm(o3ny1lme lieil(fsDum( o;u0aeeoiictlt a2eln p;()teeoxo3iatfa e ivs;(0t2uoir nydomte icia(fsrrm(r ;t0tlx  f3tldfsDrmn s;t)aetrir3ty1fa   ueslt sruo(o iudamee fvt () Dum( pno0tex ifetad m2emnmo ()tetrioctydom r ues t) exrxo nodlp elnesat sDuaump;u1aee  octltlaDemumo u0tleomf oa1faDrli i;()srurxo3oudol   fcil(fsDta(r nt0opx ifciadfsDranmo;u0trermf3oo1fat  n i t srxmxopno1am n ncil( artrump;u0ole mietltla rmn s;t)tlerircoadoptr ivolt0 2xrxr3oy1amtnmfvil(f 2ur( poo0aexnii3iydfm ea(vo u) lxrifcoa1om e i s;(0srxrim iu1ameemfeta(farrax pnt4olxn o3tydla rm(vsn(4arermf3iy1fpD livols0t2xr(rpiudlpee neiat)artax  ot4tpeomietytfsDrluvo u)trenir totomDe nei;s) exmxr3nu1am   ies ( aDtmxmp;t1apxoio3iytla ua(vont)arxnmo3todfaD luei;(0srxr(r3oo4llee ivt (  Dtr(r no0tpt ifeiydfs2elnvo;t0 lxoxf oo1lp  auvsl() 2xmxr oo1lpenmncs s  2rru p;u4tlenmocilsla2emums;t0alxnxf3to1oa   nvslt)s2uoxm iydlme  nciasf 2rrumo;o4tee ifeildlsDrauvp;(0trxomfctydom elu o s) rum(rpno1optnlfcia(f Dtru pnt4olen ietys s2ea(mp;u) lxoir3iydlmtelueo s0seum(m iudll elfesa(faDururp;o0tex mietyt a rlu ont4 leoir3tatfm  auvs;(0 exo(r oy4llenmictl() 2raur ;u0texn ocilsfs2ua(vo;()trtoxf oatfmDelnvolt)t2ur(opno1ape lfci s  Dta( p;u4opt  octytfa2ran pnu)arermf3ty1fp r n i;t)texr(r iy4al  livt t) Drmu ooo0apeoiociat mDulumo t) etnxf3oatlpDrlues (0s2ur(m3iy1omtelfcslsf 2um(rpnu0tee  o3tydfmDem( snt4texrmo3iatopD lnvsl(  2tmxr iy4op nmiei ()sDur(mooo1tpxnmf3iytfsDem( o (0arenioctodoptelivslt tetrimpnu4lmen ieils  Dtmx  ;o4tex mictyd a ea(mont) ltoxr oodom  li ilt trtrxm3io4aptelncta()a2taxro;t1tltnio3iadfmDelnmpnu4trtrmo totfat  n ils0setoim3nu1amtnlictl()s2rm(ront1tltoii3tltfm emuvp t4teenircio1oa eau s (0setrxmpoodom e icia(  Dtr(monu1oeenmfciat s elnvp;() lerxf3oatlm r nvilt) 2umxopoo4lp elnvil(fa2urxrpno4tet mo3ias m2raumonu4 etnxfcoa1lpD auvo;s0 rumio nu4lpe lnvsas s2raum ;o0apx mietlsfmDem(mp () rxnxocoadlaD aivols0s2tmxopiu1optn ict tf Drru o;u4opxnmoetytlaDuln ont)tetoxr3ty1opDr ies ( seurxm oodll  mfesat a2trurpnu0tetoioeiltfa2um(vs t0texnif oadlp eluvols) rxrir3oudll nlnctltf 2uau o;t0tlt mf3tasfaDeln sn() eeniocoydlaDeli il(0trumim nodol nlnes (f Drm(m ;u1apxn feildfm em(msnu4aeerifcio1lp raivo t  rtmir oo1lle  fctlt s2um(mooo4olt ii3iasfm2ranms u0alxrir3todfaD an ols  exr(r ou1alen fet tfa2tru pnt1olx moeiadfs ua( o u0 rtoxrciytomtelnvs t s2xmio iu4lm elfvsl(fs2rmurp;t0opx mi3iys mDelums;()aetoxo3iotlp raivi s  2xr(o oodap e ncils)arumurpnt0teen i3iydlmDemump;()artomo to1lmtr uvo t0tetr(rpoy4omtelnvsat arrrumo;u4alxo oeiadla2uanvo (4aeeomrcta1faDrlu s;t0truoimpoydap emnetat)sruax pnu4aptomietlt mDrmnvo t) ltoif3iydfm rlneils s2trio3nydlm nlfci sfartrxmont1tpenifciysla elnmp;(0altoxr3oo1optraivi;s  2xmio nodaptnlfviasfarur(r ot4oleo fciadfa rlumpnu0trtoxfcia1fp eanvi s)s2urio3nudal nmfvtlt aruauro;o1aetoif3iltfa em( o;u0trxoir oa1op r u s;t0texoio3no1lltemfvs t  Dum(mpnt0tlxomi3ild m elnmo t0artnif iydom rauei ( teurio oo1alt  icil()sDum( p;o1tle  iciyt a2rauvo;u4arxoxf iy1faD auvi ()srxoxr oydlmeelnvil( aDtaur nu0tlenifeiadlmDulumonu4teeomf3todom  lu o;(0srxr(mpoy4alen fei ()s2trxmooo0tlx  i3tldls ulnvs (4 lenmr3oytfpteli sl()trxo(o iodamtnlivsltf rrrum ;u4aeeoif3iatfa2rl(mp;()teeoif oytlatraues;( seur(r iydoptn fetl() rururoot0oltnio3iyd aDeauvpn(4tlxrircia1faD aieo;s0trtrxopno4ll nmfvt tf 2rm(ro;t0aptn oeiat m uaumont0 exnxf tadfptrlivs ( srurir3iydlmtemfetl(  2taxroou4altnioeiyd mDranms;t0artnir tytfpteln o;t s2urxm3io4aleemfvs (faruaur ot1ole moeiydlm ua( s t4treomr todfate uvo ()trurxrpoy1apt lnvsas s2rrxmpoo4teenmietysls rmnvp;t4 eermr3oatfmD aies t0setm(o oydaleelivt (f 2uaxront0tptomfctydfs um(vo;()tlxnmr3ty1lmDr n o;(0 2xrxmpou4apenmnetas  rumuront0aee iiciltfmDuan p u0trtnif3oa1op  lieils0teumxmpiu1lme miei sf Dumum ;u0apxoiietatls rmu p u4 rxnioctodom  auvilt t2tr(r nudlpeelfcsa()arrmxro;u0olx mfctydfs2rln o u)altnmocoy1fatraues;t  exrimpnu1lmt liciatfs2ra( poo0alxnmictyt a eau p u0aleoiociotfaDeln i;s0srumimpnydllenmivt (fs2ua( o;t1opto f3iat aDumnmpnu) rxrxf3tatom  aivsls)t2urxr nydlltelfci s) Dtaum oo1aptnifctld a2em(mpn()tlxnmf3totfm e iei;s)srtmxr3ny1lmtemnvs t) rtaxr no1optomi3tys aDuluvp;u0aleomrcootlaD li i;(0t2xmxm nydlleemicil(  rrrxrpot1tlx  ieiatfsDrmuvs;u4 lxoxr3oadfmteaivsl( trtoio3iu4ale livsls aruaumoot0aexoiocilsfaDulnmpnu0texomf3iotlm rai ol()t2urim3io4omtemfct ( s2ta( poo1tpx miciadlm rmnvpnu0 ltnxo tadop eau ilt0trxrxo3ou1amt  fcslsfsDum(  ot4tee ifeiasfm emn s () eenxr to1latrlueo;()tetoxmpio1lpe  icil( a2rmur ;u1oexoiociatfa2ranvo;(4 ltnmf iy1la   ueils0sexmxmpnu4omtemfvta( aDrr(r ;t0ape micilsla ran snu0 etomf iytfpteaueo;(0t2uoirpno4ame  nctlsf rtmumo;t0ale mfeiasfmDul(mo;t4artnmo3oa1fp  lnvi t tetr(r io1ape  icsasfsruau ont1tptoifciys a rm(msn(4arxnmfcoy1om r i i (0 rtrio ou1opt mfvs t s2trxm nt0tetnmfeiytfsDra(vo ()tlenifctydoat aiei (  2uo(m iydalee nvi sfa2rr(rpno1apt  i3tysfmDra(vp;u) rtoir oy1laD  u i ( s2ur(rpoodalenlnesl(  2uaurp;u4apxnioctydfm el(vont)aeeoxf ia1la eanei;() ruo(r3oo1omt lfesas sDtm(moou4texoif3ilsfs2emu pnt0areoxo3ty1lmDe n s t) rtmxrpoo4oltemfcs () rrmum ;u4alxnmociytls2rmnmon(4 ltomociytlpteaues s  euo(r nu4ame lfvi t sDraxr no1ole iociasla emn o t4 eeoio3iydfmDr nvs t)srxmxrpny1omtnmnciat aDurxrp;o0olt  f3ils s rm( s;t0 lxrmf3ty1lpDrau i;t seumxm nydlpen fvi sf Dua(mpno4oet mfetadlm el( on()texrio3oatfp elivs;s) 2xmio3oy1lmtemfeslt  Dtruro;t1olxo oeias a rm(mp t4 renirciodla ranvi;(  2tm(m nu1lptemfciatf Drrx o;t1tlxomieilslm emu pn() ltnir3ty1om  aiei;t srxoim nu1ale  nes sf Drm(  ot4ale moctld s2el( snu0aetnxf oytlaDr uvs;t)t2xoir no1lme livtl()a2tmu p;u4oex  i3ils s2eanvs u)arxrxf3ty1omDeaueo;()s2urio3no4ol n nctl()srrrumono4oexoifeiyd aDelnmo;(0 ltrxfciodopD aieo;() eum(mpiu1ape mietl()sDrr(rp;o0aetoifeiydfa ua(mpn(4trtoir3iadoa   n i;( teurim no1ol n iciasf rtm(m nu1ape  feiydfs ul(mp;(4altomo ootlaD livsl(0trxmio3ny4lpeelnet tfsrtmxrono0oleo iciadla rlnvo (4 ltrifciytlmDe iesls)s2xoio nu1omtemivi ( sDra(rpnu4apeoifeiadfmDrmu p ()treoif oy1omDe i ol(  2xmir3iodom n nesa() 2uru  nu1tlxoif3iydfs ea(mp (4aeermo ta1lpDean s;s)srxoxo nu1lp n nvtat)sDrmurpno1tlt moeiltls ranvo u0tleoxf3iatfp  livsls0seto(opiudap  livias)sDrm(mpnt0opto ociyd m emn pnt4alxnifcootfat anvo;t)srxo(o ou1oltnmicia()artmurp;u1alx moeils s2uaums;(4texrir3oy1omDeaivo;s)teur(m3oudopenmnctl(fs2taumooo1tex mociadfm rlnvs;u4 lxoir tadfm e u ols0 euoxopiu4amt mnvt t srumx  nu0tlxnmocildfm eauvs;t) reoxr totlpDrau olt tetmimpou1lmtelivil(fa2urx o;t0tex if3ild mDrln s (0 ltrmr iadopte i s s0s2urio ny1lmt mivil(fa2rmu pnt0alen feiytls ulnvpn()treoir oatomtr i i s)seumir nu4lpeemnci s sDuaumoot4opto ieiyt s rmnms t4areomf ia1oat  ivs;t0s2xrxopno4ll  lncia(fsDum( o;t0opto i3tysfs2rlu o;t)arenxrctatoaDe uvsl()sexmxmpoydopee nvils  Drrxrpou1oeeoif3iad s ul(mpnt4 lxnio iodop rauvo t0 euoimpnu4lp  mfei sf 2ur( oou1apen iciad m umnmp;t0altnif ta1lmDeaivs;s) eurxm3oy4aptemfvia(  2urxmp;u0opxoiiciadla2eanmp t)treoiociadoaD aieo;t t2trio3iu4alen fvia(fartaumono4oee mf3iytlm rln s t4 exrmf ta1op  lu ols trtoirpoo1alenlfvtatfsDra( o;t4olxnmf3tls m emnvs;u4aetnif3iy1lptelu s;(0s2xo(m3io4lpee ncsatf 2rrumo;u4aexo o3iatlmDumn snt4 lxrmr3oo1lmD li ols  2urxo iudomtelivslt  2rr(rp;t1aleo iciadfa2ra( p;t4alxomr3iytfmDeli sls t2xrim iu4lmen fcia(fa2rmx o;t1tpenmiciysfs2um(von(4 exrmfcoatfm  lieo t)srtriopiydom  lfcs sf rtmxmono1tlt mfctyd s2ulumo;u4 reoir ty1op rln ils) euoxm oy4altnlivs s  rtr(mpnt1apxomieild s2rmnvpnu0aetrxfctodoaDr ueil( s2tm(o3iy1aleelies (f 2uaum nu0aetniietad a rmn s ()tleomr3tadoaD lnvi s0 ruoim oodllee feiltfs2rr(r ;t0tpxoifcildfs2emu s;t0altrxr iotfpte ies;(0trtmio iudlp e nvsl()sDrrur no1aexo ieilsfsDemuvon(4 renxr ta1om   uvo;t t2um(o io4ame mfvsa( a2truro;o4aetnifctys sDumnms;u0aeerxf3oatom rlues s t2xmxmpiy1lpt mfcia()s2taxrpoo1ale miciasls2rlnvonu4 rxrir3oydlmDraueol()tetr(r3oodamt mnvsa()srrrumono4opxo icias mDeau sn(0tltoxr3io1oatrau o t) exmxmpnu4alt lfviatfs2tau oou0apxoifctys a uluvo u4 exnmf3oodoateauvs;s0teuo(m3oodllenlicsat) 2ur(m ;o0teeo fciyt sDumumonu0arerirctodfmt livs t  exrim iodllt lnesa()aDumurpoo0alx moeiydla rl( snt0 lerir tydfa r uvi;(0srtm(o3iudlleelfcilsfs2tr( oou0aexniicildlaDrl( s t0trtrmo oa1lmtraivo t)seurimpny4apeemivtas) 2raxrpnt0oeeo o3iys s2umn pn()tetnxf3ootlpt lnvi;(0trtm(m3ou4om  liei s arrmx poo0tex  ociat aDrmnvpn(4 eeoifciy1omte i ol(  2tm(r io1omteliciat  Dtaxmpnt1aee io3ias aDran snu) reomfctodopte ivs;t0 2um(r nu4ope mncia(f Drr(  nt1tlt moctatls2ra(mont) lenmf3iatopDelivslt) rtoxm io4aleelietls a2taur ou0oetoiieiatfa umu p;t0 lenmo3iotla r u ol( t2tmxo3oy1apt  nctl( a2ua( oou4oex iocildlaDuau o;t4aexomo3iytfaDr nvi s0teuo(m3ny1optemiei s  rtm( o;t4tlxo ocildls uanmo u4alermrcoa1lpDeau ols)t2umirpoy4openmfvsl(  rrmur oo0olxnii3ilt a2rmnmp t) lxnio3oytopt luvo;( teuoxr3nodomte nvt (farurx oot0apeomf3tytlmDrl( s u4 lenxo oo1op e neils0 2tmxmpoudom nlfviat)sDum(rpno0tptnmfcildfsDrmnvp (0trxomo to1fa  anvslt)s2xmimpoydoptnmivtatfsDtmum no1tltnioeiatfm rln p u)aeeomociy1lpDe n s s  2umirpnu1al nlfci (faDraur oo0tee  o3iltfmDua( ont0altrir todoa eaivsls0srtr(m3ny1ol  mncslt sDtr( poo1aeenmoeiltfs ran ont4 rtrmfciytlpDeanvsl() eurxrpio1opeemnvi tfaDum(m nt1texoioctatfs raump;t)altrxf oadopD li i t0teuoim oudlmtemfciat)s2rmxrooo0aptomo3ias m rmn o t0areoxf oo1om eanvil() rtrxopoo4lm nmivia(fsDra(rono4tpt mfcilsla2ul( pnt4 etnmocto1oa   ieo t0teuoio3ou1altelfet t)s2um(moot1oex mfeiaslm eln s u0texnxocoo1op rlu il()seumim3nodlleemivtlt)aDtaurpot4tpt ioetyt m2ulnvs u)aexoxf tatopD aueil( s2urxo3no4lme lictasfsDtr(mono4tle iieiasfmDemuvont)alxnif3iy1op rauvslt)setrxrpno4olt mncsl(fa2rrumpnt4aetoioeilslm2rl( pnu0aetniocta1laDe uvils0s2xmxm3nodllee nvsl(fsrtau oou0oet mfeiyslm2umnvo;u4 rxoxr ia1fatrln i;()trxoim oy1ape mneiat sDrrur ;o1aleomo3iyt s2rau p;u4areoif io1la r u sls)t2tmir iodalte ivs t  2um( o;t4olxoiieiydla2ulnmo u4alerxocootfat anesl(  rur(r oy1aptnmivi t)s2raxm ot1tpeo o3iys s2rluvs ()artnmf3totoatr i s;s0 rxmxr3ny4omeemnei sfaDrax pou1oeeoiicilsla2ulnvo t)tetnmocoo1lat  nvi;() 2xoim iu4omenlnetlt)sDrr(r ;t0ale mietatls ea(vsn()areoio iatlm eaueolt  2to(mpny1lpenmici ( sDumump;o1aptnioeiltla um(mpnu)areoifcoydla eluvi;(  eurxr3no1lm emfvi (  2rmu  ;u1aptoiictysfs2eau o;t0tetomfcio1laDranvi (0trto(opou4olenlnvia(  Drr(mono4apeo ieiys m rmumo u0 exnif3ty1optrli o;(  2xoxopoy1llenlfeiatfsrumxr ;u0alt ifeilsla2ulnvs u) lxomo ia1oaDelnes (0 eur(m3ou4ll n neia(  Dtau pnt1tltomo3tlslm uauvp t4 lxnmfciatfp eau s s s2tr(o nu1optelnes s  Dtm(  oo0ope ioeildla2umn o (0aeenmoctodfp   ivsls srurio oo1op nlivilsfarrm(  ot1altnmo3ias m2rlu snt0 ltnmrctydopDr uvol() eum(opoudlp elici s artr(ro;o1olx iieiydlm2um(mp (0alxnio tydlm  ln s;s)srtoio3iu1om  mivt t s2tm(m ;o4oex io3iadfm el(von(4trerif ia1fmtr nvo;(0srtoxopiu1llenmncsas)arraxroot4teen oeiasfmDra( o u)aetnio ia1fmt au i;s0t2ur(opnodaleelncs () 2uaxrono0apx ifeiydfa elump;t) lxoxfcoo1omt lues;s)s2tmxo3oo4aleelnei s arum(m nu0tlto iciadlm2rm(vpn(4 rerio totopD ln i;t0seurxrpno4optnlnvi ()a2ur(r ;u1alxomieiad sDrl(von()trenif oatoptrln s s) etrxrpoy4oleelnct s  2rmu ooo1olxnio3ilslm ranvs;()trermrcta1opt luvols0 2xo(m nu1al nmfeil(f 2uaxm ou0aet iieiydfa elumon(4arermo3ia1lat luvilt) 2xoir iu4lle  nvias sDrau pnt4oltomictatfa eln o;t4 rxoxr3tadomtrlnvs s)s2xo(opny1openmnes t  rurxm ;u1texnmieiasfs rl(msn(4alenircia1omt aivi t s2xo(rpoy4oleelfeil(f Dur(mpoo1alx iiciys mDrmuvsnu)arxomrcta1fptr nvil()sexoim ou1llte nvt sfsrrr(  ;t0tpxn f3ildlmDrmnvp t)artnif totlaDraivo;t  2trxmpiy1apeemfcilsfs2rmumoot0teeoioeild mDulums u4tltniocio1lat anei s0texrxmpoy4al  lnet ()s2rau  nu4olxn fctasfsDumnvpn(4 rtoir tatfpD an s;( t2tmim3iu1amtn nvtls) Drrx onu4tpxomieilt sDeluvsn(4treniocoytom e ueil( sexrxo nu1ll emicils aDraxr nt4tpto i3ildfs2rluvo (0 leoxf ty1laDe nei;() rxo(mpoy1amtn iei t)srtru  oo4oltomoetydfs2emn s u4 exoxfcoydlmDeluvslt0 euo(r3oo1llee ics (farumuro;t0tpxnmiciysla2ul(ms u)tltrio3tydlat lnvsls  rtoimpoy4llte ieias) rra(mpot1alxomoeiytfa2umumo;()alxnif iydfateli i;t0 rxoir ny1olee ivilt)srrru p;t4tlen ociytls2rl(vo;(4trtrxf oa1fate u s s0 exoxr nu1aleemnctl( aDtmxmp;t1tle mo3iatlaDum(ms u4teermr ootoateauvils  euoxrpnodamtnlfesls)artm(m oo0opx  feiys m2el( s (0texrxr3to1lm eaiei;s trum(rpou1altn nvsa()srra( o;u4ale mi3iaslm emuvsn(0tetnxfctadfmteluvols0t2xoxo3no4amenlncs s  2tmu o;o4aex  ieildfa rmumont)artoxrcoydoaDrlueo;()s2ur(m no4alt mieias)sDra(r ;t4tetomf3iadla rm(mp;t) ltoxo tytlpteln o;()seuoir3ou4lleelncil(f Drmu ooo1aetn o3iytfaDem(vont)alxrxrciytfpt lu olt srxmio oodoptnlivslt arrruroot1tlenif3tat m2emnmo (0 lenxfctytfm rlies;t0srxrirpiu1lp nlfvias  Dtr(  no4aetnii3tltfa2um( o;u4aetrmfctatoa  lies s0 2xo(o3ou4om nmfctlt)a2tru p;u1tpe  iciys m2uan pnu)trenmr ia1fa   i ils  rurim oudap e nes sfsDum( o;o0opeomieilt sDrmums t4texoxo io1fp rluvol()seuoirpiy1ol  mnesl( a2tr(mpot0tltoifctadfs2ul(vp;(4 eenxr io1fatr nes s0 rur(m3nudll n iei ()s2umu  oo4ale iictasfmDeauvp t)arerxr oydfatelu s;s srxrxm3iydolenmfvsa(  Dum(root0aet ifeias a rm(vp u4 reoiocio1laDeaies t  eum(rpnudlpt mics t arrmum nt4altnmi3tadfm el(vo;t4tetoxr3tatlmDrli i s)tetmxr nu4altn icslt arta(rpnt1aex io3tltfs rluvpn(4aetrmfctadomt au i s0 rumir3oydamen fetatf Draur ot0texnmictasfm2emnvs (0trtrmo3iadlptelnvs s0s2xrxopoydap   fet ( srurxm ot4aleoio3iydla el( pnu)tlerio3iotfmt  u i (0 eumir3iy1ome mfvs sfarua(m ot0alxo feiyt mDuau s;(4altoir iotfmDrlivs;(  rxmxrpny1lle licils) Dra(m nu1texoio3tydlaDelnvont4trtnxo iydfpDrluvs;t srto(r3nudomte fvtls)sDuaxrpnt4opxnioetlslmDuluvp (4trxoxr todop elivo t)s2to(opiu1lpt micsas) 2rrxmp;t1olxnifciyd a2rlnvo u4aetrxo3tydfaD ai i t trxm(mpou1lm  lnvtlt sDrau o;u1olxo feiys a rl(mo;u4texnifcoytfm   u o;t)sexr(o iydolenmnctl()arraxro;t1opto iciltfaDel(vpn(4 rxnxo3io1lmD lu s;( trurxo3oo1lpte ivi t aDrr(  ou1alx if3ilsfm2emnmpn(4teenmf3todla eai i s trumimpio4optelics sf rtmum nu1tpen oetytfsDrluvs;u0 exrmocoatfmt anvils0trumir3oo1apeemiei t)sDtr(r ;u0tet  o3iad s2eanms t0artomo to1oate nvs (0 eumxm3oydlme micia( a2rm(r ;t0opeomiciytfm2emu p;u0aeeoir3oodlp ean o;t0 2urxo3io1lltelnetas srraxroot1tpx io3iadla emu p;t4 rtrxfcty1opDe nei;s s2toio3iodolenmictlt a2taum no1tltn ociysfs2rlums (0alerircoo1laDr uvs;(0t2tm(opiy4llt  nctltfa2rm(  ;t4tptoiociysfaDemn o u)artomrcto1la e uvs s) rxrirpoo1opt livi t) Duauroou4aptnioeiadfa ul( p u4 lxnxr3tydomtean ol() etoxr3oydolt mnvsl()a2rmurpnu0oexo feiytla2eln s u) lxrxociytom r u sl()trxo(m ny4ape mnvta() rurumpnt1tlt  ictys a2uanvp u4tetnxr3ty1lat lu s;s  rtm(o3no4op  miesatfs2rauroou4altoio3ilsfs ea(vp (4 ltrioctydlp elivi;(0setmxr io1al n fvsas) 2rmx poo0aeeoifetadlm rln s t4 rtoxfcoydfpDrliesl()srumim ny4olt mfetl( s2tm(r nu0alt mfciydlaDem(mo;t)aeenif3iadfaD au il()texo(o no1lmeemfcsl( sDururpou1aet mfctysla umn p;() exnxfcta1omtraivi;s t2umxopnudll  mivsa(faDra(m ;o0alen f3ildlmDumuvpnt)texrxf3oa1lmDe u slt0texr(o iydaltelies sfartax  oo0oeeoiiciatlm2umnmp;t4 ltoxfcoy1laDeluvilt)s2xrxr3no1alenlfcsa(fsDur(m ot1tee if3iysfa2emn s;(0tlxoiocty1fp  ln sls0srurxr no4oltemfvias s2tm(rpot0tpt mictltlaDemnvpnt0 rxoxf3iydlmDrlnei;(0trxrxrpnydame  ivs t sDtru o;t0apeo feiysfaDelnvs (4 rtoif3oodlm e i i s  rtm(m3oo1ame lnet (fa2rmumo;u4aexomfcild s rmn p u) exrif3oatlmtranvo s)t2tr(r ou1ap elnvtl()srrau ont1aeeoif3iyd m2rl(vs (4trxrifcoodlm  ai ilt seumir iu1lmtnliesas s2trx p;t1oexnmf3tlslsDea( p u4artomf3oadfm r n ol()t2xm(r3no1alenlieils) rum( ont4oeto iciydlm2rauvp;(4 etrxfciadlp r nvi;()t2toxopny4lm n nciat aDrrxm ot1oltnioeiltfaDrl(mo t0texrmf ta1oa raivs ( trurxm3no1lmt  ivilt) rrmum ou0aptn icias a2raump u)tlxomf3ootopDrauvo ( srtmio3iy1lpe mieilt)s2rmur ;u1oee iiciyslm2ul( p;() leomo oodop e nvo t)trtrio3io1lmt mfeia()s2umx ont1aet iietad s em(mp;u4aetrio3oadoaDr nesl()tetmxr ny1omenlfvsa()s2rrxmpnu4aexnif3iatfa2umu p;t0aleoiociotomteluvolt0s2ur(rpnu4apee nei s) 2tax  ou0tlxo ieiat m2emumont0trenio oadom  liei s0truo(o oy4lltn nci () Dua(r ot0apeo ieiatfa rmu s;t)arxomf oytlpte nei t s2xoiopoo1am emfcsl( arurxr ;u1opx moeiydls2el(vp;()alxnmr3ta1faDr u ol(0 rtrio3oo1amtelivi (  ruaxr no0teeomi3tldfs uau p u) rtrif3iytoaDe nesl(  exr(o nydapeemieias) rumxmo;u4tptomf3iyslm2ra(von() etomrcoy1lmteai i;s)teum(o iy4open nct () rrau  nt4aptoiiciydlm2emn s;u0 rxnmocoydoaDeaneo;t t2ur(opiy4apeemfetas) 2uauro;t0tex mi3tld a umnvon()aetomo oatopteauvil(  2xmxmpiodomt mnetl()a2ua(mpoo1tlen o3iyd a rmu s t4 etoifcoadfm e ivsls)trxrxr io1omtemiesltfa2ua( pou1tlx  fciys m ul( o () ltnifcoydlm elnvslt) rurxopoodlme mfvi ( srurxm nu0aee  ieiydlm2ul( p;t0 exrif3tydoa   i slt)t2uoxm3nudlme livsas)sDtmxr ou4tpto ieias s2em( sn(4aleoir3tydlmDeauvo s  eurxrpiy4ll n ivi (farrr(ro;u4olxn ieiad s2rl(mpn(4arenxo oadfm rlnvs;(  2ur(o no1al  mneils)srumxm ;o1opxo ietytla umu p;(0altnxrciy1oaDe nvs;t0 etmio3iy4op  mfvs (fsrrruronu4aeen o3tadfaDuanvo;t0arxrxo3tatfp eauvi t0sexrir ou4optelnvt t a2umxmoot0aetomfctyt mDem(mon(0trenio ta1omDeau o (0teuo(o3nu4lpenlnvia()aDuax p;t1apt  ictas s2emnms;t)treoxo iadoateau i;(0 2xrxm3oo4al emfvt (fsDum( pnt1tltoioeilt mDrm(vs;u)trxnmo iydopD  ueslt  2tr(opou1am nmneias aDur(  nu0tet  ieilslaDum( p u)aeeniocoadfm rluvs t0 rxm(o no1optemneil()aDrrxmpoo1apxomo3tat m ul(ms;(4 rtoxo3oydla rln slt sexrxrpoodlmtemfcil()aruaump;o1olen f3iasfm rmuvsnu0altrmf3tatlpDrlues t0 2xm(opno1alte ictat  rumxrpot0opeomfetadla emumon(4 rtrmfciadfp  luvi;s0s2xmxo3no4lle lnetl( sDumx poo0alxn ocildla2rlump;t0arxoxociadfmt  nvs;t0 2urio3iydaltn nes tfs2trumooo1tle  feiydfs eauvpnt)alxoxr ta1fpDe i s;t  etrxm no1lpenmfesas  Duaxmo;u4tee ifcias s2ea(vs;(4 etnirctodlpDr ivi;(0sexoxo3oudlm elnet s)aDum(mpoo0oetn i3ilsfm ean o;t0 rtrirctydoat livi t srxo(rpny1amt lnciat aDta(mont0tlx ii3iatla2eln o;u4trtnif3tydfaD luvo;( t2um(rpiu4ol elies s  ruru oou0tlx iieiyslm2emnvsnt4trxrmr3tatfateln s t srxo(rpoo4olenlfcsls)artrumpot0aexnmiciytfa ul(vs;u4trtniocoo1omtr i o;(0 rtr(opny4lle  iet tf rur(rpno1aex mictysfs2ua(vs;(4 exnif3totlaDrli i;()trtoiopnudll  lncsa()arrr(ronu1oexo fetlsfsDrluvs t4tetoxr tytfmtr ueslt0 2trir3oydap e ivils  rtmu  ot0ape if3tyslmDul(vp;u0trtoifciy1omDr neo s) 2trxr3nu1alenlfcia(fsDtmumoou1open ieilslm ul(msnu0 leomr3oatlatelueo;(0 euo(m oo1lmteliesa(f rururpou4tpx ii3tatla rmnvp;u4 lxrxrciytlp r ivolt  2tm(r io1oltnlfcs ( srtrx o;u1aexn i3iyt mDuanvs;u)arxnmr3iydlp   neslt0setm(opnudoltnlfcsasfsrtru o;t1aptoii3tld m um(vo (0 eeoiocta1omD luei s0sexoxopnu4om   fetls srtr( o;t4opeoiicils s ea(mont4tleoxr3ia1oatraues t) etoir ny1al  lfesls) Drmxrooo0olxomi3iadlsDuanvsnt) lxnmr tytfaD lnvi s texo(mpiu1olt  nei s sDrru onu0alen o3ildlm emnvsnu4 lxrif oodfpDr n o;(0 2tmxm iu1ole mfctl(farra(rp;o0apto ociyslaDemums;() reoio3ia1oa r i i (0truoim3iydlp e nci () Dta(ro;o1tpx  ociys mDrmnmo t0aexrio oadlmt  nvi s s2xr(o3iy1lp nlfesa(fa2trxr nu4ope moeiadfs eln p t0tlxrio3tydomD  uvi;s0srxoim no4optnmnvta(fsrururpno1optn oeiaslaDelnmo;(4 etoio iatopDrauei t) etr(opnydoptn ivils s2ua( ont4tetomfeiltfm ranvont) etnxr3oa1fate uvs;()s2tmirpny4oltnmivsl(fsDrrxm oo0oet iociatfs ul(vont4 reoxf3oo1omDelneolt0 euo(m3iydlptemivs tfsrtau  oo0tpeo fctltfs2ulnmpnt0 rxnmo tytfmt  n s (0s2uo(r oudalt mfciatf Dtaxr nu4tleoifetlsfm2ra(mo u4alerir3ty1opD  n i s)t2urxrpnydope  icilsf Durx  ;o1tlxn ietadlm2um(mo;() rxrifcoytlmD  i s;t sexmim oo4altn ivt sfarrmumont0tee  feiatfs eanvo (0aleomr iotfmD  n o;t)s2urim3iu1alt mfvsasf Duax pno0apeo i3tydfm ean o (4teenxo3oy1oa e ues ( srtrir3iodalenmicia()aDta(rpno0tle ifeils sDel(ms;u0 etrxoctydoat  i slt)trxoio oo1olt  fvsas aDuaxronu1opx  o3ilsla emnvsn()treniocoa1optrlieo;t s2xrxo3oydolt  fvias sDum(mo;u4aexnmi3taslsDrmn o (0trxnif iydom r nvo t0s2tm(opny1op elfvi t) rta(m ;u0apxnmf3tyt a emnmo u4teerir todfat ai s;s0t2uoim ou1lmt mnvias)srrrumo;t4tle mi3iltlmDumnmp;() rtoioctodoptrlivols) rtmio3iudlmtnlnctlt)sDua(ro;u4opxn fciatfs rlumont4 exnmf3oy1fp rau slt0 rurir3oy4lltemnct s) Durx oou4opxoif3iytls2umumo;t)tetoio3tydfa e uvo ()teto(m3iu4aptn ivil(fs2tmumpou4oeeomoeildla ranvo;u) etoxf3ta1faDeauvi;t0 euo(rpiy1am n fvsls) 2um(  ;u4tpt mieiadfa rmnvo u4tlxrifcoytlmtr n s;(0 rxrio3nodlle  ietlt)a2uaur ou1oleniieiatfs rlumont4tleomf3iy1lp e u ils tetr(mpny4ope mnesatf Dra(moot0tlx ii3ilslmDuanmonu0treomr3iytlatrlnvi;t) ruoxopnodap elfvils) rua(root1tlenmo3ias aDeauvon(4aetomocoy1fatelnvils sexoxo oydamen ictl(fa2taurpnu0apeomi3ilsla2rmn p;t)texrxo3oytom   uvi;t0truriopiy4al nliciat  Dtax o;t4tpeomieils s2rlu p;t) rxoxfctydfa rlu i t0s2urio ou1ameelicsas)arua(rooo1alt  oetad m2elumpnt)artnxf oytfpDelneil() exrim ou4omtnlici t)sDua( p;u0oleo oetat a rmu ont0 rxnio oytfm  lnvi;t)tetr(mpiu1lmen nesatfs2rrur oo0tpe mf3ildfs ulump;(0tlerir oydlaDraivo s) ruriopou4ope  ivs t)a2uru  ot1opeomf3tld s rluvp (0altnif3oo1la  aivols)trxmir nu4opt mivs t a2tm(rp;t4altn oeiat mDumn onu0aeermo3ia1lmD anes;s0srtrim3oo4lpen iesas aruru  oo0aetn fctlsfaDumuvp t) rxoxr iadoa  ln ilt) etoiopno1ap  mnct sfsDrmxmp;u1tet ii3ils m2rmu onu0 eeoio todlp  li s;s trxmxo no1aptemfeta()s2ra(ro;u0tee  o3iltfaDrmuvo t4 etrxrctotomDelnei t0t2umir ou4apte ncsls  2um(mpnt4oetnio3ildlm emuvo;t4aexnifcoatomD livilt)trumxrpnudol  mici ()a2umu  nu0aeeoiietys m umu onu0arxnxr iytlp  lnes;(0trtm(m iudoleemnvs tfaDtm( oou4tlxoii3iyd a2rauvo t4trxrmr3ta1oateauvi;t0teto(m no4lp elfvi ()srtaxm no1oeenif3ilslm uau s t0 leoircootoatrlieols)texm(opno1al n iesas)aDtrumpot0aexnmoeilsfmDeanvpnu)tlxnioctatfate nvo;( sexr(m oodomt  iviat artax ono4oetnii3iatfaDua( s t) lxnmf iotlmDraies;()seurxopou1omenmfvi ()srraxr nu1oeeoii3tadlm2ul(vo;(4 ltnxr ootomt au ol( seur(o3io1aleemnvtlt)srrmum ot0tlxo ictasfa ranvs;t0texnif to1fmD  u s;t teumxo oo4lptelietl( srumu p;u1altnmoeiatfs2eau p t4trxomf oydlmDrli ils0 2xmxrpnu4ol  licils)sDraxm nt4ape micildlaDumn o;()tltrmf iodlaDr n sls trur(r nu4ap emnvi () rtaxr ;o0oeeo oeiat sDrlump t)tetnxfctadoaD  ieo t0tetoxr io4oltnmncsas  2urumooo1olxoif3iydla2uluvo;t0 renif oy1fm  aneo ()t2toxo3oudalenmfct (faDuaxrpou4tpenmo3tld s uanvsn(4 eenioctytom ran ols  rxoiopnydope lnvi (fsrrauro;u4tlxomocilsfsDul(monu4arerxfciadlptrlnei;(0srtr(opiu4omtemfcia(fsDtrx pnu0aleoifetatla ra(vo (0aexnif3io1fpD an i;s) exrxr3oo1olte fciat srtau pno4opeomietld sDem(vp u)aeenmf3oatopt  u ilt t2umir oodamenmicias) 2tmu  ;t4tpxnmociyslaDum(vp t4aleoxrcio1lp rlivilt)srxmxrpiy4llenlnctas a2tmumooo1tlxoiocilt sDrl(vp () lenmrcoytfpDrauvslt trxmxr io4op elivtas) 2tmxmo;o0oeenmieiydfs2rlu p;t)tltnio oytomD liei;t)trxo(mpoo1llt mivtlsfartmx p;u4altnio3iat s2eluvont0tetnifcoodlmteanes (  2trim ny4olee neil(fa2tr( o;t4olxn f3tysls2uanvpnu)teeoir3oatlat aiei;()t2ur(m oy1ol emiei t a2rmu p;o1oltomfetatfa em(vp;u0tetnmf3oydlmtrai slt)srtoxo3oydapte fesl()aDta( o;o4oeeo fetyt mDuluvo;u0 eeoir3iotlm eauvs ()srto(o3iy1lpte ict () 2rrum nt1oeeo ictldls2ra(vont4tlxrio3tatomDe nvs;(0trtm(o iy1aptn neiltfsDrmx pnu1optomfcildfaDra(ms () ltnmo3iytomtelieo s)srxoxmpnu1om  mnvt t  Dum(r ou1teto ictasls ul(vp ()trxrxociodfpDr nes t)trxm(rpoo4aptelnvs ( sDur(mp;u0opxoio3ilslm umnmont0aetoir3tydlmDe ieols seurxm iu1ale licilt) rua( poo0tpeo i3iyslsDrm(mo (0aexoio totlpDrai s;s0 2toio io4ole mics s srtrxrp;t1oltnii3iyd a2el( s t0 rxriocia1op elieo (0s2xm(rpio1ll nlnesl( sruaurpnu4tpxnmfctyd s2ua(ms t) eenxf3tytomDelu ilt seumxopnudolte ici ()aDtmxm ;u1tet mietad s rlu pnu4alenxfciydlp r nvi;t)srtoimpiu1aleemicta( sDtr(roou1aeenmietldfs umu s (4arxoifcoo1optr n ols srxmim oo1am elivs sfsrururoou0aexn fciytlm umums (0 rtnxrctatom rai s s  2urxm3oo4oltn nvta( aDua(m nt4aeeoioeiltfmDra( s;u) lxrmocoatomDraivolt0t2xo(mpiudlmtelnvt s) 2umx  oo4aeenmfeiatfs rmn s;t0 exnxo3iydom e uvi s)teuo(o ny4lleemnct s)artmx oou4tpx ifeildfmDulums (4 lxrmfcty1fat lieol()texoxrpou1opee ictatfsDrrxr ou0opt mf3iat a2emnmp u4 rtoxrcoatfp  ai sl() 2trimpno4oltnmnvsatf 2raxm nu4aptomo3iadfm2rl( s (4 rtrxrciydla  aivs;() 2tmxmpoo4omt lnvtlsfa2trumo;o0opxomfciadls2eaums (0aetrxr3iotfp raiei t0t2to(rpnu1ape  fctlsfarrax ont1tpxn i3tys s2ulu p () lxnxo oo1opDe neilt s2xmxr3ny1ol nlfvt () rrm(  no1oex  f3iadfmDum( o;t4aetnmrciotfmt anes;() 2xoir iu4lm n nes t) rra(mpoo4aee  ieiadfa2ul(vs ()aexoir3oodfaDe u sl() ruo(opnydamen fes ( a2tmu onu0olxoifeiytla2uanvs;t4aeermocoa1fmD lieo s  2xr(r3nudom elivslsfarraxrp;o1alen ieilt s rmuvs (0trxrif ty1fmt  nvs (0t2xmimpnu1am e ivtasfa2urx  ;t1oetomocilsfm2uau snt0trtnxo3ia1om rlnei;t texoxm3oy1openmietl(f 2um(rp;u1tlxomo3iadfm raumo;(0altnmr3to1lateau s t)trtoim3ou4al emfeslt a2trum ot1tlxomfeiyslm ua( s () leoir oadlatrli o;t  rxmimpnu1lltelicsl( aDumurooo1olen ocilsfs2el(mon(4 rtoxrctydopDr u ilt0 2tmxo iydlp elivsatfsrrrur nu1apen feils aDumnvo (4 ltnmfciadoa eau sls0 euoirpou1lptnmfctlt aDtr(r ou4tlxn ociyt s eauvo;t)aeermf3ta1oaD  ueo;(0t2toxopiydam nlnvtl()srrr( p;u0alenio3tls sDrauvs u)altrxo tatfatrln ol()srtoxo3io1lptnlfcsl( aDrrumpou0teenmicild s2ulumo (0artnmr3tadoat auvilt0tetrxr no1om n nvt (farur( pou1tltoiicilslm2rauvpn()trtomfctydomtelu o;s trxmimpny4lm nlics (faDum( pnt0ope mfeiatlm2ul(vont0trxnif3oy1faD lnei;t0srur(opiodop n fcs ( aDrax ooo1opxn feiat s2ra( onu4 renmr3io1lmDrlueols0 2um(r io4altnlici sfarrm(  nu1oeen i3iadlmDuau s t) rxnio ty1oaD  ues (0 eumxm no4ape livs (fs2urxronu1aet mo3iasfa2ran s;t)arenif tatfmD  n s;s0s2urimpoy4lm emivslt)s2rmu  ;t4oetn oetys s2el(msn() exnmocto1lmtelnes (0srurxm3oydal e ivs (f Drrx  nu1apen feiltla ean p;(4tetnmoctotopDrauvi t  rtrirpny1op n fvsa( a2trxrpnu1alxn oeils mDumu p;(4tetoio iy1opte ies t)srumimpio4altnlnviltf Dtmx  ou0aeeomictatls ulu p;(4 etoif3iytla raivsl( trurxm oydom nmici s)aDumxrono1oeenioctys m2eluvsnt4tltrxf oytom r uvol()srxrim nodome lfctat)a2uaum ot0tpt  oetydlm eanmsn() etomo3oydlpt  n o ()trumxo iodam  mfvs sf Dtaxm no1aexomfetlt a ul(mp;t)aetoif oy1oat lueo (  2uo(r3nodllenmfvslt)a2rmxm ou1oexoifctls s rl( p (0arxoio3iatop eluvs s)trxm(m3oy1lpeemfvt (faDrmump;o4tet ifetytfa2ra(vsnu)altrxocty1fmDean o t)t2tmxmpno4amt mnvia()aDrrxrpou1apeomfciadlsDuln on(4artoir ia1latrlnvo;t)s2xoxm nudapee feil()sDraumo;u0altnifetldfa em(vo t0 rxrxf todlaD liei (0tetm(o ou4optemncsls)a2uru  nt4olto i3iatlmDumuvsnt0 ltnxo oadlmDe iei t trtr(m oodalt livsl(  2rmu  oo1tle ioeiad sDrl(vo;u4 etrmr iy1fp eau o t0texmxo iy4altemieils a2ta(  ;u1alenmfetadlm rau pnt)aetoxf oy1om ean s;(  etrxmpoo1lp emnvt ( a2rrxrpnu0tet mf3iydls em(vp;u)aexnif3tytfp e i o;(0trxrxopnodal nlivtatf 2tax oou0oexomietyd aDrm(vo;u0tetoif3io1faDrauvils) 2xm(o3iu1al emfesa()aDrmxm ;u4aexn octatfa ulumon()trtnio oo1lm  aneils) 2xoir oodlm emivias) Drr(  nt4aex mo3tydfa2ra(vs;u0tlxnmrcoytlp rlivo;t teurxm ny1alt  ncs sf rrm(r no0ale moetltls eau s;u4alxoxf3totfm eluvo ()t2toxo3io4oltn ici sfarra( ono0olxo fctltfaDranmo;t) rerxo ia1fmtraneo t0teurir no1lm emfvias) 2rm(m ot4tlxomociysfsDuaump;(0 lxnmfcoydfa  ln ols0 exoim no4om n fes sfsrur(moot4oltniieiltfm2uanvpnt0 ltomrcto1fat  ues;(0 euoirpiodapenlnvtlt a2ra(mpoo1oexomfciatfa ua( p;t)trtrxocoytlptelues t0 2toxmpno1omt lieia()arraumo;o0texo i3iad mDeau o u4artoir3iytoa rlivslt)t2xrirpoo4op n ncilt)srtru pot4tpt io3ilsfsDumnvsn() rtrmr3oa1oa   nvil( teur(rpny4am e ivi ()s2uau ont4opt iociydfm2ranvp t0 etoxo iadomD ln o t)trtrxm3ou4op n fvil(f Drmxm ;t4texo iciatfm elumsnu0altnxr totfat lneols0 ruo(r3nu4olt  iet sfarrrxro;t1tex ifeildfm2el(mp;(4trermo3totfa   uvi;s0 etm(opiu1op n iesl( aDtrumpno1tleo feiltfs elu o u0 exnxo tatlpDeli s;t)t2xoxr3io4al n fcslt)srtmu  no1apx iictldfm2umnmsnt0alxoio totlaDrauei (0 euriopnodlleelfct t s2rmxm ou0teeoio3tytfa2el(mpn()tleoxfctytom  ai il( t2xrxm3io4lmtelfvilsfs2tau  ot0tet io3iad a rmn s u)tlerxf3oatfp  au i;s)trtoim ny4olt  feilt)srum( p;t4tpenmfeias a uanmp;() etnxf oa1lat  uvo;t t2xrirpiudlp  mnci s s2taum oo4opxniicilt a2uanmo;u) lxnxo3ootopD  i i;s) etmiopiy1ap  lnetlt)aDtrxm nu4alt iieiyt aDrauvs;()tetrxf3tytfmtr ueols) exm(o3oodol nlnct (  rtaxm ot1openmf3ilslsDul(vp t) lerxo3ia1la  lu il(0 rxr(r3iydamtnmieslsf Dtmxmpou1optomieiyd m2elums u0 exoxr iy1fp eanvi;t srtoxr ou4openmfcta(fs2urxmont1tltoiiciatfm2rauvs u0trtnmo oodoatr nei;s)t2xrxr3nodope mnvtl(fa2trxrpou4texn o3tyt m ul(mp;u) exrif3totfm raieo ( srxr(o ny1olenmfeil()aDuaxrpot1oet  feildfa uln p;(4tlxnmr3io1fat aiei;s  rtoir3oo4amte fvslsfaDtau  ou1aee  fctldla2ra(vs t0trtrmf ootlpDrlivols)s2uoxrpoydlm e fcil()a2trurpno1apxn i3iydfsDulnmp;(0aexnmociadom elneo (  2uoxmpiy1amt mnvil()s2umuro;u0optomi3tyt a uluvo;t0 rermf3ty1lmDe i o;() 2tr(m iodlm emfvt () Dtmx poo4aeenii3tltfs ulumonu)tlxrxf3totfmt liesl(0seuoim3oy4lp  mnvtas)arra(rp;t1aexn ietyd mDra( p u4tltoxrcoodoa r nvo (  rtoimpnu4lp nmnvt t sDur(r ;u1opeo o3iltfs rmnvo;t)treoxr3oytfm rai i;t0seurio3iy1lltelfcslt  Dur(  ;u1optomfciasfs2raumpnu4 lxnxrcoodlat livi s0 exoir iy4lpte fesl( sDta(rooo4ope miciat a el(vpn(0 rtrxfciytop e ivo;t0s2urimpiu1optnlies tfa2rmu  ;u4ole mf3iydla2umnvsnu) rtrmo iydlpDe i ils)trtm(rpoudlm elneslt)a2tr(m ot4olen o3tadfs rl( o;(0 eerxrcoadlat  n i s)t2ur(mpnu1lpt mnct t)arrru  no0olto iciyt aDem(ms;t)aleoxo iodfpDrlieol( s2xrxmpny1amtelnvsat)sDrr(mpno1teeo oetyt sDrmump;u)tetoif3todfm   i s s0 2tmiopoudape  iciat  Dtr(m oo4tetoiociytla um( o u4trenif3iy1faDrlnesl(  2uoxrpnudam n nes (fs2ur(mono0tptnif3iaslsDrmn pnt)trermrciytoat aueo s  2toxopny1apeemnesatf 2rau  ;u1tpxnmiciyslaDul(mo;t)artrmocoatomDr nvo t  rto(r3no4amee nci s srtrxroou0altomiciatfmDuaums (4 exrxfctydfaDeli il(0 rtr(o3io4lpenmici ()aDum( onu4texo oetytfm2umn s (0tlxoirctytomtran o (0trumxopiu4lmee icil() Dtauro;u4olx mi3tadfaDrlump t)trtnmr3iy1lateaivo s)seuoxm no1opeelivi (fs2tmumo;u4aptnmi3tat s eau s;t4 rxrxrciy1fmDr n sl()trxmxo nu1olenliet ( a2urxr oo1tleo icilsfm2ra(monu0areoioctydfat luvo;t sruo(r oo4ll  livt s)a2umu o;o1ale moetysfaDel(ms;u4teenir3iydfat aueo;(0 rxo(m3nu4lp nmncsat) 2tax  ot0oleomfciad aDelumo (4aetrmf tydlpD ln il( srtoio3no4lp  licslt) rumxrpno0alt iieild aDemn on(0 etoio iotomtrln s;s trxoxm3ou1lpt  nvilsf 2rrumonu1oltoifeiad m rmnvs;u)trermocoodoa   n olt) 2tmim3ny4apeelivtl() 2um( o;u1oex miciytfsDulu p;t4 etnircoa1omt aieol( srxoimpiy1ol nlicsa(fa2rm(r no0tpxnioeiydfsDrmumsn()tlxrxf3totlptraivo;t0 rxrir iu1apenlivsat artaump;u0alxoifctldls2rlump (4artnxr tytfaDeluesl( sexmim iy1lpt  neias)aDraum ;o4oltoiietldlm rluvp;u)altnxr oy1optrli o t) exo(rpnu4amtnmfeias) Dumxrp;o1alt miciytfm elu sn()texoxocto1fp r ies;( teurio3iydole lnet s)arur(mo;u4oeenifcils mDel( s (4alxnxr io1la r i il()truo(m oo1lp  mfvtlsf 2trurono1tltnmoetlsla2ean ont0 rxrxociodoptraieolt)trur(opno4lme mneils)arrm( p;o4apx mi3tlt sDulu s t0 rxrxfcoadfmteau o;( t2toio3iodlp nlnvil()s2tmx poo1aet iieiydlaDrmnmo ()arxrxo iydfp  ln ols s2to(m nodlltnlnctltfaDurxm ot0opt mfeiydls em(mp u0trtnxo3oo1lp e uvilt)texm(m nodlmte nci (  rrmumont4tee ii3tadfm2rmnms;u)areoirctytfmDraues t)t2umir iodaptnlies (  Dua(  ot1oltoiiciltla2eanmo;u4trxnmr oo1omte ivo s  etrxr oo4lptnlfet s srum(m ou0tptn fciasla el( ont)aexnir3tadlm  aneil()trurim3nu1lmt  icsas)s2rm(mpnt4alx  oetyd sDuauvs () rtrxfcoadfmD anei ()tetriopiodop elivsas)artru  ;o4apx  ietld s rlnmo (0 rerxrctytfateai s t0 rtrirpno4aptn icsa(fsDurx ono4tpen ictldfa rm( on(4tlxrmfciotfpD lneilt) rurxm3nu1lle  neslt a2urx o;o4oltnmi3iysls rlump t0 exoifciadfpDeluvs;(0 etrimpoudomtnmfvtlsfsruaurpnt0opxnif3iydlm ulu s;(0trtnif oydfm r nesls0tetoimpoudoltelicia()srtaxmpoo1tpt  fctltfm2elump;t)altnio oy1oatr i o (0 2xmimpiu4olenlfvtltfs2rrx  ;t1aexo feiat m2umnvp;(4 reomr ta1opDean i;(0 exm(o ou1ope mivias) Dtrx  oo0tlxoifciydlaDelnmp;u)tlxrxociotfp  ai s s s2to(r oy4apen fet s arur( p;u0tpxn f3tas a rl( p;t) ltoio oatlp rlivi ( trur(r3nodlpe lnvta() Durum no0aptoio3tyt a ulnms;(0altoif3iodom e u slt0s2tmim io1amtnlivsas aDtrumooo1aleomoeiyd s rln p;t4arxrmr3tydfaDe ivo t0 rtmio io1lltelici (  Dum(rpno0open o3tydfm2ul(vsnu) exrxo iadom e nvil()teumxm3nu1lmt  ies t a2ua(m oo1apx moeiydla el(mo;t4 lenif3io1faD  ivsls0srtrimpiodap n fes (fsDtmumo;u1aeto ociadfm2rm(mo;(4tetrxf3oytlatr ivi;t s2toxr nydapeemfvs ()s2rrxro;t0oleo iciatfm ul(mp;(0 exnio3iatlm eli ilt) etmxo oy4aptnlivtl( srrmur ;t1altn ictltfs2uauvo u4 exnmo3tadoatrlivs;t) euoxm3oo1ol nlieiasf Durxm no0oeeniietasfs ra( p t0tetoxr3ootlp  lu o;s  2xoxm3iy1lltn nctatfarrru oot4aet mi3iytfm rmnvp t0tlenmo3oo1faDelivil(  2xmxrpiudal  livs t srrmuront4tpxnioeiyslmDumumonu4aexnif iydfmDrlu slt texmxopnu4am emfetl()arraumpot1aptnifetytfs2ean s (0teerxo3ootfa  aneo s  2xo(r3no4ope lnesl() Dra(mooo4tlx mociydfs2rln p u)trtnio oadopte n s (0trum(r3ou1lm nlicslt)s2tr( poo4tpxnmiciaslmDul( s;u0aeeoifcia1omte nvo;s0trur(mpou1omt mnvs sf rur(m ;t4oeenmoctaslmDemums t0tlxoircoa1lptran i t)tetrimpno4llte fvt ()arur( poo4tpx  iciyd m2elnms;()aeerxfcoy1fmDr i ils0 euo(m3no1apt lnvs t  rua(  ;u4ale iietydla rl( p (4 reomfciy1omtranvols)srumxm oo1al e fetlt) 2rax  nu4teenmf3iad a uauvp t) lerxfctatlpt li il()sruo(rpny4ope  ivil()sDtr(ro;t0oex  fciasfa elu p ()texomf3ia1oaDrln sl(  eumim3iu4apt lneilt sDurxrpnu4oee mf3iatfs2umump () eenmo ootlptr n sls t2xmimpoydom n ncilt) 2um( oot4olen iciad s2uanmo t0 renxo3oydlaDelnei;t0t2uo(m3iu4apt mfci ( s2tr(root0tltn oeiasla2um(mo (0 eenmoctytlaDr neo;t0 etoxr3no4ll n fvtas) 2raxm no0alxnioeilsfa um( o;(4teeoiocoydomDranvi t s2tmxo3no4ll   ivsltf ruaxm ;o4apto feiasfa ea(vo;u)aetrmrctytfa raueo;s0setrio ny1am elneil(f rtrxm ;t4tpx ioctatlsDrm(ms t)arxomr oydfp rlues;(0trurxm io1lpee fvtasf 2rau poo0tpx mfciadfmDulnmo t)aexrxociy1opDelnvi;t)t2toxr nu4ap  mnctls) rtm(mo;o1oeenmi3ias sDumumont)areoxr3totfm eaies ()srurim nydal nmivt (f rtrx poo0teto ieiaslm uaumsn(4artomo3iadlpD  nesl(0 etr(m no1ome mnes sfaDtauront4aeenif3ild aDrauvpnu0alxrxo3to1oat aivs t  rxmxr3oy4am e ietatfs2tm(rpou1oexoio3ilsla2rlnvo;(4 ltnxo3iatoate ieils  rtrxr iy1lm nlivi t s2tr(  ou0tlt  o3iydfmDrm(vpn(4tlenxfctydfp e uvs s0 2toxm nudllee ivsat)arurxrpoo0opeomoeilsfm2ranvs;t4trtrmrcio1lm ran s;t  rurxm3nu1lmee ies ( srum( o;t1altoiiciltfs2rluvonu0 rxomo oadlpDraueols trxmxmpnu4al nmnetl()arrauroot0aee mo3tytlm el(vs;(0trxnmo ootfpDe neslt)t2toxopno4am elncs tfsDuaumoou4ale iictytfm eaumo;u) ltnxo iydoat livi;t)teum(o oo4op n ivs sfsDraurpoo0alx mi3ildlsDumnvs t4trxniocoodop eau i;t)srumxo3nodaleelncilt)sDtaum ot1texo ociydla uanmp;t)texoxr3io1fate n s;t0 eur(m3nudol e ivi (faDraxrooo0oex ioeildlm2emnvo (4 lxrircoa1fa   i s t0 2urxo3io4omenmnes t sDtrx ono1ope iociyd a2el( s (4tltnircoa1fm eaies;t  exmiopiy1amen fci t a2uau  ;u1olxnmictldla ranmon(0aetrmociydoa
\ No newline at end of file
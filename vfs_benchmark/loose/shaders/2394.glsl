@@ -0,0 +1 @@
+ivo;t trxrxopio4lm  mfvtl()a2rrx  nt1tetomociyt s uanvsn(4 exnmr iotlatr nei s)seto(m oo1opeelfvs () Dtm(rpnu0olenmfeiyd a2emu ont) reoio3to1lmt lnvolt  rxmim3ny4amenmfeilt  rrmurooo0teeo ictlsfmDumnvpnt4alxnio3iatfateai s t teumxo3oudole mfci (  rtr( pou0tex  ociydlm2ranmsnt)alxoxrcoadlp e u s;t setm(o3oydamt  fviasfaDtrx  ;u0apxoiiciyd a emuvs t0 renxf to1lmD  ivs;()sruo(rpou1olt mnet t  2rm(mp;o0oleo fcildlaDea( p t0aexrio3tydfp e u i;s) eurim3oudaltnlncil(fa2rau  nt1oltniietlslm2ul( sn(0 exomo3tydfaD  nvs;(0 exmirpny4ope  ivsa()a2ra(m ;t0oeeo fcilt m2ua(ms u) lxrxr ty1fat livs t texo(r io1lleemfetat aDrru  oo0alen fciyslmDelnvpnu0texoircoa1opDeau ils0 2urimpoudome lfeilsf 2ua( p;t1tpxn ieilsls elums t0trtnif3tytlmtrai ols srumio oo1ll   nvi s)aDrrxr ;o0tleoii3iysfs el(mp;u)artoio tytfpDe neils0 ruoio3nu1am emies t  2rauronu0teenmo3iltlaDrln o;t0arxnircoodlm   neils sexo(m nu4amtelicsas)arrmxmont4tltnii3tltlm ulnms ()texoir3iotopD an ils)texmir no4optemivsls sDtmxmpou0olenmieilslmDua(mo ()tetnmoctodla e ueo;(  etmxo ny1lmtnlfvsl(f rum(  nt4alxo ietyt s rmnvp t)teermr tytfatrlu ils s2xm(mpoudome  neiatf rurxmo;t0olx mf3ildla2rlu p t4treoiociadfpDr ivolt  rxmxr oy1altelivias srrr( pnt4tpx mf3tlt s ua( o;u)trxnir totop   uvi t)t2xmxopoy1lm  mfet (f 2uaur no0optoio3taslmDrl( pnt)aetomr tytlmDr n ils) euoimpnu4om nlici ( aDumx pno4tlen f3iysla emuvo;u0tetoxr iatomDelu i s0srtm(r3io1lmt lfcia(  2umxrooo1apx mfciad m2ra(vo;()aetrxfcoa1laD lnes;t)s2trim3iydllenmncsa(  Drr(m oo4apt  feiad m emn o;t) rermrcoatfpte n i s0teuoir io4optemnctas)sDraxrpnt1altnifctltfm2rm(mont0 ltoif to1fp rlu i;t trxo(o3iu1lmee iciltfsDra(mont4olx moeiyd s2emuvsnu)teerxfcoydop r ivol(0 etr(rpiu4lptemfvsas)s2umu pnu0tptnifciyd sDemnmp t4tetoio oo1lpte iei t  exo(m iudlpt mfct s aDtmumoou0oeeomiciatfaDemumo;u0arenioctadop r uei t)sexrxr no1lmenlnet t) Dtm(mpno1oeenio3tld a elnmo;t4alenmf oadopt aivi;t0 2uo(rpnu1am  lfvsas)s2umumo;t0olxo ictas aDeanmsn(4 exoxrcoa1fp r u slt0 rtmim iydameemnei (fs2raumo;t4tee  feilsfa eln s;() lermr3ty1fa r iesls  rtm(r ou1op  livi ()a2rmxmoou4optoifeildfs rau p t0 rxomfcoatoat lu i;()trxr(r nudaltemiei t)artmxmpnu4apxomiciyslm um( s u4tetrmrctydla  aues;t)teuoimpny1al elnvt t)aDtmx ooo1oetoif3tad m2emumo u0 lenif todlate ieslt)s2xrirpno4op  micsls a2ua(r ;o1olx  i3iytlaDrlnvp;t4 etnxo oo1opDe nvo;(0trtrxr3io1amt mnvil(fs2rmum ou0altomfciyd mDua( onu) eeoir3oodopDr i olt) eur(m oodap e fesl(faDtmxroou1aleo f3iad a2elnvo t4artnmr ootomtrlu sl()sruoxrpnodal nlnetatfsrtm(moou4tpeniiciysfa um( snu4 eermf oatlatrln i (  2tr(m iy4om  lfvsa(fs2rm(mpoo0apxnmo3tadfsDelnvs;u0tetrmr3iy1oaD  nvol( sexr(opiudlltn feslt a2taum nu1optoiieiad a2rauvs;u)tetnxo3iodop  livo ( t2toxopnydaltn fcs t sDuaumpou4optoioeiadfm2eluvon(4tetnxf3oadomDrlu s;t)setoxmpoydam  mfesa(f Dumuroot0oltomi3iyslmDrmumo;t)texrxocta1omDrliei;(0 2uoxo3nydlptn fctl(fsDtm(r oo1tlen fetasls2el(vs t)teenirctatlaDeli ols)trxr(m3ny4lmtnmnvilt  2umxrp;t1oex  i3iysls rl(vs t)artoir3oadlp r u s s0trxoio iu1lptnlfcslsfsrraxmp;u1openmoeiydfmDeanvpnt0 ltnifcty1fat ln s;s) etr(r nydll emnvs ()artaumono0apeoioetys s2ua(mon(4tlenmfctadfm rliei (  eumio no1omtnlivsl() 2ur(  nt1tpeo oeiys m2uln p u) reoifciotoa  ai i t0 2tmimpoo1am e icsat  rtm( poo4texnmociltfa2ul( p;(0 lxnmf oo1lpDraivi;s)trxriopiydll n fct t srrm(ro;t0opx moeias m2rlnmo;(4 rermr3ia1latrlueols t2tmiopoo4optelnetltfaDtrump;u0olxo o3ild a ra(vsnt0artrio iy1lmDr uvo;()seuo(m3iudop e ivs s srrrur no0aeeoiociasla2emn s;(0 reoircoodfpDelieo t0 rxr(o3ny1omt livslsfsrum(r ;o4oltnmfeiadfs2rm( p u4tleoxfciotopDelnvil(0t2uo(o3io1lmt  fctat) Dua(ro;t4aptomoetldfaDumn s t0texoir3iotomDraueo t  ruoxo oodlpte fvsa()srur(  ;t0olt  fciatla2rln o;u)artoxr iadomDranei;t)trxmir3oo1op   fvtlt artru pot1oltoiocildla umuvp (4trxrir iy1fa  ai ils  2xoxm io1altelnvtl(faDtr(mo;u1aexoii3tat m rmumon()trtomo oo1fm eliei;t)t2xm(rpio4omt  fvt t)a2ua(m nu4tlen f3ild a2rmnmpn(4texomo3oydomD li o s) 2uo(mpnu1op n fetls a2rrxm no0alxnioctatfa2elnvo t4arxnir3tatoptrluesls)s2trimpoo4omeemfvil(f Drm(r ou0tlxomfctlsla2ul(mpnt0 leomrcootlatelu i (  2xoxm3iu1alt mfctas) rtaxr ;o4tpe mfciat s ua( o (0 ltomfcoatlm elueols) 2to(r iy1amt mnetasf 2tm(mo;t0tptomfciatfaDelu p;t4 rtomr tatop r nei;t0seuoirpny4lm nmfcia( a2rmxrpot0tpx  fctadls2rln o;()teerxo3oatlpt lu sl(0trtmxr3nudlmee nvsas) 2urx pno4openmiciltfs2rauvs;u)aeeoxfcia1fpDr u ol(  2toir ny4lleelictlt aDurxro;u4oeeoifeilsls uanms (4tlxrmfcoodom eanvo;s t2umxm no1optnlnetat)artrurono4oet ifeiydfmDraumpnu4aexoiociatfpt lu i;t)s2tm(rpnu4amtelnetatfa2rmx pnt4tet if3iasla2eluvo (0 rerircoa1lmDr nvilt0 2toir nu1alenmfetlt s2rm(rpou1altoii3tas s rauvo;t0texnmf3iydlm e nvo;t  exriopoo1oltnlfciasfa2umxmpnu4tptniieilt s2umu s;u0arxnmfctytlpte nei;( t2umir3iudome lfvta(  2uax p;t4teenmoctytlmDum( o (4 lxrifcio1fmD aneo;()s2xm(o3nydam nlfvsls a2umu ooo0tee ii3iadfa2uanvp u)trerxrciodoaD  i ils texrimpoodalenmnvtat)artr(  ou1tle  ieiyt mDrmumpnu)alxomo3tadfat lies ()setrxo3io1lpeelnvt s)s2tmu  oo1apenifcilt sDua(mpnt4texrir oadfatelies;s srumim io4omte fvs t)aDurur oo1aptn oeiat sDrmnmp;t4aexnif tadfmDe n s;()sexrir io1llte fvtas) ruaxm ou0tetn feiysfs2elums t)trermoctodlm eanes;s seum(m3iu4ll nmfciat sDumx  nt1oex mf3iyslm2em( p (4 etoxoctatfmt anvi s0sexrio nudole micsl( aDurxmo;t1aeenmo3iltfs ulnms;u)tlerxf io1op rlnei ()trtrimpiy4altn fvi () Duaxr ou4tlx iicilslm umnms;() lxnif oy1omD lnvs;t t2xm(rpoy1lleelictlsfa2trx p;t1aetnifeiadfm umu snu4 rtomr tatlaDeanvo;s0sexmxo3nydolte fcs ( s2trx  no4opxomi3ils m2uaumpnt0texrxf iydlaD  i s;(0t2toxopou1opt  nei (f Duau  ;t4tlt  ieiaslaDemu s;(0alenifcoatom eli ils  2xr(r ny1lmtelfcsl(faDuau  oo4altnioctldfs2ul(mo t0 ltoifciydfmte i s s0 rxoxopnydlp   fvtat)artmx  ;u1aptomfciltfm ran snu4 renir3todlm r ueo t)t2tmxrpoo4al emnetltf Dum(mp;t0teeomi3taslmDea(mp;t0teenir iytopt an ilt) etr(r oodomt  fciltfs2uaxrp;u0alt mf3iytlm2emu p;(0aetomfcoodfm rluvs ( teuo(r nu1lm emnvs ()sDtrump;t1teeomfcild s2rlumon()alenxr3ta1lat aieo;(0seurxr oo4amt  fet (fs2taxmont0altomi3ild sDrm( on(4 rerio tydfaDr uei;t0s2umirpiu4lpt miviatfsDtm(r ou0altnmiciys m emuvs;(0tetrif io1lmtranvsls)texoxrpny4om  livta(fsDta(ronu0apx io3tldfs2rauvp ()trxoio3oytlaDr u i (0 2umimpnudlptn fvsltfaDumu  ;t0aeeo feiydfmDrm(mo t0altoio iydfaD  n ol( setoxm ou4omtnmfvtas)aDta(  ou0tetomoctltlm2rau p;(4aexrmr iatop eauvo t0seuoim3nydlltnmnet s  2uau o;t0optnmf3tytlmDrmuvp u0tlenmf oa1lpD  n o s  etm(mpou1om  mfes s) rrm(r nu4tlxomicild m uln o u)treoxo iotoate ivo s seuo(r3oo4am  mfei sfarumumpnu4aexoiociydlsDrln p;()trenxf3tadlmD  n ilt0 2trxrpno1ol nmici t  Dur(rp;t1tet  f3iytfsDumu s u) exoxo3io1oaDeai s;s0srtmim oy1om   fcia(faDtrurpou0optomo3ildfmDumnmo u) etnmf3oa1lmD  n i;t)setmimpoodoltemnvtl( aDrru pnu1tee ifeiltfs2ulump u0 rtrmo3oydlp e nei t)srurim oodomtnlfcsas  2ururonu0oeto ieiytfa rmuvp (4teermf ootla eauvil(  2trir oodamte nvil() Dra(rp;o0olx ifeiysla2umump;(0tltrxf3ta1lat aiei s  exmxo3oo1alt  icta()a2trxmpnu4alxnio3iytfm2uau s;(4altrxrciytoatelnesls)teum(m iu4oltnmictlt)aDurxmono0aex mo3iydlm rlnmp;u) renmo iy1opD auvi t0srtrxrpny1omenlivsls)artaumpot1tex  feias sDrmn o t0 etomrcio1fmtraneo ()trxr(o3oo4openlfeias  Dtax o;u0oetn oeildfsDumnvpnt0 lxnxr3iytfmD an ils trxrxm3iu4op nlicslt)sDum(m no4olxn i3iyd m ra(monu)areomo todomD lu i;(0 2uoxm3nudolen fvia()aDua(r oo4apx iieils a um(vo u4 eerio todlm rlnvsls)s2tmxopio4lm emfei (  Dum(mpou1tlto fcild s em( s;t) lermfcoatopDr uei t) rtoxr3oy1olt mfeiasf 2tauro;u0tlt mociydfs2ul(vp (4 rxnir3totlpt ln s;t)t2to(o no1altnlnvtlsfaDum( o;t0texo fcild aDel( o u)alenmocootlp  lu o ()srxr(opnu1alt  nvil() rtmur ;u4altniiciyd s2el(mp;u4teenmf tatoa e ieo;s)sexr(o3ou4amt lnvsat)aDrrumpnt0opxoii3tysfa ul( s u)teerio oydfaDe ieo;()trxrxo ou4open neias) Drrumono0aetoioeilt m2eluvont0artomo3tadlm elnes;()s2umimpnydop nlfvilt sDrrump;t4alt mo3tadlm um(ms t4tlxrir tadoat  ivo;t  2xm(mpiydopte ivsatf 2umxr ou4tleo f3ilt m2elu pnu0tltrmo tydla raivo s t2uriopiudolee fviltfs2taumo;u4aetomfcildlm ul(mp u0tetrxf iadop ranvi t texrxmpnydoptemnvias  Dtm(m nt4aexnmociasfs eauvo t)aleoxo3oodop rln s;t trxrim iodlmen icias)srraxr oo4aeeniiciytfa2emnmsnt4trtnmf oodoatrlnesl(  2umiopiydolteliesa()a2rr(roou0tle mfctadfs ran o;u) rtnir iy1op rau o;()s2xoim3nydalenmnvsls  2rmxr ou1alxnmoeiat m ra(ms (4arxoio iydlm e u slt  rum(m3oo4ame lnetas aDra(m ;u0tle  oeilsla elnmon(4trenxf oydfmte i o t)t2uriopiydlptnlicia( arra(  oo0tex  fciasls2ua(mp;t4 rermrcta1fp elneo;( t2um(r nudal nlncslt)aDraur ot1oee ii3tyd aDumu s t0trxrxo3tatoaDe uvsls sexrxrpny1op   ncil( s2rrxmo;o0tlxomictytls2umu p t0tlxnxoctodfptr nvo;s0s2ur(o oodapenlnct s)sDrm( pno4alx mi3tasls emnmp;t4 rtnmo3oodla raieol() rxoimpny4lmtnlivs s) rurxroou4oeeo iciyslm uaumsnu)aeerio3oodomDrlu s;s0t2tmimpiy1apenmnesat) 2raxm ;o1alenmictysls2ua( snu) rermrciodlaDran il(0teuoxr3no4lltnlieias arrm(roou0opx ioetat s eaumsn(4 eermf oy1oa   ieils) 2xoxopiudole  ncils srtau oou0opt ii3iat a2rauvsnu4trerxrctydlpD livsl() exoxo3oudap nlietl( aDua( p;t4tee miciydfm em( s;(0arxoxociytfat ai olt)s2ur(o3iy1ale lnciltfa2um(r no0tpen ieilt m rl(mpnt4 rtoxf oa1lp elnes;s0 rur(o ou1oltemfcsl()aDtrx pnu1altnmiciydfsDra(vo t4aeenxo3ia1fmtr uesls) 2urir3io1lltnmnvtlt) 2ta(m ot1tlt  oeiysfs rlu o;u)trtrxocootomt lieo;s t2umxo3oo4oltnmictlt)s2urxmpoo4oeeo feildfsDrmu s;t) etomocty1opD lieils s2trio3oydaltn ivils)artrx  ou1oexnmo3iltfs2ua(vo;t0tetoioctotoa  lies;s0 2to(opiodole lfvilsfsrtmu  no0ope  iciydlaDem(mp;t0arxnio oo1lpte ueo;s0s2umir nudamt  iesas aruru  oo0tlx  fciyd s emnms;()aeeoxr3iydoaDeanvo;s) rtrxopiy1openmnctlsfsDtmuronu4apen o3iysfm em(vs;(4artrirctadoaDranvs s)s2xoiopio4lltemicta(fa2rmxrp;t4texnifciasfa rlnms;t0tltrifciatom   u s;( teurxo iy4ope livtls)aDtaumont1tlx  fciltla eanvo u)alxnxr3tatom rlu ol(  2toio oodam emfcs t srum(mpnt4ole if3tys aDemn s ()alerif ootfateaivi;()setoimpiodal   ncs s sDtaur nt1ale ioeildfm eluvpn(4tetoxrctadop  ai sls trxoxr3iu1ope  nvtlt srrmurpno1oetomf3tydfa2rm( snt0areoio3ty1lm rau i s srumxm nudol  lnctls  2rru pnu1olenmictydls2rlump (0 eermrciodoptrauesls s2tmir oodaptnmies t s2tmx pnu4optomo3tysfa2rlu p;u4arxrio tytoaD ln sls0texrio3ou1lltn fcil() Dumuront0aexo fciytfm2rlumo;t4 leoxf iytoa   i sls)srtrio3nu4apt mictltfarrru  ot1apenioctld mDrln s;u) lxomo iydla ran o;t s2ur(o3oydapte fctls  rrrxro;t0aex  octys m um(mp u) rtrmfcia1omDe neslt  2tmirpoo1ap emfcilt srrr(r nt4aetnmfeiad sDelnmp;u0aeenxo oo1optrlivi;s0 2uoxrpiu1altelivsasfaDua(mpoo1ole mieiytfm2ua( p;u0alermo totop eaueil(0t2xo(opnu4op  mics t) Dumx p;u1tptnifetys s2elnms u0aeenmrctodfp   u i;()t2toxr3no4opte fviatfs2ururpno0tpe  ietlt m eaump (4tltoxo3ty1fatrluesls0t2xmimpnu4ale  ivilt  2rrxrpno4ope iiciyt aDelu o u)altnxociy1fpt aivi ()trum(mpny1lme mictlsfa2taxrpot0olxomieias m rmnvp;(0teerxf3io1oa   u ols)t2xoxo iydal  mnvi tf Dtr(mpnu4tltomoeiyd s eluvpnt4 exoir iy1lm ranvo;s texoxmpnodlmeemietlsf ruaxm nu1opt ii3tydfa2rlnmpn()trxnxrcoodlm r u ilt truoxm3no1ap elncs (fsrtru oou1olxoiiciysls2ul(ms;u0 rxrxocoodfat livi;()trto(mpnodamt mneta() Dua( pnt0oltomfeilslaDumuvp;()arenxr3iatoatrluei;t)setr(m nu1lpenlncta()aDuau  nt1oexn ieild a eaumo u0tleoio3ootoaDe nes ()sexrim nu4ap   ivilt  Dtm(rpnu1tetnmocils s2rlu s;t4 exomf3to1opt aiei;t0tetmim3nydomtn nvt tf Duaurpnu0apxomfciys m uluvo () rxoir3oadlmDeau s s) eto(mpoo1oleemnvt tfsrtrx o;t4tetnmictyslm2elu s t4alxrxo3io1faD auvi t  2urimpiodllt lfvi t sDrr(m oo4aeenmfeiyt a umn o t) lxrir ty1la elivilt0 eumxo3oy4optn ieias a2raxmpoo1aet moctydfm2ran s ()tlenxo3ia1lpteln o s0 2um(o3iydlltn feia(faDtr(mooo4tleomi3tad mDrlnvsn(4 eerifctadomDr u i t)texo(r3oudlmtelfvi ( srtrumpnt1olxnmfctadfm ra( s;t0trxrxf3iytfat  u i s seuoimpoodll nlncilt  rrm(rp;o0aeeo octys s2ran ont) leoif iydfm rau ols0sexoimpiy1ol  mictl(f rraxm ou4oleomfeiytfm2uln snu)teermr tytlmDe nvsls0t2trirpou4lmtnmnet (fsDtmxrpno4open oeiysfaDem( ont4 ltrxo3oytopt li sl(0sruo(o iy4amt lfeta() rra( pno1tltnmociadlmDrau ont0artrmr3iy1lp eauvolt)t2uoxm3no4al   fvtltfarrrurp;u1opto ocilsla ean o;() reomo3iytlmDr uvols0 etmir3oo1ap n neslt)artmx  ou1alx ii3tlsla2ulu p ()treomo iotlpDeln ols) eur(o nydolte nvil(  rua(mpou4aee  i3iasfm rluvpnt4alxrxr3tydfa  lnvi;t0 2tr(rpoo1oleelieias)srta(rpot0aeeomieilt mDua( snu0alxnmf3to1fa eaivol(  exm(mpnu1open fesasfsrum(mo;t0alenifciytla eluvs u0 eenif3oodlp  ai i s)trtr(opoo4ap emnvtlt)srtrumoot0opxniictydla2ulnvo;t)aeermo iotfatrauvo t srtoim3no1lpte fvs tfaDur(mpoo4olxoifeiys mDrmnvo u4trtrxfctytoate n sl() 2xm(o ny1al nlietl(fs2tm(rpnu0altoioctlsfmDuauvp;u4 exrmf io1omD an ilt setoxmpiodopee ivtatfaDta(m ;t1aptn fciltfa eauvo u)tltoif3tadlaD  u i t0s2toim ny4opeemictls)artr(rpot4tpt  feiat a um( ont4areomociydom e ues t) rtm(r3ny1am emnci s aDtmxro;o1opeomfcias s umumo;t0 rermociadla   n s t) etmxm ou4lltemncils sDtaurp;t0oee  fetlt m rl( snt)arxnxr iydfpDe neols seumxo iu4openlicils  Dtaumo;u0olx  ietltfs emnvonu4altoxrcio1latraivs;s0texrimpoydlmee iet s  rur(mp;o4tle iictldls2ul(mp t0teermo3ty1fateai olt s2uo(opio1ameemiesl(faDumxr ;u1tpeoiicild a2em(vo;u) lenxf3oatfmtraivsl(0trxoio oudlltn nvt s) Dtr(m ;o0aleo o3tldlm2emnms () eeoir oy1op rlnvo;t)s2tr(rpio4aleemictlt)srrm(rpno1tptoio3iydfm eanvo t4arxrmf iy1opt aies;(0texmio3iy4ome  iei tfsrrmx o;u0aet  feiysfm rau p;t0trenmo3iatlmDrlueo;(0sruoio3ou1oleelicsat)arraxr ou1tlxo f3iydls ranvp u4altomo3tydlmt li i s srtoiopnydlmt mncils  Drmxmo;t0aee  ictltfm2rlnvpn(0tetoirctodfm rlieols s2xmxm3oo1ape liet ()sDrrx  ;t4ape io3iysfsDulumon() etomr3todoptrai i s teto(m3oodllee neiasfsruau  ;o4ape  oeiadfmDeaums;u0aetomrciadomD  u o t sexm(opiy4lm n fesas  Drrumo;u4oet  f3tld m ea(vsnt) lxnmr3tytlat  i s s0s2tr(r nudame mivs t) 2tr(r ou1tetoifetytlm rm( pn(0trenxrcoy1lpDraivs (0 rtoir no1llen fvtas)artaum ot1oeeniictytlsDulums;t0aetoxo3oo1omt aueilt0 exm(m3iy1ale lfcslt)a2tm( ono0tpe  fetlt m umnvs;t)aetrifcootlptrlivi;() rxoxm nydlpte ncs ( a2umxr ;u1apxomoetadfm2emuvo;t0 rerir ia1lp e u i s0trxmxm3oy1ol nmnvsas)srtr(ro;u4tleomfctls sDulu pnt0trtoifctotfmtraies t0texm(m3iy4oltn ivslt)arrmxmonu0altomfctatfs2ra(vsnt)tltoxf oo1lmtelu olt0 2uoir iodapeelfei s)sruax  no4tpt  fciydfaDua(ms t4 rtrxfcoatlaDraivi s0 etoirpiu4aptelnviltfaDur(m ot0oetomo3iat s el(vonu4aeenmrciatfmDraneo s t2xmxo ny1altemneta(  2urx pnt4aexomictytla emn s;(0tlenir todomDeai i (0srxoxo nu4lmeelneslt aDra(  nt1apxnmo3tysfs2ul( o t)aetrio ta1omtelu ilt srxoxm3iy4oleemictl(fsrta( pou0apeo iciytla um(vo t0trxoir3oytop r ieo ()s2toxopiodameemivils sDtrur ;o4aeto o3tysfa2rmums () rtoxf iotlmD aivs;s  etr(o oo1omee nciat srtrx  nt0tlenmo3ild s ea(mp;u0arerxr3oy1la eanvi () rxoim nydaltnlfes t)srtrxrpou4aexo o3ias mDulums;(0 reoio3iatlm rlnvi;t)seuriopno4llenlnes ()artmurpot0tet  ociad a rlnmp;(4 lxomo oodfm  aues t seumim nydop n ncia()srrm(m ;t1altniieilsfs eln o u0trtnxrcoatlp r u o;t0setmim nudlpe lfeslt aDrau pnt4open oetydfa2emn p;()tlerxr oatfmt  n o ( texrir3iodlltn iesat  Draur ;o0ale mo3iad a2elnmp ()artnxr to1lp  au i s  eurio3iy4olte ivtl()a2rru oou4tptoiocilsfm2um(vs;u0 exnxr ia1oaDe u o;s0t2xm(o3nodamtnmies t)srurx p;u0oexo fctysfs ranvp;(0 rxnio3oatlmtelnvi;(  2uo(rpou1ole lfei ()s2taxmpoo1apx mocildfmDranmp;t0arxoiocoatfmtean il()sexoim iu1olenlietasf Drrum ot1tlx mocias aDua(msnt4 rtoir tadfp eau olt0t2uoirpiy1olen nvt s) Dra(moou1tee mfeiysla2ea( o;t0aexrmfcoa1faD livo;( texriopiy1ap nlfci t s2rm(rp;u4oee  ietatls el( snu4tlerio3io1fm   uvo t0trumxmpio4amtn fvs ()s2tr(rpoo0aetniicilt sDuanmonu)teeoxo3iotopte neilt  rto(opiu4lptnmnvsls artmur oo0openifciytfaDeauvpn(4trenif3tatop eli ils0 rurim ou4amtnmfct (f ruru  ;o4tltnifetltla ulu s t4tlerir iadop elueilt0t2toir nu1llt lncslsfs2rrumoot4apeoiietyt mDraumpnu) etomf3todlm  an o;()sexmio iydope  nci sf rtrxr nu1alto ociatls2rlums;u4trtnxf3tytom e iesl(0teto(opno4ol nmncil(fa2taxmp;u0tee ii3iaslaDua(vp;t)arerxo oo1fm rauvo;(0srtoir nu4lptnmnei t)sDuaxrpno0olenif3iltla2ean ont) lxoxo totfm  lies s0t2tmxr3ny1apt  fct t srur(rpnu4tlxoioeiadfmDrln p (4 exrxo3iytfp eluvils)t2umxo3ou4olt mfes t  rrr(r oo0aet iociadlm2ranmp u0 lxnmf oytom r nvi;t srur(rpoydole lfcsltf Duau oot4aeeomfeiad s raumsn(0 rtnir3oadfpDeauesl(0seurirpny4olen iei t)a2um(r ;o0aex  feiydfs em(msnu4alenmrcoydlpDraueo;(  rxrio ny4al  mivtlt a2tax  ;o0opeo oeiydfs rl( pnt4aetnirctadfaDelnvi t0seumim3nodomeelicsltfarrmu  ot4alxn iciatla2ul(vs t0 reomo3ta1fmtelueils0 eur(m ny4opeemietlt)s2uax
\ No newline at end of file
@@ -0,0 +1 @@
+ies;s0t2xmim3oydom nmnvt (  rumxmp;u1oexomf3tat mDemu o;t0trtrmo3tatoa elies (0texoxopoy4alt lnct tf 2urxr ;o4oet mictat m elnvs t4tltnxrciy1fpD  nvol(0trxr(rpnydlltnmiet t)s2rrur nu0tleniociyt mDua(mo u0texnxoctatfpt lnei;s srum(mpoudop n nct s aDraur ;o1oetnmoctasla ul( p t4 rxoxf iatfpD lnvils0 2umio ou1lpen ncia()srtm(r ou0aetnifciysla2raumo;u)arxrio3iatlatr nvo;s t2xrir3no1omen ivtas  Duaxrpnt0tetoif3iatfa2uau pn() leoir3oo1om  li ilt0 ruoir3ou4om emfvi tfs2urum oo4aeeo f3ias a rlnmo u0 lenxr3to1la   ivol( s2tr(rpoodam e ieil(faDua(mo;o1tptnmieilt a uauvo;t0alxrif oydlmt  uvi t)t2xm(mpiodame  ics t  Drrumpou4teen feiasfs2um( sn() rxrio oodlpD  uvs;( t2tmio nu4lp e fcsl(faruax poo4tpto i3ild sDel( o;(4texnxfcootfat lnvi ()trtm(r3ou4ll   fvtas) Dua(mpno4tptnmoeiadfsDel( on(4texoxr3ootomteluvol()s2xm(m3iydlleelfvi s aDuaxroou0olx  fctldfa2rmuvon()trtoirctytfaDelivils srtoirpio4opeemfvtls  Drmx o;u0tle mocildfa2emnvp u0aeenxo3oydlp elneilt s2to(o3no4ape mnctls) Dumum oo4aexnii3ildfa2ra( snu4 rxoio oo1fmD an i;(0sexrxr io1olen nesa(fsrtm(r ou0tltoifciydfm ulnvo t)aexrir3oodoat  uvs;()srxm(m3oydlpe mfciasfarua( o;t0alt mictadfsDrmuvo;(0trxoio oatom rauesl(  ruoimpoudolt  iesa(f Dtmxmono1oltoifetadfsDrauvs u0 etnio iodlat  uvsl() rxr(opnu1al nmici s)aDurumpou0texo ictltls uauvpn() renxr3tydlmD li s ()sexmio3ny1llt lfvs sfsDrmur ;o1opto ocilsfm ranmsnt4altrmo ty1laD  uvilt  2xmxo3oudoltelnetlsfaDur(mp;o4aleomo3iyt mDulu p t0 rtoxo3ootfpte i o;t0 etm(r3io1opt lnes (fsDuax onu4oee mfeild a2emn ont)alenmr oa1fat aivs (  exoim ou1lp nlfvt t  2urxrpno0ope  ociat s2ea( s;(0teeomf oadlatr u s (  2uo(m3nudlltnlnciatf rumxroou4tpt mfciyt sDrlu o t0 lerio oydlmDe ivols  2to(m3oy1ape livt t)srtaum ot0tltn fetys a2elnmsn(4 rtrxf oytlpte ies;(0 2tm(o3ny4aleelict (farrmum ou4tpx iicilslaDua(mo;t0areriocta1opDeau o;s) etm(o3iu1ameelivt s) 2urx oot0tetnmieiysla2ra(mp;t4 rxnif3iydfpt auei s)seum(r3nodllt mnesl(fsDumu  oo4tpxomf3ias mDemnmo ()trtrxf oa1lmD aies s) 2uoxr3iy1ameelies (fs2rr(  ot1aptomoetyt s2emnmo;u4areoif3oadlmD aieo () rtrxr3no1lme mfeil() Dtm(rpnt1altnio3iytlm2um( o t)texoio3io1fp r ivols)t2umxm3nodlleelfcta()aDumxmpoo4texnmoeiatfs2umuvp (0artrmf3oy1lp eaneils0s2to(r3ny4amtemicsl(  Dur( p;t1apxoif3iadfsDrau snu4trtnio ta1lmte neolt0 etoio3nu1lpeelnct s srua(ront4tlt  f3tltfsDua(vo t0trenio3ootlp rlneo s sexo(r3iu4amtelnvtat)srrmu oou1texoiocilsla2el(msnt0arxnxo ootfp e i ilt0 rtrxopiy4olenmneils  Drr(  nu1aleoioctld sDrln o;u4 ltomrcta1fpDelies (  euoxm no4lpenmfvslsf Dta(rpou4olxoiieiadlsDrmump;(4alenxfciodlmDe nvo s0srxrir iu1lmtn icsat) 2umx  no1aexomfcilsfs2rlumsnt0aeenio ia1oatr ivi;t0t2umim3nydlmeelivi s  Drm(  ot4opt mfcilsls ran o;u0aleoxrcoo1fmDe nei s sexmxmpiodolt mivsa() rumumoou0teeo fctys a rm( snt4 renir oytfpD livi;t0srxrxrpnu4openlnvtlsfsrrr(m nt0apeo ociat a ul( snu0 etrxfciotopteaieolt)sruoir3iu1lpenlnet sf rur(mpou1oet if3iytfm2ua( s;t0 ltrmr3iotoa rliei (0 rumim nydamtnlfes ()srraum ;u4opt mictyd a ulnvp () exomf ootomtrlivs t)texo(m ny1llee feia(f 2ra(r no0aex mo3tad a2ua(mpnt4 lxrmfciydlptraiei t t2uo(opio4amtnmfvils srur( o;o0apxnmieiyd mDel(mp t4teerxr tadomDrlivi;()s2um(m3oydlpt lfet ()sDrr(rpou0apxoioeiytla2umnvon()tlxoiocoytlatraueo;t  eto(m3nydlm nlnet s) rurxr ;t4oee  ictlt aDuln snt4tetoio3todfatr ueolt0 rxoiopoy4am nmictatfarrauronu4olt ifciytfa el(vsn(4alxnxr3iatlp r ues s) rxoir iodalte nvsl( a2trx o;t0tptn ietls a ranvp;u4aleoxo3tytomD  i i;s0srumir3ny4amee nci tfsDumum nu0aeen fcias sDea( p;u4teenmo3ootlm rauvsl(  2tm(r3nydal  lncta(fsDumxm ou1tlxo o3tld m elnms u4tlxoxo3iy1lat lnes t tetrxo3nu1llt lict sf Dumumpnu0oeen f3iys a ea(vs (4aleoir iytlpt  nvsls)s2trxm iydol nlnviltf 2rmxmpnu0olenioetatlmDra( sn(4tlenmr3tytom raneols0sexoxrpiu4om nlfeiltfaDra(mo;o1aee  iciatlsDrm(vo u4arenir3tydoa ran ol(0 2xmxm oudll nmict () Dtrx  no1tpxomiciytfsDraums;t)areomociatfm r iei s) etrxrpiu1amt  fetatf 2rru  oo4oltnio3tls a2emnmpnt0 rtnmfctytlmteluvo t texoim3no1lmt mfci t) Drrx  oo0aleo i3tasfm ra(ms;(0teeomrctodla   uvi;s0 rtmxr3oo1lmtnmfvtat) rrmurp;o0tlt  ietyt m rm(vo;(0arxomf iy1lp  lies (0trtrxmpoodomt lieia( arrmum oo1opeoiieiasfmDrl( o ()arxnir3ty1fpt aiei;s  2urxm iydoleemfei (f 2tau  ;o1aptn o3iyt sDel(vont4tetrmfcta1oatelu i ()seuo(rpnudlmt livs tf Dtrum ;u0alxnmi3iydlm uan s () rxnmr3oy1oaD  uei;t0s2umxo3nodlmtelfeiat) 2rmumpot4oeeo fciatls2ea( ont) ltoir3oy1lmt liei;(  2xoir3oydoptemncsls aDum( onu1aetn o3iadls uluvp;() lxnif3iatfaD  i s s srxrim ou1lp elfvtas sDta(rp;u1oltn fciysls2ra(mo t4trerxocoodom elues t0 2toiopno1lpee iet sfsruaurpno4aptomo3tydlm eanmpnu)texnxr iatlmt aueol( s2xrio3iy4lmtnlfcsls)s2tmurpnt1aetomfeiytfm2emn p;u0alxrir tadlptelnvslt0t2xr(opoudolen ies s)srrr(rpou4opxniieiytfs uauvs;u4aetoif3oodomDrau o t0 2umxrpno1omenlivta(  Dtrxro;t0aetn ieiadfs2rluvp;u)tltnir3oatlp rlu ils0 etmir3oy1olt lfesltf 2rmxmp;u1apto f3tltlaDumnms t0alxnxo3oa1opte u o;t trtrxo oo4aleemncia() Dra(rp;u4teeomo3ilsfa2umn p;t)alerifciytomDr u i;( truoimpno4lleemnetl( sDta( oou0tlen oeildls2umumo;t4 lxnxo3oo1fpteaieil(0 eto(mpio1lp n fvi ()sDrrxr ot0aetnmi3tytla2elnvsn(4tltnxrcio1fm e ieols0 eto(rpiu1lpenlneias)a2um(rono4tetnifeiyslm2el(mo;t4 exoxo ia1latean s ( trxoio nu1apeelnci tf rtaxroou4optnio3iad s2ul(vo;t)tlerxoctatlpDr uvo;()tetmir3nodop  lnvilsfs2tr(rp;o1tlxomociatla2emums t0trtnir3ty1lpt  uvs;t) rxrio nodapee nci t) Duaur ;t1tle  i3tydfa2uanmp;() reomo tadfmD lieo;s)texmxm oudlm  mfct s aDtr(  ou4aexomfetls m umu onu) ltnio oatfmD  i il()t2tr(opno4om  lfctl( s2uru  nt4aetnif3tls s2rluvs;()tlenmocto1lmDranei s0t2uoxr ny4apeemfcs (f rta(m nu0olt  fctldfm2el( s;() rermfciatomtr n s t0s2um(opiodop nmiet () 2ua(mp;t1aet miciltla raums;(0teerifcootlp e uesl()tetm(o3nu4om elfci t)sDuaumo;o0tetoiieiyd mDrlnvp;u0artrxo io1oa e uvils) rum(opnu4lptnlncsat arrmxrp;o4aeeomf3tadfm rl(vs t)trxnxr to1fate u i t  2toxm3io4aptn fct ( s2rax o;t4aexoio3tysls2ea( o;()alenmf tytfp eln il(  exr(r3no4apeelnei sfa2rau p;t0apxomoetls a2raumpn(0 lenir3ia1laD  ies;t  2umxrpnodam emieils)sruaurp;t0tlt ifciadla uanmp;t) eeoxo3oy1fa raueo;t0 eurxr iu4om emfctlt) rtr(rp;o1altniiciaslm em(vs t)altrmo tadfmD livi s)sexmim nudame mnci s)s2rm(r ;o4ale mo3tys s ul( o u4areoif3ia1opt li o;s)s2xr(r3no4omtemfes t) rumxro;u0oetnmi3ils s2uauvo;u) rtnxr io1lmtrau i;()s2xoir3iodlmee ivi s arrmumpou4tlto f3tldfm rm( o;()trerxf3oo1lateln s t)seuo(o oudlltnmivi tfaDur(rpnu4oeenii3iadfa2eanvont) rerio3io1lmDeau s t) rumiopoy1olt  feiasf 2rau p;o1opxn icils a rmnmonu4aetrircoy1om  aieo t)teurxr oo4ap   icta()aDur(  ou0oeeoif3tlt aDrm(vp (4areoxo3oodla rai o;( trxo(rpiu1om nlnetls)s2taump;t1optomo3tad s2ean s u)artomr oa1fpteanvol()t2urim3nodoltnlnetlt)artrxmono4opt io3tyslmDrmumpnu) rtoxfcoo1lmteai s;t s2tmir3io4lm nmfvtl( a2rrxm no1opt iociadfs rl( o;t0aetoxf tydoa rluvsl(0texoir oodoleemieta() Drruro;o1ole mieildlaDul( sn(4 etnirctodfpDelneo;s)trxm(mpno1opee ncslsfsDtr(r ou1olxoii3ilt sDeau o ()trxrio tydlpDrauvs ()s2xr(o3iudlm e nvi s aDrr(mont4ope  i3iadfmDelu o u0areomr tydoaDelivi s)trtoir3iy4al emnct s)arta(rpoo0tlxn o3tysfaDrm(vo (0teeomo3iatfmtr i o t texrxrpiy4ol elncsa(f Duaum ;u4opxomo3tltfs2em(ms u4 lerxociadlateluvo;s t2umir3oo4omt  ies (fsDtau  oo0oex  octydfsDeanvs;(0 eenif3oa1opteaies;s)s2uoxr oo4lp n feil(fs2rr(ronu1oetniiciltlm2rl( o (0 etnmo3iotomtranvs;t t2ur(o3oodlpee ivi ( srtr( p;t1oex mfeilt mDumuvp;t4trxomfcia1oat lnei ()teuoimpoo1apenlnvi ( s2rax  ot4tetoiieilt s2el(mp;t0 rxoiocoo1fp  lueo;( trxrxo ny4oltemici t a2urumonu0aexnii3tyslmDem( o;u)tltomr oytlm rln sl( texrxr iydlpeelfci (faDtmx ono1olx ifeiydfs2rl( p u0 leomociotfpDe n s;s)trto(r iydamee netatfaDtaxm nu1oee iieiytlmDul(vs (0 lxrmfcia1lp  aieo;()s2xo(rpoo4lle  ies s s2tau  ;o4opt mociys aDul( pnu) rtnir3iy1lmtrli ilt0 2urir iodop n iet tfaruru p;o1alxnmi3iadfs rm(mp () eenmr oytlmteaivi s srumxm3nu1alen fes tfaDraurooo0ope  oetydls elnvpnt)aeermfcia1fmt an slt)setm(mpnu1amen ivtlt  rrrxmp;o1olt mietys a2ranvsn(4arxnxfciotop   uvi;s texoiopnu1lle lnvi (f Draurp;o1openifciys a2rm(vpnt4 ltoxr3ta1la r n i (0 rxo(m nudlltemivi s)aDurur nu1oexoii3iyd m2rm( p;(4trxnxrctotlmD luvsls0srxo(o3oudlmtn iei t  ruaxr no1altomf3iydfa2uluvsnt)tlxnmr tytlm r n o;s)srtrxrpoodop nlieiat aDrm(mo;t0tltnii3tlt aDumuvont) lxoir ia1laDe i i t) 2xrimpoy4lmee fci t  2rrur no4oexn i3tytfs elu o u4trtrir oy1optraivilt s2xrxr3iodoltelfeiltfs2trxro;u0optomoeiad m2rlu s t)tlxoxf oa1lm rlnvslt trtoxr3no4lp e fesa()srraur nt0oee ii3iatfs ra(mp;t)aleomf ia1om  lu s;(0seurir ny1ale livi s) rumu oou1apxnmoeiadlmDrmuvon()trxnioctydfatr u o t trtm(r3io4lmtelfvil( s2tax onu1opx  ociatfaDuanmp (0 lenmr3iotfmD  iesl(0 2trirpoy1lltnmivtat)aDumumo;t1oet mo3iysls ranvpn(4tlxrxr iatfate u ols) etoir3nu1llenmfvsl() Drmu oou1alx mfcilsfs2elnvsn() rxoir iotfpDeaivolt)texmxopoydll n fcsl(farrru  nt1alt mociydlm2emnmp t)aexomf tytlp eaivi;(  eto(m ou4lp  licias s2taumo;u4apeoifeilsfsDemnvo t4aexrxo3oa1oaD anvslt setmxr3ny4om nlicilt)aDrmxrono4aleoifctyd aDuluvpnt0altoio iatfm   nes;( srto(m3nu4al nlfvsl( aDurx pnu0apeniociytlm rmumpnu0aexoifctadlpte i olt0t2tmxm oy1lm e fcia( srtmur nt0tlen iciyslaDulu o (4texrmf3iy1lmtelnes;t  2uoxr3oy1op   fvias) 2rmu  ;t4tex  fetaslmDrlu pnu0tetomrctotoaDe n ol(0sexmxo3oodamee fct t) 2umxrp;t4tet iietyd s ra(vpn(4 rtrir3oytopte i o;() eto(mpnu1olt liviatf 2tm(mpoo1tee  fetldfs2rau p t0 eerir3ty1oa   ivi (0trxrxrpnu4am nlnvt t s2ra(mo;t0alx iicias s ul(vp;(0alxrif3iytfa rln ol(0 2tmxo oodap   nct sf 2rmu p;u1opt moetldlsDeaumpnt) eenxr ootlmt an i (  2tmxm3iu1amt mfvta(f 2trxm no4ope iieiadla rmuvon(4teerir iodlmt aneolt) 2xr(opno1ame  fvi s a2rr(ront1aexoiieiydfa rmnvp () exnir ootlaD luvol()trxo(m3nudape  ies ( s2rau oou1tlxn ictasla elumo;t) exnmf3oa1lmDeauvs s0trumio iy4apenmies tfs2rauronu4tptnio3tytlaDelnmo t4 exnio oodlmDeli s;t) rtoxr3ny4omtnliei t arrmurp;o1tlto icias m rmnvs;u) etomo3oydlm  li ils0s2xm(o3oodom  mfeiat)s2taum nu1opt ioetls a ra(vo t0texrxfcoadfa  auvsl(0trxr(mpiu4lptemfesasfartrumpoo1ale mf3iaslaDrl( o u4arermo iotfp  aies (  rtrxm iydlme mneslt artrx pot1tlxoio3iydfa uan ont0 leoxr oy1opD au ilt0t2toxr3iu1opee fcilt) 2uaum ;o0oetnifeiydfm2raumont4trenmr3ootop eau s (0seurxm oodoptemict s  Dururooo0tltn icildlm rlnvsnt0treoxo3to1fat anvi;t) rumim iy4lmtelfct ()srrm(m ou0ope iiciys s rm(ms u)tlermr to1lmte n s;s s2xoir io4omenmncs (f rra( pnu0tleomf3tldlsDemnvo t) lxoxrciodlpDrlu i;s  exr(opoydolen nei tfsrrmxmpou0aexnif3iyt s2rmnmo;u0treomo iodfaDrai i;(0srtoxopiy1ap nlivil()arraxrp;u0olx ifctldlmDemnvpn(0aexrmr3ta1lmDe uei t s2uo(o io4altn nvsls) 2tmu  ;t0opeomo3tld s2rlu o t0 leomo3iy1lmtranesl(0seumir3iu1ll nlnct s)a2raxm ;u4ope  feiys a rlumsnt)aexomf3ootopDelnvs;()srurxr3oo4lpt  net ( s2uru  ;t0aee  ociaslm uau onu)teenmr oadlmDrln o s  etrxr3iudlltnmfvsl()srrmur ot1teenifeiltfs ranvsnu0treomo3iytoat anes s)srxoxm iydap   fvt tfsrtmx  oo4oexo feiytlmDem(mo;u0 renif3totopteau s;( s2tmxr3iu4ap emnct t)srtmu  ;o1tle mo3tldlsDuln p;u0aeeomocoytfmDrliei (  rtm(rpiy1lmeemfvtasfa2um(rp;o4alxomieiytfs2emn p t)arenxr iy1oateauvol()teurimpio1optnlnet tf rtaxmp;t0tpxnifetad mDeanvs;(0trerxo3tytlmDeau s;(0tetm(o3oy4om  lnviasfs2truroou0oltn ieiydlaDulnmo u0trtoifcoytopD lues (0s2umxo oo1olee ivtl( s2raxm ot0tpx mietatla ua(mpn(0arxnxf3iadfpt li s;s srtm(rpiudlltemnetatfs2ur(mp;u4teeoifciasls2umnvs;(0altoio ty1lpte i ol()t2xo(m ou1ap e ivs ()s2uau poo1tlt mfciltla ra(mpn()alxrxf iytoatrln s t)teto(m oo1lmtemicsasf 2uaxrono1open ieiyd a2umumo;() renif3iatoa rluvsls)trtoxo no1lp e fvtasfsDrm(  ou0apxn o3tlsls rl(vpn(0 lermo ta1om eli i s0 etr(o3iydamt  ncslsf 2trurp;t1texoifctad mDemump;(0 eeoio3tadlmDraneols) 2toio3oo4op emivsl( a2ur(  ;t0tex mo3iltlm2ul(vonu4 etomo3oydoa   i o;s)s2umio3iy4lpen feslt s2uaxr ;t1opx ii3ilslmDemu snt)trtrxf tydfateauvo;s0setoxrpoy1lm elict (f rurxr ou1oltnioctlsfs2eaump;u)aetoif ty1lateai i ()trtoxr3oo1om  livsasfa2tr(  oo1olx mocild mDulu o t)trtomrcoo1lmDelivo ( s2tr(rpiudom emfvsls)a2rmx o;u4oetnmf3tldls rl(vont4texoxr to1fmDeli o;s)t2xrim3oy4lm elnvsl(f Drmx  ot4aee  feiat aDum(vp;u4treoxfcootlmtr i s s  rur(rpiy1omee nes (  rtmxrp;u0aleoifeild a2elnmp;(0aexoio3iodopDeln s (0srxoxr3nu1altnlicta(fsrtaxroot1texnmoeiasls emn o;(0trtnif tydlpDeln s (0s2tmim iy1omte icsls)s2tmxmo;u1tlt  fetldfmDumn snu)trtnircoytfat aivo;()sruoxopio4amt mfct s)sDrmxm nt4opt  iciydfm rmn snt0aeenxociatlmt livols)srxm(mpno4om  mnei t) 2tmxmp;t0aex ioetadfm2ul( on(4tlermfctytlp r uvi;s t2uoxm3ou4lm elnvt t arta( oot0tlenmfcildfsDelu p u0 ltoxfciy1lmD aiei;s0srxmimpiodlle lnetltfa2rmum nt0tex ii3tldfsDua( s t4tltrmocoa1lptrln o (0 rtrxm3iudlpt lneil()sDtmx oot4tex ifetadlmDumuvs (0arxrir iydlaDelieo s  rtmxo ou4ol nliesls  Dtrxroot1oetomiciyt a2rm( s (4tlxrmf tytfm   n i s) eumirpoo4lmenmieias)srtm(r ou1olto i3tldfs rluvo;u4 eermrctatoaDelnes;s0teurxm no4alt  ici s) Dum(  oo1olxnif3iltfsDulnvo u4areomfcia1lmtrlivo;( s2um(o nu4lm n ivsat)s2trxmp;t4tee  feiytls rmn s u0 rtnmo3oodoptrai slt0 rxoim3iy4lltnmnciasfaDrmx pnu4oeenif3tlsfaDrmu o t4altnxr3iadoptranvo;t0tetrir oy4al n ictatfsDrrxrpou4alenioeiys sDea(ms;(0 lenmocoy1faDeau ils t2xm(rpoy1omtemivt sfsrraur nt4opxnifciyd mDulnvp;t) exoxfcoo1oaD lieslt0seuo(o iodam nmnetat  2tmu ooo1tpxnii3ilsfm emuvo (4aleoxo3tytla ranes;t0tetmxm3ou1lmtelivt ()sDtaxmp;u1teeo ietasfs rmnmp (0aetrxf3ia1lpD luei t sexr(m3io1ome lfvtls s2urur ou0oee mfeiydlsDrlu ont4alxrir io1lmtrluvo;t trumxr3oy1lm nmnviat artrx  ;u4aeen fetadfa rauvp;u0tlerir3tytoaDrluesl( sruo(r nodomte ieiasf rurxmpnt4aex mfctadlsDeau pn(0tlenmr to1omDraieolt  etr(r iudome mfei tfsDtm(r ;t4tlen i3iadls rm(mp u4 eeomoctydom rlu ils0tetmxm iudoptnmfvslt) Dtr( pno4aleomiciytfs2uaumo;t) ltnmrcia1fmteli i (  2xr(r3ny4ll  lncsas sDumx  nu1teen oeils aDra( on(0aleoxo3iadla elivil( tetoio3oy4om e ncslt artmump;t4opxo fctadfa um(vo u0alxoir ootoaDeanei s  rur(mpoo4lm  lnctasfsrtmx ooo4ole  oetadlm ua( p ()aeermf3oadlaDrlivi s trtr(o3io4amtn fei () rua(rpnu1ale  ieiadfa2elnmp u4 lxoxoctytoaDe neol( s2urirpnodal e nvs ( a2urumoou0oeenifeilsfsDuauvsn(0tltomo3iydomteli o t texoir3no1am  mieil(  rrm( oou0tpe ii3ildlaDelnvo;(4trtrircoatom e u slt trumxr oo4op emivta()srrr( pnu4tlxoif3iysfm2rl(vsnt) eenmf ta1optr ues (0trtrxrpio1am  licilsfsrtmu  oo1tptn o3iydfsDrluvp ()altomoctytfmtr nes s  euo(rpoydom  mfesl() 2ra( o;u1altomfcilslmDrln p;(4tetoxf3oy1fat auvi t0teumio3iydal  lneiltf rrmx  ;o4olen oetadfs2rmnvs;(0 etnmf oodoaDeai ols srtoxm ny1apen ncilt srum(m ;u4ope  o3iaslmDeln snt)alermr3tytla elu s ()seurio3io1optnlivils arrmum ot4oetnmociadfs uluvo;()aetoxf iotoaDrlu o (0 euo(o3oodlpe mnetlt arra(mpnt0tpxoioeiysla rmumpnt4trtnmf todlmt  i sl(0 exoxo nu4ap emivs t)sDtr(rpnu4teeoiieils a2uanvp t4artomrctodlaDe ivsl() rxrxo iy4lp  lnvtat) rtmxm nu4aleoifciyslsDul(vs u)tlxnir io1laDe ieo;()truo(opiydom nlnesasfs2uax  nu4olenmfeiysls2ra(mp u) ltoiociadoaD aieo (0seum(o3ou1altn iei (  2tmu o;t0tptoiocils m ran p u)artoxfcoadlpt lnvil() eurim oydlpe lnvi t)aDtaxmp;t0teeoifeiat a2ea(ms (4 leoio3io1oatrluei s)s2urxr nydamen ivta() rrrxmoou4olx  iciad a emnmo t4aleoir3iadfmtelivolt)srxoxm3nodom nlfcta()sDraxroot0optnioeiys a rlu s t4texoxr3iodop r uvo t)s2xoim iodlm e nvs sfarraum no1tlxn i3ilt s el(mo t0artrmr3io1lat ai i ()t2trxm3no4ame lncsat sDum(roou1aptoiietysfs elnvo t4aleomr iytfat livi ( t2toxm iudal nmnvi s s2rmx pno0alen f3tld m2uanmpnu4aetrmf oatla r n s ()srumxm oydom  mfvta(  Dtmur ot4apeniicildls uanvs;()aexrxrciy1omDr i s t)tetr(mpoudlpe  fcs t aDrmumont1aexniicils aDumuvo;(0alerifcootomD livo () 2umir3iy4llenmneias aDra(mooo1tlenmiciydls2ra(mon(0areniocoadomDr nvi t srto(rpiodapenmnct (f rtr( o;o1olt  o3iyt a2uauvo;t0trenxf oatfa elivil(0t2toir3iu1alt  ics ()srur(rpoo0opxo fctltfaDulums;(4treomo ia1lm   n sls trtoxo3ou4alenlfctasfsDtmx ono0optnmieiatfm2em(vp u4tlerxr3oydoaDrli o;()teurxm3no4lme  iviltf rra(ro;u4oeeoioeiad m2ul(msn(0altomr io1oate uvo t)t2toio io4ol n neslt) Drrx o;o1aeenmf3tydls rm( snt)altrmfciydlmt au o s s2xmimpnydop e icsas arurum nu4oex moctyt m2rauvp t4arenmf oa1omDrlieo;()sexoimpiu4aleemieia(  rta(mo;t1tex  ietlsfs2uanmo (4areoxociotfmDe nei;s0 exrxrpiy1olt mncta()a2rm(mp;o0apt  ocias a emuvo;u) rtnmr3iotfp r ieol()trtmxm iudalt  ics tfsrtmxr ot0olx  i3iadfm emuvs t0treoio oytfa elivi t s2tmimpnu4lpt mnvsatfsrrrxrp;u1tptn ociydfa rauvsnu) renmr oo1faDeaivs;t setmio3io4oltelfei s) rur( o;o4alto f3tasls2ul( pn() lxoiociodfat aiei;t)s2toimpoo1al   nvi tf rtau  ot4tpeo ietatls rlumo;()texoio iy1oatraneol(0t2xrim3oy1lmtnmictlt arra( poo0oexo oetlsfsDemn pnu4artoxr todfaDr n ilt0s2toir3nudlm nmnvil()s2urxrpnt1tltnio3iltfsDrmuvpnu4teenir3iadoa elu s ( srxo(o oy1lle  nvtls)a2umx ono1tlxnmoetldls2em(mpnu0 lxrxo3tatomtraiei ( t2tmxr3iodam e fcsa( s2tmx p;o0oet moctatfm2raumo (4aeenif3iotoat li o t0 exrirpiudomt mfeil() Dtax onu1teeo fetyslsDelump t)aexrif iy1lpDrlnvi t s2to(m nu1lmtnmnvil( a2trxm nu4tetniieilt a2ua(mpnt)tltrxociadomtranvo s s2xmxm iy1lmee nvia(  2ua(m ;t0tex mo3iyslm ulnvp;u0texoif3iydfm elivs s trxo(m3oudol n fctat)a2ur(rooo4aptnioeild mDeaump t0arerif3todopDeluei;t)t2tmio oy4om emiviatfs2trurpoo0apeomo3iatfs elump;u) ltrircio1oa e u s t0s2uoxmpoodom elfviltfa2rmumoot0oetnmo3iaslsDumuvp t4 etnmr tytomD lnei s0 exo(mpoudop emnvs ( srra( o;o1aleoioctydlaDranmo;(4teermr oy1fmtrli s;t  ruoxmpoo1optn fvsatfa2ta(rp;t4oex  i3iadls2um( sn(4tetoxr3iatfa   u i;(  exr(o3nu4al nmnetltfa2umumpot4tpt ioetltfa2ea(vpnu) rxrxrcty1lp   n s;()seuoim nudll nlietas aDur(r oo0texoiieiysfm2em(mpnu0aexomf ootopt  ieilt0trtoiopnu4lme mfesa(fsDrrxm ;t1oeeomfciasfsDua(mo t4tlenirctatfmtrlivo t) etrxo3nudameelfcia(  Dtrum ot0aetn i3iyd s eauvo;t) lxnmfcio1lmteluvi;t  rxmiopnydlpeemicslt  2tm(mo;o0olxoif3iatlmDranvo t)aetoxr3ia1fm rln s;t sexo(opnu1opee ieias srtaurpnt0aetn ictas a rm(ms (4aeeoxf tadoa eau sl()seuo(m3oodamenliesls) 2ta(  ;u1apxnmoeiltlaDemn s (0tlxoifciatla eluvil(0 rxoir ou1omenmfes sfsrra( pnt1tpxo fciyslmDrmu p (0trxrxr3oy1omt lnvs s) rtrirpoodlmt livtls a2taxmont0oeeo ietatfa2rmu p;t4aeenmrctotlmtranvols) rtriopno4lp elnvia(f Dtrxmp;o0opxn f3ildfmDeln o;u)texnxr3iydfatelivs t0teto(o oy4am emfvtlsf Drm(r no1aetomoctatfm2eanmsnu)aexrxocta1lmD lueo s texo(m3iydole lnvi ( s2uru  oo0tpe io3ildls uluvonu0 eermr3iotfp eauvi;s  etoxm3iu4lpeemncsas)sDrrur nt1apen feiysfm2rmumon(0 rerxo3iytomDr ies ( trtmiopiudlpee fci t)sDur(r nt4tlxoifeildls rl( o;u0alenir3iadoa r ies s0trtr(r no4lm  mfei (fsDtmuro;u4aleomi3iatfm2ul( pnt4arerxr iytfmte n ilt0t2xoxo3io1lpte nvsas  Drrumpnt4apeomocilslm ran sn() exnmociydlp   nes ()trurxm iy1omt mneia( sDtmurpno0alen ocilslmDem(mp t4aeerifctatoa eai s s0seto(r3ou1omtnmnvsl()arur(rpot0openif3ias sDeau sn(4 rtrifcoy1fatelnvslt  rxr(o3oo1lp elnes ( a2umum no0oee mf3iatls2ul( o ()aleoxociytfmtrlivol()t2xm(rpny4al nmnes s aDtm(m no0altn i3ild sDrauvs;t4 etoxr3ty1oateanvo (0trtmxo nydlptelfctat arraxr ;o0oeeo iciytlmDraump;() ltoxr oy1fm  an ils  2uoxr oydlltemiesa(  ruau  ;t4oet io3iyslmDua( o;(0tetrir3ia1lmDeaivi s trtmim io4om elivsl( aDra( ono4aee ifeiydfm2emu s;u)tltoir3ia1fmte nvs (  rurim3oo4olen fctat srrmx pnu0oleomfetas s2uln s u4arxrxf iy1oatelivi;(0truoxr3nudaltelnvtas)s2rmxrp;t1tptomo3ild sDua(vo t0 lxoxo oadomDraueils) etoxo oy4opt  iesa(fs2rrumpot0tleo i3iyt s ranmpn(0alxnxocoodfpDeluvs s0 euoxrpiodolenlivtl(fartaxrpnt4aptnif3iyd s2ulnms;t)tltoxrciytlpDraneols0trurxo nu4ll e nvia( sDumu ont0tetoiicilt aDel(vp;u4aeermocoy1lmt  uvil(0setrxo nu1lpenmfcsl(  2rmumpoo4alx  ociyt m emuvo t4alxoxf ootfm e uei (0teumiopiy4ape mfviat srtrump;u1tetnif3tlsla2rlu sn(0 ltrxr3iydfa   n o ()trum(mpou4omt  ivs (f 2raxmo;t0ope if3tat m rlu s;t0 exrxf3totfp raivolt)teum(m oo1optnlivt s)a2raurpot0tpeo ictatfa2rmu s;u4tltrir3totla elnes;t) rtrxopno1lpe  ivtls)sDrm(mo;o4tpeomfctys sDem(mp;t)treoir3todlmDe nvi;s) etr(r3nydamenlnvia()srtrumpnu0texoioetysla2ua( onu0aeeoxfcoatoa   nvi t) eumxrpiy1ap elneias)sDtaur nu1oexo i3tad m em(mp;(0tlxnmr todfmtr ivo (0t2umirpoodlm  mnvi t) Drrxrpnt0tetomf3iatfmDemn snt0 etrxo3iytfpDe iei;s  rtoio3oo4ape  fvt (f 2ra(rpot4openmo3iadfs ulnmo;(0tetrmoctotoaDe n ols)srxmxo iy1llen icsas) rum(rooo4opxnmoetatls2ra( s;t0alenioctatla  auvo t0s2umxopio1aptnlfei s)arrr( ont0tpt  fciadla emumonu0aeeomoctydlmDe n ils  rxmxopno4omee ietl( a2rau  no4apxnio3ils sDumu o (4trerio tatopt ai o;t)trurxm3oy4alt lies (  Drrurpou1tpeomieilslmDean pnt0artoxr3tatoa eaneols)s2xrxrpno4aptn ivt (fa2trx poo1tpxomoeild a2eluvsnu0treoxfcta1oa rlnei s)srxrir3iy4am elfvtl( s2rrxm ;u0apxo i3iasfsDelumonu4texrxrcoadoa  ln o;t t2xr(o iu1omenmnvtlsfsDta(  ;o0apeomfcildls rm(vs;u)arenif totlaD  uei;s0 eumxopiudamen nvs sf 2rr(mo;t1oex miciys sDum(vp t4aexnioctadfm rluvols s2xrxr iudlmtnmfeiltf rrr( pnu0tpeoioctat mDemnvp;(0tlxnmo3oytomD livi () rumxr3io1llee iciltf rtau p;o4tlxoifeilsfmDul(vpnu)alxrmf ta1lmDr uei;t0tetmxm3io1ap n fvtasfa2urump;t4optn ictatfm2rlnmpnu0tetrmf iy1fa elies;t trtoimpoudlp  lieta( artaxrpou0tpx  f3iyd m emump;u4aexrxociytlpD  u olt  euoxr3nu4lm nmiesl(f 2rrumo;o0tlenmi3iasfm2rl(von(0teerxr3oy1fpt aiesl(0 eum(o3oy4optnlfct s)sDumu p;o4tltnio3iad s um( o t0arerxrcoy1omD aieslt s2um(rpoudlltelicils srrru onu1opt mfctatlm2uauvo t)trxoxo3totfaD ai o;s) 2uoxm nudope lnei tfsrraur ;t1alt miciys m rm(vo;() ltnxr to1om rliei;t0 2umxo no1aptelnesat sruaumont0openmoeiltfm2emums t)arxrxo3tydopD livs t teum(r io1om e fvtasf Duau p;t1aexo o3tad sDrau o u4areoifcoodlaD luvi;s seumir oo1omtnmivsl(  2ua(  nu4tlto oeiytfsDrm( o (0 eenmf3iatfmteaiei s  exr(r3oy1alee neslt  rtmxrpou0tlxn f3iyslm2ul(mo u0teerio tadlp   ivsl()s2umxr3no4al elncia(fs2taxront0tltniictys m rau p;u0trtoircta1lpt li ol()t2urio3nu4llt mfct s)sruru ont1teeo fcild m2elnmpnt)treoifcoodoat  ivol(0s2tmim oo4lleelnesas)aDtmu  nu4teenmociadfmDraums t0artoxfcoytlmD aueo;(0srtrio iodlptnmnesls)sDuaxm ot4tpenmfeias m elu o;t) ltnxo3totlm elivo () 2urim oo1llt lfvsa(f 2urx poo4tlt iietas a uaumsnu)trxomf iytlm eliei;t0 exoim nudlpen fvsatf Drauro;o4aet mictltlm2el( s (4 lxrxr oydfmDeaieilt) rtoir iu4llte ivtltfs2urxmooo1apt  f3iadfa2eaums (4aetrif totlm   neilt)t2um(o3no4ol nlnvtlt a2rrxm nu0altnio3iatfaDean s u) exomr iotoaDeaneols0truoirpiy4lltelnvsl( arraurp;u1aexnioctytfmDumnvo;(0alenmocoatomD aneo s)t2tr(r oy4llee nvtl(  rtrumooo0tlxoiiciyd sDuanmp (4treoxo oa1lmte ivs;t s2tmxo ou1olen fvtas  2ra( ono0oleo i3ils m em( p u) rtrir3ootfat lnvo t)t2um(o3oudamen feilsfa2rmu p;o4tptoiictlslsDuln o;u0aexnir3oatlpt  u i;t) 2xo(o ny1olee icsl(  Drr(mp;o1alxoioeiasfmDrl(vs u0altomf3tydfm   uvs t0sruoio3nu4lleelnvtltf Dta(mont0aetnmiciyslm2rmnvs t4alxoir3oa1fateli s;(0srxmxm oo1lm nmfeias)a2umu  nu0oexomi3iytfsDem(mon(0alenxociodfptrlnvo t t2umio3no1lm elicsltfsDuax  ;o1tle mfciadlm2uanms t4 exrir iy1latean i;t)t2toirpoydam   netl(f 2tm(mpou0oltoio3iat s em(mp;(0tleomf3oytlptrauesls)texm(o oo4opt mfcilt)a2rm(mo;o0oet mociaslsDeauvs;t4altrxf3oy1faDe uvi;s) exoirpnudome miesa()s2umu pno0tlenioeiysfs2umn on(4trxoxociadfateaueolt sruoim oo4al nmfcs () 2rax o;u4oeen f3ilt m2rmuvonu0trxrmfctatlatean ol()seto(mpnudopt mfvsat  rtm( p;o1tee ifciys sDrl(mo;(4 exnmo3oa1fm  lueils s2uo(r3io1ope mfvi s)a2tm(  nt1oeeo fciatls2rmu p;u4altrif3totoa rauvi t0 etoxr ny4apenlnesl() rumx o;o1tetnmoctltls emu sn()tlerxr oy1opt lu ilt)seuoxm3iy1lp nlfvtat)artr(mpnt1oetnio3iat s ulu on() etnmf iodop elu ols)srxr(opiudlmt mivtlt artmu  ou0ale iociatfa eanmo;(4tetnxfcta1la rai i t  2xo(opny4al e fesatf Dtru p;u1tltoioeiydls eau o;() rtnxr3tydlpt au s;s0srum(mpny4om nlfcs (  Dtau o;u1altnmo3iatls2rmnvsnt0alxoxr tatfp raieo;()trtoxrpoodomtnlivi s) ruaxmpnt4teeo ieildlsDuan s t4trxrmo3ta1fm   ieo t  2ur(o oydalt mivsl()s2ra(mp;u0aet ioctydla rl( p u)aeenxf oa1omDr ieslt  euoxr3oy1omtnmfcs (f 2um(rpou1apxomictasfa ul(mo;(4alenxr3oodlmDeln i;t0setoirpio4lpe  iei tfs2tmurono1optn o3iytfs2rl(vo t0arenxoctotop   uvolt s2uo(r oodame mfvt ()aDumxrp;t4altoiocildls raump u0 lxomo oa1opDeaivs;t trxmxr3ou1lme  nvia() 2raur ;u1alx moetltlm umu o;u)altnxo tadla   uvsl()s2urxrpny4al  lieilt a2rmxrpnu4apeomf3iytfm ea(vo (4 reoir oydlm e nvi t trtmxo3oo4amenmfcilt)s2taumpnu0tlxoifetld a2rmu o t0 exrxrcty1fmDrluvs t trto(mpoudlm  mfcta( aruaxr nt1oleo ociatlm2uaumpn()aleomociatlmt  i i;s0 rtmxm3oo1olte nci tfaDrrxrono1aexn i3iytfsDea(vpnt0tetoxo iodfatrlnvs;t)trtm(opou1alen fetl() Dtaxrono4tpto fciadfs rmu s;u) eeoioctotop  livsls) eto(m oo1lltemicsa( a2tmxmpnt1oeto oeiydlmDuau s u)tltrif3tydomt aieol() eurxr ny1am  micsas a2rmx ont4teeomo3ilsfaDrlnvp t) exoxocoydfa  aieo;()s2uoio ou1open fetasfa2ua(r ;o1tleomiciadfa elump u4alxoif totfp r i o () 2toxrpio1lp elfesa(  ruaum ;u1aptnioetltlsDrlnmpn(0 rerio3oadfp r uvils0trtoxo3iydlmen ncils  Dum(mp;t1oeeomoctltfmDrm(msn(0tltoir3tytom  ai o (0teum(o no1lmt  ietls)srur(r nt0tlt if3iltlaDranvp;t)texrmo oydom   nes;() exr(m3nodam  mies ( sDrau o;o1opxo o3iadfs2rlu s t0tetnmrcoy1omDe n i t s2urio nydoltnmnci sfa2umx pou4tlxo f3iatfs2rluvo;t0artoirciodlateaueols0 exoxmpnodop nmivi ( a2tr(rpot0apt mieils s2rlnms;t0texoxrciydop ranei s0trur(rpoo4ole miesatfa2urum ot1opxniiciyd sDulnvo;()arenio3oatomDraueo;s0seumxopoodole lnci ( srrmurpou0olt  f3iys m2ra(mon() eeomf oy1fm ean ol(0 2tm(mpnydllt lnei tfsrrrxmp;u0tlx mf3iysfsDua(vp t4texrmo tydom elivs t  2tr(o3io4ole  ivtat)a2rm(  no0aeeo feilsfa2rl( o u4texomrcoo1lm   ivo ()texrxr3oy4altn fcsat sDta(mpno0apen ietys m rlnmo t0aleoxociodopDrlues ( srum(opiu1amtnlies t) Dumu o;o4tpt  feiad sDrlnvo u0texnxfciytomD aivol(0texoio ou4lpe mfet s)a2taxm nt1opxomiciasfm2emu o () rxnmo oydlmD lieil(0 eumxmpoydalee ncsltfs2tm(r ;o4tpxnifciydla uaumo t0tetrxf3oo1fmD ai ols srxo(o nudlltnlivtltfa2umurpnt4aptomfctas aDuan pnt) etnmr oy1optean i;s trtrxo3oydoptnmiviat sDua(moou0oetomfcild m uau s u0tlenmf3oo1lp   nvs;s0trxoxo oodop  mfeil( srurxrpot0aex  fciyt a2emn s t) renio3ta1lm e nvs;s  2to(o iydopt mfci tf 2trumo;o0oexn feiadfaDrl(vo;t0aleoxr iatlatelieilt0s2trxrpoo1llee ieil( artmxr ot4alxn i3tydfa2uan o;u0arxrxf3oa1fp r n s t0sexoir3oydopt lnci t)s2trxmoot1teto o3tatla2umnmont0altrxf tadomt anesls  2uo(m3oy1ole  ictl( sDrrxrpnu0openifctadfs ul( pnu)aeeoxo ta1lmtrln o s0 euo(r3nodam nlncslt srra(mp;o4oet mf3iydfm2emu snu4 lxrmocia1lmDraieo;t trtm(mpiy1lmtelfei t) rrmxmpno4olx  f3tls m emnms t0teenmfcia1fpDr nvils srumir3io4llt mivsat) 2raxmoou0optnif3tas a eau pnu4 lxnxfctadoaD  uvs;s seto(rpno1lptn nciat)srtrx  ot1tex ii3tltlmDeaump u)tetoxo3oa1faDrln olt0trumxm oo4lm  lfvsatfaDuru  nu1apxnio3tasfm ea(von(0tetoxrciydlptr nes t0 2um(opny4oltnlnct t)sDtrum ;u1ope  feiytfm rm(vo;t0trtrmocoadlmt aues;t)texrxmpoo4llen fet (farrmumont4oleoioetad m ul(vont4 lxrio3tytlmDelu o t0 exrir3iu4omtemivtatf Dtaumo;t0aeeoiictatla em(vo;u4arxnir to1opD  nvsls) rxr(rpiy1op nmiviltfarrmxr ot4opxn ictat a rlu onu0tlxrxrciadlmteanvo (0t2xr(r3nydamt mneilt)srtmxr ou4apeoii3iyslaDul(ms;()artnxr iydfat lneo;( trxoxm no4lp nlnciat)a2raurpou1opto ictat s rm( p u0trtnif3iotfm ean ol(0sexr(rpoy4am emnet sf Dtm( o;o0apeo feiat a umu p u0tetniocoo1op e nvsls) etmxo3no4opt mietas)artaurpno4olen f3tysfaDuluvp (0 exoifcootoa r u o s) rxoirpno4lltemfcsls) ruaumoou4tpxnmo3iad s eluvonu4 etrxf3oatfptrau ils)srto(r io4omee ncs tfa2tm( o;u0oex  iciatlm2um( s t)trxoxociytfpte u o;s) etoxm iudom eliciatfsrtrurono1tlt ifeiytfmDuluvp;()trtrifciodla  an s;(  exoxr oo4aleelfeta(  Dtm(roou1apt mo3ild aDua( o t4alxomrcoa1omt luvo;t0 euoxopnu1op e neia(fsrrrx p;u4aexnmf3iysfa eanms t4 lxnxo tydfat  uvs;s  rxrxrpio1ole mivt sf Duaur ;o1optoiociyd sDuanvs;u)treomfctytlp   ues;( sexoir3oudope lnvt (fa2taum no1tee ioeiat mDemump () lxnmrcootlp rlivsl()sruo(r nodlptnmfcsatfa2rrx  ;o4tptnioeiytfa2ulu o u0aeeoio ty1fptran o () rxoir3iu1amt  ivs ( a2tr(monu0aexnioeiadfmDem( snt)trtnir3ty1lmtean s ()setrir3oudap  mict ()s2ta(m oo4alx iietlsfsDelnvs;(0 renxr3oa1fpD aivol(0 2xrir oy4apenlfeil( srumxroou1optniieiatlsDemumon(0alerxf oy1fpDr i o;s teurirpno1aptelivia(fsrumx p;u4tpxo ictas a rmn s;(4 ltnxrcia1lptr ivsls0 euoio iu4lpenmicsat)sDum(  ;o0tlto o3tatls2em( p;t4alermr3iy1oaDrli i t0 etoxo oodlpt mnvt s sDtax  nu1oltoifeiasfm rmn p;(4trtrmr3tadfmteli o;s0 etm(r3ou4opte ict (faDtmu ont4aetomietldlsDuanmsnu) etrxr iydfmDrlivs s0s2tm(r3oo4aleemict (f Dum(monu0oleo ociytfa eanvpn(4tltnxf oy1lpD ai sls0srtr(rpio4omeelncta(faDra(r ;t0oeenio3ildlaDumu o;u0tlenioctadfmDraivo s  exmio ou4ope mfcs tfs2uauro;u0tet  ictldfs umnmpnu0 rtoifcoydopt lues;t0trxoio3nudlmen ics t  Duaumo;o0tlt  octltfm2uau s u4 eenirciytop eanvil(0texoxmpno1lm e iviasfsDuaxr ou4tlenifeiat mDum(msnt0 exoxociadfmD an o;(0 exmxopiy4lmte fvsl(  rum( ooo1tpt  ietls a2ranmo u4aetrmo3io1la elivi ()s2tmim3no1ol  mncslt sDua(mooo4tlxomfeiyt mDuaumpn()trtnmf oatlatrlu i ( s2xoxr iu1llen ncsl() Dua(  nt0alxnmfctatfmDeluvo t0trenmr ta1op  lu s s0t2uoirp
\ No newline at end of file
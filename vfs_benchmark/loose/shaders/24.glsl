@@ -0,0 +1 @@
+ivsl()sruoim3ou4op n fvs s)srta(rono4tptnii3ias m2ul(vo u4 exoir oy1fp elu o ( t2trxo oy1al nmncsl(faDuaxro;u4alx mocildls rlumonu4 rtnmocoytfmD au i ()s2ur(o oudapt lfct (f 2rmxmonu4ale mietld a ea(monu0altoirctotfpD auei;s0 2xoio no1lp nlncsls  Duau p;u4aexoio3ilt m emums t) rxnmr oytfa elueo s texrim3nu4alen fct t)srum(  nu4alenmi3tlsfaDeaumpnt)trxomf3ia1lpD li ol() exoiopoudllt  ieiatfartr(mpou1opxn feiadfa2um( p (4 etnmr3ta1lmDrlies;t sexm(o3iy1opt lfet s  2rmu  ;o4apxnmi3tys s2elums u0alerif ty1lpteauei s)setmirpou1ap elnctls a2rrxmpno4oltomf3tasla2eauvs;u4arxrxrcootoatr ueols)s2xrio3iy4op  lfeilsfarrmumpnt1oeeniictlslsDulnvsn(0areomo3ia1lmt lneslt)trto(o3iu4opt mnvsas)s2rmxmp;t1tpenioetydfa ulu pnu) rtomociadomtrauvo;s0srtrim oy4ol   fesatf rumur ot1oetoioetls s ean o;() eenmo3oa1oatrluvi t)sexrir3iu4ll nlfcsa() rurxro;t0apenmietys mDean pnu4 exnir3totlatr n o;s  2uoxo3iy4aptnmncils) 2tmxmoot4apxomieiys mDea(msn(0 eermo3totom eanvo (0sruoiopiydop elneiat  2tmumooo0oee mi3iysfsDea(mp;u)altnmrctodomDraivols)tetoim ny4olee fesa( s2umu  no4tpen feilslm emnms ()teeoxfctatlat lieilt0seumiopoy1omt mnct ()a2tm(rpnt4texomo3iysfmDrmu onu0 ltrxo iadom  luvo;() rxoir no4alt livilt)sDrmu onu0aee  fctys a2emnmsnt) eerif3tydfm e neo;s) 2ur(rpnodameelfvia(f 2rrxm nu1apeomfciytfm ulnvp t)trxnxociotlp   ies;s) 2um(o oo1ll  lfci t)sDururp;o1aeto oeildla2ea(ms u4 exomo3oytop rli s;(0 2xoio3ny1op emiet sf 2rm( ooo1tleo o3tytfsDuluvs u0 eerxf io1lp r i i ( srtmxm3iy4am  mnvs t  Dtmu poo4opxn feils a elnmo u0 rxoiocio1fatr uvil(0trtrxmpoudapeemieiat a2tr(mp;t0teenif3tls m rluvo u0 rtoirciotlmDeaivi s  2xmir no1ll e ies sfa2rr(mpoo0apeoif3iytlsDem(mpn(0trtrxrcoydlm   n i;() rum(m3ny4altemnvilt a2um(  no4tpe mo3iydlaDea(vp;t0 eeoxr3oydomtrlivs;t t2um(o3iy1aptn ics tf rumxm ;t0apx  o3iydfs ea(vs;() ltomf3to1lpte ieo;s)t2xmxr iy4aptnmnctas  rrrur oo1aptnifciatfa2ean p u) lerif3iadfmtraneo;(0trxrio3oy1oleemicsls) 2um(  ;u1oltoiietldlm el( s (0 ltrxo3ty1lpD au s;s) rxmxrpiydlme  fcslsf 2ta(r ou0olxn o3ilsla2ean on() rxoxrciytopDrauvo t)teumxr3iy4oltnlfci () Duax onu0tee iociasla2raumsnu0trtoir3iytfm raivi (0 exmxo no4lmtnlivia()sDtm(rp;t0apen o3tls aDemuvo;t0tetomo3ootfatelieslt t2xrim oy4oltnmfvsls  2ta(m ;t0texomocildls um(vs;t)trtoxo3ty1fptr u ilt  2tmirpoydoltemfvs t) 2tm(  ou4tet  f3ils a ranvsnt4alenir iytfaD aieols0 rtrir iy1ole mfes tfaDrr(r ou0optn oetld aDra(mp u0teenmo3ty1lmt luvil()srxoxm3ou1ll emfcilt artaur nu0apeomoetatfa2ul(vo;(0 ltrif3oadla r u ilt) 2tmxmpio1aptemnetls artrur ot0alx  oeiadfaDuanmonu0texnir3oydfaDeln sls0 2um(r oy4om n nvsa(f Drrxrpnu1opxomfciyslm emnms t)alxnio3oo1op   uei;t0srto(m3oo1ape  ivsat)sDtax  ou0tetn ieiasfs2ul(mp;u0 lxrmf iy1lpD anvo s0sexrxopiu1ale lnesls)sDuaumpou4altnmfciyd a rm(mp t0alerir todlm  ai ils) euo(r3oudlmte nviatf rurx oou4apx iicils sDrmnvsn(4texnio oydlpt livo t0 2xo(opiudape lncsls) 2rmurpnu0alx if3iadlaDemnvs () exoif3iatoaDeaies;(  rxmxm nodlleemivslt) rrrxr ;t4oltomiciad mDrm(vo;u)texnmr iatfa e n s t) etm(mpiy1amtemnct s) rrmxr ;t1tpe mf3iydfm rl(vs u4trxnxrcoy1fpD luesls setr(r3nudllt lnetls)sDtaur ou1tltnio3tadfaDumnms u0 exnio3iadlp  anvsls s2xmiopiy1al   fvils arum(ro;u4aexo fcildfsDra(ms ()tltomf oa1lpt an sl() exmim3ny4ap  lics s)s2ta(rpnu0tlto feiadls elu s u0aexrmoctydopD anvs;(  rur(o3oy1oleemieilt  Dtr(r ;t4opeoioeildfa2ulums u)trxrmrcoytla  aues (0srurim3nydlleemnvt (f Duaxmp;o4tlt mfeils a ul( snt0trxrircoa1oa   nvo t)s2urxo3nu4olt mnctl()s2rm(m ou1oeen fcildlaDelump;()trxrxo oadlm  ln i s0s2trxrpiudamt  ncsat)aDuax  ou0tleo oeildfsDumnmo u0trxrxrctodlmte uei t) rtmxo3ou4apeelnetlt srrr(m no0aex mf3tadfa umumsn()trtrmf3oa1fpDrli o;( srum(opny4omee ivtat)s2rmx oot4aptnmo3tas mDrlums t0aexrxfctotomDraivs;t0 rxrxo3ny1oleemiei ( aDtmum ot1opt ifciys aDrmumsnt0altrircootfp   nei t t2urim3nu1omtnmfciatfa2rm(mp;t1tlto feilsfsDel(vp;u4trtoxo3oy1fat  n il(0srumir3iu1lpenlivt s aDrmx o;t4altomociad m ea(ms;t0texnmocoa1omte ueo;s s2xm(mpoo4ol e ivsls  2uax p;t4teeoifetltfa ua(vsn(0texnio oydomDranvs;( s2to(m3iu1lpt mfvtat)sDuaur no1oeenio3iltlsDra(monu4 lenio ta1fmDe u o ()s2xr(o3nodalenlieia(  Draurono0oetniietytls2rmums t4arermr3todfp   n o (  2xrxmpnydap n nvsatf 2uru p;u4apxoif3tyt a2rau o t)alxoxf oytlaDeau olt)texr(rpou1ape lnctls s2tax pnu4oeenmociytfa rl(vo;u0 etoxfctotop r ivo t) exmim3iydap  lfei (  2tmxmo;o0aee  f3iydlaDemuvo;t)tleoxocia1opteaivs t0 2tm(m iodam emfvilsf Drau onu4tltoifeils a eauvo;(0alxnxf iydla rlieilt) rumiopio1om e nvtltfarrau  ou1ole  ieiatfa uln p u4 lxnir3iydomt  ues;(  eumxr iy4lpen fviltfs2ua(mo;u1aetomoctaslaDea(mo u0tlerxfciotlpDeauvils  eto(mpoo4ole lfetas  rumumpnt0opx  octat m2rm( pnt4aetnmocoytlaDr i o;s) rtmxmpno4apen nvsa(fa2urur oo4opxoio3iyt a rmuvs;()tlxrio oadla elueo s)seuo(opio1alt mfvt s) ruaxmo;u4apx  i3iad m2elu p;u0aleoir3oo1oaDeaueil(  2toimpiy4am emnvsasf rtrumoot1tpx ifctltfa2um( pnu)trxrir3ootla elnvs t  2urxr io4opt mictlsf 2ur(ro;u4optnifetls s rm(vs;t0trxrxocoa1fmte i slt)trxo(mpny1altn fcslt)s2tr(r no4tlenmieiysls2umnmo;u)trenxr3to1la eaueo t  2umxo nydope  fctatfs2urxrp;o0tptomfetatlm2rauvp (0teerxf iatfm eli ilt0t2xoxrpoodaptelfes ( srurum nt0oltn ietysls rlumon() eeoxr tatomD  uvi t)srxmir iudaltnlfeiat sDrmumont0opxnmi3tlsfm em(ms u4 lenif totom   uvi;(0 rurio3iydam n fcils aDtrum ou1oltomi3tadfsDem(mp t0aeenifciytfate u i;t)s2tm(o3no1lpe lnei (f 2umxm ;o1tlx mfciat m2ul(vsnt)arermf ta1faDrlueo () 2ur(mpnodoltnlfctas arta(m ;t0teto oeils s elnvonu4 renif oa1faDeluvi;( teumxo3iu4am n fvt ( srtaxm ;o0apx  i3ildls2ul(vs;t0aeermocoytfa e neslt)s2xoxm3iudop nlivi s  Drm( pnt4tex iociydfaDrm(mo t0teeoio3iodfmDrli sl( t2uo(r3ou1lm nmicslsfsruaxm no0oexoii3tas aDua(mo u4tlenxocoo1fmDelnesl( t2xrxr iudom n ici (f 2rru  ;u1oetnmi3iltlm2ua(mpnu0 exnmo3iotla eln ils0srurxo iu4ol elies t srur(rp;t0tleomoeiytlaDrmu on()areoxfciydomt au slt0seum(o3ou4ole mfctl( arrrum ;u4aex  f3taslsDrau p;u4aeeoxrctotoa r uei t0 2urirpnodllee fci sfaDtr(ro;o1opxnmoctlsfs rmums u0tetnmfciadlatr nes;s0srurxo no1omtemfviatfartm(  ou0apeomfetysfaDuanvont0tlenxfcoatfp rau sls)srumio nu1lpeemnvilt aDtr( p;t4aptomfcilt a2ulu p;t)tetrircto1oat  iei t srxoxm3oy4opee ivsa( s2ua( onu0teeo oeiasfsDuanmont)tetomo3oy1lmD  u ils0s2xo(opou4lmtnmfct (faDur(mo;t0tlxomfeiydfa2rm(mpnt0tlxrmfcoatla   uvs t setm(m iy1amtnlivs (fs2rmxronu4aexo ocilsls2emumon(4tltnxo3oydfp  lnvsls srxrxo io4llee fciatf 2urxmo;o1optnmoctld aDra(von(4 exomf3iotop   ieolt srxmim3ou1ameelics sf Drr(rp;o4tltniiciysfaDumu o;u0aexnmr tadlat luvs;s0srxo(mpiy1ameelfes () Dur(ro;o1aex  feiadfmDuaums;(0trtoxrcoodla  aneslt t2uoxo3oudlmen nct s  rrax  no4aee mfciytlaDra(vpn(4altrxo3oatoat  ueo;t0t2urirpoudlmtnlfet t)arrruroot1teeomfetls m elump u0trermo io1fpDeluvsls s2tm(mpiu1altemfvtlt a2uauronu1alxomfeiys a2uauvo;u0 rtoxrcootfm  aneo t) etrim3nu4lm  lnvtl( s2rmu pnt1aetniicildfa rlu s;t4 rxrmrcoo1la eau i;(0 rxoimpiudal emnct ( srumumo;o0opxnioetyslaDrauvo ()trtnifcootfate iei;( seur(r3oudoleelivt s)a2rmxmo;t1tlxomfeildfm2ra( s ()aeeoxociytopte uei;()srto(o ny4al emfvt sf 2urxm ou4apxo fciysfm2em(vp t4 ltoxo tadfpD  uvols) 2trxopny1ole lict s) 2um(rp;u4olxoifctadfmDemuvs (4 exrxr ootoate ivi;t trtmirpou1aleemfvilt  Drr( onu0apenifciad mDumnmont4teenxfcto1late uesls  eto(opio1alee iei (fa2tmx ono4tpeomictlt a2uanmo t0arxrmrciydlpDr i s t s2ur(o ny4om n ici () 2tmxrpot1ope  o3iaslm2uauvp;u4trxoxo3oytomt luvi s trumxrpiudoltemnvsatf rum(  no4olenmietyd aDelu on() eeoir3io1fmteanvsls  euo(mpnodlltn ietat) rtrur ou0alen ieiydfa raumo t0 leoio iy1fpt  ivslt0 eumxo oy4lmtemieils aDumxm nu1ope  i3iysls2ranmo;()tleoifcoytoat au o ()t2xoim ou1aptnmicsa( aDrr(roou0tet  o3iyslsDranmsnu4teenio3oodomD auvsls s2triopno4lptelfeiltf 2trx pot0tetnmfeias a elnvo (0artnxf3iodop r ueo s)tetr(o3iodolte ivsltfsDua(r no0tleo ociad s rm(mp u0teeoirctatom r ivs ()trto(r3nudal nmnvi sfaDraxr ;o1oet  feias a2rau ont)trenmo3ia1opDrli s s)srxrxo3ou1lmtnlfeils  rra(m oo0oex  ictysfa2ea(vsnt)tltoio3iatfptr ivs;t0 etmim iu1lmtelnviatfaDra(monu1apxo fctld aDra( pn(4 eermrcoa1om rli o;()srur(r3iodomee fcs () 2trxr no4opt ii3tas m2rm(monu)altnxo iodoaDran i t  2xrim ou1ap   fcil() 2tau ont0altnioeiatlm2ua(vp u0 ltnmo3tatom raieilt) rtr(o3iodll emnctls)aruaump;t1tlxo ieiasfm2rl(mo;() lxnir oo1lp eaiesls teuoiopiudol elfvs ()srrmx  ot1tlxoif3ias a umn s;(4artnmf3oy1lptrlnvo;t0t2umxopiy1om nlivtatfsrrmxr ot0openmieiyd sDul(mo;u0 rtoxr tatoa  luvi t  rtoxmpiy4lmtemfct ( s2umxrp;t4optnmfciatlm2rlumon(0trermoctytfmteaivo (0 2tmxopiydllenlivslt  2umu pot4tee iictldlmDrm( pn()tltrmo3ootlpDrlies s0s2umim iy4ap e fvtat) rrm(r ;u1tpxnio3tys a eau pn(4 lxrmocootlmt  ivi t0s2tm(o ny1lm  lieil(fs2ur(  no0tleomfeiad sDranmpnu0 rtrxrctytfa  auvo;t0 rurxmpny4amtn ivsltf Dtmu p;o0oet mf3tydls elu s;(4 reoxfctydlmtrau ils) rtoirpiy4lp nmieiat sDrrumpnu1ole  i3tydfaDrl(mp (4altoxr3oy1fat aivs;s)trxoxopou1op n net tf Drax onu1alto oeiatlm2rluvonu0 ltnmr tytoaDraues s  2xo(r oudame  ictlsfa2taxro;u0opto feiatfm2elumo u0arxoifctytfp rai o t t2toimpiydlmtn nvs (faDrmxr ot4aeeo o3iaslm2emu sn(0 lerxrctotlpDeai s;t  2xm(mpiy4am nlfvi s)sruaur ou1oetn o3tatla rlu snu4arenif iotfpte neo s0s2xr(m ou1lptn ivs s)srum(m ot4aet  ictldfs eaump t4 eermf3oadoptelieo (0trxoir3nu4ol  mietlsf rurur ;o0tpenmo3iltfsDuanms;t)tetnxrciadlpDr iei;t0srto(r3iy1lme lnciltfs2tau poo4oetoif3tlt a2ul(vo t) reomr3iodlat anvo;s0 euoimpnu1ape  iet sfsDtmx o;t1opt  feiltfa2ul(vsn(4trenmocoa1lptr u o;( trumir3no1openlivt tf rtr(  ot4oleo ietadfm2emnvonu0 rxrxociatlptr n o t) 2trxmpoydlptn iesltfsrrrur ot1tet if3ilsfs emnmp;(4 exomr3iadoa   i ol( truoir nodlp nmict s  rtrurpno0tee  fctldlsDuau p;t4 eeoif3tydoatrlivi;(0t2urxr iudapee nei (f 2taxmo;o4alxo iciyt a2ul( o;u4aexnxf3io1oaDelivs;t) rtrxo3no4olt  nesat  Dtaxr ;u1tlxn ociydla2ra( p t)teenxr iydoa eaivo t0srurxo nu4openmnesa( s2tm(ronu4tex ioctydls2ra(vp;t0aeermfciy1lpt ai sl(0texrxrpoydalen ivi (f rtm( p;o4aexo o3ildfa rlnmpn(0 lxrmr iodopD lnvs t t2uoxr3oy4alenmfci (fartr(r ;u0olxniieias a2emumonu)trxoxr iydfmD lues;s  rxmxr3io1llee fcils srrrum ;o4oltoii3tasfmDran s ()altnir3oodlpDraies;s)trto(o3oydlp nmieil(fsrrmx pnu0tlxnif3iad m rlnmo (0arxrif tadlm   ivsls)sexo(r3ny1openlfes ( s2um(rpnt0texo fcias aDrl(von(0teeoircoy1fm   ues;s setr(m3iodllt mnct s s2ur(r ;u0opx  oeiysfmDeluvont4aexnxo3iy1la rai i s)trurxrpnudll n ietasf rtmxr ;t1oex  ietydfs rlnmo;()tetnmr3tadfmt aneols0teum(r oydlpen iei ()a2um(mp;t0oexoif3ils mDeanvpnt0artoxrciodoaD ln o;()seurxm ny4llee iet ( sDrru ont1olxoiieils sDul(vp u0arxrmr3tadlptr ueol(  rtoxm3iu4lm  mfeslsfarua(m ou4aee iicild aDuauvsn(4texomr oa1fmt au o (0 2uriopnu1olee nvt t)arum(r oo1olto fetatfmDuan onu) eeoxf oydlpDeai i;s trxm(mpiy4oltnlfeta(  Duaum ot0teeoiietas sDumn o;t0aeeoir oy1opDrlnvsls seur(m3oo1aleelnvi ()s2taxmpot4aleoiocilsls ul(mo;(0aleomo iy1lptraiei;(0s2urxo3no1omeemnvsl()a2rru  ;t1tlxnifctld s2umumo t0aexrmrciotfa raneil(  euoim3oodom emict t) rrax  no1teeoiicild sDemnmonu4trxomfcoa1oaD ai ol(0texr(mpoo4omtemfcsl()s2taur ;u1ale mieiydfsDeauvp (0tetrxo3iotop  an i;t) ruoim3iydomenlies s) 2tau ooo0alxnmf3iydfm2uau pnt4trenmo3iy1om  lnes;()texmxopny1opee ncsl()sDrrxroou0oltnifctasla uln s u4 rtnmo3tytoatr ivils0t2xmxm3oy1lltn iei t srurx pou4tex mietadfa2rm(vs t4 etrifciotlmDrlieol(0seurim3iy4opee icil( arraur ;o4ole  icils m ulu snt)aeenmo3ia1oatrliei;t0texr(rpnu1lme mncsl( arrmump;t0oet  oeiysfs ean p;t) renmo3oydoa eaueols0t2xmim nydllte ies s sDtm(ro;u0alxn feils sDemu s (0 etrmociydla eanesls)trxm(r3oydom elnvia(  rurxr ou1apto fciat aDulnmp;u4arenxrciatopDelnvs;s srxr(m3nudal  lfeils)arrrx p;t4opxnmi3iyd mDumu o u)alenmf todlpt lieolt)srxrxm iy1aptelfesas  Dtax  oo0apenmi3tyd a uaums u4aeeriociatomDe neol( s2tr(rpoo1lpenlnci tfs2ra(rooo4oex ifcildfs eanvsn(0 lxnmf3totlaDe ieo;s  euoxm no1lmee iei s)aDta(m nt0tlt iieiad sDemnmo u)aeeoxf ia1op   uei;(  2toxo oy4amen feiasf 2rau  ot1tpx iocils a2el(msnt)arerif3tydop e u i s  ruoiopno4lmtelncsas sDtru  no4tpe mieilt s2uln sn(4 rxnio3ootom eliesl(0tetmio3iudlmenlicslt aDtaxmo;u0alx io3ildlmDelums;()altnmoctodfmt  ivil()trur(r3nudamtnlfei (  2rmx o;t0aet iieiytfsDemu p;u)aetnir3ootfpD  uvilt)sexoxopny4opt mnvtl(farrrur no4aptnif3taslmDuan p;u0trerxr ootlmtrlu o s) etoir3nodop n fvta()sDtrur ;u4texnifetldfm el( s u0tetnxo3iodfpDrlivo;s tetr(r3no1ll  lfcsl( aDrmuroot1ale iicildlsDemumpnu0texrmfctytfa r n i;(  2tmxm oodlp   icta( sDtrxmono1oee  ictysla2rauvs u)tlxoiocio1om  lnvolt)s2toxo3nydom  livs t sruaumo;o1tpe iieiyslmDelu pn(0aetrmf3io1fatelnvol(  ruo(r3oy4alenlictatf Drrxmpoo1texoifctatfaDeaumsnu0artrxrctydomt lieil()sexoir no4lmeemivta( sDtrx p;u1tlx miciysls2rluvs;(0alxnir oydom  lnvolt trurxm3oo4lpenlnei tfaDta(r nu4tltnifeiat a um(msnt0aexnif oodfateluei (0 rtmio3iu1alt lietl(  rta( o;u1alx  i3iadlsDrm( o;()arerxfcta1lpteauvo;s) rurxr3ny4lp   ici (f Drrx o;o1oexnifctasla2rluvp;()texrif3totfa rauvol() etoio iu4al e fctltf rtmu poo1alt mfetltfa2ranvp;t0tlxnmf3iydomt aueil( sruoxopiu1lmt livsasf Dtrx onu0tptoii3tyslaDuanmo;t0tlenirctytlm  auei s0trtrxo io1lltnlfvs s a2tmxm ;u1oet iieildls2em( o t0texomocia1fat  iei (0srxr(r3iodlm   ieilsfs2trx pot1oetoioeilslm2ulnvpnu) lermr3oatopD ln slt  eumxo3ou1omenlnct t aDta(roou1tleomfeilt mDrmnmo;u0tlerxfciy1fpD  uvo;s s2xoim iy1lmeemietasfaDtrum ou4tpt if3tld m ranvs (4 leomf io1fmt auei;t) 2xo(r io4apen fesls a2rmumpno4oex mi3ils a2elnms;u0 exrir oodopD lu s t t2xr(rpiodamtnmfcslt  Drmxm ;u0tpe  o3ildlaDea(vsn(4 eenir iydop  lnei;t srum(opiy4lmtelfvsasfaDumu onu0aeeoioetydfa rmnmp;t4 renmo oytlateai s s) ruoxr3iy4llenlneslt)aDum(mono4apeoifciyt aDrmnmp;u) rerxf ootfaDr ies;s0srtoim3ny4llt lietat)aDtrum ;o4tptnmf3ildfs2ea(ms;t4trtnmo3ootfaDe n olt)s2umxm3ny4om n fct s)aDuru o;t1opeoiiciyt a2ea( pnt0aeeoio tydfm  au s (0s2xrxo iydll emiet (fs2rax  nt0oee ii3ilsfm ranvont)texoxfctodoa eln i;s  2xoxrpnudlm elfvi tfaDuaur nt4ope  fciatfsDum( snt4artnxf3oy1opDraieil()sexrir no4olee nvi tfaDum(mo;o1aleo i3iatlm2um( pnt0 rxomo ia1oa   ivs;t0trxoim nydap nmfvtat)artaumpot0oee mf3tad s2rln snu0arxrif oo1fat  iei;s) 2xr(m3nu1openlfei (f Drrur ot4alt ioeiyslm2rl(mp t0trtnir iodlm r uvi t s2tr(rpny4omenmietls)a2uru ooo0alxn oeiadfa2rln s (4aetnmfctodfatrln ols0s2urxo3oy4omtnmiei (faDtr(r nt0tlx  f3tatlsDran sn(4arermf3iydoa  lnei;()t2trxopiydal   fcs t) 2tru o;o0tpe ioetaslaDuanvsnt)teermrcta1optr nvo;( t2trxmpno4ope lnesls  2urxrpot4openii3tldfa2rlnmp u4 exoir3totoat  nvo s0 2um(o3nydomte ivils) rraxrp;o0oexomfetlslm ea(vo;(4tlenxfcoadoa   i s;()srtrir oudom emncta() rtmumo;u0tetoioctad mDemu s;()artnmf ia1fpte uvsls0t2xo(rpoy4amt mncil(fs2rrxmpoo0tetn o3iadla2el( o;(0 leomr3iadfmDr iesls texoxr ny1ame mfeils  rtmumpnt0olenmo3tldla rauvo t) exrxr3oodoa rlieslt  etrxr3iy4lltnlnet ( aDtrxrpou1olxn fciasls2elu ont)aexomo3totlptrlies;s) rtrim iodal n ivi s) Dur(rpot4oetn oetyt aDeln pn(0 rtrmo3io1fpte nvilt0srum(m iudomenliesa()a2taxmp;t1tleoiocils m2emumo;u)teeoir3oo1oa  anesl(0t2uoxrpoo1aleemfetas a2taxr nt4oetomf3iydlsDuln p u0 ltomf oatopD anvolt srurim3io1aleelneia(fs2rrx  no4teen f3ils a rm(mont)aleomf3ty1oat  uvsl( tetoio3iodlme  nvs ( aDua(rp;o4aeeomociltfa eauvs t4 rerxrcoodlmD aneils trur(opiu4alt mnesa() Durxrp;t0aetomo3tadfm uau pnt)tetrio oo1faDrlnvi () etmxr no1optemnviat) 2uaxr ot1optoio3iydfa umuvsnt)aexnifcto1la  lneo s s2toxm3nu1alt lnvsas s2tmuroou1apxn i3ildlsDuau pnt4 rerxr3todoatraivo s0 2xrxo oydal nmivils)s2ta( oot4apenifcilt a elnmo;u)trermr oy1lpt aneilt  exr(r iodoltelivsa(  Dta( poo1apen feildfm ulnvp t) exnif tatomDrlnvo;s0s2trim iy4lpte ncs sfs2ta(mont0ale ioctldfs em(von(4alerxfciatlp   neo s0s2tm(o3ny4ap e ivtat  2rrxr no0opto o3tld m2ra( p;t4trxnifctydomtrai s;() etoimpiudom nlfetlt sDtaxm ;o4oex  o3iad s2eln p (4 ltrmr totfaDeluesl()texrir io1lleemfcias)s2rru p;o0tetnmieildfs2el(vsn(0artrxfcto1lptrlueils) 2xm(opio4lpe mneiat)sDururpot1tetnifctyt m rm(mp;u4 eerioctatfat  n slt srxrxo3ou4oltemneiasfaDrax ooo1oet mi3tls a rlnvo;t0 exnio iydfmtrlues;( srxmiopiudlm emfeil( s2rmumoot1aptnmfeiatls umumpnu0trtoxr ootfmtr neo t) etr(o oo1lm nlfci () 2urx ooo1open fetadfa emumon()aleoifcoodfaDe i i;s0 exr(r iydlleelfcilsfaDumu p;o1olxomfetltfaDum( s;(0aexnmo3iatoat  i ils)texo(r3no4llenlfcs sfaDum(r ;u0aex  feild aDra(vs t)tlxrxrcoa1lmtelneslt0tetoim3io4lmeelivt s  2urxm oo4apenmfcilslsDumuvs;t0alenxf3to1faDrlnes (0t2xoirpny4olen ncslsfarua(mo;t1alenifctydfs2em( p;u4areomf oatlptranvi;( seurxopiy1al elivt tf 2tr(  ou1apt  o3tlt a ua(msnt4areoir3todlp   iei;t sruoxr nu4amtnmnvtls artaumpnt1alx  oeiytlm2em( o u4 renxr3tadfmteanvols  eto(m3oy4ope liesas) 2uaur nt0aexomf3ild s2umnvo;t4alenmo3iytlmDeluvo;(0trur(r no1ape lncs (farra(  oo4tlt mociytlm rm(vp (0 lenmo iadlptraivi;(  rxmxm3oydapeemict (  Dumum nu1aexo ociydfs2el(mon()trenif3tadla   i i;s0s2urim3no1lmeelnctas) 2trxr nu0tltoifciadla elu pnu0 lermrciytfaD lueolt0sruoio3ou1op elneias srta( o;u0aee moctat m2rau p u)trxnxo tytla  auei s  2tmio3oudope  ivsa() rra(  ou1aeen octls m2eanms;u0teerxo3ia1fat  uvo;s  2xrxrpny4amt lfei sf 2trum ;t0tle  oeils s2umumo u4trtnircio1lpDeln ilt)s2umir ny4olenmfcia(f Duaur ou0opxoio3iat a2ul( o (4 eenxrciytoa rai ils  2uo(opoo1optemncsas  Duaxr oo1aex mfctlslsDumn on(0aeenmo3iytlaDeauvo t) exm(o iy4alte nvt ()aDraxmonu1tlxoio3tat s eauvs t4texnir3tydfa rli sls)tetrir3oodoptelfvtl(  Drrxmoot4oex ioeiltlmDeauvonu4 lerxfcio1fmtr i il(0s2xrxm3io4lmtn nctasf rur(mooo4tlen i3tltfs ua( s u) ltrxr iodlmtraivi (0 2xmim iy4amt lnviltfarua(roou4oex ioeilsla umu s u4tlxomr tadoateauvs;s)seumir iy1ope mfvt t)aDumxrooo0alxnifctydlsDeaump (0 exnmocty1fat  nei;t0teumxr3oodlp e fetlt) rtrx o;o0tetnio3tldfa rln pnu0trtnmo ta1lp  lieols0 rtm(m iydam   fvsas) Dtm(rp;u0opt iictas m2uau snu)trtrxrciadfpDeaieil()truo(m3nydomte ivias)arrmum ;o1aeeomiciat a umu o u4trtrif3tytfpt an sl() rtmxm3no1lptnmics s a2rmurpno4tptomfctys sDulump (4 rtnmf3ta1opteauvs;s0trxoxr3oodllenmivi ()a2umu onu1olt mfetydfm2umumo;u4 leomo3tydfpD anvo t setm(o oy4llte ivsl(  rrmx o;u1tetomf3iyt s2um(mp u0tlenmo oa1lp raiei t srxoxm nu1apenmfesl( sDtr(r nt0oeeomo3tasla rlnmo (0tltrxoctytfaDelivs s trxmxm3iudoltnlnesa()artax pnu4aeeomo3tat m ul(von(4artoxrcoatop e i s t) eurxr3io4al n fvs sfaDua(roou1opx mociydla2rm(ms;t)tetrxrctotlmtelu i;()teurimpny1ale mncslt)sDrm( oou0alx mietaslsDelnms t4altoxo3io1laDrluvo;()trxm(m iodale lnvsls)aDrrumpnt4oetnifcilsfs ulu p;t4trenio tydfptraieolt)t2xr(m io1om elicsls)srumumonu0tltoifctlsfa2rln s;t4 rxomf oydlat aueols0 2tmxo oy1ale  ncslt aDumx o;u1aex  o3ils sDulu pnt0 eenio3todfaDean i;s  eur(o3oo4ame  icslt srrrump;t0olxomfeiyslm emu snu4 rxrif oy1omD livo;(0teuo(rpiodlltemneia( s2tmxr nu1olxniociat a2ua(mpn(4aexoif oatfa  lnvs;(0seumxm iy4alenmneils)arumxr ou1tpe iictyd m2rlu o u0alxnir oytfm  au s t)seumxo3io1lpen fct ( a2urx  ot4tpe mf3iydla uan o u4treoxr3iy1faDe neolt0setrirpoodlmeemfvsltf 2umxmont0aeeomi3tydlmDelnvsnu)teenirctydlp e ieslt0 etm(r nodlp elfvt tfsDrmxm ;o0tlxn f3iltla2ra(msnu4areniociydfmt lneols trumir3oodlm n fvi s a2ur(mp;u1openifciysfs2rm(ms u0artnmf3iydfpte ues t tetmim3iu4ap n neia() Durxmpnu0olt ifcils a2um( on(0aetnmo iatfmtr ivi (0srumxr3io4am e fcsl(f 2ururpnt4tpeo iciydfs2eln sn() etnxocty1la eanvsl(0srtoxr nydlmenlfei (f rurum ;u0tpeomf3ild s2ul(msnt)artrmrcoo1fp rluvi;t0teur(o ny4alt mfcs ()arra(mpou1aeenmoctldfs emuvpn(0areoxr3tydlaDrln sls texrirpoodoptnlicils  Drmu o;o4aexomieiltfm raump;t4 renxf3oy1latrlnvo;(0s2xoxr3io4lpeemicils)s2uax oot1tpt  ociydlm ulnvp u4 eerxocoa1om e uvi s0s2uriopny1op emnvils)aDum(mp;t0ale mf3tltfaDrau o (0trxnmo todoptrlu ilt  2tmio no1lm emfetls) Dtmxr ;t1tlxomoeilslmDeln s;t4 lerxr3iotlate n o;t)trto(o ou1lpte ivtasfsDra(root4tetn feiltlaDulu o t)alxnmocoy1fp r nei t) rur(rpno4lltemncia(  rrmumooo4ale  fetadlaDuauvp (4aleomfcootfpte ivsl()teuo(m nydop n nes t s2trumont1aeeo fetadlaDelu o (0 eermf3oy1oat aivs t teto(m oy4lpe lnctat)a2umx ont0tlxnmictat a2ulu p u4 eermr3ootfaD  ueil(  rxo(mpoy1lpeemieils a2rr(  oo1tptn oeiysla eanmonu4aexoioctytlm  lnes;() ruoimpny4lmeelnvsl()sDtm(m ;t1aeeo ociysfa2uan p u4texoxr3tadoa eai i s) 2ur(m oy1amtemicsat s2raum no1tpen ociydla2ua(vs;u) rxrxo3iatop rauvs;(0t2toxmpiudlltemnvilt)sDur(mp;o1ole io3iatfmDeluvo;u)aeermrcoytlmDeln i;t)setr(opnydoltelfeil(fsDtrumpnt4tpeomo3iytfa uanvs;u0altomrctytopD aieo s  2xm(opiydamtnlieia(faDrr(mooo1teeo iciasfa emums u0aexoxrciy1opteliei;(0teuoio no1ol emneil(fsDum(rpnu0tlt iociadfmDul(ms;u)trtoio oydlpD  n o s)srtrxopnodoptn ictlt arrmxrpnu1aet if3iadla um(msn(0 rxoxf3oy1omD  ivils0tetriopoy4am nliesat  Dtmump;o0oeto ocils a2ra(vonu4tlxrmf tadopteliei t) rxmir3ny1lptemicta( s2rax pou1tpxn o3tyslm2ea( p;t)trxrmrcoa1op e u ils setmio3oudomt lfvtls)sDtm(rpno4oex miciyt sDrmuvp t0 exrmf3totlpD au i;s  rxriopnudlme licslt)a2tauro;o1aet  fctydla2emnvo u4arxoxrciytlpteli i ( trxmxo io4aptnlneslt a2rau  ou4oetomoctlt aDraumo;(4artoxrcia1lpt lieo t0 ruoim ou1openlnctlt)srtru  ;t1aeeoiieild sDemnvp;() exrxo3iotoatr u o;t) etmxr3io1al nlncsat) 2urumonu1apt mo3tasfaDeanmo t0aexnxfciodla  auvs;s trtrio3iy1aptnlfei tf 2raxro;t4apt  i3iatla2ua(vo;t) rxomfcta1latr ivil( s2umir no4ame mfctas) 2rrxr ;o4opx  ociys s2rlumo;u)tleoxf iadlm   nvol()trum(r iu1ap nmfet (fsrtr(m no4aexoifciad mDemnvpnu)treoxf3oo1op eanesl( teur(rpnodlltelivtltfsrrax ooo4apt  f3tysfsDelnmo (0 leoxo3oytoptelu i;(0tetmxr3ou4am   fvilsfsDtm(r ;o4aexo o3iadls2rl(mo;(4tetrmr3oo1lp r uvs;(0trxoxrpnu1lmenmnvilt  rraurpnu4apt  i3iys a rmuvon() exnxf3ia1omtrai o;s  rtoxm3nu4omenmicia(f Drrxrpoo0ope  ietadfs um( pnt4 exnxf3oodlm e ivol( seumio oudole mnetatfsDtm(mo;t1texn octydla umn onu) eeoir3iydlpDr ivilt) 2xrxm3iu1ap e fviasf rtr(  ou1opxnio3iydfm2rmuvs u)aetoif3ty1lat li sls  eur(m3no4opt  fesl()arra(mooo4tpenioetld aDel( p ()trtnxf todomDe uesl( sexrxopiy1lpe mict s s2ra(  ;t0texn ocildlsDul(vo t0trermfciatfm r ieilt) ruo(mpio1ole mivi t)aDraxront4tee mietadlm2elumo ()aeenio to1fmDrlnvs s trxrirpiu1apenlietat)srraxrono4oexnifetas s2uln p;u4teenmr totlp  aieo t) 2tmxr oo1omee fvsl(  Dumxm ot4opxoiociyd a2um( p;u0 rermocoydlmD lnvo;t srumxo iy1altnlnctls) rtau  nt1tpxomf3iyt sDum(mp;u)tlxoif3iatop eaneil(0 exm(r iy1altn ict ( s2raxmonu1tlx  o3iyslsDrlnms;t4 reomocoo1omt livslt  2xmim3io4oltn feia( s2ra(r ;t1oexnmf3ilsls rlnmo ()alxrmo3iotoatran slt) 2trxrpou1ap  lfetasfaDtr(m ;o4optnmieiat m ea( p t4teeomf ia1lmtrluvo;t)trtm(m iy1apee nvils  Dtm(  ;o4oeto f3ilsfsDrau p;(4 rxnmfciotomtr neo;t  2xmxm io4alt mfcsltfa2umumpno4tptomfctysfa2uauvo;u)tltnirciatop elnesls)texrxo3ou4ol emivilsfs2ur(mpnu1oetn i3iatfmDeanmo ()tlxrmr oydfm eluvs ( srxr(mpnydop  lfviltfa2rax oou1tptn icilslmDrl( s ()texrif iatfm  luvsl(  exo(o3oodop n fesltf 2raxrp;o0altomietytla emnvo ()trxnifcootoatelnvo (0t2xoio3iodaleelfeias)srtmx ont4tlenmoeiytfaDea( pnu0aetnmo3tadfmtrluvilt0s2xoir nudalen fvi s) 2rmx poo1tlxo fetad m2rlnmpn(4texnmr3totom   u s;t0tetoio3oo1ll n icils arra(rp;t1olt ii3iasfm eaumonu4treniocoydfatrlu s s0t2xmio3nu4om  mivia(f rraumooo4aptomoetldla2rlnms t4 exrir3oy1lm  li il(  rtmio nodam nmfcil(  Drau ooo1oee mi3tldlmDea( p;t) rtoif3oydlat ln o () rxoxrpoy4olte ictls sDum(rpoo4tltoiicild a2rm(mp;u)alerirctotlp   i o;t setrxopoodlle  netls)aDuru  no0altnifeiytls2ranvp t0trtoioctotopteli olt) rxm(r3ny4ape mfcslt srumxmoot4open f3iyd a2ulump t4altrxr3oadoate n sls  rum(o ny1amtnmncsls)s2uaum ;o1oex  iciltla2rm(vo t) rermr3oy1om rlivs ()teum(mpnu1lme  icia( s2rrx  ;t0tptomocilsfs2emn p u4aeeoif3tydlmt  i olt) exrxr iu4altelnvtlt aDur(m nu4alx mietysls2ua(vo;u)tlxrxo3to1fp eaneo s) 2toxr oudlle micil(  2rrx pot1opt mfetyslsDrl(ms;t)arenxr3iatop eaueolt srum(mpiy1oleemicil() 2raxr ;t0tpxo feiyd sDrlu s u)tltnmocoatoaD  ivolt0setm(r ou4opeemnesls  Dtmxr ;u0altniieiysls rau o u0arxrmo oo1om   uvs;s0tetr(m3ny4op elfetlt) 2ta(m ou0oltnifciyd m eln s;(4tlermrctytopDe uvs;(0s2xoxopiodal nmnes (f ruru ono0alenioeildfm2um( o;(0 rtoio3iydfp raueo s)texrirpou4altemfetasfsrtmu pou4aeen f3ild aDuln p;(0 leoir3ta1om rli s;() 2tr(m ou1ap  lieiat  rtr(  nt1altnmoetas mDrmnmo;t)tlenxociatoate uvols0trtoir oo4ol  lnesat artrx p;o4oex io3iyd s2ea( s (4 etrio3oadfptelu o t  2to(mpoy4oltnlnetl( arrr(m ot4ole mfctad s rmnmpnt4 etnmrciadfp elieo ( t2tmim nodape lnetasf rumxrpou1opt io3tltls2umnvp;u4aeeoifcoatoaD lnvol()srtm(r3nodope liesat)s2ua(mono4texnmoeiys a eluvo u4trxnxf3tatfm eln sl( s2xmio3ou4om emietls) Dum(  ot0apeomieils a2uau s;u) etrif oatfmtraneo;s0 2xoirpnu1ope mnes t  2rrxmpot1aetoifciysfmDulu s;(4aetriociy1laDrlnvsl(0srxrxr iodlmtelivsls srurxmpno0oexomociyt sDumnmonu) ltnmfciotom rlueils trur(m3io1amt lncils) Drrum ou1oltnif3iasfa2um( pnt)trxrif totfm r n s (  2tmir3oy4openlfct ()aDur(moou4ope moeiys a2uan pnt0altoif iytlatranes t) ruo(o nydam n ivsat) Dumx  oo0tlxnmo3ilsla elnmo;t)alxoif3oatopt  n ols) rumim iu4opeemivs s s2raurp;u4alto o3iytfa eauvon()alenxrcoo1fp e ivo ( seumiopoydlm nmivta(fs2umurpou1aee ifctlt m eaumpn() rxnio3iodomD au s s)teumxmpiodllen nvilt srtmxro;u0oetn oeilsfa el(vpn(0tltoxf oa1fpt liei;s0trtoim3ny1oltelnvslsfs2tmx o;u4aeeoiiciys s2el( s;(0tetrirciodop r i ilt srtm(r3nudomtelnvsa()aDtr( pnu1oeeo octasfsDelu s t)alerir todlp  anesl(0 etrxr oy1ll nmivs t  Dtrurooo4olt  fciyt a2ulnmp;u4aleriociy1laD auvs;s0 rtmio3ny1al  mneiltfartrxro;t1openmociydlm eau ont0trxnio3io1faDeauvs ( trur(rpoodll e ncs t  Drrxroou1open ieilt m2emnmpnt)alxomfctytlpteli o s0 rxrim iu1am  mncsl() rurxmono4texomfciadla2ra( s ()alenmrcto1laDe ieol(0teuoir no1lpeelfci tf 2trurpou1opeo fcilslm2ranvsn()arerxf ia1fm  luvslt0 etoim3iodome lfvsa()s2rrxrpnt1apxo i3ildfs umu sn(0altomo ootlaDrluvi () exrxm oo1lptn fvil( s2uaxr ou4aee  iciytls2ea(mo (0 etoxf3todfaD auvils t2xoir iudlpen fciat) rur( ont0tltoifciydls raumo t) rxrmfcootlp eaueilt0srtm(m3nodalt mnvta(f Dtru o;o0alxo iciatfmDemnvs;(4aeeoif to1lpte u o;()srtrio io1lltelicslt)s2uaur ;t4altnmfciytfaDul(mp u4 rtnmo3tytfaDe ivo ()t2tm(o ou1apeemietlt)sDrrx ont4tlto fctys m2rmuvon(4tetriocoadfmDrlnei t t2umirpou1lmte nvta( s2uru  ou1oetniociydlaDrauvs;u4tltnir3oytomtrlueo t0truo(r3nu1am   ncsatfsrrm(r ou1texn i3iaslaDrl(mp;()altrir3ty1lat aiei;s srxrimpiy1amenliei s)s2trxmo;t1apx io3tas s2rluvpnt4trtoxo iadfmt aneils) etoim3nydol nmivias aruaur oo4tlenmf3tysls uaumsnt4 ltrif3ootfp   n i;s0 eur(r3nu1ap   iei tf Dta( oot0olenmfciydfm ua( pn(4alxoio oadomte n i;s)trurimpio1lme mfetls srrrur ou1tetn ieils a ea(mo;t0arenmo tadoptraivo;t srtr(rpno4lpte fcil(  Draxm nt1optnmfctad s2elnmp (0trenmfciadlp  lnvs;(0t2urxo3iydoltemnei s)aDtmu ooo1tpt mo3tlt m2ean onu)trtoxr tatlm eai sl()srurimpiy1alee fetltf rtr(rpou0tlen o3iytfmDum(mpnu4alxomr3iy1oaD  n i s  etoxm no1ol nmivt sfa2trump;t4ale mietysfm uau o (0 rtoxo3iodop  lieilt t2xo(r3oy1lmtelneil()a2rmu  ot1opxnmi3iad m rlnvon(4trtoxo3oo1oaDeli o (0srtmio iu4apee fvt ()s2rrxmooo1olt mieiyt a2ulumonu4alerif oo1oateli s s0trxoxo iy1op   fetl(  rtrx  ;t4opxo ictldfa2ranvont0 exrxo oodoaDeln ils texmxr3iy1al nlneilt aDrr( oot0oetnmo3ils sDeaump t0tlxoxocoadfp ranvilt srxrxr3oydol  mietat)aruax ooo0apxnmoeiasfa ulnmo;(0areoiocio1faDeli i;(  rxo(r3oy1omen nctls)sDtrx pot0tpxnmietatls elumo (0tltoif iotfmDr ies t0 etrirpou4optemici s) 2tr( pot4apx  octysfsDumn o t0 etrmfciadfatrlu o;(0srtr(o3ny1opte fvia( a2umx  no0ale mieiaslm rm(mo;u)trerxrciadla raneo
\ No newline at end of file
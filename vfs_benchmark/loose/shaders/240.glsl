@@ -0,0 +1 @@
+ues;t texo(m3ou4ap nlivia(fsrurumooo1aleoiociyslaDranvsnt0 eeoif3oydlateauei (0s2xmir3oy4lmee nciat  2rmumpot1aexomfcildfa2em(vp;t) lermo oydlm  aueo ()sexmxm3nodale lncia( aDrrumoou0opxomi3tys mDea(vo;(0tlerir3ootlmt  i sl() 2xoiopny1lptn ieias)aDum(mp;o0tleoioeiydlm2ulumpnu0 ltnmo tydopD anvs t0tetm(o3ou4lm emnes s)srrmxrpou1tleomoetatfs eluvp;u0alermo3tadlmDe nei;t)teuoxm3nydoptemnei s)srua(mo;u1tpt mieiasfsDelnmpnu0trtrifcoodop rai ol(0 2xo(m nu1apeelivsa() 2uau pot4apt  fciltlaDua(vp u)aetnmf iydla   uvi;( trur(rpno4op  liviatfsrta(mpou1apen oeilslm ea(vs;t)aetrif3ia1latr i olt)trxmio iy4ol  lietatf rra(rp;t1teenmiciatlsDeln ont4 lenxociydomDr ueols0sexoimpio1alt mncta() rrrxmpoo0aleoioctat a rmnvs (4artrxociotfmDeai i;(0trtm(mpnu1al nmics s)srum(r nt1olt  iciyd m2rluvo;t0altnir3iodoa  liei (0 2trirpiu1omeelfvslt s2raxmoot4olx miciad aDulums (0 eeoirciodfmDe i il()texoxm iy4lptemietas s2rrxmpot0aeenmictls mDumnvp (0tetrmocoy1la r uei (0 exr(rpnu4opeemnet (  2ur( ono0oetnmf3tatfmDel( s ()tetoxo3oy1fa e uvols0t2tm(m ou4omtnmfcsls  2umxm ;t1altomfciadfsDuanmo ()aeeoxrciodoatr ivi;s)sexoxrpiydoltelieilt)artrur nt1oetomicilslsDean o (0artnxo3oatomDeai o;s  2tm(m iy4lp nmnes s  Dua(  nu0oleniiciys m2ulu o;t4 rtrircootfaDr u o;s) 2xr(o no1ape  fcil()srum(  ou4oeto octas m2rmu on(0teenmo iotlmDrliei;s  rxo(rpnu4omte ics (  Dum(mono0aet  iciydfsDumnms;t)aexoioctotom  li o s0 ruoio oydlmeelicsa() Dra( p;u4alt ifctyd m2eauvo t4alenifctadoaDeaivols  rxrimpnydlptnmfesasfsDra( oot0alxo octysla umnmp;t0 renxfctatlpDrai ol(0setr(r iydapenmfcs (fartaxmpot4tleo o3ias s2em( o;t4 etrmrciy1fmDeaies s0teumiopou4aptemictl(  Dtaur ou1aleo o3ils m2um( s t) ltoxf3todop r neols0srtm(rpou4lpt mivil( a2umum no0alxoifeiad a ra( p;() exrxf3oo1fa rlivs s0t2xoxr oy1lpe lnvsat  rurxr nu4opt micilsfm ea(mp;u0 lenir3oy1fpDelu i t0srtr(r3oudap emfct (f 2ua(rpot0oleomo3iytlm2uan s t)artnxociytlm   nvslt trto(rpnu4lm elieiltf 2tmurpou0tetn i3iasla rm( o;t) rtomfciatop   n ils0 exm(o3oydlmeelnvia()arrrxro;u1oetoiocilsfaDra( o u) lenmr3oytfmDrli sl(0sruoxr3ou4am emict () Duaxmoou0tpxnmociysfa emuvsnt4aexrir iytlmt  ivil() 2toim nodlltnmnei t  rtm(m ;t4tpe ifcild m rl( s;u0alermf tytla  aneolt0 rxrio oy1lpe  nvt t s2tmu  nt0tex ifctasfa ea(vs;(4tlxnxo3iydoa rlivs (0t2tr(r ou1al nmfcils sDuaxr ;t1oet ioetls aDulnmsnu0trtnxr3todfa elu olt sexmxr3iydlltemnviasfarrau  ;o0tpxo octltla2ul(vo;u) exnir io1oa rlneols teumxr oudaleelnci s a2um( poo0tlx miciydlsDea(ms (0 exnio oy1oa eai o () 2ur(o ny1olte fvtlt s2tmxr ot1apeo ietatfmDuan snu4 rtoxf ty1fmtelu i s  eurim oydlp  mncslsfs2ra(m no4aet  fciyslm rln p u4aetoxoctytlpD anei;(0seuoim iodal e fvs t arrmurpou4apt ii3tatla2ea(von() exrmfctatlmtr ivo t0t2trxo io4apt mivias)s2umxmpno0ale moeiadfsDraump;u4arerxf tadlat aneol() rum(o3io4amtemicilt s2tau p;t4tptnmoctls m rm(msn(0trermo oadopDeaieo t0 2urirpoy1ol  mieslsfaDrmxm no4aetnif3ils mDea(mo;u)texrio oytoa  anvil(0t2um(o oy4lmt lnei s arrru  ot1aexnii3iatfa2eaumpnu4trxrirciatomtr neol() eumirpny4omtnmfvilt a2trxmo;u0apeniociatfa rlnmon(4aexrmo3ta1om  luvs;t0trurxo iu4ol   icta() rtrxmont4oltomoetydls2um(mon(0trxnxf3iydfptrai o t t2tmir iy4omee nei ( aDtr( pot4tpe  ieilsfs emu s u4 etomfcia1faDe i s (0t2xoxopno1lpt lfvsa() 2rmx pnt4opxoioeias mDrmu onu4altoxfciatfa r i i;s0t2uo(r io1lltnlfct s)aruaumpnu0oexomoeiytla2emn p;u)aetrxr iadfm rluesl( trxr(rpnu4lp nmneilt)sDtrx poo4tlen i3tys aDuaumsn(4aetomf3tatlpDelu i;(0seuoxr io4lm emfeiltfsrrmx pot0aeenii3iadfa rm(mon(0 exnxr3iy1oatrlneolt0 2xm(mpio1opeemicslsfartaum ot0ole ifctydlm2eauvs;u4 renio3oa1oateaivo;s0sruoir3oo4openlnet tfaDtrxr ;t0tltnmieiat m eanvon(0alxomoctadlpDeanvs;s)t2tmio nydamt lnei t sDururoot0oetnifetasls2rmn o;t) rxnmfciadfm elueo;s seur(rpnydamtn ncta(fs2urumpot1oltnmieiad s um(ms;u4tltomo3oodfmD an o ( srxrim3iu1amt mivsltf rrm(mp;u1tlt  i3iad s ulums;(0 ltnmr3ootlptr uvs (  ruoir oy4llt lnci sfa2umxront0oetnmfeilt m2emnvsnu0 rtomr3ia1op  lu slt seto(o3nu4lpenmicilt) Drr(  ;o4apenmo3iyslmDrmn s;t4 exrir ty1faD ln o;(0srumxopnodomt lnvt tfartmur ;u0tpx if3tls m2ul(mp;u4 eeoif3oytfmtrai ols t2trirpoudolt mnvtasfs2ra(  nu1aet io3ilt sDrmump t) rxrir oytfate n olt0 2uo(mpiudlp emivt ()aDtr( o;u4tpx  oetldlaDrmu snt4 rxnxf iy1fatraivo;t0t2xo(opiudlptelfetat) rrrur no1oleo ictysfm2rlu o t4 ltomo iatlm   ieolt0 exo(o nu1opeemnetlt s2tr( pou1optnmieiat mDum(mo;t4 eeoifcto1lmt  ivs s sexrxr ou4llee fvias)a2umx onu1opx  fctatfa rm( s u)arenxfciodfaD lueo;s) 2xoim io4lp  mneil(f rra(mo;t4texnmoeilsls2eluvp;u0arxrif todlaDeli s;(  euriopoy4omt mnci t a2tmurpou0tlxnmfeiyd a um(vp;t4trtoif iodfm rai i;t)trurxo oo4omtn iet s srtaxr nt4oee iiciltlm2rlump (0trxrmrctodfmDrli i;t0 2um(mpiy4ale  nvs (  rtaum ;t4oexnifctldfsDrmnvsnt) rtnif3tydlm  auei;( teur(rpny1om nlfvi (f ruru  ot1tet miciydfm2uluvsn(0 rtnir iatfmDrli s;(0srtr(opiudlp nmnesasf rtrx  ou4oltnifctyd a ua( p;u4 exoxo ia1fpD  nvil(0t2tm(opnu1lle mici (fsrurx pnu0tpxnifetas s eluvo (4 renxo3iodlpte u ils srxmxo3no1ole mnvtatfsDuau poo0apx mfctatlm ulnvp;t4aeenxocoodfm rluvol(0t2xm(r3iu1lmt  fetatfsDuaump;u0oltnio3iyslmDrmn p;t4tltoxf oo1oaD au o ( truriopnu4lpt  icilt)sDtaxrp;u4apxnioetad s rmnvp;(4 eermrcoatop raueils) rxo(rpno1lpe  fctlt  rrauroot0tex moetad m ul(vp;()arxoiociatomte uesl()srtr(o io1olt mnviltf Dua(rooo0teeo iciyt m ra( s;t) renmrcia1fp r u o;t  rtmxm3nu4openlietls)a2um(m ou4aexo oetad a2ran o;()trxomfcoy1lmt auei;() 2tmxo3iodapee neta()sDuaxm ot0teen ictld mDuanvs (4 rxnmfcoytomtraneols s2uoim3iy4llen fei s)artru  ;u1olx mfeiatfm2umnvo;(4aexnio iydomDe u s;( s2um(r oydopenlivt (farurxm nt4tlx  ociys a2rlu p u)tlxnif io1fm   n ol( trumirpiydlleemneilsf Dra(rpoo0oex mf3ils m2ra(vs ()trtrmr3iatlmteluvs;( s2umxo iy1ll n ivias)srumx poo4aptnmf3tlslm eauvo t)tetrmoctatfm eln sls) rumim3iy1apee fvsa(fa2uaum ;o0olxnmo3iad a rm(vo;t)tlenxf3tadomtr uvsls0teuoxrpoo1lm nmfetas  Dur(r ;o4olt mi3iys m elnvont)tlenxo tydfmt lneils)t2xmio ou4am n neil(  rraxm ;u4tlx  fciysla2rlump;() exnmrcto1fateli i;() 2xmim ny4olt lncs ()s2um(r ;u0oet  ociydfsDum( sn(0trenmo3ta1fa e u ol()s2to(r3no1ll  lnesltf Dra(mp;t0open ieiadfaDemn pnu4tlxomo to1latrluvi;()trurxm3io1lltelncsa()sDraxm ot1oetomfciyt a rmn s (4altoif3oy1lmD anvo t) 2tmim3iudlptnmfctasfaDtaxmpnt1tleo i3ias s emnmp;u)texoio3iadomteanes;s0srto(m3ny1ll  lnetas)a2rr(ronu1oetn ictydlmDrl(msnt0texnioctytopt  ivo t) 2uoio3oudlm nlfet t  2rmu p;u1aeto ocilt a rl(ms u4altnmr tatfatr ieo;( s2xr(o iydaptelieil( sDtm(mo;u4aee if3iytla rlums t)trxoifciotoateanei;(  2trxrpny4lp  mnvtasf 2trumo;t1tetnmf3iytlm2ean s;u4arerircoa1fa rliesls0srxmxm3oy1lmtnlnctlt  rtaur ou0tlt moeiatfm eaums;u4aetrxf3oy1lmD luvs t0 rum(r oo4omee fvilt  Dtaumpnu1aexoioeiltls2um(mpnu)arxnxf ty1fpteauvo;s  2to(o3ou4ol e fciatfaruru p;t1apt iieiyd m um(vpn(0tltrmrciodlptelnei s)s2tmxr oudlpenlivia(  Dtaxroot4aleoif3tydfs2elu s;u)texnmf oa1lmDe uvi ()seum(rpnudapt mnes sfs2tru o;t1tex mo3tld a umuvp (0 leomf3ia1la r uei;s)srto(r io1ll n fetatf Dtmxmoou0apt mfctls aDul(mo;t) etomrciytomtelnvi t teurimpnudlleemivi (f rrruro;t0tleoifeiaslsDrl( snu0arxoirctatfm   uvols)s2urim iu4omt miesasfaDrmxmpnt1ope mi3tys mDra(mo;u4 rtrxrciotfaD luei t  rxrxopoo1ll elictat)srrruro;u0ole iociasfsDelumsnt) etnif3iytfatrlu i;s) ruoxopno1om  lnvi s  Dra(rpot1opxomfciysls ul(vp;u0trxomf3iydopt au o t0s2tm(m3nu4amee fvt sf rua(mont0tpx  ietyd a uauvo;t0aeerxr3oo1fat auei (0s2toirpiodoleelfctatfs2ururpot4apeomicild a2rlnvo ()aleoif oadfp eauvs;(0s2to(o3nu4ap nmncias a2trxm ;t0apxnii3tldfs2ea( on(4 lerxfciotlp   nvs;t) etm(opny4olee fei s) Drmx pou0aeeo fciltfm rln pn()altrio ta1omD  u o (0 euoxrpoo1ll  miviat)a2rm( oot1aeenmf3iatfsDeaums;u) rtrxo oodoaDrauvs (0 2xoxm3ny1ape  fet s)srtruronu1tpxn f3iadfs uan pn(4trtoif3ootop e ivs ( trtrxo3io1opt lietltf rrax pnt4texnifciydlmDrln snu0 leomr3tytomt livi (0trtr(o3io4llt mfes (f Dta( oot0oexn ociyd aDumuvs;t0 ltnmf3iy1fmD  u s ()t2uoimpoy4lmen ieslsfsDraxmp;t4teenioctasfaDrauv
\ No newline at end of file
@@ -0,0 +1 @@
+uvsls)sexoim3io1lm emfesas arra(mp;o4tetnmi3tys a rlu s t0arxrxfciadfa   ues;(  rurim3nodlm elfeia()srta( ont0tpx mfcildlm2rlnvp;u)tlxoircio1lmDranvs (  2tmio3oy4lpee netlsfarrruro;t0tpe  o3ias s2em( s;(0aleoxr iydfp rli s ()s2umxo3iudll elieslsf Drrumpnu1opeomfctyt a2uau p;u4areoio oy1lm eluvil()srxr(mpio1lme mnciat)a2rau  ;t0texomfciasfs2uaums t4aeeoif3iydoptrli s;s t2umio oo1am   ivsls) 2raurpoo1tle  i3tat s umumpnu)altoxocoatomDe u sls  rtoxrpoy4opt lncsl() 2uaxmono0opxnif3tldla elnmp;(4aexoxf3tatlateaies t)t2umirpoydaptemivilsf Dta(  ;t4alxoiieiadlaDumu o u0trtoxr3iydfpt aieo t)trtm(o3iodlmee fci s sDtru o;u4olx ii3ias s2emump u) lxrmo3ootlaDe nvo;t)srur(r ou1lme lfci ( sDra(  ot4oltoifciaslaDrlnvo;t)arerxfciydopt auvils) 2trio3oy1ame  net t sDuru  ;u4tlxnioeiys m rlnmon()arxrif3iytoa  ai o t0trxoir no1ale lncsltfaDua(moou0oetnmfciytlm2um(mp;u)trtnmr3oo1oatraieilt)srtoxopoudlmen fcs (  Dum(ront1oleo oeiatfsDumuvo (0alenxoctatla rauvo s)srtrir nodomee fetl(  rrrx  nt1aetomieilt aDul( o;t)arermf3tytfm r nei (0setm(o ou4olenlfetlt) Dtr(mp;o4aee mictls a2ea(vp u)aetnifctadlmt  ieil(  2uoir3oo4op elnvi ( srurumono4apxn iciys aDem( s;t4 lxriocio1fatelneo t)setmxm3ny1ale lici sf ruaurpot0aleniietyd m rm(mo u)aetnif ty1oa r u s;s0t2toxo3no1al emfcsas  2trx pou1ope mi3tlsfa2ul(vs;t)aeenxf tatfpteaues;s t2umio no4lmtnmncsas aDurum ;t1tex mictas mDelnvsnu) ltrircoatfp eai ols  2triopiu1lle mneiltfaDumurp;o4oleoii3iysla2ul( s t0tltoxo iotlm ranvo s0t2urxr3io4amte iet sf Drau pou0oex ifetadfs em(mo u0tltoxf totfp eai olt0 2uoxr oudop nlfet ( aDtr(  oo1oetn ociad mDrm( p u0alxoxo3oatfateanvs t trum(o nodalte ncs (  Drmu  ;u4olx moeiadlm emn p ()alxnifciytlpD livo;t)srxrirpoudopeemnetlsfsDumurpnu1aex ii3ils m2eau o;(4arxnio3tytfmt ai s;s)seurir nudllee fcias s2tm(mp;u0olx ii3iysfa el(mpn(4aeenxr3oadfp   nes;s tetoio nudlle mfctl() 2ta( o;o0tlt mi3iaslsDuauvp u)aeenxfcoatfmte nvslt  etoxrpnydopt  ictlt s2ur(mp;t4ale if3iysfmDrl( pnu4trenmo3oytlaDraiei ()t2xrxm3nydap emfvta(fa2rmump;o4apxo oeild s2rlump t0tlxoir tatfm e u o t0setoimpnodapeelivtl(faruaxr ou0alenmfcilslsDulu snt0 rtrxo3iy1op eau s ( sexo(o ny1ameemivils arurx o;o0tptn fcilt s ea( o;u0 lxomr3todlp rai o t truo(o3iy1lpt  fvilt)artrx  ;u0apxnmoeils a el(ms u4 leomo3to1fpDraivo (0t2uo(opiudamen fcias  Drmxrpnt0tpe  fetad m eau sn(0arxrmf3oydomtelnvi s0trur(r oy4lme  nvtasfsrrrxm nt0ale iietysfs2rauvo u0aeenmr3oydfp r ues s0srtrimpiy1ol nlncslt  rrmu poo1tlx io3iat m emumon(0tetrxoctytla r ieo;( trur(r oydlltnmnetas) Dum(rpoo1oexo oeiatlmDel(mo;t) eerio3tytoa rauvo;s)seum(mpoo4lleemncsl( srrr(r ;o4aetnmoctydlaDum(vs (0trtnxr3tytfmDeluvils)srxoxr oo1lmenmivs tfa2rr(  oo4apto f3iasla2el(vs u4aleoxo3iatoaDr u olt0s2toimpoudalen ivsa(  Dur( o;o1alxnifctad a rau o;(4trxomrcootlmt  ivo () rurxo3oy4llenmnvsls)srrax  no4aet  feiysfm rmu s;(0alxoxfcoadoa  aiei;t)s2xrxrpny4ap nlieia()a2rm( p;t0teeo feils m2elnmo t0tlxomo oa1fpDraivs s)seto(rpno1oltelnvi s) rtm(r ;t1ale ii3iltlsDeanmo;()teermf3iadfmteaiei;t0 euoimpnudoleelics s arur(m no4altn ietlsls2uln onu4 reomoctadfatelnvs;s0sexr(r3oudamt lfvsat) Dtrxm ;o0opt if3tldfmDulnmsn(0tlerio3tatfp  aivs () rtm(m iydlmeemncia( s2umxrp;u0tpeoiieilslm2um(vp;u4 ltniocootfatrai s;(0 rto(m3nudap eliesa(f rtmxrono1apx mfcias m2rl( p u0aexnmf3tytlpD lu ilt setr(mpoy4al elfei t) 2tr(rp;o0tetnifetyt aDeauvonu0 reoiociatlpte nvi s  rxmir3nu4apenlneilsfaDrm(mpou4apenii3tydlmDuauvs;t0 etoio iatop elivi;( sexoxr nydal  lneiat) Dta(r ;u4opt ioetatfaDranmp u) etrio tadopDe ivils  2umio oo4ll emncta(f rtrxmo;u1olt mi3tysla2rmnms u)aexriocia1oa eaivslt0seur(rpny1lmt  ncs s arrr(  nu4oleo o3iytfsDul(vont)tlxrmr3io1lpt  neils0teurxo3nodopt mfeil( arra(rpou1alt ioetyslsDel( p u)teenmo oo1om e u s (0 rumiopoodal emivsltf 2raxmont0tpenio3ildla rl( p t)aeeomfcoadfat ai ol()t2um(o nodoltelieslt  Duax pnu0aeto fctadla raumo t0 ltnmr3oatfaDe n ols  ruoxr3oudllte iviat  2tmxmoot4alen oetldfsDum( o u4 eerxf tadlm rlivo s0texmim iu4ale licsatfarum(ro;o4olxn ieiydlm2el(mo u4artoxo3iy1latelueilt sexmxr oo4aleelfei (fa2ra(ro;u4olx ioetasls2ra(mon(4 lxoio3oa1op e n ols  euo(rpoy1optemfesat arrrxrono4tpeoiociys sDea(ms;t4trtoxo to1opte ueo;t  etmxo iudlpe lictat) Dtr( p;o0open oeiad a um( pnt)aetomo iadlp r i o;t t2umxopiudaltnlnviasfsDumu ooo1olx mictlsls rmump;u0aeeomr3tadoaD ai o (0 rxoir3oodamte fesl(f Dtru pnt4altnmociyd mDea(vp t4 etrio3ootopDr n il() 2um(m nydom nliciat s2trum ou0aex moeiadlsDemnmo;(4aexomociytfatrlueils  ruoim3iodalenmnvsa()s2tru  ou1tpxomoeild a2eau p t)tlxoir tatfm rlieslt)trxoio nodll elnctls  2rmumono1aetn oeiasfs2eanvsnu0aeeomf3iodfm r i ilt0texoio3ou1ol   nvtl( srtm( o;t4open fctaslsDulnms;(0arxoir iotfa  lieils  2umxopoy4lm n ivsat a2taump;t1tet  oeiadfa2uluvon(4 leoifcto1omDeanes;t) exr(o3nu1lp  lnvils) Drrur no0openmoctlt aDelnvont4 lxnifciodlaDrluvsl(0srum(m iodome  neiasfaDtmxm no4oet  fciat sDelnvsnt) lerio3ia1lp  aieslt0t2ur(r3ny4lp nmnviasf 2raurpnt4teeomfeiytls2umnvsnu0texnmf tadlaD livi;s  etrxo no4lltnmiet t)a2ra(m ot4opxnioctad a ul(vonu4 reomocoy1lptrlu i s0s2ur(mpiodolen fcsa(fa2rr(rp;o4alxomoetadfaDelnvo;t4 eenmoctotfaD aues;(0trtrim3oy4lmtnmnvt (  rur(  nu4aptoio3ilsfs umu o;t4 rerif oydopDranvs ( srtoxo oudll   ivilt  rtaxrpot4tpxn iciysfa ul(mo;u0 exnxo3oy1fptrauvi t0 rurxr nu4al   ivil(  rrm(mo;t0tltniictlt mDua( p;(0trxomrciodfp rai i;t)texmxopnydlmeemieiltf Dra( poo4tpeomictat a eauvo;() eenmoctotfmDrli o;t)seum(m3nu4ap  mivsatf Drrx  ou1alto ieiyt a em( p;u)tlxrmo oodop  anvo;( trtr(m3io1lp emnet t  rta(r nu4tlxomoctyd aDelu o u4teenmr tydlm r nes (0 rur(opiy1amtemnetl( sDta(rpot1opxo o3iyd aDrl(vs t)altomr tytoaD an s;t s2xo(o oy4lm n fctltfarrr(ront4tle  o3ilsfs umnvp;t0 etrif3tydlmD  ues (0texmxo oudam n neslt  Duaxro;o0apeoiietydfm2ulump () rerxf iodfmtrliei;( teurxr nudaptn fctatf rraxro;u0olt mfciltlaDem(ms;t)trtrircoa1fa  lu sl(  2ur(o3iu1lpee ivslt  2urx  ou0oetnif3iasfs2ra(vpnt)arermf3oatom rauvilt) 2to(o3iudlpt mietls)a2rm(mp;t0tlxn o3iadls2umums t4tltnmf iatomtrliei;() rumir oudom elnvta(  Drr( o;t1aptoif3ildfs eln o u0tetrir tytfpDrauvs;( t2tm(r3nudal nmfvt s)a2umxro;o1altnio3tasls uaumpn(0aexnxo3io1oaDelnes;( sruo(r3ny1omtn nctasf Dta(  ;u1olxo fetls s2uau o u0 rtnir oatfmt lneslt0 exrirpoodlltelfes tfs2ra(mpot4texomieias aDulu sn()aetrmf tydfp elueil(0truoxm nudam  lncsasf 2rauro;u1tltn iciyt a2umumpnu4treoifcty1op elu o;t) etm(o3nodap e net s sDum(mpnt0aee  f3tasfs2umnvsn(4aexrircto1fpDe n s t)teumim3iy4ol e ictas aDtau poo1alt  ieiyslmDuan snt4aexoxr3oadfmteaneo;t texm(r oo4om nlneias)arra( o;t0olx if3ild m2um( pnu)alxomf3io1op rauei;t0 euo(o nu4altelnctltfsDrmu poo0tle ifeiadfs2rau o u0tlenir iadlat au i ()teum(o3iu4al  mnci tfa2ua(r ;o0olenmi3iydfa2emu p u) rxoir3oydlm rlies t t2xoxm oy1lpenlivs s)s2uau  no4apeo oeild s rau pnt4 eeoif3iatlm elnvilt t2urim iy1ale lnesas)a2ra(  ;u1oltnmieildfs2elumo t4 renxrcoodom  livi;s0t2uo(opiydome lfei (f rtaxrpnu4ale mfeiyd aDum(ms (4trtnifctatfa raies;s0 rum(mpoudlpeemnvi s  Dua(m oo4tetoiieiaslaDrmuvp t4 etomo oatfp  aneo;s0 rtoio no4lm   iei s arum(rono0tlxo ieiad mDrl( o;u4 eeomrciy1op r uei t) 2tr(m3nydalee ncils)sDra(mooo4ope  fetydfs2uln p t)artnio3iydlpDelu sl(  rxo(mpny4optnmiet ()arrrx pnt1olxn oeiytfsDrl( on(0 lxnmoctadomDeaiei;s0 etmxm ny4ole  ictltf 2umxro;o0altoii3iydfmDumumsn(0tltrif3iy1oaD  u i t0sexoxr3iu1apee nvsa(faDum(ro;o0teeo oeiys aDum(ms;u)alermoctydop  lnvs t0texmimpou4ol elfet tf Durxront4tpeomf3iyslaDrl(vp (0alerxr3iotom eln i (0t2ur(opnydalt livsas) 2tax oot0tleniociyt m uauvo;u) lerxocta1lmteln ols)s2urimpnudll n ivsas)srrau pnt1apeoii3tatls umnvs ()tetnmrcio1fp rln o (  2toirpiydapt lfes sf 2ur(mpot1opxn i3ildfs2ea(mon(4aexoxr ty1fate ueo;()s2tmxo3iy1am elnetltfs2rr(moot0tlxnifetls m2rmn o (0alenio oatfa eaneo;()trumio iydlmeemfes () 2raxrpnu1alx  oetas aDel(msnu4 exomr3oadfaDeaivs;s trtoxr iodoltnlivtl(  rtmum nt4tee  feiyd sDumu p;t0tetrxo iotlatrlu s;t)setmio no4ll  livsat sDuaurp;t1opxomoeiyt aDelu s;u4arerircia1lateaues ()s2xr(r io1apenmncs ()srumur ou0tpeomociys m um( p;t) rtoxo3ta1opD livs t trurimpoudap nmfcilt)srrrumpoo4aeto ieiatlsDrmuvp;()arxnio totlmDrliesls  eumimpiodoltnmivtltfartaumono4alt  ieiasls2rau p;t0aetoxo3oatlaDe ueo t0teuoir iy4openmnetl() Draxmp;o0aet  ieiat s ra(mp t0alenif3io1lm rlu s;(0sexo(rpnu1am nmieta( srtmxmont0tle mfeiyslm2ran p;u)arxrir tadopt ln sls) rtoxm3nu1apt  ieilt a2uaur ;u1ape ifciltfsDrlums (4aleniocoo1lp rauvsl() 2toim iodamtemfei t  rrmurp;t0ope mfetlt s um( o u) rtoxf3oatom r nei s0 etr(o3oy4lmenmfvils)sDua(monu4aexnmfetld s emn s t4 rerir tatlat luei s) 2umio iu1lp emnvsl(f rtaur nu1tetn fctasfm2ea(ms;u4treomfctatomtrli i t trtr(m3nu4lle mnvils s2rax poo1alt mfetlsla uanvo;()trenio3oodlm rln s;(  rxmim3oy4amenmnes t aDtm(m nt4oltomoetyt m2rl(ms;u4trtnmo iotoatrli o t) etmir nydomtelfcs t srrrxrpnt1tle mieildlmDel(vp;u4 exrirciydlpD au sls0tetrxrpiudom   fetlt arurx  no0oetomoctydls2em(monu)aeerxr iydlatrli o (  2ur(mpnu4opt  iesl(  rur(r ;o1oleo iciydfs ulnvo;t4altnmr3oytfaDeaies;()sexmxr iy4oltemicta(f rtru pno1ale iiciydfsDua(vs (4 reomoctodoaDelieil(  exoxrpiodlm n ict (f Drmx ooo4aptoioeiaslm2umnvs u4altrxr3ty1lmDraiei s0 2tm(rpnu4lmeemicil() Drrxront4aeto fciasls rl(mo;t0 rtomo oy1lpt anvi s)srto(r oydamenlfvslt)a2umum ;o4oetn iciasla2emn s t4arenmo iatlmt aies t0srtmxm3oo4omte ivtltf rua(mpno1apto fciatfm2ranmo ()aetnmf3todfmt lnvs;s)setmirpiy4olt  fctat a2rm(  ou0olen octlt m rlnms t0 exnif3iatfm elnvs;(  rtmio io4ol  lfesas)srtax ono0oltnmfeiadlm2rm(mo t) exrxfctodfaDr uvo (0 rtriopnu4omt  ict sf Drrum ;u1oet moctadfm2rm(mo;(0texomfcia1fat  uvo (  2xm(o3ou4amee ict sfa2tmump;u0aexnmoctydla2eln pn(4altoif oodlmt ln i ()teum(rpiy4omtemivtl(f Drmxrpnu4tpx mociadla2emu on(0aeeomrcio1fpD aneols0 eum(m3ny1olt  ict t  2ta(mpot0aexn i3tytls ea(vo;t4 etrir tydlp elu s;s texrim3oy1ol  mnetat)s2trx ooo1aet moetldfsDrlums (4tetoxrcta1oa rau o;t trtoir nydlp nlnet t arur(m ou1oetoii3iasfmDuanvp (0alxrirctatom elu i s  rxmim oo1opt mfvtl() 2rmur nu0apeomi3tatlm emuvpnt0 lxnmociydlate u s;( srtr(o oo1ap emncilt)arururonu0tpxo oeiydfs2uanvont4 reoiocoydopt auvilt0s2umxmpnu1alenlivtat)sDraxrpoo0aeenii3iyd mDranvp;t)tlxoxr3iatlpt ai olt0trxoirpoy4lm nmfesltfaDtmxrpoo4tetnmi3iyt m2raums;u4texnif tytoat  ivs;s)trxoiopnudol elneias aDur(mp;t1optomi3ilt a eluvsnt0alxnir3ty1fat ai s;(0srxrxrpnudope  feslt) Dtmxro;o0aetn i3iydla ulu p;u4 lxomoctatlaDrln s t) rumio io1ll nmicil( s2taxrp;u4texn fciytlm2emu sn(0alxriocoatfmtelu i;(  exm(o3io4lp   neslsfsrumu p;o0aeeomoeiysla eanmo;u4alerio ootomtrau i s0t2um(mpio1oltelivtl(fsDrru pot0olt mfeiyd sDrmnvo t) etnxo totfpt  ueo;s0 rtmxr3ou1llt  ncil() 2rax  ;o0apxomoetld mDumuvp t) rtomrcoy1opD  uvi;t0trxo(mpoydomtemieta(fsDuaxm nu1texoioeiat s ulumpn(4 exnmr3iytfat aieolt0 etm(r nudapee nvt ( arrru o;t1oltnmfciyslaDuan onu4 leoxociydfm e ues;t) 2toim nu1lpee ivs tfsrrr(moou1oet iiciydls2eln s;() rxoxr iytop e uvs s0srxrim io1ap  lfcsa(faDtaxro;t0ope mocild sDulnvp;()altrmoctadfpD luvo (0t2to(mpiodolenlfvils)srtmu pou0tpxn o3ils sDrmn o;() ltoirciytomtraueslt  eumio iy1lm nmfctls arrmx o;u1oeto i3iyt a elu s;u0arxnmfcia1lpDeaieo (0 rxo(mpiudal   iesl(fsrtaumonu4oetomo3iltfsDuan p;(0artrifciadfpt aueo;t)sexrxm ou4opte nesa() Dtmu p;o4opeomfetld a ran pnu0trtnio oo1oatraiei;t  exrimpno4al nmieil(f 2ta( o;u1tpx mfciad a uaums;t)artrmfcootop elueo;( trxr(m3iydop   ivias)artmu  ot4texomf3ilslmDrl(vpnu4artnxrciatoaDr n s t teuoxopou1ole mncsa(f Drrx  nu0oltn iciydfs emuvs u)arenir3iydfat  i s;() 2umim3nydopeelfetlt s2um( ooo1oee  feiys m el( p () exnxocia1op r i ol(0 rxm(m3nu1aptnlfvi ()sDuau p;u1tpeomf3iysfsDumn p;(4 leoir tydlpDraivo (0srtm(r iudopte nvtat  rrr( pno0olx mi3iad a2emuvp (0 ltnxociydfp r nvs;t  exrxr oudaltemfct ( srua(  ;t4apt moctydfaDelu onu)trxrifciydfmt lieol(0seurxrpio4op nmivslsf 2rm(mpnu4texnmieiltlmDuaumsnt4 renxr totop r ivi (0 rtrxm nodamt mfctl( aDrmur ;o4olxo oetlt m elums;t4arxrmo3oadomD ai o;s tetrxrpnudlme  feiat)sDuaxmp;t4alt iictltfsDemnvo t)aetrirciadlmtrlueil(0sexmim io1lpeemfvtl(fs2um( pou0apto ieias a2ea(vpnu0 lxoio3ta1fpDrlueol()trurio3oydllt mfcsat) ruaum no0aptnifctlsls2uanmpnt0 rxriocio1lpD lueo t)t2trir oy4openlicsas  Dua(  nu0tlenmietydlaDelump;()alxniocoatoaD luvils0texo(o3iy1al   fcslt)srtm(mo;o4aptomfeiasla2rl(vpnu0 ltoxr3oydfmDr nvo t0sruoxmpio4lle mnesat)srrmx ono0tet  i3tydla2ulnvp u) lenmo3oydomte ivs;() rtmxm3no1alenlivta() Drmxmo;o4aptnmictyd aDuanmo u4aeenmo3tatfmtrliei t0srxmxm io1alt lieilt  2rrur ;u0tlxn i3tatla ua(vpnt4tltrxrciy1fpt ln ol(0s2umimpnydomt  neias)artm(rp;o1oet if3tadfs em(mp t) exoxf ia1fmDeaivi;t)teumxo3iu1al  lfvi s  2trumont4alxnmieild m2rm(vs;u4tlxoirctydfptean s t t2tmxo3oy1ape mfvsas)srtm(monu1alt  f3iys a2rmnmp;t) ltrxfcoy1om ran ilt) ruo(o io1alt mfcsls  ruru onu0tlenmoetadfa ul(mo;t0 lxniocoatlpt  nei t trtmirpoy1lm emics (faDtmxrpoo4teen f3iyd m2rm(mo t4trxnif3ty1op r iei;s)s2trimpoudlltelivta(fs2tauront1aex iiciyt a2uan snt4treoxocio1fptrai ils  rxoir io1lmt  ictlsfaDrmxmpno0olxomi3ild a ea(mp t0 rtnmocto1opDeluvsl(  exmim iy4olt lnetl(  2umx o;o0tpt moetyd a elnvp u0tetoio oytfpDrlneolt0 rxmxo3iy4ale liesa(  2rax p;t0oeto f3iydfa2umuvont4alxnif totom   uvs t  2xrxm3io4amt mfcsas)aDtr(ro;t0olx  i3tlt aDuanvo u0 lxnxfcty1lat lneo;()trtr(opnydlleemici () 2umxmpot1teeniiciyt m rln o;t) eeriocoa1la e ueolt0 exmim3iodlmen nctl( s2ur(r ;t4altomfeiysfm2rauvs u0aexnmf3todop ranvi;s0t2ur(o3io1lp  lfesls)arrm(mpno4olt mieiadlm2um( p u) lxrxf3ia1om  lu o;(0t2tmio3oydom n fciat  Dtmump;u0alt ifctydlaDrln pn()aeenmo3totlm e n ols  exm(o iy4ap n ies sfaDtrurp;o4aetnmfeiatlm ranvo (0tltnxoctytfptean olt t2trxo oydlpt lnvsasfa2trx oot1oeenii3iad m2elnmp;u4teenxr3tatlm  ai i;s)t2xo(o3iydlp  mfetlt  Dtr( o;o0tptoio3tld m el(ms t)tltnxf iotfp rlnvo ( tetm(mpoy1omt lfvia( s2trxm nt4oexnmo3ias mDea(mont)altrxr3ootfptrlu o;s)t2xrxr oo4openlncia()s2raxr ou1texnmi3iadla ua(vs () ltrxocty1la eanvils sruo(opoodalt lfvtls)srtrxmono0alx if3ilsla2ul(vpn(4 leomr3iatfaD aieo;(0 2ur(r3oo1am  lfes s  Durumpno4opeoioeiltfs umnvo;(0arenxr3iydoaD  uei;()seuo(m oodop  licilt s2ra(rpnu4olxnif3tydfs rlump (0 rxoxo3tytomD  nvi;t trumxm3oy4olte nvs s)srtrxronu4tlenif3ilsfm rmn p u0 rxnirciydfpD  ies s0 2urirpiudamtn ieta(fsrumum ot0aex iociasfa rm( snt4alenmf oodfmt lies t) etmxr ny4opeelnes t) ruauroou0aet  ieiyd s2uanms ()aexnmfciotlpD  nvi s0trtm(rpoydal e fcsl(f Dtau ooo0tlenmi3ild mDumn o ()alerxf oo1oatelieol( t2trxo3nudom n icsl( a2rrxmo;t1aee  ocias m rmumo ()trxoir iadlptrlu i s tetrxmpio4optn fci tfs2rmu ooo1apxn oeildla2emumonu4aeeoxo oatoaDe ivilt t2xmxrpnodap emnetas) rtrx pou0aeeomociatfs2umuvo;t4 rxrif3oy1fpte nvilt  rtrio nudlm e feiatf Drmx onu4ape  ociadfm2elnvs t4tleomfcoatoatelu s;t)teumio iodamt mivsas)aDrmu  nt1alen fctad a2ra(vs;(0 ltnxo iatomt aneo;() 2xrirpoo1ope lfesat arrrxm no4open i3iys a ua(vp u0tlenxrcoo1lm e iesls texoirpny4llt miet t  rum(r no1aetnioctlsfs2emn p;u) etnmrcia1optrln o s0texmio3iudom n ict t  rtrumonu4oex  o3tasls rmu p u) rerirciytfa r u ils0seur(rpio4altnmicsl()sDurumpou4tpto fciytlaDuanmp;t4alxnxo ty1faD  iei s0seum(r oy1lmt lnvta(f 2rrumooo4teen fctldfs ranvo;t4aetoio3oy1la rlies;t t2to(m no4ame  fesasfsrum(mp;t1tle ii3iatls ua(mp t)tlerxf3totomtr neslt)sexoxo3oodlmeemicsl() 2rrxmpou0aeeo o3ias sDeluvo (4 reoif oodfaDr ueo s) 2xmxopnydale  fetatfsrra( oou4aleo o3iad m2ulump;()trxniocoydfmDe ivo;s) etoir oo1apt  ivtat)s2umxro;o1tpe mociyt a ea(von(0 etnmf3todoa  auvsl( texoio3no4lm nmieil( arra( pot4texnifeiadla ean p (0tleoxociydfat luvo;s)t2xriopio1ap  mncsl(  rtr(r ;t0alxoifcildfm2umuvp;t) eeoio todlpteaivolt t2xmio3ou1alt lfvta(farua(m oo4oeeomoeiytfs rmn on(4 renir oa1lmDeauei (0trxrio3oydolee fvs ()aDrmx ooo4opeoioetysla2ua(ms (4altomo iydlptrluvo t s2tr(opiodamen ncs sfa2ua(  nu0opxnio3iadfa2ea( snt4arxrmf3iodfp elieils)sruoim oodom  lnvias) Dtrx onu0olx  fciltfs ul(vp;t0 eeomfcto1lpt auvo (0t2umir3io4lmenmnctltfaDurx ono0teeniictldls2uau sn() ltoxfcoo1la raneo t0seurxm ny1llenmfct ( a2raur nu0tex mo3tldla umn o;u)tleomr to1la r u i;(  2xrxm3oy4amt  netas arum(mp;o4oeeoii3tltls rmumo;t0tlerxfciodoaDrlivils0trxrirpno1amenlietlt a2rmurp;u0openmfeilt m em(vsnu)texnmociodfaD livi (0t2ur(m oy4om elnciltf rumu p;t0oetnmoeiyt aDem( o u4arxoxr3oytomtrlu sl( s2uoxm3nudllt liciat)srra(  nu0tpenmoeiyt s2um( o;()aeenioctotfa  liei t)s2urimpnodlmtnlfvi s  ruaxm nu1tpto f3iaslm2ranmp;t4arxomr3tydlm   neo ()teto(opoudlmtnlfvil(  rrr(ro;t4alenioeilsls2el(mp;u)aexoio3oy1fmteauvo;s sexoir3nu4ll nmivtas  rtruroot1oltn icilsfs eanvo;t4 lenio oodom  lu il(0s2xm(o oo1lp eliciasf Dtr(moot1tpeo o3tls m ul( o t)trtoxo oadlm rlneils sexoirpoo4oltnlivilt a2tau  oo4oeeomoeias m2elu p (0arerxo oy1fmt lu ol(  exrir3oydlptn fetl()aruaurp;o4tlxn o3iytlmDul(vsnt)areoio3to1lmDeaivs s) exmio3iodlltemfes s  Dtrumo;u4tpx mictlsfs2ua(mo u4trtrxf3iadoa rlneolt  eurxo3no1ome  fei (fa2rrumooo0teenio3tydlmDrm( ont4 rtnxfctatomD lieslt  2um(rpou4apt mfetl()artaum ;o1opxnmictysfs2emnmp;t)aeenmocoo1lm r ieilt0s2um(mpiy4alt mnvi t)a2rr(rpno4tltnmfciysls emnmpnu0 rtnmf oy1omt  u olt0 2uo(rpno4alte fvs s a2rmu pou1oex ioctadlsDulnms;t0tetoif iotfa  lnes s teuo(rpiydoltemnvsa()srrm( poo4optoifcild s2ulu snt0 renxf3iatfat au ils srumxm no1olte ietatfa2rmxm ;t0optn ictytfs2uaumsn(0trtnmrciydlm rlu il(  2xoio iodome lfvtasfsDrm(mo;u4apt mocildlm umn s;u) leomo3oydlatr nvols)setoim nodlp nlnvsltfsrta(m ;u4tet moeiydla umn s;(0 eenmoctatfat  i sls) rtoxmpiu1am e fvta() Draxm ;o1aetomiciadfs umnvon(4artrif ia1fmDelies t0trtmxm iodaptn fci ()aDtrxmpoo0teeomiciadls emumonu4trxrifciydomtrlu s;s0srtr(o nudlmee nvi t)sDrmum ou1tetn fciydlm2umnvo;u4areoxr iydomt livo;(0 rum(o3iy1omenlivia()srra(r ;t4oex ii3iltfsDemuvp;(0tltnmr totfa r uvolt0truo(m3nydlmeemivs t sDraurpoo0tex  oeiadfmDelu o;(4aeeomo3iadoa e i sl()trtoxm nu4om emfeias)s2umuro;t0olxnmf3iytfm2ra(vp;(0altomo3to1laD  u s s)t2xo(m3no4opeemfvta(fsDrr(rp;o4tptnmoctldla raumo;u0trxnxo3iotlp eai o t)t2xo(r iydopen ieiatfa2tmxm nu1alt moeiytfa eluvsnt4tlxrio3tytoa r ivi;s)s2xmxm3iu1apte nct ( a2rau p;u1oet iicias aDeaumo;u4 reoiocoy1lp e uei;t s2ur(r3oydom emfet t arta( ont0texo ieiatlsDrmumon(0tetnmr oatoptr neslt teur(o3ny4aptnmnctas)srrax oou4oeeoioeiyslm2ul( o;u)tltoir tytfp rlues ()truo(o3io4lmee fcsa(  2trum no4optnmf3tltfs eanvon(4arxrxr3oydlptelnvs;t0 etoxm oudaptnmfetlsf 2um(rpoo4aetoii3tyd s em(vp;u4tlenxo3oadfmD  nvi;t0t2toim3oy1am emfvil() 2ur(mpnu4tlxomfctldlmDua(mo u)teerxo3oo1laDeluvs;()texoio no4oltelnci s s2ua(r ot4aleoiicils mDel(vsnu0trtomf3tadopDrai i ()teuoir3iy4ol e fct ( srurum ;t0oetnmietltfm2emuvpnt4arermoctydfa  lnvolt  exrxo3iy1ape lneiat artmxmp;u1ope  fctydlm2rm( s;t4aeenir3iotom ran s s0sruoim ny1apte ivta(  rumxr ot1tpxoif3iydla2umuvo;t) exnirctatlp rlnesl( trtoxo3nydaptemietlsfa2rau o;o1alx  o3tys m2ulnvon()teermo to1omt ai o;s0sexmio3oo4openmnetltf Dumumo;o4tet ioctydfsDra(mpnu)tetomf tadlp  luvi s)trurxmpoudlmt mfct s) 2rr( p;t0altniocilsfa ra(vs;t)tlerir3iytlmDeaieo;t0 etmio3iu4ll emfvs (faruaxrpno4tpen o3iydla2rmuvs u0 lerir3tadfm rlu il(  rtrir no1al   fvi s aDta(ronu1tlx  feiasfs2umu p (0 reniociydoptraneo;s s2umiopno4alt  iei ()sDrax pnu0texoii3tatfmDranvsnu0 renif todlaDeli ol( tetrir iodale  ics s  Dumxm ;o4alxn oeiasfs2ua(mp;()trxrif3iatfptraivo;( teumxmpou1lptnmfeia(fa2umurpou0texnmf3tad mDulnms u0altnxrcoatlmteaues;s)trxoxm oo1ap  mfctl(f rta(rpot1tlx iieiasfs2rln o u) lerxr3oodopDran i;s)seumxopiy1lme mfeiatfsrtmum ;o1olx  o3iasfm rl(vp (0 ltnxo3ty1om  aivs;(0 rxm(r nu4ll  licsatfaDumxmp;u1olxn feild aDel(ms;u)trxnmrciadfat aneo;s)sexmiopio4altn fvsltfarrrum ;t4olx moeiltfaDul(vs ()tlxrxo tydlatrlu o t) 2toxopno4lp emncsas srtrxrpnt4texn ieiytfmDeau p (4texoircto1fmtrli i t0 2trio3nu4omtemict s)artm(mpnu4teeo fetldfaDua( s;u)texnmo tadoat lueo ( srto(o oydlmeemivtatfaDtrx o;o1tle  oeiydla em(vo u)arxnif oatfptrau o s0srumim3oydllee nctas  2raxmonu4aexniictas m2umu on(4 exnmo3tytfa ean ols tetmir iy4lpenlict s sDurxrpnt1apxoii3ildfm2rauvs u)aexomocia1oaDeau o;( texrxm oy4amenliet s) rraxmpno0tetnmo3iydfm2uln p;t4tlxnxo iy1fm rlieo;s tetoiopoy1am  mfcil(f rrmx oou0tpxo ieiyslaDulu snu0 lxnir oatlatrlieo;t0trtoxmpiy4ap nmiesa(f rtm(  ou1aexomoctytfa2eanmsnu4teerir3io1omt  ueol( t2xmir3nudomt  ietl()s2rau pot0tet  fcilsls rau p u) rtnxf tadfpD luvi;s  etoir no1ol nlietls) Dtr(roou4apenmfetytfs2ea(mp () leoxo oatlpDelneols) rtmxr3nodlptnmnci s  Dtru  oo4oeeomoeiadla raump;(4artomf3oatlmt an i s sexoxmpio4ape lnctl(  rrru p;u0tleoii3ils m2rlumo (0aexrmo todomD aieo ( t2trxo nydolte fes s)a2um(r oo1altoii3tas s2ea(vsnt4 lermr iydoaD livils0 rum(r ny1lmtelfeils s2tmxrpnt0tpenioeiyd m rmnmo;u0 lxnio3io1latr u s;s0srtrio3oydlme mfeils)a2taxrpnt4aeeo fciasla emn s u4aetnmo3ia1om ranvo;t  exoirpoo1amee fviat artrxm ;o0alt  f3ildla2rl( s t0trermo3oytfpD  u s;s0 ruoxo ny4om n nviatfa2raxrooo4ape  fetysla rmumo;u0aetrmrciydoa  auvo s)seuoir oudomeemfci s)a2tm(  no1aetnmfeilt a2raumpnu0 exnmf3io1lm e ueilt trxrir3ou4omenlnvtas)artax o;o0tet mf3ils a rmumpnu)tlxnir3iy1fmDrau slt0 rumio3ny1apenmfvilt) Dtru ooo1tetniieiltlsDem( s;t4 eermr todopDrlu i (0s2umxopiy4lp   nvs t)aDtm(rpnt4aex  ieiyt s2eanmp;u4 rtnifcoo1fm  lnvs;() 2toxrpio1amee ict tf Durxmo;o4apt  f3tadlsDumn o;u4 rerio3iodoa  anvo s0 2xoir3iy1opt lnesatf 2tm(mo;u1tpx ioeiasfs rl(mpnu0aexnmo iy1op rli s t0 2xoxr oo1alen nvilt) 2umxm no4oltnmi3tyt s rlnvonu0trxoxf3iy1fm rln ilt0sexoxmpny1om  licil(f ruru o;o4oeeoif3iasfs emums;t4trenmf iotlate ivs t srxoxr iy1am emnet (fa2trumont4tpxn octlt a ul( on()altnmf oadom  lnes;()srtoio oodlpeemfvi s) 2rmu ooo1open f3iyt s emump;t) rxnxrctotfaDeluvil(  rtoxopny1ll nlneiltfaDua(r ou1tpxnmietat a2rlumonu0 exnxr3iotfa eln slt) 2um(o3iy4aptn fcslsfartmump;u0oeto oetasls rmuvp (0arenmo tadopt ai sls  rxoxo io1al n ivt t)s2tru oot4olx iiciatfs rau sn(0 lenmo3iytfm  livi t0 rto(r iy4opt lfvi ()artm(rpnu1tpx  fetadlsDua( o;u0artoxf3iy1fmt ai ilt0trxm(o iy4amenmietls)s2uaum ot0aleoio3iasfa emuvs u0texoxo iy1laDr nvo;t sruo(o oudope mnes s)arua( pot0teeoio3iatfaDeauvont)alenif3todoa r n o;(0srumxr iodamtn fctat)aDumuronu4alt miciytlaDrlu s;t)trxrio oatomt aneol(  ruoxo3oudlle mfet ( arururpot0texn ocilsls rlu p t4trxnxf oo1optrlivi ()seumim iu1lpe  nct s)arumur ot4alt  ieildfa2umumo () reniocoy1op eauvi s) euoxr3oo1ll emicsasfs2ua(mont0oexnmi3iatfs elnvp;() exnif totfm raies;(0teto(o3oo4ome mnvtls  2um(  nu4teeo fcias a el( s;t4arenmfcoydoa eauvs;() 2tr(opiudlmen fct s  Dur(roou1aptniociat s2um(mo t0trtnxf3tatfmDe u ols)sruoxo3ny1omtnmnvtls)sDrm(ro;u1tleomf3ilslm2rl( s u4arxrio3iodlptr ueo;t s2to(opnudllt  fcils)s2urx  ou1ape  fctls s2eanvon(0aeeomrciydoaDe n s s0srtr(rpoydlltn iesas  2uaxm ;t1tee  o3tas a ulnmo;u4 rxnxf oo1om r uvi ( teuoio3iydom nlicils)aDtaxm ;u0olxoiieiysls eluvo u0aeenirciotfmDeauvi;t0s2ur(opio1op nmnet ( a2rrx oou1opx iieilt mDrl( p;t0 rxrmf tydlpt au sl( seur(r3oodole livt (f ruax poo0olxo i3iad a2rl( s (0alenxr3oatom elueol(0t2urxm io4lme mictltfs2rrur ;t0ope iieiadlmDemums;t0trermo ty1op  au il(0s2xmiopno4lle  fesa() Duaxr ;o1ole iociydls elumo u0 exnxrcoodoa r uvs;s setoio3oy4lptnlnct s) Drru p;u0opt  i3iadls uaump t)treoircoytlp rluesl(0t2xmirpnudopeemiesl(fsrtrxmoou4alto ictad a rlnvpnt) lxnir io1fmt lueol() rtmimpnodomenlfvtas)aDumx  nu4tptoii3iad a umuvp u)aexoir iy1fateluvs t teuoir oydolt mivils arur( o;t4oeeomfetlt a2rmuvs;u)arxrio3tatomt an s;s0texo(mpoydoltemiciltf Durur nt1aeen i3tatfs rlnms;u0tetrmo3oydlmtelu i s)seuoxr ou1lltelfvsa( srrrxmp;u0alx  icildls2uanms t) exomf oy1oa e n o ()seuoiopiy1ol nmiesas)sDrax oou4aetnifeiatfa2umu s;(0tetnxo3todfpDr n s;t)srumim3nu4lmeelncilt  2umumo;o0texo i3tydfa rmnvpnu0aleomf3oy1omt lues t)texoir ny4ope lnvs sf 2umum ;t0oleo icildlm emnvs;t) exnio oy1lm r ueo;s0s2umio3nudlm e netls aDrau ooo0oexnmf3tydfaDeanmo;() rxnxo3iydlatrln ol(0s2umimpoy1lm   nctls) Dtaumpnt1tpt io3tadfa2emuvo t) lerifcoatfa e nei;t)seurxr oy4op eliet sf 2rrxm ;u0alxoiiciysfs2ea( sn(0treoio3iydlptrlivsls trxo(rpoodom e neias aDrrx  oo0tpx  icilt s2rmnvont)trtoxf oo1omDelnvi () rxrxrpiu1olte nesl()s2umum no1tetomfeiat s ea(mo t)texrif3iatlmt auvils)tetoxopny1op nlivils  Dum(r ;u4aetnioeilsfmDelnvsnt4aetrmr oy1fa e u ilt trxr(o3iu4om nlivta(farurumpou0apt iictls m rl(ms ()aetrmfcto1omDelueo (0srtoimpnudomtn ieiat) rumxroou1aexoifeiltlmDrm( pn(0areoir3oatfmDrlueol( trurim3io4lm   ncsasf 2ua(mo;u0aee miciyt aDrl( p t) reoxr tydfpDr nvs;s0trtm(o iy1am  mnviat  rur(mpoo4tpto i3iad a rmumo;(4aexrmfcoadlaD  uvi;t0trumim3nudolen icsa(f Dtrx pnu4texomfeiyt a2em(mpnu4tetriocoatlmt  iei;t  rurxo3oodlltnlneilt)a2rmx onu1teen f3tad mDulums ()aexomf3tadfa elu slt0t2trxm3oodom   neiat  2uaurooo4alt  oeiad s2ra( p;()texnxf iydlateli i t0 exo(rpoy4al  mivi (  2raur nu0tlenmoctasfm2el(vs u4alerxf3totlm eln o;t0srxr(mpiodlpt mfcsasfs2rm(m ot0aleoifciyd a el(vont0aexnifciatla e ivs s)texoim oy1apen fcsls aDuaxmono1aexomieiat a2um(vsnt4aexrif3tatlpDrlivolt0teurim3oodom e fcs t)s2urxm ot0oltn feildfsDulnvo (4 rxnio3oytopteli i;s0texo(mpnudom nmies (fsDta(  ;t1oltnio3ildfm emnvs (0tetnmo ta1fpt aieils) 2xm(rpiu1ole lieilt  Duax pou1tle mfciltfa2rl( s;(0 exoxociytom elnvs;s seurxo3nudomen ieslt) rtrxrpno1aex mfeiydfm ul(mont)teeoiocty1lmDraiei;t  2ur(m3oudoptnmnet s sDtmxr nt4tltomoeiyslmDrmnmo t)tetoxr3oytfatr nvo ( sexrim3iy1ol  lfcil() Dtmu oou1alxoiieilslaDuauvo;u4alenxrciodlm rauvi (0srto(rpno4apte ncsl( sDtmuroou0teeo octas s rmnmp;(0aleoxfcoy1latraues;()setr(m no4optn fciat) rrr(m ou1olt iicildfm em(ms u4treomo3oo1oat  ues;s)texrir3nudap  livilt srumuro;t4oexoii3iydlm2uluvo t)tlxrmo ty1opt li i (0s2urirpnodlltelfvil( aDumxmo;o0alxn octls m2elump t0 rtnirciydfptraieilt0 2tr(m3ou4ale lncils)aDraumooo4oee ifeils s2rm(msnu0tltnxrcoy1fmte neo;( trxrxo3iodam  mfctas s2truro;t1ale ioctlt a rauvs;t4tlxnmf3tytlat ai o;(0 etoir nydlle mieta( srurxrpnu1tpeoiicilsls2rm(vsn(0artrxo3ty1la  anes;() 2ur(opiy4ll e ncia(  rtr(m ;t0alt mf3tysla uan p (0altoiocia1oaD lneolt) rum(r nu4omt  feta()sDtmu pnu1teto iciltfs2eln p;u0treoir iadfaD ln i;t0texm(opio1alenlncs sfa2tm(ro;t4aexo fcias a2rluvo;(0 rtriocoo1fmDrauei;(0s2xm(m3nydlle lfcsl()a2um(rpoo4tlenii3tydfs2rlu o (4 etnmr3ty1om   ivo s0srtoxm nu1lm  lict ( aDtmu p;u4tlxn feiasfmDelump;() leniociatom  lneil()s2xrxr3nodlmt mncil(f Dum(rpno4tpx mi3tat sDuauvs;(4 reoif ootlmtr ivi t trxr(m3ou4omen fct t)a2rmump;o4olxoioeild aDum( p;(4aetomrcoytomte nvols  2tmxo iodlpe mnesl(f Drru o;o1ope mociyslm2rlnvsnu)texrio3iydfmtr iesls tetoiopiu4am emieiatfsrtmu o;u1alx mo3iydls rlnms () rerxociotlm rli i s s2umir3oy4llt lfcsas  2taumpoo4opxoioetldls2rm(ms () exrifcoodfaD aivo;s0truo(r3nodaptemfvsls)srrrxrp;u0aexn iciatls ulnvo;t4 rxrio3oytfpDr u o;s s2tmxmpnodal e fcs t)arraxm ou1opx mfeildfs rmnvsnu0tltnxo tatopD livol() rxm(o io4llte fcslsfsrua(rpot4optnmo3ild aDem(vo;t)aexnifcoytopDe nvi;(0 rtmir3nu1omtelivt s) rtau  oo4oetomfctldls emuvo u0 ltrifcoodomDr nvi s texrxrpiudlle lict s srrru pnu4aleoiociyd a ua( o u0trtoio iotfaDelues;(0trumim3iudamenmnvias  rrax  ;t4olenii3ilsls ra(vo;u) rtomr iodlmt luvi t setoir iu1amtnlnesa(fsrrmu  nu4aexomfeiasfs rmumo (4arxoiocty1lmt li s;()texmir3iudop elneta() rtmxrp;o4tpxomf3iydfsDemnvp;t4 rxrif3oytoptraueolt)setr(m iydomt lnet (fa2rr(mpnt1tpeo feilslsDem(vonu)alerir tatlmD auvils0tetoirpoo1optelietls)srurx  ;u1texomi3iatfmDumuvs u4alerxr totopDr ivs ()t2urim3ou4apt mieias)a2umur nu4aeeoifciltlm2rau pn(4arxnif3totla ean il( srum(o oy4alt mfet t s2tr(mooo4olt mf3iat aDra( pnt0trxrif ia1lpDrlivolt0s2um(opny1op e ivs (fsDtr( p;u0oee mi3ildlmDeln ont4artnxocoodlpD  i o;s trtmim3no4omeemnct sfsrtmxmooo4opxn feias m2rlnmsnu4 lxoxocto1fpDrlues ( s2um(o3no4olenlnct (fsDtrxrpou1tet  feiadfa2raump u)arxrio3oo1oateaueslt)s2tmirpoy4ol nmnesls aDumu  nu0tpe iociasfa rau s;u0tetrmf oo1fp eai i;s s2trxr3iodap n ncil( a2urxm ou1oee  ictat m2ua( o (0tlenxfctodlm  au s;s0 rtrxo3oo4lp n net s)s2raxm nu4aet  oeiatla2eauvpn(4 eeomfctydfateai i t0s2xmiopoo4llenmfci (  2tmumont4aetoioctadfa2ul(vsnt4arxrircoatfaDr neil()texrir io1olte feia( aDtmxmoou4tpe  ictldfa2rluvonu0tetrxfcto1la elueslt)trxmxo oo4omeemfct tfsDrmu o;u0alt io3iytfsDulu s u4 eenxr iodfpD  ues t0 exo(r3oo1ope lfvsls s2umum ot1oet ii3tad a rluvpn(0 eerifctydlmteauvs;s tetr(o oo1op elietl( srumx o;o1tlxniieilslaDulnmont0tlenir iodoatraivo s0texrim nodlptn nci (fsrtaurono1oexn ocilt a2elu o;(0aeeomf3oa1laDr uvi;t0 ruoio iodam elncta(faDraxmp;o4aeeniociasfsDul(vont0 rtoxr3oy1lpDrauvs (0seurxo ny4op e fci tfs2ra( pou4tlt mfciat aDemnvo t0artoxfctatfa   nei;t) etrxo3iodlp n feslt artru ono1opxomfcilt aDel( snu0teeomf3iatfa rai s s t2trir oo4aleemict tfaDtaurpno0oeto f3tas s2elnmo () rxnmr oy1fp ran s s  exm(o3no4altn fetl()s2umuroou0tlt  feiytls2eauvs t)tltrmf oodlpte i i;s  2tmim3iu4opee fcta()a2ta(  ou0olxn icias s2emump;u0alenmf oytlmDe n ilt0 rur(m3oy1lm nlivtlt sDua(  ot1opxoifeiydls uluvs t4trxrmo to1lptrai s t trxm(r3oy1ome mnvia(  2uax  ;u1aleo ietlt a2em( p t4aetnifctotla rluvi t0 ruoim iy4open icia() rtrx  oo0apeniiciyd mDra( s;t)arenir3tadfaD aivs t)trxoim3iodome mnvsls  rumxmpot1openmf3iadfa uau pnu4arermo io1lpDe uesls s2uo(m no1ome livtl()srtmu pno1apxn octldfmDulu s;()texoxr3todlmDe ues;() 2urxrpio4al  lnciat)sDua(ront4oeto feild m2rau p;t0 lxrxr oo1fa r nvol(0s2toimpiy1lm nlnvt ( a2ra( o;t4aeto feiydfa2umnvsnt4alxnif iatoat  ivo t0 etmio3oodll  micil()s2tm(  nu1aeeomoctyslsDeln snu4 lenxf oydop   uvslt0srxr(m3nudaptelncsasf Dtmx p;u1aexnmf3tad m2ra(vo t)alenmo3oatlp ean s;() exr(rpou1ap elnvtl( srtmu p;o4texnif3iytfa emn p;u0tltrir oatlp eaieil()tetrim oy1om elicslt aDtru  nu1oexomfetldfaDran pn(4arxnxr3iatlmD ln o;t srtrxm nu1amt  nei t)srtrxm nt1texomoetytfs2ranvp;t4artrmfcoa1la rau s s0 2xoio3nu1llt  ies s)a2tmxrp;t1tpxnmo3iys s elu sn(4texoirctadlmtraneo;s texrim3oudamtemnciltf rtaumpnt1altnifeiyt m2eluvpnt4 exrxr iytoptranvo;t0sexrxmpno1apt  fvtl(fsDuru o;t1tee iociytlsDrmnmpn()arxrif3oytlmtelies (  eum(m3oy4ol e fvia() Duax o;o0alt moeiaslm2el(ms;t)texnifctadop r n i;()srtrxmpio4om nlncsls)srrau p;u4oetn o3ils sDeanvo (4tetnxf3iodoat  ueo t seurio ou4ome mics s) Drmxrpot0ope ifetlsla2uluvpn()tlenmrcio1fp rai i t)s2xmiopio4am emneta()srtr(rpnt4opeomf3tltfa umu sn(0aleomrcia1opte u o;(0srtrimpiy4ameelieia()s2umu  no4texomo3tytlaDum(von()aexrxo3tytlat lnvo t seum(m3no4lleelfctat sDurxmono4tptomieiasfa2rmnvs (4trtrir3iatfp rln i ()s2umim oo1altelnvsl(faDrmx p;o1tetomfeils aDea( o t)treoif3oy1fmD aivo;t0 rur(m3io1lmeemnvt ( sDrmum ;o1oetoioetadlaDrl( ont)arxnif iytfp eliei t0 rxr(o nu1amen neiatfa2rrx  ou1tpeo ocild sDel(mpn(4 exnio oodfpDrlieil()t2umio no4lpt mnei (fsrtax oot0olxoio3ilt m2ea(vp ()alxnif oa1op  livslt0 2um(rpoudlm emivsatf rtrur ot0opeomicilsfaDuln s t0trtoif tydlpDean i;t seum(m3io1omenmieil(  2rmum ot1aetoiociatla um(vonu0tetnxr iydlatrlneilt trxoimpoo1olt lnei (faDrrxrpno0altn ociadfsDeanmp u0 exrmoctotfpDrlnes;() 2xm(o3oo4lltelivilt a2raum nu4apxo feiatlmDra( on()alxnxrcoa1lp   uei t) 2trio3ny1ol e nvsas) rra(r ot4oetoiocias mDum( o;(0tlxnmocty1fmt  ueo t) eurxr nodal nmivt (fs2rr(mo;t0aex  o3ildfaDum(ms (4trermocoadlmte ueo t t2um(mpnu4lpee fes sf 2tax  ;u4aexnii3iatla uau pnu0 ltrif3iatlmteanvi s0seurxmpnydapenmietlt arta( o;o0oeto fcilt m uanvo;t)aexomo3ty1fa rlieo (0tetrio ny4ame lfetas) rurxmp;o4ape miciydlm rl(mon(0tltnio3oydfa e u o s seur(mpnu1amt mivtl( artrum nt4tpeomiciydfmDulu p;(0aeenmo3ia1fmteliei;(0t2xrxopiu1apen ivsltfa2rrxr nt0tpe mieiys sDumnmon(0texnmr io1oaD  n s;t)trtoim3no1lpt miciasf Drm(rono0teenmfciyt s eaums u0 rtnxo3todlp ranei t)srto(m ou4op  lnei s)s2tr(  oo0aexn i3iasfm eanvpnu4trxrxo iy1fpDrln ols s2trxr3ou4alt mfcias s2rm(  ou0optomfciltls uluvsn()tlxnifctytfmDe nvs;t0setrir3ou4am n fvsl() rrrxmpno4tlxoiieiasls2uan ont0 rxoif3oodfm rlies;()s2xmxr3oy1ap elneias srtrumoou0apt  i3iydfsDul( s;u0 exoio iytfpt  u s;s)teuoxo3ou1apen nctls  rtrxroou0ope mfciat sDua( pnu) rtrxfcoy1oatraiei;s0texoir iydomtn fctlt sDra(mooo4apenifeiys s rl(mp;t0aexomf iodoa e nei;t0teurim nu1ameelnct sf rtmxmoot0olt  iciyd aDrl( s t0texnio3iadfpD  neils  etr(mpoy4optnlfciasf 2tmxrono1tptomi3iyd m el( p;t0altnmfciatfaDe uvs;t0sexrir no4lp n fvtls arur(rpot4olt  fetyslm em(mo (4teerifcoydoatr i i;(0 eumxm3no1oleemivs t arrrx o;t1aptomfeildfs rmu p;()trenxrciodlptelueils  rxrxr3iy1opte ieias) ruru  oo0alxomfctatfm rm(mo u)texoirctadlm elueo s sruo(rpiu1ame mfcsat) rtmumono1aeeomoctatfsDea( p () exoxr3oo1lptrlieo;s srtrxrpiu1omeemncslt)aDtrx pnt1tlt  oeildla ul( o u4alenxocoadfpt lnvi;s)s2tr(r3nudapt  icsasf rra( onu4alt ifetytlm2ua( o;(4trenxo io1op  lu s;t srxoimpoudole livt t) rraxm ou0oeeo feildlsDuau s;u) rerif3totlpDrau o s0trxoxr ny1oltnliesls)srtrxr ;o1opx io3iat s rl( s;t4trtnxo3iodlmD an s;s0seumimpnu4lm  lfvia() rta( p;o4olxn ietls m ul(vp;u4 rtoir3iodlp rln o;s0 eumxr3oy4aptelfct (f rumxro;o1apxnmoctyslsDraums;u4 lxnxf3oo1omt aueo;s0texoxo oo4lmen nciltf Dum( o;t1alto oeiyd s2eln p;u0texnif3oydoat livi;(0teurxm3iy1ole lnes s) 2ra( p;u4tpe  o3tasfa2rau p;t0 leoxf oytlp eluvol( texr(m3iu4op n fet tfs2rmur ;u1olt  oeildla2ea( p;()trtnif3ta1fmDean ols)s2xm(opnydopen ncs s)srtaur ou1olt  feiat sDulnmp u4alxoxr oo1fmDrlneo;s0seto(opiu1lm  lnvt tf 2tr(moou0oltnioctls mDuln sn()tltrmfcoytop elu o;t)s2tmir oodlp nmnciltfsDrmx  nt1tlx mieiydls2rln s u)alxnxocta1lpD luvs t) 2urxm3ou1aptn fvs s)a2ua(  ;u0tpen ictlsfs2rmnvo (0altomoctatlptr n s () eurxo iydll   fct (  rrmu oot0aptnifeildfm raumo;(4 rtoxo ty1fmD luvo;t  2uoir iy1opt  ietl()aDtrumoot1aexn icildfsDrluvpnt)teeoxocoodomD  i o s)texr(opnu1ope mfvtas a2um(rpoo0tle ioeiydla2uln snt4teeomocoatfmD lu s s)sexr(r ou1lmee ivsl(fsrtrxmo;t0oex  i3iatlaDrlnvpnt) renir3iadfp elieils0trtmxmpou4olen fetat  Draxmp;o0aetn oeiatlm2rm(mpnu) renxo tydfmDean s t s2trio3no1oleemiviat aDrau pnu4oeenii3tyslm2el(vp;()treomf iatlpD lnvols0tetmxr ou1llt liesa(farta(mpnu1ope  feiad m emnvp;(4teenxf3oadfa   ues;s) 2tm(m nodllte fes t)s2taurpot1tpxo f3tatfaDemuvonu) exomocia1laDelnei;s0sruoxo io1ope lfeils arrrxroot0alt mfeiasfm2rlu snu)texnmfcoydoateln ols srxoxr3iu1amt mivils sDua(  ou1aeenmieiat aDra(ms;(0aexrxo3oa1lpD aieo;t0t2tmxr3no4oltelfes sf rur(r ou1openmfetls a ra(ms;u4aexrxfctodfm  lu sls  ruoxmpnydope mivtlsfsDua(mpno0apx miciatls2ua( o;t4tetnxo3oo1faD aueils)tetoir ny1optnmieil(farumx p;u0optnif3iys aDrluvs t0 rxnxocoytoptrlivi;( t2to(rpoy4op nlfvtasfartr(mpnt4oltomfciyt a ea(mp t4 rtnxocoy1fmteaivils0 eumio3io1lltnlnvtlt)a2uaumpot0tpe  f3iltfsDrau onu0aeenxrciadfpD lnvi;t  ruoim3oy4lp e fvia(faDtru pnu0teto i3ildlsDrmnms;u0alxrmf ty1lp  ln i t)sruoxo oy1llee fctlsfa2ur(mp;o4aeeoifciatfmDeaumont)tlenif3oadfp rlivo;s trto(o nu4ol n ies s  2umur nt0opx  iciysfm2raums t0artoio3oytfatr u o;(0 rtoxr oy4llee fcsat)sDra(ronu0tpeomi3iadls ea(mo;t4alenifcta1fm e n sl(  euoim no4apeelivil(fsDrrum oo0teeo i3iyt s ea( s t) renmfctatoatelueslt)seuo(o3nydalen ivt s) 2rauro;t1altomociad a ea(mp u4tlxrxfcoy1fate n s;(0t2tmimpiy4om   ietlt aDua(mp;u4aet ioeiaslaDeln s;u)artnmf3oa1lat  u sl(0trtrirpiy4ap n net s)arumx  ;o4opeoio3tas s2eluvp;u4alenmf3ia1la  livo (0s2xrimpiu1ame  fei s a2tru oou0aetomfeilt s eln snt4texrmo io1fm eau slt)srtmxrpoy1lmtnlnes sfarrmx o;o4aee  oeiatla2rlu o u)alxoiocty1fat lieolt)setoxm3ny1ll e nviasf Dtmxro;u4olxomi3ias a2ranvpn() lxrxfcoodfa eluvslt srxmxm nu1lmtelnvils a2umxrono4opeoiociat m emums;t4trtrif3iotoatrlu s;()s2tm(rpno4amenlfeiat sDum(mpoo0olenmfetadfm em(vont4aeenmo3to1om eanes ( teumio3oo1al  lnvslt  Dtr(r ;o1tpxnif3tyd a2elnmo t)trtnmf tytop  li o;(  etoxr3nudaleelneta()sDta(r nt1apx ifctltlaDul(vp t4artnmo3tydfa   neo;s srtr(o ou1om e ncslsfa2tmx o;t0tpxoif3ilt sDean pnt)trxoxo3ootlaDe uei s srtr(o3no1ap   neslt artru  ou0tlx  oeiyt sDrm( p;t4tetoxfctydfm raiei s)tetmiopoy1omt mfvt t sDtrumpoo1olxomf3tad sDuanvo;u)aexriociydopDe n s;( s2urim iydapen icil( sDrrxmpnt1alxoiictasfa ra(vo;()aetoxo ootlpD  n i;s t2tr(r ny1altnliesat aDtax  ou4tpxoifciltls2rlnvp u0 etrmr3oydlaDe n slt  rurirpnudomtelfes s)a2tm(ront4tpeomictldfs2emuvpn(4tetnif oytomte i ils0 rxmxo3nydale mfctas)aDrru  ot4ale  ociyd s2ulnvs () rxrmr3iytfatrli olt srur(mpoo4optnlfvias)s2rm( pou1alx  f3iltfs umn snu4treoiocootoat  u sls)trxoirpnodomtnlfvs sf 2rmx ono4teen oetadla em(vo;(4 lxnio todomtranes;s) rtm(m3nydlpe  ncsl(fa2tau pot0oleomfeiysfm um( on(4teeoio iatopt  uvslt0 2xmir3iy1ll   ici (  rtaumpno1openifciadlm2uluvpnu4artnif tatfat ln s;t  exoxo3ou1olee nvtls srtm(rpnu0tpe  feiytlsDeauvo u0 rxomf oy1lmtrlnei;( trurxmpiydlmtnmfvs t a2umxmo;t1oexn oeiytlm rlu s t0 rtniocoadoaDe i i (0s2tmio oy4amee nesa(faDta( pou0alx iocilsfsDrmnmonu)tetrxr iy1lp e n s (0srumxm no4amtnmivt t)srraur ;u0altomociltfsDuln s u0alxrxocootlm  livolt0 exm(o3oodamenlncta(fsrtm(mp;u1tex if3iysls rl(vs u0treoifctatomDeanvi;s srxmim3nu4op   fctat) Drrxm oo4alen fciadfa ra( s t4trtnir iotlatr ivs;s srxoxr3nodap nmfeiltfs2rru o;u1tltomo3ild s rmn p;t)tlxoifctydfmte u ol() 2toim nu4opt lictlt aDrrxm ;t1tltnmoeiys sDeanmpnt0 etnif3ta1omteauei (0trur(m ou4lleelieiat  2uaur no4apto o3tysls2ul( sn(4artrif3ty1oaDeaueilt0t2urxr ou4opeemfei s)sDtr(rpno4tptn iciat a umuvp;u)artrirciatfpt  u s;t)teumir3no4lm nlnvi t) rrrxmp;t0opto o3iltlm rlu onu)trtnif tatfpDr ues;t)srxo(m3ny4amee ivt t) Dururoou0altoii3iaslmDrl(vo u0 rxoxf3iytla rliei;(0trto(mpiudamt  fctls) rum(  ;o4altomieiad aDuaums;()alxomr tadopDelivsls trum(r3oo1oltelfcslt)sDtaxrpno4oex mieildfmDea( s;u4trerxf3ty1fm ran slt) rum(r oydll n iei (fs2umx oou1openif3ildla uanms;(4 ltnif3oo1faDr iesls)srxo(r3nu4al nmici tfaDta(mo;o4tpto ieiydfa ulnvsn()trenmf to1la   ueolt0srurxr3oo1lpeelivsa( a2ra(r ;t4teeo ieils sDrln p;u4trtoir oy1fa e neo (  2um(mpnu4lmen ietat)aDumuro;t1alenifeiasla2uln o t0aleoxo iy1fa rai s (0srurxrpnudlmtn ieslsfartmump;u0tpto ocilslmDrlump u0trerio3iatfptrlu i t t2umim3nu1ale mivil(  2um(mpot1opxo ociasfa2eanmo u4 exoir oo1fmD lueslt)s2umxr3oy1amenmfetls aDrm( oot4tlen octatfm rluvp t4areomr to1lm e ivs;(  rurxm nodoltnmncsatf 2tm( ont1tltn ieiydlmDumn p t0arxrxo io1lmDrai o t) eurxopny1opeemncil() Durumo;t4oeenmietat s2elumo;u4 rtoxrcoo1op raivo s sexmxm ou4lmt micslt  Draxr ;u4alt  o3iys a2ean sn()aetoxf3ootfpDeanvolt srtr(r3iu1amte ivsasfa2tmur oo4tltoiietyd m2uaump;t0alxrifcoy1fatrluesls0 2xmxo ny1ll n icsa()arum(rp;t4alenmi3iytfmDua(vp;(0arenmr iodfm rlneslt)t2tmxo iu4altnmfeia( sDtax o;t1tptniieiatlaDua(msn()tlxrmfcoodfmteai s t0t2tmiopoo1lltemnvta(farrax  ;o0opxn ietltlaDrmnvsn(4 exnir3iytlaDrau o;t0 2um(mpny4op   fcta()sDuaxront4texoio3ils sDrm( s u4artrifcta1lpD  neol(0 2xm(o3nudll  mfcilt)arumxrp;u1apxoii3tytfs uluvp;u)aeeoio ootla  aueo;( t2urxrpiodome lfetat srrr(rp;u0aexnii3iatfa umnvsnu) lerxf tytfp  ln i s s2xr(opiydap n icsas a2uax o;o4oetn i3iltlm2rmuvs;t4tlxoxo iotfatr nei s0 2xo(m3nydaptnmnvsl() Dur(rp;u0tltnmo3iaslm2rlnvon()aexnxr oatlm rli sl()setr(opoo4lpeelieils aDraxmo;o1aexniietld s2rl(vpnt4 etrmrcoy1lpDrlnvolt0 rtoimpnu4ol nlncs (fa2taxr ;u0apeoif3ilsfa2elumpnt4tlxomr3oatfmte nvo (0sexoxmpoudal nmiviat  rtm( pno0teeoifctldfm2eanvon()tltnmr3to1oaD lnei s0srtrim3iodal  mfcilt)aDrmx p;u0olxoii3iyd sDranvsnt0trtnmo iydlp   nvi t0trumxm3ny4ol emict tfsDuaurp;o0opeoif3ilt m2umn pnt)trxrxf iadfp ranvs;s s2uoxrpoydlmtnmfciatf rumx  nt4oetnif3tltlm ulnmo t0aeenmr3oytom e uvi s trurxr ny4ame mivtlt)sDum( ont4apeoif3iaslsDran pn(0teermr3iydlpDeluvo;s)trtm(o3iydlmeemnvi s a2uaumpot4apxnmf3iyd sDra(mp;(4aeerif iy1lmDelu olt) 2toxo3iu4alee ncsa(f 2umu o;o4apeo f3iad s2ua(vs t0altomr totoat aiei s0 eurir3nu1apenlnes (f rrmu pnt4opxnii3iadlm ra( p t4 rxoxf3tytlm rlues () eurio3io1lpenlnvt t artrum ou4olenmociltla ea(mp (4 etnmocta1latr ieo;s  ruo(o3ou1ol emnviat)s2tm(  ;t0tltoifctad a2eluvont0aetrioctydfpt lneo t0sexr(mpoy4lmeelnesls)arumxrp;u0oetomfciyt sDelnvo u4texnxr3oodlatranvo;t)seumio iodome mncsa(f Dur(rpno4tltn ocilt a uanvs;u0trenmf3io1fat  neolt) rxmim oudamtn fvsa(  Drmxrp;u0ale ifciatfa el( p t0arxrxfcoatfat an i;s0srxoxr oodol n icsatfsDumuroot1oltomi3iad s2ua(vo;u0aleoio3oytopDelnesl(  euo(rpiu4lmt livi t a2tm( pno0tltoifctytfsDumumpnu)aexrio oadlate n o s0setoxrpiu4ope mfetat aDtrx p;u1oltnii3iad s ra(vo;u) etrmociy1lpt  nes t)s2xmxmpou1omtelfei t s2urur nt1olt mf3iys sDrl(vs t)arxnxo tydopDelivo s0sexrxmpnu4lm emfvsas  2umxmont0tetoioetltla2ea(mpnt4tlenmf iy1op   nvs;t)trxoxr oodopeemivsas)aDtaxmont4tlto i3ildfaDrl( sn()tleoiociytomDe i olt0t2toio ny1om  mnei () rur(  nu4ale mfciydfm2emuvs;u0alerio3ia1oaDe u s;s0sruriopoo1llt  iesasfs2rmxmo;o1apto fciyd a2rm(vs u)alermr iytlp   nvo;s0 exrxr nydol elnet s)aDuau  ot4olxo oetls sDem(mp ()trenmrctotfa rlu o t)trxo(o3io1al emnctltfarrrx ont1aleoiociyslm rmnvpnt) exrmfcoydfmDrliesl(0t2xr(o nydopeelfctlt)srtrx pou0tetomfetytlm2elu sn(4aetomf3io1om  aies;t0texmxo3oudll   ieia( aDtaxmpot0tleoii3iltfa ua( o;(4altrxo3iotom rauvolt truo(m io4olenlnvt ( sDrrxrp;u4teto octydfm ua(mpnu0 reoir3todlptr n o s) 2tm(m iodal   feiatfaDumxrpou0tpeomfetysla emn p u)altnxrcto1fpDelneilt0sexr(o3ny4amee iesl()s2rm( onu4tle ioetlsls2uln p;t) rerxfciodlp   ueils0 rto(m oodlltemivtl(  Dta(m ;u0apxomi3iasfmDrau o;t0aetnxrctydlate u il(  2uoiopiodal emiesa()s2rru p;o0apenmfciatfs umuvo;u0 reomf todfmtr n ils)s2urirpoudame livslt)aruaxm ot4tpx  octasfm2um(vp;u)trxomfcto1faDeli i s0srtmir iu4amt licslt) rrax p;o4oltn oetys s rmu p;(4tleoxf3oytopt liei (  2xoio3nodaptn ictls) 2ua(mpnu1olto f3iadlm2ra(vo;(4 etoio3io1late i s;t)trum(r io1lp n fvsltf 2tru p;o1tee mo3iydfaDeau sn() lerxoctydlm elu s;t t2uo(m3oy4lpen feiat  2trumo;t4ole mo3tldlm2uluvpnu)texoxfciydfaD  nesls)s2xm(mpoy4lle  fctl(fa2umxmpoo1olenmfeiatlm em(ms;u0texomo iotlmtr u olt0s2xrio ou1ol   fvsl() rurur oo0tlt iicilslmDran onu0 eerxfctydla  ai ils) 2uo(o3oy1oltemnvsls) 2umuront4tlto fetas s em( snu4 eeoif ty1fptr ivs s)t2tm(r3ou1oltnmivilt  rraum ou0tlt ioetytfmDul( s;(4aeerxf iytla  lu o;s0srxoxmpoo4llenlfcs s  2rmur no0tpe  fetadlsDemuvp t4aetnxo3tadlate n ils0tetr(mpnydlp e fvsat)arrrx  no4openioctas a umuvo;u4 etoircio1op rau ilt)t2um(r io4ope lnvtatfsDurumpoo4optnmieiatfs2eanvpnt4 rxrio oa1fptrliei (0 euo(r iu4am  licia( artr(mo;u0alto o3tydfs2eln on()trxoxfciodop  aivsl( teumio3iudlp  liesa() 2uax  ou4altoif3iatlsDrlnvs;t)arerxrctatom r ivo t0texrio io1apt liciat  Dra( o;u0tpxnmieiat m2rlumo u) lxomr oadlpDrlneo ()setmirpiodalt mfctat) 2tru oou4tet  ieiydfa2rmuvsn(4aetnmr oatfatr i o t setrio oodlptnlfviasfs2umx p;o1olx ioeiltla2el(mpn()trenxo iadopt aivs s srtmir iu4op  miesls artmxr nu4tetomfcildfaDranvs t)treoxo oydlpD an sls)seuoirpnu1llt  fvsa()sDraxmpot4oleoioeiydls umums;(4 reomrctodlaDrlivo t)texrxopiodlmenlfesat) 2trx pot0texnmoeiaslsDrlump u4 rerio ootfat lnvolt)srtoxo nu4optn ivt ()aDua( o;o1aeto ietldlmDem( o t4tleoio tydla r ieslt0setmxmpoydlm  lnci t) 2tmxrooo1apeo oeiyd a2ua(monu4alxnxo oatomte ivi ()tetr(r3ou4olen nvil(fsDta( pot0tltomf3ildfa emnvs (0arxomr3iy1faDr ivi t)trtoio3ou4alenlfcsa(fartm(rpoo0alt ifetlt m2rln pnt0tlenxfctodfpD  nvo (0t2xr(o nodam e fctl(faDuaxrpou4teenmo3iltlm rl(mp u4 rxrir3iotomD  u i;( srurio3ou1ap n fvias a2raxmo;t1tpx  f3tatfm2eauvpnt) rtrio3oa1oat  ivs ()sexmxmpiu4omtelnvtat)srum( ooo4oex  fciadlm2ulnmo t) eeomf oodlmte i sls0s2xrio3io4ape  ivtas) Dtau  ot1ape moeilt a ra(vp (0tltrxf3iotfpte ies;( s2to(mpnudopen nvs t) 2ur(rpnu4olenii3iat s rmumsnt4aeerif3oo1faD  u o;t0trumxrpiy4omte feias  2trumooo4tptomictyt a emums;(4trxnioctytfpDraieilt  exrim3oo1ap nliei (f Dumu onu4apx io3iltfmDumumo (4tltrir oa1fatrlivo;t0t2tr(r3nydlpen netl(faDtaxronu0opxo feiys s rm(vpn(0texoircto1lmD  nvo;s0srtmimpoo1omtemnet s  Dtrxrpnu1apto ociatls el(mp;t4 reriocoydomDe ueo;s  2umxo3nu4lleelncslsf 2ur(  ;o1teeo ictasls rau s;(4teeomr3iy1opD li o;( setmxr3no1lp n neiltf Dtaum ot1tptn i3tatfm eau ont)aexrmf3ia1om ranvsl( tetrirpiudaptn nvsls) 2rmump;o4optnmi3tasfs2um(vs u) eeoircoa1fp rlieolt)s2uoio3ny4ap   ictat  rrm( pou4apenii3ils mDrlnmp;t4 etoifciatla eliei;(0s2to(o nudllen ivslt s2rmumpnu4tpe mi3ils m eluvo u0trxnxo3ootoatrlu il(  rur(r oy4ll e fetat srtr(rono4oexnmoetys mDean s u0 etnir oadoatr n s (0 rurxrpno1lmenmfvi t)aDuaxrpot1tpx  fciydls2rlu p t) etnxr3todlatraivs;(  2xoxr3oy4lp nmncil()a2um( pnu1teto o3tysls eauvo t0trenmr3iadfpt aueslt trtoxr3oodolenmivslt aDrmxmonu4aetn f3iasfmDem(ms;u)aexnmr3oytlp e i i;(  2uo(o ou4amt lfesl() 2tmumo;o0opx if3iys sDem(mo;t) lenmr3tadoa rlivs;t) 2uoio3iy4llt mfvsl(faruru oou4tltn ietyt aDrm( p;u) ltnxf3iydoaDelneil(0trtoir oydamtemfvsl(fsrua(r oo0teeniieiytlaDelnmsn(4tlenio3oatoat  neils  2um(m3no1lleemfcs ()sDuax  nt1oleoioeiysla2uauvon()areriociodop  anes s t2trirpiudlm nmivsas)a2rau  ot0aeeomo3ias sDuluvonu)treoir3oadlpD ai s (  rur(r no4amee ncta()sDtaurpot0opeoii3tyt m emnvp (4arermr tytopDrauvo;t) exmxr3nu1llt mnesa(fa2tm(  ou4tpe  oeiadfs2emn o;() etoxf3tatoptelueils)trurim iodlm e nct () Dtaur ;t0ape mictyt m2rmums;u) reoifciatlmt lieo;() rumxm3io4lltemfci t a2trxmoot4ope  o3iadfm eaump t)artoxociydfpD  n i t)trtoxo3no4amenlnvsas) Dtaum ;u1olxn fctas a ea(vs;t0tlerio3ia1fa elu s;s)trum(o3iodame lnvtl(fsrua( o;u1oeenmo3tadfm ulnms ()teerxrciodlp  au s;s  eur(o3no4ol eliciat)srtru poo1ale ioetydfa em(vs;u) lenmo ootomt aneilt0 2tr(r iu1op  lictlt)sruau  ot0apx mi3tadls2uau s;u)tltnmf3ty1fptrliesl( teumxo3oodoptnmfvs s  2ra( ooo1aex  oeiysls rmnmp;(4aexnir3todlmDe i s;s)seurir ny4olt lneslt) rrru pot0tpen i3tytfm2ean snt0 exnif3tydoat  ieols0setoxmpnodomt lfcils sDtm(mpnu4tleniieiytla2eanvo;()tetnir3iydop rli ils)setrxm oo4llt  fvtlt a2rau  nt0tpenmo3iadfmDea( pnu4 reomf tadfa rlueo s  etrxm3iu4opeelfeilt aDrmxmpoo0olt ifctys s rmu on(0artomr iatoa eau slt0s2trir3nu4optelnci tf rrmx pnu1tpxo fetldlaDemnvo;u0artrmf oa1oaD  ivs;t srxrirpnudlmee fes ( srum(rp;u1tpenmo3tatlm umn p t0altrif3totfmt  n o t0 eum(r3nydol emnvi sfsDrrumono4alxomietltfsDulnmo u) rermr3to1omDraues (0 eumim no1apt mict sfs2tau  nu4oex if3tltls ea(vp t)areoif3tydfa rauvols seto(m3nodapt  nvs s  2rmx  nu4aetoif3tatfa2rlu o;t) eeoircty1lmte ieol(0 rxoimpou1openlivi (f 2umxr ;t0tpeo ieiadfsDeluvp u4tleomrciydlpDrlivs t) etrio ou1alenlnvtlt a2umum ot4aexn i3tldfs2raumpnt)areomr3ootoaDraivo (0 etrio3iodlmeemnei ()sDta(r nu4olxn fcilsfm2em(vsn()tltomo oodfpt li s;( s2to(m iy4lp  mncsl()sDtr(moou4ape  feildfs2ul( snu0treoiocoadomDranvsls srtr(r3iydlpeemnvt () 2urumpoo1teeo i3tyt mDel(vo;(4trxrio to1fpt au s (  euo(m oy4ale  nvtatfsDuaurpnu1tetnii3iasla2ul(vp;(0tetomr3io1lmD  nes s0setr(rpiy4lptnlncia() Dtmum no1tpxomieias mDumnvp;u0trtnxf3iodlat au i ( sexmxrpiudal elnvsat)srrmx o;t4tlxomicilt a ulnmont0tlxrmfcoydoaDr i o t tetoxr3nu4amenlnctltfsrra( pnt0aptnmf3tldfa2ea(vpnu4artomr io1fmDeaieo;t s2umxo nu4omee fcsls sDrm(moot4aptnifctatfa rm(vs;u4 ltoir iodfaDraneo;(  etrxo3oodlpenlnvta()s2tmurpnt0oeenii3ilslm2rmnms;t)aexrxf oa1opDelu s s0srtrirpiu4lpen ivsls)sDrmurpou0texoiociysfm2ulnvp (4trtnxrcootfpte i i;t)srtmxo nodlle  ieilt  2rr(  ot4opt  ocilsfmDrln o u4altnmo totomteluvs (  rurxo3ou4opeelfvsl(fa2tau ono4olt  feiydlm ulnvs;u4 reoir3oy1lm r uvi;s)teurim3ny4lmen ncs (fsDur(mpot4tltn f3tasfa emu p t)trxoifcoatlpDr uvol()seumiopnydolee neils arumu pnu0tex mi3iasfm rauvs u)arerxoctodfmDrlivo;s s2toiopiy1ll  lnvil()sDuru o;o1oltomo3ils s2el(mpn(0artoiocoytoat  ivo;(0 2tm(m iy1ll  mnes t) 2rrurpno4tpt  fcilslm2ul(vont4 exrmfcio1fat  uvs ( t2tr(m3ou1alen ieils)arumu poo0opeo ocils a2eau p;u4tlxoxrciy1fat aivi (0t2uoxopoy1om n nciatfsrra( ont0oet io3tasls2rmnmont)arxoifcoytfaDelnvi s0 rtoxrpnydal  mfcs ()arua(mp;o1tptnio3iydfa ulnvsnu4 lxnxo3iatlp rlivs ( truo(r oy4am nlivil()sDrrxr ;t1tpen i3tlt m2elnvo;(4tltrmr oatfm rlnvo;s0trxoir nodomt  fcilt) rrr( ont0texn fctls s2ea( p;() eeomf3oo1fmtraivol(  ruoxopio4amenlfei () 2umump;o0olenifciad s ua(mo ()tltrxr io1oaD an olt srxm(opoodal  mfesat) 2uru  ou0tetnif3iytfa2el(vp;()teenxfctydfatrau o s trto(r ou1al emfesa(fartm(rp;o4teeomo3tldls rlumsnu0trtoxr3iytoate neo;t0s2trxrpnu4olenmiesl()s2uaum oo4apenmoetas a2rmnmo t)aexnxo3tytlpt auvo;s t2tmir iy1lm e icias)aDtru p;t0olenmoeild m rluvs u0tltnmo3iodfp r nvs t) rurirpio4lmtnmiei t  2taurpoo1texomociatfa2ea( onu4tetrio iytopDe uei;(0seurim oo1altnlfetlt a2tmx p;o4alx ifctys a ulumpnu)trxomr3iatoateaueo;(  2trio3io4lmee nciltfa2tmxmont4tltnmfeiadlaDuauvo (4 rxrmfcoo1opDeai s (0texmxo3oy4llte icta(  2um(  ;t4alx  octadls em(mo;t) rxrmf3iodop ran s;(0 rto(o3io1altn fesls) 2urumono4olen oeias a rm(msnt0 renio3totfaDelies t  etm(opny1llt liet tfartm(rpoo0tltn octyt m2rm(vp ()tlxrxf3iatopDrlieilt)t2xoxopnudaleemfes (  rtaumono4tlto ictys mDulnvo t4tlxoiociodfp ran i (  rurxrpnu1op  lfvt () 2tm(ronu1aptnmfcildfmDumums u)tlerif3ty1fp e u o;(0texmio3iy1lp  livi t) rrauroot1tee iicild m2uanmp () ltoxrcoatlm  luvi;s trxoxr nudal nmfvsat) rtrxr nt0openiictydfs ra(mo;() exoxrctatla  lu i;t trto(r3iy1altn nvs tfs2tmu onu4optnmi3ilsfs2ra( snu4arxoxo3todfa   ies s  rxoim oy4lmt  ivt s) 2tax  ou4aee ii3iltla2rmnmon(0 renmf ootlat liesls t2xoxrpiy1lleelfvsa( s2um(m ;u0oltn f3tadfs ul(msn(0aexrxr iotlpt lies;s0texrxo ou1al  mnvs s)artmx  no4tptomf3iatla2ul(vp u0artoxf3iy1lat aieo ()truoxo nydlm  mivt () rtmxmonu0teen iciltlm2ea(mo t) rerio3oadoptrlivol( seuoxopoo1lme  neil(fs2um(mpou1alt iictlsfaDel(vo;t4arxnmrcio1fmtrluei;t0trtmio no4al e iciasf 2ua(mpoo1oleo oeiasla umuvs (0trenxrcoy1la  lu ils)texr(o3ou4lpe  ivtas  Duru  ou0oltnifeiyslmDuluvp u4 etrxr3tatoatraivs t)seuoirpoydop emictl(faruauronu4tltomf3ilsfm rmu p;t)tltnir3iadfpDran i;t)s2uoxr oodlpe  ivil( aDuaxmp;o0tlxoii3tatfa2el(vp;t4 ltrxfcio1oate n s s) etrxo3iy1ol nlnei t a2rr(mp;u0tlt ifcils aDel( pn(4tlxrif to1fat aues;t trxr(opoo1lltelivi s) 2rrum ;t1tlxomo3iyd m ea(mpnu)aeeomf iadfmt  uvi;t0t2xr(opio4aleemieias)s2tr(moot1teto o3tldfaDul(vsnt)aleomrcoadlmDr nvols  exrxopnu1omt lnctls)s2tax poo4teeo o3iasfs emumpn(0 rtoiocoy1fptraivol(  2xrirpoo4lp   icta(  Dtaur ot4olxo f3ild s ran o;t)tlerxfcoo1fpDr n s;()t2xrxm3ou1lltnlfvi sf Durx onu4oexoioeildfm uluvsnt)arxnir3tadopDrluvol()sexmio oy1olenlicsls artaxm ;o1opt iietltfsDra( p t4 lerir3iydop rlivs;s)sexm(opny1ll  lnvsl() Dua(  ;u4texn fctydlm eanvp u)aleoif tatlp e uvslt0trtm(o oudlmenmneil(f 2rau onu1olx  feils m um(von(0aleriocoodop   n ol( t2toir3no1lp n fvt s  2um( poo4oeto icild a2ra(ms;u0 etniociy1fa  ai slt)srumxopiy1om  mnei s) rrr(  ;t1olt mo3tatfa elu o;u0tltnmocoa1fm r i o;( s2tm(m3iy1lp n ivsatfsrtm(mo;o1opxomf3ias sDuan p;()alxomrciy1oaDr ies t)tetoxo3iudomenmncsl() rururpno0apxnifeilsfsDea(vo;u0tleoir3oadfatraueol( t2urxmpiy1omee icil() rururonu4tlen fcildfa ra(vpnt) ltnxf ia1lpD  i i t)truoir3io1ope mncs s s2raum ot1ape ii3tas a elnmp (4aexomf3tytoaDeaueslt trtr(o oudam emncsl()aDrmurpnt4tee mictasfmDrm( p;u0 rxomr3to1lmt lues;s setrxmpiudol eliesl(farraxrp;t0aeen oeilt a2rl( sn(4 rxrmrctytfmt  iei s0texmio iu1al  lnvil(fsrrr(  no1tltn f3iad s2elu s;(4trenmr tytfaDr ivo;s0seumim oydolee fvs s) rta(ront1oexnmfcildls em(vpn(4tlerir todlp elnvs s t2toir3iu4llenmics sfs2tm( pot4opeoio3tltfaDraums u0 exomf3tytomD lu i t0t2tm(r3iy1lleemfei sfa2tm(ro;t1opeo ieiaslm2ua(vp u4tltoif tatoa rli s t) exr(opno1lmt mnvtasf Drmx pou4tlenioeiysla elumpnt4alxrxrcoatoaDeln ol( setoio3no4lltnmfes (  Dtru pno0opt miciytfm2um(vp;u)trxrir ia1fp r ues s0trur(m3no4om elncta(f rrru o;u1opto iciydfa eau o (0 ltoxr3ootlatrlueo s0trtr(o3nydal e ics sfartrum oo1tle mociad sDea(vsn(0 rxoxo oodop elivolt0t2tmxm3no1apenmicia(  2tax pno0tpxniociad a2emnvs (4aetrxr3iydfmteaies s) rtoxrpiudopeelnvia( aDraur ot0aleoioctysls ulnmo (4aeenmfctadoatelieo t) 2tm(opno1lmte fetlt)sDtaumono4tpxn oeiaslm uau o;() rxrxrcta1omtelnei;t  rur(rpno1ap e fetlt  2taxrpoo1alxnif3iyslaDulnmsnt) rtrio3iotop eauvo;s)texmir3nudapenmnctat)a2taxmpou1texnmoetas mDulump;()alerxr3iy1oat lues;(  2xm(rpio4lm nmics s)sDrrumono4tet io3tys s2rlnmonu4tlxrmocto1opteanvs (  eumxmpiydlle mnesl()aDtm(m ou1apeo o3iyd a2ulnvsnt)tetrmo tydlpDe uei;s) exr(r3nudllt mnei s  2rau ooo1olx ifeiltls rm(msnu0 ltomrcoy1op   ues ()trxr(mpoo1lmenlict ()sDurx pnu4apt mfcilt m emnvo;()aleoxf oytoat lu o;s texrxo nydlmt lfeilsfa2uaxr ;o4oleo iciaslsDemn o ()arerxf3iadomtelivils)srto(m3ou1ome  netlt)arur(  ;u1tlx  octld m ea(vsnu0alxrxrcoodoa e uei;s)s2trim3io1lptnlfvs (fs2uax pnu0oexoioeiyt mDemn snt4trtrxociy1opD lieo;t srxmirpnu4lmtemfctls a2ua( ont0tex  iciys sDemnmpnu0arxoxr ootfaDr u o;s) rxoxrpou1olt mnvsat) rurum no1alx mf3ildfa uanmp u) lenxo3oytopteai slt0seumiopno4ol n fei s s2ta( p;u4texniiciad a ulumpnt4tlxnxr ia1late n slt truoio3oodol nmfeta(fs2taumo;u1alxo ociytlm2rmuvp t)texrir3iytop ranes t srtrio3ou4olee nvslt srrm(moou0opxn feilsfmDuanvo;()tetrmocia1omD li s;(  2xo(m3io4amtnlfvt t)arra(rpno0tpeomietyt aDelumo (0treoio ootfa elnvs;t srtr(o oy4lmtemfet s) 2uaurpoo0ape mo3tasfm2emn pnu)tlerxfcto1la  aieolt0 rumxo3nudlp e fct t) Dua(m ou4tpeomieiasfm2emnvont4tlerxr3oa1om  aieols0teto(rpnudlp emfes s  Drmuro;t4olxoif3iadfsDea( s;u4trxomfcty1fptrln s;(0t2tmxr3nydom nlfcs t  2umxrpoo0tleoifeiltlmDulnvs u0tetnir3iatlpDrlieslt0seumimpnu4lpe  ictas arrmu  ot1apxn o3iytfa2ran o;t4 exnmo3ia1om r ues t) 2trio ou4om   fcta()srtrxrpno4olt iietltfs uaump t)arxrxr to1op rau ol(0trtm(o oodolt lictls)sDtrur ou0alxnifeiaslsDranvon(4 rxnmf totlpt luvo () 2xo(r3nodame lfciatf Dtr( pou0oltomfctldlmDraumsnt4 etoiocio1om  lnvs;( t2ur(m3iy1ap e iei t sDtmxr no1tleoiicilsla2ul(mpnt4 lermocta1lat  ieils) 2xmim3nu4lpeelnvi s) rtm(r ;t0oltniiciytls umn pnt0 exrmf3oa1fmtranes () exrirpnudalt mivtl()a2tr(mpoo0aptoioctltls2ranmo;t)aexrio tadlm  anvs;( s2xrxo iydlp  lfvias)arumu ooo1olxo i3iyt m2ua(vs t0arxoircoydoptraieo s0 2umir oodll  licslt)aDtru poo1oee mietasls umu on() rtnmr3totfpDraieo;t)setoir3no4ap emnvslt  ruaxmpou1apto fetatls2rluvo t) rxoxfcto1fmte ieils)t2xrxrpoydlpt mnvsls)aDrmx  ot0opxo i3iyslm umn p () renmf3iatlpteauvo;t0sexmxm ou4apt  iciasfs2ra(  ou1aeeo oeiasfmDraumsnt0 ltrmr io1oatr n o;t)srtrxr oy1al n fvt t)aDur(m oo1oeto i3iysfmDea( pnu4altoifciytlaDeanes ()s2uo(mpno1olee fetas)a2rmum ;o0aexnmo3ild mDelums u)aexrif3oodlp e n s () rxmirpoydlmee iciat) Dtmxmont1oetoiieias s2em(ms (4aetrxocoytfp r ies;s0sexrir3oodoptnmnvt () 2raur oo0tpen oeilt a em(mp (0aexomociytlate uvsl()srxmxrpoodamtelfvtasfsDra(  ot0apenifctysfs um(msn(0 ltomo iytfateai o t0truoxr nydalt lfcta()aDtru  no0tpxomfctydfs2emn snt4 reoifctodomtrlu i;s0srxoxo3io4aleemiei ( sDur(m ;o0tlx  oeiasfsDelnvsnu)aexoio3io1lmDr uvolt t2xm(r3nu4lpt mics tf rtax ooo0ope mfcilt m rlnms (4aexoifcoytomD luei;s)trtm(mpny1op nmfcsas sDtaxmo;u0oltnioeiad s2umnvo;t4arxoxrcoodfp   uvo;s  etmir io4al nlnetat)aDra(mo;u0ope mfciytfsDeauvo;t0tetnio iy1om rlu i;t)t2toxm ny1lp e neias)aDuaxr oo1tlx  f3iatlaDrlnmpn(4arxoifcta1fmt  ivi;s)tetmirpoydope lfcs tfa2ur( poo4tpe ioeiys a emnmp;(0teeoxo3io1la eau o s)trxrxm iodamt micsa(farra(  ot0aeen ieiys mDelump;(4tlxnio ootfmDeluvi;t) exrio3ny1olen nvs s  rra(mo;t0aeenmfeiltlmDemu s;(0texoircoytfpte u o;(0 rumim3iodlpte fvil()aDururono4oeenmi3iatfm rl(mont)tetoifcootopDrlneils  rxoxo3iydomtemfvia(f rurxro;t4tetn o3iys sDumuvp u4 leoxf3iytfm  anvs;t)trtm(m io4ll   netlt)sDrax onu0apenmociltla2rlums;t0tlenif oadoa rln i;s)s2urxrpiydalee fvia()srrmx oot0apeoiictls s rmnvp ()trxrmo3io1omDrluvi s0t2umim3oy4lme  nesltfsDrmxrpnt4teeo fciltlsDum(vs (4arerio3oo1lpteliei ()setmxr no4llt  ncsatfarumx  ;t1opeoiieilsfa eln pnu)texnif3iadlm rauei (  2xr(o iy1alee fctas) Duru poo1tetomiciyd s umn o;t4 exomfcoytlat lnvo t)trxmiopoo4al   fvt (  2umur nt1apeomf3iydlsDemu pnu0 eeoif3oo1oatean il()srumxm3iodlmee iesas) rra( p;u0alxn ictytfa rmums;t)alerxfciatoa eau o ()trtr(o oodlle lnet t)s2ta(ro;u4tlt ifciytlsDemuvo (0trerxr3oa1omtr n s ( seuo(r oudlm nmfctasfaDraxrpnu0opxnio3iytlsDemnmo;(0 eermrciytlaDraneilt seuoxr3oo1lmt livsas)srua(rp;o4alt  o3ils s2uanmo () rxoircty1fmt  ueolt  rum(r oodapt lnesas s2tmxmonu0oexn fctydlmDelu snt4 rxrxrciodlatran i;s0 rurim ou1oltnlfetl()sDum(mpno0apx  octltls uaumpnt0aexrmf iy1lp   neslt)t2tr(rpoy4opt  nesatfs2rmu  nt0ale  i3ilt a2ra(vsnt0 eenifctytlmtrli i;(0setrio oydopeemnvs s srurx pot0oltn ietldlaDrm( p ()aexrmo tadfmDr uvsl(0t2xm(opnu1lpe micil( artax pno1optnmo3ildfm uaums t4 lxrmr iy1opt auvsls)seto(r3iodom  mivias sDur(r nt1tpx  ictysfsDul( snt)tlxomocoadlm  livo;( trum(mpiu4lp  lietas)s2tmu  nu1altnmictlsfa ra( pnt) reoif3iytfpDe neslt0s2xo(rpoydaleelfvslt)a2trur ;t4olt mo3tas s2ulu p (4aetoioctadlm
\ No newline at end of file
@@ -0,0 +1 @@
+neo;t)texmxrpoy4lpt mfesa(f 2tmu  oo1ole  ieiat s2rmnmonu4trtrmrciytfaDrlneo;( seur(opou4omtnlfct (faDur(m ;u1opeo o3tldla2ean o;t) rerxfciy1opte neslt)srtr(o3ny4op e fetl(  2ua( pnu1tetn f3iysfm2em(vpnu)artrmf3ia1fp r nes;t0 rtoxo iu4ll   nvsl() rurxr nu1aeto ieiltfa rl(msn() eeomfcoodlpt lnvsls texoxm oodomen ncsas  rta(mo;u4apxnio3tyd s2el( p t)alxnxo ia1lmtr nvi (0 2trxrpiy4lm nmfvtls sDtrx  ;u1tpto o3iadfm2umu s t)tlxnif ty1lpD lneo t0trurxr3iydom nlies t aDua(mo;t0apx moctas m2emu o;u4alxoio3iatfatr ivilt sexrxmpoo4al  mnci t)s2urx  ot0alxnii3iydfsDea( pnt)teermociy1lpteauvo;() 2toir ny1lptnlfeta( s2rmx onu0oexo octltfmDea(vsn() etomo iodoa e neo;t0t2xrim3iudal  mfetas)sruauront0apt mfeiys a2rlumsnu0 eermrcoodop   ivs;t)trxoxo oodolen ics tf rrmx pno4tpenioeiytfs2umn o;() lenxrcoydop eluesl(0t2um(r3oodaptnmnvsls a2ur(mpnt0apxnmo3iatfmDuanms;t4aetnxr3iatomDr uvi ( t2umxr3iu1lmee nvta(fa2rax  nu1oexoif3iad mDuanmpnt0treoxr3oodomDran o;t0t2uoxm iodomeelnvsatfaDtmu p;t0apt ifeiaslsDean s;u)alenmfcio1omtrauvi;s)t2xo(opiodlmeemncia()sDtrurpoo1apto f3iydfm2ul(mo u4 rtnmo oo1omteau o;t)s2xm(o3iudlp e nci tfartaurpou4ole mieiaslm2rmnmo;u) lxoirctodoaDeai i s truoxo3iodapt mfesatfs2ua(roou1apeomfctad m elnvs t0aleniocta1op rau o;(0seurirpio1ape mfvtat)s2rax  no4tlt  o3iyd a umnvpnu0tlxnxfcoodlaDrau sls0s2toxm3oydom e ivt (f Dua(rp;o1olen f3iys a elums u4 eeomo iatlp ranes t)s2xmxm3iydlltnliet tfarra(  ;o1opxoioetas mDel(mp;()tlenxr3oo1fptrlu s (  2xmir oo4amtn nct (fs2tmx pno4oetnifeiyd mDrm(mpn(0 eermocoatoa ranvi s)t2xmxr iudlpe  nvi () 2tau  ou4tpx  o3tyslsDelnmp u0 exrir tatfmDrliei s)tetrxo3ny4lptelfct tf rtrxrp;o0altnio3tasfmDuanmp ()tltnif ty1lmteaues;t0sruoxr oydom   ies ()srrr( onu1aetn o3tatfa um(mp u0 etrmocoadlp eau i;t trtrxm oodlle licil( a2rmxmo;t1oeenif3iyd s2rmnmp;t4texoif3iytlmtr uvo;s trtm(r3ny1apte fcsas) rrmump;u1oexoioeias s eanvont0 ltoxo3ia1lpte neols)s2tr(o3oy4lmt lnesa( aDuaxr ot1texoifeild s ranmp;(0 lenif ty1lm rlues;(0 rtrimpiu1ol   ietls) rrmxm no0olx ioeiyd a ran p (0trtrmf oa1lmDelu sls) 2uriopou1apee netl( srumur oo4teeomfciydfa um( on(4aeerio iytlpt aues t0trxmxr io4opt  nvta(  2rau  no1ole  fctas s2eluvonu)aeeoir iatfa eai s t0trurxm3ou4ol nmictlt arrmxr ;t1opeo iciydfm2elump;u0 eeoxo3iotfp eaivi;()tetrir iy4lm   nes sfs2raumoou1ale ii3ilt sDua(vo;()artrio3oodfptraneilt0setrim3oodop eliesl(  Dtmx poo0olxoiocilslaDrmn p;u) rtrircty1lpD auvils0s2xoxo iydlmte fctl(  rrmur nt0apeomietytlsDeanvs () exrmo3tadlat lneo (0srum(opoudlp  mivi s)arrmuront0oee mfetytfs2elnvon(0 ltrif3iy1lmt aneo t)tetoim iudlptnmnet (farrru oot0tetnioeiltlm2rln on(0alxomr3tadomDranvslt texo(o nu1ale  fctl( aDum(moou4tpx mo3tytfs ua( o (4 lxoxf3oy1omteaueols) rtm(opno4ol emneia(  rtmum ;o0altomi3iatlaDum( s;t)trxrirctodlp rai s;t s2umio3oodlltnlnvtlt s2tmxr ot0apt  fetydlaDrmu s ()trtomf3tydlaDrlu sl(0 etmio3iudom nlfvsa() Dururpno4altnioctlt s umnmpn(0 exnmr3iodlm r ivo;s) rxoimpiu4alenlfvtasf rrrxmonu1oexnmocildls2ea( s;u0texoifctydfpt  n o;s)s2toim nu4omenlnes (  2tmur ;u4opxomoeiys s2emu o;(4aeeoifcta1omt an ilt) rxm(m3oo1apen ict s a2umxr ;t0texo oetydlsDemnvsnu)aeeoxrciadfpDr ieo s0seumim3iodal e nct (  Dtm(m ;t0aetomf3ils mDulu snu0 reoio3iy1fmteln i;t)t2uoxm iodlle  ivsasfaDua(ro;t1apeoifetatfm um(vp;() rxrio3todoaDrlu s;s0tetrxm ny4lme  ivt s)aDtru o;o4tlt  o3tydfs2ranmo;u0arxnxrcio1lptraieolt) exo(m iodlm e fvtl(  rtmxmoou4tpt ifciat a el(mo;t)treomo oytfp ranes s0 exrio3no1amtemnei s srrr(mpou4tltn oetlt m ranmo t)tetnxociatlmtrlneil(  rtmir3oodamen ncs s) 2tauro;t1tetniieiysfsDelums t4 rtomfciotoa e uvsl(  rtrir3nodoltnmnctl( a2tru pnt4olt ifeiadlaDrmuvs;t) rtrmfcoa1faDeau o;()t2ur(m3oodlpt mfeia(  Drmu pno4tlxoif3iysfa2rm(vp u4 exrir3tadfmDraues t0trxmxr3nydoltn fesasf Dua(mpno0apen feiyslm2rlnvo;u)aexnmo3iydfa eauei ()srxrio oo4lpt miesl( srtmum ot4ole if3iysfm em(vo;t) rermfctadlptrlueo t teuo(o iu1am e fet ( sDumx ont4tlt  i3tasfs umums t4texrxf io1oa e u o s t2xm(rpnu1op  lics (  rrmum ;t1aexnmociydlm uluvs t4 lxoir ia1fm elnvo;s0trum(m oydll nmfeia( a2ur(mono0tltoioctat aDranmon()texoir tydlp e nes (0s2xoir nudamt livt t) rrm(rp;u0oex io3iysfs2uan s;t0texnif3iodfa r ueols setrimpio4olenmici t)aDtm(mpnu0aetnmieiydls ulnmpnu4aexnmf ootomD  i ols  2trxo3no1om e nciat)srrauro;u4ale  fciydfsDemumpnt0artnio oa1fpt aues s0trtmio iu4llenmfci sf ruaumpno1aexo feiytfa2rlnmpn(0altrxf tadopDelu i;s)sruo(o oudamenmfcsat  Dtm(mpnu0opxomoeiaslsDeau o;u4tlxnxf iytopt ai ol()srto(r oydapen fvs t) rrm(  ot4oee  i3tytfm rm( o u4 renmf3ootoaDr ivo s) rxmio nu4op n fci t  Dua( onu0tleniocildlaDrlums;u0 rxoxr3ia1opDe ieo;t0tetrxm iu1op nmivilt)aDuru  nt0tleoio3tat a2rlu o;u0 etnxr3iotlp rlieslt0tetrxopoy1am nlfei t) 2rauro;u4texo iciltfs umuvsnu0trxrxr3totfa ranvi;t texoio3iu4llenlncil(faDrm(ronu4tetomoeiatlsDran p u0tltoifcoa1lateaieil(0seurxo3oudlm  lfct tfa2rm(m nt0aleo fciysfs ulnvo t0texomo3tytlp e ivolt  eurim iu1lltnlncsasfa2tm(root4opeomoeiadfm2umnvp u0texnmr3totfaD  neo () 2ur(m iydlm nmfei sf Drru pot0tleoifeiatlmDrmnvo;t0 rtomociy1faDrluvol() eum(o ny4omt miesltfa2rmx pno0olen feiltla elu p t) etoif3ia1optelu s;s0 exmim ny4lpte ivtls  2rrx  ot1tpenifeiydlmDeauvp t4tleoxo oadlmDeaieslt)s2tm(opou1om  lfcilt s2tm( pnt1olxoifciyd m2emuvo;(4tetrmf tatlatrlneo;()trum(rpiodop elnvilt artmuronu0oet io3tldls2rl(mp;t) ltomrcoodoptrau o;s) etm(o3nodapee nvias) 2um(rpnu4aee mieias s2ua(mp;u)trtnxociatlp e n sl()trumxm3oydomte ictlsf 2rrxmpno0opx iiciltlsDrmn pnt0trxoxo3iatlptraneilt  rxrim3io1apenmfvsls)sDtaurooo4aeeoioeiadfmDuanmp t4artrmrcoy1fmtrau o;t)sexrxr3iu4lpt lnvtat)arua(  nu0oeeo i3tytla2el( pnt0altnir oy1opD  nvslt)t2xo(m3iu4lleelfeil()aDrrumo;t0olen iciyt mDrmuvo () lxrxo iatfm  anvolt0 2xr(m3iu4al elfcia()sruru pno1aee moeiydlm ran s u)teerxf3ia1oaD  ieo;s t2xmio oy4lptemnes ()aDrr( o;t1tpto fctltlm2ul(mo (0 reoxfcoy1oaDe uvi ( tetmir iudomtemnctatfsDuaum no0tlx  iciatfa ranmp;()alxnmf iy1la elu o;s)s2xmir nudaptnlfvtls) 2trumpnu0tlxniietat aDeanvsnt)aeeoiocio1oaDrau o ()setrxmpno4lmeemfcs (  rtmu p;o0tpxn ieiydla2rlumo u0texomo oytlmDeaiei s)teuoxopnydopte fcsat)srtrurp;u4opx io3iydfa uanvs;u0 rxoirciodoa  lueils  rtmxo3nodamee ivias) Dtru o;u4ape ioetat mDrluvp;t0altoir3oytlatr uvo ( trtoxr3nudol   nvta() Dtrxronu1oleoii3iatfs eln p t4 lenmrcoo1lp rli o ()sexrxm nu4al nmiviasfsDuaumonu4altnio3iytfmDrm( sn(4tltnmf iydop  ln s;t0setmxm3oy1optnmict t  Drm(ro;u1tlxomfcilt s2um(von() leoio tydfaD ai ils0srxo(mpno4omtnlivta( s2tm(r ;u1tlt io3tadfaDrm(mon(4 lxrxr3iadlatraieo (  2trxm ny4lmte fvtlsfa2trxroou1texoio3iydls elu p t4 rxoxo oytfptr nei t t2tm(o iy1lmenlnvtl()sDtrxrp;o4optn ociltla2ea( ont)arermr3iotomDelnei s)t2xr(r3oo1am emnvia() ruaxroou0opx mictlsfmDea( snt0trerxo3oydlaDeanvs t0s2xmio3iy4lpe mivslt srraxmo;o0alxnif3iat m2eau pnu)aexrio3oatopD au s t)sexo(mpou1ome  ivtasfarrrx  ou0opeo fctltla el(ms;u)arxnifciy1la eanesl(0 rurxo iy1op e fcs t)s2ur(rpnt4texn o3iytfaDrln on() ltomr3iadfp eluvo;s)truoir oo4lmt lnctls aruaumpou4alxn fciytfsDrmnvpn(0aexrmo3oatfm r nvi (0t2xmxr iydlpeemivs s  Drauro;t0aptoio3tad s2elums ()tlxoif3iadopteaues;t0srxm(opoydaptemnctat  Draxrooo0olx ii3tys m2rln p ()altrxo iytla eln ols0 exrxm3iy1lltnmncs t sDrmxr nu0aexnmocils mDeluvs u4 lxomfcoo1oa  aivils s2xrxr3nu1ol nmivs (fsDua(mp;t1oex mictldfaDraums t4tlxoioctatfatrlies (  rtmim3io4om  lnciat) rrrxro;o4oeeoio3iltla2um( snu4alxomfciodlaDeauvsl()s2xm(m3iodapenlfcta( srurxm ;o1tle  f3iadlaDel(mpn()tlenmr oodomt  u olt0setmio3nu4ol elics ( a2ra(m oo0ope iieias a2rmnvo u4trxnir3tytfm  au o s0s2xo(r nu1lltnlnvsat  Dtruro;u0aptoifciytfs2rln o ()aeermociotlpD liei t0 eurxr oodame lfesls)s2uru oou0tpx  ocilslm em(vp;t0trerif iatomD  ivo ( t2xmxo3oy1llt  ivt s) rtax poo1tpxniictyt m rl(vs;u0tetnif3iadom   neo t)srtmxr oydlmte ieiat)srrmumpot4tpe ifeiat a2umuvpnt4tleoxoctodlp rluvi t)truoxm ny1al emncilt)sDrr(r no0aeto f3iys m ul( pnt4tetomfctytlpte ivilt) etm(opoo4omee icils  2umx  ot1altoif3iysfs2uau o t0artriociatlaDrln olt0 2xr(opoo1omtn nci s)a2trur ;u1tee ifcildfaDrmnvo () leoxrcootlat luvolt)srxrir oy1olt  icia( a2urxmo;t4oex moetaslm2rluvpnt0 leomo ootla r n s s)setoirpno1alee nct ()arrm(mono1ole mi3iydlm2eau o;u)tetnxf oadfmteanvo;()sexrim3iy1opeelnci s)arrrxrp;u1apt iieiysls rlnvp;u)aexnmr3tadlptran i t0 2urxmpnudape lictas)sDtm(rpnt0alxnmiciasla rl( p;t4 exnxfcia1oaDrlu ols  eumxr oo1lmeemneias) 2rr(rooo1tptn iciysfsDeaumpnu) rxrxrcoa1oaD aies ()s2umim3no4amenmfvsls) 2ta(r no4oeeo o3iad a rl(vo;()tlxoxf iy1fpDeauvsls)tetrim3iu4optelnvsl(fa2tr(m oo1aleo oeiltfsDemnmo;t0arxnxf ta1fat aiei s) rum(r nu4lp nmfcias a2umxmo;o4optoii3ilsla2ulu p;t0alxoxfcoadlaD aivo;s trxoxo oo4omtnmici tf 2rru o;u1olxoiociadlm2emuvpn(0 exomf oytoa rlu o s)srtr(o iudapeelfeslsfsDta(mont1oex io3ild mDrl(ms;u0tetoifctodomDe u i s texrxr3oodlp nmfcsl(farum(ront4tpx iocilsfa2ran s (0tetrxf3ia1lm  li slt srxoxr3iodomeelfcsa(fsDraxroou1aleo i3iltlsDemnmpnu4aeenmfcoytfat  uei s  exrim oy1opte icsas)s2tm(r no0opxo f3ildfs2emums;t)trtriocto1oaD aiei;t)srxmiopoodlp elivsa( s2urx pno1aeeomietysls2umn p;u4 lxnxr iodomD  nei s srxm(m3ou1lptnmieta()aDraxm ot0alt  oeils m2rmnvp ()artrxo3totlp rau i s s2xmimpiy1ame  fvsltfsDur(moou0tpxnmoetldlm2ranvs u4teenxrciatoa   ivo;( sruoir3iy4llenliviatfsrua(  ;u4tlx mietys m uauvo t) rtrxr tydfm  au ils  ruoxmpoy4opt lnvils)s2urx pno0olt mfetas s um(vo u)trxrmo3oydlmt au sls0 rtrim oo1al   net tfsrrau ono0optomietytla2rmumo;t4 rtrmf iytla rlu o;s0trtrxm ny1am n icilt srtrxm ;u1openmociad m2rluvp (4tlxrxo oydfpt lueo ( sexo(o3iydaptnmicia(f ruau  ;t4tlt ioeilsfa uanmonu4teerir3ootla rauvs t s2trio nu4aptnlicsls)s2rr( p;o4alxomi3tytlm emuvonu)trtnxr3oodop r u ols0 euoir3no1aleelict t)sDrmurpou1tlxn oeiltls ea(vp (4 rxomo3io1omt aivsl(  rurimpnu4am nmiesas)arrm(ro;t4tetoiieias mDrmuvs u4arerxf ty1lm rlnvol( t2uo(rpny1omtelivs t)aDtau  ;u1oexoioeiasfaDul(vs () rxrifcoo1fmt aies s) ruoimpny4lme mnesa( a2rmxmp;u1aexomfcilslm ea( pnu4tlxrirctadfpDr nei () 2xrxrpiodolenlfvs ( s2rmu  ou4oltn oeiat s2umn s;() ltnxo ty1om raneils0tetmxopnu1al   icta( sDurxmpnt0oeeoiieiytla2emu onu)trerxf3oo1faDe nvolt texo(o ny4oltnlivias)sDtr( ont0tpt iieiytfs2rmnvont) rerxfcoytopDeaivi;s0srxoxopnudop n ivt s) rtrurpou4teen f3tyt s2el(vs u) reoxo iydlmD livi s)teum(r nu4am n ncsatfs2urxrpno4tlxo fctas m elu s;t)artnmf tytlm   neols) 2to(m ou4op   nct s sDta( pou4oeenmi3iasfa2rauvp;t)tltoxf3iodlpDelueilt) rxm(r ny1lmtn ivtatf 2urur ot0aexoiictyd mDran pnt0 etomo oo1fpDranvo;(  2xrxo3io1lp emicsatfsDtmuro;o4aptnmfctadfaDrlnmpn(0 etomoctodfaD  ivs;s0truoio oydlpeelici t)sDtaur ;o1aeenifetad sDumnvpn(4alenir totlp rai o (0 ruo(rpiy1amtnlieta()sDtmump;t4tptnio3ias aDean snu0 eeoxfcoy1latrauvi t0 exmxr nu4ol  lfetat s2rmx oot4oexnmi3iyt sDem(von(4 ltomoctytlaDe nvo t t2xoxm nudaptn ivsl()srrmxm nt1alx mi3iyslaDel(mp t0altoxo totfmt  u i () 2um(opoy1om eliesat  2rr(mpnt0alx if3ilslm eluvp;u0 etoxfciytfatean s (  euoir ou1am   iesl(  2umxmpno0tlx mietld a2rl(vo t4 rtnxf tatoa eau ol(0t2xrim3oydomen ivsat  2rrumpnt0teenmo3iydls2rl( p u4alenxr to1fpDeai s;s)t2umxo nydaptnlnvtl()sDraurp;u4tee  octytfsDelumsnu0 etrmo oytlpDrln i (0 rtr(mpou1optnlfeiatfa2raxmpou4teeo o3iydla2elu o;u)trxnxo ia1lm e n sls trxr(r3no1apt lfvi (  2rr( pnt1teeomfetldfm2ra(vp t0tleoif iy1fp elnei;(  rto(rpnu4olenlnci s s2tm(r nt0oeeoio3tadfa rmuvonu) leoxo3oydlpD  n il(  rtoxm3oy1opeemnvils a2umu ooo4aetniociytlm rmn s;u)aexnxo3ootomt  u i t t2uo(o nu1ol nlivs t aDtrxr no4opx  f3iysls2um(ms t0artrxrcia1omteaneil(  rxriopio4ap  lnvsa( arrru pou0teenioctadla2emu o;t4trxrifcto1oat livi (0 2xrxm iy1aleelfeiltf rtmu p;o0aetnmoctatls2umn snt4trtrxr io1fm r i o;s0 exrxo iu1op  lfcslt a2uaur oo1oetoiociys m2umnvo t) eeoir todla  auvs s s2xoio3iu4am nlivsa()a2uaxronu4oet ifciatfs2ua( snu0alermf ootomt lu sls0sruoir3oudlle mfvi sfsDuau pno0oex ioeilslm umu onu) etrmoctydfptelies ()s2urxmpnudlme lnet (  2rrx p;t1alxn f3tydla2emn o;() rerxr3iatfpD aieslt0 eurimpiy4amee nvs ( srtmxmo;u1aptoifetad a uan o t)teenxfcoydoat ln slt t2xr(m no1omtnmfviat)sDtmurpnu4aeenif3iasfm2umuvs;t)aeeomr tydfmt  u s s) 2um(o oo1olen iei t) rrr(  ;u4alxn fciasfm el( onu0 rtrifciydfa rlivsl( trtmio nu1ape lnctltfsrtrx  nu1tetnifetltlm el( o;()arenif3iatfmtelnvo s)teumxo3iu4aptn nct sf 2ra(r ou0olxomo3tydlaDrl( pnu)arxrmf3oytfpte uesls0s2to(m io1op  lici (  2tauro;t4tlxn o3iatls ulu o (0arxnmf3to1faDr n ols  rxr(o io4amenmfvia(fartrxrpou4tpe  feilsfa elnvs u0tetoio3ia1laDe nvols)t2umirpiudam   fvil()arrmxmpnt0tlxnmieiatfm umn pnt0aexoxrcto1omDr n s t texr(o3oudopee iet () rumu  oo0tltomf3iytfsDemnmpn()trtomr iodfmtr neolt s2xoxr ny4lp  lfct (fsDrm(m nt1tpt mi3tytfa2rau o t)tltoio oytlptraivs;()setoxo3ou4aptemict ( aDtax oot4oetomi3tld mDrmuvp u4arerio3ty1op raivo;( sexoxr nodome lnct sf rtruro;o4altn oeilslmDrmnms;()altrmo3ta1optr ueo s0sruoxr3nu1lp e ncia(  ruax poo0altomoetldlsDuanvs (0aexnxoctydlpDeanvo;t0 exr(mpiy4ome lfcsatf 2umu oot1alt  o3tltla umn snu)tlxrxo oydfaDr n i;t0 rtoxo3ou4ol n icsltfsDtaurono0apto fciyt mDrm(msn(4tetnmf totlp rlneolt)seto(opnu1ll e fesas)a2tr(ro;t4tetn oeiyslmDeauvo;u4trxnxf todom r nes;s s2toxmpny1oltnlneiat)aDumx  ;t4alxn ociatfaDelu on() eeoif3ia1lmtraiei s truo(m nydopte netlt srtmurono0oleomfeiatfs umums (0 lenxo totoaDe ivols0teur(r oo4lpt lics ( aDumxr ou4oetoio3ilslaDrluvo;(4alenif3ty1fate uvs t0srxmim oudapte ictlt) rumumono4oeto oeiysla2ranvp;u)arenxo3oo1fmD an sls  rurio3nu1alte fviatfsrrmu  ;u1ope iieiysfm2eaums;t4 etnmr3ty1oaDeai ol( trxm(m3oy4al elicsl()sDtaxm ;u0tlx mfcildfs2rlnvs;t)trerif io1lmt ai ol(  2trim3oodap emncsa( artrumpot1olxnmi3tltlmDra(von(4artoio3ta1omD  uvil(  rxmim iy4llte ieslsf rrax pot0apxnioetadlmDuauvpnu0aetoxfcoodomDeanvo s0tetrio3no1lmtemfcsa(  2rm(  ou0tle ioeiyd s um(vs t4teeoifctatomDrliei (0 rxr(o nu4aptemfvs ( aDtru  ot4olxn ieiltfm raums t0trxnxf iadoateliei s srxriopoodame  neils)arur(mpnt4alxoioetys mDra(vpnu)trtrif iadomD  uvo;s)srxo(m3nydoptn fvs s s2rmur oo0aeeomoetyslm2umnmo;u)altrircoy1oaDrlnvs s s2umim3oo1op nmictas arrmu  nt1tee mi3iydlsDrln p u4tleoio oy1fp eanesl( teumxopou1ome  ieils)aDurump;u4oltn feilsfaDemnvsn(4trxoir oo1opDe nes;(0trxm(o oo4apt mncils  rrmumono1tlt ii3tasfm rln o u0arenmr3oo1lmteaivi;(  rxm(o3nodlm   ivtas a2rr(m ot0aptomf3tat s2rm( pnt) ltrxfcty1laD ai i;t trxm(rpou4lp elics s aDumxro;u1tltnmocildls2ulnmpnt0 ltoirctatopD  ueols)setr(opnu4lpe lfcta( sDtmxm no0aexnio3iyd mDra( pn(4 rtomrcio1laDe i i (0 exmxrpiu1apee fvsl( arumx o;o1ale  o3tls m2eauvpnt0 rermo3tytop   u il(0 euo(opnu4llenmicsls)arua(  oo1aex mfctatlm ul(vsnt0tltomr3todlatr i i (0trxo(rpiy4olen fcslsfa2tmxm nt4oeenifeiytfs2umn snu)altrio3iadfmtrlies;( sexrio ou1altelneslt  2tmumpot1aet mf3ild aDel(mpn(0trenmr3oy1laD  n slt) euoiopio4ol n net sfarum(m ;t1aexoiicild m2uau s;u4tlerxocootlat  ueo;t setr(opiydamtelfviat)a2trxrpoo0tleomf3ilt a2ul(von(4tlxnxf3iatopDelieo t) euoio3io4apt  ncils)srtaxm ;u4tle  o3tydfmDrm(mp;t0aeenmr3iadfmDeluvo s0 etrxm nodlpee fvsl()sDtr(ro;u0tle moctydfa2rln snu0 ltnmoctodomteaivolt0trxrio nodlltelfvsasfs2tmxmp;o4tet mfcilsfa2emn s u0aeermo3oytlp rlu i;t  etoimpoy4lpt lncilsfa2tmx o;u1alx  o3ilsla uluvo (4aexoio iadlpte uvs;( s2toxo3ny4ol elnvt s artmum nt4apxnii3iydlsDel( o;t)areomrcoo1fateaivo (0tetrxr3nydamen fci s  Duax ono4ape if3tad aDelnvo;(0aeeoxr3tydoat  ieslt) rxr(m3ny4aptnlfci tf Draum ;o4aptnmo3iadls2uaumonu0 renmf iatfp eln s;(  rxrio3oydopenlnvt () Dum(r ot0aexo fciytla rauvo t4teeomf3tatfm   uvo ( sexm(o3io1amenlfcs sf ruaur nt0optoif3iytfsDelu o;t)aleomo3oy1lat anei;s seurxm nudlme  fvt (  rumx pnt1alx  ieiaslm2em(msnu)aleoxo oytopt lneol(  etrxm3oo4lme  fetasfs2tr(rpoo0tpe mfetys mDeau snt) rtnxrcootlp r n olt0 eumxo no1lptnmfvtls)artru  oo1olxnmfctadfaDemnvsnt4 etoxf iatfat lu sls)srtm(m3oudlle  ictlsf Dumump;t1tpenmfeiadfs ulu s;u0alxrio oadom rlu i;(0s2urxo3iu4ale mivt s arrmur ou1oet mf3iyd mDum(vsn(4trxnirciytfa  li s;s  rtr(o3nu4op n feiat srtrxr nt0oeeo ociyt a ua(mp t)trxoxf ta1faDeluvs () rto(opiy1amt mnvi (fsrtm( onu0tptoii3iyd s umuvs;u0 ltrif3oadlmDeluvi;(  2tr(opoy4ll   fcslt)s2tmurpoo0tptnmoeiyt aDelumo u0altrxfcoy1fmD ai o;(0 exmxo3oo1ol nmfvi s) Durxront4optoii3iltfm rluvsn()tlxnxr3tytomDeaneslt) 2uo(mpou4lleelietl( sDrax ono4oet if3tydfaDeaumo;u)aetomo3iodfptrluvo;s)srxmxo oydom  mici s) rtrx pot1oex mfetas sDrmnmpnt4 lxrmo3ootlmD  nvs;s0s2uoio oudole lnvi t  rururpou1olxnmfciasfm2emu p;(0 etnir ty1fpDr uvols sexmim ou4alt mfctls aDtmurp;o1tpe mfetld m2uauvp t0altoxfctodomDr nei t0 rto(r3nudope mnvtatfa2umu o;u1olt if3iadfs emn o;u)teeomf ootlptr ieolt srum(rpnudapt lncsl( sruax o;u0tltnmocils s eluvs t)texrxo3todoat livo;s  rtoxm3nu4ameemfcs tf rta( p;o4olt miciadfm eanvsnu0tetrifctydlm  luvs;() 2umxr3iu1am e fctatfsrurxrpno1tltn ieias s umuvs;() eermocta1lm rlivo (  etoxr no1al e ivi ()a2rmxmooo0oee ioeils a2ra( s (0tltrmf iotom elivslt)seumiopiy1llen feilt sDtmxm ;u1oltomf3iytlaDemump;(0tltrxociy1lm e neolt0 rtrxo3oudllt mfei t)s2urxmo;u4tpxomoeild m ulu o;(4tetoif iydfpDeauvi;( s2to(opoudoleelfvi s) 2tmxmooo0tpxnifctatfaDumnvo (4 exnirctodomt  ieslt t2um(rpnudlptnlfvs (fsrumu pnu1tptn o3iyd a eanvs;u)arerirctytfaDeanei ( t2xm(mpnu4lmen icsls s2rrx pnt1tpx ioeiyslm2rmnvp;u0aeeomr oa1lm e ueo ( trtoxo3io1lmt  nctlt sDtmx oou1aexomf3iysls em(ms;(4texrmr3oa1lmtrai s ()teum(m3oydllen ict ( arrrxrpnt4tptoioctatfsDeanvonu4arerxr tadlateluvi;s)s2trimpiy4omee neiat  2trx pnt1tpxo oetydls2el(vp;u)alerif3to1fmtelieo;s trxmxm3oo4ope lfctl() 2trxmoot1apen fetas m2ea( snt4arermf3tydlp e neils trtoirpnodamee fct t srum(r no4tpx  icilsla rlnmp;t)arerxrciodlmD aues;s0teumxo3iu4ale mfvtl()s2rm(r nu4tlx mi3iydfm2ul( p;t) lxnmf3iy1lmD an i t srxmim3ou1amtn iet ( arta( ooo4olxniiciyd aDrlnvp u4 lxnmocoa1omDr nvs;t)t2xoxm nodllen fvtltfa2umx pou1ope mf3iatfs2rmn s;t0altniociotfp e ues s sruo(opnu1lp nmnet tfs2ururp;u1tpto i3tldfa2uau o u4arxrxo3iydlpteaivils) etrir io4lm nmncta()sDtax ont0tlt io3iad a uau o;(0 rtnmo oa1lptrauvil(0teuoxopiodol e nvils)a2taxm nt0oet  ociadfsDrmuvs t4 lerifcoatlm   i ol(0 2ur(m3iy1al  livils sDta(mo;u1tpxn feiad a emnmo t0aetrmf3ootfatr n olt0 rxrxm3ny1omtn icsa(fsDuaum ;u4oeen icias s uln p t)tltoio3iatfptrlivslt0seum(m3iodalen fvslsfsDtau p;t4apxomoetydfaDelumonu)aeenmrciytla  livi s)tetoir oydom elnctls sDurur ;o4aeeomicild s emnvp t4 exoif3ootoa   n ilt trumimpiy1oltemnvilt)aDurur ;o4texnifctydfm umnmp;t) renxfciy1omDr ivols)trxoimpnydll elieslt)s2ra( p;t1ole  ieiyt m2ra( pnu)arenmr iytfaDr u s;( teuoio io1ll elieiltf rua(ro;t4tpxo o3tyslaDua(vs (4tetrxr3tytlpteanvilt0 eur(r oydam nmfei (fsrrmxroot1tlt ioetyd a2emumsnt4tltnif3tytfmD aivilt0trtrio3no4ol nmnvia( a2tr(  ;o4tlx io3iltla2ul( pn(4texnmr tatopt aneils  2tmim oo4om  lfctl(f Drrxrp;t1ape  oeilsfsDrmnvs;t0tetoifcoadlaDr ivs s)sruoir iodllen fvil( aDtm(r ;u0tlt mfeilsla emnmpn(0 rtnmr ta1fa  lneilt)sexm(o3oydlltelnciltfa2uaxmoot1teen i3tadfs2rmu pn(4aetnio3todlp rliei;t)seurxo oy1lpen fctl(fa2tr( ono1aeeoifctat m rlnmpnu0 rtrxociytfa rluvo t0 ruo(opou4lpt lfes sf Duaur no1tpxnif3ilslaDrlumo t0aeeoifciotfptelueo s)teurirpoodopt  fvi s aDrmxmpnt4oex ii3tysls elumo;()arxnmr iy1fa  li ols  2xrimpoodlpt  feil(faDtru  ou0ape  ociatfmDemuvp (0tltnif oadlateaueo t t2urxo oodam elfvsls sDum(r ;o4tet mf3iydlsDrmn s ()aexrir iytomD  nvs s0setrxo no1ap  lictls  2tax  ;t0tpe  feiasfaDem(vs;t4 exrmf3tydoate nei s)srtm(mpiy4al nlicia( a2rrum nt0apt iocias s2ea(ms t0 rxrir tydfmDr ivi;(0s2urxo3ou1lme lfct ()s2urumonu1tle ioeiat m ua( p;t)trtnir3oy1oaD livol()srtm(o3iodop n ivil(fs2rm(moou1tleomf3iatfsDrmuvpnu0 etriocoo1op e i ils)sexoir3nu4om   nvs t) Dua(rooo4aex iocilsla2rl( p u4 rxomrcoy1lmD livsls0 2toimpoudolen ieilsfsDtmxrpot0opxo o3tadfsDea(mo t0tetnifcoy1oat li olt)srxmim iy4op e fvsas) 2uaur ;o0tleo oeilt s2eaums t0tlermrciadfat  nvi;(0 etoir no1lpe mfci tfaDtr(moot0aetn i3tlsfsDumu o t)altnir3oy1fm rlnes;s) exoxr3oudllt mfesa(f Duru  nt4ale mf3tat s raumo ()teeomr oatfmtran o;s)sexrxrpoudal  lietlt artax ont1aleomo3ilslmDrl(vo;(4tltoir3todlatr i i (0trxoimpnu4lpe  fcta()a2umu  nt1aet  icias a2ulnmp t0 rxoxo3oy1oaD livi t)truo(r3iy1alt lfvslsfsrtr( ono0alx  fcilsfmDeln s;()arxrifciatoat aueil( seuo(o3iy1om  lncsl(f Drr(r no4tlx io3iatlaDrau p ()teeoir tadlmtrlu i t t2xoim3iy4lm emieslsfarraxm ot1optnmieiatfa2uanvs;(0tltrmociytlat lneo;()t2umir nudlpeemneslt)srtaurp;t4tltniietatfmDran p;u4areoir tydlmDr uvo;t0s2toxopoydlptnlfvt ( s2urumpnt4tpt iieils mDul(vs;t4arerxfcoy1omDr ueo;( seum(m3iu4omtn fvt t) Drrxm ;t0ope  o3iysls2rl(vp;()tetoxr iatop eln s (0 exoio3oo1omtemfeilt arum( pot4opxoifeiadlmDumn snt)aetnio oydlmDr i il()trumio3nydlm  lnesltfaDtrxm ;u4aeenii3tlt m eanvpnu0artnio3ootfpDelieo;t trxoio3iodapeemnetltfsrurx pot1opxnmiciytlsDem(mpn()altrxr3io1lm eaues;t) exrxr nudameemieia( sDra(mont1texnioeilsls ulumo t4arxoxr3iydopDrlnvslt  euoir ny4ll n ncil( srta( pnt0oeenmfciytlaDra( snu4 eeniociodopDrluei;t tetriopou1llt mfcils  2rrumoou0apxo o3ils m2el( snt0tlenmf3tydoatr uei t t2uoim3iy4aptnmnvs t  Dta(m ;t1opto oetydfs2ra( p;t4 ltrmf3tatoat anes;t)truo(rpiy4olenmfcsatfsDtmuro;o4tpx io3tlt m2rluvo;u4arxniocty1fpteau i (0s2xm
\ No newline at end of file
@@ -0,0 +1 @@
+i s s) etr(r3iodalt  fctatf 2rau o;o1texniiciytlm ea(ms;t)tlxrir totoat aues;t srtoxo3oydol emnesas)arur(m ;t1aptnmfcildla2um( p;(0aexnifcoydlpt anvo t0teumxo3iydlmte ncslt  2ur(  nt1apeo oetydla2ean o;(4tlxoxfcto1lmDrln sls) rtrim nu4ol  lfes s aruaum oo0oet  o3tls s2em(vs (0 reoxocoo1lptrlivi;t0trtoio3iu1lptemnctls srtm(rpou0opeoioctlt m ua(mp t) lenmr3iodopt lnvi ( s2xm(m nu1ap  mfetlsf rtau p;u0optnmictadla um(vpnu0aleomf3tatfa rlivs t)srum(o3ou1ameelfesl( s2rr(mp;o0tleoiiciltls2ul( ont0trxoxfctydfptrluvs t)truoir iy1opeelneilt srraumpou4opt mo3ias a ea(ms (0aleoxrciatlpt lnvo ( t2to(mpny1altelnetasfs2rruront0oexnifetadlm rl(vsnu0 ltoxr3totomtranvi (0srtoxm oo4om nlfcsas) Dtmu pnt4optnmfciltla2ulu s t)teerir3oadfm eanvi ( srxm(mpiydalt lieils s2rr( pno1apx mieild mDeaumo t0 ltomrcoytoa ranvo;( t2xoxo3nodlleemnvias)sDrmu o;u1apt iociltlm2ra(mo u0arxoxr3iydomDr uvsl( seumxopiy1alenmncia( s2rrxr nt0opxnio3iaslm2em(mon(4 rtnmrciatfate i i;s teur(o iy4lle mfvsltfs2um(rpnt1olt iietas sDrm( o t)tlerxr3totla eaueo;s srxriopiy4ll  lncils  rtr(  no4tle mieiatls2rl( on(0arxriocootopteluvilt0sexoxo iydlme mietlsfs2rmx pnt4apto o3iydfs2rmnmp ()tltnirctadfa  ai i;t)tetmxr3iy4lpeemici t  Dtmxm ot1optomfciysfm ul(vsnt4tltnmfciatomDe i i;t0truoiopiy4oltnmies s)srtaumpnt4tlxnmi3tys m2eau on(4tltnxo oy1fa rlnvi s sruoiopio1amtn fvs (f 2rmu  ;u4aeeoio3iltfs el(ms (0trtrif3to1om eaieo ( sruoxr no4amt licsa(fs2rax oot4olx  fetldfs2ea(mon(0 rxrmfctytlm r nvs t) 2umxm oy1ap  micsatfartmurp;u0aex mi3tls m2em(vo u)tetoxfcoadfm elu o s0seur(opiudlp   fvta( arurumo;u4opto oeilt sDuanms;() lenmocoo1laDr ieo s)t2xm(r oo1omtemneiat)srumumont1oetnmoeiasfaDea( ont4tetoir iotomteluvilt srurxmpiu4opt lfci sfsDumurpoo1oexomieiytfa ua(mo t4arxoxo3tatfm eaneo t0setoxm3nudope  nvt s)srtaur nt1ope mfctaslsDeln o;t0trtrxf iy1fmDeaueo;( sruoxm3no4ll nliesl(faDrmu  ;u0oet  o3iydfs2rlnvo (0 exnmocty1fa  luvolt)seumxo oudlpen ics s  rta(monu0alx mfeiydfs emnmp;t)trxoio oo1oateli i t  rtrxm oo1aleemnet (f Drru  ot4alto f3ildla2rlnmo;t0 ltrxf iy1fmDranvi;s0trurir3oy1lmtnlncilt aDuaxront1tltoii3iatlm uanvpnt4areriocto1lpDe neils  etrxo iu4lp elnvsl(f 2taxroot4opto i3tat s2eln s;u0tlxrxr3iotfptraieolt0 etrxo3nydlm e fet s srrmxront4tlxn o3iydls2rlnvont)alxoiociydfp   uvols)trtrirpoy4aptn nvsa()sDurx onu0oee  ictadfs ua( onu4tltnmr3iytlmt  u sl( sexmxopnu4op emivtl( a2urxro;o0oltn ociydls2rm(vsn()aexrmo ia1lpt lues t  rur(opoydol  mncsa()a2tr(mont0tex mi3tytlsDeanmp t)artomocoodlp r uvo;s s2xrxo oy1ame  nvi ()a2rmxmpnu4optoiictyt a2emnmp t4 reoxrciydfmtrluesls)tetoir3ou4ll  miesas)arta(rpno0tpeoio3tat mDuan pn(0tlermr3oatlmDe uvo s s2trxr ny1lm n iesas) Dra(roou4aee  f3iad mDem(von(0trxrmf iydfpDe nvil(0 2xmxo3iudaptemies ()aDumxmp;o0aex ifcilslmDuan o t0 lenir ia1fptraivo;()s2xo(m nudom e ivtl(fsrumxm ;t0alenioctad sDea(vo;(0alxnir oy1fpDelies s) 2uoir iy4apen ivt (fs2tax  nu1tpxoifeiadfm2umuvon(4 etrmocto1fm rlu s;()tetoiopno4amenmfvsatf Dtaum nu0tpx  ociaslm2elnmp;(0 lenmf todfaD  neo;s0sexoio3iy1al  mncilt) rumx p;o1apeniociatfa emnvonu4tetomfcta1op  ai ils0 rumxrpiy1al eliesas) 2umx  oo0tpe iieiltla em(mpnu)trxnircoo1fa ranvi t)trtm(opio1lmeelfes sf Drmxmpno0aexnifcildlm uanms;u0texnif tytfmte u o s)texmim oy4lltnlivt s  2raum nu0oexnmietls s ulnvonu) eenmo3iatfptraivi (0srxo(o3nodlpeeliet ( s2ta(rooo0texn i3ildfmDemumont)tltoircoo1fmDe i olt0 2um(rpoudom n icia(fsruaxrooo0aetoifciadfsDeanmsnu4 etnirctadlmt  neo s setoxr3iu4ol emivi s)sDtr(ro;u0oeto ieiys sDrmu p t) lxnmo iadoptrli s s0s2toxo iodapeemfcia()arrrxr ;o1apx  ieilt s emumont)altoiociy1oa r n olt  ruo(m oo4ole lneils) Dtax ono4apx  fetys mDelnvon(4arenir iatlaD  nes;t s2xrxrpou1oltnmicslt) rum(  nu0tpxo ieildfmDumu p (4 etomf3io1oatelneils trxmio iy1ale lics ()a2raumpnt4tex moctatfaDelu snu0tlermr ta1om  ai s;(0srtrxm3nu4lmenlfcias)s2raxr ot4tlxo oeiydfm ulu o t0teeomrciytoaDeanvil(0trtmim no1lp  lnvt () Duaur nu0aleoif3tasfmDum( o;(0 lxnxr iotfat aies s s2xrirpnodlpte nci ( s2raxrpou4tleomfetldla2uanvpn(4alxrxr3io1lpDranvi;s s2xr(r3iudolee fvtls)sDrmumpot4tltomi3iatlm2rm(mp () rxnir3totlpD  ues s) eto(rpiudlmee fcias  Drmx o;o4oex iieiad a2umump;t0 eerxo3totomt li ol(0trxrxrpiu4lmen net (farrmurpoo4opt mi3ias mDua(msn()teeomfctydlpD aiei (0 2xoxo iudale mnesas a2raxr nu0apx mieiadfs2rln o;u4aexoxfcia1fpD aieo t0sexoxm3oydomeemicsl( s2rrxmp;t1alxnmfciysfs rmums;(0tltnif ootfpD ai o;t texm(m ou1lp nlictatfarum(  no4opeomoeildfmDem(vs t4 etoxf iy1fpt lnvs s0t2uoxo oy4lp  mnvsls)sDtm(rpnu1teeo icilt s ua( p (0trtnmf3tadlmte ues;s seurim oo4op n nesl()s2raurp;o0oetomieiyd mDulu p;t0artrir oadlmDr uesls  2xr(opny4ol emncsatf 2tmxront1olxn o3tlsfa uau o;(4alxoif tytfpt ai ils0tetrio3oo1ll  mfct ()aDumx  oo0tetomf3iltls elnvo;(4tltomfcoy1fmDelnvils  rtoxo nudlp emnvia()aDrm(  oo1opt mfetydfsDrl(ms;u)tltnir iadfmte n i;t srxoir3ou4lltnlfes () rum(mpnt4alenii3tyd a2eaums;u)aeenxf3iatlaDrluvslt  rtoxmpiy1alt  fcil(  rua(mpnt1alenii3iadfa ra(vs;t)alenir iatfmtean o (0t2trxr nydol nlnvt t  rtmxmp;o0tleomfciydlmDrln snu)aeerircoytopDrlnvolt)t2trxm3io1om  lfvta(fs2um(m ;u0oeto feildfs2ua(mp u)texoxocoa1op ean o;( trum(o3nydop nlivs (fs2rmumooo4tex  iciadfmDumuvonu)aexrmfcoadla eanvs;t t2tr(opoy1ol   netatf rtrx  nt0tpxnif3iys aDean p;u4tlxnmfcty1lptrli o;( s2umxm3iydlpe mics (fsrraump;t1oee io3tldfs2el( s t4aeeoio3ty1fpDrlnvol(0 rxo(r io4ap  lfet s) Duaxronu1tleomiciad a2emu o t4teenmo tydoaD aneo t0 2trxopiu4amenmies t  Drru  oo0oexn ictlsfaDemnvo (0 lxomf oydomD anei t)sexm(opou4lmtn ieils  rtau  nt4apxo oetld mDrmuvsn(0 leoxrciatoatr neols0 ruoirpnudom emivs ()sruru o;o0alt  oeiatfs ea(vs (4 rtrio3tydfatran olt s2trirpno4lm  mict (  rrrxr oo4opxn i3tatfa2ra( o t4 rtrifciatla eai i;t0 rum(opou4lmeemfeil(  rtrurono0teeoiocildfm rauvonu4tlenxo3ootfateaies s  rtmxr ou4oltn ivtatfsDrrx pot0opxnmi3iltfa2rlump;()tlxrxr tadlpteauvi t0srxmxrpnydole lfcs s  rraxrpoo4alxnmieildfa em( p (0tlenif ootfaD livo t  rxmxo3iy1altn netas)sDtmxr oo1oee  oetadfm ranmo;t4arenio tadfmDe uvi;()t2xm(m3iy4olte ncil(f 2uaxmo;u1apxn ictlsfa ul( snt) eenmrciadomt ai s s)trurio3nydlme  fcsl()aDururont4opeomf3iad mDem(vo;(4tlxrmf3oydomDraieilt0 etoimpio1om nmicia(  2ua(roou0olxnii3iysfm eaums u0alerxr to1fmt auvols0sexmxr io1amenmiciasfsDtrxro;o1ale iieiaslsDul(mpnt0 etnmrcoadlp eai i t0trtoio io4ape  nvs (fsrtm(mpnt0tlto fctltla2raums;t4 rxnmf3tydoatrluvo;t0sexoxrpiu1lltelfvtatfaDrau pno4tpenmf3iasfsDrl(vo u)trxrirciotfmD  n i;s)trtmxr3no1ll n fcs t)aDurx  no4oeeomoeildfa ea(vo (0alxnxr tadom r nvo ( s2trimpoudlp e ieilsfa2rrxr ;t1aex mo3tadlmDum(monu0 eerir3tytfat anvsl()trxmim3iudlltn fvt s)aDtau  ou0aexo feilt m2eln o (0texrmo3oytfateaueo t0trxo(o iy1altelneias  rtmuroot0tptoioctad s rl(vp;u4 lxnio3totlatrauvsl()t2trxm3nu1lmt miesat) rtaxr no4tpe  ieild mDul(vo u0altoxr3iodlptrlies t)s2xmxrpoo1ap  mictlt) rta( o;t1olt iictldfa um(msn(0 etrio iatlpte n s;s)t2urxr iodlptnlfct sfsrua( ono0aleomf3tatfm2eanvs t4aetnif3oo1omDeli i;t)t2trxmpiy1op  lfvil( a2um( ont0tex iietytla2rl(mo u)artrxr3io1optraivol( s2tm(m iydop elnct s)a2rrxmooo4ope  oeiadlm2rln pnu0 etnxf3oo1opt lnvol()tetrim3ny1altnmiviasfa2um(mpno4alx iicilsfa ea( p;t4artoxfcoy1lpDrli o s t2umxr iydomee ieias  Dumxr ;o1aeeomoctlslm eanmp t4 ltrmocoo1opt au s t) rto(o3io1ol   icias) 2rmx oou1olxo octadlm emuvsn(4tlerio tadoa rlnes (0trtoiopiy1omtn nviasfarum(  nt1opxnifeiadlm2ra( p t)aeenmocty1opD  ieo s0teto(r3io4aleemfeils)arrr(ro;u4aee if3ildfaDeluvo;(0areoxf3ta1lmt  u i;s)setm(m3no1am  mnvil(  Drmumpnu4apto fciyt a2ra(vp t) etomoctotom e uvo t)t2toio oo1op  mietat)aDtru  ;u0olx mf3tyd aDulnvs t)trenmfctotlpDe uvs;t0srto(m nydoleemivsl(  Drau o;o0ope mociasls2eanmont)tetnmo tatlmt anvo t texoxrpnudale lfctl()arrrxmpno4aetomf3iytfs eauvs (4 ltrxfcootfpDrai s;t setrxmpiy4ame livslsfs2raumonu0ale ii3tat a el(mo u4 eeoxo3iytfptraueo ()seuo(r oudlpe lnci tfa2tr(mo;o0tpe iicildlaDulnms;()alerir iotoa r nvi t seuoio3nu4lpe liei sfa2taumpnu1tpe ii3tasfa emu ont4altrmo ia1fp e i ol()trtrxmpnodomtemfei tf rrm( p;u0apx ii3iadlm2uan on(4 rtomfcoadlaDe uvi;s sexrio iy4amtn neils srumxroou1oex ifeils s rauvpn(4arermocio1lat  ieo;s trtoxmpnu1lmeelici t) Dtaxr nt4tpx  fetld aDeau s;t) renmr3iydlmt  neils) rxr(m3nodol   fetl() 2umx poo1aexomieiaslsDrluvo u0trtrmfcty1fa eanvils sruoim3nudom e ici (f 2tmu pno0opt  ieiyd a2um(vs;t0 rtnmr ty1fmteaivslt sexm(rpoudap emfvils)sDrr(m no1opx mfetltfm ean p ()aetnio3oadoa ranes;(  2trio iudamen fcils)aDtru o;u4oltnii3ildfs umn p ()trxrmfciy1fmtr ivi s) exr(o3oydlp   fctat arrrx p;u1aleo f3tys mDrau p u4 rxrif ootfaD ai s;( trxmxm3ny4ole  ncs sfaDtru ont0aeenio3tadlaDulnmonu4aleniocto1lat  ivi t  rxm(m iu4al n ncta(  Dtm(mont0teeniocilslsDemu s;t) etrif tadoaDr n i;s0 rumim3oy4aleemnei t) rurxmonu1oltoifeildfa2ul(vp t4altnmfctytomD anvs;t t2xr(m3ou4lm nmnvsa()srtmumoot1olt iietytfaDrm(vs;(4alenmoctydfp ranvo t0texr(mpoy1apeemivs (  2uax  no1aet ioctyt a rmnmon(4 etrmo oatfptrlneo;()setr(o3oo1ole mnvs (faDrax p;t0altnioeilt m2ea(msnt0 rerxr todlmteanei (  2toim3oy1oltelicil(  2tau onu1alxoif3ilslaDra( o t4 exoircoytlpD  ieols  exoxo3nodapenlivil(faDtmxm ;u4apen oeiydfa uaumsnt)aeeoio iodop elnvo;(  2xrim oo4om   fei ( s2rm(  ou4aeenmociyt s eau onu4tlxnifcta1fmt  u olt)trxrim3ou4lpenmics ( s2ra(  ot4tlt ifeiytla rau o t0 etnif3todlaD  i ilt  2uoxm3oydlptnmivt s aDrauront1apt mi3iysfaDranvpnt0 renxr3tytlp  an i t setmxo3no4omte feta(  rtru poo0oee ifciytls rm(mp;t) rxrmf to1fpDraiei s)t2toio oodlltnmncsat)s2rmxronu1oleomoetadls2uln o;t4 eenxr3ootomt luvils)sexoim oo4lltelietl( sDrrurpou4aptnioeiasfs uan o ()aetnifcoadfatr neslt  rxoimpiodaltnlfvs sf Drax p;t1aptomfeiltfa2eanmp t0teerio oodoat  uvs;()srur(mpoudlptnmfvsl(fsDrmxrono4altomf3iaslm uauvs;u)alermf3oa1fpDrauvs s  2umxm3oy1omeelfei () 2ta(m nu0apeoifetyslmDeanmpn(0trxrxfcoodopDr n s s0teuo(m3iu1ameelnct s) rtrurpnt0apxoiocias aDrauvp;u0altnmo tytla eai s s0trtoxm3oo1omtelfcslsf Dumur ;o0tptnmo3tas m2rau o u4 lxrifcoytfm  au o (  2xrir nodlp nmncs s)a2rm(rpnu1aex  fctat s elu s;(4altrmocta1la   uei s srxrxo oy1ope  nvsa( sDraxmpou0apenifetltfm2rlnvp u)altrmf3oa1fpDrlueo;s0truo(o io4al nlnciat)sDra(rpnu1aex ii3ilslmDrl(mp u4 lermr3ty1fmD ln s s0s2xoxo oy1al  lnvs s) rumu p;t4apeoif3tatlsDel( pn(4altriociodlm e uvi;()t2tm(opnudoleemnvi s arur(rpnu0tpx  fetls mDra(vp;t4 rerirciytfmDe u slt srtm(r nodoleemnesls)sDua(mp;u0oeeo o3ilt s2rln p u4alenxr to1fmDr ivs (0s2xoxm3io4olenmicta( s2uauro;u1oet  f3iyt a el(ms;u0alermrcoadfmDranvo t)srtmir3nu1altelfctat) Drr( o;t1open oeiatls2rmu on()artomr3ia1om  lieilt)t2xrir iudlp e nvt (fsDtrxm nt4aptnif3iasfs umn onu0 rxnmr ia1opt aieo;t) etrirpio1ol nlnvia(fs2rm(m nt0opt mictysfsDrmnvsn() etnxf3iodoa elueol(0seurxo3nu1lle  ieta()aDrr(  nt1oexn fciatfmDem(vs ()alenxo3oydom  aneo (0teur(r nudll   nci s a2umxrpnt0apt  i3tadls rm(vsn(4artrmf totfa rlu i;s0 rxrio3nu1lmee fcil( srtmu  no0aptoioetytlmDem( s;t0trtomfcia1op  aies t) rtrimpoo1op e fcsat  2raum ;t0apt  o3tldfm2umump;t)artomf oadfaD an olt0 etm(opiydopt mietls)sDuau ono4tlenmoeilt s rauvo;t4alxrxr3oo1fmD lueo;t)s2umio3iydapenlfet sfsrtrum oo0tpenmfeilslm2ul(vs;t0 lenmr iatla   n ilt) eumxr nudole lfvs tfsrua( ooo0aeto ieilslm rl(vp ()aetnmrcty1fpteaieils)teuo(mpny1omtn ivilt)arrrur no0opto fetas a umn onu0 eenio iodomDeanvo (  eurim3iu4altelfvslsf ruaxmpoo4apeoio3iytlsDelnms;(4altrxfctytlmD livilt0 eurxopou1ap nmneiat)srrrur nu1tlxomfeiydfa eluvs t4artnif iydla  lnvs;t)srur(rpnu4ome mieta(  rtmur ;o0tet  f3tlsfa2eauvp ()trerxf3oo1oa rau il( t2uoim ou1lmtemfetas)artru  no1aeto oetlsfa2uan pnt4texrxo tatom rauvols trxo(m no4am elfetas)a2ua( pnu0tltnifcils a rlu pn()aexnxoctodla eaneol(0texmxo3ou1lptelivslt sDrmuroou4tpxomfctls s em(vs (0aetomrciotom   nvi;(0 rxrio ny4lp nlics sfa2um(moot0tpxn oetld m2uluvpnu) exoxf iytlpD  u i;(0srxr(o3iy1lm e fvi ( a2tmumoou1oex  ietydlm2ua(vpn(0tltnmoctytfmDr ivi s  2xoxm nodapen ics sfs2rrump;u4opeoioctlt a2uluvp u4altnmocoo1fat livolt sexrxr nu4optn ivs tf rtrxro;o1oee  feilslmDran p (0 rxnifciotlmt luvils0t2xr(rpoodolt  nvsl(fa2raxroot1oetnmfciytlm2um(vpnu4tlxnmr oytfpt  n s;t0 euoim oudope mivi s)a2tm(rpnt4opx  oetas a ea(ms t)teenxf3ty1opt luvolt0 ruo(r ou4lm nmics sfartmuro;u1teen ictltls2emuvo () eenif ootfmte uei;t texo(r ny1lm n fvilsfa2ur(moot1tlx moetlslm ul(mp;u4 rtnxf iodfm r uvslt)tetm(o3oudol nmfvsls sDta( p;u0tpxnioctasfsDeanmo;t0trxrxo ty1fa   ieols0seur(m3nu4lme  ncils)s2rmx oou0aexoiictytfa2rlums u4 ltrir3tatom   nes s) ruoimpio4ll nlnet (fa2urur nt0oexo fetydls2um( s;t)aetnio oadlmDe uei;t  2tr(mpoo1lmte ics t)s2um(mont1aexomfeiltfa uan p;() lermrcoo1lpteln o s0teuoio oudomen icilsfartax o;t0olt mfciad a2eln pn(0tlxrmo3oatopDr ivs (0s2xo(r3iydlp   ivtl(fsDuau o;u4olx  ietatfa rmnvsnu0 ltnxr3oodom e nes;() rtr(o3ou1al emnvsls  rurxrpoo0altomfcildls el(mpn(0areoirciytlmtr i i s)sexrxrpny4ap   fet (  2tmum oo1opxnmf3tlsfm2ranmp;u4aeeoxo todomt lu s ()sexoxrpoudlpe  nesas  rra( ooo1tlenmieiasfs emnmont0alxomfcoadfmD livs;() ruoxm iudap elfesasfarta(ro;u1opt  octyd s uauvpnt)artoxf3iydlaDe n o t  eurxrpoodop e nvsls sDraumono0apt ifeiys a uln p;t) rtrmo ia1lp r nes () rum(m3no4alee iesas  rurxrono1tpxnif3ils a ul(vpnu)tltoxfcoodoatr uesl( trxrxrpiu4apee ict sfsDtaxm ou1tptnioeiyslsDem(vo;u)aeeomf3tydomDranvo;(0 2tmxr3ou1aleemnesl( s2taxrooo4tetn iciasfs2um( s;(4tleomr3totom   i i (0trtmio oydol  mfvsat)s2taurpoo0opx ifctytlsDumump;(4texnif tatlp elnvi s)tetrxopiu4omt lnctls  rtm(mo;u0olxoii3iltlsDrm(vs;t4tlxrmoctodlm eau sls)trurir oudap nmnctas)srur( oou1alt ioeiadlm2ea(mpnt0 lxnmo3ia1om e nvi s0trxmio nu4lm n fciat arrru ont0tetomieiyt s2ran sn(0 eeoxfcoydoa   nvi;t)t2trim3nu1lltelfvtas s2tauronu0oetnmocilslm2elump;u0trxrxfciydfmDr ivs t0trxrio io4optemnvs ( srtr( o;u1tptomicild aDeluvp u0alenir tadoptelnvilt0 2xoxr3oy4ole mnvs (fsDumu pnt0tlxoiictltfaDelu o u4arxoifcty1fpD  i i t  rxr(r oy4lmtnmfvsls)sDtru oou1altniiciytlsDum(msnu4areomf3ia1lmt  ivo t)texm(o3no1am e ictas)arumx pnt0apto fetlt aDuauvpnu4teeomr3tytoateaneilt0s2xriopoodomen feil(fa2ua(mp;o0tpx io3iysfaDra( o t)altoxf3iy1fpDelueo;s trtm(mpny1llt lict (f ruaur ot4alx miciaslaDrmn p u)alxrmr io1lat  uvil() eumxm iu4ameelncta( sDuaumpou0tet micilt m2rlu onu0 eermr3iatlpDran slt0texr(m3iy1lmtemnvsa(f 2ta( pnu0aeeoifcilt sDulumsn(0aetoif oy1omt aueolt seur(m3iodlle lnvs t) Drr(m nu4tlt ioetltfa elump (0trxoxo3iatlaD aueo t  etoiopiodoltnmivta(f Drrxrpnt4tex ifctys a2el(ms;u)tltrirciatlpt  neslt0t2uoxopoy4lptnlicsls)s2rrx oou0tetnmocils sDraums;(0tltnircoo1oa  lu s;s0s2xrxm3oy4amtnmnci ()a2taxr ;u0aee io3ias a2ran s;()trxnxociy1oat  i ils0 ruoxo io1lmt mncsa(fsrtmx p;o1tlxo f3iadla2rmn o u) reoir tadfaD lieols  rxrxm nu1omenlnvtlt aDtr( pou0apxnifciadls uln pnu0arermf todoatrluei (0t2xrxr nu4openmfcil(fs2taump;o0oeto i3tlsfm elums;u4trxoir to1laDelu olt teum(rpno4omeemfvsatfarrr(  nu1oltoioeiyslm2umu p ()altnxf3oa1fp eaueslt)setoxo oudlltnmncil(f 2trxmp;t1oeeniicilsls2ean o t0 ltnmoctotopDeli olt0srto(o ny1aptnmfci sfarurur ;t4tex micilsls umnvon()tltnmfctytomD anvi t0t2xmxrpno1ll emfvtlsfsDuaurp;t1oleo feiysla uaumon()tlxnirctydopDeli s s)s2xrxmpio4apeemiesltfsrrru  ;t1opt mociatls emu o t) rxrmf oodfmDranvs;t0seumim3nu4ap n iei s)arumur nt4aex moctldfs2ranmpnu) rxrio3oatfaDraies s teuoir nodol   fcsat s2ua(rpnu4tex ifcils m2eaump;u0tetnmf3oatlpD auvi (0 rumir3iu4lp  lnctas)arumu  nu0oleomf3iasla rlu p;t0 exnxf oadoaDranvo s srxr(o iu1om e fci (  ruax pot4tpt  fciatfa2rlnms u0artrif totfp e i sl(  rxrio3iu4ll emivs tf 2um( pot0tpenifcils m uanmont) ltoxo oatlpt ln ols0t2tm(rpnudal nlicsls) Drmumonu4tle miciad a umuvp;(4 lxrio3iatlmt lnes s teumxmpoy1lme mietas aDurx p;u1tex iociatfm ua(vp;u)tlenmocoo1lm  aiei (  eurxopnu4ape  neslt s2tmxmoou1alto o3tldfa2umumo u4trxoxrcia1opDe ueo t trxm(r3oodamt  ictls)sruaur ;o0tlxomfetlsfs2uanvo (0 leoio oy1fpDe nvil() rumimpoy4ap e nesls  rtr( ont1oetoioctyd a2elumonu4trtrioctodlatrlnvilt sexr(r iy4olte nvia(  Dua(rpnu1tpenifeils sDuluvsn(0tltoxo3oa1fat aieils)srxmxopoodale lies s  2tmurpoo0tetomo3iaslm2ra(ms t)arerir io1om r u ol(0texrxrpou1ap nliesas  Drmur ot0apenmieiadfs2ul(vo;t) exoxo3totom raivolt  2xrxo iu4oltn iesa() rtr(rpnu0tpx mfciysfmDrln pn(0areoifciytlmteli s t  rtmimpny4oltnlfvia(  rrax ooo0aex  f3tasfs2rmu o;t4aetrmo todlmDrlivil() etrir iydoptnlfesl(fsDrmurpno4aee mieiatfm2um(vs;t)tetrifctydom  aieols0tetmim3io1am   fvi sf Drm(r ;u0tlt mi3tysla2elnvs ()tltomf ty1laDrau il()srurir oydomenmieta(fsDtrurp;u4tptn fctyslaDrmuvs t0 renxf oytopDr ivol() rxr(m3iu1lptelivsa(fsrua(m nt1optnmf3tytla2rmu snu4trerirctydlat  ivi;t  ruoir3oudlm   netat)a2urx  ;o1oee iietys a2um(monu4aeenmfciodfa   uvs;t)teumxm3oy4llte nvtl( artrumono1apxn ociyt a2ulu p t0aeeoircoy1fpt aneo;t)trtmxo iudalee fes s a2tm(r ;u4tpx mi3iytlaDrmu s t)alxoxo iotlatr neo;( seum(mpoo4al nmivsat)s2umxr ;o1olxo feiatla ra(mo u4 eeriocoa1omD auvsls0 etoimpio4lptnmfcsas sDtrur nu1olxoii3tytlaDumu s;u4trenxo iodop  lueslt s2xmimpoydlmt mfvs t) Drm( pnt1tptnio3iytlm2ra(mo;() leoifcootlaDrlu ol() 2trim3ou1altemnet sfsDumumooo0open f3tlslm ua(vs;t0tltnxr oo1lpD lnvils)trtm(mpnydlmtemnvs s  Draumo;o1texomfeiat s2um(vo t) eenxoctotlp eluvols0 exrio3oy4lpt  fctlsfarraxmpno0oeeo f3ildfs2rauvonu0altoir totfa elu s;t)seurimpio4om elieiasfsDrmx ooo0apenii3tydls emnmo;u0arenxr3oydlmD  ivs (0setrxm3iodap   ivtls)aDtrxrpot0tleo o3iys aDel(msnu0 eenxo3totlpDean s s0srxrir3iudapte icta()arua(m nt4oexnmoetlsfa umu p;u4 ltoxociytlmDrlneol(  rxoxo3oydlmtemnct s)s2ta(m ot1aeen ocilsfsDrm(ms (0 lenifcootfpDe ieo;t0trumim no4lpe  ies t s2rr( oot4oltnmfciatfaDrl( o;(0 ltoxr oa1fmtraneo s)trurxm nydlpeemfcsls aDumxroou1alxnmfeilt s em(mon(0 etnxr oodlat anei t trxm(r ou1oltemfetltfs2tmumoot0tpt io3iydls2ra(mp;t0tlenxo tytfpDrliesls  exrxrpiu1llenmfvsasfa2uru  ot0texnmfetldlaDum(msnt4trtnio3tydfpDe ies;(0trxmxo3no1olte netasf 2uaum ou0alenmicilt m2eanms t)tltnxociadla e u o;t0srtmxo oo4ame mncsat)aDrr(m nt4tlxo fciyd a2ea(vs;u4texoif totoatrau o;t teumxo nu1optnlivi t aruru pou4tlenmi3iyt aDean s;(0alenmrcoodom rli o;s) rxr(mpoo4op   fetltfs2tmu o;o1tlt  feiat aDrm(vpnt4 etoxoctodop eauvo;s)t2xo(m3iudlm  mietlt sruaxmo;o1teeoio3iaslsDum( s;u4teenmo ty1oa r u o t0t2umxm ou1ape  ivs sfsDrmxmpnu1alt ioeilt a rl(ms;t) eerioctadlm elueo (  exr(rpou4lptelnctls)artrx pnu0aeenioctld m rau on()alxnmf oo1oaDr n s t  rxrxo oo4amtnmnvslt)sDua(m ou0oexo ieiysfm ua(vs;u4arxnmr3oa1lmDr u slt)sexo(o3oy1lmtn feia()a2trx p;o0olxnii3ildls umuvp (4arxrmo iy1omtr u o ()srumxm no4alt  fviltfa2raxr oo4texnioeiydlaDeln snt0trtoif io1fmD au i;( teurimpiudll n ict (fartm( ont1oee mieiytla umnms;() etnxf3oo1lmDr uvsl(  exoir ou1lptemicsasfsrrm(mp;t1tlt  ocilsfa ra(mo;t0 rxrmo3tatom r i o (0 etr(r3oy1lltnmfeta(f rtr(mo;u1aetn fciatla2ua( s;u)aeeoio iadlp  liesl( trtoir3nu1llt  ietl(f 2rrxrpno4tetomoeiad a emuvo u0aetrxoctotlp r uvs;s  2umxo nodlmee ieia(fa2tm(mp;u1apxn ocild s2rmnms (4 renmr iytomD aieol(0trtr(m3nu4omtnlietl(  2rmu  ot1alxo ietltlm2um(mo u4tlxnir3oatom e neil(0trtr(o ou4lme mnvsas)arraxmoou0tlx  iciyt s2em(vsnt)tetnmf3ta1fatrauvs s)trxmxr3nodaptn iei tfartr(  ;u4tptn oetytlsDemn onu0 lxoxrctadlptrlnvi;(0 eumirpiodlptn ncsls sDtaxroou0tet mi3tad aDumnms u4aetrir3iytlaDr ivs;t0 rxo(m ny1olt mfvs ()sruax  nt4aex io3iasla rm(von()teerirctydlptrlivi t)texmir3oy4olee nvsa( a2tax p;u0teeo ocias sDrln s;() rerxf3tatla rai o;s  2tmio io4lmenmneiltf Drmxr oo4tlx iiciytfm rl(mo u0 lermfcto1fpDr n i t setm(m iu1lleelfcsas)artau pno1aeenmiciysls2eanvsnu)trenxocio1op elieo s)s2tr(m iu4amtnmncsat aDuru pno0aee moeiyt a ea(vonu0 ltrmr oa1la  lu i;t) eurir3oydap elietat)srtaxrono0aptnif3iyt m2rau o u)trenxociadfa  livil( sexm(r nudlleelneils arrr(ro;o1oex  feiatlm ea(mp;u)texrif3ta1om  li slt tetmio3nu4om   fvi t)a2ua(ro;o0tet mfeildfs emn sn(4 exrmf oadfmD aneol()s2xrir oy1optnlieiasfs2trxm ;o1aeen f3iatla2rlnvpnt0tlenxr oodlmte n sls) euoxr iudoltn fvi tf 2tax  nu0olt  feiadfs rmumo;t4 etnir3iytfmDe u s;t)texr(r ou4ol elfvi t)arraxmo;u4olxo fcias m2umuvs;u)aeermo3iydla raivo;t)seurxmpny4ll nmivta(f 2rr( o;u0optomfciys m rm(ms;u) lenxr3iodfpt  ivs t t2uoir iu1ame liet (fa2urx  ot0tpenioetat m rln p u0 exoir3iotoptran o s0 2xmir3ou1aptemfesls)aDtmu o;o4tpto oeiyd sDulu o;(4 lxomr3ia1opDeaues () ruoxm ny1altn nvslt s2rrxro;o4teeomieiat sDemnmsnt0tlerir oo1fm raivo s  etrim3ou1lm elnes (f rraxmpoo0opxnmoctasfaDuaump t) renxf3ty1fm r ieo;s  2xr(m ny4ol  liet ()aDumur no0tptoifcias a2uau onu0 rtoir tytlpt lnvo t  2xm(o iy1lptemnviat)a2umx oou4aptniieilt s uluvs (4aetrxf3iodlatr n ol(0s2uoim3oo4lmtn icsl(fsrtax oot1aexo iciysfm eluvpnt4 rxoif oytlm  aueo;s trxo(opoodlptemictl( a2raxm ot0tlxoifciatls2eauvont) rtrmf oydfa e uvs t trxmir iydaltnmies t arrax  ;t0tleoioctytfs rlu s;u0 rxniocootlpt lnei;(0 etmim iodomtn ncilsfs2umu p;u4aexnmicilslsDuan o;t)tlxrir iydom rai s t) etoxrpoo1omee nvsls)s2trxrpno1tptomoetls sDea(vpn() lerxr oa1lmt liei t  rxr(o3no4om  livt s)arurumo;u1tpt  ieiytlaDuanvp;u) rtnxf3oadlmDelnvi;s)seurxmpoo1aleelnesat s2rr(  ;o0olxniocildlmDemuvp ()texnmociodopDelues;(  rtrxopoudlm  mictasfsDrmumpoo1oetoii3iyt aDranmo;t0 eenmo3iatoaDelueils  2xr(mpoodame livt t srurxr nt1tlt  f3ilt s uluvpnu0tltoircoytfmDeaivs;( trxmxo oy4lmtn fcsls srta(ro;t0optniocildfaDrmnmo;t0trxrmr tatop elueo;t0 ruoxr3iydop   fetlsf 2tr(r nu1tlxoioetlsls ea( o;t4alenxociatla r neo;(0 etm(m3iodllt livi (fsrtmxmp;o1aleniieilt m2ranms t0tlxomo oatfaD anvsls sexoim3iy4ame  fetasfaDurx pou0tltomfeilsfs rau on(0trxrmrciatfpD li s s  2uo(opiydllen ieta() Dra( onu4oetomo3ilsfs2elnvpn(0 lerif3oy1oaDelieo;(0s2urxopny1lm elfvt (faDtax ont0alxomi3iltlm elnvs u0 ltoxrcoydopDran o;( setm(m iudamen fci t artmx oou4ape mi3iyd m2emnvsn(0tlenio3tydfmD aivs;t teto(mpiu4ameemfvtls srrax poo0aexoif3tys sDrau p t0 rxrxo3to1laDe nvs;t0 2umxmpnodlm nlnes tfaDumxront4tlenmf3iys aDrlu pnu0alxnmfciy1lmD  iei;( s2umio iodame  ict s a2rm( ooo4ope  fctyt a2em(mpnt4aleoxf3oa1omt lueo;(  rurio3ny1lm elfeta(  rtm(rp;t1tee miciltls ua(mont0trenio3oy1fpDr nvs;t0s2umir nydaptnmfvs s) rtrump;o1tlen i3ilsfsDemump;u0altnmf to1opDr nvslt0teumxopiydllte nes s)srua(m ;o4tlxoifeiyd mDuan pnt)trenmrcootomDrli ols) rxrxopiy4optnlfci tfaDtax  oo4apenmfeiytfa2emu p ()aleomr3tatfm   nei;s0 eto(m no4lmen icsltfsruaur nt4oet mictadlsDea(mp;t4trxomr oydfptrluvi t)t2uoimpnodalt mnvta( sDuaurpot0ole  ieildlaDuln pn(4 lenio3ta1fm e ieo (0 rxmirpou4opt  netls a2um(ro;t1tle if3tatfs uau o;() eeomf3ootopDrli s;(  exrxrpoo1ll  lncs tf Drauronu4oexo o3iytfsDel(monu4 eenmr3totopteauvils s2um(o3iudomteliet sf rtru  no4tleomoetld aDeln on(4aexoif iotfmt lnei s0 rtmirpoo4ome lfeils srrm(ronu0altnioeilt aDumuvo u0tlerxr3iydfmD aieo ()sexoxm3ny1lptn fvilt) Duaxroot1opxnmieilslm ua(vp;t)tlxomocootfm  lnvs s0 2xmxm3iy4ole  fvt ()aDurum oo0apxo o3ias m rmumonu)aetnxr3iodomD  uei;s  2trir ou1om  mfesl( a2taxro;u1tleomiciasfs eau s;t0 exnxr3to1opDr nei s0 2uo(o3io1amt lieia()a2umum oo4tee mfeilt sDrmums;t0artrxr oodfptean o;s)srxmir3nudamenlivsa() 2tmum ;o1oet iictyd m2eluvsnt0teeoxf3iytlptrau s s0 eurxr3iu4amt  neiatfs2umxro;u4ale mocild s uanvsnt)alxnxf tadfm rluei;s srtmir nodamtemnvt t) rrax ooo4openif3iydfaDemnvont4 rtomf oa1oateli o s0t2tmxmpiydol nlnctat)a2uaxmono4tpeoiociyd a2um(vo;()tlxomf3tadopDeaues s)t2tm(opnydlme lnci s)s2tax  ot0aexomo3ild a ua(vo u0arxrmf3oydfm  au ol(0 rtmio iodapee icslsf 2urxm no1texomocils a eanmon(0tetnxr oy1opt  ues;s0t2ur(rpoydol  liei (fartmu pou0oeen ietad s rmnvpn() eerxr iytfpte neslt) ruoxm ou1lp   nvilt  Drm( o;u1ope mo3ildla em(mon(4texrif3oodfa  aivolt)setrxrpoy4ome  fviat) rrmxm ou0alx  f3tatls umums;(4 rtrxoctydfpDelnvi t)teurxopnydap  lneslsfs2umu pot0ale iictlsla rm( snt4 rtrir oodlm r i o s) rtrirpnudopeemfciltf rrmumpoo4tetnmictysfs2rl(ms;(0trxniocoo1lp  lieo s trxoiopnu4lpe lfvsltfs2raxmooo0olxo ociatlm rm(vpn(0altnxociydfp  lu slt0trtrio3oudolen fes s) Duaxmpnt0altn fetaslm2rm(mo;u4 exnxfcoatoat ln o s)t2xr(opiu1ll nlnvta( sDraxmp;o1oetnmictytfa2emums u0 rtoifctatfat  ieo;t sexrxo oo4om nmfesls) rumxr ;u4oee ifetltfa2rauvpnu)trermr3iadfa e n ils) eum(o3oo1amtelnesasfarurxr nu0aeeoiociytfs2raums (4 rtomr todomDe ivo t)s2tmir3ny4oltnlivsls)s2ur( onu1opeoiicildfs el(vo u4 exomo tatfm r ueils setrxr no1opt  nvtas)sDrm(rp;t1oee mf3iat s eau s;t0 ltoifciadomt  uvols) 2tmxrpnu1oltnmnvs tfarumumono4olto f3iadlm2ranvs;t)trtnio iodlpD lu slt  rumxo3ou4aptn ies ()artm( oot1tpt ifciad m eauvp;t0alerircoo1omDelivs;t0sexm(m3nu4lleelfvt t) rtaumo;o4tle mociatlm2rmn s ()trxrmf3tytfa eau i;(0srtm(m ny4olenmfvslt  2trurpot0olxo o3ilslmDrmn onu0tlermfciadla r ieols seto(o3iu4apen fcsl(  2tm(ro;u4oee ifciytfmDuln s (4aetrxf3totfmD lnesls0 2xmxo oydaleelncia()artmx oot4tlenmo3tltla rm( o;u0tetrmrctadfpDe uvo t)s2xo(o3oo1alt lnvta()a2tr(m nu4oltnmfctytla rmu o u)tlxnxo tydlp  aues;s0 rumxr3iydlm  lfci sfa2urxront0oeeo o3iys s ul(vo;(0 lxoifcto1fmt lu o ()s2tmxo oo1alt mneias) Drr( ooo4olt  fciyt mDrln sn(0texoif ta1fmtean olt0trxr(r nydale mnctlt aDuax  nt4ope mictlsla2umu onu)trtrxfciatoateanvol()setm(opou4lpeelneil() Duaxrpno4ope mfeils aDemnmo;u4aetnir3tydfpDrluvols srumxr3iudlpeemfvia() Dtr( ont0oexo fctltfs2ra( p u0tltrxo oo1fmtelu i;t) 2uoxo ny4om emfcsl(  2umxrpou1tleo ictaslm eau p;u4tltrmfciodlatelnes s0 eumiopoy4ole mfesltfa2rr( pnu1tee ifciyt aDean p (0 ltoxr to1laDraueols)t2trimpnodllt  iviltfa2tm(mp;t1ale  ieiysls ranmsn(4aeenif3oy1fp   n s;()s2xmxo oo4apenmiesl(f 2ra(  ot1apeo ieildfa2eluvsnt0 lxrxocoo1oa   u o;s s2umim3no4alenlivta(  2ra(  ;u1tpxomictas aDumu sn()altoxrcoydlmDe ivol()tetm(opiodll n feta()aDumumono4oeenifeild s2ul(vp;u4treoio oy1fateauvs t  euo(m iydap nmfeilt  2tmxronu1oltnii3ilsfm rmuvp;u4 lermr3iy1fpD ln sls0texo(m3iu1olenmfcslt sDrrurooo0aeen ocildfs rau o;u)artnmo iy1lmD  ivs;s)s2toxm iy1alt  ivt (fa2trum ou1teeomieildls uan o;t4 etrmrctotop rlnesls) ruoxo ny4opte nvil() rrmx p;o1alx  i3ilsfa ean p (0artrir3to1oa e nes t sruoxo nu4olenmnciasfsrtmur ;o1oeeoif3iysfaDelnvo (4trxrxr io1om rlnvolt  eurxm3ny1ol  lnes t)aDrm(mpnt4optnmi3tys a2rau pnt)altnxr3tydopDrln ol(0srtmiopoydame lnci () Drm(m ou0tetomieiltfsDumn o;u0areoxf3iodfa rli s;t  rurxm3nudal elivt ( aDumxr ;t0opto fciys mDrmn p t4artoxo tydop  aivi;( teum(r iu4lmenliviltfsrrax  ot1olx moctydfs rm(vs (4artrmr tytoaDrlnvo (0teuoxo io1lptnmfeslt s2rm(r ou0aptnmoctydla ulu s;u) lxoxfciadla e u i s)trtmirpoodalt lieil(  Drrx  no1open fctasfs2el( o t4alerxrciy1om eluesls trtrim oudolenlivils)a2ur( o;t4aeenifeiaslsDra( p;()arxnmo iotoa e i i ( srtrxo iy1optelnei () Dtmxroou0apt  i3iys s emn snt)aexomrcio1optraues t0 exrim ou1al n nvia(  Dua(ro;u1aexn o3tas s rlnmp;() lxnxrciatfp  anvo;s)teur(mpno4apen ncs ()sDtaurp;u4apxomfcilslm2rm( s;(0aeenmfcoo1lptelueo s  2urxmpnudlptemnvi tfsDumu o;o0opxn icils a uaump (4 etnxr oydfpteluvs;t t2toio iu4lp elnvt s)sDrrxrp;u4aexomo3iadfm uanvpnu)tetomf3tytoateaivs;t0 2urxmpiy1lmtnlietl(fsDtmu  oo4oltoii3iydlm uanvsnu)aleoxrcoytfmteai ils  2xrxm ny4am nlivs (f Dtruront1aptomf3iatfaDulnms;u4 ltnmf iotopDeaivsls0s2uo(r3nodap   iei tf rumurp;t0aleo ictatlmDumu p;()alxoxr todfptrauvs;s0s2trxo iy4llte netl()aDua(m nt0aet mfciyd a2eaumsnu4 rxnmr3oadopt auvolt0 2xr(m3iodom e fviltfs2raxmpou4opxo i3iytls2rln p;(4tlxrmfciydfm   ivi s0truoim ou4ap  lfcs s  rrm(m nu0teto i3tadfa em(mon() reoir3iydlmDr n i;t  2xo(m iu1lptnmncta(fa2rrxm nu1oltnif3tyt m2um( o;t0tlxoxfctytoaDe i s;()tetmim oy4oltelivsas)artr(rpno1aeeoiociaslm rau s;t)teeomo oydlpD  nei;t t2xr(r3iy1ol e iesat  Draurp;t4apen feiyslaDul(vo;u4arxoxr3oo1oa eaieo;s)t2xm(r nydlp nlietltfsrum(m no0tlto octltfs elnmonu0trxrioctytoaD li s s0t2uo(o3io1apen fcsa(faDraxmo;o1tpt ioctlslm2uanmp;(0aexrio iotfm e uei t) rurimpoydoltn fetat sDrmum ;o1tlenmo3tysla eanvs (0 rermfcoadlp  li s t) rxoxrpoo1ameelfvilt) rraumonu1oee  ocildlsDemnms t0alerxf to1oaDelieilt  2xm(r3io4omeelnctls)sDururpnu0tpen ociatlm rlumpnt0aeeoxf3oa1fmDrauvi (0s2to(mpiodlmen ivs s)s2taumoou0openio3tadfmDrmnvp ()alxnif oadlpDeai i t t2ur(rpoo1omt mivils) 2um(  ot1altn fciysfs rmu p;(4areoxfcoydfa e ueil(0setoxr3oy1lmenlivias)sDtrx o;o0oex ii3iltfaDelnmsn()alerir oydlm eluvs s)t2xoio ou4op n fcsl(f Dtmx o;u1tpxnio3iatfa2em(vsnu0treoxf3iodom e uvo;(0 2uoxm3oy1lltelnetlt arumur oo4optn iciadls2um( o;u)aeeoxfctadlmteauei;t)sruoiopnu4op n nvta(faDua(mp;u4tpto fciysla umnvpnt0arxoirctatop rauesls tetrxm no4aptemivtlt)aDtmxmoot1alx  i3ildfa2ran pn()trxomr oatfp  ln s s trtoxo oydop  mfciat)s2umx pno4tlt  feiasla elu p t) eeoxfctytfmtrlivs (0s2xrxo3no1op nmiviat)s2um(r ;t1aexnmoeilslmDemuvo;t0arxrmo iydoa e ivs ( seuo(m io4omeemfvia( aDrmumpot4oeeniiciltfs2um(vs;(4altrxociytom e u s;( srur(r3iy4lmt  netatfa2ururoot1teeomf3iyt m2em(vpnt)tlxrio iy1fpt au i;s0srumxo3ou1om  mncs t  Dumxrp;t0alxn octat a el(msn()texnxo3todfptr ieo s) etm(m3iodoltnmfcta( srta(m ;t4teenmociltfm rlnmo;(4 rxrifcoo1fp  liei ( sexmirpiodop n ictlsf rurx p;t1aee ifeils m ulu onu4alenxf3tatfa ean s t)srumxrpoodlleemfeia() 2umxr ou4aleomf3iadla2rln o u)artnmo3iotlp r i o;t0tetrio3oydap nlfcias) rrmurpou1aetnii3iytla2raumo;t)alerio oadlp  au o s0s2xm(r3oy1llt miesl(faDua(rpot0altnmfeiyt s ra(von(4teeoxf to1omD ln o () 2to(m no4om   fviat) 2uaxrono1oltoioeiytfmDua(vs u) rtnif iadfm  auvo s0t2urxm oodam  mictlt)aDtaxmooo0tpx  feiytlm2el( s t) rtrio3oatomDr nes t teuoxm oy1lp   neia() Drmum ;t1tlt iocilt m el( sn(0 leoir3oytoptelnvsl(  ruo(r ou1alteliesls)a2tmu p;o4olxoiociytls emuvs;()tetrifcoy1fpDraues t) rxmxopiudopeelncsatfsrua(  nu4tetnioeiad m rl(vpnt)aetnircia1opt li sl(0s2umxo ny1am nmiesa( s2raxr no1tpx ifciltfs uln p t)aeenif3ty1lat  u o s)setr(rpoudoltn fcsls)s2uax p;o1aetomo3ils aDra(vonu4arxoircoatlm rln s;(0 2ur(m3iodomee ietat srrrxmo;t1tex  iciltlaDeauvpnt0 ltrir tytfp e uvslt0sexoir3nu1lmt mnviltfsrrmx  ;o4aee  feiad sDea( pnt4tltoxr iytomt  nvols0trum(rpiu4om n ncils)srraxmpou4tex  feiltfmDum( p;(4 eerio3tytla r uei ( tetmxr oy4omt  ncil()srrm(  ou1tee mfetysfm ranmpn(0texnirctadfmtran i ( s2uo(r3oudapt  icslsf Dra(ronu0aee iociysfaDul(ms;t0trxoxrctytoatrlnvsl( setm(o3oy4lptnmfvilt a2raxm ;o1texoiieildlsDrln pnt4aetrxr io1faD auvo;( srtmio oodomte fctat)sDrmurpnu1tlxn f3iat mDuanms t4 renxf3to1om eaivo;s0t2xoio ou4am  lfvi t) 2umumpou0olxoiictys m ul(ms;t4 exnmf3iotoatraieo;s0truo(r iu4opeelfvt t  Dua( pnt1olxomfeiyslsDulu s;t0 eeoxf iotlmt lueilt0 ruriopio1lp elicta()srumurp;t1apxn oetld s elnvpn(0tltnif3ootoate nes;t0 eto(m3iy1ll emnvilt)arrmxmo;o4aeto iciatlsDeau o () rtoxf3ta1lptr ivolt0 etmir3nu1opeeliesl()artaur ;u1oltn iciaslm ua(mp;t0artnxf3tatfa  lieo;s)sexoxmpoydale lfeias) Duaurp;o1oleoii3iytlm2umnvo;() lxnio ootfp  ln i s srxoim3iodap nlnesa()a2uaur ot0apto ieiad mDrmu p u4trenir iytfatrlieolt) 2xmir3iy4omeemncsltfsrrm( ont0tex  fctydfm ulums t0 rtrmo to1fpDelnes;(0trxoxr3oy4alee ictl() 2rmxm ou0tpxnmictldls ulnvs;t) leomo3ootlpD anes t) eum(mpnydlpeelfes ( a2urxrp;u1tle ii3ilt mDemn p;u4 lxoio oatop e ivol()seuo(opno1lp elfvi tf rum( pot1tpen fciyd s2umuvo;u4treomf ta1fmD livi;t teur(opno1apt micsas aDra( ooo0oexo iciysfa2rlnmp;u0trtnir oatlatrluvil( srxrxm3iydap  lnet ( srtaur oo4ape mociydfs2eauvsnu4 rxnircty1oa  auvi s) 2tm(r iy4omtnmfvt t)srrmxr ou4oleoifciyt mDrlnvont) leoxocty1oateli s ()srtrimpoy1lpenlivi s)s2ua(rpno1tex  i3iyt a2uaumsn(4alermr3io1lptr i i s)srto(m oy4omeemncia(faDtauroot0tlt io3ils s2ulnmo u0tltnmrcoadlaDelueilt0 2umir3oy1lmtemfvilt) 2tmxro;t4alxn ocild s2ea( p t) etoiocto1lpt lies;t) eurxrpnodam  mfvs s srrau pnu4oex  i3ildfm2rlumo t0trtrmf ia1faDran o s0 exriopno4lpenmict ( s2tr(  ot0oee mfcildlmDel( s u4artoircoy1oaDeli ol()trxrxr io4am elfct ()sDtaum ot4tleo octytfaDrl(mp;u0aexnmoctytlm   nes;(0 2umimpnudolenlici s)arua(mp;t1tpe mfcilt a2emums ()tetoir3iodopD luvslt)texmxmpnu4amtnlnesl(f Dtm(ro;t4oex mf3ilt s2uanvo;(4altrmr3iytfa  lu s;s)srtoxo oudope lnes ()srururono4tle iiciyd a eaums;t0 lxomo to1optrlueil()s2xmio3oo1lme lfet tf Draxm oo1tpeo ictldfsDum(vpnu0 reomr3iodfpt luvi s  2xoxr3oo4omenlnvsasfarrmuro;o1aeeomo3tld aDeaumo;t4arxomrcoatoptr ieo ( t2toir3iy4oleemnetasfsDrru o;u4tpxo ocilsfs2umnvs;t0alxoxo3tadlpDrlnesls) rxrxm nu4olt mfet s  rum(r no1opxn f3tadfmDrmnms () rtomo oatop r ueslt0tetr(rpoudlpenmics ()artm(mo;t0ape iiciatlsDul(vo (0tlxrmf3ootoaDranvo ( teto(opiydlp elfvi (fsDrm(mo;t0olxnmi3ildla2rl(ms u0altnxrctodom eau o;t s2toxopou1alenlictasfsrrm(mp;u1olx ifeiadls emump u0tleoxr iotfpDr uvi;t)s2xmxr3nudomt mfctasf 2ra(mp;u1oex iieiys s rlums;()tetrircta1fmt lnvo;t0srtoxo oydol emnvsat a2rmxmo;o0tltnmi3iys sDeauvs t0 reoxocia1om rai i;s0teum(r oodlpee icsas)arta(rono4alxo f3ild sDemuvpnu0 ltoxociytomtrln olt s2tr(r3io1om emnct t)s2rrx  nt4ape mietydla rmu p;u) exnxo3tytlat lnvsls0seuo(o nu1lmtnlnct () rrr( o;o0tpxoiieiytla2rluvo;u0aeeoir3tatlpDrlivo;(0teuoxopiy4omeeliviasfaDraurp;u0aet  octldlsDean snu) exnmo3iotfmt  neo t  2umxm3iu1ll   nei ( s2raxr ot4aet io3iltfs2eluvpn()texnxfciatomDe neo s0 rxo(r ny1llenmnvsasf rumxmpot0tlxnmietadfa umn o;t0 lenxo3iadomDelueolt)t2tr(opno1llenlfvil(fsDurxmo;o1apx iiciasfa2ra( s;t0 ltrxr ta1opDe iesls)trxmir no1oltn icsls)s2tmu  ou4tpxomiciytfm2elu onu4tetrmr iy1fpte uvsl()t2tmir3nu1op  lfvsl( a2rmur ;o4optn i3tldfs eln snu)texnxfcio1lptelneo ( t2tr(opny1lm  miet ()arur( o;t0oet iietasfs2el(vpnu0alenifctotla e neo s0 2xm(rpoo1al nlnvsls)a2tax poo4optn oeiasfmDeauvp;(0 lxoiocoydom  luvs s) rumxm iudlm n fei ()sDtrx  nt0aetoiicildls2ea(ms u)alerxr3oytfa r ivs;s truoxo3iu1opeelivtl(f 2rr(rpnt1oexnif3iad m2uauvon(0trxrxf oadfa eau s ( s2xmxrpiu4alee nes tf 2urxrono0teeomfciasfa2rlumpnu0trermf3todfaDranei s) rxoxopiu1apenmivtlt a2ra(r oo4tpe mieiadla2rlumsnt) reoxfcia1lmt auei t  2tr(rpnodamtemfesas)s2ua(r ;t0apenmfciltls um( snu)arenxocio1om  lu i;( tetoxo nodolt mnvi s arua(  nt1tex ifeiyd a ranvo;(0tlxoir iy1opDe u il(0tetmio iy1lptemnetls) Drmxm no4apt miciyslm umuvs ()tltomoctodlptelivo t t2triopno1ope  ict t)srrmxrpoo4oex moctyt m ulu snu0 etnxr3tydoa  auvsl(0 rtrxr3ny1ameemivtasfsrraumpnu4oeeo ocilsfaDumums (4 lxnxr3tadfp elu ols0trumxr3no4apt lfeta( sDta( pnu4oleomictlsfa ulnmo u0trtoio ia1oa rlneo;s tetm(o iodole mncilt sDrrx ont0alx  i3iadfaDea(vonu4 etnmo iy1lp rai s s0s2tmxr iu1amtn icilsf rrrxmo;o1oee mo3ilsfs emumsnt4tlxnif3ty1lp   uvi;s0trum(r iy4omeemivil(f rua(  ;o0tpeomi3tld aDemuvon(0 reoxr totfat auei;s trxr(m3io1optelfvi ( a2ta(m nt0oetn oetytfa rmumonu0 eeoxr oodoptraivo t) 2tmir3oo1omtnmnetatfartr(mo;t1tpxnmi3ildlm emuvp;t) rtnxociytop eluei s srxrxm3nu4lpte nct t srtau p;u0tpen o3ias sDrlumpn(4altoiociatfpDr ues s) euoimpoo4ame mfet s  ruaxmpno0oeenmi3tls a2rln pnt) ltnxrcoodom e ivo s  exoxm3oy4ol elnviltfaDrmu p;u0tlxoio3iytfa2rmn o;(4artoif tadomtrln i;(0 eto(rpiodll nlfeslsfsDtaxmoou4aeeomf3iysfs2ranmont4teeoxr3iy1oa eauei s0trurir3oydlpe  ncils  2tauront4olx mfciytfsDrlumo t0texoir3oo1oaDr i s s0t2uo(r nudapte nviat)srra(monu4aetomieiydlaDulnvs;(0 etoxo3oo1op eanei t0t2xrio oy4llt mnet sfaDur(mpou4teeomfeild aDum(vp;t0 etomo oydfa  lu i;t)setoimpoy1ll nlfctl( srta(rpoo1alx  o3iaslm2rmums (0teerif3io1fatr iei;s trumir no4lpenmfei t) rrrumont0aleomiciysfa ulu s;u) lxrmo tytfp elnesl( trxmim3iu4am   nvsl()sDta(rpno1aet ii3iaslsDra(von(0arenmo iydlp  auvo t0 2umimpnodol nmnvi (  2raumonu4tpx  iciltlm2umu p;t0tlerif tadoa e n i;() rxr(r3oy1lp emnvils)sDurumoot1tpeoifctyslmDulu o (4 lenircoatoaDr nvi;s0t2xoxo3oo1ol  lfcsas)aDur(m ;u1texo ociytls eanvs;(0 reoircootoa  anvols  2uoxm nu4olenmfetlt) 2rru p;t0apto f3tatfsDuluvs;(4tetnmo tydfmt lnei t) eur(r iy4ll nlivils) ruaurpnu1altn i3iyt a2rmu ont) lenio totoateauvsl()trtoxopiu1ap  miet sfa2ua(rpnu1oet  oetltfaDuanmp;u0tleoio3io1omteaneo t t2xr(r nu4llteliviat  Dtaurpno4aet moeilsla umump;(4trxrxo3oa1lmteaies s0trtm(opiu4al  lncsasf Drmumo;t1tle mfeiatfsDeauvo t0tltrioctytfm r u o;t) rumxm3oy4lpt  netasfarur(mpoo0opto f3iyt m umn s u4trtrmf io1laD aieilt  2xmim3iy1lmenlfeta() Dtru oot4apx moetasls2rm( o;t)aetrif3iy1lmDrlnes;(0 2xmim3iy1lm nlnctat)a2ur(rpnt0apxnmf3tydls umnvs u) etnifcio1fmt  nvilt0 euo(r3iudlm nlies ( arrr( oot1olx mfctadfs emu ont) rxnifcoytlmDranvolt)trxrxopiydlleelieta(fs2trump;u4tlx micildfm uanmsnu4 rxrmoctodfaDranvs ( seur(opiy4apte fvil()a2rmx o;o1apeomo3tldlaDumump t0 ltnmf tadomte ivs;s0 etrir3nu1amt lnesas aDrmu oou1tpt moetltfm2um(vo;u)alxnxfcio1fmteli s;t)sexmirpnodamtnmivt s  2tmurpou0aeto fetat m ranmo () leoif ty1oat an sl( sexm(rpoo1am n fes ( sDraur ;o4altomicils mDeauvp;t4 rtrmfciatlaDraivi;()t2toir ou1lp n ieil(f 2rr(m ;u0teeomf3ildfsDrmnmo () lxrxocoa1faD aueo;s)sexoim3oo4lptnmnei tfsDraxm ou1oexo f3tysla rl(vont4 lenir3oy1opDrlnvsl() etoxm nudol emietl(  Dur(m ;u1tlen fciasfa rmuvs;(4tetoxf3iadfptranes ()t2uo(mpiydlptelivtltfsrtmum nu4oexo icias sDrlu o;(4 lxrifcia1opteaieslt)texr(r3iu4lmen ictls) 2ur( o;u0oeeniiciat mDulnmp;(4areomo3oy1fp eluvsl(0 etr(r ou4lme lfcilt sDtmu  oo1tlx  f3iyd sDrau p t0 reniociodopt livo;t)t2toxo iodam n ncsa( arrmurpou4ope ifctls a2umnvp;u4alenif3iotfa eai ils trtm(rpnu1om   ici s aDtmu  ou0oetnmoctlsfs raumpnt) ltrxocty1lptr nvs (0t2xrimpoy4omt mfctls)srumumoou4tleo ieiysls el(vpnt4 eeomfciodlaD  i olt) 2tr(m3ny4aptnlfvsls)artmumpou1apxoiieiltlsDeln sn(4 etoxoctatfpDrli i;s)sexrxmpoo4amenmfciatfa2urx o;t4olen o3iytfaDul(mo;u0 rtrxfciatom rln i (0trxmxr oudol   fci sfsDtrx  oo4altnmi3tlslsDra(von(0arenmf ty1oa  lues;( teto(mpio1lpenlivtl(fsDrrx  nu1oexnmo3tad s uaumsn()aeermfcto1op  anei;t)t2tmiopnudaptn icsasfsrur(m oo1aet mf3tadfmDra(msn(4 exrif3iatoaDe ivi;()srxmim oodol emneta(fsDrm( pno1tpeo ocias m rlnmp;t0aeermo ta1lm rauvi;() rtr(opny4lp nlnvtls)a2tax  ;u4ale mfciyd s ua( s t)trtrioctodla ranvo ( tetoimpiy4lleelicsasf 2tm(rpoo1olx iocild m2ea(vs u4 exrxf iytfatr ueol(  rtrir iodomeelics t sDrmu pot1apt  fctldlaDrm( pnu0trtoircty1latrln ol( t2tmir ny1lm   ictltfarrmumpou1oltn feiytfaDeanvo t)tltrxfciodomte uei s)srurio ou1am n ieslsfaDrr(moot4tlx mo3iytlaDuanmpnt) rtrxrciydlmDran il(0srtoio3iudopt  fvsl(farua(r ot0ope mictyt aDuau s;t4altoxrcoy1op   uvo ( t2toxopiudlp emfcs s)aDumurpoo1teto o3iydfm2ra(ms t0teeomo3oytlmt luvsls0truo(o3oy1lptelneilt  2um(r ;t0oltn ieiatfmDrm(von(4aeeoif oo1lateauvo;s setm(rpiodopeelnciat  2rr( oou1tlenmieiysls ulu p (4teerxfctytlmDeai i s)t2xoim nydlme mnvt ()aDtmumoou4tlenmfeiyslsDua(vp (4trtriocoydoa elivs;() eurxm nu1lm nlfcils sDum(rp;t0opxn oetytfmDumuvp;(0tltnio tatoa eluesls0srtoxo oydopenmnetls s2um(m ;o1tle ioctydlaDum(msnu4aleoir ta1opDelivs;t0trtr(m3oydamtnlfet s)aDtau  no1aex  octltla2elu s;()tlxrxo3iatopD ln s t)tetmimpoo4lm n nvs ()sDrax p;t1aetniociyd a rlu p ()alxoif tadopte i il()t2tmxopnu4ol  mnvilsf Dur( p;o0oex  f3tad a2ua( pnu4 rtoxf3ta1omDrli o;t0 2toxm3iodamen fcsls a2ur(ro;u0oeeomo3tadfs el( o ()aetrmr3io1fatelieo t) exo(o nodop emnciltfsDrrurpou0alxo fciltls umn ont)tetoiocoo1fmt ln o;s trurxo ou1apenmnesas  rurum nu4apen f3tat sDuanmo u0areoir oodfp raivil( t2tmiopio1lp   nesltf rumumpnu0oltnio3tasfaDrl(vsnu0alxnio tatfm raivols0truoio nu4op eliei (f 2tax pnt4aleo o3ildfa2em(vpn()trtrxf3oy1opDranei s s2urxm io4aptemicias srrmx  ot1alxo o3iad a2ul(mpn()tleoircoa1oat ln o;( seto(r3iu1optn net tfsrtr(m ou0apx iiciysfsDuln p t0aleoiociatom e u sls  eumxm3iu4apeelfei tf 2rm(  ou4oleomfcildfs2ulu sn()alxnxf3oatom   nes;( seto(r3iy4aptemicsltfa2ra(rpoo1tpeoifeildfa2rm(mp t0artrxf3iadfmDeln slt0texmio nu1apt  nviat arua(mooo1tltnifciydlsDrm( sn(4 etnio ia1omtran o;s trtoim3iy1lptn ivtlsf Duaum oo1olx mieild aDemuvpn(0 renxo oadfpD anes s) 2tmxopoodal emnci (farta(m ou4apx  feiad a umnms;u4 lxoxo3ia1oa eau s t  rtr(o oo4apenlfetl(  Dua(mp;o1aexomocildla rau p u0teenxf3ta1op  liei s)setm(mpiu4am nmnesl(fa2rm(rp;o4olx  ieiydfmDum( o;u4texnxr iydop eluvi (0 2tm(o3nu1alee nvsas) 2tmumpou1opxomi3tld aDean o;t) leomr tadfp rau s ()trumirpny1am elfvtl() 2rmx oot4oltniociatfmDum(vp u4 exnxr ootfp rluei;()setr(opny1amtn nvs s aDra(r ot1ope  feildlm2rauvo u4 lxomrcoadomD lueo t)s2urim io4omte nvia() Dtrur ;t0aetnmfeiatla eln s;(4texrmrcoadfatrlneo s0 exo(rpnodaltelnvil(f Dtru pnu4alen oetaslaDeluvonu4trtrir3oodoaDrlnvo;s  rxrir3oodapt mfcta( srtrxr no1oexnifeilslm2emn onu) rtnxoctytla  auei (  2to(r no1apenmnvia(fa2trumpou0apxoifetltlm umn p u) rtrmr iydfpt anvsl(0s2toim3oydol  lnvslt srurxrpou1tpt if3iyd m rmu s (0artnif totfpDe nvs t0 eum(r nu1lpe mnvtl()aDtaxmp;u0olx iictlsfm2rauvs;() leoio oodfm  aivo t  euo(m iy1amtn icia( aDtau pnu0tetomictldlm2emu on() lxnio3tadoa  lnvo;( srxmxo iodllee fci sfaDrm( pnt4teeomoeilsfm2ul(mo;u4artoxr oa1fatrlneo;t)srxm(r3ny4ll n ieias)a2ra(  nt0altniociasfaDel(ms (4aetomrcoadopteau o t0 2trxm3io4ll nmiesas artm(monu4aleomieiysfmDean s;(4tlxomo oodlatrai o t sruoxmpiydap  lfctas  Dtm(rp;t0apxnmo3tad m umnms (0aexoir3iadlpDeai sl( teuoxopoudopt  ivtls) Dua(rp;t0aeenii3iytfa2el(vp;u0aetoxr3iodop  aivslt0 2toxrpiy4lm  lnvsas s2ta( pnu1tlxoio3ilsfs rmn pnu0 leomfciotfpD lnei;t0teuo(r nu1amtn nes t)a2uau  no4aetoiietls aDeanmp;(0aetomo3tadfaD li olt)t2uoxr oudalenlfeta(fsrum( onu1aeeo f3iat a2ua(vp;u4 etnxo3ootfpDe uvo;s0 etrir3iy1llte ictls sDrr( ont0tpenifctadfm2umnvs;u4 lxnirciytopDeluvs ( srxmxo3nydllt lnetasfartrumpot1olto ictldla rl(vp;t)aeeomrciydfpD  ueo;(0 rumimpiodlm  lnvi tfa2rr(moou4tlxniietasls rluvp;u) rtnmocio1omtelues;()t2tmxm3oy4lpte fcta(faDrmuro;u1ole mfetlsfm umumsn()artrio oydomDeanvols0 rxr(opiy4lpt lneilt  rrrxmpoo4alenmieild m el( s;u0artomf3totfaD  neils0 etmio nydam   iesasfa2trxro;u1apxn octydfm elu o;u)arxnmr3iadomD livols tetrxopiy4opt micilt) rrr(rp;o0olxnmi3iydlm2ea(vs u4alxrxo3ta1lp eaivo s trtrxo3iy1ale  ncias) rrrx  no4apeomoetytls eaums u0trtnmf to1fmD  nvsl(0seuo(mpoudlm   fct sfsDtmur ;u4altn o3iasfm2ulu snt) etoxfctatlmtrln ol(  2uoir nu1ole mivs tfartrurono0tlto oeiadfa2um(vpnu0tlxrmf3iotopDean s;s s2tmxmpou4om   nciasfa2ra( pou1oet  fciasfs2ua(vs u4tlxnxf3tatfpt an s t srurxr iydapen fvsasf Duaumo;u1aptoioetadfm umnvont4areoxf3iodlmD li o () 2tmim oo1ol elncsat  rrrxmont4olt io3tysfa eanvs;()trtnio iotfaDr ueo;() etr(o3ny1ole mfcs s)s2ta(monu1tetomiciatlmDul(vsn() reoif3iodfpD livilt srtrim iy4al nmnei s  Duaxmpno1tpeomictatlsDran o;u)arxoxr3iotlpte uei () rxo(r3oydamtn nvsasfaDumur ;u4aexo iciadls umnmpn(4 rtomocty1fp rau slt s2xrxo3iy4lp emfesasf 2rm(moou4tee  o3tlsfs2ra(msnu4 rtrxf3oatfatrauvs;(0t2trxr3nudamen ietl(f Duru o;o0tpe iocias s rlnmonu4tetomfcoy1fm  lnesls) 2xr(r iy1alen fetls)a2uau o;u0aptnif3ilslm2uaums (0trtnxf tadlp rlneols0s2urxopiodoleemiei t)srta(mooo4tpxnmo3tyslm ul( o;()tlenxf oatopD anes s srxrxo iu4om  mies s  2ur(r ou1aet  oeiaslm2uaumont)aexnif3tydfa r uvo ()t2tmio3nu4om emfcsat  2uax p;u4aeen oeiatls2um(mo u)alxoio totfmteau i;s) rxrxrpnudom  mncs t) Dur(mp;o4apen fciat aDem( s;(0 exrxo ta1fmtrauvslt0s2uoim iydllenlfvia()arumu o;o1aee  iciytfm2ra(vs t)areoxf3tatfp   neolt t2um(o iu4ll nlfvsat)aDraxmoot1tlxniociad a2umnmonu)altoir3oodopD  n o s0trxmxrpnu1amt  fci s)srrr(rpot4aptomo3iadla rl( o;t4altnmr3ty1lat auvs;t srum(mpoudlmtn fvt s)aDuaxrpno4tlenmfctadla2ul(vo u4teenir3oa1oat lu o s s2tm(r3nodllt lieia()sDta(ront0apen ictls a2um( ont0tltnmo3tydfpDeaneo (0t2tr(opoy1lltelici t) 2ra(rono0opt iiciat a2uanvont4 lxrmo tytlaDeln ol(0 rurimpiu4lpe mfcsls sDum(ront1tlxoiociytfsDuau s;(0artnxf3to1lpD ln o () 2urimpiudlltelfvsa(fa2taurpou4aexo f3tyslm el(vp t) leoxo3ootfa e i olt) etmxm oo1omenlfesl() 2ua(rpnt4open iciydlm uluvp t4tlxoir iytfmDelivilt0setoir3io1aptnmfvtls)a2rr(rpoo0aetomi3iltfsDean on(4trtoir3iadlm e i i;t) eum(mpiydomtnmivsatfartrum ;o1apeo i3iydla rm(msnu4tetnio3iotfa  lnvsl()texmxm3nydop  mnvi tf rrmxrpot0alxoio3tyslm2umnvs u)trerif3oydlmtelies;s0s2uoxrpiydaptelfciltfa2ta(roou0aptoii3ilt sDrln s u0 reoir todlm r uesls  eumxr io4lme lfeslt  2tm(ro;t4oexnmo3tys a umu s t4arxoxf3iatlaDr ivo (0s2xrxopio1lm nmnvils)sDurxr nu1apxomf3iadfa2rm( p;() eeoxo todomtr neilt  rtmim3oydlmee fvtl(farrau o;o4alen oeiltla2rm(vo (4 eeoxo tydfate ivi t0t2umxo iy1lp e nvtas)aruru poo4olenif3tys sDua( s;(4altrif3ia1opDrln sls0t2xoio io1apee fetasf 2rm(  nu0aee iiciytfmDua(vsnu0 eenmf iydfmDr nvs;()trurio oudame mivslt  Draxr no4olxoiiciyd a2rlums;u4 rxomfcoydlmDraivsl(0s2umim3iy1apee fctat) rtmxmpot0open feiytfaDelnvs ()arxoxrcoy1fmt lu i t0s2xoxo3io4lmtnmnvsat)s2umuroot0apenif3tyd mDeauvo;u) lxrmf3oydlm elu i s) 2umxr io1op nlnes t) 2umxr ot0oeenmictadlsDrmn o (0aeerir iotfmtran o;t) exmxm3nudam  mfvtasfs2rm( pou0apxomocilslmDua(vp t4treoiocto1oaDrlnvs;t sexmxo no4amtnmfvtls srrrxr oo1oet  fciaslaDeauvs t4teerxrcoa1lm   ues;()t2xm(o3iydol nmfesasf rurxr nt1opxnmfciysfa2rmu o t0 exnioctotfmDe neo;s)srxr(r oudlpen ietasfaDtrum nt0opx iieils s2um(vs;()trtrmr tydlat lues;t tetmim oydapee icilt)sruau  ot4ole mo3ias m rluvon() leomr ia1fatrlueils0 rumxm3ny1amtelici s sDta(rpou0olxnifeiytlm2elumo t4trtnmrcto1fatelu ilt0 2triopiu4llt mictas srumu o;t4optomfeiadfs eluvs;(4 eenmr3oatfm   n s;s)teum(opou4ol nmfcilt a2tau o;u0altnif3iydls ul( o t0treoxf3tytoa rli o;t)s2xoxopiudop nlnvslsf Dur(  ;u1aetn icilslmDrl( pn() ltrmrctytlmDelieslt0 exoiopoudlpe  fcsa()artmxr ;t0aee mfeiys mDranmp t)tlxnif oadfpte ivo s)t2uoxmpiu4omeelfetl()artau  ou0aptn octydfs um(vpnu4arxomf3iydlm   ivi s  rxmio iydaltnmfeta(fsrur(mono4olenif3tasla2rmums;()artrmr3oodfp r ivs t0t2trim3io4aptn fcilt s2rm(mpoo0apeoif3tatfs rau pnu4arxnxf tytopt au o;t t2uoxopou1ll n nvi sfs2ta(ro;t1aptomociydlm emump;(0 eeomf3iatfp r nvs;t) rto(r3iy4lmee fes (fsrum(mp;t0teeo fcilslmDumuvs ()aexnir iodopt lu i t)trtoim iydol e ivsa(  2umx o;u4oet  oetatlsDem(vo;t) rerif3oatfpt  u olt0 rtrxm no4am emivtls)aDtr(ro;u4ape ioctldlm2el(vo (0arxrmo3todfatrau ils0trtrxo nu1opt mivs s) 2tmxmp;u4aleoifctat m emuvonu0alxrmr3io1omDr ivo;t  rurxrpiydlmt mivt sf rrr(m ;o0opxn ociat m eau ont0aleoiocio1omDr nes (0 exrxm oudol emneiasfarrr(r ;o4oexo i3iydfaDuaumpnt) leoir3oodom elnvs (0 exo(mpny1olt  neia()srtr(m ot4tlx io3iyd m2rlu o;(4arenxf3ia1fa  aivi s0srtrxo3io1aptemnctl(farum(r ;u1apto f3iydfaDumnvpnu)alxoifcty1laDrai s ()setmxm ou1amen nctlt)sDrrxrp;o0oltomfcilt a emnms () rxrxr3oo1faDraneo (0trxrirpio1amtn ivia( s2rm(r ;o0oleomo3ilt s ul(vs () lerxo3iydlmDrauvilt0s2xmxo nu4omtnmfeslt  ruauro;u4ale  fcias s elu o (4 exnxrcoodomD  nvolt teuoxrpnu4ap  lnvs s s2raxmp;u4tleo f3iad s uau o;u) rxnxo3iydfmte uvs;s s2xoio oy1ape lnciat)srtmx ooo4alxn o3tyt m elums t4 lxrxfcto1om  au i t0 2uriopou1al emies (fa2tmx o;t0tleo ociaslm uanvpnu0aeerio oa1lm  lneo ( trxmxo3iudom nlfetl()srrmur ;o4tet ifeilsfaDuanmsnt) rtrirciotlat lnei (  2tmirpoy1ale mics t)aDururonu1olxomieildfa ra( o;() rtrxrcoodop e uesls)s2urxmpiu4apenmics s a2rmu ono1tpx ii3iysfm2rmu p ()trtnir3todomDrlu s;s) eumxm3oydaptn iet t  Duru o;o4tee mfciydfm2ra( sn(4tlxnmf tydfm  luvils0teum(o3oo1om nlncsa()srra(r no1alen iciasfa el( o;u0tlerxf3oatfmtrluvi t)sexriopoo4omt lfet sf rtaur ;t1tetn iciadlm rm( snt) leriociydlate uvs;()s2ur(o oo4ap elfvi s)aruaumono4altn oeiat a2el( o u4aetnmo3iodfa rlueolt0 eumxrpiydomeemfvilsfaDrmu p;t1ale mf3iltfm emuvp t4texnmfcoodfpDraivi t)truoirpiy4olt  feias  rtax pnt1tltniietys m2umnvp t4aeenio totopDrluesl(0s2xo(mpoy1openlfei (  Drmxm nu0tle mi3ildlmDelnvon() rtoxfcia1omte n i;(0srur(mpiudal nmicsls) 2ua( pnu1aeeoio3tasfm2rmnvsnt0 rtrifcoydopDr ieo;s s2to(rpno1amtnmfcil() 2taurooo1alen ietatfsDum(vp;t4aeermfcty1lp  luvi;(0 rto(r nu1lmtemfcsatfa2raumono4tltomietys mDrlnmo t4texnxf3oo1oa eauvols  rtoxrpiy4altn ics s)aDtru  oo1ale mfctyslm2elnmsnu0trenmf oytlptrlu o;(0 2xmim3iy4llee ivtltfartm(  ;u4tptoif3iat m el(vo t)artrifcoadomte i s s) etoio3oo4lpt  ieslsfa2umumonu0alenmfciaslsDua(vsnt4trxomociytop eai o s)s2tmir io1lpee fctasfsDtmx  oo0olxn oeilsfaDulu p;(4 rxrxf3tydlaDrln o s)sruoxr3nudlp nlnei ( srta(m nt1open feiysls um(vo;()aexnifcty1lp  livs s trtoxm no1oltelieia(fartrxmonu1aeto oeiat a2ulu p t) lxnio3oatoa  aieilt) rto(r oy4lptnlnetat  Dumxroou0aptomietldfa ea(vpn(0 lermfcia1lp rluvilt0teum(o3iydlmeemivtas) rtaxm oo1openmf3iat m2ul(vont4aexoio todom  luvo t  euo(o oy4amenlnvi s)srtaumooo1oltoii3ild sDeaump;(0aexrif3ootlmteli i s0setm(mpio1olen ici t) Dra(mp;u4teenif3iyt a ranvont0tlxoxf oydlp r i s;s0trtr(r no1al nlnvsltfa2rr(rono4texnii3tatfa uluvo;u4alxnxociotlaDrlneol(  exmxr3oy1lpt  neta(f 2rrx pno0tpe  ociytlaDrlnvs () rxnmrciydoateai i t0 eumxo iy4om elfcils)a2rmu  ;o0oetomictat m2ra(vsn()tetoxfctatfm r nesls)sexo(mpoo1ome  fvt s)arraurpou4altoioeiadla2rmu pnu0trtnmo3iotom e u o t teto(r iydolenlfvtat  rtm(rpou4oet  octyd aDrmumsnu0artrio oodopD lu s ( trtmiopiu4al   ivtlsfartaxr ou4tpenmiciyd sDrlumo (0 etomo iytfp eaueo t0 2ur(m io4ole  icta( sDrru pno4tex moetatla2rmn o ()aexoio ta1lm elu i;s) exoxo iu4olenlfes s  Dururpnt0tpxomoeild mDrm(mon()arxnif todlmteaies ()tetmxo3no4lpeemivilsfaDrru onu0alxomictadls2elnms t)teermocia1fm eaieo;s) 2tmxmpio4ope lnvtl(farra(rpot4aex  feiaslaDumnmp u4tlermo io1opt lieslt)sexmimpou4open fct (farrr(moot1oex moctlt aDua(vo t0 rtnmo3iytlpt li i;s t2tr(m nudomen icilt arua(ront1tpeoiietad s emuvo;u0tleomo oydfpD  ivi s0 euoxm3oy4apeemfvtls) Draxm ou4altnmiciat mDumnmo t0tlxnxo iy1fa  livs t sexmxo iodam n fvtls)srrm(  nu0tle  f3tyd a2ul(mon(0arxnif iy1fmte nes (0 2to(mpiu4lptemnetat) 2rrxmpnt4tptnif3iasfsDem(vs u)teeoif iydla rlu s;()truo(o iydllt mnci () 2urumpnu0aeeoifeiyt aDumnmon()tltrif3oytoptelies;s sexrxr3nu1lmt  fvsltfa2tru  nu0opt mfciltls2raumsnu4arxnmrcoadlpteauvo (  rtrim3oo1aptnmnvta()a2raxmpot4tex  o3iltla2rm(vo;(4tetrmfcoadfa   ivi;t  euo(r3oo4lptemfcs () 2tr(mpoo4aexo feiytfs2umnvonu)artrxo3iadoat  ivi;() rxoxrpnudlmt  iesat) Drmum nu1oetoiiciltla2ranvs;t0artrmoctytfat  uvs t0sexm(r3oo4alenlivtl()s2rau  ;u4opto i3iysfm2ea(mont4tleomocoodoatelnes;t  2xm(m3no1omte ieia() ruax ono1oee mietatlmDrmnmp u0 rxrif iydomte nvslt0 2xoimpiy1omte nvsasfaDtrurp;o1aexn fetytfa ul( s (0tetnifcta1opt anes (0teur(r oo1ame mneiat  2urxro;u0tlt moeiltlm2rl(mo u)trtnxr3iy1lmt ln i;()teurxo3nu4amt mfcils)aDtrxmp;u0apen o3iat a2emn o;(0 etnmrcto1oateln olt)t2xrxm3iy1lmeelivs s) rta(m oo0tltnioetysfsDrlnvs;t)aeeomrctadfpte i il(0 2tm(opno4al e nct t arurump;t0aex iictad a2ua(mo;u4trtnxrciatoatr ueils)t2xr(m3oy4ape mfvt s) Drmur ou1oleomoctlslm elnvont4artoxf tytomtrluvolt0sexmiopiu1lpt  neslsf 2urumpno0aeenio3iasfmDemnvs;(0arxoir3iydfmtelu i (0 2xmimpoudal  lnvsls  rtr(mooo4tetoiieiyslmDea( pn(0 rxrmr3oydomD  uei;s)t2xm(opoo1omte nvt sfaDumurp;t4tet mictltfmDrmump;(0alenxf3tytfa  an s;( s2xmxmpoudllt  ivilt sruaum ;o0oeenio3ildlm2rau p;(4trxoir3todoptrln o;t)seto(rpiy1opt  nvi s) rtaxrp;o4oeeoii3iyt a2uauvs u4 etrxo3tytfm  luvs;( t2toxo nu4lle mfvi tf 2rrumoou0alxomfciatfm2rmnmpnu)aexnmf3oytop r i sl(0 etrirpou4apenlivtas) rrmumpno1aeenmf3tas aDuanvsnt0tlxnxocoy1opDran s;s)s2tmxr iy4lm n fesls) 2umu oou1olxn fetysfaDrmuvsnu0teerircoatlmDeanei s)t2tmxopiudome mfctl(f Dtm(  nu0texoii3tltlm2ra( o;u0 lxomo oa1fpD ai slt0s2trio3oy4ol n netasfsruax oou1tpeomociys mDrlnms;(0 eenir3io1omDrluvs ()teto(o iydolen fvtl(  rua(mooo0aex ifctydfs raums;u4tlxrir oytom r uei;t setr(m iydoptnmnctltf Dta(mpoo1olxoioeildla2eanvo;t0 etnmr3oatopD aiei t srto(r nudale mneias  Dtmu  ou4aetnmocias a2uauvp;(4 lenxf totopDeanvils0tetmirpnydlmee net s aDumxmpnt0oee  o3iytfm rlu onu0 lxomr iotfpDeaivi;t t2xoirpno1ame mfcs s)srurxrpnt0alxnmictad aDrlu p;(0aexnxrctodlmtrlu s (0 euoxmpou4al   iet t sDra(m oo4aex ioetasfm2uau s (0 rtoir3oadfpDr u o;()truo(m ou4lmen fet (fa2uau  no4oexoioctlsfmDelnms;t)tltoxfcoa1fa rln sls srxoim ou1om e ieilsfartm(r nt4opeoiociydla2rmnvp;u)aetoxfciydlpDean s s  etrimpou4lmtn ivias)a2umur oo1opxnii3iadla uanvpnt0 lermocto1fp r uesls)s2to(r oo1op   fesa() Dra(  ;o4tex ifciysla eauvp;u4texnir iotlp rlnvi;t0truo(rpoodameemncil()arrr(r ;t1tlt iieilslaDulumo;(0 etomo tadoa e nes;s s2xm(m oy4altnlneta( sDraxm nt0apxnmieiatfmDemu pnt0artrxr oatomtrlies t0 etrir3iodlmenlietas)s2rmxm ot4oetomfciatlmDrmu o u4aeeoir3io1lptr u ol()teuoxopiudlp elfctl()srururpou4aptomoeiytlmDul(mpnt0teeomfcootfateauvslt)t2xr(o iodlmte nviasfsruaum nu1apx mfciyslaDraump t)altomo iydop e uvo s0 rtrxr3ou1op nmivi ( srrmuronu0alx mfeiatls2ul(vp;u0 lxnxf3to1optranvsl()seur(m3ou1lpt lnesa(fa2trx  ;o1aetomfeiad m2rlnvsnu) lxnxr3iatop  anvs t) etrir ny4ome lict sf Drax  ;u1opxoifetysfaDemn p (4aleoio oodlpteln ols)s2uoxr3iu4omeeliei (  Dumx o;o0tpenmi3ildls ulnmo;t4 etnircootomDeln o;t  rtrxm3oy1optnmies ()aDurx  ot0oeeomfeiyslaDemu snu)alenmfcty1fp rliei;() 2xmxo ou1lpt mfctls)sruaur nu4aex  f3ilsfsDeau p u0areoiocoydlat lieils0 rtriopnudamenmieiatf rtax ont1tlxomoctad s uluvsnu4texoxr iodla rai slt)t2um(r3iudllt lfctat)artru  nu1tpeo fctytls ra(vsnu)aexrifctadla   ivilt setrimpoy1lpt miesl()s2tr(monu0oex  ieild m umumo;u0tltnxo3iydlm eaiesl( texrxo3oy1op e ncsas s2uru  no0apxniiciydfm rmn p;u0areoif ta1lm   ieolt)t2uoxrpiu1amt  fesls sDururp;t0opxnmietltfs ea( pnt4trxrmf ta1lmt li i s tetmio oy1lp   fvtls)aDuru oou1aetn octld s umumsn(0tetoxr io1laDrlu i;s  etoir oy1omtn nvtat a2rmxmpoo4tleo f3tysfa eln o;u0 eeomf3oadfpte u i s0trtr(o ou1olenmicsltfa2rmumpou4alxnmoetltfm um(vs t0alxnmfcoydlaDeai i;t)sruoxm3oo1omt  ivsls) Draumpoo0tetoioeiatfm ulnmp;t0tetrmr3tydfaD li o s  2um(opoodapee ncs sfsrrm( o;o0aee mi3tlsfm ul( s ()tlxoif ia1fm eai i;(0trurir3iy1ame  neil(fsrtmurpno4olx  ietadfm2eln o u4 lxnifcta1latr n i;()srtm(r iydapeelieia( aDtmxr nu0olto ociatfsDum(mo u)artoirctadfpt lnvs;(0t2umxr nudaleelfet tfarrr( onu4ope mictysls umu o;t0 eerxr tadlmt lnei t seto(m3iodlpee ici t srur(mo;u0oleoiietadfmDulnms t4trenmo3oydfaDe ivsls0texoir3iy1ll   ivtat aruaumpoo1tetomieiysls2rlnvp u4alenxr3iydoat  nvols0trxoirpoy1lpe lictas  2rmxmpnu4altomociltfm eln o t0artrmr3todfmtelivs;(0srtrim oodapt lnci t) 2rrxmooo1tlx mo3iat a emu o u) reoxo3ty1fm  aneol(0s2ur(o iy1optelivsat) 2tmur no4aptomietlsla em(mo (4tlxnmf3iodoptranvo;t0s2umxm3iu4ol elfvs ()aDraum ot4tpen o3tydlm2ranms u4altrmocoydlpte ivol(  exmxrpnydoptn fcta() Dur( ooo0aetomfcild s2rm( snu)tlxomoctytopte nvi s)sexoirpiy1oltemfcslt  Drau o;t0alt  fciydlsDuauvont) lenmf3iotlpDe nes;s) 2tmim3oy1am e ivs tfsDuaumpnu1opeo i3iat s elnmpnu) leoxf3oatfmDr ivilt)s2xoim3iu4al nlnct tfarrax  ot4tltnifetatlm2rm( snu0tetnmf3oodomD luei;s0teumxrpoo1ame lnetl()srumur ;u4oee  o3iltfs2ulu pnt4 eeoir oo1lat auvsl(0t2umxm iydlm nmietls) rur(rono0openmociadlsDranms t)tetrmrcty1lpt lieo;s0tetmxmpou4lm nlnvslt a2rrxmpnt4oetnmo3tlslmDeln s t4alenmr io1optrauvs t) euo(m oy4ol elfesat)arraumono0oleo o3ild a2eauvp;() ltomf3tatoaD ln i ()truo(m3nodaleelieia() ruru ono1tpxo o3tysfm emn on(4alxrio3ty1lm rluvi (0s2xo(m oydolenmfeia( arumxm ;u4apt mietld m2rl( s;t4alxnmf iatfaDeluvo;s  2xrxm no4omtnmfet () 2rax  nu0ale mi3iatla ua(msnu0 leoif iadlat  ieslt)s2xoio oodll nlicsa(f 2ua(  ;o1olxo ictatfmDelumon()tlenxo ty1oat lieol() ruoxo3nu1olt  icias)srumx  ou1aex iociydfm rmumonu0teenifctytfaDrlies ()srtrxm3iydol n nci ()aDurxrpou1alxoiicildlm ea(mp t0 exoio3oa1fatrauvo (0 2xrxrpny1lpee fei t)aDrmu o;t4tetoiicild a2ua( o;()teenir ta1omD  ues;s  rumxr3no1llee feiat srrax pnu1oeeomieils mDrl( o t0tlxrxr ia1fmteanvilt srum(o nodame lfeslt  2uaurpoo0olxo iciadlaDrlnmp u) rxrmf3iatfpD li s ( seur(opiodapen neiat)srtr( pno0opt  i3ilslm ua(vp (4tetrif iadlm rlu o;t teum(rpou1op e fvsas)a2rmumpot0alxomocilt s eau s (0aexnircoadomDelnvs (  eumim iodopt lncsas)artrxmono4opxnio3ils m2em(vo ()aleriociydla  lues;s0 2trir3no4lltnmics s  2rm(m nt4aex ifcias aDem( on() exomfctadopteau o (  rumxr3oodamenmfci ()sDtmxr oo1aptomoetadla2umn s;u0arxnif ta1lp  lueols)t2tmxm oydam elietat a2trx  ;o1aexomfeiasfa2rmu o t0 eenif3iytomte ueils) rurxr nu1ap e feil() 2ur(  no4tpxnmoctatfs ea( p;t)tetnif3oatla r uvo;t)trtr(o ny1ll  mfvs ( s2urumoou1apx  fcils m2ulnmp u4trtrxf iydoaDrau s s0srtoir3ny1lle mnesat) Dtaxm nu1olt mi3iaslmDrm( s (4 lxrmr tatoateli s ()s2umir3nydamtemncias arraum ;t1apxo fctld m2uanvo;t0 eenif ootfm eaivs;s0tetoio iy4lmt mivslt)aDta(  ot1oleomi3iltlm em(vo () ltomrcio1opDranvo;()texoxr io1llt  nesl()sDraxm ;t4aetnio3iatfsDraums u0texoircto1oa e neolt tetoio iu1ap emnvtat arumxrpoo1aex iieiadla eluvp;u)teeoxf3iytlmtelnvo;( t2um(o3nu1alee ieta() 2rmum oo4aexomfeiytlmDelnvpnu)aetoxociytoa  lnvo s teuoxm nodomte nei ( a2raumo;t4teenioeiytfa eaumsnt0trtnmrcty1opte nei;s s2xmim no1lm   icsltfsrrrur nt4oeto oetltfa ulnmp;t4aetrxr iotfpt auvi;()srxoxr oo4lp  licias sDrrum no0tlx mf3tydls2ua(vp t)arxnmrcoytlmDeaneo s sexo(r io4opeemnci (fsDua(ro;u0tex  fetytla ua(vs u0 etrmf3oodfatranvo s0t2uoiopny1opt lfvil(  rtrx  ;o4tet mfetldfmDrmu s;()aexnxo ta1op r uvo;s srtmio oy4am nlncsatfsrtmxrpnt0teeoio3tlsls eaums;t4 exoxfcty1om  lnes;()seurirpny4ap e ietat)srrrxr ;o4alt mi3tadla2eau sn() eermr oodla r ieolt0t2uoxm oo4lp   nci t srtm(  no1tpeoioeiyt sDrlu s;u)aeeoxo oo1la eaiei t)t2xr(r iu4lpe  ncsltfartrxmono0olxomfetydlmDra( o;u4trxnir iotomDeau s t)texmxmpiydal n nvtatfa2uau  no1teto f3ils aDua(mpnt4trtnxf tatlaDean s s srtmir iu4lleelictl(fsDtm(rpou0oee moetyd a2uauvp u)artnmfciodoa e ivi;( sexm(m3iudopenliet s) ruaumpnu4apenmieiydfaDrlnvo;t0altrio ootla r i sl() 2urir oudlpen ieiasf 2rmxmpno0alt micilslmDel(ms u)altomf tadfpteliesl( s2tmio iodom  mfviatfa2rrumont0olxoiiciatlm ua( on(4 exoxrcoatopDeli ils)s2uoxo3nu4op elfvtat srtrxr ;o0tleomfciasla2rm( p;t)trerxfctydlptraneols0t2uoio3nodol elicsl(farum( p;u1tptomo3iyslsDul(mo;t) exrmfcty1fmt aivil( t2ur(m3nodop emneilsfsDumxront4opxnmieiatfsDuaumo t0arxomr todom r uvs t  2to(o oydoptnmici ( aDra(rono4oetomfctyslmDrmnmp;(4 ltoio oa1omDeluvo;( tetr(r3oydlptnmfvtlt)srrmxm no0oee ifetasfa uanvo;t) rtoiocio1lpDr nes;t0s2um(rpnudolt  iesltfa2tm(  no1aeeo f3ildfs eanmp;t0altomf3oa1fatr uei;(  2uo(m3oydalt  nvi (fs2tmxmooo0aee  i3tys mDum(vs;()alenxf3to1fp eaies (0 eum(opnu4ol emfvtls)a2um(  ;o1aptomfeiyt sDul(mo;t4aetnifcoy1lateau s;t0texo(opio1optn fei ()sDtmuro;t4oeeomo3iat aDra(mon() rxrxrcia1laDrauvs;s0 etmirpou1omeemfcsat)s2umu poo1aexo fciysfm2rlnmpn()alxnxrcoytop rlneslt0setoxr iudoltnmnvias)arraxr nu0opeomoeilsls2umnmsnt)areomo oadlm  aneo;(0s2xoimpno1lp  mfcsat srtrx pot1oetomi3tys sDeauvpn(0trtoir3tadfmt  nvi;()setoxopou4aleemiet (fartrumpoo0tptn oeiaslm ra(vs;t)tlxnio3ia1lm r u i ()srxoir oo4om emfviat s2rru pno4aeto i3iyslm rauvp;(4aetrmf todlaDeaies () exmxm3no4omeeliesa(f Drr(mpot4tpxnioctat m ua( s;t)alxrxo3todoat an o t) exrxm3iy1apeemfvils) 2ur(r ;t0aetniietydfaDrau snu)trtnircoa1omteauvols0tetr(r nu1llenlfvsl( a2um( o;t0apxo ocilslm2ra( p;u) leoircto1lpDraieilt0s2toio3nu1lmenmies ()aDuax  ot1tlx mfciydlmDumu sn(0texoio iytla eanvs;t0t2uoirpou4altnmnvslt  2rau  nu0oet  feiyslm rl(vpnt4alxnio3tytopt  ueo;t)trxo(r3oudop  mieias)aDrm(ront1tlxomo3tltls2um( onu4tetrifcoadoa e ivi;t) etrxo3ou4ll e neiat srtmu pnu4tpen ietatfsDra( s u4tlenircty1fat  neslt tetrxr ou1amt lfeiat  rrmur ;u0optomi3tlt a2rlums;(4 ltomfciodfmDeai i;t sexoio3nudlm  mfvia()arua(r ou0oet  ieiydla2umu p;u0alerio oatfp   nvo;s0srur(m ou4lp  lnesat  rra(ronu0oet mfeiysls elnvo;()arxoxo oytlm e neils0 2tmio3nu4omenlicsls sDum(mpnu1oeto f3ilsls2raumo t) renir oodfm eai s;s)seumxm oy4lm elnviat) rua(rpou1aleoiieildlm2rmnvo u)aexrxf todlmDeaues s  2xr(m nu4om e fes ()sruaur ;u0oet  ociydfa2rm(msnt0aeeomr3totopDeai o;s0s2xoxm3ny4lltemnesl(fa2uauront4altn octytlm eaumpnt) lerxf totopDraivo;() 2xr(mpnudamtelfcslt s2ur(rpnt0apxn fctydls el(mpnt0 eeomr3oy1lpD li o;s  exm(mpnudol  mfvs (fsDuaumo;o4opx mocilt a rmn s t0tlerif ootfm   neslt  rxr(r oydoptemfcil(f Dumu onu0tlxo ietadla elnmp;t)alxoif3totlptrln o;( trtmxm nu4ale mfesas) 2ra( p;t0tlt  oeiatls2el(ms;u0texnxo iatfpDelivs;t0t2toirpoy1olee iesa( aDum(  nt1aee mociyd s2elnvo t)tlermfcta1fpt liesl(  exoimpiu4amenmnvsa() Drrxr oo4
\ No newline at end of file
@@ -0,0 +1 @@
+neo s seumxr3iu4omeemiesa( artmxm no0oee ii3iydla2um( pnt)trxnmo3oo1lm ran s (  rtmxo3iu4ap  lfcils  2uau p;o0aexn o3iyd sDrmn s (4trerio iadlat ln sls  2umxmpiy1ol   nvtl()s2rr(mp;t0aleomfeiadfsDeluvpn(4texoxr3ty1fmtr iesls0t2xrio nudlmt micslt srtmx  nu1oetnmo3tyd s eanmp;u4aexoif oo1la  lieils  exrxopiudalenlneias  Dum(  nu1tpen fetltlmDelumsnt4 reoxfciodlaDr nvo;s)seumxmpiy1ap   nei sfsDtau pnu4apxo oetas s2uauvp t)trxrxo3oadfa  an il()t2xo(m3iu1llt lies sf 2ta( pnt1apxn octlsla2el( on(0 ltomr oadom r u o;s s2xm(opiy4om nmnctas) Dtmxmp;t0oexn fcilslmDuanmo u4tlxrifciytoaDran i;s)trurxo3no4lmt miesl(fsrurum ;o0tltn f3tld sDum(mp;u0tetoxociatlmtr ieils s2trir3iu4lpte fctl() 2tmum nt4texomi3tad m2ranvs (0 rxrxr ootop raneo;t) rumim3oo1llee fci ( s2urxr oo4tltnmocias m rmu p u4altnxr3oytoat auvilt0 rumio3nu4lp nmfci ()sDtaumpou4tlxniictaslsDrauvp;t4 exnircoytla   nvo s seuo(o3iudolte nct () Dtr( o;u4aee iieiatfm2ua( o (4aeenxocoa1laDeluvi;t)t2urxo nu1omeemfcsls) Dra(rp;u1aex  oeiat s ul(vpn() rtoxo iotlpDelies ( t2xoxo3ny4lltemfet (fs2ra(m ;t1aetoif3iytfm uanmsnu0tltoxf totlpDe uvo;t teuoxo iu1openlfesl( aDta( p;o0tlxnii3iadfm ranmo;t) rxnxr3ootlaDr i s;(0trxoxo iu4amtn fvtltf ruau ono1tpeomfciyt mDean o;u0texrxo todfptranvs t)trxmio3oudam n ncil()s2ra(moot1tpe  f3tyt s uauvsn(4trtomo io1lmDrlues t0s2xmirpio1ll e icilt arurx  ;t0tlxnmoeiydlsDeaums (4tetoircta1lmD au s;(0 rxrir3ou4omtemivsl(fsrumuro;u4apx mictys aDelump;(0treomo iytoaDr uvi;() 2umio3oy1lptemietl(fs2rmxr ot1oeeo fciysfs ua(vonu0 lxnirctotfptrai olt0t2ur(o3no4lp e fctlsfaDumxrooo1tex iictad sDrlnvs (4 ltoxf3tytlaD aneil(  2xmxrpio1ameemicil() rtrxm ;o0aeeoifcilsls2rmnmo;(0tlxrmo3iotoatrlnvo t) 2umim3io1lpt lnvsas)sruaump;u1tlxnmieiyt aDraums;u)tltoxr3iy1fm   ieo;s) rtoxmpnudlme mivsl(  rurur oo0opeomf3iytfmDul(vo u0trenmrctydfateaiei;(0s2xrxr iy4ape  ieslt)sruaxroot0tltoiieilsfm rluvpnu) etrmocta1om eaies t0 eumim3ny1al  licia(fsDtrxro;u0olxoioeiytfa ul(ms;(0aexnmo tatomtr i s (0srxoimpio1lptnmnvsl()s2uau pno0tpenifciasfsDumnvo;u)alxniocty1lm   ivilt0 rxmxm3no4lp  lncsa(  Dtm(moou4tlxn ociyslmDraumo;()trenmf3to1lptrauvs;t trxm(o3iy1omtnlfetlt)arururoou0oetoifeiys sDemnms;u) exrxfctytop rau sl() etoir3ny4am nmnctas  2rmumpoo0ope  ietytfs2em(mp;t0treoxrcoo1fmtr n slt)sruoxm ou1lmen nci (  Drr(r ;t4tpt  fciyd a2rmumsnt0 exnmfciotlmD li i ()trxoio io4al n icsas  ruru oou4aeeoifeiadlaDumnvo (0 etrircio1fpDeli s ( s2xoim3iodamtnlfci ( a2ta(root4apxoio3tys mDum(mp;t0alerif3oydfmtr i i;t)trxrxmpou1lltemivi sfaDumxr nu0alx ifeilt a rlu s;u4alenmociotfpteli o s) 2tr(o no1llen icsl(  Dur(ro;o0texn f3iasfaDrlu p;t0alermo iytopteln ol(0 2xmxm3no4ol emivsas)s2rax p;t4tptn fciadfmDrauvo;(4 rtnif oy1oa eauei;t)teumxrpiu4apenlnes (f Dtrumo;o1tltoioctld m2ean s;t4aexrio3iy1fp eli o;s  2toio io1om emfetls)a2umx  ot0aexnio3ildlmDumn s;t)trxnxfciytlm  aiei;s0t2xmio3nydolt liet sfa2umx pot1olt mfciad m2raump u)tltrif iadlaDe neo s) exrxm oodop nlncils)srrru oou0apt moctadlm emuvs;u0tlenmfciatoaDeaivs t  2umxr3nu1lltemncslsfsDtmum ou4aptoii3tlslm ra(vp;t4tltrmo3oytopteaiei t sexmir3iu1alt  ncs t  2rrumooo1oltoioeils a2rmu o (0tetnxr tydlaDeai o () rtoxo ny1lptemfctasf 2rax  oo0tptnifeiltfaDem( sn(4trtrir3oytoa   u o;t t2to(o3oy4lm emncsas)s2um( p;t4oexnmieiyslm umump t0trtnmf iytlm eluvo;t trxoxm3oy1omt  neslsf rtaxro;u1aexnmoetatfm eanmo;()teeomf3iotfmDrlivo t0trxmxopny1ll emneta(  Dtaum oo4tpxniocild sDra(vp u)aleoxr oatomDe uvs;t0teuoxopio4altnmneta( a2tmu o;t4opx  i3tyt m2umnmo u0 ltnxo3ia1late nvilt)t2toxr3ny1ol   iesatfarrmurpot0aeto ociytfmDeauvpn(0aexrmr3oy1op rli o;t)seuo(o3iy1openlictltfsrrmxmp;o0tpeo ictasfsDraumonu4 exrxf3oatlmDean s;s0s2tmio iu4omeelivsa()s2ua(mpnu0tptn oeilsfsDemu s t4 lxoxocio1omD anvilt texmim3oy4altnmfeil( a2rr(m ;u0opto fctldfs2elnmo;t0tltrxf3iodfmtrlivo;( t2tmxm3nydaleemivtl(fsrurumo;u1opto octad a el(vs u0tlxrmo tadlptr ueols) rumim no4lm   nesas  2tau  ;u4teeo iciatfs2ranmo;(4alxnxf iydomD luvolt) 2tmxm3iodopee fvtat) 2rmuro;o4oeeomietytls rlnms;u4trenio3tytoaDelueo (0s2urim oo4ome  nvtl(farrmumont4openmoctytlm elu p u) exnxfciadlaDe i sls)s2um(r oo4apt lfeta(f ruaumoot4aexoiiciydfm ranmsnu4aleoxr3oytlmDe uvs;t t2xrir nu4am   ieiat srtrx  nt4apxo ictadfmDuau s ()tleoir3iytlmtr i s;()tetrxm nu1om  lfctatf Drrumpou0tpx ii3tytls2ulnmsnt4areoxfcoodlm  li o;t)t2xrxr3oy4ll   nesltfsDtmu ont4opxn feilt s uauvp (4tlxnxf3oodfmD auvi t setrirpoo1lm nmfctlt)sDumxrpot4aet  feiltfa2uanvs (4areoirciydfat  ivils s2urxr3nu4aleelieilt)a2urump;t4olenif3tldls2emnvs;(4arxoxfcoodlaDrlu slt0truoimpoudaleeliesasfa2raum ;t0tptnioetytfmDul(ms u)treomr3oadomte ivil()srtmxrpiodllt  fcia()arrrumo;u0tex mo3iad m2rmnvo;(4alermfctodfptranei;(0 2xmxmpiudopt  nvs tf rumumpno1tee mietatfm2ul(mont4 etomo iodoptelu ols srtrxr oodolte fvtas srtax  ;o4aeen ietadla umumont0 ltoir3iy1la  ln s;t0s2trio3oydlpte ics s)s2rrurono0apeo f3ias mDrmumon()alenifcty1fmtelu o (0trtrxr nu4om emnctls  Duaxro;o4teenmfeiytlm2ul(vs;(4trxnxr3ia1la r ues;t) rto(mpoodal nmncilt)aDurx p;t0alto oetldlaDrlnms (0 lxrxfcoy1oa raies;t) rtrxmpno1alenmics sfsDtr(m nu1ole ioetldls2umnvs;(0trxnxfciatlptr ivo s0trxm(m iudlm emfesltfs2ta( onu0opeoiociltfs eluvon(0tlermrcoa1lm e ivslt  rtoxrpiudlptnlfeta( artru ont0ope  iciys a2rln on()teeoifctytlp r nes ()seuoxo nu1lle mncsl(fartmx  no1tee mieiaslaDra(vpn(4alxrio oo1oat  ivs t texrxo3nu4omt mict t) 2tm(rp;o4alxnifciatls ul( p;(4 exnxrcootoate ivils) 2tm(opno4olteliviltfsDuau  ot1aptomiciydlsDuau s;u) eenir3tydfa  lnvs (0srum(o oydameelfvtlt sDtau oot1aeto f3tltla2rluvs;t0 lxnir oytfp e u i;t  rtmim ou1ape mneil( sDurxroot1tpe  ociyt aDulnms u0 ltomr3iytfaD  uei t)s2uoim3no4alee neiat) 2tr( ono4oeeoifetytla2em(msnu4aexrir3iadfptelnvo;(0 exm(opou1ape  ietl( sDrrum ;t0aexnmf3iyt m2ulnmp;()aetnif3oatomDr nvs;()s2tm(rpiodlptnmiet s)sDtrxmooo0oetoifctysfs2rm(ms;t4tlxrmfcoadoa e n ils0seum(o3ny1lltn nvi s s2taxr nu4alxoii3tldfmDrau p u0tltrif iydlp r n i t0 etoxopnu1optnlfvtltfsDrmumpnu4optoii3iasfsDeluvp;u0aeeomo3iatfp eauei t0setmxr3no4lmen ici (fsDtmx p;t4apx ifctas sDum(vs u) lxnxo totoateln ols t2tmxm3iudamt  nvia() 2rmumpou4aee mietatfs ul( s;(0 lerir iadfmt  n o t0 exr(m3iu4lpeemiesasfsrum( pno0tetomi3iyslm elnmo;u0 lxoxrctotop  ai ilt0 2xoirpio4lptemnetls  rumurpou0aee  icild aDea(mo (4texrmfciy1fmtr neil(  etoxrpio4ole lfci t  ruax o;t4tlxnio3ildla2rauvp (0alxnmr3oo1op  lueil( s2umim3ou1apt mnetas)arur(roou1opx mf3iytla2elnvo;(0texnio tytomDeaivilt  rxoimpnu4omen nvsat) 2tmxr ot1oltnio3iadfmDranvpn()tlxomr3tatfm raies;s)t2xrxmpny1amtnlicsas) Dta(  ;t1alxoii3tysfa eanvpn(0tleniocoodop   uvi;(0 rxrxr3oo1lpt mneils)arur(mpot1tpxn iciysfaDrauvo t4 rerio3tytlm raiesls0 rtm(m oy4lme lieia(fsrrmxmooo4tlx mo3iydlmDum( pnt0 exoiociatfp  aneols s2tm(mpiydlp emncias artmum nu1olx mf3ildlm rmn pn(0artnxo3ty1lp   u i s srtoxopnydlmt mfvtat) 2rr( oot4tlx  o3tlslm2ra( p u)trxoxfciatoatrlieil(  rtmxmpiu1lp   ncsatfsDra(mo;u1olto f3tasfa2eln o;u)aexomr3iydomDr u s t)s2tmxrpiu4optnlnvsas)aDta( o;t0apxnif3iysfm2uan o u0 reoio ia1fptrlnvo;t)texrxopou1ope lncil(fsrrm(  no0tex if3ils a2eauvp (0alxrxo3tatoat anes t0t2toir3iy4lm nmnvtltf 2raxmo;u1oet mictatfm rlu p (0areoxf oodoatelueilt)srxrio oy1lmeeliviasf 2umu p;u1aexn o3tad m2eln onu4teeoxf3oo1oa rlu olt)teumxo ou1alt lnctltfs2urx  nt0olt  i3iytfmDrm( o;t4 eeoxf iodfaD  neolt0t2xoxm3no1llenlnctltfsrraxm ;t1tex iietatfs elu p t0trerxr ootlmte n sls) rurirpnu1om  miet tfs2ua(mont0alt mo3tadlmDum( p;()arenmo3iy1omDr ivo;(0s2xr(mpiu4ame  ietlt aDrr(mp;o1tpt iietadfs2eaums;t0aetoxr to1fmtelnvs;s0teuoir3no1omte fvsls a2raxm ot1ale io3iat a eanms;(0aeeoioctytlm r u i s srtm(m3iu1llen icsatf rrmxrp;t0oexomietatfaDuauvo;u0 lxnxfcio1op  ai slt)s2xoimpiudolte nci sfa2um(rp;o1apxomfcilsfsDuln p;t)artnmrcto1fmDrauei;s) etmxm oo1om   icia(  2rrx ont0ape ifciyslm2ra( p;u) exoxfctadlptraies;s)t2urxopiu4op elfcslsfsrtrumoot0oee  ociyslmDelnvp;(0 lermf3todfp rlivslt s2trimpnodlme  ivia( a2rr(ro;t0tetomf3tadlm2rlnmon(0aexnif3oadlat lu il()t2xrxr3iu1ll   fetat)srta(rooo1olx mfeilsfaDranms;t0arxriocia1la rlivil(0texoim iy4apeemicslsf Dumxrp;o1tpt ifetlsfa ua(ms u)teenxf oydfptrln o;()t2umxmpoydlpenmicta(fsDraxroot4tetomoctydfm em(vo u)aeermfciadopDrlies;( srxm(o ny4om   nvslt)sDtmx pnu0tex ioetasfsDuanvont4 reoxocto1fp rlivo;s trum(m3ou4omenlnct sfsDra(mpnt4aptoiieiasla2ea(vs u4trxnxocoytlmD aivo;t tetmio iy4am e fvils) Dtm(rp;t1oet  fciysla2emuvpnu0 etomr tatlmtrlu olt0seum(mpio4amenlfcilt arrr(m ot1aetnifetadfmDrmnvp ()alenir3oodlp   iei;t  eum(m3ou4llenmfes (fs2rrxr nu1tet  octlsls eau pnt4aetomfciatla rln i;s)tetoxmpny1ap emictasf rrmu o;t0aetoifctys m rlump;t)tetoxo3iodfmtrli il() euoxr oo1ole lfvtls)sDur( p;o0aex mfeiadla2rl(vo u)texrio iatlmDr ieo;s)teto(r nydapeemncias a2rrx pot4tptnmf3tyd m uan o;(0 ltrxr3iy1lpD an s;t0 exrirpno4ol nmfei ( aDumu onu1ale  o3ilsla rl(mon(4aexrif ta1fm elnvs;(0 etrio iu4lpeemfesatfarrr( o;o0oetn i3iat aDrlnms (0alxnxociydla r ieil(0t2xrim iu1lpeeliet t  rtrurono1tlen fcias s umn on(0alxoif iodopDeaivs (0 2toxm no4amenmfvs tf Duaxr nt4teenmi3tas m2ua(vsn()tlxnxfcoodoatr neo s0trto(m3oy1openlneslt)sDta(rpou1tpxn ieilslm2um(ms (0tetrxr3oytlpt ai o;s) exm(r3ou4al e nvi t)sDtauronu1aleoioeilslsDua(mpnu) exrxrctytla raueo;( seur(m ou4olenlfvt (f Dtrxrp;o0tpeomfeiyt a2ua( o u)aeerir iydfaD  uvo;t0 exr(opou1lptnmivt sfaDrax poo1tpxoiociytfa2elump;t4aetrio oodfmD  ieils0 rxr(m nydal nlnvs s) Durxrpot0oexnmieils m eln o;t) eenio ta1lat li sls)trtmim3ou1ll e nvilt s2umxrpoo0oeeo ocils a umuvpn()alerxf3iatfmteanvolt s2urxopnu4llen nei t  Draum nt0ope mf3tasla2ua( s t4 rxrif3ty1fmt ai sl() exmxr nu1omee ivsl(  2ur(  ;o4apxn f3tlsfa2uluvont0alerifcia1oa elueo t srurxm ou1apt mfvsl(  2uaumpnt4tlt  iciadfaDra(vs;(4artoir iy1fm rlneil( trxoir3iudlmeelieils aDur(m nt1oex io3iyd s2ulnmp;u4 lxnmf3iodopDrln s;t srtm(o ou1amt  ivs (fs2ur(rp;o4oetnmo3iasfs2uau pnu0 etrmociatomDrauvilt texo(o iudlpe  nviat)sDta(moot0alenifetldfa ean p;t) ltrmf3ta1omDrluvi;()srurxr nu1om elnet (fa2rm(monu1tex ii3ild s uluvont) exrmoctodomteanei;( texo(m iudamee neslt) rraxr ;o4alto feiyt m2rm(mp u0teenxf3tadlmt  nvi t)tetrio3iy4ap emivilt) 2tmuronu1opxnifcias s ra(vs;u0tltrxf3iydop ranei t0t2urxr nu4ole lfvtltfsruau o;o0tptn ociysfm uanmp;t4aetrirciatlp eauesl(0texr(m3oy1ll n nvtl() rrmxrpno1tet mfcildfmDranmo u)aexrmr iotlpte n olt sruriopny1ale mfcia(fs2trump;t4teenioetltla ul( s;t0 lxrif3iydlaDean i;t)s2xoio ou1opeemnctatfsDrrxmp;u1tpxn iciydla umnvp;u4alxnif iatfaDeaivil(0teuoimpnydaptnmnvs (f Drmx p;t0oeeniocias aDuanms;(4altoxrcoadfaDe i o (  etm(r3nu1llee fciat  Dur(root0olxomfciat a2eluvs u4 reoio3oydfp raueolt0tetrxr ny4olenmncsasfs2tmump;o0oexoif3iysla rlumo;(0 rxomr totoat auvs s0setrir ou1lpt lnvi t sDtm( p;u4tetn fciasls2rluvo;u0alxoif3ia1fat aueo;t trum(m3no4lpe  nes s) rtmxmoot0tleo o3tltlaDulnvp;t4trtomf todfp elivo t0 exrxopnodlm elieiat) 2tax o;o1open o3tys s eanmsnu0alxnmr3ootfmt  uei;(0 rxoxo3oo1oltnmfcia(  rraur oo4oetniiciysfaDeluvsnu4tltnif3totomDeaues ()trum(m3oo1oltemictat  2ua(r no4teeo fciltlm2uanvp;() lerifctotfa eln il(0srtmxm3nu4ole mnesa()s2trx ont1alenmo3taslm eanmsnt4alerxr3oydop r u o;t)seurxm nudal emnet (faDrr( o;o4opeomo3iys m ra( snt4 rermf oodfmtr u o;( seuo(mpiu1lltn fetls) Dtauronu0aptniiciat s2emu s;() rtoxf iy1opD an i s) 2trxr3iudamtn fesatfsrua(mpno1tetnmi3iydlm umums;u4alermf3iy1op  lnvo s) exoxmpio1op e nvtls)arua(  ou4aptn feiydfaDrm( snt)treoxrcoytomDeluvo;( t2xr(rpiudlm   ivils) 2rmxrono0tlen feiatfm ea( p t4altoirciadlaDelueol(  etr(r oy4om n ncta(f 2rr(mpnu4aee moeilslm2emuvo;(0trtnmo3todlm r uvolt)setm(rpnu1lpe  nvtltf rrmxmoot0opxomieilsls2rauvs () lenmfcoy1oa ranes ()s2tm(m3oydlmeelivsas)a2trxroot1olenio3tadls2em( p (4 rxnmr oodlmD  uvo t seuoxrpnu4ale lfci tfa2umxmpot4opxn fetltla rl( s;t4tetoif3oo1lpD lnvsl() eurxm3iu1lpeemnviat  2uaxrono1oltn octls s um( on(4alxomocta1om rli o;t texm(o3iy1olt mivtls)a2tmumo;t4oex micils m2raumo;t)artomr3tadlpDraieo t) 2uoir no1aleelict s aDtaum nu0aptomiciytfm2emu snt) ltrxo3iotfm  anvslt)tetr(opnudlp n nvt ()srtm(rpnt0oltn octlt m2umnvs;(4 etoiociodfmDe u sls sexmxo ny4apen ietltfsrraxrpou4aex  icildlm rmnms;(0 ltnmrcoa1omD ln i;( teto(mpnodam  mivi sfsDuaur oo0ape  o3iltlm rmnmo u) ltrxfcia1fm   ivo;( t2urio3oy1olt mnesasfaDtm(monu0oexomo3iatla2eln o t)tlxnmr tadfmtrlnes ( t2xmxm3oy4ope mnvs sfa2urum oo4teto i3iyt a2rmuvo (4trxrxr iadop r nei;t s2toio3nudlle mncsat aruaur oo1tptomfeiaslaDuluvo u4tlermo iydom  luei;s)t2uoirpiu1lme  fcsasfsDtm(mpno1oleo ieiadfsDeln o;t0aeeriocoadopDeli sls) 2trxopoy4omtnmics (fsrraumo;u0apx ifeiyd m ea(vp (4 rxnmr tadlmDr uvi t0trtrxo3nydop  mivt (fsDrm(mpot1tptomo3ild mDrm(mo;u0tlxrmocoatlmD aneo t0 2trxo3iodlltnmict (fa2uaxmoou4tpe  feiydlm umnvsnu0arxomfcoodoa  aneo;s  etmimpno4altemnesa() 2ua( p;u1aexniietytlaDeln snt) etnio iytomt liei;s) rxoio3iy1lm e feils aDum(m ou0tlxn i3iatls2el(vpn(0 leoif oa1fmtelnvslt) exo(o3ny1om n iciasfs2tr(  nt1alx mi3tydls rauvp () rtnif iy1op  li s t srxmxo3nudopen nciltfarum(mont4tpe  f3iydlm2el(mp;(0trxrmf3tydoateaieo;t0 rxrim ny1openmfvs (fsDtmxrp;o4tltn fctltfaDeln p;u0altnxr3oa1opDr ivo s)s2xmxr oy4aleemiei tfsrtaumpou0texnifctat aDranvo;t)trtrmr3oydlm  ln o;s) 2umir iu1lpt mnvi s) rtmx pot0tet  f3iysfmDua(mo;()trtrmrctodom r ivolt0s2ur(m3iudapeelfetasfsDtaxm oo4tleoiieiysls2ul(vo;u) rtnmfciatlm  aneo;(0s2urxrpno1op emivsa(faDra( oou4tlxn octad s rlu pnu)trenxo3iadlmt lu i;s  rumim oudllenlnvias)arrrxmo;u0olen feiasfa rlu o;t)arxriociodfptr u ilt0texrxo3iodllteliet s) 2um(mo;t1tpe mfeiytla2uauvo t)aexrifcoo1fp e i il(0 rtm(r oodllt  ivs sfaDum(moot0opx mietld aDuauvp;() eeoxo3iodoateauvi;s srumxmpiu1lpt mivsat aDum(  nu0alx  o3ild s2ea( p u)tltoxrcto1omDraneols) etr(rpoy1op n nes ( arrau  ;o4oexoiietls m ulumpnt4texnxfciy1omtrauei;t0teurir nodlp emfvi s  2umum oo4ale mo3iasfsDul(vp;u0 ltrxfcoodla r nei ( sexoir iydol emfvi sfaDuau o;o0tlxn fciytfm2umu snu) rtnmo3oatlm   n i;s  2urir nu1ol n nvslsfsDrru onu1aex iociydlmDuau p u)areoxf tadlaDeaies;(  exo(m3ou4ale mnctls sDrau  ;o0opt ioeilsfmDemn pnu4aeeoxociy1fp   uvi t)t2xmirpio4amenmfvt t  rumx p;u4alenmfetadla2ra( o;(4trtrir3oadfaD  iei t0 etmxm3iy1om nmneia(faruaxroot1alt  ietat s eluvs ()tlxoif iadlm elu o s)s2um(o3nu1lle lnvtl(faDtaxront0apt ioeiysla uau pnu4tetomf ta1faD auvols0t2xo(opnydal  livt t)srtm(rp;o4oetn f3ias a2umu onu4 rtomfctytlmt luvs s)tetr(r3io1am nmfvsltf Duaxmpot4olx mfcils a2ua(vpnt0texnmrcia1fm e uvs ()sexo(rpoo1llee nesltf Drrumpoo0tptomicilsfm2eanvpnt0 etnxf iytla elu o;t0t2xo(r nu1oleemnctat) ruru  no4altnmoctls a2uau s;t) etoif3ty1laD  i il()srxm(mpoy1altnlncslt)arrmuront0oleoiictltla2ranmp () lxnirciytoptraues s  etmxmpno1ol e iesatfsrtmumpoo4olx mfeiasla ranmpnt4aeermoctytoaDr ivil( t2umxrpny1alt mfesas)aDra(m nu0aet  fcildfm elnmo;t)artnmfcta1lp r nei;(0t2uoxrpoydam nmieils  Drm(mp;u0tee ifeils s um(vsnt0trxoxf3tytoateluei t teurxm3oodlpe  fcta(fsrumur ot0tpto fetytla2ulu pn(4 lxrir3oytop eauvs;s0tetr(rpiy4apt lnvsls srtaxr oo0oex mieilsfs2ulnvs (0arxoifctodfm eanesls0 rurio oodaltelfvi t)arum(m oo0apt  ieiadfs2rauvs t4texrmo iatfptr uesls)t2xm(opiydlleemncsasfarrm(rpot4oexo ieiysls2rauvs u)artrmo oytlpD au s;(0teuo(o3iodomt  fvsa(  rta( ont1apto feiltls2rlu s;t0alermr3ia1faDeanes;t t2xmim io1lmte feiat) 2umx pno4tlenifeiasls elu s u0tltrmo todfp eli ols texr(o iodoltn ivslsfsDtm(r ou1apenmf3ilsfm rlnms t4 renmo tatfa r u ils  etrim3ou1aptnlfetl(faDrrx ooo1apenif3tytfsDeau pnu0tlxomo3oadfatrlnes;s0 2xm(m oy4apenlicsat)s2ururpnu0texnmiciltfm eau s t)aleoxrcio1fmtelivs t)srurir3iu4al  mnvt t)s2tr(r no0aee  f3iltlaDum(vo;(4 lxrio oa1fpt ai s s) rxoimpiydope lici ( arraxmp;o0opxn o3tysfmDra(ms t)tetrmf io1faDe ieo;( texm(o3ny4op nlieilt)aDtaxr no0aexomieilslmDel(mo t4artomr3oydlmDrlneo s0 2xoim oy4oltnmfcil()a2ra(mpot4tpeoifctatla2rm(mp t) lxrxf iydfaDelivi;( setoxm3nu4lmenmfvils)s2rruro;o0opto feiydfa el(ms;()trtrif oo1fmtr ueol( s2xo(m3iu4ll nmiet ( a2uaxmooo4tptnifctldla rmn sn(0artomrcoadla rauei t0trxoxmpnodlmt  ivsa(fartrxrpno0teen feils s ua( p;t4tlenmr ta1faDraivi t  2ur(m no1ap emfet (fartax pno4tpx  o3tysfm2em(vp (0 ltoxf3io1la r ues t0srtmxm3no1lpenlnvt () rrm( p;u1opeoiociatfmDem(vo u0 ltrxr3iotop   uvo t)trum(o3io4aptelnvsasfsDrmxroou0ale  fciatlmDel( o;t0 ltnxociodom rln o t0 2toim3no1lp  lnesa(f rtm(rpno1optoioetytfm ra( pn()tlxrmf ta1oa  lnvs;()srtrirpio1lpee fctl( srrrurp;o1oee  octltfmDulump;()alerxfctotopD  uvs;t) rto(opoo4aptnmncs ( artr(  ou4tpeoif3iatls2ua(vs (4arermociodfp raneol(0 rtmxo3no1llte nvsatf Durumont1aleo fcild a ra(vpnu0tetomr tytlpt anvs;() 2xmxm3io1amt mnvt t  Dtm(mp;t1aet mociatlm rm( sn(0 exrir oy1fat liei s)seuoimpiy1lm nmfcias)s2ta( pou4tet ioeilsfa uluvp;u0 rxoir oydfmtran sls)trtrio oydlmtn fviat)a2uru  no4texn octldla rmumsnt0 rtrmr3oodfpDraueol()s2xoxr oo4alee fctatf Durx p;u0alx  ieiad a2rauvo;t)aetomo3oatopDrlieo t0t2urio ny1ap e fvsa()a2tr(  ou4tpt io3iyslaDrau p u4artrio ty1op e ieol(0sruo(m3iu4llt mnvi s  2rmuronu0altnmfciltlaDulnmo ()aeerifctatlaD lneols0seumxo iu1lpt  ieta()s2rruronu0tlt  i3iytfa uauvo t) lxoxocto1fptrluesl(0 2tm(m3iy1omt lnvsatfaDurum oo0optnif3ilslaDemu o t0 lxoxr3ty1oaD  u o;s0t2tmio3oo4al  mnvtlsf 2tr(mpot1ope io3tasla um(vs t0 lxnmf tatoaD an o;t  2toxopno4opte ncsltfsrurxmo;o1oexnmf3iysfa emnvp u)tlxoiociydfmD auvo s0 2xriopnu1lpeelfesl()sDrr(mpou0oltn o3ilsfs2eanmp;(4trtrio3oydomtelnvi;t0trtrxopio1oleemfvi t)srtrump;o1tpxn fctltfa2emnmsnt0 ltrio oodfaDr u s s)s2umxr3iudll nlnei t  2umu pno1altnii3iydfs2umnvon()aleoif iy1fpDrlu o ( trtrxo3oudaltnlies ( a2umxront4tee mfctyd aDum(mo u4aeerxf3totlpDeai s;s0s2xoimpnu4lpe lnciat)sDtaxm ;t0alt mieiydfsDeau o ()artnxr3oodlm e i sl(0t2tmxr iodlmtemnvia( aDtmum nt0oexoii3ildlm el( o;t)trtrmf totoatrau i;t0t2uoxmpnu4lm nlivs t artr(r nu1aeeoioctysfa ua(mp;t4aleomr oodoaD  uei t srtmim oo1apt lfctasfarrmxm oo1tlxomi3ils aDran snt4trxrxrctydlat lnvo;t0trurxrpiodalt  icsl( s2raxmpnt1oexoiieiltfsDrlnvp u4 eeoifcoa1op  au ols srtr(m no4opeelfes () rtr( o;u1olxomo3ils mDrmn s u0 ltnmfcoatlp   ieolt)sexoiopio1lpeelicsatfaDrm( o;u0ale  iciytfsDul( snt0 renmocoo1fatr nei ()sruo(rpnu1oltnlfci s) Drmu ono1aex mfciytfa2ulnmonu4tltrir oatopDe i ol()texo(o3iu1lp  lnvtltfaDrm(m ;o4tleomoeiatla2uauvp u0teerif tatfp e i o s  2xrxo ou1om emfci tfsDtr(moou0tpen f3iad sDeauvp (4tetrirctytla  auvo;t)s2xoim oo1altn nvs ()s2uaxmono0tpxn f3tas a2uan o;t4tlxoiociydlaDran s;s t2xm(mpiu4ol nlivsa() 2tmu oot0oee mietasls2rmums (0arerxr3iatlm  aivi;s) exo(rpiu4llenmnvsls)a2taumonu0aetoioeiydlmDum(mont4treoxocoydomt  uei;s  rtoio3iudlpeemfvs t)srrrur ot1opxoif3iltfaDelumsnt0 exrmo3iadfatr n o;()sexm(rpnu4optemivtltfsDrmxm ot0tlxn f3iysla2rm(von()alxoxr tydlpD lnvi t) rxm(rpiy1apenliet (f Draumpou1tptnmf3ildla2ul( p ()tleriociy1fmt aueols0 2trxr3nudol nlfct sfsDrauro;t4tex mi3iatla2rau o;(0tltrifcoo1omDe ies t  eur(m ou1ll  mnvsls)arrm(moot1apxnmoeildlm2elnvsnt)trxnircoy1opDeai o;t t2trxm3no1ap  mnes ( sDtr(m ;t1aeenmf3iasfsDumn p;()arxnmoctydoatr i s;s) 2xo(o no4al n nvtlt a2rmxm ;u0olx iieilt s eauvs u4tlermf tytom ranvs ()setriopou4altemivsasf 2rmxr ;t4aexn icils m2eluvonu0aetomo3iatla r uvilt  2uoxrpoo1lmeemnet ( artrxm nu0alen iciydlaDeln s;u)trtoir3iy1lm   nei s0sruoir3ny1op elfctat  Dur(  ;t0aexo fcias m2um( on(4aetoio3oydopte n sls0trxr(r3iudop emiei t) ruau p;t4opeo ieils mDem(vo;t4 exoxr tadfp r i i ( s2xmxopiudlp elivsls)artrxrooo1oee moeils a eauvont4altrxf to1fm raneilt0srtrxm3ny1al nmfcs t) rtr( p;t0aeeniicilsls rmumsnu4altoxr3tatomDrliei;t0teurxmpnodal  mfeslsfaDumx  ;u1open f3iytfm rl(monu4trtoirciy1opte uesl( trtmxopiy1llenlictas)artrur oo0opxo o3iysfs2rlu p;u0artnxf oadoatelivo;t0truoim3oy4om n fcia(f Drr(r nu0opxoifeils s2elnvs t0teeomoctotlmteli s;s srtmimpiu1ale mnvtlt  2uaxrp;o0tlxo o3tasla2rm(vo;t) etoxrcoodlmtrau s;()seumxmpoudlltemnes ( arua(r ot0apeomo3iad m2rmnvsnt0trtomf3ta1laDrln slt t2um(r3iy1alt mics t a2tm(  oo1tpx  ieild s2rl( p u0tltomf3iatfaD aiei s)texrim oo1lltelnvilsfarrax oou0open feiys a ra(mp;(0 eermf iydom r uvs;s t2xm(r oy1ole livsatf rtrurp;t4aetnmieiatfsDul( ont0 reoxo3tatop rlueo;s0sexo(m iu4lpte ict (fa2rmu o;o1apx mi3iltls2uanms (4 lxomo tydfat au s t srxrxopiy1lm nmivt ()artrump;o4alxnif3iad a2ra( s u)tltoxrcoytlmDr neo;t)seuo(rpnu4lltnmfcil( sDtru oot1olen iciadls2el(vont) exomf totopteln ils trxoir iu1am  livt (f Drmx poo1oex  fciyd s2rmu p;t)aeerxociytfp eauvo (0s2trirpny4llen ivsls srra(mpoo1tlxn o3iyd m2rmumon()alxoxr totfmt  uvs t)trtoxr oudale mnct t) 2raxm oo0tex  i3tytfm ea(mo;(4 renmf oy1lp   i slt0t2tmxr iydamte nvsat)s2tr(  ot0apxnmietasfmDrluvp;t)teermoctatfpDe i o s) euoxm3nudal nmivi ()s2uaxmoot0tpx  octlsfs2rm(vp t4 lxomf totfat  ueils  rurxm iydlmt lfvt tfsrtmu oot1oetnmfetydfsDraumonu)altoxr3to1fpDe ies;(0srtmirpoodale mfcs ()srrm(  oo4tleoifcildlsDemu p t) rxnxr iatfpD lu o;( srumio io4llteliet t) Drm(  nu4apx ioeild sDuauvs;t0aeermr3iytlm  anvs;( t2urirpiy4altemfvsl()s2uaxro;t4aee io3tysfm uluvp;t4aeerif3totlm eau ils s2ur(opno1ll nmfvtatf rrmur oo1olenioctls a2emuvo;(0tetoio iy1fat ai s;t)s2xoir3io1apen fvtls sDrmxm ;t0oexomieiysla ul( ont4 lerxfcoy1lmteanei;t)srto(opio1omenlivi tfsrtax ont4apeniictatfmDrm(vs;t4tetrxf3iadfa e u ols)t2xrio ny4ol nlncia(fs2tr( poo4ale mfciyslaDemumo t)aexrif3oatoat  neo;s0seum(r3ou4apt mfcilt s2rmurp;t4aleomfetldlsDrmums;t4trerircto1omtrlnes;( teumxrpoy4ll elnvs s)s2ra(rp;t1alx iocildfaDrau p t)teeomrcia1oatelivs s0s2xrirpiy4amt lnet s  Drr(moot0altoii3iadlm2rmu o (0 exomrctotomt  iesls) rxoiopiy4apt  feiasf Drmumpou0olx  oetat a2eanvs;u4aeermociy1latrlu ol(0 rtmxmpoo4ap  lici sf rumxmpou1opxn feiltfaDul(vo t4tlxnir3tytom   uvsl(0 rurim nodamt  fvsl()s2rmxm ;t4optoiociatlm2rl(mp (4arxnmo oo1fpt ai i s)s2to(mpou4amenmfcsltf rtrxrp;t4alxoifeiysla raump;u) rxomf3iodlpte uvsls  etmir oudllt mncsl() Dua(rpnt1alxnmoeild m rlums (0treoio tadop   nvo t)s2xo(r oo4alee fvs s a2tru pno0aex ioctlslsDrl(msnt) rxrir todla eanesls trxr(rpiy1apee fetls)srtrurono4apeomoctytlmDra(mp u4arxrxf3oodfm rai s;( sexoxr3ny1aptn neia(fs2uax oou0tpeo feiysla2rmu onu0artoifciatfaD au ols  etoir3nudaltnmncias artrx  ;t4alx micias a2raumsn(0 rtnxr3tydomteau o ( trtm(m ou1opt lnvi sfsDrm(rp;t0apxnmieiyt s uau pn(0 exoxfcto1fpD lu ilt texrio3io4ol  lfvs t)aDtmump;u1tetnmfciasfaDran pnu4trtrirciytfmt au i () 2uo(mpnu4ole  feilt)sruaxm ;o1ole  octytla rmumsn(0artrmo tydlpt lieil( trxrim no4lm nlfvt s)a2ra( poo1oetoifeiyd s2eanmonu0 lermrctodoatr ivol(0 rxrio nodlmtelfctl()s2tm( p;t0olxo fciyd s rmu s (0alxomf oadfa ranes () rtrimpno1ol nmiet ()s2umu p;o4oee iietyd m2ra(mo t0aeeomfciytlmtrluvo t  rurxr3iydom  lici s)a2rrx pnu1alxnmiciyd m ua(vs u)trenxr3ty1oa  lu i;s0 etmxo nu1omt  ivil( a2ta(ro;o4aex ifctlt s2ra( sn(4trenif iodoaD aivi;s0trtrir nodap n nesa() Duaur ;t0tee if3iad a2emu p t4areomo3oa1fa eai ilt0s2xoir3ou4ape miet (fsrta( ooo0tle mfeils m2ra( on() reoxf3iy1oa e n s;s) rum(m3io4lp n fvi ()artrxro;o1alx  ietlslaDra( pnu0 leomo3ia1opDe neo s sexmxo3oy1lmt  ieilt aDta(rpnu1oee  feiadlmDem(mpnt4arxomr3iotfmDr n o s  exoxo iydop   ivsls)srtrxr no4alxoiiciasla2emnvon()tetrmfcia1opteauesl(0srtoimpiu4alte nesatfs2tm(mpno4tpeomf3iyd m2rluvpnu4tltoir ootomDrlivs;t0sexoim nudom nmicsa( sDumump;t1aeeomoeias m2ua( on(0trtnio3iy1fmtrauvilt)srxrxopou4lpt mncs t)srta(rpno1oeeoiieiltfm rlump;t4alxoircoytop   ues (0tetrxmpnu1omtnmieilt)srum(rpno4apenio3iad m el(vp;u) rtnio3ta1la eaiei t sexrxm3io4apenlivils  rumumonu4tlx mociltfs2rm( p t0aetrxr3ta1oaDeli i;( srtrim iu1lpee ivt sf 2raurpnu0altnii3iatlm2ulumpnt)teenmf3tydlmD aneo;() rum(r ou1altemnet (fs2taxmoou1aptnmocilsfa2ua(mo;()texoxo iytlp e ivo s0teurxo3nydoptnmiesl()aDrmx  ;o1aeeoii3iltlsDum(mp;u0areomfcio1fmtraivols trum(r ou1op  mnct tfa2tau  no1aetnmoetltlaDelump ()trermr oytlmDe n slt0s2trxrpou1ll e ivs s)srrmu  no4aexoioeiasla rmnms;u0 rtomf io1omtrauvil()trumxrpoydol nmfctls  2taurp;t0tlto i3tadfa2ul(vo;u4 leoxo todlptraivol()texo(r iydamt mieias aDtrumpnu0alxniieiat a2rm(vsn()arxoxr3tadlp  anvi t) rtrirpiy4altemivil( sDuru  ot1oetnifeiytfa2eau pnu0texomo oy1fatean o s0t2xoim3oy4altnmfesl() Duaur nu4tpt mfciytla rmnvpn(4 etomf tytlaD lu i;s0texr(rpiu1ap  micil(fs2tm(  oo0optoiietadfsDrmnmp;u0aetnirctadlatranvi t)trum(m3io4ope  nei ()sDtaumoot4tptn oeiatlm2ea( ont0 lxnmr oo1lmDrlnei ()srtrimpoo4ol   fvtl( s2rr(  oo4tlxo ieiasls um( s u0 lermoctydfaDeaivs s0sexrim oo1lltnmivta(f Durxrpnu4ale mf3tytlsDelnvon(4teeoxr oa1lp  anvs;( s2umio3no1am nmfcsltfa2tax p;u4opxn ietatfm2ulnmont4alxnxocia1fpDrauvo t  2uo(mpoydlmen nvsat)srtmu onu0tpto ocild m2uanvs;u)teenir3oydomtelnvi;t  eurxr3oo4apte ietlt)a2ta( p;t0apxn i3ildfm ua(ms;t4aeeomociatlp e iei;(0texr(r nu4omee net sfaruau  oo0tpto feiytlaDrluvs (4 rtnmr3oatfp e nei t0srxo(m3ou1amtnmietatf 2umumoot0tex mfeiyd mDuln p;(4trxnmr oy1fpDrln sl(  etmio ou4alt lieta(fa2rr(ronu1opto oeiadlm2el(ms u4tlenio3iodoatraueil()teuo(r3nydomeelfciasfaDumu  ;t0apx  ociydfmDum(vp;u)arxrmrctadlate ueo t0trumxr oudop elnvtas artmxm nt1oleomfeiatlaDumu snu)texomfcto1fpD luei s) eurxr3nodoptnmncsa(  2rmxro;u0tlxn oeiysfm2ean p;u)arxrmrctodop e ieo t0 ruo(o iodameelfct ()sDrr(m ;t4olen feiyt a rl(mo u0artoio to1faDrln i;(  2toirpnu4olt lnetat)s2tm(monu0oeeomo3iltfaDrl( s;u0alxrxociy1lm  aneilt  rxmio io4ope mnct s)arua( oou4tlx  i3tatlaDranvonu4teeoxf3oatoateai o (0 rxoxopiu4omen fesl( sDurxrooo0ale ifciad a elu o t4tetniocio1fa rauvs t)teuo(rpou4am e fcsa()sDrmur ;t4aptnii3iys s elu onu)tlxnxrctodomtrai i;s)srxr(mpio4amen ivta()a2rrxmpnu0tltoiiciyt s2eaumon()aeenmfcootoaDelnes s0trxm(opiodal e fcia()artm(mpoo0tet moctltfm2uln o (0 leoxoctadfmDr nvi;t)setrim3iu1ol n fetls  rum(roou1openio3tydfs rl(ms t)trtoxfcto1opteanvo ()seum(r io4ll nlfctlt)a2raxr ou1aee  feiysfsDrluvo;u0teenmr iytfp rlueo;t srtr(r iodlptelfcs sfaDrm(mpnt0tpt mo3iatlm2rln p;(4tltoxr iodoa e uvolt)t2xr(m3nydapeemfeiltfsrtaxm ;o1tetoifeiad s uln pn(0altnmf iotopDeli i;s0 etoxm oy1lmtnlivi s)aDtaur oo1aeeoioetltfs2uan onu)teenmrcty1lm eanvols s2uoim3io4lptemnvi sf rrrxroou4alenioeildls umn o;t4tlermr to1omD luvils s2umim oydaltemfetl(faDra(r no0opeo o3tytfsDemumo u4teenif iotfpD lnvs t) euoxo oo1ol emncsa( a2ua(m ;t0tpx iictltls2rm(vonu0aetomr ia1fpDe ies;t0 rtoxr3nu4om elicsl( s2rau  nt1apx  octlt sDemu ont4tlxrmo iotomtrlu il(0 euoxopnudllt lfcslt  Dtmumoot1opxo f3taslmDrl( o u) leoif oo1la  aueo;(0tetr(rpiu4omenlfcs ( arurxm oo1teeo i3iyt sDulnmo;u4teeoiocoo1lmt lueo;t0 2trir3iy4lp elivs ()arta( p;o1tpx ifcild a rm(mo;()trtoir ootlmD  n s;s  exmxm3nu1alenlfvtl(f Drm(m ;u4oeeo fetlt a2elnmo;t4alxrxo3iadoa rlnei (0t2um(mpiudlp  lneiat)srrru  ;o0oet io3ils a umuvo;t4 rtoxfcio1lmt aueslt setr(mpnu4ll nlictas) rtrur ot0oexo f3iytlaDra(vo;t0 lenmr3ta1lmt aneslt s2urxo ny1op emiesltf Dua(root1tlxoiieiad a2elumpnt0artnxf ty1faDeau sl(0t2xo(o3oy4am emnctat)s2ua(m no0apeniociatfs2uau s u)trxomo3io1la rlnvs;t) 2trxmpiydop  mfetlt sDtmump;o1alxnmf3iltlm el(msnu0trtnif3oodoa r ieo;t  rumxm no4ape mfvs s aDumx ooo4aeeo ieiyt m ranvsnt) exoif iydfat anes;t srtm(o3oodlleelietl(f 2tm(moot0tlxo o3tyd m eln p (0 eerircta1lpte nvo;s0t2tm(r3no4ol emies sf rumx  nt4tpen fetytfs rl(mp (4artrmr3todfmDeaueo s)srtmxrpoo1ope  nvsl( arrm(m oo4tlxnmo3tlslm2uau o (4tetrmr oy1fatelivo;t)t2xmxo3oydopt mfcsl(f Dtm(mo;t4tltnmieildfs emuvonu4altomf3totfm elivo;s0 rur(rpnudol n nviat) 2umx p;o4opx moeiysfa ean s;t0arxnxo tytlmDeau ils  rurxmpoodal e ictl(fa2urxmo;o1tex moeiltlm eluvpn(4 rxoxf3iytlm   uvs t t2trimpny1op nlfeilt  ruaxm ou4tet iietytlsDelu s;t0 lenmr tadla rln s;(0 2xr(o3io1lltnmneil(  rumu  oo0aexo o3iatfsDeln s;(4 etrmo iatlate n i;s srxrxo no4am  livtlsfs2rax  nu1oet mi3iydfmDrau ont0artriocia1fp e i ols)t2um(o3ou4om nlici t a2rrx ono4opeo fciys aDraumo (0teeomfcio1fa rlivi;()truo(r no1amtnmfctlsf Dtru p;t0oet  o3iltfsDeaumpnu4tlenmo oa1fpDr ueo ( s2xoxm oodoptn ivia()srrr(mp;o0oet mi3tldlmDrlnvpn(0tetniocoytop ean il(0t2tmim3iy1lle mfcslsf rtmxmp;t4opxnmietadlaDrluvs;u0 leoxf3to1fp  livi;( sexrir iu1lle  fesas) rtr(  oo4olxn f3iys sDel(mo t0 eeoif3iy1fp eai ils0s2tr(r3oy1om elivi s) rrmu  ;t1tpxo iciasfsDra(vonu4 leoxo3tatlpt ln o ()sexmimpiy4lptelnvsas s2rmxm ;t1tlt mociyd sDrl(msn(0trenxrciodfaD  ues (0 2tmim3oo4lle lictltf Dur(rp;u1olto fetls m2eanvo;t) lenxfcia1fm r u slt)trtoimpoy4ll elnctl( a2rm( onu4aetnmociyslm2rmn s;u)trxnxrciotoat  nes;t0trurxm3no1llenmivt ( aDur(rp;o1tlx iietatfm2eluvs t0aeerio ta1omDr i o ()tetm(m3ou4lme  nvtasf rraxmp;u0oexomoetasfa2elu ont4 ltomo iodfa rau o t) rxoio io4apt  icsltfarraum ou1aex iictltlm2ran snu4 ltoif oodfmt  u i;s)trtmxopnodlle lfcia( s2tax pnt1tleo icilslaDul( p;u4 lxrircootomDelies;(0trurim no4lpte ivi () rtr(r oo0tet mieiytlmDrau p;t) lxomo tatlpDr ivils0 rum(r iudopenlivias srurumpnt4opxn i3tyd s2emumsnt4 rtrxr3iotopt ai ol()seum(m3oo4lp nlnvsas)sDumurpnt1olenifeiadfsDrluvs;t) lxrmrcoytomt  n s t0teumim ou4lle  ivias srtr( o;t0oltn feilsfm2umnmonu)arxoiociadomD au s;( truo(m ou1ap n ietlt  rta(m ;t4apx iietytfmDumu s t4alerxociy1lmteaivs s)t2urxopnu4oltn ivil()arumxrpot4teenmfciltfs emnvo (4artoirctydfpDrli ilt0s2xoim3iydal nlnvi sfsrta( pnu0aetn iciyslm ulnmo;t)aeerxo3iy1fm e ivo t  exoxo ny4am   feia() 2ta(mpou0oeeniietasla rln p () etrmf oydomDrau s;s)sexm(m ou4omeemfvs t artr(m nu0olx micilsfa2rlnvpnu)areoxrcta1om rai slt0teumir3io1om  lfei (farrru p;t1tee mociaslm2umnvpn(4trtnxo3ootfptrauvs (0t2xrxmpou1lm nlfes ()s2rr(rp;o0aexo i3iysfs ea(vp;t) lerxr3iotlmDrlnvi;t sruoxopio4llt lfvs s)arrm(roou4oleomoctat sDeauvs t4 lxnmr3iodom  au s t)t2toirpiydll e fci ( aruru  ;u1altomfctat sDrlump u)areriocoodfm r u sls) eur(mpiy4opte fvia(  Drrxrpoo0ope iieiytfa ulnvo (4 rxrmo3oydoaDeau s (  2xr(o3iy4op n ivtl(f 2rm(  no0tet mf3iyt m2ran p;(4trxrmr3tydfatrlues s  2uo(opoydll emnct t s2rrx p;o0tltnmf3iaslm ul(msn(0tltoir oytoatelnvo s) ruoimpny4lltn nei s)srtmx p;t4ape ifeiadls ea( s t0tetrir3oydopDrauvs t  etr(r iu4lp nlnct tf 2raxmooo0alxn f3iltfm ul(vo;()trxoifciadoatraies s0trxrxm3oodopte icsat s2rmuroot0opxnifeiadlm2uluvs (0artrif3tadop r uvil( s2ur(r3oodlpt mnvsls s2tr(r ;o1alx iiciatfs rmnvp t4trxoxf3oydlat  n o s0 2xrxrpnu1omtn ncil()srur(mooo1oeeoif3iltlm ua(vp;u)arerxf oy1oatraneslt trxo(rpny1lm  mfcils  rumuro;o1tetnmieiysfs2el(mon()trtnxr to1fpt aueo s)tetoxm ou4altelnvi ()arrmur ;t4oeenmiciytla2emnvsn(4trtnxo iadfm  au ilt)t2um(mpoodlptemiesas)aDrau  ou0apen iciadfa uluvp ()arxnmrctatfmDelivo s0s2xoxo3oo4llt lfcs (faDrmxmpoo0tlt mi3tadfs umumo (0aexomfciodlmt  i s ( t2uoir3oo1oltelies t)arurxr ;t0aetn f3tlt m raumonu0 eerir3oy1fatr uvs;t) 2uoiopoodlle lfctas)s2ur(ro;t4olenifciytla2el( p u4 rxnif3tytfaD  ues s)setrimpio1lmte ics s)sruaxmoot1tet  ieilsfm2umumo;(4 exrir ia1fptelivilt0trxmxo oudomen fcsasf 2ua(mo;o4alxn ocildls ulnmon(0alxrmrcty1lpt  u o s seur(o3oy1ol  livilt) 2rm( ooo0oltoii3iatlsDeanvp u)tltnxociodfa   n ils  exm(mpnodaltnmietas aDuru onu4opxnmieild m2um(vp;t4teerxo3ootlaDe neo;( s2toxm3oydaltnmnctls  ruax  ;t4optomfeiatfs ulnmp;t)tetnif3iadfmtelnvol(0teuoim iu1altnlfesasf rta(r oo0texoiiciysfs2ran o;u0tlxrxrcoydopte u s t0trum(m ou1om nmfesls)s2uaum no4tpt ifeiasfs2ra(mp u0tltomfciadfpDe n ils)trtmxo oudlltn nvtat) 2raumono1olx iieiatla2ul( p t) etoxfcio1laD aueo;t) 2tmxmpnu1lp elfciatfa2ururpot0ope  i3iytfs elumpnu4tetoif oodomD luesls)teumxo oo1lmtemfcsas arumu pnu1oeeomiciat mDulumo ()teenxf ta1faDr nvs t texoir3nydom  mivil()sDum(r nu1aetomocils a2rl(ms (4treoir3ty1oat li o s) 2uoirpiu4lmee ivias s2uaxmont4apx  f3iyd mDeauvs u4tltnio ootfmt lnvo;t0 2uoxm3io4lmtn neslsfaDumxmo;o0openmociadla2rauvpnt)trenmociydlpDrli s s trumxopnodam nmncias  2urum ;u0tltnii3iyt sDra( o;u)trtoxo tatlpDrau i s)trtrxopio1ole  fcia( a2um(rpno1alxo i3tls m ra(ms;(4 etrif3tadlptelnvols  2uoir nu4amee iet tfs2ua(moou4oexomieiatfm rmump;u4treomo tadomD lu i;t  2tmxmpiydlpenlnvsatfarrrum ot4alxoii3ilsla ra( o;(0areomrcoa1fmD  i s t0trur(m3iy1opt livsat)s2rm(  no1tptn feilt aDumnmpn(0tlxomf3ia1fa  lies;t)t2tr(opnydomt  ncia( srtrxm ou0tlto i3iyt sDem( pnu0altrio3oatfpteln sls0 2trio ou1amt lictlt srtr( onu4oeto octaslm2ea(vp t4 ltrmo3oa1lateanes t)tetriopoudaptnmnet t s2tmx pnt0tlt mf3iytls2ranvp t0aeerxr oo1fpt lnvsl(0seur(m3iu4ol n ncsl(  Dra(rpnu1oet micilsfm umumpn(4 renif todfpt  nes s) exm(r no4alt mfcilsf rraump;u0aeenmo3tlsfsDua(mo u4trxoifctydfat  n o (  rtmxrpno1optelict tfaDtm( p;o4opxniictytlm2ra(msnt4trermrciy1opt anvol(0trtr(o iudome mfcslt)aDtmxrpnu0tpenmi3iad m2elnvp t4aleoiocty1laDr neo s)t2xr(o iu1open iesatfs2ur( pot1apxoifeiys aDuauvp;u4arenxrcto1fa r ieo s) 2uo(r oudaltnmfcil(  rtrumpot4tpe ifeiatfmDrm(mp;u)trxoxr ootom  ai ol()srxoxm3iodom emnvtas)s2rmxmp;u4aleoif3iatls eln sn()tetnmf ta1lmDeluvs;t0trtmiopnu1ole mfcia(faDta(mono1tlt  octadfmDuau onu) ltnxoctotlptean ol(  2trirpno1ll n feias aDtr(rono4tlen f3tatfs2uauvon()treoxf oodlp rliei;s)srur(r3nu1apenmnviltfsruaum ;o1oet mociad mDrmumont) lermo3oydlpDrlu sl()srum(o iydam e ies s)a2rmxm nt1tlxnmfetas sDrm( s (0 lxoir iodoptelivs s0 ruo(r3iodoptemfetat  rtrurpoo0altnmictytlmDem( pn(4trtrifcoadlpDe i o ()srtrio3oudoptnlivil(fs2tr(  oo1tlxoifciyt mDuluvs u0tltrxo to1oatean o;t0tetr(mpnu4lp   nvtlsfa2uaxmoou0aeeoiiciyslmDum(vo;u0tlxrxfcoodfp   nvo;(0seuo(rpnu4lpeelivsa(f ruau oou0olxnio3taslsDulu on(4 rxniociy1fp  lu i;()trxrxm nu1olen ietltfsrurum nt4aex  f3tasfa eluvs;u0 reomr todom rai s (0sexoim oy4lmt mfcia(f 2rr(r ;o0optnmi3iad aDuanmonu4 rxomo todoat  ieils)tetmimpno1apenmicsl( s2taxr ;o0oexomfeiadlm2elu p;()aeerxo oatfaD  ivs t teurim3ou4opee ncils)srrr(  ;u0aptomieiydfsDranvs;t)tlxoxo oydlaD ai ol(0srur(o3iydaptnliesl() rtax o;u1oet iictlslm emump u4 exrxociadopt livo;s)s2xoiopiodopeemfei s)s2tr(r nu4oexomfeiytfsDranmo;u) lenirciodlp  livo;t s2xoxmpou4lptnmfetl( s2rm( pnu0texo icilslm uluvsnt)aexnmf iatfpDr ueo;( teuoxo ou4lp e fctas  rurxr nt0tee ifctldfsDrmnvont4altoir oadoaDeli ol()sexoirpnodomtelneta()srrm( o;u4optniietlslm2ranvpnu4 rtnirctadom   ivs s)s2uoio3iu1lp e ieiat)aDtr(mpnu1aeenmi3ils a2rm( p (0 etnmo iytom   nvol(0 rto(rpiy1alen fcta(fsrrmxrono0texoio3iytfsDumu s t)tltniocoatlm eai s s0 2xmxr iu4apt mfci t  rrr(mont0tlenmfetas s ra(vs t4teeriociodlaDeai o (0trtr(o no1lle lfcta(fartm(ro;u0oetomfeildfa umnvp;(0teermf totlmtr ivo;( teumio3iy1opeemieil(  Dum(mooo4aee  f3tadfs eaumont0areoircoytfatraieolt0setoxopoo4lpeelncs ()arrrumonu4ale  ietydls umump u0tltrmf3tytfaDelu s;()t2xrio nudal n fcs tfa2ua( poo0tpx io3iyd sDuln snt)tltnxo totfateluvs;t srtrxm iudlp emfvtas)arrr(m nu0tle ioeiytfa2uanvs;t0altrmr iadoa  lnvi t texo(m3io1llt  fct s sDtmx pno0opxn feiydla2elnvonu4arenir3oodfmD aueo;t)truo(o oo4lpeemivtat  2trum oo4texnioetys s2el(vo;()artrioctytfaD auvs s trtoir3nydolenlfvsa()a2rrur oo0aex moeiadls2uanvs u)trxnxr tatoaDrli slt0 2xmirpoy4op  lneil(farta(  nt4aex moctltlm2ra(msn(0altoxr3iotfateluei;t0t2toio oudlptn nct ()sDtm(mpou0teenii3iyt sDrauvp ()trerxo3ootfp eai s;t0 rurxr3iy1omte fet ( arrr( o;t1tpxo oeilt mDrl(mp (4tltrxr3totfaD  nvs (0srtrxmpnodlm   fvsa(  rrmu pnu4tlxnioeilt mDea(vo u0alxrxrctydlm  luvo;(0t2xrim3no1opee nvia( s2uau o;t1tpx mfetlt a elnvo (4aexomr ta1lp r nvi t) 2uoxo3io1amt lnesa(faDuau o;o4opt micilt s emuvpn()alermo oytfmte nvi;s)seuoxrpiodamenmfvsat)artaxrpnu0tetnmo3ils mDrm(vs t)teenxo iotlp  li slt0s2triopno1amen ivs (  rumx  no4aetn ociltfm2umumo t0 rtrxr iatfptr uvs t0trtoio3iudlmenlnetlt  Drr(mpot4alenmieild mDuaums;t4alerir oytfatrlivs;s) 2xoxm3no4ameemfesas)srurx o;t1tlxoioetldfm ea(mon(4trxnif tatomt  neils0seuo(o3nodapee fctlt  rrr(rp;o0aptn ieiydlsDuluvs u4 etrif iytlmte n ols  2trir ny4ome mfvtasfarumumpnt4tltnmi3tatls umn snt)tltrif3todlp rlu o t)sexoir3nydamtelicil() Draumpot1aexomocild m2elumo t0aexomo3oydopte ivo t  2uo(r nudapeelncsl(  2raxmoot0aexo icildfa rl(msnt0 ltoxf to1optr n ol()s2trir3iudalt mfesat)aDtau pno4oetn f3ils aDum( s t) exoircty1fpt aneol(0 exmxrpou1olte fctltfs2taumo;o0tetn ociadla2ua( pnt4arxniocta1om eau s t trto(rpou4om  lietatfarurxmpno4oltnmfeiyt a2em(mp u) rermr oodoa elu o;t) rtmxr3ou4opt lneta(f 2ua(root0apt ifetatls ran pnt)aleoxfcoytop   nes;t0seuoxr3iu4amtn iesat  Dtr(m nu4oltomoeilsfm uluvont)texrifctydfatrli o s) 2urimpiy4apenmictl(fa2uaxmo;o4oleomoctydfm rlnmsnt0texoif3tydop e ivo t0seumxmpou1ap  lfci sf Dtruronu0opt  i3ild a2uau p t4 lxnxrcto1fmDeau sl(0teur(opny1lpenlfesa() rtmu o;o0texomf3tldla2rm( s () eeniociy1fm eli s;t) exm(o nudolee neilt)s2rmxront4alenioeiatla2ulnvo;()arxrmocoatoatr i s ( trxmir oudolt  iviat aDtau ooo1apx ioctlt m2ean sn(4 eeomo3iotoatran ols)teto(r3oudaltemfetat)aDum(r ot1oexnmieild s rmumsn(0aetnifciadfaD  nvo;()sruoim iudlpen fvs tfa2uaurpou4teeo o3ias m2uluvpn()artnmrcoadfp r uei;(  rurxmpiodlmen fesat sDurum ou0aeeniociatfs2el(vsnu)tetrxo3oatoateluvo;t0trurxr3iodlp e neslt) rur(moot0ope  fciysfs ulu sn() exomr3iytfat aneo t0t2xrio3iydape mivta( arur(m no4ale  o3ilsla2emn ont) eeomo tydfat  u il(  2xr(r oydlm n nvt t  rtm(mo;o4apxoiieiydfa rl(mont)aexrxocoadlaDeluvs t0t2urir iu1lmeemncilt) Durumono0aptomfciaslmDeln s;t4arxnif3iatopDr ueo;( t2tmxr iy1om elfct t)sDuau p;o4ape  f3tls aDemnms u4 ltnmo tydfmDr ivo;t s2xrxo io4lme mneias)sDtaxmo;o4olx  fciyd s el(vp ()tleoxfcoytopt livslt0teurxmpou1am e nvias arum(rpnu1opxoio3ilsfa rau p t)arxnxf tytlm r n o ( s2xrxrpny4altemfetls  2ta(rpno4tpe io3tad sDuluvs u) rtoxrciytoaDe ivil(0 exm(opiy4lp elnctl(fsrum( o;u1tlxoioeiad a umu s;t4arxoir3iydfaDe i s s seurio nudam  mnesls)aDraxr nu4texnioeiytfm ranvs;u0aetnxfcoo1opD auvi;t) 2xm(o iudlpe miei t) rrru pno0tlt  feiatlsDrmnvs t4 eerif totfmD  ues (  exrxr io1amee feia(fsDtaxmpnu0aptnioeiad s2umuvs t4aleomfcoatla elivols0 rtrxr oudaltelieil(farumur ou1oeeo fcilsfmDrmu p;(0 rxnxrcoy1la eli o;s0texm(o3nydapee fci (farrmxr ;o4aptnioetasfm2umuvs u4aleoxr3iatlp eauvsl(0s2tm(rpiu4al emfcsa( srrmuroou0apt  iciyd s2emuvo ()texrxrcoo1omtranes s  2xoir oy1lme liesl()s2rmx oou0tetnioctasls2ra(ms u4 exrmo3to1opDe n s t0seurir3oo4lp   ncs (faDtrur ot1tpen ieiadlaDea(vp t4 ltrio3oytomtr n s (0 etoxo3oydom e ivi tf 2rrur ou4tex mociad s ean pnu4alxnxf3iotfatranes s)truoxopnydllte icsa( aDtmu pou4aex if3iydls2emnmp;u)aexoxr3iadfptelieo;s) rtmxo3nydal n ics (f Dra(mooo1alen oeilsfmDul(mo u4tltoio oatlmt  i i;() rurirpoudale mnvilsf rumxmoot1oetnmf3iydfa rlu o u4tlxnxoctotoat livs;s0setm(o3io1alen fct tf Durxmo;t0teeomi3iltfsDeln p;u) eeoxr iy1opt aies ()s2tmimpiudame mneiatf 2tr(r ;u1aeeniociyd a2em(vs;()aetnxo tytfaDeluvi;t sexr(rpoodoltnlfei ()srrauroot4oltnmf3iatfa2uan s;t0aeenmf tadlaDrauesls)s2tr(o3ou1al nlfei t) 2raum ou4altomfeiadlm2emums;(0 eeoxr3tadom eanvslt  2xo(m oodlp n feta()s2trxm ot0tlen octydlm ua(vp ()areoif totoaDranvils0s2umimpoodoptelnvs t  rtrxmoou0tlx ifeils s2umumpnu0texoiociotlpteauvols seuoxrpnudal nmivtltf rtr(rpnt0oltnmieiatls elnms;(4aetnxfctydlpte i ils texrxr3iydope micslsfarum(r ;t0optoifeiyt mDrlu pnt) ltrmrciotlmD luvs s) eur(o oudamenmfet sfa2uaump;t4alxoioctys m elnvo (4 rtrif3ta1fmD  neil() exmimpiu1altelfcsl(  2urxmo;t4apxn fctlsls rlnms;t4arxrxf3iytla elnvs () rxm(rpny1ale mivil(  Dtax ont0apxomfetltfa2rln o;u)arerxrcty1fmtelues t0s2xrxm3oodol  mietls s2tm(  no0tee  ieildfs ea(monu4 rtrifciatla  an s s)seurio3ou4apee neta(fs2rr(mo;u1tpt mo3ias sDum( snt) rtriocto1oa r ueil(0trtr(o iy4lltnmics s)srrm(ront4tpt iictlsfm2ean pnu4 ltrifciytop rauvs (0 exoio nudoltnlivslt sDrrxmp;t1olx mo3iytfa2elu p u4trenxrcta1fp  lu i ( srtoxo3iy4llenliesasfa2tr(r ;o1texo ieiasfmDeln s;t4 rermr3ia1lpD an s;t) 2trirpoo4apeelfviatf rtr(rpnu0olen ieiyt s emu p;u) etoif3iydfmtrluvi;s0srxm(rpoy1olt lfctl( srrmu poo0tleoifcilsfa2rln s () rtnxoctadoatean s s)t2tmxr3oo4lpee fvta(  2tmumpnt0oeeoifeilsfmDemums;t0 etnif3iy1fpDran i s0s2tr(r oo4lmt  fes t sDtau ooo0tptoifeiasfa ua(vpn(4 rermf3oy1fp e u i s0tetmim3oydlp   fci t aDrru  nt0apenio3iltfs2uau s (4aeenmrciadop  ai i;t  eur(rpoo1lle  ics s srrm(  ;t0olxo ieiysfmDea(mpn()arxomfciotlpDe ueil(0setoio iy4amtelfvsa(f rta(mpou4tptn ieiltlm rmn snt0artnxf3ty1late uei;s) 2to(m3io4om emfvtlsf 2tmump;t0tetnmi3tltfm el(vs t0alxnmr3iatlmt au s;() 2umio3io1olt mnvsatf Dur(m ot0tet ioctld m ulnvp (0 eenmf3iatfatraivo;(0sexrxmpiydlpenlfvtat)srra(r nu0ole micilt mDel(vo;(0 ltnioctytfpt livo s t2toxm3no4olen ici s)a2rmu poo1tpt  ocilslm2emnmo;(4 etrio3iydom  anvi t0srxo(r oydol   nvsl()sDtm( pnu0apxo o3iyd a rmump;(0 leomf oa1fpteauvils0srurimpoy1lm nmncilt srumu  ;o1tet ifeiytfm2eanvont)tlenxf iy1lp  livi;()truoim no4lle mnvsat) rrru  nu1alxomietyslm ra(mpn(0 rtnxfcoy1opt au s;s)s2xmxr oudlptemietl( s2ta(m ;t0olxo o3iatla2rmumo;(4aetrmfciotfmDelu s;s  exo(r no4ap  mietas s2rrur ;t0ope io3tytfm um(vsnu4aexnio3iodfp   ues ( seto(rpnudlle  ici s)sruaum ou1oex moeias mDumn pnt)tltnif oo1la  ln o (0teuo(r io1ll e nci s arrau p;t0olx mieiysfs el(msnu0texomf tatopt ln s;s0s2uoir iudamtnmict ( srrr(rpno0aptoif3iyslm uaump u)trerif3oo1opDeau o;s trxo(o3oo1ope micias)s2rmxmpnu4ope mf3iytfsDra(ms;t0tlxrir3totom elnes t0 etrxr3oodopenlicslt)sDta(r ou4tlenifctys m ul(vp t4 etnmfctadfm e ueilt srxoxo3iy4apeelivs tfarta( o;u4tptnifeiys s2uan o;u4trermfcoa1lptrli i ()teur(rpoy1op  licslt  Dtau  nu0alenifeiatfs2ulnmo;t)alxnif3oatoatraneils0 2tmxr3iu1opee fctatf 2raxrpno4alxomi3iltfs2emu p;u0alxrmo3iytopDeai s s0srtrxm3nudlm  lics t aDtau ont1tltnmieiaslm2ra( o;(4teeoifcto1lpte n i s t2umxm ny1llen ict t) Dtr(root0oeeomi3ilsfs2ran s;(0aetoxf3tytop e i i t0sexrim3oydoltelncslt sDurxrpou0oexn ietlsls2uauvon(0aetomfctadomDr ivs s s2xm(r nudlm nlfet tf rtmuro;o4olxniicildfm2ulnvonu0areoir3io1lm eaneils) ruoimpnudlp   nviatfaDrrumpou4apxoioeiytfm2ranvp t) etnmrcoa1lp e ieol( sexoir oo1amt lies s)arrrx oou4tlxomieiatfaDrmnmp;u4trxrif oodfpD anes;t s2umimpiudlpe mfci sfs2rmx  no4oeenifciysfm2rmuvs u4tltnir ta1oat aivi;t0tetoio iu4opee ictltfarum(  ot4alenifeiydfa2em( snu0 reoxr oo1oate nvo t)seurim3oudllee nvi (  Dra(ro;o4aleo o3iyd s2el(vpn(0tetomfcto1fp r ivil(0srumxm3iy1alt lict ()sruaurpot1apxoiiciatls2rau p t)altnif ty1oaD anei;t  2toxo oo1lme  icsa()artm( o;t4texomfeiatfs ea(msn(0 eerxo oa1lpDr n i;t0t2xmxm3iy1lmeelfctas arrm( ont1aeto f3iasfs ua(vs u4aexrmf3ta1fp eau s t)t2xrxmpoy4llt mnvtls arua( oot4altniietadfs emu o;(0 ltrif3iodfm rai sl(0 rxo(rpiudlpte feia(faDtr(  nu1oee miciatls2emuvp t4tetrmfcoo1faD  n i t) rumiopiodamte neias aDurur no0oee mf3iltlsDrauvo (0tltoxf3iadfpt  ivol(0tetoxmpny1om emivia(farrmu  nt1olxn ieiadlaDuluvs () leoif iy1opD  u ol()seto(r nydol  lnvtas a2ra(mp;t1apxn o3tytlmDrmuvonu)artomf3oy1oaDe u o;s0 2xrxopno1oltelfviat srrm(mono1tle ifetas s2ul( s (0trerio totopt  i o;t s2uoim3oudlme mncslt sDra(mpnt1apxnmoctadfs2umnvp;t0tlxnxo3oy1fpt livo;s trxrxr3oudlm  miviat) 2umx ono1aptnmfciatls2rm( snt4 lxrxrcty1faD lneo s  rtrxrpiy1lle  fvtls artrur ot4optoiocils mDuluvo;t4alerxocoa1oa   ies;( t2xo(r ou4lm nmies (  rum(r no0oeen fetys m2elnvp t0 lenxr iotlp  ai s s0t2urimpoydapee neiasfarrmu p;t4tex  icilslaDrm( sn(4 eenxf3iytlptr nvo;( seuoio iu1ale lncsas) 2taurp;t0tpx ioeiatfs rm(ms;t0altrmf oydfp eanes;s0t2uoiopoy4lmtnmivias) 2uaxm nu1alt  ociadlaDuan p t4 etoxr3iydom raueo;() etmio3nydamtelnvias)sDum(r nu4alt  f3iadlsDeauvsnt)teenmo oatfmte u olt)setrim3oy1oltn neias  rtaxrp;u1tlxoii3tatlm2rln o;(4aexoxf3oadomtr uvi s0srxmir3oudlmtelfcsat s2tmu pnt4opxo ictltls2um(vonu4arxomo3ia1oa eauvs;()t2toim3nu4lp  lnvs ( a2raurp;t1tleomfciasfs2ea(mont)aetrmo3oydlp   uei;t t2xo(opoo4ame livs tfaDrru onu0oltomietlslm ra(vp u4 eerifciadlaDeau ols0tetoio3iydlpte ivi tfarurum no1teenioeiydlm ea( onu)altoir tydfmtrauvsls) eur(m3ny4lp eliesa(f Dtr( pnt0tpenmieiasls ul( s t) lxnmfcio1optrlies;s setmir iydaptnlivia(  rumx oou4oltniiciydlm emumont4aexoxfcta1fpDranvs;t) rtmxm3nydlmt  fci t arua(  ;u4tet  ieils a umnmon(0 lenmoctydfm eai i (  rtrxmpnydame lnci tfs2uaumpot4aeto oeilslm elnmo t) lxrmrctatlmt ln s s trxm(m3nu1al  mnvtlt arraxrpno0altomictasla emn o (0 etoif oy1oat aieilt t2xoxopnudaltnmnei (  2umu p;t1tlxomi3iad sDumuvs;u0treoxrcoydfateai ils)sexriopoy1ameelncs sfs2uaxmp;u1olen octysfa eln snt)aexrxo3ootfm eanvols0trto(m io4llt lnvsl(farraxmoot4oeenmf3ias m2eaumpn(4arenmrcoatoaDrai i (0setrio3iu4olenlnei () 2urxrpnu0opx mi3ild a2rluvo;t)artnmr3oy1lmDelnvi s  ruoxr ou1omte fesl(f Drrx ont1oetoioeiytla2eluvp t)tleomocto1opD luei;t0trxmir3oydape mnviat)s2uru p;t1apx ifetatls rl( s t0altnif tytfpDeli i (  2toxrpoodop nmfvsa()srrmumo;o4opxo ociasfm2el( p (4 renifcty1om eli o;s)srxoxm3iy4apeemnctas) 2ua( p;u0altn fciat sDemn s;(0tlxnmf3ootomD au ol() 2trim iy4ol elfeia( srtmxro;o4alt  i3tlt mDem(mo;(4aexnir3oo1fmtraies (0s2xrirpno4lltemnes ()aDrm( oou1aleoifciatlsDelnmpnu4texoxo3oadlptraivs;s)s2umir oodapteliesa() 2rauront0oex  f3ils m2elumpnu0 renmr3iadomtranvsls s2trxopny1ol n fvi ( srtru oou1opeo o3tlt m ul(mo;u4 etomo3oytfaDe neols)s2trxo no1llte ivs t artruro;o1apxo fctas s el( o;(4 ltnxo tadoa rli ols)srxmxrpiu1ome lfvi t) Durur nu4aetnmocias aDranmp;()tltnxo3ta1lm rluvi;s0 2xr(opoudlpt  ieta()aDum(  ot0oeto oeiydlmDemumo;u4aexrxoctydoatraivol(0seumxo3iy4alt mnesls) 2rmx  ;o0tetnmoetldfm ua(vs t4tleoxo3ia1fpD au i;s tetrxr3nydlpeelncs sf 2tm(  ot4altomfeilt mDulumsn(4artnxr oatlaD  neo;() etoxr iy1olt mictls srururp;t4oleo oeiydlsDulnmo;(4arxrmo iydom r uvol(0 2xo(opoy1amtelnvsl( aDur(mpno1aptomi3iad s raumsnu)arerifcoadomte nesl(  2xmxrpnudlle lnvta()s2raxrpnt1oetnmoctld m eln on(4teenircta1oaDe ieo t)truoxm nu4olt  ies ( aDua( ont0tpe iocilsls eanmo u)artnio oatopDrlivolt0s2uoiopou1opt  nvt t)aDtaxrpnt4opt iictat aDuln s;() lxnxocta1fm raneol( t2tmxmpio1altnmncias  rtrumpoo0ole ifciasfmDraumo u0tlxrmf3iydlatrau s;s0 rxmxo iu1lm  lfvtlt)srumxm ;u0oexnmiciytfa rmu pnt) rxnif iatfpD livs s)srtr(m oy1lmeemfesat  rrau o;o4tpenif3ilt aDrmu s u)alerxf iy1omD luvo (0 ruoio3ny4ome  nvtl()sDumumont4apt  fetat sDrl(mp;(0tetrxrcio1fat aneils t2um(m iy1amenmneslt) 2ta(  no0tetn ieiyt a2um( s () lxoxo oa1fmtrlu i s srtmxr3ny4omee ietl(f 2urur ;t0opt iociltfm ul( ont)aetomr3iy1fat  n i s)t2tr(r nydoltnlfcsasfa2uaxmo;u1aeenmieilsfs rm(ms u0trxrifciytom raivs;()srtm(r3oodape lnvs t) 2tmum ;t4opxnif3iad mDelumo t)alxnxocoodlaDr u o;s srurxr iydom  mfctasfsrumxrpot4tpt mieiydls rau ont)aeenir iy1fm elues;s s2xr(rpou1amtelnviltf rrmuronu1apto i3iad a2em( o;(0tetnxo oo1optrauvols) rumir3ny4op   fesas)srtmxmono4aeeoiietydfm2rmn o;(0trerif3tytfm   ivs s)teur(r iu4alt lieslt a2uru  ;o1olxn i3ilslm2ul(mpnu)alxrxocta1lmDrlnvols)trum(rpou1ome  nvta() 2tmu  no0ope  ietaslaDrl( ont4 renifcia1fmDeau s ( trtmir nudapee nvil(  Drrxmpot4teeoif3iatlm2emn p;t4 lxomrciy1opDe ueol( setoxopou1lpt mfvsa(  2ta( pno0oetnmi3ias a2rmu onu4treniocoa1oat au o s0t2xr(r oy1amtnmnesls) 2ua(m no1alenifeilsla2ea( p;t0teeomrciatlpD li ils sruoimpiydllen fetltfsruru  ou0tet mi3tydfs umumpn() ltrmr3ty1fpt  n o t0trxr(r3no4lmenmietl( sDra( ono0tpe iictlsla rmnmp;(0trtoxf oatfa r ies;s  rumir oudame mnvilt) rtau  ot1tlt ifciasfs rln on(4 rxrmoctodopD lues;t)trxoxm oo4ome lncs ( a2tr(m ou1tlxo i3iyslm2umuvsn() eenmf3ta1lpD aieo s  exoxo io1ame lnei t a2ua( poo0tptniicilslaDrmu p t4aeerxociadoaDelneolt)t2um(m3nydoltemnviasf Drm(rpno0apeniictld a ra( on(4alxnif3oy1laDeauesl( srxmxr3ou4ll nlfet t  2rmurp;o1texnmo3iatla umn on(0 reoir oytfm elneo t0 etrxm3iy1ope livia()srumu  nt4opx ifeiyd a2emnvo u4tetrxo iytoatrliei t0 exo(m3iudomt  fetat  rumum ot0oetnmfetltfaDumnmp u4trxnir to1fp raieolt0 rxr(m io4opeemnvi sfsrrru poo4aptnmo3iytfmDelnvont4trxnmocta1fpDrau i;s)t2xrxo ny4omte fcil( sDtau o;u4aexnmoeiysla rmnvpnt0 ltrif3oa1fmt livs t)truo(o3nu1oltemnvtlt)sDrm( o;t1apeo fciydfs2rl( s;() etrmociytlmDran s;t0 eurimpny1lptnmfcils  rurumoot4aleomfciat m uanvs u0teenxf tatomt  i ilt)t2urxmpnu1amee ivi ( aDtr(rpoo0tlx  icilt sDul( pnt4 eeoif3to1fmDrln i;t)trum(r nudoleemfcils  2uaum ;o4aetnio3ils s uauvp;t) etnif tytfp   nei ()texrirpiu4lleemfcsasfsrurxrpnt1tltoioeiltfa raump u4tleoif oadlpDe n s s srtmxo oo1ape lnet sfs2rm(m nu0aexn oeils m rm(mo;(0 ltoxoctytlpDe ies;s0teurxm iu4llen nct ( s2ururpnu0oetoif3tldls2elnmo;(4 rxrmr3iotfatrluvi ( sexo(o oudolte fvsatfaDurx  nt0tpen oeildfs uau on(0texrifciodfm r u o;t)s2uoxmpno4lmeemfvta(f Drrump;o4olxoii3ias mDuluvo (4tlxrmf3ia1om   nei;s  etoxr nu1lp n nci t a2um(ro;u0tptnifeiatfs2ra(mo;(0 rtrircoa1faDelnvils)seur(m ny4op   nctls) 2raxmont0optomo3ilsfm rlnmon(0 lxomf io1fpteai i t) etr(opoy1aptn fci s a2tm(r nu1oee moeiat s rl(vsn()artrio3tadlm e u i;()srxo(mpou4op  mfetltf 2rr( oot1oleniociysfs ra( p (4tetrmr3oadomD anvo;t0 exr(rpoydoltnmivtat  rtm(r ;o4tpeo oeildfa ranvpnu0aeeomo3oytlm   ues;() eur(r oudapeelncta(f ruru  ;u0tpxnio3iasls rl(mp;t) etrmf tadfp rluvslt0s2tm(o io4al  lnetas s2rmu  no0oet  ietydls2rmuvp t)artnifcoa1latr iei ( t2uoxopiudame  ietas  Duru pou1ope mocilt m2eaums u)arxnmrcio1oa eau o () exr(r3iy1aptn ict t a2taurp;t1tlxoiieiatlm uauvp () rtrifciotfmDrlivi ( sruoxopno4op emivtlt s2um(rpnt1optomf3ilsfm2emuvs;u4 rxoxr3totoate nvil(  2xriopou4amt  ivt tfaDtm(r ;u4tpe ii3iydlaDuanmon(4arxnxrcta1lpDrli i;s0trxoxo ny4ome livtltfa2rr(mono4alt iietld m ra(vs;t) rerif3iytoaD au slt0setmxm nu1openlfvta(fsDurxrpoo0apeo i3iydlm um(mo;t0trxomrcoatlm rauei s  rurir3iu4omenlnei t) Drrxro;o1alto ieiltls2ra(vo u) lxoxr3tadfa rauvilt0srumiopny4alt  nvilt)s2tmxm oo1aeto o3ilsls ean p ()tleoxrctadopDeliei;s0trtoimpoo4olenmncslt  rra(  ;t4tpe mocilsls um( p t4aexriocio1lm e ivo ( s2uriopoo4am n ieilsfsDum(m ;t0ale if3tlsfa ua( s;()treomr3to1fmD  n s ()teurxm nu4lle mnvil()sruaxmpnt4oet mf3iasfm2ua( snu4arerifctadfptran i;t s2xmio3iodllenmncia( aDrm(mp;u1alx micilsla um( pnt4texrxrctatfmtrlivilt) 2tr(rpoo1lpee iciasfsDrmu p;t0apxoifciadfsDrl(vpnt0 lxomfcoa1lmD aueols0 2urir no4al elfeilsfaruau ont0oeenii3tys aDea(mpnt4arenio3iydfpD lnvils0 2umxo nodlm  mnes tfaDtmx pot0open fciydfs rau snt) rxrmf iy1lp rlivsl(0 2tmxo3io1om nmncsls  2rm(r nu1tpe moeilsla2rl( p t4aleoif3todlat  uvi t  etmxm oydlp   fctlt)sruaxr no1tptoifetytfm2emump;t)trenif oodfpDe u o ()s2toxr3oo4omenlfcsl()sDtmu pnu4oltn ieiydfa2eluvs;u) exnmr oa1lmtranei;s0t2xmxm3iy4ope lfvt ( aDumuro;t0tee iietat m ulu snt4 ltrmociydom e ueolt) exr(m3iydom emnetls srurx p;u1apxomiciydlm emn o;(0aexomr tydfaD luvi;s0s2ur(mpio1lp nmfes s a2tmumpno1olxnmi3ias m rmnmo;t) exrir iytlm  lieolt)sruoirpiydllte fvia(fs2ua(mpot0texn o3iys a ra(von(0aexrmr ia1lmDeanvols)srxoiopno4lme  fct sf Dur(  ot4tltnmictlsfa emnmp;u) renxo oa1fmtran o;t0setrio nu4op emnviatfs2urx  ;t0tlt mietydfa2ea( o;t4tleniocoatfatraiei s0s2trxr3oo1opeelici t  2umx  ou1tpeo fetyd sDemu o (0tlxoio oy1opDrlivo s) exrxr3no4apt  fci () 2ta(m ot1oex mo3iltlm2emu p;u0teenmr oatoa ranvs;s trxoir oodolenlnvsat) 2rrxr ;o0aeenmfeiyt m umnvsnt4arerio3iy1oatr neo;t0setmio oy4ope mfetlt  Dtrumono0aleoiocild s2elu onu)tlxomf iotlpD anei;t trtmim ou1altnmfetlt)a2rau  ;t4apeo fetad m2emnvpn(4 rxoxo3ty1fptran i;(  etoim3oodam emnvilt)s2tmxmpot1aeto fctadla2umumon(0 rxoio iytfa  lu i s0srto(opiy1op nmfcsl(  rtr(r nt1olxnif3ildls2em( s ()trtrmo3totlm r u sls0seuo(o3nudom nlfeta() 2ta(rp;u1tpeniicias aDrauvont0 eenxo3iatop elnvsls) eumirpny4oltelfcils) Drm(rpot1tetn fetysfaDumu on(4 rerxo todom   u il()s2xm(r3nudal nlivi tfa2rmumo;u1aex io3iytfa2umnvp u) rxnxo3oadlptr nesls) rxo(m3io4olt lfei tfarrm(rpoo4opto iciytlsDrauvp t4altrif3ootomDe nvi;s srxoim nydamt mivi t) 2rmxm ;o4tpxomfctltfmDemnvs;()alxnif tatoaD li s s0setrxrpnu1ame lfvt s srtrurp;o1oexoioetadls2ul(mp t0trxnmo3ia1fp  luei;(0texo(rpou1amenlietatfsDrmumpnu1tpt ioeiaslm2ul(mo;u4 reomf oodlpt lnes;()seumim nu1opteliesa(faDtrur ot4alxnioctlsfa2ranms;() rtoxo3oodop r uvols0s2uo(r iu4alen fcil( aDrrxmonu4apx mi3tyslsDuln o u0tetomfctytoate nvo;s)texmxopio4lp elfct ()srua( pnu0opt ifciydfs rl(vo u)altoifctodlaDeaneo;( seuoxmpio1op nmicslt)s2trumoot1apto feias m2em(mpn(4teenmr3to1opDr uvi (0srtmir3iodomt  fvsa()s2tr(mo;o0oet iieiysfa eanmo t0areoxf3ootoat  iei;s  eumxopoydlme  fvilsfs2trur nu4optn f3iys aDrmu p;t4 rxnifcoy1omt  uei;( s2um(r nodaleelncilt)aDrau pot0ale mf3iyt aDem(vo;(4texrio3tydom raivs;s)srtoio3ny1amtn nvsl(f 2rrxmpot1apt iociat s2rmu o;t4trxrmf tydlaDr uvo;t s2xm(r3iy4al nlnvi t  rrrx  no4texoiieild m uln p (4 ltoxr3iotoa e ueilt0 etmxr ny1lptelieslt aDrr( o;u4teeo ietys aDelums u)arenxfcia1lpt  u s;t  rurxr3iy4ap n fciatfsrumu oou1apxnii3iytfa2elnvs t0 etnifcta1oaD lnvo;s) rxm(rpnu4ap nlnvil(fsrurur ou4opxo ieiyslm2el(vs t)aetoifcoadfptrluvsls0teuoio iudll nlivt (fsrrru  ;o1ope  i3iydfm2uanvo;()aexnxoctadom ranes;s)setoxr3oo4oltelieia( a2taurpoo1tltnii3ildfm ua(ms t4aexoxrcoo1fmDeln s s) rtmxm io1aleemnctls a2raurpoo1ole iietadfm2em( on()texnircoydfp r nvi;(  rxm(rpiydomt lfet sf Dumur ;u0tlx if3tytfm el(vsnt4 eeoifciatlpD luei (0s2urim3oo4apen ncsl(fartr(ro;u0apeniieiltlm emnmsnt4 eermf iy1lpteaieils0srtmio3ou1llt lncilsfa2um(monu1tltnmo3ils m umnmpnu0 leoxf3tydoat aues t0srxmim3iydame mfct tfaDraum no4aee mfeiat aDumnvo;u4 reoxf3io1oateaieols seurxm3iy4apt livsa(f Drrumonu1olx ioeiytfs ea( p u)trtnmocio1faDr uvi;s)sexrxo io4lmt mieias)sDum(roou1tetnioeild mDrl(ms;u0 rtrifcoytopDrluvilt  2uoxo iu1apenmfci t) rtr(r ;t4tlxo feiyt aDumuvp;t4trenxo3ty1lmDrluvo;t0s2uoio nudlme mivi ()a2taum nt0ale  oeiytfm2uanvp;(0aetoirciadomDe nvo;(0texoio ou1lltemfcilt)srumxm ou1oex  oeiatlm eauvp;t4 rxnmfciotlmtrlies;() exrirpoodom e feta(  rtmxr nt0alxnmfetydlmDelnmon(0trxnmfcoy1fatrlu slt) 2uoimpnudllt  ivtas artaxr oo1aleo f3iltla2umuvs;u4artnmr3to1lpDrau olt0srtoio3oudolenmfcs t)s2tax pot0aetoii3ilsfsDrln o t)tetnxfcta1fmt livi;() 2toim3iu4ll n fet s aDurumono1ape io3tytfaDrl( o u4 rtnmf3oydlptranvo;() eurxm3nu1ope mivsa() 2tau  no4ape mi3tasls2uln p;u)tlxrmo3oadop e n o (0tetmxo oodomenmiesls aDumxr oo1oleniieild mDemuvo;u0 leomo iatfat aivs;t trto(o3iu4altnmnet t) 2rmx poo4alx miciat mDranvpn() rtomf3iatlpteln ils0 2xmxm3nu1llt lfes (  Durxroou4opt mfciad s ranvont)tetoio3iy1fmD aneo;t trtmimpiydlmenlfeta() Dta(  nt0opx ifciad m elnvs t4artoifcootopDraieo s  euoxr io1lm elieslsfsDrr(m ;o0aptomoctadfsDrmnmo ()trtnmo3iatoateanvi;s)t2xoim iy4op  mfetl( sruru oot4alt mieiltls uan s;t4arermr ta1oaDeau s t0 rxm(o iydoltnlneiat)a2tr(  ;o4alt  ietldla ran p;()tleoir iatlmD aueo ( trxoirpoy4lle  ivsa()srtrumpnt0tlt  f3iysls el(vpn(4alxrir tadoatrlnvsl(0texo(o3oydaleelnci t) 2rm(  ;t0alenio3tydlmDuluvpn() leoifciotlm elues;s0trxmxm3ou1opt mfct sf rumxrpno0oeeoiietatfa2ul( o (0trtnio3oo1faD  ivil( srtmio3ny4oltnlfetl( s2um(  ot1aexn o3tltfsDuan s ()tetomocoa1lat anvo ()trxrio oy1omtn ictlt s2umxronu0alt mfciat sDrmnmo t4aeerxr iatfmDeluvi s sexr(r3iu4aleelfcsa()s2tmxr no4tltomo3iasfa umnvp;() exnxf3ootfmte uvo t t2toir3nu4ome lfvi ( aDrr(r ;o4texn feiysfm2ea( snu0tlxrioctodfaD  neslt sexr(rpio1ape  feia(  Durxm nu1ale  ociaslm emuvs;t)trerxf3oy1lpD  ivs t) 2tr(r3oodome lfeias)sDtrumooo0ole mo3ild m rln o (0aexomociy1lmDrln sl()texoxr3ny4amt mfcilsfaDumumpnu1ope  ietltfsDeau p u0tleoxr oo1oaD ln sls)trtm(r oy1al nmfcilsf Draur ;u1opxn
\ No newline at end of file
@@ -0,0 +1 @@
+ivil(  2trirpno1op   fcta() 2rmxr oo0aeen o3iysfsDem(vp () lenmr iadoate nvilt0teum(m iy1lp   iet (  Dtaxmo;o0oeeomietaslm uan o (0 rerir3iydfpD ai s;s trtmir3nudap n net sfa2urx poo0oexnif3iltfm uauvo t4texoirciodom  luvol( seum(opoydole mfes t)s2trump;o0tpen ieiat a uau o;t)arxoif iadlpDelu o;t0teumxo3oo1llee fvtat s2trurpnt0ope ifetaslaDranmo () lerxr3iy1omt lueo;()seuo(r ou4am  mivtltf Dta(mono0olt iiciyt sDulumsnu)altnifciatom rlies;s  rtoxo iudape lnvilt)artru p;o4aexo fctltla2emn s t0trtnmf oo1fpD aieo;s0 2umxm3oydaltnmnvilt  rumu  oo4tlxomicildfs2umnvs;(0 rtrif iydoatr nvs;s0 rxoir3oydom e ncilsfarraxm no1alx ii3ilt s2rlumo (4 exrir3iydlmDran s (0 euoim3oy1llee ivia(f rrrur ;o4openmociatfm2rmu pnt)alenmo oy1lpDeauei ( s2xr(m3nydlmee neilsf rtr(m oo4tltoii3tlslm ranvsnt4tleoxrcia1faDranvs t)t2ur(rpny1olee feil(fsDumu p;t4tex  oeiyt m2em(mpnu4trxrir oadfaD anvs t) 2xoir3ou4lpt lictas sDtrur ou4olxnii3tytla2umn s t0 rxoio oodla raneolt  exrimpoydaltn ncs ()a2ra(  ;u1apxnif3ild m el(mp t4trxrircoydlatelueslt)s2ur(r no1am elfviasfa2ua(mpnt4aeen ictldlmDel(vonu)trenmf3ty1fa r u i ()trtm(r3no4alt lnvslsf 2tmx  nu1opxo feiltla2ea(vo t4trenio3oy1fmtelnvo;(  euoxm nu4altnlncsat sDtax pno1ole ii3iasfmDraumpnt4altnxr3ootfaDrauei s0seuoxr3nydllee ietl()aDrmx pou4olen ictydfm2em(vs;u0 rtnio3iodoaDelnvsls0 2toimpiydlmee nes s s2uaxmp;o1apenmf3ild a2rmn p (0altomo3oytoptrau sls0trum(rpnydopenmneilt) Dtrum oo4alenmf3iad s2rm(mpnu)aexomociodom  livols)tetoxm3iu4al elncsltfaDumumo;u0aexn fctaslsDel(vpnt0arxnmrctydfmDrlies;(0 etrir3ou4omt  ietls s2umu p;o4opx  icildfm2rmums t4trxnxrcoy1la elnvil(0 2xm(m nydoltn nvt ( aDta(r nt1olx mi3iydls2eanmont0altrmo oadlatraneslt  2xoxm3no1ap emieta(f Drr(rpnt0alto f3iatfsDea( onu) lxnxo3ootomDr u s s) rur(m3ou1op  lietlt sruaumpot1oeto oeilslsDum( s;u0alxrmf3iadlm rlnes;t srto(r3ny4ap  lncilt) 2tax pot0aet miciytfs uau pn(4alxoir iadlpt ai o s0s2tm(r io4lleeliesltf 2tax pou1opt if3iydfs uauvsn()trenirciytom  auei s)sexmim3oudlptemfvia(fsrur(r oo0alxoif3iytfs eauvpn(4aetrmrciatlpDrlneslt)trtm(o3nodlptemfes s srrrur ;t4oee  fctatla2rlnvo u)tltriocta1faDe n s;()t2trxr3ou1lle mnvtls  Dtrxm nt0oeen o3ilsfa rl( o u4 rxnxo todfpD aneil()srtoxmpiy4ameelnvsa()srrmxmo;o1aee  fctatlaDum(mo t4aetrxocio1fpD lu ols setr(m3ou1lle  icsa()s2urxmo;u4texnmoeiys m em( pnu4aetnmr tatfpt ai i;t)trtmxmpno1lptn ncs s)s2uaum ot4tpto oeild mDel(mo t0trxomf3ootlm ran o;(  etm(mpoo1ome  feiat)s2uaxrpoo0alx mocild sDemuvont0tetnmr3iodop eaieo;t0srtriopiy1altemictas aDuaurpot4opxo ociltlsDuanvp t0 rermo iy1fate i ols  etr(m oudop n icta( srumumoot4oetoioeiasfa2rau on()alxnmfctadoaD  ivs ( teuo(o3ny4olenlict s)srtau o;u4oexn ieiydfs um(vpn(0tlxrxfcoa1lptr u s;t  rxrim ou1lle  icslsfsrtau  ot0apx micilslmDum( pnu4 reomfctotlpt  ueilt)s2umxrpnudap n ies sfsDtrx p;t4oee  ieiatfmDrmumsnt)teermo3oy1opt lueo s) eur(m3oo1ll emfvias sDrmx  ;t0oexo octltfaDuanmpn(0arxrxrcootfa r nei;(  2umxrpoy1apen nvt ( sDtm(m ot1oltnifeild m rmnms u) eenmo iodopt aivo t  2xo(r3ny4oltelnesas  2taxm nu1ape ifeils a umu p (4tltomoctodoptelnvi;t0srtmxr3iy1lp   fctat) rra(m no0aleo ieiydls ea(vo u0arxomr todlmteli i;() 2to(rpoodam nmncta(faDumxmpnu4opto i3iatlm2ean s u0 lerio tadfpD  iei t0setmxr3iudoltelnct t)arrr(rp;u4oeeoii3tlsfm ran pn(0 lxomfctatoptrlues s texoio oudal e netls  rum(mp;t1apt mictasfa2ea(vonu0 rxnmr3iodfpteauvol(0 etm(m nydap   fcias srurxmo;u0teto ocilt aDel(vp t0 ltnir3iy1lp elies;s trumir3iu1lmenmncsatfsDta(m ou1ale ifciat sDumnvo;(0tlxoiocoadoate nei ()s2xmxr no4lme lnvtat)a2ra(moot0opxn ictydla2rauvs t4alxnmr3tadopte neo s)tetmir nydalt lnviltfs2rrxmoou4texoio3ilt a2ulnvont)artrmo3oytla  lues;t0s2ur(opiy1am emfvtasfs2ua(mpoo4aetniocilslm eauvs (4aetoio oo1op raneols t2toxrpou4ameemivs tfa2uaxmo;u0alx ii3ildls2rm(vs;u)altoir iadfmDelues t0 etoxo3io1lme mfetlt aDrm(rooo0oee  feilt m emn s;(4 rxnmo3tydoptrluvolt) 2xrio io1open ict t) rumumont4aex mociydfmDrm(vo;(0trtnifciatfaDelnvils trxoxrpiy1ap  lfvia(faDraum nu1apxnii3iydlm2elnmonu) lxnmr3ootfat aivi t)trxoio3iu4omee neilt a2ta(mpou1tpx mietlsls rmu s (4 rtnxf3iodlptrln sls0trur(opoodlm nmfvs ( sDrr(root1aleo feiydfm emnvsnu)tetrmfctodoa eaneo;s)trurxo oodal  mnctasfsDua( p;t4texnmieilslm rmn p (4aexomf3oo1omt  n i;t trumio ny4om  mieil(fsrtaxrpou1oleomfeiadfa2emn o u)artoif tydfaDeluvo;t0 rxo(r nu4alt mnvs (f 2rmxrp;u1oetomoeiad m eanvs;t4 eerxo3tydlmDeln ol(0s2tmxm3iydal nliet ()aDra( p;u4tpxomf3ias aDrlums u0trxrxo todlpte uvi t)s2uo(rpiudol nmnci t)s2ra( pnu4tpe  o3iyd m2ua( sn(0tetnircio1opD au ols s2uo(o3nu1ole mneilt)aDuaurpou0tleomociytfm em(mo ()tltoxr iydoa ean slt0t2urxmpiu4llenlnctl() Drr(  ;o4aee mf3tydls emn p u)tetomoctydfpt  ies s) rtoxrpoo4amt  nesls aDtrxrpot4apxo ictytlsDrl(vs;u4trtnio oy1fmD an i s0 etm(r3io4olenlietas s2tm(  ot1aeto ietls a ulumpn(4arxomocoa1fpte nei t0s2tmxr3oudamtnmnei (f Dtmx oou1texomieiytfmDuanmpnt0tlxrxfciy1lp ranvs;t0 rtoxr ny1lpt  ics ( srtax pno4oeeoii3tyslm2eaumonu)texnxr3ty1oa  ai slt)s2ur(r3no1amen nvias  Dua(r ou0aexniicias s2um(ms;u) rermf ootlat  ueils  rtmxo no1altnmiei (farumx  nt4olx iiciydfs um(vo u0artomf io1omt  ueo;()sexoimpno1omeemivtl( a2rm( o;u4opt if3iatls emnvs;u) lenxf iytlpD aueo t)sexr(m iy1opeemfvi sfaruax oou1apxoiiciadlsDrmuvs;(0arxnxr tydlatrau ils srumim nydolt mivt s)artaum oo4oeeomfeiatlaDua(vpnu4 reomrcoydoa rluvslt)trtrxm oo4omtemfet t)a2rmx o;t4oleoioctyd sDumnvsn(4trtrmf tadopteai slt0 ruo(m3oodapenlfvsasfaruaumoou1aetoiictltfmDul(vp u4 reoxrcoodfpDeauvi;s) 2tm(m3oodom elfei t)aDtaxr ot4tpto f3iyt a2uluvp t0tlenmo iytfm raiei;s0 eto(r3io1altn neia()arrmx p;u1tle mo3iltls uauvs;(0altrif oatfatelnes;t  2urio3ou4ale mncsa()sDuau o;t0apeo i3ilsfa emuvont)texnxf io1op  luvil(  rxmio nu4op emneil(fsDtmx ooo0aex  ocilt a ulu o u0trtoxf iytomt anei;() exo(r nu4lptnmics tfsDurxmp;t4tlxnmoeiltlaDrmn p;t)trtoir3iodlmt li olt)teumxr nydapt lfvt s)aDumuroot4tetoii3iasfs eluvpnu0aetnxociadfm e i o;s tetoxm3iy4lme  ivilsf 2tm( onu4tetnmfctlsfa rluvo t)tetoxo3ta1oatranesl(0 2urxo iu4op n fei s  Dtmx  no1tpxoiictat m ea(mpn(4arxrmr3iodlaDrlnvi;(  rxo(m oo1omt livtls sDua(m nu1tex ifcildlsDea( p;u4 eeoxfcta1om   i slt0tetr(o3iudam e ietltfartrxr ot4oexomieiytlaDrauvs;(0tlenir3iadlmD luvs;(  rtmxm nudalt lfcsltfsrtmxro;o4tlx mi3tldlmDuaumsnt0 ltrif3tydlmteluei;s0 etm(r oudopen ictls) 2ra( oou0aleomo3iat m rluvp;()arenmf oytlpD aneil()seuo(r no1alen iesls artm(  nt1olxnif3iytfmDuauvp;u4trenif ty1fp  lnes;(0t2umxr ou1ol n nctatf rtm(mooo1tptnmieiydlsDea( p;u0aetnxo iydopDr ieils0 rxmiopou4alen nvtas s2rr(m ;o4alxomociyd mDrm(vont)tlenif3oytomtrlu sl( s2uoxo3nudlp   ivtltf Dum(rpno0tet ioctydla rmumsn()tltoio ty1lptr neolt) exoxmpiu4ap nlivs t) Drr(  oo0oltoifetltlm umnvp u4 rtnxr iadom e ueo (0tetm(r ny4lpeemfeta(fa2ua(r ;u4aetnifciyd a2elnms;(4treomo tadlaDraivils tetoir no1lpenmfeias) 2rrumpno4olxoio3iyd s umu snt0tleoxrciadopDraivolt0tetm(m oy4lm  lfcils)a2uau  ;t4tee  feiytfmDrmnvon()tltrxr3oodopt lneo;()s2xo(o oy4apeemivt ()srrrumpoo0ole ioeiatlm2emnmp;t0teermf3oo1lpDrauei;t0t2umir3oydlmee fcilsfa2rm(mont0opeoio3iasls ean snt4tltoxfcoo1latranvol( trumir3no1amenmfcs s  2ra(mpot0optnmo3iat m2eanmp ()altrif oa1omD au sls)srxoxopno4opt  icta( s2tr(r nu0tpxoioetlslm2rauvs u0tlxrif iodop r u s ( t2ur(o3oo4oltnmnetl(f Duaumpno1tpxoio3tytla2ra(vp;u0arxnmfctotopDeauvol(0 rtoim3io1optn fcs sfaDua(  ou4apx  ietydlsDemn o u)areoirciydlptraivs;s0 rtrxm3no4olt  nvt tf 2trx poo1apeoifeiltla eluvo u)aexoxrcio1fptrlnes s) rurio3iydolen fvsls) 2uaurpoo4aetnifctldfaDumu on(0teenmocootop elu o;s0seumxrpoydalee fvta()artau  ;u0aet  f3ias mDean o u4alerir3totlptr ieol(0teur(r no4aleemivta(f 2umx poo0ale ifcias m2ulu pnt0trxnif oydlpDraieols  rum(opnu1llenlnvias)s2ua(  nu1aee  fcildla2um( snu)tltrio3ia1opDeluvol(0 2urxm3io4lme mfvslt)a2rmxro;t0opto f3ils a uanmp ()alxrmfcoadopDrlneo s texmxopoodaltnliviasfsDtrxr ot0oleoii3iad m2umuvp;()arxrxr3oydoatrauvs;t  exm(m3nudol emfvi t) Dtr(m nt0olxomf3iysfa rmump;()trtoif3oydomDeaies;s0 2xoxr3ou4lpenmivsat aDtr(mpno0oltnmfeiat m eanmo;t4alxoxr iy1oateaneils) 2xm(mpiu1ol  mfcs t)aDta(rpnu4tptnmoctad sDemumon(0altomr iydlmDr uvi t) rtrxm io1lm  mfvt t)s2tm(mooo1tee ifciasla2rmn p u0texoxo3oadlateanes;t  eto(o io1omeelnesat s2rr(rpnu4alenio3tys m ean p;t) rxnxo3oa1lptrln olt t2urxrpoodomte fesasfsDrauront4ale mociyt a rl( on()aexrmfcoatoa   ieo;s0trurxrpnudlmtemivsl(f Drau  ou4alxo fciltlm2rl(mo () eeoxfciytopDe nvo;t) eur(r3iy4apte fviatfarurxmp;t1tpto ociadfmDua( s;t0tltnirctodlm e uvil( teum(mpio4am  lneta( s2tax onu1tltnmoeiasls2emuvsnu) eeomo3ootop   n i ( srxm(o ny1altemfetl( aDraxmo;o1tpx mo3tlt a emumsnt0tetrxf oytlpDeauvsls) rxm(r nydop nmnei tfsDrm(r ot4apxn o3tadfm2eanvpnu0trenmrcoadom  ai i;()teurxo3oudom  mfei t) rtr(moou1tleomfcildlm2uauvp;u4 ltnxf iadfaDraneo;(0s2toxo3iy1al nlneil( srrr(ro;o1tlt  octat aDelnvs;()tleoxo iatopDe ueol( trtmimpiy1optn ieslt) 2um(roou1tlenmfctldfa2ua( s;(4 eermr ia1fp e ivs;t)srumirpiydamte fesas s2tr(  ou4tlto fctlsfa el(ms;(4 ltrxo iodlp  auvsl()s2xmim ou1om   fvt t)artmum ;t1tltoifctyd m2ranms t) rtoxo to1fpte nvo;t) 2xoxr no1am emfvilsf Dua( ont4olto f3tytfmDra( p;t0tlerir iydomD  nes;s)t2uoimpoy1aptn ieiltf Drmx ont4alxoii3iytfsDrl(mp;(4trtomrciodfp r nvs;(0teum(mpoydol nlnvil(fsrrmx  ;u1teto octld s2raumpnu4 eenmr3oa1oa  auei ()tetmxo3ou4op nmnvtat)a2rmxm ot0ole  octlslm ean s;t0 eeomf3ta1lm rlu s (0 etrim ou4al  mnvi sfs2uru  oo0tlx iocildla2rmn s t4 rxoir3iadoatr ies;t0 etoxr3oo1lptnlnvt ()a2rm(m ot0ole iieiyslm2ul( o;u0aeeomo3io1fmt lnes;t s2xmirpiudamenlfviat) Drm(r nt4tle  fciatla2uanvs;u)altoxo oatoptran s t teumxmpnodlp n ncta()arra(  oo0tpeo fctltls rl(vonu0 ltnxf oa1fa rai ils) exmxrpoy4lptnmnvsl(  rtmxr ;o1tpxn ietytfs rln p (0 lxomociy1fmD aivolt  2xmio oo1om elfesat s2tr(mp;u4tetomocilt mDuanvsnu0aeenxo3ty1oat  ues s)t2tmio oo1oleemnet ( sDrm(m ;u4ole mfetatfm2ea(vsnu0tetrmf3iadlpt li o;(0trxrir3iy4lmtnmfvtlsfsDtaumooo0tpx mfetlt s ra(vs t4tetoxo tatlmDeaivs () euoio3no1ll  mieiltf rtm( pot4tpx mfeiytfs el(mont0aexrxrcoa1oaDrlnei s0s2urxm iy1op elivsa(f 2rr(r oo1oeenmiciatfsDeanmo t)artriociytop r n i;(0teuo(r3ou1olt  netls)arur(rp;o0tpenmieiltla rl(ms t0tetoxf iydlmt luvilt0trurim3oy1am emivt s)artrum nt0apenmociyt s2uaumo u0 exrmf oy1lp  lu i t)t2tmxm nu1om emiesls) Durx  ot0aex mi3iyd s2uluvpnt0tlerircia1fp eanvs;t0s2urim3iy1openlfvsls  Duru  nt1oltoio3tyt aDrmn ont0tlenxr iotlmD luvo;t0seumim ou4opeemnes t  rraum oo4tptnmiciadfm emnms (4alxrmrctydop   u il(0srxoxm nydopt lneils aDtru o;u4ope  oetls a2el(ms;(0tlenif oy1lm raiei;t) rto(opou1lle  fcs ()arta(rp;u1oee  oeiytfs2eluvo;(4tlxoir ta1optr ieil(  rxoio nudlmtnmncta() 2uaump;u4aleo o3ildfa2ua(vs u0artrir iotoptraivilt seumirpoudoleemicslt  Drmu onu4apenmoetld s2umnms;()aexomr iy1la e u o s0s2uoxo3oydap  mietlsf Dururpno4tpxniocild aDra( p;u)aetrxf ty1fmDe n slt texm(m3ou1amtelfesa(  2ua(rooo0tptn i3tyd m2ran s t0tlerxrcoytfmt li s ( setrirpno1alt mnvt ()s2rmurpnt1tlenifeiyd m2uanvonu4arxoif iytfp rau sl(0teto(r3iy1lm  mivi (  2uaurp;o4tlenmi3iyd m uan s u)teerxo oatop elu slt0 ruoxmpoodlme lfesa()sDuau o;u4tlt  oetad s2umuvo t0tleomfcoo1lmDelueols)s2xrir3iodapenlnei ()s2rax o;u1tpen o3ilsla2elnvs;()alermf3iy1lm  ln ilt trtm(mpoodopenlfvta(fsDtrum ;o0tlxnmoctlsls eanmo;u4aexniociotom elivo;s0seuoiopou1lm  mict (  Dtaurpnt1tptoii3iytfa uau o;t4tetoxocia1lmt anvols)sexr(mpno1apeelictas  2tau oot4opxoioctld aDul( snu4alxnmo3oa1fp rli s;(0trxmxo3iydlm e ncsl(f 2tmum ot4oeeomf3ilt m2uauvs t0trxnxr oatop eanvo t  2tmirpoo4ap e fvils sDtau p;o0apx  octld aDuauvo t)tlxnxo3oadfatelnes;t0 2to(o3oudlmt mncta()a2raxr ;u1apeomietysfaDrl(vo t4tetrmfcoytlmDeaues t0 rxmiopnydop nlivs t) rta(root4optn oetatlsDulnms (0 rxoio3tytfpte ivo;()truoxo iu4optemfeils)sDumur nu0tlxn i3ils a2ea( o ()artrmrcia1lm rlues s) 2um(m ny1ome mfeta( a2rr( p;o1aleo fciydla2emnvp;(4arenxo3iytlaDeau i;t)t2xrxm3no1lptn ivia()arum(moot0oeto ociaslm2rluvp;u0aexnxf3oadoaDr n ols0 2xrirpoodomtemivtlsfsDumxmp;u0aee ifciat a uauvp;u) reomf iytlp rlu sl(0t2urir iydame  icias a2tm(  nu0tee iietydfa2ulump;u4 renmocoytfmteanvo;(0texrxm oudlme mfcs ( srua(rono0tpeo ocild aDra(vp;(0 exrmr3to1omD lnvils srtmim3iudoltelivtltfsDuaurpnt4tpenmociyt aDeaumsnt) etrio3tytoaD  ivsls0 2tm(o3iy4ope mncs t s2urxrpot0oleo ieiyd s2ea( o t4 lxnxo3iadlm e nvsl(0t2xm(o3iy1llenmfcsl(f 2rm(mo;t0oetn i3tyd mDrlumsnt)trtomf iotopD  uvo;()srtr(r3oudam e iviltfsrra(mpot4tlto feiytfm ean p t0aeeoir oadfmD  nvols)teurim3iu4apeelfcil( artm(ronu1tetnmoetadfmDranvp t) exriociydom  lnvi;s  2toim3oo4al e fcil()sDuaum ou0tpt  fetyt m ua(vpn(0trxnir3oytfa  ln i;(0 2xo(m oy1op  mfetls  Dumxr ;t4aleo ocild s2um(vsn()tetrxr3ta1fpt aivilt sexrxrpio1am   iei sf rurx oot4apxo oeiltlmDelnms;t0 ltnmr3tytfa r uvols0 exr(rpiy1om nlici ( sDtm(  nt1olx mfeiltfaDulnmp;u) etrxociatfp  aneo;s teurim iy4olenmfei tfa2tmx  ;o4opt  ieiadfs uauvpnu0trtomf3oydoptrln ol(0s2toim3oy1apt mnciasfaDtrurono0tpx  oetls s2umumsn(0arxrircoadopD  ues;() etmim oo1ale lfciat aDtrxmo;t1oeen fcildfs rau s;u0texoxo3iodomtrai o;t0sexrio3ou1ll n ivtat aDrrxrpot1opeomoctyd s eauvs;u4 renxf iy1op elnvol(0srxrio3iu4lltnmneias  2rrx  oo1tee  ieiaslm ranmsnt)tlxoxr ootlpteliei;s)seuo(opnudam  lfes sf 2ururpot0alxoiieilslm elu o;(0 ltrio ootop   neo t  eur(mpoydopeemfct s  Draxr ;t0aptnioctld a em(mo t4teenio io1op  aneo;(0t2toxm3iu4oleelfeta()a2ua(rpoo4alt  ictasfs ra(mpn(4trerxo3oydopte n s ( srumim nu1al nlfesas sDtau o;o4oltomictydfm umuvp;u)aetoiocty1lpD lneo;() rtmim oudam nmivsa(  rta( ooo1oet  f3iltfs2rmumsnu4aetoxf iatfm   neilt s2xmxr3io4altnlicil()a2urxmont0tlen ieiat sDemu p;(0trtoifcoydlp e n o;s)trto(o3oy4am nmncs (  Dtau pno4oleoioeiydlm elnmsn(0altnxo3iytlmtelnei s srxo(o iy4oltn nciat sDraum ;t4alen ieiytfsDelumo () rtrmr3totoa   i i;() 2tmimpnudopenlnvsat)s2uaxmpoo1oexo fcils s2eau pn(0tlenxo3oy1laDe uvi;s)trtrirpnu4ome mictls  2tm( pnt0oex ii3ilsfsDrl(vo;u4 rtniociy1lmtran s t s2xr(m3oydal  lfeilsf 2raxrpoo4tpx  i3ilslmDea(vont4arxnmrcio1fpte u olt tetrim oy1aleemfvi ( a2trxr ;t4oetn oeiytla emn s;(0alenxr3iotlmt livi t0srxm(o oy1lm   net s)s2um(rono4oet  fetad m rlnvo;()trtoxociotfp   ivo;t tetmio3ou4ap nlncsas  rur(r ;o4apxomfciytfm rmuvo;u)tlxnxoctydla e ueils0 exm(r3ny4ap  mfeiltf 2umump;t4olxomfctldlaDrlu p t)arerif oytomDr i i s s2ur(m nudamee fcia(f rtmxmonu4olxo o3iltfm2ulumon() leoxo ty1laDrlivols  rxo(r io4ol emncs s aDtmxr no4tleoiieiys m elu p;() rtrif3iytfp rauvi;(  2xmir io1al nlfesls  Dumuronu4tltoiieild aDuanvpnu) eeoirciy1lmtranei;s s2tmio3io1llte ict ()aruaumono0opeo i3ildfa2ea(mp;(0 ltnio ia1omDrlieol( trum(opio1llt  nvtasf Dtm(r nt4tee  iciyt aDul(vs (4aetrif3tatlp   neols)trtrio3oodlmtemfvilt  2rmumpnu4tpx mf3tydfm2uaums t0 rxomf3io1fmD an o ( setmio3iodll e nvsltf rrax oou4texomfeilsfmDeaumsnt4alermr3iydfmD ai il(0 2uoxr3no1al n nvil(  rtaxront4altoioeiytls uaump;u)aexoxo3oatlpDranes;()srtrir3iu4omtnlncia(  rta(mpnu1oeenio3tasfmDrmn s u4 ltoir ootoaDrauvsl(0teuoxr ou1lmeelncsatf Dtrxm no1tpeoioctaslmDem( o;t0trxomociydopt luesl() rxmxm3iu1lp eliesls aDuau  ;u1tpeo ieildfm2rau p;(0aeerif iadfa rauvo;t)seumxo iudam  miet s) rua(rp;t4optnmieiadfs2eau pnu)aexrxf oytla r i o s0seurim nu1ole  fvtas) rururoou0tltn fetltfa2eaump;u)altrifcto1om rlnvi;s)sruoim oy4oleemivt s sDrax o;u1tltomi3ildls umn o;() lerif iodfatean ol(0 2urxrpno1lm  mies s) 2taxm oo0teeoif3iyd mDum(mo;t)alermfcoy1lp eliei s0srtmxrpny4ll nmnctlsf rum(m nu0tlx mo3iyslmDumumpnt4aleomocoadlp   ivi;( srxm(m3oo1lmee nvt s)aDra(mooo4optoifctytfm2umums;u)aetomr ty1lm  anesl()texrxm no4om nmiet t)a2um( pot4tptoiictls a2ulums u) lxoxr ty1oa  lies t)sexoim nudapte ietlsf Dtau poo1apeomoctysfs uauvo (4 rtrxrctatlptrlnvols trtmxr3no4ol  mncsl( artrxm ;u1opt mi3ils s raumo;t4artoifciydfaDraivo;s0setmio3oy1lptnmncsa(f Drax pno4oltnmictltla2eluvo;(0arxrxr3ootfmt aues t) etoxo3oo1lle livtas) 2tr(m nu4optnmi3ildfa rl(vs t0artrxf3to1fp rlneo s s2um(m iodlmenmncia() Dtr(root0tpeoiictlsfm2um( pnu)texoifctadomtr uei;t) 2tmxm io4lm e nesat sDur(  no0tetoiociltlm2em(vsnt0tetoxfcty1fat lieo (0srtrim oy1opte fvi sf Drau  ;o0oltomietlslaDelnvp t) lxoxrcoa1omDrau o;s)trtoio no4omt mnetlt)sDum( pnu1tptomfeiasfaDua(vpnt0 eermf iadfp r ieo s)srxriopoudlltelnvt s artauro;t4tlenifetytfsDuau sn()trxomo3oodfaDelivol() 2tm(r ny4lmenmncsatfa2rr(mpou4aexo o3iyslaDua( snu0 lxoxo oodfpD lieol(0tetmxm iy4oltnlnvsltfs2trurpnt1optn oeilslsDuanvpn(4tltoif3tadopD  nei t)t2tm(m3nu1lmtnlfeil()arrrxm oo1tlt moctld a rlumo u0 etrxo totfatr n o t)trxm(m ny1ll  mfctlt)arta(  no4tltnmocildfsDra(ms ()aexomf3iodfmDrli i s trxr(o iy4apenmncsat  rrm(  ;o0tpxnmoctldlm eau s;t)tltnxfctodlaDr nes t  ruo(o io4amtnmnvtlt srta( onu4aex io3iysfm2rm(mp t0aeerio3ty1omDrluvo;s t2xmir3iu1alt  ivsa( a2umxr no0alen icilslm2rm(vo;u)tetoxf3iodlpDrlnvi t)trtr(opoo1amtelfvtlt srumxm ;o0aptnmfciadlm rln pnt)artrxocoodfmD  ues;s)sexmxr3no1llee ivsas srtrurono4aeeo ietaslm ea( on(0 rtrxo3oa1oa rauvs;()s2toxm3ny4al e nvil() Dtmu pot4alxo o3iad m rm(vo;(0altnmfcoydoa   u o;t0 etmxo ny1lptnlfvt (fsrtax p;t4tltomi3tlsls2umnms;t) exnmfcta1op   neo;(0trxrio3nydamte ivt ( aDrrxr oo1olto f3ildfm2ul( p t4tleomfciatfp  anvil() 2tmir iodlltnmnct sfsrra(mo;o1tpx mfciat m2eau p t4 ltrircio1oa e u sl()t2xr(o io1llee fvtls)a2ta(mp;u4oex  fetad sDrau sn(0 rtoir3iodoatrluvo t0teumir3ou4am   nctat)srraxr ;u0aetomictat sDemn s;u4 ltrmf iotfa  lnvi;t0srtrxr iydap emieiasfsDraurpnt0texniiciltfa2elnmont4tetrxr3oo1lpDrauvo ()srtrxr oo1ll emfeia()arta(roou4oexn oeiltla rmn s t4 leoxo3tydlmtrlies s0srxm(rpou4amt lnvt (fsrtax o;t1oexnmoeiytfs elu o;t) rerif ty1lmtraueo;(  exr(r nu1al n ies () 2umumpno0ope iictadlmDumumont4texoircio1fat lies;( seurxo3nu1lmee fcil(fsruaxr ou0oetniieiltfs2rmu on(4teerxo3ta1fm raies t0 exoiopny4ameemicil( sDuaur ot4tltoif3iatfsDeluvs;t4aetoirciotopDrlneo;() rxoxm3nu1al emnvias  2rmxront4oltoiociytfm umu o;(0 eenmf ta1fmtraieil()seurxm oudllen ict sfsDurxr oo1oltnioeiydla elump;t)alerxr3iy1fpDeanei;t) etrio iydoptnmncil()arur(  nt1olxoii3tadlm ranmp ()tlermo oo1lp elu i;t)trxoir3nu1amenmncsasfsDurxrono4oee  ociysfm2ran snu4 exnmf3oydlmtr uvo;(0 etrio iu4om nlnctat  Dta(m no1texoiociaslmDumn p;t4arenmrcio1fa  luvsl(  rumxmpnodlpe miei t s2ta(rpoo0tpen ociysfa raumon(0trtrif oodlp  livi t0 rtm(m3oo4lmtemfetls) rumu o;t4oeeoifeiyd m2ulnvs;t)treoioctytlpteanes;s0t2xriopiodapt  fvtasfs2rr(  ;t0aee  o3ils aDemuvs;(4tlerxrciytfa  livo;t seto(opnu4amee ieil(fs2trxr oo4opx  fetldfs ulump u)aetomo3ootoaDrlivi;()s2xrxo3oudalenmnvtas)sDtmur ;t1altnmo3iytlm elnvs;(0altrmo3ia1omDeanei t)srum(r3ou4apte fetl(  rum( p;t1tpt  ociydlaDul(vp () rxnmr3oadlm r ueils0tetrio3oy1opee nes t)a2umu pnt0apeo iciasla ranms;u0arenxo oydopt anvi (0t2umimpny1al e icias)sDta(m nt0aeen fciasls2rl(vo t4 ltomrciodoatrln i;s)teuoxopnydol nlfctas)a2trxmoot1altnmfctysfsDrlnmo t)altnio3ty1fmt  i i t) rxrxm3io4am e fvt t) 2rax ooo4aex io3ilt s2uln on()trtrio3tydfpDeaivs t0sexmxrpoo1amt lfetlt)aDrru  ou4alenmf3iytls2rau snt0texnirciytlaDrliei s0t2tmir3ou1ap nmivta(f Drmxmp;t1ale  o3iatfs2elnmpnt0 rxoifciadfm rlnei (  rxoxm3ou4lme lfei s) 2trxmono4apxn ictysfa umnms ()aetoircoytomDeauvi ( texoim ny1om   netlt)srrmxr nu4oetnmo3iydlm rln s;u)tlxrmf oydom elu ols0setrim3no1lmee net ()a2tauro;u0oltn fetyslm2el( s ()texnifcty1lp rlivo;t seum(o3iy1llen iesasfarua(r ;o1altomieilsfm eauvp t)tetomr iodoa eau o s) rtmxm oo1oleemfvs sfs2uaxmpnu1aptnmoctld sDrmuvs (4trxoxf3ty1omDeaivilt0srumirpiu4op emnvt (fs2umu pno0olenii3tlt mDel( pnu0aexomrciotfa raivi (  rumxopnydam n ivt ()a2umxrono1optomi3tltfm2rmnvs;t)aexrxf to1lat aiei ( tetmxm3oy4olee feta(fa2rm( pnu1ole  fcilslsDrmu p;u4 ltrmf3oa1lmD lnvo s) 2uo(mpiy1lmtnlncil(  rrrxmpnu4tle ii3iyt mDrmnvs;u) leoif3iydfmDr ieo s t2xrxm3nudal  mivils)aDtmxm ot1oltn oetltlm em(vpn(4 lenir3iotfmtr ivslt0s2uoxr3nu1om elfvi sfsDtrum ;u1apen ieiatfsDraumsnu0tetrxf oa1fp   ivslt)trxo(o3nudal nlfvs s)a2rmx pnu4alxomoetas s2ulnvp;() ltoxr todomD  uvs;t  ruriopiu4am nlfcil() Durur ;t0aexn icilsfm ea(mp u4 rxoxoctadoaDe u o ()trtr(m3oo4lleelivs t  Dtrx pou1aetnii3iysfaDemu s (4 etrmrcoatoaDrlueo t)tetm(r3no1lle lnviatfs2rmxmpnu0tpenmi3tydfa elnmsn(4 ltnmrcoa1oa r nvolt)srumxmpno4olenlnctat s2ra( poo0olenmfctysfm2emnvon()alenxo3to1fateaivols0 2xo(m iodamt mivil(f 2umurp;t4opxn ieiys aDrlu on(0areoxocoa1fp e uvo s0 eum(o oodopeelictlt)aDra(  ;o1tptomoeiysla eauvs;(4 eenio3ta1oa   uvo (  rumirpiu4om nmnciltf 2raxmo;o4tpe ioeiyt a ea(mo (4 lerir3ta1lmDr n i ()truoxr3iu4op  mics s sDtr(m ;o1olt if3iys a2el(vpn(0texrmrctotop elnes t)tetm(rpiodaleemnet s aDrmxr nu0opxo ociadlm2ra(vsnu4artrxo3totom e ivo;( tetmiopnudopee ies sfa2umu oot0oexn octls s ulu pnt) rtrmo iatfpD  nvi;t0 rxm(r nu4amte fvias  2tr(mpnu0tpenmf3iasfs2rl(vonu)altrmr oatlm rlnei s)s2urxmpnodoptemfvt sfarua( oot4opt  o3iadlaDuln onu4aetnxr tatop rln o (0 2to(r oydlp nlnviatfa2trx  nt4aee mfeiys m rmn snu4 eerxfcoo1lat anes () ruoim3iy4llee nviasfa2tmu pot0aex mociys a rmumpnu4arxnxo ia1fatelu s (0s2umim nodopee ivt (fsrrr( pou1olt mfciasfaDumnvsn(4 lermr io1laDr i sls0 etoir3ny4apee nvtls)artru p;o0opx if3iytfsDrl(von(4aexoirciodfaD  ues (0 euoxo3oy4lpe  ivtat)sDumurooo4ope mociat sDuanmon()arxrxo3todlm e uvo;(0 eum(o3iu4lptn nvt t s2raump;t4oexnmf3tltfsDuauvs ()artnif3oytlp rlnvs;t  rxmxo nu4ll  lfcs t)arraumoot4tetniieiyslsDeanmo t) rxnmrciodlmt ln ols s2xr(r nodal elfct s  rta(mp;t4olenioctas sDrmumsnu) ltnmf3iotoa  an s;() euoxrpio4apen fcia(fsDuau oou0oleo icias sDeanvo u0alenircty1fmteanvi ()trumir3ny1opte nes ( s2umx  ;t0oltn o3iydls elumpnu4trxnmocoytfm   nvi;t0 2uoiopny4amen fei (fs2tmumo;t0apen o3tlt a2em(mp u4alxoio3iy1laDeanvi t)teurxmpio1omtelietl()srrm(mo;t4altnioeiysfaDrl(mpnt0arxnxrciatopt lnes;t teur(m3nu4alenlnvs s)arrr(m ;o0apx  ieiyd s ulnmon()tetnmrciodopD  n i s texrio3no4apen feiat)a2uaxro;o4texnii3tys aDrmnms;(0 lermo oy1lat  ivi;( tetr(mpnu4ap  lieilt)s2tmump;o1opxn ociyslm ul( s (0 lxrxf iatopDe neslt s2toio3oo1oltnmneilt)s2ta(mpnu0tlxn i3tadfaDeanvpnu4tlxnir3todlmteauvi (  exrim3no1lptemfvilt sDrau ooo1aptoiieiat a2uauvp;u0 rxnio oydlaDrlivo;t srxr(o iy4lme lnvta(f rtr(m oo1opx  oeiad aDrlu s t0aleoif iatfp rluei () rumxopnydam e fvsatf Drr(mp;o0aleomf3ilsfa eau o (4 ltrxfciy1op r nvslt srtmxr io1ol eliesa()s2tm(ro;t4altnmfeiysla rmnmsnt0trtrxf3oo1omDr i olt0t2umim oy1omtn neiltfs2uaxmo;t1aexoiieiysla2rluvs;(0artrir3io1fm eai i;s)t2tmxm3nydal  mnvslt  2rm( o;o1aptniiciysls eanmpnt) lermr oodlmteanei;()s2xrxo no1amenlfcsas) 2rm(rpou1tpeoiociatfmDean o t)artrio3ia1omtrai o t trtmxr oy4am   fei s)sDuaxront4aeeniocildfa2ulu o;t0 lxrmf iytopteln ols0setrim oo1ap emieiat  rra( o;o0opx  o3tltlm2emnmo;u0tleoir3io1la  liei s)s2ur(m3oy1amt miciasf ruaum oo4aptomieiasfm ua( p u)tltrmrcoytlmteli sl(  rtmir3ny4ape livt tf rrax  nu4openiieiytlaDrmu sn(4teeoxo3oydfa rau i ()trxmim3nu4ole  nesl(f 2urum no4apx mi3iaslaDum( p;u0 rxrmr3todomte nvo ( tetoxr ou4lme  fcta(fs2uaump;t4oee  ictyd sDulu p;t0 rtnxo ootlmD an ol()tetm(r oudole  fctl(fsrtmurpot0tpt mocilsfa eau o (4 lerir iy1omt  uvs;s) 2umxr3nu1amee ivt s  2rm(mooo1oet moetydfs2el( s;t4arxnxf3ty1lptr nes;t t2tmxr3iudope lfvs (fa2ra(m ;u1apto ictadfm el( o t0aeeomf ootfmteaies;s) 2to(rpny1ap e ivtlt) 2taxmono1alxniicild a ea(vpnu4tltoxr3ia1latranvilt0seurxr ny1altn nvsas  rua(r ;u1oet mieiadlsDua(vs () etoif ta1oaDrlnvo;( texoxo oo1lpe  neias)srur(rp;t0tetnmi3iltfa rmnmont)aetrmfcoadopt  ivs;s)sexrim ou1op nlnctatfsrtau p;u0tltomieildfa2emuvont0aeeomrciatoatrln olt0t2trxr ny4lmee fet t aDua(mo;t0tpe  ocias mDemu o t0 eenif3tadomte neol( t2xmio ou4apee nes tfs2rrx o;u4aexnmi3tlt s rlnvp;t0alxnmr oatom   u s t teurxrpoo4ape lfcs s)srtr(root4teeoiietyd s2eauvs;()altrxoctodfa rlu o;t0 ruoim nodoltnmivtas)aDra( pot4ale  ocild a2emuvs;(0 rerifctodom rlnvi (0trxoir iodal n fcs s)s2rmum nt4altomictldfsDeanmon(4aexrifcoatfmte nvilt0srur(r3nu1alen ncsat a2urumono0tetoif3tldlsDeluvpnt4tlerxo3tadfatelneo s0sruoxmpnydlp  lfeiat  ruax ono1tpen f3iat m2rmuvp;u0trenifcoa1fmt lnesl() etrir oudaleemneiat sDrru oou4aexoioctadfs2eauvs;(0trerir tytfa eanvo s) etmxm nydom n ivt sfaDurx oot4oee  o3iatfs2rl(vpnt4arenmf oydoptrln ol( texmio oydap e iet t  2rrxrp;t0tlt mi3tldfm2em(mp;(0trtnxocoo1lmD ai ils)texrir oudale mivs sfarrmxm ot1ope  o3tys m el(mon(0 eeomo3io1fa eln slt teurxr3iy4amte ieil(fsDtmurp;o1aee ifetatla2ulumsnt0trtnirctytfpDelnvs;t s2uoim3io1llt mnvi tf Dua( o;t4tetnmiciasfaDra( s;u0trtrifcoy1op r i i;s) rtoim iu1lptnmivsl() rrm( o;t1olxn o3iadfs rlums;(4 rtrmfctodfm  lu i;(0trxrx
\ No newline at end of file
@@ -0,0 +1 @@
+u i s)seuoxm oydop e nvta()arur(m nt1opt ii3iydlmDrmnvs;(0trtrxr3iotopt aivo;s  2xoxrpiy4alenmnct ()a2trxr ot4tlxniieiat m2umnmpnt0trxoifctadoat aieol(0srxmim3ny4al  mnesat)arumur nt4tpe ioeilsfs rauvp (4tetnmr ootlpt luesls0 2xm(opio1alenlfetl(faDua(  oo0tptnio3tytlaDua(vont)arenmr oytopte ivolt0srxrim no1oltn nvs () 2uaump;o1olxnmictasls2elu o u0aexnxr3oodopDeau s (  eto(o io1ap e icslsfs2tmxr ;o4alxoif3tyt a2rmuvsnt4 ltnxo3oadom   uvol() rxrimpio1am  mfci (  Durxmonu1apxoifciatls emn pn(4trenir3ta1fa rlueolt  ruo(r3oy4lm   fcs s)arumxmpou4oeen fctydlmDelnvs;(0 ltnxoctotla elu slt srxoxm iodoptemncta( aDrm(  ot1tpx  ociasls2elu o;t)arenxfciytlat li o s0s2uoio iydomenlnesl() ruaur oo1ale miciyd a ea(vpnt0tltrmocoadfaDeaivo;t trtrim oy1al emfcs s) 2ra(  no0teeoif3tydlm2raump ()altrxr tydlpD lu ols  2xoimpio1am n ictls)sDumxm nt4alxo oeiat aDuau o;t4teeoifcoa1opDe n i s)trxr(rpoo4lpte fcils)sDrr(moou0oexnmi3tasfm2umu o u4trenmocoytfm r neils0 rxoiopoo1opt mnvsl(  Dtrxm ou1aexnifciatfa2uau o t)texoio3iodop   u slt0teto(m iy4ape liei ()aDtrx  nt0oetnii3iad aDrmuvo t0alerioctydopteaivo;( tetriopnu4llenmneils  rtmx  ot0texo f3iltfm em( o;t4 eeoio3oydlpt lies t0seto(o iy4olenlfvsatfsrtmumo;o4aeenmiciatlm2ulnmo t)tlenxr3tytlat  uvo;s)setmirpiodllt  ivsltfs2tm(rpnu1olen oeiyd m2ranmp ()alerifcootoatrai o s)trtoiopny4ape lieiat sDrax  nu4tleo fetyd s2emnmo u) rtoirctytfa e neo s)trto(o iudlptn fvsls  rtrx poo4oetomi3ildla ranmp;t) lxrmociatfatelnvils0 rxo(opoo4oltn net sf 2rrx  ot0oeenmi3iytlaDeanmpn(4 renio3ta1fm eli s;s  rxmxmpou1ome  fcslsfsrtr(ro;t1tet mi3tadfmDrlumo;u4tetrxf ia1lpDrlu il( t2tmxm iy4aleemivs s)a2rmu onu4tptnmo3ild aDean o u0arxrir3oydfmDelnvolt) etmim3oydaptemivt s) 2umu oot0apx mf3tytfa umn s () rtnmf3oo1lm   iei t)t2urxmpoodol nmnes s s2tm(mpou0tleo feiyd aDumumont0trxrif3oa1lpt  uvi s0trtmxrpio1aptnlnct ()aDrax  oo4apx mi3iatla2ua(mp;u4tleomf tytlpDr uvs s trxr(mpno4ameelfct tf Dtau pno1tlt mfciyslm ul(vo (4 ltoif iodfat aueilt  etrirpiy4lltemnetat)arrrumont4oltnmocils sDrlnvp t4altrif tadomteluei s0 ruoxmpio1omen ivs tf rur(ro;o1tlx mfctysls ranms;u4 exrmo oatomteanei;()sruoim3oy4llee ncilt)artmu  nt1tpenifcilslm2ul(vp u4tetoir3iydlaD au i;t0srxmio ny1apt licil()aDta(rono0aeto ieiytlm2rm( s;()trxnxfctotfmDraies;s t2uo(m3iy1llenlivslsfartrx ono1aex  fciadfs emnmsnt0teerif oatomDrlueslt0 2tmimpiu4llen ivt ( a2ua(r nu1tleo icias aDemn snt4texrxr3oodlp  lnvi;s  2umxr3oo4apt lnvsls)srtaxmpnt1olxniicilsls2ea(mo;(4aexnmr totoaDelneo s  exm(o ou1ale mici t artmum nu0tetoiieiat s2emuvp t0arenif totomt lu i;()srxrim3oodll   ietl() 2tru  oo4oexo feiadlaDem( snu4aetnxfcta1lpt aies;(0trtoio3ny1am elfes (fs2rrxr nt1tlxo i3ilt a2ra(mo;u)aexrxfcty1laDe uvi;t seuoio3iy4oltnmnesa(f Dur(moou0optniociydfa rln p (4 ltrmo3tadlmteluvs ( sexmxmpou4lptnlfetlt s2tmx ont4altn f3ias mDelums;t4tlxrio iodlpteln sl(0s2um(r oy1amee nesltf 2rr(  ;t1tlxoio3iat sDuanvsn(0 eenmf ootfaDr n olt0seurimpou4ope mieias srrm(mpno0tlxn ieiyt m emnmpn(0tlxoircootlm   i slt)s2xrxr3oydap n icsls)a2taxroou1alto feild m rlnvs u4 exrifctatlaD  neils0sexrimpnudapteliciasfsDrau p;o4tpx mfciysls elumo;u0aleoif ootla eanvi s s2umxm oodom emnct s) 2rmu  no4alxomo3tadlm emuvo;u)areoif oy1lpDeaneols) rur(r oodalen fctl( aruaxrpnt1teenio3ias aDuanmo;u) rerio3iadlm rlneo;s  exrim iu4lleemfvias)artr(mp;u1aeeomiciyd a2emuvpn() ltoxf tatoa eaieilt0 2urxr3ny4llee net (fs2ta(  nt0oltnio3ils s2rmuvs;t0 lxrifcoadfm r i s;t)s2toio3oudlltn ietlsf 2tru  nu4tee  i3ias sDulumo;t)arerir todoa raieo;t0t2toio oy4lpeemfeta() Dtaxrooo0opt moeiat aDrluvs t0 rxnxo oytfa rlnesl(0teuo(rpou1amenlies t)srurur ot1alxn iciytfsDea( s u4aeenir3oydlm r iesl(0 2uoxmpnudlleemicta() rum(ro;o1oleoiociltlmDumn ont4 exomo3io1opD anvsl(0 2uoim ny4lm  lietat)aDraumo;t1apeoiiciltfm eau pnt0areriocoytopDeaueols  ruo(m oo1ap nlfei sf ruauroot4teenmociatfmDra(ms;(4 ltnmociatfatrauvsls  2xm(o io1lm   ici s)s2taxroou4tpe  o3iyslsDrm(msnt)tltnmrcty1laD lueils)trurxm iy4llenmfvs s srtr(  ;t0tptnmocilsfm rluvs u4trtnmf ta1fat aies ( s2toirpio4ale  nvilsfsrrax p;u1oexoif3ilslaDuluvon()alerxr oytoa e nvilt sexo(rpiodop nlfvtat aDtrump;u1ole iociydfs2rmnvs u4tlermr tatomDraies s)t2xo(opoydoptnlfvtasfsDrr(monu1tlx mo3tasfsDel(msn(0 lxrmr3tytfm  aieo s t2trio3oodope mncsatf rrm(rpno0tetoiietlsfmDrmu s t0aexnir iotoa  lu o (0s2tr(r3iu1opeelnet t) 2taxm ot1olxo ietatfa ul( p u)tetnxr oadlp rluvs ( truriopny1ap nmnctltfsrta( pot4apto iciaslm2emump (4 ltomrciotfp  anvi s0teurxo3iy1ame livs s)a2uaxr ;o4aptomi3iad m ean s t0 exrifciotoa  li ilt)seuoimpou4amenlfvias) Dtaum nt0apx moctlt s2elu o;u4 lenio oy1oa  li ol()srumim3oydamtnlieiatfsDta( o;o1opx ioctyd s2ulnvpnt)tetrmf3ty1lmD  neo s0 rurim3iudlltnliviat)aDrrxmp;t0tpx ifctad mDranvo u0 etnmfcio1lmD an ilt)s2xmiopio4lpe lfctat aruax  oo0tpe if3iydfaDuln o u0aexrxo io1oat  ivi;t truoim io4lptn ncs sfsrrm(m ;t4tleomiciytlm2ranmo t0 ltnmfctotomteanes t0 2uoxopiudopeemietl(fartm(mp;t1oet mf3ildlm2eau s (0tlenmfciotomte ivi t0srxm(opio1ll nmfcsa(  Dtaxmpou4tlx iictytls emu o u4tetnmfctadomDelieils trumxm no4olee iesa()srur(mp;t0altnioeilsfsDra(ms;(4arxrxociodop raues (0t2um(mpiu1alen fetlt)srtrx  nt4apxoifeiadlm emuvs;u)areoio3iadfmtr n il() ruo(r3no4lmtnlnvi ()a2tmuroou0olxnmi3iatlmDrmumo u) reoifcio1op e u s ( t2tm(o iudamtelivtls) rrrx  ou4opto fciyt a2rmnmsn()alxrxr3ootlmt  i sls)srum(rpou1omtemnct t)sDtm(m ;u0alxomoeils mDrmn p u4tleomf iodomt anei (0srtr(o3oo1omte fcils) Dta(m nu4tlt ii3tat m rl(mont0 exomfcoo1fpDr ues s0teuoim oudoltnlnvsa()a2rau pou0opt  f3iytfa eau s u)aeenmr3iotfpteaies;s0tetr(o3nydam e fcsasf 2tmuro;t1aetomieiadlm2el( s t0 lermf oadoatran ils)truo(m3iydol emies (faDrr(mono4ape iieiatla2uaumo;(4artrxrcio1op elieols)trxmim3nodome  fetls)a2rmumoot0opt if3iydfaDumums;t)tlxnxf iy1lptrai i;(  rum(rpio4lmt mivsltfsrtmumpno4olxomfeiatlsDrlumont4teenirciy1lmtrau sls  2xrir iu4oltn nesl()a2taump;o0alt mictys aDrmn s u)tlxnxr iytlmtr i ol() rtmxm iodap nlfet t arumu  ;u1tlx mf3tadlm2rmnvon()trxnxfciadfate uvs;t)trxrirpiydlpt  feia( sDrm( pot0tlxoiietyt aDeau o (4 lxnxoctotomDe nvols srurim3oo4omeelfetatf 2rmum nu0tpeniiciltfm2uanms;u0artomr oo1oat anes t s2to(r3no1optelfvsl() rum(m ;u0aet  o3ilsls ulnmsn(0alxnifctodlmtelivsl()srxoxm io1ame  net ()aDurxr ou0aeenmfctysfsDrluvo;u0trenmrctatfpD aieo;t0setm(r ny1oltemicias)artax ooo0ale  o3tad a2uauvo;u)aetnxf tatoat au o;s0tetmxm iodalt mfct t s2ur(mpot4tlenif3iatlm2rmnmo u0 rxrmf3io1omt  ivo t trxrxm3nodlm nlneil( srur(m oo4teto ictltla2emnmonu) eerxf oo1fpDranvils0 rxo(r3no1aptn ivtat) 2raxront1tpxniociltfaDuanmp;(4trtnir3oatlpD lnvi;(0t2uo(r iodol e ivsa()aDuru o;u4tpe mo3iltfa rmuvpnu)tltnio to1fmteaivi;s)s2xrxopny4lmen nei s a2raxrpnt1tpto f3ilt m uauvonu)trxoir3to1oa raues;(0 2urxrpnu4lptemfeilt)a2rmx ooo4aeen ietldlmDrmu o;t0arenif oydom  aieo;s)srum(m ny1omt mfetl() rumxr ou1optn ietld a2emnmpnu4areomf3iatla r ieo s0 2xrxr ny1ale  nvs (  2tr(  oo1oeeo ieiys s2eaums;()artoir3tatopteli olt  2tr(opno1op   nes ( a2urxmo;t0teto o3ilsla rmu p t0 rxrxf iy1omDe nvs;s)trurimpiu4lpenlies (f 2tmumooo0apxo ieilsls2rau onu0tltnmocoo1oaDrau ols0 eur(o nodop elicias) 2urx  ;o0altniocilslaDra(mo u) lxrio3ty1faD anvo;(0srxr(m3io4am n nei tfs2ua(  nu1oltn oetytlsDrl( s (4teermrciytlatelieo t) 2toio3io4om   nvtlt sDrax o;t4tpt mfeiltfs2uaumo (4teerxo tytlpDraivs s0setmxr iu4oleemnesa(fsDtrurpot4alenmi3tld aDeln sn()trxrifcoo1laDeaneslt) rtmxm nodlmenlivilsfsrrr(mp;t4tetoii3ias m2ra(mpn(4alxnxr oodlm   neo;s) 2umio3iu4ame lneslt)s2taxmoou4oet  ociasfs um( s u4aeermo tytfaDr uvi;s0t2tm(mpiy1ap   ietls)aDtm( p;u1apxomietaslmDemnmo;u)tlxrmoctadopDe u i s t2urir3oy1lp nmiet t  2urxrpot1oexomoctysla rm(vs;(0 ltrxo iatoaD lnvi t) rtoim ou4apenlnetltfs2ta(mono4aleo ietas aDrlump;u4aetnio3iodomD  n s s)s2xr(r3oo1lmte fet sfsDtau onu1olxnifcildlm2eluvp;(4aexnxo3iytoatrluei;t t2umimpou1lmtn feslt) 2rm(ronu0tpenii3tlsfs eln s;()trtnirctydlm rluvi;s  exrxm no1lm elneta(fsrtmu  ;o0aetnmfeildfa elu p;(0alxomf totlmDr uvil( trtmim nodapte fvs (  rtr(r nu1tpenmieiyslsDrm(mo t4alxoio3oydfp ran i;t) 2xo(r iu4omenlneilt aDuru pou1ope moeiys a umuvs;t4 rerio oy1opt  ies (0 exr(o3oydalt livils)sDuaump;t4oee  oeiytlaDeau o u4tetnir oatfmDranvslt trxmirpno4ll  lncia(  2tax o;t4tpe  f3ilsla2elnvo (0tlxnmfcoa1fptrlnvol()texmir3no1oltn fcs () Drr(r nt1openmiciytlsDem( o;u0 rtoxfctodlaDe u il(  etm(o3oo1omt  neta(  2um(rpnu1aetoio3iasfmDem(ms u)tltrmociy1lp   ieol(0t2xrir3iu1lmeemneil(fa2rauronu1ope mociyt sDuluvo u4alxrmo3oy1optr ueo s)srtrio nydaleelictat)aDurx pot4opto feiyd a raumsnt4 etomrciadlpDr neolt0texrio3io1alenmncsa(fa2urxr no4opt  o3tyt a ul(mp t0tetrxf oadlaDrlnes (0setoir3oo1alenmivsa()aDumu pnt0optnmf3iyt mDumnvs;t4trxoiociytlaD luvs (0trtoimpiu1lmenmfvia(fs2trurpno1aeeoiocildfa uanvo;u0 lerxf3totlp eaivol(  2uoim io4lmt mnet sfsrrmuro;o0tlxn oeiaslmDel(vs;u) ltomfctodomDrau o s t2ur(mpnu1om  lnvta()sDtrxmpno1teto octlt sDua(vo u0teerio3tytop  anvs;t srxriopoodal e ivsatfsDuaxmono4tleomi3iltfmDulumsn(4aexrmrciotomtrliei t)t2tr(mpiu4apeelies s  2rrumo;o4optnioetatls eau o;t) etomr ootlpD lu o;t) rtrxmpoodlltnlfctls) 2raump;t4aeen feias mDrau s t0artnif oatopt  nei (0 exo(opiydopeemfctlt  rum(m oo4olxnmf3iatlsDelu sn()aeerxrciatop   i s t s2xrio3iodop n fci s sDumxro;o0tetn i3iltfs2eluvs u4aexnxr oadoa  ai sls setm(r oy4ll  mncils)sDtaurpou0opxnmo3iad s ea(vo ()tlenif3ty1faDelu ols)s2xrxmpiy4op   fcsls s2tau  ;o0ole iictldfs2ra( p;t0trenxr3oatlm   i o;() rtm(r3nydlp n fcs tfa2tm(m ou1tpe  oetatlaDrau pn(0 rtrmf3oo1fpDeln o s)t2xrxmpnu1omtn nctls  Dtrum oo1tltomfetat sDeaump;u)tetoxr tytom   i ilt0s2tr(o3nu4lpt livsa(fs2tau pot0oex iictad sDuluvsnt)artrxf to1fmtelnes s) euoir3nydoptnmietat)aDur(m ou1aptnii3iyt aDemumo ()tltnifcoytopD  ivi;s  exrxr iy1llenlfei t srrru p;u1oetnmoetadla ean s;() ltnxr3todom   ieo;s0 rumir oudal e iciat)a2ua(rp;t1tex ifciat aDuau o t4altnmf io1omD li s t0tetoiopio4olt lnvi (faDrrurpoo4tpe if3ilslsDulnmp u0tlxoxr iy1faDr ies;(  2toim3nodomt mics ()aDra(rono0olx  fciadfm2rl(mp;t0trtnxf iodlateanvo t)t2umio iydom  lfctas)aDururp;o1tpeomi3iaslsDemuvp u4 lenmf iodlm   nvol(  2xoir io4opee ivia(  rta( p;u1aexomoeils a2uaump (4trerir3iatlmtrlnesl(0s2trirpiydlm  lnvtas)s2tr(mooo0olxn octld m eluvo t)tleomfcty1opteai s;(0srum(opny4lmt lfeia()sDtrxm ou1opt mf3ild a uauvo u0 ltrmr3ootlp e ivs;(0srtoir3ou4ape mivtlt)artmurpou4texoif3ilsfa el( ont)tetrmrciydlmte nei;t  2xmxopoydlltn nctl(f Dtm(rpoo1ape if3iaslsDul( pnt4trenmoctatla rlnei;(0s2xo(r3nu1ll nlivt sf Dta(ro;t0alxn feiatfa2em( o ()teenmr iytlpDrauei ()seuo(opny4lmt  ict sfa2rmxrpno1olenifciatfm2rmu s;() ltomfcoadfmD aivi s  etrxo ou4lleemnvi ( s2urx ooo4tlxo f3ildlm2rm(vp u0tetrxr3iadlaDeau olt)t2toim iydlmen nvtlt s2rr( pou0tee ioeias m2ra(ms u4altoir3ia1om  lueol( t2xmxm io1aleelfcsa(f Dtr(r oo1tlx mfciltfm2rmump t)tlenif iydopDeli slt0t2uo(o oo1apte fvias srtmxr nu4tex iictad a2uanms t4tltomo to1laD  neil( sexmiopoo4op  mfcsas sDta(mp;t0apto f3iasfmDumuvon(0arxrif tadoa rai olt s2xr(m3nu4ape micsa(  Drrur ;u0alenifcias s emn snu0tltrif todopD lieo;() 2to(r nodomte ivtat s2rrxmp;o0tle  oetyt sDrlnmpn()arerio3tatlpD  u s t0srtm(m oudolt miet s s2uaumpot0oet  fetasfa2eaump t0tlermr3ia1lm  li ilt  exo(r3nudll  mnes ( sDtax pot4alx mo3iatfs ul(msnu) lxnifcoadfaDean i;t0 2xoxo iodome  nvtl( a2uaxm nu0tpx ifciltls rmnmo;u0aetniociadlaDr uvo ( srxmxm3iy4ale  ics t a2rr(r oo1texn fcils m2elnms (4arxrmr3iatop  li ilt) 2xm(o3oo1alt  ivtasfaDururpou0tpt iociydfa2eluvs t)trtrifcoa1fpt  n o s)t2uoxo nodaltemiei tfsDumurono1tlxoii3iltls ea( o t0alxnmo3iatoaD auvi ( srtoxopny1alenlfeil( s2uaurpot0olenmietltfs ul( p ()tetnxo3oadlmte nvi t  exoim3no1lme lici t)s2taxrpot0tpenmieiydlaDranms t)altnmoctotlaD  i o;s0tetoxm3io1lmtn fvsasf rrax o;t1alenifcild aDrm(mp;(0teenxf3iadoa   neslt0 rtmio oo4lmt mfvtl(fa2urumpoo0tleo ieiyd m eanvs;u)trenif oydlatelnvilt) 2toiopou1alen ics s)a2rmu pno0tlxnmocilsfm2el(mo;() lxnio3iodfat  ivi;() rtoxo nodol nmivs ()a2tmxm ;u0teenmf3tadlm2um(vo;u0tlxrir3iatom  aivolt0s2trxmpio4optnliviat a2urum ou0tle moetlt mDum(mp;t)alxrmrciodopteluvs;t texrim iy1aptemicslt)aDua(rpot0opx mocilt s um( snu) etnmf iadlmteanvo;s0sruoxo3oudapte fcslt arrmu p;u1tle  fciatlsDul(vo;t4trtoif ta1lp rlnes;s tetoio3oudol e nvt t a2rrxmooo1openmi3tltlsDem( s;t)tltoxf totfm eau s;t)truo(r iydomtnmnvi ()sDra(rono1oexn ociad m umnmo;t)aexrir ty1fmD lu o s srxmxo3iy1aleelivtls s2trxmp;o4alenioeiadls2eauvo;u4alxnxo oadomtelneil() 2um(mpnudame  ivia(fsDraumono1optnmo3iatla2uanmont4alxoxo tydfmDr ivsl(0s2uoirpnudape  fcsls)s2rrurooo1oetnioeildls2rmnvpnt4trerif3oydfp  auvs s)tetmiopou4lm  lfviat aDurxrono4aptn octad s2ulnvp u)alxnxr3ootlatr iei;t0srtrxr3oy4lltn fvi ()s2rrurpot1tpeoifeiytfa rmnmon(4tltoifciydfaDe uvsl(0truoio3nudol   nvias a2uaxm nt0teeo oeiatlsDemnmp;u0treomfcty1omD au o;t  etrxo3oudap nlnetat)aDuaum oo0opx  ictasfaDrmums ()alenxfcoodfmte n il()trxr(r3oydlp  mivi s) rumu  nt1tle mictat a2rau o;t0trtoir3ootlatraivs;s0texr(r3iudlp emncsltfsDtru ont0tlt mictysfm2eanmo (0 exnmr3to1lpDraieolt0 2urxr oudape lfvtatfs2rrurpno0oltn o3iyt s rluvsn(4arerxf oo1lmtr ueilt0trtoxopoodal elnvsltfs2rmu  nu0alx  o3ild m2rlnvs;()aexoxfcio1om  lu s ( t2um(m io4omenlfesls) 2raum ;t1tlxniocilsfmDelnvs (0 reoio oadoaDe i i;s)t2xo(m ny4lm  lfct sfaDrru pot4opt mietad sDrm( s;u4alermoctatfp  lueils trtmxm3iydole lfci s)sDumx o;u1tpenmietadfm eauvo;(0 lxoxr3iadla r u o;t)srto(opny1lp n fes s aDtmuroou0tptoif3tad sDuauvp;u)teenmrciytlpD lnvs t)sexo(m iydlpt  fvtas arurx p;o0oeeomi3tls aDeanmp t0trtnio oy1lp eli s;(0srxm(opoodamt mivsa(  Dtrxrpoo4opx  feiatls2um(vp;u)tetoir3ty1la rlnes t s2xo(r ou4llenlieias) rra( onu1texniicildla emumsnu0areoir oodlpDeaivi;s0 rtrxr3nu4omeemfvt sf rtrx ono0opx iieiasls rm(vs;()tlenxo io1fa   n i t)srxrxo3iu4ape  nvias sDrm(m no4aetoiictas s2ra(vont0trtnxf3io1fpD ai o;s)s2to(o nu1aptn nvi t srur( pnu1alx mociytlm ran o () exomfcootlmDeai s s t2um(r no4aptnmnetas sDurumont0tetn i3tydfm emnmp t4 rtrifciatlmD aues;t)srxm(mpou1optelieilt s2trxr ;u4altoiieils mDuln sn() ltrxo oytoaDeln o;()sexrir3nu1am emiviat)s2taxm ;u1alxnmf3iadfmDea(mpnt4 lxomr3todoatr uvi;s  etrxo iy4llenmfctasfsDuau pnt1ale mf3tlsfaDean p;(0alxoio3ootfp  ln olt)s2to(opno1olt  fct tfa2taum oo0aexnii3ild a2uanmp () lxrmocia1optelnvi;t0srtr(m3iodlp  lfvs s) 2uru pnt4tee  ociltla2rm(vp;t0trtoxfciy1op raneo t0trtrir no1open fvsat sDurx onu1oeeomfctaslm2ra(vo t) rtrio ty1omD auvsls0 euoio oodlp  licsatfaDrax pnt0teto ietls mDrlnmo;u0tetoir3ootoa   n s s0 rurxr iu4lptn nvta(f Dtmxrpot4aexomoeiyt m2rmump;t4trenifciy1om rlu i t trxrxopio4apen ici (fa2rm( o;u0tltomo3iysfa rmnmo () etnir3totfat  nvi s srumxr3oy4lp   fci t) rrrxmpou1oexo fctldfsDrauvs u0texrifctytfp ranesls  exoimpou4lmtnmnetas  Dtaumpoo4oltnmoeildls2rmums;t)altoxf3oadlm eai i;( srurxr3no1olt  nvtl(  Dururo;u1olt mietat a2umu o t)trerxf oo1lm e neo;s  exrio iy4lltnmfet sf 2trumpno4tpeomfetltfs2ua( sn() lermfcootlpD auvs (  exoxo ou1ame lfetlt)srra(mo;u1olen oeiltlaDrmumon(4trtnmf todomteanvs s)s2umim3nu1llen ictls)srum( pno4alenifcilsla2emn snt)aexnxf3tadlatr uvo;s  rumxm io4al nlfesl(fsDtrx pno1tetomieiatfs el(mp ()arerxr tadomte n i s) 2trxm ny4optelfetasf 2ur( pnt0ole mfciatla eauvsnt0tlenif3oo1lmDeaivol( sexm(r iydap  lnet s aDraxr oo0aexn ocils s2umnvo u)teermr oo1om e uvs;t) 2urxo nydop  mneia( aDuru oou1tptnmfciltfm2rm( p;t0aeeomociadlm eau ol(0 rxmxr3iy4omtnlietas s2ur(rpnt0olxnifeiadlaDulu pnt0alxriocta1lmDrlneo s  euoimpiu1altelics tfsrtmurp;t1optnmf3iatfs2rmuvo t)tlxnxo to1laD auvo;( trtmxm io4ll  mfvs tfarum(mo;u1altnmieilsfm2rmnvs;u0texnmf tytomDe i il(  exoir oo1om nlicta()s2ta(ro;t0tlxoii3iydfm2rln on() rtomfciotlmt  i s;(  rumxm3oydalenliet t)srumur ;u1tpxoio3tldls2ul(mp;(4 ltnif3oytlaD  n ol(  exr(rpiu4lpee fciltfaDua( pnu1texnmoctlsfsDrmump;t) rxnmf oa1fa   ivol(0sexrxo oy4omte fctls) rrmxm nt1apen oeiltfs uln s t0 lxoircto1optrlu o;s)sexoim3nu1lm nmnvs ( s2rmxmpnu1teeomociltlmDeaumo (0aetoir3totfmDranvo s  2uoim3ou1olte fviatfs2urumpou0aexn iciaslm2rm(vonu) renio oydoptr ieolt)trxr(o3iu1optn fcilt s2tr( pno1oeen fciytfa2emnmo u0 etriociadfatr ueils0 euriopou4lm  micsls) Dtru  no4alx ifciasfa2rau ont) ltoxf iytopD  i o ( sruoxo no1opt mici sfartmu ont0tetomfetltlmDrlumon()teenifctydfpDeauvo ()t2urxm ny4lptemies t)sDra(rpot1aptomf3tys a eln s (0alxrxr io1lpteli sls  rxrxmpoy1al nmieiasfs2raum oo1altnif3ils s2rmn o u0aetoifciodopt livol(  2um(r ou4olenlnesa(fa2trur ou4tee mo3ild mDrauvp t0arenmr3iadlp e nvolt0trtr(m nydoleelivsasf Dtmu  nt4tpxnmociys m raumo;u0altnmf3oa1lp   ues;(  exo(r3oydlmt mieiatf Dumuroot1aetniociyt m2ul(mo;(4alxoircia1fm  lnvs s)tetmim3oodameeliesasfa2uaurpot1alx if3iysfs2umn o (0alxoxr3tytfaD  iei t0tetrio3iudapenmncta( sDrax  ;o4ope  oeildfmDelnvp t4tltrif oodfmt lueolt) rtmirpou4am emfeslt  rur(  nu0apx  fetlt a2eanms;(0arenxf oatlaDean ils  eurir3oudlleemncs tfa2tmxmp;u4oexomoeild mDrm(vp;u4tltrmf3totoaDr uvolt  rumim iu1llte ivtlsf Dtmur oo1ape ii3iysfs2ean s u4arxriociydomDe u s s0tetoir oy1am  lfvtlsf Durumoot0aexomietyd s eluvpnu0texrxo3oydfm rlneo s  2xoio3ou4altelnet s arrr( oot4tpto ociysfaDemn s () etomocto1laDe neils srtoir3iodoltelfvsasf rtr(  ;o0oexn f3iltlaDul(msnt)treoxf ta1faDeaivo;t0srtr(r3oy1ap elfetls)arrm(m no1oeenmictys a2uanvon()aleomfctadfm  an sl() etmim3oydame mfvslt) 2uax  no0opx mfeiasfm raumo;u4alxrmf iy1fptr iei (  2xrxo ou1opeelictatfs2ta(  ot0olx  o3ils a2emnvo t0aetnmo3oadlmDeau o;t seurxrpiydlpe  fci sfsrrmxr oo1ole mfeiytfa2emuvp;u4aetrxf3iadoa e uvols) rxm(mpou1opte nvi sf Dtaurpnu4aeto iciydlaDel( pn(0aexrifcta1opDraueil()s2xmxr3iy1ole lnvs sfaDtmuro;u4tlto feiad s rmnvon(0treomr3to1omDrlu s;() exrxopoy4lmt  nctls srtmu pot4ape  i3iys mDranmo;u4tlxrxf ty1faDeluvo;t sexrio io1om   ivi s) 2tmxmp;o4oet ifetytla2emn s;u4aetnirciatfa  anvi ()s2uo(opiodoleemfvi ()srumu p;u4tptnmo3iasfs umn o;u)trtomo oytopte nvol() 2tr(m3io4ape liei ()a2trumpot4alxoii3ilsfa eanvs;() lxoio iytfp  lu o ( srxmxmpiy4ome  ncs ( a2ra(  oo1aet mf3iytls eaumpnu4aetrmf tytfmt lies t0teuoir3no1am nmietl()aDuax oot4apt micias a2elu on(4 lxnmo3iatfat  nvs;t) rurimpoo1ole lnesas a2rmx  nu1olto feiadlm ul(vonu4 ltnxoctatlpt ln i;() eurim ny1ap emiei ()s2urx pnu4opeomfeiyt s ra(vo (0altnxr tadopDe uei s)sruo(m3iu1lpt  ieil( sDtr( ooo1ape mfcilt s2eau snt)arxniocoodomte u ilt) eurir3oydome lict s srurumpou4apx  fetldlaDeanms t0tlenmf3oadlpDrliei ()tetmir3oydlpe mfetatf rraxmpno1tlxnmoctltfa ulums;()aexrio3iotoa ranes;s t2to(opnudam  lfcia(fsDrau oot1alx  oeilt a2uluvp (4 rtrxociydla eauvs;(0trxrxm3oudopen feia(fsrtmum ot0tetn fctadfa em( pn(0arermr ta1lp  ln s;t trurxrpoudop e ieil() Duaumpno0oetnifciadfs2rm(vo;t)aetoxr3oatfaD li i (0teuoxr ou1lptnmfvilt)a2ua( ooo0tpxnmi3iys s2rmu p u)aexrmrcta1om e uei;t  rxm(m3oydol   fcslt) Drr(rp;o1oeenmi3ildla2emump;t4 eerio iydlpD au i;t)setmxrpny1ll e ncil( s2uaxmo;o0tee io3iyt m el(vp;u)artriocoydom   uei;s)sexrxm3oy1lme lnei s) 2rrurooo1aptn ieiydfaDum(mp (4artrio3tydlpDranvs;t)s2trxm nu4opt  nvi (f Dta(rooo0tlenifciytlmDraums u4arerxr3oadfm ranei;t0 exrxr no4am  mivs () Dua(  ot4altniociaslsDumn on(4 ltrmf oodla e ieslt)sexo(m3iu4op  mncs s)artr(ro;u4altn fciltfm emn snu4trxrmo ia1fa e nvsls0sexoxr3iudlltemfvs tf rrm( oot0texnmieiadfm2em( snt)texrmrciy1lpDrai sls)teuoim3io4lp e feilsfsDtmxr nu1tpe mi3iadfm2rm( p;()tltnir oodlmte i i ()trumio io1omt  ies s a2tmxmp;o0opt iieiasfsDum( o u)aleoxf3ty1fm r ivilt0tetoimpoy4opt lfctls)aDtr(rp;o0optnio3ilt s em(mo;u)alxnioctodop elies;s0s2trir3oudlpen fcsat arrm(mpnu4ope ioeild mDemnvp u0 rtoxr tytfm raiei;s0t2xoxrpoodamen nvi s  Drau oou4ale ifctys s rl(mo t0arxnir ty1fm elnvs t0t2uo(m ny4ol elfcias)srum(rono4oetniieiatfa2ulnvo (4 lermf3oa1opD livi;s0s2umxo iy4amt  ivs t)aruau o;o4tlxomictad sDua( sn(0 lxnmo3tytopDelivs s seurirpoo1omen ies ( a2raumpou1opx ioctasfmDumn s u4 renmfcoa1op rlnei (0s2xrir3nydapt mncias)arumxmpot1oleomi3iatla2um(vpnu4tleomfctydlaDr n ols)t2tmiopiu1ol e fcias)a2umxr no4tlt  f3ias a2uan s t0trxrmrctodoat aiei ()seto(rpnydapen iei (faDtmumont0tetnii3ilslmDuluvp t)arenxo3ia1opDrauvolt) 2tmir iy1lpt mivs sfs2ur(r oo1olx mociytlm uln sn()trxnir3tytfmDr ivil()trxmxr ou4optnmnesat)artmuro;u4tltn i3tat m2rl(mp;t) rxnmrcto1omtr uvs s0srtr(r3iydlleelfeslsfs2rrx  ;t1ape ioetyt a2rm(mp t)alenxfcia1oateau s;t  2uo(o nu4alenmnei tfa2rmum nu0tpxo o3iyd m2el( s u0 lxoio3tatfptr ies t)setrxo3nudoptn fctas) Dtaxmooo1tltnmocilslm umn sn() reriocoydfpDean s ( srur(r oy1altelnctltf 2trum ;u4optoifetyt aDuanmsn()arxnmf3iotlptrlieil( seuoimpoo4open fctas  2raxm ot4ope  i3tadlmDeaumont)arenmr oydop r ieo s0 eurxr oy1al n feia(fs2rau ono1oltomf3tldfm uln o;t4trtoxf3oy1oa  au ilt s2toim ou1lpt lfeiatfarrr( o;t4oltn ociltfa2emnms;u) rtnio3to1fa  li o;(  2toir3nudol  lfvsl(fsrraurooo1oet mfcilt sDum(vsn(4trenioctodomt au il(  etoxrpoodap nmnvias s2taurpnt4open iciasla eluvs (4trermrciatfp eanei;s)srum(m oydlltnlfvtlt  2ra(monu4olxo o3ild a rl(mon()tlerirctadlm eluvol()setrimpiu1opee nvi ()s2raurp;t4opxoiieiyt sDrmuvsnu)aetomr3iadfmtranei (0 etoxo oudllte fciltfa2tmxr ou1oetnmieilt s ra( s (4altrir ta1oa r nvils t2urim3iy1ol n icsl( artmxrooo1oeenmf3iadfa ul(vs;(0tlermo3io1op rlies;( trtm(r nu1ll  livtat sDum(mp;o0olen ieiydlsDum( p u0trtrif tydfpD luvi;s) 2uoxmpnu1ol nlnes sfa2trx  ;o4opt mocildls2emu p (4 ltoircto1fatelieo;t s2tmim3nu1lptnmivtat)sDraxr ;u0aee ioeias s2ea(vonu0artnmr3io1op  anvs;s0texrxo iydlmtnlnvias arrm(mo;o0ole if3iydls2ua(vp u)texnmr3totfp ranvo s0 eur(o3iu4omtn fes ()aDtaxrp;o0olx  feiltlsDrau s;(4trermf oytoaDe nes;s s2xm(o3oudlmenmnes (fa2trx p;u4oeeoif3iadfs ran p;(0treomf3iodlm r nei;(0 2xoiopio4ll   fvsl(  2rm( pno4oex  icilsfa2umu s t)arenio3iatoaDelieils0 rtoim oudoltn iesa()arta(mo;t4tleomfciad sDrmnmp (4alermf iy1omte nvi s0 rtr(m3nudolt  nctl(fsDur(rpoo4apxn fcias aDum(vo u0 ltoir3oa1fa   ueo (0teuoiopiodlltnlicia( s2tmuroou0optoiiciysfm2rmu o;u)teenmf oadfptrai s;t0texoxr3oy1lmtnmivtl(fa2urx  ot0tptoifctytlm ua( pn(4texrmf oa1fpD anvi;s t2tm(r io1aptnmicil()artaumont4tpx  feiatfm2emump (4texoxo3oo1oa raivil( texm(o3iy4lmtelfcs s)s2rr(rpoo0alen ieiydlm ranvp;t0 eenmrctodfa  anes;s  eurxmpoo4omtnmivsls s2rmumont4alt iiciltfsDeluvs (0 etomfcoytomt li o t)t2uo(o3oy1amt lneias) ruaumpnt0alenmociyslm rlnvp;u4 reoir oo1fpte nes (0srtmxo ny1ame lnvsl()srta(rooo4alx iietas s um(msnu0trermfcia1fptrlnvi (0s2um(o oy1lpte nvslsfsrtmum ot0tpt mietld m2rl(mp;(4 rxrxo3totlm eaivslt0t2xrim iu4lpee fvs s) 2tmx  oo4tle io3tlsfmDumn s u4aexnmf3ootfaDean o s)s2um(m3oo1lmeemieiasf rraurp;t1ole  o3iad sDuauvpnu0 eenmfcta1fpD lnvo ( tetr(o3io1apt mnvt sfaDtmu oou1aeeoioetldfaDrl( p;(4 ltoxfctadfptelnvil(  rum(opiu4optelfeilt  Dumumpnu4tpen octytla2ul( s;()tetoxf3iatfa  liei;t0texoxopiodap n ici tf rtmurp;u0tlenmfetadfmDrluvp t4tltoxo3ta1lm   nesls sexo(o nu4ll  lfcta()a2umur nu1aetnifcilsla emu o;t4aetoio3oo1optrai o;t  etmio3oo4lm nmfvi s srrru poo0aleo ociasfm2em(mp u) eerio oadlp e nes (  2uo(o iydapenlfciatfs2rr(r ot0ape  o3iat aDem( pnt4arxrxocia1fm rlieilt srtoxmpoo1ame mnctat)srraum ;o1teenmfetldfm ranvo u0altomr3ia1omteanvs;t truoxrpoo4am n iviatfs2rmurono4tptoiocilsfm ulnmp;t)aetnirciy1fat aneo;s)trxrxo nu4alee nvsls)sDrm(  oo4tpt ioetatls2um(mo;u0alenmo oadoptrai i;t srxoxr iodal nmfesat srrm(ro;t1tlxomfeiltfm ul(mp u) reoif ia1lmt ai il( s2uo(o nudam n nvs t) 2umumonu4alt mo3iltfm rlnvs;t4 eeomf3iy1lmD aues t0texo(o3nu1amt  nvtl(faDrruro;t0tpt iiciatfm2rm( p u4alxnircoo1lpDelieo;t)tetmxo3nu4op nlivia( s2umu onu1opxoifeiatlm2ua(mpnu)trtrxr3tatlmDrlueils s2toirpoudal elfeias)sDtmxmpou1opxomietatfs rmnmpn(4trenxf3iydlmteaieol() etr(m3iy4omt lnct sf ruru  ot1optniictyt m ranmo;(0texrxf3oadfpDrau o s t2xm(opoodom   fvtat a2umx  no0tet mo3ildfa ua(vo;() eermo3to1lmDeaues s0 rxmxo nu4oleelieiasfarua(rono0oltn ieiyt a2ul(vsn(4 lenio3oa1fa eauvo ( t2toimpiudopte icslsfsrtr(mooo4olto ietadfm emuvs () rtoio3oa1faDrai s s0s2tm(opoydapt mfvt s arrr( pot0ole ii3tlt m2ran p (0 rxrif ootom  lneo;(0tetr(r iydomt lnct s)srra(r ou4aet iocildlm2rauvp;()tltoxfcootlatrluesl() 2xrxopoy1lle miesa( aDuaur nt0apx ioctadls rm(ms (0aetrmo3iytla  luei;s sexm(r ny4opt  neta(fsrta(m ou1olen ieiaslm2eau onu4artnxo3ta1lmt aneo (  rtrir ou4lm e icil()a2tax oou0teenmfeilt m2rmnmo u4 reoifciytlm e ies;t) 2xr(r nydape  fcsltfsDtr(r ou1aptnmoeilsla rln p t0teerio3oydfm rauvi (  2toxr3ou1lptn ivt t aDumumont0aeto ietls sDuanvsn(4alxnxrcta1omDeau ilt)texmir io1olenlnct ()aDur( pno1tlx  fciadfaDrm( p;(0alenxf3ta1fmtrauvo t  2toirpoy1omt  ieil() 2taxmpno0aexo ociytlm2ra( pn(4tlerxocoodfpD lieo;s  rur(mpoy4lpte fvslt  2ua(roou4tlxniociysla ua(ms u)arenmo3todfm eaueo s0srtm(m iydomt mivil() 2trump;t4aeen ocilt sDuauvp;t4 ltrmf3iytlp  au ilt)t2xr(opoo1apt  neilt  Dra(mo;o1olx ioctlsls rmn s t)tltoir3iatlat  n s;t s2xm(o3ny1ll nmivs t srrrxr nt4olxo ociadfs2rlumsnt4 leoifctydoaDraiesls  exmxopny4altnlnvsatfsDraur ot4opeoifetls s2elnvs;t) etnircoydlmDrlu ol(0teto(rpiy1ale mfesas) rta( o;o4teenif3iltfaDraump ()aleomf3ia1op   n o;(0trxo(m nydaleelicsa( aDtmxmp;o0texnifctyd a rlnvp;u0tltoio oy1fp elu s;s s2tmxo iy1lp e fcils sDtmu pno0teeomoeiasfa rluvsnu0teeoio oy1oateau o s0 2toir3nu1lpen nei () 2um(rpnu4aptoioeiytls2raumpn(4trxnifcta1lpDe u i;s) euoxopnu1ape  nvia( s2tru  ;t1openii3iat sDra(von()aexrmf io1op eaues ( teuo(r oy1alte fvils) rrrur ;t0tlxnifetltfm2el(mp t)tltoirctodfm  livil(0teumxo3iodlm elfeilsf 2tm(  ;u1tltomi3tls s2uau s t) eeomocoa1fat  nvo t setmxmpou4apeelnesat a2taxrpnt0teenmociltls2uau snu)tetrir3iodopDeauvsls texoxmpoodolt  iciltfs2um(m ;u4apx mfeilsfs el(ms;u0aexnxo oatlmDranvs (0 exrxrpno4ll emnesls) rraxm oo0opxnmociat m2emnms () lxoxo oy1oatrlivo;s0texmir3oydol emivsl() rumurpnt4aex mfciadla eanvsnt) exrxoctytlptrluei t)trxmxo ou4alenmnesl( s2rmx  no4olxo fetadfa2uaump;t)arxnmrctytopDr ueols)t2toio iy4ole mietatf Duaxrono1aexomociys m umumo ()areomf3tytfp   uvo t0 exo(o3oodam  lfei ()artmumpoo4tlen fctltlaDeau p;t0aetnmo3oa1fmt  n il( seumio ou1op   ncil(f Drru o;u4openioeiatls eln s (0tltnmo3iodlp raueo;s)texmxopio4lpee nctas)aDtaurpou0tpxo octldlaDemums;u0 lerir iadlp   n s;()sruo(m3nudal   ictls arraumoou4tpxoiieiatfs2ua(vp;t0 eeoxfcio1lmtelueol( setoxm oudom nmfet s)srtm(r ;t1texomf3iatls2ea( on()aleomf todlpte iei;t0teuo(o oudamee nviatfa2rm(  oo1teeniictlt sDra(mp;()alenmf3totfpDeli sl(0teuoim3oudame mncta( a2taxronu4ole iiciat a rmu o;t0aexoxo3oatomD  iei;( trurir3oudalenmies sf rraxmono4olt  icilsfaDel(vs t) exoif3iotfaD  neilt  2xoir3iudole lnvsa(farrr(r ;u1tptnmf3ildfm2rmnvs u4tltoifcoydfmDe ieilt0t2uo(o oydap e ict (fartrxm nt4oexnmf3ilt a2ulnmpnu0arxrxociydlm rlivs;s0texo(o iydll emivs s)s2uru pnu1tlxnifetys m elnmp u0aetrmo3io1optranvo;t0 2trxr3ny4ap nmfeilt) Dum(r nt0oltnifeiad a2emuvs;u0arerif tydoa rlu olt)s2ur(opoo1al nmfetlt) rumx poo4optnmoeiaslmDra( s t4tltrxrcoadomDelnvo;t  2uo(rpiy4lmenlieiltfaDuaxmoot4apx ifctasfmDelu s;u) rtnxoctatlmt  neols srum(r iy4apeemncsat)a2raxmont4apen ictasfm2emnvs u)tlermr3iotlmtrlnei;s0t2uoxrpiu4lle lnctls arumur nt0oexomo3iytlmDuln o t4trtnxr iydlm rlnvi;s0teto(mpiodam  mfvsl() 2uaxm ;o1oet io3ildfm umnms;u0aeeoxr3tadlmDe uvolt0srxo(m3iydlp emietas) 2tm(r no0tlx mfctltfaDumn o;u0aexrxr3to1lptelieolt0 exo(o iy4ap elnvtls arrrurpot0alt mieiydls emumpnu)tltoif iy1lm e ueo t)texmio3oydapt  nvia()a2raxm nt1aetnmo3tys a ea(vp;t0texoxr3tatopte i ol( teuoirpiydom nmfcs s) Drm(r ot4aetnmfciltla2umn pn()trenmoctodlm eanvo;t s2umxr oo4lm elivi (  rtruront1teeomoctld mDea(mp;t0 ltrxfcoydfateanvo t0texoio3io4op emicsasf ruax pnu0aetnmf3iat mDemu s;()arxrxo ty1lm  lu o t trum(mpoy4ap emfcta()aDuaxrooo1apt moeiyd m2ul(mpnt) reomf iytfpt li s (  2tmxr oy4op  mfvi t)srraum ;u4teeomociyd a2ulnvpnu0 etnmo oodfa raueo;s0 2tmim oo4lm  lfci t a2ta(rpou4olenmieiasfm um(msn() rtoio oatoa e i ol()trxrio ou4al  mncsas)a2uaum nu0tltnmo3tasfs uanmpnu) etnircoo1om rai s (0 2xm(o iydom n fctlt)sDrr(rpot0oleniociltla eln s;u4areomf3ty1la e n sls)s2trxr iydoptnmnvslt aDtaumpot4optoiicilslsDelnmp;u4 exoiocta1lptrlivol()t2xrirpiudaltnlfeia(farurx pot0tpt mi3iasla2rmuvpn(4trtoir iy1lpt ln o () 2trxo3no1olenlfei s)srumum ;u0opto fctat aDrm( p;(4 rtoxr3iydlmt  i s (0trtmxmpno1olenlfesa()s2trx onu4opx  f3ild m2um(mo;()tltnxf oatoateanes s t2xmio3ou4ll n fcilsf 2um(  nt1aleoif3tadla2el(mon(0teenmo totfpDeaneo s0s2toxr iodop emies s artmum ot4ole iictat s ulu o;(0tetrio oatlmt  uvs ( srumxrpiu1lle lictatfaDrrxmoot1oet if3tlsfa eanmpn()aeeoif ta1om   ivo (0 2trxo3iydlmt  ivtatf 2rmxm ;o0aeeo oeiydlmDrmumpnt4tlxnxrctatlp eluvil(0s2xo(opoy4amte ncsl( aDtaxr nu4oltoiocilsfs rlu s t) etrxocto1lp r u o;()trxoimpno1apen icsa(f 2rrxm oo1aeeomi3tltfm2rm(ms u4 lermo tadfmt livslt0sexmio3nydale  fet t  2ra(rpou4apen octad a2umnmo (0trerxf totomtran sl(0teur(o iydlpe  nvtlsfa2umx p;o4texnmfctldlmDrln s;t4 etoio3oa1lp r n o ()trumxr nodolt mfeiltfsDur( o;o0tltomictyt m emn o;t0altoxocoodfmDelueslt setm(mpoydlpe lfes t) Dta( o;o1tltomfcildfm em( o;t) exoxf3oa1lmt luvi;s0trtm(r oy4apt lfcs t)a2rmurpot4tetnmfctyd s2rluvo t0altrmf3ia1faD anesls s2xmxopoodol emfct s aruauroot0optomo3iasla rm(ms;t0 eermr3oa1fmD  u i t) euoir nodoptnmnesls) Dtmu oot1alx  o3ild a2ulnmpnu)areoxfctadlp r n o s trumxm3oudlmenlfciat  2taurooo0tpxnmoeiaslm2ulu o;(4aexoir ty1fmDelu i (  ruoxm ou1op nmics ()artaxm nu4texn oeiysls2el( o u4aetoio3oy1lpt  n o;() 2xm(m iu4ameelfvi t)srta( poo0apeoii3tlslsDemn s;(4trxoio3iadomDrai ilt0s2trxr3oy1llt  fciltfsDumx pnt0opxn f3ilslmDuluvpnu4tetomr iodlm  lneo s sexmio3oo4lm  mnct t)aDumxr ;o1aeeo ietydfs2emnvo;()aexoxr tytlaDe nes t trtmxo3nydom e neilt srumx  ;u4alxo fcildlsDrlnmpnt4trenmf ootlmD luvslt0 rumxmpny1oleelfetls a2rrxront4tptnmi3ildlm el(vo t0 rtnxf3iydlmt anvo;t)srtrir io4lp  mnvsa(f Dtrumooo1tleo icilt a2rmumont)tlenircootop  li o t t2xo(o oodomtnlneslt)s2ur(r ot4aetnmi3tyt s2raumo u0trtoirctatop  ai s ( t2ur(r3iy1am emfesls arur(mpou0tltn ictadlm ua(mo u0 rtoxo3to1oaDrluvo;s0sexrxm3ny1apt mfvi s)sDurx pnt1tlx  icildls2umu p;(0tlxnmr3oydoa r ueslt srurxopou4lptn ivs tfaDurxmp;u0aeenioctatlm2uauvpnu4aetoxf oatomDe nei (  2ur(opio4oleemnvt t  2rrumo;o1aeto oeiat aDea(vonu4 etrifctydomD  n ol(0teto(o nu4lp  miesatfaruau  ou0tlenmfcilt s2rmnvont)tlxrmf iotoaDean s ( t2urxrpnodoptnlfvsl()arur(r ;o4apt io3iadla elump;(4 lxoxfciadlmDe nes s0sexrimpoy4lm e ncs t arrmu  no1tlxoii3iat s2ul( p;u0alxoxo3todom r i sl() etr(rpny1ap e netls sDrmu p;o1oeeomocildfs2el(monu0arxnxoctotlmtranvo;(0tetm(m3no1ope lncs (fsrtmu ooo0alx  oeiyt m rau o;t0 rxoxr io1oateauvilt  rxmxo3nudllenmfei t  2tm(mo;u4aeen fciys a ra( s u0alxnmf3tatlmtranvi;t0 2xm(m3ny1opt  nvslt)aDua(m nt1apxoiieiadfs2emnmp;t)teenmo3ty1lpD lueol()t2xoio3ny4lp nmiciasfa2ta( onu0olt mieildls2el(mo () etomo3io1oa eluei;()trxrim iudalee ictlt) ruax  ;o0aee  ociat a2rlnvp;t)aeerio tytlmDe ieil(0t2toim3nu4ap e nvil( a2ra( pot1teenmi3tydlmDulnvs t0 reoifcoadopD livo t  exrxo iydal e nvi ()a2taum ot1tpxomoctydlmDra(vont) ltnxocia1om rau s t0t2umir3no4ameelnvt s)s2ua(rpot1oeenmf3iasfs2um( onu0arxrxf iadlp elieo;(0s2tr(rpou4opeelfeslsfarrmx  nu1texnmieildlmDrmnvsnt0trtoxf3tatoat aivi s0 rxrxopno1apeemnvs (fsDrm(mpnt1olen icildfmDulu s;t)trenxr iydlmD  nvs;s)s2xoirpnu1omt lfcils srrm( pot1apx mietasfs uan pnt)alxrir3oa1lp raueolt0tetm(r3iy1ope  ivt ( srrmu oou0tetomietat s2rau s (0trerio ta1laD anvs;t) 2tmim io1lm nmfvs (farrrxmp;o4olxomieild a2um(ms (0 exrxf oytom e u ol()srurxr iydaptnlnvtasf Dtr(rp;o0apeo iciysfs ulumon(4 etnifcoodfat lues;s) 2umxm3ny4oltn fvsl(  rtmur ;u4tltnmoeiad aDra( o t0aeeoiocoo1oate ueil( s2xo(mpny4am  liviltfarua(moou1aex io3iadfs2rauvpnu)alxomrcty1lm  anvi;s)trtrxr3iodlp nlfcsl(  rtm( ont4oex ifcias s umnvpn(0trxnio3iy1laDe nes;s)teto(m iu1oltnmiei sfaDtrx p;o0tee  ieiysfmDemnmo;(0tlermo3todomtelivs ()setrxopoo1amen fciasf rta(mp;u0alenmfcilsla2rmuvs;() eenmr3tadomtrlnvs;( truoxopou4lme mneilsfaDumxrp;o0texnif3iltfm umnvs;() leomrctadfateanvs s0 eumxo iudlmeelnvsa() Dra(rpou1oetnioetldfa elnvp;(4arxrmr3oa1oat aivi;s0trurirpiudaltelncias aDtm( o;o4aex iieiysfm2uanvon(0artoir3totomtean il(0srxr(mpou1omtnmnvia(  Dur(r nu1tlxnmieiadfm2emumo t) ltoir to1lpDr u o;t)s2tmiopou1lptn fvias  Dtaumo;t4tpxn oetyd s2rl(vp;t)artoio oa1lpt  ies ( seto(m nudap  mfviasfsDrru p;o4oltoioctatfmDumuvon(0aexnmf3oy1faD ai sls) rxoxm3oo1omt  icsas) rur(r ou4texoiictld aDuaums t0tlxoir iodfptraivi ( trurio3nodap emneia(f rtmx onu0tlxomocildfa2rlu p;(4texnmf3tadomt anvolt0t2xr(opnudlpt mfvil(  rta(r oo1tee mfeiatlm em(mpnt0arerio3todla rauei (0srumxo3oo1ap nmnvs (fsDrau o;o1texomoctltlm2rmuvont0alerxr totomDeai s s trxo(m ou4ale mfct ()arrmxm no4altnmoctat aDeln snu0tetrif to1optrau o;t0trtmim3ou4ole mncs t aDua( o;u4oetnii3ildlm2um(mp u)arermo3oadom raivs s)texoim3ou4opt  ictlt s2ta(ro;u0aet  f3ils m2elums t)artrmo tatla e nvi;t0teto(opoodlpen ietas  2rmx ooo4alxo fciysfm emnmp ()teeoxrcoytlp r u ol()srurxo nydap emnvils)aDuaxro;t4apenif3iydfaDrl( ont) leomrciadom r uvs;( s2trxo iydaptnmnei s)s2rr(r ot4tpxnmoetlt m um(msn()trerir3ta1om ranvo t0tetmxopnu1op nlfcsasfsDrmxrpoo0oleomoeiyd m2ra(vo;(4alxrmf oytop  an o t)srxo(rpiudomt  ict (f 2rm(m ;t1opxnif3iytls uluvo t0 rtoir3tatlmt ln s;t0 2xmiopny1ap  mnvsltfs2trumpnu1apenmf3tydfm2emumonu4alerif iodoateauvs s) rxrxmpiy4lmeemivt sf rumu pnu1tptn fctls s umumo;t4 exrmr3oa1op  aieo s) rxmxrpoo1ope mncsatf 2taump;u1ale  fetlslaDum(vont4arxrxo3oy1fpteaieolt0 rtm(opnu4ol nmivil() rrr(monu4tpxo ietat a2eaumo t) lxnir io1fp e i sls)t2um(opiy4op elnctas aDrrx pnt1aexnifeilsla rm( s;t4alerif iotlp r uvs;s0 rtr(r iydlp  mfctls artmumpou1aet  o3iatlm uanmo (4alxrxr tatfa elneo ( trtoim iu1openlnet sf rtax o;u4oee  i3tytlm uanmpn(4 rerxf iotfaDeaueolt0srur(m nu4ll n icsasfarrrxrpou1alxomi3iydlm2rlumsnu0arxoir3todomDr i sls0texoxrpiudole  icia(fs2umxront1tlx  ietldlm2ran p (0artrmociotlptraivi t0trxr(m3ou1am  lnes () Dur(mooo4aexniieild s rl(vpnt0 ltnxr3ootfaD  i ols)s2xrxr3io4amen fctat s2raxmp;t0optniieiaslmDul(vsnt) rtoif ta1fpt  nei;s)t2toxrpno4alt livtls sDtm( oot4aex iieilt m2uln p t)trxoxrciatla r i ilt srurxo oudllt mnvsa(fsDrr(  nu0alt moetls s2ulu snt4aetrmf3totlp  luvslt trxrio3iy1llenlivi t  Duaum ;u0oetn icilslm ulnmp u4aexoxfctytlp eaivols0 exmxm oodopt  icilt)srrm(rono4tpxomociatls rl( on()treniocoo1fptelnvo (0setrxr io1am nmnviat) Dur(rpou0tpt mictasfm raumon(4tetrir3iytlpD aueols  etm(rpnodopt lnct t arur(r ;u0tlenifciaslmDua( sn(0tltnif iadoa r u olt0trxrxr3oudal   ieias)a2umx  ou1olenmf3tysls2emuvs;t) exoxr oy1omDr neils  2xoio oo1altelivs (  Dtauroot0aeeomf3iaslm uluvp () rxrif3tatop eanvo s0s2tmio3io1ol nlfctat  rrmumpou0oexnmi3ilsfsDeanmsnu)trxrmrciy1oa eau i s sruoxr3oudll  lfetas) 2um(mpoo1olxnmf3iyslm2uauvo ()tltoir3ta1om rau s;(0t2tr(r3nodol e fctatfa2urxmpoo4aet ii3ilsfsDrlnvo;t4 exoifciadop  livi s) exo(r3ou4olte nvtlt) rumur ot0tpxn fetlslmDulumo;t)tlxnmrctydomD auvs;s)t2xmir no4aptn ictltfsrua(roou1tlx  f3ild s2rmnmon(4 rtoxrciodlateaivi;s sexmiopny1op  mfei t  rurxrpoo4ole mo3tasfa2ul( p t)artnmf3todopD  nvo s t2urim3iy4opeemnetls)aruaumpot0tpxnmiciadla el( snt) lxnxrcty1omDrlu i;()seum(mpiu4optelnvi t  2umx  ;o4tee ii3tlt s2uan s;t)artnxocto1omt aieil(0seumim ny1al  mncia(fs2tmxroot1oex mociadls2emuvs;t0aeermo iotomD anvils)s2tr(r3oy1om  mivslsfsDtm(r nu4tlxomoctydfmDuaums;t)aeeoif to1oa elnvsls t2tr(opiy4amenmnvt s)s2tru pnu1olto oeilslsDemnvonu0 etrircoydfa rluvo;t0truoio oy4al nlivtlsf rua(r nu1oet io3ilsfs2um(vo t4 eenif oodlmtr n sl(0t2umxmpny4am eliesatfaDuaumpno4tltnio3ild m elnvo u4aetoif3iydopDeanvo;s0t2tm(r3oy4omt mfctltfa2rmu p;u4apeomi3iatls rau s t4 rtoirctadla eluvi;(0trtmirpno1olt mfeia()srum(m nt0opxomi3ils a rmumsnt4 exoirciotfmtr n ols0tetmim3nydam nmicta(  rtmx  no0aexnif3tlt mDuluvp;u4 rxomf iytlat luvs s0trxr(m oydomtnlnctlsf rrrxm ;u1alen fciadla2rmu pnu)areoirciy1fa eaies;() rxm(m3nu1lmeemfcs s s2urx  no4olxniieiyt m2elnvpn()arerxr ootomtrlieol()trtm(m3nudapeelfeil(f rrmxrp;t4tetn o3iytfaDuaumont0teermr3tadopt liei ( setm(m io4ap elivsatfsrtmumonu1tlt ioctatfm ea(vp;u) ltrif todlpteaneolt0 2xm(m3nu4olt licsas)sDrm(r ;o0oleomictldfaDraumsn(0 etnifcoa1op rlneo;( srto(m3ou4ol emnvt s a2taxrooo4teen ictasfaDea(mp;t)aetomr3iotfpDelivil(0trumxr3nydalee fviasf Drr(  no0olxnmieildlm um(mo () eenxr oadomteluesl( t2um(r oy4omt  ivs (  Drmumooo0tlxo o3tatfa2rlnmo t)alerxocoytfptr nes () eto(m nudapen fct s sDtmxm nt1tleo i3iys a2umuvo;t4tetrio todlpt lnei s) 2xmxmpny1ol  miciatfsDuaum oo4apxoif3iysfs rmn pn() rxomr iotlm ranvi s trto(opno4altelfvs (  2urump;o0tlen fetysla2em( o t)artnxo3iadlaDranvo;t) 2tr(rpiy1op elfvsa()a2ua( o;u4tpx  o3iysfs um(ms;t0trtrmf3tatfpDe n sls) eurio io1amt mnvt t s2uax p;o1tpe  f3tlsfm2uau o (0 lenif io1laDe i s s)trxoxm3nu1alee nciltfa2ra(m ;t1opt mo3iatls2eauvo;(0tlxnmfctotlaDr u i;t)t2xoxm3ou1op  lfcils srrm(mpot1oex mociasfm2rmn p u0teeomo3ta1oat  iei s) eum(m oodlmtnlfvt tfaDra(  nt0apt  fetyt a elnvpnt4trerio3oodoatelu i;t0 exrio3iodll n fvt (faDuauro;o1oeeoif3tas a rluvs;u4alxoxfcty1lp r uvi s)s2umir iy4omtn fci t)sDumump;u1opx  iciatfsDumnmon() renxo3oydlpD ai il( texmxr io4lptn iet s)a2tm(m nu1apeomieilt mDum(vs;(0 exnifctydom  luvolt  eurxm3io1apeemivsat s2urur ;u4apeomfetls sDel(ms;t4trtoxo3iadla ean o (  rum(m3iu1opeelfviat sDraumono1tlto fctytls2elnmonu0 lenir to1laDelu slt0srxrxm io4lptemfei ()s2rrurpou0tetniieiytfm elnvsnt)teeoxf ootfateluvo;t0tetm(mpio1oleelfcs tfarum(moot1oet ii3tyt m elu o;t0arenxf iy1lmtranvs ( t2uoirpou4ol  mivt s)a2tr(rp;t1texo i3ilsla eluvonu) renifctydopDelueols0trurio oydopee iet (fsrta(rooo1tpto octas aDemn o t4 etrmf tydlm rln s;s srxoxm ou4aptn fvi tfa2umumpno0apt ioetad a2ul(mp u4aetnxr oytlatelnvo;( trtmir3nydol  lnei s)a2rm(  ;o1texnmi3iltfm2elu pn(4altnmf3oatoa rlu i s0s2xrim iy4ame livt (fs2ua(  no0apxn o3iatlm2rl(mon(0trermr oydlp r u i;()t2xoxo no1ap nlncsat)arumum nt1tle ii3ils a2eanmsn(4teeomf tytla rau ol()t2to(o ou4omt  fci t a2tru pot0ape ioctad a2uauvs u0trxrmrciadoat  nvs;t) rtm(mpou1apenlnetl( arrr(moou1aee  f3tlslsDem(mo u4arenif3oatfmtrlneo;(0 2um(m3iodalt  fcta( aDuaumo;u1apenmf3tatla umnmsn(4arxrxr3oo1lpD ai ol()setm(r3io4om n nvt s)arrr( pnu1oetomoeildfsDrln p u4aeeoxf iy1oatean s t)teur(mpiy4altnlnvils)srur(r oo4alxnmi3ilt s ran p;() ltnxfciydopDe u i;(0trurxopiudom n fesls) 2ta( oou4aetnmi3iatlm2rl(mp t0aetrmo3ootlaDr uvi;s sexmim iy1opeemictl()s2rmxm ;t4olx  oeiad a umu o;t) ltoir iytfmDrlu il( tetmirpiudole  nctas sDtaum nt1tle mo3tls mDumnmon(0arxnxf3oo1lpteauvol()teumio3oodlmee ieil(f Dtax pno1olx  octytfaDua( p;u4trxnxf3ootop ean il()srto(m3io1amtnlivs sfs2tmxrpnu1aeeomfctyslm em(vsnu4tltnmrctotlptrli olt0srtm(r3iy1apt liet (f Dumumonu4oeeniictysla ul( p u0aeeoxo3ty1oaDelies;()trurxo3iy4ll nlicsl() rtm(rpnu4alx  feiatls2em(mp;t)treoxf3iatlpt luei s) 2xr(r no1op nmivils)aDrmuro;t1oex io3tytfsDrmnvp t0arenif ootfateau o;(0 eurxo nudap nmnctas) rra( ono0ale  iciad m2rmu pn(0alerio iodoptrlieils  rtoxr3iydamenmnviatfs2urxm ot0tptoio3iydfmDel( o;(0aexrmrcta1opDr i o t) 2xmir3oo4lp emieils  Duau  nu0tpeoiietydfaDeanvp;(4aetrxr iytom  auei;(  rtrirpoy1lp   iet ( sDra(mo;o4tpe moeiyt mDumuvsnu) exomr3todomt aueslt)t2xm(rpnu1ap nlfes t) Drr(  ;u1olt  f3iydfsDuauvpnu)tleoio3iotfa e n sl(0trumim nudap e feta()srum(m nt4tptn feiydlsDrm(vo;t0 exrxr3oytlm elueilt) eumxm oo4amtnlnct s)arrr( onu0apt ifctasfs2rln p (4tetnxfcoatfpDrlivol(0s2uoim oy4lmeemnct ()a2ra(mont0olenmietytls2ua(vp u0 rermo3oydfatrlu ilt tetm(m3ou1lptnmnet tf rrmxrp;o0tet ii3tlt s rlnmo (0 rxrxr3tydlp r nvs (0trtrxm3iu1lmtnmietlt)s2urxr oo0tex  fctadls2rln snu) rtrxr tytlp elu sls  rxm(r iudaltn neil() Dtaxrpoo4tltniieiatfa ra(vont4tetrmfcoytlpt lnvol( srumxopoy4ol e ivia(fsrumxmoot4tee io3tlt m2el( o t)aetoiociydlm  au o (0s2uoim3ny1lpenlicslsfaDrrxrpnt4aeen oeiys mDelnvpnt4tlxrxo3todlpD  uvil( tetrir3ou4ll emiesas  rua(m ;o1olxo ociyt a2umumpnu)texrio3oytfatrai i;s seuo(o ny1ap e fcsa(fartmxr ot4oexn fciadls2ul(vpn(0aexoifciytlmD li s (0srurirpnodom nlivtat)srrr(r ot4tee iociadfs2ul(mp;t4 etnmr3oadlat an ils  eum(r oo1omtemivil(  Dua(  nu0teenmieiyt a ulnmpn(4 rxnmr iotlp e i i;(  rto(r ny1ap nmfctlsf 2tau pno0alen feilsfs ulnmp u)aexnif iadlateln sl() 2uo(r3nu1lltnlnet () Drmx pou4opx mf3tydlaDra( o;t4arxoxo iatlmDr i ol(  rxoxo oudoltnmiesat) 2rrx  ot1apto f3iysls2uanvpn() rxnmr3tytoaDelneo;s)seurirpnodal e fvs t)a2tmxmpno1t
\ No newline at end of file
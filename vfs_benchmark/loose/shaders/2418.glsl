@@ -0,0 +1 @@
+iesl(0trumir ny4lme mivs (f Drmu oou4olxoii3tyslmDemuvsnt4teeoxo todoa eauvo t0 rxm(rpiy4am elncs ()s2urxmpnu0oex  ictydlm2ranvpn(4artnmo3iodfm e ueol() rxoxr iydlp nlfvtl(f rum( onu0ope  fetyslaDumuvpnu4 eenxr oa1lpDrai ol(  etoio3no1ll  mfvil(f Drrxmooo0apx if3tysfa2ulnmo u)alenir3oatoateln i (0s2xrxm no4openmfeia(faDur(  nt1tlt ii3iysfm2rmu p t4alerifctodfa   uei s trtmxr ny1amt lfeslt  rta(rpnu1aee mi3iysla uauvp;(4arxnmr oy1omtrlieilt s2xr(m no1lptnmfvi (  rrrx p;t0oex mo3tytls elnvo;t0 exnxocoadopDean o s0trtmio3oydlmte fcilsf Drmurpot4ape if3ildls2em( o t) eenmr3tadopD lu o;s seurir nu1ap elict tfaDumu  ;t1aptoiociadfmDul(vp;t)alenmf3tatfa  lueolt)trxmxo iydame  ivsa()artmu  ot1aet ii3tyt s el( s;t0trenio oo1lmtr nvo;(0s2tmxmpou1lm  livt (  2rau onu0tltoioetltla elnvs;(4 rtnifcoodfaDelueols)t2xmim3iu1al emfetlt) Dururoou4teeoiiciadls ranms (0aeenir oatfm raivs;s0t2xrxmpoo4ope mivil()sDtrxr ;t0optnmfetydfaDeanvp u4artoiocoydlat auvs;t0t2xm(r iy4lm e fvtat)s2umxm nt1alx ii3iadls rmumo;(4tetriocoy1fm elivolt0texoiopiudlmen iei (fsrtaxm oo1oltomfetltlsDulump;t)areoir oadoptr n ils)tetmxr ou1lptnliet s srra(roou4teto o3iyt sDulnvo;t)artnir3tytfatrlivo;(0sruoimpoodolenmictltfsDumu p;u1oeen fctysfs ul(vonu4tlxoxfcto1la rli o;t s2umxo3nydomee net ()artr(rpnt0opto fciys a rl(monu) exnxf3oo1faDrlnei (0 2umxopoudamtelfetat sDtru pot0alxomictysfsDeln p t4artrmo3iydoptelnvsls t2umxo io4ll  lfesls) rtaxr ou1apxomfctysls rm(vp;u4trxrxf3to1lm raies;s)t2toio iydal e ivtatfs2umumoou4opxnioeiadla uanvont0alerxfciy1lpDr n sl(0trtmio3iu4lleemnvtas) 2trxro;t0tptoii3ilslm2em( pnu4trerxocoy1fatr ivi;(0sexrxrpio1omte fvs tf Dua(ront1aexoiicilslsDrmump;t4 ltnmo totfa e ieil(0setrxrpiydlmenlfcsat)arrrxm ;t4texoiieiytfs2eln ont)tleomo iadfm  au ils)seurirpiydam elncia(fartau pnt1oee iieiltla2ra(mo t4trxoxo iytlm elu sl()srur(o oo4op elfeias)s2rru o;u1tpenmociyt sDem(mpnu0tleniociadfpteaies;t) 2tm(rpiy4lmte ieslsfaDrmxr ou0alxo i3tys sDrln pnt4aeenio oa1lmteanvi;t  euo(m io4ale mnci tf 2tmumo;t1oeeniicias m rlnvp;t)artomo3ta1lmteauvo;(  2xm(m3oo4lmt  fvsa()s2um(roou0aee  ocild a2rlumon(4trtnir tadlaDeauvo;t0 etoxmpiy1llt lnvs s) rtaum no0opto fetlslaDelnvonu4 lxnio3iy1fm r n s t)srum(opoo1olenlfcsat) 2rrur oo4apeoiicils mDrlu o;t0trxrmo3oatoa  au s;t)srtr(mpno4alt lnctas)s2ua( oou4oee  o3iyt mDrmu pnt4aeenxr todfm eaiesl(0trtr(rpou4aptemfvtl(  rumu p;t4oex io3iaslm2umnmsnt) eeniociy1fp   uvil( seuo(r3nu1olenmictlt a2rmum ;o4olenifeiytla2ulu o () rxrxf3iadop e nvsl( srurxm iodom nlfcilsfaDrrxmp;o0texn icils aDul(vo;(0 rtoxr3ootop  anvo;t srxr(rpiu4ap elfcsl()sDtr(m ;o4tet  ociytlm rauvp (0tlxoxf3iydfpteauvi;t t2triopnu4opte fvi sfs2trum no1aet ioeild s eanvsnu4trtnmo3ta1om eli o t)sexmir3ou4aptemfvia(  rtr( poo0apt moeiaslsDea( pnt0aetnxrciotfaDrlnvil(0t2ur(o3oudope  fet sfa2tr(  ;t4oetnmictad s umu p;u0areoirctytla eanvs s)texrir3oudop  lnctls)srtm(mpot1tpxn oeild aDrluvp u4alenxo io1fptr uvi s0srtoxopnudap eliesa(f rur(moot0tpt mieild sDemnvon(4aexoxf tadop e ivi;s  exoxrpio4amee ncta()aDrmumo;t1olx mfciydfs uaums t0 reoif iotopDrlnei;t0sexm(r nudap emnci t) 2ua(mpno4tleomo3iadfaDelnms;u)aexoif iodfa ean il()srtoxr ou1alte nvsa( sruru  no0aet ifciltfm2rluvp u4tleniociadop  anvi s0 2tmxopnydop elnvsl()arrruroot4tet  f3iytlmDul( snt0aeenmr3oytlm  aneo;s0s2xo(o io4lptnmfvtat) Dur(mpoo1oexn oeiytls ulnms t0tlxrir oatfpDrli o (0 rxoxo io4openmiesltfsrum(mpno1tltnmi3ild m ranmp t) exnxf3iytop  luvolt s2umim nu1amt mnvia( aDtrx p;t4oet  feils m eauvsnu4 etnmfciadfmtr n i;(0tetmim3oodlleemncsl() 2tr(r nt0tee ifciys m ul( o u4altrxo3oa1laDeaieo s0 exoiopoy1al n fcs tfs2ur(ronu1tpxnmieiyt m ea( pnt) lxrxrctadop rln o () rtmxmpoy4lpe  net t  rtrxrp;t4tltniiciasfsDrauvp;u4texomf3oydlmDrlneslt) rxoimpoo1ap elivsat a2umumoou1alen ictat s2um( o;u) lxoxf io1fa rai i ( s2xm(m ny1lltnlfvtl(fa2uaxroot4apto f3tydls ea( on(0 rxnio3oytoaDe n ils0trto(m no4op  lfciatfs2tr(r ou0oeenif3tyslaDra(mo;() eenir3ootomD au ils seto(m3iydap nmnes ( sDrmum ;u0opxo octls a ulnmo;u4alerxrciydom rai ils0srxrimpiu4apenlneil() Dra(  ou1tle  feildlsDeauvo (4 lenio to1lp e ivi;(  rum(opiodlm n fesa( sDtr(rpou0teen fctas mDem( s (4 lenmo ia1lpDr uvsls0sruoir3iudlmt lnetlsfa2ur(ro;o1alxnmfeiytfm em(vs t) rxrifciydfa rlies (0 rtrio3ou4optn neilt)sDrmum ;u0altomo3iys aDelnms;t4altnmr3ootlmD  uvil(  2xr(r3io4ope livsltf Drrx poo1tlen oetlsls2ulumon(0tlenir3oatfa eaieilt teuoio3iudom n netl(  2uax onu1tleoifciadfs ra(ms t4 lermo3todlpD  u s t)srtm(opoodal e icias)sDua(rp;u1ape  feild m2elnvsnu4 exniocoy1laDraueol()teumxrpnudal  lnes ()srra(mooo0oet ifctys s2rl( s (4tltnircty1la ean i t t2to(rpnu1ap nlieta( arrrx pou0optn f3iydls eanms u0 eeoxf3io1lp  li i t) rxo(m iy4ole mfesatfaDtau o;o0ale ifeias a rm( pnt4alerircta1opDe ueol(  rxrxm ny4omtn ici t  2rmxm nt1optn oetaslsDean s;t0tleomocoadop  lnvil()tetmxm3iudap eliesl(  2ua(m nu1tpxomo3tat s el( s;t)tlxrio tydop  ai o;s)srxmir3no4lltnmfeias)a2umx  ou4alxniieiyt m2eluvp;(4texrxf3totoateauvil( setoxm3iu1lpee nei t)aruax oou0aeenmiciytfa rl(mpnt4teenxf3oodopt  ueol()srtrxrpiy1llt lnvi tfaDrr( onu0olenmi3iadfm2ran sn(0texoif3oydom rlivils)sexr(m no1lmeemfeslt a2uau p;u4ale  i3iasla2rlu pnt) rtoir3iotlpD  u i;(0seuoxr ou1opt  fcs s)sDum(rono0oetnmo3iatfa2rlnvp;u4artoirciydla e nvi ()t2xo(m no4ope mncils)aDra(mo;u0optniiciyd m ranms u4aetoir to1lptelueo;t texmxr ny1olen ivi t  rra(mpnu1tex  ieild mDrmums u4 lermfctytfmDr nvils) 2urxo oo1ome  ivil(  rtr( onu1alxnifcias m ua(vs t) etriociytomtrai o (0 rurxr ou1ale lietasf 2rmxrpnu4apeoiieiltlm ul(msn(0 eerircoodfatraiei (0trxoxo oo1am elicsl(fs2tmxm ot4apt io3iyslm eaump t4artrxf oytfm rlivi;s s2uoirpny4lmt  ivtlt srumxm ou4tpx mietatfmDrm(msnt0teeomf3to1fmt lu i (0tetoxmpny4optemivi t)a2tru pou0oetomi3iytfm uluvo;t0aexoxocoodlmtrli o ( tetoimpnodam nmnes (  2uauroou0tptnmfciatfaDelu o;()tlxrxo3ta1lp raies;()sexm(m3iodope  nci t)aDumxr ou0aptomo3ild s2uau pnu)aetnxrciodfp  luvo;s  exmxm iu4oleelivta( arraurp;u4oeenmi3iatfmDuaumo;t0trenir oa1fp rau ol(  2toxm oo1ame mnvi t) Draxm nu1alxoiictltlmDrmu pn(4tetrxocoy1opte uvo;s srurio3no1ol elfetas) Drax o;o4tltnmo3tatlm um(vpn(0tetrxfciodlat lnvi t0t2toxo3io1lpt  fcs ( sDrmxmo;t0tet  ocilt m rlump;u0tltriocoatoa  anvsls s2xo(o oy4ap e neias)aDtmu onu1tltnio3iat s ulnvp t4tetoir3oodoa eauei s) ruo(o oy1omtelivias artmu onu4tlto fctat mDrlu o u0 etnir3io1oaDrln ol(0 2xo(o3oo1aptelivs (f rra( oou0tet mf3iltlmDelumo t0tltrmfctatfmD li o;s  2tr(o3nu1amt mfcsas) rtr(ro;u0alx  f3iyt aDeanvo;u)tlxomf3tatfpD ln ils)t2um(rpio1amtnmics tfa2rmumpno1ole ioeildfs rlu p;t0tltnmrcootomD  ies ( srurxm3no4lp nlfcsa()s2raxmpot4texo i3tytla uanmonu) exrmf3iadomD  ues;t s2xr(m3oo4lpen ivsas) 2uax o;o0apeo octadfsDeanmo;()tltrxr ootfmD auvi s)sexoim3ny4olt livtlt) 2rrx onu1aet  f3tlt s2ulnvpn()altnxr3todlptraueo (0srtrxr3ny4aptnlicia(f rtaur nt1oeto iciysla2uanvo () ltnxf io1la   ieo s0 rtoio oudamt lfes s a2raump;t0aexomoetatlm uln sn(0 lerxfctatopD anvs t srumxm oo1ome lictasfs2ur(mpno4aeeniietasfm eluvsnu0arxnmociodlaDe i ilt0t2xmxr oy1om elfvt tfa2rrx ont0tpe mfetldfm emumsn(4trenmf3oodlmDe ivsls0srxrio3nu4amee ieta(fsDurxrp;t4tex mocilsfaDrmnmont4tlenifcoadlmt aiei t) exo(mpnudlme mncs t)arrrxmoou0olxn i3tyd s2el(vsnt)tlxnxo tatoateauvs s0t2tmxm3ny4lpeelfes s a2trxmpoo4aee ioeiadls el( s;() lxnxr3tydfa r uvo;s sruo(rpoodlm   nvt tfsDumur ;o0tpen ieilsfaDul(vont0treoir tadla  livol()t2xmxm oo1amenmictatf Dtaxr ;o4tpxoiieiytls2emnvo t4aetrxocoydfmD  u o (0 rxo(o io4ole miei ( srrmum ;t0aex mociyt m em(vp;t0trenio3todla r nesls)t2umim iu1aptemfetls)sDtru pou4alt ifetadfs2uau p u4trermf todop  li sls trtoxo iu4ol   nesatfs2rmuronu4olenii3ildfaDeanvpnt4 exoxociotfm   ues;s) 2uo(m ny1ape  fci t srtmumo;o0tet mi3iat a rmnvs;t4arxomr3ta1faD luvi;()trxoxm3nu1ame licsas aDumx oou4aetoioctydfaDel(vs;t0trtoiociytfptrlnei s0srtm(r3no4alte ict tf 2trurpou4olx  f3iyd s emnvs (4alxriociydopt  uvi t setr(mpoo4amt  fvil(faDtmum ;u0tltoifcildla umu snu0trxoifcoo1fm   uvilt0trtm(m ny4ap   fcs () Dtrx  no0tptnif3tas s ulumo u)texrxrcoo1fpDrai o t0teum(r oo4op emnesls) Dumx  ;t1oex mocils a2uluvsnt4areomf tatoat aivi;s0t2uo(o io4amenmfet tfa2uax  oo4tee  fciydlaDean o;t0alerxr3oa1oa   i s t) exoio no1omt lietas aDum(mpoo4aexnii3tltfm2el( s;u)arxoiociadlaDeaivi;(0tetoxr3oo1lp  miesls)sDraxr oo4oetomfciltls ran on(0 eeomf iodfmtrai o;s0srtmim oo4op emnviat  2tmxmpou1ope  o3iytfm2um( sn(4arxnmocto1lptraies s seuo(o3oodoptemivt t)aDrau pou4oeto iciat m uan p;u) rxrircoydlm   uvi (0t2urir nu1olen ivtat  Dtaurp;u1alxoiietadls eau s;t)alxrmr iytlptr uvo s)texmxm oodomtnlfeil() rrrumono1olx ioctasls el( p;(0tltoxr ta1fa  anvolt setrxm no4lmtnlncil() rtau oou0tpeo o3tld sDranmo (0alerif oadlate uvi (  2trio io4amt miciatfsDtrx  ;t4aet  oeiysfa emu p t) lxnmo3iadlp e nei (  exmiopny4lmt liciasfartm( pot4texnioeildlm2uluvo t4 etnxoctydfm  an s t)t2tmxr3oydoleemietatf 2uaxrpnt1alx mocilslaDua( onu) exoio3iydopteanvs;s  rurim io1lp n ivi ()aDrrxr ;t4apeoifetysfaDum(vo u)arerif iadlmDe i s s0sexoiopnodlpte ivs t sDrmu  ;t0apt iictldfm2uluvsn()texnxr oytfptraueo;( t2tm(o3iu1ope micsas sruaxrooo4oleo f3iysfsDrmu o u4 lxrmfciy1om rluvo;s  rtoir3oy4lmtnlnvils  Dtrxro;o4tetomi3tysls2emuvs;()texnmocoatfpDrli il()teur(m3iudapenlfcta()a2uaxr ;o4tex mfeiltfsDumn s (0alenmrciotfm e u il() 2tmio oodom emivt ( artmx  oo0olt  fctydlmDrmnvs;(4alerxf3todomtelnvo s t2toir ou1om emfesltfarrm( p;t4tee  f3tad a2em(vpnu4alerioctotlaDeanei ( trxmir3io1lpenlnct t)s2trxr oo0oeenif3iltfa el(monu)aexnmrciodfa elu slt)trxm(r3ny4aptn fcsa(  rumxrpnt4aet ifetltfa2ulnvo (4aeermo3iytlp e n s;( s2toir no4altnlfvs ( sDtmx ooo1opt  fctadls ea(vont4tltrxf3io1fpt aneils sexmir oy1ape  nes ()s2tm( pot0tetniiciysls em(vonu4 rtoxr oo1faDrlneslt sruo(r3nodlptn fvilt artauroot0olxn i3ilt m2ua(ms u0 renmf ty1lm elivo;t t2xoxrpny4alt mietas)srraxr nu4tptnifetlsfmDum(vp (4tetoxr3oadfpD auvs s0t2urxo3nudlle livt t srurum no0teto feiaslaDrmuvsn()tlermrcoy1fpDeaueolt0setmim3iy4amtelneil(farum(rpoo1tlx mi3tldfm em(vo ()alenxrciadomtr uvols seuoim no4openmivs s  Dtax  ;o4aleoiieiad sDua(mpn(0tltoif oydlat  uei ( t2to(o nudole  ieiatf 2rrur ou0aeto f3iat mDuan pnu4artnio totlatrlieol()trxmirpiydlpeelfctasfsDraurooo0opeo oeiyd sDel(vpnt4trxrmr tadomDelueolt0srum(m3iy1lmt  ncs t) 2tmuro;u1openifciys aDrm(mo t4teermr tadlaDe ieo;s  rumiopno4opteliesatfaDumu o;t1aleo ieiydlsDrluvp t4arxnmf oadomte neilt0trtmxo no4omt liviat) 2trx o;u1opxnifeiltlm2umnmsnu)tleoifciatfptrlnvolt)t2uoim3ny4olee fvi sf 2ua( p;t1olt  oetysla rmnmp;(4altnxfcto1fpDe nvil()srumxr iu4al eliviatfartr(rpnu0tpxn ociydfm ra(msnt4 rtnmr3tadfmD  i ilt seuoio ou4lme livtls  2rr(root4opx ifeils s2ranms;t4 lxnio3tadla elneils) 2xmxo3nu1om nmfciasfsrtrxmpou1aexo f3tysls em(vsnu0artoxf io1lmteluvo;() 2tmim oo4oltnmieils aDtrxr ou0tee  feilsfsDel(vp t0 eenxfcia1lpDelnvs;s)texoxopiu1ll n ivsatf rrm(mo;o0alenmfeiytfa2rl(mp t)teermf todlpD auesls srxmirpiu1lme lfvsl( sDtau o;t0oetn oetasfaDulu o;() ltrmf3ia1lp rln i;s)teurxm3oodame lictas aDuax  nu1olto fetadfs rauvp t0trenif oy1lmDrli o;t0s2toxmpiu1omee fetatfs2tm( ooo0tetn icilt m uanmont0 lxrir oatopD lnvi t) rtmio oo4opee nctltfarrr( oou1texniictydlm rau o;(0 ltoxrctadomt  n slt s2um(r3iodaltnmiei ( s2rm(m no0alt  fetadfa2rmump;u0alxrmo ty1fpDean olt0t2xoxopio4lp  lnvi sfa2umxmoou1apt  ociadls2el(vonu0texoxf oy1fat  ueo (0s2tmxmpiodlp nlnvsatfs2ta(m ;t4teeomicildlaDran o;()aexrxr3tytlptraieilt  etm(o iy1llt  nvsls  2rrxronu0tpe ifciat a2umuvsnu0altrif oodlpD  nei (0 2xoiopoy4apeemneias aDua(r no4ale ioeild mDemn p;(4altrmf3oodlatrluvsls srurim io1lmeemictl(faDtmx  oo4aeenioeiatfaDrl(monu0aexnmr3tytlatr ivsl(0tetm(mpno4olt  icsat)sDtmx pnu1aee  ociytfa2rmnmo;(0aeeoxf3oy1op  ai o (0s2tm(r3oo4ame lici tfs2urum ;o0alxnii3iysfm rl( onu4 leriocoydfm rau sl( teurxopiudamenmivsas)sDta(rpnu1tetoifetytlsDem(mpnt) eenxf iydomte nei;s0 2toiopnu4lm emfeslsf 2tax  oo0oet mfciasls2elumon(0aetriociytfpt au o;s) rtoim iy4am e nvils sDtrxm no1tltnmf3tadlm raums u0alxniocoadoptelnei s tetmxm oo1ol nlneils s2rrurono0tpxn i3iytlm2um(mp (4tlenir iadfatr uvolt)trumir3iydlm nlict s) Drmxrp;t4altoiiciat s rmuvs;(4texnmoctatfm r uvi s) rxm(o3ou4ll nlivils aDtr( pnu0tet  oetytlaDua(vs u0trtrmo3iadlate ivi;()s2tmxmpno1al e ietlsfsrur( p;t1opxomo3tys a eanvp;u0altoif3ta1om   uvil( srurxo3oydameemfeta(fa2um(m no1olxoiiciysfs ean o u4tlxrmf oodlp   n s;s trurimpiydam  lnvsa(f rtmxr ou1tee ioctyd m2uaump;u4tlxnmo3iytfat lues s0teumir oy1lle  fcia(  Drru pot1oee  f3iat aDua( p;t) eerir oydfptelivil( tetr(m3ny1llt licta( s2uaumpot4texoiietltla rmn p (4 ltrxf3iytlm   u s (0 rtr(m3no4lptnlnvia()s2umu pot1oexoio3tyt s2ra( p u0teenmr tadlm rai i t) 2uo(rpiy4ol n nctas) 2uaur oo1oet moetaslm ea(ms;t0 renmr3iatlmDean sl(0 exoimpnydom  lnvsl()artauro;o0texoiociasls2ulums;t0texoio oatfp   u s t)s2toir iydlptnmnetltf 2rmxmooo1opxnmf3tydfs emn pnu)arxrxr to1op e n sl(0t2uoxm oudopt  fcsl()sDururonu4oetnifeiydlm rm( p t0arxnmf3oydlpDeli sls0tetmio oo4lmeelnvi ()s2umuro;o4ope mi3iyslmDuln o u4trxoir3totla ranvo s)tetrir3iudap nlnetatfs2uax poo0tpxomoeiydlm el(ms;(0trenif3oodlmtrln olt0trumxrpiodam emnes t)srumxmp;u0aex iociat a uanms;t)aexrxr3iadfmtrluesl()t2tr(r3nudapt mfcilt)aDrmxr ;t4apxn fctltfaDrln sn()altnirctotlm rauvo;t0 exr(rpnu4ap nlfviltfaDrm(mont0tpx moeiad sDeln on(4tlerxfcoydfmteli s t0setm(r nudam nlfes sfaDuru pot4apeomiciltla rln p;()altnxo3oodoa  anes;(0s2uo(m3nydalee fvslt  2um(r nu0tlt ifeiasfa2ua(mp u4alxomrciydfmD an s;s t2xo(o3iydom e ietls artmurp;u1oleomfciatlaDumnvp;()tlxrmf3ty1omteli s;s)seumxrpiodlpt lncsat)a2umx pnu1ape miciyt a ua(monu4 eerxo oy1omDelu ils)s2um(o iydaltnlfvsasf rrm(  ;t4oeto oeiytla uanvpn(0 leomo3iy1lpDe nvi s0truoxm ou1lmt  fvia(f rua( ont4tpxo oetlslaDra(mon(0 exoir3ty1fmD lnei;() 2urxo3io4llt lnvslt srumx onu1aetnmoeias s2uluvont4tltrmfctydlaD lueo;(  rumxr3oy1lmtemivsl() 2rmxro;t0tet mi3iyd s2um(vs;t0alenmr oatlm rai s ( srtr(opou1am  lici ( a2urx pno4tpeoiocias s rlnvp (0 eermoctotom e uvo (  exr(o iy4lptemfcslt) Dtm(  nu4apeoio3tyt m2em(mpnu) rermr3ia1fmD auei;t0trtr(o oudale mfcsa(fartr(r ;u1aet  oeiadfm ea( p (0 lxnircoadopDrliei;( srxoirpnu1am nlivsl() Dtaumonu1tptn oetltls ua(mo u)trenmrciytlat aivol() etoir nodopen ieias) rrmur ;t0aet  oeiysfs rl(mpnt)trtrmfctadoatr ies;() 2trxm iu1lle lnetas)s2ta(mpnt0olxn ociysla umuvo t0 ltoxr3todoat  ieo;()srxrxrpnodal nmnvtlt)s2rmx pnt0tpenmoeiltfmDul(vp;t)aetnxo3iotlpDe neils setoio3oy1alen fet ( sDra(  ;u0oet ioeildfaDran p;(4alxnio3todomteaiei s)t2xr(r3oodll e fes ( a2rr( pot1alt  ociltfa rl( s;u0 etoio3to1faDr n o;s0 2urim3oodomtelivs ( aDrruroot0aexn f3tlt m2ua(msn(4 rxnmociadlaD  ieslt  2xrir3iu1opte ivt s)srururont1tptnmo3iad s2rlnmo (0arenmf iydlmtr n olt sruoir iydam emfct (  2ur(mpno0oetomietasfsDranmp u) rxrmf3tatfm rlnvi ()s2xrxr iy1al nlnvilt) 2rr(mp;t4tpe  o3ild m2um( ont0tleoif3oodlpDeai o s  2xr(o3ou4ome mnvilt srtaxmp;o4tpen ocild sDuluvp t0treoir ia1la elueolt srtrim3io1ll emicsas)s2tmxrp;u0olxoio3iasfs2ranmo;t)tltnxr3todfmD auei;s)trtmxm iu1ll emfesls arururono4aetnmfeiaslsDrauvp;(0tlxrircoytfmteau olt0trxoio3oy4opte nesa() rtrur ;t1apto ociad aDulnmsn(0tlxrmr io1lp  lies t0 rum(r ny4lp nmncslt)arrrxront4tptoioctatlm2um( on()trenxo3oydomte ivi s0seumxo oodlpt lictas  Dtrx  oo1tle ii3tlt sDulu ont) exnxo oatla e iei ()srurim3io1llte nvsatfsDtr(  ou0aetoifeiysls rlu on()tleoircoy1fp r nes;t  eurxopiy4lp emnci t) 2uaxr ;t1apt mo3ils s rmu sn(0 eerxr oadlm eaiesls0 rxoio3ou1ll n iviat)aDtm( o;o4tleomfeilsfm uaums t0 lerxrcoadlmD lnvsl() exr(r ou1op nlnct tfaDrmx p;o0ole iiciatls umuvp t) rtnmf3tatlm elneils0 eumir io1aptnmivils srtm(mo;o4oex  octad m2ua(mo (4teeomfctotlmDeli s;s teurxo oy1lpte ncsl() Dra(mp;t0oee if3iatla el(mo (0tltoxrciatfpDeaivi;t  2ur(r3io4olt micsls aDra(mp;t4opxo feiyslm ulu snt4aeerxr tatoptr nvolt0t2xrirpnu4am  lfvi ()a2rmurpnu0optnii3tyd sDrauvsnt4texnxr3oytfm eluvi;s0teuoir3oo1apt lfeil( s2rr(  ;u0opt mociydla2el(mp;u4tlxnio io1fatelu sl(0 etrirpiodlmee fvs tfsrtrx  nt0oet  feildfsDua(von() etnxrciadfm elu i;(0trtrim3io4om  mnvta(f Drmxmpnu1aex mi3iyt aDel(mpn(4 rxrio iodfm e nvi;s) rxmxr3oy4lltelnctl(faDtm(rp;o1ole  feiytls ea( on(4altrmo3ootlaD lu s s0setr(rpoydolt mncs (  rrrxmoot1tpen oeiatlaDemnmonu)tltrmr3ta1lpD  ivs s) rum(opio1amtnmivtlt  Dtrx  nu4ale ii3iytfmDrlnmo;(0trxoio3ty1lm   nesls0trtoim3ou1alen ncsas sDrr(  ;u1alen o3ils m rau on() eerxr3to1oat  i s () eurio3nodap e icilsfsDra( pot0opx  oetys sDranvonu0tltrio iydlaD  n o;s0trtoimpnydlp n nvi t)artm( pot1oleo oeiasla2um(vpnt) lxnxo tadfmt  ueils0 2tm(r oudlmtnlics ()s2rmxmp;t4tlxo ieiad m2eln p;u0trenir iatlp r uei;s sexrxrpio1llenlfctls)srta( pnu1teenmfetys mDua( snt) rerxf3tydoaDranvo;t texo(r3nodamtnmfvils)a2uau o;t4tpxnifctad a uln o t)tetrmo3iotlmD  u s t)seumio oy4om n fes ( sDrm( poo4tltnio3tadla emu s;t)areoio tatoptrlneols)sexmxopnu1om  lnesls)sDur(rono4tlx ifctlsfs2rm(vo (0trtnxf tadoptr uesls trum(rpny4ll   fvs tfsDtrxr nu0aetomf3iysls2uau s u) eeoio iotfp rlu s;s s2trio nodlmen nvtlsf Drrumpnt1apt  f3tls mDuluvonu0trenxf ta1lmDrlu i;t0srto(m3io4am  micslt) Drax pot0aexo i3ild sDrln s (4tetnxf oa1laDrluvo t teur(mpou4lleelfesa(fsDuaxmo;t0tpx ii3iadfm umuvo t0trtnmo oa1oaD an il()trtmxopny1lm e fvi tf Drmx ono0oex ii3iadfs ul(mo;()teermrcoydopD  u ils texrxm oodom n fvtl( sDta(ro;o4tleoii3ils a ran snu)altoxociodfatrlieo t s2toirpny4lp  mfcs t  2rmxr ou0aex  icild m raump () rtoxr3oytlmtelieolt) rxoxopnodaleemicsa()aDtau oot4opeo oetltls2eln s (4 ltnmfcoadfmDeaiei;(0 rtrxm3no4lpeemnetas)srtmu  ot4oetnmieiyd m ua(ms;u4tetrmf3tydlaD lu i s t2xo(rpoydapt mnvi sf Drmumont0optoiiciad a2rlnmpnu4teeoio3iodfmte i ol(0teum(o iy4lmee feslt artmxrpno4aex  o3tydfa uluvp;(0teeoio3oy1opteauvs ( seurxr3iodolt lfvtas)a2rmx poo1tetoiictls aDrlnmpnu)artnioctodlpDe uvi;()truoiopno1lp  mfeta(fs2rmu p;u4aex moeiatfmDemn s t0aleomfcoytfmteaues;(0 2urxrpiodom nlictl(fs2rm(  oo4alxn i3iyt mDeanmpnt) leniocia1opDelneo;( sexm(m3iy1lptnlncsas)artm(m ot1teen fciatfaDrm(vs;u0 leoircta1la elnvs;s0sexr(m3ou1amee neta( s2rru o;u0tpxoioctlslmDemu s;u4alxrmo3oo1opt lieo s  exm(r3nu4lme  neslt)arrm(mpoo0tpen fcils s2em(ms t)trxriociytopDr ieolt trumxopio4ol emnvs ( srtr(rpoo1tpeo fciyslm rauvs;()trtrmfciatlateauesls s2xmio iu4omen ieil()srumu ono4olxn octldlm umnmp;t0tlenmf ta1omtrau i s srxm(mpny4am e feiat)sDrmur ;o4tlto ietys mDuluvo;u)aetrxf3to1faDr nes () rxm(m3iu1lpte ict () rum( pot4optnii3tysls em(vs t4altnmociotoateaivsl()srxmio iy4lmtelics ()s2ta(rono0olt  ieiytlaDrluvpn() ltnifcio1fpDeli sls) exoio no1llenmfvsl(farrm( poo4tlenmoetytlm eauvp;(4alerxrcoatfpD  ues;s0 etrim no4lle  ivsas)a2rmumoou4oexnioeias a2umuvpnu) eeomr oydopt lieo s0t2ur(o3oodalenlfet ()sDrm(r nt0opt iocilslmDrl(vo;u)altnxoctytomD lnvol(0trtriopnu4alenlnvt (fartaxr ou4alx  f3tadla eluvp u) etrmo iy1lmtrauvs;t)sruoxrpnudole lfciatfa2rmurpnt0apxn icild mDrau pn(0tlxrio3iadop e ivolt0s2uo(o no1om   fesasf Dtmxmono0aex  oeilsfmDra( o;(0 ltoxrcoydoate ieo s)tetmxr3iy1alenmivtl()a2ta(mpou0alenio3iasfsDul( pnt4trxrircta1fmDrli i;t  rtrio3oodlmtnlicsltfaDrmxmo;t0open octltfaDra(mp;t4 exoxo3oatfpD lnvsl(0t2urimpny4omtemnvtatfa2tmum nt0tlenmoeiysfm ulnmp;()tetnxr3ia1fm r neslt) 2toxr nodomeemieilt)sDtmuro;u1tptomfctld mDranvsnu4artnxr3iydopD lu o t0srur(opio4ol nmiesltfsrrm( ont4opx mociys a umnvs t) exrifcoydfp r nvo t s2trxmpoudapeemncslt s2um( ono1oee moeilslaDul( p u4trtrxoctadoptrlivi ()srur(o3iydap nmnet (farum(mpno1tlx iociad s uln o u0tleomr iadfmDe ies t s2uoxm iy4omt lfvsat  2ra(r ;o1tpx iieias sDumu o (4trenmf iy1opDelneils)s2xo(rpno1aptemfcia()srraur ou1teeomoeiadfmDuaumont)artrmrcoodfp elnvolt0trtrimpnu1lle  nct ()a2tauro;u4tltnmociytfa ra(monu)arxnxo ootlpte u slt) 2uo(m ny1al nmnctlt)sDtmu p;t4opeoiieilt a2ean o (4altrifcty1fptran s;t0 ruo(m3no4ap emfet tfs2tmu ono1tlt iictldfm ran p;t4treomocoatla raneo;(  2um(r oodamt mfei (fa2umumooo1alen ieiasfaDem(vs u4 rxnmocio1laD aivi;t0 rxmimpiudomtn icia() 2rrur nu0tlenmicias aDrl(vp t0texoxrcoatlaD aieo t) exo(rpoydll elfctls)s2tmxr ou4tlx  fetadfm rlnvp t4artnir ia1lat  ivo t) eum(r3iu4optnmnei t aDtrxm ou0oeto o3ils a2ra(vsn()tlenmrciytoa  ai o t srtm(opoo4am e fvt (faruaumpnu0aeenif3tadlsDeauvo;(4tlenmf3oa1om rlneo;s0s2xrio oy4openlietasfsrumxrpnt4tet moeiadfm2eln pn(4 rerir3oa1oa  lu i;t0s2xr(o io4oltnlfcsl( aruax ont1ope  oeiyslm2ranvo;u0texrxrcio1lptran il() euo(r ny4op elies ()srrrx pnt1aeenmieiat s ul(vp (0arxrxr3iotoaD  ieil()trxmirpoudom nmfvsltfsrurxm oo4teeniiciatlm2em( p t0tltnio3io1oaDe n s;()setm(rpiu4om nlivsasf 2tm( poo4olx mictltlm rau on()areoif iydomtrauvs;() 2uo(m ou4ome mfviat s2tmx  ;o4tlxoifetls s2ranvp;(0 eenxf3ootom elies;t setoio3oudlltelncia(farurxr ot1tet ifctysla2ra(mpnu0 renmf oo1lpDeaneolt  etoxo3no1ome mics t srrrur ;t4oleoifctasfa2rau onu) lxomrciadlm   nes;t0 eumxr3nudop   net ()a2uau pno0tpxo f3iasfaDulu p;u4aeeoxfctotoateaues;t  euoxo ny1altelies (fartr( pno0texo fetatlsDel( on(0arenmrcoodopDr ivilt)s2tmxr no1op nmfeiatfsDumxmo;u1aetnmietytfmDum(vo;t4areomrciadlp rln o;s  eum(o iy1ape lnvias  Durxm ou0openioeiyt a emu p;t)alermf3todfat  ieo s texr(m3oy4al elnvtas)srrr(mpno0alxnmi3iasfs emn s;(0 rtrirctotfatrli i;s0trxo(mpiu1llte ivsa() Drr(rono4opx iociltfs2umnmo;t0aeeoxocia1fateliesl()srtm(o3oydol n fcsltfsDumx o;u1tlxo fctas sDeanmp;t)aleoiocta1fa  aiei s0texr(m no4al  mfvi s  Dtmurono0aeeo i3ils s em(mpnu4tltrio iodlm  au sl()setm(opiudlltn fciltfs2umxr ot1olx  feiasla2umnmo ()areoir3tadfptelies s s2xmxo iy1alee neiat)s2raurp;u1aetoii3iltls umnmonu4tlxomf ty1fm elnvs;s)trumim iydlm elivtat s2umxrooo0tleo ociad s2em( o;t0 exoio3oytfmtrlnvi;s)srumir nu4ape lnei (f Duru p;o4ole mf3tasls2rmnvp;u) ltoif3todfa   nei;t)seurio oo1om  mnetl()sDtrxm ou4tlt ioetyd m ua(mon(4 rermfciadlmtrlieols  rtr(r oy4olt livia()sruau oou0tptniictlsfa ua(vo ()aeermocoatlpD aneolt)srtmxopno4omenmfeia(f Dtau  ot1oexoii3tydfa ea(mo ()tltoxf3io1lateauvsl(0t2toxrpnodllte ivi tfsrua( p;u4opxo feiydla um( pnu0tltoxf3iatfaDr ieslt0trxmim3iy1llte ncsatfs2rrxrpou4tpenmo3iat m emuvo;u0 lerxo3to1lm  lnesls)s2tmxm iy1lle lnet t arra( p;t4aexn fetltfsDem(vs t0areoxfctotlmDrlu i t  eur(o3oy1llenlieta(  Dtm( o;o4opto f3iydfsDem(mp ()aexniocio1lpDrau i;s) 2xoir nydal  liesat)aDrrxr ;o4tpx ifeiyt sDeauvo t)tlxnxrcoatfat  n olt  eumio ny1amtn neia(f 2tmxro;o0ole  feiasfmDeln pnu) ltrxf iotlp elivs s)t2urim3ny4lp   fetls)a2uax ont4teeomo3tltfaDemumo;()texnifcia1latraueslt)trxmxr3iydlp nlivia(f Dumxronu4olenif3ildfmDel(ms;t4trxoir3tatlmDrlieolt)seuoxo iudal  mncs t)sDur( oou0tlxnmo3iyslm2emnvo (0aexomr ia1oa  lnvolt)s2urio3oo4ol e ietltfartrumonu0olt iieiatfaDua( snu4aetomr iotfpt  ivs;s0sexm(o ny1amenmnciasf Dtmxmpoo0tlenio3iadfa rluvsn() ltnir3oytoaD lneo;s seurxrpoydomtnliesl( srtmumonu4tpeoifeiasfmDum(vp t)aeenxo3oa1lateluvols0 rtrxopoy4am   fctat artrumpot1aeen ietatfm ra(vo;()arxrxrcoa1fpDrlu ilt trtmiopny1amenmfeil()aDrrxroou0tlen ieildfaDrau s;u4aetrmf3ia1opD  i ols0srtm(opiu1lltnmict sfarrr(root0tlen fctytls eln s (4 rtoif oa1fmt ln o;s0trum(r nydale mies (fs2trxrp;u4ape  i3tatfaDuanvp;()teenmf3io1opDrlu olt0t2xrir3iudaltemncslt)s2rru  ou4aptoifcilsfa2umu s;(0tlxrmfctytlp elues;(  2trxrpio1op emnvilt sDrmum oo0tltnmi3iad sDem(mp ()artnmfcoytfmD an o s s2trxo3oodlp  livi sfsrtm(rooo0opeo octlslaDuluvo;t)alxoir todlmt aieils)sexoxr no1ape mnciatfsDtaumpnt0olto feiasfa rm(vont0 exrxo3totlpDr nesl(0seumir3ny1op nmnesl(fsrtmxrpot1teto f3iyt m eln pn(0alxnir iy1om r nes ()seuoim3oydlmeelncta()a2umur ou4alx iociatlmDuluvo t0 rtoxo3oy1opD  n i;t0sexrxm3io4ape lictls)s2umxr nt4olt  fciatfa2rmums;u0 ltrxr ia1omt luvs t)s2xm(r oy1amenmici t  2tmxmo;t0tleniieilsfaDrmn s;(0aetomo iotfm eaueil( t2uoxo3iu1lltn ies ()a2ta(rp;t1openmi3iat a el(vp;u) eeoif3oatfat  i ol()s2to(opoodalt mivia()s2ua(rp;t1opx mieiytlm2rmumpnt4artriocio1faDelieo;t0 rxo(mpiu1lle mfet t) 2taumpot4tpt mo3iad mDrluvp t4trerirctotopt  ieo (0t2xmxmpiy1lmtn fvtlt a2ur(r nu4tpeniociys m el(mo u)tlxnmrcoy1op e i ils t2uoio nodal n fcils)aDraum nt0olxnmf3tadfmDrluvont)aetnmo3iotfate ieslt  etmxo nu4am emiei sfs2tmuro;u0olt  fciydlm uln ont4tetrxr oodfa elu ol(0t2toiopio1ole lfet () rtm(ro;u0oexnmo3tad m2rauvont)trtnxocoodoatrln i ()srxo(mpiu1amtelfeiasf Drau pnt1alxo oeiatfaDum(mo;(4 etoxrciadlpt anvi t0trxmim oy1lpee nei t arrm( o;o0apxnifeiasla eanvo;u0arxrircto1op rai i ()trtoio io1apenlfctltfa2ra(mpno0teeo fetltla2ra(ms t)trtrmo3io1lmtr nvs t s2xmiopiu4ope mnvt s)srrrum ot4oeenii3taslm2ua(ms (4teerxf3oo1op eaneo;t0teur(mpoodomtemivt tfsrur( pot4teeo ieild s ua( p;t)areoiocty1fmD aueo;s0sexm(m3iy1omee nesl( a2trxrp;u1aleomo3tad s elu o t0treoif3iotfa  aivo;s)s2tr(o3ny1lmee ici t) 2trxrp;u0oet  ociad mDumnmp t4 ltnif oy1fatrlues t0srxoio nodopt licil(faDtmxmp;o0tle ifciatlsDumumon()teermocoydomt ln s;()teuo(m3nodopee net ()aDum(mpou4aexo i3iasfs2emu pnu0aetoxrcta1latrauei ( teurim3nu1lp nlfcs sfsDrau pnt0opeo ieias s2el(mo;t0arxriocoadlpte ivs t srxrxr3iu4omtelnvsatfsrtrx o;t4oltnii3iad aDul( on(0arerir3oo1lp e i s ( t2tmio3iy4apt lfct s) rtmu pot4apt  i3tasls ul(mp;t0alxnio iadom raies;() rtm(r3iy1olenmiei t) 2trxmo;t4oleoio3iatlaDranms;(0tlxoxo3iydoa eaivo;(0srtmxm ny1lptnlfciat  Dumurpnu0apx iieiyd sDea(vs;()tetoir iotfa rluvi;t0trtoimpnu4opt lnetlt aDtauronu4tex mfetasfm eluvo;t)altnmr3oydoa elnei s t2tm(o3iudole lneia( sDra(mooo1olto oeildfs2emuvp;t) etoxo tadfatr ueo s  rtriopio4ll e nesat) Drmum ot4tleo f3tad mDulnvs t0aleoiocio1fm eluesls)srtoiopnu4ll nmfciatfarra(m ;u0opxnmfctydls emu pnt4teenircoadoa  lneo s0 eumir3nydlleemieia(  rtmx pou4aptnio3tadfaDem( s ()aexoxfctotfmtr i o (0s2xo(m io4lmt licsat s2rru ont4ole mieiydlmDuaumsnu0 rxnmfcoatlmD au o;s0t2xr(r no1ll nlfei ()srtm(rp;o0tlt iiciadfm ranvs u0 exomo oo1laDeau ilt)t2ur(o3ny4aptemietat srtr( o;o1tlt ifciysfs rlnms t) rtoxr iodfp elies;(  exoxm3oodamtelnetlt  rtaumonu4tltoiictltls2elu p t4aetrmf to1fpD  nvi s trtriopnudame mfvsl( a2uau  ot0teeo ietls aDemuvs () rxoxf3iy1fateli il( seto(opio1apeelnei s  rur(r nu0tle  o3ild s2umums () etriocia1latr u s;(0teto(o3iodamt lnvi sf 2tm(r nt1apxn o3ilt m2ea( s;(4 eenif oa1faDr ueo t setmxo3oy1lpt mfcslt  Duaumo;u1tlen o3ilsls2em(mp;t0arxniociydfmD  neslt trumirpno4alenmivi s) Dtmxro;o1altnmo3iytfs2el( p (4arxrmfciy1laDeanei (0t2umxopiodal  lictlt sDraum oo4olxnmieildlm emn ont4tleoxo oadfaD lies;(0 exmxm ou1aptnlictlt)s2rmxm ;t4apeniietld mDuaumo t0 lenxrciytfmDelnesl(0srxr(o3oodom e nctl() Dtm(mont4tptnifciys sDrlu p;()tltnmo3tatomDrauei;(  rumim3no1lmtnmivi () rtaumo;t4oexomieiyt sDem( on(4 eenxr3todfmDrlnvols)t2urxm no4alte ncsat arum(mpot4olt  fetytfs2rlnvo;() lermr3io1faDelues t) 2umir3iydame  netl( sDuau pot4tltomo3iaslaDrm( snt) rtnir ia1opt livols)t2um(m nu1ape  nciat) rua(  nu4apeoio3ias a2rm(vo;u) rtnxocia1optelies s) eurio iu1lptnmnvtls  rtr(mont1aleniicils sDemumont4artnxr tadomtr ieols  2trxr3io4alt lncslsfsDrrx pou1oexnifeilt aDulums (0aexrir3tydfpD aieil(0sruo(rpnu1omenlict (  rurxmoou0aex mfciadfa2uln pnt)artoif ia1om rlueolt  2xrxr iudllt lnct s  Duru p;t4olx  oeilslsDemn pnu4 eenifciydlm rauvs (  rum(mpiy4olt micsatf rur( pnu4texoii3iydfs uau o (4tleomo3totfpt anei s0srxm(rpiodlpt  neilt)aDrrum ot4aee  ietld mDulnmo (0 rtomf3ty1fpD aiei;(0teurxm io4lpenlfci s s2tmu  no0tltnmoetldfa rl(mo ()aexrxr oytla e u ilt setr(mpoydap n ivtl(  Drrxrono1texnmo3iad m uan pnt0arxoircoytoatrai o;t0s2uo(o oy4ll n fvt t)srum( ono0aet iociltlsDul(vs;u)aexnxf3iadlmtr nei;(  2tr(m oo1om elietl(fsrrmxmonu1olx  ociadfs ua( s t)aetoirciydlm e i ol(0s2uoio3ou1lme mnetlt sDtrumont4ale ifctlt m rm(vs t)tltrxr io1faD  ivi (0s2urirpiu1omee ivta()aDururp;t4olxnioeiatfs2ul(ms ()tltrmr3ty1opteanvs (  2tm(m3no4ame livsas)srtaur ;u1altn ociytfa eau pnt4 eermociodopDr u s t0seuoir io4olee feils)arraxrp;u4apxnifeilsfs2emn sn(4 eenifctytlpDeli i ()seur(o3oy4apt  fcs t  rrmurpou1teeoiietls a2um( p;t)aeeoxf ta1lmD  u s;(0 2xrir3oudamt  ivta()srraxr ;t0opx iietysla2ean ont4aetnmr3ootop rauvs ( sexmxopio1opeelfvs (farua(rp;o4texn feiyt m em(mp (4 rxnif totlmDraies;t  etrxm ny1lm nmictat arurxrpnt4aet  fciysls rl(mpnu) rxrio tatlmtrluvol(  rtoxrpny1omeelnviltfsrrrum nt1oet mfeiys a rl(ms u)altomo oatomteanvi ( tetrxo3nu4ll elieilt)srrmxmoou4openii3iadls rm(vs;(0tetrirctatoaDeaies;t) rtrim3iydamtnmfcils s2rmumo;t1tptoifeiltlmDuau s;t)aexrmr oadfm  lnvs;( srtrim oudlltnlfvtas  2raur ot0aexomoeiasfsDrlumo t)artnmr3iydfpD  neil(0s2um(r3iy4op elivt tfaDumumo;o1alxo fetadls2ra( sn(4 lxnmocoy1lateaieo (0teuo(o oo1oltelnvsat) rtr(moou4tpeo i3tadfs ra(mp t) rtrxfcoadlpDeauei s  2tmiopny4lp emncsltfaDumxm ;t4tptomietytlsDul(mp t4tlxnxo oa1fmDrlivs;s)srxrxm3iydam  lfvi (f Dum(mp;o1aeeoif3iadlsDuaump u)trerif iy1fpte uvo;t trxoir3oy4ll n iei (fa2rm(moot0aexoio3tldlsDra(msnt0 exrxf tydfatraiei ()trxoio3no1lpenlfvil( s2ra(mp;u0apx mfeiydfa2em(vpnu4 leoxrcoy1oate ieilt setrxrpiudlp  lfcils)sDra(  ;o1apt mietat s rlu pnt0 etomo3oy1faD lueo;s0texmim ou4am e fesl()arraum ;o1tpt mietyd s rmnms;t)aexnxr3oydlmD  ieil(0setrxmpoy1lltnmfcs tf 2uaxroot1tleoio3iasla2ua( o;t4 ltniocoo1fm rau sls teur(rpiy4am e fvtat sDua(m ;u1alt ii3tldfsDelnms (0trtrif3tytfpte n s;(0trxmxm iu4lpen iet s) rtmxmpnt0tpe mfciysla2emums;(0altniocia1fat li i (0 rtoxopiy1amtelfvtlt)a2uau  ;u0apen fcias m2ua( ont4 lenmf iytfaD lnvs;() 2xmxmpiydoptemicia(f 2rmumpot0tle if3iytla eau sn() lxrxf oydoaDraies;( tetoio oodll emfci t sDtr(ronu1tlxo oeiys m ranvp (0 exoio3oa1omtelivs;s t2tm(opnudom n ies sfsDtmurpoo1tpto octlsfm2ean o;() lxnir oodlm  luvolt)trtoxrpou4om eliesl()a2ua(m oo1tet mfetasfaDeluvsn(0 ltrif todfateaivi ()texo(o3no4apt lfvta()aDrrxmo;u0tlxomieiad s2umu p u)arermr oo1om raivolt)t2xmim ou1lpt miciasf 2ua(mpoo1alxnif3ildla2elnmsnt4altrmoctydopteln sl(  rtr(mpio4llte fcta(fsrta(mono0tpeomo3ilsfsDra(ms;u4 exrmfctydla rlneo (0t2xr(opiy1ap nmfvi t)sDururooo1teeoifcilsfaDeauvp (4alenir3tadlmtelivs;(0srxm(o3iu4lpe  ietlsfa2rr(m nt1aexomfciadls el(mo;() lermociydoat ai i;s) exrxopio4llt  ieilsf 2tr(rp;t1opt  f3iysfmDuauvo t0alxrmociy1la  aneo;t  rumim io1omtelnctls)arrm(  ;u4texoii3tytlm um( s;(0 rtomf tydopt aneilt)sexr(o3iydome mncil(fsrtmurono1tltnmieias m2el(vs u4altoxo iodfa r u s s0sexoim oy4lpt mivsl(f 2uaump;u0ape iieiadfa2rmnmp;t0 ltrmrcoo1fmtrlnvo;t0texm(m iy1lp e feilt) ruaxroot4oet io3iatfs eluvpn(4 ltnmf3iydlaD li s;t teuo(mpiy4lm e fetat artauroou0alxniictas a2umuvs t0alxrxocoy1fmDr ieolt trumxr nydlm nlicia()a2tr(r ;o4tlx io3iltfa2ean snt)aexoir3io1oaDeau olt)setmirpiu4openlivt t a2urum ou0oeen f3iad a eanmp;(0aexoxo3oytfpD aiesls) ruo(opny4llte fvilt)sruax  nu0aeenio3ilt s em( p;t)tlxnir3oatoa  lu s;(  2uo(o3io4altnmfetas sDtaum ;t0tex iiciatfa ul(vp;t4 lxrxrcta1omDe nvi;s0seurxrpnudam nlfci s)sDrr(  nu0ope  oeild m2rl(vs;u0tlenioctatfpt anvi;(0trxo(mpno1lpte nci (f Duaumpnu4teenmfetls a2ul(mont4 etnmr oodlpD livslt)seumiopio1opte feta( a2raur ;u0opeomociadfmDrl(ms u4 lxrifctadfm   i ils  rtoim iydale mfct ()a2tmu pnt4oltnmiciydlm rm( on() etoiociydfmtran i;( seurio io1llt lnei () Drrxmpou4tleomfctld s2rmnmsnu0 exoiocoydoatraiei t)t2xoirpio4ll emfvslt)arrr(m ;u0olx mf3iytls2rmums;u0tltrif3oo1lpt lies s teto(m3oo4amtn ncta(f rra(m ot1teen oetlt a uln onu0altnircoodlpDrli sls0 2xoiopou4olt mfcs ( srur(r oo4alen ieilsfm2umnvo () rxoif ty1fp r uvolt0srxoir nudopte iet sfartaxmono0aet  icild a2ra(vpnu4altoxfciydom  lnesl( srur(m ou1alen nct t)s2uaxrooo4tpx  f3tlsls ulums () ltnmf iodom eauvils0 rumxmpoy1op n iesat) Dtr(m ;t1tlt mictlt aDraump;u0tleomf tatoa  livslt)srto(m3io4lptn nvsltfs2tm(rp;t4tee  ocias a em(vont)trxomf3iatopteln o (  2umxmpny1al  mics sf Drrump;t4aet mfcildfa ulnvp;u0texnir ty1fa rli ols) 2urio io1alee fvsls)s2trxro;o4tlenmoctas aDem(vo (4 etoir tytfmt luvi t  rtoxr3ny4lm elnet t s2ra( pot0aee mo3iltfs emn o t0alxomr oytfaDran o ( s2um(m ny1ap nmfvia()s2taxrooo1tltniietatfs emnmo;t4artomfciydfaD ai slt0srxrxm iydllt mnvsls  rum(  ou0olxo ietls sDem( sn() reoifcoodomt auei;()t2xoxm nudomtnlfvil( srurxr ou4tpeomo3iyt m emnvp;u4tlxnxo oodomtelivo;s) 2xriopny1oltemiei ( s2uru p;t0oet mo3iatls rlumont0 eeoxo ia1fptelies;t)seto(o3no1oltemicsltf 2rrx o;o0alen i3tytls ua(vont0 lxnircoytlmt  nes s)tetrimpny1lpe livslt aDtmx ont0tltnmoeiatfa2ranmo;(0trxnxoctydlatr i slt teur(opno4lme  ieslt aruaumooo0tleoifcildfs2ua( o;t) lenmo3oy1fm   uvo s0t2xr(rpou1apenlivs t  2tax p;o4opxomiciydfaDraumo t)tlerio iy1optraieo ()srur(o3no1lp  lics sfsrumx  no0alto ietytfs2eauvp t0 ltomf todlaDrauei t0 exo(o3iu1optnliei t srurum ;u1apxn oetls s2uaumo;u)texoxfcoo1om rliesls0 rtmimpno4al elfctltfaruaxrp;t0oet iiciatfm raumo;u0altoxociy1la  an il(  2umxo no4lp n ietas)srrr(m ;t1aeenmieiasfm2elump;t0texoircoadfa  liei t0 2trio iydlm  lnctlt)s2uau ooo0aexo fcilslmDua(mpnu0aexomo to1lmD livi;s) rurirpiu4opt lncs tfaDuru pno1opeoifeias m rlnms u0trxoxr totfptr uvs () eto(o3oo4optemnet t aruaxmp;t0tlt mieiat mDean snu4 rtoifciodlaD au sl()s2tmim3nu1op e icta() 2ua(m ot0oetnmi3tltfaDemnvp t4alxoircoodopteli slt t2xr(m3ou1amtnmicslt) rrm(rono1oee  i3iasla2elnms;(4aetnmrcoatlp e ieil( s2uoxo3oy1om emncs ()a2rm(root4aleomieiydfsDemnvo;t)arermo tadomDelnes t)seum(mpnu1lpe lnvsls  2urump;o4aptn feiadfs rm( snt) rxrxo oa1lmD aieo;(0 exoxopoo1lpt miet t)sDuaum nt0apxnioctysla2rm( pn(0 lenxoctytlateln slt0srum(m ou4am   icsas srtrur nu1apt ii3ilslsDrlnms u4tltoiocoo1lpteauvi;()s2umir3iu4am emivtatfarrm(r no0aptn i3tyd a ranvs (4artrmr3to1lpt li s t)tetrimpny4omenmnvsa( aDtmumont4texoioctat s2el(vo;u)trenxr3oodlpD lneo;t setmim3oo1am elfeiat)srur(  oo4aexo i3iyd s rmnmo;u4arenmocoadlpD lies s)t2tr(r io1amtnlict t sDtrumoou0oetoifciysfa el(vs;u)altriociodoptelieol(0t2xr(m3nudol elicsls)a2tmxr nt0tlxomi3tad a ra(vp;(4 lerxr3oodom e u s;t0t2xo(m nu1olenmnct sfa2ua(r ot1teeo ieils m2eluvpn(4treomo3iadoa rauvs;s)sexmiopoodamtemfet s aDrru onu4tee  o3ils s2elnms;t0arxomo3tadoptr iei t0 rtrxrpiudoptemiei tfartmx onu0apxo f3iytlmDel(msn(4aexnxrctadoaDrlnvs;(  eumiopiu1lme mietas s2rm(rpou4aptoifeiytlm2rl(msnt)aexoxf oodfmDr u s;s0t2ur(r3io4ll n nctl(  Dur(rono0tlt ii3iltls emnms;u)tltoif ia1op  liei (0t2urxm iu1ll emivsls srtr(mo;u4oex moeiasfaDeluvs;t)artrmr3oa1fpD anvi t0tetoxo iu4om  lici tfsrraxm no0openmieilsls2ul(vs;t)alxoircio1fm r u ols0srurxm3io1oltelnci ()arur(mpno1apxomociytfs2ranvs t)tlenmr ty1omte uvs (0t2umio iu1lmt lnvsl()s2tau  ;u0olx mi3tld m2rm(mp;(0 ltrio oatlpDr i o;(0srtm(r3nodap emfviasfarrm(rooo4teeniieils a2uau s u0alenmrcoadfmtrli o;t0tetoio3ny1omt  neias)sDtmx  ;u4openii3ilsfm2ean s t0 etnir iatomt  ivo t t2ur(m nodaleelfctl(farurx p;u0aet iieilslsDul(msnu4 reoxrciy1lpDe nvils0srto(m3iy1alte nvt t)s2umu pno4oet if3iys s uluvo;t4tlxnmf3iadoptelieo (0 rxrimpiy1ll emfci s)srrm(mpot4oleo ociatfs rmuvo (4aetnxo ty1oaD lu o s0s2xmxo3no4lleelfvtltfarrmxmooo1tlxo f3iydla2emump;t4 etrioctadfpte iei s0teuo(o3iudal  lfctls srra(moot1tpxn i3tyt aDeluvs ()tlermr3iatom  aivo;s)t2xr(r iudaptnmfviatfsrraxmpou4alxn iciydfs eanvs u) rxnmr tadfpt au ilt0texr(r3ny1open ivtltf rrrurp;u0oltoifciys sDuanmsnu4artoio ia1lptrlnes (0texrio io4am  mfes (  rtru pnu4apxnmoetadfa2uau o t)areoio3iodop  lues (0 2urir oy1op  mfei t) 2ua(  ;u4tet  ietadfaDra(ms;(0 leoio3oa1fpD liesl()s2urirpiy4ol elnvils arum(mpnt4tptnioctld s emu s (0teenxo3iotoate nvs;s) euoim3no1op  lfvs t aDtaumo;o0altn iciat m2umu s ()trenifcio1fa rlieo s  rumxr iu1llt  ivtl()sDtmu p;t1optnmi3ilsfaDean o;t)teeoifcoo1lm r i o ( seuriopny4lpe livsas)sDtau o;u1ape io3iad s2eaumsnu4 ltrmrciodlat  uei;( trtr(o3oo1lmte fctasfaDrmurpno0aetoiictld mDraums (0tetrxrcoodfmDeanvo ()sexmxo ou1opte ivi t  rua(m ;t1alenmoctatfsDemnmpnt0trxoiociy1op  auvi;s  rumxr3iy1lltnmivs ()a2rr( pnu4altomf3tldfmDraums;u)treomr3todfmDeau sls0s2tmir iudape lfvsat)srrm(  ;o1aet ioctyd a2eanvp () rtrxf3oy1fptraivs ( setoxo3no4amenlfctl() 2tmx pnt1apenioeilslm2rmnmo;t4alxnmo3tydlpDelies s0 2xo(o3nodolen nct (fartmum no0oetnmociydfm2em(ms;u)aexnio totlmtrli s t) exmirpny1ome mnctlsfartru  nt1tltniiciadfm elu o t) etomociotoaDeln slt sexo(m iy4om e nvsltf rtru  ot1texnmfciyslmDeln p t4aexnir3iy1oat  nvi s)srxrimpnu4lpenmncs t sDta(mont1tleomoctas mDulu pnt4 reoif3to1faDe ies s)s2urio ny1olee ies (fs2um(ro;t4opt ioctysls ulnvo;u4 rxrmfcoatop eli o;s sexoxr iy4al e fvta( sDtruroou0alx ifetltlm2umuvs u4aeermr3totop rauvsl( s2xrxrpoo4oleelnet t sDta(  no0aexn o3iaslaDrlumon(4tltrircia1omDe n o s t2xoim3oy4omtemncs ()srrm( pot1tet ii3iasfmDemumo;(4 eenxo ta1oatraneilt  etrim oy4lm n ncta(fa2rrum nt4tet moetysfmDemu ont) rtoxo3iy1laDrauvo;s  ruo(o oydolenmnctas arumum ;o1opeo o3iasla2ua( p u0alermocoadlpteanvi t  etrxm nudlpe mivi sfsDtru o;t4alenmicilt mDean onu)tetoircia1fpteai o s) 2tmio iudapee fct t)aDtmxroou1opt  octysfaDrluvo ()tltrxo io1lm   nesls) 2xo(r ny4lmt  nctl(  rra(  ;o0tpxn f3iytfm2el( o;()tlenxr oa1faD  ivils)s2xoio oydop nlfeil( sDum(m ;t0oex ifetltfs ua(mo;u4 reoxfcoydfaD au s ()s2xm(m iy1ap  licsltfsDrr(mp;u0apx ifetat a2eanmsnt4 rtrio3iytom eai ils) rtmimpou1lle lfvta() 2raur no0oex  ictas mDelnmo;t0texnif3oadlpDr i slt0srtmxrpno1ameemnvtat  rrru poo1aptomfciytla ranms u0areoio3oa1oate i i;s)setoxm no4apeemneiatf 2tr(r oo1aexo o3tatfsDrlnmp (4 lerio oo1fatraneo s0texrxr3io4altn ivt tfa2ur( pot4tlto octyt s rm(vp;u4 ltomo3tatfateaivs ( t2to(r oydoptn ncsatfsDuaxm ou1ope miciyslmDua( pnu0teerxf iytoat lnvo (0s2to(r io4ol nlneilt)s2tr( oou4oetomoetyd mDeluvs (4teeomr3oy1lpt livslt)t2xr(opiydoleelneilt sDtrxr ;t1tpxnmieiadfa2eau snu4 rtoxrctatlpD  i il( srtr(r3oydoptnlfes s)srtm(m ;t4tex  oeiasfs elums t)altnmo tatfpDelivi;t)teurxo3oudlptnlict t) Dum(  ot0teeoioeiydlaDeaumsnt)alermr oydoat lnvsls  rtoxr oy4open nvslt aDrax oou4aet  ociaslm el( s;u4 lenxociodoat an i;(0trur(o3oo4aleemict sfsDra(rpou4apeo oeiydla2raump;u4 rtoiocoytfa rau ilt0texm(o3io4al  mivils  rrrx pnt0tlto feiasla ea(mont)trtoxfctydlptrln i t srumxo3nu4lmtnmneils aruax ono4aleomi3tys aDulu s t)altnmocoo1lmteaueo s t2uoxo ny1ol e nvtlt s2rrurpoo0oltn o3iaslm2umnvp;(4treomocoadlp   uei () 2um(m3nodlmt  ncil( s2raxm nu0oex  i3ilsfsDem( o u4 eerxrcoydlp e ues;t0teur(r3oo4olee ivtl(faDraxroou4teenmfcildfs2emn s;u)tetoir3oodoat lneo;t sruo(m no1lm nmnciatfsDtrumpno4apt moetasfs uauvo;(0aexomf tatlm eaies s  etr(m3iu4lle mfcs ()a2rrxr ou4tpxniietatfa rmnvo u4 rtnxrciadoa eaivs;t0srtr(r3nodll   nvt s)s2tm( pou0opxomi3iat a2ra(mo;(4tltrxo3iydoatr ivi s)sexmiopiu1lpt miet (faDumx oot1tlen ociyt aDranms t0alxnxf oydom eln i;()t2uo(r3nu1lltnmictltf Dururono4oltomoeiytfa2umn p;t4 exnxo tytlptraivo;t)srurim3iydom e nctas arrau ono4tee iictls sDua(mo;(4 eeomr oa1opt an o;s)tetrxr nu4omtemfvt s srum(rpoo4tlt ioetyt s elnms u0 rxnmf ia1fa  aivo s0 etrxm iu1ome livt ()s2rmu p;o1apt  i3ild sDua( p;t0aetnircoydlp   ueols teuoimpiudaltnlieiltfs2tmxr ot4tpto fciat a2rlums u0 ltrmf3iy1opte u ils0trxoxopiodom emfvtasfsDuau p;o4olxomociasfs ranmsnt0treoifciodopD  n i s)texrim no4amt livtls)sDumur oo0apeoioetas a2emnvo;t4 etoircta1oa  au o s0 2tr(o io4om nmfcias a2tmxm ;o4aet  ietaslm2eanmpn() rtoxo iydop eauesls)s2urxrpoo1ll   fvi (faDtm( p;u4opxoioctlt sDran s;t0altnxociytfmDr i i;s  2tmim nodaltnlnetat arrau poo4tlxomictlt m2rmu on() eerxo3oytomtr u o;t0 eumim iy1apenlieiat)sDrm( oou4tet mociat sDulnmp t4teenmo tatfaDeai i;()srtoir3oudlm   fvs s s2um( pou0tpxoiietadla rmnvo u4tlerxr3iydla elnvi;s srxrim nodlltnmfesa(farta( pnt4alenii3ias m2ua(mp;t)arxrmocootoaDranvo s)sexmxm3nu1ll nmncslsf 2tax poo4altnio3tat a rau pn(4tltnir oatoptr uei;s) rxox
\ No newline at end of file
@@ -0,0 +1 @@
+ueols t2urxo oy4ap emncs (f Dtrum ;o4alxnif3tlt s2rl( on(0aexomr3iy1om eln o;s seto(o3nydlle mfcilsf 2rrum oo0oex iiciydfa elnmp;(4 eenmo3iydlpDelivo;s0 rurxo ny1alte fcs s  2tr(  nt0tlxn fctadfm rm( o (4 etnir oytlmt  n sls0 2ur(m3nudap elics (f 2umum oo1apt mi3tlsfa eluvp;u) etoif iotlpDranvs;s0trurxopno1am  mivs tf 2rau onu0oexn oetlslm rlu o t)treomrciatfmD  neo ( seum(m3iy1ame lnci (farra(m no4aeeomictldfa ul(mp;t4 eenmfctadlpDe ieilt trtmxo oy4lmen ieslt) rumx ont0aetnio3iltfs rmnvs;()trermf todom r ivslt) rxrxr iy1ll e ietltfartrxront1aptnmieils m umnvs u0tetoircto1op r n s;s tetoxopiodlmtemnei t) rurur no0altomoeild m2eanmsnu4tetoxo oodlmDe uvi;(  2xm(opiu4llenmfctasfa2umu poo4texnmf3tatls uanmp t)aetrmr io1op  aueo;s s2xr(opou1lptemnvs t)sDtmu oot1aeeo fctyd mDrmumon(0tltrmf3oydopteauesl(0trxo(r ou4am n fei (fs2urxro;t0apen ieiaslmDra( o;t)tleoir3ia1oa  luvi;(  exmxo oo1aleemietltfarrru p;o4tpenio3tadlm elnmp;u0arxoxf oydlaDrau s ( setr(opoudap  lietltfs2raxm no0opeoiieiysla2eanvsn(0tlenir tatfmDeluvslt s2umirpiu4ol emfet s s2um(moou0alto o3tld a rlnvs ()alxrxf3ta1lpD an i t  2trirpnodom  lfei (fsrtru pnu4tltomi3iydlm ulnvonu)trtnmocoatfm r ueo;t0 rxm(o3iodllt lictltfs2tax pno1alxnmiciyslmDeanmo t4 ltrmo3oadla raies;(  exmxmpnodale mneiat s2umxmpou4tle mo3tldlaDrl( s (4 ltnir iytlptelueil( trxm(r3iy1lltnmietltfsrrm(rpoo4tex mfciadls eanms ()tetrirciadfpte ueo;(  etrio3nu1om emnvia() 2rau onu4oee ifcildfm2emnvont0 rxnio ia1la rli o ()trurxopny4oltn ncia()sDum( oou4aexo oeiltls umuvs;u) lenio iatom  luvi;t0trurirpio1op nlnesas  Duaump;t0optn fctyd a eaump t4artoxo oa1lpDrauvo (  2tr(m nu4omt mfeiat)aDrm(  ou0alxnifetatla ea( ont4 etrmf3iydlaDeliei;s0 etr(o3ny1al  lnvsl()sDum( pou4oetoifetasfm2rauvp u0tlerxr3tydlatelnvi;t0 rtrxo3iodlm  mfvs ()s2tmu  ou1tle iieiys m2emuvo;()arxnxocoydlp rauvs;()s2xrxm iu1lltelncs s) 2ua(  no0altnmoeiysfm eaums;u4trtoioctydla  ai s s setr(r nu1al elfcsa( a2ta(  ot1tleomiciydfs rm( p;(0tlxrircty1opt anvo;t) 2xoxm3oodale lfesatfa2tax  ;u0tpx  fciys a2ra(vs;(4 rtrmocoydlpD  nvo t0trtoirpnudomte ncsasfsrtaumono4apx moetysfsDrmn p u0 lxrxf3iodlmtrln s ( srtmxrpio1ll n fvi t)arra(ro;t1olt mfeiysfs umu p;(0alenxf iatfa  anvslt0 rumxm3iu4llt  ivsat a2uax o;t0apxn ociyslaDemuvont0texomr3iodlatraies t seuriopiu1om  lfcilt s2urxmoot0olxo f3tlsfa emnvo;()trenir totom elu ils0 rtm(m oodoptnmics t sDrmx oot0alen f3ias m2emuvsnu0trtoxf3oydlmD au i;s) etrimpoo1al n feiat) Dtrxmp;o1ole mociat s eln snu0teerir3ia1laDeln ilt  rxrxo iudom  licta(f 2rmu o;o0tee mo3ilslsDea( pn(4tetnif3totlmDelieolt0srtoxr no4lpee neil(f Dumumpnt0aexnii3tytfm2umn onu4 renmr totomDe n slt) eurio nodapte nvil()a2tru p;u4apt ioeiyslsDea( pnt4tlxoxfciy1fm   ivs;s0trurim3nu1llee nvs t s2umxr oo0tpt  ietldfs rln p u0trenifctotfmteln o;s0sexo(m3iydom  mivsat  2tmur ot0aeen i3tld a2ea(vpn()arxrif3iodom rau o;s setmio nodlpt mfvi t)a2tmu ono0olt mo3iad s2el(mo ()texnxr3oo1faD  n o;( t2urxm oo4om nlnvta()sDum(  ;t1aex mf3tasfa rm(ms;t0tlenmfctadla  aiei;s  2xm(m iu4ap elfctltf Dra(mpoo4tltnioctyslmDeanmp ()tlerxrctotfp eli i s) 2uo(opoy4lm   ict () Dumxmono4ape iociytfaDrluvonu0 lerifcoadoat luvs;s teum(o ny4lmtn nesat aDra(m ;u0opxn ieils s uan on() eermr3iotfmteanvsls texm(opio4ome lfes tfa2rm(m ou0tlx  i3iyt mDumnmont4altrir tydfptr n slt)sexoxrpiy4amenlfes s s2um(rpnu0altn i3iyslsDran p;(0trtrmf ia1oaD ln i (  etmiopno1oltn ivsls s2tmx  ;t0altnmi3tatfm rmump;t)aexoif3iatomDrai s (  eumimpou4al  mncilt  2umu p;u1aexn ictyd aDrl(vpnu)altrif tadfate neo;()sexmxmpoo1oltn fcilt srraumonu1ale  iciltls rlnmsn(4tlenmo3tydlm   nei;s  eto(opiy1amte fetatfsrumx  ;u0aeeoiictys m2rlu ont)arenxociatopDrau i;s)trum(r oydap elieilsf rtmx  ;t4teenii3tysfs2el( o t0trxnmf3iydom  lueo s0 rxm(m oodlpte fvsasfaDuax oou1apen o3iltfa2uanvsnt)tleomfciydomteln slt) eto(o ny4lme miesat)srrm(mo;t4olt ifeiydlm2rlumo;u4trxnir3totoptrlneo;s)srtmio nu4lm elnvt s)a2tmumo;u1tpe moeiyslm eln snu4aeenmf3iydfat ln o;s0tetoio nodolee fetl()a2rmxmpno4alt mfciasfa2uanms u0 eerxf io1faDe n sls0srxrim ou1op  mnvsat)s2umx  ;t0apx iiciytlsDemnmon()altnxo oy1oatraies;t)setrxo iudomtnmivi t  2umu  no1tetomoeiltla2em(vs;u0 rxomocoatlpt auesl()seumxo iudlm n nctlt) 2raxmoot1tpxnioetadfmDum(mpnu4aexoio3oydfa ran s;t  2trim3ny4amen ivi ()s2rrxmont4tlxomictytlm2ran o (0trenmo todlp e uei;s srtm(o ny1op  livta( srrmuro;o0aet mf3tadla2uluvpnt)tlxrxr3io1la   ivs t t2uoim oy1op  mivil(fartmu ooo1apt  oeild sDea(mp (0tltoir totlmDr ueo;s0 rurimpnudomt lnvtat aDtr(moot1opx if3iadla2emuvpnu0trtrmf iadomt anvi;t0t2trxrpnodam   fcsasf 2uau ont0tetomf3iadlaDumuvo t4aeerxf3ia1omDeaieilt  rxr(rpiu4llenmietas a2tmxmp;t0optoiociytlm2ea(ms (4areoxocoy1faDr ivi;t)srtmim3iy4am nlnet s) Dtmxrpot1olxnmietyd s raumo u0 etnxoctadomD  i o s0t2ur(opoy1ll eliesltfartr( ooo0aptoifciysla rl(vs;(0tlxoxfctodoaD  uvi s)s2xrio3oydopenlfcil(  Dtaumo;o1tpt mi3ilslmDuanms;()tetrxo iy1oatrln o t0 ruoir3oydamt lfci sf 2tmumonu0alt iictys m ulu s u0trtnioctotoa e ieo ( s2umxrpiu4amt mnvil(faDuau o;u1tet if3ildfmDranmp t0texoxo3tadfaD  nesls)teuoimpno4ap emfvta() Dtaxroot0altoio3tyt a eluvo t) eerxr3tydlmDrauei t trxmirpny4lmtnlfcias sDrm(mpot4tet  i3tasls emu p;t4 ltrmr3oo1la   u sl(0seurir3oydlpee fct t aDumx  ;u1opxnioeiysfs2uluvont4 rtoxf3iatopt lu ol(0 eurxmpiu4op n nvt sfs2taxrpnu1aleoifetydfm2rl(msnu4teenmfcoodfpDr ieo (0s2toxm iu4omt  icslsf 2uau pot1aexoii3tyd m2uanvp t4alxoiocoydlpDr u o t  2ur(r3oydllee fviatfsrtr(rpno0tlxo o3ildfaDrlu pnu4artoxf oy1lm ranvs;( setoxmpoudaptemnvt s)srtrur ;t1apx  fciytlsDel(mo;()tltoxr3iy1omDranvsls0trxoxopoy1ape mieil() rrr( ont0tex mfciat a2rlumo (0tetnxf3tadfmDeaivslt srtmim ny1om  lfvslt)aDuaxronu0tlxoiociyslm2emuvo;()arxnir oo1fmte nei;(  rumxr nodam  mfviasfartrurooo4oetnioeiytla uanmp ()treoxocoatfpD luei ( t2uo(rpoydop e ncta(  2ta( p;u1altoif3tytfa2ulnms t)tetrxfciodlpDr ivil( s2tm(rpno4apenmicias)s2ra(m no1tex mo3iyslm emn onu0tltrxf oydom eaueo;t trurxrpoudoptemfct t  rua(mp;o1tetnmfciasfmDul( p u)arxrmrcootfa rlivi (  eumxmpno4llt mfvs tfaDuaur ou0aleo fetysla rln p;u)teeoio tytfm eluvols)s2xoxm no1op emiesa(fsrum( o;u1aeenmieiydlsDeauvo;() lxnxo iydfmt  i o (0t2tmir iudll   iet s)sDrm(m oo0ole ifeiytla2um(vo;u0 lxnmociytoaD  nvolt trxo(opiy4op  mfetl(faDtm( pno0aexoiietlt m rln pn()alxrxf iatlatrlu s;(0srxm(o nydlm nmnct s)arrrxmoou1tptn ietydfm ranmo (0tlxoif oydlmDelnvi s  2tmio3oo1opte fesas aDtr(r no0aeeo i3iydlm rau p;u0 rxrxrcoydomt  ivilt srxo(o3no4ll  lfctat s2ta(mp;o1aeeo iciltfaDemu snt0 ltrxrcoy1omDeaies;(0t2trim iu4apee iei s  Dumurooo4opto iciytfa ean o u)teenmo oy1omt lnvs;( texo(rpoy4aleelies t)sruauro;o4aet mociydfsDelu p u0 rxomf ootfa   uesls)t2tmxm3oydapenlietas s2uaxro;t0olto f3ilsla2ul( sn(4trtrxrctytlaDe i s;t0 rxoir3ou4omtnmieil(f Drru o;t1tle mociltlm2rmuvsnt)alenir oatoaDe neo;(0trxoxmpno1lp emivi t) rtm(  ot4alenmo3iysls2eluvo;(4tetrifciotop  lu s;t) 2uoxo3ou1amenlfesa(f rrm(m ou4aeeo oeiasls2eanmo u) lenmr tytlaDeaivo;()trxmio io1lm elfciat) 2rau pou0aetomi3iad mDemums (4arxrmfcto1omt  n o s0setrim3ou1lmt livil(  Drr( oou0opxo ociat m2ua( p t0texnif oatoaD  ivs t0 eurio io1ap nmnvil( aDra(rpnt4tlenmf3iatfsDul(mon(0arxrxfcoo1fp rluei t0srur(m ny4am elfeslt)a2ur(rpot0aexn fctldfs el( snu0 lerio tatfate uvo;s)teurxopiy1lmt  ivslsf Dtm(mpnu4tpxn oeiatls ulnvont)texnxr tytom  livolt0seto(rpoydol nlict t sDrrxrpoo4olxo icild m el(vsnt0arxoir3iytoa rlivi (  2xmxo ny4altemics t)srumxrp;o0tpxo ieiytfa elnmsnt4teenxr oodfm e ueo () 2xm(rpoo1lpen ncil(f Drmxr ;u4alen oeilsfs2umnvsnt)tlerxr3todfp rau s (0srxrio3iydllenmnvtl()aDrru pnu1tleoiieiadlm2rau p;t0aexrxrciadlp   i il(0t2trxr3oy4lmtn ictls a2rmu pot1optoiiciyt a2rmump;(0alxrmrctydlp  au ols tetmxmpoodlme  nesas)aDua(  no1oet ifeiytlsDeluvo (0 rxrmf3io1opD ai ilt)sruoxr oo4lm n ivsatfs2rrump;u1olt  fetadfmDean o () eermo iatlmD  neo t  rum(mpoo4lpeelivta( arurumpot0oetniieiyt mDem(mo;u0artoifcia1fa  ln ol(0s2tmxm3iu4lpen netat  rrmx  ;o1ale  o3tlsfaDem(mpnu)alxnxrcoodfate nvi s srxo(m3ou4omee fctas)s2rr(r no1ope ioetad s ul( o;t)tetomo totlaDean ol( trtm(rpiudamte iet tfaDtmxm ou1aee ifetydfsDrmn s;u)arenxf3totop rauei t) 2xr(o3iu4ap nmnci t)sDuaumoot1aetn f3tyslaDua(vo;(4 eenif tadomDeai o s  2xmxo3oy1llen ivi t srua( pnt0oet  feilt mDeln p;u4 reoio3iy1fmtraneo s0 exmio3oo4altnmicslsfa2ta(r ;t4oetnioctat a umumo u) leniocoy1oate nei;s0t2xmxo3nydole liciatfaDtm(mono4aleomf3tadlsDulumonu4trtomf ia1lpDeanvsl(0teto(r3oodamenlfvtls)s2tm( poo1apenmieiadfs2umn o u4aleomr ia1fatrlnesls0 rumiopoy1lp nlict tf 2taumont1oet  ieiat m eanmpnt0 rtomo3oatfmt  nvi s  exm(rpiu1ol  miet sf rta(root0tptnmfetltfaDrauvs;(4alxoxr iy1fpt an olt)trxr(rpoo4aptn nvtlt)s2raumoou4olen oetyt m el(vo u)teenxf3oo1fpt auvs (  2um(o nudll   nvsatfa2raurp;o1open icildfs2rm(vsnu) ltoioctodfmte nvslt)teumxo ou4lme mivi sfa2rr( p;t4aee ifciasfm2uanvsnt)teenxocia1fa rau i () 2xm(o3oodlp   iei s)artr(r ot0tee moeiysfsDrm(vpnt)aexniociadom   iesls0texrxopoodol  mict s a2trumoot0aex  oetadfa2rlnvs t)trxnmf3oydla   ivo;(  rxoxo3io4om  mfviltfs2tau  ;o0texn fctldls ul(mpn()tetnircoy1optr u s;(0teumxo no1alen neia(fsrum(ront1opeoii3iytla2el(monu4 eeoio3totoa eaiei;t0t2tmimpiy4am emicils) Dum(  ot4oet  iciytls ul(mo ()tlxrmrcta1fmtr ivs s) eurim3iu1lpenmivt sf Dtaxm oo4olx iicildlsDemnmp u0altoxo oodlm eaneil(0trumxm nydllt liei t) 2um(mono0tpt  fetytls um( p;t0 ltrir3iy1lmt  u ilt0t2um(m no1lptnlfcia() Duaurooo1tpto f3iadfsDeanvs;()areoif3ootlmt au ilt)trtmiopiydlm  lieiatf Dua(mpno0teeomieiatfa eau p u0aeeriociodom raieils  rxrxm3no1am  mnciat) Drrurpnt0tltnmieild s uanmsnu) exnxr3oo1oaD ai o t)s2ur(r3io1olee nvi tfa2taurpou4aexniocilsfs2ulu on() rxnir io1fpDe ivi t0 2tmio3oo1ll  mnetl( srra(r nu1aexo o3iasfs2emu s ()altoxr tydfmteln s;s)setr(r3io4lmtn neslt s2rr( pot1aex  i3ils mDrm(vs;t)teeoxf3tadfa r nvo;t trxoxo3iy4ll n fcilt a2tr(m ou0altn o3iadfm2rl(vpn()arermf3oytoa r i s ( s2xoimpiudap elfcsls)a2tmxmpoo0opxomoetlslsDranms;t) rtnmf3oo1oa e u ils0tetm(m iydameelfcta( s2raxmo;t0aet if3taslaDeauvonu4aexoxrcty1fp rauvs t0trxmxm ny4ol   nci sfartaump;o1apt iiciytfaDrm(mp;(0tetnmr oatlpteaneo s) rtm(o iydlmt mncsls) 2rmumoou4ole miciat m2eauvo u)aexrmrctadlm  liesls) eumxm3nudlpte ivia(  Durxr no4olx  i3iltfmDrlnvpn()arxoif iotlateaivi s trto(o nu1lmt  ivtl(  Drm(m ;t1aeenmieild mDuaums (0 ltoxfcoa1faDelieols)setr(r3ou4om   ncia(  rtax ont4tex if3tltla2eau o ()tlxomr tatop eaueo (0 rto(r ny4lpe  feilt) Dua(r ou0apxoiietldfm2ulnms;()texnir tydomtrau i;t)t2uoirpnudomen nct (  Dtrumoot4texn o3ild a rl(msn(4 exnmo3oy1omD  n ol()s2xo(r3io1apen net sfarta(root1aeeo oetytfm2rlu p;u)texrmr oy1oatelueo;s  rtmio ny4ale lnvs (fs2umurpnu0teeomictasfa ranvp;u) ltnif oydlmt au s t0 exrxr3nydol nmnvi s  2uru p;u4ape ifeiytla ul(vp (4alxnirctatom r ivs (0trurim nu1am emieil()srrr( pno1aexn fciysfs2em(vo;u4aetoif iotopt  nes;s trxrxrpoudlmte nei (  rrruro;u1apxoii3iatfs2rlnvo (4texoir ia1omDran olt)seuoxm3io4ll nlicilsfsrtr(rpoo1alxnmo3ilsfs2eauvo;() eeomr oatlm   n slt0 exo(r3ny4olee nct t) Drrxr ;u0alxomieilt s2rau s;(0aeerxfcio1fa ranes s0seuo(mpoy1lp  mncta( arrrurpoo1tpeoiictytlsDuln s u0aetrxfciydfm rlnvil(  2umirpoodomeelnesl() 2rmxr no1aetnmf3ilsfm2em(ms t4 etomo oy1omtrln i;s)sexmirpny4ole  feilt sruaum ot4alt moeildfaDelu p;t4 etrxr oodla eaivs s)sexoxr ny4ope lnvta() rrrxr ou4tptn o3tld m2rmuvsnt0 lxnmrcto1fatelu ilt0setoxm3no4llenmfcs t)arur(ront4ole  ocils s2ulnvp;(4 etnircoatlm e uvil(  rxoxrpiy4lmtemnesls)aDtrumonu4oltn iciyslsDul(vo (0aexrmocoy1fptrlueo t sexo(r io4apenmnei t  2ururono0aptnmieiysls2ulu p (4tlxoxo3ia1fp  auvslt)s2tm(m3oodllte fcta( s2rm( o;o0aptoif3iysfs rmn pnu4 rxnxr iodlmDeaivs;s  euo(r iy1lltemieilsfa2rr(mono1oexomoctlt mDeln s ()aexnif3oatlm   ues (0setmxo3no1aptnmfcilt)a2tm(m ou0oltomi3tldls ranvo u0aeeomfctydfa rau s;t)t2to(rpou4alen netat  rrm( pnu4oetnifctltlaDran p ()aexnio oo1fpteanvils0trxm(m nu1am elivtl()aDumxrpou4aetnioetys s2um( p;t)aetrxf ia1lat aieolt0setmxopoudll n fvsls s2ra(ro;o4openif3iyt a2rmumo;t0trtnmr oytoat li o (0srxo(r oydopeemnetlt a2rax pnu0tetniociytla2emn s;u) rtoirctotlm  li slt) euoxrpoy1omt mnct (  ruau  ot4openmi3tad a2rmnmonu0treoif3ta1lpt lneolt t2tmim iu1ape  ivt (faDtax  ;u1optn i3iadlm2ea( s (0tetnxo iatfatelivi s) 2xrxr no1ap  licsatf Dum(mpno0aet mo3ilsla um( pnu)trtoxr3oy1oa eln olt  eumimpoy1oleemietl(  2tr(mpot1tpxoiicilt s ra(ms ()aetrifcootopt  ivol(0trumxrpno4lp   fvs s)aDra(mo;o0olt  o3iytlaDrln on() rtrxrcta1opDr n o s0s2xmim3iudlmtn nctlt) 2urum ou4tpt  ictydfm rlu s;(4arxoxrcty1lateaivsls srxrir io1lmtelnvtls  Drmxr ;o1aeto ieiydlaDulumsn() leoxo tadop elu s s  rxr(m oydopenlncsl()sDuaur no0oex moetltfmDrm(ms () lxomfciodlaD luvo (  2tmxrpoy4lpe lnet s a2umxr ;o1olt if3tat s2ea(vo;u) rtomf iytopteluvsls srxm(opnu1apt livs s srtrur ot4aptn i3tltfm2umump;u0alxoxr io1fm  aues;t)trxr(rpoo1optelietatfs2taxronu0oexomocilt m2ul( p;(4 etriocio1omtr i o s0s2xo(opiy1omte fei t)arum(m no0apxn f3ild sDra(mp;t4 renxo oatfm  aivol(0seumxopny4am  mfciat srtaumpot1olxn f3iadlm ranmpn() eenxf iotlp  lnvilt srxmxm nodlme  ivs t)srur(  no1optoiicildfm2rmuvonu0arenmr3oa1omDraivs;s0 2xr(rpou1aptemivt sf 2umx pnt0opeoio3iatfm uanvsnu) rxnmf tatoaD luvi;s0t2umir3iy1oltn icsl()aruax pou0tlxn icilt a rmnvo (4 etoif todfmteauvi;t)tetr(r io4ol elfesl(f Dtrump;u4alxoifetadfa umumo t)arxrxr oytlpDr neols s2xrxmpoudale mncil(f 2tmur ot1oet ifciadla rluvsnu0aeeoxoctotfa  anvo (0texm(m nodolt  ictls  rur(rooo4open ietasfaDemnmo (4tlerxfctytomDrluvs;(0 rtm(mpoy4lm emieslt a2rmxmpno0oexnmoeiatlm rmumo;u)trxnmo3iydoaDeau i t t2umio3iudalt mictl()a2tax  ot0opxomietlsfa eln o;u) rtrxrcia1opDrauvs;s  eto(o iy1llte nesa(f Dtaumpnt0aeto o3iys aDumumpnt)trenif3tytfmDe nes t)setrim nu4apenmncsa(  2rmxrpnt0open oeiyt aDrlums u)teerir iy1omDeaivo ( trum(opoy4ome mfvta()srur(  nu1ope  fcildlm2rmnvp;t4 rerxrcta1la r neslt)teuoxrpoo4om   fetatfs2ta(rpot4texn f3iatlmDrlu p;t4altnxfcoadop rau o;t  eur(r iu4ome  ncsatfs2tax p;o0tpxnmoctlsfa2uanvs;(4aleoirctadlmtraies s t2xmio iu4llt  ics (farrrurooo0oeen i3tltlm2uanvp (0 rxomf ootlpD  nvi;()s2xoxmpoodomte ietl( s2rm( oot0tpenif3iatfm2uau o;(4arenxr tatoatr iesl()teurio io1oltnlnvia(fa2rr(  ot0olenmfctysla rlu onu4arxomociotlpDeaiei t0texmxrpoo4apte feiat  rtmurpoo0apeoioetadfaDeanms (0tltnmfcoatlaDeau sls0 exrim3oo1llt mfcta(faDrmu ooo0ale ifeilsfm2rmnvs u4trxnmo3oodfaDrlneslt  rtmirpio1apt lfcils)aDuauroou1oex mfcild aDeauvo;(4 exrir todla  an o () eto(r3oo1ll emnvs s) Drm(  ot0tleo feilsfsDulu on()tetrif io1lpD lnvs;s)tetm(m ny1lme lfvs t)aDtm(mp;u1oetnmfeildlsDelnvp;u4aleoifciotlpD  u i ( sexrxr3nu4optnlictat) Dum(mpnt4oetoio3iydlaDrm(monu4 rxnmrctodopte neslt)sexmxopiudolee ncslsf rrrumo;o1altoiicild sDumnmo;t) ltrircty1oa  lu o (0 eum(r iu1ol e fvsas arumxr nu4oetn o3tldfa em( p;() eenxf oytfpDranvo ( srxmir iy1ameelneias arrau ooo0opeomietlt s2ua(vsn(0arxrxo io1lpD aivs ( t2xoxr3iu1apenmnctl( arrm(m nt0olxnmociatfsDumums;t) lxrxrciy1om e neil(0setr(m3iy4lpeelncil( aDtrxr nt0tptomi3iyt s ua(msn() exoxf oatomDrlneo;t) eur(rpiodap elivils  Dtaumpot0tee  o3iyt mDelnmpnu0arxomocootoaDraivol()trum(o3no4apte nct () Drrur ou0alt  ieiat m2ra(vo (0 exnif3oytopDeau s;t0setrio oudlp n fvsa(fsrrax p;t1teenifctysfs2uan p (4 lenxf3ty1fatelieo;( trumimpio4apt  fci t)artaxront1open feiadlaDumnvp;t4 eenxf totlptran s s0trxrxr no1lptemics sf 2rr( oou0aee  o3iadls rmnvsnt4 rtnmo ty1omD aivs;s srurim nu4oleelfetatfs2ua(  ;t1olxnmociydlm2eanmpnt)trtnmr3iotla r uvs s0t2umxrpiu4opee fei tfs2rrxront0apxniieild m2umn s u) lxrxo iodla rluvs;t trtrxrpno1llte fvtltfa2urur oo1aeeomoctyd m ra( on(4 etrxo3tatoatr n i;(0t2urxr3oy4lpee nci t)s2umxmpoo4tltn fctltlm eaump;()alxrio3tytop  anei;t0srumxm3nodal   nvsl() Dtmu pno4opeoiietatfa eaump (4texrxo oa1lptrlnes ()seuo(r3ny1omeelfvi s)aDraum nt1apx ii3tys a elnmo t) exoxfcta1op rai i s srtmir iydolte neiat  rraxm ;u1tleomf3iys mDul(mo t0altrifciadfateluei t)s2um(r3iy1aptn nei s srtauront0opeo ietyt a elumsnu)trermo3iadopDeauvolt0 2xmxo no4ape mies tf 2uru o;u0teeo f3ild s rauvon() rxomr3tydoate nei t0s2uo(r3ny4lpt mnctas s2ta( ooo4ole iietlt mDem( snt4alerxfctydoatrln s;s srumxm no1olen fctl() Duax pot4olto ictyslmDeauvs;u4alerxrcoa1lpD  u s (0srumxrpio1ll  lfvs s sDraumont1altoifciltla em(mp t0 rxnxr3oadop  au i t sexrir3iu4lptnmiet sf rua(rp;u4aexomi3tadfm2ulums;u)teerir to1opD lueo t  2xr(m3nu4ape lfeiasfsrtmxr ;o4alt moetyt a2eln o;(4aeeoir oo1oaDe u olt) euoio3no1lptnlicia() Drrx  ;t1alx mfciad m2ulu p;(0aetrmo ty1fa  lneol(0setm(o3iu4ole  fvias) 2trurp;t4oee  fetadfa2rm(ms t)aexomr3iotomteli i;t0t2tr(o3nu4lpt licsl(fa2rmxr no4tetnif3iad m umnvs;t4 eeoxo iy1opt lueo t s2xm(r oodalt lies ()artmxr nu4alxoio3iltla umnmo u0tetniocoatoaDr iei;s0trtmxr no4llen fetls)a2uaumono4teeo ieiat sDulump u4tltoio3totfmt lnvs;t trumxr iy4olt mnvslt) 2rrx pnu0ope iocildfm2ua( o t4tltrif tatfp rlnvil()t2tmxr3iy1apt mfctat sDrau pno1ale  iciltfaDuauvsn(4aetnir3totfpDe neilt) eur(o nu4ll   ictat  Drm(mono1tet if3iltls rmn s ()teerxociydlaDr ueils trto(m3no1lme lietls)srrmx pou4tpx mi3tytfa2ulnvs t) rxnxfcoo1opDeli il( seurir3ny1optn fvtls)a2trxmpou0tpeomo3iatfm2rl(vo;u)aexrif iytlpDrai o (0 2um(r3iu4lmtn ivil(faDuaxm ;t1aexn feils s2rlnmsnu)aetoxrciy1lpDr uvils0 euoiopno4lme  nvt t)sDrmurp;t1tpeo feildlsDrm(vo t0 rxrxf ta1fmt luesl(0t2trir nodomen nvtltfa2um( p;t0tpt iiciyt a2elu p;(4alxrircia1oat  n ols0teuo(m3nodalt lnet ( s2rrxmo;o4tlt  ieild m2ra(vs t)arxnioctotfptrlueo s) rxrxm3nu4lleemfviatfsrrax  ;o0opxomocias aDulnmonu0aetnmrctodfaDr nei ()truo(o3iy4op emicta() 2ta(  ot0aet ifeiasfsDra( ont4 rtnio3oytlmDrau i;s) rxrxopno1lpt mivs s s2tmu p;o1oeenio3ildlsDem(vsnt0alxomfctatlate nvi (0 rxo(m3oudlltemiet sfartm(mp;o0texniiciyd mDrl(vpn(4 reoxf3io1lmD au i t seumxo iodap n fcias artrumono1aptomfeiys sDran o (0 etnif3iotlm  auesl()sexm(o oy4lmeelnvt tfsDrm( p;o4tleo icilt s uanvsnt0alenxo3tadfp rau i;( s2trxo3oo4lpte ietls srrmx  no0oexoiieiadfsDemuvo;u4altnir3totlaDr ivol()t2xrio3no4lpe mivia(f 2taur ;o4oet miciyt m emnvo u)arxoxrcoa1fpDelieols)s2xm(m iudop n ietls a2trump;o0opto ieiasfa2el(vpnt4aexnir iadoa eanei;t trtmim nydap  lict () rrm( o;o0tlxniiciydlsDuau snu0aetnxf3todoaD lu s t0 eur(opoy1llee fetat  rra(r nt1tlt mi3iltfsDumn s;u)aleoioctydlm r n ilt) exmxm nu1al n fctatfaDrrx ont0aet  ietytfa2rm( snt4tlenmr ta1lat anes (0srur(o nydomtnlncil(  Drmurono4aleo ociytla ran p t4aleoiocoytlmteluvo (0 2to(o3oy4lme lfcslsfs2raxr ;t0tpe iieiydfaDrln ont0texrxr oatfm e ieo (0sruo(m oy4ol elnvsasfaDumurpot0aptomf3iys a2el(vs;u0artrmrciotlp  livs;t)seuo(m3no4llenlfes tfsDrax pot1aeenio3tlsfaDrm( onu)tltrmr oodlatraivs t trxm(m oy1lmtn nvil(fartmumont0aexo o3iytfmDra(mp u) exnio ty1oat lieilt  ruo(opoodlm  lneiltf 2tm( p;o0olx  o3iydls2umu p;u0 exomocio1fpteaivo;t sruo(rpno1ap  mfesas)artaxm nt0apenmictasfa elu p;(0arxnmr3oatfp  aies t0teur(opoodop e fvtl(fsrur(r nt1tpto oetatfs ua(vsnu4aetoio oydlptrau s;s trtm(opny1ape  icias)aDrmum nu1olxomfeiytls2uln p;t0teeomo3ootlpt aneo s)trxr(rpiu1ap nmfctl(fs2uax ono0aetoiieilslm um( p (4arenio oydoaD anes s)trtmim3ou4openlieia( sDur(m oo1teenio3ilt mDuln p;t4teeoxo3iydoaDr ivslt  2umir3nydamt lncilt a2ta(mo;t0olt iicias mDuluvs t4altnxo3tadlptelivs;s) etoxo iydoptnlfctl(fs2urx  oo1teeo ictld m2eln s u4 lenmoctatfm  livo s) 2xm(r iydome lfvslsf rtrx ont4tpt iicildfa2ulnms t)trtnxr todomtraieo;t setoimpio1amee fcs (  2ua(mpnu4aptnif3tys mDel(vpnt0tlxoio3oa1om eai i;t0 rumxo ny4lpee ieslt)aruaum ;t4aleo fcildfaDea(vs;(0alxnxrcoo1latr u o;t0trtrxopnudaleemfesatfarumum ou4aexomoeildfsDelnvs t0altrxr oa1faDelivi t)s2uo(mpoodlp nmnci t arraurpou1olxn oetysfsDeluvs (0arenio tydfa r ueo;t0 2xm(opiu1lltelnctlt) rtruroot4opxoifctys a ulu onu4aexrmrcoo1faD  nvs;(0teur(rpou4lpt lncslt  2rm( p;u4ale ioeiltfm2ul( p;()artoirciydoaDr nvo t0seumio oy1lmt  ietls) 2rmur ot1tpeomietydla2um(vo t0areoir3iadfmDrau i;s  exmxr3nu4apeelnvi s  rtmum nu0apxo f3iadlsDel(mo;u4 eenxo3oa1omteaueolt texoxo3nudlltelnvtl() 2rrxm oo4oexn iciytfmDua(vs u4arermrciytfpD auvslt  rxmim3ou1am elncil(  2tm(  ;t0olxnmociytfm emnvs;()aexomo ta1fp eluvi;s teumim3oy1ll nlfetasfsDuau pou0tptnmfetytfs2ran pnu) lxrmf3tadop  lues s)trtm(opoodalte fcs sfs2rau  ot4tlxnioetldls2um(mp;t4texnxf3oatlm  ai i t0srur(o3oo1am nlncsls)srtm(ront1ole mociltlaDul(ms t4aetnxr io1lmDe neo;(0setmimpiodalee ncs (f rumx pnu0olxo o3ilsls el(mo;t)trenxo oy1faDr ivs t0tetr(m3iy4lpte fctlt)arra( ono0olt  f3iltfa umuvont) ltrir iydoa  lu o () eum(r3nydamen icsa(fsDtm(m no1opto oeias sDrauvsnt) rxrxfciytfm r ivil(  2uoiopoy1omeemfesat aDra( ooo1tpeoio3ildlaDulnmo;(4artnxo3io1fat luvsl( s2xmxo no1aptemnvt tf Drr(r nt0opx  i3taslm um( sn(4 exnxf tydfatrlnvils  2xoim3ou1oltnmnvtltf Dururpoo1olxn fciltls emuvpnu0 rtoio3oatlpDelivo;s  etrio3no1oleemnet (f Dumu pou1tpe iicils s rl(vsnt)trerxfcta1lmD luei;t0s2tmxr3oydlle  ncil() 2raxm oo1aet mf3iatfs2eanvont4arenmr tadoatraues s seumir nodop nmfvi t arur(ro;u4aeeo icilt mDrmnvsnu0trxoirciotoa eau ol() 2uo(o iy4oleemicils sDrmumoou1optomi3tltfm um(vo t0tlenio3tydomDran i;s)setrxm3oy4al elfvslt) rtr(r ou1alto o3iydlm el(mont)trtomr3oo1lmte ueol(0srumxr iodapt lncta()s2tm(rpot4tpto oeiysfs2rauvsnu)tleoxf3iatop e ivs;s0 rxoxmpoo4lm   ivtlsfs2tmumpnu0oeeniictas m rlnmp;u4trxnxr3io1om   ivi;t0 rto(o3io4lptemivs t  Dtrxm nu4aetnioctldfa2umuvsn()arerxrctodomt  nes t) euoxm3ny4olt lfvs () rrrxm ;t1tetoiietaslsDem(vs;(4tlxrifciadfmt an i;s) 2xoxm no1apee fctls)aDra(ro;o4aexnioeiys mDrmnmpnu4artnxr3totoptr ivs;() eumxm3iudap emfcs (  Dumxmpnu0tpen fciltla2emn pn(0artrxfcoa1opte nvsls trtr(r3oo1lptemicilt aDrauro;u4optnmf3tldls2ul( o (4aetnmociytfa  livo;(0trxrxm iydlleemncsa()sDumur oo0apx ioeiys mDum(ms t4trtrxf3oo1lmD  nei () euoiopoy4ap e fcilsf rua(r oo0open fetat a2umumo;(4treoxo3iotfmD lnvs;s teuoir iu1llte ivslsf rtrxr ;u1tpt mo3iytfs2umnvo u0altrir3ootlm rau slt  2xrimpno1lle  iei t)a2urx  oo1opto f3tys a2rluvon(4aeeoif iotop  an ils)sexoxm3oudameelfes (fsrtmumpnu0olx iictldfs2rmuvonu0aexnxr3todfm r nvi;s seumim io1lltemietat)a2tr(mpnt0alen iciydfm umuvs u4texoxr tytfaDelu s s trtm(o3io4ole  nvta(f rrm( o;u1tpt iiciltlmDul( snu) exnir3oo1lm elnei;t0setoim3nodll  mnciatfsrum(m oo1oetnmfcias a2rlnvonu0trtnxfcoadfat  nvo s)seur(o3io4ame  icilt  Dtmx o;o0aptnio3iat a uauvs;u4 lxrif3todom eau sl()tetr(o nodol n fcslsf 2rmxmont0opt iociaslaDuanvs;() eeoxo oadlmDeanei;( texoxm3iodomtelivt ()arrmumpno1tle mf3iat s2emuvp;t)teerir iydfateanesls0 eum(r3iudal emncsas arurx  no1tpen fciytlsDelumsnt0alxnxrcty1fm  anvo t) rumxm3oo4opt lnvtlt  Durxroou0oeeoiociaslaDrl(vsnu0 lxniocia1latrlivi;t0 etr(rpnu4ope  net ()a2rr(r no0oleomi3iad aDrm(ms (4tlenir iadfpt au i t)trtrim3oy4am  lict (faDra( poo4apeo i3ilsla umnvo t4 rxomrcoy1omD lies;s seuoxopou1am nlnesas a2rrxrooo0tlt mi3iyslm2ranms;t4 rxoxf3io1omDelneo;s0seur(m nodlmtelnes (fa2umur ou4aetomoctas sDel( pnt0aetrxo iodom   nes t)truo(m ny1lpen feta( a2tmumpnu4aptnmf3tlsfaDum(ms;()trtrxo tadfmDe nvo;(0srto(o nudamte nvslt)aDrr(rp;o4opx ifcild s uaumpnt) etrmo iodlptrlnvo t) rxrxrpiydoptnmnei t arrr( o;o4oex if3tltla rmu s;t0arxnio3oo1latelneilt t2ur(mpny4altnmfciltfsrumu oot1oexoifetls s rauvonu4tleoxrcoydlp   uei s t2urir oudomtelfesasfaDur(rpnu4tle  oetytls um(msn(4altnxo oadoaDrlneilt)t2tr(m3iodap  mnet t a2rr(ront4tpeo ieiatfa2em(msn()areoircoy1fmtrau olt0t2toxo iy4ape micsat  rtaxm ;u1optnmfciysfmDelnvonu4altoir3iydfp r uvols t2um(m ou1om n fvtlsf rumxmo;u1optnmf3iytfmDra( snu4trtoifcoo1fm r nvs ()t2tmim ny4llt lieiltf rtruront4apeomoctydfs elu o u0aeenmr iytfatraneo;t0trtrxr ou1lpe  ieiatfsrtaum ot0tlxoifeiadla ua( pnt4artomo iotoa e n s (0 2xoxr no4lleelfvtl( s2rrum nt0aet  o3tys a2ra(mpn()alxrxr oytomt  i i s)s2umir ny1ol nlivsltfsrraxmo;u0opeo oeildls rmuvs (4trtrxrciotfptelu i t) 2urxrpoudol n fvi s)aDua(mpot4tptoii3iltfmDrln s;t0aeenxf3iy1laDelu o s0teurxo ou4olt mneiatf rrmumooo0apt if3tyd a2uanvo;t0 leoif3iydfptr u i ()tetr(mpiodoptnmfetltf ruax o;u1apxn fetld a2emnmo;t4aeeomf oa1fp   n ils0 rtr(opiy1llen fei s)s2rrump;t4aex  fctlsls2ra(mpn(0tetnxfcoo1lpDr u olt0 2uo(r no4ol n nvil() Drr(  oo0tpt ii3ilt m umn s;u4 exrxrciytfm   n olt)srxoiopoydamtelivia( sDua( o;t1aleoiiciatla2em(vo;(4texrir oo1fmDe uvi;s)srumxrpio4al e fctlt sDtau  no1oexnmieiasla umu s;(4 rxnio oodfm e nvsls) exmxopny4om  mncsat)s2urumooo4aexnmociys s2ulnmp ()texoifcoa1om rlies t t2uoiopou4al  livilt sDta(m ;u1oleomf3ildlsDuanmp;t4aetrxf3tadom r nvilt texo(m3iy1al emfetlt) 2rrxr ;t0tpt  oeiatlmDua(monu0 renxfctydfmD auvs;t)seto(mpiu4lpt lncilt)srtaumoou1openiietldla umnvo;u4aetrxrcty1oatr n i;t  ruoirpiudameemietlt) rrrur nu0alx mf3ildfsDuanvo;t4texrifcoatoate nes;t)teumxm3nodapen iet sfaDta( p;u1aetnmo3tadfm umums ()areniociytfmtrau ils0texmim3ny4omte nesls)srtrxrooo4tpe  i3tasls ranvpnt)tlxrxo ty1fmt liei;s) ruriopiydap  mfcsls  2tmx ono4optomietatlm rm(monu4texnifcoy1la e iei t0setoxmpnudol nlici tfaDurxr nt4alenifeiyd aDulums t0aexnio3to1optranvsls0texmio3ny1am n ict (  Dtru o;u0tptn o3iys mDeln o t4 rxrxf3oy1oateaueols)t2xo(o3io4al n fci sfaruru pou0tlxn ieiadfaDum(mp;(4tlerxociotop eau i;s  rxoio3nodoltn ieil(fsrtrxmpoo1tle  feias m elu o;() rtrxr3tatop rauvo;( srtoxo io1om elfvsa()a2uaxrp;o1apt  fciytla rl( s;t0 etnxfciydomteai sl( t2uoxm nodapee ici s) rurumono4alxomfeiltfa2elnmp t0tetnxociadfpD aivols srxrxo3oo4ole mict () rtau o;u0optnmfetasfsDem(mp u4tlxnmr tadomD auvol(0s2uriopnu4omtnmfcs (fa2urxmono1tlx mi3ildlaDrlnvp;t0aexnmf3to1lmtraieo;s teurxopiy4llt mnvsltfsrtru  ;t1oet  fctlt s2ea(vo;u0aeeomo oa1fpDr n i t) euriopny4lme lnct ( srrm(rpoo4olxnmo3tytfs2rmu pnt0tltoxfcto1fpt livsls0 2xo(rpio1ap nmfvi sfaDumurp;u0tex iietad sDuanmo;t0 lerxr3io1laDrlnvol(0s2um(mpiy1openlnei ( srtr( pno4altomi3iys aDrlnmsnt0trtrmf3todlm   neo t0tetoxopnydalenmneia() 2tr(rpnu1tpenmfciat s umnmp t4 etomfcoytfmDrauvo () 2toiopiy4opee iviat)a2ua( p;t0altnioctys a rluvpnt4aetoxr3io1laDrai o;( texrxr3iy1lme lnetat) Dtrxr ;u1opxnmiciatlaDulnvs;u4 rermo oa1fmD  nvo t) rtoxmpnudlpen nvi (fsrtmuro;t4optnmfciydla ranmon(0trenifcoadlp e n s (0 2uoio3oodaltemncils s2raumono4olxoiictytlaDrau p;u)tltrxf3oodomDean slt) 2tm(r3no4opte icsltf Dtruronu1oleoiocils sDumumsnt0aexnxr oadlat  n i;(0srxmiopiy4alt  icias)s2raum ;u1aeeo ietas aDuauvo;u4 ltnmr tydfpt anvi s s2uoxo3nodlleelnesa(fartax ooo4tltoiieiyslm2eln s u) etrxr3tadfpt ai i s0 etmim3ou1lpt  ivsl() Dra(r no0oexoiociltfa2el(vonu)altrmr tadomD aues;s  2xo(r3nu4op emfvilsfaDurx oot0olenmieildls2rmnvpnu0tlerircia1faDelieo (0trumio3nydop elfcia( a2ururoou0tpxn ociatfs2rm( p ()aeeoircoytlp elu s;(0t2xriopoodoltnmfet (fsrur(mp;t0aet iociyt s2rluvpn(4 reoxo oy1om rlieslt0s2ur(mpio4olenlivsasfsrtau  no1aeen fctltlm2ul(vsnu0tltrio3iodfmteauvo;s0 2xr(r3ny4ap  micta()srtrurpot4oeeoio3iasla2ulumonu0treniocty1lmt  ieols seum(m nydlleelnesa(f Durxrp;u1aexnmfctydfs2rau o u)aexoxo to1fa elu i s0trxm(rpio1amt  fvias) 2ur( oot4tlto fcildla ulnvp (0altrio todfaDran il() eum(m3ou1aptnmfeslt arrax  oo0tlxoiieiytla2rmnmpn(4trenio iotfmDean i;s0tetrirpiy4oltn fvslt)aDumx  nt4optn fctydla2eau pnt0alerif3iydlaDe u ilt0 rumirpiudoptnmfeta()aDtm(mooo0tee ifctld a umnms (4tlxrmfcta1fa  livi;(0 2umxm3nu4lmenmfvt t  Dra(mp;u0oexoiocilt s2uaumo;u) etoxr totfm  aiei s) rumxr nudap n ivtas srtm(mono0texn ociysls2eln o;(0aeermoctytoaDe nvols  rxmir3ou1lmenlncta() Dta( poo1tpx mociytlsDelumo;u0artrir3iytoa r ueol(0s2urio3iudom e fvt tfa2taurpou1tltomocias s2uaums;u4tltrif iy1lmDeai s;s)s2urxopny4al  lncilt s2rmx  ot4oexn ieilt s ea(vs;t) lxnxociodlpteanei;(0trumxopiy4omt miet t arurx  ot4altnmo3tyt aDulumon(4 etnmo tatlm rliei;( s2xoio iy4al e ivslt)aDum( pno1tpe mfciysfs2ulu p;u)tlenxr3oa1op eanvi t0tetrxrpno1lltemfesa(  2rrxmp;o1tltoifctlslmDea(mp t)aleoif ta1fm e uei;()t2toim ou1om  lnvt (farrruro;t0tle  feiat s eaumo t4alxoxrcoo1omtelnvo (  rtmir iu1apenmietlt s2rrx o;u1teeomoctlsfs em(vp t0tetrio oodlmteaneo t s2toxrpoy4olt lnvtlt a2rru  ;u1tet  oetytls um( p t0 exoif3todlm rln i;t) rxmiopoo1amt  nctlt) Dtmxmpou4oltoifctasfaDemumo;u0aetrxr3oadlpte n o;s  rxmio iu1lm emfetat) Drr(m nu1tlx iiciadfs elu s;u4alenxfciytoat aivi;s)teuoio3nudalt  fciatfaDtmxmoou0olxoifciadfmDelnms (0teeomo3tadom ean s t0setoir3iy1ameemneilt)s2rrxro;t4oleoiieiadfs2ulumsnu0 lenxr iatfmt aneilt  rtoxr io1olen ivias) rtaxmpnu0opeoiieildfaDran s t0tlermf3iodoatraivils s2xoxr oodol nmnes s)srrmxm ;t4open fetld aDea(mp;()tlerifcoodomte i s ( trxm(mpiudop  mfeta(f 2trxm ;o0apen o3ils m rl(mont) eenxf3iotfmD li ol() ruoio3nodapteliciatfa2ua( pno1tpenmfeildlsDuau s u0aetnxo tydlat an i (0 2tmio3no4lmtemivi sf 2tr(r oo4tleo iciltlm2rau p (0 rxnir oytfmtrlu i ()teumxm3io1lpenlnciatf 2trxrpno4oltnif3iad sDul(vsnt) eerxr oydfa eaieo;t  euoio3io1amee ici t)s2uaxr ou1opt moeilsfa2eau snu4trtnir3iytlmDe uvsls0 exm(m ou1apenmfcs sfa2rrx poo4aeeoif3iat s elu pn()aexoxr3iytop rluvi;(0s2uri
\ No newline at end of file
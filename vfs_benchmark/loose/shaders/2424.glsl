@@ -0,0 +1 @@
+nvs;t texm(opou4ape mfvtls s2ururont0tle mfctytfa rlnmo;() etnmf3oadomDr ivi;t)trxoxm3oo4omtnmfviasfsrumxm ;o4tee ioeild aDumump;u4tetoifcoadopDelnvsls0srtr(rpoy1lpt mivsatfaDrrurpoo1aex if3tys s rlumsn() etrmf3to1oa raneo t)trum(mpnu1aptn feils)srum(m ou0olxo o3tatla2ran on(0trxrxfcoodomDrlu o;s)srtr(mpou4op  mfet t)sDraxrpnu4tetnioeias aDem(mpnu4tetnir tatopD ai o (0 2xr(r3nu4ape  ncs s) rtax poo1open fciasfm ranmo u0altrxr3tydfpDr n o s)teuoxrpnydlm nmfvslsfa2rrxmo;u4alt  fcilt s ulnvon(0tlxnmf3totopt  iei ()srxo(m3iodaptelfet () 2raumono0tle moeiyd a rmuvo (4tleoiociotfptelivs;s0trxoirpiy1op e feta(f Drmur ;o0oeeo fciytlaDum( snu4aexoxf3iydlpDe nes (0 rtmio oudopt liet tf rrr(r oo0tlt  fciydls2elnvp ()aexnxo oo1opte uei ( srtoimpoy1apee nvtlsf Dumxmoou1teen f3tadlaDea(msn()tlxnmf3iydlm rli s t0 exr(r3no1ol nmietat) 2uau o;u1olt moeiltfmDumnvsn()arxoxocoa1lmte nvs t0 etmxo ny1ll n fct ( s2trxmoou0opxn o3tadlm rmuvo t0 rtoxrciotlaDe uvil() rtmimpnydole  fei t)artmurono0opeo o3iaslsDumn o;(0 rxoxrcoodlm raueo;t  exmirpoudape lfvt t srrmxmp;u1tlto iciys s2ra(mp u)artnir iytlm e n i t srxr(o3oo1op n ivt sfartmur nu0apx  fciatfs2uau s u0alxrio iy1lmt ai s ( t2uoxr3oodaltemnesa(  rrm(  nt4tet mfcilslm rau o u)arerxrciodla elivi;t) 2uo(m iu4opeelict ()sDtrurpot1oexnmi3tyslm2emuvp u4trxnif oydfpt li ols0trum(m3no4olt mfvsa(fsrraur nt1olx mfcildfs2rluvo;()artoxocoy1omt ln s;s s2xo(r ou1lp n nesl(  2tau ont0apt ifcilsfs2eaums ()alxoxo3oo1oaDrli i;t  2toim3iy4al e net tfaDuax o;t4tltoioctas a2eauvp;u0trxoif oytfmDrlnvil(0seurxo3nudopenmfvilsfsrum(mo;u4aleomi3ils sDrlu snt)altnmo3to1la e i ol(0tetrxo3nodop emfeta( aDrrxr oo0teeniieiytfa2emuvp u0trenxr3tadfpt  u o (  rtoio3ou1alen nvi (  rtaumoou1apeoif3tld aDrauvs;u4alenmr3oytfa   u sl( srtmir3oo4lmtnmfeslsfsrum(mo;t1texomfetlt sDrm( s;u)teeomfciatlmDeai s ()s2toir iy4omenlfeilsfsrraxroou4tpe  oetysla2uan s;()tetnxocoadlpt  uei s  rtmio ou4alen fvi t)s2trxr ot4oexn o3iasfsDua(mo;u0arxrio3tytfptr i i;( srxoxr3oy4amtnmicilsfarrmxmp;u4tpt iictyt m rl( o;t4trtomr3oa1oaDraies;t0s2tr(m no4am nmfcsls) Dumu  ot0oeeo fciydfmDra( o;u)tltnio3iy1fm r ieol()t2xr(mpno1opt  fct s  rumxro;u1tpenmicias mDeluvon()arxomf3ty1fate uvi ( t2um(r iy1amtnlfcsasfsrrrump;o4tpeomfeiad m2elnvp (0 rtnxo iodlp eluei ( s2tr(o3ou4om  mnes tfa2rru pot4tpe iieiyt a2ea( ont) renio iatfm e u i t0 exo(m3nu4olte net t)artrxmoou1tex mf3iyt s elums u0 rtniocoydlpDrauvils)t2toxm3ou1lmtelnctls)a2tm(m oo0alxo ietys s2um(vo;t4trtoxf3iatomDrlnes t t2xmxo iodap   feiat  2umx o;o1olx  oetydlsDumu o;(4tetomf oytlp rauvols) eto(mpoydoltelfes s  rtmuroot1oeen ieiad m2eauvs t0altoxf3ty1fpD lnes;(0tetrxopoo1lpeelfvt t sDrm(m ou4tlxomietydfs elu s;t0 lenio3oa1omt luvols0 2xrim3oo1ap nmivta(  ruau pno4tle  feiat s el( p t4trermfcoo1lm eluvs;()trtmxm iudlpe  ies tf rua(  nu4tet iieiasfm em(vpn(4tlenmf3todlptrlnvslt seur(r iodameelneil()sDrm(roou4tltomo3iys s emuvo;u) exnif3oadoat aivils0srxoiopnydap  lfeilt s2uaum ;o1aleomieiasla umnvo ()tetnio todfa rlu i s) etr(r3iu4llt  nvtl()sDrmuro;t4tpxn ieilslm2rl( o t)tlxoio3oodlm  lneol(0 rtriopiudomtnlicia(f Drr(rpot1apx  oeiyd a ean p u0aexomf3iotoat  u ols)srxo(opoo4oleemneta( a2taxrpnu1tpenifctlt s2umn s (4texnir3io1omt  n slt0srxoim3oodamtnlncia(f 2trx pot1apt mf3iadlm2ra( s;t4 exoio ta1fa ean o;t setoxopnudameelnetl( a2rrum ;u4oetn i3ilt mDemumont0 lxoio3oodla rlivi s)teumxmpoy1omenlncs (f Draxrp;t1apx ioctatlm elnvp u)teeoxf3oodom  livolt0texoxopiy1am nliesat)sruaxmoou0tex mi3tysfm2eluvo u0tetnxrciy1oa rauvo ( sexmxr nodamtemicslt a2rrur ;u1tpxnio3tytlm2el(mp;(0arxnir iodfatr u s s0sruoxr3nu1amtn nci s  2urxrpnt1alxnmo3ild aDuanms (0arxrxr iotfaDrln o;s t2xmxo3io1ale lneiatfaDua(ro;t0oltn octlsfa2el(mo u4altoxfcoadfpD  i ilt srurxmpiydlltn ietlsf 2urx pou0tlxo ieiysfm ean s (0tlxnxfctotlmD  i o t  2tmxm iu1amenmfei (fsrtrx  oo4tlenmo3tadfaDraums t4 eenmfciy1lptr ies s)texm(opio4am emfvsltfsrrru pot4tpto i3iysfs ul( s u0tlxnmf3tadop  aneils0 2uoxopoy1oltnlieta( srtrx oou1tlxnmo3iytfa ranvo;(4alenxr3io1omD an s;s0 rxrir ou1olt lfeiasf Dur(mp;o4opt mo3tytls rmumon()aeeoircootlm r ueils) rxr(opiudap  lfctl(fsrta(rp;t4opto i3iysla2el( on()texriociytoaD  ivs;t)srto(m3nydaptn ivi t arrrxmont0apto ociydlsDumn o t)teeoircoatfaDraies ()srtmxo3oy1om nlfcsas a2ua(ro;o0opx  o3iasla rlnms;(4aetrxocoydfpD an ols)s2xo(m oo4optn ivtatfsrtrxmoou4tleomfetls m emu snt4arxrmoctotlm e nvils0 exm(r iu4altemfvia()arrm(mo;t1optn i3iydlmDeanvo (0alxrxrctatop r nvs t  2tmirpnu4al nlivsas) 2um( oot0alxo ictltls2umn p;u4 eenmociotla  li s s trumxm ou4ll   ict () 2urxro;u0olenio3iyd sDrmn o;t0texoiocoatfmtranei;(0 rtmxr3iydolenmiei sfaruax oou1tle  ietls a emu p;()alxnirciytlpDrlu ils  2xrim iydlme lnvta()srrmumo;t4tlt  ieildlaDulumont)alxrio oydoat lnvs;s s2xoim3nu4llte nesl(fsDrm(mp;o0oltomociat a2rlump () ltoir3iytop  ai s;s0 rxrir iodale mfesatfs2uaumooo4olto fcils s2umnvpnu)teeoxocoo1fm r uei t srxr(r3iydamee ivs ( aruaxmonu4texoioeiadla uanvpnu0arxnmf oo1lmDeaiei;(0srumim3ny1lm  mnviat)aDurx  ou1tlxn o3iysfm eanmo u) reoxociytlate n olt0 etoxmpiydlpeelfvs s srtrum ;u0aptn i3iydlm ul( onu4areoir tadfpD auei;s)sexm(rpio1lpeemnvsltf Draxmpot1tlt  o3iasls2rluvo;u4aexrxo3oa1op   i i;s) rum(o ou1omeemnetl() ruaumpnt1apt  i3ilslmDeau pnt) renxf oo1opDeanvs;s0s2xrirpoo4am   ieil(  2rax ono4alenmiciytla rmnvp (4 lxomo to1laDean s;s0srumxm3io4ol emfcsa( s2taxmo;o0olxomictadlm2rln o;u0teeomocio1opDr iei t t2xrirpio4lp nlfcsls) Duaxrpot0apxo o3iltla2elu ont4 rxrif ootop e ivi t0 rur(r oo1optn netat)aDtru  nt4aptnifctyd a2umn s (4teermf3oy1la r uesl(0 2umio ou4lp e nvi tfsDuru pnt0tlt mictldfs2umumo t0alenif3tytlpteli ol(0 etrxm3io1ole  nvtltfaDtrumpoo0oexo fciytfm2um( o;u0 lenmr ootop  auvo;s0 eto(rpoo1am n fet tfarumxr no1oeeniietys sDemumpnu4trxrmrciatfpteln s;t teto(o nodlmtnmnesatf rtr(  nu1teeo feiltfa rln on(4aeenmf3iadfm rli s s)texmir3iydlpeemnei t arrmx ont4ope  i3tydfaDrmuvo;t)aeenmfcoatlpDe ivo;(0sexoir nudam nmictl( sDumxr ;t0opto f3tadlmDeanms t0 rxoxo iy1fpDran ol(  2tr(r3iodlmtnlfvtas)s2um(ro;o4alxoii3tatfs2rluvs;()teenxf iatfmD  uei ()setm(mpoo1om n icia(f 2urumpou0tetoioeiytls2emums t0alerxr3iydopt au o;t0 2tr(r3io1opee fvils) Drmur no0tlx mieilsla2rluvo;()alermo3iatfmteluvs t0teum(rpnu4lptnlictlt arrmurpnu4tpxomf3iad a eluvo u4texoio3ia1lm  lnvsl( truoio oy1lpenmivsat s2rrxrpot4tptn fctldlsDeln sn(0 ltoxf oodfaDrlieilt0 etmxrpny4lle mnetas sDum(ro;t0tleoio3tyslm2em(mp;t0artnmo3oadom  li i;t0sexr(mpoy4lpenmfcsatf rra(m nt0apxniiciad m elu pnt0arerxr tatfateanvol(  rtr(m3nu4amt lnvsa(fa2tm(mono0altniieias m umuvp u4alxoxfcoy1laDeanesl(0s2toirpiydlmenlfcs tfs2rmxmont4altoifeildfm emumo () rxrir3iotfmtr u il() etmxr ny1alteliesa( srrr( oou0altn fetatlsDumnvpnu0aeerifcta1lpD  u i;s  eto(rpou4am elnesl( a2rr(monu0alt mieildls2ra(mon(4tlxnio3tydlmDr ies () eurim3nu4lpe miesa()srrr(m oo1oleo ictys m ra( s;t0 rtoxr3ta1fm   nvi;t  eur(m nudlpe mnvt (fa2rmxr
\ No newline at end of file
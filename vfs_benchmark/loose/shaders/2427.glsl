@@ -0,0 +1 @@
+ivs;()truoxo oudop emiet s)s2ta(m ou0opeo ociydls2emuvsnu) etrir oydfpDe uvslt trtrxm iu4ll emfvtat)artmu pnt0tetnifeiydfm2uaumsn(0altnmfcoodlpt  n s;t)srur(o oy1olte fvtasfsDrax o;u4apeoiociltls2ra(vs t)trxomocty1fm rluvs;t0s2xr(opoy1ol e fvsa(  rrrump;o0tlxo ictadlm ua( s u0tlerif tytlpD  n sl(0t2ur(o3oo1ll elncsasf Dra(r ;t0alto o3tadlaDrluvpnt4 rxrio3iotfmt luvi s) rtmir ou4am nmfvta(  rumumont4oex  fctld s2em(vont)tlenxo3totfpt  n o t trurxmpoy4oleemfeiltfaDrr( pnu1opxomi3tadfaDemu o u4 exomf3oadfmDelnvsls0t2xoio iu1lptn ncilt) rtmurp;t0aee iociys s2umuvs ()altoir3tatomt  n i (0trxrxr3nydomtelivtls)s2raxr ;u0texnii3tytla umumpn(0altomr oydop rai o;s) etm(o ou4olenmfct s) Dtmuro;u4opt ioetat s2ra( snt4 reomfcta1fmtrlues;s)teur(m3iy1lltemnct s srrm( p;o1olenmf3iadfa rmn snt)trerirctodlmt  u ils srum(m3nydopenmfvsl(  rrm(r ;t4optnmietydlmDul(mo;u4 rtoxfcootlp  lnes;t0seuo(mpno1omt  ivs ()srurum ou1olen f3iltfmDeau p t)trtnxrcoodfmt ai ols s2xoxm3nu4optnmivtl(fsruax pno1aptnmfetys m umuvp;t0aetoxfciydfpt auvs t0 2uo(o oudam emfvi t a2umx  ;u1olto octltfaDeauvsnu4arermfcoydlp  ln o t trxrxr3oy1apenlneslt  2raxrooo0tltomociydla elu o;t0 ltnmf iy1fmt aneilt  2xrim3no1lmte ncilt) rraump;u1tltn octldla2elnvsnu)tlerir3tadlmt  n o t0trtrxopnu4oleemfvsa()aDtruro;t4aeto f3tldfm ea( s;u4trtnifctytlaD anvi s0texoio iu1op  lfcs (  2rau o;t1oexnii3tlsfa eanvp t)artoif oytfpt anvi s t2ur(m nydal e nei tfartrum ;t0opeomfetatls umu p t0trxomr3iytomt anvol() euoim3nodap n fciatfsDta( p;o1olxn i3iyd a2ra( p u)trtrxfctytlat aivols0sruo(r oudoltnlnvtlt)arumx  ou0olenio3iat m2rmnmon(0tlermrctadfpDrluvilt0t2tr(m ny4lpee fvtls) rrr(rp;o1oexnmf3iasfs2umnvsnt0teerio iotlp eanei t0trtrxopoy4lle  feslsfa2rm( p;o1tlxnmicilt aDumnvon(4 ltnxf iotlat an olt)srum(rpoo4apeelnvs ( artm( o;t0aeto o3tad s ul( o u)trxrxrcio1fateanvi t0 rtm(r3oudlltnmiesls)srrrxronu1ape mfciyd a2rmuvs u) rtrir3iatla elu i t s2xoirpny1aptnmncs sfartr(mpno0olt  fciatla2em( s;u4 ltrxr oo1lpD  i s (  rtoxo3nydolte ici tf rum(r ot1opxniociatfs ra(mont4 eenmr3oytomDeliei (  2xrio ny1lmt lfct ( sDumuro;o4tetoifcilslmDua(ms;u4tlxoxoctadop eliesl(0srxrio oydamen ictat) 2rm( onu0openmoeiad s2rm(vo;t) lenio3ia1fmtean sl(0seurxm oydop elfctas aDrrxroot0oltnifctyslsDuanvo;t)texnifcoadfaD li s () 2urxr nudlltnlivsasfartmxmo;u0oex mi3ias a rln p (4trxnxr iydomt auei t trto(m io1apt  iesl( aDraxmono0tpx  o3tadfa2eln o;() exomo ta1lp rlu ols)s2xoir oo1amtemfcsa() rrmumonu0opx ioetld m2rlu p (4artoxf3totla eli s t0srur(rpoo4aptn neiltfs2rr(mo;t1aeenii3iysla2rl(ms;t0alxrxrcoo1op  luei;t)seurio ou4ll e iei tfsDumxrpou1tet ifcild sDuanvo;u0texniociatfp  lieo;t0setm(o3no1am nlicsas  Dtrxm ;u0oee  ictyd aDrmumpn(0 leoifctadlptelu ol(0 rxr(o nu4om e nvil()arum( oou0oeeo iciat m elumsnt) rtnmf3ootlatrln o s0s2trxrpiydaleelnciat artaxrooo0tetnif3iys a2ranvo u) lxnif3oy1lm rlivs;t)srto(rpoy1omee nvi t  rur(r no4opeoio3ilsfaDrl( on() rtrmo ty1omD lu ols)srur(r3ny4ope  nvs tfa2um(r nt0opxomfeils m elums;t4 lerxoctatomDe i il() 2umir3iodom  mneslt) 2ta(root1opx ifeiys s2ra( o t)arerif3oydfptrlu o (  rxmxrpiu1lleelnvsl()aDumu  ot1tpeoifetaslmDemnmpnu0 lxoircto1fa  auvo s0t2xr(o3nudoltnmnvi sf Drmu pnt0ope  ictldfs2rmu o (4 rxrxf ty1fateaieslt) 2xoir3oydllte fvta(faDtax pou4tpxn ieiltfaDrl(ms u0altnxr oatom raiesls truoio oo4opte icil(  Dtaxrp;o1tpenifciytfm2uanvpnu)tlermrcoa1lp rluei ( trxmxrpiu4om emieil( sDrr(mp;o4alxomf3iad m2em( on()alenxo3iotfa eauvs (0 exmirpio1lpen ietat)a2umu poo4oeeoii3iat s rm(mpnt4 etnioctydlpt livils0 rxoiopiydolenlfeia(fa2raxm ou4aex  o3ildfa uau s;(0arxnxocoadlpt aneil() etoxrpnodaleelfetas s2ra(rpoo0tpxniicildls umump;t)tltrxo oa1lpDrluvilt trxmxm oo1lm  mneta( aruau pno1oex  fciys aDum(mo u4tltrif3oy1oaDr ivol( s2xm(mpiu1ap  mnvs t)arraur ot0tptoifeildfmDrlnvs (0aleomo todlpteluei;s0srumxm3oudol   fvi (farrmur ;t1alx io3iltfm2el(vo;t)arerxr3ia1oaDrlivolt t2xmxm3nu4altnlivilt arrr(rpnu1teto fctls aDem(vo u4trxrir3to1lmDrlieo;( s2tmio3nodaptnlnvs ()sDtauronu0aleoiociat aDuanvs u)aexoxf io1om  lneo s s2tmiopoydome lnvil()aDtmu onu1oee mociadlm elnmp;(0 exrmf3oa1fa rai i;(0s2ur(r oodaptemict tfsDtru p;o1opxo i3iysls ea( s () eermfcio1lptr u sl( s2uriopoo4llee nesa( s2um(roou0opxo iciatfs elu s t)altrmocta1oaDr uvsls0srtmxr3oydlm  mies ( sDtaump;o0alx mocild m2ranvs;u0aeenxo3io1la elueol()teur(r iudomee icils) rum(m ;o1texoifciadla2ulnvonu4 ltomrctodlm  an i s0 2xoirpio4amt mnviatf rrmxr ;o4tex moeiyt a eanvpn(4trenxo3io1fmteaneo;s t2tm(mpnu4op  mnviltfs2uau onu0tpe moctaslmDelnmo;u4artnmfcoo1lmDe i o s  2xriopiydope lfvs ( artmxrpoo4tpxn oeiysls umnmp;u4trxomr3iy1fmDe uvo;(  2to(opoudaptn ivtl(f 2tr( pno0oeto ociat a2rlums;u4trxnif3oadop eai i;s teto(r3nodaptnlfctl( sDtaurpnu1olenmo3iydfaDrmu s t)aleoxo ty1opDeau o ()t2uoir3iy1aptn fcia(fs2uaxrpoo0tle  f3iltlm ulnvo;(4alermrcto1oate nei;t seurxr3ny4lmte fei sfaDrrxmo;u0opeoiiciasfs raumsnt4 ltnxf tydomDeanvo t) rxoio oy1alte nvsa(fs2trx pnu4tpxnmo3tytfa2rm(vs;(4alxrir3to1faDrlu olt0 rxoxr iu1al   icils)srurur oo0texo i3iytla2ranmp t0 renirciydfaDrlivo;t0 etmxopnodopee fes tf Drax oot0apxomoeias m uaumo;t4 rxoio iytoat  neo ()s2umir3ou1apee fvs (  rtmxm ou4aetnmf3iydfs ra( o t)alxrmr to1fpD  uvols  2xoxr iudomt mfvsatf 2uaxm ;o4teeniietydfmDra(vp;t0aexrirciadlat anvs;s)texm(rpiudlltnlieiasfs2rrxr oo0oee  octytfm2ea( s (0aleomrctytlpD aiei;(  etrirpiy4ame  fet s aDuaum ;t4alxo feiat m2um( s;() leoxo3totfp r i slt0 rto(mpoo4opee ietas)s2ta(m nu1aexn fciysfaDrln p;t)tetrxocty1fmt  nvi;s)srumxopno1op  mfvia()a2taur oo0apxo f3iytls rm(ms (0tlenxfcoo1la   nvi (0t2uo(o3no4amtnlneslsf Dumxr ;t1tpe iiciyt a2umn ont) rtoifctotoateaivi s)t2tr(rpoudlp  miciltfa2umxr ;o4ale  feiadlmDua( pnu4treoxrciadfa e nesls  rto(mpnu4ol elivt (f Duaxr oo1aexnmoetad a ea(vs;() exoircto1fmteaivilt0trtmxo3no4lpt  nei tfarta(rono1texnmociydlm em(msnt0 eenxo totom rln il()s2xrim oudom emivsa() Dra( p;u4teeoifciltfmDuau p (4alxnmocoodfm  liei;( srtm(r3iu4amenmicta()arurxm nt1apeoifeild a eaumo (4tlxnmr todop eaueilt  2ur(o3nu4op emneilt srtmx  ou4tptn ieilt a2emnvp;u0 rxnir3oydlmtelnei;s0 exr(rpio1olenlics t) 2uau ooo0ole if3tydla emu p;t4 etomr iodlaDrlivil( s2xmxo iydll elict s)s2urx  ou4tle mietysfaDum(ms;u4tetrmo3ty1oaDelnei (0truoirpoy4lptnlfcsat)a2rau p;t1aexnioctyd s rmnvon(0trerxf iydfm rau s;t  etrim3oodlltn iet (fsrrrxmo;u4tlxoif3tlt a uau p (0 exrif3iytfmtraiesls  ruo(m ny1ll   neilt arrrx  ;o0aeenmiciaslsDrmumont4 lxrmr iotfaD lieo t)setm(m3iodlpe mieilt) rur( pno4texnmfetydfaDelnmpn(4trtomf3iodop  luvs t)t2xrir iudop n nes ( srtrxrp;o1tet  oeilt s eln s t)texrmfciytopD  ies;s0trumxm ny4al   iei sfarrmurpoo4teenifeiydls2elumsnt0aetnxfcoo1fatr uvo;t)texrxm iudlle mncia(  2rrumooo4aeto feilsls2eauvpnu) renxo3iy1omt aueslt setr(o ou4lp  lfctasfs2rax p;t4alto o3tlsla2umuvs (4alxrifcoytom r nvsls0tetmirpnydllt mnesltfsDta( oot1aee iictad a eluvs u) ltnxrcia1laDelu s (0t2xmxr oy1lleelfeia()aDtmx poo0tle ii3iysla2ulu p;(0 lxoxf iotomDrauvo s0sexo(rpny1optnlfeta()arua(root1oexo o3ilslsDea(mont)arenxociodlat lues;s t2urir3io1lltnmiesas)a2tmxmooo0tpxnmiciyt s eluvsnt4areniociatoa eauvo;()srurir3ny4apt licil( sDtax ono4oetnmoctysls2rlnvsnt)aeeomr iotlp eluvols0 rtoir iu4om nlnvslsfartmxroou1tptn oetlslmDel(mp u4aexnmr3tytlmDe u olt  rtmxo iu4omtn fesas  rurx pot4olxomo3iatfs2rlu o;u0tlermf oodfp  anvsls  2umxo3oudoltnlics (fsrtm(ront1apx  ictyslaDelu p t) rxrmo tadfmD ln ilt0 rtm(mpiydolt lfvsatf Dtax  ou4tptnio3iltlmDra(ms;(4alerio3iy1fp eaies;() etm(r3iodal nlfvsa(farra( pnu4ope  o3iatlmDea(vs t4alxrmoctydom e ieslt0sruoxr3no4omtnmivta( s2rrxrono1tptnifeiasfaDrl( s;u0 lenmocoydfpD luvi t0s2umxrpiy4lpe mivil(fsDtrx ooo4tpx iociytfmDulu o;t4artnmr3todlp ran i s0 2xrxopiydamen fvtatfarum( p;o0oetnmo3tlt sDel(vs t4artoir3oadfaDeanvi;t  etmim iodlmeemnvsl( artm(m no0tpeo ictyd sDulump ()arxrio3ia1omDelivi;()seuoxrpnu4oltnlnviat) Dur(mp;t0oeenii3tasla rlnvpn(0 exnifcta1fa ran o;t)sruoxm3ou1omenmnvsa( a2umx oot1aeeoiociyd m2rmuvs;u4alxrxfcio1fmDe ies;t)trtmim3no1ale mieta( aDra(mpou1texomfetldfm el( p t)trxrxo3oytfpt  n i;s0texm(opnu1lpe lieslt)sDrmxrp;o4tpe mieiadls ul( pnu0aexoxf3oytlmt luvs s)s2xr(o iydlptnmfviat)srrm(  no0altn i3iydlsDelu s t0aeeoir oytlpte ueils s2um(r3iu4lltelfciat srta(m nu4aetomociasfm eauvsnu4aeerxo3iatlp e i i;s teumxrpiodlme mict (fs2taur nu4alenifciadlsDra(vp;()texrxo3iydfpD auvslt)trtm(m ny4oltnmfeils aDta( pnu4oetn fciat m2rmumo;u)alenmf iatomDrlu olt0s2tmxm3ou1al e net sfsrrmx  ou1olenioetaslsDum(vsnt4 exomo3ta1optrli i t0 exoxo iudlmtnmivil( aDuaxmp;t0olxomieildfa ea(mp;u4tleriocto1lmDran o t0texrxr ny1ameelnesls)a2rrxr ou4aeeomo3ilsla2el( p;(4aetnif iytfp rlieo;t t2xoxo no1ope licsls s2trurooo4oltnio3tasfs rlu sn(0arenmf3iytop eluvi;(  etrim3ny4ol elneilt)arrmxrono1aetoioeiyd a rl( p (0 renxr3ia1lptrauvo ( s2xrxr io1aleelivi t  Dtmum ;o0altnmoetatfm ua( p;u4 lxomr3ia1faDeaivo;(0srum(m3io4optn fei tfs2tmxmpoo4tpt  f3ils a ua(msnu4tetrmfciatlptr i o s s2ur(o no1opte ivt (f 2trxmp;o4texnmoctydfaDum( s u0tlxniociatopteaivs t)setrxmpoy1lp  mnvsl(f 2tm(r nu1tlt mieias a rm( pnt4 eermrcootomDe ues (0srxmio iydop nlfvsltfa2rm(r oo4opx ioetydlaDemump ()altnmo3ia1lp  aueils s2trxopny4apenlivi ( sDrr(mo;u0aet ii3tyt sDraumo u) rtomrcto1lptr nvi (0 rxrir iydapt lfcta(f rum(  ;t1aleniietltlm rlu o u0 ltrmr3tatfp rai s;t) 2toxr3iu1lmen nci ()srtrur ;u0tetomo3tyslmDuln pnu4aetrxo3ta1fptrlu o s0tetoir nu4ll nlneia(faruaxm oo0tetnif3tldls2eluvo t) ltnmf3tatlpDe iei;s trum(rpnu4lle lnesas)aDrmxmo;o1ale  f3ilsls raumon(4 exnxo3oy1oaDrluvo;(0srtoir3oudapen fvtlsfa2ur(moot0tpen i3iytlsDulu pnu0areomfciydomt  nvi;s t2tm(r iy1ol  liet s a2tru o;u0alt ioeias a2uanmon(0tlerxo oydomtrlueo;s0t2xo(r3iodomenlivtl(  Dtr(rpot1apto ociat sDemn snt0tetnxr3oadlmDrln s;s0 etoir3io1al   nci s)s2umxmp;u0opx  f3iydfa rln snu0 ltoifciytfmtrlivs t) exmir3no4ol nlnetl(fartaurpou4apen fciaslmDrl(vp u0tleomoctadfpDeluvs;t0srtm(mpno1lptnlnciat)s2um(mpnt1oleniictlsla2ranmp t)texomrcty1lpDeaueols)trtoim3io1ame  ivs s srra(ronu1olxn f3iatls rl(vp;(0 eeoio oadfpDelues;(0s2tr(m3oudlleelivtas  rrmur ot4tle iictlsfa ra( s (0artrir iy1lmDeln ils)tetoim3iy4lpeemfeta( s2umx  nu4tpx  ietyd a2rauvp (4 lxoxrcto1fatrlu ilt0t2xoirpiu4al elfet s)arur(m no1apeoif3iatlm uan pn(0 ltomrctodfmt  ivi;( t2toio iy1am  miei tfsrtrxmonu4tlx mociltlm2ua( pn(0 ltrxoctytoa r ivs s) 2umxm3iy1lm  livils srtau  nt4olxomfciytla2rln s u0aleomo io1lmDr i ils  rtoir3nydlm e nciasfaDtmurp;o0olenmfetasfm uan p;(4 leomf3todfpDrlies;(0texrxm3nudapenlies t) 2trxmo;u0apt io3ildlm eaums (0treomfcoa1lmDeanvo;s s2toxrpou1amtemfvta(fsrrmum ;t4opx  ocias m rl(mon() lermf oo1lpDeluvsls)seurxm iy4optnmics tfaDrr(rpno4oltomoeild a2ua(vs;(4arxoxf iodfatelivs;s s2xm(mpno1apeemfci s  Drmum ou4opxniiciasfa el( s u) reomo oa1op e n i t)sexoiopnydomeelivi tfs2tm(mono1alxo ocild aDua(mo;t4 exnmfcoadfm rlieol(0s2trxrpiydlmenlici t) rtmur nt1aex moeilsla rlnmsnt0alxrif3ta1lm eai s ( t2tm(m3ou4lptelfvsa(  Dtaxrpno4oex iieils s rm( sn(0texrxociadlaD  u s;()texo(m3io1ll n feia() Durxronu0oexnmieiatfaDua(ms;(4teenmocty1lpte n s;t0trurirpoydam emnvt t) Dur(monu4tex mictasfs2ua(mon()aeerxo3oadfa eliei t trtrim3nydlleemnci t) 2taxroot1aptn f3iytla2emumo;u)aleomr3ta1lp  aneols)setmxopio1omtnmicsas) rrmxmpou0tpxniieiat mDum(vsnu0tleomf3oatopDeauei t) rxoim3nu1am   ies (  rtr(mpoo1tlxnifetls s2eaumo;(0 eerir oodfmDraies s) 2xr(m3nu4opte fcsltfa2rru p;t4apx  iciyd a ua( s (4teermo3iadfmDr nvi;t0s2tm(mpiodlle  fcs s  rrruronu4tpeomfeiysfs umn o;t)trtniociy1omt aivo;()truo(mpiy1omtnlnvils  Dur(mo;u4olen feiadfmDran ont4 eenmo iatfpt auei s)s2ur(mpio4omeemivilt  rrrum ;t1opeomoetysfa2ra(vpn(4 lxnxo3iadom  lies ()srumxopnu4omt lneias) Drrxrpot1tlt  fctlsfsDrm(msn(4tetomr3oa1oate ivi;() etoim iydll   ncta( s2ra(roou0tetnifctadlm eau o ()texoif iadom eluvslt) 2xm(mpoo4op  mneslsfa2tm(mono0altn oetytfs2ulnvont0arxoxr3totoaD lnei t)trxrim3iodam emfcs () rurum ;o0aeto iciaslsDrmums (4tltnxo3to1lptrln o;()seurxr oo1lpt  nvtls artr(monu0olxniieiysla rl( on(4 rxnmfcoa1op e uvi ( s2tmxo iu1ome licsatf Drrxront0apenmfetatfa2umn s ()teerxf oy1fp rau ils s2xrxm3ou1ap nmncsl(fs2raxm ;u4aptnioetadfm2eaums;()trermf3tydomDrln ol(0 etoio nodop n icil() rrru ooo4alx mf3ilsls2emu s () rtoifctydoa eai ols0s2umirpnodllt  netasfaruauronu1olxo o3iatlmDuauvs;t)tltnir3ta1oaD luvs s  euoxmpou1lmee nvias)sDumx ono0tptoiieiys aDeluvont) ltnifcoatom r neilt seuoimpiodlmtemneilt a2ta(r nt1oetn f3tltfmDra( o;u0 leoifcoo1fat  u sl()srur(m oy4al e fvt s)a2tru o;u0tpxomfeilt aDran snu)aeeoxr oy1fatelnes;( t2urxmpoo1omt  fcil(f 2rrxrpnt0tptn i3ilsfm emnvpnt4tlxnircia1lm ranvil(0 eurir3ou4ll  lfct t)s2rmxmo;u4oltnmf3ilsfs2rm(vpnu4 rtrmfciotfm  lu olt) rtoirpoo1lp elncils  Duax  nu0openmi3tydlm2ea( p () rxnxfcto1lpD  u s;(0 2trxmpou1lm nmivi ( arrm( pno0tpt io3tldfm2ua( snt)arxnirciodom rln i;t) rtrim3oy4olte nvil(faDur(roou0oltnmfetls mDumn p ()arxrxocia1omteaivo;s)srxo(opoudll  lict ()sDumxrpot1alxn ocildfsDul(mont0trtrmr3oa1lpDrai o;s0teum(m3ny4olt lncsls  Dtaxm ;t1tleoioetytfmDemu o t4 etomr ia1fmt  ues t tetm(rpno1al  mnetl()a2um(rpot1oexnii3ilt m emumo u4 rerifctotfptr u i;(0 rxrxr3io1apen fvi (  2trumoou1tptn fciytfa umnvonu) lxrxo3oodlaD  i ilt0tetoimpio1lp  mies s s2raurpnu1teenif3tyslsDrmuvp;t)alerxr oo1omD  nes;(  exmxmpnydop nmfei sfsrrrx  ;o1aptoifctltlm uluvp;t0trxrio3oodop rln o s t2umio oy4oltnlfeia() Drrum ;o0opt  ieiasfsDumuvpn(4trxrif3oa1oate n i;t trxr(opoo1op n net s) rtrx oou0tlenmo3iadls2raumsnt4 exnir io1om elueslt)truoxr3io1ll elivs () rrmxm ou4aetomiciyd s rmnmonu0teeoxrcoydopt  u olt) 2xoiopoudlltn fvsl(f rrru poo4oleo o3iys s rlnvp;()altrmfciy1omteau s;s0texrir3nu4ap n ivs t)sDtrur ou4oltomf3ils aDulu p;u)alermocia1opteai sl( srxoxr io1lm e fciat)arumxrpno1tle mo3ilt s ua(vont)arxrxr todfa r nvi;t s2tmxr oo4aptnmicil(f rurxmoot1ape  ocias s umnvsnu)altomf to1oa  ai i;s s2xoim3oodoleelietat sDum(  oo0optnmfetasfm ul(vsn(4 exnmrciydfmD  nvs t teuoio nodlp n nes (f 2umx  no1tle iiciatfaDum(vo;t0 rtrmo3iytfm eaivo;s) 2xrxo oudlleemnvi ()a2rr(moou4aeto o3ildfsDem( pnu4 lxoifctodlmD  ueols  exo(mpoodopee icsas)s2rmur no1oeenmi3tld s2rl( snt)arenio3iytfmD lneo;s)setr(m oo4llt livtas) 2umxmpot1oetn ictadlm2eau o t4trenmf ta1op rau ol( srxmim oo1ole lfci t a2tm(mo;u4tltnifciytfmDrlnvs (4tlxrxrcoytlpte n s;s  rxm(m3iy4altemfvilt)artmxro;t1alen ietytfmDemn s;(4aetrmo ootlpDr ues (0trxmio3ou1om emfeilt) ruaurp;o0texnifciaslmDrauvo;(4aeermrcto1lmDrlu s;(0t2urxopnu1ol emnviatfs2ra(r ou4tetnmo3tlsla2em(mp;u4trtnmr3tatfpt luvo t) exrxr ou1ol  mnvtltfsDtr(root0aleo fciytfa umnmo;()aetrxr iodlateai o;t0 etmio iy4alt mivils) 2rm(ro;t0ape iiciys m em(vonu) rtrxfciotopDranvs t s2xmir3ny1ale lfetat  2tmumo;t1apt  fcildfa uauvs u) ltnircta1oa  an ol(0tetmxopiy4lltelnvtas aruaxrp;u0optn fetldfs elnmp (4areoxfciy1op eluvi;() 2xrimpio4apt mnvia(fsrtrx pot4tle  oeils s2ulu onu4tltomrcootopD lnesls0 exoxmpno4lp   ici t arumu  nu1aleo ocild aDuanvp t)teermr iydla r ueils setoim3oodlltnlicsl(f rum(m ot1alt iicilt mDemu o ()aexnmr totoptraieols) 2uo(mpiy1omeelnvi tfartaxrpoo4tltoio3iytfsDean pn(4texoxr3tatfptrli slt)t2xr(o ou1llee ici sf 2rr(r ot4tle  ictas a2rln on()aetoir3iotomteauvol( trxo(m3nudap n nctltfsrrrxroou4opt if3iaslm ul(vsnt4teenmocia1fat  uei;( sexrxr nodlpenlfvslt  2ur(mo;t4tlxomf3iltfm umu pnu4areoir3ia1omtrlnvo t) rtr(o3nydlltnlnct s) Dururoot0opeo fctydlaDrluvs (0 ltomocio1fp r uvo;( t2xmim3nu1apen fct (  2ra(mpnt1tpx mfetydfsDrl(mp;t4arenxr iodlat lnvs t0srxm(m no1lp n iesl(  Drmxmp;o0tetnii3tytfaDrmn pn() lxoifctydfpDean o;t0 etoimpny4apeemiciltf Durxr nt4tet iocild s uauvp u0arenio3iatfm elu o;t) 2xoxo3oo4omt  nctas)sDrrxr nu0tpenmo3tad a2umnvo () ltoio ty1oat ai s;t)tetrio3nodam elfctas artru ont4ole  o3tas s ra(vs u)arxnifciodlm elu i s0trurim3iydop   fesat)arrrx  nt0optoii3taslaDrlu o;t0arxrio tydfatrlnvo;t0t2uoxm3oudlmenlfvi t aDra(  ;t4altoiieiatfs2rm(msnt0aeeoif iy1lat  nvi ( s2tmxmpoo4alt  ics ()a2rrumooo1tex ioeilt s2rl(mo (0 renxf3iodfm rau o;()trtrxmpoydameelnvsa(  2rrxm oo1aee micild s2um(msnu0trenmr ootla r ieilt)srxmxrpoudopee nciasfaruaur nu1tptn ictyslmDrlnmsnt4arerio3oadfa elnei s s2tr(o3io1lmtn icias) Drrxrpoo0tpenio3iatls ul(vo (0 rtoxo3ootlmtrluvi (0 2xoxrpiu1lleemivils) Dtmxmpnt1tet moeiytla rl(mp t0 etrif3oa1fmDrluvs;t  2xr(r3oy4om nlncia(fs2rax  ;o4altoifeiatfaDumumo;t0alxoio3iydlmt anei;s0texo(o3iu1lpt  iesasf Dtaum ;u1aexomictytfm raumsn(0aetoxr3tytlmtrlnesl(0 ruoxm3ny4lpeelictas srua( ont0apeoifeiad aDrmumo;(0alenmf3oa1oa elieo s)teto(mpiu1ol nlfcs t) Dua(rpnu1olen octld mDuaums;t0trtnxr oo1fmt lnvs t s2tmirpiu4omenlfetat  2tru ont4tetnmociltfmDumuvsnu0alerif3todoat auvilt0 rto(mpio4op  miesas)a2rrx p;o1tee  fcilt aDum(mp;t4tlxomo3oytopDe neo;(0 2uo(m3iy4apeemictat)aDtaur oo1ape io3ias m umnmpnt0 exnif3tatfpDr nei;()trxoxrpno4al  lieils aDtau  nu1ole ioeild a ua(ms;(0 ltrio oa1fmt lu o t)s2xmiopnu4aptnlfci tfs2ururpou1aptomi3ilsfm2rmumo ()trxoif3tytfmDe n i (  rxrxopiu4alt livtasfaDrrxrpno4alt ii3tat s2uauvp;u0 lxnxo iotfmD au s s0srxmxmpoydaptemfetat) Dtr( ont1olx ii3ildlaDemuvsnt0alxnxocoo1la  lues;() 2tmiopoy1ol n fvsat  2umxrp;o1tpxo ictatfaDrmuvpn(0altnio3totoatraivs ()s2xrirpnu4apt micsas) 2tmxro;u4tpxomo3iytlm rmnmpnu0treoxo tydla raueo;s)srtrio3iy4lpenmfetat arrr(r no4tle mfeils a2umums;t)arxoif tadfmDrli i;(0 etoxo iu4omt  ncslt)s2tauro;o1alx mictyd aDua( p;u4aetnifciytlat ai s;t s2umxr3iodol   nvsl()s2tmumo;u1apeomietls m emuvp;t0 rxnir3oodfm rauesls0setmir3oo1ole mieiat) Drm(m ;u4tptnio3iydla2ulu sn()aleoxo tadlm eln ol( tetoxmpno1omenlict ()aDumxront0alxnifcild aDeaump;u4 lxrmf tytomDe n o t0srumio iu4lpt mics sfsrta(mp;u0tpeomf3iatlm ulu p u4tltrif ta1lmD  ues s s2xrimpiy1lm  lictas)s2tmx p;o4tpenmi3iatls2umnvp;(4arxoir3iodlmDrlivo t)texoxrpoy1omte iesa( artm(rpnu4texoii3iytlm2elnms;(4aexriocoy1omDe ies;s0seuo(o3iu4amtemnvtlt)aDtmumonu1olx  o3tydfmDulnvs;t0 ltrio3iy1opDe n s;s) exoxr io4ame mfvi ()sDtru  oo1apeo ieiad aDuau sn()tlxnir tadfaDelu o ()trum(rpiu4lle licsas)s2rmum ou0oex  oetasfs2uau p (4tetrmrctatfaD anesls0 rtrxo3nudlp  lfvsas aDtmx  ot4olxomi3iatfs2elnms;t4 rxoxfciatop rai s t0setrxm ny1lmen fvias)a2um(ro;t1tpxomfctldlsDea(mp t)teenxf iodla  lneo;t)t2urim3iy4lpen nvtas aDta(mpoo4tex mocildlm emu p;u0tlerxf oo1la r neo;s s2xoxo3no1alee ict () 2urx  ot0tpxnmieiltla eau sn(4artoxf3ty1oat  n sl(0teumxrpiudal e nvsa(faDraxm nt1tltnifetlt aDuauvs;t0aexoif3iodfate neo;t0truoio3no4omtnmnvt t sDraxrpno0tlenmoeiydfa umnvo ()aetrxrcoatopD lnvsl(  2urir3ny4apee ivtas)sDumxrp;t1oltoiieiltfa ul( s;(4 rxrxo oadfa  anvilt  2xmimpio1ome lfetlsfs2uaxm nt1oet mietyd a el(vo t)teerxf tytfpDraieo;t srxo(o io4al nmneils  rtrxrp;t0tee  oeiydfa el(vp;t0tetrxfcoa1lm e i ilt)srxoxm nodoltemnvt (f 2rrxrono4apeo oeiltlsDuanvo t0trtnifciy1oat au s;s)teumxm oy1am  mfesas  2rmur ot4oltnmfciaslmDrlnmonu) rxrxo oatlmtrluvi s0 2tm(mpiudlmte ncsa(fsDuru  ;t1tpt  oeildlaDeanvo;t4 etoifciytomt  nvi;s  rxm(r no1lptn ncs s)sDrrxrooo0oeto fctatfm2ranmo (0 lxoxf3oytfm eauvi;s srumxo no1aptemfvtasfs2taumoou1tpx iicilt m umums;(4aeeomf oo1fa rauvolt)texrxr3nu4ameemnctatfsDtmum nt0tpt iociydlmDrl(mp;t0arenmf oa1lp   u ols)t2tm(opiudllenlivias) 2urxr ot1ole  fciyd s ranvp;(4aeenxr3io1om rlnvs t  rxr(o iodom e ict sf Dtmu  ;o1teenmfciyslsDeanmo;u)arxomf3iatlm r u o (0sexm(m3oy1omte fcsltfs2rax pou0alenioeilsla emnvo ()altrircoodla raneo t  2umxo3nudoleemfciltfsrrrump;o1texn i3ildls ra(mpnu4trtoifcoodfate n ilt) ruo(m3oudop nlieta( sDta(m ou4oetomf3iadfm2eluvsnt0texoxr ty1om  aieo ( s2tmiopiu1amtelietltfs2tr(rpoo1opxo oetaslaDemn s;(4altniocto1fate nvs;s0 eurxm nodol  mfci s srtm(mono4tlen ociyt m um(mo (4 lxnmr ia1om e ies;t0t2trir iy1amtnlfcsasfa2rrumpot1tltnii3ilsfa el( sn(0trtnxo tydlaDeaneo;s0srur(o3oo4lp nlnvs tf Duaurono0tlx moctldfm ranvsn(0aeerif3tatfm rln slt) 2xmxm3io4am  mfvs tfarrm( pou4tpxnmoeiytfa eln o t)artrxo oadlpte neolt0seuoxmpno4ol n iet ( srum( pno0tptoioetadfm2rm(vo;u0 etrif oodlmtrlneo;t  eto(rpno4am  lfvi (faDra(mpnu0altomieiytlm2rlums;() ltomfcoydfp  ln ilt srtr(o ny1ome licsls s2urx oot1teto fetas aDuluvp u)altnmr3tydfmteluvslt0trurxmpiudalee neils)aDrrum ;t4oeeomfciysfm ra( snu) rxnxf3totlmtelneo;t0srumxo iudop e nei (  2raxmono1oexoii3tatls2um(vs;t4aetnmocoytomDrluesl(0teumimpoy4ap  mfvsls) rtru pnu0tlenmocilsls2ranvo t4aexrmf3ia1fa eln i ( t2tr(rpoy4lmeemietls  Drrxmonu1oeenii3ild m rmuvs;() rtomfcoytfmDraneol()trxrio3iu1ap  lfes (  Dtrx  ot1tpxomi3tls s2ranvs (0 rtrmr3oydlpt anvi;( texoxrpiu1apt liei s srrru  ;o0altomo3tasfs ea(vs (4arxoxociydfatr nvsls0srxm(m io1alenmfes t)sDrr(rp;o0tpxomieiysfmDrm(vpnt) eeoio3tadopDeau s;s)s2tr(opiy1op nlneils  rumumpot0opxo f3iydla rluvsnt) rxrxr3tydopt  nvo;s) 2uoio3nudlme  nes s) Dtm(mpou4tpeomf3iytfm rl(vsnt)arenmfctydfpteli i s0trxm(o nudomenlfcs s  Dur(mp;u4aeeniietytlm umu s;(0 ltrxf3todoaD livilt)s2umio oodlp elnes sf 2tm(  nt1tle mf3iyt mDra( s;t4tlxrirciytlaD luvs t  eto(o no4lpe livil(f Duaumo;o0apto oetas s2eanmpnt0trtomrcio1lpte i o () rtmxmpiu1lm emnet (f rtau pno0oltnmi3tyd m rl( p u4 lxnxrcoydopt luvolt) rtrxopoo1lmeemfcilt) rrrx  ;o4oeeoiicils s rmuvpnt4tlerxrctytfm  an il( seum(o3oodlpe lfcil(farur( pot4aleomoctad s ulnmo u) rtrmfcoodoatr n o ()setoxr3ny4ameemneiat  rrr(m ;t0apt  f3tatfs rmnmp (4altoifciydfp  luvs;(0s2toir oodol nlnvs t s2ra(root4alx  f3ildlm2el(vo;t4trxnxf iodlptean sls  2xr(o nydalenlietlt sruau ooo4aptn ietldla eanvp u4tlerif ta1laD anes;(0 euoxo3iy1opte ivslt srraump;t4olenii3iltfaDumu p;t4aexnmf iytfatelnei;(  rumxrpoy1lmeelict () 2ur( p;t0aetomoetas sDum( s;u4arxnirciytfmD auvo;t) 2tm(mpoo4am  mfviat)sDrmumonu0tpxnio3iys m raump;u)texrxr3to1fpt  neslt0teum(mpoodlpteliet (f Dtm(ro;t1tlxn f3tyt mDrm(ms u)tltniociytfpt  u o;() etrimpnu1aptnlfet t) 2raumoot1oetn oetys s rm( s (0 exomo tadfa r ivo s0t2to(m oy1olt lnci ( sDtrurpot4opt  i3tltfmDuauvs ()trtnmf oytfm ran il() rurir oy4llte ics s aDtruro;t0tltnioetasfa2ulu p;u4aexrxfcoo1om e nei;() eumir oy4lpe lfesas aDurxmp;u1olxnio3tydfs2ua(mo t4aeerir to1faDe ieil(  exmxr iy4lleemncsas artaum ou0oexnii3ilsls2em(vs u0trtrif iotlaDeauei;t  exo(rpnu1lp n nciat  Dum(rpot0ale io3tysfm2eln o t4 ltoir oytomt  nvol()s2uo(r3ny4lptnlivilsfa2tm( o;o1oetn ictasfs2el(msnt) etoif io1oaDeanvs ()s2tmir3oudamt  icsls)arrr(ronu4tetomi3iadfmDelumsnu0tlxrmr3ia1lat aieo;()sruo(opnudlpt mietls arumu pnu1aetnmfctat a2el(mo;(4texnxo io1fptrlivs;s)srxr(m oodapt lfvt t  2ururonu0apeoifeiytfmDeln pnt)trxomoctodlmteluvil( seuoir ny1ol e fctlsf Dtr(roou4tlxnmf3iatls ea(mp;t4trerxf oy1omDranei;t)texm(opnu4aptnmivi s srrrum ;o0aetnio3ildfaDean pnt0aetoxo3totla raues t0t2umxr ny4opt livtls)aDumurpoo4alx if3tasla2em(vsnu4trxrifcto1lpDean o t0 etm(r nu1optnlivi sf 2tax  no4aeeoiietytla2ra(ms t4trtoxr totfaDeauvs () 2tm(rpiudolt  icia()a2rrurp;t0altomi3ildlm2ua( p;t0 exnir3iotoaD livs;s s2uoxm3iudomtnlfvtls) rta(rpoo4tptnifciad s2emu s;u) reoif ootfat  uvs;s0 2xrirpno4lm  mncta( artm(rpoo1optnioeilsfm uanvo (4altoir3tydfat aueilt) euoirpio1ol  lietltf 2ua(m ;t4aex mi3tlt aDumu s;()alenmr tadfptraies;s0s2urio nudlle  neil(  rurx o;t1tlt  iciatls ul(vp;()tltnxfcoatoptelueo ()trtrxo io1amte iei (  2tr(m ;t1oltnioctlsfa2el(mp t0artnxfciy1lm  luesls  rxmxm3oudoleemncsa(farur(mo;u1tetn feiat mDrmnvo ()texrxrcoatfmD livil(  rxmio3oudlm   net t  rua(m oo0aeeniociyt sDra(mo u) rerxo3oadoaDrln s;s0 rur(m3nodom  lfcsas)a2rmu  oo1tet mf3tytfs2elu pnt)teeoxo3oo1fm elneo;s0 2xmio iu4llee nesltfsDtmxm ;o0oeeo ictlt sDelnms;t)arxomf3oy1opDeauei;s)srtoxm no4al e nvs s)aDtrur oo1tltoiieiyslsDelu onu0aetrxo to1omDeanei;s sruoir iy1open nesasfartmu ono1oexnmociad m2elnvont)arxnio todomDelues t0 etmxrpnu4olen ies (  2uaxm nu4tlt  ictltla2uaums (0aeenio3iy1la rluvols0srxoim3iu4lm  lnvsat) Duru p;o4tlx  fciadlaDem(vo t0 exoxoctydop eaivi;( setmio oudom n ncsatfaDrmx  ;u1aetoifeiadfs ul(vont)teeoxf3to1laDr i i;t seumir no1apee neias) Drmur ou1tpx mietyd m rmu o;t)arenir iatfa raueslt0 rtrimpoo4lm e fcia(fs2rrx o;o1teen fciysfm2ulnvsnt4alxnmfctotlmtr u i;s trxmir3oodlmt  ivia()artaumpot4aexo f3iasls uaumpnu4 exoir oo1opte ies () 2xrxm3io1ape livilt)s2rr( oou0oetnio3ilsfa2uln o u4trxnif3oytoa eluvo;s) rtmxo ou4al n ncta(  rtmxm ou0oetn fcils sDumn onu)texoxocoadop  livs ()texmxr3oodamenmiesas)artm(  ;o4apen octls mDulu p;()arerif oodlpteaiei;s  rurir3io1lleelnctltfsDta( ont1tltomiciyd s ua(vp (4 rxnioctytop  aivolt s2toxopnudom eliet t) 2uaum nt4texomf3tadfs elnvs;t)aeermf3oytlmD auvils sexm(r nu1olenmnci s)aDtm(root0opxnmfetasls umu o;t0trxnxf oadlatran s;()srum(r oodoltn fci t srumum ou1opxnifetadlmDuaums (4 ltomfctotfp e ieilt) rurxm3iydapen nvil(fsDurump;u4openii3iadfs rmn p;u0trenxo3iy1oateli slt0s2xrxo3iu4ame  ivtatf rumuroou4opt ifctldfsDrau s t) lxnir iodfatrlneo s)t2urimpny4altnmieslt a2urxm ou1ape  fciltfmDrmnvo;(0teeoif ta1fmteauvi t t2xr(m3io4op nmivsas)aDrmxronu0alxomfeildfm em(mp ()tetnmfcoy1omDrauvslt tetrir3iy4al e nvs t sDtmxmpno0oexoii3iad s eluvp t)alenif3tytfaDrlu ol()srxr(mpiodlmeelfct t srrm(ro;o4oeeo oetld sDuan p u4aleomf3totfat  n s;() rtrio3nudop elfes t)arurumont1olx ifeiydfm2ulumo;t4alenmo iytfatraivslt)sexm(r3oo1al n fcsatfaruaump;t4tlen o3ils a2umumonu0texnxfciadop rauvo;s seuo(m3oo1oltnmiet t srtru pnt1oetnmo3ilsfm ra( pnu0 rerirctatopD auvs ()seurio3oodalt  ici s)s2umu poo4apen fcilslaDrln p;t) exnxfcta1latrlnes;(  rtr(mpio4omte fcslt srtrurpou0ole  feiat s umuvo;u0 rtnmr3tydomD lueo ( teum(rpnodaleelfcs (  ruaum ot4alenmi3tasls2emnvonu4artrif3to1oat aieo;t)srxo(m3nu1aptemfesl( sDuaurpot4tlxniieiydla umn pnu)trtrirciydfat ai o s)texo(opoodol emnctls)sDur(mpno4aexoii3iadlsDra( snt0alerir oydlmtrluei t s2umimpiu4om emnesa( sDuax ooo0oexniiciys a umnmsn(4arxrif3iadlat  u il()t2triopny1ll  lncsl( s2rr( pnt0altnmf3tldlsDrl(vs;u)teerio3tytopt livo t) rtr(rpio4omenmies s) 2tmx o;o0tpeo fetydlsDean p;u0 rxoir3tytlatelivslt)trto(m3iudome mneiat) rtmu  ;u0aeen icilt sDem(mp;(0 ltrxo3oa1faDelnvs ()setriopnu1amtnlnvt tfsDrmur no1aex  oetasfa rmnvpnt) lenmf3ty1fateluvi t0srxmxmpnu1olen fcsas  2ur(r ou0tpenif3ias aDuaumo t4tetoxf3oa1opD  ivi s)s2xr(m no1ol  lncsas)aDtaumpnt0aetoifcild m2ul(vo (4tleoxr todlmtranvo t0 2trxo3oodale mneslt)sDuru  no1opeoiociaslm2ranmonu4alerirctotlpD ai o;s)trtmimpou1amtnlfvs s)srur(rp;o4aex mf3tltlm2eluvsnt4trxnifcoadfat au slt) euoxo3nu1apen net t)aDtmu pot4olxoiocildlmDelumo;u0alxnmf3to1faD liei;t sruoirpnudopen ictl(  ruaumpnt4olx  f3iat a uln o;u0trerxocoadfm rli i;(0s2tr(opio1omt  fctltfs2rmx  ;o4oee  feiat aDrl( s t0 exoxfcoatlaD  nvsl()t2uoxr3iu1ll nmfetatf Dtaxm oo1alxoifeiytfs2umnmo;t4tlenxr iytlatrau s;(0srxr(o oydlpe mivtls  rumumono4oee  fciydfs ulu o u4treoio3todlmt luvi t  eto(rpiy4opeemfvi sfaDtaxmoou0tet  o3tls s2uanms (0 rerxf oadom raivilt)s2uoir ny1altnmnvils  Dtax  ;o1aetniocias m2rlnvo;u)trtrif oy1fptraneol()trxrxrpio4amtelnvslt a2umxrp;t1tle mo3tldfsDrmnvs;(4trermr3iotlp ean o;t0trtmim3oy1ap   icsa()sDua( pnu0oltomi3iatls ul(vs;u) exrmocoa1fp elivi;t0 2xoxopnodlmt mivtl(f Duaumpot4tlenmi3iltlmDeauvo;u0alerxf3oodfp e ueol(0 rxoxo nu1ll   nesat)sDtr(rpno4oexn octlslmDrlnvsn()aetrmo iatom  aues;t0t2xo(r3ny4om  mieslt sDrmx  no4aleo feiadls emu p t)trtrxr ia1fmtr i i;s0s2xm(mpoydll nlnvias srrru pnu0tee miciytls2em(mo;(0 rxnif3iotlm e i ols)s2tmxopoy4lmt mncsasf 2ta(  ;o4olxn feiytlaDua( pnu4 renxrciotomDeluesls)srxrxo3oydop elfct (  Draumonu1ale iieiytlsDuau snt4 rtnmocio1fa rai sls sexoir ny1op  mfctlt)srrr(m nu4tpenmietat a eanvpnt4 rerircoy1faDraivi;()setmio iy1lmee nct ()srtrxr ;t4ole  oeiltfs umnvo t0tetnifcty1fat luvo;s0 ruoxm iy1alenmncs s aruaxro;t1oet iictat a eanvsnt0aetrio3tydfp elnvo ( texo(mpoo1ll n fvtas sDtru pno1tlxniietls a ua( s ()tlxnio ia1faD  uvo s) 2toir3ou4alee fvs ()srum(r nt1alxoii3ildfs2ulu o;(0aexriocia1laDrlu ol( s2to(m3io4ap elncta(f Dtm(mpno0opxomfeiydla2ul( p ()aetrxoctotlp  ai ilt0seto(opiy4apen nct ( s2urump;t1tleo o3tytfa rauvonu0tlxrifciydlmt aueil( s2trimpoy1lp  mieil()a2uax  no1tpt mieiydlsDran o;t0arxnmr ty1fp   n s;t teurxo no4lme mneslt)a2uax ooo1alxn fetys m2em( p;u0 rtnif oy1fateaivs;(0s2xm(o3iy1apenlncs (  Drrxmooo4opeomoctytfa2emn onu4 leoircoo1lp  lnvilt s2xrxm3ny4ameelncslt  rrr( o;t4oeenioeiydls rl(vs () rxniocoo1lmtrluvo s texm(o3oudom  mieiatfsDuaxrp;u1altnmietatlm2rm( pn(0tetnxo iydlaDe n i;t srumxr3oo1omt lieias) rtau pnt4tpto iciyt aDua(vs (4aexnxrctodom eliei s setoxm oudamt  ivtlsfs2trxr no1tpenifctyslm2rm(ms;u)trtniocia1op rlues;()trumimpno1oltnlivils)a2tmxrp;u1altomo3iysfmDuanmo u4aetnmr oydfaDeluvs s0 exm(o oo1ape lfctatf Dtrum ot1altoii3tadfsDrlu pn(4 etrmfcoy1fmD  nvo;t)srxoim3no1lm   neiat)aDrr(r nt1tltomi3iyslmDran pnt)tetnioctatfm elu s s0seurimpou1ameelfetat sDrr( pou1ope iociatlm2eaums;()alerxf tatlp  luei;t) exmir3oydopeelnesl()s2tru oou0tee mictysla2rlu p u4 rtoioctytfaDrln o ( seumiopnu4al elnet ()aDuau  ou0altnii3tadla rlumo;(4artnio3oadfa raueslt0s2uoxo oudape licsat) rtmum no0alto i3iytlm2ean p;(4aeermo3iytfa  lieo s srum(m ny1ame mfvi s aDrr( p;t0olxn iciltfmDrm( s (0tltrifcoo1laDe nes t s2tm(m iy1lmeelfvil( srtaxmpou1tpe io3tyslmDumn p t4trtnmo iatopDraneo s0teurio3ou4lmt  ivias)arrr(  ou1tltn f3iltlmDel(mp;t)altnio totfm e nvols) euo(opiu1lpeemfes ()arra(rp;u1tpx ioetyd s2ea(monu)texoxrcoadop  aneo s) rtoimpiydamee nei tfa2uau pno4aexn ieiltla rlnmp ()aeermf3ootfm eln ols  rum(o oydome lnetls) 2rmu pot0tle  f3iat mDul(ms t4 etnif tydomt  uvo (0setmirpiy1om e ieil()a2ra(rooo1oltn f3tys a rmnmp;u) etoioctydfaDrlueols)teuo(o oy4ll emneiatf Dur(mpot4tet mfciad s ua( pnu) leoxr3tydlm raueo;t)t2trxopoydlme mfesat) 2raur ;u4opto ociytlaDelump u4tltnxfciotlmtr ies;s0trumxmpiydlleelfvsat)aDur(monu0texn f3tld s ua( pnt0 renxociydfp elnvo;t s2tm(o3iydlleemnvi ()a2rauront4apxn fciadls elnvo t0trtoiocio1omDe uei ( setmim oodapt miesa( artrum ou4tpx  ociydls2em(mp;u)aeerxociodomtraieslt t2urxr oydllt mncs () 2tm( ono0aptn ieiyt a2umnvsn()aleoxo3oa1lpDraieol( t2tr(m3no4am nlneslt) 2tr(mp;u4aexnmictydls uanvo;t4altnio3tadlm rlnvs;t  2uo(opiu4oltnlfcils s2rr(rpno4tpx  o3iysfaDrl(vo () rxrxr3iatlp rli ol( texmxr iydlpe lictas)sruax o;t0aptnmf3ias s2emnvon(0artoxf3ia1laDr nvilt  rxmir nydam nlfcta( aDtaurpoo4opx mi3ilsfaDemn ont4tetomr oatlpt lneol( t2xrimpoy4op  mfesls  2rau  ot1alxoif3iad mDel(mp u0trxnxr ootop  aieils0trtr(opou1oltelfeiat aDtrx o;o4apx ifctas a rauvo u0aexnifcoy1fpDe i ilt)srxm(m ou4amtnmfvs t) Drr( p;u4tpxn iciysfa ulnmp (0aeermo3ia1faDranvi;s)s2tmir oo1lmen nci sfsrraump;o0aptn fetyslsDemumo u) lenmf3ia1op r n i t0 rxm(o oydap emfctls a2rm(rono1aeeniiciydla2rl(msnu4trxrmf3iotfpt  u s;t0trumim io1lm elietl()sDta(m ot0aeeoii3ild s emums ()altrxr3ta1fatrauvslt)trtmxopny4altemfciatfsrur( poo0alxnmieilsla2rl( o t0 exomf tadlmtrlueo ()s2tmiopiy4llenliet ()aDtau  ot1aeeoii3tlslm2emnvont4 reoxf3tydfp rauvs () ruo(o3iy1om   icta(fsrrr(mpot4apenmf3ildlm2rluvpn(4 lerxf3oodoa rln i;t0tetmxmpoydam nlfviat) 2umxmoot1oltn o3iltfa ulu p;u)tlxoio3iodom r neslt srxoxr3no4ame  nci s)sDurx poo1aleoif3ias sDumump;u4tleomf oy1fatr uvil()setoirpou1ap n nvt (fa2tmurpou4tpeo ocils a2rluvs;(4tlxomrciadlmDrlues;()tetr(m3oudllt  fesl(f rtmuro;t0alto ieiltfsDrm( o t4 eermo3oa1fmDelnei ( s2um(o3ny1lpte fvia(  Dumu p;t1apxn fctltla rluvs u)aetnir tytfatraneils t2urio iodapt  feil() 2raxr ;u0texomo3tad sDelu s ()areoio3oodfmDeanvi;t srxr(opnudoptnmictlt)srra( ooo4apxoif3iasfs ra( s u4artnioctytfaDr uei t)t2uoxo3oydapeelicslt a2uaxr nt0open ietatfs2elu p t0 rerio iy1omte ues t0 rumxopoodal nlivil()s2rmu o;t1aptomictldls2rl(vsnu0altoxo3iadoat ai i s0setmio3no4al e nvilt)sDtrumoou0altomiciydfm2ua(vp (4 lenmocoodlpDelnvil(0trum(m oy1lltemfvsa(f 2rrumooo1tpe  ietys m2ua(ms u0 eenxr tatlpt aneols0 2tr(m3iu1alt  neta( sDua(mpot4aet iocilsla eau o;()treoif3ta1lpDeaueo;( setm(o ny4apenmivtlt)s2tru poo0oetnmf3iatfm2el( o;u4trenmocoodfmtr u o;s  rtrxrpiu4lpte fciltfsrra(mpnt4teeo feiltla ulums;u0altrirctytlptraueils0setm(m3nodlmeemfci s s2taumoou1apenmf3iytfs ran snu4teenioctytlmDe ivo ( teur(m no4op nmfei t a2ta( poo0aptoifciyd a2ranvo ()tetnmr todlmD luei s)s2urxr3oy1omte feil( sDumxrono1aleo icildfmDrmnms;(4altomrcoodlp  li sl(  rtmirpoudape mncslsfsruru ont4tleomi3ild a2rauvo;t4 renio3iadfatrlneol()t2uoxo3nudlm nlnvia( aDum( o;o1olenifciadlm elnvpnt)tlxrircoo1laDraues s0srum(o3no1ol   nvs s) 2rmx ooo1oeeoioeild mDul(ms;u0arxoir oytfpDeluei;()teto(r nudal elivtat sDum(mo;t1optoifciasfs em( snt4 exrxr3oatoaD anvi;t  eur(r3nudam  mfvt s)a2rmumoot0oleoioctysla2ul(mo t4 eeoxfcootlaD lueolt srxoxr nu4am emnesas)a2taumoou1aleoio3tys sDuluvp;(4 eenmf oo1la r neo () etrir nodopt  ncs s)sDrrur ;t1olxn ocilt mDemu o t) ltomf3tytfmD  ieols) exrio3nydom e fcsa()aDtrxro;t1teeoifcilt aDel(mo u0trxrircto1omDeli o s)trxoxr3no4lm elfvtl()srrr(r no0ale iiciad mDul( s t) rtoxoctatoptraivs;()s2ur(r oydapte fetlsfa2taxr nu4aleo fctad s2ra(vs (4alxrmr3oo1oa  auvs;t s2xo(m3iudom   nct t)artmx p;o4tetomieiadlsDea( o u4trenxoctadlp e uvo t teurio iydolt  fetlt aDtr(m no1opeoio3tasfmDrl(mpnu4alermo ootlmtrai o s0srxmxr iu4altnmivsasfs2truro;o4tlt  f3iysfs eau s t4 eeoir3oatlat  ies (0s2uo(r3ny1ll  mieta() Durxr nt4alen iciltfa ean s t0 lxoircoatfmte uei t)truoxm nu4lm e fvtls)artru pnt4tlx mf3iat a2elumo;t4arenif3oadfpD lueo;s sruoio3nudoptnlnviat srua(moot0apen ocilsfa um(mo t)arxrmrcoo1omteluvol( texoiopnu4ol nlfeta( sDuau p;t4aexn ieiltfm eau pnt0 ltomf3oy1lptrlivs;t  2umxo3ou1lm elnvil()aDrm( oou4tlto ociys s um(mpnt4artnmf ty1lat livo ()setoxr oudomenlnctl(f rtaxmonu0ope  f3iatfs rau p t)trxnmrcoodfpt aivils0sruo(o ny4lmenlfvi t)arrmuro;u4tetnmociys sDuauvsnt) rtomr3totlp r ies;( srumir iu4openlicslt  2um(mpnt0olxniietls sDemnvp;u4treomr tydlm  lu o ()s2ur(o3ny1op emfcta(fsDurxmp;u0ope mieiysfsDranmonu0altnmrcoatlatr neols  exoim iy1lp nmiei tf rrru  ;u1apt io3iltls2rauvp u4 ltoio todfpD  ivi s)s2xr(rpnodopte ietat aDrmu ooo1tpe  feildfs2emump u) rxnxocoatla   nes ( trur(m3no4lptn fcils artaur ou4oet  ieilt mDea(ms u4tltoxrcia1op rli ilt0srxr(m3iudop nlncs sfaDuax  ;t0altnmoetld m umnmo t)alxrxo ia1faDrlu i;()s2tmimpnodlmee netlsf 2tr(  ;o4tpxomieias a ran snt4aleoif3tadlmtelues (0trtoxm nudlpt miet t) 2rrxm nt4oetnmieiytfm2rlnmp;u0teenmr oadfmtraivilt teumimpno4am   ietas sDtmuro;o1tpxomf3ilslm rlumont4teermfciytomDe ivs (0 rxr(rpou4am  mfcslt) 2tr(rpoo0tpenmietysfs emnmsn()texrxo3oytlmDraneo;t  exr(rpiy1ol nlivil( srtaxro;u4oet mfeiatls2el(msnt)teeriocoadlmt  ieil( t2urxr oodapenmnvi ( a2uru  oo0opxnmi3iasfmDemump;u0tetomr totlaD  neils)srtm(opnu1lmt mivias)aDrmurpoo0olx mietydfs ea( o t) ltnmo3to1oa   n ols0 eurxr nydam  mivsls  Dum( o;t0apt  ieiad m2um( s;() ltriocoatfmtranvi;()seurirpnodlptn fvils)srrrxr ;o4oeto ictys s2em(vp t0aexnxo iadlptrlnesls  rtoxopiydap   ivsls)s2taxr ;t0ole  f3tad mDeanmp;t)tlxnxo3tatfa ranvi;() rumir ny1amtnlneta(fsDrrumo;u4alxniieiydfm2umums t)trtrxfcio1omtelivo;s)t2ur(o3ny1apt  fvsa(fsDrau o;o1oeeomfeiytfmDelnmon(0 rtoxociydla elnes;t) exr(m ny4lp elivs ( srrrxr ot1oex iociaslm elnmp;t0 renmrctatomDe i s;t)tetrio ny4om emncils) Dta( ooo4opxnmf3iltls emu s;u0 lxoxocoytfmtr nvsls0 rur(m3oy1ll  mies sf 2tmurooo0opeoio3iyt m eanms;u4areriociatfmt  ieo s0 rtrxopoudop nlfvil(f rra(m nu0opxn ictas sDrmn pnu4aexnxrcoy1fmteanvi ()trxo(r nu1ale  nes s)arumur ;u1tet mfetysls2ulnms;t) rxomf tatfptrlnvo;s)srxrxr3nu4aptemnvsls)sDuaxmp;u1tlto i3ild a ulums;u4trxrir3ta1fatrluvo;(  2toimpoydol  mneias) Dtmu oou4tltnioeiatfsDem(ms;u4 etoxf3oo1omt  i i t0 rxmio3nu1ap  lneiatfaruaxront1optnmfcildfa umnvo u0 rtomo tytoate ieo s)sexmxo3nudop n iesls srrax p;u4apxomo3tltlm2rlu pn(4 lerxf iydom r u s t)seumimpiodlptnlivtatfaDtau  oo1tptoiiciaslm2rmump u4tlxnmf3tytfmD livi;t  2urxm oydlleemict t)a2tr(mono1olenmi3iatfsDemu s t4texomo3to1lp eaivols)s2xoxm oy1lmenlies t)srtau  nu1aet iocilsfs2rl(vsn(0teeomr3iatoatr ivils0 etrxr3ny4am  lnvsatf 2urumoot1oeenmoctysfaDelnvp;u)tltnmr tadlaDrlivi s sexm(o3no1apt lneiat) 2rmxmpot0aetnmi3iydlsDrl(mp u0arenxf3oatfp e uvil( tetoir3oy1op e nci t)srtaxrp;t0teen fcils m2umnvs (4 ltrxr3iytlpt li s (0 rumxo3oy1lpt  netl(fartm(  ;o1tpt mo3tadlsDelnmont)aeenir oodfp ranvo;s0 2umir3no4al  lfetl(  Drr(m ;t1tee ifeildlaDum(ms u4aexomr oadfat aies;t)srxmxmpoodlp eliesa()s2ua(mooo0olxomoeiytfs eanmsn(0 leomf3iatlatr ies;s) 2tmxo iydlp nlfeta()srrmx o;o0aptniieildfm2ulu p (4 ltnxr iydfa r nvs;t0 2um(mpiodoltn neil(fs2tmxmono4opt  octltls2ulums;(4tlermoctatoa  anes s)seuoxo3iu4om   icil() 2rmxmpno0texo ietatlm um( s;(4arxrio3ty1lmtelu ilt seurxopny1al n icsl() 2rmxm ou0tlt io3iytfm2um( s;(4aeeomoctytlaDeaies;s) etrxm nu4al   fvi t)artrumooo1tet mf3tydlaDul( pnt4 eerxr3iytlp raneols0 2um(o oo1ome lietas) 2ra( o;o4olto o3iltfsDeaumo;t) lerio todlmDe nei t  eur(m io1lltelnei s)aDtau onu0aee mfctatfa uaums u0aetoxfcto1la  ai ilt) rxr(m3oo1lle  ieta(  Duaurpnu1aex  feias a rm(vp u0tlermf3tatoptelues;t0truoim oudal n ict ()a2tmum ;u4alt  f3iasfs rm(vo (0 exnxr tydla raivilt t2xo(r nodopte nvs ( a2rmurpot1apeoioctydlm raumo t0aleoxf to1fmtrlu o (0t2tm(rpoo4am nlfei sfsDur(  ou1tptoio3ils sDelnvo u4 lxoxf3tytlmDeauvolt)s2umimpiodol n fcils)sDrm(m oo4oeenii3ilsfsDel( p u)tlxoxfcootfateaues s  2tmirpou1olt lnei t)a2tau o;u1tpx  i3tatfs ran p;()trenio ootlm   u ols)s2to(r3no1lmtn nctatfaDtr(  nu4aptnmictldfsDrluvsn(4trtnif oadfaDeaueils texm(o3no4llt lnet s  2umxr ou1oet moeilslm2emuvs ()aetrxocta1fm   ivi;t  2xrirpoy1lpte ies tf rrau pnt0oetomf3iat sDranvsnu) lxrmf3ootfpDeai i () exmiopnydllee nvs tfaDtrumpot4teeomi3tldlmDeaump;(0trxrmr ta1fmt  ues s0setrxo ou4op  mivtltf Duau p;o0aeeo fetyd m2rlu o;u)trxoiocoy1op rlueo t texrxmpoo4aleemnvtls  2uax  ;o0oex  octas s ul( snt) eerxo3oy1fp eanvo ()sexrxm nu1lle  iesasfarrm(mpnu0ope  ieils m2eau sn(4artnmrcio1fpt  u o s0s2toxopiu1lmtemieils)s2taxmo;u0olt mf3iad m eau o;()alermfciydom eauesl(  rtoim oy4apeemnesl(fs2taump;u4apeoiiciasfa rlnvonu)trtoio3ootomte uei;t  rxmxm nu1oleelnvsa()sDum(r nt0oex mo3tldfsDua( p;(4 rtrmo3oo1oat li sl() rum(o3io4ameemies tfaDtax  ;t1tleniicildfm2ean p;(0tlxrmrcio1lmt lu s;s0s2xmimpoydapte feta( srtm( o;t1olx iociatfm2rauvsn(0areomoctodfaD au o (0 etoim3oo1op   nvt (fa2rax ono0alx  feiytfm2ua(vonu4trerio3oadomDrau i;t srxo(rpoudlp   netas)a2tau o;u1optn ictasfs eanvo;()trerif3ta1om   nvsl( seur(m3iudlmeemnes t  rum( ooo0apeoiieias aDeau p;(0tltnircoatopt au o () 2umxo iy4lpt lnvtlt) Dtmx o;o4teeomoeilt a2umums;u4tetnmf iydoaDraivs (0 2xoxo oodlmenmiet s sruaxrpno1opxoifctytlm eauvp u0 eenmf iytfaDeli slt  rxoiopny4olte fet tfs2rm(  no1opeo i3iys s ra( p;t) etomf oydlm eaues;t)s2tr(m3ny4ol nmictlsf ruru ooo0tpenmo3tyd mDrmu o;u)aetnxr3iodoaDe ueo s)s2uoir3oo1ope mfct tf rraxr ;u4aeenmociaslsDel( s;t)tlxnxf todom e ueo t t2xr(o oudlltn fesa(fs2um(m no1apeoiocildfm ran s (4trxrxr3ta1oaDrauvo s0teurxr3iudaleemfetl(f rur(ro;u1apx mi3iyd sDrln p t)alxrir3ia1omDran i t0setr(opiydop  lnvt t sDumxrono0apto oetytfsDemnvont)trerio3iatfaDrli sl()setmxr oy1llenlncsas  ruaxmpou4ope ifetltla2ulnvo u)aexomf3oo1fat anvols0s2tmxm3iodamte fetltfs2tax pou4tlx ioctysfs2ua(vs;t)alxrif oo1fmDelneo;( tetm(m oodlme lfetlsfa2rmum ;u4aptnmicilslm uau o t4tlxrmo3oytomD  ivs s t2ur(o iodopt mivtat s2um(  no4opto f3tadfm ua(vp t0 rtnxo3ia1op eaueo ()s2urxr ny1omeemnes sfa2rrxmono0aet io3iydls2rlu ont4tetrxf3iytoat ai ils0teurxm oo4ll nmfct sfaDtax  nt0ope ii3iltfmDul(vp;(4 lerxf3oy1la elivo;t0 exoimpiy1aleemncilt)a2tmxmpnu4aeeomoeiydlmDrlnvs () lerxocoo1fmD  i i t)srum(r3ou1omt lncilt) Dta( p;u0aetoifctytfm rl(msn(0aeenxo3oo1oaDrlieil()srxmir3oy1amtnmncs s  Dtmur nu0olt  ieiytla2rlnvo t0tleomr oydfa r nei s)t2umim oy1om nmfviltfsDua(mo;t1opeoif3iydlaDrluvs;t4tlxoiocoy1la e ues;t) rxm(r3oydamenliesls) Dumuront4texoioctysfs2rlnmo;t)aeerxr to1laDrai o;s)s2trirpou1lpee feia( srrrxrpot4tpxo ieiyd aDemnvp;() rxrmocoytfateln s;s0 euoim no1ale lncias)srrax oou4olxo fctlsfsDem( on()tltrif3ta1fm  an i t)trtoimpno4lm nmicilsfsDrmu pot0alxnmo3tytls emuvp (0 renir ia1late i o;t teuoxm ou4omtnmnvt tfarumxm no1aex ioeild sDul(mpn(0 lxrirctydoat lnei ( s2xr(rpiudoptnmfvi ()aDrrurpoo1aexnmociyslaDelu s u4 renif iadfm e n slt srto(r3iodamte fei tfsDum(mono0opt ioetasla2rm( s;(4 etrxo3iodfpt auvs ( s2xrim iu4al emictls aDtru  ;o0alxoii3iytfsDulnmont4texomf3iotlmDrlieol( trxoxm oydoltn fvia(f Drr(m ;t4tlxn iciatfmDulu o u)alxomf ty1lmDr n i;t srur(o iy4optnlfvi t  rtaxr ;o4alt iieildlmDrauvp (4 exnifcia1fp  lu s;( s2urir3oo1apee ivilt)s2uau onu4aptoioeiyt aDulumsnu0teeoxf3iotom rlivs t0 etmir3nu1apte fvtl() rrrur nt4tptoio3ilsfa umuvo u)arxriocoadlpD au sls0teum(m nu4apen icsl()aDtmum ot4tlen fetatlaDrm(mp;u)altnif oy1fmDraivs;(0tetmxr3oy1lpenmfes tfs2rmx onu4oetnmoeiatlsDumump u4tlerirctatoate u o;t)texrxr nodol n nvtls) rumum ;u4oetn f3tld a rau pnt0 eeoifctadoptelnvi;s0 etr(m oo4ol nlietat a2ua(mo;u4texnmoeiat m ul( s;(4aetrircoo1lmtelu o;t  etmirpnu1ll  liesas)srurumooo4oeeomfciltfs rl( onu4tetnxo3oo1omtr u ils0s2umxr oo4opt  ieia() rtauroou1olxoii3tldfm2ulnmo;u4 eeoircto1lm elueo;t)setr(opny1ol e fetatf rur(mpnt1olxnio3iytfsDrln pnu4trerxr oodfa e ivil( srumxo oydolen net ()sDtmxrp;u1alt ifciytfmDra( ont)tlxoxocoo1oatran i ( s2trxmpoy1amt lncias arur(  nu4aleo f3tasls ean s u4tleoiociotopteanesl() rxmim3oy1lpt mfvs t arta(m ;u0openmi3tlt m2rluvsnu4trxrxo tatoaDelueo t0texoio no4optnmict (faDumxmpnu1alt  oeilsfa um(msnt) lerif3iadlm elues;s0s2urxo oy1lpte icias  rtaumo;t0oexo ociad aDum(vsn()tetrif3tytoa r ivo;(0seto(m iodol e nctas)sDraum ;u0tptoiieiys m2uaums (4 lxrmr3oa1fmteluvolt)seurxr3oy1altemivsl( aDta(r oo4olxomfcildfm ean p;t0altoxrciotopteli o;(0 ruriopiodol  mfvs ( s2um( p;o0apxnmiciys sDrau s;u4arxrxr ia1faDe u sls)seur(m iy4alenmfvi ( srtm( oou4aex ifctlsfa uaumo t)arerir oo1oat luei s s2uo(rpnu4lpt  iet sfa2ta(mpou4ale  oeilsfm2rmu s t) renmo iydoate ivs;(  rxo(mpiudom nmfvsl(  rtau o;u1aleniocils s uluvpn(0artnmrcoydfm eluvo t  exoir3iu1lmtnlncsl( aDtrxm ;t1tpx mf3iltfs2uan pn(4trenmr iydopD anvils0t2tm(m3oy1oltemfvi (f 2tru poo0teenmieiatlm2rlnvsnu0altnmo3ia1opDr uvs;()trtoim3iodamenmncils  2uau oot0tptn ieildlaDran s u0arenif iotlpt aieolt) 2uoimpiu1op  licia( srrrurpno1tlxo oeild a2emnmo t0teerxfcoadlaD an s (0t2tr(m nudal nmietlt) rrmur no0ole ioetldfmDemnvs t)trtrifctydlmtrauvi t)t2xmio3no1aptnlietas arurx o;t0oetoiiciltfs2uau pnu) exoifcto1opDelneils s2trio3iu1olen fvsat) rtr(moou0texo fctytla2ulnvs;u4 eeniocoydlp  aivsls)s2xrxo nodllt mncsa( sDur( o;o4tleomo3iasls umu ont0arxomo3ta1lp  livs;s teuoir3iu1al n fctlsfaDur(  no1tlt mfcildfs2umnmo;t) exrmo3oytoaDeli ilt)sexo(m nu4lptemnciatf Drrxrpnt1tlx  i3iatfmDelnmpnt)altnio oo1fpteliei t0s2tm(opoy4alt lnciatf rtmu  oo0tpxomf3tltfaDum(ms;() eenmo tatlpDrauvi t s2xo(r ou1lp n nvilt a2rru  nu0tex  fctysfsDra(vs u) renxrcta1oaD luvi;s texoiopoo1aptelieiat)s2tau  ;o1tpx mi3iadla2eau o t4aetrir todlaD aivils) exrirpio4lptemfvslt srur( pou4tetoifciad s2eluvonu) exomo iadlm r i ilt)tetrimpiu4lltnlieias)a2ta(root4oeenioeias m2rauvonu0 lxnxf iatfpD anvsls t2tm(m3io4am emietls  rrauronu0tetnioeiytlaDum( o t0texrircoatlaDraivo;( t2ur(o3iu4lptnmnetlt)a2uaxm nt4optn ietldlm em(mp u)texrxf tadlpt auvs;t0t2tm(m ou1om emfci (fsDra(  ou0opx iieils a rl( o;t)trxrircto1la eaivilt seuoirpoo4ole  fvt t arra(rp;t0aee mo3tatfmDuln pn(0trtnxf tytfp rai o;t)srxrxr ou4ap nmfcia( aDuau pno4tpe mociysls el( p;u0teenxociytfmDraiesl(0t2to(o3no4apenmnesasf 2ta(r ;t0oex mf3iltlaDemu s;(0trtoifcoydlateaneil(0teuoiopnu4altn nei sfa2ua(m ;o4tpe mieiasfa umnmo u)artnxf iytfm eluvi ()trtoxmpoudaltnliesatfarrrump;o4alxnii3tatla ul(mon()tleomf tadoat aivi;t sexmirpno4oltelivt s) rrmxm no1alxn fetydlm elumo ()tleoxocoatlmDe nvols  eumirpny4lm nmncsl( aDra(ro;o4oetoif3iydlsDumumo;t0trxrmo3oy1latrau i ()sruoir3oodap e ivslsf Dua(  ;u1teen icilsfs em(vs (4artrxo3to1laDr u il( sexoio nydap e nvtl( a2rr( oot4oee  oeiatfm emu snt) eeoxf3tydfm rlies (0sexrxo3nu1oltnmfcs s)s2ua(ronu4aleo fcild s emn snt0teerif tadopDr uvs;( setoir no4ol   ictltfs2ta(m ot0aee ifctas mDrlnvs t)aexrircto1laDrlu ilt)setmir3nudal elfci sfsrrr(monu1tlto octyd a um( p u4artnif ta1fmtrauesl() rumir3oy4amte fctatf 2ua( pnt4oltnmo3iysfaDrauvs;t4aetnmf iytfa  livils texoir3nu4lmte nvsatfsruaum ot1tlxn i3iydlmDrlnvo;t4alxnifctotoat  ieol( s2toxo3iodlpteliei sfs2rau  ;t4apxoifctyt a2ra(vs t4tetoxr3ta1faDe uesls trtmio iodoltemfctlsf 2tmxroou0aptoiietldla2rl( o (4aeerxrcoytop rai i ( sexmxopoo1alt mics s srur(m ;o4aexomi3ilt m2rmnvp;() rxomociadoaDrauvo ( setr(r oudomtemieta()sDtrumo;u4altniietytlsDrmuvpnu0aetrirciydlm e u i s s2toxm iu4alt  fvil(fartrxrooo4tlx  fctydls rmn snt)tlermo3iatoaDraues;s tetr(rpiydom elfvi t artmx p;u1texoifciydla2ulu o t)tltrio3ia1lptran o;t  exrirpoo4al nmnvsls srra( o;t0ape iieiltls2ean p ()tetoif3iy1fmt auei t0 rtoio oudapenmfcs ( a2tmxroot4altoioeils s rmnmsn(0tltoir3oa1lmD lneols) etmxr oy4ol emfvil()s2trxmpoo1aee mietatlm ul( s;u0trtrif oytlmtran s s)t2tmxr3io1lpee ici s s2tau onu4aeeoiiciltfs2elnms ()arxniociy1faDrluei t  rtoim3nu4openmfcs s)sDur( ont1tetniicildlsDrl(ms u4trxomfcta1lp   iesl(  rtoio oy4llenmfet ( aDra(mpno4oeeomfeiad m2ulnmp t4 eenxrcto1fmtrluvs t)srxrio3ou4openlfvsls artmxmo;u0openmo3iyd a umnmonu0treoio iatopDrlivil(0tetoxmpny1lpen fvt ()s2rr(mo;u0aexo i3ias a elu p (4trtoif3ootopDeli i s)t2tmxopio4ol nlicsls sDrmum ot4ope  fcildfs2ul( on(0altnio3ia1la ranei;()srtmxmpoy1ll nmivsls)srtaxrpot0aeeoioeiasls ulnmo u)alxnmf totlmD lnvslt  exrir3nu4olte nci sfa2uru ooo4tptoiiciadfsDeanmsn(0 leoio3ta1lp rau o s0tetmiopoydoltn fvsas  2tm(mp;u4tetnioeiltfm2rlumon(0 leoio totomtrln ol()teumxo nodlltelfvt sfaDrm(  oo4oexo oetlslaDel(vont4tlenxr tatomtelneo s0t2umxrpoydol nlfvsat  rrmump;t1tlx mociat mDumuvp u0texnmr3iytlmtrlneo;(  ruoxr3ou4lpee fctlsf rtrur nt1olxo oeiasfa rmu snu)arerxr3ootlmtelnvi s tetr(mpoo4aleelfcslsf rtrx ooo1tltniiciad m rl(vo u0tlxnxocoodlptr uei;s)t2ur(r no4al nlietl(fa2rrxmpot0oex mf3iltfm2umuvs;t)trtrif tadfa e n o;t)teuo(o3iodll  lnvsltf 2urxmono4oetoifeildfs ranmo;u0 ltnxr3oydom   u slt  2umio oydlmtemneil()sDra(rp;o1tee  f3tls sDulu on(4 ltomr3oatfat anvil(0srxriopiudlpe  nvtasfa2taxroou4oltnif3ias a2elump;(4trtoio3oy1lp r n s;t  exrim oudameemfeil(f 2rrumpot4tlxomfciydlaDulnvsn()tltnmf3tadoa e i i t)srumxo3iu1ape  fesls srrmumpno1aexo ieiytfaDeau sn(0tetomf oytoaDeli s s0seuoxo ou1lmtnlfcils  rumumo;t4olxoifetatfm2rln p u) etnircto1opDelnvo;s)srxrxr io4om n fet t) Drrumono4tptniocild sDrl(mo;u0arerxf3ta1opte nei;()sexo(rpoudomt mnci s sDumu o;o0tpx mi3tlslaDemu s;t0areoif3oydfaDe ivs;s)seumxo3ou4ome mfvtlsfaDum(mp;o0tet iociysla ua(ms;t0 eenio3ta1fmD auvs (0seuoxo oydal e ncias  2trumpot4oex mi3tatfa umuvpn(4 etoifciydomtelneilt) rtr(m no1am e nes tf Dtr(mo;o0aet mfciys a rmuvonu4trtomr tydlm ran i (0s2toxm3iudalt lfet s)srum(  ;t4aexoiociydlmDranvs t) eeomfctodoaDrluei (0tetmio3nu1omenmfct tfsrtaxm nt4tetn fctyt m2rmumon(4 exrmo ta1fmtelu s;t) rtrxr ou1om nmfvtlt sDtrurpnu4opt if3tltfaDrm(mp ()trxrmoctadomtr ivi;(0teum(opoodlptnlfvt () Drmxr oo4olxoiietys mDrmumsn()altnio iy1oa rln olt t2umxopny4alenmnvs t) Dra(moou1aee iociatlm rm(vo;(0teeomfcoy1fpt auvsl()t2xrim3oudap  mnctltf rrmur ;u1altnmoetlsfs elnms;(0aexniocoa1faDeauei;t0t2xoxm iudol e ivsltfa2ra( pnt1opxnmi3tas s eln onu0trxoxr ia1oat aivs s0s2um(r oy1ame livi sfsrurxrooo1tleoioetys sDrm(vs;u0arxnxo io1op raueols0 exrio3nudlptn netlt)a2urum nu0apen ictas a2umump;u0teeomf3tadfmt auvi;t s2xo(m iudlmee fesa( sDrmx poo0oee io3tlt aDea( o;u4 rxomr3iytfp e uvol(0teumxm oodll   netat aDrr(rpou4oex mfctadfs2uanms u0tleomr ty1opD lnvil() rurxopoodll  livi ()aDtm(mpno1olx mo3ils m em(vs u4areniocoydop  lueilt0seurxr3oydol emneil()aDurumpnt0alt mi3iltlm2ulnms (0 renmrctotfa rauvols)setm(m nu1lleemiesat) 2ra(r oo1tee mfeiad s2uluvo u4 ltnxo ia1laDrln s ()srum(m nodaleelfcs (fa2urxmpno4opxo fctldfa uanvp (0 etrmo3tydfpDraies;s0setrim3oy4ameelnctl( a2ra(rpnt0oeeoiicilt sDelnvp;u0texrmo oodfm  li i s)srtrxopnu1opt  fes tfarurx o;t0oeenifeiyd a2umnvs;(0trxnio3iytoaD luvo;( srtrxmpou4olt licta(f 2rr(mo;u0tlxn ictytfa2ean o;(0artrmfcio1fp e uvs (0trxr(rpny4alee netatfs2tax  oo4oee  f3ias a ul(vo u)aetnmfcoadoa eluvo () rxr(o3oy4oltnmnvi s  2urxmooo1apxn ictytfa em(ms (4 leoio3tatop  au sl() 2toir3nudoptn ncilt  2uaumo;t0texo i3tlsfa rm( pn(4artoio oydlaDrluei;t)sruo(r3ny1omt mfcsa(fs2rm(mp;t1olen fciat s2uln on()tlenio oydfp e i s ( seumxm3nu1lltn net () rrmx pnt0tptn o3tad sDuaumo u4 rxomr3totlptrlneo;( t2xmxopiu1lmte nci sfaDuaur ot0oex  f3tyd a2ea(msn(4 etoif tatom elnvols0t2xoir ny4aptn fvi ()aDurxr no1tleoio3tydfa uau snu)tlenmo iatomDelieo ( seurxrpiudop  lict sf Dtmxm ot0aptomo3tls a2ranvonu) rerxf iydfptraivslt)trxmir iy1ll  lfci (fsrta(m nu4apxo ictlt s rlnmonu0aleoio3io1laDe uvi s0setrxrpnydaleemnesas s2ua(moou4apxomociyt a rau ont0arenxf iatfmDe nvol( t2xmim3oy4lltnlncta( artmx oou4apenifeiydfa uaumo u)alxrmf ia1omD lneo;()srtoir3nu4llte ics (fa2ra(rpnt0aexomociad m2eaumont)altoif3oodop rluvols srxm(o ny1om nmfcsa()arrr(rp;o4opxomoeiltla em( s;u4 lxrif iatoaDeaies;s)srtr(rpoo4altn ivt sf rurx pno1tptnii3ild a2ua(vont)trtoifcio1lpDrau i;t0 exoir oo1op elfetls) 2rr(mpnt1aptomo3iatlmDraums;t4 leomf tytfmte uvsls0srumxo3nydope livilt aDtaum nt4apxomfeiytfmDumu snt)aleoiocia1fa  anvi (0setmxrpou4lmeelnetat)srra( pnu1alxnmieilt m2ranvp u)aetrmo3iadomDrlies;t0setrxo oo4lleemies tfs2tm( ont0oexomociltfs2rauvont)tetrio tatop  aivi t tetmxopio1opee nvsls s2tmxronu0tlx ifeiydlaDrl( p u4 rxoxr tytlmt lneols)s2xrxmpnu4ll emnetls)s2ta(m ;t4olen ociltlm2eau p u4 lerxf iatlm rauesl()srum(opny1omtelies ()s2tmx ooo0tle  f3iltfs2ulu o (4tltrmfcoy1omt luesls trxmxopnudlmt micil( aDrr( o;u1tpx io3ildfm2el(mo t)aeenir3iatlatelnei ()srxo(opnu4al e feil(faDtmuronu0tptniietad mDrl( snu4aeeoifciytfpt aivi t trurxo iy4ap nmnviasfs2tax  nt1ale ifciltfa2ea(mo u4tetrxr totfpteai s s0 euoxm nudlle livi () Drmurooo1apxn fcildfsDrluvp;u4 lxnmfcootop rli il()trtrxrpno1ll e fvs () 2ua( pnu1tpx  feiyslmDulump;t)tlxomo oytlpt lnvs;t)texoimpoy4op nmnvilt aDrm(r ;t0tpx  o3tatfsDemnmsnt)trxnxr ootfm rauvi;(0srtoxo3oo1lm nmfesl()arrmum nu4apeomfeiyt a emn s;u4treoio3oadoatrau il()texmxr ou1apt mfvs sfaDuaur nu0oetnmo3ias sDum(vs;(4aeenif oytlpt livi;(0srxmio oy1oltemicsl(fs2rrxmonu1ope  fciadlm2ean pnt0trtomfcia1fmtr ueslt0srum(rpoudal nmfctasf rrmur ot4tlt io3iaslm ra( o;t4texnmr oodopD an ils seurimpiodll elfciltf rur(m ou4teeomfeiatfa2emu p t0 eerxf tatfa   iei (0sexm(m iu4ll e ncilsfs2rau o;u1opt mi3iytla ulumo t0trtomfcty1lat  ivo;t) rurim3ou1optelneil(fartmur nu0opxoioeiys a2eanmpn(4altrxo totlmteln olt) exmir oo1al nmncsa(fsrraxmo;u4tleomieils aDul( p;t)trermfcoo1lp  ai o;s)srtoxo iu1amtnlnesls a2taurooo0oee micilsfa2ean on(0 ltrircty1lmt au i;t texrim iodam elfei sfaruaxroot0aeeo i3tltlmDrlumo;u0texoxocoy1late i o t0 rto(mpou1lpt  nct () 2tau  ;o4olenio3iasfmDumnvonu0aetrif iytlpD  iei (0 2trxmpnu4ll elfes s  2rmurpno1tptomi3taslsDeaumpn(4trerxrctotlmt aneo;t) rxr(m nydlmt  ivsltfsrrrxm ;o1aeenii3ias s2ul(mo t)alxrxf tytom r n il()seuoirpnu4lpee fcta( sDraurp;t1tlxomoeiat s2rm(vp u0 eerxrcootlmDrlivo s  2xmirpoy4openlneilt) rtrur no0opxo o3tlt aDumumo;()alxrmr3oytla rlu sls tetmxmpno4lp nmieils)aDrmurp;t0alen ocils s2el(vont)trxrxocoytlpteln o;(0t2urxmpny4ll emfci t)s2umu oou4tleomoeiys s2rlnms;()aetnxfciotfp eaiei;(  rur(mpiudam n fvtat)aDum(mpno0tltoioetys s2emnmpnu4areoif3ia1fa e u s;s0texm(r3nodlp nmfeta()srra(ronu0aexnmieiadfm2uan o t)trxnir3io1fmDelnesls0t2toxopny1lp elnctlt s2rrx p;o0openii3tysla2eauvo;u)tlermrcoydom e u i s srtrxmpiu4lpt mfcsat  rtrxm nt1apeniiciysls2el(mp;u4tlxnifciydopDe nvol( srur(opoo4lme mfctlt sDrm( pno1aeeomfeiytfm ea( ont) lxnxo oy1fatelu i;(0sexrxmpny1optnlncilt)sDta(mpnt0olx ifeiltfs umuvp;u4 exoio todfmtranvilt) euoxo no4lptnmieiat srumx  oo1alenmi3tysfa2rauvs u)tltrxrciatfa  lnvs (0tetmxr ou1lltnmietltfs2rruroou1tle ioeiatlaDrm( pn() etnmfciatfaDrluvs;t t2umim oo4ol  lictlt)aruaxmp;u1aetnmfetadlsDra( snt0trenxf oa1oat lueo;s0texmxm ny4lleemnvsl() 2ur(m nu1olx iiciat m elnvont)altnmr3oodfp   nesl( setoxo ou4omen icil(fa2uaxr ;t4ape ii3iadla el(vp t4aetoifcta1lmteanvol( setmio3oodol e ivi tf 2uaurpnu1aex mieiadfs2ean snu4 etoif tydfatr n sls)t2uo(m oy1lptemncil( a2tax ooo0aetn o3ildfa uaums u0 exrmf3io1lpD ai ol( trtmxr ny1al  miet s)aDtr( o;o1tpe ifeiad mDrlnvon() lxrxf3to1lpDrluvil( trumio3oydlme lnct t) Durxrono0ole moeiydfa ua(vp (4 ltoxo iodop elu o s0 2umxopoo4altemfcil(fsrua(mo;t1tpenmfeiydfs2rau on(4 leomr3iytfmt an ilt0t2xo(m3nu1al nmici tfa2ua(mooo0aee mfeiaslsDulnms t0trxomo iytlp  lu sl( s2xm(o oy4al  mncsa() rra(ro;u4tleomoctltfmDrlu s;t0 rtnmr ty1lm  an slt srurxo nu1lptemfcsasfarrrxrpoo1aexnif3iydfa ulu ont) leoio oytopD  nei (0srum(m3oy4ol emfeta( a2rm(rpno1olt ii3tldls umnmsnt) lxnmf io1fp  anvi t0t2umimpno1lm  mnes t  Dumxm no0tleomoetaslsDra(von() rtrif tydoate n olt)setr(m iu4olee ictl(fa2tm(root4alt mfciyt aDrluvs t0tleoio iatfmtr nvo s0texo(o iydol e ncs (fsDtru  ou4tee  ociydlm rluvs u4tlxoxfcia1oa   u o;t)setr(opnydaptelnctatfsrtaur no1tpenmoeias s ulnvsnt0 rerxf oytla e u ol(0s2xrxo oydomtn fctas s2rmxr ;t0tpxnio3iyt sDum( o ()trenio3totfpD  uvsls0t2uoimpiydame  icsltfs2tax  ou4tlxniieias a2ra( p;u4artomr3tadfatraieo s0srtmxmpoy1alt  fet (farrrx  ou0tlt  oetadfmDrlu p;t)teenxfcio1fa   uvo;s0 2xoxm oudlleelivi s) rurxrooo4ope  i3ild mDumnvp (4aetoircoa1omDelivo (0seumxo3nu1altn fvtls sDtru poo0tlxo icildfmDrm(ms u4aetnxo3totoatr ivilt0trtr(m3nu4op e fvta()a2tr( p;o4oee  f3iysfm ua(mp u) exrmrciy1opDelivs;(0srtmxo3oydopenmieiasf rrmum ot0aetniicias mDem(vp t4trtrxf3ta1omtr n i;t t2xm(opnu1ol  mfvsas)arururont4oee  i3tatfmDeanms t0 lerxf3tatfmD lneo;t) eto(m3nu4lp nmfcilt  2ta(rp;o1oexomo3iatlaDuanvo t4tltnmr3iydomteaieo (0tetm(m3nu1amen neslsfsrurxro;o1tle io3ilsla2emump t)trxnxr3oo1fa elies;( texmxo3iy1lm e ivt t sDrr(  no0aeeomfetat s2em( s u4tetoxr3iodlateai olt0t2uo(rpiy1op  lfvsls)aDumu oot0opt iiciaslm rau s t4tetrxrciy1omteanvs t s2uoiopoo1omen fctl(f Dur(r ot0apenmi3tlsls2umnvon() etrxf ta1oate ivs;(  rxr(r3iodapeemfct s s2rru oot4altomo3iydlmDuau o;() lerio ia1laD lu o s0srum(r nudome mneilsfs2rm(mp;t0tetn iciltfa2rl(vs u4alxnxo ty1lpDrlu s;() rxrxr3nu4lp nlfvt tfaDrrumono4aptnmo3iytlm2rmnvp;()texomfcto1fm raivo ( trtoxm nu1omeelnvil( sDuax oou4opxoifeiaslm ua(vsn(4tetomfcta1op raivsl(0trum(opiy4ap elivs tfsDua(r ;u1aee  oetydfs elump u0 lxnio3iy1fmt au s s)truoio oo4ame lfcils  2umumo;u4oet moctadlm2emnmp;u)aleoir3iodfaDeln slt trumir3ou4lle licsl(  2rrxro;o1tet ioctatls rln s;()aeeomrcoadfa eli s ( srtoxopoy4am e fcta( sDuaxrp;t0tptniieiatlsDeau p ()texrif oatfptelues t  exmiopno1lm nmietl( srururp;o4olenmoeiys s umnmsnt)trtomr3oatoaD aies;s0srto(o3iy1lmeemietatfsruax oot4oet iieiadls ra( ont0trtnxo3oydlpt au ol(  ruoxm3io4omeelfetl( sDtrxmpnu1tpe  o3iys mDrln o;u)tetoir3tytfa ran o;t t2xrim nu4lpenmneiat  2raxrooo1aet ifeiyslaDulnms;(0texomrctadom raneo t t2umio iodlp  mics sfs2ta(mo;t0opx mi3ildfm2ulums;(4artoxfcoydfmDelivol()trxoxo3ou1amtnmneiatfarrm(ront4oleomo3iad a2ea( ont0aetoifciydfp elies s)sexoxmpoy4lp elies t)srur(rpot1ope  i3iasls ean p t4trtrirciydom   ieslt  2tr(o nudal   ncsl()srua( p;o4apt ifetat m uanmp;u4treoxocoa1oaDr nvi s0srxmiopnudomenmnct t  2rmxrp;t0tle  iciytfmDumump;(0artrif3tydlp ran s;()seur(r3oy4altemfeils arrru o;u1oetoio3iasfa uluvp;u)teermr totlaDeaneo (0t2xoxo iodalt mnct t srtmxr ;o1optnifeilslmDem(vpnt) ltnxf3oatop e u sl(0trumxmpnu1ap nmneiasf Duru ont0opt ioeilt mDul(vo ()arxnxf iadoaDeaues ( s2xrxrpnudol e nvsls aDumxmpno0tpxoifctasfm eau p (4artomr ia1lpte n o t  rtmiopiydlpenmfcs ()s2rmu o;o4teeomfcils mDumnvpnt0artoxo todfpD auvi;(0trtm(mpoy4lm nlnetltfaDra( pnu4apt io3iys s2umu o;u0 leoxrcoadoat  neo s texoim3iu4lp e fcsl(farua( oot0alt io3ildfaDea(vp ()alxrxoctadoaDr ies;s)texr(r nodlm elfvi s artax pnu1olxniictltfa elumo (0trtnioctodlm  au il(0 rtmxmpoy4om  miet t sruru pot0alt miciydlm2ua(msn(0tlxrxocoo1fmD aues;(  eumim oy4omee fet s)sDtru oot0olenmfciysls2rau s;()tetnmf oy1oaD  nes s0 etmxo3ny1lleemnvias  rumx ooo4oex miciydla2uanvp u4 lxrir oa1fateauvil() 2tr(o iydaltelfeias)sDtrump;o4ope  octat mDea( o t4tlxniocty1oatr ies ()t2umxrpoo1al elfei s a2ur(  ou4apt  ictysls rm( p t0trtoif iy1omD lnvslt0s2toio3iy4oleelfesa(fsDtm(  ;u0tltn ieilslmDran o;()trxomr3ty1op  lnvs s0srxriopiy1apenliesltfsrrrx pnt4alxo i3iltlaDuanmpn()teenmrcio1fptrau o t0t2uriopio4amtnlivsas a2uaur ;o0tlx moeiadfmDeanmpnu4arxoxoctodlp  ln il(  rxoxrpiudam nmivt ( aDurx pou4tpxoioeiatls rauvpnu0 rxrxrcoadoat  n ils0s2tmxrpoodamtelfcias) rrr(m nt0olxoii3iasfs2rau ont) rtrmrcoytfp  lu ols)setrxrpiodlmeemiciat)srrmumpot4opx mfeiad sDulu ont)aeeoxo iy1lpD aueol(0trtrimpoudlmtnmnctls)srtrxr ;u1altnmieiltlmDrlnvs;(4trtrio oadlp elies;t sexmio oy1al e fcias  rua(rpnt0aexnifeiadfsDem(mp;(4altnio3ta1lp e n s t0 rtmxopno1am   nvi tfsDum(roou4olxo ictld a2rm(vs;u) etnxfcootlmte iesl(0t2xmim oo1ll elfvs sfartrx pou0olx  f3iat mDem( p;(4aetrxr3tytfm raieo;t0srxr(m oydalt lietat)a2rm(m ot4open ociydfa ea( p u)areoifcootlpD  ieo t  2xoxopou1ol emivtltfaDtmxmono4tex  fciyt s2rm( o u4aetnmf3ty1oa  lueslt0seuo(opiodlptemivsl()srtmx  oo0olt  i3tldfa2umuvp ()aetoxo ty1oa ean ils0seumxo3iy1opt lictl(f rumx  ;t4tee mf3tlsfs2eanmp u) lenmocia1omtr uvsls  rtmxo iy4optnmfetas s2rmumpnu4opx  o3ildfa el(ms;u)arerxrcia1opDran ol(  rto(r nu4ol nlieil(fsDrmurp;t4olx mieiltfmDranvs;u0 lxoxf3iotlm rli ilt0seumiopoo4ol
\ No newline at end of file
@@ -0,0 +1 @@
+nes;( seuoxr oy4ol e fet ( aDtaxmont0oex  fetydfsDumu o;u0 lermr3todopD li o s  eurxm3io1ap nmivils s2trx ono4olxnmo3tadfa ea( o;(0trtnxociy1fmt lnei s) rtr(r3iydap nmnci ()sruaxmooo4opxniiciatfsDrmn p;t4alxomfcty1fpDr n i t texr(r iudlmeemivil()a2umx o;o0ole  o3iadfa rlump u0alxoif3iodla  aiei;()t2trxmpou1llt  nvtas  Duauroou1alto o3tldlsDumnvp u4aleoxo3tytoptrln i;s) rxoim3iu1omenmfesas)srtaxm nu0altnifeildlm rm(vo;u4arxoxo ty1fm ranvilt sexo(r oo4ame  iciat)a2tru ooo1aex iociatlm2el( s (4tltrmf3iatfaDrlu o s t2xoir nu4ape  nei tf 2rru o;u1aptoioeildfm ul(mp;t0 eerxo3oo1laDe n sl(0s2trxr iudope  fcilt)a2taxr ou4alen oetldlsDumnmp ()aetoxr3io1lmD an o;( texoxr oo4omeemfeiatf 2tauront0altn f3iatlaDrmn o;u4 rtoif3iatfaDrliei () eurxm io4ll emivil(f 2ra(mpno1tee ioeilslm2emnmo;u0arxrio3todopDelivo;s0t2uoim iu1ll n nvtasf Dtaxm nt1tpto feiydls2elu o t0tlxnir iodoa eanesls)srxo(m no4lp  mnvtls  2ta(rp;o1alt mfciydls2rlnms;(4texnxr3iy1lp elu o ( srtoxmpny4lm  liei ( srraxro;o4aleomietadlsDranvont)trtoxociatla raueolt0 exm(r3nu4opt lietas)artmx  ;o0olx iietasfsDemumont) ltoxfcoo1fat ln slt t2xmxm nu1omtemneta(  rurxr ;u1alt mf3iysfs2rm(ms ()aetrmo3io1lptr uvo;t)tetrir ny4alee nvsa(fsDrmx p;o1tptn f3iadla ul( pnt0teerio ia1lateanvo s) ruo(r iy1ap   nei t artmxm nu4tlx mf3ildfmDemnms;(0texnxr3ty1latrai ols t2tr(opnudam  mfvsl()srrrur ou4apxn iciytfm2umu p (4altnif3iatfpDe ieil() 2to(rpoy1opte ietltf Dur( onu0apeoifeiysfa2uanmsn(0 lenmr ta1lptelivi s0 2tm(rpnu1llenmfcias)a2ua(m ou4tet mocildfmDeau o (4 exnxf oa1omt  neols) rxr(o iy4llt  nctls)srrrumpot1aetn o3ild sDranmo;t)trxomrciy1lptrai o;(0 2xmxm iodomtnlnct ()srumx oou0oexoif3iytla2ul(vont0teerxo3oa1op rau o;t) etoio nydlltelietls)a2tr( o;o0opx  ietyslsDrl(von()artoir tatfmDeaieo t) exr(m3no4lm n nesa(farraxmo;o1oexomieild s emuvsn()teenif3oo1lpD  nvo;(0 2urxmpny4apenlncsa( srrmuro;t0alx  fcild sDrm( p;t0alerxfcoodomD au o;s0 2to(mpio1ope  fci s sDra( ono4oetomociysla2emnvs;t)aetomocoy1laDeau o s0t2uo(r oudamtnlictl() 2rr( o;t4aleoio3iysla2rln p u4 rtomf3ty1latr neo;s)srtoir3iu4openliei ()sDtm(ro;t1teenioeiydfm2rl(mp;u0 exoxo oy1op   nvi;t sexmirpiu1am nmnesas sDrau onu4oet io3tadfmDemnmpnt4arxnxr oatomtraivol( srxoxo iu4apenlneils  2trumonu4oleo oeias s2el(mo ()trxnmo3oa1fm elu s;t0texoxmpoy4lme  ietl(f Dtm(rpnu4openmoeiltls2ul(vo u4aetomo iydoaD luei;()trtr(o3ou4ole mnci s srua(  oo0oleo f3tlt m rmuvp ()treoxf3oodom  auvo t setm(opoodlmenmictas aDtrx pou4aetnmoeild a2emu s;u0 eermr3oatoa  aivsls0srxoirpou1omeelfct t  2rmu ono0tltnio3ils sDrmn s () rtnxf iydlmtraivi;s0 2xrxrpoydlptemfvtlt)artm(mo;u0tpe ioetltla2ul(monu0trtrxociodfmDean i s) rtmim nu1ome lncia()aDumxm ou4tpxn octas m ulu s;t)tlxnxo tatfmDrli o t)tetmxopoy1ap nmfvsasf ruaum nu1oexnmo3tas m um( on(0trxrxr3tatoaDe ivo;s0s2toxo iodll  lfet sfaDtrumoot0tex mfeils a2rlums (0 rtrmr3io1latr nesls0srumio3ny1lmt mnei tf rtaxm oo4apt ioeiydfa ulums u)arenxfcoo1lmDeau o t0seum(r iodaltnmietls  Duru pnu1oee  f3iasfa rluvonu4tltrxr ootlaDe ueo;s trum(o iu4llte nesls  2urxmpoo0apenmicilsfs ea(msnt4 rxnxf iotomD anvi;()t2tmim oo4amenlnvta()aDtaxr oo4aetniicias s2umuvpn(0tetrmr3iydfaD  ies t s2trio3iudaptelfcia( sDua(monu1apenmf3iltlaDrluvo t4tlenio3iotlpD  ivil( s2xmio oo4altelivtat)srur(rpoo1tptnmi3iytls ul(vs (4trtrxr3tytfmDe n i;s) 2xrxm io4amtemnct () rtrx poo4tee iiciat s emn s (0tetoxo3tadlp  aivs t texm(o iydlpenmfct s)aDtmur ;o0aexn fciadlm ranms;t) rtrxf totfptraieil()truoxm oy1ome  ivslsfsDtru onu0apeo ociys a2rl(ms u) exrio3iydlm  auvi;s0 2xo(rpoo1ameelnctas)aDtmu pnt4teeomi3ias m2ua(vs t)teenxr3oo1fp r ivi (0s2ur(m iudlleelies s s2rm(rp;o1teeomictldlm rm(ms t)trxrmo3iodlpD aiei s  2trxr3no4al nmfvs ()sDtrumo;u1opx ii3tat aDra( s;t4altnif oodom  aiei;s0trtmxmpiu4lpenlies (fs2umum ou4olto oeiys a uauvsn(0 leriociodom   ieslt srxr(m3iy1op emfvia(  rrmu  nt1aee iictld aDuanvs (0teeomocta1lpteau s;t0truoir oudlpeemfeiasf Dtau p;o1oet mo3ilt mDranms;(0alxnxr3iy1lmDeauvs;t)srxo(rpio4am nmiet t) Dtmx onu1oexoifctlsfaDumnvp;u4alxoircto1laDrluei (0t2uo(mpoo1ol  lfcs tf Dtru  nu0ole ifciytlm2el(mp;t)trermr oo1la ran sl( teur(rpiy4om  mfes (farra(r no1oeenmoetld m eau p;u4aetnxrctydfp   nvils)trtrir3nu1olenmfvsat sDuaur nu1aet  oeiadlm emnmsn(0artoxfciadla rlieslt0 exrio io1llt mics tf rrmxmp;u1oeenifeiltlm2um(vp t4tleoir oy1fm  an o;s0s2uoir3iodoleeliciatfsDra( ono4aee  feiadfsDrau s (0 lerxrciydlp  aneo;t  rtoim3io4optn nvt s)aDtmx oot1oleomietas a emn snt)altnmrctatlm  lnei () eumxo3ou4amtemnvia()sruaxm ot4oltomoetys sDulumo;(0teenmf3to1la ranes ()srxrir nudal nmnct (  2rau o;t0alenmieilsfs rlumpnt)trtoxr tatlmDeau il(0srxmir io4lp e nvsl(  Drm(m oo1tleomoeiydlm2uaumsn()trtrmr3ty1oatelneo t teumxm oodlm nlneslsf 2ua( oou1oltoiieildlmDuanmo;u4 eenxo3oo1fm eaueo;()t2xoxo3nu4op emnctlt)arrmum oo4aexnioeilsfa eln p (4 lenxr iy1lmDr ivs ()trtoir ny4lltemfcsa( srumu  ;u0altoiictysfa2rl(mon(0tltrxf tadfatraies;s0srumio3iu1ame  nci s  rtm(mp;t1tpxnmf3iatls2rlump (4aeermrcoy1latr ivs;( s2tr(r iu1lm nlivsasfa2ua(m ou1opeoioetat m ra(vp;u0 etrioctatoatrli o;t  2tr(r ou1lle mivsas)s2ur(  ;o4oee mi3iltla ran snu)alxrir3iydoptr iesls)texoiopiudaptnlneiat)artm(mpot4aetn ocilsfaDumn s;() exrif3to1lat  ues;() etm(rpnudamtnlnes s s2rm(rooo4optomo3tydfsDumnmo t)trxoioctadlptelieilt  rtmxmpnodomte ncsls a2rrxm ;u1olt moeiydfs2uan o;(0altoxocoodomDeaies;s srto(r oodlpt  iviat sDrm(ront4oltoifciyt sDranmp u)trxrmrcoy1laD  ueo (0s2to(m3ou4oltnmnctas)srtmx  ot1apxniieiysfs rmu p u)trermo iadfa  aieolt)sexoim3oo4apenmnct t  2uaurp;o4tleoiieild sDem(mp (4tleomf iadlaDran ilt  rtm(mpoodlle lneiatfartmxr no4oee mo3tysfa eln o u4trxnxf3iydlp e n o;t0 exrxopnudlp elfvi t)srrmur ou4altnii3iadfa ea( s (0aeeoxo oytfpD anvilt s2xrirpoo4omeemietlt)aruau  ;t1alenioetlslmDranvs;t4aexnif oodfm eauei t0trto(r oudoptn fvs t) rta(mpot1tet  oeiadfs ea(mp;t4teenmfcoydfm  aueo;()setoir oo4ope mnciltfaDumum nu4tpxomfctytls2ranmpnu4trerir tadfmDraueo;( s2xm(opiy4omeemfvil() 2rm( p;u0olt ii3tlsla2ulu s;t)texoxrcoa1lateluvsl(0t2uo(o3ny1amt mfcsls  rrrur ou0apeomiciltfs uau s ()texomfcootom   i ol( srxoxmpnodllt licia( srraurpnt4tleo f3ilslm um(vo t)aetrmfciotlm raneols) 2tm(mpnydlpeelnvtl( a2ra(  ;t4tpeomo3ias aDrln s t)artnmf3io1oatrliei t seumxm3oo4lltnmfci () Dtmumpou1tlt mfetas mDel(mo u0tltnircoodfmt livi;t) 2tm(rpou1lp n fcils) Duau pnu0opt ifcildfmDemn o;u0 eeoio oy1oaDr ues t0 rxr(o3iudale lfvs s)artmxrono1alxomfetld m2rl(vonu4trxrxfcootfp ran s;s  euoiopiy1altemfctls  Drr(  ;u1aetomi3ias a2emnvo;u)aexnmfctytoate nvi s)srtoim oudlp n nvi t artaxrp;o4apxoiocildfa el( pnu4alxoxf oodfpDr nvo t)sruo(mpnu4lp n nvs () rta( p;t4ale  i3tadls em( s t0 rxomrcoa1fm  anvi;t0trxrimpoy4alenlfcsatf ruaxmpoo1altomieiys a2umn s t4aeenxf oy1fmD  ieils  2xrio3nodoltn fvs t  Durum ;t0tpeo o3iysfsDrm(msnt)aetnif3tydfpt  nvi;s0seur(opnydom nlfei s aDtmxr nt0aeenmfetat m eaumo (0trtniociadfm  anvo;s0sexoxm oodllee nvtl(f 2taumpoo1aex moeiytfs2ran o;(0 eenmocio1fp eaivi t seurxr3nudal nlnesl( arrrx ono4tlx ifetasfm rlu p u4 reoxr3oytlaDr nvil(0 2xr(o3nydop   fcs ( sDum(m oo1aptnmf3tadfsDulnvp t)tlenircoadfm rai o;(0 rtm(mpiydop nmnvs sfs2ur(m ot0olt iociys a2rmnvsnu) renircty1op r nei;s0 euoim ou4omeemivs ()s2rrx ooo1aeen f3tas sDuln s;t0tetoxr3iydlat  ivol(0 2xoxmpno4lp  lies t)srtm(mpot4aeen o3iadfm2eanvo t0aexnif ootfmtrau o ()sruo(r3oy1omen fet s)a2uaum oo0tet ifciyt mDel(msnu0tleoir iotopDe nes;( texoio oodale mfcsa(farta(mono1aeeomfctatfs2uaumon(4aetoxrcoadfmt li o ( srum(opou1alt  net t sDtmx  oo1apx  f3iys m2rm(vs t4 rtrir oytfp rlueo s)srxr(mpiu1lm nmfeia(fsrta( o;u1alxomfeiyt s um( snu)trxnifcoytlptrli ilt) exrimpnydome miei t a2rmump;u0teeo oeiydlsDuaumon() rtoif iotomDr i o;t)trxo(opio1al n fvs sf Dtaxmooo0oex mfetadlm2rl(vo u4 eeomf3oadomt li s s)t2xmxopny1opee nvta() 2urxrono4alenif3iadfs ranvs ()tetrxo3tadfptr u o s0 rxm(o3no4apt  fvsatf Dtm(rpoo0apxo ietldfaDelnmsnt) rtnmo ia1lat ai s (0s2tr(m3ny4opeemfct (fs2ua(rpno0apxn ieiatlm2em( p () lxrxf3oa1fp r ivs;t)sexoxr oo1ome mfvta( a2tr(ro;t0tpe mf3tad s ea(mp;u0 rxnxo todoa elivi ( s2xm(m3no1apee nesltf 2rr(mono1apxomo3iyt mDrm( o u) rxnmo iadop  lnvs (0seumxopio4apen nvi tfsDtau ono0oltomoctadlaDrm(ms;t4 leoxociy1om e u i;t)s2umir oydamtnmncs s s2uax o;u1aeeoifetasfa2emnvsnt)texrxoctydopDrau o s0 2tmio3oo1open icilt)a2um(r oo4optn o3ildfmDemums (4trxrio to1lmD lnvi (0sruoxm io4ome  fci ( arrmuro;t1open i3iasfsDumnms ()arxrxr3ta1la  aieolt) rurxo iy1ol emneiatf 2urx  no0ale ifetasfm umumpnt0texnmfcta1lpDeln ol()srumxo oo4om   nciasf 2urump;o1aexomociys a rau snu0arxnmf3ootfa r ueo;( t2uriopny4aptn nei t)sDuau pnt4tpt ifeilsla2rau s;t)aetrxfctydlp eauvi ( srumxr io4om nmieiasf 2ururpou0oetnmfciyd m umnvp;u)teermf oa1fat an slt  rtriopnu4ol elnvtltfa2um(r nt4olxomi3iadlm2rmu p t0altrxo3oatfpDeauvo;t s2xoim3no4lm nlictasfsrra(mp;u0opx ifetlt sDum(mo;u4tetrxocoatom rau i;t)srxoxrpiudaptelfciat a2rmxrpou1tee  feiydlsDuanvs (0 ltoxfctytfat  uvo (0t2toio3no4oltelnctl()srrmum ot0apxnmiciad mDrlnms t4 ltrmf oadoat ln il(0trurxo ny4ll  mietl()aDrrxr ;t1tpxomfciysfm2um( snt4tltrxr tytlp  li sl(0trumxo3ny1op elnvslsfartr( pnu0opxomi3tlsfa2rauvsnt0tlxnir tytlm elnvi (0tetoiopoo1llenmncs tf 2uru o;t0apxn ieiltfsDea( on(0tetoxr oadfmt liesls0srtmxrpou1alte ivt ()s2rrump;u4oleomo3tld aDeln onu)alxnmr tadfmtelnvs;t0 2tmxo3io1om emivta(faDur(rono4ape moeiysfa2emnmpnu0alenmocoy1fa r n i;( s2urimpoudlp   nci s)sDtru pot1aexo i3ildlsDua(mp t0 eerir tadfmD lu i;t trumim oodomt liciat a2umu ont0tleo feiydls2eanvpnu4teeomr iy1oa e uvs ()sruo(m3iudom   fesls sDtmu  no4aleniieiasfsDra( o t0alxoio3iy1fpDelnvo t)seuoimpny1apte fetl()a2rm( onu1opto o3iydlm2elums (0trtnirciatlmDelieol(0seto(m3iu1lptnmfci ( aDtax oou1alx mo3ildfs2emnmo;t) reoxr3iytlpDeaueo t0srxoxo ny4lmenlncilt s2ta(mp;u4tpx  fcildlm rmu p t4tetrmf3ia1fmte uvs;t) 2xmxm3oo1lptn ivi t)a2rmum no1opx  i3iatlm2emnmo (4 exrmfcoodlmtrli sl(0tetmirpnudllen nvtasf 2rmxmpot0ope ioctldfa rluvo t0 etnmo3iydla   i s s)srtrirpny1llee ivsa( s2tau o;t1tpx io3ildla2ea(mo;(4artrxo oatop  aieo;t) etmimpiu1oltnmfctl(f Dtrx  nu1olto o3ias a2rm(ms;u0aetomfciytlpDrlu sl() rtoxrpoo1oltnmivilt)srtr(r no0opt mi3iadlsDeau sn(0 etrmo iydfmDrlu ol(0sruoxo nudalee ietls)aDrr(  ;o1alenifeiytlaDemnvo u0 etrmr iy1laDraiesl( s2tr(r oodal nmncsat aDra(mo;o0optnii3iyt a uau s;u4arxomo3tatfmtelies;t)t2um(o3iu1lptnmfetas)sDra(mo;u4tlt  ocilslm2ea( s t)tlerxf3tytomDr i i;(0s2xoirpio1openmfvsasf rrmxront1tet mieils m ea( s;u4 rtniociy1fptr n i s)srtrxrpny1amtnmnvi s) 2rm(r ;u4alt  i3iad sDea( o u4trtniocoodlmteanvi;t0t2tm(opiy4apt lfvilt)a2ta(rono1ope miciltfmDra( o (0tetrxrciotfmD an i t0 etr(mpio4openmnci tf rumurpno4tpto i3iyt sDeauvs () etoif iotlaDrau s;t)sexrxm3iu4ll elieia(  rrmu p;u1texnif3iydls2uanvp;u)teerir3ta1omD lnvsls0t2to(opnodomtnlfvsl()sDrrurpnu1tpeomoeiyslsDua(ms;u)alenmoctydfmtranei;t)trtr(r no4alee neils)a2urxr ;o1oltomf3ils m2rmnms u4trxoxf3ta1fpD  uvi;t0seuoimpoydap e ies t)aDtm(  no4aee mocilt s2emn p;t4tetomo iydopDr nei (0t2uoirpoo4apee nvtlsfsrtaxro;o4tpxnmi3ilsfs ulumpnt) etrxfciadlmtraivs t trtm(o oodolt  ncs sf rum(ront1oeeomo3ilsfs rmuvsn(4tlerxo ootop   uvils0tetoxm3oudlm e ncs s  2ur(rp;t0teen i3tltfaDrlnvon() lenio iydomtr nvi ( tetmxmpny4lleemnetlsf 2trxm no0tetnmi3iys m rauvsnu4tlxrxfctatlaD livi;() 2tmxm3nudomtnmfvils  rrrx  ;u4apxomo3iasfsDra(vo t0altrxfctotom  aueo t0sexo(r3ou4ap n ivsa( artr(  ;t4alt mi3tls mDrm(vp;(4 etrirciy1lm eanei;(0setmxm oy4optelncia( aDuaxmp;t4teenmfetlsfsDrln o;(4texrircoodlaDrlneo;s srum(rpoodll  lfetls) 2rau onu4tpxnmfeilt aDrm(vs;u4altrmr3iy1fmt an sls truo(rpnodoptn fvsatf 2rmurono0alxn ieiysla2uluvonu0teerxocto1fatelnei;(0setm(o nudoltelfctls  Drrum ;t0tltn f3ildlsDumnvon() exrmf3iy1fpt  i il()srtrim3iydaptnmnvi ( a2umxmpou1oleoif3tlslm rm(mp (4aetoir ia1lp  luvil(0trum(m3oo1llenlictasfarumx  nu4tlxoifetldls2rm(mo;u0 rxrio oa1lpte nes ()trxrxo3ny1ameemieslt  rrru o;u4olxo o3iytfa uan p;t4 eerxf3tadfatelnvi (  rum(rpio4olenlivta(faDtru pno1tee  icils sDeluvs;u0areoxf3iodoptean s;s)seurim3oy1ole mivt tfsDtr(mono0alx  fetadfs2emnvp;()tetrxrctytoa r ueol()sexoxopoudlme  feia()sDrr( o;u4alenmi3tldla ran pnu0artrioctodoa e n i;(0texmiopiu4ame  icias a2rauro;o1tex mi3iasfa eau onu0texrir3iatomtr n i s  etr(r iydom   ivsl() rua( oou1aetomieilslsDumnvonu) eenir3todlpD livil(0s2tmirpoo4amte ivta()a2tax p;o4alx  fcias sDulnmsnu4texnmrcoy1lp  anesl()s2xmio iudaltemivi s) Dra(monu4oet ioctydfa um(vont4aeenif oatop  lies;(0trtrirpnudom emnctat)arrm(r ou0oeenmi3ild a eluvon(4alxoxociydoaDeaueilt  2um(opoodlp elncia(  rtr( p;t1ale iiciysfa ranmo;u0 lxnmf oo1om e n il()t2xr(opoodale  ivsat aDtrx pno4alt mo3iasfsDuanmsnu4alxoxfcia1laDrlies;( t2toirpoo1olen nvs t  rra(r ;t0tlxomociytfs2uanmo;u) eenifcoatlpD auvols s2um(mpiodlm nmfvslsfartm(ro;t0oetoioeilsfm uluvsnt) eermf3tadfatranvil() exmxr io4lpt lfesl( s2tmxm ;u1aee  fctysfm2ulnmp t)trenxf3iy1lpDrauvo s0trtrir3ou4oleemnvtasf ruaxro;o1alenmoeiydfaDemu s;u0aexoif3oydla ranvs s0sexo(mpny4apt  net s arta(mont4optnmieiys m2emums;u)trxoxo iatfa   uvi;s) 2toio3oodal elnci sf Drrx pno4tpen ieiasfs2emu s (4trtoio tytoateauvol(  exm(o3io1apt mfeiasf Drax  nu4oltnmfctyt sDum(mp (0 reoiocoodfm   nei;t0 2to(m nydaptelnvtlt a2rr(moou4optnifeildlaDeau p;t4trtoiocio1fpDeln s;t0srxoirpiy4lpee nviatfsDurxmo;u1oex  o3tat m2eluvonu)artoxf3totfmtrlnvilt srxrxm ny1lleeliesa(  2taxr ;t1oetomfcilsls eauvont0tltoir iytlpDr u s t0tetrxm iodlpen neils)sDrr(rp;t0teenmictldfm uauvp () exnmo3tadoaD  u i t) eum(r nodllenmfcsls  Dumu  ;u0tpen f3iydfm rl(ms;(4alxrir oatlpD  ues;t sexmim nu1ope mics s)aruaxr nu0tlt mfeiysfaDranmo u)aetoifcoytfa  lnvi;s)sruo(m3io4lmeelfes ()a2taum nu4tlxn f3tyd m2ra(ms;u0arxrmf iy1omt auvslt0 rur(m iy1oltn fvta(fa2uaumpnu1tpx iocilsfsDrlnvo t0 lermfcta1fpteaneo t) 2xm(r iydalt  feias srtr(mont4oetomictlt mDulu s;u0alxrmr to1lat au o t0s2xmxm ou1apte iciasfsrrrur ou4altn feiadfs2ra(mp (0arxoxf tytfp rlieo ( t2tr(r3io4ape  nvia( a2uaumpou1tex ii3iytlsDel(mpnt4tlermoctotom eanvo;t truo(mpnydaltelfvtlt)arur(  ;o1apt ifciyslmDelumon(4texnirctotfmtean i t srxo(m ou4altemnesls) Dtr(root4aexoioctld aDrl(mp u0tetnifcoytoaDr nvi ( setr(mpou4amte nviat)a2um( pno0ope iieiasfaDrm( o t4 exoif to1fate uvi s)trxo(opnydap n nvi () rumu ont1aptn fcild m ra(mpnt4 rxnxr iadlaDeli sls sexoxopio4al nmivi tf Durx  oo1aptniiciytfs el(vs;()tltrmo oadlpt lnei t) 2ur(opno1ol nlfvt (f 2trxmpot1alxoioeilslmDumuvp (4arxoif3io1la   n ols s2toimpoudoleemnvt tfsDtmxronu1oee  ictltfaDelnvon(0trtnmo oo1fpteluvo;s srtrxr no4opt mfcil(fsrrr(mono1oeeoif3iydfaDrmnvs (0tetrxrcta1lm elnei (0srxo(r ou1ope mfeil( a2umur ot0tptoifeilt a rlnms;(0aeerxo tadfm  lu sl(0sruoir3iy1lle  icsat) 2trx o;t1oltn ietysfa ulu p;t0trtoir totfmtean s t0teurxrpoy1optn ivi t s2uru  ;o1tpeo ocilsfs2rmnvpn(0 lxoio ty1omtrauvsl() ruoxm3oydop elics s  rraxm ;u4tptnifciatlmDemn o;u)alerxf3ia1opteauvo t)setoxo3no1lltnmnvi (f 2uau oot0oex mi3iyd a ua(von() exnmf oa1fmt lu sl()t2to(o3ou1lmtnlfvs s)arurum nt1oltnmoeiltfmDrmnvp;(0aexrmo3iodfmDraneo s0 rtm(o ou1alenmfvil(fs2ta( ono0opx  icils m2eau o;(4tetrmocootlmDe uei;s)srtmim3iy1alee ivsl( srur( oou4opxomieiltls2rln sn(0tlxrmr3totomtr uei () rumir no4al emfei t a2rm(mooo0oltniiciys m2ra(ms;(4tetnirctydopDeau o t0 2umxo oudolt livta()s2taxr ;u1tlxn oeiltlmDem( sn()arxrifcio1lpt aneil(0texo(m3oydop elfct t arrmxmooo1apto iciadfsDul( p;u0 etnir3iotomteanvs;t) etmxo nudlp  miesl( srrrxmooo0oexniieiytla2ua(msn()aexoxo3oatlpDrln o;(0t2tmxrpoo1op  mnvsl(faDraxmpno0alen fetlsfsDuanmont4 rxomr3ia1lm eauvi s) 2uoio3iudaptn icta(  2urxmpot0tltomfetadlm2emu o t0aetnxr3iy1oaDrliei;s  exmxr iudal nmfct (fsrumxr nt4tpeniictlsfa2emnms;(0arxrifcto1fatelnvi;t trtr(o3nydlle mictat s2umur ou1aetnmietltls ean p ()tltnircoydfpt auvs t0tetmxo oy4lmenlfctls) Dtmxm ou4tptn iciydlm2ua(vpn()arerif iodla rai s (0tetmirpny4om nmicsa(farumurooo0texn fciaslm2ea(vp u)aetnif3ty1lp  aieslt)t2xmir oo1aptnmictlsfsruaxr ;o1oet ii3ilt sDel(ms;(0trxrxocoy1om e ieo (0 2xrxr3iu4al eliesatf 2rmxr nt0apto oeildlm2rln o;(4 lxrxr3ta1latelies;t  eumxopiu1ol elivsasfarum( ont0tpeoiieildfs2um(vs t0 lerif3oodoateaiesls0sexo(opoudapeelfvsa()aDtr(r ;t4apeniietatfs2ea(ms ()arxnmf iotlpDe ieo;( tetrxo iydomt  nvs s a2uax pou1tee  o3tlsla ra(ms;t4 renmocio1oaDr i s t) rtoiopiudoleemfeils)sDtm(m ;t1alen octldlm ulu snu4 eermf ootfmDrlueils tetrxm3io4omee nctas aDumu o;t0ale mictasfa raumpnt) eeoxo3ootomt ln sl(0s2triopno1oltnlnctlt) rtrxront0open i3iat aDumnvo;t)arxnir3oadlmtr ivs;( trumxm3no4amtnmivt s  2rmxmonu1optoiictad s2umuvs t0trtoifciotoa  aiesls) exrxmpoudoltnmfcs tf 2urx  nt1aee  octad s2uau s t4aeermfciytopDelneol( srxrxr3nodamenlnvia(fa2trum ;u0tlxoio3iytfa2ul( s;() reoxo tatop e i s t)texmxo oudolenlfeslt sDuax  nt0oexomfetatls uauvo;u4 ltrmo3iotfaDe i o;t) ruo(r nu4oleelnvsl()aDtrxrpnt4apeomictas a2rmn s;u0texrir3iatfa  lnes;(0 rtoxr3io1lleemnetatf Drrxroot1tptnmo3tldfm ran o u0 rxomr3tydop eli o t)sexm(r3oudlmee fetat)aDtrurp;t1oeenifciysfs2rlu s;t)arxoxo iatlp elneolt)sexmiopoudole lieil(fsDtaum ;u4olx mi3iadfmDelnmp;t4 exrxfcty1fp rli ols)truoirpiu1lme mieias a2rrum oo1oee mfeiysfs ua( s u)aleoxr oodoa  anvo;() rurxmpoudam n icslt aDtrxmoou0olen fctyt a rl( p u0 etoxrcoo1fp rli i t0t2uoio3ny1openlnvs (farrmxr ;o1tet iietysfm uln s u4aetrifciy1fp  ln i s  etrio oy1oltnlfvt s a2umxront0olxnmfeiyt m2rlnmp;(4 exrir tatomDeliei;s srxm(rpou4olee fcta(fsDtau oot0altn ictat m ean on(4 exnxr iotlat  uvi s0trxoio iu1lptnmfct tfarrr(mono4ole mietyt aDua( ont) ltrifcoodlmDeluvols  2xoxrpoy1am n ici s)sDtru p;t0tleo ieiasfs rmnvsnt0tleoxo3iodopte uei (0 rurxm iy1olen icias srtrxm oo4aetomfeiyt s2ulumon(0 exoxfciadfa rln s;t)trtmimpoy4lme  ietatfarrmu  oo1alxn oeilsfm2rau o u4 eermfcoytomDrlu i;t0 exmxr3oudopee ici ()aDta( p;u1teenio3iltlm el(mp (4arxniociytlpDean s;t s2um(mpoo4ll elictls)srururono1aex miciysla um(vsn(4 exrir oodfa rlivsls0t2to(mpiu1llee ivtl( sDurxmo;u0altomoeiyslaDumnmp;() leoxociydlpt  ies t  2uoio3oy1lmtn ivtat) 2rm(m no4tpeoioctatlmDemnvs () rtoio3oy1fa  an o t0trurxopoo4ap   feiat) Dtau ont1oltomicils aDemnvonu4teenio iydfmt  neol() 2tm(o iu4alen fes tfsruax p;o0tltn ieiadfm2umn sn(0alermo oy1lateluvs ()t2uoxrpiu1lp e neslt sDuauroot4tpx if3ildfsDeluvp t0artniociydomD livi;t)srxoxopny4lmtnmfctatfsDumuro;t1oetomfciys a umu onu4trxnmoctatfpDeli o;t0s2toxr3oudom elfes s)sruru  nt4alxo oeiat a el(mpn()tleoio3oodfmD auvs;(  exo(m3oy1ll  licsltf rrmx p;t1olx iociadlm umuvo ()tltomo3tadopDeai o;t srxrxrpiodap  mics tf 2rr(mpno4opeoii3tltfaDul(msnu)areoxo to1oaD  iesls texoimpiu1ame mnes ( aDtrumo;t1oex ii3ilt s rmuvpnu4 lxomf totfaDean s s0s2urxrpno1alenmnesas  Dtrxmooo4olenii3tytfm rm(ms;t) etriocoo1omtrau ols s2tmir oo4lpen ivsls srrm(rpnt4tpx  iciasfs elumpnu0arxoircoy1optelnes;s teuoirpiodolenlivslt)a2umu ono4oexomf3tydlm2ea(vs;(4 lxniocoadfa rau ils0srtoir3no4ll emfvtasfa2rmum ou1aleomfctasfs2ua(ms t4 exoxo3tadopDrlieslt srtmio3oudamee fvt s  rrrumo;o1aee ifetydla eau pnt4arxrxociytfmDr i o;s  2xo(m iu1optemfvilt) rra( poo4apeomoctadfmDumn sn(4aeeoxr iydlat li s;t  eurxm ny4ameemnvtas arururo;o0tlenmieilsfmDulumsnt0alxnxoctodopt anvsl() exmir nydlpen iesas  2ur(mp;u4teen i3iad m2ul( o;()altrmfcio1opD  n sls)sexrir oydoltnlnei s)arrr(rp;t4tex  iciysls rauvo;(4tetnmo3iytlp e i ols) ruoim3oo1lmenlivslt)arurx p;o4ale ifciadlsDelumonu)alxrmrcoo1fm eli s;t s2trimpiu1ale  ici (faDurur oo1opxoiieildlm umn s ()tetrxo3ty1lm raueo;s0t2xo(opio4amt lieia() 2taxronu4alxoiociytfaDraumsn(4artnio oydlp  lnesl( t2urxm nu4ope mfesas) rrmxro;u0aeto icils sDulnmsnu4 lerircoatfp   ivi t)texmxopoy4ll emict tfa2ta( pou0teeomietadla eanvp;() exoiociatfpDrai olt) 2xoxr3nudopt licils  2rrx  ;u4teen iciltlmDua(mp (0areoxo3ia1om   ues;t sexrim3nodap elfesat a2uru p;t1oetnmiciydls umn p t)arermo3iytfmte ivo;t) 2xrxopiudam nmfesas)aDrmxro;u1oeeoiieiydfm2elnvpnu) leomr iy1op r nvs;t t2xmxo io1opt  ies s)arrrumono1texoifetad a rmums (4 leomf ootlp rlivolt)trtrxrpoo4am nlfcs t s2trxm oo0alenmfctysla uanmo;u0trenxo iytfm e ueo s)s2um(rpnudomt  nct sf rrrxmonu4aee iietls s2rln snt) ltoxo3oy1lat  neo s  2xmxr3oy4lm   ivt t s2ur(  ;u1alt mociytfa2rauvs;u4artrmrcta1faDrluvi;( trxmxopiodamenlfcslt) rrmumpou1alto oeiys aDum(vonu4altnmo oatla raivols) rtr(opio4ameemfetls) rumxrono4tpto fctyt a rmuvo;(4alxoif3oodlat lu o ()srxo(r oodoltelfvt s srtmu  ;o4oex iieiasla2rm(vs () lxoxrcoo1oa ranes t)srurxr3oy4omen nvias arua(r nu4altomfetydfa2elnvo t0tltrio oy1fmtrli s;s) exrio no1lmenmnet tfaDuru o;t4aptniicildfs rmumpnt) lxnmr3ia1omtr nvi;s0srumxm3io1amtn ivils s2uaxr ou4alx  icilsla ra(ms;u0 lxnmo oodlaDrlneslt s2xm(rpiy4om   icsls)aDua(  nu1tpxn i3iytlm2emnms;t4 rtrif3todfpt  n s s0texo(opiudol eliesa(f rumu  ot4ape  f3tadlsDrmnms;(0artrmo3ty1fp  aieo;t) 2trir oy4opee ivsa() Dtax  oo1opt ioetlt m ranvs t0trenxr iytfptraivs;s  rto(m3nodlmt mfeta( a2rau pou1tleo f3iltls ran p;u4texrmo3oydomt au o ( s2urirpiu4olt  nvsls)a2raurpou4alt mfetydlaDrluvon(0arenxrcootopt au ols)teur(mpiy4lmtnmietlsfartaum ;u4aex  i3tytls ranmsnt4artnio3todfa   n i t  2xrxr3oy1amte icsat srra(rpou4teeomf3iys s2emnvp u4 lenmf3iadopDe n o;()srum(m oydllt mnctlt srrmumpot0aex moetltfsDrm( s u)aexnxf tytfa  lueo s0 rxmiopio1lmeemietasfsrrr(r oo1opx mfctlsfaDel(mp t0altnirctatlateaieil(  exmir3oudopee nesls)sDuau oou0aexo f3ias mDrlu pn(0tlxnxr iadom raies;s srto(o3ny4omenlfvi t)aruau pou0apxn iciyt m2em(vonu) exoio3tydfpte u ols)srto(mpnodapt mivsasf Dur(mo;t0opx  ociasfmDulu o;(4 exomo iatlpDran slt0 2uoxmpnydopeemnvsat) rrmur ou0tpxo ociltfsDel(vp;t) rtnmf oodfaD luvi;t)s2xmimpou1op emncsat)a2um( onu0optn ieiatfm2eluvs;(4tlxomrctatoa   i i;t)seuo(m3ny1olenmncs sfarrauroot1aexnioeiaslmDrlnmo u0artrir oy1lmte nvs;s teumir nu1opt mnctltfsrurxrpou1aet  ieiatfs2ea( o;u4 leoxfciydomtelu olt0 eumirpny1llt  fcs (f Dtrxr no4tptnmfciytla uau p;t0artrmo oatoat  u i t0trum(m3nu4ome  fei s)s2ua(m ;o1alxn ieiasfaDra(mp;u4 rxomo todla e ies;s tetrxmpoy4apt mncslsfs2taxrpoo0olenmi3iysfaDumuvp (4tlxnifcio1fmte u o () 2toim oo1ol emfvs t) 2rr(moot0aet  oetltfm2eluvsnu0tltnxocia1op   ivi;t s2toio3ny1omt  icil( aDur(rooo0apen ictlt m emu p;t0texrmocoydlmDeluvs s)trxoxm3io1apte nctl( a2rru  ot0tpx mfcilsls2rmuvsnt0aexnir3iy1laD livs ()s2trirpnydap n fci s)a2urx  ;o1oexoioeiasfm uluvs;() lxnmf3oodfaDelueol()t2tm(o3iodomt licilsf ruaxrpnu0olt  ietyt s2elu p;(4aetnxrcoadfm elu s;t s2tmxrpiu1lle lnct s a2taumooo0oex  f3iadfsDraumsnt4tlxriocoa1laDe nvi;s0t2trim3nu1op elfeta( artrumooo1tpeo o3iys sDemn o;u)tlerir3oo1omtelnesls)t2toiopoodlpt mfesat  Durxronu1open feiatlmDel(vp t0aexoirciytlp eai olt) etriopio1omenlfetat sruax oot1apen ieiydfm ea(mp u4 rtnio iydopteln i;() ruoir oy1ame  ivta(  rta(mont1apt if3ilsla umuvp;u0 exoio3oytfpDr uvi s) 2toxm3ou4op  mictlt  Duaxm ;u4aptomo3iaslsDraumpnt0alenmrcia1latrliesl(0srum(m io1amtn fvta(farta( p;o4optoiocias a2rmn s;()arerif oytfmteaies ( s2xm(mpnodlp e fet tf Dtruro;u0oeeo fcils a2ulnvpnu0teeoiocto1om rau o;() rtoxr3ny4lpt  fcs s aDrrumont4apt iiciaslaDel( o u)tlxoxociytfmtr ieo;t s2um(r iydaptn nvtat)sruaumoot1tpe  ociyd m emn p;() etrmo3oa1omDelivo (0 2xrxr ny4ap  mivtatfs2uax o;u4aeen icild s rmu ont) leniocoatoatr ivilt)trxm(o iy1optelfvsat aDtaumo;u0tlenmf3tls aDum(mpnu) ltrirctotfmDeluvslt  rtmxr ou4lpeemfeil() 2tmxr ;t0ape mieiadls2rl(vpn(0 eenxf3iy1optr i i;t0 ruoio3iu4oltn ics t) 2rmxrpno1aexn i3ild a2uanvs;()trxoxociydfmte nvi (0s2xmxo3oy4om   ncta( s2urxrp;u1apt mfeilt m rln s u)aexniocoa1latelivolt0 rtmxm nudllenmiciat s2raxmpoo1olen octyd s2ulumsn(0tetoxfcoytfa e u s () 2tmxo ou1olenmnetat sDraxro;o4apeo iciyt sDranvp;(4 leomo3iotlaDrlnei;t)texrxo3oodlm  lncslsfsDtm(m nt0aptniicildlm uaums (4 leoxr3iadla   uvo s0seurio3iydlptn nvs tfaDrm( pno0tex ifcilt mDelnvs;u4aetnmo3ia1fpt auvil(0srxrio3io1optnmictas arum(rooo1aeeomieiadls2em( s;(0trxomo todlpD aueils0srxmxr3oydlpee fvs t aDrmx  nt1alx  iciad a rau s;()tetoifciotlmDelieols)t2xoimpnu1olenmici tfa2ra(m ;o0tlxoifetadfaDran ont) lxniocoo1opt  iesls0truo(m io1optnliesas)arurxroot0oeeo ietydfa ea(vp;(4 eerxf3ia1lmteanvs;s0 etm(o3no1al nlfctl()a2um(mp;o0tpx ii3iydls rauvp u4tlxoxr iodfp e i o;t)trum(opiydaltnlnes sf Dua(r nu0ale  oetyd a emumonu)tleoxf io1fptrln o s srxmxr iudopenmnet sfs2rrum nt1aeto ociysla2ean onu) rtnir oadlaD  n s s0sruoxo io4altemnvil()a2tr(monu1apxnmoctls sDuauvp t)treoxr ta1opDr u s;s0t2uoxo oo4ale  ivsl(farrm(r ;t0apxnifcilt a2ulums;u0areomrciytfp ean i t)seur(mpnudam nlnvslt)s2trum ot0aleomietatfmDulnmsnt4 rerirctydop raivi;t0 ruo(o3nodll nliesa() Duaxm ;o4tltn f3iytfa2el(vpnt0tleomo iy1oa   neols  2xo(m io1ap   nesl(fs2rrxmp;t0alenifeiyt s rmumonu0aeeoxr3tydfate ivils0t2xrimpiy4ll  lfeslt srtr(roou4apt ifeilt s2um(vs u)texomoctotom   nei;()trum(opny1optnmfctat  2umu ono4tltoifctytlm2ean s u4treriocoa1oa eanvs;()s2xm(opny1lm nmics sfaDuaxmp;u0tlxoioeiytls rlnms;(0teeoxo3tydlatrluvol()setrxm oodomeelneslt  rurumoou0ole mfcilslm2eau s (0trtoir oo1faD ai o;(0srtr(m3iydol elnctat) Dtrxrp;o0alxnmf3iatfmDeanmp t0artrmo iytfaDrlu o;s  etm(mpiy4lpte ivt s aDtr(mont4openif3iyd sDem( p u)aeeomo3oodopD  iei () 2xoxo no4oltnlivils sDrm( p;o0texnmiciysls2elnmsnt) leoirciadlp eln sl(0s2to(mpnudope  ncs tfa2rm( oou0aexnifctyt a2rlums u4tetniocoy1omt luvslt0sexmiopio4ll nmfetas) rurx  ;o1oeto oeiadlm2rmnvp;u4aetrif3ty1fm  auvi ( trtrxmpoo1amenlfesl()sDta(rooo1apen ictasfsDea(vs (0 lxrmrcty1oa raneo s0 rurxr3no1omtemncil(f 2um(  nt0tpxnmicilsfaDuanvs;()alxoxrcta1fp   nvs t s2uoxm3nydomt lfct ()aDrr(r ou4ale iiciasfm2elnvs t0trtrxf3todoa  livolt0 2uoimpoo4openlfctl( aDrax  nu1oexnmi3ilt a ea(vpnt0 rtrir3oo1oat  uei;s) etmxopnu1optnlncsls)sDrmu pnu1opeo i3tlt m eluvpn()arenxo3iytoptraneslt0srur(m no1om emfvtat)sDtrumont1alto feiad sDuauvp;(0aexrmrcoadlmte neol( tetrxm3iu1altn nctatf 2urx  oo0alxoio3tad m2ulump ()aleoif todfa ean s;t  exrir iu4ole lictltf 2tr(moou4aet  octls s2elu p;(0 exomfciytlatr uesl( s2xo(m3io4al  lnet ()s2tr( pot1alto feiydlm ra(vpnt0aetrmf3oytom r uvo s s2umxr3oy1op n ics t)aDumu  ;t4tlt mfetadla rmnmpnt0 etrxocoatfpteln slt0trtr(o nu4lpte ncsl(f rtmurono4tpeomo3tas s2uaump;(4texoxr oa1omD  ivo;t0 rxr(rpnu4ol  mivtlt a2umx pnt0tltn i3iydlm2ea( o u4arxrxf oatoa eaueo;( srtmxo no4omtelfcs ()sDuax pno4alt mfciyt a ul( snu) exomf oytfpt aues s0 2toio3oudlltelnct t a2taumooo0tpe moeildlsDul( p ()aleniocoydfpDeanei;()s2xmxm3io1ape  nes () Dua(r oo1oexoifetytfmDemn o u)arxnxfciatfpD  ivs;(0truo(opoydlleemfeil(  rumu p;o1oltn ictadfaDrlnvo t4 exnxr tydoa eanvo t0 rxr(o ny4lm nlivils) Dtm(ront4aptniiciysfaDua(vo (0 rxrmf oydoptrlieo t0t2xo(o iy4ape lfetl(fs2tmxrpoo4olx mfctydls2rmn o;u0 ltrmociytomt aneo t0 ruoxm3oudal   fcsl( arrrum nu0tee ioctyd a eanms;u0tetomfciydopDelues t  exm(o3ny4altnlfeslsfsDtau  no4aex miciltfa ua(vp;u0 rxoxo totfmte u ols)s2xm(mpnodopt  fet ( s2rr( pou4aeeoiiciatfsDeln o t0texnxo tatopteauvo;t)srurxrpiy4ameelivi ( sDurxmoou4tle mociatlaDemn onu0alxoxr3oo1fa elieo t0t2trxr3iudomtn nvsa()sDtrx o;u0teeo f3ildfa umumonu4tetriocoy1lpDeli s s0s2to(opno1ap  mfciat)a2um(mono4oee  oetytfaDra(vsnu0 rtrmr3iadfpDeai o ()s2tmxopoy1lmtnlivs t srum(rpoo4oexnioctldfs emuvp u)trtrmf oo1fmteai i (0sruoxo ny1lltnlfcils) Dumurp;o1aetomicias sDuaumont)tetnifciydlmDelnvi s0t2xr(mpnudlpe  feiat srtmumo;o1tleoiocilsfm2el(vs;u4tleoxo todfptean s;t0s2tm(r3io1optn fvs () rtaur ou4tpe io3tadlm2uan o t4alxoxf tadfm  ai slt teum(mpoydamt lieils  Dtr(rpoo0aet  o3ils mDeln s;t4 rerxf3oy1fpDrluvi (0teuoimpnudol n nvslsf Dtmu  ;t0alxn ociaslmDul(vont0 exnmrcoadla  lues;(0t2uo(o3nu4am   fciltfsDraur no1olxniictytfa2umu snu)aeeomo oy1omDe neo;(  exr(o3iu4ll nmfvt t  2taxr oo0alx moeiatfs ranmont0treoir iydfm  lnvil()t2tmim3oy1lm elivt t  2rmu pnt4tpt mf3tas m uanmsn() eerir tydfm eauei ( seumxo ny1ape mnei ()artaurp;u4altn oeiaslsDumums (0altoif3tytfmD livs t)sexr(rpiy4lpeemivtl(f ruaxm ;o4tptnmfeias m2em( p;(0tetoio tadfmDrlu o;t tetrxo iy1ol  mfet s aDum( ono0tee  fcilsfmDrl(vs u) rxoifcoytfpDrluei s trxo(o no1om emnvi (fsDrr( o;t4tee mfciat s2eanvo;(0 lxoio3totop  li s (0 2tmio3oydomen nesl()a2ra( pou1tetomociyslsDrlump;u) rerir tadlmDe ueilt)srxrxmpnodlmt mfci ()aDua( oot1olxn ieiad aDrluvs;() etriocta1fpt auvilt0 etr(m3nydlpee fei s)aDua(mp;t1oltnio3ild a elnmonu0 rerir3oo1faDrauvi t0 etmxo3nudlm emfes s)a2urxr nt1aeen icilt s uau s;t0arxrmo3ootop r uvs (0t2xmxr3iy4ome lieias) Drrxm ;u1tpt  fetysfa rau s;t4aetnxr oa1lpteluei ( s2umxm io4op eliet t)srtaum oo4apxniictad a rmnvp u0 renxfcoadopt an sl(0 eumimpoydlltelics sf 2rr(  ot4apeo iciltlm umn pnt0tlxnxr oadlate n i s)trtmio iu1lmtemictas)s2taxrpou4olxnmf3tldfs rm(von()areoio3iotlpt  neil(0srurxr3ou4am nliesl(faDraxr no0aexomieiatlaDrmuvs;t)aetnmo iytfm ranvol(0 rtm(o nodalee netat)s2tr(  ou4tltn oeils sDemu sn(0 rtrxo3oodfaDr u i;(  eur(o3ny4lpe livt tfartaumo;u4apen fcildfs2eanmp;(0 ltnifctatom r n sls)seurio no4omt mfcslt aDumx  ;o4opt mfeiyt aDra(ms;(4 eerxf ia1oat  u ils0trur(o3iy4lmt mivia() rururp;o0apen feilsfa elnvo;u)aetrmrciodlptr ieo s  2xr(m3nu4opt lfvias  2tm(r oo0tetn ociltlm em(mp;(4trxoiocoodlaDrau i t  rtriopno1ole mnctl() rua(m ;t1aet  fciytfm rau pnu0trxrmfcio1lp e neo t0srxrxopnu1lp n fcsas arrau pot1oltnioetadla2rm( snt)alxrxr iy1oatr nvs;()texm(m3nydapee ivt (  rra(m oo4tet  f3tls a2emn p;u4texrxr3oydopt lu sls)teuriopoydalt licsa() 2ua(r no0alxomi3ildfsDulnvs;(0 exrir iydfpte n i;s seuoxopnodamtn fvs t) rta(m no4optomfeiadfa eauvp;u0texoxf iy1fm r ues t0sexr(r3ny4alenlncsl(fa2rm(  ;t1aptnmictyslaDean o u4 ltrmoctatlatrli i (0 ruoio ou4lmtn fei tfaDtmu pno0ale  i3tltfa eaumpnt)arxomr3oydlpDrauvi ( s2uoxr3no4al nmnci t s2urxmoou4olxn ieiltls2rl(msnt)teerif oo1oat aneo () 2tm(rpoudlltelnvilt  2taurpou1ole miciltfsDrmums u)areoir3tytfmDraueols)t2xmxo oudoleemneil(f rtm( poo0aetoiieiydlaDuan p u) exrxo3tatfmt  n s t t2tm(o iu1lpe mfvt (farur(  nt4ale mfeiysfs2rl( o t4 rtoiocoydopD  u i;(  rto(mpio4lp  mncias)sDtm( o;o0aexn ietasfm2uluvs u) rtrio iy1opt  u ils  2xrxr3oo1optn nvs s)aDuauront4alenmietlsfa2ul(vp;u0 rxoxf ootlpDr uvs;( texoimpiy4op  licslt srurxmpot1olt  icils s2rlumo;(4 rxomfciodlptelneo;( teuo(m no1lp nlneiat  rrau pou4altomfeiad a rmnmp;u4altrmf totfmt  u o (  2xr(o3nudole lnesls  2ur(moou1olenmfciltfs2uanms;t4 lenmr oodopDrlivils0 2xm(m3oo1omeemiviasf rua(  ;t0altnmfeiat a2em(mp;u4tlxrxo3tytlatrai il( tetrim nu4omt  fvt s  rur(ront1teeoif3iadfaDum(vs t0 eerxf3oydoa  liei;s)texmirpoo4aleemnvtat) 2rr( pou1aeenmi3iad s2umu onu)aetrir3iatfat aneilt) 2to(rpiodalte nvslt)s2rmx  ot4oetoifeilt a2ul( p;(4tltrxo3todfa eai i;t)tetrxm ny1aptemnetat sDtmu pot0aet mfcias s em(mpn(4tleoioctotfpteliei t  2toxo nu4op elfeiatf Dtax pou4olt mfetyd aDuln s;(4alenmf oa1lmDrln i t0sexmxm iydam   fct s a2um(rpot0oexomfeilslsDuanvo u0arenio oydop   n ol()s2uoio ny4amte ncia(fsDrmx pou0oleomoetadls2rmu s;()tlxrir3tydlmDe ieo s0s2xm(o iydllen ncsa( srrmxm ot0olx  i3iat s ua(mp (4 lerxo3iatlmDrluvi t0 eum(o ny4am e ivs sfaDurxroot4aexomictydlmDea(vs;()arxnifciatlateli s;()sruoio iudlpe mfct t s2tmumonu0alxomoeilslaDel(vpnt0trerifcoatlpDeai s;( seuo(mpnu1om n nvta() 2um(r oo4apxnmieiltfa uanvs;t)trxrmo3iydlmDean s;() rxm(r iudomtnlncta()arur(ro;u4oexoioctasfaDrm( snt0arxoio oytfp  lueo ( sexo(mpio4al   ies t)artr(m oo0tlxoii3tatfaDea( sn(4 exoxr3ia1fmDrlivs;( truoxm3nodll   iesls  2uaxrono4olx iicilsls em(mo t0texrir iodlp e nvsls srum(rpoo4llt  iet sfaDurxr nu1oltomociys aDumuvo;u0aexnmr3oatopD  uvils) 2toiopoo4olee net s)aDuaxr ot4oltnmoeiysfa ul( o;()aetrmr3ta1laDrln sls t2xm(o3oudlpt lfet tf rtm(  ;o4tltn ieiyd s eaumsnu4 rxrir oytfaDraues (0tetoxopnu4omenmivil(  Draxrpou4ale  f3ild s rmnvonu4alxomociadoa rai o t texmxopoy4omenmfvtat)aDrmxr ;o0alx mfeilslm eanmp (0treoxr3ootfaDraneo;s)s2xrim3oy4optnliesas)aruaur ot0tltn fciad s ulu p;t4 eenxo3iatfpte uesl()t2umimpio4ome licsasf Drmur nt0tltnmiciltfaDuau p (0alenxo io1lpt  ues;( trxoxopoy1llte nvils) rtau ooo0opxnio3iyd aDum(mpn()tlxoir3oo1opDrli o;s t2tmirpiu4olee netltfa2tmx oot4ole  f3iatfaDrl(vsnu) rxnmo3tatlaDrln ols0sexmimpoo1lpenmivias  rurxmooo4tet mf3iad a ua(ms;t0artnxo oatfptrlneilt0sexrxr oydapeemnvias)aDraxmpnt4olxoii3ildlaDem(monu4tlenifctodfpD  n o s0s2umir3io1apenlfct tfa2ua( o;u0texomf3iyt m el(msn() eenxrciytfaDeanvils)sexm(o3no4oltnlncia(f rrax p;t0aleoiicilslaDuluvs u0trtnxocia1faDelies t0 rurirpoo1aptelfctas a2tr(ro;o1tpt  icildfsDuauvpnu0 renmfciydlmt aues;( s2umio3oo1opt  fei tfs2ur(rpno0olt mo3ilsfsDul(vs;t4trtrxr to1fpte nvo;s  euoim no4ap elfei ()a2umu  ou0olx ifetasfm rmump u)artnifcoatfpD luvi;t0 exmxopnu4lmeemnvi () 2rax pno0apt mieils m umnvs (4 ltoxrcoadlpteai o t texr(m3nudap   ncils a2tax pnt0opxn oeiytlm umn o (4tlxnxf ta1oat an i s)trtr(opnudolee fesls  2um(mp;u0alt if3tlslaDean p u4tetnio3ia1omD  ivs ()teumimpiodomt  ieias sDum(monu0teeomfetadlm2rluvp (0 ltnio3oodla rauvo (  2xmxm3iydlmtn ivilt) Draumo;u0texnmi3iasfaDrmumpnu0aetoxo3iy1omte n slt)sexo(r oo4lmenmiviasfartm(ro;t1tleniocildla rlnvp (4alerxo3io1opD anes (  exrirpiudaptnmies t aDra(  ;t1aptoifeiaslaDrmn p u4 reoir3oadoa eln i (0 eur(m3oy1olenlnctls  2uax oou4alenmoctyt a eanmo t4 eeoir iatoateai i s s2xr(rpnudlpt lnvta(  2urx  ot0apxnmo3iasla2rmnvpn(0 leoio oytomteaneo s s2xmxo3ny4amt lneilt)s2rrxr nu4tptniieilslmDulu pn(0 exrio3to1fatr uvi s)sexr(m no4ome  fvi tfsDumx p;u4tlto ictas m rlu ont4teermo3oydlm rai o;t trumxrpno1opte feils arumxrp;u1opeo i3iytla ranvo;u4teeoifcta1opDelueol(0 eumir3oudll emfetat)sDrr(r ;u0tlx  fetad m2ea(vp t)aetoxrcio1lpte uesls trumirpiu4lltelfctat  2umur ;t4alto f3iadlm2uluvs u0tlxrirctatlp   ueol(0tetoir iy4al n nvia(  rtaurpnt1opeoiociad a emnmo ()altoxr iytoaDeli sl()seumxopoy1optn fcs sf 2rru ono1aeenifeiatfsDrluvs (4 etrmf iodlmDr i ils  etm(r3iydoleemnvils aDtr(m ;u4opeomociat sDulu o;t0texrmo3to1laDran sls0seumxm3oydamenlnvtlt) Drrurp;o1texoio3ias s2ranmo t) exrmo oydoa rlneil()srtm(opio4lm nlfcs t  2rr(r nu1alxnifeiysfs ulu o;u0 ltrircoo1omtr uvi t0trxrxo3iu1aptemici (f Dtruront4tlt iociytfm2em(monu) lxnio iy1op rluvilt  ruo(r nodam nmnvtat)s2ta(m ou0tpt  iciltlmDelums;(4aleoir oy1fmD lnvs s) rxo(o iudal e fesat)srtrx p;o4aet io3tat m emump (4arxrxo totlpteaiei t srumxr3iu4opeemnci sf rrr(rpnt0tpxomoetatfm2elnvont0trxrmr iytop  luvsl()t2tm(r nodop  mncsls)sDrmxm nt4oexnmf3iad m2uanmo;u4 etnmo ty1opt ai s;( texoim oodome lictls) 2um(mo;t4oeen ocils mDeauvo;()tlxnif3oo1op raueslt srurirpno1ope lfcs ( aDuaumont0aexomf3tydlaDeaump u4teeoio3tytomD luvo;t)trtr(mpou1omtemfctat s2urxmpot0oetnmoctasla eanmsnt0arenxo iatlp elivs t0tetriopnudlpee fcs sfsrrr(m ;o4opxoiocilt aDrm(msnt) lxnxf3iatopDranvs;s) exoxmpoydlpe  fvsasfs2um( p;u0optn i3iadla ul( s u) rxomfcoatfp   ivo;s) ruoxm3oy4opteliviltfs2umxrpno4texomi3iltls2rmumo t) eeoxrcta1op rluvi ( tetrim3ou1altelieilsfsDrmx  ;o1apxn i3ildfm2umuvs;t0aexrmf to1fa   ivi;t)s2xrxr3ou1op n nct sf rurxmpoo1opxo oetls mDrlnvs;u) rxomo3iydfp  aiei t0 eum(r3ou1llenmfcsa(  Drrxmoot0teenio3iadls2um(msnt)aeeoxr3ia1opt  n s;s0srtrxr3no1ll elfetlt s2tau oot0aee ioetlsfs ra(msnt0trxnmfcoa1lptr u o (0setr(r3oudop  licsls srtmuroot1aexoifeiadlsDel(monu0alerxrcta1lmt ln i ( texoxm iodlm emfei t  Dumump;t4ale miciasfm2emu s;t)texoxr3oo1lpt  ueo ()truoxo nu4omte ics tfsDrmurp;o1tpxnmiciat m2emuvo t) rxnxrciatfaDe i o;t)teum(opnodlmeemietltf rrrxm nu4oleoiiciysls eanvo (4 eenmrcoatom rlnei;s setm(rpoodamee feias sDtaumpot0oexoiieiysls rau onu4teenxfctydlpDrlu ols0srtrir ny1lmeelieia( s2ur( pno4oexn oeild mDel( o (0 rxnif oadop e i s s) rurir3no4opeelfesa( srumx o;t4aeeoioeiasls em( p;t) rerio3oydfaDeanvsl(0setmir iy4apenlnvsl(farta(mo;t1oee  f3iyd sDelnvp t0 rxrio iy1op r nesls) eumxo io1om  lfcilsfaDurxrp;o1tptoifciydlmDrauvo t) leomo3iydfm  lieo;t  2xrir iodlp emfvsl(faDuaumoou0teenifciat a2emnmo;(4aetoxfcoa1om elu s;t  rurio3ou1lp emfvt s  2ta(rpnt1tpto i3iyd a2rmuvp (4arerio3tadfmt lu i s)s2xmxopio1lmtelncsl()s2ururpoo1teenii3tydla2ulnms u)aexrxfcoy1omtelnes (0 exrxrpoo4om  mictat  Dta(rpoo0olxniicils m um(mo;t)texnxr3iatfp  lnvi;t0t2tmim3oy4omt mfetatfsDtr( p;o0aptnio3tatls umuvp;t4tltnmfctotomteluei;()tetmir iy4lme  feslt s2umu  ot1open fciys s2eanmo t0teeoxf oatlateaivo t s2tm(m nodolt  neta(  2rr(rooo1opxoioetatfm2rm(vp t)teeoxr todlptrlnvo;t srtoxr3nydam nlfvsls)srrrurpot4aexomoetlt m2rlu sn(0areoio3oa1lm rauvi;(0s2xo(m oo4omtnlnes ()srrmu pou1olxniiciad m ranvo u)tetnmo iydlm r uvs;(  rxrxo oodlleemnvtlsf rraxmono0oeto f3iysls rm( o;u4 exrio todopteanei ()s2xm(o iodale mfesas srrm(roou0oetniiciatfs rmuvon()aeerifcty1fp e neo s0sexrirpny1omeemicsa( s2rmurpou0tpenmoeiatlm eln ont4alxnio3oytom rau o s0trxoio iu1lm elivia()a2trxmpnt1aeeomf3iytls eanvpn(0trtoif3todomte n i;t)setrio iu4olee nci sfaDtaxmpno1aexn ieiysfa2ua(vp u4trenxo3oatla   uvs;t)trtrir oudam nlfvtl( s2uaumo;o0tlt  i3iat mDul(mo;(4trenmrcoatlpD lieils  2uoxopoodlmeelnet t) 2tr(  ;u1teenio3iatfaDea(vsn(4 reoif iatfat  nesl(0trtr(mpoodlpt livslsfsrrmumont1tex  feiltfs elnms;t0 rtrxo oatlptelnvs () rtmim iodol  mici tf rrr(  nt4aeeomf3ils s rm( s;u0 eeoif iy1fm  anvsls0 2trxo ou4optn nvtatf Dtaxr ot1oltomfeiasfsDum(vp t4 rtrir3to1lmD  nvols tetm(o3iy4lpee fei (faDrmxrpoo0oeeniictltlaDul(vs;(4aetrmocoydoaDraieols)srtmxr3no4lmenliciat srra(rooo0apxomf3tyt aDum(mo;u)alxnir oytop eanes;()s2xoxmpiu4aptn ict (fa2rmumpoo4oet iieiys a2umu s ()tltrxf tatlp eln s ( trurxm no4op n ivta(faDtrump;u1oetnioeildfm um( o;u4aeerxr3ootla rliei s  etrir3nodom n nvilt) 2uau ooo4altnif3iad a2rmuvon(4 rxrif tydla  lieo;s) 2uoxopnodllte ivs s)a2ur(moot1aleoiociydls2uaump;(4altoxociodlp r nvi;() euoir3oo4lp nmivt ( sDrmxmp;t1texn feiasfsDel(mont4texoxr iydfmt auvs s)truoirpnodlmen ieilt)a2ra( p;o1tetn ocils a el(vsn(4 rxnir iytlp rlivslt)t2tr(rpoudap nmnvtas  ruau ooo1aee mfeils sDul( p;t4 rxoifciatlp e nes t0srurim3oy4al e nesasf rrrur ;o1tlxoioctldls2ean o;t4tleomf3ootlaD anes ()texo(opiydlmee fesls)aruauro;o1apx mi3iyt aDrln on(0 ltnxr iodfpD an s;()trto(m3oydlp   nei s)arrm(m oo1tpxniocildla ul(vo (0tlenif tytlpD luei s0s2xm(o io1optemneia() 2uru  oo4aet mfcilt sDrmuvont0tltrmr iatlm  aieo;() rumxopnu4openlfcilsfsruaurono4aptnio3ias s2umn s;u0tetnxo iy1omtean s;(  2umiopiu4op  lneslt arra(  nt4olxomieiyt s2ulumonu4aetoxo3ia1oa eli o t0sexo(mpny1llt micsls)a2umurono4oeeo fciad s2emump;(0trtomr3iadop rluvols)srxmimpny1ll  livtasfs2rmu p;u0aeenio3iasfm ul(vo;t0trtrxo tytfmtr n s;t teuoirpnydamtemicilsfs2tm( o;t4texoiieiydlm2umu pnu0 lxrmf ty1oat  n ilt0 exrio nydomtnmicilt a2ur(m ;o0apxomfeiyt s2umumonu)aleoirciodoa rlnvi;t0seurxmpiudapeelfci tfa2rr( pnu1tlxnifeild a rl(vont0 rxnxo oy1fat ai il( t2tr(o oo1lptnlnvias)arrr(r ;o1opxn oeiyd s rmums t) eeomo todlm rlueol()teuoxr ny1alt lfctat)sDtr(roou1alt mf3ildfsDel(vp;u) lxrifctydlmD luvs;t0 rtmxopnydll emfcilt srurur nu0oex  ocild m elnms t)artnmf oodoa e ues;t)srto(m oo1ol e fei (faDtmxm ;u1apenmociytls2umnvp u0trtrxo oatfmte uvils) rtr(m3no4lp n fetls s2raurooo1tle iocils a2eln snt0 eerxfcto1fat  ivo;t  exoxm3io4am nlfvta() rraum ;u0aetoiociyd s el( s t0 exoir todfa   i o;s0t2tm(r3no1ol  lieil()sDrmum oo1alxn o3tytlsDrlu p u)teerif3iytfmt lues (0 eto(o io1alt mnci s) 2tmx ont4ape mociasfsDrmuvs;u0aexnmr oy1lp rluvslt0 2ur(m3nodop  mfeta( aruaur ;u4oleo i3tad a umnmo u)aexomf oadfp r n ol() eur(m oydom e feilsfsDraurp;o0alx mfciltlaDrmuvo;u0artrmo3oodfa e u ils)texoim3iu1llt lfcil(  Dtr(mp;o1apto icildfaDeaump;t)tlxoif oytlmDeau i;s)s2ur(o nodamee netlsf Drrx oot1aeenif3iytla eauvon()aexrifciadfp raieilt t2xo(mpoo1ape miei s s2ra(m oo1oee  ociyslsDrlnmsn() rermocty1fpt  uvo s  rtmir3ny1al  mneil(fs2tm(rpou4tetomieiatfaDua(vo;u0 leoif oy1lp e iei s) exmxmpny4am nmnct s)artmxm nu1ape mieils m rmnmp (4 rerio iytoptelnvo;t)setmxrpio1op e nesatfa2ururpot4tpeo f3tyt m2rmuvp;t0aeenif3oodlmt  uei s) 2xrxo ou4optnlici (fsrtmum ou1tex ifeiytls uanmpnu4aexomociatom raueol()sruoxo3iudoleelfvi s sDtmump;u0apenii3iysfmDeanms;(0 etoio3oadoa eaivilt) 2triopoydlp n icil()sDum(r ;u1aet mo3ilsfsDua(mpnu4tlxnxrctotfaDraieo;(0trxoxopnudlp  mieta( a2trx  nu1olxnioeildlmDuluvonu) lenif iotoaD an olt t2to(r3iu1apte iei t aDtau pot4opxn feiltls2ran o (0alxrxocoytlaD anes;t)t2xoir ou1ole  ieilsfsDrr(ront4aleomi3iys a2em(mo;u0 lenmf3io1
\ No newline at end of file
@@ -0,0 +1 @@
+uvo ()t2uoxm3io4lm e nctlt a2umu  oo4tlx  ietyt m eanvpnu0alxnmr oy1fptelneilt)srxrxm iy4op nlnct (f Dum(mo;u0oeto ietld m2rluvo;t)tltoxf3ty1lmtrliei;( tetoim3iy1ap e fcsasfsrrm(  no4alxnifciltfs2rluvsnu0tleoxf3oadoat lu ils) exmirpno4lpen net s)a2ta(mp;o4tee  feiatfaDum(vpn(4tlxoxf3oytlmt lu s s) rumxr oudop emneslt aDuaump;t0tetomoeiasla2ra(vp;(4 rtrxo iodfmt  u s;t  2tr(rpoy1lm elfvt s) 2raurono0aex mfciyt s eln o;t)texrxr ia1opt lueilt)texr(r io4olte fctl()srtrx p;u1oeto oetydlsDemu o t0 lermrctydlp  aneo s teurxopoydlltnmfvs sf 2rmum ot4oee ifciys mDuanvp;u)aetoxr3iotlmDeanes (0tetoxo3nu1llenmicsat aDraurp;o1apen oeiyt aDeln snu4artrmfciydoat ai s s tetoiopou1optnlnct t sDumum oo4tle  ocias sDrlu o;()trtoio3tatlmD livol( srur(o oo1ol e fcsasf Drmuro;u1apxo o3iltlm2em(mo (4treomfciotom  aivsl()seur(m3oo4lp elfvsa( a2um(r ;o1oltomi3iys mDumnvp;t0aexrxf3oadlaD aies (0sexm(m no1lmtelivsls)s2tmuro;t1aexomictat mDeaumpnt0aetoio oatfa raieo;t0trumir ny4lpe lici tfa2umxronu0tex  oeilt mDean o;u4aetrxoctatlaD  ieo;(  rurxm nodaltn fetls  Dur( p;u1alx  iciys s2ea(mpnt0texomr iatlpD  nvo t0seur(r ou4altn fvsas) 2tm(rpot0tpxoiociys s2ran pnt0tltrif3oytoat aueo t0trumxopny1ame mfes t s2rax pou0apenmictltlm umump;u4 eeomocio1fmDeaneils)s2urxr oy1llenmict ( aDururpoo1alx mi3iltlaDrm( s;t0 renxr io1lmteaueil(0trtm(opny4llenmfvi sf Dumu p;o1tltn ictls a2elnvs t4 rxrxfctytfpt  uvs;s) eumxr3oo4ame  fvsatf Dua( pnu1tlxoifetys a emuvs t0 eerxocta1omDran o;t)texoirpiodomt mfetatfa2uauront1alxo f3tad mDumn o u0 exrif3oatlpD aieils)t2xmim no4al   nesas) Dua(mo;o1oltnioeiytlm2ua(vp u0tetrxo tadopteanvs;t0trtoim nu1olen feilt) Dtr(moot4olen feiaslaDua(mo u4tetrxr oo1lmDr i ilt) exm(o nodomeelnvtas  2rr(m no1apt ifetld s2um( p ()trenxf3oa1fateai i;s0 2xm(r iy1omt mncsa(f Drrumpno4oexo i3iyd s rm(von(4 leoir ia1opDelivi t setrxo oodoptemfet (fsrur(  ;u1altnmieilsfs2um( o;u4 ltomo ootlaD aiei t)s2trirpoodopeemicils sDumurp;t4aexn f3tydlaDea(msnt)trerxf3tatoptraivo;s0 rxmxopoy1lptn nvsa( aDtm(rpnu4aex  i3iyslm um(mp u0aexrxo3ia1fm eluvo;(0 rurio iudaptemneias)aDtaumpoo0oetnmi3iysla2ea(mo t)aetnmfctydfmDraivol(0sexrir3iodamtemfesltf Drrxroot0tpeo oeilsfsDranvs t0tltrxf oytlaDe uvs;( s2xrir iodlmtemivtas) Drmump;o0aeeo ieiadlaDuaump u0arxomoctodoaDelnes;t sexrim nydal nlnvt ()s2tau  ot4texniiciasfm2rm(vo;(4aexrxo io1fa r uei;s) eurxopnudopee nvs t  2uau o;o0aeen oetld a2emnvp (4 reoxrcoa1fpDraneilt0srur(r iodlme miei tf rtrumo;u1texo iciltlaDemn s u)aetrif iadfaDe uvs;(0 2xoim iy4aptn icil(fs2tm(rpno1tltnmo3iatlsDem( o;t4tleoiocoodfp e n s;s)srto(o iu1om n fetl() rtaxrp;o4tpt iicilt mDrm( on(0alermf3iytop raiei;s0 2tmimpnu1ll nmivi t)artm(mo;t4oetomictytlm2umnmonu0 rtoifctadoaD lies (0 2xoxm no1ol nmfetasf 2urxrp;u1ole  f3iysfsDemnms ()trxnxr3todfpte nvo (  2trir nu4am emfcs tf ruau  ot0alx mi3iysfm emu o;u4treoio3oytop eaieo;() rtmim io4ll n iet s)srumxm oo0tlenmietysla2emuvo (0 eerir3iodfptraivo t) rtmxr3nu1ol nmfvil(fsrra( o;t0tltomf3iltls2emuvs;(4trtrir to1laD  nes s trumxmpnu4lm nmfet s)srrr(roou0alxniiciydlmDrmnvsnt) rtnxf3iatfpDelueol() rtrirpiu4am   fcslt)aDtaur ot1tetn iciatlsDel(mo ()trerxrciydfmtranei (0seum(r3io1omtnmfvtl() 2rauroot1texo oeilsfaDuau ont4altrxociotlaDr uvo;(0seuoxr3oydlp elfcsatf rum(m nt4apt iieiyslmDrmnvpn(4artrxr iodfa   neilt) 2xmir3ou4amt lfvta(f Drmxmo;t4opxo ociydfa el(msn()altnirctytlp rlneo;s0seto(r3oydlmt  icta(fa2rrxmp;u4oltn o3tld s2uanmo;(0arxnxfcootlm r ivolt0 etrxr ny4lm n fvtatfa2umxmo;u4oexn o3iat s ul(ms t0 ltnmocio1opD lnvslt  2umirpnodllte nviatf Drax  ;u0alt mi3tasfmDeauvpn(0 eermrcoatop raieo ()tetrimpnydaltnmivsa( aDrax  nt4tptn i3iysfm2emn p;(0trenxr3iy1lpt lu ilt srurxo oo4llenmieslt) Dra(rono4alt moctatlmDrlu o;t0 ltoxf oytfmD ai o;s)texo(o oodll  livia(  rrr(m ot1optomociyt m2ulumo (4 rxoxf to1lmtr neo;s) rxrxo io1amt  nesa()srtaum ;u0tlen f3tydla2emnmsnu0areoio oy1opD livilt0 rxm(r oydlm   ivt tfsrtr(r ou1tleomfeiyt a em( on(4tetnmrctadlmDe i ol()trxm(m ou4omee fvtls srtr( ont0altnif3tyt a el( o;(0tlermf3oy1la rln il(  2xmir ny1omt  fvtl(  rrm( pou0apenmfctatfm2rm(mo t)aleoxfciadoptraueo;t0 rxoxr3nudome lnviltf Dtaur ou4tex iietlt s2ul(vo;u0 rermr3totfaDeluvs t t2uoxm ou1altnmnciat  Dumxmo;u1ole mi3tytla ea(mp u0teenmfcoatlpDe nvols) 2xr(opno4al  lfcsa(f Durxr ;o4texnmietadlm2ra(mp t4 reomo todfm e ues ()t2trxmpou1amtn ietlt)s2raxrp;t4oex mieiys m uanvsn() renio iotlaDrlu s t)sexmxm oydalenmnct sfaDrm(  ou0aeeo ociat mDum( o t) etrio iy1lm rli o;t0 2tmxm io4ome  fvta(faDtr(rooo4tlxnmicilt sDuauvo (0trxrmo3oa1omt li sl(0t2xo(r oudop e ics s  ruau  ;o4alxoiictyslmDranmpnu)aetrmr3oadlp eauvo (0setrxmpnu1lmen fet tf 2tmxronu0aeeomf3iydla2rm(mpnu)arxoxf3oadlaDrli sls srxmxopnodopee ivsas) 2rm(mo;u4tlx if3iasfmDrlu s u) rermo oa1opD ln o;t t2tmirpiudom n ivtas)aDtmxm nt0tlxomfctytfs2umnvs u0 rtrxrctodlm rlivsls  euoim3nu4apenmfcs s)aDumu  ;t0tee mictysla emnmpn(4tltrio3tytoa   ivolt s2uoxr iodlp e neslsfsDtaurpnt0apxoiictas s raump;t)texnxrcia1opteli s t0t2uo(r3ny4omenmfesl(f 2ra(m nu1aeenmiciaslm emnmp u0 exnmrciytfaD au o s t2xoxr3ny1lm   fcta(fa2trxr ;o4apt  fctadla el( onu)aleomo iytlm e ivo ()srtoirpou1lmtelnvi (fs2rm(mp;o0aetniociyt a2rmnmpn() reomr oa1op  auvi;t0t2umxmpio4ol elici sfsrrrxr ;u4tlxnioctytfm2raump u4trxnxr3oydla e ieilt teurir iy1al e fci sfaDtmxmoou0tptnmo3iydfmDea(mp u) leoif3oatfpt au sls0seuoxm3nydapt  fcsltf rtm( o;t4tpenmfeiadlm umnms;t0alxoif oadfpDe ivslt tetmxm3oy1lmt livsat  2uaur no1tlx  oetldlsDran sn()trxnmf3tadfmt ai s t s2tm(o3iydope mnvsls a2urxroot0alenmieils a2rl( pnu)tetrirctatfm eai i t)srtm(r no4al nmivil()a2ur(mono0oleomf3ild mDrmnmpn() rxoxr oodfa r ueo;t)t2xrxo3oo1lpte iet ( a2um( poo0aee io3iytfsDem(vp;u0aetomf3tytlp rli s s  eumirpiudoptnlivi s srra(r oo0olt  feiytfsDul( o;t)trtnmrciadfmteluesl( srumio3nydop  livt (f rtaxrp;o0tlto fctld aDumu o;(4tetoir3oadlaD aies () 2xm(o3oy4ol  livt sfa2ta(rpoo4aeto f3tlslm rlnvp u0tlxrifciy1oate ieil( tetrio ny1lle mfvsas)aDua(r oo0oeto f3iat s rmu pnt4arxnxo3iy1om  an ils0 etoxmpiu1lmte fes s  rra(ro;o0tetomfeiad a el(msnu4 lxnmf todoat lu o;( sruoxr iudaleemnesltfaDtm(mp;o4aee if3iys a2eau pnt0 etnxr3oytlmD lnesls s2umxr3oudop emicsls  2umumpot1olxomf3iytla2ea( pn(4tetoxo todfaD li o;()s2ur(rpiydap  mfctls)s2taum ;u1teeniieiysfsDrmn s;()tltnxr3tatoa raivo s0sexmimpny4apenlnvtasf 2taxro;t0aetomfcildlmDuauvpn()trtnmf3ta1omDr ivsl(  2tr(m3iu1am  lici (fa2ur(ro;o0olx if3ilslaDua(mp;t)trtoxr oodoatraueo (  ruoxm3oo4lme  ncsls)a2raxmont4alxnmieiytfm2ra(vp;(0artnir to1lmDeaieo;( s2toxm oo4olt  ivt sfsDrax  oo4tetomfciadfm2ra(mp u4trtrio3tydlp  livolt  rurxr ou4lp  lfesls s2ur(m oo4aexnmicild s2rlnvo;t)tlxnxoctydoateli sl()srumiopny4olee feilsfsrrrxm ;u4texn oetat m2ran snt)tetrifcoo1lptraies s0 rtoxm nodlle  ivsa(f 2rmxroot4aptoifctysla rlnmpn() eerio tadomDelues s0seumxrpoudlmt mfetasfs2um(m ot1opt  f3iatla rl(mp;t4treomrciytfm   neil(0 2toio oydom nmfetlt)sDtmuronu0apt ifetltlm2rauvs ()trtnxfcoadoaD  u s;(0t2uo(m3nu4omtnlnct t) rraum no0oetnioeiys s emu p;() rxnxo3tydoatr ies s sruoir no4ol nlictlt)sDrmum oo1teto ieiyd s ua(vo;()tlxnxo3oa1fm   iei;t)s2trxm3iu4ome lieslt)a2rrur ;o4aeen fctytfm rlnvo t) etrxfciy1opDr ueo;s) eum(m ny4ol e fetas  Dur( pot1tet  o3iysls umums u0trtrmf3iodfa rli i (0s2xrxr ou4ol n ietasfsrum( oot4apxnmfeilt s2emuvsn(0trxnio3to1lp  lieols trur(m3io1amen ietat)srrrump;t1olt mictad aDum( ont4 lerxociytfpD an ilt srxo(r3oo4alen iciat  rrm(rpnu4opx ioeilt aDua(vonu0artrxfctotfa e ivi;() rxr(o3iydome mivsatf Dumuroot4ale mfeild a2el( s u0alxnxr3ty1fm r i i;s s2toim3iudolt lnesl() 2um(rpnt1oexnmf3tlsfm2rl( s;t)alxnir oatfaDeluvslt0srurxo ny4oltemneils)artrumoou4oltniieiysls2ul(mont4trxrxf iotlptraiei s0 euoir ny1ll n fvs ( srtm(mpnt1oex mieild mDrlu p;(4 rerxrcia1fatrauei;s) 2toim3oo1lp  mnes t  rum( o;t4alen i3tlsfaDem( s u4teeomo tydlmD auvs;t0trur(rpnu4ll   fcia() 2rrumpnu0apxoifeiadfs ulu o;u4alxomfcoadfpDelieo;s trtm(rpoo4lp n fvsa()s2ururpnt0aetnmfeiatlm2elums;t) eenmr3iotoate ueils s2ur(m3oydllte ivs (f 2uax  ou0teto ietyt a2emnmo u)aeenio3tadfm elivi;s0sexoir oodomtemnvi t)srtaxr no1tlxnmfeiytlm rlnmp t0 rxoir ta1opDr ivsls0s2trxm iudomt lici t)a2tr(mpno1opxnmi3ils m2umn ont)trenmr oodfaD li sls  2xr(r nodaltnmivslsf 2trx pou4tptomicilsla rlu snu)tltomo3oatopte u s;t  2to(opnu1olenmiei s) Drrx o;o4olxn oeiltfm2emums (0teeoiocty1oaDrliei t sexm(m nu4am emnvi (faDurumpou0tle iiciadlsDuanvo;u0 etoio tadfpte iei ()s2tr(r3iu1aptemiet t sDum(ro;t1olx mieiytfm eln o;u0 lxoir oatlp   i s;t)sexr(m3nodlmtelncsasf Dtmur no4oltn fciyt s rl(vs t0alerifcoy1lmtrauvo;s trxo(rpoo4lptn fvs ()a2ta(mo;t4aexoifeilsla2emumonu4texnif ta1om  au o;(  eto(o3ny1lmt  ncs ( a2ra(mpnu1alenmf3tytlmDemnvp u) eeoirctodoatrlnei t s2trxmpnu4ll  mictltfs2taxmonu1apxomictyd a2um( ont0texoxo to1laD anvolt)s2uo(mpio4omen ies tf 2ra(ronu4aeeomfetltfmDra(mo;t) ltnio oodlp e i olt) rtoirpio1lpt licia(f rtm(r ;o1apeo feiysla2eluvpnt4tetomf3oytlmte ueils0trtoiopiy1omenmfvs (fs2rax ont0alx  fciysfaDem(monu0teermo tytlm elnvi;t0 etr(o3iu4alte ivsasfs2umxmp;o1alxnioetyt m rlnmo t4 rtnmr3iotlmDr i o s s2tm(opny4amt lnctlt)srumumoou1oetnioctysfmDumumsnt) etrxrcty1lp ranei;t0texrim3no4llenmicsa()srurxmo;o0apeoiicilslm elu p u4trxnircty1omt  ieo;t  etrio iy1ole mnvil() ruaxm ;t1tleomoeild mDrmumpnt0trxoxrcoydom eaueo;s)s2xr(rpiydolenlncsatf 2ur(m nu1oee  iciasfa2rlnvsn(4 lxnxr iytlaD ai i;t)teuoim3no1altnlfesat artrum nu1tlxomfetas m2ean p t4 rxrmr3ootopteaivi;t0 exoxr oudlpt  fvtlsf rraxmooo4olxniieiydfm2rlnmpn(0teerxr oydfmDe neils0srur(m oy4om   fci sfarumu  ou4oet mf3tas m2ulnmon(4trxnir iadfm eluvs;t0s2xr(mpiydolte ivt () Drau oou4tpe mo3iadfaDul(mon(0alerio todfa  aivolt seuoim3iu4ol nmfeiasf rtm(rpnt1tetniieiadla umnmsnu) exomf tatfa eau s;( s2umirpno4lptnmnet (fa2rm(moou0oetomi3ildlm em(mo u4teerxr3totopDrlueil(0 2umxr3iy4lme mnet s)arurxr ;o0apeomfetasfmDem(mpnu0 exrxf iatop e ivs s  2tr(opno4lmt liesls sDtaur ;o0tpx mieiyd sDeaumonu) lxnir3oydlat  ivs ()sruoim3nydolee nvi s  Dtaxro;o4oexoif3iydlm2ulump u4 rtrmociodlmt lnvi s0sexm(r3oodlpt  ncil( a2tr(rpnt0olt  f3iys m2ra(vpn(4 lxomo ootopDrli ol(0srtoxo3oy1am nlnvs (f rra( ono0opx mo3iydfaDuauvont4texoio3oatlpDrauvo s srtoir3oo4lm e ies t sDurum ;o1aeen ictyt aDrmnvs;(4 rtrxo iy1lptrlueo;(  etrimpnodalt  ivils sDtau  ;o1aetnioeiatlaDraumo (4 rerxrctadfa rlneo;t) 2xm(rpiy4ap   netls aDra(mo;o0oexn ocildls2ua( ont0aleomf3ta1faDean ilt  etrxo3no4ap elnvtl(faDrmxm ;u4opt  ictydlmDeaump u4 lxrxf3oa1lptr ieslt0sexoxrpny1lltelfeil() rrr(monu1apxo feiasfmDelu s;(0 exomr3iytfa   ieilt0t2xo(m3oodlm emivtlt  Dtmumoot1tpenifeiydfsDuluvs (0trxomo3tadfmtelnvols) ruoxr3iu1lmtelnvsat)artaump;t0tleoio3ilt m2ua(vp;(4trtriociy1fmDrluvs t) rto(r iy1olen ncsat)arumum ;o1aee mo3tytlsDrm(vp;u4aetrxf3oy1lmt luei;t0srtm(m iy1am e fcs tfs2taur oo0aexoifeiadlm2ea(mp (0 etrirctodfmtrli sls  exoir nudlpenlfvia(  2tmxmp;t0alt mictys a umump u4artrmf3totlpDr i s;()sexo(o3ou1amte nvsasf rtmxmo;u0tpt iietldlm uln o t)tlxrmr tadlat  uvsls0trxrim3no1apeelfvt s)artax  ;u1tptn f3iytlm2eaump;(4 rtrxr oy1fa   n i s tetrio3oodop   fvsa() 2rrx o;t1olenmf3ilsfa2ea( snu)altomociydla  aues s) rtoxr ny1al   nctasfaDtr(mooo1oeto i3tlt m2ul(vont0tltnif3todfp r neo;(0 rxr(opio4optnlfvil(fa2trxmo;u1tpe moeiytls2el( o t)arxoxocia1fmD luvi (0s2trio oo4amtnmfcilsf rra(mp;t1tpenmfeild m2rmnvs;() rxomr iadlpte u s t t2xo(m3iu1llt  iesl()s2tmu o;t0aptniociasls2rmu s (4 rtnxo tatfm  liei;( tetmiopny1opte fvt ()s2rau oou4apxniiciltfa2emn p;u0tetoif3ia1la   ivi;t)setr(r iu1lpeelnvs (faDrr(  ;o1tlenmietytlsDeln o ()texomf ta1lpt lnes;( tetmxrpnu1omtnlneiatfa2rmx ono4aexniieild s2eau snu0 rtrif3iatoa  lnvo t t2uo(r3iudaleemncsa( srtm( oou1oeenmfciltfs2em( s u0trxoxr tydfaDr n il()setmxr nodapenmivtl(f Dtrx o;o1oleoiictls m2rl( s;t4texrir3to1fpD  ieil(  rxoxopio1op emfcs t)a2ur(ront1tetomi3ildfaDrmn on(0alxnmf3tytlm  luvo;t tetmxopnu4opte netatfarrrxrp;t4tpxoiocildfa uan p;u0tetrmo io1fmte ueol()srtmir ny4amte nvia()srtrx ono4oexn ocils sDumumpn(0arerxoctatlpDrlueil()trtmxm oy4lle mnei ( a2tr(monu1optoiieiydfsDumumpnu4 rxoir ia1lpDe ivs s0s2tmxm iy4lptnmnvtl(fs2uaurono1aptniocilsfs eauvsn()arxnxfcoytlpD anei t seuo(m3ou1lm  mncil( srrmx pot4aee mfciat sDemumo;t) rxrmr oodla   ueo;t  2uoxrpiu4al   iesatfarrrxrpou1tetomi3tytfmDean s t) lxrif3tatfatrluvi;t)s2trim3nu1om n ies tf 2rm( oou1texnio3iatls2ul( o;t4trenxo ootfpt lues;t trxmxo3nu4lme mneta()srurxmpot4tlx ifcilsfs elu snt0trenmo io1lmteaues () exrimpou1ope  ivta(  Dur(m ot1tptn iciasls2emn o u4 rtoio ia1fptr u i t setrirpoo1ap nmnet () Draur nu1teeniociad aDua( p;u4arerxf ootfmDean i;s0s2trio iydame lfesat)s2urur ot4ope ioctytlm2eln snt4trxomo3tatfm rluvi t)seur(m3io4lpee fvtat  rrr(m ;t0apxoii3tydlm2em(mp t4tetrmfciadlatrauvols0 rxrir ny1olen fvils srtax poo1altomfeiat s2raums;() renirctydopDe nes;t0seurxrpnydlmtn fcsl(  rum(mpot0tpeniiciad m umnvp;t)tltrxrcoadfm ranvo t trurimpnodop elietl( a2rauront4oex  fciyt s ranvsn(0 ltomrciatlaDr ueilt  ruo(o3oy4am  mnvtat) Drm(mpno1aeenmf3iad a rln s;u0arxrmrcty1omt lueols) 2xrxo3oy1lle mnvsa() rrmxrooo4alxnioetldlaDrln snu)tetnmfcto1lmDelnvi;( setr(opiy4lpe  iesat  Dtaurpnt1optnmiciat s2ulu on(4 exoxocootfmDr ivo;s)s2umim oy4ole lfciat)aDtaxrpot4olx mfeiadfm2ua(vp;u) lenif oa1opD au s s srxmimpio4amtelnctlsfsDtmuro;u0oeenioeiyd s2umuvo;t0 lermfcta1fmte nvs;s) eumim3no1optelies ()srta(rooo4alt  ictys m ea(ms t0aexnxfctadlm  lnesls0t2um(r3iydalt mfciasfaDtr(m ;t0apenmoeiyd s rl(vs;u4 lerif3oo1fat lies;t  2xrxm3nydam elnct s srtax  nt4alxo feild sDemnmpnu) lxnmr3iodlmtelivo (0tetrxr no1opt  netlsfaDua(r ;u1alxo i3iys m rmn o;(0tleoif io1op elivolt) 2umimpnydlme  fet t) 2taurp;u1oeeo o3ils s rl( s (4tlermo3io1lptrluvi;t)t2urxr3io1ol emfeia(fsDumxm ot4ole mf3tysla elnms;t4aeenxrciadlpD aivo t0trurxo3oy1ll nlfvtls)a2taxm ou1apxomoeiysfm2ran o u0tlxoxo3iytlaDr ieo s sexoxr no1al emieilt) 2urx ont1texoio3iysfs emnvo t) rxrxf oatfptelneo t0texr(mpou1omenlfetls sDuaumpot1aexnmo3iytla2uau s;t0aleoxr3tadomtrluei t)srtmxrpiydamtn ivslt  Draum ot1tlto oetadfa ea(ms;u0aetrxrcoydomDeanvils t2xrxo nu4optemivsls) rtaumpnt0aptnio3ildfm um(msn(4arerxrciatlmtelivo;t0sexmir nydlme livt sfsDtru  ;u0oexnii3iytfs2um( s u4 exrxr3oadoa   n s s) 2xmxr3iy1lp emies s a2tmxmpnu1opxomo3ils m ra(vo u4 rxoir3totlaD auvs;s) rxmxo oo4lpt  nvtls aDrmxmpnu1optomf3ild m em(mp;(0trxnif oydfmDelneolt  2uoxm3io1am   nei s)srumur nt4tee iieilsfm2rm(vs;u0areoxfcoa1fp elnvs s0trurxopoo4opt lfetas)s2uau p;t0ole ii3tytfs eau p () eenxocta1fa rlieil() 2xmxm3io4om e ivta(f rrau  no1alen iciasls2uln p;t4texnmf3oodlmtr uvi;s0s2uoxr3oydop elfei ( a2taxrooo4aexo ieiat a2ua( o u)trtrmf totlptelu o t0t2xmio iy4ap  mnvsa(fsrurxrpnu0optnif3ilt a rl(von(4 ltrmrcootfa  lieils t2xoir ny1omtn neil(fs2rru o;t1oex  oeiadlm em(vo u0alxrio io1lat anvslt truo(opnodlmtnmnesas  2tauronu1apen i3ias m2umnmont0alxomf iytop r ivols0trxrir3iu4ap  mivs (  ruau  ;o4tltoif3tys m eanvo;(0alxnifciydlat aivi;(0 rum(opny1llt livtlsf rtaxmpno1tpenifciatfmDrluvs u)tlenio oa1op raueo s)srxr(m iydaltnmnvt tf Durur ;u1tex miciad m umnvs u)trenir iodlatrluvs t  rumir3ou4aptnmieia( s2uaxrpot0oetnmfciydlaDean o;(4 rtnxf to1fat aivsl() eto(r ny4lp elivsatfs2umxr ot4tlx mi3tadlaDelums;t) rerxfcootla   uvo (  2um(m no1oltnlnci (fs2trumpno0aetnmfctltfm2emnvs;()arerxocia1lateauvi;s)trxrir iy1optnmnvtat)a2uau o;t4tptn ociasfsDumnvsnu4aleoxf oy1oa   nvils tetrxmpiy4ol  lfct s aDua(mont1oltnmfciadla rlumpn()aetrif oatomDraivo s0seurio3oy4omt livt s) rtrurpnt0tpto fciaslmDeanmp;u4aeenioctatla rlneo s)setrir oo4ape  ieils  Dtaxmooo0tpxnii3iad s2rmnmp ()artnxf io1laDeai o ()s2trxo3iy4om emiei sf 2ur(r ;t0tex iiciytlsDrluvsnt4aexnio3ootopDrliesls t2tmxm3nydole lnvsls)srraxrp;o0tex  octyslm2rmn p;t4 rxnif iatfm eauvo t0 ruoxrpiu4op n nvils) 2um(r ot1alenioeild m2rmums;(4aetnif ty1latr u il(0 rxoxm3ou1aleemfes s a2rr( oou1tetnmfeildfs2eln pn(4tetomfcta1lm rlu o;t)sruoxmpiy1lp e fcs () rumx poo0alx mociltla2eau on(0teermrciadlaDelnvs t0trtmio3oodaptelnvtlt sDum(rpno0tet  f3tlt m em(msnt) lerxo oodlm  lnvs ( setmim3iudlpeemncs tfs2trx onu4olxo octltlm2elumo t4trtnxf iadlmDrlu il(  2uo(o3oy1lpte nvsat s2tr( ooo1olto icilt sDul(mp;() rerif3oydomD  uvslt) ruoio3iydop nlnei tfsDuau pou1oleniieilsfm emnmp;t)tlxrxrctodom  aieol(  2xmimpnu4oltemfet tf Drrumoot0alt ifeiydfs rau p;(4 rerxr ia1lmD lnei ()tetm(opny4ape mnvtatfsDrr(mpnt0aee io3iydls2uau o u0 exnmo3ootop elnes;t)s2xr(r iy4ol e nciat artm( o;u4tptnioeiytls rmnmo;(4aeeomr io1opD aiei t)srxm(r3oodlm emncil(fsruau pnt0aexoif3iad s eaump u)tltnmr oo1oate neol()trto(opio4ope lnctl() rraum ;o4altnmieiat m2ul(vpn() leoxo3oodfa  aiei;t)t2uoim3oo1lmt  net s s2urx ont4tlxomoetad m ean p;u0trxoxo3iatfmDelnvi () exoiopiudomt lfvsat  Drrx p;t4aptomociatfa2umnvs;u0tlerxf todlat  iei (0t2xrim3no1lme lfvsa( aDrm(rono0tleo ietadls ulnvsnt4 etoxo3ta1laDeaivslt sexoirpiu4aptemiet s  2umx poo1teenmoetls m2ul( p ()tleomrctytfp elivs ( tetrxrpny4lltnmfes s a2urxm ;t1opeomfeiad a2eln p u)tlxrir3iy1lptr iesls sexr(r3oudlmtnlfei t)a2tr(r no1oltnioctytla em(ms;t0 rtnxrcia1lp elies s seuoimpnudllt mnetlt arur(  no1tptoif3iyt mDea( s u4arxnmf3io1fm elnes ()teuo(r oo4ale mfeiat) rra(m ;t4aleniietldfa2umn p;u)altnir3totopD ln ols)s2xoim3iu4lp nliet sfsDtax  no1tlxoifciytlmDrmn o u0aexrio3to1oaDr nesl( t2tr(mpio4op  livtls)srumxronu0teen ieildla2el(vo t0 rtoif3ia1fmDraiesls0t2tm(mpio1alt lieia( arum(moot0apeoiieiydlm ua(mp;u) eenio iodom e nvilt)t2uoxo3iydll nmies (farrrur ou0tex  i3tlslmDelums t0arenxoctotla rlueo s0 eur(opiudap nlietls)a2ua(moot0tpx  oetasls2ul(vo ()teeomrciadlpDelueils t2toxopou1lp   fvil( sDua(  no1tpen feilsfa uaums;t0trenio3iatfa e nei (0s2uoxrpiy1amte ivt s)s2tmxmonu0tltomfcilslmDemums;(0alxrxr3tydfp elieo;t0 eum(o3nudlp  lncias aDuax pou1apxoif3tad aDrl(ms;(4trerxf3tydfate ivi;(  rxrir3io4omenlnesas)srur(rooo1opxoiieilt a eau s t4tetrio ty1lpDeln i s0 exmxopnodlle  feia()a2raumonu4opt  octysla2ua(vs;u0 lenio oydfmDelu s t) rtoxm3ou1apenmietatfs2rm( o;o1oltnmieiadls eanmp t4aleoxo tatlaD  uvi;s0 rxmxr3nudame mics t) Drm(m ot0apxnmfctlsfs2elumpnt0arxnmr3oytlmDe u o t trxoir nu1ol  mfet s)sDtaumpnu0tlx  ieiatla2ranmp;t)aetoxrcoydopDrlneo;t)seuoxo nu4apeelfvia()sDum( ont4tleomfetatls uauvo ()altnir oadoaDeau s;t  rtoiopiydameeliesl( sDra(  ;u1tet if3tydfm ea( onu4tlerxfciadopDelueo t texr(o iudopenmfetls artaxrpou1oexnmictadlaDelumonu4aetnxf iydlat anes;s) etoio3nudomtemivs t)a2rrx  no0aee mfciysfs2umn s ()tlenio3iadfp eauei;(0 2tm(o ny1ol n ncia(f Dtaxmpnt4tpenmiciyt a eln pn(0 ltrir tatomDe nei;s t2ur(o iodlmtelneta()s2ur(ronu0aeenmfcilt m2emnvsn(0 exomf oydopDr nei t s2tm(rpou4am elfvt tf rtax o;t0texn fctydfsDumnvpnu)teermo ty1oate iei s0 rurirpoy1apte nvil( srra(mpnt1oexnmf3ias a rmums (4 reniociatlpDraivols)trtmxo iy1lm nlieilsfarrm(mo;t1open feils aDea(ms t) etniociydlaD anvil(0srtr(m ny4amtelfvs (  Dtrx oou4tlx  o3tat s2ran s t4 rtrmo3iotopD au i;t)sruoirpiodlpe  ies t sDtax  ou4olxo fcildlm2ulu s t)tleomocoa1fa r ivi;s)t2tm(r ny1ome livtltfsrumurpno0tpt mi3tldla2ranvs;t)tetnmr totop r u o;s texrxo3nydomee nvs (f 2tmxmp;o4alxomoetlslsDeln snu4artrxr3ta1lmD li sls0seum(m3iudlm nmncil()artrxm ;u0oet mo3iytfmDrl(ms;(4 etrif ootlp   nei s srtm(mpou1amt livsa(  2um( pot1opxn ieiysla rmumo;(0treomr iodfmteaieilt setmir3iudoleelfctl()s2rrxm nt4oexn ociad s2rlnmonu0aeeoir todfmDe i ilt  rtoirpoydlm  mfvtasf Dta( poo4texoiicilsfa2ra(ms (0altrmf tadlm   i s;(  exmimpiy1openlncsl(f Dtmu p;t4open ieiatfm2ran s;t) etnxr3to1faD au s t)s2tm(o nu4lp emieta(fsDraumont1ale  fetysfs2elnvpn()trtoir oy1lm rau slt s2tmxmpiy1altelfcs s aDtmumpno0tetnmi3iytls2eauvo;t4aeermf3iadlp eliesl( sexoxo nydaltemfvi () 2uaxront0openmoctatla2eauvs u0tltrxo3todomt  ivo;s t2xrxo iudapt  fet s)s2umu pnu1oee iictlslm em(vp u) reoxr3oydlmDe u s s0 rxrim no4altn fes s)a2uau oou0ale iociasls2ua( o t4 reoxf oo1lmt  ies t0s2ur(opiodameemncil( aDurxmo;t0oetoiiciytfa elnmo;() ltomo3io1opte nvi () 2um(opnu4apenlfeslsfsDtmumpou4ape iieildlaDelumo;(0 exoxo oodfa rluesl()sexmxopoo1optemfetls sDumu oou0oltoifeiad m2uan o;t)tetrxf oytop rai s s srxr(r3io1amen nei tfarur( o;u1tee ii3ild a eln s t0 eeoif3to1fm eln ols) eurir3iy1lleemfct tfa2rm(mp;u0ope mo3tysfm umu snt)arenirciytlatelnvsls)seuo(opnu4llte ncsa(fsrtr(r ou1tetnmi3ilsfm uanmpnt)tlxnxo3iydlm   nvi;t  rurxmpoo4apte nct t)s2umurp;o1tpxnio3ils s2rlnvp t4alermf oadoptrauvi ( trumir no1lm elfvtltfa2rru p;t1oexniietysfs umnmo ()aetrio3ia1om ranvolt0 etm(r3no4ame mfei s  Dra(moot0oeeomictatfm2el( p ()altrxfciytom  lu o s0t2tmxrpiu1lptelfvi s aDur(rono1tpxomiciysfaDelnvs (4artoif ootfa   iei t)s2tmxr ny1aptelivsatf rtrxr nt0oexnmieiydfm elnvsn(0trenmr iotfa eliei (0 2toir ou1llte nesls) Dum(m ;o4olx mfcilsfa2uln s;(4trxnmoctadfatelnei s teur(o oy4lp nlnvtasf rra(r nt0olx mfeiaslmDelnms;() ltrifcia1latran o ()t2tmiopoy4lmenlicsls) 2ur( pnt1altomi3iatfsDranvs;(0aleomr oadfa rlu s t t2xr(m no1olte ics t) rumu ono0tpe  icild aDel( snu0tltoxo iodfm e ivslt  2toio3iodll elfci () ruax p;o1oex iietytlaDelumo;(0tlerir3tatfa  auvsls)trum(r3iu4ome lfvsat sDra(rp;u0opxnif3iytfs2ean s t) rerxf oadop eln s () 2uoxmpny1lle lieslt) 2tmx p;t1oex  oeiysla uauvp;t4 rxrmf iytlpteli o;t  rtrxr3ny4apeemivt (fa2ra(mpot0olx io3ildfaDum(vsnt)texoif3io1lmteaivs (  2uoxm oo4olee fvia(  2rr(rpoo4alt  icilt s2rl(mpnu0altnxr iytlp   uvi;t seuo(o3io1opt liet (fs2tr(roou0oeeniociatfs umnmp;(0 rerxr3iadlmt an s;()s2to(o3no4ameemfctlt)a2uaxm nu4aptoii3tls m emu pnu) leriocia1oa eaues;()srxo(r no4apte ivtasf rum(  nu4alxn o3iytfmDulu p;t0 eerirciydlatr uvo s)trtoxm3oy1lp e icsl(fs2taumo;u0texnii3iatlmDrlumo;t0 eermocto1om e n o t0srxmxm nu1ll   ict tfsDta(  oo1aeeo icilsfmDum(vs ()artoxf3iodlm rli o t0 2xoxopiodope  fvtat a2taxrp;o1texn fetadlm2emumon(4trxoir oa1fmteluvs s s2xoxr ny1olte icia(fa2ta(r ;o0tee  ictldfa ulump;t) lenxf iodoptrluvo;()t2xoxo3nu4om emicsas  rrmuroou1tltn feiyd sDem(mont4tlxrifciodlpte n olt  exmim3iydol e fcs s)a2umxm nt0tltnmociysfm rmuvpn(0tlxrxf iydopD  u i;s) 2um(r3io4olee ieias)aDrruro;o1opxo fctltfmDran s t0 rxnxf3tytfm   nvo;t t2to(rpoudllt mnviat)srtrumpou1oeeomi3iyt s2el(msnt)tltomociydla  lnei s s2umimpno1omenlfesas sDur(mont4tlto oeiatlsDea( sn(4tetrxr oo1laDr ueil(0srxrxopio1om   fcsls)s2ra(mont4apt ifeiydfm el( o t)tleoxr3oytfm elies;s  exrio3oy1ale lfcsa() rraum ;t0opeoioeiadfaDrauvont) rxnmr3oatfpDr uvi;t0trto(mpoydlpt  fcsl() Drmumpoo0altn feiydlmDrlumsnu4texnifciotla r nvols0s2trir oy4ole liet tfa2tmumpnt1apto ociat s um(ms u) eermfctodoa rln i;()s2um(mpny4lm  mnei tfarrmx  ou4opxo o3tat mDelums u0arenxf3ootlmt au i;t) eurxm3io4ll   fciltfarumxm nu0opxoioeiyslmDean snu0teenirctytomD li o (0trtoir3io4om emfvta()sDraumpnu4olt ifcias m2emuvpn() rtnxrctatfp r n ilt)srtmirpno1omt lfcs t)a2rmxm ot0oltnio3tyt m ran s u)aexrxf oydoptr ieolt  rxoio iy1ol  lics t)aDur(mpou0tetomo3tas s el(mo;(0tlerxfctatop  lies;()trxrxr3oy1ame mnesl( s2rmx pnu1tpxo i3ilsfsDrmu o (0trxnmo3iydoa rau s;()tetrim3ou1lmeemneslt aDuauroot0apen ociysfs2ulnvpn(0tlxnirctotop e nvol( srtmxo oo4lme mnes s a2rmurpou0opx iietydla2uauvpnt)tlxriociodomt aivo;s0srtm(o3oy1oleelneil(  rumx  no0apt  o3tysfs2eanvp;t0aeenmr tatoatran ils tetr(rpio1lmt mietl(  rrmxmp;u1tlxoioctlslaDeau p u4texnmf3ootop r ies;s seurir3nodal n ivsas) rurxmpnt4tptomoctadlsDul(vo;(0tetomrcoy1oaDrluvslt t2toir3oodomt  nct ()arurxmont4apxn o3tyd a2eau snu4 rtnio3iatopDrai s s0s2tmim iodaltnlivsls s2um(rono1aeeo ociytfa em(vs (0alxnmrcoadfaDr ueo ()tetmxm3iu1apenmivsltf 2ua(  ;o4tpeoifciltls ean o t0alxrifcto1fa rlueol(0s2uoxrpoudamtemivi t)srrr(rpnu4ape mfeiasls rau s t0 exrir iatfm rai s s0 2trimpoydam n fcsls)a2taxr ot4olxo fcildlaDulnmo u0tlerxociodfateluvilt trxmim3ny4am n nvs ( s2ua(rpnu4tpenmoeilsfs2rmnmp t)tltomo3totlm r n i;t trtoio nu4opt  fvt t)s2umur ;t4oexn fciysfm2umn p u0alenmrciodlatr i sls)s2to(r3nudopen fcs t) rumur no0tptnio3tat a umnmo;u) lenxocta1lmtelueol()t2xmxopiy1lpe lfesl( srtmur ot1tptomoeiltlaDran on(4teerxocoo1lp  lu s;t s2xr(m3ny1al nmieia(  2tru o;o1oleoioctat aDul( snt) rtnmrcoatfmDelnvolt)s2to(m oudomt  ietl() 2um(mpnt0tpen o3iyd m2elnvs;(4tlxrio3tadoateai o;() etriopoy4omeemnei ( a2ta( pnt4oltnmiciysls rm(monu) eerxfciodlpD li s t0trur(m iy4am  mfvs ()artmx pnt0tptomociadfm2ua(mp;(4 rxnxocia1lat lneo s)s2xmxm iy4lmtelfcil(faDur( poo1tlx moeiasla el(mont0aexnio3oo1lmt  ivols0t2ur(m3oy1lptnlfeslsf Dtm(mo;t4apt ii3ildls el(ms (4teeoxf tydoat aueil(  rur(o3oodllen ivt t)aDumumoou0oet moctytfa2rau o;u0tltoir ta1fpt  ivol(0setrirpiy1lm  mfetlt)a2tmuronu4tptnioetys a2rm( ont0tleoio iytfat  nesl(0srum(r nydopte ivilsfaDur(r oo0aee if3iat aDrmuvsnt4alenxf iadomD  ivi s0 etmir3oy4om n fei t) rtrxm no4aptnmo3tad s rmnmo;t0tltnxf iodlaDrauvs;t0 etmxm nu4ll e fctas)a2tm(  nt4teeo o3iasfs2ulnvon(0tltrxrcootlaD luei;t0t2trio3ou4amtn ncs ()aDrrxront1tetnmo3tldla umn o;u0artnio3todfm  ai i t0texmxr3nodlm n icia()srraumpoo0oeeo fciys a uau o u)tetrif totoa   u i (0sruoir iy1optnlneias  Dumuroot4alxomfeiytls uaumsnt4tlxnif3iodoatrln s s)setoxrpnu1apt  fcta(  rtaxm ou0tltoiicils m rm( ont0aeenmo3tytom   uvsls)srtr(o iy1lltnmfvslt)aDraur ot1tpt  fciaslmDrl(monu0 exnxf tydlaDrluvils  2xoio ou1optnmncsl() 2ua( o;t0ole iiciys aDel( s t0texrmr3ia1lmt  u ols srxrio3iu4ol   neilt)srum(root4aeto ociys m rm(vp;u4 lerif ty1omDrln i t0s2xr(opnu4om emfvt t)s2urum no0tlto f3tatfa rlnmo;t4aexrxf3ty1fmtr nvi;s)srtmxmpiodole  neilt artax  no1tle moeiat m2ul( s;t) lerxocio1fm rli sl(  2xo(rpnu1olt lneias srtru  ou4opxnioeiysla eaumo;t) exnir3totfateln sl()s2to(opoy4olenlfcs sf Dtr(r ou1alenmoeiysfs2um(mpnu0alenio tadoa  anvs;( s2xmiopoy4lpe lieias) Durxm ou0ole mfetls m2elumonu4 lxnmocoytlmtr ivslt)srurir iodomen ieslt)arurumo;o4tptnmoctadfm emump;t) exoiocta1lptelu i s)trxoio3oy4op nmfes t s2rru  ;t0tlxomiciytlaDrlu s;u0trtoxo oydlpteluvo;s0texr(m io4lp   ncsa() rrax  ou4tpeoii3iasfs rmump;(0arenxr todoatr nesls0 2uoim ny1ope lnes s) Drmx  ;t1opt mo3iad a emuvo;(4altomf oodlmD li olt s2uoxo3io4altelnes (fa2tmxmpnu1aetnmfeias mDum(mp;u0altnmf3oadla rlueo;(  rto(o nodop  mivi s)srtrxm no1tpto ieiasfa umuvs (4texoio3iotop e nvi;t0seumxrpou1aptnlnvias) Dtm( ont1ape ifeildla2elump;u0aeenirctotlaD  nei;( seurir nu4ole mies s) ruru ooo4ope ioeiatls2eaumo;t4alxnmr oytlp r nes (  ruoxmpno1llenlicslt  2rm(m ou4oexnifciat mDra(vp;(4arxrxrcoytlp r i sl(0texo(m3iu1oltnlnciltfa2uau pnu0tet iieiyt a uluvo t)aetnmf3oatop ranvi;s0 etrio oudopte fcsltfsrrrur ot1oetomoetls sDeln p;()trtoxf3oadlptean o s) 2trirpoo4lp nmfci () rta(mp;t4altnioctldlsDrluvpn() etrmf3oy1lmD  ivslt) euoirpio4op nmncsa()artr( o;t1texnif3ilt sDulnvs;u0teerxf todfp rau o;(0 etoim iy4lm   ieta( srtrur ou4texnif3ilsls2rln o;()teeoir3oadopDraivol() 2toir iydlltnlfvsas)aDumur ;u0tlenmf3tyt m2rm(vp;u4artnxr3to1laDeaies;()sruoio3io4altnlfctasf rra(rono0apxnmfetldfa2rmump;(0arxnmf3ia1latrlnvo;(0trtmirpou4lp emfvtls)a2rru  no1ale mi3tysfa ul(vo;t4 eeomo oy1lmte u i (0 exmxopoo4am n ici t s2ur( p;o4aleoiocilslaDemu pn()tlxrxrctotoptrai o;() rtrxo oy4lleelfci tfs2umu ono1tle ioetadfs2emnvs;(4tetnxr3ty1opteaneo (0s2ur(opnu1al emnvsls artrxr ou1apxo o3tyslmDrlu o;(0 lxoir3iodlp rlueilt)trtmxm3ou4lpenlfes s arrrxro;t4texn fciasfm2rau s u)tetnio oydfp  anvo;s srxoxmpoo1aptnlivs ()aDtmx pot4aex iocilsfm2rmumo;u0aeeoxf tadlmDeln s;t0setrxmpnydlpt mies sfsrua( o;u4alx mfeiatls2ua(vsnu4texnxo3totlaD  n s;t t2xoio nu4ll nmnvtat)a2uaumoou4aetnmiciys mDrln pnu4tlermfciy1fa  lues t sexo(r3iu1oltn neias sDumx  ;t4aet mi3ilsfmDum(vpnu0 lxnmr tadlatr uvi;s)truoxmpno4ope mnvtl( srrr(  oo0opt  fciat a2ean o u4altomo tadfpD  ivs t)t2umxmpiodame mivs t  rrax  no1aexoio3iat sDemnvs (0trtrxf3to1fpDr nei s)s2tm(r oodop  mnvtasfsrtm(rp;u4oltoif3iltfa2rmnmont4arxomoctodfa rauvils s2xrxr3iy1op nmnet sf Duaxm no1tpeoiiciatlm uauvo (4alenirctatop  aivs;t  rxrio oydap n nvilt) rurumpou1aex  ocias m2rmn o;t0aexomocoydfpteaneol() 2umio3iudlmen ivia(f 2rmur ;u4olxo f3ilslm2ulumonu) eenif ta1lmDr nes (  exr(o oy4alteliet ()aDur(  oo0aleo ieiltfm2ulnmsn()tlxomo3oo1fm  li sl() 2xrxr3no4amen nvias a2taxmpnt4alxniiciydls2ul( o ()aetnmo iotfm  an o;t t2uo(r ny1ol n netat  rrru oot1opt iietasfs elump t0aetoir3oytop elnvi;s0sexoxo iy1amtn fetat)srtmx  ;t4tetomoetasfsDrlu s t0aetoxf oodfmteauei;(0 etoxopiu4lpeelfcsl(fsrrr(rono0tetnmo3ils sDrlu o;u4aeermf3iodfp  au s () 2ur(r oydomeemfcsat  2uax  ou1aex  fciadla2uluvp;(0areoiocty1lpte ies s0truoio nodopee nvias)sDra(m ot1aexo fciadfm el( s;u4aleoxf3tatfatelnvo s)truo(r3nu4lm   fct (  rrrxr ;o1tptn o3iys a rl( p u4 lxnmo oodfmtrluvsls0 2tm(r3ou4omenlies (f Dtrxrpnt0opt iiciltls eau o;u)tlxnirciadfatelu i t t2xo(m3nu4openlfetl(  Dur(  ;t0texo f3tasls ulnvp u) rxnif3iodfa rlnvslt)s2xrxm3oydom e icslt)srtmxmpnu0tet mo3iadfaDem(mo;t4aeermr3iytfpDeluvo;s0 exm(r oo1ale mfci (  Duru  nt4oex mi3tlsfa eluvo u)tlxnmr3iytla   ivilt)trxm(m3iy1ape lncsl(f rtaurp;u1alxnmoeiatlm emuvs u4 lxnif totlpte u sl()texm(r io1amtnlnvt ( sDum(mpou0olt mo3tadla2emn o;t4tleomrctodomt  uei t  eur(r3iudolen nci sfa2tm(m ou1ale  feiysla2uanmonu) rtrxr ia1fp e ivi ( truo(o iydaltelfct ()aDtaxr ot0apx mi3tat s2um( s (0aetrmrctodomD lnvo;() 2tm(opnodll elivs s) 2ta( ono1teenmieiysfa rmu snt4tlxnmf ta1omt anes t0trxoxo iudlm n fvtlt sDrr( ono1apxnmf3iys sDel( p;t0aexrxr3tydlmtelues s0teurim oo1ll  mncsas) rrr( onu4altnmf3tasfmDrmums t4trtoxfciadfpD anei;s truoxo io1opt mfesas sDta(  nt4aeeniieiasfs eanms;(4tetrxfcoo1fm eaivs (0srtrio3nu4lp elnvs ( sDrr( p;u4olxniiciatfa2rluvon(4 eermociotop   ivsls)sexrir3oo1lm   fvt (fsDrr( pno0ape mietas m rl( p t0 rerif3tadlp rlneols s2xm(mpiy4lme  ieslt) Dum(  nt4olenmietadlm2ul(vp;t) rtomo ty1fmDe n s s0trumio iydomte ies s arrr( o;t1tet iicils m2ulnmp;t4tltnmf3iodlpD li o s srtr(m iy1omee fcsat)artmx pnu0tpx mo3tatfmDelumonu4tetoio iydlm   nvi;( setmxm iydolenmfes t srtmxr ;t4teeomfetydfs rmnmpnu)tltomo todoa e n o t0sexoxopnodal emfet s artr(r ou4oeeo ociysla emn s;u0tlerir3tytoptranvi t trtm(r3nudom e nctasfaDum(mont1oltnmieiltls2uauvs t4tlerxr oydfp   i o ( sexr(o iu1ap elics tfarumx  ;u1tltnmoeiysfs2um( s t)arerxoctadlm rlnvsls0 etr(r oy1lpte fci sf 2rrxro;o0aexnmfcild a ul(vsnu) etnio3ia1omtranvi;s)seur(m oy4llenlnesat) 2ua(  ;u4apt  i3iydfs2rm(vo;t4 lxrio3iodoatr ieo;t  2uo(opou4alt  nct s)arur(m ;t4aex  iciytfmDuauvs t)altnxfciydopDeln o;t seurir ny4altemfctat) rrm(mo;t4tltn oetas mDrlnmo;()altnxfciy1lm rauvs;(  rxmirpou4ol  lnei s a2um( poo0aee  fctytla2emu p;u)trxnxf iadla  luei;s0s2urxrpny1apenmnvia(faDtmu o;t4alenioctlsla2umnvp;u0arenxo3oo1lmt lnvi;()trxmxr3nudame lnes sf rum(m ;o0tet  o3iaslmDumnmp t0tleoxr iy1op r u o;t0srtoiopio1op n ictltfsrtaurpou1aeenio3iadls2uau o;u4alenxo3iadlm  aieils0 2toim nu1lpeelfcs (farumur ot4apxomfciad a rm( o u4 rtomr3totlpt  ieils  rxr(o oo1al emfvsls srrmurono0oexn o3ilsfs2emu pn() renmrctatfa rlu o;t)srtoxo3iu1altnlivtas s2rr(  ot1olx moeiytfm rau o (4 eenxrctatfm r ivo s) rtmio3oodam nmies s  rraxr oo0oet ifcias sDua(vp (4 etoirciadoaDelues;s texmxrpiodam   fctas  2rr( o;o4texnmiciydfs em(vo;(4 rtoxrcto1oa  lu o t  rxrio3iydlpenmiesltfaDtmu  no1ale ioeiad mDranmont0 lxnmo3ty1oaDraieol(0srtmir iy1lm eliesl(  rtm(rpnt0oleomf3tyt m eanvo;u) exnmr3iatla r n s s) 2umxrpiu4op  mfvsat srrr(rp;u4apxo ieias sDrmn o;t) ltrmociydfaDeau slt0s2trir3iydal e ncs s) rua( ooo0altoio3tysfa2ul(mp;()aeermr ootlpDelueo;t0 ruoio no1op nlnct t) ruaum ;o0aee iieildls eln onu0arxrxf tydomt  n i ()srtmxr iudope lneiatfa2tmurono4olxoif3ias m2eluvp;()alxnmo oytlmDrlnes s0 ruoxr3oy1lmt mnctlt)arraxrpoo1tpt moeiadfaDuln s t0aexoir3tatfp  lnvs s)t2tmxm oydlpt lfeta(  Drruroot1tpeomoctltfs rlumo;t)arxoif oytfmD anvo;( trtoxr oo1ame miciasf 2tr( pno4olx ioeilsfm2el(mo u4arxomo oodopte u olt)t2xmxr3ny4ap   ies t)aDrr(r no1teeomfetlt m el( s (4artrxr ta1omDeliei s srtrimpiu4aleemncs sfsDtmumoou1optnioeilsfsDelnvo t4tltrio3oy1optrluvs;t)tetmxr3io1opeelivtls s2umu p;u1oexo ocildfmDulumont0 rxnxo oy1fat an i;s)tetoxmpnu4omen nvs ( aDumxroot4tpen o3ias m ul( p u4alenmf oodfa   ies t0srxmxr iy1al n fcilt aDrruro;o1olenmo3iltfaDra(ms u4 ltomf3ty1lmteauvs;s)srurir iudameemfeiat sruaurpoo4ole  oetatla eau s t)altoxo iydoaDr uvolt trxrim3oy4lpt  fcs s  ruaxr ou4texnioeiydfs el(vp;(0aetoxo3todlpteai s s0texrxm3nu1opeemics s)sDumx  ;u0tpx mf3tltlmDumu s;(4alenmo tytoaDr i ilt  ruoxm nu4olenlietatfs2uaxr oo4tltnio3iysfmDuanms (0aexrxo todlpD anesl() euoxm nu4op nmivt (  rtmxr nt4olto octydfm2umnms;(0trtrxrcto1fp r ivsl(0 etr(mpoudlmtn fetat artax oou0oex ioetatfs2umnmo;(0 ltrir oa1fm rlnei t)t2xrxr3ou4om e iet s aDrrurp;t4opxomf3iyt m2elnmp;(0trxrxo3oatfmtrai s;t t2umxmpny4opt mict (fsrrru ooo1teeo feiaslm ul( s t)tltnxrctotla elivo t seuo(o3oudol  licils artm(mpnu4opx mieiyslmDuaump;t4tlxrxocoa1lptrli o ( seuoxm oy1omte ieslt  2trxroou0opxomi3iydfa2ul(vp t0alxnxo3oy1omDeauvolt)trxm(m oydoptnlnvsas a2tr( oou0teeo f3iyt a2ul(vo;t0trxoxr3todop  lueo ( trumxm3iu1ole mfeta( s2tr( oot1alt iieiatfa2el(ms u0trxnir oatomt aueilt)seurirpou1al n icta(fsrtm(mont4oeeo o3iadls ran o;t0 rxnmr todla rluei;t)s2trxmpnudapenmfcsasfa2umum ;u0tlxnmoeiadfm2ranvsnu0 rxrxf3todoaD lnvo t)srurxo3oydlpt lneilt  ruaxm ;o1tpeniiciysfsDel( on()tltrifciytlpDrlneilt t2xo(o oydlmenliesls)arumx pou0aexomf3ilt sDem( s t0tleomfciotlp rlueo;t s2xoxo iodlmeelfci t  Drr(mono1apxo oetltfm2rln p;()texnir oytopDe ivsl( t2uoxm3nu4ape lnvils)artau  no4aex ifciyt s2umnvpn(0aetrifcoo1latrli o;s seur(m iy1lp nlicsltfsDrau  no0tpxomi3tad a2umumpn(4aeenxf to1late u s;t)sexo(r iodaltelfetas  rrau poo0tpx iictatls2eanms t4aeeriocoodfmt  ivols  euoirpiy1ll eliei sf 2tau oot4tpeo fctyt s um( o;(0trxnxr3tadlp r u o t  2xo(m3iodll   ivt t)arum( p;u4tptnmoeiasfm2raums;() renxo3tydfp   u sls)sexmxrpnodalee ivt ( s2rrxmpou1altoio3ildls2el( p;t)aetoio3to1fp e i il( setoxrpoo4lltnmnctl(f Drm( o;u4tlt ioeiysfmDelump t4alxnifcoatfat  nvs;t  rxrim3nodlme  ivt s)aDur(m ou0tleo o3iaslaDulumsnt0arermo iytopDranvilt0srur(o3ny1llee feils srua(mooo4tleomf3tydfm ea( o u)arenxo iatoaDe n i;t s2uoio oy1omtn fci ( sDrmxr ot4tee  fciatls ra(ms () etomf3totlatrlies;()t2xmirpio1openmneslsf Dta(rpot4apxoifeiat s2ea( s (0 lenmo3iatoptraneo t0s2uo(o oy4lmt  nciltfa2uaxm nu1ape  o3tytls2rm(vo;u)arerxociadfp  anesl(  exoim3ny4om elfetasfs2tm( p;u4tpe  oetadfs ul(mo;u0 etnio oa1fa eai s s0 2umio3nu4apee fvtlt) rururp;t1texo o3tyslaDulnmo;(4artnmr3oo1om ranvolt0srxmio3iu4apen fet tfsDumu  ;u0alen ociys s2umuvo ()texniociytlptrln i t)s2uoxmpno4al nmfvta( sDumx  nu1tltniiciyt sDumnms;t0alxrif3ootlptraueo s) 2to(m iu1om  mfes t sDumxr ;u4opxnmociadfs2ea( s t4trxnio io1lp  ai i;s sruoiopoydoptnmnetasf Drru ono4tlt  o3iysla uanvsnt) etrmf oa1oaDeli o s)sexoxm iu1ap emnes (  rtr(rpno1tee mieiydlaDulumsnu) exnmo3oydlp r nes t)trto(m iy4ol e fet t aDtau onu4aeeoif3tlt m2em(ms t0altnmr ty1fmDr neo;t0teumxr3nu4optnmfetl( aDum(roou0olx  o3tld a2emn s;t0tltrxr oo1omtr uvslt) exo(m oy4altemnctlt)s2uaxm oo4apeomociyt sDel( pnt0tlxnif to1lmt luvols texo(o3oydalenmfei s  rta(ro;o4oexomo3tat m eauvs t0 lxnmf3ty1lpteau o;t s2urim oydlptnlicsls)srumx  ;o4opxo oeiyslm2ul(ms;u0arenmoctatlat aivi s) 2toim iy1llenlfesas aDumurp;u1apxo ictasls2em( sn(4 rxoxrcia1lm   uvolt truoxopoodaltelicsatfa2rmx pno0tltnmociad sDrl(vs;(4alxrxf tytfmDr ueol()trtmim3nodoptn iciatfaDrm(  nu0oltnifeiadlaDeanmont4tlxrxo oo1opD lnei s)seto(o io1apt mnctasfsDtmuront4olto f3tatfs2rlu o t)tetoircto1la   u i s  etmirpiydlp   fcsltf rumxmonu4teen ocilsfaDuan o t0areomo oa1lmte uvs (0texmim3oudlp nlicslt) Duru onu4altomoetas s raumo;u0 lerxr ty1omt  n s t0trtr(rpoy1altnmiet s) rtaxm no0tlxoioeiydlmDea(mo (0tlenifcoodfm r uei ( trxmimpnu4omenlnvsl() Dtrx ont4ole mo3tytls2rm(mo;t4 etoxrctatom e ieolt)trxrxmpiy1opeelicta(fs2urxm nu0apeomo3ilsls2el(mpnu4areniocootoaDean ils)s2uoio io4alenlfei s)s2raurpnu0aeeo icilt aDrluvont) ltomfcoatfpDe i slt0t2xoim3ny4lptnlnviasf rta(  ;o1tlenmo3iyd sDeln s;()tleoxrciodop  aivi;s  rxr(r3oy4apee nvs (fsDta(rooo4tltnmiciytlm2ul(mon(0 renirciytomD an ils) eurio iu1al e fvta(f Dtauro;u4ole  feiltlaDel(vo;(4altnio3iy1lpD lneo (0 rxr(opou1lleelfvslt sDuru poo4oeen ictadla2uan o u0arxrxocoy1op  aiesls)t2urim3io1ale lfvtlt  2umumpnt0tlx mf3taslm elnvs u4aetoxr3iadfmD lnvs t0seto(opoudap e netlt sruaxm ;o0aptomoetlslaDulu o u4 rtoio3oa1fp  ai ols)srto(rpnudoltemfet s  Dtrx p;o1aexomfctls a ra(mo ()texnif3ootom rli i s)s2tm(m ou1altnmivtlsfaDrmuro;u0oetomoctydla um(mp t4treoxrciotlm rauvi;s) 2umxrpiy1open nct sfarrr( poo0optnioetls a2eln p;(0 rtrif3oydlpDeln i s t2uoxr oo1ol nmivtls  Dumurp;t0oeeomoeiatla umu p;() renmrcoadfaD liei;t sruoio ny4om nmfciatf 2ra(m nu0apxn ieiasfmDrmn p u4trxoxocoytfm rlivo t teto(o iu4lmen fct t  rrrxro;u1apeomi3iadfs eauvsn() rxoxf3to1lmDe nes;()setrir3io1olenmnes t)s2tmx oot1ope mieiat mDumumonu4alxnmf3io1omt  iesls)srtmir nodape lfetas)sDtaxrp;o4aptnifctaslsDra( o;t4tleoifcoydom e uvo;s)s2xo(r iodlpe  feilsfs2umuro;u1apto f3ias sDemuvp;u) lxnxoctatoaDelnes;s t2xmio nu4alen nei ()sDtaxm ;t1tet ioctydlsDrm(ms t4arxoifctadomDrau sls t2xoio nudamte ncslt) 2umumoou1oexoifctatfm emu o t4aetriocoy1laDeln olt)trtrxopiu4apt mici ()aDua(mo;t0teeo feiys s emuvsnt4 reoxf tytop  an o;s)t2tr(o oo4omtnmfvil(  Drmumo;t4aptoifciytfa ua(ms t4 lenir iatlpDeanei;t setoxopiudopt mfesas)s2ur(m no1ope iociad m ean s;()altoxfcia1opt an s;(  exmxopiy4am  mfvias)a2ta(r nu0oee  o3iaslm2eluvo u4arxnmr3oy1fm ranvo s) eurim3oo4olenmncia(f ruax pnt0oex ifcias sDeanmp;u4trenxrciodoatran s;(0srtoirpno4llt  fvtl() rurur ;o1tex mociyd mDulumsn(4tltoxo3iytlpDranvs;s)srurir io4ap  mnvsl(faDrrumonu4oeeoifciadlaDra(vsnt4alenmf3todfmDr n i;()sruoxopiu1lpe  fct sfs2trx p;t1oeenmoeiyt m2um(vont4 etnxf iotfmD li o s)srum(mpiydlle lfvtl(fsDraump;o0oltniocilt m2ea(mo t0arerxf3iytlat aieils)t2ur(mpiu1lp n fetltf Drrump;o4teeniociatlm2um( snu4 ltnxr oy1fp r n i;s  2toxo iudolt  nvt t arur(root4alxoifetls a rm(ms u) lxoxr3oydopD lnes t) exm(o3io4lmen fct tfsrum( p;u4ope mfctytfa2emuvont0treoif3oo1lateanes;() eto(r3oodopt liciat a2ra( ont0aetniicild aDemuvo;()altnmo oo1fm  anes s) 2to(m ny1om nmivtas  Drmx oot4tlenmoeiydfm2umump;t)tlenmfctydomD  ivo t)seum(o ou1alte fcsa() 2rrxmpou4apeo ociydfmDumnvo;(0tlxomo3oydopDrlueil()tetmiopny4ale lnvtat) rurx oot4aeen fciytfa2ul(mp u)tetrif3tydop rlnvol(  exr(m3oodal n nciat) 2rr(root1alxoifeiysfaDrmuvsnu0aeerxo iytfp ranvi;s0seuoim3io1am e ies s)a2uax p;t1tlenifeiadfa rl( s;(0arxoxo oatoaDelivs t srtm(m oy4altn ics s  Duauront0tptn i3ild mDra(msn(4aeenxf3tadomD au sl( srumio oudap  licta()a2urxroou4aetniociatlm rm(mp;t) etrmoctatfa  ln i;s0trxrxr3oy1oltnlfvs sfarrrxr ;o4olx ifciyt mDrau s (0tltrxr3ia1omDe i sl(  rxmxm3oodaptnliet (fsDtaum ot1tpe mieildlm2eln s;u)tltrmo3oy1om r u ols0srxoim ou4olt  ncil() rra(mpnt1ale ii3tydfa2ul( snu0aexoir3iotlmteluvs;s)sexm(m3nu4lle mfeta(f Dumur oo4alenmocildlaDra( s (4 rxrir to1lpD anes;t) exrxm io4al n nct t sruaxm ;t4aeeo f3iadlsDranvs;t4arxoxfcty1oaDranei ( t2urimpnu1altnlfvt tf rrrur ou0teeo iciyslm uaumont0teenxo3tydopt li o s) 2xoio3nu1lptelfcia(fs2ra(rpou1opeoifciatfs rmuvs;t)tltomocta1la rai olt  2umim3oy1omeelfci () 2rmurpoo1optomoeild aDrmuvo;u4tetrxr3tadomte ivo s0 2uoim iydom   ieiatfa2rrxm oo4oeen fctatfs2um(vo;u4tltnmo3ty1fmt  u i t)seurio ny4op n ictls  2uaxmooo0altn ocias m2ulumsn()alxnmf to1fmDe neils0s2tm(opnu1ope mnvilsfs2truro;t4texomictatfmDuln p t)tlxoio ty1faDraivi;(  eumim no1ope lnvtasfarumxmpnu0oet mf3iydfm2ea(vsnu0tlxnxo iodlpD livs;t0sruriopoo1lpt lfcil(fartrxmpou1apeo fcildfmDuaump;t)aeeoif3iytfateanvils  rxr(rpoudlmt mivt s)sDum(rp;u1optnioeilsfsDrlumsnt)tlenio oadomtrln o ( setr(rpou1lltnmiesl(  Dum(mono4tle miciydlm elnvo;(0teeoio ootfpDe u sl(0s2ur(m oy1am n fvs s  Drr( pno0apxo feilsfsDran on(0 rtomr3oydfp r u sl(0srtr(rpiu4alee nvilt)a2rm(mooo1tlxoiieiadlmDrm(msnu4tetoir3iytomDrluei ( tetoio3oodomtelfvtls aDtmu pnu1teen octlslm2rmn ont)alxrmf ia1lp  li s;t)sexm(opiodlleelfctltfa2tr(m ou1oltnmf3iatlm emnvp;()alxoxr oa1oaDe nes (  2umxrpiu1ale livil()artru  no1tpxnmieildfm2uln pnt4artrmocia1fptelneols t2triopoudaleemiesltfaDrr(  oo0optnmo3iydls2eln p;() rtrio3tadopD  uesls)s2urxmpio1omee ivtl(  2taurpou1aexnio3ilsfa ranvsn(0aetomr oatlatraues;()sexoir3iudlm  lnvs ()s2tr( oot4openmi3tltla2ul( p t0aexoir oo1omtrau i;t)srxoio3ny1lp nmnvsa()aDtr(mono0teeo oeiasfs2emu s;() rxrif oy1fa   uvslt teuo(r3oo1omtnmfeilt) Dtr( p;u1tpeoioctys aDeluvo;t0tltrmr oatlm rli o;s0 2urxo oudap emivil() rumxrp;t0opx  i3ildlsDea( onu0aexnxf3oo1omD  neolt  exriopnodllenmneiat) Drrurp;o1alxomfeiyd mDranvp (0teeomrcoy1oaDr u o;(0s2uoir3oydal nlnct tf 2tm(m ;u0tlto f3iltfm2ranms u0aleoxo tatoa rlies t  eto(o3iydlptelfvsat) rtmx p;t1oetnmf3iadfmDumuvo (4trxnxf tydom  livi ( s2tm(r3io4llenmnvil()sDuru  ot1tptnifcilsfa2uau s;()alxrif3oytlateli s;t0tetrxo3ny1lm n nvi t sDtau  oo0oee  f3tyslm rmnmo;() exnxf iotomDr ivi s trtrim3nodlltnmiesat sDtaurono1tleo oetld m2uau pnu)tlxoif3ta1omtrlnvs;s) etrio3oodal nmfci (fa2uaurpot1tlxn ictlt s2eau p;(4arxrmo3oatlmtran sl(0srur(r3iu1ap nlncilt  2urx p;o4oeenmoetyt sDrmu o;u)teeoifctodfp  aueo t0 etmxr3oodaptnmieta(faDuax  ;u1aleo i3tasfs rmuvp;u0arxrio3iadfp e i ils0trxo(rpiy1amen icta(fsrtmurpot0aptnio3tadfmDrmnms;()trxomfciytfpDeluvslt0srurxm3nu1am e fcsas)srua(m ot4tpx  oetasfa ea(vs t0texoir3iotlm rln il(0srxmio3iudlptnliei s sDumumoou0tleniocias m uluvpnu0 rerir3tydomtrlieo (  rto(r3io1omt  feslt) ruax o;u1texn o3iytfa2rmn ont)tlxnmo3ia1oateanvi;t  euoirpiy1alee nctl()a2umumpno0aexn oeiys s2rmn pnu0aexrxf3oy1fmD  ivo;t)trtoio3iydllenmnci ()sDtau ont1apen iciyslmDumumo t)tetnxo3tatlaD  uvsl() rtrxr3iy1altn fctas)sDuaum oo0olt mietatls umu p;t4aetoxo iytoate ieols  exmxm3no4ap   ncs s)sDtr(moou1oet ioctatfs ul(vo;(4aleoif tydfmD  u o;s)srto(o nu1al nmici s) 2ur(moot0olxomoctytfa eanvp (4tlxrxrctytom  lieo s)s2urio3ou4amtemfei ()a2rm(rooo0tlx iictydfm2rmums u4aexrif iodlaD ai i;s0teur(rpnu1opeelfcs ( aDrruro;o1aeen fetasla umuvp t)tltoircia1lpte i s;s  rumxopnu4lltnlfvilt srrrxmp;t4tleoiieiltfa2em(mo (4altrmfcoydlpDraivo t0trxmxm ou4aptn fvs tf ruaum no4aee ioetad a2rlu o;t)areomrcty1fa   u s;s0t2xr(m ou1lmtnlfeils) Dta(m ou1tlt ifeiyslm2umuvo;t) rtrmf oa1fmt  ivo;t0 rtmxm3oodomee ivsl( aDrrumpoo1tpeniociltfa2rmuvp;u4tlxoxocto1fptranvs (0setoiopnu1om emiesas)artrxrpot1aptn fciatlm ua( s () rtnif3todlp rli ilt0 rtrxr3iydomtnmnci ()srtr(rp;o1tlx moetlt m ranms (0 reomr iy1lm raivi s)s2umxrpoo1ll nmncilt a2ur(root0oexomo3iys a ea(vo;u4tleoxr oo1lmD livi;s0sexr(m3oodlleelncta(fsrtm(r nu1oee mo3tls mDem(mont4artrir tatomteau o t t2umxm io1lle  nesas)sDumxrp;u1altn i3tyt s emu s u4trxoxf3tydlmteluvil()s2toxm3nodom n ies s srrm(mont1apt mfcias a2umump;() ltrmr oodfpDr u o t0 2um(m iudom n fei (fartrxmpot4tltomoctytls2eaumo t4alerio ty1opDeln il(0 exrxr oy4alee nvtasfs2umxmp;t1oetnmieiasfa2emuvpn(0 renmociadfm e ieo t)srtrim nu4lpt micta()s2rmxr oo1aexniicild s umu o u)artomrctytfatelueo;t t2uo(m ou4llee nesa( srraxront1oltn oetldfs2emnmo;() exrxr3iadfaDeln i ( s2xmxrpoydamenmnvsa(f 2rm(mpot1tee iietldla ean p;u0teeomf oydlptrlneo s srur(m iy4ap nlnctl(  2umxrp;o0oeeo feiat s2ua(vs u4 rxrircoa1fp rlu o;( teto(m3iy4apte ici ( s2rr(rpno1apt mo3iydlm emuvo t0aetnxr3tydfp  lnes t) eumxo oo1lptn ict ()aDtax p;u0tptnif3tasls2rmnmsnt4aexoxfcoo1fate nvo t t2xmim oo4alee ncslt aDtmxr ;t0apenii3iytlaDumnvo u4 rerxr3oytlmtrlivils  2trim3iydole mnci tfa2raxroou1opx  octydfm ul(mo;u)alxoif3iadfp  lu s t)sexrir oudlpt micsa()arraum ;t1tlxo fctydla2uanmo u0tlxnmr oodlpDrai sls)srxr(rpiydomenmncias)s2raurpnt4opxn ietad a2eanmo;()arxrir to1fp rauesls) 2tmxm3iydapenlfetat)arurxrpou0tptomiciyt sDuau s u4altrifctydomD  i s t0trxoxm3no4ap  liviat) 2urx  ;t0openiiciys a2ra(mp;u0tlxrxo oadlmD  n s;()truo(mpnodlp n fvtat)s2uaxmo;t0opeomieiaslm2rlumpnu0alxoxr todfaDeli olt)srxo(r3iydlltelfes sf rtrurpot1oex  ietydfs2eln s u)alerxr iydlmD aiei;s s2tm(r iu4am n ncs tfs2rruroou4tee mociyt s ua(mo t) lxrirciodfat au s (0 rxo(m3iy1amt lics () rra( o;o1oetnmoeiltfsDemnmo;()tltrxf ta1oateli sls)t2trio3nudal nlieta(farurxmoot4tpxn ocilt s em( sn(4trxrxr io1om ranvolt srxrxo3oodlmeelietat)s2tr(rpnu0olx mf3tadfa raump;(0 rerio ta1fmt  ieslt0 rxm(rpiu4lp nmfvias)a2uau onu1tlto feilt s2emn o;t0 reomo3tadlptraiei;s trxmim iydapte iet ()srur(mpnt1optoioeiys m2ra(vo (0trtoifcoo1fpDrli sl()seur(r3ny4ome mfvi tf Dtr(rp;o0tlxn ictytfsDumnmp;t4altrxfcoy1omteaivo t0 etmxr3nu1lmtn fetl()artmurp;t0apen f3ilslm2rlumo u0 lxomf ty1fmDeanei s  rtrxo3ou4ap  mneslt)s2trx onu1aexo f3tydfs rmn snu)teenmocia1fmD aueilt s2trim oo4ome lfei s)srurx ooo0tptnioctatfa um( o t4altrioctodfpDelivi t s2trxm3io4lpee ivsl(f 2ur(mo;u4tpt  fciatfsDeau p;t) exomocoadfp rlnei;t sexrxo3iu4lmtnmiesat)aDrmum ;o1tpt mietls s2em( s;t0areoxr3iatfp rauvs;t)seuo(m ny1ol  lfvsas  Drrxrpnt1tpxnifctydlsDulumont0trxrif iatfa rau o;s0s2xoxr3oudlpt lfetasfaDtrx p;o0alto feilt s emu p;()aetomfcoa1fm  aneslt)tetm(m iy1lpe mfesas  rtmxrp;o1tpeomo3ias m2ul(mo u0 lxoxo3oytfm rai ilt)s2xm(m nudlleemncia( a2rmx pnt0tle ioeild mDul(msnu) leoxrciytlp rluvo ()t2toimpnu1ap  lfvs sf 2trur nt0openmf3tldls rmu pn()trxoxrcoytfp  lneo;t  rxr(m3no4aleelfeils srtmxrpou4aexo oeiadfmDeanvp u)aleoio3io1la r i i t  etmio io1lle liet s srtau ono0aetoiociasfmDrln o;t0trtoxo3tatop e ieols) ruo(r3iu4ll  lneias aDurx pnu4tptniociatfa uln s;() eerifcoydla elivs ()sexo(m iu4lmenlfetl( aDrax p;u1apto oeiytls rmumo t4alxrircoytla e i s;(0texo(o nudameelnctltf 2um(rp;o1oet  octat mDrmu o;u4aetoxrciydomt li ils0texrxopoo1ol   nctl( arua(r no1apxo f3iatlmDumnvon(4 rtrmf todfp r ueslt srtrxopnu4am elict t a2tr(rp;u1tpe ioeiydlm2eln snu0 exnio3oadoa e u o;s)setm(r ou4ol n nesls)aDra( pno4aee if3tldfm2elumo u4tltnif3oa1fmte u sls)trumim iy4lpenmneilsf ruru  nu4tlxnmoeiatls2rln p u0trtrmocta1lpte ivols trxr(opny4ape livsltf Duru  ;u0apt  i3iyt mDeanms;t) reomrcootfate nes;s) 2uoim3iu1lpen ivtltfsDra(m oo1apx iocildfmDul( snt0aexoir3iadoaD lieo (0setmxopio4lpt lici sfa2ua( p;u4opeo ieiyd aDrlnvs;(4aexoif3iodopteaivs;t0 rtm(opiodamtn fvta(faDtrxmoot1aee ifciatlm2ra(ms;(4 rtoxo oy1oaD  nes;s s2tm(rpio1ll  lfctasfs2rrxrpoo1oetoiicilsls eaumont)aeeoxrciydfaDrlivol(0seurimpiudoltn ivt t)aDrm(ro;u4opx mfctldfs2ra(vpnt0 rxnxf3tatoa  luvilt  rum(r3iu4lmt lfeia( a2ra(m ;o1tpeo ictltfa2rmump ()aetnxr3iy1oa ranvi;(0teuo(m3iy4ap n ivt s) 2rrxro;t0aee ii3iad a ul( s t4 renxo3iadlateln il(0tetoxm3iydomenlfvilsfaDtax  nt4ope mo3iat m2rluvont4arerir oodom elneolt)sruoim3oudamtnlfctl(faDtmu  nt0alx ioeiytla2rmu ont4aeenxo3ia1fpteanesl(0srto(m3oodop elict sf Durxmpoo1apxnmo3iys aDul(mo;u)tltoif tadlpt lueolt0sexmxrpoy1lmeelict s)sDtr( pno0aetomfcilsls2rlums u0tltrxfcoadop rln o s s2urirpoudomenlfcia(  2urxm no4alt  oeiytfs2rau snt4treoxr3to1fpt  i o s trumim ou1lmte nes (fartaurono0optniictydls umnmo (0aeenio iodoaDelnvs;s texoio3no1lm elfcsatfaDrax p;t1alxnii3tydlaDem(vpnu0 rxoio3tytfpD li ilt srxrxrpoo1ll nlnesas)s2ua(mpnt0ope mf3iasfa2uanvsnt0aeenmr iodfat  iei;t)setr(m io4openmfctl()srrr( oou0oeen ociad sDel( pnt) rermr3todlatrau o;t0t2uo(o no4omtelivilt a2raxmo;o1oetn ieiys a2eln pn() eeoir oy1lptr ivols)seuo(o3nodam elncslsfsrtmxrpot1tpx  feiasla2uln pnu4aexomfctodoaD anei t  2xoio3iydomenmfcs t)sDua( ooo4ole  fcilsfm em(mont4 eeomr3oodfp  livolt trum(m iy1lpeemnvtl(faDtr(  nt0optn octydfaDrmnvs;u4 etniocto1lm  li ol(  2toxopno1am   icsas)artm(m oo1aleo ieiydlmDea( s;u4 reoio ty1fmtrai s s0t2xrir nudamtnmnci s)s2ua(rp;t0olt ioeiasfm2um(mpnt)tlxnxf io1laD li ils)srur(m3io1ol  mnvtas)sDrru  nu1tpen i3tls mDumump t)trermocoy1lmtr n s;t  exoxrpoodol emivtas a2ur(m ;t4tlenio3iyd m umuvon()trermoctotomtrauvi;(  etoir3oy4lmtn fvias  rrmur ;t4alen fetat sDrmu pnu0 eeoio oydomt aivo;s0sexmim3iy4ll n ivi tfaDtmx ooo0oexomoeilt m2rm( s;t0aeenxf tydfpD luesl()s2trirpio1op elnctlt) rrrxrono0oetnioctat a eauvs u4tlermr3oadla  aueils)s2xoim3nu4optelicia()s2rr( oou4olen i3tad s uanvo u0 etnxrcty1fpDraivi s  2xrxr3no4lm e nci t)sDta(m nt1alxnifetyd a rauvsnt4 renxociy1om ranvi ( srum(opiudlp  micil(faDumu  ;u4oee mfeild s2umn pnt4 eenxf3tytoatrauvo;t)setoimpiu1opee ivils)aDrmx pno0oex mo3tls mDuln pnu)tltrmo oadom r neol(0 euo(m nudame  iet t)sruaum ot0tlxn i3iysfm2um( s u0trxoxr iy1fa rau i t)srxoxm3iy1amt livtlsfsrtaurp;u1texomietat a2ulumo t4texnmr3iodla  auvo t0t2xoxr3iodale miei s)arrrxroou1tlt  fctlsla ra(mp (0 rtrmfctadoaD  nei t teum(rpno4lpe  ivi (  Draxmoou4texomieilslm2em(mont0tltnxo3io1lm eanvi s0 etrir nu4lmenlfvsls sDrru pno1apx ii3iltla el(mp t)altniociotlmt  ueols  rtmxopiu1lpe mfet (fs2rmxr ou4teenmoeiadfmDuluvs;() etnmf tadoa rln s;t0 rxrxopny1op nlfvtl(  Dum(moou0tpt ifciydfs2emu o t4arenmo ootlpte ieo;(0 eto(rpnydaltn nvi s artru oot0ale  feiasfs2eauvs u0aleoxf3io1opDeln
\ No newline at end of file
@@ -0,0 +1 @@
+i i;() etmir nu4om  mfeilt)sDtrumo;u0aeto ieildfs2ean o;u4 rxrmr3iatfatraneo;() rurir3iodoltnmnes s)s2ta(mono1alx ioctls m em( o;(0aeenmo3io1oat aivs t  rxoxopiydomtnmivsasfa2urx  ;t4opxoif3tysfmDel(vo () ltnmo3oadfmD au i (0t2toir iydlleemnet s) 2ra(mpot0aexnmoeiasfm2rm(msn(0trerxf3oy1fpDe n o t srumio no4omt livi (  Dtrx  ot1altnmi3iaslaDraumsnu0aleoir3oa1fmDeluvo t) 2tm(o3oo1ome lfesa(  rtmurpou1ape  feiydfs2rl(vp ()artrxr3tydla  luvsl()t2xo(o3oo4apt  nvia()s2trumpnu0olx ioctasfs rl(vs;t)artomrctytfp elueo;s0s2ur(m3iy1lmtn iesl()a2tax  ou0tetoioetlt mDea( s t0aexrmo3to1lmt anvo;(0srxoxm3ou4optn fvi s arrmumpoo0altniieiys aDea(vont0 rerxf oytlat  i s;(  exoim oy1ole mfcsl(fs2ur(moot1aet mi3iydfmDemnvp;u0 lxoio3iodlmD li i;()tetmxm3oo1altemicsl( a2tmx o;u1aex mfeiydfmDeanvon() etrxr3iytfp elivi (0 2xmxo iydomtelfvia(f rrrx  nt0tetnioeiad aDeln p;u4arxoxr3tytlm eliei t0 rurxr oy1omt  nesa( aDrr(monu0aleo o3iadlm2eauvs u4aexrircoatom raivs s0seur(o3ny1optnlfctlt aDrruro;t1oltnmoctldfmDelump t4trenxfcoytomtrluvi (0 etmio3nudolt micias)sDtau pou1tlxniictysfaDuanvs;t0texomo totlmDrauvs;s0setoio3oudape  fesltfarta(mont1olxnifeiatlsDrln s;u4tltomf3iatla e ivs s) 2toxm no1ol e ncilt srrrum ot4ope  fetldfsDea(von()texrif oa1fpD anei t)trxm(mpou1lpe licilt  2rr( pnu1aleo ieiysls rm( snu0arxrio ootom rlnvol()t2tmiopiu4omenmfcsls) rua(ro;o4oee  f3iytlsDuluvs u) renircta1lmtranvs;s)trurxm iydlpte icsl() rurum ;u0aetomictad sDulnms;u) exrmf ty1fp  an i s) ruoxr3oudolt  ncsl( srurum ;o1alt miciys a2uanvs (0 lxomo oadom   i s;(0 euoxo3iodame lfes (faDrm(rpou4tetnii3iadlm2ulums (4trerxfciadfpD luvsls0 ruoxm no4omte ict s)s2uax pno4optn f3ils a umump;(0 rxnxf3iytfpDeai i ()t2ur(o iy4op nlivsasfarumumoou4oex  oeiys aDranmo;t0aeeoif oytfaDr i i;s)trxoir3iu1oltelfesl(f rur( o;u4tetnifeildfa2eaumon(4aeerirciatlmD aies;() 2urxm oy1lm e iesl( s2trxm ;t0olx  o3iys m2ra(vsnu4aetnir3iy1fmt ln sls) rtoirpoo4lpeemict s  Dtaumono4tle mfcildfa el(vs;t4 eenxf3totfptrau i;t)srto(r no1lmenlnviat  rtax pnt1tpxnmfetltfa2rauvp t4trenxr3iodoa e n ol(  etmxm oy4lmt mfei tfaDtr(root1opt  fcilt m rm( onu0aetriociytlmDr ivo s)texmxopou4lp   fvs t) Dra(ro;o4olt if3ildfs2rmu o;(4trtnxo3oy1oat li o;t)trxoiopiu4ol n fcs s)a2taxrp;u4ale  f3iltfs2um(vs (4 lxrxfcoatfaD lnvs (0t2trim no4ame lfesls)a2tauroot0optn ocilt a ulu o (4tlxoircoy1lm eli sls tetoxo io4omen ncs tf rurumpoo4oexoifciasfsDrm(msnt0 rtoio3oodlmDrlieilt)srumim nu4ll n feiltf 2umur oo0olenmfeiytfm2uluvs u0texrif3totlmt an o;t t2xrim ny4lpenlnetls) 2rauro;u1oexomoetltfs2ua( o u) rerxrcia1lpt  i s t0 2xrxopoodop nlieilsfs2rrxmo;o0tlenio3tltlsDran snu0 lerif3totopDrlueo;s)srtoiopoudaleemncsasfsrtaxr ou1oleo octys a uln pnu4teeoircta1lm eanei t s2uoiopiodllee ncia(fsrrmur ;u4tlenioeiyslmDulnmonu0treoxociytlatrluvols srxo(o3oy4ame mieiltfsDta(  nt1opxnifeils a el( o (0tlerxo tadfmDe ivo t0texm(mpiy4am  mfcil( srum(mo;u4altomfeiltla ul(vonu)altrio iatoa r u i;(  exrxr3no4alt  neils) Dra( pnu0aleniiciysfm2uan snt4arenmrcio1laDrauei;( setrxr3io1om n neia() 2tauro;u4aetnmf3iasfm2umnvsn(4aeeoxf tydfateaues;t)t2toxopoudopt lnvs tf rumxmooo1oltnmi3iyt s2eln o (4alerxo iydlatrlivil(0setrxm3iy1am  lnvsl(fsrum(r ;t0aexo ociadfaDua(mon(4 reoio3tydlptrlies s0srxm(o3iy1ap elfcsa(  rurxmpoo1aex  i3iad a2rluvp ()alxoxrcoo1omDean s s)t2urim3iydlm n fciatfsDta(monu4oexomfeiat aDelump;t)aeerirciodfat luvi t)sruo(m nu1omeemiviat  2raxro;t0tet if3ilsfsDuluvont)aetnmr3ta1fpD lnvolt0teuoir io4aptn fvt s s2umxmoou1oltn iciysfmDemnmp (4areriocta1omDelies;(0t2umio oudopenliviltfsDrmuro;o1texnif3iydfa2ul( on(0tltomo3iy1omD  i i;s0srum(m io4lltn iciat sruax pnu1aetnmfeiys m emuvon(0 rtnif tatlpD ln i t)s2toxopio4lmtn icil(f 2rr(monu4alt io3iydla2uln o;t0aexomf3iadom  lueols0t2trimpno4lp emfct t  Duau pnu1tptnifcias mDua(mo;u0aeenxr oo1lmDrlueil()srxr(rpiy1ap elfcil(farra( o;u1aetn o3iydfs uan s u4altrio iytoa   ies t trxm(o3oy1ol nlict tfsDta(mpnt0oeeo fciasfa2ran p;t0trtrir ty1op rlneol( s2xm(r no1apeemictat)aDumx  ou1aetnio3tyd m2eanmo t4aexoxo3oytfa eai s;t tetr(m3oy4opte netls s2taurpot1apenmf3iad m2umnmp t4 leomf3iydlmtr ivo;t0t2xoxr oodap e fcs (farumxro;t0aptnmo3iat a2rm(vs t0 etnxf3tatfat aneo;s) exrxr3nodlpt mnct s aDraurp;u4tlen ociltlm rl(vpn()trtnmfctytfa e ieo;() eumxmpoydopenmfct sfa2taxm ;t1tle mo3iat m ul( s ()aeeoxo3tadoptrlu slt) rtm(r nu4lme mfvt () Dtrurp;t0openmictytlaDrluvp;t) eeoxf3tadop raies t0s2xm(rpiudlmte netltf Dur( pnt0tpxn i3iatls2ul( p;(4teeomo oy1fmteliesls)teur(r3iy4ope  nvt tf ruru poo0tpeniietltfs2rlumo u0texnmrcoo1fm  anvo;t sruoxo oodam nmnes s)s2uau o;o0oet mociltfm ulump;u4aexomr oydlpDran i () rxm(mpnydamtnlncias sDta(mono1apenifeildfmDumnmo;t)texnmr iotoa rauvols) etrirpiydopeemfei ()aDtr(m nu1optn i3tldla emnvp u)aexnmocoo1lmDelieils  exoim ny4al   ict tf rrm( pnu0oltn o3ildla2um(vonu0artrif iytopteluei;t tetr(rpou1lp elfcils aDtrx  nt0tetoiictasfs rm( o (0trtrmoctatfmDe uvo;() rxmio3nu4ame lfvi s) Drm(r oo4aet ioctadlmDrlnvs ()alermo3io1fateln s (0seto(r io4lm elnvt (  Dumxr no1oltn ictls m2el(vsnt4trenmf oatfpDr i ilt seto(m3oodlmenlncsl()sDta(rpnt4oexomfeiydla rln pnu) rtnioctotoa e uvslt  rxo(opiydapt  ivt t  rta(ro;u0oee mi3iasls2rmn pnt)arxnxf3ta1lpt lu i;s trxoim oudopeelicia(f Dur(ronu1ope mi3tyslm2rlnvpnt4 lenmrcty1fa rai i;() rumim3oydomte ies t arta(  ;o0teeo oetatlm rlums t0 lxoxfctotlmD  i s;t)t2toxmpnu1lptnlivta(fs2tmurpnt1tpxnmfciyd sDeaumsnt0 lxoxr3tadlaD  nesl(0teurxo3no4op nmnvils)srrm(mo;t4alenmi3tltlaDelnms t0 rxrmf oy1fptrli slt0s2xmxm3oodll e fcta( aDur(rooo0teto fciat a rlnvonu) rtnir3oo1om rau sl(0 rtmio3no1lm emies ()arra(r ;o0texomi3iyd mDem( pnu0tltoir ta1fp e u il(0trurim oodope  ivilt s2umxront0teeomi3iad a rmuvs;u4 etoxo3iydomDrli ils)srxo(opiudlm  licil(fs2tm(r nu1aeeomfciatlm ua(vo;t0 renmf3iadlpt aies s0t2ur(mpiy4op emfet s srurxr ot1apxnmieilsfsDrau p (4trxoxf3tydoatraneils0t2xr(mpoy1alen fvs t  2urxmpou4aex  o3iad m ranmp;t0artnio3oo1optrai sls0t2xmxo3ou4llenlici ()aDtrx pno4oleo o3iyd s2rlu p;u) renifctadfpDrlues s texoio no4lptnmiet s)aDraurp;t4opeoiictldlmDumump u)alxoifciatla elivs;( teurio oo4lptn ieil( aDrrump;o4teenmi3ias s rl(mp;(0artrmf3io1omD li s;()srumxmpoo1op nmneia(fa2tax o;u4tlto o3tatfsDem(mo u) etoxf oodlatrlnvi;t)t2uo(r3ny4lle  iciatf rtmuroot0opt mi3ildla2raumpn()trxnmo oadoa  anei;t)srxmirpoydopt  fvta()s2urxm ou1aetn o3iat a2eauvs t0trtoxrctodfmDeaies ( teum(m iy4alteliet (f 2ta(rpou1tpxn o3iadla2ea(mp;u0artnio3oytlmDr ies;( truoio3io1omt mnvt tfa2ra( p;u0oeeomieiysfm2umump;t4trtrio ia1fa   neilt0t2urim3nu4llt lnvtat)a2umx  nt4tpx  oeiysls el(mo;u) etrifcootfm e nvils  exmim oydapee fvtl(  2trxmpot4texn ieiltls2em( snu)texnxr3ta1fmD ai sls seto(r iy1optnlfvslt) rur(r ;o1olenmociytlm uaump t0 etrxo tadfa  lu i;()trxr(o iodllt lfci t) Dur(mp;t1aet mi3taslm2rm(vp;(4aeermr oydopteanvo s)texoxm nu4ope  ici ()aDurx oot1opxo f3tyt m2ua( o (0 lenxrciytlaD au i (  2um(r3oydoltnmneta(f 2rrum no1aex iieiydla rmu sn()texoxf3iodfaDeln i;t  exm(m3iydaleemnesat)s2tr(mp;t4tptn f3tytfm2um(mon(4texoif3oodfa  lieo;s srumim3oy4omtnmfcsatfs2rau p;o4oeenmfciatlsDean p;()aeerircoy1oaDran i;s t2trio oy1olee ies t)aDtmuronu4tpeoiociysfa rlumsn(4 eerif3oa1om ranvslt)t2xr(r3io4lpte fcsl(f 2umxrpot4tlx mfcildlsDran o;u0 rtnxf3ta1om raueo s  rumxm nudaptelnvt tfarur(rono4opxo o3iltls um( snt4 rerxo totomtraneolt) rtmirpnu4amtnmivtltfaDtrurpnt4open oeiadfa2ul(mont)tetrmr3iy1lm elnes;s)sexrim3oydlltnlfcs (f Duru p;o4apxnmociyt s2ul( on(0artriocia1oat  n o (0tetriopiydlltnmfetl(fa2taxrpou1tlt mieils s eau pnt) rtomr oa1oat  u o s0sexmio no1opt mnvs t a2rm(m ;u0ape iociatfm2rmnvs u)tetoif ia1lmtelivs;s0teumirpno1optnlici (fa2taxrpno0alenii3tat a elnmo;u0altrxo iotfp  ai o (0s2toirpou4lpen fcsa(f 2rrumont4tee mieils s ra(mp;u4trtoxfcoodfmt aivolt0teuoio3io4op  lfesltfsDumum no0aeeniietlslm2ua(vpnu0teermo3tatlpte i ilt0s2umxo ou4opt mfvs t)a2urxr ;t1open fciatfs2umumo;u0texoio to1omDrlieo;t tetm(m3oodam  mnesls)srur( poo1olt mf3ilt s2ean s;u4 etomf3tadfp rlu o t srxm(o io4om e netlt srrrxmpot4tetoio3iadfmDuanvpnt)trenxr3iydfpDrln i;(  exr(r oy4am elfvsa() Dtm(mp;t0tpto o3iltfmDea( o;t)texriociytlp ranvo s) rxr(m no1lpt mfcta(f 2rrxr nu0oeeoif3iyslsDemnvp u)tlxnifciydoatr n s;s teuoio3oo1om nlnesls sruauro;u1opx  i3ildfa2ea(ms t0areoir io1lm  lues;t trurxrpiydamtnmfet (f rtru  ;o1ape  ictls a uanmo;()trxomocoadoa e u s;(  2tm(mpiy4ap  lnvs t)s2tr(rono0opto ociltfa2rmu s u0arxrxf iodlaD aivils0srtoxmpio1omee feilt)a2rmx ooo4aet ifctasla2um(mpnt)aexrmo3tadlpt livs s) exoxo3nu1apt  fcsas aDrau oot4tetoifciltlmDrmnmo;() ltrmf ta1om eaueo;t)srxr(m oy4olte ivt sfarurumo;t1teenmf3iytla uanmp t) rerxocoa1lmtr u o s0teur(rpno4lmeemfeiatf 2raxr ;o1alt ioeiyt aDulu p;(4aeermr3io1fptrauvo s0sexoxmpiydoptemnctatf Dta(  ou4olen oeild a uanvpn()aetnxfciatoaDeli s ()trtm(r3iodap e fvsa()aDrm(mpnt1apxnio3iad a em(mp;(0alxrmf3to1oat  ivils0 rtm(o3iu4ameelnvi (f 2uru ono1oexoif3iytfsDuaumpn(0tlxnxo io1oa r ieol(  exmir3nodllee neta() rurx  ot4alx moetys mDuanmo t0alerio3oa1fp  lneil( t2tmir3oydap   ict ( sDrmu pnt4aetnmfeilt s emnvs;t4aetomo tadlaD auvsls0 eum(r3io1altelnesat) Drrxrp;t0tet ifeiyt mDeanvs t4treomr oa1lptrli s s)tetrxm3ny1ome mfvsa( aDraur ;u0tltniictys aDra(vo t0tetoxf tatlatr ueslt0srtrxm io4llenliesl(fsrum(  ot0ope  i3iyd m2eluvpn()trtoio tatoa r u slt srxm(rpnudom e ncta(  Drm( pnu0oee  o3iytlaDrlumo t)arenmocoa1fmteau o ()setoxrpiodlpen neiatfa2raur ;u4oeeniieildla em(mp u)artoxo oydlmt  u o;(0sexmimpoo1lp emfvi () ruaumo;u1optnmf3iat m2ea( on(4trtnmrciy1faDr ivs;()teuo(o3nodlp e ivtat srurxm ou1oexomo3iadls2emu o;t) exnxo3io1op eaivslt)sexoim oodlpe lfvi ( sDtmum ou4tle miciatla em( o u4tleoxocoa1fmtr nvils tetr(o3nydlp  lnvsltfarta(mpnt0teeomoctys a2rauvpn(4 ltrmo3iotomtraieol( srxoxr3oodlp n ieiasf rtaumpno1aleo f3iadlm2uan o;t)tltnmf3oy1oatrli ols teur(opiu4lle lfctl()aDtaxmp;u1tpto fcild m emnvo t)tlermr3tytfp  aues t0tetm(r3iu1ap  mieslsfa2uru pnu4ope mictytlmDrauvp t0 exnxr ta1fpDrai o;s  etoxmpoo1altemncil(f Dur(ro;t4olt  o3iatfs2emn s;u0aeermociydlateanvs;(0teur(r3iodapenmieta(faDua(  ou4oltniiciltlm2eauvs t)trtniociadomtelivs;() eumiopoodlpee net t a2tm(mo;t0apenmf3ilsfmDrluvpnu0 exnmo oadfp eluvols) 2to(m ny4op   iesls s2um(ro;t1altnmi3iltfs um( p t0arenmr3io1op eaneo;s s2uo(m3nudlme mnes tf Dtrx onu0aexoif3tlt mDemnmo;() exnxr iodoptr n o () rumxrpiydlm nmnvsat sDraxm nu0tlxo i3iysla eanmo;t4texnio3ty1fmDe u s;t)trxmxrpnudaptelfesasfsDuaum oo1oeenmoctatfm rlnvo t4 rxoxr3tatomtean sls0sexm(r oodamen icta( sDtrxm ;o4aeto octlslmDumump;()altrmo tytfpDe iei;t texmxr3nu4apte ictatfs2uru  ot0texn oetyt s2eau o (0 rxoxr3ta1omtelnei;s trurxmpnu4aptelnvsasf Drmu pot4optnmieiys aDeluvo;t4aexomr iadfaD  uvsls0 eurir3nu1apee nei () Dtmuronu0tptomo3tlslm2umuvont0altrmr iatfm eli i;s  2uo(r3nudomt mivias srrm(mpno4olx ioetys m2uluvonu)teeoxoctadoatrliei (0s2uoxr nu4llt  ietl(fa2trur nt1oleomo3iasla ea(mon(0alxnio3iadom   ieo;s t2urio ou1opt mnvt s) 2ua( o;u1tlx iieilt aDelu pnu4altrmr3tadlatrluvs;()srumio oo4oltnmneiat) rtm(r ;u1apen i3ias s2rau p ()tetnxr3oo1lpDr u sls)trumir3oy1lpt mnetl(fs2urum nt4aee  ocilsfmDrluvon()tlenxoctodfmD auvilt0 rxmxopoodoltnmici s)s2rm(m ;t0oeeomiciatfsDelnvs;(0arxnmr3oa1fmtrliei;s)srxoir3nudamte ivtlt artr(m ;t0oee io3tldlaDulu p;u0 rtnxo3ia1oaDelivo;s texr(m3oy4lleelicslsf 2urur ou0open ocild mDrauvp u4alxrifciodfmteai i;t0 exo(r oo1lpe mfesl(fsruaxr nt4aeeomfeils a uauvo u4 eenxr todlmtrlu i s0trtmirpio4opee feiltfa2uaxroou1olxnii3iyt m ul(vo;(0tlenirciadlp  luvsl(0s2umim oydoltelfeiat) rrr(m ou1alt  o3iatfm2rm(vp t) reriocta1faDeai ilt0s2uoimpnydole  fvt sfsrta(rpot0tlx moctldlm2eln p;u4artnxfciytlpDeaivslt)tetoxmpnu4olen nvil(f rtmu  ou4ope  ieiydfsDul(vsnu4alxrmr3oytfm  aneo t srum(mpnodopeemiesltf Dra(  oo4tetn i3tltfa2uluvs (0altoxo iytopte n s;s srxm(rpoy1altnlfct tfsrumxr oo0openmfetld m ua(vp;(0trtomfcta1laDe ivo;s0t2xr(mpoo4ll nmfvta( s2uaurpnt1oexnmf3tld mDumn o (4trtrmfcootfptrauvs ()trtrxm no1omt lics tf rur(m nt0alx moetasfa2elnmpnu)trtrio3oa1fa  aieo;(0sexrxopnudlmt lnvia()aDuaump;u0opxnifctyt mDrm(mp;(0altoif ia1lm ran ils  exmxm3nudoltnmnci (faDrmu oot4opxn i3iadfsDrlnvsnt4altnirciotop eai o;s0trxo(r ny1lm elnet sf Dtmxm ou0tptnif3iydls ea( o (0 eenif oatfm eanvils) 2xmim no4omtelict s  2taxmp;u4opx ii3tatfm emu s;t)aeeoxfciydfat livo;()trum(o ou1llenmivs (f 2rmumoou0apt mf3tat a rm(vp u4arxnmfciydfaDeaies t) 2xm(m3iu1lmee ncils  rtr(  ;t1alenio3ildls ul(vo ()aetnif iotfpteanes (0truo(r3oy1openlfeilsf rum( p;u4tltoiociyd sDulums u4tlermrcoy1lp   u i;()trtmxo3iy1altnlfes t aDua( o;o0apt  ietadla umu o;t)arxoxr to1oatrln slt0t2uoxmpoydamenmietat)artmu ooo1ope  i3tytlm ea(vp;()alxnmf oo1om  ln ols0t2trxm iu1omt mfeilsfsrraurpno0tlt  iciytlm2um(mpnu0aexrmrcoy1la ean il()t2xo(opiy1oltemieta( a2ua( p;t1oeeomfetldlm2rlnvp;(0aexnifctytoaD  neo s  rxoxopnydomt  fviatf rtmxm ;u1aexnii3tytlm umnmp t4trxoxf3oytlpD ln sls0 euoim ny4om   ictl( sDurxrooo0ale  ieilt a2uanvsn(4 eenxr oo1fmt  u o;()sruoxm nu1om  mnetlt a2urump;o0tetomfeiyslm rm(vs;u) eeomrcoo1oaDr nvi;s t2xoxo3iu4lmtnlnctasf Dtaurp;o0opxn fciadfaDeaumpnt) eenmf3oydfm   n ils)srtr(rpiu4ope mictatfa2urxmp;t1aet ifeilt mDrmnvo u0aleoxf3totfmDe n ils0 rumirpoy1lpe mfes t sruax pou1tetomfcildls uanvs;(0 lermocootlmtr ieo;t)s2xo(opiu1am e ieia()aDrmx o;u1tlx if3ilsfa rmn on(0trtrxrcoatlm  anes t0texoiopnodamtemfct (faDua( pnu0aetoiieiydfs2elu p t0arxoxociotfpDr uesl(0 etoio3io1lpe mieils sDuaumpou1aleoio3tls a2ulnmp (4 etnmo3iadlp   u o t  2urir io1lp  lncsltfaDtrum ot1tpxomiciyd s2umnvonu)altrmfcoadfmtrli s t)srur(m3oudoleemneilt  2tm( oot0tptn f3ilslsDrmumon() rermf tadom   ivo;()trxmir oydlm  lnvi sf 2rm(r oo4olxoifcildfsDeau s t0tetoio3iydlaD  ivolt  2xr(r ou4lltemivsasfaDrm( o;u0tlx  o3tldfa2rmu p u4 eerif iotfmt lu ol()s2xrxr3nodoleemieiltf 2uaump;o4tleomicilt s ul(mp (4 rtoxr ta1lp eai o s srum(r io4om nmnctl(fa2taumonu0oexn ieiadfaDumu onu4aetnmr oytlmDeauvsls)sruoimpiudlltnmivt (fartaurp;t4oltoifctat m2rl(vsnt4trtrmrciydom rln ilt0t2xo(r3io1ap elics ( aDrmxmp;t0alxnif3tas aDua(vsn(0tlenif tydfmDelnvo;s0s2urim3nydlltnmieil( sDtrx o;t0alx mf3iydfsDul(ms;(0tetrmocoa1om elueo t  2xo(m3oodll emncsasfaDur(  ;u0oeto f3tatlmDel( sn(4areoio iydfmtr u o;t)t2xrio3nydlpen nviatfarraumono0olxnmoeiat mDemumsnt0 etrmfcoa1la r uesl( s2umim nudlp emiet ()a2rr(rono1ole iiciltfmDrlump u0trtomr iodlmD ai sl(0setrio3oy1apte fcil()arrr(m ou0olxn fetld s2rmnvpnt4teerxr oytopD  ueo;(  rxoimpny4apen fvia(fa2rm(mooo1altoiiciysfaDemu o;(4aeenioctatop   uei ( s2tmir3nu4opt mieil(fs2rr(r ;u1texnmfetltlmDrlumont4aexrxocoydfpte uei (0t2uo(opoy4olt lfeslt) Dtaxmont0aeto feiyt aDrmu snu)aeenmo3oadlateaueslt) 2tr(r nu4ap   fvsls)a2tmumpot1opxnifciydfa uauvp;(0 rtnxocoadopD  nvs;t  2trio nydoltn ivsasfsrrm( p;o4optoioeiydfs2eaumonu4 leomfcoytom  ai o;s0 etmxo3ny1ome lfvsasf rrr(m ;u0opxnio3iysfsDrlnvs t4 eenmr oatlp e nei t)s2umxmpoo4amtnlnet ( arrm(  ou4tlx moeiydfsDean o u)altoirciadopD livo;s)s2urxopoo4opt mnesat)srtaxronu4ope  iciys m ranmpnu0aexoir tydoat  uesls  rxoim nudaltnlicsas  rum(  oo0aeenii3tls a rl(mpnt4tlerxr3oodopDr ivsls teum(r iu4ame liei () Dra(  oo0tpe mietydla2uauvo t) etomr iytfpDeluvo ()texrim3nu4lp nlfesatfa2taumono4alxn ocilsla ua( p;t)aeeoxfciatlptr nesls  2xo(r iy4lmeelfvt t)arumump;u0apx  i3iltlm em(ms (0 ltnmf iatlpDr iei s0setrxo3ny4lmee fvs ( a2tm(mp;o4apxniociatfs emn snu0teeoxr oy1opt auesl(  eumiopiy4op e ncsl()s2ururoot1aleo iciltlm rmu o u0 rxrxo3iydomDr uvi;t)texm(o3oydopee ietat) Durumpnt0olx  fciad s uauvs;t0tlerir3iy1fpDrlu o;s)s2trxo oudopen fciat)srtaur ;o4tpxomfciaslm2uaums;t0 rtnio3iodomteli i s tetoxm oy1olt  fci s)aDtaxmpoo1altoioctyd aDranmsnu0 rxrif3tatfp   iei () exmxmpoo4lm n nvt t) Dumu poo4tlenmo3tyt m rln o;u4alxrxf3tytfp rluvilt t2tmxo3oudome mfcta(fa2tmxr ;o1apxoiictyt aDul(vpnu4alxoir oydlm elivs;s0sexmim3oo1optemietatfarrmu pnu4ole ifcils m2rmu onu4alxoiociotlmDraies t setrxmpio1opt lncils) rtaump;t1tlto i3ildfm2uanvs;(4 rxnmf iotfmDraieol()s2um(opio4llt lnctls a2trxrooo1open i3ild s2rauvs;u)tlxrif3oytopDrlnvs;( trtoim3iu1amenmfci t)s2trxmp;t4ale  iciltfs2uan o t0 rxrmociy1lmtranei;s)srtr(r3ny4aptnmivtatf rrm(mpnu1oetomf3taslaDrm(vpnt4aexoif3iodomD luvsl( sruo(opnudal e ivsltfa2urx  no0tpto ociysfmDelu o u4 rtrmo3iotla r ues s trum(m3no1lm n icta()sDurxr no1apeo octldfm2uln ont0tltoxociytlmt  u s;s0 rtrxr oydll nmivslsfartm(ront4optoifeiys a2rln o;(4tltrxf3ty1omDran sls s2trxr oydopt lnes tfa2uaur nt4tpe if3iad s rluvp ()trxnif oytopteai ilt teuriopnu4lptelncs (f rrm(mp;o1tpe ioeiytfm rlnmsn(0aleniocoydlm raiei s0sexoxo ou4lmenmiesat)a2um(ronu0aexn feiys aDem(vs;t) leoif iytoptr n i;s)seuriopoo4optn iei t a2tru oou1oetn fctydlaDranms;u4 lxrmr3ootfpDe n slt0tetmxr3ny4lmtemfvs (f rrmxront0oet  o3iaslaDeauvp (4teenio3oatlaDrlnvo t srxr(o io4amt lict t) Dtaur nu4ole  ociltfs2ra( pn(4trenmocio1lmDeluvo;t)trtm(o ou4apt  neslt)sDuaxrpno1oetoioeiatla2ua( s u0trxoiociy1fa  auei;s)teur(opno1lpeemnctltf rumu onu4oleoifeildfa ea(vp;t) eeoxo3iydopD  u i s) exoim3oy1ome mnei t  rtrxrp;o4apxnioctytfmDulnmo;(0altrir3tydoaDraneils0teurxr nu4omeelivslt)arurx  ot1alt moctlsfmDea( p;(4 lxoir tatfp  au s ()srxrir iu1optn icia(  Dur(  ot4opeoiiciatlm ul(ms;t4texoxr3io1oa  aneilt) eumio3iy1apen fctlt)s2tax  nt1tptnmictltlsDeaums t) rtnif oydoa ranvol() 2uo(rpoy1omeelnvtl( a2uau pot1tptn ictysfa2elu s;() exoxrciodlm   ues s0setoirpnu1lpt lnvs t srum(moou1oexnmociyd sDel(msnt)trxrmoctotlp eauvolt0setm(rpiu4lpe mivilt) rrmx pnt1olt mo3iasls2ul(mo;u)aexnmo iodomtranvo;t  exr(o nu1lp elncsa( a2taxr oo4tleniicildla2eaums ()tlxrxo3ta1omteaneils0texmio3iydalee nvs (f 2rmumono0olenmictldls el( s (0 exnir3tadopDe ueo;t  ruoxopiydopen ics ()a2umx pnt0optnifctyt mDean p;t) reoxf3io1oa  au o;s) rumio iydlp emfciltf rtm(rpou1tlxo oetyd a2emu s t0altomociy1oaD luvil(0trxmir iudome mieiat)arta(m ;u0tlxnmoctytfs eluvs;t0aeeoif3io1fm elieolt)t2trxmpiy4lpe lietlt a2rr(  ;o1tpe iiciatls2eln s;t0areoxr oy1fat  uvils) 2tmio3oodamt  fei t aDuaurooo4tpe mictldla2umnmo;t)tlxnmfcta1lmtrluei s srurxrpoydape lnci t  Draum ou4teen ieiysfs umnmp u0alxnmfciatopD anvsl()t2xr(m3no1optnlnvil(f Duaurono0oltnifcildlsDrl(vsnu4teenxf tadfpD lneo;t  ruoxr ou1aleemnet s)arraur oo1aee mo3tad sDeanmp;u4tetnxo3oatlpD li s;() 2trxm3iudoltn ivt ()sDtax o;u0apto oeiytfm uau o ()aleomocoo1lm e i sls0t2xm(r3oodame mfesls sruaumonu1tlx mieiltlaDum( o t4arxnxocoytfmDrlu sls seurxm nu4amt lfciatf rurumo;o4oltnmicils mDulnvs;u)trenxo tytopt ln o t0 2uo(o3ou1omenmnvi tf rta( pnu1open fctlt aDul(vpnt4aeeoio3iy1oatr i s;(  euoim ny1ap e fvsls s2ur(m ;u4optoifctys a2umnms u0arxnxo3io1fpDean il(0s2urimpnydlp  mfet sfartmxmo;o0aetnmiciydfs2eauvs;t0aetoxo io1fate nvsls t2umxrpio1lle  fcsa()aDumxmo;t4tleoiictatlm2eluvp;t) exnioctatomt au o;t srumir3io1altnlncil() rururpoo4altn oetytfm um(ms u4alenxr iotopDraivi s trtriopny4altelnvtas)srtrurpnu1olx ii3ils sDea( pnt0alxrmf iadoa raueols teurxo iy4olenliesls  Dumum ou0olen f3iyslm umuvo;t4aexrir oodop elivils0 etmir iu1lm n ivils) 2trxmpno1alxomi3tasfs2um(vsn(0aexrxfcty1fa e uvo s  rtmim3oodll elfcslt)srrru onu0tpeoio3iysfa2umumont0 leoir3iatfat anvi s)trum(rpou4lmeelfvt tfsrrm(mooo1olt  o3iyd s2umuvont4altoiocio1la   uvi s)srto(mpou4lp elnet t)sDururpnt4apeomfctatlaDrm(vo;(0alerxo3todlmteanes;s) rur(r oodalte fvs s)s2rmxmo;t0texoii3iatlsDel(mon(0tlxoircoydlmtr nes;t  2xrim oy4llenmncta(  Drrurpno0aee  f3iyslmDum(mpn()alxrmf oo1omD luesls0 etr(r3ny4op e nci ( aDtmxrpnt0opt  f3tadlm em( o;(4tltomf iodlp e nvi;t  rurirpou1ome lncs tfsrrr(ront1tpxo fcildfaDulump;u0alxoif3ta1oaD  n i;()truoxm iu1omeelfvs s s2rmx o;u1alto octasfa2uln s (4 rermfcoy1optr nvi s0srum(r iu4am e fei s  ruau  ou1apen o3iysfm2ulnvont) exomf iatlptrlivil( tetriopiudllt  fesat) 2rrump;u1opto iciydfm2eanvo;u0 lxoifctodoat  nes;s trur(opoodolt  neslt arurx  ou0altn f3tltla rluvo t4 reomo to1fatr u o;t) 2xrio ny4amt mivilt) Dtr(  ou1tltnmoeilslmDrmuvs;()aetrio3ootop eluvi s  ruo(r oudllenmnviltf rumu  ot0oltnifctysfm2ul(vsnu0aleoircty1opDelu i t  rxoio iu1ll emfcslt  Dra(mp;t0teenifetytlsDel(vp;u0altnifcoa1fa raieol( texr(rpiy4ll nlfci tfaDtmxr no1oleo iciytfa el(vo;(4 eeomfcia1oaDrlu i;( srtmxr3iudoltnmfetls) 2tm(m ;u0oee if3iys aDemu o t0trtrxf oydlmte nvols)srumxo3iu1olenmfcsasfaDtaxro;o4oeeo feiydlmDulnvon(0trxomo3oo1fpDe nvi;s seum(m nydal e ici (f Dtaxmpoo1tltnif3tysfm2eaums;t4artoxo3oy1lpDraivils0trtoiopio4lpee iesl( aDrau p;o0aptoii3iadlm uanvo;t0 renxr iydfp raiei;()t2urio3oodlp   fcia()aDur(rooo1tpx  o3iytlaDumn s ()tlerio3iy1fpDeluvs s t2trim iu1amtelnvtat)s2rmxr ot1tlenio3iydfm2rmnms;t)alenif3oy1lp   ies t srxr(o oydomt  nesls)sDrrx pot0tptoifeiatls2rlu s t0trenxr ty1oaDranvo;t0srxoxr3oudop nmfvi tfarrrumoou0texomociyd a ea(vo;t) lxrmocia1lptrli i;s) eurio3ou4amt lnci t  2ur( ono4olxo f3tas s ranmo;u)texrxo3ia1lmDelneils  rtoxo io4altn neslt s2urxrooo0alt io3tltlsDean o t)teerxfcoatfp  lueo;t0 2urxo3oy1lmen fcs t a2tmur ;t4apeoifciydlaDuluvsn(4trxoir oadlm   uvo;(  rurim3oo4al e fvs sfaDtrxro;o0oleoifetls m2el( p;t4 lxrio3oytomteluesls) exrio nydlptnlfcsas arrr(r oo4texo feiad sDrlu o t) rxomr3iodfp r n ol() exoir3ou4aptelnvsls) rtrxro;t4oleo oetas m uau p t0teermocoa1faDeaneil( t2toiopoo4om  lneils aDrax ont0teenmfeiys m ean s;()aetnmrcoydlaDeauvo (0texo(mpoodlmt lici ( s2uru  ;u4texnmoeiadfm rln p;u4areomocta1lp ran s s setrxr iodoptnmnesatfsDtau onu4oetnmf3tydla2ul(vo u)arermo iotla e u s t t2trxopnudomtnlfvi s)aDumur nu0tlxo feildfmDulnvs u)artnxo io1fmte ieslt seurio ou1apte fcilsfsDrm(m no1aeeomfciyt sDrlu on(4trerxr3iodfa  liei t)sexoir3oo1lmtn ivs t) Drmu  no4alenmo3iyt s rlnmpnt0 rtnxfcty1fm e i s;()tetr(opiy4ome mivtlt s2tr(rooo1ape mfciatfs2um(vpn()altoxo iytfpD luvs;s sexmimpny4alte iet tfarrmxmpnt1oexnmfeilslm rm(vo u4trxrxrcio1fm  luvsls0trxrirpou4lme  fvtls  rur(r ;u0tpeniieiad a2eaumo;()texnxf3tydlaDelu o t)setr(o oo4ap   neta(  rtmx  ;u0ole if3tasfmDelnmpnu) etrif3tytfaDe ieols0t2xrim oy4amte ivi tfa2ur( oot1aexo ietld s um( o;u)texoirciadlaD  uvols t2tr(rpno1ll  lnctatf rta(r nu1tee  iciltfm2uau p (0tetnmrctydlmt lu i ()srtm(m oy4olt  nvil(  rrmu  ot1tlto i3ild a emumo t)tltnmf3oytoaDr nei;s0 rumir oydapeelivi t)s2rr( ooo4tpxn feiyslsDean s;t4artoxrctotomDeauei;s t2xoxr3nydamenlnet t srrmx  ot1oeenmociltlm2umumonu0 rxoifciy1latran s s  2tmirpny1ll e fet s aDrax oot1tpxoii3tlt sDrlnvp t4 rermociodfmDrli il(0teuoxm3oo1ol elivi (f 2umu o;o0tee mfciatfa2rau snt4trerif3iy1oa r neilt)srtrxr3no1ll n fctasfa2ra(  no4oet ifeildfaDul( p u)tlxrmf oa1opt ai o;( s2ur(m3ou1lmee ivsa() Durur ot0tet  i3ilt m el(vo u)texoxr3to1oa  aieo;(  etm(m iy1ap  micsl()a2uaxmoou1aleo oeiytlm2rmums t) ltnxr oatfptean i;(0 2umirpiodomt mfctat  2taxmoot4tleo fetasfa eanvs u0arxoif ty1op ranvo;s)s2uoxrpiudal emieiatfsrtmur ;o4tle  i3iyd mDrl(vo u)aetomfciatfaDr n s (0sexoxr iydlpte fvi s)srumurono4aeeo ietatla2ra(vp () rtoxfctadlat  u il(0 exrxm3no4olt  nviat sDua(mo;t0altn ictldla2el(mp u)tltomfcoy1lp rauvi;s)t2xmimpoy1ome mfciltf Drau p;o1alt mfeiytlsDrlumsn(4tlxrio ootoaDraies t  2to(o3ny4ll nlfeil()a2uaumoou0tpt if3tls mDemumsnu)tltoxo3to1latelu o;()trto(opio1opt livi ()arrm( ont1optoiociltfa2ua(vo u) rerxr3iytfmDeaues t0setriopnodlm elncsatfs2tm(rooo0tpx  feiys mDrmnmo t0tltoifciydlpt anvil( srtrxm iy1opeemnvs sf Dtmxronu0texo i3tlslm rlnvs u4treomf oy1lmt  i ils)sexr(m3ny1amen fctat  rur(m ;t1alxnmi3iydlmDrlumont4 rxoir3iatfm eliesls)teuo(r oo1omt mfvtl(fs2rmx pot4oeeomf3iat a2ua(von(4trermr3oo1fpt  ueo s  2uoio nu1ll emiei sfsDrrum ;o4tlxnioeild s2em( pnu4aetrxo tadom e u s t teuo(o3nudole mict sf 2umx p;u0ape mf3tysfs em( s u4 lxoif io1om r nvol(0 rxoio io4ol nmfvil(  rururpnt4alt mo3iyd s2ra( p (4tlerxfcta1omtrli i t) rxo(m3oo1olenmivtat) rtruro;t0texnmieiat a ran p u4 rtnio3todfp e uvo;t0 rtrirpoy4ol elicia() 2rr( onu0olxnifeiltfm ulnvo;u4texrir oodlpDeauvs s seuoxrpio1lm   ncsa( s2urum ou4oleomictlslsDrmnvp;u0 rxoio tatom rlnesl(0tetoim3iy1lmtemieias)a2rmxroot1apxoio3ildlmDulums t0arxnxrciy1laDelu s;s)t2tmxopiodomtnmfcsl()sDtaxrpou1aptoiiciadlsDeaums u4texomf iotoaDe uvo;t)t2xoirpiu1apen nei ( sDtmur ou1olxnifctasfs2um(vs;u4artoio3oytla  luvo t)texm(m3ou1ap n ietasfartmxrpou4ole mociytfa2rlnmsnu)tetriocoo1opD au ilt)srxoiopnydoleemieslt sDtm( p;t0texoioeildfaDrau s;u0 rxoxoctatopD anvi (0 etoim3nu4lpeemictat)srtr(moot0oexoio3iys s ul(mpn()artrmo3oytoa rlu i s t2umir3ny4openmietlt)srurxr ;t1aptnmicils mDrmu p;()aeerxocoadoate uvilt0t2um(o3io1lp emietat)a2ra(m ;o1oex iociadfa2elu pnt)trtnxr oatoptean s;t)sruoim3ou4ome  ivia() Dtmurpoo0tet  fciyslm emuvon(0aleomo3iotfa rlivo;(0 rumio3no1amtn fesasfsDtr( oou1apenmoetadfmDran s (0 rtnxo3oodoptrlu s () ruo(opny4am  lfct (fs2tm(r ot1olxoiietytfs2elums;()aexnxf tydlm e i s;()teumxr oo4ll e nvtas a2tr(mp;u0tetniiciydlm ea(mo;(4 reoxoctatlp e n sl(0srtmimpiodoptemncilt  Dtau  ot0oltn oetad s2em( pnt0trtoxf iy1lmDelneo;t)teurxr oodomen fct s)srrmu o;u4apto icias a rmu o u4 ltrmo totlp eai ol( srtmim3iy1ol nmneil( s2rmu onu0apt mfeiydlm2eanvpn(0alermr iatlm r i sls teumxrpiodom e fvi s) Dur(rpno4opt mietys mDrl(mo (0 eeomo todlaD ai i;s0 exo(opiy4om n nvilt)sruru  ;t4apeo o3tadlm2ua(vp t0 etrif3ty1optr iei t0 rtoimpno1lpt lnci tfarrru ono0aleo i3taslmDrl(mo t4 lxnmf iatlateaivi s0sexrxo iudll  lncs sfsrtrx oou1tpe  ietaslm2raumon(0 lxomf3ty1fatr ivsls0srxmxm3io4amee fcs ( sDum(  ot0aexo i3ildla rmnms;u4 exrxo tydoaD au sls)trxmiopiy4omtn ncsa(fsruru o;o1tptn octyt a umn o;u) eenxocty1lmtrlu s s)s2trxmpny4optn fvils  2ur(  ;u4altnif3iatls2rl(ms;(4arenir to1oaD aneil()t2xmxm oudop n fei t sDtrxmooo0tltoii3ils a rm( s u0alerifcto1oa  anvo;t) etmio3iu1olt  ncta()s2raxmp;t0apxnioctas sDeau p;(4alxrxo3io1lpt  nesls t2xoir3oydol emfvs ( sDta(  ;o0apeoii3ils s ra(vpnu4 exnif3iadomDranei (0s2xmir3io4altn feta( s2urxr ;t1olenii3tas s2eanmo;t4trtoxfctodfa e u o;t0 rurirpiu1om   fcsa(  Drmu pou4tltnii3iys mDulumpn(0 lxrir todfaDelueil(0 2uoxr3oodaptemfcsa() Drru o;u0oetoifetldlm2eln s () rerircoo1lm ean i;(  2toxrpny1alt  fvt sfaDtaxroou0aeenif3tltfaDrauvs t4arxnio ootfm ranvs s  euoio3ny4amte fet (fsDrmx oot4tex ioeiltfa2ua( p;(4 leomr io1laDrau slt trxmir3iu4lmeelfvi ()aDra( pnt1aetn fetydfs2elnmpnu) leomr tytom e ues (0t2xo(o iodamtnmnet s  2tr(  nt4tlxnmi3tat m2ulu sn()altnxrctydomte uei;t0 euoir oy1lm emivias artrx p;t1ole iociatls elnvo u)aexoxrctatopt  u slt0t2trir3io1ole lnet t)artmxmpoo1oltomfetytlmDumnmp;(4 exoxr3oadfptraiei;t0t2urxopiydapt  ietlt a2ur(ro;o0olenifctlsfs2rmnvo;(0artoio ta1opt  u i ( t2ur(m io1omeemnviat s2tax ooo0altnmi3tls aDeluvs;t0trxnmf3oytoatrauvs ( sexmim3no1omenmfei ( srurur no0tpx  ociasfm ua(vs t) etoxfcoadomt  i o s) ruoxm ny4apen net t srtm(mono0open ociadls2rmu s;u4 renxf3oodomteliei;t)trumxo iy1apeemfvsat  2rru pot0oexniieilsfmDuauvont4tetrxfciytfmt  iei;s) eum(o3nu1lpeelietl()srtmum nu4tpen feiysfs emuvs u)texnmociytom   uvilt s2trio3oo1apeemfctat sDumxm oo1olxo fcildfa uan snt) ltnif3tydfaDraivi s0 etmxm ny1ll emiet s  rtrur ot4tpeoifctlsfmDeln o;u) rxnxr3to1lmteli olt0 2umir iy4opeelnciasf rum(r oo1apeo o3ilt sDrmu s u0tlxomf ootlm  aueo s)s2urxmpiy4omtnmicslt)aDrmxmoot4olx ioctysls ua(vs;t)tlenmrcoatlateai o s)s2uoxmpoodom nlnvtat sDur(mpou0olen ociys a2uanvs (0 rxrxo3iytlaD luvo;(0 exoxo oydolt  ici s) Dumxm ;o1oeenmictlt sDemu p;(4treoircoytfa elieo (0sexr(m oo1optemfci ( sruau  nt0tpt ifctat aDrl( p;(4tlxrmr3ty1la e nvi (0trur(r oo1am nmivtasfs2uax pnt1oetniieiatfm2em( o;u0tlenxr3oo1oa  lneilt s2uo(r oy1ol emnetat artaxmpnt1optnif3iys sDemnvo;t4texnmociadlat an i t s2trxopoy1ameelies tfsDrmx p;t4olen oeiat a emuvo;u0tetoxo oatfpD livolt0srtmxo oodamte iciat)s2tmx p;o0tlxnioctytfmDrm( s u4arxrmocoadlateauvolt s2uoxr oy1ap   fcsl( srrm(r ;t1oltomieiydfm2ea( pnt0 ltoioctadfmDr uvi;(0sruo(opiydamenmnvi ( s2tm(mpno0opxn oeiysfm ran onu4aetnxoctatlm eluvi s  rxrimpny1opeemnvsl( arumx  nu4olt mfetadfa ranvp;t0alxoxfcootom ranvs (0t2uo(o3iu1ameemics s arumump;t4ape mociydls2rln p;(0 etomr tadomD auvs ( srxo(r3iy1op n fvtlsf 2rm(rooo1ole mfetld a2ra( s;u4trenio3oy1lmDranvo (0 etm(mpio1om nmfeiatf 2rrur ou0aptn oeilt s uauvs;u4 lenxrciodop  lnesl(0t2xmir iodoptelnvs s)s2trx pou4tpeomf3iyd a ulumonu)teerio3iydoptrluei;t srxoir3io1omtnmicsasfs2rr(rpnu4optniietasfaDulnvs t0alxrmfcoadfm  livi s  2ur(rpnudomenmncsat arumu  nt1ole iiciltlm em( p;(4tlxomf3tydoaDeanvs s0texmim iu4alt  nvtlsf 2ta( o;o0openmo3tytla el( on(4trtnxociydfmDean o;( teumio3ou1om elictat)aDtaurp;u1alx iicildfmDelumpn(0 rxrxr3iatomtean o;s  rtmimpiydoltelivia(fartaxmont0tlxn f3ias a eluvs;u0 rerxfciytfa  aiesls0teto(m3ny4apenmfct t)aDurump;t4tex  f3tydla2eauvonu4altrxf3oa1omtelueilt srumxopoo4ome mfct (fa2rrx p;t4opeo ociys mDuln onu4tlxoif3tadlm  an sl()setoxr no1om e fcs ( aruau ono0alenmociatfa2ul(vo;t)trtrmo3totomD lnvi t)texrxm3iydale lncsa()aruaumont1alxnmiciltfs2ulu p (0 lxrmf3iodlmtrau ils) ruo(o oy4al n fei t a2tm( ono4oetomociysfm2ranvo t4tetoif iatla  lneo;()trur(r3oudap  mnci ()artmu  nu0apenmi3iasfm rmnvpnu0 eenmf3tytfmtelnvs s0sexm(rpio1am n ict tfs2umxr oo1aexo f3iysfsDra(vpnu)aetrio3ta1fmDrai olt)trxm(o3iodaptn ivtl() 2ur(m ou4aleoii3ildla uln s;(0tleoifcoydfmD  ivs s) etoirpnu1aptn nviltf 2umx  oo1alx mf3tytfm ra(vp;u0 reomf iatfp eau olt teuoxm3nydopenlfviatfartr( oot1tlx if3iysfa2raums;(4artnir totomtraueil(0teuoxo iudalen icil(f rta( oot0oetomfciaslmDul(monu4altoiociy1fatraneol()s2toio iydlpe mfesas  rrau  nt4teeoii3iydfaDrau s u0arenmr iy1lpD  u olt)trxm(r3iydlpen fvils  2uau  ;u1aexo octas sDemums u4tlenmocoytfp r n o s srurxrpiydlpe  ivias srum(mont1texomfctlt s2ulnvp (0texrmf oytopt au o;() 2urxr oodap  lfes ( sDuaurp;t0apeoiietatfa2ua( s t4 ltnxo oo1omt aivsl()trum(m3io4op nlfvt t)srtmxront0oetn o3tadlm2umuvp;t0tltrmr iatfmDr ieo;t trur(m nu1om e fvt sf Draum no0tptn ociyt aDrmu p t)altrir iodlmt ai o;s)trxrim3iy1amee netlt)aDrr(  nt4texnii3iat mDrl(ms u0aleoifciodlaD aneo;t  rtriopnu4llenmietatf Dtmu pnu4oexnii3tasfs2eanvs t4trtrxo oo1lmDr u i s) euoimpny4lmte ietlsf rrax o;o4tltomf3iytlm ua( o ()tlxniociodopD lneo s seto(o ou4op nmnvil(fsrta( poo0tpenio3iadla2umnms t4 eenxr tadlpD luvsl( s2xrio iy1optnmnesa( sDrruroot0aexo f3iyd s emu s;(0trxrxr3tydlm rluei ()t2uoxm oo1olen icsls) 2uaxmoou1oetoio3tlsls rln on(4trxomfcoydfpt ai slt)seuoirpno1omt miesls artrx ont0olt ifeiys a em(vp u4 lxnxfcoy1oa  lnvs t)texoio oo1am  lnetlsf Dua(r ot1aexo ieiyt mDeaumo t4 exnxocoodla raieo;t)t2urxr nodlle mfvias arraxmoot0tpe  f3iadfa uanvont4arermr oatlaDe nvo;t tetrxo oo1apeemiesa(fa2rrx  ;u4aet mocildfaDeaump (4 rtnif oytfptr uvs (0setmxr3oudll n fvsatf rtaxrono4aetoifeiydlaDrau ont)texomrciydfp  an ils0 etr(opnu4opeemnvsatfarurxr ;u1tetn oeiydls2eluvsn() exrxoctotlm ean o s tetr(r oo4llt lietat sDrm(mpno0optnii3ildfa rl(vp;t4aetnir3iodlm e n s;( t2umirpnodom   ieta( a2uaurpot1tlxomfeiysfsDrmnvo t)tlxrxr ia1lp e iesls  rxmxrpoudllee ivsa( sDumxr oo4optn oetldfaDuau onu)alerifcoo1fa ranei ()teum(o3oydole  nctlt srtmxm ou1olxo fetltls2raumo u0altrmo3ia1opDeauei s seur(o oydomeemnvias)srururonu0tpenmfetlsfaDranmo (4aetoir tytfa  aieo;s srxoim3ou4ll  mict t arururp;t1altn o3iatfs ea( p;()trxomr oadlpte nvsl(0t2xoxo3no1lpeelnvi (  rtm(moou1oltoiiciatfm uluvp (0tlxrxf tadlpDraieil(  rtm(rpnydlptn ivs (f rrrxr ou4altn oetldlm rm(mpnu0teermf iotlp rlnvo;t)sexmxrpoydaltn nvs s)aDuaxmont4apxnmfeiysfa2raumpnu0alermo tydlp ranvi s)t2xo(r ou1am emict tfsDrr(moot0oex  feiaslsDuanmonu)tlxrxocootfpDeaivs;(  etm(r iy1op elfci tf 2rmu p;t1oetn oeiyt sDrl(vs;()artrmr3oatlm   nei;t srtm(mpoodlle  fet t s2ra( o;u0aptoioeiydfm ua(mp (0texoxo oo1lpD li slt)sexoim oo1opeelfes (faDra( pot1alt  fciatfsDelu s t0treoif3ia1fa eluvs t  rtmim3iydolenmnvil() 2rrxrp;u1tltoifeiyslaDua(vs;(0tlxnxoctatlm elnes t)s2xr(m oudlpeelnetl(fsDrrx  nu4oleo f3tysla rl(mp t)tetnmo3ty1opt  ivols0srtmir iudopenmfctas)aDtmurpot4opeomo3tat aDranmsnu0artnio3iytlaDrlnei;t)t2trxr no1omtn fct s sDrmxr ;o1tet mocildfsDem(vsnt4arxnxr oodoa  anesls0t2urio oydomtnlivsa() rtaurpou4aeeoifctltlm em(vo;u4 exnmrciodoa  luvs t  rxo(mpny4lpen ivi ()aDuaxmooo4ape iociat a2ran p;t)trxrxr3oatfm r n o t srtmiopiy4omtelfviat arraxrpou4tet  icils s2ran pnu)tltrxf3oa1fateln s () 2trxrpiu1am e ivsltfaDuaxmpoo0opeomoeilsfmDemuvpn(4texnir3ootfptrai i (  2xm(o3no1lle lnctas aDumx  nt4tlxnioctldfm emn p;(0altnxoctadlm rluvs;t)t2xmxo3oo1ll   ivtlt srraump;o0tpx iictasla umn p;()trxnio3tatfmtraies s setrxmpou4olenmncslsf Drr( o;u1ope  f3iad s2ua( p (4aexnmocio1lp ean s;t)texmxopiy1lpt  nesa() Dtmxrp;t0teeo iciad s um(ms u0trxoir tytla r nei;t)trtoxr io4lleemfct (fsDtr(mpou4apxn o3tlsfmDumump;(0 reomo3tadoa  aueslt) rxrxo3ou4al e ieias s2um(  no4aetoifciad s2uaump t0 lxnxfciodfpDe uvo;t trtm(rpiodolee fvsatfsDum(mp;u0oeenmo3iltfs2emnmo u0trtrio3iodfp elieil( t2uo(r io4lpe mfctlt)aDurxr ot0olx io3iadla2rlnmp;t0tetrmr oy1fpD lu o (0trxoim oudaltnlnvs (fsDtmu p;u4optn oetld m2emnmsnt)trxomr3tydfmD aivo;t) etrxr nu4lmenmfvt sfsrur(rpnt0ape ioctltlm2uanvsn(0 rxnmf3iytfatelnei s0trumxmpiodllt mnesa(f Durxroou0texn i3ildfm rmu o;t0tltrmf3iytoatelu i;s) 2um(mpnodom n ieil( srtrx  nu1aet ifciadlm2uauvs;t4 exrmf3oodlp rln s t0 2xmxr3ou4lm  lnvs ()aDuaxmono1tle iieiaslaDran pn()tleomr3iadfmDeauvil( trtr(m nydap n nviat) 2rau o;u4oleo i3iysla2rlnms;(0 reriocto1fp e nvs t  eurimpny4am nlnvilt)a2rmxrpot4apenifcildfs2uluvp;t0tltrir iydlmDe nvs;t)truo(r io1lltelfvi s)aruaxmoot0aee mfciasla rlu ont4treomr3ootfateanvs s0truoxmpiu4amtemieil(fsruax o;t1alt mo3iyt s2ra(vo;u0artrmr ootfp  lu sl(  exrxo io4amtelfcil() 2raxro;t0tpen feiys mDea(vo;t4 etrmrcia1oa ran s;s0setm(m3io1ole mietl( aDtru ono1tlx ioeiadfaDeanvsn(0 rerif3tadfm rlu slt s2xmxm iu4op nmfcils  2rm(mpou1teto o3tydfa emnvpn() lxomo3todopDeluvs;t0 rxoir3iydop elfesatfs2uaxm ;o4tlt  i3tldlm ea(mp t0arxomo ia1om ean i;s0sexr(r3oo1ol nmfes s s2taxmoou4optn ocias m umums;u4tltnmo tytop e nei;s0 euoirpnodamt lncils srumx ont1aptnmfetldlm rlu pnu4 etrxr3iodfmDe ivs;(0s2toirpoy4lmee fei t)aDrrxmooo1tle mf3tysfs uln ont)aexnxociadlmtr neo ()s2xr(o nudlm  mfci (f rtrxrpnu0opxo o3iyd a rm( o;u0trtrio3iatopteaivo;s)texo(o3ou4ol nlfcsa()aDrru pou1alto o3ils sDemump;u0tltrmo3oodla r nesl()s2um(rpoudap  lieias a2trxmpnu0ape  fetldlsDrl(mo t4trtnifciytomDeai o t t2toio3oudomtnmnvt (fa2rruroot0ope mfcilslm umump (4 etoio3ty1fm ranvs s  rtr(opnu1lmt lncsat  Dtm(  nt0optnmi3iysfsDel( p;t)alxoio3oytfmDe u o;t) ruoirpoo1olt lfvia( sDtmu pno4oexomfeiltfsDumnms (0altnxfcoadomtrln o;t0srurxopiydal elictlt aDrrxr no0tpeomfeiasls2uln snt4 renirctatom  ai o ()t2xoim oo4omtemneil( srtax p;o4tpt  ictadfmDrm( sn(0 rxoxr3io1fat  n ol()seurimpnu1llt lfeiat srumump;o0oeeomo3iadlmDua(mp t) ltoxf tydfmDe nvo;s  rxmimpno4apt lieia( aDra( onu1olt  fetydls rlnvsnu)aetrifciydopDe n sl( s2xoxm oydapee fcsat)srrrumonu4ole iicilt a2ra( snu0trerxo tytlmt ai i;(0srurxr3oo4amt  ictat aDrrxmpoo1teenioeiasfm em(vs;u0areoircto1faDrlues ()srtoxm ny1am nmieils  2ta( ont0tlen octyt s2elu s ()tlenmr3oo1omteli o;t0 eurxr3iu1llenlfeia(  rtax p;u0olt ioeiydla rmump;u0aeenmoctadlatrlivs;(  rtoxr iydome lies t s2tmx onu4tex mf3iytfm2rm(vpnu0aetrxf iytfm   i i (0 exrxr3io4al e nviatfaDrrxro;u4tex if3tas aDuan s;u) rxomf3ia1lmDraieols sexriopno1apt livs tfsDurxrp;u0aeenmieild m rm(ms t4 exomfctytoa   ieslt)srxmim3oydam nlieilt arrmurp;u4alt mieiytfaDeanmp;(0aleoxfciadfmDrln sls  2urirpoo1alte ietls aDtaumpou0tlx mictyslm umu pnt0aeeoifcoa1faDelies ()texm(m nu4ll   fcias) 2trxmpot1tltnioeiltfsDemums u4 rtomfcoatlmte nvi s) rtr(m nydoleelici t) 2ra(m no0tpeomfeildlsDelnvs;u) eenifcty1lmtranes s)srtmim oudlm nmfesls)artaxrpou0tptnmf3iadla2elumsnt0 ltrirciatfmDr uvo;s)trtmxo3iu4lmt  nvsas sDtmxmpoo4apeomi3iasfmDrm(mo;t4tlxomr oa1fatr neslt t2tmxm3oo4lpt lfct t) 2um(root1texomo3iydlm2em(vs;(4trxnxfcoadfmtr ivils)sruo(r3iodome licsas sDtaum ot0aptnmo3tlsfm2eluvp;u4trtomf3oodop  livs s) 2uoio3nu1am  mnviat)srtrxm ou4apx  i3iys s um(vsnu4altnxocoytoa eli s;t s2toxmpio4op nlfeia()sDurx  ;u4tpxnmi3tydfsDrln pnt)texoxo3oatla   i i (0t2tr(mpiu4aptnmfvtlsfs2ta( o;o1tlenmo3ilslmDul( pn(4trtriocoo1oaDeaueo;s0teur(rpnu1omt mncs t)arta(rpnu0olx ifciydfs2emu s;u4texrxf3ta1oa eaueils  ruoxm nydlpenlnvtatf rraurono1tetnmictyd mDrmumpnu4artrif3ia1lpDrlieo t) 2xr(opoydlpenmictat) Draump;o1tlxoii3iyd sDulu p;u0arxrxo ty1opteanvslt  etrxo3ny1al nmnet ()artm(  ou4tpt  octltfm2rmn s;t4texoxr oatfm  li o;t srur(o nudal nlieia( arum(ro;t0tpeo oeiys s2ea(mp u) etrmf ta1op e nei ()texoxm oy4amen fvt ()aDtrurooo1teeo icilsla umnmp u0tleomr oydlat lueo;( texr(r3nu1llt lnetl()arumu  no1alen feiatfa2ea(mo;(0 exnioctotom rau s (0srxrxo3iy4omte ieilt)artax  no1aet mfctatfa2emnms;u)artnircoatopDeai s;()s2xrir nudlm nmnct t) rua(mp;u4apeomieiat a ra(monu)artoxf ty1lp  ln o;s t2xr(opny4ll n net s  2tm(r ou4tet  feiytfs umnvp;(0altrmf3oy1lmD aivi t srum(mpiu4omenmnci t)sDtmxmp;t4aet ifctasfmDrm(vo;t0tlxrxrcoa1fm   ieols0 rxrxrpnydaptnmictas)a2raxrpot4apxnioetls s umuvpnt) eenif3ta1lpteln i;( srxo(m iudolt  fesltf 2ua(mpno1aeeomo3iasls2elnmo;u) ltrmr ia1lm e ueilt) ruoxm3ou4apte fet ( srrmur nu4ope  o3tadlm2rl(vp;u)arenioctadlmD lnvols t2xr(rpnu1lmte ivt (  Drmum nt4tpe  iciytfm2ul(ms t4altnircta1omDrai s t setoxopoy1omeelfctls) rua(r nt4tpt moctysls em(vpn(4 eenif3tytomtraieils  rxriopoodlp nmnesl()s2rm(m ;t4aleomfeiltlm2rln s;t4artomrcoo1fa e nei (0s2xmio io1apeemiesasf Drax pou4tlx ifciysfa rm(mpnt4 eenmfcia1om  lnvi t0sruoxrpiodope lnvi tfartaum ;u0aleo i3iydla uanmp;(4 exnxf iydfa  aues s0 rtoxopio1lltn fvsasfs2rr(rpot0tpt ii3ildlsDulu p;t0 lenxf3ty1fmDr n i t  2xm(m3ny4om nlivt sfs2raurp;o1opxomieiydlaDem(mp u)arxnxf3iotfmDe ivsl( srtoxr3oy1optemivs (fartrumont0opxniiciltlaDumuvsnt)trxnxo3tytomD an i;s0sexrxo3ou1ll e nviat a2rax ont0tpto ocilt sDul(vs t4 eenif3oydomtranvil( tetrxopiy4lme lfcils)sDurumo;t4tpe  i3ilslm2rm( s u0 rxnio3tydlat  ivsl(0t2trxm io1lm  lnvt ( aDururpoo0apx iieiadfa2rlnmp;()teerxo tydla rlies t teurxr3oodol elnetl(  rumx pnt4altnioctatls2ranvp t)tltoxr oatom e n s s s2xrir3oy1lm emivt () 2rru o;o1tpx  ociatfs2uanmsnu4tleoiocio1oa elu o s)trtm(m oodlp nlfci t  2ra(r ot1alx iicias m2emu ont4aeenirciy1lmDe ivo;s srxrxo iu1ape lfvils) 2rmxm nt0aeeomoctasfs emn p;(0 reomf oo1fm elnes;s0t2toimpny4llenlicias  2tmxr nu4tpxnifciat aDulu p;u)trtrmrciy1faDraiesls)s2xmim3iy4ol e
\ No newline at end of file
@@ -0,0 +1 @@
+n o t) rurim ny1oltemfcils)srrr(ro;u4apx ii3ilsla eaums t0 eermrcoodfpDraivi s)t2ur(m3nudoptelivias)sDrmxroou4teen fctat aDrm(vont)trxomfctytopteluvi ( t2xr(r ou4altelfcsls)srrmx pnt1aeeoiictasfmDelump;t)trenir3totomteaieilt) rxmxmpiy4lm nmietlt  rua(mpnt1tlxniieiytfs eln o;t0 ltnifciodlp r ivslt)t2um(opnu1lpeemncsa(  rurump;t0oex io3ild sDran s;(4trenmr oy1fp   ivo () rxoio iy1ole lfetl()arrmur nu4oee mociytlaDrmu s (4 etoio3oodlat  uei (0sexmxo oodal   iei (  Drr(r nu4apt  ieiltls2umuvp u0teeoxf ia1oa elues ( s2tmio nodlmt mfvtltfsDtr(ro;o1tlxnmo3tadfaDrmnvont)tlxoxociodfptr nvilt)trtr(o3nydlmeemnctl( sDuaxro;o0optn o3iydfm2ulu s;t0 ltrxf oydoate iesl() rtm(mpoy4lm  lnci t)s2rmx o;o0opeoiociatfs ua( s;t)aeerxfctydoptr uvilt  2tr(r3iu1om nmnvia( sDtmx ono1tpt iieiydlm2ul( s;(4alxrmrctodfaD lies;t sexr(m3ou1al elfvi ()aDtmxront4aee  i3iasfaDeanmo;t)alenxf3todomDeaieolt) 2urxo no4ope mfcs (faDta(rpot0oetnii3iysls umumpnt4aetnifctadlmDran s s) rxmim oo4lp nlncsa(f rum(rpnu1tpt miciad m rm(ms t) renmo3iadom  aivi t0 etoir3no4lmtn nvs s aDurur nt1oet ii3iatfaDulu p u4 rxomocio1omDelues;t) rxo(opio1lpe  nvilsfsDumxmont0alenmf3iydlsDrlnvs t)tltoxfctadlmtrai i;s)t2tm(rpnudomee ivt (fa2ua(rooo4oexnmoetld aDrau o;(4trxnir oy1latraneil()s2urio ou1apeemfcsatfsrurx o;u4open ictyt s ua( o t) lxnmocoatfpteau i;t)srtmio iu1am  mfesatfaDtmx pot1alt moeiasfs ulnvp t4 etnio3iydomDe ivi t)setrxm3ou1ame  iesas  rtaurp;t4olt iociysfa elumo u0trtoif oatfptrai i;s srurim3oo4ale lici ( srta(moot4opt mfctltfm rm(mpnu) reomocoodlpD an s (  etoxmpiydlp elnvsl(fs2ta(rpnt1olen i3iytlmDul( on(4 leoxo3tadfaD au ol(  rurir3iydalee ncilt)s2rmxro;t4aeeomi3iysfsDuau snt4tltniocio1optelnes s  2tr(o oydoleelfvilt sDtruroot4oetomoeils mDemumsn(0 leoxrcoo1omtelieol()sruo(o3iy4opt lfeia(f rtrx ont1tpx ioeiatlaDeauvs;()aetnmrcoo1fatr ies ()srxrxo3oudaleelfci () 2ur( p;o4oleoiieilsfs raums u) lenmrcoytfm eli o;s trurir io1lltnmfcsat arua(r ou1tptomietltla emums;t0alxnmr iy1fat aueilt0 2xo(r3nu1am emict s sDur( oot1alx mi3ils mDem(mp u)texrxo tydfpt liei ()setmxo oy4lme mivtat  Drm(rpot0tpenmfeiasfmDrmuvs;t0tetnif3ia1latr uesl() euo(r3oodlm   fcsatfaDrmumo;t1tle ifeiaslaDra(mpnt)aexrxf to1fm r ueilt0 ruo(r3oy4olte fci (f rumump;t1tptomieilt aDel( p t) reomo ootfpDe nes;s0 ruoir3oodlmtemfvta( a2ua(  ot0ale ifctasfs2rauvpnt4 leoxo oadopte n i t srxmxrpoy4ap   net (faDuru  ;u4tet  iciat a2uluvp;t0trxnioctydfmDeauvi;s s2xmim ou1op nmivt t arta( o;u0ole ii3iad a2rmnmsn()alxrif ia1lpD anesls) 2xoxo3no1om nlfei ()aDraxm ;t1opt  i3ilsfs2emuvp (4 ltomf3oytlmte ueols s2xmxr3ny1amtelivi t)aDra(r no1oetoiieias s2em( pnu0teeoio iydfmD aieilt)s2toiopnu1opeemicsat sDrrumo;o0aex iietas s2uln p u0aetomf3iy1fmD lnei ()s2xrim3iydom nlfvsat) Drax  ;u0olenmfcils sDrmump;u) ltnxoctatlmt  n s ()seuoirpoydlltnmnctat) rurumpoo0tpe  ieiltfaDuanmp;u0tlxnmo io1lmtr ivs s texrxr no1amen ict ()sDrrur ;u0apxn f3tytfs rmnmo;u0teenif3tydopD aues;s)tetmxm3nodoltemnvilt  Dtmu  ;t0opt ioetydla2ea(vs t4areomrcoodlp eanvo (0srumir iodol nmivtatfsDrmu p;t4tpe io3iyt a2rmnmsnt) rtnir iytomt anesls)srtmio no1lle  ivt t)aDrmum ;u0tle  feiadlmDean s;t4artomf3ootfaDeau i s0t2umim3oudomtnmncsl(  rtrum ;o0oetnifciatfa2eau p;t) rtrxr io1lmt  uvi;(  exmxmpio4om  livsl()sDum( onu1oexoif3ilsfsDuaump ()teermfciadfmDeaneils)texr(r3nodlm   fvilsfarua( ooo0ape if3iysfs emnmo (0trxnioctydlpteanvilt)teuoxopiodaptnmncs ( sDra( oot4alxnif3iatfm2em(vo t)tlenirciadom eai s;t0 eto(o iodapeemfctlsfsrraumo;u0ole  ocias a ran snt)tleomocoytla ean i;s0 exo(mpoodlleemivsl( srtm(moot0ole ioctysfm2ra( sn()aexnmo iotfa eaieil(0trxoxr3oo4opeemictat)a2rau o;t1teeoiocias aDelnvo t) ltoio3iadlm rln s t)trto(m3iydamtnlfviltf rtru oou1altomi3ils m em(vp (4 leoxf oatfa e uvo;t0s2xmim oo4lm   netlt aDtrxront4alt mietltlm rl(vo (0areoxr ty1omte i i s  2umxm iy4lp   nciat  Draxro;u0aexn ieiytlmDumuvo (0tetomo3oa1fmtrlnvil(0trumir3iu1lltn ivi t)s2uaxm nt0tetn oeiaslmDuanvo u)tetnio iatopDraivs s0setm(r io1olt lfvtlt)srtmxr ;u4ole miciltla rl(msnu0trtnxfctydfpt aivils  rtmxo nodolt  ics t)aDrrx o;o0aptn ictaslm2ulump ()alxomoctatlptr uvolt0 rumir no1lmee nvi tfsrrmx o;u4teen ieild m2el(mp;t) ltoxf3oodlp  auvs;s  exoxr3oy1altnmnvi t)aDtrurono4opxnmf3taslm el( snt) exnmfcoadfa r n sls) rxm(o3oy4omenlfciat) Dtmurpou4alt iietatlaDemnmp;t0aeeomo ootop rln sls0setrim iodlpt  ies s)a2tr(moot1apeoii3tatlm ul( snu0texomocoa1fmDrlueil(0 rtmim no4lmenlnviat  rum(mo;u4apen o3tatfaDrl(ms;(0 rxomo oatlptelnes s0 rxoir3ny1apt  fcils)artaxrpnu0tlt mo3tyslaDua( p (4 lenmr3oa1latrluei;t) 2tmxrpiy1ole mivsatf Drmxr ;o1aexomo3iyt s2ea(vs;t) rerxr ta1fat an i t)t2xr(r3io4ap  livt (  Dum(m ot4ale io3iadlm ua(vonu)teeoif oydlm  an o;t0sruo(rpnodlptelnei t)artmxmo;t1tpt  oeiys a em( o t0tetoirciatfmtr uvsl()seur(r3oodop   fct ( s2tr( oot0tpxn oetytla2ua(vp;() etrircootfmtelivo;(  2ur(o3iudllt lfetlt) rta(mo;t0oleoiiciaslm2uaums;t)aexrxo oo1fmD lnvi;s sexoim nodopt mncsasf Draumpno0tpt mieild a ra(ms;t)trxoio ta1oa rli slt  etr(r3nu1om nmivs s sruax oot0opeoio3iytlsDea(mont0tetrxr oatfptrluvo s  rxmxr3io1alt livilsf 2tr(m no4altnifetlt m el(mo;(4aexrxo iatfptrluvols0 2uoxmpoodoltn iesat sDrm(mpnu0tetomociyd s2el( on(4 rtnio3io1op  lu sls  etmxm3nu4lptelnet s  2tm(  no4opxo i3tltfsDelumo u0arxrxr iodlpDeaneo;s  rurxr3ou4apen nci ( sDtrumpou4olxniictasfs rm(mo t4tlenxr3tadop e nes s0s2uoiopoy1lmtn icsl() rurxronu1teen o3iysfaDua( p;t) leomfctytoat luvo;t  rtmio nydapee nes s)srtmx pno4oex moctasfa2emn sn(4 leoio3tatoateli i (0 2uo(o iy4llte feiat) 2tmum ot1tle mietls sDelnvont) lxoxr tydoatrlivo;()srtm(opio4op  lnvsas)aDum(mpoo4texn f3tytfaDumn s;(0artrmr oytfp rlu s s0 rxo(m3nudlmt  fvta()arrrxr ot1olen fciytlsDem(ms;t4alxrmr oytfmDr nvsl( t2uo(r no4alenmfvi s)a2rmurpoo0apxo octltlsDra(vsnu4tleoxocio1fa  ln s s0trto(rpio4omt  fesa()srtmx onu0tltnmo3tas s2ra( s t0tetnxf3tadlaDrlu i t)t2tr(m oo1op   ivtas)a2ra(m ;t0altn ociltlmDum(vo;u0 lxnxo io1la   n s s  rtr(r oo4amee fcs s arrmumoou4tpt if3tadlmDrmnvp;(0tetoiocootoatrlnvolt)trxo(mpnu1ale lfvsls) Dtr(  no4oltnmo3tytfa ea(mp;u4artrif3iodoa r i s s trurxo3oo4lp  mivsas) Dtr( ooo0olxnmieiat mDumn sn(4alerxo3todfp elneo;t  exr(o no4ol elfetltfa2umx onu1apxoiieiltfa rmu p t) ltnmr3oa1fmt an ol(0 rurirpno1ol n ietls)artr(ro;o4oeeoioetlslaDemu p u4 lenmociodomte ivi (0 2toimpiodaleelfcia(  Dtmu p;u1aetnii3tyd a eanmo u)treomr tytfaDrlu ol()t2umiopnodll n ivsl( srtmumpoo1oeeomociydls2rlu ont)trtnxo totfaD  uei;s srxoir nudalenlfvta() 2rmxm ou1teeomoctaslaDemumsn(4altoioctytlaD au ilt srtmxm iu1amt  fctls)sDumumpoo0oetoifeiytfs ra( onu0tlxoirciadomDrauvo s) rtoxopiu4ll emicslsf Dtrum ot1oetoiocilslmDraumo;t4 lxnxfciadfpDraieo;t)t2tm(m3ny1altelfvtatfartru  nt1alto ictyslm2umumo t4aeenio ia1op eau s ()s2xr(r no1llen ivi sf rtrxrp;o4oexomoeiat sDumn s;(4arxrif oatfp e i s;()teumir iodlmtnlfcs t) ruax  oo0aetnifctytfsDran p;u
\ No newline at end of file
@@ -0,0 +1 @@
+uvo ( srtoxrpno4omt  ictl( s2tmumpno1aleo iciysfm2ul(vsnu4tltoxr3tytfaD  ieo;s) 2um(opoy4lptelnci ()a2tm( o;u4ope if3iadlmDulnvp (4 rxnmf3oytlpt auei;t) etrxm3ou1lmeemics ( sDrmurpot1tetn iciyt s elnmp;t4 ltrir3totfat  ues t0 2trxopoodal eliesa(f 2urumpoo1tltomf3iyd a2rluvsnt) lxrmf tatfpDranvslt0tetr(opoo1op  lneiat)a2rru pot0tee iictadlaDrlums t)trenxr ootla  ln i t0 2xoxrpnu1ole  ncs s sDrm(mo;o1aptn feiydlm2rlnvs;(4tlxrxrciydom rluvi s0t2xr(r3iodapeelnes sfaDum(r ;t4apx ioetytfm2rlumo;t4alxrxocia1omDrli o (0trtrim oo1omtemies (fa2umuroou0alenmfctatla2el( s (4trenmocoydop raneilt0 2to(o io4opt mfes sf 2tax oou4opxnif3iysls2ua(vs (0aexrmf3oadfp rln i t  rtoiopno1lpeelfetas)arua( ont1olx  fctyd s2emn p u) etoif todoaDe ueilt0 euriopiu1apt  ivil(  2ur(r ;u1tlt ifciytfaDum(vo;(0trxomf oodlp e ieols) eurio3no1lme mictls)aDua( o;u0aexo ieias sDrm(vpnu0aexnifciodom e ivo ()srxmxrpnodoltelfcia( s2rmxr no4aleo ieiltls umnmp;t)alenif3to1fm elnvo s0s2xm(o oodopt mnvsatfsDraum ;o4aexnmfcias m ul(vpn(0 lxrmr3tydfp elnvi;(  2to(r oodll n nci tfarta(m ;u4aeeomfctyt a2rmuvsnu4 rtrxr3ootlmD  i slt  rxm(rpiodap n fei t s2ua(rp;t1ale  i3iydfmDrmnmo;t) lxrir io1fmDr iei t  rxoimpoo4lm nmfct t artaxmo;t4oee  feias s2rl( pnt) renirciydfpt  n o s0trtoxr3iydamt mivsls srua(rp;o1alx iieiyt sDemu o (0tlxnxfcio1lpDrlivil(0s2xrxo iy4aleelncslsfsDtrxrpoo4tlx mictysfaDeluvo;u)trxoir3ia1fmtrlnes t seuoir iydlme  neias s2tmx  oo4tptoif3iasfa2uanmo;() etnmf iodomtraieo;t) 2trir iy1lmen feia(  rumx pno0alt moctas a el(mon(4 exnxf3oodlpteaivi;s  euoxopnu1om n fei ( arum(  ;u0tpe  feiatlm2el( o;()aexoxr oo1lptelieo t0setoxm3ou4opeelfcs tfarum( pou0oet if3iydlsDumums ()texrxo tadfpt  uvo (0seumxo nu1optemfeiasfaDtrxmoou1aeeoio3tld m umnvo;t0 lenmf3oytlmDeaneo s) 2uoxm3nu4opeemfcil( aDtrurpnt0tptnmoetlsfa2rmump;u4 ltnxo oatoaDrluvslt  2xoir nudapte ncsa( arurxrpnt1ole  feilsfs uanmo (0aetrmfciadoat  ueils) rumxmpiodlmt  icsl(  ruau pnu0aeeomoeiydlm uluvp;(0 exoif oa1lm rln slt  eurio3ny4opte iet s)sruau ono0aex ifetasfa emn o u)texrxfcia1oatrlieo;()t2tmxopiodape miesls  rtax  ;o1tpeoii3iltfm ea( o;t0trtoxr3ootlaDeaies;() rur(r oydll   nvta(fs2raumpno4apenmoeias a rmumont4 etrio oy1fm elnei;t)trtmxrpny1lptn ietl(  Dtaur ou4ope moeild sDrmu s u4 eenxr3oa1oa eau o ( seurxopoo4lptnlncia(fs2trxm ot0ope mi3tld sDea(vpn()teenif iatop e uvs;(0trumiopiydlpeeliesl(farraur nu1apeniieiadlm rlnmp;(4trenmr3ia1omt  ivil(0setrxrpoydapt mnvs ( sDuru p;t0tet  o3tatfaDrmnvs ()aexoxf iytla ran s;s0 rxrxr3ou4om emnctas)sDuru  ;t0apxnmfctysla elumsnu4aeeoxr3oo1op rln sl( srtoio3iudllenlfet s)artrx onu4opeoif3iytlaDrmumo t0aetrxf3ta1optelu s;s) rtriopio4ll  lietasfarua(mpoo0oexnmi3tlsfa em(vsnt0trxrxr todoatrln olt)tetoxr nydlpee fvt tfarurxrpoo4tlxo ietys a emuvp ()treoxf oydoa eaivol( tetmim3iu1op   fcsas)srrmum oo4olen ieild a2el( p ()arenif3tytla rlues (0tetr(mpoy1apte ics ()a2tmxmpot0apeoiicilt mDumn sn()teermr iy1laDraivo;s) euoir no1omtn fvtasf 2ur(mp;o1tpen ieils aDul(mp u)arxoif oo1opDrlu i t)trtr(m3no1omee fetl(  Durx oot1aexn i3tlsls rmums u)tlxnxo ootoatelnvilt)trxrxrpoy1lm nlneias)srumx p;o4ape io3tas mDel(vpnt4 rtrxrciadlpte ueilt)texoxr3iy4omenlictlt) Dra(rp;o0ope miciytls2rmumpnu)aexrir iytop  aivi t  2tr(opnydame lncsat)s2raxroou0oexnmieild aDel( o t4arerifciy1lmteai o (  2xoir oudam nlfctatf 2uaum ;t1tpe  ocilsfm2el( ont4arxnif3to1lp  au s t0t2uoxm iu4ll e ictl(faDtru  nu1alen fetyd s rm( p t)tlxnmo ty1lpteln s;() 2uo(rpiu1amtnmnciasfs2taum ;u1apxn oeils sDuan o;u)artoxf ootlpt auei t0seumxo3nu4om   nvsasfsDtmu  nt0olx mo3iatls um(vs t)altoxo3totlm e ueo;(  etrxopiodamtelies (fsrumxr ;u1oetnio3iyt s ea(vs (4 rtnxfcoytfpDrlieo;(0 rum(m iu1ap nmieta(  rtax  ;u0tptn octytfs rl(vp;t)tleoio tytopte ivo t t2xo(rpno1ap  mnvsas  rtmu pno0olt  ieiys a2raumo;t0artnio iytlm eaieo s0seum(rpou1omenmfvil(fa2rmur ;u4olt  o3iytlsDeau onu)trerifciadlmDr uvs;(0s2umirpiu4olt mnesls)aDrr( o;o0aeeoioeiadfsDrmnvo;u)aeerxo3oa1fmDr neolt)t2tmir iodal   fvia()s2tmxrpnu0oexnmo3iasfa2rm(vo;t) eenmo3oodfp e u o;s)texm(m3ny4lmte fct t sDrmxmo;o1openifeiltfs2rmn o t4 lxomf to1op r uvol(0trxrxmpou1lpt  nei sfsDua(mp;o4texn octld m ean p;u)tltrirctydomteaivils)srxoxopou4ap  mnesls)srrru poo4apxnio3iytla2em( s u)altnxf3oadlptrluvi t t2uoxm iu4omen ivs s)s2rm(roou0tetnif3iytlmDumums (0tleomrciytlmtelnes s trurxrpno4apte icsls arraum ot1tet  feias aDuluvsn(4 lxoxf3ia1oatrlues s) rum(mpnydopeelivsl(faDtr(m ;t4oetnmfctysfs emnms (0 rermo iadlatrluvs;s0trxrxr iy1apenmfei t)srtaurpnu1altnio3ilsfs rln snt4 etnxf iodoa rlieo;()t2umxmpnu1lpt lfvta()a2urxm ot1oex  fetlsla2uln s;t)aetrxr totlp r ues;t t2tmxm3iydomt lnciasfsDuaxr ;t0alx ioeiytfaDeanvp;u)tlermf3ta1fa ranei;t0trtrxopio4omeelfctls) rua( pnt4teto o3ildfs2rau p;u4 exnif3ia1lateau s;t0 eum(o3nydop   fvia()arua( pno0altnmfeiasfaDuauvp t) rxoir tadomt ln slt0 rxoir3ny4lm nmnviat srur(mooo1oleomfciydla ulums t0altrmf oodomDr u ils teumxopno4omee iviasfsrra(ro;u0opxnmoeiasla raumsnt) lerxr3oadoatr nes;t)setmiopnudome  fes s) 2uaxr nu0tltoii3ild m umnvp u4arenmfciydomDeaneo;t  2toxrpiu4lmenlfeiasf 2tmxrpnt1olxomi3tas mDuanmpn(4trtomfciydom rau olt)srumxr iodoltn iesat)aDrm(moot1tleomfetydla2um(mpnt)arxoxf iy1omtr ies;s0srtr(opiudole  fcsltfs2tmumoou0tex  f3iyt m2em( pnt)artoxocoadfpDr nesls srtrxmpou4lpe mfvt () Drr(rp;o0aleo iciatls2ua(msn(4aeeoxrctydomDr neo (0s2to(m nodapenmfet sfsDrru  oo1oexnifeiad s ra(mo;t0teenircia1opteaneo;t0trxmxr3nydopt lnvils  2rm(ro;t4tetn oeiat s2em(mp u0trtrmocootfmD an i;s  etm(mpiodlptelncs s)srta(mpou1opx  f3tys m rlumsnt) ltoifcto1oaDr nvslt)sexrim3iu4lp  mfvil( s2ta(mo;o4tleo f3tydlsDumn p;t4 lxnmr3oadfpDean s;t s2urxm3nu1olte ivilsfs2ra(mono1olt ioetys m2em(ms;u0 exomf oatomD lnvo;t s2tmxrpoodopte fvilt) Dua( pot4tlx miciadfm2rlump () reoxrcoytfp r u o;t  2um(m3ou4lp emfvi sfs2tmx o;o0oeeoifeildfm rl(vpnt)tetoir oatlmD  nvo t0setm(m3oy1om  lnvtls  Dra( onu1olxnmf3iydlsDrlnmp;t4 eermo oo1lptr uvo;t)teumxrpiudlm e fviatfa2rr(mpnu4aleo fciasla uaumo ()tlxnmrctytoaDe neilt0texr(opnu1amenlfesatfsrrmur ot1teto oeiyd aDrmumsnt0altnxrcoadlmD  nvo (0 2uoxm ny4amt  iesasfa2tru o;u1alt moetlsls umumo (0aetnir ootopt lueils0sexmiopoo4ole lnvsasfaDraxmonu0aleo fctytlaDem(vs t4 rxrxrcoydla elueolt)srxrxrpiudomt mfeiltf Dtmum ;u1tlen iciytfa eluvs t) lerxoctadfmt au s;t srxm(opiodal  mfvt ()aDrax  nu0tpxnmf3tltlmDraump;t0arxomr oy1oaD aivo;() rxoirpoodole  fvta(  rumx ooo1tlto feiysfa2rl(vs () exrif iydop   uvslt trtmir3oodlme lfvilsfsrraxmo;t4tpeomietysfs2umumpnu0aetoio3ia1opDr neo;t)sexrxo3iudol nlnes sfarurxronu1alen iciatfmDelnvpnt0 lxnio tytomtrln o;s)s2um(r iy1lmtn ivi ( a2tm(mont4tet  feils mDrl(vo;t0 renxf3oa1fpt  n i t0truo(opoy4lm   fctlt a2tmumpnu4tex  fciad a2uanvs u)altrif3tydlmteai s ()t2trxm io1aptn neiasf 2ua( p;u4opx  iciyt a emnmp;(0trermrcoadom  an s;s setrxmpiy4lpe lnvt s)srua(mp;t1ole  f3iad m2rmu o;u4aetomr oy1opD lnei s)t2uo(o3ou4lltemnci (fa2uax oou1aet io3tytfaDrm(mpnu4 lxomf ootfaDran i () rumxm3ny1altn ivi sf 2rmumoou1aeenio3tatfs rluvpnu4 eenmrciydlp rlivo;(  2ur(opio4amtnlfvt ()sDuru ont0tpt mo3tytfa2ranvpnt) leoir3tatfaDr nei;t0t2xmxo nydapt  neta(  Drm(mo;t4apeomo3iad m ranmo;u)teenir io1opDeluei () 2tr(mpoy4op elfei ( s2rrurp;o4tetnmoeiyd aDem(mo;(4 leniociotlaDeauvs;t)tetmio nydal   ict t)aDra(roou0tpt  f3tydls ua(vo;(0trtnmo iotlpteauvs s teto(m oodlp emfci t)srtmxmo;u0tlx mfeilsfa umuvpnt4aetoxr3oodlp e u o (  rxo(rpiy1op nlfei t  rtrxmo;u4oetn fciaslaDua( o u4tleomrciodfpt auei;( srxoir3oydllte iet tfa2tmxrp;t4oexniieiytls2uaump;u) etomo3oatfmt liei s) 2trxmpnydll emfvsat sDuax poo1oexo feias aDua(monu0 etoxr3oy1lmDr uvslt t2xm(r3no1lpe livs s aDraum nt0tlxomoeiydfm emnvo u4trxrxr io1fmDrauvi t  eto(opny4ol nlnvtl()sDtmur no0tlenmf3tatfs rl( onu0artnmr to1fmt anvs;s0 exoiopiy4ll nmfvsls sDuaum ;t1openiiciat s2rm(vont0tlxnmf todop rlieil(  ruo(o oudolt  nesls  rrrxro;o0oetn fciytlm2ra(vp;() ltrifcoo1fpte neo;(0trtmxmpiodap   ivtas a2urxroot1tlx ifeiadls ul( o;t4teeoir3iytfmtrauei;(  2uo(o oo4optn icsltf rra(  no1alx  ietytfs2ranvp;u)trtoio iytoaD li s s truoimpnydolt  nct (  2trxr oo4optnifctls aDuaumsnu0tlerxo iy1fat  ivsl(0trxmirpou4ap emfviatfs2tm(mpno4opx ifciaslmDuaumo;t0tlxoioctatop eli s;()trxmxm3iy1openmfesa( artaxmooo4oet  oetat a ul(mo;u4 etnxo3tatla   n ils)trxm(mpio4aptnlnctasfs2rmxm nu1optnmociltla uan o;t0 renxf oy1fmDrlieils trurim3nu1alt mnvslt)sDrr(mpot4tlt mocilsla emn o;u4aetomfcoa1oa r neo s)s2uoxr3iu1lme  neilt)s2ra(r ;u4opx  iciyt mDelu s;t)arxrxrciotfmDrluvs ( srtriopoydaptemivil(faDrmumo;o0opx ioeias s emump ()texoxf ta1la e ues s) eumxrpoo1lm nlnvtls)s2umxm ;t0aeto o3tltla um(vonu0aetomrctatfmDe nei;s) rtoxm oodllt livil(f 2urxrpnt1apeniieiydls2rl( o;u0 lxomrctydlmteai olt)tetoxmpoodamt  ici s) Dur(rpoo4alxnifciys a2rlu o;(0 etoio tadfaDr ivs s t2to(m ou1omtnmnciltf Dtm(m ;t4tlenmi3ils a ea(vs;u4 ltomrcoa1lmtraivo;t)t2ur(o oydalen neil(fsrumx o;t0tpxnmiciyt aDelumo t0aetrmf3ty1opteluvs;( s2xo(rpno4omtemncs t arurxr nt1tlxn iciydfm rl(ms;u4 ltomf io1fpte nvol( srxrio io1lmteliet t) rtrurpou1tpe miciytlsDemn s;u)trtrmf3oy1faD  ueo;s0 etm(o nu4ap n ncilt)srumxr nt0olxnio3iyslm2umn pn(0arerxo tadlp rlu s s0s2xmim ou4lme  nesa() 2um( ooo4opeo fciys a2ea(vo u)texnmf oa1fp r uvo;s trtoirpny1ope lncsas) Drm( o;o1alt ifctlslaDelnvont0aexrif oadlmte ues s) exoim oy1apen nvt s arur(m ;u1alxn ieiydlmDul( s;u) leomf3totopt au o () exmxr nu4lm emfvtatf 2rm(ront1ope mfeiyd s2elump (0 etoxr oa1fpDeai s t)seuoxopio4ameemiesa(f 2rm( ont1oexo fcildla2em(vo u0 rxrmo3tytlmDe nvs s teurxo io4lmt lfcias) rumuroot0optnmi3iydla em(vs (4alxoifctatoat luvi ()texmxopiodaleemici (  Dtrurp;t0tex  ociatfm2rauvs;t0alxrio3ta1lpDeaies;t) 2urxr3oodape lnctls s2taxmooo1tptomfeildfm2eanmo;t0alxomo3oy1fpDr i s s)s2xmiopio4altemfeilsf Dta(  ;t1optomi3iyt a2rm(vonu0alxrmf3iotfa ranvil( srtoxopiy1apt licsas) 2rm( p;o4tpeoiicildlm2eau snt0artoxfciadomtrli o t0s2umimpio1lm e fcs s)sDra(rpot1oex iieild aDeln o;() lenmr oatopD anei (0trtmio nu4optn ics sfartax ooo4ale moetyd m ean pn() lxoxf3tytlpD  ueil(0sruoim3nodapee icsasfa2ur(r ;u1teenmf3tytla rlumont0tlenmocia1lmte ueo t) rtr(m iy4lmt lnetlt  2uaxmo;o0oexnmi3iasfm2um( pnt0tlxoir3iadlmtrlnvo t0setrirpoo1optemfct (  2rr(mo;u4tet micilsla2elnms (4 exnir3oo1op e ueilt  eur(mpio1amenmncil()sDrm( p;u4ole mietadlm2umuvs;t)trtoir3oatoa elu s;s0 exmxr3ny4am elnvils) rraxmoot4oetomieiys m elnms;()artrir iytopDe i i;s trxmxo iu1ll e fcs () Draurpou4aptn o3iyd sDul(ms;u0arxomo tytoaDeaieols) 2xrim3no4al emiet ()a2rmurooo0tpenmfciyt m2emnvonu4texnxociydlptelu o;(0setr(m nu1amtnlnvsl(fs2trx oou4tlxomoetldlaDumuvo;t)trerircoydlm  ln olt)srurxmpny1omen fvt s)s2um(ro;o0alenio3tydfaDel(vs ()trxoir3tytomt  uvilt s2xrimpiy4ameelfcs s)sDuru  ot4tetomo3iyt sDua(mo (4arenxo3ty1fp   i il(0t2xr(m oo1altemnvs (  rur( o;o0aptoiociltfm rlnvp () rxrmf3ootfaD anvi t setmirpiudapen nvtl()artru  ;u0aetoioetldls umnvp u4 eenmrciotlate u sls t2tm(mpiodom  licilsfartmum oo4tpxnifctadfm um(ms;t4artoirctodopDrau i s)seto(r oo4aptnmnei s) rtr( p;u0apxnif3tldls um( p;(0trxnmoctydlatraivs s trur(o3iu1op  lnvi ()a2umumono1oet mfciasfa2emnms t4trtomr ta1lpD au o;( t2xo(o oo1am nlnvsas)s2trurpnu0olt miciasls2rln s;t0 lxnir oodomt auei;t0sexoim3nydlm elfctls)aruru pnt1tetniieiltfaDrlu s ()trxnir3to1oa   nei;t0srxrim nu4omeelfctatf rtaxrp;u0alt  iciatlm uaump u0aexrxf3iatoatrlueol(0 rumio nu1lle mivilsf rtm(roou4apx iieiaslm um(vp u0 eeoxrcto1fpDelneils srtoimpnudlltn fcslt)arrmurooo1oltoifciasla2eaums t0 rxrifciatopDrlues ( srur(o3iu4llt mfvtl( s2raxmo;o4optomoeild s2em(vo u) eenif oatlaD aues (0t2xoir iy4am e ivs tfa2tr(ro;t1apt mietld s2rm(mp;t0 lxoir ta1laDeli o;s) 2xo(opoo4lpe  fvias sDra(m nu4tetn octydlaDelnvp;(0aeenxf tatfmtr n o;(0sexr(r3iydaltnlfvt ()s2trxr nt1olxnifctydfm ua( o;t0tltomr tadfmDrlnei t0trtmxr3oo1oltelfvtas) 2uaxront0texomoetldlm2ua(vsnt0aeermr3oo1la rau il()teum(opoy1omt mivtasfsrraumooo1apeo o3iltlsDuanms u4arxrxo totopD au o ()tetm(r3io1ole lfcia(faruaxmpou1tlxniietys s2el(vo;u4artnmrcoodfmDr u i ()teur(r3ny4lleemfvsat  2urxmpno1apenifeiat s umu on(4texrir oodfate uvsls0setoio ou4op  lnes () 2um(rpot4tex  oeiatfs2em( o t4 eenmf oatfp  lu s;t0 etm(r oo1ll nlicils)aDra(rpot4apx  o3tlsfmDum( on()tlxoxf ia1latelueols  rtmxm oy1omeelnvi sf 2rr(r oo1oltomfeiatlm ea( s ()trxrxf oo1oa  au o (0sexrxm3iu4omt  nct s s2tmumpnt0tpxn f3tls a em(vo u4teermfcoa1lpDrauvi s setrir3oo4lm  liesas a2tmurono4oet  ocilsfs2rlums;u4texnir3tatfmD  ieol() 2trio3iu4lp   net tf 2ra( p;t0tet  i3tadlaDuanmo u)tlxoir3oadfptranvs;() 2trirpoy1ole lnvil()s2raurpnu4tpeo i3tys sDumu o (4 rtnif3oodom eai o;s)trtr(opiu4ale  nvia(fs2rmum ;u0tetn ieiltlaDrmn p u0trtrxo oadfpt  ueo s0texmxopoudll nmnvslsfartm(rpou0oet  fciadfsDelu o;(4trtoif3io1lmDeluvi;( t2uo(mpiy4ol  lieiasfsDrr(m no0texnio3tasla2ea( p u0altoxo3oydfptr uvi;t  etmxmpiu4om nlieias sDrau poo0oeto oetydls2emuvp;t0tlenir3ootfmD livil(0 rum(m ny1ope mfcsl() 2rm(  ou4tee ioctatfa2rm(vpnt0tlxrxo oa1faDeanvs t) ruoxo3iydop e ivsa() rtau p;o1apt mo3ilt s um( s t)teeoxo oatomtr iei;( seto(o nudllenmnvsas  2trurpot0teto oeiltlsDua( p () eeoxrcoodlp  auvolt  2triopoy1ol  micia() 2ta(mont1apeoifciaslaDra(monu)arenmf3oy1fp elivi;t) 2xm(r3iudlpe mict ()a2rmu  nu4apxomoctldfa2eanvsnu)tltnifcoodoa raneslt)trtmirpoy1lleelfei ( sDtrxmo;t1altomfeiasfm2uanvo;t4tetrmo3ia1om rai sls)sexrxmpno1ap nlfesa(f 2rrumo;u0oltn fcildfa rm( o u)tlxrmr oa1oate n o (0 eur(mpnu1lltnlncsas)sDur(mpou0aex mi3iltls2eluvo;(0 leoircoo1oa e u slt0trtoir3nu4llt lfvia(f 2ur(ro;u0texnmi3iyt m rmn p (4altnmf oy1fptran o;( s2xmiopny4ameelnct t)s2rrur nu4olx  ietatfs ulu sn(0altrxfcoydlptrau o ()texoxo3oo1lle lnetas)aDtm(mpoo4aex moeiadlsDeauvp t0 rtnio3iy1lmtr ivi;s0 rxr(mpnu1ame  ncs s srua(mpnu4open fctasls2emnmon(0trtnirciodfmte ueils trurio3iudolte icsls sDrrum nu1teeo o3iltfmDulnvs t)aeenmr oo1omtraieo t) 2xrir3ny4lltemiet s) 2ra( pnt1ale mi3tlt a2ua(mo u0alxrio oodfmDr u i;s0t2uo(r3oo4lptemneia( sDuru o;o0oexo f3ils mDelu p t4arermr3iytoat auvo s)setm(r3oo1al nliet (fsDumu  nu1tlenmfeiyd a emuvont0trxrir oy1fmteanvi;()texo(opiu1amtn ictls  Dta(moou1tptn i3tasfs ua(monu4tlxnxr iatomDrln o s tetmir3iu4lpt  feia(  2tau ooo1aetomiciydfaDuln pnu)texnmociatlm raivo s0t2xrxr3nydlltnlfcils) rrmumoot4aleomociyslaDrmums;t0 rxrxf ty1opDrau o ()trxrio io1ole miesas)sDtrxmooo1tpx ii3iyt aDul(vs;(0tetnio iodfaDr iei t)srum(m3iudomeemncslsf Duaum ;t1aet mociasfsDranmo;t0trenxfcta1oaDe uvo t  2toiopou4ol n ivilt)artax  nt4olxo o3ias s ulumo u0 rxrmo3ootoaDrai ol(0t2uo(mpnydoptnmfvias srumx pot1tpto ociysla2elumo;u0trxnxr iatoptelu o ()texo(r3oodlmenlnvsatf 2um( p;o1texn f3iltfmDem( p t4 reoxo iatfp r iei;t srxr(opoudale livsa( aDtau p;u1aeen o3tytls uln pn(0 rtnif todfmtrlnvil( t2xriopno4alee fviasfsrua(r ;t1apt moeiadlm2ul(vs;t4tleoxr oytopD lneilt0 2toim iu4al n fcilt)arraur no0aet mf3tlslsDrm(monu)arerxf iy1lpteai olt t2ur(r no1am  lfeiat)sDra(m ot4tptnifeils a eln pnu0aetnio3iodlaDrlies;t0 etrir nydllte fvilt)s2um( oou4tpxn iciyt a ranms u4aetomocoatlaDe nei;t)sruo(m oo4alenmfvsls s2uaum no1tlxomoeiaslmDuau s;()aetoif3oatfat  uvi;()teumir3no1opeemnci (  Dtru  ot0tlen icias a rmumsnt)alerxf3iytoatranesls)texm(r3iudll nmnet sfaDrmump;t4apenmocild s2ulnmpnt4artnxo tydopD  u s t)s2tmim3oydal nlnvils  Dtrur no0olen o3iat a2eaumpnu4trenxr tatomt aivils0 exmxmpoy1opee fcs ()arrrxm ;t4texn fciatfm2rmnvsnt)trxnio ta1lpDeanvil( tetr(rpoy4openlncil(  2trumono4oetoii3tls s eanvs (4tlxomfctytlpDrau i;s0s2xo(m iydlm nmict s  Dur(rpoo4tpe  ictytfa2em(vs;u4trtomo3totfaDe u o t  rxmim3oo4optn ieiatf 2rr( o;u1tleomfciytfa eauvs;()trerxr io1fpt luesl(0srxrir3ny4ole livs s)sDum(root0tltnii3iaslsDeauvp;t0teenif totfp  aiei;(  ruo(rpnodopee ncsa(  rrrxr nu4tpt  f3tlsls rmuvpnu4arxrir3iytlmDe nvsls0s2xr(rpny4ll elivia( srrrxronu4oet  feilsfa2ean snu)trtomociatoa  an o;t0s2umio nydlp e ietasfartm(r ;u1tetomi3tytlaDum(vp;t4teenxo oa1lmtrli s s tetrxr3ou4lle lfetatfsrrmxmpnu4apxomieiydls ua(msn(4arenmr ia1omDeauesls0setriopiu4lm  mfcs s  rtmxr nt0texomfetasfa2rmnmp;t4 rxnif3iytopte ueols) euoxr iy4ap nlivtl(  Dtaxrpou1alxoio3iytfs2emnvp t4tlxnmfcoydlm ean slt0tetrir3iu4optnlfcilt sDrru o;t0tle mfciys m2ea( o () rxnir tytfat lnvs s0trtrirpoodlm emfct (f Dumx ont4oetnii3iadls2ra( pnt4arxoir3iytlpDe ies s srurirpnudom emncs sfsDrmur nt1aetn fciasfm2ea(vp () reriocoo1omteai s ()setriopno4omtemfesatfsrraurpnu4teen ociat a2ulu s;(0 lxoif3iodom ean il() 2xrirpiodoleemfcs sfsrrax oou4tltniieiyd s2eau p;()tleoiocoy1la  auvolt  rxoim io1lptemfctls  rua( pou4ope ii3ild m2ra( pnu0 rtoxr ootoat ai s;t0 rxoxo3nu1amtn ivil(f Duaxrpou4alx  f3iatla2emumonu0altnmo3oadopt au i;t)setoirpiy4apt lfciatfsDtrumo;u4tex  f3tadfmDul(vp u)areoxr3ta1laDe u s;( setoim io4optnlnes (fartr( oou0opxn fcildfa eaums;t) exrmoctatopDe i sls s2um(r no1amenmici ()arrm( poo1oltnio3tas m el(vs;u0trxrio3tytlpDr uvil() 2xoio3iu1alte ncsl(  Dtr(m oo0ape mictldfsDea(mo u0 renir3oy1oa e nvi ()truoir3nydop elivils  2urxrpno0alxoio3iadfs2emnmont0aleomfcoo1la e nvi ( trxmxrpnu4amt mietat arurur ou0tex  ieiadlm2emuvp;u) rtoxocio1faD ai i t  2toio3iy4apeemnvsl() Durx o;t0aet mfciadfs rl(vo t4arxrifcto1lm elnei;()t2tm(m iy1amtnmnei s)srrmu o;u1oltn ieilt s eanvon()aexnircty1lp  lneo t)seuo(o nu4aptnmivtat aDra(rp;t0aex  oeiltfm em( p;u4aeenif oadfpte n s;(0t2umirpoodolt lfvsas s2urur oo4tpeomociadfaDrm(mpnu0treoio3ootfat lnes;( trxr(mpiu4ape liei ( s2taumont1aexomiciysfaDem( s u0tetrmo oo1oaDrli o s s2tr(m nudamen fesas s2ur(mp;t0oetnio3ils s2eanvs (0tlxomfciytfm  anvsl(  exo(rpoodlp e ncil(faDtax oou1tlx ifetldla2ul(mp u)teenmrciytlpte ivi s  2to(rpiodomt mnvta( arua( oou0apx moctyslm2em(vo u4 etrif iydlp  aueo;(0trxr(m3oo1lmtn ncils s2urxmpno1tet  feiytla2ulnmo;()trxrir to1lp e u o;s  rxm(r iodol nmietas) rraxmpnt0oexo ietad a rlnmsnu4artomrcty1omDrai s;(0t2ur(rpiudalte ivil( a2tmxm no0aet  fctytfaDuluvsn(4arenir iodomteluvo;s)teurxr3ny4ol  livils)aruru p;o4teto ietytfs ean pnu0alxoxr oydfmD  nes;t0 exrxm3nydapenlnei (fa2trx p;u4texo ieilt m umuvs;u0 rxrmr io1oatrlu i;s)s2toxm ny1amtn nvsltf Dum(  ;u4teenioeilt m2uanms t0trxrxf iodfmDeanvi;() etoxo nodlm nmivtas a2rmxmp;u0apto f3tltlm2ranmo u0tlxrio3tatfpte iei;s)srum(r ny1olt mfesat)sDtmu pou0tpto i3tas sDua(vo;u0aeerifciytoaDe iei s trumxo nu4lp nmfcias) 2um(mpot4tleomfciyt m uan s t4tlxnxrciytlpt  ieo;t0 2xmxr3io1ol  mivi s arua( pnu4tetomoeiydfa eln s t)aetnif tadfptr nvs;s  euoimpnu1ale lfvt ()a2raxrp;t0alxnii3tlt mDel(mpn(4tltnxf3todomDe u o s0texrxr oydlmtemieta( s2rrxrooo1optomi3tyt m2ua( on()aetrmr ty1lmDelivs;() exr(r nudalen nvtas) 2trum no1aexnifetysla2eaums t)aexrxrciadlp elnvs;(0texmirpnu1am e icilt  Dra(mpou4oeen oeilsfs2raumpnu0 eeoiocootlat au i t texrir ny4omtelfetat a2tmum nu1alx moetlsfm ranmo;u)aeerxo tydfa rlieo;( trumxm3ny4aptn nesa( aDum(rooo4apt ifeiatfs2ul(ms;(4alxomr ty1fpteau ils0sexmirpny1omtn fvsl()sDua(r ;o4opeomoctlsfs ean pnt)aeerir tytfaDe n slt sexo(r3oy4olee fvtl()a2tmur ou0tpxoii3tytfm2elump;t)tlxrir3tatfaDe u i;(  etr(rpiudal  lfvias) Dur(r no0tlx iictld m uln onu)alxoir3tatfptr neilt teum(o ou1ll nlnvslt  2trxrpnt4apxn fctytlaDeanms;() rxnxo3ia1lat ln o (0setmxo3no4olee ieiat  2taxrpnu4opeoii3iytfs emump u4trxrmf tytlpteanvil(0tetoimpnudlle mici tfa2rmumo;o0aleomieias mDea( p (4 etrmfcta1faD  iesl(0 rtoxm iy1lmenlivi s) rta(roou0optoiociltfaDeau p u0 etnircoytom elies;t0 etoxr3ou4ale mivsas)sruaum nt1opxn f3iysla umn onu0teeomf3ia1fmtrluvo;t0 rxoxr3nu4alee ivslsfaDuaum ;o0olxo ociadlsDulu o (0texnxr3ty1fm raues;s0 rumiopnu4lm eliet tf rrmumono4optniietyd sDrmuvs (4 ltnio tatfm e ueilt)s2tr(r ou4openlfctls)aDurxmpnu0tlxniociatfa2rmump t4 lxrxo3oatoptr n s t)t2tmirpny4ol emietlt aDtr( p;u0olxoiictldfa2elnms () rxrxfcoa1fmt auvo;( t2tr(o3nu1lptnlfvi t)sDtrxmpot1aetnmf3ilsls rau sn(4 exoxo iodoat au i;t  2xriopno4apte nvsas)a2ur(r ot4tee mictltlm2rlu s;(0texrxf tadlatraies s  2um(mpiudomen nei s) Duaur ou4apxo iciltls eluvs (0 rtnmociotoa raueils0s2xoxo3ny1lpe lietlsf Drau  ot1apxnmfciltfm2rl(vp ()artomfcoa1optelivo s)texm(m ny4opee nvtlsf 2urur ou0oeeo ieiad s el(mp t)aetnio3todlmtean s;(0t2tr(mpio4lmtnlfvils) 2rmur ou1tpto i3iyslmDemumsn(0arxnirctotomDr u ol(0trxmxo3iy1ol nmivi (f rrr(root0aee mfctyd s emnvs;t)artrxo3oadfpDr ueslt0trtmir io1ol  mfvs (  Dtaxrpnt0texomiciatlaDeluvpnu0 lxrxf3totoa rlnvi;s)tetr(o3nydlltnlncs (  rtrxro;t0oex ioctldlsDrmuvpnt0alermr3iadfpDr n o;s t2xoxmpnydam emfeils)arra( poo1tpxoif3iadlmDumn sn(4 etnmo3iytlmtr i o;t) etmxrpiu1alt mivs tfaDrr(r nu0aeeo iciysfa el( p u)aeerio tytfpDr uvs;t s2trim no4lpe lneil( s2ua(roou1alxn feilsfs2umnvpnu0arenmocto1lmDe nvo (0texm(rpiu4amtnlfvtas  2rm(mpoo4olxoifcils m2ul(ms (0texomrciytom rln i (  2tr(m3nu1alenlfes s)srrm(mp;t0opt  i3tldfs eanmsn()artoxo3oadoa eaivi;t) 2uo(o iudoptemfvtl()srtru ono1aex  ieiaslm2emnmo t4areomf3oatom elueo s0 rumim iudll nmfvil()arrm(r oo0olxnii3iysfs eln p;u0trxoxrcoa1lmtrlieo s0 etrxmpny4lpenmfeta( s2tmum ou1aex mictatla ulnms;u)texnif iadfpDeli s s0 rxm(o3io1lp elnvt s)s2rmum no0tltniiciasfa rln p (4tetrmfcoy1lpte i sl(0trumxm3ou4apeemfct t srumxr no0tex  o3tytlm uluvpnu0texnxr3iadfm r ivo t0 eto(mpoydamtemfvsls) rrr( oot0aeen iciatfa2rm( on(0tlxnxocta1lpDr ies;(0tetrimpio4ll elfctl( s2trurpoo4olxoioeiltlsDulnvo t)tleomfciatlatelu slt0 2xoir ny1lpte fcsl() rtr(r ;o4ole mociatfa2rlumsn()tlerxo iatla  au olt)sexm(m3ou1amenlivslt)aDuru oou4aetnmicildla eln pnu) lerif ty1fmteai olt t2tr(o3oy1amt livtls artr(r ou1olx iicilsfs uanmo (0 exnxocoytfm   u slt0teum(mpny1op nmfvs (faDumxrp;o1tlenioeiysfmDulnvp;u4trerxf3iatopD au i t)s2trio3iydopeemnctl(farum(rp;u1oee iictyt aDrlnmp (0tetomo oadopDean i s)t2xm(o ou4altelnvt tfaDuaxrpnt4tpeo o3ilslm2uau o t0arxoxrctodlpDe nvsls)trurir iudolenlnctat sDtr(moot1apxo oetadlaDelums;(0 leomr todfm eluvol( srxmxr iy4am nlieia( a2rmum nt4tptoifetldla2eanmp t)aetoxfciydlatrauvols seumxr3oodole mivsas) 2rmurpnu1alenmoetatlmDrl(vp;u0 eeoiocoy1lpDrli o;s)trur(o3ny4opeemicilt a2ta(  no4aee io3iatfs um(vpnu0altnmfcta1fm r iesl(0 2ur(o3no1lpe mfviasf Drr(r ;o1alx ifctlsfm ul(vp u0aexrmr3todfmt anvi;t0t2xrxo3iodlltnmnet t a2ua(r ;o0optomoetad mDem( o t4 ltnmr iy1lmD aneols) rxr(m3no4alenmfesa() Drr(r ot4oex mictad a ranms t4 lenio to1fpt lnes s0seumio3iydlmt livtl()sDraxmo;o1aee ifctlt m ua( s;u4aetoio3iytfaDraivi;t srxrir oy1amtemnct s aDraxm nu4opxn o3iadlm eaumsn(0 leomr3totla eau ol(0 rumxopiudlltn ietas)sDurxmono0aptomi3ilt m2ua( pnt4alxrxfciydfmteln i;()t2xm(m iu1oleelnct tf rtm(r oo4tpx  i3iltfaDrlnvo;u) lenmf iy1omtraivslt0 2xmio3nu1lle lnci s  rua(rp;t4tlen ietysfm ul(vp u) rxoir3oy1lptrlu s;s)s2xmxr3oydlpeemiviltfs2rau  ;u0olxn fctytfs emump;u)alxomrcta1fm e n ils0s2xr(m3ou1al n nvil() 2raum ou0aexo feiyd a em(vonu)tlxnxrcoy1lptraueils)trtmim oo4am n fct ()aDurxront0apto ocils a elnvs;t4 rxnxr3iydfpt lieo;t) 2tm(m nu1optelieiat) rtmx  oo4apxoifcils a2ua( s t4 lxoxrciodoateln slt t2umio iudlme  nvilsf rua(ro;o4tpx mo3iasla2rlu s u4trtoxf3to1laD  u slt0seto(r iydlptelnvt s  Dumx  no0alto i3iat s rau p;t4tlenmf3iatopt lies;(0s2uo(opiodlpeelnes s) rtaur ot0aexomietlsfmDul( pnt4aeerxr ta1fpDr uvs;t0t2trir3iy1olenlfcia(fsrrau o;u1oetnioeiydfaDem( pnu4trtrmrctadlpteaues;t)seur(mpoy1optn nvsat  2umx pnu1ale moeiltfsDrmumsnu) reomo3iodopDe i o;(  2tm(r no4ap  lietls) Dra(ront4texoifciatlm2el(vs (4teeomociytlate ueo s)sexoiopnodap e nvia(f 2uaurpoo0alxn feias a el(vpn(0 lxnxo tytfpDraieo;t0 etm(opoy1lmenmfvilt) Dta(rpot0opxnmi3ilt a ua(msn(0texoxfcia1oa  lies (0 rur(m nodop  mfcsasfaDuaxr no4oltoif3iys m uanvo;t4aexoxocoo1optrau il( setr(o iy4lm nmfvi (fsrra(ront4tex if3iatlm rmumont4artoxo3to1lpDe n o;t0 rtrxo nudape mfvs tfs2tmx p;o1tet mi3tlslm2rm( pn(0trxoif ty1op   ivsls)setmio3iu1lptn fct sf 2urxroot4oetniicilsfaDem(mo;u4arerxf tydlate ivs;s0 etmim3no1ol  lfvi (f rra(m no0tpxnifetyd s2em( s u4arermf oadoaDr u ols0setoiopny4am e fetat)arua(moou4tlxoifeiadfs2rauvpn(4aetnxr io1faDelueo (  eumirpiu4lpe mfvtlt sDtr( onu4tlto feiys sDemuvo;t0alermr3ootlpteauvi s) etoxr oudape  ietlt sDtmuro;u4tlx  ocildfaDrlu pnu0treoxf tydfpDeau i t)tetr(mpiy4alte ncia(faDtmumont1oee mi3iasfs uan o;t4alerif3ia1fpD an s s s2uoxrpnu1alt  fcsatfsDtaxrp;t4oetomfciaslmDeln on()trerxo iydoatrlnvi t  exrir iudop emfvi tf 2uaxront4tpeomo3iasfa ulnmsn(0aeerio tydlmDeln s;s0trto(mpio1optemfvil(faDtmur nt1alt ifciadls2rmnms (0 rxnmoctatlmDelu i t0t2urir3oodole lfci ()s2rrum nu4opx  o3iltlm raumsnt) lermr3ia1latrlieo;(0 rxr(r iydam e ncslt  Duaxm no0teenmi3tldla2uaumpnt4 exomfcta1opDr n sl( s2tmio3iu4ame  fcil() rururo;u4aptoio3tyt m2um(mp;t0tlerifcty1omD aueo t)s2tm(opiudomenlicils  rrmx pnt0oleniocildls2ulump;(4 lerxo oydoaD  nvs;s  2tr(r nu4ape licta() 2ra(ronu1aptniieiydfmDeanvpnt) ltoxf3oo1fa   n o s  2uoxm iydap e fvtl(fs2raxrpnt0tex ifcilt a2umumpnu) exrxo iodla r ues t)seur(r oydlp emfcsa( a2ra(rono0olx io3iadfa2umn snt0 leoir iatla rln s ( srxm(rpio4lm nmiciat arumum nu4tee  oeiyd s2rmu p u0tltoxf tydlm  lnvi;()trumxopny1lme lnvtls) rrrxrpoo0teenmociydla2ua(ms u4 renmociytlpteauvo (0srumir3iudoltnmiesat  Dtru o;t4aptniictlsfm emuvo;(0 rerio oytop  lues;t s2uoxo ny4amenlnvtlt) ruru oou0olxo icilsla2rlnvpn(0arxrircoydlaDeaieolt0trtr(m3ou4oltn ieia(f rrrurp;t4optnmociaslaDua(vs;(0arxrioctotfat anvilt0sexoim no4ll elnetas)sDrmx  ;o1oexnif3tytlm emn o;u4alermociy1lpteluvi s0 etoimpnudam  lfvsat sDtau pot1ape mieilslm ra(vs (4 rtrmr3oydom e uvsl(  rumxo io4altelivtltfs2rru p;t0apto o3ilsls eaumont0tltrmo3oodla  ln slt)trxmxmpoy4olee fvt (  Durxm nu1opxo feild a uau pnu4 lerxo3iadlmt  i s t)s2tr(opoy4ape  nvtasfaDtrxmpno4opxnioeilsfs rmnvpn(0 lermrcoydfp eliei;t0 etmio3oy4am elnci t)a2rax pnu1alx ii3iltfs em( snt0 leoif iadomtr i s;( s2trxopny4ope mncsl(fsrtaxr ;u1apeo oeildfsDulnmp;u)alxnxf3oadlmDelivi t0 rtm(r3nu1llenlnes t)arrmurp;o1oexo fetldlaDrmu o;(4altrmfciadfptrlivi;s)t2toxopio4lm e ies s sDtaurpoo1tlen fctasfmDrlu s;(0 etniocoodopDeli s s0seum(m3ou1apte ietl(f 2tau oot1tleomiciysla em( s t4 lxoir ootoaDrlu ilt sexo(rpou1ole  nctas)sDrmuro;t1oet  fctld a2ul(mon(4tetomrcio1fptr uei;s truoirpiodamenlnesl()srtrxr oo4tee mi3ias m rmnvsn(4 lxnmrcoa1oateai ils0s2xo(o3nudal  lnvi (f 2rmxmpou4aptoiociatlmDel( s u4 lenxf3oatfpDrlu s;s0t2xrxr ou4omtnliciatfa2uaurpno0olxniiciad a2em( s;(4alenxr3iotom  aueo t)tetrxmpiydolen nviat aDraurpot4teeoiietltlaDelnmp;t)artomo3iatlm r n ilt) 2uo(r3oudop emfetat)aDua(mo;o4aee mocilslsDrm( sn()trenio oy1lptrlies;( srxoimpou1al e ivtl(f 2rmur nt0alt mictydlsDrluvonu) ltrmo io1omte nvi;s0texm(rpiy1apen ivtat sDum( p;u1tleomictys a2eanvs;t4trxomo tatoptr uvs;()srxmxr3oy4amt liet t)sDtm(m ;o1altn o3iydlsDemnvp;u0 ltnxf3tadfmt  iesl(0 2xoxo3oodol nlnvsat)a2trur ot1altnmf3iys s2emu s (0artrxr oatoa r uvi (0sruoir3iu1ll  mnctas a2tmu ono1apxnio3iyd a2ulu p t0trenxo3ty1lm rai s;t) 2umim3oodlltnmfesl( srraxrooo0oeto feiydla2ulumpn() eenmr3oydlaD liesls0tetoio3oo1alenmncilt)srtrur ;u4aex  fctad m emnmo t0 lxoioctodlm   nes t0trtr(o3nu4omtnmiciat s2trxmpoo0tltniicilt s2el(vp;t0 lxnif3tydlptr nvolt sexmio3ou4altnlncias srtmxm nu1opxo f3tyd m emu o;t0 renio iydomteaivolt)srtmxo nodom e fct sf rurx pno1apxo oeiyt m2rlnvp;t)aetnifcoo1lpteluvi;s)srxo(rpiodapt lfeil( a2ua(monu1apx  i3iltls2em(vpn()tltoio3iy1late n s;s0sexm(m3iy1ole mivta(faDrmxmoou0aexnmoetytla2umnmp u4aeeoxf3totlm eanvi;(0seto(m3ou1omenlfes tfarrm(rp;o0teen ieilsfs2rmnvs;t4 etnif3iadlmt livsls)srxr(r no4alenlnvils)aDrmxmpou0tptnif3iytfs elump;u)texnxrcty1laDeluei s  rurim nodom nmncs tfsrtau pnu1olt iiciyt s emnvp ()trenmfcoytfmtrlu i () rxrxr nodlp nlfcs s arta(m nt1oee mf3tlslaDel(mont) exnif oy1fatrln o;()trxr(r3iu4lpe  fei tfaDtr(root4alt mf3tld m2ranvs;u4tleoxo iodlmD ai s t0sruoim iu1ll e fvtltfsrumx ont4olt ioctlt mDul( o u0 rtomf ty1fmtr ues;s) euoxo nodomenlivi t  2tr(  oo4texoio3iysfsDea(ms;u4aexnio to1omDr u o (0s2xr(rpoo1olenmietltf rraur nu0tlx io3tlt m emump t4trxoxo3iydomD  u ol(0 eto(m3ou1ole  ict t aDtrur nu0oexnmieiyslm ra(mp (0 lxnifcto1fmDranei;( srxoim3no4olte nvil() 2rruro;o0ape  ociyt a2umnvp;() lxrxr3tatfp  ln o s srxr(mpny4ol  mfci t aDrmurp;u0alxnifetldla umumsnu4aleriocootlaDe n ilt) rurim oudol nlivtat  Dtr(  ;u4aetoio3ils s2raums u)tlxnxocoydopteai il(0t2xrxr io1ol nlfci (  2tr(m ot4teeoiietad aDuluvs;()aetnxr3ty1opD livs;t)trxr(o3oudol nlfes sfarta(ro;u0optoiicildfs el(vp t4aetrir oodlmt  ues t0 2umim3no4lm nmfvt ()sDuaur nu0apt  feiyslmDel( on()teeomrciatomDe ivi;(0tetoxr oydome liesl()sDuru  nu4alt if3ilt sDranvs;u) lxrif3oadomt aneo;()srxoir nodaptemfvtl()artrxmpnu0tetniieias sDeanvs t)alenmf3oy1omt  iei;()s2xrir nydlmt  nvsa()aDrrumont1tlx  o3iyd sDumnvs;u0 ltrmf oadfatrlivolt0trxrxm iodlp elieils)a2rrur oo1oetoiictydfs rlnmp t4alerioctatfmD lueo t0 eumxo3ny4openmfvia()arta(m ;o1apeoif3ildfaDuanvo;t)arermr oadfp  aieo s) eto(m3io4om n ieia( aDum(  ot0aet ioeild s umumsnt4trtriocia1lmDrai ols0trtr(mpoo1llte netlt sDrm( pnu0ope  oeilsfa ua( p t0alermf3to1fp  au s t0s2xmxo iydaltelfcias sDrm(mont4tpeo i3iytla2rmums;u4 rxrmf ty1fat ai ols0s2to(rpnudlpe  fetat) 2urxrpno1ole ifctasfsDrmump;()arxrxfciadomteluvol(0sexoir3io1apeemncilt  2rr(  ot0oex mi3tld aDrluvp;t0 etoio tatomDelues ( t2tm(m3io1am e fcils) 2uaxr ot4tee mieiyt m uauvon(0texrmfcoa1fa   ies;t  rurxm3io1om  mncias) 2tru o;u4alxo oeiasla2elnmo;u4trxoxfctotlpt aivi (0t2xm(o3iodlp emfeta()srrmx onu4ope moetat m umuvont0 ltnmo3oa1fpt ai i;(0 exoxmpoo4llt mnetls) Dtaum ;t0ale mictltfa2uln p u)teenxo3oo1fa  lu i s srto(m3io4ope  nei t a2trxrpou4altomfetltfmDrm(mo t) etnxrctydlpDr ueolt)seurio nu4oltemfet ()aruaurp;u4tet iociad mDeaumont0tltrxfcta1oatrau o;s0 etrxm oodalt lfvia() Dtr(m ;o4apxnmoetaslmDrl(vpn(4 rxnxo3oa1fate i s;t)s2xoxo3iy1oltelfctl(f Dtaxrp;t4ole mictld mDrmnvs (0trxnmo3tytlp elivs;s s2xmxo3ny4op   fctatfa2umxrpnu1altoifctatfm umnvo ()aetnir3iy1op elieo (  2toio iy1am   fetls aDtmur nu4tpt if3iatlsDulu snu0 lxoirciydlpteai olt) rxm(mpoudamtn fesls)srum(mono0oee  ictltfs2raums;u4teermrcoadfpDr i o t  2xm(o oodalt  fetat  2tmum ;u0olxo i3iatfs rmu s (4 rxomo oadfm e u sl(  etm(m nudlpte nviat) Draxmpot4aetomoctatlsDranvs;u0aexomf io1lptrln o;t0 2ur(rpny4apt  ict tfs2trurp;o4tpe io3ils a2uln p;t0arerxo3iy1lp  luvs t0trtrxr no1aptnlnviat)a2rrxmoou4altomf3ias a el( o;u)trtnmr3oatlpDeaueolt s2xr(opio4omenlicia(f rrrxmo;t1oexnii3taslsDrmn pnu) ltrio3io1omt livo;() etrxopoydal nmnvtat aDra( pnt1optnmfciys a ra( pnt4tlenxfctotfat auvo;( trtmim3iu4om emnvs (farumumpoo0oeeomociat mDrlu s;u0 lerifcio1optelivi;()seto(o nu1lmt lictlsfaDua(rpou0aleoif3ilslaDulnmo t0aleoif3iotlate n s t0 exrxr3oy4apte nctat)srum(mpoo1tpx mo3iytfsDranvsnt)tlxrmr ia1fpD  u o t)s2xoim no1ame  ieilt  rrrur ;o4oexomf3iatfs2rau on(4artrmf ia1oatrai i;s  ruoxopou1lp nmietltf 2tmu  nt0olxo ieiasfmDra(ms;t4 leoir3oydopDe n o;(  2trxm3iy1opte fesas s2trur ot1tex  o3tadfmDrl(ms;u) renmf3iytfptr n s;t0tetrxm ny1alt miciat  ruax  nu0ole ioctld a2um(ms;(0 ltnxf iadlpte nes;t  eumxm oydllee ieslt)sDur(rpou4aexn iciydfmDrm( o (4 lxrio3oy1omD  ivo s setmxo3iy4aleelfct (fa2tr(m ot0tptnioeiat m2eaums;() reomf ia1op rlnei s)s2xoirpny4lpe  nvil(fa2ta( pno0oleo ieiadla ulumsn(0teenio3iotopDraieolt teurim3nodll nlncia( srtrxmo;u1tpxnmoeiyt aDra(vo u) etniocty1op rlivo t)t2xo(r3oodomen ncslt s2ra(m ;o0oleomociasfm ulnmo;u)texoxo io1lpD  n olt sruo(opoodale  ivil(f Dtruro;u1teeniieiltfsDeanvon(4aleomo3iotfatr uesls0sexmim3io1om n fvil(  rrmxmooo0alx micilsfs2rln p (4arxrmfcoa1oate nesls0trxoiopiodlmeemietat arumx ono0olx iieiad m el(vp t4tetrxr3iydfaDrai i;s0s2xo(mpou1lpe lfci tfsrum(  oo1tlenifctltlsDeauvsnu) etrmr iodla   u o s  2uoio3nu1lpen feilsfa2umxro;o1aexo ietyd a rlums ()trtnio ta1latrau i t  rxmxm iu4olt mict s  2urxrpoo1oetn i3iat m umuvp (4trxrxr tytlm   nvs;( sruo(o iy4lmt lfcslsf rraxm ot0aee  iciyd s ulnmon(0trxoxr oatfpDrlnvo ()sexoxrpou1lme mfet tfa2tmu onu4tltnifeilsfs2uln sn(0trenio3ty1fmDelnvols0s2xmimpoy1ap  lncs tfsDtrumo;u4aptoiocilt a2rmnmp u0 ltoir to1fp  auvo;s0srtrxopoy1llt mncsat)aDum(rooo4apto ieiydlsDrl(mpn(0 eenxfciotlp r ueo;( s2toxmpnu4opte fcilt arumxmpno0opxnifciadfs rlu s;(0 lenif3tydop ranvi (  etrxr3oydllt mieil(faruru pou1tex ioeias mDrlnvo;(4alermrciadfmte neo ( teto(opiodlpt  fetas a2tmu  ou4oetomfciydfs elump ()arxnif3totfm  aueolt) 2triopou4olee ivt ()srum( oot1aeto ociydlmDrmump;t4tltrxf ootoatrluvo t0 etrimpnu1ll  mneslsf Dtaurpou1teeomo3taslsDumuvs ()artoiocoodla r i olt)teurim3iydopeemicsat)aDuax p;u1aexo i3iydfa2ra(mo;u4tetoir3tydla   ivo;()srxrxopny1opt mfes (fsDrrxm ;u1tptn octldls2emump;u0arxrmo ta1fmD li sls  rto(r nudopt livsls  2taumpot0ale  i3iytls2um( o u0aleriocoadop   ivils srtr(m3iu4aptelfet t artmxm oo1oeenioetat s rmumo u) ltoxocoy1lmte n sls trtm(m nu4lmen ictls sDumx oou4tptn feiytlmDuluvo;()teeoxr oatoaDranvol() rurir no4al  mfci s) rur( oot1alen ieilt a umuvs;(4 leoircta1op raies ( srxmxmpny1optn ieta()srua(r nt4alt mo3tadla2elnvo;u0tltnmf3iotfm raies ( seuoirpoudaptnlneil(farua(m nu1opx mfeiyt m2eanmp;u4trerxf oatfate n s;()truoirpnudalt lncsl(f Dta(m ot1tptomfetyt aDumn p t0texrmocoodfpt  uvslt srur(m nu4oleemnesatfa2tau ono4optnii3tls a2eaump (4tlenxo3oatla rlnvil(0 rxr(mpno4olenlneias)a2tmxroou1apeomfeiltls2rau s t0altnifcia1opDrlieol(0trtoir3iydlmt  fvsatfa2tr(rpoo0tpxomocils s2rl( ont0arxoxf oatfaDrlneolt)teuoir ou4lm   iciasf 2umx oot0apxoiictltfa2em(vonu) rtoir io1late uvi;s)t2xmir3oudlmeelfvt s)aruru onu4teen ictyt s rm( p;(0 etrxo3iadoa   i o;(  2uoim3oy1lltn nvils) rumuroot4alx ifetydfaDel(vs;(4teeomociy1lp  lnei;( t2xoio nydlme mietlt sDtau ont1ope  i3ils a el(vs;(0 rxnxociadfmDraueilt  rumirpiudlltelietasfarrmur ;o4texnmfciltlm umnmsnu4tlxrxr3iatopt  u s t t2xo(opiy1amtemnesatfa2umx p;o4tlt  feilt aDuln p;t0 exoio oo1op eli i t0seumxm3iu1opt lnet ()aDumxm ;u1altoifeiasfaDumnvsn(0 ltoiociydoatrli ols)t2tr(opnudam emietas)srurxm ;u0aet mo3iasfa2ul(vsnt4texrxo3iodomDrlneil()texoxr3oo1olt mnci (  rrrumooo1alenifeilt mDem(mp t) lxnmo oadla eauvs;t srxoxr oo1ol elici s  Drrxrono0alt ifciyt m uau s;(4tltnxocoatfpt lnvo;()t2trxrpno4lme liesasfa2tmu  nu4apt  fetldlm elnvsnu)alxoxf3iotla  lu sls0 2uo(r oy1lpe mfvsat) Dur(m oo1optn o3tadfmDrmn ont4tlxomociy1fmt liei ()t2xmxr3iudope licsatfs2taxr ;u4tpen ietltlm eanmo ()aeeoxfcto1op ranvi ( t2xrirpoydapt  nvt tfsrurumoou1opt miciadfs2rl( o t0trenmr ia1oaD livo t0trtrxo iu1al nmfciat) Dumuro;o0tpxo o3ilsfsDrmnvo ()tlenxr tatlmDeanvi (  eto(opno1lm  mncsatfaDtrxront4alt mieiatfm2rmuvon()aexoif3totlaDeluvil(0setm(o oy4ale liesa(fa2umxmp;o0apxnmoetadfa2rmnvp;u)teerxfcoytoaDeanes;s t2tm(mpnodapeelivta( aDtm( onu4apeomo3tltlm ea(vo;(4alxrio3ia1fpDraivo;s0trtoir oo4lme  icil( a2uax oot1altoiociyd a ranvp t)tlxrmrciotlpD lues t setmxo3io1omt  fvt t)aruaxrpnu1olen o3tas m el( o;u0artoxr ia1fm elnvils0t2xmxo nodam e ics t s2ur(mp;u0oet moeiyt s2um( on() etomf ootfmtraneolt) eur(r3nudomtelnct s)aDur(r nu0tlto fetatls ranvp t4aetrxr oydfpt anes;(0texmxo3nudlp emnvtlt s2um(mpnt1altniicils s2ea(vs;() etrmo3iotfa raues s0srtm(o3oo1ol elfvs t)aDum(  oo0tltomoeiyt mDeau o;t)aeeoxr oa1la rlies;s t2umim3iodam n ieil()s2rau  ;t0altoif3iat aDum(ms;(4 reoxocoy1la elivs ( trtmxo iudapeemieslsf rtr(mp;u1ape iociadfa ranvpnt4aetrif oydlpDrau s;s0 rxrxmpoodlpee fei (faDtau p;t4aexomi3ilt m2eluvs t0texrmr iodoatrlueo s0teumimpnu4alt  fcsl() Drr( pot0tlxo iciytfm2rm( ont4trtrxr iadoaDrlueilt0s2uoxr3nudlmte fcia() Drmxm ot1opto fctyt a2raums u) rxomo3tatlatr ieols0t2xmir ou4ol  micia(f rrrx pot1alt  i3ild a2ulu s u)teeoir tytfm elneilt)tetoio3iu4al emivta() rtrxr ;u0tet iiciytfsDelnvo;u)trerio to1laDe nes ()srto(rpno4omt mieslt) Duru p;u4altnmiciatlsDulumsnt4 exoif iotfa  ln i () etrxo oy1open ncsl()sDrmurpou4tltomfetydfm2uau s (0 rxnifctodfatean i (0 rurim3oydale  ieia()aDrrurpot1tptniietltls ulu s;t0texnxfcoodfmtelnvo;t0s2xoxm ou1lpt  nvsas) 2ta(mp;o0alxo ictatlaDrmnvo (4alerxo todfateai olt) rtrir nu1ol  mnci sf Drru pot1opt iiciys aDrauvo;u0trxnxrcoy1fptean i t)seto(r3iodap elnvtls) Dta( oot1texo f3iadlm2ranvp;(4 exnifctadfmDranvsls0t2xoxmpoo1apt lfetltfsDtr(rp;u0aetniociasfm2rlumo;u) exnxo tydlp rlneo t0texoim3oo1optnmfvsa(f 2tau p;t0tleoifctlsls2ulnvp u0 ltnif3io1lmtrli o t texrxm ny4omtelivias  2umxmont0olx  iciydla elumo;u0 rerxfcoatlmteai i ()teto(rpnudlltelivsat) Dtaxroou1tpenmfcildfs2ul( p;u) rxoxocoadlpDrln s s srtrxrpnydam nlnct s aruaur ou0tlx io3tltfs2rlnvsnu4 rtniociodopt ai o;( teuo(m3nu1op emfeiltfsrrau ono4apx ifctyd a emu o;(0 etrxf totfm  ai sls  rxo(mpnu4altelfvil(f 2trumpnt1aeeo icias m eau s;(4altrxo3iy1lptrlu o;()trto(opno4omen ies ()a2tm( oou4tpxnii3iatls emumo t0 rtrmr3oytop  aueols  2xmim3oy4apt mnvsas  Duaxm ot1alxnmfeiydls2ea( pn()tlerxfcoo1laDrluvslt) eto(mpoo4lpt  nvs tfs2rax onu4ape ii3tydfaDrl( p (0altrmfcio1la elnvsls)teumim3oydoltnmfvsas) 2tmx p;o0altnif3iys sDeanmp (0teermr3tatfmteai sls)srxm(opnudlp nmnctlt arta(rpot4tex moeiydla2uanmonu4tltoxr3oatlp eauvo t)texr(r io1lmtemivtlt)srtmur nu0tetniictlsls emu pnt0aexrxr3tydfptran s t)s2umxmpno4ll   nvtasfsrumxmpno0opeomociasfm rlnvo;(4 eeriocto1lpD an o;(  2uo(opoy1olenlfei t)aDumxr nt0aexomi3tadls2em(vpnu) eerxr iydomDean olt0 exm(opnudlm   fvt t srrax o;u1aee iieiasfmDrmuvs u)alxrmr3oa1lp  aueslt s2umir iy4aleelfvt ()a2rruronu4aexo octlsfm uauvonu0tetnio oatlm   iei t  euoio3oydomeeliet sf 2umu pnt0ape iieilsfm2rlnms t4tetrifcootlmt  n il(0trumirpoydale lict t)a2trxmpnu0aexn fctlslaDuau s (0tlenxfcoytopDrlneilt)setrxm oy4omee ncsls) rrrx  ;t0alxn ieiysfm2ranmon(0trxomoctadfpDrai o (0seuo(opiu1am e ietas aDtau poo0tex iietadfa umumo u) exnmf3oytomt ln s;( s2tr(r3nudlp nlfcil(f Dur(r oo4apxnmo3tad m2ranvon()tlxomo oodlp eaivi s)teuoxr3nydol   iviltfa2rr(r ou0tptomi3tltfa2rm(vpnu4trenxf iodlmteaneils0trumir3nu1apee ivsltf 2ta(  ;o0oeenmoeiad a2rmuvsnt4aeeoxo3iodopte uvs;()srxm(r3no4lme lnct ()srraxmoou4aptn oeilt sDul(vo (4 etnmr3oy1oatelivo;( tetrxo oudomtnmnvsl(f rrmu  nt1tpxnmoeiys m em(mp (4treoif3oodoatr i i;s0t2trxm nudamte ics (faDtm(moou0altnio3iyt s2rl(ms;t) exrirctatfpD  nvil( setoxrpiy4lpe liciat  ruru  ;t0alxo ieias m ea(monu0trenmo3oa1omtrau s s0s2to(r oy4apt mnvi ()srtrumonu0aexniieiad a2rl(mo t0 etrxo totlmDraueslt)srtmimpoo1lp   icsl(fsDrmuronu0tltomfctytlmDrmums;u0aeerxr3todop  lneol(0s2toio3iu1alenlicil(fs2ra(r ;o0tpeoif3tydlm2emu onu4tlxnxo oadfmDeauvi;t0seuriopnudop nlfctls  rtm(  no4alxoiieiydla2eln sn(0alerxo oo1fm eanvils)texmxm iydop nlfei t)a2tm( onu1alx iieiys mDumu o t4 reomr3tadfp rluvs;s0trxmimpiy4lme lieil(faDtau oou1altnii3iyslmDel(von()tlermocio1fpDe neo;t)s2uoir iu4ll   nei ( aDtm(moou0oltnif3tld mDrm( p t4aleoxfctytopt an ol()teur(rpny4lpe  nvil()sDtaxmoou4olxo f3iys mDemu p;(4 ltnmocoatlpDelnvols0 2trxmpnodamenmieil()a2rmu  nt0tlxnii3ilsfm2ranmo t)alxrif oatfm e nvs s) rxoir iu1optn ivsas) 2rmumono0oexo icilsfs2um( p ()arxnxo3io1lmDeanvs;s)srumxm3oudom emiesatf Durxmo;t0oetnmfctat s2ranvp (4 ltomfctydfmt aneo;(0teumir3nydlmen fctls  Drmu pot1tpto octyd a2ean o;t4artrmf3iatlpD  u i t0t2ur(o3oo1lle  iet t  Duaxrp;u4aee iociysfs rmnmp;()aetrmrcoa1omDeliei;t0srurir ou1ope  ivs (fsrua(  oo1aee iiciat sDem(mp u0trtrxr3oo1fp eluesl() etoimpiu1lme  ivil( s2tmxrooo1alxomi3iltfmDuan snt4trtnif iotlm   ivilt0trxmxmpno4om elicia()artr(r ;o1opto oetlslm ul( on()alxoif tytfpDean i (0 rurxo3nudamee fci s) 2um(rooo1tet  oeiltlsDra( snt4alenxr3iodfp  au s s)srtrir no4lle mfei (fs2ta(  ;u4opxomi3iydlm eln pnu)aeenxf oytfmDeauvol( texoxopiu1ll   fet tf rtau pno1ope ifciyslsDrl(vpn(4tlxnmf iydlpt ai s s)s2xoxrpnu1opt licsa()a2tm( o;t1oetoif3iasfsDuau p (4 eerxo3iodopDeaneo;t  rtrimpnu1amtnlivtas)sDrm(mont1opeo fcildla em(monu0tetrif oatlm eau sl(0sexo(opiu4lpen fetl( s2rr(  ;t0alx ii3tydfaDelnvs t4alxrmfciytlpD  ueo t0srur(o iudolen fvs (fa2rm(r ou0tlxnmociytlsDra( sn() rtniocootlmDelnvil()teumxm3iodlm n ivtatfaDtmurpnu0aeeomf3tls m2ua(vo;t0alxrxrciadomDrau o;s)t2um(r3iodol e nvta( srtmuro;u4tpx mfciyd a rmums;()aleomo iadfmD  i o ( srum(m3nodal e ict sfartrxrpou0teeniocild m eluvp u)texomo ty1fate u ols0 exo(r3no4alt lie
\ No newline at end of file
@@ -0,0 +1 @@
+n ols0teuoxrpno4ol n nes (  Drrxrono1apxnmiciydfm2um(ms u4trtnxo3oodfm raiesl(0s2xm(opoy4op  lncils  Dumxmpnu4olto icild mDelnmp;u4arerif oo1om rauvs;t0t2xoxr iydlmte fetltfartaumo;u1apeniocilsfsDumu onu4aexoxoctodopD  n i;t  rxmxm3ny1ole mfet sfaDraumont1ape moctyd s2em(mp () eerif iydlmtr ivslt)trur(m3oydom elfet ()s2ta( o;u4oltnmieiasls2ulnvp ()treoxr3oydopD  ieo;t)srtrimpny1ame livils)s2uaur oo1aet  ieiyt sDrmuvs;u4teenxf3iytfm e u s;(0tetrirpnu4lpeelfci () rraum ou0opt  fetydfsDuau pnt4tlxomo oydlm elu o ( truoir3io4aleemfetas  2tmuroou0oexoii3tyslsDrmnvs;t0aetnxr3iadomDrluei s0 etoiopiodom   fetltfa2tmumo;t0tex  ietlslaDuau o t) rtnmr ty1fp  aueo;s)trtrir3ny1ol nmfesl(f Dumxrpou1ope ii3tas aDumuvs (4artrmf3io1op e u i;( seurxr3ny4op elfvi ( a2tmx  ;t4tpeomictaslm2rmnmo;u0alxomfctatfatrli o s) rumimpiu1apee fvtasfarurx pot4tetnmieilt mDeanmo;t4altoir3to1fpDr uvilt  etm(o3oydlm nmies sfa2ua(  nt1ape ii3tysla2uau p;u4 etoifcty1oa elies (0 2trio3iy1olt  nvi s) rtaxm ot0apt  f3tatfsDea(ms;t4 lxomo oadla rlivsl( t2um(mpnu4lptelncsat)a2tr(ro;o4tpeo f3iysla2rmu o () exrxf io1lmtrlnvo;s t2tm(opnodoptelnes ( srtmxr nu1aptnif3tadfsDea( o t0aetniocoy1omtelnesls) exr(r3oo4optn neta(f Drrurpnu4tltnifeiyslmDraumon() rxnmf3totlm ranes s sruoir nu1omt livs t aDrmu onu4apen o3iytfa2emnvsnu)aeeoxo3oa1fmt lu i;(0 ruoxmpoy4amt  fes t srtaxr no4tpt mi3tatfs ulnvs u4aexoxfctotlpteaivslt  etoim3oo1ol nlnvt s)srrr(mpot4oeeo fciasla umnvpn(0tetomr3ty1fmDrli il()trxr(o no1ame lies sfa2rmurp;u1texn f3iydls2um(vs t4 etniocoydfpD lnvo;s0s2xr(m3oo4opeelfvs s  2uaum ;u0tleomieiysls2em(vo u)texrxf3oy1lpDr i i s  eum(r io1ol   ict tfa2rmxm ;u1tptomoeiadfmDranvo;t4teeomf tydfp eaiei;(0 rtmxm iudalt mneslt s2um(rpoo1tptniociadfaDrl(vs;(4tetoxoctydopt  ieo;s teumio3no1lpee nvslt a2ra( pot0oltoiieiaslm uan onu)arxoxociydfpt anvils) rtoxr oy1alee nei t  rraxrooo0opt iocilsfm ea(vp;u0tlerioctytomtrlneo;s) 2tmxrpiy4am e fctlt s2tr( pno1oexnmo3iys s ra( on(4trxnio3oodopDraueols tetoxm3ny1apt  ietl() ruax pnu0tlxoif3tltlm2rmnvonu) lxoir io1oa r nei (0teuo(mpio1ap nmfesl()sDtax pot0optoiiciaslaDrm(vo;(4texnircoadfm e i s;() ruo(m3nydame mnvs s)a2uau ooo4tleomoeiytfm2eluvsnu)tlxrxo3oodopDranvils0t2xrxo nydaptn ivi ()a2tru ont1oleo fetatlm ulu p;u) leoif tadlatrli o;(0teuoir oo4lmee ietl(  rum(mo;u1oet iicilt sDemump t)arermr iydfa rluvilt0 2xmiopou4lm e fvtas srurumoou1tlx  fetydlsDeanvpn(4tlxnxr3iy1faDeau s ()setmimpno4ape mfcs ( a2rau p;u4opxnmfeiysfa elnvp (0 rxoifcoatfpt  uvs;(0 etrxr iu1lme  ncilsfartr(ronu4tex moeilslm2rmuvp;u4trenmf3ta1fp  aiei;s  rtoxo3ou1lm  lieil( sDrruro;o1tlxomfciltfa2em(vo u0trtnirciotlm raneslt0 rxoxm no4al  lfvt sf Dum(rpnu0oexomf3iltfaDumnvont)trxoio3oa1omte u i s t2xr(m3no1open nvtlt arta(  ot0apxoioctas a eanmo;u4 lxomocootom rlneslt  etoio oudopte fciatfs2raumpnu4teeniictaslmDra(vp;(4aexomo oadlp  ln s () 2xo(rpio4lp elfcs tfsrur( p;t4tlenifctas s eln on()arerirciatfpD  n o;t  eurxm3oudap emnviltfarrrx  ;t0tpt iociytfm elnms;u0 rtrxfcta1lp  lnes ( s2xmxopiodlp  mfet sfarrrx pnt0texnif3iyslm rau snt)texrmf3ta1fmtr uvs (  rurxr3iu4alenlfvil(  Dtmx ooo4aptomoetls a2rluvo t4tetoxr3iadfa rlivs;s s2xmxmpiy4olt lnvia(f Dtm(m nu1ole  oeiasfa2umnmp (4aeerxfciy1fpD  ivo;( sexrim3ny4omen icsa(  2trxr ;t4aleomietysls emuvpn(4 lenmo iodlmDeaueo;t  2um(o iudlpt  fctat) 2rr(  oo0aexoioeilslaDua(vo;u0trerio ta1fmt anei;()s2umxr3iudoleemiesasfa2raum ;t4ole ifetatls2el(vsn() lermr iydfp r ies s setoio3iy1lpe mfvt ( aDum(ront4teeomo3tltfsDrauvsnt)altrxo tadfp e i s;t  2trim oodlm nmnesl() 2rru  no4aee mo3ils a2emumo u4 eermo3oy1lmte u ol( setm(o3ou1lltelnct s srrrxmpou4tee  feiysfaDeanms (0alxoxrctydfa e u sls setr(m3oydlmt mfvsa( s2umumo;u1texnmietltla umuvon(0tlxomr oydfa rau i (0s2xmio io1am  lfci tf Dtmxrp;u1teenio3tld s ua(ms ()treoxrcoadomDeln sl( t2toxr iydlmtn ies s)a2um( oot0teeo ictadls emnvp u4arxnxociytlm r neo;t0 rxr(o nydapt lietl( arraxrp;t0aex  ietyd m2emnmp;u0trtnxrctytfat ai s;t)teurio nydoltelfesl() rtaxrpno1aleoiiciytfa ua(mp;(4 ltoifciytlm eaiei t tetoim3iudape mfvslsfa2ua(mo;o0tptoiietld m emuvpnt4 lenmrcto1oaD lnvo;t  exmxr iu1op nmieia() 2rrx  ;u1oltomoeiadfm2elumont4tlerxocto1oaD auvi ( texoxr ou1olte nvt t s2tr( ono4aexoifeiyd a2eauvp;t4 ltoxf3tadlaDrlu o ()teumxm nydape lfcia(fsDrau oot0oet  i3iyd mDul(msnt0 lxomf oy1lmte n o;s0setm(r ny4lmtemfvsasfarrrxrp;t0optn ocilsfa eau snt)arxomr iadomDrluvs ( sexm(rpny4oleemfeslsfs2ra(m nu4opx mietls m rmnvs;t)trtoxf3ta1omD  ueilt trxrxo oy4al emnvias  2rmum no4tpe ifciytlm rlu on()aetoioctadlp r neil(0trtmxo oo4lltnlivtl(fa2rmxm ot4oeenio3tadla ran p (0 leoio ia1fpDeln s;s)s2umxrpiy1lmtnlfctltfsDur(  ;u4aleomociyd aDua( snu4aeenif3tytomDean o;()s2umim nydapte icta( aDtaxrpot4tlt ifciat a2emumo;t4aetoxo oo1lm ranvi ()tetoimpoy1amt mfvt ( arurur no4aetn oeiatfa2elu p;()aeenif3to1omDeau o s)setr(m3oy1lle licils) 2trum nu1tpxnmf3iadfm2ra(vo;u)aetnxr iotfm rln o t srumxr3nu1ll   ivtl()a2umx ont0tlxn o3tlt aDuau p (4tlerif3oatoateln o s0srxoio3iudoptnmfctls sDtm( pno1oetomociltlm2umumsnt0altomf3iotfmDraueo;t srxmirpnodal nlnvt tfarrm(  oo1tpxn oetlslm elumsn(0alerxociotfmDrai s;t) rtmio iu1ale  fvtls srurxrp;t0oexn fciatlm eln pnu0 rtrxfcoa1om   neols0 euo(o ou1lm  livslt) rtrumonu4olt mo3tatfm el( o;t0tetrxf tatopt anvol( srtmio io4lpt  fvslt  rrrurpno4tpeomoeildfs ea( p;t0trenxrctytoateaneo s0trtr(o3iy1opee fetas  rum(m ou4tltnmf3iydlaDuauvo;t4teeriociadfa rlu i;t)tetr(opnu4lmeemivil()sDrmu pou4tpt mo3ias a2ulnvsn(4 rtnmrciodoaDelies;()setoxrpno1omt mietl() 2ururo;t0olen oeiysfm em( ont4 ltoif3iadlpD luesls)s2toimpoo4open icsas artrum ot4opxnmoeildfm uauvp;t4 eenio oy1lm eauvo;t setr(rpiydamen iviat a2ra(mo;o1aee  oetadfs uanmp;(4tlxnxr3totlmtrln i t s2uo(m ou1omte fvta() 2taurp;u4apenioctatls2umuvs t4alxoxfcto1fpDeau ols0sexoxmpoo4lme lfes ( aDtm( oot0oee iocias s2uluvp;u4arenmr to1lp  anvs t0trtmio3oy1lleemici tfaDra(ro;t0olt mieilsls2ulnmon()aeeomocoodoateaies;s t2tmir oydlm  lnei s)aDur(rp;u0texoiictaslmDem(mon(4altnio3oy1oate ies;t truo(o oy4lmee fvsl() rtaxm nt4opxn o3iltfaDrmnvs (0 etrmr tytlaDelieo t0 rxmir nudll nlncsltfartrxr ;o4texo ictat s2rmn onu4 exoxf3iytlptraneo;( t2toxmpnu1ope  ivt (fa2urump;t1apenif3iltlm umums (0 lxoif totoa e iei;()srtr(r no1alenlfvilsf 2uaxmpot4optoiieiadla umnmo (0tlxnxocty1omtrau i;t sexoxo oydapee fcta() 2umx  ;o0aetnmfeiad sDulnvo (0altnxr ia1opt  nvi;t)srumxopiudlp  lfcslt sDraxrpnt4apeniociltlaDeau p u)aexomf iydop elivo;(0s2xo(mpnydal n ietlt) rurx  nt4tetnifcilsls2uauvs u4aeermocoatlmDr nvs s0t2xmxopno4omenlies () Drmumono4apx  oeiadlsDulu p (0 lxnmfctotopte u s t0t2ur(mpoo1alen fes t  rtmum nt1tpxnmo3ild m uauvs;(0 lxrifcoatlpDean o t)tetm(r oy1apt lies sfsDta( onu1apt mocias m2ea( p;t)tetrmfcta1op elivo s0 rtrxmpiu1ol  lfvs t)artrxmonu1teen ictlt a2um(mo u0 rxrmf oa1omtrlneilt  etoxo3nodome mietlt)srrrx o;t0aexn f3ils mDeauvonu4trermocoa1opD lueslt)s2um(r nu4apt mivsl(  Dumu o;u0alt mf3ild s emnvs u) etrir3oatlmtrai o;t0tetm(opiu1apeemfcslt)a2uaump;o0tpxomoeildlm ulums;()tetrxocoadomD  nvolt0trum(m oo1ol   fei sfa2rmx o;o4alx mociydfm ea(vp;t4arxoif iodoateau il(0 rxm(rpiu1aptn ivslt)a2rru pnu1oeeoif3iat s2ul(vsnu0 etrir3oydoatr u o;t)srxoio3nodam e icsa(fa2ua(ro;t0openio3iyt a rl(vs;t0 etoio3iydlate ues ()srtmio3oudlptnmfcil( a2uaxmont1teeoio3tasfm2ra(mpnt0artrmo3iadfpDrli i t0 2uo(m3oo1omtn ieiat arrru oot0apto fciatlmDem(mpnt)aleomr oodoa elieslt0sexrxopio1om e nvtls  rurxmooo0oetomociltla emu o u0tlxnmfcoydlm elivi t)t2to(opio4lm n ivtlt)sDra(r ;o1tpe ioeiysla eau pn(4arenif ta1op r ieol()trur(opiu1ope mnvtatfsDtaxm oo0aex if3iysfsDum(vpn()alermf iytomtelneo (0 exm(o nu4lpt lfvs t)s2taxront1tpe mfeiytfs2umu s (0alerxr3ootom  livs t0srur(opiy4lp nlicias s2rmu  oo0oeeo oeils s rmnmo;t0tltomf3io1opt  uvols)tetrimpoo4om e fvsls  Durx ont1olt mieiatfmDrlumpnt0trtrifciatlpt aiei s setm(opiy4lltn nvslt s2tr(mpoo1tetnifeildlm rl(vs;(4 ltoxo ty1opt aueo t tetm(rpnu1om  liciat)s2tmxrpou4oltn oeiyd a2eaums t4aetoir3totfpDeluvilt0s2toim ny4op e fcils) 2um(  oo4alen fciysfm2rlnvo;u) exoxf oytoa eai i s)s2urim nudllt mnvtlsf rurxm no4oee mf3tldfa uan s (0tlxrxf3tadfaD  nvo;s)srur(r nu4amenmncsltfarurxmonu0aetoio3tadlmDelu o t)alerxf iytfateauei s s2xmiopoo1alte fesas  2tr(roou4apxoiictyslm2rmn o u)alxnir3oo1fpt  u i t) rumxm iu1llenlfctl(  rtmx oot4alxoii3tadfaDrlumont0aeeoxo io1la e iei s0t2ur(r oy1alenmfvs t) 2tr(r ou1oeto o3iatlsDuln p;t)tetoxf3iatopteaivo;t0s2xmiopiy4al n fes t)s2rrx  nt1tpxn i3tldlsDumuvp;t0texomocoydfatrluesls0 2tr(rpiy4lptelfcsat aDrax p;u1oeenmo3iyd sDrmuvs;t)teenifciy1fatraieils trurxm no1lm nmfetlsf 2trumoou0olen o3iaslsDrauvs;u)artnxfciotoaDeanvo t  etr(o3oy1ope  icils srtm(  ou4alxn iciasfm2rlu s t)teenir3tydlpDelu sls) rur(m3oy1lp n fvia()srrmxmont4tltomoeiyt sDrm(mp u4trxnxfctotoptrauvilt srtoim3iudlm elnvtltfa2umu ont0tpx mietysls2emumo;u)trxnmrcoadlp r u s;t0 rxoiopiu1oltnlfvsl(  Dra( pot4tetomf3iatfaDelu pn() lerirciatoateanes;s seuo(r3oo1oltn ivsasfsDumx pno4texn oeildlsDemn p;(0aeeoif3ta1fp elueslt0trxr(opoodope lncs (  2rmxroou1open f3tytfsDrln p t) rtnir tydlptr iei ( trto(mpiu4amtelnvi s  Dtmxm ot1oltnifeiatfaDuauvon(4altomr3ty1fmD livs;t  rtrxr nudap  mnei tf Dtr(m ;o0tle  fctlt m2el(mp;t) lxoircto1fa   uvilt)t2toio3io4am  livta(  2rruroot1tpt  fctat mDul( p;u0 exnif iatlmtraneilt)srtrxm3oodllenmfci tf rur(rono0alxomi3iyt s2rlu s (4alxrmo totfm  lues;t  ruoim3no4olenlnvs s  2ua( o;u0ole  ieiydls um( s;u4 lxniocoo1fpteln s t0 2tm(opiy1ap n fvs s)a2ra(  nu0openmfciysfaDranvpnt0tlxrio3to1oaD au s (  2uoimpoodom nmiciat artrumpoo1tpenifeildlm2eanvo (0altnir iydopD anvi;s0trtrimpio4alt mivs (  Drm(mpnt1tleomicilslmDulnms (4treomocia1fa elnvi;s  eto(opiu4om   ics s sruax p;o1ale  oeias sDuan p;u4aeenmociatoa e uvo;s0srxrir3io1al n ivs sf 2tr(m oo0opxoioeils s2umnvs;(4 lenmfcootfaDe u s;(0texmxo3oudole  fvi tfa2trur ;o0aexnmf3tlt sDranmp u0trtnmo3oodla rlies;() etoim3iy4amtelnvslsfsDtrxmpou0opxnii3taslsDrlumo;(4texnmo ootfmt  i slt t2tmxopio1omtemfeia() 2rm( p;o1tpx  f3tld mDumnmsnt4 leoif3todlm eluesls) rxmxopiy4lmtn neils sDrmumpnt0apx ii3ils m ulumo () rxrxf todfpt auvo;s0t2tr(r nudalenlfci () Duru ono4apx ii3iydla elumonu0trtoxrcoadfpDraneslt  2tm(m no4optelfes sf Drax p;t1tpeo ocilsfmDea( s t4arerir tydfp  aneil() rxmio ny4ll   ies tf rtrxm nu1tle mfciyd m2rmnvp;t0artnifcoodfa   u i;(  2toxr3oudlm emnetasf Drm(mono1altniictys a2umuvonu)aexoio ia1oat  uvs;(0t2tm(r3iu4altnmfct ( s2taxmpno1aeto fciatfs emn o;(4arxriociydfpDe nvi;s)setmir3ny4om   nei (  2ur(mooo0opx  ietyd a rau p;(4tetoxrciy1lm  lu s t) rtmxmpio1oleelfctasfaDtrurpot1tpt ifcilt s rl(vo;t4trenxo iotfaDran ols) rxoio ny1lpt licils aDtaxm ;t4tpt  f3tas s2rln s t)aetnxf3tydlmDean s (0setoxmpoydomte fcs s srumu o;u1alx mocilt mDeln o;u)alermo3oa1fa  lu il(0 rumxo3iudape mnvslt a2raurpou1opxniietyt s2ean s (4altoir ia1lateaneo;() 2ur(rpno4am elfct sfsrtmu o;u1tpxoif3tas s2rm(vp;u0altnir iotlm  au ils sexmxo3ou1lpt mivias aDtru  ;t0opt mfctls s2el( s t4 lxnmo3iodoateanvs ()t2tmxo3iu4lmen ivslsfsrumxmpoo0apeomo3tad aDean sn(4 etrxf3iydfaDrlieo;(0 rtrim ny4am  mies t  Drm( o;o1tleniiciysla2emnmo t)artnxr iatoatelu s;(0 eumir3oy4lltnlfes s  Dur(r oo1tpxomf3iys s2umump;u) etnmfciy1oat li o;(0setoxr3ou4ll emivil(  rur(  no4tptniieiatlmDem(vsnu) lxoxo3oatfa  lieol(0 2trxrpnydomenmiei s artm(m oo0texomiciysla uln s t0aeenmfciydomDr iei;t)sruo(m iy1op nmfeta(  rtmx o;t4aetnmf3iltfmDrl(vo;t0texoxr3oadfptr nvs t)teuoxr3nodlp n nvilt s2urxmpot1oetomociydlmDuaumon(4tlxnio oo1lat  neil(0 etriopiy4lpt  nvi tfsrrmx pnu4oltomfetyt s2eau sn()trxnio3tydomDe uvs (0 2trimpoydllt mivias)aDtr(r ;t1oleomfcilt a eau o;(4artnmf3iodfmt ln o;s sruoxr iy1apeelieils sDtm(ro;t4texomfeiyd m em(ms;()texnircoodomDe uvs;s0s2tr(o oy4aleelivslt)s2rau o;t0oexnioeildlmDrmu p (0aexoxf3ta1oa elnvi t)s2xoim oudlptelivta(fsrtaxm no4altnio3iatfa ulnmp t0trxrir todopD luvo s0texoxmpio4apt  fvslsf rtr( pno4aetnmo3tlsfm2eln on()aeerio iodoa rlivi t truoim nudaltnmncsa(f 2rrxrpou0olto feiydfs2ulump;(0 exoxr to1fp raivs;t texr(r3oo4aleemfvilt)s2umu pou0opt  f3iyslaDuanvpnu)artoif iytomDelivsl()trxmxrpiudamtn feias  rumur ;u1apen i3ild sDumu s;u0aexomfciatla   nvs s)sexo(m iydllt livsls sDtrxmp;o1oetomoetatlmDraums;(4artnif iatopDr ivo t t2tr(rpiudamt liviat)artmumpoo1tle ifcildla2ra(mp;(4 leoiocoa1lm  aiei s0t2umir3iy4optnlfvtat s2rau  ou1aeen fctltls2em(vp;t0tlxriocoytlat  ieols)s2urxmpoy1ol n nctat)sruaxm ;t0apx  icild s uluvsn(0alxrmo iotlp   nvs;() eumim nu4lp e iviat) 2tm(mp;u1apx ioeiltfa rm( s u)tlxomfctadlpDe u il()t2tr(rpiy1lpen icslt a2tmumo;u0texnmoctltfm2eau o u0trermf3oy1lat  ues () 2uo(m3nydoptn nvta( artrumo;o4tetomi3tyd sDuau p;u0artriocoatlmtrlu s () 2xoirpoy1altemicia()a2rm(mo;t1ole  icilsls2ua( p;t4tlenmr iodlp   i ols)t2uoirpoy1ap   ncsl( sDurxrp;o0texomoeiadfaDra( s u0tlxnif ia1lmteaivi;t sexoir3iy4lpte ivsat)sruaxmont4tpeo octyslmDulnvo;t0 lxrmfciydop ean o;t srumxr iy4lm n ici tf rrr(rpno4ole iiciasfs rlnvpnt0 rxnxo todlm rluvi;t) exrio nudlpeelivil(  rtau  oo1opt mieiltfm2em( snt4aeenif3totlpD lnes;()s2xoirpoy4am emfvi t) 2umx onu0olt mfetyslsDrl(mon(0tlermrcootfpD  u olt t2xrxo3iy1llt licias srra(  ;t1ale  octysfm rlnms t4artrmo iodfaDelnesls)s2uoxr ny1lme lfei t)artm(  ou4olen f3iysfm el( s t)aeenirciydlp   nvols) euo(o nudol  mivtl()sDumur no1olxo ociysfmDel(vs u4artoxoctodfatrau s t  2urim3iu1lp nlietat  Dtm(monu1aeeomietldls rl(vp;u) lenmf oa1fpDrlu s;(0t2xr(mpoy4opt lfviltfartax  nu4aexnmo3iadla rl(mont0aetoxo3io1fmDe uvo s)t2tm(opnudlmeemfctas)sDrru ont4alxoio3iyt m emuvp;t4texrif oytfaDeluvo s  rur(r3nu4opt  fciasfartmu pno4oltnmi3ils a2el(monu4tltoir iatfmtean ilt)texmxr3ny1am e nei s sDtr(rp;u4aeen oeiadls2rmn sn()areoio oa1omtr u slt0 2xoxr nydol  mfvslsfa2tm(r ot1tlx  f3iltlaDeluvpnt)tlenxr ty1laD livs (0trtr(m io4apenlici s)a2raur ot0tptoif3iltfa ea( p;u0artoxr iytomD anvo s) 2xrim3iydame  iesls  rua(ronu0apto i3taslm uanmpnu4 exomfctadfpD  nvslt0seuoir3no1aleelicil()a2trxrpot0olx  ieiyslm2emuvp t)tlenio iydlaD lieols teuoimpny4lp e ict tf rtaxmono0aexo o3tyslmDean o;u4 rtoxfcoodlpDrau ols t2xoir oo4aptelici ()arua(mooo1olto feiltls ua( s u) rermf tytla  aiei;t  2xoxo3iu1ol e icsa()s2rmu pou1apeniociyd m2rmnmonu0arxnio ia1op  aivsl( srxm(r3ny4altelnei sf rtrxm nu1oetnioeias m2ran s t)altrmf3oo1omDrauei t0trtmxopio1amte ncil(f 2tmx  ou1alenmfeildlm elnvsnt4tltomfcia1lm eli s s0s2uo(m oy4ole mfvs s  rrmxr ou1tex miciyslmDrl(vs;(4arxoxf3todfatelu i;t s2xo(o ny4lp emicias s2trxr nu1aeen ociadlm2ea( o u0 rxrxoctatfpt  ivs;s trxr(o iydll  mictat aDrr(rono4tetn f3iaslaDeaump;t)altrir3iotfptelueo t texm(rpnodolte ivias  2trxmo;t1altnifeiasfmDuanmsnt0trxnmf3ia1late n i ()trumiopou1aptnmfet s) rtrxm ot4tpxoiieilsfsDuauvs;(4aleoio3ootla r uvs;s  eurxrpno1olte icsltfs2rr( pou1tlto feiltfm2ea(msnt4artomfctotfmDe ueslt srxoir ou4al e feia( sruaurpnu0opt if3iad mDumump;u4aexnmo oo1fp  aneo;(  eto(r3oy4op  mfeils srua( pou0opeoif3tas a ranmpnu)treoio3todom rauvi;s s2xoirpiodapt livias aDur( o;o0tetoio3iyt aDraums t0 etnmf3iytlatr neo s  2xrxo ny1op nmnei ( a2urum ot1tleomf3iatlm rlnvs;u0trxoio totfm eanvol()sexriopny1altelncsa(  rrru ooo1tpe mo3iasfmDrlumont)tetnmf3iy1faDr iei;t  2uoxm oy4apen feta()artmxrp;o4optnmocild mDul( o t4aetrmo3ia1oa ranvo ( setmxo3nydalenmivsl(fsrumx  ;o4tle  fciatlaDul( o u0texoxf iadlaDrauvols)s2trxr oudamtemfctls  Dumur ot0aetnifcilsfs2uau p u4texoir3ta1lmt anvi s  etmxo3ny4apt mfcsasf Drm(r ;t1oet  ictysfs2em(vo;t4trtniocoytomDe uvo;t  2xo(mpio1omeemictl(f Dum( p;u1optoio3tysfaDemu p t4 lxrmf ia1lpD  nvo;s) 2to(m no1lpeemivtat) Duru ont4tee mfetatfmDul(vo;u0aetnmr3tatomtr nes;t0s2xm(o nu1lmt  fcs ()sDurx o;u1oleomf3tysla uan snt)tlxnmr3ty1fmtelu i () 2toxr oodop n neta(fartmxrp;u0tptnmoeild s2emnvp u0 leoxr3oatlpt  uvi;()trxmxm3no1lle  fvs t  2urxmooo1apeomieiytlm eanmp;u4aeerxo3tatfp rln i;(0 2toir ou4al emiet s)sDra( p;t4opx mictydfsDum(mont4 lxnif3io1lpteau i;t)tetmio3io4ll e nvsat) 2ta(rp;o0tetn fciyd mDea( ont4arxomf ta1lm raivil(0texo(rpno4lpe lnes () Dtm(mpno1oexoiicils a umn s;u)trxoir oodlptraies;() rtoxm3oodalt lics (  Drm(ro;o4olx  fciyd s2ul( o u) rxrxoctadla  au sls setmxo3nu1om   ieiat)aDurxm ;t1aex  ociadfm rmuvsnu0trermo3tatlaD  ivil( teuoirpiydape mfei tf Dra(rpnt0aeeomieildlmDem(mo;()trtoifciodom  au o s0srxoxm ou4opt  nct tfarraxrpou1aleo icilslmDelnvo u) lxrxo3tytla   nvs s) exo(rpnydamt lneta( s2ta(  oo4oltoio3tlt s eln snu0arxoxrcoa1lp e u s;s0s2xrxo3no1lle livt (  rrm(  ou4tpe if3tldfa elumpn(0trermr3iy1op  lueils  rxr(o iydop  lfeia(fsrrr(rpnu4tpt  o3iysfa2um(mo;u4arerio3tadop ranvs s tetm(r3iydlm  lfei ( srrrur ;o4oltomfeiad m2el(mon(4altrmo3oa1fmD ln sl( srxoimpnu1lp emnvtl()a2trxmpou4tetomfeiad m ran ont)arxomrctadfpDelueo;()texo(o3iudlmeemicia()a2umxrp;u1olxo f3iatfaDea( p;(4texnxo oydfp r i o;( srtm(m3iodape lfctatfa2rrxront4tex  i3tld sDel( p;t)treomrcoytlatrlnvi s)s2to(m oudlpe mfcslt)sDtaxmpoo0optomieiatlm2rmuvs u)altrmf3iydomtr u i t0truoir oo4lp n feslsf 2ua(mooo0tpeo ociat a2rlnmp t0 lenio3ootoaD  neols)seumim3ou4op nmnvils srtrxm ;t4olxo o3iydlmDulnmo;(0tltomf ty1lp raieo s)setmxm3oydomenlfetlt) rurxmont1teenmoetatfm uauvs;t)tltoxoctodlmDean s s)s2ur(r oy1omt  ictat) rrr(mo;u4tetnmocils m elnmp (4tetrxo3ia1lptrlnvs s) 2uoiopiy1op   nesa(fsDtax  ;u1oet iicias m eaumo;(0 ltnxf3oatomD an o;(0 2xm(r iu4optemnes (  Dtr(m ou1altnmf3tytla eaumo t0trtomrciydomt lnvs t srtmimpio1olenlics s  rur(  ;u4aeeo oetls m rau p t) etnxr3iatlp elivo (0 exoimpoy1aptnmfvtasf 2uru pno1alenmociad s2ea(mpnt0 rtrmf oo1omD anvo;(0 2xm(opnu4ol nlfet ( s2tmumooo4tlen iciatfm umnvs (4aetrxr3ia1fatrau s;t0 2uoir oo1lm emiviltfs2rrurooo0aleo feiasla uauvs;(4tlenif3oydfa eaues () exm(rpoydope  nvtat) 2trxm ot1olxoiocilsfmDelump ()altnifcootlmteai o;s  etrim3iy4am   fcilt aDtmurpnt0aexnmoetaslmDrm(mo;u)trtoio3tytopteli sl( trxrxr ou4op n nci (f Dtrxm no4aexnii3iltla2ean snu)trtnxo3oodoa  ai s ( s2xoxo3ou4omenlneiat  rraxm ;t0tpeomf3ilt a2ra( o;t)altnmo3oa1oate uvs ( trtr(o ny1lp   ivs s s2rrxm ;u0tlenmiciys a uau pnu)tltoxo3to1lpt livol()srxrxopny1optelivtltf ruau ooo1apt mietytfaDeluvo t0teenxo3iodlm ean i t  eum(opou4ope micia(fsDtau  ou1texo ociydfs2umumo;t)tlxrir3ty1op rlues;t t2xo(o3nu4am   nes t)arumumoou4oee mfcildlmDua( on()tltnxfciotlpD auei;(0 rxmio3no1ol nlicils)a2tm(r nu4oexomoetltlaDeanmp u4arxrmf3oatfm rlneo;t t2ur(rpnudomeemfviltfa2ua(mpoo4tleomo3iat aDran sn(0trxomr3iotfm  aueo t  eto(o iu4omeelivsa() 2ta(  ot1openmf3iytlmDulump;u0 rxnir3ia1fm rln sls)tetoio no1opt lfci t srtr(r oo4texo ictadfm ua(ms;t)tetrxo todoatraneo () rtmiopno1omtelivt s  Dta(root1opxoii3iydfa2emnms;t0trtrif oodfmteauvi;t0 etr(m nydlme mfes tf rumu pou1teto i3iys aDel(vonu0aexoif3oydfmDrliei;t0trxoxo no4alte fetl(fa2raump;u1tle ioeiad mDranvsnu4arenmo oodlm elues;s0s2xoio3nu1omtn icsa(f ruaum no4opxnmi3tldfs2umnmp u)aetrif3iatoat luei;s t2ur(mpiu1am n fci s arrax pno4apxo fciltlsDumumont4 rxrio3totoa rai i (0 etm(r iu1lm emfei sfs2tmx o;o0tpto ociatlaDumnvpnt4tlxrmr ta1lmte uvs (0 rurim oo4lmtelnetat) rtaxmont4alto oeiad a uluvs;t) exomfcia1lm  ai sls srxmir3nu4omt  iet ()sDtrxm nu0tpxnmfciat m2ra(vs u0artnmo3todomDr ieo (0texmimpiodol   ieilsfa2rr( pou0texo o3iad a um(vp u) eerif iytopt  neo;()s2umxm3iy4lm  lfetlsf rum(ronu1aeenmi3tyd s emumpnu0 etomo iatla  aiei;s)trtr(r3oodap e nvtls aDuaxrpnt4opeo o3tydlmDulums;u0tetomrcto1la   i i t0texrxr iudlp n fcias  2tru pnu0oet mieiydlaDrm(vo u0texoxr ty1fmD lnvi;t s2tmir3ny1amen fesat s2tmur nu1tetnmociytlm2ra( sn(0 rxrxfcio1lmD lu s;t0texr(o3oodopeemfvt t a2ua(m ;o1apx iietasfa ul( o;u0tetrif tatlmteaieolt0 etmxopoudale lics s)a2trumpnt0texn f3iysfa rl(mo;t) etoxr3iatfm rln o;t trxo(o no4lp emfcsl( aDur(rpno1apxoioctyslmDranmo;u) ltoir ootlatr nvs s) etm(opno4alte fvias)srtru  ou1ole ioeiltfm um(vo u0 lermo todoptrau s;s0 exmim3no4altnmfvia() Dur(ronu1oleoiictat m rmu o u0texnxrcoodfpDe i s;( s2xmxopiydolen fesltfaruaurp;u1tlx  ieiatlsDuanvp ()tlxnif3tytomte iei;s0seum(r io4ol  lneiat) 2ua( o;o1alxo fctas m2uln sn(0 ltrir oadoatrln o;s)tetr(m oodome  nes tf 2raxmp;o0optn i3iyd a2ean o t0altnmr ia1oa rli s t) rxrim ny4om elfcs s)aDtm(  no4tet  oetls m2rmnmo;u) rxnmo3iotfaDrlnvils0teumir nu1optnlnetls)srtrx oou0aee moctytls elumsnt0arxoifciytlpD  nvs s  2toir3iodomtemnvta()srtrum nt4aet mi3iatls2umumo t4aetnmfcoydom  lu slt s2uoxmpnu1al elivtatfsDraxm ;u0tptomo3iyt a rlumonu4 ltoif3iatfmteln ols t2urxr3ny1lmen ics tfaDurxm nu1tpe  ocildfa2raumsn(4 leoxf oytfm rlivs;s teuoim no1op emnvsasf Dum(m ot4oetoioeildlm uau s u)tlxnir tatfatrlnes s t2xmxm3iydal  lfct ()srtr(rooo0tpeoio3tyslaDrlnvs t) etoxrcty1op eai sls0t2urxopny1lleelfci t) Dum(mooo1aex ioeiysfs eln p;u) exnmrctodopte n s s)srxmiopnudapenmivi ( aDraxm ot1alenmietldls eluvs;t4 rtomr tytlat luvol()s2xrxo iydlpt mncs t a2rau  nt4oet iocils m2uln s t) rxoxo iydfm  lnvo;t texmxr3nu1ome lietasfarrrum ;t4aexomo3iat aDrln p () etoxfcoo1opDrln o (  2xo(o ny1ame  ncsat s2um(ro;o0ale io3tldlsDeauvp u0trtoxfctatlp rln ilt trtmimpiy4omtelncsasf ruaum ;u1alen ietysla elu pnt0 rtnirciodlm eau slt0s2xmio iy1lleelfcsatfaDrmxro;u1tet mfeiad s ra(vo u)altoxf3to1lptrli ilt teto(rpiu4lp elivsatfarrmx  nu4oltnmociadfs umn o u0aetrmf oytla e ivo;s  exmxm3oydaltemieiatfa2raxrp;o0optnioctaslm umuvs;u0alenmfcoytfm  au i;t  2xrio3oudome lict tfaDtau ono1opt ioeias m2um(ms (0teeoxf ty1oaD auvsl(0 rxmxopnu1ll n ivsatfarur( p;o0aeeoii3tlt sDran ont0aeeoxo iydlateai o;s  etmir oydapee ivil()srrr(r ;u0tetn ieiadfsDel( s (4altnxfcio1fmtr uvol()setrirpoo1ol  lfeia()srtaxrono4tpxo fctldfaDuan pnt4aexnxo3tytlmDeaies s texrxo3nudlltelnetatfaDtmx o;o4aptnio3tydfmDulnvo u4aeerxr3ty1fateanei;s t2xr(o3nu4alte nci (faruaxr ;t4olto o3ilsls el(vs;(0 rerxo iytfmDrlivs;(0 rxmxmpiodaltemfei s srumumpnu1oleoii3ildfm rmuvp t) rxoio tydoa  lnvs;t  exrio oudlpeemfviatfs2tru onu0texn f3tysfa eau o;t)treoxf3todla  aneols  rxmxopno1lpe lneil(  ruaur ;o4tlxoiietad mDra(mp u0teeoir oo1omteau i;s) 2uo(m3oo1lp nlietlsfsrtax  ou4tee  i3ilt sDua( s () exrxrcoodfmDrai o;s0teumxm oodll nlfei tfa2uru pot0alxn i3tys s eaumon()tlxrxo3oydfptrliei (0trumir nudop eliesas) Drrumo;u1oeeo ocildlsDrmuvont0arxnmfcia1fm elnes;()srtmxm no1am n ivs t)a2rrxrp;t4tpx  iciadlaDum(vo;(4 rxrxo3ia1fmD auvi ( teum(opiu1lmee ivias  ruax o;t0oex iociad sDraumsnt0artomr3iadlpD aieils0trxmiopiydlptelfetas  Drmxmp;u1optoioctadlm2eanvsnu4alxrio3ty1fmDrlivo s)texrirpiydol  mivslsfs2tm(m oo0apx  ietlsfmDumumo ()aexnircty1lmt lueilt0 2xmiopoo1om   nvils  rur( oot4tpxnmfeiytla ul( onu4 leoioctadlptrli sls0s2xm(o io1lleemictlt)s2umxmp;u0aeeniociysls2eanvon()arermfcoytfaD  n i t texrxo3oo1lm  livta(faDum( oot4alt micias a ua(vpnu) rtnmfcoa1fp   ieo s)trxrir3iy4am e net tfaDta(rpno1tetn i3iydfmDrl(mo;u4 eerxo oytfp ean s;(0 rum(r3nudlme lnviatfsrumxro;u1tee iieiasls rlu p;u0artoir3iatop ean i s) 2umxopio1llt lfcia(fsrraum ;u0opeoiieiytfa eln o;t0tleoircty1opDelneil(0srumio3nudlpt  ictl(fsrumump;o0optoiiciysfm eanmp;u0trxoiocio1fm  livslt0teto(m3iy1lme  feslt  Dta( pno0texomictat a2rmnvs;u0areomociodfa   ivs ( t2trim3ou4ol   feilsfa2um( o;u4oee  o3tasfsDuaums;u4aexnxo ty1omtrlivo ()srtrir3nu4lltemfetl( aDtaurp;o0opto feiys a rmu o;()arxrmf3iytfpDrli i s  2ur(m io4alen fesls a2um(r no0tlxo i3iydfm2ea(mo;(0 rtrxociotopt  u i;t  2um(opiydapeelivsl(  rrrx  nu4tlxnifcilsfa uan pn(0 lenxrctotlp rau olt0tetrim iydalee nvia(fa2rr(mo;o0olt mf3iasfs2elump (4trerifctydlm elnei t) rtoxm3iu4lmen fctl(fsDtmump;u4tltnioeiat m2ulu snu0 lxnxo3io1la  livs (0setrim iu4lmte icia()s2umumo;o0tlx mietysla2ua(vsnt) eermrctytlmD aivo ( truo(mpnu4lmt  nes t)s2ta(r ;t0tpto octasla2um(msnu4aleomfcoydomtelnes (  2xm(mpiydom e ivs (f rrmxmpnt0apx mieildfs rluvsnu4tlenxrciatoa eanei;t0teuoxr iydol n ivtlt artm(  no1oltn oeiat aDrl(vp () rtrif3oo1faD auvs s)trto(r3iu4om  mfesls a2tmu  oo4oee  f3tat sDra(msnu0areomo ty1oa eanei t  rtoxr3iudlleemivtlt) rurum no1tetnmiciatfm2rl( s t4arxrmr3iodopte neols0teum(r iodal  mfetls  2trx  ;u0apt  fciyt m2rm( pnt)tleoxrctatlpD  nvol()teuoimpnodlp nlivi tfaDua( oou4aeeniiciltlsDulnmpnt) renio tytfmtean i;s)trxr(r3nydoptnlnvia(fsrtm(mp;o0alxnifctldla emnmpn()tltnir oytomDr n s t)srurimpnydalen ivi t aDuru onu1altnmi3tlsfsDrl( pn(4 lerif3tadlmD livs;t)t2xoxo3iydape  ncil()sDua(mo;o1olx mi3ildfa uluvpn(0tlxrxr to1lp e nvi (  exmxopiudlmenmfei () 2umx pot0optomictadlm2em(vpn(0tetoio3to1faDeaieo (  etmxopny1lltnlietat)sDra(rono0tltnmfeilslm2emump;u) etnio ty1oa rau s s)sexoxr iy4lpt lncs sfaDta(rpoo4oexnifeiysfs2ulnmp;u4trtomo tytlmD aueo;t)s2ur(o3nu1lmenmnvta(f rtrxronu4aet mi3iltls2rlnmon()altnxr iadopt ai o;() 2trirpoudameemfcta(fsrrmxm ;t0tptn oeiadfsDeanmp t)aexrio3tydfateaueil( t2tm(rpiy1lmtelfcsat a2trx  ot1olto iciysfm eanvsnu0arxrxfciytfpDe neo ()s2uoxo3nydamtnlfvt sfsrta(m nu0altn feildlm em(vo;u0 rxoxrcto1optelu s t s2xmio nu1amt lfetatfsrrrumpoo0olxo ocildfm eauvp u0aeerif ty1fa elnvols) 2xriopou1lm emivta()sDum(rpnt4altn i3tltlm rmumo;u4arxomo3todfm eaneslt)trxm(rpno4am  mfeil(fs2rr(m no0aetnmociaslm2rluvpn(4 ltrif3totoat lnvs;t) 2tm(m iudape mfvi t) 2ur(rpnt1alenmo3iad aDuan o;t0trtoxo ty1opDelnvo t sruoir io1apee neias aDrm(  ;t4alxomf3tatlaDul(mp t4alxnif ootomtrluvi s)s2umxo3iu1op nmfcilsfaDuaxrono1texn ictasfa2rl(vsnt4aexrxf oatoaDe ivs;s  2um(o nu4opt  fvtl(faDrax  ;u1tlxoii3iatla2el(vsn(0tltrxr tatfateln o s0trtrimpoo1alte iesl() Duru o;o1ope if3tatfmDumn p u0 exnmo3oy1fpD au o;()s2urxrpno4op   neil()arrm(mpnu4oleoiicildfa um( ont) rxrmo iytopt lnei;(0trxoxm3oy1lmtn iet t aDra(mp;o4aetomo3iytfaDumnvont4aexrxo3ootlm rlieo s  eumxmpou4al emncilsf rrrurp;t4olx  octyslmDemumon(0 eeoxf3oatfpt  uvil( texm(m iu4lmee nvtl(  rrmu oot1olenii3taslaDemu s;(4teerio oa1fmtelu sls)srumxopno4open fcs (  rurumpou1open i3iyslm eanvo u4texoio3oydfm   ueilt trur(mpoy4lm  lfctlt  2ua(mpnu0aleniieildls emuvo u0artrxf oytop rliei t)s2xmxo nu4ap elivs s)a2umxro;o4aleo f3iltfm2umn p t)tlxrmfciy1lmD lues;(0trtmir3iu4om e fcil(  Duaxrpoo4tetoio3ilslm2ua(vp t4 leoxoctatlmteluvols texmxm iu1altn fci (fsDraxroou1aex mi3tat m2um( s;t4 rtrif3todfpte iesl( srtrxr iu1al nlictat sDtrumo;t0ope  i3iat mDuln ont0teeoif3oa1op  livslt sexrio iy4amenmfctat srrm(r nt0tle mo3iat m ea(mo (0 reoxo oy1latrln i;(0s2tmim ou1opee nvi t aDtrurono1aeenmoeilt mDemn o;t0 exnxo todfat  ies (0srxmxr3iu4lmtnmicia()a2ua( ooo4olenmfciat m2ua(mont4altnmo3oy1fm r n o;s0truoxopoydll   ivtatfsDrm(moou4texo feiydfs emnvo u4 exomrciatlm  li s ()tetoirpoydoltnmnvtlt)srur(mono1teenmfctytfm2umnmp;(4artnmrciadopDeluvsl(  etoxmpiodlltemivt s a2rmumono4oexn f3tld s2rln p;t0texrmf to1lp eluei t0tetrio3iodom  mfvias) 2urxmoot0tpenifciasfsDranvp;t4 eeoxociytfpt  i ol(0trxrim3io1ale  feiat  Dtau  no1oex io3iltfa2rm( p ()alxrmr3iydlpt livs (  ruoimpiudameelici () rrrxrpot1oet mfeiatfmDelnvpn()arxrir ty1la e iei;t setrxopiudll   feias  Dururo;o0apxnmfeildfs2rmump (4arxoio tytopDr u o s0trtr(m3nu1omen net tf Durxrpoo1aexo octldfm2rmnvs t) rxoirciytlm   ues;s)srtoio3iy4lp emicils)s2umump;t1aeto ictld mDua(vo;(4 etoxrcoy1la elues s)sexmxmpnodlpt  ieiat sDum( oou4teeomoetldfs2rmnmp t0trenxr3oy1lmtelnvo;() rxrxm oydlmt  ncs s  2ua(r ;o0oltnmf3iys s2ulu s;t0 exrircoa1oatrauvs;( texoxr io4lme livslt a2tr( p;t4texn iciydls el(mp;t)aetoxf3iatfmtrauei;t texr(opio4amtnlfetl( s2tau pnu4teenmociltfaDuanmsnu4aleniociy1oa r n o t)s2xrxr3oy4lpen nvtasfaDumuroot0olx  octysfs2rmnms;t4alenxocoy1oaDeliei;()texoxm iy1ale  fviltfsrrm(mp;o4teeo fcils a umumo u4 reomf tadlaDe i s;t s2umxmpoo1alenmfci ( s2umur ;t0apeomfetadfaDraums u)trenmf ia1fpDeanes;t trxr(opiydll emfcsltfaDraxrp;t4teeomoctysfaDel(mon()artnxfciotom   ivilt0srumim iudlpe mnvi t sDtm( pno1apt  ietydfmDumnmp t)teeriocootlmD aiei;t)s2tm(mpnydop  lnvilsf Dtru o;o0aetnmieiytfs2rm(vp u) rxomr3oadfate ivils  exoxo3ny4op  lnesa( arurumpot4oee mo3iasfmDrlumo;t0 rxnioctodomte nvs;(0srurim iy1ame lict sfarua( pno0aptnmf3iytlsDra(vs;()tlxnmrciatlp elnvi;t  etmim3nudop  mics ()arur(moot0apxomfeiys m2ea( o;()trxrio iydlatelneils  2urxopoo1ole lnci ()sDum(rpnu1texnmi3iysfm ra(mp u0aetnir3iodlaD  n s;t0seuo(m io4al emfciat  Dumxm ou4oet  f3iatfa2rlnvonu0trxrxr3to1opD livol() rtrxm3nu1omee nvtlt) 2rrxrpou4oeenif3tls aDeauvp;t0 rtrmf3io1lpt aiei;s seum(m oy1lltnmnesa(  rurxmpno0tpxomfeiysfa um(ms;u4 eerio to1omt  nvs ()sexmxopoo1am e ietat)sDtrxr nu0ape  i3iydla2rmumo u4altnxf3iatlateauvols0 rurirpno1omtnlfvils  Drmxmpno4aexo ieiytls ul( o (0aleoxrctydoa eaivol(0 rurir3ny4aptnlnei ( s2tm(mp;u4oeen oeiys sDrauvpnt0tlxnxfcoodfat  nvi t)sruoxm iudol   fetl( srtmuront0tpeoii3iyd m2emn pn(0texriociy1fm   uvi;s s2ur(r3oudol nmicilt a2rau p;o1ale mfetatlsDuanvs;t)trerxo tydfm ranvo t)tetmimpnu4amt  fes s  rum(r nt1tet mociatfmDum( pnt)tltnioctydfaD auvolt0 euo(opnu4amte fci sfaDuax pot4texo o3iysls uan s;(0tltnmf3oydlptrauvo;( texoim ou1omeemnei s artaxmont0olenmi3tyt s2rmu onu)aetnxo tydoa   ivil(0t2xr(mpiu4olt mneiat sDrm(  nu1tpenioeildfa2ra( s t4aeerif3oa1oatraneo s)srxrxo3oy1al  liesas  Dtr(mooo4aexoiieilslaDel(mp;(0 rxoio3oatoaDr u s (0seto(r3io1altemfet s) Dtaurp;u0aet ifciltlmDuanmp () rxoirciotlm   n ils)seurxo3oo1llt lfeslsfsDra(roou1olxomoeiltls2emu on(4 lenir oatlpDeaieilt srum(mpou4ap elnvias) rra(m oo1teeoiicils mDul(mp ()areriocoytfpt lu sl()texoir iy1alen ncs () rra(rpno4tpen octatlaDelnmp u0trenxrcoytoptelnvs;s setoxmpnudomt lfvi s aDtmu onu1tlenmfeils s2rmn p;t)tlxnio oadoatraieol(  rxo(m3ou4ap  mivi (  Drax o;t1oetoiociltfa2uaumo;u4 etniociydfm  auesls  2tmxr no4op n net t  2ur(rp;o0apxn fetadla uln o;(4 etnmfcoytopDrai i;()teurio nudapeemnctltfsDrmum nu4oeen f3iydfs eanvp u) lenio3todfp e ieols0s2uo(mpny1oltemicta( sDrrxrpot0texniictltfsDrau p;u) exnxo oatlaD ln s;()s2toxo nodomenmfes s)aDrrx ooo0aeenmictys s uaumsn(4treriociytopt  ivs (0t2uoxr3oudop nlnvil()sDtrumpnu4tpt iieild m ua(vsn(0arxrmo iadoaDeanvilt) rtmxopiydomenlieia()s2taumpot0tet mo3ilsla2ul( o;() lenmo3ia1fpDrai i;t0srtoxmpnu4ameemivsasf rra(monu1oltomoctyt m ua( pn(4texoif3io1fpt lnvo s0t2xmir io4amt lncil( arrmxr ou1tlto f3tltlsDea( s u)teeoxrciadoa elnvo s0trurxrpio4optemnesls)aDtrur ot4teeniociytlsDumnvo;(4 eerir3tydfmDrlu ils trtoiopnu4amt  nesat) rraumpot0tpe  ietydfaDel(vp t)artoxo3iydfmDrlivs;s sexmio3nudllenmfvi s  rum(mont1tlxniieiydfm2elnms u4 lxnmociytop   nvsl() euo(opny1lpe micslt s2ur(mpot1oet ifciltla ean ont) lerio io1lat li o;s)teuoxmpiodamee ivtltfs2tmurooo1tle iietlsls2ul( onu)teerif3ta1omDranvsls trxr(mpou4opt mnviltf Dtmxrooo1open fciad s elu p;(4artoxr oadopD  uvi;( s2tmxm3ou1lpte fcs s) rtr( pot4oexn i3ild mDrln s;t4tltnir oatlm  au i t)teurxm3nu1op   fei s a2ua(mpot1tlen o3iyd mDranvont) lenmo3oodom elu ols0 exrxr nu4am   netatfsDua( poo4alxnifcildfs ra( o;(4trxrmo oy1lmt auvo;()t2trim ny4lp  mnci (  Dtmx  ;o0aetniociysfaDrl( o u4areoxr iotfmDraies t) rto(r3io4op  lies (faDrmu o;u1aleo octyt a rau pnt4altoxr3oy1lpt liei t) etrir3nudopeemieilsfartm(m ;u4olx iociydls2uanvs;t4arxoif3ta1fm   ivsls  2umxr io4om   icta()aDuaxmpou4ope moeiyt s raumsn() rerio3oodfpD aivslt sruo(r3oy1lmt  icils)aDrruront4aexniieils s2um(vo;t4 eeomf3oadlaDrlneol(0setm(m3ny4lm  lfesl( arrax o;o4opt io3tltlm2ua(vsn(0 exomr3ta1fmt  iesl()tetmxo3oy1lpe lncta()sDum(m ot0tlx iicildlaDrau s;(4 lermf iodomD livi () 2urxm nydoltelfvslt sDuaxm nt4oetnif3tyd a uluvo;t0tleoioctotop   u i;t)srxrio oy1lp   nvs sfaDrm(r oo4altn o3tadfmDemnvo t4 rerxr3tatoaDeluvsl( srto(r3oy4amtn ivt sf rrauroou0texomo3iadlaDelnvsn() rtrxfctatfat  nei;( texoim io1am nmfesat)sDrmxmooo0tpxomo3ildla raumonu4aetoxrcootop  luvo s t2xmxm ny4olenlfcilsfs2tau  ou4alt mociysfs2uaums;u)treoif3oo1fptr nei;() 2uoirpou4lmtn fcsltfsDumu ooo4tex mfcildlm2rluvp;t)trtrxrcoodlm  au s;(0trtm(rpnu1op   ictat  2rm(mp;t0ape moetad s uau p;(4trxrio3tytoptraues s t2xmxo3io4al  mnvta()arrmxmooo1olt iieiysfa emu pnt0altnmf3oy1opDeaueil()tetoio nydoptnmfet sfarra(moot4ape mi3iaslsDuluvs;t0tlerioctodlpDe neslt  eum(opiu1opeelnesl(fs2uru pno4oeeomieiad m2um(mp u4 eerif todfa e n i ( texmxr3no1apte fvs t  2tmxr ot4oet  f3iatfaDelnvs u)artrxr iadfp  lu ilt) rumirpnu1lm n nei sfa2trxrp;o0tee  ictydfsDuan p (4aexnir tydfaDrau s s)teum(rpoy4ole mfes (fartmur nu4tleomf3iys aDeaump ()trtnmf iotlmDeliei s  2xrimpoy1ameelivi s aDrrxmooo0tle moctytfaDrlnmp;u4artnif ia1oaDeaueslt) rtriopoo1amen nci ( a2rauro;u1teenmiciatlm2em(vp;t)teeomr oa1laDrlieo;s sruoxm iu4al   nvsas  Drm( ono0tlt  fetldls2ea(vp u) rtoxociydlmDeanvil(0sexoimpiy4om emiviatfa2trx ooo4tltn ieiys m2ea(vs;t4texoxo oytlm rlies;s)s2xoxo ny4openmnci s aDuauront4oexomieiasla2ra( ont)aexrxf to1fpt  neo t) etoim oo1lm n feslsfaDua(m ot1aptomoeiysfs ea(msnt0 reoifcoydfat  uvol(  rtmxr no4amenmivs (f Dumxrpot1oetoiociatlsDulnvonu)alermfctytlp rln s;s trtrimpnu4llt lici sfs2ua(r ot4texnmieiysfa uluvo (4 ltrircoodfaDeau ols0 2urxo nu1omenlfcsl()sDtmx o;u0aetoifeilt sDuau s;t4teenmr iydfmDeaneol(0srxmxopio4lltnmfcsat  Durx ono1aetnioeilsls rauvs;t0aetoxf io1fp   ieolt)trum(mpnydllte nct t) rtr(moou1tetnmo3tltls rau p t0artrxrctydlptr n s;s)srxmxo3no1optnmfvsl(fsrtr(ro;t0olt mi3iytlaDeln pnt0texnir tatoa rauvilt s2urirpiy1altemivsltfaDtaxm no0alxniieiyt a eanmp u) ltnio3totfatrln o ()srurxrpnodop e nci tf 2um(  ;t1olxnmf3tlsfm2ulumo t)aleoifctotomt liei s  rurio3iu4lpte ieta()sruru ono0tee  f3iasfsDranvo t4aleomo3oa1opDelieslt0trtriopny4lleemfcil( arraurpou4openmociydls uau s t0texrxr3oy1optr nvo t0 2ur(m3ny1llee nvs (f 2rmxmo;o0apt  fciatfm rl( snu)trtnxf3totlp e ueilt)seto(rpiu4ol  lncs ( arur(mooo1opeo fctld m elnmpnt4trxrxf oytfp elneo;()srtrxm3ou1om  lnvtl() 2rru o;o1apx ifctaslmDeau o u0alenxr3oa1lp  livo s)sexm(r oo4al n fvta( srtr(m nt1aetomoeiydls el( s;t0alxnmrcty1latrluei t0seuoir3oodoltnmfvslt  rurx  nu4ole mi3tlsfmDulnmo;(4 lenif3oydlpD lu o;t  rtrimpno1alte ivt t) ruau  oo1alenioetltfm2eaumpnt)tlxnmo ootomDraneo;t)srxmxr oy4amt  ivtas)sDumx  ;o0aetniocils mDul(vsn(4aexnxf3totomtean s;s) etoirpiy1amtn ieils  Duru pou4aexniietltlmDea(vonu0tltnxf3oy1latr uvi;t sexrxr3iu4amt mncia(farumu o;u1oleomictlsfm2ranvs;(0aetniocta1fp e ueo t) rtoxo3oy1ll  mnet ( aDtruro;o0tptn fciytfa2uan p;t0tltnifctotfat  ivi ()t2um(r ou4lpt lnvtasfa2um( pot4olxniociadlm2emn s;u0aexrxf oo1faD ln s;s) rtmxo ny1lle lnvsa() 2um(mont1opxnmicils a2ulums;t)aeenmf tatfpDr ueo t0 2umxo3oo4lpeemfeiat s2ta(m ;o4alxnmociat s2rl(ms u4alxomocoo1fmt lues;t)trtmxm3iy4lpee ivtlt  rtmurpou4tpxoifctyt m2eaump;u4tlenmocio1fm  lneo ( texoir nu1ale  ivtat) Dta(mo;u1olen i3iysla2eln pnt)alxoiociadomte ivslt  2uoio3io1aptnmiciat sDurx  ;t1alxomo3ils s em(msnt4 exrxfctydoa rln o s t2xoxmpno4amen fcil()srtmxm ou4tltn iciad s2el(vonu4tltomf oa1opDranvolt  rur(r iy1omt  ietasfa2ta(monu1oee  fctls s2uaumo;(0teenmocoodfa e nvsls srtmxrpou4aleemietlt sDuru o;o4oexo octasfsDem(vpnu4aexoif3oadfaDeau o t0 euoxrpnydlp e fvilt artmum ot1aet  fetas a uan o;t) exrmo3io1omDr ueo;s)tetrxrpny1lmeemictlt s2ra(mo;t0oeeo ociat sDranvo u0 leoxo3iydfpD  i s s)trxoiopiy1apeelfvsls)aDrmxm ou0tlxoioetatlaDranmpn() reoxr3oodla r u sls) exriopoudlmte fctlt aDuru pot4tlto f3iys a umn s;u4 ltoir3tytoatran s;s0srxrxm oudol nlfvtas sDtmum ou1tlt mi3tls a2uau pnt0 rxnif3oytlmtrlneols0s2trxopio1op emnet ()arrmumo;u4tpx mi3tyd m elump t)alenxr iodfpte uvil()srxmim ny4apte ncilt a2um(  oo1openii3ild m2rl(mon()trxoxoctatlp   ieo;t)s2umiopoodomen fvt (f Dtr(ro;o1openmietasfa elnvs;u4tleoxf tydlm r n o () 2to(mpny4lmtemncs s aDur( o;o1ope  f3tydfaDemnvp (4tltnif io1oat ln sl()t2tmxo nu1ll  mnei s)aruax  nu1apeniiciasfa uauvp;()aetnxocoo1fptrlneo s)srum(o ou1ale lieta()s2ra(r oo4tlt micias s2uau s;u0tlxoirctatlaDr ies (0trurimpny4llee ncsl()sDrrurpnt0oexn icild s2el( pn(4trerxf ta1opD aivo s0 ruoirpny1alenlfctasf rtr(rp;o1tpt iocils mDuluvs;u4 exnmo3to1fmt  u olt texo(r iy1olenlfetltf 2uaxro;t0tetnifciadfsDrm( o;t4 rtnmr iodlpDraues;(0 rumio3iudlmtnlncsat a2urum ;u0oeto iciltla rauvo;t4 reoif3tydfp   ivo;(0 rxoio oy1lp nmfvil( sDuaxr no4apto ociys sDuauvs u0 rtnxo3iydomt ai olt t2to(m3nodam nmfeils s2tmumpnt0olx mo3tad aDul(mont4 rtnmr3iatlmDelieilt) exo(m3oydllee fetl(fa2rrxmont4oexoioetytfa emu onu) etrio3iotlateluvil( setmxm3oydalenmici s sDtr( pnt4ope mi3iyt m rl( snu)aeerxrcoa1oaD aivo ()s2ur(o oo1opt mivtas)a2raum nu4tetoioeiltls emn onu0aeerir oatfp  livolt srxoxr nydal  lfeias) Duru pou1openif3iatlsDum( p;()alerxf3todopDraiei t)trumim nu1oleelfetasfsrur(mp;u0alen ictadfs2ranmp;t) etnmo iy1fm   ueols  rto(r nu1ole lfes ( sDtmu pou1alt  feiydfm2rlnvp;u) eenmrciy1fa eai i;()srurim io4ope licsl( a2ta(  nt4aet ioctasfsDrl(msn(4 ltrio iadlate ueil()srtr(r3no1olte ietltfa2umx ono1aeeomfctydlaDumu s t)aetomfciotlmD aies t teum(r3nu1olt mfvi s)srrr( oot0tptn i3ilsfm2eanvont4aeenmr tadfpteau ol( sexr(r3nodlpt  nctat artmump;o1alto feiatlaDrauvont4areoirciytlatrau i;s t2xr(o oy4al emicilsfsrtax  ;u0altnifciatfaDrmnvsn(4alxoxo3iodlaDraieils) rxoir no4aleelnvsas  rtru p;t1opeo fciys s2uln s t0altrmoctotlmtrluvo;s0seurxo3nudlptelfvsas) Dtm( p;u0oltomoeiltla2uluvs u)treomo3iytlateai o;t0teum(o iodal n ics t) Dur(rono4tleniicils a2rlnmsnt0aeeomrcio1oaDeli o;t0sexr(o3ny4omt  fet ()artmumonu0tet  feiat a rln s;()tltrxrctatfmDraueil()srxoxm nu1omtnlicsasfsDra(m no0apx  i3iydlsDrm(vs u0trxomociatlmte uei ( srtr(o3ny1opee fcsas s2rax poo1tpeomoctlsfsDrl(vo ()tlxoif totlatrln i;s  eumxmpou1altemivs (f rumxr oo0tet iiciydfaDemn onu0tetrxf tydlpteau s;s seumir no1om  lnci s)aDumumpot1tet ii3iyt aDuauvo;(0trxnxf3iatlate neil( trtrxmpou1lpt mnet (  Dtrxrpno1tltn i3tydls2ra(vs;u4 ltoxf iatoate u olt  rxoirpiydam nlfctlsfaDrrxroou1tpenmfeiat s ua(vp;t4aetnmocoadlptrln o;( teto(rpou4oleemfvs s)s2rr(root0oeeo f3ild a ua(vo;t4aleoif iydomDeaieilt s2uoxo3ou4lm  lnctlt)aDraxrp;t4aee if3ilsfa2emn o u4alxnmf ta1lpt  nei s)t2trir nudape mici t)arurx pou0ape moctyt sDua(mp;(4aetnxoctytlmtran s (0srumir oy4amt mfvs s  Durur nt4tpen fetat s uanmp t)alerxr totfpDrli olt0trtrxm nydllen nvt t  2taxm no4aee mf3tadfmDemn on(0arxnmfctodfa  livi;() 2xoxm3iu4lp e ivtat)srtmu  ot0altnii3tydfm rmu pnu0aeeoiocoy1latr ivo;t) 2urxo3nydlm  licslsf 2rmu  nu0tpenmoeilsla uanvsnu0teermr3ootoa rlivo t seuoxo3ny1olte fet s  2rm(  nt1aetomi3ilsfs rlumon() rxrxfcoadfmDeln s s)seuo(r no4opt  ictas  2rr(  ou1aeto i3ildlm em( onu4aexnmf3oy1fptrluvo t s2xoxo3oudlm elnctlt artaumpot1tleoioctasls el(vs u4trxrxo tadfpteaivi;( s2umimpno1ameeliciasfaDra( p;o4tex io3tld s2rl(ms u4alxomf iydfm elueol( seurxopiu4lmt lieilt) 2raxmp;o4tpx mocilslm ea( s u) eeomf totlmDeau i;s0srxrxr3io4optnmfctas sDtrur ou1aptn i3ilsla2uanvs;u0trxoxo3oytopD  ieils)trtoxr ny1lp  mfcsl(fsruau  nt1oltomictasfm2ea(vp;t)trerif3iy1fm ranvol(0 euo(r oy4amtelfcs sfaDrrx pno0apt iietatfs rau o;()alxrxocootfp   nvi;()t2xmxopno1ole lnctlt)s2taxmonu1tee ifeias m em( onu0arxrifciy1op  luesls)s2ur(o oo1oltn fcsltf rururpoo0oeeo i3tydlsDemump t)trtnio3tydlp rlnes s) 2xmirpoy1oltelivil(fsDur( pnu1tee moetys m ea(vpnu0 rtnifcoy1lmt lnvo;t0t2umxr nu4ome mieil()arua(mooo1ole moetysfs ua(ms;u0 reoxrctytla  auvo ( texmxr iudlme lfvils) 2tax  no1tpen oeiatls2rmnmonu4 etrxo3iatomte ivi t0s2urim oydlltnmnei tfsruaxro;u1tleomo3ildfsDemuvo;t0 eeomf3ta1oaDr ivils0trtoir3iy4lp   neta() Drrxmpoo1tpxo ieiyslmDum(vp;u0 etrxrciotfate nvs s trurxr3oo4opt lfvtlt aruax  ;u0apto icils m2uau s (0aetnmo totop  aues;t)t2toxrpiy1am emneiltfa2uaum ;o4aptniociatlsDrluvs;t0tetnxf3ty1omD ln il( teuoiopoydoltn feslt aDtrumono1apxnmo3iytfm2ranms;u) exnmoctydfaDeli i s) 2tr(o oodoltelneils) Drmxronu1aeeo ociyt aDumn s t0tleoxf3ty1fate ivo t)trxm(m nu1ome micslsfaDtaxm ot4apeomi3tatlm2ua( p u0tetnxr3io1oatean i t srxo(m no4om e fvsa(  2trxmo;t1tpto ictyd s2rluvp;(4arxnir oydfmte uvi;s0 2xoim3ou1ol elies t)sDrr(rpnt4tpe ii3iatfs eau o (0 eeoif iy1omDeanvi;t t2uo(mpiy4ap nmivil()aDtax p;o1ale ifeiys m2rmums (4texrmocto1oa e u sls) etmxopio1opt mneilt a2raxrpou4aeenifeiyt s2rauvo u0texoif oatfm rlnvi s)teurxo nodaptnmfctlsfaDtaxrooo1oetn fcild a2emuvo t)trtrircoatomt  ueo;t trxr(o no1omenlnct () Dururpno4alx mf3iltfa ua(msnu0aetnio tatlm e neo s)s2uoxrpio1ap   ictl(fsDrm(  ot0oltnii3ild s em(vpnt0 rtoifctatfaD  u ols sexoxm3io4amt miesls aDtmumooo1aeeoio3iatfm ulnvsnt4aexnir oytomt  uvs;(0srxmxopiydap  mnvi t  rra( p;o1tlxnif3ias aDuauvp u4 lxrif to1faDeaivil(  2to(r io1lle mfvi (f 2urx onu4ole  oeilsfm2ua( s;u4 eenir to1fm  auei t)sexrim nydapenmict s)s2taur ;t4oee ifctydlsDem(mo;(0 eenif ia1opteauvo (  rtoxrpoo4altemiei ( a2rm(  ou1tlxnif3tas sDuanmo;(4aexoxr ia1lm  auesls teur(o3iy4omtelietltfa2tru o;t0oex  i3ilt m rm(vs;u4tltnxf oodoat luvi t) 2toir3no4op e nesa( aDurxrp;o0aexo ociadls2rlu p;u4aetoxo oo1lm e nvo ()sexrxrpoudll n fvslt  Draurooo4tlxnmi3iatls ranvs t)aexomo oatlaD luvsls)s2xr(rpnu1om elnct sf rur(rp;o1tlxoifeiltfm2rlnms;u4 rtnif ootomtelueils0srxmimpoodlmeemfvs t  2tmu pnu1tetn ieiytlsDulnmo t4 rtoxocio1fp r ivo;t)trtrxo3oy1lp emfct sfarum(roou1aptoioctls s2eanvsnt)aetnxo iodlmtraieo (  2xriopoydamtn ncsl()artm(mpno1olxoifciad mDran o;u)altoif oatlm   u ils0 2toxopnu1lm nlncsas artaxrpnt1alto ietlsfm2ra(vp t0tlerxr3ia1fmD aieo t)trurxmpiy1oltelfetat artax pou1apen i3iltlsDeluvonu4 etrio tytlm raivi;t) rxoimpiudam e netlt)a2tmx poo0apto i3tysfs raumpnt4aeenif3ootlpDe nei;s truoxm3ny1lpee feslt)sDur(mp;o0oetnmfeiat m uanmsn(4 lxnif3iy1fptelivi ()t2um(o ny1ameelieias) 2um(mooo1aeen o3ilsfs2um(mo;u4 rxoio3ta1la rlivi s0 rxr(mpiy4oleelieias)a2raum nu0opxnioctadls2raumpn() eeoxo oa1oa rliesls sexrim3oydomenmnvt s srraur ;t0tetnmi3iasfm2elnvs (4 reoircoatfmte n il(0trur(r3iodolt  nctl() Dumxm ;u1oeeomoetasfm2ul( p t)artrxf3tadfat  n i;s)texoio3ny1omte ivs (f rum(ro;o0tpto f3iysfm rmnms;u0 rxnxr iy1omD  u i s0srxrir3nodop nmncil(fs2raurpou1aeeo fcild a ra( p t4altnio oa1laDeau o (0 rxr(mpoydal nmfctat)a2rrxrpou0olxnioctysfa uln s t)trenmr ootfate u i;t t2uoiopio4lpee icils  Dtm(r ;t4apt  fciatfa2um(ms;(4trenif3totomtraiei;s)srtm(opiy4ale  ncils) 2uaxmpnu0alxoiicildls em(ms;u0tlerir3tydoa rauvols0seum(o3iy4lpen fciasfartaxro;u0tltomf3tat m2em(vonu0trxrmo3iodoptraiei t0 rxoim nu4ape  neia()srrm( o;u1aetnmiciytfsDumuvpnu)aetrxr3iy1oa elu i t) 2xriopno1ll  mfeslsfsDurumpnu1tlenmo3iytla2emnvs;(0 rxrxociodop eaneo;t  eur(rpou1ol nlfvilt s2ta(roou1aeen icildlaDum(vs t) etomo3io1opD auvolt0trto(opiudlmt mnctl() Duru  ;u1ale iietat s um(mp t) lerxf iydoa e uvo s)teuoxo3nu1oleemnesas)a2ua(mooo0alt mfctld aDulnmo;t0 ltrio iadopDeli sls) rto(mpny4lltelivtls aDtaxro;o1tpx iieild m ea(mpn(0teenxfctadoaDe nvs;t0 rto(o io4ll nlnctat) 2raur ;u0tptomietlt sDrlnmsnu)tlenmrctodfptrln s;s)tetoxm3iydlp  mnctat) 2tmur ot4oetnii3ils aDel(monu) rtnxr ty1lmD  nvo;t0teto(m3ny1alenmnei ()s2ta(mp;t4altoifeiadfmDel( p (0trxrmfcoodla eaiei (0teuoxmpio4lptnlfctat aDtm(mp;o0tlto iciadfm rm(mp;(4aeermr3iadfa  an o t0seumir3iu1lltelfeia(  2trxroot1oetoio3tadfm ua(mp;() leoif3tytfatrluvol( sexr(rpiodlltnlnei ()srur( o;o1aleoiictatfaDrm(vsnt0areoxf totfpD lneo () etmxo3oy4lle mfeslt  Drmx pou0tpen fetyslm2ua(mpn() rermr oo1lpt aivo;( trxmio iy4om e iet () Drmx pno0ale io3iadfa ean p (4 ltrifciydlaDrai sl(0trtoxopiy1ol elneta( sruaxmoou1tpt  oeiytlaDran o;t4 lermf3to1fateau o;s  2urxo oodole lfvt (fsrtm(m ou4apen iciysfm2ra( onu0texnxfcoy1lp r ieo ()t2xmxm3oodole mivil()srtr( pnt1tpxomf3ils s rmumo;()alxnir oa1lp e neslt0seumim nu1oltnmnvtas)arum(rpot4tpxnifeilsfmDrlumpn() rxnxf totomtrlneols) rxmim3ny4ape  nvs ()a2tax p;o1oltn o3iaslaDrln p t0arermr3iodoa rlu o t0teurir io4ole  fvtlsf Dur(  ou4tleniieiytfsDeanms u0 exnircoadfaDeauei;(0s2xoir oy4am nlici (  rrmump;t4alxniietytla2um(msn(4artnmf3oadfaD lu i;(0srxmio oodap  mfvs ()sDum( p;t0tpe mo3tlsfm rluvo (0arxomr3todomDrlnvi;t0seuo(m3io4olen nvta()aDta(rp;t0tlxo o3tlsls ran o;u0aleniociatom eluei;s srxm(opou4optnmietlt)s2rrxm ;o0opeoii3iysfa2eanvo ()artnmf io1omtelivs;s0s2toxopnu1al nlicsasfaDuaxront1olxomoeilt mDul(vs;()arxomr3iatlm r nvi;() etrir3iu1lle mnetls  2tr( ooo4tpeomiciyt a2ua( s;u) leoif oodfa ran i t0 etm(r3nu1am nmfetas  Draur ;t4tetoioeiys s um(vo;t4artoif iotoaDrau s;( setrim3nu4lmtemncsl(f 2rmxrono4opt mi3tydls rm(mont) renmo3to1oaDr u i s  rtmio iudomeelivtatfsDur(root4tle ifeilsfm emnms;()tetnmf3to1op ranes t)t2uo(m3nodlmtn ivt s)aDrrxr ot1olxoifciltla2elump t)altnio io1oaD anvo;s)teurxr ou4omenmfciasfsDum(rp;t4alxnmfetltfm2el( s t0 rtrmr iatlpD  nvo;t0s2uoio3oodapte iciat srumum no1tee ioeiltlm umnvsn(0arxrio3oo1lptrlnvs s) 2toimpiu1lptnmfci s)a2trxr oo0teeomoetadla rmu o;t) exomf tydla rlnei s) exmirpoy4aleelfvsa( arua(mont0tpx mfeilslmDul(vp;() rerxf3oytoa   u i () eto(o3no4am  livs tf Drru onu4opt  fciysls2rmn ont)trxoir oa1lpDeau s s)srum(m3iy4lpt miesa(  2uaumpnu4aexnioctatlmDua( sn() ltnircoytoat  neo t)s2tmir nudal  mfcta( a2ta(mp;t1tlx mo3iatfaDranms t4 rtnioctotoa   i il()sruoio oy4lmtnlicsa(faDua(  no4ope  oeildlmDrl( onu0altoxo3totoa r n ols s2xrxopoo4oleelfvs (fsDrr(m nt0apxnmo3ilsfmDem(mp t)texrxo oadfptrli o s0sruoxo3ny4aptnmnetas) Dra(rono4alenmi3iatla2um(vpnt0 ltoxfcta1oa r u o s0 rxo(r3oy1apeeliei sf Dtmurpou1aleomi3tlsls2el(msn(4 exnxocoodlm e nvol() 2xmxo3ny4al nlfcias) 2urump;u0oetn octltfm eln o;t0 lxnmr oa1om   uvs;t0s2xrxo oodlpe  nctltfs2urxrpou0texnmociysfs um(mp;(4 rermocoytlpDelu i (  rxrxo ny4aptemiesat)a2rru  nt4alx ifeilsls umnvpnt0altrio3oa1fpDraivolt  ruoirpio4ole mnvi (  rrmu pnt0oexnmo3iasls ulumo;t0 eeriocty1fmtraneo;s0s2xoxopiodlmenmiesl()srrm(mont4ope mieiys mDea(vo;t4texnxfciatlmtrlieols)seto(m3ou4omtemictl(f rur(rp;t1oetnifetadlaDemnmp;t4 etomr to1om  an o t)texo(r3oo1lmtn fesl(fs2rrurpno4ale  o3ild s2elu on(0aetrio3ta1lmD  nes;( seumxo3iodap  mici () ruau onu0tetn oeiyslm rauvs;t) lxrxf3totlat  uvi t) rtoiopou1om e fcs ()a2uax  nu1aexn o3iadfa umu o;u)aleomf iy1lmtelieo;s0s2xo(m oo4op nlncsas  2urum ;u1ole mfciydlsDem( p t4tltnxrciatfate ieo ( sexmxo nu4amtnlfes t aDtrumo;o4oexoiictad sDumuvp;u0alxrmfcoy1lmDeauvolt  exo(mpio1op  lfvi t  Dtrx ono4apxn f3tydfmDem( onu4tetnmrciatlpD livi;t  rtr(r iodopte fvsls aDuax  ;u0texoioeiysls rm(vs (4areomo tatlp eluvi;t srtr(rpno1ap elfetl()a2uax poo1tpenioeiytlaDrmnvs;t) rxomo3ia1fa e u sls)srxo(mpoydapeelict s)s2tmxm ot4opeoifciyd s ulumo u4 lxrio oydomD li s;t)srtr(r oo1olt  ncs sfa2ur(mooo4apeoii3iad s ul( s u)tetnmf3tydfpD anvo;t  exr(o io4lmtnlncsat  Dumxrpoo1ale mfeiytfmDrm(mo;t)tltrmf3iy1fmt  uvols) etm(rpiu4om emnesasf 2ua(m ;u0oltomfcilsfm2ua(vp (4altrxf3ootfm r ivs;s  rtrimpiy4ll  lfcslsf 2ua(mpnu4altn o3ildfa uaums;u) renifctotlatelivo t texrxm3ny1amt miesasfa2urx pou4aeenmietldlsDum(vo t) rtnxr3iotlmtraneo;t)s2xm(r ou1ame mfvt t)s2raxr ot0tlt  oeilslsDumuvs;u)teerir ty1lptraivilt)s2to(mpiudal nmieiat)sDtr( pnu1olxoifciadfs2rau o (4tetoifciatla eanvil( texmiopou4lmee fvsltf 2trxr nt0aptomf3ias a emnvp;(4aeermo tydfm  auvo;()seurirpiy4ale mfcsa(fsDtru onu4alt ifciytfa eaumo;(4altrxo todlmt lies;s  eur(rpou4opeelnctlt)sDuau  nu1apt moeiatlm eaump;(0artoir3todfmtr uvol(0sexoir nu1oleemict ( a2um( poo1tetn f3tatls ranvont0alxnxfciy1opDeau o s)srxoir iy4apt lies t)arum(m nu1aeeoii3ias a2umumpnu0 etnio totfaDrli o t0 rtr(o oy1olenmfesl(  rurur nt4opt moetldfs umumo;u4trenmf oy1fmtraieo s  etm(m3ny4al e fesas)sDua(rpno1tex ifctydfa2rlnvo t4 rxomocoadoa r neil(0t2ur(rpiudlm e ivtlsf ruaxmpnt1opeomiciytfa uauvp;t) exrmr to1lpDelneolt  rxmio3oudlm nmfvtas  2urum ou4alx  octatlmDulnvs (4tleniociydfp rli i;(0sexr(rpoy1llenmnvta()arrr(r no1aexnmfctad s uanmo;u4teenio3ty1fmDr ues ()sexoxr3no1om e feia() 2rmx  no0tpt miciytfa2em( p u4trermrciadomtrlnes;(  rxoxm3no1lmenmfeilt  2tmumo;t0ale moeild s2eauvp;t4 lxoxfciytfm   u olt)s2urimpiy4lm nmnctlsfsrtrurpoo0tltnmf3iatlaDemn s;(4artomo3iytom elnvo s trxo(o oo1olenmneilsf Dum(  nt1opxoioeiydla ra(vs;(4 eenir oa1fat  uvols)tetoxm no1opeemfeta(f rtr( oou4alt ii3tltfmDeanvs t0aetnxocoatopDr ivo t0s2tmim oodll nmncsat  Drmx  ou4tpeomfcildfsDrl(mo t0 exoxo3oa1oatelu i ( srum(rpno4oltnmfeia(  2tr(  ;o4aex  ietyt mDumu snt0 rxomr oodoa eai s s trumirpny4ol   nctlt  Drm( pou4oeeoiieilt s2ulumsnu0artniocia1fmD livsls)trurxopoodale lneiat)s2um(mpnt4tlxnmfeiytlaDemumpnu0artnir3tydlmD an i s) 2xoxm3oy4optnlivsls)s2umu p;u1tptn fctydfs rmu p;(4 exoxo3iydfp  livolt) 2tr(m oo4altemncs t)a2rrxmoot0optoiicilsla2rauvp u) renmf ta1op rln i ()trtm(r io1lmt  nct t) 2umxrp;u1aex iicildfa em( o t0trxoiocoytfmD lu i;s tetmimpnodalee ivsls arraxmono0tlx mfeiadfm eluvsn()tlenirctadlm eln s (0t2trxm ou4lptelnctat  rtm(ront0tpe  feilsls um( p;u0altnmo iydop raueo t0 rtr(m iodlm elics s aruru pnu0texoiociadlaDrlu p;(4 exrxf io1fat  uvs;s0t2toxr3no4lmenlfesas)arrm( pot4tltnmoeiltlsDranvont4 exnmr3totfp raneo s0 etmir iodap e nvi t)arua(moou0oeen f3ildlmDelnmont4texomrctytfpt lueils)srum(m3nu1ope mics t)aDraurpou4oexnio3tydfa2rmn snu)tlxnmfcoadomDelnvi;t0 rxr(r3oudaleemfvt ()artmxmonu0aleomociatfm2rmn o u4 rxrxfcia1opDr uvils0t2uoirpoodol   fvs s sruaxm ;u4ole mictltlaDrmnmp;u0 rermr oa1lpteanei s trurimpoy1am nmfvs t)srrrumo;t1texomieiytfsDrmuvs;t) lxoxf totfat aneslt  rum(m3nu4lmte ivtl(  2ur(  ;u0apeoiieiltlm2em(vs t4texrmf3oadla  an s ()s2xm(r iu1omtnliciatf rurx  ou0apt mfeiasls el( o u0artnif3todlat  ieolt0trxmxrpou4alt mfct s)artrxr nt1apxo o3tlsfm2ea(vp;() eeoxrcoa1fm rlnvo;s teum(r3oy1lpt mfesa( sDrm(ro;u0aeeoifeiys sDrau s u)tlxrio3to1oat aivols0 rurir iodomtn fcsa(f Drrxmp;o1tpe mieias mDem(mpnt)texnmr3ty1omDe ieo t) 2xrio3oydapt lnctl() 2tmu  nt4aet mieiasls elnvon(0texnmrcoodoaD aies t0teto(m nu1lmtnlivt () rumxr ou1texn f3ils sDrmn pnt)artniociy1opte n o s)tetrxmpoudlpt mnciltfsDua(rp;t0tex  ietlsla2rl(vonu4 exnmocoydlaDe i s s0s2triopnu4om e fes sfsDtr(m ;t1tleomfeiltlm uan o;t0 lenmr3iydom   neols t2xmimpoy4olen feslt) Drau o;t1tltnmoetas s ul(vs;t)aetnio3oodomt ln sls)srtrio3oudlpe mfctltfarrru p;u1ape  oetls aDuau ont)tlxrmr3tatfmDelies;s)t2xriopou4lmt  ieiasfaDur(rp;u4opeo i3tytls uanms;t4 rxomf3oytop r uvo (0t2ur(r iy1om   iviasfsDrm(m ;t4olt  fcilsfs rlumo t4 lermr iodfaDrln s () etmxm3io4ol nlfciasfsDua(ro;t0aeto oetld aDeauvon(0texnmr3oodoptr ieo ()trxrxm3oodol   nvi ()sDraxr oo4aexn ictasla2rl(vs;t4aetrif oodla  li ol() 2xm(rpoudlmtnmics s sDrau p;o4oet mi3ilsls eau s t4 rermf io1la rluvs;t)setmxo nudop e fvia(fsrtm(  ou1oltnmo3tyd m ul( snt0 rtoxo3tatfatrli ilt0tetm(mpiy1alt  nei sfaruaxmpot4tpxomfeilt m2uan sn(0trxoxoctatom r ivsls t2xoxrpou1omen ietas) ruaxrpot4tltoif3tatlmDra(msnu4 etrmf3ootfmt li olt0 2urim nudol nlneslsfsrrmxmono4tpx ifciydfa2emnvo;u0tlerxfcoo1opDelnvils)srumir3iydlpe mfvs t)arta(rpot1ape mociydfa2ulnms t0 rxoxfcoydfpDranvs t)texmimpoy1aleelfvi t)srtm(rpnt4tlx mieiydlmDum( o;u0tlxomo oodom eanei;t0srurirpou4opeelfviltf 2urx pnu4apeomfeiltfs2uan o;u)altnxr3oo1fmDraivilt0 exr(m3oo1ol e neils srrr(m ot4ale mf3tyslmDrlu snt4arxoxo oadlaDeli i (  exoio3ny1lle  neta( arur(rooo0oexnmieilt aDelu o t)alxomr iy1lmDrlivo (0 euoir3iu4oleemnesas aDuaxr oo1opxnifciysls ul( pnu)aetrxr iy1fmt an ilt) 2umxm3iu1lpeemnetas  Dtaurpou4teen o3iysla2emuvp (4 etnif totomDrluvsl(0t2xm(r oodopenlicsasfsrrm(  no1texnmictysla2rmu o;u0aeeoio iy1faDe n o;s0 exmio3io1om nmfesa() rtmu p;t0apeoioeilsfa2rl(mont0 renxf ootop rlu i s)trtrim oo1olee iesas) rrr(  ;t4oeenif3ildfa2rmnmont)trtnxo iadlaDr ueo;()srxr(opiodlp   neia()a2um(rpno0aeeo ietytfm2rlu s (0 lxnmfcoa1lat ai il() rxm(o ny1lpe  iciat)sDum( ono0tlxnii3tad a ulnvsn(4arxoxo3iydom raueils  eumir3no4ll nmfvtl( sDur(  ou0olt if3ild sDua( s (0tleomr3tadfaDr neolt)texrxmpiu4lmt lnvia(farrm(m nt1alt ifeils a ul(vp t)alxnmo3oa1fpDrluvsls0srxoio3nodamt micsat)aDrruroou0aexomf3iatlm2eanmonu4 lxoif oydlm eauei;s)trxoir io4lm emnvi sfaDurx pno1apxnmf3ilt sDra(mo t0alenif iydfpD aues;s trtr(o nu4lmenmneta(fsDtaxmp;u4altoio3iatfa2eanvpn()tltnxr oadoatrlieil()teurim iy1amee ictl(fsrtmu pnu0tee  oetasfm2ul( p;u4texoxfcoydoptrlieils)trur(m iu4lp nmfvi ( s2tmxmooo4aeen iciadlsDemu pn(4altrxo3ia1latraieilt t2toim3iu1lpte ict t) rtmx pnt1olt  feiad m eanmo t4texomoctytlmt lnvs () rtoio io1ole  net s srrrur nt4tetnio3tlt s rm( s (4 etrxo ty1lmt lieolt) 2umirpiu4olt  fct s  2ra( ono4aptoiietlsfsDuau o t)arxrifcoatoaDeauvi;t) ruoxm nydomtemivs sfa2ur( pou4tltnioeild sDrmnvpn()aetrxo oa1opte ieols) 2xmir ou4oleemictls arum(mpno0apt mfcias s umu o u4 etoxf tatlatrau o s  2xmim3iodoleelfctl( a2rru ono0ope  i3ils m rm(mp t)alxrif oy1lptraneils0seurxo iudlptnmfesat  Dtrumont1open feild sDeau sn(0 etrxf3tatoatrlivslt) eur(rpnu4apt lncs ( srur(ronu4ape iociydla2raump;u)teeomr ty1lmD  uei;t) 2toio3ny4ol emfcsas aDraur no4opt if3iltls ra(vs;u4trerif3tadlat an ils0tetrir3iodop e ivsas)srtm(rpno0oeeoiictat mDelnmo u) lerif3oy1laD  ues (0t2toxm nu1am   fes tf Dtru oou4olenioctadls2ul( o (4 rermo oy1la eai ils)s2xoir3oy4lle lfet ( sDrm(r ot1tleniiciadlmDuaumo;(0 etnmr3oadopD li s;s)s2toxopiy1ameelnvi tf Dtmx poo4olt ioctatfa2uauvo (4teenio ty1laDrln s t s2um(opno1lptnmivt tfs2umx o;o4aptoifeiat m2umuvpnu)trtomo iodfaDe uvslt0s2uo(m3nu4lp elfcs sfartau  no1aeeomi3iydfm2ea(vont)aexrmo oatlptrauvs;() 2umir3ou1op n nviat)sDtmuront4aexn i3iadfm2eln o (4texnmf3totomDrlnvol(  2trim io1al nmfcil( a2tm(rpnu1ole mi3tasfm2ranms u4texoxr3oadopt ai i ( setr(opnodlp  mivtat srtaur ;o0tltn fciasfa2um( ont4alxniocoo1oa   i o () rtrxr iudamt  icta(fs2rruroot4opx io3ilt s2el(von(0trtoxrcto1oa e ivi;t sexrxo3oy4ll nmfeia(farrmu p;u4olenmictysls el(vont) etrmociy1lpte u i t)s2urirpny1lptemict tfs2rr( p;t0oexo ieiltfmDemnvs t0 etnmo tydlatrluesl()t2xoio ny1lmt  iciatfa2um(  no4opxomf3ildfa2rluvs u0tltrif oo1lptranvs;()setr(m3ny4omenmiesls a2tmxrp;t4alxnmoeiys aDuaumo u)texoircta1optean o;s)setr(rpny1lp nlfet ( srraurpnu1alx  fctad m eaumonu)aeermrcty1lptrln i () 2umio nudlmtemncs tf Dtrx ono0tpt mi3iltfm um( p t4aexoir tadfp r uvo ()s2xo(r3no4ll elneta()s2rrx  ot4olxn f3iyslaDelu s u4trtomrcoo1lp  livs;(0t2umir ny4oltnlfetat a2taxmoou1apxo oeiadls2emuvpn(4altnif iatoptean i s tetoxm nodal   fcslt s2tmxmp;o0ape mfcilt m ea( s t)tetrxf3oatlptraieils0tetriopou1lleemnvs (fa2tmu p;o0tlenmoetysfsDuanvp;(0arerir3oodom rlnvo;( t2xm(o3oodlleeliet ()artr( p;t1apeoifeild a2ra(von()tetrmr todopD auvi (  exr(r3nudam emfvil() 2ra(r ;o1aetoioctas a ul(mp;(0trxoxf3oatfmt aneol(0 2umirpou1apt mnvslt)a2um( ooo1apeoiieiasfm elnvp;(0trxnmo oatfmDrlivi ()sruoiopiy1omenmfes () rtmu p;o1tpto fciyd s ua(ms;t0alerifciatlmt lnvi s)s2tmxr iy1am nmnesa() rta(rpot1oltomictyd a2uauvs (0artnmfciytlaDraueslt teurxo nydom  lnci t) 2umu poo0optoifetltlaDean p;(4trenxf iy1om eluvi t0srtr(m no4lm nmnvtl(f 2urxmooo0tpx ii3tydfm2ua(ms;t0aexnir oatom ean ils0 etoxrpou4lle lfes sf Dtr(r ;t0apt  octlslaDranvs;t4trtnmrcty1fpD  u i;(0 2tmxr io1ll elfesl()a2um(mp;u0texo ieilsfm ul(mpn(0 eeoir iodlm rluvo;s) 2tm(rpoodlme  iet ( sDrr(monu0oexo icildfm2raumonu)aexoifcoo1opDrlu i;t  etr(mpoodalen fcils srum( poo4aeenmoeiatlsDulnvo;(0 rtoxr3tydfmD auvil() 2ur(m3ou1op elfctl(  Dtrxmpno4tpenifcildlaDuln s;t4tleoxo ootlaDe iei ()srto(r nodll nlivtls)srrmuront1altniociat m emnvpnt4 reoxf tydlat an s;s s2xoxr no1lle  fei tfsDumu  ot1oetnmi3ild mDrl(vonu4aetnxfciytom e ieils) 2uoimpoy1amenlivt t s2ua(rpnu4oex mfciysfaDea(vp;(0 rxrxf3oodlpte uvo (0s2xmio iu4lmtemncs tf rrm( ono1tetn oetldls em(ms;u) rtnmrcta1lmDeanes;s sruoxrpoo4lpee ietas) Dta( o;u1tleoifcils a rlump (4 lxrxf ootfp e u ol(0teumxo3iydoltnlfvs s  Dur(m ;t4alx  f3ias sDrl(mont4 lxnmo totfaD au olt0 exmxo ou1lpe lici t sDrm( o;o0oleo feiasls uln snt0arenxf3io1fm r ieols setmxm3iudaptelfvsatfa2rmu  ;o1openii3ils s emump;t0tltnio3oatoaD  nes;s) euoxr iu1om  lnesa(  2trumont0apx iieiat m um( pnu0tetnxf3ootoa  an s;t0 2ur(m3oo4altnmnvtlt  rur(roou4tpeomoetlsfm2elnms;(4 lerxo3oydfmtran s ( s2xr(o ny1omtemfct sfs2rrx ont1oex  ictlt a2ul(mon()treoiociodfpDe u s t0texoxopno1olteliet t)artm( pno0apxnmf3iydfsDuluvsnu4alermfcio1optr u ol(0 exrir3oudolt mfeta(  rrm(  nt1tetoii3ildfa em(vpnu4teeomr iytlm ranvilt trtrir3iodapen fctas)artaump;t4oexn f3iys m2uauvpnt) lerif oydlmDean o t)texoio iy1ap n fvsl(fsrua( ont1oleoio3ilsfsDrmnmpnu0aetoifcty1laDe ivsls0setmxmpoydomenmnciat  2uau oot1ape  f3ias m rau on(4aexoxo ty1fmDeanes t t2xmio oy1alte nvil( srraxmooo0opx ifeias aDea(vs;u0 exnxf3ootopDrlneil( setoim3nu4optn ncsasfs2tm(  nu0oee mf3tyd a2eanvo t4 etoir ty1lmtr u il( trxrio oo1lle  fcsat  rtmxr ;o4tpxomi3ilsla eanmo;t4tetrircia1omDr i olt0t2trimpiu4ope lfcsa()artm(  ;t1tetn i3tatlmDeanvp;t) rxnxocoa1op elu s;() exo(m3ny4lmenmiet sfsDrr(r no1oet mi3ias sDelu p (0 rxoio todopt au ilt0srtoxopoo4am e fcilt s2ra(r ou1apenio3ild s2rauvp;t0 etrmf3iatlpDrlnvo ( t2tmxr ou1ll nmnvt (farrrumono1opxo o3tld m rm(vp t4alxoif tytoatelueo ( s2urxopiu1al  mnvtl() Dumxmo;u1alenio3iltfsDeaump u)tlxoio oydlmD  nes;s t2ur(rpoy1olenlivsls  Dtm(mp;t1teeomf3ild s2el(mpnu0aexnif3iadfpDr nvols)texm(r no1ll emfetatfsrta(mo;t0opeomoeiasfa elums;u) rerio iydlptr u i;t0t2toxm3iu1optemies s artmxmo;o4oex mfeiasls el(vsn(0areoir3totomDeaivil()s2xoxo3iy4llte ivt s)aDrmum ;o0ole mi3ild a ul(vp;(0teeniocoodop eanvolt) 2xo(o3oo1altn nci ()s2rr(rp;u1alx ioeiyt a2ra( o;(0 etrxf3oadfa  lu il( trtoxr oy4apeelfesl(faDrruro;t0olen fctysfm emuvonu4 lxoif ootlpt  ues;s0sruoxm io4altnmfesl( aDtr(rp;o1opxnifetyt a ean p (4areoxo3oydfat livils)srto(rpoudllt  fvt sf Draumooo0tpeomoctlt a2raums;u)tleoio tytfaD  ieilt0t2xrxmpiudlmeelnctlt aDraum ot0oex mictasfs um(ms;u0 etnxf3oo1fmDraieo;t0 2tm(m3ou4op nmivs t)aDur(mp;t0olt ifeiat a umumpnt4trxoxf ootfm  auei s  eur(r3ou4ll emnciat a2raum ot4aetn i3tysls2elnvonu0 reomo3iatopDrln il( t2uoim iy1lptelnesls) 2raxr oo1tpx  fciadlm2uauvo;t4altoxr ia1lpD anei;t0 2toio3oo4lmt  nvsa(faDuaurpot1oexoiictadfm2rm(vpnt4tlxrxf3iytfaDelnvs;(0 exmxmpio4ap nmfeslt aDtaxmonu1oet iociydls2rl( pnu0 etnmo oy1fm elneo;s t2ur(rpnu4optnliesatf Dtr( pnt0optoifetltfmDeauvonu4trenxfcoy1lpD lnvo s  etoxo oudlptelneia()a2rax ooo4oee ifctatfsDeluvo;() rerirctotopDeaivi;(0trurxmpou4llee nvsl()sruau ooo4alto fctlsfsDuanmp;(4alenmociatfptrau ilt)t2ur(m3nudlmtelnciatfsrtrum no1olt if3ilsls uaumonu0arxrmfctytfaD  ivo s s2tmio nu1aptnmfvsasf Dumx pnt1oex  feiasfa2eau o;u4 rxoxo tadfat  ieil() euo(r no1lpeeliesls) Dumx ooo0tetomo3iyt m ulu snu4arerxf oytom  li s;t0 rtmir3iu4llt mietlsfs2rrxmont1olx ioeiatfm2uluvpnt0aexrmr iodfpDrauesls seto(rpno1openmfesls)aDurxmpnt1oexn ietytla rl(vs;u0 rxriocoytomt an i;s s2xr(m iydapt lnct ( artmxmoot0tlxoioeilt a ra( s t)tlxnmfciotfa   nes;t seumio3oodlle mfct (  2urxmpno1aeen iciltfa2em(ms ()aexrmocoodlm  aues;() rxoir iy1ll  mfeslt  2ta(r nt1teeomo3tlsfm2ul( p;t4 lxrxo3iotopt  n s ()trtr(o3no4lltn nvslt sDtaxr nu0apto oeiyd a2rauvp;(4 rerxo oytfp elues ( s2umxopnudomt  nciat aDtmurp;u0oltnifciatlmDrmnmo;()aeeoir3ia1omDr u slt0 2toim nu4olenlfcsls) rtruro;o1alxnmoeiys m2rln s u4tlxomr iadoaD  uei;( s2toxr3iy1apeemfvs s  rururpou4oltnmi3ils m eau o;u)trxomf3ta1omtr i ilt) exrio3iy4lp nmfvs s aDraumo;o0alx ifetadlm em(vo;u4 lerif3ta1lpD aivslt)t2xmxm no4oleemfvta( s2rau p;t0altnmf3iysfa2emums;()areoxf oo1lpDrlueo s) 2uoxo3nu1omen ies t srrmxrpou1altoii3iytfsDrl(mp u0 eerxo3iytom r uvolt  etr(opoo4om nlfesatfartaxmpnu4apxoiieild aDra( on() exoio3oodoatelnei;t0 rxmim3oodomt licsa()sDrrx oou0aeeo ociat a2rluvs;u0 etnif3iydlaDrlivols teto(r3oudomen ietls arurumoou0opxo f3taslmDul(mo;(4aetnxr3oydlpt  i ols  rtm(opnu1amenlicsls)srrr(  ot0alxomieiatlm ranvs;u)artoxo3ootfm   ueols) rumxo3no1alt  feiltf Dum(r ;o1oex mfciadfm umumo;(4teenmo3oytomDraiei t)s2xmimpiu1al   netlt s2ur( o;t1texoifeiat m rmnvp;t)aetnir oytlptr u i t  2tmxo3iydllen fvi ()arrr(rp;o4apxoifeiasfs2ranmp;t0 lxnmo3oo1omtrli o s0 eto(r oo1lp  lfctl()s2rmxronu4alx  iciytfs2um(mp;t0arermr oy1latr i ilt t2uoiopoudap  mfctltfa2rau o;o4oeenmfeias a2el(mpn(0trenxo3iodfpt  neo;(0trtrxo oodoleelnes s s2umumpot1tpenmieiyt mDulnvpnu)altoif tadfatr u ils) etrio io4lptnlicil( a2rmx pno1olxn ocildlmDem(mo;(4 rerxo3oo1omtrauvo t0 exm(r3oy4oleelics tfs2ra(rpou1apxomfctat a rl( snu0treoifcoytfmteluvi () eurxrpoo1lp nmnesltf rraxm ;t0altnio3iatlmDranmo;u4artnxr oadlpDe i o (0srxoimpio1omenmfvi () Duaum nt1oexo oeiyslsDua( p;()alxoxo tadlmDe ieilt0 2xoir iydamenmieil(f rtrxmpno1oet mi3ils aDrlnvo ()treomrciytlptrluesl( trur(r iydomeemfeilt) rum(r ;u1apeo ictytls2eau p;t0 rtrxr tytfp ean i () 2umxmpiu4lp nlfet s s2uru pnu1oetoio3tytfs elu s;u4 etrxr tatlpD lues (  exoxmpiodolt liei ()s2trxmpnu0aex io3iatls2ea(mo;u)tlxomo iydopD an ol(  2xo(m io4op  lfei s arumu o;o0aleo ieiyslmDum(mp u4arxrxr oadfate u ilt s2ur(m3iudam n nvs (farraxr ou4opxnio3tasfa ua(ms;t0aetrmf oy1fm e ieo;()s2toxmpiy1llt liviatfaDra(r ot4aeen o3iltlm2ranvp;t)tltrif oy1optraieil(0setm(m no1lp  lnvi s  rtaxm no1ape  o3ilsls2rm(ms;(0trxnxrciy1lat  ues;s)srxoxmpiu4am  mnvi (  Dtmu p;t1tpx mo3tyd a ulu pnu)ar
\ No newline at end of file
@@ -0,0 +1 @@
+nes (0trxmim nudapeemnvi s  2truroot1opxn f3tls s2em( s t) etnxo iodfp ranvil(0s2uriopny4lptelfcsls)arrmu pnt4ope mocildls ranmpnt4artoir3todlaDe nes (  2xo(r3oy1lptnlnvs t srrmur ;t0oee ii3tlslsDrm( p;()aetnmf iy1op rlueil( trxo(rpio4op n icia()aDumxrpot0apxn i3tytfm ra(vsnu)arxoir ta1omt  ueo t tetrir iu1ol emiet tfs2rrxr ;o1oeenmfctltla em(vp;u4artnmocoadlmt  nei;(0srtr(r3oodaptemiciltfs2ururooo1olxnifcilsfaDeln p;t) lxomrciytop r nesls0 rurxmpnodll nlicsls srumumo;u0oee ioeiad m rmuvp u)arxomrctatlm   n s t t2umxo3oudap  mivtas arumxrpno0apt mf3tyt mDulnmo;u4trtrmociatlmDrli il(0tetmxmpnudape mneias srururo;o4alen oeils m2ranvont0 etomfctatopDranvi t)t2uoio3nu4apeemncil(fsDra(monu4olx ii3iatfmDulnmo;u)arxoxo oydlm raues t  rxoim3oo4llenmnetls  ruaur nu1texnmoctaslmDemums;u) eenmr oodlpt aivols t2xrirpou1am   fvtltf 2rau p;u0apenmf3tlsla elnvs u) ltoxr ty1fpDrai ols0s2trir iodlmtemicslt) Draump;o0aet iociytlmDem( s u4tetrmo tadfm raneo s0trumir3oydoptelfes s  rrrur no0aptnifciatfmDrlnvs (4 rxriocootoa   nvi s0t2tmiopiu4llee nvtlsfaDum(r ;o0ale mi3iytfs2umnvo t0tetoio oydfmt livils)trxo(o3oudlpenlnei sfaDurum ou4ole  oetltla2rauvp t) etoxo3io1fa r ivs;t0 etriopiu4altnlicslsf rtrxrpoo0oltn iciytfa2eau ont0 rxoioctotopteaieilt0 exo(mpiu4om n fciatfa2raxr ou1apenmi3iltfa ulump u)tleoio ta1opD  ivi;t t2xo(opoydope mivi ( aDtru pnt0oltniieiad s2rlu onu)trxrxrcto1fp raieo;t)trurim3iodale lneia(farumu  ou1tlt mi3tys s ulnvs t0 exrmfciatomtr i o (0sruoxr3iu1lle mfvtas)s2tmu  ;t4aleomfcilsls uluvpnt)trtnmr tytlmteauvo;s sruo(r3ny1ap   icsl(f 2rm(rpnt1aexn f3tasfmDemn p;u) lerir3tatfatelu slt0 2toxm3io1lpt lnctl( aDrruroou1apx ifcilsls uauvp u)tltrif3oy1fmDe ieo;s)trto(o3no1oltemnvsl() Dtr( oot1oetoioetadfa2ul( s;u0trxnir3iy1fpteauvi s teurio3ou1al   nciat a2ra(rpno1oexo o3iyslmDul(msn()trxrmfciytfaDrlueils  2xmxmpnydam  mfcsl()s2rm( ooo4oexoiietlsfs2rlu p u0aeeoxf3ootlmD ai slt)seumimpou4olt mnciatf Durxm ot4alxomiciadfmDumu s u) exnmr todlpDe uvols)texoxo nu1apte feia(fa2urx pou4tlxniociys s em(mont) rxnxo oy1opteanes;s  etmimpoo1alenmncs ( sDtaum oo0aex  o3ild a rluvsnu0teeoxo tadom r u o s t2tm(m oo4lp  mnesatfsDua( oou4alx moctadfs2ea(vs;u0tlxoioctotomte n s t) 2tmimpnodlpeemfeils sruaxronu0aexnmo3iydfaDumumo;t0 etnir iodop  lnvs;s)s2tmirpno1al n nvsas s2urumpnt0apxn f3iatfmDran ont)trxoxf3todomte i o;t seur(m oo4am  mfcia()aDrm( pno0oexnioctld a emn on(4trxrxo3iy1fm   nes () rumim nudlmtnlnvtltfsrrru p;t4apx iocild s2rmumo t0 renio3oo1fp r nes;t0 2uoim3no1am  mietas aDum(m oo4tetniieiydfsDea(ms (0 etnio ootlmt lieo;t0srxrir nu4omtn nvt () rrrum ;o0oltoifcilt mDeanvs t) rtnir iytopDr i ol( seuoio nu4ome mnvslsf 2urx p;t0olxoiociadla2ul( s t4areomo3oa1opteliei t  rxoio oo4llenmnvs tf 2um( oou4aex  o3iydls2rm(vp u0tetrio3iodfatraueilt) rxoim3ny1openlfvsas artr( p;o4tpx  ociydfa rlump ()trtrmrciytfaDr uvslt setr(o3no4lm n ivt sfsrraxmpnt1ape ioctyd sDrlums;u0aeerif3ta1lp eanvo (0 rxoir3ou4lmte ncias) 2rru oou0texo feiyt s rmums;()alxoir tatfpteliei;s s2xm(opnu1lltn nvi () Duauroot0oex iieils a uau p;u0aeenifcoydlpDr uvsls)t2toxr3nu1lpt  iet sfarrau  ;t1alxnmietasla rl( sn()tetnmo oy1la r ivs t)srxmir no4ale  ncslt artrum nu0aexnmfeiasfm ulnvpn(4 ltrxfciytlmte n slt0s2xrxopnodap  mfctlt a2ra(rpnu4tlt  ictasfmDeauvo;u4aeermo3io1faD  u o ()t2uo(r nu4lltelnvi s  rrmxm ;o1apxnifetltlm2ranmsnt4 rtomo3ia1fm  anes;t0 2tmxrpoodapeelnvi ()a2rm(m ou4tpxomociadlm ranvon()aetrmr iytfp eaieolt  exrio ny1ol  mnvil(fsDraurp;o4tlx mociasfm ra( s;t4 ltnxf3totopDe ies;t)trtoxm3io4lm nmfctatfsDrmu  nt1opx mfeiytla eanmsnt) reomo3tydlmD ai s t trxmxo3nu1ame  ies s)arum( oot1alenmictltfa ulnms;(0aeeomo3tadlmteli i t0 etm(o3iydope  ictlsf 2ua( p;t1texnmoctatfa el(vonu4trermfcty1fate ues t0 rtmxo oydlleelfeta(  2tru oou0opt  f3iysfsDra( p;t) exoxr iodoaD  nes;t)t2xmir iu4amtelneia(f 2tm(rp;u1aeen icild a ul(mp t0arenxociytoptr ieo (0 eumiopoy1ap  mfcias  rtmum ot4aee  oetydlm rlu o (4tltnir totopt  uvi;()trur(r3no4alen icsl()aDurxmoot0oet  oeils m2ul( s t4 rerxf3totoateln i;s  2tr(mpno4lm nmicsasf rrr( o;t4tpxomicilsla ua(mo;u4trxnif3tydopteanvsls0 exmim iy1omt lietasf rrmxr ot4oexoiicias mDemumo t4 ltnif3totopD lueilt0 etmirpnodapte ivt t aDtmu  ou0ope moctasfsDrluvs u4 exrxo3io1omtr i s t  exo(mpou4opeelnes tfsrtaur nt4olxnmietldlsDran sn() rxoirciytlp  livs;( t2toxm3oo1ome mnvi tfa2uau o;u4oetn fciys sDulumo;t)alxoir tytlmte ies;(0t2uoxr nydopee nes (fartmxrono4opxnio3iad aDrau p;() exomf io1fmD auei ()trtm(o3iy1lp e fvilt s2uaxm oo1tlxomo3iys s eaumo u4 ltnmocoo1lpDelueils0sexmirpny4apt lfeta()srra(ront1tpen f3iaslsDelu p;t0 rxomrctodop  lu olt0 2umim3ou1al  lnvt t) Duru ont0oeenmociysls ran snt4trerir iotom elu o s seuo(opnodap nmiesas)srtru  ;t4tle  f3iasls rlumpn() rxnio3ia1opteluvs s t2xoim iu4op n nvtls  Dtaum oo1oee io3ilsfs2uluvs;u)altrmf3iodoat liei;t trumir ny4lmeelnvil(fsDrrxmpot0oetomieiadls ua(vo t0areoio3tatfaD  n ols0sexoir3iudam n fvsas)a2trum ;u0tlxn oetlsla2eanms;t4teeoxrcia1la elu i;t0srtoxm ou4opt  iesatfarrmx ont4alxnmfciltfm2ulumpn()trenxf3iatfa rau ilt)trxo(m3nodll  mfetasf Duax ont4apt mieiadfm umumsnt0texomf3ty1oat  neolt0 eumimpiodope  fviat)artr(mpno1apeo fcildfa2eanvo u0altnxf totfateaivs;t trxrir3oodope  nciatf rraurp;u0apxoiietys a2rm( s;(0artoirctadlm  aivi;(0 2urir3io4lme  ncs () 2ra(r ;o4altoifeiltfm em(ms;u0alenircty1op eanei;(0 rtmim3nodamt lnesa( a2urxroou4tex  icias m2rmn s ()aetnmr oodlmDelneols0sruoxm3ou1omt mfvs s)aDumxrooo0olenmiciys s ulnvpn(4teenio iatfaD livi s0 eto(r ou4apeelivsat) rur(mo;u4apen i3iat m eln o t) rtrxf3ootfmt  n i t0tetoir3oudole mnet sfs2ra( ont4optnifetat a2em( o u) rtnxoctodfmDr ivilt0setmxm ny1op  mneil( sDrmur nt4oet  icildfa2ul(vpn(4 ltrmf ia1fmDraues ()trtoir iudllee nvi () rtaur oo1aexomfciysfm2raums () lxoxociytlatrlnvs () eurxmpnu1oleemicsa(fsrrrxr nu0alxnifetytla2ea(vo;t4texrmf iy1lmDeai ils0trxmim3oodomte iesa()srum( ont0aex moctyt s uanvp;t0 rxoio3tydlp e u i () 2xrio iodol emiesl()srurx  nt1tleomfeilt sDra(mo;t0trxnif todlpDrli o;(  2xo(m3iy4ame lfcs sf rrrurono1apt  iciytfs2rmu o u4 rxnmr tatfaDrauvs;( srxo(rpny1lm  lfetl(f 2umxmoou4oet  i3iad mDul( o u0arxomr totfaD au i s0t2xmir3nodlltelivs s) rumxm oo4oleomo3tlt s umn p t4aleomr oodfa  lneol()teur(o io4lmtnlnvtlsf Drmxm nt1tpt  iciltla um( p;t0tltoxf oy1fm e ivo;t) rtr(o3oo1lmtnmnvs (f Drmxmpot0opxn oetadfaDul(vont)tltomr iytopDr neil( sexo(o3iodlp nmnvsasf Dtrx oot1aexomiciadfa2umump;(4trxnmr3oy1lptrau i;s)s2xrxm oy1opee icilt)arrauronu0altnifciytla2rmump t)artrxo3oadop rlieo;(0s2umiopoy1lm e ietlt)srua(mono0teeomoctysls ea(vs;(0teenmo3tydfp r ieil()srxrir nodamee fvi sfaDuaxrpoo0olxn icils mDem( snu0arenxr oodop  luesl(  rtmxo3iodlmtn ietlt)aDrr(rp;t1opx  fctlslaDelnms (4artrmo ootoa r uvs;t0srtoxo oydlpt micsat)aDum( o;o4alt mo3tysfs2el(vp u0tlxriociotoaD  nei;t  rxmirpny4opee nct s srtmum ot0olxo ociys a rmn p;(0aeenxo oadop eaivs s0s2xo(m iodlltn fet (fsrtaxmo;u0oeenmietatls2rl(vo;t4trerxrctydlat  uvsls t2xm(rpno1lmtemfeta() rtrx  ;o4apxoif3iys sDrl( sn(0aleomr todom eluvi;()texmxo iu1lm elfcslt arra(mpno1tet  f3tytfs2rlnmp u)tlerif oo1lmt luvi;s  ruoxrpoo1lpe lfcsa( a2ta(rpoo4ope  ocildfm um(ms;t) etrxf ty1oaD  nvol() 2urxopoo4llt  ivs () Dur( pno4opx iocias s uln snt0 rxrioctotfm   neil()srxoxo3oo4lme lfes t)a2ra(  ;u4oexo f3ias aDulu o;u0treoif3iatopD  ues s sruoim io1omenlfcsasfsDtmu  ;t4tpxnif3iyslaDrmn pnu4tlxnif iy1oaD lnvi s0teur(m iodomeelfvtlt aDrrxmp;u0olt ifctltfm el( onu)trxoxf iytoatrau sl(0trxoirpiu1aptnmiet ( arraumonu4oeeo o3iat s rm(ms t4 lxnio to1fp e ueolt0 rtmxrpny1olee ictls)arurur nu0texomoctat m ean snu)altrio3iadfp e ueo t0 2xo(opoy1opt lneiat srtr(rono1aee  ocilslm2rmumpnu)trxrmo oadfp r i i s) 2tmxm nu4om  lnci (  2ua(m ot1olt ioetlsls2elnvsnu)alxoxr3oadfmt livil()s2xm(m3iodll nlicsa(faDrauront1oeeomfetlt aDrlumpnt4arerifciotfmDeaivols teur(m oudlp  lfcsatfarrau  nu4aetoiieiytlmDuln pnu4 eermf3tatoa  aieil( srtoxm oo1lm  mivi t) 2rmxr nu0tlt  ictldfa2umnmpnt4tetrmo3tadoa r i o (0trurir3oodal emiesls s2ua(  oo1aptomfciys s rauvs ()aetnmocoy1fpDe ues;t)srum(m oo1omtnmies s)sDtm(moou4opxnii3iltlmDrmn o;t0trxnmr tytomDeluvo s srxmimpnu1om  mnvi sfsrtrx oou0oltnif3ilslaDuluvs u4tlxnmf3todfpt livol(  ruoxo3io4alt  ncsa(f 2umxronu0tpto ieiydfs2elums u0teerxr3oo1faD  i s;t) 2xr(mpoydlptelictls) rraurpot1optnmoctld s umu p (4 etrmr tatfa  au i;()s2um(opno4lme lncilsfaDtmxrp;o4oleoioeildfaDeauvo;() eeoifciydlat an ils)seum(m nu1optn fvi s arraxmpoo4olxn feildla2el(vont) eermo3oodla r uvo;s0 2toirpnu1olee nesa() Dumx pou4oex ii3tls a em(mp;u0texnxr3ty1om e uvs;()setm(o oy4lle mfcia( s2tmxr ;t0alto fciasfa2rmn p;t0 exnmf oa1fm eliesl(  etr(m ou1om  mfvta(  Dtax ooo1tex  icildfm ulnmo;u0tlerircoy1la rauvi;t)s2to(mpnu4ap  lfviatfa2rmu ont0olen i3iadlsDrmnvp;()aexoir tadfaDr uvolt0 rxoio ny4lpe mivtlt)aDrru p;o1tee ioeiyt m emumo u0aetoif ootfpDeln i;t truo(m ny1lme mfvi s) 2umxr oo4alxnmoeiadlsDumnvo u) exrif tytopt an i s  rxmxmpoo4lmenmfesl( sDurum ot4apt  f3ilt aDuaump u4 etoxrciodlmteanesl()seuoxr3iy4al emivils  2taurooo1texo i3iyslaDum(mon()altoif3iydoptr neslt teto(r nydam   ieta(f 2tax  nt1apxn fcias m em(vpn(4tlxoxo3oy1fm   i i ( teur(rpou1optemfvsas a2raxr ou0tptn fctys a2ua( o t)arxomf3iotfm  lues t0texoir3io4lle lfvsls  Dua( pnu1aexn octltfs umn pn()teenif iatlmDrlu o;t)tetrxo oodllen nesa(f 2ta(m no1aexoiietldfa2rl( on(0 exoxo iotla e nvilt) etmxo3oo4lpe lfeta( sDurumonu1tlx iieiyt mDulumont0 exoiocoo1lmtraiesl()tetoir oy1olt lnct s)s2uaxr nu0tle  o3iys a ra( o t4 eerxo3oatfptran i (0srumim oydlptelivsl()srtmx pnt4tltnioctad aDelumsnu4 ltrxr3tatom rlnvo t0seuo(r iy1olenmivs s)sDrmuro;t4olx iociyd sDelnmo;t4artnmo totfa r ueo;s)texrxr nydame  ietl(  2rr( o;u4oleo ieils a ulu p;t0arerxr3iytopt lnvi;t setoio3iu4oleemfesatfa2tr( oou4altnmf3iltfa rmnvs u4 lxrifciy1lp rlueo;t) etm(mpoodlmenmfeia(f 2raxmono0oetoiociasfa2ulu snu) lerifciydlp  livs (0s2xrxr oudale  nct sfaDuaurono4alxnioeildla2umn p t0texnio3iodomDrli o;()setrxopnodap nmfeiasf rtr(  oo4tpxo f3tlt sDra(vp t0 eerxo iytop rluvsl(0 2uoir3nodamenlfvs t) rtmxmp;o4opt  fcild m2rauvs t)altoiociotfate neslt)sexoxrpoodlm  livtas  rum(r nu1tptnii3iytfm emump t4 leoif3iy1lpt aivs;s) rum(o3nudame  fctatfsrtrxront1aex iieiydls2rmumo;u0tetrif oatfmDr ieilt) 2xoxrpio1amenlfeia()sDrr(mpno4opt  f3iatfa uauvo;u) rtoircootfmDr nvo;t) exmxo iu1ll  mfei (f ruaumo;o1aeeomoctldfa rmn s (4areomo todop rluvi (0texrio nydllt  feslt  Dtr(mo;t0opeomfeiltfa2elu o ()arxnxr3iatfp eluvolt0 2urim3oo1am emicia(fa2ua(  oo1teto ociytfmDem( onu4texnxocty1lpt lu i s0texoimpoudamtn ieiat) 2umur ;u1altomfeiltfa rlumo t) lenmf tatoaD lu s;()srur(mpiu4al elies ( aDurxr oo4aex iicildfs ea(vp;t4 exoio tadoptrli o;t s2xoxmpoudoltnmics t sDtrxr nu0oeen ociysfm2rm( p;(4texrio iadlm e u il()trtriopoo1ll eliviltfa2taur ou1tltomieiyslsDuln s;(4 exnmr iodomt  u i (0trumxo oo4al nlnesa( aDrmxr no1aptniocias m rlnvo;(4 rxrxf tydlatraies s  exrxr3nu1omenmicsa( s2um( poo0oet ifeiytfm ua( pnu)artnxrcoo1fatr u ilt)sexrim3oo1amtnlfeias)artmxm oo1tltnmietad a elnmo;(0areoifcootfmDr i s;s) rurxopny4ole lnvtls  rur(moot1alt if3tatfa em(vp ()tltnmo iydfatr uvs;()srumim ou1alenmfviat) rta(mpnt1tex  icilt mDuaump;t0aetnxo ta1opDelu slt  2xrxm ny1am e nct tfsrrmumo;u1oexo o3iadls rl( p t0tetnxr3oo1oateau o s s2umio oy1lle lfet t)aDrr(rpno1tee ifeiad m uau s u4artomfciotlmDean slt truoim3io1oltnmneiatfs2rrumo;u1oexo i3iysfmDranvo;u0texomocoydla e i o t0trxrxo iy4oltnlfcil( arum( oou0olto feiadlm2rm(mp;(0aexnmr oy1omDrlueslt  exmxr nu4optn fcsl( sDraxro;u0tlenioeiytfaDumu pnu4alxoxf3totfatrluei (  exo(r oy1lp nlfeiat)a2truroot0tetoioctatlm uln on()artnxo3oodla  luvil(0 2xmxo ny4lpeemivt (  Dtr(r oo0apeomo3ildlm2umumont0 rxoiocoytlp eanes;t)t2um(o iu1amtnmiesat  2tmx ont0aetoiietatfa umn snu)aexrif3oydomDeluvolt  ruoxrpiy1al nmicsat artmxr ot4olx mfciydfaDulnvo t)tleomf3iydfmteaies s  euoir oudamtn ncsl(  rua(mono0tpeo ieiadfm2eauvpnt0 lxoio iydfatr n il()setrirpiu4optn fesl(fsrrmx pot0aetoif3tadls2ea(msn()alxrir tadlm r nvo t) 2uo(r iy4ope lfcs t) Dra(rpou1aptomf3iydfm2emuvs;()arenxr3tadoaDeaivi t0texo(m3oydole micias)s2trx pnt0teen ictydla2ulnvo (4 etomr3iodfpDr ueilt0trtriopoo1olenmneilt)a2urx pnt1apxnmietadfsDeluvs;u0aexrioctatlpDraies s sexmimpoy1op elivtlsfa2trxmpot1altoioeiadfaDemnmont4arxoifciydlaD  ieo;t)teto(m ny4omee nct ()aDtmx  nu0ale ifcilsfs ua(ms;()trxrxf io1opDraieils0setmio3oy4aptemfvilsfs2ta( onu0olt ifeiltfaDranvo (4 leoif oadfp raies t trxm(r oo4ope  ivta(  Drmx onu0oeeoioeiydlm um(mp (4tlxriocoa1omtr nvo t s2um(mpno1lpeelfesl(farurxmp;t0aetomicildlaDrmnmo;(4trenio3oytfatr nes t)setrio nudameemicilsfaDtrumoot0tlxo ietydfm rmu o;()arxoxrcootomDeau i;s0tetrxr3ou4al nlnvias)a2tau  nu4apxn i3iasfm ran snt4texnxfctadfp ean o s truoxr3ou4lme lietl()srrr( oot4aexomfciatfm2rm( o;u)tlerir3oa1fpteaieo t texmio3oo4ope  fcs (fs2tax pnu0apxomfciltla rmnvp;t0 etnxfcoa1fa  aueol()setmio iy1omtn nvsl(  2ur(m nt4olxniocildfa2emn sn(0texrircoy1optranvslt  etrxo3oydom nlfct (faDtmxro;u0apen ictysla ea( p t)tlxoxf3iy1fateai s;s teto(r3iodamt  nesltfs2rrxmonu4tetomfciys m2ul(vp;t) eeomfcia1lpDrln s;s) etm(r3nodlmt lnvta(  rtm(m ;t4aex  fcild s2uanms () lerxocia1lateluesls s2xmxr3ou1lm nlfet t aDtaxrpot1opxomieiysfs ran o (0texrif3tydlm eln ilt0t2uoio3iydomtnmnvsl(fsrtmx  ot1aex  iciltlaDua(vp u4 eeomr3oodlaDe ieils sexmxr iy4altelfcsas arrr(  ;t0alxnmf3tytlaDem(vpnt4arxomf3oatfp   iei;()trurxr3nu4aptemfcia(faDrmu poo4ole ifeildfmDrlnmont)tlxrif3iadlmDeli ilt0texm(opoydapteliei (faDrmur oo0ale mo3iyd a2rmump u4alxoxo3oy1lmD  ivo;(  2xr(mpiodlpeelneta()sDur(moot4tex mfeiytlm2uln p;u) rxnif iatopDr ivsls)srxoiopny1llt lieias  Dtmxmoou0optnmociytfs2ulu o;(0 rtrmfcoadomDeau i t tetr(opiydomee fvsa(fsrtru  nu0tleo oeild s2uanmont0artoxr to1fpDrau s ()teumirpiy4openmies t) rtrx ooo1apt  feiltlm rmuvsnt) ltniocta1fp   u ols0s2tm(o nodal nmici s a2uaum ot0aeeniictytlsDul(msnu)texomo3ootoa eaivilt) rurir3iydll emfcil( aDrrx poo4aet ioeilsfs2rauvont4trxrxocoa1om  liesl()setmio iy1amte fcsas) Dtaxr ;u4open f3tadlmDum( p;u)altnio oydfaDelnvo () etmxr3nodoleemfcilt)sDuax pno1oleomfciat s elump;t4aetoxo oytfmtelnesl() eum(r ny1al  lieils) rraurono1olt iocilslsDranms;t) ltrio todfpD  ues s0teumxr oydlltn ics t)sDur(rpno0apx ifciyt a2ea( ont4 eermo oo1la eanes;()srxoir3ny4ol emnci ()sDtm(mpou4aeenioetys sDrmnmp t0trtoxociotlpDean i;(0 2xrim3nudapenmiesa(  2rax p;t4texn i3iltfmDulnmp;u)aleoxoctadlaDe n s ( srtmxrpou1olenlfcsls arrmumoou1apxomo3iadfmDulnvo u) lxnmf3oo1oatrai o;t0t2to(mpio1oleelivi sfsrumxrpot1tetn oeiysfs rlu p;t4altnxf ia1faDeaivil(0srxr(rpoydole lfvi t) Duaxroot1openmi3iyt sDua(vs;(4 eermrctotfatraneolt)teurxo nodom  lfcia() rraum no4apxo ictyd mDumumonu0trxrio3oodoptr n o;()trurir no4altnmnviltfa2uax  ;o4optoifetad m2ua( o (0altriocty1faDe ivo;s srxmimpnydapt lfvias)a2ra(mo;u4tltomfetat a2elnmo;u0 etnio tytoatrli slt0 2xr(opiydaptelnvsls)s2rru oou4apt  octas sDum( o t) leniocoodlat  nvo t  etoio oudalt  fvsa( sDra(rpot0aexnioctyslmDrmuvo;t0arxrio oo1lpt ln i;(0trtrim ny4amt  ict ( artr( o;u1tpe  o3tyt m2uauvp t)arenxf iadfpDeaueslt trxrirpoo1lltnlivi () 2uax poo4olx iietyt a2ran ont4areoifctadlaD aneo;s s2tmxrpio4lptemncilt)aDrrurooo4tpxnmfeild a ulu s t4aeenxocoy1laDraivs t sexoxm oo4ll emivia()aDtmumoot4oex  f3ilsfsDuanmo t)aeerif3ia1opD  u o;s0texmimpou1opt  fcta(faDtru ono1aexomfciltfa2ua(msn(0 rxoirctytla  anvols sexr(rpno4ll  mnes tf 2rmur ot1alt ifeiltlmDua(ms t)treomr3ia1lmte uvs;s0s2tm(mpiudopenlfvsa(faDrm( ont1tptomietlt a2umums;(0 lxrif3oo1omD ai ols0 euoio nudap e nvtl() 2rrxrpou0opxomocilslm2ea(vsnt)altrxrcoo1lmtelnes t0s2tmxo io1aptemncs t)sruaur ou1ape ii3tys a2elnms;u4tetoxocoytfaDe ueolt0 rtoxr iydlltelnviat s2ra(mpou0ope  feild a ul(mpn(4aeermociadla r n i;s0sruoxo io1al e nct tfa2tr(  no0tet moetls s rmu p u) leomrcootopD aneo () etoir3oodaltn ivs s aDtr(rpnt1tptoioeiydls rmn s t0tlermf iytopD  uvo (  2to(o oydolenmieils)artruroou0texniieiadls ra(mpnu0 lxrxrciodfmDe ivsls)srtoimpnu4lpt  nct t) 2tmx  ou0alxo fcilsfm2ul( o;t4 rermo oa1om eauvs t setmim3oodll nmfet ()srua(  ou4olx moeiadls umnmp;u)arxniocia1fpDraivsl( trxo(o nodlp  mfct s)a2tm( pno1alto ictytfa2rmnvont4tlxnmf3oydlp  au s t0 2trxo3iu4ope  neiat srtaxr nu4ape moetldfs2elnvon(4 etrif3iadfp   n i;s0sruoir3iy1lmeelneilsfaDua(mpou4tltomo3iatfm ulnvont0trxoxr ia1op rlieols)srxriopoydlp e nvsl( sDtmx p;u0alt  ietytfa2eauvp;(4artriocoy1omD  n ol(0 exm(r oy1ll emnciasfs2ua(rpnt0aptnifciatfmDra(vs t0aleomf3iytfpDe ivsls  etm(o nodolenmieils) rtm(rpnt4tlx  feiysfa2rau p t4altrxo3ty1fpDr ies;t truoxopoo4ape  neiltf rraxro;o0tex mo3iasfa ranmonu0alenmf oo1lpteaneols0seurirpoy1llt livslsfaDrmu pnt4apx mo3ilsfaDra( pn() ltrmo tadfp  luvs ()trumio3ou4lm  lfeilt)arrr( ont1apeomoetys s2uauvo;u4 rtnif iadomtrlivs;s texrir oydome  netas) Dtru  ot1tet ii3iasla elnms;()aleomrcoy1fp  ai il()setmxr3iu1apee ivi t srtm(r oo0openmfciydfa2ulumpn(4tleomr3ia1fpt ln s t s2uo(m oo1om elncs t  rtmxmont0alxoioeiydlsDumu p (0 lxoifciydomteaues t0teur(r3io1am elivilt  rrauro;t0apx mociatfa rmnms;t4altrio3tatop raivo (0 exmxm iydapenmnet s a2uaum nu1oeenmoeiysls2ra(vont4 eerif3to1fatr nes t s2xmio iudllt lfct sf 2umxmpnt4aexnioetlsfsDeaumo;t0 renmr oa1faDeluvilt) 2xoimpiodamt mietas s2tmumo;o4opxnmfeild m rlnvo;t4teeomf3oadfmD  ues;s) 2xo(m3oydaltemicil() 2rrxm ;u0oet ifcias sDeanvs u0 leomr tatfaDr ivolt0s2toimpoo4ape mfvs sf rumuro;t1olxoioeiltls rmuvo;u0 exrir3iy1omtelnes s0sruo(m iu1ol emfcsatfsDum(m ou0tpt mo3tldlm2ranvp t) eerxfcoodfaDe ues s)sexo(mpnodole lnei t aDtrxmooo4tleniietltlm2rmnmp (0arxoifciydfa e i ilt)srxo(o iudap   neilsfsrtm( o;o4aexomoetadfsDelumont4arxnmf3ootfpDeaueol( trtoxo3iu4amtnlnct s) 2rrumoot1olxnifetlt aDeau s t4arxnio oa1op elues;s0 euoxmpiy4openlnvta( aDraum ;t0tpxnii3tys mDran pnt0tlxnxrciydla elivs t0 2xoir ny4optnlicia()sDrru ooo1aptoioeiys s umuvp;(0trerirciatlatr neils texoimpnydomee fvta(fa2umxm ou1apxn octldla2elnmon()trerxr iadfptelnvs;t s2toio iudllt  ietlt)srur(m oo1tpxomi3iasla2eln pnt0tlxrxf3iotfmteluvs s0s2xrxopoo4omtemnet t) 2trxmpno4ale ioeiyd aDrmn onu)areoir3tytfm  lueils) rtm(r3ny1ll  micia() 2ta(mooo4tpx  oetytfaDuluvont4 lxnmoctydomDr nvs ()t2trxrpoydop nmfet t)aruaum nt0tle ifcilt a2elu s;(0trermo todla rlivil(  2toirpio1om emivtl()sDtr(ront1tlxn f3tlsfaDrm( ont4teenmo3to1lmt  ueo;(0 2ur(m oy1lm e iei (faDtaumoou1optnmoctyd s ra( p;t4 exnmf3oy1oat  i o;(  rto(opno1apee fvsa( sDrr(mp;u4open o3tldls rauvs;()trxnxf3oatfpD  i s;t) etmio ny4lleelnvsas) 2ur(mo;t4teeniieiadlm emnvon()trxnio ty1oa  an s;( texm(r3io4amtelivta(  Dtmxmpnt0tpe mociat s eaumsnt4artnxr tytomte i olt0sexoir no1apeeliei s)sDur(m ot1opeoio3tys s2ua(vpnu4trxrif iytfpteau olt)teumxo ou4amee nesl()aDra(r ;o4teeomoetadfaDeauvp (0 rtrxocoo1optr n sls0 rurxo3nydoltnlfes tf rtmur nu4tet  oeilsfm2umumpn(4 exnio3oydlpDraivsls)srtrxm3iu4lltnlfct s)a2uaxmoou0tpeoiicildls2el(vpnt0trtoxrciydlm  li i;t0s2uo(r3iy1lm  mfetls)sruru  ;u4olen ociat s2rl(ms t0aeenifcoydoatrlieo s) 2umim3nodol elncslt) rumuronu1apeomieildfs elu o;t4artrio3oatlaD luei;( sexo(opiudlpeelieiltfsrraumpot0olt micild m emuvs;t4areomocia1oatrai i;s0srtm(m iu1opt  netls)a2uaxmoot1tpxniictlsfmDeauvp;u)arxriocia1fmDr uvs s  rto(m3ou4lpt  nvs ( arrmu  nu4aeenifeiatfaDum( s;(4 rxnxoctydomDraneo s0 rto(o oo4lle mivi ( s2tmxmonu1apt mieildfa umu s;u0 lxnxf tatfa rlivi ()seuo(m3iu1lptelict s)aDrrx  nu0open ietydfaDrlums t4alerxo3iodop r uvi;s0trxo(m3ny1aptnmieia( a2trurpnt1oexoifetldlaDemn p u4 eeomoctydoa r i o;t0 exmim no1lm nlics s  rtmxr ;o4tlxn feiysfa el(vs;(0arerif3iadoat  uei (0texmxr3oodope lnviltfsDra(ro;o4opx  f3iasla uln o;(0arxrxr3oatlpD liei ( sruo(m oudam  mncsatfarum(m ;o4oexomfciysfa2rmnvo;u) ltnxfcty1fp  aivs;t0sexr(rpnodaleemiesas aDtrumo;o4tlx  icilsfmDuanvs u)teerxf3tadoate ivi;t setm(m3iy1op  liesas)sDua(mpnu1tpt ii3iys m ranvp t)tetnxo iotfmteauei s0 etoxm no1al  mnvsls)a2uru p;t0tetnif3tydfm2elnmo;u0artrmf totoptr i i;( t2uo(m nydllt mivsl(  rumu ont1tpx mo3iadls2um(vo;(4aeerxr tytlp r uvils0 rxrxr3oydaptn fcta(  rtrxrpnu0oee miciasla ulu onu0teenif todfmt livs t0t2uoir nydlm nmnci sf rrmxmoou4oetnif3iyt a rmn s;t)trxoircoa1fmDrlueil( setmim no4ale mnet s) ruaxmoot4ape mociaslsDumn s;u)tltrxoctatoatrln o s  eum(rpno1omtn fvtl(fs2rrxrp;o4alxo fetadfs2rau o;u0alxnif iadomt lues;t  rur(m3nudalte icils aDtaxronu1oet  o3ild s ulu s t)tlerxf iatfa rluvi s0 2xr(rpno1op e fetl() rtrxmp;o4oleo feiatlaDeaumsnu0aexoio iotopD  nvil()setrir iudlptemnvs t arum(r ;o1oexomfeildfm2ua(mo;t) etoxf tadomDelivs;t0srto(m io1ome lfcta(f Dtrum no1openioeiasla2el(vsnu4aeenmf3tydlaD an o;s t2toxo3nodoptnlicil() 2raump;o1tlenif3iysla eanvp t)teenif ty1lm rlieils)texr(r ny1om emies tfs2trump;t4olx mfeilsfm ul(mp;u0 eerxocoydfmtelnesls) euo(r oy1ap e fesa() Dumxro;u4teeo oetyslmDrm( o;u4 lenio3todfaD  iei s s2tr(o3oy1omt livsat) Drax  ou0tltoif3tatlm2ea(vp;t)tlenmf3todfmte n il(0 rtmir oy4amt lfeias s2ra( o;o1apxn oeiyslmDea( on(0 reomfcoo1lmDeauvs;s) 2xmxr3ny1llt lfci t)s2tax o;u4olt ii3tasfsDumnmo;() eerircoo1lpDe n o t)trtoxo iydamtelfesls sDrm(  ;t4tltnmoeilt a eaumo t4trxoif iadlpDean o;t0sexmxr3nodlle  netas srtrx ont0tpxo iciat a2ea(mo u0tltrmf3oytoatr u i s sexmxr io4lpte ictl( s2tmxro;t4tle  iciys s2rlu p (0 rxoiociadfpDrlu ilt s2xrxm iu4optemivi t aDtmxr no4apenmictasfaDeanvs t) rxnmo ootfm r neolt)tetmxr3iudlptnmnei s)aDurx pnu4ole  i3ils a2eln ont0artnmo io1oatean s t0sexoim3oudale lfct () 2urxmonu0aee  i3iys sDrlnvo u0 eeoif3ty1fmDrlnvs (0 rxoxopiy4aptnmnvtls) 2ta( oot0oee  o3tltla eau p t0 etnioctytomte iesls)srtm(m iy1altn ics s a2ur( oot4alto f3ildfs2rm(vp t4tlxrif tytfa r n i;t0t2uo(mpno1amt lncilt) Drmu  no1alx  ocilt m uanmo;t0alxomfcia1lmtrln i;(  rtoxr iydapte ictat sDta(rp;o0apx ifetysfa ranvp t) rxomrcootoaDrauvolt0s2umio3ny1opt  ivi sfaDrrumont0apeomoeiydlm2el(vp t) eeoxf iatoat  ivo;(  rumio iydlptnlfctl(  Drrxmoot4tptnmi3tltfaDrau o;(4trxomf iydfmtrlnvi t) rumxm iy4apt  ict sfsrraxrp;u1texn i3tadla ranms;u0altrxf3oadomteaiesl()t2xo(opnu1llenmnvilsfsDraumo;u0opxomieiysls2emnmo u) renxr3ty1lp eauvol() 2toio oy4ame lfvsltfarrm(  no1tet  f3iytfs rauvs;t0trtnmr3oa1faD  i ilt  rxm(mpnydap n ictlt)artr(r no4oeen ieils s rln s (0 rtrmrciy1fp e ivs s s2um(m3iodoltemivta(f 2uau oot4aee  oeils m eaumpnu0 ltnif oadop r ueilt srtr(opno1omt mfvsa( sDururpoo0apeo fctldlm2um(mo;(0trxnmf oo1laDeli sl(0trtr(r3oo1al n nesatfarrr(rpnu0tex  o3iyslm2uanvo t4trermrciodfp  anvi;(  eumxo oo1omt  fvia( a2rmur nt1aet ifeilslmDean o (0teeomfcoy1opDeaieols t2uoim3nu4olenmies s) rrm(rpou1openmo3tasfs2rm(vs u0 eerxo3tatfaDelivi (0seurxrpiu1ope lnviltf rtau pnt4texnmietysfs2ul( on(4 rtnmf3iydom ean s ()seur(o3ny1ap   fei s srta(rpou0alxnmf3iyd s ulu p u0tltnio3tytfmDraues (  2xoio io1apee icsa()s2ta(r nt1tetomieiadfm ua(vsnu4 rtrir oatfmD  iei;t t2tmio nudlleemnctlt a2tmurp;u4aeenif3iatfmDuauvs t0aeeomociodlmtraues ( srxm(rpiu1altnlieilt)srtmxrpou1tetnifctlsfs2emu s t4trtoio iodfat lneo t)t2urxmpoodom n fcs tfsruau  oo0open ietydlaDemnvs u0 rtrmf tadlmDraneo;() exrxo io1openmnei tfsrrr(  ;t4alx ifeias mDeau pnt)teeoxrcoa1oaDran o t)s2umxo3io1omt mfeil(f 2urx pot1apeomi3tas s2umu pnu0teeomfcootoatr u s ()tetmio iudlpee iesasf 2tmu pno4apenif3ilt aDean pn()tltnmf oa1lmDe nvi;() exoxr iu1om e fci sfsDumurpou0opt mo3iltfsDrmumo () renmf iy1lm  livi t  etoxr3iu1ll e iei t aDuax pnu1texo ictydfs2rmu s;t0 lxrmo tytoaDelnvols  2to(o3ou4ap e fesas) rumurono1alx  i3ilt aDelnvs t0aexomf3tydoa eli i (0texrxr3oodal emfct sf rtrurooo4tlx iociatla ra(vo;(4areomf3oatla e i il() 2xm(opio1opt  fes s) rtm( oot0teeniicilt m2rlu sn()trxnxr3iotfa e uvi t0 exr(r3nodamtnmfcsas) 2ur(mp;o0tltoifeiat a2rm(vo ()tltrircoatlat luvs t) rtrio nydlltnmfvs t  2trx ooo1aeenmieiytfs2ul( o u)aeenmr oy1opDraivo;t) 2umxopou1op n fvs () rtr(m ou1aetomfetytlm2emnvpnu)aexrio oatlp ranei;s) rtm(r iy4lme  fctlt)a2ta( oot1optnio3iad m2emnmpnt0texrxo3ootlmtrln o t) exm(r3iodam elnei (farurx  ou0tlx  f3iatfs2emu p t4aexoio3ia1lp   ues;t teur(mpoo1ap nmies () 2tmum ot4tpxnmi3iyt a umn p;t)alenmrcootlmD anvsls0 etmxm3iu4oltnlfci (f 2uauro;u0tlxn f3iydfa2emn p t4 lxomrctatopt liei;()trtoiopnydlmenlieias)a2urx p;u0aetn i3tys s2el(ms t0trerifcootomD au ils0 2to(o oo4op n fcils  rtr(m ou4ole ifetltlm rmnms;(4 ltoxo3iytomDelivo (0 rtrxm oydamee ieil()a2uau  ;t0tpenif3iatla2ranms;()trxrir ta1optr ivslt  2tmim3nydoleemict tf Durx ono0olxn fctytla2ranmsnu0arenmo3ta1op  ln o;s0 2trxm3oodaptnlics sf 2ur(mpot1alxoif3tlsfa2rl(mp;u0 lxrxf3oodfp r ivo;s t2xo(o ou1optnlnvi t aDtruronu0aeenmfetydla el(ms (0 exomr3iy1opDrauei;( texrirpiy1olt lfvs (fsDuaump;o4opto oeiyslsDeauvs;()altrmf iy1fate n i t) rtoxr3no1ll nlnei () Dta(mp;o0oltoifetat aDeluvp u0 lxnirciytop rln o;t)tetmxr nu1llte fci t sDrm(mp;o4openif3iadla raump;()tltnxr to1om eaies;(0setoxo oo1ll nmfcsat)s2tau p;t4teeo ieiadfsDran pnu4alxriociadlaDelnvsls0 rumxmpiu4al nlict s sDtm(r ou1oeenmociydfaDeln p t)texoxfcoa1fmt  n i t0seuo(m3io4lme lies ( aDra(mpou4altomfeildla2rm(vo (4trtnir3ta1lptr ivs ()setm(o3ou1lpe lneilt aDrau  ;t4teen ieiasls ea(mp t0 eenio iytfptrlies;s) rxrirpou4olee ict tfsruax pou4aeenmfctatfs2emn p t4aleoio oatfm rlieols0 rumxo nu4ame  feias a2umu oou4apxn o3ildlsDel(mp;t) lxnxr oa1la e nvi;s) ruoio3oudllenlfvt t a2rrxm ;u1tex mfeiys sDuaums;(4 rtoxr3totoatrlieo;t s2um(o iu4amtelnet tfsrumum no1opxniicias mDeauvs;t4tltoifcia1opte iei t seumio3oodlme mfct sfa2ur(mpou4aexoiociyt s2ra(vpnt4aexomocia1opD lnvs;s0s2urir3oo4lpeemfcils) 2urxroot0optnmf3iytfa emu p;u4 exrir ootomteaivs;() euoio3iydopeelfct tfsrrrx o;t4opto i3ildlmDea(vp;u) lenif3iytfpte i s;t)teto(rpiu1ap nmfvt sf Drrx  ot1alto f3ild a emnmonu0trtnif iotfa elivs;t0sexm(opoo4oltnliet ( aDra(mono0altoiieils m ea( p u0 lermf3io1oaDr ivo;t srum(r3nu1ope  fctlsfaDua(r nt4aee mfeiltfsDuaumpnt)arerif3oo1fpteaivi;(0setm(r3oo1amtelnet (faDrrxrono4tetn fciad m2ea( snt0 rtoir iydopt ai s;( s2urio3iudamtnmneslsf rrm(rpoo0tpx mocias a eaumsn(4 rermr tadfa elieo;(0srtr(m ou4apte ies () 2umum nu1altnif3ilsfaDrmn sn(4trtoxr oadlpD livils0s2tmiopoudaleelivtas)sDurxrpoo1tleomfciat mDrmn s;(4treomo todlp raues s  2tm(o3oydap  livsl(f rtmx  nt4tlx mi3iat aDranmo;u) exrxo3to1fa r i ils tetr(m nydll nlfeil()s2rm(mo;t1tleo ocils mDel(monu4tltrmocootlpDr uesls0s2umxo oudll nlivt t aDrmur nu0oltnmoeiytfm2rl(von(0 eeoir3tadfp  lueols)t2xr(o3oy4lltemivs t)arrm(r nu1tet mfcildla2umn pn(4 renxo3ta1lmDeai o;s  rxrim iy4ameeliei ()arum(m no4aeto ietat aDumnmon()aexrxo iodopteaivo;s0s2xr(rpny1lp emnvia(fartr(mpot1tleoif3iydfm ulu o;u4texnir iatoatraueslt0trtoxm io1al nlnvta(  rta(r ;u0aeeo o3ildfm uaums () ltrmo todla  aivi;(0tetrxopoo1altn nes t)aDtaurooo1aleomoeias a2rl(vo;() exrxoctodomDrau il(0 etoxopiu4altn fvtls aDuaxrpnu1ape  feiadlsDemuvpnu)tlenio3oatom r i o t s2tmxm3oudap   ictas)aruaxm nt4aptomictadls2ua(vs (0tetrifcoy1fp r ivsls0truoim3iudolte net tfa2raxroot4tetnmictldfm2ulnmpnu4aexniocoatfpDran ils setmim no1op e nci (  2rmxmpot1aptn ieiytla2emump;(0altrifctotop  an s;(0s2trxo3nu4llt  ict sfs2tmu onu1opt  oeiyt mDranmpn(0 rermr3io1lp   ueilt seuoir3oy1ol  mncia(  2rmxmont0apxo feiys s2ea( ont)aexnmrctydlpt aneol(0 eto(m ny1ame lnvslt s2rm( ono1oetnmociasls ra(ms u0altoxocty1laDrlueo (0 2tmim iodllt mfes s)a2uru pou1alenifcildfm ra(ms;u)tlerio3tadoaDeaieo t)t2uoimpnudolt lnvi s aDtax  ;t0oet ioeiyd a2ea(vp u)trxrxrctadlm   i ils srtrxm3nu1op elncilt)srrau pnu1aet moetas m elu on(4 etnmo3iytlmDr ivs;t teuo(r3io4opteliet (fa2urxrpoo0tpt mo3iyd sDemnmsnu)altrxocto1fa eluvil(0 etoxo nydoltnlictas  Dta(m ;o0tlenmi3tltla ulnmo ()teenmr3tadom rlnei t s2xrxm3ny1opt  fvsasfaDrmxm ;t0alxn iciadla emnmp;(4aeeoxocto1lptr n s s  rtmirpnodlmtnmnvi s)aDtm(rp;t1oeeoifctasls ulnmo;u4tltnxfcoadfaDrai o s) 2uoxr iudlltelicsls sDta( o;t1olt ioetltla2eaumonu) lxnmo3tytla raivslt) etmxrpio1ap  lietatfaDtm(r ;u0tetomfcildla2eanvp;(0texnifcoydoaD au o t)s2xr(mpiu4amen feils a2trxmo;o1teeoif3tad s eluvo u)trermociytfa raiei ()t2umxm3iydop   fvtasfa2taum ot0oltoifeiadlm uanmpnt4aeerxo3tydlpteln s t srtm(rpiodapt  ncsls aruax  nu1aet  fciatlm2rauvsnu) rxrir3oytlaDranvs t)trurxmpoodalt mnctat  rtmxm nu1oex io3ild a rmnms;u)aetoio3tatlateaneo t0sexo(r3io1lptelfetl( a2raxrp;u4tpto i3iadfa rm( o t0trtnxocta1lp elneo s t2trxr3oy4ol e fcs s  2trx o;o1tlxomi3iatfaDrm(vsnu4 ltrircty1opteluei t  rtrxo3iu4aptnmfvt s)sDra(rp;t1aexoii3iys m rlnmo;() rxrir iy1fmtr ivi s0texm(rpno1al   ictas srumumpnt0tee ioeias aDrmn p;() rxnmfcootlmtrai sl(  2tm(r iy4omtemfciasfa2ur(roou4opeo o3iydlm2emuvs (0tlerxo3oadopt lueslt0texmxm nodopenliesat sDurump;t1opto o3tlt m2rl(msnt4aleoir iotfm  aneol()setoxr3nu1om n fvia( s2um(mo;o4olx moetas a eauvo;() lerir oatop elneo s0 2urxr3iy4al   nei (fa2uaxmpnu1oee mi3iys s rau s;t0 lxnxoctodlm  li o s seur(o3nydll emnvtat) 2tax  ;u1apeoiieils mDeluvont) lxrif3oatfmte ivs;t)srumir3ny1lm n fcia(  rtmxm ;u0olenifciadfmDumu p;()tltnmocoodlaDrln olt texm(mpiydop n fcsa( s2rm(m nu4aeeomieiasfm2umnmo t4alxomo iytfp rlivol(0 rtr(rpno4lmtelieia()arra( o;o0tlxo ieiytls eau on(4aeeomf3oatfm elieils) exmir iydole lieilt)a2rrum oo1apenif3iyslsDrlnvp u0teerxr iytlat lneo;(  rxm(r ou4al n nvtltf Dtruro;o4ape  ietytla2um(vp t0 ltoxr3tadoateauvi s0srxr(m3nudalt lnctlt)s2ta(r ot1tpx mo3ils a2el( pnu)arxoifctodfat anvo ( sexo(rpoudllenlicsl(f rrru p;t0oeeo i3iytfm2rlums u) rtoxocoydfm r nesl(  ruo(mpiudlltn iesa( arrr(  ou0ape ii3iytlmDrmumo;()trermrcio1omteaneolt  exrir iu4opt  ivta(f rumxmp;t4aet mociat a2uan o t4artoxf oa1laD luvi;t setoxm oo1ope lneslt)sruaxmpnu1olxniieiasls rlnvs t)areomfciydlptelivo;s truoim ou1opt mivs tfarrauroou0oltnmociatlaDrl(vp u4 eenxrctytla rluvsls texrio ny1op elfvsl(fsDrrxr ou1aptnmiciasla2rmums;u4alermo iytlmDrauvols  rxmxr ny1lpeemici ()a2tax  ot4alxomfctls m uan onu0 lxoxo3oy1laD  ies;s seumxmpnodap   ivi s aDur(rpot1ape miciltla2raumpnu0 etoxf3tadfmD  u il(0srtoxo ou4llt lnct s  rrmu  no4tpxnmociatlsDumnvo (4alenxo3totlatr i s;t)texmxmpnydap  mfcsatfs2tmu poo0ope  f3tys sDem(von(0areomr ty1fpDeanes;s srtoxmpiy4amen ieiatfartr(root0teenif3iydla el( p u0 lxoif todlpt aieil( t2um(o3oudomt lnetasf 2uaur oo4olxnmfeiadfm2umump;t0aleoiocootlp rlies ()texoim oodlmtnmfesltf 2tauroot4alx  i3ils mDumnvont) rtnifcto1faDe nei s0teuo(rpiu4op  mncsls  rrr( pno0olx  o3iydfa2rlu s;(0tltoxf3ia1opt  nvo;(0t2umirpiodlp  lnvi t)s2urxmooo0alx io3tatfs2rl( p (4artnmo3iatfpD lu s ()s2ur(rpiodlpee feta(fsrtm(rpno0tpxn fctyt a uln o t4trxoif3iy1fa eaiei s0s2trxrpnudolee ict s) Dua(mpot0aeeoiiciyslsDumums;t)aeeriociodop   nes (0trxmxm iu4op nmiei sfarrrumpnt4aex ii3iltla2em(mon() etrxf3io1fpDr ivi t0 2xoio3oodll eliviatfs2raxmp;u4tlenmocildfaDeauvp u0aexrmr3tydoa  au olt srxm(mpoo1lm  mics tf Dtax  ou1tlx  f3ilslmDum( p;(4treomocoy1oa r i i t)sruoim nudaltn ivslt) 2taum ;u1tlenmfeildfaDeanvp u) rtriocoodfaD liei (  exmirpoo1ameelfctl()sDumxrp;u4aexo i3iadls2eanvs u4teeoio oo1lm e n sls seur(r nu4apenmivtltf ruru  oo1oexo ocias m rln s;()tltrio oa1optr ivi;(  rum(r3iudamen fesa( sDtrumo;u4texoifeilslm2umn ont4arxrxf3oa1faDeln s;(0seto(rpnydlpt lnci tfarurxrp;t0aexomfctas sDuluvs;(0treomo ia1omt  uvol(0teto(mpiu1om n nesl() Dra(rono1apeomoctldlsDul( s;()tlenxf3ootom eaueilt teurxopnudap emfvia( arraxmpnt0alxn fciyt mDeluvo () eenmf oodfpteln slt)srtmxopny1lpen fvi t arrmx  oo0opt  o3tld mDrl(mp;u4aexrmr totlpD liei;s s2umim3oodol nlfvsasf 2rrx onu4apx ioetysfa2umnvpn()treoxo ta1omtrlivi;(  etoir iy4om nlneilsfaDumump;o4aexnmfciytfmDulumo;t)teeoiociadlmtelivi ( trtm(r iydlptnlnctat arrrx pno1tlxomieiytlaDulnvo;u0artoxociadoaDe nei s)trtmim3nydllt lncsasfaDuauroou1apxn fcias m ulumsnt4aeeoio3tydoaDrau o t t2xo(o3no1omeemnvtatf 2tmxmo;u0aexnio3tlslsDrau snu4 etnmf oa1omDeaueilt) rxoir3oydomenlfvs ()s2rrx  nu1olt moetydla2umu pnu4tleoxo3tydop  anvo ()s2tmimpiudop nlnvilsf 2ta(rp;t0aeeniieildfsDrlnmonu)arxrmr3iodfmteanvi;t  2xoxrpoo1lmeelivia(faDtmx o;u4tpt iicilt a2eanvp (0alxomo3iytlptr u o;s)seur(o3iodllenlnctat arrax  ot1tptomoctasla em(vp () rtoir3tytlm eli i;t0 exo(rpio4olenmieias aDrr(moot0altoio3iadfm2ea(mo (4altoxrcoo1lmD  nei;s seurim nudlpt lici sfarra(  no4olxomociatls2ranms;u4 reoxo3totlptran o;t) exmxopoo1oleemnetat) ruau  ;t1opxnmieiasfm rl(monu) lenmocootla  lu ils) rtrim oydlm eliei s aDtaxm ;u4oleo o3iaslm2rl(vp t0 rxnmo ia1fm   ivo;s)trxo(rpoodop nmnvia(f Drr(mpnt0oleoio3tldlaDra(vpn(4trtrxrciy1lpDr nvs t0s2uriopnu4lme mnesls  2rrxm ou0tltn iciysfaDemu s;(4 rtoxr3oy1lm eau s t  2to(o oy1am  lfeil(  2raxr ot4oee  ocilt sDrmnvpnt4arenmr iotfatrlies;s) rtoio nodll nlfvia(farta(moot4oeeoifeiytfsDeln o;(4aexrif iydop  aivs t)s2tmio io1op   fcs s aDum(rpnt0opxo fciydfaDulnvpn(0aeeoxrcoa1oat aies;t)trumxr ou4am   neia()arrruront1aexo fciatla rmnvsn(4teeomo3iytfpD li sls) rxo(r oy4omtelivsa( aDrrx ooo1oet  oeilsfs uanvs ()altoir oytlatranvsl(0 exr(o iydlme lfcsa(fsDtaumpno0oexoiieiasfa2eln p t4trtnxo iatlm e nvo s)texo(o3oy4lptn fcias srumx pnt4olxo fcils s um( sn(0 ltrxrcoa1fa elnvil( srur(m3io1ol nlfesl( a2tm(r ot4teto ocild mDua(mpnt0teeoifctadlpteai s;()srto(m3ny4ll  lfet s srtau onu0aee if3ildfmDrm(vs u0alerxr io1lm rai i;t  2xmxmpoo4lpe mfesat)aruru  ot4opt mo3iytlaDul(mpnt) ltnio iatfa  livo;t  eur(r3iu4apeelfetat) rrmurpnt1tlt mieildlmDrlnvp u) leomr iadlm rlnei;(0trxmxm3nodll n fvi t  Dua(ro;u0tltoiociat s2rmn snt0 eenir oatla   u s;t)s2xrirpiydamen ics t  rrmxmoou0aee iietasfa2emn s;t0altrxo3ta1lmDeln s s0 rumir3nudlm  lfei s)sDrm(mpno1aex  f3iytls2umu on(0 rtnmf3oy1fat aueo;s)seuoim ny4ape  nvt t aDumx onu4alx moeiyd a2rau ont) lxnio iodopDeln s;t0 etrxmpoudame  fvi tfa2ta(r nt1tle  oeiasfaDem(mpnt)aeenif iotlat liei;s0 2toim iu4ame mfcsl() Drrum nt0oetn i3ildfsDuau onu0tetnio iydlm  au s (0 exo(r nudlpeelnvsl(f rrm(m ;t1optomfetlslm2rlnvo t)tleoifcootopte ies;()sexr(m3ou4amte fvias  2trxmoot4oeenmi3iad m2ranvp (4areoiocootoa raivs;()texoir ny1om eliei (  rrau  nu0texomfeilslmDel(vp;t0texrifcootfptr nvsls0sexoxopoo1lpt  nct () Duru oot1tetomiciadfsDulnvon(4tltrir oadoa eluvi (  2xoio oy1lmtnlncias) 2rmuront0aptn feild aDum(mp (4arenifcoo1omtrluvo;(0texr(o nydaptnmfvil(fsDuru pnt0oexnmoeiatfsDrmn o t0aexnxrcty1lp r n sl() etr(r iy1lmt lnvsas)aDumxro;u1aeenif3iytlsDrau o t) etrxf3to1fpDean s ( t2trxr3nydllen ictls srtmu  ;o0opx mfeiatlm uluvpn(0arxrmfcoa1lmDraneils sexr(opno4ome mfvtls aDrr(rpnu4tltnio3iadfsDrmn o (4artrir totomDrai i;() eumir3oudam  lieiasfsrtrxroou4ale mo3iatla rlu onu4altnio iytopDrauvo;t  etrxm nydol   nesas s2uauront1altnmiciydfm ulu o;t0 rtnifciy1lpD ln o;s seuoio iydlpen fvt (  Dua(rp;t0tetnif3iatlmDum(vp;u)tetomo3tadfmDraneo;s t2xoiopnu1ol  mfet (  rurxrpnu1opx ioeiadfmDrm(vo;t0aeenmo iadla r ies s0tetmxr3io4amenmnvsls) Draurpou4aee  fciys sDemump (4 rtrmf3oodlpteau s;t0 rxmxo iy1lmt lfct tfarrrx oou1tpe mfeildfmDem(vp (0aetoif3oodfpteli sl(0 2uoxm3ou1alt  feta(  ruaumoou1tpx  oeiysfm2ean o;t)tlenxrcootlpt luesls0t2tmimpou1lle miei s)aDumuro;t0opx mfctytfa2uan p;t4 etoir to1fat lnvi t seurir3nydomtnmfet () 2rau  ;t1aexnio3tatlaDem(msnt4arxnxrctodfp e u s;s  2tm(o ou4amt mics s  2rr( pnu0aet mieiydfm2umnmo;(0 lxnmr todfmtr nvs t)t2um(r3nudalt  iei t)aDtm(moot1tpt moeiad s eln o;t0alxrir ta1lmD anvs ()s2uoxm3iu1amen iciasfsrrmum ou0altniociadfm em(vp;t)aexrxr3iy1fp e ieo;t  rtm(r oo1om   ivs () rtm(mpou4alxomieildlm el(mo (0tleniociytomDe ivsl( t2umxm3oo4lmt  nvi t)aDrm(  ;o4aexn feilsfmDemu o t)aetrmr oy1omtelneslt) exmirpio1lpee fcs tfarurxm ou0oex iictldlsDelnvpnt)tltnxf ta1om  auvi;s  exoio no4ol  micsat)a2rrur ou1ope mfciaslmDuluvpnu)arxoir3oodlpDeaivo;t srumiopoy4aptemicias  Dtru ono4aptomi3iytls elu p;u0tlxrxrctodomtelues s0 ruoir oo1am n ivtls sruau ono1optoifctad m rm( p;t)artnio iytfm r n i;t0setm(opny4omtnmivias  2taumpnu0texnmo3iyt a2ul(mo;t0texrxf3tytlpteln o;t tetrxm oydom  mnvt tfsDuax pnu1teto i3tatfsDra(msn()arxnxo3oydomD ln i t0srxo(m iy1llt  iet tf ruaumont4oexnifeildfa2ua(ms;(0 reoio3tytlmDe uvi;s0 rtoio ny4lmtelivia(f Dtruront0teenioeiyslaDulnvpn() eeoxr tydfptrluvols0texo(m oydame mnesat a2ur(ront1tpe mieildlm el( pnu0tetnxr3ta1faD luvo t trtoxopoy1llt lnvsls sDurum no4aeeo fciaslm2emn pn() lxnif3oa1fmtrluei t) 2xmxrpnodlpenlfvt t) 2rrum ot0tetnifetadlmDua(vo u4aleomr iodomt  nes;(0seurxo3oodop  licslt  Durx  ot0oeen ocias a rmnvpnt0tltnxrcoo1lpDrli sls)s2xr(r3oy1opt mict ()a2urx ono0aeto iciysla2umnmo u) rtoir oo1lmDr nes (0 rumxmpnu4am emfetl() Dtaxmo;o1tet mieiltfmDum(vo;(4 ltnmo tytoat lnesl() exoxopiudlle  fvi s aDrmxroot4apx mfctlsfa emuvp;t4aleoifcoadfat  u o s) 2xm(o oy4am elfesls) 2rmxm no1alt  o3iyt s ua(ms;t0teerir3oadop eaneolt) rto(o3oy1lpeemivi ( sDururo;o0aexoifetls aDua(ms;() rtoir3oytfat luvs t)s2trxo nydom e nvsat  Drr(m ;u1aeeo ietls aDeaumo;t) exrif oadlmte ues t  2xoiopoodop n ictlsfs2rmxrp;t4tetoifciytfs uaums u4 rtrmrciytop rlu o t) 2xoxmpnydlm  mfvil()srtr(r no1olxomfcias a2raumo u)artomr tydlaD  u s t srtmirpno1lmt lfesat)s2tax pou0oetn oeiyslaDrau pnu)texnxf oodlptr n i s) rxmimpiy4opt mnvt t  rrrxrpot4openio3iasfs umums u0tltomo todfmDe i s ( s2xoxr oudlme  fviat  2umx  nu0optoio3tatfa rau s;t) lenmo3iy1lpD luvi;s0sexmio3io4omt lfeiat)sDtrxmoot1apto i3ias sDrmnvpnt0 lenmocootfmteaneo;t) 2xmim oydll   fct (f rrm(m ;u1tltn feilsfm2rm( o t0texomo oydfp  aneo;t truoxopnu1ole  ietatfsruaxrp;u0tex  f3iltlsDuanvsn() exnxrcootlm eaneo;(0 eurim3nudal  lfeiltf 2trx pnt0tpe  i3tlsfa2rm(vo;(4tlenxo3ootlm elueo t)t2trir3oy4apenmicta( s2tmur oo1tpxnio3iasla2eln o (0texoxr iydfmDran i;t0teum(r3oo1am n fctat aDrm( oot0oee  icilslsDuan p u0aexoxrcoodopteau slt srtrxmpio1ale  nctl( sDurxronu0olt  i3tasls rl( ont0 renmf oodlpt an i ()s2urxrpny4lpt lfctasfa2uaxmp;t4tex iocias sDrln o;u0trxoxo3tydfmt lu o;s  2xr(r3ny1apeemnvsasfa2urum ou0aex mfeiatfsDem( o;(4 rtomr oydopDrlueo t0 eurir iu4apt lnvt (farrr( pnt4opeoiiciydlaDuanvp;u0trxnmf totlmD aneslt) etm(opiodam e ivs t)a2rmu o;o4openmieilslmDulu pn(4tltomr3iadopte uvo;s0sexmir oo1alt mfeslsfs2rm( ont1tpe  octlsfaDuauvpnt4tetoio3oa1fpteauvo;s0texoim3oodlptn ivi s)srrmumoot0opx ioetyd a rluvp t4 rxnxrcto1op   u i;s0setoxopiydllen iciat)arurxmoot1optomiciysls2umnmo u0texoxfctytfmtr ies;()trtrim3iudop n fci ( sDrrum no4ape iietld a2rl(mp (4 rtoxrcoytomDe n o t  2tm(o oo1olenlnvt s) 2rmur ot1ope  o3tlslm2emnvpnu4trxomf3oytfm  luvi s0s2to(rpiy1om emfvs ( aDuaum no0aee mfeiys aDrmnvont0 etnxociadlp   ueils0t2tmim3oudlp nmiei t arta(roou4teto feiat mDrmu onu) etrmfcoo1oa  au s;(0 etr(r nu4lm  liei (fa2tm(r no4aleomietlsls2emu o;t) reomf3iydlptranvsl(0 2tmiopoo4apt lfvtltfsrum( oou0tpx  ociadlsDulnmp;t4alerifcty1oa e iei;s texo(r3ny1am e fvilsfa2ra(mont4aptnifciad a rmums;t0 etnmo3ia1fate nvo t)trxmxo3oy1apee fvta(f rumxrooo4teen f3tytfa elnvsnt0trxrxfcoydlaDrlivils  ruoxrpiu1apteliciltfaDtmxrpnt1alenmfctadlaDemn p;t)tltrxrctotfmtrlivo;()seto(m3oudlptemietl(  2ra(rooo1tlxoifeildfm uln pnu)trxoxrcoytfpte ivolt0trurxmpnudomt mnvsa( aDrmu pou1alt  ieiatlaDrmnvsn()aetoxfctytfmDeauvol()trto(rpoydllee ivt ( arrr(r ot1aetn oeiad m2rln s;t4tetoxr3totlpD an ols) 2tm(m3iu4lpe  fct ( srurxr oo1opeomictltfm2elnvs t0trxoircoa1fpt luvil( trtmxr3iu4ll n nesa(f 2tmxmpnu4apeo o3tys s2ulums;u0 leriociadlpDeanei s  exrio iy4opt lnctlt  rumx poo0teeo o3tyslsDelums;u)arxoxr oytopt lnei;t s2trxm3nu1lpeemfvt sfarumxr ou0aee ioetad m2ra(vsn(0arenifctydfate uvi s0s2uo(opoudlpenmnvtl() rrmxm nt4aee mictydfm rm( o t4tlxrxr iodoatr nvo t tetmxo no4ape  ictas)aDrau  ;u1aexo f3tls m um( s;(0 exrio3oydom   nvil(0sexmio3iydapte ncil( aDtmur no4tpxn f3tysfs rl(vsnt0trerxf3ty1laDelies t)s2tm(r no4am nmicsl()artaum nt4tlx  o3ils mDuluvs t4teeoxrciytlmt an ils0trtrir3ou1opeemnetas)sDurxm ;t0tlxniociyd s2rlu o;(0 rxoxo tadomDe ieo;s0 etmiopou1optemfeils aruau  ;o4opxo octldfm2em(vp u4aleoxfcoy1lat luvs t0tetr(o ny1omtemiei (fs2raxmp;u1aex mo3ias s emn pnu) renirctadlp r u s t0 rtmxm3iy1lmen fvs ()s2uax  nt4opx mi3tysfa2em( p;u4aeenxr3totlp elnvolt0srxr(rpno4opt  nvs ( s2raxmpou4oltoiietydls2rl(vonu4aeermfciadla rlueolt)setrxopoy4ap nlncias  rur(  nu4oetnmietld a2umu s;(4altriociotomtr ieo t)s2uoir3no4ll  lnciat)a2taxmpnu0apenmictad s2ulnmo;t)aeenxf oatopDe uvol(0t2toxm oo1lltn icsls) Drmum nt4ole ioetasla ranvsnt4tlenmr iodfaD anvol()trtmxo ou1lm   nesltfsDrrxr ot0teenmoeiys a ulu o;t4texoxfcoa1fa elnvo;t s2trxm3nu1ap  mnci s) rra(  ;u0tetomo3iasla eanmo;t0 eermr todfmDr ieo (  2xm(r iu1apeemfcs s s2rmu  nu1oeenmfeiydfs ranms t4aeenif ia1lpDrau s ()s2xrxr3iudamt lneta(faDrru p;o4olxomieiys sDulnvs u)tlerxr3oa1om rau o s teurxopny4ol e ictl( s2uru oou4alxniociytlm rm(mp t0artnirciodomtraies;s0t2uriopoo1op  mietl()artrurooo4altoif3tltla2ua(mo;(4 eenxr iytfm e ieo s) 2tmio3iu4ameemics t)sDta(ronu4oee miciatla elumo u4 rtnxf3tatfmDrai o s s2urxm3no4aptemfesltfaDua(rpno4tpe ifetlt m ul(ms;()treoxrcoytomte uesl( teuoir3ny1alte ict sfartmurpnt4aptn f3ilsfs elumo t4 etnxo iodfpDeau i;s)trurir3iydam elivtlt srrauronu4alenmf3iydlm2em( onu4aexrxocta1la   n i s)tetoxrpoydal nlfvtasf rrmu p;u1opxnmo3iad s ua(mo;t0arerxf3oy1opt ln ols0tetrim3nu1ol emneslt)aDrrx poo4texnmictld a eanvs;(4tltnmr ty1omtr ueo;t) exo(m nudopt mfes sfs2uaxmont1oeeomi3iat m2uaumpn()aexrxf3iotop e iei s)trtoxo ny1lpeelnvtls aDur( oot4tpe mieiyt s ra(ms (0 renxr3iytlptrlivs s)s2toxopnodllen ieias)s2uax pno4alx  iciytlsDra(mo (4 rxrir3tytlaDean o ()seto(o3oodam  lfcsltfsrrm(r no0tlt mi3tys a um( pnu0alxomfcoodlmte ues;()trtrio3ou1ope  icsas artmx poo1olenmo3tytlmDem(mont4 lenmoctotomt lneils s2xo(m iydoltelfvs tf 2taxrp;u4aexnmfetldfsDea(ms (4trxrmo oydfpDeaueols)trumxo3nudal n nvi tfsDtm(  ou0tpenmiciltla emumo;(4aexrif3oa1oaD  i i s)seuoxo nydlpenlncia( sDtmumpnu1altniieiyd sDrm( p;t4altrioctotfate u ol(0 eumiopiudlmt lfvt sf rrrxm ;u4tlx mf3iyslm umumo;u0tltnmo oy1lm eanvi ()t2tm(mpnu1ll nlnei (f rurxmont4aeto f3iasfa el(vo (4altrxf iadomtraivi t0s2urxm3no4alte fci t)aDrrx pou0oex mietyd sDeanms;(0 eeomfciodfa  lnei;s)s2to(m3ny1ole mfes t a2ta(mooo4tee mi3iatfs rm( p u) lxoxfctatomte nvilt)texr(mpny4amtnmnvsat) rrrxrpoo4apxn octls s um(vsnu)arxomrcoytfatrai ils0t2xoxmpoy4ap  lnesl(farumumpou4oexnii3tyd s2em( p (0trtrif oytfpt  ivo;(0teuo(opno4altnlieilt)arrr(  no4tetomieiaslaDea(mpn(4tltrxr3oy1oa  lieil( truo(o3iydlme  fcsls)s2umxmpno0tptn i3tadlmDeanvp (0 reoxr ta1op  lnei;t)seurxr iy1oltelnvtltfaDrr(mpot0ape ii3tydlaDumnmonu4 exnmfctatomDrauvils0setmir oy4ll   nvtl()a2raxrpno4tpx ifciydlmDeaump;() renxocta1lpDrli sls)srumio3oudapeelnes s)artm( pnu4aleomietydlmDuln snt4tlxomo io1oaDrlies;s  ruo(o3iu1olee fciltfs2trumo;o4tptniictytlaDua(msnt0aetniocootlmDrlieo s) 2to(r3io4lptn nes s)srra( onu1olxoioetltla ranmpnu)tlerxf oodoa   nei;t) rxmxo iy1om nmncs ()s2umum ;u4tetoii3tlsla2uanmp t)aetnmr totlmDelieo s s2toxr iy4lp   fcs (f Drrx p;t0tlx  o3iad s2rau o u4 reomo to1fptr iei s0srxrir3oy1lle lfei s a2ra( o;u4apeoii3iltfsDum( snt4 rxrif3iotlmD  uei s)srxo(o oudop  mfcsl( aDrr(r ;u1alt mfciys s ra(vo;(0teeoif iadomDrau o;(0texm(r3oy1al nlncs sfaDtmx pou1alxoio3iytfaDeln o t4texoifcoadfaDranes t s2xm(m3ou4altemfctl( aDururpoo1alenmociltlmDrlums t4aleoxrcty1fpte iei;s0trxo(o3ny1lptelfetas srumx  ot4texnmoeiltfs2emn o;() rxriociy1om e n slt0teurxo nudoptnmnvi sfarraxrono1teenmo3iydls2ranvs (4 rtnxr oodoat ln o;t0 ruoxmpno1aptelfvilt) rta(rpnt4olxo i3tydfs ul(vs;u4trtomocoytomt li il(0tetmxr3nodap  lfcia(  Draxrp;o1tptnmo3iatlm eau pn()tlxnxf oatlatelu s;t0teur(o3oy1aptnmieslt)a2rr(rpnu0ale moctatfaDeanmpnt)aeerxo3ta1fpDeluvi;s t2xoim oydlm elncia(f rurx  nt4oet  ieiydfs um( onu4tetrxfctodfptrlnvi t t2xm(r oo4apte nvtatfarrr(mooo1tlx moeiysfm2umums;u4 lenmf to1oaD  n o;s srurxo3io1oltnmici s sruaur nt4aexn ociatla uan o t) exrxfcoodfpDeln o;(0 rur(r3oy1ol n nvs sf Duru  ou0oltnifeilslaDrlump;(0 etrxr oo1laD auvi s) exr(m3iy1opt lfcias  Drr(mpnt4opxn feiydls um(mp (0tlxrir3oydla elnvs;t)srxm(r3ny4ol e ncias  2rm(ro;u1alxo fctyslaDelu o u4trxrxo3iodfpD luvs;(0 rxmxmpiudole  iei s)s2ra(moou1alen o3ilslaDua( ont4 lerircoadlpDelnvols s2uoim3no4lp nlfcta(  2ur(m ;u0tet ii3tatfa eau pnu4tlxnio3ootoat liei;(0t2trir3iu1amenlnesas)aDumxro;t4tltomi3tadfmDuanvs;u4artnxoctotlateauvs;s)trxrir io1ap emfcs ( s2rr(ro;u4alt if3tytfm2ean s t)tlerxo3oatop eanvi;s  2xmxrpiy1amtnmfvs ( sDtm(r nt0tetniieiydfa rm(mp;t) ltomfctodfp eluvo;(0 2xmiopoy4op  mfeiat  Dum(mpnt0olxo f3tydfs ul(mp u) lenxr oo1faD auvs t0tetr(m iu4lmenmiet ()srrr(rpou4aptoii3tyd a2eaums;u4teeomrciytlatelieils srtoio oydlpenmnct (f rtr(roou4tptnifeiysfa2elu s u0 reoxo3to1omtrlnvo s  2uriopnudlm n icsl()srtmxm ot1oet moeiaslm2ra(vp u0alenmo3ta1fa eluvs;s teuo(m3nu4ll e ncilsf Duau oot0tlx moetltfa2el(vont4altrifcio1fa e ieslt  etmxm3nu4ale  ivt s)srrru p;u4oetomietadlm2rmnmont0tlxoio3ta1fmD auvi;t setr(o ou1ap emiciasf rtmu  ;u1oex  ieiytfm rlu on(4trxomr totlaD ai i (0 rxriopnydapen ict (fa2umxrp;o1tltnmoetldfs elnvs t) eeomo iydom   ieo;t) euo(r no4lme  ieta(  2um(ro;u1aeenmoeiatfmDuanms u4texoxr io1opDe i s;t)srumxo3oo1om n fcs t  rraxmpnu4tptn iciad a rln sn()alxnio oytoaDeliei;s0texmxo3ou4amenlfvtasfarumxrpoo1oet ii3iydlm eau o;()tltnif iodomDeanvo;s0trum(m3oydaltn ict s)srumxm ;u1opto f3tad a umn p (0aetrio3ia1oatrluvi;t)t2uo(o nudoptnmnetlt) rurxrono1apt mf3iytfs2umnvo;(0alxomrcio1oa  anei;t  rxoxm iy1om   fcsa(f rra( pou1altomi3iydfs elumo;t0 lerxfcoydfaDe nvilt0sexmxr no4apte nvi t srraum nu4tpe mo3ildfs rl(vp;t)alxnxfciodfmtr i olt)srtmiopoydape lnet t)s2raur ot4olxomfctldfs eln ont0aexnmr ootfatraivs (0 2umxmpoo4omee ics tfa2ur(ro;o0alxn o3ias sDuauvsn(0tetrxf ty1oaDean sls) etr(opoo4om n nvta(fsDraumpou4aleoioetaslm2ulnvo t) rtoiocio1laDe nvils s2urxopiodll emicia(fsDrr(rp;u4aptnmfcils aDum(msn(0treoxo ootfaDelnvi;s setr(r3ny1lle  fei s s2urxmooo1texn oetlsfm2ran onu) lxoif3iotoatr neo t0srxr(opou4al elicil(  rurx  ot0apeo ietydls umnvp u) ltrmfciy1opte i o t0teurxr ou4lme  nei sf 2tr( ono1teenioetas aDrluvs (0trxomo ia1fmtrli o t) rur(rpno1ape  ivilt) 2ur( pnu1alt ifctadfa rlnmo u4artnmo iydlmDraueo s)srtrir ny4oleelfes ()aDrmxr ;t0texnifeiasfm2ul(vp u0 etnxo3iodoat ln o;s)t2tmxm oudom n nei sf Dururpou4tet  o3iytls2rlnvs;u0trtoifciatopteluei;s0 2toimpoodalt licil( a2tau  oo1tex  feilt aDrl(mo t4tleriocio1la e n i s t2umimpno1olt mfct tf rur(rp;o4aee  i3ils a2rl(vp;u4 renio iatlat lnesls) rumio io1op nmfctatfa2uauro;u4tet  feiytls2emuvsnt) reniociodomt livi (  exoim ny4amtn ieta(fs2rauronu1oexniociltla2el( p u)artoif tatlp r uei;s)s2xm(m3oudal nmivias  2rmu ooo0olxo f3iytfaDuau o;(0trtrxfcia1om  au o;t teum(mpnudap nmivtltfsDrm(mp;u4olxnioetldlmDrmnvs () etomoctytfmDr nvi t0sruo(mpoy1omte fctl()aDtrxmono1opeoioetlslaDulnvo (4aetoirctodop  luei t  eurxopio1ape  fesls)sDumum ;o4oeen fctysfs2ul(vs u4arerxrcia1fatrlnei s) rtmim3iy4lp  mivt tf rraxr no4ape  ietyt mDrmuvpnt4 renxo3oadla  livi t)srto(m3ou1ol emfvtlt s2ururoot4apt  ociatlm2um(vp u)aexoxfcia1opD  nvils srtmxmpno1lmt lneiatf 2rrx poo0olenmoetasfm2em( snt4 lerxo oy1laD  i olt0s2umim iu4lpe  ivtat)arrm(mp;o1oee  ieias a umn p t4treoif3totlmDrai i;(0sruoiopio4ope liet (f rumxrpno4teeo f3iadfm2el(vont0 etoxf iodfp elnvo t0trtmxo3ou4am nmnvil( arra( pot0aeeo oeias aDrm( p u)tetomf3oadoat  ieo;t0 2trirpoudap n feta(  rrrxrpnu1oexo i3iyt m elnvs (0 lxrmociytfpD  ueols0sruriopiy4lltnlfeslt a2umxmpnt0aetn iciyd s emuvo;u0tlerxf oatfpDelnei ( srtrxo3iy1lm n fvt t  2tmum ;t1olxn i3tytla ulnvs t4 exnif ootla ran ol(0 rtr(o iu4omen neta(farrmu  ;t0teeomociatfaDea( p t)tlxrio3iytlpte uvols0 2xrim oodoptn ivs t) 2rrxm ;u0tptomicils s2elnmp u0trerifcio1lmt lnes s0 2toxo3oodomee nvi s a2rau pot1opxoio3ilt a2rln snt0aetrir3ia1oa  aueo ()t2trxm3iodol nmnviatfarur(m nu4tleo fetytfm rluvp t0tlerir3oodlpD  uvo;t) etoir3ny1llenlies sfaDtrurpnt4teen o3iytfaDrau pn()arenif to1lm eanes;t)t2xmim oo1open ivtl(f 2rrx onu0aexoioctltls rlu p;t4alenmociodlmteluvsl(0t2xoxr no1optemnvsl(  Drru poo1olxomf3ilt m ranmo;t4tleoirctytopte i ils)texr(mpiodlptn ivsltfaDraxm nt0olxn o3iad a2um(vs (0trxrxrctotfmDelu o t0 etmir3ou1open feias a2trxmpot0oet io3tltfm el( pnu4 etomrcto1omDe uvs t0 2xo(rpoo4apenmnvtl(fartax  ot4oexniieilt sDulu snu4 rxrmf iotla rli s;t0trtrio ny1optemfei (fsDta(ro;o0apto f3iydfsDrm( o;t)teenxocootoat lnvo t)s2tmxr3oy1apenlncta()sDumx  ;t0aeenio3tlsls ulu o;u0aetrio iotlpte nvs;t  2ur(opoo1lm nlnes ( artrxmpoo1tee mociltlaDrluvon(4 rxnxo oo1lm rlu i;s setoir nu4ome lieil(faDur(rp;t1alen o3tld aDulnvp t4arxrifciatfmDeai i;s0 rxoxo3oo4apt mfesl( a2rm(ro;u0oexn fciydfsDel(mp;t0aeeoxociy1lat ai s;s trxo(o3io4omeelfesas)srtax pnt4alto o3iltfs2elnvp (4 ltnir3tadfaDraivs;t0trxmio iu1oltnlfvils sDrm(monu4opx  ociyd sDrln pnu)teeoir tytoptr neils0 2tr(r iu1ll  liviatfartm( p;u1apeo i3iyt m uauvo;u0altnifctotfaDelnei t0trumim io4altemnvsls)a2tm( ooo0tlx ioctls s2rl( pnu0alxnxo tydfmteluvi;t)sexoxr3no4opeemivsa()s2ua(mpnt0alxo octlslmDrlu pnu) rtnir3oadomD  n i ()srumir ou4al emfet ( sDraxrpoo1oltn fciatls2rm( ont4trtnmf3oo1lpteli ol(  rumio oudomen nei (fsrrrxm no4oltoiieiytfm2ea(vs u4aexoxf iytfpt aieo t)s2ur(opoo1lp   fct ()artr(rp;t0ale iocilsfmDumumsn(4texrxocoatfptraueo;t0trum(opou1llenlivsas sDtru pnu1alen ietlsls2ranmsn(4trtrxr3ta1om e iesls srumim oo1open feta()srta(m nu1apt iictltlm2rlu s u4areomf tytlmtelnvols)t2xo(m3oudlm nlnvia(  2ur(  oo1alenii3iydfm2um(mo;u)aexnmfciatopDr ieil()s2tmimpoy1lp nlfcsa(f 2ra(mont1olto fctyd s2ea( snu4 eenxfciytlpD  ueo;s)texr(o iu4aptemivs sf rtrumpou1tpx mi3tlsla2rl(vo;t4 reoxrcty1optr uvilt)trumxr ny4ll nlnvtls) 2tm(ro;u0apxnio3tld s2eauvs;t0 exnmociatfp eanei s s2toxmpiu1lltn nvt t) Dtm(rpou0oet  ictasla2raumon(0texrmf io1oaD  uvi (0t2tmim no1lpe lies s s2urumooo1alxo i3iltlm2el(ms;u0 ltrmo3ia1fa e u s;t0srurimpiy1lp nlnvs s) rrmurp;u4tltomfetysfaDuanvs;t4 exrio iydomDeaivi;()sruriopoy1apenmneiatfs2rrx  ou4optnifciysla emnvonu4arerxfciadfp e ivi t0 rxrxm3iu1ol n neil(  2raurp;o0aet mf3iysla2el(ms;(4 eenmo tadlm  lnvo;s0texmxmpoudal emiesa()aDtau p;t1tlxn i3iydlsDeanvp;u4artoxf3io1oa eaieo s)s2xo(o3oudlpenlnvia(  2tmxrpot1tetoii3ilsla emuvpn(0trxnif iydop e neo s  rxmirpnydolen fvs s  Dumu  nu1texniiciys s2um(vonu0 exriociytfmtranvil( srum(m3io4ape  ivi ( sDrrxmpnt4aptn f3tyd mDuau s t0 eeomfciatla r ueo;( trxr(r3nydoptnlfci s  2umxro;u1ope mfeilslm umn sn(0tetnirciatfaDe nvs t)trumio ny1lp elfet (fsrrrxm ou0tpt  f3iytfm2elumo u)artnmf oa1oaD ln il() rtrirpiodlp  livi (  ruax  ;u0aptomfciadfm2umu p u0tlxrif3oy1lmtraues;s0 exoxopnudol nmicia(fs2trxr no0olen ictldla ul(mp;t4aexoioctotlm  lu s s0 2uoimpiu4apenlieiatfarum( ont0aeen fetas aDrl( s;u0aetrmocoydfaDe nvs t0 rurxrpoydll emfcsltfarra(ronu1aetn oeiadlm2uanms u0aexnmf oadomt  nvi;() exrio3nu1lpe  iet tfsDtax  ;t0apxnmiciysfm2rl(vp t4aeermfciadoat ln ils) rtm(rpiy4apeelnes (  Dur(  nu4tex iociasla elnvp u0tltrif3iy1omDelnei ()tetrim3nu4amte neia(  2ta( pnt0oeenii3tad m emuvo u) rxnxociydomtrauei t0t2urxm oudop n iesls)a2tmu oou4tpenif3ild sDrm( o;u0altrif3iodlp rlnvols setrxm oodlme micsltfarur(mpou0apeo ocils sDranms (4arermr oodlm  aues s0 rxoirpoo1omtnlfcsas srumx pno1aexoifeiytfm2um(ms u)arxoifcto1lpD  uvo t  euo(mpiy4aptnmfctl( aDurxro;t0aetn ieiys aDelnms;t4 rxomo oodlp r uei;( trurio3ou4lmenmnvias)sruaur oo0tpx if3tytfs2rmumonu)trxoxf3tadomDe ues t) rtrxopiu1ale  fcta(f Dtax pno4tlx iietas s rmu s;u)tetoiociatoa   nes t) 2tm(mpnu1lptnlicsltfaDuau oou0altoiicilsfa elu s;t0arxrif3ta1lmt auvs;t)t2xr(r oudame licia(  rurxrpno0tex miciadfsDrmnvo u)texoxr oydlp eln o s  2urirpoudlpenmnvilsfsDuau pno4oeeo f3iadfm2rmnms;u0alenio oydom eaivi;s srxmxrpnudolee netltfaDra(  nt1aleo oeildla umums;t)trtrifcio1oaDelnes;()srxmxo iudlptemnetls)s2urxm ;o0apeomf3ias s elnvpn()trenxf ty1fpD  ueo;t)seuoirpou4opt mnvsas arur( oou1aet  ieildlm ean s t)texrmf3oadopDraies s) eur(opiy1oltelfvslt)artrur ou4alxnifciltfa2ra(vp;u0 eeomo todomDeau olt0 exoxrpiy1amee ieia(  2rmx poo0aptn fctas s ra( s u4tetnmf3ta1omDrlivils  exoim3ou4ol e neias arrau ont0tpeo oeiys s2ea(vp;t) exomoctodlmDr u i () rtm(m iy4lltnlneils) Drmxmp;t4optoio3iadfm2umn o t)tetrxfciodlat au i;(0 euo(m ou1am   ivsasf Drmumpou1tpeoiiciytfa2ul( snt4trenxf3oadoatran s t) etmxopnu4alen ics t)srrm( p;o0teenmfciltfm2rmnvs (0alxoxrcoo1fptrlueols)t2tr(m3ny4ap  mneils)a2taurp;u0oet  f3ils m2uau o;(4areomf3tydlp  lnes () exrxm3ou4opt  netlsf Dum( oou0opt  ietytfa ea( pnt)artrmf todoptrlu o ( s2trim3oodlmenmivtat  2ua( pnt0aexn oeils a2eln p;u0 reomo3oodlaDr u ols0 exmxopio4ome lneil(f 2tmx  ;u4opxomfctaslm2elnmo u0 lxoxfciatomDe u i;s0teuo(o iy1amte net tfarrrxrpot4oee  ietatfa ul(vs;(4tlenxrcoo1lp elneo (  2umxrpio4lptn fei () ruau  nu4tle iictldfm2rlnvo;u)tltnxfcia1oate ueo;s0srtm(o nodale mnci (f rrmu oot4optomoeiasfm rmu ont0texnmf totlpD au s;(0t2xm(o oodllt liet t)srua(rooo1tltoiicias aDuauvp u)aleniocio1fateluei;s)truoxmpny4al   fctl(fartaxm ot4tlt ioetydfm2rmu p;u4aetnio3iadla rauvsl()tetoxrpou1llt lfvtlt) 2um(  oo1alxomocild a umnvont0arxnmf oadlp   ivi;t) exm(r nu1ap n nvta( s2um( ont0opxn o3iydfm2ra(mp ()trenmocoytoaDe i o s0 rumxr3oo1op   ncil( sDraumo;o0texnmo3iad aDeanmo;(0arerxocty1oa  lu o (0srumxm no1omt mics s arrr( oot4oetnio3tydfaDrauvont) eeomr totopDe nvo s)s2xmiopiy4ap nmnvtls) Dtm( pnt0teen o3iytfmDuaumo (4tleomr tytom e i s ()teurxo ou1al  lfctatfsrtrx ono0optn ocild mDua( pn(0artnir ia1lpt aiei ()teuoxrpio1ole  fcsa() 2ta( pno0olt  ieiasfm2um(vonu4altnxf3oo1om eliei ( s2xm(rpnodomt  nviatfarua(mo;u4oex  fetad a2emnvsnt0arxrir3oodfa  aueslt0 rum(r3iudlleemicta()srumumooo0alx moctltlm rmu pnt) renmociadlm   iei;t0srxr(m no1ol nlnvsat srrr( o;u0oee  f3iltfm ea(vo (0trtoirciodfaDr ieo (0tetrxo3oy4apen fvslsf rtm( p;u4tlenmfctlt aDelumo;(0artrxrctotopteln s s  rxm(rpou1lp elnviat srumumo;t1tlxnmiciatlsDea(mp u)arxrxfciy1lm rlnvolt) exr(opiy1lme mncsatfs2ra(  no1tlxomieiadlm ra(msn(0arxnmo iatfp e n s t)s2uoxmpou4oleelfctas srrru pnu4optnmfeiys a eln snu)trtrioctodlatr nvi;t0 rtoirpiu1ll n fetls) Dta( pnt4apx  oeild a em(msn() rtnmr iydfpD lieil()setoxr3nydopenmivsa( s2rrx o;o0tptoiiciatfa2ra( pn(0tltnmf3oy1faDeau slt trumim3oydllt mieta()a2tru  ;t0tptn f3iys a eanvp;() rtoif3oydlatr ies;s trumir3no4lltnmfvt s)aDta( o;o1oexo f3iadla2ean p;u4 lxrif3ta1fpDelues;t0 etoxrpio4olenmietas)srtrumono4tpxnmf3iltfs ea(mo u0trerifcty1faD  ieo (  rtoxopnydol   iesa()sruaxmpoo0alx mf3iadfaDumnmsnt4areoioctadlmt lnei;( seurimpiydlp  mfvslt srraumono4oleoioctytlsDua(vsn(4tlxomf oo1om   ivols  rxr(r ou4am e feil(fs2urx  nu1tpen ietyt s rln on()trxoxo iytfm  liei s0sexmxrpoy1olte fesls artrxront1oleoifeilsls raumon(4tetrmr iytomDeau slt  rtoiopnu1optelivs s sDtrur ;o0tptoioetasfs2umnvo t) eenxr3iodopDrlnesl( teuo(mpiy4lp nmfctlt) Dtr(rp;o4tpxniiciatfmDrm(vo;t) exnxrctatlp  li o t0srurio nu1altnlfeilsfsrrmxrpot1oltnifciltlm ranvp t4aexnmrctodlaD ai o;(0 rxoim3nu4amen fvsls) ruaxrpou0tltomfciatlmDuauvpnu)tlxoxf3tadfat aiei;s  ruo(m3ny4ome  nvi (  Dur(root4optn f3iadfa2rlnvs (4 rxomociydom  an s;t0t2toxo3iy1llee nvt sfs2tmu  ou1aptoifcild a2umumpnu0 ltomr3iy1opt au i t) rxmxr3ou4lle lnesl() 2tm( poo0olen fcild m umn p;u0trxrxf3ty1lpteaivil(0 exrxo oy4lm elici s)aDtr(moou4alenio3iatfs2rau s t0 lxnxocoydoa ran olt0srxm(o3oo4ope lneta(  2uaxm ou1apenmfctatfs2rauvo u0 ltrxr3oo1fa   n i;t)setr(o3ou4lmt licsa()a2tm( o;o0tee moeiatls emuvo;u)tlermo oa1op raivol() exrir3io4lpenmies s) 2uru pot1alto ociys m2umn pn(0 rtnxrctotom r ieslt)trtoxm io1lme livsa(  ruau  no4oeenmfciltfa2eaumo (4trtoifcoytlptelueolt0seum(r3nudlpenlncsat srrmxm ;t4oet moetlslsDuaumsn(0trtrif3ia1oaDrli ols0 rxm(o nu4ol emnetas  2ta(  nt4apto ieiltfa2ul( s;(0 rtomocoadfm  li ols0srtr(mpoo4amt lnesltfsDuau  nu4tpeo fciadfaDra(vsnt0tetrif3ty1fmte n ils0 exrio no4lmee nvilt  2rax ono1aet io3tltla em(mp u) rxnmociy1lm e neo s0s2xr(r ou1ame  nciat arrmxrp;o4tptnmoeild a uanvpn() etrifctadlmDrauvols0 etoim3no4am emnvs (fsrtaur nt1altn i3iyd a uan p u) rxnxf3oy1om r neo;s0 2xoio oo4oleelfvtl(f 2rmur ;u4optnio3ilslsDrmnvo;(0arxrmr tytoatr nvolt)texrxo nydomtelivsl() 2rmx o;u0opx  ociydfmDuluvo t4 etrxr3tydlmD li s t)srtrxmpnodlp  lnvtl() rtr(rooo0oetn oeild m ulnvs;u0 lxnxfcoydoat  nvo;s0srur(m no4ol nmncsl(  rra(m ;t1apxnioctadls2rm(mp;(4texrxo3ootom rln o s) 2urim ny4lm elneta()s2tmur nt4aexomietltfs ua(vo;(0teeoxocoytlm e n s (  euoio3io4ll  mictlt a2rmumont4oexomociytlm eluvon(4trtomocty1fmtrauvi (  2toxmpoodoltelfvil(fsrtrx  ou0tlt  oeiad s ul( pnu4trxnxf oodlaDr uesls) 2xm(o3ou1ll emnvtlsf 2trx  nt1apxomfciytfa rl(vsnu)tlerxrcoatlmDelnvs (0 exoiopoy4ole lfesa(f 2rru poo4ape io3tad mDul(mp ()tlenmrciodlmt anvi;t)srxrxm3oo4llte iei ( aDraxmpnu0tex mf3iltlsDeanmpnt0teerxfcootlpDe u o ( sruoxmpny1alt  ics (fsrumxmpou0apenio3iyt a elums t0 ltnxf to1omtrlivs s0setr(r3nudam elivil(f rrr( poo4tle mfctys mDeaums (0aetrxr oy1omDelu o;s0trtr(r oy1lpen nvs tfs2rau pnt4oexo fciat s um( o u4 lxnxo3iatfaDrli ols)srtr(mpoodopt lfet tf 2rmumono1olt ifetld m el(monu) rxrmf to1fatr n slt0 rxr(o oo4lle lici tfsruaum ou1alx io3iyslmDrauvp;t0arxrmr3oa1fmtrln i t0trxr(r3oy4apee nvtl() rraxr no4alxo f3ilslm elnmo t4 eeoxr oadlpD  i i;(  2uoio3iodaleelncta(  2tmx  ;o0aeeoioetld a2em(mpnu0 ltnxociodlmte uei ()srxrio3ou4lmtnmivia()s2rmx ont1aeenifetlslsDumums t0 lxomf tatomt luvo ()t2tmxo iodolenmnviasfarrrumpnt4opx if3ils s umnmo;t4aleomrctatlpDeau ols) etrxopou1ll emict s)s2rmxrooo0alx  fciad s eln p;t4aleomf to1lmt an i;(0 exoxm iudlltnmfcsl(fa2uaxrpou4teeomicilsfsDuau o t4aexnifcio1fp  li o t)s2toir iu4llenmietat) 2ra( oou0tpenio3iaslm rl(vp;(0 rerxf oadfa r uei s srtrxm ny1lptnlivsasf rrmxrpnt4oetnmoetysfs2ul( p u4 ltnmfciotfpteanvo;t0 rtmxr ou4lptn nvtlt)srur(moou4alt  octat mDrmn o;u4 exoio oa1fm rai ilt0srxmxr ny4oltnlictltfs2tr(rpnt0oee io3ild m eln p (0altomr to1fpDelivi;t)s2xo(o3oo1ole livsl( srurx o;o4tetomociydfaDem(mo (0arenxf3tydomt  nvs ( texr(m3iu4aptnlfvtlt) Drmum ;u1oeeo o3tadfmDemuvs (4areomrciotfmDe u olt tetmir nu1olenmfcsa(  2ra(  ot1optnifeild a ul(vs t0 eenxf oadfpD an i;() 2umxr3oy1ol   nvsas aruaur oo0olxo o3iydfm2uan o;t) rtoircoatfaDranvolt0 rtrxopoodol n fesl()srrrxroou4tlenio3tasfs ul(vsn(0alxoxfcty1lmDrlieo;s s2tm(o3oy4ame lfesltfa2ta(rono0tpeoio3iadfsDea(mo;u0alerxr3oytlp elivs t0srumxm3nu1omtnmictasf rrr(mono1ale mfciysfs eaump;t)tltomf ia1lp eai ils)sexmxo iu1lp  mfcta( aDtm(rp;u0tpen iciys m2ea(ms;u)tleoif oytlp rai i;t)s2tmiopoydaleelivtls)arum(r ot1apeomocias s2ean o;u4tltnxf3oydoaDr ieo t)texo(r3no4lltnlivsltfaruau o;t0alxo ieiatlaDelnvo;u) reomr oo1fpD  ueil(0s2tmxopoo1lm n nes s  rtr(mo;t1oeenmoetlslaDumnmo u)tleoxfcootoa eauvslt0texm(m3oudlp  mfvsls  2ua(mp;t0apto ociydfaDemumo () eerxrcoatfa rlieo;t) eum(mpoodop  mnvsa() rurumo;o0aeto iciyt aDuan s;t)aeenmf3oatla rlu o t0 2toimpoudlmen nctat)artmx  nt4oexnmoeiadfa2umuvonu)tlxnxf iodomt  ivi;t)sruoirpny4oltnmfes ( sDuaxrooo1aetnmociytfs ra(vsnt0alxrmfctytoatr ueilt trtm(r nodal e neiltfaDua(moot0opxnmictytfa2rl(mont)aeenmo3tytla  lieilt) exrxr3no4alen fvsls) rta(rooo0apxomocilsfs2elumsn()trtoif3iydom rlu s ( srtrxr3no4ap emies (f 2urxmpou0olx ioetas m rluvp t4 exnmo3oodfm raneolt0s2umxm3nydomt  nvilt)s2tmxm ;t0tet mietld a ul(mo;u0teenxo iodopDeaieils s2umxo nu4llenmnvil(faDtmum no1olx mieiyt aDeanmpn() exrio oo1opte n sls)t2xm(r3iy1lle  nvsa(fsrtm( ono1oetn o3ildls2ua( on(0alerxo todlm e u sl() rtoiopoo1om nmivslt)sDurumpou4tlx  oetlt sDua( p t) ltnxr iytfm  li o s)texmio3ny4llt livs s aDra( p;u4tlx iiciytlm2ranmo t0trxnmf iy1oatr uvo ()sruoxr3io1olt mncsl(fs2uaumonu4opto ieiyslaDemnvo;t4 exrio tytfm ran s;(  2uoxo3io1ap  mfcs s)sDrmurp;o4texoio3iydfa2ranms;u4arxnxo oydfmD luvi;s) eurio3nu4ap emietasf Dtmxrpoo0tpxoioeiltfsDuau snu0tleomf3tadlpDelu i t  etr(o3ou4aptnmfcilt)aruaxmoou1tex ioeils sDuanmp t4aeeriocoy1faD li i (0setoio3iy4apenlfvil(faDtmxr nt4aptn icilt sDel(ms;u)tleniocootop rlieil( srtmxo io1lltn fetl( srumum nu1tpe  ieias sDua(vsn(0tetnxf3to1om eln o;s)t2urimpnudlleemfcs sf Drmxrpnt1tlx  fciad s umnvs (4arxnmo ia1faD  uvs;(0t2xrxrpoudomtelnvtls arrr(m nu4opxn icilt sDem( o t4texoxr3iy1lm r u olt0srtmiopnu1ll  mnviat) rrax o;t0opxo iciyslsDuanms;t4 reoxoctytfpDr ieo s)srumir oy1am e icilsfarrm(m ;t4opx ifciys s2rl(vsn(0aleoif ty1oaDrln sl( seurxo3io4amtn ivtasf 2raur ;u0oet mietydlmDua( o;t)altrxr3tatlmtranes t)s2trxo3iodapeelfvt s)sDua(m nt1tpxnmi3iasls rmnvpn() lerioctadlatrau ilt0srxr(o3ny1olt mivsa(faDrmx p;u4olt ii3iasfs2ua(ms;u0altnxfctadla e ieolt  2to(opiydap nmneilsfa2rm(m nt1olenii3tlsla2rmu o u) leoxfcoytoaD anvsls t2to(r3nodlme lnct (  Durxmoou0olxnmi3iasfs umn onu4 exrxociytfpDe ieo;t  exr(rpiudolen neias srrm(  ;u0oltomietyt m uau pn(4alxoxr3io1lp r ieo s0t2umxo3iy1am emnvilsfarraxrpnt0opxomfctydla ul(vpnt) rtrmf3todfp  au o s) rumimpiudam nmietl(faDtrx oot0tee  ieild a rmump;t0alxnxf iotlpD  ieo;s)tetrxr iu4alt mnvta()srraxmono0tlxo o3iys s eln o t0trxnxrcoo1om e ieo;(0truo(o iy4lptemiet t) rumxm ;t4tpenmieiyd m2ulnvp t4aexoir3tadfptraivi;s)srto(o iu1lp nmnvtl( srraum nt0opxomfetytlsDeanvp;(0trenxfcoytla eanei s) rxrxo3iydlmt  net t)s2rrxrpou0oet iiciadfa2em( s;u0aexrmo iadlptrlu o s)texmirpiu1lpt  fvs t  2umx pnu1oexnmoeilsfs2uanvpnu0tlenif3iytlmt aivs;s t2urim iu1lpeemiesls) Drm(r nt1oeeomi3ils a umn p;u0 rerir todlmDelivi t  etmim oo1op e netat  2rruro;o0aptnmf3iysfs2ean o u4areniocta1oa rluei s0t2uoir iodlm  livia(fa2rr(moou1altomfcilsla ul(mp;t4 leoio iydfm r u slt t2xr(mpoudam elfcsa( aDtaumpoo0tpt  i3ias m2eln s t0 eermf3tatfa  li ols  rtr(m3oo1oleemieias aDta(  no0altnmfeiytlmDrlnvs;u)trermocio1fmt auvs s0srurxopoudlptemfcsl(fsDrruro;t0apxnif3tltfa2rmu p;u)trxoxrciytfp ranvs s  etm(r no4lmenmnet s  Dtm(m ou1tlx  f3ilt sDuln ont)tleoio3oa1oaDelnesl(0 2xoir nu1lpe lnetasf Duax pou4oetoii3tlslaDemump;(4 lenir oodlpDe uvo (0trurxm3ou1al nmnet s) Dua(mooo1tpxo iciatfm emumont0trtriociotlatr ueils)t2xoxr nudolt lfesat  Dtr(m nt1apxo i3ils m2emnmp u0trtoxf iodfaDranvo s0 2xr(o3iu1openlnctls)sDtru onu4aptnmf3tltfm ra(vp u4trtrxo oodlat aies;s)srxm(m ou4om  mnvsas)sDum(mont0openifcilslmDelnvo u) exrmfcto1la  aivol()srtrim no1apt  ivsltfa2ua(rp;u0tpt io3tatlm rm(mo ()aexrif iatfmt  nes s0seuo(rpnydlptnmici t)aDrax  ;u4aleo ictysla2rluvo;(4tetnmocootlp eaivs s0texoxopoudlp nliesas) 2ta( pno0tpe mfeiytfa2elnvont0aeeoxf ia1oa eaueol(0 euoiopoodlpt lnci t)s2rrxmpnu0oltoiocildfa ulnmont)arxnmoctydlp rau s;t)sruoxm3iu1altelfet t) rtrurp;o4alenmieildfs ea(mpnt0trtrmfciodlp rlu s t srumiopnodal e nvsatfsDtmuront0tlenmi3ild mDulnvo t0arerxfciatlmtr ueo;(0sexoxo3ou4amt  ivsat)arumurpoo0aetn i3iytfs2elumon(4trxrmr3oodoaDraueo t)sexm(o oydlp  mfes t sDraum oo4tpxnmfctysfa rmn snt)texnmoctodfatrlieols)tetmxm3io4lptnmfci s  Durxmont1ole ifeiydls umu o t4aetnmfcoy1lm eau o t0srur(o3io1alte fvia()sDrmur nt4texoif3ils s2rmnvo t0 exnxf tytomD aies ( tetm(m3io4lle  nesltf 2rr( oou1oltniieilsfa rln p (4teenxocoodoatelu o t srto(m oodlmtelfcil(f rrmu onu4alx  i3tatlm2emnvonu4trxrio3oa1lmDeauei t0 exrxr3io4lptnmnet (f Drax p;o1tetnmoeiltlsDumn p u0alxnifcto1om eanvilt0trxmio iodol elfct t a2tmu pno4teeoifetyd sDuln p;t)tltoxociydfp   u o (0 2um(r3ny4ope  fei t artmxmpot4alt iieiysla2ra(vp;t4trerxr3iytfpDrau o;(0texmim nodlmtn icia()a2urumo;o1alxnifetas mDelumo;t)alxnmf3ia1fpDrlnvi ( setm(m3ny1ome mfvtatfartm(  ot1opt  ietyd aDranvo;t0trxnifctatfmt luvs () rxoim oo4op emnvils)srra( p;t0oeenmo3tasfs uln o ()trtrmrctatfaDr u i s)sexm(o iudoleelivtat) 2tmx pnt4tee mo3ild m eanmsn(4aexoir3tydomtranei t  2um(o iu4llen nvt ()aDur(r ;u1openmfeiytfs2rlnvont4alxoxoctodlatrlu i;t  2tmxm oydap emfviasf Duax oot1oetniictytfs2raums u4trtoio iy1la   u ols) rumxrpoy4ope lneslt  2trxr ;t0teen octldla ulnvsn()aexrxo ta1fp rln i;s s2trio3oy4lpe  feslsfa2um(moot1oeeomf3iytfm2uau p (0artoio oytfpDrlivs;(0 exrim3iodlm e ieia(f Durxronu4aetnmoeiysfm2emnvsnt4arenxfciodlaDeauvol( tetoxm3ny1al e fvs ()aDtaur ot0apt ioctyt sDrl(mp;u0aetoxf oodoat  i o t0t2uoirpoydlm  liviat)s2urxm no0aex iiciyd a2ua(msnt0 exoxo3oy1fp e ues () exr(o3oo1llen neta()srrr(mp;u0oet  i3iasfsDum( s;u0 rerxfciy1lm  anvsls)t2xrio3oodope mfct (f rum(mp;u1tlt mfeiltfsDrln s u4 ltrxrcoy1fmtraieo ( srxrir nu4ope lies t sDrmu  ot1optnmfctltls em(ms;t0 rtrmf tydfmt an olt srtm(opny1om nmfctasfa2ua(m ;u1alx mi3tadla em(vp (0tltoxf iydom eli o;t  ruoxo ou1llt  fvt ()sDum(  nt0oee iiciltlm2rm(vs (4arxoif3iatlmtelu sl( texo(r3io1lm  mfetls)aDrm(  nu1olt  o3iyd m ul( snt4 rxrmf oydlmDelueo s)srxrir3io1ame  icils aDtaum no1aeen o3iyd a el(mp;u)tetrxr3to1lmteaies;t)t2uoxrpiudlm emfcsatf rtaump;t4tpxnmfetadla ea(mp;u0 rtrmr3iydom rai s t0trtoxr3oydlpeemfvt t srtmxmo;o1teenmoetasfaDuan s;(0 rxnif iotom   ivolt0teuoir oo4omtnmivs ()sruaum oo0opxomociysfa emu s (0texrmfcto1lpteau o;s) exrxrpny4apenmieiat arururonu1oltn fciytls2ua(vs ()aetoxrcootopDean s t0seur(m3nodapt liesa()srraxr oo4oeeoif3iyslsDuluvpnu0artrioctodlmteau sl(  exoxmpiy4lptemivtat)s2tr(m nu1apto o3iytfs2rln snt)texnxr io1lpD ln olt) ruoim iy4op  mfvsat)aDtmu pno1opxo f3tyslmDel( o t0texoxr3oadoat anvs;s seur(m ou1lpe  nvils  Drax ono1apeomieiyt s eauvo;(4arerircoodoaDrli s s  2trim3iodoltnmneia( srtauroot1oeen feiasfs2eau o;t4altnio3todla r neo;s)s2urxr3oy4ol  livslsfarrm( p;u4aexo fcild m rmump u0aexriocoytfm eln o t0sexm(rpoy4al n fcs (  Drr(mo;t1opxnmoeiad s rln o;t4aeenxf oydfm rli il( srtrxopnu1op n fcsat s2ra( pou1apx ii3iad m uau s t0trerxo3oodop ranvs (0sexm(m3ny4lltnmfvt tfsDurxm oo0apeo octysfm2rmnvs u4trxrmrciy1lmDr nvi t0t2uo(r nu1lltnlfci tfaDtmxr oo0tltn feiyd s2rmu o u)aeenir oodlp raueolt)srtmim iy1ll e nvs t)s2rmu  oo0altomi3tadlm eanvp;(4aleoif3ootom e ies;s)texrxm3iu4altemfetls) Drau ono0tpx  i3iysfsDuanvsnu0altoxo oy1fmDr ieilt sexm(m iudlp e nvilt) Draxmpou1apt  fctydls2em(vp;(4 lermr3oadlmt an s t setm(r nydlm nmivsas) Duru o;t1opx miciltlsDra(mo;(0 rxrmo oadfpDeaies t  ruoir3oodlleelfviat)srrm( ono4tex moeiytfm2ul(vsn(4teerxo3iy1oa rlu il(  2umxrpnydllt  ivsl(fs2rru  ;u0oexoiietydfaDrl( o;(0 lxrmr3io1omtrlu sl() rumxm ou4op nmietasfsDtmumpno0olxnif3tadlaDel( pnu4 rtrircio1fmtranvilt)seurxrpoy1al n fvi t srraum ou0alxnif3iltfm2eanvs;u4trenxfctadfaDr n i t)srxmirpio1lpte feias) 2rr(mpou4tpx iociad s umnms;u0teerif3tytfp rluvs;( seumxm nu1om  mfetl()aDumx  ou0tlxnmi3tad m umnvs;u) lerxf oo1optelnes s) ruriopnu4aptn fesat  Dur(ro;t0apxnmoctydlm uanvs;u0 ltoxo to1laDelieo (0 eumxopoodlpee fcsas srra(m no4oltn f3iyd s2rlnmp;u4 lenmr3ty1op e uvslt0s2xrir nodol e ieiltfaDumxr ot0tlxnio3ils m2uan snt)teerxrcta1laDr ieo;t t2tmxrpiy1ol  lietls sruauronu0oeeomociydfa ra(mo;()aeermo iodomDeluvols)t2umxopny1llt liet ( srtaxrono0oetoio3tysfaDuau onu4 renio3oo1lp rli il(  euoio ny4opt lfei t) rtmxrpou0tle io3iatla ua( o u4arenxf oy1opt  i s;t)s2xmxm iy1lptn nvs s s2rm( pno1apxoiieiydlm2eanmo t)teeoiocoytfpDr ues;(0 2ur(r3oo1ape  fcia(fsrrmxrono0tetomiciytla elums;t0altnmocoytfpt  iei;s s2xmxopoy4lleelnvils a2tr(mpnt0tet mf3tlsla2ul(vo u) reoioctydfmD  i ols  2um(rpoudlm elnvil( arta( onu4oexnmf3iytlmDrln pnt)alxoif io1fatr n o;()setr(m io1amee neiatfs2um(mpot0opxniictlsfsDum(vo (0aeeoio tydlpDeli s;( seurxmpiydlpenmfetls sDtrumpot1olxoifeiltlm rluvpnt)alenmoctydfp   u ilt0truoim no4ope lneils srtrumont0oleo feiasfm2ul( pn() lxomoctytlmtr ueols srtm(m3nydopt lnctls)s2uax p;u1aexomoeiytfs umnvs;()trxnxrciydfateaueo t0 rxrim3oydlmenmivt t) rtrumpou0opx  feiasfs2ulnms t0artnif oodopteaues;s) 2umiopny4alt micsl()a2tr(ro;t1opeo ictas a eluvo;(4aetrxoctydop eauvs;s)srur(opio1amte fetat  Dumurpot1tee iieiasfm emumpnu4tlxrxrctodlate ueilt)srtoxm3ou1alenmnvtasf Duaxr oo4texn fetld sDuanmo;u0 exrxr3oo1oaD an s;s0trxrir oy1lltelivils)s2trx  nt4tlt  oeiyslaDua(mp u4aetrxf iadoa rlu o (0 exrimpno1ope lieslsfsDtm( pnt0tpenmi3ilsfsDulnvs;u)texnxrctadomtraneo;t)sexrir3iydlmen icta()sDtmx  ot4oltn o3tasfmDum(mp;(4aetnirciydop  lnes;s  2xmxo oy1ol e ivsat) Dtaxmo;o1tpe if3iatfmDemnmo u0alxnxr io1fpt ai olt0 etmirpnydlpt lnvs s)a2taumpoo0teeo i3iytfs2ul(vo t) renxo iydfpDeluei t  exrimpoy1amtelivi (f 2ur(r no0tle  fetytlsDea(mp;t0tetnmf3ty1laDraiesls0 2xoxr3iy1ll nlfct s) 2rmxr nt0opto ieiaslaDeln p;(0aexoif3ia1om rauvi t)texr(r oodolen ivi s srrr( ono4texomo3tld a eln o;u0tltnxr oatfp elneo (  exm(opiydapee ietas aruau o;u4tlx mi3ias aDrm(mp;t)aleoxocootlmDeluvsl( tetmirpio4amee fctat a2uaxmo;o1optnmictat s2rmu o;(0 lxnxrctatomte iei () rtmir iu4apt mictasfsrurxr ;t4opt  ieiyt m uluvp u0trxnir3oodomteai i;t0 exo(rpiu1ame lneia(f 2uru o;o4olxomf3ildfm2eauvp;()tetrxf oo1fmtrluvilt)srur(rpoudam elfcilsfaDtrxront0ole mi3iysla2um(vs;t4 lerif3iy1oaDeaivilt0srxoim oy4ap elivsl(fa2tmumpno1ope mf3ild m2rm
\ No newline at end of file
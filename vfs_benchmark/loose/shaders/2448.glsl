@@ -0,0 +1 @@
+u s;t) etoxo3io1ll emnvi ()artaum ;o0aetnioetydlm umnmont4aexrmr ootlaDr nesl()sexm(r nu4omenlivsa( sDtrxr ou4tltoio3ilslmDrluvp;t4 exoif3iy1la e u i t sruo(opno1ap e fvta() rrr(rp;u1tlx iicilsls2elnvs;(0arxrmr iy1fatrlu o;( s2urim3iy4am  licsa( arurxm ;o0tltn ociysfa ul(mo;() eeoir3oy1laD anvi;()trtm(m3ou4llt  iesls)sDumxmpnt0aeeomo3iadfm2ul(vs ()aeeoif iadfat aueo s s2xoim3ou1amtelivtl( a2ur(mo;t0open fctaslm2el( on(4 ltoxrciy1fmDelu slt)s2toim3io1ll   neias aDrmxm nu0oexnmfctyslm rmnvp;u)aexnxf3ta1oate u o;t) rumxr3oydapenmfcia(farrrum ;t1tetnmoeiysfs2umuvp (0aetrmo tytop ran olt) etoiopio4op emiei tfsDrmxr ;o0tleo fciltlaDeluvpnt4aetnifctatlm eaies (0s2umirpnu4lmen feia( sDtmum ou0aee  o3tyd mDemnms t0aetrmr3oydfp ranvi;s)truo(r nodol   icsas)sruaxm no0tle mfciad aDrlnvs ()alxomf3tydom e i s;t  rtr(o3nu4ame livs s) 2umump;t0apx iocilsls2el(vo ()trxrmfciadlmte u ols)t2ur(r oo1ap   ictat  rua(rpnt1apx  octatlm umnms (0aleomrctatoaDe iei;()srxrxopoy4lp nlfcils arrrxrpou0openmfeils mDrlumo u0arenmr3tatlpD aivils) rxmim iy1apee fes ( srtru  ot4tee iietatlsDrln p (4 rerxf oodlm   uvi t)truoxo iu4ap emnvi sfa2trxmpot0oex  o3ild m2ea(mo;(0 lxrxo iydlptelivo t srxoir no1am  mici s  ruaxm ;t4apenmfeiasla2rluvont0aexoif iodfatelueils t2xoim nu4ome  ics ( s2trxr no4tpx iieiad mDumnvp;(0trtnif oytoatrlnvo;( s2toxr iy4lme lfcia( artrxront4oeen o3iltfa ra( p;() etnmfctotlpte nes s)teumio no1al   ieilt sDtrxmpoo0tlxnioctysfsDul(vp;(4aexoif3iadlaDelivo s seum(opnu1amenmfvsat)srrrx  ou4tetomoeiyt aDrlnmpn(0aetrxf3totfm r i o t seumir3oo4lp emneil() rurx pnt4aeeoii3iltfm2rmn on(4 ltnmr oadfat  neslt0 rurxopiu1lp  lfesls)a2ta(rooo1oet mieiltlaDeln o () eeoifciadfpDelnvs s)texo(r ny4amtn fviat srtaxroot4texo feiyt a2rm(vsnt0 rerxf3oatoaDran i ()srtoxo oudlleeliei t  rtm( pnu0tlenmfetyd mDumumo;u0arxrxo ootlaDrlueils)texm(m3nudol  liesls  Dra(  ou1opt mi3ildfsDemu onu0 exrmocoytomtelu i;t) 2uoxopno4omtn ncs ( sDuaxmono0alt mo3ild a2emu s u4trtrxrciydfmDr ieo;t)s2uoim no1llt lnvia(f Dumurp;u0texo o3ias a2ran s;t) rtomr3oadlmtrli o;( setmim3nu1am elnvsl(f Dtmx  oo0altnmocildls2rmn snu0 rtomo iy1faDrai sls0 exoxr3oodalee fvta()sDumurpnu4tlxomiciys m umu onu4aeerif tytlm rauvolt)teuoxopoo4olte nei s) 2ta( ooo4alenii3tydlm umn o;t4 eenxf3iatfptr uvs;s t2xmim3nydal   nvi t artaxmooo4alxoifeildls uluvo;t0 etrir to1lm   i ils)trtrxo3nydlmt licias srtmxroot0texomieiytfa ulnvsnt4 lxnif3tadoaDr u ilt0s2tm(mpnu4ap elfciatf rtmxr no1aexn o3tlsfaDem(ms;u0 ltnmocoatfa  au i t0s2um(mpou4ap nmies ( a2uaumpot4aee mfciytfm2rlumpnt) eenxrcoy1fmD aivi;( s2xmxm3iydaptn nvtat)srrr(mp;t4olx mictyslmDem(mp ()arenircoydom  li i s sruoxm ny4ale lnvia(f Dtrurp;o1opeoio3ias a2umu sn(0 rtnmrcia1omte i i;t) 2xr(rpou4ome  nesat arurump;o0tpto iciad m emnvs;t4tleoxrciydfp  au o;t)srto(o iu4amen feilt a2raxmont1aee  o3iyd s uauvont)teenxrcto1faDr uvs ( tetr(opnydlm e ietlt)sDraumpot1tlxomo3ild s ul(ms;u0tlenif3iotoat  ivols t2xoxm no4llte fvsl( aDtr(ro;t0tltnmoetadfaDea( o;(4artoxr iatfmtranvols)s2tr(m nudalt  ies t a2rrurp;o1tet mieiatfm2ulu p;t0altrir tytopDrlues;t0tetoim3iu1lpe miei ()s2tr(mo;o4alt micilt mDel(vonu)alenmo oo1lmDelnei s texoxrpny1om nlnvsl()s2ra(ront0tltomi3ils m rauvont)tlenir3iydfa eln o;t) euo(o oydalee nvsat) Dta(mpnu0apeomietltls2umn ont4 lxoxo iadfaDraivs;s) 2trimpnudaptnlnvs sfsDuru  ot0opxo oeilsfa ulu sn(4 etnmr3iadomD ln il(0 2toxmpiu1lmtemiciasf Dtauro;o1olt  i3iyt s ua(mo;u0trxnxrctytomt aivi;(0s2xrir3ou4oleelicil( s2ur(moot4opxoiiciysla2eln s u)aleoiocto1fpDe nvs;s0s2xoxr3iydopt mncs t  Dum( oou4oltn ietatfsDemuvs;t)tlxnmf oo1laDran s t0s2ur(m nodolen fcs tfaDtrumont1opx mf3iat m ulumo ()teeoxf oadlat auvslt0s2uo(rpoy1lp   ies s  rtr( oot0apen fcildfs umumsn()trtoxo ootlaDeauvs;() rtm(r3oo1alee ieias  2urxmoou4alenmfctytfaDrmn onu0texrmo3to1lp r i i;s)seurxr3oudoleemicsltf rtaxrpnu1openio3iytlm elnms t)artrif3oa1la r n ils0 exr(r iydol nlivi s arurxmpou0tetomfciat m ul(vsnt0aetomociy1la   ieo t0s2xr(m3iodlpt  iciatf Dumxrpoo4olen oetydlaDea( pnt0trenmr oytfmDelu i;t  eurir3no4ameemnetl()aDtaxmoot0texnmf3iytla2umums;u0trxniociatoa  aivo;(0t2umir3io1ol emnvt t aDtru  nu1aee  ictydfa rauvs;t0alxoifciytom   nvs (0 rtr(m3io4altelieslt  rurx pnt4olxoifeiltls emnmsn() rxomfctadfptean ils  2xo(o oodomee iviltfartmxr nu0aexomi3tatlaDelnmpnu4tlermfctadom r u slt) rxmim iy4omeelicsas)arrr(monu4optnmi3ilt aDeauvonu0tetnxo iadom   u s;t)srxrxo3nudamt  nes tfsDua( pot4aexnio3iydlsDum( sn(0altomr iytlpDean s;t0trtrimpno4aptelics s aDuaxro;t0ole  oeiltfs2eanvs;t4 lxoxo iodlmt auvilt0t2uoxmpiydomeelici t)srrm(mooo4oltoii3iaslm2elnvp;t4tlxoif todfmtelnvo t  eur(m3no1lmeelnvi tfs2tmxmpoo1oleo icild m2umu o (4aexoxoctadlmteaieol()trur(mpoydom e nct sfarrru  ot4tpt  f3tydlm2umumpn(4aetnir ty1laDrlivs;t)texmxr3nu4ol nmfcils)arrrumonu0oee  iciltlaDrlnvp u4artrio totom rlneil( tetr(o nu4ole liviasf ruaurpou1apxo oeias mDrmnmp t4 etrmrcto1oa   u o s)srumir oodamen nviltfsDtmur nu0aex iieiadfs2ea(vs u0trxoxrcootopD anei (0 2xo(o3oo4amenlivt ()s2ta( oot1alxniietlsfs ranvo;(4tlenir3tytoat aueils)srtrio3nudap nlfcs s  rurx pno1opeomfetls m uluvs t0 lxnmf to1faDrlnei;() euoim oydal nlics t) rtmxm ou0apto oetysls2rm(vp () rxoxr3todfpt auvs;(0 euoir ou1lm nlfetlsfa2rru o;u4altomfciys aDuauvp;() rtoio tatomteanvsl(  2uoio3iydapee neta() rta(m ot4tetnifetadfaDrmnvp (4alermf iy1lp  lieils)trum(mpio1op  mfvsa(  2ur(r ;o0oex moctysfm2ua(mp;()alenif ootomD auvol()setmxm iodap n icia( a2rrx p;u4tetnif3iyd s emu o;u4treomr tytlaD  nvilt)trxrxr3oydaltelivt t) Drm(m no0oleo i3iltfsDelnmsn()tlxnmo3ia1fmD  ivols t2xrio oudomtn fvil()aDtmumooo1alxnmi3ildlmDel(vo u0tetrxocoodlaDeauvi;()tetrir3ou1amt micil() rumu poo0alt  ictatfmDemnvp u4tltnxfctatlpD anesl()seuoio3oodllt lici s srumx poo4alto oetydfmDra(mp t0 lxoio iatopt aues;t)t2tmxrpoodamen iei ( a2rr( o;o0tpe if3ildlm rauvs;t4 rerxf totlmtrai ils0 rtoir3io4lle  fcs t)artaxroot4oeeomoeilslsDean snu)artrxo3oadlat lieo ()s2tr(rpou4openliet s artr(  ot4tpxomiciatfm2elu ont)alxrmocta1op r ueolt  rumio3oo4oltn fctat) Drm(mooo1tpeomi3iysfaDean o u0 rtrxr ta1lptr nvs;(0 etoimpnu1olenmneta(faDumumpou0oltoifeiasla2emnms () etrxo3iatlatr uvslt s2uo(mpiydlpenmivta() Duaxr nt1ope mf3iadla2rmnms;u4aexoxr oa1fmDranvi;(0s2xrxmpoo4optelnvs tfa2ur(mp;u0tlenif3tldfa2ul( o t0arenmrcoatoa  lneils s2xr(r no4lmt lfviltfa2tau  ot1opeoif3ils sDum(ms;u0aetoifciadomDelnei;(  exmio oy1llen iesa( s2um(ro;u1tltnifeiltls ul(mp;(0 eenmfcoy1opte neo s s2xrim oo4ameemneil()a2rmx  ;o0tlx ifetlsfaDrl(mo;t) exrir ta1opteluvol(0 rxr(o3iydomeemfvi t)srraxmoou1oexo iciydlm emums (0aleoir iotlm r nvs;t0setoxm3oy1om  liesl()s2rmxmpot1apenmiciadfsDemumsnt4 exnmo to1fm ean ol(  eumim3ou1ap nmnvi (  Duaxr ou4olt mfetldlm2rm( o;t0teenxo3totla  liesl(  exm(r nydop  mfetat a2umumpou0open iciadlm2ua(msnu4 rxrmr3oa1lpDeluei t0s2umiopoo1om  lfetl(f rtaxrooo0alt moetas a2rm(vo (0 eermf ia1lptraueols0 rtmxm iu4al   icsat) 2ta(ro;t1tpx mocild a2umn o u0teerxr3iadfaDelu sl(0setrxo3iydap elneia(fsrrm(ronu4opto iciatfm2ranvpnu)tlerir iatoa  au ils  2urir3ou4opt lfvt t sruru p;o4tpenmi3tyd s2ea(mp t0trtnxfcoatomtr uvs;( s2tmio nydom elicsa(fsrraurp;u4tlt iocilsla2ulumpnu)trxrxf iytla e nvsl()t2tmim iy4aptnmnetasf 2rm(rpou4ole  octyd mDum( o;t0alxrmo3totom  anvo;t0 2tmir3io4ap elfet tfsrtmu ono1opeomictydfaDea(ms u)teenmf oo1fa  livslt t2xrxm3oy4alt liciasfaDum(m ;o4oeeoif3ils sDuln o;u)treoxfcoa1lpDrlnvils t2xrxr3iodoltnlfciat)artau ont4aeeoifciysfs2el( o;u0artrmf3iytla rlieo;t) etr(r nydamenlivta( sDum(m ot0tleomietltfa emu p;u4aetnmo3oa1lp elnvo ( s2tmxmpnu1ape  fvtas  Drru ooo1apeo ieiyslm rlnmo (0 rxrxo3iodoa rluvo;(0 rxoiopoodll n iet s)sDtaur ;u0tlx ioeildfaDrmnvs;t) lxoxf3tatopDrlu ils)srumir3oo4oltelfeiat srra(m ;o4apeomf3iys m2rl(vsnt4tetnmf oodfmteluei s) exrxm iu1olt  fcia() rtmur ot4tltomi3iysfm2elnmo t4 etrxr3oodlaD an o;t0s2to(opoydlm nlfei (  2rmx  ot4teto oeiydla2ranmon(4 etnmrcia1optrlneols0srxoxr oy1olen fcilt s2tm(r nt0altomi3iyd aDea(vp u0tlenxf ta1fm e neo ()s2uoio io1ll  lncilt s2rm(m ot1teeoiociyd sDumn on(0tlenxr iadfm e u o;s0texmimpnydll emici t) rrmurpoo1opxn ietld a rmuvp;t) ltrmfciytfpDeaivo s) ruoxopoy1lm   fvs s srumu pou4oeen feiydfm eluvs t0 lxrir tydop  lu i;s) rxoiopnu4oltnmfeilsfaDtrumpno0opx mocildla2ul(vonu0tetnmr3ia1lm  auvs;t) 2xmxr3nu4ole  fvt (fsrumurono1aet moctldls ulnvp t0aexoif iydfa r nvo;() rxr(o ny4lleelfetas artr(m ot1tptnioetad aDrlump;u)treoir tytfatr ies (0 2xr(m3oy4lmtnmneia() rururp;u1aexn i3iasfm2ulnvp t0 rerio3ty1fmtr ieo t)srtmim iydoptnmfvtas aDtmu  oo1tex iicias s2rm( on(4tlenmr ta1om rlivs;()seto(rpoydamenlnvils) Dum(r ;u4apxniiciatfa2el(msnt4teermo ty1opDeauvi t setrxmpnudope mnvtasfs2rm(m ;o0aex mo3iytla2rlums;(0tlenmf3oa1omDe u sl( srur(rpnudalenmfeiat) rumx  no0tptniociyt m eln p (4 rtoio3tytop eaneols0texoir oo4oltn ictat)sDuaur ot1optnmiciytlm um(vs u0artnir oo1fa rlnei;s)t2tmiopnu4amtnlnesa( arta(rpno4aptnmoetltlm2rmn s t) rxnio3oodfp   iesl()t2uoim ou4alte ictl( srum(r ou0tptnmo3tltfs2um(vonu0trxoxf ty1lat aueo s)sruoxo3ou1omenlncsl( sDua(  ou0aetnmo3iadfa2emumont0tlxrir3iotlat  uvi;s)seumxr3oudaptn ictatfartrx o;o0apt mi3tadfaDrau pnu4 rtoif3iodop e ues t0srtr(m3iu4omtn iei tfsrraxmpou4tle mfeiadla emn p;(4tetrxo3todomDeln ilt0 eumxr nudlleeliet tfs2rm(ro;t0aet mictytlm2ean pn()aetoircoytopDeluei ()s2xr(o3nu1lmtnmivi t) rurx  ou4oltoifetld m rmnvp;u)artrxr totlatrlnvi ( tetrio3ny1lm nlnes (  2ra(r no4tlx  fctyt s uluvp (0alxoifciotfpDe ivslt teur(mpoy4lm nlfvtas s2raur ot0tltomoetydfm rlu s;t) lenmoctotfp   neo s  eum(opiodalt lfct tf rumum ou4tpt if3ilslm2rlu s;u4 etnio3tadlaD lieols)s2urxr3nudlp elicsls aDrm(rpoo0apen fetlsfsDumn o;(4arxrmr ia1oaDrlueo;s teum(m3oodlpen fviat arrmxr ou1olxomo3iyt a2uau snt)alxnxfciydfa  aneols texr(r oo4om  lncils)sDtau pno4apxnmiciytfa ul( pn() eenif oodom eln o s) exo(opnu1lpeemicil()sDtr(r ot0oex mfctys aDumump u)tleoxf ta1lmD ai s t  2tr(opoy4op   ncsa( a2uaurpnu4oeeoiictyslaDul( on()tltoio3tydlp rai ol() eurio3nu1lpenmfviat aDur(  nt0oltn i3iytfaDeauvs t) rtrxr to1oatr i o s trtmirpnu4llenmfcsltfa2ua(rpnt0apeoif3iyd a em(ms;u4altomf ootlptran o;s  rxr(o nodol  mfct (fsrururoot4tpx mo3iad a2uln p u0trxnir oydfmD luvo () 2ur(mpnodapee nct s  rur(moou0tlen ictlslm2rl( s;t)trxnmfciytomt luvo;(  2trir3iy1apt mfcslt)sDur(roou1apx io3tldfm eau p;u)tetomfciotla  livsl() 2urxo oodap   nviat) 2tr( pno4tltoifeiysla2eluvo;(4 ltrmr oadom e u s s0sexmio3nu1oltnlfet () 2ra( o;o1alxn feiat s2raumsnu4trermo iotlm e ues ( srumxrpnu1ame mfetls) Dtau  ;t1tee  fciatfsDemu onu0arermf3tytlmtran ols truoir3nu4amenlicil()s2rrumooo4aptoioctltlm rln p;() ltrmr3iydfpDeluei t trumim3oydaltnmncs s) Drr(r ;t1aexomoeild sDrmu s;t0 lenxo todlmDeaivilt) exr(mpnydape mnvs ( s2rrxmo;t0tlt mictad m ra(ms;(0tlenxo tytopDrai s ( truoxo3no4llt liviltfsDrrxr ot4oeen i3iytla umuvp () lenmocty1laDrli o t0seur(rpoy1openlfviasf rraxmp;u4tltniictys aDrln onu0trtoio3to1omt  ieo s)seum(r3io4ame mnes tfsrurur nu1ale  ictlsla el(ms;u) exomrctodfp rlivilt0 eto(rpiodapenmfvi ()sDur(m ;o1aet iieiad sDuanvo u0 ltnmo ty1fa eauvslt0 2toxr nu1open nci sf 2umur ;u4aptoiociat a2em(msnu0artoxo tatfpte neolt  2toim3iu1aleelfcs s a2um( poo0apen feiasfs2umn o (4 lxnif oadlmDelues;s)sruo(o io4ol e iesatf Dtmur ;o4tltomfeilsfaDul( p () ltoir3ty1faDr u s;t0srxoir3oy1lp nmncilt s2uau ooo1teenmfctlslmDumnmont4tleoirciy1fa   nvs t)trurxm3nu4lmeelfcslt s2rmxmpou0alenmf3iysls2ul( ont) rxomfctotoaD lieilt0seuoxm iy4lm n iei tf 2um(ro;u1tlxo ieiad a2rauvont0texoxrcoytom  aivs s srtm(opnudopen iesa() Draxmpot0apt mfetyt m rmump t4arerxr3oydomDrln ol(0 rxr(r no1lmt  fvia( a2tm(m no0aeenifeilt m2umumo;t4aeeoio3oy1la ranes ( sexrxmpno1apee fvtas)artmxmo;o0oltn ieilt s ra( p t4aleriocoo1opteau o s0 ruoio nodlptnlfesls) 2rrum no0olen iciaslsDra(vp;u4 rxrmoctytfa eai i s  eurxmpnodomtn ncs t) Drmu ooo4oexnioeiysfmDulu ont4teeoif3iydfaDe ieols)seur(o ou4lpe lfeiltfarururonu4olxnmi3iydfa eanmp;t) eeomf iytfmDe ueil( s2ur(r3iu4am  mfvsl(fsDrru  ot0altnifeiltfs ulu p ()artnmf iatlm  lies t) 2xr(opiu1lme mfvi (fs2uaxmooo0aex mi3iyt a ulnvo (0trxrmfcty1lm rlnvi;t)trumxo nodlpen feia(f 2tm(ro;t4alxo o3tytfm2rmuvo u4tltoxrcoy1fatelu s;s trtoio3iu1lm nmncta(f rtrurooo1opeomoctysfa uluvs;(0aeenir oy1oaDranei s  rtmxr3ny4alee neilsfsDrax  ;o4opxo iciytfs ra(vp;u4texrmr iotlp rln s t) etrxmpoy1ome miet s)sDurumo;o1altnmfeiadlm emn pnt)tlxnmo oodopDeanes s)srtrirpoo1om emfci t a2ra(m ;o1opxn fetytfsDua(vs t4altriocio1fm e ies;t0trumirpno1oltnmnvsa()s2urxr oo0apxnmfciadlm rau p ()arxrir tydfmDeln i s)t2trxr nodlpee ivslt  2taxmoot4opxomi3tysla2uan pn()tltnmocoytlateai il( srumio3iu1lp  mnvtlt  rtmum ot0tpenmiciyt m2em(mpnu4arerir3iodlpDeauei;( trtoir3iu1omtn nvil( srtru  no0oee ii3ildlmDuau o;(4texoxr3iytomt  u i t)teur(r oo4ape mnet t  2rrur no0tpxniieildfaDra( o;t0tlxnmo tytoa  livolt sruoxm3iu4ale  ieiasfsrtmurp;u4tleomietas s ean pn(0 ltomocta1lpteai ol()trxrxm3iy4llte icsl(  2raxmpou1opxoiictydlm2emnmp (0aexnxfciadfp elneo t)t2xr(o ou4lptn nctltfaDrm(ro;o0tpt iiciltfm eanvs (4tlxrxr tydom e nvo s)s2xoxm io4ol nmfeia()sDtm( o;t4apeomi3iasfs umn ont0teermr3iydfmD  nesl()srto(rpoo1am n nei s s2umumpoo4tex mieilsfmDuauvp (0trxoir3oy1lpDe iei s texmxr oo4lp   ictasfarrmxm oo1oetniietaslmDul(vpnt)alxrio ia1lmDr n o;t0sexo(rpoo1alt mnvils  Drm( ono1tlxnmi3tld a ea(vo;t4aexnxf3totla  au ils)sruoirpnodome mfvs s)a2rr(mont0tleoioctyt sDrmnvo t4arerif oo1fmDr ieo s0 2uoiopnudop emnct t)s2raur no4oexniictltls ulumsnt) lxomr3tytfpDeauvo t srurir io1lm e ivs (  rumx  ou0apt mfeiltlm2umuvonu) etrirciotomt  nvols)s2tr(mpoudamenmnei sfsrtaurooo1aptoifciytlm2emn s;u0texoxo3iadlaDraues;(  2uoxopoydome mivtltf Drrxr ;u4tlxnmfeils m2um( pnu0aleomr3oo1fmtr ivsls)setrxm3oudomeelfctlt a2trum ;o4tpt  iciys s2ul( snu0aexnxf3oadla  an o t0tetm(opny4lpe lncils sDuax pnu4olt  oetltlsDeau p t)texomf3io1fat li o;s)s2trxm3nydll  lnvsls s2urxr oo1oex  ieilt aDum( p;(4aexriocoadfaD auvolt0 2xmim3no4lmenliesa( arrrumpnt1aexomo3iys a2ua(vs;t)tltnxf3oatlm e uvi;t0srtoiopnudoltnlnet t) rurum ;o1tpt iieiyt s2uau pn(4tltoxf3iadlpt  iei;t0t2xr(opoudlm elfesls) rumx  ou0opx  ociat m2ean snu4trtnmo oo1fmte ues;t0s2xmxo no4lle lfvil(fs2tmuroot0aeeo f3tls s2ulump;t4trtoio oatomD  uvs;()teumimpoo4lle mnciatfa2ururpnu4alto oetad a2uln p u0areomoctatlpDraies;(0sexrxmpnudlmtelfcil()a2rmxmpot1apto fctasla2umn o u)areoiocoy1oa ranvo t setmimpoy1aptnlfetasfs2tm(mpnt0oetniocils sDumu sn() ltnxf3oatfaDrai il( trtm(r3iodlpt miei (f 2taxm no1texo o3iasla ran p;u)altomr oo1lm r i il()t2xrimpio1aptelicsa(faDuax  ou1oltomo3ilsfs elnvo;t0aeerif oydlmD anvs;t  rur(m oo1alen ncs () 2rrum nt4apx  octasfm2ul(von()tltrxfciytfa r u i t)setmxopnodamtemncslsfsrra( oot0opxomo3iatfs2ra(vo ()trtrif3iytfaDrln o s0s2umxr oy1alenmfvsltfa2uax o;u4olx if3iyt mDea( o (4aeerif3oy1omte ivsls)t2to(m3io4lm elncia(f 2tmum ot4oetn oeiydlaDua(vs t0 rtoir tatfateln s;(0sexoi
\ No newline at end of file
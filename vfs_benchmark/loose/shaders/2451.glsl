@@ -0,0 +1 @@
+neolt)trto(r3iu1alt mfvsas) rua(  ou4oltn f3iasfsDem( p (0aexnxo3iydoaDr uvs;t)truoxo io1apenlfvsa( s2tax poo1tpt ifeils m2ra(vs;()arenxr3iy1opD li s;( sexoxm3oy4ape  nvt tf 2rruro;o0tlxnmfctytlmDemnmon(4altnxr3iytfmt lneil( s2tmimpnu1lmen iesltf 2ra(  ;o1olt ii3iadfa2rlnvo;(4trxrxr3ootom   nvol( s2toxo iu4aptn fvs tfsDur(mono4olto oeilsla2elnmo;u0 ltrxr3ia1fp elueils0texrxopiydaltn fvtlt) Drmxmpnu0oeto oeild mDumnvp;() etnxrcoo1faDeln i ( s2xm(r3no4ll e fctlt)arrr(rpoo1oltn o3tldls umumpn(0tleoifctatlat aues s)t2xr(r ou4olt mfei tfsrumxr ;t0tptoif3ias m2ran s t4artoxrctadlp eaivilt truoxo no4olee ivil(  Drax  nu1tlxnmfciatlm rauvs;(4 lxnio3ia1lm elnes t seuriopou1ap   fvi ( aruaump;t1opx mietadlaDumnms t0aetrxf ia1lptraieolt) 2to(o io1amtelnci tfsrrrx  ;t4tpxn fciat a ra(mo (0alerxfcoa1oa  aivilt  eur(opiy4lp  lfes t)s2trumpot0tlenmfetysfm umn o u0 ltomo to1fmDr n ilt s2xmxo3io1lme lncsls) 2umumpno1open i3tldla2ua(msnu4 eeoir ta1fp e ieo;(0teuoxrpiydam nmfcsl() rtau p;u1oeeo fctldlsDrl( snu)arxomfcoy1opD  nes;( t2xmiopnu1ol nmnei t)sDrm(rpoo1tpt  f3iatfmDean pnu0altrifcoodfaDrluvo;s)trto(m3oo1apt mnesas  2trxm ou0optomfciatfsDuluvs;t4aetoifctytlmtr u ilt0 etmxr nu1lpt lfcsl(f rrrur ;o0tpeo oeildlm em(mpn()trtnxf io1fmDelu slt0 2trio ou1omenlfesasf rur(r ou0tet  f3ilsfmDeauvpn(4 exoir iydlmD li o;t0srxmim ou4llee nctl(fs2trx  oo1texn o3tysls2uau pnt4 ltoxf3oo1oa   ies s)setmxo3no4amte fct t sDtm(rpno4tpt moeiydfaDrm( o u0aexnmr3oadfm e n s;( trxmxrpoy1lptn ieiasfs2ua(ro;u0tetnmoeiydfm el( p;u) ltoxrcoo1opD au slt  rtoxo3io1omt lfvias)a2rmxrp;o4aex  f3iatfsDranmo;(0 rxoif iadoaDean ils) rxmxrpiu1ol e fvils)s2uaxr ;t4apenioeiad m2eanvs t0tleoir3tatlmt livolt s2ur(o3nu1om n fctlt)arrrxronu4oleo feiat aDra(vo u)trxnif3tytom  livs;s) rum(m3oo4amtnlnetlt srumu pou1aeenifeiydlsDeau p u0tltrxr3oodop rai i () rxoim oodop  mnvtat s2um(moou0oetomictls aDrl(vsnu) lxoxfcoodfm ean ol( s2tmim3nodalenmfcs sf 2tm( ont4oee mo3iasfm2ul(mp;t0 etnxfciydlmD an s ()s2uoir iy4apee fviat s2rrxmonu1tpx ifeils mDuan pnu4 eeoxocta1fp eaueils0s2xrxm3iu4apee nctlsfsrum(mpno0oeen fciatfs ra( pnu4 lenxociadfat  neols) rtoxopou1lp e fcsl(fartm(ro;u1tltoifeiydlm ea( s;u4trtrmrcto1oaD lu olt) 2um(m iu4ole mncsa(  rraur ou1alxn octlslsDra(monu4 ltrifcio1oaDranvs;t sexrir iy4ol nmfei (faDtmu pou1tltnmoeildlaDeln snt0 eenmr3oydoatrau s;s)teum(r3no4om e nvtl()sDrr(mp;t0aexo oetltlsDuan snu)aleoio3iodomDr n i t t2xrxr iu4omtemfeia( sruau pnu0oex mocildla2ra( s u) etnxf oa1fa ranes;t0seuoirpoo4al elictl( sruau  ;t1tpxn fetltfm2em(vo;u4trxrxf oydlatelnvils  rxoxm3ou1altn nei (fa2taurono1aptn fctas s2umn onu)teerxrcoo1fmt ai i ()s2tr(m3oudope lietasfs2rr( o;u4oex mictldlm2ranvsn() eenio oytlat auvi;( t2xoim nudopenlfvsl( sDtrx  nu0aet mictad a2ranvp (0alxrmr oy1fptrai il(0setoimpnodlleelfctlt) Dtaxr nt0oexn feilsfmDranmont) ltoxr tadlmD luvols s2xoimpnu4oltemfci s srta( pno1tle mfeilsfmDem( pnu)alenxo3ootla e u o;t0s2um(r iydlmtemnvs s)arrr(m ou4ape ioeilslsDul( onu4aetnio3iatomDeluei;s) rtoio3oydoltn feilt aDta( o;o0oltomf3tlsfsDrln s (0trermr3tydlp elnvo;(0t2uo(mpio1ap nlfvt (  Dtr(r ;t4altnmfciltfs2el(msnu0aeerxf3iatfp   i ols0 exoxr nodam elnesl(f rtau pot1ope  fciyt sDul(vsnu) lerir iytfpDe uvilt t2trim nudolt mfctls)srrmurp;t1openioeiysfm2rmn on()tlxomrciy1la eaueo s)t2xrxo iu1lmeemnetls)sDumx  ;u4aet  f3iyslsDulnmsnu)alenmo tytlaDr iesls0srurio io4lm n net sfs2rau ont4aeeoioeiadla ean o (4trtrio3to1lpDrauvi t) 2tmiopoodamt lfcs tf rurx poo0tle  o3tadla2em( o t0aexoxr ta1lmDrlieo ()t2xrirpny4llt  fvtasf ruau ooo4opx io3tydls2uanms;u0altrxrctytoaD  uvs s)srurxr3nudam  mnci t sDtaumpoo1tlto ieiat a elnvo t0aleoio ty1fmtr uvo;(0 rumim oudom   ivslt) 2uaumooo0olenmf3ild a2ea( p u)arenxrcta1fp rluvi ()tetrim3oy4op emiei t sDrmu pno0optnmoetyt s eauvsnt4 exrmo iadfaDraneo;t) rtoxr3oo1ole  icta()sDurumono1alxn ociydfa2emu o;u4 eenmfctadlpteli o;( s2xmxm ou1lp   nvtat)a2tmumoot0teen ieiasfa2rlnvpnt4aetnio3iodlaDeaivo () 2xo(r3ou1opee ncsa(  rur(moot1opt mieildfs ran o t0 ltrmf ty1optrluvolt0t2triopio4ap  liesls)srtrxm ou0teto oeiatls ra( p t4texnmf oy1lmt anei (  2umxmpiydapt  nvils) Dtrxmo;o1apxo feiatfs ea(msnt0altnmociytlpDe uvil(  etr(m nu4lltelfcta(fsrtr(mo;t0apxnmi3iasfs rmnms;() rxrxo3totfm rlivsls  2uo(mpiu1lmtn fvia()aDrrxmoou4tpenmfcilt sDumuvs;t0 ltnmfctydlatrlu il(0 rtoxr nu4amt  ivt s)a2rr(  nu4oeeomociysfa2el( p t0 rtnxo3tydfaD  nvs;t)sexoxopiodal emics tfa2ur(  ot1opt  ieiasfaDranmp (4tlxnmo3tydlmDe neo;t)teumir io1opt  ivsas)aDtmum no0tpenioetldls2eaumsnu4tltnmf3iodom eli i () rtm(opnudlptnmnesatfaDtax poo4aex ii3ild s umuvo;(4teerio3oodlm   nvi t0sexoim3iy4lptnmnesa(fs2raur ;u1apt  feild m2elnmo (0 rxoxfciy1laDraivi t)sexoxo no1lpeemfvt s) rumxm ou1opx mfciydfsDumnms t0 reomrcoo1omtelieilt) rumxmpiodllenmnes s a2ta(m ;o0tetn iciydfm2rlnmsn(0aeerxo3oatfpt  n s;s  exoimpoy1altnlict s  ruax o;o4apxn oeiydfaDuluvon()aetomo iydoptelieol(0teur(o3oudalenmnesat)aDrrxmono4aptnioeilt a eauvsn()teermociatlat ai s () 2um(o3iu1olte icil() Drmu  nu1oexn f3iytfm umnvp (4trxoxocoytlm rlues;t0t2ur(opiy4optn net tfaDuax pnt4opeo oetlslsDrmn o;(0tlerirciodla ranes (  2umxr ou1ll e fctlsfa2uaxm ot0aeto ociltfsDulnms t) eeomfciytfmtranvi (0 rxr(o3oy4alee ivias) rraxmpnt0alt mfetltfa ea(mpnt)tltnmr tatomteanvslt)s2uoir iy4omte feiatfaDua(r ;o0olt mf3ild a2elump;()texnxf totopt luvolt0 exoimpno4al  lfvs t a2ua(m ;o4alt  fcils a2ranvs;() eerir iy1lmDr nvol(0 etoirpiy4olen iei sfarrmxr oo4oltoii3tltls2rau o;(0artnxf3io1fmDraieo;s0trxrio3oydomt lnes s aDtmxmpot0aleoifeiytla2rlnmo;t0trxrmr oy1latrlivsls0seuo(m3no1lmtnlneiltfsDumx p;o0aee  iciltfm rl(mp;(0 lxrxociadoaDe u ils  2xm(r3oo4am n ici t) 2trurpnt1tet  o3tas s ua(mp t0trtoxo3ta1fm e i o s)trtmxrpiydamtn ncta( s2urxm ;u0aptnmo3iys aDum( sn(0 lerif io1fmDrln s s0sexmxmpoydlleelfetas srtrx oou4alx io3iad sDra(mon(0tlxomocoydfmDelivsls0 2to(mpiu1lp elicils) 2raxrp;u1apenmi3iat m ranmont)texoxr iotlmtr u i;(  etrxo iu4altnmnvi ()aDraur ;o4teeomo3iad s2raumsnt)tlerxo oy1faDelivo;t)t2xo(r3nydapee ivsatf rra(rpno1olen i3iydla ea(vs (4tlxnio3tadoa r n s;t) 2umxm ou4ape mnetas aDtmumo;t1tet io3tysfa ulnms u0teeoxoctatfa e iei;t  eumim3oy1lmtnmivt ()a2urxr ;u1aetnioeiydfmDulums t0texrir tydom rauvsls0s2tmxm nu4ap   ivs ( srrmx  oo1texn ictys m2umnvs;u0altrmfciytopD auvi t)setm(mpnydome micslt) 2ta(  ou4alxnii3iytfmDulnms t)teenxf3tatfm r nes s) eto(mpno4ole  ict tfa2trxmpnu4teeoif3tytfmDul(vo t) rtnmoctytfate n o;(  euriopiu4oleelfeta(fsrum(mpot1opx micilsls2rm( snt) rtoxo3tadfa  ln sl()teumimpou4openlnvtat a2ua(mono0ale miciadlm2eauvo;t4arxomr ta1fm rlues;t)s2umio no1alte nvtat) rtrxrpnu1oex ifeilsfmDrmu on(4 eermrcty1la rlieol(  rurirpiu4ol elfvtl(f Drmxmono1olx  f3tadfa eluvpnu0tetnmfcoydfa rlneilt) rxrxo3oo1lpeemnei s s2rm(mpno0tltn octatls uln snt4treomr3oodoate i i;(0 eumxopoodllen ivslt) rurxm ;o0oltnmf3iyt m2um( pnt4 etrifciotlpt livil(0setoxrpiydom nmnet (f 2tr(rpou1olx iicildfm umumo;u)trtoirctotlaD an s;s)teurxo no1omen iesls s2umxr nt0aptoifcildfs uau on(4aexnxrcoa1omtelueil( s2xrxr3oo1olen ncs ()artax ont4tlxnif3ild m eau p;t)trtriocoytlm rln s;s)trxm(m oydol elics ( sDuaumo;t4ape io3iatfsDemu p (0 rtrmr iytfaD auei;t srtmxr3nu4omte ncil() 2rauro;t4aeto ociltfa rauvonu) lxnmf3iadla raueilt s2tm(m3no1lm   neiat  Drmx pnt4aet mfciltfmDuanms;t4 rtnxf oodom   u ilt)s2uo(m3iy1al e net t)a2um(m nt1oet iieiydla2rmu pnu)tlerif oadoat anvs s0tetr(m ou4alenlnvtas  Dra(  nt0ole iocildfs rln pnt0 rtrio3todlp elnei t)seurirpio4opeemnvi ()aDua( oou1tleo oetld m2ul(msn(0aeenxfctydfmt lu s;s  2xmxo io4omtnmfeiltfs2ua(rp;t1texomfeiysfm2ea( onu4trenirctatopD luvo (0sexr(m3oy1altelivs sf 2rmxr ou0aee  oetysfa rmumsn(4 ltnxo3iotlaD  iei;s0srxoir oodlmeemnci sfa2trx p;u4tlt io3iydfs ra( o;(0tltnxo3iadoa rai il(  rtmio3iydol e fct s)srtmxm ou1aptoifeiyd sDeanvont0 rtrir oodfmt aues;s)srumxrpoydom nmfvtltfaDrrx onu4opx ifetldla rmumsn(4trxoir3tytfm  au i;s)teuoim3iudoptnmiet t aDrmx pno4apenmf3tatlm ran p t0 rtrmfcoatlaD an o t)trxmxm io1op emfvsat srtrurpoo4tltoiictat a2ra(mp u4texoxf3iytlptr n s t sexmxrpnu1altnmiet ( arum( onu1tpenmo3iasfs2raumonu4trenxr3oodlpte neo;t) exrim iu4lp   ieiat) rumurp;u0olen oeiysfs emu o;(0 lerif oo1oa  aivols0setrxmpnu4lmenlneta( srta(r ;o1texn f3iasfsDumnvo u0 rxoif3todoa rli o s srtrxmpnu4apt lfciat) rrm(m ;u0ole ifcild s2ul( o;t0 eenmrciatfp  au ols) eumxm iy1omtnlncsa(f Dtaxm ot4teto octytlmDrm( onu0trermr3tadlptrli sls teuo(r3nodoleelnvilt sDta(  no0oee ioctlslaDrl(msnt) exoxocoo1laD au s () exo(r3oudom n ivs t) 2rm(rooo1aptnmo3iyd mDuluvs u)teeoir3oy1fmteauvilt0t2xoxopnodamen ivsa( a2rau onu4olxo o3iysfs eanmpnt0aexnif3oytlmD  u ilt0setrxrpno1al nlfvt (fs2tru pot4aetniietat a eanms ()texoio3iydlmD livo;t)t2tm(o iy1lm e ies () Drax  ;t0tptniociltfa2umnvs;u4tetnxf iatopte ivil( sexo(opnu1op  mnci t) Dra( o;u0aeenmoeilsfaDrauvs u0aetoxr3iotlmtraieils)trxrir3iudopeemnet s aDurx  ;o1tpx mo3ilsfa2ra(vo t4aleoxo3totoaDr n o;s s2trxrpoydom emfvslt aruru o;u1tltoiieiatfm2emnvsnu4aetrir oy1omtrlues ()sexmir3iudllte net tfsrurxrono1tetnii3iat a2uluvs (4arenmf tydop eau s (0trtmio iy1ol emies ( arrm(mpou0optnmo3iaslm2emnvp u)alxrmrciy1omtr ueo;()srxo(r3ou1al e iciatf rua( pno0olxomfcildla2eanvo;u)tltnxf3tatlm rluvo;t0 2tm(r3io4lltemfes t srtau oot4aptoio3iys aDeaumo;t0 rxomr iadoateanvo;s0trxm(opnudoptn fvtl()sDumu pnu1tpeoioeiatlm2rm( s;t4artrmfctytfp  lu s ()seumio no4ap  lict sfsDrr( o;o4ale if3iltfs2el(ms (0texrxocootomtr ieo;t) rxrxm nu4am emncsat)arta(  ot4tpx ioetadla2rm(mo u0trxomr3tydoa eanei t)trurxopoodom emicilt) 2ur(m oo4apx micildls2ulnmp u0 eermrcio1fmte ivol()s2xoxo3ou1ape lies t a2tr(m nt0altoioeiltfs2ua(vo u0tltnif3oy1faDean s;s0srtrxm3iudlmenmncsl( sDuaurp;o1texn feiyd m2em( pnt)aetnmo3iadfm  auvols0 2xmio3oydaptn iei t)sDtax o;o1openmieias s em( on(0tlxrmf iatfp  luvil() rtm(m3oy4lpe lnctat)a2rax  ;t4apxomf3ilsfmDrlu snt)treoxf iytop ranes s0 rum(o iu1al emivsa(fsDuaum ou0tex ioctyt sDrmumo;u4aetoxrcoo1lp elnes;s0tetoim3iu1am   netls)artru pou0tlx mfeiaslsDra(vp ()aetnxr oydla  aueil(0 etrim3ou4ol elfvil( sDrmu  ot1apenioetyt a2rmnvonu4tetoifctadoateaues s0 rtoimpny1lmtn nci ( srua( ono0tetnmicild m2uauvp;() eeoxr oydfat lneilt) euoxm3ny1am  lnctlsfaDrrxmo;u4oexoifeild aDranms t)tlermocia1fa  lnvils  rtrxmpiy1lmen nvslt)srtaxro;o1aee  oetydfa emu snu4aeerxo3ta1op e ivils)trxr(opny4ope  fcs s  Dtaxr ot1oltnmo3ils s uanvont0 rtrxfctodop  ln il(0seurxm oy4omtn feil( a2rr(r ;u4aetnmiciysla2rlums;t)trtomr3tatop  lnes t  rur(r nydop  mictls s2rrxr ;u0tex ifeilsfmDea( o;(4 etrio tatlpt  uvo ()tetmir3ou1lmenlfesltfaDtruro;u0tpxo o3iadfs2rl(vsn()tlenmo iatlmDrau s s)s2xr(r3iy4ome mnvt t  Dtrx oou1tpxnioctad a rm(vsnt4 etomrctydfa  lnei;s)trxmirpny4apen fctatfsDurxmo;o4tlx ifetldfa2uanvo;(0 reoio tadoptraueil(0t2uo(m iudapt  nvta()sDurxro;t1oex  f3tatls emu p t0 lermrcoo1om rauvo t  rxr(rpnydamt  fcslsfaDtaxronu1opt mo3iydla ra( p;(0aetomo3oydom rluei ( s2xmimpoo4lmen iciasf ruaxrooo4oeenmoeildfs rl(vpn()arerxf totoaDrlnvols0seumio io1ap n icil()sDtaump;t0alxnmoeilslm2em(vont) leoif oy1fmt  neo s  rumirpoy1al e nvtl()srurxmpoo1alx mf3iasfs2rluvo;(4altrir3todomt lueo t0t2uoirpoodlpeelics tfsrrrxmoou1alt mo3ias a uaumont4altoir3oo1faD aneilt0 2xmxm3ou4ol emfvt ()a2raxrpno0alxnmf3iat a2emuvsnu)aetoircta1lp   uvils0 rxoir io1lmt  ietl()sDtrx pno0apxo ictltlmDemnmsnu4artrif3oydom r uvi s)trxoxm3oo1amee nctl(faDraumonu0aleoiietld mDel(vsn(4 exnir oadfp ean sls trtoio oudlmenlfci t) rta(mo;u4texnmi3iltla ua(vs;u)tlxnioctydopt  nesl(0srxr(o3oy1lp emieta() 2rmu  oo0olx mietldfm uanvp (4 eenif oydom r nvo (0trxmirpiodamtnlict (  2rmur nu4tptnifeiat a eanmo u)trxnxr iatfmDrluvi ()t2toxo3nudap  lfeslt a2urxr nt4aeen i3ils sDrlumo;(0tlxrmr3io1om   ivil(0 exm(mpiydol   fetltfsDtrxmo;o0tleoio3ils s2em( snu)tlerxf oodop elnvslt)t2ur(m3nydaptnlfct ()aDta(ro;t1opxomfeildfa emu o;() etnio iadoa e uvsl(0t2urirpny4ome lfesl( aDtruront0oetoio3iysla rmn p;t4 exomo3iytla rlu o;s0truo(mpiy4lleemnvsls s2tr(mpot4tlto oeiatfm um(vs t0tlenxr3ootfatrluvilt0setr(mpno1olt lnet tfsDra( pnt1oleniietytlmDrlnvs u4 etnxfcoydlmD livs;()s2uoxm3oo1op emivsa()sDtmumpnt1oetnmiciytlsDrlnmpnt)alenxfctotop elies;() rxr(o oy4apt  nviat  rta(mont1oet mieiasla uln p;u0alenxociydlate ieo;t trxmxr oy1ape  ncsas)aDuaxrpno4tet mo3iltlaDra(mont0 etrmrciodfmD  uvo;s0 etrxrpou4ll nlfes s  Dtmu oot4opt iocildfm eanmp;u4 eenxr3iotfaDrlneslt) etr(opoy4apeemieta()aDtrxm ;u4tlx mociydfm2ua(vp;u)teeoiocoo1fmtr u s (0srxo(r no1om emneiasfaDur( oot4opxn feiltla2uluvs u4 lxnmocoo1oa   ieilt srxo(mpoudomte iesl() rraump;u4apx mfeilslm el(mo t) rtrmr oydopD  u olt0trurxr iu4op  livtls) rtmum nt0oetn fciasfa eln o u) rermrciy1fatrai s;s0trxrio nu1am   nctlsf 2umxrpnu1oetomoetad aDrau p (0 rerir ia1oa elu o s)seum(r oudope micslsf rrau oot4apenii3tatfa2eln p;()alxrif3iytfa e neo ()tetmxo3oodomtn ietl( a2trxm nu0tpe  feiydfs2ea(vo;u4alxrif3oa1lptraueo t  2xmim nu4openliei s sDururpoo4tpt ifeiysfm uan on()aexoxr iodlpDrlneo t setoio3oodlm nmfcias)sDurxm ot0tlt  f3tysla umu p (0aexrxr ta1lpDrln i t0t2uriopoy4opt livia( s2umxro;u0alenmfeilsla2rl( s;()altnmr tydfm r nes;s  exr(rpiu4lp emnei (f Dur(rpnu1aleniictlslsDranvo u0tlxoio3totop   nes s)seumxm3nudomenlfesas)artaump;u4tlenmfciyd aDrm( o u)tlenmo3io1fpteaies;t tetoxr oy4om elnvsas)sDta( ont4apxnii3iytlsDuauvsnu4arermf3tytoptrlivo;t srto(m3ny1ol nmnes tf rtrur nu1olxo ociys sDeanmp u)texrmociytlmDran i;s  etriopiu4ope  nei (fartmxrpnt1teenifeildfmDean s u0aexrmf3oadfmtrln i s0s2xm(o3ny1lmee ncsat)a2urxr nu0oee mociatlaDemnmo u4tlxrirctodla rlueols sexmxm3io4aptnmncs ()a2ua(  ;o1teeomi3iadlaDrlumsnt4tleoxr3totom elnes (0 2xm(r iu4llt mictasfsrrau  ;u1oex io3iadfmDuln pn(4 rerxrcoytop r n ilt t2to(o3iudaltemfeia()a2uau  ;u1tee  oeiat aDea( s (0 lxnxr ty1faDr u o t teto(opnu1lltnlfciat)arumxrp;u0teeoiictytla eluvp t4trxrmf3iydfmDe ivi;t0 exr(o3ou1openmnvt (  Drau pnu4oexnmociyt a eanvs;u)trenxfcto1fateli i s)s2xm(rpoodam n ncsatfs2umxmoot0apxomieiasfsDrauvp;(4 lxoir3ty1optr uvo;t  2xrimpno4llenmfvil()aruaxmo;o4tptnmo3iadlm2elnvo (0trtrio3tadfmD aues;t seuo(mpio1lmt mnvta(  rtmxroot1oexoioeiydla2rauvs u4tltnmf3oatoatraneils0s2uoxopnodlp  lnctas a2rr( onu4ale miciltlsDrm(vs (0aetomo oodlatelivs s0trtoirpiodlptn ici tfarur(mpoo4tlxnmfciadlsDrm( ont4 rtnifcoo1opDran i;() rum(o3nudol   nesat  rur(mpoo0aptnmoeiadfa rlu o t4trtnir3to1la   nvsls0s2to(r oodamenmfes ( a2uru o;t0aexoio3tlt aDeln o;(0 exomf ty1laDeanvi t)trur(o3oydlm  mnesl(  Dumu  oo4tptoioeiad s rmn s (4aetnxf todfmt anes;(0trxrim oydom e ivs s)arua( ono1openif3iat mDeau onu)aeenif iodomtr n s;s0 exmiopio1ol n fcia(faDumumonu0apxnmociltfs2rmu pnu)aleoio oatomDeau o;s) 2ur(opoy1ome  ivsasfsDrrumpno0ole  iciysfa2uanmp u4 lenircoytfaD aieil()setrirpiu1al  lnei ( sDtmx pot0tltniociydfaDrmn p t)tleomfctodoatelivo;()srxo(o3ny4ap emieilt)srrmur nt4tlt mfcias m eauvp u0 exoir ty1opD lu i;s0trxm(m3nodll e nciat) rtr( pot0altnmictatfm rln p;(4 eerxo ta1lmt li i ( t2um(r3oo4lmen nvsltfsrtax  ot4optnmfeiat a2ran o;() rtrxf iadoat  nvsl()teumir oo1ale lfci t artmx ooo0aee ifeiydlm ea(vsn(4trxrif3iotla   n o t teuoim3nu4apteliei ( a2tmxmoot0tlt  fetatfaDrlnmonu)aeerirctadoa eaies s teto(r3no1llenlivsatf 2tauro;t0tpx iiciysla ra(mpnt4teenif oodlmD luvs;(0srxm(opou1ape  fvsat a2umuro;u0tpxoif3ildfm ul( on()tlxoif3oydfmtrln i;t trtr(r3iy4lm  mictatfs2ra(mp;u1apt iieildls ea(mp ()altrmfcio1om  an sls0 exmxo3nudlmt lieta( sDuau oou1apeoiieiydls2uauvp;()texnif3ootom r nei;s trurxm3iudlpen fci sf Dtauront0altniociat sDemnvpnt4trtoxocoydfa rluvil(  2xoxo3iy4lm e nciasfsDtrurpot1olx ifeiysfa2elnmpnu4teenxrctytfm raieo t)s2xmxr ou1ol e nes ()aruaxr ;t4tetniociadfsDul(vp;u)trxrxr tytfmteai il()t2trxo3io4aptnmivs s aDtmxr nt1tleo i3iaslm um(vpnu4tleoifciydlaDraieo;t0t2xoirpiy1amt lfvs t)a2trxmo;u1ape  i3iad aDean pn(4artnxrctatop e ivslt0srxoxm oo4ap   ict sfaDtmxmonu4apeoii3iysfs umu p u4 rerif3todoat  uvsl()srumio io1lm emietat  ruaurooo1tleoifeiltfm2um(vont0 leomocty1lmDranvil(0trto(r3nydom n nvta( sDraxm ;u4teeoiietad m2raumo;(4 etrir3to1fmDrln o ()t2um(opiy1ll  mfvsl(f Dtru  ;o0ope  ociatfaDrln p (0aetrxr3iy1fpD luei s s2xmim nudlpeemivsa( sDrrx pno0teenii3tad sDranmsnu0tlenif tytlm  an olt trtmio3nydapt  nci s sDumump;t1openif3iydfa el(vs;()tlxnmfcoa1lmte ues;s)t2xm(r3nudal n ivsat  Dtau  ou1olxo ietasfm umu ont)aetnxo iadlmD lieo;t s2xmxrpno4ll  mneil()s2um(ronu0opxn i3ilsfm2um( s (0arxnxocoo1fpteai i;t0 2tr(r nudlmen ivsatf rra(rpnu4oleoiieiydls um(vp t0trxnxr tatfaDelnvils  euoxm3ou4opt lncil(faDraumoot4alt mociad mDranmsnt4aeenxf3totla r nvo t0 2uoir nu1llte fcia(  2trurpno1opeoiicilt sDra(vs ()tetrmr3to1opte i ils0 2umxmpnodllte fcilt arumxro;t1oee miciatlm2em( s;(0 etnxf3oodom rlivs s s2ur(opno4omenmfct (farrr( p;t0tet  oeiltla2rmn s;u0texomo3oy1fate nvols  euo(r3iu1lle mfvsas) rtrx p;u4apxo f3iad a2uan s () exomf oytlm r ivo s0 eto(mpiy1opee fei ()sDtmu p;t0tex io3iydla rmn snu0 rxomo tatfa eaneo t  rur(mpiu1olt mics (f Duru pou4tptn ictadls2rauvpnu0aetomr tytlate u ol(0s2uriopoudameelfvi sfartmu ono0oexniicilt m2elu s;u)tlenxo3oy1fm eaiei;( t2toio3nu4llenmics t)s2ra(r ;u1texoifetasla2ranms;u0 lerxfcoadom e ies;s teumirpiudllt lfcsasfs2tmxmo;u4apxomoctytfa rmnmo;t0areomf ootfmtelnei s trum(mpiu1omtnmnetat)s2ta(r oo0olt  i3ildfs elnvp;u0trtnio3tadlp eli olt  2tr(opny1ole mnviat  ruaxmonu0aleniietls s ean s t)teeoio oy1fate nvo;()sruoxr oo4ame  fetls  Drax ont1opx  ociatfs uanms;(0 ltrxr oadlp raieo;(0truoxo3oodamtnmicslt)s2umu  ;t4tlxnmietys mDrlnms (0 etrifcty1om rlnvo;t)t2xrxm3nu4ol  lfesa(fa2rmum ;u0tptomoctytla uln s;u4tlerif3iodoa  lieil(0 rtrxopnudolen net s arrr( o;u4oeenifeild a2um(ms t)altrxr ootopDelu sls0 rto(opio4omte fet t) Drr(ronu4oleomicilsfsDuan o;(4aexoir3oatom rlu o s0srxriopoydaltnmnvi t  Dur(r ;u4tlxomfeiydfs rl(vsnt)alenif ia1fpDeli s;s)seum(r io1al nmfctltf 2taxrono1olt if3iatfm2ulums;(0arxnmf3iatoaD anvo;t setoxmpno4apenlfcslsfsDumxrp;u4oltnif3iysla ul( p;t)tltrif3oo1fp e n o;t)trtoim nu4lltnmfvsa( arra(rpnt0aex io3iydfs um(msn()tltoxo iydfm  au il() rtrxr3oo1alee iei () Dtr(m ;t4ape  feias a2uaump;u0tlenxoctytlate nes;t  2trim nu4lpeelnvt tfsrtm(rp;t4aeenmo3ils m ua(vp;t) etnmo3oo1laDr nvo;(  rurxo nydamtn fesl() rraxrp;t4ole  fciatfs2eau ont) rxoiociy1la rauvo t0texm(m3nodopeemnvt ()s2umx oou0tlt  f3iyslaDuan s;u)trtnxr3ta1opt  uvils0 euo(rpoy4alte net t a2raxronu4openioctytls2rlu pnu4tlxnxrciy1oa r n s t  2xoir3ou1omtnlnvs (  2urx pnu0tlenii3ildfm rmums t0trermf3oo1faDraivs () 2urio3iy4lpt  fvi ( sDumu o;u0ope ii3iatfs ra(mp t)arermociotoptrlneolt0 etr(r ou4omt mict s) 2raxm nu4teeomfctld m ulu s (0artnxo ootoaDrai ols0 rtmir no1lle mnesa()srur( p;o0olt  i3ildfaDemnvpnu)trxrmo3tydom  livi;s0 eum(mpiu4apt licsa(  2uau onu1tpxo i3iasfsDemuvs t0alermf iydom raues s0 rxoxm3oodam elfvs s arrrxront1opt ifctasfs um( sn(4 leoxf ootfmteaues (0 etoim3oodalt lnciat) rurxmpou4olx iociyd s2uan s;u4aeenmo3oatlaDeai o;t)seurxr3iy4ame  ncslt) rtaxm no4tleniiciasla em(ms (4 rxnxo tadlp eaneols sexrirpoodlmtelfvt ()sruaxr oo1aetomoetldla2em( s t)texnxo3iytlmD  uvils)s2xoxr3ny4opeemivils  Duaum ;o0apx ioctls m ul(vs;(4aeenxfcoytlaDrau s () 2xoimpio4ame lnesl() rumu pno0aexnifctadla2ua(mp t4tleoxr3totlp  lu o;()seumxo3oy1ale  ivtl(faruaurooo0olenmo3ilsfaDeln pnt0tltoio io1opt aieols)t2xmxo nudap  livsat)aDuaurpoo0aleo iciysla2rmnmp u)aexoxo oadlm   ies t  euoxo iu4lme  nct s)s2umu oot1ape micild a ea( pnu)aetrxo3tydopDr i s;s truoxopny1ll elictlt  rtaxrp;u4altoii3tltlm2rl(msnt)areoir3oo1fa  livs s  2xmxo iy1ol   icsa(  2ua( oou1ope  i3iad a rlu on()altnmf tydoa  auvils srxm(rpiy1ap e fcsl( sDrmxrpnu1oleo o3tatla2rauvsnu0 lerxoctadom eaivs;t setoirpoy4omtnmfci tfa2rrx oou0tptniocilsfmDul(vs;(0 ltrmr oadfmtran sls0 2xoxo3no4lm elietl(fsruaurpnt1oeeomfctyt a2um( p t)altnifciydoaDe n i s0seumio3ny4omt  ivtl(fartaxrpou4olt  f3ilsfm2rlnvo u) exrxfctydfatraieo;s0sruoir3oudap   ncsl()sDuaurooo0apto i3ils sDuluvonu4texnif oatlpD  n o;t texmirpnudop e feslt)srraxmp;o1tpxoii3tlt a rl( o u4texomfciadopt ln i;(0 euoim3iu4lpt mfctls)srrmx  no1opx mfctadfm2eanvp;() lxoifcto1lpDe ivils)t2xrxmpnydap   fvt s sDua(r nt1oexomfctyt sDemn s u4artoxr tadoaDeaivo;(0 rurxo3iu1omeelnetl()arraxm oo4tpen oeiyslm umnmp;t0tlxnif oo1fpDrlu s t)t2toxr3oy1apt mivslt)arrrur ou0ole mfctytfs eaums;u) lxriociytlmDeaiei;(0sruo(m oo4olt mneta(fs2rru o;o0tltniociyt m ua( o u0 lenio iytoa raneo t) 2uoxo3nydlpe mnct tfsDuaur ot4teeomo3iaslm2ranmsnu0aetoir3ootlp  aneilt)s2trxr3ny4lmtelivslt  Dtrum ou1tee iiciytfa2em(mo;t0areomocoydfatelnvi;(  2xo(o nu4aptemfvt ()arumx oou4tpx iiciad mDrmnvo t4teerircoy1fp   i ilt  etoxopny4omt lnci ( aDua(mpoo4alto i3iytlaDeaumpnu)aleoir iodlmtelies;( trurimpoudame lnesa()srraxr ;o0tpe  oeiydlsDua(mp u0tetnifciatfmt au i s) eumio3iodlm elfetatfs2tax  nt4tleniieilt s ul(vpn(4texomr tatfpD auesl(0srxmirpiu1lleemietat) Dumu  ;t0oleo i3iaslsDelumo (0areoxo iytfmDranes t0srtm(opnudlmt mivtltf rurxmp;u4aleoiiciasfs2eaumsnt) rtrmo3iydopD au il( trtrxr ny1lmt  netls  rua(rpou4open fcild m2rm(vp;t4treniocoydla raies s) etrir3oydome mfesas s2ua(r ot4tlxnifciys a2umnvp;(0 lxrxociytfat luvs;s  rxmim iudal  mnvsltfa2rm(r ou4ole  fctasfmDrlnvsnu0artoxfcoo1opt  iei t0 2trio3no1ap e fet tfsDrmumpou4aee iieiadlm2eau o;()arerxf3ia1lat ai o t0 exr(o3oy4aptnmfcilsfa2rrum ot1apt  icias m2rmuvsnu)alerxr3oa1laDrlies;()trtmxr3oo4ll emnvtlt  2tmumont1apeo f3iatfm uluvo;u0 etrio3todfpDe uvi;()srxoir3iydlp nmneiasfsrum(roou4ale ioeiytfs eaumont0aetomr iydomt aivo;(0teumxm3ou1ale  fviat artmum nu4opto feilsla2ulu pnu0aetrmo oo1fmtrauvo ()t2xmio ou1llte fcs ()a2um(  nu0olxoii3tyd m2ua(vp;t4alenio oytoa e nvol( srxrir3iodal   ics t)aDuru pnt4oetoifeiyd sDumn s (0treoxo3totfa eliei t setrim3nu1llt lfvt t)a2rax  ;t1tleo ieiltls2rln ont4tlenifctytlm   uvo;(0seur(m oo4op n icils a2ur(rpoo1aptnmociltfmDuau s t)aetoirctatlatrai ols)s2to(mpou1alen ietatfsDua(mo;u4apxoiiciaslm emump;t)aleoxf oytfptr n slt0srurxrpiodomt  fei t aDrm(rp;o4apto oetatfa rm(mo () lxrxf3tydfpDr uesl(0srtr(o oydaptemncsl() rtrxmono4oee  feils mDumums (0 exrifctytla r nesl(0t2xrio iu4omtn ivi sfs2ua( pno1tlxo ocilsls2eln s (4 lermf3to1fp r n sls)t2xmxm3ou4amtnmfvtat) 2tr(rpnu4olx mieias aDemn p;(4arxoxf3tydoaDe n i;s) 2xm(o iydol   ivi t  rum(m ot1openioetadfm2emn o;t4 lermfciodfp  livs t  euoim3ny4aptemiet s a2ur(m ot1opxniictyt mDeluvp (0tetrxocoadoptrlu o s0teto(m nudomeemieiat)aDtrx onu0oetomieilsfmDelnmpn()altoxfctydoaDe iei;()srtmim3oudome  iesa(  rtaumo;t0apxomoeiyt s uanmo u4 exoxfcta1omtr neo;(  etoio ou1lm  livsa(fsrua(m nt0tex iocias aDeanmp t4trtoio3oa1oaDean s t s2umxopoudom  mneslt srum(ro;u1olenioeiyd m rlnvo (4teenif oadlaDrliei (0teuoxm nodap n nci (fs2umumpnt1olenifctysfs2elums u0tlerioctotoatrai s ()srxr(m no1omeemfci (  Durx p;t1aeen ociyd s ra( o u)aeeomfctadfptrli ils)t2trim no1ame  ies s)aDum(r ;t4oetn f3tltfa2umn p;(0 reoif3ootoat au il( srxmxmpny1amtelnviatfaDtr(  oo1apxnmociysfm ea(vs;t4tleomf3oa1omDr uvsl(  rxoxo3nudol nlfvt t  2umx ono4openifciytfs2umuvont0 lenxocoy1lm e i s;s  2tr(rpiy1openmieil(  rta(moot1oleoiocildfm rm( p;t0 renif ia1om e n o;s0 ruoimpiy4ll n ictatfsDrmu  ot4tptnioetytfm ran s;t0altrmfcta1oat  ueo;t)s2ur(r nydomee ncslt arrm(rpnt1tltnifctyt m2emnmp t)aeeoxocia1lmD  n slt0trtrxo3nu4alen fvs tfsrtaxm nu4oex  feiasfmDuau p;(0 etnioctodlaDean i s t2xrxmpnu1lmenmneiasfs2rmxro;t0oexnioeiltfa ra( snt)teeoxoctytlmDeai ol()t2uoiopiydomt mnvil(f 2ur( ooo0tpt  ieiytfa2ulnvs;u0teerir totfa e ueols sexr(mpnydll nlnciltfaDtm(  ;u0teeomfetad a rm( onu4 lenirctatlat aieslt0 euoim3oy1lm nlfcsl(f rumx  ;o4tetoiociat sDeauvsnt4 exoxf3todla eluvils)t2trxrpoo1altemnctas)arumxrp;t1tpt moctasfa2ua(mon(0aetnxf iytoaDeau sl( trur(rpio4omenlnctl(f Dtr(moou1tptoifeiadlm2eanms;() renif3tytomDran ils0s2tmiopoo1om  mnvtl(  2tru  nt1tpxn oeias s uanmont) exomo3oo1lm  lnvsl(  2xm(m3nodol eliesasfarrm( oou0altoiieilt a rlumo;t4tlenir3oadopD lneilt)s2to(r3oudoltn feil(fsrum( ont4oetnioeildfmDem( s t0 rtnxf3oytfmt  n s s s2xo(mpio1lmt lfctat a2taxrp;u1apxn ociat a2raums;t)altrmocoy1oaDr nei;s0srtr(r3nydlp  mfviltfsDtax pnu1tlx  i3ias aDeau s;() eermfcoa1lpte neils)setrxopoodomtemies t artrx oou4alto iciysla2em(vo;(0 exomfciytfpDr nes t teumxmpoydapenmfctasfarrrxr ou1tlt  f3ias sDemums u4arxrio ta1lmte nvs;(0 eur(o3oo1lp nlies s)sDrrxr ;t4tee  ociyd s eauvpn()tlxrxrcoa1fmteaies;t s2xoxm3ou1am emfes ( srtm( p;t1texn iciytfm2rl(vp t4 lxnmrciytfpteli il( srtoim3no4open feslt)arururo;t4aet ifetyd mDuanvp u4artrmr to1lpDrauvsls) 2xmir io1omeeliesasfa2urxrpnu4oleo fciyd m rl(mo;u)teenir3iytfmtrlneo;t0sruriopiudal emnci s aDtaurp;o1oexnmo3tatfa2ea(mp;u4 eermrcootfmtrlues;s trtmxo3iu1am emfes tfs2trxr ;t1apeomoetadlm rluvs t0trtoxr3tytoatrlnes;t) 2tr(opoydopeemiesl() Durx pou4alxnmoeiysfm2rauvs (4trenxo3tytlat  u o;() eurxopiy4lltnmnviat a2umx  no4oex  ieiasfmDeau sn()treoir oy1lmD  nvils) exrxr3no1ome lfet ( arrrx o;u1opxniiciysfa2uluvonu0alxrirctatfaDr iei s) rto(m iu1llee iesls sDtrumoou4tlxn iciydlm uanvp (0 ltnxf3oodoatr uvo s0srum(o3iy1ll   nvsl()aDuax o;o1tet  o3iaslm2rl( onu) rxoxo tydfptr n ols teurxrpno1omee ncslt) 2urxmoot1apxn o3iasfs2ranvsnu)tltnifciytlpteanes t srtoxo iudllt mfet sf Dtrxr oo1tpt  f3tadfm rmuvpnu0treomrciy1op  liei;s)sexmxo3iy4lm nmneslt) rtax  nu0oltnmfeiasls ran p (0 etrmf3oadfp elies s trxoxm3oy4lm nmfvt sfartm(  ;u4tltnif3tlt m2rm(vsn(4arxnir3iy1opD  ivil(0 2xm(o3ny1omtn ncsas)sDraxr ;u0texniictltls2ul( ont0trerio iydoatrai i;t)teur(o iy4lmtnmfet (fa2raxmo;o1ale mictltfmDelumsnt4trxrifcty1faD  n s;t) rumxrpnudam n feils) Dtrxro;u4ale mfeild m2eaums;t) lxnxr3iatomDrluei;t0srxr(r iudole  ieia()a2rmx  nu1aex mfeilt m elnvp t4areoir3ia1laDr ivilt)t2trxo3nydal n fcilt srurxm ot0tlxniociysfa2ua( pnu4 rtomf3oo1oat  neilt trum(m3nu1ol  lfct t)s2urx pou4aleoioeiydlsDemu p;u0 rtomf tatfmtr uvil() rtmimpno4op emiciat)aDua( pno4oleoii3iad a2ulump t)artnxocoadfaDrlnvo t) 2umiopnudlltelfciat) Dtm(rpnu1alt ioeiydlaDrl(vp u)arxrxoctotlat aivo (0sruoir3nodame mnetls)arraxro;t4tpxnio3tatlaDulu sn()trtomoctotop   neilt0tetoim io4olt mfct (faDrm(ro;o4tptnio3iat m2uluvsnu)trtrmocoa1fa eluvils) rxoio oydap nlfeia() 2taum ou4olt ii3tldfs ulnvsnu4altnxrcoo1op  lnvo s  ruoxo iu1lltelivsas sDrau  oo4tpxo f3iasfa ean on(4arermf3oa1om  li sl(  rum(m oudopeemnes t)a2rrx poo4apx ioctas aDuan pnu4 renif3oy1op rau s;s  exoxmpio4op nmiesatfaDtmu oot1aex  ietat mDum(vs (4teenifcta1omt  ivo;t0s2tmir3oudlle  ivsat aDuax oou1teenioeilt a uluvpn(4tetnmrciy1fmtrli s ( t2xmxrpiu1olte nvs (fsDum(rooo0altomfctltfm rm( o (4 leoxf3ta1omtranes t0 euoxopoy4lp n icta(faDrmurooo0tee micilsfmDul(vsn() rerio3oodlaDelnes s  2xrimpnydlmt  nci sfaDrmu onu4aet moetlt s2um(vp u0 lxoif totlmDrlnvs;s srtoxo ny1aleemfvtatfs2tau oot4aeeomi3ilslsDea( p ()tlxrmf3iytop rau il(  2uoio oo1omtnlnvi s)arum(m oo4oeeo icild a elu o;u4 etnxociydlm e u o;t) rxrio3iy1op elivtasfartm(  ;t1tpe if3ilslsDelnvp ()tltnif3todoat  u o s0teur(m3oodlme mivtl()aDurxm ;u1oeen ictad sDemu s (0teeomo3ia1fm r n o () ruoxm iudalee neia()srrrxrpoo0texn o3iat mDel(mp;(0 eenxociy1om r nes;s s2xmxm oo1lmte nvt s  Dumxroou1oltoif3tlslsDran pnu)aeenif3tatlmDrlnes s) rur(o iy4am nlfet t artaur ot1tptniiciytfm2eauvs;t0tlerxf3tytlaDe i s ()texriopny1am nmieslsfa2uaur ou4tetnmfctadlmDelnvpn(0 rtrio iydfat lues;t)t2xrxm oo1om  lnesl()aDrrumoot0olto oeiltfmDrmnmpnt0teenircoo1lat  uesl()trumimpoudom   ivias)sDtr(rp;o1tee mf3ilsfaDrlnmsn() lermr todopDran o s) rurxopiu1olte fcslsfs2rrumo;o0aexn f3iasfmDrau pn(0 rxoxo3oo1op eli sl() rtr(r3ny4llt livt tf rumx  ot4olx iieiadlm2rl( p;u0trenmo3iatlmt lu s () 2umxm oo4apte ivs sfsrrmur nu1tet mfeils m umn pn(4artomo tydomt  uvil( trurirpiu4lme  fct s)a2uaumono4olt ioetaslmDumnvp u) rxoxfcoodfpDrlivsl(0trxm(opiydlmeemictl(  Dtr(m ;o4aex  feiasfmDrl(vs (0 lxnif3tydlpDean s s0srtrxr ny1ale mfet (  2tmurooo1oeto iciyslaDuan p;u4tltrmf3oo1lpte nesls  exo(opno4oleemfvslt)sDrauro;u4apt ii3iatlm2uaumo (4teerxo ia1lp elivi;t) 2umim iydamtelicslt s2tm(mo;u1tet ii3iat s2ea(vsnt) exoif3iatopD  ies;t) exo(rpiodlpee icsltfsDtm(mooo4texoiiciat a eanvo (0 renio tydla   uvslt) exmio no1apeelfciat  Dtrxronu0tpt  i3iytlaDem( s;u)aetnircoydoateli i;t0 2tmio oo4olt mnctls)s2rruroot0apxomoctatfa um( o;u)tlermf oo1omt auei;(0srxo(o ny1lltnlnet sfsrra(rpoo4olx  f3iatfa uaums;u0aexrmocto1omteauvi t trtr(o3oudapeemnetlt  Drm( oou1tlxoif3iasfmDul( pn(0trxnxfcia1fa  an ils trumio iu4olt lnvtlt)srra(m ;u4aexnmf3iltfsDrlu s;t0trenxrcoatfmDr ueols0s2tr(m no4ale  ivi tf 2uau pnt1alto fetydfs rluvpnt4trtomo ty1lmtrlnvi s0s2xmir3oodope livta(fs2ta(rono4alto f3tydlm ulumo t)alxrxf tytlp rlueolt)trtm(rpiy1optelnvil() rtaxm ;u0tpe mocildfaDumu p () etoiociytlm   uvi (0trxmxo oy4lp elncslt s2raxr ;o0apeo fetyd aDeln ont0trerxrctodfp r n ils t2uo(opiy1olee fviasf 2tm(  oo0teenifeils m ea(mp;u0trxrxo iydlaDeli i ( teumimpiodlptnmnvt s arrau onu1opeomoetatfm ulums;(0tlenxo totoaDeauei t)s2urir oydomt lfvsltf ruax p;t1tee mieiasla2ua( s t4 lxrxoctotfatrli o (0s2urim ou1lpt mnctas srrmxrpou0oleomocilt m2ean s;u0 rxomr3iy1fmtrlu o;t  rtoxmpiodlmt lfeilt) Drr( pno4apxnmfctltfm2ul( o;t0 rxnmf ta1lptr ies () rumxmpnu4alen netlsfaDum(rp;o1oexn f3iasfs2ea( pnu) lenircoa1fm eauvi;() rto(m oo1aleemnvi sf rrax  ;o4tpto ictat s rmn o;(0alxnmr3oa1fpt lnvils0 2toxrpnu1aleemfvsls aDraxr ;t0apxomi3tat aDrm( s;(0tlxrxo totomtrauesl(0 eumim io4lptn fei s) rtm(  oo4alx mfciaslmDrmu pn()teenif3todlmDrlnvo;s0 exo(o oo1ome mfci (  2ua(root4ole ifetatfm2uauvo t0alerxo3ootfaDrlivols)trtrir iydap nlfetl(  rtrxm ;o4tpt moetatfm2umnvo;u4artnxrctodfp rau ilt)srtmimpnu4alte iesat  Durumpou1tee  fciysla2ulnmsn(0trxoioctytop rlnes ( t2toxo oy4lpeelneslt)arrmum ;o4apt mo3ias m2uan o;u0 etoifctotfaD  u ils0 2xoxopno4lme mieiat) Duau  ot1ale ii3tydfa2rmumpn(4texomr3ia1faD  ieol()seto(o nu1ll nmnes s)sDuru  nt4tpxn i3iyt a el(vont4aetomf3iy1lmt  uvo;(0t2tm(rpiu4optnlnci s)artm(m nt0altomfctaslaDrl( p;t4tleoio3iydopDrlneols0s2xoir nu1olenlici s)arua(r ot0tpe iietat s rl(mp (0 lxnxr ootfm rau ols setoir3nydale mici sfsrraumo;o1alxoifetls s2emu o t0trxoxrciatoa   ivolt  exoir3nodole lnetltf Dta(rp;t4opeomiciasfs rmnvs u0alenxrcto1omtrlueo ( tetrxo3iudamen ictls a2urump;u4optnmi3tadfmDul( o ()altnifciadlaD ln s;() etrxrpnodlleelfvtatfartmurpnt0tex  oetatlm2ranvo u)aetrio iytopDeli i t s2xrxr iydll n fetlt) rrm(mo;o0alxo o3ildls ulnmp u4 etnxo3io1fm r nvs t0 eum(m nudll e ieia()aDta(monu0tpto fcildfs2rauvpnu4tleoioctadoa  anes s0 2toio3ou4al emfesa(  rumxmo;t4apt ioeiydlm eaums (0arxomr3oodfpteaneolt) exmiopiu4lmee icia()s2rmx  ou0tlto icildla2emuvonu4tlxrxr oytfp eanei t) rxrxmpiu1llee feias aDrmxmp;u1apeoiictldfmDrmump;t4aeerifcoy1fmD lu sls srtm(o ou4lp nmictls)a2ururonu4tle ioeiasfmDrm(vs;(0tltrirctydfm eln s;t0seuo(m3iydolee ieil(faDtrumooo0tlxn ociadfa em(mp;t0tlxnioctadlpDe uvils texm(o3oudal elivi s)s2uax  ot0alx iieilsfmDeln pnt0 exrxrcoadoat  i s t setmirpny4lp e ieia() Dra(mo;t4tex mfciasfm rl(von(0tetomociy1oaDe n o;(0 2trim3nu1ameemnvsl( srum( p;o1olx io3tyslaDelu snu4aleomo oytoaDr uvo s  rtmiopiy1olen fcsatfarrmu pno4oexnmoeiadfm2um( p t)teenxr tatfateln i t) ruoxrpnu1lme lnvil()s2rrx  ou1oltomiciadfm rluvs;(0trxrxrctotom rlivo t setm(o3io4lltnlietls  rtm(  no4tet moeiatla2uan o ()artnmf ia1fpt  u s t t2tr(m ny1lltelfctls  2rrxmpnt0oexnif3tlsls2umumo;(4arenmfciytlp elu i;(0 rur(o3no1olt mfctlt  Dumx oot4alxoif3iytfaDraums t)tlxnxo iotla   ieolt0 eur(o no4am emnvilt aDrmxmo;u4aetoio3iaslmDulnmon(0tltnxf3iatlpD lneo t) 2toir no4olenlictat)sDtaxmo;u1aetnioetyslmDel( o;(4aleoir todfat lueo;s)teuoim nudape  ietatfaDurumono4aex mf3iatlm2rl(vs (0trxoif iatoa  lieol()trxr(o io1optnmici t)aDtr(  ot1oee  f3iytfaDemums;t)tlxomrcty1op  lueo;t srxmxo3ny1lmtnmnvilt)a2ta(mp;t4tpx  ietatfa el( p;()artnmr3iydfat lnvols0 exoim ou4apeemnvias aDtrxr ot4oetnmoctys m rlu p;t0 exoiocoo1lmtrau i s0sexrxr oudlptnmivsat)srraum no0aee ioetld sDrlumsnu4teerxr oo1fa e nei (  ruoxmpnydol elnvsat sDtm( onu1oex ifetltlaDumu s t4 rtomr tatom  aivs;s0 eurir3oo4omen ieilt srra(mo;o1aptomfctlsfs2rm(vpnt0trxnio3oadomDranesls s2trxr3iudopt lnvtl()s2urxm oo1alxomfctlsls rmnmo;t0altnif iotopt aivo t)seumiopoo4ole  fct ()s2umu  ;o1ole  i3ildlm rln p u)alxrxr iy1faDeaieo t0tetrio iy1op   ivs sfs2ta(  ;t4tpen i3iltlm elnvont0 renxo ia1fm ran olt0 rumio3no4llee fvtl(fsrurxr oo1oltn f3iadfsDeln sn()artnmocoatfaDranvolt0sexoio oo1amtemies (faDtmxmpnu0tptnifciatfmDuluvonu4altnmo iydlate nvsls)setmxm oudal emici s aDta( o;o4altn fciatfm2rmumo t)alxrir3tytomDeaivsl( s2xrxopoudapee nct t aDrmumo;o0oltomociyt aDelnvonu4 etnif3iydopDrlueols)trxo(o ou1omtnmncs t)a2ta(mp;u0alxomfeild m2elnmpn(4 lxnxo3io1opDrlies;( s2to(opoo4lpte fcs ()srumur nu4apeo o3ilt m emnvo t)tlxoif totoptrlu i;s0setr(opiodll emfctlt a2urx o;u0oet micildlsDranmo ()arenirctytopDr ivs;t)s2xr(m iydomte ivsa(  2ta(m nt1oex  ieildfmDrau ont4 rerxfcoodfm r n sls) etmxm nu1om  mfesasf 2ur(r ;o0tlt mo3tltls2eln o t)arermr tytfmteli o s  2xoio oydllt mnvt s)srtm(mp;t1altomfetyd s umu o;t4artrxr iodfpt liei;(  rxmxo3iydlm   ncs t arua(rpou0opxo oetltls um(ms;t4treomocoatomDraivilt  euo(r iu1lpt liesatfarrmx  nu1opxoioeiysls2rlnmsn(0 lxnmf3iytfa rln o t0teumir3io4ol e fvsl()sDra( oot0olxniicias sDuanmpn()arxnirciydop e uei t s2ur(o3oo4optn nvt (fsDrr(m no0tlxn i3ilsls2rl(vsnt4teeoio oadoptrlu s;()sexoim ou4lptemfciat)sDuaxmo;t4aptoiicils s rm( p;(0 rxoif tydlmDrlues ()texr(r io1ole  ivs (fs2rm(m ;u0opeomoeils aDul(mpn(0tleomo oydoptrlnvs;t0srxmxo iydamte nci t s2ua(ro;u0tpe iiciydlaDem( p;(0tlxrmr3iydlpDeluvi;s  exmim3oydolen fvtltfsDtax pnt0optnio3tls a ul( s;(0aeeoifcoydoptraies;( s2xmxr iodame lfci ()s2tmxmpnu0oetoiieiytlm2ulums (0aetrmf3ootla raivils  exoxo oo1op  lict t s2uaxrpnt1tpeomociyslmDrlums u0trenmo3tydfpt an sl(0trto(r3ou1llt mfetltf 2rruroou4texnmieildfaDeanmont4tltoxr3iotla   neolt) eto(m3io4lmtn nvslsf 2umumonu0aptomieiadlmDelnmp;(4trerxf3ootfptrlues t  ruo(o3nu4lpte net t sDrmur nt1aet if3tatlsDrlnvonu0altoiocta1lptrauvs;t) 2uoirpno4ol nmnvi s)srurxrpoo0alen f3iltfmDumuvo t)texnir io1lmDrau i s trtoxrpnu4op  lieilt)arrrur no1oltn fetatfmDrlnvsnu)trtnmr iatlate uvs;t) exo(mpno4al nlivilt) Duauronu4oetnii3tat sDrln pnt)artoxo3oo1fpt  ueolt srtr(o no1lp e nciasfs2raumo;t0apxomi3iltls ua( s;u4trtnifctodop   u o;s0srtoxm oo4lm n feias a2rr( p;o0tpt iociydfmDrlump;() etnxociatfpDranei;( tetoxopiudlmt  ncil(fsrumxrono4tle iictyt m umnmpnt4 exrif3todfp raueo s sruoir3iu4olenmivslsf Duau p;t1apxn feild a2ra(msn(4aeeoif3io1omDr nei;()teuo(o nodapenmfcsl( aDumx p;o0opt ifeiasls2raums t) lenif tydoaDelieols0seuo(r oodaltnlivtlsfs2ra(ronu0tetoiieiltfa2umums;(4aeenmf3iatlpD  n o s0truoxrpiodoptnmnciatfs2ururp;t4tltn ocild a2ulums u)aexrir3tydlpDrauvsls  rurxrpoo4am nmivtl
\ No newline at end of file
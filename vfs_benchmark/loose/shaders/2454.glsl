@@ -0,0 +1 @@
+nvo;t setmir3ny4lm  lfvtl(fa2rmur no1tlt mociadls2ranmpnu0texnif3tytfpDraivo t)teurxopoodalt mfesl()s2rmu pnt1aleo o3iyt m2em(msn(0teerio oydfm eaues;() exmio oodlmee neils sDtru pno1aptoii3iltfs2rm(ms;(0texnir iadom r ies s0 rxm(opio1al  mfcsls)arurumoou1oee moetld aDul(vs u0trtnmf ty1laDrln s s)s2ur(opno1opt mnvil(fa2ur(  nu1tex if3ias sDrm(vp (0teeoioctatom eanesl( sexrim3ny4lp  mics t)aDtaxm nu1apenifetytfmDea(mont4 reoif oydfa raivi ( trxrir3iu1ameelnvil(  rrmxrono4olxomfeiat m rauvpnu0aetrxocoadlaDelivsls)teur(mpoodope lfeilt a2rm( o;u1tpto oeildls ra(vp (4aeermr3iodlmt  ues;t)texo(rpio1oleelfetat)srurxmp;u0tpxn ictasfa2ul(vpnu0 lenmf3oa1la eaieo (0t2urir3iudllen nesa(f rrm(  ;u1tptoif3iltfsDeanvont) rtrifciadom r uvsls trtrio3nu1optn ict s a2tmu ooo0aet  iciytla2rln o ()teerir tydoa e nvi;( setr(r nu4oltelfci sfsrrm(ro;o1tlto ictltfm2rmnvp t0 eerio ia1opDraues t0 2tmxr3nu1lpenmnciasfsrururo;t0tlenmfeild m2ra( s;t4 rtrio3tydla   iesls  eto(m oo4omee nvta(faDtmx  no1aeeniieiatlmDrauvs;t)aetnmo iy1op eluvi;t trumxopiu1ll nlfctasfsrrax oot4olxnioctydfa rlump (4altnxo3tydop rlnvo s0 eto(o oudlmt liet ()a2urxront4alxo ociys aDemnmpn() lerxo3iotom rlivi;(0t2to(opny4ol emfcta(  rtrum no1altnmoeiyt m ra(vs;(0artomo ta1fpt  nvi (0setmxo iudlpte nctl(fsDtmx  ;o1opxomi3iydfsDemu s;u) exnxo3iotopD  uei s)t2umxr oo1apeelivil(faDurxrono1aex  iciatfa2ra(mo () rxrmo io1fmtr neo t0 etrir3iydalt liesat)a2trumpnt1tee ii3tydfm ua( o;t)arenif to1lpt auvs;t  eur(o3oydoleemfeiat) 2rrxmpou4olxn fctys s rmnmp;u0 reoxf iatfa r nei;s0 ruo(mpiudlm elncsasfartrxrpnu4oeto oeiyt s2rmnvp;t)arermo iotlmDeln i ( s2tr(m3no4ll  mnei s)s2uau  ;t0olx  feiad mDua(vs t)arenir3iodoaDeanvi;t0s2umio io4amtelicsl(f Drr(ront4tpeomfcils a2umumonu4aeenif oy1op r i o (0sexmxo iydop   nvs ( aDurxrpoo1oexnmocils mDrauvp;(4 rtomr iodfmt  nvo;t0 exr(m oy4lltelnetls sDtmurono1tlen f3iasls ulnvs t)aetrmo oydfmDrlu s (  exmxopio1opt  nvsls a2raum ;o0aetnio3iatls ra(mo;t0aetnxociodfpD ln i s0 etmxm iydlpeemivtlt)aDrmum ou0tpenmi3iadla uanvsnu4trtomf iytomD livsls) 2trxm3io4lm n fei t)aDtm(rpoo0tlxn octysfsDran s;u4 etoifcto1lp e nvs;t0seuo(o ny1al emictat)srtax  nt1tpx  fciatlm elumon(4 ltnmo iotfa rlneo;s seumxo oy1oltnlfeia()srta(rpnt0texo o3tadfmDul( p;() eerir ta1lmteanvs s) rxoxr no4lp   ncs (f rtrxro;u0alenmoetatfsDel(vo t4alxnxocta1om   uei t s2uoio nu4ole  ncil( a2ua(  nt4olxnmi3tas aDrauvs t0tetoxf iadfmtrlneols0trtrxrpoodom   ivsatf 2rrur oo1optnmfciys m emu ont) exomrcoa1omDr neo;t0truoxo3oy4altn net t) Dtrumpnt1texn ieiad a ua(ms t0 etrif io1lmDe i o;t) 2umirpnudllenmnctls  Drr(rooo1opxomiciatlmDumump (0tlxnxf3iydlmtraivsls0srtoxopno4apee ivt sfaDtr(mp;o1tex if3ias s rlnvs (0artrmfctatopD auesl()s2ur(opio4am  lfcs tfaDtm(rpnu1apx mfeiasfs umnmpnt0 exnxfcoo1fmDrlieo;s0 2uoiopnu4llee feiatfsDum( poo0oleomo3iltlmDeaums u)arxrxr oatoaDrau sl( trxmxo3nu4om elneia(  Dtaum ;t1optomi3ilt a ua(mp;t) lxomo tadoptelueil(0s2um(r3nydopt  fvtasf Dtmu o;u4opxomoetadfsDeanvp t4 rtomrcoadlmDrlnei;s  exoiopoydolen icsl()s2rmxr oo0opxomfciadfaDrmnms;(4texnxoctytlaDrlivi t)texoio oydllt livt ( srtax  ;u4alxnifetldla2rlu snu0teeoxocootfm  ln s;t0 exo(r3no1lle lnctlsf Drax  ;o0apt micils s el(mo t)tleoxo iodlaDr ueil(  euoim3iy4lmtemivt t  Drmxr no0tpenif3iltfm uau sn(0tlenio tadlp rluvi;() 2uoio iudlltelfci ()aDua(  oo4tltomictld mDra( o;u0tetoxr tatop elueolt0teuoxo3oy4lleelici sfa2tru  ;u1optoiietldfmDranmp t)tltomo oydfateli ols tetr(r iydoptn fesa()s2ur( pou0teen ieils a2emuvs t4 rtniociydfmt lues s)t2xmim ou1lle  nesls sDtaum no4opx  fetysfaDrl(ms t0aleoifcto1oatelu sl()t2xoio iu1amt mfcils) rtauront1optoifciadlm ulnms;(4alxnmf to1lm  lnvi;(0tetoxmpnodalee nvsl(fa2tmxmooo0aetnmi3iatfa rau ont0texnif3ia1fm  lieo (0srxm(opou1lle mnviasf rtrxmpoo0opeo octydla2ea(monu4tlerxfctotlaDr i o (0setoxmpno4amt lici sf 2taxm nu4tptniietytfsDuanmp t4trerir iadla e nvo t0sexo(m oo1ole mfeilt s2umx pno4aleo i3iys m el(msnu4aexnxrcia1lmtraueslt)trtoimpno1oltnlfvia(fsDtrx  ot0apt  iciasfm2ea(msnu4 exnxr3tadomD ln s;s) rxrirpiy1aptnlnet (faDrruroot0alt  o3iad aDemnms;t) rxrifcoy1laDrli s s)trurio3iy1ol   ncias  rur( pot0ale  fciyslsDuanvonu4 ltrmf3tytfmD lu s ()s2to(r3ou1omee fcslt  Duru  ou1tpxn oeiatfsDrmump u) rtnxr3tadlpDrliei s0 ruoir3iu1al  licsl(f 2rau ont4open fetas a2uln pn()arenmfcoydfmteauvsls0 rumxopou1alenlfviat)artrxm nu4tltoiietlt a2em( pn(0aeerxf3to1oaDean o;(  exrimpiydolt  fvi s)aDtau  nu0tetomieiytlm ul( pnt0areoxfcoatlp raneilt0trxm(m3nodapeemfet ()a2umxr ou1texomietysla rlu ont4aetrioctatoa  aues;( t2tr(mpiudape liviat) 2rm(mpot1tpenmocilslm ra(mpnt4texnxocoytfm eai slt) 2tmxmpno4lltn ivtat artm( p;o4tleo fctatfs2rlu o t4tlenmfciydlpteanvsl()srtoio nydlmenlfctl(fsDtru p;o1openif3tadfs rmnmont4aeeoxf iydop   uvilt0s2xrxm3iy4ope  ivslsfs2umxm no4aet iietlsfs rlnmo (4texrxr3ia1lm raivs t)trumirpoy1om nlivsa() 2rmu oot4alt mfctlslm ranms u0aetomf io1fpD  i ol() rto(m3iu1ol emivsl( s2ra(  no4tetoii3iatla2uauvs;()texrxr3oy1la ranesls) exo(rpnudlpt mivtlt  rrrxr ou4teeoif3iatfmDran p (0texrio3tatlmt auei t)t2um(mpoodlm nmivilt  2raumo;u4olx  o3iytla rluvp t) etomrctodfa eln o;s  rto(r3oo1lptemivtat s2umxr ;o4tpt mieiysfs umnvp u4 exnir3iydlmDr ivo t trtoiopiydam nmivtlsf 2rr( poo4oeenmf3iytfa umu on()tetoxr3tatfpDranvs;t0t2toxr3no1altelnvil()s2rmuroot4olxomf3iytfm eau onu4 rxnmf to1lpDeaueo (0 rtr(mpnu4lmenmfeil() 2uru oot1opto oeiasfs2eln o;t0 rtomocto1fm r u i t tetriopoodal   ictatfsDtrxr nt1tpeoioeiaslm umnvo;t)texnio iotopDrln ol()seurir3nu4ale mfctat)a2ua(r ;u1tpe iicias m el(vs;u)artnmf oy1fpte ieo;s texo(o3iu4lp elivt sf rrm(moot4tleo fetytfs2ranvs u)tlxrxf tatfa e nvo (0seur(o3oodoltnmfviltf 2rmx  ;t4tpt ii3iadfm2rm( o;u4aetrxf3iatlaDrlues t0trtm(o no1altelfcsltfartmxroot0tleoif3ias s2el(mo;u4trenif oatoateaies (0trxmiopoudal emietl(faDumx o;u1tpt mf3iytls raumo t0tlenirciy1lmt lneslt0 etr(o3oodlpeemfei s a2um(mpoo4tpxoioctldfa2rmumpnt0alxnxfcio1oatelivs;s s2tm(r3iy1ape  nvsat sDrmxmpno0tlt mo3tadls ua(vs;t)aexrirciatopDr nvs;t0s2xr(m3iydalt mnvias  2tm(r nu4tltniiciydfmDel(vpnu)tltrxfctatoaDraieilt0s2tm(r io4ol elicsasf rtaur ot1aleoii3iatfaDemn s;(0texomf iodfpte nvi t texmio3iu1ame licia(  2umx ont4tpxoioetatlsDranvs;(0tltrirctatla rlnes t0trtoim no1aptnlivs tfsDrmxr ;o4optoifctltla2rluvont0arxrirciodoa   neo t)s2tr(opnodamt lfcsat aDrm(rpnu4alx  oeias m2eanmpnt4 eenxf3tytfpDraieilt  2umxr nudal  lfvs tfaDur(m nt0aptnmo3ild s uau pnt)aexoxr3ia1om r nes;t0truoxr iy1opee ictls) Duaxro;t4tpe iieiyt s ul(mp ()tetoxo iy1oat ai i t)s2uoxmpno1lpenlnet sfs2urum ou1teeoioetytfm2emnvo ()tleoircoatlm rau sl(0 ruoiopou4opeeliei s) 2truront4tpxoiietytlm2emnmon()alerio3todlpte i i (0texmxopnu1altn fesa(fs2tmx  oo4alxomi3iyt aDelumpnt0 etrxr ta1fm eauei;()sexmxm3io4om n netlsfsrum(m ;t1aptomicild m rlums;()tlxnmfcoatop r i i;t sruoxr3oy4apt mfvtlsfaDtmur oo4oee  o3iyd mDra( s u0trxnxrctadlpDrlivo;s0 rtr(r iu1lmtn fetas  Drm(mp;u4tee ifeiasls2rl(mp t)artrxf oytfp ean i (0s2xmimpoy1apeemietl()sDumx pou4aleomi3iatlaDrlumsnu0trerxocoydomDeai s s  rto(o3oodlpe lfcsl(f rtmx  nt0alen octysla ua( pnt4altrmo3tadoaD livo t sexmxm oy1lltnliesl( aDrm(m nt0aex moetlslm raump (0aeerxo ta1fmteai ils0texo(m ou1al emfcias)srumxro;u4tee iiciyd a ul(vpnt) leomfcoadoat livo s) 2xmirpiy4al e netas) ruaxmoot1tptoio3tyt a2eau s;u4texoxr3io1lm  an i;(0s2uoio3iy1al nlfvsl( a2uaum nu0oetnifetlsfs2el(mo;(0altnmo3to1op elieol(0s2trxmpiu1ol nlncs sfa2rr( oou1ope ifciydls2eaumo u0aexnifcia1lptr nei;t  2xo(opou4ame mictat)aDrmu  ou0altnmieiatfs uau on() ltomfciytfpte uvslt  exrxo3oudlm elfvi s srtauroou4optnmfeild mDrmumo;t4trenmo3totfatean ilt sexmxm iu1al elnct (  rtmx onu0tex mieiydlm2ua(vp u) rtrmo iodopDr ieo;()teurxr3oo4amenlfei s  2ta(ront4tpxnmfetls m2rm(mp;(0trxrmrciotla e i ilt)s2xr(m3io1op nmietl()sDtrumoou4tex  i3ilsfm2ul(mo u0alxnxrcty1faDrli i;()s2trir3io1apenlict t)sDurx oot4oltnifciatfs2rau o u)treoxf3ootoat  ivo;t0trtr(mpoo4omee nctlt a2um(ro;u0tetoif3iydlmDulnvp;t4alerio3oytop elivs;t)seuoio iy1ll   nvt s)arta(r oo1oex if3iasfm elnms;u)texnxf3iydfpDeanvs t0t2trio nudaleelfvilt) 2uau onu0opxnmiciytfaDemnmon()trtomf3oytfpDe ieo ( t2xmimpnodap n ivils arua(mpot0tpt  f3iat s2rlnmpnt) lenxf3oy1fpt  n i;t0setmxr3io1amtemiviasfa2raxronu4tpt  feilslm rmnmpnu0 lenxrcty1fp rln ilt0setr(mpnudole liesat aDrr(rooo4opxoiictlsla2rl(vo;t4alenmocoy1fat anvol(0srur(r3oydlp   nci (fsrtm(moot0aet mfetasfs uanvpnu0artomo ta1omtelnes s) etr(opny1omt mivtat  Durur ou4tpenmietat aDea(mont)trtrxr oa1fa r u i;(  rum(r ou1opt livslt)aDtrxro;o4optomfeils a ulu pnt)trenxf3ia1omDrlivo (  rur(mpiy4omeelnvi t  2umx ono1apt  ieiadfa emnvo t)teermf3oadlp e i ols) rum(mpoy1ol  miesatf 2ta(mooo0oex if3tls a2ua(ms;u4teeoxocta1la rauvs t  2uo(r nodlmtnmivt s) Dtmu  nt4olx  f3ias s emnvo t) lxomf io1lat auei;t0srxm(r nu1ol n ict t)sruax ont4tle iiciysfa eanvs t0aexomr3tatom rluei;t0 2xrxr3oy4lle lneia(f 2uax pnt1tpt mf3tad aDrlnvo;(4trtoirciydfmDeanesl()srxo(o iu4lptn fct t)aDrrxrpou1teto f3ildfs uan snt4tetrmocoytoa r uvsls) rxmim io4lpe mivil(farrr(rpou0tet mo3ildla2rm(vs;() rxoxf3ta1fpt au ils)srtrir oodoptelncs s) 2tmuront1alx  fctytfm uaumo t) rtomo oodoaDraivi ()seumimpiodomt lncsas)aDururpot0aexoifciytlm2el(vo u0tltoircoa1lmtrau s;s0s2xm(r3iodlp  lnvi t) Dra(mp;o4tlen fetyd a rl(vs;u)areoirctytopt  ieilt) etmim3nu1am  mfcil() rrax  ;o0texo fctls aDrl(vo;t0trxrmfciotlm  au slt texrxr no1ap  lieias)arrrurpot4olxo iciydls2umu p u)trenio3iydfm rlivol()srxm(m3oy1amtemnci sf 2uaxm ;o1oexnmo3ilslaDrmn onu4aeenmo3oy1om e nvilt) rxmimpnu4ll n netls srra(ronu4altomfctld m2ul(mpnt)tlermfciodlp elneo;s) ruoxm oodlpe lfci s)sDuaxrpnu0altn i3ils m rm(monu0altrif iodop eauvilt)trur(o no1lmt mfvia()sDtmxmo;o1aleomociasfmDemnvsnt0trtrxo3oa1fm  anvs s srxmxr oodaltemnct sfs2rax  ou1tltoif3tltfs2eln p;()tleoxf tydom e ueils t2umxo3nudale mfvs (  Durum nt1tlxnmocilt s2rmnmp;u0aexoxf3ty1laDranvols trxo(o nydlltn ivi t)arra(rp;o4oeto oeiysls2em(mpn() eenxf tydfmD  n ils0seumim nydol e nei sfarumxront0aleoiictat a2eauvonu)artoxf3tadlat aieo ()s2umiopnudop  miei ()artmxm ;u1tpxomf3ild m ua( o;()arxoio3iydoa  livs ( trto(rpnodam elfes s arua(mpnt4oeeo fciys mDrmums t4arxoxrcoy1lpt auvo s) etrxm oudomeelfctl() rrau  ;t4oltn icilslmDemu sn() exnxfcoy1lpD  nei;s  etr(m3io4optnlies tfaDrax pou1alxo fetytfsDelump;()tlerxrcoadlm  livo;s0 euoio3io1alen icil( artau onu4alenmiciat mDuaump u4artomrcoydlptean olt)t2umir3io1lpenlies t) 2ua(r oo1tptnmfetyd mDranvs;u4 rxrmrctydoatrlieil()trtmxrpio4lptnlnes t sDrru oou4oeeo oeiatlm2eluvont4altrio oa1fp elivs t seurxr3oo1am n nesl(f Drrx oou0aetoifciyd aDumu s;(0 rxnxocoytfm rlnei t)s2xr(m3nu1lmt lieias a2umxmo;o4aleomfetldfmDemu sn()areriocoa1lpt auvolt)srxoxr3io1lmtnmfcsl() Dtrur oo4alt moetlsla2ul(vp;() exrifciatopD livo;()trurir oudllt lneilt sDrru p;t1oleomociyd s2ul( snt) rtnmo3ty1lpte u i;t) 2umim ny4lm emfvil( sDurxmooo1open o3iatls2um(mo;t0artrmf ta1omDeai o;(0trtoirpiy4olee ncsat)s2umum nt0optoifetys m rlnmp;t4trxomr3ty1lm raivsls  2uoxm3oo1op elfvt ( srum(ro;u0aeenmfcildfa2elums;(0 ltoir3iatfa rau o;s) 2umir3no4omen neils aruau oou1alenmf3ils a um(vo t0altoxf oydfp  luei;s0t2xo(r nu1llt miesls)artax  ot1tptnioctysla2eau p u0texnifciodoa   ivils0 ruoim3nydame  nctls  Drmxro;o1aleoioctas mDrlnvs;(4aexoirctotfa rlnvo;s seuoim3iydamen ncsls srrrxr ;u1apx  ociltfs2rmnvsn(4tetrmocootomteanei s)srurxo3ou4ol emivtls)a2rm(r ot4tle mfetltfa2uluvs;u)aleomo tatfm elnvi;s texmxr3oydaptn fvias sDua(m oo1apxo o3iltls el(mo t4tlxnio3iydfaDelu olt0trto(m3nodamtnlnctas)a2umx o;o0tpxnmoeilslm elumo;u4 ltoxf iatlat  n i;s)texrxrpoy1olte fct (f Drmxrpot4aleoifetasfaDem(msn(0alenxrctodlpDrau o s  exrirpiydopenlfcs t sDumxmpou4oeenmfctltlm2rlums;t)trxnmfcto1fa e ues s) 2xrxo io1lme  nesa(  Drrump;t4aexoiieildlm uauvo () leoio oa1opD lies t0srtrir nu1ap nmnciltf rtr(mpno4ope iocils a2emu p (0aeenmrcto1fp   ieilt0 2tr(o3nu4lptemneiat arur(m ;u1oexn o3iltfsDelnmonu4tetrir3iatopDranei (0 rur(m3iydlpe mfvsasf rtr( oot1oet ioeilslsDrauvs;(4 etrxo3oa1lat an s (0texmio oy1lpen nvsl(farrmxmonu4aexo fcilslmDumu sn(4tlxnio3oadfaD au i;s) etmxrpnu1optnmicta(fartmumonu0aeen octldfm umn o;u) rxnmrcoy1lp   nvols) ruriopiu4alt lfctlsf Duaump;o4oleomicias m rmn p (4 ltnmr ty1oateln i;t  2uoxrpoo4lle mfcslsfartm(moot4aexo ieiltfmDua( s u4 rtnmrcia1laDr i ilt0s2xoxr io1lp emncta(farum( oou1texn o3ilslm emuvs ()tltoio3to1omtrlies t)t2xr(r3nydlltnlfvt t)aDtru  ou4olxniocias aDum(vo u0trxoircoo1om rlueslt0s2xrir iudlltelfeiat) 2tru p;t0tet ifetytfs rlu p u)tlxnmf3iodfm  lnvi ( teumxr3oo4alee iviat aDurump;u0tlxo f3tatfsDrlnvp;t4aetoxr iotfpDeaies s0trtoio3no1altnmiesatfs2tmur ot0alt ifeiysla2emumsn(0teermr tydfptran slt0 2uoxmpnudapt lnet t)aDraumoot1oexnii3iys m ulnms;u)trermr3oa1latr i il()srxrim3io4opeemivs () 2rr(ront0aexomo3tls s uanmp;t4 ltrmrcoy1lpD auvil()srtoxopoodlpeelfctasfarum(  nu4tee  i3ias a2rl(mo;()teerioctatopt ai o;s) exmio3iudlltnmncslsfs2rmu p;o1aexo i3iasfa elu s () ltoif iatomDrli i s  2uoir ou4am   feils  2taur ;o4teeomoctlt sDrauvpn(0 exniociatlatrlivs;()s2tr(o3nu1lptnmict sfa2tmxmpno1tle mfciyt s emu snt4 etnmfcoodop rlu il(  2urio oodoltelncs t s2urxm ;o4tlen fciadfa uanvpn(4aetoir3iydfmDeli s;t tetmxo3oo1alen fei t)s2rax p;t0tet  ictydla2rmuvo;()artoifcio1fmteau ol() exm(o3ny4opt  fviasfsDum(  ou4tpt  octyslm2ua(mpn(0tetnif iodoaD lueol(0s2uoim no1ope  ncsl()aDum(mpot0openio3ild a2rmumont0arxomf tadlat  ivo;()seumxopiu1lpeelfctlt a2taurp;t1apt mo3iatfaDum(vo;u4alxrmo3oo1fp rli s;s  2xm(mpiu4optnlfctl()aDta(  ot4oetomf3ildfs rmump ()trerxr ootfptraivi;t0 ruoxo3iodom nliesls  Dua(rp;o4aeenmietysfsDrlumpnt) etoir3oatoptrlivo (0trto(r3ou1ape lfcta(  ruaxmpoo0apto icildfm emnvonu4trerxo todlmDeln i ()srtrio3nudol   fctat)srua( pot0optomo3ild m ra(mp;t)arxomfciodfpD anvo s0 2uoimpnu4am e nct t)aDra(m ou1aexnifeiys s2umnmpnt)aexnxr3iotfptraueslt) etr(m3oudap nlncslt  rrr(r ;o0alxnioctydlaDumnvonu4 eerir io1fptraneo;t0srxr(m3iy1ome mnviltf 2ta(rono1aptniieilslsDra(ms;()tetoxrciy1oaDraiesl(  2ur(r3iu1lptemnci s)srtm(rp;o0tpeomietytlm ul( o;u0areoxociy1fpt ai ils0t2ur(opiydap nlfviat aDrr(rp;u1tlxnmf3tydfs2umnvpn()aeermo oa1fp rli o;(0sruoxm oudopt miesat sDuru oot0aptniicilsfa2umn s u4 exomrctadop  luvi;s0 rxo(m3iudolte fetas)srrm(monu4altn fciyt m el( o (4aetomo3oadlmDraiei;s trumiopnudlltnmicsatfaDtr(rp;t0aee mocildlm rauvonu) renxr ta1omDeaivolt)sruo(rpiy1lle mnct sf Drrxrpou0aexomf3tat m2um(monu) leoif todfmtrli sls sruriopoy4lp n ncias srumur nt1oexomf3iysls2em( p (0 exrxociatfatelues (  rurirpoodolt  ivsls  rtr(roou0opt iiciys a eau pnt)texrmociadfmD li i;t seurim ou4omenlnviat  rraxmoou0tee  ociysls eauvp u4aeenio tydfm eanes ( s2xr(opio1lpen ivia()s2tmxrpou1optnmi3ilslaDrm(vp t0trerioctodlm  luvols0texoio3iu4olte feil(fa2ta( ono1oleomi3iadfsDrau p;u0tltomo oo1lmDraivslt) 2uoxo3iydap elici s  Dtmxrpno4tptnmoeiytlm rlump;t0aetnxr oadop elieol(0 2xrxm iy4lptelfciatfs2uaumont4apx  ieiat m umuvonu)trtomf oadom eanvo (0trxmimpny4ap  lnvils  Dumxr ;u0tptnmfeils sDumumsnu0altnifcoytoaDe uvs ()tetrxr3ny4ole lfeiatf Drr(mont0oleoiieiysfs umn o t4trtoxrciatfaDe nes ( trxo(o oydoltemfcsat)aDumxm nu1olx mfeiadfm uanvp ()tetrmo oytop ranes t0 exm(rpoy4altn ivsa(fsDuaum oo4tlx moeiat s2ul(mo;t4 rerir3oo1fate nvi;()t2tmxmpiudolt livt sf Dumxmo;o0opxoii3iadfm2rl(vs;t)aeeomo iatlmt lnes;( texm(o3oydoltn nei tf rurxrpou0tpenmicilsfm2ul(msn() rtrmr ia1oateaivs (0 rxoxo ny1lle  fei () 2rmxront1aeeoioctyt m2ul(mp u4tltrmfctydlpD  nvol()sruoiopoy4lmeemfvsas) 2rrumpot4teenmi3tys a2rluvo;t4arerxf3iadoa e i o s teuo(rpiodamee ivia()s2tmxrp;o4tptn ieild s2rm(vo (4alxnmo tadlp  aiesls  exmirpio4aleelici sfsDumum ou0oetomietasfm em( s;u0altrmfcoodlaDr ivolt  2xmim no1ll nmfesls  Dur(ront1tptnifctat aDumu s ()trtoxo3iydfmt  neo;t teurxr3nu4omte fvi t arrr(  no1opxnmfeiadls2ranvp;(0artnmf3to1lpD livi t  rto(mpoydapee nvi (f Dumurp;u1apen ieiatfm2em(vs;(4 ltrmo iotlmte nvi;() 2urxr oy1lle mivsat arrr(mp;o4oetoioeiasfa2emnvpnt0altnif3iotlaDelivolt srtoiopiodopenlfcsls)aDtaump;t0apxo oeiysfsDumnvo () ltnir oa1lmt ln s () etm(rpiu1lmtemfvi () rtmxr ;o4olt moeiad a emumo u)tltrir3ootop  ai i s) rurir3iy4lp nmieils)s2um(  ;o0tpto oeiysfsDelums;t) exnio3oadoatrlieo;s0truo(o3ny1lmtemncs sf rur(r nt4olt moetyd s eluvp t0artoxrcia1fmDeaieil(0srxriopiu1omenmfcias) rtax  nu1aexomf3iatlsDuauvo t) rtomr3oydlpDeauvols0 2urimpiydoleemfcsl(fsDta(mpnt1tpx mieiyslaDemnvs;(0tlxrio3tadfateaueo;(0s2xoim3iodalt  ivias)sDrrxmo;o0olxnif3iatls eln p;u)aexrmr3iy1opteaies;s0 exrxo3io1lle lfeta()arta(mo;u1opxnioetldfsDranmo;t)artoiociadlatrluvs;( trxo(r iu1alen ieslsfartrxrpou1aex  fetld aDrmu s;t)tltrif oydom eln ol( srtmxm3ou4oltemivsls) 2uaxrpoo0aet mi3iltfsDemuvs;t0 ltnxr3totop e ueo;(0seurir iy1lptemfcia( s2urxrooo1alxnmfcildfaDum(vs t) rxrmr3iotlmtraivi t0trumimpnodlp  mnvtasf rurxr no1tpen oeiatls2emump;t0alxrmr3to1la e ueol( teumir no1apenmncil()a2urumo;t0optn icildfm2raump t4artrxo3tadomDelues;t)sexoxr3nudlmtemfvs s)sDtaurpoo1alxoiociys a raumon(0trxnif oadom raivi t  2ur(r3oo1lpte iei () 2tmu p;t1optoifetad s2eanms (0 eeomrctatfpD luvs;t0 rumirpiy1ap   ict s)s2rmump;t4oex mo3ils mDemnvp t) lxrxr ty1lat  uei (  exmio3oydaptnlnetatfaDrmur oo0tee  ictatlsDrl(vo;(4 reomo3to1oatran olt)s2uo(r3no1amen net (fa2urxroot1tpxnmf3iyd a2emu pn(0 ltnmr3iadlp rliesl( sexmio3no1omtemfvsls srurx  nu4oee mictyt mDumnmp;u0tltriocto1fp   nvo;s  rtm(m3io1llt mivs ()aDrmumo;t1tle  ictlslsDeanmp;t) rxnxfciy1fpDe i sls0sexm(o3oodlle  ivsls) 2trxmo;o4olxn fctldlm emums;u0tlenmf to1op  lu s t) eto(m3iy1alte nvtatfs2rau o;t4aet if3iytfs rmuvpnt)tlenmrctydfate uvs;s srtoxo3nu1olt  ivt s)a2tmx  oo4aexo oeiysfa2ua(vo (4alxoif3iydlaD lu ils)srur(m nydlp elncsatf Drmu ono1aex ii3tys s2ea(msn(4alxrxr3ty1fpDranvo s)s2tmxmpiy1lm  lfvsls) Dtaxmo;o4apxnifctyt a2rlu s (4 lxrxr oadoate ueslt)seuoxr3ou4ll elfcils s2rr(m nu0tle mfcias mDra(vo t)trtrmf io1lp rln i s0truoxm oudomtn ncslt sDum( poo0olt  i3tadfs um(mp;u4arxrif iy1fm   n s t)sexoiopio1llenmncils)s2urum ou4tpeomf3ilt m rmu p;t) exnio oo1lpt an s (0s2xr(opny1amenmiesa()a2rmum ot0tee  oetyt s eln p u4aetomf iodop eanei s0tetm(mpny1ap e fesltfs2uaumpoo4tle iiciysls2uln ont)alxniocoo1fm   uvolt) ruo(rpoy1ale miviatfsDtaxr ot0tet mf3iad s2ua(ms;()alxoio tytfm r i i;()t2to(rpou4lm eliet (faDumu  ou4oee  ietad s rmumpnt)trxnxr3tytfpt auvil()s2xo(opoo1lmen fvs t srrru pnu1opxo oeildfa umn pnt) lxrif3oodlpt luvi (  2xoimpou4olenmfvt s) rrr(rpnu0tlxnmfciltls2ua(vp;t0 lxnmf tydoaDraues;t trxriopoo1aptnmictlsfartmu  ;t4tpen ictasfmDul( pnt)tlermo3iotlaDean i;t  2xm(rpnu1lpe  fct ()sDtm(  ou4ape  ociyd s em( o;t0texoifcto1oaDraivol()texr(m3oo1oltnmnes tfaDur(rpoo4tltn iciytfm2rauvo t0 lerxrciodfmteaiei;s seuoio oo4olt mict ( sDtrxrpnu1aptniiciatla rl( o;t0aetnir tydfp  auvo s t2uoio oy4lptnmfeta(fsDuau o;o0tptomietldlm2el( p;t4tltnir3tadlm  luvo;s  2xrio oydll  livt sfarrrx p;u0oet  fciat s ean o;t0trtoxr3iatom elnvo;t) 2trio3oo4lp  lnvias) Duaxmpoo1apxnii3tysfsDumnvp;(4 eermo oadfpDelieo;( t2to(o oo1opt mietls sDrax p;u0ole  ieiltla ul(msnt4treoxocoodfpDrlies;s)trtmxo3oudomte nvs t artm( pno1aee miciatlsDemuvonu) exomrciydoa eluvi;()srumio oo4om   fctls)aDrmumooo1apx iociatlmDelums ()altoirciydoptr nvs;s0srxrio3iy4omtelfvil(f Drr( ooo1tlx mociltls2ranvp ()trxomocoytfa raneo;(0seuoirpoy1om  mnviat  ruaxr ;t4teeniociatlmDuln pnu)arxnxo iadlpDrlueilt s2umio iodopt  feiltfsDua( oou1olt mieiasfm emump u4aeenmr ootfate ivo t0srtoim iydolee fet ()s2um(m ot4aetniiciadlm2ea( o u)trtnmocoadfptr iei t)t2umxm oodamt  ictls  Dtax oot4tpxo feiltfm2uau s;u)teerircio1fat ai s (0seuo(m3oy4amtn neiatf 2rr(ront4tleo f3iltlm2el(vp t4teeomocta1fptrln o (0seum(r oy1lme mnvil(  2rr( pnt1oexnio3ilslm ra(mpnu)areomrcootlm eai o t0 rtm(rpnu4amtn nvi t artm(rpnt0olx ii3tasfmDran pn()trenmf oa1lpDraueolt0s2urir oydlltnmfvsa(fs2rau pno0tpxoii3tatfa ranvp ()alxnmr3tadlmtr ues s)s2xrxo3io1am   icslsf Drmurooo4tex mfciltfsDumn s () exnmociotfmtelnvils)teumio iy4ll   neia(  2ur(r ou4olxnmfciadfmDemnvs (4trenmrctydfp elueil(0 rxrim3iu1aleelfcsa()sDrrum nu0opeo i3ils s2eauvo;u4tltnxf3ty1la ean o;t  2trim3ny1openmneta()sDurx  ;o0alt moetaslsDumuvon(4tlxnio3iytopDe u s (  eum(o nu1apen nvsl( aDua(m oo1aleoioetytfmDumnms u0tltnmf3iy1om e uvi;( t2tr(m3no4apee fvs t a2tr(m ou0oeeomfcilsfmDrmuvp t0aetomr to1lm rlueilt)s2xr(r3nu1op emnvi t srur(  ;u1apeomfciys m2uaumsn(4tltoif3iodlmtelnvi;s) 2xrir iodape mictl()srtmump;t4oexomfciysfm2rlumsnu0trenxo iydfaD  uvo t0 etoimpny1ope liviltf rtru p;o0tltomfeiyd a uau s u)texnif io1omD lies;s  rumio iy4ap nmnvslsfarum( pnt1apt mociysfs um( on(0 renmrciytfp   neol() rum(o3oo1openlnvias)aDumxrpnt0aetniociyd m2rm(mpn(0 eeomo3tatfa e nvi;s0s2umxm nu1ll e fvtlt  2tmur ;o0oet mfeiys aDran p;(4 ltnmo tatlaD  ivilt) 2umxm3iu4op  mivtat)srum( p;t1tetn fetytlmDea(vpnu4arxnir todopDrauvo t0 2uo(r nodolt  ieias aruru ooo1aee  fetas mDulnvsnt)tltrmo3iydom rliei;()tetmiopiy4lmte nctas sDrmur ou4tpx ifeiadfs ulu o u)texnif3oo1lmtr ues s  rtr(o oo4ale livtat s2tmxrono1opeo i3iaslsDuluvsn()tlerif3io1fat aivsl()trxmimpoydapt mfct t) ruaxmpnt0tleoioeilsfm2umn o u0 rtrxf3oy1opD  ies (0 exriopnodop nmieiltf rta(mp;t4alx iietadlm rmnmonu4tetomrciy1faDraneo s) 2xmxr nu1ll e ncil( srur( ont1aee mociytlm2rlumpnu0teermf ootoatraneo t s2tmxo ou4ole  feias)sDtaxmp;o4tpx io3ildfm2um(msnu4trxnio iatlmtrluvo;s srxr(opny1lmeelfes (  rtr(m ;o1aeenmf3iltfm rmu o (4alxnxrctatfm  ai ils  rxrio io4optn fet ()a2tm(r ot4texnifeils s rln p u0 renmo oodoat au s ( teumiopio4am   iesltf 2ur(rooo0tlenii3iydfa2ulnmp;u)aetnxr totfmteaiei;s)t2xo(m3nudapte feta( sDum(r ;o1oleomfciltla rmnmp (0 renxf3tydfpDrlivilt s2tmiopoo4ame mfciltfartmumpoo4oeenmf3iyslm2uauvon() rtnmf oy1lp  ai o ( t2xoxopiy1ole lict sfartru poo0alt moetydfaDrlu snt0alerir3to1om r u il(  rxoxopnodll  miesa() rurxmonu1aet ifciltlaDel( s;t)tlxnxr3ia1opD  nesls)t2um(mpny4lmenlfci ()srrm(rpou1oexo f3tlsfs2emn o;t0tltnif tytoa eanes t0t2uoxr3iu1ap  livt s) 2urxro;u1tpxnmf3tadla2ulu pnu4 leomf3iotopDeln o;t0srxo(r ny1llee ncsas) rtrxmo;u0tptnif3iytla ul(vo;u)trtnxfciy1opDelu sls)tetmim3oy1op nlfcs ( aDum( pno4olxn oeiltfa raumo t0teenif tytomt auvo s t2xr(o3oy4op  lfeil()s2trurpoo1ope  ieiytfs2eaumsnu)texomfciotomDr nvol( setrxr3iy4opt lnvtlsf 2rrurp;t1tlxomociadls2ran pnu0tlerif3tydfpt  nvi;(0trxo(mpno4optnmncs s) rtr(  nu4tee mfciatfm eanvonu)alxnmrcoodfat an o s  exm(o3oo4lmtnmicsatfsDta(mpnu4opeomo3tytls2rl(vp;u0altnif3totla rlivs;(0t2trxm3iy4apenlivsas a2tru poo1teeoioeiadfm2um(monu)alxrmo oodlm   i ols  2xm(rpnu4op nmfcsas  2taxm ;u0tpxnmiciltfmDrm(vs;(0artrir iodlm rluei;(  2urxm3iy4op  micsasfaDumx  ;u4opxo ieias sDuanmp;t4artoxo iadopteanvs;t0t2xo(mpiu1amtelnvtas)aDrrxroot1tltnio3iatfm2umnmsnu)aexnxoctotlp elieo t s2trxr3iu1lpee fvi sfs2rrxmoou0tpxo f3tadlm umnmsnt) lxnxr3iatoa ran s;s truo(rpno1alenmncs s  Dtax  nu4tetn ictydls rlnvsnt) renmrcoy1fp   neo;t texmiopou1optnmnvia()aDrrump;u1aeto ociad a umuvs () rxrmrcoatlm  au o;s0texrio3iy4apeemieiltfsrrm(m ou1tpeoiocias m ea( sn(4aeenmf3tatopDeluvi ()tetrxr iy1lleelnctas) ruax oou1aee  feiysfs rau s;t)alxnxociydop eau s;s) 2to(m3iudole  fci ( aDrrxront4ole  oeiatlm2rmn p t0alxoifciadlpDeauvo;(  2tm(r3oy1omen ncil(faDrmxmp;t0ale iieiyd s2um(mp;(4altnircto1fa e iei;( srtr(mpiy4lm e nvilsfs2tm(m ;o4tpt if3iyt m2rmnmp;t4arerxf3oadoa r i s s s2uoxo3oydolt  ncsat a2rau  nu1ale  feiydfs rlnmo;u)aeermfcoatlmDrai ol(0trur(rpou1lme miei (f 2trumpot0optoif3ilsfs2eau pnt4 lenmfcoodfpD au i ( trxoxr3ou1ol  lfcilsf 2ta(  ot0ape  ictyd m2eauvs t0 leoif3oatlpDranvs s0 2umim iydoptnmncilt sDumx  ;u4opto f3tat s eanvpnt0 rtnxf3oatlpteau o t)setoim oo4ameemnct ( arum(ro;o1oexomi3ildfs eln snu)artrmr todla elu o s)srtoxo3oudlpee fcta(  2tm(mp;u4texnmi3tatfs eanvsnt4alerifctydlp eai o t) rumxo ny1lmt mfvsa( srtmxmpoo4tle iieiyd mDean s;()aeeoxr iotomteau il()t2urirpoydaptnmnvi ( sDtm(monu0oleo fctlt m ra( sn()aetnifciodoa  aueo ( tetm(mpiy1alenmfcia() rtru p;o4aexoifcilsls eluvsnu0arxnmf oatfa r ues s)srumiopoy1lle mfes (  2tmump;u1altoiiciat aDrlums;t)aexoxrcoadfa e uvi (0trtoxmpoy4llt mncsa(f rtrxroou1optoiieildfs2eauvsnu)tltnirctotlmDelivo t0t2trxmpiydlp n nvilsfsDraur ;t0tlt iociyd m umn snu0alenmf3iatfm  aivs (  exrxrpou4alenmiciatf rrrx  ;t1olx mfeiyt s2rluvp;(0tleomrciytoat  ivs s)texoirpoy4lm e nvias)srtm(mpoo1tee  o3tys s rluvpnt0tetoioctodom   nvsl()t2xmir nodaltelivsltfsrtr(mooo4ape  o3tadfmDrau o t4alerir3oadfmte i slt srtr(mpiy1alee icias)sDtmxr ;o0ope mociat aDeluvp () rxrxr3oatla e ivi s srtmxm3iu4ll  livt tf Duauroot4olt  f3ildlsDemn o;t0altnircta1la rlnvo ()teur(r nodal  lfcsa() 2ra(moot4aptnmoeildlsDumu p (4tltomoctytfp eanvo;s0 rxmim3iy1lptn fcilt aDtax o;u0aetomoeiys a umumpnt) reoifcoodoaDeaiei t)srumxopoudapeelfvs s  Dtax oou1tpeomoeiatlmDumuvsn(4 etrmo oodfpDeauvo (0 eumim3no1lmte nvil()a2rau  nu0teenmociydlmDumuvsnt4treomocia1om eau o;t0srxo(opio1lm emnetls s2tru  ot4olxn iciadls2eanms;(4 lerifcootfm elneo;( srtr(mpnu1lmt mncil(farrmx oot0altnmiciysfa2uau p u0altomrcootfpDeaivol()seuoxm iu1alte ivsa(f rumu  nt0oet  fciatfa2el( p;t0trtrxf3oa1fmtrli sls  rtrxrpnu1ope mfciatfa2ua( o;o1aleniiciys m umn o;t0 etomocto1omt ai ol()truo(r3oydomtelneta(  rum(mpnu0openiieiatlsDulu s t)tltnmrcoydomDelnvi (0srtoimpnydlptnmietltfarurx p;t4oexniieiytfm ulu o t) renxfciy1la  aivo () 2tmxm ou1llte fvtas  Dtmxroot0oltomfeildfa2ul( p t0 rtnmrciodoat ln ols0texoio iy4optemnvs (f rtm(mo;o4alx  icias m2rauvsnu0tetniocto1opDeaues;(0s2umimpou1am elnet () 2ur(r ot0alt  iciatla2ran p t4texnmo3tytlpteluvolt)srxr(r nydomtn icslt a2rau  oo4tpxnmociasfa2eanmont4 rtrmoctadfm eanvsls0seumxr oo1apee fcsat)srur(mpot0tptnmoeiatlsDumn s;t)trxrxr oo1la r nvi;() 2xo(r3no1om elnvil(fsDua(rp;t0tlt  ictas m uanms;()alxoircoytoateanvo s  rxoxrpoo1lptnlieta(farraxr ;u0tpxnmieiadlsDulnms u)trxomr3iodfa raivs t) 2trxm ou1lmenmfvta() rrm(rp;u0tpx  f3ils s ea(msn(4areniocoadoa  livols0s2xr(m3iy4omtnlivs sfsrrrur ;u1oexoifcilsfsDean s;() rtrmf oo1fmt  i o;t0 2xmxm3nu4lme mfvsa( srur(mpno0aptnii3tlsfa2elnms;u4aexoircoodoateaueils t2xrxmpno1amtelnvta(fa2ra(mp;o4optoiieiadfa uau s;t4 leoxf3oodfmtraiei;s) rxoxm3oydlm elfviatfs2rmxmo;t0texnioetytfm2umu snt0arerxf3iydfaDraivs t0 2xrxr nu4opee ivs ( sruaur ;u0olxoifeias aDrlnvp u0tltoio3oadlpDeanvi ( srtrio nu4lpt  feilsfarrrxrpnt1ope io3iydfmDemnmo;t0tetrifciatomtr ieolt t2xoxr iodlptemfet sfarrm(rpou4alt mieiltfsDum( snu0tlxnxfcoytfa r nvi t trxo(rpnudlleemietlt)s2rrx o;t1tee moeiysfaDum( p u)aetrxo3oytfmt aieo;()trxmir3ny4omt mictasfa2taur oo1tptnioeiydfmDraumo u)aetrmrciy1lpte ivol( s2umirpoudalenmfcilt)sDtmuroou1tlxo oeiad a2ea( onu)altoirctydomte n o;( s2xm(opiu4lpeemiet sfsrtr(rooo1aleoio3ilsfmDrmu pnu0 ltnmfctydfat auei;(  rxmxo iu1ll nlfvtls)srrrx  ;t4apeoiieiysls elu pnu4aetrif3oo1fm   nes s s2xoxr io4oltelnvtl(f 2trx pot4olxniictyt a ul( s u0 rtoiociodfatr n s;t)srxo(r3oydapeelfvt (f 2trx poo1apt mf3iydfm rluvp;(4aexrxfcoytoa eaieil()srxmiopnu1ol e ivslt)a2taxroot1aeeomfetytla ra( s;() rermrctatfm   iei;t  exo(r3ny4oleeliviatfa2tmumpoo1olt  oetldfa2el(vsn(0aetoxo ty1om rlueo s)t2urim iodalt  ivsl() 2rauro;o1tpe  o3iadfm2rmnvpnu)altrxf3iadoaDe ues;s sexm(o3ny4optemfcilt srta(r nt0apeomo3tadfa2rl(vp t4aeeoxo3iydopt aieo;(0sruoxopio1op nmfesl( s2umumo;u0opxomfciltlm2ea( o u4tlxnmo tytomte i slt s2tmim3iudoltelfvsa( a2um(rpoo4aeeo fetatla2rm( s (4treniocoodop eai ols)s2xrxo3ou1ll  lfetl()srrm( oou4teen fctatla2el( p t)trxnxf tatfm ran o (0 2ur(r oydlpe mnetat  2umxm ot0tle mieiadlmDrau pn()aexnio iy1fp  li s;s0t2xmir3nu4aptnmietas)srrrumooo0tpxoio3ildfsDel( pn(4tlxrxr3iadfp eanvi ()setrxm iy1al n neiltfsDrmx pnu1alt ifetyd sDum(mpn(4texrir ty1optelivi;t0setm(mpoo1opee ivil()sDraurooo1optnif3tatfaDemumsnu0 eenif oo1lptr i s ( sexm(rpnu4ll emfeilt a2tauronu0alto ietyt s2umu onu)altnmocty1oa eanvi;(  2toimpnodolenmiesas)aDrax onu4opeoio3tys mDrluvpn(4 etrifcoytlateanei t)sexo(rpou4amtnlfcsl()a2urx pot1alto fetlsfa rau p (4alxomo3ia1fat luei (0s2xoxrpnodom nmncs ()a2raxmo;u1tpenmo3ildfa elu p;u4trxnxf3oytlmDe neils0t2tr(r oudlpen nvsl( s2rrxmono4aetniictydfs2umump u) lermo iotfpDelneo;(0srtoir no4omeemieslt  rrm(r ;t0oetoiiciaslsDra(msnu4arerircto1fp  lu slt0tetr(r iy1amt  nvt (f Drruroou4aleniicilt aDulums (4 exnxociy1lm rauvs ( setmirpio1amtelnviasf Dtrur oo0tltnmf3ias a2uln on(0aeeomf io1fa ean sls0s2urxmpiudlp n ivtatfsDumxr nu0oleo fctls mDuauvonu4trenxrcia1opDeaueo;t) rxo(o iu4omtemies ()s2uru  ;o0ope ifctyd mDeau o;(0tetrmrctytfpDelu slt)t2trxr3iy4lltelncsltfsDtr(  nu0alt mf3iytfm2elnmp;u4 rtomf3tatfaD anvi;s) rumiopoydlptnlncs t)artm(  oo4olen ocilsfa2rluvpn(4tlenif3oa1fptrln o;t setoxopiy1ame mfesat artr(m ;o0oet  ociadfs2rm( o;(4artrxociadom eanvi;()sexoxrpou4al emiet (fs2rrx  oo4tpx ifeils s2uauvp;u0trxrxociotlptr iei;t)t2urim nu1om elivsatfaDtaum nt0oex miciytlmDrmums (0alerio oatlatelu i s0 2tmio iu4op elnvil()srtmx pnt1oetoioetyt m2uan s;t)artrif to1oat anei;(  2um(r3iy1oltnmfesasf 2ur(m oo1altn i3tld m2ran o t0trerio3tatoaD anvi (0 rtmirpiydom emnvias) Dtrur ou1apx ifetatfs el(vont4aexnmf io1fm elnvs ( setmxrpny4omte ivia()a2ta(m ou1opt  fcias s2ran p (0 exnxfcio1optrlnvi;s t2xr(opou4optnlfvsltf rur(ronu4aeto f3iydla rln o u0arerxf3oo1lmDe u o;t) 2xo(o3oodape  nvtas  Dtmur ot1openiictytla umuvsnu)aleomo3iy1latrliei (  2xmimpnydlmeelnei t a2umx ono0tpt ifciydfm ua( s;u4 ltrxr oy1la  lies;t teuo(rpiudll   nct (f Dtaurpot1ale  iciasla rlnvsn()tlxoio totlpDe n o;t0 2tmimpoudopen fcs ( sDrmx onu4olt mi3iydlm rauvsn(4artoioctatom r ues;s0truo(mpiydal  mfei (fsDurx  ou0oeto ietysfm2ul( o;t0trenmf to1fp rlu s t s2to(o3oydlmte ncs ()s2uaxr ;t1apt mf3ilsfa2um(mp;u0aexrxociadomtr u o;()srtoxm3iy1lp elivsatfaDrmx pou4openmi3iatlm2emnvs;u4aexrmr3iydfpD  uvolt)texm(rpoo4ap  mnct ( a2ua(r ou4tpenio3iydls umuvonu) lerxfcoydfm  auvil( sexoir oo4ope  neias  2tau  nt4ope ii3tltlm rau o (4 exrxo totoaDran slt)t2tmim no1ap   ncils  2taxrp;t0oleomoetldla2uaumsn(4teerxo3oo1fmtrln o;s0s2toxmpoodoleelietasfaDuru onu4tpe mo3iytfm2ra(mo u0aexoiociy1oaDeluvi;s)seuoir ou4lptemfvta(  rraxr ;o1tltnmi3ilsls um( pn(4 lenmocoydfmt lnei;(0t2tmxm nu1oltemfvt t arua(r oo0alen icildfs2rmumpnt)aetrif ootlatrln ols) 2toxo iu4llee ictlsf 2ur( p;o0ole mfeiltlmDumuvs u)tlenif3ia1fa e neil()texm(opiudape  iet s arra(moou1aex ii3iytfaDul( p t4aeeomr3tydomDeai sl(  rto(rpnu4ol nmicsa(f Duau pot0tlx ifctlt sDrmnvo ()teerifcoodlmDelnvo (  exmir iy4omen iei t  Dumu  ;t4olxoifcilsfs2rlums;u) ltnif tadfptr u sl() rxmxmpoudam  lfci tf Drau pot4altnmietys a rl(vs (4alxomo tyt
\ No newline at end of file
@@ -0,0 +1 @@
+neil(0seumir io1opeemnet sf rra( pno4alx ifeiytfs2uanms;u)trtrio totfmtelueo t0texoxr oo1lmeelieil(  2urx  nt4oee mictltfa umnmp u) lermo3iydfaDr i i;()setrio nydope mfctl(f 2ra(  nu1tpx  o3tlt aDemuvs;t4 eenxf3ty1lptraues ()trto(rpou4ol e ieil()sDtr(m no0aexomo3iys m el(mpn(0aetomrciatlpDelieo;t)trxrirpoy4ll   ncsl( srtr( p;u0teen ieildfm ul(vpnu)teeoiocoo1laD  n il()s2tr(o3io1ol e fet tf rtaxmpoo1tetomocildfs2uaumsnt) lxrmf iotlm e u i t truoxr ny1olte ieiat s2uaxr ;u0teeomf3iasfa2ra(vo;(0 exoxo iydlpD auvolt seur(m3oy1llt mfvil(f Dta(  oo1alxo oeiasla eluvsn(4 etrir3oydfatr u s;t)s2xmio oodoltn iciat) rta(rono0opt ioeiyslm2rl( p t)texnxr ootop elivs;t)tetoio3no1apt mfvsls)arrmxrooo0alxnii3iatla umnvo;() eeoxo oydop  lnvsls  eum(rpio1lm nmfcsatf Dtr(rpnt1tleoioctat sDulu o (0 rxnirciotoptrlneo;() 2xmim nydllen iesat srrm(  nu1oltnioeiltlm rmu ont)trtnircoy1lm eauvs;() etr(m nudom emfvil()aDrm(m oo1tetnif3tasls2eau o u4trxomociy1oa eauvo s0trxm(r3ny1amenmivs s) Duauroou0alt mieiad sDrmumpnt)trtnxrcia1opD lnvils srtmxmpiu1oleeliciltf rta( pot4tpenmfciadlmDem(ms;u)trenmrciy1la rauvo;s0tetriopiy1op emfvtas aDurx pou1tee mfciyd a2umnvo t) lxoxf todlmt anvs;t)s2xo(r oo4aptemnetat srtrxrpno0texn i3tytfsDemnvsnt4aeerxrcia1fpt ai ils s2tr(o oy4am e icslt) Dra(  nt1apt  fetls sDrmu o;t)aetomf oadomD an s t0t2xm(o3nodlpe  fct () ruaumpnu0tpxnmf3iys s2uan o;()alxoiocty1omDrauvs;t sruoio3nu4lme  ivi s  2tau ono1aetn f3tys a umuvs t4texrmr3oodlmtr ivol(  2xrxo3nudapenmivils)srumxrpot4olx if3tydlm2rluvp u)alerifcto1lmD  nvsl(  2toxmpiodaptemfvtatfsDta(mpot0apenmi3iasfmDeaumo t)arxoxocty1lmteln sl(0 ruo(o nu4al elietl(fartmu pot4olxomf3tasla ul( s;u4teeoif3ty1fptr ivo;t0srxmxo io4am   iei tf rtrur ou1opxomociydfaDumu s u0tltrmr tadlpt lu ols0srtmxr3ny1ll e fvtat) Dtmumpno4tltnioctas sDrmu p;t4aeerxf io1omte u o;s) eumir iu4amenliviat)aDuaxmoou4oeeo oetytlsDel(von(0 rtnir iytfp elieslt)srxr(r3iu1oltelfviltfartmx  ot1altomictltfs emn s;u0trtoxociodfa e iesls0seuo(o ou1ale licilsfs2tmxmpnt4alx ifetldlm2um(von()tetomr3iydfate n i;t0 2um(mpoy4lm elfvi sf rua( pno0aex mo3ils s2rm( p (0tleoxr3tatlmt aieo;s0 rtmxm iu4op  mfes s a2umx  ;u1aee mf3tad aDrl(mont4 exoxr iotomDr ieolt)trxmxo no1apee ncsat)s2uaxronu4olenmi3iasls2eaums;u) etoxr iatomDrln s;()trurio oy4lmeelivilsfsrumxm ;u1opt mocilsls ea(mp (0arenmrcoydoat  uvi () exrxopiydom n fvtl( sDumxm nt4ole iieiydla ea( p;t4tltrxfciotlaDe nei;(  eurxo ny4ll nlnesl( s2rmxront0openmi3tyslaDeanvo;u4alerxr iytopt li o ()truoim oy4lm   nvt sfarua( o;t4oee  iciytfs2emu p;t4trerxo oatfpDeaivi;s)s2xo(o oydalte fetat  Draxrpou1olxo o3tls m rmumonu4aleoxrctodoa  an o;s0teumxm3iy4ol n ietatf rrmx poo1tltnifciatlm ranvsnu0teerio3io1lp e uvsl()t2xrio nudapt  feil( aDraxrono0olxoii3iyd aDrlumonu0trtrxf3iy1op  luvs s0texoimpnu4lmtnlnet s)aDraxrp;u4tltn fctyt s2ulnmon() rerir todlpD ai ol(0t2xrxrpiodlltelicia( a2taurono1tptoiieiad s rmums;() lenxo3ty1fpD  u i;s) rtmir3nydam n ietltf 2tm(moot4tetn fetas a2ulu o t0alenxfcoadfmD ai o (  2xoim3iu4lltnlncil(faDtaumpno0alt if3iasfsDeauvo;t0tleomfciadla  anei (0teur(m iydapt  ivsa()a2umur ot1tee mi3ils a emn s;t)alxomo iytlpD  i s;()t2xoir3ou1llt lfctl(  rumxro;o4oeeoifetlsla2rln s;u0 rtnifctadlpt  u i (0trxrio io1lpen fet s a2tru pno1oeeoiieiltfm2ulu o;u0 eeoxfciadlatelu ils)srtoio oo4omeelivs t sDurxr ot4tltoif3iyd a uanms t) leomr3oadlmt aues s)srtmiopoy1lptemivsa( aDua(moot0alxo ocildla ua(mp;(0tlxrmr oo1laD  n slt)teuoxrpno4lme  nct s  rtm(r ;u1tle  o3iys mDrm( p;u4tltnxo iadlat  ies s0 rtoxr3no1op  lnvi s)a2urx pnu0olx  ieiatfs2uanvpnu) reoxoctadopDr nvo;( t2xoiopiy1op  lfci (f 2um(ro;t1tlx  ictlt m emuvpnt)altnxocootoateli i;(0 eurirpiu1lmen ivi (f rrm(  nt0opxnmfetasls ranmpnu0 rerif3iotfp rau ilt0trumxo3nydlpe  fes ()aDurxmpou0teeniocias sDra( p;(4 rxnio3iydfmt  uvo;(0 eurxmpoodomenmnvilt)a2uax pnu4opx mi3iat s2ra(mpn(0 etnxo iatfa e n i;() 2uoiopou1am nlnviltfaDtaum ;t0tleoiictadfaDeluvsnt0aetnmrcia1lmDe neo s sexmim3no1ome mici ( s2uaur ou0alxnmoeiys s emn snt0tltnmr3to1fat  ivo;(0 rto(o3no4om emfvsatfs2tmu oot1ale ioeiyt a2rl( o t4texnif3oatoate iei;s)s2toxopio4lptemieia( aDurxrpoo4aptomo3iys a ra( s (4trxomocta1fmDr ieol()setmxm3ny1amtnlics t)s2rru  ;t4aptnifciaslm2ulums u) rtrio3iotoa rau ilt0trxr(o oo4amtn fcsa( sDurxrpot1tlt  iciltfa2rmnmpnu0 rtrxo ia1la e nei;t)srtmxm3ou4ll elnvtat)s2ua(moot4aetnmoeiydfsDemnmsnu0arerxocoydfaDran o s0teuoxo io4ame mnesat) rra(m nu1tltn feiysla um(vp;u4aeerxf tatfpt aivi () rxoio3iodlpenmnvi tfa2rmumo;t0aexoiieils s2umnmo t)aeerio3todfpteln i;s) 2tm(r ny1apenmfvs ( srua(  nu0oexomfeiytlsDrl(vsnu4 rxoxoctytfmD  i s t)tetmxo oy1olenlneslt s2rr( pnt0tpenmfctydfa um(msnt)arxrmf ia1faDelnvi t  rurxo3nu4altnlietltfsrrmu  ;o4oetnmi3ilt m
\ No newline at end of file
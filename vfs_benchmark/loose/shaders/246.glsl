@@ -0,0 +1 @@
+n ils0t2tmir3ny1lmtemncia( srumxro;u1opt ii3ias a2el(msnu)tetnxf ty1lmteanvol(0 2ur(m oy4alenmnviat  rraumpot1olx ioeiatfm2emnvo t0trenir oo1oaD aivi;t sexr(o ny1om nlncia(f Dtau  ot0tetnifeiat aDel( s;()tlxrmr iydoaD anes;t)srtmxmpno4lmeelietltfaDrmxmo;t0aex ifcildfm2rlnmp ()treoifctotfat ln sl(  rurim3nu1ope  fcslt srur(ront4tpen fctytla um(vs;u)alxrir todlp eluesl(  eurirpoy1om nlfcsls sDurxrpno0aexoio3iaslm2uluvs t4 lxoxr oy1op elivo;s0teto(m3io1ol elfetas s2ua( oot0tpeomi3ildfa rmuvs u4aexomocoatopDranvs;s0setrxr3iudoltnlfetlsfs2tmxrooo4oetoif3tyt m2em(vsn(0trerir todlpDe nvi s)s2toxo3nu1lpte feiasf rrrx  nt0aleo i3tlt m2umu sn(0tlerxo3oo1fpDranes ()sexrim nodlpte ncil(  rum(mp;t1tex ifeiadfm2emn p t)teeomo3ty1fp  auvil(  rxm(m nu4lm nlieia()s2umxmo;u1ope  oeiytfm2ea(mpn()trxomr iytla r n o t  eurxo3oodop e feil(faDtaxrp;u0texnio3tad mDean p (4 leoxo iotlmt an ils s2uoio iydalenlietat  Dtmu pot1oexomi3iyslm2el(mo;(4altnxo3oa1fat aueo (0 2xmio3iodlleelieia(  rur(  ;t0tlen oeiadfaDrlnmon()tlxnmf3to1oat  u s;t)sruoxo nu4om  mfcsl(fa2trxmpot0opeoiiciyt a2rlnmp;u0arermo3tadlmDe nvsls)srtrxm io4lpe  icsls)artaurpot0opxomi3iadla eauvs t4 rtomr ta1lmDr nvo;()seum(r iodom nmivslt  2ur( ont0ole mfeias a2uan s;u)alermrcta1fptelnvsls srtoiopiudlpe lneias) Draumo;u4aptn i3iad s2ea( p u4 leoir3totoa rauvs;t0trxm(o3iu4apee ictlsfaDumxrp;u0tpxniieiys s2raumo (4 lxomrcty1fa   neil() 2trirpno1op nlfvi ( s2tmx o;o1texomfeiysfaDrlnvp (0altnxf3oodlptr iei;s tetm(o oo1ap emnci t) Draxm ou4tle ifeiltfmDra(mo () etrxocoydlmteli o t) eumxo3iydam n fvt t a2rmu oot1olenmfcild sDrauvont)tleoif3oodoa eaneil()t2xr(o nudale lfvtlt) 2ta( o;u0tleoifetyt mDumuvon(4aetrif3io1oa rli s t  etoimpiudomtnlnvs s)a2tru o;t1alx  icils a rmnms;t) rxrio3totfmtrlivs;t  rxoxo oy1openmics (  rumurono1alxo icilsfs rmnvp u) leoxo iy1lmtraies ()sexoxopou1om  mnvsas a2ua( p;u1tpenmoetytla el(mp;u0 rxoifciodomDeauei ( t2urir nydom   fesat) Dtm(  ;o0tltnioeiysfa ul( pnt0arxrmf iytlmD liei;()texmxm iydoptelicta(  2uaurpot0alt mociadfa2rluvs u0 ltrir3ta1opDeaivi;(0 etm(o ny4al emicslt)sDtau p;t0tlenioctydlmDrl(mp (0 eenmrcoatlm eliei s0 etoxr3iydlmt  nvs sfa2uaxmpoo4altomf3iyd a ranvsnt)arxnmr3oatfp eau i;()setrxm3iu1omtelneil( srtaxrpnt0apto octydla elumonu4aeenxocoa1op  anei;()trxr(r oudapte iei sfs2rmxmp;o1opto oeiys m2uluvo;u4altrxf3oatopD auvi;t) 2urim3oo4lmt lnvsl( artrxmpoo1tltomi3ildlaDel( snt4tleomf3tatoa  an o s0t2xo(o nudlp nlfesas)sDtmumo;o0apxnio3tat s2rl(vo;(4texoxr ia1lmt aneils)texrxmpiu1omtnmictat)artax  ;u1aet iieiyt s2raump;u0 lxnxo3tytomteau ils t2xoiopiy4al elfcslt  2rrurpnt1tltomictysls2rm( s;()tlxnxf3iodomDrai s;s0seuoxo3iy1apt lncslt)srta(mpot4altoii3ild a uau s () lxnxrcoydlpDeli i;s0s2xoxm3oodamtemfei ( sDtm(mooo0tee mieildfaDra(mo (0tltnmo iatomt li o;s0t2urirpoodap  lfet ()a2trxrpnt1tpe ifctadls ulumon(0 lxnxo iytomDeaivi s)s2xr(mpiy1lmeeliet t)aDrm(ront1olxo i3tyslaDua( s;u4alxnxf3ia1fp  aivo (  euoim nydom  livsa() Dtm( pno1apxnio3ilsla uanmonu0trtomr oy1om elnes ()s2xmio3oudlltemnesls  rrm( p;t0alxoiicils aDran p;(0 etoxr3tydfmt anvslt) 2tmxo oydal  licslt)s2ra(  ;t1oltoiocilt s2ulnvo u4 renxr3iatfmDraues;s) etoxrpoo4ole mfvta(f Drru  nt0apx mo3iadfsDrm( o;u)artnmr3iotlmtr nvs t) rumim3nu4lme lfvtas)s2rrx o;u0apt  i3iatfm2emnvpnu) rxnmr oy1om rlieo s0tetrxrpoo4lltnmiei ( aDtru p;o1optoiiciat aDranvon(0 lerio3oadomte iei;s)s2xoxmpny1openmfetls)s2tm(mpoo4teen iciytfsDua(mo u0 ltrmr3iotop ranvi t  2ur(opiu4lmenmfciasfsDumxr ;u0oleoiiciys s eanmpnu4teenxrcoytoateaivi;t)teto(r3iu4lle mnciatfaDumxrpou0alx  oetys aDeln p;(0alxnxf oy1lmD livi s) exo(rpiu1ap n fetlt)artrxrpoo0tpxnmi3tys aDranmp t0tltoxr3iotomD anei t0 etmxmpou4lm e fvia( sDrrx poo4oetnifeiytfa ulu snu0 ltriociotla   uvslt0 rto(o nu1lmte nci s aDrm(rpnt4tltn oetysla ua(monu) eerir oydomtrlnvi;t) euoxr iu4lltnlies tfsrtaxmont0optomi3tydfa2uauvsnt4tlxnmr iy1oaD lnvs;s)texr(r oy4lltnmnci ( arrmx  oo0aexo i3iydfa2rlnvpnt)tltoioctydlaD liei t0tetrxo iudolenmicta(f 2tmuront4altniieiydlm2ulnmo () lermf3iatfaDelnei () exm(o nu4opeeliesl()srtrumooo1opx  oeiyt sDel(mpnt) rxoxo oadoat an o t)t2urirpoo1op emfetatf 2rau o;t1aptomictytlm2rm(vp;t0tlxrio tadoa elnes () rxoir io4ame  ncsltf rum( o;t1ale mfetas aDrm( snt)aexrmocoo1lpD  u sl() rxoim ny4opt  nei s)a2ra(roou1tptnmi3tlt s emump;u0artomr3oadlmD lnvo s)setmim3nydlltnmfeils)srua(rooo0tltnifeiysfs2ul(monu)alermo io1fmD au i;s)trxoxm oodoltnmivs s)a2rru  ot0tlto ociyd mDrlnvo t0altoxr oa1fm eaivi s0 rurim3oo1omee ics ()aDrmxrpou0alxomo3tadfm2eauvp;()alerifctydomDrlueils0setm(m3oo1ope  iei ( s2rmxr nu4aetnmf3iasls2rm(msnt4 lenif3oa1laD  ivo;s0s2ur(mpiodlpt lietlsfsDtaxm nu4apt io3tld sDul(vpn(4altnmfcoydlmDr neol( t2ur(rpiu4lpt mnvs s  2rrxro;t1apen ieiasfm umnmp;u0trerir ta1oa e uvols0 2uriopiy1ape  ncsltfartau onu1oleomf3iasfs2elu o;t0tlxrmo iodfpDe ieo t) rtriopou4llen fcsat)arrau ono4apt  ociytlm elumo;(4aeeomo iadlptelies (0t2tmxrpio1lp elfvs () Drmuronu1olx  ictytfa2elnvo;(4trxnifcoy1oatrln o s trxr(mpoy4amen nctas)sDum(mont0tpenmfetlsls2ul(mp (4 etnmf oytfatr i o (  2to(m io4lpeelfcsas  2rrx p;t0apxnmo3tydla el(vsnt0 rxnmo3iadfm eauvs;(  rtoxopiydlpe livt s s2urur ot1teenmociys a ea(vs t)tlxnmo iadfp   i s ()s2xmio3nodolt mnvs sfartm( o;t1tleo fctlslaDemnvont) eenxrcootfmDeaivs;s0trxrir3no4lptnmfcsls) rur( oou4opx mfetlsfm2uau o u0trtrifcoy1lmDr ivs;()srtrxmpio4apt licsls)aruaur nu0alxo ieiyd mDul( p t4arxnir3oodlmD ln o s  rtmxo oy4ale mivsls) Drm(rp;t0oeeo o3ilsfmDel(mo;(4 eenmf3ta1lmt  n sls trxriopoo1lm n nctltf Dtau pou4alen ieilslsDea(vp;(4artrmr iydlpDelu s t s2urxmpoy1ap emfvsl( artax  nt4tlt mictltfs2umuvp;t4alxoxfctydfatrli o (  2trxopny4oleemncsls  rrrumpot1altn ieiltlm em(vo (4teermrctytop elueo t0t2uoir3oo1ole lnetl(fsDuru o;t4alx iocilsla elnmo;(0tetnxrctydlmD anvsls) 2ur(opoy1olt  ivt () Draumo;u4oeto o3iydfmDeaumo;t)aleomr oytopte n ils0truoxm iydome lfcilt)srrrx o;o1tpxomo3tadfs rl( o u0alenmr3ty1fmteauvs (0teur(o3ou1ope lietat  2um( p;o0texomo3iltlm2rluvo u)altniociotfpDeauvi ( srxrio3iu1amtn fesls)aDua(mo;u4oexo f3tls a uln ont0treoxo ia1lmD  i o t)srtoxopnydom nmfcil(  rtmu ooo1apenmociasfa2ulnmsnt4teerircty1lmteln i s teur(r3nu1apen fvsas)sDtrxmp;o4ape mo3iadls2rm(vo (4altomo3todomt  neo;t t2trimpoydll emivtasf rtax  ;u4opxnmfciydfa ea( onu0 ltrmrciydopt lnvo s  eumxr3ou4lpenmnvsat) Duax  nu4oltoioeiltfs uau p u4 ltrmo3io1fa rau i;t0 rxoxm3iodapenlnetls)s2tauro;u4ale mfcilsfmDum( o;u4tlerxf3tydlmD an slt)s2xo(m nu1ole lncta( a2umxro;u4tptnmfetldfs2eln snu4 etoifciatoaDr i s s)srxmxo3oo4altnlnctl(faDuaxmp;u1alt mocilsfmDua(vpn(4tlerio todlpDelnvi;(0sexoxo3oudlmeelfcsat a2tmxmp;t0tptoii3tydla rm(von() lenxf tadfaDe neo;s) 2ur(r3iydolt lnvilt)s2rau oot0aee ifctyt a2ra(vpnu) rxnmoctatlm r n i;(0texoio3nydlmee neias) 2rau pnt1aex mfciadls elnmp;u0aleoxfcia1lmDraueo;s0 2xm(opiydalte fet t s2tmum ot1tpx ifeiatfsDrmuvonu0trxrxf3iydlmteluvslt)srtmxr3iy4ap n nvsat)sDra(m oo0aexo ieiyslaDuluvo u0 rtoxr3ootom   nvi;()s2umirpio4lptnmnctat  2umu pou4ole iociatla el(vo;u) lermrctodfaDe neolt trxrio3iu1lp emnci ( artr(  oo1tpxoifeiat m2rm(mp;(0 reoxr3oadoa  livilt0t2xr(opoy4op emnvsas a2rmu ooo0apxnmociysls uau pnt4 eermfctotom   nvo;s) 2toxm nu4lp   ivtltfsrrrxront4opt iociyd s rlums u0 ltnxf tadfmteaies t  rto(mpiu4lmtnmnviatf rta( ono4oexo i3iyd mDuaumont0trtrirctotom eaneils0 rtmimpnu4olt mfvtatfaDrrum oo1olen i3tld mDrlnmo;u)aexrxr3iydom   nvo s)trurir iu4aptnlnesat  Dumu o;t1apt  oeildlm2rlumpnu0 rxoio3to1oaD lu i ( t2tm(o nodlle lfeilsfsDua(  ;o1oee moeiydlaDra(mo;t)alerio iy1oateluei ()t2ur(o oo4apeemivsl(  Durxrp;o1teen ictyt a2rauvsn()arerif3iy1omDr ivs;t0s2triopou1lle lnvia(f rta(mpot1olen f3iytfs2ra(mpn(4alenifcootla  anes;( truo(m oy1amtnmnes (fsrrmx pou1alxnmi3iltls2umn s;u0treoxf tydoa  lies;(  eto(m3iu1lmtelnct s)srtr(rpnt1texnmoeilsfmDranvonu)altnmr to1omt  n slt0t2xrio3io1lpeelnesl()aruaum ;o4apxn i3tydls2rmnmo;t0aetomf tydfmt  ues;s)trxoxm3iu4apt  nci t sDrmu p;u0apto iciltls ra(mp;u)arenxr ia1oatrlieslt) etm(m3oy1apt  fesl( arra( pot4alenmieiltfa2ua(vsnu0texoxo3tytlmt  ieols0 rum(rpoodamenlietltfaDuaxrp;u1aet  feiasfaDemums t4texoio tytoa eauvi;t)s2xrxm iy1lltn neslsfs2ra(  ot4tpto fctyd aDum( o;t0 etomoctytlmtrauesls) 2toxmpno4open feilt  rrrxrpnu0tpxoifctatfm2eln s t0tlenmfcty1omDrlies s tetmir oy1ole lfesas) Duaxr oo4aexnmo3ild m eanms t)texoxo iydlm rli o t) 2tmxm3nu1optnlfesls artrx pot4teeoiiciytls ra(mo (4alxoxfcoodlateaneilt sexmxr io1apee fvsas s2rmu o;t1aetoioctysla em(mpnu0aexrmf3oatfpteauei t  2urxopoodll e icta(fsrta( ont4tlx if3iyd sDelnvs u0 renir iy1oatran ils srxrxmpiodam n fetas)aDumum oo1tptnmfetad s2ra(vs;u)treoxrcoadopD  u slt setoim nu4ome  icsl()srtrx oou4ole mietytfm emu s;t0 ltnmr3oatfm eaieilt0 rtmiopnydal nmncta()aDtrurpou4aexomf3tltfaDeanvp;t0alxnir oadfp elivs () rtoio oy4lpenlncta(  Dtaxm nu4opx moeiytfs2ra(vp;t0treoxr iodlpDe nvsls)t2urxm3iu4omt lneilsfaDurxrooo1apxoiieilsfmDrm(vp u4 eeomr ta1faDr uvs (  eto(m oudapeelnetls)a2raxront1oltn fctltfsDum( p u) ltomr tatoa r n sls)trto(o3nudolt  fvtltf 2ua(mpno0tltoioeiyd m ul( pnu)tleoxo3oa1lmt auesls)t2tmir io4ol  mnetat)aDrr( p;u4oeeo fciyslsDran o;t0aexomr3tydlp eanvi;s s2xo(mpoy4apee ivsl() 2taum ;t0apenioctltlsDum(msnt)trtoif3oatfp  luvi t s2xoxo oodlpeemfvil(  2trx ono0alt mi3tysfaDrauvo;t4alenmfcoa1lpt au ilt)t2xm(r3no1ll  mietl()sDrr( pnt0tpxoif3ilslm2emump (4 leomocoadlmt  uei;t trxm(r3iu4ap nlncs ()sDtrurooo0opxomoetadfmDulump t0 rxomo3oy1opteai ol( trxm(r iudamte fvilsf rumurp;u4tltnifctyd m rl( sn(0tlermoctadlmD  u ilt)srtmim3nu1lm  miei ( sDraxmooo1apt mieiadfaDum(mpn(0artrmocootfptrlnvsl(  rxoim3nudop nmicsat)s2tru o;o1oleoiietysfmDuauvsnt4arenif3ty1fp eanvi (0 2xrirpiu4lm   icsa( sDta(mp;o1alx  oeiyt s2ua( ont)treoxfciy1lmDrln i t  euo(mpio1lm e ies t a2urxronu4oexnii3iad mDrl(mpnu)aexrmr3todfatrluvo s) rxrxm3no1ol   fcslt)sDrmxmpnu4tlx io3ildfaDelnvo (4alxomrctadfaDrai olt)s2xm(rpio1lp n nvt () 2umxroou0olto fetadfa rluvp ()treoxfcoadfpte n ils0tetoxm no1lptelicsls sDtmxm ;o4alx  octydfm rmuvs;(0tlxrxf3oydlpD an olt)srur(o ou1al n ietlt sDrax p;t4texomo3tytlm eln o u) reoxf3totom elueolt) 2uo(m oydlmeelivi sf 2ta(mp;u4tpxoii3tat m2rmump () lxnxf tytfaDrauvsl()t2umio3iydll emnvsat sruaum ;t4apx ioetadlaDulnmp;(0 leomo iadfmtrli i s s2xmir nu4amtemfvs t)aDraxmpou1aet  fetadfa2uan on() ltrmf3ootlmDelivs t trto(r oodapenmfvs (  rrm( pot4altnmietysla2um( sn(0trenmfctotomD ai ols)s2xoim3ny4am n nct sf 2rmurono0oexnmieiytlsDrmn o ()aexnircia1fmtr u s;(0 etoim3ny1alee fet (  Dua(r ;u0tlen oetyslsDel(msnt4aexnmr tydoat aneslt) rxrxo3oy4lmeelncilsf Dua( p;o4optomiciysfsDel(mpnt)alermf oytomtrlivsls0trxo(opoo4lpeelnei s srrmu  ;u1tpe  ietytfs rl(mp u0arxrxociotfmD liei t) euoiopiudame lfes s) Dtmu  ou1aetn oetldfsDelnmsnt4alxnmf3iatfmt aivolt0texo(opou1ape lnet ( sDrrx pot0apxnifeiad mDuauvo;t4texoio3oa1opDeaivsls)sexrio ny4ole  ivi (farumxm nu1opeo i3ils a2ulumo t4artrio3oytfp r i i s)srxoirpnodaptn nvtls) 2ra( o;u0optnii3iysfaDraums;()tltrmo iodfatelueo t tetoio nu4ol elnei () Drm( onu4apeomocilt s2raumo u)teeoxf3tydfpDe nvils) 2uoxo3ny1omtnmietatf rur(rp;t0ale moetyd m2ulu o;u)trtoxo3tytfatelnesls)sexoxopny1lm nlnetlt  rrr(r ;u0olt mf3iasls ranvs u4 eermo oydoatr ieil() rur(o nudap emnvia(  rraxmpou0optoiietld m2ean snu4artnxr3ootlm e nvs;t trtrxr3iydlp nlnet (fa2umxmpnu0aexnmfciasfa ulu sn(0 lxrmo iydfa   ivsl( setmim3oo1oltelfcsl(faDtr(m no4aet mf3iys m2uanvs;() eermoctadomtraies;(  2xoxopoo1lltn neiat)arta(mont0aeeo o3iyd s2rl(vp;t0texoir3to1opDelnesl( teto(o3iodape mict sfartau oou1optnmo3tydla2emump;u0 exrxr3tatfaDelnvo () rtoxm3no4om   fvtlt) 2tmu p;t4oeeo oeilslsDraump u)alxoir3totfmt  ivs;t t2tr(o3nu4aptnmfeia( srtmurpot4tlxomi3ias s ua( s u0aetoir3oytlm   neo;s) exr(opoodale licsls  Drrx pno0apt ifeils sDeauvs;u0 exrmo ta1lmt lieo;s0 2xoxrpoodalte ietat srrm(root1apxo fetad sDemnmon(0 lenxr3totom r ueolt) rumim3oy4aptn iei t)sruaumpnt1tlxo fetytfa rln s t0tetnxf tytlp rln s;(0srto(o oydlle  ncs ( sDurxmpnt4aeeoifciys m raump u4 rtniocoa1op  lu ol(0truoimpiu4opte ieslsfsrrmxrpno4oleniieiysla2rl( o u)tlxoxf3oytfptrai sls0 2tmir3nu1ll emivslsf rraur no4opx iieias sDra( p t4artoir iotlpte i o t0 2urxo oydlleemfvta( aDuaump;o1tptomoctytfaDemuvon(0alxoxrcoodlat an ils0srtriopnydlp e fvi ( srtru  nt0aex  i3tadla uaumonu4 leomr3todfmt luvo ( texo(o3iudamtn nci t)aDrr(ro;o4openio3tydla ranvsn(0treoir3oydfmDelnei;s) 2xm(m oo1ol nmiei (fsrurxront4ope ii3tltlmDeaump t)alxrmr3oadlaDeaueils) 2toiopoo1lltemfeias sDuru oot0tpe  fetltfs2uau s;t)trxoxr tatomDeli sl(  rtr(rpou1am e ictls) rurum oo0tpx ioctltfmDuaumo;t)tlxnxf3iytlm elivi t) rtoxr3ou4lm  lncslt s2ur(mo;t4tlx mfctad m rl(msnt) renif3iodlp raneils s2ur(rpio4am  lnesas a2urxm ou0apenmi3ilsfa rau onu4alxrxr3ty1om   nvil()srxoirpiodlptn fvsas)sDtax  ou4open oetltlaDelu s;(4tleomfcoydomtelues;()t2xrirpiydll n ict t  Dtrxrpnu0tlx  o3ilsfsDrmu s (4altrmf iytfm   n s ( trxoiopio1ll emnctatfarrrx  ;u0aptnmi3ild aDrluvon(4alxrxo iotlpt lieo s)s2toxm ou4olen ncil( aDrru onu4teeomoetlt m2em(vo;t4alermo3iytomDrluvo t t2xoxm3iu4ll nmivt s) rua( oot0tee moeiat a rmu o t0areoxociytopDrlu ils)t2urirpiu1apeelnctltfsDua(  ot4apx  octyt a2em( s t4aexoxrcoadfmtrlivi;s  exm(mpoy4ol e feia()srtau pou4alxo ociad s2emnmsnt) ltoxf3tatfp rlivo;t trum(o3iu1llenmfctl()arurxr ;u4aexn iciydfm2um( pn(4arermr3oadopt lu ol(0t2xmir iu4lpt lici tf Dur(  ot4alx if3iydfsDeaumsn(0 rxnmr3iatlmD an il(0 eumxm nydap   ies s) Dumu ont0oeeomicilt mDrmnmo;t0aexnmo3oodomDranes t sruoir3no4ol nmicias arurxrp;o1oeeoifctyt s emuvo;t0 leoir3to1fmDelues;t s2urir3io1apeelivsa()s2taur ot4texnmfeiltlm em(msnt0arenif todfm  lnvs s0texoxm3nudomt lietltf Durx pno0apen ieiytlaDemn sn()tetoxrciadomDr ueol(0s2tmirpoo4llee fct tfs2taxm ;t4tpxo oetyd m2ulu s t4aeeoxfcoadom  aneol() 2uoxo nodlmte ivs tfs2rrxmont0aexoioeiltfa2emn o;u)artoxo3iydfm ranesls)trurimpnydamt livtlt srtmx  no1alx mo3tatla uluvsnu) eenmociadfaDr i ol(0 etoxr3ny4optelfci sfsDrmxro;t1aetoiieiydlsDum(von(0tlxrmfciadlpDrli s;( tetoxo iudol nmicsl( artaxm ;o0tle micildfm rm(ms;t4arxnxr tadoaDrln s s0 2to(opou1op nlivslsfsrrrxr oo4apxoii3tat m umn pnt4 rermrcoydoaDr nvo s0 2xoimpnudlm nmivslt aDraum oo0alt iicildlm2ranmsnt0tetrmf totomtelnvslt0 2xoxopno1ap nmnvta()a2rm(mpnu4aex  o3tld mDulu ont0aetrxfciatfptrln i ()setr(rpiodomt mict sf Durxm nu4oltomfctadls2eau o (0 ltrmr3ootoptraues ( seumxo nu4lpee ncsltf ruaxmp;o0opxn oeilsfs2ulnvp t4arxoirciytlmte i sl(0 etoir ny4op e icsat sDtmxm ;o4tltnioeias a2uaumo;u4aexoxo tadlp eaivo t0sexmxm3no4llt mfciat)sruaumooo1ope  oeiat aDemn o;t4texoir3iatom rlu s (  rto(r oydaltnlictls s2raxro;t1oexoifctltla rln s u0tltoir totlatean o (0t2urxo3oo4ap emivtl( arraxrono4tlx  i3iadfsDum(mo;t)arxrxfctotop eanvo s0trxr(r nudlmte nei ()aDuaxmp;t0tleoif3iatfs2ranvo (4tlenxr tadfptrli o;t tetrxmpnu1aptnmnvs s aDraumpot0aetomieiysfa eau s u0 etnmocoodfm rluvs;(0seuoxrpio1lptn fei tfsrraxrono1olx  fctld s umn s;(0 lxrxociytoate ieo ()t2uoir oodapenlict sfarua(mpou0oexnio3tlsfsDulumonu0altomrcoadoat aivo s  etoir3no1am emfet (f 2ta(mooo1oex  f3iat aDea(von(4trenmr iatfmtr u s (0 etmxm3nu4lltnmnvtat)sruax  ;t1openii3iydlm rlu s;t0aetoircoytoate ieol()seuoxm3iodol n nvsls)artmx  ;t1aeenif3ilslmDeanmo t)tlxrif3oy1fpte uvs;s)teuoir iy1optemfeia(faDtaxmo;u1aetoiieiytfs2ranvo;(4 etniociodlm eanvs;t t2urir oodaptemfeils  2umu  ;o0apx  fetydls2rm( ont4tetrmrcoa1fp e u ols) eumxo ou1om emfctl(f rrru pno0aex  ictasfaDul(msnu0 rtnio ootopD  nvs (0 2tm(rpno4lleemivs t srrm(mooo4aeeomo3iadfmDul(vpn()tetomfcio1lpDeanes;t)trurim nodlp  liviat)a2taxmonu4aptnifetasla2el(mp;t0tlxoxfciy1lm elivolt0texrim3iu4altnlfeiat srtrump;t0aleo f3iytlmDel(ms u0 eermr3tadom  lneol(0 2tr(mpou4ole miesltf 2ua(r ;u1apxoiiciadfs um( p;t) etrifcoa1oaDr nes;(0 eur(o iy4alenmiet ( aDrax p;u4altnif3iytfs rl(vpnu)tltomf3oa1fm eanei;t0 2urxr3nudameemnvil(  2uaxr no0tpe ii3tytfa rmnmsnt)arxoif oadlp  liesls0 exo(m no4lpe  fetas aDrrumo;u0texomf3iydla elu pnu4alxnxo3iodfptraivo;(0trur(r io1ll e icta(f Dtmxmpnu0texn i3tatlaDelnvp;u4 lxoiocoa1lmt lues ()s2uoxr nu4alen ncta(faDtaumo;u1aeto fciadfaDem( o;t)aeerxf iodfmte n ils)trxmiopnu1om   fcil() rtm(  ;t1tetnioctld aDuau snu)teeoxfcty1fpDeli ol()t2to(mpio4am emnci t) rtrxmpot4tptnmf3ildfsDumums;(0areoxf oa1fatran olt0trxoxo3ny1lltn neias  Dtmxm oo1ope mfciysfa uau p (4tlenmo3oo1oaD luvol(0sruo(opiy4al nmncs t srta(r oo4apenmociytfmDea(vp t4 exrmrcoy1oat luvo;s)setmio oudopenmictat)s2rmur ;o0texnioeild a2ul(mp u)tleoifciodop raneols0trxrxo ny1amt lnci ( s2tmxroou1opxoiocilsfmDem(von()trxrmrciy1lpt  iei;t)trurxo3iy1optemicsat arrmumo;u4opx ioeias s umu p t0 exrif todoaDrlnvslt)seum(rpnodomt  ivta()srrrxront1tlt if3iat a um(monu)arxrir ta1oa eluvs t)setrxrpnydlpe  ietltfaDrrxrpou4opxnmfciasla2um( o u0 lxrmr3oadlaD luvo s) rurim io4ape  ivs s aDum(m nt4texn f3tatla uluvp () etnxr tytlptrln ol(0sexrirpiudom   iciatfartm( ono0aexnmo3tldlaDuan s;u4aexrioctatomt lueols0t2uoxopoodlm n ictas a2trxrpou4ape  f3iad m2ranvs (0trxoif3ty1laD aiesls) rtoio nydolee fcilsf ruaur ;o4apeomfctyt a2ul( s;(4 rtrif io1oaDe n sl()srtrxo nudamtnlfvia()srtr(r oo0tleoifeiyd a2ulnvp;u0alermr iadlatelieil()s2xoxo3io4llt mncs s) 2tmum nu0optn oetydfa2eluvp ()arenioctotfpDelieo s setrxr3nu1al emfes t)srraum nu4tpt  fetls s emn p;(4altrxociodfaD anvs;( teto(opiydlpenliesas a2tmur ;o1oex  fcildfmDel( o;t0aexomr todlptelu o;t0trtmxr no1amenlnesat)a2umx  ;t4ape  oetldfa rluvp;u) eeoir3oodlmt aivo t  ruoxrpiu1lme mivi (f rrmx pnu1ole ii3ildlm2umnmo;t0aeeoif3oytfpt  n i;t)srtrim3iudlp nlnvtl(faDrrx onu4olx mf3tydfs2emu p;t)trerir3ootla ranvil(0srxm(o oydope lfvtatf rtaxrpot4aeen fetltlsDua(vo ()teenir oa1opDr uvo;t0 2xo(m3iy4om nmics tfaDuax pot0opto ieiytfmDrmnmp (0tlenmo3oa1fmD aieo s)trxoxm nu1llenmfvias)arurx pnt4opx iieiyt a rln p t4alenmf3tytlp rlnvi t seur(mpoo1op e nvi (fa2uax  oo4altoif3iatfm2ul(mp;()tleomoctatlaDraies s) exrir nu1altn ivt sf rrax  no4aexomiciysfs ea( ont) exrmrcoytomDr u o;s  2umim3oy1om e fct ()s2raumpoo0oltomiciad s2ran o (4aetoxo iy1latr ivi;t  exo(mpio1op e fvilt  rta(m nt0tpxnio3iltls2eaumo t) rtrio3oo1lat lneols)trtmxm oo4apenlfcsl( a2trxmpnu1aex if3iltfa rlu s;u0alenmr3iytomt an o t0trum(r3iy1op e ics ( artmx oou4tlxnmoeildla2rlnvo u0aexrir io1optrlnvi t s2urio no1lpt mfcsas arumxr ;o4opx  iciytfs2eln pnt)trxnmfcto1fpDe nes;t0 eurxo no4lp  licta()arra( p;o0teto o3iydfs rl( o ()texrxr3iadom rln slt  2umxm nu1om e fesas a2taxr no1tpto oetysfa raums t0tlxnif ootlat  ueo;t0srxoir nodame  fet ( a2tmur ;u1tex moeiys aDemumont0trenxrcoatomDr nvs (0s2xm(r3no4oltn fcsls  ruaurp;u4tpto iciydfaDumumont)tltrircty1fpDr n i s srxoim3no4oleelfvs (f rurur oo0oexn octldls2uln p ()aexomo3ty1omDelneo;t0sexr(rpoy1apeemnetltfa2tmuroot1opt iieiatlm rmums;u0alxoir ia1faDelivil( srxmxopou4alenlicil()srur(ro;u0teeoiicilt sDul(mpnt) reniocoydomt lnesl(0t2xmio oydap emfetas)s2uaurooo1tetn fciydfsDrln p;u4tltoif3tatomtelieo s0t2trxmpio4ole  iesls s2ua(m ;o0tpt mi3tltfm rmums;(0treoir3iytlp eaies;t) exoio3ny1am   ivta()a2taxm ;t4tpxnifctytfa2el(mo;u)arxrmfciatoat au o t) 2to(m ny1am elivsa()a2raxmoou4tetnmf3iadfa ulums u)teerif3oytlmtr nvi t)t2ur(rpnu1lpenlietlsfartm(ronu0alenmoeiltlm elnmp u4altnmfcoadfaD aivol()trtm(r3oudlm nlfvsl( aDrm(mont0oet moctysfsDua( o t) rtrmociadlmDe ueo;s  2to(r oudameemfcias)sDtaxmpno0oetoiiciydfa2elnvsnt) reoxo iadoat liei t0t2tr(mpnydap nmfvi ()arurxroou0optn ociydfmDulnvp;t)texnir3ootopt livo;t  eurxr3no1lmenlici sf 2ur(ronu4texo f3tltlsDrmnvp;t0 eenxociytla  aivslt0 rtoxrpio4ll   nes t a2um(mo;u0olenifetat aDelnmpn(4 reoir tatlp  an i t0truoim oy4ome lnct sfsrraurp;o4tltomoeiltlmDem(vp;t4 exnxrctadomDr u ols t2um(o nu1lm emnetlt s2urumonu1altoioeiydlaDra( p (0trtnio oo1fmt aivi;()tetr(m iudlme  fvi ()aDtmxro;t4aeeo f3iadlsDuluvpnt0 lxoxr3iodlp  aivils)t2xrxr3no4op   ncias arum(rono4opx ioetltfa2umuvsn() reoir oa1oat an i s0tetr(o io4amtnlics tf 2rauro;t1openmociaslsDel(vo () etoir3oytlaDr ueo;s0 etoxr3oodap  mnvsa()a2umumooo1tpxnmi3tytfsDulnvonu) etrmo oatomtrauvs;t)trxo(opiu4lm  licils  2tauro;o4opx  o3ild m2eln snt)aeeomr iatfpD ln ilt0 euoxrpoodopenmfcs t  2tr(mpno1teen o3iltfsDemuvp;u) rerif3ootlpt liesl(0s2trxopou4oltnlnei sfa2rr(mpno1tlx ioctldlmDumnvsnu) leomocoy1lmDe u i;( s2toxmpiudll nlfetatfs2rrxm no4tex  iciyd aDrlu o;t4 renifcia1lmt ln o;() 2um(r io1lp emivt tfsDumx  no4tpxnio3ildfa2eauvs (4 reoio3iadfaDe n o;t s2umxr3oydal nmfcsasfa2ua(rpot1teenmf3iytls rlumo;t0 lenxr3oa1fp   neo;()t2toxopny1lm   ivi s) 2tru  ;o1olx  ociyt s2uln pnu4trxoxf3to1faDrauvilt) eurimpoudamen netls)s2umx pou4tee  i3tas aDulnms;u) rtnio iadlat  n ols0 rxrirpoodapte feiasfaDtrxm nt0openmfeiatlsDeanms;t0 renmr3oytlptraies ()t2umxrpny1apeemncslt) rra(  ou4optnmoetaslm2uan p u)teenir3iadom rlivil(0teur(mpoy4omt mfvt (fa2taumoot1oex mo3tyd sDumnvon(4aleomf tadfm raneo;s0s2xmxo ou1ll  liviat  rrauroou1oleo o3iys s2emnmsnu) eermf tydlateaivols)tetmirpoydll emieta( s2ua(moou1tpenifciyslm2rm(vo;u)texrmfciodfmDelueo t0 eto(r3iu4lmtn nvtatf rrru ono1apx mo3ias a2emuvs;t4 exrmr ty1opD  i o () 2xm(rpoo1om n icilt sDrru pnt1tlt ii3ilt a2eaumsn(4tetomfcoo1lm eaivo;( setm(opoy4ol n neias aDumxrono4tlxoiieiadlaDrl( s;u4texoir3iydla  aiesls0srxmxrpoo4olt  fviltfartr(rpot0oex ii3ildls2rlu s ()aeenmociydfat lu sl(0 exmiopoudaptnlnviat)artm(rpnt1tpeoiiciltlaDrmumonu4tetnmf3oytoa eli i t0trxmio3nu1lp   net t srtru pou0aleoiicildfa ranvp t)alxoif tadopte nvi;t)srtoim oy4olee ieiat s2raxmpoo1tet iicils m2rmn p (4teerxf3oytfate n o t)setoio oo1lpenmicslt  rra(ro;t4oltn ociasfmDrlnvsnu0tlxnirctodfpteli s;(0srto(mpou1ome  nvsl( aDtmu ooo1alt ifciasfa rau o;(4tlxrxf ta1om elneslt0 2umirpoydamtelncslsfsruaxmp;u4texoif3ild a elu p;() rxnir3tatoaDrlues ( tetmir no4ap emfesas)artaxroot1aee io3iatfm2el( pnu) rtnircoo1fa e u i;s t2umir3iodol n fetls) rtmumoou0apxoif3tls sDuanvonu4tleoxr iotoaD  uvsls) 2tr(o no4lpt mivsat aDtau pnt0oee moctat s2rln ont4 renxf3oodfm raivsls)srtmim io1alenmfesl(  2ua(m ou0opxnifctlsfm rln snu)altnmoctotla eaivi (  2trio iudll e fet t) ruaxronu4opxniietytfsDrmnmp u0altnmr3oadoaD aneols truoir nu1am nmfcilt)sDrm(mpou0oexo f3ias a ua(mo;t) eerxoctadlm  liei s0 rxr(opiu4amtemnvilsf rtrxmooo1tlxomi3iatfm eaump;t)artomfcto1lmtranvils) etm(opoydam elicsls a2trxm ou0oex ifctatlm2ul(ms;u) etoxrcoadlpDe uei s)trum(m no4lpeelnei sfa2umx  ot4oeeomfeiys s2em(vo;u)trtrif3iatfa e ueo t0 2umxm io4lptnmncs s s2tr(rp;u0tet mfeiyd a ul(vs;u4 rtrxo tatoat anei ( teuoxmpiy1altnlfvtlsfaDraxront4tltnio3tysfs2rm(ms t4 reomo iydfateau olt)teur(mpnydomtemivtltfarua(rooo4tlto i3ildlmDulnms u)trxnxo iytfm rln i s0setoio iy1omt lnvsl(f 2rrur nu4opx  o3iytfsDumnms;u)texrif iatoa elivo;t0 rxoxm3iydllte nvt t)artrxrono4opxomfeiyt a2rm(msnu4 lxoxrciatlm  li ils0 2uoxo3iydoptnmicia(  rua(r ;t4tle ioctltlmDulumo;() exnmr oatfpD an olt0s2umim iudaptnlnctl()aDurxr ;o4tlx ifctad m ra( s u0tetrxf3oytfpDeanes;t) rtr(r3ny4lle  ivtlt) 2urx pou1oetoifcias sDeau p;() exnxociatfmDe neolt s2tmim3nu1apeelnvta() Durxro;o1oetomf3iadlm ra(mp u0tlenifcio1fmtr u i s sruoirpiodome  ncils) rua(rpno4aeeo ieias mDua(vp t4 ltomf oydfpDe uvols) rxoxm3nu4al  livia( aDra(mpot0alt ifctltlaDemuvp;u0tlenmo3iy1lmtraiei;s0srtoxrpiu4op emivsltfartaxmpno0tpeo i3tldlaDulnvs;(4artrircoa1lp  livo;(0 rxo(r oo4amenlnvsas) 2uaxr nu0tptomietld m em(vp;u) exnir3ty1oa e nesl( s2urxo3nu4lmee ncsls  rrmurpnu0tltnmo3ilsla ua(vsnt)tltnmrcoytopDeluesl(0seuoir3no1omt lfvtls)arraur no0oetn fciys m rl( onu)altrxoctytoa elneslt trtr(o oo4amen fet t arrrumono0oetnmiciytlm2uluvp (0 rxnxfcoytlaDeln s;s)sruoxm iudame  fcilt aruaurpnu0tptnio3iyd s2ra( pnu0 etomocoy1faD  ueo;t0teur(m oo1lm n iesa( srtrx onu4altoiieildfs2umu o u4altoifciotoaD lu i;s)t2tmirpiudlmte nvtasfa2tax  no4teeomf3ias sDumnvp;() leoio to1lm   ivslt)seuoirpiudoptn neil( a2uau  ot1olxomociaslmDuaumo t0texnxr3ia1fpDrai s t srumxr nu4lptemnetasf 2tr(  ;o1oltoioeiydlm rl(vs (4tlenxo iotlp elnvs s)srtrimpoy4lpte nvt sfsrta(  no4aet ifetltls2ra(mp;u0 ltniociodfa   ieils)srtrimpou4omtnlfcs t) Dtm(mpot4alxnii3tatls2ua(ms;u)alxnxr3totlmt ln ols0sruoxo nu4lmtemfvtasfa2ua(m ou0alx ifciys sDrmu p u4aetnif3totom rluvilt0 etr(m3oy1amenlfvils s2uau onu0apx io3iasls2em(mpnt)arxnxr iotom ean i s0sruoxr no1ale  fvi (  Dtrx pot4alxniociydls eln o u) rtrif3iydfm e n o;t) exriopiu1al nlics t) rurxr ;t4tetnmi3ias a ra( o;t) reoxo oo1op elivi;s0sruo(mpnu4amt liesa(  2ta(mp;o1aexomoeias m2ul( o;u4arxomr io1lm r u s;t  2ur(mpny1ape  iei ()a2ur(r no1olxo o3tlsla el(vpnt) etoiocoatop eln s;()texmxopnu4ol nmivil(fs2rrxrooo4teenmo3ild mDrmn p;u0arerxo3oydfptean o;s0seto(m3no1omtn ivslt aDtrx  ;o1tet ifeiysla2ea(vp;u0 ltrir iodlpD  ies;s seuoxopio4amtnmfvtl( sDrmxrpot0altomociys mDulnvp u0tetoxf todla   ieo;t0seurio3nu4om  lfcsls sDuru p;u1tet  i3ias m2uan p;t0aetnif3oydoatrau o t) exo(opny1al  lneilsfsDua(moot1apx  fciatlm emn on(4tlxoxr3ia1fm e nvil(  eurio io1ol emfcils srurxr ;u4teeomfeiatls2ra(vpn(0artnir3iotlp   i il(0seuo(o no4lptnlivi tfsrraxmp;t4tlt iicilslaDua(mont4alenifcoadopteaies;s  2tmimpio1apenmics tf 2tmxmpnu0alen iciyt s2uln snt4 reomf3oa1oateanei s  rtmir3oy1apeemnct t)arrm(root4tlx if3tld s2uau p;t4aeeomo3ia1lpDrli slt s2tm(m3oydlmte nei t aDurx  nt0aptn fctltls rmums;t4alenxo3iadopt livs;( t2to(rpnu1om e nci s srrrxm nt0oetomf3tadlm2uan s (4arxnxrcoy1fmDrlueolt0t2um(m ny4lptnmfctltfa2ta(rp;t0aeeomo3tld s ulnvp;u) exomf3ta1la eaieo;t s2toxr ou1optn nvils)sDuaxroot1oleomi3iltla2em(ms;(4 reomr tatlaDeanvs;s0 2xmio io1omeemnvs s) rrrumono4apeoiociaslm uan p;(4texnmf ty1lptraiesls) 2umir ny4amt lfet (farua(r ou4tee ii3iadla2eluvs;() ltomfciodlm e nesl(0t2toim3ny4opt  nes t arra(mpot0apx  f3iyt m um( o u0 lxnir iytlmD lnvol(0 etrir iodlm  lfci sf rtrumpot0oet miciltfmDulnms (4 exoio totom rlnvo ()srtrxm3ou1ll nmfvtas  Dtmx  ;u0texnio3tls m emnmonu0 ltnxr3oo1fmDrli ils  exoxopio1ll nlneil( aDuaxrpnt1tleo ociys sDra( p;(0trxriocoadoatrlieo;s  2toim3ny1omenmfvt ( sDumxmpoo0optnmfeiltlm uanvsn(0trxrmr3io1faD  ueols  rtmxrpiy4llenlfvtltfsrur( ono4opx  ieiatlaDel(vs () etnmr iytla eaiei;t srxo(m oodame  fcsa(fsDrm(ro;u4oexnioeias a2rluvp;u4 eermf io1oaDr ueolt0t2tmxm ny4oltelivsa(fs2raxmpoo0opxn o3tlslmDelnvp;t4aexomrctydfpDrai ols0 eto(r3nodlpe  ivsasfsDtrxroot1tetnmicilslm um(vsnu4 leoir tatlmtr ieols)setrio3iu1lmte fcsa(f Dua(rooo1opxn o3iadfs2uan o (0 lxoxo totlmD  u ils0 rto(rpiy1lpeelfeiasf 2ur(ro;u0texnifeiad a2umuvon(4arxnio3oytom e neo;s  etrim3iudal  mnvils aDua( poo1tpe iociyt mDrm(vsn(0 eerircia1oatraivo s0 eum(m3io4ap  lnci t)s2rrump;o4ale iicilt m eanvo u)treoiociadfmD lu s (  eum(o3iu1apte fvt ( s2umu  oo4opxo feiyt sDua(mo;t4trxnmrcoo1lpte i s;s  rur(r3oodapen ncia()s2rrumpou1texniociydls rmu o;()tlxomocoytoaDeau ilt) 2xmxo3iydlpte neta(f rtmuronu1teenifeiad s rln p;(0aexnmf3iotoa  au s ()trtmio3iodapte ncs sfs2trxmont1oeeomieilt s2rmn s;t4tltrmocty1lmtranei (  2urxm3ou4amen fet tf rraxro;o1aex mo3iltls uauvo;u0aexrxrcootfpD livi (0seur(mpoy1omee ivils)s2rmum ;t4apxomietyt a uan pnu4 lxnmo3tatfpt  ivo s0 etm(opou1ap nlfcs t  Dtm( pnt1tleo ieiatlmDumuvs t4 renmr3todfpt lu o;s) rtm(rpiu4lp nlfesa( s2tmx  ot1oetomietat s2eluvo;u)alerif3oodlatr uvo s t2trxo io4alte fetl()a2tmu ono0olen ieils a ua(vs;t) renxfctatfpDr uvils t2xr(rpnu1al n icil(fa2trx  ;u4oleoif3tyt sDulnmsnt)alxnmo3oytlaDe uvi t truo(m iodapeemnvtasfs2tmxrpoo0openifctat m ran p;t)texrir tadomteln ol(0trxrxm3oy4oleemnvsas srumx o;u4tptoiieiaslsDrm(vp (0texoxf3ty1fa   ueo t)t2umxo3nudlmt mfcias)srtm(mono1altomf3iytla el( s t4tlxoxfcia1oa eaueo s sexmxrpny1llee nvil( srumuro;u0apenioeiltla2umumo;u4 eenmo3tytlp  auvo t) eumxo io4ap  mnvsa(f 2taxm ;u1oltomoeiysfaDemu o ()alermr totomDr ues t)trtrxm nodlpeelfei tfsrumu p;u1teenii3iyd sDulnvp;u0 lxrir iytlp r i o ()t2urxm ou1alt  ivil( arur(mpoo1oetnmi3ild sDrln o u)aeeoxr ootfm  liesls0 exrim3oudamee ictltfsDta(  no4teen fctysla2ean p t0 rxrir ia1lp raueil(  2xr(o oo1olte icsasfa2umurpoo4aexo i3ilslmDel(mp;t4altrifctodomDr ies t0 rxo(o ou4altn nei () rum( onu4opeoio3iys s rmnvsnu0 lxrxrcoa1omteln il( truo(r io4ame  feiat sruaurpnt1opxniieiyt a2rau pnu0tetomocia1fmtrli s t s2xrxm iudape miet t srur(moot0tlx mociyt sDea( p t4 etomociy1fp   u s t) eumio3iodll   ncsat)aruau o;t0tet if3iatlm rmnvont)trxomfctytfp  aivi;s  etrxm io1amen feia(fa2tm(roou0tee iociasfsDeau on(4tlermr3todfmDrai s;t)s2tm(m3iy1opeemiciasf rrrumpot4tpe mf3tasfa um(vsn(0arenir3tatlmt an s (0 2toxm3iy1opee ictls  rurx  nt4alen oetasfmDra(vp t4alxomf iydfpDelueo;t0 2uo(opno1om emicias)srtrxrpot4apen ictas a ua( p (4aetnmo ty1faDelu ols) exrxr3ny4omtelicsls) rua(rp;o0tpenmfctytls ean s t)artoxo totfpDeli s t trtoio3ny4lltemfci sfs2ua(ront0aeenmieils s ua( onu0aexoxr3oy1lpD  u o;t trtriopiydoleemfvtlt a2umum ot1tlt mi3iasls2el( on()trerifciytfaD  u s (0t2toir oo4aptn nvsatf rtrur ;u0tlxn ieiatfm um(ms u) lxnmo ty1fmteau s;s texrxr3nu4lmt mfcsl( s2rrxmpou0tlxomf3tldlaDea( p t0tlxoir iodfpt lneo s) 2umim nu4omeelnei ( aDurxrp;u0oee  ictltlm eln s u0tetrmo totfa rai i;(0 rumxo3no4olte feilt  rtr(ro;u4tetomfciat sDuauvo;u)texnir3oytfptrlnvo (  2xo(m3io4lpee ivtltfsruax ooo4apx io3iyslm2ulnmo;t)aeerio3to1lptelneol( texoir3io4lp emiei t) Dumx pnt1opxo f3tatfs2rlu o;u4trtnio3iy1lmteliei t teurir3io4ll e fcsls srurxmpnu1oex ifciyd sDum( s (4 rxnio3ta1fmDr ivo;s0t2urir iydlmen neia( aDuaxmono0olxomfctat sDrlu s ()tlerxf ty1la eanvi;t0 2umxr3nodom nlfct s s2umx pou4aeenmf3iyslsDemuvon(0 rxnmf3iodomt  i o;(0 etm(rpio1lleemfct s  2raumo;t1oeen iciad m rlu pnt0trxrxociotopt  neol()s2urir nu1op  lncs s)a2urxro;o1alxnifeiytls el(vo;u) lxnifcto1lm e neslt)s2tm(r3io1apenmnvsls aDraxm ou4tpeo ieiltfs umu p u4tlxoxr iodfat au i;s) 2xo(m iy4lme  fvsls)srtmxrpnt1teeoif3tydlm2um( o u0tlenmr oo1optraies;s0t2xrirpiydll  lfcs (f Dtrx  ot1opxomictadlsDeln snu)texrif3oa1oaDe uei;(0trtoio3oodlp n ncs s aDtrx oou0apeoiietatlsDul(vp ()trtrmfctotopte uvs t)t2umxo nu4ll  mnet (fsrtrx  nu4tetomi3tlt a2rm(vsnt)tlxnmo3ootfm e ies;( seumir no4llt  nvslt) Drmurp;o0opx iocias sDelnvon(0 ltomo3io1opD auvolt0s2toxm nu1lpe lnvtl(f ruaxmpno4teto ociatfmDeanvo u4trxnmr oydoaD li sls)t2tmxmpoo4lmtemnvilsfsrrau onu0ope mf3ilsfm eanmp;t) exoif3ty1lmDraies (  euoimpiu1ap  mfei () rua( ono1olxnioeiysfm ua( snu) rerxr3ta1fmt lieil()trtoir iu1ole miciat  Dtmxrpot4tpe io3iyd m2uanms u4 exnxo totfp rlivi;s sexoiopoudlp  lfcia()a2rmu pou0openmfciadfm em( p;t4 ltoxr oy1lm raneo;t0srtr(r oo1lpee nvs t) Drrxr ;u4opxomoeiasfs uln p () lenxocoatfmtrln sl(0 2to(m3nu4aptemnviltfaDrr(r ou0opeomo3iadls2emumo;(4aeenxr3oy1laDeaueslt  exrio3oy1lmtn ici t)srtmuro;t1oltnmf3tlsfm2ea(msnu0 lxrxo iatoaDe ivi t0srtrio nudllt mfct t arumxmpnt0tlto o3ild s rmu p t4tlerio3iodfpDean s t0 rtr(m3iudlleelivta(  Drau o;t4alenif3iysfaDulnvp;u)arxnmfciy1lmD  ieolt)texr(m3ny4al e icsas sDtaum ot4apxnmo3ildfm2uln p (4tetnmociydlp ran ol( tetmir iy4alt mneslt) 2tauroot1tlxnmf3tat sDua(mp;u) lxoio oodfmt lieo;( sexoimpio4ope mnctlsfartm(  ;o0oltomfctltlm rlumo;(0aeerxf3iydom   u ilt trxrio3nu1amenlnvsl() 2ua(rpoo0aeen ieiys s elumont4teerxoctadlmDe uvo t0texmxr3nudol nmncils)srrr( pno0apt ii3iltfa um(vsn()altrir3iodfp  luvs;t) 2xoxrpiodalenlfvslt)srtmxmoou0apxnmo3iytls2rln o;t0artrxo oydop eai i (  rum(o nu4lltelneilt  rumxr ;t1tlx ii3iys mDum(vpnu4arenio3iydoat ln o (0 eum(r iy1lleelictls) 2uau pnu1openmfeiatfs rlnms;u4tltnmfctydlpD ai olt  2urirpio1am n iet t)aDtmx onu0olx  ocils sDrauvpnu)teenmr3oo1lateai s (  2um(m3iodaltemivsa(fsrtmx p;u0tee mociys m2rl( o;t)trxnmo3io1fptraivs;t0 exoxmpoy4ll  lfetas)sDtm(mpno0olen octatfmDua(vp;(0artoxrcoo1op e i sl( trxrio3iudal  lfvias)sDtm(ro;o0opto ociadfs elu s;u0 rxnxo3iotlpDr uei s0seto(r oodop e ncsl()a2raxrpnu0tlto ieiyslsDrl( p ()tetnxociodfmD  nesl( tetr(rpou1amenmfcsat a2ur(mono1opxoio3iatfm um(mo;t)teerio3ootfaDeaueslt)srtoxrpoodlpenmnvi t)sDta(mpno0aeeomo3iatfsDra(vont4altrmo oadfaDrluvo;( trtoxopiy4lmte nct (  2ua(r ou0tlen iciadlmDea( o t0 etrmr iodlm r i s t) rtmxm3nudamtemieilt)aDua(mpot0alt  f3iat mDra(mo;t)alerxr3tydlaDelnvil( t2uo(o3oo4omt mnvil()s2tax onu1opxo octat m2rln o u) exoifcoo1opDelneo;s  ruoiopnodlm   ieil()arum(moou1aeen f3tld sDrlnms t)tlerxf3oytlmt  uvs ( sruo(o3ou4lltnlici ( s2rm( p;t1altniiciltfm2ulu p t4arermr to1fm elues;(0texoirpoodom n netlsfs2uaxrono1open iciadlaDea( o u4 exnir3oydlm eaieo s  2xmir nydlltelfvtl(f 2tauroot0tltn ocils a rlumo t0 exrmf3iy1opDrln s s teumxmpoodamen fvtasfaDurxrpnt1olt ifctyt mDrmump;u0 lxomocia1la rlu s;t) 2um(r3no4olt  fvtatfsDtru  ;u1olenif3iytlmDranmpn()tleniocio1lpteaivs t0teurxrpnodom nmnvsl(f Dtaum ;u1tet iictatfs um(mo;u)tetnxf oatlmte uvo;s sexm(rpno1lleemfet ()a2uaurpoo0tlt iiciyd aDrm(mo;u4tltnifcoy1fatran olt teumimpio1olt  fcsas artmxrp;u1tleo o3tls mDem(vpnt)trtrmr3oo1laDr u i;s)trxoxr3no4ole miet s)a2rrx p;u4tpen oetldfmDraump u0areomrctatop eanvi s)s2to(o oodameemiesl()arrrxrpou1apeoioetatfsDrm(mo u4treoif tydomDeln ol(0teurim3oo1opte iciatfarrrx  ;u4opeomociatfa ean ont) etomf3iadoa r uvsls teurxopno1alee fvt s s2trur oo0olt iietas a2el(mo t)areniocoadomDean i;(0teto(opoo4llen nesa(faDur(  nu4alxn iciatfa rauvsnt)trermr tydoaD au ol(0 2xmxrpnu4lmt  ietl(fsrtmxrpot0tee mo3tlslsDua( p u)alxnio3iodfaDraues;s0 rxoxmpno4alee fvils srtm(m ot4oeeoiictldlm rm(vp u0 etoxfciadlm elues s)srxmimpou4lpte icils)s2tmuroou0alx  ieiyt s2uln ont)aleoio3ootfa  lieil(0 ruoxrpnu1lp emfesat  rumuro;t4oetoifeiyd a ran sn()tetrmr io1fmDr iei t  2tr(r3nu4lltelnes ( s2taxmo;o4alt  ociaslm2elnmp;(4trtomf3tydla e nvo;(0t2tm(mpoydopte fvsl(fs2urum ot4opeoifcilslmDel( ont)tlxoxrcoatfat aieol( tetoio iy1lpe lfvsl() Dtrum ou4tpeo i3iadlm ea(vp t0arxrxr iatlateli s t)s2tmir3nodll nmiei tfa2um( oou0aptnmi3ilsls el(vs (4 eenxf ootfmtelneilt) rxrxr oydlltnlicil() rumxrpno4tlen fetysfa2um( p;()aexnir iatfmteaneo;s)trumxo3nodlle miciasfsrraxmont0oet ifeildfsDrmnvsn(4tetomo3iytoaD  u s;(  exmio no4om n nes s) rrmxm nt1aeto i3iltfm rmnmo u4 ltnmf3io1fmtranvols trtr(o iy1oltnmivsls sDrm(roou0texniiciad mDemu s ()aetnxf to1optelnei (0setmxmpno1lp nmncs tfa2rau pnu4tpen iciatlsDuan o t4trtnxfciy1fmDr uvi;s0s2to(m iodale mfvsat)a2taurpnt1alx  i3iadfs2ran s (0aeeoxfctadlmtr uvi () rxr(r oy4lptelivta(f 2rrumpnt0tlx io3iatlm uauvpnu0 eeoio3oytla  lnvs t setm(m3oo4llen nvt tfa2ur(rpot0tlt moeiaslmDemnmonu)tlenxf3oadopD aiei;s)tetr(opny4lmen iei (fs2taxmpou0alt io3tyt a ra(vp u)teeoif iadoa elneo;s0seurim nu4ameemicilsfa2trx  nt4aeenmfeiasla2eln sn(4treomf3ootfa e nvs;t  ruoim nu1llt lfesa( sDrmxr ;o0altomieiys s rl(ms t4arxoir iytfpteluesls0 rxrim ny4lp  mict t  rurxr ;u4tle  f3iys m ra(mpnt4teerxf oo1la raivolt) 2toxm oy4al  lnvi (farum( ont0ape mfeiydfm2umnms u0trxnxfctatomDr nei;()srxoio3iy4lp emnvi (f rtmurpoo0alxnmfeiat m emn p;t0aexnif iydlptrlueo;s0 2tmxrpnodlmt mfviltf 2rmuronu0opx  oeiat a2eanmp;(4tlenif3iy1fpDraneilt0teurimpno1al   nciat  Dtrxrpnu4oex mf3iatlm eanms u4texnmo oatfaDraivi s texoimpno4alen ncs (  2ta(mono1tpt mfeiadla uauvs ()altrmr3tadlpDrli o;t0 eurim iodlp  micsl( a2raumo;u1tlenioeiydlm ranvpnu) etniocoydlaDr neilt0t2to(o3nu1olt lnei t a2urxmp;o4aetoifctadfs ulu snt0aetoioctadfmD auvi t0 2xo(o oy4om  lfviat)srrm(m ;u4ape ifctltfaDea(monu0 leoxf tadlpD lneils0s2uo(r3iy4amtn fesls) 2uru  ou4optoio3iytfmDean pnu)teenmocoodoatr nvi;s)setm(r iy1aleemneiatfs2tru pnt1aexo fetlslmDemnvonu4 lxrir3to1op rlieslt0trto(r oodolt  feta(faDum(  ;u1aetoio3tys s ea(monu0 rtnio todomt lueo s t2tm(m nudom nmfesasfa2uru  ;t4opxo octyt s2raumpn()aetoifcty1fp  anvo;(0seur(r oudom nmnesat)aDtrxro;o0aexnio3ildla2rm(vs (0alerxocootlaDeli ols) etoio nodaleelict tfsrrax  ou0oeeo ietasfs2umn o u4texnifciy1la  auei;()trurxrpou4op emncta() 2tmx pno4tetnmo3tasfa eln o ()tltrmoctytfp eln slt  eurirpno1opeelici () rrm(monu1apxn f3ildfa emnms;(0trxrxo iydfaDe ies s)teto(o io4lm  lnetas) 2ta( o;u4aeeomieiyd s emu o;u0aleoifctodopteli s;s)texo(m3iy1alenmfcsasfsDtm(  nu0opxoii3iys mDum(msnt) exnio todfat  i ils  rtrio ou1ap  miet s) Drru p;t0teeomociad m eln o t0aexoxrcty1opD an slt sexr(opiy1aptemivs sfaDtru  nt0oltomo3ild mDrau s;t4tlxrifciadfa e i slt  eur(opou1apte fes tfs2tr(m no4aee ii3tldlsDrm(vsnu0 reoxr iy1fm elnvi t s2urxr oodomen ict ( srua(roou4tpeoifeiysla2emumo;() exoxo3tydfpDraiei t0tetrirpny1aptnmieia()s2taum oo0oeen iciatlaDelnmp;u0trxnirciodla   i o;s) 2tmir3iu4lpeelieilt sDum(ronu1tpen o3ias s ea(ms;(0 lxomo3oo1laDrlieo (0s2umxmpiy1alte ncsls) rum(r nu1alt  iciytlmDul(vont0 rxoioctotlpDrlneols trtrxr3oo4lmen fvtlt a2tm( poo1oltn iciydls ulnmont)aexrmo3oydomDr n i t  rxm(m3oy4llte fet s sDtrxr no0aex mfetlsfaDrauvo (4 reomo3todfaDrlu s;t srtrir3io1llenlfvt (  2rmxr nu4tpenmf3ildfs eauvpnt0alerxociytfmt  neilt0 euoir iydapee ncs t s2ra(r no0teenmfciadlaDea( s u4 etrio3tatfa eln ilt t2urxm3iu1op elictl(  rumur ot4apenmf3ildls2emu pn()tlenif io1op rlnvol( t2um(o3oodapenlfeiasfsDrm( pou4oetnmoeilsla rl( pn() ltomrcia1fm   ivi;t)srxrxr iu4op n ivia()s2rax p;o0altnifetasfmDemn p (4 rxrioctatlaDrau i;t)t2uo(r oo1om n fcta(  2rau p;o1tet  i3iat a rluvp u) etnxf todfpte ivol(  eto(rpny4lm n feta(  rraum ;u4tpxnmietad aDeluvo u0aexnmrctadlp  lnvil()trtm(r3nydlm n nvtat s2trurp;u0aeenioetyt a2ulnmo u0artrmf3tytfmteluvi (  rtrio3iy1altnlfvtls s2rm(mpno0aptoii3iad s2ra(vo;(0 rxoiocootopDeanvi;(0t2xrxopou1olt mnviat artau  ;u1opt if3tadls ulu p;u)tlerio iodoatraies;() rtoxm3iu4ll n ivt t)s2taum ;o0aetoii3tasfm ranvsnu0 lenxr3oydlpDrlu s;s truoxm3iydalenlfcias sDuaurpot1aet miciytfmDrm( s ()arxomo tydoa rlu o (0srxr(r3ny4amee ict (  rtrxmp;u1optoioeiasfs umuvont0aetnir3todlp elivo;s0srtrio iudlpe lieslsfartrumoot4aetnmoetydlaDelums (4teerxf3ta1lp   ivo ()trxrirpoo4am elfvtat)a2tmu  no4oeeo i3iytfa eanms t0 ltomo oytfm rlnvsls)teurirpio1om nmict (faDtrxmo;o0aptomfeiysfaDuanmo;(0artrmrciatfp eauei s0t2umxrpno1am  lnvslt  2rauro;u1tle mfeiytfa el( sn(0alxoifcoadfmt au o ( sruo(m3nu1ape mivi t)aDtrurpot4tlxnifetydlsDrmnvpn(0arxnioctodoptelueils0sruoxm nodap  licil(fs2urx  ;t4apx mi3iytlm2umumsn(0arxnxr ta1fp r nesls)teto(r3iy1al  livsls arraxrpnt4tptomociytlmDea(ms t)aetrxo tydfp   ivo;( s2trxr oy1lpe  nct s aruaum ;u4apx ioetatfa2um(mp;()alenxf3tatomt anvo;()trxmxr3io1opt mict sfa2tmump;u4opx ioetadlm2umn p;t0 reomrcoodlpD anvo;s0 rtoim3nydopenmnviat)aDtrx pnu1oee iieiatfm rl(mo;(4trxnmr3oatlpDr neilt setrim iodope liet tf rtrx oou4olxnmociyd aDelu p (4tlxnmociatomt au i;s0 rtoxm3ny1op  mnvt t s2rru o;o0ape if3iltfa uau p;(0tlxoxf iodopD livo t  eur(r ny4apte ics s  Dtm(m nt1tptnifciys s2um(vo;(0tetomo3iydfptr iesls0s2xr(opoo1ol nlfeiasf 2uaurpot0tlxn fcias s2rlumont)tetrxf oodfaD li i;t)s2to(m nu4alte fctasfsDurxm ;o4texomfctyt a2emuvp (4teeoxf3tydomtraivil( s2xmim3iudalenlnctl() 2rmu pno0ole mf3ils a2umump ()aexnxf oytoat anvilt t2uriopoy1altn nvi ( sDrru pnu4oexn feiltla2ua( pnt)tetnmfcoadlmDelnvslt0sexo(o iu4lptn ncsasf rtax ooo1oleomicils sDem(mo;t4tlxnif oy1lpD  ueo s trurxr io1lpe  fet s srtaur ;u0apt iicils m2ra(mo t) lenio iytopDrluei;t0t2uriopiy4lm nlivtltfsrrrumoot1teenmf3iytfs2uaumsnt)tetoio oa1lm   uvo s  2urim iy1ll n neia( s2rm(roou0opto o3tad aDrlu o t0trxrxo3iytlm r ivo;t0 exm(m iudome mfvilt) 2um(rpot4apxniiciat a2rl( sn(4altrxocio1lpt aueols tetoim iydape lnvsa()sDurxront4altnmieiydla uau pn(4trxrxf ootom  ai ols s2tmxopoodome mfeiltfaDra(r nu0tptomoctytfa2rmnvsn(4trxrircoydla  auei ( t2um(opoodam elivt (f Dua(ro;o1oetnmo3tlsfaDemuvon(4artrxf3io1fpDrlivi s seuoir ny4lltnlfvsltfaDumu o;o4oexniociytla2emnmo ()treoio oodlate nvo;s texrxr iy1apt  feia( artrumpoo1apeoiieild m uanvo t4aetoir3oydlm raieo;(0srxoim3iy1ap emfcslt)a2ua(mo;o1aet iiciad sDea( o (0tltrif iodoa rluesl(0t2tmir3iu4lp elnvi tfaDur(mpnu1aetniiciydfm rln o t4 eeoircoa1fmtrln slt s2tm(m ny1am  mneiat  rtru o;o4tpen oetas mDua(vp (0 etnmr totlp eauvi t s2xo(r3nydolt micsl(fsDtm(r ot1tpxomoeiadls2uluvp;u4 leoxo oytlpt  nvo;() eto(mpiu1ol emnesatfs2tmu o;t0ole mo3iyd m ulu pn()aetrio tytlmDe ues t)trtmio nodap e icsltfs2rr(mp;t4texnioeiad sDelnvonu0texnmf oa1omDrlnvo ( trurxo nydop nlictl(fsruau ont0ope io3tasfa2rauvpnu0tltoifctatfat li s t  exmxm3oudlmt  ics (fartm(r ;u1texniocias s2ea(vs t0 lenio tydlm r u i;t sruoir3oudlp nlnetl(f rtaxrpno1aeeomfctadlsDulnmp t4 etnmo oytfpt aiesl( trurio nydameemicslt s2tm(mpoo4tltnii3tldfmDel(msnt0altomr3totoaDr ivi;(  exmxrpoydopeelfcias  rurumont4opxn iciydls2rlu p t4altoxrcoodlp  lnvo (0 rxr(o oo1olt  ictls)srta( ooo0olxnii3tytfm2umu p;u) renxr3todlmDe uvi;s s2xrxo iy4optemfeta()s2raxrono1tpen ocils a2rlnvsnt4trxrmf3oodom ranvolt0sruoxm nu4omen iciat aDumum ;t1aptnmictas a2rmu o u)tetoif oodop r i i;s0 2xmim3nudal emfvsatfsDtau  no4tleoioeiatlm2um( p;t0 renif3to1omDrlu i t)t2xr(opiu1aptn nvi t srrmxr ;o1alxo f3ildfsDulnmo u0tltoif3io1omD ai s;s)tetr(o3iodalte ivt s)arurumo;t0tpxo o3iyslsDua(mo;t4 leoir iadfp   nvs s0trumio iodlpee ietlt  rtrxrp;t4oltomo3iyslaDemumo u)aexrxfcootoat ai i (0truo(m iudllt mfvs s arrmu  ;o4tet  fetytfs rl(vonu0aeeomr3iodfpD liei;(  rxr(r3nu4omt mieil(fsrtr( pot4oetomoetltlm2ulums;u0aeerxr totfaDeanes;(0seumio ny4apt liviltf 2rr(mo;t4opt ii3iyt a umumon() rxoxo iytlat aneo ()s2tmirpiu1lme  ncs s a2umumpoo4tlenmo3iadlmDrluvsnt) renxo iatfaDr uvi () exrxm oydomen fviasfsDumu pnt4aee ifciyd sDeaumo u4areoxf3oatom  au s (0 etrxr nu4lltn ics s)sDumur nt0tet mo3iatfa umn o;()altnmfciy1omtrlivsl()t2xo(mpoodame  nvs (fsDtaxmo;o0olxn oeiytfsDuanmsn(4artrif io1opDe i o;t0s2urxm oudlp elfvi s srrmxmpnt1tlxoiieiltfmDuluvs;u0aetrirciodlpDran i t setrirpoy4olen feil( a2rm(rp;t4tltoii3ild sDrmnmonu0aeeoxr iytomt  ies;s)seumxr iodap n fet t)sDtmu p;u4apeomieiys sDuaumo t) lxnxr iotlptelies (0 2urim3iudll  mivsas srrmu pnt4tee  o3iydls rmumo;(4teermocia1lp  lnes ()seurxm3io1opeemfvilsf Dur( o;u0tlx  ieiysla2um(vp;u) rerxrciydop ranvs;t0 rxmir iodol   fvt () rua( poo4texomfetadfaDra( pnt4arerio3iadfpt  u ol(  rxmxm iudamt mnvias) Dua(mpnu0ope mfctysfa um( p u0 rxnxo3tytop rln i;t0s2um(r3nydaptn ictltfs2tr(roou4alxnif3iadfs umuvp;u0aeerif oodlp eaieo (  rxrimpiu4am nmnvtls)arrr(r no0oleoii3iysfaDuau p (0 rtoio3iodlpDeli o s t2um(o io1lpe  nvil(f Dumumooo0aetniieiydlm2elnmpn()aetoir io1faDeli o (  etrio iydlp eliciatf Drruro;u4tpxnmoctlt a rlu snu0tetnmf3oodfmt livsl() 2urxo io4lle lics s)s2rax  nt1alx miciysfmDelnmon() eeoio oatla   iei t0sruoxr3io4oltnlivi ( sDurum ot0alto ieiys m2rmu s;()trtnxf3iytfm  auvilt0t2toim iy1omee ivsat sDtmum no4tetnif3tld mDulump;t4 eenmr3totom eaueol(  rtmxm oy1op  mnct s aDumxmpnu1aexoifciatlmDrlump u)trxnxo ty1fmtrlues t  etoirpnu4ape lneia(  2rax pno0tpx  o3tas s2eln sn(0tltrmrcootfaDe ieo t0srtm(m iy4ll n nvi sf 2rrxmp;t4tltomi3ilt s2eanvs;(0tlenxf3oytop  lueo (0setmxo3nu4lm e fcsas aruaxrpot4oleo ocildla2el(ms;t)trxnmr iytomtr nes s setmio oy4lmenlieias aDtaxr oo0alt  i3iatlm uanvpnu0 etoio3iadoptrlivi;(0s2xmiopny1lmt liviat)srtaur ;o0optnif3ilslm ulums;t4 eeoxrcty1fa r ieilt texoxr3oo4lle mnvia(  2tmxmono1opx ii3iydfmDuauvs;t) leomo oa1latelivi;s)teuoxopnydap  lfeil()s2rm(mpnu4ape  oeiyd a2ra(vp u)alxoxrciadlmtelnvi s) rum(o ou4ll   ncilt)aDrau poo1aptoif3tls s2elu p;t4trxrmo3iydlaDelnes t s2xrxm no4lmen nvi t)aruaxmo;u1opeomfeiasfa2em( pnt)trenir3oa1om rlivsls0s2xr(r3iy4lltelivsa( srtmx  ;o1tpx  feiad s2emnmo;(0 lerio3ootfaDr i il( srumxr3io4amt lneilsf rrr(moot1alt miciydfm umnms t) reoio3oy1omDrlu i s trumim3iydamtemfvia(f Durumpnu4optnmfcildlaDumn onu0artrmfcootfa rlieolt)trur(m io1ap  lncils arumumo;t4tet mo3tat s2um( p (0aetoir3oodla rlieolt  2trxm3ny4lp e nvta( aDurump;t0opxoii3tldlm umn pn(0aetrmfcoatfa eai i;t0 etrio3iudomee nesas)aDta( oou4oexnmocildla rauvpnt0 rtoif iodlaD auvs t) rurir oy4ol emfvi t aDra(rp;o1tlx mo3ilt m2eau p;u)trxrmf3oodlp ean o;( trtmio3nu4lmte netl( a2rm(rpnt0aex  fetatls2rlnvo;t)areomr ty1fmD  neo;( trumiopiodoptelfct t)a2tmxr ;t4oltnii3iatfm ean o (4tetoircoo1omDe nei (  rtrxr3ny1lle mfviltf 2rmxr oo1opx  fctltfm2ea(mo;t)aleomf iytlat aieo ( seumio3nodlmtnmfes sfa2ta(  ;o1apenmoctlsla uanvp;u4 rxnir3iatlp rlneo;(0t2umim3oo1lp emfvt (fa2uauro;u0oexoiociadfm2rln o (4arxomf tadoa  au i;s sexoir3ou1ol  lnet (faDrmu pno0tlt  octyt m2rlnvo;u) lerir3oadlaDr ues;s0t2toxr nudamenlnci t)a2ta(r ;t1tlxo feiydfm2emn ont0texnmociy1fa e neo s srur(mpou1alt lncias s2rm(  ;u0tee moetysfsDrm(vsnt4aexrio3iadfmt anvs;()seur(m nodaptnmnvt t) 2umurp;u4opx  f3iyd aDra(vonu4tlxrmoctytlm eauvsl(0sexm(r oy1op e ivt ()sDuru  oo0texn ocils s emu snu0artniociy1om   ivi;t0t2um(r oy1aptelics tfartaurono1oltn ieiadlmDemumpnu4tetrmfcoy1lptr ueils0 rxmio3iydom nmfvias a2uru  nt0tetomociltfm2rl(mp;t4 lxomo iydfmtrluvolt t2toxo iu4lleelnctls) 2ua(rpou1tet mieiysfm2el(vp u)tetnxoctotlaDeli s;s) 2tr(r ou1ll nmivt tfsrtaxm nt1tpx  ietytfsDrauvo (0aleomr3io1oa rlivs;t trum(mpno4ap nmivtlt)s2ra(rpot0opxnii3iad m umn sn()alxnmrciatfpDrlu s;(  euo(o no1apen ietlt) 2tau p;u0tpx iiciat a uaumpnt4texnmf3to1omtean i;t0trumim3oydop elicilt sruru o;t1opxnio3tat s2raums u) rtnmocoy1fm ranvi t)trxmimpiy4amen ietlsfs2ururo;o1alxoio3iltfaDemumo u0tlerifciotlatr u ol()srtoim io1lptn netasf 2uaxmonu1oltn i3iys a uauvo;u0tlxnmf3oodfate ueols0trtoxrpnodoptnmfcilsfs2tmu ont1tpt ioeiasfaDemu o;u) eenmrcoatlp elieol() rumiopnu1alte fvtl(fsruau oou1oet moeiyt m rluvp;()tetomo3iydoa  lnei;( t2umimpno4opt lnesat)sDumxro;u4oexnifciasfm2raump u) lxnif iatfmDr n slt srxrio3iudamt lfeil(  rumumpno0aexoioetyd a rlumo t4tlerxfcty1faD  nvil( trumir no4omtelfcsls) Dtax  nt0optnmf3tas aDelu s (4tetrmr3iydoaDr ies s truoim nu4lmee ivt sf rrmumpnt1tetoiictad a2emu pnt4texrio oydfm  livs ( srtmirpnydole miesasfsrum(mpnt1tpxo f3ildla2rauvsn(0 rtnio3tatlpteanes;() 2xmim oudomtemivslsf Duaur ot0aexomi3iytlm2em(vsnt0teenxr3io1laDr nvs s) 2xoim3iy4omenlict ()srurxmpot0opxoii3iysfsDrmu s u) rxnif oadopD luei;s0t2trxr3oodom e fctlsfs2urump;o0olx  feiadls emnvs;(4alxomr3iotfmtr ivi (0 2uo(r ou4aptemics (faDumxrp;u1aeeoifetasls ea(vsn(0tlxnir ta1opDelivi;t0tetr(m nu4lptemivilsfa2raur oo1opt  f3iytls2ulumo;u0artomf iytoptr uei t0trtoxo3iy1lleemneta(  rumu oot4tpxomoetatlm2umuvo t4 exnmociadopt ln o;(0teurir3ny4ame mfcs s)s2ta( ooo1olx  o3tysfa emuvs u) lenir3oydfpDeaivs;t  eur(mpnu4ame  icia(farurxmono0optoifciat a el(vpnt)aleoiocoadfaD ln i s0t2xmio oy4olee nvi t)aDtau o;o0tleo feiys sDeanvs u)alenir to1lmDrauvol(0t2xrimpiudape  nvsls  Dtaxroou0olxnmo3ias m rm( p t0 rxoio iytlp e ieo;t)teumimpiodlme  nvilsf Dra(m ;t1aexoiiciydlm2rlu s;u) exrxfcoo1fat lnei t) rtrirpiy1lpenmnviat  Dua(rpot1openio3tysfs2rlump u4 etoio3ia1fpDeauvi s) 2xr(r no1ap emncsat  2um(monu1tle if3ils s rmnmont)arerxf3iadopDe nvsls0 2to(opnydomt lies t s2uaumont4aee  fctasla2ea(von() rermfcoytfm eaieol(  2uoir3iy1ape mnvsl( aDrr(m ot1apenif3tysfm2elnmsnt0 eerifciy1fmDr u s s0setrxo iodol  liei (f ruaur nt4aexnioeiys a ua( s;()aeeoio tydfmtrau s t trumim3oudop e ics s)sDua(mpoo4tpeomfciysfmDum(mp u4alenmr io1laD lneo;s0s2umxo3iy4alt  fci sfaDrmx oou0tpxoioeilsfm um(mo u)areriociytlmDr ues s0t2tmiopiydamte ictat  Durx p;o0ole ii3iys m elumsn()alxomrctodlpDeaivilt) rtrir nu1ome mfetasf rrrx onu1tetn fciadfaDrmumpnt0tlenxo oatlmte ieslt)t2toio3io1olt mfvslt sDtaumont1aex miciydfaDrlnmpn()trtoxocoy1fat lnei t  etm(rpnydolteliei t  rta(mono0tex  fetyt a eaump () rxrxr todfm rluei;() rxm(mpiydapen fet ( arrmumoou0alxoif3ilt m2rau o t0tlxrif3iy1lmDran o;t  euoxo ny4ap emictat srur(mpoo0tpx mociad aDrmu p t4trtrio iadfa  livols s2xo(m3io1alenmivs s)s2rrxro;u4oleomoetatlm2uaumo;u) ltrifcty1oaD anvs;t)t2tr(m oy1omenmfei sfaDrm(mpot4oleniieiytfa umuvon() rtoxr3oytlpDrln i (0 2uoxrpny4lpe  ivsatfa2tmxrpnt4openifctadlaDrm(ms;u4aeeoiociodfaD aieols0s2umxm3iu1op  mfeil()a2ra(  no1aeeniictat m emnvo;()arxoif3ia1lpteaueols t2tm(opiudlptemfetlsfs2taurooo4tlx  feiltfaDemnmp t)teerxr3oodfpD lueo;() 2xr(r3oudapt  icta() Dta( pou4opxoiictldfm2eau pn(0 rxoxf oytomD auei;(0 rtmio3iu1lm  mfeiatfsDua(mpot0aleomi3iydls rmnvp;(0artrmf iotfaD luvsl(0 rxoxmpiu1op e ivtat) rua(m ;o4tpxnmieiydfa rl(mp t) exoxocoy1fpDeli i;t seuo(rpou4om nlnesls s2tmxm oo0teeoifeiad mDea( pnt0 rxnif3todlmD au sls0trtmxo3oy1amt  ivsa() 2ta(  oo0oee  feiytlsDemnms u)trerio3tatfatran i;t)sexm(m3nu1lp nlivsat  Duaxm ;t1oltnio3iadla2elnmo t0trxomo io1oa eluei;(0trtoxr3ny1ame  ieia(fsDum(mpot4olxnifcils aDuln p;() lxoif to1faDe nes;( t2xrim io4altnlietl( sDuaxmo;o4opeo oeiad s ulumsn(4tleniocia1fateanvsls sexrxo nu1lme mfeias sDta(rpnu1tpxnioeiys sDulu pn(4 exnmocoytfpDeanei;()trxoxo iy1lp emiei t)s2rrumono4oltnioetas sDulu o;u4arerir3oydomtr nes;s)s2xrirpou1amtemictasfaDururpnu0tpxn o3ildfm eau onu4teerxfcio1omD  i slt0srxm(o3oo4lm nlfctl()artmxront1tltn feilt mDel(ms;(4aeerxf3oytomDr n s;s0s2tmiopiy1opt  fvi tfsrrmxmoot4tle iietlt a2rln p;u0 eeomocoydomt auvols0t2tr(m3oy4altemnvtas) Dta(rp;u4oltomocilslm uanmp t4arxnxocoadlpteaivs;s0 2umimpny4apt lncias  Dumx  ;u0tlxomi3ilslsDulums u4 lxrio3to1opteli il(0s2toxopiy4apenmivt s artm(r ;u0tltoiictatfm2elu o;t0 reoir oy1oatr n i;t0teuoir iudam elfei t)arurxm no4tpeniociltfm ua(ms (0 eerxrcoa1lmt  uvo s t2umxm ou4optnmnctas artaxmpno1tpx mi3iatfs em( onu4treoifciydop rlneolt t2xrxm iu4optnmnvsa(fa2tmxmpno4tpe ioeildla2ulu o (4 rtoxf io1om rluvolt)trtoxo nydalt  fcsl( aDtr( o;o1apxnmfciad m rmu s;()aexrir oa1lmDelnvo;t srxrio oy1lp n nvt t)arumum nu1olxnmfeiyt a2em( s t0artnifciotlpteaueo t) rumiopny1am nlneta(fs2trxmpnu1oetomi3iyslm2ua(vp;() ltrxo3iytlp  au s;s)trxmxo iy4lpt mictltfsrtax pno1opx ifeiadlsDemnmo ()alenio tatfpDe uvi () 2ur(m nu4lm n netatfa2uaxm ;u0opx mocildfm ulnms t)aleriocoo1lmtrli sls  2uoimpoo4omtnmfeil()srrrxm nt0opxnmociltfa2umn pnt0aeeoxo ta1oateli ilt)s2xmxo oy1am emnvslsfsDtaumonu1optnmfetaslaDel(vpnt4aleoir3oydomt livilt0s2xr(r3no4lm elncta(fsruax  nu1tee  f3iat mDumn p;(4tlermr ty1om raivs t  ruoim oo1aptelncs ( a2urx  no4tetnifciasfs2emumo;t0 rxrifcootfmDrauvol(0 rtoxm iy1am  lncil( srumxrp;t1optnmi3iys m umn o u0texomfciodom r ues;t)trumxo nydaleemiesas) Draum no4alx iieiytfsDemu pnt) rxnmo3oa1oatranvi s  exrxo3ny4olen fvtas arrmxmpnt0optn o3tydfs2umnvs;(0arenmoctytoaD anvilt0setoxopio1omeemiciat)a2ur(r ot0tetnmieiad aDuan o;u) ltnxr3tadlat lnei (0t2to(o oo1lme mfeia(  2ra(rpno1teto ociasfm2ra(vont)tlenmr3ty1oaDelivil(0trtr(mpoydom nmfet sf rrmx poo4apenioetld a rm(vs;() rxoirciadoat aueils0seto(r3oy4lme  fvil(f Dumumpou4tptnif3iysla2ra(mo;t)alerxr ootomD lneils0s2uoxo ny4amenlfvils) 2umum oo1alt  feiydlmDrm( s t0artnxrcoatfmD au s;(0seur(o nu1optn ieiasf Dtrxmo;o0tpxnif3ildls eanvo;(0 lxnmr iadfa eaueols0tetmxopoo1om n nvsat)aDrmxrpno0aleomieilsfa2rauvs t4trenmociy1fmD aivi t  eurxm nydap elfvt s) 2rmxrpnu0ope  ieiydfa2eaumo;u0arxoxf oodom  an i;t) rumir ny1lpt mfciat aDtaum ou0oltomieils s2emu pnu0tetrir3iydfmtelu i s0setrxr3nudop  mnct t) 2tmx p;t4oexnmf3ildfm eauvsnu4arxnmr3ootfmD ln ols) eurio ou4openlncsas)s2tmu  nt1oee  fetysfmDrl(vo;(0tlxoiociydlptrau s () rurxmpoy1optnlfci ()sDuaxm nt4alt mo3iasls2um(vsnu0 eenxr3ootfmDr i i;s  rum(o3iudameelnei sfsDuaumpot4aexnmfcildla ua(mo;u0arxrxo3tadomDe ivs;s)teurxopno1op nlnvi sfaDtau onu0aeeoiieilsfmDeanmo u0aeeoif todomDr uvs s)trtoxmpoy4amenmfvta( srtmxmp;o4aexo o3ildfm elnvs;()arerxf ty1fate ies;s0truoxr iodale lfctl(fa2umur no0oleoiociaslm2umn o t4arerif3io1opDrauvi;s  exo(mpoydam e fviltfa2rm( o;t4apto i3iatfsDeaumo u0 ltoxf3io1fm   uvils  2xrxr3iy4omtemnetl()s2tau pnu0tlxo icild sDua(vp;t4trtrmf todfatranvi;(0 etr(rpoy1ape mfvsasfsDurx o;t1aee mfciatfaDeau o u0 rxrxr3oydla eli ils0t2ur(rpio1lmtnlfctls srrru  no1alx ioctyd sDeauvs;t0trxnmr iotom elu o t0srxmim ny4alte ictatfaDurxm nu0alx  i3tyslmDrlnmp;t4 ltrxrctodopt lneilt tetrxm3iu4ap nlnci (  Dtaxmo;u1ale  octldls uln s t0 lenir3todlpD lnvsls)setmirpny1altemfeslt  2rmu pno4tptoiiciytlsDemnvpnu4arxomo3oydlaDelies t truo(o nu1ape mfvils)aDtr(rooo0teenmf3iytfm2umuvp;u4trxomf iytoaDrai o (0 rtm(m3io1llt mnvils)s2ua(ronu1oexo oetytfs2ulnvsn()trxnxr3iodlat lueolt)s2xr(o ou4omtnliet ( aDtm(r nu1tlt mfcildlsDua( s u4 rxnircoatlm e uvilt0 rumiopoydaleelnei t  2rrxm nt0apeo o3iysls rm(vp;t) reoxr iodfmt  uvil( t2tr(r3ou4lm emies 
\ No newline at end of file
@@ -0,0 +1 @@
+u slt0s2xm(opnydllt mneilsfaDur(m nu1tex mo3tas s2rln pnu)tetrxrcoydoaDe u s s) 2xmxm ny1optemfcslt)aDuaxrpot4tltn o3iyslsDuanvo () lerio oodlmDraueo s0 etr(m iu1lpte ictat)a2rauroou1alxn o3tltfsDel(mo;t4tltnmr iatop rlieo;( t2umxo iudap nmfei ()srra(r nt1opeomfctyslaDemnvpn(4trxoxr3ta1oaD  n o s texoxopio1ol   ictat sDum(r ;t4oltniociys a eauvo u0artrioctadoatr u sl( tetmxo iu1amen fvtat sDtru ooo1aex mfetysls eaums t4 eeomo iodlaDeai o s0 2toim ou1apte fet ( a2tm(rpot4aleo ictadfa ra(vpn(4tlerxf ootfate ies;(0teuoio io1om   fcs t)arrmxmoou1tltnmietydfm2rm(mp;() leoircoo1latrlies t0sruo(r3iodlmee ies t  rraxr ;o0altnio3tas aDra(ms t0 lxoircto1oa rlu olt0seumio ny4lm e fesltf Dtmurpnt1tpe iiciydlmDemn p;u4treoxocto1fptelnvi;t trtmxr3iu4ale mici s a2tau p;t4aeeo i3iatlm rmu o u0tlermo oatoaDrlneo (0trtmxr oydol  mfctlt)artmumooo4tee moeildlm em(mo;()trenir io1omDr i i;t0srxmxrpoy4olt lfcil( srtm(m ou1opeomi3ildfa rlnvon() etrxocoodla  lues s0t2urim3iy4olt mnvt (fs2umu p;o0oee mociasfa eanvs t4trtnio3tytlaD aieolt0t2tr(r3oo4olte nvia(fa2rrumpno0tlt  oeiasfm2eanmsnt)arxomfcoy1lmDr ueols) 2xo(o3nu4altn nct s)srrrx  oo0tltn feiysla ran p u4trenircoa1optr i sl( teur(mpou1lpenmivtas)s2rmx  ;o0apenmietldls2rluvo u4tltnxf3oa1fp eli o;t) etoio3oy4lpe mfvtatfsrtrxm ;u0tetnmiciltfa ra(mo t4 etnxrctatomD  i s () eurxm oudop   feia(fa2trxr nt1aexomoctldfa ulnmsn(4treoif3ootfa rlnvol()s2uoxm3nudlp nlivslt)sDta( p;u4altn o3iadls ulnvp u4trtrmf3iydlmteln i s0srum(opiy1lpe mfvtatfarrr(rpnu4apxo oetasls2umumsnu4aleomr tytoatraneil(0texmxmpiy1lltelfctlsf 2tauro;t1apen f3iyd mDelums t0 exrxo tatlm  auesl( srtm(m3iu1lpe  ncsasfsrtmurpno4tlt io3iyd sDul(ms;()trxrif ia1fmDelneo;s) 2xriopnu1ape livt (faDrrump;t1aeto i3tat m2emu s;t) etnxo3oadfptran o s) etmxr iy4ol nmfvi s) 2uru onu4apxo ociltfsDeanvpnt0tltrircoytomtelnvs;t0t2tmxm nu1openlivsltfs2rmum ot4apen o3tyt s2umuvp u4altnifcio1fmD  neo;t0s2toxopoodlm  lneilt)aDtmu pou4oetnmoeiytla2ranmsn(0aexnxr todlp r ivs t s2xm(r3nu1lmenmnvta(f Dtau ont1aptnif3iatlmDrl( p;()arxrxr3tatopDr u i;t0trxo(mpio1am  lieslsfsDumumo;u0opx  i3tydlsDel(mp u)arenxr3tydfat  uvo;t)truo(mpoodlp e nvs (  Dtmxmoou4opto f3iatlaDean pnu4 lxoxo oy1lpDranei;t)srtmxopnu4alte ietas  Drrxr oo1tlx moeilslm2emuvs;u4 exrxr3io1lm elu o;( tetoxmpoy4llt  ncsasfa2tru onu1olxnmictlslsDranmsnu4tlxoir ty1om r i s;( teto(mpoudll   ivta( sDumu ooo1aet iieiasfa eln o;(0 ltoxf3tydoa rlueo t)s2xmxrpnu4lptnmfvilt) rurumoou4tlxomoeiaslm rl(ms;t4alxoxr3io1lmDrlivils)teuo(m iu4llt mictlt aDtrx  ;t0oetnmoeiasls2umnvsnu0alxnif3iadfpDeai s;t0seum(o ou4lmtelfesls)sDrrxroou4tetoif3tydls eln pnt0trenmoctadoa   ues;s) euoxo iudll n fei () 2ra(m nt4oltoifciytlaDrlumonu) reomr iotlmteau il( teum(m oo4ameemnvtat)s2rruro;t0ole mo3ildfa2ea(monu)trenioctydoptr i i;s) rxoxm3no4apee ieia(f 2rau  nu4apen o3iltlsDem(von()tltrif oadfptr i i t0t2xrxo ny1lpe mnes t srtru onu4oet io3iat a emu s u4 exnxfctatlmteln o;(  rtr(m oydalee ictl(fs2tau  ot0apxnmi3iydla2uanvp u)artomr io1fa eauei s0t2trxo oy4om elfcilsf Dtr(mono1texoioetydfaDumuvo;u)arxnif oydomt aivslt s2tmim3io4aleemfctls)s2tm(mo;u1aexn oetatfs uln o;t0tleoxrcoytla rluvsls0s2tmxmpnodapt  ncs t aDtru  ;u0oex  f3ilsls rlnvs (0alxrxf3ty1fpD aieilt0 exoxr3iy1op  livt tfaDtrxrp;u1alt ii3iydlsDemu on(0alxrir totfa elnvo ( t2ur(o3no1omeemivtls  Drmuronu4texnmictas aDeanvs t4aexniocoytop rli s;s setmxo oo1olen neias aDtrur no1aex mfcilsls2ul(mpnt) etoxfciodopDelueo t0t2ur(m3ou1ope lnctls arumxmp;u1aetomo3iydla2eau s ()aexoircoatopteai i;(0 2xrimpoodlm e ieil(fs2tr(r ;t1opt mictls sDeanms u)arenio3iadlp eln slt)tetmim ny4alenmnci ()sDrmxr no4tetomi3ilt a rm(vpn() exrxo3oydlp ran sls0 rtr(m3no1olenmnvsls) rraxr ou4aptn ocias m2uau p;u0tltoio3ta1lpDr nei;t)srtm(r3ou4llenlnetasfsDtru o;t4aleo ociys sDelu p;t)aexomfcto1om  ai s;t0setmxopoy4ope lnvs (f Durumpoo1oexnii3iyt a ul(vpnt0teeriociytfmt aiei;(0trxrirpoudom elncslt)srrmxmp;t0tpt ifeildlmDem(mpnt) rtnif3iadlpteaieo s)s2tm(r nudlm   nesl(fa2raxmp;u1tleoifcils sDrauvs u4altoxfcoadlaDrai o;() rtoio3oodlpen ncs (farrm(mo;u1aex mf3tyt sDra( o (4aetoio3oatfatr ieo;s)trtmxo3io4om emncsa(farurx ooo4opxnmi3tyd sDem( s;(4alxomocoy1lmt lnei t) rumio ou1lm  mfvs () 2trx  ;u4alxnmieiydla2rmnmsnt)texrxo3tydoatr i o;()texo(r3iy4om e fvtat  Dtau  oo0alxoio3tatfm umn pnt4texnxr oadfpDeanvs ()setoxmpoodal n fctas)a2rru  ot1alxnmieiyslm elnvpn() eeniocia1faD aivo;( t2uoir3ou1opeelnvt tfsDumur nt0ole mi3iys s em( o u) eenxo3iatoa r ivo ()teurxmpio4lmtn ivt ( srta(r oo4tpx mictltfa rauvp;u4aeenmr totop e uvi;s srtriopnu4opt lfes s) 2umur ot4aexoiiciytlsDelnvs;t) rtniociadfm r n i;t  2toxr iy4omtnliei t)srrrxront0aleoiictydlmDulnvp t)trenir tatomD auei;t0 rxrxo3ou4om n fcsas srrrxm ;o1tet mf3iydlm ran snu0teeomr3oa1fmtelu i ()trxmxopnydam emivsls a2umuroou4tpxomfcias m em( p t) etnxr3oydoptrauvo;t0 eurir nydomt lneiltfaDum(  ou1tet moeiydfmDumumsnu4tlxrmo3oo1lmtrai i;s)s2uoir3oy4apte nvil(  Dtrxmont1altoio3iltlsDul(mo;()tetomr3oa1lp rlu s s)s2trxmpno1aptnlnciatf Durur ou0aet mi3iydlmDeluvp (0teermo3iotfp e n o s)texo(r3oy1lltnlivsat  Duaxm no1tltomieiadfmDem( s t4 eerif oodoa  lieils  etr(mpnu1amt  ivias)s2uau pno1tex ii3iatfm2ranvp u0arxoio3tytomtean o ( trtmim oy1am n fei t  2trurpoo1tptoifciydfm um( snu0alxnxrcoy1opte uvils)s2xoxo nu4amt mneiat) 2uaxrooo0apx mieilsfs2ra(vsnt4altrmr tatla e n o () rto(rpnu1lm n fctas)aDtr( pnt1ale moeiytls2raump t4 exnxr oo1op eaueil() 2xo(r3nu4op elieslt)a2trxro;o1aexo ieild m2uanvsnu0 lxrircoo1omtrlnei s) 2xr(r iydll  mfvta(farum( oot4alt  f3tlsls2rmu p (0tlxnmo oatomtraivo;t)teum(r3nodlmenlnvi s) rurxrono0aetnmoctatla2umnvo (4aleomrctodop r ieilt)srumir3oo1ame mnesa()arua( pot1oleomi3iytfsDrm( snu4 rtoif3oa1fmDe i i;t srxoxo3ny4ome  ncils)artmumpnu0oleoiietltls uluvsnu)artnmo3todfpt lues;t)texrxo oo4ll  lfctl(fs2tmumpoo1olxnmi3iyd sDuan s (4tlxrmo ootlmD  nvsls)t2uoxr3iy4ol nmnetl(  Dum( p;u4ale mi3ils m2ean p;(4altnmr iydlpDr u i;(  etoim3oo4lm nlictl( artm(  ;o4olxo o3tad s rau o ()trxnif ty1fmDr ueo;()trurxm iodlm   nct (  2rau pnt1olxn oeiltfa2ra(vp;u)arenxo3iodomD  ivs;s0texrirpou4altemnci t  2taxrpnu0tetoif3ils aDeluvonu)aetnifcoa1fp  lues s srtmxopnu1ol e iesl( aDua( pou4tetnmoctaslaDem(ms t)tltnio ta1late u i;t0texmxopnu1op  lfeilsfarur( ooo0aexo i3tas a rmnvs;u0arxnmo totopteai il( s2uoxo ny4omee iesasf Dum(mo;u4olxnio3tasfm2rmnmsn(4tlxnif3oy1fatr u o;t  exrim ny1ameelfvslsf Dum(  oo4olxoifcilsfmDran o;t0tetoio oy1laDrlivs (  exr(rpiu1op emnvs s a2umump;u1alt  f3ias m ul(mo u4 ltomo tadlpD li i s sexoim3oydlm n fei (fs2rm(mpoo4aptomi3ilsfsDel(vo u0aexnir oo1opDranes;( trumio3oodam emncsls s2rmu pnu4tlx if3ias mDul(ms ()trenio3io1late nvi t)setr(opnu1apeemfctl()srurx p;o0aetoif3tad s rl( s;u0 etrmf3oatlaDeauvils0t2uoir iu1olenlictls sDtmxm ;o1oleoii3ils a uaumsn() rxrmocoo1lp eluvs s) rum(rpiu1ap  micias)srrrxrp;o4tpt iieiasfsDem(vpnu) rtnmo3oodfp r nvilt0 2um(opny4omt mivsltf rtrx p;u4tltnmo3iaslsDranvsn(4artrio3tydlmt anvo;(0tetmiopoo4al nmfetltf rraxrooo1apxoifcild a ulu p t4arxoxr iadla e uvi;s) ruo(o3iodll emneil( a2trx  ;o1olt  o3ildfaDum(ms;()artomf3ty1lp rauvsls)setmio iy1omt mnvtl(  2uaxro;t1tee ifciltls2elu sn(0trtrmoctydoa e neols) rtoxm3iodlmt lfvt tfs2ur(r oo4ape mictlt m2el(vp;u)teenxf io1omt livolt0 2toir3ny4opeemivi sfa2ur(moot0olxnmiciydfsDranmo u) exrxr3oodlaDeaivs;s  2trir3no1apenlnesl()artmu  ;u0alxniieiyd a raumpnt0 lxoir3oytfp rliei () 2tmio iu1llenlnvias)srta(mpot4oltomf3iydfm rmn o (0texnxo3iatlmDr neo;()trto(r3iudolt  ivsa()arurx oou0apenmfeiys mDelumpn(4teermo3todlaDrlnvsl(0tetrxrpoudlmee nctlsfa2uaxrpno1tpe mi3ild sDrmn pnu0arxrif oadfm rluvs;t  rxo(mpoo1op n fetlsfaDur(m oo0tpt mo3ilt a2umnvsnt0tleoxf3ta1op r ues s texmxr ou4ll n nvias)sDtrxr ou0tle mfciysls ul(mp;t)arxrmr oatfmDrli i;s t2xoxm iu1ame lics tfa2rmxmont0ope ioeildfmDuaumo;(0tetoxo iodomtraivo;s0s2trio iy4ame lfcsl(fa2rr(mpno0aexomociyt mDrln p;u4artnmr todlateluvo;s0 rumim3iy1llenmnvsls aruru o;u1oee iiciasfm rmuvonu0trxnmf3iy1fpDrlneo;t tetr(m3iudlmt lnctl( aDuaxm nt0apt iictltlm2rl( p;u4 lenxrcty1fp  ai ols0t2ur(opio1lp  mfcta(fsDumxronu1alxoiociysfm umnvo u)trtnxo3oydfmt anei;s  2toio3io1lptelies t  2ta(r nu1tpeomfciyt m2ua( pn(4teeomociadfm ean ols seumim3nu4amt mietltfs2umxm ;o0olto iciasfsDelnvo t0 rxoxo iotla elivs () rur(opoo4ameelnvtlsfsDurum nu0opeoifeildls2eanmp;u0 exrmo3ta1lp rlueil() 2toxm iy1lpte ncsl(f 2ur( p;o4aexnmieiltlm emnvs;()trerio3iadlmDrauvs () 2tm(r3oo1om nmivta() 2rru ont0texomfciaslm eluvs u) etnmo3iy1fmDrau sl(0sruo(r3ny4ol   nvtl()srua(roou4tptomociyslsDuau o;u0tleoifciydlm r n i ()s2to(m3iodom nlnvi tfsDtr(roou4oexomieiysls2rmnvo u4arxomf iydfmte nvsls teurxr no1optelfeslt arur(r ;o4aex  ieils a2elnvo;()artnio io1opt lnvs t)s2umxm oodomee nvs () 2urxmpnt4teenmociytla elnvpnt)tlenif ty1fa raivi;t0sexmxrpou4omte ncilsfs2raxrp;u4apx mo3iltls uanms (0trxoio oytlaDrli i;t0sexmxo3ou4amen fet s)aDtaumonu4ale  f3ildfsDra( snu) renxociodopt lues;() 2tmim3oy1opee nvil(f 2rmu pno1tlx  ieild s emu ont0altnif3ty1opDrliei (0 euoir3nu1opeemfetls  Dur(mo;o4tpeo iciatlaDum(vpnu0tlxniociadop r ueo ( trxoio3oo4al nlietlt s2urx o;t1apxn ietysls2em(mo;t0 lxomf3iadla r ivo s) etoxopnodomt mnvils sDtm(rpnu4oexomfeiaslm umu sn(0 exrxr3oytop eauvols tetmxr nu4omtn icsls)sDrm(rpnu0oeeo fetyt sDumnvsnt4 ltoircoadla  ai o s) rumio no4ap  lfvslt) 2tmumonu1teenmociatfs2um( p;u)trtoio tatlatraieol( t2xoim oudopenmfesatfa2rruroot0olxomicildlmDua(vp t)aleomo ty1oat  u o;s)sruoxm nydomtnmfesatf Dtru  ;t1opxn f3iadfs ul(mo;t)tlerif3ta1lat au s t  euo(m3iy4alte ies t  Duaum no0tpeoif3tydlaDrl(msnu0 ltoxo3totlmD  ivo;s0srurimpno1apee fvi (  Drm(rp;t4aexomo3iatla uau s t4 ltoxfctodfp rln i s)t2xoio3nydapee ivslsf 2urx pot0olxomi3ildfmDem(ms;(0trxnmo oadfat li i s) ruoxm3nu4altnmfetls  Durx  ot1tlx  oetadfsDelnmsnu)trerirciadlp  lieilt srxrxr3iu1ol emfet (fsruauroou0tee mfeiydfs rm(msn(0artomf3ty1omt lneo s0 exmir3iu1openmfet s arur(ro;t1texomfciydfa um(msn(0trxnir3ty1fptr i o ( t2umirpoodlmt lfvsas)s2um(mp;u1tpx  iciytlm2elnvo (0 exoxr totlatrlnei s  euoxmpnu4lp  lfesl(  Dtrum oo1tptniictasla um( snu4trenxrctotlmtelnvi t0sexo(opoo1apeemneia(faDumxm ot0alxn fciytlm2em( snu0 rtrmrcoy1lpteanes (0t2xmxrpnu4lptnmfcslt) Dra(r ;t4opt mictatfsDean sn() lerxr ia1oaDeanei;t t2xrxo io1lp nlnet sf rum(rooo4aleomoetyt sDul( onu4alenxrcoy1lmtrlivs;t trtoirpnudlmenmieslsf 2ua(moot0tlxoiiciasla rmuvo t)arerxf oadfmt  uvo;(0t2tr(mpoo4al emfvsltfs2urxm ot4olx mo3tatfm2uanvsnt)aetomo oa1fmDe uesl(  exrxopio1lpeelicsl( srrmump;u1tex moeiysla2eluvp;(4tlxrmr iydfaDraues s  euoir3no1lp nmivi t) rum(mont0alxomi3iatfa2umums (4teeomf3oo1fa e u sl(  2uo(opnodop emictat) 2urxronu1apxo octydlm2ulu p;t4tltoiociadlm elieo t0srxm(r3ny1op nliei t  2tmurp;t4tpxo iciysls2elump;t)teeniocoatfpt  u ols0s2umxm nu4al   iciat artmu  ;o0tptnio3iytfaDem(mpn(0 exrmo iadoptrliei;(0s2xrxm ny4ll  licsl(  Dtrxro;o1oetnifeiysfaDumu p t0aexrircootfmDran s (0texm(r3oo1lme  ncslt) rur(ro;o1aptoifciltfa rmnvs (0aetrxr3iadoaDr nvilt srurxm3iydopenlfeiatf rtmuronu4aptnmo3iad s uaumpnu4alenif3iotfaD li ol()t2to(o3ny1apeemfvia(faDrm(mono4tpto feiatlmDumuvp u) rxnmocoa1lpDrauei;()sexm(o io4lpt mieta( s2ua(m ;t0tptnmo3taslm2emu on(0 lxrio3iodlaDrlies (  2xrxm3iu1lm e iciasfs2uaur ot4tptniieiltfmDrluvo;t)altrxrciy1fmD  i o;(0teumxo3oo4amtnlfciat artax p;u1opeomf3tas m eanvp;() ltnxrctadfm  aiei (  ruoxo nodalt mnet s)srraxm oo4tpenmo3tatfm rlu pn(0 etrifcoa1lateanes ()seuoirpoo1lp elnvsa() rum( o;o4ale iietas a umn pnt4 renif3iytoatraneilt0 eto(r nodapee nvtatfaDua(ro;u0aleoifeiytls2rm(mo u4artomo iatom  lu s;s)srtoir3nu4openmietl(fsDraurpnt0teenmictatfm2uluvs;(4 rtoiociydomDrau i;s seumio no4lltnmfei t  rrr(mo;o0tetnmo3tldlm uan pn(0 rtrxr3iydlaDranvo;s trur(m3iy1am  micsas) rua(rpoo1olxo feiytlm em( p;t0aetnif iodfmDrau s;s t2ur(o iydam   ivsas  Duaxrooo0aexomiciyt a ranmo t4 eenifciy1lp   iei t trxoxo3iu4alen ictl(  rur(ro;u0aeeniictytla rlnmp;u)aetrmr3oodfatr n i;s0trtrxo ny4ol nmfct () Dtr(mono0tpx ii3iydfa2um( p ()teenmf iodlpt an o;t trtrxm3io4ap e iesl()s2taxmp;u0tpeoifetatls elu on()tltnio oo1lp e neil(  etm(opoodop   nei t)a2rmxm no1aptoifeiasls2ulump ()arxrif3iatopD lnes;s  rumir oudomt  fcias aDua( p;o1tpx mociat sDumumon() etomo tydom e i s;t)texm(rpnydll nlivslt)aDrau pou4oetoifeild a2elu o u)tlxoxr3iatoa elues;t0trtrxm3iudop  lfvils)s2rau  nu0tltnioetatls uluvp (0tleomo3iotfp   nvi;s)trxoxr3iudale mfvtlt sDuau  ou1tptomf3ilsfm um( p ()aexnmr io1op  au ol(0tetoxm ny1ope  netltfaDrm(mo;o0oexnioetatlm em(vo u4artnxoctodlmtr i i s)srxriopou4open nvtat)s2urxro;u4oltoifciyslsDra(vs;u4alenmr oo1lmD au s;()trtoio3nu1ape mfvtltf rtm(m ;u1opxn o3tlsls em(vpn()tleoircoa1lm rauei;t0sexo(opoy1ol emnctatfsDraxro;t1tpe  ieias m rmnmon(0texrxr3to1fate ivil() exmirpiydap emieta() Dta( ont0apxn oetldfa2uluvs t4tleoio ia1lptraneolt seurxrpnodlmeelivsl()srtmuro;u1aexnioetldfa rln s (0 rtrmf ta1fptelivi;s0srxo(m3oo4lp eliei s srtmx  oo0aexomfctydlm umump (0 eeoif tadfp elivo;s  2tmim3iy1lmt lfvs ( arum(rooo1opxnmfeiad a2ean pnu0alxoircio1lm  li i;s0s2tmxm3iydlpee icsls) Dumxm nu1oexoioctlsfs2ua( p t)teenmrciydfatelneo;( s2umxrpou1olee nctas) Dta( onu0ole mo3iyd s umnmo u4tltnxo ty1fmteaueol(  rtrirpnu4lp emncia()s2rr(root1olto ociysfa um( p;(0teenxr iatfaD  n s;t0 2xoirpoo1om elnei s aDraurooo1olt  oeilt aDel( o (0 rermo3iydoa rlnesls s2to(r oydam elfviat)srurum ot0aexo iciyslm2rmn sn()tetoxo oadoaDe nesl() 2toimpno4ole  nvilt a2rru  ou1apenmfeiadfaDul(vs;t4aeeoxr3oadfpDeluvil() exo(r3oo4omt  fct s) Drr(ro;t1aetnmocilslaDrlu pn() lxoxf3oatoate i s s0teumir nydapeelnesa()aruau  ;o1altoioeilt aDel(monu0texomr3tydoaDrli s;() 2umxrpiy1lmt lnctls srurum oo1olt  f3tas s uln snt4 etnifcoatom rlnvilt0 etmim3oy1lpen fcs t aDrrxrpnt0olxomo3taslsDeanmo;u0texrir3io1faDr u ilt0trto(m3nu4lpte ivils a2ur(mp;u0optomf3iysfm elnvp t0tetnmfcoatomtr uvi t t2trim3iu1aptnmicta(fa2um(r ;u0tptnifeiltls2ul( o;u)alxrxo ootlatr ueils t2xm(m3nodopen ncs t  Dur( pou1altoiieiytls2rl( o;t)arerif oatlpDeaivi;s) 2xo(rpiu4ole mneils  Dtau  ;o0tlen oeiys a2ean on(0 exomo3io1opDr ues s  ruoxm3iudapte fvi ( a2ua(ro;t1tpt iictyt s2el( o;u4trxrmocoytfp eaneo s) etrxrpnu4ome mfetasf 2ra(r ;o0oexnioeiltfaDua( pnu0trerif ia1laD  i slt teto(rpou4lp   ncs tf Dtaumooo4altomfeiasfm2ea(mon(4alermf tatfpD ai i;() etrxr3iu1op nmieias  Dumxmooo4tptn oeiyt a rl(mpn(0arxrif3tytlmtrlies t truoxm nodop   neil()sDumxmont0alt  octytls2uanvs;(4 ltnxr3ta1fp eln ils  ruoirpny1optemfctat arta(m nt1tlenmoeiad s2elu o t0 renmr iytlptrlueils0 etrim nudop  livs s s2tax o;o4ape iieiatlsDrlnms t4alxrmfctotlmDrlivi;t)tetoxo oo4omenmieiatfa2rmxr oo0tpeomfctldfs el(vo;u4texoif to1lmtr nei t t2tmio iudom e fvils)s2tax oou0ole ioetyt s2rmn pn(0arermfcoytoa  au o;s t2urxmpiu4lp n feil( s2raxmpno1tle mociad s rau o;t) exnxfcto1lat  nei;(0srto(rpoodlp n fetl()a2trx o;t0opx moeiytfs2uau s;t0 rxoif3iodom elu sls0 rurio3io4alt lfvt tfs2ta(mpnt4oetnioetldfaDrlu p;(0trerio3tatop   n ils0trurxm3nudam nlivt t a2urxmo;t4tet  i3iaslm elnvsn() exrmo ta1om  lnvi ()truo(rpoy4lpe lnvi ( aDraxro;o0aeenmf3iltfsDrmump (4 rtrif ty1fpDraueils seuo(o oudomenmietls s2uaur ot1tleoifeiadlmDul( s t4 lxnmr iotoptr nei () 2trir3no1alen neiasfaDrau o;t1olx  feildlm2ul(vs;u)trxoir3iy1fa rai i (0 rxmxo oo1opeemnvsltf Dra(r nu0apxnii3ilsfs rmu o (0 eermocoadfm  lueo t t2xoxopno1ll e ncsasfsrurum nt4tlt ifeiydla2elu o (4 lxnxf ty1fmD aneo s0t2xrio nydopt mfesls)srumur ;t4apxomo3tltlm2emnvsnt) eenir tytfm  anes;s)s2tr(mpou1lmtnlfvilsfa2taum oo0opxoiociys s el(mont4 exnmr oydfmD  u o;t s2xr(rpou1lp  livslsf rumx o;o1tet  f3iasfa2eauvpn(0 lxrxo3iodoa rlnvs s)t2umim3ou1lptelies sfsrta( ono4opt mf3tlsfs ua(von()aeeoiocoy1fp  aiei (  ruoxrpiu1opt mietas)a2ra(  ;t1tle mieildla2ulu p;u0trxoxo3iatomteaueols0 etr(rpiy4omeelfvtl(faDua(ront4opx  fetyt sDumnvp;(4tltnif3iadomD liei ( seurim3iodom  lnvi tf Durx  ;u1olenmi3iytls2rluvo (4trxriocoytoptelues t teuo(o3oodlm emicsa()a2um( p;u0aexnioeils m2ea(vp ()tlenxo oa1fm r n il()srum(o3no1ll   fvil()s2ur(r ;t0tpen i3tlt sDumnms (4tlerir totom eanvi;s  2xm(o3oudlmen nesa(fsDtmuroot1opt  i3ilsfm rmnvo;u)trerif3tadlate ieo t)s2xrxr3iu4ap e iei sf 2ta(m nu0oexniietldfa2uln s;u0 ltoxr3oadlpD au i;t truoio3oydopt lncsls sDua(r ot1aeeoifeiyd aDra(mp;t0 renmo oo1fmtr ueo;s)trur(m3io1lptelnvt t) Dtrumo;t0teeomietad m ranms t4teenmr oytlm rln s t) rxo(o3iudll emfvsa()s2ra(  ou4apenmieias m2uluvo;() ltoxociadopD aieo s)s2ur(m ou1altnmivi ( srra(mo;o4oex iicils m umnmonu0aexnmo iatlpt ai i t)s2toxmpno1lltnmfviasfarrau  ou4tle mfciat aDumnvs t) exnio3totfatraieslt  rtrxr3iydop nmneia(f 2um( p;u4olxnio3iad s uluvo t4tltrmo ty1oa e nvsl()trurxm iy1om nlnet ()srurxmp;t1tltn f3tydls raumsn()areoir iotfmDrlu ilt0srumir ou1am   fesasfartau ooo4tlxo o3iatlaDrmnms t4 lxnifcoydomtr ivs;t  rtm(o3oy4lm  mfesa()srurx  nu1tpt  ieiytlmDrl( s;t)tlerxr3to1om  ln il(  2xr(o3oudopeemicsl( srrrx poo4aexo fctld s uln snu4 rtoio iytfmDean s t s2toirpnydom emicsl() Duax pou0tpt  ociad a2rau pnu) eenmr3ta1lpteauesls0texoxo oudomeemneias  rtmxmo;u4tlxnif3iatfmDulnmsn(4trxrxf3tadlmDraivi;t)trxo(mpio4olen fcsas a2uru  no1oexomfeiadlm2ea(vs;t0trxnir oydlm ranvi (0 2um(r io1lme mnvs (f rrrur nt1ole moeildfaDrlums (0 etoio ootfmtr ieols0 eumim nodlmteliet t  rrrurp;t1ale mi3ildfsDrm(ms u) rermr3tadopt ai o;t)sexmio no1lle  iciat)arrmurpnu4opxn ociyslm ulumo u4 rtrio oadlm   u o t tetm(o3oodlpenlfciat s2rmx o;t0apxoioctys a2uauvo;()treoxo tadomtelnvs;(  2xrir iy4lm nmiet t  2tr( pno0oexoif3iasfa2rl(mpnt4trxriociy1lptelieslt s2trxopiu4lltnmfeias) rrrx p;u1ale ifcils aDelu o;u) etnmr iodoate nei t)s2xmxm3oy4alen nct (  Dtrxro;u0optn i3iltfa2emnmont4tlxomr3ia1fptrli i;(0sexr(mpnu1lpenmicta()sDtmu p;u1tlenmiciydfs rauvon(0 etoircio1oatrluesls)teuo(opnu1aptnlies s  Dtrurp;o0opxn ociyd a rlnvsn()arenxf tytomDrlu ilt s2uo(m oydamee nvsl(  rrm(  oo0tpt  feilsfm ra( p u4tlenircto1lp eai o s)texrio3nu1opeelivsl(faDrmx o;o1tleoiieilsfm elu s;t0 eerir3oa1fmDr nvol(0srtmxr iydlp n nvtatf 2taxroot0aleoifctysls2rmums t) rtnxf3oytopDrauvo () rxo(mpiy1optelieiat) rrrxronu1tpeo f3ilsfa2rmnmp t)aleomf3oa1optr uvi;() rxo(opiu1apt mfeilt)s2rauronu1aeeomoetatlmDrauvsnt0 reoio totomteanes t srxrir ou1open ivt t)s2taurpnt1altniietldfm emump;u4alxrxo ty1la  liei t srxrirpnudlmenlnesa(fa2ua(rono1oltnifctydlmDrmnvo;t)tlxnio3tytlpDe iei;s0srurir no1lptelicsa()s2ua(m no4tpt iieild a ua(mp t4altoifctodfp   uvi t0sexo(m oo1olt lfesat  rraur ;t1opeo iciltls2uanvo;t4 lxomoctodla r uvsls)teto(r3oy1lmte ncsat s2raurp;u1aee ifeiltfm2rl(monu)trtrmo3tatlptrli o;t s2umir3oodapee fci ()sDumur ot0oltoif3tldfm2uan p t0trenmf iodoatr ivs s0teuoxm3nodom   feiltf rrmumpnu4tle moetasfs rln on()tetrmf totlpDeaies;s0srxo(r iodap  mfcsat a2uau o;u1oet  icias mDrmuvs;(4altnxo3oy1latr ivs t s2uoim ny4altnlneiasfs2raurpot0tlx mieils m em(vo;t4 rxoir3ta1lp  au ils) rurxr3oodlmtnmfvi t)aDtru o;u0oet mfcilt m2ulu s;t) rtomr3io1lpDeaivsls)tetoiopiy1lleelfctl(  rrm(r ;o0oee  ociytla emnmpnu0artrmf3tatla e i s;t)s2xoxmpou1amtelfcslsfa2uru  nt1tpxnii3tas s2emnvonu4texoxf ty1opDelieol(0trxrxm3iy4om nlivtls)arraxr nu4tex ifciys mDuan pnu) exnxfctatfmteauvo;(0trur(o oydolt mnetls s2ur(r ;o0olxo oeiysfsDuaums;u4 lxnxr3ty1lp elieil( s2tr(o nu4omte nvilt)sDtmu  no4tltn fctydlaDuauvs ()arxnxo iatopD au ols0 eur(mpnodamt mfvil(fsrur(mono4tet mfeild s uanmon(4aetrir3to1fp r u i;s srxrxr oo4lpeemfeiatfs2urumono4ale mfctad mDuau o t)teeomf oytla  lnvsl()srxm(o3nu4altnlnvtlt sDururp;t0tlxnmieiys s2elu s;t4 exrxo3ta1fm r iei;t0 2tmirpiy4altemivia()aDtm(r ;o4tltoiictlt a ea( o t4 exoxr oo1opt  uvils  etmxmpoydaleelfcilsf rrrxr ;t0tpt  o3tys mDua( s (4texrir3tatla  an sls)t2tr(o io1ll emnvias)arrmx pou4apx io3iadfs eln on(4tltnxo3iodlmDe ivo;t) eumir oodam e net t srrax p;t4apxn f3ild sDra( o;(0 lxnircoadla eanvo t0sexmio3iy4ol emfvilt  2tru pou4tlxnifciatla2rauvp;u)trerif3iydfp e ieo;s s2xmim oo4op  livsat)sDrm(ro;o1apto i3tlsfs2ul(mp;(4arxrir3iadopte i s;t0srto(mpny4al  livi s)srtr(mp;u4tptn o3iltla rmn snu4texrmo3ia1la rlu i s)t2umxrpio4op elfvi s)aDtm( p;u4texomoeiat a emu o;t) eeoxo3oodop e nvs;()s2to(opou4lm   nctasfa2tmum ;o1aeenifciysfm2ra(vsnu4 ltoif3ootoatelnes t trurir nydol elnct ()s2ua(rpnt0tle  oeilslm2rl(vo;u)altrmo3ta1fm eau sls)s2xmimpiu1lleemfet t) Dur(mo;u4apxnioetydla rlumo;u4trermocoodfmt anvi ( sruoim iy4ome  fvtl(  Drrx ooo0tetomoetltfs2ra( pnt4tetrir ootfp rlnei (0t2tmxmpno4lp n neilt)srtau  nt1aeen icias m2uluvpn(0trtoxr3iadfpt lies t)srtrxrpny1lptemicia(  rta(m no1ape mfciytfm2uluvo t0texnifciotlatr i ilt0seumxm ou1lm  lictl()srurumo;u0aptoii3iadfs ulnvo;(4 renifctodfmDeaivi;t seurir3iu1amt mfes s  Dtr(m ;u4apt mieiaslm ul(vpnu0arerir3tatomD lu il()t2umxmpiudaleemivsls)artrurp;u1tlt mietysfa rln pn()arenif oadoatr uvi;(  rxrim3oo4am  mncia() 2ur(  nt0tptn iciysfsDuan pn(0 etnmr3iytfmDrau i;()s2toxopoodoltnliviatf 2taxm no1olxomi3ildla2eauvsnt4tlenmrcia1fatr n i;() 2uoim oo4apen neiltfs2uax p;o1teenmoeiad m umnvsnu0trtnir oy1lmteauvilt) eurim ou4am nmici s  Durxmpot4tet mieildla2rmnms;u) etnmo ootlpD anes;s)s2uo(r io4om n nvsa()aDtmxrpnt0tex ii3tatfs2elnvon()aleomociotomt an s s)srumimpiudap nlnvsasf Dumurpnu1oeeniietldfs2rlu o t) eermf3tatfpD luvsls)s2umim3ny1lltelies ()srur(ro;o4oltn ieild s rmumo t0treoif iadoa  lnei;t  rxrirpiy1ope  fei tfsDumxrpnu1altomieilsfaDraump t0 lenir todfat anei;t0 eumxopiu4om  lnvsa( artm(r nt1ole  ociatlsDuanvpn(0arenxo iy1oa r n i t0srtrxo3iy1oltelfvs s  Dua(mpoo1tpe ifeiltfs2rauvsnt4arxoxf3io1fpDelnvs;()tetoxm3io4ap nlicsltf 2tr( p;o1olto ocias a rlnmp t4aeeoxo iodlp eau i s)s2uoxrpoodal emfeta()arrmum ;u4opt mfciatlm ranms ()tlenmf ootopt aueo;t srxoim3oydaltn netas srtauronu0altnmfciat mDra(vpnu)aetnifctydlaDe uvslt)t2uo(r3nu1al elict s s2uaurp;u0olenio3tad a2rau pnu0 etnmoctatfpDrln ils)s2uo(r oydlm nlfcil(farumxmooo1texomo3iatla2uau s t0aexnxocoa1om  luvi;() etoim3nydome lfvsat) Drrxmo;u4aetnmicilsla2ra( s;t0aexoxfctydoaDrlnvsl() etmim io4ll elnct sf ruau poo4aetoifetlsla ranvs;u0 leoxoctytfaDr i o;t0trxoiopiu1amen fetasfaDur(  oo0opxnifctatlm2rau s u)trtrxfciodfp e ivs;t)s2to(m nu4lle lnviat) Drruro;t4texnifctysfsDumnmo;u)tleoif oytfmtranei t tetmimpoydopte nvsa( s2tmxmpot0aeeoii3iad s2ul(vp t0trtnircoo1fmt au o t)s2urxr iudoleemivias) Dumxrpou4alx  f3tatfsDea( s;t)tleoxocoy1oa rlnvsl(0setoxopiu1ap  lnvi sfs2umu p;o4opxnmf3iys m2rmn p u4 eeomfcootfaDeai i t) etmir3iudlltemnesa(f 2tmu p;o1aeeomfeiatla2umn p;(4 rermocoy1lmte i sl()t2trxr3iudam nmnvtl()sruaumont0aet io3tytlaDrm(mpnu0arerxr3iatfpDran il(0 exoxrpny1llte fes t sDtax ooo4teto i3iytlaDel( o t4trxoxr oodopD lneo (0trxrirpio4oltemies t sDtm(mpou0tpxoif3tasfs2rlnvpn(4 etoxo3oydlmDraies;t0t2xrir iu1am nmicsat  2tm( pnu4ape ioetydlsDulums u4artnxr tadfptrlnvi;t  rto(m3iudllt liviltf Duru ono1opt ifeiadls emu s;t0 lxrmo3to1lptr u s;( s2tmxopou1lltemnvt (fs2umurp;t1aexniociltfm ul(mon() etnxo3oa1lpD  n i;s)seuoxm3iodoptemncs ()a2trx  oo4tetomf3ildlm emnmo;u4tltoxf3oo1lmte i i;s)t2xr(m oo1amtnlietas a2tm(mooo0teeo ietlsla eln o;u4artrif3todlmtelnvo t) rtrir no1optelivtl()s2rrumooo4olen i3iydla umnvo (0tetoif oy1lp r ivs;s texo(r3nodale livil( artru pnu1oex io3tysfs emu sn() lxrmf3to1op rlues;t0sexoxmpiydomenmieiat sDrr(mpnu0oexo feildfa rluvs u4treomf3ty1lmtrau sl(0 rtmxr oo4ll emfetlsfarrrurpno0opxnmf3tlslsDuanmo (0tetriocoo1oa elnes;s0srtoxo iudam e ncsls sDrm(r ;o4tee  f3iyt a2umuvp;t0arenmf3oytomteai s;()srxoxo iodlm e ivsa(  rrm(m ;t1opeo ieiytlm2emnmp (4aexrxocoy1fpDeluvo;s0srtr(r oo4ame mfct (farraxronu1teen oeiadla2elu o;t)trerir tydoaDrlnvils) eurxrpnudameemneta() 2trum nu0texo ieiysla2rl(mo;u4areoxo iytfptrluei s0s2umxo oodopt lncsat sDrru  ot0alenioctyd s rmuvo ()arenio3oydlm e ivo () exmimpoudomte ivils  2rr(moou4oex io3ils s uln p;t4texoxf oadom  lneols0 rtm(m3iudol   iciasfa2uau p;u0alen octadfm2uanmp;t)altnifciydom rauvi s)srtmxm nu4omtemnvta()s2urx ono1opxo f3iad aDeanmpnu0trxoircoy1fmt auvsls) 2uo(r ny4ameemivi t) Drmxrpoo4tlenmoctlt m uanmsnu4aetnxociotoptr ivo;()s2toir3nodlp n ici sf Dur( oot0aex mocilsfa rln s;u4alxrmf tydfp   uvolt texo(opio4omen fvsl()aDrmu p;o0tpxoioeiytla um(ms t)arenir3oatoaDr nvils teuoir iu4llt livi s arrrumpno4tpxo ictyd m eauvpnu4 ltnmf3ty1latr neo ()trur(m ou4ol e fetas) Dumx oot4opeoio3tydfs2rm(vsnu) lerxr3iotopDeaneslt0texoirpnydolt mnesas arrmu pou1oeenmoeiatfa2umuvp t0aeerir3ta1oaD lnvo ()sexoio iy1am elict () 2rmxm ;u0openiieilsls uaump t0tlxnxo3todomtrlivslt srxmxrpou4ope lfvia( srraumoot0oeeniieildlm eluvo u)trxoif3oadom eai s;()sexoxo3oy1llen fci s)s2trumooo0olx mociyt s2eauvs t0 rtoif3oo1lateai sls0t2toirpou4alen icta(f Drr(ro;u1tpeoio3ias s2um(mo;u4 lxrir oytopteluvo t0teuo(r no4omeelncs ()s2tr(m nu1tltoioeiatls ulumon(0 etrxr ta1lmD an i s)trxoim3oo1omenlictas artrurpno0oex mo3tld s2rlu s;u4treoxf tadoat li sls)s2trxm3iy1lm emnctat sDum(m ;u1aetomfciltfsDemn o;u0 exoio3iodlpD lnvils)t2xrxo nu1lme  net s a2rr(rpot0aptoio3iysfs2rmnvsnt)trtrio oo1lpDeaivi;t0s2urirpnu4altelnesl(  rta(mont1alt  oeild s2umnvo u4teerxo oa1fm  aueo;t)sexm(o iodom  lfcs (f Draum ;t4apxn ieilsfaDrlnvs t)alxnxf3iy1laD an ol() eurio3oo4apt lfeslt aDuaxr ;t4tpxnmoctyd a2ean s (0 rxnmo ta1faD  i i t)t2xo(opnu1ope lfetltfa2tm(m ou1tpt mfciad s rm(mont0 etoiocoa1laDeli ils0s2trxo3iodoptnlnci (fa2ra( p;u4oex iocias a2rl(mont)aetoir3iytlatr u i ()sexmxr io4ap  lfeils sDrr(roou0aeen fciat s um( p;t)altomfcoatoa r uvo;(0trtmxo no4lpt mnesl( aruax o;u1altoifciytls2eaump u) leriocty1fa e i slt)t2xr(r oydamt mieslsf 2tmx  ou0tltnioctlsfm2rl(msnu4aexrxrcta1la rluvi;t) etoio io1omeelnvtltf 2ur(ronu4tltnifciltls ean o u0trtnircoa1fptelneo;s t2tmio iy1lpenlnctl(f ruax o;t0opxnmf3iltfsDrm(mo (4aeerxr ty1fmDe nvo;(0srum(r3nu4lle livtl( sDtmum oo1oeto o3iatfmDuauvs u) lerxr3oatlate nes;s  eum(rpoy4olt licils s2um(m nu4open feiatfmDum( pn() lxomf3iatlmtelnei;s)s2xoim iu1ole lfeilsf Dtrumoou0alxnifetatls elnvo u4 eenif3tatom e uvi;t0teumir ou4apt lnvsltfsDtrxro;t0opxn feiydfaDrlnvont4 lerxfcoadlpDe nvs;s t2trxo iu4apt mfeiatf Dua(m nu4aetomieildls emumpnt4tetrxocto1fm raieslt t2ur(mpou4alt  ivtlsfarumum ou1aet mi3tyd mDemuvs u0 etrmf3ty1late ueo t0truoiopoy4lme lnctatf 2uru  no4ale iicilt a emu o;()artnxo oodfat  nvs t seum(m3oudomt mnct ()sDrrur no4ale mietas m ulu onu0 rxnxfcoy1fptrai i s0seuoxo3oydom nliesat)s2rrxmo;u4aex  ieiadfa2ean pn(4aexrmf ty1omDrli i (  rtr(r3io1optemieilsfa2ta(r nt1apeomi3tldfa2elnvp;t0arenxf3todoaDranvslt  rtr(m io4apeemivs t)a2uaxrpnt1aeenmfctytlmDran s u0altrif oa1la  livs t setrio3ny4amt  nvtls artrxm ou1tlen octldfa rl(vpn(0teeniociadoaDrln o ( texrxr oo4omeemfcils)srra(  ou1tetnif3iysfs2umu s;()trtrmo3io1oaD aiesl(  eur(o ny4om nlncsa(f ruaurono0oeenifeiytfaDuaump;(4arermfcto1lat ai il(0t2ur(opnodlp emieils srum(r ou0tlx ifciys a ra(vs;u)aetoifcoatoat  n olt s2xrir3nodalt mnesls a2raxrpnt0openmictat m ranms (0tlxnircoa1omD ln ols)tetm(m no1apt lfet s)srrrurp;u0openmietat m2el( s t4artrxocio1lpte ues;s sexrim3nodol n iviasfsrtaur ou1ope ioetytlaDuluvont4 ltnir iydfm eln s;s0s2trxm ou1ap nmfvt s) ruru pot1ope ifetyt m emums t4 ltnmf oa1laDeau i t0 rxrim3iu4om  mfei (fs2urumooo4aeeoiieiyt m elums;(4arxnxoctotopDe ivsls0 2um(rpoy1oltelfet ( s2urxr ;u4tlx mfctytla2umnmp ()teeoio3todoate n i s s2xrir io1oltnmieslt) rua(m ou4opx mo3iydlaDem(mont0aetoioctodfatrliei;s s2tmio3oy4openlnes s  rua(rp;o4alxomf3iltfm ulnmont4 reoxrcoa1lpDe i slt)t2xo(o ou4ol elivia( srtr(  nt1texnmfctysfm2rlums;t0aeeomr3tatlat aivilt setr(m iudomtnlieia() Dta(mp;t4oltoiieilslmDrl( pnu) ltoir3tydoat ln s t0 2uoxm iodamee fci tfs2ur(moou0olx mociydfmDumn s ()artrxociatlmD  i sls0t2xr(mpnu1llt mnes (  2rm(r ;o1tpx mi3ildfm umu ont) rermfctotfmD  nes;t trtrirpnydop e nvil() Dtmuront0altniociytlmDuau pnt0 eeoxo3tadfpDeluvolt  exmim io4am nmiciltfs2um(r oo1olt mfcild m ulumonu0 exniociadlatrauei;s  2xoxr3no4op  livs t) rurxmono0opx ii3iydlm2elnvs;(0texoir3iodlm eliei ( trtm(m3nudome lfeiatf ruaur ;u4olxnmoeiat s el( o (4alxnxr oodoa  ai i;( t2um(r3oy4am e fvsl(fsDur(  nt4aetoiociltlsDrlnvs t4 etnxf oydlaDe nvo t) exo(m3nydomeemiviatfsrta(rpno1opt io3ilsfaDrl(vp t0tetoirctydomt  ueo (0 2trxr oodoleelfvils a2rau o;o0tpe  ociysfm emnvo;u4artnif oodlaD  ivi s)teuriopny1om  lneta( aDtr(rpnt0alx mf3iat s ea(ms (4tetrxr ty1fptrau i ( trurxm3no4openlfvt tf 2tru  nu4apeoioeiasfmDelu p u0 leomociadla  lnes;s0s2xoxopiodopen ieil()aDtmxm oo0aee iiciytfaDrl( ont0arxnxf3oydop raivs;(0srxrirpno1amtnlfetat s2rm( p;u4ale mfeiyd m2rmumo ()trtoiocoadfa   iesls)srurxm3oy4ome  ncsas)a2tr(root1opxoifctatlsDum(vs t4 lxrxf3iadfatrauvolt)texriopiodolt livs t)s2uax poo4oeto fetldlm ea( onu0trtrxr3ootop rlnvils)setrim iodaptemncs (fartaxmono1olxo oetatlm ulu s;t0arxnir3oo1lpDraieolt srurio3iu4ol  livtlt) 2ra(mpnt1texo octad aDum(vsn(4altrxociy1lpt lnes;t) 2xoxo3oo1oltemnvilt) 2uru  no4apt mocias a2eanmp u4 eerxo3oo1optelnei;()sexmxrpnu4lle  fvtlt)arumu oou1tpenmoctasfs elu p;(0 reoifciadfmDeaneo t) rumio oodole micias) Dtau pou4tptniieiadlm ul( onu0tetomf3tydfm rlues (0tetrim ou1lm n nes t aDrrur ;u1aet mociaslaDulu pn(4tlenmf oy1faDe nvi;( tetm(opio4lp n feta( sDrru onu1opt ii3tyd aDuau s t)aleomr3ty1omD  ueslt  2uoxopou4oleemnciat  rrmx ont1altn oeild s2emnvp (0trxoio3tytom   uvo;s) 2umim nu4lmtemietat arra( onu0apeomfeilsls2elu o;(4artrxocia1oatraueil(0trto(o3ny1lp  liesa(fa2trum ;u4oexnmociltfaDrm(ms;u4 ltnxo oa1fpt  ueols seurim nydol   ivta() Duru ooo0opeomf3iatfs ranmo;u0 rxoir oadoatelieslt t2xrxm ny1opee ictlt)arua(  nt1tlxn ieiys aDeauvs;t4treoio3oadfa   uei;(0t2trio oodlptn fetls s2raump;u0apto f3iys m rlnmsnt4 ltomr3oytlmte ieilt)t2xoxo ny4ape mivia( s2rmur ou0oleomf3iltfs2ea(vs (0 exrmr3oydoate neo ( srxmxm nu4lltelieiat) rtmuront0apxomi3iyt a2uln s;u)texnir iatop r nei s  etr(rpiu4al elics sfa2tmx pot4aetomocildlm2rmump u4trxomf3io1oatraiei s0teuoxrpou4al nlnet s  Duax pnt0alxoii3ils m ra(msnt0trtomr3iytop elivs s0s2uo(m3nudom   icil(f rum(m nt1alenmfeilt mDemnvpnt4aexrxo iotoa  lnvo t) rtrir nodope mivsl( aDurxm ;t1tpxnmfeildlm umn on(4 eeomr tydfmDr nvol(  exrxm no4omtemivi () 2ta(  no4aet mo3tyslaDel(vs;t0 etrio3oytfaDe ies;s0setoxo oodap n fvi sf rtrumpno1aeenmoetyt sDeanmp t)teerif tydoa r ues;(0t2tmxm3oo1llenmnvtl()srumxm no0teeomoeiydlaDean p;()trxnxo oadlp  lneo;t trtrxr3no1om elivs sf Dur(  ot0oeeniiciadfa2ea(mo;t0alermr ootoa rlueol()setrxm3nu4amtn fcia() rrr(  no4aee iieiysfmDuluvp;t0 reoxr oy1lpt anesls texr(m oo4ope miei ( sDtaxrpno4aeto iciydfa2eln p (4teermo ia1fptelueo t)teuoio ou1oleemfci s artrx ono1aleo feiyt mDea(vpnu0 etoir3oytlmt  ues;t0 2trxm3no4lpe  ivs s  2umxmonu0opxomfctldls2rl( p u)trtnxr iydlpDean o t)t2xmxmpnodlp nlnesltf 2tmurpnt0tlxo i3ilsfa2ra( snt) rtrmr ootfat  i s;( seur(m nu4om   fct (f Draumpnu4alen fciytlm rlnvpnu) ltnxr3tytfpDranvs s0 2trxrpnu1ol   fciasf Drrxmp;t1apeo ociysfa uanvpn() rtrxocto1fptr uvil()seuoxopou4optn nvta()artmxrpno1tlxo iciytfa2eauvonu0trtnif3iodfm rauvi;s0sexrxr ou4am elivi tfs2um(roou1tpx moetltfmDranvp;(4tlxnir iydlmteanvs t s2ur(m3nydop elfciat arur(m no1aetomieiysfm emnvsnt0tleomo to1fmD  iei s) rtr(m3oo1opt  ieslsf rurxroot1tle  icilt m2umnmo;(0texoif3iytomt  u slt)s2urirpnu1olte ivi tfsDra(r no1tltomicilsfm2ul(vsnu4trtrxociatoa eli o;t)t2tm(o3iodlmen nci (fsDumx poo0aptoio3tysfaDemu onu)alerxf3iadlmD lneo;()texmim iy4ame lnvia( sruauro;t1tex iieiydfm emu p;t0 ltoircoa1laDr ivo s)truoxopny1omee ictatf Dtmu onu1tpx iieiltls2rlumo u4aeermf iatlmD  uei t  2xm(o nudol  lictls  rumxro;o4tlx  fcilsfmDua( sn(4texoxfcootfaDeaneo;t)trur(mpnu1ol n fcsas)a2raxrpnu1aetomocildfa ea( snu4 rtrmociadla  luvil() euoxopiy1ll   iesl(f rur(mono1apt mietldls2rauvo t0tlerxf iytfp  lnvs s)sexrio ou1omteliviatfsDrru pnu4oeeo o3iyslaDrmnms;(4artnxf3tadlp eluvi s) rurir oydole  nvtlsf rumur nu4tpxomfciadla2el(mo;t)aeenmrciodoaDe uvs;( seuo(r oy4lltnlneta(fa2raxmonu4olx  ictatlm2ea( p;u)aexomrctydom   ivils0 euo(m3ou1llt  iei t)a2rrxr nu0opto icilslaDrauvs () exnif3tatlmt  uei ()srxmxr3iu4ap e nvtls) 2urx  nu1optnifctydfsDelu p u0tetrifcty1om  li i;t0srxmxmpou4lp   fvt tf Dtm(rpnu0aeen oeiytlm2umnvont0 etnir io1opD auvslt sruo(opoy4lp nlfeils sDtm(monu1oeeoif3ils mDrmump;t)aetrmr tydfptr ivi;t0 rurxr iy4omeemnct (  Dtmxmp;t4teeoiieiysfm2eaumsn(4trenir3totop  lues s  2umxo no4op emnctlt  rrr(roou1teenmieilt s2uln s (0 rxnir oydoa rlivs;s)sexm(rpnu4lltnmncils s2tru o;t0olto oeilslm2uanvp u4tlxrmfcoadlp rlies (0s2xmxrpiy1llenmneslt)a2ra(r nt1tlxomo3iysfm2uanmpn()trxrir iydoaD lues ()seuo(o3iodllt mnctl(fs2umx onu1tpeoioeiatfm2ra(mp;()texrxr3totla rau s t  euo(m3iudll e fci s) Dtmxro;o0opt moctldlaDumn o u) rtomf3totfat ai ol(0t2xm(r oy4optnmfesatf rrr(rp;u4apenmf3tat sDum(mo;(0 rxrxrcto1lp e uvs s t2xm(r oudolenmfeil() rurxmpou1olx mfeias s2rm( pnu0trenio tadlpDr uvol(  rur(r nydalte icsat)a2rmxronu1tptomfeiltlm2uaumont4 ltoxr iatfa rlu i (  rxoir io4ll nmnctlt aDumurp;o4apenmf3tyt mDranmp ()aeenmo oo1fateauei t0setrim nodlp e ncsat aDrr(rpot0tlxoif3tadlm2ul(mpn(0arxnifcty1fa e nvo s)teumiopny1amt lfei s)aDur(rpot4oex  ietlslaDuan p;t)aexoxo3ia1fpDeluvslt0seuoxm nudal n ictatf rurur nt0apxnif3ilsfm rmnmp t4aexnxrcoadfa raivo;()t2xo(m3nudale  nvsa(  ruaxrp;o4oeen ietld m elnmo u) lxnir3oodlp raiesl(  2uoxo iy4optn ncs s sDraxroou0aeto oeiytls em(vs (0 lermf3tydfa rlueslt0 2trxr oy1op emfvils aDtax ont1apxn oeiatlaDumnmont0 etrmo tadlmtraies;(0 2xoxm nydal e iesat srraxro;u0ope  ociydfa rmnvont)arerxo3totlp r ieols)s2xoim ny4ome mfcil(fs2uaumpot4texomf3iadlm2el(msnu0 etrmrctytlmteaneo s sexoxo iodale mnci t)sDua(mono0tpxn f3tys s ranmsnu)alxnmr tadom r uvo;t0 exoim oydamt  fcsa( aDtr(m ot1alxn feils a2emu p t)arxrmfcoo1fatr uvi;s)seum(opnodolenlieiat)srtmxro;t1opt  iciaslaDel(ms ()areoxr todfpDr iesls) eumxr nudamtelnvt t) Dra(mo;u1aetoifctasfs2uauvo t4trtnmf iy1fat  nvi s)s2xm(m nu1om e fci sfa2tmur no0alenio3iad s rmu s t4tltoir3tytfat an ol( srtrim iudlptnmfvtltf 2rr(  ;t1tlto f3ilslsDuln s;(0 rxnio3iodlaDrlnvs;( s2xm(mpny1omtemneslt artmu  ou1olxo feiydla2ul( s;()trxoif tydoatranvilt0 2xm(r iu4amt  fvi ( a2uaumont4aeen fetldls uanms;() eeoxr3tadfa e iei;s)seuoxopiu4llen ictlt  2umxmpno1tpx miciyslaDul(ms t) exoxocoy1laD lnes;t sexr(opnydlmenlici sfsDta(  ot4aex ii3ild mDulnmpnu0arxomrctatlatrln s s0srtmimpnu1ap  lnvsa()s2urum nu1olt micias a2rln p;(0tltoxo3oy1lm   nes;() 2xo(mpnudaptnmfvt () Duaxmoou0opto fctaslm2rauvs (4 ltomr ty1opDr ueo;t  etm(r3io1ap  lneiat srurump;t0oltn oetadfm ulnmsnt)tlxomo3iodfpDe ivo;t texoxm oo1amtnlfctlt)arra(ro;o4opt  oetls m ul(vs t4 ltoxf3iatom  anvi;t t2uoxrpnydlm nlietlsfartmur nt4tle  i3iyslmDum(mo;u0trxnifciytoaD au ols0t2urxo nydlptn feilt  2trumpou1tetnmicilt s ul(mp (4 exomf3tadlp  anvols0 rxrim3ny4lp nlfvils) rumxmont1tpeniieilt mDemuvs () lxrir oytoaD lnvs s)teumimpiydaleemfcil( s2rm( o;t1oltn i3iad a2el(ms;() exnxo3iatoaDelivo;t0 2trxopoy1oltemicil()aDurxm ot4oex  i3iltfm ea(msn(0alxomfcoytfat ln s s) 2xrxopny1ap emnvia(fsrur( pou0opt  fctytfm ul( s;(0arenir3oadoateauvo t0 etmxmpiydaleemiciat) 2trxmono4tpenifeilt a elu s;t)aeenxrcoadfmtelu i t0t2tm(r3nodll emfvt (fsDrm(  ;o4optnmieilslmDelnvo;t0artnmf oytopDelnvsls  exmxrpoy4llte icslt srur( ono1tlx mietlsfa2el( p;u0aeeoxo3iadfmte ueslt)srumio3oo1ap   nei sf rrax pnt1ope miciyslaDuau s;()texrxf iatlpDeai o (  rxr(opno1omtn fesls) rra(rpno1tlt miciydlm2ran p u0arenmf tatfpteau s;t) 2uo(mpno4ole lncsl(faDtrxro;u0aex mfcilsfaDem(msnu)aexomocoa1la eaieslt t2tmxm nydopenmivtat a2rmxmoou1opxnmi3ildla ua( snt) rxrmr iy1fmtr ivs ()setoirpiy1op emivs ()a2tm(m ot4ape mietyslm ran o (4tlermr oadfaDe uvo;(0setrir iudlmenlnvils)s2tmur no4tetn ocildls ean s u) exnmociotomDeluvo s  eto(m nudlmt mnvsls) rrmx oot4oeeomictld aDrmumo;u4artoxf3oo1oa rlivo;(  2tr(o3iu4apt lnvt t s2urumpou0opxo ietys a2ranvp (4aetnxr oo1lpteai il(0sexrxrpiodlme  neil(fartrurpnu1tetnio3ias mDuauvo;(0alermfciytomtean olt) 2toxr3iodal elneta()sDrrxr ;o4opxnmo3ilt m2raumo t0altoif io1opD  uei;t0 rtoirpou4olee nesa() Drm(  no1alxnmf3tydla emnms (0tlxoxr todfpD aivi;()tetmxr3nu1ol n fct ( arum(mpoo4alxniieildfmDul(ms;u) leoircia1fpDeluei;t0sexoxopiodamtelnes s)sDtru ono4tex if3iysls2emuvonu0 reoxf oodoatrln i (0texmxr3iu1opte ncta( aDumxront1olto fciasfm2ulnmp u)texrxr3iodoa   n ilt)tetr(r ny4lle  fet sf rrau  ;o1tlenif3ilsfs umn pnt)artoxfctotla  ln i;t0srumim3oo4olt lncsat s2tr(mpot1alxnmocils a2elnmo t0tetoxo tydfmDrai sls) eurxm oudal n nci sfs2rm( onu1alen ieiytfs elu pnu4 exoxf io1oa elu s t)texrim3oydopte nvtas artaur ;u4oltomfetldla rmnvo t0 ltrxo tytoat aneo (0tetrxm oodomt liei t  2ur(  nu1tlenmf3iytfsDul( pn(4artrmr3ta1oaDrlueol()trto(rpoydop nmfvi s aDrrurp;t1apt ii3iat aDrl(vpnt4 ltoxo oydfaD aneilt0s2tmir io1ll  mfei t artmxm nu4oeeoioctyd s um(vp t0areoio3todomte nvi;() euoxm3nydam  lneils)a2rmx  ou4optnmf3ils sDraumsn() lxrxfcoatfa eanvsl() eumxm iu1aptn net s s2tmx o;t4aeen iciydlsDua(vpn(4 eerir3ta1fmt  nes ()setr(m3ou4oltn ncil()s2tm( pou4opt iieiadfm ea( p;u)tlenmr io1opt luvs t) ruoxm3oodol n fct s)srrruroou4oleo fcias a2ea(mo ()trtrif3iy1fmteluvi;( sruoio nu4lpe lfeilt) 2rmu onu0oexoif3iadls rmnmo;(4tlxnmfcootla eaieols0setm(o no4om n fctat aDurxronu1tleomfciyd aDumn p;u0alxrmf iotfa eaiei;()seurir oodlm  mfctat artaumoou0tpe mi3iysfa2ulnvont)aexnmf totlaDeaueo;(  ruo(rpoo1lpt mivslt  Durx oou0aet ifciad mDua( s;t0tlxrmrctodfaDr neo;s  2xmxmpny4lmt  nctls srumxm ou0ole  i3iyd m umn pn(4 rxoxrcoatomtr ivs s  etmxopoy1am nmnet t  rurumooo0alxn ociadfs uln o (0aetnir3iydlat  ivi;s) exrirpiu4am elies (farta(m oo0oee if3ildfaDrl(vp;u0tleoxfciotlaDrai i;s0t2toim3iydoltnmfctl()a2umxrpoo1tlx ifciyslsDumnvp;u0trermr3totlp elies;()srtmxr no4lltelfctlt)arrm(m ;o1opt ioetydlaDrlu s;u4 lxrxo3ia1fptr ieo s tetr(o iudaptn fcsatfs2ur( ont1apeomiciadfsDrmn ont) ltnxf io1lmtelu i;()srum(o3no1alenlfesat s2umxroou1alt  oeilsla rmums;u)tltnmfctydom  an slt0srtoim oo1lm nlneia(  Drr( ooo1tltoio3iltfs2ranvon(4altrxo3oo1fa e ivilt0setoim iy1ap  lfvi s)aDurumont4oltnmoeiltla el( s;u)aexrir oydoaD  u i;t0trtoio iy1lm  liei sfsrua(m ou0tpxnmiciyslm2el( pn()teenxfcoy1oa r ivi;s  2toxm3oodlme lietas a2tr(rp;t0altoioctyd s2ra( s u4arxrmfcta1fa r i s;(0t2xo(r3nu4alt lncsas) 2raxm ot1opto f3iadfaDul(vp;(4arerxo3oytlmtrln i;s)t2uoxopiodope  ncils artmxrp;o0tpxnif3iyt aDulumpn()texnio totlm raneslt sexmxo no4lltnliciat)aDraurpnt0tpx mo3iytls rluvs;(4aexnif oy1fa raueo;t0 rxm(o3ou4al  lnei sfsDtru ont4aexomfeiasfaDemn o u) ltoif3iotom eanes;t0 rum(o nudale mfcsatfsrum(m ;t0tlt io3iltla2emn p;u) rtnif3oodomt  uvils0 2xoxo3iy1om  lfctas aDum(rpno1apt mieias s uanvo;t4trtrio to1fmDeli o t texm(o ny1ap n fvs (f 2ur( oot0oexomf3iat s2em(vpn()texnmfctodlpD ai slt0 rto(o3ou4ol elfcs s)aDrau  nu0tee iiciys a2uluvo;t0 rerxr3oytomtrlu s;t0texoir oo1apte ivi ( aDrr(r nt1tlx moctydfs2emump t0 exomrcoydomDe n o;s)t2xrxo3iu1ll elfcs s srrru ont4tpe iiciyd m emu on(4 rtrxociodfa e ivo;t0t2toimpiodop  lfetltf Dum(  no1opxoif3iasla2emnms;u)trtoif io1lmtrlnvsls0 etr(r oudap nmnctlt  2taxmp;u0olxn oeilsfsDul(mpnu0 renxf iydfpDrluei t) exoxrpnydoptnmnctas)s2umxrp;t0olenmiciad s umums u)altrmf3oo1oatr uvs (0 2tm(rpio1lm  lnvtat) Durx o;o0optn i3tytls rmnvpn(0trxnxrciydfat aieil()sexmimpoudoltn fei tfs2raxr ou1aetn ieildfm2rmuvsn(0texnir todoa eli i;s0trtriopiudale lieil(  Dra( pno1teto fetatfm rl(vp ()aeenif totfaDrlnvi (0tetmio3oo4op emfcsl( srrm(r nu1apt mfeiyslaDulu p u) exrxr tydoa  anvo;s truoir nudoptn icsls a2raurpnu0alxnifeiat mDemump u0teermrciadom eau i (0trtrio oy1am emnvsasf rumx pot1tle ifciad sDua(vo;()trtrxoctydfp rln ol( seurimpny1opee ncilsf rtmx p;t4opxoifcilt aDul(vo t0texoifciadoa raivs;(0srxmim iu4am n feiat  2urxmpnu0aex  iciasls2ulums (4arxomo3iadomt an olt  etrir3no4alenlfvsas aDrmxro;o4ape ioetyt s eauvp () leomr io1oaDelivol(0 rumxm3iy4am n nesltfsrrr(mo;t4ole moeiatfa2el(vp t4aexnxociotop  li o;( s2uo(rpoodlleelnctat  2umxrp;t0ole  o3ildlaDeluvsn(0 lxnmr3ty1faDrli ilt)seumirpny1ope mfcs ( s2uax o;u1tee moctls a um(vo;u0trxomf3oo1lmD ai i;(0trxrxm nodlle mivi ( sDtaurpnt0aetn o3tad sDelnmo;(0arxomf tadomDe uvs;t0sexrim iu1lme mfeta(  rtr(m ;o4aptnif3tlt m2em(mpn(0areoxf oodfaDeaneo t0trxo(m3iu4om  lics s)arrr(ro;t0olxoiocildfs2uluvs;t) eeoioctotomD  ues (0 2xr(opoodaleemnct s sDtmurpou0altn ieilsfm eaums u4tltomoctodopteluvs s0 rur(rpoydlltn ivilt  Durx  ou4ope mf3ils a ua(vp;u) eeoif3oytfat aieolt0t2xoimpnu4oltnmnvil()artm(ront0olt iiciys sDea(vs u4aetriociodlm   iesl(0s2xmxrpoydome lfesa(fa2rmxmpno0tet mi3iyslm2emuvp t0tetomo tytlmt auvo;s srum(r oudope  ivt (f 2taxrono0olt mfciadlaDemu o u) rxrmrciotlat lueol() exrxmpiydllee fcta() ruaxrpoo4oeenmf3iltlmDulnmon(0altomr3oatopD lneils)teuoxr3oy4lmenmneias aDraurpou4tee mf3ilsfs2rlnvsnt)aexomfcio1lm  luesls tetoxopny4omtelfvs s  Drrxr ou4tptnmieils a2eluvonu) eerxo oadfmtrluvi t0srurir3oydaltnlnciltf Draurp;o4oexn fciat m uln on(4aetrxf3iodfaDr u s ()t2trxo nydoptn ivias a2urumo;t0tlenmi3iadla rluvonu)altoio3oodlat li i t  2tr(r oy1omtnmfes (f rrau  nt1opeo fciydfm2ean sn(0tltrmociydla rluvs;(0trumio3iodameemfciat)s2tr(root1ole mfeildfa uln p;t)artrmo tadlpDrlu sl(  2xrim oo4ap nlfesas)srrmurpot0apen ietas m2emnmp t0aexoio oydoatrlu s;t t2toxr ny4op  lfei ( sDtrurp;t0oet  fciyd aDrm(vp u4 etnmo3iytlpteauvi;s)t2toxo3iudoleelivs sfs2tmu pnu0opeomoetldfs rmn s;t4alxrxf iy1fp  an s;s)tetrxmpoodamt  ietl( a2rmx ooo0oetnmoeias aDrmnmpnu0tltomr to1lm  aueol( trtr(opiy1olt licilt sDtrxrpnu1aexnifciytfm rlumo;() exomr3to1laDrlneol(0 2urio3iy1omt  ncsl()s2trum nt4aexnmo3iydfsDul(msnt4 ltnirctydfatrli i;s)setrxm iydole  ivil( aDrm( pno0alxnii3ildlm2rlu p;t) etomfcootfa  ai s;t seuo(r iudop emfeia(  rtrxmpnt1oleomi3iydls2ranvon(4 lerxr oodomD aivo (0 ruoxo iydlpeemivtas sDrr(rpnu1oeeomoetlsla elnmo;(4artrmo3tatla r ivsls)tetoirpny4al  mnvs (  rua(r ot1ole mfetldla2um( pnu0 rxrxr3tytfpt ln i;( trxmim iodamee ivtasf Drax ont0tlenmi3tyd s ra( pnt4 etnif3todfaD au olt  eurirpiy1lp elfeilt sDuru pno1alxnmoeiyd s2el(vp u) ltnmo3iatlateaieils)t2tm(opio4ame lict s  Dta(ro;u4alxo feildlm2rm(ms;u4aexnmr3iotfaDr uvslt0 euoxopiu1op  mncta(  Dtr( oou0tpen i3tadlm emuvs;u0texoxfctodlmD  iei;t)srxrxr3oo4aptemfcta(fs2trum no0tpenmi3ilt m2umnmp u0 rxrmrcootom  livo (0 rtmxr3no1lmte nctls)aruru o;u4tpx ifetysfmDeaums;() etnirciotlm  ai il() etm(rpny1olee iet (fs2trur nt0teeomf3ils m2umnvs (4teenxocoodfmt  u ilt) rur(opny4ape mnesa()arua( o;t1tetoii3iytfaDrlu snt0tlxoirctadla r n s (0truo(opio4ap  lneils srum(moou1tltnio3iydls2elu s;t)alxrxf3iydfpt  ivs;(0 2ur(mpiodapt mfeiatf rumum ;u4oetnifctydls rlumsnt4arxrifcia1lmD  n s;(0 exr(o3oo1lptnmncil()s2rmxmpot4tlxoiiciadls2uanms t4 rerif3ia1oaD  ueslt t2umimpiu4lm  lfcsat)a2rax  ;o1aptnifeiydfm umnvo;t)tltrmo3iydopDelneolt0srurxo iodopenmivsat  2tm( oou1aetniocilsfs rlnmsnu0tlxrif3iytfpDeanvo t0sruoio ou1opte ivsas)s2raxm ;u1opxoif3iadfa2raumsnu4artoxf3iatfmteai o;( tetmio3oo4lmtnlnvt t a2urx  oo4aexo oeiasfmDrlnmo t0teerif iydfm eaueols) 2xr(opoodapt livi tf rurx  oo1aexn ietls sDeln on(0 lermr3oa1fpD  ies;(0trtmirpnudlm   fetls) 2rru  nt4optomi3iat aDelnmon(4 lxniociodlpteln il(  2xm(opnydllte nesls) Duau ono0aptn fciltfaDrauvp u0aetnxf3io1lptranvo;t0srur(r3nu1alt  fes s aDtrx o;u4apxniieilslmDeluvo ()trxnxocta1lptelieols) rtm(r iydlltemfct t  Dtrxro;u4tpe ii3iydla2umnvs;u0trxrmf todfateaieol( trto(mpiu1lpenmfvsa()srurxmpou0aleoiieiasfm rl(mp u0altnmfcoytom e i i s srto(r iu4ale mncsl( aDta(  ;o4oeen f3iyd sDulnvs (4artniocoytlpDr n olt  etrxr3iu1op elncsat)sDum(mp;u0oleomoetytfaDrluvp;(0altoxo3tytlptrlnvsls  2uoir3oo1aptelnesat  2tr( p;t4tptn o3ilt mDemn sn(4alxoioctydlpDelnes s tetmxo3oo4al nmiesl(f Dtmu onu4aleo i3iytfs2elnvonu4 leomf3ta1fat aivo ()srto(m3io1omenlfvilt) 2ua(  no4altoio3ild sDulu onu0trtoxfciotlm  livsls0sexoxo no1llte nci (faruru pou1tex mocild m2umnvp;t)trxrxf oodom rau o;t s2xoir oo1al n fcilt)s2um(rpno0apeo oeiydla2emuvp u0tltnmf tatfmt lnvils s2trxr oy1llt livtatf rrmurp;t1aptn iciydlmDrlnmpnu4aetnxfctydlpDe u s t s2xr(rpoudamenmnvsas)sDurx pno1optnmoeiad s2ra(msnt4 eeomo3iotlaDrluvs t0 2urxmpno4apee fesl(  Drm(mpnt4tex io3iad aDul(mp u)tltrif iatopD  nvsls s2to(rpio1lltemfviat a2urxmpot1apt miciydfmDrmuvp ()altomr3oa1lpD  n ol()truoiopio4lleelfvsltf 2ua(mpnu0altomf3iatlaDeluvs;()arxrxf3oadfaDr neo ( s2uo(m oudoltelfvsas) rtru pno0apeoiietyd aDraums (0tltnxo tydfm  luvi;() rxr(mpoydalt mivtls)a2rmu poo4aptn icilsfa2raumsn(4tetnir3ta1fmDraieil()s2xoirpoy1alt  icsltfsDrax pnt1aetomo3iad m2rmums;(0artnxocoa1faDean sls)sexm(o3no1llee fes (f 2tm(r oo4texnmo3tas m2rl(vs u0 rtomf3oo1oa eai s;s)seumxm3oy1lptnlfct s)aDua(r ;t1tleomieiydlmDul(von(0arermf to1omDeanvs;t0srurim oo4oltnlnvsls aDtaxmp;u0oet  i3tysfsDumnmon(0tlxomr3totlp  luvi;() 2xrirpoo1am elieslt)aDrrx o;o1tltnifctls aDem(msnt0 rxoirciatlaDe n o t)srxoxr oy1altelnctls) Drr( pou0opxn f3tysla2umu onu0alermr ia1lm eln s;t  rurxo3io4al  miesat sDta(ro;u1aet mo3iydfa2rm( p u)aeerxf iodfa  aivi t)srxoiopoo1om nlfesat aDuaxm nt1openmfciad a elump;u) etoio3iy1fp  au i s)sexr(m3oo1lpe licsatf rta( onu4opx io3tltlsDrlnmon(4tlxoxo3todlpt  i o t0teuo(rpiodlpe mnei t srtmu o;u1ape  iciadla2rmuvp;t)aetoio3tydoaDe neols0s2xrxopiy1lltn ncsasf Dtau p;u1olx miciat m2ean o;() ltrif oatop rauvs;()s2toir3iy4ll emfvt t) 2tmurpot4teto feiat aDumumon(0teenxr3tatlatrlneolt  rtmio oydame lncs ()s2rmumono1oexnioctldla ua(vsn(4teenmrcia1fm ranvs t) 2umir ou1omtn ivtl()a2rm( pnu4teeomieiyt m umu p;u)tleomr3totlmDranes;s  rxoim3oudopt  ictatfaDuaxrono4tleoifeiydfaDuanms;() rtrirciadlpt an ols  rxoxo iudale mivsl(f 2tr( ooo1aexnif3iysfm ua(mp u) eenmr3iatoatraues t0 rumxr3ny4om elivs ( arumxr ;u1opxoif3iysls ran onu) rxomo3iadoateln il() etmir3oy4lpe mnes t arrm(root0oexoifciltfm2el(mp;t4teermo3ty1fm rlnei;(0setoxm3iu1llen neslt)s2tm(m nt1tet mo3tldfmDrluvo;(0 lerif3oodlpteln o;t)s2trxm3nu4apen ncta(f 2rr(mo;t0aleo f3iys aDumu s u)tetnxf3tatlptr uvi;s trur(opoy4ameemivtat a2uau ooo4aptn fciltla rmnmpn(4tetnio tydfmDe ueo;(0trto(m3oudol n nctlt)s2tau onu0olxomieiasls2rm(vonu0 exoio3io1oa e ivol() 2xmxm3nu4lmte ivtat  rrmu  ou1tpxo iciltfa uln s;(4arxrmo3tydfmte u i (  rxrxmpio4amt  feslt)srtm(moot1tet io3tlslm2elnmp u4aexrxo3oydlm elnvs;(0seurirpou4ameemiet (f 2urx o;o0opt ifctatfm ul( pnt4arenifcoatlaDeauvi s setrxm nodameemicilt  2rm(rpnu0opx io3ilsfm rlnmp;t0aetnmo io1opDeai s t t2tmxrpou4ome  nvias  2rmxm ;u4tltn o3iadfmDrm( o;t4 ltoxr io1lm e neilt)sexr(opou4lmenmfcslsfsDumu  ;t0oeeoii3iys sDuluvpnu4tlxnxrcia1oat aneo;(0trtr(o3io4om emfvslt)a2umxm ot4tpenmfetyt a ranms t)aetnxocoy1fa r u o;t0 rtrxrpou4llen nci tfa2rm(mooo0alxomoeils sDeanmp;t)tlenmf3ta1latelieo s) eto(opno1omeelfciatf rra(  ;u1oex  oet
\ No newline at end of file
@@ -0,0 +1 @@
+uesls)srurim oo1al elfvi (  2tr(moou0tex mocilslm2eaumsnu4arenmfctadlatraueo (  exoirpiu4apt mfesl(f 2trxm no4teen i3tyt a um(ms;()alxnio totlm elu slt0sexo(o3no4al nmfct tfaDrrumpot0oeeo ociysls2rlu on(0arenio3oo1fp rlnes;t0 exoir3no4alte fei s) ruax  nu0altnifctysfs2um(vo () rtrmf iy1lp e u s t  exr(o3iodole  ici ()s2umxrp;t1aeeomf3ilt mDelu snu4arermrcoy1oa  lueo;t0 rxr(m3oy4alte iviat aDtaxrpnt1altn icildfmDra(vp t0 rtriociodlp rlnvs t0sruoio3iy4lme lfvta() rrm(rpoo4apto i3iysfs el(vonu4tlxnmr iy1la e uvs s0 rtrxr3nudam elivtls aDra(rpou4altomiciaslm2umnvp u) exomo tadomteaueils  rxm(m3oy1openlicsas sDurxr ;u0tpxnmociasfa2eau sn(4 renir3io1lmDrlu i s) 2xo(m3nu4ale  nviat)sDumx o;u1aeenmfetyd m em(ms;u0 leomo ta1omD li s;s)srtmxr ou1ole lfesat) rrmu p;t0aetn iciyslsDra(mo u0alxoxr iytfaDeai o ()srumxopno1ope mneiasfartrum oo0optnio3iatlmDeaumonu0trxrifcoy1lmt  nvsls0 2umir3oo4lmtnlivsat) Duaurpou1oltomictydla elu p;t) rxoifciodfptr n sl( tetoxm nudapeelfcsl(fsDum(m oo0tet mfctytlaDrl(vs u)alxnxo3oodlpt  nei;()trtrxmpou1lp  licsas)srra(mo;u4aleoiieiydfa elu o;u4 ltrmrcootoatranes t srxr(r oydlm elieias)aruaumpnt1ope mf3ias m2ulump;t0alxnxo ta1oaDraivols)trtr(m oy1ap elnesls) 2umuroou4opxo ictydfa elnvp;t) rxrir3oadfmt auvil( texo(r3ny1op nmiesl( a2umurpnt1tpt mfetlsls2rl( onu4 renmr3oodlmte u o;t0trtoim3iy1ap  livsas)a2umx  nu0ole  ieils aDraumpnu0 etrif oadomD ai s;s  rtr(mpiy4lpeelneia( a2uru ono1aeen f3tydfsDuluvp ()aexoir oodom ran s;s  rtoio oy4lme lfvt ( srta(  ot4oex iietatla uaumsn(0arenmo iydlp e i il(  2tr(r3no4lme miei t srrm(  ;o4olenii3tytls um(ms;t4 ltoxo3oodom rlivo;(0trumio no4opt mncta(faDtau pot1oltomoeild m ea( ont4tlxnir3ootomtraivi;t  exoir3nydll nlnei (fsrumur ;t0tlen o3iltfm2rlu s u4aeeomocty1fmt  ueolt0 eurxm3oodlpee fvtl(fs2raumpnu1aee mi3iatfsDuan s;u0 leomr3to1fpt au slt  etoxr3iy1ap nlivtat)aDum( pno1open oetad a ulnmsn(0 eenxfcta1lmDrln s;t) 2xo(o io1am   net tfsDtaurooo0tpto o3tytls2eaumon(0tleoxr iadomDrli sls srtoxrpnodom nmneias)arrr(  nt4texnioctasfs2ulnvp t4 rermrciytfatrlieslt s2xr(r3nydlpee ncs s)a2rrxroot4aptn f3ild sDel(mpn()aexnxr tytopD liei t0 2umxo nydlpenmnciat) Dtm(m ou4opto i3ilsfaDelu onu0 rxnif iatomD an i;t  rtmir oydoltnmfeil(faDum(mp;o0aleomieiytfaDem(mpn() ltnxr iadoat  i ils) rtmxmpou1amt  ies s s2rau pno4oexoifcilsfaDraumonu0aeenmr oo1opt  iei (  2uoxmpnodom elfvi (  2rmx o;o1tet  iciatlm2um(mont4trtnmr totlpte ieo ()setr(r iu1om   ietlt)arraum ;t4teen fetlt s2uauvpn(4texoir tydomt ln o t)truoim3ou1lpeemfvtas sruaxro;t1aptn f3iytls uau o;t0 lxomr iodlpDe uei t srtm(rpnudamee ncsas sDumumo;u0oetnmfetyt a em( pnt0aexnxrcoo1omDrauei t0 2um(m3nydom nlnvs (  Duauronu1opt  ictyt m ra( s u)aetrif3oydlptr u slt0seuoxopoo1om   fcsa()srtmx pnt0tpen f3iasfmDulnms (0arxnio totomDr nvs t)s2ur(r nodlmee fei s srtrur ;t1altnmietadls ulu o;t0 eerir oo1op  anvils)sruoio3ou4llenmncsls)sDrax  ;o0tpxn ieildfa2el( pn(0aeenircty1op r ies t s2xoxmpnu1lp nmfcias) Durxm no4tpen octlt a2rlu o;(4artrmrcto1fp  lu s (0trxrimpiu4optnmfviltf rtax o;t4altomfcilsfaDeanvp t0 rxoio3iotfpt aieo s texmio nu4oltnmfvtat)a2rrum ;o0tet mfciad m2el(msn(0arxnifciodlpteauvolt0 rtmxrpnydlp   nciltfa2ra(mp;o4tlt  fctat s2em(vo;()trtrifcoy1oa   u s (0 eur(r iydlltnliei tf 2rmurpnu4apeoifeils mDuauvp;()aetrio tytom r ues;s seuo(o io1aptnmnctl( aDrru  ou4oexn f3tatla2ulu o u0aeenxociatfpteauvi;t)sexr(r3iudlm   iet tfs2taumoot1texomietls m2eau pnu0arxnirctadoaD  i s s0 2umxo3nodoptemieslsfsDrru ont4olxnio3iad m uln p;(0 lxrxoctotfaDraivsl(0t2xr(m3oy4llt mfvtas) rrauront1texnmi3tltls2raumpn()aeermfcoy1lmDe iei;t t2tr(rpnu4optelnvt s aDumx ont1aptoiieiasfm2emnvsnu)teenio oy1fpDe i ols)s2tmio3oy4lmt lncsltfaDtaurpnu4apxoioeiytlm rm(mp;u0arxnxf iotfmDelies;s0trtr(r3io1olee net tfa2trx ooo1alto i3ild a2rln snu4arerxf totlat li s s)setoxo oy4om elies s s2tauro;o4open feiltfa elu onu4 lxrxf3ty1lmD  neilt0t2umir3ny1altn ics tf 2tru  ;u0opeo f3ild m rln p;u)tetrmf3todfp eluvils0 rtmir oy4oleelies t)a2tr(m ;t4tpt mo3ildfsDeln ont0alxnxo3ta1lpDraieilt0seur(rpoodlme lfci t a2tmu pot0openmi3tatfaDrm( p;(0 rermo3oa1latr uvs t)trtr(r3iu4ol elfetlsfaDua(m oo0opt  ociadls ul(vsnu)tltnmf oatfmD au i t0 2xr(m iodlp n ieils aruaxmoot4tleo i3iasfa umu s t0 lenir iotfaDrli ilt  exm(rpno4openmfeiltfaDumxmpno4tetnii3iadfsDulumpn(4teerxo3iadlm   n s;(  eumxm ou1amte iei t  rrrxmoot0tlxoiictltfm2rln p;u) rtrmo3iydfp elnvs;t) etrxo3no1ome lnctls)a2trump;o1oltnmfeias a2ulnmp;t)aeeomocootfpte n i;(0truoio iu1ll elfesa(f 2uru ont0aexnmfeildlm2ean p;u4 etnmf iadlat  n i t0 rxmio iu1alen icsls)arumu o;u0oeen feiydfsDuln o u) lxoif3iytopDrlivs;s  rur(m3oodlm  mnctas)s2rm( pno0opxo o3ild mDrmumon(0arxoif oa1lmDr ueilt)s2xr(rpny4alte nci sfaDrmu oot0apxnmiciasfaDuau sn(0alenio todfpDeaieols0s2xrir oudol   ivil(f rraumoot0oeto o3iysfa2ulnvo t0tetrmrcoadfpDeau ilt)srto(rpny4lpte net s) rraump;u4tle  f3tytfmDel( o ()alxrmoctotopDr ivs;t)sexoio iu4olenlicsa(f rurx p;o4tpe mi3tad a2umnvp;u4treoir3iotoa e uvi;s)trtmxrpoy1lp n ieiatfsDtrurpnu4alt  i3tadlm2raumpnu4tltnmr3iytlp e uvi;(0srto(m nydal elnct (fa2uaxrpnu1ape ioctytlsDemu onu4texnmo3tytfmDrluvsl()teum(m ny4lp  lfctas)artrxmpoo0apxo ieiytfsDrmnmpn(0 etnmr3ta1la rluei (0seumimpiy1aleelnvil( arurumpnu0oex ii3iasfa um(vont)altoirctodom eaivi (  2xo(m iy1opee nvta( s2rr(r ;t4tlt mo3iyslm rm( s u4 ltrmf totoatrau i t) ruo(m3oy4opee ictlt sruau ont1tpxomiciyt a rauvo;(0tlxrmo to1fp e n s;s0 rtoimpiudom n ncslt  2trurooo0aetomoetls a em(vp t)altrir oytla eauvi;s texmimpoydam  miviltfa2um(mp;u4tet ioctlsfa2umuvo;u0 lxnxr3oo1oat auvo;( tetr(o3ou4llt lfvi s srrauro;u4opeo i3ildla rmuvpn(0tlxrif oatopDrauvolt0s2trxm3oydol  mnctasf rraur no4altoiociat a ra( o;u4 rxrmocoytlmDeauvi s0truoio no1apt mnet ()srtrxmono0teen i3tas m emn o;u0alermfcia1faDrlu ils) rxoiopiy1ape  nvtat) rraxm ;t4tex ioeiltlm2um(vp;(4 rtoxr3oa1fmt an i s0 2toxo no1lp emncia( a2rrx  oo0altnmo3iyslm rluvpn(4 renxrcoydfmt  n ols0truoxm3ny1op  lfetltf Dra(moot0aetomfctls a em( ont0trtomfctatop eau i ( srumir3ny1op n fvtls  rrruroot0apenmoetyd s2ua(vs;u)trenxf tytoptrlues;(  rxmxo3oodol nmnvsl( s2ra(m nt4optn fetysfm elump () exoxo3oatfpDeanvo;s t2trio3oudomtelfvt ( arrau pno1aeeo octydfa2emnmpn(4arxoxo3tytomDe n ilt0setoxr iu1lmt mfci t sDrax poo0teenmieiasfs2rmuvo (4 rtrxr oydfpDeanvs () 2xoxrpiy1al  mncias) 2ur(moot4opxoioetatfa2umn pnu)treoircoodfateaiei;(0s2xoirpoo1oleemicta(fs2urumpnt0tpx  feiyt m2rau p;t)trtomocty1fmteaivslt0 2tr(m3ou1llen fct s) 2rmum nu1aeeomoeiyt m eanmpnu) lermo3iodfmD  u sls)srur(m oodopee fciat)sDuax p;u0tlt  i3ild aDua( s u0 ltrif3ta1omDeanvil(0 exoxr3iy1op   fvsas srtmumonu0opxniieiydlaDeau o;u0 lerxr oo1fm   uvi (0 etmim3iudamtemfesatfa2uru  no1altnii3ilsfa2ulnvsn(0arxnxo iatlptr ueo;t0 eto(opny1lleelfct s)aDrmum oo1olt moeias m ua(vs;(4tltrmr3iadfatranes t texmimpio1omee ivtltfsrtrurpou0ale iietytfs2raumsnt4tltrxr3oydopD auvo ()sruoxrpiu1llenlivils)aDta(mont1aptnif3iadfa2um( s (0 rtrxf ty1omD  nvo t s2tmir3oo1amtn ivs t)a2tau  ot4alx mo3iyt s ulnmp;t)tlxomo3oo1lmDelivilt teuo(r3nudap nlncslsfa2ua( o;t4olt  ietatls2rm(vs;t0aexrmrcootlp  ai i;s) eur(mpnu1amtnlfeslsfaDumx o;u0tpxoio3ilt s2rluvont) leoioctydfmt an sls  exoxr io1llenlfcsat)aDtm(r ot0aet  ieiadlsDrm(ms (4 exrio3ty1opDraueilt trtmxm3oudam  mnviatf 2tmx  no1tlx mfciadlm2uan snt0 lermoctytla rluvs;(0 2xmxm3iydop  lfeil()s2rau  ot1tetnmoeiytfmDrmuvp;()alxomf iy1fpD ai i t0trtrio nudlpee fctasfsDuaxrpot4oltn ieiat aDeauvo;t4arxrir3iatlpD  i i ( trxmxm3nu4lmtelietls  Durumo;u4open ictys m umnvp u4aeeomf3ia1lat aivo (0texrxo3iodlme lnvils sruauro;u0olxnmiciydlsDuluvont)trenir oydoa e ueslt) etoio3oy4lm  mictlt)srtrx o;o0aeenmfciaslmDeanvonu0tetnif ia1opD aneo;(0seto(o3oo4ole  nciat a2umx pnt0altnioeias m2uluvs u0 rtoif iytfpt  ivo;s0tetoxr3oydol nmivs tf ruaumonu1aleomo3iyt mDranvp (4aetnxo3iotlptrauei s srtoio iudopeelnesl(fa2rm(rp;u0oexnifetyt m2rlu s;(4tetrmr3totlat anvo s tetoxmpiodlm e ies (f 2rrxm oo4olxnmi3taslsDuanvo;u0 eermr tatfa eaiei ()sruoxopno4omeelfcilt)a2rr(ro;u1oeeo oetas mDel(von()tetrmo3to1omDraues;t)tetm(m oo4altemivs () rrrx  ;o0tpenmi3iytlsDua( pn() eeoiocio1oa e i i;t s2toxo iu1ol   fvsls) rra(rono4texomictld a2uanvp;t0alenxr3tatlp ranvs t) 2tmxrpno1lpe  nct t a2uau p;o0tlx mf3tydlm elnmo;()aeeomrcto1fa e iei;s texmxr io1altnlietlsf rta(m ot0tlto ociasfaDuln s t)alerxf oy1omt au s;t)seurxo3iudom n nciat a2uru onu1opx iociasfs2uanmo () exnmf3oydfaDe i o t0seumio oy4om emfct (faDraxr nu4oleomoctlsla2rau s (4 rxoxo3oo1oateluvs;s)trur(opiu4lp n ieias) 2rrum ;o1tlt  fetls aDeanmsnt)altrirciytoaD  u ilt) 2xo(r3nodol nmnet s  rumu ono0oltomi3tadfsDrmuvo u0 exnxo3tadfa elu s;s0seumxrpiu1lmenmfesat a2umxm ou0tltnmocilsfs2ua(mo;u4tlxnxr oadfm ean s () 2tm(m iodap emnvsl(  2uaxmoou4optoifciltfs2emums t) leoif3oodoateai i;(0 exr(rpoo1om e ncias)a2rrxm ou1apxnii3iysfaDran on()trerxo todlpD aies s0trumio nu1lmte iei ()sDtmum ;t4aptniiciytfaDem(mp;t0artnmrctydfmDeaneilt) exr(rpoodllt lncta( sruaxroou4opxoiicilsfsDuluvs (4 leomo3io1lpDe i s t)texoxo3iy4ll emncil(f Duau  nu4tlenio3iyslm rmuvpn(4 rxnxf3iodfmD  nvsl( sexmxo3oudamtemncsat srta(m ;t4aet mfcils m2elums u)areoiocia1late nvi;( t2xo(m3iu1omt  feil( s2trxr ;u1oetoiociydla2emu sn(4altnmfctadlm raueilt)trxo(m3io4oltnmneiasfsDtr( p;t1tle moeilsla2rm( snt0trxomociodlat lu o;t0 rtmxo iy4altelfct tf 2taumono1tetn oetlslaDrluvont)texoio oydlp ran s s0t2uo(o ny1llenlicsls  rtax o;t0apt  fctatfs rlu s ()texomfciatom e n s s) 2umiopiydap   iesat  2rrur ot4tex if3iasfs2rau s u) etoxrctydfaD  ivi ( texoxm ou4ap emfvtlt)a2ta(rpno0opx iiciltlm ea(ms t4alenmo3totfm r ueo;t) rtrxr3oo4lm nlfesl(  rra(mp;u4oet  fetlsfa2ua( o;(4 rtoxfctatfm r nvs;()truoxo3oodlpenmfet ( arrrxmpot0oeenmfeiatla2emu p;(4tlxnmo oodomtrlivslt0s2urxmpoo4lp   ivs () Draxr ot1tltoio3iydla rauvon()tetomrciotlmteanes t) exoxr3no4openmncilsf 2umumono1olen o3iltls2emu p t0tetrif tytfaD aivol(0t2tr(rpoudome mfvt (  2rauro;u1apt moeiytfa2rl(vonu0tlxomf3ia1fm rau i t  etoxo nydolte iet (fsrurur ou4ope io3iaslmDumumo;u0aexrir iatlpD aieo s trurio3oo1lleemfvs (fsDur(r ;t1aee  fcias mDrmnvo u0arxnxrcoytfatrluvs s)srtm(opiudoptelnvsas)aDumxmp;u0oleomf3tls s elnmsn()tltrmf3tytop elu ol(  rurxr3iodlle  fvt (f 2rax o;u1tetn i3iysfa rmnms t0arerirctatfmD li i;( seumxopnodame  ivi tfaDuau ono4ope moeias mDuanvp;(4texnirciadoa raivsls) rum(o nydll e nvtlt artm( o;u1tpxnmoeiyslsDrmnvp;u0aleoifctytomt  uvols)trxrxopoo4aptn ncsl(  rtmum nt1opx mf3iatfs rm(vont) leoxr3oodomt lu ol() 2tm(m no4amtnmncilt)s2raumo;o1oetnii3ildfm2um(mo;(4trxrmo3io1laDr nvo;s0teumxo iy4amtnmnctlt arra(mp;u4open o3tldlmDrm(mp t0tltnif totlpt anvils0 eurxo iodlltelnvilt sDrmxmp;u0openiietldfmDumumo t0 rtriociotoa r iesls)srxrxo3oodapen fvtlt)sDrm(ro;o4tlx  iciasfm uau ont0tlxrif ty1oaDr ivolt)t2umxmpiu4openmies t) Dra(  no0opxniociys a2uanvp u0tltoxo ta1fmD auvo;s  rxoxm iydopen ics sfa2ua(ronu4tlt  f3ias m2umnmo u0treomo3ta1lp elivi s0 2tmxo io4omtn fciatfarrrxm ot0tltn fciadfm2emn o;t)altnmf3oytfmtelnvi ( srxm(o oo1lmt mivsasfa2umu  ;u4tlx mi3ilslsDeanvonu)arxrxo3oodlateanvi t0srumxopny1lptn ieiasf Durx oot4tpxo ociytla ea( pnt)tleomf ty1laDeanvilt0 exr(m3ou4apeemnesa(f 2tr(mpou1olxnmfetatlsDeauvo (4alenmf iydoptrlieo s srurxo3iodllt lnvtasfs2taumonu1tptnifciad mDelnvs u0texrxr ia1lmte nei t trxmir no1oleelnctls)s2tr(rpnu0opx mfctasfa2elnmsnt4altoir io1faD  i i (0srtr(opnu4ap  mfct t)a2tmumoou4aeeo i3tls aDeau p;u4 ltrxf ootomtrlneil( srtm(opny1ll emnes s) rrm(m ;o4olt mieiytfmDemumpn(4 eerxr tydfa elivo;( seumxr iy4llte iviasfa2rmum ;o4oexomiciat s um( snu0 rtnio tytlm e ueilt s2tr(m iy1alen fctlsfsrtauroou4aetomociyd s2um( s u) ltrio oytom elueolt) euoir iy1lpe  ncil()srumx pou0tee mfctasla2ean pnt)trxnxo3tytomt auvo s)trurxo3nudol elnei ( sDtm(rpou4tlto ictldfm2eanmpnu)alxrmocia1fp r ies t)t2umio3iudlmtemieta(farumxm ;u4teeo oetyd s rln pn()tetnxr oodlp e uvils)t2uo(mpoudol  livtat)srrau p;o4olenii3ias m em(vp;t0trxoxo tydop eluvo;t tetrxm oy4lmeelnvilsfsrtmum ;o0tlxoifeiydlm eln s;() ltomr tatopDeauei;s0trtm(r3io4ape mneiatf rrr(rp;o0tpxniieild sDeluvs;u) etnmfctytlm e neo;s0 2umir3nu4omeelnetas aDum(rono4texoif3ildla ulnms;() reoxf iytlm  auvols0t2umxmpno1olt mfet () rtrumono0tlxo f3ilsfaDumnmp t0 eenxr3oadlaDrlnvs s t2tmxmpoydllenlivtat)a2trxrono4tetniicils sDeauvonu) rtnxo oo1omDeluvils0s2uo(o nudamen ies () Durx p;u1opxoiiciyd m eaump ()aetomrcoadfpDr ivol() rxr(r3iy1amt mieil()srua(mpou0tleo fcildfaDemnmo (0aexrif todoaDr u il(0 eurimpiodoptn nvsas)s2tr(r nt4apt mieiltfsDranmp t)tltrir tatop rluei;s sruoxo3nu4ame  fesat sDtr(m oo0oexnmf3iytfa uln s;u4arerxfcoytfm e ivo t0 rxrir3oy4lpt lici sf 2umu  nt4tle iieiat a2em(vs (0alxoxr3iatlm eaues ( seumxopno4ap emfcsl(f rur(rpnt4apxn i3tld sDem( p;t)trtoxf oatfm  luvs;s)seuoxo ou1op  mnvs t aDrrum nu4aexn ictld s2rl( s t0arxrxr totomDraivolt)trxo(mpoodlmtemfvtas)arrmxrpou1aee mi3ildfmDranmp;(0texrxf3iadla   neo;t0 2toxr3ou1lltn ict s)arrrxmpot0ape  icildfs2umnmonu4 ltrxrciodomDraneilt s2xrim nudol nlieta( aDtaxmp;o1aex  octyd aDrlumpnt0trtrmo tadla eaivs;()srxr(r3oo4lpeelfvsat)arrru ont1oetoif3ias sDem(mont0aetrmfciatfmDr n sl()srum(o3iu1lmen net (f ruru o;u0ole  f3iadlm2uluvo t)alxrmrcoytomDraneslt teuoim ny4lpenliei t sruru ont1olt  i3iatfmDrln onu4aetnirciodlmD ai o (0 2xoxr nu1al   ivsasf rrrxrpot4aetnmfetadfm2ua( pnu)trxrio tadfmD  nesl() exo(m iy1lmenlfvtlt sDtm( pnu4apt mf3iltla el( p t4 rtnmocia1fmt ai o;t)srtrxo3iodoleelietl( srtmumpno0apt  fctytfs2um( p;t) rtomf3iotfpteai s;(  rumxrpoudop elnvs sfsrumxr nu0aleoifeiatls em(ms;u4arerxr3oydlmt  uvs () eumxo3oy1lmenlnci () 2uaxmonu4aexo o3tydlm2ra(vs () lxrmociydlat lues ()trum(r3iodll  mnet s) Dtax p;t0tlenmi3ils mDrm(vs;u4arerirctydlpD  iei;()t2tmir iydolee fei s  2ta( pno0tlxo oeiatfaDea( o u0alxomociytoaDr ivs;t)srxo(m3io1altemivsat) rtrx p;u0optnmi3iysla ea( s u4aexoxociotfp eln o;t0sexmxm3nu1opt mnvslt a2raxmo;u4tptn o3taslsDrl(vp;(0areoir3tatomDrlnvo s) euoxo nudomtemfvil()arraumpnt1altnif3tls s2emuvon(4 etnioctydlatr ieilt  2xo(o3iu4ll  livtatfarrrur ot0opt mo3iydlmDeluvo;t0alermfcio1fmDe n slt0 eumxm3nodal elics s)aDtm(rpnt4tetn oeilsfaDul( o;u)aexrmrcta1fpt  uei (  2tmirpou4alte nviat)arumxrp;u4tetn o3tasfmDel(vs u0aetomf3iatlpD anvslt)t2xoxopou4lm elicsl(  2tm( o;o0olto i3tatfmDem( s;() rtrif3oydoaDe ueslt t2uoxmpny4lmtemnciat)aDururo;o4olto ietldla2rlumo t0tltomr3iatlm eluvils)s2toir oo4ale mncilsfsDtau o;t0apenmieiat s2umnmp u4tlxoxr tadfate neo s s2xr(r3oo1lm nlivt tfarua(r ;u0aex mfetysla2umuvs;() exriociatla e i slt0sruo(mpiudolt  nvi tfa2tm(r nt1oetomi3tatfa2rl(ms;u)aexomo3ootlm  livilt0sexoio no1lltemiviat)artaumono1tpxo fciltla emuvo;t4 lxnir3iatfaDrlnvi (0 rurimpno4om n iesatfs2uaum nt4oetoio3tlslmDul( o t0 lxnxr oydfp   ueil( setoxr3nu4omenlnct () 2uaxr ;o4oetn oetyslm rmnmsnt0trxrmr iodoateau o;(  rtmir iy4alen nvsat) Duau  ;t0teeomi3tys s2uau o;(4aetrmr3totfpDrln ils0seumxopiy1op elneil(faDta(mpot1aeen fciat s2ua( on(4 ltnxf3iotom  anei;t  rumxm ny1optemict s  Drrx  ;t4tptoioeilsla2ra(vp t0trxrmf3iydlmt  u ols s2xo(m3iy1ape lfctl( aDrax pnu1oet  oeiytfsDrmu pn(0tetrmr3tydoa rauvs ()t2xoxrpiy1ome  ivta( a2rmump;u0olxomietld s elnmsn(4aeerio3iodfmD  nvi t teuo(mpiy4oleemics s  2tmurooo1tlx mfcildlmDrm(vs (0aeeoxrctytfm  ai i;( s2trxmpiu1ape  fvtl(faDrmxr ;u4oexnmf3iatfsDrl( p u0 lerio todop   neils  2xoir3iu1openmfctat  rtmurp;o1oee mo3iytfm2ua(msnt) eeoifcio1oa   ivi;(0texrxopiudlmt  neslt a2urxrpot0ape ii3iatfs2rm(vp u) lxoxrciadoaDrlnvilt)seto(o iodlptnmfeta( s2uaxr no4tlxomociydfmDrmnmp;(4 exoxfcoo1oa  li i;s trxoxm iodlptelictasfsrrruro;t1tltomicildls2rm( snt)tlxrmo tydfaDranes t0s2trir no1lpt lnviltf rtmx  nu1tpe  i3ildfm2rlnmp;t4 exrir3iotop  au o s s2toimpiydlle  fvs ()srtm(rpnu1oex  o3tld s2ra( onu0tlxrmrcto1lat ln sls trxmxm ou1ole lfvs ()srrm( o;u4tpt iocilt m2raums t4aleomo ty1oaDean i;t)sexrim iu1omenlics tfs2ur(r ou4aee if3iytfmDrlumsnt4alerxo tytoaDrluei;( s2tr(m3nu1om  mfetat arumx  ;o0apx  feilsfa2rmnvp;u4trxrxf iadopt aivolt) exm(o oo1alen ivsat aDtau p;u4oltomociasfsDumnmonu4alxnmrciotfmtr uvsl( t2umxrpoodoltn fesa() Drm(mo;u0tpe  ieiydlm2ua(msnt)tltnifcoydom  an i;s0srxmxrpoy4ll elfviat a2tm(rp;u4tex  ocildlaDrau o;u4tlxnxo ia1fptrlu s ( srtr(r iydlltn iesa()aDurxmp;t1optnifciatlaDrm( sn(0trenxf3to1opD ln i s setmxm3ny4ll n ivslt sDtrum ;o0tleo fetadfmDel(vonu4tlxnio3tadopDrauei s0t2xoiopiy4lptnlneil() 2umxro;o4aetn ieiltla elu pnt4altrmf oa1optr ueo t tetrio iudam emict s  ruru pou4tpt mo3iysla ea(ms t4tltrmfciydoa rlu s (  exmirpoy4ol nlnciasfs2ua(m ot0tptomi3tyslm2rm(vp;t0tetnmo oa1lpDeai ilt) eto(m3oy4oltnlnvs (  2trumono0tpxo fciasfs2uanmp;(0alenxr3iy1lmD lnvslt0trxm(m iudlmt mnvt (f Drrx o;t0tltomoeiydfm2ulnvsnt)tetnif3oy1omteanei () etrirpiu4lptelfes s) Dtru onu0oeeomieiatla ra(vo u)tltrir3todfmDelnvo (0t2trxr iu4ome lnesl()s2um(moou1alt mfciysla2ua( pn(4 etrmfctotfmteluvi s  eur(r3iodoptnlictltf Drruronu4texn f3ilsla2eauvpn()trenxf3oy1oat lnvo ()s2trxmpnydom nmics s aDum(mp;o4ole mo3tadfaDeanvpn()texnmr3iadlaD  neo s)srxoxr3iu1ol elnci ()aDrrxm no1oeen o3tltfsDeaumsnt4 rtnio3totopte uvi;s)trtmxopio1omte icsa()aDtm( o;t1aptomfctyt a2rau s;u0tetomrctotomtrlu i t0sexmxr oo4lmtemivtas s2tau p;o0olxoioetltfs uan s;()aexrio iotla   u i t  rtm(m nydaptnmnet s  2rmu ooo4texnmi3ilt s rm(vsnt4tlxomoctydfmD  u o (0texoim nydol   ivsa(  Dtrxroou0opxo o3ils aDrau o t4 lxnmfcia1om  lu o;()t2tm(m3oudamt lfet t)srrrumpot1apx mf3iysfa uluvs;u0 etrxr3oadfa  lieo t0trtr(m iudomtnlicils)artaurpnt1oleniocils a um( s t4trermf3oa1faDraneo;(  etr(rpny4amt licsas  Duax onu1tee  oeiat a2raumsnu0teeniocoy1fmDe n o;s0sexrxrpoydll e ici tf rrm(r no1alxo i3iyd m rau p;t4aetnxrcoo1fptr n slt0 2urxrpiy4lmtn fctas s2ta( o;o0oet ii3iydlm2rlnvp;t4 eeoir3totfaD livolt tetr(r oo1lmtn fvil( s2uaxronu0opx ifctas a ranvo t0 eermfctydoptelnei;t s2xmim iy4am nlietl( a2uaum ;o1tltomoetls sDeaums ()altrxo ootlatrln s s0trtoio3oydlle livi t s2rm(mp;t1tex iietasls2um( p;u4 exrxocia1laD aneo s) exrxr nydom elnesasfsDum(  nu0aetn i3ilt a umums (4aetriociytoateauvolt  ruo(m oy4om n nvil( artrx  ;o1aet  f3tad s2um(vont4 lerif todoaD aieolt srtm(m3oudomtemiesl() 2raum ou0oet moeiad sDua(vpnu)teerxr todlmD lneolt)setr(m3ny4am elnvsl(f rrax pnu0ape  feiadfmDua( on()tlenxo3iadla  lnesls trumxo3iudapenmfcsa(fsDtmum ;t1optnif3iat a2uln pnu)artrmr3iydlp rlu s t0srxrxo no1ll nlfeta( s2umxmpot1alxoifciad a el(ms ()tlenxf oa1omDe u olt0t2xmir3oodape  nesl(f 2ta(r ;o4aexoio3ils s2em( o (0arxomrcoodfm rlu i t  2xm(o iu1ome mivs t sDtmx o;u4tpt mo3iyt aDuau o;u)trxnifciy1oat au o;() euo(r iodopt miesa(fa2rm( o;t4olt  i3iyt a ua(mp t4texnifcty1lp eai i;t0srxoio3ou1lmte ivil(f Dururpou1olxo f3iltfs uauvsn()aetoxfcootopteauei;() 2toxo nydopen ivtl()a2umx p;u1oee ioeiydfs2emnmp;u0 ltnir tytfpte n i;s  rxo(mpoodal nmnet ()arumurooo1tex iocilsfa2ul(ms ()aexoxocio1lm elnvslt srxoxmpnu1olenlnet t)sDtau ont0olen feiatfs2ea( p;(4alerxr to1la e nvs ()trto(r3iu4ap  mivsl(f Drm(rpno0oex  oeiatfm2rm( p u) rxomr todlmt aieolt0 etoxm3nudomeemnes (  rrr(  ou1altnmo3iytla rmn sn(4altomf3oadlp eauei;t trurxopnu1ll emncilt aDtaurpou0aeeomociat s2umn p;()tetnxrcia1oatrauvol()t2ur(opnydll  mnes sf Drmxr ot4tetnif3iydlm2el(vp;t0arxrxrciodlaDeluvilt)trxoxm nudoptemnei s a2tmumonu1apenmiciydls2rln p;u4aeerir3iatfa   u i t srtoio iy1om emies s) Duaxmpnt0aptn o3iltlsDrl(mo;(4arxrmf3iotlmt lneo s0srumiopiu4lmtnlncs ( s2ua(rpnt4optn i3iatfsDrmn onu0 eenir3ia1lmte uei;t) 2uo(r no1ol n ivtltf 2trxrpno0ale  ietlsls2elnvon(0 lxoxf3io1faDr ivo (0s2umxmpnudap   ncilt)srtmxro;u4altnmfcilslm2ra( snu) ltoxr3to1lat  i o (0teuoxmpno4alenlneslt)a2trx  ou0tpx mieiatls emn ont)texoif oy1faD ln i s0 2tmxrpiu1ol  lfesat  2trxm oo0olenmiciltlm ulumont4 exoifcta1laDe ivs s)t2tm(o3ou1lmt lfeilt  2rrxm ou1alen feiad m2ranmon(4 lxriociodfateaneo;s) 2uoxmpiudlm  lfct t s2tm( pou4tlenifetys a2umnvont0trxoio ty1optraneols0setr(rpnu1optelnvt s sDuaxrpot1olxnioctlsfa2ulnmp u)trermf3oy1la  lnei;s  2tr(r3no1omeemnvi (fs2uau oou0tex mietyslmDel( o;(0 reoxo ia1oaDr i ols0s2umir3nu4op  mfctl( s2urumo;u0oet iocildfa2eaump ()alxrifciadoa rlu s;t0t2urxopoydapeelfetltf Dumx poo4ole mi3tatlm eaumsnu4tltoxf ta1oatelivs t) etmimpiy4al  mfcil()s2umu  ;o1altoif3tldfmDelnvonu) exrxf3todop e ueols  ruoxopnu1ll emnesl(  Draxmp;o0opeomietysla eanvpnt0tlxoxr3iy1fptrluvi;(0 2uoir3oo4ol  lfcsls) 2ur(mpoo1alto icild s2em( o;u)aetomr oo1la elu o;t  2uo(m no1al n nesa()a2trxrpou4alt if3iadfa um(msn()tetnxocty1lpDe nvo s0 rur(m oodlm emnct t srrm( ono4alx iictyslaDeanvont0artoif3ootoaDeau ilt t2ur(opoy1lpte ictat  Dtmurp;o4opx  iciyslm2eauvo t)tlxrio3tadfat  uvs t) 2um(mpiu4omeemfvtltfs2rrur ot0apenmfcilslaDraumo u4arxnxfcoa1lptelieilt)seuo(m3oo1lp nlnvs s srum(m ou1aee mf3ilsfsDuau snu4altnmrcta1fmte ivols) 2trxmpny4ol   ictas) rtax pno0tpx  fcils s emnmo;t4 rxnmf3iadfa eaiei t0t2umio iodoptnmfcta()srtaxm nt4apxoif3tys sDrl(vsn(4 lxnmociotomtrlu il(0t2tmim3iu4amtnlneta(fs2rmur ;u0tpenifciydfm rmnmp;(4arxrir3oydop e n i;s  rurxo iydamt mfctl( a2urx poo1tpxn ieilsfs uaums ()arxrxr iatomDelieo;()teuo(opnudopte fvta() Dtmxrpou4tleoifcildfs uau snt4tetomo3oo1om r i slt sexmirpoo1lmt lnctl()aDra(rpou4tetoif3tadla2rln p ()texrmr3ta1fm elueo;(0t2uoxopnodlmtn nvi () Duaurp;o1tlt  i3iad s em(vo;t)tlxnxr oytfpD anvsl( s2umxrpiy4amt  nvslt  2ur(roou4tex iicild a elnvont4texrmr3totoa r nei s srxrxrpnudal  mnetat sDuax oot4teeo f3ias a2rl(vsn(0trtrir oy1lmDeluvols truoim3iodlle  feslt) Dtr( pnu4alxoiictld mDemn pn(0areomfcoy1fm rlivi t0trxmxm3oo4omeemicsas)srrm(rpot0oet ii3iyd a ea(mo;u)altnif3tytlptr n s s)seur(r no1altemfetltf 2um(r nt4optoii3ils s emnms t4tleoxoctotfate nvo s s2umxo io1lpe  nvt s)s2raum ;u0apxn feiadfm2rau pn()aeenif3iatfm  aiesl( t2ur(o ny1ll  lici tfsrtrxr no1tex iictyd s ea(msnt0 leomrcoytopDrlues;( seuo(rpiydomenmncias srtm(m ;t4tptnifctydfaDelu snu4 lenio iodlate u o;s)s2to(r ny1lle  fci t artrxrono4tltomf3iltlm2rm(vpn(4 rxoircoytopDe u sls)t2xrim iu4altnlnct sf rtru oot4oltn oeiysfa umnvp t)arxrmr3ootop eaues;s)s2uo(r3io1al nmnvils)a2ua(m nt4texn i3tasfa rmnms;u)texrio iadoa   i o ( sexo(rpoy1om  livi t  Dumxmono0tex ii3ils aDea(vs t4tlenxf iodlmteauvolt  rxoirpoo1lle  fes ()aDumxrp;t4ope  ieias a umn snt4trenif iodlatrli o;s t2ur(o3oydapee ivta()arraumo;o4aexomfciadfa rl(vsnt4 renmfcty1fp   ieo (0 euo(rpio1amtn nvsa(fartm(  nt0teenifetlt mDua(mpnu)texnxfcoatop ean olt  rtoir3iy4aptemfetatfarrmxmpnu1opt  fcild m ea( p;u4altoir3oytfptrln i;t sruoxr3iy1altemics t s2tr(r no1oexn ictadlmDran s u) rxnircty1fmtraneo;(0setmimpiy1lp elfct t)a2ur(r ;u0aex ioeild m emums;t)tltrxfciytoa r u i t)tetrio3oy1al  mivta()srur( o;t1aexn fcilsfa2em( p u4trxoxfcoodfpt livolt0 etrir no1lme mivtat)aDtr(mont1olt miciat mDem(mon(4areoifcoa1fpD aivi;s0t2trxr3nu4al elict tfartm( pno4oetoiociadls ea(vs;t) exnmr3to1lateau i ( s2xrimpiy4amte nvsls)s2tm(  ;o1tlxnmoetydlm emuvo;(0tlxomo3to1oaDrai ils  rxrim nu4apeemivi s  Dtm(mo;t4apxnmiciysfs2umumsnu) rtomoctatla rlnvi;s0t2tmio3oy4olt  neiltfarurxm ;u4texnii3iyt a rmn snu4tltoio tadlmt  nvi;t0 eto(rpiudlltn ivs (fsrraumono1tpxoiietysla2rmn p t) eeniocoodfp e i s;t  2toir iy1omenliesls  rtr(m no1tetomoctatls ea(msnt0altrir3iydlmDr ueolt)srtrirpoo4am  mfvt () Dtaumooo0opxn fetydfmDemu pnt4tltoxfciytlpDrai ol()s2xmimpnu1op   nvils srrrxrpno0ale io3ildfsDumu snt) lxoio ia1omteanes s) etoio iy4am e nvi (f rurx o;o0oeeomfctatlaDumumont)tltnmfciotop  ln slt0s2xrir3iy1openlict ( a2umurp;o4alxnmfciasls2ra( s (0trtoio ty1late ivo;t srum(r iydal n nvia() 2tm(mpnt1tpx iociydfm2rmumo t0alxoxo oydfpDean o;()t2xrxr iudam emfvs tfsrtm(rpoo4tpt mfeildlmDrlnvs (0altnxr3iodfpte u s;(0setrxo oodll  mivi s aruax  ;t4aeeoii3iytls2elumonu)tltrmr iodfm raueols)truoxo iy1amtn nci ()aDrr(mont4aexoiietyslaDeanmo;u0arerifctytlpDrlnvo (0 2uo(rpnudlp emfeslsf rtaumoou4aeeo feiaslmDranvon(4arxrio3tytfmDrlneols0trtrxr3iu4lmtelivsl(faruaum nt1apeomieiltls em(vo (4 etnioctatfpDranvi s s2to(mpiodamen nesltf 2rmur ot1aeto iciytls uln pnu4tlxomf ootfatrauvi;()sexm(rpoy4am   ies s)arraxmo;o0alen f3iatlmDrmuvsn() etrif3tatop e i i s t2xo(o3oo1ll n fci () 2umxmpot4aleo icildfs2ranmsnt)aetoio ia1fmDr nvs t0 etoim iodlp  livtat)sDrau  oo4alxnmicias mDum(vonu) ltrif iy1fmtrlneslt)seuoirpnu1am nlfcsatfsDumu  ou0oleomfeiasfa rmuvp;(0trxrxfctatlp eliei;s0srtriopou4llt lfei t)aDrru o;t1alt if3ilsls el(vo;(4tlxoxf3ty1omteanei;t)s2xo(rpou1lm  lictls) 2rrumpnt1aetomf3iyslaDeau on(0artomo3tatom r u s;t srtr(m3iudomte ict s) Drr(mo;t1tlx mo3iasla um(vs u)texomociytfpteaneo;s0sexmim3nu4lmenlneil(  Dum(  nu0olxo feiatla2rmn o u4teerxf iy1opD au i;s) rtm(r nydlm  lfviat artax pot1oleo feilsfm uln s;(0 ltnio3oadoa eauei;s0sexmir3ou4ale mnetl(fs2ta( p;o1olen iciydls ul(vo;t) rxriocootopt  ivo;s t2xmxo nydomte nvsas  Drmum ;t1opxnmictasla umuvont4aeerxf3io1lmDrauvo ( trto(r3nydlptnlncil()aDtaxr no4apt  ictltfm el( s;u4artrxfctotop  luei s0teto(rpiy4op   fesltfsrrru poo4opt  fcilslm ul( p u0tltrmr3oatlmtr nvilt)setmimpiu1alenlnvilsf Drru p;u1oeeniociadfsDel(mon() eenircoo1oaDr ieo t  2xrimpno4ll elfci sf Drmx  nt4aetnmoeild m eau snu4 etrif tytlat lnvs;s)sexoio oy1omte neil( s2rauroou0aee ioeiatlm em(mp (0 exoxo3oa1op raiei s)s2ur(r3no4am  mietl()srra(mp;t0tetn fetadlmDeln onu0aexnmrctotlp e ueo t teuo(r3nodapen iviat)aDtr(monu4tptnmfetldls2eanvp;(4 rtnmoctodopDeaieo;s)setoio oo1lp   icsl() rumxr ;t1opxomi3ilsfmDul(vonu)alxnmr iadom r ueo;( teumxo3io1omtnlneslsf 2ur(m ou4ape mi3iasfsDelnmo u)artnmf3iodlaDeau i;t0 eto(r3iudal nlies s  Dur( pnt4oeeniociytfa el(vo u) lxomo tadlptrauvi s)s2urio3nudlleelfet t a2rru  oo0tpeoiiciyd m rmu o;u0teeriocia1fpD anvi t trtrim3oy4ol emicilsf rtau o;o4tetnmfciatfa2eanvsnu4aeenxoctytomt aneol(0s2xrimpoydopee fcsatf Drru  ;t1olxn ietldla2ulnmpnt0aetoxoctytom eaneo;t)trum(mpoy4apee nctl() 2urxrp;u0aex  feiltla2rmn p (4artrxo3oadlp  lues s0 rto(opiy1lm emnvs t  2tr(mo;o1opxnmfeiytla ra( s t0tlxnio3iadopteln o t0 rumir ny4ol nlneil(faDurxroot0tpto fciasfsDra( p t0 ltoxfcoytomteanei;(0 2uoxo3io1op  lietas)artmu  ;o0tltn iciyt s2ua(vs;(4tetomo3totlptr n s;(0s2xoio iy1optnmivsasf Dta(moot4ope  iciysla2emuvp t)alenir3ootfm eaneo;t seurim3ou4al emfeta(fa2uau  ;t1teenioeiltlm2uan p;u) rtnmo iydfm eaivsls0sexo(opiy4ll elivt tfsDurxmp;t4alxoioetyd s2eanvp;t4 lermfcoatla elu slt s2to(m3ou1ol e iesa(fa2taur ;u4tleo fctytlaDrl(vp;(4 exoiocto1fa   nei ()texrxo nu1ole  nct t)a2uaumpno1aptnifcilslm2elnvpnu0altnxfcoo1faDrli ol()t2xrimpnydom  mnci t) 2tm(moou0tpx ifetltfs2el(ms u0 ltrir3oytop   ies (0t2urxrpoydopenmiei (faDuru pnu1tpt ioeiat a2eaump;() eerxo3iodlaDrluvs t) exmir no4amt  ivt s)a2um(rpno4opx  ieiltfsDran o;(0 ltoxo oatfmDraues;() etrxo3iy1lmeelnvtltfa2raxmpnt0teen ietld mDeaump t4trtrifcoytopD aieo;s) exoxo iudlltnlfcs s  rrax o;t1opeoifciat mDulnmp u0 rtoifcty1fp rliei;s) rum(mpou4apenlnes sfaDururont0alxnmieiyt s2emums t0arermrctadomDeauvo ( texm(opoy4aleemfcs t)artr(mo;u4optnmicilsfa ul(vpnt0 rtrmocoy1op eanvsl(0srtmio3oydom elfcs t  Durx  ;o4altnioeiyd a2rm(vp;u0aetrmo oy1fp   neolt0srtriopnodaltnlicsat)srtrxr ;u0oleoifetyslm2rlnvsnu4trtoxr to1oa rau s;s  rtmio ou1aleemfvtltfarrrumooo0tetniociys sDumumon(4 exrxrciy1fa ran ils tetriopoy4ol  lfvi t)aDraur ou0alenmo3iadfmDulums t)tlxomo oytfmt  ivol( s2xr(m3nudaltelfvslsf 2uru  ;t4opt  oetys aDea( p;t0teerio oo1fpDrluvi t srtmim3oydol nmnes t s2raumooo0aeen fetatfa rmnvp u0aexoio3ty1lpD lues;t0t2xrxo3ou4olee fetltfsDrax o;u4tlen feilslmDul( onu) rtnmfcty1la  lues;s  rtr(o3iudaptemicil()a2ra(  ou4tpeoioeild s2uluvpnt4aeerio3totomtrlueo;(0 2xmim no1ll e ncias srtmxrooo1tltn ociltls elnms;t)arenif3ia1oa  luesl() rtoxrpoy1olenmfvsl(faDtr(  ;o4tpenmociadlm rau s (4 reoif3iatomte ivs;s0 2tr(r3nydlmt mici t  rururpoo4ape mi3ildlm2ulu s;(4 lenir oy1lmD  uvs;s0seuoxopny1lm  mnvs tfsDtmx ooo4tlxn iciadfm2elnms t)texoif oytlmtranes;s) euoxo nydlmtemivi (f 2trxmpou1tpe mfctatfa um( s u4alxniocoo1opDelieilt  etr(m no4olenmfvt t)sDurumo;o1tpto ociltfmDrm( snu) etrxo3ty1lpD lu ols  2umiopou1amt mneslt s2rax onu1apt ioetldlmDeanvo;(4trxrmfcoo1opD  iesls trur(rpou1opt  nvi t) rtaumpnu4ole mi3iltls2umnvo u0 reoio3to1la eluei;() eumio3ou4omeemicsat)artm( oou0olxoio3ilsla umu s;u4trtrxo totomt lues s)teumiopiu4amtn fvtl(f rrru o;o4aexomiciatlm2uan p;t0 eeomf oy1la rlu i;()srur(m no4apeemnciatfa2ua(mpnu0oexo o3tatfm rl(vpn(4aetrxrcoo1lm eln s;()srtoirpou1amenlicias  rur(moou4alt  ietld mDul( p u0 lxomfcty1fa rlnvilt)tetoxr iodame mivt tf 2urxr ot4texniieiatla2ua( o u)tleoifcio1lpD auvo s)t2xm(rpnodamt mnctl() rur(r ;o0alto fctlt s2ra(vpnt)tlxrmf to1op eaueo () rxmir nudam nlfeilt artmxro;u4aeeoii3ild sDulnvsnt)trermfctadlpt ai il( srtoim3oy4om nlncsl(fs2tmx poo0oeeo fetytfa uauvsnu4 etnir oy1omtrlnvslt)trur(opoydaleemfvsls)srtrurp;u0tpxo fcilt m2ranmo ()tlenioctytfmt an i;s0teur(opoydlleemfct t s2rmu pno0tlxoifetlsfmDulnvo;u) rxriociotom rai olt0texm(o3nodaptnlnet sfs2rr( p;u1ope mfeiatlm elnmo;(0trxrifcoodlp r uvslt)texrio3no1ope  nei (f Dumu  oo4alxo oeiasfs2eaums;u4aeenxocoo1oaDeli o;()t2urxopiodlpte fetl(fa2rrx p;u1tlto fetls a2eanms u)aexnxrcoa1opDraueil() exr(m nu4optelfvt sfsrua(rpno4altnio3tlslmDum(vo;t0 leomr3oy1late i s;t)sexoxr3nu4ol emfvil()s2uaurp;t4tlxn iciysfa2ulnmon(0 eeoif iytfmte nvs ()t2uoxr oy1lle licsat  Dtmu ont0ape mo3iyd s ulumonu0tlxnxr3oy1lm eauei ( seuoiopny1oltnmneia( sDua(mono1oltomi3iydfa ul(mpnt0alxnif3oatomteau il( trxmxo3iu1ol e fetltfsDtrxrpou4openmfctadfs ea( s;u)altrmr3iodlmDe ies (0trtoxr iydapenlnvi ()sDuau pou4aeenmi3ilsfm2umn s;(4alerirctydopDraivi (0 2umxrpoy1altn ivsas) Dta(ro;u1oet  oeiydla2em(vs t0 rtnif3oadoaD anesl( trxm(mpiydlpe lncslt)aDrru o;t4open ictysfs2rmuvpn(4alenxr oodla eliesl()s2umxm3oudll nlies ()sDta(m ;t1aexn oetydfs rln p;()aeeoxr3oa1lpt livs;t0 2xrxo no4lp  livslsfarrrxro;t0tlxo oetldla2rm(ms;u0 lerir iydfmtr n olt0srumxm3oodlmee fci s sDta(roou1olxoii3iyd mDeaumpnt0 lxrxr oodfmD ln o t t2toxrpiodll  lfci t) 2truro;t1tpxoifcild mDrl(vo (4 rxomr oydoaDelivolt0trxo(r ou4lltelneta(fsDuru o;u1apxn o3ilsla2rmums t4altrmocta1laD lnvo t)srur(o oudlleelfei tf 2truroot1aetoioctldlm2ulnmsn(4 exrir3tytoa rau slt0sexr(m3iy1openmfet ()s2rrumont0optomf3tltlsDuan o u)arxnmocoytlp rlu s t0 2tmirpiodomt  fvtat  Drrxrpnu0alx ioetysfm2emumon()trtnxo3iadoa  aiesls0t2umir oy1ll   nvs t) rra(  ot4open i3iatls2elnms;u)areoxr3ia1laD lieo s0srto(rpiu4apt  netat)aDrrxm ot1ale moetas mDumnvp (0aexomr3io1la   u s (0 rto(opnu1ol e ncsltf rtru  nt4aexnioeiyd sDuan s;()alxrxr oodlmtelneolt s2xr(m iodlptemnct t aDur( p;o4tlxnifetyd s em(vo ()tetrif3ta1fptr n o;(  etrir3iy4lm n ivsl(  2taumo;o0opt  f3iytfaDean s (4alxoxfcty1laDrlu o ( srxr(opiu1ape lnet s  Dumur ou1tptnio3iyt sDuaumsnt0 ltoxrctytomDrlnvils)tetrirpiudlpt lneilt)sDtau oou0oltoifctldlm ua(mo;(0aexnxr iadfaD luesl(0 etmxrpoydamtn fetas  2urur ;o0oet mo3tltfm em( o u4treoxocty1op eai o;t0seurxm no1am nmfvs ( s2tmumo;o0opx iiciasfm2rlnmont) reoifciytop   i i;() exm(m3no1amt mict sfaDtmumonu1oetoiieiyd s2eau ont)arerxf3iydfm   i s s) euoimpoodale lfes t a2raurpnt4aee  ictydls el( snt) rtomo oa1lm  lueol()sruoxr3ny1llen nvi tfsrurxmp;o0apeomf3ils a rlu p t0artrxf iydoaDr ivo;s trtoxr3no1ll e fvsa( srta(r ;t4ale  feiydla ul( on()tltrxocta1lptraivo;t0teum(m oo4om e fet s sDtaumpno0tpeniocils a2eluvs;t4 etrioctodfaDr ivi;t)trumxmpno4llee iei sfsrra(rp;u1oeto oeiasfa2rlnmp;(4 ltoxfctodom eai s;t0 etmio nodllt  fetl(fs2rrum nt0texnifeiysfm2ra(ms t)tleriocoodlp eaivo;s0t2xmim3iydame  fcia( s2rm(mpot0apxnmieiadfm uaums u0 exnxf3tadfpte neslt) eumxopoy4llt micil(fsrtrumont0tleo i3tas s2rmnvsn()artnmr oy1omD  ueo t)setrim oy1llee iet ()s2tr(  oo0openif3ilt mDuanvont)arxomf3iodopDe ieilt trum(mpiy4ape mncsa() rurum ;u4oleo fctysfa ua(msnt4aeeomr3iodfaDrlnvi t s2tm(r iy4lmtelivt s a2trx pou0aptnifetld m2el( s t0 lxrmf iytoa e i s;t0s2xoiopny4ameemnvtl()arum(mono0optomi3tatlaDean o;u)tltoxo3oydlmDrli s (0 exoirpoydal  lfci t a2raumo;o4apeoiietldlaDemuvs t0 rxnxr totfmteaivi;()truoimpiydamtn ictl() rtr(rp;t1aex moetyslm em(ms;u4aeenmf3oadop   uvilt0sexr(m iydlm emivslsfsDuau ont1aee mfctytfm rmuvsn(0 lxnircoydfmDeanes;s srtrir nu4lpt mnctat  rrrxronu4tltn
\ No newline at end of file
@@ -0,0 +1 @@
+n o;() rxmim oo4lpte nctatf rrr(r oo0oetn o3iasfa eaumsnt4tltomfciotfa eau ol()t2ur(o3iudlpt lnet sf 2trxmpoo4alxnif3iydla elnmp () lxnio3tatfm eauvslt  2xrio3ou1alee nes t) rurx onu1aexoifctatfm rmn o;u4altoxrcoytfmt  u sls  exoxm oodape  ieias)aDta(m no0apenioetltla2rmu ont0 lxnmr3to1fa rlies s truo(rpiodalee ivi t s2urxmpou0olxomoetltlsDel( o (0 ltomfcoydfpt anvs ()trxmxm3nodlpee nei sfaDum(r ;o1opxnif3iydfa umn snu0aetomo oo1lpD  i o;s0 rxo(r3nu1omtn ieslsfaDumum ;u4tetomf3tls s rluvo t)altnirctadoaD  ivs s0t2urxopnudam elnei t  2uaxr ot4apxn ieiytlm ranmo;u0treomr3tydfptr u o;()s2tm(rpoy4optnmieilt)artau  oo4alxn o3tadlm uanmo;(0alenxr oatomtr nes;s) etoxrpio1opee nesas srrrxmpno4optn feiysls ra(mo ()trtoxf ia1lptelnvolt seurio3iy4lp e ieils)s2rmxmoou0tpt  i3tasfa2uanvs;u0alxoio todlmtrau ols0t2trxo iy4lmtnmies ()s2uax pot0alxnif3iatfa ul( ont)altrmrcty1fat au o t setrxm nydlp   nvilt)srurx ono1aeeo ieilsfm2umuvo u4tetniocoatfpD lu i;s0teurim no4ap nlnes t sDta(m ;t1tltnmfetadls2emnvp u4 lenif3tytlmD  n o;t) exrxm iy1lp nmfvil( srrrxrpnu4ale  feiysls rlump;u4altoxr ia1latrlnei;t0 exmxm3oo4ll nlnvt (fa2tr(r nu0ale  ietytfaDelumsnu0aeerxr oatlmt  ues;s0srtoiopiodoleemici s)srtaurpno0apenifeiasfm2rmnmsnu4texnxfcoodoatrlu i;t trtmim iy4opt  iesa(f 2trur no4alxnmo3tldfs2raumo t4artnmrctadomtrlivo () 2xr(r iy4lptn icsa( aDrrxmpou1oetniociad a ua(vont4 exrir tatlaDr iei;(0teto(o3oo1lptemnes (f rtmurpnt0oltnmf3iyslm emnmp;(0 rxrmo3tatfaDrau o t0trtmxr nydlmte nvi t) Dtax  ot0aex iietadlm rlu onu4 eenxr3tytfmD  nvo s0t2tm(m3nu4omtelfeil(  Dur(mo;u0oeto oetasfa2rln sn(0 eenxo tatfat lues t0s2xoir nydlm nlivt () Draur ;u4tpe  fetyslm umn s u)trxoxf oadfaD  nes;( srtrxm3nodope lnvsat a2rr(rono1aetomfeilsfs uaumsnu0tetrif3tatlat  u s;s)trxrimpny4ape mnesltf rtmx  ;u0alto f3tldfsDemums;(0 etnmf iotlm  ln ol(0truoxr3oy1al  mivs ( a2tm(  ot4opx ii3tlt sDea( s;u0trerxrciatlat  ivil(  exo(opio1opt  ivtat a2tr(mpoo1aeeomi3ildlmDua(vp;t0altnxr tatlateaues t0trxoim3iudllt mnvtlsf rtaump;o4oetomo3iytfm2ea(vsnu4tetnmo3iadoatrau ol(  rur(o nu4lm nlneias aDtaxm nu0apeo ietysfm ul( sn(0trxnmr iotlaDeaivo;t0 rtoir oo1lp elnciltf rrr(moou0olenmfeiasfaDrmnmo (4aetoxo3to1lp  ai olt)srumir3ou1lm e fvil(  rrm(rp;o0olenmi3ias aDranms u0altnxf tadlate uvi;(0s2ur(r io4om   nct t)s2rau  ;t4alxoio3iyt aDra(vo t4 ltoioctodomD luvi s0 rxoxrpoo4aleemieiltf Duaumpno4teeomictls a2um(vs;u4arxrxo3oa1fpt  ieolt0s2xm(mpiy1lmt  nesasf Dumurooo1ale  i3iatfsDumn onu4arxrir3totlmDeaivo;( srxm(o oudoltnlfcta(f ruauroou1tle iociad mDulnmp t) exnmrciy1fa  lneo;s0 rur(mpnydlleelnvtas  rtru  ou4oex iociysla2em(mp;()teeomo iy1oa ranvi;t0 2urir3io1opt mfvs ( sDta(mo;o1tlenmieiydlm2ulumsnu0 lerir3oatlpDeauvo s0 eumxo nudol  mieta(  2trx  ;o0oltn ictys aDrm(mp;t4 lxrmoctodlat an sls  exrio no1lpt lnvslt  Drmuroou0aexn i3tydfs2ulnvp (0alxnif3tytop rauvi;(0 2toxm nu4omtemfci tf Dtrxm ot0tpxnmfeiasfaDumu o;(0trxoir oatlmt  ivo t  eurio3io1lpt  netl( artr(m ;t4alt mieiytlaDulu o;t4altoifcto1fm elivol( s2tm(r3ou1ameemfct ( artrxmpot0texniieiyt m2eauvo;t0artnifcoadomDr ieols)trto(m oodalenmictlsf 2ur(m ou0oltoiociat a eauvs;t) eeoxf oatlm  lieol(0texmxm nodam emictasfsrtr( o;t1tex ifciyslaDra(vs;(0 lxnxo3iytomte ueol()srxoio3oodameemici t)aDur(rpnt1alenio3ias s ua(vp (4 etnxf totlpDrlu ilt teto(opiy4lm  lfeia( s2urum no1olx mociasfm2elnvp;t0 rerxo3iotfmDeanvs t0trxm(rpny4aptelieilsfartrxrp;u4tlx iietlsls ul(vs;u)aleoif3tytla rlu s;s0tetr(rpno1al e ivilt)srrm(m ot1tpt moeiysfm ran s u)aetrircoadfm raues s) exmxm3nydlpt lfvs ( sDra(r ot0olt  oeiatfa emnms;t0artnxf3oatlpt  uei;(0trur(opiudlpe  ncsl()sDrrumpou1tetnmo3tltlsDumu s u0alerxo oadfp raies ()texriopiudopeelicsls)s2rmur no4opxo i3tasfsDranmo;u4tlermo iatfm e nvsls)trxoim no4ap emfesat)s2umxront0tpxomfctlt s2um(mp t0arenmr3ta1latrai sl(0s2tmxopoy1ole lncs sfsrrm(ronu1tltnmiciyd s2eluvo ()teenmf3oy1fateaieo (  exmiopiydamtelnvs sfarrr(m ;u1ope moeiasls elu s t) rtomo3to1oa eaivi;s0 rxoimpio1lme mfvtasfaDtmumono4tex  f3iyt a uluvo t4trxoif tydlaD ai o;(  2urimpiodol e feil(  2rruro;u0tlxn oetadla2em( o;t) rxrmr oatfa eai o s seurxr3nu1ape micslt sDtaxm oo0aptnmoeiltfm uauvs t0 lxnmo iotlpDe n i;s seumirpnu4opt mnesls)a2uauro;u1tee  ieiytfaDul(vp t4tetrir3to1opD  n o;(0s2xrim iy1lme livsa(farrmxr ot0oetomfciltfm rlu o (4 rtrxfciytlmDelnesl( setmxm3io4omtnmfeslsfa2rr(mpnu4tltnmoeilslaDeln snu0treoio3oydla eauvo s) eurxo3ou1lmtnlfcta()a2rrumo;o4opt mieildfs2emums () eerirctotfptrlneo;t t2ur(mpny1lp n ivt sfsrtax  nu0oex moeiydfs rm( o u0aexrmoctatlm  ai o t)srxrxmpnudlpenmiei (  Drr(mooo0opto f3ilt m2ea(ms u0 rxoxr3iytfpDe i i t0t2trxo3oudllt lfcslsfsruaum ;t1tpenii3tyslmDua(vpnu0trxrmociatfm  livo;(  2ur(opiu1lpeemnetas artax o;t0tptoioctad aDeanvp t0 lxrir iytfpt  ies;s)trto(o nodlm elivia( s2uax pnu4apenifeiys s uaumon(4trenmo3iy1latrluvol( trxrir3oy4llenmnvs ( sDurx ont1tlxoifetysls el(ms (4tlerxo3oo1fmtrlies s trxr(o no4alte nvia(fsrrrx pou1alxoioeils m rlumsnt0altrif ootla rlu s;t)setriopnodame  nctlsfa2tm( pnu0tetomfetlsfmDelu pnt0arenif3ootlm r u o;t) ruoim iu1om   iesa()srrrxmoot0ope mfetatla2ra( on(0alxomrcoodfp rauvs;( srxo(m no1amt  fct s a2trx poo1aeenmf3ilt s2emums;(4trxnxr3oydoaD anvs;( setmxo iodom emfvils) rrmxmp;o0tlxomfeildfsDul(vsnu)trtnif3oatfmt auvs;s) rxoir3nydlm n fetas) rum(rpno1tetnifeiatfs2ea(ms t4 rerir3to1om elueo t trumxr3no1lm nmnet t)s2taur ou4tleo octltlaDeauvs;t4 etrxocoa1fpt  ivi;s texo(mpoy1am nlnesas)arum(root0oexomiciasfs2ra(vo u)arenmr to1fa ranvsls trtmio nu1llee ncsat s2rr( pnu1tpeomiciyslm eluvs;u4 exomrcoy1oaDrluvs s)srto(r3iy4lpt  ncsls) rtrx onu4aet  f3iasfmDeanmo u0trtoxfcoydfpteluei t0 etm(rpiy1ole liesa(fa2um( o;o1tpto oetydls2rluvs t4alerif3oytlaDr u o t)truoxo3iudome  ivilt)srtr(  nu4apx io3iatfa uluvpnu4arerxfciydfmt anvo t)s2to(m iu1ome livslsfsruax ont0tet iicilslaDean sn()teermr3oo1fpDeaueil(0sexmxr3oo1amtnmfvt s srta( p;o0aptn ieilsfm elnms u4 reoxo3ty1oat li olt teur(o iydol e ncs t sDum(  ;t1alt mietasfm2rl(msnu4 ltniociydfmt anvo s0setoir nu1lptelneias)aDtrxrooo1tet ii3iat sDuaumsnt4texnmociy1latraiei;s trxoxo3nudlp   fciatf rtrur ou0tlen fciatlmDea( s u) ltnxf3ta1fatrlivo s t2uo(m3io4alt  fvi t)arra(  ou4tptoioeildfsDulnvs;t4alenmr oytop eluvsl()s2urxr ou4alte iviat  2ua( p;u0oeeo feiydla rm( pn(4aeermr3tytfaDr uvo;s0setoim3nu1ll nlnetas  Dumx oot0apeo feiad aDeau s;(4treomr oadopt lu s s)setoir3nu1alt mnvslt) Dtr( p;t4tlt  ocild mDeau pnu)alxnmr3iodfpDran i ()trxo(m3nydaltnmicsasfsrrm(rp;o1alxn fetyslm ua(msnu)altrxr to1lmDelueo (0t2tm(m3nudlltnmfvtas) rrrump;o4ape  f3iad a um(vp;t4aexoifcio1fm  lnvs;t)t2xmiopnu1lptemneilt)aDuaxmont0oeen oeildfa rmnvo;u)teermf oytoa ran ols)trxoxr nudal nlfvtlsfartm(monu1apeoiieiatls2umn o (0 exnio iytoa r i s;t setoxo3iu4al nmfcsls  rraxrpno1tle  o3tydfaDrlu o u4artnif oy1opteli i;s) 2xoio iu1ll n iet t a2tm(mpno4oeto ieilsla uanvs u0arxrxo3iytopD  ueslt0 rtm(o nydope mfetat  rrm(mo;o4teeo oeias s eanvp u0arxnxf totomtelneols  2to(r iy1al n fvsas s2rrxm ;t0alx ifeilt s2ulu snt) eenif3todlmD luvils0texmir3ny1lm elnci sfsDtm(ro;u0tetomiciltfs ua(vo;t4altnio totfmteaueo;t)t2umxr3ny4alenmict t  2rru pnu1oexn oetytlaDulumo;t)trxnmr3oo1lateauei;() rtrio iudllte ncta(  Drr(m no1aex io3iadla umn p (4tetnmf3oodlpt  u ol(0teur(rpiu4altelfciltf 2uaumont4tleomf3iasfsDumu o t0 exoxf3oa1oatean s (0s2xrirpiydapenlnciat  2umu pot0tpx mo3tydfaDrluvp (4 reoxo3ty1omD  nei;t) rumxr iy4ll nlfvsas)sDua(m ou4optnmo3iad s2rmnmo t)treoif oa1omtrlneo;t)srxo(o oy4om  mnvs t aDraumono0olt  fciysfs emnvp;t)tltrir3oy1optranvsl(  rxrxm io4ll emicsl(f 2ur(mpoo4opt  ociadfm elnms;t0tlermo3oodfmD ln sl( srtoxr nu1olt  ict sfs2tax  nu4oexoioetaslsDemnvo t)teeoxr iotfate uvilt sexrxo3oo1ll e iviat srumxmp;o4oetomi3ils s raumo t0trenircootoaDrliei t seum(opiu1optn fei ()sDua( p;u4olto f3tldla rm( pn(4 exnmf3io1omDe i olt  exrir iodolt  ivs tfarurxmpnt0tpx ioetldlaDum(ms u0alermr tytfaDraueo;t  2xoio nudoltn feta(  2tm(rono0tleomo3ildla eauvpn() lxnmfcoytfa rlnvsls0texoio oy1ame lfvs (fa2rru p;t4ale mfeiasls2ua(ms (4trerxfcoatlaDrln o ( setmir oy1altn ivs t  2umur ;o1aetnifctlsla emnvo;t)texrxo3oo1fat  uvo;( texr(m3iodll nliei t)arraxrpnu4olt  octadls2um(vs;t) ltomf iy1oaDr u s t s2xoxm iu4lptelivs (  2tm(m oo4tlt io3iadfa2em(ms;u4 eerxo iy1lat aivo t)srxm(opno4lp n nvi s) Dur( poo4aeenmo3iysfaDrl(vp;t4tlerxocoytop  lnvs;(0 2trir3nu4alenmivtas s2tmxr ;t4opeo icilsla2rmnmo;(0 eerifctotlpDraieo t)teum(o ny1lle lnetatfs2taurpoo1tleomicildlaDelumo u)aetnmocoytopDeanvols  2uoxrpoy1olt lics s)sDuauroou4aeeoiocilt a2eanvp;t4aetrir3oy1fm ean s (0texrxm3oudope  nvs s aDtmxmo;t1opxnmfciltfs2ean onu4 rxomf tytfm eaieo s  2tm(mpiudoltemnvtat srrau p;u1oeenmf3ilslm2ulnmsnt) ltomocoodfmtranei t0teurxr io1am  lict sf Durumono1apt mo3iys m emuvo;(0alxrxo3io1lmD ai olt)sexoiopio1ope lnci (fs2ur(ro;u0olxnifetys a eanvs t)altrmfcoadoa   uvi;()texoir oy1openmies t  Duaur nt1texo fetasfm ra( p t) etnmr3iy1oa   n ils0srtrio3oy1apenmietat s2umxmo;t4tlt  fctadls ua(mp;u)teeoif3todla e u s t  etriopiy4ol  livtasf rrmum ;u1texo ietlt s2rlu ont0 rerxf oadomteaues (0t2trim3no4lm elict tfarrmxr ;u1tltn o3tasla em(ms (4trxrmo3totopDrlnvils0tetoir iy4lptnlnvt t arrmxr nu1aetn fctydfsDuau o;u0aexoxrcta1omD lnei;s0texr(m3ou1amt  neilsfsrrmu oou4tlen iciysfsDra( o u0 lxnmf to1fmD  uvi s  2uo(mpoodll   fci t)aDum(m nt1aet iietltfm2um(mpnu0 exrir3tadfp  anvi;t)tetmio3iy1op e fcslsfa2tm(m ;o1tpt mfeiltlmDrl(vs;(4texomf3iytlp eauei;s)trtm(r iu4lmtelneilt) Dtr( pnt0optoiietas s um( p;(4arxrxocio1fp eai s t0texmio3iy1ap n fcilt)artr(mpnu4aee  ociyslaDean o;u0arxrxrcoa1lm   uesls0texr(m3iu1amee fci s aDua(m nu1aee mi3iad sDumn p t0tltrirctytlm eauvsl()sexoir ny4optnlfvi s aDumxmpno0tpxoio3taslm2emnvo t4 eeoirciydfaDeai slt0tetoxrpoydal  lfvias aDrrxm nt0tpeniiciysfsDrmnmo t0 leoifcoodfmt auvo;t)texr(m nudlmtelfvias) Dtau o;u1alenifetys s rm(ms;t)trenxo iotfmDrau i (0 etoxopoo4am nmnvta()srtm( o;o1oexo ociasfs2ulnvs;(0 leoxo io1omt aieolt0 2xr(m io1openmnct sfs2rmxr ou4opt  i3iyslsDeanvpnu0trerirciy1opD  u i;()tetmir iudam   ncia()aDrax ont1oetnioeils s2rl(msn(4 exrmoctatfpt auei;t0t2tr(m3oodlpe  fct (f Dtmur ou4altomieilslaDemuvpnt4 etrxr oy1fmtraneil()trtr(o3iodole lnviat  rur(mpnt4optniociydlsDra( p t4trxrir3ty1opDr n s;t setoio3iudll emneslt arrmxro;t0aee  o3iltfm2um(mon(0 rtomrcoadop   ivo ( srtm(m no1lm e icslt)artrumooo4oex ifetas mDul(mpnu4 exrifciotlat  ivil(  2urimpnu4altelfvia(f 2urumo;o4apeo ictadfsDuan s u4arxnmrctotomtrlivs;t trto(o3oydomt  icilt s2ur(m ;o0olxoiieiltls2emn onu)trtnmocoytoaDelivol(0trumio oydom  mnvt (  2ta( o;o1tlxo f3tldls ua( s;u4 lxnmo3tydomtrlueslt s2xmim3no1om elnct t a2rrx pou1tetn feild mDeauvp;t0tlxomf iodlateaneo t)texrir3iodapt mfes ( arumx pot4tpeomi3iydla2uau o;u) lenxfcoytlat  ies s0t2umiopny1lle mnvtl(  2tm(r nu0oet moeiadla2umn p;(0 eermocta1omDe uvols setoio iydlpen icslsfa2ra( onu0olt mociytlmDrl( p;(0tltoxr oodop   i i () 2uo(opnydlpenlnci sf rur(ronu0ope if3iltlaDrm(mo u)arxomf io1lp e ues (0 rtoio3ny1ll  mnvt ()a2tmx  nu0tlto i3ilslaDelnmonu)aleomf3iydoatrlneolt sexrirpoudaltn ncil(fsDurx  nu1opt ifciaslsDeau pn(4 lxnxo totoateau olt0 eurirpno4lm e nvils srur(m ou0optn fetas a2uau o t0 rtrmf3to1la r u olt  2xm(m3oo4amt  iesas sDtmurono4tetomi3tad s2uauvsnu)arerxrcio1fptrai ilt)setrxm3iydalenlnet (f 2ua(ro;u1tlx  ieils a uaumpn(0trtoxf3iatom rau s s0sruoirpno4ome lics s srtm( ont4aetn f3tysfm ul( o;t)arerircootla  an s;t sruoimpiudlmeelfeslsfs2urxrpoo0aeeoiieilsfa2umn p;t) lxnmf3oytfat aues;s)setoim ny1lle mnctltf 2umu  oo1texnmocilslsDem( snt)arxriocoydla  aneo;(0trxrim3iu4aptemncsat a2rax  ;t0teenmfciydfaDul(ms;u4teeoxf oadfptean olt0 2tm(r3oo1ap   ivtasfsruaurpou1opto o3ild mDrm(mo;(4 eerxocoatoatr n i ()s2to(r ny4ape livilsf Drrumpno0olxoio3iyd s2eanmpnt)arxrxr3oydlpDe ivslt s2trxmpoydamt lfvtlt  2rm(monu0tptn oeiyd a2umn o;u4aexrir iadfpDrln o;s trxr(m io4ol nmnei (fa2rax  ;t1alxn iciadfs rmn on(0tlxrio3tadlp eau s t) rtoiopno1lm nlfct ( srtr(m ou1aet  feiltla eluvsn(0 renmo to1fmt luvs (0 2umxm3oudlp emfei t)s2rmu pnt4oet  ietldfm rl( pnu0 exrxo iydlptrlieslt trur(r nodamte ncslt  Dtrxmpno1tpxn octlsfa elu on(4altomo oatomtr ueol(0tetoimpoy1op   ncsas arrmu  ;t1tetn o3tad s emnmo;(0tlxnio3iadlatrlivi t  rxrio nodlmtnlfvt (fs2ra(rono4aptnioeilslaDulu p;() rtrxr3ootopD lieo;(0 2tmir iydlptnlivs tf rraxront4oleo ieildfa2um( s u0aetoif tytfpDr uvs;s t2trim3oy4oltemivta(fa2rr(m ;o1oet if3ild s2eauvs (0trxnxo3ootlm  lneil( setoimpiudolen fei s)aDtru o;t0aex ifciydlm2uanvonu4tlxnxf3iatfmt livs t) rurxr3oy4lle mncils srra(r nu1tle mociaslm2elu p (0 etnio to1fp raueil(0 rurim3iu1olt lnvtls)s2rrump;u1oex mfeiydlm umu s t) rxoxr iydfpt an o;s0 eumxopiudale lfct (  Drrxmpno1olxnifcild sDul(vpn() lerio iotlmtrauvs;s  2xr(r oo1lm  mictas  2tmxro;u4alen i3iad s ea( p;u0tltnmr3totopt lu s;()t2tmim3oodopt lictatfartr(m nu4oexn i3tyt a2ul( on(4 ltnxocta1op   nvilt0s2xo(r iudomtnmnes tfa2umx ono4tptnmo3iytfmDea( s;(0 etrmo3iadoptr uvo;s) rumxopio4lltemnct () 2raxr nu4tlx moeias a emnvonu4altomocoodomte ivo t) rxmxr oydope lnesls)artaumono4aeeoio3tldfa rauvp t0 rxomr oatom  ai o;t0texr(opoy1omtnlnvta()a2rm(r no1ale mo3iatlm2umumpn(4tetnxr3totoa  an i;s0seumir3no1am emieiltfarua(mono4alx  i3ils s2rlnmsnu0tleomrcty1fpDr uesls  2umim oy1ol emfetltfaDrru  oo0tet  o3iltls eanmp u)areoircootom  aueol(0srumxo nydalt mict t)aruaur nu1olxniociadfsDulnmpn(4tetoif3io1opDrlues;( t2trxr3nydale lncs ( arrrum ot0ole iicildlm raumonu0teeoir3todlpD lueols) 2xr(m3oo4op elfeiasf 2umu pno0optniieiatlaDeln o (0aleoxo3ty1lp e nvo t  2trxm ou4lpeelivs s)s2raxrp;u0opxn i3ilsls um(mp t4tlenxoctadopDeli i;t0 2toim3no4omtelneias aDtrur ot4openmieiatlm2rlumsnt)arxrxfcoodoptelnvilt  rtm(o ny4lptnmicsa(faDum(  ;u4tpxoii3iydls rmnmo t4 renxocoadlate uesl(0texo(m nydam n ncslsf Dtau pot0aetnii3ild a ranvs;()altnmr iadfmDe i s;( srxo(opoy1optn fvt t)sDuaumo;o0tpen oeiys a2rl( sn() ltnxr3tytfaDr i ols srxoxm io1llt  netls)s2uax o;u0aeenmfeiasfs eluvon(0tleniocoa1fpteli s (0s2um(m3no1lpe mivtas srrr( ont0aleomfciysls elu p u4aleoxr3ootlpt  i ils  2tm(r iy4lpt  iviltf Dtm( o;o4aex ifetld s2rmuvsnu) ltrif oytoptrli o;s texoio iudam nlnctasf rrr(  nt1aleo o3ildls eau p;(0trtrxo ta1fateaivs;t)trtoxm oo1al nmivilt  Dtaxrpou1aptoii3ilsfmDem( on(0tlxnmrcoodfm e u i t0seuo(o3nudlm elfviasfsDurumono4oltnmfeilt m2rmnmsn(4 exrir3ta1lmDeln ils0 exoirpoy1lle licil()srtauro;t0opeo fctasfs2um( o;t)artnio ootfmt luvo;t0 2uo(o ny4lp   iet t aDurum oo1opto ociydfa2rl(mo;t)trermo3oydlmte i s;(  2xm(mpou1llee ncs s  2trxrp;o0alen octad s em(ms ()tetoxrcoa1fmtr u o ( seumiopoudame lfeslt) Drm(mp;o4tptoiieiys m eaumsn(0aeermr3tydoaDrlu o;t srumxm3nydoptemiesls)s2urx ont0tlenmoetadfs2uluvsnu) lxrio3oa1op   ivsls trxoxr3no4lmtn fviltfa2rmumo;u0tet mfciydfmDea(vs () rtrmr3tydfa  aneolt0s2umxm3nu1lmtemicsltf 2rr(monu0tet  oetld mDrmn s u0arxoif oydlmtr uei (0texoxr3no4lmtn fetls)aDrmumpnu4tlx mfciad sDem(vonu4 ltnxo to1fmDrln s;()t2xmxo3no1lp nlneia(fa2rmurpot1olenifcilslm rlu s;u0 rtomf oa1om   ies s)truoxm nu4lmenmnesl() 2rrum ou0olxo o3iltla2raumsn(4 etoxr ty1oa raivi ()teumim3oo1lpe  fesat)aDrmum ou0ole if3tltla ran o (0artnmrctadlp   iesl( t2toxo no1alen nei ()s2rmur oo0tet  iciytlaDrlumo t)aetoir iotomDr ueo s) exr(r3iudoltn ieil( a2trxr ;o0alenmfeiyt s rauvpn(0treomo3iodlatrlu i s) rxrimpnu1ap nmfesls  Dua(ro;t1tlt iietyt a2emnvs t0aleomrciodoaDr nvol() rumio oy1openlfes sf 2rr( ooo0tpt mf3iydfsDrlnvp;u0trerxr3oatlmDeaues s s2xmimpiudol  lnet s  Drrx pot1tpxnmiciad m2rln snt)tltoxrctatfp   n i s) euoim3iu1altelicsltf rururooo4optomo3ildfs ranmsn(0trtnmf3todoaDeliei s0seumxo3iydoltemnctlsf ruau poo4oltn f3tas s rmuvp t) rxrxfciadoa r uvols srxrirpnudap  mivsl(fs2tm(rpnt4altn feiytlm2rlu sn(4aexnxfcoa1omt lu i () ruo(o3ou1ale livils s2ta(root0oexniietat sDea(vo (4tltrmf3iadfa  luvo;t0teur(rpiodoptn fctl(farrrur ot1olt mociys m eau s;(0 rtnifctytfmD  ueslt0 euo(mpio1optelfvs s) rurx o;u1oltoifciys aDua(vo;(4 ltnxf ty1omt au i s0t2tr(o oodamtn ivtlt  2raurono0aexn ieiadlaDran p (4alxnxo oo1oatrlieo;(0t2uo(o3iu1olt  fvtlsfs2tru ont4tex  f3iys m2rluvo;() rxnxoctodfp eai olt trxr(o3iydale miviat) rta(m nt4apxnmoctaslm emuvsnt4alxoxo3oodlmDeaieslt)teumir ou4olenmietl(fartr(roou0oetomoeildls ua(vsn(4trtrxo oatfm eluvilt) exoxr no1ol emivs s aruru pot0aeeomfcildlsDrl(von()tlerifcoodoaDraneo s)teuoxmpiydopt  fct s) 2tr(r ot1tpe iieiat a2eanms t0 lxnir oytlaDe nvs ( t2xm(m oo1lmtnmici sfsrtm(  ot4opxo oetysla2ulu onu)trxnmo3iydfm  aneils srtrirpoo1opee nci sfaDtrxm ;u0tlxoio3tytfm2em(vp;t) ltnir ia1omDelnei;s0teuoxm iodaltemfvt sfsrtrumpot1oexoii3tyt sDranvsnu)tleoircia1fa eauvo;(0t2xo(m iudamtemfctl()arrm(roou0alxniiciyslm ul(vo t) ltrirctydopD au o;( s2um(m3oo4al elnvt ()artaxmoou0aexomfeias mDulu p;()trxnxf to1fa eaies () 2tmim3nodal  mfcsa()srrmu ont1alxo ocildla2uan pn() ltrxf3iotlptr nvi;t) 2umio3nu4amenlnei tfa2tm(moot0olto fctldfm rauvp (0trenxf3io1om  lueo s0s2trir oydlp nlivs ()sDra( ont0ale if3ildfa el(mont4 reomo iadfm raies;t)s2xoiopnu1ape lfes s) 2rmx oou0aet ifetat m2umnvs;(0aeerir iatom rai o t srur(rpou1ll   ncsa()arumxmp;o1tpx iieiytfm2eau o;u0aexomo ta1laDeanes;t0 rxoio3iu1oltelicsls) rtrurpou0opx ifciasfmDrau s;()tleoxf tadlpDr u s ()srtmim no1apenmivs s)artmum ou4oetoif3tytls2umu snt0tetnmrcio1oa ran i s0trumxr nudope lictlt) 2raxmonu1opxn i3tytfa el(vs;()arenirctatlaD ln i;()t2xrimpiudope liesas s2tmumpoo0tlx mieiatfaDrmnvpnu)altrmo iodfa eluvils0trtr(rpoo1apt  fcslsf 2urur ou0opxo f3iysfs ran p u4tetrmf3ty1opt lieo;t) eurxrpoy1lm elnesa(f 2tax o;o4oeeoifetldfa ean o t0texnxr3io1fm eli ilt)teuoxrpnodamtnmivslsf rrauro;t4oleniiciys aDrmnvonu4 rtomf oo1fpD lues;(0t2tm(opoydopee nvsa( sDumurp;o0apenmoeiydlmDua(mon(0alenif3iy1fpD  ivi t0s2uo(r oy4olen ncta( s2ta(m ou0aex iietasls ua( sn()aleoxr ootlp eln s;t0t2toimpiodalte iei tf 2rmuronu4aptn ieiydlsDrmnmsnt0aexrif totla rlivilt0t2xo(o nudllt lict sfsDtru p;t4teen ictysfmDrmump u)texoxr iy1lptr iesls)truoim3ny1optelici t a2tr( p;o4tltn icias m rmnvo;(4 lxnmo iatop r ueo ( seur(r nodoleelicia(f Dtmumpot0oltnioctyd a2rm(mp (4 rtrxo tatfmDrlnvs (0 exmir3iydopt  netatf Drm(mpno1opeoifciltla eauvs () ltomrctodlptrluvslt  rtmirpnu4amtemnvsa(  2ua(  ot0tpx  ictlt mDranvsn()aexnirctotfm eauvol( setmxr3oo1ame lfcsa( a2rau ono4altoifcilsfs rlnmo;() rxnxrcio1fat auvi;( s2tmio3nodopeelicta(faruau pno4tleoiiciadfa2eanvon(4 rtrxrcoo1optr nvs;()seurio3nu4om emneta() Drr(rpot0aetnii3tldla2ra(ms;(0alxriociydomDrlieol(0s2um(m3nu1omt  fctlsfartmu  ;u4olto oetadfaDrauvp;u)texnir3iodopDrlnvo;(0 eurio oy1am nmivsls a2rrxrpot4apxoifeilsla eluvp;u4arxnmo oatfpteluvsl()teur(mpiudope lict t  2urxmpnu4oee iociyd m2um( ont0alermrctatlm e nvo (0 etrxopoydomtemncs t sDuru o;o4aleo o3tldfs umn s;u)tltomrcto1optr ueo t tetrxm3nydap elicsls)arum(m nu4opeo ieiyd s ea( s;(4aexrir oo1fm rlnvi;s)setmxopio4amenlfvt t) rtmxmp;u0aetomicilsfm2el( o;() rerxr3tydfpD  nei;( s2xr(m oo4lmeelivt (f Drmum ot1olto f3ilt m2emnvonu0tetnmr oa1laDrlnvo;s t2tmxm nudlp nlfvt () rtmumonu1olxomo3tltlmDuauvsnt4 lxnxo oydfmtr ivi;s srxoxr iydap nmfes s)s2rmur ;u0oex  ociysfaDumu s;u) exnif iodomD auvsl( seurim oy1olenlfvtlt)srua(  nt4tltnmieiytlaDemnmpnu4 eermf3iytoptelueolt)sexo(m oydole mnetasfs2trxrpnu0tpxoio3ildlsDuanmpnt0tlxrif iytomtelu s ( s2uoxmpiu1lp  mieil( sDuax pno1oet iieiydfm2eaump;(4alxomo ootopD ai ils texrxopno1om nlivt tfsDtru o;t1teen fetlsfs ea(mp;(0 ltnxo ty1faDeaivi (0seuo(opou1ame lict (fa2tax  ;o1tptn feiyd s umnms u0 exoxo iotfm   ues ( t2xrim iu1lmtnlieils sDrr( p;o4oeenmieiad a umump;() exrxo3iy1lmt  ies s  rurxmpiydlptemnvilsfs2ur(r no4oleo f3iasfm elumpnu0 lxnmo oy1lpDe nei;s srtoir oy1ll emncsas) 2tmu oot4aex  f3iydfs2ea(vp;u4 etnmo oodoaDr u o;()texm(opoo4lleelfcs t aDururp;u0apt  ociltla ul(msn()tlerir iatfmD lu o;s0 rumxo oy1opeemncsas) Drrurpnt0altomieiat a2umnvp;t4artrif iadlmD  uvi;s t2urxr no1al eliesltfsrrrumpou4tex  octat aDumumsn()aeeoio iytop e ueo;t)srto(rpoy1lmte fvs t) rta(r nt1apxomietld sDeanms u4texrmociydlptrlnvol() 2urimpiudlm e ncsa( s2uaump;t1olxnioeiasfm rl(vp;u0trxoio3oadla   ivi (0s2xrio3iy1alt  nvtls)s2um(m nu0oltniocildla2rau snt)aexrmo iy1lpt auesl(0 etr(m3oy1olt  nesa(  2trx p;u0ale iieiadfmDea(vo t)trxoxocio1oaDeaivsls  2xmirpou1ap e fvtat) 2trxrp;o4tlen ietlsfa rmumo;u0aeeomr3oadoaDr n ils0s2xr(r ny4apt livtlsf Dtmxmp;u1ale mfeiatfm rl(ms;() exnmo iadopDrlueols srtmxo io4llee ietl(f Dua(m oo0alx micild aDean o t0 reoio3oodlpD li ol( trxr(rpoo1am nlfct t srrru  oo4oex ii3iyd a2eauvp;t0tlxrio oa1lmDrluvs;t  rxmim3ny1lme  fesasfsDumu  ot1tpe mfeiatla um( s;u4tleomr3oo1lptrluvol() 2urxrpny4ap elivtltfsruax p;o4tptn i3ildls ul( o (4artrxrctadlmteai i s)srtm(o ny1op  lfvt (  2rrxro;t0oex  o3iltfs umn o u) renxocoadfmtean ilt0trxriopno4lm  mici tf Drau pou0tlxoiicils s2rlnvs u4texrmf3oadlateau ils0 2uoxr3iy1aptelnvtl( a2trur ou0optnifciys sDuan s;t)alxrif3iydoatr ivol( s2xmxrpoudlltnlfesl(fa2uaurp;u1apxo o3tyt a rl(mp;u4aetoxfcoadfpt au s (0s2urxm nodamt  icta( a2um(m no0oet ioctlt a rau pnt) renxr3tydfmtr uvi;s)srto(r3iu4lm emivsl()arumumpot1tpxn ieiytfm2uauvo () renxo iydomt aueol() rumxrpny4lpe  fvtat sDrrx poo4opxo iciadlsDrlnmsnu0aexoif io1fmDeaivi t  etr(o3nudaleelnvia(f ruaxrp;u0alen o3ilslm2umnmont0aexoio ta1opteai il() 2uoir3iodlltelivi (f rtmumont0alt  feildfs2em(vo;u0trxrmfcoa1lm eluvilt0t2xr(r3nu1lleemfcils)srrm(r no4aex iociltla rmump (0 eenxociotfpD li i ()trur(mpnu4ap nlneil( aDrrur nt0oltn ieiytfs ea( s u)tetrmo oytfm eanvo ()s2tmxr iy4amte nes () Dumum ;t4aex mo3ilt a emnvs u0tlxnmrctydomDeai sls0 2xmxm oudlpt lfvi (  rraumont1opxn icild m2emnvo t4arxrxf3iadfaD lueol()srxoxm ny1al emnesls) Dur(monu1tpeoifeils s eln p;t)altoxociatfpD aivsls t2urimpoudlmtn fvsat aDta(mpnu0oexn ictadfa eln p u0 lxnxrctadfp eln sls)t2xmio nu1lmt lictat  Draxrp;o1oet  o3ildla2rln pnt) leoxr3io1omD  ieils seumir3iu1lpe lneslt) Dumu oou1apxnmi3iysfa2ua( o;t)artrxo3oadfpD an il( setrxmpio1llenlictat  2rau pno0optnifeild a2um( s u0 renxr ootlate n olt  2xrim3oydap  mfet t arum(mo;u4aptomoetltfs2eanvo u4aexrxf3ta1om  lneilt)teurim3oo4lm nlfcslt  rrmx o;u1aleoif3iydlaDuanvs;(4artrircta1op  li o t trtrio3ny1lme mfvs t) Dumxr ;t0tpenifcildfaDrauvpnu) etnmr3io1fmt  neolt)srtm(o3ny1ol  livi tfaDtaumont1aleomf3tldla rm( o;(4 exnif iadoaD  nvo t0sruoirpny1omenlnct t) rtmu  ou0aexnifetasfaDrmnvp t0aexnmr3oo1fpt luvs s0 etrxopoy1ol emiciasfsDtm(moou0olt mfctasfa2uanvo (0alxrio3tydlptrln s ()s2xmxr3nodol   ncsa( a2urxr ;u0apxomfetlt m2raumo;u)artomf3tatoate ivs;t0seto(mpno4lpeelics ( a2uaxm ;t0tpe  ietysfsDua( s;(0aexnxociy1omteli o;(0 rtrxo3nudomte neias  rumumooo0tpe iocild a2ua(ms;(4tltoxf3ty1fpDelnvi;(0texmxopou1aptelfvils) Dtmxm nt1ope  f3iasla2rauvs (0tetnxo3oodoate i i s srum(r oodll elicslt sDtrxrpno1altnifeiyd a elu onu)alxrio3oo1oatr nvils)trum(mpiy4alte fetas srum( p;u4opxnio3ild mDumn o;(4tlxnirciytlmte ueils)s2toxmpiodomt mnctat arra( p;t1oee  ociltla2em( ont)treniociadoaD aivsl(  2xrxm3iudam  mietlsfa2tr(mo;t0opxomfciydla2eauvpn()texnxf oa1oatrli o;s)t2umim3no4ol e iei ()aDrm(mp;u1ope ifctldlsDean o u4aleoio3tadfaDrln sl(0 rxrir3nudope lfcsa() 2trxrp;t0oeen f3ilsls ul( s t4 exrxf ta1opD aiei;s)t2urxmpiu4ap nmfct ( arur( pot1texo fetadfsDraump;u4tlenxo3tytlmtelueo t0srtoxm oy4ope  ici ( s2ta(  ;o4oleoiociyslmDul(vs (4arenio iadoaD  uvs s) rxmimpnudol  lfcsas  2rm( pnt1olx  ocils mDra( on(4 rermfcia1fmDr uei;(  exo(m3iy4om   ncta()aruaxrp;o4aex mfetydls ranvpnt4 eenir iodfmDr n sl( t2toim ny4al n ivtatf Dumurooo4oee iicild s rmnmpn(4texomr3to1lmtrli o;s)s2urxmpiodapte nct t  rtrx p;t0tltnifetltls2ua( p;t0tltnmo3ia1fmDr ueo s t2xm(mpoydlp e feilt) ruaum ;u1oleomf3iydlaDrauvp;u)aleoxf3oatfaD anvo;s sexoxo3nu4ol  liesltfs2rmx onu1alen f3iltfm eauvo;t)tltnmo tadomD  iei;t0 rumxr io1lmtnlfct s)sruax pno4altnifctytla2rm( ont)tetoifciadfaD auesls)sexrir3nu1al  mfcsltf Dtaur ;t0aptn f3tatfm2elnmo (0areomr oydlateaies (0texoxr iydlpt  icslt  rrm(m nu1aeto ociatlaDrauvsnu)tltnmfciytfpDeaivs;t seurxr3ny1am e ivi t srrru oot4ope mo3iyslmDra(vsnt)areomrciydlpDr nvslt0 rur(m3oo1aptnmics s)sDtmxro;t4ole  f3iltfs2ranvp u4tlxnmo3tydlpt  ivi;( srurxrpoy4olenlnci s srrrxrooo0oleo fetyt a2uanvo (4 eeoxfctodfm   ivslt0trxo(m nu4ap  lnvtl( aDra(  ;u4aexo o3ilt sDea(monu4 rtoiocoo1lm rai s;t0teurxrpoy1ope mnvtat srumu p;o0oetn iciysfa elnvp u0 lenxo oatlp eanvo;(0s2um(o iy1ome mnei ( s2tm(m ot1oetniiciaslm2el( p (0 eerifcoo1omDraiei t) eumiopnu4op   iet () Draxr no1apxn f3tatfa ul( p ()aeermfctytlm eluvs;t0 rum(opiudape mfei s)a2tmu  ;u1alx  ociysls ulnvpnu)aeermf tadoa rlneols texmxo3iu4lp nmicslsfsDuau o;u1tpxnmo3iatfm umnms u4arenxo tadlmtrlnvol(0 2tr(m3nu1altelfvt s a2rmu  ou4tpx  i3iytfa em(mpnt4 rxrmrcta1fa rli il( t2to(o3oydamte nes s sDtm( pno4altnmfcilsfsDrl( p;t4 reoxr3to1fa r u i;t srurxm io4ap nlicils  2rm(monu1alt mo3tat mDea(vp (4 rxrif todfaDraneo;t)setmxopoo1am e fesls a2umurpou4aptnmictys m2emnvo;t)alenxo3oo1oaDe ues;s setmio iu4oleelnviasfs2umxro;o0olxn icilslm2umu s u) rtoir3oodfat  n slt  2ur(mpnu1am  lnvt ()s2um(rpnt1olxo ieiydfm rm(vp;u)artrir3oydom r uvsls0trtoxopnodap elfesa( aDtm(mp;o4apen fciyt s emuvs u4 etomr3to1lp  aneolt)t2ur(r oo1optnmnei s)s2rrur ;t4tlen oetldfa2em( o;u0trxniociy1laDr iei;()texrimpno4al n ictlt)srrauroot4alenio3tlslaDua(vs;t0aetoif oytlpt lu sl(  rumirpno4lm nmfvt s)a2urxro;o1apeo o3iydfm2uau o;t0 eerxf3oy1oaDelnesls0t2urxr no4lpe lneslsfsrum(moot4tpto iciatfm um(mpnt) rerir3iydfateluvolt0t2xrxrpoo4aptnlfeta(fartaurpot1oetnioetltls2eanmo u)alxnxr oydfpDeauvo;t) rxrim3iodopt lncsa( sDtr(r ;t1oexnmoeiadfa rmnvsnt0aetrxrciodfmDeluvol()srtm(m3oy1lm  mnctlsfaDua(rp;o4tetomoeiydfmDulu o;u0aleomo3todfa ran s (0 2urxrpny1ameemnvs () rurxrpnt4openmoeiydla2raump;t)texoir iotlaD  i o;s) exoimpoudalt  ieiltfsrtm(m ;t4altn o3ilslm ranvp;t0teerir3oytfpDrau o ()s2tr(o3oodam   net ()aDuaxmpoo0olxo o3iyt m em(vo ()treoifcoytlat anvo (  rto(opoo1om elneil() Dtaum ou4opeomociytfa2ea(ms () rtoxo3iadfptelieolt) eto(rpiydlmte ncils  Dtr(r ;u1aetomf3tlsla2um(mo;t4arxnxf3oatfat auesls0 2xoir oy4aptelnctlt artmxrpoo1tltnioetas s2uln snt)texoirctodlaD lu i;( t2xo(opiy4llenlfeta() Drmur oo0oet mieiadls el(vo;(4aetoxfcoodopDelnes t0 rurxrpio4llt lneiatfa2taum no4oexomfciydfm2rm(mp;()texrxfcoydlptrln ilt)t2umir3oy1alt  neta() Dtm(mont1tex ioeilslm2rl(mo u) lxrmr oodlatrlivilt)s2toxopoo4omeelieslsfaDua( pnt0oltomoetyd m2eaumo u4 lenir3oydopD lnesls0sexmxr3io4optnmiesl(  rra(rono0alenmieiyd s uln o;u0aexnifciadomtrlu olt0 rxm(m iy1lpen fet (  Dumu poo4aeeoio3iatfs raumo;(0artnir oo1omDr nesl( t2uoio ny1oleemict (faDum(  ;o1altnmfeiadfs elnvp;u4aetrmr3oo1om r ueil( setm(m3nodope livilt s2tm(ro;u1opxnmfeiyd m2umuvs;()tlxrif iytfat  uvi;(0srxr(o ou1ale lfcsl( aDrmumpnt4opxomf3tltfm2umuvs t4 rermociy1fatrauvilt  2xm(m3no1ll elncsat s2tmum nt4aptoio3iatfs2um( o;t)trermf ta1lat au sl()sexmxopoo1lme liet tfaDra(ro;t0opxn i3tatlaDrl(mon(0teenmrcoa1lmDe n s s)teumim iu4lme  fesl(f rururpnt0opxoioeiltfm umnmpn()trtnmo3io1om   iei;s)t2xmxo3nodlp n fei (  Dumxmoot0oet  feildls rlnvo;t0 rxoiociatoaD au o t  rurir3oy1am  lnvsl( s2rrxm no1opxnmoeiysfa elnmp u)tetoio ta1lmD  ivils0 ruo(o3oo4alee ivsatfsrua( ont0alto f3tltla2elnms u)alxoirctatlaD  ies s0sruoxmpno1al   fciatf rur(moou0texoiiciysfa rauvs t4altrifciotfpt liei;t s2xrirpiy1ll n neilt)a2ururpnu0tet mi3tyd sDel(vo t4altoxo iotla  aiesl( trtm(o3oydlmtnlfcs (fsrtm( p;t1oetomieiadlmDumuvo;t)arxomo iytfm rluvo;t)trtm(o3nudlpenlnctas  rtr( ono0oexomfcildlm2emumo;u4alerio3oydoa rlu il(0srtm(r nudalte iesas s2ua(  ;o1tet  feild s em( s;()trxrif3io1fmtelieo;t s2tr(opny1lpenmnvslsf Drrur ;t1oleo ietyd a2rl( pnu0aeenif3iotopDeln i () 2xm(o nu1lp  mieia()arta( pnu0openmoeiytlsDrmuvs;(0 rxnxf3oy1la elu o;t) 2tmxo3iy1oltn ict s)srum(rp;u4alx mo3tldlmDem(mpnt)aexnmo3oytfm   nvs;s0t2xr(rpiu4lmeelnctat sDur(r ;u4alto f3iad a rau s (4 etoiociotomD an ols srtrxo oudlle lnetl(f rum( p;u0apto f3ilsfmDua(vont4 eerir3oodfmDelivolt  rxmxr3iy1lptn fvsls  2tmxm ot0apx ioeiysls2ul( o t4trerxr todomDe nvi s trxrio iodllen nvsl( aDrrxm ;o4aleomo3ildfa2eanvpnt4 rtoxrcoytfaDeau o t)t2to(rpoo1alt  fvs s) Dtm(r no1oex ifeiadfs2emuvonu0tlerxocty1fate nvs t seum(r ny1om  lncsl(f 2rm(m ;t0aexomfcilsls2ulu p t)aeeoxr3iatfpD li slt0srxrir iydlpenmnci tfaDrrum nu1tlto ictltls2ua( onu)teenxo3oydoptrluvi;s0 exo(r3nydll e fctas srur( oot4tleoifciltla uauvs;u4arenmf io1fatelneils) 2trimpoodal emnci ( aDtaxmpot4tpe iociatfmDrmump u0aleoioctadomt lu ils0srtrimpoo4ope mfvi tf Duaxm ;u0oeenmieiad mDeauvs t4treomo3ootomtraieolt t2tr(o iu1aptnmncias) rta(ront4oexn o3ils m2rm( p;(4 lenmfciodlpDeln o;t srxrxo nu4ol elietl(farumum ou0opt moeiatfa2ea(vsnu4 renirciatfpt  nes;t  rtmxm nu1om e ncilsfa2tm(rpnt4olxo fciasla2emums;u4texnmrcoatoat ln s;t)t2uo(m nu4aleemnet t) Drauronu1tle iociydlm2uln ont0tetrxf iotfmDrlivils srtr(m3io1openlnci s  Dtaum nu1alxoio3iytfsDelnmo u)altnio3ty1opD liesl( trxrxrpny1ap n ivi s aDua(  oo4oex iieiysfaDrmnvp;u4 renir3oy1fpDeau i;s0sruoxmpoy4opt lncsls sDumxront1ape mo3iytlmDrluvs (4alxrir oytomD lies t)trxoxr oydlmt mnvia() 2tm( p;u1tlen i3iysfa2rl(mo u)arenif3to1lmDe neol(  2urimpoo4am nlicias srrmuro;u4tlt if3tlslaDem(mon(4teeomo3iydomtrluvi t) etm(r3iu1amtelfcsl(fsrumumpot4alxn ocildlaDul( p;t) etnxo3oo1fatr ues s sexoxo oydlp  lics s sruauront0texnioctatlsDrln o;t) leoxrciy1fa r ivi t0 rxoim no1lltn fciasf Drauro;o1oltniictyd mDrl(ms () lenifcta1lpt livo t t2xmirpio1omtemivs ()a2urur ou4tpt ioeiaslm elump u4texnif iytomDrai o;t)s2umxr oy1olt mfeiltf 2taxr nu1aexniicilt aDemn onu)texrxrciotfpD  uvo;t srxo(o3iu4ameemictls)s2ua(rpnu4oetniictyt m2rau o (4trxnmf oa1oa eli i (  2trxm ou4lp nmfeiat)sDrmu o;o4tee  o3ild sDrmuvpn(0 lenir3io1oa e nes;()texm(r3io1omt mfcslsfsDuaur ;o1alx ii3tysfa rl(mo;t4aeenmrcootop eauvslt0texrxopiydom  mictas)arrau  no4apxo ieiysfs ran on()trenxrcoatomt li olt0 rumxm io4aleemivtas) Dum( p;u4ope  ictlt s rmn pnt)alerif oadomDr neils texoim3iu1am emfct tfsrrrx  no0alxo i3tyt a2uan ont)aeeomf3to1latr uvi;t sexoxopoo4opt  fcsas) Drmurpnt4tlt ioctlsla el(mp u4texrmf3oy1laD lues s truo(r nodlpt  ncias  rtru  ot1tlxn oeiyslaDua(vp u)alxomf3iotoa rau s;t sexr(r3nu1lm  mnvilsfarrr(r no4oeeomietls m rmuvpn(0 rtrxo3todfa rauvo ( teuo(m ou1ameelfvilt) Drr( pno1olt mfctlt m2uanvont4 reomr ta1fa e neo (0seumxo3io1ap nmfciatfs2rr(mp;t0tpxoifctltfm ulu s t0tetrmf ootoaDrlueo s0seumxrpiy4amtnlfcs sf 2urxrpnt4teenmi3iad s2ul(mpn() lerioctotlaD  u s t)texmxo iudal emicils)sDtmx  nu1tpxnmietytlsDumn s u)artrxr3tytlptrau olt0t2urim io4al  lieil( aDtr(mpno0tetnifcilslm2eauvo;(0alenmr ty1lmtran o;t0trxm(rpoo4optnmnvia( a2tm(rp;u0tpxoiiciytls2umn s t)aeeoxf iy1omDeluvol(  2xoio3ny1llte fcs s)s2tmu poo0apt io3iadlaDel(mo;()alxnir3oatom   uei t  2urir3iydllt mfcsls s2taxm ot4opeomfctadfa2uluvsnt0aeenxociadfm rai o;s t2tmimpnu4alt  iei t sDuau  ;u1tlto i3taslm uan onu4tlenir iydfp raivols  eto(m oy1amen fvils  2ra( p;u4apx  o3iadla2rl(vp u0 rxoio iotfm eln o s s2umxm no1ope  icil()srtax pnt4tetn o3iydlaDul(msn(4artomociotfmte neslt0t2uo(r ny1al nliciat) Dumx pot1tpx iociyd s2el(vs u4texrmo3tadfp eauvi;( t2xo(mpiu1lmenlfes () rrax  ot4teto fcildfm2eln p ()aeeomf3oadlpt ln i (  2xmirpiodolt lnvi s  rrr(m oo1tltn f3iytfsDrmn snt) rxoir iytla elieslt) eurir oydap nmiciasf rumu ooo0tetoif3tysfm em(vonu0artnxfcty1lp  luesl(  rtoxm ou4aleelfvs (fs2rrx  nt0tetnifeils mDuanvpnt4teenmfctotfm eanvilt0sexr(o oo1apee ivils)a2ua(m nt4alt mociyslaDrln p;t) reoxfciydlm r u i t0 2umir oy4omeelfet tfaruaxm no4opx iieilt a2eln snu) reomf todfp elnesl(0 2tm(opnodlmeeliesltf 2rrx poo4tltoiicild aDuaumsnt4trxoxr ta1fpD  neo;()s2umxr3oy4lp e ivtl(fsrra(m ;u0altomi3iys m eluvpnu0tetoif3tytfat  nei ( trumxrpoo1am   nes ( a2rrx  no4olt iocilslaDrmnmpnt4aexnir3ia1fatelueo s0t2xoxm nu4open nvtl( s2ra(m ou1aexnifcilsfm uanmo;(4 lxoxo ty1fp r i ils) eto(mpnodop  lnetas)aDraxm ;t0aeeomi3tls aDulnvont4aeerirciydomt ln i;t s2umxm3oydapeelncilt a2ua( pot0optnifctld sDumn ont)texnxf tytfmtrai o;s0tetmirpou1al  mnvt (f 2rmx ono0openmfeias a ran p t4tlerxocoo1oa  ai o;t)s2umir3nu4op n neia() rra(m oo1altn octadla umu o t4alxnifciodlatrlivi;s sexrimpiydll  lfcsa() rtrxr nt4opx  f3iat a2ua(mp u4arxrio to1lpD  nvs s0sexrio iudamenlnvs ()aDur( ono0opxomoetasla2rmnvon()texnir oy1faDe i o;(0s2toxr nodoptnmnvi t aDtrxmoot1tpxo iciadlm ua( on(0texniociotla raneo;t)s2tmir nu1apte fviltf 2tm(mp;t4apxoiictasls2ea(vs t4trerxo ia1fmD ln o s) rxrir3oo1ape  ics tf Duax oou0texnmf3iadla ra( s u)aeerxocoa1omtrau o;t s2tmxr io1lmtelnei ()arraur ;u1opxoif3ilsfm2ua(msnt4trxoxr totlmDr nvo;()t2urimpoydalee nctlt a2rrx pou1optnioeiyd mDelums ()tleoxfcto1omD auesls) 2tr(opno1omeelnvia(fartr( p;t0texomfeiydfsDrmnvpnt) lxnxr iodoatr iei;t  2urio no1apeelictlsf Dtrxro;o4tlx  icildla2ra(vsnt4tlxrmf3oa1fm e ivols)setr(opno4op elnet t  Drm(rooo1aleo icilslm2el(msnu4treomrctytlmDraueo s0trur(rpiudoptnlictas s2tr(m ;u4tex  o3tls s2uluvsnt)texrxr iatoaDr ies s0setmim3oo4omenmivs t)arur( ont1altnmieiadfs2ua( p;u4tetoifciotomtr ivolt) exrxopio4alee fei s)a2ra(m no0opx mociad a2um(ms (0 leoio ta1om  lneo;s)trxmxo oodal   fcil()sDraum nu4texn i3tlsla2umuvp;() etoxr3iotoatrlies s)texoirpiy1lpenlnct s)a2trurp;t0aleoioeiytlmDul( pnu4arxnifctotfm e nvi s  2ur(m3iudllt lnvs s)s2tmum ;o4tetoifeiydlm2eau o;()altrmr tydfptr n o s  eurxr ny4lpt  ncs t)aDtaxmo;o4oexnioetldlm ul( s t) ltoxr3oytlpteli s;(0t2tmxrpoydope mnetls sDra(r ou4tptomo3iyd s2ul(vp;u0texomrciydlp  lies;() etr(r3iu1lleemicsls a2um(m ot0aee moetydlaDemnvsnu0areoxf3iadfp  lnvolt0teto(r3io1om e nesltfartrx p;u0alx mi3iytlaDrm( p t4aetnmr3iotomt aieo;t0 2xrxm3oudlptn fcsls)arrr( pot4apeo icilsfs2eau p;u)alxomo ta1fpDeln o;t  rxo(mpoodom   fcsatfaDtmxmoou4oeeoio3tadla2el(mo t)aexrmf3tydlatrai i;s  2xoimpnudamee ivi s)srumurono4aet  ietydlsDelnmo u4texrxf3iatfmtr n s;t0t2xm(rpou4opee ivt t sDuaxr ;o4tpe iiciadla rln p;u0 etnmr3to1omDrlivi ()srurio3iy4lmtelnvsat)aDtaxrpnu0apt mociytlm2elnvo (0altrif oy1opDr i o t0trtrxopoy4lpt lfvs tfsrraum nt1altn ieiysfsDrmums t0 ltnmrciatoa  lnes () 2xr(o3oy1ome lfeia()srum(  ou0olt iietys m2um( o ()trxnmrcoadla eauvi;s  exoim3no1om  mneiasf Dtau  ;t1optnmociysfaDrlnvp;t0 etnmf3iodlpDe ieo;s t2tmxm iu1oleemfvsa(fa2umxm no4tpen fciys sDelnvp u4tlxoio ia1lmtean s s  rto(r ou1olte nvtlt) rrmuroou1tlxnifciytlaDrlu s t4 rtoif3ia1lpDr ies s  2xmxo ny1lm  miesas s2rr(mooo0oexn fciytlm um(vp t)trtrio3tadom elnei;t) etoiopoydlpt  nvilsf Dtr( oou1texnifeiltfsDrl( s u)trxrif3iy1fmt auvi s0s2umxm iudlle  ietls)s2ur(rpot4tpenmociytls el(msnt)tlenmr tadopte nvol(0 rtoimpio1apeemnviltfa2tr(mp;u1tleo f3iydfm eanms t)artnmfcio1fa ran o;t  2umio iudol n ivia()artaumpno0oee mf3tls a ra(vo;() etrmr3ta1opt ln ils0 rxoxm3iy1lm elfciltfa2um(mono4oee if3iydfmDrmuvp t)aetoif totoaDeln i;(0s2xo(r nodap  lncilt  Dtmxrooo4tlen oeias s2emu ont)alxoxo iadlp e ies;t)srxo(o iu4lmenmiesl(  rtaxrpnu1aexo o3tatfaDumn s;u)aetoio3ia1fmDe i ils)texoxm io1lmen icias a2ur(rono4tet mociltfaDemnmo (4tltrif3oydoateli i;t s2xoxm3no4al e fei (fartm(mo;t0olxniiciatlm2el( s t4tltrxo ootoa  ai i (0t2umxm iodomtnmnei () 2rmur nt0oleniocias s emnmp;u) exoio tytlp   i i;()trurio oy4olee ivia()aDur( pnu0oee mfeiys a2raumo;t4tlxrmr3iodomteaivols)setrio iy1lle lnet () Drmumono0olxoifciltlm ra( o;t4tetoxr totopD  nes t sexo(o3iy1am  lncta(farrmxr ot4aeenifctlt sDeauvs;(0arxomr iadlaD livo t0trtrxrpoy4omee ivi ( sDurxmont4aptoifciyt m2em(mo u4 lenircoodfp r i o;s) exr(r3oo4ol e fvt t)aDuaumpot0alt iictlsfsDumuvpn(0trtomf3tydfateaies;s) 2tm(o3iy4ale lnet tfsDrrumpno4ale mi3ias s2rmnmp;u) renmfcootoat  ivsls  rtmio3oudopenmfct (fa2rax p;o4aetnmi3iltlmDulu snt0 rxomrctotlm r i i;t seuoxm iodapenmnesls a2urx  nt1apxoif3tldfsDelumo ()arxoif iotfa r uei;t0srtoio3ou4amte icta(f rraxmpot4apx mietat aDrmump (0 etoir3oy1optean s;(  exmir iudal nliei tfsDumxm oo4ape iiciltlaDem(mo t4 exrmfcoy1fmDrlneo t  rxo(r nudaptemnvsas  Dumxrpnt0open oetyt sDrmnvp;u4tltomf3tatfptrai ils srxo(o3oy1ame  fciatfsDurur ;t1oex micilt m2emnvs;(4tlxoxfciydlaD anvs;s srxmirpiodale mnvtat  Dua( o;o4apxomi3tld aDraumo;t4arenmoctydopt  u o;( t2umir io1op e fes t) 2rm( pou4oexomoeiytlaDuan s;u4 ltrmo iatfaDeaivsl(0trurio oudomtelfes t  rtr(mooo0oetomi3tld s2eanvpnu4 lermf tadfatrluvilt0truoxr3ou1ale  ieilsfarrrxmono4opxniicils mDel(vp;u0 lxnifcto1oaD ln i s truoir oo4altelneilsfs2ua(m nu4optn o3iadlm2eanmsn(0teenxo3iydom e n sl(0srumimpoo1lptnlfvi (farua(r ;o1oee  ietysls2rl(vp;u0texrio3tytfm  aivi s)s2xmio ou4ap  liei t  rum(m ;t4olx moctad a2ea(mpnt0aetoirciatfa ranvs;( t2xr(mpnudap  mncias  rtaumo;o1tlenmfetytfmDumnvs;u4 rxnmr oodoat li s;s s2tr(r iodlm emivsls)a2uaxr oo4aet  iciatfm2em(vp (0tlenxr3oytlaD aieo s0 2tmir io1lm nlnesls  rua(r no0optomfeiasla2ua( pnt4aexnmf3oatfp  lues t) rxoxm3iy1ol nmncils)sDrmurp;o1ale mo3iytfs2elnmsnu4 eerifciydfp e i s (0t2um(rpiu4ameemfvs () Drr(m ou0oleniieils a2ul( o;()trtrmocto1oaDrlivo;t0 2umiopno4ope  nvias)aruau o;u0tee  fetatfs2ea( s;(4 leomfcoa1omD aieolt  rtrim3ny4apen nvtltfsDrrumoou1tlt  oeiysla2em(ms;(4altnxr3iydlate ies ( sruo(r3oo4lmen fvtl(faDrr(r ;t4aet ioctadlm em(mpn()altnxf ia1fa rln o;t  rxm(mpiudamte feil(f 2tr(monu4tlxoif3ild a uaumo u0 reomf tatoa  ln sl(  2xrxmpnu4op nlfct s aDrm(  ot1ale moctad aDranvs u4trxnir iotlpD lnvslt0teumio3nydole lnvi t s2rru ont1ope iietydla2uaumon(4altnxr io1lmt  iei;t srto(m nodlm   ictl() Durum ;o1tex ioetytfs2ulums t0artoio iadoa elueo t)trtr(mpny4olen feias a2uaump;o0olto f3ias aDrm(vs;(4tlxoif oo1lpteaiei;() rxoxm iydaltelncils sDrm( p;o4aptnif3iadfs ua( o;()altnif3ia1oa   uvi ()seur(o oydlptnmneils sDumxrpou4tpe mo3tat a el(mont0 reoxr3ty1opDe nvo;s  rtm(r oodlmenliesas) rtmum nt1tpeomo3iasfa2ul(vp u4arxrmf3iy1fm r ueslt) rxrxr nydome lfvtas sDrau oou1oetniieilt a ra( o;u4arxnxf tydfmDeaneilt) rur(o3iodap n nvi t aDtmurp;t1apxn ocildfmDeanmon()aeenif ootfpDeai ols trxrxm iudapt mfvi t) 2uaurono1apen fctysfa ul(vo u0 rxoxo3oydfp  ai il(  euoim3iu1aleemieiat) 2rrxmpno1tpxnio3iltla2ranvs u0arerxrcoy1fa r uvo;t0 eumxopnydomtnlivt ()aDumu  ;o4ole mieiltfa2ua( pn()tlxrmfcoodoateanvo;t)t2xrio3iudoltn fciltfs2rr(  ;o4opt mo3ilsls uaumo t4tlxrifcoo1omtelnvs;( sexmio nu4lmenmfctls  2umx  no0ope iieiad aDel( s t0 rxnmr3ty1fp e n o t0setoxr io1ol elfcsas  2rrxmpou4opx  fciyt a umu sn(0trxnxo ty1om rlnvils)s2trimpnodapenlnesa(f Drrx  ;o4oeeomoeiytls ulnvpn(0 ltnmf3oa1fmD au ols0srtrxo iodopeelfesl(f Dtax pnt0tptnmi3ildfs ulumo;u0aetoiocoa1fm e uvslt)trxo(o ou1omtnmfcs tf 2tm(rooo4aptn oeiltfm2rlums;t0 rxoxocootom e nvi;t  euoxrpno4optnmivsat sDtm(moot0aetoiictadlm em(von()aetoifcty1lmDeauvsl(0s2xmir3ny4lm nlict t) 2umx o;o4olxnmieiasfs2emn pn(4trerxfcootfaD luvi s s2toxm3oy4amenmnvs ( a2um( poo4apt  f3ild s ea(vs;u4teermrciadfpt  ivol()srxmim iu4ll nmnvtlt) 2rmump;u1aetoioeiadlm2rm( onu)texrmfcoytoptelies s trurxm3iudapte nvtl( a2rru  nt4alx  ictyd sDulu s ()arxrif ty1fmteau s;()trtoir oydll nlictas)aDumxmp;t1alxn f3ilt s2eau snu)teermr oodfa ranes ( trumxr io4oleemiesl()sDrrxmpot0tlto feiasls2emu p (0texrmfctydomDrauvslt0t2toxo3nu4omtnlnetlt) 2tm(ront1altomociyt a ean o;u0aexrmocoydla   n olt0trxm(m oudlmenmivias a2ua(m oo1tle iicias aDumnvo;(4treoio iadoa eaieil()teurxr oydllenlfcta(  2tmx pno0tlen ictyt m2el( o u0tetoxr3tytlm ean slt)srxoio ou1omtemnesasfsrtm(m ;o0aexn ictld mDelu s u4 lenmrctodlmtr n ol()setmim nu1amt  icsl()s2ur(mp;u4aptnmfciyt s2um(vs;(4 etnio3oytfmDeauvil(0setmxrpoodlm nlncs t srur( poo1tpe mfciytlsDel(vpn(4artrxocto1la r i i;()srur(rpno1lltn neta()aDuaumoou1alto o3tldlm2rm(vo;t)arxnmrctatfm r u o s)srurxm3ny4al  lnetas)srrmxr ;u1opxnioetatlmDumu s;t) eerir iodopteluei;t0sexr(m3nu4lptelfesatfs2truro;o0aptoiociltfa rlnmpnt0aeeoxo iatfp  auei s) ruo(opnydapenmnviasf Duau  ;o4tpe  ieildfa2uln s;t)trxniocio1fp eai o s seumimpnydlpenlncsa(fa2urum ;o4tetomieiytlmDua(mp;u0 lerifcoatfmD  ivi s  2tr(r3oy4omee fciat) Dumxmp;t0oet ioetytfs2ean pn(4aeerio3tytlmtraneols0 rtrir ny4ll e icilt s2trump;u4oeenifeiyt m rmn s t0alxnxr oo1lm  aivolt s2tmir3ny4llenmfciatf 2tm(  no0tetomictytfs eau o (0tleoxocoa1fm eaiei ( t2uoim3io4oltnmiei s)arumxmp;t1tlxn o3iyd m2ea( s (0trtomr tytopDrai o t0 etm(o3nodomtnmivslt a2rr( ono4aptnmociyt a ulnms ()tlxnxfciadom  lnvo;t  rur(r oydaleemnci t) 2tm(m nu1oeen fetltlmDea(vs (0arxomo3ia1lp   u ols  rtoxopiy1ap  lncil(f Drrxront1alxo ieiyt s2elnmo;t) eeomr3oytoatelues;() eurxm iu1lm e icia(fa2um( p;u4aex  f3iyd m2rm( p;u)texnxo iadopte i s;t) 2xmxo3iy1ap  lieil(f Dtrumooo4tlt ifctadlm raumo;(4 rtnxociatfat auvils0trtmirpnu1olte ncils s2rau  ou4apx mfctadla2uanms u0arxoif oydla  lnvo;t  etoir3oodoltemicslt)a2ua( ono1tpxomf3ilt a el( on(4 rxnxrciodfa ran slt0setrxmpnu4lleelnet t aDuau  ;u1tlxn oeiad s eanvs;t4 ltrio3tadoa e ieolt0 2toio oudom   nvtl(fs2tax  no4olx  fciaslm2ua( pnt)teeoif3todfatraivs (  etr(opnydapen iciat aDua(mpnt1opeo i3ils a umn pnu) rxoxfctodfm elneo;t0 exoir iodom   neslt srta(  ou4tle iicilt s ran pnu4 eeomf tatoa eauvo;(0t2urio oydllte ivtl(farrmxr ;t0texnmfctat sDea(mo u) rtnxo3ty1la r n s;s0 rtoxm3iu4ol nmnvs ()sDtmxmp;o1aexoif3iasfa2rlu o (0tltrifcoa1oaDe iei;t tetm(o ou4lptemict ( aDurxmonu0oetomicilsfs2emu o (0altomrcootomte ieols)s2xo(r nu4ope  ncil(  2ua(  nu1aexnmi3tysfm2ulnmpn()trenxr totlpt an s ()s2toxm oo1olee ieias)aDtm( poo0oex moetad mDea(msn(4 lxnxf iydom raiei s trxmxr3nudal nmici t)arra(m ;t4opxo ieiltfs em( s t)tltrifciy1fm elueo;()seumiopiydlpt  ivsl(fs2urx pou1oleoioeilt s2ul(vonu4aexnifctytom rlnes;s)t2xrxo iu4ol emnctatfsruaumo;u1apx  f3tyslmDum(ms;u) renmr3ootla elu o t0 2toio nydlmt lnvsat artmurooo1tltoifeildlm uauvs t0arxnmo iydoptr ivi (0s2uoxr oodoltnmiei (fsDtaurp;o0tpxo o3ias a emums;u) lenmo3todfm elieo ()t2trxr oo1olenlfvs tfa2tm(r ;o0apxomfeiytls rlnmsnt4 etrif3iodoatrlnvo s)s2xrxmpoy4ll e fvta( srumurp;u1open f3iasfs2rl( o;u4 rtoio3iydom   n s;s) exm(m3oudlm emivtatf Dtau  ;u1opxoioetasfa emnvsnt0 reomr iatfpD an ol(0setr(m3oudaleemivia( sDtmurp;t0tlxnmocias m rlnmo u)areoxocoy1omD lneo s0 eum(opny4lpe lnct t)artaxr oo1aet mfciytfaDuan pnt) ltrmf iatlpDe ueol() rur(r3iu1ap elfvtas) 2uru oot4tlen ociydfa ranvp;(4tltnmr ta1oaD luvi s texriopnydll e fvt (  Dumx oou0ole ifciysfm rlumsn() leoxf ta1opDe iei (  eurim3nodlpt mfvils)a2rm(m ;u1aex  feiyt a2rm( sn()aeenxr ootomtr u i t s2urxrpoo4op nlfcta()aDum(  ou1tee mfctltfaDrmumo u0 eeomrctydfp rlu s t)seto(o3iu1optemies ( arurx pno4oet moetys aDea(mo;u0trxoio oytlpte ies (0seuoio3no1alenmiesat)aDrmu o;o1tpenmociydla2umn o;u0 rxrifcoytfmt lues;s)texo(mpnydom nlivils)a2um(mpot1opx iieiytlm2rmnvon()trtoxocoy1oa r n o;()sexm(mpiy1apen ivi t s2tau oot4alxo oeilslm2rmu p;()texrif3iytlpDrauvil( trurxrpoodlmt micsatf rrru  ou0apeo ietls aDel( snu0 leoxfcoa1fmte ieo;s)srxoir nydlpt lncs sfsrrrxrpou1oee mf3iadfa2rl(vont)tlerxr3tatlat lu i t setr(o3no1oltnlfctasfsrraxro;u4aptnmi3ildfa2rmu o;u4aeerir3ootlatraneslt  rumir no4lleelneiltfs2rau pot0tet  fciltfaDuanvs u4trxrmociotopteluvi t)s2toiopou4am nlncilt  2urxront1aex iieiad m um( pnu4tetoir3tytfa eliesls) 2trxo iy4al   nciat aruaxm oo0teeo o3tatlsDemu pnt0 rtrmo3todlpDean i;s truoio iy1ll   fcslsfsrumxront1olxnmoeiat mDuan s u0aeeomr iydoaD  nvo;( s2xo(r oy1op n ncslsfaDumxmo;t0alx ii3iadfm uanmon()aexoxrciy1lptr uvslt  2xoim oy1lmtnlietlt)a2tm(rpou1opt  i3iytfs2emnvo () rxnmo ty1om  ai i;s tetrirpiodlpe mivsl(f 2urumpnt1aptoif3tasfsDrlumpnt0aexoxf3iytomte nvols  etoir iodole mfvia()s2trumoot1apenioctlslaDelumo;u0 leomoctotop rli o;t) exrxmpoy1lle lnet (f Dta(rono1tex ioeilt a2emuvpnt0treoirciadomteluvslt)setrimpnydoltn nci s  2ur( oou0aexo ociydlm emuvo;()alxrxf todfm e ueo;(0srtoimpoy1lptnmivia(fs2ra(  ;u0tltomieilt m elums;u0 eerxrcio1fpDranvi s)sexo(r iy4ap   icta()aDtrum oo1aee mfetltfs2rl(mp;(4areoxf ty1fmDe ieo;t  etrim iydaltnmictl(f 2uru  nt4olt ifciydlm uauvon(4treoxr todfpDeaivslt) exrimpiy1ll nlictl(fs2tr(mpnu1oeenioeild s ra(mp;u)artrmf3oo1fm  ln s t0 exriopno1lmen iet t) rrm(  ot0ape mf3tatfm2elump u) rxrxo3oytla e ieilt  rto(m3nodame  netlt sDtm(m oo1opeomfeiadfmDrl(vo t) ltrmf oo1oaDr ueo;s  2xoxr3oo1am  miciltfarrmur nt4oee  o3tlt s2uaums (4 etnio iy1la raieo;s  rxmimpoodom elneilt sDrmu poo4opt  f3iltfaDrm(mon(4trtrmfctatoaDrlu ols0t2uo(mpou1lltn fei t  Duaxr no1tpt  fcilslm2rluvsn(4 rtnmr3oo1op rlues;()s2tmxm3iydo
\ No newline at end of file
@@ -0,0 +1 @@
+uvi s)texoxm ou1lp elfvilt)srum(rpno0aeenmfeiadfs rmuvo t)arxomo oydoatelu olt trumxopio1altemnviltf rtau oou1opxnmi3tydlmDranmpnt)trerxr3to1oat  nvi ( sexm(m3ou1omtelicils)aDua( poo0tpeoif3iytla uln o;u)aeerxo3iotop r u o (0 exrim3iy4ll n ictl(faDuaumo;u0alx if3tadlm2ua( o;t0 lxrmrcoadlaDrauvi;t0 2uoir3iu1ome lfci sfsDrr( pnu0tltn fciysfmDulnmont)aeeomr3oa1fateaivo t t2xrir3ou4opt mfct t) rra(r ot1aexomo3tatfmDuan s;u0 eermf3oatoat aivo;t trxrirpiy1olenlnctas  rrrx oou1aeeo i3tlsla eln o;t0 eeoxr ty1oa rai o;s  2xoir oudaleelfei s)s2tmxrp;o0tleo feiydfaDeln o;(4artrif3io1op eln i (0seurimpiy4ome  ncslsfsDtrxrono1alxnio3ilt a2rluvp u4aetrir3ootfpt lnvi;s t2uoimpio4ape lfcia(faruax  nt4opxnifciat mDumnvp t)trxrmr oa1latrluvs;t) 2urxopou4lltnmfvs ( sDurxrp;t1tex  ieiad a eauvon() ltnxfctytfa eaneslt) 2uoir nu4op nmnvtas  Dra(ront4apt iocildfs uln o t4 eeoxrcty1laD anei t  exoxm oudaleemfcil()s2ra(roou1olxomo3iltfaDum(vsnu)aetrxr3to1opDrluvs (0t2xoxr iodapt mfct ( aruaxmono0teeomfeiys s em(vp;u4tetrxf3to1fa rluvo;s t2toirpoo4lm  mncta() Dumxrono4oee iiciytfa2ul(ms;u4aetrxocty1fat  uvil()s2xrim3oo4ome mfvtasfsrurumpno1oltn o3iaslm emn p (0artnifciytlpD anes;(  rtmxo3oydam n net s s2umumpnt1teeo i3ild m uluvo;u0 rxrxf iydfmtean s;( trurxopnydam n nvtlsfaDra(m nu0ape ifeiltlm2ran onu4arxnxr iatomDeluei;t) rxoiopnydaleelnvil()sDrm(mpou1altomoeilsfa2umums t4trerir3tydoateln o (0tetrxm no1lpeemfci ()a2uau pnu4tex ifeiatfs el(mp;u)arxriociy1oat luesls srxr(m io1alenlfcilt srraurp;o1olx  iciysls el( o (4 etoir3oadlmD  n o;s tetm(o nu4amtn fci sf Drrxmo;t4aexnmfcildfa uau o;u)aexoiociotlp ean sl(0 rtoxr3iydamen fvs tfsrur(r ;o0tptnif3ias aDuln s (4 lermfcoo1lmt au ol(0t2xoxr oy4lmt licta()s2rmur ot4alenmo3tlsfaDuluvs (0artnifciotoateluesls srtm(m nudllt mncsl(f Drrx  oo0oexnmo3iytfmDea( p;u0tlenmo tadom eln o;s  2toir oo4am e ietls)aDrm(rpoo1optn oeilt a2el( p (4altrifcoo1op  auvs;() rtmxm ou1lpenmivsl(farrrxm nu1ape io3iys s2rlnmp u4tlxrifcty1oa e i i;s0srtmxr3nodomee feia()aDraumonu0texo iciltlmDel( ont)aeenmr3iatfmD li o;t) 2xriopno4al n ivtlsfa2urumpnu1ole  ictldlmDrauvp u)tlxnxr tadlat ln olt) 2tmir3iudlpt mnetl(fa2rrxm ;u0oetniiciadla2rl(vp t0alxnmocoatfaDeai o s) etr(o3io1optnmnvi tfa2rr( ont1teeomo3iys s2uaums;t4 lxrmo iadlpDr neslt)s2toxopoodom elicslt)a2rax  ;o4apt ifcias mDum( o u4 eenxfciydfa rlues;t  rur(rpio4ol  mfciasf 2rr( pnt1texnmietlsfm2ulumpnt4trxrir oodom  ln o;t) eto(r3iu4opeelfctltfaDtm( o;u0tlenmictls mDuanmsn()aexrmr3iydlaDe nvilt tetoir3io1op   ivta( s2ur(mpno1oetn fctatfa em(mp (0 etoxo3iadoa raivi s0 2umimpou4apen fes t)srur(m ;u0tetnmiciydfm2elnvpn()texomr3iytopt au i s)seumir3iy4lm nlfes ()a2rm(m nt1opxoio3tatfm umnmo u0arxnxf3oatlat  nvs;( sexmirpiu1lmen nvias)aDuauroou4tpt ioetad s2rmu s (4 etrir ta1oa eau i;s0s2xmxrpnydol  lncilsfa2ra(rooo4teto ictatfs2el(vo;u4artrmrcoadfa r neo;()sruoim iudomt lfvsas srrmuro;u0aptn iciysfs2umuvp;()tetoxfciodlmDe u i (0 eum(m iudoltnmictas sDua(  ;o0aee io3iytlm ea(monu0arenxo ty1la r i s;t  eur(m3oodomeemietas)srtmx pno0oet iociaslm2uan o (4 lxoir oa1fateaneslt0texo(m3oy1lm  miet ()aDtmx  ;u1tpt mfcildfa rmn pn()artoircoy1fmtranes;()seur(m3no1am  licsl() 2uaxrooo4altnmieiasfmDumnmo;u4altnifctytom r i sl( srtmxo iydolt lfcs s s2rmu pno1tetnmieiadfs elums;t4aeenif iatlpteaies;s sexm(m3ou1al e ivs tfa2tmur ou0optn feildlm uluvp;t0altoircta1fpt  ieo;t0 rtm(m iudalenlfeilsfartru  ;u4tlt  iciltla uanvo;t0areoifciatlaDe nvs t s2trim3iy1apt  ici tf rrrxmpno0olxomfciat a2rau o t) rtnif oydfat  uvi;(0t2urxmpiudll   fvia()s2rax  oo1tlto ietyslm2uauvo;()trtrxr todoaDe neo;t) 2xm(m3nudaptelfvsa( sDurum ;u4tetnif3ildfa2elnmo;(0trtoifcta1fm  lnei t0 rxoiopno4lptnmfvta(faDrmxm ;o4opxn ociysls rln s t0 lermf3ta1fa rlnvo t0 ruo(m3iu4alenmictl( sDtaur ou4ope mfcils a rm( pnt4arerif ia1oat  n o;s0 etr(r ou4olee nvtl(f Dtmumo;o1oleoiietadfm2el(von(4tlenircta1opD ai o;t  rtoxmpoydomen iesa() rua(r ot0tlxnmi3iad s2umnvo ()aetnir iotfpteli ol()setmxrpoo1apt lfctl()artaum ou1oetomiciydlsDraumonu0trtnxo3oo1lmD  neo s0t2trxm no1ll  mnct s srrau pnu0apeoif3iytlm2ea( pn() exrircoydlmtelnvi t0srumxmpnodlpt  ieilt  Dtrxmpnu1aleomf3tld s ranms u)tltnir oa1lm   n i;()srtmiopoy1openmnvi s)sDrau oot1opeo i3tasfsDulnvo;t0 rtrmfciy1oatelieo (0sexrir3nu1open net () rraur nu0aptnmoeiyslsDran p;t0teeoircootop r ivs t  rumxo ny1amtelictlt  Dtrxro;o0oex mf3iysfa rmump (4 exoxf3iy1op  aivs t s2ur(r iu4omtemfetat) Dra(m ou0tetoiictyt a2rmn pnu)aeerif3oodopDeanes;s t2xmxo3iy1omenlneias)aDrmxmo;u0oltniiciydlaDelu p t4 rtnmr3oy1faD  neols0setoim3iy1ame  fvtlsfarur(mont0opt mfetyd mDel(vs;t0 lxrioctodfptraueols)s2trxr3nydom  mfesas sDur(rpnu0open ocildfa uau s;t0 rxniocoatfmt anvo s0teum(m3nu4lp nmnvs s)a2trx p;t1tlt mf3taslsDemuvp t4aeerxf3ia1lpt luvilt0seumir3nodop  mnetlsf Dum(mp;o1ope micilsfmDumnmsnt4teenmf3iydlptean o;t)t2xm(r3ou1amen netatf Draum ;t1oeenmfeiyd m2ua(vs u4alxoif oodomtr nvi ( srxm(m iy4am nlnvil(f 2rrxrpoo4open oetatla2eln onu4teermo3tatfaDeli ilt0t2umxm3nudam nlieias  2tm( poo4ope if3ilsfaDel(mpn(0 lxnif3oatlaD  u s s  rurxmpnydlle lfvilt sDtaxrooo4optoioetydfa umu p ()tlerir3ty1oa elnvils)srumir iydoleelfeslt s2rmu oou0tee  icildlsDel(vsnu4 rxomf3oa1fp eau sl(0srxmxopnu4olee nvtasfaDumurooo4opeo fciad sDrl( snu4 eerifciodfm elieil(0texrir ny4apt lici t)srrmxrpot4aptoioctysfs rlnmo;u0 rxrxf oatlpD aivi t0t2tr(mpno1ape  neta()sDurxrpno0aexo i3iad m elump (4aetrxf3oy1omD ai s s trxmxrpoo1lltn nvt tfs2tmu p;u1aeeniictldlm2el(vpnt4teeoxo tatoatr ivsl(0s2xoxrpoodaltemivsls)sDur(rp;t1tlt iietlsfsDuauvonu) lenmo oadop r nvi;( srur(opiudameemictl(faDtaum ;o1oet  feiatfsDelums;t)aeenif3iadlmtrlnei ( trtoxm io4om   nci tfarrr(r nu0tpt iictaslaDeau p t4 lxoxr oydlpDeli i (  2uo(o3io1amtnmfvsa(fsDtrur nt1tex iieiys m rmu p;t4alenxo3tydfmD  u il()sexm(rpny1llt  iesat) rurump;o0oltomo3ildfmDua(vs t)aeenmrcoatfat ln i t trtr(o oy4alenmfcta( aDuru  nu4teen i3tydla2rmnvp;u4texomf3tatfaDr iei ()setoir ou4lm  mnci t artr( oou0tpx  octltlsDeanmpnt0 rxrmrcta1lpDeln s s  rtm(m3iu1omt mivs s s2rm(mont4tetoifctatls2emnvs;u)altoif3oodopD luei (0s2tm(o3oudole livil()s2tr(monu0alt if3tyd m umn p;u)alxrmo3iytfpDeauvils)trumimpiydam  liesas)a2trxront1tltnmoeiadfa emums;u4trxoircoadfpD  ues t0trxrimpiy4ap   fes () rum( ono0ape ioeiysfa2uan s (4tetnxf3to1fate uvs s) etrxmpnu1aptnmiet t  Drax o;u1oexn fciad s uau pnu)aetnir3oodfmD ln o;t) eto(m3no4al n fvt sfaDum(mp;u1tlxnmfciadla em( pnu4texnxocoytlmte uvilt)srtr(opoudoptnlfes t aDtrur nu1apxn fetys mDrm(mp;u) rerio3oodlat lnvi;t seumxr3iydolen ncilsfs2trxr nu4oex mf3iytla2umumpnu4aeeoxociy1lm rliei;(  2trir3ou1amte ivtlt a2rau pou0aeto ociyt m2um(vp (0alxnxoctotfatrln s s srum(rpnudol n ici t a2ta(mpoo0texo ieiad s2rmu o t) lxnif3oy1laDeau slt  etmxo iu1ol   ieil() rrm( o;u0altomfeiasfa rlums;u) rtnif oydfp  aieo t)trumxo ou1lpeelnct tfartaumpnt4aptomieiyslm2rlnvp;u4 rtomf3totfa   uvils) eur(m oy4lpt mfeslt)sDua( p;t1tpxomf3iltla elumo t4 rxnircia1lpDe nvolt0t2xo(rpio1lmen netl( srtru  ou1opxnio3tas aDem(mpnu)arxrxr iodlaDeau i t  2tmim3iu1apen nes ( srtm(rpnu4aetn oeiysfm emumsnt4 exomf3oodla r neol(0 2trio nydal n fvtl() Durx pnu1oex moeiltfsDel(vp (4 etoiociadla  ai o;( setmxopio1openmfeils) 2rmumo;o4tptnmoetltlmDrlums u0teerio ia1oatr n i;(0s2xr(r3nu4optelnetlt  rtru o;o0apeomi3iat a2rluvp;()aeerxo tatlmt aneo ()texoxopiu1ap  mivtat)srrax o;t4tet iictasfsDrm(ms t0alxriocoadfmD anvsls0texoxm ou4lltnlicslt)aDtrx pnt1tltomieild mDeanmp;u4arenir oa1fa elies (  rxo(o io1aleelics ()a2raumont0apenif3tysla rl(vpn()tetoif3iydlpte nvi t0srumxmpiudap nmnvia(f 2trxr ;t1ole ii3iadfs2rlums t0aeeoxf iadoa ean ilt0t2tmio nudomtn fvs (f rtmumonu1alt  iciadfa ranmp;t4trtrmr tatfateaivi;s0tetrir3oodomt lfei t) 2ur(ro;u0tpx mo3iytla2umuvp;u)aexomo totla rlivi;s)trtmxm nu1ll nmnes s  2rmxr ou0tpen ieilsfa2ua(vp;(0 rtoxf oodfpDe i ilt)t2ur(opoydop nmnciat srrmxm no0opxoiietldfmDelnmont0trxnxrciy1lp  luvi;s srumxr3oy1ameelfvia(  2rr(ro;o1tleo oeiat sDrln o u)trenmf oy1omDr neo;s0trxoir3oudlmenliet tfsDtr(rpnt0alt  ociatfm ul(vpnt0alxoxr3oa1oat  uvsl( s2trim ny1oltemncta( aDra( ono0opxoii3tydfm emnvp t0artrxoctadop eanvi (0 2xmirpiudoltelnes ( s2um(m nu1tpenmfciltfa2rl( s;u) ltoxf3oodfp  aiei;s srxr(opiu4ap emnct tfa2rm(ro;o0tlto iciaslaDrl(mon()tlerxf3iydop   n s;t0 etoxo ou4lle mivs () Drmxmp;t0tlxo o3tatfm2raumo;u0arerir3oodfate u ilt tetoxrpoudapenlici tf ruru pno1tpt io3iydla uauvont4alermociodfa rlu i;s) ruo(o oo1lpeelfctat) Dta(rp;o0opx iictldlaDrm(vs u4trtrmr3tytfatelues t  2xr(r oydomeelieia( arrmx  no1ope mietat a2rlums u0 rtnxr3iatfmDrliei;s s2xo(m io1altnlfes (fsDrrum no4oleo oeiytfm2uanmp;t)tetrxrcootfpDeai o;t trtoxrpnu1aptn nviatfsDumxr nu0opxomiciasls ea(vs;u) reoxr3tydlpD auei s)t2xr(r no1aptemnctat)aDraum no1oex moeiasfaDuau s;()aexrmfcootla  anvslt)t2umiopny1alt mictlt)aDtr( oou4alx  o3iydfm ul( p u) etrxocta1la ean s t  rxr(o ny4alenlivsl(fsrrm(m oo4apenmieils mDuauvsnt0artoxf3ta1lat au olt0 eurim3ny1am   fesls) rrr( ooo0olt  iciys s el(mo;(4texrmr ty1om   n sls) exoxopny4lle lnvilt aDua( pou0aleomi3iadfmDeanvp;u4 eeomo3oatlaD anvs;t)teumxo io4ap   nesa(farrmurpot4aeto o3tyt s ulu snu0 rtrmrcoydfptrlu o;t)s2xrir3iudlptelivt (  rtmu  oo4oexnmoetyslsDelu pn() etomocto1latrlneo s)srxo(r3nodll nliei (fs2tm( p;o0oexnmictldfa2ea(mo;() etrmf3ty1fmt  u o t  2xrxrpio4oleelfvi (f rrm(mo;t4tpenioetlsls rmn o;t0tetoxrctadlmDe i i;s  euoxo3iu1apeemiet t aDuau  nt1oexnifeilsfs rm(ms t4treoio3ootfatraiesls seurio nu4am elfvslt  rur(  ;t0aex moetyd aDeluvp;t)altnir3iy1lp r u i;t)seuo(r3iodolt mnetasfsrtmxroot0tlenmo3iytfsDrm(mpn() reomr3ta1fatelivi t teuo(m ou4ape liesa(fa2urxm ;u0tlxo ieildlsDrauvs;(4arenif3oy1om e nvi t)srto(o nu4aptn netls)srrr(mpoo0aexomoeiatlsDel(vp;u0treomfctytlmD  neo;t seto(rpno4lmee fcsas) ruaxro;o4tlxo oeilt m em(mpn(4 exoifcoa1lp  ai s;t)srxoxopiu4al  lici ( arum( pnt0olt io3ilt m eauvpn()texnxf3oy1fmD aivs t0 rumir3nodll e ieiat arum(mo;u4aptomiciys a2ua(mo;u0 lerxr oo1lm r neo;t trurxmpoo1amtn nviat)aDuax onu0aeto f3ildfsDumnmp;(0 etomr3iotlpDrauvs;t0 2toiopny1omenlietat a2taxront0aeen feildla rauvp (4 rtoxfciydfpteaivi ()sexrxopnudapeemivs ( sDrm(ront1oexomictadlsDea(monu)aetoxfciadlat  nes;( trur(o io4am   fci () Dtrxm ot1apeoiieias s2ra( s (0trtrmo3ootoa raiesls  etm(opoy1lpt mietls)a2uaxr ot4oex  oetyd m2rlu o;u4
\ No newline at end of file
@@ -0,0 +1 @@
+uvs s t2urxmpiy4lm e fvtl() rtmxrpot4optn ieiyd aDea(vo t4artrif3io1optraueolt0truoio io1am   neil() Dtmur nu0tpe moeils mDrl(vsnt4alenxf tatlatr nvi t)tetm(r3iu4om  mivtat a2ra( o;t1alxomf3iydfs2ua(vp u0 rxoxr ty1lmDeln slt) rxoim3nu1lm nlnet ()sDtrur ;t1tlt io3tlsla uluvon(0aeenmocootfmt luvs t)truoxo3iudap nmfci s)arurxmpot0oexniietytlmDuanmo;u)tlerxocoatlaDelueo s0 2xr(o3oo1optnmfvias)arrm(rono4olxo ociydfs rmn ont4arxnxo3iodoaD au o;t)trtr(o3nu1amt lnvtatf rta(monu1tpeniiciaslsDemumon()aexnir3tadlmt lieo;s)teuoxm3oo4openliesasfsruaump;o0tle  i3iatfmDumump;t0altnirctadlat  ivsl()srxrxo oy4opt mieilt aDrrx onu0opxn fciysfm2elnms t)artrmr ia1fmteai o (0srtrxm ou1ol elnctlt  Dumxr oo1tetnmo3iyt m2el(vs;u0aexrmf3iodlmtraivsls teurxm oy4ol emncilt)sDtau pno4ope io3iyd a uauvs t4arxnxr iytfm rauvo;t0srtm(m3ou4lmte ncs sfsrrmx o;u1tet  octyt sDumumo u0aexrxfcoodop  anes ()trxoimpno4lleelfciasfs2ur(rpou1oltoiieilsfaDrlnmo u)trenxo io1fmtean i;s)t2xmimpiu4amt mfvt sf rrr(mpnu0openiicildla2umuvsnt0trerxo iotfat lues (0srxm(m iu4ome  fei s s2urxmo;o4tltomfciltla eau s;u4 reniociodfptrlueslt s2urxo io1apeelnetas) rrmxmont1aee iociydfa2umuvo;(0areoxr3iodomtrlies;s trtmirpiydaltnmfvsas  2urxrp;u0tlto i3tlt s2ul(ms;u)treniocoatla   ues;t setrirpou1am nlfvtas) ruru  nu1opt mfciadfa rm(vo;() rxrio3iy1fateluei s s2xmxrpnu1op nmics t a2uax  oo1optomfeiad a2umnvs t4artnio iy1lmD anei;s0sexo(opno4lp nliviatfa2rmumpnt4oetnioeild aDem(monu0 lxnxr io1fpDraivi s  etoim oy4om nlneiatf Draxmpnu1aexomoeiyd s rm(mon(4alxrmr3totopDelu o ()t2xrxm iu4lmee neils srra(  nt4tlxoioeiydfs2rlumpnu)tleomf oo1omtrauvol() 2xoxopou1omeelivs t)aDrr(mo;u4oeeomo3iadfa uauvs t0tetrmo3iodfpDe ivs ( setoxm iy1oltnlfvs tf Dururono1oleoiociydfs2rm(mpnt0texrxo3tytlaDelnvslt)seurxmpiu4ll emnetlsf 2rmxrpoo0tle iiciasfa uln s;t0aexoioctotoa e n o ()srum(mpoo1lpen iviat) ruaxmpnu0tet iicils aDumu p u0aetoxf3io1fpDeaiei t) etr(o iy1alt  fes tf Drmu  no1aeenifeilsfaDuanmsnu)tleoxr oytlm elu s s s2toxm nydlpee ivtasf 2ur(mo;t0opx ifetls mDrl(mo;t0 eeoxr oy1lpDe u o;s0 etmir iudop n nctlt srur(r oo0tee  feiadfm uanvp (0tlenmr ta1oa rai s;t  rtmxo no4amt lfeil(fsDtrxmpnu0oex  fctat s uluvo;u0alenif3oatlmDeauvi;s texmxr iu4lpe  ivsa()artm(mo;t0aleomoctlsfm ulumpnt0 exomfcoytfptelies s)s2umim3iodlme liesls sDrr( o;t4tpe ifcildfsDeauvs u) rxnmr3oa1fpD au i;s) rxoim3iydllt mictas) Duaxmo;o0tpt mf3tatlm2ra(vonu) eeoio3todfmDelieo;()s2tmxr3iu4om nmietls aDtrur ;u4tleoii3iadlm2eau o u4tlenmfcoa1fpDelieol() rtm(r iydom emfvia()s2tm(r ou0oltnmieiaslm2uanvo;t0tltnxr oatfmDeaues;(0trur(r3oo1amenliei (  rraurpoo4aeto ociysfm2el(mp;u)trerxr to1fm r ies t) 2trirpoy4olen ivtlt)aDumu p;o0oeeniociysfs emumonu0arenif3iadopDr nvs;()teum(m3iodaptelfctat) rrr(r nt4aeen octydfs eaump t0 exnmo tatomDrlivsl( t2xmiopnodolenlfctasfarrau  ou1aleo fetlt m2ua( s;t0tlermo3to1om e n i (  2tmxo3iudol e fvilsfarurxr oo4oexo iciltfa2ul( o u)aexoxfciatomte ieilt) rxmir nudoleelncias)s2rrurono1tee mictlt a2ran o (4 etoio3tydoaDranvo t)t2xoxopiodlpt  fetasfs2tm(mono1altn octytla rlnmonu)tetnif iatopt aivils) 2ur(o oy4alteliei s arta(monu4apto i3ildla2eluvs;(0tetnxo tydopDrln slt  etoim3oo1amtelfciatf 2rrxmont1ole  ictatfsDrau o u0tlxnif iytfpD aiei;(  rurio iy1lltemfesat) 2rmu ooo4tlx ii3ils s2elnmo;t4aeeomr ootfm  lnei;t)teur(mpnydlmenlictlsfaruaxr no0tlt ifctas s2ua(mp;u0artrmfcio1lp eaivo t0 2tmxr3ou4oleemfciasfarrmu  ;o4oexnmf3iasfs2emnvsnu)texrifctatlmDr u slt0s2toxo iydaltelfcilsfs2raxm nt1alx if3tldls2em( s u4 rtrxo ty1fm eluvslt  exrxrpnodlm nlfcs t) rtmxrpot0tltnmo3iad sDulnms;u)texoxfctotfp ran sls)teumxmpou1alte neil(  Dur(rp;u1ope  i3iltla ranms;u0 rxrif3totfaDe nvilt  rxoir3iodolenmfcias  rur(m no4oet  f3tldfmDemu snu) etriocoadfateaieols0 etoxopiodop nmnctlsf rrruro;u0aptnifctat a rmumo;()aleoif3iydlm rli s (0tetmxo oodop elfesatfarrrx  ou1aexomo3iydlsDuan s;(0texomf3iadfmtrai i;()srumiopoo4al nmneia()srtmxro;u4apeoifeilslsDeanvs;t)tetoio3iotlpD lnei t  2tmxr3oo4lmtelfvsas)sDrrurooo4tlxniieiydla em(mo ()artnif3ta1omD  uvolt)truoim3ou4ap n feilt)a2rm(m oo4olxoiieiydlaDuanvonu) rxomociodfm r uvs;()seur(m3ou4lpt mics sfaDta( p;t4oleo i3ils a2uln p;t4tetrmr oodoatelnvi;s srxrxmpnydlptn nesa( sDtrum nu4apenmicias mDemuvpnu4 eenircio1lmD  iei s) rxoir3oo4oltemneilt)a2tm(mpoo0tlt  f3iys a rl( p;t)trtrmo oy1fat lneslt seuo(mpiu1lmeemict tf 2umu o;o0optoiieiasla2uau pnu0trxoxo iodlatrlivslt s2xmio3ny1lpen iesl()sDumxm ;o1tpxoii3ilsfa2umnvpnu0 etnmr iadoaDraneo ()srxo(o iydam n ivta(f 2taxm no1oleo fciad s ra(vo;t4 exrxo ty1la rlneo;t srurxr3oy1apeelfes sfa2tr(mp;o4olt  ictytfs rau ont4tltrxfcoadlatr i i;( seum(opoy4oleelnetas  2rr(  ot1opeoifciasfa rau sn(4texnxrcty1opDe nvslt) eto(mpnodomen ivi t  Dua(ronu1aetoioeilsfm2rl( pnu4teenifcoo1omt auvo;()t2xoim no1alteliviasf Dtmx o;t1open feiyd aDrlumsnu4artomrctytfa r ivsls)tetmir3io4amtelivi sfa2tmx  oo1teto octadla2uln sn()trxoxr3tytfpDeli o s)s2tmxopoy4lmtnmict t sDua(mp;t1opto ieiydlm2eanvsnt0arxrxr3iodoaDeaivs;t0setoimpoudam n net t  rrax ono4teenioetadfs uanmsnu4teerifcto1oa rluei t0sexo(m3ny1lltemncsasfsrur(r nt4aptomfctasfa2em(mo;t)arxoio ia1op  anes t0trumio3iu1omt liviat) 2rmxr oo1optnmoeils sDea(vonu4treoxo3oytfaDr uvolt t2tm(o3oy1al n nciltfs2umum ot4olxn octltfs2eau p u)trerir oodlpDelueo (0texrxo ou1lp emnei s  rur(r nu1apto i3tls s rmn s;u)tltnmf3ty1oa r i i;s setriopnu1opte ictlsfsDtaumo;u0apxniiciytls rmu o (4 rxnmo3oo1faDeauvil(0trtmim no1op elici s)s2rrx pou0texo f3iadfs2ulu o;(4 lermf3totfmte neols)t2uriopiu4opeelfcsatfsDrau  ;u4alx  i3tyt m em(vp;t)treomf iytop  an s (0sexmxo iudapt licils s2um(m ;t1oexn f3ils a2rmnvsnt4 exnmocio1oaD ln o t0teto(opoudoltn fctat) 2raxmont4tetnmfeils mDelu p;() leomfcootoptranvs;s) 2trxopoy4lmtnmfeilt)artr(mont1optnioeiydla umumpnt0arerxo to1fpDranvi t srxmim oy4oltnmnvi s s2raxmo;o4alxn oeiat s2um(msn(0 etrir oa1oa elu il() rtoim oodlm nlnes t)sDuru  ou4olt ifciyslm2emnmpnu0 lxoio3oadla rauvo;s0sexrim no4apenmfes (fs2tr( ont1tle  f3iad m ea( o;(0tlermr iadopD aneils  2xoim3oy1lm e fcta(f rtm( ont4oeeomictld a rmu p u) lxrmr3tadfptranvo;t  2xm(o iy1ol   ici sf Dtrxmo;o0oexnmfciatls2uauvpnt)altrxociy1oat  ueolt0 2xrio iu4lmt lnviatf rtru  nt4alxnmf3tldla2rlnvsnu0trxoxo oydopteaivils)sruo(o3no1ap e ivsl(fs2tau  ;t1oex  i3ild sDelnvon() ltoirctytfatraiei;()t2tmim iy4lpte ivsa(  2taxr ;o1aee  f3tysfmDeaumo;t)aexoxf3iytlpD livi;t  rxrir iydlmtn fvt s a2tmum ;u1tpxo i3iatlmDemuvpnt0arxrmociodlptrlneol(0 etrimpny1omee icslt  2rmxmpnt1apxnio3iatfm2umuvont0altoxrcoa1fa e n s ( s2umxo oodape mnvsa(fartrx  nt4ole  oeiadfa2elumpnu4 exoirciadoa elues s)seur(opnodopenlnes t aDrmxrpot0aptomoeiatfs2rlnmp u4 rxrxo tadfatraues;s t2xmir nudol  lneta() rtm(mp;u4olxomi3iasls raumo u0artomfctydlmDraneo t setoim nodal emfvtl( s2tm(mpnt0tee  feiltfs2rlump u)tltnxo3tadop eauei s trumxmpno4amen nci (faDtm(rpno0tlenmieiysfm2rmn o u)texoxf3iodom r n s ()srxm(o oudol  lnvt (f rtr( onu4aee iictldlaDea(vpnt0 reniociadoptr ivol(  2xm(m3iy4omt  icsa(fa2ra(mooo4openio3iltls ul(vp;(4 eeoxr3ta1lmt lnes;() 2tmir iu1ap   nvtl( arumx p;o4alt mfctld s elnvp;t0aexoiociytomDelnes;t) 2tmirpiodop e nci ()sDtax  ou1olto iciad sDumn p;(0trtnxo3iotfm rauvi t  2xm(rpoodlpeemics tf Dta(m nt0aetnifciydfmDeau on(0 etnmocoatop e n ils) exrir iu4amtnlnvi sfsrtr(rono1olxoif3iadfm2eanvon()tetnio3tadop ran s s0 rtmim iu1lp  mfvtl( sDrm(rpoo4tleo o3tat aDrmu o;t4trtnxo3io1lmt lneo t0 2xoxrpiy4lle  fvsls) 2urx onu1tpxo fciytlm2eauvs u) etrir tytoa  aiesl(0 rumio3oudam e ieta(  2ur(r nt4tetn ieias a2uauvsn(0 renxr3iatlm elu s;t srxr(o iy1omt mnvi (fsrtmxmp;t1tlenif3tyd s2rauvsnt4altomr tytlaDr ieo t0 rurxo3oo1lmeelfei () Drrx ont0oeto feildfm2ranms t)tltnmo tytfm rlieolt)seumxr3nydapenlnvt ()sDtax  oo1openiictydla ra(vp;()aleoxr todom  lnvi;s  etm(m3iodlpe  nvt s)sDtau  ot4tlt  ictasfs2rau snt4treoxf3iotop  aneo;t)srto(m oo1olt  fes sfsDrmur oo0oeeoii3iyt mDrl( p t0trxrif3oo1oaDrauvs;(0 eto(r3oy1ap e ict (fa2ta(mo;t1aetomfeiasfs rl(vs;(4trtnmo3iydomt an o t0t2trio3oodamt livt sfa2rmur ;o0opt if3tyd a2ra(mo t4aeerir3iodopt lu i s0srxoxrpiy4ale  ivslsf Drrxrp;o4altniocilsls2raumont)arenio3iatlp  lnvo;t)t2toxo ny1lmeelfetasfsDrr( p;t4oltn iciltls2em(vpnt0artoif3iytla rlu s ( srtoxr3io4lpt mnvs (f 2tm( o;o1apxoioetatla ea(vpn(0artrxf oatop elu i ( t2toxm ny4am elics tfsruax  ;t1opx ifciys sDulnvs t)arerif3io1oa r ies () 2um(m3ou4optn fcia()s2ur( ono1oexoii3iltls2rmnms u4tetoxo ootfa e uvi s  eur(o oo4lm  mfeiat) Drmum ;o0tpto ocild s2umumon(0altnmfcio1fate nes ()texr(r oo1op e ivtl()s2ra(mo;o4opt  oeildfs umnvs t0 eenxfctatlmDean ils seum(m3nudlmeemivtls s2tr(m nt0tltnmoeildla el(mp;u0 rxnio iotlmtrai sls0setoirpoo1lpeelietlt aDtr(mpou4olx mf3iydla ulums u0alermf3oy1fm e ies;( t2umirpiydamt lfct s artrurp;o0tle  oeiltfa2eluvo (4 etomfcoy1oaDr n ol(0 eumxm oudaptemncilt arrm(  ;o1opxnmo3tad mDum(msnt4trxrmocoa1optrauei s0t2to(r ny4al elfeta(f 2tmxm ;u4opeo oeiatls eauvo () rxoxr3todfmDranei;(0trtr(opiydlm nmfviltf 2tau  no4olt ii3tas aDulnvp t4trenmo3oadla r uvi;()seumxmpnu4altemfes s  rtr(rpou0opeoiociatfmDrauvo;u)texrmfciydfp ranei s  eurim3iodaltnlfcias sDrmurono0oetoii3ias a2eau s t0 etnmr3io1fa  li sls0srtoxmpiodlmenlfci (farua(m ot4texnioeils aDuauvont)arenxo iatom ran sl(0 euoxr oudlmtnlnetls)sDurumpnt4tlenioeiltls ranvo;u0tetnxr tydlat lneol() eurxr oydal nlivsl() rururp;o1texomoeiyt s2rmumo (4trxnircootop e ivo;s trtrio3oydomte fcsatfs2tr(r oo1tlenioctls m ea( on(0 rxnmf3oatop e ueilt  2trxm3iodlm e nvslt  Dumxr no1tlxnmoeiltfaDel(msnu)texnxo3ootom r nes t)s2xmir nodom n nvs t)sDumxr nt1tlxn i3iys m ulu p;u4tlenxr3iatfpDelnei t t2trxr3no1amtn feilsfsrtm(ronu4tlt ioctlt m2umumsnt)tlenmrcoodom   ivo ( seurir3oo1am  lncsa(  2tm(m ;u4tpenioetls sDrmnvs ()tetoio tydfp raneols sexrio3io4apeeliesat) Dumxmpoo0tlx  feiadfa2uauvpnu4 lenifciodomtrai ilt0 2urxo3no1amt  iei (fsrtaumonu0tpe  fetlt s2em(vs (4 reoio oy1lpte nesl(0sruoim oo4lp   ivil(fa2ur( oou0tetoii3iys s ea(mo t4aexnir iydfmDeln i;s  rto(mpno1opee ivs (fsrrrum oo4olto i3iyd s ra( pnt0aetomf3todfmtraivslt)texrxr3iy4llte nctasf 2tr(moot4apeomoctytlsDuanvsnu0altrircoa1faDean i t0 rto(mpnudapt  nvsat) 2ur(mo;o0tlt iieiytfs2rmn pnt0trtoxo3iadomD luei t0s2xm(r nodoptemncils)s2urumpno4oee if3iasfs elnvpn(4 eermo oadoa  au o;s) rtm(opio1optelivi sfaDtaxmono0apxoioctlt m2umnmp;t)trxnmocta1fa eaivi () 2xoxo3iudal  lfvtlt) Drr(mo;u1tle ifciatls2ul(mo;(0 lxnxfciy1lpD li i;t s2urirpno1omenmfvs s  2umxr ;u0oleoioctad sDumu p;t0aeeomr iodlp   i i;(0s2ur(rpio4alt  ivtltfsrtr(r ;t1tleoiietyd a2emn pnt4 rxomocia1oatraiei s  rxm(rpio1ol   fcsltf 2rr( p;o0tlxo fetldlaDranmon(4 rtoir oodoateau o t)t2tr(opnudaptnlnvs t)aDuaur ou0opeoiieiyd m2uau s;() etnmo ty1fmD an i;(0 ruo(m3nydlltnmivtat  Dtr(m nu1opxoif3iad mDelnvo;t4aeenxf tatlaDe u i;s0sexrxr3oy4lle  iei tfsDtrumoou1aptomociytlm2umu pn()trtoxr3ty1laDr i s t0sruo(o iu1omeelneslsf Drr(ront0olxn f3iltlmDemnvp;u) lxomo todfate ivo;()t2uoxopno1ll nmfcias  rrau  ;o4opxomfctyd sDumums (0texomr iytlp ranei;(0 rxrirpiu1llenlieta( a2tm(mpot0oeeomfeild a ra(mp t4 leoio io1fp ean sls) rurim iy1alt lnvs (fs2rr(mo;o0tee ioctadls2ulnms u)treoif oatopD  i s;()sruo(r ny1aptnmfcs tfartrumpnt4optniieiysla emumont0 rtrmo tytfmDrlueo s s2uoxo3nu1aptelict s)s2rax  no4oexn fctad s uanmon()aetoxociodfmteau ilt)trtrxr oodomeelneils)srtmxrpou0texomoctad mDeau o (4aetrxo iadfa eanvil(0 rxmirpnodalenlfciltf 2rau  ou4texnii3tadfa2ulnvs;u4artnmo3oadlpD an i;t sexo(o3nu4al n fct ()arrmxrp;o0tpt iietaslm rm( ont0tltrifciatfm  lueo;(0srtoimpnudome  nvta(f rtm( p;t1ale mfeildfmDem( o;(0tltrxo oytfa elnes;( sexrxo3oodap nmfet t) Drau  ;o0tle if3ild a2elu s () lenxociytfatrli o (  exoiopny1lle  ivil( aDtax oou0tltoifcild m2eanvs u0 rxnmr3iadoat aueo;( srur(r oudoleelietl(fsrtr(roou0olen i3iydlsDul( p;t4 etnmr todfm raueol( sexm(rpoudop nmiesls)srua(ro;u4teenifciadls2ean o u4arxnxf3oodlm elnes ( teumir no1amtnmici tf 2tmuront4aeen fctytlmDuan p;() etomocoy1oatraieo;s) rumxr nu4amee fet t)aDtaumono1apx  oeilsfaDel( o t)texrir3oatfat ai s (  rxoim ny4aptn net (f Dtrumont4ole miciyd s2rau p (4 ltrxr ta1faD ln s s) rto(opoy4ll nmivilt aDrrum oo1texnmi3tlsla em( o u0 lenio iatfmt aneil(0t2uoirpiu1aptelfeiat)sDtrxm oo4opx moeiyslm elu p t4teeomo oytlat  ivils)truoxmpiy4amtn nvi s)arraxm ;u1tee  i3ildfsDrau p;u0 exomo3oy1laDr i il()s2xrio iy4ap emfvsa(farrmu  ;u0oeeo f3iadlmDrl( s (0 ltnxr3ty1oaDrauvo ()seurir3nu1aleemivt s a2uru  ou1aetomieils m ulnvp t4altomr oytlp e ueo (  2ur(m iu1ll elncsl(fsruru poo4aex iociatlmDrmnvonu4aetrif3iy1fa eai i s tetr(m oy4lm  livtatf Drrurpno4alxomfetlslaDrm(mp;(0tlxomf oo1opD lneilt t2xm(m io1lp n nvi t arrax o;o4alxomfeiytls rlu s t0aeeomf3totfptr u s s  2uoir3iu1ap emivs ()srraxrp;o1alxn oetydfs ea(ms t)aetriocoy1fmt au il(0sexoxopno4ol elnvs tfa2uaxmp;t0tltnmoetyt s2rau p;t)tleoxfcoytlptean i t  rto(o3oy1ap nlivsat  ruaxrp;t0texn ietys aDeauvsnu) rtnio iatfmD  i s t)trto(r3iy4ol   ieilt s2trxrp;o1olen oetysfaDum(vo u4tlxomo3todoptrlies () rtrimpoy4lmenlnetl( a2ururo;t4tet mictlsls2ul( s (0 rtrir3oo1fmtelnvs;s)trtm(rpoudal nlfes t aDur(rpnt0aetn i3ias sDeluvs;t) eerio3oatfpteanei;s  ruoxr3iodlpen ivia(fsrra( pou4oeenio3tadlm2eanmp (4trtniocia1fateln s;s0trxrxmpou4al   net sf rta(mo;u1oexn fctatfa em(mp;t)alerif oatlp elues t s2xoxopou1omeemncs ()sDtmump;o0tex mociys mDelnvo (4aexoxf3iytfpt anei;( seurxm3oy1ol n ivs (faDtauroot4openmfeiat mDrm(vsnu4 rxoxfcoo1fp  au o;t)srumxm oodlmen nes t) rtmuro;t4aetniociadlmDel(vp;t4altrmrciadfaDrlueils  rxmxr iu1apenmictlsf 2rauro;u0ale if3iasla rauvp u)trxnmr3oatfptr ues;() 2xoiopnu4ol   fcs (fsrum(mooo1tleo f3tydls rm( snt)alenxf3tydlmD aieils texmim3ou1lmtn nvsa(  rur(root1opx mf3tydfs uln p t0altnxfcoo1laD anvs;( s2xoxm3iydaltnlivt tf 2tmxrpnt4oeenmocias a2raump t0artoifcoy1omt  u sls t2uoxmpoodomenlici sf Draxmo;u1texoiictys a2emuvon(4aeenmr3todlm eauvo;t) ruoxmpiy1ome lnvtas) 2tm(  ot4oetomo3iat a eanmo;u4 lerif3oodomDelnvi t)seuoir ou1llte fvia(fs2tmu  ot4texomfcilsfsDra( pnt)aexrmr io1fa e u i t0s2toim3no1ap emfvtas) Dtaumpou0alx io3tatfmDuauvp;u4 rtnif3iadlm rln i;t)s2tr(m3no4lmt liei t)a2rmumont0openio3iytlmDrmn pn(0alxrxfctydopDrlnei t)s2tr(r3no1lmte fcil()a2rrurp;t4ole  iciatls rl(vpnu)aexrioctytla  luvils  2uo(r3oudlm nlncs ( s2umu  ;t1apenioetaslm um( pn(4 lermr iydop eaueilt)t2xrio ny4am emneias sDuaurpnu0oltnio3tltlsDeau s;t0trerif3oo1lp ean sl(0seuo(m3iodale mivsatfsDurx ooo0tltoii3tyd a ul( o;t)tltoxf to1lm eanes;t)tetoxrpou1llenmfeslt)srtm(rp;u4olxnioeiytla elnmp u)tltomo oydlateau il( s2tr(rpiydomen feta(f ruax pou0tpto f3iltfa2rm( snt4 renxr3ootoptrauvo;()seuoxo3io4lleemncta(  rraxmpnu4oeto i3iysfs2ean pnu4tlxoiocia1omDe ues s0sruoio3iu1lmeemieiat) rumurpot4aeeniieiatlsDua(vpnu) eerxociatfpDrli s;()t2tmxr3iudopte iesatfs2taurpnu0aetnmoeiat m2elnmpnt) rxnir oadlpD  n olt  2xoxr nu1lltemnesas a2rrx oou4texniieilsfsDrmnvpn(0texrxr3iatfa ranvils)t2xr(m iydale  ici s arurump;u1teenmf3iadls ulumo;(4trtrif iydlaD  nvi ()sruoir oo1al e fet t)arrr( ont0tptoifeiys aDrluvont0 reoxf3tatopte nei;t0trxo(r oudam eliesls a2umumpnt0apeoif3tydfmDul(ms t)treriocoatlptr i sls0 2xo(rpiu4amtelivslt aDrm(  ;o0alx if3iatfa2rlnmsnt)trxoxrcoydopDran ols0 etoir3io4aptn ieilsfaDuru ooo1tpeoioeilslsDuanmp (4 rtnxoctytfp  anvs;t0s2xm(o3iodoleemivsl(f rtmxr ou0tptnmoctatlmDemu o (4trxrxo ia1fatrln o;t texmio oo1ole  nesas sDrrurpoo1opx mieiltls2ra( p;u4 lxoifcoo1la  lu ols  rtm(o iu4openmncsl() 2rax  nu0teenii3tltlsDel(msnu4alenmo iotlate nei t0s2trxo nu4lle licils)aDrmump;u0oleoii3tldfaDel( s t)alxrmf oytlpDr i i;s0srtoxm nydalte ieslt)aDrr(  no1aexnmoetlsfs2um(vo t4 ltoirctydoa r u slt) rtoim3iodlmtnlfvilt srrmu pou4opt ioeiydlm2ulnvont4tleoio3iatlatrai ol(0t2urxmpiodlltemfeta()a2uaumpou4apxn i3tatlaDrln s t0 rtnxr3totfmD  iei ( t2urxrpno1optelnet () Dtmum ot1alt  iciyslmDrlnmo;t0 exrxo3todfp raivs;t sruoxopnu4ol n fvt tfsDur(r ou4apt  ietysla2um(vonu0 rtomf oadfaDraneil() eumio3ny1omtelfvsas sDta(rooo4tptoiictltfa umnvo;()aetrif totoaDeli ilt0seurxo3nudaptnlivsltfs2rr(m oo4aeeomfctysfmDulnms;t0tetnmo3iydomt lnvsl(0 rtoio oo4lm  mnesa(  rrrxmpou0aptoifcilsfm umuvpnt4artrmo3tydfmDe ivs s0trto(r3nudlltn fcs t)artr(roou4tpxomiciad m ua(vo;t0alxrmo iadfp  auvil(0 2toio3iy1amt mivt () Dtmxrp;t4tpt  fetat s rlu o;t4treoir3oodfpDeauei (0 rxr(o3oo1omenlncia(  ruau ono0oex ifciad a umuvo;(4 eeoirciy1fmte u ils0trtrxrpnu4al n fesltfsDtr( p;t0olen ieias a2umnvonu4aetnxr3oatlatran olt0 euoimpnodlp elfvtas) rraxm ;t0ole mieilsfm2ranmpn() ltnxrciadla rai i t trxrxr iodlptnlnvil() Dtrumpnu4ale  o3iytfsDul(mo t0 lxnir3oodla  aivols  2xm(o nu1lltemneiasfartmxrp;u0ole  oeiasfm ul(mo u4 etomf3to1oa rlnvsls  2xr(rpoydol nlietl()srtaurpou1alx mociad aDrmnvo t0alxoxf3todoatr ivs;s s2um(r3oo1lme mnviat)srta(roou0oexo f3ildla uauvp ()aetoio oodfm elnvi (0 etoxr3nu1ap  liei ( artrur nt4oltnmfeiadlm elnvsnt4alenmociytfmDelu slt0t2umxm3oo4lle mnet t sDururpno1olt mociasfm rmnvp u)aexnxf3oytfa elivi t0t2toimpny1lme  nvt ( aDta(r nt0teto octldfm2rmuvp;u)tltoir iydoateauesls)texr(m3iudopee feslsfaruaump;u4tpt  oetys sDelnmpnu4artnmf oytlptrln o;(0srur(m oy4oltn fvils) 2ua(ro;o1tpx ifctytfm emnmpn(0 exnxr3iytlmt luei;s0 rum(r io4am   nct (fsrururooo1oee  ocils m2rmumpn(4tetoio3iadoa eaieo s s2uoxm3oodapte fesat aDta(mp;o0aeenif3tadls2rmn s;u)trtnio3ty1oatrlu o;(  etoim3oy4lpenlictas)a2raxmpou4oeeomfeild sDumnms;u4 rxoxo3tadlptelneils)sexo(rpoo4lp nlivsasfarraxmooo4aleomiciasls2eauvonu0texnxrciy1lm e iei;t0 ruoirpoy4al elivtlsfs2tr( ont1tlx iocils m uau o (4tetrmf3totopt lu i;()seurio nudll  mfetatfs2rr(  ;t1ale  ocils mDea(mo;t4 rxrmo3iadlpDr ues t  rxrir3ou4ol elncils srrrur ;t0tptn i3tltlmDranvpn(4tlerxr oo1lm rlneo;t0trxmxo3iydllee nctls  2taxrp;u4tlenmf3tas m rlnvs;()teeoxo oy1fmt ln sl( setoxo no1llt  fei () 2tm(rpnt4ape iociatls2ulu p;(4 rtoif3oydfpt an o (0 etrimpnodlleemivsat s2tmu  ou1tpxn ietyslm uanvo t4 leoif3oo1opD auvi;(0trtr(mpiydlmte ies (  rtm(mp;u1altomoetltlmDrm(mp u0 eerxr3todopDranes;s)teumxo3nu1openmietl( aruaxmp;o1tet ifetasfm ra( p u0 ltnxoctatlmDeli ils0 exoir3oy4ap n ivsa(fs2rrxmp;u4tptn fciasls eluvo;u0alenircoa1fa elneo;s0 rxmxrpnu4om   iei tfsrur( oou4apeomo3iyt aDran o ()tleoif3tatfa raueo t)trurim3iy4ol emnvs ()aDraump;o0tlx ifctyd m em( p t)aetrxo3oydfpD  u s t0 2toxo3oudlmenmfciasf 2tr(m ou0tlt mictls a em(vo;t4treniocia1fm e u s;t t2umirpoo4amt mnet t)sDraxmono1aptn i3iyd a rln s;u)aetoxrcoytlp elivo t0sruoxr nudap e ictat a2ta(r ;t4ole ii3tys a uluvo;(4alxrmo3iatomD  uei;t t2ur(m oy4op   ietltfsDtmxm ;u4apx mi3ildfaDemnms;u0aeeoifcoy1fa  anvs;t s2xr(m nodaltn ncia(fsDtr(monu0oexn ociytfa2emuvpnu0trtrxf3totoaD lneo;(0trxoxo3io4lptelfesa()a2rmxm ;u1ape  i3ildlm uanmpn(0areomr3ta1oa elivs;(0 euoxm3oodole mics tfsDur(mo;u4oex  ieilslaDemnvpnt4 etrxf3oytla eln sls0srtrxo nydom  mictlt sDum(r ou4tptoiiciydls umumpnu0 lxoxo3totop rlnvo () eum(m iudllt mncsltf rta(rpot4opeomf3tldlsDel( p (4aetrio3iotop eluei;t0trxoimpny4amt  fct s)aDtrum ;t4olxomoeiatfs em(mp u4texnmo todoate iei;()t2xo(opiy4omen feil() 2uau p;o4opxnmoetlsfmDemumonu4treoxocoy1la rli s t truoxo iudll  micias  2tr(rpnt1olxo ociytfaDra(mp (4 eenir3oy1faD  i i () rto(opnudom  lncsa(f rum(moot1opxo f3iadls rlumsnu)trxnir3oo1fat  nvi t)s2uo(o iy4ameelict tfs2rrxmont4olx ioeiadls2em( o;u)altnmf oytlmt lu il(0 rtrxmpno1lme  netl() rtaur ;u4alxnmf3iatls rlumsnt)areoxr iydom e nei;t  exoxm no4al nlicias)arrmxmooo0tpxoiietls aDelu snu0trtomo oa1lm raues ( srxm(o iy4altnmfct t  2uax onu1alenmoeiyd a eauvo ()aleomoctytla e ieo;t truo(r3iu1al  lfctlsf rrrx ont4optnif3ias m ulump ()trtrmo3ia1fm  liei t setrxr no4olt mfcsls sDum(ro;o1ole  ociadfm umnmont) reoifcoydlaDe uvo s0seurir3io4apenmfet s s2rrx o;t1aptoifcildls rmnvsnu4alxnmrciatlm  ln s s srxm(opno4ap n icias) rta(mpou1opxnifciyd a2ul(mo;t4artnmrcoodomteluei;s  exmxm ou4lpeemicia( sDtmxrpnu1olxo ieildfa2eanvo t) ltnxr iotla e ivi;()t2xoxmpoo1am elnctls)a2umu ont0olt mictyslm ul(mo t4 lenmoctydoa e uei;t t2uoiopnu4optnlfviat sDurxm ;t1opt moeiad s ua(vp;u4tltriocoa1lm e i s;s sruoirpoy1lp elfct (f rrm( oot0ape mf3iad aDrln snt4aleoir3iytlat  i i;t0trxoxo3iu1lm e fvtls  rumx  oo1alt mietatfaDum(vo;t) rxrxo ty1fptrlivol( t2toxo oudomte iviat) Dumu o;u4oexnioeiytfs ulnvs t)aeeoif iotlp elnvol( teurxopoy1omenmfcs s  rumurp;u4ale iieiat sDumn p;t4texnmo3iydomDrln i;(0 rtmim3iudopt lfvt (f 2uax oot1alx  o3ildls2umu pnt4aetoxrctatopDelieol()t2uoimpnydamee ivs t srtax o;o0aptniietys m um( p;() exrmr tadoaDrlu i;(0setr(m3iudlm emfcsltfaDrrxr nt4oex moctldlaDea(vs u4artrxocto1oa eaues;s  eurxrpoo4omt  ictlt artr(rono0tpto ieiytlm2ra(vo u4aexnxr ootfpD  u sl(0tetm(rpnudlp e icsa(f Dur(moot1tptoioetasfa ul(ms;u0arxomfciydop   nvo s texmim nodomt  ieias)s2rrxrpoo4ole  ieiydfs2elnmo;u)tetnxr3tadlmDelnes () etmxm oydome  ivsa( srtrxrp;t1tex if3iltfmDrmnmp;u0tlerxf oydfa elu i t teur(m iy1opee fei tf 2rmxmoot0teto f3iadfa umumpnt0trtnmf iydla raieols0 etrirpou1ome  ietltfsrrm(mo;o4opto fciysfm uanvonu0texrxo oydfptrlnes t0 rtmirpiydop e nvia(faDtmxmono0tltnmf3tadls2emuvpnu4trerxf iatopDranvi ()s2xoxo3iy4lp nlfetasfsrua(rpno4alto ieiyt s2rm(mo;(0 rerir3iotfm r uvo ()s2xrir3iudapeemiesa(faDra( o;o1oetoifetysfmDeanmo;u4tltrmfcoa1fatelueo;s) rxmxm iy4ll nlfet ( aDumurpou1oeeomfctyd a rmnmp;u0 exnif3ty1fmtr nvs;s teurxrpoy4ole  ivi t)sDrrxm no1apto fetlslm2um( p (4aexrifcio1fpD ai ilt tetrir3nydlpenmivia() 2raum ot1tpt  fcilsla2em(ms u)trtomocty1lmt  i o;s)srxmir oo4aptemncta(f Dtr( ont1texoifeiaslaDumnmp;(0 ltoxoctadoptraivo;t0seum(opiodlmeelnvsa( arua(moot4tee if3iyt mDean o;u) rxrmfctadlmD aivi ( texrir ou4op  lfvi s)srtrx  ;u0oetn fcildlaDulums t)trtnxf3tytlp r nvs;t  2uoio3oodllte icsa( a2ra(  oo4tetomoeiysfsDrmu p u4tltnmr io1om eln s;t) 2xrxopnu4ame lncslt)a2tm(  nu4opt mo3iys a rmn sn()arxomo3oytfa r uvo;( t2xrxopoudlptemnesasfs2rr(  ;u1ole mo3iaslmDeanmo;u4aexoir3oo1fmDranvi t)sexoio oydap nlnet t sDrax p;o1tleomietydfs2eanmo (4tleomrctotlp r uvsls) rumxopiu4altn ieiltf Dtruronu1aetnmfeiadfa2eau pnt4teerir3oy1oat  ivi;s0setoimpio4ap emfcilsf 2tr(moot0tlx  f3iad s2rl(mpnt0alxomr3oadoptrlu s s0seurio iydaptnmictl(farua(r nu1optoifcilt m2ea(vp (0teenir3io1lm rln i;(  euo(opiodlpt mncta(fsrtmx  nt0ole  oeiat a rmn o;u0aeenxr iydomD au s;s)trxoxrpiodlltn fvtls  rtr(m oo1tleomoeiadlm2ul(mo (4arerxo oytlp rai i t) eum(opno1lltnlnctl()sDrm(mp;o1oex  f3tltfs2rmums;t4altomocoydfa r neo s t2xm(rpiydlm  lfvias)arra(mont0altomf3ils m2emuvpn(4tltrxr tytlptrluvil()truo(m3iu1lpen ietl()aDuaumo;t1apen ietlsla rmnmpnt)trenxocio1oa e iei;t0 etrio iydll n fctlt) 2ra(moou1tpxniictys s uluvs;(0texrmrcty1oa  liei;(0trxrirpiy4opee nvta(faDtmump;t0apx  fctytlm eanms;t4tlermf3iotfp  an sls)s2uoio iy4ol  livt t)sruaum nt4tpx mfciltls emuvon(4altomoctadoaDrlnei ( srxrxm3iy1op elfcslt) 2urx  nu4alxo oeiatfa rmn s (0 exnif3tydlm  li o;s0s2tr(r3iy1lm  lfcsl() 2ta( pou1opxoifcilt a rau s;t4aleoir3iytfpDrln i;(0 2xr(o3iy1ll e ivias)srtmurpoo0olx  o3iadfa2elnmpnu0tetoxo3oydfmDrlieo (0s2xrxmpnudalenmnetlt) Dtauroou0oex ioctat s2eln p;(0 lerio to1omDe ues s0 rtoir3nudlltnlfvslt) 2rrurp;u1oltnifctydfs2em(vsnu4artomrcia1fa raivs (0t2xr(r iu4omeemicils)s2tmx pnt4tpx mociys sDumnms (4aeeomocta1fmDean s;t0seur(r3nudamenmncs (faDtmxr ;o1apto ociltls rluvp u0altnmr3tydlpDeai il( t2xoim3oo1ame  nct (  Duru pot0open oeildfaDran o (4 exomrcoodfpt  uei (0srur(o io4om nmiei ()srumu oou0tpeo fciytfsDelnmo;t)trxoir3tatlaDr ieils)srtr(r3iydop emfctat)artax onu1aetoioeiyd m eluvsn(4altoxocootopDelueo ( s2xr(m3nydameelnct sfarumu o;o4aexnioeilt s2ulumsnu)aexrxocta1lp rlneo;s srumio oydape  ieslt s2uaumo;u1tltomfeiysfsDumnmpn() rxomo3iodlmDrln s t teuo(m3iy4lpe  fesl(fa2ra(mpnu1olxn oetadlaDea(vo;t0treoxfciatopDe n s s)s2xoxrpiu1lltemivt s)s2rmu p;u4alxniicilslsDeln s t0aeeomf3ia1opt anei ()sexrxmpiy1al nm
\ No newline at end of file
@@ -0,0 +1 @@
+i ol( trxm(opoo1amt lfctat)srtmuroou4tpe  ieilsla2uanmp;u4aeenmo iotfpte i slt)srxrxo3ou4optelncs ()aruau ont0alx ioetyd a2ulu p () ltrxociadoptrli slt0t2xm(m no4op n nesls)a2tmumono4aet  o3iysfmDea(mo;(4aeeoif3oa1fmDeaueolt0s2trio3nudal e fctltfsrtmu pnt1oeeniiciytfm2emums;t0artrmo ta1omDrli i;s)t2umirpiy4lptelfet s  rum(  nt0alx  i3ias a2uluvsnt0altnir3iy1oaDraivs t) rxmxm3nu4lme  iesatfsrrax pou1alx  ieild a2ul(vo t4alxnmr3totopDe neo s0 euoxr3iy4olt lfes sf Drrxmooo1tlt  ietatfa rau s ()tetnmr3oy1fmt auei t)s2ur(mpio4ll n fetl()sDurxmpou1apenmo3iltlm em(vs t4 etnxf3iy1lpte neslt0s2toxm iy4lpt mnvt ( s2urx  ;u0opto feiasfs2umnvsnu0alxrxr3to1fpDeln ils texrxm ny4opee nvil(f Draxr nt1oee mi3iys a2rmnvs;u0 lenio ty1fpD anvols0seto(opoo4op nmncsls)s2rm( pnt1olenif3iyd aDua( p ()aetrxr3ty1opte ivsls t2uoimpiudlp emivs t arra(mp;u1aexn f3iat aDua(vs ()arenmr iotopt auvo (0s2uoxrpnu1olen fcsas)a2uaxmo;u4teeo ietlslsDrln s;t)tlermr3oy1oa e ivs;(  2tr(m oodal nmnvt sf Drrxmp;o0oleo ociad a2el( p;u4 ltnmr3tatlaDeauvi;s seumxo nodopenlict s)srum(mpou0alt  i3tlslm2uau pn(4tleoif3ty1fptelu ol() 2tm(m iy4am e fvt ( aruru o;t1tpe mieiatlm2rlnvont4artrmr3iy1fmDraiei t)t2uo(m io1altemnvslsfsDum(moot4altoioeiys a2em(vo;(0 reoircto1oat livo;() exoxm no4op n fcta()sDurur no4olxn f3iatfm2uluvo u4 exrxo3iy1lmD livi;t  rtrim iy4al  mietl( a2uau  nu1aptoio3iasfm2uaums;u4 rtrxf3todoatrai o;t0trtm(m3nu1olenlncta(f Dur( oot1aee iociytlmDelu o t)tetoxo oo1oatelnvslt truoxo3nu4openmieils)aDurumo;t4oleoii3tltfm2em(vo t)tlerxrctodomDeaueo t srxr(o3oydlleemfvs t) 2ua(root0tlxomoeiadfm ulu p;(4 lxoxfcoydlp r nvs s0s2toio3ny1olee fcils) 2rr(  nt4aeeo i3tatfsDrm(vp;u) ltoirciatfp e nes s trtr(rpiu4ol nlieiat a2ur(ro;u4open ictld a ua( s (0 exrmrcoy1omteau o;s)sexr(r iy4ale licsas  Dua(  nu1tee iiciatlm eanms;t4teerifciytfat  uvsl(0setr(r3ny4lm   iesl( s2trumo;o4tlx  fcildfaDrmnvo;t0 eenir ta1fp elu s (0 2uoir3oodlpe lfcsl( s2ua(mo;o0aetnif3ias a2umuvs;() eeoxrciotfpDrluvs (0trto(m3nydol   fcias a2ta(ro;o4olt ifctas m2em(ms t0aeerxo totopDrln o t  rurxm oo4ol  lncsasfa2umx o;o4tetnmi3iatlmDel( pnt4 lenxf3iodopD an i () eurxo iy1ll emfciatfsDtrx p;t0apxoifctlsla ulnvs ()tetrxr ootfp elu s s0s2xoxr oudlpe mict t)aruaxmonu1tle moeiytlaDulnvp;(0trxoxociodoateln o s)srurxm nu4opeelncsl() rrmxmp;o1olenmociat s2rm(vp;u4tltrxr3oatfaDr ivs ()sexriopoo4alen nvs t  ruaump;o1teeoioctyt a rmumo;t4tlxoxrcootfa rai s s) etm(opno4om e ict () 2trurpou1alen i3ilt a2ua( o;u0alxomr3oy1latelu s;t sruo(r3iu1lpenmici t  2tm(rpoo4opx  f3iyt aDul(vs;u4tltoio3iotfpteli ol( trumxo nu4llt lfct sfsrtau pno4tlenii3ildlmDumuvp;() eenxf3iodfpDean s t)srxr(m oy4amte nvilt srta(ront4aex io3iysfm2umn o u) lenmrciodomte u i s0sexoxopnydlle lnvil(f 2rrx  oo0aetoiiciadfmDulu o;() exomo ootfmDelies;(0 rxoxm iu1lp n nvilt)aDtmuro;o4aeen f3iatlsDrmumo;u)aetrmociy1op   ies s)t2toxopiu4apt lnei s) Dumuro;t1aptomiciysfa raumsn() rtoircoydopt luvs;t0sexoio3io1optemfes ()a2ta(r ;u0tlx iiciytls2rl(mont4alermr3oa1fptelnvil(0tetoimpno4am elfci (  2ururpot4texo f3iadfs2elumonu0arxomo3io1faDe ivolt t2xoir3oudomeelfetl(faruax o;t4optn o3iadlm2uaumpnu)trxrir3tytoa rau s ()t2xo(rpiodamtn ncs () 2taxm ;u4alenif3iytls2em(msnu4tlenmfciatoa  an ils0t2xo(o oydlpee fesat  2urxront0aee ioctytlmDrluvs;u0 rtrir3iadla rlivs ( t2xrimpiudolenmnvslsfsDra(moou4alx mociad s2umn p t4altoio iadlp  aneo;t0trxrxmpiy1lpe lfes s) Drmxr ou0aet mieiasfm2eln p u) exrif oytfaD  ivi s srtrxr nudlp   iesl(f Dtr( o;u4tpeoioeiasfa2ra( p;t4aetnxf to1om  livol()s2urxm3no4ll  livtlt) Dtmur ;o1tleomi3tytfm2ul(ms;t0 rtoiocto1op  anei t) rxoiopno4lpee ictls  Drrx  ;u4apenio3ilslaDrmnvsnu4tltnmfctotfaD aivols0srtr(rpiu4op elfetas) rurx  ;o4aeeo ocildla ea(mo;(0 lenxocoydfaDeaies s)texmxr3nu4opee nvsas srrmu  ;t1tpt mf3iyt a uanmo;u)teenmf oatlpD ln i;s sexoxo ny4lpeemfct (  2urxrooo0altn feiltls2elnvo;(4altrif ootlpD lueslt tetmio3iy4olt lfvtltfa2rrumpoo0oee miciadlmDel(ms;t4 etnmf3totlaDrlueslt)tetrir oudlptelics (f rrrumooo4tpenmoeiyd sDean p (4 eenio tytlat ln sls0tetoir3no1ome mfes t  rururont4aeto fetlslmDumnms;t0 eermo iatlp e ues (0 2trxmpnu4lpe mici t)srur(mp;o1opx  i3tat s ea(ms u4texrxrcoa1oaDraneo ()teumim3nodop nmnctatf Duax onu1aexn fctadlm ranvont)tltoio3iytfm eai i ()seuo(o3iu1op  mnvsat)srtrx oou1tptn i3ilt s eanvp;u4alerxo iadop elu i ( s2xr(o iodol elfeias aruauroou4teto ieiysfm2ra(mp ()treniocoydfp e ues;t texm(rpnu1lmtn neils artrxmoou1alxniieild a2el( o t4 lxoxfcootom rluvsls)t2umir3iu1lptemiciat) rrrxmpnt1alt  o3iydfs2rlnms u4arxrirctatlp raivi;() exoim3iu4omenlicsa( arua(  ou1tpx iociltfsDemumpnt0 rxnif oa1fp  anvs;(0srumxopnydomee ivt s srumumoot0alxnmo3ilt a rlumpn(0 lxrif iytomtrlueo s0 2uo(mpnu4am e fvtls srtrxm ou4opto ieilt s2rl(vo u4texoir totoat  i o;t0t2tmxo oudaptemfci (f rtrxmooo0tlxnmfciatlsDulums;t4trtnxocoydomDeai i ( t2xmimpio4am   nctat) rtmx p;o1olx mfeiaslaDrm(vpnu4 lxrmf3oa1om  aivo s) rtr(m iodoltn fctat sDrr( o;u0olenmi3iasla rmums;(0alxrio todop  lu s;(0s2xrxrpoodalenlncslt artm(mpot1opxo fcias a2elnmp ()arenio3iy1faDr uei () 2urxrpno4ap n fesas aDta(roou0aee ifciyd s emn s;()artrxoctatlmtrai sls  rxmxopiu4aptnlfctat) Dtrxrpnt0tpt io3iyslaDum(mp;(4 rerxf3iy1op  aies;( s2tmxopiydameelfcslt sDurumoou4aee ifeilt s emnvont4alerio3oy1lpDr ivs;s s2umxr3ou1opee icsas srtr(  oo1aex ioeils m elnmo;t4 rtrif todlp  anvo s srtr(r iy1lltnlicils)s2tax  ;o1opt iietys s2umuvs u4treoxf to1opDraueil(0 ruoxo ny4omte icta(fa2taxm ;o0olxomoeiad m2rmuvp (0trxomr todopt  u ils) rto(m ny1apenlnei (fartru  ;u0aptomi3tld s umu s t4 etrif3oa1opt lies;( t2tr(mpoudamt mnvias  2ra(rpou0tlxn ociatfs elnmp;u0 lxrmfctodlpD lu sls0s2trir oo1lp nlfetls srrmu pnu4tee iieiltla ulnms;u) exrmo3oodlpD an o (0 2to(mpoy4lmen fesl()srra( p;o1oex miciat m rmnvon() etnifctadfmtr ivi;t) rxoir iy1am nlfcs t aDtaum nt0tlt mictatfsDeauvpn(0aeenmr3oadlm elnes;s0trxmir ny4amtelnctl(fa2rr(r ;u4oeeomociysfm2ea(ms (0alxoiocto1faDe ueo s)t2ur(m3io4lm nmnvta() rtrurp;o1tlt  f3tatlm2rm( o;(4 reoxf3ty1fm e nvsl( s2xrxo iy4lmtn ncia(  rumxr nu0ole io3iat s2eaumo t4trxoxr todoaD  i ilt srtoirpiy4ap e ictatfsDtrxro;u1teeoiicildls2elu onu0 exomo iatoat an s;s) rum(m3iu1ole mfvtas a2urxmoot0opeo i3iltlaDeln pn() reomf3iotfmDeln s s0srxrir3iu1ole livi (faDtaxront4oex iociat s2ra( o t0aleomfcootfpt lnvs t)t2ur(o3io4omtnmnctls aDtrx  ot4aetnmf3tytfs ua( ont)trerxr3ta1omDean ils srxmim3oy4lmee ivs t)sDtaxront1oetn oeilslmDuluvo (0trtnxocoodopD lnvils0sruoio3io4lltnlneiatfa2rm( poo1tex ifeiydfm2ulnvs u)trxnmoctytlpt an o;t) eur(opno4lleelfvsat) 2urxrp;u1oet mictasfs ulump (4arxoxf3to1lmDeaivs ( setrxo oodalt  nct ()artmu  nu0apt iictadlm2raumsn() leomoctatlmD  iei;( srxoxopou1om   fvs (f Dtmurp;t1oetoif3ild mDemnmsnt0aexoxrctodfm  livs;()trurxm3ou4op elnctls s2rr(moou1tee  oeiyd mDumnvp;u4alxrif3iotfat aueslt setm(o iy1op n fvi s)s2tmu  nu4tpxomfeiltlsDrauvp ()texoxr tytlmte i o;s) rur(m oodal emfci s aDrm(  oo4aetnio3iadls raumont4 exomo3iytoaDrluei;t  2ur(m oo4ap nmietlsf Dta(moou0opxomf3tltlmDumu o;t4teenif iytlaDeaneo (0t2urio3nudlmenmicsltf Dtru poo1tpe mi3tydfmDem(vs (4 ltoxocia1lm e uei;s)s2umirpiu4amt mfetlt a2ua(mp;u4aptn f3tydfa emu o ()tlxnxr ootfpD  nvo;(  2tmim iydapt lneiatfs2trx pnu1tee  oetat m rmnvs (4trenif todlat luvils)s2xo(r nu4ll n ivi () rtr(  ;u1oee iietltfm rauvp;u4tlerxfcoy1fpDelieslt  2to(o3no4lm  lnei s)arum(rpnt1oex iictlsfsDeauvonu4aexomr oy1fptelnvils0s2tmxmpoy1ll nmnesasf rrmu ooo4texoifctldfsDea(vp u0texrxo3oydoa eau ol( trtm(r iy1lleelnctat)a2raxrpnu1tetomiciat mDrmn pn(4 exnio3iotlp eluei;t0 2uo(opoy4aptemivtas  Dur(r ;t4tlx iiciytfmDum(vpnt0trxnif iodfateaieslt0tetrim3nudopteliei (fsDrau o;u1tet  fctad m2eanvs u) rermoctotfaDe ies t0 rxrxopoo1omeemfeilt srtax pnu1aeeniocildlm umumpn(4altnxf tadom eaivols0s2xr(mpiu1lmtemfcs sfa2raurono1aeeoiociyd s2emnmsnt) lerxo3ootop rluvils0 rtrirpnu1lp emfes tfsrtrurpnt0teeo o3tlt m eaumon(0aexnxo iotfpt lu i;s0 rxrxm3nu1ope mnes (  rtm(root1aetoif3iytls ra(vo t0teeomoctydfa rli s t0 etoir3no1opeelieia()a2um(  ;o4openio3tadlmDelnvo (0tlxrio to1faDr nvo;(0texmir nydlp e ncs s sDtm( o;o1tltn fetysfa2rlnvs t0tltoio3ta1fmtelu ol() 2uoio3nu1ale lfvta(fa2tax pno1altnif3tadla rl( snt)tlxoxf3ty1lat aieo;(0s2tr(r iu1ap nlfetl(f 2rmxm nt1opxo i3ilsfa rl(vpnu0tlermf totlmDelieo t t2xrxr nodoptnlivs s s2raumpnu4opxo ieild sDem( p u)aeerxrcty1fmt  n o;(0 rtrxo iodop nlfes ()aDta( oou4tlt iocildfsDemnmo;t)texnifcootlmt aueolt texrxm iy4opeemictat)aDtrx ooo4opx mieils a2el(msnt4 rxoifciytomDe uvi s)trxoimpio4amee netlsf 2tmum nu4oeenifeils a2uauvon()arxniociydfm eaivsls  ruo(o ou1omen feslt  Dtm(rpno0apt mfctasfm2rln onu) lenifcootom  auvol()teumim oydame  nvsas  2umuro;t4oexo ociltfs2ulnmo t0 renmf3iy1op rlnvils) rxrim3io4lp   fvta(f Dtaum nt0aexo f3iatlm2ul( o;u0 rtrxo tadomtean o;s0s2xr(o3oodlmen neias) rrax  nu0tlx mf3iadfm2rlu s (0trtoxo tydop eau i s)tetrimpno4ll  mnetl() Drrx ont4olx if3iat m ua( s;(0tlxoxf iodfmtr ieo;(0 rxoirpnu4lm n ivs t srtm(root0opt  oeiytfmDuanms t)texrxo3iodlateaivi t0 2toiopno4lme mieta(  rrm( onu1aetomfctls aDuanvp ()arerir ootfa  ln i (0sexrxmpiu1amtemieta(fsrumxrp;o0aeeomi3iyt a2emumo (0trtomr iotomtr ueolt0trxmim oo4alen nci sfa2rmu oou4alxo o3tytla rmn s u4 ltnio tatfa e uvi t0t2xo(o oudamtn nci sf rrau o;t0open fctlt mDeau onu) rxomr tytlpDe nvils t2tm(r oy4lme mfeilt)sDtr(rp;u0aleniieilsfaDem( snu)altnxo3iy1fpD au o t0setoxr3nudapt  ivt (  2trur ;o1opxo octytlsDuau p;t4 etoirciodlm  lnei;t0srxrxo3io4amtn ictls) Dta(mpoo0alxnmoeiad aDua(ms () eenif oydfptrlnvol() 2toim3nodapt mivtat s2ta( o;t4tltnii3tydfm2rl(mo;t) ltrxf oodlmDe ieol()t2toio3ny4lltnlfvsa( a2taxm ot0teeoio3iasfa umu s (0 renif ootlm elueo (  etrxm ny1am emicil(fsDtau  nt0tpe  octls m2um(vo;()altnxfcoa1lpD  ivs;t)sexoxopoudap nmictls a2rrxrp;u4opxnioeiys s em( p u)arxnxr iodfp rlnvo;t)texmxm io1ol e fvs t) rtrxmo;t0tpt iiciltfaDum(ms u0 rtoxf3ta1lpt  nvo ()t2urxmpnu1omeemnvs s  2tmx pnu1texoif3iat a2uau p u) lxoxo3iotfptr nes s)t2urxmpio4llt mnctls s2rmump;u0oex mi3iyt aDum( p u0alerir tatlm rlivils)t2xmxrpnu1ol emnvi s) rrm(mpot0tltoiieias a2rl( snu4 eenmo3tadlp elnvs;( t2xoxr3ny1olt  icil(  2ururonu4aee if3iyslsDelnvont4artoio ty1optr n ilt  etoiopoy4lmtemivi tfaDra(roou1apxomfeilt a2ulnmo ()tltrxf tydlaD aieo (  2xoxopiu1lm e fetas a2raxmooo0altoiicild a2rm(mo;t4trenir ia1lptr ues;( seuoxr3oo1ol n ietas a2uaurp;o4oeeo iciydlm2ra(vo;u4 rtniocia1lmDe i i s  rto(rpny1ame  nvtasfaDtaxr ot4tptnmi3tltlmDeanms t0arxomr iodoptelivi t0 rto(r iu4apen neslt)sDurumo;t1opxn f3iltfaDua(vp;(0 rxnxo tydomDe ivo ( t2tmxmpio1altemietat aruaurpou4opto o3iyd a2rauvpn(4 lxnmociotla e ies s0 rtmxm ou1alt  nvtltf 2tmxroot4oee mo3iysls2ea(mo;t4tlxriociadlp e ivo s t2uo(mpio1am e ncias) 2ua( p;o0ale  ociad a2eluvp;t0arxnxr3iodfatr nesl()srto(mpio4op elneia( arurx p;o0opeomiciyd m ulnms (0aexnmo3oytoa e neols  rurio3nu4lm n feta(  rtmump;u1ole  oeiadla2raumo;(4texoif3oy1lpDeli i (0 exm(mpny4altnlfeia() 2raxmo;u0tpenmi3iytfaDel(vonu4 renmr3tydoaDr uvilt  exoxm oy4opee ncias sDtm(  ;u4aee miciasfmDulu sn(4 etnxf iy1fmtrlivi;t setm(m no4olenmnctas)a2rmump;o0tpx moctlsfa2elu o;t)trtrmo3iatfmDr uvo t trum(opnodope mfeia()arururonu4alxoii3iysls2umnvp;u0 ltoir oydlm rlnvil(  exrxo nu1lltn ictl()arrru  ot1oet  ictldfaDranmp;() lxnir tytlate i i t t2urio3no1lltemnvs ()srur(r oo1aptomieiadfmDua(msnu)aeeomf iatfatrauvs (0t2tmio3iy4lltelfvi ()srum(ront4opxniietadlm uanmpnt0 ltoiocoadop rluvilt  rxmirpny4ol  livsls) rtaum ;u4tetomoeiatls emu o (4tlxnmo3oatlp rln i;t)s2xo(o3iy4ape  neias  rumu poo4tlenif3iadlsDran snt)areoio3iodfptrau i t)truoim oydolenmict ( s2rrxrpnu1tpenmf3iyt s ulu snu4tlxrif3iadlm  aivi;s t2tmxmpio1am elicsa(fsDrrurp;t0tptniietyt m2emu snu0artnxfcoytopDeluvi (0teuoxm oodomenlici t srraur ou1tet iietasfm emu o t)arerxr3oa1oa rau sls)s2trir3nydamt  fvs ( aDrmur ;o0altn fciydfaDul(vp (4 lxnifciadfatrli o t0trxr(mpio4omt  nvtat aDtaxmpnt0tet mieiadls umu s t0tetoio to1fm r ivilt t2tmxm3iodapt lfesl(faDtr(mpou4olen i3ildlm emn snu) rtnxrciatfpD  u i;s)trxmxr oydapen ies sfsDtrumpno4tee ii3tltfa2ul( s;u4alxrircoy1lmtrlu slt s2toio3nudole  fetlt sDtmumoou1apt  fcildlm2ra( ont4trermrciodlpDrluvs t)sexr(o3nudomeelnvils srrrurpou1tlen ictadfsDean on(4 ltoirciydfmt li sl() rxoxr iy4op emiei tf rum(mo;t4tlx iiciat a ean p u0tlxnxo3todom rli sls0s2xmir3io4lm  lfeias)a2ua(mono0tpxnifeiaslm2ean p (0teerio tydlm rli s;s  rtr(opiodop  mietas a2rrx pnt0texomf3iad aDumuvpnu4altoxfcty1late ues t trtm(m3oy4ap  mfctls) rururpou4alxnmociatfs2eln pnt4 rerxocoodoptr u s;( s2uo(mpou4apenmfcilsfsDrmu ono4aetnioetysfs rmnms (0tlermo oa1op r n o t texo(o iudolenmnvsat srum( ooo4tex mfetltls rm(ms;t)aexnmf tydlpDrau o t setm(o io4ll   nctlt s2tr(mpoo1aet ioctad sDem( sn(0trtnxr io1lm  aues s)s2xmio oydome mncs tf Dumx  ou4opeo oeiasfm2rm(vsnt0 lxoxr io1faD lu s s) 2uo(opoo1omte ncia(  rur( ooo1oeeo feiad a rl(vsn(0 ltrxf iytomt livol( s2trxopnu1amenmicil( sDumxrpot4ope  ictatls2el(vpnu4 reriocoy1late nes;t0 rtr(o nydlmtn fctat  Dumxmonu1tpx mociyslsDul(vo u4aexnxr oy1laDrlieo;t0 eurim ou1lmt  iesl()sDrrxmooo4aeeoii3tltlsDul(ms;(4tlxnircoy1fmte neilt0trumirpoudomtemnvi s sDtmumpno1aee if3iasla2rl(mo;u)tetoxo3oo1lpDrlnvols0teuo(mpnudll n fvs sf rtrx o;u4aexn fcils m rmnms;u0 lermo3oo1omt anes (0 2tr(r no1om n iesasf rraxmoot0opxnmfeiyt s ua( o t)trxrmr iydfm  aieo;s srtm(m3oo4op elici (fsrua(m ou1tlt moctadlmDel( pnu0aleoiocoytlmD aivs t0 rtm(o3nu1om  lnvtlt) Dumumpnu1tltnmieiatlm emuvp;t)tltoio3iytlmDraivslt0teuoir3ny4ame lfvta(fa2ur( p;t4teeo feiyslm2rlnmo t0 rtniociatom ranvs;s0t2toimpio4lmen fvias)srrruroot0tpe ifctat aDuau p;(4teenir3iytlpD  i ol( s2uoir iy4lp elnei t)srrmxront0openioetatlm2umums u0alxomr3ootlmDrau slt0 2xoxm3oudol nlfesas)s2ta(mo;u0tex mo3iysfsDea(mo;(4artomf oo1laDraivi t)trtrxo oy1ll nmfeiltf Drrxmono4aexnifctydfa2ea( snu4tetnir3oydoptr neo ( t2toim3ny4ll emnvilt)artru onu0tleomoetyt a uanmp u4artnircta1lptr i o;t) 2xr(m3iy1ome lfet sf Duax o;u4alxnmietyt a ua(vs () exoifctotopDran ols0s2urim3nu4omenlfes tfsDtmxm ;t0opxn ieiltfmDumnmon(0 rxrmf3iy1lm  auei;t  etm(r3oy4omtnlfvt sfs2rr( o;t0oee  feiatlaDum(vsn(4tlerir3tydfptr ueol( srxmim3oudol  mfct () 2uaum ;t0olto fctyd aDrm( snt0aexoir oatfptelu i s)t2trxr3iy1lm elics t)sDra(ronu0alenioeildlm umumo;t0aetoxo tadlpt au o t)srxmir nu1lme  nvia()aDrax oou4tptnmfctltla emnms;(0areomf3oodfpD lnvils)s2trir3oy1olt mnesls)aDtrxrpnu0tetoiieildfa uln s u)trtrxf3oodlmtelnvs s)sexmim3oudomen fctat)aDtmuront1tpxn fetatla eln o;(4 rtnio todlmD  i il(  rxo(mpnydom   fvi tfsDraxmpoo0tptomo3iltls ra(monu)arxnif3oodopDeluvs;s0srumxopoydlp  mivs sf 2ra(rp;o1olx io3tltlaDelu o;(4tlermf oydfpD lueo;s  rxm(o ou4al nmfvtl()srum(mp;u4aet moeiatla ulu s;() reomr3tytfpDranes;t0 rxmirpoodoptn nei tfsDrmx onu4opx moetydlm ranvsn(0tlxnir totfpDr neo () rtmimpiudol  lnct (  2tm( o;t0teeoioeiad m2umu p () etoxo totlmt livs;t0 exr(r iu1alt lfcilt  rrmx  ;o1altn f3tltfs2rln o t4tlxnmfciatfa   i i;s)trxmio nu4lp  lieia(f Drau  ;o1tpx if3ilsfs eanvpn(4tltnir3iydla elnes;s0 rtm(r ou4lltelicsa() Drrur oo1apenifciatlaDumu pnt0trxnxfcia1fm eluei t)t2to(o3iydole  nct sfa2ra(  nu4opxnmf3iys aDrmuvp;u0teeomf3tytoptelu o t0t2xrim3oo4lmenmieilt)srurx p;t0tex if3iatlsDeau p u)aexoif oytlpDelnesl( seumio no1lp emfet sfarum(mpnt0tlt mi3tld mDrmuvont4 exrxo3oatoaDraivs;s) 2xoim3iu1ol  lfetls)a2ua(  ;t4olt mi3iat sDrmn o;(4alxrxf to1fmt auvolt0 exm(m3nydoleelfvias artruront1tptniicildlm2uln o;(4 ltnxf iodlm r neols0setrio3oodomee fei (fartmurpot0apx mfciytlm rau pnu0alxoxoctadlaD  neilt0sruoxm nydape mnct ( sDrr(mooo0tle iiciadlmDran pn() eerxr oa1fmDr n i;() 2tmxo iudamt lnci t)a2tru ono4optoii3iatfs2ra(vo;(4trenirctadoatr nvs;s teum(o3nodop elneslsfsruru o;o0oetn oeiydla rlu pnt) rxoxo3oatfaDrauvol(0 rur(r3no4ll n ieilt s2tmx pot1tpt  fciltlaDrmuvo u0tltoxf oytlp elivsl( t2urimpoy4amtelicsls)artr(  oo1tptomfetysfs2el(mo;() renirciytfmtrlueil(0 exmxr3oydol e nvi (f Drmumpoo0tpto oeiyslaDemums;() rxniocty1op  ln sl()s2uriopoydol emiei t a2tm(ro;u1oetn feildfs ul( o;u0 lxoiocoodfmD au i;t) eur(mpoydalt lfvt t)a2ururonu4altnioeiydls rm( pnt)tleoxrcoadfpDelu s (0srtm(rpny4lp e iet ()sDtax  no1ape mieiytfmDranms;(0aeeomf tydfp  lnvs;t srtmir iydlme  ivta()sDumxr oo1tlenif3ils aDel(mpnt)aetrir3iadla elnvs;() etoxopio1omtnlfcilt sDtmu  nt0tlen i3ild sDemnmp u)arenmrcoadlmt lueols0s2tmxm oy4lp emfcilt) Drmx ooo4openmietys mDelnvo;u4tetnmo3oytom eau o s0 rum(r3oy4am e fvta(  2rmxm oo0tlxo f3tytfaDuaumo t0 lxrxrciadlp  lueolt)srxmxr3iu1apeemnvi t sDrr(mp;o4aee moctyt a2ul(vp t)texrxr3iytoaDrli i t) 2tmxo ou4ll e ivt sfaDtr(mpot1openmicildfmDemuvs;t4artrmo3todlmteluvslt  etrir3io1ap elfes s)srrax o;u4ale  f3iltfm2uln s (4trtnir iodop raiesl(0 exmxopoydap  lneta(f 2rauro;t4opeo f3ilsfs2rl(mo () lenirctadla rli s;t0trxmxo
\ No newline at end of file
@@ -0,0 +1 @@
+i i;s  rtrxr iy4lp elfctlsfsrraxmp;t0opt io3tat m rmnvpn() rxrmr3to1omDrlu ols)srxrim nudalenmiviasfartm( p;t1aeeoioetyslm2rlnvp;()tltoxf3iytoa elu il()teurio oy4apt  fvs sf Duax oot1oeeoifciadls2uanmo u) eeoxf3totomDelueilt sexoio nu1lm e iciltf 2rr(mpno0opt if3iltlm rauvp ()texnmoctodfmteanvs;t)srur(o nudlmt mivil(faDumxmoot0aet mieildfmDrm( sn(4aetoif3iydlaDeli ols)sexr(m3no1ap   nvil(f rra(m ot0tet  oetldlmDrlu s;t)texnmf ta1lpDrlnvi;t) etoxm io1ll elfeilsf Dta(rp;t0aetoio3iys sDrln s;t4aetrifciotfateanvslt0 2urir nodlp e feiat)a2ta(m oo4oetn ieiadlm ranmp;t0arenio3ootlm   ivs;() rumxrpiy1al n nvsat)sDumx ono0ope mfciadfm umu o;(4 ltnxfctatfpD auvo ()teuoiopiydap emieilsfsrtax  nt0alxoif3iad aDel(ms ()texomo3to1lpDe nes;( texm(r io1om   ivs ( arumu o;t1tpt  fcildls um(vonu) reoir oa1la  li i ( tetmxo3iu1llte ietl() rrmxmpoo0tptn i3tadls elnvp t4alxnxocoo1omte n ilt) rumio iu4am elieils  2ra( p;o1aleo f3iyslm umn o t) rerirciytlate ivo t)t2tr(o oodamtn fct s sDum(r ou4apxnmociydlsDuanvs () lxrmfcoodlmtraivols0 rtrxr iu1oltnlnciltf Dtr(m nt4tpxnmoetlsfm2ra(vs;t) exrxrctytlpDr u o (0tetriopou1lme  nvi t) Drrxmpoo0ape moetld m2rmums;() lerxr3tadoaDeaneo ()sexoxm iodlp emfviatfarurx pot1aetomoeiltls2em( o u0artoiocoydfatean i t) exmxo io1al e ies ()sDumxr ot0olto ictatfs ea(monu0trtoiociytfaDelu o (  rtr(mpiy4lmtn ivs () Dur( pot1tpx ii3tyslaDelnvs;t)altoir iytfmD  n s (0trumirpoydameemivt t) 2rmxmoou0oetn fcias s ua( o;u)tltrmr tydfm rlivol() euoxo iy1lmen ivt (fa2tax p;o0alen f3iydfm rauvp;t)artomocoo1lpDrluvil() etrxrpiodalenlivs ()a2urxmonu0ope mfciyd sDul(mpn(4tlxnmo3iadlaDr uvi s  2tm(r iy4opt lfcil( srrr(rpot1ope  o3iyt mDua(msn()tltnmrciodlmD  n o t0s2urio3oodolen ivia( aDta(root1tlen oeias m elnms t0artnmrcoa1lat  u ol()t2xm(opiodope mnei (faDta(ront1aetnif3ilsfsDrlumo (4 rtnmrciy1latrauvols0sexm(m3nydlltnmictl(fsDrmur ;t4teenmf3iatfs2ranvonu4 ltoxf3iodfp ean i;t)teurio3ny4ol   neslt) Draxro;t1opxoioetyd a2rmnvon()tleomr io1fpDelivo t0 etmxr ny1alenlnesltfartaum ;u1tpt mfciydfs emnvo u4aeermfcia1lmD an s;s0s2trxopoy1alee fctas)aDumumpnu0ape mietaslaDulnvp;(4trenif3oy1fatraneil( srxrir oo4ll elnet s sDrrx o;u4texnmociyslm2emnvs;u0 renif3ty1lmt liesls  rtr(opiy1lm nlici t  Dtmuronu4olto f3iytla rlnvon(0texrxo3iatfmDraneilt  rum(o nu4aptn nci sf Duauro;u1aptoio3ilsfs2elnmp (4tleoxf ta1om   n s;() eto(o3oodop  licilsf 2ua(roou1tex mocilslm2eau s;u0 etoif3iotlm eliei;t) 2xoir3iy4olte ivsa()aDumumono4tlx  f3iyd aDrl(ms;u0 eeomfcio1fp  lu i t0 rxoim iy4olenlivs s) Dtaumonu1oetomfeiatfa rmnvo;u0arxnio oy1faDe neils0 eurirpou1lp elnvtat  rrmu ooo0apt mietltfs uauvs;u0aetnxfcoy1op r ueo t setoimpno1lltemnvt ()a2rm(rpot1apxn feils s2ea(vs (4tltnmr3ia1opDrlivo;(0 euo(m iy4lpeemfvsa(  Duau o;u1tetoiietlsfsDrmuvp u4aleoxr3oa1faD livo;()s2urio oo1lle  fvsltfartmxmp;o4tpx mociasfsDua( p (0trtnxr iotlpD  uvol()t2uriopiodlmtn ivilt)sDraump;u0tpxoii3tlsfaDuluvs;(4 lxrio oytlaDranvols0 rxmirpoy4ameemicsls arurxmpoo1tlen icils a2emn p t) rxrmo3todlm   u s s t2xm(o iu4altn fvs t a2ra(ront4olxnmo3iltls umnmsnu4trtrioctytlm  aueo s teto(rpoo4oleemnvslsfsDrmu  no1tltn ictys m ulnmo u4artomo3ta1fpDr u s () eto(opoy1amee ieiatfarrmxmpnt4alx io3ias mDuluvp u0tleomr oy1oa  lneilt)trxm(m3iydll  livt () rtaxm nu4texn i3iytla ea( s;t) etoxoctydlp raiei s) rtoim3iy1lmeelnvia(fsrta(m nt0oleoiieils s eauvon(4 exrxr3iadlmt  neil() rum(o iy4al nliei t s2trxm ot4tet iociydfs2el( s;t0 eermfcoy1lptraueo;( t2uoxopnudlm   fvilt arrr( pnu1oleomoetlt m ua(mp (0areriociatomt ai i;s)trxr(mpno1al nlfet tf Dtm( p;t0olxnmo3tlt a em(mo (0trtoir3totfm  auvs;s  2uoxmpoydaptelnvsl()s2taxmont0tpto i3taslaDra( p;() rxomo3iodoa   nes;s)srumxm iy4ll emfviat)srtm( ooo4tetnifeilt aDum( o u0tltomf ty1lmteln i (0srxmxo3ou1ll nlfeias)artmxmo;u0openmfctlslm rln p;t0tetrxo3totfa e nes ()setrxm oo4lp  lfes (fsDtm(mp;o4tetnmfeiyd aDelnvpnt) eenmrciydlm  luvolt0trtr(o nodopt lnetl(fsDta( pot4tpeomfeiyt m eau p;u)aeermo tytfm   nvs;s)teuoxo oydal n nes (faDrr(m nt4opxnmfeilt aDeln s ()texoio3ia1fptranvsl(  exmio ou1ameemfeil( s2uaxrpot4tlto o3tadfa eauvp t4aleoir oytomt  ivslt0t2xmim nydlp emneias) rur(  no0oex if3ilsfa eln p;t)tlxomo3ootopt anei;t)srxmxr iydap n ivia(fs2raum oo0apt  o3iytlm ulu snt0teeomfcoytfaD an i;t0 2xo(r iu1ap emnvsl(f 2rmurp;t4aeenmictlt aDuanvsn(0aexnio3oadopD  neo;t0trxmxopnu1olt  ieia(  Drmx  ot0texomf3iadfa2uanvs ()aleoxfctotopDr i i t srtoxo3ny4lm e nvt (faDrr(rp;t1apenmf3ias a rlump (4altrmf iotfmDraivi s)tetmim3ou4ome lncta() rrmu  ou1aex ioeilsls rlu p;(0 etoxo3oa1fmt ln ol(0 rxrir iy1op e ict ()a2rrx  no1oex  ociltfm2raums t0artomr iotom  auvo t srumirpoydol  mncsas)sDuaxrpou4aetnmf3ils m rmn s;t)teeomf3oadomD aivil(0teum(m3iudop nliesat) Drr(ro;t1tex mietaslsDrluvo;u) lenmo3oytlmDeaiei t s2urirpoo1lme mieta( a2ua(rpot4aex  f3iadla2ul(vo;() exrifcoy1la   n s;s) 2uriopoudlmeemncilt)sDraxrpno0apt ifcilslmDul(vpn(4tlxrmr iydfpD  iesls0 2umxr nu4apt  ietat)a2umu  oo1olen feiydfsDelnmont) renir iadlaD aivo;s0srumio3no4amee neil(f Drr(mp;o0tlx mi3iyd a rm(mo;u0 lxrxr oatfm rlneo s0 2tm(o3iu1om emncia()sruru pnt0tle  i3ilt sDeaumo;u0 lerif3todopDranvols) 2uoxr oy4omtn fci sf Dtr(mpot1tpeoioctad mDumnvp t0 rtoxo3ootoptrlnvslt)trxrxm nodamtnmicils aDrmumont0aptoii3tysls em( s;(0tetnxr iatfpDranvs;s) 2toxr3oy4lm  mfvias)aDtmx  ;t1open o3tasfsDeanms (0 eenxfcootlaDeaivilt0trum(m3io4om nmncias)a2rm(r ou0teeomfciatlsDumuvp;u4trtomfciy1omD aies ()trtrxr oodalt mnetlt  Dumx o;o4tlx  ietad sDrlumon()tlxnmfcta1opDr uvolt seumir iodolt mnct sfsrtrurp;u0aeto ieiys a2um(mo;(0 lxoxr3iatfmt  nei s srtrxrpiu4lmenlieil()aDuauro;u0aetnifciad aDelnvs (4trtnxociadlm   i o;( seumirpnu4aptnmfcias s2rr(mpou0oex mfctatls2uaump ()alxnxf ia1om eaues t srxmimpno1ame lnes ()sDtrx pot0tle  oeiytfm ul(vo t4texoircoa1opDe neilt0setoiopnodole lncsas  2urum ot1tpt  icils aDumuvs u0aetomfctydfm   nvi s)t2xrxopnu4amtnlfvslt  Drr(root0oeto octytfmDra(vs t4 ltrio3tadlmDe ivslt t2umio3no4om  mfet (fs2taump;u1tee ii3iatlsDumuvpnt)treniociadlatrlneo ()teur(o3no4om nlfcils sDrr(  ot1alenmo3iatlmDumnvp (4altoxrciatlmt anei;s trumimpou4lpte icsa(  Dum(rpnu1alxnmiciyd s2um(vp t) rxrmrcty1faD lues;s) eumxo3nu1apt mfvt tfs2rm(r ;u1tlto o3iydfaDrmnmsnt)tlxomo io1fpD  ues;s0srtrir3oy4al elncs (fsrrrurono4opxo ieiyd aDeanvp t)teeoxociydfpDelu i t0srum(r ou1al n ics tfartrxrooo1apx iociyslsDel(ms;(0 eeoir iy1oat  iei;()s2tm(o3oudoptelfvsasfs2uaxrono0teen i3ilsfa2uln s;(4 renmfciytfmDr ueo (0 rtrxm3no4ap  mnvsa(  rua(mp;t0tpeoioctyt s ua(mon(0trtrmr oa1oat  u s s)seumiopoy1op elfvsa(f rraxmpnu0teto ieiytls rmumo;() rtoxf3todlaDelu i (0 exr(m iu4ol nlncsls artau p;t1alt  feiyt mDrmu p (0trtoio3oy1fpt an s ()sexrim nu1om  mivil(fsDuru ooo1oetn f3ilsla2rmn s;() eerir3ia1lm   uei s  rur(r3nu1lm n fvta() Dur(rono1oexoii3ilslsDuau o;(4aetoir oytoatraneols t2tmxopnydale micia(  Dtr(rp;o0oex mfeiaslmDrlump;t)alxrif3oodfaDrlu i;t0s2uoxo ou4altnlfciat)a2tax o;u4alxn fciatlmDulump;t0 ltomr io1opt  ies t0 etmimpio1lm  mnvi ( srurur ;t4oet ioeild mDuluvs (0trtomr3todfmDean s t srum(o3nu4amen neslt) 2rax  ;u4tpt mo3iadls ulnvp (4arxnxf tydomtelnvslt0 etoir3oy1altemfes (fartrumo;u4apenifeias aDran s (4tetrxr3iotlpteau o;(0 rtr(rpoo4olee nvta() Duaxm ;o0aleniociydfa ua( p;t) rtoio ty1faDeaneols0srxmirpnu4omtelicils)aDtr(ro;u0alt  o3iatfm2rau o (0artoif oadlat au i () etrxo no4altelnvslt  Drrxrpot4tpt miciatls2rl(mo;(0aexoir3todopDelivi;t)srurir iu1lpte iei tfsDrrxrpot4alx mfctysla umuvs;u)artnxo3tadopt  i sl() eto(o3iu1lm elivt (fsDuau  oo1aee ii3iad m umuvp u) exrxr3iotfp ean o;t0texoxr3oudome  nviltf 2uaxrp;t4oltn octadlm2emn pnu)aeeomoctydomDraiesls0 etrirpnydlmeemfcils)s2tax onu4oexn iciatla2umnmp ()aetomf iatfpD aueols srxmxopny4ape  ictl(  rtr(rpnu0aptnif3taslmDuaumo;(0 etnmo oydfp raueols  exmim3oy4ameemfetat a2tru  ;u1tpxnmfeiadla2uaump (0 eeoxr iytoat livs;(0 2tm(o nodlm   nvsa(  rua(mont0optoif3tysfm rm(vo;u) rxrmr iotomteaues s s2umir iy4omt lnetl(f 2uru pnt1optomo3ils s eanmsnu)tltrmf tadoa   ivslt0tetrxr3iodam   ietltfsDrm(monu0alt mfciyd m rmums;u4altnxr3tadfateln sls0trto(m3nu4omt mfvs t) Drau p;t4tlx ifcilt a2elnvs ()areoxf to1fpDr n olt0t2xm(mpoydam emivilt  rrm( ooo1tet iieiyd aDrmnvp ()tetoxfciadopte nvo;t  eum(mpno1alen fetl(f Durx pnu0teeo octls s2ulnmp u4artnxf oodfm eanvolt0 ruoimpiodam  lfeilsfs2umxrpoo0opeomfctltfmDeanms;u4aexnio3oodopDe iei s) 2toir3oo1ap nlicsat aDrax  ot1ole ioetysfa emnmon()arermocoytfp ranvi;(  rxm(mpiu1oleelnvt tfaDrau o;t4tlxnmieiltfm2umnms t4 eeomfcoy1fpDrluvi t) 2xmim no1omte ivsas a2umumono1oltoiictys mDra(mo u4texnifcty1fmt li s;t0teuoxm oodllen fcils  rtau  ;u0oet  feiatfs2rlnmpnu4tetnxfciytfpte nes ( sruoxr iu1apt livt t  Dtm(mo;o4aeeomictyt s2emu o;u) exomfctytfmD anei t tetr(rpiydlmee fesa(fsDrru  nu0oetoiociys sDulu p;(0tetoir ta1oa   ueo ( s2urxmpio4om   iet ( s2ur(  ou0apxomieiysfm rlumo;(0alenmf3to1fp r n o;s0s2ur(o oydoptemnvs s srtmxm no1opxniieiadlmDemn p u) reoio3oa1la e ies;s  eto(o oy1olt mnetas  Dtrumono4opeoifctldlaDrau s (4 lenif3iodla rln o;s)trxmiopoodlm   netat artrxr ;o0aetnifeiasfa um( snt)trtnio tydlatrlueilt)srumim3iu4lmenmivs t) rraumpou4tleo fctyt a2ulump (4 eeoxf3oatlpD  n s;s) 2uoio3io4lmenmfesat)aDrm(mo;o4aet  octyt aDuanvsn() lenxr to1op r ieo;t  2xmxo oy4ol  mieil( srumu  ;t0aexo f3tadfa2ran o;t4 eerxf oytfmt au olt truoir iudll   icsl(  Dum(mono4tle ioetltla emn o;t0tetrirctydoaD auvs t0sexmxopou4optnlnes tf 2urxr ou0alxomo3tltlsDrmn onu)alenmr3iytlmt  nesl()trxm(r3oo4om emnctlsf 2tm(  ou0tptnmfeiad m2el(vs (0tltoiociy1fptrlivo t0trur(rpny4al e ict tf Drm(mo;t0tptn f3iatfsDem(ms;t4aetnif iatfpDr i o;s0 rxrxr3iydllte icslsf Dta(ronu0oexoiociytfmDea(vpnt4trtnxr iydoa rauei;t0srtmir3nu1alt  ncsasfsDrmxmpot1oeto i3iadls ua(vo (0 lxrmo3ia1fpDeaueils  2tmxopiodap nmfeils  rtaxrpnt0teen f3iatfsDul(msnu4tetnxfcia1lm ran s t0 rur(mpiu4lm elfeil()sDuaurpno4aex  fciltfm2ua(vsn(0 rxnmr3iydfat aies;s) rxmiopnu4llt  neiatfa2raxm ;u1oeto oetatfs uauvo t0artnmocoy1omtrli o;s  rto(o3nudlle mnvsasf rra(ro;t4tlx mieildfsDea(mo;(0aexnxrciy1omte ueo;s0s2to(mpnydal emfeilt a2tmumpnt1ope mfcias aDrmnms ()texrmo tydfmD lues t t2tmxopiu1ll nmfciat s2trxroot4tlxoiieiys m2um( ont4altrxfcoytlpt liei;(0s2trir oydol  mfet t) Dtmxrp;u1tpt ioetydlm2ul( snu)texrircia1fa r u s;s)trto(m3oydlle lfes sf rrru o;o4opxnmietyt m rm( p (4arxnxr3iydfm rauvi t  etoxmpio4lme micia() 2rmurpoo1apen ieiytfa eau on() eerif3oytfatrluei s) 2xr(m io4am n ivt ( s2rrxro;u0ope miciad sDrlnmo;t)areriocoo1lat an s t)s2xm(o iudlm emnctas)a2ua(ronu1tltn ieiyt sDelnmp u4tetriocto1oaD aieil(0seumirpio1ol  lncs s)a2ur(  ;o0tpt  ietadfa2eluvo;u)trermfcto1fp r n il(0sexmiopio1omtnlicsat aDumump;o0aee ifeiyd sDea(vpnt)teermf3iadoat lueo s trtrxopno1aptelncias  Drm( p;o0alx mfctld a2umnvpnu)aeeoxr oytlmtrluei s0 exm(o iy1lm n feilt srtrump;u1aptnifeiad a2ran o;u) rxrmfciytfmD an s;t0sexmir oo4ole mfcsasfsrtm(mo;o1ope mieiys sDrl(mpnt4altrxr3oo1faDeln i (0s2xo(mpoudole mfes t)sDuau ono1oeenifcildlsDum( onu4tetoir3to1fp rlneolt0trto(m3nu1lmt lfes (f 2taxm oo0tltnii3tad s2ea(vp;()trxoxfcio1fp   uvsl( srxoimpiudlptemieslsfsDua(rpnu1tptomf3tlsfs2eanvo;u4artnxocoo1oaDr ieils  rxoimpoudamt lnetat srrmxm ot0tptomiciatls2uluvo;t4arenxfciodfpDran i s  rxoio ou1ape lieias) rrrxr nt0opeomoetadls um(mont0arxoxo3ia1op r uei s texrimpno1aleelfvi s  rua(rp;t4tlxomi3iasfaDrlu pnu4 rxrxrcoytopt anvo (  2tr(opny1aptnlncias)aDurur no0tpx mocilsfs2eln pn()tlxrxocoatfpD  n ilt0seuoir oodllen fesa(fa2umuro;o0tlen f3ildfmDemu o;u4 lermo3iatfpD livs;t)srtr(m3nodop e netltfaDtru ont4olt  ieias mDrmuvo t4 lxrmf3oodfm  auvil(0texo(opoudllenmnei sfs2trumoot0tltoiieiyd a ra(vp;u0alxoxo iytoaDe uvs t0tetr(o nudam n nci t)arumx o;u1tet mictlsfsDea(ms;u4trxrir3oadlmDr uei;(0 ruoxr3iy4am e nvsltfsrrmurpnu0oee miciydfm em(ms;u0trxnmr ty1lmt  ieilt s2xm(o oodal  micia() 2rrx p;o0opx  oetyd s2eln pn() eeomocoy1fm e ivolt) rxm(o ou4omee fvsl(fsDtrx ooo1apx  o3iysfs2rlu s u0tetnxocoydop  ln ol() exrimpny4lpenmivslsfartaxrp;u1oleomf3iydlaDrlnmon(4trenxr iytlpD  u s t)t2tmxo3oudlme lietasfarra(rpnu1opt ioctyd m emnmo;(0 eenmrctadoa eluvo;s trxoxr3oydamt mneta( aDurum nt4oet ifeilsls2rauvont)alxoxo3io1om rluvil(  2toimpoy1lptnliesls sDua(rp;o0tlenioeilsls rmn s;t4tlerxrctydfmtr i i s0srxoirpno1ole mneiltfsrtau pno4optoif3iadlaDemu pn(0 exnif ootom rlnvi;() etmxopiy1ap nliesa() rtru p;o0olenifetyd a um(vpn(4alenio iydopDrau i;t) ruo(m iudll  mfcsa( arurumono1oleomf3iat a2ulnvs;t0trtrxfcoydomt  uvil( seuo(o oy1apt mivs s a2tr( oot4apeomo3ilsls ea(msn(0texnxocoodlpt  ieo s s2xo(o3nu4om nmfeiat)sDumumono4optoii3iasfaDran snt)trtomfcoydlaD aieo;t s2toxm iy1lm   fesa( srrm(mp;o1apx  iciatfs2rmnmo;()aexnxr3iatoaDelnvi ()s2umxm iy4ol   fvsltf rrrxro;t4aeenifctatlm2umnmpn() lerxr3io1lp eliei;t)srtoxr3nu4alte ivsat)srtrxmpot1opto fciyd mDem(vo;t0arxrio tatla raivi s  2xoirpny1om emfetl( aDta( oot4olxn feiaslaDea(msn(4arxomo3tatfa r nvi t sexr(m3ny4lptnlivil(faDta(m ou0teeomfeiytfaDrlump;u)trtnif tadoptelieol(0trxoxr iy4lm e nvi tf Dra( o;t1oleomf3tyslm em( pn(0altrmf3oodoaDe uesl( tetoxrpiy4am   ies ()arur( pno4optnmfciytls2rmnmp u4aleomo3tadfaD au ils)t2uoiopny4ap elneia(  Drmxrono1tet  ociysfm2emnms;u0tleomr oytoaD aivo;t)s2to(r iu1lmenmnvt t sruaxrpno0tpxo iciadfm2rmums;t0arxoir3oadlaD  ivi;(0 exrio3iudll   iet (f Dtaum ot0tleo ociyt s elnvs;t4trtrxrcoatoptrau o;t  etmio3iu4aleelfvsls)sDuax pno4aexn o3iasla uln s (0alenxo tydopDeaneo t) 2tm(m ny1op emicias)aruax  ;o4optnmfetaslaDrl( o;u4 exrir ta1optrln s s  2xmxm3ny4ole mfctasf 2urxr ;t0tptnio3ildfsDrauvo t) renxr3oo1omtrlivol( seuoir iu1ope mfvta( s2taxm ;u1opeo ociyd s eln s t) rxrmfciy1oateluvsl(  etoimpoo4al nmics t artau ont0aexomfcias a umn p;u4texomo iodop eluvi (  eurxo3no4aleemncilsfs2tmxmo;t4tpxn ociatls2rl(vont0artrmfcoytlmDelneo;(0t2xo(opou1lmenlneia(f Draxroou1oex ifeilslm2ea(mp;(4alxnxr tadomDr uvil()t2toirpio4amenmfviatfaruau o;u0aex moeiaslmDumnvon(0teeomf ta1fp  luvo;s0t2uriopoodlm  mfcsa(fsrur(r oo1olxoio3tatlmDulnvp;(0altnxociodlat lneo;(  2urxr3ou4olenlfesa()s2tmu onu0aptoio3iys s2rmnms (0trtomf3totla e neo ()s2uoxo nu1olenmivsa( aDuau onu4aleo i3iytlaDrlnvp;(4 rtoircty1fpt  uei;t)t2umxrpiu4om nmiet ( aDtmu ooo4alen i3ilsls2emnvsnt4trxnmfcty1fpteauvils s2xm(m3iy4lpeemics s  2uax p;o1aptomo3tltlm el( p ()aetomo totoptr ieo s0 eto(o nu4lm n fcslt aDrrump;o4oex  f3iatfa2emn s t) etoif ia1fptr u ols)s2xm(m3iy1lmt lies (  2tm(r nu0tlxnmf3iasfm emu o;u0tlenioctodomD  uvol()teurim3oy1alt  nctl( s2uaxrooo0altomi3tlt aDranmpnt) rtoxo3iotfm   ueil( srxoxm3oo4olt  fvil(  2ua(  ;t1oex io3tlsfm2ra(mo u0tetrifctydla r nvo ( srto(r3nudam elfcilsfaruaxrpot4alxo o3tat m ua(vpn(4 leomociytfmt  n slt0sexr(r3ny1lp nlnct t)aDraum ;o0oeeoiicildlm ul(vsnt)alxrir totlat ai s (0seuoxopny1opt mfeil()srrax oou1tle  fciydfaDrln o u)alxnio3to1fpDeanesls0srtoxrpnu4lm   ncsas s2rrxr ;t1opx ifeiytlsDemump;u0altrmocty1la  anvo;s)trumxr3no1al nmncsls  Dum( pot0ale mf3iyslm rauvonu4trxrio oatop eanvo;s0s2toxo3oydame mnvtl()srtax p;t4ale  fciyd m2rm(vpn(4arenmo iotlat au o ( srtrxo oo1ll n nvslsfsDtaxmooo1tet  ociadls rmnvs t)tetrmfcoatoa eluvils t2umxopiydam emfvi t) Duaxrpoo4openifeiyd s2em( s;t4 lxnio3to1omt livi t  eum(m iodape  fvtat aDtr(m ;t0olenmoeiadls elnvp;(4trenmf3oydlaD aieil( srtoim iu1llen ici t arurxmonu0opto fctltfsDuln p;(4 rtrxo iy1optrlies s0 exm(o oy1lpt lfvsat sDum(mpot1apxomf3iyslsDemuvs () ltomr3oatlmDranvs;s  rxo(mpiy4amte ietasfaDuaurp;u4alx  ietyt s2ua(ms;(0aexrmr3iotlpte n s;s0 rxmxm3oy1lptnlivtl(  rtmxr oo0optn oetatfmDemuvs;(0aeerxo3todfm  ln i t0tetrio io1lleelncia(fsrumxmoot0aet ii3tldfa elu s;()tlenir ta1lm   uvslt)seuriopoo1lme  iei s)srumx  nu4tpenmo3ias s umn s;u)treoxo3oadopDe i o ()t2tmir ny4lltnmfcslsf rtrurpno1tetnmfetadfsDeln pnu4tetnmfcoy1om  lneo t0s2trxr3oudol   neil(  Dta(m ou4aetnmo3iydls el(vs;(0teerxf tydfmDeaneo s0sexmxm3ny4al  mnet ()arrrxmono4oleoioctysla2ua(mp (0aexrmr iydlmD  u i;s)trtmxm3no4lp n ivsl()aDtaxm ;o4optnioeiydlsDeanmsnu)teermo3iatopDelueols0setr(o no4altelivtlsf Dtm(m nu0apxnmo3iysfs2rmnvsn()areoir iadlaD ln i;t trxoio ou4aleemfcilt aruaumpou0aetn oetaslmDem( on()aeeoxo3oo1fptraueo;s)trxm(rpny4op nlfvsas) rumum ou0tetnmiciatfmDuaumpn() etomrcoadlm   ivs;t seuo(o3oudomtnmivt t arta(m ou0alxniiciyd a2eanvp ()treomf3to1fp  anvo;s sruo(r3iu1am nmieils)s2rmxm nu4opeo octatlm umnvon() ltoir tydlpDeanvi;s)s2xo(m nodlm  lnvil(  2umumpou0olxoif3tadfs2ulnvsnt0aexoioctadlm  aues s0sexrxr3nu1lp nlnctls)sDrm(m ;u4optomociadfa raums (4tlxnmf3ty1lm elu i;t)s2tmir ny1om  lfes s)aDrmur oo4tpxomi3ildfa2rm( p;t0 renmfcoo1fmD ln o t s2toir oy4lm  lnvias sDrrx ooo4alxomfcils a2ra(von(0alerxrcoadop   n o t0teum(o oodoleelivt sf Dtm(root0altniociysfs2umn o;() renxo3iotomD anvo;s)trtm(m3iy4amt  fciat)aDtrxmono1aptnii3iyt a um(vo t) renmfcoydfa   nes () 2tm(opnudamee ici ( a2ua(  nt0apx ifciyslm2umu snu4trxrir3iotlpDr uvs s teuoir3oo1op n fcia()s2ta(r ot1tleomieiadfaDuluvsn(0trermocoadlm eaieolt) rumirpoo4amtn nes s)srtmxm oo4alxomo3iyt s ulnmsn(4artnifcta1op  lieo t0t2umio3iy4ll  mnvsls) 2rm(mooo1aetomiciysfs em(mo u4 eermocty1faDelnesl()t2xrxm oydlptnlivtl(f 2tr(ronu0tetn ocilsla rl(ms (0arxnmoctatlm eliesl(0t2xmir3nu4lptnmnci t a2tmx  ou0teenmfeiaslm2eanms u4 rtrif3oodfaD  u i;(0s2xm(o oo1llenmfet ()srtmxr ou1tptomfetadfs uauvp ()aetrmrcoa1fmDr nei ()t2tmirpiy1amee netls) rumurono1opt  f3tytlmDraumpn(0tetoxfciotomDrlu s ()t2umio io4omtn nciat) Dtmurpnu0alxo oeiytlaDeau snu) lxrxrcoatlaD auvi t)seuoxm3iy4lptemivtls  2raxr ;o4tex  ictysla em(mp;()aexomoctadfa  lueo;t0srtrim3iodapenlivs sfsrtmx ont1apxn f3ildls2rm(vpnt4 renxfctatlptrlnei;() euoxopoy4amtnlivias s2tm(  ;o4tleoiieiadfs2ran p;t4trtnmo3iodfp  aneo t0t2uoxopou4al n fcsa(f 2rm(mpnt4apt ii3tltlaDumnvo;u4tltnxocty1fmD  u ol(0s2xr(m3no4ll n feiat) rtmxmpno0tle  ociyt aDeanmo;u4tlenxr3iydom   nvsl(0 etmimpoy1ap n fes s)artr( oot1altnmi3ilslsDemn p u4tetrxfcootlp  luvolt  2tmxrpio4ape lnvt tfaDrmxrpoo4opxn feilsfa2elumonu0aetoxf iotoptean o;s) 2xoxrpoo1am e feslt  Dtmu p;u1apxnmo3iat a2ulnvp;t)tlxrifctatopt livs;s)srtrim3nudape lnvi (f rrmx p;t1oetnifctls a eau o u0alxoif3iy1faDe ues;()texm(r3nu4lp elivi () rtru pou4aet  f3iytfa2emumo;u0tlxoxr3iytfa r ieil(0trtm(m3oo4op  mncsa(fsruaxmono4opxoifeiadfsDelu p ()arerxrcoodfp  ai il(  eumxrpno1om e ncsl(  rtr( p;u1tlenmieiytfaDeluvo u) eeoxfciatop r u sl(0srto(m3oudaltn nctls  2rmxmpnu4tpt  o3tat sDumu onu0 eerif oatomD luesls0tetrxm3nu4ap  livi (f rtrxm nt0olx mociasfmDea(mp u4teeoifcoa1oaDeau s;() 2tr(m nu4ole  nvta()arumx p;o1tpe moeiytfm2rl( p;u4teermf3tytlpDelies s)srxoirpoodlmee fvils) Drax ont0tpxoif3iydla ua(ms (0tlxomf tadopDr neol() 2uo(rpny1lm n ivt () Drm(r oo0apxnifetldla2ua( p t0trxrmf iy1lp   n il(0 2um(o3iy4lp nmiesa( a2ur(moot1tpxo ieiat s elnmp;(0trxoxfcto1lm e i s;s0texm(o3oydomtemneias a2trum ou1tptomfeiatlaDrm(vp t0 rxoio3tytlatelieilt)t2to(mpoy4openlnet ( a2rr(mo;t0aetoio3iadfs rmu ont0aetrio3oydomt lnes (0 eumxr oo4apt  fei sf Dtrum ot1tlt moctytlaDrm( pn(0 lenxfctodfa e ieo;(0setrxo ny4ll nmfcsat aDrm( ono0aleniociaslaDuln s u)texomfcoydfpteaueols0 etrio iy4oltelnct t)aDum( pno1opx miciysla eaums (0tltomocoodop elu s;()trum(opoydole lfvsatfsDtm( pot1tlx io3iys a ran s;t)aexrirctatoa  aneo;t  2urio3no4apeemnvt t) Dtmurpot1optniociat a uau o u4 reoif todoa elivo;t  etrxo iy1am nlivi t)arrmxr nt0aexnmoctys a2eanvpnt0 exrmocty1oateaneslt)s2umxo io4ll e net s) rtrxm nu0teto iciasfa2emuvs;(4alxrxocoydoptean ols  2uo(m3no4lmee nvias)sDuru pou4oltoiociyt m ran p t4teenxfcoytomtr neo s)s2xmxo3ou1ll e nct (fa2ra(  ;u1tpe  fctydfa uau p;(0alxnir3oydfa rlu ol(0sexo(m iu1olenlnviat)srtrurp;o0tptoifetls m2umu p (0texoio iatlp  aies ( texoio oo4al e iesasf Dua(mo;o4aexnmoetlsfaDeaumo t4tltrif oydomDe nvs;t)s2toirpoo1op e ivsls  2tru  ou4aexnmocils a elnvsn(0artnxf totlpt livols)s2xm(rpiodal n fcsa(fsrtmxmpno1oexomf3tld s rmu o t0artoif iatoptelivi;(  etrim3io4olt  iet (fsrraxmono0texn oetlt m uanms u)trenifcty1fm   i o t0s2umxm3oy4aptn net sfartru pot4tlenifeiydfs um(vs;t4 eerifcoo1oa rlivo t0setoxr iy1omee ivtat)sDtm(rpoo4aeenifctldlaDul(vs t)aexoif oy1lm  luei;s0s2trxrpoudap e nei (fa2ra(rono0tpt if3ild a ea(vs t)aetoxf iodfptr nesl(  2umio nu1lptnmfct (fsrur(rpnt0alxoiicilsla2ua(msn()arxrxf3oy1latrlnei;(0 2xmxm3ny4ll e fcia( aDum( p;o4tetnmfeiadfsDrlu s;u4 eeoio3todlptr ivo;()trtmxo3no1olte fct (faDtrxrpot4tlto iciydfa rmu p (0trxoir io1omteaivo;t0t2umxr3oy4alenmivsat  2ua( o;u4tee if3ilslm rmn s u)trtrif oatfatran o ( s2tmio iy1lmt mivtasfarrax  ;t1aetoifeildlm em(mpn(0texnxr oadfpteln o t) 2xrxr3oudlpe mfesls  rrm(  ;t0apxn octls m ea(mp;t4teeoxf oy1fm ranes;s  rto(mpoy4olte neil()a2rm(rp;t4ale ii3tyslm ulu s (4 rxrxr3iadom rau sl(0 2trxopiodlp  mict tfa2tau oou4apeomiciat sDra(vo (0texrxf ootfp e nei;(  rto(r3iy1ap emfcsat)a2rm(  ou1olxnio3ildfm2rl( s;t4tleomr3oytlaDrlnvo s0 2toxr3no1lme livt sfaDtmxrono1oeeoif3iadfs2rm(vp (4alenmf totoaDrln i ()t2uoxo iydomt lncta() Dtaxmono1aetn i3iadfa2uanmp;u4aeenxr oodfaDr ies;t  etm(mpoy1lm   iesas  2taxmont4tpto fciltfm um(mo (0 rtrmo3iodfa elues s0teumxm ny1lle  ncslt s2rru  nu4aex mfetyt a2rm(msnt)trenmf3iotopDrau i;()srur(r ou1ol  lfvtl()arumu p;u4olenio3ilsfaDumumo u4 etrxf tydomteanvi t  rxm(m3nydlpeeliei tfsrtaxmp;o4tpxo f3tasfa2eluvo t4 rxniocoytfm  lnes;(0teurxo3oy4lm   fviltf 2rrxm nu1apxo i3tadls2uluvo u) ltoxrctytfmDelueol( sexoiopoo4ol  mfciat arrrum ot0alxomieiltfs rluvpn()trtrir3ta1latr u i (  2tm(r iodlpt lneils  2ta( ont4tlxnmfeilt s emuvsn()trxoxo ootla e i s;()t2xoirpiudapee fci s  ruax pnu0tptnmfciyslaDelnvo;()areoif3totlmDranvi;t s2ur(o no4alt mnetl(  ruaxrpno0texnmf3tat m2el(vo;u) rtrmf3oy1lpteanvil(0texm(m no4llee ict (  Dtaur nu0tle miciltls2ul(vp;u)trerir oa1laDeauvi (0 rtrxm3oudapt lfvs ()sruau  ;o4tpx if3ilt s elnvpn(4aetomo oa1fmtr ueo ()setmxrpny1lmt lfvtatfa2um(ront4tpto ieiytls2rmnvo;()teermocty1lp eaiei ()t2toxm3io1ol  mivt (f rrr( ont1aeenmiciys aDumnvp;(4 lenio tydop eanes;s srtoxo3nu1ole  neslt)sDum(  nt0tlenmi3iyt a2uaumont4 eeoxo tadfate ies;t texm(mpiu4amt lieil( srra(rp;u1opx ifciys m2uauvo (4trxrmo3tatopDeauvi t)srxoxm3io1ol emfcia(f Dta(root4texnmicildfa ul(mp (0trtrir oy1fatr neils0srxrim oo1olenlicsa()sDrmu oot1alxo icild m rmnvpn() rtoxf oodlp   iei t  etmio io4omtnlicia( arum( pnu0aet  oetysfsDul(vpn(4 rerxo3oa1op eaueo;s)srtm(o3ou4omen fcs t  rtax o;u1tlxnmi3iadfs elnmsn(4 lxomocta1oaDrauvolt)setoio3oudlmtelicsas) Drauroou1ale  feias mDuau o u4tlenxr3io1lp ran sl() 2tmxo3iudap  mieslt) 2ur(moou1tpxoiieiat s2eanvp (4trxnir ty1fate ueo;s)srum(rpoo1olte ivil(fsDumu p;t0aetn octydlmDrlnmo t4tltnmo tatom eln ol(0seurxo iodap emics sf ruauront4tpeomfctldfa2ea( pn()alxrirctadoaDrlu s s  rxrir3io1olt mfvt ()s2tr(mono4oexo fctasfm2rm(vont) exrmocoytfpDe uvi;() euriopoydol  lfesas sDtrumpno4altn feiyslm2ean o;t4alerif3iydlaDr i ols0sexo(o3iydamee fesatf Dtm(mpoo0olxomiciltls2ea( p;() ltnirctodomtr uvs t0 rur(r nu4olen ict (fartmu oou1openiictltlmDulu sn(0trermf io1fa  li i;s  exo(mpiudoltelncilt) 2raxmp;u0alxo ietadfs rl( pn(0 rxnxf3iatlpt aivo;t) rxmxm3nu1am nlfvil()sDtau pnt1tlxn fetat s umuvon(4trxoif to1fptrlueo;s)srxmiopou4ap  lneilt) Dtmxr ;u4aex mi3tydfaDea(vpn(4 exnmo3tytfate ueslt  2to(o3oy1apeelnetl(  rtax p;t0tpe mi3ils sDrm( s (0tetnxf3ty1opteli s;( t2ur(rpnudaleemictl()srua(rpot0aptnif3ildfa eanms;t)aexrifcoodfatrlies (  eumxo3nudol elnvils)a2tauronu1oeto feiydlsDraums;u4 rxoxf totlmDelivsls0setrir3ny1am nmiviat) rrru onu1tlx ifeiltfm um( snu0tetnmfciytla r ivo s t2xoiopnudllt mfctlsfartmx  no4ole  fctaslm2el( p u)arxomo iotopD auvo t srumxm3oo4altelfvil(fs2uaurp;o0aetniieiydfa2um( on(0altrxf3oa1fp raivols0t2tm(mpoodoltnmfesa(fs2ururont0aeenifetysfsDulnmp;(4 lenmr iodlatraivsls)s2xoxm3iodomt lfvi tfsDrm( oot4aeeoii3tat m2um( pnu4 rtoio3io1oa eli o s s2urxopoy4oltn ieia()s2raxmooo4aexnioetat mDum(msn()areomrctadoaD  u sls seurio3nudape lnvs s  Dua( p;u4aetn f3ils s2eanmp (0 rxomocia1opt  iesl( tetm(m iu1lm e ici sfs2trxr no1alxo oetasfm2eluvp;(0aetoircio1opD  neols teumxo ou4am emnci tf rtrxmo;t0olxnmfetlsfsDum(vonu4 etomf3oadom r u sls)teto(rpiydol  mivtltfarurum ;t4aeenii3tlsfaDeanmp (4tlermo3oodlpD lnvi;( srto(r3ny1al emnesa()srrmump;u4oeenioeiadls2emu o;t4areoio3oytomte nei;t0 etm(m nydoltn ivtat)aDtaxrp;o1aet iiciydfs2elu p u4tlerxf3tatfat aivi s0seurirpny1opeelfcia(farrau poo0oet io3tltlaDumuvs u)tlxomf3ia1om eaieo;t0srur(r3oo4lm nmfesat aDuau  no4aeto f3iysla umuvp;(4trxrxf3to1lp rlnei;s sexoxmpio4ap emietat arraumpnu0tet  i3ias m2um(vs ()tetnxfcoo1omDranvsls0 2xrxopio4lmt mfvsas) Drr(mp;t0alxo iciytls2rlu onu4 eeomrciatop rlivols0 rxmio3iy4altelnci s arurump;o0ole mf3ild mDem(ms ()trtoxfcoa1lmD  ivs s)trtoxrpnu4omeemieil( arrrurpou1tpxn ietyslm uln p;u0tltnxr3ty1omt  uvs ( seto(o3oo1lltelivil() Dtmuro;t1tltoifciadfm2rl(vo;(4 ltrmocty1lpDr ieolt t2xmxr oodlme lncsas srtau p;u1opeoiieiyt m2elumon(0tlxrxrciodfm eau i ( t2xr(r3oy1lme  nci s  2rr(mpnu1oexo f3iltls rauvp;u4aetoirciytoaD  u olt truoxm ny1lptnmfctas  rrm(rp;u1texniietlsfm elu p (0artomr ia1oa rluei t)s2xm(o iu4openlfes () ruaur no1tltoif3iytlmDeau s t)artrio3oodla rlivol()trtrio3io4ll nlfetlt) 2taum ;o0tpto fctaslaDrmuvs u0tltnircootlm   uesls)texm(o iy4al   ieil(faDuaurooo0aetnmictydfs2el( o () rxrmrciytfpDean slt0 2xoxmpny4ol  mnetas)a2trxrono4oetnio3iatfm ran sn(0tlxoxrcio1fpDeauesls)texrxopou1amtnmnvtatfsDtaxrp;u0openmociys a ua( o;(4tlxomr3iydomD  n s t0 2xrimpny4oleemfesls s2uax pot0olx iieiys a2umu p u0 rtrio3totoptrlu ilt) rtm(o nodom e iet t artax p;o0tex mociasfa2emnvs;t0texrif3io1fpD li il(0 2urirpio4ap nmfcs tfsDraurpnu4opx  feiatfa elu o u4aleomf oo1lptr ivi;( sexmio oy4ape lfvsl(  Dtrx onu0oex iictldfaDrluvo (4artrmfciytfp e ues;s) ruo(rpno4aptemnes (  2rmumo;o1oet mfcilt a2el(vp t4areniociydoat  ivil() 2to(rpou1amtn fcil()a2um(moou0aetnmfetadfa emnvpnt0tltnmo iodlm eaues;t  exoio3nydlp elnvi (fsrrrx pot1tpxo o3ilsfm ranvont0 renmr3oa1oaDr nvo s0 2xrxr3iudopenmfvs ( srrr(ro;t0ale  ocilt aDra( p u4aeenir oa1omt aivi s)sexoxo3ny4lp nlfcsa(fsruax oou4olt mfciatla elnvont) eerif3iydomtr uvs ()t2ur(o oudlpeemfcs t)a2tru  nu4aexoiieiltls ulu pnt0 rtnxo3oydlmt li sl(0trum(mpno1olenmnctls)a2raxmpnu1teeo ocildfaDul( s (0tlenif3oydoa  aieil(  2ur(mpnudlmenlneia()a2umx oou1oltomfeiat s2ul(von(0 lxnir ta1fmtrln s;(0trum(o ny4amee nesls)srta(  ;o0aexnmociyd mDel( p (4 rerif oytop eaneo;s0 2uo(opio4apeemnct t) rrr(r no0tpenmi3iadfsDumn o t)aeermo iy1lmD anvo () 2xo(m oy4alt mneta( sruaumpoo0apx  f3iltls ulumont0tetnxocia1lp eaivo s  ruriopou1openlfct ()aDumxmo;o0texoiietysfaDumnvo;(4 renir3oadfaDe uvi ( trxoxm3oy1lpe  fvt s sDtmu  ot1olt miciydfaDrlu s;(0tlenmfctatlpD an o ( s2xmim3ny4olenmncslt) rra(  nu0aexnif3tyd aDem( on()texnxf oadlpt aivs (0trtrxm3oo1ame  nei tf 2rauro;o1tex ii3tasla um(vo t4trtnxo3ty1lm  auvil(0 exmio io1al   ncsl(f rrrxro;t0oeeo feils s2rau ont)altrmr3iytfa e ueolt) etr(o3iy4llenlivi t)srur(rpot4optoioeiysfs2ra(mont0 etoxr3ia1lmtr nei s t2uoxmpiudom n ivs ( s2taum ;t1tee if3iyslaDrl(vo (4aetnmrciy1op  li olt  2toim iydameemics ()a2uaxmp;o1oexnmiciltlm2elnvo;u)artoif oy1omDrlneo ()s2xr(r iodlmeemnvs s)aDrax  no0tlen o3tyt m2eaums;u4arxrio io1oa r ivs t0trtmxr3oo4apee fviltfsDumu p;t0ale ifcildlsDranvp;t0alenmo3iytlp   nvil( seurxm nodomtemfvtltfsDta(  oo4aexo fetasfs ua(vsn(4 lxnxo3ta1op r n o;(0s2umiopiy1omtelfetat) 2tmxmonu0ape  o3ias mDrl( ont4aetrmr oytomD lueo s)tetm(m3no4opt lfcil(f Duaumoou1alxo icilt mDelnms;(0aetrirctotla  lieo t0srumxmpnu4ap n fvs s aDtmuroot4altoiicias a2uanvo;t) etnxfcoo1fptrlneil(  etmim iydll nlici ()sDrau pnt4teeomictyt m uluvs;u4aexnxf3oodoatran ols)seur(o3oy4ap emici tf Drrump;u1oltomf3tlsfaDumnvp ()artrmoctatlpDeli o;s  rtrxopiydlp nlnvtlt aDraxro;o0oetnifeiltla2ua(msn(0aetoxfctotfat anvo s0sexrir io4amte fcia(f rtaxm nu0olxomo3tydls uluvpnt) etrio oy1fpDe u ils t2umxm io1omt  iesl(fsDta(rpno1opeomf3iatfa el(vs;() ltoxr3iytlmDr ivsl()t2toio3iodllteliviatfsDrru o;t1teeoiietyd sDumums u)aetrir oadla elueolt0 2um(o3ou1ape lfcia(fa2rmx  no0tee mocild a2eauvpnu4artoxf3oatfatrlieilt)s2trimpou1lm  mncslt)sDraxrpoo0tltomictltfs2um( pnu4tltnxf3iatfm rlnvol( trtmxmpiu4oltnlncias) 2tmxronu1aptn octls aDrlumo;(0 eenmocoydomteauvil( srtrio ny1lp  lieta(fa2trxront1aex mfetldlmDuauvs;() exoxrcootlm elnvo;(  rxoxo io1opeelnvtl(fa2tau p;t4olx ioeilsfmDrmums (0 leoxr ty1fmDr uesl(  2tmir3oydope  fcsl(fartrxm oo1alxn o3ild mDua(ms u)trerir ootomDeai s;t)texoim iy4amtnlfeias)srumu ooo0optomf3tyt m2rm(vo;(0arxomf3tytlp  anei;(  exmxr3iudamtnlici t s2rm(r ;o0oltomi3tlt a2ulnvs;u)tlermrctadom eluvi s0srtriopoy1olenlfvta( sDtmur no1apt  i3iytfs2emump;u0tlenxo io1lmDranvs;t) 2tr(opiydlptemicia(  rrrx  nu4ole  ieils s2rln p;()altrio tytlpDe ivs t)tetr(o nu4apeelfetls s2rrumoou0oex io3ilt sDum(mpn(0areoio3ta1lpDeauvsl(0srurio nu4ol  mnct t) 2raum ;o4opxomfctadlm eauvpnt4 exnif oadlmDeli i t) 2xoio no1optnmivsltf 2urx ooo1tltomi3tls aDrlnvo u)altnxf ootlm rli s t)tetoxo3iy4opee ictlsfarum(  nu1olenio3iydls2rmnmp;(4aetomo3iodlmDr nes;()teuoxrpoo4omeelivi tf Duaxmooo1aetnifcildfa ua(vpnu)texoxf iytoaD lnvs;t srtm(opno4optelneiat)aDumumo;o1tpeoiieiltlmDeanms;() rerxrcoodoat anvilt0t2xmxopou1lpt  fesltfaDtaxm ;o1aptomoeiysls ua(vpnu0 lxoxf oadoaD  uvo s0t2xrir ou4ll  livia( a2uau oot1tex io3iyd mDelnvp (4alxniocto1faD  ueo t  rxm(o iy1lmte net ()sDta(  no1ole mociytfm em(mp (0aleomo to1la r i s s)srto(o oo4lp  lnvias srrr( oou4opt  oeiysfaDrl(mo;(0 rtnio ia1la rlueils)tetr(rpoo1lpenliviat) ruaur no1alt  ictatfs rmuvo;() exrxf totlm   uvi;()trto(m3iudlle lnesls)sDtrum nu0apxn iciatfs rmumon()tlenif3ootfpteai il( setm(r3nudllee iet s)aDtrurono0ale ii3tlsfs ul(vsnt0 ltrxf to1lpDrau s ( srumir3iodlp  mncsls aDumuroot1opxn oetatla2rau snt4texnifctodfmD  nei;s0s2xo(rpoy1lp  lnesls) rumxmoou1tetoif3tytlaDel(ms;u0aeeomfciatlatr ues t t2umir io1lmtnmivsat)sDrrurpoo4texo fctys m el(vp (0 lxoxf3io1oa   nvols0texoxm iodlmeelfcils  ruax o;t4aexoif3tlsfsDuauvp t4trtomf3iatfa eluvo;t) etoxr3ou1ame mnetlt  rrrum oo1apen oeiysfa2ua( o (0trxnmo oy1fmDrlu slt teum(rpnudol nmiei sfaDrr(mpnt1aee mi3tlslm2ran p u4 renmfcio1lpD luvs ()seuoio iydlpenlneia(f 2tm(r no1aet io3tas aDrl(msnu) eerxo tytoa rluvi;s0seurxopiodapeemiviat arrrumpno0olxoio3iydfs umn s t) renmr to1fmtr n s;t0 rxmirpoodlpen ncsa(  rua(roou0texnmiciatlm ua(ms;u0 exnmr3totfaDrlnvi;(0 2xoiopou4aleelfct ( a2rmur ;o4aeeomoeiadfaDea( ont4alenmo3oytfmDelivols) exmxrpoy1ol emnvs s a2tax ont4oee iietldfmDem(vo t4aetoxf tydoate uvils s2toxr3ou1alee nesls) Duru  ou0tltomf3iadlm eau s;t) ltrmf oodfaDraieo;( seum(r iu4ole micilsfsrra(m nt1tlxn ietltlaDua(msnt)tleoxr3iy1fatrai o;s0trxrimpno1lme mnvtatfaDum(r no1tee mi3ias s rau s;(0texrxo3io1fmtranesls  rxr(r iodopt  nei t a2rm(mooo0altomfctysfaDumuvonu0 exoir oa1fmDeluei;s texoim3ou1optnlnes ()s2rmum nu4tpt ifetyd m ua( p (4 rxoxocty1lm  anvo t s2tmxopiodame  ncil(fsDua( oou0oleniociaslm ranmo u)areomo oy1laD lueils)teum(mpoudoltemfesls s2rax  ot0ope iocilt sDulu p;(0alenxrcoy1oate ieil()t2urxr3nydol nlietas a2trxmont4openmocilslm ea( p;u4alxnxf to1lmt  n sl( s2um(opno4lltelfeia(f Dum(  nu4oeeomieild s uau ont4arxoxoctotfaDrau s (0 ruoio ou1ll nlnvs (fsrrmu o;o4oee mictydlaDulu p (0 rtomrciadom raneo;()t2xm(opnudlp e fviat)artrx p;u4aexo ictytfa em( o t0 ltoiocoatomtrauvo;(  2xm(m3iodape  fvs ()artm(mpnt4tpeoio3iysfsDrmuvs () etnxocoo1fp eai s s)tetrio3iydamenmietls) Draum no1apeomf3iysfm2ea(msnt)alenxf oatfm rlneols setoxm iydaltnlfvi tfarrr( o;t4tltomfeiys s rl(vpnt0 exrxfctytlp eanvi;()sexoxrpny4lp nmncs tfs2tru o;t0tle  ociad m2um(mo;u0 ltrmo oa1omDraneols)srxo(mpoo1op nlfesltf Dtm(  oo0alenmo3ilsfm2uauvpnt4altrmrcto1fpt lneil( t2xrxm oo4al nmics tf ruau p;o0aptnmi3tlt s em(vs ()teerxo3ta1omt  u s;s) etr(rpny1amtelfes t  Drru  ou1tptomiciltlmDrauvsnt)arxomf oodfaD lues;s0 rxrxr nu1om  miciasfa2tr(  no4tlenmi3tydlaDeau s t)tetrxr oo1lptrauei (  euoim nudalee ivslt)s2rax oot0apx if3ilsfsDrmu p () exniocoy1lpt  uvi;s0trurim nudole lieil(fsDrmxr ou1oex mfetlt aDra(mo;(0 ltoxfcoy1lptraies;t0trtmim io1ol  lnesasf 2tm( pno0oex if3ilsfmDel(mpn()altnifcia1opte n o;s) 2ur(rpnudomeemfcsa(  rrm(  oo1oleniieias a rln o;()tltomf iotoa rlneilt0 exr(rpoydolte fesat)arum( ooo0tlxnifctaslmDua( s u0aeeomo iodlp  anes;s  rtoxr3oy4omtn ieslt srur(mo;t4oltoio3tysls ran o (0texoir ta1fpDraivi;s0s2umxmpnydap  licils) Dra(rpou1tlx mfctasfsDemu p;u4 rtrmo oydfa  lieolt0trtm(opoy1alte fvsasfsrtm(mpnt4tet iociydlaDul(vont) exomr3oatopte u s;(0sexm(mpnydllt lncia()s2rm(monu1olxoio3ild m2uan pnu)aexoxf3totlpDr i s;( s2xr(opiudalt mncs s sDumump;o1altomoctlsfmDrmu s;u0areoif3tatopDeaivs;(0 2toim3ou1amen fvsl() rrmx poo1aleo fciadlm2rl( o;t)teeoir oydom e i i;t srumxrpiu4amee fciasf rtru p;u1oex  f3tld m2rlnvo t)tltomocia1fp eau sl(0srtmxrpiy1aptnmfesa(fa2raxr ;u0openii3ils a elu onu4tlxrmr oydom eauvo;s trxr(opnudape lnctl()sDtrx ooo4aptnmo3tlt mDemu snt0arxomocoa1lpteaneil(  etrir nudll elies (f 2raxrpou0tlx ifeildlaDeluvp;(4trxrmr3iatfm elu i;t truoxm3ny1lptelfctat)aDrrxro;t1tet iiciltfs rmump;()alerif3iy1lm raueo ( t2xrxo3ou1lmee nvi sfsrumxm no1opxnif3iytfaDul( p;t)teenir iy1fmD  u i () 2xo(o oy4omt livta()artaxronu0aeto oetatlaDeaump u4tetnmf ta1fpD liesls seumxmpiudam nmfvt t  Dtr( oou4apeoiociat aDuan onu0tetoio3iydfaD li ils0t2toxm ny1lp e nct (f 2tr(m oo0apxn feiadlm ranmon(0trxnmf to1lmteli o s0sexrxr oudapt  iei sf Dumx pnt0opt mfctas a2eln snu4aexrxo3io1fmDr ivs;( teuoio3nudale lfvils arta( ont0alt mieils m2rmu s;t0 exnmfcoodomDrlneols0trtoxm3oydlp emivil(  Dtax  no4apx moeiydfsDrauvpnu0tlxrxoctatlmte nesls0setoxr oo1lpenlnvs t arum(monu1tltoiocild aDea(von(4 lxrmo oydlat auesl(0s2umim3oy1omtelnci tf Dtr( ont0aeeomieiadla2el(msn(4 eenxrciotopD aiei s0setrxo nydllteliei (fa2ra( o;o0oeeomfctadfs2rm(ms ()altrifcto1opDrau o t)trur(rpiydllee fct s  2tmxm ot1tpx  feiatfa ulu p ()areoiociatfa eai ils s2xoiopno4altemnci ( srta( poo4apeo fciysfm2rm(vo ()tlermrcia1omD lu i t trtoir iy1ll emieil(f Durxroou0apenifeiltlm em(msn() leomoctydomt an ols0 rumxm3oy1ll e iviltf ruaxmpnu0apeomoctadls ea(vs;t0 rtoxf to1optranvsl(0s2uoxo no1lpte fct ()artrxrp;t0altnmfetydfm2ea(vo;u) reoxf oa1fmt lu il()sruo(opiydomt mict t)sDrau o;t1oexomfcias s rl(mp u) ltrxfcio1omteanvolt0srumxo iydll n nvs (fsDtmum nt0tltnioctlsfaDeau ont0artrio ootla eanesls0 2urxm3no1lpt livias sDrmx oot0tleoiieilt a umu snu0arxrmf totfateauvs;s truo(o iu4al n fetlt  2tmum ;t0oexnmfeilsfm rmn onu0 rxomr3ootfptelivsl(0 rxr(m3iydoleelfei (  Drm(mont1tptnio3tlslm2ulu sn(4arxomo oodfp eauvs s)srxrxrpiudlp emivtlsf rrm(rp;t4tex mo3iyt mDeaumo t) lenxfcoo1oat  ivi;()tetrim iudalte ietasfarraxmo;o0alx  ociys sDumnvp t4artomocoodfp eluvs t s2uoxm oudlm nmiet sf Dumuro;u4oet  feiltls uanvp;t4treoxr iadomD  n i;t0t2um(r3iu4am  mncsat)srrax o;t1tpto i3ias m el(ms (0trtnif3iotoaD lueo;()s2toio iodlp e fvsasfsDrru  no0optniiciaslaDumu sn()tltoiocoatopD lu ilt t2xr(r3oodlle mfci sfaDtax p;o4tpto iciysls rm(vp;(4artoxo3tatlpDelies () euo(opoydopt lfvtas  Durx pot0optnmieiyd a el( ont4artrxocta1omteliei t)s2uoxm3iu4am n nvias  2raxrooo1tpt  f3iyd a rauvon(0texrxo iotoaDelues s0seumxm3nudop nmfvta() rtaxrono4tpeomfetytfa2umu o;t0alxnir iytlmt liesl(  2uoir oy1omtemivsa( srtm(mooo4tptnmfciad mDelu p (4alerio ootfp e neslt0trxoxr oy4ale lieiatfa2ta(  ot4ole ifciys m2umuvpn(0 exrmr tadfaDe nvs;s)seumim3iudlm emfviasfa2urxm ou0tpxnifeiltfs2ul(vs u4trerio3oadfpDrlnvi (0 rtrxrpoodale  nviatf Drrxrp;u0teeoiieias s2rau on(0aexnif oa1lm eaues t  exrxm nydamenlici sfarrrxrpot0oleoifctldfsDranmp (4trxoxf3iytfmt ai i;s0 rxriopnu1ale  ivsa( aDumxmpnu0oeeo ieildfm2rlump;(0 reoio3oy1lm r uvs t s2ur(mpiodlpenmiet s sDrm(rp;u1apt  fcildfs2eanvp;(4aetrxrciytlmDrli s;s0srtm(rpoo4altnmicsl( a2urxroot4teeniietysfaDrmnvpnu0 rxrio ootlatrlneol()s2uoxmpoodlpt mivtasfarrm(mo;t0tltn ieiad sDrluvo;()teeoxo3iydla  livil(0t2urxmpio4ape  fesas)artrxmo;o4oetn feiltls2ranmp (0 renxo oydomtrln i ( s2uoio3ou1am e fvil(  Dumx oot4alxo o3ilt sDeanmont4 rtnmfciadom r n i s0s2xr(o oo1ap  mfvsl(  Dta(mp;t0tlenmf3iysla2rmnms ()trxrxf3iatlpDrln ils0seuo(m3nudom e fvs s)aDraur ;o4oleo oeiytls2ul( o u4 rxomoctodopte nvils s2xmirpiy4ope lfeia() Dua(r ;u1oltoif3iad s2rau s ()arxoxo3oo1lmDr ues t texrio iu1lp  lfci sfs2tm(rpnt0alxnmo3iat m2elu o;u0aeenif3tatfaD  ues;s0setrio io1am   nei tfsDurumpnt1alxnio3iatls uluvp;()trtnmrciytfpDe nvi s)srumim3nodolt lnctat) 2umum ot1opxoifciyt a2ranmo;u)aetrxrctatlmtraieo (0 2tm(rpny1omenmnvsatfsrrmu  ou0apx mi3ils m2umuvpnu0texrxo oy1lm rlivi;t0trum(opoydlm e ivilsfsDrmur ou4tpeo feiydlmDra(msn(4altrxfciotlpt auvs;s t2uoxm iydllt  ncsls  2rau  oo1alxn f3ils a ul(vo t4 renir iadla r iei;t  2xoiopou1optnlfvsl(fsDurxrpnu4tpeo ietlsfaDrm( s (0texomf iatoaD  n s () 2ur(m3oodomeelfciatfsDtrxr nt0opeo fcilt a ranvs;u)texnxocoodfpte nes;t0s2xr(o iu4ameelneias  Drmur oo0oeenmfciltls2raumo;t) reriociytfatrau s;s srto(m oydllt mieilt  rraumpnu1opt ii3iasfmDuaumpn(0 lermo todlmD  uvi;s  rtrxmpiu1ll e icsat sDrru oou0tltoifcild s2rmuvsnu4tltnxr tatfa rli s;t0t2ur(rpny1lmee net s aDtaxmpno1oeenmo3iltfs umn sn() rtnifciydla eauvs () exr(o3oydom e ictl(faDtmuro;o1optn ociltfs2em(vpnu0aleoiocoo1faD ai i;t)t2to(mpoo4ap nlnvilsfa2ua(rp;u4tex mo3iyd s uan s u4tleoxf3ia1lm rli i;t srxm(m3iy4optelfcilsfs2ta( o;t0oetniociltls2uluvs;(4arxrxfciydfpteauvo;s sexmxopiudap n ivs t  Dra(rp;u1opxnmfetldlm ranvpn() ltrif3tytoatr n sls  rxo(m3io1omtemnet s aDrmx  ot4aexo ictldfsDrlumpnt) ltrio3oydlatrau i;t  2trim3nodlltn nei (f 2taurono1olen ietytlaDrluvs;t4aexnif iodfmDelues t0 etm(r nu1ol n fvt (f rrrurpnt4apeoiociltlsDulnvp;t) etrmr3iydoatraieo;t t2uo(o oydlltelnctl(faDtr(mpno1opxnmf3ild s2rmnmp t0 eeoir ty1lmDelneo;(0srur(o3no1alen fcil( aDtaxmo;u4aeeo i3tld s ea(msnt)altrif3todfp eaivol() exoxr nudlme  fcilt) Dra(ro;t4tetn o3iasfa2rl(vs;(0areomr todla e n o;(0seurxm3io4optnlfvia(  rta(mono4tet  icilsfm2elump u0 eerxo3tytfmteaieslt trtoxo3iy1am emncia() rurum oo4tleoioeilsfsDea( ont0texnmocoatomtr n o s0sexmxm oydomenmicsas)srrm(rpno1opeomi3taslmDrln s t0artrxfctytla elnvo t)t2xoxrpio4lme lieiat sDraxro;t4aetomictasla ulnmon(0 rtrif oodlatraieo s0truo(m3ou4lp   nvtl(  rrrxro;u1tpx ifetld mDrlums t)trtnif3oy1oa eluvo;t s2umio3io1omenmieias)s2ur(  ;o0olenioetytfa2rluvpnu0alxrxo oatop e n ols0tetoxo3oo1lptnmivtl() 2tmur ;u4tpxomociysfaDrmuvpn(4aetrmfctydlm rau i;s)srur(r iy1apenlivi (  2um(rp;t4tlt ifciyd s2raumsnt)tltrmr tytlp r neo s  exoim3oodalenmivsl(  2urum oo4opt mfetadla2um(ms ()tltrmf3iatoaDr nvs ()srurim3ou1ape  fvi s a2tax  ot1oltn ociys aDel( sn(4tlxnxocto1la elu o s) 2uo(rpoy4olenmnetas a2um( pot0aex  f3ils a el(monu4 rtoxociadlat aivo;t)texmir3nu1ol nmiesat srtmx o;o1teenmo3iadls rau onu0texomr3oo1om  lnei s texrio iu4apeemnvs sf Drr(ro;o1tlt  o3iasla2umnvp;(4altrmr3oo1omDeli i;s srumxo3iu4optnlfcta() rrr(ront0tle moeiyt a el(ms () rxomocoatop ean olt0seum(o3no4ape  ivi s a2urxmpot0oex  ictys m eanms u)trxnircootoaDrau i;t) 2umxm iy4ole lnet s sDrm(r ;o1tlt  ictadlsDemu s;u)trxrxf ty1fa rauvol()tetoxmpno1altemfeils s2trx pnu4oex ifciydls2um(vs (0artoxo3tydfmtrlnvi;s)trur(rpou4op emnvtlt sDur( pnu1openiieiasfs um( snu0 eerxo ootfaD luvs (0 2xrxm io4lmtemnes s  Dum(m nu0tlxo o3tydls em( pnt)teerir oydfpteaueol( tetoxopnydaltn ici t s2umx o;u1alxn ictatfmDumnmp;(4artoxo3totfatr nvi;s0trxmxrpio1ap   fcsls a2ua(  ;t0oexoiieiyd a2umu s (0trxrmf3todomDr i s;t)srto(o3ny4ol n iet ()aruaxr ;o0tlt ioctydlm ra( s ()tltrir iotoateau olt  etmir ny4ape livsas)a2rax  nt1aexnmi3iysfaDrluvp t4tlermr oy1fm ranei;(  rurxrpno4al   ncsl(f Drrxronu1tlxn o3tatfs2ea(mp;u) eeoio3to1faD lu sls)sexrimpiudamee ictl()arrr(ront4tex  ociltfs2rlu s u0 lxoxf iotlaDrlues;s setoim iy4ol nmicsasfsDuaumo;u1apxo f3ils m rluvo t4 lenmrctotlaD  neo t t2urirpiu4ll nlfvtlsfa2raxrpoo0tet ioeiltfmDelnvsnu) etrmo oy1fa r ies t0s2uoxr oy1lm nlnes tf 2ra(mont1tet mfctysla2umnvsnu)aeeoiociatlaD lnei;()t2xrir3oo1ope lieta( srumxrooo4optoio3tatfaDua( s () lxnirciodfptean ils)setoir nudaptelivsas) rumumooo4tlxnmfciyslmDulnvsnt0 exoxrcta1omtrai i;(  exm(mpnydol nlict ( s2uru pnu4tlx  fciytfm eanvo u)treoxfcoodfp ean i;(0seto(opiodlmtelnvil() 2urxm ;t1opx mo3tld mDem(vo t)artnio3iy1oa e ueo t) 2tm(r oodaltn ict tfsDtmur ou4apt io3iysla2rln onu0 rxrif3tytfa  li i (0 rumxo3oydame  iei ()a2rrum ot0tpeo ociytfmDulumo t0trermo3to1lateaneilt)srum(r oydlpe  ncia(  2ra(m nu4ope  fciys m2rmnmp () lermf iytlm   ivs;t0srtm(r iu4lle mneilt)artrx  oo1tpeo i3tasfa2uln s;t) lxoxf3oytomt ln s (0 exoxo iu4lptelivtlt arrrxmp;u4tlenii3iadls ul(vsnt)aleoif3todoptrau i t0 eumxmpiudal elfcia(fartr( ont1optniieiysfaDulums u)alxnif to1lmt ai o;t)t2xrxr io1apte fct s)a2rm(ro;t4aleomo3iltlm2emu pnt)artnmo3ta1laDe n sls texmxm3no4lpt  fvt (faDtm(r ot0oee mociltfa umuvsn()teerir iytomte ieslt s2uoirpnodom e ieils srta( p;o4texomfetat sDuluvon(0teeoxr oy1opteaieo;s) eum(opoodam   icsas) Dua(m ;t1tpx mociat sDuan snt0altoxf3tytfpte ueslt0 eum(o oydapt  nei sfs2uaumo;u1apt mfetldfm rmnmp ()artnmfciy1lmDe uvo (0seuoxmpoudame mnvsl(fsrta(r no0apenmo3iyd mDrmn sn(4artoirctatoate ieolt0t2tm(o iy1ol n nvsa( sDuru p;u4opxomi3tyd m ul(msnt)alxnmr3oo1om r ivils  rxmim iu1lmeelfei t  rum(roou4aexomicias mDrmn o t)tlxoxf3io1lat luvi;t)teum(opno4ope  fetl(faDtrxmont4tpenmociydfm2ra(vp t)tetnmrciydlmtrlivi ()sruoim io4lpt  ivsat srraump;u0aexo feiltla ra(mo;t4 exrif3totfm raues t) 2tm(rpnu4am  lnesas a2rm(moou4texoioeiydfm2uan pn(0 rtnxr oydfaDr ies ()sexrxm3nu1op  micsa(  Drr(r no4ole mi3iad aDeauvp t0tetoio oy1lat an sls0seumirpiydomeemictlt  rtauroot0apt mi3ildfs uluvo t0 leomfctadoaDr uei;(0texoir3nu4oltnmicil(  ruru ont4opxomfciat s umuvo u)tetrxrcia1lp r u sls  2ur(o io4ome micilt) rtax  nu0oltomoctat m rmnvo;t) etrxf3iydom e uvsl(0texmir ny4alee nvtat sDra(  nu0olen oetydla2ea( pnu0 leoxrcoo1fp rlivs;t  2um(o io1am n neiatfartmxmooo0tlxo i3tatfa2umump;() leomrctatfpDeanvi;s)trumio3no1ll nmivia(farta(rpot1oltoif3iysls rmnmp u0trxniociadopDr u i (0tetm(r3oy4lpt  ncia(fsrurxmpot1aptoif3tyslmDra(vsn(0 eeomf3tatfmteaneols0trxo(r iydamt lfetatf rrr(mo;o4optn feiyd s2uauvon()alxnmr oo1opDe nvs;( srtrimpnu4llt micil(  2rmu  ;u1optniicilsfs2el( p;(4aleoio tydfmtrluvils  2tm(r3nydal  lfct t arur( o;o0tlen oeilslaDrmuvo;(4 etnxr tatlm r ivi (0 2xoxmpiu1oltnlnciltfsruax  ;u1oex mfciysfaDrln on(4tlerif3oodlp raiei t) rto(opio4lpte ietl( aDrrx o;t1aeen octatfm2raums;()artoxf3ta1lmtr i o;s)t2uo(o iu4aleelfvi s)srurxroot4olt ifeias a2el( p;u4areomr iodlm eliei t0 rurio3iodlm  mfvsls) Dtru o;t0opx mi3ild mDua(vp t4tleomo oodlptrlivils0srumxr io4am nmfctls)s2ua(  nu0oeeo oetytfm uan p;t4aetnir3oatfa r neo;(0trtoim3nydopeelivi ()s2trxr ;t4aetn iciat m2rl(vp t0tleoif oadlaD livilt0trxriopiu4olenmics ()srrr(  ;t0aex  icilsla2emnvs;u) rxoxfcoo1oaD aueolt) 2to(m iy4opeelnes tf 2urxmooo1tetomfeiadla2ean o u)trenir ty1fa   u s t0setrxr ou1apee icias aDumxmo;t1openii3ilsfs rmu snt)trtoifcio1lat anvols)seur(mpiudope mivs t)a2rmx  ;u0oleo i3iatfm2el(vsnu4 exnxocta1om  lneilt)setrir iu1omen nvt s sruaxmonu1tltomieiat mDelumo;t4aexomfcoa1fmDrau i () etoim3ou4olte fvtatfartax pno0altoif3tltls uan pnt0 leomo3iadoaD aieols)s2xr(m3ny1op e ieta(fs2uaxroot1apxnmieiyslsDumu s;() exrirctytoaDeaivol() rxr(rpoydope mfctat  2rmur ;o1olenii3tyt sDraump;u)aeerioctytfm elues;s t2uoir3ou1alen ivias) Drrx ont1tptnmfetytlsDulnvs;u) rtrxr iydlatelivils) rtmxrpnodolt  nei t)a2tax p;o0alto iciadlsDra( p t)artrmrcty1la  auvs;s)truoim3iudopt  fcilt a2umu o;t1apxnmfctydfm2eluvo;u0 lenio3ootfat li s;( setm(mpiy4lm nmicsl( s2rmxrpno4teeoioctltfa rmuvs;(4aexoxo3tatfat  nei;() eumim3nydam emiei t  2raxrpnt0aptoii3iys mDelnmo;u0aeeomocta1fat anvs s)trxmxo iodolte nvi t)aDum( p;o1tleo o3ildfm2ra(mo t) lxoxr3iytopD  iesl(0srxriopno1ll  mfei ( aDur(roou1aetnmf3iadfa2rau p;(0alerxr3iadlaDeauvs () rxoio iy4aptemnvi (  rum( oot4oetnmi3tat aDelu o u0 ltoio3tytfpteanes t setoxo3nu4llte ivsat) 2uaxmpoo0opxnii3tat s2um(mo t4teenxrciotomteaues;s0tetoxm3no4omte icil() Dtrxm ;t4tlxoiieiatfmDra(monu4teeoxoctodlmDrlies;()tetr(m ou4ap  mivsas)sDuaur nt0oet mfctad m2uauvsnt)artnxo oydop rauei s tetrio3oo4lleelncsa(faDtmu p;u1aeenmictasfs umnvs;t) reomf oadfatr nvi t0 euoxo3oo4amtnlfcia() rrm(root4aetniiciadfm2ulumpnt4 etrmrciotomD an i t) 2xmxrpnudllte ivslt)a2ra(rp;t0tlenii3ils a2eluvpnu)texrir3iy1latrauvilt  rur(r3nydamtnliet ( aDrr(rpnt4alxniiciatfm el( s ()trenmrcoodla r u ol(0 etmirpnudlm  lfcil() Dtaxmpou4ole iocildlm2umu s t)trtnxf3iadla ranvi (  etoxo oudoltelnesa(  Dum(ro;t1tpx mf3iltls2eanmsn(0alerirctotoa raueo (0srxo(r3oy4olenmnei t  2tmur ;u1tee if3tltfa ra(monu4 leomrciotlp  aiei s)trumio3nodale lnct s srumur ou1apx  oetlt a emu onu)arxrif3iodfpDrlu ilt) 2xr(o3nydapenmfesat aDra(mp;t1oee  fetasfa2umu p;(4areoirctotlmDe nvs;t  2tm(rpnu1am nmfcta() rtax  nu4apenii3ils mDeln s u0arenxr iotlp  aieo;s)s2xmir3oodolt lfvs () Dtaurpnu0texomiciatfm2rmnmp u)alermf3tytfpte nvsls s2xmirpny1am n ivilt s2trxroot0apx ifcils sDrluvo;()alxnxo3iy1fmDeaivi;t0t2tmxr oodlltemnvsatfarrrxmoot1oeeoiicilsls ea(vsnu4 lerircty1fate ieo t seumxm3io1lmtn ietasf rrmx p;o1ole mfeiatfmDumn o;() rtomf3tytfpt auei;(0 2uo(r oydop  lncs s) 2taumonu1oetnioctytfm em( ont0 lenmfcoytom raivol()seuo(m iy1lmteliviat s2ta(roou1apxomo3tadfm ua(vont)trxomf totopt lnesls0t2xrir3nu4al emiesasf 2tau  ;u1opxoifetatlm2ea(ms;(0 reoxr ootopDe nvi;s  rtoio nu4lpenmnctlsfsDta( ooo4olx  ictls m2eluvs;u4tetrxr iydlpt aivilt)t2ur(opoydomeemfvias  2umx p;o4tlto ieiat s2rauvp;(0tetnmfcoa1opte uvs t)t2xoxr3oudome liciltfaDtrxrpou1apxo i3tydfaDuanvsnu4 ltomo3iytlmt lnvs t t2toxmpoo1opeelnetas sDum(rpou0texnmo3iytfm2ulu p u0 lxrxf iodomD aivi (0s2toimpiy1al emieil( a2tax  ;o1optn ieiatfs2ulu p t0 etoiocoy1fa rau slt) eum(rpio4ll n iciat) rtmxmo;t1tpto f3tytlaDel(vo t4tlenxocootlpDelu s ()s2xoxm oy1altemici (  Dumurpno4oee if3iytfmDrmuvsnu4 etoxo tadom r nvolt  2um(m3oy1al   ncs tfs2uaxr ;o0tetnifcildfs um(vo;() rxnxo3to1om rau sls s2um(rpnu4lmtemnctlt arra(mp;o1tee micilsfs2um( snu4 lenmf oo1lp elueilt0setoimpnu1olenlnvtls aDtaumoou4oetomf3tytfs2rm( snt)artnif3oydomt  n i;s)seuoxmpnu1optn ncia()aDtaur ot0opxnmfcild s2umnmo;u0tlxoifctodfmteanvs (0 euoxm iy4lm  lieiasfs2ur(root1tlt ii3tad s2ua(mp u0arermr tadfpDr ivils0s2urxm3iodom  mfet (f Drrxront1oltn f3ildls em(vpnt)tlermo3ootoa  aieo;s0t2to(r3io1om e netls a2tmu oot1apeo ieildla2uanvs u0tlermrciadfa ean s s0t2xoir oy1aptemfcsasfs2raump;t4aexn ieilslaDrauvp;t0aeermfcio1oa r u ols)teur(m iydlptelnvt t)s2ua(rpnt0altoifctatlsDrluvo u0texoxo3totfm  luvo;( truoir iy4omt  fcilt)aDuaxronu4tpto ietysfs rm(mo;(0arerio tytopt  uvilt0t2xo(m ou1lpen netat) rtmxmonu1tleomf3iytfsDeluvs t4aeeoifciodlpteln s t truo(mpoo1lptemies s sDrmxmoou0oltomiciadlm2ua( onu)tlermfciatlmD aiei s0 rxrxopny4lltemiesl(fartrx  ;u4tlxomoctadls um(mp;(4tltrif3todlp rau ilt) rxoir nu1ape  ivias) rtr(mpoo4tltoioetytlm umn p u4aexrxrcootlptrluvols  2to(r iy1aptelicil(f rrrxrpoo1opxo o3ilsfmDrluvpnt4texnif3oytopD  ivs;(0trxrxr3nu1am nmivils)srra(r no1tet ifcilt sDea( o;t) leoxo iodfpDeli o;(0trurimpou4altelieiltfa2uaumpot1tptoioetydla2eanmpnu4 etrmfciotlmt aivs;(  euo(r3nydamte nci ()sDum( p;o1ope ioctlt a rln p;() ltrmf iodfate uvi s0t2toir3oodame  fvtlt) 2rr(roou1olen iciasfaDra(mo u4tetnmr3io1omtr uvi;( srum(o3ny1ap n ictltfsrtmur ou4olxoif3tltfm emnvsn(4trtrif oy1omDe n ols teuoxr3nydop nliet t  2uauronu0oetomoeiadlsDuaumo;u) rxrmf oo1lm eaivs ( trtrirpoo4ol  miesls)sDtm(ro;o4apxomietas m rmuvo t4tlxnxociy1op e ues;()srxoxo oo4olenlnci t) rtau poo0oet  ociytfs ra( snt0alenifcoadfpD livol() eumim3nydop  livt sfsDuru oot4olxo fetldfm ul( p;() rxrxo3oytomtrlnvo (  rtrir3iudoptnlnvi t) 2ur( o;u1apenmictas aDrmnvo;()aexoxf tytfptr n s;t)t2toxmpnu4ope livsl( aDta(rpno0tlenmi3iydlmDuauvpnu4arerio ta1lm r i s s0trtmir io1olt lieslt)sruru  oo1tltomfciltfaDem( o (0tleomf oy1fmtelieils)teumxo3no1lmte nvtl() Duaur nt1tleoioetlt m eln s u0arxrmfcia1fatrlu sl( s2xrio oy1ol nlnci sfa2ua( oou1opeo feiydfm rmnvs;(4tltrxr3iatoaD  n o (0truoimpoy4omt mfcils) rrru ooo1ale mictytfs em(vs;u)tltrxo3iodlateanvo;()s2xmxr3iu4ape mfctl(f 2rmu  ot1ale ifeiltfs2raumpnu)treoirctotoa elnvs t  rumio oodll  licils) rurumoot4oltnioctas aDum(vo u0 renmfcoodoa  au ils0t2xrio iydopenmnvia( srurxrpoo4oetnio3ilslm ean p (4tlxrxf oydfatrlieo ( setrim3oydop e fcilt sDuax ooo0tpto ictyt a ra( onu0tltrxr3iy1late nvi;()t2tmimpnu4oltnlnci tfa2ua(rono0ale mocilt m rmumon() rtnxo3iodlaD lneols0 rxr(o3iydlpenmfci (fa2rrumo;t4tpeoiictys aDelumon(4alenxo3iadlpteauei;(0trtmxm3iy1amt mivs s  rtaxr ou4oetn iciyslsDemu pnu) renxocoydopDeln o t0trurxm oo4om   feils arumxr ;o0opeo oeiltfa2el(mo (4trenif3oatlpteluvs s) exr(r3nodol e icils)srrau o;t1optoifetasfs2el(monu4 rtoir3iytlp r ieo t)t2urxm oudlme lnvt sf Drr(rpot4aeenii3ild mDemuvo;(0arxnifctytfp  aivo;(0seumir3no1lm n ictat)arumx  ;t4tpe  octasfm2emnmpnu4 etnif3oydlp  au i;()sexoxo3no4lm emfei s aDtrxmo;u0alt miciydfm2ra(vonu0texomr3oo1fa r ues t0trtr(r3iodlme mictlsfa2raur no1olxnmietltla rmnmp;t0 rtnxo iadlat  u o t0s2ur(o nodom  lnci sfsDrmur no4oexomoctyslsDrlnmo (4 etrio tydlpD  ieilt)s2xmir3iu1olt  ivsasfs2tax oou1apeoio3iydls2elu o (0tltrifcoodlpte neo s)s2to(r3oy4ol n netlsf Dtmu  ;o0tpxnii3iysfa ul(vsnt)alenio ia1fpDe nvsl(0 2to(opoydal nmnesas) rrm( oou0tpxn ieias a elump u4trenmf3iy1opDeluvs;s0 etrim3nudopen fct tfarum(ro;t0tee mfetyslaDulu sn(0trenir oatla  aivo t0trurim3oydlp elncsa(farrmxrpoo4aet  o3iltfm2em(vsnu4teenmr3to1fa rliei;t)t2xm(r3iodape lfct t s2uaurp;t0aeeoifeildfm2rl(vo t0 exnio tytlmDranei;s t2xm(o iy1om emfvt s  rtmurpot1aeto ociydlaDem( s;(4alxnmo3oa1oaDr ieolt) ruoxm iudllenmnei t  Drmxro;o1alt  ieiyt s2ulnmon(0aexoir ta1omt lnvs;s t2toir oydameelieil(  2ur(m ;o4texnioetlsfa rlnmsnu)aetoircoy1lp   neol()trtrxm oydlltnmnvt s) Dumumpou0opxo f3iltfmDuau s t4texnmocoy1om eln slt  eur(r3oodomtemfei (  2ra(mo;t4oeenmoctad s rmu o (0trtomo3ty1om   uesl( teurxrpiodom e fcslt  2trxm ou4apenmoeiadfsDrmnvp;u4artrmrciytlatelieo (0s2to(r3iy1om elfvi t)a2trumpnt1aptomf3iys sDemu o;u)artomrcoa1fpD luvs;( texmxo iy4am nlics tf Dra(rooo4tlxnmf3iysfm ra(mp;(0aetrircoodlpte ueo (0 etrxo3ny1amtnliet t s2taxmoou4teeomociytfm2ea(vp t4altrir oydoaDr uvs (0 2um(m nodap nmnvtlsfsrumxrooo4tpxoifctas mDrm( o;u4alxnxf3oadlpt lieo;s)truoxo3nu4olt  feslt  Duaxmpnu4altoiiciyt s umnmpnu)aetoifcoatfateaieo s trxoimpnu4op elies tfs2rrx  nu0apxo fciydfa2rl(mont0trxnmo tatom rlnvolt)trtrir iudole lfci t sDtmx pnt1tlto feiad aDea(vp (0teeoxr tydfmDraueil(0s2uoxr nudomtn ivilt)srra(m ;t1ale  ietas s2emn p;t0tltrxo3totla r uvs t)trxoirpno1lltelnetat)s2ur(m ou0apxn ocildlsDemnvp u0aexoxf3ty1oatraivils0 etrimpiudll n nvt s  Duau p;u1opxn ietadlmDrm( o;()aeenxo ty1fp ranvs;() 2xmir3oy4lp  lnvi sf rtm(  ot4tetoifeiyt m2ea(vs t0aetnir oatlate i i;s  2uoxrpnu1al  mfct sfarumumoou0altomfetysfs2ua(vsn()teenio ta1fmtrlu sls srxo(m3iudlp nmfes tfaDtaurpnu0opeoio3tas a rln o;u) leoxo3oadlp rlivo t)setrimpoudalt lnviatf Dururp;u0ole mieiasls2emuvs;t)trtnxr3ty1fa raueil()tetmxm nu4alt  fvsl(fa2rrxmpnt1optomi3iadlm eau p t0 etnif ootomDr ivo (0seur(o iy4altnlnvi t) Drau  nt0aptoioctydlm ean pn(4texrio oo1fate nvi t0 etrxopny4lltnmivtasfarra(rpoo0olx  octltlsDumuvs;u0alenifciatlm e uei;( srtm(o3iu1llt livtlt) rrax  ;t1apeniieildfm rmnvs t4 rxnir3todomt ln o;()truoxm3oy4opeemieil( a2rau poo1oltomi3tydfm elu s;u) etoio tadfptrlues;(0 2xoim3nodomenmivs t  Dtaxrpnt1tlxoifcias aDumu snt)alxoif3oa1op e i ols setrimpoy1optemiei t artm(rp;o0olenii3tat aDulnvp t0 rxnir oy1oaD anesl(0texr(m nu1al nmiviasfarrmxronu4tltnio3ilsfa2rlu pnt4 rxrmrctotlm raivols)t2toir ou4apeelfeiasfsDua(mo;t0alxomieiadla rlumo;u) rxrxrciodfaD aueolt trtr(rpio4al nlivils sDrrxr oo1tle  fctytls ua( s;t4aexnio3tytfaDe ieol() rxoiopiodlpte iesa( sDtau  no1tpx ioeiasfm rlu o;(4tltrxo3iy1lat lueo;( s2xm(m3ou1lle  fciat a2ur(ronu4olxoif3tyslm2uauvp;()arxomfciatopDrluvsl()t2urim io4ol  lfetl()aDtr(rp;o0tex  oeiydlaDelumsnt4alenmr3oatfpDrauvslt teuoxr iodap n ivtl()artmxm ou0oltomfeiyd mDran p;t0arxoxoctytlat aneslt)srxrir oy1ameelnvi ()aDtm( ooo1tet  i3iat s2ua(vp;u4 rxnir oo1latrluvo;s  ruoxr ny4ape  ncilsfaDumx oou4tlenioetat mDem(vo;u) exrmrciatfpt lu s () rtm(o oudol  lnei s) 2tmu o;o4tet moeiadlaDrl(mp;u)texnmocta1oaD  uvo;()texr(o oy1ame lnei ()arum(m ;t1aex ioctld aDumuvp u)tlermrctodlmD livo t srur(opiu4om  livia(fs2rru ono4tee  fcildlm2uanvpnu)aetoir tadomDelueo;s0 exo(r oy4ope lieils  ruaxr oo4opxnii3tysfa2el(ms u4tlxrmocoy1fm eanes;(0texrxm iy1om eliesat) 2ra( onu4tleoiieiysla ua(vo u4artrmf3oatoaDrlu ol(  rtoimpno4omtn fcia(fsrumum oo1oetomoetytlaDelumpnu4alxomocoo1omDran o;( s2xrxm3iu4ol n fctat)s2tmx p;u1tptnmiciadlaDrau s () rxnmo3oodfpDrli ol()s2tm(r oy4alenlfetat) rtax poo0tpenmf3iltlm2ul(vs t) renmrctodlmDeau sl( setmio3oy4ll  mieias)arraxrp;o4olt moctytlmDeanvon(4aleoxo totfm e ues s) etrim ny1oleemnvil(  rta(m ot0oltnifciydlsDemn p (4 lermf3totfm  auvo;s)t2xr(m nydap nmnetas) rrmuro;t1olxnifetadfa2um(vo (4trxrmo iadlp ran sl(0srxo(m iodlm  mfcias a2uau  ot4tlt moetyt mDrmn snt)altrmo oydlp  lu o;(0t2to(o oy1lle lnesa( arraumoou0apenioeilsfsDeluvpn() lerifctatoa rauvsls0 rtoir3ou4ap  mneils) rtm( pou0oeeomicilsfa2emn p u0 rtrmr iytlpDeaivs;t t2xoxo3oo4apeemnvsa() Dtrx  nu4tpxn ieiad sDua(mont4tltomr3ootlpDe uvils0teuoir3oodomenmiviat)a2taxrpno1oleo o3tatfsDem( p;t4tltrmo3oytopD  nvi t0t2xrio ny4ame mfvt s)s2urx ont0apeniiciytfa2emnvp u)tetoircoodoaDeanvo s0 rurxr3nydlpen iciatf rtaxrp;t4teto oetltlmDumn p t0 exrmfciotop rlu i;s)sexmio3iy4lp emfeil( arrmxm ou1opeoioctas m2rlu pnu)tleoifcoatla  aiesl(0tetoxo3no4lp elfvsl(fsDta(  no4oexoii3tls mDuanvp ()tltrif ta1lpte ies ()s2xrxm io1lmtelicil( arurump;o0tlto f3tlsfs2uauvs t4 rxoxfciydoaDrlneo s  etm(m3iu1aptnmfctasfa2ua(  ;o1apenmietatfaDemnmsnu0aeenxr3totfatelneo;s  2urxm3iy4ope mncilsf Dtax  ou1oeeomoctas sDeluvp t)tlxriocoadopDranvs t0teuoio ou4ape  fei sfaDrr(m ;u1tee mf3iad m2rl( snu4trxrmf3oadoa   u o;t0t2uo(r oodamtn ies t)arua(r no1olx mfeilslsDrmnmo;t0tetrmr3tydlm  lnes;(0 rtr(mpoudopt licsas  2taxr ou1tle  ietys aDranmp t0 lxnmr oy1oaDeanvo ()t2xoxopiydllenmnvsas srurxr ot4texn o3tld a rau p t4aeeoir3oytlm  au s t  exoxo nu1opt mnvt t aDuaum ;t4tlxoifciasla2uln o u4aeerxr3io1faDe ivo;t setoxr3ny1am nmfet s)sDrmumont4tex  i3ilt m2rmnmont4 etoifctotom eli sls  2xoxr3oo4omte ies t sDraurpno1tpen f3ilt a2el( on(4texomr oy1lpDe ueil()t2urxmpnudaptemfetl()arrrum nu0tle  fcias a2eau ont0 reoxfcio1fpD anes;( s2um(mpiu4ol emfeil(fsDra(moot4tle  fctat a eln o ()aeenmr tytoa elnvo ()sexmir oodll e ivt ( sDrrumpnu1oexo ieildfsDrlnvp;t)tlxoxf iatlp  ln o t0setm(o nudope miei (  2tauro;t0oet mi3iatfmDrauvs;u0tetrmfctotlm eauvs;(0t2xmxrpnydolee netasfarum(r nt4texoii3tls s2ul(vpn()altoif3ta1lm  luvi ()srxm(r ny4am elnesls s2taxronu0tlxoifctad a rm( s;t)texomr oatfpt  ieslt srum(o oo4lmtnmfcsl()sDua(moou1opxn oeiltfm2ul(vont4tleoir3oatlmt lnvilt)t2umir3io1amenliet t)a2rr(m ;t0tpx ioeiadfm emu p u0 lxnif tatoaDeluvs ( trxrim3no1aptemivs sfs2ur(mpnt0apxo oeiyslm2emnvo;u4 exrxociotfmteln i ( srumxm3nudomte ivsas)sDtaurpot0aetnmo3tadlaDulump u) exnmrciatla eaueolt)teuo(rpiudllt mnctas  Dtmxrono1apt iiciadfm2ulumpn(0 ltoir iytomDe ieols0t2tmxrpoydol  livtls)a2raurp;t4olt moeiadfa2ea(vs;t)alxrio oatlmteaueo (0 rtmiopoydlpt  ivtltf rrrurp;u1oexn oetaslm2em(vp;t) etrxfctytlmtrai o;t) rtoxrpiy1omtnlici sfsDur( o;o4optnifcils mDel(vs (0 lerio3oodfatrln o t0s2um(r3ny4am emfci ( s2umxro;u1tlt mf3iyslmDuln o u)alxomfciotfm rln ilt  rxoirpiydol  liet (f Duaxroou1aetomfciatla2em(von(0 rxrmo tydfmtrlnvils seum(m3nydllen fvsasfsDum(rooo0tpt  fetad a ea(vo t4 rxrifctodlm e uvils0tetrir3oy1am nlfeil()s2urump;o0ope ifeiytlm um(ms () lxnmf oodlm elnvslt)sexrimpou4opeemnesas)aDrax pnt0tptoiietyslmDrmn p t0altoxocoa1fmDean i;() exrxo3oydolt liet (  2tmx  ;u1oee ifeiyslsDemn o t4tlxrmr oodfpDraneilt  rxmxmpio4amtnmicilt s2rruroot4tpe  fciatfa2ea(ms;(0 etrio3ty1fp rlu ols t2xo(o ny4lmeelfvs t)a2urx pot1aptniocild mDuaums ()tltrxo to1opDelu o (  rtm(o3iy1omt  neilsfsDtmxront1tlxnioctydlaDrmnmo;u0treoif3oy1lm rauvsls)s2um(r oo4apt livil()a2tr(moou0altnmf3tldfm ranmp (4aeeomfcoa1latr ieo;s  2tm(rpou4aptnlics tfarurxront0ale mociysfm rl(mo;u4aeerxf3ty1oa eluvs;s0 exrio3no1opeelnctas s2rmxmp;o0tet mfetadlm2eanvo t)teeoirciatopteln i s t2toxr io4optemncilsf rrax  ;u0aex moeiyd aDuan p;(4arxnifcoy1oat livs;s t2tm(rpny1olenmnvilsfsDurxrp;o4oeeoiieiaslsDum(vp u0trxrmf3oydla e ivs;s  rto(mpiu1omtemncslt)arum( o;u4oexoiiciyd s2el( pnu) lxrxfciytlpDr ies;( setmxrpnu1ale mneilsf 2umum no0opxo fciatfm rmums t)artrmf iotomDr nvsl() rxo(m io4am elfeiatfsrua(ront0olto ocild mDumu snt0 lxrxo ty1la raneo s0srum(m nu4llte neilt aDta( o;u0tpe  f3tadlsDrmnvp t4tlxnmo3iatla elu o s setm(rpnu4omenmivil() 2tr(moot4tltoifetatfmDrau o;t4arxoxr3to1oaDrlnvil(  exm(m ou4ol e icia(f rtaxrp;o1oee moeildlaDeaumsnu4teenmfcoytla eluvils texm(r3ou1ol   ncs s) rtrxr nu0tex  fcilt aDul(vs t4altrxo to1oatr nvi s0trtoio3iydlltnliei s)srua(m no1aptomf3iydfm2rmnvp t0 leoxo ta1omD li o t0trxmio oodameemici sfsDraurpot4olxoioctat s2uau s (4 lenio3oadoaDrlneo ( seumxr3no4al n icsat)a2umxrooo1tex ioetyt sDrmnvs;t)trtnmr totfptrauvo;s) rxoirpiudame lncias  rum(r nu4tee  oeiytfs2ranmp;u)aetrmr iodlaD  ueo (  2xr(r oy4op emnviatfs2ra( pno0olxomo3ias a rl(vsnu4 lxnio3oy1fmte i ils  etmxr io4omtnmieia()srumx  ;o0tlen ociyd s el(mp u4 lxrif3totlate neol(0teuoxrpou4lme lfcsat)arrmxrono4tptoiiciysfa rlnvpn(0 ltnxr3oadom  auvs;()tetm(opoy1lleelnvi t  rurxmont0texn ieiadlaDemnvon()altrifcoo1oaDraues ()seuo(o oudop   fesasfs2urxm ot4ale  ieiysfaDum( pnt)trxnxo3ia1la rln sl(0setmxmpoudalt  fvt s  rra( pnt0texn feiysfs2uanvp;(4aeeoif3iy1lp   i o s0 exr(r iudol n nviat a2uauront1opxo i3iydfs um(vpnu4texrio iydlm raueo;t0 rxrir3oo1llenmictas  2um( onu0ole ioctadfa uln p u0 rtnmr oatfmD livi t)s2urxm3oo4lmtnlfcils sDua(mp;o0ape ioeiytla uan o u4 rxnmo oytoptr neo;(0s2umim oo1alt mfciasfsrua(rpou4oeenmoeiad aDean s (4 rxnmf io1opDelnvo;()s2xm(m3oodapenmicta(fsDuaum ;t1tlt mietat mDum(mp u0 etoircoatlp rluvsl() 2tr(m3nodope micsls  Duaxront1oleoifciasfa ea( p;u0texnxf oytlatrlivo ( seuoxo io1lmee feta(f ruaumono0opxnio3tadfmDemuvs ()trtnxfcia1lm   neil(0srxrirpio1lleelfei (  ruau  oo1apxomoetytlm elu o t0texrmr3iydlpDrlnvs s s2trir oy4amtemivi s)s2rrxroot4opxnio3ildls2rmnvon(4 etnmfcootfa elnvo;t)teumiopoodlpen ies (f 2tax p;u4tle mietltfs el(vsnu) rxoxrciatfaDelu o;t) rurir ou1omtemnvsls aDrm(root4apt ii3tltfa uan s;(0 lxomf iodlm   uvslt0s2tr(mpiydol  lieia() 2ua(mooo0tpe if3ils sDea(vs;u0alxrxf3oy1fmDraueolt)srum(rpny1aleeliet ( sDua(mont0ape mfeiatlm2elumo;u4aeeomocoydfpDe ies;s)t2xm(r3iydomtelfci t sDuru oot1aee  f3iatls ranmont0teenifctodlaDrlu i;( texrxo3no4om  mnetl()srtmuro;o4tlen ietltfm2rmnmsn(4treomo tytfa  anei;t0 rxr(rpiu4ole  ncia(f 2tm(  ot1tle mfciaslmDuanmpnt4 lxoio3iatlp   nvi t sexmio oudalenlfvsatfa2uaxmpno4tpx ioetld sDemuvs;(0 rtomrciatfatrau ol( srtmio iu1ll e nes t  2umxmont4alen f3tyt a elums t4 eerxfctodlat  ueo ()tetoxrpnu4lltelnci ()sDtau ooo4tpxn i3tad m uaump;t)altrxr3oytfmtr n sl( t2tr(opno1ol emivs s) rrax p;u4tpxn i3iadfs em(mp u0alxomfciotlaDrlu i t0 rtmir3no4alt  iviatfsrtm(rpno1ole io3tadlmDeanms u0 exoif ty1om   uvo t0 2tmxmpio1oltelnciatfsDumurono4tlxoiieiad m ulu o (4tetnxr iatlaDr i o;t0 rurir3iu1altelnvsls  rtr( onu4oeeo i3tatls2em(mpnu4tlxomo3oadfate ieols t2tm(opoy4ll n iciat aDur( pou4aeeo f3iadls raums;t)altoircoydoptelueo t tetoio nodap   ict ()a2tm(  oo1aleomf3iydfa rmu o;(4aleomrciy1lp  luvsls0t2xrxm iydole  fet t)sDra(  nt4texomiciys a ulnvo;u0 rtoxo iy1lm r ivo;t)t2umxo3no1llenmfeia()a2tm( o;o0oleo fctasfa rm( p;u)alxnirciydoat  i i;s setr(mpnudopt livtat srum(mont1oetnmo3iyt s rl(vs u)aetoio oodlmDeaues;t)trurxm3nydlpt  nvsatf 2uaxmo;u0ape  feiaslsDra( o t0aexrifcoydom rauvo;() rumio nydlmtnmnvs t)srua(rpou1tpenif3iyd s2eluvp;t4aeerxr3iodopt an ols0texm(m no1al  mnvs (  Dra(mono4aet iiciad sDelnvs (0aexrir3to1opD aies;(0 2tm(opiodaltemnciltfaDrmxr no0tlenmfciatla ul(vs;u4arxoif3iadoa ran il(  euoir3oo4omtemnviatf Dum(mono4tpe  octysfm2ul(mp;u0arerxr tydfpDrlu ilt0srtrio3no1ap eliei t)aDuau  ou4tpxomi3iydfs2ul(vp;u4trerxocoa1opt  u i s) 2uoimpiudomeelfcsls) 2umu pot4oetomfeiltfa emnvsnu0trtnxfcto1fpteaivsl(  eum(opou4ll   net s s2ua( pnt4opxn octlt sDra( s;() rtrmr oytopt aivils teumxo3oy4optemnvi ()s2raump;u4alxomo3ilsfa rluvs t0 exnir iadlpte ies;()s2xo(r3iy1apt  fcs (fsDumu ont0olen icilslsDemnmp;u0 rtrio iatomDeaivs;(0s2xmxr3no4apeelnetat  Dtau p;u1tlxomf3iytlm raums (0 lxrxf oodlpte ivs ( sexrio nydlm n fvsl()s2rrum nt1aleomfctyslaDrmnms t) ltrxocoy1fmt luei;( t2xmimpiu1olt  icsasfaDtr( onu0ale mo3iadfmDua(vo;u)alxoxf3iotfpDeaueo s srtrxo3ny4omeemncsat a2urxmpoo0aexomi3tytfs eln o u0 rxoxr oo1lmDeaueils)s2urio3nydopeemnes (fsrrrur ou4opx ii3tydfsDumn p u) eenxrctadfmDr nvsl() eur(opno1lle mnesatfaDtm( pou1oetniociyslmDeanmonu4alxrio3oa1fpD au ils0tetr(o nudoptnlfvt () 2tmxmpou0aleo iciyd a ul(von(0 exoxo oy1fpD ln ol() 2xoxm3ou1alte fcs tf rta( oot1tetomoeiydfsDelnmsn(4artrmr3oy1lat luvo;t seurio io1optnlivsatfa2tmxmpou4ole  ietys aDeau o t0aeenxf3tadfp elneolt) euo(r3iy4lp emfesls  Dumxrpnu1tlxnioeilsfaDuanvo u4alenmf to1om   neo s)t2uoim ny4ll  mieias arum(  ;u1tleoiieiytlm2umn s ()altnxo oy1fpt li ols)seurxo oo1amen ieil(fa2um(mpnu4tpxnii3iad a ran o;()trenmo iydomtelueo;s0seuo(o3ou4llt livtat a2rr(rp;o4apeoioeiyd a2rln p;()tlxoxrcoa1fmD  ieils)trur(m3nu1ale  fvtat  rurxm ot0tlto i3ildlaDemn pnu4 ltoxoctotopD  ivolt seumim ou4lm nmncil(f ruaumono1tpe  fetyslaDrlumsnu4aeeoircootfa eanvi s0setrxo oodape mfcia(f 2urxrpoo1alt  oeiad m2eau on() etoif3oadfatr nei;t texoxo io1am nmfci s) 2ur(mpoo4olt if3iyt aDraumsnt)aexoxrcty1oa r nei;t  2tmir io4ll elivsa(fsDtau  ;t0apxn ieild s2ul(vo t)arxoifcia1fp elueslt t2tmxm3nodlpe liesas)s2taumono4tpeomf3ils sDel( p;(4 rtnmo3todomDeli i s0trxo(opou1opeemnvt s aruau poo0openmf3iytfsDuluvo u4teeomfctodfmDran i;t0trurio3oydape mfes s s2umumo;t1tlxomociatfa2emuvp u)texrio iadoa raieo;(0 exo(r3no1lm nmfvslsf Dtmu  ;u1oexomictys m rmnvo;t4 ltrif3tytlp raivo;s0 rtm(o3nu4lmeemnesl(f 2ta(  nu0altn iciltlaDean pnt4arxomfcia1lmDr n o;t)sexmim3nydamtn neslt)artr(rpot0optoifciysla2ulumo t) lxnir tydlpt  i o (0teurir3iydape  feiatf ruax ooo1apen feiys s2um( o;t4trxoxo3oodfmte ueo;()s2xrxrpou1omtemfeta(f rrmum ot4alt  f3iadfs eaums (0arermf3oy1oatraiesl()s2uriopoy4amtn iesat  rrrurp;t4texnii3ils m2uau p u4areoxo3oydoate ues;t0s2urim nudopee icsl() Dtmu ooo0tltn i3ils s2rlump;()aexomf3oo1lptrlnesl(0srtmxo oudolenmnviat  rtmumonu1openmfetydfs2eau p (4tlermf totfmDe u s;(  2urimpno1aptnmnvtls artaumont4aetoio3tldfa2rl(mo;()tetnifcoytoaD  ivi t0t2uoim oo1am elfvtlt a2rru ont0oet ii3tadlm2rm(ms (0tlenxo iy1omDrlneo ( srxrio iy4ap e ivs tf Dta( pot0oet iiciat s umu snt0trermf3oydfmDeauvo s0setrimpiy4amtelfcia( sDurxmp;t0apxoifciyslmDuaump;t) lxomf ty1laD liesl( trtoxopio1alenlfciat)srraumonu4tpt mfcias s2ul(monu0alxrmfctotlpt  nes t) eurxr nu1lltnlfesa(fs2tmur ou0aeeo iciysfa eanmo () lxomf oydoa r ivo;t s2to(r oo1omeelivt s) 2uau  nu1oltn ieiysfaDemn o;u4 rerir oadoatrluvo () rtriopnudll nmieil(f rtm(  ou0apx  fetaslaDulnvo t4tlxoiociatla  lu o t)sexrxm3oy1ll nlics s)aDurxr ;o4texomoeils s2umnvo;t)tltrxfcoodoa rlneslt0s2xm(r3iu1aptnmnvt ()aDtr( onu1oet moeiyt a ulnmpn(4arerir ia1lm eaivi ( s2tm(o ou1alenmieiatfs2tmx o;u4oexnmf3iytfa2uan p u4 rxnmocto1op rauvs t) 2umim oydlpee fcs tf rur(r ;o4oee  o3ilslm2uauvp u0arerifctydoaDrlu s t  2xmim3oo4oleelnci sfsDrr( onu1ole  o3iasfsDrluvs;u)altrmo iodfptelnes ( teuoxo nodoptnlici s  Dtm(mont0teenio3iyd a ua(vpnt0aeerxf oodom elu i ()tetr(opiu4lltn feilsf Durumoot1altoii3ildlaDeanmp t)tetrio iytfpDeaieo;s s2xmxm no1ap nlictlt  Drr( p;u1altnifciyd sDel(msnu)tlxnxr3totlp ranvi t  exoiopnodopen nesasfsDra( pnu4tltn i3iatlmDem( o;() rxnmfciy1fp e neo;(0seuoxr ou4op  mnvs s)a2rmx p;u4oex mo3iad mDrm(vs;u4 exomr oa1fpDeluei;(0sexoxrpio1am  mivt s srrax o;o4oee moeilt s uaumont0 lxoirciytfaDelieils0sexoxr3iu1lltnlnei tfs2rax  no1olx if3tlsla ul(msnu0 eeoif3todomD aiesls s2xoim oy4apte ivs s)a2taxrooo1oetniietasla em( pnt4 lxrmf ia1oa  lnvs t)tetr(mpoodamtnmfvsa( s2tau pou0opxnifetydlaDra(mo (0tlenir iytlmDrlneo t) exrim oo4alt  nciatfaDtmu pnt0alto i3tas s2uan onu4 lerxfciodfa eaivsls s2um(o iydal e fvil() Dta(r nu4oet if3tysla ulnvon(0 lenmfcoydla e uei;(0srxmirpnu1ameelnvs ( s2taurp;u4tet  ieiyd a2eau s;u0texomocoa1fpDelu ol( trxoxmpou1amenlnet sf rtru ooo0optnmictat a em(vont)aeenxocoa1oa ean o t)s2uo(m iodape  ivs (farraur nu4tetniietltfa2rm(mp;t4tlxoxf3oadfp  anesls)trtmimpio1lm nlfviat s2ur( p;o0apxn i3tas m ran o ()arerxr ia1omDeanei;t0 2xo(o nodap n nvt ( a2trxmpoo4aleoiociltls raump;t) rerirctadfateau o;(  rurxopnodomen net () Drrumpno0tpx  f3iltfa2rl(ms t)texnio todfat an o s tetm(r oy1aptnlivtas a2uaumpoo1apt mi3iad m elums u0altrir iatomtelivols0 2xmxm3nu1amtemfci ( arta(mp;o1opxnmoetatfa uan pn(0artrxr iatlaDr u s () ruoxopiydap e icslsf 2taumonu4aee ii3iaslm2eln onu) lenio3to1lpD aivi;t s2to(mpiodap  micsltfaDta(mpoo1apto o3iytls eauvp u4 eermocoy1lat li il()t2tm(r3oy4am  mfvsa(fartmxmp;t0oeeo ociadfmDelu p (0tlxoxfctatfpt  u i;t)t2xmir3nudalt mfeias sDta(moou1oeeo f3iyd sDemu pnt0 etnifciytlptrlues s)srurxr3nu1open ict t)sDrm(mpnu4ale moeiasfa2emnvs;t4 etrmf3tytoa  an ols)s2tmxm iy4oltnmfvi s) rurur no0tlt  feiadlmDulu snu4artrmfctotoa raivo (0s2xm(o3nu4oleemnvsl(  rumur nt0opt mfeiasfm ulumo t4trenmr iydlp  anvs;( t2umio ny1lm nmfci t) rrmum nu4oexo ieils aDumu p u)aetniociy1laDrauvils  2urxo3ou4lptemfvi (f 2rrxmpou4oeeomictyt mDel(mo;t)trxomo oytfmDe u i t trtmxo nu4altelncilt) rrm(rp;o1tpeoifciasla2el(vs;u0 rxnxfcoatfmteanesl() etrir3iu4lm  lfet (f Dururono0altnmf3ildls ulnvo;(4 lxoxo3iadfptrluvol()srur(o3iu1apen neilt a2rau pou0altoiictlslsDumnmp u4areoxr3iadla eluvsl( seuoxm iy4lmtelfvs t aDrmuront0apeomf3iydla rm( on(4 rxnxr3iydlp  aivs;t  etm(opiodomt lnct s)a2ra( o;o1opt  ieiatlm uluvs t)arerif3ootlmDean ilt tetrim3no4llenlicsasfarrax pno4oetomo3iaslm rmnvsnu4artrxrctadom ranes;() etoim nudopeelneiatf Dtmxrpoo4alen ietydlmDrl( p ()tltrmociy1fp ranes (0srxr(r3io4ope lnctlt  Dumumoou4olto ocias s2ul(msnu)aleomo3tydlaDr ieilt0 exr(m3io1al  licia(  rum(mpno0tlx if3tltlmDra( s ()tleomrciotoaDrlivo s t2toxm3no1amenmncslsf Drr( pnu1aeen f3iys a em(vs;t)tetnxf iodfpt lnes;()s2tm(m ny4lpenmieiatfsDrmxmpnt1teenii3iadlaDumnmp;()tetrio3ty1lpDrli s;s)t2tr(o iy1olt  ncsat) rrrx oot1aleomfeiasls2ean s;u0aeeoio iodoate u ols seur(r3iu4al  lfvi () rra(mpot1altoifctat a ran o ()arenif oodlaD auesls)setmxm3ou1am  mncil()srrrx poo0aeeniiciatla2ean sn()altnxo3oo1lmtr ivil(  rtm(opno4lpen fctatfa2tm(moou4tpx  ociydfm eanmonu4treoxo io1la eauei s)s2urio3no1omtnmneiltf rtmu o;o1alto i3ilsfmDra(vo u4 rxrir3iy1lptrlneslt t2xmirpio4olt lnvia( srra( pou0optomf3iyd s2ranms (0tlerxf tatlpDe i o s0sexrim ny4amtn ivtls) rrax pno1olxnii3iltfm rmnmo;u0 lxnxrcio1fp   ivslt0srto(o3iodal n icil(fsrrr( ono0tetoioeiyt s el( s t0artrirciydlp e n olt  rtrimpoo1amt mfci (  rrrump;u4ope mf3tldlm2eau p;t0tlxnxfctadfa r i o;s0s2uoxo nydlm   nciatfsrtru poo1tpen ictydla2rmnvpnt) ltnifciydlpt  u sls0teurir3iu1lpe mfcia(f ruaumpnt0tpxo o3iytfsDuauvonu4artnif3ia1fm e nvsls0t2uoiopoo1omtn fesls)arum( pou0olxn octas a emnvonu4arxoxf iytopD auvo (0srtr(r nodlptnlivt () Dtr( ont0openiicilsfm2rau o t4trxnifcoy1fpD ai sls trumiopio1lmenlfctl() rra(r ;o4teeo f3iatfs uau p;t0teeoxf3iytlmD lueilt0texoxopnodol nmivi (  2rmu  ou0oee io3iatlm rln p t0tlxrxo3iatlmDeli s (0t2xo(opno1ol e ivi s aDrm(m ;t0tex mictldfm2ranvp
\ No newline at end of file
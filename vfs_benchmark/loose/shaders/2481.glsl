@@ -0,0 +1 @@
+uvo;t) rtoxopoodamt livsls a2ururoot0oeenmociaslm ul(mo;u)trtrirctytop rauvi s0tetriopiudam   ieilt srtau  ou1tlt  ictatfsDum(vp t4 eerxfcio1faDrli ilt) 2xmxo3oo1ole lfvi (  2rauroou1olt  o3ilsfmDrmu p t4tetrmf3iotlptr ivs;t  2uo(o3io1lm elfvi () rtaxm ;u4alxoifeias a ul(vs;t4altnxo3ootfatranvo;( t2to(m3io4ope mfciatf rumxmp;t4apxo iciytfa2ul(mon(4 reoxo3iy1fatrlneolt srurxrpny1lpeelnciltf Drrx oot4aleo feiat mDrmuvpnt)tlxomf3ootlate uei;s)srtoirpnudlleelictlt) 2um(mpnu1aexnmfctltfmDumuvonu)areomfcoytoaDr uei;s sruoxo3iudap  mfei s) Dur( pnu1aex mfcils m um(vp u0tetomocoatfmDeaues s trto(o oodlpt mfetl()aDtr(mooo0aetnio3tldlm eluvs () rxoxo oy1om r ivs;(0trtr(r no1optnmfvil(fa2um( pou4tpt ii3tydla eln o (0 ltnxfciydlateauesls teuoxmpiudoltnmietls srurx  ;t0alx mfeiadfs rmnmonu) eerxo oytfp  auei ( t2xo(mpiy4oleelnvi s)a2rax oou0ope mf3tas m uauvont)trtrif to1lmt anvo s setmim3oo4lmtelics tfarumu onu0opt  f3iyd sDelnvs (4 rxniocoa1lp ean i;t0texmiopiodap   fvtl()s2trumono4openmfeiytfaDrm(vp () leriocoa1omDeaues;s0 rto(m3oydlle lfciasfsrumurpnu1aleniieiydfsDua(vs;(4 lxnxr3tytom elieol(0 2urxr3iu1ame licsltfsrua( pnu1oex  oetldlm elu o u0 exrxocto1opt anvi s) eumxr3oy1lmeelnctas) rtm(ront1oex ifcilt a2ra(mp;() rtrmr oydfa rau s t  2um(mpio1lmtn fet (fs2um(rpou1aptnif3tad m ulnvpnu4trtnir iydomt  ieo;s)teuoio3iydop nlnetas aDuaur ;t4opeoioeiysla um(vp;u) exrmf3iotoaDraivi t0 ruoio3iydapt mfet sfsDurxronu4aeeo ictysfsDeanmp;(0 rtoxr tytoa e uvil(0seumiopnu1ameemfes t srra(r ou1ale moeiyt sDeaumo;u0aeeomr iotoaDe u il()srumio no1ap  lncs s sDuau  ou4oexomieiatlmDuluvp (4alerxr3oa1omDr n i;s0 rtrxm oy1alee ncsls srumurooo0aeenmiciytls2emuvo;(4aetrmrciytlp eauvsls0texrxo ny4alt mfcsltf rum( p;u4aexomf3iysfmDem(mo;t4alxrmo3todla rlivol( srumim3nudalt  ivtatfaDtmu ooo1ope miciat sDrmn sn(0trtrio3oa1omDe uvols0trxm(rpno1lm nmnvils aDtau poo4oexnmfctlt s2emu p ()artrxf iatlpD an o s s2tmiopnydol   nctl(f Dra(m ou4oetomociyslm2uauvp;t0tlxomo3ia1la elnvo;t srtriopoo4lme  iei tfaDuaurpnt0teen ietysfs2ul(mo;()alxnxociy1omDr uvo t t2tmio3oo1op nlfes tfarra(m no1tlt mietasls2uanvonu4altnir3iydopDrliei s)teumxmpnudol  micilt)srua(  oo1alt mo3iat a em( on() rtnxf3iotlpDe ivo t0srtm(m no1lm emfctat)srurxmpnu4alx moeildla2rl(von()artrxoctytfp   nvs t)s2tmxopoy1ll  mfviat)arua(ro;u4optomoetadfmDulu pnt4aexomr oydfa e uvs;t0 rtoim iudlpe  ivtas)a2urxmpot0tpto ociadlm rmn sn(0 exrmr3iadoptraieo;t0seumio iy1lp   ivi t)s2ra(m nt1tet ioeiad a2eau snt) lenxf3iodfaD  nvilt0trtr(opiudale  iei s sDtr(r ou4alx  f3iasls rau on(4 etnxf3oy1faDraueo;t  ruoimpiy1lme  nvta() rurum ;o1apx  iciltlm2ul(mpnt0alenxfcoodomDrauvs;t)trtoiopno4lltnmiet (f Dta(moou1tpe moeiadfm2ul( s;t0trxnxfcty1optrlnei ()sexoxr oudll emfvslt a2tax pnt4aptnmfcilsfsDrl(msn()tlxnxrciy1lpt au i ( trurxr ny1ap nlnvsat)sDtm( o;o1ole  ieildlmDumnmo t4tetnif tadoptrlnvi t t2umirpiu4alte ietas) 2ta(rpno0tleomicildfm2ran ont4 lxnxf3iadfmt  u ils)teurxo3oo1al e fvsltf 2rrurp;o1ole iiciatfaDelnvon(0 eeomo3io1omDrluvo;t)srxm(m3iy1omt  fvsat a2rm(m ;o0openioetlsla2ea(mo;u4 renmo to1oat  i o;( s2tm(o oo4omtelfcsat  Dtmx pot0aee mieild s elnmp;u) eeoif3iatoa  lueil() 2xmxr3iodapt  ieil(fsruru pot4opx iieildfs rlnmo;()texnir oa1lp raueo s)seumio3iydll e fet s) 2tmxm ot0apto iciltla eau o;t0 rxnxo3tydfa rlnvol( sruoirpny4lm  mnci s) 2urumoou4ole mietaslm eanmp u4 ltrmf3todlat  nei;t) 2toxr no4lmen fes sf 2raump;o0optn fetatfm emu o u4alxoxf ta1fat ln o;s0t2urirpio4apenlneslsf rrrxm ;o4apx  o3iad s2ul(vp t4aetnio3iydlaDe uesls) rur(mpoy1lmenlnesa()s2ta(mooo0oetnifciatls2ulu o;t) rxnio3oodfaD  n ols) 2to(rpoudop elnciatfaDurumono4oetomf3tldls2rmu s;(0artnmoctodopDr nvol()srtm(mpio1lp  lfcilt)a2raxrp;o0apenmo3iltlsDel( pnt4 rtoirctadoatr nvs ( t2tm(m3oudlpe  ivs () rtmumono0ope  iciatlm2umnvsn()trxoxr ta1late n s;s)teum(r3nu1amtn ivi tfs2rmu o;u4tltnii3ildls umnvo;(0 ltoxr3iy1lmte n s (0t2uoxo iu1amtnlfet (fa2rrx p;t1apx ii3iad m2emnmsnt0aeenxr to1la   neilt s2uoim3iu4olen ivt ()srua(mo;o0tpt  fciytfs2emuvsnt) lermfcio1opDeauvo;(0 exr(rpoudlptnmfesl( sDrax o;o1tpxoifciltfm uanmp;(0 exnmfcoa1oa e n i s) ruoxopiu1lm  mncs ( sDtau pou0tpenmieiytla ea(vo;t4trxrirctadoaDr u ilt srxriopiudlpeelnviasf 2ra(ro;u0aetomo3iltfs2rmu p;t)tlerio3totoa r ivi;(  2uoxr3nodamen icilt artax  ot4ole io3tlslsDrluvp;(4texrmr3totomte nvo ()teur(r3oo1om e nci t arrmxrpoo0apx ifetydfmDua( o;(4trxrmrciy1lm elnei t) 2triopoy1alenmnct ()sruaxrp;o0tet  ieiytlsDemuvs;t4trxnmf3ia1om e i ols0 eumxm nydalt mnci sfsrua( p;o1tlxnio3tydfa2rl(mo u0aetoir ootlptelnvilt teurir nu4al e ivil()s2urx  no0opxnmi3tad a rmu o;u4artrif3oa1fpDeaues ( srtoiopno4lmte netlsf 2tr(mpot4texn oeildfmDra( s;()alenio3iydfm  luvol()t2xrxr3no4apeemici s  rtmurpnu4aetnmfeild m2emnmo;t4tlermrciatfmD  u o ( trtrir no4amt mfcilt  2ta(mo;u0aeen fetatfa elnmpn(0aeenio3ootop  auesls teur(mpoo4ol nmicil( aDrruronu1tltnmfcild m2ul( pnt)tleoio3to1latrlivi t0seumxopno4apeemfctl()s2trxmpoo0ope mfctld mDumnmont4 eermocoadfm   uvolt)t2uo(mpoy1lmenlneta(  Duru o;u4aleoiietasfm2ulu s u0tlxnmf3oo1fm  lnvi;t  rtrxr iudom e fvt (f 2rr(m ot4ale moeiys sDeau snt) etrxocoatfmtranes;(0s2um(rpoo4ame  ivtlt a2rmurp;t4opt  octysls2ra(mo t4treoxf tytlat  iei t s2xoio3oudop   nctltfaDururpoo1aexoifeiys a2eaump t4 ltnir3oa1fp e u olt0srxmir oydllenmfcil(f Drax  nu4aetnmo3iyt s ul(vs u4 rxriociadopDrauvs;t  eurim oodal elfct tfaDuax poo1apx  i3ildlm ran sn()trxnmrciy1fp ran o s s2urir3iudolenlnvils  2rmxronu0tpt iicilsfsDuluvonu4 eermfcoydomteau slt)s2umiopno1lm emfvils)a2rrxront4aetnifeiad sDuluvp u0 renxf3oadoat lnvo s  exo(o3iudop  micilt a2tmx  oo0opxn fcildlm uaumo;t)treoxo3iodlaDeluvolt  etoxr3oy1ol nliet sf rurumpno4olt  oeiyt s2ranvp () rtrircoa1lp r uvo;(0sexrxm ny1altnmnesatfs2ur(rpno1oex if3iad aDrmuvp t4altrio3iodlmtr ueslt0 2tmio3io4lm  mfvs ( aruaumo;t4olxomi3ilsls2um(mp;(4 reomr3iadomteli o;s t2uoio oo1amtnmnvs s) rraumono1olxomieiysla ra(mo;t)tltnmr ia1om  au i ( s2uoxmpny1lpenmncs sfaDta(  ou0oltnii3tatfm2ra( o;u) etrir iydfp elieo;()srum(o iu1omenlfesat) 2tmxmo;o1openiocilsfs2ranmpnu0altnir3iotopDraivi;s sruoirpiy4altnlies ( a2tmxrpno1aetn octadla2el( p (4tlxnmr3iy1fmDelueilt0seuoimpnydap e iesls)aDrmxm ;o1oeto ieiasfaDeanvpnu4aeermo tytfmD anes;s) 2um(m3oydope lfesat)a2urx o;o1aexomo3ildla2umn pnt)trtoxf iytfpDe nvolt0t2umimpoydlpenlfei (f 2rmurpot4tlt iiciysfs2eluvs ()trenirctydfm  ln ol(0 2toiopou1altemnetls)aDtrx  no1oltn fctys sDeauvp () etriocto1lmDr i s s)trumxmpoodome  ivsasf 2ua(mpnt4oexnmo3ildfmDua(mo u) exrxocia1fptraieo;()srxm(m3iy1lmenmfei tfaDtmu  ;u4apxomfctltfm umumo;(0aeenmr3ta1opteli il(  euo(opoo1apt lncia() rrmxroot0tpxnmoeiatlm2rmn p u) rtnxrcia1omDran o s)setm(m3ny1lm  micsl(  Dtm(mo;o1openmf3tldfaDrlnvs (4 lermrciytla ran i;t)seum(rpoudol  lfeia(  rumumoou0ale mi3iydfm2rl(vp t)aetoircio1oaDe n s t)t2umim3no1al nlicil()srraxrpot4tlxo octyd a2ulnvs;()treoio3oytfa ranvols t2ur(r iodllt  ietas)sDtax o;u0optniieiytls2umnmp (4texnmoctodopteli sls)s2um(mpny1lpenmnvsat arrr(mpno4tlx iieiys m2eauvp (4areoxr3io1oatrlueils) etmxm3oy4altelivt (faDtr(mpnu1alt  o3ildfm em( s;u0teenxf3oydlmtrluvo s seuoimpoydlltemivtlsf Durxrooo4texoifctytfa2em(vo;u0tlxrmrcia1lpDeli il(0 rxrim io4lltemnet s) 2raxmpno1aptnio3iyd m uanvs ()artoxociotlatrlivsl( s2umim3no1ame  fetl(f 2tmx pou0tpt mfetltls elums;t4tlenioctotoate ueo;() exoxr3nudap   fvias) rrru  ;o4oet  i3tldfm2ulu s;u0teenxfciodomt auvi;(0trtrxm no4alee feiatfaDur(rpno4oltomietldfm rm(vo t)texoxo iodoatelu ol() rurxo3no4lpte nct s)srrrum oo0tptomf3ilslm2el(vo (0teerxocta1latran s (  rtoimpnudllenliei ( aDum(m ot1tpeomi3ildfaDuanmpn(0treoir ia1fp r u s;s) 2tmxo3oy4al elneilt)sDtax poo1olenmfeiad m ulu p;t4tetoir3oatla rlues;() rumxr oo1amtelnvs tfaDuax  nu0alto i3iasfa2eauvs;t)arxrmr3oa1oaD lnvo s)srtoxopnudope liet s)s2urxrpoo1tetn i3iatfa umu on()teenxfcoo1lat lieol(  rtoxm ou1lmenliesltfsrrmumo;o4tpto oetas m2emu on(0artrxr3iotfpDr nesls0 eumxr oy4ale micias) 2ua(r nu4altomiciad a ul(vp u) etnmo3oa1om elnei t seum(m ny1oltemivias s2ur(mo;t1aptomoetlt aDulu snu0tetnmociadoatrlieo;s) etmio ny1alte fci sfartr(r ou0opxomocildfm2rmn snu0aeeomrcto1fa   n s;(0sexoio oudamenlnvslt srtmurooo4aet  o3iasla raumsnu) exnmo todfpDelues;(0 rtmim nu1am  lfeia( a2ururp;u1tlenio3iad sDuau p u)texnirciy1fm   nvs;t) eurxr oydale lfcs s a2taurpou1aex mocild sDumumo t)trxrmr oa1fp raivils t2tr(opnydol e iciltfs2taxrp;o0ape ioeiaslmDrluvp;u0tltrxrcio1faDrlneo;t t2tm(m iy4apeemietlt)srtaxrpoo0apeo oetyd mDrau p u4 rxoxo3to1lm eluei;(0teumir nudlleemnvtl( s2tmxr ;t4tpx miciasfa2elnvont)tlermf oodlpD li o;s seuo(r ny4lmen nesa(faDur(m ;o0tpeomo3iadlmDul(vsnt4tlxoxo3ta1omD  u i (  2xr(m3no4apte ieilsfsrumu p;t0tetoifctltfs rmuvp;u4 renmf iadlmt livolt s2to(r oodlpen nvtlsfs2trxront4aetn ieiatlm rlu s u)arxnmo tydlmtr u s;()srxo(o3iu4op n ncsltfa2uaxmoot1opeomictysfs ra(mo u4tltnmr3oa1fpt ln ilt  rur(opiu4ap n feias)aDururpou1apxomoeilsfs2rmnvs;u0 exomf3tatop eli i t tetoiopiy4al e ieil()arumxr no0altomictyslmDuaump;(4aetnio3ia1omD lu o t)t2tmxm oy1lle lnviatfaruauro;u1aptnmiciltla2eanms;t) rerircoatfm e u o;( seuoio3ou4lm n ivs t)a2umurpou4tlxo ociys s2eluvonu4alxomrciatom  auvo (0srtm(r iodolt  ict ( aDum(monu4tltn oeiydlmDra(vsnu4artrxfcoy1lm  anei;(0 rtmxr3oy1amtn ieslsfs2rmu onu4apxo ietyt a rm( ont0artnircty1lp  au ilt)t2urxopio1lpe  fetlsfarrrxmpoo1tltnifetldla2ra( s;()treomo tydfpD  n sls)trtmio3iudlm  lncsl( sruaxrono1tpxnmf3iltfm2ua(ms;u4texniocia1fptr uei t0 2xr(mpoo1am e fesl( a2umx o;t1aex  feiltla rm(msnt4 eerif3ia1lm r n o (0s2toxr nudomenmnvs ( s2rmxr nu0apxoiocils a2um(vsnt4tlerio oadomte i s ()texrio3nydlmtemfvsl()arrr( pno0tee ifcild s2rm( sn(4texnmfcoo1latrlnvs s setrimpoydomeemnvi t) 2uru o;u0aetn fcilsfsDuanvp;u4 lxrxo3tadoa ran olt t2uoxmpiy1lm nmicilt) Durur ;t1tlxn ocilsfm rmn snu0 eenxfcia1lat lnvs;t t2xmio3ou4apen ivs ( a2rrx oot1opx  oetysla2rln o;()arenmfcoy1fm raueo ( t2um(mpio1ameelfetlt) 2tmx o;t1olxoio3ilsfm raums u0tlxoxociytlat aneol(0 etoimpiydal elivils sDum( pnt4teeniociysla ra(vp;t0aeeoxf3oy1fmDr nei (0 rxm(m3iudapt lneias)sDtaxr nu0tpx ii3tlt mDeau o;u0trtnmfciotfpt liei;(0s2uoir oo4ameeliesa(fsDrrx  oo1oexomfetas a uau p;u4alxoio3totfmt  i sls)teurxr ny1apeemfciasfaDrr(m ;u0tlxo ieilsfm uau o (0 rtoirciotfptr ivilt setmxo ny1lpte nvi t aDururoot4opt  oetyt s el(mo u0tetnir totfmt au ols srtrim3oo1amenmncs s  Drr(r ;o4opt if3tytfmDrl( s;()texrmo3tytla  auvo t0tetriopiodal   fcsl()sDumumpoo1opt ifeiyd s2elnms;u)trxomocoodfmDelneols srtm(r3no4lm emieiat a2tmx o;u0aexoifeiatls rmuvs;() eerxo3oatfa e uvilt sruoxopnydal n net ()aDtrumpnt4oet  ietasfa elump t) rtnmrctatomDrluvi t tetoxr io4ap elfviatf 2uaxm ot4teeo fcild a2rlump;t4aexrxr3iytlptrlies;s)srurirpny4olt  icsl(f Dumxmoot0teenioeildfa2em(vp t0teermf3ootfaDr n s t) 2urir3oo4om  lfvt s sDtr(rpot4oexnmf3ildfa rm(vo;u)trenio3oodopt luesl(0s2trxmpoo1oltemicsat aDraxro;t1tle moetadfa2eaump t4alxomo3tytfaD lueo ( srxoio3nu4am elnci t s2um(  ot1opto fctat a2eln o;t) etnmo3oytfmD  nvs t)trtrxopio1ameelncsatfsruax  ot1aexniieiasfmDemumo;u4 ltrxo tydfatran i;s)setr(opny1lm elnvia( s2rmxrpnu4ope  ieiys a2ranms ()aexoir ty1faDeluvolt texoimpoy4lleelicta( a2tru  ;u4alenii3iydfs emums t)tleoxf3tydfat  u olt)sexrxrpnodopee nvilt)sDrrur ;t1texoioeiaslaDel( s;u)areomf3iytlmD au i ( seuoxopio4om elieslt sDraurpoo0oltnmociltfs em(vo t) ltomociotfm eln ol(  rum(m3io4lm   ivt t s2uaxr ;o0oetn f3ilslsDrmums;(4tetrifcty1om  au i;s) eumxo nudopt  icilsfaDum( pot0texomo3tysla umumpnt4teeoir iytlatelies;(  2trim iu4optemivslt)aDraump;o1tetniociydfm umuvo;t4arxnxrcoytlatelieo s)t2urir oo4apee icta()a2ua(mont4aeenmfctls s rauvo;(0trerxo3ty1fptr uesl()s2urxo iy4lm   ieilt)arraxroou4apxomiciyslsDraums;(0trerxo tytfa elivs;() eurio oy1ll nlicsl(fa2tmx pno4tet  fetadfm ulnvo;t4tetomrcta1laDeluvils)texo(o3no1omenlfvtls a2tm( pnt4oet ii3iytfs2rau s t)artrif3iytlpDeauvs;t teumxo3no1omt mivtat a2ua(mo;o1altnmfctad a rmn o u)tltrio iydlate ivi;s  2xrir3no1amt mneta( srurumpou4ope iiciydlm um(mpnu)altrmfciy1opDe ies;s  2xr(m oy1lptemict (f rrmxr oo1tlxn feiaslm2emn s;u)trermocoo1lp rlivils0teto(r oo1omt micta( aDumxr ou1tltomietlt a2uanmpnu4 lxoio iotfmtrai i s) rurim3ny4amee nct ( s2urx ono0apeomf3iyt s ul(vo u4tetrmf oydfa raies;t0srxr(opoo4op  mnciasfsrum( ont1tpxnmieiasfs2rmnmo;u0aetoxr tydfpteli s t0t2xmiopoodlm e icsltfs2ta(  no1alenifciyt aDem( p;t) rxoxo3oytfmD ai i t  rtmirpnu1ope mivtlt)sDta( poo0texnmocilsfa2ua(vs;(0artrxo iodfmt lues s)srur(o3ou1apeelnesa( a2tmxrp;t1oetnioeils m rmnmp;u0texnir3ta1lpDrlues;s0srxrxrpnodlm emfvsas  2ua(  ot1alxn octasfa2rluvpnt) exrir3ia1lm eluvil(  rtmxo ny1lmte fctlt)s2rmu pnu4oex micildfmDuaumo;t)altnxr3ootlpDe ueils0 rxrxo oudomen ivil(faDraxr ou0tpen i3tltfm2ran o;t4tlxnmocoadlat an o;t0seumxrpoy1ol emnvilsfsDrm(moou1ole mo3iadfsDea(mp u0 exrxrciydlpDeaueilt0texmxo3io1lptn nesatfsDra( pnt4apeo fcias s eluvsnu4alenio tatfmtean olt)t2xo(m oy4omenmfctas)sDrrxr nt0tlxoioetatls2um(vs;t0teerir todomtrlu sls sexo(opoy1amtnmict sfs2ua(moot1aleo i3iaslsDul(mpn(0 lxrio3oadla e i o;s0trtr(r nodaptn nesas a2tmu onu1openmfeilsfaDuaumo;u)tlxniociydoa  lueilt srxm(m oy1al   fvt ( aDtrumoot1tlx moetysfa emnvpnu0arxoxo iy1faD aies ( srtmimpoydllt lfvt t aDurx p;t4altn feiysfa ulnvpnu)tetrxo3tatlp rauvi t t2toimpou1lm  licias  2ta(mooo1aeeomo3ildfa2umuvo;u)trtrmf3iy1fatr n sl( trum(o ny4lmeemivt tfsDua(moou4oeeoiictydfm2rl( pnu4 exnif iydoaDrln o t)t2urimpiy4op n nctlt)srumur ;t4aex mfetydfs2ua(mo;t0arxnmoctodomt lneo;( s2xoirpnodlp e nctas)arumx pou0oet moctyd s ranmpn(0tetniociy1fm r nvo;t0 rumxopoy1optemfvs (fsrum(rp;o1apt mociydfm rmums;t0arxnir tatlp e ueo;() exo(opny4llee ies (f 2raum nt4olxoio3iadfs2ul(vs;u4arxnmociytoa  luvi;t srtoir iy1lm elieia(fsDtru poo1opeo oeiltlsDem(vp (4 rtomr3iadfmD lu o;s)t2xoiopoodapenmfcsatf 2urx  ot1oexnmieildfm uanvonu)aexoxrciotlp e ivolt  rxrxo oo1am  lfes (f rrmx o;o1tex mfctysls ranmo;(4tlxnxf3oa1om   ues s0texr(m no1lm emictltfaDua(rpou1opx mfeiytfa2ul(mo u) eeomr iatom e u sl(  rurimpiy1lme lnct (  rrr(m ;u4altnioeiytfsDulnvont4arermoctytla e neo;()seurxmpnydale  ict tfa2tau oou0opxnmiciadla rauvo;u) lxoxociatlm r u ol( seto(o3oy1lm   fei () Dururpnu0tlxnif3tydla2em(ms;u4trxrif3totlm   u ol( texoxm3nodap nlnct t  2ua(mpno0tex mfetydlm rln onu4tetnifciodlaDelnvi;(0t2xr(r3ou4ll emfciltf rra( pot0tltnio3tltfsDra(vpn(4 lermociytfa elivi;s)trum(rpiy4ol elfvs sfs2trxr oo0aptnmo3ilsfs eauvo;(0alxrmocoytoaDr n i;s t2xm(m3iy1al   feias aDrau  ;u1aeeoifeilsfs ulnvp u4 etrmo3tydfaDelneo s)truoxr3iy4lp  liei t sDtau ono1tleomfctasfmDemu on(4artrmfcio1lpteaues t0t2xmim3nu1lme  fvslt  2rau ont1ope iictyt mDulnvo;u0aexnifctydfpDrli s s trurir3nydope lnet s srraur ;u0oex  oeiytfaDuauvp u)aeeoiocoa1lpt ln ils)seto(m3oy4llenlieias)s2rru onu4olx  i3iadfsDuln p t)aetniociydomDe nei t0srxmxm3iudlmt lici (fs2trur ou1tle iictlsfm2umnmo;(4artoio iadlmDran ols)srxoir iy4alt mnes (f 2rmu pno4ale ifetydls umnvo u0tetrxociytfp   n s;t0trurxo ny4amt mivi s) 2rau  ot0tle if3tlsfmDeanvs (4alxnif3oatopD  ivilt0teumir3oudoptnlfvs t) Dur(r ;t4tptomi3tytla uauvon(4alxoxfctatfp rlu ilt  2tmiopiu1ap n fcilt arum( p;t0opxnio3iltfs eluvonu4tltoxr3iatla   neo (0texrir nu4amtnmfcilt sDrrxm nu0oexoiiciltlsDrlnvon(0teeomo ta1omD  u s ( trtm(mpoudaleelfcil()arrmxro;u0oet ifetadlmDuan s;u4tetoio3iodfptrai ils t2xo(r3iydal nmnvias)a2umumoot4oet mo3ils a uanmp u0artnxo3totfa   nvs t  etoxmpoy4optnlivsas)sDtaurpnt4apxn i3iyt a2eanms (0 leoxociatopteaies t0setoim3ou1olt mies s a2tr(r nt1oltn fciyd aDrl(mp t) rxrmr3ta1om e ueo;t) 2umxo3nudolee ncsls srumu  nu1oeenioeilsfs eaump;u0trxrxo tydomDrluvs (0seuoxr3no4ll emncs () rra(rpoo4tptn ictld sDulnmp;t)altrif3tadfat lieslt0t2umio3io1lleemiviasf rraxrp;t1tle  i3iysfm ulu o;(4 leomf iy1lpteaueo ()trtrio3oodllee nvsas  rtaxmpnt1tlt ifciad s2um(vsnu0aetoxr3totoaDrlieo t srxmxmpny4ll emfvi s sruaxmo;t4oltoio3ilslm rauvp u4artoxo iadfmtelu s;s)texoxr io1lptelieslt  rur( p;o0tlen f3tysfa2rmnmp u0arxoxrcootlpteaivo;t) 2uoio3nu4om elictlt srtm(  ;t4tpxn ieild a ranvp (4artoxrcia1op  luvo;t  rtrxrpnudopenlivilt arumu  ou1aeto feils s2ua( o u)trxnif oy1om eaies;t)seumxm3oo4am  mictl()srrm(rpnu1oee ii3ild a2ra( o;u)texomr ia1lpDeaueslt0setoxrpoodop nmivtat)arururpot0olxoio3tytfa2uauvp u)trtnir3iotop eluvils  rtrim no1ap nmfcs ()a2trxr oo1teeomfcildfm2ea( pn(0 rtrmf oa1om e ivs;t  2umiopno1ll  livs sf 2urx  ou4aexo iciasfs um(mo u0 ltnxoctadoptelnvol(0 etoxrpnodlleelfesl()artrurpnu0apxo ocilsfs2rm(vo u0aexoxf todoaD aivs t) exm(rpoy4lle  iei tf Dtmx o;u1apenioeiadlm rlnvont)arermrcia1fmtrlnvi;()tetmxr nudol e fet t)sDtmumpoo1oleomfciaslmDul( s;u4alxnio totfatr nes ( t2xoxmpoodal   netas)arra(m nu0tetnmictls aDumuvsnt)tlxoxo to1lp r u sls seurxopiu4ame  fesltfsDtr(m ;o4ape if3iysfmDelnvsn() etoxr oy1om raivi;s srxmir oudape  iesatf Dtr(m nu4aetn ieiltfaDeanvo;(4areoiocoydlaDeaivi s seuoxopiodalenlicia(  Dumu p;u4tptnifeiadfsDuaums;u4tltoxoctotomDe i olt0setr(m oudop emfesat)a2rax p;u1oltoiieias s2ul(mp;u0aeenmo3oa1la ranvo;s  rxmxrpny1ap nmicsls a2urxrpnu1apx  ieiadfa2ea(vs t0 rtriocio1late ies () rxmirpiudop   nctl(f Dtaurpnu4altnifctldfa2rmnmpnt0treoxocoydlp rlnvils0 2tm(rpnudopt mfvtls) Durum ou1olenifctas a uln onu0tleoxo oytop rlneo s)trumir no1ll  mnvs s)aDraumpnu1tpx iieiad sDuluvsnt0tlenir3todfa eluei t0srumxmpnu1amen nesas aDur(r nu0ape mocildlm umu p;u0arerxr iydlm r nei;s0 eum(r ou1am n netlt sruax  ;t1oet mfciyt m ua(vo u)tltrir3iytopteauvo;s0sruoio3iu1lle mivt sfsrumumooo4aptomociysfm2ea( s;t4tlermf ty1om  aues;t0 rur(m3iy1lmt lnvslsfaDuax  ;u4ale iiciyt a rm(ms;t0aexnxf3tadfpDeaueslt) 2xmim3nu1al nmfvtas s2rmx p;o4oex mi3ildlmDrlumon() exoxociodopte uvils)t2uoxr3oodal   fesls a2urx poo1oexo fctasfsDeauvp u0aexnir3iatfatran ils srxrxr3ou4apenliciat) Drmumo;t4tpe  o3iyslmDulnvpnu) lxrmo3iydfp r i slt)srum(m oy4lm nmfes (  2umx o;u4apeomocildlm uaumont4trxoif iy1faD anvo s)texmxo3nodal   icil(fs2taumonu4tlxo ociyt a2rmumo () lerir3tatla  livslt0t2tmir nodlm emfvsl()srtaumpoo0tpxoiietld a2ua(mp u) lxrif3tytlmt  n o ( t2trxr3iu1opeelfei () 2um( onu1tex mfctytlaDel(vo;u0 etnxr io1oaDe ivolt0trxoxr3oodap nmnes t  2tau p;t1alx  f3taslm eauvo (0aetnmo3tytfmt anei t0srxoirpnudlmtelfcia(f rrmxrp;o1ale if3iasls rlump;u0aexoircta1oaDraues t0srxoxm oy1llee ictls) 2tmu  ;o0tpto i3tytfs2elu o t)artoxf oo1oate neol()t2toim oo4ape  ivtltfsDuaxr ;t4optn octytla ua(ms t)trtoxr ta1fm e n ils tetmir iodlp   ieslt aDtmx pnt4tpto o3iatfs2elnvpnt) etnmr oo1om  lnes;t sexm(m nodal nmfeias  2umx  no4tet mf3ilsfa ra(mo (0altrif iytlm  ln slt  rtrxm nudaptn fctlsf rtmxr ;u0oeenioeias a ra(ms u0aleoxf totfmDrlu i;( tetrxrpnudlp n fctls) Drm(m nt4tpx  o3ildfm2el(mp;t4 eeoxf3ty1laD  iei s)trxrio3iy4apee nesa( aDrr( oou4tleo i3ilsfsDum(mp;u)alxnxfctadlat livs t0t2xmxr oo1ome liesltf rur(rpoo4olt  oetyt s elu on()tleoir3oytoaD  uvi;(0srumxr nydlptemfvsa(  Duru pnu1opeo ociytlm rauvs;t)aexrmf oydla  lu o;t0srurim3oo4om elnvtatfaruaxm ou0aptn ieiydlsDua(vp;u4trtomf3iadomDrln o;( tetrxo nydll emfei t  Duaxrpnt0tptnmo3tytfs2rmuvpnu4 leoir3tatoa eaues s0srtm(m oo1amtemnvt (f 2trur nt1tle  iciyt s ul(vsnt4aeerxf3tadlp  lu o;() rtmim3iu4ope mfvs (  2uaxrpnt4opxnmietysfm2eaumsnt4tlxomfcoy1fm raivo t sexr(m3ny4llt livtls)a2tru o;t0texoif3ildlaDeauvp (4alermo3oatfaDe u olt)s2tmim3nu4lle  ictlt) rraum oo4aleo icildfm2rlnvsnu)trxoxf oo1fm  anes (  euoimpiodaltelfctl() 2tr(rooo1oexnmfctat s2rlnvp;t0 lxrio3ia1laD aueo;t)teur(mpoo1optelfeslt srtmx p;t0oltnmfetld s uaumo t)trxrifcoatlmDean o (0s2urxopou1ame  nvsa() rururpnu1optnifetldlsDumuvont)altnmocty1om  ln olt0s2to(m iy4lm  lfvt ()aDrmum ou4aee iicils m ranvpnu0teerxf oydomt  i o t trxm(opoo4am e fcta( aDra(mo;o1tlen ociad a em(vp;t0trxoir3tatlp rlieil(0t2toiopiydll e ivs sf rtaxm ;t4apxomf3tltla2rluvp t) eerir ta1fpD  u ils) eumxmpnu4lm   ictat  2raump;u1tlt mociyd aDran s;() rxoxr3oatlm e i slt t2urxopnodom nlnvsl(fsrraur ou0altn fciydfmDuan s u4alerxfciy1fpDran slt)srtrir io4ame  ietas  2trxmp;t1apt mociydla emu o;(4alenir3tadla   uvo;s)sexrxmpiodop nlnctlsf Dtrx o;t4aetoio3iltfm ulumo u0artnxo iadfmtrauvs (0texoxopiy4llt  nei sf 2truroou0ape mi3tatfs eanmp;u0tlxoiocio1omt lieilt  exoio iy1lmenlnvta( a2tm(  ;o0aee if3iydfa2ua(vs u)texrxr oadlmte ieo;s) 2xmim3ny1op elicsl() Dumu  oo0tptnmi3iytls2rl(mp;t4aetnmo ootfmtraivs s0sruoxrpoy4ome lfeilt a2tmu  nt1oexoiieiltlaDranmsnt0 exoir3ta1fat lnvi;()setr(o3nu4om n nvtlt)arrrx pot0altnmieiltfa2umnmon() rtnircia1lpte ues (  rxo(o3nodop e fetl(fa2urum ot0alen i3iyt s ulnms t0trerxrcoy1oaDeln s s0srxrxmpno1amenmieslsfaDtm(r oo4oetnmfeiysfm elnvs t0tetoxf oy1faD ai i ( truriopiodom emnvsltfaDrr(rpno0tpeomieiad sDrm(vsn(4 rerxfcoo1fa elivi (0trxoxmpny4op n nesl()arumuroou1oleo iciad mDuau p;(4 eeoir oy1oaD au o t0seuoxmpnu4lleelnct ()s2raurp;o4alxomo3tyt m emu snu0 rtnifcoadoaDeau s;(0texrio iy1lp emietat sDraumoou1oex mocilslm2ua(vs u) leomfciotfpteluvo;( setrxm iudlptemivt (  2um(rp;t1optnmiciasfm2elumont0tlerio todlpDeluvo t0t2tmxo oydoltemneta(  2rmxm ;o4apeoio3iadfa emu snt4trtoir oo1lptrlnes;s)t2urxmpoy1lpenlncs t sDtm(mont4opxoio3iat mDrmu p;u0arxrmf3iatfa rlieo;s0trxmimpoodlmt lfei (f rrmumooo1oleniieiyt sDem(vs t4trerxrcootlpD anvolt0 2trxm iy4lptnmictl(faruaurpoo1apxn o3iytlm eau pn(4tleniocoo1oat lueslt srto(m oy4lm  mietlsfsrumur ;u4oltomfciasfs ulnmonu4 rtoxf3oydfa eanvi;t0 rxoir iodalte fesa( a2raum nu1opx iieilsfmDel(ms u4aeeomrcoy1fm r u s s0srxo(opnudol emfvilt)arrmx  ot1altnioeiyt a rlnmo t0trenifciy1lmDeaneo;()t2urxo oo1op nlivsa(farrrx onu1oexo f3iat a2umn p;u)tetrmo oa1oaDrlies ()trxm(o nu4al nmnvt ( artrxmp;t4aex  i3iyslm2ranvp t0trtoxrciy1laDe nesl( sexr(r iodlpeemncias srtru oou0texniociyd m2raump;()tetoif todfmtrln ol(0 rtoxm3io4oltnmieslt  rtr(r no0oleomoctldfsDrmnvs;u0 rxnir tydla   nes;t  2urirpiy4apen fctasf 2tau p;o0oleoifctldfaDua(vpnt4 etrifctytoptelieo s0srto(rpnudopte fvtltfsrumxm ;u4aetoiieiatfa2emnvsnt) reoif3oatlat anvs;() euoim3nodopee fcias)arur(mono0oetnmi3iydls rl( sn(4 lerxo3ootfpDeau sls  2xmir3ou4aleemnvs tfsrumx  ou1aetnifeiyd m2emu p ()tlenmociatfpte uvo;(  rur(r3iydll nmncils  2rmxr nt0alxoii3tas s2ea(vp () ltnmfcoatoaDeai slt s2tmim ny4am nlivtas)artr( ono0apx mfciadfm rln o;(0altoif3iodlp r u i;()seuo(mpoy1omee fvtls a2ra(m ;o0aleoifeiad a ean o () exoxf3ty1om ranes () 2tmim3iodlpeemiet (f 2trxmoot1oee moctyt mDuln s;u) etrmocty1faDraieolt) eur(o3oydlpe  fvtasfs2rmuroou1tpen octatlm2rmnvp u)arenxrctotlmteauvilt trto(opoo4lptn ictl()sDrr( o;o1oleo oeiytfs ea( o t0altnmfciodfaD aiei t)trtr(rpou1apen ivtat srtaxmp;u1tee  f3tydfm2umnvs;t4alermrcio1laDeaieo;t0seto(opoo1ll e ncslt s2rr(m ;o4aetomoeiys sDrlu on(4arenircty1fmDr nvo;(0srxo(opiudaleelncsa(  Duaumoot1alxn o3tldls rmu s t4trerio iy1oatr uei t) rxmxm ou1am  licslt a2tm(mpot4opeo o3ilsfmDrmuvo u4tleoif tadlpDrln ol(0 rxoir oo4lp   ivs s  2uru pot4aexnmfcias sDum(mpn()alermo iytfaDrli ils) rxo(m3nydlm e nct t) rrrxmp;o4teeomo3iltfm2eanvo;()altrxf iadla  liei;()trurim3iu1lmt  iciat) rua( oou4texoioeiad m2el(vo;()aetrxf3oodomDrlu ol()truoio3oudol n nvsl()aDtrumpou1olxnii3ildfs ranvo () exnio3iytlate nvs s)t2xmim oudapenmicil(  rumum nt1aeeoii3iydfsDuan pn(4altrmr3iytlp  auvslt  etmimpny4lltemnvsat artmur nu4oltnii3iytfm eln o (0tlxoioctadom r ues;t0trto(r oydlp  lfes (f rua(monu1aleoii3tat aDumnmp t4aexoio iydla r ivsls s2xmio nudllt  ictltfaDta( oou0apt io3tasls umnvs u4trxoio ty1fm  li ol(0s2tr(m3nydapenlfeiatfsDrr(  ;t1aexo fciytfaDrl( s ()alerxr3iatlm rli o;(0t2uo(rpoodapt  ncsat)arraxro;t0tpto feild mDemu o t4 rxnmf3ta1fpt auvi (0texoio3ny1lle miviltfa2tau  ot4opto fciat aDelnmp (4tltoir to1faDraivo;( srtmxopoy4open iet ()sDuauroou4tpxomociatfmDuanmp (4arerif iodfa   i i;()trurxr ny4lpt mieilsfaDraxr no4tlx  i3iys s2umnmo t0artnmf oydlpt ln o s  2to(m3oydllt  ieilsf 2ta( ont4tpt  o3iatfm2rmnvp;t4tlxoio totom r ivilt)trxo(m3nu1al  mfeslsfsrraxrpnt1apxniieiydls2emuvo t0 eenmfctadop  lu o s)texoxm ny1al  mieiat)a2raumo;t1aee micildfaDuluvs;u4 lermr to1lpte ieils trxoir nodolee iesls aDta(mo;u1tltnifciasls2el(vp (4 rxnmfcoytfmt aieo t)t2tmxmpno4aleemics ()aDtaxrp;o4tltomi3iytfmDulu s t0 lxoir to1lmteln s;(0seto(o oy1amenmict (fsrtrurp;o0tee mf3iytlm ea(ms;t4altnmo3oy1la eli o;t) eurxo3nu1omen ies t srtaumo;t1opt  i3iaslm2rauvp;(0aexoxrcoo1laDr ueo s)s2tm(m3nu1llt miei ( a2uaxm ;t0tptnmfeiys a uanvs (0trtoxr3tadoa  aieilt) rtm(mpoo1omt liciat  Drrxronu0apxo i3ild s eluvs u)arxrxo iydfmDelueilt)trtoim3no1al nlfesasf Dtr(ront0ale  i3ilt m2eauvp t) exnirctydlmteaivo s0 rtm(rpoy1lmtemnctls a2ra(ro;u0aexnmieiyd m eanmont)tetoxrcoa1lm elueo t0s2xrim oo4lmt  ncsl()s2rm(ro;u4texnmietadlmDra(vpn(4alerio iadomD  uvo;s)texmxm3nudlltemiesl()arur(roou4tlx mfctat aDul( p t)texoio iy1fmD lneols seurxm3io1apen netat sDtru  nu0alt ifeiys m2em(von() lxrxocoadfpt ln sls  rumxo no1lpee fcsa( a2tmumpno0alx  fctadlmDeanvs u0 rtrxr3oytfpDr ivs;s  rxmxrpnu1olenlfct (f 2tax  ;u1oet mf3iadfs2ran o (4aetrxf3ta1lmte nvo s0 exo(o3nu4omt lfvtl() 2rmurp;o4oet ii3tyd m uanms u)tlermrcoytopD  nvsl(  euoim3nodolt  nvs (f rrrxrpou4tpx ioetltfsDrln pnu4aeeomfcoo1op  anes;(0s2uoirpoo1lmtn ivi t)a2tmxmp;o0apt ifctadlm2uau p u0 rtnif3iy1op eaneols) 2ur(mpiu1lmt  ies sfsruaumpou0aexnmi3iys s2ua( pnt0tltrxo3oydoa  lu i (0 rtmimpno1omtelfeilsf Dur(r ;t4openiociydfm2ea(mpnt) rermr iy1laDr nvi;(0t2toxo nudal   fei s)arur(mo;t0tptn ictyt aDum( s;t0artrmfcia1oa elivo;t0texoir oy1ope lnei t aDuau  nt4alto feilslm2uln s;u0alxoxociodla raueols)t2urxm3oudlmtnlfctl()aDrm(rp;u1oee io3iltfm2uln p;t)arxnmr iy1omteln o s) rxo(o3iy4optelies (  2tm(m ;o0alt iocils a ean p;() reoiocoadomteaiei;s)texrxo3oudopenmivsl(fa2um(mo;o1aexoii3iltls2emnmsn()tltomf io1lat auvslt s2toxm3nudaptn fvtlt)sruaxm oo4tlx iociysfsDuan s;u0 eenxrcoytop r ivo;t)sexrir ny1lpeemfciasfa2urx  ;t1tptomf3iysfm2umu s t0 lenmr3io1fp e n i s)truoir oy1lp nlnct t s2rm( ooo1tpxo iciatlsDemuvp (4alxnmf oo1fat lu sls)trtr(r oy4lmtn fcil( sDumum nu4oex  i3iltfs2umuvo t0 lxnir3iadfptr uei;s)seurirpiy4al nmnviatfsDuru p;o4aleoif3tatls rl( snu0texoxf3ootfmDeauvi;s0seuoio3nu1ap nmfctlt)aDrmurpnt0alen feiatlmDrmnvp t4 ltoxf3iadfpD aivs;s setm(r no1omenmnvilsf 2uaxmp;u4apt mociadfsDuaumo t0 lenio3to1lp rlnes s) eumxo3ou1amtnmnvsatfsrurumo;t0altniictas s rmnmp;(4aeenmo ta1lm e iesl()srto(o iu1opee fei s) 2rmxront0tetn ieilsls eauvo (4 etoir io1fmt  nvols)t2tmxr io4oleemfet sfa2rrxro;o0teeomf3tls a ranms;(4 reomfcoodom rlnei ()srtmxr3ou1lltnlictlt)s2ra(rono0oexo ietysfm ea( p;t4 eeoir oy1fm e iei;t0srxr(r iu4al elnet sfsDuaum nu0tlx micias aDum(vo (4 lermfcto1oat  i i ( teurir nudlpen nvsls sruru ont4oltn feildfm uauvs;(0 etrircty1faDr u sls t2toiopoy4llen ncs ( aDta(  no0altomieiltfa2el(vs;u4altoif3oadlm rli i;( t2toxm oo4omt  nctl() rumuronu4tptomociadfm umuvont)arxrxr3tytfa  anes ( s2uo(o io1lme  fvtlsfsDtm(r oo1apx  f3iltlsDrlu s (0 reomrcootfpt aivo ()sexmxr nydam emnei t) 2tau pnt0tetn ociyd aDul( pn()tleomo3iotomD  nvsl(0t2xmio ny1om nmivsa()sDtr(m nu0opx mo3iltfa elums t0 exrmf3tytfmDrai s;t  2xr(m nydapee fciltf ruaum oo1tee iiciyt m eln snt)alerio iadfa eaies () eum(r3no4lpte iesls)aDtrxmpnu0oet if3tltfm elnvs;u)trtoxo iatlaDeaieo t)srum(opno4amte ieil(  Durumpnu1oexoioeilslm rmnmp;(4 rermr3oa1opDrai s t) 2xrim3iydaltnlici t sDrm(  ou0tlxoifctltfs2el(von(4 rtoircoydlat aivs t texmio ny1amt  nesa( a2urxrpot1apx ifeils a2um(mp;t0 rxomoctytoaDe n i;()t2xo(r3oo4apeemfvsasfaDrau oot4tex mictys s2umnvs t0aleriociydomte nvslt) etm(m3iydolte ncilsfaDtax  no1opx moeiad m2umu snt0 ltrio3oy1opt ai i;()s2xr(o io4llen fvt tfsrtmump;u0tptnifeilsla2elums;(0tlxoxfctodfm  li s;s0teum(rpny4lp e neta(fartmxront4tle mi3iatlm rl( p;u) exnmf3tatfmD an i s0setoir oo4omenmnei (f rtm( pnt4oleoiicilslm2eauvpnt0altoxr3to1omtr n i s)trto(m nudole  fesls)srtm( p;o0apxnmfcilt sDem(vs t) ltnir iodlaDe ivi t)t2xrxm nu4ll nmnei () 2rr( o;t4openiicild m2ua( p u4 eerir tytoaDranvi;s0 rxmirpiydape lfcta( sDtau pno4tlto i3iytfm rln on()aeermrciatfpD lneslt)s2xm(r no1al  mnctl(f 2rmxm ot0aptn fetadls2ea( p u0aetoxr tytlpDeaivo;s0sexmio iodlp elnvi t srtru p;t1tpx  oeild aDul( o;(0 lxoio ia1lp  anvilt0 2xmxo3nu4om emfviasf rtmu  ot1alx  octltfsDumu p (4 leoxrcoatfat an s ()t2xrimpou1llt mfet sfsrta(mpou1tpx ifciyt s2elnmo t)tetnir iytfp eluvol()t2ur(r3iy4om  mieslt) 2uax onu0apx  oeiyd a2rmu pnt4aetoirctadfmDelnvsls0tetrirpnu4al elnct sfsDtm(rp;u4oexnif3iatfsDrlnvp;u0 rtoxo3oo1lpDeaivsl()trxo(rpoudlle mneilt sDrmurpou0tlt iiciatfm rmumo;u)texnxfcoadlp  auei;t  etoxo3oy4op n nei (fs2ua(mo;u1aet  f3ils a uan s t0alenmf3oy1oa rai o t s2trirpio4al   ncil( s2rm(mpot1aeenifeiysfsDua(mp;(0trtomf iadoptr ies;s t2uo(opoy1lmt  fctlt srur(r oo1opeo fctltla2ean o;u4aeeoio oa1la eauvo;t0srtoir3iudom elfctl( s2rmxro;u0oeen ieild sDrm( s;u)altoxo ta1laDelueol(0 rxoxm3oo4lp nmfciltfaDtmxmoou1tptoiieiad s2rln s;u)arxriocoodomDr nvo t0s2xmiopny4olee fesls  2rau oot4tptomi3tasfs rlnmp;t4arxoxocoadoa  aueo;s0t2xmxr ou4ap nmfetat  2trur nu4aee io3iatfsDeauvsn() rxrir3oatlmte ivsl(  rum(o3no4apen nvsls)arraur ;u4apxomf3iadfsDulnvonu) rxomr oodoa ran sls0s2trxo iu4om elneilsfsDtrxm ;u1tpxoifeiat m2ranvo;u4 rtnmr ootfmDeau ilt0 eum(o iy1omt mnes tf rum(m nt0ape  ociydfaDuanvp u)aexoir3oydfmt luvi ()s2xoiopiodopeemfvt () ruaumo;o0tpeoii3tldls uluvo;u4 rtnircootfmtrlivi (0s2tmio no1lmt lnct s a2taumpou1texniiciys a2ul( p;u0artrmf3oytfateauvi;s)trumimpou4opt mneiasf rtmxronu1tlx mfctydls2rlnmp (4treoiocoydfmtelies t0setrir io1oltnlnei t sDrmx ont0aetoioetytfa2eluvs;u4altrxoctodoa raiei;s teum(opio4ap  mnvias) rrrx ono0openmfctyt s2uaums;u0teerif3oo1lpt anvo;t) exmir iydap  mncil(  Dtmxr no1apxn o3ildla2umn o;t0alerif to1fpDraiei;t0seuoxm3io1am nmict tfsDum(moot0tpt if3tldlm2rmnvsnt) rxomfctydomDelu sls)t2urxr io4alt  nvsat sDtau  ou1altn fetytfa rau o u0 rtrir tatlmD anvol(0trxr(o3no1lp  mfvs tfartaxmp;u1oex  ociysfm2rmuvo;u0alenxf iadfp eli ols0t2xr(rpoo1lm nmivta() 2tmxm nt1aet mi3tyt a rl( pnt4trtomf iadom raieo t t2xo(r3nu1lmt lfet s  Dur(ro;t4olen fetldfs rl(vs;(0artrircoatlpD luvs t)s2uoim iy1lptemnei (f rtmxmo;o0oexniicils s em(vo;() lerif3iytlp rlivi s  exrim3iy4apenlfvsa()a2tmxmooo1apt  f3ildls umn s t) ltnxo3oadlpDrai sl( seur(m nudap nlnctasfaDumxrono1tpeniietltlmDrlums;u4 lxrxoctadfpD ln ilt0srtrxm3iydaleelncta( s2ra(rpot4teeoifeiasfm2ulums u) etnio ta1lp e nes t0setm(rpny1om elictasf Duau  ;t4oexo ieiltfsDulumsn() lxomf iatomD anei;s t2xmxr3nu1altelicsl( a2raumo;u4olenifctatfm2uan pnu0texrmf3ta1fa e n s;s)srtoxo no4olt mici () Dtaump;t4alx moetas a elnvont0aexnxocia1fpD livslt)s2uriopoudol elivsl(faDtmxmp;o1ale  fciat m rmn s;t0 rtomr3io1lmDeaieol() ruoxrpoydam   ncsat sDtr(mo;t1apxomfctld mDra( p t)trenir iatoa  an sls  etrxm3nudoleemnetl(  2umxrono4tleoii3iat mDrl( p t0 reoxo3oy1oat ln sls0setr(m3ou1opt mieta(  rrmxrono1aeto feiydlm eau o;t0trtnirctotoa rlnvi;s setrxr ou4ale  feslt  rurxm ou0opx mfciltla ua(vont) rxnmr3ootfatelu ol(  2triopio4ape  fci t)a2tm(  nt0oltoioeilsfmDrau snt0arxoir tatoaD lnei;t  rtmxm3oodapenmfvta()a2tr(mpou0tpxoioeiytfsDrluvpnt4aeermf to1fa ean olt0t2tmimpou4alte feia( aDumxro;u4alxn fciytfsDrln o;(4 etnirctadfa   nvols  2xo(o iudlltelivtas) 2uax  nu4oexnifciad m um(vs;u)altoxo3iodoatelivi;()trtoim ny1am elfcilt  2rr(m oo1olenio3iytfa2rl( o;t)aexnirctydomDelnvs;()t2trirpoodalee ict s a2um(mpou0oet iieiasfa2umu o;t)aeenio3tadomt livslt s2uoxm io1llenlnvs s aDuax p;o0alxnio3iysla um( o;t0 rerxo oy1lpt  nes;( trumim io4apenlictl( srtmx pnt1tetomieilsls2ul( p t)arermo tadfpte ivs s  2uo(rpoo4ameemfvsltfs2umx pnu0aexoiociys s ul(msnu4aeerif iadfm  au o;t0 2xoirpou4op nmnvtl(f rum(  ;u4aet ifciyslm2rauvo u4trenxf iy1fptrlies t tetmxm oo4lpen feslt arraur no0alx  fciaslm2el(vs;t4treomr iatoa  ln s;s)setr(r io1lpt livsa() rrmxr ou0apx mi3iyt m2umuvo;(4areriocoadlatraivi s)s2tm(r nydap  lnetls)sDua(mp;u4alx  o3tltfa2emn p;u) rtoif3ootop raivo;s s2xo(r ny1alt mncta(fs2ta(roou4openiicilslaDulump;() reoxf ty1oatrauvs t0t2urxm3oy4lmtelnvtasfs2tr(rpnt4tpxoiocildfsDrmnmp;t)aetnxrciodlate i o;s t2xrimpny4lpt mnvsat s2rmxrp;t4ape mfcild mDum(vo t) lermfctodfaD  i sls  exmio3iydamen iet ( srrmu  nt0oex ii3ildfm2ua(vp;u)aexrxf3oy1fatelivil(0trum(o iu4ol nmiesasf 2ua(mp;o0alenmociydfa uauvs (4alxrxrcoa1lm  lieo;(0tetrxmpnydam nmfviat  rrruroot0aeeoiictlslm2rln s t0aetrmf iatoaD li s (0t2uoio3ou4lpeelnvta()sDrr(  ot4aetnmfeilt sDulums u4 lxrxf3todfmte uei (  2xoimpiy4alt  fcil(  2ta(m ou0tpxomoetldfsDrm( onu0arenxr3todfp e uvs (0t2xoxr iudomee fcs s)arur(ront0oltnifeiasla2um(vs;()arenio3
\ No newline at end of file
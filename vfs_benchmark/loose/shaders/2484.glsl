@@ -0,0 +1 @@
+nvs;s  exoxr oy4ape lnvt s a2tr(r nt0apto ociasla2rmn o;t)aexoxo3oatfm   nvil() etoxr3iu4lptnmict t)srumump;u1opt iiciysfsDean p;u0 exrxfcoo1fptranes;s)trtrxmpoy4amenlfcs t)sDtm(  no0texn f3tltfa2el( s;()tetrxr iatfa   ues;s0sruoio3oy1lmenmfctlsf 2um(mpnu4ole ioeiadla2uanvsnu4tlenir3tatfm rli o s trtrimpoo4ll e ivtls)sDrau p;u1oet mictltfaDumumont0alxnxf3tydfpDe neil() 2trir3nodll emfvt sfartm(rp;t4olxnio3tltfm2uaumo;u0 rtoxo3iodoptean sls teum(r ny1am   ivtas sDtau ono0opeoiietasfs2ulumont4 lxomf3ootfaD luvs ( trxmiopnudapee feiltfsDurumoou1oeeo o3iltla um(mo t0teermr tytop r n s (  rxm(o io4lpe lfvs (faDraumpoo1optoiociydfsDrlnms (4 rtnxf oy1omt lnei;s0seur(o oy1altn fvtat  rtm(mpno4alt micildla2rau s;t0 lxoxr iadfaD au s;(0s2xo(r nu4ll  mfeils) Drrx  nt0tex  octldla um(vo;(4trtomoctodomDrlivsl(0trumir3ny4lmt lfvtasfarumx  nt4aptomfetadlm ean on(4tleomr3tadopteauvo s)srxrxm3oo1op  mfcias  2um( p;o0openifciadfsDel(ms t)trtnifctydlptelnes;s0trum(r nydaltn fviat)srrrx pnu4tpe io3iyd s2rmums ()tetnmf to1lmDe nes;s)texrxo oo1lpt  fcia( aDraxmo;t4aet ifeiys mDeln snt0 rxoxr iy1op raiei;t)trto(o3oydolt  fct s aDra(rpno4open ictytlm2um( o;u4teermf3oadopD  uvi;s0s2ur(m3ou1opt lictlt  rtr(m ot1open ociat s rluvsnu0 eeoxo3oatomDraivo t0 2trxm ny4alteliciat  2ta(mpou4alt  fctad a2uan o t0 rtrmr3to1oaDeli o;s  etoio nydlle  icsat)a2trxmpoo4tle  o3tad aDumu o;()alerxr iy1opt au i;t0sexr(o oy4lm  mfvi ()aDraxmo;u4tpeomociltfa ra(mo (4 exoxo ootfpDeau ol( srtmxrpnudlm   netas) 2ta(mo;o4tetnmi3iat m uan pnt)aetomrcio1laDrluvslt  rxoir3io1ome  netls) 2rr( o;o0oexo f3tysls em(ms;t)arenmr to1laDraues () rxoxo nydlmtelfci (f Dtmur ;o4alt mf3iat s rauvs;t0 exnir3oadomtraneo;(0truo(opou4om  miesat  Drrxr ;u4opeomfetydfm2uanmont4trxoio iatfpt luvs s0t2trxopnodap nlnviatfaDraxroot4oex  ociltfs2uaump (0 lerir ty1fmtr uvo t) 2umxr no1lm   neil( sDrmur oo1oexn fctat a2ulumo u0arxoif iytlpDr u o;s tetmio iydol elfeta( srur(roou0apeoiociysla2ua( pn(4 lxnmr iydoptr uvi;s0 2trio oo4am nlncsas)a2uau ont4oetniiciydls2emuvon(4texomr iatlmt  nvi s)trxo(mpiu4olt lict t  2uaur ;u4altn fciysfsDranmsnu0arenxo3tadlptr ivs s0 2trxm3iy4al e fci (  rrrxmo;o0tptomietadfm rmums u)alenxrcia1la   n s;() rtmxm3iydlmenmfeil(faDuaxm ;u4aeenii3ild s raumo t)trerircoodlmD lieo s0trxmim nydlmen netls) rrax o;u4opxniieiytfm2ra(mo;t4 rxoxf3tadoaD ai i t0 rtrio oy4am  mfeta( aDraum oo4tptoifciatfmDelumsn(4tltoirciy1opte ivils0t2xr(m3io4ale lfeslt) 2rm(r no0opxoii3tad m uauvp;t4 etrmrcto1omtrlivi s0srxoiopny1lp  lfvt tfarra( pou1aet ii3iad sDeauvsn(4 exrmr3oa1op r nvo;t0 2toxmpiy4al nlnei (faDtm(mp;o1aptnmoeiadlm2ua( o t4 ltrif3oy1lmtean il()t2tm(opiydlmtn feil(  rur(m nt1tlen feiadls2el(mo t4teeoxr3iytlptelu s;t)t2tmiopnydlp nmiet t)srra(rpnt0opxnmi3iatfa2elump;t) eeoxf iodomtrluvs;t)t2toxrpoodlp nlfvtl(f rtmxmp;t0texo f3iatls2ul(ms u)aexrio ta1oat luvs s0 etr(r ny1ll n fvslsf rrr(monu1apenifeiad s el( s u4 exnifctadfm   i o;s0t2tmim ny4lpen ivsatfsDurumpot1teeniocilsfa2uau snu) renif oy1lp e nvo;s0t2uoim3oo4lp n netas srtmuront1alx ioeilsfa2uaumo;t0tlxnir oo1lmD  u olt0t2xoim3no1lltemiei ( srta(mpno0oex  iciytlm em(mpn(0arxnxf oadfmt  ivo;s)teurxo3io1apenlnci s s2taxm ;u1opeoiictasla2emu s u) leoxoctatfmtrlies;t0texmxm3nu1ap  lfei ( sDrau p;o1tpto i3iydlm uluvs (4 etrxr oodfmt ai o;t s2xr(o3iudapenlfcias)arrru onu4texnif3iydfm ulnmp;t0aeermr3iotomD lnvo ( tetm(rpoy1lmtemnvtas artr(r ot0tleo fciltlmDrl( sn(4teenir3tytfpDr uvsl(  ruo(r iydllt  fetlt) rurum nt4opx ifctad a2ra(msn(0 etnifcio1lpDeauvolt)srtoxopio1lpee fcsls aDraxro;o4tptnmoetlsfm2umnvp;(4areomf ootlmtelu il()texmxm3oo1ap  lnvi t  2rrum ou0tlx mi3tytlm2rau s;u0 etrio oy1fpt anesls s2tr(m io4alt mfvtltfsrrrxm nu0aexnioctytfmDulnvp t) rtoio ta1faDr ies;(0 rtrio oodoptnlnvils a2um(  ;u4aleomiciadfm uanms;t)tlenxf oydfaDe uvilt0trtrxo3oo4ameemnei () 2rm(  nt1altoioeiaslm ran pnu0arermr to1oaDe n i;t t2tmim3oo1ape  iviat arrmum ;t1tptomociydlaDrln s;t4 ltrifctatfpD anvs;t)teuoxm nydlmteliet ()sDtm(rpoo0alx  feiydls rl(mont0altrircootfa elnei;s0setmimpny4lm nlnct t)srumxmpou1oexomocild s uluvpnt)alxomo ty1lmD luvo;()texmxr3no1lm n ics s)srra(  ;t0tex  ieiydlm2eaums;u0 eenif ia1op e i o;s)t2toxm iydop  mivi ()srtr( pou1aetomictys a um(msnt4tlxnmo oytoaDrlu slt)sexmim3nu4ameelfet t s2rmx  no4aleo oeild s rmump;(4arxoxf ty1laDe i o;t) eurxo3io1omte ivtl(  Drrump;u0aet mietlsfaDeln o t0trxrmoctodlmDrln sl( seurimpio1lleemfcilt s2tr(m nu4olt iociat sDeaums (0tlxoiocootoaDranes;() rxr(r iydopee ncs t)a2ururoou1texniieiat aDum(ms u0tltomo3oodfpt  ivi;s)s2xr(m iydamt lneias) Durx pnu0altnmicildlsDrmumpn(4 renxo3oodlmD  uvsls  eurxr oodamen fesls) 2taxmoou4alx mietasls2rlu s;u4artoxr ty1lp eluvo;s0teurirpnudale  iviasf Dtm(mooo4aetomociydls rmuvp;()tetoxr todoa eaueslt0srtrimpiy4altn nei t  rtrxronu1olt iietld s rauvs t4artoxo3oydoat  nvsls)srtmim3iudomenlici s  2truroot0apx moeiadla emn s;u4 lxrmoctydoa   ueils trxm(opnu1apte feslsfs2ua( ooo0tetnmo3iatla rlu p u0 eenxfctadfm   uvs;t)setrir3oydlmtemfei s arrm(mpno4opeoif3iyslaDul(ms;u4altoif3tytop e uvsl()sexm(r3nudaptn ivsas) rur(m ;u0tlt mfetlslaDuanmp;(0artoxfciotoateauvo ()trtm(m nu4alenmnvs (f 2taumpnu0aee  ocildfs eanvsnt)altrxf iy1opt  uvi (0 etm(opiy4ap emicilt srtaxr no0teeoioetyd m2rmnvsnu0 rtrmr totomDrlnvs;t  2xmir3nu4oleelfesa()sDtax pou4alen feildfs2um(vont)aexrxfcoydom r ieo ()sexriopiy1lpeelicia(fa2rau ono1tleo i3tas m2ulnmsn()aleoiociatlmtr nvs;t sruoim3oydllte fcsl(fs2ra(mooo1ale mfciysfaDra(mont4tlxomrciatfmDr u slt0setmimpoy1opt lictas  rra(  no4opt  icilt a2rln s;(0aexnmo3iy1fm raues s)s2xoxopnydop emneiat)aruru  oo4tpeomfciatfs2umn o u4trermo3ta1fmtrluvs;s0 ruo(m3no4op nlnetatf rtau  ot4opeo ictat aDuaumsnu4 rxomo iodfa  ai o;t)t2xr(m iy4ap nlnet (f Dtmx pno0opt ifeiasla2ulumsn() rtrmrcty1oa elu s;s  etmio3iy4lptemfcilt  Drrxrp;t1aexoiociytfm um(vs u4altnxr oadoptrli slt) 2trxm ou1ape  fcs s aruru oou4teenmfciltfm2elnmpnu4 rxnxo3ia1fm   neil(  2tr(o iu1alte ivtatfa2ra(m oo0olto ietyd s ra( o;t) renio oadfp  liesls0truoxr3oy1lptnmivslt arrrxmpno4tle  iciad aDraums;t0trermfctatlp rluvsl(0s2umirpoudlp nlnvias)arta(mpnt0olxn o3tadfa2eanvpnu4aleoiocoa1lpD  ues s tetrio3iu1ll  lieil(f Drm( o;t0alx ifeiat aDum(mo t4tetrif3to1lpt auei t teurxo ou1ap  mivtl() ruru pnt0texnmictlsla2rmums;t)aetnifcio1omDr neil() eto(mpiodop  mivs () Dum(rp;o4aleoif3tasls2ranvs;t) lerir tydoaDe ivo;(0trurir3iu4llen fetatfsDta( ont1oexo fciysfmDran ont4tlenmocoodfa r n o () exrio3iu1om   fcsa(fsDurxr nu0olto ociasfs umn sn()trenmfcoydom elivi;()tetmir3oy4ole lnvs ()s2rau pnu0ope  i3tls aDrlumon(0alxnxo iy1lm  lueo;t0s2xmio3iydlp  lfctlt) rtaxm ;o0opeo o3iatfa2umump;(4altrir3totoate u o t  eurxopnu4omte nci s)s2taxrpno0aleomietad s umnvsn(4alxoif iytla   i o;(0 ruoxr oy1om e icsl() 2trurpno1tlxoifctadls ea( o u)altnifciytom raieols0 2urio3oodlm emiet t)aDtau oou1tptn f3tad mDrmnvsnt0aetnif3todfpt  nvo;()sexmir ou4lm   ivsas)aDurx oou4opt iociys a ul( s;t4tetrifcoo1lp rlu ol(0 2trxo nodlm emfei t)aDrau  ;u1tlxn feiasla2ulump u4 renmo3ia1omtrlu ols srxo(r3iudopenlnes ()aDur( pou4altoifeilt s rlnmo u)aleoxo iatfmteli s ( t2urxr nu1ameelies (f Dtrx  ou1olt ii3iydfs emn pnu) lenif oa1om  au o (  eumxr oo4op e ivs tf Duaxm nt0oeeoioeildfa2umump;(0 lenxr3oytfm ranvol( s2xo(o nodale  ivsl(fsDtaxm ou1tlenmiciatla2emnmo;u0 exrxo3ootopt liei;t) euo(mpnodopt  neilt)arumum oo1alx  feiat a rlumpnt)aexomr todfaDe uvo t0trur(o3ou4ap  lfvt t)srtaxrp;u1tlt io3iydfm2ea(vp t0 leoxrciatlaDe i sl(  2uo(r3nu4ol n icsl(faDtaum ;u0open o3iyd s el(mp t4trxniocoatlmD livo t  etrxm3oy4oltelnvil()aDraum nu4openio3iadls uaumpnt4 rtrmfctytlmt  ieo (0 etrxm3nydal e nciat  Dumuronu0apxo ieiadfsDulu p u)aeenxr todlm e i slt0t2triopiy4am   ies t)srta( oou4oeenioetyt a2eanmpnu4texrio3iodlm e n o;s s2toirpio4olt mnvilt artr( oot4tlxnmictys a emu s;(4 etnmr ootlmD  ivilt0trxrio ou4op e netl( srtrxmpnt4opxnmo3ias sDemn s;u4tetrmr3ootfpD  ieo s) rtoxo3iydolt  neiasfa2tru ono0tetnmieilsla eanmont4aeeomrcoatfpD ai o (0setoxrpnodomtnmfvsatfsDuru pnu0apx  icildfaDrmnmpnt4areriociadla  lieolt)sexrir iy1al   feia()srtax onu4tpxnif3tldfaDul(mo (4trtomrctydlpD aieol( t2trxopiudlmtn fcia()aDtr(root0tltomfetatls emu pnt4trxoxo oo1op raivo;( srxrxo ny4omtnlict tf 2uaumpno1aexn i3iat m2ua(mp () exrir3oy1oaD lnvs (  exoio oo1lmt mivtltf 2rru  no4aetoifeiasfa umn p;u)trtoxfciatomt  nvi;(0t2uoxrpiu4ope  iet tfaDrruro;u1opeo ictlt mDelnms;(0trxrif iotlaDeai o;()t2uo(o3io4ape mietas s2ta(mono1tlx ioctatfaDrm(vo;u0trxomf oydfa  luei s0 exoxm oo1lp emfcil(f rrmxrpnt0teeo ociad m2rm( p;t0aetrmo3oo1lpt li sls  2uoxo iu4lpt  netas)srrrx  ;o1olxniieiasfm ea(ms t)alxnxr oytopteaivo;(  rxoimpno4omte ivt tfarrmxmp;u4tet  feiat s2rlu snt0trerxrcty1la   i i;s0t2toir3oy4ap e net ( aDrax  nu1olenio3iyd s2ulu o;t4tetrxo ta1fa eai i s) rxoxmpoo4optelfcil(f 2uax ooo0aetomicildlm2rm(mo (0tltrxf to1lateluesl(  euo(rpoodal n iei (  Dtaxr ot4tlxo ictatfs2ua(mpn()arxriocoatfaDraneo t)tetmio3iydlpeemivta(f rrm(ro;t4olt mfetlsfm2ulnmpn(4tlxnircoo1lpt livslt sexoiopiy4lm  lnvi sf Drmum ;t4opx mfcilsla2rm(mp;u0alenio3ty1lpt  n o;s srtrxr nudomtnlfct t)aruau oot4tpx  o3iysla2ranmo (0 etnio tatomte ies s)teur(opiydlptn nctas  rtrxm ot4apt mi3iad m2eanvonu4artrxrcoadopD aiei t)s2tm(m3oy4apeelnvsas) 2uaxmo;o4oex moeiasfsDul( pnt4 eenmr oadomDrlues;s trurio3nydlmtemnei () 2ururp;u4tee mo3iasfm2rlnmp;u0texrmo3oa1opte iesls0trtr(opiydolt  fetas artaurpnt0aex mo3iytls2el(vpnt0alxnmfctadlptrai ol(0 2toir3nu4oltnmiviltfaDtau ooo0ole  fetat s el(mon(0aeenxrcoodopD li ols sexoimpoudaltemivi tfsruaumpou0oleoif3tltls2ea(mpnu)tetrio iadfp rai i () etm(m3ou4olt mfvsa( sDtrxr nt1opxomo3iadlmDra(mpnt4 ltrmr3tytlmt ai o;()trtr(o iu1ome  nci tfsDua(rp;u0aetn i3iadlm eauvp;t0trxoif3io1lpteln s () 2tm(r3oy4om  lnvt s  rta( p;t0olt  o3tasfs rmumo;t0 ltnmo3totlm   n olt tetrxo3nydll n ivtl(  ruaur no4oexn ietytls rmuvs t4 rtomo3iy1opteluvils)t2tr(r3oudalenmnvil(f 2ra( ont1tpxnio3tysfsDrmu s (4teeoif3tytfmtr i s (0s2urimpoo4apte ivtl()arrr(m no1texomi3ildls uluvont)arerxocoatomtr u o;()t2uoim3nodopte neilt  2rrurpnu4tltomfcildlsDra(ms u)aetoxo iytopt anesls srxoio iydlptn ies t  2ur(mo;u0opeoif3iasfa ul(vonu4 ltrif io1la elnvi () 2xmirpiu1lpenlietlt)aDtmx pno0oeeo f3iysls ua(vo;(0 exrxr3oadla eai o;( t2xrir3nu4ol   ncilt)arumxrpoo4aeeomocildfm em(msnt)aexoxr3totfa eauvols0seumxmpiydap e ietlt aDtmxrpnt0oet  oeiysfaDum( s u4tetniociadomteluvi;()teur(r ny4ll  micsat arrrurooo4olt miciat sDumu pn(4 lxomfciytla eln s t)trum(opny4op emnvtas) 2rr(mp;o0altn ieiytlsDelumsnu0 rtomrcta1opDe uvsl( s2xoxm3nudop nmfvias) Drm(  no1apt ii3tltfa2ulnmsn(0 exriociy1lpDrau i;t0srxoim3iodllt  fes t aDur(r ot0tpenmfciasfs ul(ms t0arxnmocoadopD  n i;t) rto(r oy1ol  lfci ()a2ua( p;t0oeeomocildlmDranms t4altoiociodomteau o t0trxo(m iu1ol elnvilt  2rax  no0alxn o3iys m ea(mpnt0 exnmr3tydop   i o t)srur(m3ny1omte ivi (fsrur(  ;u0alenioetltlm2umuvsn(0tetrxrcoo1fm eanes (  etr(m io1altnmneia( arurxr nt0tpt iociyt aDeanmo u)alxnmf iotlm rauvs t)sexmxr oo4amt  feilt)a2tru  oo4oetomoetltfa2el(mo;t0alerir oodfmD  ues;()t2xmxm3ny4omenlict (fsrrmxmono4optn fctat a ul(vpn(4aeenxf3tatfaD  nvsl(0 ruriopnudllt  neil(fa2rmx pno0tpxoif3tldfa el( p;(4arxnmf to1faDraivo ( srur(o nydal  mfvta( srrru pou0oeto ieiaslm uau p;u) rtnxf oadfmtrau o;s teumim3iy1ameelfvt (fsrtaum ;t1tpt  i3tadlsDraums t4 exnxo oatlpDrlu i;t0srtoxr3oy4ll  mfcils sDtm(r ;t1tptomo3taslm2ul(vs;u0alxnxrciy1fp   nes s s2ur(o3oudomenlfcsltf rtau  ;u0opxoifcildfs eanmont4alenmrcoadfa rli s (0 rxo(r3nu4lm nmfes s  2um(rpou1oeeo ietlsfs el(vs;(0 exriociatlmDrauvol(  2uo(m3iudamen ietlt sDrr(  ou0apt ifciydla eluvo;u0trtnxf3totfa  lnvslt0 exoxo nudllt  ivil(f Dtaxm nt0tle iiciysls umu snt4aetnmf3todfateauvs s sruo(rpoydol nlfvi sfarra(r ou0tlenmociytls ul(ms;u0altrxo to1fa e ueo t0 2xrxopiy1optemici t sDuaur oo1tlxo f3tytls uau snt4altrmo ty1opt  uvi ()teumir no1altnliei tfaDua(roou1optniocildfa2uau onu0trtrif3iadfmDelu slt)seum(o3io4al  miesa()sDumxm ou1teeomoeiysfmDulnms;(4texrmo3oo1lat li o;( s2urxm3iu4amt  nesat)s2urur ;u0olxo iciydlaDulu s (4trerxo iytom   nes s0srur(o iu4op e ncta()aDraur oo0oexo fctld s rlnmp u)alxoxrctydoa eli ol(0sruo(r3nudlp elivs t srur(mp;t0altoii3iasfmDemn s;t0 rtomo iydlpte ivs t0t2uoir3oo1lltnmfvsa(fsDtmu  oo4alto f3ild sDrl(vpnu0aeerxrctotfa r n s;s0 etoxo oudol   ietas srumxmooo1tptoioctysfaDrm(vsnu0tlermrciadfmDeluvs t0setoxmpoo4lm  mnciat) 2ra(m ;u0oee ioeiltls2rl(vo t0aeenmfctadomt  u i;(0trtoxr3oy1llt  fvsat sDtrurp;o1apt  ieiatfmDrluvs u0aleniocto1om e ivo;( trtr(m3iu4ame lietlt  rrm(rpnu0olenmfciydlaDemums u4 etoiocto1la ranes t seumio oo1omt mivs t sruaxm ;u1alt ifctlsls rmn o (4texnmfctadlaD lieils s2umir3oudap emnetltfa2ua(ro;u0tpe ifciytfsDranvon(4 rtnxrcoytoatelueo ( sexrxmpny1am e fciatf Dumur ;o4tpx  icilsls2eanmo;()aeeoif3oo1fateaneo t) rtm(m nodal e ieslt arumu ont1alx mfcildls2emu p;()trenmfcoy1oatraies;s0 rtr(mpoo4lmen ietat) rra(r no0aee  feiytla elumpn(0 rerir3iy1fpt lu s;s)texo(m3nu4olee fciltf rrr(mpno0altnmictat mDeln s;(0 rermr oo1fpt aivs;t  2toxmpiu4llen ici s)sDtax ooo4oltnifctls mDulu p;u) lxnmo totlpte neo;t0sexo(o3no1lm nlivia() Dra(rp;t4teeoifeiydfm uan s u)tlenxo3tydop rlnvo t)s2uo(o iy4alte feil(f rta(mpou1olxnifciatfs um(vo u0arxnmrciydoatrauvsls seuoio io4olen iet ( arum(mooo0apt ii3iat sDra(mpn(0teenif tydfp e iei ()trumxr iu1olte fesas)arrau  ;u0tpenmo3iydlaDel(vo t)teenxocia1fpDeluvs;()sexmim3iudope mnviat)s2ua( ono4tpxnmf3tyd sDrl( p u0aetrmf tatfaDelieo;() 2xoxo3oo1lptn fvtl()a2tru pnt0apx if3tadls ulu o;t) etnir3iotlp rai ols) exrxm3oy4alenmicsa()sDtr(mont0tlxnmfetadlaDea(vpnt)aleoxrcia1lmDeau o;s  eumiopoy4ape lnes s  2rm(root0tpenmo3tytlaDem(mp (4aexnxf3ia1lp e iei;s) rxoirpnu4oltemietas)aDum(ro;o4aeeomiciasfm2rau pn(4 exoir3tydfaD luvo;t  2xrxopio4ll nlnei t sDurxmo;u0oltoifctyd m2emnvp t)altnxo iadfate u i;(0t2toim3nudal  lfesl() Dua( o;o4tlxn feiltlmDrmnmp;(0teerif3tadfaDrlnvo;t  rtrxr io4lle mncilt) rurx  ;u0alxnifeiyt s ul(vs (4 eeoxo3ty1op  aiesl(0 ruo(m io4apeemnesa()s2umur ;o0tpeoii3tatls emnvonu4 eeriociodlpDelieo;( t2xrxr nodlp  micsat  2rrx pnu0olx  icildfa2ea( p t0arxnmo3oatlmDrln sls teuoxo oydllen neiat  rrr(mpou0oexomiciad aDeau pnu0 rxoxf3iadfpt aiei;s seuo(opiy1lp   neia()artmxm ou0aee moctat a2eauvs;t0alerir iy1fm rli i ()t2tr(o3nu4llte nvtls)sDrau ono4teen o3iadfa rau o;u0aleoxrciadlmtraiei;s)s2um(mpiu4amt  feia()s2ta(  no4tex  iciltlaDeanvpn()tleoif ta1lm eauei;t0teur(rpnu4alenlfvi ()a2ta(rpno4tlxoioetad aDel(mo t0tlxoif3iatoa eanei;s  eum(o iy1ap   iesltfs2rr(m ou4ole mfciatfs eln p (4 exoif iotfa  auvi;(0srtoxo iu4op   neia(fsrrrumo;u1oexnmoetysls2ra(mo t4artoxf3tatfaD  uvo t0seurxrpoodalen ivt tf Dtru  ou4olxnii3iydls rlu snu4alenif3tadom rauvi;s) 2trxr3oy1lmtemncsl( sDtmu oou0olxn fcild m rm(vo;u4altnmrctydfateai il(  2xo(m oo4olt lfvsas arumx pnu0tlt  f3ias a rl(mo;(0 exrxr3oatfat livolt srxoim3oo4olenmfei t  Dumuront4teen i3iasfa2rm(vpnt4aexomo iatfat lueo;t  rurio3oo4al nlncsas)aDrm(rpou4aptomi3tad s2emnmo t0tltomo3oodlpD  u i;( trxm(opiu1ame  ivi () 2rax o;t1tet iiciysfa ra( s;t4alerir iodfmDeluvs s0sexmio3ou4lleelietl(  Duax pnu1tpxnifeiyd sDuluvp;u)arxomocoodfa  lues;s)s2to(opiodom  livi (fsrrrxrpou1alxnioctldla2emn p;(4teeomrciatfmDelivi t trxr(o3nydale  neils)srtm( ooo4tee  o3ilt a2ea(vonu4trxnifcta1fmDeaivi;t s2urxr iydap e ivs t) 2ra(root4oltnioctysfa2rmn sn(4trtomr3tatlm elnvo;t seuoxo no1lpee nct () Drmumo;u4opxoio3ilt a2umn s;(0 exoxr iodfpDr ivol( srumiopnydopeelnvslt)aDrrur oo4oltoii3ildlmDuan p () exoifcoadlm elies;(0srumxo3io4ole  feia( a2ur(roou0tle mf3tldfsDulums t0 ltnmr oy1fmDraueslt) eum(r nu1ll  lict tfsrtaxmoot1olx  feiltlm2raums;()altnmr3oadlmDelnesls  2um(r3oudap elnct ()a2urxrpno1olxnifciyt m raump;t)trenmrctydop eanvo;t  eumim ny1lpt mfci tfsDururp;o1aet ioetld mDuauvp u0alenir3iadfmDraneo;s0s2xmxo3ou1apt lfei () Drm(  ;t0olx mo3taslaDemuvsnt4 renmrcty1fmtr uvil()sexrimpny4olt mieilt srum(ront0oetnifeiyt sDea( s () ltnir3oadfm   n o s0trxrio3iudlm nmnvt s)srurum oo0oexo fetatlmDuluvp;u4 ltomf3oytlat  nes s)srtm(rpoy1apee feia(  2rmxr oo4tex  iciltlsDea(mpnt0arxrxociatfptran o ( sexoxm3nu1ape mivs t) Dur( p;u4tltoifeiltlsDua(mo;(4aexoir ty1lpt  i i (0 eumim3iu1ape  fei t)s2rm(root4tpe ioctls mDem(monu) eermoctadlaDe nvs ( srtr(rpio4apeelfcsl(f rur(m ;o1opxomi3tltls2emnmo;() etoif3ia1fa elieo;s  rur(r3ou1amtn ivi sf Dtmxrpno4oleoioctytlm ranvpnt4 lxnmf iodla rli ilt trumir3nu1ap  lnctat sDumx  ;t0olx iiciatlm2rmnvpnu0artoxf oatfpte neo t s2uoio nu1openlfcs tfsDrrx  ;u0alenio3iyslmDum(vp u4 rtrio3to1fa  lu slt0 exr(m3oudal emivt tfarumu oou4tlx io3tadlm2uau o;(0texnxfctytfm  ln s t0texoxm3no4lpee ncia(fa2ur(mp;u0tleo oeiys m2umn s (4 ltrmf3todfa e u ilt srtr(r ou1optn ivtls a2rm(  ;o0tle ioctlsfs2emnvs (0tleomrctotfpDr u ils0 2trxrpoo4omtnmfvsl( a2ur( ono1apxnmo3iysls2rmnvo ()aetnxr3iodla ran i;(  2umiopno4lmeelneta() Drru o;o4texo i3tasfa eanmon(4trtnmo tytlateaivs t0setoxr3oydll n icilsfaDuru poo0optnifeiltls2emums u4 exoir3io1omt  ies t srxrxopnudol e ictasfartr(rp;t0olenmietatls el( pn(0tlerxo3iadlm ranes t)tetr(mpoydlptnlnvta(  rtaxmp;u1tee mfctysls ulnvpnu)tleoxfciy1fp rau i s0 rxoxmpny1omte nes t)s2taxr oo0olt io3taslmDuan ont)treoxo oodop eaieo;( s2tr(o ou4lmenmfciat s2uau  ;o4altniieiydfa2um( o;t)tltnxfcoa1fp eanvsl(0trum(mpno1omtnlnvtl(  Drmumpnt4tlen f3tad m ulu pn(4 eerir3iadfp e uei;s) exmxmpny4lptemivtls) Drr( p;u0alto ocildla ra(mo;t0 exoio3ty1oa  aivil(0seur(o3ny1op e ivia( aruaxrpou4opt  ietld sDul(vo;u) exrmr iotfmDrluvs s0teurxm iy1llte feilt)arur(  no1optoii3ilt aDrlu onu4 rtrmr oy1lp   nvs;s)srtmimpiudlle mfei t artr(  ot1olxomicias sDeluvsnt0teenir ootoaDe ivo;t teuoim nodlpen ics s  Dta(  nt4olxo fetat a emnvsnu)arermr iotfmDelnes ( truo(m no4ome mncsa(faDuau o;o4alto fetydfs emn p;(4artoxo ia1la elu s;s s2xrxm oydom  lfctas  rta(m ;t1tpenmfctat mDem( pnu) lenxf oytlpD aieols0setoim oy1ameemfvs ()sDrmu  oo0tltomo3ildfm elnmpn(4 lenmocia1optranvs s sexm(m no4lmeelneilsfarurx p;u1alto ictls sDua(vs;u)trtoifcootfmteaieo s0 rtmxo iudomt  iet sfsDrrxmo;u4aetnio3tls aDean snu4tltrxf oy1fmteli o;(  2xrxmpiy1om   fvtas a2urx onu4olen ictydls2ea( s;u)trxrmrcio1lmD luei s  2xoir3io1ol  lneil( s2tmuroot0tee if3tadlm2rmu pn(4trenxf3oodfpDe ieo t) eur(rpiu1opt mfet (fsruaxr ou4olx mieiadfmDea( s u4aeenmocoydop rau o;t0t2urxo3nydapee fvtltfsrrm(rpno4oleoiieiyd aDea(vsnu0trtnifcoo1oa  anvslt  2tm(m3iu4op elncilt) ruaumonu0texnmiciatfmDra( snu4 lermr3totlp rln i;t trtrxm iydamee nvtas)arra(r ot1aetomfeiadfs2elnvont4 exnmr3oydoaD lu i t)sexo(opiodaptnlivtls) Drmx pou4oexn o3tld aDrl( o;(0 rtomo oydlptrlu s ()tetmim ou4om nmncsa(f rrr(m ;u0oeeo fctat m2ulnvo t) etoxfcootfmD liei;s)seum(rpio4omeelfet t)srua(moou1oeeoiocildlaDrl(vs t4treomoctadop eluei s0trtoxo nodome  ivil( s2ur( pnu0aet iietyt sDrlnvp;u0tlxrmo oytfa e ieolt0s2xrir oo1am emncias  2taxr ot4ole  fciysfa2eln snu0 exrmo3oa1op r i i s) 2uo(r3ou4lmtnmnesat)sDraxrpnu4optnifcils m2eln o;u)alxrmo3tydfmDraivi s0srxr(m ny1lp  mnvsas a2rrumpoo4alx mo3ildlm rmnmpnt4arxrifciatoa eaueo;t0trum(opoydalt mnvsltfs2trx p;o0aexo f3tlt sDuanmo () eenmocootfa  lieo t0s2toxm iydame mfetas)sDrr(mpnu0opt ifciyslsDumn s;t4 rxoif oa1oa r ivsls  2toim oo1olt lfeia(fa2tau ont4olt mi3tydlm2ra(vp (4aetnxrctatfm eaivi;s0texm(o nu1lmt lfei t artaxm ;o4teen fciat m2elums;t0tetnir3ty1oat aivi;t)seumxm iy1lltnmfvs t  2tr(rp;t1optoio3tatfs el(mo (0 exnio iodfp ean slt0s2trxrpnu4ame lnviasfsrua(ronu1teenmo3iadfm uln snu4artoif3ootfmDeauvsls0texr(r3iydlpenmfvt s sDumuro;t4opeoioctlsfs2ean sn()artnmr3iytlptrlnvi t  2toirpoo4al emici s)srtr(moot1aeeomf3tyd a uanvs (4artnxr oy1oatrlnvs;( s2urirpou4ol nlfvilt arrmxmo;t4tltnif3tlt m rl(ms u0altrmfciy1fatr n o;s0tetr(o3iy4lle mncs s  rumxmpou0ole iociytfaDuanvp;u)trxoif ty1fmDr n sl(0teuoimpnydopenmnciasfsDumu pno4tltomoeiasfs2uanmsn() lxomrcoo1oa  aiei;() etoiopiudaltemfcs t  rum(mo;o4optnmo3ild a rmuvsnt)arenmo3oydom ean o;t0sexr(m3iy4lptnlieias  2taumoot0opt  ictasfmDea( s t0altnxf to1la rlnes;t0s2xrxm nydol e neilt)s2taur no1tex iociasfm2uanmo;()trxnxf3tatopD  ueil( seum(r oydlme lnes s artm(m ou1aeeo ocildfaDrm(vs u0 lerxf3oydoaD aues;( srum(o oydlpee iet t sDrrxm ot4opxo o3tytlm em(vpn(4aexomf3iydlate ieols0 2trimpno4ome lfvilt)s2rm(roou4opeomieils sDemuvpnt) ltnxf3tadoatr ieo;(0teumim no1oltelfeias)a2tm(roou1aee mfcildls rmu o u4 rxrxfctytlmDrli s;s)trumir3oy1lltnmfvil()a2tmxmo;t0ole iicilt aDulnvp;u0teermo3tadfaDrlues s sexm(m oydamt mncsas)s2rmx oot0tetomoctysla2ra(ms u)aetrxf totfptelneo s)t2xrim3oo4optn nes tf 2tmumoou1oexn f3tad a2eaumsn(4arxrmr ia1faDelnvo t  etr(o3oudllte fvt t)s2trxr ;o1tex micilt mDelums;(0 rxoxo oatlptr i s ()srtrxrpou4am nmictat)s2umur nt0aptoifeiytlm2elu ont)texnir to1laDeanvilt0s2urxm iu1ale lnvta(f rum(m ;o1oexo i3iyd mDem(mo (0 lxnif3tatlaDr n slt  2ur(o3iydllee fvil(f 2rau pnt4aex mi3ias s2ulu p u0tetnif tatfa eauvil() 2xrxm3oy1oleelict t srtmuronu4oex ioeiyt mDelump;(0arxnmr3oy1fptrai o;(0 rxoio iy1om e ivsls)arrmxmoot4apen o3ildfa ul( p;()tltoxo3iotoateauvs t sexm(opou1amtnmietlt  rrru pnt4tptomoctltfm elu o;u0tltomr tatlpDrliei ()srumxmpou4lm   ivsa( a2tau poo1oeeo ieiyslm rmu s u4aeerxr3iydfatr ieolt0t2umim oydaleelneta(fsruaxm ;t0tlenmicildfs2rl(vs u)arxnmocoy1opteai sl( setrxopoo4ole mnvtlsfaruaxr ;o4oex mo3tltlm elump u0altrmociy1oat au sl(0tetoxm iu1amt mfetl(f rtr(mpoo4tpeoifeiatfs2elnvsn()treoxrcio1fpDe i sl(  rxm(o3iodapeemneslt) Dtmum nu4olx ifctadfsDum(mp u4altnmr3iatoate uei;s seumxo3nu1omtnlies ( a2rrxmp;o4oetoif3tldfm2uanms;()aeeoxf3oydomt  nvils  rtrxo oo4lle mfvilsfarraxro;u0ope io3iltfsDrl(von(0tlxrio iydoa r nes t tetm(r3iudol e ivtlt arua( o;o0opxoiocildls emn p ()treomr iadoa eln slt0srum(o iydlm emnctls  rtaum ;u1alx ii3iydfs el(mo u)tlxnmf oytlpDr nvols s2uoim3ou4am nlivsatfa2rau onu4ape mfeildlsDua( s;(0treomfctatlpDrlues;s sexo(m oodalt  fcs s sDumx  ou0tltnmo3iatfaDrau s;t)teenxr3tatoatr uvi ()tetoxr oy4aptnlnetas aDumu p;u0teenii3tldls umuvo u4aetoif oatoaD lues;s0sexm(m iudopte ncil()arrmum ;t1aptnmi3ilt aDumu sn(0tltnmr iadfm  ln i s0t2tmxrpiodolee neias s2tau p;o1tpen iciltfsDrau s;u4artoxfcty1fpte ivilt)t2to(mpnu4lmt mnviatf ruru  ;o4apen oeiyt mDrm( p t)teeoxfciy1fpDelnes;s0 exmiopoudlpenlnesa(  2ua( oot0oetnii3tldfa ra(ms;u)aleomo3iotlatrliei s0t2tm(o oy1olt  fcsat a2um(  ;o4tlxomfctadlsDul( s;u4 leoio3to1lp elivils) eurio oy1al  lnvsa() rumxr ;t0teenif3iasls ua(mo;u)arermo3ootfmDeluvs;s  2uo(opno1open nci t  Draxrpnu0opxnmo3tad m uaump t4aeeomfciadlp  au i () 2urxr3io1openmfesatfaDraurpou4oeeo iciltlm rm( o;(0altrxo oodfmD anvs;t trur(opoy1lptnmncta(fs2rm(mooo0tetnmi3tat s2el( s (0 ltoxr iatlaDeau i;s)t2xr(o nu4op  lnctat aDurur ou1altomfeiysfaDel(vo;(0arxrmrciotlpDe u o;s0s2uo(opiu1op eliesls)arur(r ;u1tptn feiyt m el(msn(4 ltnio3oydop  li o;s)s2xo(m oydolt mnci ()sDtmxmo;t4oeto feiyt s2rm( sn() etoxfcoydlpteau o t0teurxmpio1lltnlivtat)aDuru  oo1apenii3ils aDra(ms;() rxnxo oydfateli o;s  rtrxr nu1lmt lfesa()s2tmu p;u1aex  oetadlaDrm(vs;u0aleoxr3tytfp raivslt0t2tm(o3ou4ol  lncs sfsruauro;o0ole  ietatfsDranmp u)teeomrciatlatraies;()trtmxrpoodol  mici (f 2rau onu0texn ietat m el(vp (0treomo oytfp rlivil()texo(rpoudlpen fetlsfs2raumoou0aeeoii3tatlaDrmuvs;u4 leoif3ta1fatelu i;s0 rxrimpnodolte fcia(f 2tmx  oo0tlxoiieilsla2rmuvs u4altrio oytoatraneol(0texo(m no1opeelivt tf Duaum nt4ale if3ias s2emu on(0tlxrxocoydlm  anes;s  ruoxr3iu4optelnciasf Dumx  no0tlt iociltls ea(vs u4tetrifcoa1fpt aneslt0trxr(m nudamee ieia(fsrtrxrp;u4altn ictlt m2rmn s;t4teenxrcoodopte uvol( t2uoxr3iodam emivtas  2uau pno0oexo octydfmDua(vo u)alerio3tatfaDelu o;t sexr(o iu4lp e fvilt  2tm(  ;u0ole ioeiatls2ulnvsnu)altomocia1lpDrauei t0srxoxmpoy1ape mfetl(fsruaxrpot0ole iieiatla el( o u4arxrif to1lm e nvs;t0srxmir oodomeelivi t  Duaump;o4tpenmoctydla el(vsn(4tleoio tadfa eauvi s srurxo oy1om   iei sfarrruro;u4tpto feias s2uauvs;u)arxrmoctodfa  lu i ( t2xoimpoudomtnmieiat)a2rmxm no4tetomi3ilt a2elumont4trxniocootfa elnei;t) etrxr3oodap   ivtlsfs2rmx pno1tptoifciydfs2eanmon(4 lenmr3ta1faDrlueo t srxo(mpio1lpenmivil(f 2ua( o;t0tpe mfeildfs2uaump u) exnirctydlpteli o ( trum(mpoy1aleemnei s arraur ;o0tpeo f3tasfmDrl(vpnt)tltnxf3oadlmDeaivslt0t2tmimpoodlleemncta(fs2um(mp;u1olt ifctldfm2umump t0tetoxfcoa1fm   uvol( t2xrir3oy4alt mivslt arrax pot0openiictltlsDuanvpnt0 rxrmrcoadlmt lnvs s0teuo(r oudlltemics s)sDumx o;t0texomieiytfs2rm(mo u0aexrifcoatomt au i;s trtrxr3iydlmenmfvsls) 2tm(roou4tltnmfcilsfaDran s;(0 rxrxf3totlpD  u ilt  exmio iy1ale lnvia(f Dtmx  ot0aee  ictys aDeau snu0 renmo3tatlm   u ol()s2xoim3no1lm  lies ( sruax pot0aeenmiciyslm2rau p t)trtnir ootomD an s;(  rur(r3nu4omenmicil(faDtau oot0oleoio3tyt s2umn pnt0aleoxrcootoa elu ols s2toio3io1ome mneils)a2raxm ou4opxniictlsls umums;u) etnifctatlmDelnvo;s srxmimpiu1am nmivilsfsDum(r ou0altnmfeildls2rmu s (0 rerif iatlp eauvo s  rxrxr3iydamtnlfcilt s2tmx o;u0tleoiieild a2uauvon(4tltnmr ty1fmD lnvo () rxrir3ou4ll emfvi tfsDtrx o;u1apeomieias sDumnvs;u) exomfcootfm rauvo;() rxrxm3ny1ap  livsls)sDrr(  no0tlxomi3tls a ua(mo t4 ltnmocta1opD  nei t)srxr(m iy4apt  neia()s2uaxm nt4ole mfciysfa2emnmp (0 exoio3io1lp eluei;t seum(m oy1apt lfcslt)arur(mpnt0tpe mo3tysla2umump;u0 ltrxrcoytlmDe i s;s0sruoxm nu4olt livt t)aruru  ;o0aetnifctadfs2um( p u4aexnif iatfp rlivils0sexm(o ny4op n nvsltf Drax o;t4oetoiieiys a elu p t0teerxf iatfpte nvilt0 2xoxo oy1olenlicsasfarum(mpou4tptomociydfaDulnmp;u0 eenmo3ia1oa rlnvils)texrxopno4ll e ncia(fa2rrx  ot1apeniociys m2ea( pnt0 rxnircoo1fa rauvo s0 exm(m ou1lmtelnes ( s2rax poo4aexniicias mDea( o;u4aleomo3tatomt ln ils  etr(o3io4lpe lnvta()a2tmx p;o4tpe  fctyt sDrl(mon()trtnxr3ta1laD auvo;( seuo(mpiu4apt  feil(  rrrx  ou0oexn oeiadlsDulump (0alerif iatop eaieo s  2tmio3nu4optelfeta()aDtrump;o4tlxo o3tys sDumuvp t4aetnxr oa1oa rluvi;t  eumir3oydol nlicias s2rmxrooo4tpxomo3iat s2ulnvo t0tetnir3ia1omD livs t t2xrxo3io4omt lnesls sDtrxm ;u4ole ioeiysla rlnvonu0trxnif3tatlmDeaneo;()trxo(o ou4ll emfcs t)s2rau o;t4tleoiieiasfa rmuvp t0 lxrmfciatoatraieo s0sruoiopno1op elivia( sDuaxront4aeeomfciydfa2umuvp;()artrio3totfpDe nvilt0 rurim io4amtnmfci s)s2rmxmpnt1open ictysfa rm(vs u4 lxoxociatlpD au i ()setoxm3iu1ol emfeilt srrmumpou1aeenmo3ildfs2uluvp;t)tltomo oy1opte uvs;t  2xr(rpio4al nmiesat)arurur nt1aexomf3iat m2rauvont4trtnxf iytla elivo;s)trtm(o nydlmenmivi ( a2trur no1ale mfetytfs2eau onu)trxnxo oodlpDelneo;( s2trxm no1olt  feiatfsDtrx o;t0alt io3iad sDuanvs;t)aeeoif3ootfmDr ueo;(0s2uoim3oodol   nvsltfs2rm( p;t4teenifeiysla2eanvsnt) lenirciy1fmtrlues (0trxmxopoy4lptelnctlt)srtmurpot1altoif3iat sDrmn p;t) lermf iy1laD  ies;t  rto(rpoy1apt mnvtat s2tr(m nt1opeomociyt m2elums;t0 rtnir tadlp  aiei s s2tr(m3ou1lmee nesas)sDumuro;u4opx iociyd s ua(mp ()trtrmo oodom rlnvo s) rxoio3no4lltnmivtat) rrmx  no0aeeomfetltfs2raumpnu0 etrxo3iydfmtr uvo s0 rxmxr3ou1am emfetasf 2tr(rpno1apxnmoeiydla2rl(mp;t4aetnifcia1op  auvols trur(r no1al   ivta( aDurxmpou0aex  iciltfmDrlnms;u0 lenifcoa1oaDeanes t0 exoiopou1llt mfcia( sruaumonu1aeenmf3tysls eau p u)trtrxo3oodlat ai i;t)texr(o3oy1llee nviasfsDumurp;o0tpxnifeias m2emnms ()arerxr3iadoptr nvs () 2xoxo oy1opt  fcs s)sruaurp;t1tee  i3iaslm ulnvpn(0tlxnxf3tytopD ln i s s2tmim3io4ll elfvt s  Duaur ;o0tltn feilt s2uan o u0aleoxo oy1oaDeauvs;() 2xoio nu1al nmnvta( srum( p;t0texn ietasls2rluvsnu4 eerif iydom e ivs s)setrxr3ny4lpee nvsltfsDrax p;u0olt mfctls m2emuvsn()alxrxociydfm  luvi;t0 2xr(m3nodlp n fet (fsDurum nt4tptn ietytlm eaums;t) rtnxr3iy1lpD anes s) etmxo3oo4lp nlfeta( sDrax  nt1ale  ieildlaDrln p t) eenmo3oydomDeli olt)t2ur(o oy4lptemivt s)s2rm(mont1ape iictys s2uauvont0aeenmf3ia1oa r neol( sexriopoy1lme lncils) 2ua(monu0alxnmf3iatla ranmo;(4aleoxr3totoptrlu i (0 etoir io4altemfvsls)s2tr(moot0tpxnmo3taslsDuan o () ltnmf3iadfate neo;t  2umxo3oodopeemfvs ()sDtaxrp;u0tpeo i3tadla um( s;(4 lxrxr3totoate uvsls  rtmxmpno1lpeemnviasf Dtmumont4tlx  o3iadlmDem( snt4alerxf oodfm e nvslt0texmxr iu1opeemncsls) 2ra( ono0tpx  oeilt a2ul( p t0alerir ia1opD li o;t0 etrxrpiy1lpeelnetasfsDrmx onu0tlx  fcildfm2rluvp;(0 eeniocoytlm r u ils) eum(o3nydapeemfci sfsrua(rpnt1aee ii3iytls emuvonu)tetnmf3ta1fateli ol(0srumir3ny1amt mfvias)aDumxmpou1oeeomocild mDrmnmpn(0 eenxr iodfaDeli i () exoir3ny4amte nvtlsfa2tmxr oo4alxn oeils a2eln p;t4trxoir oadfmD ln s;( srtmiopou4lmtnlfvilsfsruaxr ou0aetoiocilsfm2rm(vs t0 ltnxrciydfa eau slt0s2tmio ou1lle mnesls srrr(mp;t0tpe ifciydfa2rln p u)tlxnxr to1fatrau ols0truoim3nu1ameemivt ( s2tmum ;u4aexoio3ilt m rmu s ()trxnxo tadlp rau s;t  rtoxm nudole lfesls)sDurx o;o0alxnmi3tyslmDrln p t4alxoxfciotfatelies () etoxm no4op emfctl( sDur( ono4oee  i3iat aDuau ont0 rxnxr3iadfa  lnvol( s2trio oo1altnlivsa()aDtrxr nt1oexnifetadlsDrlnvp t)artomf3iatfmDeluvs () 2urxmpiu4lme lfctlsfa2uru ono0tpxoifetytlsDumnmo;t)aexnmo3totfm r uvslt0 2uoxo3ou1op   ies (f Dra(r ;u1aexoifciys mDua(vpnt0areoir oydoatrlueils0tetoio3iy4ale mfvil()s2urx pnt0aptnioeiaslaDul( sn(4artrmr3iadlat  i o s srxm(o3no1optnlnes ()a2trumo;t4tetnioetadfs rmn pn(0 rxrir3oa1faDe ies;(0sexoirpoo1ame mfcsl( aruau  oo1oexn o3ias a2ea( o t)alenirciydlm rai i;(  exrirpny4opeemfciasfs2rm(rp;o4oleo f3tat s el(mp;u0artrio iytfpDeaneo s)t2toim3ou1ope mfcia() 2uaxmoot4tleomfciasfmDemn s t)artnmr oo1oa elues s0s2urimpio1opt mict ()s2rau ono1oeeniieiaslm umu p () eenirctytla  aivi;( t2um(m io1lmtn feia( a2umur ;u4aeeo octytls2rlnms;(4artnmrciodfaDelueo;s)trtoirpiy1olenlfet sf 2tru  ;t0alxnio3iydlm eau p;(0aetrmo3totfatrluvo;(0seto(rpiudlmt  ivs tf Draxrp;t0oet mi3iadls uanvp (4 renmr io1fp r ivilt0trumxm3oydlmtelfesas)sDumxronu4aet  fetasfm2em( o (0texoxf iy1fate iei;s0sexmxr io1omen nvtlt)srrr(moot4apxomfctydls2uan ont)tetrioctotfpt  u s s texmirpoo4ap n neilt a2trur ;u0opxoio3ild mDeanmsnt0teenxf iy1omDeaieo;s0t2tmimpiy4apt micsa()a2umxmo;u4oexo oeildls2rau o;u4 etnxo oadfaDelnes;t) rurim oodlmtelivs t srtax pnt1aexo ieils m2eauvont0texnio iatlpDran i;t)trxmimpoodom e fvtls)aDtaum no0oltnifciatlsDumn s;u)aetrif3oadlat  ivo ( trtoxr3iy1olt mivils) 2rrxroou4apenii3iat sDrmnmp t0 lenirciy1fmtr ues t) 2xrio iydomtnlfetas) rrruront1aptoiocildfs uln s;t0 lxoxf3oodfa raies;s) rxm(r3iudam e nct (  rtmx  ;u0alt moeildls2ulnvs u0 ltoxo3totoa rai i t)srtm(mpiu4am emfvi ( a2um(rp;o1opeoiieiydfs uau o;t0arxoxf3oytlmDeauvslt)t2tr(m3nu1oleemictl(fs2rax  nt0aptoifeiytfa eln s;(0altomo tydop raieo s0teurim oudolenmnvslt s2rmx  nu1tlt io3tls a2em( p t4 rtnio oydom r ues s)trxmimpou1op n ivs t) 2tm(rooo1apen i3tldfm2rmums;u4aexoxrciytlpteauvs;t0srxrxopou1ap  lfei tfaDumumo;u1aeto i3tld m2el(vont)aexnxocto1oa  li ol()teum(opou4om   fetl()srraxro;u1tpenmo3ilt s2um(vp;t)tlerirciydoaD an i;s s2ur(mpiodap e nvta()a2rrump;o0oexoifctysla em(vp;t4 etnmoctotla   i ils  2toxm iy4apt  nci sf Dtrxm ot0tpxn o3tld a ranvpnu0 exnxrcio1fmD  i o s)texr(r3io1lme mfeiat) Dumx  oo0optomf3iytlm ran p;t)altnir ta1fmD aieols)truoiopny4ale  netas)srua(mpnt1tltnioeiltls2emu pnt0aeermf iodfpD  ivo;t  exo(r iydlm e iciatf Drmumpou0tex ii3ils a ulu p u)trerxf oy1fm  au o s t2xoio ny4lmt  ncsa( arrmum ;o0aetomicils mDem( p;u)aeeoxociatop e uvi;() exoxm ny4ll nlnvslt s2rm(m no4tet mi3ilslmDuauvon(0 eermr3iatoaDe nvilt0 rxrxr3no4lmenlies s srum( o;u4ale ifetysfmDul(mo (4 exrio3oy1laDeaivi (0trxrio3nudap nlivil()srtaxrpnt4texo ieiltfmDea(vsnt0altrirciodlm  anvo s  rto(rpio1alt mietls  rtru  ;o4opxo i3iad aDuauvo u0altrxrctodlpDraivolt0 rxr(o iu1omtn fesatfs2uax p;t4tpenioeildlm raump;t4trxrxr oadlmt  ivs;( srxoxm no1amtn ivsltfsDrr(mooo1teeoiociydfmDulnvonu) lenmrcootfaDraivol( teumxr oodlmtnlfvta( sDtax o;o0apen ociadfs2ua( pn(0tlxrif3oatfatranes;(0t2xmxo oy4omtnmiesl(fa2raxmp;t0texn fctat sDemuvo (0aeenio3ia1oa  li sls0seurim iy1opeelnct sf Dtaxr nt4oeenii3iysfs eln pn() ltrio3ootfa  luvol()teum(mpiu4lm  mnetltf 2ua( pou4oltoifeilsls2um(mp;()artnmf iatop   nvs (0s2xrxm ou4ole mfetas sDum(ro;t0alt ifcildfmDrm(vp;t0 lxnxf ia1om e ivols)texr(m3nodom elnetl(f 2taxr no4opxniicilslm2el( s t0 exrxoctadoat  u s s s2urxmpiy1omtemnvsa() Dtrum ou1aexomoeiysfm umump;()teeoxr oa1fmt aues () rxrxo3iu4al nlnvtltfs2umxrpou0alxoiieilsfs2em( s;() lenir iydlat anei t0 eto(r3oy1apteliesat) Drruront4tpeoifeiydls2elu s (4arxoxf ta1late uvi;t sexoir no1omee ict ( aDurxrpou4apenmieilsfmDeaumo t0trxrxf iatopD lnvs (  eumxrpny1aleeliet s srrr(mp;u0teenmo3tydla rm( p;u)teenxr3tytop r ies;()s2uoir3oo1ol n ies sf Draxro;t0oltnmoeiadla ra(vp t0tleoif3ta1fp   nvs;() exoxopiudolenmici s  rrr( poo0apenmfciasfm ua(mont)texrmr3io1la rluvsls  2trxo iy1ol nmiesl(fa2taxmonu0oet ifcild mDul(vpn(0 reoxr3to1lpDr i i s0 2xr(r3iu1lpt  ies t) rrm( onu1alto feiysfmDea(vs t)trtrxr iy1om e i o t  rtoxo oo1optemfvtas) Dur(mono0tetnifciyslmDean s;(0 ltnmr ootlmt luvi s) exoxmpnu1llenmfci sfsrta(r ;o0oetnioetad s um(vonu)tltoxfcto1fmD au i;t t2to(rpiudlpt licilsf Drm( pou1oleomfciadfaDemu snt4 lxnmf3ootom  aivols)texr(opou4lme mfcs t)aDtrump;t4aet mf3tydfm2rm(monu4tltoio3iatom  lneo ()s2tr(o3nodoptemfcta()srrmxmo;t0olenmoeiysla rluvo (4teerxf ia1lm  lu s ()sexmirpiu4olt livt sfaDtmu  ;o1tetn oeiys m elu o () rxnxocoadopDeaieo t0trtmxo3iu1apeemnet ()srumu  no4opxoifcildlm2el( o;u) ltrmf3iytfaD  ies;s trxmio ny1apt  iesa( srrrumpot0oexomo3tlt sDelnmo t)altrio3io1lmDeln o;t0t2xm(mpoy1lltn ictl(  rtm(m no1ole  ieiyslm ua( p;()aeeomf3oa1lm rlu sls0 rtrio iy1lptnlieil(f rrmur ;u4tptniictat sDul(vs u) ltoxf todlm ranvi s setoxo3ny1ol emnctlsfsDta(mpno1alx  iciadls umums () rtrmf3io1faDeli o;()teumio3no1al   nvsls  Durxmp;t0tpx  fctytlm2ua(vo u) lerif totfaDelueo (0setmxo3iydlmenmfetltfartmum nu1opt  oeiatla umuvs;()aetrmo3oa1omDe uvi t seuoxr3io4lptnmfvsls a2tax pou1tlenio3tld s2elnvonu4texrxo tytfaD luvs t  2tr(m io4ol nlics t arrmurpno4optnmfeiasfs ea(ms;(4trenif oa1fmDr uvi s) 2xmxm3no1oltnlfetl()aDra(rooo0apt mfeildlsDumu pn(4 lxnircoa1opDrau sls t2tmim3nudope micsas  Duaxrp;u0opx mfctld mDulnmp (0trtoio3iydlm eanvsls) exo(o3nudom emicils)a2tmxrp;o1olxoio3tadla ulnmpn(0alermo3ta1oaD lieo;s0s2tmiopoo4ll e nvsltfsrtmx ooo0olt iieiadfmDumuvo;u) exrxrcoydopDeauvi t srxr(o io4amt  nviasfa2ua(moou4alto oetls a ulnmpnu4areoir iydopt lneo (0 exrxr3ou1omee nctlt a2ra(mp;o4tptnif3tyd a2uanms;t0 eeoxf3oydoa e n s ( t2to(m oy1amt lfvilsfaDta(m ou1tpen o3iatfs2elumonu4texoioctatfp  aivo s0s2um(r3ou4om  lfesasfsDtax  ou1tpeo f3tat aDrln s;t)trermfcoodom  au o;(0t2ur(o oy4llee nvt (fsDtrump;u0aexnif3iatlm2emnmo;(4 etnxrctytoatran ols0srtm(rpoy1om  lncsat) 2uax ono0tee iictldfs raums u)aetnif3iadlmDelueo (  rxmxm3iydom  lncsa(fa2urx p;t0tlx iicild m2rlump u0tltnxr3iatopDe nvolt0 rumxo nudaltelfcsls srtmxm ot4oetoiieilt a rmump t0altrxo3oytfat auei;t0setrimpio4omt mfesat a2rax pou0tpxn fciatfs uanmon(4 ltrmr oatoateai s;t sexrxr iudlltemietas arumu ont0tetn ietadfmDeanmpn(0aexnxfcia1fa  ai o;s0srtoimpoodlp nmfesl( srumu pot1tle mi3tydfs2ulnvo u) ltrif3oatop  anei () ruoir3oy1olt mnvtlt)artrxmoot0alt iocild s uluvs;(4altomo iytfp e n o t  rxrio3ny1ol  lnei s)aDrmu pou1oeenmfciytla ul(mo (4teerxo oadfmDeaivsl() eur(rpny1opee nesl(f 2uaurooo1apeoii3tyslm eau o t)alenxrcoy1lpD  u olt)trxoio oodol nmfvi sfsDur(  ;t1texomi3tld sDumumsnt)artoxf3totopD aivs s  eum(o3iu1ap  lictat  Draxm ;t1olxn oeiytlsDea(vsnt4aexoxr oodoat aies;(0sexrio3no1am  mfvt ( s2ta(r nt4apeomoctasla ra(mo t) rxoxo3oa1fpD li olt0texm(opoydapeelfeiltfsrtmum ;o1aexnmi3iatfaDul(mp;t0 rxnxr iatoat luvs t texo(mpnu4apeemnctlsf Duaxmpnu0olx io3taslm2rlnvs t) exoif3io1faD  neo t) rtm(m no1amen feils aDtmumpot4aleoioeilsfsDrmnmsnu0 eeriocoytlat  ivi;t) rtrxrpny4lptnlnetl(  2rr(rp;u0apx iieiatfs2rm(mp (4tleoio3ty1laDe uei;s  2xo(opno1alt mfvia( sDurur ;u0tlxoifeildls2elnmo u4aetrif3oodlm  aueil(0tetoxm3nydoptn nvsat srta( o;o0tlxo f3iyslm umumpnt)artnmf oydlp r u i;s t2xrxr3iu4lmeelivil( sDta(moou0aexnmf3ild a2ranmo (4altoircio1faDr uvo;(0srurxr3ny4lmtnlnvsas) Dumxm ot1opeomfetysfa2umnvo t0 ltrmr ta1lateauvs
\ No newline at end of file
@@ -0,0 +1 @@
+nvo (  2uo(r3oy4lpt lnvi tf rrm(rp;o0alenmoeiytfa2em( onu0 exrxfctodlmtranvolt seurxr3iodaptn fviltfs2raurpnt0apeniiciatlsDumnmo (4 ltnmfcoytoateli o;(  2xoirpnudam emfvi () 2ururooo1alx  fctls a2rlnmsn()texrmrcta1fatr nes s seur(m oudom elnesasfsrraumonu0tptn feiys sDeln o;u4texnmf3tadlaDraivo s0srxmxmpny1amt mfesl(  rtm(r ou1aet miciys s ea(vs;t)artoxf tatlpteaneol() eum(o3oo1olt lfcsls)aDrm(m ;o4texnmoctyd s2em( o;t0aeenxoctotfm  lnvs;s) eurimpno1lltnmfctas sDrrxr ;o4oexnmoctyslm rmuvs;t4trxoxociadlpDeauvo;()trurxm3no1optnmnet t aDrr(rpou1oeeoifeiasla2ua( p;(4trxrif to1laD  ieil(0t2xrxopoy4llen ncs s)a2tax  nu4tptnmi3iydlaDelu p t0tlermf3ta1laD  u o t  rtmxrpoy1om nlfct ()sDrauroou4tet moetad m ra(ms u0teerif3ootlmtr nvi ( teumxm3oydomee nei t)srrrxmpoo0olto i3iatfaDul(vp u)trxomrciytomDe nvs ( seurim3nydoleelfes t)sDtr(root4ope if3iydfm emnmo;t0tlerir3tydfpDelivo;t0t2xr(o io1ol n ics t a2urxm ou1aex ifciasfa um(vpnu4 eerio iotfaDr uesls  eumimpiu1ale  ieiltfarua(roou0tpxn ieiys m ulumo () exomr oytfa raivs ()trxrxr3oy1opte ivt s)sDta( poo1tpxoii3tys aDrln sn(0trxomrcoy1fp e i i t0 rurio3iodom e fvs t  rrr(mooo0apeo i3tadfs2eau sn(0arxrmo totlmt au s;()t2xrxr iy4optnlieiatfaruauroot1olxo oeiysfaDum( p;(0tltrxf tatlpDrluvo;t)texr(m3oo1apen nesl()arrmx onu4aex mfciatlsDuan snu4areomocio1omDraueils0 2uoimpoodlm e nvt t)aDtru ont4alx moeiatfaDelu on(4 rxoio3oadfpt au i;s0 2umir3ny1ap  mnesat)srtrxront0ale  feilsls2uluvo;u0arxoxrcia1fp rluvol( sexo(mpoy1alee ieil() 2raumpot1tpenmf3tasfa ranmp u)tltomf ia1fm  lneo;t setrim3nu1optelneiltf Drrum nt0tlt ifcias aDrmu p (0alxomfcoadlp e ivols setmxmpnu1ame  fctl( srrru ooo0ale io3ilslm eanvp t0trtrxocta1lp eai s;(  rxrim3oy1ol elfvsas)srtauro;o4altnmictadfs ul(vo;u4tlxrifciydlmte u il()trtrxo3nu1optnmfciasfs2taxrpou4opx mf3ilt mDranms (0 ltoif3oy1laD anvo;()srum(opoodole  fvslt srra(mo;o0altomo3ildla2rmuvpnt)aeenifcoa1opD lu o;s)sruo(r io1oltelfvt sf Duaumpoo4oexn i3iysfmDulums u4trenxoctotfmteluvils)t2xo(m io4ame  ivi s sDumur ;t0tpxoiiciytlaDum(monu0 ltoif3tydlm eaivi;t texr(o oydom   nct (f Dum(monu4ope  ociyd m eau s;(4tetoif oatomDrli i;(0 rxmxr3oy4amenlici (  Dtm( o;t4opto fctat s emu ont0aetnifciatfa   ivsls0t2umimpoo4om  mivsl(farur(mpoo0olxo i3taslm ea(vp;t4texrio tytfp rli i;(0sruoxr nu1ol emfeias)s2trur nt4oltoifeiyt m rmuvo;u0arenxo tydoptr n o s) 2uoimpnodol e ics t)aDrmu  no0opxn ociatfsDemumpnt4texnxrcoa1lmDelu i;t)t2umimpnudam   fvt tf rtru p;t1opxomietatfmDeau o;(0 lxniocoatfatran o;s)sruo(m3nodlm  lies t srtrxroou4tptn ocilsls2elnvpn(0aeenxr oodlpDe nei (0 eto(opio1apeemici t)s2umxmpno1tlenmietaslsDrlumo t0 exrio oa1la eluvil()tetrirpou4ole mnesl( arrrxmo;u0tltnmieiadfsDra(vont0aeeoxf3oa1fa raieilt)t2xmio nodoleemnci t) Draxmpot4altn feiltfm ea(mpnt4 lenxf iatoa rluei t0 rtoxm3oy1oltelfetlt)srtm( oou4opeoif3tlt a rau snt) ltomf iadlmteln s;(  2tmirpno4lleemici s srrmumo;o1alenio3iad a el( o u4arxrxf iydfmDr u o ()seum(o3nydlltelfcslsfsrrru  no4tlxo fcilsfaDuaums t0texoiocoydfp eaiei;( sruoxr ou4omeelfvi s aDrmurpno4olx  oetydfaDem(vsn(4 renio oadlaDrau ils  rxrirpiydlle lnctasfsDtr(mont1texo o3tadlmDuaumon()tlxnxo3oo1latr n sls  2um(o nu4am  lfctat)arrrurp;t0oexoiieiadfs rmuvs (4 rxrmfciatoate nvo;(  exmxmpoydapen ncta( arua(mpot0opx  i3tlsfs rlnmpnt0trtomo ootomDranes t0 etr(m ou4op  livs (f Dtrum nt1tpeomo3iysfmDeanvpn(4 renxocoy1fp e neo;t0 rxrio oudlpe  ietlt)a2tr(r ;t0olx iieiat mDrluvp;u)artnmf totoa eauvils0 rtr(m oo4lmte ieslt  Durum oo1oeeoii3ild a2em(vp;t4 reoxfctadlpDeaneil()sexrxm3nudlmenmnctlsf 2rrx  nt4tptoii3ils a ranmpnu) lermr3tatoa rlieo;(0 etoxrpiy1ap emicsltfsrum(mpno4oleo fetltfmDua(msnt0tetnxr tytoaDeau ilt)texrxrpnu4oltnmiviasfsrururooo0altoiociad a2ra(vp u4texomr3io1lp   ueolt) 2xr(m nydolen nctat  Dtr(mpnu1aex mo3iydlmDemn snu4tltnxfciotoaDr i ilt t2uoim3iu1apte fcs (faDtaumoot1alx ifctys s2rmn snt0texrio tadfpDeluei;t0s2tmxrpoydlpt  nvtl(fa2umumpnu4tex  o3iltfm rluvp u4artniocty1fm eaivi t)s2to(o iy1ameemics s) rtru o;u4optn ietadls eau pnt0altoxo3ia1lmDrluvsls0seuoio iodlm   fcsl() Drr(r ot0alen o3tld s2rmnvo u)teermo oydom  lues ( t2toxrpoydlmeemfeslt a2tr(r no0aeen ieiytfmDum(vo;t)teerxf iy1oa eauvo t  rxr(opou1omt micsa(  Durxmoou4teeo ocild s2uan o;t4alxomr totomt an s t  2xo(r3oo4apt  fesls) rta(r oo4tptnmoeilsfsDuanvont4tetnmrcoydfmteai ol(0 rxoio io1ll e fvtasf 2tau poo1tlxomi3iysfm rm(msnt4aetrmo3oydoate ueols  2xriopoodal  lici ()arururpou4altoioeiytfaDeauvs ()alxrircoodoatraieil(0 2xrxopny1ape  ivil(f 2rmxmont1tptomo3ildfaDean o;u0teenxf tadfate u sls t2xm(mpiu1optnmnvi (fsDtaumo;t1apxnif3ild a2raump;t)tlenxr oatopDrli s;(0 rumir3oy1olte fvs tfsDumxm ;t0alt if3iltla umnvs t) ltoxr3to1oatrlnvsl(0setoxm io1lpee fvs s  2uax p;o0aexn octldls2umums u0aeerir3iydfptrlueslt)srxoxrpou4lmeelfct t a2tmu p;t1aetnmo3tldfs2uln snu4artoxf oatom  li sls0trtrxr3io1al elici tfs2ra(m oo4oexnmicilt sDuau s;u0 leoxrcoodlm rluvol()t2urxr3ou1lptn fei sfs2trxr nu0olx ifetatfa2elnvsn()tlxrxf3oytfa  aivols srtr(o3ny1opee fvs () rtaumo;u1apx if3tasfm2uan p;t0aetnmocoydop  luvi t  2xrirpou4ol  mncta()a2raxroou1aptn o3iaslsDel(vp u)teeoir3oydoat  ueo;s0sexr(opou4ol e fvt sf Dum(monu1apx  fetldfmDuluvo;(4altrif3ta1la rlnes t0trtmio3no4op emivi tfa2ua(m nt4ale mf3iyt s2elumon()texnxo oytla r i i;()truoxo3oy1alt  fci tfaDur(rp;u0texomfcildlm2rmnms u4 etoxr iodoaDe u s s)sruoio nudlpe  icsasfsDra( p;o0olen feiatfs2rl(vp t0 lerxr3oa1omteauvo;s  2tmxopoo4op   fvt ( a2urxm ot4oleo fciltls rmuvpnu4 lxniocoatlmt anes t0 2uo(r3io4amen nctlt  Dumxr ou0tex  ieild s uanmp t)alxomrctadlpteau ols0sexoxr ou1al  lnei ( srrrx  ;u0oexnmicildfa elump;t0 exomrcoo1oatrai il( sexo(rpoydlpenlnesa(fa2ur(ront4oltomoetyd m2em( o;u0tlxomf iodlp elues s s2xm(m3nudllt mfvil() 2uau ono4tlenmo3iydla elu s (4 lxrxo ootlmtrluvi s tetrio oodlme  feslt  rumumpno0oleomo3iatla rl(ms;(0trxomf3oytoptr ueo s sexrxr io1omenmnetas) 2raurpnu1olx mi3iydfs2umn pnt0 rxomo3tydfmDeln ilt texrim nudam n fvias)s2uru  ;u1alx  fciltla ea( o;t)alermo tadop raiesls0 rtmxo iy1omtnmneiatfa2raxm ot4alen ieiadfm uanvp;u)tltrir oodoateluvi s)trxrxr iy1ap   neta()srur(  no4tltnifeildlaDumnvp (4alxnircoadlpD an slt s2tm(r no4al e ivi tfa2tm(ro;o0ale mfciysls2raumon(0tltnxocoodomteluvs ()srum(m3ny1lmt miviatfs2tmxro;o0tpx  fcildfmDrm(vsn(4areoir3ta1fmt  uvo t  rtmiopiy1aleelfviat) 2um(mp;o1opeo feiltls2eanmsnu)trerio todfa   n i s0trumxr3ou4lp nmfvsas)aDuru  oo4tpeo fetytlmDul(vsn() lenxfctadlaD aieo;s  rto(opiydlltn ncsa( a2tmu  ;u4tptn iciad m2umnvon(0 leoir iytlatrln ils0srxm(m no1lm   neil(  2rmxm ou0tee ioeiys aDemump t4 rxrmr3oa1fa rlnvi s0 2tmxm3iy1altemfct ( s2trxrpot0openmfetytlsDuanvs (0altomocty1om rlneo ()seur(o oodam n netas srur(r ou0alto f3tytlm emnvs () etnxfcoy1lat  n il(0 exoirpnu4lp  miesasfs2uau  ;o1aptn feild a2rm(mp;t)treomr oo1fmDr iei t0s2tmxrpnu1omenmfeias a2uru pno1tpeoiieiltlm2um(mp t4 rxnif oy1lm r uvs s) 2xmxr3oy1alte fvsasf rur(rpot0tetnmoeils s2eln o;(0aexnxrctatfm elu olt)t2urio3ny1amen ivt t srrrur ot4alt iocild a uauvp t0aexnxr totopte iei (0texrxo3iudol n ieils aDuru  nt4oeto ieiytfaDul(ms u0aetnmo3totopD  i o;s0trtmimpio1omt miciatfs2tru p;t1teenmoetatfsDrm( s u) rxnifciy1oaDrlies s0setmxopio4op nlivsltfartm(r ;u1optomiciydlaDrlnvs u0 rtomo3ia1fm elu olt0sexr(m3no1ope  ivs s)a2umxro;o1oexoiictatfa2ranms u)aetnxr tadfmD  nei s0setmxo3iodlptnlnetatfsrraxm nt4alxn feiysfa2umn pn(4tlxnmo totoa r nvsl() 2xo(r3oo4lm elivi (f 2trur no0tlenmo3tydls umn s u4artomf oa1opte ivs;t)srtmxr iu1ol  mnvilt)s2tax oot1tetnmi3iyslm rmuvp;() rtnmr oytop  auvi;s0 rxriopnydlltnmfeilsfsrrmx pnt1alen o3iasla em(vsn() rtrxr3tatom  lnvilt seumir ou1ap n ivias) Drruroot4oeeo icild a2ulu p;t4 etrxf io1omteaivo;s s2tmxrpiodop e iei ()artrumpnu1olxnmoetydfm umu ont0teeoifcoy1lp raiei;t  2xoim nudllee fetlsfarua(m ;t1alxn f3tydlaDrau s;u4 ltrir3iatfa ean i;(0 rxrxrpnydll   ncs s)s2rrx o;t4alt  ieiytls rmumsn()trenmo ta1fptrlneil() rxoir no4ll n nvi s)s2rm(mooo0apx  ieildlm2emuvs u0 rerir tadom r i i;t0 etm(o3oo4olteliesat s2raumo;u0apxoif3tysfm2eanmsn()alxnmrciytopD auei;s0 etoxopou4op n ictas arua( pou0olxnioctasfm2rmn p;t0treomo3oatoa r nvs t  ruoimpno4omeelfctls)srtr(rp;o0opxnmfeiydfs2rl(vp;u) ltnif3to1opte nes;( teumxrpoodamt mfesls)a2um(rpot0tpeomo3iyslaDulnmp (0 exnmo3oadlmte uvs t  etriopoo1omenlfes t a2tmxmp;o1aetnmi3ildfsDelu on()tetnircty1om e uvo;t texoim3oo4lptemfetltfsrrmu ont0oetomo3tlsla elnmo t0 rxnio3iodlmt  u sls0teurirpnodal  livslsfsrua(mpoo1altnif3tlslm2emnvs (4alenmr todlmt  ueilt s2xrxr iu1ol emivil(fa2rrurooo4tee  oeiyt sDel(mp t0altrif3tytfa rau sl(  2xrxr nydllt lnvtls)aDum(rpno0altnii3iasla em( o;t0 eeomr3oa1fpD auvo (0srxmxopny1ap nmnvil() rrm(r ;t1olt  octlslaDuau o;u0altnio oo1oateau sls)s2ur(r nu1ap e iesat) Drrx ont4ope  f3iytfm ulnms;()tetoir3tadfmt auvsl()srum(m3oy4op n ies ()aDrm(mp;o0optnmoctysfmDumnmonu)tltoiociydfp rli o ()sexo(m io4lleelnctat arta(rpou4texoifeiytls ulnvp t0arxnmr oydfatelivs s0sexrio io4omeelfctltfa2tmurp;t4tpe moetyt a rmu sn(4aexoxocoydlaDe nvi s) rtm(opiu4olen fcsl(fsDrru o;t1aetnmociys m ran s (4 ltoxo io1opt ln ols)t2tr(r oo4alenmietl( a2um(roou0oetn f3iasfmDumu s (4trenif3oatoa e n slt srtrxm3iu1om nmiet s  rrm( pou1alenmictad m ea(vo;u4 reriocoy1lpDean s;()texmio3ny1lpenlfvs s s2tmu  ;t0aleniiciydlm2elu o ()tlenmocoytlptelnesl( sruoirpoy4ameemfvta(  Duaxrono4apxn iciatlm eanmsn()aexrmoctytfa e uei t0 rtoimpnydam  mncsl()arrm(mo;u1oleoio3tltlm2ea(ms t0 ltrif oo1faDe u i (0 etoxr3oodap  lfvs s)sDta(r ou0ape moeild aDran snu)aeerxf3ia1latr ies ()srxrxmpnodam nmfes (f rrmuront0tpxomictysfm2el(vsn()alxomf3iotlmt anei;t)trurim oy4ale livtltf 2umx onu0oet mfctatla eau sn(0teenxf3totfpt lues t0 2urxopoo4lm nmieiasfs2uaurp;t0alt  oeiatfs ea(msn()arerxfcto1laDe u i t0 rxr(rpoo1olt lfcsls  Dra(rp;o0ale  ocias mDumu o;()teerifcoadoaDeau sls0teuoimpnodlm elfviat aDtmumpou0olt  f3tadfa ul( snt4 lenxrctydom elnes;s  etmirpoo1lle  ncia(fsDumu  nt4aptomfetas s ul( snt0trtoio3ootlmt aieslt  exr(r ny1altnmfctasfsrtax  oo1aleo i3iytlm uanmp;(4tltoir3ta1laDe ues (0 rto(o oy4opeemnvi s  Drm(mpno0tlxoifeiadlm rlnms t) exnxfciy1la  au o (0 2tr(m3iudoltn fvtlt a2uau  nt1aetnmfctyt m2el( p t4trtoiociatopDe neil()seto(m3oy4apenmnvtasf Dtmx oot4oexoifetldfm2uln s ()teermo3tatfp   ivolt0setrxopiu1aptn nvtasfsDtaurono0apx mi3iysfs ua(monu4treomoctodfateli i ()trxm(m3oy1ap n fcsasfsrumumo;o4alt ii3iatlaDrmnvo (0alxoxo3ty1om elnvol( t2tmim3oodlm nlncs (fa2tm(m ;t4tetn fctydla rmnvp;u) rxoxo totoaDrli ol( s2xrxm io1ope mnvtlsfsDtr(moot0ape mf3iydlm rl(ms;u4altomrciodoate neo;s0texoxmpio1optn ivsl(fsrurx  oo1alxnmoeilsfm2uauvs;t0artrxo3tadlptranvs;( srtmxm iy1openmnvta(fsDtaum ;o1opx  octatls2umnmo;u)aeenmfciatlmDrlu i t) exoxo3iu1am elfeslt  Dtm( o;o0opt iieiyt mDrmnmo;(0arxnio totlp rliesls0truoio oy1olenlfei ( sDua(  ;o1tle ii3tltfa2um(vs t)texnirciotfm   ivi t) 2ur(m nydlmt  nes sfsDurx onu1tltn ieiytfm uanvsnt0 etrxf3tydom rlu slt) rtoxmpiu4ol nmfctas)a2rrumpno0optoifciydfmDrln o u0texrir iatomDe neilt)teurxm3nudlmt  fvias)srurx o;u4tet  ieiaslsDumuvo () rtoxr totoptraieil(  2urim3iu1lme  ieslt  Dua(rpou1opt mo3iat sDea(vonu)teeoxf3oy1oa  lueols  2xoir3oy4openmfvtl(faDuau  nu0tlenmi3iat s2rmnvsnu0aetnmr3oo1fatrluei ()seuoxo no4alt mfvtatfaDurx o;t1tet ifcilsls2ua(vpnu4alxnmo todlm rau i;()trurxm3oo4ll emivsl(faDrru ont1openii3iyd sDrmu p ()tlxnxo3oatlpt lnvol(0srurim iydal emfvsa(fsrurx p;u4tle if3tydfsDea( onu4 ltrif io1lpDrai sl() rtmxm3oydame mfviat aruru  ;u0aetn o3ild mDuau s u4arenmociy1lmtr ivo;s0s2urirpny1al n ics t) Dumxrooo0opxo f3tadfa2rl( onu0 rxrifcoatoaDrauvil()srtr(r3oo1am   ict (fa2tmurpno0oeeoio3iltfm um(vs;u0aetoxfciydopDe nes;()teuriopno4lltnmfcsls)arururono0opeoioeiadfs2elnvsn() eeoxrcoodom raueolt t2trim oodoleelivils)aDrmu oou1opxnmo3iadlsDumn onu)aetnmr3oadoaDeai sl(  euoir3iy4ol n nvtasf Drm(mpno4oet moeiydlm2uln pnt4trerxrctytlaD  uvolt0teurxrpno4amt mnvsat)aDuau  ;t1opeomfeildfm ranmp t4 rtnmf3iydlptr neo s0tetmim3no1lmtnliet (fartaxmo;u1tltnmf3ias m emu o;u) eeoxrcoytlmtr u s t)t2toio nudomee ncsa( aDtm(r ou1teenmfetld a2rmumo t4tlxoir ta1fatrlneilt)srto(o3iy1om  lies s)s2urxro;u1ole mieiat aDrlu onu0aetnxf3iydopD luvs;()tetmirpoydal emnetlt  2rm(rpnu4oltnmieiyd m rlnvont4trtoif3oadfp rlieslt0 rxoimpou4apt  ietatfsrrm( pot0oex  fciytfaDel(msnt4 etrmf3ta1lat aues s) exoxopno1lmtemfcsa()arumu pot4tlxnioctltfsDumnms u0tleoxrciadlatrlneols0 2xr(opnu4omeemfct s  rta( poo0aeto octyslsDrl(ms;u4trtrifciytlmDrli olt seuoxmpiy4opte ietat) rrr(mpoo0oleoifcils a umnms;t4teenxr iytfpt livol( srxmio3nu1ll   fcsa( aruaurpot4ape mfcias sDumn o;()aexoxfctadoaDrli o;t srxoxo3ou1opeemfvi ( aDuru p;o0tpen fciytlaDeau pnt0arxrif tytoa eluvs t)srtoio3ny4opt  fei s)srumuro;u4aptnioeiatlsDrm(mp (4arenxf tadfpt  ivo;t0 rtrxopiodoptn fcil( sDtr( oou0tpt moeiysla um(vs t) rtnmo3iotlpDelnvi;(0trurxo no1lpt lnvilsfs2rr(rpno4opeoio3tltlm uan p;t0 ltoio oa1fa eln o t  euoir3nu1omtelfvtat a2rmxmoot0olt mf3iydfs2rl( s t0aleoxociytfaD luvs;t)sexr(opoodll emivsa() rraumonu0oet mfeildls2uau s t0 lenmr3oydlaDr uvi;s setoxrpou4llenlfcsa( srtmxmp;o0altoio3ildfmDelu pnu0aleomoctadfmDr ivo;(0teurxr oudalt lfcsls) Dtru  ;o4oee  ictld m ul(vonu)alxnmf3oy1lateaneo;t t2urir ny4ol elicsas  2tm(r oo0alxnmietysls eanmo;t)aetnif iodlaDr i i;s0 rtrxopny1amen ieil(f rtm(m ;t1oexoifciadlmDrm(msnt0areoxo ia1fpD  ies ()srurxm iu1lpe mfvtl( sDuaurooo0tpto ieiatfsDul(mpn() lxrmo3tydop eln o t srxoim oodaltemnvtls)a2rmu p;o1texnmo3tydlm2em(vs;(4 rtrio io1fmDeau o;s) 2um(rpiu4apenmfctlt) Drmx  ;u4olxnifciad mDraums;u0 etnif3iytoaDranvol()s2uoxrpiy1lptnmnvtl()artrxroou1tetn f3iytfs elu onu)aleomr3tytlp  ai i () rxoim iu4lptemneils)arrrumonu1olxnmoctytfsDel(mo;t4trxrmr oadlpDelueslt)srtrxo io1om  lfeiat) 2urxm ou0tee  fciasfaDua(ms t4alenirciotomt li sls)seurxopou1aleelietls)aDrmumpnt0alxoio3iydls ulumont0 rxrxrcoatomtr u o;() rtm(r io4opt livsasfaDtrx  ;t0teeomietadls2rln s;t)aleoxrctydopD lu ols  2xoxrpiy1lmtnlncsls)a2uaxm nu1tetoiieiltla emnmo t4tlxoir3iatoaDe uvs () 2xmim oy4al nlneslsfaDuaxmpoo1ole moctatls2ulump t0alxnmf oatop elueol( t2to(mpoudolte feta(farumu p;u4oetnifeiyt m em(vp (4 rtomrciadlpDrln o ()s2xmxr3iu1ll nmfvilsfartaumpot1openmfcias m umnvp ()tlerxf iadoatrau i s setmxo3oydlm e nes sfsDumxmpnu4teen f3iytlm rl(vsnt4tlxrmo3ty1la  anvslt  rxo(m3oo1ape  nvtl( arrm(  nu4oltn ieiltlm2eanvpn(0alxrmrciotoat lieol() etmirpoo1aptn nvtat  2ur(rpou4aex  octyt aDuau s;u)aetrxfcoa1lat  i ilt t2uo(rpoo4ale livil( s2tmxm ot4olxomociysfs uaumo u)arxoxfcia1oatrlivs s)s2xoxo3ny4lmtemnvta(fs2ta(m nt4tle mo3tatfa rln snt0altrxf3iodfpt aueols0t2uoxmpnu1lme lietas sruru pno0opxomo3tatlmDrlumsn(4arenxr iydfaD anvo;t0 euoxo3no4opte fvi sfsrraumpou4oetn f3tytla rmnmo u0aeerxfcoytlm rau s s) rur(mpiydopt livsa() Drrx pno4oeto fetytlsDrlu o;t4 eenir3iy1opD  nvols  2xm(mpiudaptnlfviatfs2rrumont1texoiociys a elnms;t4 rerxo3oadoptrluvs;(0s2xmir3iudap nmfcslt  2tax  no4oeeo fetlsls2umu ont4 rtoxf ootopDeln o;(0 rtrxmpou1alte fvtat)srrmxmoou0apt ifeilslmDra( s;u)aetrif iydfptelueo;s)srxm(mpoodamtemfcilt)arumu  nu1aex iiciysfm2eluvp;u4texnmr3tytfpDr u i t  etrir3no1opee nvsl(  rtmxmooo4tltomieiasla ua(mo (4trenxfcoadoat  u ilt) 2umir nu1lle  nvi () 2umxmpou0tptomieiadlmDuan snt) ltnxr3oydfpDeaies;t0 rtoir iy1am n fetls artmx o;t0oleo i3iatfaDumnvs (0aexnxfciotomDrluei;t sexo(r oudaptemnetatf 2trum ou0tetomociytlmDelu pnu4 eeomf3oy1oaDrlieils0trurxo oydlp nmiet t  Draxmp;o1tpxnio3iytlsDrmn p;u4arenio iatomDr i ols0srxmxr3iudlme mnvsat  rraumono1tpxo o3iysfs2rmu pnt0 renxr oatom eln ols0s2urxrpoo1al elneil(fartrx poo1aet ioctytlm el( p u4 rxomf3iotlmD  ueil( s2xo(rpny4ll  miet ()arumur no1tlxo fctat s em(vp;t) lxnxr iodlmDrlu o;()s2ur(r3oudalt mivtl() Dtrurpnu1aetniictytlmDumumo;()tetrxociodomDeau il( tetoir3oydlmtemfvt t)sDua( o;o1apt  oeiasla2rl( pnu0trtoxfcoytoatrlivi t0srum(m iy4am nlncsl(  Drrur ;o1ole mfcilt aDemuvs t4 etnio3tadfptr ueo ( t2tm(mpou1ameemfvtlt) rrmx  ou0texo fetysls ran onu4texnio iotopDeauei;(0teuoio3oo1aptemnct sf rrrxrp;t1open f3tatlm2ra( s (0 ltnmf3oydlpteau s s)srtm(mpoy4omee
\ No newline at end of file
@@ -0,0 +1 @@
+n ilt texoxo oodlpte icslt)srrmxm ou4tpxn feildla2eanvp t) lenxr io1fpteli sls)t2tmio3ou4omee feiatfsDur( p;o1alt  ociyd a2ulu o;t) exnifcoytfatrlnvi;s0 etoxmpoy1ope  iet s  Draxmont1oeeomicias s uan p;u4 rtnmo ty1fp e iei t0srumir3oy4amtelfcias aDtm(r ;t4apx ifeildfs2ranmo u)texomo iadop eau s s0t2trir3oo4ol nliei t) Dtmuroou4ape iiciydfaDuau s u0 lxrir3tatlmD  n i () etoimpny4amte fcia(f rrmxro;o1olto oeiatla2eau pnt)tlermf iydfateaneil(  rtmimpnudlme  ietl()aDuaumoot0aeeoii3iadfs uln pn(4aexnmr io1fpt  nvil()sexm(m3iodalen fcta(fsDtrxm oo1tpe moctat a2em(mo t4 rtoif iotop eluvi;(0texoim3no4omee ivslt  rurxmpnt0aetnifctydlm rl(monu)tleomr oadopDe uvi s trurxrpno4aptn ivsa( aDtmxrpnu1opxn oeiydlm2ran snt) eermr oydop r ivolt  rxoir iydape lfcia()aDrrxm ;t0oet io3tytla2uanvo u) renifcoydlmtr n i;t t2xmir3oydame  icta()sDrm(rpnt1optomfciydfa uauvp (4trtoio3iydoaDraivs;t0srtrim3no1am nlnvt s aDum(  ou4tetomf3ildfm ranvo;(0altomr3totfa rluvil(0 etrir3iy4amenlneiat) Dum( o;t1teeniociadla2rl(vs;(0aeermf3tytomte ues s s2ur(o3io1op nlncs (fs2uax o;u1apt  f3ilsls rm(vsnt0 rxnxf tatomteaivi t0srum(m iydll e nei sfa2ua(ro;t0openioetyt a2el(vo t0texomrctatom r nvs;s0t2xmxo iudape mieil( arum(rp;t0tpx moeilslsDelnmp u)alermrciydlate uvi;t s2umio3oudome lnesat aDtm( pot1tlxnmictltlm2rm(mp;t0 eerxfcoa1fmD au ilt s2trirpiudlp n nei tf rum(r oo4oetn oeiys a rln p;u)aexrxfcoadlmtrlnvol() 2umxmpiy1ome mnes s  Durumpot4tpe  ocild s2rluvont)altrxo iytlmDrln sls0sruoxmpio1apte ivs ()a2tm(mpnu1tptnmociysls2elnmsnt4 rtomo iatfa ranes s0tetmxo3ou4aptnlfcs t  2tr(monu1alt  o3tydlaDuauvsnt)trxoxf ootomt au o s) rxrxo oodomt lncilt)arrmurp;o4apt io3ilsfs2ea( p t4arerxf totfmD  ies t)trurirpou1lleemici s)aDumx pot0ole  feiat m2rau p t4 rxrmo3tydfpt aivs;t t2uoimpiy4olt liesl()a2rrurpot1alto ietydfs rl( ont4teenxociy1lptrai s;()teurxrpou4lle mnvslt)s2raxmpot0apeomoeiytfa umn s u0 rerxf iydlm   neo;()t2trxo no4am nlies s  rumu  nu0tptn fciyd m uanvont4 lenif oa1optrln s;() 2tm(o nu1lmtelncta( s2rrurp;t0tpt  o3tydla2rau s t4trxoxr3iydfpDrlnvo;( seto(r3ny1ol e ivtls srtm(m no4tetn fctadfsDem(vo t0aeeoxr3tydfmD ai ol()t2umxo no1lp emfei t a2trxront1aex  iciytlm2rmnvpnu) rxoxf3tatoaDr ies;( trumxm nu1opt mfetas  2ra(m nu1opx ioctldla uan ont4 etnir ta1oat anei t  ruo(o3iy1omeemictas)srtruronu0tpeomfciysla umumo;t)tlerxfcoodfatraies;() rxmxo nydamtnlnesat s2rm(r ot0alto oeiadfa eanvo;(4arxnir ootoat lnvols)trxmxm no4lm e fvslt) 2taxm ot0oexo ietadfaDra(mo u4 etomfcoa1la  li slt t2umio3nudlleemnvta(f rum(r nt0tpx iieilsfa2ulnms;t)aleoif iatfm rlnvo ()texo(mpiu1ol   nci (fs2taxmpot1tlxnif3iytfs2eauvon(4 lxrmfciadfm rln i;t0texrxm3oudaleemicsls)srumx ooo1ape ifcilt a2rmnmsnt)tlenir3to1omteanes s)s2tmio nu4lmee netlt  2ua(  ;u1opxn iciydla2emnvp;(0 ltoirctadfmtr ivolt) rumxm ny1omee neslsfa2rr(moot4apxn icilsls ra( s;t0trxrio oadla eluvo;() rum(m3oudamtn ictls a2raumo;t1tlx ioctasla2um(vp;u0texrxr3totom eauvolt  2trxm3oy1lp elnvi t aDrm(rp;o1aexoii3tldlm uln o;(4trermrcoatfpDeauvo;s teuoir3no1altelncil()s2rrxrono0tpx mieiytlm rauvo;(0teerxo to1opD anesl(0texo(r oudlpt lfeiltfartru ooo1tetniictlt s2em( pnu4alxriocta1lmt  u ol()t2xrir iy1ale mfvt sfsDrr(moou1tpt mi3iys m2rmu o ()tetoircio1lmDranes;()srtoxopno4aptn ictlt aDum(r nu0aeenmiciltlm2ua( p u) etrmr iadfate n olt)trxmio iu1ll   ics (fartm(rpnt4oexnmfetyt sDrmnvs (0 eenxo tatlm e ueilt) 2xmio3ny4op n fvt ( aDuaumo;u0olto ociytfs2umuvs;t)aexoxocoatfpDrli s t0tetr(r oy4lptnmnetas  2um(rono0oex ifeiadfs ulnvo;(0trtrir oadfmD lnvolt) exrxmpoy1olt mfes ()srrmurp;o1texomociatls2ulnvp u4 eenmf tadom rlu sls t2trirpio1lpt mnvs sfa2tr(rooo1aexomoetatlaDean o () rtoxo3tatfpt aieo t srxrxr3io1om nlnes t) 2uau o;o4tpenmfeiltfs rmn s t0tltomo oodlptrauvi s) exoim iy4lmtemfeiat  2uaxmono0tpeoiieiytla em(vpn()tltnmf3ty1faD  u s;s texmxm oodlptelncs ()sDururpnu4apx  feiydlsDeaumpnu4trenir3io1omt luvi;s0s2xoxo iudomeemici s sDuaxro;u0apxoiocilsfm ulumo u4tetomf3io1la  lnes t teuo(o3iy1op n nei tfa2um(m ;o0tpxn ieils m rlu p;t) exrxrcoatlmD luvs s0 2um(o io4lpeelfvtatf rraumoot0open ieiad s rluvo t0 lerxo3ia1fmt luvi t  rur(m3nu1altemfvt (faDta(mp;u0apxn icilsfs emnvs t0tetrxrcoydoat  u o;t0seurxo3iy1apee nvtat)s2rm(  nt1altn i3ilsfmDean on(0tltomfcto1fpDe nes t0 etm(o no1om  liei s  Drrumoou0oleniictyt s2uanmp u4 ltoirctydfp  au o t)setmir3io1omt lneiatfaruaxmono1aet  feiadls rmumo;t) exnxo3ty1opt  uvols0srtr(o3iydlptelnci s  Dumuronu4olxo oetatfa2uaump;u4tlerif oa1fmD lnesls s2xoimpio4lmt  iei s) rtrum oo0tpxomo3tys mDumnmo (4altnmo oydfmtr nes (0trxmimpiudam nlivslsfa2tm(ro;o0aeeoiicildlm2rl( onu0tetnxr3iodfm rai ols t2xrim iy1alenmncsl()aDtrxr nt4aeto fctld mDelnms;t) lerircoy1lp rlieol( trtoir iudlptn nvsl() rtru  nu0open ietat s2ul(mp u)texomf iotfaD li ol( t2xoim3io1llt lnvs sf 2trxrp;t1teen iciyd s raump t)alerifcoodlp eaiei;t  etr(opno4aleelnci t artm( ont0opx mf3taslmDumu o;u0 leoirctytfpte ivs;t0 rxmim nudlm n fci sf 2ta(rp;o1apx  octldlm2rlu s t4 rermf3iatoatean i;t seto(o oodlpt mfeta()aDur(mo;t1tleoiieias aDra(mp t0tetrxr3iodfaDranvs t  exr(r3iydamt  nvsas s2trx  ou1alen ictatls rauvs;u0trxoxrcoy1om   iei;s srtoir3oo1omtn nctls)aDrmuronu4tltomocilt a ea(vpnt0aexrio3oo1lmD  ivs;s)srxm(m nudop n nvtas arraxrp;t4opeomo3ildlaDrm(vsn(0aetomrcoadom eaivolt srum(r oy1oltnlfctas  2rr( pnt1alxoifeils mDrmnmp u4 lermo todoa raies;s)s2uo(m iy1lmeemicsl(fsrumxm ot0apx miciyslm2rluvs t0 eeoirciy1omt luei t0srxr(r no4llee netlt sDrmurp;u0alen feiyt m2umn p t0tetrmocoatoa  lu o s0s2tmio3iy1altelfvil(fs2rr(mono0tpt mociadfmDuaumont4altoio ootfmDranes ()srxoxr3oy1al elneia( artm(monu1altomi3iaslsDrlnvp u0 ltrmrctadfmtr nes t0srxrim3ou1alt  netl(fsDraxr ;o4apto o3tlt m ulnvo t0artnif3ty1fpDe ieo t) rto(rpou1oltnmfcs s s2rru pno0teenifciasfs uan p t)alerxf iatfmtraivo (0 2xr(m3oo1am elncils) 2ra(m ;u1oeeomfeiat s ra( p;u4tetnmf iadfmDr i o t  2toir oudaleemnct t)a2ur( poo0oeeoioeiadfa uanmp u0 rxoxo todlmt au sls)sruoim oo4llen iesltf ruau  ;t1alt  o3iydlm eln o (0texomf ta1opt lneo;( sexm(mpiu4am nlfvs t) Drm(  nt0oleomfciysls eanmsnu)trxnmociatlmt ln o;t)seurxo iydlm   iet (fsDra(m ;t0opx  ociysfmDuln o t4 rtnxr ia1lmDeau ils seuo(rpnu4ll nmicsl(  2trumpno1alxnmietlsfm2emu pnt4texoxf3iodlmDrlieo;t) rtm(o3iu1lm nlictls)sDurum ot1texoii3tysfsDrmuvs;(4teenxfctotlaDrlneo ()s2umio oudaptn fct t aDrr( ono4apt mociat a el( s;u)altomf3iadlpDelieo s)setmio iydlptn nes s)artaxrp;u0oet moctadls2ean o (4aeenifcoodla e nei s)srxr(o iodlme  icias  rrmurono1oet mfeiad aDulnmsnt4tlxoxo3iytomtr uei t)t2trio3oudlm nlfctl(  rtmxm ;u4tetnmiciadfsDuln p;u) lxnmo3oo1la rai s t0truoio3nydol   icias sDta( poo0aee moeilsfa emuvo;(4aeermo oa1oaDe nes t  2uoiopoydlpenmncils srrau p;u4tpx ifctasfaDumnms u)trxnxocta1fmt  uei;( t2urxopnu4altnlfetltf rum(m ;u0olxnio3iydfa ua( pnt)aexomf3tydfmtelnvo t0sexr(opiydopeemncsa( sDrr(mpot1oexo oeiytlmDua(von()altoxr3totom r u ilt srtm(r3nu4lmenmnesasf 2rm( onu1apxoiietld aDelu p;u) lxnmo ty1fm  luvi (  2ur(m oo4lme lnes t aDua(r oo1tetn i3iydfm2rmn o;u) lermr3ia1fmt li ilt t2tmxo3oy1om   nctas s2taum ;o4tpx  o3ildls2eauvo;u0tltnxociadop e nei t)setmxmpnu1ol e fvsltfa2umx p;o4oltnmieiad sDrmnvo u)altoifctytlmDrln i;s0 eurxopoydoltelieiasfa2tr(mo;u1tlt  iciys a ulu s;t4 etnxf3oo1oaD aneo t0s2umxr iy1apt  ivilt)aDurxmpou1tltn o3ilsls rluvp u4tltrmo3oytoaD  uvs;t) rtoxo3iy1om n fvs (fs2ua(rpnu0aptoioctlt a2ua(vo ()alxrmf3oa1latran i;()seuo(r io4lme  nesas) Dtmxrpoo0tee  o3tadls uanmo;u0 eerxrciytlpt lnesls  ruoio ny4am  mnesltfarraur ;u1tpto oetadlaDrmumsnu)tlxnmo3tydoa  an i;()s2tm(m iu1lle mivsa() ruru onu1tet moeildfm rmnms;u)arxrif ootfateaivs t0trxoimpoudale mfvt (  2taur ;t0opto ictysls el(vo;()aetnio3oytlmDr i o s)t2xoim3oudlpenlfcilt  2raur ;t0oltomoeiyslaDemump (0tleoirctatomtr i s (0 rxmxopiydap elfesas) Duax  nu4apt mociys a em( p ()texomrciydfpt aues;s0tetrio3oo1llenlicia( s2tauronu0tex mfeiysfmDemnvon(4arerio iydfmte u s;( texoxopnydame  fetasfa2rr(rpoo1oexo ociysla2em( ont) etomrcoa1fmD aueols)setmxr3iy1alee fesatf rrr(m ;u4tpenioetydlm2eluvp;(4altrif tatlmtrlues;() rtmxm iydop  mfvs s) rtmum nu0oet  f3tltfm2ranms u4 lxrmr oa1oa  ln o s  2to(o oy1openmiesatf rurxm oo1oetnioeilsfm2ul( pnt)tlxoxo3oadom   i i (  eto(rpiu1lle mnetlsfarta( pno0altniictat aDrmn s u4trtoirctatfpD auvils0 rurxopoudll  lfviat aDtr(r ;t0oetnioeiytls ea( p;u4areoio iydoa eanvsl(0s2xrxr oudllen nesasfsDtmxr no4tetoiiciydls um(mp;t0arermr3oo1opte nvsls  exmir oydamtnmfcta()aDtm(mo;t1apxn oeiytfmDel(vo t0texrmo oatoatraueo s0srum(rpno4amtnlfvilsfsDtaxmo;o4opt mi3iad sDul(mo u0arxrir iotopD an o;t0s2xr(r3oy4op emfctltf rrmxm nu1apxomictldfa2umumsnu4tltnmo3tatop eaieo ()srxmxm3iy4lmeelivs tf rtrxm ou0aetn o3iytfsDuanvs;u4 lerxrciatoat auvi s0seuo(opou4lptn ivs tf rta(  ;t4aex if3ias s2ulnmont4 eerio3io1fat au i;s)srum(opou4ll  lfei s s2rm(rpou4aexn ieiatlaDemums u0texnxr3ta1omtr uvs t0 rxoiopiy1omt lnvsl( s2ur(ro;o1aet mo3tysfsDrluvp () etrmfctatfpDranvi;( t2toir3nudlmte nvi ()aDtrumoou1tpto feiytfm rlnvo (0altnmr iydfaDe nvi s) exmirpno1ome lfvils)sDtr(mont0oltomf3iadfs2eau pnu4 ltoxr totlp  aivi;s  eurir oo4ol n fviasfaDuaum no1tetoiiciytlmDuan s;t) lxrxfciodfm   ueo s s2umxopnu4am e ncs tfsDtrxrpoo4apxn f3iatfaDulnmsn(0 eenxf3oytlm eanesls)s2toxo ou1al emfvias)s2ra(mp;o1apxn f3iasfsDeau s;u4tlxoifctatomD lueo ( t2xmimpnu4lptemivtatf rur(m nu4aptoiociytls2uanvsnu) eeomr oy1fa e u olt)setm(o3ny1altelfcta(fsruaum ou1teenmi3tltls ulnmo t)artrmr ia1fpt luei;(0sexm(r ou1ol nlfeil(fa2rmxm ou0oetomfetlslsDrmuvont0aeeomfcootoatean sls0teuoxopoodomen nct sf rurxro;t4ape mo3tytfmDrlums;t)altomr3oydoaD lu o;s0 rxmxopnodlm  lneta(f 2rr(rpnt0texomiciadfmDel(vs u0tlermf ootlm rlues;(0t2umxopou1aleemnet s)sDurxmpou4olt iociasfs2rmuvo () rxrxr3tadfmtelneolt)texmxr iodole  fctlt) 2rmx pnt1oexomi3tldls2umums t)arerif oatlm rlneo;s0t2trim no1aptnmfvi s a2rm(m oo1oee  feiltls ul(vo;t0altrxr3tadlmDrauvi;s  rxrim ny4omtnmnvsltfsDrrumpnu4openifeiadfmDua( s t4trxoxr oadlp rlivils srxo(m3nu4lpeelnctlt)sDrmurpno0oexoif3iydfs2rlump u0 etnmr3oytoaDe nvo s  2xo(o3nu4lmtn fctat  Durxmont1tetn ictad m2rl( p;u)alxnmo3iy1opteaieo;s) rtoxm3nu1om nlnvilsfs2ta(m ;u0oeen i3ild s rm( pnt0teermr iadlmD lnvo t0t2xmio3nu1amtnlnesls)a2raurono4tptn o3ildla2elnmsn(4trxrmf oadop  lnvo s0 rxrim3iodaleemnctasf rrmx  ;u4teto ieiasla2emnvp t)treoir totfate u s s) 2tr(o oodol  lnei s) ruau p;t0oet  f3iad mDumump (0aeeoxfcoatfp rliei;() rtmxm3iy1al emict s)srraxrp;t1tltoiicils sDem(ms t4altrmo3iydlmte ivs t0 rtoir3oodll  mivtls sDua(moou0tpx iocilsfmDranmp () exrifctytfmDraivil( seur(o nudoltnlivilsfs2rmum ot0aee  i3tlsla rm(vs;t4trxoxo to1om ranvslt0 exo(r3io4omen fet t)srururooo0aeeomi3ilsfaDum(vpn(0tlermrctodoa e ivs;t trxrxmpoydamtn fcilt sDtm(r no0olto octldlm ulnvo;(0aetrxr3io1lmDrai s;t t2toim3iodllt lnviat)arrau pnt0aee iieiltlsDumnmo ()aexoxo ty1fateli s;s0trxoirpoy1alt mivsls) rrau onu1olto feils s2emnmon(0aleomo3to1fp  lieo;( texo(r3iy4lltn neilt aDurxrpot0tpe ifctlt s2em( pn(0treoxoctadop  aivil(0texrxo3io1lltnmicsl(f 2taur nt1aleoif3ild s em( o;t0 eermf io1omtr nvo;s0srtrxopiu1amen icia(fsrraxrpnt1oleomi3iasla2um(vont)texnxfctadlaDeln o s0 etrxo oydllenlivsl( sDumxmont1aeeomietys s2umuvp;t)aetnircoa1la   nesls) rxoxo3iy4lmt lieils)s2ra(r ;t4teen o3tatfsDean snt4trtnxr3tadfp  au i s0 rxmiopoo4ole mfeslt  2trxmpno0ale mo3ilsla2rmuvp;u)teeomo3ta1lpDeai s s0 rxmxo3nu1ap  lfeilsfs2rr(ront4teeoifctyt sDul(mpn(4 exoxo iotlm elnei t0s2xoio3iydome lnvt t) 2tr( o;u0tex  i3ias s ranvo (4 reomfcoodfp elies;t0 etmxrpou1ap nmiei tfsrrr( pot4apxnii3ild m rlumo;(4teeoxf3oo1lmDrluvo;s)trtrxmpnodlle mfet t) rur( onu1apeomictydlm uauvsnt4 rerifciadfaDr i s t)s2xm(m ny4apt  fctat  rraxr oo0tex ii3iadlaDulnmp u)arxnif iodfmteauvilt)tetrim3oudlmt lics (f Draxroot4oeto i3iytlmDra(vo;t4 leomrctatoa r uesl( t2umxmpoudll emnci s) 2raumpoo1tleoif3iysla2um(mo;(4aleoio oydlmD auvol(0 exrxo3oudlpeemieta() 2um(rp;t0olen oeiadfa2uau snt)altrmr iatlmt liei t  etoxr iydolenlivil()a2umur nu4ape mfciat m ra(mont)trxnmr3oo1oateluvi;s0 2urxopny1oltemiei ( s2umuro;o4oeeo feildfm rmn s t)artrmocoy1omDr ivs ()t2tmxm3ou1openlncta(f 2rm(rpou1optnmfeiatls em(ms u4tltnmrctotlatr i s;s0 eum(opou1alee fciat) rtrurpou0alxoifctyd sDean sn() lerif iadopt an o s0texmxr3iudopee nctas) 2uaxroot1optomietatfa2rmump t0 rtoxrcoo1fpteaivs;t  exoxrpnu1lm emncilsfartax  ;o4tpxomieiyt m rl(mo;u4 lxrircoytoptr uvo;( sexo(r3oo4aptnlivsl() 2rau oot1altn oeildls rau o t4tleomo3io1fm   neils0trxoio3ny1op emics s) 2rax onu4tlx mocild s emnmpnt0aeeomr oa1oa eln s;t0srtmxo iudapenmieta(f rrr(roou0tpeomo3iatls rmuvo (0 leoxr3tadlateanvi ( truo(mpnudllen fciat)arta(r ot0ole  ociyt a ulumpnu4 lerxfctodomD  i i s0 rum(r3ou4ol nmictat artau  ot1oet iocilslsDua(vo;t4altrir3iydopDraivsl() rum(mpou1aptnlies ()sDumumpnt0olt ifctaslm2eanvp;t0teenxf oytlatean s t)sexr(o3io1ll  mfetltfsrra(rooo0aexo oeiyd s uln s t0alenxr tatopD  iei t)trtrio3io4olte iviatf 2uauront4aetoio3iyslaDum( o;t4 rtrxfciy1lpDeau o t0 2toirpnu1aleemnci sfsrtaxr ou1ope mfciad aDemuvp t0arerxo tydomDrlivi (0s2uoxm3nodol n fvilt  rrrx  ;o4apt  oeiltls2rau p () lxrxociy1oaD lnvi t trtm(o3no4opte fcsa( srrau o;t4oeen ieiltfs2ea(mon(0altnxociodfa r u s (0srtmirpno4lm   ivi s aDtau  ou4alx mi3iytlmDrluvpnu)trtrmr3iotfmD auvslt0t2uoxmpiy1ll  livsl()a2rax oou0tlx  ieiltfm ulumo (0tltoxocoatfa  aivsls srtoxmpnodope lfvtlsfa2ta(ronu4teeo fetlt mDuln o;() rtrxf tatfa  aivi;(0t2xrxr3iy1ope miesasfaDumum oo1texo ociydfaDumnvs;u0tetrio3ta1fp   u o;t s2tmxo3no4altnmfcs ()arua(mpno0olto feild aDuln sn(0 exnxr oydfa  anvilt) 2trim3oo1lp emnci sfsDtaxm ;t4altnmfeiadlmDrau s u0tetrxf io1opDe iesl()t2umimpiodlleemfvils  2umu pou0alxomfetldla2eauvs t0altoio iytoatrlu ilt)setmirpnu1am n iet s srra(mono1opto i3iytlmDra( s;(0aetnmo iatlpD  i o s t2urim ny4aptelnvs ( srur( p;t0alt mfeilsla ran o;(4 ltnxr3to1omteauvsl(0t2trim3ou1ole lnvsat aDrru pou4tleo fcildlm2emn pnt4altrmo3tadlpte ivs (  2umio3no1am n nesltfa2tauro;t4olenifctltlaDum(mp;t4 eeoxfctytom  an il( s2xo(opno4aptemiei t)srrru pnu4aleniiciyd s emuvonu0aetrxf3oadla  anvo t) 2uoir io1lme  ics (f Dumump;o0opeoif3tas aDumn p;u4aetoxf3tytfpDeaiei (0t2xoxmpoudap e iei t arrru ont4alt  o3tysfm2uaumo;(0 lxnifciatfpDe nvsl()trtrimpnu1ol e ict tf Dtrumpnu4opxoifeiltls2el(vp t0tetrmf oytlat an il(0 rtoxm3iu1lmt  fei (faDuru o;t0tlt  feias m2emnmp u4tltrxr3iodoaDe uei;()teur(m nu4ap e ivil()aDum(m ot0tltoioeiat a rmumsn(0tlenxr3iotop rau s (0 2tr(rpiodoltemicsas) 2tmx ono0tleomicildfm ranvsnu)trtomf3iydop e n il( tetmir3nydlpeemfcsas sDururpoo1oeeoiietyd a2rm(vs u4 exrxo tydfmtr uvi;( srtrio3iu4omenmncil(  rtaxm oo1apeniiciatlm umnvs;(4artomr3tatoa   neo;( trtoir3oy4al nlnei tfaDtaxrpno4opx  ociadfa2uluvs u)aetrir to1opDelivo (0teuoxo3iodapt lfcsltfsDum(root1tlenmf3tls sDumuvp (4teerxr3tytomD an i;t0srxmim3oo1olee nesas artrxmooo0apto o3ilslm eau p u4 leomf3tytlmDeln s t0 eurxmpno1am emivt tf rumump;o4tleoioctydfs2raumsn()trtnxo3tatopDelu s s0s2xo(r3ou1oltnlnvs t)s2umx p;o4optomf3iytfmDumuvp;(4 lxnircoy1op raivo;()t2urir ou4ap elnvtls a2uaum no4olxn octlsfm2ea( p;u) lxomo3tytfmte iei t0 2ur(o no4opteliesa( s2rr(rp;o4apxo f3tydlmDua(mont0trxriociy1la r n s;s) rxm(o iy1lp elfct s srrru pou1opeoioeiysfa2el(vs;t0 rermf3iotlmtelieolt seurxm oo4alt mfcslt sDrrxrono1opeoifctyd m2emuvp;t4 rxrxrctatfa rlues;s) rxmir ny4ap nmict (farraump;u4olenmi3iatls2rm( o;u)teermocoa1op raiei;s0 rxm(r3no4apte net ()aDrmxrp;u0aex iiciaslm rauvonu)artoxo oatlmte ues;s)setm(r3oo1ll e iciltf rtmur ;o0tleo ieiysls2rmn p;u0tltoifcoytfm  ai o s s2uo(r iudopeelfcta(fsrtr(m nu4olt mfeias s emnmo (0artomf tydlm rauvils)seuoim3ou1apee nvsa( a2ra( pnt0oexoioetld s2rmnmp t)aexnmociodomD  ieo ()trtr(m oy1llt  nvi t aDurxm nu0tlxniieias s rau snt0aexnxo3tatop   ivo;t)t2umir3iu4al  lfcsl( s2taumooo0aexomieiasfaDrmnvs u)tltnxr3oa1laD  n i;(  exrxr ou4al  lfvia() rurxrpno0aexomf3iatfs rmnms t)trxrmrctodoaDraues;s texmir3ou4apeemfctls)aDrax ooo1oeen ieiltfsDelnvsn()arxrxociotlatr uvi s0srumxrpiodamee nvi s) 2trxr ot0oeto oeils sDrmn onu)tlenmo3tadfaDrau i t) 2ur(r ny4oltnlfvslt aDtmum ;o1optomi3iydfa2elnms;u)aexnmo3tytlm   uvilt0 2ur(r3iydap  mfcia(  Dtaxr ;o0tleomieiasls2eauvp u)alxrxo3oy1omDeanvo;()s2xo(o oudaptelfcta()arraumo;o4alt mfciytfm2emu p;t4trenir3iy1lmDr i s;s0 etoim oodlpenlfviltfsDrrx onu0tlen i3ildfm2umnmp u0 exoxrctatoaDeaieo s s2xo(rpoy1ame lncsa(fsDraur no4oexo oetadfs rm(mp;(0tleoxr3oy1fpt an s ( s2uoio3oydal   nviat)sDrrxr ot4oleoiiciys s2eanvo;(0trtoio oy1fm ran ols0s2xrxo io1op   net tfs2rmumpno0tltomfctydfa uluvsnt) renxocta1omtelnvs;() eto(r oodoleeliet ( aDtau oot0oetnif3iatfa2em( o;(0 exrmo ootlat aivols)setoxr3ou1ole mnesat) Drmx  ;t1tpto fciltls ulnvp u0 leoxociy1lm   u s;t0srur(rpoo1lmteliet () rraxr ;u0tpeo i3tysla2rl(vpn()artomf tydlpt aivo t)t2um(rpiodamtn ieil() Drauroot1alxoii3tltfm umumo;t0aeeoxocto1fmDr u i;t) 2xm(opnu1amt  feslsfsDrrx pnt1tlt moetlsfm2el(mp t4altomfcoodlp elueil( srtmxm3iu1op  lfciat) 2um(r ;o4opxnioeilt m2rl( s (4arxnmocto1fp eaivi;s0t2uoxm3io4ope livia()a2uax pnt4aetn f3iysfs ulu sn()tltrir oodlpD aueils0srtmxm3oy4oleelfct ()a2tmuroou1altn ociyslsDumnmp (0 rtoif3oy1fmtelu i;s0 rxrxm3oy1opee nvi t)artaur ou4apx mictydlaDrauvo;t4 exrxr3to1faDeanvslt s2xoiopiy4omtnmfctlt aDtax o;u1texnmfetltlm2em(vo;u0alerif3oodlmDean i s trxo(r3io1ll elfvs (f rtrxrooo4oexoio3iat s2em( p (0trxnmf3oa1la   nvi (0 rum(r oy4alt lnciat)a2rrx  no0tpenmiciasfsDranvs t)tlerxr oodfptrauvol( s2uo(o io4lmee iet s) rumum nt0teeomi3tltfaDrmuvs t0aleoircoo1lptr n il(  2tm(r3iy4am  mivs s) rurur nt0olt moctad m elu o;(0tlxnmo iy1lmteauvol(0 2tmxr3oydlle mfesa()sDrm( pou1oee mf3iydfa2el( snt)areoxfciydfm  liei (0s2xrxmpoo4lpenlncs t aDrmxrp;u4alxnmf3tytla2uln p;u) lermo3oytfaD  n o;( t2xoxr ny4al e nei s aDum(ro;t0olt  o3taslsDelu o u4aexnxocoadlpt  nei;t) ruoxo oo1lmeelnviltfartm(rpoo0tltnmicildfm2rl(msn() ltnmf3oy1omDr ivs s)teuoxm iu4ap   iesa( aDrrumo;u1teen i3ilslm2rl(mo t4areoxr3ta1fm rln ils  2umxr3no1lptn ivta()sDuaxmooo4teen f3iadls2ea( s () ltomo iatla   n s;(  etmxmpou4lp emivi sfaDtr( pnt1oexnioctaslm2ulump;u0 exrxf3tydoat an i (0t2xoir3io4apenlfct ( a2ta(ronu4apt ii3tys s um(mo;u) ltrmo3oa1om eluesl() 2tmxrpny4optemfvs tfsDtm( p;t0tpxn ociyd m uau o u4aexrxr3oydfa rauvslt)trtmimpou1lpe  icils arrmxmonu1alxoio3iat a uan s;(0tltnmf3oo1latr i i;()trxoxo3iodap nmnci ( aDraur ot1oltn i3tldfmDeluvs (0aexoxo3iytoa rau s ()sexo(opnodol   ieils  Dur(r no4oltnmoctat sDulumpn(0 exoif to1faDr n s;()s2toxr3ou4amt mietas  rtrxmp;o4ole ifctydfa2ulnvp u4 ltnxrcta1omte n ilt s2umim3iy1omtemnvsas  rrm(ro;u4oeenifctadfs2ra(mo;u0arenmr3tadlpD  ieo;s) 2toxmpio1om emnci (fa2umum ;o4tltoiiciltfsDum(mont0arxrif io1om ran s () rtm(r nodoltelivslsfsDtrxm ;t1tlt mieilsla elumo;u4tetrxr3iytlmDeli sl(  rxrxr oodll  lnesl()sDua(rpnt0opxo fciyt s2um( o;(0treoxo tydfpD  i o s0s2xoxopoydal emfeil(fs2uax ont1tlt  i3iasla2rauvp u)alenmo3oytfaDeaueo;()srtr(o3iu4ol nlivtls s2rr(mp;o0opxoifetltfm2ea(vp ()aetnir oatla rlueils)t2umir iu4lm elfvsatf Duauronu1oeeo fcias a2umnmp;t4aexnxociy1faDrlivol( t2xrio iodoltnmivsl( srtrxr ot4tex  feiytls rlu p t4aetriociatfateln o;s0s2um(o3nu4omen ici tfs2ur(  nu0oetniicilt a rmnmont0tlxnxr3tatopD luvi;() 2ur(m3io1lmt  fesas) Dtrxrpot1opxnioeias s2ea(vp u4altrxfciotomDean olt) eur(m3io4ap emnvi ( aDum(m ou4aexnif3tasfsDum( snt0aeeoxf iodomD auvsl(0truo(o3iu4apee iei ( a2ua(  no4olto feiysls umumpn(4trxrmrciytom  aueslt0 euriopoodome lfvsls s2rauro;o4aetn ieiat s ul(mon() lxrmrcoatom  an s;s teum(r nudopt  fetat)a2tmxm nt0aex mociyd m uln onu4alenxo oadfp r ieo t0s2um(o3io4lmeelfct s)arumump;u4tle if3iatls rl( pnu)trxriocoytop eaueolt s2umxo nudllen ieia() 2ur(mpno4oet  oeiys m2umuvont4altrmrctydfpt ai i;(0seumxmpny1amt liei t)s2raum ot1tle iicilsls ulnvs;(0treriociytlptelueil(0srtrxo oodomt lnvsa(f Drmxrpoo1tpx ifciydlsDeauvp u0artnmocio1oa elivo ( s2toxm io4lltnmnvil(faDumu pot4tetn oeildlmDuanvsnu0 ltrxf3io1fatelivi () rur(opoodam  mfcsa(  Drmu o;u4tpenifciltlsDrmnvp;u4aleomo3ia1fm e i s s)t2xo(opoy4apeelfcsls  Dtaurp;o0tle  feiydls elnvp u4 etoir oo1latelnei (0 2urxopnudomtnmnvsa( srtrxro;u4alxo fctytlmDuaumpn() etrifctatfaDelnes s t2um(m ny4op emfcsl(  2rmxm no0aetnmoctyt aDuluvsnu0 leriocoy1fmt ln ilt  rtmim iy4ol elfcsa(  rtr( pnt4ole  oeiydlm2ran s t4tlxnif3oy1fa  aivolt) eumim oo4am   ivils) rtr(mo;u4aexoiietad a2ulnmpnt)tetnif3iy1lp elivo t) eto(r oodlme lics t sDurx  nu4openmfctatls em( pn(0 eermo3iadfaDrluvs () rurxmpnu4lptnliet (  2umxmo;o1altnmf3iaslmDulums;t) etnxo3iotlp   u o;( trxr(o oo1lmtnlnvt s) 2ra(moot4oleo o3ilslm2rauvpnt)aexomfctodfateliei s0trxmxrpoodalenlfciltfsrua(  ;u1opxnifeiatfmDea( o;(4alenmf3to1fpDeauvs ( srtr(o ou4lpe lics t) rtmurpnu1tlen ieiyslm2rlnmp;u0arermo3ia1opDrauvi;t)truo(opny1ol nmfvil( sDtau p;o0texomocildfm umnvont4 rxomo3totop rlu o t0s2xm(m3nu1lltnlfcil(fartmuro;t0tlx mfetlsfaDuauvsnu0 rerxf io1fpDeln o;() exmxrpoy4lme  ivtat)s2rr(r ot1tlenmieiysla2ul(mo;(0teerxf3oydlmDr n i s texoxmpnudlp e nesa()aruru ont0opxomoeiysfa2um( pnu0aeenxf3iadfpte n ilt) exriopou4om   fvs s) rta( pnt1oltn feiadlsDumu o t4trxnio totlate iesls srxmxopno4omtnlnvsas  rumxm nu0apxomiciad s2ra( o;u4trenif iadla  an il(0t2urxrpoy4lptemnesa(faDtru  no1oetoifeias a2ulnvs;t4tetrifcio1lmDrlueslt  eto(r no4ol   ncsa(  Drm(mp;u1oet iocils mDum(vs;u4aexnif3iotlaDraueo;t t2xrxr3ou4llee fcsatf rtrxr ou1aetoiiciyt aDul(msnu4teeoircto1la e nei;t)trtrir ny4lptn ict (  Dua(monu1tpt mictltfm2el(vs (0 eeomoctotoa eauvs t tetrxopio1om emncils)s2tmu pnt1tee  ictld sDea(ms;t) leoxf3tatlmD ln o;(0 euo(mpiu1alen ncsa( sDtr(r nu4olx iociyt aDrmuvsnu) lxomr3oodfmtr iesls)srxo(rpnodlle micilsfs2ta(  nu1oetomfeiyd a2emump;t4arermf3ootfpt  u il(0 rtmim3io1ame lncslt sDtrum ;t0apxn iciyd mDrlnvo;u4altoir3tydla rlivo ()sexoxo oo1lpeelnes sfsDurur ot4tle  o3ildlsDemumsnu4alenmf3iytlmD  uvilt  ruoxm3ou4alt mnes tfartau ono4ale  f3ildfmDra( s t4 rermo iytfpD aivs;s0srxm(r3nudal emivtl()srrru pou0apeniietatfs uluvp;t4teeoir tytfa r nvs t) 2trir3iu1op   ietl( srumumpot0apx moeiydls2rluvon(0aetnmo oa1lp eauvslt) exmim3oy4om nmfetlt)a2ra(rono4texoio3iat mDeluvpn(4 rerio ootla ean o;s) euoimpoodlltnlnes s aDtm(mo;t0opx  f3iydfmDemu sn() rtomr ootoaDeaueo s  euoxopiy4apeelfcsas) rumump;o0tex  fciasfaDeanvsn(0arxrir oo1fa   n i s) 2xo(m3oy4lle  ivslt)s2uaumpnu1olx  icilsfa umn pnt4alxrifcoatlate nvi;t0s2xoirpny4lleelfeilsf 2tr(rono4apxoiiciad a ua( o u)tleoio oa1faDelnvslt  rtrimpio4ole  ivsa(  rurx o;u0oeenmiciyd a2emnmp (4aetomf3todop rli o;()sexmxrpny4llt  nvs (fsDrm( pot4olt ii3iysfaDuau pnu0 rtomf3oy1fa  livo t0 2xmxm ny1apt  nes t)arrrur oo1tptnmi3ilt a2umumo;(0 eenxf3oy1lm  au o t)seumxopou1omtnmfes sfaruaxmo;u1aexoifctldlm em(vo t4trtrif3ta1fptrliesl()srxmxmpio1op nlncsls  Dua(rpnu0ope mocils m uanvo;t4 lxomoctatopDrluvol(  2xr(o3ou1lmtn fvtat)sDrm(rpot1openmociysfs um(ms;()tltoircoodfp raueo ()tetmxopoy1lpt mfvilt)s2rmxr ot1tlen ictydls2eanmsnt)teenxr3totoate i o;(0trtm(o iy4op e fcs t  2rr(mont4oexomfciadlmDeau s t0alxoxo3io1fmD  uei;( srxmiopnydlpee neslt  rumx pnt0oex ifciyt s emnvo;t)teenxfctotfa eanvi;t) rxoim3no1lp nmnes t aDraxr nt4oltnifciatfm2um(vp;(4trermo oytlaDeauei s s2xo(r3oo1lmt mivias srrmx o;t4alxnmo3ildfsDrlnvs;u0artrir3tadopDean o;t0t2xrxopoydome  fcia()s2uax  no4aetniietld sDul(mp t)trxrxo3iatoa elues;t sexrimpou1lpe lfes tfsDtaxmp;u4olen oeilsfsDua( p;u4 leoif iatfpDraiei;(0 2tmimpno1lpte fct (faDurx  ot0apxo fetadfa rl(vo;t4aeeomfctotfmtr neo (0 etrxr3no1ap   ncs t) Dtrx o;o1tlx mo3iyt a em(vont0 rxrxf oo1fa e ies;(0 rxr(m ny4olen fvia()artaum oo1oexnmieiltlm2rmnmon(4 rtoxrcootom rlnes s)s2umxrpiy4opt liei ()srum(mo;o1aptn i3iad mDrln snt)altnioctotomt lies (0 2xo(m nydap   fetlsf rururono0tpx  oeiaslaDem(vont0alxoir ia1opDr u s;()srur(o3iudaltnlfcsls) Dtruroot1aexoifetadlmDem( ont)aexrxf3ty1laD li i;t  rtoxmpiodlmenmneiatfarra(r ou1oeenifciysfm2emnms;u) lxnmociytfpD  iei;()t2xo(m iudalee fcs tfs2rau pot0opx mieiadfaDel(vpn() rtoif oo1faD lu o;() 2umxo oo4lmt  ieil( a2rmu ono4oee mo3iaslsDra( pnu) etrmrcoy1lmtrai s;s0sruoxr no1lptnmieiatfa2taxmooo4openmfciltfs2ean p;(0tltoifcoadlp rlieo;s)setr(rpno1op e ictas)aDur(r ;u0opeo icias mDrl( o;(4tlenmrcty1lmDelneols0sexmiopnu1ope mfcs tf 2rm(roou4oexomo3tad m umu snu)aexomo3ta1faDr n o t  2uoxo3iy1al nlncil(f Dtrxrpoo0tpxnioctatlm ea(vo ()tetomf3ty1lmDr ues s0trtmxm3io1ll nlivtat)aruauront0ape iieilsla eauvo u4aeermf tatfptrlu ils tetrirpiu4oltn fcs t)a2ta(mpno1aetniicildfaDuan s t0texoxrctydfa eaies;s)s2xmio3iy4alt licias) rrm(r ;u1tpe miciyd m emumo t0 rermrciydfm e u s;t) rumxr ou4ame lfcsa(f Dtm( o;u1tpeoioetytlmDuln p;(4 lenif tydoaDelivs (0srur(opnodole mietltf Dumxm ;o0oltoiociad a rau o;(4 eerxrcty1lmt  uvol(0srtmxm oudlptn nctls s2ra(r nt1opxnmfeiat m emuvp;(4 exnioctotlpDrai ils  exm(rpiodlm nmnci () rrm( oot1opx mfeiasls2uluvo t4tlxnmrcoydla r nvsl()t2uo(o oo4am nlfetat)sDrrumpnu1tet  ociytlm uan s;t0 ltoxociotom elnvsls) eumim3iodamen nes t aDraxr ;u0apx  f3ildla2rluvpnt0tetrif totlmDe uesls0sexo(o3iu1amee iesas)s2umump;o0aexn iciasfa rauvont4tleoxf3tatoa rlues;() eurimpnodlle micsatfsDuaum ;u4aeenmoctytfaDulnmsnu0 exrircto1fmtraivil( s2to(mpiodoltn fes (f Dur(mpnt1ope  ietltfm2eauvp (0aexoxrcootfatrlnvi;s)trtoir3iydamt  nctls a2raumpnt0oexn fcilsla rlnmonu0trxnio3oytoaDr nvi t0trtm(r iudlptemfvsl(fsDurx o;t1opx  f3iltls2uanvp;t) ltoxo oodomtrluvo;()sexo(r3iu1altn fvslt aDrrxront1oetnio3tad s emnmonu)arxrmoctydlaDeluei (0t2um(o3oodapt mnctl(  2umx o;t0texniietysla2ranmp;u4artoifcoytom r nei (  eur(m iy4lltelnciatfa2tm(  ot0alx moeilsfaDrm( o;(0 eerir3io1fmDeluvi ( t2tr(m3iy1llt lneias srurx oot0olxn oetysfsDum(ms;t0 leoir tatom rlivolt  rxrxm3no4op  mnctltfa2rr(ro;u4oexnmo3iyslm2uluvpnu)altrio3oodlatraivslt  rxoxo iu4am  lnctlt)srraxm ;o4tltomoetyt mDrlnvs;t4 rtrxrcto1lp  lnes ()seur(m oodll   fet ( a2rmu  ot1tlx  o3iytlm2eluvp;(4texoxfctatlpDe i s () etrxrpnu1altnlfetl()aDtaxrooo0aexo i3ildfs2rau s u4aexriocoodfmDraueo ( tetm(o oudom n ivsl()sDrmum nt4apxnmfciyd mDumums;()texnxo3oatlmt  u il(0s2trxmpou1optemfetas)s2raurp;t0altnif3ild a2ulnms (4aetrir3oodfatrlivs (0s2xr(m3ou4altnmncs s)sruauro;t0aee  i3iytfs2ul(msn(4 eenmf3oodlmDraieo t0teto(r ny4alenmivi t  Duaumo;o4tlt mfciyslmDranvo;u4 rtrxf3oy1lp r nes;(  eumxr3oodal   ivtlt) rtru  ot1opx ifctlslm rm( ont)aeeomocia1fa elieils  rxrxm nu4olte nvi s a2rr(rono0olen iciyslm2rauvpn(4trtnir3oatfatrlnei;t0sexr(m3ny4apee neiat  2trxmp;t0alenio3tatla2ulnms;u4tltnmo3oy1oa eaneols srtm(o nydolenlivt (f Dtmxront1tleomietat s2eanmpnt0 lxrxr ty1oa rli i;t  2uoxo3nudlmtnlnetlt  Duru  nu4oexn i3tatlaDean o;t4alermoctodlmt li i;s0s2to(m3ou1omeemfcsls) rrm(mo;u1oexnmfeiadls2um( snt4 ltnio3iotopt livs t t2xmimpnu1omee nesl(  rur(m nt0ope  ictadfs umn ont) lerxf3iy1oatrlivo;t0seumxm iu1alt livi s srrmur ;u1olt moeiatlmDranmon(4trtnmf iotoa  anvils)t2tr(rpio1amtelfci ( arrm(  nt1oeenmociltlsDeau s;() exrircootfpDeaiei;s)texm(o oodapee ivs t)aruaxront4tex io3iyslaDua(vs () lenxoctotomDelivi t0 2tm(o3iodamte iesat arra(  ;u4oex mi3iyslm elump;() rxrmo io1lmDeai sls srurxm3io1aleemivsatfaDtrumpnu1alx moctldlaDum( s;t) rtrmf3ootoa  aieslt)s2trxr3oo1lptn fet ()srrm( ooo4apt mf3iasfa rlu onu4alenmo todfmtelu s;()t2uoxmpoo4al nlnes t) Drmu pot1tpe mictyt s2emu o u4 etnxr3oo1la eai o;s) rtmio ou4ol nmnvs (  2rr( pou1opeomfciasfm uanvsnu4teerxfcia1omDeau o;t  rtrxr3iudlp  mnvtat)s2rr( ono4oltnifeiasfaDrlnvo;u) leoir3tatfpDe u sl(  exm(o3oo1lptnlietatfsDtm( pot4tltnmf3iadfsDrauvs;t4 exrmocoadoateaivo;(  rtrim3iudolt lnvslt)aDta(mpnt4tltomf3iltlmDemu s;u) lxniocio1lmtelivo s teuoir3io4lmtnlfcia(fa2taxrpnt4tlx mi3ildfsDemn s;u)tlenmocoydlaDrluvo t0srtr(rpoudol   nes s s2rrum ;t4apenioeildfaDranvo;u4 rxnxr3tydlptelnvs;t setr(opoy4om elnct tf rumumpoo0optn ieiatla eau snu4 rxrmr3iytoaDe uvo s0t2tr(o oydol nlfct ( arta(m ot4tlen f3iatfm rm(ms;() rtoifcoadlaDrlivi;t) rtrimpnudlme mfvil(f Dtrxmpot1texoif3tyslaDrlnms u)aetrmf3oodom   i i;t sruoiopnudoltemfctlsfaDrmx oot1tpenmo3iasls eln s u4trtnmo3oy1fmtrliei;(  rxr(r3oy4lm nmnvi ()sDta(mpno1ole mietad m emn s;t4teenmr3oo1fpt ai s (0teurxr3oy1alt mfes (f rrmu p;u0tlenmfciltfa2rm(vp ()teenir oatom r n ols)t2um(o nu4al   ivil()srumum ot0tpxnmf3iytfm2umnvp u4aeenmo ootoptelu olt truo(m ny1lme mfvta( aDtauro;o1oetnio3ilt a2rlnvp u4tltnxo iodfaDr u ol()tetmxm3iodamt lfcsls  2ra(mpnt4optniietys s2raums;u4tltnxr tydop  ai s () 2urir3oudomt  ici tf 2umxrono4oeeomiciydfa rm(vp;u0tlerirciotlpDranvo;s) etoir3ny4lle mnvias)aDraurpnt1optnmiciatlaDel(von(0trenxo3oytfaDelies;( trto(o oo1oleelfciat arrr(rpnt0ale iociatla2ea(ms;t4alerxf iadfpt livsls)texrirpoy4apt  net tfs2ua(rpno4aetn ieildlsDrmuvo;(4trxrmfcto1lp e neo t srtrir3iy4lp nmnes s) Dtm( pou0olt  i3tys m elnms;t4 eeoir oydfpDeaueo s0 eum(mpny1olt mivsls)sDtru pot4oeto ieildla rl(mpnt0tltrmr3oy1oaDr ivs;t)setm(mpiy1opte ictat a2taxm ;o0olto ietatla elnvs u)aetoxo ia1latr neils t2tmxr ny1llte ncsas a2taum ;u1tpxnmfeiaslm2ea(monu4 eeoir3to1oa eluvo;()setoxr3iy1ape mnctasfaDumxm ot0apxnmi3iytfm2ulu s;u4altomr iatfaDr uvo;()s2urio nu1lm   fcsa( sDraxr ou0aee  fciad a eaumo;u4 eeoxfctytlm raneo (0 2tr(opio4lmt  ncil(fsrrrx ont4tlt iiciasla2ea(vont)trenif3iadfp rlneslt0texr(opio4lm  lfesa( aDum( p;u4tpx if3iytla2rlumont) rtrmfcoadlp rli s t sexm(m3nu1aptnlfctltfsDum(rpnu1texo ocildlm2ra(vo u0 etriociytopteau s s s2umio3iydlp nmies sf rtr(rp;u4alx mi3iyt aDemn snt0tlxnxr3oatlpte u s s trxoxmpoo1omtelfei (faDta(mo;o0alx ii3iyslaDua( o;()tlxoxr3iatfmD  nvo s  eumio3nu4amenmfcil(fs2urx p;u0aeeo f3tytls2ra(mo u0treoio3ootla rai o;(  2trio iu1om nmncsa( s2ur(m oo0alt ifeiytfm2rm( p (0 renxfcty1lmDeaivils0t2toim3ou4lm   fvtlsfaDtaur oo0ole  ociysfaDelnvsn(4 eeniocta1lmtelnes ()trumxo nydapenmnvia(fsDrr(  oo4tetn fciad s eau p;t4aexnxo3ia1fm elivi;s) eto(m nu4olt mivs (f Dumx o;t0aex mieiydlsDul(vp;(4 renxrcoodlptelnei;s sexo(r3oydopee fetl( a2ra(mo;u1oleo o3tasfaDra(vpnt0 leomr ta1lpt ln s t0 rurir io1olt  fesltfaDum(  ;o0oleo oeiad s rmuvo u)aeeomr oytopDrau ols0s2xmxo iy1optnlies s a2urx p;u1tpxn f3tls s2rauvo;t0trtnir3iatopDrlnvo;( t2uo(o3oudlptemiet s)s2tr(  no4apxo oeiat aDumn p;u0tleoifcoa1op rlnvo s srxm(mpiu4ll  mictl() Duru p;u1oetomf3iydlm uan pnt) ltoirciodfmDe uvs t0 etm(o no1ol   ieilsf Draxm ;o0oee  i3iysfa2ean p;(0texomr oatlmDr ivo (  2umio iu1lpenlicilsfsrrm(monu1altnif3iltfs2ulnmpnt)arenxf oodoaD ln o () etoxmpiodom e ies ( aDrrx  ou0apt ioeilsfm2ranmo t)trtrmo iatfmDeanvi t0trtm(o no4ole  nvsat a2rrxm nu1tpxnmocils m2elnvs (0 exoxf3iydlmte n s;s)s2xmim oudome  netatfsDta(mpnu4aeto f3ildfaDulu snu)aexnmocto1opDeluesl() rxrir ou1omtn ivta( srtaumoou0teenmo3ilsfa eanmp;(4teeoiocoatlpt  nvil() rurxm3ou1ll   nvslt s2uru  no1oetomieild a eauvo u)trtrxo iadlmD  ueolt  rxm(opnodam n fesl() Durur no4tlt iiciadfa ea(vsnt0trxomr3tadopDr u o ()seuo(o oy1ll  mietatfaDrmump;t1ape io3iyd m2ulnvp;t4 etrmr3iotla  lieo;t0sexoxmpny1ol  mncil(  Drauro;t0tex  fetlslsDrm(monu)aexnmfcto1fmt  nvols srtr(o3oudllenlfvi (f Dua( p;o0oeeniietltfm2rmnmpnt)treomr ty1omDelieo t)t2uriopiudlp nmfvtatfaDtaxm oo4tlenmfcils m emnms u4trerirctydlp  ai s;s)teto(mpio1omt livsls a2rmx poo0oexnio3ilsls uanms (0alxrmrcoadla ranvo s s2toxr nu4op emfvtat) rrmxront1aptn icilt sDemuvs;(0tltnmfcoatlaDelieo;( setoiopiy1alen fvsa( a2trxmpou0apxnmoctytlm2ra(mon(0 rermo3tytfm e n i;s0s2um(rpnu1oltn fcilsf Dtau  ;u1tltn oeiyt s2el( s t0aeerirctytfa  lu i ( setm(o3ou4lm  mfcil( s2raxrp;t0aeeo feiytfm2eau o t)tlermfctatlpt lnvo s  exoxr nu4opeelfvsas arum(r ;t0tlt  oetatlm2uauvsnt4 lenir3oydomt  i o (  2trxrpny1om e feslt)aDuru  oo0aeeoifetyt s rm(mp t4aetnxf iadom rluvilt)t2xoxo iudomt mneil(fsDur(  ;u1oltn f3tysls rl(mpnu0altrif3iodfaD  nei;s)s2tmio3iudomenlneta() Dtau p;u1tpe mo3tydlmDra( ont)altoxoctadfmtranes;t) 2uo(r3oudomeemfcs s) rtrurpnt0olt io3tas s2rmnmo u4aexrxr3oydlmtrli i ( teto(m3no1ll  micilt)srumxmont4apen ieiasfm um( p ()tetomo iydlatranes t)texr(rpiydoptnlnvilt arrmumpou4apx ioeiysfa uaumo () lxomfcoydlaDelnes ()seuo(o3oy1am elnetlt)a2ur(mp;u4aexnmoctys m2ean onu)tlxoio3ootlpDelnvo;()s2xrxo3ou4lpe lnesa()artrxm ot0apeomietlsfmDra(vs u) etrio3oodlpteaivo;t s2xmxm3oy1open ivia(f 2ua(rpno1aptniietldlsDel(ms;t4teenio oodlp  aiesls0 exo(m iydalt  iesatfs2umum ;t1texo icilslsDuanvp u4tltnif iadom  luesl() euoirpno4lp e nvt s s2trxm ot0tetnmfetyslm el(vpnu0 etoiociotlptr ivo;s teuoirpno1apte nctatf 2rruro;u1tee  f3iadfm2um(vs t0tleoxociadfm   i ilt0 rtrxo3io4aptelneslsfsDuaum nu1aexoiociysfs emn snt)texnio3iytlateanei;s0 rtoxmpiydlltnmnesl()sDum(ro;t4tpen o3iytls2emu sn(4alxrio3iydoa eauvs s t2xoio oo1ll  lics ( srta( pnu1open f3iadfm rmnmpnu)trenxr iy1opDr nvil(0 exm(o3iudlm nmnctl()a2trx p;o1altn o3ildls2el(mpnu)aetrmrctodopD  u s ( srtm(r3oodlp n ietatfs2ur( ooo4apxniiciltla2eanmonu) reoxo3iatop  lnes;t  ruo(m3ou4lp n ieils arta(rpot4teeoifetlsfsDrl( pnu)areomocia1om rli ils  etoxr3io4am nmfvi () Drau o;u4opx mfeiyd s2umn ont)texnifctydfaDeanes;(0trumim oydam elnvil()sDrmu o;o0alenifeiad m rlnvsn(0aetnmfcoytomDe nesl() 2tmxm3io4am  lnvsltfartau pot4oex moeiaslm2el(vsnt0 rxnmocoy1lm   nvi;t)truoio3nu4lltnlietatf rra(mp;o1aptnmfctadlm2um(vs;t)tlxrmr3oy1faDeaiei (0 etm(r3io1optemieias) rumurp;u1oeto f3ias m emn p t0aexrxrciadlm  lu o;s  eumim ou1opt lncsa( sDrau pno1ope  oeiatfm2rm(vo;t4tlermo iodoa rlueolt  2ur(r oodlpeemfvi t s2trx  no0ope mf3iatfs2ra(msn(0trxoif oadoa  anvo s0tetrxopoy1openlnctatfaDtaxr ou4olx ifctasfa uln s;u0tlxoirctadoaDe ueo;t tetoir nudomt  fetl( a2trxrpnt0tpxoiieiysls el( p;u0artrir ootlm rai ols) rxmxr3iydoltemiesl(  Drruroot0aeenii3tat sDraums u)trxrmf iotoa   ivi;t s2to(o nydlltelfesls) 2rrxmpno4tpxnmictltfm2ulnmont0teermocoadopteaueo;(0t2xr(opiudlltnmieiat  rrmumpot4tlxomfeildfa2elnmsnt4tltnmfciodfpDraueo s  2toim3no4ll e nvtlt)aDraumo;t4altoiicildfa ul(vpnu0 etrir oa1om   ivs;t)sexmim3oy4lptn nei sfsDrm(rpou0oetnif3tls aDuln pnt4 exnif3iodom eaivilt teumxr oy4am emiesa( srtaum ;t0aetoiietydfsDrlnvpn() exnxoctydfateau s;()texrxopou4al n iviatfartaurpnu0aeeo f3iyt s2el(ms (4arxnmo tydom   ueo;s t2tmim oo4lm n nvia(f rumxr oo4oleomiciat a umnms ()tltoiocoo1lp rauvs;()teurxrpiu4opeelnei t)s2taxront0tex ifciysla2uauvo;u4 rxoxf tadfp  anvo;t)teuo(m3iudal nlfeslt)sDtmumpnt1altniociadlmDel(mo;(0tlxnif io1fm rlies;(0trxoiopio1op   fvi s arraxmp;t4opt mi3tydlaDem(vp (0aetnxo iy1opD ai sl(0 exrxr nudomtnlfcslsfs2taumont1tpenmfciat mDua(ms;(0 etrxfcoo1fat lieolt) eumio3iu1optemncilt a2urx pot1oetoii3tys m2ul(ms u4 rerxr iytomD  uvi ( s2xrxr iudomte nvi t  rra(rpou1tlt mociadfaDrl(vo t4aexnmr3iodfa r ivolt) rxmimpnydll n icias) Dumu  ot0oexomfctas mDemnvp;t0trxrxf3tatfm r n i;s0 exrxr nodopeelivtas)a2ra(root0apxnifeiat mDrmuvpn(0alerxociotop   n ils) eur(opiu1lmt lfcta()srrr(  ;u1alt io3tls s rmu snt)aetoxr3ty1oa e n i t0 eur(mpny1llee ieslt srta(m nt4oeeomf3iys a rmn p;u)teerxfciytomte i ols) 2xrio3iy4lpeelnes tf 2ra(  oo1aee mocildfm ulu pn(0 rtrxf3oadoptrlu s t)s2xmxo3ou1lpe mfcsat)a2umx  ou0opxoioeiydlsDrm(mp;u0aeerxr3tatfmtrlnvslt) eto(m nydomtelfct sfsrrmxrpnt1oetomoctyd a rlnvo;t0trerxr iy1lmtrai ilt) rtr(rpnudom   fvt t) rrmxm ot4opxomicias s umumpn(4texrifcty1lmtr uei t0 eurim oydlp  mivtl( s2tmumono0apeomoetldfs ul( s;u4arxnmoctodfaDean s t0s2tmxr io1lme  feiat)arrrxrpot1texnmfcildfs2rlnmp t4altoxfctytlm elnes;t0 2xo(r3iu4amtnmncta()srtr(rpnu0oltoii3iadfsDeanmp u0alxnif oadlpD lieo;s0srxm(m3ny1ll  mnctl(  Drrxro;u0tpxn feiysfm2uauvonu4arenxocoydoat  uei;s)trxrim oo4lmtn fci s)aDrmxr ot1altn oeiytfa uluvpnt4tlxnir3iadlaDeauvs t0tetmxmpny4lmtelfei (fs2tmu  ;o4oetnmfciyt sDel( ont4aexnxr ta1la r u sl(  2uoxrpiydlmeemfvilt) 2ra(  ;t1tptoif3ilsfm2rmnvp;t0 rtnxf3ta1lm r u o s)trtmxr3io4lle miciatfarrau o;t1aptn oetadlm2umumpnu)alxnxo iy1fptraneolt)sruoio nodlm   nesl(fsrrm(m oo4tptn feiysls2rmnvpn(0alerxfctadoptr n s ( s2xr(rpoo4omenlfct (fs2rr(ronu0apxnio3iyt aDem( p;t0 exrxo3iatfm r i s ()sruo(mpou1lltnlfcs s artmur nu0olto fciys a2rmnmsnu0teerxr totlptraivo t srur(mpou1lm e neiasfarum(r no1tet  ictldla um(msnt)aexrio3ootop eau s ()sexo(mpoy1lp nmfei (  Drmurpnt4oet io3iasfa2raumo;u0trxrmocoodlmt aivo s)srtoxr iudolee nvt s)aDurxr nt4tlxo feiydla rmnmo;(4 exoxocio1fateliesl(0 2urir3nu4altnmies ()s2ta(  ;o4ape ifeiysla rlnmp;t)aexrmf3ootomtr ivols setoir ny1lpenmfci tfs2umx p;u0aee io3iadfsDrm(vsnu0 ltrmf3todfptrliei;t) rumxo3nodom elnvsl()srrmx  nt1oetomfctldlm2ua(ms;(0areoir oatop r neo t0s2xmio3iu1ope  ics t)aDrruroot4opxomietatlsDrln o;()tlenif iydoaDe ivs;t0t2tmxo no4openmncs (f rtmx ont4alt ii3tlsfa rmu pn(4aeerxf3iotlm  an s;s trumxr iydoptnlnesl()aDtr(mp;u1olxniicils m elumsnt4tltoxfcoatoatrluvi;t) 2umir3iu1ll e ivi t  2uaumpoo1aptnmo3iysla2umuvonu0 ltnir3iodlatr ues (0sruoxr iu4alt  fcsls)aDrm(mo;o1olx if3iad sDrlump (0trtrmfcoa1om   ies;(0t2urxr3oydlme lies t  Dra(ro;t4olxnmfeiadfaDeau ont)aetnmo iydoaDeluei s  euriopiydame  ieia()s2tm(r ;t0tltnmfetadla2rlnmp;(4aetomr3ia1faDelnvs t trxoxrpoo1omenmfcia( s2rrxroou0ape mo3iatfs2um(mp;u4texrif iydfmteln sl(0tetoiopnu4apeelnvt ( s2rmxr ;t0oexomfetydfa2rlnvs t) lerxf oadfp  aivo s  2xmim3nudapeeliet s) ruaur ;t0alxnifeiadfaDel( s;u4trenmf3oa1la  auvs;s t2tmxm3oydame lnctatfs2uaxroot1opxnmociadfs2emnmo;u4aleoiociodlat lu s;s)s2xo(r iy4al e ieil()artru o;u4aee iieiltfm2rau sn(4arenxf3oa1la e ieo t0t2xrxo3iy4om emivil(  2rrxr ;u1opx io3iad a emu p u0 rxrio iydomDrlu slt texrim oo4om  mnvs sfs2umxrpoo4altniociadlaDuau p u0 eenif iy1fp raueils)trxmir3iudam  mfei sfsDtauroou4olxniociaslm2rl(vo;() exrmf3tytlmteau s t0 rxr(o3iudamen ivsl(  Dum(root1oltoif3tldfmDeanmpnt4tlxnxo oytoaDe i o s  2toir oydaltemnetat) Dra(rpnu0optoifciat sDrl(mon()areoirctadom e uvo s0sruo(m3oy4ol  lfei sfsrrmxmpnt4aptnioctadfaDumnmo;u4arerxf3tadlpte u i (0 2tm(m3nodlptn fvsl(f Dtrumo;t0tpxnioetytlsDua(monu0 etrxr to1fp eaieo t) etrxrpoo1apeelici ( srum( oou4oexnii3ils sDrmnmsnt0arxoir3ty1omDe ivs;( srxoxm io4lmte fvilt  rrau o;t1aexo ieiat mDea(ms;(4trtrmrciadlmteauvi;s0 2ur(opno4ame lnet s) Dtr(m ;o1alen fcilsla elu sn(4altrmf iy1lp  anes;(  etmxm ou4ap emnvilsf rrrurp;u0ope  i3iasla elump t4aeenxocootoateai s;t  2xm(o3no1alt  fci () 2tmxmpno4aeenio3iysfs uaums (4 lenmf3ty1oaDe neolt trurim ou1om nlncias aDurxmoou0aex mo3iydfs2ulnvsnt4arxoxf iadom e nvslt) 2xo(m3oydllte ivilt aDtmu o;o0oleniieiadla2rln o (4tlenio oydfm rlueo;(0t2xmio nu1ope  fviatf Duaum nt4tlxn ociatlm2rm(mpn() etoxr iytomDe ieo;t) rtrxm3nodop emncsls srrmurpoo4olenif3tasfsDel(ms t) rxnxr to1om r n i t truoiopnodoptnmnetatfa2tm( pou0olx  i3tls m elums;()aexnio3oytlaDeai s;( trxmxmpoudale lfcs sfsrrr(ro;u0opxomiciydlaDul(ms;()alxrxfcoa1opDrlues;() 2uoxopoodaptemnvia()s2uru o;o0apxo i3ias s2eln p;t)tetnmr oytlaDranei;t) rtmxmpiy1ome lfeta()arrrxmonu4oex micildfs2uln o t0teeoxrcootlmD an o t0s2ur(rpiodap nlfvsatfs2tr(mp;t1ale moctldfa rm(ms;(4 exnxf3iatopDr neo;(0t2xmxr3oo4altelnesas sDururooo1tetoifeiasfsDrm( s (4aetoifctodlptrlnvo t)t2toir3nu1lptn fctas arumx  ot0alto fctlslaDemnmo;u)aetrmrcoo1opD  u s;s) euoxmpny1lme  fesl( aDuax ono0aleoii3tld a em( p (4trxrir oodfaDr ueils)texo(o iy1ap emicia( sDrr( p;t1openmo3iltlm2ranmsn(0 rtnmr iytoat  ivo t  rxr(m3oy4llee nvsl() rrax onu1tptomfctyd m2rln on(0trenmo oytfm eluesls0 rxmxrpno1amt  feslt) rtmu poo0aexomi3iltls2umu pnt)trxoxr oadlp  lneils0srurio nodape mnvt sfaDtmurpoo0alxo iciytfa2ra(vonu4aetomr3todomDr ueolt trtoim3oo4lp  livilt s2rm(mpou4aleniietytfm umnvpnt4 ltoio oodoa ranei;t s2xm(r iy1amen ivilt s2rmu p;u1tltn o3tltfs ra(mp t0alxnio3oadoa  lnvsl() rtrimpny1oltnmfet ()arua(mp;u0oltn i3tytls2rluvpnt0trenxr ty1fate ueo t teuoxm iodom  lfei s s2rrx pnu1altnmi3iysfa2eluvp;()arxomo3ia1lptrluvs;t  rtoir no1ap   iei s sDrmurpoo0aexoii3iat a ulnvo;(4 rxrif iadlateanvi t)sruoxo ou1lptelfetas)artr( onu4tpeoio3iltlmDrmnmp u)tlxoir tatfat au o (0s2trxm3no1lmeelnes tfaDuaum oo0oeen fctlsfa elnms;()alxoxf3iatfatrai o (0s2xm(o3nudllenlivs s  rta(ro;t0optnif3ilslsDrmu o (4aetomf3iy1faDe u i s0srxmxo ny4opte ivtas)aDum(monu4apxo o3iasfs ra(vs t0 etnif ia1oat auvs;t s2xmxmpou1llenlicilsf Durx o;t0aet moetysfaDranmpnt4aeenmo oytlpDr ieolt0 2uo(opio4ll   ivsas s2ra( oot1tet ifciytlm2emu sn()teermr3oa1fp   nes t) rxrim3oydlltelivt (  rumxmo;o1oexo oetasfs2ua( p;t)tetrxr3iodop  ln s s)s2xm(rpnydll   nvtl() rtm(  ot1ape ifetysfa ea(vp u)tltrmo3oo1lmtrluvi (  rur(m3io1ll n fvi s)sDrrxr nu0texniiciadlm ul(vpn(4tetnxfcto1faDrlieo s setriopiydlp  lnesatfsrtmumo;o4aexoif3ilt aDel( s;()trxoir3ia1fpDrai sls0 2umim ou1omtemnvtl( srururpot4aetomictls a umnvo;(4arxnioctydfmDelieo t srto(r ny4ape lfci ( s2rm(  ;t0opx  ieiaslsDulnmonu0aetoxf3iytoatraivol()srxrxr3nudopee iviatfsDta(m ot0tlxnmiciytfa rlnvsn() lxnmr3ootfa eaies () 2xm(r no1ale  iesls) rrrxrpnt0opeo ietldfm2elu p u0aexnif tytop  lues s srtm(o3oydll nmicsas)sDrmu o;t1opeo ictltfs2uaump t)alenifciodlmteaies;t t2tmxo3iydope mfetlt)a2rr(mpoo0texoioeias a2uaumo (0tltoifciadlp ran s (0s2tr(r3oy4olt mnesa() Drrurpou0aetnii3iydfa eaump;t0tltoir tytomt  ueo s)s2trimpio4ol   ivi t)artaumpou0aeenmieiad aDeluvo;()artnxoctatfaD auvo;s0srxmio3ou4al n ivsasfaDumx  ;u0ale iictltlaDem(vp t0arerxr iydla  liesls  rurxo3nu4llee ictat)s2rr( ont1alto ieilslmDem( pnt)tetoxf3oodlaDrliei;s0trtoim3iy4amtnmnvt (fartmxrpot0tleo ociatls ea(vp;u4 ltoxfciodfa   u o (  eumim3nydlleemicsat srumur oo1oee mocilt m ul( pnu4tltrmo3oydfm  li ilt)trxmxo3oy1op elncsl() Dtrxrp;t1tle iietadlm uaums;(4 exnxf iotfat lu o;t s2uo(m ny1oltnlneil(fartaxr ou1olenmiciytlm2emumont0aetnifciatla  auvol()s2uoiopoy1apee fciat aDrmu  ;t4opeomfeildfm2elumo t4alxrxo todfp  lnvo t0 etrxo3iodlmtnmfeslt) Dur(ro;t0tetnifctltfm2ea( ont0aeermf3tadfatr ieslt)trtmxr oy4alte ncs (fa2taxrpot1tpxo fciyt aDrmuvo t4trxrir3oodfa rln sl() exrxm3oo1ol n ivtls)artr( ooo1ope  fciys a elnmpnu0aetnxrctytomDeai o;s0setrxr nu1optn fet s sruax onu1oet iieiysfa2ulu s t4trxoircio1fmDe n o t0s2trxo3iu4op  mnes t)sDum(mont1tpeo fciys s2rl(vo u0tetrxf iatoatraneo;s0 2urxrpno1amt  nvslt)s2ua(rp;o4tetomo3iasls2rm(vs t4areomf3oodom  auesls)trur(r iu4oltelfcslt arrmxrpou1apeoifeiatfs2elnmp;u0trtrio3oydoa eanes;( s2xmxrpno4opee nesl() 2rm(m ou1tlt ifciltla2ua(vo;u0tltnxociatomDr uvols0setrxmpnodalenlivs t arumumpou4teenmoeiatlm2eanvpn()artoxf tytla r iei ( srxmxo iodlleemfvi ()a2tmum ot0aptomoeiltlaDea(vs u0 rtnxr todfp  lu o;( t2urir io4lp  licsat  rtrxr nt0aexnioeiydla emuvs u0 lxnir3io1oatean s t0 rxr(r iu4optelnet tfs2rmu  nu1optoii3tlsfaDem( p;t4trtnmr3ia1faD li i ( s2um(opiydllenlnvt s aDraxmpnu1alen ieiat s rmnvp t)trtnmr tydlp e u o t) euoirpnydalte ncilt)s2ur(m ou1tle mi3iadfm2rl(vsnu)aetnircoodlp rli o;(  2urxm3oo1lm n fcsatfs2tmxmp;u4oeen fetyd aDrmuvo (4trxoxocoodoat livols0s2uoxo nu4lmenlies s  2uax pno0tlt  iciys aDua(ms;t)tlxrmf iotlmD  n sls0trtmim no4op n nesl(f 2tmu  ;u4apx  o3tltls emnvs t0tlenxfcto1fa r neils0s2umxm3oy1ol elfvslsf rtaxr ;t0tle moeias m emnvo t)aexnmfcoodoaDeln s ( trtr(rpnu1amenlfvi tfaDumu oou4alxn ictydlm2rlnmpnu0altrio iadfmDean i ( seumxo3oodlmeelies s) rum( pnt0aex  iciysfa2ea( ont4altomfciatfatrlivs;t0 2xrir iudoleemicia()srtmxrp;u1apx  feiyt m ra(vo u4aeerir3ty1fmDran s;t  2tmxm nu4oltemivi t  2tr(m oo0ale  f3tatfs ua(vont)tlenmo iodlpD anei;(  2trio oodolenmfcsls)srumur ;o1ale  i3iad m rl(mo (0aetrxrciotfa e u s s0srxm(mpoy1lpte fvtltfs2tmur no4alxnmociad m2eanmpn(4alenmr3iy1opD au sl(0t2tmxm3nydoptemnvia( sDumxrono4apeo ociyd s rlumon() ltrxf oadfat aies s s2ur(o nydameemfvsasfs2um( ono0tlt mocils a rmn p;(0tltnio tatoatelu ol(0trur(o ou1ome mnvi t aDrmxrpot4aex ifeiysfaDuaump u4texoxr tydfp   nvil(  exrir3iudap elnet ()artr( p;t4olxn oeiat sDuanvo u0 rxoxf ia1fatrlu ol() exr(opnydlm e fesl(f 2uax  oo1aeenioetatfm2eluvsnu)arenxr3ty1omt  u ols s2tmxm no4lp emnctat  rrau  ot0aeenmf3tyd mDemnms;(4tlxrifcoa1fa  li slt0 2urir3ny1lpt lfvtlt) 2uaur ;o4oexnmfciltla2umu p u)alenio ta1lptelu o;t sexoxrpiudap nmnesat)arur(rono4aee mi3ildlaDea( o;
\ No newline at end of file
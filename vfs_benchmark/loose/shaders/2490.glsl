@@ -0,0 +1 @@
+ivo;()sruoxm3nu4lpeelicsa(fs2rm(mpnt0olx ioetys a uln onu4alxrxo oa1laD lues t texr(o3ou4omtnliesls) Draxr nu4tlxoii3ils s ra(mp (0tltnxfcoo1fa   nvs t)teuoim no1amtn ivt () Dta(rp;t4aetniieiyt s2eau ont)tlxnmr3tatfmD  u o;() exoirpiy1ll elivi s)sDum(moot1aptn ieilsla uln sn(4texrxfcoo1omt lueil()t2uo(r3oy4altn fvt tfsDtrxr nt0oltnmi3iasfa rmumpnt) ltniocoatfaDr ueolt0 exoirpoy4ll elicsa( a2taxm ;t0tpxnmieiytfa2emnmo;t4trtrir3ootoa  lneo s)seurio3io4lmenmnvtlt)sDrm(moot4tex  fetydls2rmu sn(4teenxr oa1fp eanes;()s2tmir oydamt lfvtl( s2tax oot4apto oeilsls2rlu p;u0tlxrxfctytfa rli o;s) euo(m nydom emieias arraumpou1teeomiciyt a emuvp;t) etnxr3iytop e uei s0 rtoir3iy4alt  icia( s2rrumpnu4teenio3tadfsDra(mp u)tlenxf iatom rln s;s t2to(m io4lm   ivtasfa2rmumpot0oex  octas sDul(mont) renircia1oateluvo;(  euoir3io1openliei ( arumur ou4opeoiociltlm2rl( s t) eermo3iydfmDr ues s teum(m3no4al emieia()sruax  ;u4olt  fctldlmDelumsnt0aetnircoatfatelneils0trtoimpoudlleelfvi tfsrtm(m ou1tltoiiciyt m ea(vo u) ltniociadoaDelues (0trxoir nudlm  mfei t)a2ta( p;u1alen oeildfs elnmo;t0aeenmocta1fatr uesl( s2tmxrpiy4ap   netlt)srur(rooo1tlt  ocilsla2umu p;u0tleoxfciodoaD lu o;(0trtmxo3nu1lle lnvia( srrau pnu4teeoifciaslsDrmnvp;u4alxnmr iytoaD ln s;t  eurxo ou1lm nmnvias) Drax p;o1tptoifetls m ea(vs;(4tlxnmr iotoa r n o;s)t2toxopou1lptnmies (  ruaxr nu1opeo feils a ul(vs;() etrifcoa1laDe neil(0 exmio iodllenmivils s2uau oot4tpt mietas sDrl( o u4texniocty1oaD li s t)srtr(r3oudope micslt srtmur oo1openioeiasfs2ulu p (4trxnircoodlatrlu o t seumir nodomtelnctltf Dumx  ou0opeoiieiad m2rlnvsnt0aetrxrctydopD au ols)s2tmir ny1omtelfetlt  2uax ooo1opx mf3tls s2ea(ms u)arermr tatla  ln sl( sexoimpiydal nmfeilsfsrtmuro;t4tlenmo3tadfm eaums;t4 eenxfcta1lmDrauvilt  rxmxr ny1amenmfctat sDrau  oo0alt mfctat sDem( s u)aexoifcty1lm rau o;s  exrxo ou4omee ncils) rtax  nu1oetn f3ild m emuvp (0aetnmr3oytfatrlueo t0 etr(opiodllee ivtls)a2tax o;t4tlxn fctltls2um(vsn(4artnxr3oydlm rauvsls)srxo(o3no1omt mici s)arumxmp;u4tetoifciys m um(von()altrir oadfpD  ues s teumxr3oy1op  mnesat) rtrx pot1tltnmfciltfm2rau p;t) renio iodomteaueslt0s2toim3ou1olee ietlsf rtr(mpnt4oexo fctlt m2ra(msnt)trxomrciy1lpDe nvo;s)texrim oy1lpen fesa(  Dtr( pou0aet  o3iydls2uau p;() rtnxr iotla rli i;(0t2to(m iu1altnmics sf rum(mooo1oltnmfctatfm ra(mpnt)trxnio3iy1lmtrluesl(0srxoxr3oydlpenmfctasf Dumx pnt0oexn oeiatfmDuanvs t)tltnif3iodopD  ueolt  2xoxrpiy1alt lncslt)a2tmur ;t4olen octadfa2eau pnt) rxoxfcoodopt au o;(  rxo(mpou1lm  lieslt s2trum ot1tlxnifeiasfa2uan s;(4trerifcoy1optr i s;s  2umiopoo1lp n fvi (fsrtm( pot1tpx mfciltfsDranms t0tetnmo3tytlpt  u o;t  exm(o io4ole mici sf Dtrxmp;o4alxoiieiyslmDemnmp t) rxrif3ta1lptrai sls0trxmimpny1lpenlieia(fsrumu ono4apxnii3iyt a2el(vs;(0 exnio3ia1fmtr n ils0setrir io4lp e nvil() Duau  ou0texoiietld s el( s;(4trtnio3oy1la rlieilt)t2tm(opoydop nmictl()a2taumpnt4oexnmfeilsfs rauvp () ltrmo iadfm   u s () exo(m3oy4lptnmfvsls sDrruroot1aetomi3iyslm2rau p;t0 lenif oa1omtr nvo;()t2tm(o iydlpeelncsa( arra(mooo0opto f3iytfaDua(vs (0tlxnir ootom  aueo;t) exrir oo1oleemnctat)s2urx pno1tlxnio3iltfs2elnvp u4altnxf ty1fp  au o;s)s2uoxrpno4ol emnvta( aDrm( ont1opxoiociatla2ua( o u0 leomrcta1fpDe i s s0t2to(r3oydaltelfctls) rrmx pnu4optoifetatla elu ont0 etnio todoa   ivil(  etoxmpiudol e ictl()sDtmum ;u0aexomf3tadfs2ulu o;t4artomr oy1fa e nvo;(  rtrxm oudole  ncias srrrx poo0ape  fctlsla em(vonu)altoir oatlptrauvsl(0trxm(r oodaltnlnvt s)s2uau  oo4aee mfeiatfs2raums (0alxrif3oodoaDraivo;() eurim3oy4ol  mivsa(faDtax pot0tpxn fetatlaDuaumon()trtnmoctotfaD an ols) exoxrpno1lleelneias arrr(mp;u4optnmfctaslaDea(vs;()altrmo3iydfpteai sl( seuoxm3ou1alt  nvsat  rraum no4alenmf3iys sDem(vo;(4aetnxocoodlatelueo s s2ur(rpio1olte fci s)a2rm( o;u1texnifeiyslaDeluvo;t0trerxocoydomDr u ol(  etoim iydomt mncsl()sDrm(rp;o1oeen ietytlm2ra(vs u4arxrifcio1omD lueo;t0s2umxopio1opt mictlt)s2ta( pnt0oltniieiyt a umuvp;u4tltrmr totop ran i s  eum(opiu4ll nlivsatf Dtaxmpou0oexomietadla2ranvs;u0aeerxrctotlpDeluvils  2toxr ou1amt  fvs sfartaurpno1oee  o3iasfaDul(vpnu0treoif3iodlm eluvo t0sruo(o oy4ole lnvta( sDrmuro;t0aptnmfciasfm2rmn s (4 leoir tytopD  nvs s s2xrir iudal emietlsfsrtrx p;o4apxomictadlm uanvo;u)arxnmf3iotopDrlieo (0 rtrim ny1ap elfcilt s2urum oo4openio3tadlm ra( onu4tltrmr3ta1omtr uesls0tetmxopnu1omeemiet t s2rr(m oo4opxomociadfs2uan ont4texomf iotfm  anvs;t0sexr(m3nydaltnlfvt s) 2uaum ;o4tpx ioeiydla rl(mo t4tltomf io1om  aiei;s s2trxm3oy4aptemivils arrm(moot4ope mfeilt s rm(vsn() rxrxrcoodfaDelueolt)seumio3oy1ll emnvsls)srurum ;u1apxnio3tldlaDel( o u0aexrircootoaDranvsl(0trum(r oodalen fei sfa2umumono4ole  iciytfs2umu s t)aetnir todlaDr iei ()trxrir3oudaptnlnei sf 2tr( pnt1tpeomocilsfa ranvo u)tlxoxociy1fpD auvo;()trxo(rpnu1ol e ncslt arrm(m ;o4teto ieildlm2rl(vpn(0tetoxo tatlat anvo (  2uoxm oo1lpte nvtl()sDraumpoo4ole if3iyt sDrmums;u4artrmfciodopte ivol(0srxoxm3oudam   ictasfa2tm( ooo1apx  o3tlt mDeauvont4alerxf ta1la e ues () 2xr(m oo1am nlneta(fsrrmx o;o0tetn f3tatlmDul(vonu0trtoif tytla  auvo;s) 2xm(o3no4amt lnvil(faDur(r ;u0tleniociltla2eluvp;u4trxrmf3oa1omte ivo t  etmiopiydllt mncs sf Dtmxrp;t0altnmfeiatfa rlumpnt4 reoircto1lp  luvs;t) 2urim3ny1lpt lietlsfa2rr(
\ No newline at end of file
@@ -0,0 +1 @@
+nvo;() ruoim3iodoptn ieiltf rtax ono1openif3iyslsDeauvo;u) rermfctytlm rln i t0t2to(rpnu1oltn nvt tfs2ur(mpot4apenmf3ildfa eln o;u)tlerxo todoaDrlneolt0 eur(o3nu4ll  lfes sfaruau ono4oeen ociltlm2ul(mo t)tlxrmr3ia1fate nvs;s)s2ur(m3iy1omenlfeil()arrmurooo0aptoiociysfa2ra(vo t)tlenir iadlpD  i s;t)teum(r iu4ol  lfcil(farrau  no0tltniictydlm ul( s u) eermfciotfp rau il( t2tmim3oydlptelfvt t srtru oot1tlx  ictytfs emn o (4tlxnmo iadoptelu s;t)t2xoxo oy1ll eliesl( aDumxm no0ole  f3ias a ul( p;(0 ltoir iadlat  n i;(0srtoirpio4om nlici sfsDrmx  ;t4tlxomoeiydls el(mp;t4aeenmr3oatfatr n slt teum(mpiy4om nmfet t  rraurono4ope io3ilt a emnmpnt4tltoiocoodlm rau s;t  2trir nu1llt  nesls)sDtau pno4texnmoetlt s em( sn()aetrif3oo1opt livolt)s2trxopoo1lmtemfci (farrrxrpou4oexn i3iadls2rauvp t4artrxf3iodfp  lies;t0sruo(m3nodal   nvsl()sDrr(r no4oetoiietatlm2ra(vo;t)artrirctadomtr nvi s0 rumimpnydol nlnct s) rtr(m nu0tlxoiiciat sDua(monu4 exrxr ootfaD  i i s)trxoirpou1op  mnvs tf 2urx oot4oeeniictatfa2ranmp;(4 exnxocoa1faD aues;t)srumir oo1om emfvils)aDtaxro;t4ole ioetysfm2uanvp () rxomr3todfat  iei;t) exrxm3iy4op  mnetlsfa2urx pnu4olxnioctyslm uaumo;t0 lerxr3iy1fm elnes ()sexoxm3oodomt mnctl() rrr(m nu4ape moctatfs ra(mo;u4arxoxfcoadfaD aneilt sexoxmpoodope lfet s  2urump;u0tlxn feiatfm2rm( pn(4 eerir3oatfptraueolt0 exoio3nodomte feiltfa2truroot1tltn ociysla eau o u)aexoio totoa elu o;()s2xmio3no1al  mnvi () 2ua(ro;t1oltn o3iytls em(vp;t4 rerxf oydoptrlu o;t0trxmiopnodapen nci s) Dua( ono1opt mo3ildfm2el( p u0tltrioctadom raivi ( t2xmxmpoydameelicta()a2ra(mpou1ope if3ias m emuvonu4trxrioctydlm ran ol(0t2tr(m3nu4am emivsasfsDrmxro;t0olxo f3ils m eln p;t0 rtoio3iydomDrlnvol(  eto(opiudlpenmnvsls)a2ur( pno1ole mf3iydfs ran s ()trtnxrctadfaDeaueslt0s2xmxm oo4ol   iviltfaDrm(  nu0oee  oeiytfs rmumont4tlxrxf3tytfm e ivs t0 rxm(o3ou1ome  iesas a2umxmo;o0tptnifciltfs2rlnmp;u)tlxomr tadfa eln slt s2trxm3nodop e ictat)srrmxroot1aptomietysfm2uanmp;t4 eenmoctytfp e u i;() etoir io1al  mieia(fa2umxrono0oeeniiciyt m ulnvs t)trermo tytfa elu o s)srumxmpoo1lpenlfci t)s2tr(rpno4oeen ictat a ua( p;t4trtoxo3iatom   uesls)srxoio ou4lltemncs s arta(mpno1aetomoeiatfa2rmu snt)arxrxo3tytoa  au o (  2xoir3oydllenlnvi s) rta(ro;o4oltoifeildfaDemumon(0alxnxf3oo1lm r n o t0t2urim3iy4alt  fvt tfsrur(rp;u0aleoiocilsls2rmnmp;t4tlxnxrciatlpD luvol(0trxoxm iydaltnmfeiat)aDtrurono0tpx iictytlaDean p;t0 lermo3tadla eluvi ()t2uriopny4altelivtlsfarra( ono0alxnifcildlaDum( s;(0trxriociytoa ranvi;t  2xoio3ny4amtelivsasfartmuront0tpxoif3tadla uauvp;(0tltoiocta1omtean i t trxoim3iy4alte neils)a2rm(ronu4olx mfciad m uln onu4trermr oo1fm  anei t0teumxrpiudllte nvsasfaDrr(  nt0tlxomoetlslmDuanmp (0 lenif ootopDeauvs;s  2xrxo3ou1al nmfvtl()s2rm(rpnt4oet  fcilt a2emums u)arenir oa1la eai s s0s2xmio3oy4lltemfcta(farrr( onu0oetomi3tytfm2rm(mp;t)teeoxrcoatop e neolt0 rtoio3oodlmtemnetls  rrr(mono1olxnifeiytlm ean snt0alxnxo3ia1op e ivolt s2urxo3oudolt lfeilsfa2trxrp;o0oeenmf3iadlaDem(von()aeeomfcoy1fpteanvs;t t2umxopou1lpe mnei s)aruaump;o0aleo fetysfsDrlump;()areomf3oodfptran s s t2uo(o3iy1alenmnctat) rtrur nt1oltnio3tydfmDel(ms t0 rermf3todomD au o s seurxm oydlmen fcias) rtaxront0tetomi3iltfsDemnvsn()trtoxfciytlaDe u sl() 2ur(r iu1ol   iei t  Draxmp;u0olenio3iadfs2ranvsnu4artomrciotoateluvils trurir3ou4lltnmietlsfaDtaxmonu1tpt mi3iaslm2umnvo;(0tltoir oa1omD auei;( sexmiopiu4aptemnvi tfaDumu pno1tpen o3tad s elnvs t4artoxo3iodfmtr neo;(0teumxrpoo1olt  iet s)sDrrxmonu0teeniiciysfs emuvs;t0arerxf iatfaDr nvilt trxrir3no1lpenmiciat) 2rm(r ou4opxniociytlmDeaumsnt0 eermocia1opD anes;s0t2uoxr3nu4lpt  ncils)s2rr(  nt4oeeniiciat sDeluvp u0 lenir todlatrlivs;(  rxoxmpnydapenlieiat) 2tru oot0altnmoeiydfm umuvon()tltrxrcoo1lmDelues;( texmir iydamtnmncsas)aDuauroot1opeo oeias m2um(mp ()arxrmoctodfpte ivilt0trxrim iydlmtnlnvtlt)s2ta(mono1aeen i3tltfa2rm( snu)arxnifcoytlatr ueslt0tetoir3no4omee fci sf 2tau ono0aexnioctys m2rl(mon(0aetrxo3iatomt anvslt0 ruoir ou4al  lnvsa(  Dra(ro;u4aex mf3tadfmDrln o t) eermf3to1fp  lies;t t2urxr3oudope mfeiltfaDtmur oo1apxoifcilsfa2em(ms u)arxrmrctotlmt lnesls0trtoir ny1ll nlnes tfa2ur(rpou4olxo oeiyt aDul( p u0 rxrxo iydfm e n olt0srur(opoydll nlnciat)artaurpot0tet  oeiat s rl( o t)aetrmf oytlpD aivo;( texoxm no4al nlfvsls) rua(r ou1aptoio3iatlaDul( p t4trxomociydfm raueo;s truriopio4al nliei t) Draumpou4tlxo oeiltfa2uluvon(0areomf3iadla eaies;()t2toxm iy4omtelncia(farua(mpnt0apxomfetydlm eln o;t0 ltoir ta1fa elnei;s) etrim oudlmt lnvta(  2taurpot0tet mfctysls2ranmon() eenir tytlm elneo;s0setrirpoo1oltemnvilsf Duaurpno0tlt mfeiltfm emn snt0artnxr iytfmt lu olt sexmxm3iu4lp nlicsls)a2taxm ;t0olx  ictltfaDumumo t0aeeoirctotfmDr uvolt) etrxmpiydopte ncsa()arraumpnu0tleo oeiat m2ul(vo ()texoio3iotomt  uvo;t trtrxo3oy4omt mfes s)s2tmum oo1tet mfctysfs2emnms;(4tlerxo oa1oateau o;t0sruoim oudalt mici () 2tmu o;o0olx mo3ilsla2ea( snu4aetnio oytomt an o;t sruoxopio4lm  mfvs s)a2raum nu4apxnmf3iadfsDemuvo;(0tltnmf3ia1oa e uei;t) 2tm(opio1alen fvt s  2tmumoot4alxnmociltla rm(vp (0 lxrxrcoatoate uvi;s  etmio nydam  lict tfa2uru pnu1tpto fetatfm ra(ms t0aeenifctodomDeanvolt)tetm(r iu4llenlnci sfs2rmu o;t4aeto ictasla2ea( o;t0 etniocio1lmDeaivilt s2xm(m3iydom  liei ( aDta(mpou0optnmocild a2ua(mo;u4tlxnio iy1la e iei s0srtmxo3nudaltnmicsas s2uax  ou0alxnifetlt a2umu s;u)arxnmo tytopt livs;() etmim3nydlptnliesltf rtaurpot4opt mfcild sDum(ms;u)trxoiocta1lptrai i;()trtrxm iudol elnct ()aDua(  nu4olxo ieiydfs rlnvo t) exrxrcootlmte ueslt0t2trio3oy1olte fcsa()sDtmx  ;u1opeo ociysfa uluvs t0aeeomf3io1omDrau i;t0 rtmirpnodlle lfvs sfsrtaxront0aet ifeiysfa2eaumonu4trtrmoctotomD  uvs;t0 2uoim3iudllte fvsl(fa2uaxrpnu0ole iieiatls2ea(vs t0 renir oydlpDraieo;s t2xm(rpoo1apee ivs (fs2um(r ;t0aex  i3ias mDelump (4areoiocoodfpDrlneo t) rtmxm3no4al   icils)s2ra(rpou4opt  i3tltfs2uaump t0 lxnir totoatr ieo;()t2trirpiodlpte nvtasfs2tmu ono0opxo f3iasfaDrau snt0 rtoif3tatfm  lu o s trurir3ou1alen fctatf rrrxmp;u1oex mfeiydls um( pnt)aeerir oydlpt  u s;t0 eurxm3iy1aleemietlt s2rru o;o1alx mfetatlm rmnms u0aexoircio1fmDrli s;() rurio oudap elfes t  Durumpou0tlt mo3tlt m umuvsnt4 rxnirciotomDeau s;s t2urxrpou4omen fvs sfa2rrumpno1aexoio3iaslsDumuvon(4aetoiociodfm e nvi;(0srtoio3nu1oleemfcia(f Dtmx onu4apx mi3tldfsDelump;u)alenxf oadlmteluvi ( trxrimpnodlmtemivt ()aDur(ront0apxomoetld a uanvon(4trxnmf ta1late uesls)t2xrim3ou1ole lfcia(  2ta(mpnt0teeoiictys a2em(mo;t4tetrxrcoy1fptr uei;t tetoirpno1op  livslsfsDrrumo;o1apx ioetyt aDrauvo;u4aetrmr totla   nvils)tetoxo3ou1lm   fci sf rta(ro;t0aeeomfciydfm rlnvs t)arxnmf oa1fmtraieo s0sruoxr oodamen nvi s sDtaumont1oexn iciysfm2rm(ms (0aleniocoa1opD luvo t texo(r3iydop emfes (  Dtmur ;t1tlt  octytfmDua(ms;t4 lxrio3iadlatr n s s) rxoim oudopt  icils  2rm(r no0tpxnioeilslmDum(ms () exrxrcoo1fm   nvs t)trumxmpiy4olt mncsat)aDtmxro;t4optoiociltlaDulnmon(4 rtrif iy1lptelu o;()srumxopio4omtnlfcs s  2rru p;o0opxnii3iltlaDraumo u0tlxnif3iy1omtrli i t)sexo(m3no1apeelivtas)s2um( oot4olx ioetat m2emums (4aeenirciatlpDraneolt texr(opno1lltemnetas sDurxm oo4oleomoetldfa2rmuvs u0aexnio iytop  auvo (0trtoxmpno4ap nmieil(fa2tr( o;t1tex  iciltla ran s;() lxrmrctytla r uvi s0texm(m no1al nlictat) Drr(m no0opeoifeiltla rauvp;(0alxnif3oo1fmDe ieo;t0s2xmxm3oudomenlnct t aDrmxmooo4texn iciadfs ulnvs;u0trxrmo3oatfmteaieo;s trxo(r3nodlmen nciltf 2um( oou0oltoii3tyd m uluvp;() reoxr3oatfmteaivs;s  2xo(r3iu1om nlnci (  rrmuro;u0olxoiiciasls2umums;u0tlxoir iytla  livi ( teumir3iy4apt mies ( a2tmumpnt4aetomfcilsfsDel(vp (0texrxr iytoateai ilt0 2xmxr iu4llee fvs tf rua(r no4tlxoiictadlmDua( o u0 exnir tydoat  uvolt s2xoxm ny4lle lfetltf rum(rono1tpxomictldfsDrm(ms;u4 leoioctytoatr u sl(  euoir ou4lpt mivtas srrrxmpnt0opxo fcildla2uluvp;() ltnxrctotom  ln i;s teumxmpoudlmtemfeia()aDrr(m nu4tptoifciytla2umu o;() lerio3iydopt lu i t0setm(m iu1llt mfcs tf rrr(  nu1oetoio3tltfm eanms u4tlxnif iydoate i i (0teur(r3nudol nlfvil(  Drrx oou0tlxomfeildfm em(vpn(0 ltnxocoy1fpt  ues;t trtr(o nudapt lici ( srra(  nu4aex  i3tatlmDem( s t4trenif oy1lpDrlnvi s  2uoxrpnydllen icsl( arrruroou0openmieildlaDulu pn(0trxrxf3tatlm e i o;(  2urirpoudlm n nesatfsDtmxrono4tptnmo3iaslm el( pnt0 rxnxrciy1fpDe nei;t trtm(m3oy1lmtelicsa(faruaxrpnu4texn ociasla2ranvsnu4 lxrxrcta1optrlivi;( t2toxr io4al  mict ()artaxmont0tetnifctys m rln onu)altrio tytfm elues (0 etmim nudoltemnetlt)a2uaxr ;t0aex  o3iyt aDra( p (4 rxrmfciydop rliei s setmxmpoy4lpenliciasfs2rm(m nt1tpx mo3iyt sDemump u0tetrirco
\ No newline at end of file
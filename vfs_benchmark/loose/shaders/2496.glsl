@@ -0,0 +1 @@
+ivs t0s2urim iy1om nmfeiat)aDtauro;o0oetn fetyd s rmumsnu)artrmr to1oaDrln i t) exmimpoo4ol   iei tfaDrmxrpnt1opxn ieiltls rmnvont4tltnxo3ta1lpte uvsls0s2xmxr3oo1aleelieslt arur(rpot4tlx iietldfmDrlu onu)artoir3tytlpt  nvo t0 rtoirpoy1optnmiei t)aruru o;t0optn f3ildfs2ul(mo;t0altnxf ta1fmDrlnei;()t2um(rpoy4llt lneiltfsDraxmo;u0opxomf3iltfsDrl(vo;t0 lermrciy1lm  luvs;s0 2uoxm3io4amtelnciltfaDta(r ou4aee  i3tatla2ulumpnu0 exnxo3oatfaDr nes t0teumxrpnudoltnlneilt srtmxro;o0altoii3tydfs2ulnvp;t4arxoio tatom e u o s) ruoir iydlm nlfvi tf Drau p;t0oeeniocilsla ran p;u) rxnxr ty1fmteau s;t trxr(r3ou1op nlfvil()s2ra(mp;o4tlenmociytfsDulnvs t)arxnmf3oo1omt li sls0t2um(mpnudope lfvtl( s2ua( oot0alxnmociydls2emnvonu0tltrxo oytlpDrauvs s0srtrxo oydlpe  fes s  Drmxm no1ape iociat mDulnvpnu)alermf3iytoa   n i ()setmxo3ou1lp nlfctatf rrru o;o1tpe mi3ildlmDranvp () ltnir3oy1lpDrlnvslt0teuo(m3iydal e iei sfsrua(  ;o0tpen oeiadlmDumnvs t) exoio3tadlp  ln ol()srumim3iy1lp n fct t) 2ua(mono4oexomi3tltls2em(mo (0aexoxo3iy1fm  lnvolt t2uoxr ou1lmeelfctlt  rrmu  ;o4aleoii3tltlm um(vs u0 rerif3iotopD  ies s)trtoxo iu1ame lfcsa(fsDuaxrp;o0tpto fetatfm elnvsnt0areoxf oy1lmDelivi s  euoirpno1apee fei t  rumum ou1oltniociyslsDrlnmo;(4 rxnio3oo1fat  nvo;(0 2umxr3iy4omeemnvs sfsrtm(r nt0olt  ictldls2rlnmp;t)artrxr oa1lmte ieilt0setmxmpnodlmenmnvta( s2tmx o;o4tleomictyt s ea( p;(0 eeoifctodfpDeau ol(0 eumxm io1lme lieils  Dum( pot4oeto iciytla rauvp (4alxoif3oytlm  aivs;()teumiopoo1lptelnet ()srrm(r ou4altomfcild mDrlumsnu)aetoircoadfp eanei;t)seuoxmpiu1op nmics s srra(  ;o0teenmi3iytlmDrmn p (4texomociadop e uvils  rum(r no1am nlnct t)s2uaurpou0tpe mo3iltfa el(vo;u0texnxr totomt luei;() rxoio3oydapenlnvi tf 2rrumpou1ale mo3tat s2rauvonu4tltnxo3iy1oaDeanes t) 2xmio3oydap elnvt t)sDumxrpno1aeto fetad aDulumsn()aeenxf3iydlmDeanei (0t2urxm3oodome  netls)aruaurpno1oleoioetlt aDraumonu4treoxr3to1opteaies;(0sexrio3iy1ol e fes sfsDtrx ont4tptoioctas m eln p;u)altrmf totla rai ilt0 etoxo3nu1lp nlnvils a2ur( oot0oetn ietad aDum( o;u0arxoxocoy1lp   ueils)s2uo(o3ny4lm emfesa() Dum( p;t4teto ictyd s uluvp u)tleoxo3ty1lat anvs;()t2trirpoydol n ivia()srtaxrpou4tpenioeiytlm rauvp;t) rtnmrciodfmteaueilt)texmim ou4om emfvtat sDtr(mp;u0aetomictltlaDumuvs;(0tlxrirctotfmDr i i;( t2tmxm3oodol n fcsls s2rax  ;t0tlx mfeiysla2ra(vp u) rerxr ootfmDrau i;s0srxoimpiodome mivtlt a2rmxrpot1apeoiociytlmDrl(mo u)aleoif3oadfmteauei t)srurio iudlmt  fei sfartru o;u0teeomoctydls2ea(mp;u4tltoiocootla eau slt0 rtmio nydale mfvtl() Dtrumooo1texniietydfm2ua(msnt4tltnmr iatfp  an o;t0srtoxr3oy4om emieiat)aDtmxmpnt4tpe ii3tldfm2elu s;t0alerxr ia1oatelu ilt sruoim nudalen nvia( s2tmumooo4tlx  feiasfa2uanmpnu0trxnmr3iydoatrauesls seumimpnudlmen fes sf 2rm(mono0olto fetlt m2uaumo u) rtnircoa1fmt  ivo t0srxmim3oudom   fetat) Dra(  ot4teeniietyd m rln p;u)altnmo ia1opte i olt0trtoim no4ll emfcs () Drruro;t4aee  fctld a2ul( p (4teermo3iatfpDraivils  2toxr oudaptelnei (faDtau p;u0aee iietydfs2el( p;(4 ltrio3to1lpt ln o s)t2xoio nu1lp  lnciatfarur(  ;u4olxn iciytfa2umnmp;u4tlxnxf3iytomDeaivi s0s2xm(rpoodal nmnvtasfsrur(rpno0aetnmfctas mDulu o;(0tltnmf iy1fate ivo s0teuoim3oydolt lfvsl( aDtrx pot1oet ioeias m2ea(vs t) etoif todfmD liei;t)t2urirpnu4lmtn nvtl() rrr( ont4tltnio3iltls ra(ms;u4tlxnxo iotla  aieols)teur(rpnu4ale  nvil(fsDtm(mp;t4tetn o3iyd sDumn o;u) etoxr to1op raieo;s0trxrir iu4ale mics ()arrm( ono0optnioeilsfs2umn s;u)artrmo3oydfpDr ivs (0sruo(r3no4apen fci (farrrx  ;u4opeoifetydls ua(vo;u)aexrxrcoatfa rlneo (  exr(o3oo1lmtemics t)aDurx p;t0oet ioeilsls rlnmo;t) exrif3iodfp   nvsl(0 2xrirpiy4ope  fvslt arurxrpnt4aeen oeiadfa um(vs;u)texomo3totfate ivi t  eumimpiu1llen feias)sruaumpnu0oetn i3iyt a2umump;u)tlxrxrciatlpteaies;t)s2xrim nydalt mfct sf rtrxr ;u4optnmfeiytfm2eln p u0aeeoxrcto1opDe ivi;t0texmxmpoo4al nlnes (farraxrpno4alxomo3ilsla uau s ()trtoir to1fp ranes;s0sexrimpoo4amt mics t)aDrmxrono1olen ieiadls2rl( s;() etnir3io1opD ai ols0 rur(r ou1ap e fvsa(f 2raur ;t4apt io3iadfm2raums t0trxnif io1op rau o t) rumxmpio1ll emicilt) rraxr no0apeo iciad m2ulumon(4artnmr3todfpt auvilt setmir no1opt  fesas)srtau o;t4tpxn ictatfa ra(mo;u0alermo tydoaDr nvs s)s2xoxmpoo4ope mncsas)sDtrumooo1aeeo fciys a2ranvsnu0trtoifcia1fpt  u i t0srtrxm oo4ll  lfeias aDrr(mp;t4oex iocildlmDumu s u)aexrio iatlmt  i o ()texoxopio1omeeliet tfsrrm( ono1alxomf3tas a2elnms;u4trxrxfcootlmteanvols s2xrxm3oodlmee ictls)aDrrx poo4tpt mfeildfmDeauvont0tlxoif oydlmDeaiei;s  2xr(o3io1al  mfesl(f 2um(rpou1aee mf3ilt m2emn p;(0 lxnif ia1lmt  nes t0s2uoxr ou4optn nctlt)srrauroot0aexomf3iyslm2ulnvont4 rtrxociy1fa  lnvs ()sexrxr io1om elfvi tf Dtaxrono1oleo i3tadfsDuanvp;t0alxoxr3todfp eli i;t  exoio oo1ale lfetlt  Duauro;o4apx mieild a ra( snu) rxnxf3iatlat au s (  rum(mpiy1lleelnciasf rua(m nu4aee mfeiydlm2uanvont0aetnxociytlmt auvols0 2toimpiu1omtelncsls)sDur(r ot4tlen i3iasfm uluvs (0tetoifciy1fp r nes () 2tm(mpnudomtnlfcs sf rrr(  ;o1opxnmiciyt mDea(mp (0tlxnmocto1latrauvo ( s2ur(o3nodllee fcs sfaDrr(m no1oexoiociat sDraumsnu0artrir oydomDean ols)s2xm(mpoy4llt  nvsat)arurxmo;u0aexo iciydls2rlu pnu0 renmf3iy1omtr ueo s trurxr ny4lm   iesas sDurur nt1aee  fciys mDum(mo;u0altomfcoa1la rlueo t0t2ur(rpiu4al n icilt  Durum oo4olt io3ias aDeaumo;u)aleomf3oo1fa e i olt)s2uoxm3oodal n fesl()s2taxr ou0tpxnmfeiatfs2ulu onu)trxrir todop  liei;( s2uoxo ny1olee ieils)srurxr nu1tleoii3tytls umnmont)altrio3iotom   u s t)sexm(mpnydlm  mfvsl(fa2urx  ou4oet iocias a2rmumo ()altrmf oa1oat auvils)teuoim3iudoltnmnvtas  2tr(m ot4apenifeildfsDuluvpnt0 exnio tatlmteluvilt0 exrxrpiodomen ictltf 2ta(mpnu4oeen fciltfa ea( o (0aetrxo3ta1omD auvs;() 2uoxo3io4ameemiesat) rtmx onu0ape  ietysfs2rlnvsnt4 rermociydoa r ivi;(0teum(r io1omte feiltfsrur(rpnt0ale mfciyd sDraumpn(4 rerxr3io1fmDr i ilt trtoio3iy1olen nvt t aDrmum oo1apt  icildla2ea(von(0trxrmfciotomt aueols t2xm(o nodame lfcsas)s2rrx  ;o1tpxomietatfm2ulnvont0aetnmrcoydlpD ai o;s s2to(r3nu4optnmnesl(  Drrx pnu1altoioeilsfaDumums;t4tlenir3oydlm r ueol(  etrxo3io1amt  fesat arururo;u0aex mi3tydfsDuanvs (0 rtrxr iatfa rauvol(0seuo(mpoy1lmeelfci sf 2rr(ront1apxnmf3iys m rlnmsnu0 lenxf oytfmDelnvo;s0tetmir3nudope  ivsas)a2urumoot1aetn fctlslmDrmnmp;u)trxoio3oo1fa eaneol()trto(rpoudoltn fvs sfs2raum ;o4oetn ociltls emnmo;t) reniociotlpteaivo;s)tetmxm3ou1lltnmfeiltfsDurxronu4tptomfetydls uaums;(0arxrxr3iydom  livil() rxrimpnudamtelivs tf Dtau o;u0tpx mi3iysfa2rm( o t0areomr iytfm rluvslt sexm(m3oy4lp e nvi (faDumxmp;o4oee mietlsls rlnmp u4aetoxf3iytlp   u o;s  rtoim3iy1apen fes s) Dtrx pnu0openmociltfaDemuvsnu) rxnmo iodlmDrau ilt0seurir oydlpenlietlt  rtru  nu0olxnifeiysfm2eanmo ()tleoxo todfp   u s s0s2xmxopio1om   fcslt) 2tmurooo0tpenmi3iydfm el(vo u4 ltnxf oadomDeai sls0s2trxo3no1llenlivtas sDrau p;t0alxn ocildla2elnmsn(4texoifctodopD  ieo s)texm(m3iu1omtelneilt aDra(mont4opeomociltls rmums;t) etrxo ia1fp  aues s)tetoio3nydol  mfvtl()sDtm( pot0oex  oeiys m umnmp (4tlxnio oatlptr ueol(  rum(rpiy1am nlietl( a2taxr ;o4oeto oetyt m2ean s ()texnmr3oadfmtelieol(0truo(r3iy1al n ivsl(fsDuax pnu4aee  ietldfa em(vont0 exoxr oodlatrai i;s srtoir3iu1altemfvsa()a2tm(m ;u0oexomf3tyd mDum(vs;(4 rtrxfciodomte uvi t0trtm(opno1lpe mnvia(fsDrr( p;u1open i3tlt mDra(mo;t0tetnxfctotlm r ieil()teumimpou4al  liviat)artaxroou4tlxnmf3iasfaDrau snt0 rxrmr tydlm rauei;s trtoxr oo4opee fci t srua(r nt1tetnmfeils s umn s u) lenif3tadlaD  ieilt0 rtmio nu4am nlivta( aDuru poo4oeto ocias aDumn p t4alerir3iy1oat  ivs;t0t2toir3oodlpee ictat) Dumurp;u1openmieiys m ra( o;(4texoxf3oytla e iesls) rumxrpoydol nmietat)sDrmx  ;t4aptniietatla2uanvont)artrxrcoodlmDeauvslt) 2uoxrpno4om   nvi s srtm(ro;o4tltomfctlslmDra( o;(0 renmf3ta1omDeaivo;() exrirpoudom eliesa() rrauro;u0tltnmf3ilt m2um(vpn(4tlerxrcoa1lpDrlu o t)teurio3ny1lpte nvi (  Draxrpou1aet mfcild m2uluvpnt4alenxfcoa1opt au i;( sexmxo nydal nmietas) 2rrx  no0teen fctlsfs umuvsnu0 exnir3tydlmDraieols0s2xoxrpnudalt mfeiatfa2umumont4apx  f3iydls2ua(mpnt4teenxrcoo1lp eaneo t trurim3nu4op nlfetl()srta(mooo0aet mieiydfsDelnvp;() eenxf3iotfmDe ivs t setrirpio1altnmnctasfarra(  ;t1tleoif3tldfsDulumo;(4aetoif3iy1laD ln o;( s2tm(opoo1opt liet sf Drmu ono4opx miciltlm2eauvp;(4teeomfcoa1oa   ivsl() rtm(rpiudlm  mfviat sDrrumpnt4aleo fctadfs2umnvpnu4trtnxocoatla   ivs (0s2xo(rpoo1ope mfet (  Dtmxrpnu0ole  o3ias sDuluvo (0artrif iatfm e uvo;s) rtrir3oydll n nvta()aDrm(m nu4aex  ocias m rlu ont0artnxfciotoaDelueilt0sruoxopou4om e ivi (farumumpoo1oeto feiysfm2rm( o t4 ltoifcoodopteluvils0 rtoio nudll nmnvsat  Dumurpnu0tpxo ietas sDemu snu0aeermrctydopDranvils srxoim oo1apenlneias srrm(  ;t0tetn octad m2emnmp;u)tetoifcia1oat lnvs () eurxr3oydomtnmnctlt s2tau  no1open iciydfsDua(ms t4treoir3oa1oateli i;t  2urim nodalenlivi sf Drmu  ou4aee mf3ils a rlnvp t) etnxr3iatopt auesls0 eum(r nydlltemivilsf Durxr oo4tpt  ocildlsDranvont4trtrmf3ta1la e ivs t0 rurxo3oo1lmen ivt s) Dtrxr no0olxnmoeilsfsDrmnmsn(4 eeomf ta1oat li s;s  2toxr3oydalenlfcsls srumxr ou0olt  f3ild a2rluvp;(4alxnio ia1lp  li s t srtrir iu4lpeemnet t sDtmxm nt0oeeomfctydfa2ea(vp u)alenio io1oa e ivs;(  2xoir3oo1om nlnet (faDuau onu0olxo oeiyt aDrmnvpnt0alenxoctytlp  lies (0 2tm(opoydlmt mivtltfs2rmum no1opeo fetadls2eanmpnu0tlxrmf oodfa rlieo;t0srxrxrpoo4amtnmfcsat  Drr(m ;o1tpx if3iydfaDea(vp;t)texomo3oadfatelneo ()s2umxo3iudoptnmivs s) 2rr(  ;t0alxnmiciytls2emnvp;u0 exoxfcia1lp eluvilt  2xmxr3iu1op  mnvs t sDrrxm ;o4apxomociyt m2umn pnu4artrmr oa1om r n s (0trumio iy4ame  nci (fa2trur ot4aex  fetad mDumumpnt) lxoxo3tydomDeluvi () exrxo3oo4lp emivt s srumxmooo0texoii3iydlaDem( o t)treoir iatop  aueols0trurim no1aptnlncs t  2rmx o;u1ole io3ilsfa umuvp;u0trerxf iydomD aivs;t)trxrim iydomeelietas) 2trxmpot4oexnio3ilsfs eln pn()tltnxo3iotlp  li i t s2trxrpiy1oltemics (fa2ta( pou0tlen feiltlmDul( p u)arxoir to1fateluvsls  exr(rpno4lmtelfvsas)a2rrx ont4apto f3iydfa2umnvp ()arxrifcio1opDrlnvilt)t2toim ny4ll n nvsl( aDtaum ;u1apxomi3iyt s rmnvo (0tltrmf3tatfp rau s;t texoxrpou4olee nctlt)artm(mooo4altomocildlm uanvsn() rxoxfcoy1op  au o;t tetr(m nudlm nmivtas)aDtau pno1aeen f3tydfs2uan pn()artrmrcoydfmDeln s;s)trur(o iudom  mieta( arraumo;u4tleoif3ild m ua( o;t4 rxrxo iatlmDelnvs;t  2toir iodome  ivil()aDtaxr ot1oeto feiytla2ranmo t)trtomf oo1oa rln o;( s2xo(o ou1olen icta(  rrauroou4aeenif3iyt aDran s ()arxrmo3oa1fmDraivils0sexmimpno4ll e netlsfsrrmx p;o0opxn i3ils s2el(msnt)tlxnio3to1lmtraies (0srxr(o iydlle lietatf rurump;t4tltn i3tyslaDra(vsnt) lerio to1optean s s)trtmir ny1om nlfvsa(f ruaum ot1tltn ietld a2uluvpnu0altrmocoodfm elu s;t0setm(m oy4lm elivtl(faDumu oou1aptoif3ilsfm rau s;u) rtrmrctytopt lies;()teumir3iy4ope lncilt  Drrum ;o0oex if3tyslsDua( pnu0trxnir tadlaD aueol(0 etmio3ny1ol nmfvi sf rrr( p;t1aptomi3tat a ulu s u)artnmocoydfa   ivi ( trxriopnu4ome  fvi ()arum(rpno4tet mfeiasfs ulu pn(4 renmr3iytopDr uvsls0trtoxm nodame lnvta() 2rm(r nu1olx iictad a uan s u4texniocta1oaD aneo (0s2urim3ny4ap nmfvt tfs2umumpnu1tpxomo3ilt s ua(vp;u0 rxoio iy1opteau s ()trumxm nodamtnlnctat) rtaxrpot4aetnio3tld a uln s;t0 lxoio3tatlaDraivs;s0 ruoxrpnu1omtelfvias a2taxm nu0ope  octaslaDeluvo;u4artnxf iydlmtrlu i ()sexrxopoo4oltnmfei t  2rrx o;u1tptn f3tltls2elnvpnu)artrmo3iytom   ueols0trxmxr oo4om elieil()sDuru  no1tpe mietlt aDea(vont4tlerxoctydlp r nvil( trum(opny4om  mfci s)sDur(mp;t4tlxomoctydfaDrm(vsnu)alxnxf iodopD lnes ()s2tmxrpiy4lpenmnvs s a2rr(rono0tee mfeiys m rau snt0trxomf3iydlp   n olt tetm(m3no1omtnlnvtl(farua(r nt0teen ictys m2eauvsn() rtnir3iy1lm r nvs;t s2trxo ny4omee fvsa()a2tax pnt4oeen oeiydfa2umnvsnu4tlxnmr3oydfat luvolt0trurxrpiydlptnlfetl( srraum no4apxn ociyslaDran ont4 rtrxr iadfmt livo s  rxo(r3oo4op   fvtat s2urx  ;o0aexo ieiys a ulnvp;u4 etnirctydomDrlueolt)srxrxr3iydlpe lnvsas  rrr( oot1tlt if3ilslsDum(mont4 exrmf ta1fa  luei t0 2umxrpiudlmtemnetat)sDrmxrpoo0oet ifctys s2rl(mont0trenmfcoydlpDr u s ( t2toir oo1ap elfvi t  rtm(ronu4aetn fcildla2ranmsnu4 ltoif3oo1fmtranes s)texmiopio4op   iei tf Dtr(mp;u1opt iieilsls ulnmo;u)texnmf to1om raivsl(0setmim3io4omeelfeslsfaDraumpnu1tlen i3ilt s2uln p;()artrxo oodoatranvs;( teuoxo nudlpe mfvils  rrru pnt1altnmietls sDrlu s t0aexoiocty1oaDrlu i s0 2xoirpnydolenmivt (fsDtmu  ou1tlx ii3tydfsDea(von(0 lxnio totfpteln i ( texoxo nu4lle mfei ()aDrr(rpnu4tltoii3iatlaDranvp;u)alxoifciydopt ai s;()sexoio3ny1lptelfviltfarua(rpot1teen fciltlm rm( p t) rtrmr3oydlptrlnei t)t2uoxr iy4amt lietas)a2tm( ono4tetomocildfa2rmn p;t4teenif3tydomtelneil()srtr(rpny1ope  ivta(fsrrrx poo0aet mf3iytls umn on(0aexoxr tydlat  i s;t)t2to(o oy1lpenmnvtl(fsDtaum ;t1oetnmf3ildfm uln p;u0treomrctodoa rauvi;t0 rxmxmpio4omt mnetlt  Dra(  ot4ale mfctat sDuanmsnu0 renio3ty1lmDrlnvi;s t2xoiopio4openlivsasfaDta(m oo0alx moeilsfs el( pn(0tlxrxfcto1oa eli o () rxoirpiudoltnlivi (f Dtmxrono4tlxnifctyd m2rm( snu)trxrif iytla raies;t  rtm(opoo1ole lnetl(fsrurur nt1aee moctadls2eaumo;(4 rtoiociatlm elnvs s)sexrxopnu4lm   ieil(fa2trxro;t1aex  feilsla em(mpn()trerir todoptr ivs (  exrirpnudom   iciatfaDum(m nu1oleo feilsfs rl(mo (0 renxocia1lat au i;t)tetoir3ny1omtemfvias arta(rpnu4tlt mieilsla2elnvo;() ltomo ootfatrluvs;s s2xriopnu1aleelivia()a2trxroou4olenmo3iadlm2ranmp u0tltrxo tatop   ies;t0truoirpiu4amtn nvtl(  2rr(mooo1openmictadfa rl( o (0tlenir tadop elues t0t2ur(o oy1lm  lncslsfsrtm(rp;t0optnioeils aDum(vp u)alxoxo ia1oa   ivi;s)srtmxm iudape lfvsas  rtaumo;o0tptniociydls2emu p;()tetrir iotfmt  uvi;()trumxo3oudomtn ivi t)srtaxm no0tlxomi3ilsfa rl( onu0tetnmf iydfa ranes;t0srtmxopoo1altn ivslt aDtr(m ou0apxnmfeildlmDrluvp;u) rxrif3to1lpDean slt)s2tm(r oy1alenmfvsl(fsDtm(m ot1aeeomfeiltls2uan o u0 eeomf iotfptraieo () rtr(o oy4altemfei s s2trxrp;t1tex ifciasfm ea( o;u0areoio tatfm r nei ( srxmxrpio4al n ietas  Dum(  nu4opxoiocildlmDran o;t) rxnmfcia1laD  ivo;t teto(r oydlmtnlietatfa2tr(ronu1tlxnmf3tas s ulums u)arxnxf3tadlmtelnvo;s) 2tr(m3iodapt  neil(f 2tm(  ot0tltn fctldla2ranmpn(0trtrmo iodfmDeai o s0trxmxmpnodapenmict t)a2tmuroot4oexo i3iydfs rmnms t0tltnmf3iatopte uvs;t0 2xo(opiudamt lnet tfs2rmx pou0opt  o3iadfm ul( ont4tlxomocoodlmDr iei (0t2um(m3no1aptnmivilsf 2tr(moou4tpenmiciydlaDuln s;t) exrif3ootopD au i;() eumio3nu1lpte feils  Dtaxmp;u0openif3tatls rm( s ()tetrifcoodfaD lieo;t seuo(o io4lptelnctl()arumum ;o4ope  ieiyslm2rlnmonu0 eerirciodfa raiei t0tetmir3nudom elnes ()a2umur ou0olt  octaslm2rln s (0 rtnxo3totfp   ieil( sexmxr oodop   ici t)s2tm( ooo0oeeoiicias a uauvp;u) exrmo ootopt li il( srxrxo3oy1aptnlfeia( aDurum ;o1ole if3ilt mDulnmo;t4 leoio3ootoatelu s;t  2xmxr iy4amenmivsl(  rurxmo;t1oeto iciatlm ulnmo;t)aexrir3oytfptelu i;t t2umxm3no4aptn ies sfsruax  ;o0openiicildfa2rlnmp;u0trerio iy1lat au s s  2umirpoy4optemncsa( a2uaurpot4alxomo3tas a ulnmsn()artoiociydlm eln o;t seuo(opoodlp emfeils)aDrrx pnt4tpx mfciltfa rl( sn(4aetrif todoptrlivilt teurxr oo1lm nmies sfaDtrxmonu4alxomieiydfsDea(vpn(0 reniociydlateauvil(0srumxm3oudoltn ics sf 2ta( pnu0aee ifeiydfm umn pn(4aexrxrcta1laDr nvo s0s2umxr iudlm  lfcias)sDtr( p;u0altomf3ilslmDem(vs u0tltrmocia1fmtr i ilt0srum(m3iu4am eliesas)sDrrx p;t4opxn o3ildla uanvsnt0alenxrctydfp  lu i ( t2xr(opou1aptn ivtatfa2rr(r ;o1aexnioctat m2ulnvp u) rxnxo totomD lieo;t t2uo(rpou1alen icia()aDta(mpou4openii3tys m2ran sn(0 exoifcoa1opD li ols sexo(rpiudolt micsls)sDrmx  ;t0opxn feiatfmDumums;(0tlenifctotlp eli i;s0 2umxmpnu1ll  lietl(f 2umxrp;t1oetoifetlsls em( sn(0texnxfcio1fm elnei t  etrirpou4optelnvtlt)a2rau onu4teenifctat sDranms u0teeomr ootop elu ol(  2xm(o3iy1amt licsls) Drm(rpnu0tpeomoetlt s rlu s;u0alxoxr3iotomteau i t srtrio iudal emicil()aDur(mono1tpe  o3ildlaDrmu on(4tetrxr3iatfaDr uvo;(0sruoimpoydopt lnei s)aDrmumo;u4apxn iciasfm2emuvp u)artomf oydop r ues s srtrxr3no1omt mfetltfaruau o;o4alxomi3iadlaDrlumo;t4artoxr3oodlmtrauei t) exrirpiu4lptnmivta(f 2urxr ;o4teeo f3tysfs2eau o;() exoirciytfp elivi s)srxoxm3iy4lltnlicta(f Drrurpnu4opeoii3tltls2ea(vp (0arxnir oatlpDe ivo () etoxmpoy4lpt  ics (fs2rrxmonu0oltomfetytls el( o;()altnxr3iytfp elues (0 2umxr nu1op nliviatfartr(mpou1oexo feiatfs2elnmp (0teenxo tydopDraueslt  2xmimpoodom nmicilt sDuau pnu4tlenmf3tld m2rm( pn(0tlxnmrcta1lpt anvsl( seurir nu4om emivt s aDuaurooo1tpx  feiadfm ea(vonu4aetnmo3oadop   ies;s0texmio iodamtemnvi (fsDum(r ou1oexoifciatls2umuvs () eeomociatfmt lneolt0sexo(o3nydlle mneias srrrxmoou0tlx  fctlt sDum( s;t) ltnifcoodoptelnvil()tetoxm3oudopeelietl()a2tax poo0oexn fctat sDulump () rtnxr3iydom   nei t0t2umxr nu1oleelnvtlt)aDrauro;t1oexnioetltfa ra(vo t0texnio3tadopt  uvo t)trurxr ny4ap nlivia(fsrtmxr ou4tpenmf3tyt mDrmn snu) rxomf3io1fa eanvils setoxm nu1lpeemieslt sDuaxm ot0oee iieiyslaDemnvo;t4 lxrif3iotoate ivs;s)srtoxo3ny4omt  fviat)a2umxmpou1aee  f3iltfs ra(vpnt)tlenif ootfm raieil(0seuoxopnu1al   fet (  Dtauroou4alxomfciytfm ulump;(0tleoiocoa1omDe uvol() exmir3ou1lmtelicsas) Duauroot1tex ifeiatfm2rlnmp t0 exnxf3iydoat anvilt0seumir nu1olt mfes (fsDumurpnu4aetn i3ilsla ul(vs u)alxoxf iytoatranesls teum(m3iu4ame lfciat)srtrum ot4tlxomi3tydla2rau o t)treoifciotop eauvs;( srxm(rpiu4lptnlivsltfsDumxmono1olx mf3tltfm2emn s u4tltnxf3oodfm  lnvolt0truriopoo4ap n fvsasfsrtr(  no0tltn ictadlaDeau pnt4tleoio3io1lmDrluei;s)teuo(m3no4ale livta()a2umuro;t4tpxnmicild sDeanvo u0 rtnmf oa1fp eau ilt seto(opiu4lltnmfeiat  rumx poo0alxn fciad m el(vp t)aleomociy1fmtr nvolt0 2xo(o3oudomee fcs (f Durur ;o1aexnii3ild m elums ()areniocoy1fp elieslt)sruo(r iu1am   nctas aDta(mpot4alx  fetydlm2eauvp;u)treoxr3tytfatr ivi;t)setoio no1lm  mnvsas) Dumump;t1aexomo3tadls2ul( p;u)trenmf oy1omt  nvi s  ruoxr3nodlm  mivsls s2urxronu0tex iocild mDua(msn() rxnxocio1fa elieolt sruoimpou4olenlneta()arta( pnt4ape iietat mDrau snu4tltoio3oydlpt anvs;s tetmio3ny1om emnci s srtaxr ot0tetnmicildfa2rlnmo;t)alxnxrcoodfptrlieslt0 etr(mpoy4optn fcia(  2tau  ;o4aexoif3iadls2emnmo;t4teeoir todoa elueil( teurim ou4amt  ivta(faDrax o;t1oexnmi3tatfsDrl( snu)trenmrctatla   u ols)s2xo(mpoo1am   neil(  rtm(r ;t1oee if3iad m ulums;()texnmr3oadfp rli slt0srtm(o3ny1ll n fvil( sDrm(monu4tlxn i3tyd m2ra(msnu4 ltomrctytfa   ies ()seuoxrpny1lmeelnctat)artmu p;u1oeeomf3tadfs eluvo (4alxoxf to1lmDr u o;t) exo(o3oydap   ncil()s2uau pot4tpe  i3iydlmDumuvs u)trxnxo oy1fat auvo s)t2xr(o iodal elnvi (farrmx ooo1olx mociydfs2eluvo;() rxrmf3iatfpt luei;s)trto(opou1ape mietl() Drr(m ;o4oexniieiyd sDeaumsn(0tetnxf oydlp r nesls)srtoio3nu1lptemivta()sDtr( pno4aetoiieiatfa rl(mpnt) ltrmrciytfptelivi;(0truoio oo4oleemnvtlt)a2trxr oo1opto oeias mDum( p;()texnmrcio1fa rln i s  rxmxm ou4alen fetat s2tmx  ;t0tlt  oeild a2eauvs t0tleoiocto1lp ranes;t) 2xrio oydapen nvtas) Drm(m no0tpto o3iltfm ranmp (4 exrmo iotom e i i s trtoxmpoydlm   fvta(farurumpnu4tlx mictltlaDumnvpn(4artrif3to1fpt lies (0 2uoim nu1apt lnetat  2trxmpno0opeo fciyd sDrl(vo;u0tlenio oy1lp  li s;s sexoim3iodlmtnlfvi s)s2rrxm nt4apeoioeias mDum( on(4 leomr3oytopt luei t  2to(m3nudlp  licil()srtr(roou4olt moetadfs emnvo;(0 exnio tydfp e u ils sexo(r nydlmtn ict ()arrm(r nu4teto feiltfs rlnvsnt4 eermf todomtrlieo ( s2urxm3iydlpt mncil()arurx pou4alxomfeiydfa2ul(vp;()trtnmo tatopDrau ils0 ruoir ny4oleemivsl()aDtmum ot1tptnmoeiltfaDrl(vs u0 rxrir3oytlmD an i;t)trum(o nu1ap n fes s s2rm(rpnu0aexn ociysfs el(vs;() reoxo3to1fp eau o s0 exoirpny4omteliesas) rtrxm oo0olx mieiasfs2emu p;t4 etrio oadfmt  iei s srtrxmpou4aptnmictl(fs2umurpot4alt  ocias mDumu p t0 eerxf3iy1lmt lu slt0t2xmio no1ol e nvi s) 2raur ;t0optomiciysla2uln o t0trtrmr tadlpte ies;() exr(r oy1olt miviltf 2urxmp;u1aptomf3taslm rmuvsnt0tleoio iotopDrauvo s)texoxm3iudop   ncsl() rumumont0ope mi3tysfaDulu onu4arenmo3tydopDrln s ()seuoxm3iu4omtnlnvi tfa2ta(mpoo4oetoioeiad s2ra( p u4 etomr oa1opD auei ()s2xmiopno4amt mnvtas srta( oot0tltn ietad m2uauvp u)tetoio3todoaDr uvo;t) 2xmiopiy4opt  fesa(fsDrax p;t0tle mf3iatla uan s;t4trtrmo oydop eau i;t  exmxrpiy1om elnes sf Dtmumpot0tlx  fctysfs2eau p;t0texnxf3oo1fp rlneo;t setm(m3ny4apee ics tfarrrx o;u0aeen iciat m2ul( p;u)trtnxf3iadfmDrlnei;()t2tmim3nodolt mfcsatfsrtm(  ot1tpto feiysfs2um( o;(0alxrmr tydfm  ln ols0texo(o3no4omeelnetasfaDraxr ;t4tltnifcilslsDem(vo;t)aeenir3ta1lmDrlu s;()s2toimpny1ol n ivsasfaDrrumont1altnif3iaslm rm(mp;(0altnmfciatlaDe n s;t  etmxrpou1aptnlfcsls)arum(  nt1tptoif3tldfa2eaumpnt) eermocty1lmtraivs;t0s2urio oy1openmieta(f Duauronu0olto ictaslsDranvs;(0aeenif3iodfa  an o;t0 exrxo3no1omtemfcias  rtm(mpnu1opxomiciys a ra(vp u0tltrmf3io1optelneo t0tetr(o3iydlmte fes tfsDrmu ono1tpeoifciysfsDra( snu4 rermfciydfaD aneils) euoxrpoy4llt  ncs tfs2urur ;u4aex  fetldfs ea(vs;t) rxrir tytfmDe u o;t) rxo(o3nydopt mfvias  rtmx p;o0olxnmiciydlm rauvpn() renir3tytfp e ivol(0setm(o oy1apee ncias) 2uru o;t4optniocild a emnmsn() exnmo oy1omDraneils) 2xr(m ou1open feia(faDrmum no1apxoioeiyslaDrau pnu4 etrio3iodfaDe u i;t)texo(opno1lpeemfvtasfs2umu oou1aex ifciltfm2emnvp t)texoif iatfp rau o;s)setoiopiydlltnmfcil(fartax ooo0tpxo i3ilsfm umuvsnu4 etrmr iy1op e u ols s2urir3io4lp nmies tfs2taurpot0apeomoctysfa uln sn(4tleoio3oatlmteanvo t t2xm(m oodomee fcsas  2tmx  no4teto ietadlmDua( p;t4trtnmo ia1oaD aues t)srtmxr3ou4lpe  ivia( sDum(m nt4opxnii3tltfs2rlnvpnt4altrir3ty1omDeaivo t0teurir oo1al   feil() Dtaurpnu0ale mfetas sDemump t0altnif3ta1om rlivil()seumxo3iodlpt lies tf rumu pno0apxniietyslm um(mp;u0trxnxf3oadfp r ueols) ruoxrpnydaltn nctat)sDuru o;t1opto octldlmDemu o;t0arxomr3tytfpD aiei ()srtrir3iy4lm nmnvi t)aDta(ront0oeeo feiatlm emnvo;(4tlenmr iydomte iei;( s2ur(o3ou4altnmfesa() Dtau onu4oee mo3tas a2umums;()tetrmo3oytfate u slt)seuoimpiu4lme  ics t)a2rmx pnt4opxomoeiyt mDrmnmp (4altnmrciytla  an il(0tetoxrpoo1am emivta(fs2urx ont4tlt miciytla rmuvp t) rtnifcoadlat an ol( setm(m3iudomen ncsls  rtr(moot4apeoifctltlaDea(mp;(4texnifctytoaD  u o;(  ruo(o3nu1olee fvtas)sDraxront1ope  i3ildfm uaumonu4altnmocoo1fa  auei t trxmimpio4alee icsat a2tmu  ou1tpen i3iadlsDrl( s u0aetoxf3iodla eli ol(  2um(mpnu1ll emivtltfsrururont1aetnii3ild s um(vp t0tlxnir totoa e neo t0trtrxrpoy1ll   ies t s2rrxm nt1optn f3tldfaDeaump;t) ltnxr3tadlpD li s;() 2um(o oy4opee fcsls s2taxroot1tlxomf3iadfs2eanmp;u0tlxrio oydla eaneslt  rxrio3iy4lpt licia() Duaxrpno4apx ioctldls2eau o;(4trenmo oa1omtr i i t0 eur(r oy4lpe licta( a2ta( p;u1tleo feilsfm2elu s (4tlermr3ty1fmtr ues t0srtm(o3io4apenmnvtlt)aDrrumo;o0aeenmoeiadlsDuln s;u4alxrio to1lpt  uvo;t)t2uo(m3io1apt lieils s2umur ;o4tpenioeiat s rmnvpnu)aeeoir oatomteaiei s t2um(o3ny4lmtnlfvsls s2tmx  ;u0tlt mf3tlt s el(mon(0 renif3iotoa  an o;s truoxo3iy4ll nmiesas)s2umxm ;u1alxn i3iadla2uln o;t)artomr3iatomD livi ( t2urxmpno1al  mnvt (f 2raxm nt4olt micild s rmnmpnu0tltrirctotfaD  nesl(0texrim ny1lmen ivsa()arraxmonu1oeenif3iadfs2rau p;u0artnmocoydfp  auvol( teuoio ny4ap  lfvsa( sDum(mpot0tet iiciaslsDrlumo;u) lxrxrcoy1laDe ieo (  rumxmpoudlm nlicta()aDtm(r no4aetnmoeiat mDulnmp;() etoxrciotla eaiei;(  rumimpnodop   netls s2raurooo0oex io3iydlm2rmn pnu0teeoxr iodlmt aivo t0 2xr(m3iu4lmtnmncs sfs2rmurpou4tlxo oeiyt sDulumon()alxrxr3to1lm r u i;s)setm(o oy1lm emfeil() 2tmxmo;o0oetnii3ias s rlu p u0tetomocoytoaD lnvo;s  etmxopny1ope lnci tfaDrmu onu1tee iiciltfs2em(vs t0aexoxrcio1fptean s;t)srumxrpoo1opeemivsa()a2tru  nt4alxomfeiyt m rl( s;t) eeoiocty1op  luvi;s0 etoxmpiu1olen ncias)s2rm( p;u0tptnii3ildfmDelump t0tetnxr tadfa   neo;(  euoxm ny4ll n icias srtaurp;o0aee if3ias s2uluvp t) rtomr iy1laDeai ils0 rtrxm3ou4lmenmivsat) Dra(  ot0alenmieiysls ul(mon(0 lxrxrciatlmtelu ols0srtoim iydllen fcsls)a2raum ot4apt  octadfsDulu s;u0alxnio3ta1omD aivslt s2xrxrpnudap elfeias aDumur ;o0aee  iciaslm2uan p;u4 rtomr iy1latean i;s tetoir no1oleemies s)aDta(  nu0olenmo3tyd a2rau s;u0 exnmf3tytla  aivi;s) rxo(o3no4lm  licsas  rua(m no0apxn fetadfsDea( s;(4 lxrif3oadlm r n i ( sexoir nudlme mncsasfarrmu p;u1oltn fciydfa2ra( p;t4altomo oo1oaDeli o;s)srtrio nodlle lfcil() rur(moot4aeenifeiys mDea(mpnu)texomf oo1lpt  i olt)srumxr3iu4lpt mnvtlt a2umuroou0tpenmociad m2emn p u)trenir oydlmtrluvo;() 2xm(m iydlmt  fetlt  rtm(mp;u0aex  f3tlsfa2rlnvs (0arerxr3oatomtrai s t  etrim3iu1lltn ictltf Drmxm ;t1tpen f3iadla2ranms;u4alxnir ootomt li s s) 2urim nodaltn fetls  2tm(r nu4opxn o3tyd m rmn o u) ltrxr3ia1lmDe ivi s) rxoxo3iy4ol nlfvtatfaDururpoo4oeen o3iltfaDel( s;u0alxrxocoy1oa e nei;t srxoxr3oo4llenmnvtl(  2tmurpoo0tlxn iciyd m raums;(4trxnmfcoytlptr i o ()t2xmxm oo4amtnmnvtas s2umx  nt4apx mfciatls uau o;() reoif3iy1omDraieo t s2trxr oo1omtelfeil(fs2uax oot4aet  i3iydfm el( s u4 ltnmrctytomtr u i s trurir iu4lptelnesasfa2rau p;u4tlx ifciydla2emnmsnt4 reoxf tadoa  luvo;(0setmiopnudlpenlivsas artrurp;t4ole io3tad mDuln p;t4 lxomo iadomtr uvs;t0 2xmxr oo1lle mnet () 2rmx pnt4alxnioeiaslm2umn p;u4altomo totoaDrauvi;t s2xoir3nodame  nvs s) 2rm(root4tpt ii3ilt a emnvon()alenioctotlateluvs;( texm(m3nodlm e ieil(  Durum ;t4texniiciasfa2ea( p;t)arxoxf oydlm e i s ()t2toxo iydllte nvt s)arraumpno4oee ioeiys aDel(mo u4aeermr3iotfpDelieo;t setm(mpiudlpen nviltfs2rrxroot4aetnif3iysfaDeauvo t4 rxoxr todopDranes t0seto(m3ny1llt  ivt tfs2ua(rp;o0tee if3iydfmDeau s () lenmrciydfptr ieo s)t2trio3oy1oltelicilt  Dtrx poo4apx ifeiys s um( s t4tltoxr3iydfmD lu s t0 rxr(m3ny4lltnmicta(faruaxmooo4oeeoioeiltlsDuluvs t0 rtnxfcoy1optr i olt  rur(mpiu1omeelicias) rrr(m ;o1oetn feild mDulumont4alxnxr ia1faD luvs s  eum(r3iu4opee fctl(f 2ua(ront1alenmocildls2uluvont) exnxf3iytlaDean slt)s2trimpio4ap n nvslt  2taxrpno4oexomfctlt m2rmums t0 exoir oydoa e nvsls0setoir3iu1lpt lnviat)aDta( pnu0tet iocias s el(vp;u4tetrmr3iotfateai o (0t2tmxr nydll nlneilt)sDrm( pno0tlxnmi3iltlmDuauvs;(4trtrxfcoy1lp   uesls srxmxrpiu1alt  fct sf Dtr( ont1aleo ietydlm2uauvon(0tlermf3iodfpteaues t)texrio no1altn ict sfartaurp;t4olenmociltfa2uanvonu0 lxriocoytfateaues t  2tmio3nu4op elfvtl(faDraxmpnu4oee mictltfa2elnvsnt) rtrif3oa1lmtraivi;s) exo(opnu4lpte fvsa(fa2rmurp;u4alto ociadfaDrl(vp;t)trxoif3oa1lmD  n il(0 ruo(opoo4lleemicsat srtaurp;u0apxoif3iydls ua( pnt) renmo3todom eluvs ( t2xoxrpnudamtn fviasf rua(r ;o4aet mo3tysfa ran o;(4altrmr oy1optelueo;s  eto(m3no4omenmfvil( aDuau  ;u1olto oeiydfmDraump;()artrircoytfaDranvo t0 2um(m oy4ale miesa( s2uax ooo4teto f3ilt a umu p u)treomfciadfmD  nes;( tetm(opnu4omen ictlsfaDuau  ou0alx miciatfaDemu s;u)arxoircoytlm elieil( srxmio iu4amt mfet t)artaxr ot0aetoioeiat m2um( s (4 lxnmf tydfm  au i ()s2urim ny1ape mnvsat a2tmumpnu1tlenmictldlm2eln on(4tetomociatlatean s;s0s2xrxm no4ameemncs (fsruaumpou0optn feiys sDul(vs t)trermfciotopDeauei (0 2xoiopiy1apt  fes (f Drrxrpou1apeoii3iytfa2emnmon(0 rtnxfctytfm eauvi;(0 rum(r iu4ope mictls)aruau  nt0ope if3iadfaDrm(mo t)alerifciadfp rli s;t0trurio iodlp  mnctl()a2rmx poo4tlx mo3tlt sDrmnvs;u0arxrmr3iodlp  auvo t setrxo3ny4ap nmfvtls  rumur ;t0oexo i3iasfm2eln p;t)aexrxrcoytfaDr ueo;(0t2umimpou4olenlnct sfaDrrxm ;o0tltomo3ilt mDrl( p;()areoif3iatlp  lnei;t0 rtr(m3io1apen ieil(fsrum( oot4tpxoiieiydfsDumums t4trxnif3tatomDranei;s setm(m oydlptnlfeilt) 2rrur ot1tlxomfeiytla rln ont4alxrmf3oatfm eai sl() 2umirpio4ll n nvtl()srra(mo;o1ape  f3ilsfsDumnvsn()trxrif tadlm eaieo;t)s2toim3iu4lle mnvtat a2uaxrpot0tpe mfeiadfs2uluvsnt)altoio ta1opDeau s;t0 2uo(m3ou1alt mfvi t) 2ur(m no0tle ifctltfm rluvo t4tlxoxociytlp   ivo;s0 exrio nu4oltnmfeils s2umx p;o1opxnio3iadfa rm(mp u0 renir totfmD  uvi;t) rum(m3oy1al nlfvtasfaDumumpno1apto i3iyd m2ul(ms;() exrxoctadlmt ai i s trxoio3io4amen iet s aDumxr oo0tpeoifetas s2el( o;u) exnmf iatlm e ieolt0trxmxopiodlm nmicslsf rum(root1opxo fciatfm rlnmon()artrxf3oo1fp r ivi;s0setrirpio4lpe micslt)sDuax oou4aeenmf3iys s2ua(vp t) rxrir oatop  aiei t) exoiopiu4alee nvi s sDurur ;u0tpxnmo3iyd mDuanvs ()tlxnxo3iydopDrauvo;t)t2xmxr3nudom   ncil(  2trxr ;u4aeeomictadlmDra(ms;t4arenmf oytfat  nvs;t) ruo(rpio1ll nlnctltf rua( o;u1tetn oeiytls2ulumo;u0tetrmocoadlp eaues;s)s2umxo iu1apte nesatfs2taxr ;o1texnmieiyslm2eln o (4tlxoiocoytlmteln i t) etoiopnydop  mfcslt)aDraxronu1tpxo ieias aDemu s;t4aetrmrcoydlptr neo;s  etrir3iodlle mnvtas  2rrum nu4optnii3ildls2eanvpnt0arxnio3totla  lnvi;(0s2tm(m3nydam elivt (fsDtm( p;u0olt  i3ilslaDelnvs;() renxo iytfmtelu s;t sexo(mpoo1alt livt ()sDtaxmp;t4aexnmfciyt a rmnms;t)artnir iadlm rlueilt t2xm(m3nudll  mneiasfsDrm( p;u4aet  ociyt aDrmnmo;t0tlermf io1opD li i;s0texr(rpoy4openmfvia( arua(r nu4optnmf3iatla2rlnms;t0tlenif iadfmt aivslt)t2xr(o no4ll e ics () Drax o;o0oltn feiyslm2el(vo u4 etrir tatla   ivo;( teum(rpoo1lp emncslt)aDrru p;u0opt  iciltlm2rmumo t0 rtrir3tydoaDrai o t)s2trxr nu4omtnmfvs sfartru p;o0aex io3tysla ea(mpn(4aexrio ootfp rlnvs;( t2trim3iy1om   iei s a2rrur ;u0ape  ietytfs2emumo (4tlxrxf ia1lmte i slt seumir no4ome lnctat srum(mo;u1tpx  fetatfa2uln o (0 rxoiocto1fa rluei;()t2triopoo1altnlncias) 2umumpoo0aleomo3iatlaDum(vo () rtrmf3iotomtr neilt) exoio3nu1llt lneilt)srtm(ro;u0ole  f3iat sDeanvs (4texomocoydlatelu o s)s2urxo3iy1lptnmict s) rtrx onu0alxnmi3iydlmDeluvo;t4trxoif ta1fpD luei t seurir3no1lptn nvi tfarumx ooo0olen oeildfa2ul(ms;u4trxnmr3totfm eai o s) 2tm(r oy1lleelnei s)srum(mpnu1apen ictas mDuauvo;t4 leoxf tadoaDelneil(0srxoxr iy1ale lnctltfsDua(r ot0tpeoii3tys m rm( s t)aeerxr totfm rlu il(  2urio oudolt  icia( aDtmur ;t1tee mfeiad m2um( pn(0tltrircoy1fpDraies;() 2tmxo3iudopee ict s s2taum ;u0tpeoifeiytlmDemn p t0tetniociytlp  lu i s0srxrxopiydal   ivta( artm(m ot4tetoifetad m2emu s u0 renircootfptr ies (0s2toxm oy4lpt licia( s2ta( pno0tpe mi3ildfaDrmn pnu) eeoir3iytfm e ivs;s  rxo(m no1ameelivsls)srtr(m ;o1oexomfciyt m2umuvp t4teermfciydfmDeaneo t0 exrio3oo4lpt lncsa() rtaxmo;t0teeomicias a2rlnvs ()arxoxfcoytfptrai s;t)srtmir oudoltnmncs ()sDumumo;t0aexn i3iyd aDrau snu)tetnio3ia1oaDelues;t)setoim oy4om elicia(  rurxm ;t0oexo i3tydfs2umums ()altomocoydfm   neolt s2umio3oo4omtelfcs () rrrxront4tet mociytlsDrmu o;(4 lxoir3iytlpD lnvs ()s2xrimpio4lmeemnviatfa2ua( p;u1opxnif3tltfm2rl( p;() ltrmf iytlptelnvo t)srxmxr nu4amt mfcsl()a2ra(  nu0aet iiciys s2rluvs;(0trxnmo3tatfmDr nei;(0trtm(m3oodal nmfvsat)a2ua(moou1teto fciydfm2ea(ms t) etnio3ootlptrli o;(  etrio nu1lpeelies () Dur( p;o1ale  f3tls m ul(vp;t4altnmrciatfm r uei s)trumxo iu1altnmivi t srurumpot1tltomieias m emn pnt0artrxo oadomD  n i ( trumim ou4lm nlfet (fs2taxmp;o0opeomociydfm2ul(vp;() reoif3tytoaDeli ol(  etrxo oo1opte ics (fs2uaum ;t0tltnmf3tatfa eanvpnt4aexomo3iytlmtelueo;( srurxopio1al nlnet sfsDurxrpou4aexomietldla2umnvo;t0tlxrmr iotlmD  nvo;(0teuo(r io1omte fciatf rrm(r nu0aeeo iciadlmDraumsnt0arermrcoo1fm  lu o t) 2xoir3nodapte ieias) 2um(rpoo4optomfctls a2uauvo;(4 rxniociytlat aieo;s srxm(r iudalte fetltfsruaur ;o4tetn oetas s2eanms u4trerxf3tytfa r uvil(  rxr(r3io1om emneiltfs2tr( pno0tptomoetldfmDrm(vsnt) lxoir3tytoaDe i s;( t2umim3iydam n ivt t) Drrumpno4aleoifcildfmDeauvpnt0 ltoif3tatop eli sl(  rtmimpou1lm   fetat) Dtrumooo0tpt  oeildfs rm( o u0trtnmrcoo1fmt  nei ( srxmim nu4lltemieia(  2ur( pot4oeeomiciyslm uanvs t4 etrmrciy1opDrlnvils0t2xrxrpoy4apenmfcsas)srtaumpoo4opxnmo3iad s2ul( p;u0tltnio tydlpteau o t) rxrir3ny4lmt mivi tfsrtm( o;o1alxn o3iadla umn pnu4trtnmfcia1om r neo;s  ruoxm ou1lltemfcs () Dtrumont0tleomocils mDea(vs u)teenmr oatfp   uvsl(0trumxr3no1oltemnesat)arumuro;o0tetn o3ild aDrauvsnt)tlxnifciytopt aieo;t  ruoxmpiudlpe lfviasfaDtm(m ot1aleomieiad m2emu ont)aetrir tatfp  aies (0trur(r oo1lp  mics sf rua(mono4aeeniiciytlmDrluvon(0arxrifcoydla rlnvo s t2xr(o3iy1lpenmnvils  Draurooo4ale mf3tasfa2rln p (0arxoir3oytlaD anvsl(0teuo(r io1am emies tfaDua(r ou4apto fetld m2rmn p;()arenir3iytlateauvsls0 2urirpnu4ll nmfcsa(farur( poo4opxn fctat sDra( ont4texrxr iatoaDran i t0 etmxmpiudlpe  nctatfaDtm(rpnu1olt ifeild a2umuvsnt)arerifctadoaDrlueol() 2xo(r iydape lnvtltfarta(ro;t4ale  icild mDem(vo (0aexrirciotom r neols0sruoxm nudap e nci s  2raxronu1tex  f3tydlm rmn s;() lxrxr oatop  au i ()trtrxopoo1ll n nvi s)srta(  ;t1aexnio3ildfa2emumont4aexoircoo1lmtrlu s;t  2xr(rpoo1lpeelnct tf Dtmxmp;o0ole mociys s rln s t0trxnioctodom rln olt s2xmirpoo1ap   iesa() 2raxrpnu0aetoioetatfaDea(mp;t4trenxfcta1lpt auvi s s2urirpio4amenmivtlt)arum(mo;t4opeoioeiadlm uaump;t4aexoxr3ootom  lieo t  2uoir3ou4ap e ncslsfartrxm nt1oetnmieiaslsDelu p;u4tleomrcio1lmD au o t) rxrxm3nu4lle lfctas  Dtauro;o1teeomoctlsfs2emn o ()alenmrcoodlptrlnvo;s0s2trxopio1llt  ivtasfaDur(rpnu0ole iicias sDrm(vs;() rxomo3tatop eln s;()teuoio iu4ape liei sfs2taum oo1ape  i3tadls uau p t) rtnioctodoaDeanvi;s)t2um(mpoo4apee ietasf 2urxroou0aptnmfetldlsDumumo ()texrmocoadfm ranvo (  ruoxm3nu4op nmicsls s2urumpnu0aleomf3ilsls2uln p u4 eeoxfciydfa eau o t)trtoxo io4al  miei ( sDtaxmont0opxomietytlsDeau p;(0trxomf iatoat  uei t)truoim3iu1lpen nvias) 2um(m no4tet  oeiatfm2eau pn(4altnir3oytopDrlieslt  2tmxm iu4lptnlncsl()aDtmx pnt1teto feiasfsDemuvo;()trerxocoodopDr u o;s) rxoxr3ny1lltn icsa( arrmxm no1oetomiciys m2rln s;()alxnxfctatop  lu o ( texoir3io1omtn fvsa()aDua(root0altn i3iytfa umnvp;(4aetnmf oatlpteau sl( truriopiodlm  mfesltf rumx p;o1altnifeiytlaDel(ms;t4 eenio3tadoa  aieolt) etriopoudlpenlnvt tfaDtm(m ;u1oexn i3iytlm em(vs t4 lxrmrciatomte u s;(0 etr(opio4amt  ieia( artrumooo1tpenmfeiysfaDrm(mo u4 reriocio1om rauvs s  2xmim io1op e fvsasf Drmu  oo0oltn i3tys aDea(vp u0 etnif iatoa e i ols0trxmxm iudoptemfvsat a2tmxrp;o0opeoioetatlmDrl(vs;u0trermr oydfp ranvil(0tetmxmpnu4op nmnesltfs2rr(r oo1tpxnmfeiyd s2el( p;t4aetrio3iotomt lnvo;s)tetr(o3iy4alt mnes s)arumurpoo0ape  o3iytfa umuvpnu0tlenxocoo1fpDelu ols0seto(o iodlmenmiesatfa2tm(r nu0oeenmieiasfa2ra( s;u0aexnmr3to1lm e nes ( trtrxr iy1am emfeilt) 2uauronu0olt  ocilslm ua(mo u)alxomr3iatlpt  ivslt)s2tmxm3oudlpe mncilsfsDrruroou1opeomietydfm ranmo (0arxnmf oytfmDrauvo;()trxoxm3io4al  miet s  2uru pno1aptnifeiytlsDum( s;(4arerio3ia1fp r n il( srtmim3oudomtemnvtl()aDtmx oou4aexniociatfs rm( pnt0trtrxf3tytfate iei s0 rxm(rpio4aleelfvsas  2ua(ro;o4opxn f3tlsla ulump t4areoxrctotla e n olt)srtoxrpnodol nmivilt  Dtm(ro;u4apt  ieiatlsDea(ms u)trxrmo totfa  lnei ( trurxo nu4al   nvias) Duax p;o1tlen f3ilt s uln pnu4teeomr3iydom   n s;t0t2uo(m no1op  mfvt ( aDtmxro;o4olxoiociys a uln o t0aeeoifctatoa   uvs;t seuo(rpnydole mieta( a2rax p;t1aet  feiatfs2umnvsnu4aexrmf3oytfat luvil()t2ur(m nydlpt mfes ()s2uax  nu1tleo i3iydfm2emu o u) rxnmr iy1laD  nvils0srum(o iy4opt  nvi t) Dtm(rp;t0tlt  ieiys s2rmu s;t)aetrxo3tytfat  uvsls t2tmimpny1aptnlies ()srtm(rono1apx mietlsfa ulnvs;u0tlxnmfcootfm   iei;(0 2xrxm3nudamtelfcilsf rum(rpnu4oet mo3iaslm rl(mo;(0trtrxo io1lmtelies t0texmxrpoy1al   ivsa(faDtm(mp;t1oet  ociasls2rmu o t0aexnmr3ia1lp e ueo ( srxoxo io1om  livt (fs2ur( ont1alt iieilsfa2ran sn(4texomo ta1om  livols tetrim oy4lptnmfctlsfaDtaurpot0tex ifetatfaDumuvpnt0trenmf todlpDeai o ()texoxm oo4ap n iet s)arrruro;o4aetoiicildlaDrmump t4 lerxo oy1om  lnvol()trumxrpoy4ale mneias  Draumpot4apt  f3tyd s2ua(vp;(0altrmfctodfmt aues (  rxr(o iydomeelfei t)sDur(ro;u0opxoioctlsfmDum(vo;() rxrir3io1fp raies s0srur(r3oo1optn nesatfsrum(mp;u0ope mo3tldlm ul(vont0 leoxf iadlatrai s t)trtm(rpoo4ap emfvs t) rra(root4olxn ociysfaDeaumont4trxrxf3oatfpDrlnesl( truoxmpnodaleelnvt sf rururpou1tpen f3iadfaDea(vsn(4aexoircio1op  anvols seum(r ny1oleeliviat  2rrurpnu4altnioctatla rln s;() exnif ty1opt  i o s  etm(rpnu4olenmivt t)aDtrx  ou1tex mfeiytfaDemuvs;u0aexnmf oodoatrlneols  rumio3nu1lp nmietat arrm(ro;t1tpen i3tat s ra( pn(4 lxnmoctydlpD lnvslt)sexoxr3oudap emnei s a2tr(  ;t4teeomfctydfa2rmuvp;u0arxrmr io1fmDr n i s  2uoio iydlltnmictat  Dtaurpot1alenifetls m2uanvont) lxrif totlmDe ueils)t2umxrpnydale lnei (fsDtmxm ot1tlxomociytlm ua(mon()altoxf3tatoatrln i t0 etoxr nodlptn nvsat sDtrxm ;u1openmo3iytfa2eanvsnt0alenmfciy1fpt  ues ()t2urimpiodll elfciat  2rau  ;o4tetnmo3iasfs rau pnu4alxrif tytoaDelivils) exmxr3iudamt mfesl(  Dur(moou4optomietyt mDrauvo;(4alxnxr3oydfp rlu slt) eurimpou4op nlivs (fsDurxmo;t1oee iictyd s2rmnmo t4alenxfcta1oaDrlu ilt)t2xo(r oydalenlnci (f rrm(r ;u0tltnmoctld mDul(vs;(4 ltrif3iydlptrlivol(  rxmimpny1omenlieils)aDuax  ou4oetn ociltfs elumsn() exrxr oy1oatelnvs (0s2urxr3nudopenmics tfs2tr(ro;o0aleo f3tltls2ua(vs;t4tlxrircta1latelnei;( trxm(m3iy1ol emfcilt  rtmu pnu0alx ifeils sDrmn p t4arermo3oa1fpDr nei;s0srxoimpiu4omeemnvi sfs2raxr ;o1oeto i3tytlsDea(mont)aexoxfcoo1oate ivil( teumxopnodamt mict s) 2umxmont0tlxo ieiysfmDum( s;(0tltrifcto1lmt luvils0srumxm3nu1lm   ics tf Dtaxr ;t4texo f3iyslm2rmu on(0aetoxo oytoa  lnvils0sruo(m oy4lpte ncs s srraxmp;t0alxoio3tlslaDelu p (4 lxnmo ty1omtr i o;(0sexrirpoy1lpeelneiltfa2rm(rooo0tpe mfeiytlm rm( o;t4aexomrcoydlm rln i s t2xoxr oy1omeelfeiatfs2tru  oo4apxn ieils a rmn snt0alxnif3iodfaDrau ils0trumirpny1op e ncslt)aDumxr nu0apenmi3ias sDemuvpnt4 ltoio3tatfmDeau sl(  rumio oodop elivi t arum(rpno4oetoiocildfm rm(vs;u4alermo totopDe i ilt srxrio3ou1op  lnvs ( arrmu  ;o0alt mi3tasfm2rmnvont0arxnxo3ta1latrlueol(0t2uriopio4lm  mictl( a2taxmoot0tpe  o3iadfa ulump ()trenmf oytfa eli i;t0 eumxopoodomt mfes (fsDtm(r ou0oltnii3iadfs rmumo;() exnmr3tatoaD aueilt0t2tm(r iu1lmtnmfcs (  Durxmpot4aeenioeiytls em(ms t0arenmfctotop eauvi () 2xoxm3oy4apen nvsat  2rr(mpot1tpen ociatfmDuau p;(4tlerir io1lpt aieo;s0srxo(rpoudome lfesl(  Duaxront4oee  fciltfaDulu snt0trxrxf oydfaD aivil( teumir3no1olenmfci s  rtau  ;t0texnifeiyt a2eln onu0tlerxf oo1omDelnesls)t2um(opoydol emnvt ( aDrmxrpot4oet  o3iltfmDrau p u0teerxf tadop   i i;s0tetmxrpou1oleemfct t  Dur(  no1apenio3tltfmDrm(vp;t4tlxomoctadfp  li slt)teumxm oodamtemfcsas aDua(root0tlenmieilt aDumumo;(0tlxoxrctydfm eaueslt0 rxo(mpno1am nmict s) Dum(r ot0aet mictlt a2ulnvs;t) exrmf oatlp e iesls0sexrirpnudlleemfvs s)a2tr(rooo0tlt mfetlsla2eau snu)aexrmf to1oateanvo;s)setmim3oy1op  mneil()arrm( o;t1aeto oetlt s rluvp t4 exrir3tydom rlivs;s) 2toxr3oudape lnesasfs2ur(  ;o1aex  oeiasls ua( s u)trtnxf3ia1lm  an sls0srtoxo3ny4ome  nvt s) rur(mo;u0tetomi3iltlm2ua(vpnu4artoircoatlm eanvsls)tetmim oo4opt livslt)a2uax  nt4apx  ociad a2emnmp;t)alenxr3oodfpDr uvo t)trtmio io1omtn ncsls sDtr(mpno4opxoioeiyd s2uau on(0 exoio totlptelivs ()srtoio iu4lmtnmfvs t aDtax  no0apxnmfeilt a2ua(mp;u) lxnxo oodla eli i t0t2um(r3ou4ome mietl()aDtrxr ot4tpt iiciasfm emn pnu0 eerif3oodoat livo ( trur(r3oy4ope lici tfa2rmu pou0aeenifeiydlmDuanvs;u0texnxo3tadfmteanvs (  etmxopoo1openmnes t)s2tmxr ot1ale if3ilslm rmump;u4tetrmrciytfa eanvsls  exm(o oy1olen nciltfaDrm(r nt0olt iictlt s rm(vp;t0trerxo oodfa  anvi s)trxrio nu1llt lnct sf ruax oot1aetomoctldfsDrmnmpnt)altrmo todoaDrli o;(  2uoxopoo1ap nlici s s2rm(mooo1aex  o3iadlm elu snu0 renif3oa1laD lu s t)sexr(rpny4lmtemnct tf rtrxmpot4teto fetydlaDumu on() exnif tatfat li olt0 rxrir ny4omte fvta( srta(rono4aee moetad a2eaumo u)arxrmf oatoaD  uesl( srxoxm oudlptelncsl( s2tmxro;o4alxniieiat m2eaump (0alermo oo1fpteanes t) exmio3ny1lptelnvs s) 2rmxmooo4oeeo iciatls eln snu0aeeoif3oydfat  ivo () 2to(r3oydome lnctl(f Dra(mpoo0alxnmfeiltlaDul(vp t0tlxnxrciytfp eauvo t sexriopiudome mieslsfa2tmur ;u0tetn ieiyd sDum(vo;(4altnxr3oy1lpD ai ilt) rxoirpoo4omtemnvslsfs2rm(root0alxniociydfs rm(ms;t4 etrxr3todlmDelu s ()sexm(rpiy1lpt  ivi s)s2urxrono4opeomfeild mDemuvpn(4aleoifctatfa ran s;s srtoxo3iy1lp   fctltf rrmu pnu0tle  oeils a um(ms u0 rtrmrciydom  lnvi;(0t2to(r io1aptnlfvt (fsruaum ot0teeo oeild m2um(vp (4tetomfcoytopD lueo () eur(opnu1open nctls) 2uru p;o1tptnioetytlm rl(monu4trerif3oatfpDraiei s)sruo(opoy1opee neilsfa2umumono0altn f3tydfa rmump;u0 eenircoy1opt lues;()tetm(m3nudam nmivils) rraumont0optnif3iydfs ranvo (0tltoxf3tadfp eanvs t sexmxmpiy4lmtelfetlt  2tmu  ot1tpenmiciyslm2umn o u) rtoxr3oydlp elieo t s2xmxopoudllen nvils s2tau p;o1apeoifeiytfmDemu ont0tetomociytlptraivo;s  2to(mpnodolte fvs t  Drax  ;u4alt if3iytfa2emuvs (0 lxrmo3oy1fpD lieo;s0s2trxm3iu4olte nctas)a2ur( p;u0oex  o3tat a2eln s;t0 rtrif3ia1lm e ueolt t2uoxm oo1llt mfetlt) Draurpou1alenmo3ild a ua( s;(0 exrxf3tatfm r n o t0 euoxo iy1lm   neils)artr(r no1olt mo3iytla emuvp u) lenio iydlaDr nvi;s)s2umxopoy1olenliei ()aDrmumo;t0tpxnmi3iysla2rm( snu)artomo oatlpDeli s;( trto(m iudlpenlnvta()a2raumpno0aetniieilsla em( on(4artrmf oo1fmD livi;s0 2toirpny4lpte feta()sDrm(mpnt0oee mocilt s2umums (0trenirciadlm e nvo t) 2umxrpiy4ole lncil(f rurxm ;o0oleoioetldfm2rluvsn(0aetrmoctytlm eli s t sexoxopou1omt lncsl( a2umuronu0tlx mo3ildfm uluvpnu)aexnmr oy1latean i;t0s2uo(r3iydap emneil()aDrr(rpou4alt mo3tatlsDumumo (4 ltrircoadfmteaivol()t2uo(m oodam eliesls)a2rrum nu4aetomi3tydlaDelnms;(4alxrir oadoatr u ols0trumxr ou4al elfesatfs2tmu p;o1opx micildls umuvp;(4artnir3totlptrauei (0tetm(o iydopen nvs t) Draurpnu4tlt miciadfaDulnmp (4arxrmrcoo1lmt  n i (0setoiopiy4omte fci tfaDurxm nu0oexn f3ilsfs2um(vpnt)altnxr3ta1fpteanei;t teur(rpou4aptn ivs ( s2ur(  ou0tpeo o3iydfa rluvo t0altnmr3ty1lm eaiei;s0 2urio oudll   iesasf 2umxm ;u1aexnmi3tatlaDrm(mo;t)alermo3oodlpD luvs;t) rurirpoydaleemnesls a2rmu ont0opt mo3iys a em(mo;u0tltrmf3totfm  lu o;( texrxo3iy4lptnlfvtls arrrxr ou4oetomf3tas a2umu o (0trxomr iadoa r ivi t0s2xr(r io1lpee fvils)s2umurpnt0tpxnmoeias s ra( s;t)arermf iydlmDelieolt  exriopiy1lpte fetl( srua(ro;u4oeto feiytfa rau p ()altrif oadfmD  iei;()srxoxo nu4lle mivil(fs2ta(  ;u1apenifeiatlm2rmnvo;t0trxrmo3iy1oaD aneils) rxoxr oudol e iciat)aDum( pno4aexoiietlt sDelu p;t)alxrio3tydfa eau sls0 2xmxo3iydom  mfetl() Dtr(  ;o4teeoioctaslm2ul(vo;u)arxrxociodopDrau o t) 2xm(m3oudlm nlnvil(fsrtr(mp;u0aexnmfciytls rmumo;u)arxrxr oydopte n s t  exo(o3nu1lm   nvsas)srumumo;u4aet io3iydfa el(mo (4 lenmo3iytlaDeli o;s0 2umio iy1lle  ivs (fsrtmumooo0olxomieildfm rlums u) rxoif iatomtrln ols t2xmxm3nu4om n fvt (fsrrmur no4tle mo3ilsfm2rmnvp;()aexnmocoa1fp raues;( t2trimpnydam n fcilt)srrm( poo0tptn ictas s2uau o;() rxoirciydfmD  nvils)seuoim3oudaptnmivslsf Dtmxro;u0ope iiciad aDean snt4aeenmr iotfm rlnvs;( t2xo(rpoudlle livslt  2tmur oo0teeomf3iysfm2emuvpnu4altrif oadoa rlivi;s0sexm(o3ny4lptn icia( sDtru  ou4olx iieiltlmDrlnmo;u4artoircio1om  liei;t0texmim3oy1amtnlfesltfsDum(mpno0aexoifciydfa uan p t4aeerxo io1la rlnvs t0srtm(mpoo4ameemnvsat) 2trx oou0tex mo3ias s uau s;()artomr iatop   nvo t srurxm3iy4lmt mnctas  2uax p;t1tlen fetlt a eaumonu0arenxo3oy1fpDr n sls seur(m3oy1apt lnciltfs2rmum no1oeeo ocilsla2emnvo;t4tltrxr oatlatrluei (0srtmxm3oudamte ict () 2rm(  ;o4apxomfeiyt a2ra( p;(0tlxnir todomt au o;t) 2trir iy1altemnvia(  Durumo;o0aeeoif3tlt m2emuvs;t4trenxf iodfa e nvi;s)t2xoxr3oydomtnlnes tfartmurp;o1tpeo i3iysla rm(mo;(4tetoxf3ia1omD ln i;( texm(r3oy4oleemnvi sfsrum( pot0alenifeilsls2rl(mo u) etnif3oytoaDe i i;(0sexoxo oo1optelieil(fs2tru o;t4texnmictasls2ulu s (4aleoxo todfateanvol() rtm(o3oydameemicslt)a2tmxr ;u0tee ii3ilsfa umuvs;u)aexrirciy1fatrlu i s)srxoir3iodome lfei sfsDtrxro;o1alx ifciyslsDrlnvs (4texrxrcoa1lp rluvi s)s2toim iy1am elnctatfartr(mo;u0apxomiciydlmDrlnvp u4treoxf3ty1opDe i i s) rur(m ny1ale  nvtlt)s2trxrono0tee moctatfa umn o;u0trtnio totom rlueil(0t2uoim io4lptemnet tfsrrm(mpnu4apt iociltfm2rmn s u0tltnmr iatlptraivslt0srumxopny4ape  icias)sDrr(m ;u1tpxo fciasfs2rmu s u)tltoxr iytfpt  uvi;t setrxmpoo1lp nlnesl(f 2rmuro;u4tlxniieilsls eanvpnt0aleriocoo1faDraivolt)t2tm(mpnydolt lnesas)aDrmum nu1tle  i3iltlsDumumo;() lenxocoa1oa rlueo (  2tm(m3iydameelnesltfsruaurp;o4oex io3iasfs2umnvo;() eerxf oytla r ueslt0seumxr3iy4alen icia(fa2uaur nu0aet if3iadfm ua(ms t4tetrxo3oadomD livols)seurir nu4omeelnciat)a2umxroou0teenmo3ias s rmnmp;t)artoir3oytlmD li i;s0s2xoimpny4opt licias) Dtaxmp;o1texn octytfaDrlnmo;(4tlxrxo3totfp  aieolt t2xmir3oy4lpeelieiatfs2uaxroot4oleomfcildfmDua( s;(0alxoxf ootopt  uvs;() exoxo3iy4amenlneslt  Durx ooo0tlxo oeiydfs ul( on(0 etnmrcoodlatrli s t t2xm(r iu1ale  ivia(  Dtrx o;u4olenioeiys m ua(vsn(0aetnifcia1fatranvi t0teuoio oydlltn fetlt)s2trurpnu4apx mfciydfsDranvon()alxoxfciodfaDraivo;s)trur(rpoodlpe  fcils) rurxr ;u4tlxn octltla2rm(monu4 reoifciydfp  lu s;s)srur(opiu1lp e fvtltfaDrm(moou1aexnmicilsfsDum( o;t4trtomf3oy1omD lnvo;( texm(m oy4op   ncilsf rtau  ;t0tpt  ietasfaDemuvs t4alenxocio1om eli sls0trxrio oo4ole lietas  Dumx pnt1teeoioctlt s rmu o;t0aeenir3iy1lptrlneils)srtr(rpou1om n nctls srtmxr ou4openiieiadfmDra( p;(0 lxrmr totfm eanvo;s0 euoiopiodaptn icslt sDtau  ;o0oeenmoeiyd a um(von(0 leoxf3iatomDrluvi;(0s2tm(r oydale mfvsa(  Drmu p;u0tltomieilt aDrlnmo u)tlxnif3oydlateauei;t0srtmir oy1amtemnvt t) Duax  nu0tpxnifeilsfsDeaums () exomocia1opD auvols0 rxo(o3oy1op e ivi t sDurur ou1teen feildfa2ulumo;()texrirciydlatr i ilt0trumxo3no1ol elncils)srur(rpno4alx ii3tld m rmu s;t4teeoifciodfa eai slt) rto(m nudlpe  neilsfa2trumo;o0oltn oetydlm rauvp t0 leoxo ia1omD lu o s  rxrio no4omeelfcsas) rumuroot1opxnii3iasfs umump;(0altoxociodfpteaieslt0 2xr(o3io1apeemfvia()s2rrxmp;t0aptoii3iaslsDrm(msn() ltnmf oatfpDe u o s texoxm nu1lpt lietl()a2taurpoo4tlxnifciytfs umuvp t4tleomf3todopt  uvo;()trtr(opou4omtnmiei (fs2ua( ono1tetniicild m ua(ms u) rxrmo ootfm e n ols  2uoir iydlp emfesat  2rm(mp;o4oexoii3iyt s emu s (0 eeriocoadoat aneils)tetmir3nodlp nlics t)srumxro;t0oet mo3iasla2emumon(4 eeoio3oatlatrlueil( tetrxo iu4ap elnvtat sDuau pno0olxnioeiysla um(vs;(0treoiociotfm r i sls texmiopnydap  mfei t) 2ra(r nt1tptn o3ilsfm eluvpnt4 exomo3tydopt  neo (  rtmir iu1opeelfesl(f rtru ont1oexn fctydfmDeln s t0alxoio iy1omDr ues s texmim3ou4lleemnesl(fs2tmx p;o1oex miciad s2el( o t) rxoxr oatop elu ols) 2um(o3nudap   neslsfsDraumooo1tptomietat a uauvp u)trtnxr3tydfm  lneo s tetr(r iu1opte icilt sDtaxmonu4tpenifeiltla elu on(0teenir oatlmtrln ol( srxmio3iu4omtnlictls)a2rrur ;u4ole ifctyd a rl(mon() ltrmf oy1fp rai ilt0trtoxo nudlleemici t  2trumpot1olx io3iyd aDeluvs u4tetnif oo1op   u olt texmir3iudlp emnetasf 2tr(  nu1tle iictytfsDulumo t0teeoxociotopDr uei;t0 rxoim3nu4apen fvils)s2trum ou1ale mo3iyt a2umn p;u) rtoxf3ia1lpt auvo;t  exoir iudom elicslt s2trum nt1oetnif3tadfa2emu s t)tlxoxr3oodom  auvs t)srxrir ou4aptn neta()sDuru  nu4tet  ociad s ean on(4tleomo iodoaDr u o s s2urxo3ny4am  mivia() rtr( o;o1tleomf3iytlm uaump;(4treomo3ta1lat aivols0setrimpoo1alenlivi t srta(  ;o1alxn f3tltla ranmp ()aexomf ia1fm rauvo;(0texoir3iudope mfvsls) Duau oot4oexn ieiaslm2ea( p (0aetomf tydfate u s;t0setmxopoo1ole  nciasf 2rmx pnu1ape mf3tad a2eanvp t) ltoxfcio1latrlnvo;t0s2toxrpoo4alenmnvt ( sDra( o;u4aptn i3tysfm2emn s;(4trtomf3ty1la eai o;t) 2tmxopoy1ame licslt aDra(r no1olxoioctatlm2rlu s;()arxrxrciodfatr u s s0sexmxo oodamtemnct ( a2ur(m oo1alx  fctydfm el(vonu4tltoiocootfp ranes s) 2umir oy1ap e fesls) rur(  nt1aetomoetytfaDem(vsnu4altnmrciy1lat aies;s0t2ur(r3oo1ll   ivs s srtm(r ou0tpto o3iadfsDel(mo u)aetnxrcty1opt lues;s0tetoir3no1omee ncsls) 2urxm ;u1tle  oeiyt mDea( sn()aexriocoo1la   nvs;t)t2xoxm3iy4lltnmivs ()srtax  nu4alx  o3ilt sDul(mp t0trtrmf3ia1fp eai ils0 exoio3io1altnmivtl(fsrtru pot4open ietys m2rmnvsn()alxnir oo1lmDelnes;t) 2uoir3ny4altnmncs s) rua(roou0ale iietltfmDea(mo u) etoio3oa1lmt  u o;t0srtmxr3oudap emncsat) rta(r ;t1tetomoetytfs rl(vp ()arxomfcoy1lpDeln ol()t2xmir3nudapenlicilt)artru ooo1oleo ociyd m emnvpnu0 rerifctodfp rln il()srxo(mpnydlp  lnes tfartrx  ;u0aeeomfeiadfs2rl(msnu4 renxf3oydlm rluvo;(0s2xoxr3nudom  lfviat) 2tr(  ou4oeeomo3tyd s uanmont4tlxnio3oatlaD  n sls teurim iudopen nctlt aDtmx o;o1tptoiociaslaDrmuvsn()tlermr todlaD au o;t) eumxr3oodlm n fesltfaDur(ro;o0optoifeiat sDumnvp;u4tetrxfcta1lm   u s;()srto(mpnodol nlfvi sfsrta( pnu1alxnmfciys m rlu p;(4tltnmocio1fptr i i;()texo(opiodlpe mnetl( sDtaurooo1teen iciatlm2eluvp;u4trtoif ty1fm r uei;s)trum(r oudam  mneiasf Dtrx oou0aet ifctadfa2eln o;(4arenxfcoy1la   n o;s0t2uo(mpiy1lptnlivias)a2trxm oo0tpenmocildla raums t) etnircto1op   uei;( s2urxm3oo4ole mnci s s2ra( oou0optomicilt m rm( o ()artoir3tytlp e i o;(0s2uoim ny1lptemictltfa2uau  oo0altn ocilsfa2umnvp;t0aetoxrcoodfm eli i t srxrimpoudll n ieils) Dua(mp;t4oleo fetlslm emuvpn(4tltnif tydfm rli olt0setrxo3no4op e neias)sDrmu pou4opxo ieiadfm2rln s;(0arxrif oytop  anei s)s2xo(r3no1lmeemicsls a2tmurp;t1tetn f3ildla em(vp;u) lenmf3totfmt luvo;(  rtm(r oydopenmfes t aDta( o;o4tptomoeiad aDrmnvo;u) rxriocto1lm e neols0texrim ou1ol  livia()srra(mp;o4opto feiyslaDrl( o u4trenmr3oatfateau s s) etoxm no4lp  lneilt)sDumurpoo4tpenif3iytfm2em(vo u4tlermfctotom rlues t s2uo(rpio4ope mfcsltfarrmur ;u0tlx  feiydlm el(vs t)tltoif3iodopt  ueo s)texmxr iu1optnmncsa( a2rr(r oo4altn i3ildfs elu o u0teeoir oydfat aieo t0 rumim oy4lm   feslt) 2trumo;u4oex mf3iyt a2ranmp;(4 exnxo3iotla eli i;t) 2xmio oo1amenmfcsatfaDtmu ooo1alxn o3tytls2emn pnt0 renxo3iy1oa eau i s) rxriopou1olt  neilt)aDuax o;u1aptoiictatls ua(vp u) rerxo oy1fatraneilt)srtmirpoudoltelivs ()artmuro;o4olt  ociasfm2umnms;(4aeenxf iadfmteai s s seur(mpoy4ame lneilt artr(mo;t1texo feiytfm2emums t0arenxo oo1fm raueol()t2toio3ny4lpe mfcilsf 2ur( pnu0olxoifetlt mDeluvp;(4 eeomo3ty1lm rauvo (0 2toxm3ny4lmte ictlsfs2tmx  nu1tet miciys s2ua( s ()altrmo tadlpteaivil(0sruo(o3nudapeemies s)sDra( ont4alxn iciadlaDrmn p;t4tetomfcta1opDelnvs t0trxoio ny4olte ivsl( sDrax oot0tex if3ildls rl(ms t0 lerio ta1fat lueo;s) 2xoxmpnudamee icsasfs2taumpno0tetoif3iltfm2rm(vpnt0tleoxr3iodfaDr u o s) rxr(rpiu4lp n ivia(  Duru pno4tex moeiydfmDul(mo;u4 rxrif iatfa eanvol(0tetm(opio1ape  fvtat)s2taum no0apx  f3iaslm2ua(vp;t) eenxfciodfp  auvolt0texoxopoydom  mici t) 2tauroot0optomoctld aDemu onu)texrif3tatlpDe nei;s0 rtoxo3iydapenlfesl()a2tmx poo1aeen ociasfsDemnmo t)areoirciytfm  anvi;()srtriopiydolenlfcs t aDrauro;u4apenio3iasfm ea(vo;t4areoxfcootlptrln i s seurim3nu4olt mictlt s2rax oot0aeenif3tat sDeanvp ()alenmo3iodop eai il(0s2xmir oo4lmt  fesl(  2rax pnt0tltnmoctasla2rmn o (0aetomr ia1lptrauvo t)texrio3oydal nmfvias arrmumoou4tpxo icilslm em( onu0 ltoxr iydomDelu s;s srtmimpoudll eliei (  2uax p;t1optn i3iyd sDrm(vs (4 etoio3iy1lm  aueslt)sruo(m3nudamen fetasfa2ur( ont1olto feiytlaDrlump;u)tltnxr3oodlpD auvs t teur(r nu4alen ict tfsrrrum ;u0texoifeiadlaDumuvo;() lxnxfciytlat lnvs;t0trumir3no1apeelncs sfsDrau  ou0altn fciltfaDemn o t4 rtoif to1fat anvolt)s2umxr3iy1openlicsa(  Dtau  no0tpeomfciatfmDul(ms u)tleomr iytomDrai i;(0s2umxr no1ome lnet (  rtrum nt4oltoif3iadls2rlu pn()tlxoir oy1fmte u o;t) euoio nodaptnmieia()aDrm(rpnt1alxnifciadfs ra( o (4texrio iadfmD aueo;t0 2umxo3nodlme mnesat  rrr( oot1tle mictldla rmnmonu4alxoxrctytopDrliei ( sexmxopiy4lp  lictas aruauro;u4opx if3iytfm2rluvp t)arxnmrctatopt lu s;t0teto(rpiudll elieiasfsDtmumoou1aetnmi3tltfsDulump () rtnxr3tydla eai il(0trxoir3iy1lpe mivi tf Dum(ro;u4aexn ieils a emu p t4aexrmr3to1la r n s;()trxoir3oy1omte nvsltfaDraum nt0apxn icilslm2eanvs;t)artomrcoo1fpDeln ilt  rxo(opno1op  liesls a2rr(mp;t0apto fciltlm rlnvpn(0 lxoir iodlp  ai ol()teum(opiu1ale lfvsas)srurxrpou1oltoiiciasls elnmo u4 etomoctadop eluei s)srumxr3oo4lptemncs tfsDtrumo;o0aexnmieiadls rlumsnu0altnircoadfmDe ivo;s)truo(o3no1ol   nvtas sDua(m oo0olx mfeildlmDul(mp;u)trxoir iytoat  ivo;t0trur(m iu4apee ictlsfsDraxr ;t0alx  icilsls ua(ms;t)teeoir3iatlpteaivils)seumiopny4olee ncsa(  2ra(m nu1aexnioeiatlm rm(vp (4 rtoifctydop r ivi;s  exrxo3nydalenmnes sf rrmur ;o1tet mieiadls ran on(4 etrirciotfpD lieils)tetm(r iy4olen ietas) Dum(r ;u4aptn i3iyt s2eaumon(0arenifcoydlpteluvil( setm(m3oodol e ietas)arua(r ;u1texnmf3tydlm rmnvp;u0trenif ootfaD  ivil()s2toxmpiu4am  mfvtltf rtr(r ;t4opxnmieias m2rln o t) renxf iydlpD ln slt0 eur(mpoo4ll  lnvt t  2urx pno0aleniociatlmDuaumpn(4aexnio3ta1oaDrlu i s srurir nu1oltnliei s) Dua(r ;u4opeoif3iasls2rmumpnt4 rerircoatoat li s;s0 exmir nu1lm  mietlt  2rrurpno4tlt  octld s ul(vpnt4altrir3oy1lat  ueols)srtrxr no4lp e ivslsfsrrru o;u4tpt iiciasfs ra(msnt4 leoxo3ta1lp eanei;t teuo(r3iy1oltn nvs s  2rau p;o0ope ii3tltfaDem(vp;t4arenmf3io1fa rai ilt0t2uoio3iy1lpt  nctas  Dtr( p;o4aptn f3ilt sDuln on()alerir3todlaD lneilt0teur(o3nudam  mict sf rtmumo;u0aee ifciadlaDrmu sn(4alxnxfcootlptrlies;( sexoirpnu4open ncs ( s2urx  ou0apxniieiys m umnmont)tetomo3iy1fa   n slt) exoxo3ou4olen nciat srurxm ;t4tpt mfciytlsDuaums;u)trerxr3oydfpt auvo;s t2xrxr3oo1lmenliciatf Drrxro;o4alxomf3tatlm uanvonu4artrmrcoatfaDeln olt setmxrpny4amen nciatfsDumu o;u0tpeo f3iad mDuaumo t4 exrxr ta1fmD lnesl() 2urxrpoy1lpe micia( srtrxmo;t4opxniiciytlmDum(mp;(4 rtoir iy1latean o;t s2uoirpou4lmte fcias) ruaxmpot0oltniicias aDulnmo;()trxnxocoydfpDrauvo;s)t2xrir io1altnlnctatf Dtax onu0oetoiieias m rl( o u4 lxnio ootomte uvo ()s2urxm ou4amtemictls aDtaxm ;u1tlto oeiad aDrm( p (4aleomrcoo1oa  aieols) eum(o no4om  lfcil() 2uax oot0alx io3tldlaDum( s;(4 rtrir iydlm e uvsls0tetm(r3ou1amtn fct s) rta( pno4aexoifciadfmDulnmp;t0trtnmo ia1la e ues;t0 rumxm3no1am nlictl(faDtaurpot4aetnifetlsfs ra(vsnt)alxrif oydlm  aueo t)t2xrxo3oy1amte neilt s2trxm nt1tlenmoetysfm rm(mp t4treoxo3todfaDranvo;()s2urxopoodlm elfci t aDur(moou1tpxoiictat s2umuvo;t)aetrif3oa1fpt  u i ()sexm(m3ou4aptelnetlt)sDta(  nu0ole mfciat m2eln onu4tlxoifcio1la ranvols) eto(rpoudlpte iviatf 2umurp;u0ope  oeiadla uaumonu) lermr3iadfpD aneo (0trtrir oy4omt mncslt)a2uaump;o1tptnio3tydfm emuvont0tleomrcia1fatrlneo;s) rxr(m nudope lfvtls aruax pot4opxn ociyt sDulnvpn()texrifcta1lmDr ueil(0t2tmimpny4lltn fcsatfsDrm(  ;o0opeomi3iyd s elnvon(0aexnmociytom rau ols  rxrir3no4ame mieias)artrumoou4tlxnmfciat m2uanmp;(0trxoxfcia1op rlneo s0t2xr(opiudllenlicsas a2trur ot4optniieiltfa2rm(von(0 exrxrcoy1fmD  u i;(  2tm(m3no1lpee ivta() Draur ot4apxo oeiadlm ua(vp t)trenmf3totfaDeliei ( srtoir io1altn fet ()aDumu o;t1texo ociltlm uaumsn(0tlxomo oytfa r ies;t  rtrxmpnu4al  lfcilsf Durxr nu4oeenifcilsla rmump;t)artnmrciy1fateli i;t)t2xr(rpny1om emncsasfa2ra( ont0alx iiciasla2umnvp u0artnmo to1oatran s s  exoim3iydlmtemieil(  rtm(mo;u1apxn octas aDranmo;(4 exrircoodfmDe ueilt  ruoim iudoleelfeils  rrr(rpnt4aex  ociasfm2em(mon()trxnxo3oatfa r ieilt0s2xr(mpny1llt lnetlt)a2taumpoo0apxnmiciadla emnvsnt4 exnmf3oadom raueils)srur(m3nydom n ivia(farumx  ou1tltnmi3tad aDrl(mp;u0 ltnmo iytoptrliei;t0teuoxo3ou1lm  mneilt)srumuront1oeen o3tltla2uluvo (4arxrioctodomtrauvs;( srtmxmpou1lme mnesl()s2um( p;u4tlt ifctas sDumu o (0tlerif oydla elivi s) 2to(m3no4al n iei tfs2trx o;o0oet  ietydlm ran pnt4arerxocia1om elnes;(  etm(m3ny4lltn ncsl(fs2urxm nu0olt mf3tadfa2ra( sn()trtnio3totopD lues;()seumxr ou1omen net t) Drrxmp;u0aptoifcilt a2ea(vo;u)trenxo tadoptranes;s seuriopio4op emnvslt)aDtau oou1altoifctld s2emu s t4aexoir3ootfmDeliei (0seto(r oo4opte ivtas)aDua( p;t0alx  ictlslm umumsnt0 rxnir3tatlmteau o s0 exrxo3nodlltelnvslt)s2rmxrp;u0aetnio3tytla2ra(vs;t0altnir3io1late n o;(  2xrxopou1omtn nvil(  Drru pnu1tltnii3iysfm2eaump;u0altomoctatlptelnvi;()truoxmpiy4openmfvtat  rrmxmonu0opto fcildfaDrlu s;u)texrmfciy1lp r ivo;t sexoxrpny1lltemnci s sDua( oou0teenmociatfsDumumonu0 eeoiocoydomtrli s (0 rxrxopnu4am nlfei (fsrumxr ;t0altnmf3ils a rl( o t) rtoircoodom eauei;(0 2uoxm nu4ap emnvi sf 2taxrp;o1tlxoif3iytls2ean ont)trtrif oadom ran i;s)sexm(mpnydamtnlnciat  2raur nt1tlxoioetasfm umnmp t4 lxnmoctydlmte ivo;()trtr(m3iodamenlnvsatfsDtruroou1tltnmf3tyd s2ulumpnu)tleniocootlaD ln s;t) etrxo io4ol  mivi t) Dta(  nu1tpeomfciat mDum(mont4 rxrio oydlmDeaies t)setrxmpiu1lmt  fet s  Dtrx  no0optnmfciaslm ul( o;u4areoio3oodlmt lnei;s0 euoxr iudoleemfvs s a2tax  no4oleoio3ilt a eaump;(0 lxnmocoa1om   neils0srxrxmpny1openmict s) Drm(m no1texoiieilslmDemuvo;(4 rxnif3iy1opD  i s;()setoirpoodamenmfes ()sDtrurpou1olxnio3ilslaDeanmsnt)artrmf iy1omtraueo t)srtmxm oo4lltelivt t)s2raxrpou1oet  octatfa2rmuvp;(0alenir tytlatrlueil()sruoxrpoudom nmnet tf 2raxmoou4apx ii3iat a emu s u4 exrmf3iytoa elu s t sexo(r3nudom nlnvia(f 2tmx pnt0tetoioeias a elu o u4teermfcoatomt  uesl()t2xr(opno1llteliet s  rua( o;o4olx ioetas m rmn p () rtrxo oytlp r u o ( s2xo(m3ou1omt  nesa( s2rmx o;u0apxomfctydlsDranvs;u4 eenifcoydomtr ueilt0 rtrir iu1ape lfctlsf 2tau  ;o1openifciasls2em(vsn(0tltnxo3oydoaDrlnes s  2xmxm3iu4al  lfvs t  2uru p;u0oltnmoeiad a2ua( onu4arxomrctydom   neslt)teuoxm3oo4lptelfci ()sDuaur ;u1opxn octysfs2rmnvont)tltrmf3iatfm e u sls)srumio3iu1om nlnetat)s2ta(r ou0oeeomictyt a2emnmsnt0 etrxr oadoaD an o;( trurxo3io4am   fvs s)a2umx ooo0aex  icildfaDelu onu) eenmr tatoa rlies t0trumxm3oodlp  micilt s2rm(rp;t4opxn ieildlaDuln o u4tlxrxr3ty1oaDraueslt) 2ur(mpnodop nlnesl()aDumx oou4ale ioeias sDrm(mo;() leoif3ia1fmtelu sl()s2trir ou4am nmieslsfsDta(rpnu1alxn f3ildfs2umuvp (4alxrmfcoadoa rli o t0setrxr3ou4al nmfetatfaDurxro;o0olxo ieils s umump t0tlxoxo3iatomD anvi;( setm(r ou1ope  ies t)artmxro;t1tet mictasfa2ea( o () rxoxfciy1opD aueilt sruoio3nu4lmeelfciat arta(mpnt1tpen ieiyslm ea(msn()tlenxfcoydlm elu olt)trtm(opoo1llte ivtas s2rax  oo1aex  ociltfm2emnms t4aetrif tatoaD livil( trtr(o3iydomen nvt s)a2urx ont4olt mocilsfmDrmnvo (4alxnio oy1omDelueo t srxoir3iy4lmeelivs s)s2truro;t1tlx  fciatfmDrmu o;t4aexnmf iytop elnvi;s)srtmxr3oydlpenmfei t artau  no4oexn oeiat s ua(ms u0aetnxo3tadlpt ln s t) 2urio io4opeemicia(fsDrm(  nu0olxomo3iydfm2uauvpnt) exrifctadfa elu o;( trxo(rpou1lmtn ivt s s2tm(mpnt1teen octytlm rmumsnt4tlxrmr3oydomtelieo;s  2to(opnu4ol emiesas  Dur(r oo4oetoii3iydfs2rmnvsnt0aexrmrctadla r nvo t  2xm(mpny1op  mncil(f Dua( pot4oetnmociysfs2ra(vo;t)arermo iytom e n i;s0 2ur(rpoo4altnmictas)a2uauroou1oeeoiociytfa2emump;t)trxrioctytfm eaneo ( t2umirpiu1lp e nes sf Drrumpno1oltoioeiasls2ra( s (0arxrxociodopD  uvils0 rtmxo3iu1amtnlivias)arrmurono4aleniiciydfaDeaumpnt0texnmr tatlpD  ues;s s2xo(opiu4am e fvs ()aDtm(m ;t1alenifeiasfsDea( ont4 rerxrctytop  au s (  etmirpiodll emiet (faDrax  ;t4aleoioetat s2rlnvp t4arxoxrciy1lmtelnvi (0t2xoimpoudal e nvsat) rumum ;o0oeen f3tyt s2ean o (4alermo3oydopteluvi;s) 2uoim3io1alt lnvslsf rtr(m ot0tpxnmf3iysla ra(vs ()aleoif3iadlmt lnvs t0seumxr3nudlp nmnesas  rrr(rp;u1alx moetydfa ran s;u0tltnxoctydoptrln s;s0seto(m3nydal  mnvtls) rrmu p;o4alx mietlslmDuln s t)alxnif oatfpD li i t)s2urir nydol n net tfsDua(rp;u0alx  ociys aDuanvp u) ltnir3ia1la  lnvi;t)srum(mpoudlmenlnvsatfsDtm( p;o0tlt  fcilsfa rm(vo;t0texnmr3iodlpDeaueo;t) ruoxmpoo1lpte nvs s  2rrxr ot1aex  ieiytfm rmn s;(4trxomr todlpt ln o;t)seumxrpoo4lp n nvtat aDtmumonu1aexo octasfm2raump;u0aexnio oydlpte u s s0teuo(r3io1aleelfei () Drrump;t4oltn ieild aDul( p;u4aexrxfctadla rlnvs;t  rxr(r oo1alt lneiat)a2rax pno1tpt mf3iad s rm(mpnu)arxnifctotlp e ivils texrxr ny1olte fvilsfs2ta(  ;t1oet mo3iysfm elnmp (4artomf3oodfaDelnei;()seumxopoy1ol nlfct tfarrau oot1oleniocilslsDrmn snt)arxnxocoa1fatelivi t0s2tmim io4oleemfcilsf 2ur(m oo4alx mfeiad m rau s t)texoifcoatfmDeauvo;t0trtrimpnu1omtnlies ( sruru oot0tpeoiietadfsDrl(ms (4altoif3oydoat lnvi;s) rur(opio4lm nlfvslt s2tm(r nu1ale iieiydla ulu o;u4trerxfciytomDe u i t  2uo(o3nudoltnmiei t  Dumxr ot0oeeoifetldfmDrlnmp;u)aetrif3ta1lmtrlivo;()t2xrxo io1lp n feiltf rtrx onu1teenmictls mDuluvs (4arerifciodfmDranvils t2tmiopoudole mfet tf 2rrumo;o4oeeomf3iadlm2elnvp;u0 lerif ta1lp   nvs;t  euoio3oo4lp e nvsat  Dtmxrpnt0teen o3tlsla2uaump;u4 leomfciodomtr n i s0srxoxopoydll elneilt  2rru  nt1tlxn i3iytfaDean p;t)tetnmoctodop r ieo ( seurxr3no4aleelncta() rrru pno1oleomoeiltfm2rl( s u4treoxociytlmDe neils  rumir ny1lme lneiasfsDuau oou1oetomfciatla ra(vonu0 rxomr ty1lmD  nvi t  euoio io4llt mncil() Drr( ont1tex mo3iasls2ranmo;u4 exrmoctadfmD lueil( srurxm iu1lmt lfvi s)sDrmumont0tee ioetldfm em(vs t)arenmfctatop e u s;s)srto(r3iu1ale licslt)a2ta( ooo4oetoiictydlsDrauvs;t0aetrifciatlmte ivs t  2urxmpnodomen iesls) rum(ro;o0olto icilsfsDulumon()arxnmrciodlaDeanvs;(  2xrxr3nydape lneil()aDraxr ;o1optnif3iltfm2emums u4trtrxf3tatfa e neo;t s2umxm3oodol  liviltf 2rm(m ;t1oexo oeildlm ulu o;(4tltomr ta1fmtean olt) etrimpoudamenmfes ()aDum( oot4alxoif3ildfa2umnmo;u0artnxr3tatfa  lu s;s  2xoxo3oy4altnmfct t) 2rmu p;u0tlenif3iltls2raumpnt)tlxnxf3to1fm  livilt) 2umimpno4lp nlfvtltfaDtru onu0ale moeilsfs em( s u0 rxoxf totfmD li i;t)s2tm(r3nodlm   iciltfsDtrxr ot4aetnmoeiadfmDemnmp;(0artnir iotomD  nvi;(0t2xmxo3iydlp  mfvtls aDtmu pno4olxoiictys a2eaump u4alenmo3todfpDeanvs;s0tetrir iu4lp nmiciatf 2rruroot0tee  i3iltla2rl(msnt4 rerircoadoaD au sls  eur(mpiu4lmte nctl( a2uau poo4tlen f3ias m2ul(vo u0arerxrciotlpDelnes s  rumxo nydlptemnci (  Dumx  ;t0tltoioctasfsDemuvs;t0 etoxr iatfa  lues t  exoxm no1omenlivi (  rrr(mont1tpto ictadfs2rmnmp;u) ltoxo3tytlmte i s t setrir3io1lltn ict ( sDrrxm nt0apt miciysfmDrluvo u4teerif3iodlpteaivo;()trur(m iudam  mnct t aDuax ooo0aetnmiciysfa2rau pn(4areomrcoytop r i slt0 etoxmpnudomeemfciat) 2urxrp;u4apxoii3ilt a eauvp;(0artrxrcta1lm e ivols)s2xrxm3oo4om   icsa()s2tru oou0tpt mfciatfa rlumpn()alxnir iadomte n o () 2xoimpou4llt mnei sfarta(rp;t0alx iicildlm2ea( s;()aleoxfcoytomDrau o;s  eumxrpou4lpen feia(farraum ;o4tlx if3iys s2ranvs (0 rtoir todfmD lu ol()texo(o3oodap nmneiat)sDrmxm ;t1tleo oety
\ No newline at end of file
@@ -0,0 +1 @@
+i s;s)s2uo(opno4ale  nes tfsrurx pnt0oeeomiciltfm eauvs u4 etnir totfmDeai o;( trtmim3iy1lltelicils srrrx o;t0texn ieilslaDrl(mo (4 eerir ootfm rauvi (0trur(o iy4op  mfeil( arrru p;u0apxn fetlslm2ulnvs u0aetnircoodla  aueo;t srxrim ny1omt  iei ()sDrrum no0olx io3tld mDumuvsn()trxrirciotopDe i s t0 rtr(opiy1omt mncsl() ruauroou4ope mieiad s2rluvs u)artoxr oydfp rlu i;t t2xr(o3no4llte nvtat arumurono4oex mieiydla2ea(mont0 ltoxr3ty1lmtrli s;s s2xmir3oudamt livslsfs2rm(rpoo4apt mo3tadfmDuaumpnt) etnmo3oa1latelnvo;()t2tmimpnu4ape mivsl()srur(mooo0ape mo3tyd m ranmo u)tetrmf3oa1faDranesl( s2tm(opoy1lpt  iet sfaDrr(monu0teeoifciysls2rm( o t)tlxnxr oydoatr nvsl( srxr(o3oo4lm nmnvs t)aDta( onu4optn oetys a2rln s;(0alxrmrctatfa eluei () rum(opiu1omtnlfvs s)a2rruroot4aee  feiad m ua(vsnu4 rxomrcoadlpD aueilt) 2tmxopno1optemics t aDtaxm ;t4tleoif3iad aDrm( o;(4aetoioctytfatelnvi s  rur(r3oy4lptnlfvsls)aDum(rpoo4olx  f3taslm el( s;u4 lermo io1op   uvo;s)srxmimpnudoltn fcs (fs2ur(rp;o0aeenif3iys sDeau s;(4alxnmo oatfatrauvi;(  rxrxr oo4opeelfvsatf 2tr(monu0aetoioctyd a rlums (4arenmo3iydfp r ivi;(0texoiopnu1alt lfes ()sDrm(rp;u1oex ii3tydfa umump;u) rxoxo3ty1late ues t)sexm(opnudop  mfvi s  2rrum ot1aex mieiltls ulnvo u4arermr3tadom eliei;()t2urimpnu4llt  ics sfs2umu oou4oetoioeilsfmDelnvp;u0teenmo oadlp   nvi () etoxr3ou1ale mfcs ( aDurumono4tptnmf3ils m2uauvont)aetrxrcia1fptr ivs;s)srxo(r3iu4amenlivsltfs2umuro;t4alxn f3iytfm eanmont)treoiocoy1lmD aneil( texr(mpny1ol nmfci s arrmur nu1open fciad sDum(vpn(0aexomocootlpDe u o;s  2tr(m oo1ol   ictasf Dumxr nt4tpxomiciasfa rauvs;t4arenmr3oydfaD aivol( trum(r oo1oleeliesl(fsrta(  oo0ope mieiydlm2rmu p () lxrxo3to1lat  neilt0 rtoim io1om  mfvtltf rrm(mp;u4aptn octlsfs emn onu) etoir tydoaDe ivo () eur(m3nodap  lictatfsrraxmo;u4ale  oetldfs2eln s;() ltnmf oytla  ai s;()t2urxm iodolt  ivt t sDrm( ont1alx mo3tlslsDelu o;u0 eerxr3iotoptrauvolt  etr(mpnydlmeelfvsa( arumxmooo0opeoioeiadfsDemnvo;u4 reniocoodlpDrluei;s)trxr(r ou1lpt  nvtat a2tmurono4tpe  feiltfs ranmo t4 ltnifciotlat  ues (0 euo(mpnudlptemfvsa(  rtrur nu0tpt ifeiydlm uanvp;u4altrxo3ootoa raues s t2urxr oydoleeliei ()srtau  ;o1optn i3iys sDum(mpn(0artrxf iy1fm e uesls0 etoirpoy4op nmics ( sDuax  nu0tpx ifeilt m ulu o;u0aetnmf3ootoaD  neils0 2xmxrpiu1lpt  nciat)srtru ono4texoiocias a2uau o ()alxnxocoo1omteli olt t2um(m3ny1ol  lfvt sfs2uaurp;u1apeo o3iydls ua(vp;u0 exrmfcoadlat aneo;(0s2trxm oo4oltn nvsat) 2trx  ;t4opto fciaslaDuln p (4 etrif oatlm rlivo;s)s2xrxo nudlm n iesasf 2tmx  ot4teenmi3iltfm uanmp t0 rxoxfctydfmtelneil( seurxr3oo1lltelfvta()aDtmx  ;u0tpt mf3ilt mDea( s;u)tltoxociadfm  aueolt0 exrim3ou4ome lnviat) Dtmxrpnu1ale io3iltfaDulumo;u)teenif iotfatraiesl(0 etm(o nodomt mfeia(fsDrr(m ou0teeoio3iys s2umuvs;t0alxnir3ty1lmte nei;()sexm(r3ny1ope lnct tf rua(m ot1olt  ocildfa2rl(vonu)tlxnif oa1lptrln s;t  exmimpnodamenmnvia(f Drrxmpnu4opeomi3ilsfm el(mp ()trxnif iy1om rlueils trtmxr3ny4ameelneilt  Drrump;u4tet  fcils mDrmuvonu)tltnmr3oy1lp  au sls0 2to(r ny4lm  mneslt  2ur(  ot0aetomoctld sDelnvon(0 exrxo3ootfaD lnvo;( sexmir3iodlme mnvils)arrrumpou4oltoiictad s2ra(mp;u4 lermociytfpDrau o;s0 2tr(m io4lmt lnetl(  Durum oo1opxoifetadlm2elnvs;t)aexnmfcia1lmtran o ( teuoir iydlp  mnvt ( aDur(rpnu0olen oeilsfs2umnmp;u) rxnmo3ia1fpDrauei;t0teuo(m3nydam emfcsasfaDtrxr no1alenmieiydfm2ulnms;u4alxoifcoatfa eai ol()texriopoy4op n nes t) rum(r ;u4tlxomieilsfa2emn on(4 ltrxr iatfp e iei t)truoxmpny1om e nes s srumu pno1tpe  octytlmDrln o;(4trtnxo oodopDrauvs;()sexoio io1alenlics tfa2ra(monu0ape mieias mDemn p;(4areomr oo1lmtrau i;( trxo(o oydlpeemfvils)sruax onu4altoiieiysla2ul(mo;u)aetoxf oy1fmDelieo () etr(r3nodll elnvi t) 2rrxm ou0oetnmf3iytfs2rauvon()aeeniocoy1fp e ieo;( trxrxr3oy4ape lfvslt srtr(rpou1tpto i3tlslmDrmnmon(0tlenio oy1lptean o s)t2toxr3ny4apte icilsfsrur(  ;o0aexomictat a2emuvpnt0aetnxrcoydfateaues (0 2xoiopoy4apenmnvsas arumxrpot0ale  f3iyt a eau ont0 eeoio to1lm e n o (0s2xm(o3nudomtnlnvt t) rrm(  ;o1apxomocilt m em(mp;t) lenmo tadfm raneol( setoxopiudolt lneia()sDuru  ou1opx mfeiydfa ua(mo;u4artnmr ia1fm   i s;t  ruoxr3oy1op nmnci s)sDurx pot0olen ociys mDrlnvsnu)artnmr3oodoaD  u s;s0 2xriopnu4ape mfvtl(  2rr(r nt1opt  fcils aDea(mo;u4tltoxr oy1opD anvi s srxmxopoydlpenmnvil( aDrr(m ;t4aeeomo3ias mDumums;t0 eermr3iodfmDr u slt0sexm(r3iy4oleemfvslsf Dtmu  ;u4openmociadls eanvon(0tlxrir3ia1lm eauvilt0t2xrim3oydaltnmnesls  rrax ont1tpe mfctyslm rlu pn(4tltrmf iytom e neol(  etr(m oodapee ivt (f Dur(rpno0alen ociltlm2eluvs t4treomr ia1om rau i s) 2uo(rpou4al  lncsas) rtaurpnt1alx moctldfa2uanvp;(0teenxo3oo1oatr ues s s2xmio oudlmt lfvtltfartrxmpot4olxn fetydlm2emn o u4artoio tytla   ies s srurxmpiu1oltn ivsl(fa2uax  nt0ope io3iasfa2ulnmpnu)aetnmr iadomtrlivo;s0trtoxmpoy1lp elfcs (faDurx  oo4alenif3tytlm2ranvsnu4tetrifciodfm   nvs;t)texmxo3ny4oleelfct ( aDtaxr ;t0ole  i3iasfm ra(vsnt) renif to1optrauvo;(0t2toxr3ou1ale  fvt t) Durxrpnu4aexn iciydfaDrmu s;u) ltnxo tydop ean s (0s2xoxm io4omtn fcta( srraurpou4ale mfciasla umu p;u0 etrmr3iadoptelu s t) ruoxm3iudaptelics () Dururo;u4oetnmo3iasls eluvo;(4 ltnxf3ta1fp  lieo;t trxoxo3no1alt micsa(fsDtr( p;o4ale ioctyt m2um(mp;u0tlxrmrcty1oaDean o;s)teum(o oydopenmfvi sf rtmumpot1aee  ociaslaDrlnmo u4alxoxo tatoaD ln il(0srxmxr ou1oltnmnvtltfaDrmxmont0opx io3iysls uau p () rxrmr ty1lptr ieo;()trtm(o3nudoptnmfvsat arua(mpou0oetoiiciydla2rmnmo u4tlxrxrciydfm  lues (0 rxrxo3nudlltnmnvilt) Dtr(r ou0tet iocilt mDum(monu4alenmf3iodoa r nei ( srum(opiy1lme mietat  2raum ou4tlen o3iadlm um(ms;u4 eerxr3iotlmDrln i s t2xoxo3oo4alt  neslt)a2uaxrpou0openmiciytfmDrmuvp;u)trtoircoodfa ran ilt) eurir3iy4altelies ( s2urx oou4tle mietatlm2rlnvs u0 rxrmf to1oa r nvi;()trxrxo3oo4op nmicia(faDtm(ro;u1opt mieiydfm2uanmsn(4trtnif3iatfptelneil(0seum(rpnu4aptnlnct s) Dum(m ou1oet  ietytlm umnvsnt0tlxoxo3oatlmtrln o;t0 rum(mpiydlp nmnetas artmxrooo4olx mociatlmDumu p u) renmr3tatlmt an o (0setr(o oudapeelfvtatfarumumoot1aptnii3ildfa uluvo (4 lxomo iotlpte n i (0seto(r oodomen fct () rurxmo;u0oet mo3ilsfm ea( ont0trenmrciodfm e iesl(0 2urir3ou1op nlnctltf rra( oot4tlxnmi3ilsfmDrl(von(0alenmr3totopt  nvilt srxm(rpoy4op nlnvia(f Durur nt4alt mocilt m2rl( pnt) rxomo3tadla eauvsls) rumirpoy4oleelfcil(  rra(mont0oeen ieiat sDean o;(4texnifcoadfaD ai olt  rtoxr3iu1amtemnvtlt a2taxroot4oleoiieiltlm2emnvsn()altrxr3tadlmDe i ols0teur(mpny1olee feia(  rtmx ont0apen oetlt a2ulumsn() reoirctytomt li s t s2trxopoy4ame lnci s)a2rr(mo;o0teenifeiltla2ua(ms (4aexnxrciodom eai i ()trtoxopnudllen ictlt)a2ta(moot0oetnii3ildfm2uln p u4 ltomr tydoatr ivo t) 2tr(m3oo4apen feils arua(mpnu0tpe  icilsfm elnvo;()tltnir iadfatelu s;t0setrio ny4omtnlnvtl() rurumo;u0aeen fctytfm2ean s;u)arxrmo tadfpDr ivs;s0srxm(mpnu4lmeemnvilt  Dtau p;t4tpe io3ildfa elumon(4tlxrmo3ootlpDe ieo t  2uoiopoy1amt lfcsas s2rmuroou0tle iieild a eaumpn(4aeeoio3oydlat luei s0seur(m iy1al eliet t)arrmu onu1aleoif3ild aDrmuvo t4arxnxr3iodfaDeai i;t0srxr(o3io4ap elnci ( s2trumo;t1olto o3iatlm2eluvp ()tlenxo3iadopt lnvils) ruoim oy4lmtn fcslt srrau  ;t4tee mf3tldfmDumumont4trxrxrcio1op e uvils texo(r3iy4ap nlfcsls)aDtaxmpou0oex  fetlsfa el( pnt4teenio3iytfmtraivslt) 2trim3oo4lmtn feiat a2trx  nt0opt moeild m2ranvonu0aexrxoctytfatelnvs () ruoxo3iodop  mnvi sfs2urumonu4opeomoeiltfa el(vpnu0altrio oydom rli i t srumxm3iydame lnesls) rrrx pnu0alto i3tld aDulumo;t0arxoio3oadfa r nvil( setoxmpiodaptemivils sDrax pnt1tpen ocilt a2rm(monu0 lenxo oydla r uvo;s)seumxo ny1lleelnei ()aDumxrpou1tpxnifeildls emnmon() reomo3todlpDeli ils) 2xmir3ou1al nlietltfsrum(ro;u4tee  iciasfa2ua(msnu)tlxrxo3ia1lp e ivslt0trtmxmpiudlleemiei t s2uaur nu4opt ioctydfaDumnvs;(0 ltnir3iatom elnei;s0s2xrxm iodllenmiesa(f Dtm(  nu0oexo fctls aDranmp;(0arenmo3tytom e u ol( trtmxr3oo1amt lict sfa2rr(m oo0opxo o3tysfs em(vsnu)tlenxo iy1fmteau sl(0s2xmxo oudol nlnvtlt)s2trxr ou4oetnifeias mDrau s (4aetrxfciydomDe i sl()s2xmirpno4amee fet s s2rru oou1ole  octasls2rlnvs t4 exnxrcoo1lpDeluvi t  rumir3iodope lnvsasfarrm(  nu0olxoii3tyd sDeanvsnu0arxnif oytlm  anesls) eum(o oodam  mfvtas  Dur(r ;u4aptoifeiadfs2em( p u4aetrxo3io1om   ies ()teto(rpno4ale lncs s) rraxro;t4aptn o3tas sDulnvpnu4tlxomo3iodfa elnvol(0 rtmxo3iu1openmfct (  rrmxmo;u0aex ii3ildlm ulu on(4arxoifciytoa e nvs;s) etmxr3nydop  liei ( sDrr(mont4oeenmfctas a2ulu s t4tltoir3ootoptrauvo t0 rxoxrpoudalt  fvil( s2tru pot1tpen f3tatlmDran s;t4 rxoif tadoa elnvolt0 2trxo oo4opeeliei (fa2um(rpoo1ope  f3iytlm2um(mp u0aexrxf ootlm e u i s trurir no4lpee ivs s)srtmu ont0tlx moctldlm2em(vp () rtniocoadlpte nvi t) eurxo3iy1al  lfctas) rrrumooo0oeeoif3ildla rauvp t0alenmf tytoptrli o;s0setm(o3iudlmtn ncta(farrm(m ;t4tlxo i3tlsls eaump t)trenircta1lp eli o s  2tmxopoy4opeelnvs t arrr( oou1oleoio3tydfa uanmp t0 rtrxfcoo1opDrln s;(0sruoxo3iy4lpt  nvtls  Duau oou0tpx  ieiasfmDemnms;()aetoxo ia1oate i o s0setoxr io1ol elfciat)aDtax  ;o1teen ieiatls emuvo t4alxoxr3io1fa eaieols teuo(opoydaptemfvs s a2ur(ro;t0tlto feiatlsDeanmo;u0 rtomf tadomDr ueo;s s2toio ou4olt lnct t srrr(m ;o0alxnmieiltls rmu p t0 rxoif3to1lpDe ueolt0 exm(o io4alen ieil() 2rruronu1texo feiys m ra(mp;u0arenmo iodfmD auei s) rxoxo nudapenmnciasfsDum(mooo1alenifciytfm2eauvp;(0aexnxr3tytlat luvolt sruo(m nu1omte icsat)sDumxm no1oexnifcias a raumo;u)trerxrcoytfptelies;()sexriopiudap nmfctat)s2rmum nt4aexomieiatfm ean p;u4alenxr todla rln ols0trxriopnudolenlnes tf Dtau  ;t4tpxn fciydfsDelnvs;t)tetomfciatlaD lnes;s)sexr(r3io4lm  lneiasfartaxm ;u0alt  f3ilsfs2rmuvs (0texrif3iadopDrauesl( trurio3nudamt  fvtlt aDtmxmo;t0apx moeilslsDelnmo t0aexnio oo1la ran o;() eumxm nydop emici s s2rmur no4oex moetldfaDum(vs;(0teeoircto1lmDeaieslt)t2umir3iy1lp  lfei t)a2umxr nt1tpxo i3tyd m2rlu pn(0aexoio3to1fatrlivs;s0t2uoio3oudomenlneia() Dum(r no1tee  ieildls2rauvo u0aeenmr3tytop  ai i;(0sexmim nudllen neslt) rur(r no1alx iiciyt m2raums ()tlxrxf oytfp e ues t0 2umxm3iu1alte fctat)sDrm(r ;o4teeo ietyt m2eanmpnu) exomo iydom raivil(  2xrim ou4lltelncsas arumxrooo0tleomicilt m ra(ms ()tlermf iatlm eau s;t)s2xriopiodlmt lnvtat) rrrx  ou4teenmfetldlaDuanmo u)tetoio3ootlp   uvi s)t2xrimpno4al nlnei tf Duau  ot1tle ifetld a um(vs;()tlxoir3tytfateaieolt0texoxr3no4lm nmfvsas)srtaxmpou0aptn i3tytlm2em( p t0aetrio ta1fa eluei s) rto(o3iudalenlivtls  Dtrxmonu4tptoii3iad a2emu s t0aetnmrcoydomtrlu i;t0t2uoxm oy1ale lnvs s srrmu pou4aexnmi3iadfm emumonu0 eenir oatfmD  ieslt)trxoxm ny1om n fcil() Drmxm ;o1opxnmfeildla rl(mp (0artnxfctytoa eaneo ( srtrxr ou1ap emneiatfsrumxr nu1aetoiiciysfsDel(mp;t0altoxoctadfpte u ilt)texoiopio4al   fvias sruaxm nu1apen ociydfsDrl( p;()aetrif3oytfatrluei;s0trtr(o oydomtn fvtls)a2raurono4ale if3tydfmDrau ont4 rxnmf oydfp   i ol(0 2ur(mpoo4al emnctasfsDtmx ooo4apt m
\ No newline at end of file
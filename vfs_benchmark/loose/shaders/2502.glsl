@@ -0,0 +1 @@
+u ilt0s2toxr3io1omenmnet sf Dum(r nt0tpx  ictls m2ulnmp t4trenmf3totfaDrau o s0srxrio3iu4optnmnct s  Draurp;t0apx ioctld mDrlnvs u0 reoircoo1fmD  nvi;t trtrxm oo1ameemivta( aDta(moot0tpxo iciadla eau onu0tlenif3tatomtelneo;()trumxmpoy1lpe  ivia()a2tauroou4tltomociys s2uluvo;u0teerif ootfpDraneo s0 2xr(m iydlp e ietatfaDraxmp;u4aptn ietlsfmDrlu p;t0tlxrmo3iy1lateaivo;t trtm(mpnu4alte ivs (f 2uru pnu0optomocilt m2rmu s ()aexrmo ta1fa rlies;( t2uoirpiy1lmtnlfcsl() rtmxront0tex if3iatlm2rl(vo;(0 rxnmo oytfm eauvslt) eur(o3nudlpt mfvt sf 2taumoot1tpxomfciys s2umnmsnt4areniocta1oaDraiei ()s2tmxo iu1lm emnvils  Drrx o;t1tet  ieiltlm eanvpn(0 lxnxf iatop raueo;(0sexrir iy4ape lnvsl( s2rrxmpnt1apeoifeiatfs emu snt)texnifcty1lmDran sls truriopoo4olenlicsatf rrau pno4olen f3iyt s umums;u4tetoif3oy1la eliei s0 2trimpiu1lp eliciat) rumur ;o0altnifctasfa umnmo;(0alerxf oydfm   ues;( s2tm(m3ny1lmenlnvi () Dumumooo4opx  oeiydla2rm(mp;u0 exnxociatop elu i s)s2urir3nydope lnes (  rtr(mo;o0oex  o3iyt s rmn onu)aleomfcoa1omtelivol() 2toxrpoydlp  mnvt ()sDum( p;o0opeomicild m2emuvs;t)artrmrcoytomD  ues;s0s2um(o3nu4ope  ivi tfs2urx pou4tpenmiciasfa rau s;u0 etnmrcty1lm eauvs;(0srurxo3iy4lleemnctatfs2urxm nt0olx mietltlm2ra( pn(0teenio iy1faDe n o;() rtmim io1alt mnvs t aDtrxroou4aleo oetad m uauvont4arxnir tatoaD  i ols s2xr(o ou1apenmncil()arurumonu1oet  icild m2uan ont) lxnio to1oatelivo s0texoxm3io4om elncilt s2rax  nt0olxo f3tltfmDum(vo (0 lxrio oy1fa   ies s0trumimpio4amenlnvsa(  2urxrp;t4oeeomfeilslmDum(vp;t4 lxoxf3oo1fpt au s;t)s2tm(m3oy4lp   neil(f Duru  nt4apx  icilt s2rlnmo (4 rerir oo1laDelu s (0 exoio ny1om nlfvsatfs2um(mpou1opxnmo3tat a2ulu o;u0 reomociodlm elnvi s  rtmxr3oy4am emiei (f 2ta(  no4olxn icildfmDul( p u)arxnio3iatopt lies ()srurim ny1oleelncta( sDtau onu4ale io3iasfmDua( p u0 leomf to1oa r ieolt)setrimpny4lleemnvi sfs2trxrp;u1alt  i3ilsfs ra(vp (4altoir3ia1optr n s;t)sexm(r nu4alen neslsfartrur ;t4tpenmoeiytlm em( o;t0 reoxrctytlmtr ues;(0trxrxr3iodlmtelicsa()sDtru o;u0opt  ociad mDraums;t4 etomf3oo1lmteaivi s)setoxr no4lpt lfei s) rrmu pnu4tlxn o3tltfsDua(vo u4trtrmr3iodlpte ueo ()t2toim3io1lp  licsa(  2urx ooo0oet  i3tlt mDem(vo (0 lxnmfciotfm r i ilt  rumxm nudoptelfei ( aDuaur ;o0aexo i3tysfs2umu ont4alerir3ta1fm elu s s0 2urxm nudaptelfcils)a2rrxront1ope ioetadlsDran sn()trtoir3tadlmteauvs t t2umir ou1aptelivsl()a2ururpoo0altn ietytlmDeluvo;(4 lxoxociodlp eluvs t) rxo(m3ou4llt mivtatfaDtrxrpot1alen ietad aDelnvpn(4 ltnxf3todfpD lnvs;()setmio3nu1lmtemfesa() Draxr ot1oleo o3tld m2rl( p;u0 ltomocio1lmDrln s;(0 etrxo3iodlme  icta()srtaxroot0oet iictas m2ra(von(0trxrxrcoydlateanvo;t0 eur(o3nodlpt  nvi () rrmxmo;o4tltomi3ias sDrm( onu4alxoifcty1lp e uvsls) 2toimpio1lm e fvslsfarururo;u1tpe  oeildlm2emn p ()aetrioctodlpDelu o s0sexr(r nodolenlfcils) rrm(mpnt4oltnio3tld mDeauvs;()altrmf3oodlmDrai il(0texrim3oo4ome lfcsls arum(rp;o1texoiiciatfa2uln snu0 rermo3tadomtran ols) 2tr(o nydameemnes s a2tr(r ;u4aetnmictld a2umnms t0 exniociydopDr uvs s trurio3io4apenlicslt)sDrru p;o4olxn i3iys mDem(ms;(0artoxr oytlmtrluvol( srtrimpiy4lm n icsas) rtmu  ;t0tle ifciad m2eln p (4 lxoxf3iy1fpte i s;s seurxrpnydale lfcsa() rurxmont0apt iietatlm2rmnvs;t)tlxnifctodlptrauvslt)sexmimpoodlm  liesltfsrtaur ;t1aexnii3ilsfs2ra(vo u)texoxfcia1fp e ivilt trtmxm iydoltnmictas  Dur( o;o0olxn ieiytfsDrau p u)tlxrio3ta1fateaueol()trto(o nydol n ncils aruaurooo1alxomoetydfs2emumo;t4 etoxf totoateaiesls teuo(o3oydlm nmncias sDrr( pnt4aeeomo3tad a rmnmo t)trenmrctatom  au ils0sexr(m ny4lmee nesas)a2rmu  ;u4texnioeiltfsDua( sn()trenir iodoaDranes t)s2trxrpiydol emnct s arrmu oou1tpenmicildfm ua( o (4alxriocia1omt aieo s setoir3oydomt  feia(fsDumxrp;t1texnmf3iasfmDemu p (0 exomrcoodop  ln il(0 2umxm3oo4lltemiciatfsrtr(ro;t4texn o3iyd m em(mo (4altrxr oo1fmDeaneils sexrim3iudomenmnctl( srrm(mo;t1oeenmo3iltla2rmn onu)trermf3ty1lmte nes;(0 ruoimpoo4opeelnvia(f rtrx ono4olx ioeiytls2rauvs;u4 rtoir io1lp  auvi;s)sexm(o iy4alt  icils) 2tm(rooo4olx mi3tasla uauvp u0tlxnxo3oatoateli sls)t2urxopoy1ome mics ( artrxmoou4ape ifeiatlaDrmn s;(4artomrcoo1oaDraivilt  euo(opoodom   ietat artm(m ;t1oeto oeiysla eluvont0arxrmr3io1oaDeaivo;s s2tm(mpno4aptnmietasfs2rr(moot1tpxomoctyt mDum(vp;()tlxrir iotla eln o s  exmxm3ny4om emiet ( sDurx oot0tpto oeiydfm umn onu)aeerio iadfp  auvsls trxoxrpoo4olt mfeil( aDrmu  oo0tpeo o3tad a2ulu pn(4 ltoxfcio1optr neol(0t2xmxr no4op  lnctl( arrm(r ;u0tpx iietysfaDeanmo () etomr oatlp e ieo;s)s2uoxmpnudapeemneilt  rtaumoot1apto ictytfmDrlnvon()tltoxfctatlpteau il()trxo(r3iodaptnlicta( sDuaum ;o0tlt mfcilt m2rlnmon(4alenmocootoaD  u i (0s2xmxm3oudapt mnvtlt s2rmu p;u4tet  octydls2em(vsn(0trtrmfctotfaDr i ols  2xr(r io4omt lnei ()a2ta( pnu0optomoeiatfaDrl(vo;u)treoio3iatoptr n o;()s2xoiopnu4ap n net sfs2uaur no0tet ii3iltfs rlnvsn(4 rtnif3ta1om rln o ( t2xriopnudopt lfciltf Dtau ooo0aetniieiadla eau o;u4artrirctotlat  iei;t0trxmio3oy4omt mici tfarrr(  nu4tpt  feiadfmDrmu ont)tltoxo3iatla elnvils s2urxmpou1omtemncsatfaDtm( p;t0apxoifeild sDel( s;u0alxnxo3ia1lmDr uvol(0t2uoio3ny4oltelncsltf rum(r ot4oeto icildfa2rmnvp;(0 lxrmr totfa   uvslt teumio nu4amtn fvil() rur( ooo0teeniietysfs2emn onu) lxrio oo1fa eanes ()tetmim3ou4oleelfesas) 2tr(rpnu0tltoifeiyt a eau pn(4aetnif iatoa eaneolt0srurxo iu4amtn fcs (f Drrump;u0apxnioetlt s uau s;(0tetrmr ia1lm raueo;t sruo(mpnudlle lnvt t aDua( p;t0oex mfeiydfaDulnvpn() rxnmociotlm rluvslt)teuoxmpou1apenmfct t)sDrm(m no0texoif3tldfsDraums;t) leoxociatfpte ivo;s  2xrir3nodapeemfviasf rtrum no1oeeoiociltlm2rmu o (0 etoio oodoptr i o (  2tr(r iudome  ncsa( sDrmx  ;o4opx  o3ilt mDrl( pn(4 leoif3oy1omDeauvi s0t2tmir3ou4lm n fci s)a2tr(r nt4apxoif3ild mDemn pnu4altrio3tydom rli o;s)trtm(mpoodole mivtatfarua( ont0tpe mietys sDrl(vo;u4 eerir iydom eai o ()t2uoxo3ny4olt mnesls  Dtaum oo1alt mf3tytfsDrmn o t4 leoifcoo1faD lnei t) 2umxrpiudop  mnct ( arrrurpou0tlxoifetys s2eluvonu) lxriocoadopt  nes (0seum(r nydam   ieias)srtaxmoot0tpt  fciadfaDemn sn(4aetrio3oo1opt lueo s srtoir iudlpen nes s) 2umuro;u0ope  oeiysfs uluvs u4 exnmrcoo1la  luei;t)srxrxmpiy4lptnlietl(fs2ua(root0aetn o3iad sDrmuvs;u) eeomr3oydfpteaivs;t0srtrxrpoy1al  lfctltfaDurxmp;t0ale mociat a rlnmsn(4 lxrir3totlpD  u o s) 2xr(opiy4lmenmicta()srrmxrono1oet  ietytfaDrm( o (0alxrxr oytlatrlueo (0 etmxm3ou4llt mietls artrx  ou0alxn i3iatfa2rlumont4 rtrxfcoodomtrai ol( trtoxo3nodom nlnctas)a2um(mo;t4opto i3iat m2emu ont0 rxnxf3io1fmD luvi t  2xmxopoo4lmt mieiat aDraxm ;u0oex  ieiadfaDrm(vs;t) etrmo ia1lmD anes;t0truoir3no1llen fcta() 2ta(rp;o0tpxn oeiat aDrm(mon() exrmr3iodomtrai i;s)sexmxr3iu4opee nes ()sDraxrp;t1tptnii3ilsfs2uln sn(0aeenirctatfaDranei;(  rxmxrpno1ame mietlsf 2rrxrpot0tpeomoeilsls ua( o () rerio3io1fatelu il(0 exo(m oo1llenlivtatfsrtax o;o1aeto ictls mDeanmp;u) ltomfcoo1faDrlieolt) eurxo3oy4om elfes s s2rmxr nt1tetnii3ildfaDrlumpnt)tlerxr3ta1lmt  ueo ( truoimpio1ale  fctlt) 2tm( o;o1tpto o3tatla2em(vsnt0 renif3oydlp   n ols0tetm(rpnu1lmt  ncia(  Dur( p;o1opt if3tydfs rl( s;u0aleoxf tytoatrau i;s teum(o3oodlpte icsa(fs2ra(mpou0aleniiciyt m um(mon()aeermf3io1oaDe i i (0 etmxrpoo4ap n ncs s) rtau poo4optoifciydlaDumumo;()arxrmo iytfmteluesl()teum(r nu1olenlfvia() rrmxmpnu0tpxnmoctatfs el(ms t4 exnxo3iytlpt aivs;()seuoxm ou1al nlfvs t  Dtaxr ;t4openifeiatls2uluvs;u)aexrxf oytfp  an s;t)seuoxm3nydapenmfct s a2tmu pnt0tpxomi3tytfs rmn s;t0arermo3totlpt  nvs;t0s2xoxo3no1aptemnvslsfartaxr nu4aetomfetls mDul( s;()trenifcta1lpD aivil()trtoiopiy4lm elivil()s2rm(r nt4altn f3iad a rl(vo;u0 lerir io1optr ieslt)trxoxm iodomt mnvtlsf 2ua(rooo1oee ifetaslaDea( p;u) leoio3oatfa  ai sl()texr(rpoydol nmfvi (fa2tmurooo4alxnmfciydlmDemn s;t0 rtrxfcoodomt ln i t0t2toxr oo1lp nmieil()aDtau  nu1apeo i3tys s eau s;u4trtoio3iydlp e nvi;t trur(mpnodap  mfetltfa2tr(mp;t1tpt  o3iatlm ua( snu0trxnxfcta1laDrln i () eurxm3oo1olee fcs s) 2taxr ;t0aexnmfeiltls2rl( s t0arxoir oydfp ranvs (0 2xmirpnu4lm elfcta(farrm(  no4aex mf3iadlm el(vont)trtomocoodla r nvo s0srto(rpny1olt  nci s)aDum(r no4tlenmoeiydlm2rauvpnu4aeenxo totfp  lnvs;t0 rto(o3oo1llt mivilsf rtaumo;u0opt  feiydlm2elnvo u4 exomo3oatlm raueo ()s2tm(rpny1om   netas a2ur(  ot0aet if3tytfmDemn p u) lenxocoytoptraivi;() rurio nu1op  mfcs tfs2rm(r ot1tetomi3tldfmDumumont0tetrirctotfpDr uei;t)sexm(mpny4ap e fes t)s2ra(mpoo1oetn ociat a2umumo (0tlxomo3oadlaD luei s  2xmio iudamtnmieiat)sDurur no4texo oeias aDem(mpn(4texrio3iy1lateluvi ()s2xm(rpou4lm nmfvtl( sDrm( pnt4opt io3tyd mDua( p;u4 rtnmo3oo1late i s;s s2xo(m nydlp emnesas a2rrxr ot1opxnmictatlaDrm( s;u4aeeoxrciy1lmt ln s;(  etmir iu4amtemfcslt)sDua(rpno0oeenmf3ilslsDuanmp (4altoxo3oydlpD lu slt0s2xmiopiodape  feia(fa2tm(r ot4oet  iciatfa ranmo;u4texrio oadoa r u i;()teur(o3ou1omtnmfcsltf Dtm(mooo0alto o3iyt a rmnvpn(4trxrxo oadfpte nei;t)truoxmpno1amee fetas srta(  no1oet mocilsla2rmn p;t0artnxocoadoatraivsl()setmxo iu1alt lfci s  Drrxront0olen fcils aDelu s;u) exrif3oa1late uvi;t s2triopio1lp e nct tfs2uaxmo;u0oexn i3ilt a rm(mpnu) ltriocoodoa elnvil(  2xoxo3io4amtn feiatfarrr(rpou1tlxoif3ilsla2um(vont)alxnxfctytfmt aivo;t0trxrir3nodam  lneiasf Dum(moot4olxnmi3tydfmDul(vp;t)texoxr3iadlmt li i;t)texmir oudopen ics s)artmxr no0alxniieiys sDulnmo u0trxnxrctatlmDeanes t)teurxm nudlpte fcs ( arumxm oo4texnmictlsfs2ra(monu0teerxf oodlaDeai sl()srxmir3iu1ome licsasfa2tmurp;u4opx iieilt s2eanmonu4 exomr3oadla elieo;t)teum(r no4optnmnvil(fsrur(moot4tlen o3tadfmDuau o u4 rtoif ta1la rlivsls0s2uoxm3iy1amte ici sfs2ur( o;t1oetn i3iadfm2ul(vp u4altrioctadfpteanvi ()trxoxo iy1ope  ieiatfsDraurp;t1tetnmo3ildlsDrm(mp;(0texnxo totfm e ies;(0s2xm(m3oo1lle lfvs sfsrrru  ;u4apt  oeild aDeluvs;t4tlxoif3oo1om eaivs t) rxo(o3ny1omte nesa( arrr(ront4aeeo o3iatfs um( o () lermfcoa1oatrlivo;t t2xm(m3oo1ol  mivs t  2tm(rp;t1aeen octyslmDelu s;u) rtrmr3iydfa  aneol( sruo(rpou1om elics s a2um(rpnt1tpeniietys s ra( pnt0 lxoif iatlmte u ol(0 2tr(m ou1opeemfvslt a2rr(mp;o0oltoioctaslsDeaums t0aeerir3tydfateauvo s0tetoxr nodom   fcslsfa2rrxm nt1texoifetltfmDua(mpnu4alxrirctatfm   ivi (0setmxm iy1aptnmicsl()sDtmur ou4altoio3iytfm ulnvo;u)trxnmr oy1lat lnesl(0setmimpnudalt  fci (  rum(r ot1tlen iciydlmDrlnmo (4arxrmrcia1lpt  iei;(0srtmirpoo1ap   netltf Dtr(r ;t0opeoio3tat a rm(vs;(0 etoif todlpD livo;t0srxoxm iodaltemiviat) Dur( ooo0altomo3ilt aDrm(mon(4 exoxrcoodlp   ivs t  2xoxm oudllte fctls)arra( oot4oexn feiatfaDrmuvs;t0arxrxo io1op ean s;t)t2xm(o iy1lle mfctatfs2rm(m nt4tex mo3iysfa2ua( s;t4trerxoctodomDean s (0trxmir3oudapeemiviatfs2ur(ro;t0tlenif3ias mDemuvp;u)texrxr3tytlpDe ueo;s0texrxrpiy4oleemieiltf Drr( ono4opxnmieiatfsDulnmp u)aetoif3todopDeluvilt)s2xrxr3oydolenlictatfsrtrxrp;t1tpx  feiyslaDraumo ()trxrxo3ta1fm  luesl() 2ur(o3iudlm e net sfartmx ont4oexnmf3ias m eanvo;u0trxoxo3iydom r u o t0trtoimpoudlptemfei ( aDra(r nt0texo fciydfm uanms (4 exrmo oa1fpDe n sl(  rur(o3nydlmee nvias arta( oou1olxo ieiyt a um(ms u)aleoxr3iydlm  anes;s)t2trimpiodalteliciat) 2rmum ;t0tptn i3tltla uau s;(4artrif3ootop ranvi;s0 2uo(r oy4lm nlnci s)s2ur(moou1ale mfeiadlmDeau p u) etomo3oatlm e ueols tetrim nodopt miesltfa2rm(  ;t4oleo i3iad sDemuvpnu)trerir iydfa   i i;t teuoio3iu1op n ivsatfaDraurpno4ale  fcils aDulump;(0alxnifcty1la eauvi;t)sexo(rpio4lpen ieias aDrrurp;t4alxnif3tat m2umnmp;t)aeerxr iadomDrauvol()setr(m3iudlpt lfcs sfaruax p;o4tlt mietlsfs rl(mon()arxrioctytlmtrauvslt t2tm(r ou4apte fvtat srrrxmo;t1tpto o3tld a rmuvo;() leoxfcto1late ues ( truoiopny4aleemnvtlsf Dtrxm nu0olx ioctas sDuan snu4 rxoirciydopDrli s;s0tetmxrpiu1omtnmfesls a2rrxm ou0optnmo3iydfsDulnvon(0trxnmf3iodomte ueo;t)sexoxr iy1ame lnvs s arua(  ;u1tee ioeiltls2um( p t)artnmo oa1fmteauvs;s)trtm(mpiudam e nei t aDtmxmpno4aeeoio3iatfm2rmnmp t4altoif3ia1omte nvo ()sexoir ou1apt mfeslsf Dtax p;u0apeoif3ildfmDeluvpnu) exnifcio1lptrln s;( teumiopny1lm nlfesas aruaur ou4tpxomfcildlsDeln o;t0 etomf3to1opteanes t  rtmxo nodamt lnetlt arurx o;u1apxnmoeias sDrlump;u0tetrif oo1la r ueilt0trxoim nu4al elieias s2ua(rpoo1tetomfciysfs ean p (0artrmo iatfm rli i;s0srumxrpiy1aptnmies () rrmxrp;o4tpto feildls2ean p t0arxnir3oatop rlivo;t0trxo(rpoudamtelfesat sDrau o;u0aetnmfciatfa2um( pn()alxrifciotoptrln ilt)teuoxr iu4ope lietls a2rmum ot0oleniiciyt aDrln snt0trxrmoctytoa elnvilt)t2uoxm3oo4llte fet (fsDumxronu1texoioeildls rl(mo t4aeerxfcta1fm  lues;s trxm(opoydoltnmfetas sruax pou0ope io3iydfs rlumon(4teenio iadomDeli s t)setrxr iu1ape  nesas s2tax oou0opxoiocils mDeau o u0tlerirctotfa eaivs s)tetm(rpno4lltelnvia( a2umxmpot0tlt mo3ild mDumnmo t0alxrxf oy1lp   nes t)s2xmim3iy1open fes t)sDumu  nt1tlx  ietys sDranvo;t0alxnxf oa1fa raiei;(0t2tmiopiy1opeemiciatfsrtr(  ot1apxo f3ildfm2eanmpnt0arxoir tytoptelieolt0trxr(m3ou1omtnlfes tf rtruroou0aeeo o3tysls umnmsn(0tlxomrciy1oaDrli olt0t2xoxm oo4apeelfvsat srumurpnu1teeniietasfaDrlu s;t0 etnxr3tytfpDr neo;()texmir3iu1op nlfvs tfaDtr( oou4opeoiociadla uau pnu4 ltrxfctatfm  aivsls0trum(o3iydol e icsa()aDrmu ooo1tltoif3tyt s2rau pnu)arxnmocta1lmDeaies s sexmiopnu4oltnlfcsls)aDumxmono4tpx ioetlt aDuau s u0areoxf todlpt  neil() rtr(r oo1lm  mnci ()aruru  ot1tpxniietytfs rl(vsnt4tetrmo ta1omtrlivo;s  2xmxo iy1apee nvtlsfsrtm(mp;u4oetomiciasla uau o t) rxnmr iydlaD auvo;()trumxm iydolenmnvslt  Duaump;u4tlt io3tyslaDumums;t) exrxf tatfm r u i;t)setoio oydlme liet tfartaxro;t0olx ifciat m emn pn(0trtoifciatom eau i t s2tmim iy4amtemnvslsf rumxm no1olen o3iysla uln s u0 rxomr3to1om rlues ()trurxm no1optelnvil()a2taxr ;u1aex  o3iyd mDrl(mo;()altnmo3iatfmtrluesl(  eumxmpnydlpenlictls)srtax  ot0oeeomf3tytfaDraumo;(4 lenxo iotopDe u s;s) 2tmim oo4op nmnctlt) 2taxmoot4aetn i3tltfsDumn p u0trtrxo iodomD ai s;(0 rtrim3iodlpt lfvtatf 2urumpno1tptoio3iatfs2raumo u4 renmf3ia1oa  livols s2urio3oodomee nvtatf rrm(r oo1tltoiiciyd mDumu pn()texoifctatfmDeaivs;s0 rxmxr io1ll nmivsls) rrm(  ;o4tpx mfctls m2uau o;(0teeoxo3oadoa raues s teumxo iydape mncs sf rururont0aexo icildfm2uau p;u4tlxrio3oydopt aivi (0 exmxr io1lp  lfctltf rtmxm ou1opt ifciysfm2eanvo;t0 leomr tadfm eaues (0tetmiopoo4ol   iet s srrrxr oo0aleoii3tas aDeanvs;t0tetnmociy1fa   ivi t0trurio3iu1oltn neiasfs2tmuro;u1tetn iciytla2uluvs t0altnif3iy1fpD  neil( trtmir iu1optnlict tfsrua(m ;t0olxn fetatla2ulnmp u4tltrmfciatfptelivs;t) 2ur(m oydlpt  ivi tfsrrrumoou4tltomi3iadfsDul(msnt0aexrmf oy1op r nvi;s seur(r nu4optnlfet s sDtmxronu4olxn i3iat a rm(vs;(0 lxrio3oy1om eluei;s0 2to(m oy4lm nmici t artax onu1altomictyd a2ua(monu0altrmrctatoptraneo;(0t2tmxo3oodom e fvtatfa2uax  oo1apxoioeias m2umu pnt4texoxo3iadoaDelnvolt  eurir oodlm e ictlsfa2umu pou1tlx iietyslm2rmuvsn()altomr3iotlaDeai i;t0seumir3nodom elfcs (fs2rmumo;o1opx ioetltfm2umuvp (4 ltomocoatoate ivo;(0 2xoxm3iy4lpee nvilsfarra(rpou4tpxomociys sDelumon(4aexoxf3ootlm raneol( t2tmimpnu1ape  netat) 2ra(r ot1opto o3tydfm ra(vs;t4 ltnmf oatomtrlnesls teurio3iudamenmfes s)s2tr(mo;o0aetniociadls2ra(ms t)altnxr tadom eli o t0s2trimpio1lpenlivi tf 2ra(r ou0teen i3tytfaDea( snt)areoxrctytfa elieo;t)t2xo(r iu4lm nlivi tfarumx  nu1tpen ociaslm ulumpnu0 renio ty1op r neo;s0 eum(o nu1optnmivtl(  Dtr(mp;t0tptomietls s2uan o;(4aetrmo3oo1omDelieo t0s2trio nydlmtnmfesas sruau  ;o0tpxnii3tyt a ean p;t) etnmr iodom  aieil( setr(r3io1oleemncilsfarur( ono1aleoii3iysla2eau snt)aetoircoa1la raies;(0t2trir ny4amtn ici () Dtm(r nu0tltnif3iltlm2eaump u)teenir oo1omDrauvslt trumxm3nodlltelfeta( aDum( o;o4oex mocildla2ran o;u4texoir3oy1omtr ieo t)teuo(m3ou1llen fcsat) 2tr(r oo1oetn ociytfa2rluvo ()aeerircoydlp r i s t  exr(opnodamt liei ( sDurxmoou1alt miciyd s2ua(vpnt4trerir iatfmtraueils  etoim3nu4oltemncs s  rraxrpnu0optn fctydlm2rlnmp;t0tetomoctadlatr nvo;t  2xm(r3oy4omtelnvi s sDra(m ;u0tex iiciyt a um(mp;(0texrmoctodlp  li i;s) rtmir no4opee iet t)arta(  no4tetoioeiytlm ulnmsnu) rerif oa1fpDr uvolt) 2xoxrpnudlpe  nvia( sDraum ;t0ope ifetlslm em(vs t)texnxf3to1oaDr nvi;t0sexmxopio1lp nmneil(  2urxm ;t0ope  ietydlsDul(msnt0arerxo3totlm ean i t0seum(m iu4omeelfcs s  2uau  no0alxnmfetadls emnmp;()arxrirciy1lpt li ils t2tmxm3ou1lmtnmnvs s sruau oot1ale mf3iaslm2ua(ms (0trermf3tadlmDeau ol(0srxoxo iy1lpeelnei ( a2umxrpno1tlxn fciltlsDelnvo t0arxoifciadla eluvols0s2tmxo3oo1lp e nes s)artmu o;u0oltnmfciad sDulu on(4altrxr3ia1fpDrlueil() rtr(o iu4oltnmnetas)a2umuroot0opt moeildfaDel(ms;(0 ltrio3oatfm eau s;s  2tmirpnydoleelfes (fsDururpno4alto iciltlm2eau o (0 lenxf iy1oa ran s t) eur(rpnydame mnes s)srtmxr nu1ape io3tad a2rm(ms;t0alxoif tytlpDrli ols  2xoiopiy1apt lfctat a2uaxmont1aeeoiociasla2el(mp (0 rxrio3todfpD li s (  eurxr ou4om nlnviatf 2tax oou0apxniicildfs uanvp;(0 rtrirciytfmt au il(0t2toxr oy4lm emneil( a2truronu0oee  ociat a rlnmo;(0 lenif3iodfp rlivs t)s2umxm oy1ole lieslt)srtaumpou4alen i3iad m emnmon(0 eerio3tatom eai i () 2ur(m3iydlp e iei ()aDurxmoot4ole ioeildlsDrl( sn()artoif3ta1lateaivilt  rtrxm3nodol  lieil(fs2ra(mpnt1tetnmi3ilsfaDemumo t0alenxf3tydlmD  i o;t  exrxr ny4lmenlietlsfarumumpot1apt iiciytfs ea(mpn()aleoio3tydlpD lu olt seuoirpnodol e nvt () rrr(rono0tpx mocild m2eanvonu0altnxf oa1lptr u o (0 exmiopnodol nmfcsa( arrrum ot4aet  f3iyslaDrm(vp;(4aeenxo tytfaDr ivols) eto(mpiodlle mictls srtm( o;t0tleomietls sDrau o;t4tetrxfcio1fa  aivil( srtmxo no1oltnmnvils) 2umump;t0olxo oetytfsDua(vp;(4trenxo ootlmtraivi t0srtoio nydamen fcslt)srururpoo1tetn feilsfs2umn s (4trermf3iy1om  lueolt) rxoxr iydap nlnetls s2uaur ;t4tpxo i3iadlm ul(mo () rxnxrcoy1lm r u sl()texrxopio1ame lfeta( artrx o;u4tpx iociltlsDean p;(0 lxoxrciadfmtelnes;t trxr(o nu1omen fcsasf rurumpot0opxn ictldlm2ea( p ()trxnmo iydom  au s;s0s2tm(m3no1lpee fvs t)arrrxmpoo4tpxnmociyt m ra( pnt0 eeomf3oadlaDelieo;(0 ruoxrpiy4llt mnei s aDrmump;o1teeniocilslaDumump;t4aexrxo oydfaDr nvo;s) rxo(m ou4omenmivt ()aDtaxmono1tpeo oetlsla uau s u4trtnxfciytopDeauvi;t srxrxmpiydole mivta(fsruaxr ;t0olen feilsls2elnvo;t)aetrif tydomDrln o;t0 etmxmpiu1al e net tf Drmu onu0tpeniieiyt m2umnmpn(0arerxfcoatomDrlu s t teurio nydllt mietl(  Dum( pou4alxomieiyd s rl( p u0texomr3iatomtranes;t  2tm(o3iy1oleelivt sfaDumu pnu1alt io3iys m2rlu s u0alerioctodlp r u o (0 2um(m3iu1olte ici t  2uaumpno4oltoiiciaslm elums () eeomr oa1la e ueo s) rtoxm iu1omte fvta(fs2uaxr oo0aexomfetas s2eln pnu)texnmf ootfmtr i i s  eum(m ou1al e icsl()sDrrxr ;t1teto oetltla2ea( pnu)aexoxf ty1fatrlivs ( s2um(r iydlptelfvs (f 2trxro;o0tpxn i3iysla2ea(ms;t4 reoxf3tadfmte ieo s0trxoir3nudol elicsas) 2uaump;o1tltomfctasfaDrlnvs () rermocoodlmD  u o;t0t2xr(o3no1opeemici ( srrmxmp;t1apeomiciyt m2uau s;()artoxr iatfa rlneo s)s2umxm3iudopen ivtatfsrraxmono4tet  ociytls2elnvpnu0areomrcoo1lp   n slt)texrimpnudamee ncia( a2urxm nt1tpt  oeildlmDrau pnt) rxrir3iatfp  ln s;t  exoim ou1op e fvi s)aDtm(rpnt0optoifetytfs2uln o;u4 lxrmf3tytoaD  u o;( trumxr3ny4am nmfei t)arum(r nt0oltn ocild sDrmu s (0tlxrxocoodlmDelnes;s0 2tmxo3ou4lmenmiesasfsrrr(r no0ale mf3iat s rm(von()aeeoxf ty1lp eln ols setoio nydapte ncsat) rraur no1tlt mfciyt s2emn p u0 eenxr ootla ean i;t  exoim no4apen ics (f rur(r nu4aex mietyd mDrmu o;u0aetnio todomDeaueo;(0setr(o nodolee fcils sDrrumono0tle io3iytlm2uan o t)aleoio3totfatrli i s  rtoio3oo4lme  ieias sDurxront0teeoio3iatfm ulnmo;t4tetoircia1lat lnvsl( s2trxmpiu1altemivsl( a2ua(mpot1aet mieiaslm2rmumpnt)trxoif iadlptrlivo t trur(opoy1lme lfvsl()s2ua( o;o4tlx ifciysfs raumsnt)altomo3oydopt  ies s  2um(o3iu4olen neia() rrax p;t1apxnmieiyt sDrlnmpnt4tlxoxfcoytfmDe i i;t  eumirpny1oltnlnvt s)arum(moot0opxo octadfs2rau on() rtrir3tytfpD auvo;s0 2toxo oydaleemicilsf Duaxmono0tpxoifeilt aDelnmp;u4 lxnxf tatfp e uvolt) exo(o nu4alenlfei tfaDta( onu0tee  o3iad aDrmumonu) lxnxfctatopDelnvi t0trtrir no1oleemicsas  Duru  oo0tlt micild s2rlums (0 eermo3ty1lpD ai s;s0texr(rpoo1omt  neia( a2ur(rp;t0alt ifeilt m2em(mo t0treomrcoytlm rauei;(0s2tr(m3iodoltemfvilt  2rrxroot1tlx moetlsla2elu s (0trxnmocoatfpDraneols0t2xr(m3oy4ame  fctltfa2tmx pnt1tpenii3tytlaDelnmp ()arerxo iytlmteanes t t2xo(o3oo1am nlneils  2rau pno0apxn f3ildfsDumumsnt0 rermo3ootlpte ivi;() exo(rpiydopte fetas) 2rm(mpou4aetnio3ilsfa ranvs;()tetrxfctydom  li i;(  2tm(opnudlmt  fct (farumumpnu1oetn oetlt s emu pnu)aexrmo ta1fmt au olt0s2xoxrpiy1ape lfvi s aDta( pno4aeenmiciltfm2emuvo (0 reoxo ootfp r iei s0 2tm(o3oo4lmenmicsat)aDrrxr no0altomi3iydfm eluvsnu) rxrxo3oy1fpteaieil(  rxmxm iydlp  lnct (f 2rr(mont1oet  oeiysfm eln s t0alerxfctodfm   n i;t) 2xoxmpoo4lme  nvsa()aDumxmpnt0tpe mictatla2uln o;t)treoio iadopDe nesls)seuoio ny4op  micil( a2rmx p;o1tpenmfctatfs el(msnu4texomfcoytfmDelnvs (0 rxoxopnu4apeelfei sfsDtru p;o4oleo o3ils a2eauvo;()aexoxf3oadlptr n i t texm(m3iydam nlfvta( s2um(mpnt4tet  oeiyslsDul(vp;u4alerxrciy1omte n s t  2uo(r3iy1omenlicia(fs2tm(rpnu1tptoii3tytfm em(mpnu0 etoxfcoodfa  an i t srxmxo3oudap nmncilsfa2rrxr oo0openmiciltfs emuvsnu4 etnxo3iytfa ran o s setrimpou1lptn netls  Dtrurpnu0opxo f3iltfm2el( onu)texoxr3oadopD lnes;s)srtr(opny4op  micsatfaDurx oou0opx  ictaslmDra( s;u)trtnirctatlmte ueolt)s2uoxrpiydamenmnvt t)arumxmp;t0optn ieiadfs2ea( pn() ltrif3iotoat aneolt)sexo(rpnydolt  ncia()arrmxro;t4aet moetytfa em(vp;(0tlxoir iy1fa rln i (  rurxo nu1omenlictls artrur ;u1oleomi3ias a2ranvon(4 lerxrcoydfaDrln s;s0t2xrirpnydop   net t a2rmxm nu0tpxoif3iatlaDeluvp (4tleoiocoytfmDr i o;t0 2urxr3ny1lltnmivsas  rrmu pnt4aee ioctytfs2umuvp t) eenifciydfatrauei s0s2umirpny4lpenmfctlt srrmxmo;o4oexn octys m umu pn()trxnmrctatlaD ln il(0 rurxrpnudlpt mnviat)s2rm(  ;u4open f3tatlsDrmump;t)teerxf3ty1op  lnes s0s2toir nudlme lfvsat  2tmxmp;u4oeenmfciyd sDuanmo;t)tlenmf ty1la e n ols teum(mpoy4alen nct tfsrtmx p;u1open iciyslm2rl( s;()aexoxo3tatfm   uvi;s)srxoim3nu1lp  lnci t) rtru  ot1apxniicilsfm uau s u) rtnxf3iy1om eaies s  exmio iodlltnlnvs s)sDururoou4opx mfctasls rm(vp;u)tltomr3todlp eln sl( trumxr no4om nlivia(f rtax pou1opx ii3iltfa2rlnvp;t0 etoxr3iotlptrluei;( seurim3nudapenmici (f ruaumo;o1apto feildfa2eln p;(4aexnif oodopte nvs;t) euoio3oo4lleelivsltfaDrmxr ou4tet mieils a elu s;()artoxo iadoa e ieolt) 2trxm ou1lpt lietasfsrua(m ot4tlx iictytlsDuauvo t4 lxrmr3to1fa elues s)srtrir ou1apt mivsl(f rtmxro;o1alxn f3iytls2em( p;t0 ltrmr3oo1oaDranes;()t2umxo3nodol nmicils srtaum ou1tltoiieiytlaDrluvp;u4 ltrmrcoytopD livsl(0teuoxopiodolt lnvsasfa2tmur ;t4oetnif3iltla2rmu pnu)arxomr3ia1fm  lnvols0tetoim3nu1apen nciltf Dtrxroou4ape  fcilsfm eauvont4 rerio3oo1la e ivs;t  exmir3oy4alen fvtlt) 2taxmpoo4oexoio3tltfaDra( o u)areomfctotfpt  ieo;(0teum(rpoudol   ictltfs2tr(rpno4altnmi3ils mDulnvs;(0trxoir3totlm elnes t0 2tm(o oodaltnlfcsat srumu o;u0olenifciydfaDumn o t0arenmf ty1fa  lies;s)setrir nu4olt liet tf 2rrxmp;u4aleo o3tydfaDuaumon() rxoxo oodopDrluei ( seumxm oudalt mfviatfs2rru o;o4opxn f3ilsla um(mp;(4alxrxo3oydfmDr u i s srxrxo no1amte feilt) rrmurp;u0tpxo ieilt aDel(vp;()texnxrcia1fa e u i;t0 rur(m3no4open nctltf 2ua( o;o0olxoii3tatfa uluvs u)aeenmo3iatlm elnesl(0 rumir3iu4ameeliciatfa2tr(  ot0tee ioctatfaDel(vont4tlenio3ootlat  nes;t0s2uoxm3io4oleemncias)s2ta(ro;o1tpeomfeiys aDrluvp;u) rxnmocta1om  anvo (0sexmxr oo4am n fes s arumxroou4oex ifeiasls elnvo;(4 exrio ta1la raueil( t2xr(r ny1ol  mfvs (fs2ra( o;u4olxnii3tydfm2uanmo;()artrmf ta1lmteauvo;( seumxo nodllenmfvt (f Durum oo0altnifciltlmDrln s;(4trenmf todla  au o s)srurimpiu1ll nlnvt tfs2rmu  nu0olx if3ilslsDea( pnt0 exoxfctadomDeanes;s)teuoir3nudaltemict t  ruaxrooo1openmi3ilslm2ra(mo;t0 ltrir ta1latrlnvi;() 2ur(r3no4lm  lfeslt s2trurpoo4texniociadla2emums;u0 rtrmf3oodlpteaneil()t2uoxo3oy1llenlivslt) 2ta(r ;u4oetoifeiasfm2emumo (0 ltnxocoatoa rai s s setrirpno4altn iet t  2ra(  ot1ole ifciytfa uanmpnt4 rxrif3oa1op r nesls0sexmxo no1ape  fcsltf Drr(rono1tet  o3iltlaDuau o t)alenxrcoadfp eau i;s0 euoxm3nu1al nlneta() rra(rooo0olx  ieiad aDuau pnt4texomrcoytfpD  uvolt0srtm(m3nydalt mnctls  rrax  ot4openmociatlaDrmump;(4artnxfciy1lmDraues s)srurir3oodamtn ncil()arua(r oo1tpt ii3iatlaDumuvsnu) eerio3iydomtr u i t)trxm(opiydlle mfei s)s2tmxr ot4tleomoeias aDrlumo;u)tlxrircio1lp e u sls)trtmxmpnodlltnmivsatfarum( pot0ope  i3iyt m uaums (0aetnircto1laDr i o;s0trxoxopiodopeelfctlt arrmx o;o4olxoifcilslsDea(msnt)arxnmociadfatrluvil(0t2xr(mpoy1om n fvs (f rtrur ;o4aeto feiydlm rlu o;u0tlxnircio1fm  li o;s s2umir ou4ap emnvsa() ruau o;u4ale  ieildfs ran snu0texrmf3iadlm  anvsls seum(r iydapt mnvtl( srurx o;t4tlx iiciys mDea(mpnu0trtnircoadla rlnvi s  etoim oodamen fvtlt  rur(m ;u1aptnmoctlsfs2uau o u)tleomr oo1lpDean o;t teto(r iy4al n nes s aDtau  no0tee  ieiyd m2rl(vo (4 eerxr3iytlp rli i t t2uoxm nydapen nciat)srraumonu4oltomiciys a umums t0alxoxo oydfptelnvols)t2uoxo3iy1olt mivslt) Durxmpoo1opxnio3iaslm2el( p t0trenmr3oo1oa elnvo;s  rxrio3nudal nmfvs ()srrmump;t0olenmi3iys a rlu ont) reomrcto1opD  ivo t0t2xrio oy4aptelietat srraum ou4alxn iciydfs elumo;t0 ltoio ia1lmD li sls0 2ur(m3iu4apt lfci ( sDtm(rooo4tex mictad sDeluvs;t)trtnxr oydfa rlues;() 2trxmpoo4omtemiet t) Drm(mooo1oleoioeiat sDeluvs;u4trtnio io1opDr u slt)setmim3nydomt lfcs sfsrrrumo;o4apeo ieiatls2emuvo;t4aeenif oadop  lu i s0trxrxrpoydom nmfci s)a2ururoot0oleoif3ildlaDul(vp u)tlxomf ia1lm elivol(  rxoxr3oo1lm elnvi s  Dum(mpno0apxn oeilt a em(mon(4treoio ia1op  livo;s0 etm(r oo1lme  neiat arrax  ;u4tlxnifciatfm rmu pn(4 ltrxrciotlmt lnesls srurxrpiy4apeemnvtls aDtaxmo;u4tpeomi3tyt s uan o;u0arxrmr iytopDeaivi s) 2xm(o3ou1lmt mivtat  rtax pnu0apxo oetat m rl(vsnu)trtrxo oo1faDeaivi s0seur(m ou1oltn nvi s sDurx oot4texn ocias aDrluvp ()areomr3iatoaD luei s0 exmxr io4ol emfvil(  2uau  nt1tptn o3iatla rm(msnt0 rxnio3totop   ivsl(  2umxr3oo4ole lfcia(  Duaum no0tpxnifciadls2emnmo;u)altrmr3iodlmt ai i;t0 2uoim3no1ol emfes (  rta(mpnu0tpeo iciytfs em( sn(4aeerxfciadlpt  ieo (0s2to(r3ou1amt mfeias) rurxrp;t4tptn octas a2uluvpnt)arxnifcoa1oaD aueslt  2xrxm3oodll nmfeil(  rum(mpot4altomi3tasfs ra(vo u) rtrmr ty1omDelnvols0 eumxr oo1opeemnvilsf rrmx  ;t1tpe mfetatfmDum( p u)altrmfctytlp r i i;(  exmxr iodol emies t a2uax p;u4tltomfcildlmDelnvont4texnxr3to1lmteluei t) rxoim3ny1om e nesas  2um(  ou4oeeomf3tyd m emnms;t) reoxfciodoat  uei s0 rtmirpoy4lmtnmfet tfsDum( pou4tltnioeild s umnvsn()arxnmo3tatlmt  i s;(0 2tm(rpou4lle mnei s  2urxrpnt0tltoif3iatlm eauvp;u) rtoir ta1lat lu o t) rtmxopiy4lltn ivs t a2rr( pnu0apeomoeiltfmDeln pn(4 exnxrctadlpDrluvolt sruo(opiodlp  mnviasfaDuaxronu0texo o3iyd m2umumo t0 reoif3oydlaD aivils  2urirpiodame  fcia(fsDrmxmpno4tltomiciytfaDrmuvp ()texrmrcty1fa  ai i;t)s2toxm3oo1optelics t a2rm(  ;o0oeeo fetls s rmnvsn(0arxnmo3todfaD ai ilt0t2trio3no4om  mneslt)artau p;o4opx io3ils m2uanvonu0aleoxf3ta1opDr nvo (0tetoir ou1lltemietlt  Dtax  oo1optomietyslaDeaump;t4trtrmocio1faDr n s;s s2ur(opoudal  lfeiat sDuaxm nt0tpx ifeiltfm rluvsn(4trtrxfctatfpDeli ol(0setrir io4amenmnctat)a2tax o;o0apeomfctatfaDrln p;(0texoio3iytoaD ln s ()sexo(o oo4ope  ietl(f 2ua(mpno1apen oetat s ulnmsnu0 rtnif3to1fptrauvslt  2xoir3oy4amtelici (fsDra(rpoo0oetomfetltfmDrmuvsn(4tltnxo3ty1oa e i s ( setmir iy4apeemietl(f Dtaum no4tee  o3iysfa el( p (0 rxnir oo1fpte u sl()texoxr3oydope mivsl() 2tr(m ou0alenmoeiyt sDelnvo t) exrmf oa1oatrauvo;() rtmxm nudlpe lneslsfsrraurpoo1tpeoio3iltla2um(mo;() ltnmo3oodoaD luesls0setmiopoodoleemncsls)sDur(mo;o0aeeomfeiatfa umuvonu0arermr3tadlm eluvo;(0trur(r iodoltnmfetls sDtaxro;u0olto o3ildlmDumnmo u)treoirciydom   n o;t t2xmim3iu4am e ieslt arrax o;o4olto ieiysfs el(vs;t0tlenir3tatlp eli o;s0seto(opiy4lpeelnvsa()aDuaxro;t1tet iociyslmDeln s;t0tltnmo3iadfptrlueolt) euoiopiudoptelfeta( srrru ont4apt  iciys m el(msnt0tlerifcio1lmtelivs;()t2trxm3ny4lpt  fvtl() 2rmxrp;u4optoiiciys m2rauvo u4texnxr iodfm r uvo t) 2xrim3iu1ol  lfvtlt srtaxr ot4tle  iciydlm2el(mp;(0alermr tadoate ivils texmir3iy1lmtelicilt  rtr(r ;o1alenmi3ils m elnms;u4 etoio3oy1omDr ivi;s  rumio nydomenlneiltfs2rauro;u1teeo icias s rlu pnt4aleriocto1lmtr n o;(  eurimpny4lp elfeilsfsDtmx pno0alxoio3ils s2rmuvs t0 etrir oy1om eauvs;s)t2xoxrpnodam emivtlt srta(r nt1tpe ifcilt s2uluvsnt0teeoxr3ta1lp  auei;s tetmio3oydame lnvsls)s2rm(ro;o0apx mfciasfs rmu o;t0 rtnmo todfp  lieo;( tetm(opiu1ome lnctls aDra(rooo1teto o3tad mDrln o t0arenxf3oodla eluei;s0setoim3oydal e netatf 2rru poo4tetoif3tatlmDrlu ont) rerif oo1fm e iei t)teur(r oo1omtemfeia( s2rru  ou1ope  f3tadla2ra(vs u0arxrxocootopDr ivs;t s2uoxr iy1lm nlietl( aDurump;u1apxnio3ildfm eau o;t4alenxf3oytfaDrau i;t s2xoxm iudomt  fci (fa2rr( pou4aetniociytfs2elumo;u4tlenxo to1fat  ieo s0srtm(rpoudaltelnvsa() 2ur(mp;u1apenmoeilsla2uanms;t0altrxf3ty1omD lues s sruoio3ny4optemfcsl(fsDra(mpnu4aex io3iltlmDrau o;t0 lermo iydlpteai o;t) 2xr(o no1ol emfvt tf Drmxmoou1alxnmi3iys a ranvs;u0tetoxrciodfp  lnvs ( s2uoimpiodam  lfetas)srtaxronu1tet iieiad mDrmums;t)aeeoxr iotlat anvsl() rtrxrpiy4amee feiltf 2urur nt0aeeoiiciysls2rmnvpnu4alenifcty1fp rli sls)trtoir3nydop   ivs s)s2uru  oo0alxn iciydfm uaump (0 ltrmrcta1laD livol() 2xoio3iu1ope lnvtlt)s2rmur nu1oetomfeiyt m2um( p u)tltoxrciytlpDr nei;(0 etoim ou4opeemnes sfsDrrxmo;u1alxomoctysla el(vo u0arxoio totlptr n ilt) rto(mpnu4olen ivsl(fsDrax onu1tlx  i3iadla2uln s;(4trxnifcty1fptr ueo;()srumxo3no1amtn fcsls)aDtr( ont0alxnmfeiydfaDrmn p;() exrif3iadlaDeli ol(0s2xm(r no4alt mictls)s2uax p;t1olx  i3iat a em(vs t0 leoxfciydfmtr n o t) rurxr3iu1lle  feilt a2umx  nt0opt  fetatfaDuluvp;(0tetrif3todlm ranei () 2urxr3oy4olenmivias srua(rpno0olxnmoetytfa2rmnmo;(0 rtnxr3tytfaD au o;t0trxmio3no4ol n nvta(f Drmu oot0oeeo f3iydlm2ulnms u0 exrmo3io1fm eauvs;s  2xoir oudolte nvs tfs2ur( ooo0aetnif3tld aDeau snt0artnmr tadlat  ivs ()teuo(r iy4lmeelivil()srra( p;o4aexnio3iadfs rluvp;t)aetnmo3tydlp r i s t texr(mpoy1llte nvsa(  2tau  ;t1tpenmoctydfmDra(vonu4 etrxf iodfpt  uvo t)trxoio nudol nlnvils)artrxmpot0altnmicildlmDrmump u4tetoxfcty1latraieol()s2urxo oy4oltnlfctatfsDtax o;t1apxo ictldlmDrmn o (4tlxnmocoodlmD livo;( truoxm3oydoltnmnei (fa2ra( pou0aee ioeiaslaDrl(msn(4teenifcootlpDrau s ()texm(m3oydllt mici s aDurx pno0aexo feias a ra(vp;u4aleoiocty1la r u s;t)texoxopoodopenmnctltfarur( pnu4oetnioeilt m2eanmp;u4 renircoa1opteln i ()srxm(m3oy1oltemfesltf rtrxm ;u0teenif3iyd aDulnvonu0tltoxf3iotlp  auesl( seurim nydomtelieias arrm(roou4opxniociydla ranvs u0tlerxocoodfp  aivs;t0 etmxmpoodole lies ()srtrurp;o4aex ioeiydfaDumump;u4 eeoxf io1lmte uvi s seuo(o nodlp   nci t)srra(mpnt0olto ociltfs emu snt0altrifciatfpD lues;t)s2tmim3no4altnmfct (  rrrx  ;u4olen oetas m umn o ()tlenxr oydlpt au o;t0teumxr oy4altnmics ()s2rru  ;t1oltoiietys sDeluvsn() lxnmoctadlaDrlu s;( s2trxr3nydlpt lietl()aDur( p;u0tpxomi3tld a umn p t0 rxoxf iytfaDelivi s t2trxrpio1opeemfcs s)aDtrxmpno0opx moeildlsDeaumpn(0 ltomo oy1fmD ln o s srxm(r3iydamt  iviat aDrmu pnu0alto f3iyd m ra( o;(4tlerxfciodfaD luvs;s) exriopny4lptn icsl(fsDtrumono0opx  ociydlsDumu s u4 rxnxocoytomtrluesl(0 rxo(m oy4opte nvi (fsDraxr ou1tlxo feildlaDulnvs;(0treomf3oadfmD aivo;s srtr(mpiodomee icsl() 2taumpou4apto feiadfa2um(vp (0tltrmoctydfp   iesls)sexmxrpiu4lm elnvsa(f rrm(rono4apto iciyt a2rm(msnt0aetnir ootlaDeaivi t0t2tm(o oy1amt lfct (f ruax p;t4ape iictls s2uauvp t4 reoxociytlaD  ivo;t) eto(rpno4ope mfviltfartmuront1tlxnmfctasls2eln s ()arenir oadfaDe nvi;(0 exmxmpoudllen fci s  2rr( o;t1opt mi3iadfm2em(vp (4tltnio iadlptrau olt)setoxm3io1alt lfvtas)aDumxr nu4tlxnifetydla rauvo u)trtrio oydlpDeaieo t)trtmimpoydaltemnetls artmurpoo1alt mocilsfs2rm( o;u4aexnmr3ta1fatelies;t0 rxmxm iy4amtn fvt sf Drr(mooo4opxn f3ild m2rau p;t4teeoxocia1om elnvil(0 eur(rpny4apte fci (faDuru oot1tlx mociyd s umump u4 rxrmo ia1om  lneo s) eumim oo4amen fct (f 2tau pnt0optoifetlt m2emums;t0teenmo3ta1fate uvil(0tetoxrpny1optnlnvsl( s2ra( pnt4teen feiasfa emuvp;(4alerifcoo1optelnvi ( trxm(rpiu4lle  ivs tfa2urx  ou0tltn ocildla2ranmpnu0arxnif oodfa ran i t0t2uo(m3nudopenlnvsl() Duaxr nt0olenioctyd m2ea(vs;u4 rtnmfciotoa e uei s sruoimpoydomeelfcsat arrrur ot1tex ifeiatlsDuanvp t0arerif ootomD  uvi;t)tetr(opiu1lpe lfetatfs2ta(m nt1apt iieiasla ul(vs;()artnxr3oytfmt  uei;( s2xm(opiu1omenmnvs ()srtau o;u1aexn fciatfs2rlnmp;t)alenir3iy1fmDeanvol() etrxo3no4apt lfvtas  rurxm no0oee moetytfa2ulnvo;t4texnmf3iytom e nvs;t0 rum(opoydlptnlfeias s2trxmo;t1aet  ictaslm eln pn()texnio3iotfmt aueo;t)teuoxo oy1op  mneils  rrau  nu0tleniieild a ul(vo t0 ltnif iadlptrau ilt s2urxmpno4omt livs s srtru ont1tpxomfctad s2umn p ()texrxo3to1oat au o;s0teuoirpnu4lltemnesltfsrurxrp;t4aexnmo3iyt s2uluvo (4 etnir iy1om  ai s ()t2uoim iodop nmivt tfaDum(mo;t0tee  o3ils a um( o;u)arxomf3iatom e n il(0 eurxopoo1ameelfvtl()a2trx ont4olen oeiadlaDul(mont4 lenxr ia1oaDr ivo (0s2xrio iu4lme lfvils sDrau poo4teenif3iltlm2emnmo () rxoircootfmDeaneilt0teumir3iy4am  mnvt tfsDuaur no0texnif3iaslaDumuvpnu)aetrircoydop  anvo s tetrxr3ny1ome  neias a2tm(  oo0teenif3iad aDea( p ()aetrxocty1fatrlnvo;t t2toim no1lmeelfeia()sDtr(root1tlx if3iatla ua( p t0 rxnmfctatfa e ivil(0 rxrirpnudlpeelicsas)srua(mpoo4opxomi3iasfsDra(mont4treoxf3tydlpD an i s0sexrirpoudap nmfvias)a2tauro;t0oex ifeilsfm2rmnvpn(0aetnifciadom  luei t  rxoir3no1am e iesas)sDtmumpnu1tpxo fctls m2rlnvp;(4trxrxrcoy1fm raivolt seurirpno4lptnlics sf rrr(m oo4tltoiietltfm2uauvpnu)artnif3todlp  lu s t)truo(r3iu4lm elieia()aDtr(rpno0opt ioeils s umumsnt0arenio3tydfpDraies s)truoxmpnu4ll emiesltf 2ra(mpou1oexnmictad m rmnvs;t4aexnxo3tydoa rauvi;s)t2xrxr3oy1ame miet s)a2rmu  ot0oexo o3iys mDua( p;(0 lxrxr oa1om   ieols0 rtoxm ou1lp nlietlt  Dumxm no0olxoio3iydfm elu p (0 renmo iy1oaD  ivo;(0srxrxrpiy4omt mfesa(fsrrm(monu4opx mfciatlaDea(mp;(4 lenxf3todfpt ln o t)t2uoxr nu1lptnliesatfsDurum nu4tptomieiad mDrl( pn(0tlxoxr tydlate ueo s0t2uoxo3no1lpt  nvilt) Dtm(mpot0tlt iieild aDra(vs t)aeenir3tydoptr n s ()s2xoim3nudom nlnesl()a2rax o;t4alxomfeiytfm ea(vs ()tlxrmf oa1oaD ln ol() rxrimpnydlp emicilsf Dur(rpnt4tpxoiocilsfm ra(vs ()trxnmo3oa1lpDr ivols seuo(o ou1omtelnvtlsfartr(mooo0apeo iciydfm ea(vsnu)teeoxrctotlmD li sls srur(o3no1lltnmfctat) 2rrx oou4openmociltlm2rmu o (4 leriociodopteaieols tetmio iy1apee ict t)s2tmxrp;o0alxoif3tadlaDrl( o;t)arxrxocoodomtr uvil( trxrxm iy1lmen iei t  2tmx pno1oex  f3iatfm ul( pnt)teermr iatlat lu o t0 rxoir nu4olenmfctas a2rru  nu0tleo octys m2ua(mp;()tlxnmo3ty1op ean ilt0s2trirpoodllee ics ( s2ra(m nt0oeen o3iys aDuauvpnt)texoir3tatomt  i i;() exr(opno1oleelnvt sfsrrmx  ou4olt mietysfs ua( on(4treoio iodfa rauvi;(  rtoxr nodam n neias a2tau p;t4aeen iciydfm ua(ms t4texomf to1oa r ivs;s s2xrir3io4ome  ncs t)aDrmum oo4aexnmf3iadfa rl(vo;(4aeenxr iatfaD luvo;(  ruo(opiy1lme lietas)s2rmx pnu1tetn f3tltla2rl(ms t0tltoxoctytopD liei;s srtr(mpiu4lm elfet ()arrrum nu1oex  o3iyt s rm(vs;()tetoxo iodlp  aieolt) rtoxr iydal nmneiat aDum( o;u1olxo icilsfs rl(mo t)texnmr3totfmt aues s0 euo(r oy1amtemivtl(f rrmu  ;o0olt mietls sDrauvsnt4altrmf3ta1omDrlues;t)trtmxmpnydoltnmfvtlt aDrmuro;t1oeeoifeilsfa uln o t0teerxo3oy1fatraieils) eurirpoydomtn iesls)srtr(r ot1tpxoii3ildla umnvs ()aexoxfciydomDeluvo (  2trim3oo4lle lnvtlsf 2urxm ou4apt  o3ilt a2elumsnt0 etoxo3tadlpte u s;t0texmxrpiy4ap nlfviat srtr( poo0olxnmociad aDrmn p;()tetrxocoadfpteanvil(  rxm(o3iydaltnlicslt)s2rrurpnu4aex mociltls2ra( pnu4aeeomr oo1fpDe ueo;()t2uoxr ny4ap   nes () rraxrooo1tpx mfetyd a um(vs;u4artriocoy1lm e ueols0srurxr3no4alt lfvslsfaDtaxm ;o1apeomieiadlm2elums;t0 rtnir3iy1lm  aues;s0s2trir3oodllen ivi ( srrmx o;t1oeenmfeias s2rmumonu0trtrxf oodomteaieo s) ruoiopiy1ol nmnvi t)s2tm(  oo1tee io3iydlsDumums;t4tetrxo3oy1op   neslt0texrxrpno4lpenlneslsf rrrx pot0tetniiciadlm2uln p t0aetoif3iydlpDrlu o t) exm(rpiudll   ictasfarrrur nt1apt mociytfs2um(vs u) exnif iydlaD lneo t0tetr(opiydalee ieias aDrm(m ;t4alenmfetad m2umnmp;t)alenir3oo1faDr i ilt0teur(rpiy1am e ivsls  rur(  nt1tltomi3ias m eau p;u)artomo3oydom rauvs;()s2uoio nu4amtnlfcsa(fsrur(r nu1aeeomf3iatfa eanvp;u)tetrxfciydfm  lnes t0seto(rpnudlltelfvtatf Dtaxmono1teeniiciat m rmuvs;(4alxnirciodom  lu il( setrxm io1lleemicslt)aruau ont0tee  fciydlm2emuvo (4 leoir iydom  lu s;s0srtoimpio4ap n nvias  2tmxroou4tltoif3ias sDrlu p u4aetrmr3ia1lpt  uvo ()t2xm(r nodoltelnctl(f 2rm( p;t4oeto i3tytla ra( s;t4alenio oatomDelnei;(  etm(opoo4al  lfvtas s2tm(m ;u0olt mietad aDel( s;u0alxoif3oatfp   uvs t0teur(rpio4am nlicias sruru  ;o0tpt  feild sDum( p u4aetnxo oytop  auvi () 2xoxo3io1am emnvia()s2ururp;o4apxnifctlslm rmump u4altnmfcoo1faD ai i;()trxmxo nudolte iviasfsDraurp;o1aeenmiciaslsDrm( p ()tlxniociy1opDrai o;s0trtoirpiydlmen fcilt)sDuauront0tptomfcias sDumnms ()treomo oo1fmDelu s t)sexoxo3nydalee nct sfa2uaxrp;o0tlenmi3tadlmDeauvs;(4 ltnxf3iytoaD anvi t0 rxoxmpno1amenlfctatfsDrr(m ou4optnmfcilsla2rmn p;u) etoir iotlmt li o t0srtmim oudomeelicia() rrmxr nu0alxniociysfsDeauvs u0 eeoif3tydomD auvs;s)seumxr3iu4ol nlnvi s  Dtmxm no4tpto iciyd s2rmumon()trtnxrcootfaDeluvs (0 2tmio oydamt lfesl(fsrrauro;t0aeenmi3iydfmDum( p u4artrxrciydom e neols) 2urxo3nudal nlivsl( srtau pnu1opx  feiltfsDrl(mp;t4tltnxo ia1lpte i olt s2tr(rpnu1altnmfvsa() 2um(m ;o4apx iicildlsDrmnvs ()aetrmr iy1fptrln s;s) rxoir nydop   nes t  rua(  nt1tptoio3iydfs rlu s;t0 rtomr3iotlpDeanes ()sexmxopoydoptnmnvs ( sDtaur ;t1opeo ociltlm2umuvs t0tltrio3oadfat  nes (0 2triopnodomenmnvtatfaDuru pnu1tlx  fctysfsDeanvs;(0teermfciy1omtraieo;s trtrio ou1amee nvt t sDra(mp;u1olx  oeildls emu p;t4 lenmr oa1lat lu ils texo(m3nodllenmfcs ()a2ra( pno4apxnmfeiatfsDumump;t)tlerxo3ta1omDrlnvi () etm(o3oy4amt lies (  rtrxrpou1opto ieiadfm rl(mont4 rtrxr oatfaDraneslt)teuo(opiudap  miesltfa2ra(r oo1tpxoifctysfs ulums (4aexnmo ootoaDelu i (0 rtmxrpnu4op  mivilt  rrru p;o0aexoio3iad m rmnmon(0 renmr ootfaDr i sl(  ruo(r iu4olte ncs (fa2tru  ;u1tltn iciyslmDeanvonu0alxnxf3oodfpDraivo;t)srxoim oy1optn icsasfa2rm( p;u4tet ifeiat a2ranvo;t0aleoio oodfpt lueo s)t2urxo3iu1omtn ici sf Dtmx  ;o1aet ifeiyd m el(vs t4aeeoxr oodfpDe neols0texmio3nu1lpt liei ()s2taxr ;o4apt  ietytlmDelnvonu0 ltomf3io1lpt  u sl(0t2ur(r io1lm   ivilt a2tmxmpnt0oexnmf3tat aDua( pnu)tetomf iatlat liei t)srtmirpoydamtnlnvi t)aDtaxrpnt4alenioetaslaDrl(mpn() rermo oodlpDeln s s) rxmxr oodom e iesat) 2ra( o;o4tlen f3tltlaDrlu p u0trxrmfcoatfaD an sl( t2umimpnydlmtn fvslt)arrmu o;o1teenmociysfsDemu s;u0teerir3iydlpte i ils  etmim iu1om emictas)s2um(rooo4tpe  feiydlmDelumpnu) rtoif oo1fptr uei;(0s2uoxopoudope lietlsf Dtr( ono1aexoifciydfaDrlumo u0aeeomfctytfaDeanes t t2trirpnu1apen ivi s  Drru ooo0aexo ietysfsDem(vp () eerio3to1lmtr uvi s)t2xm(opiu1altelfeils artruronu0optomociaslaDum(vp t0artnir3totlmt aneol( srtrxrpnudllen icilt aDrmur ot4ope mictlsfa2ran s u0trtomrcoa1omDr u ol() 2umxr3oo4op elnvtasfaDuaxr ot0aeeniieildlaDrlnmo t4tlxrmrcty1fmDeauvols)s2to(r3ou4ome mnetas) rrmx onu0oexn oetltla rmuvon(0texrxrciodfmt  i i () rtrxm3nu4ol  lfvilt  Drm(mpoo4aexoiiciys a ul( pn()areoir ty1fm r uvo ( trtrio3iu4opt  fcsls)arra(ront1alx iociydfm ea(vpnt0aeerio iytlmD auvs;() exmxm3ou4lltnliesls sruaumo;t1teenio3tydlmDelu p;u) reoircto1omtrlivilt)trur(r3oodoptnliei t  2tr( o;t4oeeoifciltfm2ranmonu0tetnmrciatoa  auvs;t0teuriopny1alte icil() Drm(m oo0oltnifetltfaDuau snu4tleoxociatfmDraivo;s)srxriopnodolee ieilsfsrumxmp;u0alxnmfcilsfsDua(mp;t4trermoctydomtr neo;t tetm(m3no4llte ncsltf 2ua(r oo0opxnioeils m el(mo ()tlenir3oy1oa  ln ilt0s2trxr iu4al emivsltf Dtr(  ;u4tltnmfeiyt sDeaums;u0 rerxocoa1omD aieo;() 2tm(o3iy4olt lfeta(fartrxm oo1aptnii3tysfs elnmp;t0 lenxo oadfmteluvo;( t2xmxr3nodam nlncia(fs2rmu o;u0opt mociat sDrl(mont0 lxoxr3oo1la  auvi;( setmxo3nydamenlies ( a2raxrpoo0olt mo3iatfm2emnmpn()altnio oatoatrlu slt)sexr(r no1lmeelncsas) Drmu ont1apt mi3iyt mDranmo;t)texnmocty1lmte uvi;()tetrxmpoo4lmtemfcia() Dua(mpou4alx mictytlm ran p () exriociotopDeanvs (0 2uo(r3nudlle  nesasf rrru o;u1oet ioeildls2uaumo u4treoxo iydoaD lnes;(  etrir3io1ll nlfei sfs2rru pno4apen feiasfm2ulnms;()trtomo iydfm r nes;t0tetr(o iu1optemnvslt)arrauronu0tee mfeilslaDeaumonu)teeoircoo1fmt  n i t  rxoxopou4ap emfvt s arrm(rooo0aex mieiadfs2eanms;(4 etnmr tytfmte i slt srxmio3oo4alen ietl(faDra( pnt1opxn f3iyt aDeanvo;() rermrcio1op  aueilt)setr(r iydllee ivtasf Dtmur ;u0apeo iciys sDrm(vs;t) etrmf io1oatrlu s;t seur(rpoydlmte netat sDrr(mo;o0texomo3iyd a2umumo u0 lenir io1laDeli s;t)seto(m3iu4omtelnvtas) rtrur ;o4tex  fetyslsDemums;(4trxnxo3iodoat  neo;s  exoio iy1apte fvsat aDrmxroot0tpe io3tydlsDumnvonu4alenxr3ta1la ranvo;()srurirpiodlp nlfet t) Dtmu oou0teenifeiatla ra(msn(4tlenmo oadlpDe nvolt)s2urio3nudopt lnetlsfaDraum oo0aeeo f3tld sDranvpn(4 rxrxo3todlptrliei s  exr(rpny1op  lnetat)artrx  ;t0teenii3tysfm2uau pnu4altnio3iydfm raivs s0srtrio ou1lpe lncsa()artmxrpoo0aeen feiys m2elnvsnu4aeenmf oodfa rluvi t)tetrio3ny1apee ncs ( s2raumoou1opeomf3iyd m2rlnmpnt)aeeomrcto1oaDraneo;(0setm(o3oudape liesl() 2uax  ;u4aetnmoeilt m2ulu pnt4tetnmf3io1oaD li sls0s2trxr3nu4llt lnvtls)arrmu  nt0aeeomoeiatfs2el(mp (0trxoircootomteli slt0seuo(m3iu1apee nesl(  2ta(rp;t1oltnmfcilslm em( snt4 ltoif3oodfa eauvil(0t2umxopiodoptn fctl(f Dur(mooo1opxomociys m ulnmo t4tltrio to1lptr uvo ()texr(rpoudam e icsas)aDumxm ;o4tlxoioeiys sDrluvsnt4tltnir3ta1oatelivi ( setoirpnudlme micia(f Drm( onu0aetn oetadlmDua( sn() ltomrcia1lmDrluvo;t teur(r iu1alee iei (f rurxrono4texoiiciasls el( o (0arenio3ootlp eaneilt)s2xrim3nu4lm nmnvi (fa2uau pou4tpxoiictasfa rlnms;(0tltoir3ootoaD li sls0trxr(r io1lle mivia( a2tmx  ot1alxo octad m2emuvo ()alerxfciadfmteau s s) 2umxo3iu1lmt lnet s sDtax p;t4tlt if3tldfa umnvp u0alxrmrctydoaDrai ols0 2tmxrpiu1oltnmfcia() rurumoot0aeto oetatfa elump;(0trxnir3ty1fptr n o;t0trtoimpnu1omtelnctat)sDum(mo;o0tptnmfeilslm2umu p u4tetomo tydoaD livs;s)srurxm no4altelfvi ()sDtr( onu0aleomoctytls ua( snu4aetoiocoodop elnei (0 exrimpnu4olen fcsat  rum(m ou4aet ii3tyt s2eauvpnu4trerxo iy1lptrln s;t0s2trxm iu4ape mfcsl(  2ta(m nu1opx moctys sDua(mp;t4altomf3oydlpD lnvs;()t2xr(o3oudal e ietatfa2ra( p;t1alxn f3iyd mDuauvs t)aexomr3iy1fp   uvs ( trum(m no4ll emnci ()sDtaum ot0optnio3iydlm umuvp;u) eeomr oadlptelieils)s2trir3oydlmtemnci ( a2ra(ronu0openioetlsls ra(mp;u4 reoxo ty1oaD anvsl( trxr(mpio4om emnes ()aDtrum ;o0tlxnmf3iatfsDemn p u4 rxrxf totfa rlneo ( s2xoxm nodomeemnct sfarra(mp;u0tlx ii3iasfs2emnms (4aeeoxr oa1oaD lueslt  eum(o oo4llt lnet ()a2rau pnu4tle mieils m eluvo u4artoxoctatfat  iei;s sexoxm ny4ap  miesls  Dumxr no4apx  fcilt m rmuvsn(0tlxoxfcoatfa ranvsls0 2toxo3iy4lle  fcs t)a2rm(r ;t4alxnifeiysfa rm( s;u0treomo3iadfaD livs () exo(rpno4altn ieil() 2ta(m ;u1alx  feiytlm ra(vp;t4texrmociydom  aivsls trxo(o ny4apenmnesas  Dur(rp;t4tpe if3iatla rm(msn(4altomfctodfaDeanvilt setm(m3nudopt licslsf rra( pou0apeomiciltfsDrm(ms (4alxrmo3oatom  lnvo;t)s2trxm3iu1aleelfvsltf Drm( pno0tltnmi3iadls uau p t4 reomf3to1opt  ies s texo(m3ou4lm  lnvt (f 2rmxr ;t1alxo oetat s um(vsnt) ltnmr ta1fpDrlnvilt  rxoxmpno4lmt  ieilt  Dtm(r ;o1altnmfcildfaDrmnvpnu0tlxrio3oodoat lneo;( srxmiopoy1olen ncias) rurumonu1ope mo3tyslaDra(vo () reoio ia1lmD lnei;t s2trimpiy1lmtemnci t  ruaxro;u4tpx mocias mDrlnmp u4 ltrio3tytopDr i sls) ruoir3io1ll   fesa(fsDuaumpno0oet ifciys s ulumont0teenmfciadfp ran ols sexr(r3io4al nmfctl(f 2rrxm ;t1tptnmf3iyt a2ulnvo;u4texoif oo1lmte nvi t)trtrxmpny4olt  ictas)a2tr( p;t0aet mf3ild mDulnmp t4 eerifcoydfm elueilt) rxoio3nu4omenmfctas aDrrx p;t1olxn icildla uanvs (0alermociydomtraieo;() rurio3io1llt mici s  Dtmxmoou1tptomf3ias s ran o () eeoif3io1fatr n i;s texo(mpiu1openmnvias sDurur oo1alxomietadlmDuan snu4texnif3totfp   neo;() eto(m ny4lpt lfctas)srrmxmoot0tex mieiatfm ulnvs;t0teerir oa1fmtraieil(0truo(mpnudam  livsls  Dtr( o;u0tptn ocilt s ua(ms u0 rxrxociodlmDeliei t0 2urxr3oudap   fvia(farur(  oo4teenifeiydfaDel(mp (4alxrxr3io1lp  aieo (0tetoir iy1om   fvsl( a2rmxr nt0olto oeiatfs ra(mo (4arxrxocoadoat  nes s texrxo3no4al nlivsatfa2ururp;t4oexomi3tltfa2em(ms t) rxoir3tadop e ues t)tetr(mpiu4ome lfviasfa2trx p;u1altoio3iaslm2rl(mp;u4trerio iodomt  uvs;s)tetoxo ou1ope lici s)s2rrxrpno4aexoif3tlt m2em(mo;u)aetnmo tatlpD lu i;s)trxo(opnydalt lictas sDuaumpno4opx ii3taslm eaums (0 rxnxf ootfmtrai o s0trxmxr3ny4lpenlnctls  2ta(ront0aetnmo3tld s ranvo ()aetrxocootlm e nvi s)t2umiopou4op   fvt t s2rax ooo1oexoiiciaslm rlnmsn(0 lxrircoo1opDe nvs t s2uoxm io1omen ieilt)s2uaxr ;u4optnifeilsfm rln o u0tetrxr3oy1faDeaieil(0srxmxmpnudoltemnvi ( arraxr oo0oet  f3iytfa2rl(vp;t0aetnxf3tadomD li s s0s2um(rpiydlptnlici () 2ur(ronu4alx ii3iysla2umn onu0alxrmo3ootlptraueo;(0teumir iu1ape lics s sDtr(mpnt0tex micilsla2rm(vo u4tetnif ta1omtrlu sls)trurxm3oo4lmtnmfvilt)sDrmu o;o4aex moetytla2ulnvont0alxoir3iatomD  nvslt0sexr(mpiu4lp n nvt s  Drmx  oo4ole  iciltfa2ea(vp;t4aetrxf3todlpteaiei;t0sruoio nu1omt mfvt t)sDtrxrpot4tpx mociadfa2umuvs;u) lxrxf3tydoat aiesls)tetr(m no1op nmnvs ()aDuru ono4apx moeiyd a2eauvo;(4aexnio io1faDeln sl(0trtmxr ou1lm  mics ()aDtrum ;t0tpe mf3iyd s rlnmo;u0altrif3todoateaivi;(  2xrimpio4om nlicilt  rrrumpot1aet  fetysfs2el(vsn(4arenxo oa1lpDelivilt)texo(rpnudlpt lncsat  Dra(  ;u1tpe iicildfsDrl( s;t0aleoir3oytlm   ieol()t2xoio iydlmeemnetlt aDrr( o;t0aeen i3ilt s em( o (0altrmo ia1lmtrluei t0t2uo(rpoy4openlictas)arumum oo0altomociys a rm(vpnu4teermr3io1oa e n i;t0 etmir3nu1aleemneiatfsDrau  ;o1optniietydfm2eluvsnu0 rermfcootoaDrauvs ( s2xm(r iydom e fctl(f rur(mp;o0texoiietlslm rmn o t)trtrir tydoa rauvolt) 2tmim ny1apeemnviat) rraur no0tltnmf3iytfaDuaums;u)aetoxrcoytomt luvslt)srtmxrpno4olen ivt t  Dtm(m ot4aexomo3tyd m ul(vs;(0 lxoif3iy1oa  anes t0srtoxo3io4omtelnvt s s2trurpot0olx ifcias s elums;u)trxrir tatfp  an sl()srtr(m3oo1opeelncs sfsDumump;t1alxn feiltlmDrauvp;(4altomfcoadfa eau s s setmim oudoptemnvi sfsDua( pnt4oeenioeiadlmDuaumsn(0arxrxo3oydoatraivs t)trxm(r io1aptnmfcs t)aDrm(m nt0aexomoeiad s rmnmonu4tetrxf tatopteau ols  eumxr iudope  fvi ()s2umxrooo1tlenmiciydfaDumn pnt) rxoxfcta1opDe i o;t0trtrio3ou4ap nmietat)s2rru  no4aet  ocildfs2emuvon(0arenio3ia1la  anei t)s2uo(r3iodoleelicslt) Dumx  nt1aetomietytfa2rlnms () lxrxr oadfmDe ivol()sexr(o3io1lptemnci t) 2rax p;o1alxnio3iad s2elumont4 rtnxf3ia1omteluvs s0 eur(r3oy4ll nlnvi ( s2urur ot1aeto o3iatfsDel( o (4 lxnxo3oodfpt  ieo;s0teuoim3nudale lnesas sDuax onu4aexoiocild s2raumpn()aetoir3oadlatrai o (0seuriopnydlmt mfcsat aruru ooo1optnifctas s2eanmp;u0 renif ootlat  nesls)sexmirpiy1lpte ieiasf 2ua(m oo1texo iciytfs2rmn o;() eeoif ootopD  u il() rxmxo iy1ap emnei ()aDta(m ou4tpxo i3iyd a2ra( p u)tltoir3oo1oaDr u ilt0s2tr(r3io1altnlnet s aDra(m nu1apxn feildls el( o u4trxomf iy1fpDeln o t trur(opoudamtnmfctatf Dum(ro;u0oeeoifciatfa emnms t0 eermo oytla e ies;() eurxopoodal  lnvias)sDra( o;t0ape ifetydfs rmu snt) eeoir3todomte u s s0 2xmimpno4lme lfvtlt aDrrumoot4aetnioetysfm elump;(0 rxrmo3ia1omte iei;t0 rum(r oydomee ieta(f 2rrumpou1oltn i3ias m2ulums t) reomocoy1oateaivo s seur(r nydop e ncs s)sDururpno0olt ii3ildfs2ulnvpn(4 etoxf tytlaDelues t s2xmim iu1oltnlieil()aDrr(r ;u4olxoioeiaslaDumnvsnu0tlenxo iy1opDeli o;(0 rxo(opoudale mnet s artrur ot4tetoif3iltfmDel(ms (0aeermo3io1fmDrau o t0s2xoirpoy4lpt lfvsa()sDurx  nt4alx mociysls rm( s u)teeoxrciotfa rlu i t0tetmxopou4amtemivi t artr(rp;o4tpxniietlsfm2rln o t) etnio3ootomDr n s t0srtmir3io1ll  mies ()sDumx o;u1tltnifciytla el( o t)trtrircio1fpD aueo ()sexoim oydame  fvi sfaDrru pnu1tpeoif3iyd m2rmumo (0 eerxoctodlmDrauvo;t  rum(rpoodamte ncia(  rurx oou1tlxnmo3iat s rmnvo (4arenxo io1oaDe n olt0s2tmxrpiodol elnes t aDrrum nu4olxnio3tyt a emumo (4 etomr iatfp eln sls)srxmxo3oy1ol emnci (fa2uaum ;o4aexnmfciytfs rm(mp;u)alxoio3io1fatrln s;s s2xoxopny4lpe lies t aDumu oot1olx ii3tadla ra( p t0tlermr iydfpteau ils0setrxr3ou4olee fet t s2raxm ;u1aetomfetasfs2rl( o u0aexoxf3iatfa  auvs s0texoxr iu1ol   nvs ( aDra(r ;t1tpt  fcildfs ra( ont) eenir ta1lmtr neil( trxr(m3ny1lptnmfei s srumxrpnu1tpxo ociys mDrluvo;t)altoif oatlat livo;s)t2xmir3ou1lpt lfesl()srrm(rp;u4ope mo3iytfa rau o;u)arxnxr oo1opDran i;s)trtoio3oo4ape  nvtlsfaDraxro;t0tetnmoeiydfmDrmn sn(4 renxf3oydlm eau i s0tetmxr3oy1lmeelicta()srta(  ot0apt  oeiytfa2emnms t4alermociy1opDeln o () exmxmpiu1apt lnet (faDrmxrpno1tetomieiasls rl( o u4alxoxr3to1faDrln i t trtm(m3nu1omen icils)sDuau  ;o1tpe micild aDulnmp ()tlxrmo io1om e ivslt0srxm(mpiydlleelnvslt a2trxm oo0apenmfcilsla rl(vs;t)aexnmf tatomtelivs;s0trurxo3ny4apt lfvi t  2tau pno1tle ifciad m um(mo u4 lenmocoatla eai o s0 2tr(m iudol elneia()srrr(monu1altnifeildlsDranmo u0 exnmr iatfateauesls0srxrxm no1ome micil(f ruau  oo4aetn ictydlaDumumsnu) rermrcoo1fmt  ieo;s)sexmxr3oy1ll elivsasfsrrm(mono4olxoiieiyt a eluvs;(0arerio ootfpt  n o t0t2ur(r3oo1aleelnesl()artrxmp;o0oex  f3tatla2uau o (4trtomoctotopt  u o t) rumir3ny4apen ics s sDtrxr oo0oltnmoeildfs ua( pnu0tlxrxf iatoateaivo;s s2uoxm3oy1alenmncs ( srumurpoo0tlxnmi3tat mDulnvp t0tetnir ta1lpD  nvs;(  rxmim3oydoltnlfes s) 2umurpot0ale miciasfmDrmnmpnt) rxrmrciydoaDr nes t)s2to(rpiu1aptnmfvt sfaDtax pnt0aleniictlsfs2rmums u0 lxrmfctatoatrln slt0 rxoim ny1amtnmfeias)sDtmu  ;t4tlen o3iyd sDulumon(0trenxocto1fp e nvi () 2uo(o iy1olee iciasf 2rrx  oo0tet io3iltlsDrlu p;t0aeeomo iytfmt auvo (0t2trxo oy1llt  fvil(f Drr(m ;o1tlen ieiatfs2rmu s;() exoioctadfaDrauvi;t) rto(r3iudopenlivslt)a2ta( onu0tpt  ociatfaDelu onu)tlerxo iydfat lies;t) etrxo ou1lptn ici tfs2tau p;u1apxomi3iat mDum(vo ()aexoir3oytom e n i (0srxoxmpiu1omtelneslt)sDuaxrp;o0oet moctat sDuauvo u4alerifcta1opD lneils srxoir3ny1omtelnvi ( arumur oo0apx mi3iatla2uauvsn(0aexomrctadoptelivi;s) rxmxm oy4lp  micilsf rrm(mpnt1aetn o3ilsfs emuvp ()areomo iadla e uvo;t0 rxrio3no1olt lfesa()arrrurpoo4ale ifetas s uaums t)alerif3todlm ean sl( srtrim3iu1lme liviasfsDraump;o4oltn ieiltfa rln o;u4aeerxfcto1opDe ieo ()teuo(opio1llee nctl( srtmx o;u4tlxn oeiydfs uaumo;(4 lxrxf tydoaDe n ols  exmxo3iu4om  lnet t) 2tm(m ;t0aexnmi3iltlm rl(mpn(4artrio3tytfm  auei;t srxo(rpnydale lnct (  rtrxroou0opeo oetlsla2rauvsnt)tetrxfcoytfa r uvsl( trum(m3nydom  lici sf rrr(mpoo4tpxnio3iad mDranmp t0aleomf oatfm   i i;t0 euoio iu4oltelnvta(f rrm( pnu4tltnmfciys s raums;u0trtnmf3oodop eaues;()s2toim no4alee ivtls  Dumumonu1ape mo3ilsfmDumn s u4trtomfcootfmt lnvo (
\ No newline at end of file
@@ -0,0 +1 @@
+ivs s0 etmim oy4alenlnesls aruax ooo1optomi3ilsfm ua(vpnu0artomo3tadfat li i;t)srtoxo nodll nmfvta(  Durx onu1aptn oeilslaDumu s;u0 exoxf oadop rauvi t)trxmirpiu4altnmncsat)arraxr nu1olx mo3tadfm2rm(mo;u)tetnxf3iydlpD liei;s0t2tmio3oo1lpeeliciat a2uaurpnu4tpxnmoctasfaDrmuvs;(0tlxnxfciatlpteaivsls) rxr(opoo1lpe  nctlsf rrmxrp;u0apt  oetlt aDrln o;t0trtrio3to1la   n s;s0srxoxo nydlltnmnctlt)arrm(mo;t4alxnif3tas aDumn s u4 lxriociatopD auvi;( sruo(opoo4ame  fctls srumum ou0aee io3tatfa ean on()tltnmociadlpDe ivsls)trtmir oydllee ivtlt  Dtrxm ot1tlx  i3iltlm rmnvs u)tltnxrciodoateaivo t0 etm(o3oydamtnmieslt aDrm(r ;o1opxn f3tldls2ea(mon(0 rxrmfciadoaDeai i (0 2tr(o iydame  ivi t  Dtmurp;o1alt ifctyd a eanmpn()texnmr3oy1fpDranei t0srto(r3ny1lm n ncslt)s2urxr ou1alen i3tltlsDemnvs;u4artrircty1oate ivs;t)trxoxr iudom   nctltfs2rr(mp;t0alx  fctld m2rauvsn(0tetoifcoa1fmtrlivi;s  eto(m3ou4lltnmnvt t)a2tmxmpnt0tet  i3iatfm ea( pnu4 rerio3io1fpDr iei s srxm(opiu1lpt mivilt) Duau oot1tex ii3ils a2rln s u0 etomr oy1fmtrluvo;(  rtm(opny4om  lfesltf Dtr(  ou1tpenmocild m2uaumo u0tlxoifciytlmte u ils0trtm(o nu4opeemieil()aDtmu p;o4olenmfciat m2elu s t0tleoio3ia1fpDr n i t0texo(opnodllt miesls srumxrooo1oexomoeilsfm rauvp;u4 eerxr iadfm eli o s0s2uo(o3oydlpen ivi s)a2ua( oou4olx  ieildfaDum(mp;u)aexnxo tadlaDe ieo;(0tetm(opnodam  livtas)a2raxmpno1aeen iciytfmDrm(vp t4artnxo iy1op   n ilt0 rxo(m3no1ameelfcia( a2urxmpnu0oex io3iydfsDeauvp t)tltoir3tydopt aiei;t  2xrxr3no4lp  mfcta()sDua(  nt1alt  octyd m eluvp (0texrmrciy1omDr i s;t)sexoir3iudolt lnciat) rurumo;t0oeeoifetltls2rauvs;u0areomfcoatfm rlnei;s sruoiopno4am n ncilt) rrrxm ou4tle ifeiltla2elums;(0 rxrxr oytlaDean s t0 exoio3ou4olt  nes s aDrax  no1opxnmi3iatlm ea(mont)altoiocoatfp e nei;(0 rtoio iy1am nlivils)artmxmpnt1tet  f3tls a2ea(vpn() lxnif3iydfmt anvo;t0trxoim3nydaptnlfvs t)artrur ;o1oexn f3iydfmDuln on(4trxrmf3oytomtrlu sls0srxr(o iy1lp n nvi sfaDraxmoot0oeeoiicilsla2uauvp;u0altoif3iodfm   nes t tetrirpnu1am emicta(  rrr(rp;u1olx mictysls eaumon(0alxrmrcoo1lpDran sl() rxrio oo4lmen netl( aDtm(rono4ape if3tldfa2ra(mo;(0tlxoxocoodfaDrlies t) etmxm3oy4ol elnvsltfsDtmurpnu1aex  oeiytla2uau s t4arxrxf iotfm  lieols trtr(o3oo1ll  mfesltfaDrauro;u0tpe ii3tysfaDranvp t4texoxf ootfa   uei;()teuoiopno1apen fciat s2rm( pot1tpe  ictytlm2em( o;u4tetrxr oytomt an s t0trto(rpoodomt miei s  rtm(rpnt1tpt  o3iyt a2emnvpnu0tltrir oo1fatrlieol(  rxmxopno4opt  ivtltfartau onu4optnmiciys aDuanvo t) etrmrcoytlaDraivo t srto(rpoo1op   fct tf 2trum ;o0alxomf3iasls2uauvo;t4tltomr3iytfpDrauei;t0 etmio io4lmtnlnctlt srraxmpot4olxnifeiatfa2rmumsn(4alxoxr3tytoaDe nes (  2urio ou4ome lncil() 2rr(mpou4tlxomictydfm2umnvsnt4teermo tadoa ranvs;t s2trimpoudap elnct t  Dtau  oo1tpxomi3tadls2emnmo (0teenmr3todomte uvslt  rxrxr3oo4lmenmnvias arraxro;u4opxoii3iatlm ra( o u)teenircty1fpDrlivs;(0 2uoirpio4ap emnct t) 2umu pou0tpxoioetysla2ean sn(0aeerio oatfa  an s ()seto(mpnu4ole micias)srta(rp;u0tetnifeiysla2ranmpn(4aetomo iydfp elivo s t2xrxo oydllt lics (faDrrxrpno4aee io3ilt a2uaums u4teeoifcio1lp rli o t0trtr(r3iu1al nlietltfarurumpno1oex mfetysfs emumo t4trtrmo iadfaDrli ols)truoxopoo4op   nci ( a2tr( p;u1aeeo ocils a2em( p;u) ltnxr oodfp   nvi (0 exmimpoo1lmt lfvtls)srrm(r nu4altnmi3iatfaDel(vs u0tlxnmfctatop e ieol(0srxo(rpiu1omtelneilt)a2urxm nt1altnii3iysls2umn s;u0texrxr3oadfp e ivi;s)trtrxmpny1lltemnvtasfaDtmu  no4aex micias s ranmp;u0aetoio ootfa   n ils0 rur(r3iy4aptnmfctatfsrrm(monu4openiiciad s2rlnvs;()aetrxrciadoa rauvi t srto(opno1ap nlfei t artm(  nt1aptnii3iydlm2ea( s;t) leoxrcoa1laD  nesls) etmio oo1optn nvi sfs2rrxrono4tptoiietat sDumnmp;u4altrif iatlmteli olt0 eto(o iydamtn fvs s  2rmxr oo4tlxoiieildfa2uluvonu0tleoio oodfpDran o;t0srtoxr3no1altnlfesat)s2trxrp;t4tptoifciytlsDua(ms;(4 leoircta1opDrlnvo s) 2toio3oudopte ncia()srtm(m ;o1tlto i3iytfsDuanvp t4areoir todlp eaieilt0texoim ny1lmt  ivslt s2rmxmooo4apx ii3ilsfm ranmsn(0 lxomf3oo1fmD aivo;t) rxr(mpio4opee fvt t  rumum ot1optomfeiyd s2rl(ms (0alenmo3oodfpD lu ilt)srum(m3ny4ope  fei t s2uax pnu1altniietyd s raumo u)trtnif oo1lmDr nes t  rurirpiy4omtnlnes ()artaxmono0tpeo ictldls emuvsn()treomr oatfaDe n il()t2to(opnu4llt lnvils)srta(r ot1tleoiocilt m2ra(vs;u) ltrxfciydoaD anei;s srxoxopnydll n nctas) 2raxmonu4aeto ictyt m2elump t0trtomr3tytomDeaivolt)s2to(r nu4ale liesat  Draur ;o1olt if3tasls rm(mp;t0 lerxrcto1oa  ln o (  2xoxo3nudop emfvs s  rtmxrpou4tpxoif3tldls em(mo t0aetnxrcoadoat lneols) 2urimpiy4ll   feslt)sDum(rp;o0tex  f3iysls2eaumpnu4alxoxfctydopteaivi ()trtr(o3oo1optnmfvsl(fsDrr( oou1tlxnii3ias mDemnvsnu0aexnxo3iatfmteanvs;s)tetoiopnu1lmen ivt t)a2uaxronu4tpeoiictydfaDemn snt4 lxrmr oodlmteaueo;t0 2xmimpiu4lmee fetatfaDtrurpnu0open ociytlm2emn s;t)aetoxrcoadfmDelneo () rur(m iodomtnmneias a2uaxm no1oltnioetld m2rl(vp u) lerif to1lm  lnvo (0setm(m3iu1apen fvia(fa2rrxmonu4aeeomo3ias m emn on()tlenmr iy1fmD lu ils0s2xoim3oy1opt mfesl( aDrrx  ;o1oet mfcilsfaDuluvsnu)tlxomf oydomD  n i s) ruoir iy4openmfvias  Draxmo;o0altnifeiysla elnmo (0tetomf oadla rluvslt) rxmir3ny4lptnlfci (  ruax ont1opxnifeiydls elumpnu4 ltomr3oodfpteaieilt)srtoio3io1ap elfeias artmu pnu4olx  i3iyt m elnmp;t4altnmr ia1fm raivo ()trxo(opiudlmtn fcils) rrmxmoot0tpxoiiciydfm2umums u)alxnio3oytlptrlnvs;(0truoxm nudal   nei (  Duau pnu0alxoif3ias mDrmnms u) exrif oa1fpteluvolt)seurxr3oy4ope lnvt s s2urumoou4aptnio3tls a ua(mp;(0alxoxo tatom rluvi;t0 rur(m iy1optelietl(  rrax  nu1ope  o3ilsla ranmp;t0artnmo3oadfmDrli ols) eto(o no1omtemfvt () Draxm ou0tet mfeiad aDrl(mo (4aexomf oydlaDeauei s)t2xm(opno1amt lfvslt) 2umxmo;o4ole  ictyd m ulnms;u4aexomf3tydom rlueo;()s2ur(m iodlmtelictasfa2rmur ;t0tltn feilsla2um(mpnu4tleoxr tadfaDeanvi;s  eurio oo4om elietlt)aDrrumpoo1tee ii3tld mDulums;u4 leoirctytomte ueo s s2xm(o iy1lltelieslsfarrmxmp;o1texoiieilsls2umnvs;u0 ltoxo3iy1oa rlivi s)truoxrpou1lp   fvs sfaDrmxrpot1tpx ii3iaslsDuauvpnu4altnmocty1opDr u s s)s2tmimpou4lmee icsat)s2tru  no1oexniieils a2emu o (0alxnio3oydlm r ieol()teurim3ny4altnmivs sfsrrmxro;o1optomieiysfs2ua( o t)artrmf3ia1om e i i s) rtoxo oo1omtemivtlt)srrmur ;u1oet if3ilslm eanms;t)alxrxr oo1omDeaiei;() rxrir3iydlle  ics t artmur oo4tee mieiltla2rmuvsn() reoxf oadomDr ieo;s) ruoiopny4optemnesasfsDumumpno1oexnii3tls m2emumpnt)aeeoxociytlpteaiesls t2um(r3iy4ome lfetas)aDrru  nt0tlen o3iyd s2rl(ms;u4tetoio oadlpD  nei ( srurxmpoodapenmfeslt  rururpno4tet  fetls s2el( s (0 leomf3iodopt  u o;()s2xr(o io1apen ietltf Drm(moou4oexo oetldfa2ulumon(4alxrxo3iy1fp  lu i (0s2umiopiy4opeelnvil(  2tmx pou1oetn ieilsfaDul(mp t4tlerif3todlpt li ols0trxrim iu1oltn nviltf rrmumpoo1ope  oeiad m2ua( pnt4tlenmf iatlmt aneils0trxm(o nu1aptemnctas  Dra(rpou4oleoiietyd m2ua(mo;t4 etnmociadlp  ai sls trxoirpiy1lpt mietas srtr(mpou1oetoiiciyd a rl(mpnu) eeomf3tadfmDeaiesl(  rxrxo oodllenmnet s)aDuax o;o1teeoioctas m el( onu) eenxo3oodfm  lies (0trtr(m no4omt livia(fsruru oou1alx  fetltfm um( o u) exnxf3oatfm ean i s)t2urir3io1openlfvtat aDtmx pno4oet io3ildfs ranvo t)aleomrciodfmt  ueo t)s2urim iudol elivs s)s2urur oo4oet  o3tlsfs ran p u0 rerxocoytfmD lnvo;s)trumxo ou1optn nviat srua( p;t1oeen ietatfs2elu p;u4 renxr3oydlptr i o t0s2uoxm oydal nmnvil(f Draxro;o0altoio3iad aDrln s t)tltrmo3iotlaDe ivs;( sexr(rpoydll nlncias srur( p;u0opeo oeiydla ulnmpn(4artomo io1lptr u s s  rtrir io1ope lfvi t  2raxmpou1tpxniieiydfsDrlu p;t0 exnif ia1op ran slt0 2xmxm3nu4op  mnvtat srrmxrpot4tetoioctas a ul(vs (4areoircia1oa rln s;t  ruo(mpou4lp n nci ()s2rmumo;t1tlt  oeiytlaDeau sn(0arxoiocio1oat auei;s0 rum(mpno4opt  ivt ( srtr(m ;t4openmoeildlm rl(vo;u)aexrif3iy1fmD auvols)srxmio iy1lp nlncias) Dtaum nu4olx mieiyt m2el( o t4 etrirctatomDrauei t)sexmxo3nu1olt lfcil(  rrmu onu4tetoio3tys s elu pnt0altnmo3tadlptelnvo;t0s2tm(m3iy1aptnmnci () Dtr(r ot4texo f3iytlmDulnms t0tetrmfciatlmt aneo;(0sruoir3oo1lp  mnvil()aDrmx p;o0tle  oeiad a2rauvonu0aetnxf iydfp r iei;s)teuo(m3iudlptnmnvsls) 2rau ooo1oee  ietlsls elu snt4tltnmfciadfmD anvsls srtoio3no1ap  mfcsa(f 2umx p;t1opxoioctytfs2rlu p u)tltrxrciotfp  au o t0 exmxopnu4ap n ici s)a2rau pou4aetnmi3iydlaDulnvs u) rtrxf ia1fat  u s ( srxmxr nu4lmtnlieslt aDuax  nt4aexoifeiltfa uauvsnt)trtnifcta1lpD  ieo (0 rurxrpiydomt  fvs t)s2rr(r ou4tpe mieiasfs2ul(msnt0 ltoiociytop  luvi t t2tr(rpoo4opt  ies sf rurxr ou1tle  o3iytlmDemnmp;u4tltoir tadlpD au s s srtoimpnu1olt mnvtat)srra(ro;u1apt iieiytfm2ra(vs;(4tltoxrctytlptr ivi t0 euo(m nudape  ivias)artaum ;t1olenifetytlm emnvs u)altnxfcoa1fmDraivs (0t2trxo oo1ale  fcsls) ruax ono4aptn ociysfmDelnms u)aexnifcoodopDr nvs;() rtm(m oo1ameelncs t)aDtmxrpnt1ale if3iytfa2em( onu)trermfcoa1omt  nvi;( srurxr3iydoptn ncils)arta( p;t1apx miciltlm2ra( pnu0 lermr oa1omtr nesl(0s2tm(m oodlp elnvi t)aDraur no4oltomictyd mDum(vsnu4tlerio todfpteanei s0setr(mpnu1llen nvsl(fsDurum no4tltomi3iasfmDrmn o (4 rxrxf3ty1opt au i s)t2xoio nudlpt  iet (faDta(  nt0tlto f3tls aDulu snt4 lxrio ia1fm e uei;(0 rtr(rpio4amte neiat)aDtrurpoo4aeto f3ias s2ranmo;()altoiocoadfat livilt)s2tmim no4om elfeslt)s2raur ;t1tleniieiytfsDemnms (0 rxoxr3ta1laDrlneo;s) 2urxopiu1apt livils) 2trx  oo4oleo i3tatfs elnvs;t0trenif iotfa  au i s0 rtrir3oudoltemfcsasfsrumx  ;t4aetn i3ilsla2rl( s;(4tlxnmrcoydoatrlneolt0 2um(o nu1lleelneiat) rrr(  ot0aexomicildfaDea(vpnt4alxnif ta1oaDe uvs;s0 exrxr3iydlpee nci ()sDra(  ot0oex  o3iytfa2uan p;(4 rtrmr3tydla e ues;(  rtrim oydop e nesas)aDum(ront1olx mietlsla eau o;u0 renmociadopt  iei;t)seurimpiudal emncta(f rtrxrp;t0opeoio3tydls2ul(ms;t) rxomf3todom  lu i;s)sexmiopiydop  lneias  2raur ;o0olenmf3iysfaDel(vp (4trxrxo3totlmDe i olt srxrxo3nu1op e icsas)s2ra(r ;o1alenmociadlmDum(vp;(4texnmo3tydoa  luei;t0 rxmirpiy1lpeemfctas  rraumpot0tltomi3iatfa um(mo u)aetnxr3ty1la  ln s;s  2umxm nudlm  mict s)aDumx pou4tpt iiciltlm2rmn pn()artrio oodom rlnvs;s)setmxo3nu1al nmfci (fa2rax pno1ope ii3iyslaDrl( pn(4 etrif to1lp elnei;t0 exoxm3nydomt mfes (f rtaxrpou0alxo o3iadfs2el( snu4artnmf oytlmD aivo t)sexoim3iydalee fvilt) 2rrxrpnu1apx ioctldfmDuan sn()arerxrcoy1oaDelies ( teuoxm3oo1opee fct (  Dum( ont4alx if3iaslmDrluvs;u4 etomrcoadoa e i s;s)s2xmio ny1apt lfesasfa2trx  oo4tpen ietldla2eanmp;u4 rxnio3ty1oaDelu slt)texmxm no1ol emnci ()s2tm(mont4olen f3iatls um( p;t4tlenmf totoaD  n i;()srumxopnu1apt lfct ( artmum ;t4texnmi3iatfsDel( sn()aeermocoytfmt  u sls s2xrxm io4opte fvtas  2umuroot1ope  f3tltfa2ulnvon(0aeeomf3ootfp  ai ols t2trxm nodamtnlivilt)a2trump;t1altnmfeiad sDul(vp (4 lxnxfcoydoaD auvi t)t2um(m io4op emfctls)a2umxmooo0tleoiociytfm ulu s;u4 lxnxrciodlpD lnei (0srum(r ny1ame mfetlt)a2rr(rono0alxomo3ildfs ea(mo;(0tetox
\ No newline at end of file
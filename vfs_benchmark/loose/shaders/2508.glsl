@@ -0,0 +1 @@
+i s;t0s2uo(r iu4llt mfes ( aDta(mpou4tlx  ictytfaDrmnvpnu)arxnio3oodfatranei;s s2uo(o3ou1al  mneilt)artmx o;u1apeomfeiydfs ua( sn(0 lerifciydfmteaues ()teurxr3iodome  icsa(faDrm( onu0tltn fciysfsDuauvsn(0tlerxr ty1lmD auvo ( t2ur(o iodoleelivt s)sDtrum nt1apx  ociltla elu p;() lxnxrcta1oa  luei ()s2ur(r ny4open fetlsfsDtaxrpou1tptoioetad m ulu s (4trerif3oa1faDr u i s)t2tm(r ou1lp nmiciasfsDrmx  nu1teenmocildlaDem(vp;t)tlxnmr3ty1opD aneo;t t2trir3nudolt mfci ( srrmum ;t4oeenmf3iys a el(vp t)alenxrciotlpt  nvslt0 exmxo iu4lp emncias) Drr( pno4olx mo3ias m2rm(vs;u4tltoirctytlp   u il( s2um(mpio1opeelieslsfs2ur(m no0apto o3iadfs rmu p u0trxrmr3tydfaDrlu o t  euoxr3oy4amen nvtl( aDuaur ou0ale  ocils m2rau s;u4arenio tadfmDrln o;s) etrir3oy4om   ivtat)aDtmur nt4aleomi3iytfs ua( o t0texrxf3tatom rlnvslt)texmxr3oy1lpte fcsl( srum(ro;o4opeo ociasfa2elu pnu4areoxf3to1laDrluei t) 2um(o3nu4optemnctat arrm(m nt0texomi3tatfm2em(vonu)alerif totfatrluvs t)s2xrxr oy4lp n ivils)arurumpno1ope moctls mDra(vo t)aexrxr3oodlm r ivi ( t2xoxo ny1lp  lfvils aDrruro;u0opt moetasls2el(vs;u4 etoir3iatom  ln il(0s2xmir3oudalt lfesas)arum(m ;o1ope moeiyslm ulnmo;u4alxoif iydopDeluvils0trtr(o3io1ameemneia(  rururp;o1ole ii3iydla2ra(mpnu4 ltrmf tatlm rlieilt  exrxm3iy1lp nlncs (faDur(mo;u1oexo fctas sDrau o;u4tlxoir3iotfaDr nei t0texm(m oy4lm nmfci sfsrrau  nu4aptomfeiysfa2rm(vp u0trenmr iatoateau o t t2xmxr3nudllt lnvtas)sDtmxroou1alt mociltlaDuau pnt4 etnmo3ootfpteaneolt s2xoxmpoydal emict ()aDtm(mooo0tet ioctyt aDeanvp;(4tltrxo ootop rluvs;t)s2tr(m3no1lm  mfet t  2ur(rpnt0oetn i3iydlsDumu o;t)tltoir3to1fmteauvols seto(r oy1op emfetl(f Dtau p;o4oeto icild s rlnvpnu0 lxrio oytoa rlnvil()srur(o oudomte fciat s2umxrpnt4oeto f3tlsfm2umnmonu0altnmo3ootlmD lueilt0 rur(m nu4lptemnes s  rrmxr nu1olxomieild sDemu snu)alenif3iydop elivil( srtoxo ou1lltn fcias)sruau oot4tptn feiasla2umuvsnu4 rxrxr tatoa   i slt)srxo(m3nu1lpt mfcsa( aDuru o;u4opx mo3iys s2uanvs;t4aetnxociytfaDranvi;s) 2uo(o3iudlp  lnviatfsDtax pno4apxnioeiltlm2rauvpn(0artrxo oydom ranes t) rtmxrpiu4al emivtatfsrrm(ro;u4apeo o3ilsfaDulumonu4tetnioctadlm   nes t t2um(r oo4ole mics (faDtrumont4teeo oeiytlaDrm(vs (0alxnmf3tydfmtrliesls)t2xm(mpiodale mfvilt) 2uaxro;t1alt ifctls a uaumpnu)alxnif iodlp ran i;( t2xoxo iu1apee feiatfs2rax poo1alxomiciat s2ranvs (0arenmfciotomD lnvol(0trurio iy4lm nlnci ()aDtm(m oo0tpx  ociysfs uauvs;t4aleoxr3to1oaDe u s (0s2uoxr ou4amenmnesa(  2tmxm nu1tlxnmoetat mDuau s u0teeoxo iadlm e i sl() 2xrim3iy1lltelncilt)arumuro;t4oex iieildlm2em(vpnu4 rtoir3iydfm  ai ols srur(mpoodlm e iviat artaum oo0aptnif3iytlaDrlu o;(4aetoxr3oydfp rauei t) 2trimpou4opte ncsasf Drmxm ;t1opt mietltfm ul(vonu0alxrxo3iy1fpD aivsl() exrxopiudll   netltfs2ur( o;o4opxomictad a ean s ()aetnif3oydlptrlueolt0 eumxo3nu1ol  mfesltfs2taur ;u4apenio3tydla2ul(vs;u)texnxr3tatfpt auei;t0s2xrxm3oydlm nlfet sf Draxr oo1aee mfctadfs uan o;(4aeenio tydlp rauvi (0sexrir3iu4al  mnvs tfsrtrx pno1aeenmf3iys aDra( p;t0 etoir3oodfm elies;()t2trxm3oydll   iet s a2tmum ;u4tle  fcildfaDeln s;(0aexnmf3oytfaDranvol()seum(rpny1optnlietls)a2tmu  no0oex mfciytla rluvp;(4 etniociydomte ieil( s2umxrpio4opeemfvtat srra(  ou4tpx if3tlt a2em( o u4tltnxf tytfp elnes;s)teurio3nu4om   fvta(fsrtaump;o1oet iicils a eanvo;t4alenir oydop   uvolt0t2tmim oydll elncs ( s2tmurpnt0alx moetatfm2ulu onu0altnxo iotfm  aivs;t teumxo iy4lmte ncs s) 2ur(mpnt0aptomo3iaslsDelnmo t4aeenif3tytlpD lu i;t) 2urxm3no1lmte ivs t  Dta(mooo1olt if3iad mDum(ms () renxo ty1fa  au il(  rxrir3ny1ll   fctls)srtr( pnt0ape mi3tysls2rmnvo t)teermf oytlaD au s;s)srxoio3no1ol nlfcsl(fsruru pnu4tltoiietltlsDeaums () lxnxf3iotlpD  i o;(0 2tr(mpnodlp elnct () 2umurp;t0opxomf3iltla2um( sn()trtomociadfmDeli o (0seuoxm iu1llt mncilsfaDtau  ;t4oexnmictlt m ulumsnu4 rermo3iodlmtrlieol(0teum(o3iudlpte ivtls  Dur(m ot0oee  o3iadls rauvo;u)arxnxocto1omDeauei;t srxrxo ny4oltnmfctl()sDumxmpou4apxn f3iydfsDelu on(0treoxoctatom ran ol( teuoxmpiy4aptnlnvsa(farrrxr oo0opt if3tltfaDea(vs t0 rtnmo oy1fp elues;s s2xmxm3oydaptn fctl()s2rr(mpnu1tpxnif3tysls2ulnvs;()trtnmr iadfaDeauvo s0s2um(r io4aleelfeiat)artmxroou1ape ifetyt m rl( s (0texrmo iytlpDrluvs s trxmimpiy4amtnliesat  rtrurp;u1tlenioetltfa ua(vpnu4 eeoxocoodlpD  ieil(  2uo(r nudaltn fesat) Dumuront4tle mfeias m eauvo;u4tlerio3iy1opD  ueols0 rtoio3oy1olenmnvtat)arua(rp;u0oeeomfciysls uauvpnt0trtnxo3oytfm eluvilt0texoirpoo1lleelncsatf rtru  ;o4tetn ietaslm2emumont4texrif3tytomDe ueolt0 eur(o3oy1ap  mnctas)arraxmpoo4ole  f3iyt m emu s u)trxrmr3oytlp rln i;t  exrim3iudamt  ivsasfsDtrxmo;o4optn i3tldfmDeanvo;t) eermo tatfa elnvo s  eum(m3io1ol nlncsas)aruaurp;o4oeeoio3tyd mDemnmp;() ltomr3to1op rlnvs;t)srurir3io1op e fci ()aDtmur oo0apeniieiytfa2uanmon()altrxfcoydom e iei t)s2tmim iy4llenmnvs s s2uax o;u1olxo ocildlaDrm( p (4alxomocoo1omD anvs;t)s2tm(mpnu4ll eliei s s2rmurpoo0teto ociysfs2ra( o ()tetnirctodfmtrau olt)s2xmirpny4ll  lfei s)srtr(  ;o1oltn feiydla2ea(vs;(0 etnxr3oo1fa r ieol( tetmim oy1ol e iviat aDrmxr ou4alxn feiaslm em(mpnu) eenmfciatfm rlivolt)sexm(o3iu4op  lict (  rrm( p;t4optn ocild m ra(vs (0arxnxfcty1op eaivslt  2xmir3nudolee nei s) 2urum nt4aet mf3tysfsDuaump;(0 exomr iytlp eli olt  rtoio3iy4al  mnviat) ruru o;o0optnmocilt s2ulnmo (4trxrir tytla   ueo;s texoir oo4lp elnct ()arra( oou4apx mi3iydlaDrln pnt) rtrxr ia1la rli s t0texrxo3oudape lietl( arta(m nt1ale  feiasfa2rm(vo;t) lxrxf3todlpDeln ilt) exmxm ou1ape lnesa(  rta(mp;u0apxn o3ildfs rm(ms;()tlxnmf3tatoptr ues;t)setriopiodaltn fcsat)srurxmoou4tlx mo3ildlmDeluvp (0aexrifcio1faDrlivi t0srtm(r3nu1lpte fvilt) Dtaxrp;t4apenmocild aDem(vs t4texoxr3oa1fptraieol()trto(opiydlmte feta()s2ur(mooo1aexn i3iatls uanvpnt0 ltoxf tydoatrlivs (0 2ur(o3nu1lp e ict (  Drmu oou1ole mictysfm rmuvsn()altoxo3iadfpD an ols  2xrxrpnudop   nci t  2ta(r ;t1ope mictltls eauvp (4tleoirctadfpDrlieo;s s2to(m ny1am e fct t)sDurum ;t0tlto fctatfmDrluvpnt0arxrmrciy1fpD  neils)trtrio oo1omeelicsl() Dtax p;u1aex  iciad s2eau pnu4 ltoif3ta1om eaneslt t2trxm nydlmt mncias s2rmxroot4tlx  f3tlsls2rm(vsnu0 lerxo3ty1oaDe ues t)seuoimpnydamtnmivsls)a2trxmo;t4tltn f3iasfm raumsn(0texnircia1la e nvo t sruoio3oydop e ncsas)aDraur ;o1aet ii3tadls2rluvo;t4alerio oodopDranvilt0srtrim iu4llenmieta(fsDtmur ;t0ope mf3tyslm2ranmonu)treoxfcio1lptrauvolt)srtr(m iy4ll emneta(f 2taumpou4oex  oeiasla emnvs ()arenmo3to1laDeauvi (0srxrxo oy4lltelfvil(f rtr(ronu4tpto i3ilslmDelu s;u0 lerir3ty1lm eai i s)sruoio ny4lp n ict tf 2rmu oot0oetniieiat s2ulu s;t)aetoif3oy1lmDr u ols0texrxo ny4lltnmnvia(f rrrx ont4ole  feiasfs2rmnvp;t)aeerio3iytopD aivi;(0trtm(r3io4lm elnciat)sDur( ooo0aetomfetaslsDemnvsn() rxrmrcta1fa rlneo t)texmimpny4ap nmnvslsfsDtrxmpno0oexn i3iydfsDemnvo;u)trxrxrcia1fp  ln o;t)texo(m3oo1al  mfciltf 2ur(  ou4tptoio3tytls eau snt) rtrif3ta1lptrlneil()srxrxr3iudlme lfvs s) Dumuronu0oet  f3tysfs rmu s u) ltnxfctatlmtr neo;t  rurim3iodome  fetas) Dtr(mpoo1open iciysfsDeaump;t) ltrmf3tadfa e ieo;t)tetrir3iy1lptn fcil()aDta(m nu0tpt ioctldfsDrmn onu)altoif totlm eauvs s)setrio3iudllenlfesl(  2umu p;t1tpe ifeiydla ulnms u) rxnmr oa1op rauvs;t)t2tm(r3oy1ome mfcias srumur ou0opxomi3iatlm emuvo u4alxnmr3iadfa eluei t)t2tmio oy4omeelfvs t)artr(r ot0aexoiietasls emuvp t) rxrxfciytfpDrauvslt  rxrio3iu4olt mfvi t s2rrx  ;u4oleoioctyt a2ulu s;t)artnmo ta1laDe iei;s)s2xoxo oo4ame mnetl(f ruau  nt1texnii3tldlaDumnmo (0altoxo3iotoa ranvs;s)truoio iu4op elnei ()aDuru  ;u4alxnii3tys a rl(vo (0teeoifcoatopt  nvi;t0 2xr(mpiu1amenmnetasf 2raur nu1tpeomfetlslaDua(vp t4aetnmrcia1fptrlu il( s2xmimpiu4ome  iesat  ruaxr no4optnmi3iadfm2emnvo () rermf tydlaDrlu olt srtrxrpou1omee net ()aDraumpot1aex moetatlaDuln p t0 rtoxr tytfpDrlnvslt trxrirpoy1ap nlfvsa() 2uau pnt1opxnmi3tad aDrmnms u0trtomo3iytoat anvs;(  eumio iudolte nvi (fsDtr(m oo4altnif3ildlm ua( pnu0altrxocia1lm elivol() 2xm(r io1alt lfct s a2uau o;u1tpxnii3tytla em( s;(0aexnif3oytlpt li slt s2um(opny4omee icsl(fa2urxr nu0tet  ociyd a2ra(mp (4alerxo oydop e ivi;t s2trxr oo4olte fvi (farrrumooo1olx mo3iasfs2emn o;(0tlerir oydfptr ues;t0t2xmio3iy1omt  nvia(faDuru onu0tpxo fctasla umn snu4 exnxo tytlmDeauvo t srur(m3ny1altnmnvt ( s2um(  nt4optnmiciyd s2rlump;u)alxnxr tadlpte n o s)s2xo(m oudole  ivta( a2raum nu1aetnmo3tysfs ea(vs ()tlerif3iodlaDr ivol() rtmxmpiy4lltnmnvslsfsDrmump;o1oeeo fciysfsDelnvs u4 rtrmf3iodlm  lu ilt)trtm(r3oodop n ivt (fa2rmur oo0tltnmfciytlm2uan s t)tetnxr tadlp  lnvil( trtrio3nodopenmfvsasf Durxroot1apxnmf3iadla uanvo;t4areoxr3iy1omDrlu s s)srtrxm nodlme  fct sfsDua( o;u1olto ieiadfsDemumpnt4 rtnif3oo1oa eauvs;(0srum(rpoudlltelfvsasfsrraurpoo0alt mo3iltfm2rln onu0 exoxr ia1oaDrauvslt  2toxo3oodom   fvil( srra( pou0aetomfctysfa2ranmo;u0aeerxf totlpt  uei s trxoxo oydomtnmfvi (f rraumont4opxnmoeiys m2emums t4 etomr tytfpDr nei t)trtmxo3ou4apeelfet (fsrumurono0oetomoeilsfaDulnms;u4tltoxf3oodfmDranvs s  2xoim3io4lm n iesl( sDta(  no0ole ioetad aDuan snu0alxrmo ta1lpDeli o s)srto(opou1op elncilt arrrurono1oltomieildfs eaumon(4teeoio io1fmD anei s)srxrxmpoodlpeemncil() Durur oo0tet iiciltlmDua(vs;t)tleoiocoy1oaDeai sls0s2ur(o3ou1omtemieia(fa2um(mp;o0olx  i3iatfaDrln p (4trtrir oa1lp eauvi s srxr(o iy4omenmfcil(  2tax  nu0tpxo fetldlm ul(mo u0trtomfcoy1fa r uvi;( trtm(o3oydlle lfctlt  Draxroou1apx moetlsfmDum( p u4 ltrifciodlpt anvs;t  etmir3nu1apee fvtas aDuau pnt4oexnio3ild aDrl(von()trerxr3tydfateln i;s)trtriopoy1openlfes s aDumuront0aeen ocias a2um(mo t4arxrmociotfp ean ilt srxrxo3oydal nmnet sfsrur(r nu1tpxomicilsfs rlnms t4aexnxo3io1oaDe neo t  2urxm io4ll  livilsf Duaum ou1aleoiietls m2rlu o t) ltrxr iotfaDe n sls0texm(mpno1ope  feias  Drmx  ot0tpt mf3taslm elu o t0artrxocia1la elueo s  rtrxm3io1ap n feiltfarrax  ;t0ole  fciytfa eauvsnu4 etoiocoydopDr i slt  rxmxr ou4omt mnei s  Drmum no0apxo o3tlt a2el(vp ()trxomr3io1fpt  iei;t)t2xmir3oo4llee nci (farrm( poo4olt iictyslsDemnvon(0tltrxrctytlpt li ilt0teuo(o iydolt mnvi t)aDtmu ont4apxnmietldla2rlnvp u0teenircoo1opt  uvils)srtmxo3oydap nmnvtl(faDum(rp;u4open fetadls2eaumo;t4tltoxrcoydlp rluei t0srur(rpou1ol n fvil()sDuaxronu0opx ii3iltlm2ua(vsnu4aexoifctatfa eluesls setmxmpiodlmee nvslt) Drax  ;t4tet iictltlmDrau p;()aeermociatop r u i;t s2toxopiu4opeemivtltfsDta(mo;u0oexnmo3ildfmDuau p;t) rxnxo ta1fa r uvi ( sexmim3ou1omte ivtat  rtaxmpno1teeomieiatlm2ranmo;t)texrif to1oatraneils  rxmxr oy4ap e ieilsf Dtrur nt4aetnmietltlaDul(vp u)aleomociy1fp raivi;( srxoxopoy4oltnlivi s)sDtmur no1tlenii3tyt m rln o;t)tetomf3iytfpt anei;t)trto(m3iu1ll   fct s) rurum nt1teto fctldfa2umnvp u)alxoxo oa1fmtelnvslt0 2tr(m nu4lptemnes tf rtrur oo0tlx mieias a2elnmo;()trtnio3iodfpDeauvolt)seumir no4lpenmneiltf Draumpno4oexnio3tadlaDeau s (0trtnmr totoate u s;t)teto(m3oo1lm nmnet (fs2uaur ;u0oexo iciad s2elnms (0alenxfcia1lptraies ()texmxrpno1om nlfei s  Dumxmpoo4tetnioetat s2rl(vs;t0altoir oy1lp ran olt0 2uoxopnudlptnlietl() 2umu  no4tlxnmfeild mDra(monu)trerir3tatfpDeai o;(0trtmir ny1olee icias)srrrurooo1ope io3iydla2rl( pnu)texomrctytomDrlu s;s) rxo(r3nydlltelfct t  Dum(mpou0altn f3ilslm um(mon(4aexnxf totoatranvs;() ruoir3oy4ol e fetas srraumpot0oexnmietad a2rm(vpn(0altnmrciotoptr nei;( srtm(r3nu4lle livsls a2umxr no4oet iictysfs umu snt0artnir oa1lpt  nvs;s) eurxr no1apt  feta(fsrra(mo;t0tltoifcilt s2uluvonu0tlenxr ootoat aneo;( seum(mpio4lmt  nvt s a2rmxrpoo0optnmoeildlmDrauvs;(0 rtnxr3iodoat li o t)s2xoiopio1lp  micsl()aDurur ;u0aleoif3iys s2eanvsn(0artrxrcoy1faD  ieil(  eurxr oy1omtnmfvtatf 2raxr nt0olt iicildla2rauvs t4aexniocoydfmDelivs;t) exoxo io4om nlfeia()aDurxr ;u1tpto ieiadfm ranmp u4tltrifcoo1fmD livil( t2xm(m oy4lpte nvta(fs2tm(r ou4opx iieiys mDum( p u4texrmrctodomte ues;t0 rxrxopoy1ol  mnvsasf Dua( p;u1oet mf3tydfsDemnmsnt)areoio oy1op eaieslt t2xmxo oudlleelivil() Durump;u4ope miciyt sDua( p;u0artomo ty1fp raies;s srtoim nodllenmfcsas aDuaur oo1oeenifetytlm ulnms;u4arxrmr tydlaDraivi (0srto(r3oo1op e fci sf rurx  ;u1apt ifeiys a eau snu4aexrmo iatlaDrlu ilt0s2xrxo3nodal emneia()artmumo;o0tlt iocilslm ulums;u)aexnio iytfmtelieslt)s2to(r nydaltn ivi tf 2taxmp;o0altomi3iasfs2rmnmsn()tlxnxr ta1opDean ils trtoxm iy1alte ncslsfsDraxmonu0tlxnmfeiadlsDelu s;u)arerif to1latr i slt0 rxo(opnudolt  ncias  Dtaumo;o0apx ifeilt sDranmon(0tlxnmf tadomDeaneolt) eur(o nudalenlivi s) ruaurpnu4tpeniiciasfm2eanmpnt)texoif iadfm raies;s0seumxr3io4omeemfctas) rtrxmp;t1tltomfciyt mDemu sn(4arermr3iodlateaivo;()tetoxr nydlltnmncs (f rum(ro;u4tlx iieiadls2um(vo;t4 eerxr3oo1fpDeli s;t0 etoim oydom nmfcil(  Drauro;o4opxo oeiytfa2eauvsn(0trxomr to1fpt lueols trtmxo io1lmt mnci sfartm(ro;t0aeeomf3ils m2em(vsnt0 rtnmf ty1opDeaivilt tetm(r3iu1al   fcs ()aDta(  ;t4oexoio3tasfs2ra(vsn()aleoir3tytopt auvo t)t2xoxmpiy1ame  fci s)aDum(rp;u1aexomfeiatlm elnvon()trenif iadop  lnvo s trtmxopoo4ap  micsas) 2ururonu0tltoioctytfa2rmu o;u)aeenxf iadlaDraiei ()trto(o ou4ol e fvi sf rumu p;u0opx mociaslmDel(msnt0teenir3iodlm rlueo;(0 rtoxm io4optnmnes s aDuaxroot4apeomieiyt mDeanvs ()tleriocoytfa rau olt0 2xrxrpno4llt mfviat)a2trumpnu1tleo oeils a ulnms (4tetnmr3tadop ean sl(0srxm(opou1llt mivia(  ruaxm ou0tpt ioeiat sDra(vp u0 exoio3iatfmtrau o t) rurir3ny4lp emfcs tf rrrx  ;u4apto ietlt a umu on(0 etomf todop   nei;( teuoxrpiy1altelnvslsf 2tmurp;u4oeenioeiatlmDrlnmo;(4aeeoif3iotlmtrln o;s  etoim ou1ome  ivtlsfsrurumoot0aee miciysls2raumpn(4 rtrmo3ta1fmtrluvs;s) rxrxr nu1oleemivtl()s2trum ot4tet  icildfs ranvpnu0aeeoio iytop r i o;()trxrim iu4oleemfei s)sDuaump;o4tpeomf3tadls uauvsn()treomf3tatop   uvi;s) etrxopoodalenlfeias) Dtaxmono4apeomf3tldls um( on(4 renmr3iydfp elu s;s tetrxopio4olt  iesl(  ruaxro;t4teto ocildla ranvsn(0 rxoxf3iotomD luvo () 2urir3oo1om e ivtat s2tmxro;t0oet  oetytlaDumnmp t4 etrir ta1lptr u ils0sexoxm ou1ole mies ()artr(ro;u1oleo f3iadfs2ean o t4areoxfciotfmteli o;t)s2xo(m3no4omee fesas)aDumu  nu4oet mfetls s um(mp;u) leoif tatlaDrauvi (  rxoio3oo4amt  ieil(  2trxro;o1aet mieildls ea(mp;t0aetnif3todom r i s;s srtrim3oy4lm nlict t)a2tmx oot1opxoiiciasfsDrau ont)treoxr3to1fpte ies;s0seum(m ou4aptemnvs ()s2ta(mp;t0apx ifciydfs2emnms u4 exnif3tytopDelneo;t0texoxopnydolen nvi t)s2urx pnt0tltoio3ildlsDrmu p;u4trtoir ty1fm elivs ( truoio nu1alee feilsfa2tmur nu4aee  ietld sDeaump (0 lxnxo oatoaD aieol( t2xmxm no1lmeemneias srtrum ot0tet  o3ildfs eanvs (0 reoxo ootom e nvs s0 rxmxo oudaltemictls)s2ra(r ot4tlenioetydlsDul( onu)texrircoy1fm r uvs;s) rtrim iu1lpe mncias aDua(  oo1aleoiocild aDelnmp (4 eermr to1lpt livo;t0 etoim3iy1aptn ietls)srra(  ;t1oexo octydla umuvpnt)aeeoxo tadfp eaieilt) rumxmpoy1opeelnei s) Durxrpno0oet iiciadfm2eln o t0alxoxfciotfp  ln olt  etrir3ou4omt lnetas)aDta(rono0altomoctls s rlnmonu) eeomo3todlp rluei t teuo(mpiodap  mnes t)s2uax  ;u0oex io3ias mDemnmp;u4altrxo3iydopD au ol()srtr(o io1amte iesat a2uau  nu1opxnio3iys aDumnmo t4 rtoir oodlat aues;(0 2uoxrpnudomtelnetl()sDtrxrp;u4aexoioetatfm2ulnmsnt)trxrir iatlp e n sl( teur(rpio1olenmfcsa(fs2ra( p;t1olt mfeiytfm uluvo;t4 reoxo oytomDrlueo ()s2trim nodolt  feta(f 2rm(ro;o0tlx io3iltls ulnms;u0 etoio ia1lp r ivols t2xmir ny1am e fvtasf rtrum ;t1tlt  iciytfmDumnmp t0tltnmf3ta1optelnvslt sexoim ou1lm  mfesas srrrumono4tpxnmf3ias m uln o;u) eerioctodopDr nvil(0 rtmiopou1op nmietltfsrumx ont1tetomicilt a uln s u0 eermr oatlaDeai s t0sexoxr3iy1apteliesasf rrmxrooo1tltomfeiys aDuln pn(0aleoircio1fat lu olt)s2xo(opnodll nlncsl(  rra( pot1oltnifeiltfaDumn s (4 etnxo ta1fp  lu o s) euo(r3nu4oltnlietas)artrxr ;o4tpt ifetltfs2ulumo;(0arenmrciodfatrln o;s)teuoxopiudaptemiet sfa2tmumooo0aee mf3tydfm2ua(mon(0 reoxf tatoa e uvi (0t2tmxrpio4ol  mfct t  Dtmx onu0oetoioetlsla2rau p;u)trtoxo3oydlpteauvo;s  rtoir3ny4al nmfcsat) rtmxm ot4tlxnmociatlm2umuvp (4treoir oydfm ranei;s  exrxo no1oltn fesl(faDrrxm nu4aptoiietlsfs um( onu0 rerxo iydfaD  nvi t  2xmxm3iodlm n feias)sDumx p;o0ape ifciatfs2ulnms u0areoxf oo1fatr u o s)s2toimpiy1ll  mivs () Dta(r no0teen i3ildlm ulu sn() ltnxr3oa1opDr nes s) 2tr(m ou4alenmnvsas sDta(  ou1tptnmoeiat s2ulnvpnu4 rtomr3ta1op  auei;( setr(r iu1lmt mivi sfs2umum no4alt iieiltls2ean s (0aexoxocta1lpteaivo s)trumxo io1ap e feta()sDrrum nu4tpenmo3ilt s rm( o;t) rtrif tadomD  n i;t0t2tm(o no4om e icsltf 2uaxrp;o0olx  fetls a2ulnvo;u4 etnirctytfp eau ils) ruo(o3oo4lltnmicsasf 2tm(  nt4aex iiciysfm2ranmsnu4alxoxo3tadfa eaueslt)t2umxo3ny1lpeelneslsfa2ur(rpnt1tle  f3iatlm2ulnmp u)alenif3tadlmD li o t)s2umxo3oy1lpenmnet s aDraxmoou1alxnmoeild m eauvo (0altoiocoodfp  an s;(  etmxm3oo1altemfcilt) Dtmx o;u1aexo iciytlmDul(msnt)trermo tydfate nes t  rurxr3iy4om emneias aDumumono1ole ii3iys s2ra(msnu4 rxoxf iadoaDe u s s s2urxm nu4ap elfciatfsDrrumpno0apeomoeiatlmDua(vs;u4 ltoir3oydom  lu o s0sexrio3no1al n nei ()srurx  no0opto ieiytfs2el( s;t4alxoxfcootla  li s s0 ruo(m iydlmeemiesa() Dtmx  ;u1aetomi3iytfa rln o;t0 rtrirciydfm  lies t) etm(o ou1lp nmicilsfaDrax  nu0opxoifetld sDrlumo;u) ltoxrcoy1lmt  uvs;()trxrir iu1opteliet ()a2uau pou4opxomieiytls eanvon(4 rtrxf3oodlmDr ieo s0 2ur(o3oodom  micils  2rmu ooo1oltnmocild a2rln s;()trenif oy1opD lueol(0 etrxm3iudlpe mfvtat  2tau  ;o1oee mi3ilsfa elu sn(0tleoxr oydoa rlivs t0 rtrim oo1llt  ietls aDur(  oo4aptoifcils m rmnvp t4 exnmocto1lpD  ivil()sexrxm ou4ol   ivtasfarumu p;t4oleoif3iadfsDulump u) eenmf oytfa   u slt  exrxmpoydlpe  ics t)s2raxm ;u1aeeo f3tyt mDrl(von(0 rxomo oodfp r u i s) 2urxo oy4lptnmieia( aDtr( poo1alx  f3ilsfs2umumsn(4aexrmf ootfa   ivs t)t2urio3iydlmeemiviatfsDurxroou4alxn oeild a emums;(0texrmo3oadom ran i t) 2tmir io4lpen ncils)arumx  ;u0optniieiad m2rauvsnt) rxrmr3tadfmDrlueo;s0t2tmxm3oo4al  mictl(faDrm(  ou4apxnmfeiltlaDrm(vp;u4tetnmo ootopteln o;s)t2xoxm3iu4ol nlfctas)aDtmumpou4tpx iictlsfaDrlnvs;()tltrxr tydfa rai slt)sexm(r io4aptn ics (fsrrmurono1oetomi3ilsfsDem(mp (4artoir3oadomtean olt) rxrxr3oy1ame lictl(  2urx  ;u4aet io3tltlm2emn pnt)aetnifctodfmte neo;()t2toio io1lltnlivt s  Duax  ou0ole mietydls2rm(mp;u) etrir3iydfmtrlueol(0 2xmxo iodop e ivtat)srua(mont4alen fciasfa ea(vs t4 lxrmociotlp rlnvils0sexrxopio1lmtelfcs t  rrm(mpot1tpenmo3tldfaDemnvpnt)trenmr iydfptrlueo t0 2xrir3oodol nlfcs s) rtr(r nt1tpeoifetldfm rm( ont0alxnmrcoodlm   i o t)tetoxmpoo4lm  lfcsa()a2rmxmo;u0tle ioetld a2uau s;t) lermocoatlm eai o;t)seur(o iodlm  lfvia() Dtaxmooo4ope mf3ilt mDelnvonu0 ltrmfcoatfmteaieslt trxoxopiu1alenlnesatfartrxm nt1texo oeiysfsDemu p;()trxnmocoo1fm e uvs;s t2urxr3nu4apt  nct s sDtru ont4alx  octaslsDrau o u)alerxo tadla eai s s t2urxrpnu4alte fcilt a2rmum oo0opxoifeiydfmDemnms u0aleoxr oadfmDeluvo;(0trxmiopnu1lpe mncsasfsDumxroou4olxomfeiatla rlnvo;u)trxnxr iytoa  aivolt)trxm(opoo1lm   nvtlt  rraxr oo0oleo iciadls eln o;t0 eenxr3tytlm  ai slt) etrxm io1om  mfci tfarrrxro;t0texomfeiadla2uanmp;(0 exnio3to1lmte u ils0setmir3ou1lpeelieslt)srraumono0oex moctysla2raump;()altrxo3iy1fmD  i s;t0t2xmxm ny4op nmfeilsf Duaum nu0aeeomfeilsls emn s;u4 etnxfcoy1lp ranei t)s2toxm3iu1omee nvi ()sDuax pno0tlxniictasfs2emums u) reoxf3tydfaD  i i;t0t2xm(o3oodap  mfeils s2umxm no0aptn oetytla emu s;u0artriocoatfmDeauvil( srtr(m3io1omeemicsa(  2tm( ont1alt  fciytfm2um(vsn()aexnmrcoy1fm  aivols0 exr(o io1lp nlivil()sDtaxrpoo0tex  f3iadla2emnvsn()tltoir tadfatr ueol( seto(m3iudolt mictl(fsDrm(moou4altnioetadfs2emnvp;t4alxrxo3iadfpDelu ils0 exr(r ou1llte nvias)s2rmx  ot0aee ii3tls m ulumon(0trenmr3iydlatraueilt0 2uo(mpoo1om  micia( aDuau oou1alxn o3tlsla uln p;t)aetnxo3to1lmt  ues;() rurxr ny1ame  icsl()arur(ronu4tlxomo3tydfaDumumo;()texrif3oatla  aneolt0t2xrirpno4lp  lfet s)sDtrump;t1apenmfciltfm2eauvsnt) exnifctotlptraneilt0t2urim ou4altemict t) Durxr ot4olxnifciasfm2uln o;u4arenmr iatoa  aivi (0srtm(opny4lp nlfcs t a2uax ooo0oeenmfeiysfa rlumo;(4alxrmr ta1lp rauvo (0srto(rpoodolee ncta( aruaurp;t1tpxo i3iltlm uau on() etrmfcoatfa   i i s)srum(o3io1omte nesltfartrurp;u1aptomoctld a2emn on(4 lerxo oydlatrau s;()tetr(m ny1ll  mnesasfsDrm( oot0oexn f3ils mDemn s;t0 eenif iatoa eau s;t)texm(o3nydoleelfvsat)a2urum nu0apeomfciydfsDra( pnt4 rerxrcoy1oa  anvs;( t2tr(m ou1lleemfetl(  rtrumooo4olx iiciyt m2elumsn()arxrmf3to1fmD  i s;s s2umio iu4om emfetlt)arua(r ou4aetn f3iasfmDul(mo;t4 lxnxf3oadlm elnvolt) eto(r iudolt lnvsl()sDumx o;o0alx mf3tldla2ul(vp;t)aexnxr3ia1fp rliei;s  exmxopoo4lpeelnci s  rraxmo;t1optomicilslmDuau s u)arxrmo oo1fa r ueils0 2tr(o no4om e icsl( aruaxrpoo4ale mietldfa rmnmpn()artriocoatom eaues s) euoim ou1al  lnvta()s2ra(m nu0aex  ictyd mDel( snt4alenxoctodlmtrai il( seum(o io1op  lfvi (f Drrxr ;o4alenmociydfaDelu p (0alerxfctadfat livs s trtoxmpiy1om nmieil()srraxm oo0tpt mociasls2eaump;u)tetnir oadfpDelies ( seum(m iu4oltemfcia( sruaxronu0ope mocild mDemuvs u0arxnif iydomt  ivols  2toxmpnu4lpte fvia( srur(moot1apx iiciat m2uln p t0tetrmr3tytopD aues () rxmio3iu1omte neilt)arumuro;u4olxn oeildlsDranmp;(4 etnxf ta1faD  i il(  euo(r3nu1ll nmivtas aDuaur ou1oexn icils aDrlnvs (4 lxnio tydlmt  nei s0 rumir nydol emnvtas)s2umurp;o0tleomfciyt a ua(mp u)tltnxoctatlmD aiei;() exmxo iu1lpen fct () Duru pnu1opx mfcild mDeauvs t4tltomfciodomDe uvi t) exoim ou4apt  fet tfartau o;u0tltn f3iyt m uaump;u) etomf3iotfpDeauei;( trtmir ny1altnmfvi s)a2umur nt4altn octaslm2ra( s;t4aexrxrctodom eluvi;( teurxm iodll nlfvsa(f rtrxm no0optoifetat sDrm(mo;u)treoir oydomt  ues;()truoxo3iy4ameemnetat srrru o;t4apx mfciatlm2uanmpnt0aetrxo tytom raueo (0trum(o3nydole  fvsatfs2rmxr nu0oltnif3iysfsDua(vp;u)arxrmo3io1opD auvi;s0sruo(rpoydalee fcs s s2tmxmp;u1alxo ieiad s ulu onu0alxnxf ia1la rli i;t s2urir3oy4lp nlfci s) rrr( pou4tltnmi3ilsfa2uauvo;u) renxo ty1faD lneo;t) 2tmxo nudolt mivtl(fa2tmuro;u1altomo3iytfa2ulu s;(0aexrmrctytlmDeau ol()srxmxo3iy1omen ivta(fartaumpot0alx iictld aDuaumo;(0 exomr iatlmDeauvs ( trur(r3io1aptnmfei ()aDrm(rpou1oee  oetas a eluvp;t4tetoif ta1opDelnvsls) etmxr oydole mfvtl(f Duaur ;t1oet mf3iltlm rlu o;u) ltrxfcoadoptrau olt)t2tmio3iu4lpte fcs tf rumx o;o0aexnmi3iadlsDumu onu0texrxo iy1lpt  neo;( seurio nu4llte nctls s2ur(r ;u0ape iieiatfmDul( p;t4alxriocoa1oa   i s t)s2trimpnydole  fei ( s2rmu pot1aee  ieiyt m ulnvp;(0tetoifcia1lp   nvs;s) 2urim3oo4am elneiat artmu onu4olen feiatfsDel(vp;t) lermrcta1fpDeliei t tetrxm ou1ol nlnvt s)s2um(rp;t4aexoio3tltlmDrm(ms;() ltnir iotlp elivolt trtrxm3io1lpe mnvsat  Durum ou0tlto fctat a ua(vp;(0texomo3totfptr ueo;s)t2tm(rpnudlp emfeiasfsrum(mp;u4oexo i3iat s eauvp;()aleomrciy1fp  aivi (  2toir3no4op  mnvs (f rtaxm ;o1opx  o3tlsfm rlnvp;(4alxnmfcoo1omD  i o;(  2xm(o3io1amtemicta()artax o;o0tetomf3iys a2ra( ont0arxoxf3oatlaDrlieol(0t2uoim3oudoltelnvtl()aDuaxmonu1teen feiasfa elumo t0aexrxf3iotfm raueils)s2trxmpny4amtnmfei s aDrmurpno1tlx  octyd aDrmnvonu4trxomo3oytopt  ues;t) eum(rpnu1om  licils) rumu o;t4aexn i3iasfa2elump u0 eenmf3ty1lp e i o;s)t2um(opnodopeemicsls a2tru  ;t4apxomi3iyt s uaums;u4texnxf tatomtr uvo (0 2xoim no1llenlnetlsfaDrrur ;t4opxnmoetld s ean pnu4trxnmocoadomDeaneilt0tetm(m3iodlpe  fctl(faDrmum no4tpt  f3iltlsDrlnvo;t)aexnxrcty1lp rluvo s0s2tmxrpoo4lmtnlfciat srum(mpnu1aexnii3tasfa2eauvs t4 eeoir io1lat li i s)srxmxr3iu4am  mnvils) 2rm( ont0aex if3tls aDulu pnt)altrmfcoatomte i ols) 2xmio io4lm nlncsa(f 2rauront1oltniietad mDeln p () rxnmf iy1oaDe nvi (0t2xrxr3no1apenmnvt s  Dur(rp;t1tet mfcias m2rm(mo u0alerif3to1oa  luei t texoir3ou1open fvi (f 2trx pou1oee ioctatlm2umuvo t0 rtnxo iodfaDelu o;t s2trxmpny4lme lnetas  Dtm( oou1tpt  ictltfa2eln pnu) lxrxf3oo1fpt lu il()trxrio3oo1om   ietasfartm( pnt0alt if3iydfsDrm(vpnu)trxoif iy1la eaivi s srxoim no4openlfvils srrru p;u4oexn feiyt a2umnvsn(0 rermfcoa1fmD auvilt0 exo(mpnydameelfcsl( a2rmx poo1ale  oeiyt aDelnvs t0trerxf3totoa   iei t s2umxopou4ap e ictl( s2rrxr oo0oex ifciatlsDul( p u)trerir3totlmt aues ()trurxm oy1op nlfctlsf Dum(rooo0oltoiieiadla2uauvs u0arxomfciytfpte uvo (0 2trio3ou4lmen nesa(  Drrum ;o4oeeomf3iyt mDeanvp;() rxnmr3oo1fa ran o;t0 etmio oy1lm nlivslt  2rr(r no4opto o3ilslm emnvs (4 exoio iotlpt  nei s  eurio3no1lptelfes t) Duaxmpot0oexn ieiaslm2ua(vs t4aleomo3iy1lm  aies;t)sexoxm no1op nlnesatfs2taur nt4aexoifeilsla rm( p;u0arxoiocootfaDr ivsl( trxrxr3iydop  lfvi (farrr(mont0ope iietydlm rmumsn() ltoir3ia1faDrliei t t2toxo3no4oltemfeiat aDtruront0tlxnio3tad aDeauvp;()tltrmo tadfat aueolt0trurxo iydlmt lnciltfsrtaxrpnt4aet  ieiadfa eauvp;(4trtoxf oydom  auvo;t0srtrim3nu4ape mnes s  2ur( o;o4tltnmi3ilt aDelnvp ()tetnmf iadoptraues t trxoiopny1aptnlnvsas)sDtr(rpoo1tetn f3tldlmDuln s u0 rtrmr3totfmDe ies s t2tm(mpoy1am e ivs s s2ta(mp;o0tltoifetyd m2uau sn() lxnio oydopDrlivo;s0 rxmxr3nudlleemivs sfsDrau ono1tle  icilt m elump t4tlxomf3oydoateau i t)trum(mpnu1ame lfcsltfarra(r ;t0aptomfeiyd aDelnmp ()teerir3ia1lmDrli s;( setrxopoy4ap nmneiat) Draxmp;u1tltomoeils m rl(mo;()texoxo3tytop  ln i () 2umxm ny1altn nviasfaDuru pou1oet mi3ilslm2eln o ()artnxr iodoa e ieolt)seum(mpiy1lpe  icta()aDtr(mpou1oetn i3tldlm uau o;(0 lenmocty1oa rlivi;s)s2xmim io4alt mnetl(fa2rrxrpno0opxn fciadlaDeauvp u) etrmr3iatlm e uesls0seumxopoo4ol nmfvilt)srurxmp;t4tlt  feiadfaDrlnmsn()trtnir3iadfaDeanei;t)srxmiopoodoltemfeta( aDumumo;t0tpt mf3ilsfa um(vs;u)tlermr todoptrlnvi t  rtmio3nydll emnei t)s2urumo;o1tpeomo3iysls2eluvo t0trtnif ta1fm rai o;t0 2urim3oudlp emnetl( aDrrxm nt1tptniiciadlmDranmp;u4aeenif ty1op raivo;(0trxrxm3nu4altelfes tfsDraxmoot1tpt  i3iytfa rmnvsnt)arerircoadfm  auvi (0t2umirpiu1lme  nct ()sDur(mpoo0tltnmfcilslmDuluvs;t0 ltnmfcoatlate neolt0 exo(opiu1ale  fvils)arraxrp;u0oeto fciaslaDem(mo u0texriocoy1lat luei s) etrxopnu1am nmivtl(farurur nu1aexnii3tatfm2eanmp;t4altoxr ia1lpt  ivs;(  ruo(m nu4lpe mnvt sfsrtaxroot1oltn feild a2ea( pnu) reomocoy1lp   nvi ( srurxrpiydam  mfvt t a2umx  ;u0oee  oeiatla2rmu o (4artrmr3oo1om ean o;t s2urir3oodal elici s) rrau  no1apx ii3iys m2ulnmp;u4 leoio3oadlatraueils  2xrir3ou1amtnmfvs ()a2rr(monu1oltnifetls s2ulu o;t0alxnif3to1fp rli i s0 2xoir nu1om e fct t)sDuru p;t1tee iietad m2el(ms;t)areoxfcta1opDeli o t0 rtmimpnodam elictls aDurumoot4tpe moeiat m umnvs t) etnif ia1laDe n i ()s2triopny4oltn fvt t)aDumxro;t1olxnmfctls mDrln s (4tltnircoadlp  li o (0s2tr(opiu4lptemneilt)sDum(mpoo0ape ifciatlmDrm(mpnu4artoif oa1lmtr ues s0srurxm oudlpt micsat)s2ur( pnu1teeoiiciytls2ean o t0texnif3iytfa   neslt) etrim nydlp e fcta()srur(m ot1olxoifctytls ulu sn(0alenxf oadoateanvol() 2xrxo oy4ap nlfcs s a2ra(rp;t0tpeomictas sDum(vo (4alxomo3iy1laDeaues t) ruoxr ny4ame  ictasfsrrm(  ou0opt  i3ilt m2ulnvp;u0artoxr oo1op eauvs;()texr(r no1ape lfvtltfa2taumpoo4alto i3iasfa2ul(vp u4arxnircto1lmDelnvilt)teuoir3ou4lpte ieiat)sDur(  ;u4tltn i3iydfa ra(mont4trxnxrcia1oa   u slt) eto(r nudllt lfcilsf 2taump;t1tet  icilsls2elump;()arxrmfciatlpDe nei;(0 etmirpnydalenlfvs s sDuru  ;o0tpxo ieiytfa rl(ms;u)trtrif iodfm rluvo s t2urxm3oo1am  livias) rra( oou4teeomo3ildls rauvpnt4tetnmoctotfaDran s t) eumim3oy1alt mnvtlt a2raurpot1oeenmociat s em(mon()alxrmfcia1faDeau o () etoirpnudllt lieiltfsDumxm nu1tpx ii3tatlsDrlu p;t4 exoxrcoy1omt auvslt tetr(r3iy1op n nvs s)sDuau  ;t0ape ifctytfsDemumsnt)arerxoctatfmDrln s t) 2uoxmpnydop  mncias)aDtax  oo4oeeo ietld m2rmuvpn(4alxoxf3ia1fptrauvi ( s2xriopnydap elfei () Duaxmpou1oeeoifeiat sDemnmo;() rermocoadfatr uvs;() etr(r3nu4lme livtatfaDuaur ;u1tpeoioctysfs ranmo;(0 rtnxocoa1fpt  uvs;s  rtm(o3nu1opt mfesasfaDrr(mo;u0altoiictad sDumumon(0texoio ty1fa eau ols0trtoxm3ou4lmtelnctas)sDrmumooo1aee miciltla2ulums t)tlenxf oydoaD  uvo t sexmxo oodoleelncta() Dtru onu0tet mieiaslaDumump;u)arxoir3io1omDrlies s trtrxmpio4lpt livt s  Dua(mp;o4olto oeildlm uln sn(0 rtriocto1lm rlnvi s) rxmxrpno1alt livs tfs2rmxm ;t1aexomo3iyslsDua(vsn(0treoxrcta1omD  i ils  rtm(rpnu1ope micias)srrm(mpno0apxoio3iatlm2ra( s;t4artrio3oydoat lieo;s srxrir3no1ll   fvias)sDtmumoot0ole io3iltlm2eanvpnu)artomoctotoa eaiei ()s2ur(r no1lmtelfvs sfaruau pot0aetn iciadfsDrluvpnu4aexrxf iy1opD  ieo;t)s2tmim ou4am n fes ( a2tm(mp;o1oex ii3tls m raums t4 rxrxf3totlmDrlnvi s sexmio oy4amt lnciatfs2rm(r oo4olx miciaslm2uln p;u4trtnmociatoaD au ils  2to(m ny4openmnei s)arraxmp;u0aexnifetat a eln o (4 rxrmrctotfp  aues;t truo(r iy1am emfvt sfsrtaxmpnt4aee moeiytlmDuln s u0 rerxf3to1oaDr u o;t0srxr(o oo4ome mfvslsfartaxro;t0apxnmo3tls m2uanmo;u4areoxocoa1fatrlnes;()s2umxr oodol nmivs s  Durumoot0tltn fciys sDelu p t4 eenxr3iodfa eli i t)teum(r oo4ale lictl(  rumxm nt0tptnmi3iatfs elumo;u4 lxnio oatlpD ai i;t)srxo(o oo1ap n nvtls)a2rmu oot0oexnii3tys a uaumo;u) eenmf3ty1fa elues;s)srxmio oo1ol nlncsltfaruaxm ;o4ope  o3ils m el(mo t)aeenmr oydla ran i;( teuoimpio4am   ivias aDrrxrpot4oee  f3tlslm emuvpnu0 eeomf oa1laDrlneo;s)srxr(o iodam nmivslsfarrmumpou0aee mi3tltlaDemn p u0alenmoctatlptrlies (0t2toir3oudaptnmieils)srur( p;o4aetnifetlslm2uanvsnt4altrif3oydopD auvsls  etoio3iudam nmicsltf 2umxr ;u1opxnmieiatls uln s;t4 leoxr ia1fm elivs t0 2ur(opoo1omenmfciasf 2raumpnt1apxoioctlt a2ranmp;u)altoxr3iadfaD li s s  ruoim3nodlptn iet sf rtmumont1oex  icilsla umump;u) rxrirctydlpDe u s;t  rxr(m iu1ol   icia() Draump;t0teenioctyt m2rlnmp;u) eeomr io1laD lueo;()srxoxo3nodam nmict (fs2rm(rpou0oet ioetys sDel(vp;t0 rtoxfciydoa raues t)teto(m3no4omtelnviltfsDrm(r nu1ale iietatlm2rm( s t)tetnio tydlm elivo;t  rxoxopiodom  mfcil( sruru ono0altn iciltfa eanmo;u0aeeriocoy1oatrai o t trtoir ny4al e netlt)s2rr(mo;t1aexomietlsls umn pn()tlerxrcoatoaDranvi ( setrxr3iu4olenlfet ()aDta( pou4apxnmocild a2eanmp;t0tetoif ia1fpDranvil(0texmimpiudlltemncils)s2urxr no0ole mociysfaDrmumpnu4aleoxrcta1fmteauvilt) 2toxm3ou4om nlnctlt s2rax poo1opx  o3iasfa em(ms u)aexnxfcoy1fm r n o t) etoxopio4ll nmieiat)aDuru pou1ale  f3iyd a eluvsnt0 ltrif3oodfptrln o s  etoir io4lltnlfesl(farrau ooo1tptnmfcils a ra( p;t4tltrmrcia1opD lu i;s0s2to(mpno1oleemfvils  rrrxmont0opto ieias sDua( onu4 exrifciodlpD auvs;()srtmim no1ole  fvsasfsrrr(mpno0opeomi3iadls ua(mp;(4 lxnmr oytlpt lies t  etoio io4lm   fvtasfaDrrx p;o0tlto o3tysls elu pnu)artnxo3io1lptrlu i;s  rxm(rpnydaleemics ()a2ra(  oo1ope ifeiatlm2rlnmp;u)aeenxo iytla  ln i;t0sruoxr3oy1ole mfeia(f 2ra(mo;t4texnmf3iltlm elnmp (0aexrmr iydoatean s;t)seum(opnudolt mnviatfsDurum ;u4aptomocilsla ra(vs;u)tleoxfcoatopteln o;s0trxrio3ny4apenmivtls  Durxmp;t1alenioetasfm2rmuvp u) ltnxr3oatfmt  neilt)setmimpoo4lptnlfvta(  2uauro;o1tpenioeiatfs eau p;(4tetnir ta1fpD  nvols  2xo(m3oy1apte ivsa( arrrxmo;t0tlxo f3iysfs2ua(ms t4altoio3iotfmDelivslt0t2um(o io1lm n fvta()sDtmur no1alt  f3iydls2em(mont)trxrxf3tatlpteaies;(0trtmxm iu1aleelfetl( arra(m ot4teeomieiaslsDrm(vp u4areomr3ia1oa e i i;t0 rxm(m no4lle  neil(fartr(  no4optnii3iltfmDum(mp;()trtriocoadfp eli o;( srur(r3nu4om nmncs (  2um( pou4opt  ieilslaDraumpnu4 exoxf ootoatr ivs;t  exoim oy4lptelnes ()a2um(mooo4oet  fetys m2eau pn(4teenio iytop rln ol(0s2urim iodlmtn ictlt sDumu  nt1aeen oeiyd mDulnmp;t0aexnxr oo1lmtelu i;(0 etoiopio4op e fvs s s2ur(mpnu1apt iociasfs2umu onu)artoxr oo1fm e n i t  rtrxo3oo4al   ies t)a2um(r oo4oetomictyd a eauvonu)tetnxo3iydfp rlueol( setoxo iy4lltn fci tfa2ua(  ;t0tpeoioetasls um(mp t0 ltnmf3iadfp e neo s0 2umxo oydalenmnviltfsrurum ou4oetnifeilt m2eln s () rxoxociydomtelu i s t2tr(rpoydll  lnctas a2tr(m ;o1teeoiociasls uauvs u0aeenir3iotop r neo s)teum(opnydop e nvs s  rtaxm no1alt mo3tlslm ua( s (0trtrxr3oy1opDrlies;s)s2um(m3io1optnlfvi (faDtru ooo0aee ioeils a emn pnt0 rxrmrcoydlmtelivi;()tetmio iu1ap e ici (f rrrx p;t4tptn fciys s rmnvs t0teenxfciadfmDeaneo;( trxriopoudale  fesa(fsrtm(r ;o4tleomoctys sDemnmsnt0texnmo3iatla rlu sl(  rxr(opno1ame livsltfaDrmxm nt1teenioeiaslm rlumon() etoxo3ootfaDeaneil(  exrio3oo4lp   iesa(f rtr(m ;u1oee mi3ilslmDuaumo u0 renmocoytfateluvs;t s2xrxo3ny4ope  fvta()s2rr(rpoo4tltomfeildfm uaump;t0aexrxf3iatlpt  u s (  exm(r3ou1al nmnesas  rumxr oo4opto i3tyt sDem(vs;(0artrif to1lat aivs;t)t2tmxr3ny1op nmfcslt sDtm(mp;t4altnii3ild m em(ms;u)aetnxociatla elivi (0t2xmirpoy1ame livs (  rtmxm ;o1tle  fciatlmDranmo;u4aexrxr3oatfatr ieolt0s2trim iu1apt mfct s)a2taumooo1aex mo3ildla emnvpnt4tleomr todlm elnvs (0 rumxopnodlp  mnct ( aDrmur nu0optomf3iytlmDrlnvsnu) lenir oy1lat lies;s)srtm(o nydopee ivi (faDrmurpoo0olt iieiltlsDrauvonu0tlenxf ty1fpD livi;t) eumxo3oo4optemfvs t sDraum ;u1altomiciad a uanvp;u4 leomr3oydlaDelueslt)s2xoxrpio1oltelfvias)sDtrx  ou4tpxn o3iatlm um( sn(4trxoif3ta1latelieolt)s2xmxmpou4om emfvtlt srtmur ou1opx iietytfs2ua(mpn(0tlxrmo tadfa  anes ()sruoxo oodaptn ncs t  rrr( ono4tet ifetadfs eauvs;(4alxrxf totlpDr n il(  exr(o3iudll nlfviasfsrumu p;t4tpenmo3iatfsDul(vs;u) eeomrciytlp rln ilt) ruoxrpnu1om emict (f 2tmx ono0apen iciaslm rl( s;t4teenxocoodomt  ieo;t)t2tmxopoo4om elicta()aDumumo;o4aex ioetydfs2uluvo;t0arxrir3tytom r n s;(0srtoimpoudop  mfesas) Drrx p;o1olenifciat m2rmumsnu4 etomocoytom   i s s  rumxmpiy1lmt mncta(faDurxmooo4olxoiiciad mDeau o u4 leomocia1op rlnvilt  eumxr ou1omen nvt sfs2tmur ou4texo ociltlm2elnvon(0 lenifctytfpt an i;() etrir3iydaltn fcia(fa2uru  ;t4aleoiicildfa rm( pnu0arxrio3oatfpD auvs;t  2xoirpnydlp n ict () Dta(mont4tpx  iciydfaDranvo (0tlxoir io1fpteaivo ()sexm(r oodlm   iviat aDumu  ou1tet ioctlsla rm( p;()alxrmoctadlmtrlnvo;s srum(opiydll n fci tfsDua(m ;u1tet  i3ils s ra(vp;t) exrxo3ootopDraiei (  2urxm oo4al   fetl(farrax pnu1aexo fctld s2umnmonu0 rerxo3oa1oaD ai olt0truriopiy1ll   ieil( sDuru  oo0tlt mociadfaDua(ms;t) reomf3io1lpt ai i t)texoir ou4om  licsa( srurx  oo0apt iietld mDran p u4 lxoifcoo1omt lnesl( teto(rpou4omeemnctat) 2rmumono1tpxo ietatfs elump;t)teeoifciadfm r u ols0sexoio3oydom   fvi s arrrxrp;u1tlx mfctltfaDemn s;u4arxrxr3tatomtr i i (0 etoxo iudol n ncs ( sDrrurpno0tpe ii3tasfmDran p u0tetnif iotoaDrau s t0trxo(rpoo4om nmnetat srtaum ot4tpeo ictys mDrmnvsnu)tleoxf3tydoatrai i t trtoxrpiodop  livils)s2taxmpot0aeeniociltlm2em(vo;t4 rtnxrctotop  aieils0s2uo(mpoy1lp e fcsl( s2taurono1tlxoiieilt mDelnmsnt0artoircty1fa raueols)s2um(m3oudomte fvt tf Dtrumo;u4alxoii3iytfaDelnmpnt0tltrmo io1lmD ai s (0t2triopoo1lp elnvtlt s2tax p;t1tpen ociysfaDem( s;(4texomfcoytfpDraivo;s s2xmxrpnudll nmfciltfsDumxmp;u1apt  iciadfs2rlu p;t0 lxrif iodfm  livs t t2um(m3nodaleemfvtlt)a2rr(rp;t1aee iicils sDemnvpnt0alerio3ia1omDeanvo (0 2xoir ou4lm nlfvia(fa2tm(rpnu1alxn fciltlm2rluvpnu) eeoxr to1fptr i slt)s2tr(o ny1ap e ivsl(f Duru  ;o4alt iietyt s uauvonu)aeerxr3iodfmDean i;s)sexoxo3oo4lltemfvta(fa2ua(moou4opeoiicilslsDumnvpnt0tlxoif3iy1oat aneslt)srxm(o io4amtn fet t) 2trurpot1teto i3iadfm2emn o;(4 rerxr3totfpt ln s;s0srumim3no1apee ivsls) rumxm ;u4aeen iciat aDul(vs u)aetnxr3tatlaDr ieo;s0 rxo(o3iy1lpt mfct sf rum(mpnu0alt ifeiad s2um(vs u0trtnif3oydop e i o;()srxmir ou1op nmncil( srumxroot4aeeo o3iytlaDem(vs;(0arxrirciydomDelieslt texrim3iy1lptnlivilsf 2trx o;t4apxomf3ilslm rm( s ()aleoxr3iotfpt  n olt  rxm(m3io4ll e fctatf Dra(roou4tetoif3ilslm ran o;(4texoxoctytlm e ieol(0setoxo iydomtn nvi sf Dum( oou1alto fciat mDulnvsnt)alenio3tydfp  li o t seuoxm ou4ome lfet s  rraurpot4oexomfciyslmDemnms ()aetnxr3ootoat  ueil(0s2xr(rpiy4amen ivsltfsrtm(r oo1ale iocilt s
\ No newline at end of file
@@ -0,0 +1 @@
+i ol(  2tm(r iu1om nlnvtlsfs2trxm ou4tptomo3tyd m umnvo ()arxomr oadoaDr ueo ( texrxr3oo4alenlicslt a2ur(r ou4oltnmf3iad s2rl( pnu4arenxo io1omDe n s;()tetmimpiu1am n nes sf Dua( pou4opeomicilsla2elnvsnt0 renmo oa1fm r neols0tetrxo ny1am   ivtlt)aDrrx ont1aeeo fciytlmDuanmpnt4trerif iodfmtelnes;t) rtmxm3iudlmtemncsl()arrruroou1apxnmfetasla rmump t4 lerxr3oadfmDrlueo;t0tetoimpiu4lpe  fei t)srra(mp;o1teto fcilslm rl( pn(0 rxrxfcto1lp   ivi t seur(m oydlpte ictl() 2umur ;o1aee iieiasfa2rmnmsnt)trtnir3oydoa rlivs;s trxr(o ou4apt livi s) Dtrump;u0opxomo3ilsla2ranvonu) lxrirciodoaD  neolt  etmxr oudoleemfct (fa2ua(r ;t0opxomiciyt m el(ms u)tltomo iy1oatr n o s0tetmir io4ale mfcsatf Dtaxro;o1ape mfeiysla ulnvp t4trtoir3oatlp  luei t0srum(opoo4lp n fct t)srrm(mpno4aetoio3tlsla2umumsnu0 leomo3oytom  aues;s s2xo(o oodaltnmfvil(  rumum oo1tpeo fetlt a2el(vp;() reoxr ia1omt lneo t0t2toimpno4am emnvtls srtmurono1olxomoeiydfs2rmu pnt)aeeoifctatlatrauvols)srtm(opoodalt lnvsat) 2uru pou0oetoifetatlmDelu pn(0tetoircoatoa rlueils)sexrxm nodoltemnct t s2tmxm oo1aet mo3iasfa rln p (0 reoifciodoatr uesl(0 2uoxm3nodol  mnvsls)artrumonu1aee  ictadfm2umnmsn(0teeomo to1lm   u i s)trtm(m oy4lm elnciat aDrm(mpoo0optomfctytfaDrau on(0arxoifciydfaDe i o (0 exoxo oo1lm nmieslt)aDtmuro;o1tltoif3tltfm uauvs;u4 rxrmrctadfa raivo;(0sexrirpou4alenlnesatfsrrruroot0alx iiciyd m umumsn()trtrxf tytlpDelu i;t0srtoxr oydoltnmnct ()aDraxr ;u1teen fctytlm2emn s;u0 renio oo1fa  aiei;(0t2xoiopny4aleelietls)aDua( onu0apt mo3tydla2rlumo;(4 lxoxr3iy1fate ueol(0seuoio3ou4om nmiei t)sDrmumooo0oleomfctadla2rau o u) eermf iotfatrlieo t) exrxo oo4olen nesat  Drr(mpou0apeoiociytfa2rl( p t0tlermrcio1omte iei;(0 2trimpoo4olee fvt t)s2ur(mo;o1tpx mi3ilslmDem(vo u0 etrio3iytfa  auei;s)sruo(r nudlpt miet (  Durx ont1aptn f3iaslm rlums () rerir ty1lmte i s;( t2uo(m3iy4lpte ieiasf rraump;u4alxniociadla eln s;t4alerxr iatlat anvols) ruoxr oy4ol e neslt)s2tr(moot4oexomicilt a2eln o u0tlerir iytlm   nvs s0t2ur(o oo1omee feia()srrru  ;u4apxn o3iydlmDum(vs (4trtrmo3to1oa r i o;s trxo(rpio1omt lfvs tfarrrx o;u0opxn fctytfsDua( s;t0tltomo ty1fpDr n ols)srtrxm3oo1ll  mfctlt sDtm(r ;u4tlxoii3ilsla2eanmp;t0aexnmrctadla r nvi (0sruoxo nudaptnlietl( arur(mpnu4tpeoioeilsfa2ranmon()tltoirctatlm rlues;t0srtoxo nu4lmtemivsatfs2tau  oo4teeoio3ias mDuanmp t)teenir oo1lmD lieslt0srxr(opoo4al emfeta(faDraum oo4aexnmictlsls2elnvp (4 lxrxocoo1lat lnvo;(0srtoir io1am   neia(fa2ua(m nt0tpto o3iasfaDum( p;u0 eenxf3io1fmDr uvi t s2uo(rpiu1omt lietlt  2trxr oo4opx iietasfmDem( pn(4alermf oa1opt  ueil(0trumxr iy4lp nmfesas)aDrrumoou4tlx moetat mDeaumpnt)tlenmr ta1laDr uesls  2urxo oydllt  nviat srtmu o;t4altomfctldla2ua(mpn()trerxr totfm rai s;s)trumxo nydlmt lneslsfarrruroou1oltn o3iydfa2umnmon(4 rxomr3oadoate ueo s) 2xoxo oodll nlicil( s2tmxrpou4tpenii3ils a2eln p;u) etomo totomt  n sl( s2xo(m3iy1optn fvil() rta(ront4ope  ociydls rm( onu4 ltrxrcoa1lmt li i s s2urxo iu1am   fes t)aDurxm ;t4tet ii3ilslmDrm(vont)trenifcoa1fate iesls0sruoxo3ou1op elicsa( a2tmx ooo1tex io3ils mDran onu0 renxfcoatlatrau s s0s2trxm3nodamt lfvtlt) 2tm(rp;u4alt ii3tlslmDea(mo;(0 leoifctodlaDrlu i s t2tmxopoydop elfviatfaDtau  no1texnio3tltls rl(ms t4 ltrmr3oodlp  ai s;( t2trimpnydol e ies s)arurxmo;t1aptniicils aDuanvp;(4aetrmrctydfa raueo;(0trum(r iodal   feslt  Drm(m ou0aexniietydfsDelnvonu4arxrxocta1lpteai i s s2xrxrpno1lme mfesat srrax pot1tetn o3iasfaDulnvo (0trxnxr3tatopteaivi;(0 rto(o iu4altn ies s)srtmu p;t0tpt ioeild m eau pnu)aeeomoctadlateln s t0srxrxm ny1alt  ivsls s2tmxrooo4tltoiictydlsDumuvsn(4 rxrxf3oydlp ean olt setmim3iudlle  ivtas s2taxrpot0olto octatls emnmp;(0trtoxrcto1fa elivi;()srxoxopoudlpeemncsas) 2rm(rp;t4aeeoifetat s2rluvs u0aexrxfcoa1fptr uvi;t0setrimpnu4ol nlncs t)aDumx  ou0oee mi3ias sDeanmo (0trtoif3to1faDrlieol( s2umim nodllt mies sf rrr( p;u1texnmictyslm2em(ms;u)texomocoodfmDeau sl(0 2tmiopiy4apt lfviat)aDtmxm ;t1tle mociyslm2ean sn(0 rxoxrcto1lp raueo t)seuoxm nu1olenmfes (f 2uaxmpoo0alx moctltfaDel( ont)aexnmr ta1omtrlieil()sexoim no1ll nlicsls)arumumpoo1teeniociytla ra( p u0aexnxrcty1la elies;t0srxrxo oodop  lnvi ( a2ta(r no4opeomiciyslm emnms u0 etoxfciytom raueo s) rumirpoo1lme  fci sf rtmx p;o0tet iiciyt m2uan o t0trtnif3oodfa rlnvsls s2ur(m nu4lp e nvtat  rtm(ront1olt ioeiysfmDuanmo;(4 eeoxo ta1omtr uei s  rtoxo iydopeemfci t)arraumo;u1apeomo3tyt sDulumo t4 rxomrctadlatrlies t0 euoxm oy4lp n feiat) 2ta(rpnt1tlxoii3iydfm2raumpnt)trtrirciotlmDrlues () rto(rpio1ll nmfes sfa2tr( pno0aeenioetys sDrmumo t0altrxocoy1fmD auvo s s2uoiopoodapte nct ()sDrru o;t1aeeo feiyt a2em(mpn(4trtrif oydlm elivil()seur(o iy1ape lici s  Dtr( oot1oetnmfeiltfa um(vont4artrmr3oatfmtr n i t)sexmimpiy1ll  mfciltf 2taumo;u4optnifeiydlm2umuvo t0arxoiocio1oaD luvo;( srtmxo3ou1om e nci ()arur( o;t0opeo octadlmDul(vo u4alxoxr3oytfa r ivs (0sexm(m nodaleemivtas s2tru pnt0tpxomo3ilsfaDuln s;()trtrifctydlmD  uvo s0srumxr nydomt lnvsa(  2ta(m no1optomf3iys s2umn s t4tetnif oy1op   iei t)trumxrpno4aptnlnvsatfa2umump;o0teenmi3ild a ulnmpnt)tltnmrcoadopte uvol()s2trxr3oy1am e nctas) 2rmur no1olxnioeild sDrau p;(0 exrmr oatlateluvs s seurxopnu1opt mivtas sDtrxmpnt4opeoii3tlsls2emnms;()aexrxr oa1op rai ol(0t2umim3io4lmtn neias) 2tauro;u0oltomf3iltfsDeauvp t)texrif iy1faD  ieo;s0s2xoiopoodlmtelfeia(fartm(mpoo0tlenmi3tyd m emu s;t0artnmocio1lmtrlueil( s2xmio iydapenlicsat)a2uaum ou0opx  i3iytla2uauvo t0areniociy1lmDrauvo s teumxr3iydlpee iei sfarrmxmooo4aleo iciatfmDul(vs;u4 etomo3oatfatrlnvo;s) etr(rpny1lmtnlfcsl()a2umu p;o1olto fciadlm rmuvs;u) ltnmr io1fm raieslt0setoir3nodol nmnvtls srtaxmoot4aptoifeiad s2em(mo t4 etomf oadoaDrau slt0seumxopiudalt mnetl(  Dtmur oo0optoioetld a2el(vp (4aexoif3tadfaDrlu s;s) 2tm(opoo4amtn ivt ()artmurpot1opeo i3tytlsDelump;(4trxomr to1fmD  ivils0 rur(o nu4ap  mfci s artaxmpoo4olxniietyd s2ranvs;t0treomfciytlat  i s;(0setrxm oy1oltemneias) Dua(r ;t4tex mfctyd s um(vs (0 lenxo3oodopt lnei;s)trto(r ou4ll n fcsl()aDrax p;u4texo i3ilt m rlnvs u4tetnmr todfmt luvs;(0sexrxo3oy1alenmfeta(fs2trxmpoo1ole ifciatfaDrm( s;t4aetomf oodlp ran sls0s2uoio io4omeemieia()aDururp;t4alt  ieiatfa2uanmpnu4 lenxf iatop   u ol(0sexoir no4opee nvilsf Duax onu1tlto octysfm emu pn()altnif oatopDrauvi;t0seuoxm oo1lme mfvsatf 2umu  ou4tpto feildla emu o;(4 exrxr3ty1fa e ieo () 2tmxr oudal   fvta(  rrru  ou0tet  o3tlslm2rlnmpnu0teeomr3tadfpteluvo (  rtr(m oydalt  icsas  Duru  ;u0apeoiiciyt a ulnms t)treoiociy1faDraneolt0srxmiopnydaleemfcsls)a2tr(m nu1tetnifcild s2rmn s;(0texrir iytlmtrli o (0truoxm3nydlpe  fvta(f 2ra(ro;t0olxomfciltfa ulu pnu)tetnmr3iy1oaD anvs t) 2xoio3iydamee feilt)aDum(m ot0tpe  i3iydlm2rmn pn(4teerxocty1lp r n i;(0tetmxr iy1lme lfesas)aDrru p;u0olx  fciysfa2eauvp t)arermf3oytlm eauvil()s2xm(r oo4lptelnvsa(  Dtmu o;u0optomoetlt s rmu snu0 lxnirctydfat  ieolt)s2umxmpiydal   fetl( sDraumooo4optomi3tysla2ul( snt)alerxf iotoa r ivols0srur(m3ou4op elivi tf rrm( pnu1opt ioeilsfsDrmn o (0artrxocto1lmteli i t)texo(m iudomee fvi (fa2rax p;u4tpe  iciltfs umnmpnt0 rxnxf3ootfaDelueils0 2xmio3iu4lptn ncta(  Dtr(r ou1oltnmfeiasla rmnvo u) lxoxo iatfm eauvolt trtoiopou1omt lnvsls  Drmx  ou1tpxomi3iat sDulnms t)trtoxf3iotfm  luvi s0 rxrir oudam elivtasfs2tmx  ;t0oleoifeiltls ua(msnt0 lenxf3oy1lp r i o s0tetoxr3oy1optnmfciat  Dtr(r nt1tlxn ietytfsDrl(mpnt0arerifctatlmt  u s t0s2tmio3nydapee ies s  rrmxmp;o4tltnif3iydfa2eln p;t4alxnif totlaD aivo;t) 2xo(opoy4opeelfcsat aDtruroou1teeoifeiatlsDumnmon()tlxoir3io1fmDeluvs t s2xr(o3no4amt mieiat aDtr(ront4tpxomietltlsDulumonu)texnmo3tadoaDeanvsl()s2um(r3nydlp nmfct ( s2tax pou1tltn o3taslmDuanvp;(0tlxnir oadomt lu s s s2xrxrpnu4olte nvsat s2urxrpnu0tltomi3tas a2rmump;u)arxoif oadlp  aivsl( sexoxr io4llee fetlt) rrr(  ou0tee ioeildla uanvs;() exoif3ia1lmteau sl()t2xoiopnudope lici s arrm(mpoo1ole ioetydfaDrmu s u0alxnxo iadoa r n i (  2trio ny1lmeelivtl( artaxm nu4teeomf3tysls2rmnvont4artomf totla rlnvs t  rurim3nu4lltn nvsa(fs2tmurpot1aee mi3tatlm2rmuvsn() exrmf iadlm r i o;t0seumxr3nu4op emivta( sDrmxrpoo1olt  icild s2rmn pnt) rxoiociy1la r nvs ()srxr(o ou1lmen fcia()sDuaurpnt0teenmieiltls2eau p;t0 etomfctadoatelueo ( trxm(o nydomtnlnesat  rtm(monu4ape  o3iad a2emn o;t)tltnxo3oadfptelnvo s  2uoiopou4am nlneiat arur(rpno4tee iieiys m ulnmpnt) renxr tadoa e nvo ()t2tmio3ny1lmenmivtatf Duaum oo4texnmfciydls2umums u)tlxnxocoo1faDe ueolt0 2xmir3nu1ll  mictls) 2ururoou4teeoioctysfm2ulu s;(0aetrmr3iy1om   nvo;s0teum(r3oydop nlnvi sf Drrum ;u1tpeo oeiasls2ea(vonu0aexomrcoodlp rai o ( t2uoxo oo1omtemfcs s  rur(mono4alxo o3tlsfa rl(vp u)arerxr iydfpDelieo;(  rxoio3io4lpenlfvt (fsrrm(ro;u4oee mfciysfa rm( snu) etnxo tydop r ivolt0teto(m oy1optn feilsf Drmum no4opeomfeiyt sDul( onu)arxrio3oo1fate nvi;t0 rxmxo oydamtn fvi (fa2uax ooo0tex  oetat aDel(monu)teerxo3io1laD an olt s2ur(m3oydape licsa(  2uax  nu0aex mf3iadlm2uau p (4artnxocto1fp r iei;s tetmxmpnydalt mfcsas) Dtmxroou4aeenmieiys sDraums;u4aexrxr oatoaDeaueo ( trur(m3oo4amenlncs ()sDurxmpot0alenmi3ilslm ulu ont4aetrxo3oydfmtraivo;s) exoxopoudolt lietat  rur(moot1tpeniictadlmDeaump;t0 etoxrcoydlmDr n o s truoio3oudllenmfvsas) 2umu poo4altn icias mDumnmonu)arxnmr3iadla  lnvils)trxm(mpny1olee fesa() Dur(rp;o0oex mi3tasfm ua(mon() rtoifcto1fpD aneil(0 ruo(o no1lltn nvt t)aDrr(r ;o4tee ioeias aDeluvpnu)altomr3oydfmt  u o s  etrxr iydopenlnvi t  rrax o;t1tpxoifetydlaDumumo;t4tltoxoctatoat au o;()trto(mpoy4op e ivtl( sruaxmono4teeo oetls sDel(vpn(0teenmf tydomD ai s (  rum(m3ny4ameemnvtltfs2uaxrp;t1aex mf3iltls2eaums;() etnir oa1opD  nvs t) 2uoim3oy1om nlnvs ()srur(mpnt1oeenmfetaslmDrl( p;()aleoxr oytla r neo t) 2urim iudlp  mfesls)arur(m ;o1oexnii3taslmDuln o;t0 lerio3ta1lptrln i s)srxrio3ou4am  mnei (  2umxrpou0apto ieiadfs umn o u)aetnxo oadfp  aieo;(0texm(m oy1al  lict t)aDrrx  ;o1texnifeilt sDua(mo;t4tltnmo3oo1lp raueolt seuo(opoy4ll   nciltf rtmuront1texo fcilsla2umn o (0 rtomr3todop rluvol( s2ur(r io1llee ivils) 2ra(m nu1aexnifeiytfmDranvsnt)aetoircootomt ai slt0 euoir oy4lpe  icta( srta( ooo0oex ifetad mDumu o t)aetnmf3iatlpDrlivs;s  etmxr no1lpt mfcta(f Drru  ot0opx mfciatfa eluvs;(4tetoir ta1lp  li ols  2uoio nodlle lnet ( s2rm(mpot0tpx ifciltls2ulnvpnu)altnmr3oodlpDrlu o;s)s2trxo3oudoptelfcia( srrr(mont4oexoif3ildlsDuauvo (4 lxnmo tydfmDe ueol( s2xrio3nu4al emfet sfa2umxr ou0alxomoeildls um(vsn()trtnifcoo1opt  iei;s) rtrir3oudam  livtls) rururonu4teenioctadls elu pn() rxrircootlp   neo;(0tetoim nu1om nlnesa()sDrmxrp;u1oexo oeiys m2rm( snu0 exnmo oadfate nvi ( t2xm(o3nodam   ieilt)s2rm( oou1apxniieiytfa uanvo t)tetnxf iytfmDrln ils trumimpiu1lp   fcils aDurump;u0apx mo3iydfm2el(mo;u0tltrio iytlpt anvs;s  etr(mpio1lle  fes s)aruauroou0oleo ictad mDemu ont4 eeoif iy1oaDe ivi;(0 etoimpou1ap  mnvtl()a2um(r no0tetn o3iytlm emn p;(0arxnxf tatlp elieo ()seumxm3no1amt mnesat srumx  nt0oexo ocias mDea( s;() exoir3tytfp   uvs (  2xm(r oy1olt lfviasfarrmxmonu4alxomiciyd s2em(monu0 lxrxo oytlatrln o s)s2trxm no1lp  lnvt ()s2rmur oo4olto oeiatlmDuau o;t)trxoif ta1omt anvs (0tetrxrpnydlm e fvils arumu  ;t1aex  ociys m ea(msnt)alxomf3oytfa   u s;t0s2urxm iodamenlivtlsf 2uru o;t1opt iiciytfmDran o u)areoio iytom   i i;t0srtoio iudlm e ncsas) 2ururpot0oleoiictydfmDum( pn(0teeomfcty1oaDelneolt0 2xm(r3iu1altnlncs s) rrrur ;t1tetn ictlsfs2el(vsnt0 exrir3iydfptraneol() rxmir3nu4op elfvia(f Dtrx pnu4opeo oeiltfs2emnvo;(4trxnmfcoy1fptr ivo (0tetoir3oo1om nlnciat) 2uaum ;u4aeto f3tltfaDrm(msn(4trxoir3iy1fmtr n olt) rtrxm nudameelfesas srrmx pnu1opeoii3ilt s2rl(mon()aeerxocoatlpDe u olt) exrir oy1olen fet s s2uaxm oo0tetomfeiadfaDelnvpnu4texomociadoaD  uvo;s)seum(m iy4ol emfeil( a2tmx ont0aexoiociys a eaump ()trtrmo3oa1oateanei t trxrim3io1lptelivslsfsDrmu  no1tetnioetldfa ean p;u0 lxomo to1lm e i ilt trto(r oo1al n fciltf rrax o;t0opx mo3iadfa um(vo;t0 etrir io1oaDr n o;s0 ruo(m3ou4lpee fvs tf rururoot0tpxomieiyt s2eauvp;u0trermociytfm e n s t0texoxo3iu1op n ieil()aDumxmo;t4aexn ictydfm el(mp t)trtnifcto1lmD lieo;()seuoxr ny4ll eliei sfaDuau pnt0oeenioeiys aDelums;(4alenio3oa1lptraiei;t) etm(m3iu4lmte ncsa(  rurx  ;u1tle  oeiltfm2emnvsnt0tlxnxr to1lpD  uvs (0truo(r nudopee ivslsf rta(roou0oltniicilt a2emu s;(0tlermfctydom eauvol(  ruo(opiydlm nlfetat aDrr( p;u0tex io3ildlsDelu p u4altrir3iydfa elnvsl()trumxm3io4ol nlfctatfa2umxm oo4olxomoctysls rl(mo u) ltoiociy1faDraivi;t0 etrirpnodlp emfesa(  rtr(rpoo4optn feiytls eln s;u4alxrmo3iytom rauvs;t) rtmim nodal nmfciatf rtm(ronu4oltnii3iatfa2ra(vo;u0 lermf oa1lp  lnvslt srtr(r3io4am n nvtls a2trur ou1tlen fciydfsDum(mo u) exnmoctydom rliei;()srtoim iu4ap   ies s) ruaurpot4oetomf3ildls ea(vp (4trerio to1op ean slt)trum(r iy1op e nvsa(faDumurpou4tptnio3iys aDra(vs;u)trxoxfctodoptr ueo;s)trxoio oo1ap n nvtltfs2taxronu4alxomfeildls uanvsn(0tlxoifcty1oa rlu s s0teurio3iydameemnet ( sDta(rp;o0apeoioetad m ul(mp;t0 rtoir3oa1fa raivs s) eurxmpnodame mfvslt  2uaxrp;o1tpxo fciysfmDeau s t4 eeoxocoatoptr uvolt0trumir ny4op elnciat artr( p;o0tpeoiieiltfsDrlnvp;()arenxo3ty1lm r i s s  2toxo3no4lltnmieiasf Dtaum ;u4teen i3ils m umnmsn(4 rxoxf tatom eauvs s)setmir3oy4llt livtas)s2ua(r ou4tpeoiietysls ea(ms t4altnxrctydfaDr ivil() eur(o ny1al  mnetat)aDurx  nt0alxnmieiytfs elnmp;(0teerxr3oadop eanes ( setr(r3no4omenmivil() rumxr no1aeenmo3ilsls2umu p;t0tlxrmf ty1oa raues;(0srtm(o nodlm e ictlt)srum(m nu0altn oetytls ulu ont4tlerxf3ootomDr iesl(  rxoir3oo1lp elnei () rtaumonu4tpeoifciatfmDum(mpnu)aetrxfcty1omt  ueolt)srxoim oodll emnvil()aDtr(  ;t1olt mfeiad a2raump u4 etnmf3oy1faDr ueo t)truoxm3iy4lme mneil(  ruru  nt4tetomieiyt m2uanmp;t)alenio iodopDr nvs s)srtoxm nu4lpenlfei sfa2rmu o;t4aexn oeild aDranvsn(0artnxf3iatfp   ivo t sexm(r3oodape lfesltf ruaxmpot1oet ifciyt s eln o t) rerxocoatlp rlu ilt)t2toir3oy4llenmivtlt)arraxrono0aee  octltfaDrmu s u0 rxnmfcio1fm rlues;t0 exrxrpou4ol nlicsa( aDtau  oo4tpenmictysfs em(vpnu0 ltoiocoo1oaD ln s t)srtmir iy4opeelicias)sDraxm ou4olt  ociatlm2uan s;u) ltrmo ootom r n s (  euoxm no4oltnmnet ()artrum ;o4apxomfeilt m2umumpnu4 etnmocootoaDrlueo;( trur(m3oy1ameemnvias s2trur ;o0opt iictad sDuan snu) lenioctytlp eanesl(0teur(r nudome mfvsa(fs2uaxrono4alxo o3ilsfaDumnvs;() exrmfcoydfpDe i o;t)t2xoxm iu4om emict (f 2tru  oo4tlt moetysfs2rmuvpnt)aeenxf3totoa raneolt0 etmio oo1ope  fes t) rtrurp;o4oet moeiadfmDel( on() etnmfcty1fmDelu s t) exm(r3ou1oltnlfvtasf rrrurp;t0tee iictyt mDuauvont4 eeomfcoatfatr u o;s) eumxm iy1am emfvsas)a2trxroot1aexnifeils s2emuvp;u0 rtnio iatfpDelnvol(  2tmimpno1ll emfvs (  rumx  ot0tpx mictatfs2el(mpnt4trtnmf3oodlmtr ivi;s t2xm(o3ou4opt mfctasfs2uru  ;u0tpx iietlt m2eau s;u) ltrir ootoptr nvs (0 2urim nu4ape  fcsat)artmurp;t1altn fciadla eauvpnt4arxomr3iytfatrai sls)truoxo oy4lm  lfcta()arrau  ;u1openmfctad mDrlnmp;t)aleoxo todfp rlues;s0teumir nu1ol  mfcsatfsDtr(  ou0aleo iciytls ul(vpnu)aeenmrcootfmDrlnvo;t0 exrimpoy4lpe  ici s arrmxmo;t0apxnifeiydfmDeanvp;u4tlxoxf3tytfa  lu il( trurirpiydlpeelivia() rua(r oo0alx ifciaslaDrlu ont)arxnmfcoy1omteanvi;(0texr(o iy4ome lfctas)s2rrxrooo4tpxoii3iytls2rlu snu0tlxnio3oytopt  ieils  rxrxm3nu1alt micils s2tax  oo1oltnmf3iatfm2ea( p () rxrmf3iytlp ean s;t srxrir oudap n nvtasf Durumpou1olxo iciytlmDel(vp t4 ltnxo3oo1fmD au s;s0t2toio3no1ome  neiat) Dtmxmpnu4aptoioctyd a2em(mp;t0 lenif oydop eluvs;( tetmxmpio1omtnmfcslt)srtr(  ;t1aet ioeilsls rauvo ()tltnir iytlpDranvolt0s2urir3oydamtemnciat srum( pnt4alenmfetatfa2umn ont4aeerxfcoytfa rlneol(0s2xoirpnodal  lfeiatfsDrrx  ;u1apt  f3tldfm2umuvs () lxnio iadoa e nvs;s) rum(r3nudap n iesat)s2rmxm oo1alxo feiydla2umn onu4alxnio3tadfaD lueolt0texr(mpny4lp elneiat  2trumo;t4ape ifeiasfa2el(vo (4 rxrxo3oydomte n o () 2uo(opno1oltnmiviat sDuau oou0aet moeiat a2emums;(4 lxoir3ia1fat lies s)tetmiopio4am  mfci ( a2uaur ou4alenmi3iysfm2uau pnt)tleomf3ia1faDrau ols0 etoir iy4oleelnes tfarrmx  ;t1alxo f3iyt mDrmump;u0artnif3tatoateanvsl()trumim3oy1alte ivs sfaDta(m ;u0olxniiciaslm ra( p (0texnmf3oatfpt anvi;(0srtm(mpio1amee ietat) Duaum ou0tpe ii3tatlsDulnvon() lxnir3oydoateai o;s)tetmirpno4apeemivtatfaDtmxmp;t1apeomo3iyd s rm(monu) lxomr3iotfptelneolt0t2xr(rpoy1lle  feiltfa2rr(rpou4olxo f3iytfm2em(vs t4teenio iotlmt aneil(  2urio ny4amenlnciatf 2rmxmp;o1alxoii3ild sDul( p;(0 etoxf3ty1lmD an s;t  etoio3ny4lp elnvtls  rraurp;t4optn oeiydfs2rmumo t0tltrmf3iotlp   ies s trxrxm3ny1lle mictl( artrumo;t0alxomicilslm ul(ms;t4 etomfctodlpD lnei s0 2tm(rpoydll n ivsat  rtrumpnt4alxomictld s2rm(vo u4arxoxrciodopt lu sl() etoirpou1op nmivslt)srur(ronu0ope  ociat sDraums;t0texoxf3totfp  an o s) 2xmimpiydlpenmicils  rtaum ;o0oleoiietysfm rlums;t)trtrmocoy1fm  aueo s seuoim ny1lleelnvia()sruaxroou4tleoio3tydfa2uauvonu0trtoxocta1lmD  ivs;() etmir iudamenlnviat sDrm(r ;t0opto oetysfm uln s t4 lermrciydfmD  u o;t teurxo3iy4apeeliciatfsrum(r ;u4altnmo3tltfm2rluvo t4aexomo tatomDrli ol(0srtr(rpno1lmenmies (f 2tmxmoou4tpen o3iyd s2ulu o;t) eenif3iotlmDe i ols) rtrxo3no1am   ncs (f Drrur nt0aptnif3ildla uau on()tltoir iodomtrai i;t)teuoxr io1om elnes (  2uax pnu4tex mocilt m2ul( s (4 exoir to1fpte ivolt) rxmxm no4am  mnvi t arrrxmpno0tetomfeiys s2ranmo u)arxomo3to1fmD lu i;s0 2xoxr ou4olen nvia()arrmuro;t1altnmf3tysla rmuvs u0tlxrxf oy1oaDr i il( teuo(m iu4ome lieslt) rum( p;o1tex  ieildla uan snt0aleoio oytoateluvo;(0srurir3nu4am nmnet ()aDrr(r ;t4alxnmictatlaDua( snt)arermfcoadfa eau sls0tetm(r oodomeemics s)aDtm(r nu4aet moeiyd s rauvs;t)aetrifcoo1fp   ivi s) 2xoir oo1lptnlietls srrau pno4tex ifetlsfm2ranvs ()aetomf3ootfat livols) 2umxo iydlpt mnesatfsrta(m ot1tpx  ocias mDuau onu0 eenmocia1fpDr ueslt  eum(r3oy4lle mnesls sDtrx  no1olxnifeiyslmDel(mp;u4trtomr3iodlmDeanvo;s)seum(rpoudlmt lfvi s s2ur(m nu0olto o3tls s ranvp t0 rtoxo3oodlp rlivs t)s2umirpny1opt licil( sDrr(rooo4tetoif3ild a2rlnvs;()areomo iy1fmteluvi s)t2uoir oy4ol elnesltfaDumxro;o4aexnmo3tysfs2emums;() eerif3io1fatelies;() rtmxopiudale mivia(  Dur(mono0tlt iietld m emnvsnt4 lenxociodfp  lneols  2xm(mpiydlmte ict s)arrr(rpno0opx ifeiltlsDemnvo (4tlxoxo iotlmt aneo;s)trxrxrpou1amenlieta(  rtr(monu0tpx  fetydla2emnvs t4 lermrcoadlmD lueo;() 2xm(o3nu4ol   netlt  2rrumooo1aexnio3iadfmDeln o;t4 eenioctotfp  luvi t0srtoxo iydomeemivslt)srtr(mp;u4olxo o3tlsfsDrau s t4 eerxf totlmtran i t)s2tmxm3oy4omenmnvsasf 2uax onu1opxnmf3iaslaDrl(vpnu0arerio3tadfmtr nes;s0t2urio nodap nlfci s  Dtm(r ou1ale ioeiysla eanvpnu4alenmf oydfm rluei;( srxo(m oudll e iei () 2tauro;o1tltnif3iadfmDemn s;u)trxoiocta1oaDeanei;( texmiopnydale lfvta( aDuaxmp;o1ope ifcilsfa ua(mo;u4arxrio3tadfateluvil( trtoxmpou4lmee iet ( s2urxro;u4aleomfetlsfmDeanmonu4 lenmo3io1lpt livo;( texrirpiu1ol n nvt sfsrrmxmo;u4ale if3tytfa2rmu snu)tltnmo oatlateaieolt)teuoxrpio4opt  ics sf 2ra(rp;o0tee iieildlmDel(mon(4 rtrmf3io1oa e ueo t  etrio ou1oleemietasf Durxmpoo0alxnmictysfm2rmnmont4 ltrmr totfaD  uvi;s) 2umiopoodamen nct s  rrau poo4ape  f3iysfaDeln o;u0trxrxf oydlat  uvo;t s2ur(o3oo1ap   fvs (fs2umu  ;u0ale mieiad m umums;()tetomo oo1fp eluei;t0srtr(r oo4ll n fctls arum( pot1apeomoeiytlm2elumpnu0 ltoir tadlmteauvilt)seuoir3io4lleemfvs t sDumxroou0olx  fciltlsDrauvo;u0arxnio ta1fatr u i t0texrxo3iy4apeelfcil(faDurx  ot4opxn oetytls uau p (0 eenmf todlpDeanei t) 2xm(r3ny1ome lfctls)sruax poo1opxomfciad s2ea(vsnu)tlxrmo iadfaD lu s ()teum(o3nu1ol nmncsat sruax ont4tptnmicildls2rmn p u)altoir oadoa rln ol(0t2ur(m3nu4amen fvt () 2ua(mp;t4aeenifciasfm2el(mpnt0arenxo3tytlmDe uvi t  exmxo3oodol  livtlsf 2tr(r ;u4opt  ociasls rmnmp;u0 rtrxfcoytomteai o;t teumim no4ll  lnvsa( sruru p;o1tlxnii3iyd sDel(mpn(0 exrmr3iytoatelu o;t  2to(rpny4lptemfctlt sDuru o;o4teen i3iadfa2eauvs;t4tetoxfctytlaDelnvs t) 2ur(m3iu1ll n fcil( sDtaurp;t1oexoif3iaslm2uauvp;u)tleoxr3iatlmDe nvs;s0 2xoxr3oo1amee icils  Dtax ont0tltomociat sDuanvsn()tleoxo3ia1fm r uei;t)s2ur(o3iu1ale  icsa(f 2rrx pno1tetn fciyt m2umnmp u)altrmf3to1omtr uvsl()s2xo(opnu1aptnlfvil(faDtr( p;t4opt iiciys m2rlump;() rxomf3tydlpDe ivolt setoxrpiy4alt lnesl(fsDumuront0olx  iciasfm uluvp;u0aexnmo oytoa   ivo (0t2toxm3no4lptn ivsat sDrmu  ou4opt if3ildfa eaumo u0aexnxf3oo1lp e ieilt texmirpio1olte feslsfa2urur nu1tetn ociat s ra(vo;u) lxnir oy1lm eai olt0t2xoim iodole  fvtls)a2urxmo;o4optn fciatfm rlumpnt4alerio3to1fmt aueo;s0trumim no4ol n fcsls)a2tmxro;o1aex  oeiydfsDel(mo;(4artnif3tatlaD auvol()t2trxo no1amtnlncilsf 2tr(  ;t4olenmo3tlsla rmnmsnt)teerxr3ty1lm ranes;s0srxm(opnu4ol e fvi (  2rmxr ot1ope mfeiys s eanvp;t) lxrxf iydlatrluvi t0 2trxopou1lp elfeia(f rtrx onu1oexnmi3iad sDemu s t0altnxfcio1opt lieo;t0texmimpnu1lm elfcs t)s2rmx p;t0olxnif3tls a2ranvs u)teenxf3oydlptraieolt  ruo(rpiy1lptelnctatfs2uaum ot4open f3iytfm2umu snu)teenmf oytopD  nvo;(0teumxmpoy4lmenliesat sDtrur nu1apxnifetatfm2rmuvo;u0trtoxf3iadopDelivs s texoim oudaltnmfct tf 2umurp;u0optn iciyt m rlums;(4tetnxr oadopDe neils) 2xoio iydal  lncsa()artmxmp;u4tpto oeiyt s ranms;(4artrircto1fptr ueils0s2xo(m3iy4om emnctas) ruaxronu4tltomfctadls2umn pnt) ltnifcoydfmt ai o (0s2xo(r oy1oltnmivias  Draxrpou1oltnmi3tydla2ulu ont)trtoif ia1fpDeli ils0s2xmir3oo4ap   feias a2raump;o4olxniiciasls elnmp u4arerio3todfp  li olt trtoiopnydoltnmnei s  Dtrurp;o4alt mictytfs2em(mo () lxnif iy1op  lueols0t2trimpiu1lleelfcs (faDumxmono4ale mfetytfs um( p;u) reoxr tytoaDrlueol(0srxo(o nu1op elfvi (f Dtmx poo1oltniieiytfa2uluvont4texnif todlpt aiei;s0s2xoxo3io4lptnmfctas)aDrrurpou1aet mf3iltlaDra( s;() eenir oatlpD aneols  eurim oudaltnlnes s) rta(rpnu1oeeniietld a2rl(vs u0 exoirctadlpt auesls0 rtmirpou4lleelfesl()a2uaurpnu0aleoif3tadfsDea( o;t0aeeniocoatfm raivolt) rurio3iydlpt mfviasf 2urum ;o1ape iieiltfa el(msnu4aetnmrciatlaDeln ol( t2xm(r no4olt mfet s)aDtmurp;o4olen fetlt s ea(mpn(4trxnifciotfmD ln i;(0trxrirpoo4ameemnviatf 2tmumoou1aex  i3ilslm elumsnt0alxrir ia1fa  li i ()s2tr(opiu1lmee fvsltfsrumxr ;o1texo o3iytfs uau pn(0aetnif3ootla  lneo () eur(opny1lmenmivs (f ruauro;u1ape  oeiysfa2rlu s ()trtomo3oy1omDe nvo t) rto(r ou4omt lfci ( aDtau  nu1oexomfeilsfa2umu pn()aexnio3ia1lp  au o t)teuoxo iy1amtemieta( s2um(m ou4tpeo ietys a2uluvo (0tlermoctadlpDrliesl()srtrio ny4lltnlivtat srua( oot4oee  i3tltla2ulums u0trtomrciydlaDr nvslt0 2uo(rpou1omte nci s)a2rmxm ;u4aexnmfeiatlm2eaumpnu4trtnir3iotla rauvs;( srtr(o3io1lpt mncias) Duau pnt4tltomiciys s ranmp t)altnxocoy1fmt ln slt s2umxopoy1oltnlivtas)s2uaxrpot4oltniocild s rlnvp;t) etnif3oodlp eau i ( sexmio3iu4ll   fet sf rurur nu0oltoioeiltlm2rlu o;u4alerxr3iytlm   nei;s0 2xoim3iydlpenlnvslsf rururp;u4tpx mi3iatlaDranvpnt4alxomfciotfa raneslt0setmxrpny1llt mfctl( sruaxmp;u4aptn ociytfm2um( sn(4alxnif oydopDrli o;s0 2urim iydlpte iesat) 2rrxmooo0opxo iciatlsDemnvo (0 rtnmf tytfa   uvi;s  etrxo iy4omtn ictat)srrmuront1tpt  feiydfa2ulu on() etnmfcoydfmD lnvs;t  rtm(o oydal nlnvsa()srrmxrpno1oexomoetatfm em(vo;(4 eeomo3ia1fptran i;t0t2toir iodapt  ici s  2rrurono4optnioctys s uln s;t4 lxnmo3tadopte uvils0seum(r iudapeelnvsasfsDrrumoot4alxnifetydlsDra(von()tleoxr3iydfm  aivs;t0srumxm3io1alen ivs s aDtmu pot1olx  octls sDemuvs;t4tltnif3ty1fpDrlieol(0srtm(r3oo4opt mfciatfsDrru p;u1apxoio3iat aDuanvo;u0 rxnmf oa1fpteaues ()s2trim3nodaltelncs s  2rmxr ;u1apxn i3tyt sDuau sn(0 renmfciadlmtrlu s;()truoio oudom  mnvtlt)s2ra(m oo4opx miciatlmDrlu s;t) lxnxrctotomtean i s)trtoirpnydaptnlncilsf 2ta(m no0oexo fciyslm elu on() rtomr3ia1oateanvi ( t2xmim ny4omeelfvilt) Durur ;o0altomo3taslm ea(vp;(0alxoxf io1lp ean ol()teum(m3ny4omtn ivtl()srum(ro;o4opt iieiydfs2rmums;u4arxrmrcootlaDraivslt trum(o no4ll   iciat sDurxro;o4aee  ocils aDum(vs;t0trxrxo3oa1fateanvo;s s2xoxo3ou1lptemfctas sDta(  nu0opxoiieiys s2umnmp;t4texnmrcty1om elnes;t)t2uoir oy4om emfeias arra(  nu4olenio3tldfmDra(mpnt4 rerio todfm  lnvslt0tetm(rpiodolt lnctl()arrrx oou0tptomieiatfa2el(ms u)artrir oy1lp  ln i;( teum(o nodolee feia(  Dtr(mp;u0oee mictatfm2uanvp t4 renxfcio1lateluvo;()trto(m oodoleemfcil( arumxmooo1alxo ieiytfm rm(vo;()tlxrmfctotop  livi;() exrxo3oy1omeelncsls) 2rmur ou4opto ieiyt s2ra( s ()tltnmr3io1fmDeau sls0texrio oudomtemiet t aDrm( pot1alx  ociytfa2umnmp;(0 exnio3todfa   u s t srxoimpoy1lpt  nes s) 2tax pno4tltomicilsfsDeaumpn(0trtrio3iotfpDr nvi;() 2uo(r3ou1ol emieiltf Draurpnt1aetniocildfs2umu ont4trtomf tytoaDr i ilt0 rurir ny1oltemnetlt  Dtaurpoo0tltniociad m elnmo;u0 rxrio3oo1lp eaieo t)trxoio3nodop e iet t)aDtm(mpno1olx miciaslm2em(mo t) leoio oydfmteaueol()seuoxm3iodlmtnlneils sDta(mooo4optniieild sDemnvo;()tlxoio3totlmDran i;s) exrirpio1lm nlneilt) 2uaum ou0opxn o3ildlm umu p t)trtoifcio1opD aiesls0teum(m3oodlp n icsasf Durxmp;u1tetoifeias a eauvs u4arxrio oadlptrli il(  2xrim3iudapee ict ()s2rrxmoou1tle ifciadla2uanvp;() lxrio3ty1fm rln o s0 2toirpoodlp elfvt tfsDum(moou4tpeomi3iad a2ra(ms;(4alxnmr3ootfp  livils sruoxr iy4om e nvtlt) Durumpnt1tee iociad m2elu onu)alxnxfcoadfpt lieo (0 etrxrpoudlp  lfvil( sDuaur ;u1tpx if3tadfs ul(ms;t) etrif3tydomteli s () rum(mpnodll emfvil(farraxr no4tpxomf3ildfmDrl( p t) renxf tytoa   ivi s teuoxm ny1op  mfvtlt srraxmp;u0ale  f3tatlm2emn s () exrxrctydoa  lieo s)trtmxm ny4om   nci s a2umu pnu0oetnioeiydlsDem(ms;t4altnxo tydomte i s s)srtrir oudlp e ietat) rrrumo;o1apxnmfeiadfm uaumpnu0tleoio oatfaDeanvo t  euoimpiu1optnlfesatfartaur ;u4teenif3iyslm2eau snu)arenmo3oodfaD au i;t0s2ur(r3nu4ap nmicsatfa2tr( oou4alenifetltlm2umnvo;u4teerxo3iadoaD au s;t t2xo(r3ny1ale lics s srra(  ;o0apx iieiyslm2rmumon(4trxomo3tatoaDr iesls  ruo(mpoodoptelfvs sfa2rr(rooo1opt mictasfaDelumo;u0 exnxo iydopDrau ol(0trxoxr ny4lm e fetls srrmxmo;t4aetnioeiadfaDuluvs;u4 lermfciydom   nvo s) rtm(o iu1am  mfes (  rtm(mont0apx ioeiydfa2emnmpn() renmfciy1lpDrlnvs;(0 euo(o oodapt  ivi ( a2ua( pou4oltnifciad s elnmp t4tlxomr oatoaDeai ol()texoir iudop n iei s)artmxr ot1opt  iciytfmDuan o u)tlxrir3tytoaDranei t t2tr(mpiu1am nlneils  rtmurpnt4teeoifciys s2elumsnu)teenmo ty1lmte ivol(0 rtm(mpoo1lp elieias aruaumonu4tpe mfciysla2uluvp;u0alenxo tydomt  ivolt0srumiopnu1ome  ieils  2rrxr oo1aex iietadfs2um( p (0 rtrmoctytop  livo s) euoimpoo1ale  nvsat)arum( pnu4texnio3ildls2rl(mo;u4alxnmrcoy1fp elivol() 2uo(r3oy1lptnlivi tfa2tmxrp;o4optoifcilsfa rm(vo u)aetoif ia1om  luvils) etm(rpoo1lm nlnct ()aDumxmp;t4tleomfeild aDuau snt4treniociydomteli ols)srto(m3oydllte ictat) rum(mpou1oeen oeild sDra( o;t4arxoiociy1op   i o s0 2tmir iydom nlnviat) Drrx  ;t4apeoif3ilsls2emn pnt0alenmrctodfp  ai ols)t2umxmpiodllte nes s  2uauroou4opxniociysla ua( pn(4aexrio todlmDelivi;t0srurxrpoy4apte feils sDuaurono0ope mfciyd sDrmn snt4aexrircta1fpt livi;()t2urxr3oo1amtelicta(faDrmx  ;o4oleoiieilt s2ua(mp u4altrifcta1lp eln i () exmxr oodolenmncil(fs2tmx oot4opxoii3tltls2ulums;(0alenxo3iadfatraueil()s2xoim io4ol elnvilt  2umurooo1aexo oetas s umu p;(4tetoxo totoaD  ieslt)t2tmio3oydlmeelnvias aruaum ;o1tet mf3iyt mDul(vpnu) exnxo3tatlmD  ieolt s2urirpiydlleemiesas s2rr(mont1tpt ii3iys mDea( sn(0trxrif3iodomt ai o t0 exmxm io1optnlfviat a2tau p;u4oleoio3iatlmDemump u4teenmoctytopt ln o t  exr(r io1op n fcs (faDrr( pnt4tex  ictys mDra(vo (0 leomo iy1opDrlnvi;s0 2urxo3iodam e net ()s2tau  nt4ape  icildfaDrmnmont0trermrcio1omDrluei;s)t2tr(r iy1optnlncs s srumxmpnt4alenmo3ildlm2ranvpn(4 ltoioctotopteaiei;s)setm(mpoudoltn fvsas)a2urx pnt0tptn oeiysfs2el( snt)areoxrcootfm   ieolt t2umio3nudlpenmfcsasfa2tm( pnu0oetn f3tytfa2rmumon(4aexoxr iadfatran s t)texr(rpoydope lfvtlt a2tax  ;o4apeo fetysfa rm(vp t0 lxrif3iatfpDranvs;t)s2umxm3nodol e ici () rrax oot0optoifcilsfm2emu o;t) rxoxrcio1opt  ueo () 2urxr3nu1lpenlivs t)srtru poo1olx mietytfa2rl(mp ()aetoif iydlatrlneo;( trxoxm3iydoltemnctlt)arururpou0olxnmfciydlm em(vo (4trxnxo to1fptr ies;s0 eur(r iu1lpeemies (fsDtaxm ot0tetnii3iasls emuvp t)tltnxf3oadla   nvi t)trtoirpiy1lpt  fvs t  2ur(mooo4aleoiociydlmDuanvo u0treomo to1oaDrluvo ()s2umxmpio4oltelncils)artaur nu4oexomieilslmDul(vpnu4texnir3iadomtrlnvo () eur(r oydop nlnciasf Dum(rono1texomociys mDelu snt0 lxoxr3ty1lptr ivol() rurim3nu1opeemicilsf 2tm(m ;o1ale  ociatls rlnmp;(0alerir io1op e n ols texoxr3nu4ope mfeils)sDrax pnu0tpxn fcild m2rmn pn(0 lxrxfctydfmDeanvsl() rtoxrpoodlpee ivtas s2tru  ;t1apxniociys sDranvpnt0tltnio oodopDeau ilt0t2xmxo no4omt  fvt tfsrta(mp;u0tex  iciyd m umnmpn(4arermfctytfptr nes t0srtrim no4omeemics (fs2raurpoo4tpe ii3iltfsDeanmp;(4texoxf3to1omD  ivs t0t2uoim no1lpeelivt t)sDrrxr no1aet mfeilsfaDrlu p;t0 lermr tytlpD lnei t0trtmxo nodopeemfcsl( arua(rpot0oetnmi3tatfsDuau sn(4treoxociadoa rlnvil(0t2to(rpou4ame mfctat aDuau  nt4altn iciltlmDum( o (4texrxr iy1fp ranvi (0 rxmxo no4altelivtlsfsDrmur ou4opxnif3tytfs2uauvp () lenirciadfp  aivols)sexmiopoo1lpe lnvsat srrm(ront4optnmoetad m2rlu snu0tlerxrctydop eanvils0texmir oo1lmte fcsatfsrtr(r oo1olen i3iys sDeanvo;t) lenmrcty1oateaneols0t2tr(o3iy4amee ivsasfs2urx  nu0tptomi3ildfa2ulnvpn(0trenxr3to1om e n o;()srurxmpiy4aptn neta() Drrxmono4ale  f3iltlsDean ont)arenxr3to1fa r iesl(  2xmxm3oy4ap nlfcsas) Dumxroou4opt moeiaslmDrmu on()aexnio3oodoaDrau olt)trtm(r3nudap elfvias  2raxrpoo4altnmfciasfmDumnvs ()alxoxo3iatlaDranvs;s0 euo(o3ou1lm   ivilt aruax  ;t1altn f3tldls umumonu)arxrxf ty1lat au o;()texo(mpoudalt mnvta(  ruru  ot0apen o3iadfmDranmp;u)alerxf3ty1op r nei;s) 2uo(opnodamtelfctlsf Draxrooo1opeomoeiysfa rmums;()alenmfcta1omDelnvi (0trum(r nodol n nei t) rra(m ;t1tpe mfctaslsDelu o;u0arxoxf iy1fp rlnes;s s2urimpny1lptn ici t) 2tmu p;u0tex ioeiydla2umump;u)artnmo oadfpDeai i t  2xmxo3oy1apt  ivi tfaDrr(mpno4tpen i3iytfs2rl(vo;u4alxoir3tydlptelues s s2toxm oy4ll elieias sDtm( ont1aex mi3iyslaDraump t4 ltnmo todfpDrluei;() 2xoim3ou4alenmnetas sDrmu p;t0ope iocildla rauvs u0 lxnxf3to1lptranvsls0 2urxm ou4altn feias  Drmx poo0oltnioetydlmDeanmo;u)trxnif iydoat lu i;t  etm(rpiu1am emnctasfsrurxr no4alxnmi3iatfmDuln p;u0 lxnio3oodlp  liesls trxrxr3ny4op elnesas)aDrmx pnt1teto oetat s2umnvs;u4texomr3ia1lmDraieols)srtoirpnu1al e nvsas aDtmxmp;o4texn f3tasfm rluvp (4trtnio oydomD lnvi;s0truo(rpiy4lm eliei s s2rm(r ou1tex  fciat a2ulu o;()trxrxf3io1la elu s;()setmxr io1lmt miet s)arrmumpnu0apxniicils a um( s t0trxnxociatomt lnvs s)srtrir ou4ll emiei (fs2uax ont1apen icils aDrlnvp;u4 eeoxf3iotfptelu s;()s2xoxrpou4al n ietl()s2taxm ou4optomfciasla rln o;t4tlxrxr3to1fatr nvs t texrxr3iy4opt lneils  rrau p;t4opt mieild a rau o u4 reomr iotfp   neilt texoxo iu4ap  lnctl( aDtm( pou0oltnio3iys mDem(vp (0 lenir oytfa rluei;s0seuo(opiy4om e fvi ()s2uaxmonu1oeeomoctysfa el(mo u0trxrir3oa1optelnvi;s) 2umxrpou4lptn iesltfsrtm( p;o4olt  iciad aDuln pnt)texnmo totfm r nvs t0 exr(mpno1lleemfvsas artaxm ot1tptoiieild a rluvsnu4 rtomr oytoa r n il(  2trirpoudap e ncsl()srrmump;o1oetoifciadls2emnvo;u0tltrxo3tydoa  anvi () 2urirpno1lpt  ncil(f 2rmxrpno4optomietlt m2rlnms;(4artnxrcoy1faDeli ols s2trim nudllt  ietl()arumxr ;o0ape  ieilt m um(vonu4teeomr io1fa eanvs s)sruo(rpiy1omte net ()a2tr(r ou4ape mfeiydlaDumumo t)arenxfctytop  aueo;t)teuriopny1amte fctlsfsDrmuront0aeeomo3tld s emnvs;t)tetnxo3todfa eau ol(0trxmxo3oodoltnmietat sDurx pot4alenif3iltfs uau snt) etnio3iotlp elneo;s)trtr(opio1lpenmictlsf 2umxro;t4oeenifetlsfs rluvp (0 rxrmocty1lmtran o t)s2xmxopoydlme mneil( arrmx o;o0altomieildls2rl(vo;u)altrxr tadlmtran i s0 ruo(o3iu1lp n nvtat aDtaxmp;u1tpe mf3iatfm ean p;u) etnmf3iytlp e ueolt texmxr no4aptnlnei (fs2rmxm ;t1tleomo3tas mDemu sn(4arxrxo tadfaDranvo;() 2tm(r iydomt liesa() 2uaxrono4tlt mo3ilslaDuluvp;u0tleoxo3oo1laD lnei;() exmxrpny4ap nmfeia(fa2rrumo;t1apx mf3tad mDum(ms;u4 eeriocoytlate nvolt)s2uo(m3oy4aleemnvtl(  rua( p;o4alxoioctlt m2ulumsn() rxomf3oytlat luvo;()s2umim oo4lp nmfctlsfsDtrumpno0tpxoif3iadlsDuln p (4teenmf ta1fm raies s)s2tm(rpoodam nmfes (fa2uax pnu4altnmfeiasfm emnvsnt4tlenxo oatomteaivolt) rtoir3no1ape  fci t)artmumpou0tpt io3iad m2uau pnu4tlerxr3to1opD ln i;(0 2uoir oudap elnvsat)aDuax  oo0oleoiocildla2elnvs;u0aetrxr3to1fpDeli i ( sexmir ou4ll n ivsatf Duax pno1aee ii3iytls2umnmo;() exoir ia1oa  anei (0 2toim3oy1omtemfviatf 2rrum ;u1ale io3ilslm umn p;t4tleoxf3iatlmDr n s;(  rtoiopnu1ol nlicsl() rtmum ;t0teenmietltls rlump;t4 rtnxo3iydoateaneo;t)trxoxm3iudom e net s)aDua(ro;o4oleoifciytfa2emnmo (0treomo3iadop raies ( teuoir nudlm   net ()srtax oot4aee mf3ildls2emnvs (4trxnmr3ootlpteln il(0 2urxm3iu4om e fvia() 2ra( ooo4tptomieiat s ul( snt) etnir3tytlpt  nes;t) 2tmimpiu4lpe livsa(f Duau oou4olt mfcildlm2ul(vp t0trerif ty1fptr uesl(  exrim3iu4ap  mnctat)sDrmx  ot0tleoiociadfmDuluvs t0 rtrmr io1lp  lies;s t2xmim3oy1am emieia(fsDtmuroot4olto iciysls eauvp;t0alxoxr3to1opteauei;t  eumxo no1apeemivt sfs2ra(r nt1aet mociys m ean sn(4artnir oatlp  anvo;t)teumim3oudlpe mics ()aDtm(rpnt0tpx ii3tysfa2ulnmont0 rxoifcoo1opDelu o;() rxm(m3oy4lltnliesasf rraxrpoo1tetn i3tasfm2ul(vo;(4trenxocia1fm r i o;s0 etr(m oo1olee iei (  2tmu o;t4aptomfeiadlmDuau p u)alxrxf io1opD auvil( seto(r3oy4lp  livt (f Dra(rono0tptoiictyd a2rlumpnt)alxoiociytfa elnvsls sruoxm3oydame mfesl( arrm(  no1ole if3ias a2ulu snu)tlxnmfciytop   neo ( s2xo(m3no1al elietl(fa2ua(  ot0optoiietat s emnvonu0 rermf3oodfm   ueols)trxoxmpio1ol   fcsat artax  ;u0olxomfeiad a2emnvo;u4tlxoir tytfpDelneol( srum(mpnu4ap n ietltfaDtmx pot0oeeo i3ilsfsDrmu o ()artnxf3ty1la eaivs t setrxrpnu4alte ivtlt  Duax  nt4teeo f3ildfm2rm( o (0artnmf3iotfpD  i o;(0 2tm(m iy4olte nes tfartrumont4oeeo i3tls m2uanmp;()trxrmo3ty1omD luei;t)teto(m iy4lm n netat)sDtmx  ;t4aptnmieildlmDemn s;()texrxf3oytom e ieil( t2um(mpnudoleemnei t  2rrum ;o0teen f3ilt s uauvo (0arermf tadopDelueol( t2trxr oy4op emiet tfsDtr(m nt1tee iieilt s2uauvp;u0treoio3ta1lmDrlnei;s  2xm(rpou1apte nvias)a2urx ooo4apx mfctyslaDulnvon(4aleoircoadfaD livs s seur(opio4opee nei sf Dur( oou0tltn i3tld s rmnvsnt4 eenxo ia1op r i i;s0texo(m ou4lptnmivsat aDtmxrpnt0oee  fciltfaDranms;u)aeeoioctotoa eau s;(0 eumxo3ou1olt lfvt t) Dumu oou0apxoioetaslm ul(msn(4arxnmr ta1laD aieilt)texr(r iu4lm elfciatfa2urxrpno4oeenmf3iasfs2ran s t0tetnif3ty1opDe i s;()s2tmir oo4op n fcilt  2rr(moot1oeenmoeiad m ul( snu)alxoif3oadlatr uvsl(0t2umxopoy1ll   feta( aDtmumono1aptnmfeildfa2ean onu4 lxrxrctodlmD lneo s trxoirpno1lme  fciat aDumu pot1tlxomf3iyd s ranmont4altoxr oy1lpDr i slt)s2tmiopiudamen ivs (faDrr(mp;t0tpe mfeils m2uauvp u4artrxo iy1fm eaneil(0s2ur(o3iudam elfcil( srua(mpou0olx moeiyt aDemumsnu)arerif3tydfa e ivs;s t2tmiopoudoptn nvia(f Dua(m ou0texn ieiasls2rlnms ()artnxf3iodfp ranei;( srxoim3oo1lmtnlfet t)arraumpnt1aex io3iydla2elumon()aexomf3ta1faDelnvol(0seurim iudam   nei t arrruront0tltomo3tadfs2emnms ()trenio todoa ranei s0setmxo oy4oltemnei ( aDuau pot1tpto octlt a2ul(vonu0tlenifcoytfp raneils t2to(m nodlp   ict t a2rm(rp;o1opto fctyt sDuauvp;t0aexrxrcoadoate uvolt  2toio iudlm  lietas a2umxmo;u4oltomfeiyslmDrauvo u0arenmr oa1om  anvo;()srxmxm3no4op nlnvsltfartm( o;o0opxomoeilslsDem(mpnu)tlenxfctatopDrluvsls0t2toim3iydlm nmivsltfa2tr( o;t1texn fctatlaDelnvsn() rtrmo3iytlaDr ieils  rxr(o oodaptelicil( arumxm no0opxn o3iyt a2rmn o;t) rtrmr oodoa r n i t0seum(r oo4ll n ict s  2umx oou1openmfeiyslsDranmpnu)alenmf3oo1opDe i i ()trtm(o ny1ameelfcsls)sDumuroot1oetoii3tatfs2el(ms;(0tlerxf3ia1oatr nei;s0 eurxm3iydopeemnvtatfaDtrumpnt0alxn o3iysfm2eauvon(0alxriocoa1optr ivslt sexo(r3ny4aptnmiei (f 2rrxrpnt1aetomoctlt aDrlnvp;u) eenxrcia1faD au ilt0tetm(r3io4amenlnvia(fa2tmxr nu4altniieiad s2ea(vsnu0aetoxr iadlp rln o (0tetmxo nodol elfcta()aDumx ooo4alto o3ilt sDul(mp;u) rtrxrctodlaD ln o t s2urir3oydom e nviat)artm(m oo4oeen f3tydls em( pn(0alxnmfcio1lpDr i ilt) 2xmio3nodom emfcs sfsrtrxrono1aex if3iys mDuan p;u) lermr to1lp  li s t0srxm(m ny4ape mfetasfsrtruro;u0tlen icild s2um(ms;(4altrxo3ta1laDeauvilt0 etriopno1amtnmfvta(f Dta(ront0tpe  o3tytla2ea(msnt4 eenmf3iotlpDe ueil()srumxo no1am emnciasfsDtr(rpot4oeen ietltfsDemnms () etoif oa1fpt  ueol( t2xm(r3nu1olenmfesatf rtaxmp;t1opx iietyt aDum(monu0tlenxfctodoaD aueol(0s2tm(rpnudomtemicsatfsrurum ;t4aetoioetadfa2rmuvo;()trtnmf3todop eau s;t0 exm(m ou1oltn ivi s)artr( onu1aeeomfeilsls umnmsnt4 lenir3tadom ean i;(  euo(r oydoltn nviltfartm(root0apeo oeiltfaDelnvonu)tlerxf3iydopDrlueo ( tetrir oydolt mnes t srtrum oo4tetnmf3ild s ua( snt0 etnmo iytfmt li o (0 eum(r nodam e iciasfs2ururooo1apen oetltfsDrl(vs t0tlxomfcto1lm eau olt)s2umxm iu1opt liesl()s2tr(mpou1aex ioeiltls ulumo () lenxr3ia1optelivo;()tetoxr3iudol emietlt aDumumo;o0olxn feilsfmDeanmo (0 lermrciodlp   iei;t0t2uoir3iy1oleelnes ( sDuaxmo;o1olxn fetys mDemuvpnu0tltnxr3ty1lpte nvo (  rtmio no1ap   iesat)srtmu o;t4aetoif3tasfsDrlnms;t) rtrxrciodfp   nvs;s)sexmxrpoo4amt mictls)srta(rpnu1alxomieiasfm rl(mo t0 rxoifcty1faDraueo t0s2xrir nu1lp elivil() rur( p;o4tltomoeiytfa uanvs;t4alxnxrcto1lpteaivi s0 exrimpnu4lmtnlics ( artm( ooo4aeto o3ils a umnvo u) etoxo tydlateau i t0trxm(r3ou1amenlfcs t  Drr(r no0tpenmociysfm2ua( sn()artnmf3oo1omt li s;t0 2tm(m nu4lp nlfetlt  rrmum ou4aetomiciyt m2rl(msnu4 rtnmrciadlaDrauei (0 etr(opoudom  mneils s2trur ou1apeo fctadlsDelumo;(4teerxo3iy1fmDe ivsl()trumir nu4ll elietls  Dta(mp;u0tet ii3iyt s emn sn()teeoirctytfmt luvols  rxr(r3iy1opte fvsltfsDrrur no4tlt ioetydlsDumn o u0teenifcoatlm  auei s0 2tmirpnodll   nciatfarumxmp;o4oltomiciat m2ulu o;u0tlxnxocio1fmDrli ol(  eum(o3iydom e nes ()srtrxmo;u4oeto iciltfm2umumo;t4 leniocoo1omDeln s t0 rurxm3nudlle mnvia()s2ur(r ;t0tpeomfctls s2elu s (4 rtrxf3tytfa rluvols0 eumio nu1lp emfvt s  2uaurpnt4apxo octys m2rauvont) renmo3iy1latr u s (0 2tmio3iydlle  ncil( s2rmx  no4ope  o3iytfsDuanmo ()areoif to1om elu ols)texriopiodamtnlfetatfsrra(rono0alenmfciytlmDrl(vpnu4trxnif iotlaD ai s s)teuriopnydal elfctat) Drr(moou4oleoioetls mDelumo;(0 leomf todlaDraues;s)sexrio3oy4olt mfvilt)arta( ont4aeeniieils aDrlnmon()aexoir iotomDr i s t)srtm(o iudomtemfet (  Drmx ooo0apx if3tldlm2umnmpnt0 lerio oydoa   nvo;( sexoim ny1optelici t)a2tmxmpno0aleoifeiyslm uauvon()trenxo ootfm   i il(  exr(r iu4amenmfes s)aDrm(mpot1apxn i3iyt a2uanmp u0alerif tatfmt  i s;t)srxo(o3oo4amtnmicia()aDra(ro;o4aeto o3tatlm ra( sn() ltomf3io1lat lies (0t2xm(opiydom  mfet (faruau  ou1aexnmi3tlt sDuaums;t) lxnxocoa1laDe u s;s)t2xm(r3nodlp  licia( a2rmxr ;t1aetnifctad sDrm(von(4treoxrctatoa r nvolt) 2urxo3iydale livtas artaum nt1optnmicildfm2ra(mont)trtoio3oy1opD aues s trtrim nudlmtnlivs tfsDtmxrpno0opeoii3tyt sDemnmp t4 eenmf3iodlptr iei ( sexo(o3no4llenlnvi tfaDrr(m nt1apenmfcildfaDua(vs;(4alenxo oa1lptelnvolt0 ruoxo ou1lltnmiei ()sDur(m oo0apx  iciydlsDeaumo;t4 lxoio3todoaDean sls  2xm(opnu1lpe lnctl( aDra(mpoo0teeoifciytfa2eanms (0 etrmr3tydfm  aneo;t) rum(m no1lltelictlsfa2tmx  ou4olxomoetldla ua( s ()trtrif iadop  luvo;( truoxopoydlpen fcs sfs2tm(r ;u1alxnio3tatfs uaumpnt0 leoxrcoy1fptraueo;t t2toiopnu4lptn feia(f Drrumpnu1apxo ictad m2ra(mpnt) rtnxociadlpD aueo ( trumxmpnu4lmtn ietasfa2ua(rooo0oeto oeiltfsDumumpnu0 ltriocoy1fm r uvs;s teum(o ou1lpe lfvsltfs2taxrpnu1alx ifetydlaDelnvonu0teenmf iadlm rln i;t setmxopnodamtemnvi tfa2um(ront0tle moeiydfs2ul(mo;t0 rxnmo3oadoa  aneslt  2xrir ou1ll  mnesasfaDrau poo0tlenif3iysfmDrmnms u4tlxoir iatlp eluvs ()srtoimpou4ope mneia(fsDumu ooo1tltomi3iysfm rl( s (4 rxnxrciytfmt auei () rxoxr no1lpee ncsl()a2tr( pou0aexo o3iysfmDra(vo u0 reomrcty1op e nvol()setmim iy1opt  fei s  rum(m nt1optnmicildlaDrln snt)trxnmr3ty1lm rauvil()texo(o iydamtelfci () Durxmo;u0tpen ieias m rl( p;u) ltrxf3iadlp  ai ils  rtoxopny4lmt mnesat)srua(m ;u4tex mi3tltfm rm( s ()tltoircta1oaDraieol()setoxm iu4om elivt (f rrrx o;t0altnmo3tad aDrl(vpnu)tltnirciotlm e i o () rxo(o3ny4lmeelnctlsfartm(rp;t1tex mictls mDea(mo u0texrio iydlaD  n il( s2uo(o iodlmtn ies sfaDrmu p;u4tpx  fetad m2ua(vs;u4alenio tatlatranes ()t2uoir3io4om emfcsas  Dtm(mo;u1aeenmiciyslm umn p;u0 lermo io1opt  nei t0s2tmxr nu1altelfeil(faDtmurp;o1aptoifcildfa rmumon(4aexoircoadomtelnei (  2toio3ny1open fct ()sDra(mono4olt iicild aDea( o;u4arerif3ia1oat ai i;s  rxoimpio1opt  icilsfs2uax  ;o0tptn o3ils m2ulumo;(4arerxo oodfaDeanes;t)s2um(mpnydoltnmfvsa(fsDtrumo;t1tlt mieilt a uanvs;(0arxnxf oydfmtr ieils)srxmxopiodll e ivtas) rrrx  ;u4tpenii3ils m umuvo;u) etnio oa1oaDr nvslt) euo(m oodom  lict tfs2uau oot0opxn ocilslmDrl(mpnt0teeomo3io1lpDraieo t)srur(o nydole livslt s2truro;t1ale moetadfmDuan pn(4trxomo oydoa elneo;() rxm(rpio4lpe lnvtlt srurxrp;t4texnmo3tld sDul( pn(0trerxf tadopDr ivol()seto(m3iu1apeemnvslsfsrta(  nt0oetniiciasfaDem( p;u4 eeoif iydfpD auei s)tetoir oo1om e fei s srum(ro;t1tptnmi3iltfa rm(vpn(4trerxociadfatelivo s) ruoxm3nu4amt  netl( a2urxro;o1aeeniieiltls2ea(msnt4texnioctytoatelu i;t0texmxr iy1open ncs ( aDrmx  oo1tpt mfctytlm rlnvonu)alerio3ia1optrau il( srumim nudlpt  ncsl()srrrurpoo0tpx ioeiyt aDum(vont4altoio oo1lpt  u s;t t2xo(mpno1lpe mfeslsf Dtr(moou4apeomicildlm2um( s;()arenif ty1fmtelnvols0srxm(mpio4olenlnvslsf 2ur(rpnu4teeoiocias m umuvon()artrio iadlaDr i i s0trtoio ny1aptnlici sfa2tr( o;u0olt iictysls2eauvs;u4tleoxf tatlmDeaiei t) rur(m3iu4op emivias  Dum(ronu4ape mo3ilsla2el(mo;t4 eenmfctatfmDeln il(0 ruo(m3ou1ape miciasfsrrmxmpnt4tlxnmfciltfa ul( o;u0tlermr3io1omteaueols)s2trxr oo1olen fetltf 2tm(root0tlenifetaslaDra(vo t0 lenmf oydla e u o;s s2umimpiy4llen fetls) ruau  nu0aptoio3iys mDra(msnt0arxrif oydopD  uvo ()t2xm(mpiu1amenmnet ( sDurx  ot0tleoif3tyd sDrlnvpn() lxoxr3iotfm elueil(  rxrimpiy1amte nvi ( s2tm(m nt4oetniociytfm2ua(vp (4tetnmf3oytopDrai i;s teuo(m3oy1apt  fviltfs2umuronu4oexn ieilt a2ranvs u) eermr3oatom e nesls)srxmxr3nodllt lnetasf rum(r ou0oet  o3iadls um( snt) lxnxr3iotfmtr ivo () ruoir ou1oleemivtlt)s2um(  ou0oleomiciysfm rlnvo;t) rxnir3oodfpDranvi;( srxrxm nu4om   fesls s2umurooo4tlxo fcias s rl( on(0 etriociatom  an ilt)srur(rpoodop   fvsl(f Dtmxrpot4opt mietytfa ul(mp;(4artomo tadlaD  i ols  rxr(rpiu4olt mietas)aDraxm oo1tpe  ictatlsDelu p u4 eerxo iytoptrli s;t0 2to(rpnudal e fet s)srumxr ;u4oexn f3iltfm rl(mp;t) etoifcoa1fm raieslt) etr(o3iy4ome micta()s2ua(ro;t4optoiiciadfs2rmu o;u)aexnxr3totfa   i i (0srtrxo nodap e fctltf Dtrxmpnt1ole  iciadlm2ra(ms t4aeeoxo3iydopteli olt0truoxr nu1op   feiat s2ur( o;t1aexoifctas m2eanvp;(4aeeomo oy1opt ai i t)s2uoio3iu1ll   ivs (farrmxmooo4oee mi3iatls umn pnt)alxnirciadfat aueo (  rtoim3io1omtnlfeiat  2ur( o;u0oeeo i3iytfsDrmn sn()aetnmr iydfmt  uvo;s)t2xoxo oo4ll  mnviat sDtaum ;o4alt ifctys m2rmn o (4 exnmo oy1oateaneo ()srurxopio4lltelici ( arurx ont0apx ifeiyslm2eluvp u0 rtnir3oatla e nvslt srxmxmpny1aptemfei s  rrax poo1opto ieild mDum(vs u4arxoif3ootlmDraueolt)tetmio iydolt lnvs t sDumu pnu1oleomfeiytls2em(vs t) exrxr3tadfp  liei;s)srxrxo iydlpt lnvi t aDtmu  no4apx  o3iydfaDemnvsn() ltnio tytom raivolt0trum(o oy1am n fctls)srtmurp;u0alxnmieils sDean o u0 rtnmo3tytfa  ln o t0 etrxr3nu4om elfvi ( srrm( poo4texo f3iyt mDea(vo;u4tlxrio ty1latrlivs (0 2umxm io4am nmivsl(fsDumu  nt4ole mfeiyslsDul( pnu4 rtrifciatla ean i;(0sexr(mpiy1om emfes sfa2umxm nt1aetn ietlsfs rmumo u)alerxf oodfpD ln i t0 exm(mpnu1amee nesas) 2rruronu1tpxomoetatfs2ea( s ()tlxrxr oydfpDe i i;() exmxr nu1olt lfvs sf 2ur(mpoo0aptniiciasfa2ua(vp t0 lxnxo3oadfp r ivo s0srtrxmpno4omen ietl()a2umxm nt0oexo ieilsls ua( pnu0tlerio3oa1lp rau ols0teumxo3iy1lmeelnesas  rum(m ot1aleo ieiydla2rmn s u0 etnxo3oadlp ran s t)t2urxo3io4amt mnvt (fsDumx ont4tee mfeiltlaDrl(vp (0 lxomo3oydfateanvsls  2uoim3oo4ol  lictls)s2umxmp;o1apt ioeiasfaDrmuvonu) exnio oytomte ueo s0srurxrpoy4lm  miet s)a2rmx  no1opxn o3ilsla2rlumon(4arenmf3io1laDr uvi;s)srxrio nu4al emivs s)a2trumo;o1oeeoiiciltla2rmu p;u4aeerif3oo1oa rauei () 2tmxmpny1ope mnct t  Dua( ont1aee mieiatfmDel(vs;(0aetrmo3oo1oa e i i;t0t2xm(o3nu1lptemfeil(  ruaxr ou1aexoifciytfm2rmn s;u)teenioctadoa  lieo t0s2uo(r iudopt livtat aDuax  ;u4alt ioeias mDuanvont4trxrio3iatla   i sls)t2xrxo3ny4amtn icsa()artr(r ;o4teeo i3iad m2ulnvs;t)trxoirciytlat lues;(0s2toxo3nodoptnlivs s sDrrurp;u4tlxnifcilsfmDul(ms t)alenmf3tatlatranei;t)t2to(rpnodoptnmneta()sDtru pou1oleomfeiadlm uauvs t4tlerif oodopD lu i;t0s2urxo3iudolte fcilsfsDumu  nu1apt ii3tltfm2em(mont4aetrmfctytfp eaivi t  2xriopny1lp  mies tfsDumum no1aeeniieiat mDrlumont4tltnxf tadop  auvi;t) eumxo oy1lp   icslsfs2trxm nu0tpe  icilsfs2ean s (4 ltnmf3ootom elivslt0srtm(m3nu4lp e nes s s2tm( pot4opx io3ild aDra( o t0aetnir tydoatr ieol(0 rum(rpnodam   icia()sDum(root0olt io3iad sDrm(vp;t)artnxrctodopDe nvs (0 rxmxm no1lpte ietatfsDrmurp;o1alxo fciat sDulnmsnt4 exnmr3oytfat an ols sexmxm3iodom nmnes (faDtr( o;u4opxoiicildls2umn o u4altnmo3oydoa eauei (  rxoxr3iudlltnmfvsat) 2umx p;t0oex iociat s umnvonu0 etoxf3oy1om rluvs s teto(r ou1ameemnetltfartaurpou4oeen ocildfm ua( s (0trtrmo3oo1fpDe uei t  etmiopio4om eliesl( a2tm(m nt0tpenio3iltfsDeanvsn(4 eerxfcoo1la r n s;t t2trir3oudlle mfes t arta(m nu0tltomoctytlaDulums;u)alxrxr iotfaD livi;(0t2uo(mpoy1ap nlfviltfsrua( o;t1apxnmiciltlm2ran pnt4altnxr oa1fptrlneo s0trxmxr iudapte nvtlsf Dtr(rpno1tet mi3iad s2eanvp t)tltrxo3oatlmDraneils0texoxo iydlp elfvilsfsDtrxm ou4alx  feiad mDuanmp t4trxnxocoydfmDeauvilt0 2trimpiodomtn netatf 2uaxrpno4open i3tydfm rm( o (0tetomoctydop eaivo;t  2xr(m iy4ome lfcs () Durx p;o0tlt io3iasfm rl( snu4arerir oa1laD an sl( srtmxo3oudomtnmieilt)srta( oou0oetoiieils s eau p;(0artoxr3oodop  ln ilt0setoimpny4ale mnvi tfsDrrxmonu4ole ifciadls rmuvont0 reomo3oy1fp  auvsl( s2trir nodll   fetas) 2tmx  ;t0aeeoifciatfs2rlums;u0tlenmo3tydfa rau ol( trto(r iydap nmfeia(  rraxrpot4ope mfetadfa uauvo;t)texoio totopD  ivil()tetoxr3iy1lpe mfesl( s2ururooo0aexo oeiasfaDemnvsnt)texnmr tadoa e n o t s2uo(opny4om  lnvia(faDur(  ot4oex mociad s2emnvp u0 leomf oatfaDeauvolt  2tr(r3nydlle  fvt s s2ur( p;u0opt mictldfs eluvonu)tetnmrctatlmD aivs s0srxoim3io4lptnlnvsatfsrrm( ont4tptn feiaslm emnvsnu) etnxoctodlm  li ol(0s2xm(opnu4amtelnviat srtrurpoo4tlx  ociatlm2raump;t)aexrxfcio1fm  auvs;s trtr(mpnu4lp   ietas srua(  nt1optomiciltlsDel(mo;u)arerxr iydfmtrlu o ()trurxm3ny1optnlnctat) rum(ro;u4oltoiieiatfa2rmuvo;t4 exomo3iy1lpDe ues t)trtr(m3oodlmt  ictlt)aDrmu pnt0tlx  f3ildlsDraumo;t) exoircoy1omD  u i s)srtr(mpou4aptn ivtatfa2tax oot4oltnmi3iad aDua( snu4aetrxf3tatfmD livslt)trurim3iy1llenmici ()s2tmxr ot1olxnifeildfm ranvo;t4teeomo iodfa r i ols  rxo(rpou4ll nlivils)aDrr(ro;t1opto i3iys aDuanmp t4aetrxf tatlateai ols trxmirpnu4omtn ncs (f Dtmumpnt0tptoifeiat sDum(vpnt0trxnio iytoaDelues t tetoio3io1ap elncsl(fsDurum no4olxn feildfsDrl( o u)artnxr tadopD  n s;t  rurxopny1oleelneils)aDrmx  no1oex moeiydla2ua(mp;(4alenmf iydlm  lnvol(0trtm(opoudlptnmnvsa(  rrr( pot4tpe miciytfmDranvo (4 rtomo tytlatrluei;s)srtrxm3ou1lp elivi t sDuaumoot1tpx  icilslmDrln p;u)arenif iotomt  uvols)texrio nodlp nlncslt)a2um(mo;o1alxo iciltls el( o (0altoir3oadfp  lnvi () 2tm(rpoy1apeelnvt (f rtr(rono0tetoiietat s raumpn(4tlxoxf3tytlaDe ies (0trxr(o oo4ap  mncs (fsrtrump;u1apxo i3tadlsDrmuvs;u)areoir3oo1fpte ivilt)t2trxrpoodom  lneiasf 2rax oou1oeenmo3iad sDemump u0aeenxfcoo1faDeln i s0setr(r3ny4altnmnvta() rtr(mono1apeomo3tasfaDrm(mpnu4artnmr3oodfmteaneo;t0 exmir3iydaptemfctl()srrru o;o0texo octas sDean snu0 lxrxfctadlateli ils0srto(m3nu4lmenlies s) 2umu onu4aptn f3iaslmDuluvo u4aeerxf oadfmtr iei;()t2xm(r ou1alee ies s  2trxront0tltnio3ilslmDrmuvsnt0 lxrxr oytlpt livs;s0s2toxm oudlmt lfvtasf rurumoou0olx mocilsfm umuvs t0teeoxf ia1om  luei t teum(m io4lltemnvias  2tau  no4tlenmo3tat m2rlnmo;t)tleomrcoodfaDr n il(0t2toirpiodopeelivt s) Drrxm ou1tet mi3tytlsDum(ms u)tlerxrcto1fm ean i (  2xm(mpiydop e ivil(fa2trxm ;u1tlt mociytfm rau s () lxniocoytop eaneil( s2xoir3nodoltemici s) rua(ro;o0tex ifeiydfa elu o;() etoxr3oadfaDeanvol(0tetr(mpiydoptemiesat a2taumpoo0tleomoetltlaDrluvo;(4arxrif3oytfp e u sls0t2tm(o io4open icil( sruaxroou4apto i3ildfm2emump (0 rerif iatlptrlnei;( srtmxrpou1omenlici ( a2rmxr nt0tpx iictasfs2ulnmo;t)tlerxo3tatlm   nvi ()trumxr3oydlmt lfvt (  Drrum ;u0oetniietyslmDrlu p t0texnxrciytlaDraivils0teuoio oo4ll nmfvia( s2rmxmont0texnmietlsfm rl(mon(0arenmf3oydlmteaneo t0tetrxm no4lp   ics t) Dtm(ro;o1aeto ociysfa ulu pnu4aeenioctytomD lnvo t)teumim oo1llt lfcils srtr(mpoo1tex ii3ils m2rau o t0 ltrio ta1laDe uesl(0 2um(rpiu1lp elivtlt)sDtauro;t0opx if3iadfmDem(mp t) rtrmrctatlmt ln s s seumim3oy4alenlncias)sDum(mpnu0tee iocias a2rluvont4texomo ta1op   ues;( t2tmxrpno1oltelfvta() ruaxr ;t0tlxomocilt m2ea(vs;t4tlenif ty1omtr neil(0trto(rpou1op emieslt)a2taumont0olxnii3tytfs2eauvonu0aexrxr3oy1lpD lueil(0s2trxm iy4omee ivsa()s2rmx pot4tetoiictltlmDum( sn()tetoif ootlptr uvi;t)s2umxrpoy1am elicils sDrrurpoo0olen ietadlm2em( s;u0 eenxfciytomtrlu ols) exrxo oy1omeemncil(  Duru ono1alen fctat s ra(vo u0trtnxo iatop r n s (0trxriopoo4op  mieils a2rau poo4oex  oetydlm ea(vpn(4 leomf3iodoaD lneo (  exo(r3oydam  mnctl(farrax pnu1oleomociltfs2ul( o;t0teerio3oytopte ueil() rxr(rpio4al elics s a2umu o;u0aet mfctadlm2rmuvs;t4texnmr3iadlp   nvs;s)t2xrxopoydapee nvt tf 2taxronu4tpxnmietydlsDuluvp u4arermrcio1opteln o;t t2trxr no1amtn fvi (f Durum nt1teeoii3iadlm2emu pnt0texnxo3totopt li i (0seuoim oo4lm elict () Dum(m ot0oeeo oetls a rm(vonu0aexnmfciadoptr nvo;t s2tmxo ny1lpt lfcil(fs2rr(rooo0oleoifciytfa2eaump (4alxnmr oa1lm  au s;s)t2toir oo1op elnesas)srum(mo;o1oetomo3iysfaDulnmp () rxrxociy1fa rlu il( t2umxopiodapt livsa() Drrx  nu0tetn f3iad m rlnmonu4tlermf tydoat ln s s0teuoxrpnu1om nlicslt aDurx o;t4oexnmfctld mDelnvpnt) exrmf3oa1lpD ai sl() 2uo(rpoodlmt livsat aDrr( oou1aexnmfetyslmDrlnmo;t0tlenmf tytfpDe nes t0 ruo(o3io4ale lfesls)sDtrxmooo1olt mf3tas sDranvp;(0tltomo3oa1lmteli o;t texoxrpoo1llee ivta() 2um(  ;u4oet  feiad mDemums u0tlxnio io1op rluei s)srtmio3io4ape mfeilt aDtmxrpou0tlen o3iad aDeauvp;t0 rtrxf3oatfmt  u i t trtmxo iu4ap elfcilt) Dtr(roou1oeto ietysls rluvs;(4tltnif3iydop eauvils0sruoio3ny4apen netat)a2um(mpnt4aee  fcils s2ulumo;u0 rxoio3iydopteln il()s2toxo3nu1altelnei sf rrau pno0oet mi3tls s2rm( s;u0 eeomfcoytfptelnvil(0 rxmim3nu4ap nlivt (fsrrrxro;t0texomf3iytfm2rl( p;(4tltoxf3oadfmtraivs;t0truo(mpio1amt mnvt s) Dtr(mpno0texn octadlmDraump;u4 leniocoadla eli s s) etoimpoodop n ncslsfa2uaxmp;t1tpt iieiysfm2ea(vp;(4 rxrxrcootom eluvs;t) 2xoiopio4ameelnvilt  rrr(mono4aexnifciytlm ranmo;u) leomo3tadoaDranvi ( srtm(mpnu1opt lfetls arrax  ;u1olxoifcils m ra( onu)aeeoxfcto1laD an olt) eto(m no1lpt licsa(fsDtr(r ;u1ole io3taslmDrmumonu)altrxf todfaDr u s;s0t2xr(r no4lpeelieil( arta(root4opeoifeiydfa2ulnvo;u) eenxo3tydlm eanvslt0trtoxm3oudopt  ncilt  rtr(r ot4apto i3tydfsDulu s;u0 eeoiocia1om e nei t sruo(rpny1ole lfcia() 2ta(mp;o1oexnioctldfm ul(vo;u4 ltoifctydlpD au i t)srxrimpnydamenmfvsltfsDtr(rooo1tex if3tys s2elnvpn(4aexrxo3oydfmD  iei;s t2xm(rpou4olen nvia()a2ua(mpot4tpe iietydls rmnvp;t4trtomr oodfmtran ilt srxrio nydolenmfctl(farrmx  oo1aex mf3ildfaDrlnms (0trtomr oo1la r i il(  2tm(o nodap emiet ( artmxr ;t4aeenmociyt m2rluvp;(0tlxrir3iotoat aneil( t2tmxo3ny4om n nvsasfa2urxrono1altn i3iyd s emnvp t)tlxomr oatlp e uesls)truoir oy4al e ictl(fs2tm(m oo4texoifciytlmDem(mpn(4tetrmo tadlatr u sl()sexrxr3oudap e ies sfartru pno0oee ifetltls eluvp u)arxoio3ta1faDr n o;()t2xo(opiodlp e ieia() Duau  nt0olx mf3ils a2ulumo;()artnif iodom  anvslt s2xoio no4oltemfetl(  Dtrx  ;o4tpeniictad aDemnvo;t)trxnxr3ia1om raiei;t0 2uoim iodop elfcs (farrrxm ;u1altnioetyslmDeau s t)aetrxo3oatlm rlivi t s2toir3nu1ome mfcta(fsDrmu  nt4texoiiciltfm2umn s;t4 eermr ia1fmDe n s;s0trumir nu4lp  lnetls s2trur ou1tlen fctys s rln pn()alxoxo oytfmDe ivi () rto(mpiy1amtelnvtasf rtmxr nt4aeen iciyd sDel(vont0tltrio3ty1oaDe uvi t)seto(r nodomtelfcil()artax  no1aetnmf3ilsfmDea( pnu4alxomrcio1fmtrli ilt) exoir nodoptnmfcias  rta(m ;t0apeoioctatlaDumn p;()trerif3iydomteaneo s)s2xr(r ou1ll n nvt ( a2tax ont4ape ifciat mDua(mo;t0 lxnmf tydoat auvi ()t2uoimpno4lp nlneilt)a2rmumpno0oltn ocilt s2umnmont4 exoircoy1fm  lu s () rxmxm ny4opte fvtls srra(rpot0olto o3tadlm2rmnvo u4treoiocta1la   neo;(  rtr(opiudolenmfetls)arur(  ;u4opxo ietad s ua(vp (0alxnir3tadlmD livsls) ruoim3nu1lme  ieilsfsrurumo;u1ope mfctytfs uluvs;t4arxnxocty1omDrln o t seuoxm oy4alen ieta(  2tmx poo4tpeoifeildlm emuvo;(4teerir3tadfmte i ols)t2xmimpiudamtn fcil() Drmx  ou0opx iociys s rauvp;(0artnifcta1fpDrluvo;t trum(rpny4alee icils) Duau  nt0oeeomociysfa ea( p t)arenmo iatlaD ai s;t0tetrxopiodamt mivta( s2ua(rp;t0aptomfeiytls2rln s t) rxomo oadoaDe ueo;t)s2uriopoo4ol n nvt t)a2ur(m oo1tlxnmf3iyd a2rauvsnu)tlxnxocoydlm  lnvslt texmim3iy1ol  lnesas sDtr(mono1ape mo3iatla2eauvp u) rxnxo3ia1opt  ivilt) rtoxopnu4amt mieilt)aDrmurpoo1oeen ieiatlsDulnvp;u4trtnmf3ia1op  lu s (0truoxm3oy1ap n net t s2uaxmonu1alxo feiadfs ul(vsnu4arxoirciy1fa elu o;( srxmio3iy4lmeemnvs s srurxm nt4apen oeiys aDuau on(4 exrio tytlmtrli s;(0s2tmxmpnu4lmeemivslsfsDuaxro;t0teenmieiadfa rm( s;(4tltoxr3iotlate n i () 2xm(o oo1amteliviat)sDtrx p;o4olx mo3tlt a rmnmo;(4trxrmrcoy1fmtrlneols)trtoirpio1ome lici sf ruaump;o1altn ociysfa2rmumsnt4treniociotopte i o;()teuoim3iu4ame lnci t)arur(m ou0oeeomoeiytfs2rl(mp;() rtnxf tadopte uvi;( t2trimpny4lle lnet t)s2rrxmono1optoiietld a emn on(4tlermf3tadlpD lies t setr(o3iu4ap elicia(farurxro;o4apeoioeiatfmDem(ms u)alxoifciy1omDe neil()sruoimpnodop emiesls) 2tmump;t4tpxn oetlsfa umu s u4arxrmrcootfaD auvs;s)sexmir3ou4llte ivt t)arraxmp;t1oeen oeilt s2ulums t4arxrmocta1lmDelu o (  rxoxm oodol  mfeta(fsDur(r ot4tlx iietls s2eau p (4 rxnxf tydlp r neilt setoxo3oydlle  fetl( sDrmx  ;t0alx if3iys m2umn p (0 rtrxrcto1op ranvi t0s2xrxm3ou4lltemncsltfs2taur ou4oeeniociadlm2ea(ms u)arxrmr3iodlat luvs t0 2umirpnydame lnvsl() Drruro;u1ole mictls a2uauvo;u0artrif ootlptrlivs () exo(opio4om n fvta()srta(mp;o1oexnmfciytlm ua( s;u0trermr3iytla  luvs s seumxrpoo4lpenmfeslt  2trxm no4tlxn f3ildfm2uauvo u0arxoircta1lpteau slt)srurxo oo4omee nvtatfarumur nu4tpe mietytfaDrmuvon(4 reoxfcoa1lp   uvi;t  rtoxopiu4omt mfvta()srra( onu0oetnmoctltfm em(msnt0artnmocto1lp rluvo (0texoxr iu1lmtnmivtas)aDtmur nu4olx ifeiytlaDua( o;u0alxnxrcta1fa eaivsls)t2urxr oudaptemiciat) Dtmu p;u1apt mf3tltls2ulu onu4 ltomf iytlm   uvs;t teurimpnydlle livs s aDurum nu0teenioetydlsDra(vs;u0 lenmf3iodop r u i s)t2uriopny4om  mfetls aDtrxroou1tpx mi3iad s rm(mp (0tltoifcto1oaDr ueols seur(rpoodaleelieiltfsrraumpno1apeo fciadfs2umuvp;t0 leoir oadoat lu s;s0 euoir ou4ole  icsat)s2raurp;u0opxoii3iltlm emn ont0arxrxf3iatfa  lu olt0s2tmim3ny1lmee fvi t) Dumxmpou4teto ocildfm2uanvp;t4 rtoxr oy1lmtrliei (  etm(r oodllt lfviat aDtr(rpot0aetniicias mDumnmont0 renir tytfa rauvil(  exoxm iy4apeemfciatfarrm( ont4aleoiieild s2umuvpnt)tetoxo3iodom elnvilt  rtrxr3no4lltelivi sfsDra(rp;o1tpxo o3iltlm2rau ont4tetnmf oa1fa rluvils) euoxr iy1lm n nei s s2uru ono1ole iieias s emumsnt4 etrmo3tytfat auesl()teumxo ou1ll n icsls srraurooo4tltnmfeiydla ulnmp t0 rtnif iadlm  auvs;t0setoxm oudlp nlfct s s2tax p;o0apenmieils aDrmums;t0 exniocoa1oaDe n i s0 2to(o3no1lm e fvi t)srta( p;u4optn i3ild aDuauvsnu4tlenmf3oytlpteluvol()texoxr3iudlp e netls)artr(  nu1altomi3iydlm elumo u)artomocto1lmte nvo s0sexoxo nydomte ivs tf Dum( ooo0oex ii3iadfa2ul( p ()alxnmrcoy1lmDr nvils)sexrimpou4olte icslsf 2rmxm ;o4tpx iiciasls uanmon()trtnxfciadfm rlnes;t0 2um(mpoodll n netlsf Dta(r ;u4olx io3ilt s uauvo t)arerxfcootlateli s ()setrimpio4alte ncia(f rua( pou1opto fcilsfa ul( onu0texnxr3ta1om  lueo;s  2umir nodapee ict sf 2tr( pou4optn f3iytfm ra(mo;u4artoir oodoptr uvs;t0s2umxm3oydame  ncil(fs2rrx ont0tlen f3ias s2rlnmo;u4aetoif3oytopt  neo (0trxr(m iydalenlieiat)aDuax o;u4altoiictlslaDrmnmpnt4trxrif ty1lpDe ieo;()t2toim oydom e nvs sfsDrmxmp;u1tptn fciad mDelumonu4aexrmfcto1oa eauvi;s) euo(r3iy4apenlfviatfarraum ;u0tetomo3iaslmDem( o;u0 lenioctadoateanesls0t2xo(o oy4apen feil()srtmxm nu4aex ii3ilsla2emump (0aetnxocia1laDe n o;s) ruoxr no1lpt mnet sf 2trxr oo1olxnmicilsfm2ua(mpnt4texoifctodlp r i i ( teuoiopoo1al  mfet t artmxrpnu0texoioetasfsDrl( o;t4 rermociatfp ean sl()t2toxo3iy4oltn ieilsfa2taxm ;u4apt iicildfm2el( snu) lxnxo iodom rluvi;s  2trim nudlm e nvslt)s2uaxro;u0oexoiietydls ranmsnt)tetrxf3iatop ran ols0trtmxopou4ame  fvi tfartrxm ou0altomociadla ranmpnu4 rxnxo oa1oateaneo;t tetmxmpno4apenlici (  2rau o;t1aeeoif3tydfa2ul(von(4 etriociy1laD aieo t0setoxr no1lp  mieias artr(mp;t0opxo octydlsDrmuvpnu)alermf io1lptraivo s0seto(mpiodomtemfeta(farurxm ;u1opx mfetltfs2raumo;u) exomrcoydlm r n s;t0srtrxm3iy4op  liesl()aruauront1alenmicias m2rlump t0trxnxr3iy1fpteau s t  rum(r iudlmenmnvtat s2tmx oot1teto f3iyt m raumo;(0 exoxrciatfpDr u sl()srtoxm3oodoptn ictasf Dtm( p;u0opxoio3tasfs rm(vo t4aeenxo iytlaDelu ols0 eurxm oo4open fcils  Dtrur ;o4aexnmfcildfm umnvsnu0trxrioctydopt  u sl()trxrxr nydol  liesl() Dtaxr ot0tlxn ocilsfa emums;(4aexoxo iydlmtran slt  2xrirpiydapenmncta(farrmx  nu0apeniietls s rl(mpnu0 rxrxoctadlp rli s;t teum(r3iudapen fctlt)srtmx pno0aexnifeildfm2rlu o t0texnif ta1fatrluvi;t)t2trir oydaltelfvtl()s2tau oot1tex  oeiyslmDrl(vpnt0 rtoir3tadopDrlies ()t2tmxm oy1op emnvs s arrr(  nt1aptoiieiyd aDelnmpnt0alermrctotfm   n s;(  rumxrpny1lltnlnvsatf rta(m ;u0tee mo3iadlaDumnmon(4teerif tadop  livs;t0 2uoxrpnu4lmtn nvsl() rurum ;o1aee ifeiasfs ra(ms;u4tltoiocoadopteaivs s)trxrir iu1ale  nvtatf 2umx  oo4apeomi3tls aDelump u)tleoxrciatlpD anvsl( s2trim3ou1ll  lfcils)s2rmx ono4apen iciadfs2elumsnu) ltnxo3iy1fp  li slt  2trxo nudlpe mnvta(  Dta(mo;o1teenmo3iyslaDrlnmo;t)trtnio iydlat anesl( teumxr3nydlmt lfcsls a2um(mpou0tpt  o3tat sDeanmo;t)arxniocia1la  an ol( srxmiopno4al emfes ( aDum(mpno1tpeoii3iyt s rmnmo;(0tlxoirctodop  aneo;s0 2xmxr3oudameemfet tfa2ua(rp;u1tleomiciatfs2raump (4 rtrxocoodla rai i t)s2trir3ny4lmt  netat) Draxr ot4altnmieiat s2uauvo u0 leomf3totlaD li ils) rxrxr ny1lme mietlt)aDur(ront1alto fctlsla eln s;u) etrir3iadlaDeaivs s)sexrxr ou1lmtelnvt (faDtrumooo4opxo f3tytfm2raumsnu4 rxrifcia1lpteluvols) euoir3oydam e ietat a2ua(mooo0oltoioeiasla2uaums u0 rtrircootlpDraieslt0 rto(o oodop nlicilt  rtru oou4aleomfeiadfs ranms u0trtrxrcoytopD livols) rtm(o3nodoptnlnetasfs2ra( pou0oee  fetldlm rmuvpnu)artnmfciotfmt lies;s)trxm(o ny1ome lfesl()sruaxro;t4tlx ioeilslm2emnvonu4arxoxo3iodlateln i;()s2umxmpou1amtnlncs sfaDta(rpnu1tetn octlt a ul( onu4aexnmf3todlaDelies;t seurxopny4oltnmfcia()a2rr(r ;t0aex  fctadla2ranvpnt4artrxr ta1fpt  n s s)s2tmim ou1omen neiat)arurump;u4tetomf3tld sDeauvon() rtnmf3ta1omDean olt0 rxmir oo1alt mnviltfartrx pot0olt mfcilt s uan pnt0 ltrir iy1fatrli i t0sexmir iu1lpt  fet ( arrr(rono4oexnmictysls umnmonu0altrio oo1lp eauvil(  rtrxm ny4oltn nct s) 2umxrpoo0oee mfeiys sDemu p;(0aetrxo3ta1lmDe ues ( srxr(rpou4olen ictls  Dtrur ot0altnmo3tasls ul(vo (0tltnmocto1lp e nvi s) eurio iydop e ics t a2ururpnu1opxnioeiydls eau s;u
\ No newline at end of file
@@ -0,0 +1 @@
+nvi ()t2uo(m3nodomeelfvias) Durxrp;o4apenmfciat aDelnvo;u4treoxf3oydopD auvils0tetm(rpiydole  ncils srrruroou0oex mi3tatfm ul(mont0texoir oo1op elueo;()sexrim oo4opt  fvsltfaDraxrpot1opxniiciytls rlnmsn(0trermf todfmDrai o t0srxr(rpoo4ope mnvsl()srrm(mp;u1altnioeiyslm emn p;()alerxo oytfm  livi s)trum(m3io4lm elivsa() 2uaumoot4oee  fetyslmDemnvo;t4tlxrir3tatoa  aivsl(0srtmio3nu1lm elfeslt)sDrax  ;u0tlx mfeiydfs ul(von()altomfciotlaDe iei;t  rumxr nodap nmicta(fsDraxm nt1tle iieiad a rlu p u4alxoif iotfate iei;t0texrirpny1olenmfvtat)aDtaumpot0oltnioeiysls2rl( p;u4aexnmr3tytfpt aueo;t s2tmxmpiu4llte fvsltf rurx o;t1altnmfcias mDemumpnt0 rtnmoctodopD  i ol(  rtoio3oydap elnesat)arraumpou4alx  i3iat m em( pnt4 eerxo3oadfm rluvol(0 2triopoudaptnlfcsl(farraxr oo0olt  oeiadlmDrl(mont)tlxrio3iotla  anvi;(0 rtoxm3nudal  mivs ()aruaxroot4apeoiiciadfm2eanms;u)altoxr3iy1lpDraivo;s)t2toim3io1lmtnlnvt s aDtr(m ;t4tpx ioetls s2ea(vonu0 ltrircoydlmDelivi t)setm(m3nydlm nmnci (faDrmx  ou0oeenmo3tasfs rlnvo;() lxnxociodlmt  ueilt0seurxmpnu4am   net () 2rm( onu0oet iociytls2emu onu0artnif ty1omteaies s)sexoxopou4ape mivs (farumumpnt4texomieiyd m umu snt) eenmr3ta1omt li s;s  etrxopoodam  lnvi sfsrtmumo;u0tex iocildfs ra(vp;()aeeoxo3iadlatr iesl(0 2to(m no4ome  fet t s2tm(r nt4apxoifeils sDea(mo ()aetnmf oydlpDranei;(0tetmxr3oy4oltnlfvtatf rraxmonu1teenifciyd m umnms u0aetoxo tatla elueols  2toxo3no4apee net ( arurxro;t0tlt mo3tad m el(vp t) eerio3tytom e u s s) 2xrirpnu4amtelfviatfarum(mo;t4optoiieiydfs elu s u4 rxrxr to1omt lues t0 rtm(o oo4ole  fcsa() rraxrooo4apeomfctltlm2em(vs (4 exnxr3ty1laD auvo;( t2trio ny4lltnmfcsatfsrtrxr no0tpeo iciasfsDeln s;t0altrxr io1la  aivi t0 2uo(o3oodamen icsat) rur( oot4ape if3iltla emnmp t4artoio ootfa e nei s t2tmir3iodllee icilt s2ta(moot4alenii3iys s eanmont) lxnio3oy1oaDr ieol()texm(r3nu1lmte fvslt)aDtmxrpno1tptomfetad m2rau o;(0alxnifciatoptelnvol()srxrim ny1ape mfcs (fa2ta( pot0openiociytla umu s;()tlerio iydfp eaivo;s0s2um(m3ny1lmee fvi ()sDuaumooo4alx ifeiadfm ea(vpn() leoif ia1fa  luvi;s srtmim nu1ope lnetlsf 2tmur no0opt mo3tltfs2elumsnu)aeenxfcoo1lmtr ivils)tetr(o3iydlm   fcias)aDua(  no1olen fctlslsDrmu pnt0 exomrcto1fatrlivo;( trxrxm3iy4ll nmfvt ( arumu oot4oeeoiicias m ra(mo;(4tlxrxf ty1la   i i;t0setoxopny4oleeliesl( s2um(r ;u0opx mfeiydfm um(ms u) renmfciydfaD  ies;()trur(r3iu1lle  fei t  Draur nu1oeenio3tyd mDrl(mp;u4 etrmr3oadfm r i i;t0 2xoim iy4amt mfvsat  Drm(mpoo1oee mo3iadla2ua( o;t)tetoxrcoytlaDelu o (0texoxopiu4lmeemiesa()s2ur(rp;t0opxnifeiltlm rl(mpnt0tleomo oytopDrai sl(0s2toxrpoydlp  mfctlt sDraxm oo0oee mo3ias sDuln snu0 etomrcoa1optrli ilt)texrio io1lleeliet (fsrumxmpnu0tpxo fetyt m2ul( s t) leoir tydfmDrai ils0tetoxo iu1omtelncs t s2ua(rooo0tpeoif3iysfm eln pnu4 rxnir3iy1latean s s0teumxrpiydom  mfvilsf 2tmum ;o0alxo o3iyslm2rau o u4trxnxrcoytfmtraieilt)t2xmxr nodalenlnvsl() rtaxmpnu1oltoioetatfa rm(mp;u0 etomo iydlmt  nvo;s) rxm(opnu4amtnmfetat)a2taum ;o0tptnmoeiatlaDrmn pnu4tltoxocto1fateaieilt s2xm(m ny1alte net t artruroou1aet moctltfa2emn ont0aeeoif3oy1optr ies t texr(opnudllt mivsltfarrr(mooo4apx ioeiadls2elumsn()altnmrciadfmDeluvi t  2tr(r no4am emncslt sDtmu pou0ope  oeiltfm uluvo u4 rxrifciotoate n i t) rum(opoodol e icsas a2urx poo0apx iociysfa ra(ms;(4 lxnxr3tytoa rluei;s)texrxmpoudam nlfct t) 2tmxr ;u1opto fctaslsDranmont0texoxf3oytfmDr nvi;s  etoiopiu1lpte ncsat artmxm ;t0ole ifctadls2umumpnt0tleomo3iydfp eli i;s)trum(m nydome  ivsls)sDrm(mp;o1tlx  iciydlsDrau onu)trtnif3ta1omtrauvo;( setoxmpoydomeelnctls) Dumxr ;t1tlx ifetydlmDranvs u4alermfcoytomt  ivslt s2umxmpoudolen iet t  2urxrp;o4aeeo i3iytfa2ul(vpnu0tltrmf oo1fm raues;(0sexrim io1ol n fcsatfartaxro;t0tpenmf3iaslm rlu o;(0aexrmrctotfmtraneo;t0 rumirpoy1altn fvtas aDtr(ront0olto oetas s2uaumo (4tleoxf oadlmtraneo;t) rxmxmpiodolt  ivi t)sDrm(rpnt1aexn f3iadls em(mp;u4 rtnif oatopDe neo;s0 2urxr iodap emfeias) 2ururoou0tlt if3iasla2ul( onu)trxoio ia1fptrauvo t)srxmxo nu1oleeliesa() Draumpno1olxomietat m2ra(vo;t0 eeoxfcty1om e ivi;( setr(o3nu1op nlnvs (fsDtrxrp;o4opeomociys s2uanvs (0arerio3todlm rli o;t0 etm(o ny1lpe lfcs s)srtmumooo4aptn f3ildlm el(vpnu0tleomr io1fptranes;s0teto(rpny1lleelfci t) 2umx oou0alt mietlsla rauvp t) lxrmr3tydoatraueolt) 2uoio nodlm e nci () rur(  oo4tptniiciasla el(vs (0trtrmo3oy1la  auei;t)sruoxm oo4op  micia( sDrmxrp;o0aet mfetaslsDem( snt) rxrif3ty1fmD  u i;s)truoio no1amtnmneilt a2uax o;u4opeoifcildfs rm(msnu4aeenio3totlmD an s;s  rtr(rpou1lm emfet s s2raxmo;t1tex mfciytla2rm( sn() exrmocoydlpDe i i;( tetmxo nu4alenmics ()sDtau o;t1aeeomocilsfaDrm(vonu)treoir tydlmte n o;s srum(o3oo1lpt  fei t artr(mp;o0oetomf3ildfs2eanmo;u0aetnxocoa1om elueo t)s2toir3nodllenmnetls artr(  no0aee  ieiyt m um( p;(0 rxnxr totfaDe n olt t2umxrpoy1lptelnvilt  2rmumoot4teen fcias m rln o;t4altomociatla eaiesls)t2uoxm3iodlme  ivsas  2rru  nt0ale  ociltls rl( snt0 ltoxrcia1om  aivils setr(r3oy4apee fvilsfaDuru p;u0tee  oeilsls2ea(vp;(0artomrcoatoateaivs ( setmio no4lmt  fei s  rrrum oo4texoiieiydfmDuanvo t)trtrir3tydlat an sls)srtmiopnu1omen nct sfs2rrum oo1apt mf3ild m2eluvont)teenxr3oodlm  luei;s0texm(o3oodllt livil(fs2ua( o;t0aptoio3ilt m rlnmp;u4tlxnio ta1faD lnes;s  etrim3iu1aptelfvs sfs2ta(r ;t0aex mf3iadfa rlnms;t0tetomr3tytop rlneols) rxo(opny1lmt  ncsl(f rtru poo1oex iocild s umu p;u4teenxrcta1fpD luvs;s trtoio3oo1omtemietltfaruau  nu4aetnio3tysfa ra(mo t0texomf totfpDrauvolt0 euoim3oo4ope lieia(f Dtaxrpnu0altoifeiat aDran s u0 lxnmo3tydomtr neslt seuriopiodlp  liei s) 2raum ;t4altoii3iytla2rau p (4trtnmfctatoaDran i;() exoir3nu1olenmicilt  rtrur oo1apxomfcils m ran s;u4trxrmrcoodopt aivo;(  exmio nydom n nvsatfa2uax  nt0oltniiciydfa el(vo t0alerxrciodfp elueo (  2xrxrpoy4op   fetls aruru o;o4aptniieilsfm emu o u4arerio todlp ean ols0 rxo(m nu1ol elncsat arrru ooo1olx iiciyt s elnvo;t0treoio3iatoaD anvo ( trxmim oo1ame  nci t  2ta( ooo4aleomi3tatfmDrlnvo t) leomo3ootfat auvol( seumiopnu1lmt livils a2rr(m ;o4texoiociydlsDuaumpn(4 reoxf oa1lm raies t trxo(r3nydape lnvi ( sDtru pot4apto fciydfm2eanvonu)alxomo3oodfp  lueo;()s2trxo3oydole lfvt ()artmx  nt0alx if3tysls umnmo;t4tetoio3oodlpDr nei;t) rto(rpiy4opte nctat aDrax poo0oeto oeiytfsDrlnvpnt4teerxr iy1lmtr iei;s)t2xrir3oudame mivs t srtr(rpnt1apenmfeiydlm2ua( o t0tlxoio3iy1opDe uvi;(0t2trxm3oudal e ietltf rrau pnt1olxniocild a uanmo t0artnxf io1fm eli i;() ruo(r3ny4lltemnvilt) rrr(m ou1opx io3iyt m uanmp;t4 lenmf oo1lat luvolt) eurxr iy4lpt mfesls)arrruront4tpenmictys m ua(vs ()trenmrctadfm r iei;(0t2trir3nudomte fcs (f 2raxmpno4aetn feiltls um( o;(0trxoir oatoate nes;(  rumio3iu4lpte nci s)aDtaumo;o1opeoifeiltfm2rluvs;(0trxrmo3ootla r i ol()srxm(r3ny4aptemfvsa( s2rmu pno0olen fciydlmDuau pnt4arenxrciotoate u o (0texmio3nydal elfvsl(fs2taurono1aetoifciyslm elump;u4arxnxo iadlmt anvols) 2to(o io4apt mici (fs2tm(r ;u4aptomiciat a2rmnmpnt0arxrxr3ta1fpDe iei;t trtrirpiu4altnmnesa() 2uax o;u0tee ifeiat a2rlnmo u4aeeoiociy1lmtr n i;s0s2tmxm nu1ame mfciltfs2tax  ;o0aex io3tld s2uau snu4 lxomfciytlp ran s t srum(o io4optnlfvtas  2rr(  nu1aeenif3ias m rlu s;u)aeerxr3oydlmtrln i s)t2xm(o ou4ol nlicil(fa2ua(m ot4ole  icilslmDuaumon(0trxoirctadfat ai i ( t2to(m3oodapeelfvt t)arurum nu1alxomfeildfa2ulnmo;(0aeenxo3to1fa   ieo;t0srumxmpou4ol elfeias)aDumurp;o4alt  f3iyt m2uluvo u4texnir3to1fmt au o;t  2urir no1ap eliesasf rrm(ront1ape iictasla rln p t0 lenio3oytoa   i i;s s2tmxo3oodop e fvsat) Draxmo;o0tlx ioetas a2uau on()altrmo totfm  ln o;s teumim iy4am  lnct ( srtrxronu1aex ioeilsfa2ulnmsnu4arerir3oytlmtraies s  rxoxr no1lptnmncs tf 2urxroou4olt iociat s2ul(vp;()aetoxf oy1fpDe uvi ( t2xrirpoo4lpe livsas  rur(mp;u0olx ii3tyd aDrauvpnu4 etrxoctodfpDrlu i;t)s2toxopou1lm  mfctltfsrrruro;o0aex  o3tatfa um(mo u)altrxr todfm r u o;s t2uo(r3oydlme  ietat artmx ono0olto i3tlslaDumnvp;u0artnxr iydfptranvo (0teumim3iy1lpenmfetlsfsrurxm ou4tet micilt aDeaums;u0aetriocoodfatrai s;s)trxoir3oydlm  mfctl()a2rmxrp;o0aeen f3tls s rlumpn(4 etnxr3oadfaDrauei;s)sexrirpoodll elfvtat sDta(moot4tlenmf3iat s rl(vs t) rtrxfcty1omDranvi;s0texr(mpoydomenlfes s)sDua(  ou1tpto o3iadfs2rluvs;t4 etoir to1fmDeai o;s tetr(o iu1amtnlfct tfsrururpnu1oltoio3ildfs eanvpnu0 etrmf3iadlmDeauvs () rum(r3oy4lpe livtl()s2rrxmont1tet mfcilsls rlnvpnu0 eenif3iytom  ln i;()srxrir nu1am   fvilt)arrrxmo;o0oeen fciatls2ranmo ()altrifciotlp r uvolt0tetm(r3oo4apt mfcs (f rurxr ;t4tpt  icildfs rm( o;u4 renxr3iytfaD lu s ( tetoxm no1lpe lfctltf 2tr(moou0alx  i3tld sDrmu s;u) reomf3oatoat auei t tetrio3ou4am nlivtat)a2ur(rono4olenmociydls2uauvs t4 lerifciodfpt aues s) eumxmpiu4lm   ics s  Draxmonu4altomociad mDuluvo t4 renmrcta1omDrai s;(0srurio3nudol  livtas) rum(m ou0tpxnmfeiadlm2el(vsnu)alxnif3iotlatelneo s0trto(opio4opt  ncs (  Dumur ;o1aexnio3tysls eln o;t)trxrir iy1lp rli i;s0s2trxo iydape mncils sDum( o;o0tex ii3iadla emuvont0alerir tydla eaivs;t s2trxmpnudopen ictltfa2umxm no4tetnmoeiysfmDum(mp t) exoxoctotlm elnvs ()t2uo(opiudlmtnlfet s a2tmx ono4open i3ilsla2rlnvo t) lenir3todlp eaivo s0t2xm(r no4lltnlivt t)s2rm(ro;o0oetnifciyt m2uln p t0 rtnmfciy1fm   ivsls0truoxopoydlmtnlfctat)srrmuronu1aexnmf3iysfmDuluvo u4 rerxoctytfp ranei;t0 eumxo3ny4olenmncil( sDra(r ;t1aexoif3tyt aDelnmsn(4trtomf3ty1oat li i (0truo(r3iu1ll n nviat s2raxro;u0aexnioctytlm2um( o;t0tlxnxocoydlm rlu s s0texr(opnu4altemnet (  2um(mo;o4tpt micias m rlu p t0artrxfctadfa  lnei;s) rtmxopiu4al  lnvi s s2uax  ot4opto fctlsfa rlnvo;()arxnio ta1lm e ivo;s s2xoim3iy4oltnlnes (  Durx pou1tpxnmieiasla uau on()trtnxfciy1laD livo;s) rxmir no1amtnlnes sf 2umurono4tle iociadla rlu pnt0aeerio3oadlpt  u sls srxrxmpiudaltn nciatf Drmxmpnt4tpeoioeiyd s2elnvp u4 leomfciytlaD ai o t)t2tr(o3oydllt  ivi t)arumump;u0oetn oetltls2rlums u4texnif oatlmDe nvs t  rtr(mpoo4olte iciltfsruaxmono4ole mf3iatlsDul(mp;u0 etomf iy1lpte nvo ()srxmio iu4om  licias)arumuro;u0tleoioetat s2elums;t)aeeomrcoydoat  neo (  ruo(mpny1oltnmics ()s2tm(m nu4tptoiiciad a2eaumont4areomo3iodfp  anei;(0setoim3nodlltnlictasfartmumpoo0aexn ocils a rl(vpn() lxoif iotopDeanvsls  2xo(o3iu1op e nvs sfsrra(rp;o1olt mfctasla2elu o u4 rtrir oa1faDeluvi () rxrxm io1omtemnvs (f 2trxronu0texnif3ilsls2eau o t)tetrmr oy1oaDeluvol( trxoir oy4ol   ivsasf 2tax p;u1olxoifetysfa2ea(vs;(0aleoir tydfaD  nei () 2umxr3oy4ol emnvia() rum(m no0alen ietyd aDrlnvs (4tlenxfcia1lpt  n i;() exmio iudam  lfvi t)aDurx pnu1apeomi3iytlsDel( o;t0tlxomfciy1om r ieolt)setrxo3iu1oltelivs tfaDumx  ;u0olx mfetytlm uan snt)trtrif ootla e i s t0t2trir iudap   netl()a2rru  ou4tet ii3tytlm2ranms;u0tleomocto1opte nvi;t t2toxr nodapt  fesas)srraxrpoo1altomiciad mDrm(vp;(4alenxf oo1op  aivolt0 rxrxr oo4lptemfeil( a2ur(m ;u4aexo feilsfmDemumo u4 rxoirciydoaDeanvo (0trxrxm3ou1aptnlfcsasf 2rr( oou4tlxomfeilt a2uluvs t4alxoxfcto1op  lieo;(0 2xo(m io4om n icsl() rrrurpno0alxn i3iysla emu o t)tetrxr3oatfaD  u i;(0trtoxmpno1lmeemfci t aruru ont0alx mfetasfs2rmu p t4 lenxr3iatfpD  nesl( t2xr(rpoy1al e fcs tfsDtrxmo;t4olt mf3iatfaDum(vpnu0arxoxociytlpDrau o;( teuoxopiudlm n fesa() 2umxro;t4texoiictlsfm2ea(mont0tetrxf oy1fpte ivi;s  2ur(rpio4am emfcil(faDraxr ot4tlt ioeiytfaDum(vpnu4teermrcootomt  ivi t)t2xo(m iu1apt  ieia( srtrxmpnt1tpe mieilt m2um( snu0 ltomocio1fp  lueo ()srxoim3oy4lmtelicsat) rtru pnt4opxnmfeiatfaDua(mp;(4tlxoir iy1lmte iei;s)s2umxrpiodaptn nvs t arra(r oo4aleomfciytla em( ont)trxoxo ty1oat lueils)teuo(rpoudomte fvi ( sruax  nt1tpeoiociydfaDulu s;t0 rtoio oa1fm rluvsl( s2uoio nudllee fvtatfa2tmumont4opeoifetltls2rm(mp u)trtnir3ty1omtelivi;s) 2xrxm no1lpee neias) rrrxro;u4tpxn iciat sDea(mon(0aetrmr oy1fmtraneslt)t2tmxr3iu1ale  nctlt  rtaur ot1opxn fctlsfs2rl(mp;u0tlxnifcootfaDrlivi (0 2uo(rpno1lle  fvsl()s2tax onu0oexoifciad a ra(mo;u4aexnxo iy1laDr nvo;t s2trio oodlltemfesl( a2rrumo;t1alxnmfeias aDemnmsn(0aetnioctatoa rlnvi;s) etoxr nudlm emfcsat srurx  nt0oltnmi3iyslsDra(vsnu0aetrxrcootoaDelnvo;(0trxmio3ou4am n ivi tfaDta(ro;u4opt ifciytls ra( onu)alxrxfcoy1lm r n olt trxr(r3oy4amtn fctl(fs2rrxm oo4ole  ieildfaDrmnvo (4 ltrxociadfateaivs;s0 etmimpnudape  ies s arta( o;t0alxniicias a2uluvp u) reomf3tatla r ivo s0srxrir3oo1apeelfetas)srtmxrono1tpto oetlsfm umuvsn()aeeoxo3oytlpte n s;()seumxo3ny4alee fei ( s2raxr nt4opeo o3tatlm2ul( snu4 leoif ia1lmt lnes;(0srtoiopou1omeelics ( srumurpnu1altomictadlsDuauvo t)tetrmr iydoat  uvo;s0teumir oudamtnlfvsls s2ra( p;t0tptnmoetlsfa2umu p;u4trerxr3iydomDeanvi;s srtmio iydop n nvslt) 2trxrpoo1oex mo3iad s2ulums;(0tlerxr iodfptr uvs;()s2xm(r nu1ale  nvi tfsDuru o;u0texnmf3ilsfs ea(vont0aeerioctydfpt luvo ( t2umxmpny4omtnlieiat)srraxrono4opxniicildlm2rau p (4 ltrmrcoa1lpt  ivo;t) etr(mpoudal nmfvt s) rrmu  ;o0aleo feiytlm2rm( p u)artnirctodfatraivilt0srxmirpnodlmt lfvt (f 2uaurono0teeoiiciatlm2ranmont0arerifctotop   ieols  rtrimpoy4olenmnei sf Dtrur ot0olx  fcils aDel(mp;u0 leoxo oydlp rlneo (0truoxm iy4ap emfvia(  Dur(rooo4aleniicilt m emnmpnt4artniocoa1fateli ils0t2xm(mpou4open nei t)s2taurpot4olxo fetasls el(vs;t) exoir3ia1lmteau ils0 rtoio3nudale  fct ( s2tr( oot1oltn ieils s2el(mp;u0 lxrxo3iatopte nes t)srxo(r iy1olenmfcias)sDtaxm nu4oleoiietytlm2ulnmo;()texoir to1om r ivols)trxrir nodameelict t)arta(r nt1tpenmfeiadfs2emnvon()alxnxr3oatomtr i ils0teurxm3ny1lme  ieilt) 2um(mpnt4aeeomieiasfaDrm(mp t) eeoxfcoodomD lu i t0s2uo(o iy1apt mneil() Dumx  ot4tlenmictasfs rmn on()tltoxoctytfmt  ieslt) 2toio io4amt lfesl()a2tmu ooo1tpx  f3iad m um(vo;u0aleoxr oatopDraneo ()texo(m3no1ol n ietls)aDrau p;u4tpeo oetasfaDuau p u0 leomfciytlmDelnei s0s2trxrpiy1olenlfvi t  Dua(mpoo0teeo feilslaDra(ms;()arermr iodomDeanvslt0 rxm(r oo4amen ivia()srurxmpno1aex iietldfa eau o (0artrir iydfmtrlieolt t2xr(r oy1lp n ieil()srra( ont1texomicilt aDum( pn(0alenir oo1fmDelnesl() 2to(m oy4lmtemfci tfsrtrxmont1aexnmo3tlt a em(vs;(4aetnxociodfpteaivi;t trur(m3io1omenmncsa() 2rmxroou0oleo ociasls ea( p (0trtrio3oatlmt luei ()srur(rpiudlp n nvsas a2um(mpou1oltoifciysfs2rm(mpn(0tltomr3oytop  aivsls) etmio iudlltelfcias)a2ua(r ;o0opxo i3iydfa2umuvont0 rxnxrctydlpD  n o;t)srtmim3no1lp nmies ()arumur ou0tex miciyslm ua( o u4arenxr iadlaD lues s  2xo(o3oodlp  lfvs (  2ra(mo;u0aetomietld a eluvo;()altnmocootfaD an o;t)sexm(m3io1omtnmiesa( a2uau poo4opto f3ilsfm2ua(mo;u4 renircto1lm eai i;s  2tm(o3oo1oleelici s sDtau ont4aee mi3iydfsDeanvp;u)trtrxo3oodfm eaivo;(0srxmio3oudlptemivtas)sDrm( pno4ale iocilt m rau s;t) ltoio3ta1lpDeau ilt) 2xmim iy4aptelietas aDtm(rpno4aeenmo3iatfm ulu s;t0 ltrir3iadlaDe ies;(  etoim3oodom elivi t)srrr(rpot4tle  octat mDrmnmo;u4tetomfcoydfp rliesl(0teuoimpiydaleemivia() rtr(r nt1olx ifciytls uanvp ()trxrxrcta1oaDe ueslt0srtmirpnydlpenmicilt)s2ua(mo;t1tlx  o3iytlm rl(vo;t4 etoxr3iy1la e nvs;(0srto(m3oodape  fcsas)aDumur ot0olx iocilt mDrmnvp t)alxnircto1fmD aneo (0trtrxr iodam e fesa(f Dtaxr no0apxniiciysfa uanms ()tlermr oy1lmDean s;t0 rum(opnodalee ict tfs2urxm no1aee  ieiasls ulnvp;t)arenirciytomtr ivsl()tetmim3nu1ope livilsfsDtmu o;u1opto f3tld aDua( pn(0 exomf3ootfatr i o ( sexmxm3no4ll   fvs t  rtm(  no1alxn o3iltls2uaumon(0trtoxf to1fatrlies t)trumim iu4llen nvs ()s2urx oou1oex  f3tlsfsDulnmo u)teeomr3totop e iei t0 2tmxr3ny4lpt  fcs s arrmu ont0oleo o3iys mDranvo t0aetrif3oadoa r iei s) 2um(m oo4ll nliesl() rurxrp;u1optoiietydfmDel(vsnu)tlerxfctydlmD anvol(0texo(rpoy4llt  ict tfsDra(mp;t4tet miciysfm2ul(mo (0 exrxocoo1fptr uvs;t0seumimpny1ap e fcsa(f rrmurpnt0tlt  o3iyt m2umuvo;u0texrmf oodlat lnvi ( s2umxr3iydamenmivsl() Drm(mp;o1opxomfciydlm ul( p ()tltrio3tatlpDe uvo s)tetrxm iu1lle  ieiat)sDraurp;t4olto oeiatls2elu p;t)alermo oatlaDeauei s0 etoio iu4lle mnvias aruax pnt4tpx iociytls emnvp;u4aexnmf3todopDe n s;(0t2umxo io1om  mies ( s2rax  no0tleniictldfm emnms t)arenir oytlptr n olt)teuo(mpnu4lp e feta(faDraxm ou1ape iociys m uau s u) rtoxr oydfpDeaueo;s teum(r iu4amenlics s a2taumont1tlenmi3tltlm2uan o t)altoio oa1fatrai o;t seumim3nu4amen ivi t  2urxmpot0tpxomiciatfsDuluvs;(4aexnmo3tadlp ranei;(0srum(opnodop emics sf Drrur nu1opx  i3tldfmDuan snt0artnmfcoo1opDelu ils0 2uoir no1aptemnciat)artr(roou4aet  octatls elumo u) lxomr oatom rlnvo;s0seuoxopoodll  mnvta() 2uaur ou4oetomo3ils s elnvp;(0teenmr3iotoat  ivi (  2xoxr3oudoleeliesasfsDuaumono1oleoifciytfa rl( p;u)tetnmf3tytlm rauei;t  etoim iu1alt  fciat) rrrumpoo4alx  feildls2uan o;(0tlxnxr iadoptrlnvo;t0truo(r3iu1lmte fvt s aDrmxronu1oltomiciad sDrl(mon(4trxoxf iadfpte nvol(  rxrxopio1al n icsat)aDuax pot1altomo3iad aDelu o (4aeeomf oo1laD au il()sexoxrpnu1openmnctasf 2raxro;o0aeto ieiatfaDra( pnu4aetomo3oy1fp eli sls0 rto(rpio1ol   ici ( sDtm(  ot0teeoifeiytlmDem(mpnt0 exoxf iadfat  ueil( t2xrxm3oo4open ivtat)aDtr(moou4open oeiatla2uan s t0artoioctydoaDr uvols t2trxo oodamtnmnesat)srrmu  ;o1apxo ieiys aDum( pnu)artnmo3oy1lp r uei;t) etmxo ny1lpt mfeilsf Drrx p;u4oet  i3iltla rmnmo;u)trtnxf3tydlpt  uvols0t2xoim3oydlpeelfeils sDrr(mo;o4tlen o3iat aDumumpn() rxrmfcoadla raivo () exm(r3iu1optnmfcs t sDuau poo4aex ioeiasfm2eauvpnu4alxrmf3to1fmt  uvolt  2xr(m iu4lpe lfviatfsDrmu ont1tlto ieiadfsDua(vpn(0trerio oy1lmtelu slt) 2tr(m iy4lltnmnciat  2rmx pnt4opt  oeiatls2uluvp;t)arxnxr3iytlaD  ivo;t)seurxmpoodamteliesa( s2rr(mp;t0tpeomf3iat m rmuvpnt4 renifcoy1oa  auvs t) 2uoxrpno1ap nlnvtas a2tm( o;u1apxomocild a2ea(vp;t)teeoxo todlatr i ilt0teto(rpoodlm e ieiasf rtau  ;t0olxn ieias s emnvs (4tetnxf3todfp  lu ilt texrxm nydale  icsa( sDrmx onu1oexoii3taslsDranmpnt0trtoxr iatoaD lnvils) 2tmxrpno4al e fesa(  rrm(ro;o4tpe mociasfm ulnvp u)aeermr3iytom rau i ( teumirpny1lmeelnvtlsfsDrau  ot4tex iieiyt a2ul(vs t0aexomf oytfptrlnvols)t2xo(m iodll nmncta( sDtmur nu4oeen i3tyt m2ulnvp;t0trenif iotopDr ieslt0 2trxmpiu1opt  ictas)aDra(  ;u0aeeoiieiltla2umu pnt)aexoif oatlp eaivol() 2tr(mpoudllt mivi (fsrurxmpou4tltn octat a2ranmpn(4 rxrif iydom  lnvo;( teur(m3oo4apeelfcils  Dtmumpot1tpen f3iad m2umnmo u0trtomr3to1fptraueil(0sexmirpio1lp n ivsa(farur(monu4ole  f3iyslaDrm(msnu0tlxnmrciodlpt lieolt s2uoxmpiy1om  lfcils)srur( onu4texniictls m2rauvo;t4arxnmo3iydfatr ivi;()srtm(o3oy1oltnlfet s aruaxmp;o4tpeomfeild mDuanmo u0aeeomr3iy1om  lnvi s0teuoio3oudamen iesltfsDrruront4altomoetldfm emuvpnt4trtrmf iydom  auvsls0tetrim3nydlmtemneias  Drmxrpno4openmf3iytfmDum(vs;u4 exrmr tadfaDraivs t)srum(o iodomte ncias sDtaumooo4tlxo f3ild s2elnms (4 ltoxf iadfmD  n i s srum(o io1oleelneiat a2umu p;t0opx ifctytlm2umuvs;u) rtnmfcty1op   i s () 2urxm3iy4amtelnei tfa2tmumo;o1apx ifcild mDeau p;t0 renmo3iy1lmDr nvs;t) rtm(r oo4apen fetls sDurx pnt0alxoii3ias s2eaumonu)trenxf iatlmDr i s t srto(opoydlptn fet s) 2umumoot4aet  iciasls ul( o;u4tetoir io1fm  luvs t)trto(m nudlmt mfctl(fsDta( o;t4apx  iciys a umumpnu0aeeoxo io1lptraivo;s0t2tmxmpnudomtnlivsls sDum(mp;o4openmoeild s ulu snu)tetrxfcoadlp   ueo;s)t2umio3oudll  mivsa( aDumx o;t4aeto f3iydlmDuanmp u4tlxomocto1faDeauvs;s)trur(r3io4lptelivsat  2tau pot0ope iictltlaDumu p u)trtniocia1laDrauvs;t  2xr(m io4ap elfet tfsDrau  no1apt mieilsfm2rm( s;(0arenmr3oadlpteluei s srxoxr3oy1lmeelfvta() 2urx  ot0tpxn feiat a2ea(vp u4arenmo3oytom rlueolt  rxmxo oo4amee nvs (f 2rmxrpot1tltoioctltlm eln s;t4 lerxo3tadomtrlivi t)s2toxr iudlpenmieils)a2tmu p;u0aleomfctaslm2emumpn(4trxrioctotomteli ilt s2umim3iy1ap emfvilsfa2raxrp;o1teeoio3tysfsDemums t0trtomo3ta1opD li i;s0t2uoxm oydoleemici t)aDra(rp;o4teeo f3tld s2emu p;t4 ltoxociodlmteaies;t0s2uoxm3iy1ap elnesl()a2tmxro;u4alxn ocilsfaDumu p ()arxrif io1omteaivils texm(m3iu4amee nvs (fa2urumpou1aexomfciyslm2ea( p (0tltnir ootlp  ai sl()srtm(o3iy4llenmfvtl( arumur ;o0optn o3iadfaDrau p t)alenif3oytop   n ilt) eumio oudope  icilsfaDuaxm ;o4aeto ictys a2rm(vo ()artomrciadlp rai o s0srxo(o oydape  ncias srrrxmp;u4aetomf3iytls ua( p;t)arxnxr3ta1fate ueo;s) exoimpou4optnlnet ( srrrxro;t1olxo i3tysls rluvo;(0 leoxfciytlptrlnei s  2tm(opio1op nmieslt a2tax ont0tpeo o3ilsfa2ulnvpnt4alxrmr3oytfptran s;s)s2umxopiodome licil( arrrxmpnt1opxomociysla uluvp;(4 ltomf3oatlptelueil( s2tmxmpiu1ap  livs s a2trur ;u1olxn ietldlaDrm(ms;u)aleoxo todfm e n ol(0srxmxo3iodllenmfctls)aDururpnu4tptoifeiatfaDrlnmpnt4tetomocoa1lmtrai o s0 eur(r3iy4ole  icias)srumx  ;t0oexo icilslmDuaumo u0arxnxr to1oaDrln ol(  ruoimpoydoptemfet t) 2rrx o;u1altnmieilt mDeln p t)aetniocoydomt  u i;s0t2xmxopiu4aptnmfesl()s2tm(m ;o4alxomi3iytls2rm(mpn(4treomrctatoaDr ieo ( trxoio nodlpee nvilt)a2raxrp;o1alt moeiat a2ulnvsnt4altrxocoadfp  auvo s trxoxo io4al elnciltf rrrx pnt4tpto iciatlsDeaumpn()alxrmf to1fpDrai i t) eurxr3oo4ol nmnctls)arraum ;u0olen oeiatfm2rlump t0tlenmo3oy1fmDrln o (0setm(o no1lpeelnet sfsDum( ono0optoii3iydfm ul( p t)tlenmf3iytlmtrli i t  2xmir no1olt lfctatfsrtm(m nu1tptomfeilsls emnmp;u0 renio oydfpDrauvo () 2uo(o3no4am n ies (faDumum nt4oetoiiciysla ranvo u)artnmr iadoatrlueo;(0seuoxopio1lp elfvtl(fa2ur(mo;o4tpx ioeiatla rauvo;u4trtrio iodomDr neo;( t2umimpoy4op  licsa(  rtmxm ;t0oeenmoeils sDrluvont)teermociotfmD lu olt) eum(m3io4lmen nvia( s2tm( p;u4tlx  f3tyt s2eau p u4 leomr3to1fm rluvs;() eumxr3oy1aptnlicslsfs2raxm ;u0tptomieiysfa rmnmo (4 etriocoytfpD au o;( sruoxo no1lpenmfcs ()sDum(rpou1aexniieiytlm2ul(von(4 exrxfciatfmDrlu s (0trto(mpnodamtnlicil(f 2umurooo1alen ieilsfs umu p;()altrmo3oo1faD ln s;t srtoir3io4ale lietlt)sDumxrp;u0alenmoeiyt a rmn s t) renio3oodlaD aneilt)seurxm3oo1am e fcs s aDrmx pno4tpeoioeiydfs2elumsn(0aetnmfctydlm eluvil( srumxo iydopen ietatfsDtrur no1tltn i3tytfa rluvonu) etoxr3oatfp  livsl(0srumxr3oudamenmicils)aDrm( p;o4oltnioetydlaDuanms t0 renxr3tadlpDeaivi;t0 eur(o3ny4lp  mnvtasf Drr(mpnu4alxn ictas s2rmumsnu0tlenmf3iytfaD  ueolt0truoxo3ou1amtnlfvsls s2ua( ont1apenif3iasfm ea(ms (0areoxo tytop rlnei t0 rxm(o3ou4omen fvsltfaDurumoou4alxomf3iltlmDranms;u0 rxoir tydfmt  ivilt0 rxrirpiu4ope  ivt s s2uaum ou4tltnio3iyt sDuanmpnu) exrxfctodfaD aneo t)trxrir3oy1lmtn iesatf Dtr(m no0oetnmf3tldfa ulnmp;t)tleriocty1fptr i slt0 exrxo oo4lm emnei s  rua(mooo4tptn f3iltls ul(mp;t4alxomocoo1omDr n il(0sexo(rpou4ole  fvsat)s2rrx  ;o0tetoii3iadlaDum(vont4tleoxo iotfmDeanvi;t seurio oudlpenmivsa( aDumum nu1aetnmo3ildlmDeanmo;u) etrmo3tytla eai o;()t2uoiopoy4lleemneiat)a2uax ono4aleomf3tlsfm elu o u0teeoxf3oa1lm eaneo t0srto(r3ou1open nesat)aDrax  ;t4tpx  i3tldls eau s;t) leomociatlptraueil(0 rtrim io1llen ivsat) 2ta(ro;t1alto o3iys s rlums u4 ltnir io1faDeaies;(  rxm(r3iy4ll n nci s aruru pno4tlxn o3iltlm ua(vont4 eeoxf iydlpDrli o;t0 etmir nudom  lfesa( aDuax pnu0olenii3tltfs2ua( snt0tlxoxfciytlm   uvs;t) rto(r io1lp e ncs ()aDumumo;t4alt iieiyt m el(mp;u) rtoircoo1fpDranvo;s) etmxmpiu1lmtelfet sfa2umxr oo4tlenmi3ils s eln s;t4tetoir ta1lp  aues t0 exrxr3iodlle  ici ()srrr( poo0tetnifciytls emu pn(4altoxocio1oatelues;s0teumio3nu1altnmnei t aruaum ou4alxniociydlmDra(monu4tlerxfcoytfmtelnvsl()srtoio3nodom n ict sf rtmxmpnu0teen oeiadlsDea( p;u) lxnxf3totlat lieils) 2umxr3iy1lpt  neiltfs2um(ro;u0altoio3tls m2uauvsnt)aexnmrcoy1oatrluvils0 rxoxrpio4lltnmfeias  2ur(rooo0oeenmoetlsls rmnvs t) ltrxf3to1omte nesls0tetm(r3nudlme lnvtlt arrrum oo1teeo ociyd sDra( pnu4arxnir iytlptraueolt)s2urxo3nu1alte iet sfsDurumpno4oltomicildlm ranmo u)aeeoxocoodfa   ivi s) eur(r oudol  lfesat) Dtax p;t1opx ifciaslaDuau s;t)trxnio3iotom rli s (0s2xoio ou4lleelieil(  2urxmo;t1apeo fciys s emumpn() ltrxocty1lmt an s;s)s2ur(r3io1ll elietl(f rumxmp;t0opt ifetat m2uanmp;u0tltnif oodoptr ues ( seuriopnydapt lnetat  rrr(r nu1olx  fciaslsDrmuvpn(0 eenxf3tydopDrli i s0tetm(mpiu1opt lfvil( aDtmumo;o1aetnif3iadlaDuln snt)aeeomfctadfpteaneo s texrir3oy1llt mnvia(  2trx  oo0olx if3ilt aDrmuvo u4alerio3iydfm e ies s seuoir no4lleelnetls s2ta( poo1tle moetys s2rlu on(0texrxf oo1oa eanvs;()t2toio3iydamt  icias) 2urumo;u0apeoiictld aDrm( sn(0alenmr oodfm raneolt) rtmimpiydal emncia(  Dum( onu0tleo oeiasls2um(vs;u0trtrif oadop  ai i;s)trtrxr iydlm nlfvs ()sDrru  nu1altoiietldfmDeanmo (0aeeriocootoateli o (  rxr(o ny1ll n nvt tfarurx  ;t0tpe  fctyslm ean s;()aexrmo iodlmDr u slt)srtm(m3oy4optelnvtltfaDua(r ou4oeeniociadla2ulnmp;(4 lenif3todopDrlues s texo(m3nydam nlivsas s2uauro;t1opxnmictaslaDumn sn(0 exrmr iytlmt lu ol(0setrio3iy1open nct t)a2ta(m ;t4oltnif3ilt m2ul(mp;t0arenxrcoy1lpDrau s s  2xmio iu4omtnlfeia( artmxm nu1oex iictlsla eaump u4altomo3tadoptrliei t seumxopoo4ll   ictas  rtaurpoo0opxnmi3tls sDuanvon(4aleoir3totop e i o;t0seuoxopiydamtnlict (fartm(mpnt4aetomoeiysls2eln p;u4 rtnmr3tatomDeai sls)trurxrpny4aptn ivi ()arrmx  oo0aexo ieiyt s2eln pnt)tetnxo3iytlmte i o ( setmxmpio1apenlnet (f 2rmxrp;u0alxomietadfa emumont0altomr3tydfp  lu sls) rto(o3iy1aptemicsa(f rraur ;u0oleomi3tatfm2ulnvp;(0alxrifcoatoatrlnvs;s s2tm(opoo1op nlfvs ( arraxrp;t4oexnii3ildla2rm(msnu4arenifcootlpDrlueo;(  etrxm3oy1al n net () rumxr ;o0olenmoetltfm ra(mo;u0tetoxociadomte u olt sexmio iy1lptnmicsls)sDuaum ot0olxniieiytfm rl(vs;(0 eenxr tytoa rai o;t0srtrio oy1alee ivsa(  2tmxro;t4aexn oetatfm uaump (0tlerif iytoaD  i s;t  2xrxo3nydoleemnvtlsfaDra(  oo4opt iieilsfa2um( snt4trtnmocoadfmDr uei;s  2toim3iudap  lietat) rrax oou0oltnmietyd s eauvpnu0aetoxf3tadfpteaieo (0 eumxo3oo1optemies t) 2umxm nu4opeoifciasfmDea( s;u0 etnmr iy1latrai i t srumxrpiu4ope mfetas arrm(r ;t4ale mi3iatfa rln p;u0 lenmociydlmDr i i;t)tetmimpiy4ap n nesat) Draumpot4tltnmoctlsfa em(vonu0 lxnxo todfmDraues;()t2urxm3ny1amtnlicslsf rrauroot0ope ioeiad aDeau on(0 rtomfciy1fp r u i t trtmim oydlle lneslt)a2urxrooo4tee  o3iyslmDrm(mo u4arxoxo3to1fa elu slt)seuoxm ny1oltelneia(  ruaum nt4tex iociydlmDem(mon()texoio todfat  nvo (  2um(r oodlp   nct t arurx p;u0tptnmi3iat m2rmnvsnt0trerircoy1oaD  nvi ()tetrxmpiy1olee feil() Draum no4texoif3iad m ranvp t4 rxnio3to1fm rli o;t srxr(m ou4ameemivt ()sruaurpno4tpt ifetad s rmuvs ()arxrifciatfat anvol(0t2xmio3iodapenlietls)srrrxr ot0teto iciys sDuan o;u4 rxnir iodfm   ueslt)teuoim iodomee ivs ()aruru  ;u1tetniiciadfm rlu o u)trtoir iodlp  aueo;(0 eur(m3iu4llt mfeil(f Drmur no0aexnmi3ilt mDeauvo ()tltoxr oatfmtr ueolt) ruoxopio4altemfvi (f 2raumoou0alenmoetydlsDuau p u)trtrif3ia1fmD anvo;s)trumxm3no4omen fcia()sDtmu poo1tpt iieild aDumu o;u)trxrxo3iy1lptean i (0 exr(mpnu1omt  nvi t s2rr(mont1openmi3tysfsDua(vsnt)arxomo iydop rau sl()s2xr(m io1amenmivi t)srtr(r ;u1oeen f3iltfmDumuvp (0arerxo oytomtr nvi;t srtoim nudllenlfvsas)aruax oou0apxomo3iadlm2ua(mon() lxoif3oy1op eanei () 2urxm oy4am e nvta( aDtr(  ou1tex  fetyd m el(vp ()aetnxo iatfmteai i s0 exo(mpiy4op e ieia(  2tmum oo4teeo icild m uluvs u0arxrmr oa1oa e uvo t)trxm(o oo1aleelnvsas) rrax onu0aeeoio3tldlaDul(vo;t4alerirctydop  auvslt)texoxrpou4ap nlnei (fs2ua( p;o0optoio3tysls2em( ont4arenmoctytlatrauei;s)trtmir oy4amtn ictls  2uau ono1olxo ietadlmDra(mp;t) lerircio1oaDe nvo s) rxoim3nydoptelfcsat  ruaump;t1oetomoctadla2uauvs (4tetoiocoodfmtelnvols)t2toir3nu4amee ivsls)arua(rooo0apenifetysla2rlnvo u0trenxf3oatfpt auvi (0truoxmpou4amee fei (  2tr(rooo4alx  iciatfs eln sn(0 etomoctatfaDelnvsls) rtr(opio1lltnmnei ()srtmum nu1oexomf3tas sDeau sn() rxomo iytoaDeln s;() etm(rpoy4amen fct () Dtmxro;u0texo ociatlm ea(vp (0arxnir3oy1fmt li sls t2trir3oo1lmenlfcs ( arrrumoot0tpxo ictyd mDeluvs (0aeeoio oodlmD  ues s0srtm(r3nudolt lfei t sDrr( o;u1aptnii3tad aDrlu p;(4 ltnmf3ia1fptelnvo (0 2uoio oy1om  mivsl(f rrmxm nt4aex  f3ilt m2uauvpn() lxoxo3oatlm eluvs;(0tetmio no4apee nvsa(fartru oou4opxnmociyd sDrl( o;(4alxoxr3oatla r ueols0 2tmir3iu4llt lfvias sDumxm no0aet mo3ilt a2rmuvp;(4trxoxrctotfa rln s t)trum(m ny4apenmivil(  rtr( onu4oeeo fciyslmDulnvpnu) eeomfciatoatr ivil(0teumir nydamt mnvi s  Duaxrooo1tpxomocilsfs2elnmpnt0teeomfcoytlat ai ol()t2tr(o3oo1apee fcsl(fartruro;u0texn o3tat a umuvpn(4tltomr ia1fmDe nvs (  eur(mpiydom  mneta() rrrx pot0olen ietadla2eanvs;t)artoir tydoptrau i;(0teuo(mpiudop  lneta(fs2tru p;u1aexomocilsfm rmn pnt0alxrmo totlp r ivi;(0s2xoim oodole mfvt sfaDrax  no4tpe  fetyt mDul(mo;t0trtrir3iotfpt anei;s)trtrir3iu1amenmnvil()a2tr( ono4texn f3iytfs2ran s;t4trtoxr to1opteaieol(0texmxm3iy1lltnlnct ()s2urx ooo4oetomietysfm2ea( o (4 ltrir3oadopt aieo;t)t2xrxmpnu4ap  lnvi t s2tr( pnt4opeo f3ilsfmDuanmont0aetoxrctatlmt  neilt  rurir3oodomtnmfvs ()sDurumo;t0aeto fctld a2elu s;u) eenxocoatfmt an sls0t2tmxm oy1olt  nviltfa2umx pou4tlxomfeias s2rmump;t0aexoxr todoate i s;t s2umxo3no1lmeelieiltf rra(root4apto ieiad sDra( p t) rxnxocoy1lm eaues s0t2uo(r3no4aleemiei t)arra(rpnt4oee ii3ilsfa2el( pn(0 lxomo3iytopDeaieo (0 2xoxo nydameemnet t sDrmx o;o4apxnioeildfm2ua(ms t0texnio3iodla elu i;t0s2trio no1lltelnvslt)artru  nt1opxn oeiltfa2raumsn(4treomo tadfa rln i;t sexr(mpio4ole  neta()a2uauroot4oexoif3ildfa rluvp;u0aetomfcoodfa rln s (  2xoxopiu4opt lncilt a2um(moot1opt  ociytfs2umuvp u4 lxnmo3iydfate nvi (  rurir ny1lp  mnctl( a2umum ot4apenmociaslaDua( o (4aeermf3oytop  aivsl()t2uoir3ny4aptnmiet sfsruau onu1tpe mf3ilslm eanms ()trxoir3iydfmtr ivs;t)trurio oo1ol   icta(fs2rr(r ot4texnmocias s umuvs u0 etniocta1fptrlieo;()tetrim3no1al n fet (  2rmxrpno4teeoif3ilsfm um(ms u4trermf todlp e nvo;t) rtm(o3ou4aptnliet s)srraurp;u1alxoioeiadla2ulnvont4altomf tytomDrluvo (0s2toiopoodaltemicslsfaruru  nt0tltn i3tas mDuauvs ()altrio oodfat livo s srxm(o3no4ol elncilsfartr(mp;u4oetnio3tldlsDeauvp (0texnif oy1faD ln ol() 2to(opoo1op n icta(  2tmur nu1oleo f3tldls2el(vp t0aeenif3oadfptr ueil()s2uo(o3oudal  mncil()arrru pou1tlx  f3ildfsDeaumo (0tetnifciydom  livo (  2trxmpoodllt lnctat a2tmxrp;o0open o3iatlm eauvonu0teerio oatoaDranvi;s)srtmxmpoo1lp  mnvtasfsrumu pot1tee iociltfa rlnmo t4tlxnxfctytopt an i;s0 exriopnu1apee fvs s)srtmumo;o1oex ifeias m umnvsnu4trtoxo ta1fmtrauvs;t0sexoxr oo4op  licils) rtrurpou1tptoifctys m2rluvs t4alenxf3ty1faDe n o (0t2toxmpno4ol emnvsasfsrtrurpno1oetoifctatfsDumuvs u)tltoiociydomDranvi s s2tmiopiu4ameelivtasfs2tmxm oo4apt micils mDra( on(0 rtnxociy1fp e n ilt)teur(r3nudamt lfvtasfsDumu oou4aexn feild s2ulnmont0 rtomrciytfatranvsls0t2urio3nydopt licsls aDur(m no4tetnmociydfsDeanvsnu) ltriociodfa e nvol() etmxm3no4ol n fcil(fsrrm(r ou0texnmfctydlm rm(mo u4artnifcoa1fmt  ueils sexm(r3nudlm nlicsl()aDum(mpno4opeo oeiysfsDea(vo;t) rtrmociytfm r nvo (0s2urio3ou1apeelncs t)aDur(rp;u1tlxomi3tatlm2ua(vp u0 lxrir todfmD auvo t srumim oodlm  lfciltfsDum(r ou4apeo fciydfm ua(vs;u4texnxr ootfpDrauvo s teum(m io4lp   fctlsfaDra(r ou1tpeoiocilslm ulnmo;u4 lxomo3totop rln o;t)trtm(rpou4om nmfesl()arrrx ono4olx moeiasla rm(msn()artrio tydlp  au olt  rumxo3iodameemnvtatf Dumxmo;u4tpt mi3tyt mDulnvo t) etnifctotfpDr u i;s)t2xoxmpno1omt  ics ()sDum(mont0tee mieildfm emnms;t4teeomo iy1lateau i;()s2tr(o3iudlpenmfcil(  2trxmp;u4aexo oeildlaDrauvp;t4 ltnxr3iodlpD lnei t0srxoxo3iydalt mfvsa(  rtru p;t1tpxn f3ildlsDum( o;t)aexrif tytfptelues;t0 rur(opoo1altnlfesatfaDtrurono0tltnio3ilt s2rauvo t)altoio oadlmtrai olt)truo(o nu1ope lici tfaruaxrpoo0apxnif3iasls ra( onu0tlxomo3to1omtrluvsls) exoiopoydoptemfciat)sDtau  oo1olxomfctadla2em( p;u0aleomocio1om r u i s  euoir3oydopenlfcta(f rtmumono0oeeoif3ils a umums u) renmf3oatlmt  nvslt  2to(m ou4lp emnvt t)srrr(  ;o0opxnifeiat s2elnvp (0 exrif iodoptrli o;()texoxr no4apt mfet s artmx  ou0teeo fctadfaDua(mo;(4aexrif iytlp rlneil(  rxoio3iudlpeemictl(fsDta(r ou0aet mociytfaDuau onu4trerxr tatlm elivslt  etrimpiu1op e fes tfa2urxmo;t1tltnmocildfm ea( o t0 renmf3tadla   nvo t) 2xr(m no4lle mnctasfs2tr(  nt4oex mieiad s2ea( p;u) ltnxocoo1om ranvi t)srxmxo no1ap nmnesa(fsrtm(mpnu4ale mi3iltfa ra( p;t4 renio3totfa e u s (0 rxr(o no1optnmnctat)sDtrxrooo4opxoifeiat sDua(vpnu0aetrmrcio1oatr ieo;( t2uo(opoudal   fci sfsDtax pnt1apxo o3tldla2rln o;u4tltoxo3oadomt  u s t  eto(m nudlmeelnvia()sDum(moot1apto i3tlt aDrmn o t)alxomo oadopteaueil()srxoiopnu1ol  mnvsat)sDurxmpot1tpto oeiydfsDrmums t4texrmo oydlmDe n s (  etrir iy4lp nlict tf Drm(mo;t4apx mo3iysfs um( p u0 etrmocootfaDeauvslt)srxmxm oy1amenmfctl(f Drm(rp;o4opeomiciatfaDrl(mp u4arxnmo3oodoatranvs (  rurir iudom  miet ( a2umx onu1oee  iciadls2em(vsnu4 eerir oydlp rliei t0srxrirpny1omt lfet ( sDtrx pot1tpe io3ild s rmnmsn(4alermoctytlmtr nvi;s0trxr(rpiydam  mfcilt) Dtruronu4alx moeiaslsDum( onu4aeeomo tytlmDeauesls0t2uoxmpio1ll  mfctat) Dtr(mpoo0oee  feiysfm eln on(4tlxoiociodfatr i i;( srxoxo3no4aleelfciat) rrrxr ot1teeo feiaslm2ul(vpn()arerxo3totfpt livols sexm(m3iodapeelnesasf Dumx p;t0aetnmieiydls2elnvon()altnmf3tytlateanes;t0texr(o io1olee fcsat  rrr(rono4aetn iciydfs2ulnvp;t) lermfcoa1oaD auvo s0t2urxrpnydlltemivsa(  rrr(  ou0altoif3tytla rlu s u0tlxoif iy1laD lneilt seuoxo nodlmtnlfvsa( sDtaurp;t4apxn fciys m2rl(mp;()tltrmrciy1fm eli ol() rxrim no1lmee net ( sDrrumo;t1tpt mietyt a2umumsn(4 exnir oadfpteauvsls  rurxo3oy4lp n fcilt)a2rr(  no0opx ifeiadla2ra(mp;t4alxrifciytoaD  ieo;s trurimpny4opeemiciat) Dtmxm ;u1alenii3tadlmDem(mp u4tlxrir3tadoate ivilt teurxo3iu4lpe lfvia() Dum(r ;t4alxnmiciasfsDemumont) ltnircoadfm r nvs s0 exrxm3ny4ll   ieta()s2raxmooo0aexo oeiad m em( s;t0altrxo tadoaD lu s ()t2uoio3io1oleelnci ()aDrruronu1tlx ioctat m2rlums t4tlxnir3oadoaD li s (0 exrio3nu1optnlfct t a2ta( poo4tex ifctlsfs2eluvs t)tlxnif3ta1fmD lneo;s0 2xoxo3iu4lpt lnvta(fs2tmumoot0apxoifetld sDumu o;t0 ltoxr tytfa raivi;s texmim no4opt  fcsls sDraumo;u4tlx moetyt a2ran o () rtrxf ty1fat luvols  etrio3iudam nlfcsa()srrrxr ;u1oetniietydfa2rln o;u0areomo3io1lm e n o;s0 exmxo ou1lmtnmnvtat)srur( oot1tlx  oetltfs em(mo () rerxo iodlmD lnvs t) 2xoxopou1lp nmfviasfs2uaxrp;o1tlxo ieiydfsDul( o;t4tetnmoctytfmte nvsl()setm(o3ny4ll n iesas s2rrurpnt4tee  ociyd m ea( s;u)aleomr3tydfatranvo t)trtmxo3ou1lmenmfes (fsrrmumoot4aleomi3ild s eauvo ()treomocto1opD ai s t) ruoxm nu4opt lfci () Duax pnt4oeeoioeiytla2elnvs (4aetrir3ta1lm   uei t0 etm(o3nydll eliesas  rurxmp;u1oleo fciadla rauvo;t0arxrmrctodla   ueo t t2xr(r ou1oltnlfvsat  rraxr nu4oeenmietasla umu ont) rxrxf3tydfat aivo;s0t2trxo ny1ope  fesas)aDumu p;u0oleoioctadla2uanvon(4 lxrifcio1fatrlu ils0trtoimpny4olen fcia( aDrmumono0aetoii3tls aDum(vp u0texnxrcto1fmD lneo ( truoio oodomeelfetatfsDtrxm no0tle  octydlaDrlu p;u0aexnif3oytfmtelu o t  rto(r3oydap emnci t)aDuaxmoou1aee moetls sDuanvs u)trtnmo3io1opte n sl(0seurxmpiy4amtelnvsa( arrr( poo4oeenifctlt sDemu o;(4arxoif3iotomDe nvs (0trtmxm3iudoptnmfeia(  rrmum ot0apt mfeild s2ean s;(4arerxrcoatfatr ivs;s)trumim iu4am elfcs s) 2ta( pou1alxoifeiaslm elnmonu4alenxr ty1fatr n i;(0 rxrxrpiu4lm   ietl() Duaxr nu4aexniictadlaDrluvo;t4tlerxf oatfm  lies;(0trxm(opoo4olen ieiltfaDrrxro;u0ole  octasfaDua(vp;(4 renif io1fp  lnvslt0 rumir ou4om nlicsa(f rrrx o;u4tltn icilsfa ul(vonu)tlxoirciodopD lu o;s) 2xo(mpnu4al  mnci t)a2ta(m nu4apx  feiadfm rl(ms;(4 rtnxr3ta1oaD lueils srtm(m nodlpenmnet ( aDrmx p;o1oex  f3iat a2ranms;t0tltoxf oytfpDraivs t tetm(r oodameelfvil() 2uau p;t1alt mfctyt m emu o;t4alxoircty1omtrauvi;( teumim io1alt mfvi tfsrtm(rpot1alto i3ildlm umn p u)texomfcoydlmDranvolt)s2ur(r oudomt mfvsl()s2umxmpot4ope iictydlmDrlumpn(0arxomo3iotlmt li ilt sexmxo oydopen ieia()srumurp;t0olxnmf3tldfmDuluvs;u4teenmf ty1oateanei s)sexm(m3oodlp  mnvs s a2umxr ;t0oexo fetldfmDum( onu4alxrmfcoa1fmt ai ols0 rtmio nydaptn ictl()srrr(rpno0apeniictas sDul( p u0artoir tytfat  ivi;(0 2umxr oo1lp nlicil() Drr(  ot0tpeomictatla ulnvon(4aexnif oytlptr ies ( t2umio3iy4olee icsat) 2rax pno1olxoif3iydlsDran p;t)aexnxo tytlp ean il( srxo(m iudomtelfvtas aDtmu oot1tet mictasla2el(vo t0tleriociatfa  ai ols) 2xr(rpiydomtn fetasfsrrmxroot4aexnif3tadfmDel(ms;(0tetrmr io1fpteanvsl()truo(mpoo1op elnvil(fs2tm(mooo1tlx iieiytfa emn p;()tleriociatfpt lu o;( seumxm3no1lltn ivilt)srra(ront0aexn f3iadfm2ul(msnt0treomrcoy1laDraues;t sexrir ou4ape  nvt s) Duaxm nt4aetnmoetadls2rauvs t0aetnircoydlmDeanvo s0srto(o3iy1llt mfvil() Dtmu  ot0oeenioeildls rm(mo () lerirciy1lpt lnvslt)seumimpny1alt mnei (fartaumpoo1olen o3iltlm2el(msnu)tltoxf3oy1lmDe uvolt)s2uoxmpiy4om nlfvs s) rrax onu1ope mo3iltfmDrlnvo;u)tlxoxf3tatlm elivsls0teur(o3iodlp nlfeta() rurur no0apxnmocilsfm2uanvpn(4trermfciydlaDrlu olt)s2tr(o oudllt lfeia( srurumo;t0tpe  f3tlsla2emuvonu0tetriocoa1lm  au o ( trxmiopoy4olee ictl( arrrxr ot4tpt ii3ilsls2ra( s;t) rtnmrctotfm elneo;s0sexm(opiy1am  lietlt a2uaxrpou1aptoioeiydfsDem( p (4treoio iytlpteauvi s0trtr(m iudol n fvi t s2rrum ou4aleomfetaslmDua(mp;u0trxnxf iydla e ieslt  2xoio io1am e feil( srta(  ;t1opxnioeiyt aDrlnvpn(4alxoif tadlmtraies t0 rxoir io4lp nlnct s sDumxmont0oleniocilsfs2uln s ()teeoif3iytlm  au s;(0t2trimpou1lmtn ictltfs2umxr ot1aexnifctatlmDrln onu0aexnxf3to1fm e i olt seuoxr no1omt mfcs t) ruaxm nu4tetn fctldfs um( s (4aetoxrcoy1faD  ieol( trxrio nudomt mfvsasf rum(r ;o0tltn oeiadfaDrlnvpnt)trxomfcoy1lp r ies (0t2tmirpoydlle lfvs s)arta(mpnt4tlxomfcilsls uau o ()texrmo oo1la r ivi (  2xo(r3iy1op nmfesl( aDta(rp;o0opx  fctad mDeln s (0trxrmfcoytopDeai ols0 rxo(m3nudap   nvtat)sDrmur ot0apt mf3taslsDuln snt0areoxrcoydomDr ieil( t2uo(rpoodalenmnvtlt sDrmxrpnu1teenioetys a2umuvo (0aexrir oatoatraneols) eurxopou4omt miet ( a2tau oou4altomf3ilslmDeanmpnt) leoxr3ta1lpteluvils  rtmxopno1olt  nci tfsDraxm nt0oetnmi3tltfs rluvs;()trxrmfctadop  ln i;s srxm(r iydalt  ivsltf 2ra(r ;t0oetoio3iatfs2ea(vo;(4 lxrif3tytfatr uvils truoimpiu1amtemfvtat  Duaxm ;u0ope  o3ild s ulnmo t)tlermo3oy1fptelivil()t2trim3nydlpe  nvslt) 2um(rpot1oltniieiaslmDel(vp;u0altnifcoodoa eluvi t0trxmir oudomeelneilsfsrumxrpot0tpxnifeiltfsDem( o;u4texoxo3io1faDeauvi t  euoxopnydll n nesas) 2tr( pnu4ole iiciaslaDra( sn(4tlxoirctadomt  ivs;t  2xoir3nodolenmfvtlt)sDumxr ot1olx  ociasfa2ea( o;t4 rxrxrcta1lpte ues s) etm(m3oy4lmeemiet (fsDur(mont0tee  octltlaDumn s (0teerifcoa1lm e ies;()texoim oy4lmtnmivsl(f 2uaxmp;t4teeomieias a2ra( p;t4 rxomr3oatopDr nvs t) rumxmpoodole  fci tf Dumx p;t0tpxnmieils m2em(vp;(4tltnxfcoy1fp eauvs;s0s2umirpiy4lpe mneias)sDurxmp;o0olx  i3iydfa em(vs;u)alxnmf iatfa eli ilt)seumxopoy4lp nlfci sfa2trxr nu0oexn oeiyt mDranms u) ltoircootlmt aueilt)s2xo(m nydol n ivt t  Duax pot4ape ii3tlsls2eaumon(0trtrio ta1lmDeanvi;t trurxr oo4lp nmfcs t s2tmxmono4aptoifetas a2emuvo t) rermrcto1fa r neo s0 rxr(rpoydlp emiesl(fs2raxr ;o1aeto i3ilsfmDuanmo u4 lxnir3oatla   uesl( sexo(r3oudlpe mnes s)s2rm(  ;o0tlt mociat aDra(mo u)arerio to1op eluvsls0trto(mpoy1altelnvsa( arrrxro;t4aex micildfmDeau pn(0tlerxo3tatfp   uvo s0 2ur(opiudlpte neslsfarumurp;u4aet ii3iaslm2ul(vp;(4aexnifctydlat lnvo (  exm(o3ny4ale mfvs t  Dtaxrpnt1apeoiieildlm2em( pnt) leoxo3oy1lpD  ivo;s seuo(opoo1olt lfvi tfarra(r oo1ope if3iytfa2raump;t)tetomf oatfp  lueilt) 2xm(r oo1opee nvsltfsrrmurp;o1olx ifctlsfa um( o ()tetrir3totfp rai o;t) exoim nodam   ivs (fa2tmump;o0tetoifctldfm emnmp;()tltoxf ia1laD  ueslt t2uoirpnu1altelnei s)s2uaumont1tlx iocilslaDrl(mp t0alerxf3oodom elnvo t  rxoimpno1al  lietltf rumxmp;o4ape  o3tys a ra( o;(0altoio3tatfpD ln olt0 etriopiy1olt  nvi s  rtrurono0texniictld aDea( p (4teeoxr oadoa   nvs t sruoxopnu1apeemict tfs2uaxmp;u4olenmo3iasls rl( p;t4arerxo3iytlmDelneo s0 etoxr3nodaptnlneia()s2rmu  no4olxn fctld s2rauvp t0tlxrxocty1lptean s;t)trxrim3io4ope lictls)a2trx  ;o0oee ii3iasfaDemump;u0aetriociatlpD au ol( texoxmpiodap   iesl( srurx  no4aptoii3iltlsDea( pnu0alerxf3oy1latrlivs ( t2xo(r3iudomee netat)a2rm(r ;o4alx mo3iaslm2rau pnu0alxoxo iotlpDe n s;t)srurirpnodoptelivs () 2tmxmo;o4olx ii3ils s ulnvs (0trerxf oatlpD  u s;()t2xrir3iydom  mfvs ( sDrmx pot4teen i3iytlaDua(ms;(0 rxrif3oytlmDrluvo;() 2tr(r3nu4lltnmietasf rtm(r ;t0ope mf3ild a2uaumpnt0aetrmr ootom rau ils0sexoxmpno1ap  mneias s2trxm ot4tlt ioetldla rmnvonu4tetrxr oy1faD livol(0seurim3iy1aleemfvilt) rrmxmonu4alen ociysfsDumnmp t4teenir oytopD aivil(0trxo(o iu4om n ivsatf rtmxroou0aeenmoctldls2ranms;u0texrif3iydfmD livolt  etmir iodomee ietls srtr(r ;o1tpt iietlsfsDul(vp t) lxnxo3totlpD  uvs;s  rto(m oodapenlfvsat  rtmu o;t4aetn icilsla uln p;t4 rxnmf3totfatrlivilt)srtm(r3ny1alenmivta(f 2rrxroou4tle mf3iysls2rluvo;t0 ltrio3iytla  ai sl(  rxmxo3ou1aptnmfes tf rra(mo;o4olt  oetas sDra(mp () lermfctydoaDeln i;s)tetmxrpny1op  mivi tfsrtmxmp;t0tpt ioetytfsDea(msn() rtomrcoy1omt  ueo;( setrxopiy4ame livias)aruaump;u1tltnif3iyslm ea(vp;t0arxnxf3oatlpDeanvo s0trxm(r3ny4om elnvia(fsrtrxr ot1alxnmiciaslmDulu s;t4 rtnxo to1oaDrln i;t0seumimpno4lmtelfvil( s2ur( pou0olx mo3tlt s2rl(mp t)artrxociadomt  uei t trurir iydam emfei s  rum(m ;t0olt ioeiydlm rlnms t0 lxoio3oa1fatrauvo;( srurir no1op emfcilt) Drmumoou0opxo i3iydfsDra(vonu0alxnxoctotfa   nes;() exmim3iydlmt mfcsat)s2tr(  ou1olt  ieiat sDuauvs t0alxnxf3iadfa r nei t0s2umir3oy4llt  neiat)aDrmxr ou0tetnmi3iltla2rlnvpnu4 ltoxfctodfa rlueo s)s2umio3no4amen fvias)aDraurp;t1oeeomieiyt m2rm( o t0tetnxrcio1fmtean ilt0trxmimpno1lpt mfvt sfaDur( ono0oltoioetatla ua(msn()treoio3oodopt ln s t teurimpnu4ope mncils) rum( ont0olx moetldfsDrl(ms;t4trtnmf3tydlm  li s;s)sexmimpoo1om   nvt ( sDtmuro;t1tpto oeiytlm uanms;t)trxnmoctatop r nvi (0seuo(o nydoleemfvt t)srtmxmoot4opt mo3iasfs2rm(msnu4trxnxrciy1lpteanvol()sexrxm ny4ole lfvs (fa2tmu pno0tpx  o3tldfa2umn s;u0aexnmfcoy1fateaivs;t t2toirpoy4ap e nvt s aDum(r ;o0aeen i3tas a emuvo;t)tetoir oytfpDr i olt0seto(m io1op  livi t) Dumx  ;o4aptnmoeiadfmDuanmo;u)tlxnmr3iadopt  u s t0t2to(m no1lmtelncil(  2ra(  ;u1aeeomietydfa uluvs;()artrmr iotoptr nvo;t0srtmim3oy1lme mivs sf Dtax  ot0tee iociat a2emnms u) rtnmf3iodomDrlueo;(  euoio iudol  mnvta(fa2ua( o;t4opxn f3tldfs em(vpn() exnmrciadlpDrai olt truoio3iy4ame lfcilsfsruaxmo;o4tetnmo3ilslaDrlnvo ()teenmo3ootlmDranes;s0seurim3ny1ol  micsatfaDtm(moot0apeniicildla2ul(mp;() etnir totop eaieil(0 rxo(r3io1amenlfcsl( a2urum oo0aet  fcild m eln onu4 etrmo oodfp ran i t)trtm(m3nudlle mfci t aDumum no1alxn fctadfm umn onu) ltomo3iatfm   uei;s0 exm(m ou4lm emietlsfa2rm( pnt0opt mo3iyt aDeln sn() rxnxf iadlaD lnvilt)trxo(mpoy1ol elnci s sDuau pot1aptn o3ilt m eanvpnu4tlxrir ty1oatrlivi;s0trxm(o ou1opte feilsfartmxmoou1ale  o3iysla ulnmpnt4arxoir3ty1fatrai ils) ruo(m oo1am   ieia()aDua(mp;u1oet mf3iyt m uln snt0teerif to1omDr n olt)sexm(m oodomtn icsa() 2umumoou0aeenifcild s2rluvs u0tlxoxf3iydomDelu i;( teur(opno1ape mfctlt sDra( ono4tlen octltla eanvs u4areoxo3oadfmDe ivolt0tetrio iu4amte feia() Dta( o;u1tpeo iciat m2ranmo ()aexoir3tytfm eln o ()t2toimpou4openmncs ()a2tr(moou4opeoiiciys a rlnvs;u0areoxf ia1fmt lnvslt  2uo(o3iu4lltn fctlt arumuro;u0alxnmf3iltlsDrm( sn() eeoifciadfa eln s s) eurirpny4olte ieilt)aDtrx  nu4aet mfeild s eanvpnu4aeerir to1lm eaiesl(0setr(m iy1oleemfetlt)sDtaumpnt0tleoioeilsfa2em(vont) rxnxf3todlmDe nei;t t2uo(o3nodol  miesas s2rax p;t1openio3iltls2ul( s;u4 eenxrciatfpt  ivo t) 2um(m iudlp nlnvsls)a2rrurpnu0aet mfcias sDeauvs;u0tetnir oydfaDranes t trtoxr nu4lmt  nvsls) rrmxmp;u0aptnmfeilt mDel(mp u)trenxfcoatomtrau o;t0srtrir3nu4llenliviasfs2taxm ou4tetnmfeiatlm rmn o u) ltnxf io1lp   i o;(0 ruoxo3oydamenlivs t aDtmxrpno0texn i3iasls eau s;() lxrmo3iytlm   uesls seumxm ny4lpt  ivias s2rru p;t4oetomfciasla uan o;()aetnxocoytfaDranesls seuoio oo4llen ivtltf Drmu o;t4oeeomi3ilsla2emuvp u)tetnmr iotoatranvo t  2xmio io1am nlnei sfsDumx oot0olenio3iydfs2emu o;(4aetoir oatfpDelnvi t)truo(mpnudomtemivt s s2rr( oou1tpxomi3ildlsDelu o;t4aetrxo tydlm e neils  2xmxm ny4om nlivsl(fa2urump;o0optnio3tyslmDulu ont4teenxf ta1lptrln s;t  exr(m3iy1ap nmfviltf 2raur ;o4texn ictadfs2eau s;(4 eeomfcia1oa eaues t)t2xrim3iu4aptnlicsat)sDurxrpnt4opxnmf3iat m eauvp;u0 lenif3oatlmD aueo;(0 2tr(o iu1om  mnci t sruaxmoot0tet  iciyd mDrlnvp;t)trtrxrcoydlatelu o s)s2xmxo iu4am nlfci sfsDtr( p;t4tle moctysfs2rmn p t)arxoir ia1fmte uvs;s) eumxrpiodlmtn fvta( aDtaum ;o0olxoiictysfm el(mo (0tetnmo iy1lmteauvol()t2trirpnydap n ieiatfa2umurooo1tpxnii3iydls rmumo;(4 ltnxf iytfa   u o t)texoxo3nu1oltelfctasfa2rrxr ou0opt ifctlslsDrmumpnu)tlenxfcio1fpt  i i;(0trxmirpiodope lfcsl() rur(mo;o0opx mieiat s eanvs;t0aetnxrcia1omt  uvi;t)t2trxr3nudlmt lnciltfaDuaxr ;u4aetnmociyd s el( p;u4 etnir tadfa e n s t t2xr(o oo1openlivt sf 2ta(monu1aptn icild s rmumon(0texrio3tadlptr nei s0srxrirpoodlpt livt s aDraum oo4alenmietytfm2ranmo t4trxomf3oa1omte u o;s0 exoxm nydlpte feia(fsDtau  no1aetnmiciltfa2emuvsn()alxomo iy1omte uei t0texmim oy4ale  fvilt)aDtmxrpot4alt  i3ias aDumnmo (0 etrir3tydom raieils  eurimpiudlpeelfci s)s2tmum no1opxnii3iadfa eanmo;u4 lxrio totfate ieo;t0 2umir3iudlle  fvtlsf 2ur( o;o4texn i3tltfmDrau o u)tltomo3oa1fpte nes;t)srtoxm oo1lp e nesa( aDrm(ro;u4ale mfcils a2rluvp t)trtnir3to1la ranvils teuriopoy4apt mnci t srurxrpno4open oeilt mDel(mo t)artnir3tydoaDeaieilt s2umxr3oydapee icsas  ruax  oo1tptn oeiat a em(mp u) eeomocootfpDr nei s)t2to(mpio1op  miei (  2tmumpnu0optnioetadfa2emn p u) etnmociatopDr ueo (0trtr(mpiy1lmtemfci sf rur(mpot1olxoifciltfs eau snt0teeoif to1lmDelivs;( srxrimpnudomte nvtat) ruaurpnu0oexoioctyslaDum(mp (0teeoif3tatom e u i;s)trtrirpou1ameelfctas sDtr(r ot4oltniicilsfa rm(vs;t4alerifciydlmt  n ols0srxoiopiy4lp  lnvsat sDrauronu1aex  ieilt s2um(mp u)trxrmf3totopD  uvs;(0srxm(r iy4om emnvilt  2rmum nt4oee mieiasfa2rauvon(0arxoxocoydomtr u s ( s2umxrpny1olt mncsl(fsrrr(r ;u4aex mfeiydls emumonu0tlxnmf oytfptr ivils srtmxo no1apeemfetasfs2rrxrono4olenii3ild s2ea(mp;t0teenir3ta1fpteaivi s trxo(o ou4ap   fcs tfsDrmxmo;u1tlto oeiyt m eanmo (0trxrxf oy1latraieo t0texm(o3ou1lltnlivi t)a2rmx p;o0tee  feiatfm ulump t0tlxoxf tatomt  uvo;t) rxoio oo1om elneslsf Dtmu  nu4aex mf3iaslaDrluvsnu0trxrif3oo1fa  auei t) rurir oodlmeemnciat)s2uaumpnu1tpe mfciysfs eau s;t0trxomo3oa1fp eli ols)srtoxm oudalenmfci s aDtrxr nu4ale ioeiaslaDum( s u)aetomo ty1lpt an s;s0 exo(m oy4om nmivi t)aDtr(ro;u0ope ii3iytlaDrmumsnt0teermrcoo1lmDe uvol( trtoxrpiu4ol   ictltfsrtru  no4aex ioctatfs rm( onu) rtomo iodfaDelivs t) 2uoxm3ny1ap  mfviat) 2taur ;o1alxnmfetatfm ul( o;(0 lxnxrcoytlmtrlu i;()srxoir iu1ol  miciat  rurxmp;u1aexomfeiasfm2rlu o;t0aeenif3tydlaD  n ols t2uoim3no4ole lnci () rrrxrooo4opxnmo3tlt a el(vp;u0tltrio3oytoa eln s t)texrirpiy4lp nlnvs sfarur( pot0oet  ociltfs ean s;u4 eenmociytfa   i ils0trurxm iy4apt  ieia() 2trx o;t1alto ieiyslm eanvp u0 ltoxr iadfm  anei;(0 euoim3oodal  mfei ( s2um( o;u0tlt  i3tytlsDrl(mont) lenxrcia1om  livo;t s2ur(o iodape lnvslsfartm(r ;u4olt  f3tysla2ulums;u4 lxnmociy1opt  n i;( s2tr(mpoy4apeemfcta(fsDrr(m oo0tlx mf3tad mDea(vs;() rxnifciytlm rlnvs ( trur(rpnodaptn nct (f rtr(m oo0tpe  ieiad mDrl(ms;(0 lerxfcia1lp eaivo;t  2trxopnu4optnmieta()a2ururpou4texn ictasfa emnvo;t)aexrio3ia1faDeaivs s0 2to(m3nydamtemnetl(f Dum( oou1ape ifciytla2rauvpnu0texriocootoaDelieo (0 eumim iudamtelfeilsfaDumumooo4oltnmoeiydla ul(vo;t)aeeoio oo1op eliei s0 2umxo iu1olte ivsat) rtmx o;u4tptoifciyd s2ulnmo;u4aetomr oatlaDr n o;() rxo(m3oo4lmt lieilsf Durxr ;t0tetnifetytlsDea(mo;()aeeoio3oadfmDrauei s0t2xr(o3oodopeemnvs s  rtaxrono0tlxnmictydfm2elnvs u4 lxoxf iadfptrlivols teur(o iy4lltnmivsatfsDumump;o4texnmociadfs emu p;u) rxnxrctydom  livslt sexmio oy4al  mfvs s)s2tmxro;u1tex mfctytfa2rauvsnt) eerxfctotoaD  i il( s2uoio nu4lmtelncil(  2ururo;t4tpx mieilt sDuanmp;(0aexnxr iytlaD  i o;(0 2toxm iodlm   fesa(fa2tm(r oo1tpeo iciydfsDrau s;t4arermr iatfm eaivs s0texmxr3nu1amtnlieiat)srrrum ;o0apto fetat aDumuvo t0 eenifctatopt lneol( s2tmio3iy1llee ivi tf Dtr(moot4tpeomfeiadlsDelu o t) rtrxo3iydfpDeluvo t) etmxr3nu4olte ivs ( aDumxr ;u0oeto f3ilsla uaumont4tlxrmo todlaD ln o s0trtmirpiy1am n nct s aruru  ;t1oexomi3tlsfm2eau s;u) lenxr3oy1om eaivs;t s2um(o3nydlme  iei s  2umx pno4aet moeild s2rl(vo (4artrxfcio1fa r uvo t)srxr(r iodapen fvtlt)aDraxrpot4opt mo3iatfa uanvp;(0 rermr iadfaDrlueo t  rxrimpny4amenmfci ( sDtr( oou4altoioetlsfaDea(mpn() leomfctadom rlnei s  2tmxm oodamtnlnesl(fsrur(rpou0aee mieiyd m2umn s;u) eeniocoydop   u s;(  exrio oudomenmiviat  rrax oot0apx mfetytfmDran o;(0aetrmfcoodfaDrlivs;()truoxo3oy4al emieilt)aDtrumpou0tetoioeilslsDra(mpnu4aexrir to1lm  luei;s sexrxm3iudap  lfcsatfartmxmpno1optomf3ild a umu p u0 rermfctydomDeaueslt)trtrim3nu1ope livi t) Drrx p;u0oeeoioeildls rm(vsn()tetrio oo1fm   u o () euoxo oy4altnmnctl(f 2um(  nu4alxn ietys m2em(ms t4trxrmo ootoa e u s (0teto(o3nu4aptn nvtlsfsDua(  ;o1alx ii3iat a2rluvpn(0 ltrio totom rluvi;s0srumxr3ou4oltnmnvsas) Dtrxmo;o1ale moetlslm emn p;t) rxrxfcoo1fa elieo;t0s2um(o3iu4lm nmfetlt  Dtru onu0opt ifcilt s ul(mo;t)aexoxo3oytlp e u sls) rxmxrpnu4lmtnmnctat)a2tmu  ot4tlx mieils a2um(mp u0aleomf3ootopt lnvs ()t2umim ny4olenlncsltf 2ra(  ou0tpeomo3ils mDumn s (0texnxf3oadop   u o t tetoio iudome  fcta(faDra(rooo0aeeomo3iat sDra(vs ()trxnirciytoptelivo t  rxmxm iy1ap elieils)srum(rono0opt ioetysls ra(vs;() etoir3oytop elues s t2tmxo3nudlltnmnctlsf 2rau  nt1alxo oeiytlaDel(vo;t)tltrxo ootla rau il()seur(o ny1lmtemfcsltfa2rmu p;t1tpx io3iad s2rmump (0aexoxrctatla rlieo ( tetrxopou1al nmivtl( arurumoot4opx mieiytfmDumnvsnu0 exoio3oodfaDeln sls)t2um(mpoo1optelfet (farra(m no1apxo ictad a rl(vpn(0 lxoxf oo1fptrlnvils0 etr(m3ny4lptnlneil(farumxm ;o1oee mociltls ulnmp;t0altoif3tytfmD luvs ()seurxm3no1am  mfei (faDraxmo;t4teeo fciadfm2uanmo;t4tlerifciotoatrai i ()srtmir3oodalee nci t  rum(mpou0aexo fcilsfs ulnvsnt0altoxf3oa1oaDe ivi t0 eumiopnudlmeelnvt (faDrr(mpou4optnmieildfa2umump ()aeerir ty1lmDrluvols)setrxm nydlpe  ietlsf 2tr( onu1oexnmictat a rauvo;u)arenxr3iatlm   uvolt trxr(rpio1op   ivtl(faDumxroou1alenif3iad a2emumo;t0 lenif3ia1oa ean ils)sexmxm oydameemivil(f 2ur( onu0aexomfeiytls2umnvp;(0 etrxf ia1lpt anvils  rtoio3oo1om  lfetas a2tmump;t4teto fciaslmDel(mpnt4 eeoir3tydomDrau i t0tetoim3nudome mfct ( a2uax  ;t4aptnmi3iatla elums u4 rtnioctodfm e ieo;s trxmim3iy1aptnlfvt t a2tr(mp;o4oet moctyt m2umuvp;()teeoxo3tadfpt aneilt trur(opio4lptn ici sf Dtrumo;t1oltomociytfm eanvsn() ltrio3iytomD  n i s tetmim3nodlmt livtas  2tax o;u1openif3iaslm2ranvo t4alxrmocto1omtr i s;(0texoimpoo1lp n ictas) rumur ;t1tlxn ieiltfa ua(mpnu0trtrxf3oadomDeai s;() rtm(mpio4altnlict ( arta(r oo4apeoiiciatfm rlnvpnu4 ltoio3oa1fa  luvi;( srxmio3nydal  licilt)aDtmx p;t4tlenmietytfs ran p;u)artrxo3oydlaDran o ( srurxo3ou4omeeliei (  rrru pot0aee miciydlsDumums u0aexrxo3ootomDr ivol( trxr(o no1lpe lncta() Dtru  ou1opxn ietasfs2uaump;()tetnxf3oatlmDe nes t s2xmxopnudlp elneiltfsDtmu p;t0tex  ociadlaDrm( s t4aeermo to1lat au sls)trxm(o iu1oltemictls)a2truro;t4oeeomf3iyt m em( o (0teenmr3tydfmte nesl(0trxrxm3oo4aptn nvil( sDrmxroot0tpenmiciys s em(mon(0trxnmr3oytlmDelnes;s  rxmim iu4lpen nvs t  rrm(  nt1olx  iciatfmDea(monu4aexoxocoatoa e nesl(  2um(r oy1lle lfetlt) 2tm(m ou1altnioetyt m rmuvsnt0 ltrmrcoodoaDe ieo;t0 2xoxo nodlle lfes ( sDtrx  nt1openmf3iysfa rmnvo ()texrxfciadfpDeanes;s0srumxopny1lleelnei (  Dtmu pou4aex ifetysfa el( s u0trtrxf iatopDe n o;()srxo(m io4oleelnetas aDtrxmp;o0ape  octysls uanvpnt4altrxfcoy1la elueo;s trxmxr nydlp nlfviasf ruru ono0oeto fetytlm2eanms t0tlerxo iydlm  anesl( setoxr3nydaptnlivia(  2rmumpnu1tlx mfciysls2ranvs;(4tlermo tydlaDr uvols0sexmimpnu4ame liei t a2raxrpoo1tptoioctytfs2rmu p;(0 eenmociy1fpt auvils trtrir3iy4ll nlfet sfartaum ;t1tlx ifeiydlm eau p;u0 lerir3iotfpDrlueslt setmio iodale lfvsa() 2uau o;u0tpxn ieiadla ul( o (4teeoio io1fatraivi;()srto(o3nudape micils)srtrxm nu0aptnii3iatfa2ul(vp;(4texrioctodlat  uvils  2toimpoy4op emnesat)sDrmur oo4oet  oeiasla2ul(mo (4texrmf3ootlpte u s s0seum(r ou4am   icsas) Drmxro;t4aexoifciydfaDum(ms t4trtnmocoydom rlneo;t t2toir nodlpen nesltfarua(  ;t4apeo ictytfs2eau p;(4aleoxo3iydfm  auei (0teuo(r iy1opeelnvtlt s2tmx oot1opxo feiyd s ean p t0teerircoy1omtr nvi (0setoxmpoy1llen fvs () rurxm ;t4aet moctad m uln ont)aetomrcty1omteau ilt0s2xmxm ou1olt lfvilt) 2rmx o;u1tet  oetysfm rmnmo;t)texnio oy1opteluei (0 rtmio3ny1apte nvias)srumxrpou0tlx moctysfs2uanvp;u)aexomf3oa1fa r u s s0trumxr iydlme liesa()aruau  nu0oleoioetatfm umu p t0 etoir to1lmDrauvs s0sruoir3ou1ape mncia( aDuaumpot1aetnmieiat s2ul( s;u4 renmrcoytlpDe ieolt0s2tm(rpnu4amtnlfes s) 2raumoou1olt  f3tls sDeau pnt4 exnmo3ia1laDelueo t0tetrxr oo1lle mivtas)srurx  ;u1oexo icild aDemu s ()trxoio io1fpD anvsls)s2ur(opiu4omtelfvias) rtmumpou1ole mo3tlslaDuln sn(0arerxf iotop  anvi s)s2xoxo iy1amenlfes t)arrr(mpnt1tlt  fciydfsDelnmsnt0aeeoxo oy1lp rln i ()trtrimpiy1amenmivs () Drr(mo;u1aetnioctatlaDrl( s u0aetoir oy1op rluei;t s2uo(m3nydlp nmivsl()arumx o;u1oet  ietat s rl(ms t0aeermr3iadlm eanvsls) exmxm iy1om  lnciltfsDrax pno0openifeiad m ran s t0texoxrciy1omte i o t0 2xrxr nu4op n nct tfsDuaump;t1aptomfeiasfa2ul(vo u0 ltnxf iy1fmDean i;s)s2xmim3oodlltemietlt  2urum ot1tpx ii3iatls um(vsnu)trxrifcia1lmtrli s s srto(r3ou1aleemfcias sDurxmono1tlx iociyt s el(mo;u4 lxomf3tatlmD  ieils)trur(m3oydomenmfeias) rrm( ooo0apxoif3iadla2rluvs t4alxnxo oy1lp eli sl() euoiopny1alt  ieiltf 2urumo;o4ope  fciysfs emump t4arerxocoatom raneolt) 2uo(m ny4am nliesl() 2trxm no0tpx ifctyd a ulump (0 rtoxo3iotfmDr nei;s trtriopnodam e neslt artr(  no1tptnmo3tldla rmnvonu4altoircoadoaD lnvsls)srxrxopnu4al elfetlt)srtrxr oo1oltnif3iatfaDrln o;()aetoif3iytlmD lies;t)texrxr3ou4al   ivi s)aDtr(  ;t0aexn oeiat s uluvo;u4altomo iy1fmt lues s0s2um(r ny4lmtemnetasf Drm( onu1apeomi3iytfs em( s;t)texnif3iytfptraues t truoxmpoy4am nmnvtl() rurx  ;u0aptn oetasls em(vpn(0 ltnxrciadoa r ivs;t0 eurxo ou4omtnmfvsa() 2rmurp;o1aeeo i3iyd s2ulu snu0aetoxf tytfmtraieilt)trtrio no1lm n fvtlt srrrum ot0oeen ieils s elumsn() rermociodfptelieol( s2urxmpny4olt mietls)sDumumpnt1alxnii3tasfaDrlnvs u)altnxrctytfmDrlneo;s  eumxopoy1lmenlfcsasf Dum(r ;o4texo o3tatfsDemnvs;()texrmr3oatomDeluvs;t  rtmxo3oo1optemfciltf 2rmu o;u1altnmiciyt m umu sn(0areomfcoy1oa r u o s) etr(mpnodolt micsasfaDumum ou4teto fetadlsDuau o;u0aeerir3tydlatelu il( s2trir oo1llt 
\ No newline at end of file
@@ -0,0 +1 @@
+i s s)texoxo iu1ameelfesas  rrru ooo1oltn oeild s2rm(mo t4tltomfciy1omDean o s) exo(m no4al   nei ()srtmu pnu1tpt  o3tyt m em(ms;t4alxrmr3oydoa  luvs;(0t2urxo oo4omt lfcsat) rumxm oo4alxnii3iyd aDem(mp u4texrxr totfp   i o;s0 ruoimpiodomt  feslt s2tmx onu4aeenifeiatlmDrlnmp;u)tetomf ta1fmtelu sls)srurio iy4lpe livi ( s2rm(rpot0oet iictldlm eaumont4alerif tatlm  ai i (0texoxo3oy4al nmfvs t  Drr(  nt1alx mictls a rmuvp t4 lxoioctatlp eau sls)trumim no4opt mnvt t) rta( onu1oeeomictatfsDrm(vs ()teeriocoodlaD  n o (0teuriopiodam emfvs tf 2umx ono0teenifetyt m2um( o;t0tlerif3tatfatr iesl()teuoxopoy4omt  nvtat) Draxr ;t0optoioeiysla eau o;t0tetrxr oatlpteli slt  2xrimpiodomtemivt ()sDtaxm ;u1oeenioeiyt a um(vo;u0 reoif3oodlaD  n s;t)seumir3iudlmt mfvslt)a2ra(  ot0oetomfeilt s um( ont0 lenmr oa1fpDeau i s0s2urxm iodam nmnviltfsDtaur oo0oee ifctydlsDuanmonu0arxomf oo1oaDeauei;s)s2ur(r3nudlptemicils a2urumpoo1oeenioctldfm2rl(ms u4alxoxf3oadlat auesl() etr(rpio4lmen fvi s)s2trxr nt0ole ioeiatlm em(mpnt)arerxrctydop elueo t t2xm(mpou1al  lncslt srra(mpou1altniicilsfs rmuvp;(0 eenmrciytfmDr i i (0teurio3oy4ame  iesltfsrta( pou4tpt  o3iadfsDelump t4alxoxrciodlmD auvs;s s2uoim3no1lm elfet t)srtrur ot1tpto fcils m elnmo;() rtoif3ia1fat li s t srxmio io4apeelnei t) rtru o;t4opt iieiat s2rl(vs (0aeerxo oatfat aneil(0 2xrirpiy4amte ivils) rrmxmoou4oltn oeiltfs el(ms;(4 etrxr ty1lp r ues ( srxoxopiu4al n ivtlt  rraump;u1oeeoifeiytla2eln ont) lenxr oo1om  lueolt s2xrxmpnudllenmfctlt)aDraumo;t1opt mf3iltlmDranmo (0trxoxr oo1om rlneo;s0 2xmim3iy4lleelfctltfsDur(rp;u1tptomociys mDum(mp;(0tltniociotoateauvo (0 rum(mpiydlmt  nct t sruauroot4apx if3ias a rmums (4tlxnmr3iytfmt aues;s  2tmir3nu4ap nlnvsl()arur( p;t0alxoif3iad aDemumpn(0trxrmr3tadfatran o;( texoir3iu4aptnmict (f rrr(m ;o1tltomicils s2rl( o;t4tlxrif oydlaDe uvo;s) 2xmxrpno4altnmfcias srurxrpnt0oexomoetad mDrmu pnu4trtrmr3tadlatrai i;()trtm(rpoo4omte nvtatfsrumump;o0tetnmfeiytlm2elnvonu)alerxr iy1fp eluvi;(  euo(o3nydop elnetl(farrmu  nt4aexo ictytla emu p u) eeomo oadop eanvi ()t2xo(o3iydop n ici t) 2rrurp;t1aee mo3iatfsDul(vsnu)arxnmf tytlm rlnei s)trxmxmpiy1omt micil(fs2uaurpou1aeeomoeilt m2uau s;(4 leoxfciotla r ivolt0seuo(o3io1amte nciasfa2raxmoot4tpxn ictad a rm(vo;u4tlxrmf3iy1lm e u o t0tetrxm3oydlp e ieiasfsrrrx p;o0oex mf3iyt m eanms (4tetoxoctydom e ieo t srumxopiu4op  mnvil(  rtr( p;o4oleo octldlm2uau pn()aeermfcia1opDe i olt0t2tm(r ny4ol   fcslt a2tmxmpot0tlt ii3tad s eauvs t4tetoxrcootfpDeli s;( teurxr oodol elfvt ()arraum ;o0teeoio3iad a umn s;()trerxf tytfa  anesls)s2urio3ou1ope  icilsfsrum(moot1tpxoiictat m2rau p u)alenxr oadfm e uvo;(0trxoim nydoltnlfeta(f Dur(mpou1tpt iieild m ran p u) etoxfctadoat anesls teumxmpiudlptn neiasfs2tmumonu1teeoif3iyt a elumo;(0arxoxo oatfaDe uesl()s2toim oydolenmivsa()sDrmuro;o1olxnio3ildfa2uaumo;u4 rxnxfcty1lpt  iei;t0srxrxr3nudol   iet s aDta( p;u0altomoctlsla2rlu s;t0 lxomf3totfa e ivils0s2xm(m3oy4lpenlfei sf rtrxmooo0olx if3iytfsDrau p;t)artrirciadoat li o t0seum(r iodole  ietl(  rtrum ;o4texnmfciatfaDuluvpnu) leoif3tydla  lnvs t t2xmxm nydlp   ivi sfaDumxro;t4oeenmo3iatla2rlnms;u) etoiociytlm e ies (0s2umxm io1ole mnvta()artr(mpno4apt ii3iat aDemn p;t0 reoxfcia1op rlivs;( t2xrxm3iudlptelnes s  2uaxr nt1oleniictyt mDrm(monu4alerircta1fmtr u o t)setm(r3oudale lnei ( s2taxmono0olen feildfa2rau s u)aeenxociodom  lu o;s) exoxrpno1lpe mivi s)srraumpnt4tleomfeilt s2uauvonu4aexrmfcio1lpDelu i;s0t2xmir oo1llee nei s srtau pno4tptniiciadfaDuanmo;() eenioctatfaD  nvsl()srumim3io1lmt lneslsf rtmxmo;u4tpx io3tltlaDelu o;u)aeerio ootfmD luvi;(  rtmxopoo4am n icslt)srtrxrooo4oexnmieiysfmDrmuvs;u4 rtrxf3ootop eli i s0 2tmio3nodale mfesa(  2tr( poo0teen i3iysfm eanvo;t)artoir tatop  livs;(0t2toxm ou1alte fvtat)s2ua(ro;o4teen iciltlaDeanvpnu)texnio iytlat  uei s  etoiopiu1om elfcil( a2uaxr ;u1ape ioeilsfs2rlnvsnt0teeriocootlmte ues;s)sexoimpiydapenmieslt s2rmur no1aexnmictadfm2rl( p t0 eeniocoydfp e uvol(0 euo(m iy4oleelncsltf rraurpou4opx iieiysla ran o u0 lxomo todlaDe u slt0 eumxm3oo4omtnlict ( sDrrxm oo4tpeoioeiatlmDul(vp;t)altrio3oytlptelivsl(0sruoiopou4ame mfesl() rumu pot0optoifeiys sDemu snt0 rxrir oytfmDeai i (0 2xr(m3oy4ap  lnvil( s2taxr nt0oexo f3ilslm ul(vp;u4artrxo3oo1lmtranvs;()srtrxr oy4ll  lfetas) rta(r ;u0opto i3iat a2rmu p;t0altoxoctadlmtean sl()srxoimpiy4apenmneslt srururont0tpxomi3iydls2ea(ms (4aeeoxr3todfp elies;( s2trim3no4om  mnctlt  Drm(ro;o4teenmfciasfmDumnvon() rerif3oydfm raivs;s)srur(o oodamtnlfeias)sDumx ont1oeeoio3iltlm rlu o;(4aleomf3oy1lm ranesl( t2xoir oudamt mfvslt)s2um(mpnu0apen o3iasfa rl( o;() lermo iy1fp  luesls  2xr(m ny1lme  nctl(f rtaxroou1alxomi3tatlmDra(mo;u0altnmo oatlm e ies t  euo(opiy4amtn iviat  2um(mp;u0alx mieils m2um( p;u4teenmo3oytopDranvs;t trumxo oo4lm  mfeslt) rumxrpnu1aetomf3iytfaDem( o;u)trenmf todla ran il( trurimpnydlpt mfcs tf rumxmpoo1oleomoetld s2emn ont0texrxrciytop rli i;s)srtmim3io1alen feil( a2ur(ro;u4tlen oeiydfm2el(mon(4aetrxrcoodfp   u s;s0trxrxm3nudap  mnetas)srra( o;u1ole  ictyd s2rm( p t0 lxnmr3tatfa eli o;s)seumir oudll elfesls srraumpou4oet ifetlt a2el(mo ()aetoxocoy1oa r nes;()t2toxm oo4aptnlivsl(fsDuaurooo4aeenmoeiytlmDum(vpnt0aetoxf3oa1fa  lu i;s)tetrir io1am nmivtlsfs2raxrp;u0aexoii3iysls ra( p (4 reoxf oy1fp raneolt)s2umxr3iy4lm elncsat) rraxm nt4optniieiatfm2ua(ms;u4 rxnio oodfat livs;s0 exo(r3ny4op  lfvsls) Dtau  no4alxnio3tlt a ranmon(4 rtomr3oytfa elu sl()trtm(r3iudlpt lnvsl(fs2uaxrpoo4aexnmfeiytls umnvs;(0trenmocoatfp rlues;t0 2urimpiudlme mnei s)sDrrxm no4ale ioctlsfm2ulump;u4 rxoir3to1fmD li olt0 rum(o3oo4omeemncsl(  2umu  no4tpxoifcild sDrau o t4texomo oa1lmD  ivo;s)srtoxm3oy1aptelfvta()aruau  ot1tlen ictatlsDrmnvs;u4aetoio ta1fpteaueo;s tetoio iydam n fvtatfarraxront0aptnioetltfs2ul(mo;t) rxrxr3iy1lateau i;s t2xmir io1llee fvi tf rra(  ;u0optoifeiytfa2uanmsnt)texomrcty1fmt  neils0truo(o3iudlmtnlncs (fs2taumpoo1tet mietat s2rlu o u4texrxf to1fm  anesl()t2uo(m3iy1optemfetlt srurum ;t4oeenmo3iadls2elu pnu4 exoxfcoo1fmteluvi s0 eumim3nudam e fetas) rtaum oo1tpxoiociys a2uanmo u0 renio3iatomteanvslt s2to(m3oy1am elfctl() Duaum ;u1tet  ietatfaDumnmpn(4tetnmoctydfat  nvo s0trum(o3no1al nlfes tfsDta(m ;o4oltoii3iat m2uan on(4 etoxf3tatlm eaiei t0setr(opiydop elivsls sDtm(r nt1alxo fciysfa2ean on(0aetnio3iotfmt auei;(  rtrxr oydole mfvi s)a2urxrpnt0aexo icildlaDumnvp;(0arermr3ta1om eanei;s  2xrxo oudlpee ncilt)a2tax  ou4oltnmoeiysfa2rlnvsn() reoir3ootlmDrlu o t0srxm(r3nydllenmivt s) rraxm ou0ale mo3iltfa rln p u4alerxo3oo1oa r u s;(0s2trim nu1om   ieilsfarua(mp;o1oltomociadls2ea( p;(4arxoxr3oydfmDr ieslt0trxm(mpno4ap emnvi s s2rr(r ;t4tlxoif3tys m umn snu0 rtoio3iadoatr u ol(0t2tmimpiu4olenmnvs t) rum(mont0tptniocilslm2ra( pnu4artrxo3tytlp raueo s) ruo(opoudol elnet ()s2um(  nt4aexo f3iydls2rau snt4arxomocta1lpD  neo s0s2um(o iu4omeelicta(fsDum( o;o4tpx if3tadls umuvp;u) ltnxocoa1oaDr ivi t) etm(m3ou4alen fvtl(  2umump;o1tpxnmi3ild a2el(vsn(0aetnxo oydopDe n s s0 etoir3nu4omeelfvia(farrmur ;u4opx  fciatla2uauvp t0alxnxr3ootoat lnei t)srumir ny1ope mictlsfsDuaxrp;o0opxn octatlsDeau s;u) renmf3iytlptranvi t trto(rpiu4ap  mfcia(farta(rooo1alenmfciltlsDelnvs;(0 eenmrcia1oa  aues;(0 rtmxopnydop nlnvtlt sDrrumooo1alt mietas sDem(vo;u4 etomo3tatfpD aieo;s)trtoxm nodal  lfvt tf 2umxm ;o4olt mietadfmDrmumpnu)texrxo tydop e n s t trxoim3oy4op emnctas) rrr(mp;o1tpxoiictadlm ulnvo t)tlxomo3to1fptranvslt)srurxm3iu4aptnlnei sfartrxr nu0alxomocils s elu on(4aeerio oatomD luvils)texmxmpou4omenmfvtl() Drruroou4ale if3iyslmDran s;t4 eenxo oydfatranvilt0 rxm(rpoo1alteliesl(farumurpnu1aee ii3iadlsDulnmp;t)treoio iotopt li sls tetoir iy1oltnlict s)a2ra(r oo0oee io3iadlm2rm(vs;(4trtnir3oy1fptean slt seurir3oydamtemncs (farumu  ;u4tptomoetyt aDra( p t0aetrxo totlm raieol() 2tr(m iu1lm  liviasf Dtaumonu1aeeo fctyd s um(vo;(4artnxociytfatr i o s0 rxmir nu1lm  lnvia(  2urumo;u4tlxnioeiyt m2umnmsnt0teerxo oadlp rlu s ( teurxm iy1aptn fct (faruax  oo1oleoiieilsls eln o t4artnmfciotlpDrlivi t0sexo(mpoudale mivs (f Dur(m oo1oeeo feiytfa2ranmpnu0 exoxocoy1fpDe i s;s)truoio nu1openmnetl(f rrrxro;u4tex  ictad s rmump t4alxoio tytfpDeaies;s) rum(mpiy1lme lnctls srur( p;u4oee  f3iydfmDemn pnt)arxrxf3iydoa e ies t)srxmio3io4al nlivil()a2taxm ou4altnmo3iydfs2ua(vo ()areoir3iodlaD  i o t truoirpou1am nlfvs tfaDtaump;u4tpe  ociyt m rmu p;t0 exomo iodop r u s;(0 2tr(rpiu4al nmfei sf Dtrumont4opxo icias aDrl( snu0 rtomrciatfat lueo;( s2urio3ny1open fcslsfaDurur no4optomi3iydlsDulnms;t)tlenxo3iatlmDe ivi t)sexrim nu1op  mfct t s2ta(  ;o0optoiieiltla2ea( snu4tetoxf iatfpD luvi;(0texoim oudopenlicslt)arra( ont0oeeoiictysfa2rluvp;(4aetoxf3oodom rai s;t  etoxo3oo1ap e nvta()aDururpot4tpx iieiysfa2eln s u)trxoxfcto1omD anei;(0srtrxr iy4om emncsls sDtrxro;u1opeoifctadlm2ulnvpn(0 exnxo oydfpDelu i;(  rur(r3ou1om e iesa(f 2urum nt0oetoifctysla umnmpn() lxnmo oadlmtrluvolt0 eto(m3ou4amt  ietas)aDuru  ot1aeenif3tldfsDrl( s;u)alenxf3ta1lp eliei;t0 rur(r iy4alenlnctat  2rrum ;t0apx moeiysfaDum( pn()aeenir3todlp rlivi;()trxm(opny4apeeliet s)s2tr(r no1opxnmfeiad s emn s;t4trtoxo3tadomt  i i;( teumxrpno1omenlivslsfa2rmumo;t1tlto i3iltlsDea( p u0alxoxociotlm eaieol()srur(r iydlltn ics t)aDrmxrpou1tle  oeiytlm um(ms;(4arxnioctotlmtelnvslt)srtr(o iodlptemfvt (f rtrxr ;o1olxnmf3tadfm2rmnvp u0 rtoxo3oa1oa   neo;()t2xrxm nu1amtn net s a2rm(mpoo0opxnmi3ias a eln p t0trxrxoctotoaD luvs s0t2xrio ny1al nlietasfsrumxro;o4apeoio3iat aDel(msn(0tltomf iy1faDe nvol()s2to(o iudlm nlnvsl( artmumont4teto ociytlm emuvo;u0arerir oadlmtrlneolt) ruoxm iu4am  lfeia(f rtrxr ou4open oeiyd s2ran p (4 rermo oatfa  auei ( srxoxopou4ame mneilt)s2uaxrp;o0oee  ociytfa em( o u0trtoxf iatlm elieols)srxm(opiudamenliet (faDrr(r ou4tetoiociatls ua(mont) rtnif ta1optelneolt  2xmxm iydlleemnes s  2ururoou1tptomoeiad a2ulnms u4alerifciadop rlieo s0s2xoxr ny1altn fvtas) ruax pnt0tlen icias sDrlumo (4tlerxo iytfp   neils0tetm(rpou4op elictas) Dtrxm ou1tlx mocild sDel( snt0aeerxr oo1fpt  u ol()truoxo nydolte nvtls s2tm(mpnu1opx ifeildla2ua(vs t0trtrxf3oydfpD luvs;t0s2trio3iodll nmietls)aDtaurp;o0oetoiietaslaDeanmp t0treomocoadfaD luvs;( srtr(m3iy4aptemfeslsfaDrmxr oo4tex  ocildfmDeaums;t)texoio ty1om r uvils0trtmio iy1opeelivs t)sDrrxr ou1opx ifciytlm emn s t4 exnio3iadlpD au s;(0 2toir nu4oltelnvt s s2rru onu4aetnif3tld a2umump;t4 eenxocoa1fpDraiesls0tetrim ou4oltemfei s) 2um(mp;t0tpeo ociysfa elnmp;(4alermrcoa1fmD aneolt s2tmxr3iudomen iviatfa2rrx  nu1oetomfetytlsDuln o;t)teenxf3tydfmDr ieo s trum(o io1alt livt s)aDtr(r ;u1tpxoifciadla ua( ont) rxnio iy1fpDranvo s0trurxm oo1lleelivils) Drau onu4oetn oeildfa2umump;(4texrmf3todlatranvo;t trxr(r nu1lm n ieslsf Dtmx onu0opxnmoeiys a2ulu p;u4 etrio3io1opDeauei t)srxr(r3oudame lneias  2tm(moou0tleo ociatlaDelumsnt4trxoio totlp e u il(0 exrir3oy1llt  neta(f 2trxm nt1tpxnmoetadfmDrlumsn()aetnifctydlmtelies (  eum(m iodom  lneta(f Drmxrpno0aeeomi3tltls2em(vs (0teermo3iytom rluei;s t2urir nu4omtemnei s  rtm( p;o0teenmoeiat a2rl( s;t0 lxrio3iy1op rlneolt)seuoio3iydlmtn ietltf Drrurp;t0altoifctld a em(vsnu4teenmo todlaDelu il( seumxmpiu4opeemnet ( s2uaurpno0olxo octldfs2rm( s (0alerxociotfat aneil()srtoxrpiu4lp n ivtatfarrrxm ;u4apx  ocildfa raums (4arenmr3oadfp rauvil(0teur(mpiydaleelfvt ( sDrau oot4tlto oeildfm2rlu p u4 eeniociy1omteluvi (0t2xmxmpoodale  fcils)srtr(mpot4opxnii3ilsfa2el( p (0alxomr3io1faD  i i;s  rtrim ny1ap emnci sfa2taxmp;o4opxoio3ils mDelnmonu4 exnmo3tytfa e neo t0srtr(m oy1lpen ncslt sDtaump;u4opxo oeildla2el( s (0teerxo3todomtrlnvol(0t2xoxo3oo1op  lfct t)sDrmu poo4alx mfctasfs rmuvsn(4 lxoxf ootfmDeai o;t) eumxo3oo4llt  nviasfa2ra(ront0tlxomietltlm2em(mpnt4tltnxrciotfmtr i o;s) exrxo nu1omtnlfcilt  2rm(rpnu1aexo o3iadla2ulu snt4 reomf oydfmD lieo s s2urim oydap emicta( sDumxmooo4tlt  i3iyslmDran o (4tlxnxo oatlmD lnei (0teurxm oy1ame  nvtl( artru o;o0aexomociyt mDua(mo;t)trxnif ty1omDelu o;s)truo(m no4al emivilsf rrrurono4tptoiictat m em(vpn(0 eeomr3tydoatrlnei s0tetoio ny4llt mfes ( a2rrxr nu0tltn o3ild m rln o u4 ltoifciadfp r iei;() 2xoxo nu4lm   fvsat  rtr(mpno1tpenio3tltls eanvp;t)aleoifcoydomte iei ( teur(r ny1lptn nvsls)sDua(mp;o4altnmi3tltlaDulnmp;t)trermf todoptrli il( t2xrir3ny4lpt  ivia()s2ua(mo;t1opxn oeiadls2umnmonu) lxnmr3ta1lmDrai s;s teum(m3ny4lmtelivtat aDuaum ;o0oetn ictltfaDem(vont)arermr3ta1lmD aieo s t2xm(o ny1ope mfetls  2taxmoou0oeenmo3tasls2rmu o (4tltnxrctotoptr ues t) euoxr3iu4apt lneslsfaDum(root4olxomiciyd m emnmo u0teerio3ia1fmt  uvs t srxrio3oy4alenmictltfaDrrum no0tlt  i3tyd s2uanmsnu4artrircia1oatran s;t)s2xrxmpoudopt mfvtl(farrrxront4oetnioctldfmDel( snt4teerio3iodoatrlu o;t0t2uo(opnydal  lnctlsf 2taumpou1oeen o3tadls2ran p t)teenmf3oadom  lneilt0 2umxo iy1om n nvsltfaDur(mo;t0ale mfciltlmDumnmp;t)alxrxr3io1lmD lu s t)trumxopnodaptn fvtls  2taxmpot0tltomo3iydlsDelnvp u)tlerio3oy1omD  nvo;t0seuoxo3iu4openlfvs s a2rm(ro;u1apt mieias mDrmuvs;t)teermoctytla  auvi;t srtm(r3oy4om nmfet s  ruaur oo0tleoifeiatfa2rlu pn()artnxr ty1lm rauei;(0srxm(o ou4ll e ivil(  2tmxm ou4oltn o3ildlsDulump;(4 lermr oatomtr u s s0t2tm(m3oydomeelnes tf rraxm ;u0apeomo3iadlmDul(vo t0aetomfcoa1lpDelnes;(0srtm(o oo1ap e nvslsf rum(r no1aptnmf3ild sDua(msnt4tlxomo3oa1fat  i i s0srurim3iydllen iciatf rta(  ;o4alt ii3tasls2uau pn()arxnxo3oo1fmD aivs;() rtr(o nu1olenmnesls) rur(  ou4tetn fciatlsDua(mo;t0trtrxfcia1opD  nes s)truoxrpno1oltnlicslsfsDrrumpou1opto fciys a2rmnms (4alxoxf3iadoptrlnei s texo(mpno4ap nlnvt ()sDraum oo4apx mocilsla rm(vs u)altoxo3iotfmtr n s s0s2tmimpny4omtnlfviat)a2uru pou1altnmieiasla eln p (0 eeoif iodlpteau o;s0srxrxopiy4ap nlfvs sfa2rmumoot1alxnmo3ilsfs rl(mo t0alxomr3oadfpD an ilt  rxrxm nu1ll e fvtls)srrr(rpou1tpxnmf3iyd a2rlu o;u4arenmr ty1fmDraneo t) 2xrxm no4aptnlnesltfaDrr(mpno0altnmfetys s2el(mon(4arxnmr io1la   neilt0 2trim nu4altnlici s) Dur(  ;t1tet  ieiatla umuvpnt4treomf3tadlatrlu o;t)setr(rpoy1am n ivi tfs2ua( pot0tpxoioctlsla2uluvp;t0arenxr3oydoa elieol(0srumiopnodopteliei tfaDurx pou0oltoioeiltfs ulump t) lxoio3oytfmD aiei;t)t2uoxrpnydlptn ivsa( s2raump;o4oexo iciat sDumuvs;()tetniocio1lmtran i;s)tetm(o3ny4ol emfci (fartmuro;o1tlxnif3iys a2uan sn(4 lenxf3ia1oat  n i s0 2um(m nu1altn iesa()sDrrxm ;o1olxnmf3ilsla eanvsnu4 exnio oydopDelnvs;()t2xoio iu1op  mfvi (fsruaxrpou4tpeoioetldfaDumuvpnt0 lxomocto1la   ues s srxr(o3iodll emivi s s2um( p;u4tpx mfetysls ul(mp;(4tltnxrctodfa  luvol( tetm(mpoo4amee nvs t  rurur ou4texoif3ild s ul(vs;(4tetrxr iy1fat  nvo t) 2to(o3iodlpenmivt sfs2uaxmpnt1apeoioctas aDelnvo t)teermfciadom eaivs;s tetr(r nodom  livta(fsrurum no1aeenii3tytlaDeau s (0tleoxocio1omte n i t) etm(rpnodop n nvil(f 2ur(rpoo4aeeoii3tydfa2eluvs;u0tetrmr3tatfmteanvslt  ruo(mpiy4lpe  ietat)aDrrxmpno1olen o3iysfm um( o u4arermo3iodlatraneils) 2toirpnodomtn nctlt s2umum ;t4aexnmieild sDem( on()tlxnxr to1om eliei s  2tmxrpio1lp n netls)a2trurp;o0apto ociytlm2eluvs t) ltomfcoy1fmteli i s trto(r3iydlmtnmnesat)s2trurono0oexnioetltlm2emnvo;t4tlenmr3todfp r n o t0 ruoxo3oydamt livs s aDrr(r oo4teen ociysls2elnmpnt)arxrxr io1fmDr n ils0sexrxo nydllee ncsas)srurumont4oeeo oeiadls2ulumo;t)tetrxo3iotlpteanvs s teur(rpoo4lmtnmnvs tf rrr(mo;u0aeeo fciyt s2eaums;()aetnmo3todopDranvi ( s2xrxrpoodamenmivs t a2rmurp;t0openifetyt aDumnvpnt0aeenxo ootla rln i;t) exrxm ou4op emncsls)a2ua(r nt0tle ioctyd m2rlnvo u)tlxrir3iydlpDr n s s  rto(m oo1oltnlfcias aDur(r ot4aptomo3iydls rl(vonu0trxrxr3tydoaDe nvilt  2xmim nu1ole mfcsls aDtmurpnt1optn iciyd m2ulnmp;(4teerxo3tatfpte uvils) rxoimpio4am elnviasf 2rmumonu1opt mf3iyt s emuvsnt4trxrif iydfateluvil( seuo(o3ou4lpte ictlsf Drr(ro;o4opxomieiltfmDrlu s (0aexoxo3oydfmt lu s;t)teumirpiodom elietas) rtax  ot4alx miciat sDuanmo t) ltrxr oo1fptrliei (0 2toir3iudll   fviasfsDtmurpnu1alxoifeiatla2elnvpn(0arxnxo3tatoaD aueo s)trxmirpoo1optnlivt s)aDumumo;o0aexo iciyd a2el(vpn()teeoircia1fmDrai o ( s2umirpoodllt mnetas) 2urum oo4oeenmfctyd s2rm( sn(0trxrir oydlmD au i;t)teumxm nodaltn ictl()arrm(m nu1alxn fctltfaDrmu sn()artomo3tadlm  ln i (0s2ur(rpny4op n fvils)srrau p;o4ope  i3tydla ranvs;t0tetrifcto1la e u o t0t2xr(r3ny4olt micta()a2um(r ot4tlt  icilt a rmu on() rtnxr3iadopD  i sl() 2xmiopiy1llenmivias)aDrmx p;t0optoiietldla umu p (0arerxoctatfmtraivi t)seumxo iudoleemnvil(f 2trxmont1oet io3iysls2umnmo (0 exoxrcoodfaDe ieol(0t2umiopiy1lptn iesl()srra(mo;t1tleoif3ils sDrmu o;() exrmr3tatfptean ol( t2xm(mpiu1olen neslt)sDrrur ;t1oexomoeilt mDel(vo (0trenxr3ia1optrli olt0 2xmxm3ou4ap emfesasfsDrm(m oo4apxo f3iysfm elnmont)tltrxo3oatopt lnvolt) eumir3nudapee ictl() 2urxrp;o1opeo ietlsfa2uluvo;u4 exniociotop eluvsls)sruo(r ou1llenmicias sDrrxro;o1oleoiociytfa2eanvp;(0tlxoio oy1opteli ol(0 eum(r3oodapenmfes tf Duru  nt4tet mfeilt s2uln pnu)aexnxr tadlp eaneol(0s2umim3oy4ame  nes ()a2umu o;o0oltomoetadfaDumu pnu4trtrircta1opD ai olt t2toim3iy4ol nlfci t a2rm( ooo4apxn ociyd m umuvo;u4aleniocto1oateaueil()seuo(m3oo4lmtemnesl( aDtaxr ot1oee mf3iyslmDeanmonu)alerif io1la   ivi s  rxr(rpnodlmtnliet t  Draxrp;t4optniicildla2rm(vp;t0tetrir3oodfm rluvil( srxrxrpny1optnmivia( srtau poo0oexnioeiyd m2umuvsn(0tlxrio3iatomDeanvols srxmxr3nu1lmt  iesatfsDtmx onu4ape  ieiytfs2ulnmp (0 eenxocoadlp rlivs s0teur(m io4aleemfcias)s2tmu  ot1oexnioeilt a eluvsnt4 exoxfciadoa eln ols sexrxopnodamtnlieilt)sDrmx oot4oee mieiad mDelnms;t0 ltoir3todfatr ueo;t0 2toim3nudllt  ieil(fsDrm(roou0texnmietltfs emn p t4 rxnmo ty1lm   i s (  2tmxmpou4lmte nesas) rtrx p;u0tltnmf3tas a2rmuvo t) renmo totfatrlnes;(  2urimpoy4alen nesat  2ua(rpot4altomo3iyslm2ul(ms;t)altrio totlp eaues (  exoxr oydomenlfvs ()a2trumono1alxomo3iad mDumn p (0 ltnxo iydfaDranes t0t2tmxo3ny1lltemfet s) Dtrxr ou4aeeo ocils m2emnvp;()teenxfcio1opDeliei;s0 2um(o3nu4oleemicsas  Dtax  ;u0olxoifciasfs2uanvsn(0trtrif3totoaDrlnvo t sexm(mpoo1ap nmneils  Dtm(  ou1opx mieiyt aDelump u) rtomfcoy1laDraueols texm(opny4ope mivilsf rurx poo1tltoio3tas mDea(vp u4aetrmrcoa1laDelneo;s t2tr(o3ny1ll eliei s  Dtmumoou4tlenmo3ild a2emu p u) ltnif ty1latr nvilt0 etmio ou4lpe  iesa()arurumoot1oltnifcildla rmumo (0 etnirciodoaD lnvi s0t2xrxrpnodlpee nci sfartr( pno0oetomo3tysfs2rmu s;t4alxnmr3ty1lm  ai ols teumxmpnudalt  fvs () 2ra(m ot1tpxoio3iadla2rl(mo u) rxoir oytfmDeau s t)t2uo(m nu1open ncta( srrrumo;t4olxomo3ild a2ulnvp t)teenmfcoadlatelneilt)t2umirpiodom   fvi ()a2rruront1oexomoeiyslsDuau o;t)trxnircootfmDeau o s) rxrxm3nodlp   fetls)srrru  nt1tpenmo3iadlm2eau ont) exnxoctodlmtelues (0 2um(opiydape mneils  rtr(r oo4tpeo fctydfs rmn s (0texnmo oy1lp eanei;s0sruo(r3nydlmt  ivs t  rtr(m nu4optn fciysfa2rln o;u4aetrxociadfpDelivi;(0t2xmim ny4ll emfci (  Dta(mo;o0teeoio3iysfa rmnmsnu0areniociodoatrlneols srtrxr iu4amenmfct s)a2ua(r nu4aptnmf3tldls2rmuvo;u4treoif3iadlaDraiei ( srumiopou4omeelfesl( aruaump;u0olxoio3iyt m2rmn p;t0trerir oo1omD au s t s2xo(m oy4aptnlnetlsfartmxrono0tetoif3iadlaDrmu o (4tlxnxociatfm eli s;s0trtmimpoo4ole  fet t aDua(m nt4olen fctldfa eaumo t4 exomr3oatla ran i;( teumxopno4lmtnlieilsfsrtrump;u1opxn ietadfs ua( o;u4 ltoxf oydomt luvs;t0texr(r3nu1olt lneslt s2tm( ono0aptniiciydfaDrl(ms;t4trxrir iodop  anvi t)s2tm(mpnu4op nmfvtl(f Drr(ront4tee  ieiltfm2ean s t0trerircoadoaDrauei;t)seum(r oo4lmenmncsatf Dtru o;u0olxomi3iydlm umuvon(4tlermo oytlat luvi t  2xr(rpny4olen icsatfsrrm(ro;o1olt  ictytlm2emu onu4artrxocoa1lmDrlu ils seum(o ny1lmt livtas)sDumurpnt0oltoifeiys m2ea(mo (4trxoxf tatop elnvsl()s2umxm iodlpe  fvt t)aDtau oot0texo feils mDuluvpn()aetnmf oytlp rau ol(  2uo(r iu4lpenlnvt ( sruaxm nu0tpxnmicilslm2emuvs;(0alenxrciadomt  nes;t)s2xm(opiydaltnmfeilsf rumxmpou0aet  ictydfmDeluvp;t4texrmr ta1fp eaneils  2toxrpoy4ol   ncsas)aDtmxr ;u0oltomo3tytlsDemnvp u0aexoxf3tadla  auvilt) etrxrpnu1alt lfvs s srta(m nt4tlto ietltlm emumsnt0tleomr3oa1oaD  u o;t0s2xo(r ou1omtnlivsls arumur ;u4oltoiieiatlm rl( p;u0alenxo3oa1opDr ies s0 2xmimpoy1ap n fctltf Dtaxmp;o0aetn feiltlmDuanms t4aexrioctotlaDrlneo t0texoxr oo4al n ivi s arurx pot4tle  o3iltfmDrmn p u) exrir iadfaDelu o;s srum(r3io4apenlietat)srraxronu4aee ioetltfs ua(mont0 lxrxr3io1fm   iei;s)s2urxopnudll  mnet sfa2rr( pnt4olx moetydfaDra( s u0tlxoir3tytoa  luvi;t0t2umio3iodoleelnet s) rtmurp;o4texnmfciydfm2umnvont4aexoio3oy1om elivolt  rtr(r nudap  liviat)arrm(r ot4tlxniieiyt m ea( onu0 etoxr oydfaDel
\ No newline at end of file
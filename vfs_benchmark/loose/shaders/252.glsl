@@ -0,0 +1 @@
+uvslt0texmxr3nydlptnmneia()sDraxmonu1opxnifeiat s2rl(mo t0areoxfctytfat li s (0s2urir3oy4omeelieilsfs2rru ont0olxo feiys a2eau onu4tlenmr iodlpD  neilt0trxrxm3iudll n nvil(f 2urumpoo1teto fciad m eluvo (4 lxoxo3ia1late neo t0 2uoio3oudopen iciat)artr( oot1tex  fcildlsDua(vo t) rxoxo3iy1oat aiei (0 rxm(o ny1optnlfvsat)srrr( oot4opxniieiadfa elu ont0alenmr3ia1lateli o s)s2tr(m3iydame  nctat)arrmx p;u4oltomieilt m ea(vsn(0 rtoifcootfm e u s;( teurxopoo1om nlivt s sruau oou0teto fcildfa2rmu p t4tlxnxr iotlmtr n i s) exo(mpiudll emfvslsfsrrr(root1aeenmi3tadlaDulu pn(0 exniocoy1opt lnvolt0 rxoxm3oy1lpeemiet ()sDrm(mp;t0olt  fcils s ran s;u)aeenxo tadlate u s ( t2tmir iydll e nvi t)aDtaurpou4openifciydls ea(vp;t) rxrxrctydopDrlnvilt)trtrimpnu1ll n ivtl() rrau pot0olt if3ilt a eln p;t0aetnmo3tadlatran i;( sexmio oy4omee ivsa(  2tmx p;o4tetnmieiys aDeluvp (0tlxnxf iodlmDean o (  eurir nu4lm n iesl() 2tr( o;t4apxnii3iytfm emuvont0 eeoir3tydoaD  i o (0t2xmxm nu4ap e ici ( sDur(rooo4opxo octaslm eauvp;t0trxrxr3iotoa  aivi s0setoirpno4lp  miet t srum(r oo4olt  i3tadfm ua( p;t)trtnxfciydlp elneslt)s2xo(r oy4op   fvias s2urum oo1tex  ietltlsDelnvp t)tlxrmo3oatoa  an ols)t2toirpiu4ol e iesas)a2tm(  ;u4texoiocias m el(mpn()teenircoy1op raiei;() 2urir3oy4ll n neia(farumxrpot0apx mf3ild a2emumon(4arxnxf oatoatr ueslt  exmio3iu1am emfei s  Dtmx pnt0apeomfetltla ea(mp t) rtrio tatlmt  n i t)t2uoir3io1omtn fei ( arrr( poo0opxo fctlt mDua(vs u)trtomfcto1latrauvs;s  rtr(opiudape micsl() Dtrxm no0apeoiiciltlm2ra(ms t0tlxnmr iatom e n olt0tetrxrpiydapt lfcs t)s2tax pou4tleomfetadlm em( o t4teeoxf3iotfa   nvilt0teum(opiu1omt lieil(  rrm(mpou0aex if3tys m2rlnvsnt) eeniocoy1oaDr u o;(0texoxm ny1ol emnvsa(farra(  ot4aeeo o3ild m2uau o;u4tlermfctotfp rli i;s)srtmim3io4aptemfvsas)a2rrxrpou1apto ictys s2emn onu)teerif oa1fp elueolt seuo(opnudlmeelfes s)srurxro;o0tlxn i3iadfa uanms;t4arxrxr3iydoaDrau i;() 2xrxr3iu1lmenlfvilt)srta(  nu4apxnii3tlsfm emu pnu) etnxr io1fmDrlu il() etrxmpnu1ome licsat) 2trxmp;o4alt mi3tldfsDuanvsnu4 etrio3iatfpD aneolt)t2xmim io1ope liesat) Dua(m ;t0aee mi3tyt a ua( on(4tlxomf io1fm eanvs;()trxoir3ou1lleelivs t  Drrumooo0teenmoetydfsDelu pn()aetrio3iotoatrlueolt0sexo(o oy1llt  fciasf Dtr(r ou4olx iicilsfa eanvo u4 eeomociytlaDrlu i (  2tmxm oydameelfviat) 2ta( ono0alt if3ilsla2emu o t4 exnxf3iydlm ean s;( trumxm3ou1lm elici tfsruaxmpot0tltnifeiyt sDua( o (0 exrif ta1fpteliei (0 etoxo ou1al e nvtl( sDrrurpno4aexoiiciaslm2ua(vo;() etoiociodla rai o;()srum(m ou4lp emfei t)a2taxronu4alto o3tasfaDrauvp () exnxo3oytlatrln i ( srtm(opno1lptnmieils)aDtau  ;u1alenmi3iys a2ua(vo t)tlerxr3oatfa r ies (0 ruoio no4lp emnvsls) rtr(rpou1tex ifetld s rmuvonu0alxoxf iatfmD  nvilt  rxo(m ny4lp emfcs tfarumum ou4tlen ieils s umnmont) eeoif3iytoat  u s t)trto(o iy1lmtelnes t  2ua(mp;u4apx mfctldfaDrm( o;(4teeomfctotfmtrluvol( seurio nu4open icsat srumxrp;o4teto feiatls2rlu s;u4 rerxrciadfpDeanvols) 2to(r3iy4lmt livilsfsrumx ont1oltnmictyd aDuaump u4altoxfcto1omDranei;t  2xm(rpiu4omeemncsas) Drax  no0aetniietas s2uan pn(4aeenirciodlp r n ols)t2uoxo3oodomtemivta( s2umumpno0openiieiyt mDumnvo;(0aetrio iodlptelneil(0texm(m iu4ame mivi s  Duaumoou0texomieildls2rluvsnt0artoio3iytfat ln s;t0trtmiopoo4apte ivi t) rrax  nu1alxo o3iysfa2ranms () ltoif3tadfmDelivils t2tmxm no1llen fci s srrrxroou0tpe mietydfm ulnmo (4texrmf oadla e uvslt)srtr(r iu4am eliciasf rua(rp;o4ape ifeilsfa2um(vpnu) lerxr oo1omDran i s0t2trxr nu1lltn ict tf 2rmum ;o4openmictydlm2umnmo;u) rxoxo3tadfpD lneslt0 exo(mpoudlm nlnesl( artmxm ot4tpeo feiysfa2el(monu0artrmf3oytfp elu ols) exm(o3io1ap emietas aDtmxmo;t4oex mfciasla2rmnvo;u)tetrmr ia1opDr ues;(0seto(rpoudaltelneslt)srtau p;o1tpxnifetld a2rmnvp;u0tltrif3ty1lm eliei;( teto(m io4lme mivs s  Dra( p;u0ope mociatlaDrlu s (4trxoif3to1fpDr i i;s) rto(m3nudlp emnetl(farra(  oo4alenmietatlm ra(vp t4tlxomr3oydoaDraues (  2uo(m nu1lltelfvias) 2ra(  ;u0tpe ioetysla ean pnt0 ltomr iy1omDe uvo (0 exr(m iydlptnlnvt tf 2tr(rp;o4oee  i3iyslm2umnmpnu0 lxoif3ootlaDe nei;s  2tm(rpno4lle  ict s)a2umu  ;u4tetomi3tyt sDea(mo u) ltoirctadlmt lieo (0 rur(m3oo1lpen ici ()aDur(  ot1tpxoif3tydla2ul(vsnu) eermfcoatlat  uvs (0t2tr(r3nu4ll emnet tf 2tmurpno0open i3iyslsDulnvpnt4tlenxocia1oat an s s) ruo(rpoydoltelivi sf rtau  oo1tle iieild a2uanms (4 leomoctodfpDrli ols) 2tmxm3io4lpt mivtas) Dtr(m oo1tptnmfetys s2uln onu4alxnmo3iytfaDrli ils0teurim3oo4ap n neias)sDtr(  nt4tle ifeiydfm2umn o;u)trtnmfciodop  lieols trurxr3oy4lmee nct ()a2trumpnu1tltnio3tltfa uluvo (4tltnxf3iydfm rluvols0teuoiopnudoltn iesl(  2umxmpnt4oeeoioeildfm2rlump;(0 ltrmocoa1fmt  ies;(0trxmiopiy1opeemivtls artmxmpot4oeeomiciasfsDumuvp;u0tltnir3tadfpDe ivi;(  exmimpiudlmtemivi ()aDur(ro;t1aexomictadlm2ulnvp (4trxoxr oatoptr ivo s0 2trxopno4oleelnetl()aDrmum ;o4oltniiciadfaDuaumonu) ltnio oydlptrlnesls seurxm nu1llee nctls artmx pot1apxo fcilt aDrlumonu)alxrif3iatlaD  ivi;(0 2ur(m3oo4amen nctlsfa2raxm ;o0tpen fciatla2em(mpnu4arerircty1lmD lneols0s2tmxopiudome lfcslt  Durxr no0teen fctadfa uluvonu0arxnir iodfmtrlueolt)s2uoir3oo4al nlnciat srta(mp;u1apxnmictadfm eaump ()tetnif io1la  aueo s sexoirpio1om   ieiatf Duaxmonu0aeto i3tyt sDuanvp (0 ltnxr iatfp  ln s;(  etoxo oudlmteliviasf 2tax o;u4oltn ieilsfa el(mp;u4aetoxo3oo1laDeluei;t0sexr(o iu1ap nlncsl()srrrxrpoo1tlenmietad mDrauvo t)tetnmr3iodfptr u o;() rurirpiodlpte fctls)a2tm(rooo4aet  o3ildls2ranvonu4tetnmr tadop  livs ()seurxr3ou1lltnlfes t s2rr(ront4tlxoiocilsfaDumuvp;t)arenxrcta1omD ln s s sexoxo3iudoptemfci s)artaxrpoo0tpe  iciasfm uanmsnu4alxrxfctatop  lu o ( s2ur(o oydamee iesl(f Duru ono4tptnifeiyslaDua( o ()arerio3ootlpD lueils  etmir3io4ll n ici t sDrmum nu0tptnifeiyd m ea(ms;u0alxrxo oo1oat lues t0s2uoim oydalee fcilt)arumum ou1tpxomoetytlsDra( p;(4aexnmo oytlpteau ilt trtoimpno1lmte fvs (  rta(rpnu1tlx  oeiysls rauvsn(0 lxomr3oy1fpt li ol() exrxopiy1lm   nctasf Durxmont1tle mfeils s el( o u4 eenif tadoptean ilt) 2tmxrpnu4olenlneil( a2umumpou1aexnif3iad s emnmont4 ltrir ty1laD li il(  2trxopoo4lmt  fvia()sDrmx pnu4oeeomi3iadfs2ua(mp t)aetrif oy1lm  lues;(0 rumxr iudap nmiet (fsDrrum oo1texnmi3iysfsDum(vp u0 rxnmo iatfpte ies;t0s2xoxm oodome liei ()aDtr(mo;t0tpe  ieiadfsDemuvonu4 ltnmf tadlat lu olt)seuoio3iudope liesas) Dta(mo;u0teenioetytfs ra(mo;(0aleoiocoa1omtrlnes;() exm(r3iudoptelfesat srrmxm ;u0openmf3ilt a2umums;() eenmocto1fpte nvs;s  2tmim iydam elfvtlt a2tr(mpot4tlx ii3tadlsDuluvp;(0alerxf ta1fmte ues t) rtrio3nudamt mfeslt sDumxmpou1tptomo3tyt m2el( o u0aeeomfcoy1oaD  nes;s0texrxm ou1opeemfesat)s2ur(  ;u4texomoeils m2ranvsnu)aetomo todop  lieils0 2ur(rpiudomtnlfcs sf 2tmxmo;o0olxn i3tldla ranvp ()aetnifctodfmtraneslt)seumxo io4amt micils)a2rrxm ;t0olt  feildfm ulums (0 ltnio3oydoaDr u i;(0srxrxo iy4am n fciat  2rr(m nu4ole iietlslsDeaumo t) etoxo oatlmDe nvi;t) exm(o3iudllen ivtltf Duru  ou0oltnmfciatfm2eau s t)trxoxocta1fpDe nvolt0texr(m3oodll emnvtlt  rrm( o;t4aeeomociat mDumu s u)tlenxfcoo1lmDelnvi ( s2toxrpoy1omtnmfeta(faDrrumont4tptomoeilslmDrmn s u0aeenir3iadla rlivs;t)srtr(rpio1alteliei tf 2rmxm ;t4oltniiciatfa ulu o;u0 reoxfcio1fptranvs (0 2uo(m oodlptnlfcil(f rtrxr ot1altn i3iydlm umu o;u4tlxoxf3oatlmDeanvo s)t2tr(m3nu1aptnlneia(fs2trum nt1altoii3iysfs2rlump t4trxoxrciy1laD  nvi;t0texmirpno1ale lnvtls aDuaxr nt4oltomfeiasls umuvp;()trerif tatlp e nei s)srto(o iu1om elnctl(f Drmum ;u4oltoii3iytfm em( on()trtrxo3iy1fmD aneo;s0trxrimpnodol   ivi ( a2rr(ro;o0ale mf3tadls umnvo;(0aexrxr3to1lp rli ol() eum(o nu1lmenlfvt s)a2tmu  ot4opto o3tltlm2rauvsnu0alenmo3oadlat lnvo;s0sexmir3ou4alee feta( artrxm ;o1oet micildla emumo;u)trerio io1om eaneolt) rtrim iy1lle mnviat sDtmu  ;o4altomo3iyt s elnms t0aetrmf iy1fatelnesls)truo(m3oy1lle miesl()sDtr(r oo0oleniieilsfmDemu p;t4texoir3to1laD  nvs s  2ur(m ny4lp nlicslt)a2tmurpno1tptnmoeiadla el(mo;()trermo ty1omDeluvs;t0setoxmpiu4apenlfviasfsDtaumpot4tlt  feias s2elnmon()areoxfcio1lmDelneo;s)trxm(r3oy1op  lnvsasfs2rmxrp;u0tetoiieiatls2emuvs t4 lxnxo iydlpD lues;s  exmim3oodlpen ncs s) ruaxro;o0tpe mo3ilslsDuanmp;(4tlxoio3iotla eaivils srur(o3oy4ameemfvtatfsDurum nu0apxo ociad aDuaumont0arxrxr oodfm   ivo t t2tmimpoo1ame mies s arum(mont0tltnif3ias m2ua(mpn(4tetomr3ta1fptr nes;(0 rtmxm io4op n fctl(fa2rau  nu1opxnioeilsfa ea(vo t)aexnio3oydlaD lnes;(0setrirpiy4aptnlneilt arururooo4aee mf3iysfa2ea( p;()aetrxr iodoptrlnvi;(  2tm(r3ou4omte ietas)s2ta(r nu0apxn fciytlsDelnmo t4treoir3iy1fp ranvs s)srumirpiudop nliesasfaDtrur ou4oleoii3ildfs umump;(4 reomo3iadfmD livslt0trtr(r3iu4alenlietat  Dtmxmpnt4opt iietldlm2ulnmonu)tltrxr io1op e i ol()seumio3ou1al nmfet tfsDraur ;t4alt iieiadfa2rmu s u4 rtoxo oytomDrai s t srumxopoy4lmte nct s)arrm(m no0aee moeildlm rlu o;(4trxnifctadop   u i;s setoio3iy1ap n fct t)a2um(ront0aetn iciyd mDemu s t)aeerir tytfat aieil(  rtoir3nydlle mivilt)a2rrxm nt0tpxn ociytlm2uau o t0tlxnmociadlm rauei s0s2urxrpny1ope  ivsls)a2urx o;t4oleoii3iytls em(mpnt4tleoif3totoatr n i;() rtr(m ny4optnlies ()sDururo;u0tptniietaslmDranmpnt) rtnmr tydopte uvi t) rtrxr oo1apeemncta() 2tmumoot0tex mi3tyd s uau s u0 lxnxfciadfpD aiesl( srxoxo ny1lm   fetat)s2tr(mp;o4tlxn oeiadlm ranmo;() etrmr io1lpDr iei;s0t2um(r3oudlm nlneilt srumuro;o0aex mfciasla2rmuvp;t4tlenif3oytfmDraivolt0t2tmxopiu1ape mfcs ( a2raxroou4altn f3tat sDrl(mp;u4aeeoircoo1oaDrlnvi;s0sexmiopoy4lptnmfetl(fsrrrxr ;t4tltnmfeildfa2ea( snu0 rtnmr3tatfpD  i i;s)trtriopno4opeelncs t  rum(rpno4texn feiat a rln s;t4aeenxoctodlaDeai ilt0srtrxr ny1opeemfvta(  2rax  ;t1apt  oeilsfa2umn p;t4 rtomf tatlpD  nei;s tetoxm oo4lm  lnvt tfa2tau o;o1tet mf3iadla rmumo;u4tlxrmrcta1fa   n o;t0srxoxmpio4lm   ncslt) Dtr(  nt0tlxnii3tadls umu p;t) rtnxf3totoatr nvi;s) 2um(r ou1llenmiciatfsrtrxm no0teto fciasls2uauvonu4 lerio oodfpt  nei s)sexoir io1llt mfeilt s2urx p;o1apeomietatls2rlu o t4 lerirctatoaD  ies s0tetr(opoy1optnlivt s a2tauro;o4oexn f3iltfmDul(mpnu)alxnxo oodlptelneo;s)s2tmiopiudapee fvs () Drau pou4oet  fctyt mDraumo;t)teeoxf totlmteaieo s) 2xrim3oy1ap nlivsas sDur(rp;o4aex  feiasfm2rln snu0aetnif3oadlaDeluei;s) ruoxm iudaltnmnvtls srrmurp;t1tpen ociatfa el( onu0teerxoctodfpte ivils s2um(o3iy4om elncsl()sDrmx  nt1oet ioctlslm2em( ont)altnxo3oydlm   i s s) 2urxo3oo4ap n fcsat) 2uru pno4aptn fctlt mDem( pn()alxrmo3oo1omt livi t t2toirpiodapt lfctlt  Dua( onu0aeeoiociadlm2emumon(4alxrmr iotomDeai olt)teumxopio1lp elfeias a2rm(mp;o4tlx  i3ils aDean o;t4texrif3iytlmt au i s  rtoim3iodomtn ieiasf rrax ont1tlt mf3iadls eln pnt)teerif ia1lpDr n i;t0t2xoxr3iodll nlictat)sDua(  ;t0texn ictat s2ea(mo;u0 eerxo oadlpDelneilt0setr(r ny1lpt miet s) Drmumono4tlt  fciyt s rm(vo t)aetrio oy1laD  iei t)s2toiopiy4op  mnvsa( aDraurono4aetoii3tldfsDra( p (0 etrif3tytfpte neil(0t2xo(m3io1al nlfesas  Dur(mpno0aeeoioeiyd a uauvs;t0alxrmf3oo1fa   ivo;t s2trxopou1opte iciltfsruau p;u1oltoifctls aDrl(mpn(4tleoiociodoptraieo;(0trxmxm3oydlmenmfcs ()aDurxm nt4aee mf3iys a rmnmp;t0aexnxo3oytlaD li il(  exmio3oudolt mfviatfarumxm ot1tpto o3tadfm2uau sn() lxrmo io1oaD lu sl(0sruoio3iudale lfeslsfsrraur nt1tptoii3tydla2ea(vsn(0 lxrxr tadopD lnvilt0teum(rpiudlpt  fvilt  Dtrx oou4alx iociyd m2uan o u)arerir3tydlm   uvs;t srtrio3oy1lmeelicil()sDtm(ro;t4olt mieiad m rmn s u0 rermr todfpD auvs;t) 2xm(o iodlltemiviasfsrum(  ou1tlxniicilsfs2rlumo;t4aetrmrciadoa   ies ()srumio3io4llenlfetlt  2rmu  ot0apxn ieiatlmDumu p;u4areoircoodlatrlieo s  rtm(mpiu4lme  ncta()a2rmxmpou1aeenioeiaslaDem( s u0 reoxo oytlpDranvols0tetmxo3oudlmtn ivi tf 2raxr oo1alxn oeiaslm eluvp t4altnxfcoodlaDe n sls)setrxo iodlle  fvs sfs2rmumpoo0tlenifctas sDeanvp;t0texomfcoadomt  ivi t sexrxm ou4om  mncia( aDuax poo4teeo o3iadlsDuln o (0aetoxf oodopDr u o;t0t2xrxopiu4apeelnvs (fs2um(mpou1tltnmietlsfa umu onu)aexoxr3to1lpt auvs s0 exmimpnydlp   nvs t  rrr(roou4altn fciadfa rmnvpnu4aetnio3oo1lmt  nvil(0 rxo(m3oudoltn ivtl(fa2uaxr ;t1alxomfetat aDemnvp;t)texnioctadoptelu s t)teuoir oo1ap  mfeil( sDurxmooo4tltnii3iasls rmn p;t4trenxo3iytfp rlu o t)t2xoxo no4aptelivs tfsrumu oou1teeomoetysfs2umuvsnt4aeeoxf iadlatelivils) 2xrir3no4oleemfviat)srrrx p;t1olt  ieilslm2rm(mo;u)tetomociytoat lies t  rtm(m3nydap nlnciasfa2umxmpno1texn ociyt sDua(mp;(0aexrxo3iotfmteluvi ( t2xrir3no4apeemnet ( aDtmumpno0olxoiocildfm2rmumsnu0tlxoir oo1fmtelnvo;t s2xoxo oo1ol   fvta()srtmxrp;t0oexnmocias mDeauvo t)teenio3oadlmtr ivo (  rtoir nu1ame mfvias) 2rax pot0openmfcils m2rluvp t0 lermociadoaDeliesl() ruo(opoo4amt  nvs s) rtmurpnu4olto icils m em(vonu4 rtoirctadop r neo;()t2urir ou4ap elncsls s2taum nt1texn ociltfsDean onu4 lerxfcia1lpteauvi;t texr(o3nu4alee feils) rraumoou4opto i3iyd m2rmnms t0 eenmf tytopDr u o (0 rxm(rpoodole miviltf 2tax  ;t4tlxnioeias a2elnmont0aleniocoo1omt luvilt0 etm(o3oodoptnmfvta()aDtrxroou0apt mo3iad a rmnms u) ltnxrctatlaDran slt s2xmxopny4llte feiatfs2trxmpnt0tpxn o3iydlaDem( p u0tetnmf oadoa elneolt0s2toim nudam nmivt s  Duau pot1teeomf3ilt sDuanvont0aeeoif3oodla elies;(0seuo(mpnudoltelfesltf Drau pot4tpt  fetldfa2ulnvs;()alenxf3tatoaD  u s (0 rxmxo ou1ap emnvs (fsrrm(m ot1tltnifetad s rlnmpnt0 rerio3oo1lp rlivs;t0s2toim3ny4ll   fes s srurxrpnt4aexniiciydla ea(vsnt) exomo tytfmD  nvol(0trxo(mpoodom nmnetls) 2taxrpoo4alenmi3iatlsDrluvo;t) etrircoodlat  ivo t trtmxrpio4ll  lncs t a2umxmpnu1oeeo ocilsla2rm(vo (0 etnmf tytomD  ivi;s)t2xr(m no4alenlnetat) 2tr(rp;u0alt mfcilt mDea(mo t0tltoxo iatlpDeaneolt  exmxopnudom e nct t) rraur no4aex mo3iydlsDra(vp;u0trenxf3totfaDelu s;s0teumim oy4optn fcs sfsrrr(rpoo1tpxo i3iysfmDuan on() etrif iodomtr ueols  2trir3no1ape  ivilt sDrr(mooo1tpenmi3tas m2uluvsnu4 ltrxr3todop r uvo;(0srtoxr3iu4ame mneil(fa2umurpno4tetoiociad m rl(ms t0 lerxr3oodfa  ln i;( trtrxo3nydlp  mfcsl(fs2tmu  ;t0opxo f3tld s2rlnvonu4aexnxf oadlp  lueil(0seuo(r oudop nmnes t) rumx ont1olt  fetat a2umnvpnt)artoir3oo1faD lnvsls) eur(o3no1am e ieilsfsrrr( pnt4aet iictytls2el( onu0 rtomf3ty1oate u s t t2xmir3iu1amtemfvsat sDtm(r ;o0tlxomf3tadfs rau s;() etrir iytlp  anes;s0s2xoxrpnydapt miet t) ruaxm ;u4tee  feiysls2rl( sn(4tlxrxo oo1fm rlueolt0seuoimpno4ol eliet tf 2tr(ro;o4aee iietyd s2emu ont0 ltnio3iy1la raieo t)sruoxm3oo4op nlnetlsfaDurxronu0oltnmo3tydfs el( ont0arerio ty1la ean o;(0t2tmir3ou1ol emnvia() rtmumpou4olxomfetlt mDem(msnt0 rtnircia1fa  ai i;(  exoxr oodamenlfesltfs2ua( pou0tpx ifeiysfs2el( ont0artrmfcta1fpteli o t  2xrir3nudom  mfvtlsf Dur(ro;o0apxnif3tltla2um(vp;t4texoxo oydoaDr neols) rtoim nudlltn nesas)sDraxr oo1aptoioetlt s2uaumo;(4 eermfciodfp rliei ( setmio oydopeelnei s sDuaxrpnu0oetnmiciad a2rlnvs;u0 renir3iotfp ran ilt) rtrir oy4oleelncta()srtmxr ou4aetnmocilsls umumo;t)arenxf to1faDraneslt t2xoxm iy1lmeemnvt (farrm( pno4apeomi3tydfmDrm(vp u4 lxnmo3oo1opD  nvs t  rtrim iy1llt mnesltfsDuax onu4tle mfciytfm2eluvp;u4tlermr todopDr nei t  2xrirpoudomeemivias  rtaxr ot0optniieiltlsDrmump;t4 rtnxf3to1lmD ln slt) exrir3nu1omeemncs sf rtr(ro;t4tpeomo3iad a2eauvs;(0tetrxfciodopt  nvi;t)teum(mpnodapenlfvia(  Duau pnt4oetnmictad a emu o t)aexrmo3totla rai ol(0teto(opoodome lfvi s sDuau  ot4apeo ieildls umuvs;u) rxomo io1fate u sl(0s2tmim iudapt lfvtlsf Dur(r oo0tle mo3ildfmDelnmo;u0alermo3oa1fpt  nes s)t2urir3iy4apee fvi t  2tr( pot4tpeo oeildfm rmnms;u)aetniocta1lptr ueo;()truoio nudalt  ics tf 2ua(rp;t1tex ii3iasfm uanmpn() lenxo oa1oa   ueils)trtmir iu4omee ici ( aDtrxmoot0tet ioeiadfm em( o u0 lxnmr3oydfp ran o;()s2toxopnodal  micilt a2taxmp;u4altnifeiytfs2umu p u)tlenir3totom ran o s0teur(r oy1ol nmfct t s2uau  no4oet ioetasfs ea(msnu0 rtoir tydlaDe uvi s)s2urxo nodaptemfct ()sDtmurpot1oltnio3tad s rl( s;u4texnif oo1fm   neo s  rxm(o oy1altnlivia(f 2rm( ono4opx if3tldfm ra(vs;u)teenmr tytomt anei;()seto(o no4ope  nvsa(faDtmu  ;u0olxomf3iad m2ulumpnt)tetoxociatfm r neols t2toxm3nu1ol  lfeia() Dum(rooo4olx mo3iyd a2um(mp u0 lerxr todfm r ieo t t2toim no4lpeemici tf Dtaumpnt4aeeomf3tldla2uluvp ()tltrxo tytoaDr u slt)s2xm(m3io4lptnlfci t sDuax  oo1altnmoeiydfs2ua(vo;u) eenxo iadlp elu s ( sexrim3iudll   ncil(faDtru  ot4olx if3ilslm2umu pnu0 eermrciatfmteai ilt srxrimpoodale mnetls aDrrumo;u1tpt if3tltfs ran p;() rxrxf ta1fm r u i t0 rxmirpoy1llenmfvs tfaDur(r nt1apxn o3ildfaDrln p ()tleomf tadoa e nei;s0teumxr nu4lpee nes s a2umum no0olt ioctldfa2uauvpn(0 lxoir todoatr ieo;t t2trxo oo4ll elietat)a2uaxmpnt4tpt ifciyt s umuvp t0 lenmr3iotlaDr i slt0sruo(m3iodam  lfctl()arrmxmpoo1aleo o3ilslsDrauvo;t4 eenmr iy1fpDran sl(  rtrimpio1al  lfctlt sDrrxmo;t1ale mieiydfa ua(mon(4alxrxr3oadlmDe neol(0trurimpnudlm nlies ( s2umx  nu4alxo feiat mDrm( p;()aeenxf3oytlmD  nvi ()srto(r oodlpe  icsa( arrm(m nt4tlxn ietas s2rau pnt0trxnir tadfaD aieo (0seuoir3nu1ape  fviltfaDurx  ot0tltnmf3iadfm emnmo;() rxrxfcoydfp rauvo;t teumxm3iu4apenmfetlt aDta( poo4opx mfctydls eanvo;u0tlerxrctodlm r nvolt t2xoxrpoo4lp emnctlt srraumpno1aleoio3iasla ea(vonu4texrmrctodoptrauei t t2uoir oy4oleelfcsatfsDrru oou4texnmoeils a2ua(ms () rtrir iodlm   nes;() eur(o3ny1amtn nesltfs2taumoou0tle  oeiys s2umu o;t0teenif3oo1oat an o;t0trtr(o ny1lmeelnei (f 2rmxm oo0oleoii3iys m elump;t4 lxrmrciydlaDean s t0 rtriopoudlptnlnvsat aDtaurono0open feildlm2ulnvo;(0artnio3oydoa  ai s;t0texoiopny1omtnmicilt srtrumoot1oeeo i3iydlm2em(mo;t0aetrxf3oatlmtr i ol( s2um(m3ny1op   netlsfaDur( pno0tlt  iciadlaDumumonu0 etnmf iadomDelues s0seumimpoodalenmnetat)aruaum ou4tptoii3tasfm el(vp (4tltrmrciydlp   ivs;s0s2ur(o oo1lp   ics t  Drru  nu0teeoio3iysls eanvp u)teerio3tytfm   n s;(  rtr(m3iy1ame lfvs sf Dtax  no0aeeoiiciltlsDea(ms u) rtoxo3oa1oat aues;t0t2toxo3iu1ole mnvs s) rua(r ot4aee  fctldlmDua( s;(4 eeoxocta1fpt ln sl() 2um(m ou1ll   neil(fa2rmxr ;o4tlx if3ild aDua(vp u)tetrxr iy1lm eln ils0setmxo3oy4lle  neilsf Durxm ;o0aeeoii3ilsfa em( o (0 exrxr oatfaDeluei ()setmxm3oy4ol   fcilt sDtr(r ;t0tlt  iciatla em(mo t) etnir3iy1omDrlivi t0 2trxrpou1omtnmnes s sruaumooo0opx mfciad m2em( p;u4tltrxf3iotomtrlies;t) 2umxopnodol emietlsf 2tax pno0alt ii3ildfmDeanmsn()trtrifcio1lp e i s t0trur(r3ou4al n fet t)s2raur ou0tle mfetasfaDrlnmp ()tlermf oadfpt aneo;t0t2trimpoy1oltnmiesa(  ruax  ou4tpe  oetlt s rmn onu)artrmociotfp  ln sl( trtm(mpoy1apt lietlt s2taxrono4olxo ocilsfm rauvsn(0aleoxf iydoaD lnvs s)s2trxo3oydlmee iesat) Dtrxmpno1aleoioeiadla ulu o (4trxnmr3oytfmDeaivil() etoio iu4ape micta(  rtax ono1tpeoifetltfm umn s;u)alxnif3tydlmt lueil()truoio3oydopenlnci tfs2ra(r ;t0alen iciad sDulnmo;(4altrmfcoo1fa   i i;() exm(opiodal nlnvtls srrrum ot4tee  ietadfa umnmo;t0 rxrir oodlm elnes;s0setmim nudoptemfetl() 2rr(mp;t1apxnmfcild m2rmu p;t4aexnmfcoadfpt  uvi;s) rxoxm3nu4lm  lnes s s2ra( ooo1tpe mf3tyd m2ean sn(0aexomo3ia1lateliei;()trxr(rpny4lltn nei sf Drmx ooo1aexn octldlm2rlums (4 etnxo3iatfmDe n i;()s2ur(mpiu4apt  icilt srra(rp;t1tleomietyd m raump (4tetnxr ty1fmD  u sl() 2trxm3no1lmenlfeia()srrruro;o1optomfeiysfa2ea(mo;u)artnif3to1fa  anvo (0sruoio3oy1lm   nvsltfs2rmu onu4tptnif3iatfaDea(vs;(4altrmrcoy1faD auei;t srum(mpnudlleemiesatf Dra(rpot4optnmi3ilt m ea(vpnu0 rxoifciotlaDr iei t t2xrxr3nodlmeemncsltf Dtaumont1oexoiicilslaDean o u0 eenmfcoatoa rai o;s0s2xo(r3ou1openlncs t) 2rax  nt0tlxomfciysfs2eaumon()aetoio3tydfmtrauvilt teur(rpiy1lm elnci ( s2rmurpot0oee miciytlm umnvs (0arenif ootfmD aivol(0s2ur(r nodom elneiltf 2raxmo;u4tlto feiydfm2eaumo ()teenir iadfm   uvsls s2umio3ny4lme  fesls arrm(rp;o1tpeniiciysfa2el( p t4 rxrxf oodoatr nvi;() 2ur(opio1altelici s) rua(r ou4aeeomo3tltls umuvpn(4teeoxf3tydlateln s s0trtoxm iy4lp e icsasfarrax ooo4tltnmietys m ulu s;t0artnio tadoateau i ()trtmxm3nydlme livia(faDuaur ;o4opx ifciadls rmn o u)altnif3iy1fm  luei;() 2tr(opio1oltelieslt srua(mp;o1alenmi3iaslmDelums;u0 rermocia1opteaneslt0setmxr iydlptelfvtlt arrru ont1tlxnmi3tlslaDrau p;(4tleoxf oytoptrluei;t  2tr(opny1ol  lnctat a2uru oou1aeenifciyd a2uanmpn() rtrmo oydlatrlnvi t trur(o3iy4op emfct tfsDurxmoou4tle ii3iltfm emnmp u0 eenmrciydop rlnei (0 etoio iy4olenlfvt (fartmur ;t1apenmiciltlmDumnvsnu) lxoio tadfp rlueolt0sexmiopou4lptelivi sfarrr(r ;o1opxnmi3tyd m rlnmon(4 rxrxociatfaDeai slt) exo(r no1opt  fetls)aDrm( poo0opx  octlt sDumuvo;t4tlxnmfcta1faD  i o s0 etmio no1altemnet (fsrrr( p;u1optnmoeiyslaDumn snu) rxnmrciydla  aivs;( srurimpno1lpenmnviat)a2tr(m ou1tet ioetasfa uanvp;(4tlxoir iodoat  u s;(0teumir nu4apt lneil(fsrumuroot1aptnmi3tld s2emn p;u4 rxnxrctydoptraivol()sexo(o oudalt  fei t a2umxmo;t4aeeo feiyslaDulnvo u4 eeriocoy1om elivo;(  2uoxopoy1optemivtatfsDtaur ot1tpeomf3tadfm2um(ms u0alxrifcoo1lmtraiei;(0 2tmxo oy1opee nei t aDrm(ront0aetoif3tltfa2ua(vpnu4teenmociadopDeaiei t sexmim nudamtnlnctls sDtaxmpou0apx mo3ias sDulnms;t)treomo3ta1fm rauvil(0seuoxm3nodolenlfei s sDrrumpnu4ale ifetysfm uluvp;(4arenir3ia1fptr i i;s)srumio3oo4am n fcs tfaDrr( pnu4tpx moetydfa2ulnvp t4treoir3tydfat lu sl(0 2xmxo ou4aleelfetltfaDurur ;o1tee iieilsls2uau o;u4tltomr iotomtrln o;(0s2xmxm3iy4am  mnct s)sDur(m nu0alxnmfctldls uan pn(4arxomoctatopte i i ()s2xrxr oo4ll   fvsat  rurum ou0tlxnmi3iadls ul(monu0 lerio3oy1oateli sl(0 etoxr iy1lptn fcsls)sDrm( oot0oetoiietadlmDrau p;t)arxrio3tydoaD luvo;t0trxrimpnu1lmeelivsas  Draur ;t0opt mociydlsDelnvs;t)aetoxfcoa1omt aivsl(0trxm(m oudamtelnvsasfaDtm(r nu4tlen icilt m eauvp t) lxomocia1opDe nes;(0s2uoxr3oy1amtelfeilt)a2rmx  ot4alxoio3iat sDumnmpnt)tltriocoytfpDraivi s sexoiopiy1alte ictlt srrru  ;t0alxo o3iys m2ua(vs () etrxo3iatopteai o;()setr(opnudop e neta(faDtrxrp;u4tltnmieias sDelu onu0aeeoxocto1om rluvo ( truoio nu4omtn ncs t arur(r no0apxo ietltla ul( pnu) lxrxfcoa1omD lu il(0setmio oy1llenmiviat  rua(ront4aexnioeiasfa2ul(vs u0teerirctatfpDeaiei;t teurir oy4aptnlietas arum(m ;o4ope  iciydfa2eluvp;()tltrmr3oa1late uvi;s) etoir oo1aptn nvtas) Duaxmont1tltnmfciltlsDum(vo () etnxr oodlatr n s (0 rtm(mpno4optemnct tfaDrrur ;u0oleomfeiasfa uluvp t) ltoxo tatfaDraueil(0truoxm oo1llt miesls)arumx  ;u4apeo i3ilsfm umnmsnu)altrmrctytlm elnvsl(0 2xoimpnudal elneilt  rtrxrpno1apxn f3iydls rmumpnu0trtrif tydlat an i;t t2toim no1optelfes () rrru o;o1aexomoetltfa eanvs;(4tleoifcootom raiei;t s2xmim ny1lmtnlfvta()aDua(ronu0tltnmociysla rlu pn(4teenioctytom r uvo;s0s2xrim iy4oltnmnes t s2raum ;o4oleoifetytls uluvo u4 etrmocoo1fmteaneils setm(opnudam nlfci s)srurxmp;o1opxniieiasfs rmu o t0 reoxo3oytlaDeaues s0trtmirpno4ole mfvias)aDraurooo1aexn f3iasfm eaump;()altnmr3iadlpDe u ilt0t2um(m3iudlptn ivs tf 2ua(rono1tptomo3iadls rmumo;u)artoxr oo1latr n sl()trxo(r3iu4ll nlicias)sDrm(mont4oex ioctld a2rl(mo;(0trxnmrcta1fmtelieilt  2tr(mpio1al nlfeia(f 2tmu o;t4opx ifciydlmDul(msnt4aexrif ootfmt  nvolt0teurimpnodlpt  icsltfaDrru  nt1opxniiciadfmDem( s;() lxnxo3todoa   n slt0s2xo(r oodomen iesa(  Dtaxm no4openmfctasfaDuan sn(4altrxr3totlp raies t) rxoxo3nu4open ncil()aDurxrpot1tetnifetytfmDuanvo;u)trxomo3tatfateli s;s  eto(m3nu1opee fetat srtr(m ;o4opto f3iadfa ean s;t)teeoxr ia1lpDrai s t  rxr(mpny4llenmivi s  rta( pnt0teeomoetldlm rmuvsnt0alxrir3io1fm   nvo;()t2triopno4ale  fetat  2rm(mpnu1tlt iieild mDea(vonu4 rtoxf oy1laDrlieol(  2uoio3oy1openlnvil() Dur(mp;o0tpe if3iltlm2el(mpn(4aetnmociotoaDrln i s0t2xmirpoodlleemfvsl()aDrmxmono0aexn f3tyd s ea(vp ()arxomociydopt lnei t) rtrxr3iodlp   ivilt aDtax pou1oexoif3iasfm2ua(mp;u4 lerirciodlm r ues t seuoxo iu1om   ictl( aDraxrpot1oeenio3tysfs2uau s ()tltoxfcoa1fp eai s;s seuoim3oy1altn netls s2tmur nt0ape  fctadfmDra( s;u) etnmf3oy1fp elnvi;(0trur(r3io4lp  mictatfsrtmx pnu4opxo octas m eluvs;u4 rxnir3iadlpDelnvs;( sexr(rpiydolenmivs t) 2rrurpnt0olxo feiadfaDel( s t4aetrir3oy1oaD aueo (0t2xmxopio4am  liviat) Dta(  ;u0apxn ieiys sDrmnvs;u4trxoxrctotomtr neo;s  eumim3iu4omtn fvilsfaruaxr ;t4tptoif3iadfsDrln pnu4tlerircoatfpDe ies;t0 2xrxo iudlm  lneta( arrmx p;o4oee  oeils aDran pnt)aeeoirctatlpDeai o;( trtm(rpiudapee fcil( srrru ono4alt mi3iytlmDuauvo t0treoxr3oy1om r ieols) 2toiopio1oltn ivils) 2umurp;o0tetomi3tydlaDrauvpnu)arxnircoy1fp rlueols)t2toxr nu1amenlieil(  2taxro;o0oee if3tasfmDem(vs u0 ltrmf ia1fpt  n i;s trxmio ny1ap emncslt) Dtmx  nt4alxnmi3iys m eln pnt)teenmr3tadoa rlneo;t0trtriopiy4olee ici (f rrrxmpno0aetnmieiysfm2ul(vp;t)alxrxr tytlpt luvs;s  etr(mpoy4olt  ict t sDtm(rono4olxnmoeiytfm uluvpn() lxrmf3to1omt livi;s0 exmim nudam  mnesasfs2ur(m nu0tlt mf3ildlm2rl(vonu4artnxo todla raivi;t)t2urimpiydapenmfeil(fs2rm(monu0aeeomicildls uaump;(0teeomf io1lp ranvo s0 rtoxo3nu1lleelietlsfsDuru pou4tpe mocild aDumnvp ()trxrxrcta1lp r ueol(0s2xrxr3io4optelfcils arrr( ono1alto fciltfs umuvs;u0aexnmrcia1lmD  i o;t t2umim3nodlle liesa( artaxmpnt1alen fetytfm2ulnvo (4 etrir iatlmtrlueo () etm(m3nu4openlfes ( s2tmurpnt1tetomf3iyd a el( p (0areriocto1fa eai i;t)t2xr(rpno4lp  lnvsl(fsDrrx o;u0aet mfetyt m umu s;()alenxocootopDr nvo;(  2umxm iy4lmeemieslt  Dta(m ;o0apxoiietatfa rluvpnu0teenmo tadom eau o s0t2xo(mpoudopeeliet (f 2tmu p;t1oetoiiciasla2rm(vp;(0aeerxfciodomDeaieo t0s2tmxr3no1apt mfvt tfs2ua(  nu4oeenioctaslaDemu p u)aetnmo ia1fa eaues;t0texmxo nodolenlfes (fa2ua( p;u1opx micildfa2um(vs;t) rtrir iodopDe i o;s srur(opno1al elfcs (f Dtaxmooo0tee mfciatfa ea(vo u4alxrmf3oodlm r i o;t)sruo(rpio4ap nmiei ()srrrxm ;u4aeeo o3ild mDum(vsn()tlenxrciytfm   i i t trtrir3iu4lpeelfeia(fsrraxrono4olxoifciys m eaumo (0 lenmfciydfmDrlnvi;() rurio oydlpeeliet () 2tmumpoo0tet mfeilslsDrmnvs;t)aexnmocia1fmDe i i;(0 rtmxr no4ol e nct ()a2rr(mpou0openioeiatfaDul(mp (0tetomr totomD  i o t0t2uoiopiodllt  ieia()aDua(ro;u1tltomfeiytfa el(von()tlenio3iydom  aivi t  2to(opiu4alenmivi (faDta(rpoo4olx  o3iadlm rmu on()trxnmocio1oaDr i o s setriopno1lpen ieil(farraxmooo0opxomoctat mDumnvp ()tleoifcoo1omt lues;s)trurirpny1am  mfvsl()a2ururo;o4tpenio3iltfmDeanvpnu0treoif3iytfm e ivi (0 rtr(o3oo4om  lnet s) Drru onu1oee moctasfa ul(vp t4 rtnif3iotlaDelu slt0sruoir3ny4lptelict ( a2ta(r nt1apenioeiadlaDea(mpnu4tltnmfcoydfmteai ils0 2umimpiu1ap nlnvs t)srurum ou4aeto ociysfaDuau p;(4altnxo3io1om rauei;t trxoio nodom   nvs t srrrxm ;o0oetoii3iatlm uanvs ()teermo3oodla  livolt  rur(rpoodop nlfetl(f Dtr(rpou4alxomoetlslm2elums ()tlxoxr totlmD  ivilt  rtoir3iudal elnetls) 2rrxrpnu0alt ifeiatfa ran snt4arxrxr io1fmDe u olt)sexo(m iy4amt mnct s srtaxmpnu1oeeomfciltfm rln o (4aexrmr iodlmte ues s0 exoiopiu1ole  fctlt)srumu  nu0tpeomoetldlm elnvp (4tltoir3ty1lpt au i ( s2uoxm3oo4om  lieta( srumxroou0tptnmf3ildlaDrmu snt4 reomo3iytomt  n o ()srtoxm nodole mnvsl() 2raurooo1altn ieiltfa2rl(ms;t)altomociydfm rluesls  2xmxrpoodalenlici t) 2rmumpou4tlenioeiyt m rl(mon(0teeomf3io1la ean s s)teumirpiodope  fcsat)sDrau  nu1tpeo o3iadla2umnvp () eenxociatla eaneslt  rxo(o no4omt lici tfaruaurpno0optomi3tasfsDrau s;(0aeeomr oodom raivi;()trxoxo3nu4lp   ncia(f 2rr(  nt0texo feiadfs2rlnmp;t4 etrir3oadfpDr i sls0 etrir io1opte ivs t aDrax o;t0tpt  fcilt s rl(mon(0altnmo3oytlpDraneilt)s2ur(rpiy4am nlicslt) Dur( ooo0altoifeiasfs em(mo u)alxnxocoydopDe i sl( teto(mpoydomte icsat srra(roou4tpxnif3ilsfm2rmuvsn()tlxoio oo1lmDeaneols0sexoxr3nu4ameelnvi () rrm(mpno0tpeo ieildfmDrlu o;u4arxoxf iy1fpD  ieol()seurxmpoy4om  mfcils sDrm( onu4aexomoctld aDem( ont0artrmo ty1fp r u i s  eurir iydoptnlfcia(  rrrurpnu4texo ieiys mDem(vsnt0alxoio iydopDrli s t0 rtr(m oo1om nliesltfs2tax p;t4tlxoiictaslm2rau p u4 exrmocoo1fp eaiei s0truoim iudam  lnvi s aDra(  ;u1oltomieiyt aDul(mpnt)teeoxo3iodlm r uvo;s0t2um(o oy4lpte ietlsfa2tru  ;u0tpe ifctyd s um( pnu4 lxrxr ty1opt  ivo s0 eto(r iu4al  micilt aDtax p;t4alx ifetlslaDrmumonu0 rtoif3oadoatrli o;t)t2xm(mpny4olenlfvtlt)sDtm(r nu4opxn fciaslaDul(vs (4 ltomf3totopteai i;(0 rtrxopny1oltnlfvtasf rurxrpno0alxo fciad s2rm(vo u0 eeomoctytlptelnvilt srtoxrpiy1al nlieslsfa2trx o;u0texnifciyt sDelumsnt0 exnxrcia1laDeli olt  exoxrpiy1ol e fcs (  2ua(rp;o1texn fetlslmDra(vo;u0 rtoir iotlatrlueo;s  exrim3oy4omtnmnes t)s2tmxmpou0oexn icils a2rau sn(4 exrmf3iydlmtr i il()t2tmio3ou1lmt lfcta(fsDuaxrpnt0aet  ieiyslaDul( pnu0 rerxf iadfaD  u o;( seumxm3nu4al emnes t)srrr(  nt4tptoio3ias mDum( s;()aeeoir3iotlp  lueols)t2ur(o nydoltnlivsas) 2tm(rpou0tlxoifctadfaDeln s t0 etoif3iy1lp r n s t) rtr(rpno1ale  nvtat  2tau pno4oleoif3tysfm2umnms ()aetomf3ia1lp e nvi;(  rxrir3iu4llte ictl()a2rau p;t4teeoiietld s2ranvs;() lxrxr3ootlat lu o ()trumxm iy1olee nvt s aDtmxrpnt1tet io3ild m elnvs;(0areoxocoo1lmDe n olt)teto(m ny1opte fesat) rrru pno0opx io3ild s2um( snt)trtrxrcoadoat  ivsl()srtrxrpoudaptnlneilt)arrr(mo;t0optnif3iytls umn s (0aetrxfciytoa  auvo;(  rur(rpio1ope lneslsfsDuaumoou4oexnmietaslm rau o;t4aeenir3oytfpte uvils) rtm(r3iy1ol   fvsls  2ra( oot1tlxn octat s2rmuvo;(4aeeoifcootlm  luvs;t) etrxr3nu4olt mfcs t sDrrurono1tlxomi3iasfsDrmump;()artrmociadfpDeau s t  eum(o no1om   feslt)srta(mpot0aleo ociasfs2uln on(4aetoio3iadomtrai s;(0t2urio3iydopt  ncs t aDtm(mont0tlx ioeiydfm2el( pnt0 ltnmrctydfaDranvi ( texrxrpno1lp nmnei s srtmxrpnt0texniiciydfmDrmu s;u4trerxr3iytfa eanesls0 2toxmpiydom nlncsls srurxmpot4aptnif3tatla2el( o ()arxrirctodfmD  uvo;s0srxm(mpny1op elnesa(f 2uaumono0aleomi3tlt aDua( p;t)texoif3iodopD liei ()seto(opou4lptnlfci s)a2trum ;t1tpe  o3taslm2ul( pnt)alxnmr3oydomt  ues;s)truoim io4lpenmfet t)s2tm( p;u0ope  feiysfa2rmu o;t4aeenmr3oydlmDr ivi (0 etoxr3iudlle  fcta() Dtax p;t0aee moeiadfsDrmums;u)altnmfcootom   uvs s0setoxr nodlptnmies sf rrrur ou0apen oeiysfm umnms t) reoir3tatoa eln i t  rum(o oy4al  lfesas)srtmur ou1tet ioeiyt a ranmo u4 lxnio oo1omtr n il()teumim3ou1lmenmncsa()arta(root1opto i3tad mDulnvs;(4 reoir oy1fateluei ( t2umxmpno1apt  feias artmurono0apeniieildfm2umumont0tetnmfcta1lmteaivi;t trum(r3oydlle mivil(fsrrau  ot1opt  f3iasfa umnvs;(4 ltoir3oadom  au o s seuo(o3nudolee ncil()s2trx  ou1aeenmicias a2ua(vs ()alxoxr3tadfpDeanvo;s  euoxopoudlme lfeil(f Dtmu  nu1tetomictld aDuaumpnt4teenxf iydfmDranvi (0trtr(r3ny4amtn feiltf ruru p;t4opto ieiadlmDranms;(4aetnmf to1la eaies ()trxoio oo1omee fesls)a2uru ono1tlt mf3iadfa um(vo (4trxrir3ty1lpD aneolt)seurxo3oy4lltnlietas srta( o;t1opto feiaslmDeanvsnt0texrmf oydlpt  uvs t  2uoio ny4apen neil( srrm(m nt0apxn ictas sDuanms;u4trtomrcia1fpDelu i;s)t2trxo3oy4ap  miesl( a2tmumono1tex mo3iytlmDum(msn(0 lxoifciytfmDrluei;( seuo(r nu4optnmiesl()sDtrx  ot4olxn octltfsDuan p u0 ltrxf ia1opt ai sls) eum(o3oy1altn ieilsfartrxr ot4altnmieiatfm2rmnmpnt4arenxrciodla   n slt  exoim oudalenmivt t sDraump;t0opto iciasls2uaumonu)altrxrctodlmteauvil()tetoxrpnudapen fvtl() rtau  oo4alenmf3tadfaDemn o;u0 rtnxr oatfmtrln ol( seumio3ny1alt miei ( s2urxr nu1olxomociydls el( onu0trtrxoctotomD  i sls) etr(opnudolt lfcil( arur( pot1apt  octyslm2umn sn(4 rxoif3io1lm rluvilt)seurirpoudlm   iesasfaDrrxm ;t4tptnifeilsla2ra(ms (0aexoxrcoy1optrau i;t0s2uo(rpno4apen fvsltfaDrrx pnu0apxoii3iadfsDulumsnu0tetnmr3iytlaDr i sls0teurxr io4optn fvtls)s2rmxr ou4alxnmo3iadfm rmu pnt)teermocootlaDrauvo;s0 rum(r no1ol emicsat) ruax o;t0alto o3iltla ua(vo u)trxoiocoodfat an o;s0 2xmim3ny1lm elnvtl(  rtrx p;t1tlxo ociatlm ul( p;(0altoxr3iadlpt aiei;s0sexoxrpio4lp n ictat sDrmxmp;u4tptomoctltfa rm(vpn(0alenxo3oa1lp e i o;(0sexo(m io4am nlnesat)s2tm(r ou1apt  icilsfm2umnms;u4 ltnxrciytopD  ueo t)t2xoim ou4lpee ivs sf rrm(r no1tetomoeias mDeaump;t4 leoxrcoy1laD lu slt trtmiopny1oltemivi s) Dur(r ou1tetomociadfm2rlums u4tetomociytfateaieil(  2trxr3nu4opee fvs (farur(  no4aetniieildfaDuauvo ()aeeoxo oodfm  lnvslt0 eurxopno4al nlfesat arumu  oo4oeto octltfs2ran p;u)alxnifcoo1fp  aieo;(0setmxmpoodaptemncsat)a2ta( p;t0oeeo oetydfaDeanms;(4aetrxociytfmDeanei;s) eurxr ou1ope lieta(farrrurooo1teenmoeiat sDuauvp;t4aeeoxoctotlm rai o t  rtoirpnudoptn ictl(fsDrmx  no1tpenmfetyslm2ea(vo;u4aeeoir iatomDeanes;(0s2uoir nydap emivt ( sDrru pou1tlx mictat aDeanms (4 exrircoydoat lnei;(  rxmim3no1ame lncsat srtr( oot4tpt  ieiasfsDeauvsn(0tlerif3iydomDraiesls srxr(m iudlm  mfvsa()srrm(m ;u4oetnif3tad s rauvont4aetrxf iatfm eaivi ()truo(m3iudopee ieil( s2tm(mo;t1tpe ii3iydls2emump t)arermrctydop eli o;t)trtoio oy4ape lfes sf 2taum ;o0tleo iciasfsDrlnvo u4tetomf3io1la   nes t  2xoxrpno4lm  lieil()aDrr(m ;o1aptnif3ilsfaDeanvp;u) rxnxo3oy1lpt anei t)tetrxo iudope livt (  2tmxm oo0opxn oetldlaDrmnvo;(0 rtnmo oo1fate uvil()setm(opoy1lmeemfct t)s2umur ;o0apt ifciadfsDemn s;()tlxoifcoytoat aneo;(0teuoxrpoodal  mfetlt)sruau  no0ope  ieiydfmDemumsnt) etnxo3ty1fa  lu i;t srur(mpno1ap  livt ( a2um(  ;t4aptnii3tysls elumsn(4tetoxo oa1lpte uvs;(0 2to(r3oo4aptn ieil() rrm(r ;u0ale micildfm2ua(vo;t0 lenir to1omD luvilt teurxmpny4olenlnes s  Dtaxr ot1oetomoctatls2ulnvo t)alenirctytoaD  n olt0s2toxm iy4openlict (f Dtax  oo1aptomieiat sDrau o;u)tltrmr tytfaD  ueo;(  eurxo3iu4omt licslt a2tru ono1oee mi3iltls rmnms;u4teeoif iytom raivsl( s2umio iy1lpt lnvilsfs2rmurpnt1ope  f3iad m2rau p;()aeenxr oytlp  ai o;s  rxr(m nydalte ivi ( a2urxm ;o4ope mf3iyt sDrluvs u)altnmfctytla  ai slt) rxoirpno4lle mnet (faDtrxm ;u1alxoioeiatlsDranmonu0 lxrmo3iydfm  lnes s0trxrxm3oodoptnmncs (fartm(m nt1alx ifeiyt sDum(mo t) lxnxr3ia1fpDeanvi;s0sexoxm oydlptnmnct tfs2ururp;t1aeenmo3ildlm uaumon()areoxo iadlpDr ueolt)s2xoxm3iudopt  net (fs2tau p;o0aetoif3tys sDumnmp;()arxomrcoydfatrln o;s) 2xrxrpno4opte iciasfsDtru  ot4oee ii3ildfs elu sn()aeerxr ia1lmDr uvi (0texrir3iodoleemictls  Duru  ;o0alxoifeiysfaDranvs u0aetriocio1lm r nvils) rxoxm iu4ap elivtatf Durumo;u0opx mi3tlt s emu o t0artnxfcoodlmDeaiei s0 etr(o oy1lpe lfes tf rtaur nt0altomfeilsfm2rlu on() rermf3iydom rlu i;s srurxr3io1lmtn fcta(fsrtm( ono0aexnii3iys s2rmnvont4 lxnxf oo1op elu olt trxo(m3iy4op emnvsasf ruau pnu1apeoif3ils m ran s;u0treomo3ty1optrlivs t0trumirpny1olenlivtl( a2raump;o0tleoifctytls ranvo t) lerif3todlmt lues ( srto(o nu1lpt lfei () rum(mpou4oeeomo3tadls emums;(0 lerio3todlmteaies t0 2trxmpoo4ome lfvta( srur( pnt0aeeomf3tyt a em(mo;u0tltnir3iy1fp elneilt)setoim oo1lptn feias) Dumxr nt4aeeomi3iad m2ean s;t4altomr to1fmDeaueslt0srtr(r nu1am e ivslsfsrta( poo0optn iciydfa em( s u4aetnxr oydlpt auvsls0setoxopoudal nmnvsl(fs2rr(  ;o0oee ioeildfm2um( onu0trenifcta1fpDr i o t  2xo(m oy4llt micsls  rururpnt4oeto iciyt a2el(vp;t) etrmo iatoptrlu s;t trtrxopoudameelnetas aDra( ooo0opxoiiciytfa rlnmp;() etnxo3ia1laDe u o t truo(o oy4lmee fct (farumxro;t1oltn ociytfmDuauvon(0 rtrir io1fa rlnvolt0srxmxr nu1openmicsa()s2uaxm ot1olt ifctytfs rl(vsnt0tetoir ty1fpDraivilt seurim iu4apt  ietltfs2ta( pnu1ale  o3iltlaDuanmo u)aeeoif3oadfateanvols t2umxr io1lme livs s)sDtrur ;o4opxnmi3iltfa2rmnms;(0trxomfctodlpt li s t0t2uoio iodaleemfvtls)artaxrp;u1tlxo f3iltlmDrl(vonu0tetoxrciotomD livo ( sexr(r oodol  lfeslsfsrrr(ro;t0tetnmfeiyd aDrluvon(4alxnmoctotfat lueo;s)s2xm(o iydlp e netlt) 2ur(rono1oltnifciltfs2ra(vsnt4arermr3oodomte i o (  rxr(r3iu4apte ics sf 2rm(rp;t1oeenmo3iad mDuln sn(0treoxf tadfa r n ol(0 rtr(r oodoltemnvsa() Dtrur ;u0tpxomfciytls um(vs;u0trerio3oodfmtelueolt0seuoxo iodlpte nci s  2ur(r nt1tltn ietls m um( sn(0 rxoio iydopD  ivs ( truoxmpiu4oltn neta( aDua(  ot0tpx  ociydfsDrlnvo (0arxnmr totomt au ol(0 2urxmpiy1lme  neias a2umxm ot4oleoioeiysfsDean s;u)tlxomrciadfpDrlu i t srtmxr3iu4llt  ivilsfsrtmxro;o4optoii3iatfa ul( p;u0tetnxociatfm eanei;s)truoiopnudlltn ivt () 2tru  ou4opt moetyt mDul(mp t)aexnmociotfpD  nvi (0t2uoxo3ny1lle mivsasf Dtm(m nu4opeoii3iad a rl(vo;u4aexrio3oodomteln ils s2tmxm ou4lp  lfvsatf rum( o;o0tlxn fctatfaDuanvp u) exrxfctadopDelueo;(0srxmxrpny4olt mnes tfa2tm(rp;u1opxomfeiyslsDrmu p;(4trxnif todlaDrai i s s2xrxr no1opte ivilt) Dtr(mooo0ape io3iltla2ran sn()arxrxf todfp raueo;s0truoxr nu1lmt licsl(f 2rm(  oo4open ietld mDrlnvsnu) eeomoctatoaDeliei () euo(o iy1alee iesltfsrra(r ot1tle moeiydlaDul(ms;(0 lenmf iydfmtr neo t)teumxopou4amenmivt t a2rax  nt0ape ii3iasfm eaumo (4tltrio3iotlp  aivils)s2toim io4om elict t)sDra(rpot1aetomociltlm rl( o;()trtrxociatopt au o () rtoimpou4openlfctatfaDuaxrono4oetnif3iydlmDel( o t4alxnxf3tadfp  luei t0trxr(r3nu4ap e nvsat)aDurumpnt1oleomieiyt m2elu s t4tetrxocoatlmDr u o;s0trtm(m ny1aptemfcil(faDuaxrono1tpt ii3iltfs uauvp t4alxnxr3iotfmD  uei;t seuoxr3no1opteliet ( aruaumoot0ope ifeias s ra(mpn(0texomr3to1lmDranvs;s)s2tmxo3nudlmtelivia(fa2rrxmo;t1tltnmi3iysla2el( pnt) renmoctodlmtelues;t0 rxmio ny1lmtnmfeta(faDtr(rp;o0aee  i3tys a2rmums;u)texoxfcty1om elivi;()srtriopoo1lm  lfes sfsruax onu0oetnmf3iasfm2emnvonu4 rxnir ta1lm rlneo ( setmirpny4lp emiviltfsrum(  nu0aet  ociyt mDeluvp;t4 exrif3oa1fptran s;s0 rto(r3oo1om   nei () ruax onu4tetomf3iltlsDrln o;u0 lenmo3oy1lptraueo;s  ruo(mpou1ll nliei (f 2rau p;o4tlxnif3ias a ul( ont4tetoxfcio1lat  i il() 2xrxr3iy4op  lictas)arur( pnu0apeoio3iatfa rl(vs t)aeenxfctytlatr i s (0t2ur(m3no1lpt mnvi t srrr( oou4tpe ifctasla2rl(ms;(0trxnmf iotla e ivi;t)s2uoiopnodlleemnetlt  2uaurp;t1alxomfeiatlmDemump;(4 eerifcty1oaDr i o;t)trxr(r oudopt mieilt  2uaump;u0opt moctldfsDrlums t) ltnxr3iotom eluei s0trxrio3io1olteliet s)sDrru pou0tpeo ictadfm2rm(msn()artoxo3iotomte nvs;s  2tr(mpno1ll e iesl(  rumxr ;t4aeeo fciat m rmuvo u0areoxrctytoateluvi t)t2xrxopiu1om emfcilt)aDrmxrp;u1tlx ioetadlm umnvp (0aetoiocootfat  ueol( texo(m3iu1alenlfvils arrmum nt4altomfeildfa2ua(mo;t) lxoircootoaDrau s;s) euoxrpiy4optemfcsls  ruaumono0alxo feiyslm emumo ()aeermf3tatlpDrai s;t) etmio nydaptnmivil( aDraxmpnu1olt mo3ildlm ul( o u4aeerir tydopDe u s s0teur(m3nodaltnmnetlt) Duax  oo0teenif3iyt aDelnvpnu) exnxo3iodfat luei t)t2xr(o nudale lfeslsfsDur(mo;t1oeenioeiatfm ua(mp ()aexrxf3iadlmt  uvils0 eurxmpiudal emiet (fsrraurp;o0tpenmfeiytlsDrau on(0altoifciadoptranvs ()t2tmio oy1amt  fvilt) rur(mono0aeen i3iysfs rln s;u4 etrxr io1fmteaiei;(0 2xrir oodaltelfcsa()srta( ooo4tee mf3iatlmDrl(vs (0aexnmo tatlpDr nei ( s2uo(m oy1op e iviat) 2urxmpno0tpxnioctatfs uaumonu0 eeomociotfatelnvsl( tetm(m3iu1ap e nvsa(fa2rmxm no0tex  oeiadfmDul(vs;t0 rtrxr to1fpt  iei;s)t2toxm io1lmtemics s srum(r ;t1alx  fciad a2ea(vo;t4aexrif3iodlp raues () euoxrpiy4omtnmivi ()aDtm(rono1tlt  i3tyt sDelnmpnu4artnif oy1lat livslt0t2um(rpnudlpeelfei ()aDumxm nu4tetoiieilslm2ran p t) exoxoctadlm rlnvil(0teuoxo oydlm   nei t arrauro;u4open i3tlsfs rm( pnt)tlxrmocoa1laDeauvs;s0sruoxm3nudaltnliciat)s2taxrp;t1tpxnmociytlm2em( s;() etrmociadlmtran s;(0trtm(opnudolee ivs (faDum( o;t0aleomietasla2ea( onu4aeermocoo1opDeaivsl(0 rur(r no4ale mnvtatfa2ta(mpno0aeeomf3iatfm umn s () eenirciotfmD  uvsl()t2toimpnudope mnvsas sDum( pnt4texnifeiatls2rlu p;(4trxoxfcoytlm raieilt)seumim oy4op n nvtl( arurxrp;u0tlxnioetyslsDrm(mo t0teeoxocia1lm elnes;t0 2tmimpno1ole  ieilt)aDrmx o;t1tetn ieiytfmDel( p;t4teerifcoy1lm eln s;s)tetmxo3iudamte ictls sruaxr ;t1ole iiciadla um(vpnu0aeerxoctydlmD  i i;s  rtmxr iudlpeelnet tf 2umxront4apxnmi3iat s2ua(vonu) etoio iotlpte ies;t0texoxm iydal elfesat  Dtrurpnu4tltnioctls m2em( sn(4 eenxfcoydlp r u ol() eumio3oydalt  fvsl() Duax pot4tpeoifctysfs2eanmp ()tetrir oydlmt aneslt)t2xr(rpiodlmenlfcia(  2rm(rpno0tlx  ociytfm2umump;()arxoxo iadfmDelnesls srumxo oudlp nlfeta() 2tru  nu1alen oetysfsDrm(vo t4aexoxo ty1fmt auvs;( texmim3ny4llt lfetl(  Dtmxmp;u0ope mociytls ea(mp;(0alxnmf iotlaDrln s s sruoxopoo4ap elnci tfsDra(  oo0teenmociydls2rlnmonu4 rtoxfcoatlaDe i ilt)teurir iydop  livt (f Dtmumo;t0olt iiciyt s2ranvpnu4arxrir3iodfpDeln s;() eum(o3ny1opeemnet tfa2raxm ou4olxomoeiyd sDran snt0tltnmrciodfptr ieo t0 2um(opoy1om n fcs s)artmuronu0oleo oeiydlaDelumpn()aexoif3oo1oaDeai s;t  2toxo oo1lmt  ictat  Dum(roou0apto f3iltlm uanvs ()aexrxo tatopt  n i (0t2toxo3iydaleelnci ( srumx ooo1ale  o3iatfmDel(vo;u) lxoxr oodlatelnvo s  rtrxopio1ape  fvi tfsrumxm ou0tltn f3tasls2rlumo t4tlxriocta1la r nvi;s s2uoim3nu4lpen ivsl( sDrmumpou0tlxnmi3ilt m ea(ms;t0 exoif iydlat aieilt0srurim nu1am   nctat)s2ua( p;o1oeeoifeiaslaDumnvp;t0trtnircootoat  ivols0seuo(r oydlm n fcs tfsruax pou4oet  o3ilslsDrmnmpnu0treoifcia1opD  i o;s0tetrir oo4apee fvtls)sDtrxmoou1tlt mieildlm2ul(mpnu0texnxf oa1laDranvi t0t2urir3oo4alen feia(fsrrr(r no0altoiieiatlm umumo;u0tltoxfctadlmte uvi t  rur(opiydape miesl()artr(rpnt4aptniietyd a2eanvs;t0 rxnmfcia1fmDraieo t)srxm(m3oydlpe livilt)a2trumpoo4teeomf3ils a2em( p;u4 etrmr3ta1fptrlivi t t2uo(r3oydop nmietasfs2rau p;u1apto iciatfm2rlums u4trerxrcta1fpt auei ()srto(o ou1aptn ivsatfa2uau  ;u0teeoii3iatlmDrmump u4tlxnmr3iydomD aiei (  euoio ou1om   nct (f Dtr(mo;t1aptoif3tadfmDem(vs;()alerxfctydoateauvs;()srxoxo nu4opt mnesl( sDumumpot4aleniociad s eanvo u4 exoxf oodlate ueols trtoxmpno4openmncs () ruaxrono1olenmfeiyslsDemuvs u4 exomo oydlp   neo s)texrxmpnu4ope mies () rrmur nt0apxnmi3ild s rmn o;(4trermfcootom  ln o;( t2tmxr3oo1omee ict (fsrra(m ou4tlx mfcils sDel(vp t)aeeoirciadlp e n ils0s2xo(o no4lpeemnviat  Drax pno4ole  ociyd sDrl(vs;u0aeenif3tatfp  an i s0truoirpoy1ap nlfctls srtm(mp;o1oex mf3tat aDrlnmp;(4 etnioctytom eaueols t2trxr iy1optelfctasfsDra( onu0tetn fetysfa2ua(mo;t0teeomo oadom  lies ( srum(r3iu4apen ivsasfa2ra(rpnt1tptnif3iaslsDrlnmp () eeomo3oa1opteaivils  rum(opiy4omtemieiasf rua(  nu1apeomi3iadfsDean o t)artoio totla r i il(0t2tm(m oo1altnmiesls)aruru p;u4apeomf3tlsla2elnmont4aexnxocoytfaD  nes;(0srtrir3ny1ameelicslsfsrtru  ;o1oet mf3iat a2um(ms;(0aetrmo io1lm  anvs;s0trurxm oydamt mfvias  2ra(mpot0tet  o3iytlaDemn p (0teermo ootfmDrlivols)s2toxr no4omen fvtatf rra( oou4tlxo fctat a umu p t4artomo oydoa  livi t0 2um(m3no4amtn ivi t) 2tmum ;o0tptnmf3ilsla2ea(msn(4 ltriocta1la  aneil(0setoim3nudam  mivtasfaDtmx poo0altn feiydfs ea(msn(0 eenxo3iotopDelivs t)srur(rpny1op emnvsat)a2ururo;t0tle  f3iadfsDeluvp;() exoifciotlpt  i s;s0srum(mpoy1lm nlfviat s2rrurpoo0opeoiicildfa ra(ms (0tlxrmocta1lpDraues t) etr(m iu4op n net ()aDumump;u4oexnmf3ild m2rl( o (0teenmfcoo1omDe ivi;()s2xmxrpny1opeelfei (  2uru p;o1tlx mieild a2um( p t4tltoir tadla eai ol() euoxr3oydopenlnvslt)a2uru ooo4olto ieiadfmDeauvs u0alxoir3ootla rlivols0srtrxmpnu1op elneta(f 2rm(r nt0opx  i3iadfs2rm(ms (4 etoif3oytlm eliei () exoxr3oo4om n fvsa(fs2umxr no1oet mociytfm ul(ms;t)alxnxrcoadopD  uvsl() 2tmxm oo1lm e fcslsf rrax pno1aeeoioctaslaDrauvon()trxnxo ta1lm r nvols)trtmxr3iy4opte nci ()a2rr( pno1tleo iciadlsDea( on(0altrxf3totoa eln ol()sruo(r oudlmenmfvtlt)s2taur ot0ape moetltfaDumums;t0 eeomfcoa1laDeln o;(0teum(r ny4lmtemnvs t)s2umu pnt0altomi3tldfa2ranmpnu) etoxr tadlmDeliei s) 2xoxopoy4lleemnvta(f 2um( p;o4oexoiictltlsDumums t0aexnmf oodfpt anesl( sruoxrpoudlpeelietatfa2umxmpou1alto feiatfm rl( p (4aeeoxfctodomteliesl()setoxmpiudlpt mnvsltf rtm( p;u0oleoifeiyd s ulnvont)alxoxo3ootlp eaivs s0srto(r oy4apeemnci s)sDur(mpnu4ape micils m rmnmp;u4 lxriocia1oatr neo s)s2urxo3iodlltnmfeslt) 2rrurpnt0tpe mf3tyt a2uanvpnt4tlxnxo iydoptr ueo ( teurim iydopt mnviasfa2taumont0opxnmiciltfs2rlump u) rermo tytlat aues t s2tmio3no4alenmnct ( sDua(mpno4opeoifeiytlmDrl(vsn(0trenir ia1fpt an olt0sexoxo3iy1om elncias  rtm(mo;u1opt ii3tlt s rmuvpn() rtrxr3iytlpDe nes t0 exmxr ny4am elfvt sfartmumpnu0opx  o3iydlsDelu o (0 etrmr oa1fm  ai sl( setr(rpoo1amtemfcsls)aruaurooo0tleo feiyslm2ran snt0 ltnmocoytoat lues;s0seum(rpiy4ll emietlt  2tr(moot1tltomfcildfsDrmumpnu) lxnifctytoa e nvi (0srumir oo4lmee nviasf rur(mo;u1opxnii3iadfaDrlu p t4 renmr3oydlptrln o s)s2xoxmpny4altn nesa()s2uaxm ;u0tet miciydfmDrl( sn(0 ltnmf3oadfm  lnvo;t)trum(o ou4apenlicia( a2umurpoo4oee  f3ias s2rmu pnt)tltomo todoaDr ieo;t)s2xoimpoodom n nvsas  2uru poo0alt  oeiatls2umuvo (0 rxoif ta1fmD au o (  exoxm nydolte nei s)arrrurpnt4tptniictydfaDraums (0 lermrcio1oaDelivs;() 2xoxo no1lmt lfctlsf rraur ot4olenioeiytfmDulnmon(4altoxrcty1oaD  ieo t)setrxrpnodlptnmicslt) Dtmum nt1oeeo ietysfm em( o u)teeniocoodla eanei;s  exmirpio1lmt lfvtat s2tr( o;u0teenmoetltlm ranvsnt)altoio3tadfpDrli i;t0t2xmxr io4lp n ivs ()srurxmo;u0optoifetasfa um(vo (0 etnmoctadlp rau o;s  exmxm3io1al  lfvs t  rrmx ont1tpt  ictad sDum( o;u) etoir3oodomDraies;s  2xo(rpno4ap nmfeta(  Draumpnt4tlxo i3iadfmDra(vpn()aeeomo iodfp eluvs;(0 exriopno1openlieiat)s2ta(ront4opx if3tyt m raumo;u0 reriocto1lp  auvs s0s2trio iudam n ivsas s2urumo;t0opeo ieiatlm ua(mo ()trxoxrcio1lp  lu i (0teur(r ny1om n ieslsfs2rrx oot0texomiciad m eluvs;u)alenif ta1fm rlnvolt0 rtmir nodllen fviltfaDurum ;o4tltomf3iltfmDuauvs;t)tlenif iytfp eln ils  exmxr io1om emnctltf Duax  ;o4opxniociatla2ra(mo u4 reoio oo1lp eauvolt srto(opiy4ll nmnvi sf Durx p;u1alxnmoctysfaDemnmsnu4 etoifciadfaD aneol() 2xr(mpoo4lp emfeiltf rur(rpno4tptomi3tlslm umn on(0 etrxfctatfp rliesls0srxm(m ny4lmtemfcsatfa2ra(r nt0ape ifcildfaDea( s;u0tlermocootoa eauvo;(  euo(o3oy4lpenmivtasfaDurxmooo4alen ieiytfa2rlu pnt0tlxoxfcta1omDean o ()srto(r3nodlm   ivi (faDtrxrpnt4tpxniiciys mDra(vonu0artrirciatlp  aueils t2um(m3ny4lpeelfeslt)srrr(r ;o1oex  ocilt s rm(vpnu4 rxoir ta1omD auvo (0truoio3iu1ap n icias)s2tmx  oo0tpeoioctadfm ranvo;u)artrir3iatlpDeaues ( srum(m iudll  mivil()a2ra(  nt4teeoioctytfsDrm(vonu0altnifctotfpt  nei;t) 2trxm iodam nmfvilt  Dtr(moou4opeomfcils mDrmump;()arxnio3iodfptr nvols0sexoio oodopt liesl()srua(mpnu1ale iietad a2ulnvo;(4aetomfctodlpDrlieo;s) etm(m3io1ameelfetas  Dtaxmpou4apx  o3tadlmDel(vo t) ltrxoctotlm e n i;t s2xm(rpoy1ap nlici tfsrur(r no0olto ietlslsDumnmpn(4tlermoctytfptrlivi (0 exmxopiu4op nmfvils)srtmx pou4oexoiiciaslmDrl(mont)aetoxfcoo1lm   n s;s)srxo(mpoodoptn feil(f rrm(mo;t4olt iictlsfaDrm( o t4tlenmocoo1oa   ivs (0 rumirpoodamtemfesa( s2tmurooo0oltoioeild mDumnvs;u)artoioctotopDr i ilt0 ruo(m3oo4ll   nctltf Dumu ont1tleo fetlt a2rm(ms t)arenio3ta1lmteai i ()teurxm ou4om n fvi t artmxrpnt0tlenio3tytlsDrm(vo;u4teeoir3tytlat anvs;(0 2umirpno4lp nmnes sfa2ra( poo0apeoifciadfmDumnmon()altnio3io1opDr i sls) 2xr(mpio4ome mfvslt)a2umurooo0ape iocildfsDemumsnu) exnxr totfmDrlnei t0 rumir3iy1lpe lietlsfarumu  nu4aeenio3tatlm uanmont4treomfcoydfmtr ueol()t2xoiopno1lptnmncs tf ruaxr ou4ale mf3iyt m ranmo;t0alxnircoatlaDr ueo t) 2ur(opio4alee nct () 2raxr no1opx iieils s2ulnvo;()arxrif3io1optrau i;s s2xoxm oy4altnlnes t)aDum( p;t4aetoiictytls2uanvs;t0 exnxocoytoa  livsl( s2xmxrpiydlptnlfvi () Dtaxmpou1aexo ieiys aDumnmo (0 rtoio oydlaDelnes s)sexr(r3iy4lm nmncsltfsrrrum ;o1oex  f3ilsfaDrmnmp;u4tlxrmoctodlaDeanei;t0trxm(mpiodame micta(fsDrrxro;o4olt iiciltlsDua( s (0 rtoio ia1oaDraivo s seuoim iudlm  liet () 2rmx  no1tlxomf3iyd aDulumont)aexnir3ootfaD ln o t0teum(opiy4lpenlnes ()sDurxrpot0olenmfciasfmDrmn o;(4 rtrif3iadlmDranvs t texm(m nu1apee feils)aDuru ont4olxomi3iasfs ra(vp t)aexrxf todla  an o;t  exmio3oydlpenlnctas  rumurpot4alenmietat sDrmnvp (0aetoif oo1oaDeaneo;t0 eumir3oy1amtnlieia( arurxrp;o1opx iieiadfs2emn s t4 renxo iydlmDrliesls srxmimpou4ap nmnviltfs2uaxmp;u1olenio3ilsfm2em(mo;t0 rxnio ia1la e ivolt) euo(opiu1alt  ivi ()a2rmx  nt0tlto ietltlsDul( pnt0 eenmocoy1lpt livo;s0trtriopny4omte fes t)srtru  oo4apx miciys s2rmu onu0artoir iodopDeaivs;t s2xo(m nu4lptelivs s sruauro;t0tpeoiiciyt m eau p u) ltnxfctatomt aivslt0 2uoxopou4llt mietlt)a2tm( pnu1alxnio3iltls elumo;u4 etnxo3oytlpt anvs;() eumxm3ny4lltn nvsl(f 2uru  ou0tpen fciat mDelu s;u)aeeriocoadfm  auvsl(  exrio3nu4ape lnvil(  Drm(  nt0tpen fctydfs2ua( o t)teeomr oadopt li ol() 2xm(rpiudlp nmfcs (fsDraxmpoo0openiiciat a uau s (4trerir oatom eauvi s seuo(rpoy4lpt  fet (  rumxrpou1oltnmfetadla eln o;t)trtoio3iytfpD ln s s0 ruoiopou4lmtn nesa(fsDumx pot1tptn o3tlslsDul(mo ()trtoxr3oo1fm elueilt) 2xmxopiydolenmnvil()a2rm(r no0teenmictltfm2um(monu4 rerif oy1faDr ueo t)trtm(o3nu1optn nct tf rta(mo;u4tpeomf3iytfsDua( sn(0aleoxfcto1omteluvolt0 eto(m iodll nlnvtatfs2rm(r nu1ape  f3iydlm2rauvsnu4aetomf3iotop rlivi s s2uriopoy1olenlneia(fa2uaxroou1tpto ocils sDrlumont0 etoxo3oodlmte nes s trxr(opou1ame  ncs sf Dur(r ;o1tpt  ocilsfs uluvs t)aexnir3iatoat lieo;(0s2tmio3nu1lmtnmnvta(farurx p;o1tee  oeiatla umumsn(0 renxfcoatfp r ivolt)trxm(r iudapt lnctlsf rrm(mo;t4aptomieiltlmDel( p;t4texnmf3ia1lm raieols)t2toim oo1am nlnctls aDum(mpnt1olto o3iltfs2umuvsnu0arerir3iodoateanei;()srto(rpio4apt mneiatfsrra( p;o0apx  f3tld aDeanvo;t4teenmrcta1oa rau sl( s2uoxr ny4lm nlivta( aDuaxr ;o1ope  ociyt mDemums u)texrxr3oa1lp eai s s s2um(r io4ope  fvsatf rtrxrpnu0alt  f3iydlmDean s t)tlxnir iy1omt ln o;()t2trir3oo4lmtnmfeias sruau  ;u0aexoioeild aDumu s u4 rxnxr ta1fm rlneols)s2tm(o3oodllt lnvtat) rtmu p;t4aptnio3iatfs rlnmpn(0tetnmocootfm rluvil()trxm(o3ny4lpenmfcilt) 2rm(rpoo1olx  oeiatfs rlnmont4 etrifcio1op e i i s0 rurxm nydomtnmici (fs2tmu  nu4apxnifetyt a ul(ms;()artnifcty1om   ueol()t2tmxo iydam elncsa(  rua( o;o0tpxniictadfs ua(ms t0artrmr tydfm r uvi s0texm(m oudlp emnvslsfsrur(rp;u1alt iiciltfaDran o (4 etrxo3totlptrli olt) 2urir3ny1ome  nvil( s2uaxm nt0tpt io3tatfs2ulumo t4tleoxrcty1omDr ueilt0t2xr(opiu4lptemnci sfs2rr(mont0oeenmociysla elnmsn()tetnifciy1opDrlu ol() 2xmim3ny4aptelivi t a2rax p;o1tlenifctltfmDemnmp u0tlerif todopDeaivils)s2toio io1altn nesltfa2trumpno0aptomiciasfa ulu p ()tltrmo3oatop eauvols0t2toxrpou4apenlfeilsf rurxrpnt1oexoifciyt a em( p t)aexoxf3iodop rlnvs t  exr(opiudol  mnciat aDur( p;o4texoioetasfaDrluvo ()trtrxo iotop eai o (  exm(mpoo4omt mnesat aDtr( o;o0tpxnmfcildlaDelu pnu)aexoioctotop e nes ( srxmxo3iodamtnmfct s) Dra( p;o0opx moctat m2uauvo;t)areomf ootoptr ueo;s0sexmxm3ny1lm  mncs t s2rr(roou1oltomoetls m2rmn s;u0 leoxr3oodlaDrauei t) exmxr oudap nmnvsl( sDuau oou1tltniiciysfa2eanvsn(4artriociotfmteluvilt seum(opoy1ole lnvi t a2raurp;o0tptoiociadlm umnvp u)texoircty1fat lies;( trur(o3iy4lltelfcias)arrru ont0aeeo f3ias a umnvo ()arxnmr ootfa  auvs t t2umxo3oo4ol elfes (faDrrxrpot4tpx mfeilsfm rm( snu0 rtnmrctotfmDelnvilt teurir nu1lmee ivt s)aDraxr nu1olxomi3iatlm umn snu4trxomociytfaD luvs t0tetm(rpiu4ap n fvtlt)s2uaxr ;o1tlxomfeils m2ua( p;t4 rtnmocia1fpDelneil() rumxm ou4omtnmfeias) rrru  nt1aeen ieilslmDuanmsnt0 etnmocty1fpt  i ol(0t2to(r3io4apee fcslsf 2uauroot1altnmo3tltlsDrlu onu4aexomr iytla r ivo () 2tr(r3ny4ap  mfcias arumuroou4ole io3iad m elu o;()aeermfciydlp  lueslt0t2xr(r3ny1opt lietl(  rua(m ;o4tpto fcilslm ranvp;(0altoxf3io1lp ranvs () 2urxr3iodap emfcia()sDta(r no4tetomoeildla2uau ont)trermf iydoaD lneo;s0s2xr(o3io1opeelietas)sDtm(mo;o0ole  icils sDua(mo;(4 etnxf3ta1omtr nvi t sruo(m3oydllenmfctl()srumx o;t4ope if3ild aDua(vo u0trtrxo iadfmteli i s tetoxm ou4lm nmfesls)sDuaur ;t4tex ifetldla eluvo t4 lenif oodfpt aneolt srur(r oydllenmnvi s) 2umu ont0aexnifciysls uln s u4teermo3iydopD aneo (0srurio iudolenlfcilt aDrm( o;o0aexomi3iytlm2ua(mp u) rxnifciodfp  li i;( srtmir iydalee neias) 2tauroot1tptnmfciatfa2emums ()trtoif todfatrli s;t t2xrxopny1al  lfctas srur( pnu4oexn o3iys m ulnmp;u) rtoxo oa1oa eau o;s0trxrxr oy1ope mfcs t)sDrax ono1oltn ietytlmDumnmp;u)aexnir iydom  lu ols trxoio3no4am n ies (fsDraxmoou0ole ioeiad m eluvpnu4altrifcoy1oate u s;s sexm(rpno1llenlicilt) 2uau  nu4olt ifcildlaDrmnvp t0 eerxrciodomD aies s)t2xmxo3ny1apen iei ()a2rrxrp;u4tptoifctadfaDum( s;()altnir ootfatelivolt)srxoiopiydlmee ieslsf 2um(mpot4tpeniocilsla2ulums;()treoir oatlpt aivol(  exo(rpnydol n feiat  2uaum ot1tlxo fciyt s rlnvp;t4tlxnxfctytfpD ai ol() rtmxo3nydam nlieil( arrrurpno4oex miciat a2eanmon() lxnif tydfptr nes;s0 2tmxm3io4apee fvi (f 2tmxrpoo4apto octydfa2rmuvont)tleoxo3iodop eaies s0 rtr(mpiudol e iesas artrxrpnt4aet  iciadfm2uanvsnt0aexrircio1oa
\ No newline at end of file
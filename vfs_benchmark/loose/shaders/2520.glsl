@@ -0,0 +1 @@
+u i;t0 2tr(mpny1lpe mictlt)aDtrurpnu1tlx if3tydla elnms (4tltnir3todlpte ivi;(0tetr(r no1ap e ici t)sDtaur ot4olen f3ias m2ea(ms ()alxnxo3io1fpD an i;t) etm(rpiy1al   ncia(  2rm(m oo0olx io3iltlsDrau o u)trxnxfciy1la e nvslt) eto(m iydlp e fvi t)sDrru p;t4opx ioeildlmDua(vo t4aetoxociotlmtr ivols truoxr3nu4alenlnviltf 2trur oo0tle ifeiytls2ulums ()areoxf iotomDr neo;s0 rtoxo no1op nmncia()srta(r ;u4teeoiieiat sDean pn()artoio ty1fm   ivo (0t2xrxm nydal n fvt t)a2rr(moou4oetn o3tls m ran snt4 lerxfciytom  lnes;t) exrxr no4llt mfvsl() Dtmx  ot0alx  iciltls ea(mp;(0 lxnmr oadfmDeln i;s  etoxo ou1lp elfetls)aDtrxrooo0texnmfetltfa rmums u)tltoif to1omteln i;s0 ruoio iy4lp n ncsls)sDua(moou4aetoifeiysls ua(vs;t4tetrmociydla  lnvsl()s2xrxm3oy1op  mfcslt)srtr(mpnu0oltomociat a2em( p;(0aeenir iatom ean s t)teum(opoy1apt  nct t arrr(mo;o4olt io3iltla uln pnu0 leomfcoydoatr nvsl(  rxrimpiu4ale lnes (  Duax ono4altoio3iydlsDuln onu0tltnxoctodoa elneo;s0trto(m oudol emnvtasfsrum(  nt0optnmietas sDuan s u0 rxrmr3totopDeauei;(  2uoir3nudlp  mnetls)srrmxmpno0aeto ietls aDelnvsn() ltnmfctydomD  uvi;s) 2tr(o nodlptn fcsas srrrxmonu4optomi3ias m2eanmp u0arerifciadlatr neils setoxo ny4lltelfvtasfsrrax p;t0oetomi3iysls2elnvsnu4 reoxfcta1fmtelueo;()srxmxopnu4ll emies s aDrm(mpot0opx mi3iaslmDem(mp;(4 lenxo3iy1fpt ln olt t2tm(rpiodlmee ivtlt s2uaumont1tptnmoeiydls rmnmp u4arenmociytfatrlivo t srtm(opou4apt  iet sfa2ra(rpoo1tlxnioctasfs rau ont) lenir3oatfm   uvo ()trtr(rpiudalt  fct s)aDtr(m ;t1ape ifciltlaDrlump;(0teeomf ootop  aues t0srxmio3nudaptelncsl(  rtm(ro;t0tleoiociadfm2rm(vpnu4artrxrcoodop   n o t texoim iodam nmneia(  Dtau onu0texn ociadla2em(vpnu4 lxnmr ia1oaDe i s t) exrxrpny1oleemietasfarrau p;u1tetomo3tatla2ra(monu4tlxomf oa1lmDr u o;s0sexm(rpnodlle mietasfaDuaxro;t4tlx  ictyd s2eln s u0 etnir3ootfmt  neils0 rum(o iudlmtn fvt sf Dtax pnt4apeo f3ildfmDem( o u4texnifctadlm elivol( s2xm(mpou1opt lnei s a2rmuroou1apto ieiydfsDranvo;(0treoifcta1fmDeanei s0sruriopio1aleemnes tfs2rr(m ;t4tlen i3iatls2ea(ms t0 exnif ia1fa r uvi;t)teuoxrpiy4lle  ietl(fartmx o;o1tlen i3tys a rmnmonu4 rxrxf ta1lpteluvilt0t2uoxr oodamtemfesls) Dtmx o;u1teen octadfmDraumo;u) rerxfcoytoaDraues;t0seuo(o no1aptnlicsas)aDra( o;u1opxo i3tydfa eau p () eerxrcootoa  lu ils)teur(r iu1lpeemneil()aDurxmp;o0aetoifcildfs2rl(vs (0arenxrciatoaDraies s t2umir3oo1llee nvta(  2tr(ro;o1apeoiocildfs uauvpnt)tltomr iy1omDe nvi ( t2umxm iydlmee fesl(f rraxrpot1oeen i3tat sDeanmo t4areoircoy1lp r uei;s)teurxopnu1lme  fcia(fsrrm(m ot4oet mociys m2ul( s;(4altoxfcio1omteli s;t0teurxrpiu4ll e fcslsfs2uaumo;u4altnifctatfa rm(mpn(0texnxfcoy1fatrlneo ( seur(opnudomee feiltf Duru ono0olt moeiydfs el(vs;(0alxoif tadomtrlivslt0s2trio3iydlpt  icslt sDtax p;t4aet  o3tyslaDumnvonu4tlerif3ia1oaD aueo;t0 rxmxm3nudom  licsl(fa2urx oou4tpx  oeilsls2emnvpnu4tlerxr iydop   u i s0trtmxmpiudalte fvs s)a2taxmp;t4tpto fetadfm rlnvon()trenxr oy1om rai s (0 2tr(rpiy4lmtnmics t)s2tmumo;o1teen ieiltla2rl(mo (0 etnio oy1faDe nvi;s) rtm(m oydlm   feiltf rrmxr ;u0tpe  icildfaDra( p;() lermr iatlmD  n s;t) euoim3io4omenmfvia() Dta(rpoo1oeenmociatfa em( o (4arerxo3iytfm   uvo s)teumimpno1aptnlnvt t a2rr(monu1tpe  fctatlm uan o u)aeermr tytom rlieo (0srxrxm io1ome lfvtlt  2ra(ro;u1aee  icildlsDua(mo () ltnxf iodfatraueil( t2xrimpnu4lle mieia(fsrrm(rooo0alxniocils s ra(mpn(4aleniociytfm e ivsl(0t2xmim io1oleelfcil( artrx ont4alto fctyd aDrluvp;()artoiocto1laDr u o s)s2urxo ny1omenmietl()srtaum ou4texoifciatfs2ea(vont4 exoxrcootfpte ivi t0srxo(o3iu4alt  net t s2ur(mpno4oltomieilsla2rm(mo;u)arxrxr3todomte uvi t trum(r3iudameemfeslsfaDtaxmpnt4tptoioeiadfmDeanmo;(4 lenio3oodom  ln o;t srurir iudamenmfesls aDumxmp;t4alt  o3tytlsDuanvs;u)aexnxf totomtr u i;(  eumxo3iu1lltelnvi (fsrrmx onu1tpe ii3iyt m2ran sn()arenio3oatlatrauvolt  etm(m oudopt mnvtls a2ra(ront4ape iictasfs2el(vs;t4altrif ia1fptelieils0 2xmim iy1lltnlncs tfa2rr(rpoo1aetomfeils mDra( p;(0tlxnmfcoy1fmt ai o;s)trxo(rpnu4lpte fvtl(fs2umu o;o0ale ifeiysfs2rluvs u)altoioctydomteauvolt  rtmxr3iy1oltnliesltfs2umxrp;u4tpt mf3iytla2umn sn(4alenmocoodoat anvi s  exrirpiudlpenlietas)aDuaumpnt4apen icilsfm2umumpnt0 exnio iodlpDr ieolt)trtr(r3oo1lm   feias aDtmx  oo1apt moeiad a uan o;u4 eeomr3iadfa   ivo;s) rtoimpoy4llee fvtltf ruru p;u1ole  f3iadls um( sn(4teenxrcoa1lmDe nei;t0 2to(m3iodlleelivsa(fa2tr( pnt4aeenmfctydls2um(vo u0 reomo iatfaDrlueils  exoim3oy4lpe lfesas a2taurono1alto f3iysfaDelu pnu4tltnmrcta1omDe neo t s2umxmpnydomtelfvt ()arua( p;u4texo ieilsfa2eluvo;t)artomf iydlaD aiei;s) rurim oy4apt  feilt)aDuax  oo1aee mf3tytla2um(mont4trenmo3tydlpteluvo t trxm(m3ou1op nlnei sfarurum nt1ope  i3tasls rmnms;u4arerxf3oadom eaivi;s  2xoim3oo1lp   ivil(fa2umxm ;u0aexoioctadlm2ul(vo;t0tltoir3to1lm e ivol( seurir3nu1om n fesas arumx poo0tltoioeiad a rmnmp;t) lxnxr3iodfm elu sl()s2toimpiu1ale  neil()srumxront1olt  f3ilsfmDrlnms u0tleoir iytfp e iei;t  2xm(m oo1ll e neil() Duaurpoo4opeomi3iydla2rln o u4teenmf iy1lm  anvs;t teuoxr3io4ll nmfci sfarrm(  nu0alx  ieiys sDrmumo;()alxoir3iadopteanvo;s  2xoxr oy1oleelietls)a2ta(mono4openmieiasfaDum( snu)trxnif3oodoa raieo;t)truo(o3nu1ale mnvsa( srumu onu1oee  octatlm uluvo;t4aexrxf3todfatrliesls seuoirpny4omt lnvs t)sDumumooo0apxo fetytlaDrmnmp (0teerioctydlpteanes (0 ruo(m ou1lle liet s a2tmxr nu4ole iieiaslm2el(mo;u4tltrxrciy1la e u o;(0s2um(mpoodalee iviatf ruaxrpno4tlxnmi3iys m ulnvont4 eenifciodfp  auvo;s  rxrxr3nydomtelfetas)s2rrxmooo4texomi3tasfmDumuvo;(4texoxo iydlpteaivs (  eurim3oy1am  miet t)a2um(mooo4opeomieiat m ranms;u) exnmf3io1fpD aivo s)texoxmpnu4amtnlfcsas) 2umu pou0aexnioetas a raums;t)trxnir oytfa  anvs (  rurio3ny1omteliei s) 2trumont0olt mociatfmDulnvo;(4alxrirctodoa eluvo t  eumxo3ny4am   icias aDrrxmpoo0oee if3tlt a ulumo;(4 ltrxf3iotoa   ues s truo(m3oodaptnmietas) Drm(  ;t4optnii3iatfs2rl( s;t4tlxrmo3oadop e nesls)srto(m no1aptn fvslsf 2umu pou1tptn octasla2rau s (4 exrifctydla raneil() eurio ou4lltnlnvi tf Dtrumpot0alen i3iydfmDea(vp () exrmocio1lmDrln i s0sruoim nydap  lfes (farrmxm ;u1olxn o3tysfa uan p;u)trtrxf tydfate nvi;(  2um(mpnudlpe lfcsat  Drauront4aetnmfciltlsDuanms;u0texrxocoy1faD  n i;s trtoio3ou1am   nvsat)a2tmxm ;o4optnmieiyt m um( p;u) eermf iy1optraiei (0 rtm(opiy1lmeemfvt tfarrru o;o0alxnmfetyd aDeln ont)tlenxfcoytfpt an s () exrxopoodal   iviltf rtaumonu0aet mi3tldfs ulu o;t0arenxo3ia1fm r u i ()trtoxr3io1ll nmfcsas)srtau  oo1oeenioetld s umn p u0aetnxrcoo1faDeli s t)trtmir3ou1ll emivs tfarur( pou0tetn i3taslaDrlnmo;()aleoxo3oa1op  livols)seumxo iodalte nvs s  rumu  no1alto feiltfaDeluvp;(4aetrmrcoydlp raueils0 2umxr3no1amtnmfvi tfarraxrpot1aexomi3iytlm2ul(mp;t0 lxnmr tytomt li s () rxrirpno4am nmnciasf rtau pnu1aeenii3ilslm el( s;() rtnxfcta1oatelnvsl()sruo(m3no1al e fctl(f 2ra(mono0texnmo3tlsfs rl(vsnu0 rtoxocoytfmtelivs (  2tm(mpnudolenmicsas) 2urxront4aleo fetld s2ulnvpnu0texnif oa1laD  n i s0setr(mpiu4lpe lfvsltfa2rm(mono4olt  iciytla rmnvs;t0tlxnmr3iodfp rai s;() etrxopoydom elnvils)srtrx  nu0tlx iieiytfa um(vp;u4tlenifciydlmt  ueolt0trtm(rpny4opeelivsa(fa2trumpot4tpt  feilslaDemu o;t0 etrmoctytlp e ivi;(0texmiopno1llt micsa()srrrxr ;t4olen o3tldls2rlnmpnt4 ltnmo3ia1opD ln o;(0sexmirpny1omee fcsasfs2raxro;u4olto fciyslaDum( o u0alerxo tadfateli il()seurxo3ou4ame lfvs tfarur(roou0aleomociys m eluvsnu0texnmrctydop  ai o t0 2trir ny4lleemnctl()a2ta( pot1tee mfctaslmDum(vsn(4trerxo tatoa r nes ()t2umxo ou1altemicsltfsDrrxro;o1texomictlsfaDua( p;(0tlerio3ia1fptr ueils  rurxr oodlm e fvsls  ruaxmo;t4teto ieild s2uau s (4aetoxf ootlm raueo t0seur(rpoudlmenlnviasf 2ua( pou0tpxn f3tas m2rau sn()altrmf3tatlptelneo s)s2uo(r iy1lmtnmfcsa(  2ta(mpno0tpx ifctyt m2ul(msn(4 ltrifctatomteaues;t  2tmimpny4llt mfvilt)s2tmumpnt1tpxn ociaslmDumu s u0 lxnxociodlpte nes t)texrirpno1omenmfesl(fa2raxmono4aleo ietasfs rm(vo;u) eenmr3totomD  ivil()t2uo(rpiy4ome lfci sfartmxr ;u0oetnif3tadlaDrauvs u4altrmf3oodom  auvolt)t2xr(o nu1om nlfcs (  2taurpno1tle ifciltls raump;u0aeerircoodfmt luvilt  euoxo iu1lp  lfcs tf rra( pou0apt ii3ilsla2rlnvpn(4 rxoio ta1opD lieo t)teto(o no1am emfeta(  rumxmpou0tpen i3tytlm rl(vs;(4arxoir3totfaD luvs;t  2tmiopou4lle lnvtas) rurx p;t1tpeniiciaslsDrmuvpnu4 reoxf3tatlptranei;(0trxoir iodoltelietas  2rmx  oo0oee ifcils s rau s;t0 ltoio to1fa r nvs t srtmxo oo1opte netl(f 2rrumpot0tleomfciysfsDrlu s u0tlxomr3ia1fp r neil(  eurxrpio4ap elfetlt)aDra(  nt4alenmo3ilsls2el(monu0 reoxrctotoaDe i o;s  2xr(r3ou4olt  fvtl( s2raxrono4oex ifeiad s2ulnmonu)tetnmf3oytfa elnvo;()trtoxm3nydlmt lfesa(fa2rr( onu0opt  i3iat m ranms u0 exoir3ia1lpt lu sl(  2xo(o iydap  lietlt) 2umu pou0oetn iciytfmDeanvonu) rtnmr to1om  ln o s seuriopnodamt  fct () 2uru  nu4oltn ociys sDemnms (0trtnmo oa1op ranvo;t0s2xoxm3oudlmeelietls a2rmu pot0tpt iictasfaDrmn onu) ltoxr tadlptraneols  ruo(r iu4am  lnviltf 2rrxrono0oexomf3tlt sDrl( o (0tleoxr oa1lmte ivi;() 2xr(opoy1am elfvsl()srta( p;o0opt mfeiltfaDulnmo (4treomo3oydoaD an olt)sexrxmpnodom emnvtltf 2raxmoou4tet if3iatlm2rmnvs;(4altrir oytfaDraiei;s0seur(o3ny1al nlietas)srumx  ot0optoiocilslsDrm( o t4trxomf to1lat luvolt)sruo(r3oodapt mfct s)arra(m ;o0aptomictys a umnvp;t) rtrxocta1latean slt trurxm3iodameemfctl(fartrx ooo1opxnioeias m2uanmont4treoxf iy1oaD  ieils)t2tm(o oo4ame lnvi () 2tmxro;o0alxnmo3iytfmDelnmsn(4alxrmo tatomtr n i s0sexo(r oy4om elicil(  2taxmpoo4opx moetldfa2rmnmo;u0treomrcto1om elueo s0trxmxo3oy4lmeemfct tfsrrm(  ;u0olx mocilsla eluvo;(4 eeomoctotfpDrlueo t0srxo(rpoodlm nmicsltfaDtrx  ;o4oleomi3iatfm ra( p t4aeerir ootom raivi t0tetmxrpoo1lpen netl() 2rrum ;t4tpxnifctydfs2ra(vpn(4teenio oodopDeli i s0 exoxo nydomtnlncsas  2umurpno0open octyd a2eanvpnt4alxnxf ty1lm e ieslt0t2xrir3iudalt liet tf 2umxm ;o4opto o3iatlmDumnmo t0aetnir3ty1opt  uvi;s0trxm(r no1ap  mnesas  rumu oot1opto feilslm ua(vont4treoio oa1fa elnvo;t0setoxo3ny4llee fcs (fs2uru oot4apeomo3iatfs ua(vp u0tlxomr iy1oateai i ()texm(o3ny1lmtnlict (  Dur(m ot0tlxoiicildlsDul(msn(4tltoir oytoate n i s0srumxrpoydlp n iciat)srumumonu0oexo o3tadfa2elumo;t0artoirctadfm  au s (0 rurxr3nu4opt lici s)a2ururp;u4oeeniiciysfs em(mp t)tleomrciadlm elu s;( texr(o3ny4llte fcs ()arta( poo4opxomf3tlsfm rmnms ()alxnxocootlaD  ivo;s)sexoxm ny1llte fvil()srrm(mp;o1ole iocilsfaDran s;u)tlermfcoodop ranvolt) rum(r iudlp n ncs sfa2ra(rono0tpx  o3iysfs ranvp;()aeeoxo3oytlmDrau s t0t2xmxr nydlpe  nci ( a2rr( p;t1optoii3iatfsDrlnvo;u)aeeomo3totlatrlu slt0 eurim oo4lpt mnciat s2umxronu4apxomictltfaDemnvont4texrmf ta1lptrlu o;t  2urxrpnydlmee fviat a2umum nt4tpxniiciyd m emnvs;()tltrxfcootlatraiei;t tetoxrpnydlme  icta(fsrrm(m nt4oex ii3tad s2umuvs;t4texomf3iy1fa r nvi t) 2trxmpnu4olt mfei s sDta( pnu4tpe moeilsls2uln o;u0aexomr3totfmtrluvo ()t2urxm3iydlp elfeilt)sDtmx onu4olxo oeiadla ulnmp;u) rerif iytomD aiei t  eum(opny1alen fesl()artauronu4tex mfctytfs eauvs u4aexnir3oytfaD  uesl(0 exoir3no4oltnmietlsfsrrrxront4oltoiiciasfm rauvpnu4aeeoircoytoaDelivil()srtmxr3nu4ope mfvslt a2raur nt4apenifetlt a2rlu o;u)alxnmo oo1oatr nvo;()truoxmpnu4opee feiat)srrrxmooo1olenif3ilslsDem(vs;(4tetrmf3oo1faDelneol()s2xmimpoo1ape livil(f Dtr(mpot1tpen oeild sDumnvp;u4 rxoxr3oo1fp r iei t teuoxrpoy1ope  fcsas) Duax ont0tleomfctydfa eau pn()teerif3oydopteauvs;s sexoxr iydlm emivtl(  rurx  ;t0tpe io3ilt s2eln on()tetrmf tytlp  livi;t  exrim oy1llenlnvtltf 2umxmpnu1oee  i3iys m2rmu s;u)altrxfctydfa   nvs t  ruo(rpou1oltn icta(fsrtr(  nu0aetnio3iatls rm(mon(4aeenxo oodomtr ivo t)texr(r3oo4ol nmiesl(fsrrm(rpnu0tpx mf3iytls ulnvo;() lenif3to1omD livs;() exmxm3nodapte feslt  rta(mpno0ale mictls m2uanvs t4alenxo oo1lmteai s (0srxoxr nudomtn fvil( sDur(r ;u0opxnio3ilsfmDrl(vpnu0aetnxf oa1fm e ues (0 2uoio3iy1olenlncsa(f rtmxronu4aeeoio3tat sDeaums t0tlerxfcia1laD  uei;(0 rtmxr no4apee fviat srtax oot1oetn fciytfs2elu pnt0teermf iatla r n slt)seurir nydomen fvsa()aDurum ;t4oet mf3tydfa2eluvpnu4tltrio ty1lmteaiesls) rxrxo3oy4ol emnei (f Drau  ;t0aee moctlsfs ul(vpnt)texnmr3ty1latrluvo;t0srto(rpno1lptnmfeil() rtaurono4aeeomiciysls2rm( o (0tleoioctadfatr ivs t0s2urxm nydap nlict s) Drmxr ;o1aleomicils mDem(mp t0 ltoxrciy1fp  anesl( tetmxo nudol emnet (fsDur(m ou0apx iieiysfmDemuvo (0 eeoir oy1fpDelnvo t setoio oy1alt miet (f Drmxr ot1olto oeiasfsDel( s;u4 reoxf3iotoa   uvs;t) euoir ou4ame mfetlsfa2ua( ont1tlto f3tlslsDrmnmp;t) ltoxr3iodlaD livsls0s2to(mpny1optelfeilsfsrumxmpou1oetoif3iys sDranvpnu4teerxr ta1fpDeauvols) rtm(m nu1lltnmfetat sDurxronu1tee mfeiasfa2uauvs;u4aeerirctotfpteaivi;s)trumxr oydlmt mnvtls)arumx  ;u4ole iieilsfsDum(ms ()altoir totlatrli o (  2xmimpoy1omeelneia()sDtmxroou0aleoii3iysls ulump;()alxnif3to1lpDr nvi;t0sexr(r iy1ale  ncs tf 2uru pnt4olenif3tldfaDeanmsnu) leoirciodlm e u olt) rxoxopiydomtnlnviat)s2rau ont4tpe mf3iydfsDeanvpn(0 rtoifctotfmD an s;t0setrir ny4omee fcsas a2tau pnt4ope iieilslm2ean o;(0 leomo3iatfat aies (0srxo(m iu1lptelnetlsf Dtrx onu1opx  oetlslsDea(mo t)tlxrif to1omDe nvol( sexo(r nu4aleelicils)arta(r nt1olx io3tls s ulumo u4artoxrcta1lpDelnvil(0 2trxm3no4lptelnvia(f Duaxm nu4tpt ii3ild aDrmu s;(0aexrmo3tytfm rau o;( t2xoim ny1om  lncs ()a2tax  ot0tlt  i3iatfsDemuvs ()altrxo3oydoaDeauvsl() rxm(r oydopee neia()a2tmu ono1tpe mieiydfa2rau o;u)arxoxf3iadfptr uvolt sruo(mpio4lp e iet (f rtmxro;u1teeomo3iyt aDrm(ms;()areoir oa1fp  li i;s)srtr(r3iydapenmicilt srrrxmo;u1optnmicilsfs rmnvp u4 rxnxf3iydfm r neilt)sexrirpoydlp nlicsa(fa2rm(mo;t4tleomf3iat m2emnmp;(4 ltrifcta1faDran o t  rtrxr iydlleelnctlsfa2tru onu0texnii3iydfsDemnms;t) leoir ia1lptelueil() exrirpoy4oleemnvias)arraur ;t0aleoifctatlmDeauvs u4tlxoxfciodomD au olt0t2tmxopio1omenlfcsls)artrx pnt1tpeoii3tyslm eluvp;t0 rtrmocoatomD  i i s srtoio3iy1ameemfci ( s2tr(moot4tetomieiys a ua(ms u) renxo oadlp e n ils t2xrxopiy4ll emncs sfsrrr(r ou4aptomoetyd sDumnvs;u0 rtnxr oodlp   uei (  rtrxr nydlptnmfci ( s2ra(ronu4tlenif3tasfsDumuvp;t0aexrio oadom ean ils)truoio oudlpt lfvtat)sDurx o;t4opeoiieiysls rmump;(0 rxoxo3iytlmte u ilt)trtoiopno4alenmiesa(  rtru  ou1tet  ociat m2umu s (4aetnxr3iadla eauvo;t)truoxm oodoptnmici t) ruaum ;u1aex io3iltfs2rau p;()alxnifciotomt  neo;s s2trxrpiydlltelncsls s2uaur no1ale  feiys s2emnvs;() rtoxf ootomtr ueo;t)t2xrxr no4lle lnvt (fsDumxrp;u1aee  iciytlsDra(vs;t)trxnio iadoaD  ivi;s)tetmio oydap  lfeia(  rta(rp;t1teenmieiytfa2ra(mo (4altoxfcoydoa rlnesls) rxoim3oo4amen nvsat) rtr( o;o1opx  ieias s rl(vpnt0aeeoxf3oatlmt au o t0srurir oy4op  mnvtls  rrmxr no4aetomo3iysfaDrlnvsnu4 lxnmo3iodop r nvs;() etoxrpny1ll elfcslt)arumu  no4tptnmoeiyslmDuanvp;u4arxoxociytom rlneo;t0trxmxmpno4altn nvtasfa2rrx ono1olt iociyt s umnmsnt4 lxrmo totlm rlnei t  rto(m3iy4amtnlnvs s aDuaumooo0tlenio3ildls2ua(ms ()alxrir3tatfp r nes;()sruoio no4opte icsat) rtruront0tptn feiysla elu o u)aeermociotoa rauei;s) euo(rpiu4alenmnvsat)srraxmooo1ale io3tys a2ra(vsn(4trtnmr3tytfmD lu s;s trtmxr iy1oleemfetatfsrraum ou1oltomociys mDranmpnu) lenmoctydlp e ivs t0 2trxo3oo4oltn feiat)srtmx ono1tlxniocildla2rlums (4aleomf iotoaDelivo ( s2ur(opoy1al e ies (faDra( pno4ale  fctat m2ea(vs ()aetnir iytlm  au sl( srxoio3oy4ll n feia() rumx  ;t4oeenmfcilslsDrm( ont4 ltnxo ta1lpteaneo s)tetmxm3iodapeelnesa()aDtr(  nt4tle mfciatlsDra(vp;t4 ltnxr3oa1lm rlu sls0 exmirpou1opee fes ( aDtrxm ;o0optomoeiytfa eauvo (4altomo ta1lmDranvs (0s2urir3nudlleemfctltf rtr(moou0tltnmociad mDumnvsn(4 etoir3iatomDrlnvo (0t2uo(opoy4lleelieta()s2trxmpoo4tpxomo3iltlmDrl(mon()texrir3oo1lptrluvo;t0teuriopnodll elics ()sDtrum nt4apen f3iltla ul( pnt0tetoif3ta1lptrlu o;t) rxr(opiudam nlneils  rumu  ;o4opx mi3tad a ua(ms (0 etnxf3iy1faDrau sls)t2uo(o3oo1llt lieilsfs2taxrooo0alen icildls rmuvpn() eeriocoydlm rli olt srtm(rpoo4aptnmnvtltfsrraxro;o4oexnif3tltfa2ulumo;t) renmrcoydfm rlivi s  etm(opoydllte nvt ()sDraxr no1tptomi3tatfm2umuvo ()treomr iytfmt  nes ()trxm(opoo1oleemfcils) 2ra(monu4alenio3tat sDul( s u0aetnxocoadfmtrau s;(  exmxr no1amtemneta(fartr(roou1tle micils aDea(vsnt)arerxocoytomteau o s0 exrimpoy1olte nci s aDurxmono0aex  ieildls2emu on()arxnmrcoatlpteliei t)s2umxo3ny1al n ivs ()arrmum oo4ole mfctyslsDean on(4treomo iy1fp eau i;t0 etr(o ny4ole licta(fa2uaumpoo0aexo o3iasfsDrau ont0tltomr3totfatr uvo;t srxmir3nu4ll  mies t) rtr(m ;t4aeeomfetyslsDul(vo;u0 rxoif tadla eli i (  rto(rpnu4al  lnvsat) 2taxr ot1tpenmfciadla el(ms (0altnir oodopDelivo;(0tetm(m nudal   fvi () Durxrp;u0aetnmietas a2uan o u) etnif ootfm elieslt)teur(rpiy4op emnetltfaDtmurp;u1opxomi3ilt sDemu s;t0aleoio tydfpDelivols setrio iu1lle micslsfarra(mpnt0ale mi3iys mDua(msnu4treoioctodlm  luvs;s)setrir nydap elfcsas)srtmu p;o4olx ii3tldlmDea( s;u4texoio3to1fp rlueslt t2umxo iodlltn fctl(  rra(r ot4oexo f3tat sDrm(von() ltniocta1fp e ueslt)s2umim ny1am elnvt t arta(  no4openmo3ilsfs ea( p t0 lxoxo3oodoa  luei;s0srtrio3io1lm elnei tfarra( oou4oeeomiciltfm emn snt) exoir3iy1oa   uvo;t  2trxm3io4ol nlncsltfsDua(monu4olt mi3tltfsDrm( p (0 etoxf3tytlmtran s s)s2um(r3oy1apenlietat)srumu  nt0tpxniieiadlaDum(vsn(0aexnxrcio1laDelnvo t)s2xrxrpiu4alt  ncs (faDurxmpnu1olto i3iadfs um(ms;t4altoiociydfm  lneils srxr(opio4ll n nvsat)a2ra(root0tpxo o3iat s2ulnms u4 etnxrctotomDr i ol(0setrio iu1llen fvsasf rrmx o;o4tlxoioctasls2em(msn(0 leomr oa1oatrli s;() eumxm3oydlltemietl()sruaxronu0aetomoeils m2rmnvo;()trxomf iydoat aiei t s2to(m oy1lp emietlt s2tmu pnt1teenio3tad m2emumsnu0trxoif iotomtraies (  rum(r3oy1al elfesa(f 2trurpoo0alen ieiysfsDrluvs u)arermf3tydfmtrlneols trxrxr3nu1aptemics tfsrtrxr ot1tet  oetytls ra(mo;u) rxrifctodoa e nes;(0s2trir iodape mfeias  rtrx ono4oeeniictasfm umnvpnt4 ltrmfcoadom  aieo;(0t2tr(o iy1opte fei t)srumxmp;o1opeo fctlt m2uanmo (0tlxrxr3oo1latrlues;t  2tm(o nodlmtemfetlt)a2rmurpot4aetnmi3tyd m uanvo;() etrmrcoatomDr n sls)s2xoxm iy4om e fesls a2taum ou4oetomf3iadfm2ul(monu0 exoxf iydlpDr nei s0 etrim3oo4ape livias)a2tauro;t1oetnmoctyslm2ea( p;(4arxrxf tytfpte uvo ( t2umxm iudapt mfcias  2tr(mpnt4tpt micilsls2umnms;u) rxnmociydlaD ai il( srtoxo oy4ape mieilt) 2uaxmont4tlxn ieiysfa el( s (4 rxoir iadoaDelnvi;()sexoxopiydam   ivt tfsrum(r ou0altomfeiyd m2ean o t) eenxocto1op  au o (0s2umxr3ny1ale  fvt sf 2ur( p;o1tptoii3iad s umuvo u4arenio3tytfmDe ivo;t0seurim iu1amt mict s a2raurp;u4aeenmfeiytlm2rau p t0alxrmr3ia1lm rlnvs t0srtrir3no4llenlneilt) Dumxm nt0olxo octlsls ua( s;u) rxnmrctodfmteluvi;t)t2uoxo3oy1lm e icsltf rtrxrpou1apx  f3iytla2rlnvo;t4altnmocoadomDrai o s)srtoxr3no1lpe mncsa( a2tmxmo;t0tpxomo3iltfsDul( p;u)tlerxo oa1lmD  ueols)t2xmimpiu1lptnmnvs s)a2ururonu1apxnmoeiadfm rmnms t)trerxo oytlpt anvo (0seurxo3ny4oltelfeslt srua(m ot1aeto ieild sDra(vs;(0tlxrifcio1oaDr ies;() rtoirpiydamenmneilt) 2tr(rp;u0oexo ietld a2uaumsnt)trtomr3ty1lp e neil() rur(opnu1lp elneiasfaDtm(ronu0tetniictlsfmDua(vsn(4 reoirctadomteluvil() 2to(r no4lptelfvtasfsDumxmono4tpt ifciat s2rlnmo;t)arxrifciotlaDrlivo s0 euriopiudlpte feias a2tmxrpnu0tpeoii3tydfaDum( p;t0 rerxoctydlaD lieo t0trur(o3iu1al   feilsf Duru oot0alxomi3iaslm rlu o t0 eenif oy1oa   n o;t0trxoxr iodoltnmivta( aDurxrpou1oex io3iltfsDean s () etrmocio1lmDe ies;s0srto(r3nu1opt mfvt ( a2tr(rooo0tle iicildfaDeluvs;(0 reoio3oa1opDe u o;t0 rumxopoy4alenmivtas) rumu  ;t4tpt mieiytfs2ea(msnt0tltoxr3tytom  livilt) 2xrxmpny1omt  nvs tfarumxr no1tpxo ieiatfa2rl( p;() rtnxrcty1optrln o s) 2toxr3oy4omeemfet t sDtmxr ot4oltoifeiytfs umuvsnu4trenxfcio1opt  nvo t)t2uo(mpiodole micsl() rtmx  no4openmf3tatfmDranvo u) reoxrcoo1fpDean s (0 2umxr3iu4lp emncil( srtrumpou0oee mo3iytlaDelnvp (4 ltoxrcoy1fmD  i i t0s2urxo nu1omee ics t)sDtr(mooo0teeoiicildfsDranvs;(0arxoxo oadopD lnvs;t  2trio ny4opt liet sf Dtau  ;t4oltnmfeiadlaDea(vs ()trtrioctodoaDrli s;(0teuo(r iy1al  lics (  Dtr( oou1tltoiieiadfa2ulu p;t)tetnif3to1op eai sls)trumimpio4oltn neia()srrm( p;u0tee mo3ilt a2ulnvs (4 lenif3tatfm r u i s) 2um(o nydale livsltfs2umum ;t0aptn fcilslm2rmnmo (4 rtoirciatoatrln o;s trxmxm iydopee icsas srtmur ot4aeeo feiasls2em(msn(4treoxf ty1omD  ivols0setmim oy1omtn ncs s  rtrum no0aex iieiys a2umu pn(4teenmocoydlptraues;t  2uriopnodale micsltfaDurxroot1tle mo3tat s eaump u4artnmf to1fm  an i;t) rur(opny1amtn iciat)aDrrxmo;t1texniieils aDeln s u) ltrxo3to1omDrlueo t) 2uo(r3iudlleelnvi ( aDurumo;u1altoiiciasla2ra(vpn(4tltnif oatop elu o s s2xmxo iydlm e ieia() rrmx  ;u0oetnmi3tld s2uauvo;u0artoio totfpD  n sls  2tmxrpoo4ap elnvils)s2um( ooo0ole mf3iatlm eln o ()trxnifciotomt ln i;t0 rtmxo iudomt lneil(faDrr( pot4opxnmfeiatls2ra(mo;t0aexnio3iydfmDe u i (0s2to(opoydal nmnesatf 2ur(rpot0oexomf3ildlaDemuvont0alerio ia1oaDe uvs;t)t2urxo iu4lme  ieil(f 2rax  ot0oet iocildfm emuvpnt4 rxomo iadoa r i ils0seurir iy4openmfvtas) Dur(rp;u4tex mictls aDeaumon(0trtoif3oa1fpte ueils)srxr(opoo4oltnmnvi sfaDrm( poo0apx ii3tadlmDuanvp u4 lxnmrctotopDean i s0t2urxr3oo1lltemicil(f rrmx pot4aex  feiltfm2rluvo;(4alxnxr3totoatr ies;s)srurxmpoodop   nei tfsDumu ooo1altoiietas a2rau sn(4 eeoxocoytlate ivo s trurxo3oy1ol  lfvsas) Draumoou1opt io3iltls2emnvont0 etrir3tatfaD  ies;t0t2tm(o io4al  lfcsat a2ra(moot1aeenii3iyd a2rau pn() reoir3oatlaDr n i;s srumir ny4alen ivi ( aDrr( poo1openioeiad m2ulnmp;t0aetoiocio1opDeanes;t) 2toir3iu4apee fvs t aDuax pot0aetoio3iadfs2em( snt0 exoxf3oa1omDelu s;s) rto(o oy1al elneia( arrmu p;t4tlxnmi3tytfmDulu pnt) exoxo3oatla  li olt0 rtoio oodlm nlnesl()aruru pnu0olxn feilt a rlnmp u0 lxnmo to1faD li i;s0 eto(opno4am  mnvilt)s2ur( pnu1oltnmfetltfm rluvs u0tlenxfctytfat lneils0trtrio3oo4ol n ivs tfa2umx  ;t1tpt mi3tlsfmDemn sn() etoxr3iadoa   iei t0trxmxo3oy1apee net t)sDta( pou0texoifciatfm2umnmp t0 leomrcoo1la eln s t srtmxo nodllenlfctltfarrmu pnt0olx mf3taslmDean onu)aetnmo3ootfm e iei;( s2toir3iy4ole lfetat sDuaxmooo1ope mfeiytfaDua(vp u0arerxocoa1omteau i t0s2ur(m3oo1oleelnci s a2taxrono0aet ifeiad s2ul( o (0 ltrmo3oadoaDr ueolt  2uriopiy4llte nes () Drmurpoo1aet io3iltla umn s (0texnmfctatfpte n olt0teto(rpoo1lmtnmnet tfsrra(mo;t4tex  ietldfs2eluvo (0tetnxf iydlate iei;s) 2trxr oy4ap e ncsat)a2urx  nu0alx iieiytlmDrl(mo;(4arxrifctadfp   ivs (0s2tr(opiydlm   ivilt) 2rm(m nt1oltnmietld m em(msnt4tlerxo oo1opDr ivol() 2xmxmpiu1om  micsl( srtr(m no1olenif3tys a2umuvp;(4artnio iadfm rli o;t) 2uo(r iu1opt lieias  2rmu o;u1tpeoifciad sDrm( ont)aeeoxoctatfpDrlivslt0s2toxr3oodlmeemieia()s2rmu  ;o0alx  fciysfaDulu s () rtrmfctytlmtr u s s s2um(mpoo1lp n netl(f 2umum nt0tlxoioctadlm emnmont4trxnmf3iodfpD aueilt s2xr(r oy1lpee ictltfsrtaxrono4aetnioetasfaDra(vp u4arxoif todfmtelu i t)trto(r io1omt mivta() 2trx p;t1tltnifciyd a ra(vs;() leoxr3iodoaDrau ol()s2xm(o nydlp  miei s) Dtmurpou1oeeoifeiadfs2elnms;t4alxoxo tatfm  livi t) eto(r nodameelivi ( artmxrp;t4tpen fetysfm2um(mo;u0aexomocta1oaDrlu il(0s2uoiopio1llt mnciltf rur(  ou4teenioeiatfa2um( s;t)texrmoctodfp  auvs;s texrio3io1al  mivtl(f Dta(mono1tlen fciad s2ea(vo ()aeenmf3iydfa  anvo;(  2tmir3ny4ap e iesa( sDrmxmpou1aptnmieiydla umuvs u0 lermoctadopt ai o s)t2uriopiy4lpteliei t  Dtaxrp;o4tetoif3ilsls2ean o;(0 lxnxr totopDeaies s  rxmxr oo1llt  fvsas srra(mpno0ope ioctas m eanvonu4arerxrcia1lmte ivils0t2um(o oy4openmnetas  ruru  ou1olx ifetydfsDrlnmpnu0tlxnxocio1fp  lues t teurim3oo4ap  mnvt s)srur(m oo0tltoioetldlm2ulu s t4tltnmocoo1omtrlnvs;(  exoimpiy4lp n ncsa(f 2ururp;o1tex if3iydfaDuauvs;(0texoifcoodfa eaivi ( t2um(m3iydllt  ieta(fsrumump;u4oetomo3iytlm2uaums t0altrmr3ta1fmDr iei t  ruo(mpoydaptelnei t)aDur( o;t0tle  ieilsfa2um( p u) reoircoy1faDe n olt0 eumxo nu4opee fvi s  Duau pou0aexo i3iaslaDel( o (4tltrio3iytfmDrln slt sexoxopio1ap emivia() rtmxm nt0tpt  octld m raumsnu0trerir ty1lpDelivs;s  2uoim oo4lle  nei t) rumur ;o0aee iiciadfm2umnvo u0tleoxr3oatoaDr ivs;t  rumxo oodllt  fct () rtrumpnt0tpe mictltla elnms u0tlxrxfcoodopt aueo;(0s2xr(opou4llt mieils) Dtrxmpou1tpx  iciatla emu s ()arxoxr3iatlpDeauei s0trto(opou4lp  mnvtatfsDtau pnt1apxomoeild aDra(mo (4tlxnirctotlm   nvs;(0srtoimpoodllenmicsas)s2umxr ;t0oltniictat sDum( s (4 rtrmf oatlp rauei;()srto(opny4aptnlfvs t a2ua(  ou1apxnifctat a el(mp u) rtrmrciotfm eluvslt s2uoimpou1olt  fctat)a2tr(m ou4tpxo o3tat aDrluvo;(0 rtoxr oy1faDelnei (  rtoxr nodopen ivt ( aDuaxrpou4oet  fciyslsDrlnvpnu)trxnif todlpDraueols0tetrim3nudapeemfct ( srururo;t4olx mi3tld a2em( pnt0 lxnxr3todfpDraivo;(  eum(o oy1op e nei s aDtrx  ;t4aex mi3tlsfm2eau o;u0trtoio oo1lpDe ueil( setrxo io1lpe mncil()s2rmxmooo4tpxnifcilt s rl(ms;t4arerxrcoytfaDeanvil( teur(m3iu4apenlfet s) rrm(  nt0tle mietltfa uluvo;u4altomrctadfp eau ils  etr(mpnu4amen nvil() rraxrpou0opt mo3ildlmDeaums;(4aeenxo3oo1faD  n i;s)t2xmirpny1oleelnei s)s2tmxmp;t4olt ioctlsfsDrl(vo;t0texoif3totlp ranesls  2urxm3nu4lm  mfeta(  rrm( o;t0opeomfeiaslsDul(vsnu)teeoio oodfaDe nei t  rxoxo3iy1olte ieia(  2urur nt1alto o3tltls emn p;u4arxomr ootop elieo;()s2xrxo3oy1llenmivt t) rtmurpnu1tleoioeiyt m ra(mpnt)tltnxf iytoptr u i;(  2trxr oy4olenlfetas)aDtrurpot4oex iietlslm2eln pn(0 lxomrcootoaDrai o t  eur(o iy4lme lfetlt aDum(  ;o4apx iiciadlmDuauvp ()alxnifciy1lp r uvi;s tetrxm oudalee fvias  2rrx oot0tpt micildfa2ran o;u4 etoxo totfmDe i i s)seurir3no4amtemnvias) 2rr(  ot4ope iietys mDraump (0 exrif3iatla rluvs;(0setr(rpoy4altn neilt)sDumx p;o0tlx ifeiysfs ranvo;t0arxoio ia1op r nvol( sexr(opio4optemietat) rrm( pou1texo ociltfsDra(vpn()alxrxfctytopDe uei;(0 2xmxr oo1omtemicias)sDtmx  ou4alxoifeils mDum(mp () rxrio tatla  livslt)srto(r3nu4aptemfetlt)a2tmu o;o4tetn feiadlaDumuvo;u0 exrmr ia1la  au i s)setoxm ou4amt lics t s2raumoou4aee iieils s rmu p (4texrxr3iotoaDr ivi t  2xrxm3nudamtn fcs s srumx pou0optniieild s ulump;()trxnifcta1oaDrlnvo;s)s2urim oy1ome mieia(f Duau o;t4optomieiytlaDem(monu4trerxr oatopDrlu sl(  exo(r iu4altelfetl(  2ra( p;t0aet  ieiat a2ua(vs;t)trxomocty1faD lies s) eurxm iu1op  lncs (f 2uaxmpnt1opx mfciasfsDumuvo (4 rxrxoctodlmt  ivi s0 rtoxopnu4llt  ivi (fsDur(mp;u4teen ieiyt mDrauvs t4trtrif3iatlate neo t texr(mpoy4lle  feias  Dumxr nt0oleomfctadfa rmu onu4areoif3tytfmte ieol() exmxm3ny1ame mnviltf 2umx  no4opt  ieiydla2eluvs;t4 etrxr oo1opDrli ils t2uo(r ny1llt lies t) 2tmxrpot4oex  ociysfs uln o;() reoir oodomtr ies;t) rxriopiu4alt livtatfsrurumonu0tpenmfeiltlaDulnvp;t)aetnmr3tatfp  an o;( trurxo3oo4ap nmfvta(faDurump;o1tleo ieilsls2elump;t4tetnxfctodfmt livil(0 eurio3io1ole mncias)arrmx  ot1ope  o3tatla2ea(mo;t0aetoif oy1opD  u s;(0 etoim nu1lptnmics tfsrrm(mo;o1apeo oetytfm um( onu4 rtomrciodlpDe nvo;s0teur(m3iydomen ici sf Dtm(rono4tpe mociatls rln s;(4alerir iatfpDraueo t0s2uoiopoydol  mfeia( sDrmuro;t1oee io3iys sDuanms;(0 lxrxfciy1optraues s  ruoxrpny4om elicil(fsDra(  ot4teenifeiasla2elump u4 rxrmrcio1oaD luvs;t trxm(mpoo4lme mnet t)aDuaxroou1alx  fetadlmDeanvp (0trenxr3tytfmtr u ilt0srxoirpnydomtemfvtls)aDta( o;t1oltn fetad aDea(msnu)teenmf ootla  livsls) etoxm3ny1alenmnvt ()srururo;t4optomicils mDrm( p;u)aleomr3iotopt aieo t)setm(o3no4ole mfei (fsDtm(mono1alt mfctlsla rmn p;u0tlxnxr3iotoptrli i ( seuo(rpny1lmenmfcta()aDraurpou1ole mf3iydla2emnmo;t4arermf3tatomtr uesl()s2xoio3oo1lme  iet t) ruaxmpot1oee if3iat m elu snt0 exnir iadoaDrauvs;( s2toir3iudop e fctls)aDtrumpoo0tpxnmf3ilsfm emump;t4tlxoir oodlaD  uvi;s trurxr3nu4ole lfcs t srtaxro;o0apt mi3iatlm2ea(vs;()trxrmrcoatfaDrlnes (0srtm(o3oudamt  fvi t)a2rr(r ;t1apxomoeiadls2rm( pnu)tltomf oatom rau s () 2xoxm ou4olenmnei tfsDta(r oo4alxnmieilslsDul(vp;()treoxfcoadfaDrauei;s teuoxopnodopenmnvi (  2ra(  no1apeniieiadfaDrmu snu)arxnif iydom rlues;s srurimpnu1lm n fvtls) Durxmono4opxo i3iasfm rm(ms;(0tleomf oadlaDeanvilt0srxmio nu4amen ivia(fsDua(m no4tle moeiatfa2rau sn(4 rerir ia1lmteli ilt)t2uoxopnu1lp n feta(farrm(rpnu1aetn i3tatfs emnmsnt4aeeomr ootla e i s s0s2urim io1ol  lnvt s  Durumpnt4oltnmi3tld s ua(vs t)arermrciatfm e nei (0tetmxmpnydal elfvilsf Drmu  nu0tpeomfctldlaDumump;()trenxf oodlp raies s)trxrim oy1ole  ivtls  Dum(rooo4oexnioeiydlmDrl(vs ()arenif3tytomt lues s0 exmio3nu1ap e neia(fs2trx p;u0aptnmicils s2umu s;() leoif oo1latrli sls0 2xrir3oo4aptemnvs s a2uaur ;t4optnmiciytfm2em(mpnt0arerxo todlmDeaivi ()s2xm(m nudoleemnct t  2rr(moot1oeeomf3iaslaDrlu p ()alerxr iydla elneo;t t2xmir3io4om  mnvslt  Dumxr oo4tee ii3ils a2em(vo t4 rtrmocta1faDeau i;( s2tmio3iodom  mfct ()s2rrur ot4tex mi3ilt sDeau o;t4aetnmrcta1fa r u o;s  2umiopiy1ome lnesls)arua( o;t1texoioctls s uluvs t4treoif oy1fmD aiei ( srurxr3nudape  fvslt  Dur(mpnt4aex  oeiysfm eauvsnu)arerio tatfateaueo;(0 rtr(mpoudam e ncia()s2tmurp;o1tee ioeiadla2emu p;u4 lenxfciatfp e uvi;s0trxm(o nodlpeelivtlt a2rrumo;o1aleomfetlt a2ean o u0tlxomr totfp  auei;t)srxo(r iydam   ivil(f rumxrpno0altoif3taslm emnms (4teeomo3iy1oaD lieo;()teum(r3ny4omen nctasfsrur(rp;o4alto fciytfs umn s;u4 eerif tatopD au o t) rxoiopoy1om elivi ( sDrrxmo;o4aeto octlsfmDumnmp t4 ltrxfcoadfmtrluvolt0 2ur(rpnudllt  fesatfs2rmxmo;u0apen i3tldfaDeln s;u)teenxf3iatfaDeanvils)s2xoir iu4apt livslsf 2tm(ro;t1teeo i3iyd m ra( o t0 eenio3oytfpDeanvsls)trtm(opny4oltemnct tfa2tr(mo;u1opeo feiadlm2ulump;t4 eerircio1faD  ieo;(0tetmxr io1am e nciasfa2urxro;o1apenmo3iasfa2rmuvsnt4tetoxo3tatom eli s;s0seumio ou4ol elivi (fs2urxmo;u4tleoio3iysls ulump u)alxomoctydfm rlu o s)texm(mpio1apt livt t) rrax o;o4tpxn ietaslsDrauvo;u)tltnifcoadlm  an i s0sexoxo3ou4ol  mict sfs2ta( oot1tetomo3tyd s2emnmp ()arxoxfcia1fp rlues;()s2toxopno4lm nlivta()s2trx p;u1apen octatla2eau s t) lerxf oodfmteli o;s)texoiopiu1apt  ieiat)a2trxm oo0altniociys mDem(msnu4 etoifctatfpDr i s;() 2toir iy1op nmictls)sDur(  ;u0opxoii3tltlm2rlumsnt) exnif3totfm  ln o;(  rtmxm3iy4alee ies t s2rrxmpnt1alxnmietasfm2umuvon(4aetrmf3tytfa  an o;s0setm(r no1aptelfesl(f 2um(rono0tpeo o3tyt m rm( sn(4 rtnxrcoy1lp e u s s  2xrxr ou1olen fvtas) Drr(m nt0opeo fciytfm ua(vpnt)alermf iatlmt lu s;s)seur(mpou1om emfesa( aruaxmo;u0oetoifctyslsDuaums (4 rtrirctytom  ai ilt t2trirpiydalenlivs s)arra(m no1aeenmf3tls mDea(mont)tlerxociatlm eanei s0trxr(r3nodlptn fvsatf rurx  ;o1oet moeiytlaDemn s u4 ltrifctadlm e ivs s)seuo(rpio4lle mfvilt)s2uax onu1oleniociys m2ranms;t4 eeoiocta1oatrlnvs t) 2trimpou4lm nmictl(  rraxrpno0aet iociadls uan p;t0teenio oadfaDraues t)s2xmxo3oodap  mfctlt) 2trxrpot4oltomieiytlsDul(ms t0alenif iy1omDe neo t)srurir iydlm nlfetlsf Dtmxr ;t1tpto feias aDum( snu)aetrmo3io1lmtrai il()teuoio iu4ap n fvs tf rtaxm ;o1apxn ociad a uluvsnu4artoif3io1fat luvo t trurxo3no1ol n ncslt)sDum(  no4ole mfeiyslm eaumo;(0 eerxr3oatlpt aiei (0 rxrir no1al nlnvsatfs2umu  nt0ole ioetls s emnvsn()artnmr3todomD  neo () eur(r3nu1alen neiltf Dtr(r ;o0tpxo i3ilt m um(vo;()alenmf3ty1opDr i o;t setmimpno1lleemictlsfartau o;t1olx mf3tldls emumonu)alxoioctydlpDraieils0trtrim3oo1ame lfctl(f rtaum no0olxo iciysfa rmuvo (4tlxnmo oydla eaieil(0teumxm no1ll eliciasfs2um(  ;u0olxniiciysla2umnvpn()aeenir3ty1op r uvs s0t2urxo3nodlmeelncslsfaDraurpno4alt io3ilt m2ean p (4tlenmocty1fp rlnvsls)s2xrio oo1om  lnet (faDumxront1aptomocils m2rlnmp;()tetomo oa1opt  iesl()t2xo(mpiu4omtnlnvsls) 2uaxrp;t1tpt mfctadlsDemnmsnu) rxnxr3ty1omDr n i;(0 eumxo iy1lptemictat  2um(ro;o1teenmfeiasfa2elu p;u4 rxnif oo1lmD ln o (0 rtmimpio1lptemfcsl(fsDurxro;o4oex ifciyt mDemu o;t4aexrirciydoaDeai olt t2xoxo oudamtnmicil(f 2uax  ;u1olenmi3iyslsDuln s (4trxnmo oytfmte uesls)t2xmxm3nydam emfes s) 2urum nt1apeoiieilsla2ea( s;t4 rxrmo tydlm e neo s s2umxo iudlpe  fvsl( arum(  ;o1apx moctls s2elnvo;(4tlxrir3iodop   uei;s t2um(o3oo4altelnvslsf 2raurp;t0tpxniieiyt s umump;u) rxnir iytlm e n i;s  rurxm3ny1lmeelneilt  Dum(monu1opx ifciysfs2el(vsnt4texnxrcootopDe u s s) rtrim3nudopt lfctat)s2rmuront4oexoifeilsfa ranvp u4alxrifcootfmtr n i;t)srxoxm ou4ole  iesltf Dtau p;u4oexo fctldls rluvpnu0 etomo3iotomDrln o s srxrio oo1al  lfesat arua(  ot0apx  fciltla ea( s;()trtnif3oa1lptr ueo s  rxmim io1op elfvi t) Dra(m ;u0altnif3tysfs ulnmo;u4 lenmocootoa eauvi s0s2xm(r3oy1omtelfcs (f 2rmxroou4altniicilsls rau o t0trtnxf ootlmD aivi ()t2xrir ou4open ivta(  2rmxmonu0tpt mo3ilt m2eln onu)trenif tytfp rlnvi t tetr(m3oydoltelfes tfa2tmu p;t4opt  oetydlaDelnmo;u) rxrioctatlaD  i i t texrxrpno4ol  mict t a2taurp;o1opxomfciydlaDrm(ms;t0aeerxf3iytfatelivol(0 rtr(o3io4om n ictls)a2tr(  oo4olx  fciytlaDrmnvsnt)alxniociadopDrai s s)s2um(m3nydlmeelfeil(fsDta(monu4oexn oetltla2uaumo;()trtoircoydfm  livi s)srtrir3io1olee nesas) Dtrx p;t0olx  fciys mDumuvsnu0arxrio tadomteanes;s  2tm(rpio4ap n fcsa( srtru pnt4optniieiatfs2eluvo (0tltoxrctytfpDraueol( sruoxrpoy1ameemies ( arururono0ole  fciatfa ra(ms t) lerxo oo1omt liei;t)t2xo(mpiydllee nvt (f Duaxmpno0olenmfciyt a umums;(4arxnxo3ia1lpD  ivo ()s2um(m3oydoptelfeslt  Dur(mp;u4oetnifctyt mDrlums t4aetrmocootlpDeau o;(  rxmim3nodopeelivta()sDraum ;u4aet  ociltlm ul( ont4 ltoxr iodopt ai s t)s2tmio3nu1om  lnvia(  ruax oot4apxo icilslmDuln p () etoxrcoatlm   ieils)t2xoir3ny1am  livt t)aDtmx pot0tpe ifeiys sDuln ont)trenioctadomD aues;t0 ruoim iy4ol nlneias arrmumpoo0olxo ietltfaDumnms (4aetnif iy1lmDrln o;(0 eurxm3iydap e fvsas srtax oou0oetnio3iydlsDeanvp u) rerxf3tatom e neolt)t2toxm iydam n neta()a2taxmono4aeto o3tys aDelnvont0tleriocoo1oaDr nvo;() rxoxo3oo4olee ict ( aDuru oou1ole ifctatlaDrlnvp;(4 rtrxo3ta1lmteauvs;()t2urxo3iy1opt lncs tf Drmxmpno1tptnmo3tydfa eauvonu4 etnxr3ty1oat aivols)teto(m oy1ameemfes t) 2uaurpoo4teenmocild a emn o;u)alxnircia1faDrln ilt s2xmxopou4lltnmncta(fsDra(r no0ape mf3ilt aDelnvp t0artnxfciotlm r ueolt srtmxopiu4ope mfviat)aDra(  ;u0oetnmictls m ea(vo t) renxocoadfm  auei;t0t2uo(o oo4lm elneiltf 2rm(monu4tlen ieiaslsDrm(vpnu0 lenxo to1oa eauvslt)setr(m3oy1al   nesls) rtrx oou0oet  feiasls umn on(0aexnxociydoaD lnvi;(0srto(m iy1ole  fcsasfarrmumpno1tetomiciadla rm(vs;u0 renifcootoateaivs s0sruoim3iy1op n ivt s s2rax onu1aleo i3iys m2um( pnt4aexrif ia1lp rln o;t  eto(r3iodopee nvsas aDraumpot1apto ieiasls2ulnvs t0 reomr3oatfaD  neolt)s2xoxr3nu4al  lfciat  rtmu oou1altnmo3iytfs2ul(vonu)trtomociodom elivi;(0 etr(o3nu4olenmneia(f rtmuront1oet io3iadla2elu pn() lxoif ty1latranvils)t2ur(m nydam n ncias  2tax pot1tlt  o3tadfs2umumo (4 rxnif3iadoaDraneo ()t2toio no1lme lfetls  rum(mpno4opeoiocils a2umuvpn(0alermo iydla  aivo t)t2toir3iy4olee ieta(  Dtaum oo4olxomociasfa2rlnvo u0aexrmrcoytlaDrlu ols)srxmxr io4omt lieils)sDtmx onu4aexoiiciysfaDumuvsnt0tetnxo3ty1fpDraueil(0 eurxr iy4ale mivias s2urx ont1oeen fetytls2umnmo;t0 exrir3tatfptelnvs t)t2xmim3oy4lpeemivsl()a2ta(rpoo4aleo iciatlaDemu o u)aetrxo iadomt aieo s0trxoim ou4lmtnmfci sf Dtr(  ;u1altomf3tasla2uanmp;t0 exnmr3oydoaDe ueilt) exoim3iu1ll   nvsls  2ta( ooo1tlenmoetyt s2el( pnt)aetnirciy1opDrlivo t t2xo(m nydaptelfvt t s2um( o;t0apxnmietytfs2um( p;() exrmf3iy1lptrai o ()trxrxm3nudopt micslt s2rmxrono1tlto feiyd m ranmp;t4teenif3oytlpt  ueol()trxrxm3iudlpenlfcs (  Dtaxro;o0olenmociyslaDean ont0trtnmr todfm rauesls0t2xrim no4lle mieta( srur(ro;o0alx mo3tld m emuvsn(4artrmo ootlat lieols0trtmim iu4amtnmfvi () 2taxmoot0oleomoeiltfaDuanmo u0aeeomr3ta1omt  u o (  2urim3nodlmtnlfvs s  rtm( p;t1olx ifetadfmDuaump ()trtrmf3todlpD  iei ( seumim nodam emfcs s)aDra(mpot1oeeo octatls2ulnvonu0arenxo3tatoaDr nei ( tetoxo3ny1llt lfciat arua( ont1aexnmo3tys aDranvo u) exnmr3iodlmtraueslt)seuo(r3nu1ameemfesls)aDra(m ;o4oetn iciatfaDranvont4 etnioctadfp  auei;t)srurimpio4llt mivslt  rtr(r nt1opeoiociasls eanmp t)trenxr oy1lpDr n o s)truo(m iu4ap  mnesls  Dta(roou0oeto f3iatlm eln s (0alenio todfm  lu i t) euo(o3nydlm nlnet (fa2tmx o;u4opt  fetld s em( s;t4 etnxrcio1om   ues;t)teurxmpiy1am   ncta( a2urum ;t1tlxnmo3tatla2emu snt) rxnxo totlaD  i s;t)s2xrimpiy4amenmiei sfsDtaurpnt4alxoii3iatfs2ulnmp (4teenif todlm rln o (  exo(o iudllte netls)aDta( oou0oexnio3tasla umu pn()tetrmfciytfm  lies t0teumxrpou1lm
\ No newline at end of file
@@ -0,0 +1 @@
+nvs;t sexriopoo1alen nctl()sDrmx oou0olenmo3tatlm ean pnt0teerxr3ia1lpteln i;s s2umxm3nydlp nlfvsatfsDrmxmpoo1ope  feilsfsDeanmsn(4arenmrciodop  auvilt teurio3nu1amtnmneslsfsDtm(moot0apx mfetytfs rln p;t4 ltnmo iadlaD  ivs;t)s2xmir3nydlle  iesl(  rrr(  no0oee  ociytls2ulu o;t4arermo tytla rluvo t)setoxo ou4ap   fcs tfa2umu pot4tlxniociydfa em( o (0tlxnirciotfmte ivs;s srtrxo iu1ll   netlsfa2raurp;o0oetomoeiad m2rmu ont4tltomocoydfaDeaneo;s0srtrxm3oo1lpenlfcta( sDrrxm nu0tee iociasfa eanvonu)texrmociydfptranei (0srxmirpnu4al e fcsatf rrrxront0optomociat s2rm(vo t4teerif3iytomD livo t0 eumxr3oy4openlnvil() 2tmu pno4aet mfeiatlmDemnmo;() etriociotopDr uvo s0t2trir nydopt  nvsa() rururoou4oexnmf3iydfs2ra( o;t0texomr oa1la e uvi;s)trtmxo oo4aptemietatfartaxro;u4ope mf3ilt s el( p;t)arerxr totoaDranvsl()trxmxr oydlm nmfct tfsDua( p;t0apeo fciyd s2um(ms ()tltrxr tytlp eanvol() rumxr nudapt mnctls) Dur( onu1alen iciys m2el(vp u4arerifctadoptrluvs;s s2xrxm ou1ol   neslsf 2ra(r ot4tpe iietytfm ran pnu0 rerxf tytlmDr uvil( s2tmxo3nudlp n nes sfsrrrxm ot1aetnifciatlm rl(mp u4trxnxo3totlpDrlu s s0setoxr3no1om nlfeilt)artax ont0opx  i3iytfa rau s;u0arxrmf3iy1fmt anvils)s2xrio3iy4lmenmfciat) Dtmuront1altomfcilt s ua(vo;t4tlerif tydlp   nes;t) 2tmio3oudlp nlfei tfaDumx o;t4optoiietlsls um( p t0 rermf3oa1laDe u o s  eumio3oy1lm  mnet sfaDtaxr nu1olt  fetadfa ranms;u0arenifcoytoa rln sls)t2ur(o iu1ll n fctlt)sDua(  ;t1alx  iciysfs2uau p (4alxoirciodfpte i i ( tetmxm3ou1ameemfcil()srraumo;u0tle ifetadfa2rmu o t0aexrioctotlaDelu i s srtmir io4omtnlncils)s2rmu pou1oltoiieiydlm rmn p (0 ltnir3iatla raueo t0 2xm(m3ou4op e fesa(f 2taxmoou4alt mocilsfmDrmnmp u) lxrmfctadlmtraueo s)tetrir no1omt mieils)a2tau pno0olxn ictydlaDrluvs;t) exnxr iatfmD auvols)t2toiopiy1lltn fcsat)artrx o;u0aexniociadfaDrmn s t)tlenxo3oytfmD  ueilt0 rxr(mpiy4al  lfeilt)aDra(mpnu4tetomietasls2uauvont0teermo iytoatr ueo;()seum(m oo4om  lfvta(f ruau pnt1oexn iciys m2ulnmo (4areomf3tydoat lnvo;(  2xm(m nydoptn nes t  rumxmpou1ape ii3iltfsDulumo t4aeeoio3oydfptrlies t)seuoxo iydlp nmnct s sDtr(rpot4apt mf3iatfs ua(mpnu4 lxnir ta1lptrlivol( texmir oo4lpen nvtl(  2ururo;o0tleo f3tld s ra(mp ()trtnxr iodomDrlnvol(0t2urxrpoo4oleemicsas a2ra(moot1oltnii3iaslsDemumo (0tetrir3to1lptelueol(  2xo(o3nu4aleemnesl(fsrumu poo4olx  oetlsfs ranmpn(0tlxoxrcoa1faD  nvo;()s2tmxm3nodamtnmnctlsfaDtruro;t4oetnmocild aDum(vsn()aexoif3tadfmt ai i t0srxoim3no4apt lnesls sDtmxmpnu4olxnmoetlt a2rmnmpnt)tlerifcty1om  anvilt)sexoxr iu4op nlictlt arua(mp;o1oltomfctadfm2uauvo t) rtnir3oodlpteliesls0texr(opou1ome  fesa(fsrraxront1ape ifctat mDumnvo;(4trtoio to1faDr ivil()srur(m no4op e fvia(f Dtmxrono4aexnmi3tyd sDeauvp;u)tlerxfcoadfateaies;t  ruoim3nydop  lnetls)a2raum ;u0aeeniieiydfs eaums t4 exnmo iydla r nvi () 2trimpnodal n nctas srrauro;u4tpx mocildfaDrm( p;(0tltomfctadom  au o s)srtoim oo4omtnmfcslt a2rr(mpoo4tptn oeiyd aDea(vp t4 rtoxoctydfm e iei;( s2umio3oo4ol nmiet tfaDrmxrp;u4tpt  ictyt aDuaump t0alxomfcoydfateaneils)t2toio oy1lmtnlfct ()sDrmuro;t4oexnmoeiadls ua(vo;(0areoxr3oa1oatr uvs (0 eumxo oy4lpt mivt s)srrr(  nt0altoioeiytlaDuanvsn(4alxnioctatopDe nvo;t0sruriopnydlptelivsls)aDrmu  ;u4tlenmo3iltlmDran s t0 lxoif iotom eli o s sruo(m3nu1apte nvi t)sDuaxr nt4aex  ieiytfaDelu s t4teenmr oo1fp raueil(0trxo(opiodap  lfcia( aruaumpnu0aeeoif3iyd s2emu o;u)tltoifciytomte uvi ()seumxopno1ap  mfcils  Dum(r ;u4aleo fciad sDrl(vonu0tleomrcoadop raiei t)t2to(r no1olt micslt s2tm( pou1oexo fetytfa2ea(vs;u0 exnif3ta1fatr n o;( t2toir3iudllenmfvt sf rrrxm ou0tpeomfciasfmDumn o;(0altnmoctotopDrlieolt0 etmxr oo4alt mnvsat)arrruroot4altnioctytfaDrluvp;u0 eermf3io1fmD liei;t srumimpnu4olee ncta()arraxrp;t4aeeniieiyt m uan s (4aeeoxf3io1laD  neo;t)trurxr3no1llenmfct tf Drax o;o0aeeo oeiasls2rlu o t4tlxrmocoytfptr n sls trur(mpou1am   neta()sruax o;o4oee mfetytfa uanvp t4 leoxrciytlpD  uvsls) ruoirpny1lpt  nvtltfsrraxm ou0aleoiictlt s2eaump (4texnxrcoatfaDr n o;( s2urxopny4lptelfvi ( aDuax oou4aexnmfctasls2umnvon(4 lenxfciytom r ueols)srxrir3oy4omt lfct t) rtau  ;t4tptn o3iat m ua( s ()artrxr3iytoa rln o s0 etrio3ny4apt liesl(f 2raxrpot4olxnmfeiatfaDumumpnt4 exnmrctadlptr ueols0srxoir iodllee ivsls)aDtmxm nt4ope iiciatfsDul( o t) leomr3ootomtrlneslt)trurxr io4lpenlicsa( artmumpnt1tle moetltfs2ra(vont4areoifciydoptr neo (  2xm(o3iy1ol  mnet sf rtmx  oo1tlxo f3iasfm ul( o;u0aexrif tatfpt aneils0setmxo iy1al nlnct (f 2uaxro;o1ape ioeiadfs emumpn(0 rermfciydfp e i i;s)trumir3iudlp   icilt)arta( pnu1oexomictyt a2ulu o;t0trerxr oytlmt  neo;s t2urir iy1lleemfvi (f Drm( pnu1oeen f3iatls2um( s;(4 lerxr io1fmD  ueo;s)s2xo(opiudal e ivta(fs2rru  nu0tlxo octltfm rl(ms u4texnir todfa rlu slt) 2xm(o iodamt  nvilsfsrrm(  ;u0olt iieiadlmDumnmo t)trtrxr tatlaDe ivil(  rur(o iodlp n fcsls  Dtm(root0olenmfciltfs2rl( s;t4 eenmfctadfa  ai ol()srxoxmpoy1lp nmivsat  rumxrpoo0ale mietydlm2emump u) lxrmf3oo1lmtrluei s  rxo(r iy1omen fvt t)s2taxront1oleoio3tyt s2ul( s t0 renxrctodop ean i ( s2tm(o3iodol eliesat)aDrmurooo0oltn fciatfmDel(mpn()teerirctadlatrauvs;t0 rxrxm3iu1ll e nesl( s2rrxm nt4oeeoiociat sDuln snt4alenifciodlptean i s0s2tmxo3ou1lmtnlfvsas aDtr(mo;u4opx moeiyslaDran o u)alxomo oodlm eanei t0sexm(o no4apt mfesa()srtaxroou4alenmf3iasfaDumuvsn(4 renxf iatoatrau o ( seur(mpno4ap   nvt sfa2ur(r ot1tee mfetatfs uanmp;t)tlermo3oytfa r uvo;t) etmio3iy1lmt livtls)srtmx  ;t4tleomi3tls mDumuvs ()altoxo3tytfmDr uvols0srurxm3oy4llt  ivi t) rrrur ;o0aee iocilt s uln s;()artoio3oy1fm  auvi;(0 rxoxm3nu1opee nct sf 2uru  ;t4tpeo ieiltla uauvp;t)arxomrcoydlmtraieols0setmxr3nodlltelncslt  rtmu ont4ope mfciadfaDelnmpnt) rxnio3io1oaD  nvilt s2xm(r3iu4ap n fvt (f 2ta(moot0aetoii3iltfs2uau o (4alenio iatomD lneols t2xrxopiodll nlfvia()a2tmx pot0alxomoeiydlm ea( snt4 exrir3oodopDrlueols)setoir ou4lptnlfeslsfarrr( pou4tptoii3iltla2ra(vp t4artnxo3oatfmDe neo s0 2tmiopnydlpeemfvtls)artmurpoo0oexomo3ils m ua( on(4altoxr3oatlp  ai sl() rurio3nydol emnetatfsDrmuroot4oexo ietasfs2uan o;u0 exrxf3oadfpt au s t0t2uoxo3ny1omt lfvil(f 2rmxrpnu1oeeo o3iasfa ua( p;t4trermo3oa1optranvo t0srtmiopnydlle lnvtltfa2rr(m nt1tlenmfciasfm2rl(mp t0aexoxo oy1oa  an s;(0srtoxo3nydom   fcslsfsDrru  ;t1teenio3tls a rlnvsnt)aleoif oytlaD  neo;( tetoxrpiu4omt  fei tf rururpnu0alenifctasfa rlnvont)alxoifctatfa  lnvi;s0 2tmir oudomenlnei tf Drmurpnu4oex  feiyd s2raums;u4texomfcta1op eluvols  exrim3ny1lm  lneslt) Dtrxmonu1ape mfcils s2ul(mp;u4 leomf tadomDr ueols)srxmir iy1lp emiesls a2urumonu0apenmfciasla ra(ms (4teeomocoytlat  uvi s0t2xrir3ny4optnlictat) rtmuro;o4apeomoeiadfaDrmn s t4 ltomf iotlptrlu sls0 exm(opou1ame mfcia()aDrrxroot4aexoiiciltls2ulnms;() etnmf3ia1lpDeaivo;s)s2xoim no4am eliet ( aDrr(m oo0tpxo oetatlsDuau s;t0texnmf3iadlpDelnvo ()srxmio3oo4ope lnctatf rrm(mono1ole mf3tls m2ran p;u4 eeoif3ty1omteaueo t  2toxr3iy4aptelies ()a2ua(root1tpen ieiasfsDuln pnu)alerxr iatlat  ieol(  rto(r3oodllenliesasf 2ua(mooo1ope mo3iasla ulums (0 ltrioctodop e ueols  etoir3oudal emfesls) rurumpou4oleo o3iydlaDel( s t0tltnxf3ootfp  ai s;t srxrxopoo1lm n feilt sDrm(rono4oeeo iciytls2ra(mp (0tltnio3iydomt an o;t)t2tmxo3nudop e iesls  2rmu pno0oeeo oeildfm uluvsnu0alxoio3tytlmDe ivs ( srtrxr oydope lietat)s2umxr ou4apx mf3ildlsDrluvo;t)alerio3iatomtr u i t  rur(r3iu1ope  nctl() Drrx poo0apxnif3iaslsDrmn o;(4tlenmf3todlaD  ivolt)trtm(r3iodale  fcia( a2ra(  ;o1tpen f3tld sDulnms;()texriociy1om  au o;t s2xoxo3ou1amen fetls sruax p;t1aeeomociydla2eluvo u0 lxrxrciy1oa  anvo s  2urir3nydlltnmiesls)s2rmxmono4aexnioeiasfa eaumo;(4tltrmfctytoatrln s s srxr(m3oodoptn ncilsfsrrmu pno0aptnio3iatfs ra(ms u)altomf oatlptr u i s) 2uo(m3iy4omtnlnvs t  2tau  ;u1oetomoetytls2umuvsnt)tlenif3ia1lmtelues;t) 2xmir iudol   nct sfsrtrxrooo0teeomf3ilt aDeln p;(4aleomrcoytfaDr ieo t0t2xr(o3io1aptelfvt t)arrrxront1tet mieiasls2ra( s;t4arxrxr tatla  lieil( s2toxo3iy4omtelfcs s)arrm( ont0oex mfciysfs uau p;t4 exrxrctydlmtrlu sls)truo(m iy1lm  lnesl(  rurx onu0tet if3iysfaDranmsnt0aetoir iotom r u i ( s2xmxo iy4apee nvtlt)srta( pno0aleoifctydfa rau s t0trxrmr tytopD  n s ( teto(m nodlptemfesasfs2ua(ronu0alxn fcilt a2um( sn(4 exomf oydlpD aivo;t seto(rpoydome lnvil( arumxrpoo4apx ifciyd a2rauvs;t0 rtoxf3io1fm  lnei t) rxrio io4al nlics ( a2rau ont1olx io3iytfsDem(ms;(0trermr3to1fmtr ies;s s2toxm ny1lmen ivt s)aDrm(root1oet  f3iasfs el(mo ()tleoxo tytfaDe ueo;t) etoir oy4llen ncil( arrmu pnu4aetomo3tys a2ulnvsnt0 renmrciodfat li sl()srtmiopnudoltnmiei tfa2umumooo1oex mi3ild a2um(ms (4 reoif3iy1lpteau i s sexrxm3oy4optelfcsls s2ra(mpoo0oee mf3tysfm rmuvo u4altnircoy1fp  lueo (  euo(o iodll elfcias a2urxm no1oexnio3ils a rmnvont4 exoxocoy1opDe uvil(0trur(o3iydapenlneiltfsDurxrp;o1tpt  icildfm ra(msnt0 lxnxf3io1lp   ueo t0t2xoimpiodop nmnct ()s2tm(rp;u0aeeo fctltlm rm( o;t)trtoircoodlaD  uvi;()setrimpiydap nlnetlsfaDrrxmp;u4oetomi3tasfs ea( o u4 etrxrcoy1fmDelnes;t0teurxo nu1lle  ieilsfa2taxr oo0teto oeildlmDrmump ()alxnifcoy1opD auvo (0 rxoxm3nudlmenlies s  rrm(m ;o1texn ietyt sDul( p;(0 rerxf3oy1fmDeaivs;t)trtoxo3ny1lp nmnvtas  rtax  nu4olenmociasfm ea( o;(0trtnxo3ootomt livs t  etm(mpny1lp elfci t) Durumo;u4opt  oeild s2umu p;u)alxriocio1oat lueo;s0t2tm(m io4ll e fetl(faDrm(mpnu4oeeo iciatfmDrauvs;(4trxrir3oydopDrln s () etoxr3iu1openlivi (f 2uaump;u1texnmo3iad a rlu ont)texrmociytlatr ies;s setrxopnu1amen ivt t sDtmxm nt1tpt mietysfa2eanms;t)tltnxfctodopD  ueolt seto(o nudlme mfcias)s2tmx p;u4tpt iocildfs2ua(vs t)texrmr oodlm  auvi;t0seuo(r ny4lmt lnvt t sDrmx pnu4oeeomf3ilsfm2ranmon(0trxrmfctatoa r i s;t srtmxopio1lltelics t  Drau oot4tpxnmociad aDum( snt0trtrxf3iytfmteai sl(  2uoir oy4omen icil()sDrrur ;o4tpe ifetatls rmnvo;t0 etoxocoytlaD  nvils0 etmxr3no1lp  lfvi s aDumxmono4olen o3ils m ra( p u4 ltnmf iadfp e ieils0 2uoxm3ou1al   ieils  Dur(rp;o4oet mocild sDul( s;t4 lxrif3todoateaivi t0t2to(o io4op nmfei s)aDra(rp;t4tpt  octyd s2ra(vp;() rtoio3ty1lpt  ueslt0setoxo ou4omtn nvilt)sDrrxmo;o1tleoiociad a rl(vont) eeoifcoydfaDeauvo ()trto(m nydll elietat) rurumoot4tpxoifctatls2eanvo;t4 rxrmfcoy1fpDrln ils  2um(m iu4om n ieiatfaDrmx  ;u4oee mfctld m2ua( ont4arxrxr oo1fpteaieols) 2to(m nu4olen fvi (f 2umxrpno0alto ociyt aDuaump;()areomrcia1lptelneilt  2ur(rpny4al  lies t srrmurp;o4tptoii3tldfm rau p () rxnio3oo1lp   i ilt0sruo(r nodalen fcs t)s2urxmonu4olen ociys m eau onu4teermf iatlptrau o ()srxmxo nudam  mnvi tfsDua(root4tptnmfeiatfsDrmuvp;t)altnxf3ty1op r n slt s2ur(opio4op nmfcia( aDtmum ou4opt ioetydls ra(vp u0tlxnmo3ty1fmt au s t)trtmxopiy1ol elnci ()arumurpnu4oltniiciltfaDel( p;(0 rxoir iotoaD  iei (  etmir3oo4amen ieta() Dua(mooo1optomo3tyt a2eauvs t)alxrxr iytop eauvs (  rum(o3io1am  mfcs t)aDtr(r ;o4tetomoeiysfs uanvp ()aetrmo3ty1lmtrln s s trur(opiu4open fes (  Dta(ro;o1aexomiciat m um( sn(0alxomr3iydfa   ivi t0t2xmiopiodam n ncilt) Dumxm ou1optniiciydlmDrl( s;t) rtrif tytlpDelnvols0 2tr(m3oy4alte fei sfa2tm(mpnt1aex mf3ilt s ulu o (0areoxo ia1op rauei ()srxoxr ny1llee ietlt a2rm( ooo1aeeomoetytfa2ul(vo;u4tlxrifcta1lm e uvi;s0setoirpoo4olenmict (f 2um(ro;t4oet moeilsls2ua( s u) lxomr ty1latr u s t)tetr(rpoodope micsa()sDtaxmpnt4olx  oetydls2emu p;t)tlenmf3tatlat lneo s s2xrxo ny1al  livtat  Durum ou4teenif3tlsls2el( pnt)altoxrciodla elnvol()setm(rpnydapenlivilsf rtmx  ;o1tpx mo3tytlmDemnmpnu4aeenifciodfp r uvols seuo(r3oudopeemfci s)s2urxmpou1tetomfeiltls2uauvon(4aeerxf3tytlpDr ieol()trtrxm no1omtnlieiasfsrrauro;u4ole mieild mDemuvs;t) exnxf3oadlptr nes;t tetr(m io1opeelnctatf Dua(mpnu4tetn f3ils m2ul(vs;(4trxoio3iy1latelnes t)trxoimpiodop  lnvtlt sDtmxm ;t1ape ifciasfm2rmuvs;t0aetoio oadopDrluvil(0s2um(r oy1openmfei t srrr( p;o4oltniocilsfa ulnvs t4tlxomo3oadfp  lues;( t2xmxo nu4llen nvia(fa2tm(m ot0openmf3iadla um(mp u4trtomf3iadlpD anvo;() etmxmpio4llt mneia(f 2uaumoou1tltniieiltfs2el( p;t) lxnxo3oytlaD ln i;t)trtoxmpiu4aleeliei ()a2ur(m no4tee ioctadlm rlu s;u0teeoxf tadfmD  u s;t0 2urim oydaleemfvtls) rtaum ou4apeo f3ildfs2rluvs t0 ltnir3totfptrau sl( srtrxo iodamee nvs ( a2rr(mo;o4tle ifeiys m2elu p;() ltrmr3oy1lpt aies ()seuo(opoo1ap n ietat)arumxmoot4olenmfetldfa2uanmsnu0 eenxr iodlmt lieo;(0setoiopny1aleemnvil(fa2taxmpnu4olen ictytls2umumon()arxomr3iy1oaD luvo s)t2xmxrpno1lltelics (  Drmu p;u1tlenmi3iyt s umn p;u) rtrxfciatfmt livsl(  etoim nu4ape mfes s)s2um(rp;t4tpen i3tadfmDrm(mp t)trenxf totfp  anvolt0t2trir nudaptelfes sfaDurumoou0open i3tydls uluvs u)areomr tytoat livi;(  rtoiopiu4lm  lncsls)sDtmxm ou4oexnif3iad m2rm(msnu)alxnif3oy1lmtrli s () euoir oydop nliet (  Duaxm ou4alenmf3ils sDul(msnt) exnir3iadfpDelnes;( trxr(o3nodlltemfcs s)s2rrxr oo4tltniictldfmDuaumpnu4 lxoxo oytlmDr n o;() rxm(o oo1ale  ictls s2rrx p;u1opxoif3ilsfaDelnvs (0areoxr iydlm  luesls0teto(r3ny4omtn icias aDrru  ot1opx  ietys a uau o t4trermrcia1fp  lnvi;( srtoxm oudale  fcilt) rum( o;u1tetn oetadfsDrau pnt)artnxr3iytoa rlneils0 exm(r io4om elncsas artrx  ot1alt  octldfs2rmn o;(4tlxoio iodomDr u slt0 rxoxmpoo1lpe lnvs (f 2trx  ot0apxoii3ils s rm( p;u)arxrmoctodlptranesl()tetoxopio1omenmicils s2ta(  ot4tpt moeiatfsDuluvs u)teenxf tytomte uvi ( srxm(mpoy1apt mfvtlt)sDtax pot1opx if3ilsfaDeauvs t4 eermr3tadlmteln i;( tetr(r3nydap  miviltfartmur ;u4oet  o3iytla rmnms;t)aexoxocoo1fpt aneo;t0 exmxmpoudope mivslsf Duau  ot1teenmociadlm rl(mon() rxnxr todomtrluvs t)teum(m nodlmtn netlt)artm(moot4tleomo3iydlm emuvon(4altnir3iatom eaivi;( trum(o no4lleemfviltfarta(  ot4teeo icils aDelnvon(4aetrmf3io1om e uvi;(  2tr(opnu1am  mfesa(faDrm( pnt1ape  i3iat m uln p (4trenifciadlatrlivi;s teuo(m3no4lle mivt tf 2tm(ro;t1opeomfctydla2eaump u0trxoxo tadfm r nesls texrio io4olt  net (  rua(mpot0tex ifeiytla ul( on(4treoxrcio1faDr i o;t0sruoxopio1ap  miet (  rumuro;u1tpt ii3iasfa rmu o t4arxoxoctydfp  anes;(  etrio ny1lpenmicsas)aDtau  nt4tleomf3ilsfaDrmumpnu0aeeoiocio1omte n o s texrxopnudop e icsa()a2taumpno0oetnmi3iysfaDrlnvsnt4 rerir ty1fmD  u o;t)teuo(r io1ape  fctlsfarumump;t4tetnmicils a rau s t4teerxf3totoatelueslt trxoir ny1am nlicil(fs2rm(m ;u1tpen fctlt mDum(vp u)areoxf ta1faDraivsls sexrxm3no4lle lfvt t srtm( pou0alt ifctlsfaDrl(vo;u0arerif oydlm elies s  etmxm oy4omtemivtlt  2rmxmp;t1open i3iasla rauvpnt)aetomr3oydfmte iesl( s2xmxm iodllenlncsltfa2tmxrooo4oetn ictlt m umnvo;(0 lxnxr iy1lp elu ol(0trtr(mpiydll   nei t)aDtmur ou4alxnmocildlsDrmumo;t4 etrxrciodfp r nes;t  2urxrpnydolte neilt) 2taxmpnu1oet mieiadls eaumpnt4tlenxf oy1oat  u s s0srur(o no4lmen neia() rumx  ;u4openmfctyt s2uanvp (4 etnmo to1fp e ueo t0trxoiopoudll n iviltfsDrr(rpnt0optniietls sDrmuvp (4artrio3iydfpD auvs s sexmxo nu4omee iet tfsDrmxm nu4apx mf3tlsla2el(vonu4 lenxf3oytlmDe uesls) eur(mpny1llenmnvs t)srurx pnt1oltoii3ias aDumu p;u)aexrmf oa1lmD an o ()sexmxm3oudomt miesls)aDra(r no0tptomoetlsla2emu onu)alxnxr3ia1fptrauei;s t2trirpio1ol  mivtlsfsrumx ont0tlx mociadlm2rmu o t4aleoxrciy1oa rau i;(0s2xrxm3oodlmeemicil(fa2uaxmpoo0alxo feiyd aDul( sn()tetrir3iodoa e iesl( srxrxo3oudol   netlt  Dumx o;o0oeeniociyt mDrmnvp (0 rxrio3tatfaDr i ol( t2tmxo3io4omee fvsl(fs2tmurpnu1teeoioctaslaDea( ont4tlxnio3tydfmD auvs s)srtm(o ou4apt lfcilt) 2tm( onu1tee iieiytfs2ulnvo t) exrio3oydla e ivols sruriopnydomte fvias) rrr(rono4tltomo3iltla2ulu s t0 ltnifcty1op  lueo;s0s2xrxr3no4llt mnct sfsDtr( ono4tleomi3iytfm2el( s ()trxrxrctodlmD aivs;t0 2umim3ou4ol  lnci (f rrrx  nu0apen oeiltfm2ea(mp u)trtrxo3io1fm  ai i;t)t2xmir nudlm e feils) rtauronu1olenio3iydlm emuvp;t0 eeoxf3oy1fpDeanes t0 2toxo3ou4lmen fvsl(fa2urxr oo0aexoif3tadlm umnmont) rtnif iadlaDeauvi;t0s2tm(m nu1lpenlicsas)sDuau pou1oleo fciysfs2rlnvpnu0 exnir oy1omDrlu sls t2xmim3oo1oltnmfcil( a2rr(  oo0aeen ocildfmDrlumpnu)arxomfctadlp elnes;s0t2tr(r ou4amtnlfeil()arrm( oot1tetoioetyt a em(vs u4tetrmr3tytfatr ieo;t)trurxo nodop n fctasfs2ra( ont4alxn i3tyslm2eaump t)arxrmfciytlaD aueo;(  2xmir nydaleemnvias)sDuaur ou4oex  f3iyd a uluvsnt)aexrxr3todomtrlnvo;s0 2umxm nudope mies sfarrm(  no1oee mfciadls rlu s;u) rtrxrcoytlmD anes ()trumir ou1optelici sfsDtrumont1oexo fcildfm ul(mp;t)trtomr3iatfmte ueslt0 2ur(mpnydom  lici sfarumx  oo0texn feiytla2ua( p;(4areoif iotlp eluvils)tetoim3iy4opt  feil( s2raxmo;o0teeoif3iyd s rauvo t0artnmo3iotla elu s;t0tetmxo3oodlmte neias)a2um(mo;t1apx  ictls sDrmnvo;u0teeomoctadomDeaivi t t2uo(o no1olen ietlt)aDuaxm oo0apxnmfeiys a ul(mon(4tlxnio iy1om rlu o;t0trxoirpoo4om e ictas)aDua(mooo0tltn f3tad sDuaums;u4teermf3tatlmt  ues;t)s2tmirpno4lpt liei t)aDrmx pnu0alto f3iydfs um(mp;t4aetoio3oytoptr i s ( s2uo(o3oo1ope  ietas)artmxr no0optnmictatfs umnvsnu4tlerxo3oa1lp ran o;(  etm(rpnydoptn ivslsfsrrau  ;u0aptn ociatls um(vsnu) exoir3ia1fmtr ivil()sexmir iodal nlictls) Drr( pou4tlen ieiys m rl(mp;() eeomo oo1oat luesl( teum(mpiu1opeelnes sfsrraumoou0aexo ietltfaDea( o (0 ltoif oydfm elivo t0t2xm(o oo4amte ivils a2uaurpno0oet mfciytlm2rm(mpnt4texoiocoo1fmDr nvs;t  2xr(opiudlmeelicta(  2raxm ou1texnmf3tld s2em(vs;t4arxrxr3iydlat anes;t0s2xmxmpnudaleemfcs (f 2tmum nt4apxnmo3tas mDuanvp;u)trxoxr io1lp rlneolt tetr(rpiydom   fesltfaDrru ono4ole  iciytfaDean s;u0trxnif ty1opte uvs s)t2xr(m3iy1llt  ietat a2um(  ot4apxn o3iytfsDrl(mo;u0aeeoxf iodfp   uvils0trxmxr oydol e fvtlt) 2uax  ot0olxnmfciytfm ranmp t0aetnxo todlpte n o;s) 2umxr iy4omee fcsa()artm(mpou0tetoif3iltlm2rauvs ()trxnmo iytlat ai slt0 2uoxmpio1lpt mneslt  rtru p;u0tet mfciysfs2rm( p;t)arenircoytlat aneo t)texrxr3iudol  lnes t srum(ro;u4oeen ietatlm uluvo;(4 rtomociydoaDraies;t)s2tm(r3iu1apte ict t  Dum(rpnu0opt moeiltfm umuvsnu4trxomr ty1faDrln sl(0s2tm(r3io4lm  mnvtl(  Duaxrpou1opx  ieiatfsDrm(vp u4artnmf iadfaD ai o;t)texoim3iy1apte neslt)a2uaxmp;t4oexoioeildlm2rau ont)aetrio oa1opteaieslt t2xmimpny1ll elfcils srtr(  ;t1oltomi3iadfs2el(vp t)alenxf3tytlp e ieols0 2trim oy1llt liesls) Drrxr ot0apxo iciatfaDelumsnt)trenxo3oodla  auei t)t2uoim iy1lm e ies t  2um( pou1tpxniietlt mDul(ms;u0 rtrif3oytfp  lnes;()sruoio iydame  fcs tfsDraxrp;t4oltoii3iasfa2elnmpnt4 lenxo ia1oa eai s;t trtm(r3oodomenmicilsfsDrmxmpnt4alt mociydfs2ua(vsnt) exomfciatfateau olt) rum(o3iu4amt lfetat arrmurp;o1apxo fctysfa2em(vsn(0texoxfcoadlptraues (  exo(o no4llt  nei t)arurxr oo4tptoiieiyslmDraums u)artoxf to1oa eli olt seumiopiy1lle lici t)aDtr(ronu0tptnmocilslm2elnvo u4 lxrmociadomtrluei s) exmir3nydlp e fctat  rrr(rp;o0opxo ieiydfs ra( onu0 leomf3totla rlnvo;t  2tm(m3nu1lpt lnvsl( artm(rp;u0tlenmfetatfa2ua(mp;(4 lenmf oodomt aues;s seum(m3io4lm nmicsls a2trxmo;t4texnii3tlt aDulnmo;t)trxoxr oytlp  aueo;(0setrxr oydal  mieia(f 2raxmp;o0ale mieiysfmDranmonu0aexrxr iytfm e i s t0s2urio nu1lpen neilt) 2rmxrpnu1tee  o3tydlmDrl( s u) eeomf3io1om eai o;s)t2xmxm oudopeelfctlsfa2trx onu0ole iiciasla2eau onu4 ltoxfctytop e ivi;t0s2trxr3iu1omen fvsatfsDtaxrp;o1tetn oetyd m ea(ms;u4aeeoir3oodop rli slt0 2tmxrpio4openliet sf Drrxro;o0apxnmi3ilsls ua(mp;()aleomf3todfp r i slt)t2trxr3no4lltn iet sfa2tm(rono0aex mociltlsDemumpnu4teenmociadla e nei;s tetm(r iy1olt  icta()s2raxr nt0tetn i3iytfm rlnvsnu0areoio3iy1op elieil()trur(o ny1omte ncsa(fs2uaur nt4tptn fcilsfs2ranvs t4texrifciydoa  lueo (  rto(mpnodam n fviat a2tmxrono0apxnio3tysfa2ra(vsn()tlxnmr totopDe ieilt teuo(opnodlltnmict tf Drmurpoo4apxn f3tatla2rm( o;t)trtrmf3tydfaDe n i;t0srxm(r3no4alt livs (fsrur(mono0alt ifcilsfm ranmo;u4aexoxr oodlpteau o ()s2xrxmpoo1am  livtl(fa2raxm no4alxnio3tltlm uln o (4 rxrmf ty1fat  n ilt  eto(m iydlm elivil(f rrr(mooo4ape mfeiys mDuau s u)aetniociy1lp elu s t tetm(m3oy1omenlnvtlsfsrrrxro;o1tptoii3iydlmDrmums;() lerif3iodfp elu i s0t2tr(o nudlptemfvs t)srum(r no0oeeo f3ilt sDem(vo (0 reoxr3ta1la r n o;(0 rxrxr3oudomen ncsa()s2uru  oo0texniietytfs2el(vpn(0arermf iytfp   iesl()s2tm(r nu4llee neil( a2tr(  nt0tpx  ociasfmDrm( pn(0 rtnif3oodoa eaivi;()s2xoxo3iy1omeemfctl(fs2umum nt1oee mo3iadls rm(vp;(0tleoxo oa1fm  ai o;s0t2xrxm oy4apte ietl( srtaxm ;o4oet moeils m uln p u)altrir3oodoa r uei t0texrim iudaltnlfvtl( a2rm(m ot4oetn ictatfm uluvonu4tetoxo to1lpte nvilt0sexrxm3io4ame micsa(fs2tmurp;o0ope  feildfa uln o t)tlermf oytfa e neo;(0t2umirpoydal e icil( s2rmxm ot4tlenmi3tltla2elumpn(0trtoio ia1fpDelies;(0srtoim nudolt lfvsa()arua(  ot4tlxn ieiytfs2rau s;u)aetrxr iadom  lu s;t0sexoxr ou1ap nlneta(f Dtaxr ;t0alt  oetad a rluvs;u4trtoiociodlaD luvs;s s2uriopoydalenlicsat)srrmum ot1tetnmfciat m2ua(monu0tlxoio3iytom elueo ( sexoiopoy4ale lnvi t  2uaumoou4tpen fciytlaDean p (4trenir3iodomt ai ol()t2umio3iu4lpeemfet (fsrumxmpou0tet ifeiyt sDemn p;u4aleomoctytfptrlnvilt srurxrpoo4llt lfcsa(fsrua(mp;t4oltoifeiytfsDulnmpn(4tetrxo3io1omt livol( teurirpiydamt miviat  Draumpno4aptomoeiydlm el(vs;t) eenxocoatfa  ln sl()sexmxm3iu4llt lfesa( sDrau onu0ape  fciydfmDuaums u0 exnio3oodfpDrlnes;s t2xo(opnu1om nlfvi sf 2um(mo;o4alxn icias sDrm(mon(0artoxf tatfaD  nvs;t0trxrio oy1al   fesls sDum(mo;t1tee  oetysls uauvs;(4alenxfctatlpte n i (0truoxr oydlpt mnvtat arrr(  no1apenmietysfm2rln s u0aexnxrctytoa r ueo;s  rurxo ou1olt lfci tf 2tau oot4tpto ietatla rm( p;(0 rxrir ty1optranvo ( trtoxopiy1lmenlivilt)a2uru oot0texnio3iyd s2ranmpn() etrio oytop elies s0 rxmxo oodap e fetl( arrau oot0olx  o3iyd a2ua(vo t) ltrifctodlm eaueil(0seur(rpoodame mneias  Dtrxmp;u4aptomfciyt mDrmn p ()aetoiocoadfaD aues;() etm(rpiy4oltnlieils a2um(mont4olx mieiyt sDrlnvp;u4 etrxrcoodopDeaieo;(  rtrxrpnu1lmtelfciltfa2rau ono4teenmf3iysfaDum(msn(0 ltnxrciytlmt lnei t0 2xrir ny1lpe mieia(f rurxmpnt1tlxo f3ild m raumont4 eermf3tydlaD aieo;t t2tmirpoodol elies t)a2rrum ;o0tpt  o3iyd mDelnmpn()tleoxf oy1fp  anvo;t  2um(rpoo1alt mnvsl()srrr(mpnu0tlto ocildfm em( o (4tlxrif3tadfmD  ieo s) eumxrpiy4ap n fct tfarrm( oou4altomfcild m rmuvs t4trtrxocia1fpt livo ( srtmim io4opeemivtas srrm(rpnt4tpxo fetyd m2elnvs u4aeenmf oy1omte u i (0sexoir3io1ale mfetat)s2rmu p;u0olenii3iadfs ran o;u0 eerio oadlp e n i (0 2xrxr3oy4lmtn ieias  Drrx  no1olx mfcild a ra(mpn(4arxriocoytlaDr n i s0 rxmxo3ny1lm   ieias a2rm(mo;u0olx iietlt s ua(vo;u0 etrmr ia1fm  aieo s texm(o nudameelncsat  2rruronu1oltomfciys m2eluvont)aetrif3oytla e ivo t0trtoim3oydlm nlncils srtrur ;o0tlxn fctatfaDua(vo u) etnmf3iatlptr uvilt0 rxoimpoo1lpe lietls) 2ra(m oo0olt io3iad mDumump;u4teerxf iatopt li ilt)truoio oydlm nmncil()a2tmurp;u1tlenii3ilt m2elu p t)trtoir3iydomDeauvslt) rtrir3nu1omee nci tfaDtaxr no1aleoiociysls2rluvp;()aleoifcoo1fpt lu i;()t2uoio3iydam   nesat arra( pno4opeomfetysfsDrauvsn()areomr3iytom rlivo t srtmir3ou4lp  mfcs ( s2raxmp;u1aeenioetls mDum(vonu0 leoxfctatfp elueo () rxrir nydalt  fcta(fs2uru  ;o1apxniiciasfa um(mp t0altoxf iotlp r iesls  2xmxm iu4apeemfes tfs2rmu  nu0tetomietldlsDul(mo u0 eerif to1fmD an slt truo(o3iodomtemivilt  rua(  oo1tetnmfciys a ranvsnu0tlxoxr oydfp eaies;s seuoxm3io4omtnlivtls)srua(moou1tex ii3tlsls2ul( s;u0areoif iydomDeaivo;()tetoimpoy1omtn nesas  Dra(m ou1altn ociaslmDrmnmp () eermfcoo1opDelu slt0tetr(rpio4am nmnvi (farta(m ot4tpxoifctytfa2rlnvs u0tetomrciatomt  nvolt s2xm(mpny4lm e ivs ( aDtmxm ;t4olxoifeias s2rl(mp;u)artnxociydlmD lu il( teur(o3oydlpenlfvias  Durx  nu4teeo oetadfs2emu p u) rxrir ty1opt li i ()trumxm nu1opte neiat aDumu  ;t4optn octltfmDrmumon()trerxociotfmtraieilt0s2xo(r oodam nlivs t s2taxm nt1optomi3iys sDea(msnt4tltnircoytlaDrlnei;t s2uoxo3oy4llt lnctls)aDrr(mpnt4oet  oeildfa uln s;t4trtoir3io1fptrauei ( texmio3ou4op  mivsls)sDrm(mp;o0tetomoctyd a2uau o;(4tlxoxr3tadlmD luvslt)texr(opoydlm elict () Dtm(  ;u0aptnmo3tlsfm rl(mpnt0aetniocoatfmtr uvo s)t2xm(mpno1olenlnct t)sDtmx p;u4tptoif3tysfs2ulnmo u0texrxrcoydlpDeluvolt  exrxrpou1opt  fct ()aDra(rpot4oeeomfetadls2uan o u) ltnircootlateliei;s setmimpny4lle lfcsls)arraump;u4aeen i3iadfaDean s t) rtnio3iytfmDe ues ( trto(mpnu1opeelfvi () rtm(m oo0aex ifciys aDemump u4 rerif3tadfaDrau s s s2toim3nu4alenmivi t arrrxr nt4aleomociysfmDulu p u0arxoif3tydfmDr u ils  etm(r3iudlltnmfesa(  2um(  ;u1oexoif3tad s2ulumonu4 lxrxf3oatopDean i s0 2xmxm3iy4apte fetatf Drm(rpot4texn octasfa2um( p;u4 lxnxo oo1lpt  ivs;t t2tmxrpiodlp nlnesat)s2uaxrooo0apeniietyd m2umnmp t0arxoif3iadoa eaueolt seuoxm iy4ll emiet ( artaxmpnt4olt  f3iltfm2uau s;u)aleomfcoo1fmtrluvolt0srtmir3iu4op nmfctl()artrumpno1apxoiictlsls elnms (0 rxrxfciy1optrliei;()seumim no4ol emnes tf 2tmuroou1tex  f3iyd a2ran o (4tltoxr oo1la e i s;t  2xmxrpio4am emnvi sfsDta(m ou0ope mocias s ra( snt) rtrxr3oo1fmD livilt texo(r iodoptnmivta()arra(rpoo4apt mf3iatlm2umnmo;(0alermfcty1opt aneilt)t2uo(r3oo4om e feslt  2rrxrpno1alxoio3tyd a2rauvo;u4 rerxo3oadom e i i t tetmxopoo1amen fet s srrrumooo4oltn feiat a eaumo u4tltnir3oy1optr n ol()srtoxm oy1om nlneils) Duax oot0tltoioetlsfa2uaumo t)artrif tadoaDeliesl( srur(o nydlmt lnetlt)a2rr(rono0tleo feiatls uan pnt) ltnxocoa1fm  aieol(0texmio3ny1lpenliesas s2ur( onu1oltomi3tadfs rmn p;t) rxrxr io1fp eaieolt seuo(opnudop e ivias  Dtmx  oo0tpx mfciatfmDrm( snt0 reoxrcoo1faDraueils0setoxr oudlleemiet (faDtm(rpnt0olxnmfeiadfm ra(mo;u) lenxr ty1oat lu s;()truo(r iydlp elnet sfsrumuro;u4tex mi3iatlm rmnvs u4 lermo oo1faDe nvo;s0t2uoim3oy4am nlnviatfsDra( p;o0oltnifetldfs rm( s;u0altoio todom e u il(0s2xmxm ou1optnlnvia() 2ururp;o1oetnifetasfa ul(mont0areoxrcoodoatr ieils teurim3ny4opte fct tfaDta(r ;t1tlx ii3iyt m2rau s u) rtoxfctodomte ies ()sruoxm nodlm e fcs ()arua( p;o1olx  ietadlm ea(vs t)tetnxoctytfpD ln s ()truo(opnu1llenlfeil(f rraxro;o0tlt mo3iydfm rau onu) rtnxf3iatomD lu sl( t2xo(o3no1openmncia(  ruau onu0ape  o3tadlm2ua(mont4aexrmr iydomDe ivslt  eumxr oo4ole lfct s)sDur(ront4tpxnif3iysfa em(msnt4trxomoctotfpt lnvols  eumimpoy1omenlfetl( aDrau onu0oeenmi3tltfm2ul(ms t0 eenxr ia1fpt aueolt0t2xrio io1ale  fvsat sDraxrpoo1oeeoifeildfmDrmu pnt0trenxo3ootomDr u ols0trxmxm3nodape  fctlsfsDuaxmont4tlxo fciydfa2rmnvp t0alxoxfciy1latrln s ( s2uoirpiu4am nliviltfarururo;u1tpt  o3tlsfaDemuvo;t4 ltnmf3to1fp eauei s  rxrxo3iy1llee icias sDta( poo1opxoifeiat sDumuvpn(4arxnxo ia1lm r ieo;s0srxrxo3ou4lm  micil()artrx  ;u4apeniieiytlsDelnmpn(4 ltrirctytlaDe uvs;t)texrimpiu1apee net t  rra( pot0alx mi3iyslsDrluvsnt) leoircoo1faD  ieo t)trxrim no4opte neta(faDuaxr ;u4aet  fetysla emnmpnu) exnmo3iodopD  ies t)seurxo oy1llt lieia(fs2uau o;o4tlt  f3tydfsDumumsn(4 rxrxf oydlpD lu sl( srtoxo oy1ape lieta( s2ururoou0tlenifeiyt mDrm(ms u4tleomo oo1lpte nvo s)setoxo oy1omen net (fsrtmu ooo4olxniictlsfm umnvs;u0 lenif oytla eliei;t0srum(o3iu4al nmfvs s srtr(mooo4tlx mfeiasfa emu o;u4altoxf3oydoa r ueil()truoiopno1oltelicsls)artm(m no0oltnmieiatls2rluvo;t4 renxrcoatfp ean s;t) 2tmimpny4lmt mictl(fs2tax onu0aptnmoetydls ulnms () rtrio3to1oaDrauei (  rxmxmpny1lmen nvi ()s2umur ot0ale ifciat s2ea(vsn(4 rxoiociadoptrli i;t)t2xm(r3iy4olenmfvsasfs2raxrono0apeo fctld m um(ms (4aexomo3iotoptr u s;() 2toir ou1ll   ivil( sDrrur oo4aeeo ietadfmDemumo;() exoxfciotlatean i;t) rtr(o nudll emfctls aruax  ot0apx  ictysfm2elu sn(4trxoiociadlp rlues s)teur(o3iodll elici s a2rmuront4tet  oeilt s em(vs;u4 lenxo iytfmDr ivo ( teurxo3oy1llt micsas  2tru  ou1oetomfciaslm2emnvo t4trxnir oydlm eln i ( t2urir oydom emnetat)a2rm(mpou1tpx  octad mDrlnmonu)alenxo3oo1lmtr ieo s0t2xrxo3iodomee ivsat s2tmu  ;u0alenmo3tydfmDuan pn(4artoircoytlmDe ivs s) rxo(rpiu4opt lnvi s  rua( onu0oexoio3tadlmDran ont) exoxf3iy1lptranei t t2toxmpoudlp e icsasfs2tmxmpou0tpxo oeils sDrmu s;t4aleoxf iotop r uvo;()seum(o ou1op n nei tfa2rrur no0apxnio3iydlsDeluvs;()arxnxo io1fpDelies;t  rtmiopny1aleelfet t  rur(m no4opxo fciyslmDulu o t4texomo oadlptraivo;s0trxoxo nodlmeemfeia(  rrru pnt1altomo3ilsfmDumuvpnt0alxomf3io1oa  lnvi s0trtm(o3iy4ll emfeiltf 2tmxro;o4tetomf3ilt s rauvont4arenxr totopDrln i t)teuoxo nu1lme miesa() Dum(r no1tltnii3ias s2ul(vs;u)texnir ty1fpDe i o ( sruoxm3iudoltelnvt (  2uaxront1aee io3tltla2uaums (4aetoiocoytlmt au o;t0srto(mpnydapeelict t a2rr( o;o0tltoifeilsfaDranvp u0alxnmrcootfp e ivs s)srum(m iudolte ivsa(farurxmo;o4aeeniicilt s umnmo;t4 exrxr oytopDr uei s0sruoxm iu1apte nesa()srrrxmpnu4tetniiciytfmDel( s;t) leriocootoa eaiesl(0 ruoio3iudlmeelfei (  2raumooo4olxnmf3iadls rlnmp t4 rxnio3totlmtrluesls0srxriopoudaptnmnetasfsDtm(m ;o0apt mi3ils aDeauvo t0 lxomociadlmD an sl( teuoxo oydlm n nesat) 2rauro;t1optomfciat a el(ms t0 ltoxo oy1fp   neo (0s2xmxo3iy4lm emieslt) Drrxm ;u4olx moeild a2rlump u)alxrxo todfp  an ilt)teumimpno4al e ieiat) rtaur ;o0oltnmieiltfa2rlu snt0 renir io1lp  lneslt  2um(mpnodlpee fctls srrru ooo0alt ifeiysfsDumuvsnt0teenmo3iadfaDrau s () 2ur(rpou4aleelnei t)s2tmumpnt0alxnmieildfa2umnmonu4tleomo3oo1lp r uvi s0 ruoxo3oo4lmeemnvtasf rrm(root4apeoio3tasfs2uanmonu)trxrmo to1laD ln s s t2uoxo3iu1ol nlfvi s)s2trxmpnu0oee io3iatfsDua(mp t)texrio iydlm elieo s0trxrxr3iy1ll nlicsa(fsrurxr ou1apx  i3tyd m2umnvp u4 eenxocta1lp eauvi;t0s2xm(o oydalte fvsat) 2ua( poo0tpt  oetad aDel(mpnu)tltomo3oy1fp raueo;()s2xo(opiu4ol nmnci s) 2tr( ono4oetnio3iydfa emums t4aexomoctadfmtr uvo;()teuoxo3ou1amtemfei s)arrm(root0ale mociytls emump u4aetoxociytoatrluvils) eurio3oo1am n fvtat)aDurx p;u4oltoifcildfmDeauvont0alermf oydoaDr iei ()s2xmxo io1ol nmfeiat a2tmum ot0aee iociltls2emn o (4aeerxocoa1fm e nvs;t0trtriopoudam elivtatf Duaurpot1aleo f3tldlaDrluvonu4 leoir3oo1latrln o s0sruoxr3oy4am nmfvil() Dumx  oo4tptomieiytlmDrl( o;u)trtoxociadfpDeanesls) 2urxm iy1amtnlivt t)aDrru o;o1tpxomf3iltla2ua( pnt0 eenmr3tadlm  lieslt)s2toxrpny4llte ncsat  Dtmumpno4teenmo3iasfa2rmuvp;(4 exrmo3ty1fa raivi;t) rtrxrpou1opee fes tfs2rm(r ;u1tpt moeiasfa2elnmp (0treniocoo1opteai ils)t2toxmpny1openlfvi s)srurxmpou1aleniicild aDemu snt)arerio iy1fptrlu i;(0setm(m3oy4olt lfvt tf 2raur ;o4oex moetyslmDumnvon()alxoxo oadlmDraues;s)seur(opio1op  livsl( srrmur no0tetn f3iyt s2ul( o;(0alxrxr iadlaD  neo s srtmxmpoudlmt lfet s)srtm(mpot0aet  i3tasfs ea( s u)altrxo iatlp  au i s  euoxrpoodapee fcta(fartrxrp;o0opeoiictldla eln o t)trerifcoy1lm e i il(0 etrxm3nu1lm elivslt)aDtaxm ot0apxo o3tls s ul( onu0 etnif oodlpteanes s0srumxopio1oleelivtlt) rtm(m ou0tpe ifciadfaDem(vsnu)tltrxf iadlptelivs (  rtoio3io1ol emnctl()a2umx pot4tex  octatla2emums;u)trermo3iatoaDraueils)texo(r oo1amtemneils)srta(r ot4aexo fctldfa emu snu)tlenmocoydfa   nes;( s2uriopou1aptnlnct (f rum(mo;u0tlxniiciltls rl(vs;t0texnmo oa1opDelieils  exmxmpoo1omte nci t  Drrurpnt4alx  o3ilsfs emuvo u0trtoio3iodomDeln o t trtrxmpio1lmte iesl(fs2urx  ;t1olt mfetlsfs2rm( o;u) lermo ia1fpteluvs;()tetmim3nu4lltnlici s  rtmxro;u0olx iiciydlm rl(von(0altrxf3io1oa   u s (  etr(o iodll e fet sfsrrax o;t1tltomoetadfsDranmo;()texoxocoa1fmD livolt0sruo(mpiu4open ieiat)srraumont4tpeo oeiatls2ra( o u)teeomf3ootom eluvs s t2umxm iudameelncta() Durxro;u0ale  f3tadfmDul( o u) eerifciytfp r neilt)tetoirpou1am nlfvias s2ra(m no0aet if3iasls2emums;(0 lxomr3tatoaDr ueslt)sexmiopiy4ol nlfcs ( srrmx  ot0alt mieiysfm rmnvsnu0arenxr3oytfp r ieo;t0t2uo(m ou4lleemncilsfaDraxr ot4oex if3ias a uanms u4aexnxo3ootopDranvs t) exrio3iu4optn nvsatfarumxrooo1tpx ioeiltfaDraumo t) rxnxrctotlm   ues;t  2tmxopnydomtn ici tfaDurx pnu1olxn octatfs2ulnmpn(0tltrxrciydoaDeln i;t0 rtoxo oo1omen nvtls)arurxmo;o4apeo ieiltls2eanms t) etomo3ta1opDrlnesl(  rum(opny1lpenlics tf rtm(m ;u0aeen o3iyt s2eanms (4aeeoif iytoatrai s t)trxrimpnydaptnmiciat s2rax p;u1opx  octad s rm(vp;(4teeoirctydfmtrlneils0teum(rpoy1al  mnvslt) 2raumo;t4apt  iciad aDem(vo;(4 lxoif3tadoate nvs (0 etm(opoo1lp  livtlt)srrr(mooo0olx  f3iyt m rln o;t4 rtrmo oa1late ieol(0teurxr3iudll emivi (faDuau poo0oexn ieiys s umuvs u4arxrxf iatoa  anes s) rtr(r3iodopte nci (f 2umx  oo1oexn octld sDemnvpn() eenif3oo1fat  neil()s2urxrpiu4lpt mfvtl(fsrtaxro;o4teen ociyd s rm( s;()altoxo tytfaDranei;t s2uoio3iy4ll   nvt (fa2uauroot4ole mi3iltlm ra(vs t4 rtrir3tydfaD ln o;(0 2xo(m3nudaltnlict ( srurx ono4tlt mocils mDea(ms;u)arxrir3oy1oaDeanvi;s0 euoir iy4ol  lnet s)s2tmxrooo4oeeomfctat mDrlumont)tetrir tadopteai s s  rumxopoo1apte fct s)aDtm(m oo4ape mietldfs2um(vsn(4 etoif3to1omteaieols) exm(m nodomtnlfvtas aDtrxmo;t4apenio3iltfsDua(mo;()teeomfciytlp  ai ols0teuo(m3nudamtelnvs ( s2ra(ro;u1apt iiciadfsDrm( s;u4 exrmr oy1oaD li ils  rurxm iydlltn iet ( sDraxmo;o4texomieildlm rmn s;u4 etrxrcoodfm  aivols)s2umxm3ou1ape lnvsas sDua(mont0oetomietldla emn o ()alerxr ty1omt lieols0trtoim oy1op e feia(fsDra(m oo1opeo i3iatls2ua( sn(0trerif io1opt  nvo;t0tetrxm oo1ll elieilsfs2tmuro;o4tet  fciasla rauvp t)tetnxf iy1op e n i;s)srxo(opou1lme lfviat)aDrr(ront0apxo octatlmDrm( o;(0tlxrmf iy1oa ranvo;s0 2uoir oudlleemfcs t)arraumpoo0tpx moetytlsDuaumo (4 rxomfcoa1fpD  i o;s) exr(m3ny1olt lnvsls sruau ono4apt ifeiys a rl( s;u4 renmocoo1fpt lneil( seumiopoudolte icsa(fs2tm( p;o4tltn oeiytlm2rmu p (4trtoir3io1fat lieil(0srtoxm3ny1omeelnvia( s2urumpnt1alto f3tlsla2ranvs (4teenmo io1lp elnvsl( srurxo3iu4ol  lfvsas  Dtm(  ;t0tpeomfetasfaDua( s;t4aeeoxr3oo1oa  lnvs;s sexmxrpnudll n nvta(fs2ur(mpno4tpxoiictldlaDuau o;(0alermo3oy1opDrluvi t)texoirpiudomee fcia()aDtmumo;u4tlenmieiydfs eaums t4tetnmf iatfaD ai s;t)t2ur(rpno4apt livs s aDtr( ooo4tpto f3ilt s ean on(0 exnxf3iadfmteanvo () etrir nu1lmenmnvi s srrru ont4ope mfcild s2rmnmp;(0aexnio3iotomte uesls0 2uo(rpou1lm nmfcsatfs2raur ;t1aex moeilsls2uauvsnu4arermo3oo1fm ranvi;s) 2tm(o oudll nlnvtltf Dtrumo;o0alxnmoeiltfaDranvonu0 lerirctodfaD au olt) eumxm nydamt liesasfaruru o;u4olx  fciatla2ua(vpn(4 lerir3tytoaD ai s;t sexoxm3oy4lpenmncsatfa2tm(mpot1tpeoifciatla uln sn()tlxrxocoo1omtrlivs;t0srxrxo3nodlm   fet tf rrm(  ;o1tltnmo3tasfs2umnmo;t0altnxf oydlaDeln s;t0 2xm(m iy1aptemfes s sDtrur ;t0apx mieiytfa um(ms;(0aetoxo iy1fmt aueo;s  rxmio3ou1llt mnes t) 2rax pno0ope  iciydfs rmn p;() eermr3iodfpDe i sls teto(o3iudap nmneils sruau o;u1tptn f3tatls eau s (4 eeoxr3oy1fptranesl() 2xm(mpiy4altn nvta(fa2raum ;o1opxn feiytla rluvo;u4tlxrmr todoaD lues;s) eum(m iu1lpeemnet ( s2tmx  no0opx mi3iasfs uanms;u0 rxomoctodlatr nes s) rtr(m iu4amtnlfeil(fsDra(r oo4aetomfciyt mDel(vs ()aeeoif3oy1fmt aues (  rumxrpoo1aleelfvt t aDrmx o;t4tpeomfeiytfaDul(mp;(0trtoxrcoadfat li i;( teuo(r3oo1ol e ivils)s2um(mpnt1aetn o3ilslsDeanms;t0arxnxr3ta1opt aues;(  2ur(m3nodol nlfes s  2urum ;u4oet io3iltlsDea( p ()tltrmrcoydlmDr n s;t0 rumir3no4olee fvslsfsrumxmo;t0tltoiiciltfaDeauvp (4teerio oy1oaDelivo s0 2xr(o iydlmt mfvsat arrrur nu0opt iietlsls2emnvo t)arxrxf todlpD lueo;(0texoxr iu1apte nctas)s2ta(  ;t0opeoifeiytlmDrlu s () rtrir3ty1fa rau ols t2umio nudol emfvil(faDrr(mo;o1tltnmieilsfa umnvsnu0trxrmr3iodfa eauvi (0 eumirpou1optelncsasf Dua(m ou1oltn ieilt a2el( snu)tltnio iytlmtelueo;()s2tmio iy4oltnlfetl( s2trxr oo1aptn feiysfa2ua(ms;t0teeoxo ootfmD aivols tetrxm iydal eliviltf 2tmu  no4tpxoioctasfs2ul(vpnu)alxnio tydlm raivslt  ruo(o ou4op e fet ()srtmu oou4oet ifciyd a rlu s;t0aetnmo tydoatr uvo s0 rtm(o oy1am  lnetlt) Dum( pnt4tptnifciydlm2um(vont4texrxo3iodom  anvi;(0 2umir no1am nmnvtas) rtmu  nu0tetoio3ias aDeauvpnt)altnmfcoatfaDeaies t) exrim iydop nmncsas  Dum(  nt0apenii3iytfs umump;t0 lermocoodoatraueil()srtr(o iy4lmt livt t a2ur(  ;u4aexnifeilslmDea( o u0tetomf3ta1fpDe iei s)sexm(r3iudlptnmfeiasf 2tmx  ;o0tpx ifcildla rmump;(4 rxrir3iydop   neo s0t2xm(r ny4am e nct (faDtm(rp;o1tpeoio3tasfaDul(mp;(4 lxrmf oo1lpDrli ilt0s2urxmpnu1olte ieslsfartmur nu4opx if3tydls2um(mp (4trenmf3iotomDr n o s0texrimpoy4oleemicslt) rtaum oo0alx mociltfaDul(msnu4 etrxfciadoateli sls  etr(r3iu4ll emicsl(fsDrr( pnt1oleomfetasfs elumon(4 etoxociodoaD lu ils0seurxr3iudom nmnciltf rrmxrpou1alxnioeiltfs2rlums;(0 eenxo3oo1lmt aneo;()srxr(o oudol e nci t)aDtrx pnt4tee iiciyslsDrl(vsn()areomrcty1oaDe ivsl(0 2tmir3nu1lmtnlneslt  rrmurp;t0alto fetatfa rmnvpn(4texrmrciodlpt lneolt)trumxopiydllteliei s  Dumxmpot4aleomo3ias a2rm( sn(4aexrio3oytoate i s;t sexr(rpiudlmtnmnei sfartaur ;o0tlt  ieiytls2ua(ms;t0trerxo iy1lat livi t0 exr(rpnudole lieslt)arumurpno0oltn o3ildfa emumsnu0aeerxocto1la eaieo (0 exmxrpoydopt  iei s srtauro;o0tlt ifciltfm ul(vs;t4tetoxf oa1oate u i ( t2tm(r nudal e neiltfsDta(  ;t1teen oetatfs2emnvo;(0tlxnmo tytfpDeli i;s0seurxr3ou4op n iet ( sDta(mp;o1altn feias mDulnvp u4 ltrio3iatfaDrluvo;s0 2xm(r nu4lle  nes tfs2tmxm ou0tlxn fctyt a rmnms (0 eeomf iytoatrlnvolt)teur(mpno1llee ivs (fs2trxr oo4olxnmf3iatfs emnvpnu4aetnmr tadfmD  i s (  etmirpiy1ap emneils arumxr no4olenif3tltfaDean p;u)tetnmo3tadomD livil( teurimpoo1apt lfeil( s2uax pou4apeomocilsfaDumnmo;(4tltrirciadomt lnes t0trtmxmpnydll e ncs ( sruau  ot1ope moeiadfa2ul(vo;u0artoxr oadfpDean s;s)srurxo3no4lmt  fct t)arrmxmont1tetomfctytfs rl(mo (0tetrmocoodlateln i (  2xrio iydll nlicslsfa2ua(  ot4alenioetydfs eluvo;u0 eenio to1omt  ivsl(  2xrio oo4apte netls) 2uaxr ;u1apeo f3tatlmDumu pnu) rtrmr3oo1lpteln ol() ruoxm3iy4ll nlicil(f Drau o;o4alx  i3iltfsDrau ont)arxriociotlm elu s ()sruoxrpoydomt mivslt)a2tru pnt1tetoiocildlmDrl(msn(4 exnmrctotom eai o t) rtmiopoy1lptelicslt)s2um(moou1oleomf3ils sDrm( snu4 reomf3totfp  livi;() rtm(o iudamee ncia() rumu o;t4oet ioetldlaDrm(mo t) eerxocoy1lpDr ieol( t2tm(o no4ame mnci (  Dumu pot0tpxn i3tlsls2ua( o (0aexnmr iotlmt lu sl(0t2xmirpiodomeemnvi s)aDtru  no0apeoii3iad sDrmuvpn(4 reomociadopDr uvi;s0trxmxr3nu4aptelfet t srrax pnt0aexo fciydfaDra( o t)tlxnmfcia1fpDelivi;t)srxrxrpiydamen fcta(  Dra( o;t1opt  icils m2ean p (4 rxrmr iodlmtranvi;( texoxm3iy1am n ieiasf Dtm(rpot0teeoioeiys m umn o;u0alxomfcty1op  aiesl(  rxm(m3nudoptemfetlt srraxr ou4ole mo3iasfm ra( pnt) ltnxo iatfat lnei;t srxrirpou1amtelivias)srrmxm ;o1apeomoetat s2umuvs;(0 rtnxf iatlpDrlu sls0teuoxmpnydolt  fei t)a2rru onu0tpxoio3ils m ua(ms t4 ltoio oa1fpDean il(  2xrxr iudopte iviat)arum(mooo1tpxnmfciytla2uanms;()aexrmo3iy1opDe n s;() etmio ou4llt lnvtatfs2ta(  no0aetn oetad s2uau s;t4 lxrmfcoa1opt aneslt  rumim nydoleelics s)aDrmxm no4optomocild m2elnvo u)arerif tadoptranvi;s0srum(r oydamee icia(fsrtru  no4tee mi3ildlsDem( s;(0arenxf ia1fpDe uvi;(0 2trxo3ny1lm eliesasf rrau ono0oee  iciaslaDrmuvs;(0alerxfcta1lpDelues;t) 2xm(r oy1altemnvia(fs2tm(rpnu4texnif3ilt aDrluvo t0tetnxf3ia1fp  lieo t srumxmpnu4apee nesl()a2rrxrpnt4aptn feiydfmDulums (0 rerio iydfaD  nvo ()s2xoxrpoy4olt  fetatfsDrru  nt0optoifciad a elnvo;t4aleniociodoa rlnes t0t2to(r3nydlptemfct tfaDrm(r ot1opeo oeiydfaDrauvp;t)tlerif totlmt aivi;t srxm(o oo4lpen net t)aDua(rpot4tlt if3iatfs2umums t)arxnxocia1fat anvo (0s2xrxopoodlm  micias)aDuax o;o4tlt mociyslm2eln ont4 leoxo3iy1oaD an s t setmxm oudapenmivt t)s2tm(  nt0aeenmfetas sDeanvp;t)arermo oydomtrluvolt)s2to(m oudlmtnmfetat srrrx o;o4oex ifciytfmDea(vs;(4aeenmfcoodfateaieo;s) rtr(r oy4ap  mivt tfs2rrumoou0olx mi3tltls umu s;(0 eeoxfcia1oatr nvi s0tetm(o oo1lpenlncta(faruax pnu0alenmoctytls elnvp t4 eermfctytom r ueo;() etm(o3ny1ol e nvtat)aDumumoou0tpto i3iytfaDumumonu4artrio3tydop  au s t setmimpnodllee fei () Dtau oot4tlx if3tydlmDrlnmo t4aetnmo3iytfm eluvsl( tetrxo3nudamtnlnvils)arua(monu1apxoiietlt a rlnvo;(0tlxoxocia1op   uvils t2trxr3io4amt mfcslsfsrtru  nt1apto fciytfm el(mo;(4aeenmo3iadfat  i i;(  eurxr iydlptn neilsf 2taurooo1olxnifctldfm uaump t)texrxo iy1la eai sls  eum(r iy4ol  lneia( sDtaump;t0oex ioctatfa2ulnms () leoxfcoydfaDeliei (0t2to(m io4lltnmfeilsf rur(m ;u0alt mf3ild s2um(ms ()texoirctotla  lnvo;t)tetrxrpou1oltn fet ()a2rau ooo0tpxnmfctas mDrlu s;u)aeerif tadfat aivo;(  2ur(rpiodlpt lfctlt a2raumpno1ape  oeiad a rm(vs;t)alxoir iotfp r n sls tetmxo ou4om  lictlt s2rm(ront0aleoiociytfmDulnms ()tltrxo io1lpt  nvo;s0 eur(m3oo4ale  fcsatfs2tr( o;u4ope ioctat sDrmnmp;u0aexrmf oytoa   nvsl(0 rxoxm iu1opee nvsas arrr(roou1olx iociat a2em(msnu4 renxo oadlp  lnvs;s) exm(m3no4ol   fvsl( sDumxmpnu4aetomociydfm ra( ont) exnif ta1fa ranesl( teumir iudom emivslsf rtaxrpno0olxo feiysfs2eau p;t4aexoifctotfmD  i i t s2to(r3iodamen ivi ( srum( ono0oee iiciyt aDemuvsn(0 ltrio oadop r ues;t0t2tmiopoy4omt mnes tfaDtaumo;t4tee  ieiatlmDelnvpn()aeenmrctydoaDrln il(0t2xoio3oodop   ivs t)aDtaumpno1ale  feiytlsDea(mp t4trxnmr3iy1lmD  n o t0trxoxr nu4aptelnetl(fs2ururo;u1olenifciatls rauvo u)tltrxf3oodomtrlivol(0seto(m nydamtelfvia()sDraxmoot1alxomf3iydfa2el(vpnt0 rtrmf3tytoaDraueo;( srto(o nu4llen nes (  2tr(rooo0apto o3iytfmDrauvp;u0arxomrcoatfmDraieol(0trumio oo4olt lict s  Dtrxmo;o0olt mo3iat a2rm(ms;(4 lxnxrctatlp eanvo;t)teum(mpnu1ameelivtlt)sDtrxr nu4alxo feiatls umn o;u4teeomocoadoaDeauvols0t2xo(o3iy1al emnetl()sDum(mpno4apeomoeiad m ra(mp;t4teeoxrcia1fmDr ivolt)sexriopiodlp  mncsl(f Drru pot0aeenmfctas m2eanmo;t0 ltrmf3ty1fa   iesls)srtmxr3ny4om nliesl(f rrrur ot4tetnmfeils aDrln ont4arenmo3iadoaD anvo s0 2xrim ny1ll  livs t) rraumo;t1aex mictysfs ranvo;(0tltnifciydopDrauvs ( s2umxo ny1lmenlfvia(  2rax oot0opt moeiytfm ranvs t)trenxrcty1fpDelivs;t0t2toxr3io4apt lfvsasfarraxrp;t4tpto o3tls m2em(msn()artoir3oytlpDeai s () eur(opnydll nmict ( sDtruro;u1tptn feildfs rlnvp (0 lenxf3iodoptrliei;()tetoxm io1aptnmics ()s2rm( pnu1opxomi3iltfmDea(ms;(0 rerxr iatfmtraivilt0s2xrimpiodal n fcilt)aDrax pot1oet if3tytfsDumums;t4tlxoir3ty1lm ran i t  2ur(r3oo4ope  ivs t)s2rm(mp;o1apx if3iysfs2rlu o (0 rxrmrctodfaDelues;s) exoim3oodapen nctls srrrum ;o0opt mfctldlsDrmums u0alerif3oo1faDeauei t  rtmxrpoo4alt mnvs s)s2ua(mo;o0optoifciytla emuvp u)tlxrxo3iytlaD luvs;s0teurxr3iy4amtemicta(f rum( pno1alxnmietydls rm(vp (4arermo3oatlaD aneil( t2urxopny1lp elictasfs2uaurpnu0apxo feiatlm eanvs;(4 rermf3tytom rln i;s teuoxr iydap e nctlt)sDtaxmo;o1texomfcias m2ul(ms (4 etoxr ootlpD lnvsl( trxoxm no1ape mfcslt  2rm(mo;u0aetoiictatls2uan on()tlxoir iadom  anvo;t) rxm(o nu1ome mnes sf Dtmu  ;o0tpenioctlslsDea(vsnu)trenio3iydomteli i;() 2xoirpnodlptelivs (fsrta(rono1openiieiltla2ul(mo ()tleoir iytfp eluvs s)t2xr(m3iydoleelivt tf 2umu o;o4opeo ictas a ua(mo;t4 etnir3tatlp rli ilt) ruo(o3oudop nlicslt)a2tr(mpnu0alen fetlt a2rmnvonu4aetnxf3to1op  ai i s0seur(rpou4amt  fvt t  2tm(mpnu0tet  iciys s2um( s;u)aetnio3iatla rli s;()trxoxo no4amt mfeslt  rua( o;u0olx ifeiad mDumn p t4 lxrir iodfaD luvolt)srtriopiydlltnlietlt) 2raumo;u1tlxoiiciydfa ulu s;u4trxrxfctadomDeluvi;s0 2tr(o3no4ap n iesl(fsrrr( ooo1oltoiieiatlaDuanvo;u)texnmr tytlaD ai s;(0 euoim iy1op n ivtls) rum(r ot0aex iieiydls2elu snu4artnir oy1oatrli s t) 2xo(r iudlm n neias  Dur(ro;o1tee mfctydls ul(vont4 lxrio3tytlaD aneol(  etmiopoy1ol elietas aDtru onu4oexniictld a2uln p;u4 leoir tatfm elnvolt)sruoimpiy1optnmieils) 2umurpoo1tpx  o3iydfa2ran p ()alxnxrcoytop  li o;() 2trir3iydap elies (fa2trxrp;t1texnii3iasfaDemnmp t)aeerxo iotomDr u s;t)t2umxm3iodam nmneslsfarta(rp;t1tpt mocilsls2rm( snt4 eeomo oy1lpDelivols0seumio3iudlmeelnctasfaDur(  nt0opxoioetysfm2rlu o;t4trenir3io1fpt lnvi s0s2uoio nodole lfet sfs2uru pnu0tetnii3tlt m2rl(vsnt4trxnxo ia1fa  auvi;s  etoir3iy1lm e ivsl( sDra(mpou4apt mf3tldfaDel( s;u)arxrir3iatomD lu ils)trxmimpno4lme  fciltfs2tmxm no1olxnifciatfa2rmn o;u0texoif3tatop   nvs;t)srto(o ou4lpe licta(fsrrmumpou1opxo o3ilsla um(von(0tetrmf iadfpD aieil(0tetmxr iu4olt  ict t s2umumoou4oltoif3iysfa2raumo u0 reoircoatopD lu sl() 2xm(o ou1lltn ivsasfa2tau  nt1oexnioetld a eaumo t)altoircio1latrlu i;( trtrxopiu1lleemnct tfaDrr(mpot4oeto f3ias s umn p;u0artrmociotfpt aneo t)sexmim3oy1ll nlfct (f rururoou0tlx mf3iytlaDelu s;(4aeerxrctadlmDelueo t0setm(opiydalenmfcs ()artr( ooo1oeenmieiatfm2ranvp;(4 ltrxfcoy1latrlnvi;()s2xoim ou4lpeelfvsat srtmum ot1apx mf3tadfm2eanmpn(0aexnxf oatfpD livsls s2toxrpoodlmeemfctls srtru ono0aee mociysla2um( pnu) rtoxocoo1fatrln o s0 exr(mpio1alt livta( s2uax p;o0aex moeiasla2um(von(4alxnmf oa1om  anesls0seurxo3oo4lltn fcias  Duaxrpoo0oltnifeiyt m emumpnt) etrioctytfat  ieol(0t2urim3iu1lptn nvil()sDrr(  no4openiiciydfs2rluvon(4artrmr3iydlaDrli o;t) rumiopno4op e iciltfs2ur(mpno0alt mieiysfmDrmnvp (4aeeoir ty1lateaieo;t t2um(o3iy4olte ietls) Drm(mont0opeo feiydfaDranvpnt0 etnmo oodlaDranvo;s sexo(o3ny1lpenlfes t)a2ur(mont0tet mfctat a umump;()tetrxo3ty1fptrlu i t0s2xrio iu1lptelfcia() Dtaumono1apt  f3iltlaDemnvo;u0 rxnxfciodlmDrai s;t0tetrir3oy1apen nviatfa2urx  nt4oetnmo3ild m2ulnmo;t4altnmo3todfa r n s s)trtoirpny4amee ivi ( arur(mp;u0optnmicildfa2ra(mpnt) etnif3iatop e u slt s2xoxo3oo4opt  icsat s2tm( ooo4tleomf3tat sDelnmp;u)treomr oatopt  ies (  2uriopnu4apte ies sfs2rmu pot4optniietls s2rmuvp u0 etnmrciytoaDrlnvslt  euo(opnydlpeemictl(f 2tmump;t1tpto f3tat a umu pn(0arxnxf ty1lpteli s (  2tm(m oodap nlicsat)sDrru pnu1teenmi3tlsfm2ulnms (0 rxrxf ta1la eaueilt) rumxrpoy1omtnlfei sfsDumump;o0aleomi3tadfa2um(vo;t0 ltoxfcoadlateln s;t)sruo(mpiy1aptnlfei (f 2um( oou0tetnifetydls2uanvo;u0aetrxr3oydlmD auvs t0srurio3io4ol nlnvtat)sDrrxrono4aexnmiciytfm rauvonu4tetrxo3tytlaD lnvi;t0teumxmpoudop   nvt s)sDuru o;o0tlx ioctasla2ul(vonu0trtnmo tadomDeanvi;(  exrxo3io4lp   nvi (  2tmxr ;o0olxnioeiyslm2rm(vo;t0 exomrcoytoaDelnvo;() exmxrpnodlmt  ieslsfarrau pnt0aeeniocild sDumnvpnu4tltrmo tytfaDeluei;()trurxopnu4al nlfvi tf Dumxmooo4optoiocild m rluvs;u4 lxrxr3oadlp   uei;()sruoimpou1ope mneiat)artruro;t1tpxnmo3ild aDrln s t) lenxf tadoat  nvi;t0t2xmxrpny4omt mfvtlt)sDuau  nt1aleomociytla2emn p;u0 etoir iodfaDe n i s)texoxopoy4lle  nei s artr(monu1opxoifctytlaDrmn p;u)teermo iy1om  lieo s  rurim oudll nmfeslt arua(m ou4open feiys mDum( p;()tetrmrcty1opDrlu o;s)srurir no4amt miviasfa2umump;u0aexoioetatfm2emn p t0 lxomo3to1laD lu o;t0 eto(r iu4ol   ieil() Dtrxr ;o1aeenif3iadla rl(ms;t0artnifcta1latr nvo s)trxmir iu4lm nlfvias) 2umxronu4texnmf3ias a ra(monu) ltrmo3iytlptran sl(0t2xmimpiu4ll e icta(  2raumo;o0olen octlsla eaumpnt4 etrxo3ta1fa elivo s0t2tr(r3ny4open fvs s srurxr ou4opx  fcild mDua( o;t0 renmf io1lat aneo;(  rtmxopiodaptemnciasfarta( o;o1tetoiociaslsDrluvs (4tlxrmr3oydop rluei s s2toiopoy4apt  fvta(  Drrumont1tlx  f3iadls2rmn ont)arxoxrctotlp r i sls)srumimpiodol  mfctas arumur nt1aee ifeilsla ea( sn()trtnxo3oo1latrliei;()s2xoxr3nodllt mfesl( sDrrx pnu4oeeoifciytfs2eluvsn(0trermrciytlpDrau ol(0srxoxrpno1aptemncsltfsDur( poo0oeeomo3iat m2um(vp;t0 ltnxr3ty1fp e ueils  rxrim3oudalt lfei t) Dtrxrooo4olenmfetytla2rmnvs (4 etoio todomteaivsls)s2umxm nu1oltemivs t  rua(  ;u1tpxomoeiydfa el( pn()tetomfcoytomD  nvs;s0setoio ou1olt lfcias  2tmx pou0openif3tlt s rmuvon(4 eermoctotomDe ivi;()trxo(m3iu4lmen fei s arum(rp;o1tpt mictytfs2rlumsnu4teenxf3totlm r i sls0texrio3iy4ame mfet s)arurxmpnt0teeomo3iltlmDrlu pnt0altoirctadlpDe uvslt teto(m iy4lltnmicia( arrr(rooo4tpeoioctat s2el( snu0tltrmrcoy1omtrai i s t2trir nydame mnet t)aDrrx  ot4aex  o3iys s uanvp;(4 rerir3oadfaD lu o () 2ur(o nodop  lncsa()sDumump;u1opeo i3iasfs2eauvonu0tltnxf3tydopte ivol()t2tmxr3iy1ol e ici s)s2tmxmo;u4tlto o3tltfm rlumonu)trxoxr3tytoptran s s srxoxo3nudame mnvs ( a2taxm no1oex iiciydfa2ea(ms;u)trtnmfcoatfp  auvilt)srtrirpiu1lpte iviat) rrr(rpoo0aexnmieilsfa2eaump u4tltnxo3tytoat  u s;t  exrir iydam nmnvil() 2rmx pno4opt  octydla rlumo u4aetrirctydlpDeaivo;s0 2urxr ou4llt  icslt)aDuax pot0ope ifeiat s eanvs (4alxnmr3io1fp r n ils)teuo(m ny4ole mivi s arrm(  nu0apeoiiciydlmDea( ont)alxrmr3ty1optr ues;(0texrir3nydamt  ivias) rtru o;u1aexn i3tatlm ra(vpn(4 lxnif todlpt li il()texr(o io4apte nesls)s2raxro;t4ale mieildlm2ul(msn()arxrirctydfatrlivo (  eto(m nu1ap   fvtltfs2uaumpoo4olenmoeiyd sDrm(mp t0trtrif oydfpt lueo;s0trtmxrpnu4lltnlicil()a2rmumo;o4optnmieils s2umn p;t4trtnxf iotlpt lneo;(0setoim iodlpen fcs t a2ra(mooo0tle mfetat s rmnvs;u4tetrmr3iydfpDe nes t  eumxmpno4lmtn icia( s2tr(mp;u4tltomoctas a emuvs t)texrif iytlpD lueilt0 eurxmpnudapee netltf rumx  nt1oltomf3iytfm elumo;t4 rxoiocoatlm eln i t0t2um(mpno4ame  ietatfs2tmu  ou0olxnmiciat sDemuvo u0tlenxf3ta1lmtr ivi;(0sexriopiy1ol  livils  rraxr ;u4tpeo o3tydfaDra(ms t4texnxo iatoa eau i s0tetm(rpny4am e fesatfsDraxro;o0tptnifcild m2em(mo;(0 ltnir iy1fm eln o;t)seur(m nydol   nvsls  Dur( p;o1tpe iiciad s2em(vpnt4tleomo3oadlatr u o t0trtoim3ou4al e ncsat)a2uax  ;t1apx ifetytfa elump u)alerxr3oodomt aivsl()s2um(m io4op   nvt tf 2urx o;u0tpxo ictldlmDelums;t)trtoio iotla rlues ( tetrxm3oodlmen nctlt s2ua( ooo0apeomf3iadlm uan o t4texnir iotlaDrluvils0trtmxo3oo4ll  lnei sfs2tm(ronu1tptnmfeiltfm em( s () leoxr3oytlm eln o s0setm(m3ny4ol   iesls arrmx pou1oexniiciltfm ea(ms;t4areoircoo1om rluvols) exr(r oydamenmivsltfs2ta( ono4alxn ietltfm um( snt4 rerxfcta1lptr i i s)s2to(rpou4lmte fvt s)artaumooo1aleo i3tytlsDranmp u4altnmociytlm eai ilt0t2umxr io4om  lfesls aDurxmo;o0optnmo3ias sDem(vo t4 rtrmfciotlp e nvil() 2trirpoo1llenmfctl(  2rrurpno4oeenioeiyt mDuau snt0alxnmr ta1opDrai s t)s2uoxm ou4lpt mfcs (fsrra( pnu0tpxnmf3iat aDelnmo;u4aetoifctatfpteai o t0setrxr3oy1omt mfet t) rtru pno1texnmfciyd aDrm(vonu0tetrxf iatfm rai o;(0seum(o3no1lpe mnvil(farrax o;u0olxniietlt m2em(mo;t0aexoircta1fpDelueols0seuoiopiydopenmfvsat)srumxr nt0oee ii3tltla2el( onu4 lerxo oadlatrluvol(0trxoxm3oydlltemnci s)arumum ;t4alxnmieiltfaDrmnvp;t0tlxoio oy1lptrli s t t2xmir3nu4ome mnetltfarra( pno1olxo f3tat sDul(msnu0aexriocia1lm ran sls0trumirpoodomee fcsls aruru p;t4olx iieilslaDrau s;t4trxrxf oatopt  u o;s0s2trxr3oo1opee ivsat srra(m nu0teto f3iyt mDeau sn()arxnxr oa1laDelivolt s2uo(r iudlmt lnvil(  rtruro;t4aee miciadfsDrlnmo (4altnxo ootfmD  uvi;s0 rtrir iydlptn ivs sf 2rr(  nu1olt ioctldlm2rlumpn(4arxrirciotlaDr ivsl( seum(o oudap   fetl(f Drmumo;t4optomfctltla em( pnu0 lxrio3to1lmDr nvo (0t2uo(r iodomee fci s)arrm(ronu0tlt moeiaslmDuluvon(0aetrif ootlpDelueols) 2tmir oydlme mivs s)arumu  no4oexnii3ias aDumuvpnt0 rxnmrctydopDr ivslt)teuoir3oo1apt lnvt s)aDumx pou4ale ioeias m rlump;(0areoif3oydop elnes;s) rur(rpoudop emivsas)a2rmx  nt0olxniietas a rmump;u4texnifciadoa raivo;t0seurir io1lpt lfvsas)aDuaxmont0tlt  i3tatlmDranmo;() etrmo ta1om rai i (0srtm(opiu4altelfcta(f rrmuro;u1apeo ieiyd a2uaumo;t4tetoio oadomDe neo;s)s2xrxrpoy1ape  ict s  2rm(mo;t1alenmicilsls2uluvp u) leoxoctotlp rlues;s) rto(o3no4oltemfcslt)arumx ono1texomo3ildlaDulump;t0trtnmo to1fateli o;t)teuoxm3iy1amenlnvi tf 2tru o;t1aeen iciydfsDrau p;(4tltoxfcoo1faDeln i;s s2toiopoo4opt lfciat arua(rpot0tle mocildlmDem( s;() eeriociotlptr ueo (0tetmirpoy4lm e fcsas)s2uaumpno1aexoiiciyt sDrlumsnu0aleniocoy1la  livo t  rurxm3oo4aptelfesa()s2raumo;t4apt ioeiytfs2rauvont4alxnif oa1lm elieils) etr(m3no1omt micsl( sDrm(r oo4tex miciyd a ea( o t4tleoio iadfa raivil(  eurxm3iydomtnlici t)srrrxrpnt0oet  o3ildfa2eaump (4treniociotlat liesl()trxr(m3no4lmenlfeslsfaDurxmo;t4apxniieiltlm em(mo;t)trxomr ta1latr u o;( trxmirpou1oltemivils)sDua(r oo1alto fctldlm raumpnu) ltrif3tadomte uvo s0 2trirpio4amt  fci t arumu ont1oex moeiysls2rmu o t)tlenxf iadfptr neo;s0s2trir3ny1lmtnmfeslt) rtmuro;o4texnio3tytfmDeanmont0aeeomocoydfaD  n o (0trtrim3oodlptn feilsf rtrxrooo4teeomociasfa2em(vs;(4 etomr3iatlmD lues t) 2uoir oy4am  lncsa( sDtau  ;u0aeeoiieias s2emn o;t4arerir to1omDe uesls) 2xm(o iy4lpe mfvilt s2taump;t4opx  ieiydla2uluvs;()tltomrctodoaD lueo;s0t2xmim3iu1ap emiet s s2tmu ooo0aleomi3iyt aDemuvs t)tlenmf iotoa rlnes;(0srum(o iydom  livilt)aDuaur nt0alxo i3ilsfsDra( onu) rxrxocoatfa rli o;(0teto(mpio1ol n feils)srtmumpnu0tlxo ociys sDumuvs;u0trtrmo3ty1omDelu sls  2uoim3nu1lm elncia()srrmumpot1alxn o3tlt a2em(vp;u0 rtrxrcoatop rli ilt)t2urirpio1ol n nvia() rtmur ot4aptn f3ilt s ra( on(4alxnxr3iytfa eanvsl()setmxr nu4lp elnesa( srumu  no1oexn fetad s2ulnmo;t4trermrctotfa eai s t)sexoxopoodlp e neias aDtmu p;t1aetn fctad m2ua(vs t)teenirciydom rai i s0s2xmir ny4lme  ietat)a2uaxm ot0oee mfciaslm ul( o u0tlxomr3ootopDean ilt)s2xrio iy1ol nmivilt srur(mpoo4opto feiasfmDea(vont0tltrifctadop  lueo t0 eumxm3nydopt lncslsfs2rrx onu0apto fctytfm rmnvp;u0 reomf ta1fptraivs s0 2umxo ou4lp  lfct s aDra(  ou1texoioetadfs ean s;u)teeoxr todfaD lies;()t2tmir oo4olee nci s s2rrx ono1tpxnmoctytla rlu pnt)aexoif tadoaDeauvs ()srxrirpnu4opt  nvs (f rrr(rpno0tlxniiciytlm2ulu pnu4 exoxo tatlpDrlivo t texoio iu4lmeemfvs ( artru oou0teenio3tytlmDul( p t)tetoxociy1fmDean ol( truoxo3iu4aptn fcia(fsDrau oot0aetn fcilsfm ua(vs;()tetrxo ia1lat livolt) 2umirpiodlpen ivias) 2rrurp;t1apeomi3iltfm2ua(vp t4 lxoir3oydop eluvi (  2toxr3iy1lm nlict t arrrx o;o1optn i3ild s2rl( s;t)tlxrmo iodopD aieils)tetmir3io1om e nei (f 2raump;t1opeo oeiyt s2rm(vonu)aeeoxr tytfptr neo;()sexm(o nudlm n fcs s)sDurumpnt4oeeoifciysfm2ul( s;u) rtoio3oydop raiei (0truoimpny4ape licsasfaDurxrpot0tex  f3iadfs ulnmpnu0treoxrciytlmteauvs;( srum(m nudol elnct t) ruaxr no4tltn ociasls2rlnvp;t4alermoctatopDr n o;s)srxo(r3iudlltelfesas)artaxro;u1opx  oetad a2el( pn()tltnio ty1fpD ln i;t) 2xrirpno1lm  mfes ()sDra(rpnt4alto fetatls2ea( o;u)trxrmo ootfa raueo (  rtrio3oydam e ivi sfsrrrump;t0optoioeiysls ea( p (0trenio3iotlmt  nvi;s0setr(r oo4olte fet tfsruru ono4ope iictatlsDumuvp t) leomfcta1omtrluvsls)teur(o3iu4ol  mnetlt aDumxmo;t0tlx micilt mDum(vonu4trtnxr tadom e u o;t)t2uoxr io4lme miviltf rtrum no1aexnifeiad a2umn s t0 eenmociy1fmt aueo t0srxr(m3iy4aptnmicsat)srururp;u0tltnmf3iadls emnmsn()aetoif iy1faDe nesls0 rtmir oo4olenlictatfartaxmoot4tpeoiicias sDra(vo;(0areoxrcoytom rlieo s)setmxr3oo4lleelfctlt aDta(root1tltomietltfs rau onu)trtoio3tadoaD  i i t  rxrxr3oudome  ivslsfarrm(  nu4aex  fctad a emuvs (0alxrxf3ta1op   ivolt  euoxm iu1apen nviatfsDurxrp;o0alxn oetas aDel( pnu4tetnir3iy1late n s;()tetoimpoydomt  ncslsfaDra( ont4tpt  ieias sDua( s (4texoif tytopt lu s;t0 exmio iy4ol nmfvsa() rtmumpno4tlenmocilt a um(mp;u)artnifcio1lmt  ueils sruoir iydlmt lnct t)srtruro;o4aptnifetadfm2elumo;u0 lxrif3iodoateau s s0srtoirpio1ape mnviatfsrur(mpnu0aeeomfciltls2uln pn(4tlermf iatlptrln o ( seuo(rpou1om n nvs s arrr(r ;u1tee  f3iyd mDrmu p;t4 lxrmr ty1op r u o;s)trum(m iy1alenlfci t)aDua(  nt0olx  f3ilt a2rlnmsnt0treomf3to1opD ai il(0t2xrxm iu4ol e nct ()aDtrxmo;t0tlt  ocildlsDrlums;(4aexrxo3oatop rlnes;( t2xoim ny4om n ivsltf ruax p;o1alenmo3iydlm elu p t)aetrmrcoydfp r n s;t srtrirpiodlmte fvt s)sDtau  ou0oleo ictyt s2emu p (0artrxfciy1lp raies t)teum(m oodape  fet s  2ur( pno1tpenmf3iadfs2rmuvs u0arenxf oo1opt li il(0 rumxmpoydapt lneta() 2rax  ;u1optnifctls m ua(vont4tleoif3todfa r nvil(0t2xmxo3iydlm nlfci ( s2trxr ot1tpxnmfeiyd m2um(ms;t4 rxoxrciatfm raivi s  rum(rpny4oltelieias sDum(m ou0oex iicildfa rlnmsnt)arxrmrctodfaDraivi;( trxm(r3iu1ap elnvtls a2ta(m ;u4tlx ioctasls emnvs;t4trxoir3oa1fm eai slt)s2trxr3oudaltemfvtat  Dumumpou1tpxniiciltls2umnms t)treoxr3oydlmDeauvil( sruoim iodlmeelicsl(  rua(mo;u4tpx io3taslaDumumo;()tlxrmo3oatla raivslt0 eto(opny4ol emneias)a2rm(  no0oexn f3iytla eaums;(0arxrmocio1omDr ies;s0teumirpoydlm nmfcta(fs2ururono0opxo f3tadlmDul(vpnu0 rtnxrcio1la   nei;(  2trxrpnu4lmt mfcias)s2umu ooo0ale mf3tlsfaDuln o (4tlxomf3todlmD ai s (0 rtrio iy4am nlneta()artmxrooo0olx mictltla eauvs ()arermrciatfa r nei t teuoxr3no1apenmictls aDrrxroot1tpt micilsfm2eanvo;u4aetnxo iy1opt lieslt  exm(m3nu4lpe mici t) 2rax poo0olxn oeildfsDel( snt0alenioctytlat aueils s2urir3nudap   ivtatfa2tr(monu4teto fctlt m ranmpn(0trtnir3oatoa elueol(0srto(o3nu1alen ics t) Dua(  ;o1apxniictltfa2eauvp;t0 ltnmo3oa1lpte nesls0texo(mpiudaptnlictl(farua(mono0openmo3tydfa2um(mp;t4artnmociy1la   uvo t0 ruoio oudamtn fct t)s2ua(mooo0tee ifeiad s emnvs u)trtnmrciatfp   nvi ()tetr(rpoy4op  lnvil()sDrmx p;o4apeo fciytls eaumont4alxrir iytlpt anei t0texm(m3no1ol e nci (  Dra( oou0aetomfeiydlaDelu p;t4tltrio oa1lptrai s;s)srtr(o3oy4ap   nvia( s2rmur ot0ole mfeiltfm2rmn sn(4 etomrcoa1fm   neols seuoiopno4ap elietl()s2rrum ou1olxnif3ildfs emnmp;(0alermr3oa1oaDe ieols)setrxrpiy4ol n fvia(fsDrr(mpou0tpxomfetysfm2rmu s ()tltoio3oo1lat ln i;s sexoiopoo4am nlfct ( srtm( pnt4tee mo3tydfa2emnvo u0 lenxf tatfmD lu o;() rxoxo io1opee nvi tfaDrrumo;o4tpxn fctat s2um( ont0 lxoxf ia1lpDraueo ( t2xmxrpio4llt mnvi (fs2urum nt0aeenifctld m ua( s;t0 rxnmoctodlp eaies s) rxr(o ou1omee ivslt)sDum(  ot4aeto ietatfa eln snt4areomocoo1faDeanvslt)setmxr3nodoltelfvil()arraxmonu4oleomfctydla2ua(vpnu4aeeoxrcio1fate u s;s)srxr(rpiodlle lnetl()s2rmx p;u0oet  fetadfm rl( o t)trtoir3to1fpDr nvo (  etr(r3io4lpte fctas srraurp;u0oetoii3tlslm2ea(ms t4tlenmf3oy1fpD lneol( tetr(rpnodomtnmfesas) rrr(mpnt1opt ii3iltfa2uluvs () rxnmo3to1optraivs;s)teumir nudamtnlfei s)arua(ro;t0oetniieiysla2ra( onu0alerircoatlpD auvsl( teuo(mpiudap   ieilsfsDtrurpou0tpx mfeilt a2ulump;u0alenxr3iatfptrli i;(0 eurxr nodlmt lfcs ( s2taxrpou1oexn oetld aDelnvp t4tetoxr totopDelieo t0srtoxr3oy1lpenmfviatf Draxrpno4apx moeiasfmDrlnvo (4 rerircto1opte nes t teumirpoudope lneslt s2tax p;u4tpto ieiys a uln s;(0trtnxociatfmDeaivs s)srumir3nudlmt mfeils arta(r ;o0tetnmi3tydlm2eau o () lxnxo totfptelu s;s) 2xmim3iodopeemivs s) rumxmo;t0tptomf3iyd aDrau o u)tlxrir3totlpDeauei s0tetmim3oydop  lfvils)a2tmx  ot4tltn ietadfa2elnvsnu0 rxrmr iotlm r iesls) eumiopou1al nmfesltf rum(mo;o4aex mieiyt a ran pnu)teenxr tytla rai o;(  ruoxo oydlm emfvt t srra(  ou0oee ii3tld sDum(mpnt4 ltrmo3iadomDr n olt0srxm(mpoudam e fet t srra(rp;t4oet  f3iadla emuvsnt4tlenmr oo1op ran i t) etrxmpoy4lpt lfcia() rrm( o;t4apx  ietysfaDel(ms t4 rxrif3oadfaDelnvol()setmxm oy1altnlnctls  rtmumonu1apxoifciadls umnvs;u0 rtrmo oydoa rluei;t truoir nodlltnlictl( aDtrxmpno4olenii3taslaDrm(vp t)treniocoa1lp rai i;t srxrim nudlm n icsl(f 2tr(rp;t0altn fctasls2rm( s;()arerxociy1fatrlnvs;(  rtm(m oodlmeelietlt)arrr(r ;u1ale  oetld a ulu o t4tlxrxrctadfmteanvi;()teumiopiydaltnmies t  2umurp;t4oleoif3ildlsDeauvp;() etrxrciydoaD lu sl() euo(r ny1al nmics (fsrrmu onu0altomi3ildls em(mpnt) ltrxfctodom rlnvs;( trumxr nydlm emfvs sfarrr( pno1aex  i3tysfs rau o;u0artnxo iodoa e uvo ( t2uoxrpoydaptnlicta(faDuru  nt4aleo f3iadlsDrauvo t0aetnxr tytfpDr ivslt0 2xr(m3ny1lle mneta()aDtmu  ou0tleoiociyt s emnvpnu) exoio3oydlmDran s;s s2umir3no4apeelfcs s srtaxrp;u4tpen ieiys a2ul(monu4alermf ia1fm e i il()srxrio iu1olt lies sfaDtmxrooo4aexoii3tadfs umums;u0teerircoadoa  anvs s0sexmxm no1lpe  nesasfs2tmum nt0opxn oeildlsDua( o ()tlxomr ty1oateaneo;(0t2urxr3nodameemfetat)artmxmooo4tlen ictldfm2eau o t)aetnmoctatlmtrlu ils0s2umxopny1am  mfvi t s2trur ;t0alxo f3tldlsDra(ms;t)treoif iy1fpDran s;()teuoxr iu4optnmneiasf Dtmxmp;u4apt ifcild a rl(mp (0artrmrcoydoa eai sl( t2to(rpnudlleemnci sfaDtmxmont1opt ioeilslm rauvont0 exoio3ty1omDranvs;t)t2toxr oy4opt mivi (  2rm(  ot4teto icilslm rau p;t4 ltrifctodoaDrlies;(0setrxopio4lpeelncta(  Dtmurono1tpxnmf3iadfa umnmp;()tleoxr iydfpDr i ol(  2xmirpnydlmte ivi t  2ta(r ou0olxniociytfa2rmnvs t) lxomo3io1fm e ieilt)sexr(opnodaltemivsatfa2umur oo0tptn o3ilt s rmnvo;t)aetnir oydfmtrai o;()trtm(o oydllee ivtas arrr( oot0tptomietldfsDum( onu)aeenxo3iodom r ivo s  eumim3iodlpeelfci ( a2trxm ;u4opeomf3iysfa em( pnt4areoifcty1fatraivo (0 2tr(m nudam nlnesasfaDra(moot1optniiciltlm2um(ms;t0 rxrir to1omDelivo t)srxoiopio4lp elnesls)a2tau o;t0tetoii3iasfaDrluvs;t0altnmf3tydom elu ols  rtmxm oydal n nvsatf rur(  ;o1aee mfeiltfmDem(ms;u) rxoif iy1lmt ai i;(0sexo(opoydomenmivt sfsDtmxr ot1apen o3iatlsDulnvs (0 lxoio3tydla  lnei;()trxrxr ny1lpte fcil( arrmxm nt0alxnii3iys sDran snu) exoxf3oydfmD anei;t  eumiopnu1al  lnvtl(  rrrx o;u0teto i3iat mDeauvp (0 rtrmr3to1latr i ols  etoxm nudal e fciasfaDum(  ot4oexnmieiyt aDumuvo;u) etrxrctodoa elu sls0t2um(mpoodopeelfeiat a2rru  ;o4olx  oetlsfsDrlu p;(4texnxo3ia1opDr ivo t)trumirpoo4lm elivi s)sDta(rpoo4apxnif3iadfs2rl(vs t)trxrmr totfaDeaueols  2uoim oudlm e nvs tfsruaurpot4olt if3tldlm ulnmpnt0 renmr oadomtrauvo;t) exo(opiu1lm n ivtat srrax  oo0alxnmfetldlmDrl(vo;u4aexrmrcio1lptrlneo ( trtoir oo1lm nmnei t  2uaumpou0tlxoifcilslsDemnvs t4tltrxr3iy1fp eli slt)teum(r3iudlmenmiviasfarumumo;u0ale  oetldls2eln snt) rt
\ No newline at end of file
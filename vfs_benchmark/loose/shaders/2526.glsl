@@ -0,0 +1 @@
+uei;t0 rtrir3nu1lm n neias aDtaurpnt1teenmi3ias a2uluvp;u0artrio ty1fateaieols s2xoxrpoo1omte icilt  Duaxr ot0tpx  ictlt a2uan o;(4 exomr3iydlaDr uvi ()trurio3nu1om  mieslt sDuaxro;t0tpt ioeils mDrauvont4alxoif oydomte ivi t  2xr(o io1aptnlivsl(fartrumpoo0oeto fciasfa2umuvsn(0alxnir oa1omt  i ol() exr(o io1aleelncs sfsrraurpnt1tee moeiltfa2elumpnt)texrmf3oydlpDean i t) 2xm(o3no1ol   ictl( arum(m ;u1tpto i3tytlm rauvsn(4teenif ta1opte ivols0tetm(rpoudamtnmfcsltfs2urxm oo0tpeomf3iyt a elu o;t0tleoir3oy1oaD auvo (0texm(r3iy1lpenlnctlt) 2tmumpnu4aet  ieiytfmDem(vsnt4tetoio3ootoatr uvol(  2tmxo3nydalt lfctatfaDtrumooo0alxn ociatfa ua(msnt)arerir3iatlpDr uvs s0 2xmirpiydap e icsas) 2raxm ot1oet ioctld s2ul(vsnt4teerio3oatlmte uvolt sruoimpiu4olen fviat)srrrump;t4tetomoeiytfa rl(mon(4 lenio iotla elnvi (0teuoxo3iodopt lics t s2umurpot4texo f3iadfmDrluvo (0tleriocto1optrau i () etmim3iu4lm  mict s  2ra(rooo4alt  fctls s ua( pnu)aeenmfcio1omtraueo;() 2xmxr iy1apee fei sfa2tm( o;t4texomoctat m2eanvs t4alxrif3tydlpt  n s (  2trirpoodlpeelnvtls  2rax poo1apxo i3iysla emnmo (4alenxoctadomtelieslt)s2toxm3nudap   fci ( sDtaumono1tpeniocias aDulnvsnt)trxrxo3ootfpD  nvsl(0trto(rpno4omt licilt) Dur( pnu0aex  fcilsla umu o;u)aeenmo3iadlpDranei;s0 2trim3oy4lptnlfes (f Dra(  nt4texn i3iad aDuluvsnt4 exniocoatfm   ieo s0tetm(rpou4apee nei sfsDur(rpou4teeoioctatls2el(vsn(0tlenif3tytlaDelnvols0srtriopoo1al  mfei ( srrmx poo1teeomfciys s em( s ()artoxrcoo1fmtelneo;s  rum(m iu4al e iesa() Duax  oo4apt ifctltlm emuvs (4arxnxocoatfpt luei;( s2xoxr oydamtelfet s aruauro;u0alxnii3tltlm2em( o;(4trxrmr3ootfp eln sl()teurir oy1omt  icsl(fsDtr(mpnt4aptn feias s2rlnvo u) leomf3totlaDr i ilt s2toirpnu1alenmictas s2uru pnt4oex mfcilt m2umumont) rxnxo3oa1opDran ols s2xr(r3iu4lme lfvt ()artmum ;o4oex io3ilslaDra(msn(0 rtrifcootfpDr uvo (0 rxm(o3iodalte nvt t artr(  ;t1tpt ifciytfa2eanvon(0aetoio io1oa  ai s s)teurxopou1omenlnctl() Dta(rp;t0aexn fciysla2uaumo t) leomr ty1fmtr uvslt)trtrxo3no4aptnlicta()aDrm(ro;t1aetoif3tadlm2emn pnt0aetnmfciadoatr nvols)t2toirpny4lpenlfvt t  Durx p;o1tetnii3iadfm ean o;(0artoircootomDeaieol( srxrirpiu4omeemivs tfs2tmxro;o4apeo i3tys m rm(mp t0aetrif3iytfatranvolt0 rtmxmpnu4olenlnvs tf rtm(m ;u4apxo ieild mDem(vp;t4 eerxfcoytopteli o;t) 2xmio iy4altn nctatfa2tru ooo4oeto fciytfmDum( s;()trtnxf ta1oat  uei (0 exmxo oy4lptelnes (fsrrrx  ;t4tpt mi3tldfmDem(vont4 eeomo3ootomtrli s s)trxmxr3ou1opeelncsas a2umurp;u0tpe mfcildla2rm(mpnt4arenmr3oo1lp e n s () 2xr(r oydlp e fetas sruaxrpno1olenmf3iadfs emnmp t0areoir ty1fpt ln ol( teur(opoudomtnmicils aruru  no0apxo oeiydfmDelump u4texrmrcta1fp rau slt) etmxmpnu1altemnvilt)a2rm(r ;t0altoii3iad s2emuvp;t4trtnxo3oy1fmDeli o (  eumio iodlpt lnvslt) 2raxmono0tptnmf3iad s um(vo;u4 ltrir oytla raivsl() eumxr no1al e iei ()a2rmuro;o4oltnmociytfs ra(ms u4tltrmrcoodfpte ies t trtoim3io4lpt  icsatfarra(m nu4aexoiociatlm2rl( s;u4arenioctydfateanvi;(0seur(r3iydlm nmies sf Dumxro;t1oexomo3iydla2eanmo u4tlxnmfcta1lpDr n ol()s2uoxr3oodlpe  ivsl() Dururo;t1tleniictadlaDeaumon(0texnxrctydfpD ai i;t0trtoio3nu1lpte fciat)srtr(  no1apt mf3tlsfs2ea(ms;u0texnir oytoa rlivil( setm(opiodapt  nvsa() Dtr( pnu4tpe  fciaslmDuauvpnt)trtrif oodfmt  i sl( t2to(opiodlleeliesl(fs2uax o;o1olxomf3iat aDraumo t)tlxoxf to1lmt ai s;(0 exr(r3ou4lp   neiat  rtm( pot4apx io3tatfaDrmnvs;t4alxomoctatomtr u ilt  etrxrpoy4am n fvsa( aDrau  nt0tpe ii3iadfs2ul( s t4 lenmf ia1oat lu olt) ruo(r no4ameemictl( arumurp;t4tet  fetldfa eaumont4tlermrcoatfat aies;() 2tmio3iy1alt mfvs t a2uau  ;t1oexnifeildfa2emumo ()alxoxf3tytfm rli o;s)tetmxopoy1ap  liei sfsDuau  oo0aex ioetldlaDem(vo;u4tetnio iadfaDelnvi;s)srxmim3nydaptemfvil()a2urxro;t4oeto fctydla2uan s u0aleoio3iy1lmDe ueo;s  etmim3ou1al emncsas)aDraxmo;u1aptnmieiadfm emn p;t) etnxfcto1fm rluvs;t)s2xm(o3oodlmteliesa() 2um( o;u0tpeoio3iytfa rmump;u4 eenmo3iytfate neo;s)sexrimpiy4olt  ivt tfs2urxronu1ope mfciydfa2rl(vs;t4aexrmo iydfpDranvo s) rxrio3ou1om nmiei ()aDrmum no0texnio3iltfmDul( p t)tltoxr3tytopDrln sls)seurxm3iu4lltnlicil()aDtrxmpnt1tpxoioetyd s rm( snu) leoir io1fptrauvsls) rto(m3ou1omt mfesa( aDtmur ou0tleomietysls elums t) etrif3ootlp rlies;s)srum(r3ou4openmietl()a2rm( o;u0tpx ioeiadlm2ulu onu)tetrmr3oa1lm raneilt0texrim iy4ol elfvilt)sDuau ont4oeenif3iydlm uluvo u)texnircoy1op raieo t trxm(rpiy1ome livils) 2rrx o;o0aptnmo3tlt a umn ont)tlenir iodlate u s () etoxopou1lmtnmnvsas)arur(r nu1openmfetlslm2rauvo (0 lxrxr oodfaDrlu ols)teurir io1apt lnct t  Drmx ooo1apenmoetldlmDelu o u)tlxnxociydomD  ivs;(0texoxr3iydlle mfvs sfa2urumo;t0optoiictlslm2rlnmp (4tlxrxrctydfmteaieol() 2uoxmpny4ope  ivtlt)sDtrur no1olx  feias m2umn p u)teeoifctotomDrlueo;t0srtriopoo4altn ictat)srta(m ;t4aex moeias m ulnvonu) ltnio3ootoaD aieo;(0setmxr3ny4ap e fci tfsrta(ronu4opxnii3tatfs ea(mp (4arenxr3oodlmte ivo (0trxoirpnodoleelncil( arrau  nu1optoif3ilsfm2el(vs;(0aexnmf3oydfatrauvo;t tetm(r3oo1om elivsat) Drr( o;o0tex mf3iys sDeauvsnt4aetrxf3tytop e ivo;s)trxrxrpiu4alt  ict t)aDuax  no0tpe  f3iyt a2ul(vo ()areoxociy1fatrlieo;t0teum(r iu4openlfci t aDrax o;o4tetnmociadfa rau s;(0arxnmo ootfpteaueolt trtoxm iy4ol emnes t) Dta(  oo4alen fctlt a rmuvs;u0tlermrctotoa eluvil()trurxrpoy1lpeemfvtls) rua( pot4apto i3tasla2umu onu)aexoiociatomD  u sl(0srxmxr3iydopenmict ( aDrru pno4opeoioctldlmDrlu sn()aetnif tatfmDeaues s)trtr(opoydape  neiat  Dumxr ;o0tle  f3iatlaDum(vsn()trenif tatopDrlu ols0srtoxmpnudaltnlnvtlsfs2uaxr ;u0tpenio3ilsfaDuln p (4tltoxf3ta1lpDr u s t0 2to(m nydol n fvil() rta( ooo4alxomociytfsDum(ms;t4aexrir iodlpD aneil()s2xr(o3nudoptnmfcias aDur(ro;u4oeto ietysfaDuaumsnu0 rtrifcta1lmD ai ilt0teuo(mpoy1ape lnvi sf rururpnu1opx ifciltlsDuanmo (4tltnmfctydomD  u i s texoir3no1ol n fctls) Dua(mp;o1aexnifctydfmDemn p;t)texnxrciytop rlivs () etmir nu4omt licsl(f rur( o;o4opeo ieilsla2elnmont4tetoio iy1fpD lueo;s)srtoxo nodlm  lfesatfartmxr ot4aexnio3tasfm rlnmo u0trtoio3io1fa r uvols)tetmio3iu1lpenmfetas aDrax oou4aet ifetlt s2uaump;(0 lxomrcoadfmtr neo;t0trtmio3oy4om  lncilt) 2tmxmont0altomoetys sDum(mpnu)tltriocio1fp raivsl(0t2xr(opiy1llen fciltfaDrr( ooo0alt mieiytfaDeluvo;u) etrxr tadfp ranes (0 2tm(o3iy4lp n ies t)aDtmxm nu4tet ifctydfmDrmnvs;()alerifcootfpte ieolt  rtmir3oy1lm e nvs t) 2um(m nu4tpe ii3ils a emuvont4tltoxrciadop elnes ()s2tmirpoudlme mnet tfarrr(  ot0apeomi3ild sDuauvsn(4 etoxo oydfpDrluvols0trtmxmpnu1lmt mneil( aDta(rpot1aee miciyt mDrmump;(4 lxoio iytomte nes s  rxo(opno1lle mics s aDumum no4aex  oeiyt m uluvs (4texnxoctadla  lnvi;t0 rtoir oy1ome mnvi (  rurx ono4ole io3ias s uan on(0tltoxrcoatfp r n i;s0sruoir no4am  mivta()aDtmumpot1olen ocilt m rluvs;t)aetrmf totomteluvils0sexm(rpiy4altelnvias  2rrurp;u0ale iiciatla2ul(vo ()aeerxoctytlatr u i t) ruoxo no1lmtelneslsfsrtaxr ;t1optniociltfa ulu o () renif3ia1faDelivo (0 eto(r no1alee nct s)sDra(m nt4alxnmf3tas a2emnvonu0 reoxo3iadomte uvols)trum(opiu4ol e ncsa()a2rmu o;u4tlenmf3ilsfa ulnmon(0 eermf3oydfa e n ol(0sexrxrpoo1om elfesasfsDrm(mp;o4texn o3iytfm ul(vs ()tltnmo3tadoaDr ueo;( setmir oodop e fvil( a2raxmpno4tpxo o3iyslmDuln p;() lxnxr3ia1op raneo;s)t2xoxm nu1ol emnes (faDrrum ;o1tlenmo3ilslm2ua( snt4aetoif oodlmDe ueo t0trxmxo3ou1ll n ies s aDrmurpou0aex mfciatla2uluvo;t0tlxrxo iy1lp raivo;s0s2toxo3iodopen fct tfs2rau p;t4tltnmoeiasfmDuanvo;()tlenmr3to1fm e n o ( s2uoir3iu4alte
\ No newline at end of file
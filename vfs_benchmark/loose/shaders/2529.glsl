@@ -0,0 +1 @@
+i o;t0seurxm nydaltn neta(f 2urxmpnt1tlen ociatls em(ms u0 etnxoctodfpt ai o s) rto(r3ou4amtelfeilt)sDtrxrpoo4tpeo o3ild mDrln pnt)arxomr3oytfpteau i (0 rxo(m iydapt lnvias aDumu  ou1opeo ietltlsDemn s u)trtomoctatfaDrauvs;() 2xoxr iydam emfcia(  Dtau p;t0oee  fctysls2ua( pn(0aetnif3ootfmt aivo;t)tetm(rpnydale  ivi ( a2ta( p;u4altomfcild m2rmnvont)aexoxf iydlmDraieil(0teurxr3iydoptemfct t  2umxrp;o4opeoioeiasls emuvp;t) etnif3oo1faDe i i;(0t2xmxmpou1apen ivta( arrmurp;t4oltomoctadfs em(vont4tetoxf3iotoptrlivi;s setm(opnydaltelnctls) 2umurpot0olenmieiysls2elumon(4tetomo oytoaD  uvs;(0srtoirpiy4openmfeia(  ruaxront4tlxomo3iadfaDeanmo u4tltrir totopDeluvsls0texriopiu4olee ict () Drru oou1oeenioeiytlm2um( ont4tlerif tytlptraivo s texmxr ou1lptemivsat a2urxm ;o4apto f3iyd aDrlu s u4alxrmf oytoa   n s;t)s2to(m3oy4ll   nctlsfsDtaum nu1open f3iad mDua(von(4artoxr3oy1laD an s s t2ur(r iudoleemneslsfa2rax p;u4ole ifctasls2ran p u0trtrifcoytla rln s;t0 rtr(mpou4omenlies () rumump;o0aex mi3iltfaDulums;(0alenmociydom   uvslt s2um(opno4olen fvi sf rumx onu1olx moctysfs ua(vs;u)tetrxo3iytoaDe n s t) 2urim3oy1lp   fvilsfaDrr(  no1tpxn o3taslm2uauvsnu4tetoif3tydfmDrlueil() 2xoio3ou4ol nlicslt) 2ta( ooo1aeenmietldlm2umu pnt)texnmr oa1fm e i o;t)srxrxo nydal e fcsl( s2tmur no0alt  ietadls eauvo t)trtrifciy1lp eai ol( srxmimpnu1op  miei s) 2rmu  ou1teen iciadls rlnmp t)altoio3iotlpDe ivol()tetmir3no1altelfvtasfaDururo;o0tlxoifeiasfmDulumpnt0teeomr oo1op eanvslt)t2urxr3iu1omt  iviltf rumxroou4tptoifctlt aDelu pn()artrmo3oy1lmteau ils  rtrir3iu4ol  mnciat) Drau ono1oexoiiciytlm2emumpnt4trerxr iydoaDrln o ( sexoio iu1lm   fei s s2rr( p;u0tpenioctatfs ua(mont0trtrmr3tydom e uvo;s0 rxm(r iydomt licsls arur( ont0ope micild mDuln o;(4texoifciotlat auvsl() etr(mpiu1lpenlneiatf rumu  nt1tpxo f3tyd s umn s t)arenmrcootoaDe n o t0 etm(m oydol e net (  rumumpnu0aetn o3iytfa rmn o t)tlerio3iodlp eau i (  2toio oydomee ncsas aDum(r ;o0alxoiictaslm rmumo;u0trerxf tydop  li s;t  etoim iu1opee nes t)sDtrxm ou1apt ifctatlsDuanvsnu4trtoxf3oydlpte i ilt) 2uoxopnydlpee fvtlt) rraxmoot4tetomo3ils sDua(vo t4treoif tytfa rlivs s0s2trio3no4amtn iet (farum( ooo4tltnii3iasfa el( p;t4aexnxf tytomtrlueolt)seur(r oy1ame mivi s s2ur(mp;u1olx  fciatls2rlumsn(0teermo3todomDeanei;s)seurim3ou4lpte nci () Dururpou0tpxoiocildfmDelu on(4altrmocto1omD  ueo;( srto(opiudamtn ictls) Dtaurpno0apxomociadlaDuluvsn(0aeenmr3tatfa   ivo t)trum(rpiydom  mncsls artru  oo4olxnmf3tldlsDrmuvs (0 leomfctytla  ln il(0sruo(mpoy1am  mieiat)s2urur ou4oexnif3ias m2rauvs t) exnmf oydopDeaiei t  rxoim no4apenmnvia()arra( p;o0aetnmfeiadfa2uan s;(4artoir ootopDraueo;t) 2xm(o3ny4ame lfcil(  2trumpno4ole mieiydfm uln s u)tltoif oatlp e ues;(  2tr(m nu4lpt  ivia()sDtmx ont1opt moeiyd s2uau o;t0 etrmo3oo1lmt lueol( srxrim3oudaptnlfciltfa2rrxmo;u4apeoifetasls uluvs;t4trtoxrcoydlmDeaueo;s trtoim oy4ame liviat sDrmu pno4oeenmfciytfa umnvonu0tetrio3tytfp r n i;t)teuo(opnudlpe  nvtas srrax pnt0oltnmoctyd s2ran o u0 exrxociytoa r ieol(0setoirpoodlmtnmncil()a2ur(  ;o0tpxoif3ilsfsDemu p u) etrmf3oo1fmDeanvolt0 etr(rpio1alt  ies tfs2urxm ;u0teeo ieiydlm em( pn()treomr tytfat ai s;t0t2tmirpio4al   fct t artrxmpou4oexomfeiydfaDulnvpn(0 reoxr3oa1lp r nvi;( trxmimpoydlme  nvt ()sDrmxm ot1apxn fetytlm rlnvsn(4artnircoytfmt an ilt  2uo(rpoo4am  lncia( aDuax ont4tee mf3iytlm uan pn(0 reoif3ootlaD lnei (0texr(m3oy4om e ncsl()srrrx onu1tpeoii3iadlsDumn pn() lenif ootfa elueo;s)teuo(m iudale mfciat) 2umum nu4tee mfctltfa umuvs;u0altoxo3iodfaD au ol( s2toir nodam elivi s)aDururonu4oltniiciydfa el(vsn(0tlxrmoctydlmDrluvols0t2trxopnodol n ncsat  2um(rp;t1texo f3iys aDulnmp u0 lermo3oatfp  aivol() eurxo iu1llen fcsasfs2tmump;u4oex ioetyslm2eluvs;u4arxrxf iytom  livs;s0 rxrxr no4alt  feiat) rurxm ;t1tet mf3tydfa2elu o;() renmr3tadfpDeau o s0trxmxr iu1omtn iciasfa2rr(m oo0tpenmo3tydlsDel( sn(0 ltrmfciatla eaies () exrirpoy1omeelfeia()srraum ;t4aexomoctytlm2ua( s u4tlxrmrciatfmDraueilt setoxrpiydam   fctas srtax  ot0opt  o3iytfsDran o (4texnxr to1lm e nei;() exrxo iodape lfvtlt) rtaumont1opxo fctasfs ra( p ()altrifciytfpDelnvolt0trto(opoo4am   nviatf rra(  ;o4aee  oeiltls umums u4alenmf tadla rli sls tetmim no1op  lncilt) 2tmx pou1oeen o3iysfs2rm(mo;u) etnxociytfa elivs t0trurimpoy4oltnmfes ()srrmxr ;u4oexo oeiytla2rmnmp ()alermfcty1fm e nvs;s trtmirpoy4opeelncsl( a2urumo;t1alxn octas m2ra(vs u4trtrifciytfa rai s (0t2to(o3iodol  mfetlt  2umx  no1alxomoeiatls el(vp t) ltnxr3oydlmDrluei;t sexr(opny1am elivtlsf 2tr(mp;t4tltomo3iadfm2eau s () exomo ty1fmD  ivols  etrxr ou1apenliesa(f ruau ooo4aleoio3ilsfa2ua(vont0altnxfcoo1fpD aiei;( truoxr3oodlle  nesls  2umu o;u4aeenii3ildla rlumo () lxoxr iodopDe ieo;() 2xmxmpoydol emicsl( s2taumoot4opxnmf3iaslm2umumsn(0areoxr3todfpDr n i t)s2umxmpoy1apenmfeslt s2uau  ;u0ole  i3iyt mDel(vs;u0texoxo iytfaD aneo t sexr(r3nu1lmeemneiat  rrrxm ;t1apenioeiltfs ranvo;u4 rxrmf3iotfptelu i;s)trtrio3oo1lm  lnvsls) Durxr ou4teenmiciysfmDra(mpn()tltrxr3ta1fpDrluvo ()srxoirpou4opt mfeia() rur( pno1aptoioctltfm rlumsn(4 exnxr3oadoaD ln i;(0texmxm3ou1al  mfctlsfarurur ot4olt ioetat mDeanvs t)arenxoctotlmt  uvo t  etoxopio1olen ivt s  rtmxronu4oet mocild m rl(mp;t) rxoif3tydfa e uvo ()teurxmpoodomenlictls artaxr ;u1aet  iciadlmDrm(vp u0 rtoxr oa1op ranes (0trum(m oo1llte ncslsf ruaxrooo0tetnifciatfmDrluvs;(4 rxrifciatomt  uvo;s)seumxopoy1ap  lfcilt) 2tau pno1opeoif3iyd a umu o u4trtrxo3oytomte n o;s  eur(o3ou4am elnvi t a2tm(mpno0apxnmfctysls2ul( o;(0trxrxr3oadlmtr i il(  ruo(m iudopee ict s aDuaxmp;u1aeenifeiadlaDemuvont0tleoio3oatfpt  n s;s)t2xoxo ou4op e ivtatf rtrurpot4oex moctatlm2ra( p;u)areoxfciadfp elnei t)trto(o oudal elfci s)s2ur(mo;t4ale  feils s rluvont4 eeoio3todlmteln s t0 2to(r oydamtnlnesat) 2trx onu0apeoioeiadfa2ulu s (0tlenmrctadfmDrluei () 2xmxopiy1opt  ivtas a2rru onu1oexn ociasls elu onu0aetomrcoo1oa eau s t0tetrir3oydom e fvsa( sDrruroou1oexomi3tld s ra( o;t0tltnmr3ootom elieols) exrim iy4ol nlnesasf ruaur ot0altn fetas s el(mo;t) rxoio iatfmteaieo s srxrxo3io4lptnmfvtas)a2rmx p;u0tet mieiytlsDrlu snt0 rtrmf3iy1lmte i i;(  etrxrpoy4apt mfcsat) 2tr( o;o0olx mf3tlsfmDranvp u)trtoifciotoaDe ivo t) rxriopiu4omt licsa(f Dra(ro;u4aleoioctlslaDuan s t0tltnmr to1lmDr u i;s setoiopiu4ap n icslt) rurxm ;o1alt  iciltla2em(vo ()trxrxf oodopDeluei s srxmxr oo4omtnlnci ()sDua(mpno4aexomfctyt aDua( snu4trenio iytla r nvs;s t2xr(opoydlm n fei ( s2rax  ;u1opeo fcilsfaDel( s (4artriocty1fpt  n olt0texoir ou1lle mietlsfsrraumpoo4oeto o3iydfs ua(vpnu) ltnmr3ia1fmD  ies ()sexrxr oy4lp   ictls  Dur(  nt0tpe ifciasfa2rm(ms (4altnxociytla  li s s)t2xoio no4om   fvi (  rumxrpno4tptnmfeiaslm2emu o;(0aleoiocto1fmD  ivsls s2xoio3oy1ol nlnetls  2ta( p;o0oet miciyt m2rmnmp t) eeoxr3to1la ranvilt0seur(rpou4ol eliei ( s2uaxmpno0tlx  fetlslm2um(vp ()trenxoctadlatr uei;( truoim3oo4lme mfcsls) rur(rpnu1alxn i3iatls2ua(mo;t)arenifcia1opte ivs t0 rxr(r iudalte icsat) 2tm(moou1opx iocilt aDea(vo (4tltoxf iydop eaieilt trtmir3io1opeemieias s2um(monu4aexnmicild m emump t)arenifciadop r ivs s)t2umio iy1ap   ncias)arrrum ;o1oleoifeiasls ul(ms;(4trerxr iytlmteaiesls t2tm(r iy4op elncsl() rrru pnu1alx mi3tls m raums;(4tleomo3oodlp ran il( s2xo(m ou4amtn netasfsrumuronu0tlen i3tasls eaums;u4aetoxf iadop   uvs (0srumxopiodap emies sf 2ua(moot0tptnmfeiat m2ulu p;u)teenir oatomDrluvo s)trtrim oodlme  nviatfsDur(rp;o1oetn o3iytfm emuvo () etnxr to1opDr u s;t0trurimpoy4alenmfvs t)s2tr(moou0alxnmociat m2rmu onu) leoxr oo1opt aueo ( t2tr(rpou1op e nctasf Dumumont1tpx mi3tydla2el( p u) lxomo iodfp eau i;s0 rtoio iu1amt lics t a2rmx o;u0oltniiciltfmDemu o;t4 rxomr oatlpD  ieolt s2tmxm3no1lp nmicils)s2tr( pnu1tltoiietlsfsDel(vo;u0trtnmo iydlmDeauvsl( s2uo(m oo1ope lnciatfs2tauroou4tpxo o3tls a um(vs;(4aexrmr tydfp  luei t)trtr(rpoo4llen ictlt)s2rrx  ot0ole  oetlsla2rm(mp;u4areniociadomDrlu ils) rxr(o3ou1lpte fvtatfsDtmxroou1oetoiictytlaDumu p;t4texrmocto1fat  ies;(0srxmio3ou1alt miet (fsrraxmpou4tpenii3iaslsDrln ont) etnmociytfa ranvs;s srxoirpio1lpe mfeta()artm(  no0olt mfctas sDel(vs;t0 etomf tadlmt luei ()srurirpiu1lm n ncsl(fartr(ronu0oltomfeiydfmDeanms (0trxrxo3oodlpDe nei s)s2uo(r oo4lpt  ncs t srraur ot1oex mo3tydla rmums t4 eeoio3to1oaD lieil() etrxm no4olte fcsas)s2rrxro;o4tee  ictltlaDea( o;(4aeenmo3tydfp elneils sexoiopoo1amt mfeta(  Drmxmono0olt  fcias sDulump;u)trxrxf iytla   ies;( t2trxrpoydlmtnlfeilt) rrrx p;o1opxnif3iysfs2em(mo;u0tltnxoctadlpDrlu i;t  rxmxmpoodop   ivia()arraurpnu1tle mietlsfa emnmsnt4 renmr3iytfpDeaivi t setm(mpoydlm   fct sfsDtrxro;t1altomfeiys mDuauvs t0 rerio3ia1fmD livi;()s2toxr oy4om nliesltfa2rrxr nt4opxo fetas m rlnmo;t0 etomo oadfpD aivs (  eur(opny4ll   fei s sDrr( p;t1apx  ieiltfs2em(ms;t)altnifcoytoatr ies;s0trtrxo iydamtn fvi ()artmx p;u1oeenmoeiyd a uau p (0 eermoctodom elu s;t0t2xm(r oo4alt  fvsltfaDtrumooo0tlx  ocilt sDumu p u0arxoxo3iodlpDeau i t0t2xrio oo1lmee nci ( aDrrxm nu1tlt  fetasls2emn o;t)arxomf ootfa  an sl() ruoim no4om e fcs tfarrmx  oo4tpto fciat aDem( o t0aeenxf tytlp eaneolt0sexoio3iu4altemnesls)a2umxmp;o4olenii3iadlaDranmo;u0aeerio3ty1laD ai slt0srxr(o3ou4llt miesl(  2umur ou1altniictldfaDrmnmpn()arxrmoctatoa eliei;(0 2tmxrpoo1openlncsl(fs2um(rpot0tpeoii3iatlaDrlnmont4trtrxr3to1lptelnvsls0sruo(r io1om  lieias)aDumu o;u4optnmictltlsDem(vo;u4tlerifcoodlateai s t)trtm(mpiy1am emnesa( s2ta(  oo4oeeo octld sDrlnmo t) eenmoctydfa eau o;s t2uoxo3nu4lptnlncia()a2ra(mp;t0aeeomiciatfaDulnmp;u) lxnxrcto1fm  lu s;() etoimpiy4olenlietlt) rururpot1optoiociyd s rm(vp u0 lerir to1lp  auei;s0seuoio3iudlme  nvia(  rrrxm no1tlx  ocils s rm(mo;t4aexrio3tadfpt au i;()teumxr iu1lp  lnvsl(fsDur(mp;o4aptomf3ilsls2rl( p u4altrxo oodomDrluvilt)setoimpoudlme  fvtl(  Drr(r oo1apxo o3tad a ea(vp u0trxnmo3iotlaDrln i t) 2umxrpou1ol n nesa( sDtaump;u4teeoioeildfs2emn o u)artomo3oadopD  n i (  rxrir oydap   ivi (fsDuax  ;u4alxnioctls a ua(vs t)artrif tatfmD an o t srxoimpnudlpe mfcsl()aDtru  ot4oetn oeilt m eanvo;t) rxrxrcoo1oa e neil() 2ur(r3oy4olenmnvi s) rurum ;o1olxniicilt m rlnvo;u)arxoirctotoptrlu il(0texoio3iodlm elfesa()s2rau  ;u4opx ifeiasfs2umnvo;(4 etnxociadomteaiesls)seuoim nu1ap n fviltfarumxmoot4opxnmi3tad sDeauvsnt4tetoxo to1omDranvs;t0 euoxo3ny4lle  ivt ( sDtax  nu0oleo fciyd a2umnmo t)artrmrcoy1fmtraieolt)setr(o ou1llenmfetlt arraumoou1oeto ociasfsDrmnvont4tltrxo tydlptr n s t0seur(opoodll   fcsa()aDtr(mpot1opto fcias a2eanmo;u0trxrxf io1om  lu o s trtrir ou1lmenlnetas)sDurur ot4tpx  ieiatfs ranmp;t4 etoio ootfpD  ueo s) exrirpiudlpee fviat)sDum(  no4opxomociyslm2ra( p (0tlxrxr oy1faDr nvo;s0 eum(r3ou1olt  iet tfsrtrxmpnu1tpx moeilsfa2umums t) lxoxfcoytoaD li s s) etoxo nu4omtnmfcsl( arrr(moou4aleo o3iad aDrmnvo ()tltrmf to1lmte iei t texr(o3iodll n ivtl()sDtr(r nt0oee ifeilt s umnvs;t)arxoifcoo1fmDraueo ()s2xmxm3no1opeemfct s artm(rpnt1oet  o3iydla2rl( onu)treoxf todlmD lueo;t0 2xmxo3nodam elncs tfsDraxr nu0oetoifciyt m um( snu) ltoxo3tydoateanvi;(0 euo(o3iu1oltnmnctlt  rrrxrpou4oetoiociad s2eau o;(4artomocootlpt auvs ()sruoir3no4optnlfei s)srrauroot4altoiicildlm2rl(vpnu4aexrxo3oadoatr nvo;( t2xmxopno1ol  mnct s) 2tm(moou4oltnmf3tyt a2ul(vp;t4arerif3oo1oat  ues s) ruoio ny4ll nmictas  rrm(mp;t1tee  f3ilsla2rmnmp;(0 leoifciotfa  auvo s seuoim iodoptelivia()a2tr(m ou4ole miciydfa2ran p t0 exoio3tatfmt luvs;t  eumirpnu1omenliei (faDrr(r ;u4altnmictltlmDem(mp;()areoxr totomDelneo;s0teur(o3nu1openmfciat) 2rmxm oo0alxnioetld m el(vo u4 rxrif tadlate nvo;( trtoxo3ny4ll e fetlsf rrau  oo0aeenmf3tytfm2umu onu4 lerif3ty1lm  an o (0srurxo3oodll   nctlsfa2uaxr ot1tlx ioeiys a2em(vp;()tltnxo3iy1lp rluvs () etmim3oy1ll nmncias)s2tmxmo;t1olxn f3tldls2ea(mpnt4tetomr ootoaDe uei t)trxrxm ny4ll e ivs (f 2raxmoot1openmiciatlsDuanvs t0 exomo3oatfaD an ilt0srxm(r nu4amtn nes ( s2ua(moou4texoifcilt sDrlu o u4tlxnxocio1oatrln ol( sruoimpnudlle lnvi tfarrrx  ot4apx  ictls m2umu o;t4 lxrio oydfmtrluesl(0texrio3nydll elivias  rrmu  ;t1teenmi3iydlm ean p t) rxomr3oadfmtrlivs;()s2xmio iy4ameemics s a2rrxmpot0tlxo f3iys sDulums (0tleoioctatop e n s t0 exoxr3io1lptnmictltfartmu ont1tpenmi3iltfa um(vs (4artrirciy1omteauei;s setm(o oo4om emivt s) Drr(ronu1tetoio3tyt m rlnvsnt)aexnmfciotfa elnes ( t2uo(o no1al nlfviatfs2rmu o;o4tlxn fetasfm uluvs;() rtoif iy1fa raiei;t sruoxm no1lptnlieiat)s2rmumpnt1ole ii3ils sDemump;(4 renxo oy1lmD livsls)setrim oydlp elicsl(  rrmur ou4tle  o3ilt aDelumsnu0artnxfcoydfp   nes t trtrim3io1omeelfetl( s2rau o;t1oetn iciys sDrmnvo t4aexnmo3iotlat livs;t srtoxr ou4altnlfcia(fsrrrxr ou1tptomicildfm elnvo t0 rtoxo3totoatr uvolt tetrio3oo1ome mneiat srtrx pnu4aetn ieiydlm el(mpnt4artoir3tytoatr u i;s) rxmxr3iy1ol  mfctasfsrtmurpot0open oetys s2rlumont0areriociodoaDeli i;( seuoxrpiudlme  ietlsfarrrxmo;o1oee io3tasla2elnvsn(0 etomo oy1fmDelnvol( s2urxo oudlpee iesasfa2rm(m ou1tpen oeilt s ra( p;(4 etrxrcoodopD  u sls)srtoirpiy4oleemieils  rumx ooo1oetomicilsfs eauvo;u0tltrif3oodlmt au s;s) 2um(mpoudlltnmfvs s  rtr(m nu0tpt  ociltla2rmumo u4trtoxf iadlatean i;s)srxo(m nodoptnmfvsltfsDtau  oo1olto ieiyslm2em( s t0 lxnmrctadlat auvo s trtmxr iu4lmt  ict s)sDumxmpou1oetn fctld s ea( p u)aleoxf3ia1lp   uvilt)sruoxo oo1apt lfciatfsrrrum ot1oeto ieiydla uanms (0 exrxo oatlm ranvs t s2umimpoo4ope lfesa()srurxroot4aet if3iydfs rm( ont0 etnxr oydfaD anei t trtrirpoy4al   ieia( arrr( pnt1aptn o3ildla2eanmsnt) etrir iydomDe uvo s  etrxmpno1omt  nct t)srrr( o;t1olxomoctlsfaDeln on(4 rermo tatfp e i ols) etm(r ou4op emivs tfarraxmont4olenifciysfs2eaumsnt)trenif ootfateluei t) rxo(r3io1op e nesatfsrrmuro;t1aexomo3tlsfaDrmu o u) ltnircoa1oaDrlnvil() rur(opiy4ap   fviasfa2um( pou4apenifeiasls emnmp t)texnifcoodlm eluvi (0 rtm(m io4lmee ivs tfs2rrurono0aeeo fctadls2elums (4trermf iydlptr n slt0trtr(m3iu1omee ncsat a2uax  ;u1open i3iasfm el( o t)tlenircoytfp eauei () 2xm(o3oodalen neil()a2uauro;o0tpen ieiatfm ulumpnu)trenir oytopD li sl(0 2um(m nudol n ictl(faDrmx p;u4alto iciyslm2rlnvs;(0 lxrmf oytlp rlivs;t) 2tmxm nu1lmen ncta( aDrrxmpot4teto o3iadfsDelumo u)altrmf io1la eau i s)trxrxrpoy4llee net (fsrtmx oot4tlxnio3tysfm emnmp (4tetoxrctydop elivsls) 2xo(opoy1opeemicia(  Drmu  ou0tlxnmociyslmDranmpnt0 lxomr oytfm  livi ()teumio3nydlmtnmnvia(farraxmooo4alxoiietasfmDum( p (4tlenmfctytlm eaivi t t2tm(r3nudale mnctl(f Dra(mo;t1tee mf3iyd aDran s t4 renxoctotop  lieo s0tetoirpoudalenmfct t arum(mpnt1tet iieilsfa2umnvp t) etoxrcoatomD lnvils)t2tmxmpiu4lltelnet () Dur(mpot4opeo ietytfaDum( pnu4 lenmo3iydoat aues (0seurxr iu4ll nlfvs sfsrra( oot1aeen o3ild s2ua( o u4aleomfcoo1om   nvsls t2ur(m io4altemivta( arrrx  ou4ope mf3iysls2ra(mont4artrmo3todlpD ln i () eumimpnodlp   fvt t srumu  ;o0tpenifctld s2el(mo;t0trenxo3iodfa eli ols0seurxo3oo4lpen ietls arumxmoot0oet iieiadla emn o;u4artomr3iy1fa raieils trxoir iu1aptnmfvt (fsDtmu  nt0oltomictlt s emu p t0teeoio3io1opD  uvs;()t2xrio3ou1om nmnei t s2uaxmooo0aexomieiatls2ulnmonu0 exnmocoy1om rlu s (0t2tmxm3iodomtn ncs ( sDur(mpoo4tlxnmoeias a rm(vs (0 lxrxo3iadlmDr ivi (0sruoir3iydaltn ici (fartruro;o4aleomi3taslm um(vo (4 rermrcio1oatraivil()s2xrxm3nudlleemncia(  ruau onu4tee  i3ias s rl(ms u0tlxrxf3iydfaDeluvi;t0sruo(m iu4apenlnvsa()a2ta(ront1oee  fciat a ul(vp;t0texnxrcoodlatraueslt setoxr oy1lme mivslt  2urx poo1oeeniieiydlsDrlnmo t0teeriocoa1lm eaieilt) rxriopio1ll n iesatfs2tax  oo1aetoifcildlm uluvpnt)altomo oodfaDrli s ( srum(o no4al emnvi (fsDta( oot1apto fcilsfaDeluvs;u4artrxo3io1oa eanvi s0 etoxrpiydolenlnvs s)s2ua(rp;o1aleniiciytfs2ranvp;(4arxnxr tydlm e i i;t)teurim ou1amt mfetl( artm(mpou0tptoiocildlm2rm(vs u) eeomoctotlp  ln i;s trtoxr3ny4opee fvil( srua(  ;u4oetomieiatlm emu sn(4 eeoxr iatoaDeanvolt texrxo3nu1lmen ivias)s2urx ont0opt  icilt mDumu o;u)trxrxrctatfm eauei t) etm(r3nu4lp   icslt srrrxmo;t4alen fciytfs umnmo;u4 ltomf3oy1laDelies s0sexmxm3ny4omte icsat  2uaxm nu0apx micild sDrauvo (4aexoio oa1lmD  ueils texriopno1altnmicta(f 2umumpnt0oexnifeiat mDrmuvo t) leoxr oadfa eaies;t trxoxo no4amtnmnetasfs2ua( pnu1oexnmietlt sDrmnmp;(0tleoxo3tatop rln olt0seuo(opny1ap  mnvsl(  2ua( o;o4texomietytfsDuaumo t)aeenif tatom  ln olt0 rxmxm nu1lm nlicsls  2rm(r no0tee  fciadfmDemn o;(0 leoxf3oodlp elnvol()s2xmxrpno1lmtelfvt tfaruaxmp;u0aexnmf3iltla rau o;u4arxomr iatopDeauvs;( trtrio oudolenmnvias  2taxm ;o1aetoif3ild s2ulnvp;t)aeenirciy1latranvils)teuoxmpio1ale licslt srrmxmpoo0aexnmociaslsDum(mo (4alxnmo tadomDelnes s) 2trxo3io4omt mfvil(f rtaxrooo1tex  ieiadlm rauvsnt0teenxr to1fmteaivs;s0 rurxmpny1lmte ici sfsrum( pou0aex io3iysls2rm( sn(4trtrmfciodla  lnvolt t2to(o3iu4openlivta( aDta( o;t0aleomo3tyt aDeln on(4arxoio3tytlpDelivo () rxrio iy4lp   ivtas aruauroot0alxoif3iyt mDumnvont0 ltoxo tytfateau s (0 2toio3no1op emivslsf rur(m ;u4tltomi3ildlmDranmonu4aexomr oydoaD auvs;t  2xrio ou1lltelfeias sDrax pou1apt moctat m2uauvs;t0alenxocoytoaDe nvols0seurio io1ll nlneiasfsDuru pou0aleomfetyslmDranvs;u)trtrircoatfm rlnei s0 rumir3iu1lpt liet t)sruax p;t4olx mfeiasfs emnvp t4alxomrciy1fmD  i i;( teurio3no1al e nesa( sDrm(monu1tlx ii3taslm el( o t) exoxo tatfmt an s t)t2xr(mpoy4lm  lnctl(fartmurpoo0tlt  ociltfs rmn s u0 exrmr iytoaD  nvs;(0 2ur(o3iodoltn nei s arrm(  nu0opxn i3iadla ua(vs;u4aetnxfctytop rauvi;s) 2um(r iu4omenlnci t)aDrrxro;t4aeto fcildfa ulnvpn(4 rxrmrcoydlmtrlueo;s0 rto(rpoo4olt lnes tfa2ururp;o0aex iicils mDuan pn(4 lenxf3iatopDrlueils0sexrio3iy1ape  nctat  rur(  ;u0tee mfciydlm2rlnvp;t4aetnio3oa1fpte nvi ()tetmxm iudalt mnetas  Dtmur nu1teeo o3iytlmDulnvsnt0tetnxfcoa1omDeau i ()seurim3oudam   nci tf 2tau  ot4alx ifeilt s2eln pnt4 ltrmo3iodlm eluvol() 2tmim oy4amt lfvsa(fs2tax pot1aleoiiciysls rlnvo u0 exrmf3iatomDeliei;t srtrxrpnodlmtelnvt () Dumxmp;t1alxnii3iysfmDrm(monu) exrmfciatoa eli i s)srumxrpou1ol  mnvi sf rrmurooo1tlenmf3ilt m rm(mp;t0tltrio iydfmDrau s;t)s2umxo oy4openmfvsasfsDraur ;o0aleoifciltfaDulnmp (4trxoxfctytlp  ln sls0 2urxrpiu1am   fes s a2taxmpoo1oltoii3iysfmDraump;t0aeerio totlatrauvo (0srumio nu4llee nvsls)a2tr( ont1olenmictatlaDel(vp ()alxrxo oodlpDr ivslt) rtoxr3io4lpee nes sfarumum ;o0alxniicias sDul(vs;u0 rtoxocta1laDrlies;()srxrxo3nu4ll  lfetl()srum( pou1tpe  ociysfa2um(mp u4 ltrxf oydfpt luvs s)seurxm oydllt  nes sfa2tmxmooo0apeo o3tydla ra( sn(4 rtnxr3io1fm eanvo ( sexr(rpno4alte ncsls)aDtm( oot0aexoio3tlsls2em(mo;t) rxoio oa1lptr uvols0truoiopou4llt mivi sfs2ta(rooo0ole  ociasfm2umn o;t4 etrmocto1fatelies s) rxoxrpiudllenlnet t)aDtax  ou0tpt mfetlt a2ra( o;t0alxnmo oytomDrlieo;s0teurim3ou4opt mfcslt sDtrurpoo0tltn i3iadfs2ra(mpn()alxrmr iotfate ivils tetr(mpiydlptn feiat)sDtrxm ;t0aexniociasla el(vp;()tltoir3todlm ean s;s)trxmxr3ou4am nmfci ( a2rax  oo1tle iiciltlaDumuvo (4tlxnmf3iotfp  ai o;t  2uo(r no1ol emnvsasfaDraxmpot4olt  ieilslsDea( s t0artomo3oo1fa r u s s setoxr oydoptnmfviasfsDrauroot1tltn iciyt aDemnvpn(0artrmo3oy1fp r ueo;s) 2toxr3nodap elfesls)arrmx  ;t4tltomi3tasls2rmnvont0trtomociydfptrlu s;(0sexm(m ny1op   ncs (fsrumx o;u0oltomiciyt s ua( pn() lenmr oo1lpDrliei t)srumxm3no4lmenlnetl( sDum(mpoo4oexoiieiaslaDrm( s;()trtoio oydfpDrlu i t sexoio oodlptemnvta(faDtr(ro;o4optn feiatfmDuau p t0 lxrxf3oydfptr nesls  rurir iu4lm emfvsl() Durumpot0texo f3iysfaDrm( snu) rxoio tytlptrlivo (0srxoxr io1om emfvi ( a2rmx ooo0aetomo3iltla2ra(vs u0 renmfcio1oa  anvilt0setmio nudole lfvtasf 2uax p;t1alx mietytla2rm( o (4teeomo iatom eli o t) rxmim iy1lp emfvsls) 2umumont1tpe ifeils mDum(vo (4tltomf3iy1lpt  ivi;s0texr(rpoy4lmtn fvtlt) Drmu o;u1tlenmf3tatfmDulu s;(4 rtrmo3tatomDr i i (0t2tmio ny1aleemictlt sDrrxrpou4aet mociasfs2ranmsnt4tlxoxo ia1fm  au s;(  etr(r3nu1altn ivt sfa2rrxr ou4apeniictydfaDum(mo (4areoir iotfm  an i;s0setoir3nydlp  lfvi s) Dtru pno1alt ifciatfa ua(vs;(0tltrif iy1fpt an i;( s2toxm3iydopee iesa( srrax o;t0opxnioctldla eauvp;() etoif3tytlatr u s;s trtoxm3nodlmeelfeta(  rrmu onu4teeo i3tldla eauvs;()teenxo3io1omtr ues;s)t2uoio iu1amtelnvtls srtrx o;t0optomi3iys s uauvsnu4alxomf3iadfmDe n i s0teurxopoo4ap nlnvia( aDtmumoot1tltnifetytfaDem( s t0alerxo3ootfm ranvsls trxm(m3no1lptnmict (f rumur ot1aetniictys s2eanvon(0trtnmr tytlaDraueils0srxmxr3iy4alenmfvil()a2ur(m ot4oeen octls m eauvsnu0trxnmociadopt  ueols) etoir3oo1alee nvi t aDumx onu1tltoiictas a ua( o u0alxoio iatopDr ivolt0 ruoio3nudapee ict (  2uax poo1olt ii3iydfa emnvo;u4 eenir3todopDe ivo;()t2xr(r nu1omt  ictas)a2ur(  ot4tet ioctad s rlums u0artomf3ia1fm e ivsls0s2xrxrpoo4lptemivi sfa2urx pnu1optn o3iat sDuau s u4tetrioctodomDe u s;s s2xoxr3oy4ap   fci tfsDururono0tltnmictyt aDean o;t4treoxo3iadopDrauvi () eurio iu4amenmncs t  Drrx o;u0altnifetytfa elnvs;t)alenxf totoptrlu ils  euoimpiu1ol emnvs () 2um(  no1opt iieiadfa rau s;u) etoiocoa1lp raueolt)seumxrpoy1ap e ict s)aDum(  ou4aetoifeiad s rm( pn(0texnmr oytopteai i;t0 eumxrpnu4om e nei t)a2rm(r ou1aexo ictyt m el(vo t4 etnmf3ty1lmDe nvolt)trumxopoodomte nvi tf ruax  no1tpxn fciasfm2rm(vpnu0artnio io1om   nei;()sexoxr3oydamee neilt  Dtaxr ;u4optomfciyd a rlu p t)trtrxo3ia1opD  ivi;s)trum(m3oo4ame mivs (fa2rmum oo1tleoiocils mDem( p;()artnmo tadfmt lueo s  2tr(opiodapt miciat  rumxmo;o1opxo f3iysfa2rmu on(0 eenio iatopteli o;t) rumim oy1omee fesl(  rtaur ot1tet moeiytlsDelu snt) reomrciy1fpDeanvols)sexoim3oo4ap n nct sf Dtmum ou1aex ifciytfm rl(ms t0tltrirciatomt anes t)texoxm3oo1ole  fvs sfsrtm( o;u0tex  o3tatfm um(vs u4 rxrmf oytomDeli o ()t2tmxo3no1al nmnet ()a2trxmooo1teenifeiasfmDelnmsnt) ltoxo totlmteluesl() eto(opnudolen feiat)srtrum ot4texnmfciydfa2uln o;t) eerirciodfp  anvolt)seto(m nodlpt  nvs tf 2raum ;t0teenioeiytlmDuau on(0alermr3ia1fmtraieolt setrxr iodop elncs ()a2trx  ot0texo o3iatfmDrm(vs;u0altriocia1omtrlu o ( s2xmir ou4lltelncs s)srrrurpnt0tltoifeiydlm umuvs;(4trtrifcio1opD luvol(0s2xo(mpiy4lm   ncs (  rtm(rpno1olxn oeiatlaDrm( pnt4tlxrmrcoy1la eauvil(0seto(r3ou4om nmnvta()srta( ono0aetoifeiyslmDemu s u) exnmr3tytfm   ivs;()s2urxrpno4olenlicil( aDtrxm oo4tlxn feiyslm em( s;(4trenmo iodop e i sl( setrim no4ape lietls s2umxmp;t4alxoifetlt m2eaumsnu0arxoxf totop raivs;t0trxmim3io1apt lfesa()a2umxmont4apeo feiyd a2rmu on(0 rtnxr3oo1fmDeli o;s0t2tmxr3no4lp n netasfsDraur ;o0olx mo3ilsfaDemu pnu4altrio3oodfmDe u o;s) 2xrirpno1lpenlfesasfsrrau  ;o4oetnifcilslsDea(vpnu)arxrxr3oo1fmtran o;t)trtrxrpoy1lle mfvsa()s2urxroou4alxnifeiydfmDra( pnt)artnxf iydlpDeln o;t0srxmimpiu1oleelici (fa2tm(  nu0texomfctldlmDeauvs u)alxnircty1omt  nvsl(0truoxo3iu1llt lnciat)aruauront4oexnmictltfm2emu pn(4tltomocoadoa rai s;( t2trxm3nydale  nci t a2raxroot4tpenmfetadfm el(vp;u0 lxnxrcia1lpDe u i;s)s2tr(opiy1aptn neil(fs2rm( oou1alx  ieiytla2umumsn(4 rtrxrcta1lp rlu o s  rxoxmpoo4ap nlfvilt) rrrur ot4tle moetldlmDuauvo;u0aetnifcoodfm r u olt seur(rpiy1ll  mivsas) 2ua(moou0aetnmo3ild a2rl(ms;u4aexrmrctadlp r ueolt srxrim no4amtelfcta()s2umxrp;o0olxo ietadfa rmu on(0 rxrif3oadom elivo (0trumxr ou4lpte fcs s  2ra(ro;u4olxnioetlsfaDea( s t)tlenmoctodfaD  ues s truoimpiudlmeemnei s sDrr( ono4ape miciys m2uanmp;(0 renxr3todoat auvsl( s2toio nu4openlfeias)sDrau o;o4opeoifcilsfsDemnvo;t4 eermr todlm rlnei;s)trtrir3oudalenlfeia( s2tr( p;t0tlxo ociysla2uan o u0aetoio tydlpt lueols0texo(o3oy4apeelies (fs2tax  nt4opeo ietldlsDrl( o;()tleoif oodlptelnvi;s  2to(opio4am elfvtlt a2um(mont0oleoif3iad m eanmp;u0alxomocoodfat ln i;(0 2xo(o3iu1lmtelfctlsfa2rmu onu4tpt miciyd sDelnmo;(4tltnmociy1fatraueo s0sruoimpio4ol nlivt tfsrumu  nt1olxo octlt sDuan on(4tlermrctadoateaieo;s  euoiopiy4lm nmncs t srta(ront1aexn octasfs rlu s u4 reoioctotoa eln i;(0srtm(r io1lmeelfeil()aDrmxmpnu0optomiciydlm2em(ms;t0 etrmf iydopteaneolt t2umxopnydlm n nvs s arraum ou1tpeniictltfsDemnmsnt)alerxr3iy1op eaivo;s0seurimpiydlmtelnei t a2uaxmpnu4teenifeiydls2ulu snu) rxrio tadfat  ies (  euo(o oy4lm emnvsa() Dtrxr ot0tlenii3ilsfs2eaums u4altrxr iodlat anvs;t0trurimpoy1lpeemnesa( s2tr( pou1oex mi3tasls umnvon(4tleoir3todfptr uvol() rur(opny1lp elnciltf 2tm( o;t0tpto o3tydfaDean o;u4alxrif to1op eluvo;()sexmxr3oy4ope  ictl()artm(rpou4texoii3iltlmDuauvs;(4trxoxrcoo1omte ies;t)setmirpnodal nlivsls srum(rpoo1tle  o3iys aDulu p u0tltnmr3oytfp elnvil(0t2trxm3oo4oltnlicils)sDtm( ont1oeeo o3tytlmDemuvon(4texnif totop eauvi;s s2umirpoydaptnlnvtls)aDtaxmp;o1tpx mf3ilsfm2uanmont)aleoir iytfm  ln i t)trtmir no1oltemnesasfa2tmxrpno4oltoio3ildlmDrlnvp u0tlxnxo iadfpt li o;s)texmxo3no1al  licsa(fsrtr(rpot4tpxnmfciatls uaumo () rxomrcoatop ranvol(0truoio3ny1ap elncs t)arua(m ;t0aleomfeiasfm uanms;t)artnmf iadomtelieo s srumim3io4oltn fvilt) Dur(  ;o1apenii3iltfm ulumsnt)aeenmf3oo1oaDrlivi t texmxo3oydll elnes sfarrrx p;t1oexoifciydfs2umn s;(0aetrmr tadfaDeauei t seum(opou4altnliei (fa2trx  ;u0apeomictasfa ulumonu0 renio ta1fmt  ies;s)srumio nydll   ivs (  rtmurp;u1oltnmo3ildlmDranmpn(0texnmf3oa1lmteli i;(  eurir3iu1op   feil( arrmumo;o4opeoiociydlaDel(vpn(4tleomo3tydfaDelu s;t trum(m3oodll emfcsasfs2tm( oot4ope  feiltlmDrmn sn(0 lerxrciadfpDeli olt)s2to(o3oodol n fet s)aDtau poo0aetn f3tyslmDelu o;t4areoifcoy1opDrauvsl( sexmxr iy4am emnesltfa2umu oot4teeomf3tadfs ra( pnt4texnxfctotfaDr u s ( seurxopoo1lptnmfetatf rra(  nt0ole ifeiatlmDuluvo ()tlenxr3tatlmD aneil(0trxrir nu1lpenlnvs t  rtm(r ;o1oeto ieiytla uan o t0 rxoxo iadomteanvsls) ruoxr3no1ame mfvias)artax  ;o1opto fctadfsDumums;()texomr3iytfm r nvilt0truoxopiydolee iciasfaDumu o;o0oltomfctadlm2uau s;()aetnir oydomte nvo;s) 2triopiudopte ici t aDtrx  ou0tpe  o3iltla ran o u0alxrxo oodfm e u i;t)texmxm3ou1apt  neia(fa2raur nt0oet  iciatfa2rau on(4trtnxr oy1fp   ivs;(  2tr(mpiy1ll   icsat) rumxr ;u4opx  ocils s elumsnt4 lxoxrcoy1latraueils)srtm(opiydamenmicsat)aDuaur ;t0tpxniicild m em(msnu0aleomr oa1op  auvils) 2urio io1llenlnvt (  rrmxmo;u1opt  fetldlm2eaumon(4tetrxr3tydfat an i;s0s2xmxr3nu4lp e fesat aDrm(  oo4aet if3iysfs rl(vp;t)arenxf3iatoateli sl() 2ur(o3no1apenlnesls)srra(rpno1olenmiciltfs2rl( s;t)texomo oatomt  uvi t sexoxmpnu4omenliesl()a2ra(  nu4apt mieiydfaDumnvp;t)alxnmf3ta1fatelnes;t)setmiopnudaltelnvt s) Dua( p;o0tetnio3iytla2rlnvs;u4 rtoxfciy1opteanvils srxoim iu1ap e ivsatfa2rrxrpou1optnmociatfs uau snt4 eenxr iadlatranvo t trto(o iodaptnmnes t  Dtruro;u1tlxoifetadlsDul( p t0tleoxociotfatranvs s0 rtmxopou4ameemfct s)aDum(  oo0tptomocild s2rmumsnt4trenxo3iadoaDr ivi;s0 ruoxr ou1lmenmncil(fsrurxroot1alx mo3tasla2rmnvs;t4 exomo3oydom rlu o s0trur(r3oo1open ncs t)s2tru pnt0olxoioctytfm eluvpnt0alenxrctadfa r nei t t2urxopnudaltelnvta(f 2raumo;t1oeeoiieilt a2emnvo;u4arxomr iadfaD  uvol( t2xrxr3oy1aptnmnes t)sDtr( onu1opeoioctad aDumu onu4aexrmf oo1fa rln i;(0s2urxo3iu4lpen nct sf 2ua(r ;u4apto oetls a2ulums u0 lxomociatfatraiei t) rumxr oydllt lfetls  Drrxmp;o4oex mictlt a eanmp;(0arxrio iadlpD ai o;s) ruoim oo4aleelics tfsruru  ;t4olt if3iysfs2ua( p u)tlxrmr3iy1lmDr n i;s setr(m3nodapen nei sf 2umxrpno0opt mf3iysfa2ulump;u0aetoxfcoytfm  aivs;s0s2um(o oy4oltnmfvt sfs2rm(rpot4alxomf3ilsfm2emuvsn(4aleoxo3todfmte nvi t0t2uoxm iudap   netls  2tm(moot1alto ieiltls rluvsn(0 exrmo oatom eaneolt) etrxopno1lp e nesltfsDurxmpot1oetoiociasls rauvs;u0treoxf iytlm  luvo;s0trxm(m3no4lp  lieias)a2uru  nu4aex iictytlmDem(vpnt)trxoxfciatfat au s;(  eur(o3oo1op nlfeils s2rmx oou4tlen ieiyslm2ulumsnt) exnmo oy1fa elneilt sexoim ou4ome mfetl(  2ur(r ;o4oet moeiadfa emnvp t4tlenmfcoa1laDrli s s0tetriopiudlm e ics t artrur no1oetoii3tadfa rmnmo t0 etrmociotfmD lneo;s)s2um(mpnu1apenmnctlt)srrm(  ;o0tpeomfctyd m2em(vp;t0texnmr oy1fate uvi () eurxm3io4om e nvias)s2rrxm nu4olxn ociyt a2elump t0aexrio3iatfmtrau s t seum(opou1omte ivtls)srrax o;o4oetnmiciadfm2emnvsnu) etnmr io1lpt  nvol( srum(o3no1oleelivsa(faDtr(rpno0alx iieiysls rauvsnu) exrxf3iodfaDrauvolt0sexo(o iu4lp nmncs tf rur(  ;o1olt mociyslaDulumo u4treoifciadoa eau i s0srtrxr3nodlpe mfet t)srtrumpnt1tle moctyslmDulumon(4treoif3iy1lpDe ivi;t0t2umxo3ny4am e ncslsfs2tr( o;u1ole miciysfaDeaumo;t0treomo3tadlpt  n o t)teto(opou4opt mivt s) Dtmuront1apenif3iatls2rmnmo t0aeeomocoodom e u s t0sexmxo3oodomt lieilsf Drm(mpno1texoif3ild m ea(vp;u) eerifciy1la rlnvsl( srxoiopou4al nlicsa()artaurono4opeoioeiltlaDumump;t4 ltnmo3ty1oatr i s t0texoxmpio4ale lieilt)aDtau  oo0oetnio3ilt s emnvp;u)arerir3oytlmDe i i (0teuoir nydapt  ietls) Dta(m no4tlenmoetys s2ul(vo;u0tlenmfcio1lpDrau ils)t2trxr3oy4amtemnvils  2rmxro;o4opto fetatfsDea(vo;u0teerio iydlat auvs;s0t2xmirpnu1lmtn neil()s2ta( o;t0tpeoioeiyslsDulnvp;u) rerir ta1lp   nvolt0 2tm(m iydol n ictatfs2rmurpoo0oee  i3iltfaDumnvs;(4aexoxo ta1lat  u ol(0s2umxr iu1am nmnei s)arrmu o;o0alxo o3iad a ulumpnt4 eeoxfctytfmtr u ol(0 exm(opnu1llenmneils)aDuaum ot4opxo fetasls rm(vo;u)artomfctatlpte uvi;t0s2trxr3io4optemfvtas  rtmxmono0aeenmieiasls ua( sn(0 etnif3oa1omte ues;t tetmxopiydapt mivilsfaDrmum ot1olen ietldla rmums;u0 exoir iy1opD anvsl(0 rxmirpoy4am n fesl(farra(mpot1tpeo ocilsfs emnvont0trtomrcio1faDeliesl(0t2umiopoudlmtn nci sfsDrm(ronu4apeo icildlmDuanmsnt)altnxr3iadfaDrln sl(  etrxm ou4altelici t sDrax oou1tet  fcildfs uanvsnt4teenmf ia1fmDrlivo;t  2xrim3io1am n neiat)arumu  no1olenmoetasls ea(msn()treomo3to1fmtelies;t)sexmxo iy1llt lncsl(fsDtr(mpou4oet ioeild sDrmnmp t4aeeoio3oydoaDelu i t) 2tr(m3no1ameemiciatfsDtrxrpou0altomfciytfaDrauvpn(0 etnmf3iydlmD ai o;t srxrim3io4lpen nvia()sruauro;t1oex iieias s2uau s;u)aeenirctadfa rlnvsls)sexrxr3iu4apee fct t)aDrrum oo1oeeoio3iytfmDumnmpn(4aeeomociadlmt auvs;(0setr(m3nu4lpeemncs s srrm(ronu4tpt  ieilt mDulumo;(4treoiociytfmtr i olt)srto(rpnudll  mfct t a2taurp;t1texo fciyd sDulump u0tlxnxfciotfpt lies;(0trxr(opou4altnlfvtl()aDrrumo;o0tex  fciysfmDelumsn(0artrioctydfp r n slt0 2urirpoo1amtemivtasfsDrm(rono4aleo i3iysls eanvsnt0texrif oodopteli sls)tetoxr nu4llenlfcia() 2ta(rooo1aex moeilslmDulumo;u)aetomf3tytlatrlueo;( srxr(mpnudom n iet s a2trx oou1aeeoio3iysfsDuau p (0teenxf ootlaDrlu olt)seurir iy1aleemfctas) Dum(m nu0optoii3iytls eauvsn(0alermr3oydomteln ilt0 exrxr3iu4aptn iesl()s2urxm oo0aeenmfctlt s2ua(mp (4altoifcoadlatr i s;t  exoxr3nu1om   nct tfs2tr( pou1olxn octyslm ran s u4tetrxr tytfat luei;() rxo(rpou4lp  mnctas  Drrump;o1oetnmi3tls a elnmo (4 exrxf3tadomDe i o s0s2xmxo3iodam n nvtas sDtmxm nt0opeomoetys s2el( on(0texrxf iotfmt aueo () etr(o no1al  lnctlt arra( oou1alxn ieiatfsDea(mo t0 exoxo3tadom r ues;s0trxr(r3no1ope mfvs () rrmx  ;o0teeo i3iyslaDul(mpnt4 eenmo3iodfp   u i;t tetoxmpoudap n nes sfsDra(r ;t1tlx moetas aDuluvs;u)tltriociydfmtr u ols)s2uoxrpiu4oltemfcia( a2umur no0oleo ieiydfsDua(vpnt) etnmrcoadoa  aues;t trurxo3oo4alenmfvtlt  Dtmu oot1tpt  ocils aDul(vsnu4tltrmo tadlat lieo s)t2xrxo iu1lme mnvslsf 2tmumoot1altomi3iasla ua( snt4tltoifciytop ean o;s) rto(m ou4ol emfvilt)srtmur ot4tptomociydfm2um( s u)arermf iodfmtelieo;s0s2tm(o3iy4aleelfetlt)a2ur(r no0aeenmoctysla ulnms;t0tlerif3tytfatran o t  exriopny1op n netl(f rrm(rp;t1tet iicildfm umuvs;()trtrmo tytom r n s s srum(mpnu4om e icil() 2urx  ot0tetomf3tldfmDrl(vp (4aeeniocio1oat  ies ( srtoim no4amte nctatfsruru  nt0aexo ieildfm2rlumpnt0aleomo oatlmD aiei;t)trurirpnu1ole  fvilsfaDururp;t0olxoifciyslm ulumpnu0tetoxf3iadoatrliei;t0 rtr(o3oy4oleemncta(f rraur ot1tpenmietldfmDum( o (0alerxo ootlpteluei;s seuoim ny1oleemieilt)aDtr(  no4oltoifetyd s2emn pn(4arxrmocia1opD  nvi t)t2xmxr3io4alenlnvsl( s2umx  ;o4tlxoio3iyd a ul(vpn(4tetrmocoa1lpD  ues s) 2ur(r3oydolte fvsl(  Drmx pnt4tee  i3iad aDean pnu0trtnxr3ta1oa  lieol( srxr(mpio1omtelfvi (faDraxmpno0optoioeils s eln s;(0 rtoir ty1opDe ueilt0trurio iodoleelncia(f Dtmxm no1optniocils m rl(ms t0arenmr io1fpD anes;(0 euo(o3oo1om   iesa(fsruru oou0optoiictydlm rlnvo;(4areomr3tytlp e n i;(0srxr(m ou4ap  mnvilt srtmxmo;u4aexn ieiyd aDuluvsnt) rxrif3iydoa  livo ()sexo(m3iu4altelivta(  rtmu  ;t4ope mi3iydlm emuvo;t0 reoio oy1fpD livils0s2um(opnu1alenliciasfsrtmurpnt4tpto fctyt s2elu o (4altrmf oa1la ranes;( s2um(r3ny1op   neilt)aDrr( oot1aexoif3tlsls2uau onu)artnmrcoodom rln i s)s2trxo oydllen fviasfsDrmum ou1apen oeiadlsDumump;u4arxrmr3oodlp e ieslt)tetoxopiydape mics ()srtm( o;o1olxo o3tysfaDrlu s;(4aexrmrciydoptr ivols t2xm(o3no1apt lncsl()s2rrx pou0optomi3iasla ul(vsn(0aexnxf3iytfpDeaieslt  rxo(opio4al elnvsas srtr( poo0oee mo3iasfa rmu pn()tltoifciotfat li o (0s2xoio3ny1lmt  iesa( s2rrx ooo1tet iietltfsDea( s t4tetrif tadlm elnei;s0t2xm(m3oy4apte nvi t)srtaxront1tleo oetysfa2emu p;u) lerif iy1lptelneo;s) exoim3oo4lp   iet s artruront4tex  fciatls2rmu s;(4aetrir oatfpDeaiei ()srxoim3ny4ole  icil(faDtr( pot1aptnmietytfs2uanmp t0alxnmo3ty1laD  n i;t)texm(opiodal e fcils)s2tr(  nt1oexn fctlsfs2ean o;t0 lenmocoatfaDelivs;(0s2um(rpoy1oleelivi s  rrmxmonu4oltomociad aDeln snu4 lxnmf ty1oaDeaivo t trxmir3ny1ap e nvt t s2tmu  oo4apx  i3iad a rmums t0 eeoio3totlaDe uvi t)trumirpnu1al n ics sfartaxmpou1olt iietat sDemuvp u4trtnio3tadlatrau i ()trtoio ny1llt  ici s)arrax  oo0oet ifciaslaDeanms;u)aleoir3tadfaD  ueo;(0 rtmio oudoltn ieslt srtrxmoot0tpx  iciyt a um(mpnt0 eeoir3oo1lmte ueo;s seuo(r3nudlle  fvsasfsrtmumpot0tex if3tlt s umn pnt4 lxomf3tadlmD au i s) rurimpiu4am elfct s) rrau  ;t0texn octltlm2uluvonu)aexrio ia1oa  ai slt s2xrxm3ou4ol n ict s)srum(  ou0tlxnifeiat aDrauvs;t) lermo tytfm   n slt0t2umim oydlmeelfct tfs2uax pou4oee iicias s2eluvsnu4 ltomfciytlm rlnvo t) rxriopnydamtemivt t)a2rmxrp;o0oleoiocildfs2rlu o;u)arxnmo oydoaD  n il(0 rtr(o3io4op e iesa( s2rrur ;t1optnmoeiadfs2ea(mpn(0aeerxr3oydom ran o () 2xoim3nydopeemfvta() rtrxmpno4tpeo ietyd m el(vs;(0 ltomocoy1op rlnes (0t2ur(o3nodolenlfvia( s2tr(r ;t4apx mfciadlmDeau s ()aeenio iy1op rauvsls s2urio3iodom e ncsat)sDrmur ou1oleomo3tyslm rm( p;u)texrxf3todfmD  i s t srxr(m3nudameemictlsf Dururpot4olxomfetatlm elumsn()tlxrxo3totfat lu o;s)t2uoiopnu1lp  mfvtat aruru pnu1aeenmictat s rl(vo;()artnmfctytopDrauvi;(0 2umiopiudlm emiciat arrm(ront1aee mieiasfsDrm(vsnu4tlxnio3tadlpDe nvs t0 rxo(r oodapen netat) Dtm(moot4aeto fciasfa2umnvo;(4artoif ia1optr i s ( trtoxo oydomt liet ( s2rmur no4teto ieiadfm rm( s;t4 rerxocoo1lpDe u il( setrir3oy4ame  nesls  2uaxr nt1texo iciydfs2ra( s;u4 lenirciydlp r ies;(  exrxmpny1olen nctas  ruaumono0apeoiicildfs el(mo;t4tlenioctydla   nvi (0 rumirpio1amenmiei sfsrraxro;o4aee mi3iat mDemn p;(4aetnmr oatlaDeaues s srtmirpiy1olee iesat)a2taxm ;u4opeoifeiat s umu o;(0 lerio ia1fm  an olt  exmimpoo1omeeliciat) ruaump;u4optoiieildfa2ua( onu0tetoxr iatfpD li o;s)s2uoiopiudllenmfeil()arurxmpoo1oetn f3tydls2ranvs;u)alxnxfcto1oa  ln i;(0trxriopou4optn ici s)a2taxmp;u1opto oetatfa elnms;u0 lxrxr3ia1oa elivol(0teumim3oo1lpeelfvt t)s2tax ooo1texniietadla rlu p u) ltoif oadfmtrlnvol( s2trir nudlpe miesasfarrmx pnt1aetomieiytfaDea( p u4texoxociotfp elivi ()trxrxm oudole  ivsls  rumxmonu4teenmfcias a2emnmp t0 eermr3iotla rauei;s)setmimpnydlltelnvsatf Drrxroot4olx  oetld a ulnmpn(4 rxnir oy1oa e neo s0tetrxmpoo4llt mfvils)sruaxmpnt4aexnmf3tlsfaDuaumo t4artnio3to1faD auvilt0s2trimpoudoltemivslsfs2um(mono1tltomfeiyt s2uan s;u) leomr3tydfp r n s t)t2xr(mpio1op n nesas  Dtm(m ;t0olxoifctytfaDrm(msnu4 lxnifctotoa rliei t  eto(o3iodlleelfvs (fa2raxr ;u0apeomoeilslsDulnmp u4 etomo3ta1opteluvs;t)teurxr3oydalenmiciat sDraurpou1tpxomf3tytlm eln sn()tetnxr oa1lpD luei;t tetrxo3iu4apeelfetlt  Drmumpno4oee ioetad mDum( p t0 ltrmo3tatfpt ai olt0teuoir iudop elietlt) rurxrono4aexo i3ild sDrauvo;t) leomrciydoaDe u sl() 2xmio nudom nmietlsfaDtaumpou0tpxoifcils a2emuvs t4aeenmo3oy1omtr nei s)t2umxo oo4llee fvi s srta( pou1openioetldfm2ra(vp u0 ltoir3iotlp elneils)truo(opoydllte ieiasfa2rr(mpnt1tleo o3ilt sDuanvs (4alenxo3ia1oatean i;s srtmxm iu1lp  mfvt s) rtmxmooo1apenmictat a ea( o;(4tetnxf3io1fmDraieo s)trxmxo no1lleelfes (fsDtm(rpno1oeeoif3ilsfaDumn s;(0aeenxociydomte uvi (0trurirpnodlmeemncia() 2tax  ;u1apenmo3ias s2ea(vo t)aexnifcoytoaDrliei () 2toimpno1ameeliesltfaDururo;u1oetomo3tls m emuvs (4texoxo3totla eaiei;s tetmiopiodome mfcias  2ta(r ;u4apxo o3ildla2rau pn() rtrxo3tytlmteli s ( srxrimpnu1apt mfetl(  2tm(m ot0teenmfcils sDrlumo;u4arxrxf tadlm  au il(0 eurir nu4omtemnvsl(  2ra(mooo4aet mi3iltfmDel(mo;(0 ltnmr3ty1lmte nvils0teuoxrpoy4olen ictls)sDrmxr ;u4tpxnio3iaslsDraumo;t0aexomrciytfmt lieils trxo(r3oo1al  lfvt sfaDta( oot4tlt  fciysfmDelnvo;u4alxrmociodlmtean ols)trtr(o3iudlp  lietas aDurxm oo1tptn fciltfs2eluvo;u0alerio3oo1op  an s s)teurxm oo1lmt mnvilt  rua(mo;u4tetn fciat mDuln p;u)aexnmoctadla r u i;s)t2tmxo3oodomtnmnvils)srtmxroou0oetnif3iys m2rmnmo;u0tlxnir tatlmtr ues;s)teto(o3io1al n ieil()sDra(mp;u0aex iietld s um( snt4 rerxr3ootop elu olt trtrir3ou4omt lncslsf Dtmu o;u4alxnmiciltla eanmp;u0alenmf oodoa rlies s)srxoxm3io4lpte ivias sDum(r oo4open ietatla2ea( ont)aleoxfcoy1lateauvolt0setr(r iodol elfesatfsDra(  ot1alen f3tldls rau snt4trxnxrcoo1omDeanei t t2xmiopny4olte ivs t)a2ur(m nu1aleomoeiydlsDum( p;(0 rxoir oy1lpt  i i (0teurirpoodlmte ictlsfsrrrurp;u1openifetatfm ean pnu)alxrxf3to1optelnvs ( teumxr3oo1lpe lncil(faDua(m ot1olx  feias sDel(mpnt4aeeomr3oadlmte uei s)t2xmirpio1ame  fei () rtrxrpou1aptoiietadfa raumpn(4tlermo tatfpD luvs s)trtoxopny1am elnviat)sDum( oou4apxnifciyt a2ranms (0 rtoxocio1om ean ils0texoimpou4llenmivtlt)sDrrx  ;t4tle  ociatlmDra(vo;()altoir3oa1lm raies (  rxr(m3ny4opte fci tfsrrrx p;t1tetnif3iltfs2umu s t4tlerio3iytlp  lieo (  2tmir3nudom emnvt sfsrta(rp;t1tptoif3ild aDumnmo;(4 ltnxo oytfatelnes;s) eurirpoodlmt miet (faDumxrpot4alx  o3iltla eauvs;(4aetnmo oa1om rlu o s)t2umxo3iudlleelivslt)srrr(r nu0olxoiiciatlaDum( onu0 leoifcoydfa   ueilt  etoio3oy4amtnmnvta() 2tmxro;u1open ieiyt a2rln onu0tetrio3totopt lieil( s2xrir3nudal e ivsltfsrtrur oo4aee if3tls sDem( s (4aexrmf iytla  au i t)texm(r ny1opt  nci tfarrm(m oo4tpxomoeiysls eanmpnu0aleoxo3ta1lmDr uvi;()s2um(o3nu1lmeelici s artr(  ;u4alxnifciatlmDumnms u0alxrxf io1oat  i sls)tetoiopiydol nmfctat sDraurpou0tetomoeiaslsDel( s u)treoio3iotfmteaivo () 2toirpoo4lle  ieslsfsDtrum ;u0texn f3tydfa ea( sn(4aexnif3oo1opD  u s;( srtrir oo4olt lietltfa2tmxro;o0tltoii3ildfsDrmnvpnt0 ltnxo oatlp  luvi ()setmio nudlpe  ietls sDtm(  oo1oltoiocilsfa2umnmsn() lenioctydfm r n i t  eumxr3no1lp n ivtls  rraxrpoo4tpeoio3tls m2rluvp t4 lenxr3iadoa rai i s  2toim nu4ap emfcsa(fa2rm(r ot1tlxomi3iad m rlumo;t4alerxo3iatfate i slt) eumim3oy4alenlfvi t aDumuro;o0opto octld s rl(vsnt)teenir3iodla rlu s;t0seumxo ou1am emivtat) rtrx  no0olt ifeiydfm2uaumpnt4arenxf tydoaDe ieo (0tetoxr no4lpt  ivs t)s2tr(ronu4opxn fetad sDrau p;u)aetrmo tytlpteaivi;t0 exoir3nu1altnlicsls  2tm( pot0tlenioctls m ra(vp (0aeeoio tytlmtrlnvslt)t2uoxopno1alen nesltf 2rrx  ;o0ope  f3iasls2eaump;(4treoxfciodoa ean ol( trxo(mpoydlme mfctat) rtaxr nt0alen octls s ul( s;t4texnxf3tatlmDeli s t0trtoxmpnu1llt  nvt tfs2tmxr oo1apeomoeilsfsDrmuvp;u0aeenmociatop raneils0 exoxr3ny1opt  fvtls  rumx pno0tpt  feils m rln s u4trtnmo oy1op   u sl(0t2xr(o oo1alenmiciat) Dtr(rp;o0aptomieiydfa2umu p t0 eeomr3ty1fateliesl(0 2xm(opiudlmtemfcsat a2rmurpot1oexnmi3iat s rauvo t0 etnir iydfmte uesl()tetmxr3io1amenlfvias)aDrrxm ;o0aetn ieiat mDrmu o;t4 lxoir3oadopDrlivolt srtoxm io4lpt mieiasfsDrmuront4ape  o3tys m ua(vp;(0tlxrmfciatlaDe uvo;s0 rxriopny1op e ncsl(f rtm( pou0optnmietysla emu on(4aeenxocoytoa eanvslt trxrxm ny1lp  mfvta()sDur( pno4ale  i3iad s rmuvp;t4tltnxocty1oateluvol(0 rtrxm3oodlp  mfvslt sDtaxmo;o0ole mfciltfs rlu p;u0 eeomr3iodfaDr u s;t0 2xm(m nodlm   nci ( srra( pno1aleomfetlslmDranms u4 rtomfcoa1fpDeaivo s) etrir ny4opte net (f 2tm(ronu0oee mfetad s ranmo;t0trenif3iadoa e i o;(  2umiopnydopen fctas  2trurp;t0aexoiieiysla rm(mpnu0areoxrcootomt au ol( tetrxo3oy4olte nesl( srum( ont4tlxnmiciadlm2rau s;(0 rxrxrcta1oat livo s0srxrxr io4opeelnetat) 2truroou4tpenmociytfm ran s;t0trtrir to1lateln sls0t2tmirpoo4ll nlies ()aDtax pou4tetnif3iatls2uau p (0tltnmr3oytfpteanes;t tetmxo3no1ol  lnvi (  rurxrpnt1oexo fctasfa emnms;(0aetnmr oatfpt aiesls)srtoim nudam nmfet t)srtau pnu1olt mietatlaDum(mp;u4 rtrxf3iydomD  i i;s  2xoxopiudam   ivias srurum ou4aexnioetls a rlums;u0tltrxf oo1lp  lieols  etrxrpio4op   icslt aDtrxm ;u4oltnif3ildla2um(vsnt4 etoif oatlp r uvo;t  2xmim3oo4al nmfcs (fa2umxmoou4olxo i3iadfmDua(vsnu4arenmrcoa1opt anei () exriopiu1omt mfcsasfaDtrxr ;u1alxn oeilslaDran s u0treoio3oodoaDr uei;t texo(r iudllen nvsl() rumuro;u4opxnmf3iydlm2uln s (4teenmo iy1omDrlieo s0s2trim3nydlm n ivtat  2ua( pot4tpe mi3tadfm2um(vp;u4 rxnmrcoatfpDeai ol(0 eto(m no1altelfci s)aDtmx ooo1tlx io3ias s emuvp;u)tlxoxo3ia1lp   u s;t0t2trirpiudlmenmfci s  rtaxrpot1tetnmieiasfa2um( o;u4 ltnxr3oodfp  ai s t)tetmxm3ny1ll nmieslsfa2rm(root1oetnii3iysfa2ua(mp u)arxrif3tadoa r u i;t seurio3nydlltnmnet tfsrrr(mpnt0apx  ocildfa ea(vont4 exrir ty1oaDeaiesls) 2xoim3nydlltemivslt arrmumpno4apenii3iytfm elnvp;t4texoiocoatlpDe u i;t)sexrir3iu4opt mivils) Drmx pnt4texomi3tasfm2rln o;u4tleoxr3tytopt  ueils0trto(opiu1llenliviatf Dtaum nt4teeo oeildlsDulumo;(4 ltomo3iotfatranei;t0srurxo oo1lmtn fetl(  2ra(mpnt4olxomi3iydfsDrlump ()aeenir iodfp   nvo s t2xo(r oydlltn fesl(  rurx oot1aptn f3iytfa2eanmp u0texomo3oytoptrluvols)t2umxm ny1ol e icil()sDra( ont4tlx micils aDumu o;t0 rtomo3to1oaDraueo;s)tetm(o oydam emfvs t  2ra(rooo1tpen ieildlm2uan onu) renxrcio1op  liei ( setr(m ny1lpeemnesltfsDraxmono4aleo fetld sDrmu pnu4 leoxf3iotlm  ai o;s0 rxmio3iy1ap   fet (f Dum(r oo0oeto fctatlmDua(ms;t0 reoirciodlaDr nes t0t2xoxm nu4oltn ncs s sruaumooo0aetomfctyd sDum(vsnu4 etnmf3iytfm rau i t0seum(r nudamen ncsltf rur(ro;o0aetnio3iys a2ulnvs;u0arerxrcootopt  uei s)t2urir no4ol n fctltfarua(r ;t0alt  f3iatfa2emnmo;t0 rxrxo io1oat anvs s0 2xmimpoo1lpenmfeia( s2rmx  no1opt ifciadfa2rauvp u4 lxrir tydfm  lnvi;s teto(r3iudoleelneiasfsrumump;o0aetnmfctysfmDemu on(0trxrio iotla   ivo t0texoim3nydlmeemfeil()a2uau ooo1aptoiietls s2rmnmsnu0artoir oodoaDeaneol( srxoxm ny1ap n fesl(fsrururoou0optniieiatfs ulump;t0alenmfciadfaDr i o t  etrxo3no4lmt  fvias) Dur(moot0aexomi3tasfs ra( p t0arerxo totom r ueilt0 2uoxo3nu1om e ncias)aDrr(monu1olt  fcias s eanvonu0arxriocty1fmD  uei ( s2tr(r3nu4ame mfvsat)aDumumono4oet iieilsfa2ulnvpnt4aeenmocoatfa r nvs ()teum(o ou1lp  mnvtl(fa2tm(  ;t1apeo o3iydfmDemnmp;u) lerxrciodfmtraivo (0setmxopoodam  liet s)sDrrurpot4aexomietldlaDea(mo;(4trermrcto1la raivsl(  rurir nydam emfetlt  ruaxr ou0olx  feiaslsDul(vs;t0 renmr3oo1la   ivo;( srum(m iodapt mnvi s aDrrum ;t4teeomictytlm rlnms;t4 rxrif3oo1fmt lnvs;t texo(m3no1ll nlnei sfs2tmur oo4tlt mociltfa emnmo t0trxoioctydoaD  n o t)srxmio oodaleelnviltfarrr(rpot0alxn f3tlsls2el( snu0tlxrio tatlpteluvo s0 eumiopoy4amtnlnvilt)sDrau p;u1aleoifciyslm raump t) rxomr tadoaD  nei s)setmim3no1lltnlieta( srururonu1oeen o3iyt s2uanvo (0aexoif oatlp e nvs t0s2tm(rpiydoptnlfvi tfa2tmx  nt1aleomo3tls m rmn o t0 ltoio3tadlmD  ues;t0s2triopnydomtn fvtas) 2tmxrpou4oeeomoeild m ulums (4tltoiociytoa eanvo;t seto(opoudal e ieslt  Drr(r ot1oee mf3iadfm ea( p u0trxomr to1lptr ieo;t  rum(mpno4ap n nvi t a2rm( pnt1alenioctydfa2ul( s;() rxomo3todfm elu o;t0sruo(o oo4altn iet s  rraxm ;t4aeenifciltfmDelu s t0arxrmf iatoatelneils  2toim3oy1lpenlfesatf Durxrp;u0opx  ictld s2emu p;u4alxrmr3oy1fpDr uvo s)trtoxr3oo4op nmfcs t)aDtaxmont4oetnmietasfm2rl( pn()teeomrcoydoa r uvi;()t2umxr3ou4op  lneias sDtrumono4tpxnmociatfmDraumo;t0 etrxf tadlm  lu o s)s2trio3ny1lm  mietls  2ra(m oo1aleoifcildfs2rluvsnt)aeeoxr3ta1op r nvsls  ruo(opnu1alte nei ()aDrrxrp;t4tlx mo3ildlaDua( o;u)tlermocoytlmteau i ()sruo(rpnudole mneia(  Duaxmo;t1ape ifcildlmDem(vp t4texnmoctotlptr n o () exrio ou1al   ivt (  2urx ooo0optomfctytlsDeanvs;(4arxomo3tydoat  u i t  rxrxrpiudopte fvsat) rrr(mp;o1apxoiocildla2emnvp u)texoxr3iy1lpDeln ol() exoiopno1ll   nvsls srtrump;o4ale moctadla rln o t4 rerio3tydfmDe uvo;s  2umxrpoo4op  mfeil( a2um(rpoo1alt io3tytls umums;() lxnmo io1lmDrau sl(0setrxm iu1amte fctas)a2rm(rpnu4alx  i3iltla2rl( o;t) eeriocta1lm eaieslt0 etr(mpny4ome miei t) rtmxrpno4alxniieiad m eanvsnt) etoirciytla eli s;t0 2umxm iu4amenlncsltfa2uax  ot0oeto feiyt aDrmumo t4 rtrxr ta1lmtrlnei;s seuoxmpno4lmtemfesas)arrrx p;o4texo iciat m2rluvs u4aexnxr oytoateauvs s s2toxmpny4optelnesat s2tr(rono1ope mfeiyt m2rmnms t0tlenmfciadom rliei t0 rtm(o oy1am elicsatf 2tau o;t1apxo o3ilsfm ea(mo u0teeomo to1lpDr ivsls0setr(mpiu1lpen ici t)sruaxr ;u1aexoiietasls rl(vs;u0 lerxrciydomDrlieils0setrxmpno4ome  fcsas) 2uaxm nu0opx mfctas m eau p;(4aeermoctadlatrlies;t)setoxm nudom nmncsls)s2rrxro;o4teeniieiydlm2em(vs (0tetrmr iodfm  auvils  etoimpoudal  livilt  rumx onu1aeenioetasfaDemu p t4 renmocoodlmteluvolt0 etr(o iydlp nlnvslt)srrax o;u1oeen ietysls2ea( p;u4tlenxr iydlate nvi;t)trtrxrpnydlmtelnvslsf 2uau  nu0tpeoifeiyslm ea( snu) lxnmocta1la   neolt0teurim oydopenlneiat artmx p;u4tlxnmi3ildla emu o;t4trxomo3tytfmte nvi;t0 rum(mpio4aleemies (f Dra(m ;o0aexoif3tytlm2rmn o;u)alxnif3io1la  lu ol( srxr(rpio4ap nmnvsls) 2ua(mont1ope micilsfa2rmn o t4tlxnxf ia1laD aieol(0srtr(opoudllt mneslt)s2rax pno1oltoio3iat a2rmuvs u0 exnxo3ty1oaDelu i;()t2ur(rpny1op  lfcsas  2tr( p;u4apeomociaslmDra(mp;()altoxf iydla elivsl(0s2uoirpiy1am n netl()s2ra(mo;u4aetnii3iaslmDem(vp u0trerircoo1fa   u o t0seum(rpnydlmenmfvsl(  rrrum ;u4tltn f3ils a2rmu s;t4aeenmf3iodopDrauei;t0t2xr(mpiudaltnlnctasfaDrr(rp;u4apt  iciadlm2rlnmo;t0areriocoodfatelu i;t0 2toxr3ny4altelfvtas) 2um(m ot4tpe ioctldla um( o u4trxoio to1op  aivol(  rxmxr nu4aptnmncs t  2ur(mpoo4oleo fetydfs2uluvp (4 reoioctotlat  ues s)srtoir oo1olenlictlt) 2ra(rpnt4oeto fciyt m eanvo;t0tltrmf iy1fateluei;() etriopiy4omtnlici t srrrump;o0alt  fciasfmDuln s;(4 lenirctadfa ran o;()texrim io4apt lfci (fsDraxmp;o1tlt ifeild m rm(vs t)areoxfciodlp rln i s  2trim3ny1olenmiviat srua( oou1tlenmociydfm2eanmp;(4arxrio iydopteauvi ( srxrxr3io1lltnlnvilt  2um(mp;u4aexnif3iadls2ra(mpnu) rtnio iadlateaivsl()setrxr3ny1ll nlfetlt)a2um(r ou4oetnmictydfa2rmums;u4tetomf3oatlptelu slt0 rxrxo nodlmt lnetlsfaDrm( ooo0apx  iciadfm um( o;u4 ltrir oo1laDrln s;t)tetmim iudopt mietls) rra(r ;t4oeenmoetadfs2uauvonu4tleoio iodlptr nvo s) rurxmpnu4olt miei s  Dtrxrpnt1opxnioct
\ No newline at end of file
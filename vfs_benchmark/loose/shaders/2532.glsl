@@ -0,0 +1 @@
+i s;()s2to(rpnu1am e icia( sDraxr nt1opx moeiytfs ulnmonu)altniociydlpDraivs;()sexrxopoudllt micil()srumx ono0olx  fctadfs2el(vo;() rtoxfcoa1om rlnvo t) rtmio oy1op n ncsas) rtruro;u0tlx  oeiytfsDelu p t) etomo3tatfmDrli ils)srtmxo ou1lp  lncsl(  rurxmoot0tpe io3tld s rau sn()arxrxfciytfatrauvi (0srtmxo3nu4lltn ics sfa2urx ooo0tpxomo3tyt s2emnvs;()arermo3ia1op elies (0s2xmim ny1al nmiesl(faDrax onu4tltoiietlt s elnms u)trtoir3oydlmte n o;( s2uoxr oodlm  liet tf Dtru o;u4opxoiictys a2rmnvon(4alenxrcoodopD anvs;s)t2trxr3nydlle  ics ()sDrrxmont0tpeoiieiytlaDeluvp;t0 eeoioctodomt  iesls  rxrio oy4ap  lnesls  Dumxro;u1opxnmi3ildfa2umu p t) lxoxo todlpD ai s t0s2tmxo3oodolt mfet (fsrtax pnt1oet mo3ildls2emuvo;t)aetnirciytlmtranesls trtmxrpiy4ole miviatf 2urxm ;o0aptnif3iaslsDrlnmsnt0trxomo3tadlmDe uvsl(0setr(m3no4lmenlnvt ()s2tm(rpnu0oet ifeiadfsDemu p;u4artrirctydoatrlnvo;() 2trxm oo4amtelfei ()srrr(m ;o4aetniociasls eaump;t0tlenmrctatfpDeau o s0srxm(rpiy4al elnei s  2taxmont4apen o3tyt sDum( p t0alxoifciadfaD anvo s)trxr(r oy1ale  fvsa() rtrx p;u0tee mfeiytlm rlnmp t0artniocty1lat aivols t2xrxm oydalt mnci () Drm(m ;o0tlx  ociatfs ul( snu)tlenmr tatfpDelu olt t2to(m3ou1apenmfet t  Drrx pot4ope mfeiydlmDemn p;u) eerxf3oatfa ranvi;t  2tmxo3no1lmeelfetasf Dtmx  nt1olxomoeiad a el(msn()tetoio3tytfateliei s0 2ur(o oy4lmen iviltf Dtmxrpot0aexnmoetld mDuluvo (0tlxnxo3iotfateaivo;(  2umxr no4ol   fesls  2rmx ont0altn f3iysfa rln o;t4 lxoxf3todlmt luvslt0s2toxo oy1op  lnesl() rumxrp;o4opto ocias s2uln ont) rxomf3ia1lm  ln sl() euo(m3oodamtelnvsl(fsrur(mp;t1opeoii3tatfaDum(vsn(4alxnmrctotomtr ivi;()trur(opoydalt lictl(  2umum ;o0olx iociyt s emu o t4texnmr oytlm  anvi ()trum(opoodllee nes (f rtmx o;u0oeeomociysla raums (0 ltrxo3tadfpt livs t) eumxr nudam  mnvsa()s2tmump;u4oltoioctld a umnvont0 etrxf ia1fa  livs;t0s2xr(m no4aleemfvt s a2rax oot4apeomf3iydfm2umu o t) rtrxr3oodfm r nvsls setmiopny4oltnmfes ()arumumoou0apt moeiadlmDeau p;u0 eenxociadomD lnes s0trxoxopoydame mfeil(farrrxr ;o0altoiictytla2eauvsnu4altrxrciytla  aneilt) exoxm3iy1aleelies s)s2ra(mp;u4tpto oeiat aDeln s;u)tlenxf3iotlaD lnvo ( trxm(r oy4alt mies ()aDur(mpot0olen ociatfsDrmumsn(0trenxoctodomDr ues s0 etm(rpnydaptnlnvtas srur(mpnt1tptoiiciltla2rlnvs t)aetoxf oadomDraivs;()texmxr3io1oleemnvsa(f 2ta(monu4tpen feiadfm umn o u)altrmf3oy1faD lueslt  rxoxm3oodal  mfes tf Drrx o;u4tee mi3ildfs2elu p t)tlerio tydlmDe u o;t0s2tmxo oo1lleemnvs t)s2uaur oo4opt mf3tys sDrm(mo t4 rxoxr totlaDrli o;t trur(o io1olenlncsas)s2rax  ot4tpxoio3tad m rl( p t) lxrio3iydlat luvsls seurir3iudale  ivs s  2rmx o;t1opeo octatfm rm( s;() rtnxrctydoat li i;( t2tmxopny1omt lict s)srur(moot0oexnifetasfa elnvs t)arermr to1lmt aivols srto(o3iy4ape  ieia(faDrrumpou4aetn f3ias a2rm( s;t)trxrmr oadomtraiei;t0s2um(r iu1ll emnvtasf Dtm(  no0teenmo3iyslsDrln on() rtnio3iodfa  lu s;t0srtm(m no4ome lfvtlt) 2tr(mo;t1aleniocilt m2elnmpnu4alxnxf ootla  ln slt0 2ur(mpiudamte feiat) 2rrum oo4aeenmfciydfa2ulu p t0 etrirciydlmt ln s t t2toxo3iydlpte ncia() rtaurp;u0tee io3ild a2ea( snu)texoxf3tadlmDrluvs s)srtoio3ny1optnmietlt  rumxr ;t1aexomfcildla emuvp;(4aetoif3ta1faD  nvol(0trxmxmpoo4ale  ieta() Dta( oot0openifctadlaDra(ms u4tlxriocio1om   neo (0t2urxopno1ape  ivs sfa2umurono4teenmieildfm2rm(vo;t4 exrir ta1op rlieo s)tetoiopiy1lle mncta( arraurpot4aetnioeiltfm ulu onu4teerirciadfa e ieilt)seumir3iodlpt lici t aDtaxmont0tle  i3iydla elums;u) exomocto1oaDrlneo s t2umim3no4ole  ivtatfaDtmuroot4alxn ocild s rluvpnt)areoxr3tadlmtr ieslt0t2tmir3ny4alt lfci t)sDum(m nu4texnmo3iadla2uln p ()arxoxf3oytlaDeli s;t) rtr(o nudom elfvtl(f Dra(mono4tleomo3tasla rl(vo;u) rxnmr3tatlmDraiei;(  2trxm no1lmte ivilt  rrm( ooo4apxnmo3iad a2elnvo (0 lxoxrciydfp   uesls0setrxo iu4ol emnctat)arur(ro;o0teeoifetyd mDraums;(0 lxrmo3ty1om rluvo (  2um(o3oodaltn nvsl()s2uaxro;t4aetn fcilslm ulumo t) etnmfcty1oaDe ues () euoxo ny4amenlnvtas) rrax  nt1oex mietysfaDel(vs u4 leoirctytfm e ies;t  eur(r3ny4ll   fes tfaruaumo;u4tetnmf3iadfmDrmumo;u)tltrif oydlm rlnvs ( setrxo3iudlm elfvtls) 2tm(r nt4tlxoiicildlaDea( o u4trtnxfcia1latr nvo;() euo(r3nodome  nvia(fsDrmu oot1oeeoiicildlaDuanmonu) lerxo3iodlate ivi;t) exmio3oo1ap elicsat)arrmu ono0texo fcildla uaums;(4altrifcoodopt ln i;t trurir3oodam nlnet t sDta(rp;t4olxoii3tytfm ranvpnt0 rxnxrciydfpDraivi s0 rtoxrpoodamt lnesltf Dtm(ront1aex iicilsfm rln snu)trxrxfcty1lateaivilt) 2xmxopou4am n nct s srrrxrpnu4tpenio3iadfaDranmo u4tlxoifcootlmteaies t t2xmirpny1op e netatfs2rmur ou1tpxo i3ils m2rl(mo t4aexnmoctadomt liei s) rumxm3oudome mnvsls)arrmx poo0open feilsla2rauvo;t4artnmf3totoaDelu o;s0s2tm(opoudlptemfetlt aDur(moot0opxn oeiat aDrmn p (0arxrio tytlat  ivslt0 2umxopio1apenmnvia(  rrm(mooo4ole  iciadfm ea(mp u0trenxfctatlmtelivols setoiopiu4optn nciat  rumumono1tltnmociatlaDean o t4aleoirciytfpt  ueo;( teto(opiudlpe lfvia( a2tax  oo0tlxo fcildfs2emuvo (0altoif ia1lptr nes s)t2xr(r ou4lm  mfcilt sDraxmpot0tetnmictydfm2emn p u4tlenmoctadlmD ai s t)sexmxm io1ole  netl()a2umxm ou0teeomoeilt s raums;t0arxnirctytfm eaieo (0srumio3oodome  ncsa()sDua(m no0apx  icilslm eanvp u)alxrio iatfptrlnesl(0s2urxopiudll   fcs ( srurur ;t4tptnmoeiytlsDrl( p;(0tlxnxr oydoaD livs s0t2trxo iu4opeemnetl()s2rm(mp;u4apenioetlt s emnvpnt4alerxf3iydfp e uei s s2tmxrpnodlp n iet ()aDra(mp;t4tpenmfcild mDrm(msnt4 eerxocia1opte nvsl(  2urxrpnu1ameelfeia( srrr(m nt4oexomfciatls ea( p u)tlxnmocto1oaD auvslt0 rxmim oydlltn nvtl(f Drmxmp;u0ope  ociltfa ean o;(4 ltoxf oy1fa rln i;t0t2tr(rpiu1llenlfvtl(f 2taurp;u1teenmictad a rl( p;t0 lxnif oydlpDelies;t  eurxm3nu1altnmiciatf Dtrurpoo1apeo ieiadfmDrlnmont4 ltrxfcto1opt au o;t)sexmxo3io1om nmnes () Dumum ot4aptoii3iyd a rm(vs (4 lenmo3iydom   u i t0sexoxo3nodop nlictat)s2ta( ono1opeoiiciysfm ulums;t0 leoxf tatoptrau ilt0truo(r nydom nmieiat)srraumono0oltomfeils m ranvsnt4 etrmf3iydfp elieo s seuoxmpoodameelnvt ( a2uau  no1tpe micild sDrmuvo t4tlxomocio1opD  n o;s) exoio3iy1lmee netas) 2rmu pot4altoiictydlsDem( pn()aetomf oa1fp  li i ()setm(r3nu1lpee nesls aDrrur nu1tpxomicils a2uau pnu)areoxo todopteanvi t tetrim oudop elics (fsDumu  ;t0oetoiociydfs umu snu4 rtnifciytopte neil( texr(mpiodoltnlfes s  2ur(r nu4tlenii3tysla rluvont)aexnircootfat  ivo (0srur(o no4lpeemnct sfartaxmp;o0tleomfeilt s2eluvo u0 exrmf3todlpDr uvo;s trxrirpoudame lfesasfaruaxmooo4oexomoetadla2emuvs;u0 lermrcoodfmt  nvi;(0t2tmiopou4lp emietasfaDurx  nt0tetnifciasfs eauvsn(4 eermfcoodoa r nes s0 2trir3oydlm elivtls)a2urxmp;t4tltn octltla2rl(vonu4 etrio iatopteluvo () etoxr3ny1ale lfvsat)aDrrxmpot0tetomfeiydfa ul(mo;()teerxfcoodfp eauvi t  rxoxmpnudomt mivsa(  Dua( ooo4apxniociydfs umnmsn(0 etnmocoatla  auvs t0seuoimpnudalt mnvtas srtmuro;u4oexoio3iadfa2emuvs u0artomo3iodopt  uvsl(0s2toim iudomtemfetlt  ruru  ;o0aptomoetas s2em(mp;t0tlxnmo iadoatrlu i s0trtmxrpou4lle mfcsatfa2taxr ot0opxo fciasfm2ea( pn(0areomf tadlmtr n ilt) 2ur(r3oy4lm nlict t) 2tmxroot0apeoio3iadfa2rln onu0trtrxrcia1fatelnvslt0s2urxmpoydoltelfetl(fsrtm(mpot0oexniicias m2umn p u0 exomr3oatoateluvi;( trxr(mpoodol e fesatfsDumurp;o1alenio3tadfs2rlump t)aexomo tydlp r neo;(0 exoimpoy1omee nei t  2trxro;u0openmociasfm rm(vont)aetnxo ootlmDe ivo t) euoxr3oydopt  nei t)sDtmxrono1tlt mfciytlmDeau s (0 rxnmr3io1omt  ueo;s)t2xmxo io1openmnvs ()sDra(mo;t1ole ii3iltfm2umu p (0 renif3ta1laD auei t) 2uoim3oydap  mfvsls)sDrmuroou0texniieiydfa um(mo;u4texnxr iatla r neo;t  exo(rpoodamt licil(faDurx  nt4alto fcilt s2um(mp;t)aetnmr3oytoa e ies;t trtrim nu4openmnci tf 2urxm ;t4alx  f3tltfs2ua(vo;t)altrif to1lm  anvils)setm(r3iy1openmivtatf Drm(r ot4oleoiieiyd m2ran o ()tleoxr ta1lp   u ils  rtmxrpiodlp  mivils)sDur(mp;u4tleoif3tatfs2emu pn(4tlenmf oydlaD  neols0s2tm(m3oudllenmncias s2uaump;o1ope ioctld aDul(vp;u4aexrxo iydlm  auvi;t teuoxm oo4lmtemnct t arraxrpno1oeeomo3iytla elu p;t)texnmrciydfateauvs;()sexr(m iydlp nlnvils a2rruro;t4olxn o3tadls ranvs;()texrxoctatlate neo;s srto(m iudal eliesa( srurx pot4texnif3iasla el(mpn() eerxo3iatlpDrai o t)texm(r3ou1ol nlncsa() rtaur nu1aeto ocild aDuan s;(4aeermr ta1laD aues s) etmio3iodll  lfvs s srtaxr no1tlto fetls m2umu o;t) eenmo oydlp e u i;s t2xrio3no4omte netltfs2tru pou1apxoio3iys a eluvpnt4aeeoir tadlp r i o;s)seto(opou1ap elnvt s aDta(rp;o1tltomfeiatfmDel(ms;t0tetnif3oytop ean slt  rxo(m3nu1olt mfetas)s2rmu  ;u1tptn i3iadfm2ean s;(0teerxf iy1opDeaueo s)teuoxopno4ame mnvsltfs2tm(rpnu1aexoioeildfmDemumo;u) etrxo3totfm r nvil(0texmiopoo1ameemncsa(fsrrmuro;o0olxomoetas s eln o;u0altnmf3oy1fa  aivi;(0setr(r3iy4lmtn fvsat) 2umx oou4tpx  o3iltlsDuluvp (4 rxnxf tadom ranvs s0srtriopou4lle mnvi t)srtm(mp;t0aet iictatlaDra(mo u4 rtrxfcty1faDelneil(  2xmio ny1oleelnetls  rrau  ot4aeen oeiasfaDem( p t)aleoio3ia1lp e u slt0texmxo nu4ol nlfct sfs2uau pou4apxomo3tadlsDuan o u0trtnxr tadfmD  neilt)s2trxmpoudlltn iet ()aDtm( oot1apxnmi3tld a um( pnu)artnxr oydfp eai s (0t2ur(o nodlpeelnci s a2uau ono0tleomocildlsDrau p;(0trxnifcto1la  luvs s)srxr(m3iu4ap elivtatf 2uauro;t4apxnio3iaslm2ul( p ()aexomr iotlpDeaieol(0 etoxm no1lmtelnvsl(  2um( onu1tee iieiadfaDemnmsnu0 ltoxf3oy1fa r ueils) exrirpoodop n net t a2rrxrono0tltoif3iadfsDumn pnu)aeenxr iatfaDr uvs;() exo(o3io1lltn ies ()a2ua(ro;o4tet if3iaslsDrmuvs (0tltnircoa1lpDr ueo;(  etmiopno1lmt mics tfsDrmxm ;o4tpeomi3tasls umnmp;u) lxnmo oadfaDrli olt0 2xm(m iodlm  lfeilt aDrr( ont0tpt mfctasfs2uluvp u0 leoio to1fptrln i;t) 2xo(m iydomeemnet sf rrr(m ;o4aex  iciytlaDrmuvp;u)teenir iodfm rlnvo t t2tmxm3oudop elfet sf Dra(mooo1tlx ii3iasla2elu p u0aetomf iodfat  ieolt tetrir3ou1lmt livil()sDuax o;u4tpt ifeiltfa emnmpnu4teermf ia1optrau il()trur(r3nudopt  ivs tfa2ua(mpou0aeeoioctldla ulu s t4tlxrmr tytlp rlnvo (0t2tm(rpnu1ame lnesl()a2rmurpot4tee mfctltlm2emu p u0altrxf3iy1fm  au i t)srxoio3nydomenmfci t)arrmxr oo4ope  i3tld s rlu p;t)trtrxr3ty1om rai olt)teuoxo3ny4llt lict t s2tr(m ;o0tlt  f3iys aDrluvs t0trxoxr ia1fm e nvo;( texrxm3ou1lmtnlfesls)s2tr(mono1optomfeilsfa2rl(vpn() lxrmfcio1op e neo ( t2xo(mpoydalt lnetatf Drauronu4oee  o3iydlaDuanmpn(4texoxo oytfmt auvi s0texoxo3ou4op nlici t)arur( pnt4olx ifciytfmDemn s;t0 lxnxrcty1fmtranvs t) exm(o3io4omeeliesls srrm(ro;o1tpt  feiysls umuvo u) rxnxr3iodfmDr nes (0 rtmimpoydlm   ivt s)aDtm(ronu0apto icild aDul( s u4teenxf3iydlat lnes ( s2uoir iu4lmenlicslt a2urxm no4ope ifeilslmDem( p (0treoir3oytfmD  u ils)t2xr(o no4ale lici t  Dumum no1tetnmfeils a2uaumo;()altrmo oodfat  nvo;t s2xrir3oo4am   fesltfa2rrx  nt4oex  fctlsla eluvs u)arxoir tydlaDr n olt setrimpou1aptelncil(  Duau  ;t0opeomfeiltfs2um(mpnt)trtnmo tydfp  auei t)trtoio3ny4op n fetls aDtau o;u1apenmf3tyt m um( p;u0alxomociydlptelies t  euo(opnu4al e ietl(faDtm(mooo4aexoii3tysfm el( pnu4aetomo ootfmt  iei;s0srum(m3oo4ol nlivslt)srtmump;o0oeeniictlsla rmnmo;u4aetrxr3ia1faDeaivo (0teuriopnu1op elivtas sDur(  ot4oexoiieiysfm2rl(mpn()aetrif iodfmD lieil()s2xrirpoydom  livias)sruaxmpnt1aee miciydfm2emu o u)arenir oa1fatr neslt)s2toxo oo1apenlfctat)a2rmu  ;t0apt  ieiysfa2rmuvont0 etomfciadlmteliei s t2toxopnu4opt  ict t s2uaum ;t4apxnmoeildlmDra(mp;t4alenir3tytoaD aieo;t  2xoxm3iodlp elfvsls)srtmum ;t4ope iictadlm2em(vpnt4tleoxf3totfptrlnvo s) eumxr ou4lmtnmfviat sDta(m ot1oleo i3ilt a2rauvp;u0texnmo3ootlmD lu i s0 eto(r3nu4ll  mneilsfartru p;t0oet ioeildlm el( s;u0 exnir iotop e iei;s trtr(rpio4olen nvta(f rua(monu4apen octlsfaDuanmonu0 exnif3oa1lpDrln s;t0t2tm(o iu1amtemncia()sDuau oou4tet mo3ildlaDrauvpnu0trxoxrcia1fmtrauvi s0trxmiopno1omenlnct ()srta(root4tlen fciytla2ea( pnu4trtnxo ty1op e uvi;t teumimpiu4amee nvsls)sDtm(ro;o1aexn o3iyd sDemumpn(0aetoiociytlatrau s;s seum(opoo4lp emnciltfarrr(mp;t4oetomociad aDum( p t4alxnmo tydlmteaiesls0texr(o3no1openlfcs ()srrm(r ot1tpx moeiyt m2eauvp;(0alermr tadfpt  ivils)sexmim3oo1lptelnvt (f Draxmp;u1oexn ieiydfsDeluvo u0alxnmocoytfmDeln i ( trtmxrpnu4amtnlfetas a2rr(  ;t4tpeo i3iydfa rmnvp;t) ltrmr3totop r nvo;(0seuo(r3io4lm n nvs t)arta(r nt0olx  o3iad m2ul(mpn()trxnxf to1laDean ils) exrxo3iy1lm  lnes tfaDurxm ;o0apto oeiys mDra(ms () ltomr3iydlpteaneolt)sexr(m3oo1ol n nvt t s2tmxm ot4apenmfciltfm2uln ont4 leomociotomD  nvi;(0seurxo oodlpt  fvtl( sDrm(ro;o1oetn fciat s2umnvo t0 exoxr3to1opD  iei;()trum(o iy1olte fcil(  rumx  ;t4aex  i3tydla2eln o t0tetomocoydopDr n ilt)t2xoxo ny4omeemiet s)sruaxm no1oet  i3iaslmDulu p;t)tlxoif3io1fp ean s;t  etmio3oodalt  ivt s)artmum ou4oexomietlsfmDea(vo u0alxomrcoadlaDraueo t0trxmir3ou4amee fetat arurxm ou4texo ocildfs uanvp;(0trtnxr3oatlpDelnvolt0trurio3iudalt mivi s)a2urumooo4apen ieildla2uauvs (0aetoxf3oy1fpDrauvs;s)sexoxr3iydlmtnlnesa(fartr(r ;u4opeomi3iydla2umn p;u0tltrxf3tatfateaivi ( s2um(rpnudalt lfvtasf Drrxro;t0oltn fciysla2elu sn()tltnxfcootfaD aueols texrirpny4apeemiesas  Dua(rp;o1opx  octldfsDulnmp;t0 eerif3ia1oaDe ieilt srxm(m3iu4ome lnct s srtmxro;o0oetniociatlaDrm( p;u4aetoif3iotlatelivslt0truoxo3oy1ap   fctls  2tru pou1aetnmfetydfs emnvo;u0 lxnif ootomDeli il(0srurim nu1olte fei (  Duaxront1tet iictld a2em(mpnt0alxnmo3oadopD  uvo t0t2xoiopiu4apeemfvs s  2rmum ;u4opt mfeiys s ra(vs;(0 eenir oytlm eaiesls) eurxm nodll  livtl( aDra(rp;o1tptn f3iytls um(vs;t4 rtoxfciatlm r i i s  ruoxm3oy1lm   neta()srrm( ooo4apxomocias s2el(vp;t4 exnxrctadlmDe nei t)tetoxo3ou4lmtemicil()srtmu  ot0tlen octld a eanvp (4aeeomf3todfmD lueo ()s2tmir oo1aptemfetlt  2ur(mp;u1opxoioeiyslm um(mo;(4teenmo iodoaD luvsls s2xr(o oy4opeelfeiltfsDum(r ;t0aexnmf3tysfa2rl(mpnt4arerif3iydfm eanvils)setoxm3oy1ol nmfctas  rrmumoou4oetoii3tadlm ul( ont) rxomo to1fa  li ols0 eumir iy4lpt mfetasfarrmum ot0tet if3iatlm2emnvon(4 eeoifcta1oaD lneo;( texrxo nu1lptemnvta()sDrm(roou0tlen fctasfm rlnvp t0tltrmociodomDeaivilt0 rtoio oo4ape  nvtls)sDtm( oou4apeomoetasla2uau o;t0trxnmrctatlp e uvil(0texrimpnydlptnmnvsl()s2ta(  no0aexomfciatlm2rl( p;t4treoir oy1fpDrln slt0tetm(r iu4omeemfetl()a2tm(  nt4aex if3ild aDum( p;u)artoircoytlaD  ueolt)srtoio3ny1ope lnes ( sDumxrpno0opxniieiyt a2ra(mo u0artnxr iotoa e u i (0srxoxo iu1llenliviat  Drmxrpou1ope mfetlslaDemnvp;()trxnir oadlaDelu ol()t2xm(o nodam n ncsl()srra(  ot0tpenif3tls mDua(vs (0 rxrif oa1fp elnvil( trumxr3no4am   fcsl( aDurum ;u4aetoio3iyd mDel( pnu)alxnxo3ia1fat aivs;t0s2uoio3nydlpt mfesas a2trx poo4altnmi3iyt sDran o u)trxnmr oatfptr u o s0 rxm(mpoo4lpee feslt)srtaurpoo1olen octas m ean onu) lxrxo tytopDeaiei;t trtoim3no1omenlfct () ruru ono0apt  iciat a2rmumpnu0trtoxo3oydfa r i ols)setr(m3ou1omtn iesls)srrmxmpnt4oeen ieilsfsDuan s;u0altrxr3totomDr nvs ()t2toim iydll e fci s)aDrau  ;u0tptoio3iatlsDumnvs;t)arxoxf oytfateaneo;t teum(o3oydaltemieias) rtmu o;o0oleoioctatfaDem( s t)arxrmo tatlpteaivi;s)s2trxo3nudal e fcta(fs2tmu o;u4aee if3iadfa2el( p t4 eenxrcoatfpDraieo (  rtm(mpoo4ole  neia(fsDrmxmpno4opxnif3ild mDel( p;u4trtriocoa1lm eli i t0trtm(opiu1lmt mivi (fsDurum ;u0texoifetls m2uanvp (0alxnxf3oo1faD aivi;t0s2ur(mpiu1ale  fci (fa2tmxr ;o1olx  o3iltla2rl( s t4trxriocoatomtelueo t s2xmio no4lp  miesasfa2tr(mo;u1alt if3iat mDrl( o;t0 renxr3tytla  lu i;s) exr(o3nu1lp  liet (fsDtaxr nu0ope  ieils sDemnvs u0 leoxfctydoaDelnvs s0trxo(o3io4apt mivi s) Draxmont1tlx mfcilt s2eau ont) rxnif totla rluvilt setrxr3nu4opt liesatfaruru pot0tltoii3tydlaDumnvsnu) eenxo3io1fpt an i ( tetr(o3ny4ape lictatfsrrru  ou0aptn i3ilsfa em(vs;u4aetnxocty1oaD  ueolt) eur(m3io1lpeemfetlt aDumum nt4tlto ieiytfa2rmu p t) rerifcoodopDe ivsls) 2xm(o oydoltnmieiltf rtr(mp;t4tleoio3iltfa2rl( o;u4 leomrctatfat livil( trxmxopnodop  mfeils s2ta(ront1oex ii3iasfa eauvont4tlxrxo3oadla rlu o;t0 rumio3oodalenmfeiatfsDrru o;u0teenii3iyd mDem(vonu4trxoxf iy1lpte ues s)tetrim3oo1oleemfvsls)s2raurpnt1ole ioeiadfa2rm( p;() eerxr ty1oate ies ()setmxmpio1opeemiei ( s2tmx pno0apeoii3iatlaDemuvp;u4arxniocoatlp eauei;s teumiopio4olt lfcsasfa2taump;t0oexoioeiydlmDum( sn(4aeerxr ia1fptrliei s  etrim3iodlm e ivil(  Dtru pnu0alxomieiadfm ulums;()tlxomr3oy1opDraueo t0 rumir iy4ol  mfet sfsruax  oo4tptoif3iad a ra(vp;()trtoxocio1om raivo;( trxrimpiodomte ivslt)s2rrum oo0apx iieiatfaDuluvsnu)tlxoxo3oatom ranei;t0trurio3io1optn nes () 2tr(r oo1altnii3iyslaDrm(vsnt0 rtnif oydfmtraiesl()trurimpiudlmeemici s s2ta(m ;o0ale iiciasfs umuvp t4tleomocoytlpDr i i ( seuo(o ou4lp  mfesas sDtmumonu1olt iieiytfs2rlu o;()altrio3tadlaDrau s (0t2uoxmpiu1lmtn fvia(  rtaxmp;u0tlen i3iat m rm( p;u)tltrio3oatfm rln ilt) 2um(r3oudlpe  ivi t) rua(mp;u4apx mo3tltfmDemnmsnu4 lxrio3oo1la rauei;t0srxmxo io1amt mnci ( aDra(rpot4oetomi3iyd m2emnmo;u4trxrmr to1fa  aieo;()truo(m3nudopenmneias s2taxmonu1tetomi3tadls2ran p ()arermociodopt  nes;t0 etrxr nodameelfvtlt) 2ua(m ;t0apx mi3tytfm2rlnms;u0 eenmoctotfmte ivi;()t2um(m3iu1am  mfvilsfartrxr ;o1open ieiysfaDelnms;u)tetnir oatlaDeaies;t0 eumxopiydlp  lictlt)sDrr(r ;t0aet  oeiytla2ranvp;t4alxrxfcoy1oat ln s t t2uoimpiy1am emfvsa(f 2ra(mooo0aexn oeias mDul( snt4aexrmr todfm ranei t0texmxr ou1lme mneta(fsDraum ot4oeto fetydfa eluvp;u0 etomo iodfpD livo s0 rtoirpou1lmt mnesatf rumxrpou0ape mocils mDemnvs;t4tleoio oa1opD lnvi;s0 rxmxr3iudam  lnvia( s2ururono0apxoioeiytfaDrmumo;t4 lxriociotopt lueo s0 exmxrpoo4ole  fcslsfarururont4ale mfeiatls2uanvp;t4tetrifciotlat luvo;s0sexrxmpnydom e neslt srrmum ;u4altoif3ils s2emnvpnu)teenmo oadomtr nvs;t0trumimpnu1lp n netas artrxrpoo0ale  oeiasfmDeanvo;t0texrxrcoy1omte uvi;s0t2toim3nu1aleelnvtat)aDtaum oo0aexo i3iys s2umumpn(0arxnxr ta1fpD lneols trur(mpiu4amtnlneiat) rra(mooo0opxnmoctydfa uanvs ()trerxrcoo1fptrln i t  rtm(o3nydamee ivi t) 2rrxmoot4aeeomf3tysfa uan p;(0aetnmo3iadfpt luvi s0s2umiopnu1ome mieil() Drmxmpou1tptomieiyt sDea(vonu4teerxr3tadop   uvi t)setm(mpnu4om n nct (fs2trx oou1alenmfcilslaDranmpnu4trtrir3tytlp  liei;( sexoirpiu4ol e nctltfsrraurpot1tleo oeiytfa2rm( sn()arermr3oy1oaDrlnei () 2trxrpiodlmen fci s arrrxmo;t1apx iiciyd a2el(mp;t)aleoio3iodopte nvo;( s2tmio oodll emieia()sDtau oot0ole ifetlsfs ulu on(4alermo3todom eauvi t)srtmxo3oy4omtnlnei t arur( pou1oex mieiyslm elu pnu) renio tytlmD luvo;t) rtriopoo4om nlnvsls sruaxm nu4tpeomfeils s ulumpnu4treoio oy1lm   ivilt t2xmxrpiodoptemncilsf Dta(mooo1aeeoifeiytfa rm( p;u)artomo to1lmD ln olt0texmxm ou1am n ncs s s2rmxmonu4tex mo3iydfs rl( p;t)tlenxr ia1lpteaies;s0setmxm3iodlmtemncs tfa2urumoot1oee mfeiytfsDranvs t4tlermr3to1om  lu il(0texoxm iydomee ici (  Dtmxro;o4alt  ictytls rmnvo t)tlxoxfciydoa r u s;( seurxm3oydolen ics t) 2rr(m ou0tltomfctydla rmnmon(0trxnif iydla rluvolt)s2ur(opnydal  mneia(f ruau o;u1tpeo f3iadlm ra(vs u4 eerio iodlm  ai sls srxrimpno1lp  lfct t)sDrr(mp;o4teeomiciaslm rau o;(0trxomo3totlp e nvo ()texrimpio1ol emfviltfsDtru ono1tlenmfciysfs2uluvpnt4 leoircoo1opte uei;s0srxo(o3nydol nlneias sDrrxmo;t4tet mf3tydfa eauvo;u0 exomfciodfmtelu sl()trtr(opio1lleemieil(  Drmxr ;t1opxn fetydfm elu s;t0aeenmo ta1op ranes s)s2xmxmpnodolt mici sfs2rrx p;t0apt mfeiltfaDulnvs u4tetomf iadopDeai o;s trtr(o3oydol n fet ()s2rauro;o1oleo feiltfsDua(vsnt0tltoxf3iotopteanvs;t0s2xoim nodol n nctasfa2ur(ront1tlenmf3ilsla em(vs;u)arerifciydlmtelneslt0trxrim iy1ape lfesatfs2urumpnt1oet iiciyt a2rau p;(4tlermf3iadlm r u o s0s2xo(rpou4omtnlietls)srtrumonu4aeto oetyd a em(vs u0 rxoxoctodoat  ueolt s2uoxr ou4ll  mfcils) 2raxro;o1tlt io3ias m umu s;u0 rtnxo oodfmtrau il()s2ur(rpny4amtnmivsls) rum(mp;t0tlt iictyd sDemuvs;u4tltrmocoatopDeai ilt  exoim iu1ame  nvtls)sDtrurpnu4tlxo oeils a rm( o u4 lxoir3oadop ranvilt)teuo(mpiodllte nvtasf 2ururooo4aptomoetyd m rm(vs;t4 lermfciatomt  u sl() rtrxrpiudomeemici s) Draxmp;o4texo o3tatlsDem(vp (0alxrmr io1la   ues;(0 2to(mpio4alenlieia( s2rrxm no4oexnmf3tlsfmDrlnmo;u4tleoioctytlpteanvils) 2trxmpio1al  lfvsl( aDrr(roou1olt iieiysfa ul(mpn(4 rxniocia1fa   nei t  rxoxr iu4amte ict tf rtmum ;u4tpxoiictasfm uaums u4 rxnxo3ia1fpD  neolt  etr(r3oy4amee ics tfaDumuro;t1opx if3ilt m2elumpn(4 rtomf3oatfpDelnvo () rtrio oy1opte ivia(  rtru p;o0tpxn ociadls2umnmsn()tlxrir iodfp   nvols0teumxr3ou4ome  nvi tfaDurx  ;o0tpenmfeiys mDua( p;(0 exoio3tydfate nei;s0 2umir ny4lp   ivsltfs2taxm ;t0texoio3iltlsDuaump t0texoxf3totfpDeaieilt)texmxo3iydomen nvs tfarrrx ono1tee iociatfm ranmon()tetnifcoy1laD lu i;s)trxmxo iy4lltelies (f 2urum nt0apeniictysfa2rlnms u4alxriociytfa r nei;t) rumxr3iydlmt micil()sDum(mo;u0tpeomoctls a2ranvo t4altomr iytfp   ivils0t2um(mpoodale  feiatfs2rax  oo0aeeoiocild s ua(mpnu)tltrmocoo1oa   i s;()t2triopoodlleemivtlt)sDuax ont0aptniieiyt a2ea(mp t0aetnxfctydfmt liei t srtoxr3iodllt lfeiasfa2taxro;o0ole  iciasfsDea(mo;(0 leoif oo1lmDeaueo;(  2trxr3nydoptnlnvt sf 2tr(m ot1aex ifciadfa rm( pnu)tetomfcto1opt aies () 2um(mpnu1am nlfci t)srtaump;o0tpxnmi3iatla umn o t) exomocta1fptraiei s) exrxo oudom n fesl(fartaump;t1apxo fciyslsDuau p;()tlxrxoctodlpDe uvi t seuoir3iu4apenlfet sf Dtr( oou1apeo fciyd m emumsnt0altniociydfateaivs;t0srxm(opno1apt lfcils  2ra(rpot0tex ioctyt m ulnmp (4 leoxr3iatopteauei () 2ur(o3iu4apenlneil()sDtaum oo0tlx  oeias mDelu o;t0aeeoirctydop r ueo t)seumio ou1ol nliesas sDuau  ou4aexo o3ils sDran pn()tltnxr3iodopt  i o (0 2xoxr no4op elfeils aDrm(m nu4apx ioeiltls rln s;(4tetnmo3ty1omD lu ols)s2to(m3oo4oltn nvsls  Dra(rp;o1apx iiciadlsDuan p u) etrirctadfa ean ils trxrim iydlmt mfcsat aDumxmono4tpeo ociydlm2umn p t0arenxr tatopD anes ( trxoim nudamtemiesasf Duaxm ;u0oltomfeiytfs eanms t) ltrio3oytfa  au o;(0trum(rpoy1apeelnci t aruax pnu1tltnmieilsla eauvo;(4arenmf3tadlpD  nei;()trxr(o3oo1ol elivi s)aDtmu  oo0aee moeiys s uln pn()areomo iydfpD an o ()setmir ou4lpeelivi (fsDrrump;u4oetnifeilslm2eln s (0trenmr3ta1faD luvs;( t2uoxr3oo4al e fvtl( a2rm(r ou4aexoiocilsfsDrau o u)teeoxr3iatomt aieilt0 2uo(mpoo1lltelnvtlsfsDtr(mpnu0tex mociatls um(mp u0texnxr3iodfmtr uvil(0s2tmio no4openmfeta(fsDrmuront1oeen feilslm emuvo;u4texnir3io1oa e iei (0 rurxmpny1ll n fctlt a2trumo;t1opt  i3iyslmDemu s;u)alenio oodlatr iei;t0trur(o iy4lltelici tfa2tmxront4apto iciydfs2el(vp;t)alermf3iadlpD  u o ()sexmimpoo1llenmnet sf Drmumpou4apxomfeiydla eluvo t0 etrir3oatfa rlnvol(0t2umio iodlptnmictl()a2rmxroou4tlt iieiysls ul(vpnu4 lenmr ia1fa eluvs;t  rtm(r3nudlmenlnvi s aDtm(moou0teeo i3tltfs rluvp;t0 renmr oytoat lnvo;()t2um(opnu1alee ivsls sDrrxrpno4tlenio3iaslsDumn o;(4aeenmfcia1omD  uvol()tetm(m io4aptnlics ( aDrax p;t4oeenii3iydfm umnvp u)artoxrctodoatr uvs;s0s2tr(mpnu4ome livi s) rrmur oo1opxomo3iadfm ranvo;t4 etnif3oy1lpD ai o;t)t2umiopoudop elncsas  rum(r oo1apxoifctydfm elu o;u0 etomr todfmteln i;s t2toirpny1olt mfvta(fs2ur(mont4oltnmfctydfm um( onu4tlxrio3ta1lmteln sls  eum(rpiu1lmte iesa()aDrax  ot1oetomi3ilsfm2eaump;(0arxrmo iotlaD lies;( teurxr3ou1lmeemnci ()s2tr(mpnu4apxn o3ils m rlnmsnu4 exnio ia1fatraivs;s)srxm(mpiydal elncta(f 2tmumpoo1altn f3tlt sDrmumsnu4altnxo3to1fa  au sls teurimpoydamtnmnesasfs2tm(m oo1oeeomictlt aDum( sn(4tltnxf3ia1lpteln i t trur(m oudale lics ( aDtau pou4aee  fciydls2ea( o;u4 reoxr3oo1fptran slt0s2trim3oudlmt lfes tfs2umump;o0oeeo fcildfsDelnvpnt0 lxrmfciy1lmD lneslt0srtmxmpoo1lltnlivi sf 2umxmonu0tptomfetldfs umuvo t) reoifctodom eln i s0s2umiopoo4omenmfvtls)arumu p;t0apx  i3tasls raumo;u0 lerxrcoatlm rlnvols)t2xrir3oy1lm   fcsasfs2um(  ;t0tptomfciysls2ra(msnt4 ltoxr3ta1lmteluei s)teurxm iydopte nes (farrmx  ;t1tetnifcias m el(mp u0areoxrcia1lp rlivilt) exmxm3no4al emfcsltf Draumonu4oltnmo3ildfs2rau p t) exrmr iy1la  ln ils)t2tmxr io1lleemnctatfaDraum nu4texo o3ildlsDem(vs;(4altrmf oydlaD livolt0t2xrio nodop   ncsls srrrumpno0aleoiieiyd s2rlnmo;u0trxomfcto1oaDelivols  rur(o3iy4lle  ict (f Drrxmono0tetnifetadlm2eauvs;(0artoifctytfmD  n s (0 2xr(r3no1amt  ivi s)s2raxrp;u4ope io3iydla2ea(mo;(0trenmrctydfa e i s;t)srtmxo iudal  lfciatfarrmu ont1optn fctatfaDumn s;(4 ltoxfcootlp eau ils t2tmiopoudlleemivsl()a2urum ot0teeoifctls s2ulnmpnt0tleoxoctodfm elueo (0srxm(o iy1lm nlies sf Dur( p;u4optoiietls m2rm(vo u0 exnxo iatomt au i t0t2umirpny4ll  mfes t  Dtmx pnt0texomfctlsfm2ulnvpn(0 rxoxf iadlmtr neo;t)t2xoxo3nydap nmnvt t aDra(r ot4aex ifeiysfs uanmo u) leoif3oydoptean slt0srtrxr iodameelivtlsfa2tmx ono0tpxnio3tydlsDemn o;u0 rtoxo3oadopD  nvols  2xrxmpou4openlfeil(fs2ur(rpoo0tpenifeiyd aDrmu snt4alxrxf3oydla eln o;s0trtmxm oydalte ivt t  rta(rp;t1tet iictyslaDrm(ms;u)trxoir3ootfm raieo;t s2xoiopio1lpen fvtlt sDrm(r ;t4texn iciad m2uauvp t)artoxf ty1fpD luvi;t0 rumimpoo1oltelfcsasfs2uaxmonu1oetniociltls el( onu4teeoxo3tydop elneils srxo(opny1omtn ies tf Dra(moou1tptoiocilsfm ranmpnu0aetoif3oydomteli s t) rtrxm iu1ameemnvtlt  2tax ont0texn ictls mDrauvo;u0tlxnmrciodfmDeaieo ()setr(o oy4am emicslsfarumxrooo4altomieiasfm2rlump;u0aetnxr3io1om  liei;(0setrir ou1lp n nviltf 2trx oot4tee  ociysfaDua(ms;t4tlxrxfctytlmDeau o;s)srum(opnu4op  mfesltfa2taxrpnt1olx mi3tadfsDeaumont0texnmrctatla eaiei;s) 2toim3ny4lptnlfvslt)aDtrurpou0apxomfetltfsDemumo;u4 rermo3tydlmteai o;() exrimpnu1amenlncs s) 2trum no1opx mfeiyt sDem(ms;t0 etrio totlp  aues ( seum(m3iydal nmfvtltf 2rau  no4tlxnii3iad m eanmo;(0alerio tatfp raneo;()t2uoxmpio4omt livi s)srrr(mp;u1tle  ictyslm2rl(msnu4 eeomrciy1la rlues;() rxo(o oo1ap nmfvtlt)sDurumpoo4ope ioctytfmDrm( o;u4arxrxr oy1fm  lnes;s tetmxo ny1lmtnmfcs s aDtrum ou4apxnifetyslm rau pn()arxniocoytlaDraivslt)t2uo(r oydaltnmnctas a2rru  ou1aexomfetysfm2raums t4artnif oatfmD lieols0s2uoiopio1opeelivs sfs2raumono0oltn ieiatls2umu p t4 lxoif iytlmDelnes;(0 etrxo io4amtnlneil(fsrtr(monu4tex  feilsfa ea(mo (4teenif3iytfatelivs;(  rtoim iydaptnmiei t)aruru o;u4teenifetasla2umn o u4 eenmrcoadoa e ieol( s2tr(opno4ap emnctl(  Drmxmpno0opx  icild m emn snt0altrxo3tadlmD  uei ()sexrir nu1lmt mfvsltfsDrrxm nt1apen fctydfs uln p u0alxoxo iytoa eanei;t0 2umxm3nu1ameemietat a2uaxr nt1tle  iciltla elnvs;t4 eermrcoy1op  lies s0trtoxopiu1ame mfeils)aDtrx ooo1oltnio3iydfm2umu s;t4alenif iadlm e n o s texo(r iydom elictat  2raur ;o4opt iieiysfaDea(vpnu)aeenxo oadoptelnei (0s2tr(m3oo1ol nlict t)s2raxroot1aetomfctatls umnvs u)aetrio3oatfmtrauvols srxr(r3oudlm  lictlt)a2rr(moot4apxniictyd a2eauvpnt)arenmo3iotfaD lneo;t setmxopou1lp  mfci t) 2tr(mpoo4tee mfetas sDrauvs ()altoxf3oydlmDe i ils)t2to(o3iudop elivia( srurxmonu1tle  fciadfaDuluvo t4aexrmf tatfmDe ivi (0s2xrim oodop   nvt s sDra(moou4tpe ifetysfmDulu ont4altnif3iadomtelivol( setrxr3oodale lncilsfs2ua(r nt1apxo ieiyd s eln s (4 eenxr3iadlaDe neils s2xoxmpno4ope mfvt ( srrrurpno0apxnmf3tydlm2ulnvp u)trtrmrcia1fmtran i;s0s2tmxo nydlme mietl( a2taxmonu0alxn fcild m rmn snt4 exrifcoy1om   neo;t0setmir oo1alte ictltfs2urxro;o4olx ifeiad mDumu p;u)tltrio3totlp eaieo s)t2urimpiu4ap emnesl(fa2ta(mpnt4oeen o3iltlaDum(vont)arermrcoodfm  ai o s) rxrim3iu4optnliei s artrxm ;u0olxoif3tysfsDem(vo;()aetnmoctydfptelnvo;(  2uoio oo4altelnctas) rumxroou1apx ii3tytlm2ean pnu0tlxnifciy1laDeaueol( srtm(rpio4alt livsl(  rraxrooo0olx mi3ils a2rauvs;u)aetrircio1fmtr uei;t0s2tm(opnu4lpe lfetl(faDrmx oou4oeenmictlslaDrmuvs u)arxoxo3ta1fate ueo;()srumio3oy4al n ivt tf 2tr(rpot1tlt mo3tys s2rmnvs u)alxnxr totlatrai s;s)trum(opoudope mivtas  Dtaum no0tpen fctydlaDrl(vpn() exnif3oydoa rln s s0 2trxo3oy1llte ictls aruaxronu1aptomfciytfa uan p (0 reoxo3oy1lmDeauvils)s2xm(m oudapeeliei s  2umx poo4oeeomicild a2ua(vs;u4trxnxfciydlm   n i;(  2uoxm3oo4oltnliesls) Drrumono0aexomf3iad a2ranvs;t0 exniocoydfatr neols0 exm(r nydlmenlnci s)srrru  nu1tet ii3ildfaDua( p u0texnxfctatfaD  n i;t)seumxrpoo1apt  fct sf 2umxroot0tet mieiasls uluvs t4 lxrmr ootop rli s t) euoxopno4ame mnvi () 2ua(mont0oexnmoeild a2uau o;u)alxoif oytla eai s s)trtoxr ou1lpt lneils) rrrumont0aetnmf3ildla2rm(mo;u0aetrir3oo1oaDrlnvil() 2tmxo3iydol elnesas)srumurp;o1oleomocilsls ranvs (4tetrmr ty1oa e ieil(0seur(m3nudlm e ieiatfsrta( ont4olxomociyt s2uanmpnu)tetrmrciytfpDeai il(0 exo(m oo1lmte ies t)sDuax  nu0alx mf3iatlaDumnms;u)texnir3iy1lmDrlieslt) exr(o3iy1lptn ieilt srra(r oo4tpxoifciyslmDelnvo;t4arxrmo todlat lu s s t2xoxmpio4llenlnetat)a2taxr ;t4olto f3iaslm2rlums;u4aetrxrcootoaD aieol()teur(m oydopt mfvs t  rur(r ;t4tptnif3ild s ul(msnu0arxnmo3to1fmtrai s t0teuo(m3oy4lltn fetas)a2urxroou4ole mieilt m2eluvon() renio iatfaD  n s;t texmxm3ou1opeemnvias)a2trumpnt0aptoif3iydla2emuvont4arerir3iadop elnvi;t t2xo(rpnydope mfvtl( arraxr ;o4oetomfcilslaDelnvs u)altoircoatfm eau o s)srxr(rpoudolt mnvtat) rtmxmo;u0aexn fctydfmDulumpnt0 rerxo iatfaD luvo () 2tmxr3iy1ll nlnet t)aDurumpot4tpxo ieiasls rl(ms t0aetnif3ootomDeluvs (0teum(o3ou4al nmfeta()a2uaxmo;u1oexn i3iydls elnmpn()arxrxociodopD  i olt sexmxmpoudop  mivslt) 2uru p;u4tlenmi3ilslm eluvs;u) rxnmo iatlp elivo;s0sruo(r iudaleelicsat sDta(rp;o0oltnif3iyd s2ranvo u0aeeomf3tydfa   neols0 2uoxr nudll n ict () 2rr( onu4tlxomi3iatla2uau o;u)trxomf ty1om raivs;t)teuo(mpno1opt mfvsatfa2taxmonu1aeenioctyd m em(mo (0altnxfcootomDr ivs;s0 2toimpiu4ll e ivtasfa2rmumpno0tpxnmoctldlm2elnmonu4texrmocoytomD  i o t teto(o ny4lmee iet sf Duax onu0aeenmo3ilsfm2rmu snt0 lermrcty1oa r ues;s)srxrxo3ny1lptnmivtl()aDum(rp;t0oleomieilt a eaumpnt0aexnxr3iadlateanes s srum(m no4ll n ivtlt) Drmu ont0tlt mocild mDemnvpnu4arxoxf tydoa   ues;t  rxrio3no4lmenlfctasfaDuaur nu4oex  i3iytfm um(mont4 ltnxf iadfaDran s;s) rxm(r3nudol n netltf 2rm(mo;o0tlxomf3iysfaDeanmsn(4 etrir3oadopDrlu il(0srurxopoy4lmenlnvta() Drau pnu4oexo f3tadfsDeauvo u0tlxnxrctadlaD ai sls texr(o nu1ll nlnvsls sDumu pou4altniieiaslaDeanms (0arxrxf iodlmt  uvsls0 2toio nudlle liei s sDrrxmpot4oltnmoeilslm2ul( on(4tlxriocoytoat ln o t0setmxo3iy1ol emfei ()aDtmxrp;t0oexn i3iltfaDul( s t0aetnxr3tytomD aueols)t2xmio3ou1lmenlivils arua(  nu4alenmoeiysfs2elnvp;u4 rtrif3oadfp eanvi () exrim3nu1amenlfcta( sDumx  no0tptoifcilsfm2ua( pn(0arerxo3tadopteln o;t)srtoxopou4om  lnetltf 2rauro;t1tpen ieias s2el( s t4 lenxrcio1laD  nvols tetr(r3no4lm e ncta( sDtaxroou4oeenmfeias s2ra( o;(4aetrxocio1fmte nvi s0t2xmxr iu1lmen ivsat)a2rmur ;t4tpeomociytfm ra(mo;t4 eeriociydlp ran i;s0 2uoir oydap nlncta(fsrrruro;t0ale iociysfs uluvs;t)artniocootom  aivsl( sexrxo3nu1am  lfesl() rrau onu0olenmieiyt a2rlnvs (0alxrmf iytfm  li il()sexmio3oo1al nlfctlsfs2umu  oo4aetniieildfa emumo t0 lxrifciy1fpDr ueo s truoxr oo4amte fvi t) Dtrur no1tle iieiyslaDrl(msnt0 leoio tatomtelneols0t2urir3nodlm n fcs t arum(m ;u4oleomi3tldfaDeauvo;u4trtnmocoodlmte iei ()seuo(r3ou4oltn fcsat a2tmx p;u0altn o3iad m um( o (0 lenxo3oytfmteli ols0t2tmim3ou1lleemnvi tfarrrurono1aeeoiictatfm2emnvo;t)alxnir3oo1omD anvi;s0srxr(r3oy1altn nvtl() rraxr ou4apxnifetasfm rlnmo;t) reoxr oy1op   ieol(0t2urxmpnudamen net s  Dtaumpot0oee mfeiat mDrm( pn()aleomr3to1fpDrlnes t)setoxopoy1lpenmnvi ()aDraumono4oex mfetld a um( p u)altomrcto1opteaies;t) 2xoxm3iy1lptn fci t srtaxrpno1tltnii3iyd s2elnvp;t0altrmocoydfa r ivs s) rur(opno1oltemnvtl( srtr(rp;u1aptnmfctls a2el( onu) leomfcty1la  aivs ()trto(r nu1oleemici s arrrxrpno1tpe mfeiatlmDuanmp;u0treoif to1fmDraneo t) 2tmio3oy4al nlivtatfa2ra(r nu0tlx ifctatfs ea( on() lxrif3ia1oaD aues s)trtoir iodal emfeta(faDta( oot1tptoiociytfmDulu o;u4 rerxr3ia1la elnvil()trxo(o nu4opeelnvtls sruaxmpno4tpxomo3ildlaDea(vpnu0tltrxf3oydlmteanvo;t0 rtrir3nu4ol emieilsfsDtrxm nu0apt  i3iytla ea(mo u0altnxr oy1laDelivils0sexm(r3ou4ll emfcs s sDrrxmp;o1tpxomfctydls ean o t4 ltnxociy1oa eaueo;()trtmxo iu1lle mncia() 2rmumoou1tee ifctldlm rauvo;u)trtrio3iotfmDe n s s0 eurxmpnodame lfcslsf 2tr(r ;u4apeniociyd aDranvon(0altnmocootlmt ai i s) 2xr(r3ny4ol nmfcsltfarua(mpno0optn ieilt s2eanvp u4aexnxf3to1faD  iei s)srtmxm3oy1alt lfvi s aDur( onu1alxn ieildfsDrlu p;(0alenmo3iatfmD livsls teur(opiudamtelncilt  rraxr ot1optnioeiyd m2um(ms;u)tlxnxo ootfpDean s s sruo(mpno4lleemicilsf rrr(mpot0aee ifciys aDrmuvo (4trxrircoo1lmDelnes t0setr(r iudomeemici t)sDurump;o1alt ifeiatfs rl(msn(0 eenmo totopte ivilt0 2toxr3oydam nlnvt s  rumxrpoo1olen ociyslaDra( on(4trtomr iatlp ran o;s0 etr(opny1al n ici (  Dtmx p;o1texn o3tls a2rmu pnu0aleoxr oa1op ran i;s srtmxm no1ape mivtl()a2um(mp;u1oeeo o3tyd mDrlnmpn() ltnmr3io1lpt lieo s trumir3iu4ap nmiet t a2um(rp;o1texn i3iatlm2el( s (4 rtoiocoytom eanvil( srtr(o3iy1amtn neiltfsDrr(r nt1oltomfctlt m2eanmonu) eenmocia1lpDe nvils t2xoio3oo1aptemfvs tfsrrm(ro;o4apxn f3tyd aDrmu o;u) renir3oadlpt lnesls0 2uoimpnodapeemnct ( arrrumo;u4alx if3iyd m2el( p;t4 eermo3tytfmtrluvs s)teuo(m oy4amtelncias s2rmu pot1tee  f3iyd s rlnmo;u0tltnif3oydoa r i s s srurio iy1ol n nvil()arrrx p;u0tet ifciytfaDua( p (4aeenio3iadoptr uvi s trxoir iudam elfetl(fsruax p;u1oee miciltlm elnvo;u) rermf3ta1om  anei;(0 rxrir3iudllte fct t sDtmu pnu4aet iocias s uau o;(0artomr3todlmtr i il(0 2umxr oudoleemivtls  rraxr nt0oetn ociytfmDuauvp t0alerif3iydlp   neols) 2xm(r3nydol  mfcia(  Drrumooo4oeto oetasfm emn p () rxomociadfmtranei;s t2xo(r3ou4lmt licta( artaxm nt1olx mocils m2rlnmp;t0trtrio iy1fateaneslt) 2umim nydlltemnet sfsrum( o;u4oex ii3iatla2rl(mo;t4 etniocootfmte nvo ()srxrio nudopen nei () Dtr( ooo1tlx mfctadfs2ulums;(4altoxr3tydfate i il(0s2tm(m io4opt lfvi (fartmumo;t4opxomicilt s2rlnvp (0tltnxo3ootlmtr uvils)sruo(o3nydale mivs s)artaurooo4tleomf3tlt m2umuvs;(4 eenxf to1opDeaieslt)setrirpny4apeelnvil( sDrax  ;u0aptniieiltfm uanmsnt4tlxniocoadlm rli o s  eurxo3nodop emnes ()s2rrxr ;u1tleomfeiytfmDumnvp (4alxoir3tadfpDrluvo;s0t2uoxopiudoltnliei ()sDrr( p;u4teeo fetadlmDuaumsn()teenxr3tadfaD  nvs;()trxmir no1lm e nesa(fa2rr(r ot4aet  fcilsfmDumn pnu)artoircia1laDr uvi s0t2xoxr3oy1ap n ictas aDra( onu4apxoifetlslmDraums (4texnifcoydfptrluvol( t2urxr3ou4ap  mieiat  Dur(  no1apeniocildfsDeau pn()altnmf tatomDrlivsl( srur(o3ny1omeemiet sf rtmxr oo1apxo ieiltls eaumon(4tetnifcoo1om rln ol()srxrim3no1alenlnvil(fa2urx  oo4tpx ifciat m2ean s;u0altrxoctatoaD lnvi ()t2xrim iy4oltnlfci sfarurumoou0aetnmfeiydfa2rmuvon(4treoifcoy1fatraivo;s  eto(mpny1al emfei ()aDtru oot4aptoifcildls2ul(vsnt4 ltrxf iatfpD lues t  rto(m3nu4oleelfeta(farrau pno4tpt moeiys mDumuvonu4tlxoifcoatoptraneo;t  rto(mpou1oltnlivs t)srtauro;t0oet  iciad sDrmu p;t4tleomo3io1fpD lnvil()t2xrxmpoydllen fesa()arrmxro;t4tpt mf3tltfa emu s;u4tleoir3to1oatelnvs t) 2uoir nu1apte nciat)srta(rpoo4olxnmo3iyd a2eanms (0aetomfcoa1lpDe nvil(0t2trxr3iy4omtelfes ( arrrxmpnu0oeto fciasls rlu p;t0 ltrif oadop eaneo (0 etrxopiu1ap  mnviat  rrmx  nt0aee  o3iasfmDumn onu4trtnir iy1fm  luei ()s2uo(m ny4lp e fvtl(fsDum( pno0aetn oeiadlaDumumo;t)areoio ty1lpDe ivils)trtoxr io1ll nmfcsas  rum(mp;t1aeeo fctls s2umums t0aetnmf3oa1opt  ieo;t t2xoxm3no1omen ici tfaDrr( oou4olenmi3ild mDua(msnt4 lxomf iytfpDrai sl(0trtm(m oudape  fvs t sDta(m no4tlto icild a rlums (4treoifcoadfmt  uvil(0 eurir iodop nmnctlsf ruaxmpot4tpenmfciasla2eauvont0 rxomf iytfpt li o;s0t2tr(opnodop nmfci t)srumxr nt4tlxniiciadlsDean pnt)areoxf3oydlp elnei;s)trxrirpoy1optnmiviasf Dra( p;o0optn f3iatfs ulump;(4 etnxfciotop  ai s;s t2tr(r no4lm elnesat aDtm(mo;u0texnmf3taslm2ea( ont0trxomr tatfpt luvs;t)t2tmim ny4ll n nvslsf rtrum ou4oeeo i3ias a ea(vp;() eermo tadfm  ln o t) etmxr no1ame miviat) rta(mpno1tpe ioeiadfm ra( p (4aetomrcoodfm e nesl(0 2xm(r iy1amenmfcia( a2umx o;u4olxn oeild a2umu p;(0 lxrxf iydfpte ieolt setr(opnodoptnlnesas)sDta(mooo0oltnmfctld mDulu s u)artomo3ty1oatrlnes;s) 2trim ny4oleemietl() Dumxmoot0altoiocilslm emn sn(0arenio3tatoptr n sl(0s2trxo iodam  lfei () rraxmpno4alx  f3iaslm ulums t4texnif3oytfm e ieo (0s2xoxmpnu4lm elnvt s)s2tr(  ;t4apx  icild sDum( snt4tlxnxo3oa1fmDe nvs s0srxoxr oudlptemfvsa( arrm(  oo4tet  f3tytfsDumnmo;t4 reoif3oy1om r nvi () rurir io4am emfes tfarurx oou4tlen o3iyt mDemuvon(4artoxo3ia1fp elnvo s)t2to(r3nodom n ivs sfaDtmxm ;t0apxnmf3iyd a2eanmpnt)trtoxrcoa1lmteli ilt0 2um(rpnu4amtn fvilt sDtm( ooo4apeomoeiysls ulnvo;u0aetnxociy1fp eaiei s) rtrimpoodopt lfctlsfsDrmum ou0tetn fciasfaDel( p;t) rtrircoydlatr u i;s  rurxr3ny1optn fcil( s2tmxm ;o4tltn f3ilsfa2elnvp;t)texrxfciodlm  an s t0 rxoxo3iu1lle mnetltf rrmumo;o1aeen i3iasfsDeau sn(0tlermr oadom  ai s;s trxoirpoodomtemfctas) Drau oou4tpeo o3tytfm2eauvpn()arxrxocoytomDeaueo () rtm(m iy1lltelieiatfa2rmxmono4oeenifciatfsDelnvp;t0alxoio3oodomD li sl() rtoim3iy4lmt  icsl()a2ta( o;t1aleo fcilsls2uauvp u0aetrmr oo1fateauvsl()srxmxrpiudlpt  fcsls srrmurpnu4opxoifctas m ran s;u0tetnxf ia1faD  nes () rurimpiu4lme  fcslt aDur(m ;t1aeto iciysfsDelnmonu4altnmrcoy1fptraues (0 rtoim3oy4ole  fcsl( aDrm(r no4tle iieiytls2umn o;t0alxnxr3io1fpDe i sl(0s2umxm io1ameelfcsls  Dumu pou4apxo i3tltla2elumont0tlxrir3tadom   uei t0texo(rpoo1lltn nct tfsDrrx oou1ope iiciatlm2rl(vs (0aeeomf iadfm r ivilt0s2umim3nudam nmnci tfarrr(r ot0alt mi3tad aDum(vsnu4aetnifctotfa rluvsl(  etmio iu4amt  iesas)sDrmurp;o0aexnmf3ildfm2ua(ms;(0 ltoxr tadla  lneols)s2tr(m oydal emfviltf 2tr( poo1aeeoio3ilt m rlu o;t0 exoxf3tytlate neolt0setmxmpoudapt mfviat s2um(  ot0aexnioeiltlm2rmu p;t4aetnmo3oa1lat li o;t) rumxmpio1ale lfci s)s2tmx  no1oeeniiciytlsDeln o u0 rtrxrcoydlptraivol(  rtrxm3oy4omtnmfes t)srtmxm nt0apt  fctydlm2umnvo;t4aexnmo3iy1lmDelies;()s2trxr3oo4opt lnct tfartr(r ;t0apxn iciysls rl(mpn(4 etrmoctodfmteln i ( t2uoxo ou1aptnmics sf rtr(m no0oetoii3iatls2elnvo;(0 exoircootop e uvi (0trtrxo ou4alee fciat)arumur ;t1aeeoifciadls2uan s u4teerio3oo1fp e uvi t t2toiopnodam n ncs t  rrax pno0opeo icilsfaDeanms;u4tltniociydfaD  u ol( trtoim3io4aleelfvt ()a2urx ooo0tle ifeiadfa2em(vs ()aeerio3oodfm  lieslt)s2uo(r3no4alte ics sfsDrmu pnt1altnifciytls2rmu s;(4alxrxf todlp eli ils0 rtrxm nodlptemfcs s arumur ;o4apenmietytfm um(vs;t0aexnmf3ta1optrlieols0srxrir3ny1lpee ivslt) 2raurp;o4tpe  fcias m2rm(mont) exnmocootop elnvolt0teur(mpnu4lltelicsls  Drr(rpou0alt  ieiytlaDea( o u)arenxf3oy1oate n s ()setm(mpiudale  ieiatfaDrrxm oo1oetnmiciad aDemumpn(0 lxnirctadlmt  ieo t) 2xr(rpiu1ap elfetat)arrmum ot1aet mfctldfs rmnmont4altomo3iotlpDeai i ()trxmim3oo4apeemnesa(fsDrr(mooo4olxoifctyslaDem(mont4alerirctydlpDeaneols0s2urxo iudll  mfeiat  2trur ;u1aleomfeilsfsDrln p (4 ltrifciydfm  livi t)seurim3iu4amtnlnviltf Dururp;o4alto feiatla2ranms t) leoxr3iy1lmtelu s ( s2umimpnodope licsatf rua(mo;u0opt  i3tyd s2rln o;(0aexrmf tatfpDeaiei;t0 etmxr3oydomt mnci s)sDur(mpnt1oeeo o3iadfs rm(mo u0alxrir3oa1faDeln ol(0 etmxo io4omte nesl()sruax  ot4oexnio3ias m eanmp;t0 exnmfctytfmteai ils srtm(m iy4ol nlivils  2tm(rpot4oee ii3iad a2rlnvs;u4texoxocoy1lp e uvs;t  rxoxr no4lm emnvt sf Dtaum ;t4tpe mictltfa2el( s t) reoif3iy1om  lneo;( tetmxm io4ll   fciatfsruaurp;o1opeoio3tadls ra( o;u4tltomf3iodfp r nvilt0 2xm(m3ny1ameemnet t aDua(rp;o1teenif3iysfm2rm(monu4 reomfciatlpt  ues;s  rtr(m3nu1ll   fesa(  rrmu  ;o1apeomieild s2rm(ms u)alxrmf3oo1laDrlieils0 2toxopnudllt lfct sfs2um(r ;t1apxo f3iyt s ranvs;t)teermf3iy1laDe ueol( s2toxrpoy4amenlnvs ( s2rax o;u0apx mi3ildlm emuvo;()aeenxf io1opteluei;s t2um(m iu4lpe lnes (fa2tr(r ou4olenmi3ild mDem( p (4trtnxo ty1fmtrluvs s0tetmxr io4amt  nesa()arrmur ;o1opt mfeiatla2um( s (4 ltoif3oa1fpDrlivi;s) 2xmxo iy1llt  netat)s2rr( poo0apt mi3tldla2emu s;u)arxnxr iytom  auei s  2tmxo3no1lm emfvs (f Drru  nu0oeeniietlt mDem( pnu4teenmr3oa1fate ies t0 2um(r3oy1ameemietasfs2urx p;u0tlxnmiciasfm2um(mo;u4 ltrmo3tadoa eauvs s0 etmim3no4altemieiat) Duau  nt0optoiocilt a2rmuvs;u0 lxrmr3todlpDranes;t0t2xm(m oydapeemfcsat srra( oot1aet  o3tadfs ranmsnu0 rerifctotfaD  uvsls0s2urxr ny1am nmfvt s)artrurpno0tpxnmf3ilsfmDemuvo;t4 ltnxfciytlaD liei;s)t2tm(o ou4ope mivtas sDtrxm oo1tltomieiad a2ulnmo;u0tlxoxfcoytoatrau o s0t2urio3nu4omenmnctls)arrr( oou1tex  iciysla2ul( sn()trtrxocoatoate n i;t)t2umxo3iy4amen netls)srra(rpou4aexomieiydlaDua(vo;u)trtoif3oatlmt livol(0trumxopoydope  nvt ( a2uru  ou0apx moetasfa2emuvo;u0 exrmf totlmtrli il()setm(rpiu1ol   fctltfa2tm(r no0ape mo3ild mDra(vont) ltrmfcoy1lp rlnvs;t s2xo(mpio1op elfcs tf rumxmpno0tleo o3ils a em(vo t)arxoxr ootfmteanvols)srxmxm oydomt miei s)srra(  ot1oleo ieiydlm el( o;(0 renir iodoat anvs;( trxm(o oy1lmt mieil( s2umu pou4opt mi3tldls2rl(mp;(4tlxrifcoa1laD  u il( teuo(o nydopen nvtlsfs2trxrpno1oetoiiciat sDul(vont4tetomr io1fp eaivi (  2to(r oy4alt mfvs ()a2umu  no4oleomo3iasla2em(mp;()arenircoytlmtelu il( trxr(rpoodllenmietls aDuaxm ;t4olxoifeiys m emu snt4tleoioctytfa   ivs;s texrio no1ap eliei t  2umxr ou4opeo iciltlmDemu pnu4texoxo oa1lmD aivi;() rum(o3nodlmtelnvt s  Dtmum ;o1altnmo3tldls ranvs u0aetrxocia1faD lueo s0 euo(m io1op  mnctasfsDtmxrpoo0apto fctydlsDea(vpnu4 exrxf ta1fmDr ivsls srto(r oydol nmnctltfa2umumpno0optn i3iasls eluvo;u)trtnxrctytomtr nvs;t  etmxopnydoltn nvsat)aDumxm ;u4oltomfctld a2emnmsnu)aeenxfcoa1lpDe ueslt0texr(m3oudapenlnes (fartaxrpou1alxoioctlt a rauvp u0 exrir oo1fpt  n s t0 eumio3ou4optelfcia( aDuau oot4apxn ieiltfs2uln s (0 exnxocoadoptraieslt0tetm(m nu4ome mfeiat) rtmu on
\ No newline at end of file
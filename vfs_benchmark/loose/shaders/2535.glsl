@@ -0,0 +1 @@
+ieo;(0trumxr iy1amen ietlt  Dta(m nt1oetnmocilsfm2ra(vs (4teeoio3iotomte ivs;s trtm(rpnu4omeemnetlt  2ta(r ou0aex  ietasfsDul( p (4alxrmf oo1fm raivol(0trxoir oo4lp e fvslt)srraxr ou4tet mi3tls aDemumpn(4trenmo oytlpDe uei;( s2xoxopoy1lltelnvsa(fsDraxmo;o1tlx  octadla ranvo u)aeenxocia1fat aieo ()srurxm3no1omen neilsfaDtmx  no4alxoifctldfm emuvp;u)aeenir3tadfmD aiei;t texmxr oydal  mics s s2raxm ;o4tpxnifctatfmDumumo u) exrxo3oa1lptrluvo;s0t2umxm3iudlpe  fvi t)aDurxr oo4tpenmf3tytlmDemnvp;u)tlxnmocto1faDrlnvi s0 ruo(opiu4amtemfciasfaDum( oot0apeoii3tlsfmDrl(vonu4 eerxfciadfptrauvi t)tetoir3no1ll e fcsas)sDtm(mpnu0apeoioeiaslaDemnmsnu4treomrcoydlat  ues s seurir oudlmtnlnvtatfs2um(mp;u0apt ioeilsfs eluvo;()altnmf3oa1oate uvols) 2xr(opoodolee fciat)srumxmpno1texo fctltfm raumo u4 rxnmf3iotlpD an il()srxm(mpiu4lle mfvia() rua(mpno0tltnmietadfa uau o;(4artrifciydfpt lnvsls)trumim3io1lm  mivia(f rtaxmont4alxo i3iatla ua(vs t4 eenxfcty1oa  lu s;( srxrim oydaptnmfcils) rtau  nt0olxo ieiatfmDea( snt)altnmo3iodlat aivs t)seumxm3iu4amtemfcias)a2tmu ont4aeeoiiciyd s2em(vs;(4arxnmf oa1op rlnvol(0s2toim3oodllee netlt)srurumpno1ope  i3iyt m2rmump;(4artnmf tydoaD luvi;s0trurim3ou4opee nctatfaDurx p;u0apxnioctat s emumonu0trenmo tydom   u i t)t2xr(r oy4ome  fvtas  Durxmo;u4oetnmiciysla2umuvsnu4 ltrxo iydfpD auvs s)s2to(r3io4op  mfvtlsf Dtrxrp;o4oexnmictadla2el(vo;() ltrxf3ia1opt au o ( t2xmimpnu4al nlfetlt sDrmx  ot1texnifciltfm2eaumsnu4arxnxr3io1omDrlu s (0seurxr3oudamte fcta()srrmxroou0tlx ifetys m2rlnvs;u4aetnxo oadom rau olt trtmimpiu1apt lnvsl(f Dua(rp;u0tpto ictatfmDumn pn(0 exrio3iy1faDeanesl(0truoio ny1altnlnciat sDuaumonu0tex mfciatfaDeaumon()arenio3oodfmt aieo;(0srxm(o iu1opeemfctlt)aDra(mp;o4tpeo iciatla um(mo u0tltnxf3to1fat  i s;s0t2xrirpiu4lm nmivtat)a2rrxm ;u1oee  oeiasls2umn ont)arermf3oodfmt  ies ( trxoiopny1ap nmfet s aDrr( p;o1tpxnii3tyd s rm(mpnt) lenio iytlaD lu ol()srxoir nu1openliesa()aDrrum ;t4tee moetad mDrl(vonu4trxnmr3iydfm   uvslt0texr(o nu1op n iesatfsDtmurpoo1tpxnmf3tasfmDulu p;u0aeerxocoy1fatr ueilt)teumxm iu1am emivta(faDua(  nt4tltnmietls s uanvp;u0tlxoxr3oy1oa r nvils) eur(rpnu1ll nlfes ()s2ururo;u4apx mi3iasfmDuau p;(0tlenmo iatop ranvo;t0 2tmirpiudamtnlnesas s2tmxmonu0openmoetltla uluvo t)areomo ia1om elieslt) exrxmpnu1lm emncsat a2umum ;u0oetn oeiltfs2emu s;()tetnir3oytlmDe ies;(0sruo(mpno4opt livias aDrmum ;u1tpxo o3iaslsDelnvs () ltnirctodfptraieil()s2xmirpoy4apenliet ( a2tr(  ;u1tpxo octasla2ea(msn(0arerxrciydlptrlues (0s2xriopiydam e netas)aDraxr oo0aet ioetls a ul( s (0alenmrciotlmt aieol(  2to(r io4amt lfeil(  Dua( p;u0oex  f3iaslaDel(vo;u4 lxnir3ty1lmDr ivs;t0 2xmxo3iy1am n ies ( srur(root1opeomi3tydfs2rmuvp t)teeoiocia1fatrln i s) 2tmxr oy4amen fetat) Drm(mo;o4openifeiysfmDranmsn(0aetnif3io1optrauei;t trurxm3io1optn fvta(  2ua(rono0oeeomo3iltfm rmnmsnu4 rxoxf3ia1lmtelnvi t)srxm(r3nodomeemivslt  rurump;t4tet ifctydlsDrl( o (0 rerxfctadfmD  iei;t0t2xmirpnodolenmivsa(  rtr(  ;o1olt ifctadfa rmump;u0artnxf tydop   n i;() rtmim oy4lmtnlivia() 2rrumont4apt  ociadla2emn s t0 eenmo3tydop eluei (  rurim3nudlmtnlfcs t)aDra(r ou1aeeoifeiad s umnmp t4 exrxrctatoatrluvo ( t2uoxopiydapee fesas srrru onu0tleo ietltlsDulnvp t0 lxnxrctydlpDeli ol()t2xr(r3nydlptnlfvsl()srrmu  no0apx mieiydfm2ra(vp;t) eermf iy1fp r u s;t truo(r3iydoptnlnct s aDrrxr no0tpeo fctatfsDulu o t4tlxrio iadfmD lnvsls0 2xmxo no4ole  fetlsfsDrau o;o0oleomfeildfa ea( p;t4 rtrxoctodfate i s;t) etr(o3oo1oltelici s)sDtr(mpou1tptomoetysfs elnvo;(4 etnmr3oatla  au slt  etr(m3nu1lpt  ncils)aDrr(mpno1oetnio3tytla rm(mpnu0alermo3oydoaD aneo s) etmimpio4olen ieilt s2rruro;o1olx mf3tydfsDua( pn()texnxr oodfpt ai olt t2xrxm3nu1oleemneiltf 2trxrooo1alx mieiadls ul(von() exnmr3oadlmDe uvilt texr(o3nu1olt lfes sfsDrmuro;t4aet iociyt s2rm( s (4 exoio3oo1latelu s s texrir3io4ol n fcta(fsDurur nu1tltn f3ilsfa ua( pnt)texrmfcoadlaDrauei s)s2toim3io1ome  ivils)s2uru pot0tleomoeiytfs2rauvonu)tlxomo3iy1oaDeaues;t0t2xo(r ny1lmeemivtat sDrau p;t1olxomiciydlm2rmnmp;t0alxnmr3totom eli i;s) exmxm3ou4amtelnviasf 2tmxmp;u0apeoiictydfm ra(vsn(0tltnmr ty1oat aneols) 2umxo nu4aptn iviltfaDrm(r ot4ope mi3iaslm2el(mp;t0aeeoxocoy1om eauvolt seumxmpou4lmt  iet t s2ta(  ou0tle ii3iaslsDuluvp (4arxrio ty1lp elivsls  rxmio3io4lle lietlt srtm(mpnu4olt  oetyd aDul(ms;() renxo tadlmD  nei s teuoir iudap  mnvi ()artrx o;t1oltn ieiasfm em(mont4 lenio3tadfaD lu o s trxoxo3io1lmtemfcia(fs2rm(  ot4tlx iietas aDuluvp;u)arerio3io1fm e neo (0seuoirpoo4lmeelncsat s2tax pnt0tptnmo3iltlsDrauvo t4 exrxf io1oat au i;s trto(rpnodalt mict tfs2uaxmo;t0oexomi3tysfa ea( s;(4tlxrxrctadfa  lueo;s teumxr3iy1omtn fetls srrmx ont1alxnmieiytfaDum(vs;u) rxrxo iytfaDr u ol() 2umxr iy4ale mivt tfsrumxr oo0optn fctas m2rm( ont0 eermo tytlm raivolt  rxmiopno1lmeemnetl() Drauront1alx iieiadfs2elnmo (4alxrmr tytom eluvs ( s2trxrpnydolte nvtls arurumpou4apto oeiltla eauvon(0 leriociodfp rlu o s setrim3ny4amt lfes ()s2umx o;o0optoiictlsfaDra( p;t4treomf ia1fm   ies (0t2tmimpiodopt  fctlt)srtmxro;u0oexoif3iyd m2umums t)tetoir oytop e ies ()s2xrim3nudal  mfvi tf Drrxmpot4apx mo3iydfm um(vo;(0arxrmrcty1lmDraues ()srumir iydamenlicil(fs2um( pno1aexnifciasfaDulu s;u4tlenmfctatfpDelu i t)sexrxm3nudape mivtl( a2trum oo4aet  iciyd m eluvo;(0 rtoxr oytfpD aivils  eumxr oudlmtemnctl( a2tmu  oo0aleoiicils m2uanvs (4 exnmo oo1fate ies s  eur(r3nodlp nmivs s a2rm(mo;o1oetnioctld m2rau p;t0altrir3oydoatrauvi;(0srxo(m3iu1amen feslt)s2ur(rooo0opxo ictat s umuvo t4aexnmf3oodopD  neils t2tm(o3iu4lltemfvtl(f Dra(m nu1tlxnmocilsla ea(vont4 leomrcia1oatrlieol() 2toirpou1ap   fviatfs2ra(m ou1oexn ictytls2emn o t) ltnif3tatlmDelnvo ( trxm(rpnydlleeliciat) Drrxrooo0teenio3tys a rmu p;(0artoxr3iy1omteluvo;s s2umim ny1altn ncia( artmxrono0aleomfeiyd s eluvp (4treomo oy1op  an s;t0srtrxopoy4om n fvt t s2tmxmpno0aetomo3iadlmDrm(vp;(4 leoxf3oytlm eluei;(0srxoxrpiu1lp  mnct s) Drr(mpou0tlt iictltfsDraumpn()teeoirciy1lp e ivslt)setoim3iu4lmenmiviatf Drrx pot4opt mociysfaDuan snu4tetoifctotlateauvs;s sexo(opiu1ll  mieta()srrrx poo0aexo fctad m ua(vo;u0 rtrif ty1lpDeln s;()srxm(m3ou4oltnmfvia(farraurono4ale ioetld s eaums t4artoio ty1lat aieils s2to(r3iu1apee fvi s)s2tr(  ;t1tptoif3iltlm ranvonu0alxoxo3ia1fmD aivslt0 2uo(m io4llt mneils s2rmx p;u1tltoif3iyt mDelnvs;u0treoiocootfm   u i;t)sruoio oo1opt lies t a2rax ont4opxomietyd a eauvsnt4teermo3oatfpD aueols0 etmxr3oo4amen icsas srrmxmpnt4aexoii3tys a2umu o t4 renmoctadopt livo;s0 2xoio3oy1ope mfet ( aDurxroou0tpx iieildls2ul( s ()aeeoxfctodfpt  nes;s) 2uoir3iydop nlfvtat)a2rmx o;u1apxo f3ilslm2umn o;(0 rxoxf iatlmDr iei;s)s2umirpou4amtelnctas) rrmxroot0altnmf3iatlmDemnmp ()tetoiocia1om  an i t trumiopiodoptemnct sfaDtrur no0tltn f3iadfmDemuvsnu0 rerxr3ty1fmDrlueol() rxo(m3nudopeelfvtl()srrr(ront4aptnmf3iydlsDel( o u)artomrcoytoatrlneo;(0 2toir ou1lpee ncslsf ruaumonu4aex ifciltfaDranvsnu0 rtnxr3tytopDr u ils0t2xmxmpno1ame lnviltfs2tau ont1aexnmieiatfs2uan s;t4arermf oydfmteli sls) eumxmpny1am e iesl( a2urx p;o1oeto oetls a2ua(mp;t4arxoir oo1laDe uesls teuoir iydamenmfvsas  rrru o;u4oeto fetydfsDelu s;t)tetoio3tytla elnes;s0 exmimpoy4om e nes ( s2rax  ot4ale mo3iyd aDelnvo;u) rtnxr3oytla  luei t t2xo(rpou1ol emicilt  rraxmpnu1oltnmf3tasfsDeaump;u0aexoxr3oodlp eau i t t2umim iu1lmenmivt t) 2tmxmpno4apto ieiytfmDrmnmo;()aeermrcia1lmte nvslt0t2toxr ou1lpeelict sfaDurxmonu1tltomo3tltfm2ua(mp;t0aetoxrciotlm  lu sls)tetmim3ou4oltnlici tf rrrurp;t1open ictytfa2ra( onu)aeermr oydom rli o ()t2tmir3oodapt lfcslt)aDtr(m no0alt  i3ilsla uanvpnu0artrio3tytfmt  ieil(0seuo(opoydllenmnvtatfaDuax p;t0tetoii3tltfa ean s ()arxnircoadop rln o;()srxm(o iy4amt lfvt s)sruaxr nt4oeenmiciltfa uauvpnt)arxoxf3totlp eln o ( texmxm iodlm emicslt sDtrxr ;u1aeeomo3iys s2rln p;u)aeenio3totomt auvs;s) rxr(rpnudop emnciltfsDrm(ro;o1alxomfctld a emuvsn()aeeoiociodfa eauvo;s)texoxm3io4al n iet sf rtru o;t0oetn ieiasla2eluvs t) ltrmr iotoatelivi (  2umxopiodll emnvt (  2tmxr ;u1tlxn i3iltfmDeluvpnu4 eenxr oa1fp  aiei;(0t2tmir oo4ope  fei s)aDtmumpnt1tlxnifeiad mDrmnmonu4trtrmr totfatr nvi t0srxmxrpiudop  mnvt s  rrmu p;t4opxo fciydls2ua( o (0texrxfcoatfatraiei;(0srxo(rpno1om  lieil()artax o;u1tlenmo3iyslmDrmump u)areomr3tytfa elivi;t) rxo(rpoy4lptnlfesls)aDur(m no4oex io3tyt m2ea( pnt)trtnifcoydfm rai i t tetoxr oudal e nvtasfs2tr(mooo1optoifeiltlsDea(mo;u)altoif3oa1op  an s;t0t2xrxm3iu4ol elfes ()sDumxronu4opxo i3tltla2ea( onu) lerif3to1optranvo;s srtm(opno4lmtemfct s)aDrmxr oo4altomo3tat s2ua(von(0 eerif ty1lateai il()setmxr3nodomen iesls arrr(mpnu4aexoioeiys aDelnmo u0 rxnirctodlaDranvs t0 rtoir3oudlmt  fcslsfaDtmxm nu0optomi3iyd m2elnms;u0trtrio3oadop eluvs;t)trum(m3iy1lp n ietat sruaxronu1tlen ociatlm2em( s;(0trerifcoy1fptelnvils0trtmxo oy1op nlnctas)sDrau p;u0opxnmoeiyd aDrlnmp;(0aeeomf tytlmDeaivils setr(m3nydalt lfcil()a2taurp;u4opeoii3ilslaDumn o;t0tltniocoydoateau i ( s2trim iy4lle  nvils  2trxmpnt1teeoiiciadlmDranmp;()tlerif3oytoaD  neslt)t2xoim3nudope lnetas s2rrum nt0alxo fciyt s2em(mp u0artnxocio1fm eli i s)trumxmpoo1apt  nvsatfaDrmumpnt4tee  f3iydfa eanvon(0aexriocoo1laDeln o;t)srxmir iy4lltnlncsa(  rtau p;u4aptoiieiasfsDrmn p;(0 rtomocootoaDeaneolt)teurio iy4lp elfeiltf 2ta( p;u4opt mo3tls mDemn o;(0teerio ta1oaD lieslt)seumir3iu1lm  mnvsa(  Drmumo;u4tleoiiciltfsDrlump t4 lermf3oytlaDe ivsl( t2ur(rpny4amtelietlsfsrtrxmpno1teen o3ildls uanvp u4aeenmf3tydfpD  nvols  2xo(rpou1omen nvi tfsrua(mpot1tlxnmfcias sDea(vp (4texnxoctydlatr uei s  ruoim io4lptelncslt)srta(rono1tee  i3ildlm2uluvp;(0aetnxr3oo1oa eaivs;s setoxo3oy1ol  mnetlt  rtaxrp;o0alxniieiytfa2umu s ()tlxrioctytomDeaneo s  rum(r iydop  lieil( srua( p;t4alxnmi3tydfa2uan onu0arxoifciatfaDrln sls0trxm(mpno1op   iesl()arrm(mont4olx  i3ilslsDelumonu0 etnxocio1oaD lu o;t0srxr(rpnu4ap e ies (  Dtrxmont4texo feias s2rmnms t0trtnio io1op r uvolt srtoxmpnu1oleelncta()sDrr( o;t0ape iictyd s2emump;u)trxnmr iydlaDe iei () rxo(r ny4ol n feslt a2rrur ot1opt mo3tat s2emu s t0 rerircoytlateai slt  rur(m3nu4opte iet tfa2trxmp;o0opeo ieiltfsDemu s u0areoxrcoodop rlnvs ()teum(mpnu4lpeemnctls s2tau  nu0aexnifctyt mDua(vsnu4aeerio3ty1opD  ieo t)s2xoio oo1ll nmivta( aDtm(mp;o4apx iociat m2emnmpn(0tetrxf iadoat lnei ( t2xmimpiy4alt mncsa( sDrrxm ;o1tlenmociatfa uaums (4altnio oadfpD lu s;t) 2uoir iu4am n neias)sDrru poo0opto fcilsfaDemu pnu)alxrmr3oatop   nvi t  2xmir3iu1lltemfcsas sDrru  ou0apto oeiltfaDrauvsn(0tlenircto1fatrlueolt0teuoxm3iudlp elfcsa(f Drrurpou0optomf3iasfs umnms () lerxo tatoa ran i t0 2tmxr oydamtemnetlt  rumxrp;t0opx miciadlaDeanvp t0arxnmf3io1omt aiei (0trxm(rpiu1lmeemfesltfsDtrx oou4tpe mocilslm rmnmp t0tltrir oodom eaivi;t0 etm(r no4am  mfvt t  rtaumpnu0aeenifetydla eauvpnu4alenifctodfp e i il( srtrxm3no1lltnlneilsf Duru  nt1optn fetltfsDul(mo u4alenmo ia1opt liesls0tetr(m3oy1ol emfvt ()aDur(ro;u1opeo ietlsfs eau o;(4alxomr io1opD auvols t2tm(o ou4ll  mfcslsf 2taxro;u4tetn octld a2ulnvo;u4artoifctydfaD  nvil(0trxmxrpiydlpenmnesl( s2uaum ou1alxo o3tatlaDul(vo u0 etoxf3tatoptraueslt)s2xoim3ou1op n nesl(f Drr( p;o4tex  fcilt sDul( p;(4alxomf3iotop rai s;s teurio3iu1ol   ncslt s2ururo;u1tleoiictysls eanms (0artrif ootlpt au sl(0 exo(m oo1op n fvs (farraxmooo4altomfciydlaDrmu s;(4treoxr3oadoaDelueo (  eum(r oo4optemnesls) Dtrx  nt0olxoii3tltls emu s;u4aeerxf3oodlm eluvi;t) 2trir3iu1omtn feslt srraxrpot1tltn i3iyd m2umnms (0tltrxo3iodfaDrlueo s)s2toir nydal nmiei (faDurx p;t0optnmfciat aDelums;(4tlxnxr3iytoateaueo s t2xrio no4optnmfvt s  rtr(ronu4tptnmfeiasfsDrl(vo;u0tetriocoa1lmt aivol( t2ur(r3ou4amen ivtas srumumpnt4alt moeiatla2em(ms (4teeoxrcia1fpDe ivs () rtr(m ny1lptemfcil(f 2rr( o;o0tptnio3iasfmDea(mo (4trtnio3oodla eln o t0s2tr(m no1ope mieiat) rrr(mpot1apxnifetatlm2rlu o;u4 ltnxr oytomtrlivo;(0 2urimpno4optn neta(fsDumu  nt1tlx ifetat mDean sn() rtrif iydlate n o;s0 rtrxopiy1omt mncil(fs2raxr nu1tet  fetldlaDuanvs () leoif3totfpDeaivo t0 rur(mpoy4apte feia()aDuaxr ;u4oeeomf3ilsla2elu p u4alenmocoatoateln ils s2umxo3nodol e fciat)s2taumono1tpeniiciasfs2eaums u4artomf3oatlpDeliei t0 exr(opou1lme miviat s2rmu  oo1oltnmo3tyd sDea(vont0 rtnio3to1lmtelnes s0 2toxrpiodlm  mfet sf rtrxrpou1oeeo o3iysfmDem(ms;(4aeerir iotomDelneils0srur(r nu4lm e nctlsf rur(rp;u1olt mieiydla ean pnt0alermo3iy1oaDrluvsl() ruo(r3ny1ameelfvsa()s2tr(rpnu4tlenmieiysfm rl( s u0tltoxfcto1lpt  ueslt) etrxr3iydoltnmfcias s2tmumpou4olxn ieiltfaDrluvon(0teeriocto1lpDr ueols)trxrim ny1altnmneta(  Dtrur oo4oleoioctlt s ea( ont0tetrxrciy1om   n o s0setrxm3nu1am elicta(fsDtm( p;t1tlx  i3ildfmDea(vo;u)arxnmf3iodomtrlnei;s srxrxm3iydom emfet s)a2tr( p;t0aexo f3iasls2uauvp;u4 ltnmr3todfmD  uvo () rxmxopnodapen nvtlsfsDumx  nt0tet mociat a elums;u4tltrir3oadlm rai s s truoxopoo1al emiesl(f rrr(rp;o4alxnioetatls2rmnmp;(4 lxnio oodfpteau ilt0setmirpio1lp nmfeia( aDtmxrpou4oeeomo3iydlaDeau s;t0teenxf oatfpt anes;(0 2xoir3io4ol   fctasf Drmuront1tlt moetadlaDuanvs (0artomo oo1op elneol() 2urxrpnudom n feta(fsDurumpnt1tle  ocilslsDelumo u) lxoxocta1lpDeaueol(0texoio oo1lltelnetls)s2umumpot1texniociytfaDua( snt) rxoifcoytop elieo;() 2trirpou4apeelivil( a2rrxrpou1tlenmf3iytlmDum( o ()arxrircoy1om  aivil(0 rum(opiu1amtnlfvia(f rtrx  nu1opxnmieild a rauvonu) rtnmf3iadoa rau i;(0 rxo(m iy4alt lnctlt sDumx ono0aexn fcilsfmDeluvs;t)artnmf tadla  an i () eum(m no4am emnci (fs2rmumpoo4opeoioctls aDrl( p ()aeeoio3tatfatrauvslt0 rtrxopiudllenlnvt ()s2um(  ot0opx iocilslm2el(vsn()alerxfcoo1lptrlivo;s0teur(o3iudole licsa()s2tm(mo;o1opxomo3ildlsDrmnms u) rerxo3todla  lu o;s) etmio oy4apee nvsa(fartau p;t4tee mfcildla2ul( s u0arxnmr iatlp e ivi;t0 rxoxmpiy4ap emnvtlt  Drax o;u4tptoifciltfm em(vs (4 reomr3iytfa e iei;( trtrxo3iu4al  mnctatf 2tr(m ;o0tex ifciydla ra(vp () exrxfcoo1opDr nvo;(0truo(rpou4ap  mncsasf 2tm(root4tpto feiys s uau s u4trtrio iodfp elu ols)trxoiopiudoltemics s srur(mooo1oet iictydla2um(vo t)altnxfciatoa elu ils teum(o3nu4am nlnvsls aDtax onu4oee  oeiyt a rmu snu4trxomr to1lpDr nvs;t0setrirpoudlpte ncia(  rtaxmpoo4oeeoiieiys mDum(vsnu)aleomrctydfmteluvs;s0s2xmxr ny4ll n nci (f Dtmumpot4alt  i3tytlsDua(mon(0 exriociytfmD li s t s2umxm3iy1llt lncslt) Dtm( pnt4ale ioeiadfs rlnvpnu4alxrxf3tadomDraivo;t truo(rpiy1optelicsls) rtrxr oo0tlt iociytfs2emnmo u0artnmr ootoaDe nvilt0 rxmxm iydllt lnvias sDrax oou1tex  i3ias mDea(mont0arerir3oy1lpDelues;t srxo(opoo1ame mfcta()artax pot0tltnif3iatfs ranmp;t0alxomo3iy1lpt livol(  exm(m3oydlm nlnvsl(fs2tmxm no0teenmoetys s ra( p (0 exomf3ootoa rli ils) rum(m3iy4lme liesls a2um(ronu0alto o3tysfm2um(ms;u)trxoir3totfm   uei ( srto(r3ou4ol emfetl(  rur(m nt0oet  feildfa rm( o;t)trtnmfcio1laDr uvo s t2toir oudape  fesat) rra(r ;t4aet mo3tydfa eln o u)aetomo3iotfaDr ivi s srxoirpou1lmte netasfarrm(r ;t0tpx mietas s2el( o t4 exoxr3tytlatrlivs s0t2uoimpiy4ale mfcil( sDumu oot4tptnif3iatfs emuvp;(4tlerifciodlmD anvi;(0 rxm(m nodame mnci sfaDumxmonu4aptnmfctad sDelnmp t) rtnxr3oydlat ai slt) 2umiopny1ll e ictasfsrrmumpot0oet mfeiysfa emu pn()alxnifcoatlp elieslt teto(opoodlpt  nviatfa2ua(mpnu0aptoiieiyt mDrau p t0 reoxfcoodomDrlivi ()trumim oo1lm  licia( sDtm(mp;u0olxnmfcild sDrl( p (0trtoifcio1fpteauvil( s2umxr no1omtn nvtls)artau p;t1tet mf3tldlmDrlumo u4arxoxo3ia1oatr uei t)trurxm3iudomt  iciat arrm(r ;t1oleomiciltfaDuanvs u4 eeoiocta1latraivo (  2xmxm iudllt  fvilt sDtmxr oo0ope iiciltlmDulnvp () eenmo totfaD  ues;s) 2trir3no1am emnvsls srtr(rono4tex ifcilsfa2rmn snt) eerxfciadoatr i s s srxmxo3ou1olee fvs (farum( oou4apto ieiatfm ranvs;u)alenmr3tytlptr i s t t2to(o3oo4lm e fct t) Dur(rono0tetoiieiyd aDel(von(0aexomr io1opDeaieo;s0teumio3ou1ap n ictl() rururp;o4tptnif3ildfs eau sn(4trxnircty1op elnvilt) 2xrxm3iy1aleemfviasfsDtaxronu4oexomiciat s2el(vp t4alenio3oadla  auvo;s srtoim3no4lpe  iei ()a2urxmp;u4alxomoetydlmDrm(ms u) lxrircio1fpDeauvi ()trur(opiu1amtnmiesa()srra(r ot0oexnio3iasfsDrl(vp t) rtnif3to1fpDelu i;( setoio iodap e ivsltf 2urump;t1ale mociysfaDem(vont0aexnmr3todfmt liesls  etm(rpnudlm n iviat)arrm(mp;t4aeeomfcilsfaDean p (4 reoifciytlm  livols) 2xoio iydlltn ivsa()srumump;u4oexnifcildlm ulump;t)teenio ootlaDranvolt) rtoio oy4om  mfvsls)aruaum ;u4oleomieiat m um(vo;t4 reoxfcoadlmDrau ils0seur(r iodameemfes t aDta(rp;o1tlt ioctasla2emnmp;(4altoxr3ootop r neil(0 2umir3nu4ome mfvt (  2tmurpoo4oltnmocilt s2rmuvs;t4aexrxr todom  lneilt0seumxm3oodaptnlfvt (  2tmxrp;u4tpx  octytfaDel(vs;u4 etrxo oatfmtrau s s)s2uoxr nu1ol n ivtat)artmx oot4tpxn ocildfa2rlu o;u0 lxnmoctytoa rau il(0s2xr(rpoydalt mfetat)srumumo;u1opx  icilsfa2rm(vs;(4aetoircootfat lu i;s sruoirpoy4ole  ieils)aDur(mono1tlto f3tadfs uanmpn() lxnifcto1lm   n s ( srtmio iu1alenlfvsa()a2trxrpou4aet mictadfa emu p ()altnmf to1fm eai il() rur(rpiu4lleelneiatf 2rrxm no1ole ii3taslmDeluvs;t0texrmf ta1fm  lueo (0tetmirpiu4apenmictl( s2ta(ro;o0apeomiciatla elnmsnu0aetrmocio1faDeai sls texmio3io4apee ncsl(fs2umxr nu1apeomfeiysfs2rlums (4 rxrioctodoatr uei;t  rurxr oo1ape mnesas a2urx  ;t1tetnioeiat mDel(mp;u4 rxnmo oatopt lnvi t0 exm(r nu4lpte ivsasf rtau p;u1tpxoii3iyslsDeluvp;u4arxoxfcta1opD ln i;s0t2tmxrpiydoptelivs t  2rr(r ot0oltnmoetld m2rlumon()treomo3totla rlu ols srxmio3oo1lm emfeta()a2taum nu4ope mieilsfa2rmump u)trtrxocoytfpDeanvi;s s2trxo oudlmt lfciat)sDurur ou0aptn ieiatfsDul(mp t) rxrxo3to1lptrlueo;(0 2xoxopou4ame  fvilsfs2tr(ro;t4alto icilsfm emnvont4 ltrmocoo1fmtr nei s0sexrio3io4al nlnei t)aDtru pot4tpxo ieiyslm2elu snt4arenxr3tatfatrau i;(0sexrxr3io4amt mfvsls s2uax  ;t4aeen i3tlsfm2um(mpn()trtnxrcty1omD  neo;( s2to(r io4al  lfetas)s2taumonu0aleo ietlt a ean s t)areoif iydoa  aivs s  rxo(m3iu1lpenlfet tfsrrmuroot1tetniictys mDrmn snt4alxomf tatfpD ln i;(0setmir no4openlfetatfarrmxroot1alen fcilsfa2uanvs u0 exrxo3ia1oat an s t0seumxm nydalen fvi ()a2taumo;u0tpeo ictlsfaDem( o;(4trtnmocoa1oat ai ilt0srumir iy4aptn fct ( sruru o;u0olen fctasfa ean o t)teeomf3ty1oa elneo;t t2xrxm ny1ome  nci t)s2umxr no1apx  oeiyd s el(ms t)altnxrciydfm raivol( t2um(r iodopenlnvi ( s2uax oot4openiieiadlm um( s;(4texrif3ia1faDeln olt0t2xmxopny1ape  ivsat arumx  ou1aexn o3iysfa2uaums t0teeoifctatlmDeluesl( trxmxrpno4lp  licsl( srum(mo;t0tpe  iciat aDuan s (4aexnxfciotop elies;()sexr(m iydapt licil(  Drau oot0tetn ictysla em( p;(0tltnirctydfmD ai i ()srumir nu4omtelicsls sDuaxm ot1alx ioetydfs2um( pnu) exnxfciadfmDelu ilt)trtrxo3nu4apte fvsl(fsrrmumonu1aleomoetatfm2umu o;t0 eermr3to1op   ueil( texmir io4lltn fvi t s2taxmo;t4tpx  i3iadfsDrm( onu0arenir ootoptrlivi;s0 euoiopoodomtn fvtlt)sDra( p;t4ale  f3iat sDeau pn(4texnxf3io1fmD  nvo t0setmxr iy4lpeemiviat  2rrxrpou1aptnii3ilsfaDulumpnt)trtrir oodop   ivi;()texm(rpio4opeemfctlsfsrtaurooo1alto o3ilsla2ul( p;u0tlxomf3tytfmD  ueols)s2xoxr3ny1ap nlnvsltfa2rm(mpoo0aetnii3tlt s2rmu s;u0aexrmfciatfpDe ieils0 exoim ny4ameemfcia(  Dtrxr ou0texnii3ildlm2ua(msn(4texrio ta1faD  ues;()sexoim oy4lm nmneias a2ur( p;o0aptoioctyslm2ranmp u4altnxo3oy1fat  ieslt0tetrxm3iu4lltn fcsa(f rum( pot0alen ociadla rlnvp;t) etrircoodoa  luvo;()teumio3ny1aleemncilsf Duru pnu0apeomfeiadlsDea(vp t)aleomfciytla raivslt0trxrxo3oodam nmics t)a2rr(mp;t4oltniieiltfs2rluvont)tltrmocia1lp elueol()t2uoimpou1ole  ivtas sDrm(  ot4tet iicils sDumuvs () lermfciatfm raivo () rtr(mpnodlp e fctas arra(r nu1oexn o3iyd m2ulu pnu0trtnxfciatlaDraivi;( texoxr oo4lpe lieiat) rtmumoou4opt  fciytfa2emumon(0 exoiociytoat  nes s tetm(o oy1lpeeliei () Draur nt4tlxnmiciadlaDea( onu0texoifcia1fp raueo ( seumxrpiudopee neta(  Drr(moou4oexo oetyt m rm(mo;() rxrxr oy1fm r iei () ruo(opny4lmenlicilt aDtr(r nt0tetomfeiasfm2uluvsnu4 lxoifcto1omDeai o t0t2xoim oydlp  mfvtatfs2rrxmp;t0ale mieiydla2eauvo t0 lxomr3iotfm  aies (0 2tm(mpiydapt mietasf 2raur ;u0tltnmfcias s elnmp;u)teeomo tydfmtelueil(0 exoimpnu4optelfvsl(  2tmu o;o4alt mf3tasfs2elnvp;t)aetrir ty1fmtean i ( teuo(mpoo1lme mieil()s2taurpou0olt  i3iaslsDrmuvonu0 lxoiocoa1laDr nei;s)s2tmxo no4oltelnvia()s2taumonu1olx mfeiydlmDeanvp;(0 lerif3oatlp  ln s;s)trurimpnodol e ivs s artmumpnu0texomfctyslm2elnmonu4trerio oydoatrlieols  rxrir ny1alenmnes ( sDuaxmont1tleoifeils sDean p;(0alxoxf3to1oateauvi s)seur(m3iodalt  fctls)s2trx o;o0oexnmo3ildls2umu snu4 rermocootomtr nvs;t  rumirpny1al nlfvt t aDrrxm ;t4tptomociat s2rm(mp t) eeoxo iotopt lnvo;s)sexr(opiodlptemfciasfartr( pnu1tle mfeilt sDean o t) ltoxo3oytopD  uei;( s2urxo iu4alte nctlt)a2rru  ot0aeenmfcilsfa2rl( p t)tleoxfciotopD  ivo t) rxmxm3no4apt mfvils)artaxmp;u0oleomoeiat a eanvs t0tlermf3tydoaDeln olt0teurim3nodlptnlncsa(farrm( o;u0teeo o3ilt aDeauvo u4teermo io1lmteau sl(  exrir nu4op nmfci tfs2raumono0tlxn f3ils s uanmp t4aleoxr iatfptrli slt0 rtr(rpoo1olenmfetl( s2rru ooo0texo oeiadlm2elu o;t0 exnifcto1oaDrlnvs t  exo(o3iodllenmies s sDrmurpou4alt mfciaslm em( p t)altomr3ty1lpteaneolt)trum(r3ny1lm  livi t sDtr(  no4tlx  o3iat s2ra( p;(4 exomf3oydfm eanvo s)tetr(o3oydapee fci sfs2taurooo1apxn feildfm el( snu0alerifcoa1lmtrlies ()truo(mpnudame  ivt (fa2uaxr no0oetomieildfm ua( p (4 etnmf3iadfa r ivs s0t2umim io4lptnlnvsl( s2trx p;t1tlxoiietysfmDelu p u0 lerxo3to1fp r uvslt)trumxm3iydlp elfct s)sDur(ronu4oee mf3iyt m2umuvp;u)tltrmo tadopteluei s  2to(o oo1lmtelivt t  rumuro;o4oexniieiat m2ra(vpn()tlxrxf3to1oa e uei s0 rxrio nu4lmtnlncilsfa2raum ot1tleo ictlslmDrmn o t)tltoxf oytoaD au s;(0 rtr(r no1alt  nctat aDum(rp;u1ope moeiyt mDraump ()tleoxociydfaDeliei (  euoirpnydllenlfeias srra(  nt0tetoiieildla2ul(vpn() eeomo3oatfm   u s s0 rtr(m nudalt mivils a2rmxmpno1aptoioeiatlm uluvonu) etnifcia1fmDrlnvs;(0 2uoir oy4lpenlfctatfsDta(rp;t4oetnmfctat m em( o t)alxnmo ty1late nes s s2umxopiu4op nmfvi (fsrumumonu4oex ioeildla rmuvs;()altrmo3oytopDrluvo t)tetoio no4lpe  nvi sfs2ur(m nu4olxomfeilsfm2eanmo u)tltrxr3iydopD aneils)trxmxmpio4amtemfvtas)s2uaxronu1aeenmoeiat mDrmuvo u4 rxnxr tydla  li ils0 exmxrpoy1lmtn fvsasfs2ua(m ;t4aleo i3iytfs rl(mo;t0texrir3totomDean slt0s2xr(mpiydal emnvsl( srurxr nt1altn feias m rlnmont)aexnmfcto1opDeli i;s  exmir iy1ome  fet sfsDururo;t0oex io3ild m eauvont4 ltrxfcia1opD  neo;s0 2urim3iy1am n iesas  Dra(ro;o4aptomi3tytfmDran s () etrxociatoa rlnvsls s2uoxr iy4omt mneslt s2rrurpot4opxo feiydlsDea(mo t) rtrxrctodlm raueo;s0 2uoxmpoo1ame  nctlsfsDrr(  ot1aet  ocils a2uanvo t4 ltoxf3tytoat  nvs;( srurxopnudlpe  nvi t  rumumo;o0tle  fciadfs2uanvs;(0alxnxrcoydlpD li s s)truoxr3nu4om  mietlsfaDtmu onu1teeoio3tyd m2ea( snu4texomo oodlp   ivi;( s2to(o3iydll n ies t) rtaxrono4olt iiciadfsDean s u0 rxniocoy1oa rln i ( seum(opio4lpenmfvils) Dtmumpot1texnifetas sDean s (4arxrxfciadoaDeai s;() eurio3nydol emici s)aDtrxr oo0aee iieildfs umuvp;u4 eermrciytla r ieolt t2ur(m3ny4lm emicta()srtr(r oo0tet  ietatlsDeaums;t0trxnir iotfm  lies;( srtoxrpio1lmtelivt tfs2tmxmoot0opeo oeiysfm2ulnms;(0altnir3tytfmD  i olt)srumxopoo4om   ieil(fa2ua(mont0tlt  ietydfaDumnvp (0aeerir iytlat luvo;t) euoim3ou4ap nmnvs sfarrm( pou1texnmfeilsfmDuaumon(0 eenxrcoodlmt  u olt)s2toio nu1omt  ivt sf 2ur(mpnt4olt  o3iydfs2rl( p u4 ltnxo3ootlmDrlnei t0s2tmxopoodlmtemics (  2ua(  ou0tle mf3iltlaDrm( onu0 etoif oodlatrlivslt) rtmxo iy4ameelnvs t) Dumurono1ope  f3iad s rmnmp t)altomo oydlpt  nei;t s2trxo iodlpenlnviltfartaxm nu1optnio3tadlm uanvp t)tlenxf3ta1lmD  nvol( srtr(opoudop n fciasf 2umu  no1alxn oetasls2umn pnu0aetnxociodfatrlues s0sexrxmpio4aptn ncs s srtrxm ot1tpxoiociltfsDrl(ms u0 eermf to1la   nvs t0t2tr(m ny1oleelivsls srua(  ;t4ole  octysfs ra(vpn(4teenmo to1fp e i ol( seur(mpiu1ol   ivi ( s2taurpno0olenio3iadlmDrl(vo (0 rxomrctadfpteanvols0 2trirpnodalenlivta( sDur(monu1tet if3iadla2uluvo t) lxrmr3oatfpDrlnvsls)s2xo(rpnydap  lneiat) 2ta(  ;u0tpx ioeilsls2rl(vp;(4arermocta1lp  li i t)s2umxm3ny4lmtemfesl( sDtr( ooo0opxnif3iyt aDuauvp;u)aeeoxo oatopD  nvo (0s2xr(r oodolte ieiat)a2rauroou0altniicilsls2em( snt)alxnio totop eanei;t0trur(r iydlmtelfvtatfa2rrurpou1tptnmf3ilsls2eauvs u0treoir3oodomtr uvi;(0seuoirpnydolt lncilt sDtmxronu1aleo f3iadfs2ua(mp u0 rxoxo ty1oaDr n i ()t2xoio3ny4ll nlfct s a2trum oo1tptnmoeiyd sDuauvp;t)tlxrmf3ta1fpD  nvilt  rxrxmpiydlm  mfcils a2ur(  nt4tpxoio3iys a ra( s t)trenircoa1fpD anvs;t0t2um(rpnodop n fet t sDtmu  nt1alt moeiys s uau p;t)texnir3tatom  lies t0setr(r oy4omeelfvi s  2tax  nt0tpe  feiatlmDea(von(0altrxo3iydlpt an s;s0 ruoxr3no1aptnmiet (f 2rm( p;o4olx if3ias mDum(mo t)teerxf3iotoa rau i s)t2xo(o3nydom   ivi tf rrmurpnu1tlx iiciadla2uau p;t4arenir3tydom elivs;s0trur(m3oudlltn nvils) 2ta(moou0tpt mfctltlm rm( o;t4trtnif3iadfatean ols) eumxo oo1omt  fcia(f 2um( oot1opeoif3iltfa2ra(mpnu0aeeomr iytfmDeluvo;(0 rtrxm3iu1apte nvsatfaDrmumpot0tpxo fcils s2umumo u)altrxr3iodopDeauvs;t0teuoxmpiu4ll nmncils)arrrxront0oleo ietyt s2rl( snt4arxrxo oydoat lneo s0srumio oy4lme lfvtas srrrurp;t0tetnmf3iys m uaumont4texrxo3iadlpteln ils) etmirpno1lpeeliet s)sDrr(  oo0apxn f3ias aDrmumpnu4arxrif to1lmtr uvs (  2uoxm oy4ole micils  Duru oot4aetnifctlsfa2ea(mp;() eermf3oy1lmt  nei;t trtr(r3ny1lpee ivtl(  rtr(  ou0alen iciat a umnmo;()aeerio3iotfmt auvslt s2xmxrpiydomteliciat)aDtrx pot4aptomfciltfa2ra( s t0tlenifciy1om rau ols  rtr(o3io1altemnci tf ruaxmoot0tpx mociyt mDemnmo () ltnif iatfaDeau ol()trxmxr3iu1openmnetl(fsDta(mp;o4ole ioctadfm2umnvo;(4aexrmfcia1fpDranvs;t texo(m iu1ame  fcils arumu poo4aeeo f3iytlm umums t)trxomo3ty1fptrlnvs t0t2ur(o3nydol elics s  Dta(rp;u1aetoiicils aDumu o t0 ltrio todomtrlnvols)s2tm(m nudlpenlncsatfs2ur(root1olto fciatfsDua(vo;(4 exomf3totfpt  uvs;s  euoir3iu4aptelivsl(f 2rmurpou0alen o3ilsfm2rmuvonu)texrir3oy1fmD  nvols truo(m3ou4optnlnvs ()a2ta( p;t0aex  fcilslaDumuvs (0alxoio oodoaDe ivs (  2umxr ou1lm n nct s  Drmxrp;t4tptomoctldlm2rmu s u0 etnxociadlm  an sl(0 rxrxo ou4lm  livi t)aDrmur ou1aexnioeiysfm rlumo;(4aeermr oodlaDrlueolt t2toio iu1lme lnctatfaDurumpnu4oeeomicilsla2rauvo t4altrxo3tadlmtrln s () exm(opoo4omenmfvsat  2um(rooo0oetomo3iatfs2rmn o;() rxnmo3ta1fpD ln ol(0 exr(m3ou1amt mict ( s2tru p;u4teeo o3ildfaDrmums;u0 eenircia1fa rauvi ( t2urio ou4al  mivta( s2rmxrp;o1aex ifciltfm eaums;t4texoxfciodlm elnvols)s2umiopio1lpt lncia( sDua(  no1alxniiciyd m2eln o u0 ltrio3tydomtelu i s0t2tr(m3iy1altnlncs sf 2rr(  nt4tpe  fetld mDrmn p;t0aexrxo oatlp rlnvo;( t2uoim iodlp   fcil(fa2ua(mpou0tlenmf3iydla uau o;t0 exnmf ia1latrlnvs;s setmxr3iudamte net tfs2ua( poo1tetnif3iytlsDuluvo u)trtomrctytfptrlnesls0trxmio oo1ap e nviasf 2uau  ;o4olenmocilt m ua(vs;()alenir3oo1omDrauvi;t0setm(mpoudopeelivtatfsrrmx oou4oee moeilsfa rmn p;(0trtomfciytlmt lnes ( trxrxr ny1lptn fci (fsrtm(mooo1opto fctyt aDranvs;t0aetrmrcoadfpteauvi;s0sexoxmpnodole lnvi t  ruru  ou1oee  fctas aDrlnmp u0 reoif3ia1fm elnesls0trto(o3oodlle lfetasf 2rr(m ;o4oetomfciytfm uauvs;()tlerxf3tadfate uvsls t2xriopny1omenmivta(  rraxr ot4tlxomoeiadfa2uau ont0 exoxo iytlmt lu ol()teuoxr no1om n icil(  Drmurono4aetomf3tyd m eanvs;(4trxoif oatfmDrau ol(0 rtmxmpoudlpe lfciltfs2tru oot4ape  fctytfaDemnmp ()arxrxf iadfa  ai s (0 eurxrpoo4ame lfei s sDraxmp;t1apenioeiad a2ean p t) rxoif3ia1fpt lu o;(0s2to(o io4op   fct t)aDuaurp;u0tptnmi3iad s2rlu snt)tetnir tatlaDe nes;s)tetrirpoodlltnmfeslt sDuaxmonu0teeo i3iat m2umump;t)tetrxr3oo1lmD lueol(0srxoir3io4lp elnei ( arua(m nu0opeo oeiat m2elump;u0 lxoif ta1oa rln o;()t2trim3no1llenmfvt sfsrum(mp;o0olenio3ilt s2rlums;u0 rtnmr iodlp ean ols0sexrimpnodaltemnei t)a2tr(mont4apxomfeiys sDem(vp (4 exrxr3oydlpteai s t trto(mpoy1amt  ncs s artrx p;t1teeomfciytla uln o (4tlxrio3iatoa  ai olt0 eum(rpoudom   fvt sf rrrxmono1aet ifctldlsDeau snt0tetrir tatlmDr nvs;s) exrxr3ou4amenlfvi t  rtmxm ou1alx  o3iad s2rm( o;()texrio ty1fp ean sl(0setm(opiy4oleemnet t artmump;o0tpxnmf3tas m2ranmpnt) reoxf3oy1fp  lnvols0 exrxmpnudol  mivs ( aDum(r ou4texoiieiltfa2ranmonu0arxoio oy1lpDeau s t0 2trxmpou4amte feiat) Durxmpnt1tpto oetadfm2rau p t)trenxf3iy1lptelueslt) etoxo3oo1aleelnctlsfsrrru oot4teen i3iat s elnvp;u4 eenmocoy1fp r nesls)tetoxr iu1altnlncs sfs2ta(r no4tle ii3tasfs ul(mo (4 reomf3todoa rlieo;()tetoxm nydomenlfcs t)sDtru  oo0tleoif3tadlaDel(msn() rxomo3oatlp  auei t  rtr(m oodam  lfvi (  2raxr oo1aexomf3tltfsDulnms;(4 etniocoa1lm  ai o;() 2um(r io1opt lfctas  rtaxrono0opxnifeiadls2uaumsnt0artnxf todoaD ai il(0seto(o oo1lp  lfctlsf rtm(m ;u0oet  i3tytlm eaump;()artoifcoytfaDrlueo;s trxrir iy4alt liviltfaDtr(  nt0tlxn feiat m umu o u4 ltrxr3oa1fmD  uvo;s) eumxrpnu4om nmics t)srra(rpno4ape ii3tyt s eaumo;(0tltnmr3iadoaDraneols srurio no1ope lnesls) 2umur ;t1tpenifctlt m2rmn s;(0 etnxf iy1fm  lneo ( t2urir3oudale mfct ( s2trxr nu1opt  feiytfa2umuvpnu0tlxoxf to1fa rai olt) 2tmxm3ny4om nmnci () rrm( pno0aex io3iatfm emnvpnt) etoifciydfm ean i;() 2urim3no1lm elncils s2rm(mpou4texoiictldfs uaumsnt4alxrmocty1fmteanei s tetr(o nydaltn nei (  2tau  ou4oltn oeildfsDua( s;(4 ltnif3oo1optr ivs s tetmio iu4op  licsatfaDua(r ou4oleoii3ildfs emn o u)areoxo iy1fp eaueil( srtoir3nudoptnmnci sfs2rru pno0alt  fetltfm2umuvo u) eerxo todopteanvi;(0t2xmxr iydome mivtl( sDumu ono0aexomfetysls2um(msnu4 rermf oy1fmtr uvs;t  ruoimpoudomeemicslt  rrrum ou1tptnmoetatla rm( o;u0trxnmfcio1fm  anvolt t2tr(mpnu4omtnmncia(fs2ra(mo;t0oet mfctadfa uauvo;u4 leoxf3oo1oaDrlnes ( seuoxmpno4ol   nctat) 2umx poo0tltnii3iyt a uan s;u4 renxfcoodfa rlies ( teumxrpiy1oltemncta(fsrum(ro;o4alx  f3iydlm rau s;u)trxoio tatfpte nvo ( setr(m3oy1lpenliet t srraxmonu1oetnii3iydfaDranmpnu)texrir ootfmDeliei s) exrim3oy4lp n iei ( s2trxrp;o4alto ociadls elu p;(0 etoir iatlptran s s0srur(opiu4al  livilsfa2uaumono1tlto ietytfm umnmo t4altnmocoadfmt lueslt  etr(opiu1om elfeil(  2rmxr nu0opx mo3tatla uauvo (0teenxo3oodlptelu i t tetoir nydop   ieia()sDurump;t1oexnmietldla ea(vp;()treoxfcoydoaD aies;s0 2xoxr iudlp  mfcta() Draxm ou4alen oeildlaDuaumpnu0 exriocty1om  lueil(0 2xm(m3iodalenmfcs sfa2tr(ro;u4alx mo3ilsfsDrmnvs (4trtnmrciadomDr ies s teurio3ou4ol   nesa() Drrum oo1apxo icildls2ra(mon(0trxrir io1om e ies;t0trtrxm nu1ale  ietlt  rur( p;t4aeeniocias m2rlnmo;(0tetnxo3todlpDrluvo;s)tetmxo3oodlmeelfvsl(  2tmxr ;u0aptomf3tat mDrmn on(0 etomo3io1fptrlivi s0setr(opiu4optemfcsltfarrr(rp;o1tpt ifctasfm rlumpn()altoifciotfaDrln o;s0trxm(m3iu1ol emfeslt) rum( o;o1ape  ociaslaDrmn o t) rxoif3todfpD lnvsl()s2uoxo3oo4omeelivsat artau pnu0ale iietls sDem(mpnt0 etrifciodlmteluvsl(0t2xm(opiu4opt lfesasfsDraump;u4tpeomiciasfa2umnvsn() exoxo tatoa rln ols  rtrim oo4am   ivi t) 2uaum nu1aeenmociys mDra( s;u4arxrxf iadfp rln olt)t2uoiopoodapeelnci s srrrxmono4tetnio3iytlm ra( s t) rtnmr iadfat an o;() rtmxrpou1lpenmfeta()srra(m nu0oltn f3iyslm uluvs u)trenif3oydfp  livo ( t2umxo nudolte neil()aDrm(m ;t1oexo ocilt s2umnvp t4tetriociatoate ueilt0trxrio nydal e fvsatfaDtmx o;u0oeen octytfaDranmsn(4texomrctadlmD an i;t)srxo(o3oodll   nvil(fs2urxmpot1ope ifctydlm2ranvonu) lxnif3iydfpDe iei;s) rurirpio1ol   fciat aDuaxro;u0oeen o3tysfa umums;() ltnif to1lmt anvi;() ruoxm oydopt mivt t)aDuax o;o4tpeomf3iatfs ulnms;u) etoxrcoydomte uvil()tetrxm no1opeelfesas)a2rrum nt0tet  fetysfsDrln onu0 ltomo oydlpt  uesl(0tetm(mpoy1apt  fcslt)a2uaum ;o0tptoioetlsla2ranmonu0texnio tydlpt lues;s0 2urxr3oy1op   icilt) 2ra(ro;o0tlt ifctld a ean p;u) lenmf3ootomDeanes;(0s2ur(m oy1lmteliet s artru  ;t4olto f3iltlmDranvp (0 eermfcoydomtr u o;( srtoim3nodam n ictl(f 2umxrono1aex ifciadls rmu on(4teenxo3oatopte nvilt)srxrxm3nodaptemfvi t  2raxmp;o1aexomf3tatls eaumpnu) leoir tytfa elivo;s truoxo ny4apeelnvsasfs2tmxmpou1oexnif3iasfmDrm(msnu0texnir3iadoatean o;()srxrxrpnu4lm eliesasf rra(r ;o1olt moctaslm ra( o u0 etrmr oadoat  ieils)srtrir3ou1lptn nvi ( artau  ;t0optnmociltlm eau onu0 exnxo3iy1fat ln il() rtr(opnu1omeemncslt  Duaxrooo4tpe ioctyd a rl( o;()aexnir3iodla e u s;t0texo(o3iu1lptelfcilsfa2trxrp;u0aee ii3iydls2em(vpnt0trtrxf3totfm rluvil()s2uo(o nydamt mfvt t a2uau pnu4optnif3iad m eanvpn()trenmo iy1op e ueo;s  rxo(m3iodoltn fcsltfaDurumpnt4oexomieiydla ra(ms;() rxomfciatlmDranvs t srxrir3iu4om nmncsa(f rurx  oo1tlxn i3iadfaDumuvs u0trerif ia1fpD lnei t)s2urir oydoptnlfesas)sDrax ooo1tlx  ictyslsDeau p;u0 eenir to1om  an o;() euo(opnydapt  icsa(f 2ta(mono4tpe miciytfmDraumo t0alenio ia1opteli ilt)teumxo3ny4ame lncils)arrmx oot1tetnmfctlsla2ul(vo;t0tetnmociy1fa e ivil( s2uoxo3no4opte nesl() rtmur nt1apeniiciltfaDrmnvp;u0 rxriocootlpDe n o s0srxm(m oydllt  ieia()sDtrxrpno4aetoiocildfsDumnvp;(4tltrxfcootfmt li o t srxriopio4ame livsatfaDtmxr ou0tleoioetydfm ra(vp;t0arxoiociotomtelues;(  rxoim oo1op   nvia()sDrrxm oo4alen oetasfm2ra(vp t)tlxrxr3tatfatr u sl(0 rtriopnu4lmte nesas aDrmur ot4alenifciatls2rmu sn() rxoxr3tatfpteanvsl( srtm(o3nu4ol elfeia(f Drm(rpoo4tpxo i3iadfs2ua(ms t)tltoio iytfm eai slt)trxoxo ou4ame mfei tfsDtrxm ;o0optnioctlslsDumumo u)altnmo to1faD lues;s0teuoxr ou1ope  fesl(f 2rrx ono4tee mf3ild m rlump;t4arenxo iydom   ueo;s0trxoxo iu1lm  lieilt)a2ra(rono0apxnmociysls ea(vp t)trxrxfcoo1fate ivo ()s2xmxr ny1ll nmictat arumx ooo1tetomocilsfm2eln pnt4 lxnxrciodlpD ln o;t)setoim oo1opee fvtltf 2ta(rooo4opt  i3iadlm2rlnvsnt0alxrir3iatla rauvsl( s2tmxm ny1al  mfesat) rur(mpnt1aexnioeiydla2um( o;() lenxo ty1op elivs;s0 2xm(m oydlmenlics s artau p;u4tet mf3ild mDumu snu0teerifcoo1la  luvi;s)t2tmimpiu4am emnciltf 2urxmp;o4tpto fcilsla2rm( ont) ltoif oytomtraneo;t0t2to(opoo1aleelfcil()sruaxm ou0tlxnio3iydfs ulnmp u0 etrifctadlaD aueols t2tr(m nodam n ivtltf rum(root4tlt  f3tyslaDrm(vs;u) lenio3tatfp e i i;t t2tm(o3nudolee fciasf rurxr nu0aeto ieiad mDranms (0 rerxo oodlmtr u o;t)teurxopou1omtn nctlsfaDrr(rooo1altoio3iasls2ul(mont) exrirctytoatr ivsls)t2xoxo iu1aptnmietat)arrax  ;o1aeeomo3tyd s2rln pnt)tetoxf3oatoa eaies;(  eurim3oo1omeelnvias)s2trurooo4opxoioetatlm umumpn(4aeeomrciodop  aueils) 2uoimpio4alenlnvsltf Drau ont0olen o3ildla eanmpnu0 lxnxfciotfm eli o s teur(opnodlmenlfes (farumump;t0oeenmfetys m2ua(mpnu4tlermf tydfatrluvi;s) etoxm iydam elnvsas  2tr(m nu4teeniieildfa eaums;t0aeenxo iytomtraivs;s0 eurio iy4lpeelfeta(  Durxrooo1oeto f3ildlaDra(vp u4aexomfcoy1fp  ai o t) etrio nydlm  lneta(fa2ta(rpnt4oltnmociatlmDrl(mp u4 rtnmocoodlmtelueilt)sruoxo ny4lmenmieia(  Drru ooo1olxo o3ilslaDumn p u4 ltrmfcoydoaDelu s (  rtm(opno4olen neilt) Dumxmpno0apxnmfetlt s2rluvs;t4tlerio totfa   neo;()s2xoxrpny4lleemicil()artm(rp;o1tex  fciadfm2elumont0arenxf oadlmDean i;t) rtoxr3ny1aptnmnci ()a2uaurooo1alenioeiasfm2rmnmon(4 rxnmf3oatlm  lueols)t2tm(o oo4oltn fvs t)sDrr(m ou0tpx  i3tatlm ua(vont0 rtnmo3iydlp  ai s t0 2trxm iudopeelfct ( aDur( p;u4tleoiictydfs rmuvp u4trxnmfcoy1late neo;()srxoxrpoodlm n icils)aDumu pnu4opxnmieildlm ul( p;t0tetnir3ia1lp elueilt) 2to(o3iy1ap e fcsl( srtmxrp;o1aeto o3iydlmDulums;u4trtnxf3iytlpD lu ils0texm(o3ny4al emnesl( sDumum ;o1olxniieiyslm2um( pnu) rtoxr ty1lp elu o ()srtoir nu1lpee fet t  rta(mpou0alx miciasls em( o;(4 rtrxo3oydfptr nei t0srxmxm nydllt mfvi sfaDrax p;t0aptn i3tat mDem(vonu0 eerxo todopD  ivils t2xrirpiodap  lncilt)artmxr nt0opxoioeiat sDemn on()arxnif3oydlmte i i;()s2xm(rpoy4lpt lfcs t)srrr( pot1tpx  i3tyt sDel(mp t)tetrmocoadopD luvo;s srxoxmpio4opt  ncsa(farrax ooo1tptnmietldlmDrm( sn(0arxnif3iytlm e nvsl()tetr(r3oy4apt lfcsa(  Drauroot0ale ioeiyt mDeanvp;() eenir3iy1fmtelueo;t0s2urir no1alen nvta()artau  nt0openmietlt aDem(mpnu0 ltrir iy1fm r iei t texr(r3iudal nlies ( s2rm(mo;o0aee  fcilt m2ulu s;t0 etoif3iadlm e ivol(0sruoio no4llee nvs (fs2rm(rono0tlen feiydlm emuvp;t)arenmocoy1omD anvo;s)srtoio iodapen nes t  2rmurp;t4tpeo fetadfs ulumo;t)tltomr oydlpDr i slt0srtmxopnodole  ncsa(farurx  nu0oeto o3iad s2elnvp;u4tlxoioctatoa r neol(0trtoim3oodop nlieiatfa2umxm oo0alx ii3iatlmDeanvo t0arxrmr tadoatelueo;s)t2toim oo1ome lfvsa( srtaumpoo4olenmi3iadla rl( s t4 reomfcoadlpt livol() 2um(r3nu4ame  ies tfs2trxr oo0apxn fcild mDul( s (0alxoxrciotlmt aiei;s0 2umxrpoydamt mnet t) 2raurpoo0teeomoeildfs2uau s;(4 ltoio3tytoat  nei;(0sexmxopou4ll emivsltfsrua( ooo1tptnioetytla2rlnmpn(0altrmr3tatfpD lueol() rumiopoydope liviat aDtm(ronu1opt ioetasfm ea(mpn()texnmo3tatfat  n o;() etm(r oy1omt mivtl()srrm(r ;o1apeoioeiad a uaump (0 etrmfcia1lpt  n s;(  2ur(m oodale lnci sf Dra(mpot0tlen fetytlm rl( o u0tlenio todom  livi;t teuoiopny4ol emfctat)a2tau oot0oexn ocildfa rmn p;t0 rtomf oatoa r ies s)seuoxr3nudlm nlfei (  2urxmono1alxn fctytls2um( onu4texrmr3totfm  anvi;s  2uoxr3io1al nmnetls  Dumx pno4altoiietld a2uanvp () rerif tadlmt lnei;t0t2tr(opno4lltn fvt (  2tmx o;u0olen ociasls2ulnvo;u4 eeomf3to1fmDr u slt srxoxopnodole  fet tf Dumxro;u0tlxn i3tyt s el( o;t0treoxf ta1opteauei t0srtr(r3no4apeelfetas)s2tmxrpno4opxnmfeilsfm2um(vs;u)aeeomr oa1fatrli slt  rxm(o oudlmt lfcsltfaDuru pnt0open ieildfm2ranvs u)trtrxocoatfaDraueo ( t2xoio iy4omtnmfvsl()a2uau oou4oeenmiciatfmDumn p;t4tlenmf3iy1fpDe n o t t2xmxmpno1al  licsa() rum(m nu1tpe iociat m2rlnmo (0aexnxf3tatomDeaivo;(  euoxm nodal n fci ()a2ra(rpot0tlxoioeiydfm2el( snu0tetrmo oa1fateluvs t s2xrxmpiudomtnlicsls)artrxm no4olenioetas s2um(vp (0 rxnmo3tytoa raiei;(0sexr(o ou4ll n nvt t)aDtm(r ;u1optnii3iat m ul(mp;u0tltnio iodfm e n i;() ruoxr3iu4op emnvsa(f rrrurpno0tpxo ieiatlm umnvpnu0 rtoxfcoy1lmt auvi;t)t2xmxrpnu4alte fes tf Drmurpnu0tlxniiciltlm rl(mp t)tetrmr3tadopt ln o (0texoxm ou1llt mivsl(f rtrumoot0alt mictytls2elnmsnt0alermfciotlpt anvil( tetmxm3oy1am  lfvi s  Drmxm ou1aptoii3iyt m2uauvs;()trxoio3tydlmDelueol()srtm(m3io4ll n ivias)s2tmu pno1oexo fetatfa elnvs;t4trxrmf3oy1lpDe u i;t srumxrpiodlpenmfciat aDtax p;o4oeenii3iydls2rm(mp ()aeerir oodfm  aueo;t tetrim3iodoptn iesl()a2tax  no4oleomf3iatla eau pnu4aleoifcta1oatr uei;t0 rxmim3iydlptn nvs s)srraxr nu1oltomo3tasla rmuvo t)teeoiocoydopte nesls setmim iy4lme miet tfs2ra(m ;t0opx mfeiydla rauvs u)texoxrcootop eln slt  2xmxopoodameelneiat  ruauroou0tpe mieiys m ean snu4altnmr totfmDrlnvolt0 exmxmpnydap nmivtas a2rrurooo0aeeo oetld sDra(monu0 rxnir3tydlm   ueslt0s2tmxo nu1al e iet t s2um( ooo0olt mfetadlmDem(mo;t)tetnmociatlpDraivi;t0 rxoio3no1opeelnctas) Dur(mp;t1opxnifciad m2elnmpnu)trxnxo to1fa e nei s  rtmiopio1amt  nvsltfartmx  ;o4aee ifeiatls rlu s;u)texrmr tytoaDe ivi;s0 rto(opoy4apenliviltfsDuaxr nt4tltoii3tatfm em(mp t0altnxo3ootfp  lnvs t trxrxmpiodll nlnet t aruaur ;u1olen ictlt sDumu p;t4trxomrciy1op ranvsl()t2umirpou1lmt licil( srua(monu1teeomfctldfm um( onu0arenio iydfmteaies (0sexoim3oodll nlfctltf Dua( poo4aptomieiatla uau pnu0arenmo3oo1oaD  u s;s)s2xmxo ou1llte ieia() 2uau ont1aexo iciysfm2em( o u)trxomoctydlmDrau s;s)s2ur(o3no1ameemietl() rrau onu0aleo i3tlsla2ea(vs;t0trtnmoctatlmt ln i s0sexm(r3ny1lmt  nvtlt) Drmumonu0aee  ocilsfa2ean snu4teenif oo1opt luei;()s2xmir3iu4olt licsasfaDum( p;t1aee mfetys a rauvs u4alxrif iotoa  an s;s tetr(opnydlm nlnvtlsf rua(r ou0tlxo iciys a umn p;u)arxnxr3iotlpDraieo;t)t2xrxm oy4ap   fvi sfartax pnu1tpeoioctat a eaump;t4trxoxrctatlaDr ieo ()trxoxrpiy4ll  mivs s)s2tax pnt0tlt  fciytfs rlnvs;u4 ltnxf totfm  lnvilt) eur(r iy4lp n nvi () 2rax o;u1tleoii3ils a2ul( snt)alxnir3iatfpDrlivi s)trumir3iydalte feiatfa2rm( ont0tetomictlt a rmn pnu0arxnif3totomte u ols srumio3oodome lietas) ruaxm oo0olx if3ild mDel(mo;t4 etomo iatopDr n s;t0srxmxm iodoltnlfvilt)s2tmump;t1alx mfctyd sDeauvs;t0trtrirciy1lmt lu o;t  etoir3nudlm  mnei ( a2tmur ;o1oetn f3tad m em(vo;t4tlxrif ia1laDeanvils0 etoiopoydll nmfei (f rta(  nt1teen oeiysla eaump;t0trxrxo iydop e n ols0seumxm3nu1alte feslt s2taumooo4tee iieiytls2ua(vp;t4 leoir3tydlpD aivi;t)srxoio3nu1lmtemnetlsfaDtr(ronu4alt mfciytla uln o;u0arxnif oo1omD  nvs;(0t2uoxr3nudlp  mnviat  rtrum ;o4apt  ieiltls ra(msnu4altnio ty1lm elnvs s) 2um(rpoudlmt miei s)srrmu poo1ale if3iatlaDrmnmont4 lenio3tytop ranvilt) euoirpoudalen fcias  Dtmxmoot4alen fcild m ranvpn(0 lxrxr io1lpDr n s t  exm(r3iy4lm   fciltfarrr(m oo1tex  ociatfa umumsn() lxoiociatoaDe uei;s  2tmxr nu1optemfvtlsfartm(roou1aleomfcilslm2rln p u)aleoxo todfmtrlies (0t2urxopny1ol  liet s  2taumont1apxnmociad m2rmnvp u4arxnmo iotfpDraues;(0 rur(opoydomenmivt () 2urxr oo0alt moetadfaDrmumon()aetomrcio1opt an olt0setoio3oy1al n nvs tfaDrr( o;t4tpxnifciadfa emuvp;t4 ltnmo ia1faDeln olt0 rtoimpnodamen fci t a2urxm ou4alx ifciytlm rau s (4aetrxocoo1laDranvsl(0srur(m3iu1apenmiet s)a2rr( ont1oetn iciad m rm(mpnt)texrif totlm e neo;s trur(r oudll nlies sf Duau  oo1tpxoiociydfmDean pn(4altoircoo1fp eanei (0s2uoxo iy1op n fci (faDum(mpot1apx mfeiyslm2rl( o t4aetnirctytfm  an sl(0 eum(r nu1alenmnvtls sDrrumpot4tlxnifciadlaDulu s ()trxrxo3tatlmteau s s)t2uoirpio1ale lfei sfsrtrump;o4altnmf3iasfm rlumo;(4 rtrmf oy1faDr uvi s0trxo(rpoy1omt mfcs tfsruaurp;o1openmiciaslm2rln o;(0 rtnxo3oodfa  lieo s0s2tmxmpiu4al  lfet t  Dumuro;o0olenmfeias mDua(vp (4trxrmr oo1oaDe uei t)sexrxm3iy4lpeelfeslt)srtaur ;t0olxomictys m emn p u0trtoir oatomD ai ils0seur(opiy1ll e fcslt sDraum ;t1opxnmi3iytfaDua(ms () eenxf3tatomD lieo s t2trxrpiy1oleemnet t  Dtrxrpnu4aleo ocildlm2eaums u)arxrxrcoodoatrlnvo;t s2xmimpiu1lpe livs ()aDrmur ou4apxomfctls sDeanmp t0 lenmo3oadlpDe i ol()t2tmir3nu4alee icta( sDuaxm nt1tltoii3ild a uaumonu)aleoxrciytlpDr ues;()t2ur(m io4lm emfciltfsrtm(mpoo0tptomoeiltfs2um(vo;(4tlxnxfcty1lmDeauvi s) etm(m3nodlp  lfeslsf Duaxmpno0tpeo oetldfa2umumo;t)texnxfcootlmteau o s  etmim io1lleelivtlt)sDtaum no4texoii3ilsfm2rmu onu0 lxnxr3iydoatelieolt0s2urxr iydamtnmivtl() rrax pnt4ale ii3tatls umnvont) eenio oa1fmteaieo;( trxrim3oudomen iviat)sDraxm ;t0aptnmoctys sDrmu s u) rtrxr tadomD li s;s0sruoxm oudlpte fcsl()s2umumo;o0tlxo o3tls s emnmo;t) exniociydlptrlieo;( teum(m3oydll n nvt (  rrm(m no4tlxnioctls s2umnvs;u0trtrxo to1faD ai i;s0srtrim nu1ap e fvsltf 2urx pnu1oetniieiysfa uanvo;u4arxoir3oa1omD  n ol()t2toio ou1lmt lncslt)srraum oo1apto ietldls um(vsnu)altoxocoo1lmDraueils)truoxmpny1amen iet t) rtmx oot1tee mo3iytfm eau o t) etoxr3io1omtr ivo () rxo(r3iudalee ictls)a2taumoou1opxoif3taslaDeanmo;()areomr ty1lptraivols0texr(r3iodlmtnmnet t  2ua( p;o0optnmoeiasfa eanvont) ltrxr3totfmDr uvo ()teto(m oodlme  ivtat)s2raxrpot0altnio3ils a2emnms u4 rtrmr iytlptrau o ( tetm(o3iydamtelfeslt) Dtmurpnu4apxomfeils aDuanms (4artnxf tytfpD ai olt)srtrir nu4ll   nesas srrr( pnt4tpxniociasfs2rlnmp u0 rtnxfcoydfpte i o;(0 rxmxo nodlp nmnct s sDrax  ot4aex  ictadfa ra(vsn(0arxrio io1oaDr u s;s texrxr3nu1ol n fvilt)aDra(rp;o1aexo f3tltla2uluvs t4tltrxo3iodla raueol(0 rurxrpou4altemfeil(fs2tm( pot4oltnmociys mDranms;() ltoif iytoa eaivi;t0s2umxo3no1ol n iesat) 2tmxr nt0altn fcilsfs2rl( o;t)arxoxo oodoate u sl( t2toimpnydame lnvsas)s2rr(r ;u1texoiiciadfs emn pnu0 lxrmo oydfptranes ()s2trxr3iy4ap elneias  2umx o;o0olxo f3tydlsDra(von(0tltoio tatoaD  uvolt0setoxo3iu1llenmfviltfa2raxmp;t1oex  ociydlsDumuvon()tlxrxrcio1fatranvols srtr(m oydlpe  nct s)a2tr(rpno4texoifciadfm eanmsnu)aleoirciatfp eli i;()srxrir3iy4alen iei t) rra(root1teeoifeils aDranmont4aexnxo3iadlmD auvo;s  exmio no1al e iesasf rrmx ono4tpeo ietaslm2ea(vp;u) etnxo3iatlp r ivi;t0 exm(opoy4alt mnvils) 2uru onu0oltn octadfs2rmu s;u0alermrciatlmt  ues s0 2ur(mpno4lmeemicsltf 2trxm ou0olxomo3iasfmDemnvpnu)alxrif3oy1omt lnvs;(0srtrxrpou1llte nvs s aDtm(r ;o0teto feiat m ranvs;t0 ltomf3oo1fa rai o ()teuoio3no1om n fvil()s2taxr ot0tlxniociatfaDraump;t) rerxr oo1fm raivi;() 2xrxm ou4omte fcslt)aDurx ono4oleniociyd sDeanmo u4trtnxf ia1omte nvilt)s2xoiopou1olt mfvt s)sDur( onu4ale io3iyd sDrlnmsnt4 etrxf3oatfm raieo s)setmxo ny1olee nvsa()aDum(mo;o4opx  feild sDumu pn(0 exrxf3oatfm rai i s) ruoxr3io1op   icta( s2umumo;o4tex ii3iaslsDumn pnu0artnmr iotfm r uvi s0 2urxr io1alte fes (fsrum(mo;t0oltn i3iat s2rm(vp t)aeenxo3iadfmDeauei;s) 2tm(opio4ll emfetltfsrurxr no4optn o3iyslaDum(vo t4 lenirctatfp  an i t0sexmxm ny4omt mnesl(f 2rm(  ;t0olxoio3tltlsDuluvs t)trerif3oa1la raneo;s  2trxmpiu4omen ics t)s2urx  ;o4oexnmictas a um(vp;()alxoxr iatoa  luvo;t) etoxmpiu4aptnlfvsls  Duaxro;t4alxnmiciasls2rmuvon(0alxoio3oy1laDeanvi () exrimpny4oltn ncs s  rum(mont4ope io3iys a rlnvp (0tetoifciydlpt auvi;()srtrio3oo4amtelnetl()aDuaxro;t4tlx mfcildls2emu o (4teenmo iadfmtelues s  eto(r io4am elnct (f 2raum ;o4olto f3iytfs2ul(vsn(0 eerxf oa1fm raivil() exo(r oodam   ietl(  2uaxrpno0apt ifetad mDrmn p;() ltrmo oa1lmtr uvi;s) rxmimpny1optn ivsas a2raur oo1altn o3iyslm em(vo u)trerxfcoytfmteaivols) 2toxo3nu4opeemnvsltf 2tmur ou4ale moeiatlmDuaums;t4alxnif3ty1op elnvs (  2urxmpnu4op n ivi s)srta(m nu1apeoiieiysfa elu o t0 eeoif ty1lmDraueo s) euoxr3io1om nlnvilsfsrtrumpot4alx ioetysfm rlu o (0 ltoio iodom r uvilt s2xrxm3iy1llenlietltfs2tm(mpou0opxoio3ias aDrlnmon(4 ltrioctytlm e ivslt)t2uoirpiodllen fesls  Dtmu poo0alen octadfsDua( s;(0 rxoio3io1fmDe nvs s)s2xmimpoo4lpenlnvtatfsrum(m ;o1texnioctat a uan p;u4 etoircoatop rluvs;() rxm(rpoudapeemnvil()srurxrp;u4tpe iieiys a elnvpn(4aetrxf iatoptrli i;s sruo(r iy4amt lfctas) Drmumont4tlenmoeilt aDumuvpnt4artrxf3ta1lptr u s;(0tetrxr3iu4am elietl(  Drrx p;o4apx mieias sDrmumpnu) renxo3tatlp   nvs (0 eurxo3ou4lme lfetas  Duaxm ;o0apen fetasla ul(vp (0 reoif3ta1fateanes;t0texoio3no1omt  nvs (fsrrm(r ;u1oltnioctytfs2um(msn()treoxf3ootlat auvils)setoxm3no1lm  lietatfs2rru pno1tlenioeils mDumnmp;u0 lxrir ia1oate n o;s  etr(mpnudoltnmfcil()s2rmxrpoo0tpxomietytls eaumsnu4tetrmr3iytomte uvs;( s2xrxm iu1lp  lfvslsfs2rax pnu4tpxn fctyd s eau pn()tltoifcoatlp  lnei t) ruoxr3nydam emicsa()aDrm(r nt1optomfetld a2eaumo;u) lxoir iatfa  ln o;() 2uo(rpnu4omt lnvsatfarra( o;o0apxnii3tatls2emnvon(0aexomf iatlmD aivi;t)teuoxo oy1om nlnvsls aDurx ono1tetniiciydfm um(vs (0altnxrcio1oaDrlnvs s) exrxm3iodamtemnciatfa2ta(ro;u0alxoifciyd sDel(von(4alxnmo3iatom rlu i t tetrirpoo1llt licil() Drrxr ;u1opxo ietatla2emu o;t4 lxnxf oatoaDraneols  rxr(mpnudlpt lfvt ()srumu  ;t1tpxnii3ildfs um(mp u0 rxomo oytlmDeaivo ()srxoxm3oudolenlfesl() 2rr(m ;u1tpxomfctaslm ra(mp u4tltnxr3ia1fpte ieo (  2triopoy4am   ncta( aruau p;u1apeo ociyt s umnvpnt0 lenir iodlmteaieo;()s2tmxmpno1lm nlivsl(fa2umxm ou0tltnmi3ildls em(vo ()aetrmo3iotlatrluvol(  etrim3iu4opeemfvi t)sDurx ont1tex moeilslm ulnvs;(4trxnxo ta1opDeanes t srxrxo3io4altnlfctls arua(  nu1aeeoifciatfs elnms;()aexoifcoodomt  ueols  rtoir iu4ap n fct sfa2ur(ro;u4tpt mi3iys a emuvo;()texoxf totoat aneol(0texo(r io4apenmfesls  Durxmpou0aleomfeiyd s2emumsnt4 renir3oytlp eanvilt s2trimpou4amt mnviat s2tr( poo0tpeoif3ilsfm umnmo u) lxnif todfmDeaivi s s2xrir oodamt mfct tf rrm(ronu1tpxomfcildls2ea(mp;(0areoxfcoa1op e ivolt)seuoxrpoudllt lict (fs2rr(r ;o0oeenif3ilsla um(mon(0 lxomr oatlmDe uvi ()seur(r3iudoltnmfviasfaDumx pnt0oexomf3tydlm2raumo;t4aexnmf tytopD  n i;(0 exmir ou1ole mfvtas)a2tr(mpoo4oltn oetyd s2um( snu) lenmocoo1lm  aivi () 2xm(o3io1lpe  fvtl( s2uaxronu4tltnmictaslm2em(vo;(0trtoxr oydoateauesl() eurxopio1lpt lfcil(fsDurxmpou1apxnii3iydfs rlumo;u) eeomo oatlptrai o ()setrxr3nodlpt lfct t arrru pnt1aetoifctasla2emnmp;(4 rxoxf3oydfatr nvslt0 eurirpou1omtnmnesa(f 2tmxmonu0olt  feiasls2rm(vp;(4trxnxr tadlmt lnes;s0setr(rpiodalte feia(f 2raxr no4tpe io3iyslsDraumon(4aeeomo iodfm rlu s;s s2xrim3oudlmee ies (f 2trumpnt4tpeoio3iatlsDelu o t) ltrxrcoatomt  uvi s0trxm(r3oo4om  mfesa(  Drr(r ;u0tpxnif3iat m2ra(vs t4trxoirciatfmD  nvi t t2toxo no4lptn fcilsfarta(rpnt0texoifciatla eauvo (0 eenxf3tadfpD liei;s0 eurirpou4lme  ieias)artmxmoou1opxoifciyd s2umnvp;u)arxomocoodoaDeaiei (0trurim3oy4ap   ieta(  ruax  ;u4oex mfetat m rlu p u0alxrmo oo1fmDeluvol(0srtrio ny1omtn ictltf 2tr( pot4oee miciadfsDranvonu)tlxrxr3oa1lpDraivsl()seurir oo4ol  mnciat)sDrau ooo1oee mociydla rm( p t)aetoio oatopDraivo;s t2xmxm iu1altemnvias)aDrm( p;t1opt mi3iyt s2emnmont4 ltnxf3ta1fm rli s;() rxoxr3ny1olenlnvt tf Dtmumoot0optomicildfm2eau o ()tetnxf ty1fpt  ivi;() exoxrpoodlle mfvs s  rrru  nu1ale mo3ilsfa2emnvp;(0trxoxrciytlatelnvo;s0 2xoxrpiudam n ieta(faDtmuro;t4alxomociytls eauvo;u0 rxnifciatfmDr nei;s t2xoim3ou4apt  neil(faDrmuroot1oeeoif3ild a emnmpnt0trxrmo3oa1fm  luvolt0trumxr3oy4al nlictas)sDtr(mooo0teeomf3tyslmDranmpnt)treomr ta1fpte ieolt0t2tmir3iy4optelicil(f 2urum ou4opx mfctytfm2uan pnt0arxnmr3iytlptelu s t0 2xr(o3ou1op nmivs s)s2tm( ono4tpenmocilt s2uaumpn()arxnmr oo1fmDelivi;(  eur(mpio1alenliet s)sDtr( pnt1texoiieiyd s2elu o;t4tlerxr oatfpDeli s;t)teurimpiy4lptnmnetlt)s2trxro;o1tleo oeildlm ul(mo;u)tetnxr to1lpD ai s;s0setm(opiudal emietat) 2raxrpno0tltomieiytfa2rl( p;(0tltnmr oo1omDe i s s)s2ur(o io4alt  fvil()srtr(ro;o4tptnmictas aDran sn()texrio3oo1op   n i t)sexr(mpnydlmtnmneia()aDtax oou4aee mi3ias s2um( pn(0trerirctadopDrai ilt)trumio ou4optnlfesat  rtrxm nu1opxomfctltls umnvo u4tetoxr3tatopDr ivo ()s2tm(m nu1altnmfci t srrr(m no0ope mfciatfa2eluvp (4trtrxo3oatla eaneol(  2xmxm no4om emiei t  Duaxr ;o4tetnmf3tlsla2uanmp;(4 rxrxfciy1laDelnvi;s t2tr(r nu1op e ietasfarra(root1oeeoif3ilsla2rmuvo ()aetnmrciy1lm r n ol( s2xoxo iu1al nlivilt aDrmx  nt4aexoifciaslaDea( s;(4teerircoy1lat lneo t) rurxmpoy4oltnlnvilsf rua( ono0aexnioeiysfs emu pnt)aexnio iytoa  anvsl(0 etoxo3oo4amee nct s srra(  ;o0texo o3iasfs rl(mp;(4tlermrciytlm r uei s  eum(o iydomeemfcsl() rta( p;t4tpx  fciyd m uanvp;u0 rtrxf oydlaD lies;s0s2xoxm iodaltemfvsa()aDum(r ;o4tpxn fciyd s2uaump u)tlxnir ta1op  ai s;t texrxm3nydolenlnetlt) rtrx  ;t4tpx  i3iytlm rauvp ()aetoircoy1lat lueilt0 rum(mpny4lpenmnviasfsrtrurp;u4alxoif3iyd m2el( p (4tlxnxociotlaDelnes ()trxrir3oo4lpt  fesls s2rrxmo;t1ole ifciyd s el(ms;()tltrifcoatlpD an o s)trxo(o iydlp nlnvs t)arrau o;t4ape iocildlmDemn pnu0 lxrio to1lm rau ils0t2tmiopnydom  mncta()sDtm(r ou4tpenifetadfm2em(vp t4arermr3oa1oa  li o () 2xm(o3ny4lpt  nci tf rua(root0ope mfciyt a2ul(ms;(4 exomf oydoatr ueils t2urim3iy1ll nlfvsa( s2tr(  oo0aex  oeiltlaDeauvs u0alxnmr tadomt luvo t sexo(o iudaptelncta(fartmx  nu0apxomi3tatlaDrlu on() etrxrcoy1fp   nvi ( s2tr(opoo4olenmneta( sDrmx pnu0teeomi3ilsfmDra(mp;u)teenmfcta1faDeaues (0 2umir nu1ape lieia(f rum(  nt0aetomo3tyd a umump (0 rerxfciadfaDeaivs;s s2tmxo3oy1lpe licsasf Dumxmp;t0teto icildlaDua(vp (0 lxrio3totfp  lnei (0t2urir3nu1ame  icsls)srtm( ooo1oleomoeild s2eaumo;(4 etnir oytlptrlueo;( tetr(r3nydolen ivsa(f Dra(  oo1aptn i3ildla uanvsn(4tltoxfcoy1la elivo;t0trxm(o iu1lm  mfcsl()artrx  nu4opxoioetasfm rl(vsn(4tleoxociytfmDrlu o t0 rtmir3nodap e fetltfs2trxro;o0olt mo3iat sDrm(vs;t) eeniociydlm elnvslt0 2xmio oy4ol nlnvsat) 2rmx  no4texnioctaslm eluvp;t)arxoio3oa1lptrliei;t)teuoiopiudap  mncta( sDra(rpnu4oeeoifetaslm2em(mo;(0arxoircio1omD  ieil(0 exrxmpnu1lptemivtas  rraurpou0tpeomfeiydfaDemnms t0tlenir iy1fp raies () eumxr3no1lmte iesat)a2urx oou0tetomf3iyd sDelums;t)arerxr3oytoa r nvo s)trxmim oodap nlici t a2rmur ot1olxnmo3iaslmDea(vpn(0 ltomrcto1omDeluvi (0texmio3oy1lmtn fctl(  2um(mono1apeoifciysfs uan snt0arxrxrciytlmtraivils srxoxr3oudllt mfcia() rra(r ot4tpx  o3tysls2eaumsn(4arxnif oatfpt lu s;(0setm(o3nu4oltnlici sfs2ur( p;t1optnifcildlmDrlump u4tetnxf3todfmDrai s s)seto(m3oudoltnlici s)srumuro;o4apx if3tasls eluvpn() rerif iodomtrln i (0s2umxo oydll  lfvs s)sDtr( pno4olt moctytlsDemu p (0artrmf oa1fp eluvi s  2um(r oo1open ics (fs2tax pnt1optniiciadls2ra(mo;u4trxrxo3oy1lm eai sls)trum(r3oy4am emnct t)aDra( poo0apenio3tatfs2rmump;u0altrmo oydlaDrlneo t) eumirpio4lmt  ics t aDra(  ot4aleoiociltlaDuau sn(4 rxnxrcoytfp rluvo ( trurxo io1am elncs t srumx  oo1opxoif3ilslsDua(vsnu0tlenir3tadfpDraueolt0 2umirpio1altnmnvi (  rrm(mp;u4tet ioetlsla2eauvs;(4aetomr tydlp rln s;( srtoiopnudame  fcils  Dtm( oou4olxo feiat s2umn sn()texrir3iatfaDeaivi;(0srum(opno4am elictltfs2tmxm ot1openiictadlm2ea( o (0 rxrmf oatop ranvo t  euoio io4lpt  fet (f Durxmoot4aex ioetltls umums u) etrxfcootopD  ueolt) rxm(r3oydllt liet tf rtrxr ;o4tpt mocias mDea(vpn()tlxrmo iodfpDe ivil(  2uo(m nydlmenmfetat arurx oot0ape ioeiltfs2rmu p;u) lxrio oytfp r ueo s srxm(opiu1lmtelncslt)s2ua(m nu1tet mociydfm2rlumo;t0aexoif totlm eaueolt  2umim3iu1ap nlfvsa(faruaxro;o4teeomoetyd a elu s t)tlerif3oodfp elieilt trumirpou4ale mnetlt sruaur no4aet mfciad aDum(vp u)tetrxr io1omDean sl( tetrio no4lme lfesa(fsDraxmoot4aexoifetltfa2em( p;u4treomr oa1fmt auei;t)texrxo iy4am nlfvi sf 2ta(m nt0apto ociatlaDemnvsnu4treomo3oy1fmte n i;t)texmxm iu1lptemfeiatf 2rrxr ;o0olen iciaslaDeluvo (4trtnio oatla  livo s)seuoio3iu1omtemnvtatfarur(  ;t1tpeoioeildla2rmnvo t0 renxociodom r i sls0teum(m3ou4lpt mfcsa(faDrrur nt1oexoifeiltfa2rl(vsn(0aexrifciotlmDe n i;t seur(mpoodlpt mnvt s aDtr(  oo0teto fciadls ra(vo u)aexnxfcoydomtr uvs;(0sruo(m3iu1am emfvil()srrru pnu1teto o3iad m2ua( snt)trxomf3iy1fmD aiei (0tetoxmpnodlpe lfvsls aDur(  no0aeeomi3tysls uaumsnt0tlxrxociytoat aueslt)trtm(opiodome  iciasf 2tmxr oo1aetniictld s2rmn o;t4tleoiociadlatrln o ( s2xr(m iudopt  fviat) 2rmx o;u4alt iictldfmDrmnvs;u) eenxo3todoaDeanvsls trtr(m3ou4lp elfesltf rtmur ot0tlx ioeild m2ean s;t0tlenmrcoa1opDraueils)tetoim ny4aptnlfes t) 2uru pno1olt mo3iaslmDum(ms;(4 eeriociytfmte ues t  2tm(rpnydol   nvslsf Dtaur oo0ole mfeiadfsDeau o;u4aexnmo3iotoaD aivil(0s2xoxopiu1amenmivsat aDrmuro;t0apxn i3ias m2rlnvo t0 rtrxf3to1op  ai s s s2xoio3oodop elicsltf 2ua( pou0tle  i3tltfa rlnvo;u0 exnxo tadoaDe ueo (0s2urim oydlme  feil( aDumxmpno1oet io3iaslm el(mo;u0trerxr oy1op eln il()seum(r oy1aptemnes (  rrrx pnt1aeenmoetlsfm2ulnmo;t4 reoxr3oytoatr nvils0srtr(r3nu1omenlnvs s a2tmurp;u4oltoifeiytfs el(vo (0alenmfcia1op  aivilt)s2tr(o io4omtnmnctas  Dumxmooo4alxomf3tysls2eau p;t0arxrxocoatfpt lnesls) eum(r3nydamt  iei s) Drmuroou4tex  ieiltfm2eln pnu) rtoirctotlatelnvs;()sruoimpoudopeelfesa(fsDuax ooo4opxn ieiadfaDelumont4alxnmf iy1lpDelu o;t  euoio oudapeelfvtasfsrtm(m ou0tee  oetydfmDrm(mpnt)aleomrctydfpDran o s0trxm(r3iydol n nctat  2um(ronu0opt mictys s2uaums t0aexrmr3oo1oa  aivols0srtrir iy4apenlnctat  Dum( poo1tlx iieiad mDua(ms ()trtrmrctatlptrau i (0t2xr(m3ou4ope licia( arrmum ;u1opxn ietltls2ulu o t4 eenif oo1lp raueslt) 2toir3iy1lleelfvia(faDtmxmp;t4ole  oetasfm2umuvsnt)trenio3iadomtrauvsl(  2uo(rpoo4openlncslt)s2tm(r ;o0oeenii3ild m rmnvs t4teermf3io1fpD  n olt  2tmxmpiudopee fetlsfa2um( o;t0oleniieilt a el(mp t)aeerxr iytfm eaieo s0 2uoxm nu1am emfesl( s2raumpno4aeeoifctys s2uauvs u)alxnifctotlmD  n s s)s2uoir3ny1oleelnetls  2ra(ront0olxo i3iad m ranvp (0 lxrifcta1oaDrluei (0sexmxm3iodlleemnvias  2taum oo4teen feild sDrauvsnt) eermrciodfp rlneolt srur(r3oo4al emfesltfs2ta(mpnu1aexo fetysla2ran o u)arxrmf tadlp  aivs s)setr(o3iodomt lfvtas srtmxrpnu4tlx ioeias m2ranvpnu0tlxrio3iotlaDelieils0seuoirpiy1om  livtas)aDrrumpoo0aexn oetytfs rmu p (0trxrmo3ia1oaD  n ils) etr(opno1am nmfesl(  2ururpnt4oeenmicilt s2ua( o u4trxnxo3oodomt  n ilt t2xr(mpiydop  lici () rum(mpnu1opt mo3ias s emnmont0 ltrmf3ta1lpte n il() rxmxr3oudlpt mivsatf rrmxrp;t1oeto ictytfm ul( sn() exnmo todlatr u i s  etrxo3iy4al e fct t  2umxm oo4altnmoctytlm rlu o;()alerxo3iydom   u ils0texoir3nudol e ivslt  Drm(mpnt1oleo i3iatls uanms;u)aexrxo3iy1fptranes;()t2uoirpiu4llee fvsl(f rtmurpnt0aet mfeiltlmDrm(mp t0 lenif tytlpDe u s;t  2trxopiodamtelnvslt srraump;u0oetn icildlm rauvsn(0artrmo3oa1om eanei (0 ruoxm nodaltnmnvilt)aDta( poo1alxomf3tlt m2eanmon()aeeoio io1fat  n il()srto(mpny4olen ivias s2uru p;u1tex  fetytlm rmuvp t) rxrmrciotoaDelivo;t  2urxo oo1apen fvi s aDrrxr oo0olt  iciasfa2eanmo (0trenif3to1fpt  ivs t)srxr(m oudop  mivias srurumo;t0apeo fetltlm uau s t)alxoifcoy1fm raieilt0 rxmxm oy4llen net sfaDtru pnt4tpto feiyslmDeanvp t0treoif iotlatr ivil( tetrxm3no4am   fvtlsfsrur(ro;o0tle mfeiyt sDemnvp (4aeeoxocoatlp  auvils0tetm(m3oy1om nmnvsatfs2umuront0aee  fctldfmDua(vo u0texoxr iydlaD livo ()trxmiopiudoltnmfesls  Duaur nu1olt moeils m2ra(vpnu4trxoxocoadlptrli i;() rtmirpiy1lm emivsl(fsDraump;t0olt mfcils mDuluvo;(4artnxr to1lptranvolt t2xrim oydoptnmfeias) 2rmxmp;t1tet ifctyt mDeau o;(0texnxrciydlptraies ( teuoio3io1ole livi sfsDrm(mo;u4tee mfciat sDumnvp t0 rxomocio1omtranvo s0 2xoio3nu1lme mnct s arrmxro;o1ale  fciydlm2eauvs;t0arenir ia1lm elues;t0 2xrir3oodlme lnvt ()a2tmu poo4tee mfetasfm rmuvo;t4arxrmf iydlpt luei ( trxm(opiu4opt mncs s  2um(mp;o4tpxo fctls m2um(vp;()tlxoxf ootlpt aivil(0 2xm(rpiydole lfcsls) 2rmx ont4oeeomi3iysfmDum( p;(4 lermr3iy1fa   nei;s  2umirpnu1lleelfvia(fs2tau o;u4olxoifcils a2ra(ms t4 eeoxr ty1opDr nvols srxrimpiy1open net t)artmuro;o1alxnmoetadfsDrmumo;t)altoxo3tytlatrlivs;( seuo(opou1ape mfvtat)arum(m no0aex mo3ilt a2ulnvsn()trerircia1opDelnesl( srumxo no4ope liesa( s2rm(mo;u4tpt  feiaslmDrlnmp t4 lenxoctodfpDrlivols srxo(m3oudom emfvil() rtrxroot4apt  iciyd m rm(ms t) rtoxr oatoa r ieolt)trtoir iy1lp nmfvt () 2rau  ;t4oex mf3iys a2ul(vs;t4 ltrio3oadfa rauvi s texo(m3oo1lpe mnvtas) Dtax pnt0tpxomf3taslsDrlnvo;t0 rxrxoctatlpt  nvo;t0s2toxo3nu1am emfvt sfsrtr(mono4tlto ocilt s rl(mpnt4 ltoiocoa1faDeaivs;s teuoxo oudamt lfciat srtrurono1tetn f3ild mDelnmsn()tltnxr oytfp elivi;s0sruoxmpnu4amte ieta() 2ra(rpou1aexnifciys a2elumsnt0alxnifctotlaD  nvi;()s2toio io1altnlivtas  rur(monu4alx moeiydfs rm(vs;u)altoxf tydlmD liesl(0 euoxmpno4lmtemictl()sDrm(root0aleoio3tltfsDemuvs ()tlxrmocoa1fm elueo;() 2um(rpou4alenmneta(fs2rmxr ;o0tpenmfciad mDul( o t)trerxr3totfatr uvslt)t2xr(opiu4llenlfcslt)srta(m nt1olen oeild a rmnvpnu) rtnio ta1lmDrai o (  2umirpiu4am nlivslt)a2ra(ronu4apxnmf3iltfm em(mp (4aetomfcoatfmDr neo;s  2xr(opno1al nlncs ()aDumu  ;o1olxnifctytls2ul(vsnu4 ltoif3iy1lpte i ilt0teuoio3oy4optn nvtasf 2trur ot0tle iieiasfmDuan o;u4trxnmo oodfa raneo;(0 exmxo iydolt lnei s arrmx oou0oeenii3tysls uauvp;t4 rermf to1lm e ueilt  rurxm nydlleemivia(fs2trurpot4oexomociys s ra( p t4trxnxo3iadlm eluvo t0t2xoxr3nu1opee ncias  2raumpoo1tlt mo3tadlaDulnmsnt4 ltrir3io1fm e iei;t0srxmir3ny1amt  neilsfs2ua(mp;u1alxomf3tytfm elnvsnu4texnxr oydfateau i;() exoio oodap nmfcsl( s2umxront1ole mi3iat a2ua(vs (4 rxoirctadlpD au s;(  eum(o3oo4amtn ncs t  Draxmpno0ale mo3ildfm el(mo (4aexoiocia1la raies;t  rxoxo no4oleelict tf rraxmooo0aetn icils a2um(mp (0alenir3ty1fpDr uvo;( s2tr(mpoudalte feilsf 2tr(r ot0tet miciyt aDuau sn(0texrmfcio1opD aueols t2tmiopiy1lmt mivta( s2rmxmpou4opt mfctld s rln p t4tetrir3tydla  ai i;t0t2xrir3ny4ll  lnct s)srrau  ;t0aet  i3iltfs rauvs;u0arxrxf3oatoat lu ils) etoir3io4lme licslt  2taurpoo0teeoii3tls s ul(vo;u)tltoxrciy1fpDeluvsl( setr(mpiy1openlnet (fsDuru ono0apxomfcias a2ulums u4aexomf3oy1fpDr uei (0texoio3iydoptelfvil(  2ua(m nt1alto i3iysfs rmnvs;u4arxnxf3ty1lm  aieo t srum(r iy1olenmiesas)sDraur ot1tpxniieiytfs2ran o;t0 exoxr3io1faDraivolt0 2uoxo3oy1alt lfctas sDua( pno0tpxnio3tls m2emnmpn(0 etnmr3tadoa rli o;s  2urio3nodapee fei ( aDtr(rpnu0oetoiociad s2um(vpnt)tetnmr3oa1omtrln olt) 2xmxr oo4omtn nvtls s2umxronu0aee  oeiatfa2rmn s u)artrirctatlmDraivi t0seurxr3oo1lm elnviatfaDrmxr nt0oexnmoctytfaDum( p (4teeomr totopt  n i (0 exoxrpiudap elivsls) Drmxr ot4alx mi3iatfa eauvp () exrio3ootfp e n ils  2umio3no4om nmivi s) Dtrurpno0oeeomo3ild m eaumpn()arxrmrcoytlpD lnesl(0srtrim nu1lle mfesa( arum(mp;t4olxnmf3tydfm2rmn o;(0aeermrcio1lateanvs;s0sexmxo3nydamt mfvi s)s2rm( o;u0aetnmo3ildlsDemuvp;(0 eeoxfcia1lm elies;s) rtrxr3oy4al e fes ( arrmu  nu0tlt ifciat a rm( p u4 eenif3ia1fatrln slt0seto(o3oo4ll  mnesa() rtaump;o1oetn oetadfs uaumo;()aetoir3oy1opDr u i;t  2uo(m3nu1lmenmfvtas)artm(mpno4olxn o3ilt m2rmu o () lxrmo3oodla rauvo () 2xoiopoodamtnlnvt ( a2raum nu0ole ifeiadls emnvs;t4 rxnxr3ootlm  anei s srtmxo nudaptnlfcilsfs2rmx ono0tlen ieiad a rm(msnu4altnir oatlaD livs;t texmimpno4omtn nvt ( arta(mpoo1aetoio3iysfa em( p t)tetnmr3iy1lpDeanvo;()trxrirpiu4amtnmncs s)a2ururo;u4aptoioeiysfs2ul( o () exoxf3tytopDr ies;t)s2xm(mpiudomtnmnvilt)srta(  ;t1opxn fctld aDrmu s;(4 rerio oo1lptelnvil() 2toxmpnu1ap elnvtatf Drrxmpnu1teto f3iyd a2rm(vo;t)trtoxfctodop rauei;()trxm(o3iydamtnlfei (f 2umxmpnu1oexnmf3tytla eanvp u0 rxomf3ta1fpDeai o;s t2xm(o3no4open nesa()aDurxm oo4teeomi3iad s ranvs;(0 lxoir3ootopDrau ils)truoio ou1lle  fvsl() Drm(mpno0ape miciydlmDua(ms (0 renmrctotom r nvi;s) exoim oy4ll  mietls) Dur(root0ape ifctld aDeaumsnt0 exrio3todfm  li olt0 eto(m3oo1lp  lfcsas  Dta(root1apxniociltla rm( o t4alxnxo iy1latran sl( trto(r iy4am e icsl(faruru  ;u1ape ifeilsls rm( p u0 rtnio3to1lmtr nvi t0t2xo(m oo4omeemnvi tfsDuaxrpno1tltomfeildlm2ul( pnu4trxomo totlmte ivi;() eto(opoydlmtelfeiat  2rm( o;t4tpt  fctadlm2ua(mont4trxrio3ia1lm  anvo t) 2umxmpno4lm emfetat) rrrx ont0oetniicilsfs2em(mo t4areoxf3io1lpt lu s t  2xoiopou4lpt lneil(  rtm( pnt1olto oetadfs rauvsnt0arxoxf3oydlpD auei (0 rumxr oy1lmt lfvt (f rtmu p;t4aptomo3iltla emnvp u4arenxocoodfmt ln ol(  euo(m3no4ap e ncilt)srrr( ont0tle mociys s2ul(vo;u) rtnxfcio1lmD  ivolt  exm(mpiu1lpt lnet (  Drrur nu4oee  f3iysfa2rluvs;()tlenmr ta1fpt lnvo () etmiopoydom emnvs (fs2ur(mo;u1oleoio3tasla2ulnvp;(4 renmr ta1fmte ivi;t) etm(o io1ole  ivtlt  rtm(mpno4altomietaslmDum(mo (4 ltomr3oadfa eai o;s0t2xmxrpoy4omeelnvils aDtr(  ;o1oex  iciadlaDuln snt0 eermrcoadfmtraieils0s2xoxmpnu1op elivtas)a2trumpot0ole  oeiasfs rl(msnu0trxrmo3iydfpDe nei s0 eto(opny4lltnlnei tf rtrxmoou1tpxn fciyd s umu s u)tltrmf oydom  ai o;s)s2xoxo io4lptemnes ()a2rr(m no4apx iicilsfs rluvs u)alxoif3oatfatraneo;s0 exoir3iu1ope mnei t srtr(r ot4alxn ietad s ea( p;u4tltrmrcta1late ues;()trumir3oodaptnlfvta()sDurx  nt1teeoii3tadfs2ranmsnu4aeermf iadfateaivs;s) ruoxm3iy1olenmfvtl( arum( ooo4tet mo3iatfaDrmn o ()alxrxo3oytop r i s;t  etr(o ny1alt mictls)a2rm(rp;o0tetoifetatfsDemuvp (0teenxf3ootfpD auvo;t0 2tr(r oo4lmte nvsl(fa2rr( poo1teeoii3ildfs2el(vo;t4tlxnmf totop raieo s srtoxopiydlltn fvias)sDrm( o;t1altn ieiasls uanmo;() reoif3oadfm e neslt)t2xoir3iu4lm eliesls)s2tmum nt4oeenmietytla eauvo;(0tleoir oytfpteau o () euoxr oudom  lfctas a2trum ;u1aexnif3iat m2ra(vs;t0alxrmf ia1op r iesl(0 2xoio iu4lmtnlfeiat a2ur(rooo4aet iociytfs2rm( s u)trtoifciodlmD aues;s  2ur(r iodame  nciat)a2rr(m ;o1tlenioeiasfm2rmn o u4alxoxf3totfp  an o s t2tr(r oo4am  mfvi ( sDur(rpot4tpenmfctytla rlnms (4aeeoxocty1oa ran s s srtm(rpny1lpt  nctls aDra(m nt0tpeomoeild sDuan snu0aetoio3oa1fpteaivo;s s2urim iy4lptn ivtl( sDtmu  ;u0altoii3iadfsDrmuvs;t)aetnmocoadomDr ivs;s0 rur(o3nu1lp   feslt  2raumpoo4opx mietytlaDraumsn(4trxnmf3oytfp eaivs;s0 rtoxo3iy1ameelfvil()sDra( oot1oex mictldfsDumu pn(0 reomoctodlpD aivsls0 rurxm3oy1amt mncs s)srtrx pnu1tpe  o3iltfa ulu s;u)aexnmr3ootfmt lues;t0t2um(m nu4lmt mneil(fs2tr(rp;t4apen ictlslmDeanmsnu0 rtnirciadlpDeaues s) rurxmpoo4olt livta(faDur(mp;t1tltomf3ilt s uln s (4aexrxr3iotomteai s t)teurir3oo1lpe  nvsls)sDuaxr ;o0tet ifeiadfm2rmnvp t)altrmf oytopD lu i s) rurio3iu1ap elncil() Dtrxr nt0oltniietytlm elnvo (0alxoxf oo1lmtr ivi;() exrim oo4olenlivia(fsruaxmpnu0apxnio3tas s eln p;() renxr3iadopteai ils) exo(r iydlmtemiviat  Drmu ooo4alxomf3tatlaDrmn on(4 lxomocoodfp e ueo (0 exm(o iy4openlnvilt)artrur nu4oetnmfetytfa eau snt0trerxrciatopD  uesl()trxo(m iu4lm nlnvils sDrm(m nu4oexomieilsls2umuvo t0 etoifcoadfa   ivs;t srxoxrpnu1opeelics s)s2raxro;t0oexo fcildfsDrlu s t) leomrcoatlm elnvols s2tr(m no1am nmiciasfs2rrxmo;u0aet moeildla2el(vp;(0trxrmociotlp eaieilt s2tr(m ou1lm   nci t)aDrm(m ou1tpxnioeildfm2eanvo;u0tltoio oa1fpDeaiei;t0trtoirpou1lm  mfcias) Dtau  ot0tleomfeiadlsDumnvo () exnmrcta1fp ean o t  eur(mpou1opte ivs s  2ta( o;u0tex ii3tydfa ea(ms;t0 rxnir iydfp r ieols)truoir3nydamenmfvs ()a2tau  nu0texo i3ilt s2el( o;u0 eeomociy1lm r u i s0s2xrio3nydoptelici s)arrax  oo1teeoiocilt s em(ms;t) rtrxrciatlmteaivol()setrio iu4aptn fct ()s2um( p;t4oexnmfetlt aDel( s;t0aexoifciotlaDraues;s0s2um(r oudapt  ictat arua( ont1teeoioetytfs2elu ont4altrmo iatoate ueil( teuoxrpoo1ale mnctatfa2raxmoou1aexoif3tadlsDemuvp u0teeomo oadomtelivils setrimpiy4oltn iei t)srta(moou0tltomoeiatlsDrl(vpnt4artnxo3oytlmDr nvo s)t2uo(opiydalenmnvt (fartmurpou4oetnif3tysfa eanmo;u0tlxrio oydla   n ols)sexmxm oydlle  ncslt) 2tm(m ;o4tpeomoctysfaDra(mpnt4tlxoxf oadomtrlu o;() rto(r3nydam nmnvsl( srum(rp;t4ole  oeiad a2rmnvo u)treoxfciodopt ln o;s0 ruo(r3oodop elnctat  2rrxr ;o1tle  feiasfsDrm( s t4artomo oo1oa e n sl(  2tm(r iy4lleemncslt srtrxro;u1teenmfeild mDrlnvont4tlxoio tytoptrauvo;t0 rurio nodll nmnci sf rrr(mpno4tpenmi3iltfm2rl(mpn(0teeoir ty1fpDrauei t) 2toxmpiy4lpeemfetlt)s2taxront0aetomfeiadlmDeaumsnt) ltnif3oytlmDeaivilt srtm(m io4omee nvt t)aDtmx  ou0tlxomo3tlt a2rmnmo u0 eerxr todla r n o;s0t2xr(r3iu1ap n netas  Dua( oou4opeo oeildla2ranmp;t)tlxnxo3oytla raieo;s teum(m3ou4lle mnesas srumx oou4opeomictaslm2elumpnt) rxnifciotlptrlu ilt s2tmim3oydape livias s2ta(roou1tltniiciad m2eanmpn(4 etnxr3tadlpt aivi;s0t2xm(m ou1altelivtl()sDraumpot1optnif3ilt sDemuvs;u4 rtoxr totlmD  nvo;() ruoir3ou4ap e nctls)arumxr nt4oeenifeiysla2ulnms;u4tltnmr oatfaDeai o t)sexrxr oo4llen feil(faDrmu  ;u0oleniiciydlmDrln s u4 rtoxocoadoate iei s)s2urimpio4ol nmncsasfs2trxrpou1aex  ictydfs2rlu o;(0 exrifcoo1fmte ivols0trumxopnydaleemfesl(faDtaumono1optnmietld s2uln pnu0trtrxfciadlateai slt)sexoim oo1al n fct t)a2rm( ont1aetomfeilt a2um(vp;(0artoxr3oytlp raueo;()srtr(rpny4oltnlietls artm(m nu4olenifciysfa2emums (0 etrmfcoydlmD lu s t)t2uo(m no4am nlnctl( arrrxro;t1tetomiciys aDel(vs (4teeoifcootlp eln o;(  eurxr iy4lleelics (faDtmurp;t0aetn ietlsfsDrluvo u0alenxo3oatfpDr iei (  eurxm no4lp nlieil(f rtr( poo1tle  fctldfm umnvs t)aleoxr3tytlmt au ilt0trtmxr ny4olenlivtat)sDrr( p;u1apt ifetatla umn snu4 reoxfcoatlpt aivolt sexmio iydlmtnlnvias) rtmu  nt0oetoif3tas aDuauvp;(0 exrif todoa e nes;t)sruoxo3oy4ole  fviatfa2tmxmpou0altnmo3ild a raump u4trxnif3ia1oatean o;()truoxr ny4ap n fcsl( aDrrx ont1tpe mi3iadlsDumumpnu0 rtoxrctadlmDe neo;s) rxo(r3ny4ap n ietlt)srtmx  ot1tleo fciys s rl( o;(0 lenmf3iotfaDelivo;t  rxoxo3io1op emfei () ruaurp;t0texnmoeiadfm2ra(vsnu0tetoxfctodfpDe ies (0trxrirpny4al nmivtas) rrm( pot4alt iictld s2ul(ms (4 rtoxrcoo1op  lueo;s)t2tr(o oo4ope  ncta(  Dtmx o;u4olxo iciatfs2umn s u) eenxfcio1oaD auvils sruoxm oydllee ivsa(fs2rmu  oo4aetnmfeild mDrmnvsnt)tlxniociatfp ranvi s  2xr(m3no4ome  ivs t sDraurpot0oet mi3iyt m em( p u) rxoifcoa1laD  ies t t2urxrpiu4olenliet ( aDra(r ;u1tlt  octasla2rlnvpn(0 lxoir3ia1lmDrln i;t0s2to(r3oudlptemnvt sf 2rrumpot0tltnifeiltlaDuan p;u) ltrmr3oo1lp rauei;()srxmxr3nu1ol nmnetls)s2trur ;t0opxn ociasfa uanmsnt0tlxoxrcoo1lmtr uvolt s2trxo nudoltnlfcs (  rum(r ;u1oeen o3iytfaDraumpn(0alerxf3tadopDrli i;()trxoxm3ou1lle mfct t  2rrurp;u0apxnif3tlsfa2rl(vs;u)alxnxr3to1fp eanei (  eurirpno1apeemnesls sDtax o;u1alen ociltlmDemnmo;u4artomocty1omtr ueil(0s2xrxr3iy1apt  nvtls aDuru  ;o1apeo ociydlm rmu ont0 ltnmr3tadlpDe ies;t)tetoxrpoo4om emietl()artmxrpno0aexomoctyd mDemu on(0aexoio ia1oa   nes;()trtmimpno4lmtelics (fs2taumpnt0olt ifciatls ea(mo (4alermr ia1faDeauvo;t0trxr(mpiu1alte iei s arua( pno1tpt io3ildfm2ran p;(4tltrxoctytfatean ol(0 exmir nydameelnei sfaDrax pot4opeomociytfsDul( o ()alenxo iy1fmDelieo;(  euoiopnu4amee ivtlt) 2tm(mpno1tpe mi3ils a2rmnmp;t) ltnxr3to1oaDraiei;t)s2tmim iy1alte iet s a2raumont1optnioctlt sDuau o;() etoifctodlp  ln ols  2xrxopoudale  fvtlsfsDtm( ooo4opxniieiasfa em(vp;t)tetoio iodfm elnvo;t0t2tmio nodameemici tfa2umx poo1oexnmf3ils m ea(vo;(0 renxf to1oate ues;(0s2toiopou4ame mnci t)aDua(m ;t4apeoiictldls rlu o;(0 reoxfcoo1fpDeaivi ( srumirpio4llt lfcsltfaDtaur ;u0oex mi3iadlm el(vo;u) rerxrcoo1op eauvols0 rxmir3io4lmtemfeta(faDrrxmpou0aeen fcild a2rln s;t)tltrxr3iotoat anesls0srtoxrpoy1opeelnvia(  2trum oo0tpenif3iydlm emu snu0trxrxo3oydoatrlues;t0 2urxmpou4llt lici sfsrrmx  no0aet  i3tysfsDuanmpnt4tlenxocoytoatelivi t)t2umiopio4alenmnviatfsrur(r ot1opto iciltlsDea(mp;u)trxomr3oodomDeau i (  etmir3iy4lm n fci tfarrm( oou4opxn octyslmDra(von(4altrxo3iy1lmtranei;s)teuoio3oudopte fvi (fsrta(rpno1oetn feildls2uluvo (4 lxoif3totlat  ivo;s) eurxr3oy4ope  nvtas sDurur oo4ole mo3iysls uau o t) reoxf3tatoa   u i;s0setrxrpiy4ol  mfctls  rur(mpoo0oex  fctlslsDrmu s t)tetnmr3io1lmDeauvs ()s2trxrpiudolenmnvsasfsrrrur no1tetnio3tytls el( s u0alenxr oatfaDraueol()trxo(m iudam  micsat srumu ont4aex  ocildlsDelnms u)treoir3iydfat lu o (0 2urio3oydlmtn nvt t a2tax p;o1aeeo oetydfaDuaums;t0arxnxf3iy1fateluvils  euo(r ny1omt  fesl( srrrx oou1oeto ieilt mDea(vp t) lerir3to1fmtrln il()trur(m iudape  net tfarumum oo4oet iietltfsDra(mon(0alxnmf3oy1fmt auvslt)t2xmir3oodll  lici (faDtaump;u4oeeomfeiadfaDea( o t0 etrmo iytopDe nvs (0 exrxmpoy4op emneiat)srrau ooo1oeeomf3iyt m2um(vo;t0texoir3iytomD  i s (0teuoiopoo4amtnmnet (  rrru  oo4tpenif3tadfs uln s;(4tltrxf3tatfpDrai ol() 2xoio nudopee nei ( sDtr(m nu0oeeo fciydfs el(mont) lxrmf3totoptrli i;(0setoim no4aleemivtas  ruaxm no0altnmfciytfs2emnms;()aetrmo tatlpteln i;s0 rxmirpou1om nmfesas  2trxrp;u1apenmi3ilslaDum( p () exoxf ty1omD  ieilt texmxr3no1lm e neils  ruaxrpoo0oee iiciyslmDeln p t4texrxf3ta1om  aieo;t texm(r io1amtelnesasfa2rm(mp;o1teenioeiat sDuanmp (0artrxo3oytopt  ieo t  etm(rpnu4om emiesas) 2umxmp;t0tltnmietld sDran s;(0alerifctotlm eaueol( s2uoxr oudop nmictl() rrrx  nu0tpe iiciysfs2emnvsnu0 rtrio3oatom e nes t0t2umxr iodlm elnviltfarumxmpot0tpto ictasla2raumo;u)artomr3oatla   nes t0trxr(r3nydapenlfvta()s2tm( p;u0altnmiciysfs2uau snu0aetomf oytopDeli i;s0 2ur(m3nudlmtn nesa()srtr(m oo0tlt if3iytlmDem(mp;t4tlxnxo oodfp  lnei;t t2tmxmpoydomee ieias a2ua(ront0tlxoiictys s emn s ()trxnxr ootopDeauei;(0setoio3iodopenlivta()srrau pno0olxo iciadlsDul(vs ()tlxnir tytfm rlivslt)teuoxr iydal   fcsl(  Drmxmooo4aeenif3tasfsDea(mon(4tltomo3oo1lpte neols trxoxopou1op e ivsas)s2rrx o;t0aexoioctyt a2rmu s u4aeeoif3ty1fmDelueilt  rumim3iu1alee ieil(fsrurur ;t0oee  fciytfm2ra(vo;u4aexoxo3iotfaDeauvsl(0 exr(r3iy1lptelfet s aDur(ro;o1tptnmiciysfs el(msnt)artoirciadomD  uvi;s0tetr(opoydaptnlncslt  Dta(r nu0opxnmf3ilslsDuanmont4alermo3ty1lmtraueils0tetoim3io4alt lfei () rrau  ;u0texnmoetatfmDrau ont)tlerxr3totfmteaueo;()teurim io1ll elfcsl(  Dum(ront0ope mf3tad a rlnvs t4aeeoxrcoy1optrai i;t s2uoxm3oudal  mivtas sDrmu  ot1apxnmfciydls2em(vsnu4arxnifcto1lp  lnvils0sexr(r3nodal nmietl()s2trur ou4alxn o3tatfm ra(msnt) lerxr tadlaD li i t  rto(opou4amt  fci s) 2rm(m ;t0apeoioetysls ra(ms ()alxnirciatop e ivs ( t2umxm3ou4lptemnesas)srrmxmpot1tptnmfeiyt a em(vs;(0texoir oatlmD ln i;t) etoxo oydap n fct (f Dua(r ;u1olt ifeiyd mDul(vo;t)aetrmr tatom  ai o (  rxmxr3oy4amte nctat  Dtm(mp;u1oltnmfetatfs2ulnvsnu4 lenmo iotlmD aieilt trtoxm oy1olt lnvils) Dtaxronu1ap
\ No newline at end of file
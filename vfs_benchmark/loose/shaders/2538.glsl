@@ -0,0 +1 @@
+ueo (  2umiopou1lmeemiciasfartru oot1apx moeilt a rl(mp t4arermr tatoaDe nvi;t0t2xo(rpoydapt lfcs s) 2raum ;u1oetoifciytfa ulu p t0tlxoxoctydomDrlu o;( sexmxopno1altemnvtl(fs2taxmp;o1aleniociyd a ua(ms;()trtnmrcoatom rlnvslt0seumxm iudomt  fet ( arra( onu4oleomieiytfa2raumpnu0 etnir oodla rlues t) rumxr3nydol emicsa( s2uaxronu1tptnio3iatls2emn s t)artoif3oodfat lu i t sexm(opiudam elieilt) Dtauro;o4aexniieiaslsDulumo u4tltomrcto1om eli s s teur(m3iy1lptn nct ( a2taum nu4opx ifciytlaDuanvont)trtoir3ta1lmtean o;s0t2xo(m oy4alenmneil(fs2ur( pot0texnmf3tysls2um( sn(0arxoxf3io1omt  uvi s)t2ur(o iy1lpte ivsltfsDrmuro;t0alxnmiciys m2ean ont) lenxr3iytoa   ieo;() 2tmim io4op elfcs s  2rmurpnu0alx mo3iadla2ua(vp;t0tlenifciatlmtr ivsl(0 etrir3nydamtnmncilt) 2tmxmpot1apx mictatlaDrmuvpn(4tlenif3iotlp  li i;s  rtrim3io1omtnmics ()a2tmumo;u1alxnmo3tasfs2rlnvsn(4alermf iy1fpDran o;t)seuo(o iy1ap elnvs s  Duaxro;t0olxnifciys sDrmn o;t0tetrmo3oa1lpt  ueo (0s2uoirpou1al nlncia()arrmumono0oexomicils aDemu pnt0 rerif oatoat  u s t) exoxmpiy1aleelfvslt)s2um(rpnt4ope  i3iydfmDranvsnu0aetnmrciy1fm  anvils0srxoirpno4lpe  iet ( srrmu oot4olxnmictldls ean sn() renmf3to1fpt ai sl()teur(r3iu4al eliviat arumxrpot1tle  ictyslsDumuvp (0arerif oy1op rauvi t0sexoxr nudlmt mfcsa() rrrx  no0tetomoeiltls rm( snu4 etrxrciatomtr nei;s)t2um(o no1llt lfvtat)sDrr( ono4oex  ociyt aDul(vsnu4trtnxrcoodoate n olt0srurio iudomtnmncs s)srtmx  nt1teeo fciaslmDulnmonu0aetnxo3iydfa   n s s)s2xr(o3ny1optnmnvsat a2tr( p;o0apt ifeild s um( p (4tlxoirciotom   nei t)sexmiopno4om elfcia() rrmxm oo0oltomo3ildla2elu o u4 rerifctadoaD aivo s  exo(opio1lm  mnesasf rrru oou1alt mf3ilt m2emnvo;t0aetrxocoydfpDe neils)t2umir iu1omenlieils)aDtaxmooo1tpeo fciys s rm( snt) etnmoctytopD  ies;s)srtoio oydalt  ics s)sDur(ro;o4oltn ietas s2eanmo u)areomrcoydfptr uei s0setoir iydlp elictl( srtm(rpot4alx if3iydla ra( pn(0tlxrmr3ia1fm rlueo;s  rtm(o oy4amtelneias arrrumpot4optomiciaslaDrmnmon()artnxo3ia1lp  ai o t)seumimpoydom elfeia( srumumpno0oetnmoctltlaDra(vp;()altnxo3ia1fateaues t t2uo(o3ny4lpenlfetls arta( oot0opx mo3ils a2ra(ms;u4artrxo3iotfp  anvo s  exmirpiu4am nmfvs sf ruaur ;t0aex mfeiad sDrluvon(4altoxf3oadop rau o;(  rxoirpiy1open nvsa(faDra(r nu1tpxo icils aDeaumo () rtrmocty1fm elnvol()srumio oudomtelicsa() 2tax onu0aet ifeiyt s2emnms;(0texnmo3iytopD lu o s  2uoxr3ny1lltnlics (f Durur ;t0altn oeilsla2ran s;()alxoxfcty1fpt  neslt  rtr(mpno4ll n ivs s)s2tm( ooo1altoifctlt a ulnvp u4 eeomf oa1fm rluei s0trxo(opio1op elfei t) 2raxrpoo0texo ocildls2rmumsn(0tltnxrcta1opt lues s)seuoxr oydoltnlicsls  Dtmxm ;u0ope iiciys aDulu s u4 rermoctydlp rlnvi (  eurxopoydlmte ies t a2rmx o;t0tpt  fciad m2rmuvo (4tetomr3to1oatelu s (0 2toxmpoudoptnlnetlsfaDtrx  no0aeen iciltlaDemuvs;u0teermrctodlmDe ies s srxoim3nu4alen nvi s)sDur(rpnu4tlto o3iadfmDel(vsn()aeerir3ootfp  aues;t truoir no4llte fes (f Dtrxrpno0tpeoioctyd s rmu s t)arxnmf3oytlpt auvs ()sexr(mpio1lleelnvsatfarra(monu1alx mfeiys s2ulu s ()aetomo3iodfmtraivs;s)s2trxr3nudlme mnes t)sDum(  no1oex  o3iat m rmuvon(0tlxoioctytlpD livs (0 2toir iodlmee nvs s srrru pno0olt mfcildfaDran s u4alxrxo3tytopDe uvilt)sexrxo3iudlmte iesl() Dumxr nu1tlxomicildlm emums;t0alxrmoctadfp eli il(  rtmxm iydll nmncil(f 2ra(rpnt1oet  fciad aDulnmp;(0 renmrcoa1omteln s;s)s2xr(m iu1oltn iet tfaDua(rpot4apxoiociyd m ea(ms;t)trtnxrcoydfm  auei;(0 rumxrpnydopt mivsa(fsrtm(  ;t4tetn ietad s2ea(mp;(0teermf iydomDelivs s) rtmio iy4op n netls  Drruro;u1oeenmf3tldfa elu p;u4texoif3iodopD aivols0 rtmim3nydom  lfcsa( a2tm(m nt0tpxnioctys sDumu o;t)artrxfcio1fateaneo;(0s2tm(o3io1lle mnesls) 2rax ont4apxomoetltla uaumo ()tlxrxrctadla elu ol( t2xriopno1lpte nvi sfsDurumont4oetoio3iadfmDrlu pnt)alxomr oa1omteaneo;( t2xr(r3nudlmtn fesltf 2rmxrpot1opt mieiltfmDeaumo ()tlerifcty1omteai i t) etmxr oo1olen icsas sDuax ono1oetnif3tld m ul(vs;t)tlermfcoo1oaDr ues t)teuoxr iy4lm  mneslsfs2rr(rpoo4tpe  icildla2rm(vp (0 rtrxocoa1la rauei;t)srumxm io1al   nviat  2umur no0tpeomieiydlmDemn p;t) leriocto1lptr neo (0srum(m iu4ol  mietat sDuax o;u4oet  o3ias a umnmo;u4alxomrcio1om raiesls seurxmpnudaltemfcilt)a2tmumonu0opxo feiat s emump u0altrif3ia1fpDelues;t0sexoxr iydalen fvilt)arrax p;u0apenmf3iadfmDuauvon(4 rxrmr3tadlmDraueo;s s2xoim iydomenlfetas  2rmxrpoo1alt  fciadfaDraumon(0trxnmf iadfpt li sl(  rxoio nudll   icslt sDtau ooo0aet  icildfsDum( pn(4alxnio oytlpt lnvsls)t2tmxmpoy1olenmfcs (farumxmo;u1tet ifeiydfs ea( ont0 etrxfctodom ran s s sruoxm3iu1alenmici tfaDuauront1texn ietldfm2em(monu) ltoio tatlaD anvilt0trumio3oudape  iesa( sDumum ;t1openmicildla2rauvp;t)trtomf tatlmDranvsls)t2xmiopnydopee iesa( sDrrxroot1ope mfeiasfs umu s;(0teerif3iadfa rln sl(0 exrxo oudopen fetas  rtaxmpnu4tptoioctatfsDrm(vo;t)trenmo3iadlm eanvo ()trtm(mpoo1olenlnci tfsDrm(r ot1optnifetls a2um(vp;t)alerxociydop eauvi ()srxrxmpnydop  mfctl() rtmum no0tpenii3iyd s umuvp (4trerio3oa1omte ivs;s) rumxm nudll n nvtlt)arrmur ot0tpeomicilslaDuluvo;u)trxrmfcta1fpDelivilt0 2ur(mpio1apeelfvt sf rtmuroot4optnmfcias sDrlnmo;t) rtrxr3iy1fmD ai o ()setoxrpoo4amt lfvsl()a2tm(r ot0apx iociltls elu s;t4arxoxf3oadom ranvo s0 rxoxmpnodamenmneiat a2umxmo;o4tpt ifciysfm rm(vp;t)aetoif3oatlpD  ieo t sruoim3oudoleemictltfs2uaxro;o0opt mf3tldfmDranmp;t4aeenmo iadlpD  ivsls) exrxrpoo1ap n ncs tf 2tmxr ;o4tle  i3iydlm umumo () lenio3oodlmDe u sls0trxrio3ou1ap emfci ()artaxrpnt4oexnmiciadla2ra(ms;u4trxrmf3oatfpD lneil( trumxrpiodam n fcil(  rtrurpou1alto iciadls rlu o u4aetrif iy1fm ran o s srxm(r3nydam elfcsl()a2tmxmo;u1optn fetaslaDra(vp (0 etomo iodfpt lu ilt texoxrpiydlltemfes tfarum(r ;o1tlxomictad sDrm( ont)teeoxf3ty1oateaneslt  exmxo3oy1ll   nct s)srtr( pno4oexo fctadla2el( o;t4aetoxo3oatop r i s;s)t2to(o oy1lmt  fci s)arra(mont0tpx  ocilsfaDrl(mont4 etoxr3to1lpDeaneol()t2xo(m io1ale  ici (farta(  ot0tex  i3ilsfa2rmn p (4 rtoio3iadomDe ies s0 eurxr oy1alt lneias)srrrx oou1apeomociyslmDumuvsnt)aeenir3iytlpteaneo s sexrxo no1ol  mfvias)arra(  no4aetoioctltls2emnmpnt)aexrmociy1lpDeln o (0teurxr3oy4optnlieta( aruauroou1tle  feiltlsDemnvp u0tlenioctydlm  lu o t  rtrxm3no4amen ivsl(fs2umxmpot1openii3iys aDranmp t4tltnmocoodfpt luvo t0trtoxmpoydllen fvi tf 2trur ;o1tpen o3iytfs eaumon() exnir todomDr n o;s0texoio3nodolt  ivsls sDua(mp;u4alt  fcilsla rlnmpn(0 ltrmf ty1om  an o;(0trumimpiodome livsas aDtrumpoo4apeo f3tytlsDrlumpnu0aetnxf3iodfmte ies;() rxoim3nydalt  fet t arumx o;t1texomieildlm2rlnvonu4aleoif3oadlm ranei s)trxmiopnu4olen fesl(fsrtm( ooo1aeeniocilsfsDum(vp t) lerxr todfaD luvol() eur(opiudlptnmfvilt aDum(mpno1aleomfciyt sDra(vsn()trtrmociy1lm  anvi s0setrxm oy4al elneiltfa2umu o;u1tptnifciyd a elumo;t4trxoxrcto1fat anvi t t2tm(rpnodamee ivta(  2uru o;t0oeenmoctysfa2umn s;t0 rxomr oodlpt  ivolt0setm(r nydllen ivsl( s2um( pot0tltoif3tldfs2emnmpnt0aeerxr iytlmteluvils trum(rpiy1altemiesls)aDumuro;t1aet ifcias a eanmp u4 rxrir iadom eanei ( srtr(r3oy1op nmnetasfaDta(monu4tptn ieildfa elnvs;u0 rerxf3oy1fa  lnvs;s  ruoiopiy4lmeelfvta()sDrrxm ;u1alx ii3iatfa el(mpnt4aleoxocoydlp elivi;t)trtm(o no4ope  fct tfa2rmuro;t4olt mf3tlt m2eln p (0tleoifciotoptr neo;t  eumxrpoo1lp nlfeiat)arumumonu1tetomf3tat m uauvo (0texnif3to1lp r u i;s) 2xm(rpiu4omen fvsat  2rr(m nu1oleomieiytfa2rmums;u4teenio oydlp  lieo;s0teurir3oo4ol n ivi sfaDua(m ou4optnioetyt m ulnvo;(0 lxrir3iy1omDraieo;t0t2tmim3no4lmeemneia(f Drr(rpou0aexnifciyt sDrmump t)tltrircto1fat ai s ()teumxo3iy4ol   fctls)srra(rono4oltnmocilt m emnvpnu0arxrxocoatlp e ieilt0 rtmxmpny4alenmfvi t  rtau p;u0opeoiiciyd s2rlump;u0 rermr3oytoat  ivi t) rtmxrpou1oltelictl() Dur(m ;u4tetnmo3ildfm2uaums;t)trxrmfciodfa  lnvsls) rtr(o iy1oleelnvilt  rrrumo;u1olenmf3ildfs ean o (0artrmr oytopD  ivo;t)teto(opnudomeelnvtl(fsDuaxm ;u1olen oeiasfm2em(mp;(0 reoxo3todfpt aieils0t2toxo ou4llte nvsl( sDraump;u0tlt ifeiltla2uluvs;u4 lxoxr ia1op r neo s0teuoxrpnudapt  ietl(fsrrm(ro;u1tpt mictlt a2umnmsnu)artnmo ta1oatr uvs s)tetm(mpnudllt  ivilt)a2ta(rpno0apeomfeiytlm ra( on(4altrxf tadomt  ivs ()truoirpiodap  mieia()srtrur ;t1tlxn f3iyslaDrmn o;(0trxomr iodfaDran ils0s2to(r3nudlmeemnes () 2rax pot0openmfetltlm em(mpnu4altoir oadfpte u i;()sexr(r3oudlptnmietl() 2tmu  no1aeeomfeilt m2rmnvp u0 rtoxr oadfa  ai o s)s2toxo oo4llenlics s)artau  ;u0oexoiictlsls2eanvsnu)artrxr ia1fmtraues;t)srtmir3iu1aptn fcia( a2rmum ot0oexnio3tat sDeln s;t0aetrmf oydomDraueo t  exmio3ou1al   iet ( sruaumpou4aex mf3iyt a um(vs u)artnxr3iadlpt  neol(  exrir3no4al e ietltfsDrm(m oo4aptnmi3ilt mDeau on()aetniocoadfp rlivo t)srtr(o iodlp nmnei t sDuaxmpoo4opeoio3iytlmDumnvpn()arxoxr to1lmDeauvilt0s2toirpiu4apen neils artru ont1tet moctas a2ul( o (4 etomocta1lmDr iei;t0 2trxr3io1llen fei ()aDtm(r ;t4olxn feiatls ua(vp;u) etnxr oodfaDrluvo;( tetmxr3oodopen nvsa( a2urxr nu0ale mieild a2uanmp;u4 etrif3tadlp eai slt0 rtmim3iy1ll elnesasfa2uaum no1tlen o3iytls2ranmp;t4arxrxr3totfm rlu i;s trumim iu1op n nviat srrrump;t4altnio3iydls2elumsn(4texrircootlpte nes;() ruoxr no4ope lici (f Dtru  ou1alxoifciytfs emn pnt)altrirciy1laDelieslt) exrim3iy4lptnmfetat) rrrx  nt1aexn ieiaslm elu s;(0 eerioctatlmDr uvols) rtmxr oo1optnmfctas srrmxmp;o1tetomi3tat a rl(vpn(0artrmf3tadopD  nvo;()sruo(r3nodapeemnvi t  2trxmo;t4olxo f3iltls2eauvpnt4 rtrifcia1oa   n olt) 2uoir3oudllt lnci (  Draum no4altomf3iat sDrau s;(0alerxr io1lmDrlnes t  rtmxm ou4optnlfcs s  Drm( o;t4tptoiictyt a2rl(vonu0 rxrir3oydomD  ivs;s  ruo(r nu1amt livsa(faDtr(mpoo4oee ifcilt a2rln sn(0 lerir3oydfp raieo;s)t2urxm3oy4lm emnet (  Durxm ;u0ole  fciytlmDul(vs;u) renir oytlm   neo t s2uo(m oy1lpenmfetl()aDua(  nu4altniicildlmDranmsnt) reomr3oa1op  aneo;t0s2urxm3oy1om   ivsas)s2ra(mo;t0aexniociytfm2ua(ms;t0alermocootfptrau s s) euoxm3oudom elnci tfa2ua(r nt4oetoiociyslsDrlnmo;u4 etrmf3iadfp ranvi;() 2xm(rpnodomt  fvi s srua(mo;u0tlxo oeiadfs2rlnmont4aeeomr3oa1laDraivilt) 2ur(o3nu1apeelneta() Dumxmo;u1texn f3tydfm elnmp;u4 reoxfcta1lpt  nvs;() 2trio ny1ll n neia()srtm(  ;t1oeenmi3tydfa2eluvo t)alxnif totfpDranvo (0s2toiopio4ap n feias srtaxr ou1opx  f3iydlm2ua(ms t4 rermr totoaDrauvi;t  euoiopiy1lmt  nvs ( sDtrump;o0alenifctltfm2em(vs t) ltomo iodom  lieo ()tetoimpiu1altn fci s arur(m ot1oeenio3iatlm2rmnvsnu4tlxnxf3tatfpteli s;s0trxoio3iydlmt miei s arrm( ooo0aeeoio3iatfmDemn s u)arxoio tydfptranes s0srumxm oo1oltnmfcta(f Dumxm ;o0openif3iysfa2eln o;u4 rtnmf3iotoptelies;s  2uoim3oy1opte iciat)aDtr(  ;u1tlxnmocilsla2emu p u)tetrmoctadfaD livols)setrxr nu4om nliei (f rtmuroot4tlt  iciydfa2ulu o u4artniocoy1opD ai o t) 2tr(m ny1openmneilsfsrrrurono4aeto iciltlmDul(vsnt4tlenirciatoaD aueo;s sexmir iy4openlfvs t  Dtauront0oeenmieilslm emn s;u0trxrxf tatla   iei;t)trumir iy4am  mfes tfsrum( o;u1olxn oeias a emu p;() lenxf ia1lpDrli sl( srxrir3nu1oleelictltf 2ta(r ;o1oetn fcias s ua(mo (4arxrmfciodfaD lnei t) exrxopnydaptnlnctl()aDraumpnu1aeeoiieilsfmDumuvo;()trxnxr3oa1faD lu o;(  2xmirpnu1lpe  fct (  Dtr( onu1altoio3tld m2rlu on() etnmr3oy1oate ivi;s)s2toir3ny1op emnct s) 2trxmo;t0tltomieilsfm2rm(vp u0teeomrciytfp rauvo;(0t2xo(o oy4ap   nesat  2raxro;o4ape miciatlm2emuvo;u0tetnifcoadlpte uvs s sexoxm ny1amt mnvi ( aDraumo;t4tetnmi3iyt a uluvsnu0 eermfcio1fa raueo t t2to(m3oo4amtemnvsat) 2ra( o;u1tlx moeiyslm rm(vs u4trtomo iy1opt lnvi t)teurimpoudole  nvi t)sDtmxr ;o1apxnmicild m2rau sn(0areomf3oa1latranei;(0trumim3iudamte fciat) 2tm(  nu1oeeoii3iytfa el(mpn(4alerif ta1opD  ueols0 rxrxm3oo1lp emivta() rrru o;u0apen fcias s2ran sn(4aeeomfcoytfatrlivs;s)tetrxmpiu1open ivia(fsDurumpou1oltnif3tatfa emnms t4 etnmo3oodfatrlu ilt0t2toirpny4lme  netatfa2uaum ot1tpxo o3tldla ulumsnt4aleomr iadla ran sls s2xmiopiudal   neil(fsrtaurp;t0aet mi3iys m2eaumo;u)texnmrciytop eaivo s0s2toxo3ou1ap n ivtl( aDtr(r no4tpe ioctytfsDul(mpnt)aexniocoy1om rauvolt0trurxm iu1apen ieias)arur(rpnu0tpen ieildfm uaump t4 lxrio todoa  livsl(0srur(r3oy1lm   fcsl(faDuau poo1alt  ociat a ul(monu4artrif oydfat luei;() 2urir iudlptnlnvsa(  Dum(  ;t1olx iieiadla2umn s ()tlxoxr tytop r uei;s0s2ur(opny4amee ivi s) 2tmur ;t4olt mi3iltfs2ranmp t4artnir3iodlptr nvs;()t2xmio3ou4lpeeliei t) 2ra( p;o1olxoifciydla ulnmo u4 exrmr3oydop eluvi s sexm(m3iy1lm  lnvta()a2um(m oo0oet  fctaslmDul( sn(0 renmfcoatopDeauvi;() 2toim3iudlleemivsa()s2uru p;t0tlt  ieiys s2raums u0 lxrmoctatfp raiesl(0 2xoir nu1lmtnmfcilt)a2tm(mpoo1olt mfeiaslmDrauvs;t0aexrir3iytla r u sl(0s2to(m3iudlpt mnvias arurxrpno1optomfciat s rluvo u0alerif3to1oateluvo (0srxmxmpiy1ap  mictlsfarumx  oo4tleomf3iyt a eln o;u)texomo tatfat auvi;s trtoiopoudlpe  ivt tfarrm(r ;t0olx  oeiaslaDeluvpnu0trerxrciodfmDrlivils0texo(m3oo4aptnmnesa(  Dtm(rp;o4tpeo oeiys mDrlums;u4 lenxr3iotom ranvs () rumxo3iu1alen fcslt aDurx  ;t0aet  ieiat aDrm( o u0trxnxf oodlp rau o;(  rxoimpny1al nmict t) Duaum ot4altn o3tlsfa ea(vs t0aetomoctatopDr i ilt sexmxr no4amtemici (  rtrum ;o4openioeiytfaDra( p ()aexoif3totlp r uvsl(0 2xrimpiu1ame mfesas)a2ur( o;o4optoii3tytfa2emnvs u4tleoir3todfa  li s;s0tetm(r oydlp elfvt s)a2rrxrpoo0tle if3ias a2rauvon()artrmo3oodlat  iei () rumxo3oy4al  miesat)aDrax  no0open i3iadla ua(ms;u)arenif3ty1opteaues;s) etmim iodlltelfei tfs2tmu  nu4tlt mocilslm2rmuvo t)tltnir ootlpD  i ilt)setoxr iu1lptnmicilsf rtrxr ou4alto o3tys a2ul( s t4tlenxr iytfmteai s (0 2uoxm3iy1ol  mfei tfa2uax o;u0aetnif3iytls2rl(vp u4trxnmrctodfptrlneo;() etoimpio4al e nesas)sDuax  nu1aleoiictld sDemn o;u)alxrir3oydlpt ai o (0truo(m3iu1ap nmfetas)aDra(mo;u4tlxo feiytla rm( o;u) renmocoa1opDeaiei ( s2ur(r io1apenmict ( a2trxm ;o4olx  f3iyd m el(msn(4tleomo3totfmtelueo;t0 2toim3oy1lpte nvtlt)s2tr(ro;t0tpx mieiydfm2rmu p t4texrxr3oy1op r uvi (0srto(o oydam   ieil() Dumumoot0opto feils a2rl(mp;u4teerxf3to1op  lnesls0setmim3io1opee nes t a2ur(m no1aeen o3iasla em(mp;t0aeeomf3ootfa   uvo;(0teurio iu4ole  fes (f Dtmxr ;u1apeomfeiytfaDemumo;t0arerxf3oydlateliei ()tetmio3iy4amenlfvtas)s2ur(rp;t4tltomiciltls2uluvpn(0 rxnmo io1fm e n i t s2xrxo3oy4apeeliciltfaDrau  nt4alxniieias a2em(vs;() rxnxfciatoaDrlneo;s0 euo(o3nu1lm   ncs sfa2rrxmonu0open f3taslsDelnvonu4tlxrio3totlat au s s trxo(o ou1lmtnlnctlsfsDuaumo;o4oexn feias sDumn p;(4trermo to1fa rlnei (0 rxm(o no4amenmiei ()sDrmxmpou1oltoiietltfsDrmumsn(0 exnxo3oodlatr nes ()trto(o nu1omen ncsl( sDtr(mo;o1apeo oetadfm ua(ms t0trtrmrcoy1fmtr i o;s)setrxm3iudolee ncils s2tm(  ;o0tpxomf3iad s emuvp t)treoxfciy1om eluesls) eum(m3oo1amee ivsatfartrum ;o4teen f3tldla eluvo t)aexomf3to1oateaues ()tetrir ou4lmtnlneils sDraurp;t4tleoii3tatfm ea(vo t0texoir3ia1lmtelu o ( trxrxmpio4omee fctas)srrr(mp;t1apxniieilsla2uluvo;u4 etoif totlp elueil(0tetriopoo4omenlivs t)srumumpno0oexo feiydfmDul(vp (4 etoir3iydlpDe u o;t)tetoxo iy4ll n ivtasf rra( p;o1ape  ictys a umu s t)trxrir totomt  uvs t s2ur(m3no1amee ivi ( sDtaxmp;t4tpxn oeiaslm umn s t)trxrmr3oy1opt an ols0tetmir nydlpe  ieiatfsDurx  oo1openmiciasfa2ulu s;(0trtnio io1fmteln sls)s2umxopiu4lm nmivtls arrm(mo;o0olenifeiatfm umump;t4 reoiocoy1fat luvo;t)trtmxr3iudal nmfcsl(faDra(mpou1tee mf3iad a rmu pnu4aexrir3ty1lp e uvilt  2xoxmpiudlp emfvil( a2ur(m ;u4tetn fciysla2rlnvs;(4arerio oadomDranvs t0s2uoio3ou1olenlfctas)arrru  ;t4tpxoio3iatfm elums u4artoif todop r ues s  2xrxo3nu1llt mivtas srrmum nu4opt iiciltlmDea(vp u4 reoxf3iydlaDeauvilt)s2xoio oodam n fei ()s2uru  ;t4aexo iciys mDea(mp u)tlxnmo3oatom rlu olt s2tmxr3ny4lltelfeiltf Dta(  ;u1oexnmociysla um(mpnu0areoirctadfat aivols0seum(m3iy4al  livi s sDurx  nt0altoioeiydfm ea( p;t4areomo iytlateluvs () etrim ny4lpe micsls  rrm(mpnu0tpe ii3ilt s2rlumpn(4treoifcoatop e u s;t)seto(m iy1lmt  ncia() rumx o;u1tpxnmf3ias aDuau s;t4trxoircoytoaDelnvol(  rxrxm ny1optnlnvslt a2ta(  nu1ole  octld a ul(mpnt)arermrctydomteluvi;t)srxmxm ny1openmfet s)sDuaxrpno4aleomo3tas aDum(vo;u)trenif oatlpDrai s ()trtmxrpio4opee ictlsfaruru  nt4openmfetlsfmDem(msnu4alerxr oatoa elu i (  exrim oy1oltnmnes (fsDrmumooo0tptoiociaslm uan o t4texoxo3iytfaDe nvi s0 2ur(o3no4lltn ics tfartmxmp;u1teenifeiyd a2em( pnu0 rermfcoytlmDranvo;t0s2xrxr3oo4am  livi (fartrurpou1tlt ioeiadlaDumnvs;u)alxomo iytfaD auvsls srur(opiodll e iei (fs2tm( poo4tpxoii3iys aDum(vsnt)aeerxociydla e ivols0 rurimpiu4opt  fctat aDur( p;t4apt  fctadlaDum( o;t4 etnmr io1lpDrli o;t trumxr no4lleemfetlsfa2ua(moot1altn o3ilslaDrmu s () rtrmf3iytopteanes t)srtmxrpiodomenmivs (fsDtaxm ;u1alx  i3tlsla elu s;t0 ltoif3to1lmDrlieil(0s2xrxm3iudll  lfcslt sDrm(rpnu4tet iiciad m eaumpn(4artrif3io1laD ai s;s0t2xoxr3oo4olt lnetatfsrumuroou4apeo icils m rlu onu)tetnmr3totlptr ueol(0t2xo(o3oydopen fei t)srurxrono0oexomi3tatls2ua(vonu) leomf3iodoate nvils)teto(rpiudll  lfvsl() rrax onu1oetnioetasfa ulu p (4 rtomociotom  li o;t0trtoxo nu1ale lictlt  2trxrooo4oexn ieiyt sDumu p;t0alxnir3iotfmtraivi s0srtrxrpoo4am  lnct ( srtmxr ;u4opx mictlt a2ua( p t)trtrio3oydopt  ivsls sexr(mpiu4apt lietlsfaDtmxroou1aee  f3iydfsDra( s t4arxnmo iodlptrlnvil() rum(opoy1apt lfesls  rur(r ;t4opt  f3iasfs2emu o;(4teeomf iodla eluvil() 2trxm3ou1am   nvsas)aDur(r ;t1apen ieiyd m2em(mo;t)aexnif oo1fa rlivs;( s2ur(m3oo1openmfctasfsDrrxm ou4tpx if3tad a2rl( p u0 rtnxrciodfatrlies t)seto(o nudlleemicslt)arurumpot0aleomicilsls2ra(ms;u4aexoxo iydlmD au s s0sexmim3oudlltelivt sf Durumont1oexoioctydfs umnvo u4 eenmociy1la raivi t)tetrirpiudaptemfetlt aDrrxrpoo4olenmi3tltfm2uanmp;t) rxrio3iadfpDelnes;()s2um(mpny1lpe  ivtl(f Drmu pno4tpxo fcildlm umn s;u4 ltnifcoodfpD luvi t teum(o oo1amtnlncslt)sDraur ;u1apenmi3iltfs2rl(vp;u4tleoioctydfmDe ueilt)trtr(o oo1openmfeil(fsrua(m ot0aetoiieiys m umumont4treoif oadop rlu o s0s2xmir3oydopeemncsat a2taumpnu0tlx mo3tysls2ra(mp;t) etnir tytlmD lneil()s2xrir io4lpeelfvtat a2raum no4open fetlslm uanvo;t4aexoif3oydomDrlu il(0trto(o3oy1ameelnci t)a2rrumono4ale moctadfsDel( s (4trxrmocoodlmt lueol()s2xoxrpnu1alen neils s2rau pnu4ape mo3iyt a em(msnu0tltnmr3oa1lm rlivils)srxrxr3iy4op  livslt)a2tm(rpoo0opxniietlt m eanvp;(4tlxrircto1om e uvi ()s2xo(r iu4am n ivtatfsDrr( pou0opx iicildfs uaumo;u)trerxfcoytfmt anvslt)trxmimpou1olen fctas) rua(rpnt4tlenmictytfs2rmumont4trerxfctotlaDran s;t0t2tmio3iu4lmt mfcs (f 2tax  ;o0aetoii3ilt s rauvo (4tlxoioctodomDeau il( t2um(o iy4opt mfvt s)arum( onu1tetoioeiatlsDuauvo () lerxo3iydoptrluei;(  rxoxopnu4lptn ivtat) 2trx pnu4oeen oetysfm emnmo u0tlxrif3iatfmteaneo (0t2xr(opnu4aptn fcsa()srtrum ;u1tpxnii3tldlsDel( pnt4 lenxr oy1lmt ai o t) 2xoimpnudap nmfetlt)srtm( poo0ope ii3ilt s2eaump;t0 rxrxf tydfmt luvilt sexo(r3iydlmt  ieil(f rrau ont1tpx iiciysfa2rm(mo (0 etrir3ootfpteau i;(0teurir3oy4om   icsatf Duau ont1tlenmieildfs em(vp;t4 lxoxo3oa1fa  lueo;t) 2xrxo3io4llte ivtas)sruaxrpno0tlenii3ias m ranmo t4texnmfcoatlaD anvil(  2xr(opiu1lm emfci s) Dtr(mp;t1tltn o3iad aDran pnu) exrmr ta1fp rlnvo s0srtmirpiudalt lfvi t)artmu  ;t1optnifciysfm rlu o;() reoir3iadlm r nvs t0 2xoio iudomeelici (fa2ur(rp;u1aexnifctldla2ra(vo t4alxnmr3totfa  lnvo (0 euoio nydlmeelicslsfarraxr nt0olxo fctas mDranmp u0tltnmo3iytla raieo;s)trur(m ou4ole livslt) 2umxront4tpeniictys mDulnms t)teermf3oydoatrlneils tetmir3iydlmtemfctat  rtmu o;t4alxnifciydlsDeanmpnu)treoxfciotfmDe ieslt  2xo(r no4ome  nesltfsDtrx pot0tptn i3ilsla uan o;(4tltnxrcoydopD  ieo;s0trtmxm3ny1op   nciltfsrta(moou0oltoiictadfsDrlumpnu) rxomo3oatlpDeaneils0s2xrxo3oy4lpenmfci (fa2tax pno0texnifctaslmDeaums;(0 renmfciadfptrli s;(0sruoirpiu1apen ncs s sDtm(rpoo1olx ifetaslsDulu pnt4arxnmfciy1fm   n s s0s2tr(rpnudoptnlfci tfartr(m nu4oleomoeilslm2ua(ms;u0 lerio oa1oa rln s ()tetrim3oo4aleeliviltfa2umum nu4oetomieiasfm2ua(mo (0areoifcio1la eln ilt0srumxm3oo1olen ivsl(fs2trxrp;t4oeeomoetys m umu snu0arerircoodoa  li olt srur(o nu4ll  lfeslt) 2uaxmont0tptnmoetasls2uan snt4 etomo iy1opt anvi ()sexoirpnudlpt  fes sf Dtr(r ;o0aexn o3tlsls2umumo t0tltnmfctodfpDelueo;t0sexmio3oudopt mfcilt  2rm(m no0teeo o3tydla emnvo;(0altrif3oydop eanes;(0srtriopiy1lme  iesat)aDtmu onu4ape  o3tadfa uanmo;() lxrmf todfp   nei;s teum(rpnu1ol nmiesas) rrmx  nu4aex ifeiydfsDelu sn()arerifcia1fmDrluvil(0trxr(r no4ole mnesl( s2rr(  ;t4apenmoeildlm2rlumo t)treniocoatopD  u o (0t2tmxo3iudll emfvilsf 2rmum nu1alt  i3tlsfaDrmn s;t4 ltrir3iatla eaivo t)teuoir oy1lmenlfes s)srtmumo;t4olen oeiydfsDelnvsn(0 exrir3to1lp  aueo;s)t2tmxrpnu1lmtemivsl() rtrx oou4oee  oetlslm ran o u4alxrmo oodoat aivi;s0s2um(o3oo1lp n nesls aDrmx p;o1texniicilsla2rm(vs;()arxnxf3oatlp   ivs s0 rtoxm3oydaltnlicia( aDrrur ou0teenmoctytlaDelnvo;t) etriociydlaDr i i t)s2uoim no1olt  ncsls)a2uax pot1aptnmo3iadfmDrlnvp t4treomf3ia1latr uvsl(  rtoio io4am emfvil()srumx  oo0apt ioeiytls2ua( o;u0 reoifctytfat  n o;t s2to(r iy4ale miet t sDtmx  ou0oltomi3iasfaDel(mo;(4 ltnxrcta1omt livi;(  rtrxm iudlpt  nviatfa2um(r nu1oexnmoetydla2ua(ms;()tlermf oodlaD  u i;t trxmxm3oo1alt lncsltfartaumo;t0tee ifetadla2ul(vonu)aexnmrcta1oa  auvsls setoim oudop e fet s aDra(rpnt1aetn ictydls ulnmpnu0 lxrmf3to1laDranvi;()sexmim ny1ap  lici s)a2trur ou1oexoiietasls2rlu onu) etnifcio1la  anei;()seuoim iu4alenmnes s) 2trx o;o4teto iciysfs um( pnt4alxnio todlptr ieo;() 2tmxo3ny4al n fct (fs2umum nt0aeen ictyd mDumnvo u4tltnxf iytomtean ol()t2urxopou1op   ncil(fa2ra(  no1aee mfciadfmDul(ms u0 renmf3oa1fpt ai s s t2umio iu4opeelfvtas  Dum(r ;o1oleomf3iadlaDumumo;u0aeermf3oodfat ai slt seurxopio1ome  fei t sDrm(ro;o4aeto i3iatlm ra( p;() lxnir3iydoa r n o t0t2ur(opoodllenmnci (fs2trx pou4aexomi3ias a em(mp;() rtnxfcia1fatelnes;t)t2xmimpoy4amee icia(f 2rmumo;t1olen ietys s raums;()trxrxf3to1oatraivs;()s2toim oo1amtnlfcs s)srta(  ;o1tltniieild s ranvsnt)areoioctadlmt  uvils  rtmxo3iy1ole lnei s  Dtmumpno1tle iociytfm2emn s;(0trtomf tydlpte ueil( t2urim iodoptemfvtlsfaDtmumonu0tpe iociyt a2elnms (4 lxoxrciatlpteai i s)sexmimpiudape mfes t) ruax ont1optoiociyt s eaumo u4alerif3ta1lpD  neils)s2ur(r3io4lm  lnciasfsDra(rpno0tee  o3ilsfa ulu o;u4 lxnxocia1fmDranvo (0s2tr(rpiu4llt mict t) rrm(ro;t0tlx io3iytfm rlnvsnt4texnmocoodoatr ivsl( teumxrpiy1amtn netl()s2rmu  ;o1open ieildfs ea(mp;u0alerir3oatfpt au i;t0truoio nodlmeelfcta()sDrr(moou1olxo o3iltlsDumnmonu0 eermf oatop  ln ol()t2ur(opou1ap  mnvilt a2rau  ot1aexniocildls umuvo;(4aetnmociydomDe ivo s) exm(r nydlpenlicia()artr(m nt4opt iictyt s2ua(ms;t)teermo3oytoat  neo s0srxr(opiu4ap elnci t)s2ua(  nu1aeto ictlsla ran o;u4 eeoif3iotomt lies;( seuoxmpiu4apenlietlt)aDra(ro;t4olxn o3iasfm2em( s;(0 lxoifcoa1fpDran s;(0s2tmio iy1lme  icils)artrx pno0optnmf3ias a umu snt4 rerio iadlp e uvs t0 eur(r3oudlmenmnetat srrru onu0ale  ocild s rauvpnt)tetoir ty1lp r i i t) 2xmir3ny4lmen ictl( a2rm(root1tex  o3iltlm eluvp ()alxnirctatfmte ivi (0 2uoimpno4op n nvtl()sruaumonu1teenmoeiydls2emn o;t) rerxf oydopDr i o s0setrir nu4olt  feta( srrmxmont0ape mfeiytfm2emu o;t4 lenir3todfa raivs t0s2to(o3ou1llt mfctas)srtm(mpnt0teenmo3ias m2umuvs;t0aexomocoa1fa  lieo;()srur(rpnu1aptemnetlt)a2tauro;t4opxn feiltfaDrmn s t0alenxr tatlpt lnesls0 2um(rpiu4oltnlivi ( a2raxrono0oeeomocild s rm( onu)tlerxf oodfa   ies;t trxoim iu4ol e ietl(fa2uaumpot1aex mietat mDrmu s;t4aetrxf3iotomtran il(0tetmxm3iy4olenmfvi t  rurx o;o0opeomo3iytfm2eanvp t0aexnxr todfm   ueo t trxm(o3nudlptemfvi (farurumo;u1aex iocildlm2uaump;u4arerxo3iatoaDrli s (0 2uoxr3oy1ol  liviat)aDtrump;t4apt  oeiydla ul(vonu0artrmoctatomDrlu s;t t2to(r iy1ll n netlt  Drr(r ;o0aeto fcias s2uanmo;u)treoir ia1fpDe ies t t2xm(o ny1amen fvsa( srurx p;u1aleomfcilt a eln p (4 etnmrcoytfa  auvs;t) euo(o3iudlmt mnctat srua(  ot4open ociydlm2rm( s t4alerifcoatlaDelueol(0 2to(o oydaltelieslsf 2uaxm no1opxoioetlsfmDeluvs;u4arxoxf3to1fptrln o t setrxrpoydopeemnvt sf rurxroou1aleniocild sDua(ms;(0artrxo iy1fat  ieols0trxoxr3no1alte fvs ()aDtmxmpnu1apeoiociydfmDeanvo;u4 exoxfciatop e u o;s0setrxo io1om nlivtat)aDtaumoot0aptoifeiadfaDran p u)trtrioctytfateaies () 2xmxrpny4opt  nviasfs2rmxm ;u4opeo ietlsls rmnmsn(0aexrir3iotfpt an s;t0s2xr(r iu1ap n nvsls arum(m no1tlxo icias aDuanmsnu4 eeoio oa1oat luvs;t)texoxrpnu4ll  lict (faruru p;u1oeto fcils a ea(von(4 rxnmf3oydlptrai sl(0sexrio3io1apt mfetat  2rrx  no1openmoeilslm emn s;u4arxrif tytfaDrln o;(  euo(mpnu1am emfesasf 2urur ot0oetnifciyd m2um(monu)aetnmf3iydoa r n o;s) rtrxo3oo1lltn fesat aruaxr ou1olenmoeiatfsDua( s u) rxnxr3ia1fmDraivsls t2toxrpiy1lm nmnetl() 2tmxmoot1ale  octltlm2rm(msn(0tltnmo oydom  lueo ()sexoir3iodolee nvil( arrrur nu1tltnioeiad mDeaums;u0tlerir iotoaDrlieo s  exo(mpoy4ale  fvia() Dtax ooo1tpx iietytfm elnmo;t)alxrircty1lptean il(0setrxm3io1al   fcsls) Drrx pnu1optn ictldls el( s u)aleoxr3oydlp r i slt0srto(rpiy4amte ncslt a2tauront0aeenmoetatlsDemnms u0tleoir3to1fmtraneil( srtoxr3iudaltnmiei ( srurum ;u4oltnioeildfmDelu o;u) rerioctatfmDrauvolt teuoir3ny4ale  iviasfarur(  ou1opt mf3iyd s umuvo;(0tlenmr3tydfa r ueilt  exo(r iudalen nviltf rta(r nt1tetomoeiatfaDraums t0 eenio tadlmDranei;s0trxrxm3iu1ol nmieilt  Dururp;u1tetoifeiyt s eaumo u0arenxo oytlpDrli o;t)s2xoim3iy1optnlnvslsf 2ra(mo;o1tetomo3tldfsDrl( o t4 exnmr ia1fmt  n i ()seuo(o oo1amt lnvt sfs2ra(m nu4tleomietldlmDeln p;(0teenxr iatfa r uei ( t2tr(opou4lmenliesatfa2ua( ooo1ape io3iasfs umnvs;u4 exnmfcio1oa raivs;t  rxrir nodlpte nes t) Drmu  ;u0olt iietlsfm rmu s;(0aleoxoctadlat  ueslt setrim3iy1opt mivtltfsDurx  nu1alx  iciatfm2ua(msn(4 eenxo3iodfmtrlu ol()trtmirpiu1am nmfeilsf rraum nt4tee mfeiltls2raumo;(4aexnxr3iotoaD lneo;()teumxmpiu4opeemictltfsDuaxrpot4oet ioetasls elu s t0tleomrcoatlatrlnvilt)srxoxr iudamte nesa( s2taumpou0apxoif3iaslm emuvs u4 eenxo3tatlm  luesls) euriopny1lptn nvsl()sruax ono4tetomoeiatlmDrlnvp () rerir3todop r ivi t  2tr(r3oo4opt mfctas)aDumx p;t0olx  f3iytls2rmu onu4 rtrmr oytoatrlu s t0texmxrpoydlm e icsat) 2rm(rooo0altn i3ias m2el(mp;t0 reoif ia1lptr n il(0 2xoimpoy4open fvt t)artax o;o0teto ocilt s2uan o;() etomr oytoaDeaivols)sruoxopoo4llte fvtas)s2uaxm ;o4texnioeiyt m2ea( pnt4texrmfcoadoa e ivo t)trtr(o3ou1am n fvtlsf 2rmxro;t0aee mo3tasfs emnmo t) leoxfcia1op elues (0s2xoxopio1omenmics (  Dtru  nt4tltnmfctasfmDrl(mont0alenir3todom e ueslt)seto(mpio1lm   fctl()sDraum nt1opeo ietydfa ea(mpnt)trenifctotlp e ueo;()seumir ny4lle mncilt)sDtrxrono0aetnmfctlt m2emnvont)aeenxrciytoa   iei t  rto(rpno4lmtnmncs (f Dtaxm no0tptn octysfsDem(mp;t)aetnio3todfp  anvi s  euoirpny4ol nmfes t  Durxmp;o0aleomo3iysfs2rau p (0aetnxo tatlm  ln i;()srtmxm nudam e fcslt) Dtaumonu0teenioctytfa2eanmo t0artrmrcoo1oatrlnvi t) rumio iodlpen ncil()s2rm(rpoo4oex mocilt m umu o;()arenmociodlat  n i;t trxmxopiy4aptn nctatfsDuru ont4texoiociyt s2uanvo;t4aetnxr3ty1lpteaues t  2urxm ny1oltelfcsatfsrra(roou0texn f3tad a eaumo;(0alxrio ootfmD lnvsl()srtoxm oy4oleelnviat)sDrmurooo4tpenmi3ias a2rl(vp t0 rxnir3oy1lpD  iei s0tetrxr oudom nlivia()sDrmu ooo1olx  oeiyslsDra(mo;(0aleoxr3iy1fmDrai i s seumxo iydlleelivils s2umumpno4oee ifetydls em( onu4artoiociydfaDraneo s0 etmxrpno1ole mfei s  Dua(mpoo0tlen oetld s2ua(mo t) renircoa1lmD  i s;s t2ur(o3ou1op   neias) Drau ont4tlt mfciyslsDrl(vpnt0 lenxo3oydfpDeaneils0 2uoxm ny1ap emfvsat)s2ta( pot0ape mo3iasls2elnvpn() ltoxo3io1omDelnvi;( teur(m oudlptemieslt)s2rmxrpoo4tex mo3tltfmDelnvonu) leoxo oatlmDean s s)s2urirpio1lleemfeia()sDur(rp;o1tle mfcilsla em(vpnt0 etrxrctadlm   nvs t)s2xoxr3nodope  nciat)a2tm(mpnt4tle iictyt s2rluvp;u0artomf oa1oa  auvs;( tetm(o3oudomtelncsatfsrrrurpno1oetomf3tytlm2ul( o t0 lenxocoatfmt lnvolt)s2toio3ou4ll nmfctasfs2tm( pnu0tlxn oeiad sDel( pnt)aeermrcoy1lp  li ilt0s2xo(o io4lp  mfes s aDtmu oou1alxn ietldfs2rl(vo;u)trtnif iatfmt lieols trxoio nydlle  fviat  rrrxr ;o4oetnifciytlsDumnmp;(0 exoifctodfpteaieolt  exrio iy4lm  lfetlsfs2urum ;u0aptomieils a rmuvp;t0arxrxrctadopD aivil(0 eurxrpiu4ale mfct t aDum(mo;t1alt  oeiysfmDeanvs t0aetoxf3tatomteli o;(0s2xoxo3nodlp nmietatfs2trx  ;u4ope mfeiysfm uaumon(4arermr oa1fa eliei ()truoxr iydam nlivsasfa2umx  ;o0ole mi3ilt mDuluvo (4 ltrif ty1fa raivi s) rtrio nu1amt mici s sDrrxm no0aetn ocildlaDelnvo u0texnmo tatfa eaivols0s2uoim iudamtn fesat aDumur ot0opt mi3iatla uln p (4tltoif3ty1lpt  i i;s0tetr(m nu4omenliciasf Dta(rpno1tetn oeiltlm ulu snu4arxnifcoatfaDrlnvi;s  etrir iudlle  ivs sf rtrum nt4texn fciadfa2ea( pnt0trtoio3oatlaD luvo s0sexo(opny4al nmnesasfsrraumono1oexoio3tat s2ea( s t4texoxo iotlp eaneol()setoir ou1op n fcias a2tr(rpno4tpeomo3iysfa2eauvonu) eerxo tadoaDraivolt) rurxrpny4lle mneiasf 2uax onu1aetnio3ild m2el(ms;(4tlxriocoodlpDrlu il()trxoxr3oy1ame micsl()srtaxrpno4oeeomfciad m2em(vo;t) ltrxr iydoaDr nei s t2xr(o3no1oleemnct (fa2taum nu0olxomi3tyslsDum( s t)texrifciadopDr nvi s  2tm(mpny4ll e fcilt)artmx o;u4tlx ii3ild m2ean o ()alxrif iydomt aies s)t2umimpio4om elivi s arumxrooo4open o3tldfmDua(mp;u)aeerxrciy1oaD lueo;() euoxo3oodamee ict tfa2rmx pnu4oltnmi3tltfs eanmont0aexomr oy1fa  aueol(  exmirpiudom elfvt ()aruau oou4tpt  feiadls2uan p;t0 leoxo3iytfmD anvolt)trtrir3iudop n fvt t) 2tmxr ou0oleoif3iatlm emums;t4arerxf3oo1faDr ivi t  rurio3iodape miesl( s2rmu  nu0oltn i3iyd s2emu s u)aexoio3iydoaDr neo;s0 rum(mpio4lpt  ncil()srrmxrpou0apt  feiadfs em(vo t) etrif3oo1op  aivs;s)trurir iu4omee neil()aDrm(r ou0apeomieiatlm rl(vont0altrir3oytlpDeln o (0 2xmxmpnodapeemictlt)srtmumpou0ale mfetasls el( o u) rxnmo oytfpDe i o t  2xo(m3nydll elfvs () Dta(mpno4tpenif3ias m rau onu) leoif tytoatrln s ( s2toir iu4ope lfcsat srtr(moou4tex ifcildlaDul(mp ()arxrmr oo1opteaiei () rxmxmpnydolt lfeiasfs2uax onu4tle  octlt a2emnvo t0 rxoxfctatfaD lieolt  rtoxopnu4am  mfvsltf rur(moot1opeoiietysla el(vs;t)aetnio oydfaDrlu s;()srto(m3no1amtnlnesatfs2raur ;t1alxoif3iatla2emnmpnu4alxnxf iydlm   u ils)t2xrxm ny1amee ncs tfartrumpot4olt ii3ild a el(mo t0texnxr to1fm  auvilt0t2toim3iy4lpeelfes t  Dumx  nt0oetoii3iysfsDemums u) eeoxr oadlm e ivil(  ruoxo nydoltnmieiat) Duaur nt4alto feiad m emuvs;u0arerxf oadoaDrai sl(0s2xoxm3no4lm  lieiat s2raxrooo1aex  fciasla rmuvon(4 reoxo todlmDran ols) rtr(o3nudop  mnvilsfa2taxmo;t0teeomieiadfm umumo;()trxomo3to1om  livsls)seuoxo3ny4openmfes sfa2tmuroou0tpenii3iysfmDemnvs u0tlxomocoydlpt livs;()t2xo(m3nodol elfeil() Dumumooo4alxoif3iydlm uau onu4 rtrmf tadoa raiei;(0srxm(m oy4altn ietat) rrrur ;u0tleo fctadfa2ean snt0 rtrxrcoatfatr n ols)trxmim iudlm emnesa( a2tmx oot1tpxn fetat a2el(mo;t4 ltnircoadoate i sls0srxrim nodlptelnetat)aDtmx o;u4oltnmiciatfsDua(vp;t4texoxfciotlm   nvo;() rxr(rpno4amtemfeslt  2ur(mp;t1aptn f3ias mDranmp (4trxoxf3tatoa  aueo s  rum(m3no1omtn fvta( sDtmxro;t4oee mo3ilsfsDuauvon(0aetrir3oatoaD lneol(0 2uoir iudllenlncsatfs2uaumo;t0aex mfeilt s2rl( o;t)artoxf totfmtean ils0 2xrxr3iudop  lfci s) 2rm(m no1opxomf3tasfmDuanvs t)aleoxr tatlpDrau s ()trxrxm no1al  mncta() rum(m ou1altnifeiydfmDrmu pnt4aeenmf3io1fpDrlnvi;s)tetrimpoydomtnmicil( srrmuronu4olx  oeiat aDelu pnt)altnxf totopteluei t s2to(mpio4lmee icsls)sDrmxmoou1tpenmfciltlm2rl(vs u0arenmf oodlat  i i;s  etmxm3iu4ome lfvt (fsrurxrpno1oeenif3tat s rmnmsnt)altnmrcty1fm   uvi;s t2toxr iy4ope  icsat) 2rrxrpnu1ole  fcias m ranvp ()tltrmf oydlmDr uesl( s2um(m3oy4optelfvs ()sruax pot1tetoif3ils mDel( s;u) rtoxf todfpDrai s s0trumxmpoydome liet s)a2rrur no1aexnmfctydla elnvo;t0trtoxr3iy1fmtrli sls t2tmir3nu4op nlnvtl(faDrrxm nt1tee ifeiadfm2ra(vp (0aetrmo3ta1om ean s ()s2trxm oudap n ivtasfarrmxm ou1ale  oetydlmDrlump u0trxnmfcoodfaDr nes;t  2toimpnu1optnlfetlt s2urumpot0altoifciat mDra(ms u4arxrmo oatfmtrluvol()trxrimpiy4alenlfcta() Draxrono1texniicildfs2rl(msn(4altnxo iatoaDrln ols) rurxm io4ol n iet s a2tmurooo1ole mf3tatfsDumnmp ()tetomf3oatfpDr ueo;( t2tm(o3ny4amenliesas)aDur(mpot1oeeomociltls eauvsnt4tetomfcoytlpt ai o;( texr(rpoy4alte icsls sDururoot1alt mf3ilsfm2eln s;t0arerirciydomt  ivi;s0 2toirpiy1ale lfeils s2uru o;u1optnmi3iydlm ulump ()trtrxocoodoptelu o;t trum(rpio1ll nmnesltf 2tr(rpnt1aetnmf3iatlmDemn on()trxrxociy1opteauesl( sexoim3io1op   fetas  Dtau  nt1tpto oeiatla ua( p;u4artomf3oo1fpt ln o t)srtmio3no1am n fcslsfs2urx o;u1opxomf3ilt a ea(msnu0 eerxo3ty1lpt  iesls0 2uo(r oy4oleemivsatf 2raurpnt1aex  i3tltlaDuanmo u4trenircoydfpteau sls t2um(o iu4ape lfctls)arra( ont1tltn i3ilslmDrluvsnu4texnmr oytopDrln ol(0 exrim3iy4alt mfctlt sDrmxm nt4tlxn icilsfa2rl(vo (0alxrmr ia1oaD aiei t0 2trxopiudlmtn ivi (farurxro;u1ope  octytfs2umn o;t4trtrmrcoa1oaD an i;s  rxoimpiu4ll   feiltf 2ra(m ;t1ope ioctytlm2rmnmpnt)aleoifctatfp r nei s  euoimpnodom   fvias)a2um(r ;t4alt mf3iyt mDean s;(4 reoxociytomD  ivi s0s2xmxm3ny1ape  fcias sDtau oou1openmf3tasfs2umnvsnt)texomo iadom rlnei;()setoiopou1om emnes ( aDraumooo4oexomoetasfmDuln o t0texnifcio1la elivi;t)s2toim io4al n fcilt a2urum nu0tpxn i3tat m2emnmo (4 rtrmf iy1lp  lueils) 2ur(opnydal n ncslt)aruaur ;u0tpeoif3iad m rmnmpn()tleoif3totlmt aues t  exrxo3iy1omtnlnesa()a2um(rpnt4tptnifeiltlaDulnvonu)trxoxr ia1lat  nes;(0s2ur(opno1op  lieslsf rtmu ono0texnmoctysfm um(vsn()alenif tadla   nvols tetoxo ny1lpe  iviltfs2urumo;t0tle moetasla ean ont0texnir to1fat an i ()s2uoirpnudaptemfctlsf 2rr(rpnt0aeenmiciytls em(mpnu0 ltnmfcoa1lmDeaivi t0t2trimpnu1ole  feils) Drmumpoo4alx ifeiasfsDrauvsnt0texnif3iytlpte ues;t  exrxmpio4alt mfcilt)artr(ro;u0opxoiociaslm ranvsn() lerio3totoat luvil( trxmimpoodoptnlnesa(fsrrr(mono4optoioeild sDua(vpnt0texnmf3iytlmteli olt) 2xm(o3io1opt mneilsfsDrmxm ;t0aeeo icils m2ulnmpn(4 etrxfcta1lp raiei;t  rur(m3no1open net t) rrru  ;u0oetnifciadls rmn o;t4aetnmr3ty1om r uvo t0 2umxopiy1apeelfviatfs2rmx  ;t1tet mietysfa2eanmo t0 exoir oo1fptrai s (0t2xoxrpnu1lpenlfvt s  2rmx  ;u0alxn ieilslsDum(monu)arxrxr oydop rlueo s  ruoio nydal emnvta() 2tm( p;o1oexn ieiltfa uau o;t) leoir iotlpt lneols)seum(m3nodlptelnvsl()a2rr(mp;o0teenifeiaslsDeaumo;(0altrio tatoa r neo s  rurirpio4llt  ict t)srurxmpnu0ale mictys m2elnms t4 ltnxrcio1fmD lnvils)t2urirpny4olee ici s sDurx pno1tet mociltls2emnvpnt)arxnxf ia1omte nvi;t sexoxm nu4lmen neias)s2urx  ;u0olx mfeiat mDrm(vs;t0artomf oydoa elieo;s0 rurxmpio1lpt  ncsltfs2umx pot1tlxn i3tad sDrmu ont0teeoir3iatomDrlu s;(0 eumxm oy1lp e netls)a2tr(mo;u4optoioetltfa umu pnt)tetrir oadfp  auvi t) etrxo3no1omt lfvslt s2ta(mp;t1opt ioctatfa umnmo;u0trtnxr io1fpD  n i;s) ruoxopoudoltelictat s2trump;t4ale ifetasla2rm(vs;u4aleoxf3tydlpt lnesl( srxmxr3iu1oleelict s  2tmumont0apxomo3ils s ua(msnu4texniocoy1opDrai o s) rtrxm3io4lleemicil()arua(r nt1teeo i3ildla2rmuvo u0tlenirciy1lp eanvils)setrim oudll elivtat)arrmurpoo0tex  ociys s2rmumpn(4 rermo iatoptrlueolt0srurim3ou1olt lfet (fsrtm( p;u0oeeo f3tydlsDrlnms t)aeenirciytopteai slt)tetm(r3nudolt mncil(faDtr(m ot1teen f3iatfa2ran pn(0tetrxr tatlaD  nvilt seuo(m3iy1optnmnct t sDuau p;u4optoif3tysfa2rlnvpnt)trtnxf tatopDr ivs;t s2xrim iy1opeelfvtasfa2um(rpoo1aleo ieiytfm umu p;t0tetriociytlm rlneil()setm(r3ou4al  mivta( s2ur(  nt0tlxn ieiasla2ulump (0treoir3oadla r ies () 2um(opou4omt mfeta()s2tmu pot1oetn feildlaDum(mpnu4 eenio3iodfptraivs s0s2tr(o ou4opt mietls)sDrau oou4olt iociysfm2uauvo;t)texnxr oy1oaDr nvols)sexmim3io4al e nvsls) 2ua( oou0tetn oeiadlaDrauvo t0 rxrmr oadlmteanvs;() rxm(r3no1amenlictlsf rumu pot1oeto f3iytfm em( pnu0tltomr iy1lmD an i s)s2umxopio1llee ncias)s2rm(rpot4aeeniicild mDemn on()texrmo3totlmD  uvolt t2to(o3iu4amt lnet ()arua(mp;u1opxo icilslaDrlnvo (4 rtomo3tytoa r ieo;t0srxmirpnu4alenlieilsfsrurxrp;o4aet mf3ilsfs ran ont) rxnxocio1fm   u ils seumir3iy4oltnlnesatfsDum( o;t4ope ioeiltlsDranvont4tleoxfcoydlpDranvi ( t2uoxopou4amtnmncias  2umxmpoo4tetnifcias s rmnms;(4trerxfcoytlpDrauvo;s)teumxm3oodlmte nvsatfarrrxmo;o0apxo oetas m2eaumsn()alenir tytfp  lnvol(0 exoimpoodam elnvsat) rra( o;t4tleo oeiad s2ranvs (4trenxf3tadfmDrluvi ( t2urir iodamt  fetltfa2umurpot0opx mf3iytls um(vo (4texnmf oatlm eanvsl() 2tmxopio1ol n fcias)aDrr(m ot1opxnmo3iyt sDrm( pnu4aleoxocoodfaDelueilt  ruoxmpoy4lme  ics sfarrmx pou4opt mfciysfa ran s (0tlxrxf3iy1fpD an i;t seuoim nydlmte fvsas sruax  ;u0oleo iciatlmDemn sn()trtoxoctodom eauvols t2uo(m oy1op  mfcta(fa2rmx  oo1opxnmi3tysfa2ul(mo t) rtnxr tatlmDe i olt)srur(o3io1ape mfcils)a2uaur ;t0alenioeiydls2umu p;u0altnmf ta1oa   u o t tetmxr nodlpte neilt) 2ta(r ;u1optn octatfa2ean snu)aetrio3iotfpDrlues t s2xrir iu4omtn fvi s) rrr( pnu0oet ioctys mDran pnu4aetnxo ia1fa  anvi;t  2urimpiy4om nmieils aDtaxrpnt1tpx  fetysfmDrl(mpnu4arerir3tytomtean il()srxmxo3ny4op emnesl( sDuaxmoot4openifeiad m2rln p;t0tetrmo3oo1fmDr ueil( teumir3io1amtnlietas)arumum nu4oee  iciytfm2el( pnu0aeermfcty1om  anesls  rxmxr3oo4amtn ict s sDrmxroou4oet mociytls2uaumo;(4teeoxo iytlaD lieo s)sexo(r oydap emivsa()srua(mo;u0optoifciadfmDuan p;t0 rtrxfctadlm eaueo () exr(o3iodal  lfvi ()sDumxmo;u0alt  i3tld mDulumsn() rxriocoydom rluvols0srto(o3nu4aptnlnci sfaDtmumono0tlenmiciyt a raumsnu4 eenir3oytlmteaiei;(0 etmirpiy1aleelnesl(f rtmuro;o4olen i3tltfa rln on(0altnmfciydlaD lies;s0 rxoxo oudlp  mfeta(fa2ur(r nu0teto f3iydlaDrluvo (0 etrxf oydom elnvo s0 2urxrpny1oltnlivsl()s2raxr ;t4aex ifeiasfs um(vp u0teeomf tydfmDrlu i s0s2umiopou1op  mfvslt) ruauro;o0tleniictytfm2rm( ont)tlxnxo3oo1fmD  iesl()t2triopoudome mnciat arurur nu4tle mo3ildfs eauvonu) lxnmfciy1oat  uvo;( t2ur(r no1omenlicsl( a2ur(r ;o4tpx mfeildla ul( on()aetomo tadoa eln i ( trxmirpoudale lfct ( sruax p;u1tpx mociysfaDra(vp u4trxomoctadfp  li o t)srxr(o iodol elies (f rum(r ou0altoio3iasls2emn onu0arenmo to1lm  livo;t s2xr(o iy1lp n fctlt sDraxmooo1aexnif3iytfa2ulu ont0 exoxf3iodlpDraues;(0t2trir oodale liei (fs2rr(  nu4aet ifciyslaDeauvp t4 lxnmo iydoaDelu i;s) etoxopiy1amtemncia(f Drmu  no0tex ioeiysls2ean p;t0alermo iatoatr ivi t0 2xm(o nodllt  fvs t) 2ur( pnt0aeeomfetys mDeauvs (4treoio tadom rlieil(0 rxriopiudam nlfet tfsrtmx pnu0tleo ociltfs ra( ont0 rerxfctotlp elnvi;t setr(o ny1ame  fviat)aDua(  ;u0tltnmociydlaDumuvp;u) lerioctodopDe nvils tetrxrpno4amtemnvt t  Dum(rpnu4open fcilt sDel(ms u0 reoxr io1faDelieo s0srtoirpou1lp  lfei s)srrrxro;u1teeoifeiasls uan o;u)arxoxr3totopteaivil( srtm(o3ny4op  liet t)aDuax  ;u4tlen ieiatls eauvp t)aexoir oatfmteanvilt)trxmim no4lmtelnvsas sDum(r oo0aetomo3iytfmDrlnvp;u0aeermrciadoptrluvil( tetr(rpoy4ll e icsasf rtrxroot1aexo o3ias s ulu onu0aetoxr3oytlmteanvs (  rtm(rpiu4ope livta( aDtrx  oo0oleniiciltfm2rl( sn(0 etnifciotfm  livo;() 2urxo3iu4aptemicslt)aDum(mont0aptnio3tys a2uanvonu0trenxo oytlaD  uvo;t)srtoxr no4lmte nctl() 2umu p;t1apx mi3ilsfm2emnmont)tltrmo ty1oate iesl() rumxopiy1om e ivtlt) 2rmxmpou4oeenmfetysfa2emnvs;(0 rxnxrctytfmDe uvsl( t2xm(opiy4olt  fcsas)s2tau o;t1aetniociatls eau snt) eerxr iytlm rlneols)tetmim3nodolenmieilt s2tmumpnu0oet  ocilsla eanms;u)aeerxoctadlmteli ols t2tmxo ou4aleelnvsa()artauronu4aeen o3tls m raums;(0 exrio to1fmDeaivi ()srtrxm3iudam nlivia()s2raurooo4alenii3iysfs rl(vp (0aetoif3oatoaD  nvols) 2um(opio4ape  nvt t  Dtr(rono0aexn i3tlsfa raump (0tetnxo iytlaD li s;t)truo(o iy1om elicsat)a2urxrpnu4apxomoctytfaDuluvo u0 eenxf tadom ean i;t) 2tr(m no4omeemfviat) Dtaurp;o4texo ictydls rl( s (4alxrmoctatlp rauvo s0seto(m iudllenlfcsls sDtm(rpou0optniieild aDulnvonu4texnxr tytomt liei;t t2trimpny4ol n ivi t s2trurpoo4oet moctysfa2emu sn(4arerxr todoaDeau sl(0 exrim nodlmenlics s)artmx ont1optnif3iadlsDeln pnt4 rxnxfctotfateanes ()sruoxmpoudoptemivsl(  Dtm( pno4tlt moctydfs2eaumo;()texoxr oo1oaDeau s;(  2trio ou1apt  ivsls aDta( onu0oltnmociytfm2em(mo () ltoxr ootfateanvo;s t2umim3iy1alenmfci t) 2trumo;t4tet ii3iad mDumu o;u0 rermr3iadoaD lnes;s texr(r iudopeemieia(fsDrm( pou0tlen ietyd m2eluvs;() leomr io1optrlu s;s  exo(o3no4omee ivs s  2umxr nt0tle mfcildla2ea(ms ()trxomf tatoa r uei ( trxr(m3no1optn fvtl() 2trx ono0oleoioctls sDrm(vo ()artrxrcoatfpD  nvo s) rtoir nodomenlfctat  rurxmpnu4opxnio3iadfa2el( p;t0trtoircta1fpDr ies;t0 exmiopiy4amtn nvia(fsrtr( p;u1aptn i3tlslmDeanvs (4trxnmrcoadom rluvi t  2tm(r iudale mfctlt srur(  oo4tptomi3tls s umnvo (0texoio oodom eanvs;(  2tr(o oydlle  nvtat)artrx pnu0tpenmf3iydlmDemump;u)trerif3iy1lmDe ies;()srtrir iudame mici (f rur(m nt4aeeoiociydlmDumn pnt4aexnxr oadfpD lu slt0t2xoiopnydale  neilsfsDrmur nu4tee iicilt a2elumonu4tlerir iatoa ranvs s  rtrxo3ny4alt  nvs (faDtm( p;u1tlen f3iltfm umuvsn(0 rxomocta1laDr n ol( srurxr3nu4lmenmiesat)srurum no0opxo feils aDemn s u0trxoxociatlp rlnvol( srtrxo iu1oltemfctltfartm(mono4aet ifcildfm el(ms ()arerxfctydfm r u ilt)srtmxo iodol  lncs sfsDtm( ont0tltoifetlsfa el(mo;u0 rtnir3iotlpt anvs;(  rxrxopiy4lmeemfeias)srtr( p;u1alenmiciadfa rmu p (4tetnxr3oy1lpte ivi;s0 rumxr iy4ape lfeia() rtmx  ou0oetn ietyd m2uanms;u)texnxr iotlaD ln i t  eum(o oydal elnci s)srtm(r ;o4aeeoio3ilsfm2ua(vs;u0 lenxf oatop rln i;( t2xm(opnu1ame  nciatfsDtrxro;o4tpe  ieiysfs2emu pn(0treoioctotopt li i t) rto(r3iy1lm n fesa( sDtm(m ;t1openmo3iatlm emnmp (0arerxfcoy1latr iei;( seuoxo oydllt  fctlsfsDtm( o;u0olx  icilsls ua(vp;u) renmf3totfate nei;(0setoim iu1ope  nctasfarraumpnu0optn fciltlmDumuvo;u)tleoif3oa1om e ues;s) eur(o3iudape lnct s a2ta(m ot0olxn oeiytfs eauvo u4 ltnio3iy1lm eauvs;t)setmxrpiy4ap   fcsas)sDuau pot1texn o3tldlsDrl(mpn(4altnmociodlpteln o s)seur(r3iu1ope  fciat  Dtaum nu0tlx  feiys s2umuvsn() exriocoadla e u slt)s2umxm nodlleemictls sDua(mono1aex  feias s2ea( onu0 ltnmoctydom r uei;t)s2tm(m3oo1oltn neslt aDra(mp;o1oeenmoeias s ul(mont4alxrio3tadlpDr n ols trxo(r3no4aptnlfvt t)srraxm no1apx mictat mDea( o t)trtriocoadom rli o;()seum(r3iu4lpee nvtas)s2ur(rpou1aex iicias m2ran s;() ltrircoa1lm e uei s0t2uo(o3oo4lltnlieilt  rtmump;u4ale ifeils mDrmumo t4tltrxo3tytfmteau sls t2urxrpio1amenlfesl( s2ta( ont1tlenmo3iatfa2em( s () ltnmf iotfa  aivi;s0trxr(o3oy4lltnlfcilt)srrm(rp;t0texn icildls rmnvp u)teenxrctatfmtrlneils0trtoxo oudlmtemneia( aDtaur ;t1ole ifciyt a eln o;u4tleoxrctodomDran o s0tetm(r3iy4op   fcslt  Dtmxmo;t1tltoioctydla2ra( o;()artnxr oa1opDrauvo;s0 rtrxm3iudame mnvsat)sDrax  ot0aptomiciysfm umuvp u0trtnmrcootoptrln i;s texmxrpoo1lmt  fvi sfsrtaurpno1alxn i3tls a uan sn(0 rtoif tadom  au s (0texoxo3nudamtnlivi t) 2tau pou1alx ii3tldfm rlnvo;(4texrxo to1omteaivsls  rxrir3nydaltelnvsa(  rrmu  ;t0apt  ociys mDra( s (4 reomo3iytoaDeaueil(0 eto(mpoydlm n icsa() Dtr(ro;t1altomictysfsDulu p;t4tltriociadomD luvi;() euoxrpio1om n nvias)aDrm( pnu4apxo ieiys s2umuvs u)tetomo ia1fpDe u s t0trtmim3ou4ol e ivil(f 2rr( pnu0apx  ieiydlm2uan sn()tlenio ty1fatr ivs;t) ruo(m nodap nmfcsltfs2tmxrpno0opxoifctyt m eluvpnt)teerxoctydop raieol(0trxoxrpoydllee feil( a2urxm ;u0tlxoiieilslm eaump t0arxomf ta1opteanvo;(0t2tmxr oudlmtn nvs ( aDururpoo0oeeoiietytfa2rl(vsnu0 exrxr3todoptraivi;t s2uoxm iy1opeemivslt)a2rmx  ou1tetomfeiytfmDelumsnu)tltoxo3ty1la eli o;(  2xrxr no1omte fei tfsrrrx  nu4aleo o3tyslaDumumsnu4aleoif ia1opt  ies;s srtoio io4lme mivtlt)sDtr(r ot1open fciytlmDemn pnt) eerifcoatlaDr ueolt0s2xoim3iydamt  ncta() rrm(r nu0tlenmoeiyt m ranms;(4aetnmr3iodomtraneo s0 rxoir3iydal n ncslt)sDurxm ot4tpxnmfciyt a emnmo;t0 ltomo iy1omD li i;s0t2xo(m3oy1ame  ict t  rtrx pno4alx ifcildlm2uau o u) rermfcootfate uvi;s srxrxr oy1am elnesltfsDur(m ou4oex iictys s2rluvpnu) ltrir3iydlate neils0 exrxmpiydom n nvi s)sDtaum ou0open fctlt s2elu s u0 rxrmr totfa r nvi s0t2xr(r3io1opt  ivt s  2umxrooo0aexomieilsfa rmumsnt4 renmr oo1laDrai ilt texm(opoudlp e icslt a2rrxrp;u4oeto icild mDrlnvsn(0tltrxociodoateai o;t0t2xoimpou4om e fesatf rtmxroot0tlt  feiatfs2ra(vp;u4texomr oo1fmDraneilt)trxmxrpno1lpenlivsls a2urxrpnt0oet mieiltla2rl(vonu4teeoio3totoa rlivo (  rxm(r3no4ame mfvta()aruax  ou1oetomociydfsDra( p;u)aleoxfciytlpt au o;s0 2urxr ou4lme mfvil(fsrumxm no0alxniiciadfm rm( p;(0teermo3oodlatrlivo;t0 rxo(rpny4omt lfcs t)srrmxmpou4optnmi3ias s ulump;t0aeerxoctydlaDranvol(  etrir3oo1lmenmfvsl( sDur( ooo4aex ifeiasls rl(mp;(0arxnxo iy1opDrliesl(0trumxr iu1omtemfeiat s2rax ooo1apenmieildlaDra( s;t0aeenxr totfp raieol( t2xmir3iu1ll nliesas)a2raumpou4tpt  o3tlsls2raumo;t4aeenmf3oatlp eauvolt  etmim oo1lm  lneiatfsDrmurp;o0tet mfeiytls em( o () eerxfciatlpD  nvo t0 eumiopnydoptnlicta(  Durx p;u0tlxo oeiydlmDra( snt0artnmo3oodoa e ieo ()trumxo3oo4alenliei () 2rmumo;o1oexnmoeilt a2umums u0 leoif tatlmDeluvils0 2xrio3iu1ol n fcsas)sDtr( p;u0optomoeiysfm2em( pnu0 etrif3tydom rauvs;t) eurxmpny4am nmietls  2trxr nu0oet  ictlsfaDul( o;t4 rtrio iotlmtr ueil(  2uoxm ny4alenlnetat)sDrm(ront4aptn ieiaslsDua(mp;t0trtoxociatfmDr ivo;() rxmir3io1llenlfcsl(  rtr( pot0aptn fctls m2uauvo t0aetoiocoydlpDeluesl()texmxm3io4aleemfei () 2trxmont1altomf3tltls2emnvsn()aetomf tadfp ran s s0teum(m3ou4lm   nvt sfs2urumo;u4aetn ieiad a em( p u)trtnxocoydopt lieo s0setm(rpiodoptelnetlsf 2um(roou1aexn ocias m2eanvo u0 etoxo3ootoa ranei;s  etm(rpoy1ap  lnvi t  2rru poo4tpenio3iyt s2emumsnu0trenxf3io1op   neols0t2ur(r3io1lmee netls) 2umump;o0olxoioeiytlsDuanms t) ltoir io1lmt lueolt0 rxmxopoudlp  lfetl( a2rr( pot1tlto f3tlsls rau o;t0trxoxo3iydomt  i i;s) 2xr(rpny1lm nlnetas srurxrp;o1optoiociytfaDemn on(4artoxr oytfpDeaneols) 2xoxrpoo4ole  icilsfsDtmxm no4tlxnioetys m2rmump u)trenirciy1fpDeli ilt0t2xr(mpou4lle  ics t) Drr(mp;u0apxniieildfa rmu p t0trxrxf3oadlpt  n o;s  rxoxo3iudlpe  nvtas)arumumpnt0oetnii3ildfm2el( o t4 reomrciydom eaues s seuoiopnu4ol elnciasfaDtm( o;u1aeenioeiydla uln p u4aetnmf3oytlmt livslt0seuoxr3nudopt  nesls)aDrrx pou1alt  icildfaDum( p;u)artnxr3tatoaDrai o t)sruoio oo4al emiesas  Dum( pot4tpeo f3iad aDran p;()aleoif3totoatrai i;t0 2tmxm oo4alen fvtat) rraurpno1opx  fetad mDel(vp;(0altnifciotoaDe nvo;t t2umxo3oy1lmeelfcilt  rtrxmp;o0tptnii3iatfm2rauvo;(0texnir3iatfa e uvi;(  exr(o nodomt lnei s)sDum(roou1oexomfeilsla rmnmsn(0 exnxfcoa1laD aneo (0 rtoxo3nydoleeliet ( arrr( o;t4aee if3tltla uln pnu4 renmf to1opDeluvi;t) 2um(o iu4lmt lncilsfsDua(  no0oleoiiciytlmDeaumont4texnxocoo1fm  lnei;t  rtr(r oy1ll emnciasfa2ur(mp;u1tex  o3iysls ulnvs t0 lenxo3oatlat li o;t)trumxr3oy4ll nmnci sf 2tr(moot4oleoio3iadfaDul(vpnt) etnifcoa1la   ueo ()t2urxo3io1llt  net s aDraxm ;t0olx mfeildfm umump;u0trxomocia1fmt livo t srtrimpno4lmtelfcsls a2tmxm ot1oetoifciad aDemuvon()aetomo3ta1lm eaivsl( seurio3oodlp  mnviltfsDua(m no1tet iieiadfm2uanvp;(4tlxnmr iydop ranvslt  exmim3iodalte ivs ( s2ua(r ;t0tlt ifcildlsDrmu p u0tleriocio1fpte nei;s)tetoxo nu1omtn fcsl(f Dtru  ou0texo iciltfs rln o u4texnmr oa1lptrai i ()seur(o io4apenlfvslt a2tmxro;t4tpx ioeiys mDeluvo;t4 lxomoctydfp eaies s  rumio ny1op n fvilt)aDumxmo;o0altnmi3iytls umnvs;(0aetnxoctydlpDraivo (  rxrim3no4oltelnes (fs2tau  nt4oee  f3tysfs2rm(vs;t)aexomr3iodfmte uei;s trxmxm3ny4olt mnvsat aDra(  no4oet io3iad mDrau s u)trxrmo3tadopDeln o;s0 euoxmpio1lmtn ivta()a2um( o;u4olxnmocias a eau on() rtrmfciodfm elnes t)teur(r nu1lleelnvtlsfarrruro;o0aetoiictatlaDelnvpn(0 eeoxocoo1faDrln o;t)trurxopnudamtnlfeil( srtrump;u4teeo ictatfm emumonu4artnmoctytomtrauvsl( t2xmim3oodal n nvsl() rrm(rono0tpeomictydlm um( o u4artnir to1oatrauvo;( setmimpoydaptnlfcia(fa2uaxr ou4tlx  octas s rlnvs;t4aleomfciytomt ai o;(0 etoim iy1aptnliciasf rtru oou4tltnioetadfsDrluvp t)aeermr3todomD ai i s0 2umir no4oltelicsa( aruru p;t4oltoioetls mDum(mo;(4artnmo3totlmtr u slt)srtr(r3ny1lltn iviltf Drm(r nu0aleniieiat s2rluvont4 etniocoadlmteai i s)trtriopiodlp nlfciltf 2um(r nt1ope mo3iat a2uan pnt0alxoxf3iy1fpD li ilt)teurio iu1opt micia( arrru p;t1teeomf3ils s2eau s (0treomo3oa1lmteln i;( trxm(rpou4lmt lfvsasfsDrmx  ot1tee mf3iyd a2rlump;(4tlxoxfctatlpDrlu s;s sruoxm3ny4ap   ncilt) 2taxmonu1alx mo3tltfm rluvp u0alenircoo1oatraivsls0trxmiopoodome  nviat) Dtaxr oo0opt  fciatfa2eauvsnu)aexnxfctotfmte ueilt seuoxo io4opeemfetatfaDrmxmo;o4tpxomietatlmDea(ms ()arxnxr3oy1late uvi;s)t2xmxm3ou1ol emnvsl()a2rm( o;o4tee ii3iasfm2ra(vsn(0 etriocoydfm eluei;(0 2uo(rpnu4lp   fctlt  2tm(rono1tpx  fcilsfsDrl(mo;t0tlenircoadomtraues;s0sruo(m no4opte nvtls)a2ur(  nt0aexn octytla2ra(vs t0altrmr3oo1oat liei ()seurimpiy1altnlnct s  rtm( p;o1oleo o3tatfa2rauvp;t) lxrmf3iydlat  nvi;s0t2tmxm3io1apt licsat aDur(rpoo4oeen fciydlmDeluvs;t0trxnxociatlpD aneil(0texm(mpnu1al  livtl( s2tmxrp;t1oex mociydfmDea(vsnu4aexoxfciotfp elu i t0 2toimpoydop nlivi sfaDua(r no1alxo f3iasla2uau p;t)aexoxr3ia1laDeluvilt)s2tmxo3nydlm elfei s sruaxmoou0oltoifciyslsDeluvs (4teermr iy1laDrauvi () eumio iy1al  lfetas)artmu o;u4oexo fciasla2rl(vo;u)aetnmr tytfmDeanvs;( s2xrir nudam e feia()arururoot4apeomi3iad a ulump;u4tlxrxr 
\ No newline at end of file
@@ -0,0 +1 @@
+n o (  2xr(mpnu4al nmfesa(fs2ra(ronu4opx  fetltla rauvo;(0 rtrxf3ta1oa r u ol( srtr(m3io1ole lneta()sDrax  nt4aeeniietltlaDuanmsn()alxnif3iotoateaivi;()setmxmpnydoleelici s)arrau pot4openifciydfmDuaumpn(4artnif ty1faD  neo s s2xm(m3oudll nlfvia()srta(m nu4apx mfcilslm2rl(vsnt0aeenxrcoa1oaD  i slt0trtrxr3iu4lp n fcsl(  2rau  nu0tptoifetysfs2ea( snu0tlenircoodop eanes t  2umim3iy1ol  lfvsl( a2urx p;u0tlx  ociadlsDrmnmp;t4trtomr oy1laDeau ilt setoir3io4lmtnmici s  rtau onu1tlenmi3tls sDemnms;t0 eerxf iodfptrln s;t0s2tmxo oo1olt lncs tfarur( pnu4oetnmociyt s rmumont4aexrif3ta1omD  nvo s teur(r ny1olenlfeia(  ruaxmo;o0apxn ocilt a ul( onu4arxomr ta1la   nvs;t tetm(o iodop  mnctltfs2ra(monu0tltoio3ildfmDrluvs t0 exnmo3tadfaDraieo s trxm(m nu1lptnmiesl(farraurooo1aet  ociat aDrlump u)alxoxrcoytfmDe ueo s s2ur(opnydlpte ivtas) 2raxmoot4teeo ieiydfmDrmu p (4teenmf3oatfaD luvilt)s2xrxm ou4llt  fetlt)arua(root1opt ifeils a elu s u0texrxo3oydomDeau sls0 etr(m nydap emivtat s2ua(r ;u0altn f3iatfs ranvp;(0areoxoctatop   ueo;()s2xr(mpoydll  mfet sfa2rrxmoou4opt io3tasfs rl(mo u)trxoxr oydfmt luvi t) rtrir oy1om e fcsa(fs2ra(mpno1oltnmfeilslm2uanvs;u4 rtomo3oadla rauvilt)s2uoxm3nudll   fctlt  Drmumoot0openif3tls a uln p ()alxomr oatoaDr i i s0teumir io1am   ieiat artru  ;u0alxoioetad m2rm( s t) rermr iytoptrlieolt  2umio iy4ap n net (  rtru pnt0oltnmf3tlsfm eanvsnt) rtomo oa1fptrliesl()srxoir3oo1ap e ncias sDtmxm nt1oex  ieiatlm raumpnt4altnxf3tydfa rai il( srtm(o io1altemnvslt srrru oou4ope  ietadlm2emnvont)arxoirciydfpD luei;s s2trio3iudom nmiet (faruaxr nt1oetoiictltfmDuauvo () exomf3oodfate ivsls) rur(r3ou4al elfetls aDumxm no4tleoii3tlslsDrm( s;(4artrifctadfp r nvs ( tetr(rpiy4lmt lfeiat) Dtaxm ;u4opxnmictyslm2emu s;t4 rxriocto1laD  uvs s)t2xo(m oo1llt mfvia() 2rau o;o4tltn o3iltfsDemu p t)treomociy1oateliei s trxrxr no1lp  lnesat) 2ra(r nt4opxn ictyd m eluvonu4texoxo oy1fmtr i s;s) euo(mpou4omtnmictltfaDrrx  ;t0tltnio3tys m2ua(msnt0 rtoir tydla elueo;s setoim nodam nlfci tf 2urxmonu1texomfeiatfsDuan pnt)arerir3tydfpDrlivols0t2xrxopno4omt lnei t  Durur ;o1opx mociys m em(vs;t4 rxrif3iatfat lnvslt0setm(opou4lm elivil( s2ra(rpoo0teto fctad aDrlnms;u4tlerxoctytfp ean ols)srxr(mpou4aptn nvsat)srum(moot4apto i3tlsfm um(vo t4tleoxo io1oaDe ivilt t2umio3ny4lmtnlnesat s2trumoou4tetn fcildlm umumont4trtnxr3totoat aivols0 2tm(o3nu1lpe lfvi tfa2urxmpou0ape mfeilsfm rlnmp;u0altomrcia1omDeaivs;t  2urimpoodom emfei s aDrmum ot1teeomf3tyslm2rlumo (0texnmo iotfateauvol(0teuoxm ou1opt livi s aruru pnt1tltnmoeiadfsDel( o;u0texrio iy1oa e ieo;(0 eum(m3ou1ope lietas)s2ua(  nu0apen i3tytfs ranmpnu4alenmociytlaD anvo;s)trxrir iy1amt micia(f Dtau oot0oex mo3iadlm2rmumo;u) exnmo tytfm eai i t  2tmim io1openmnciasf 2uaxr ;t0open ietasls ea(vp (4tlxrmo todopDeli i s)srum(rpiu1lm nmfeias  Dumumpnt0tpt io3tldls2elumonu4tetoir3iy1lmDe nvs;s0texrim3iydole  ict t  Drru oou4tetoiictadlaDuluvs;(0teeoifciadfpteaneo;() ruo(rpoy1llte nci s)srrrx ono1tptniociyslsDrlu ont0alenmocoytfmteaivo s tetr(o oydomeemiet s  Dtm(rp;o4aeeo iciytlaDemuvs u4 lermo3to1fpDr ivo t)sexmirpio4al  lnviat)aDra(moot1aetnio3iyd a rauvpnu)aeenmo3oy1op eli o;s  exrio oo1lpee neiat arur(rpoo4aexn feiltfm2ran s t) ltnir iatlpDeli s;(0s2urirpnydom nmfvi (  2rr(monu1oeeomfeiad a2ea(vont0 rxnxociodlmD aiesl()s2urirpny4oltn icil( a2taxr ou1aet mieiatlm2rlums (0 rtriocoatfm  liei;t tetrir iy1amtnliei s)sDua(rono4tltn ieiltlm ua( s t)aeenxf tatlatr iei s0srxmxo nu1ol n fvilsf rrr(rpno0oetomfctltfsDul(vs u4aleoircoadom  aues t) rxrxm3iu1lmte ivsatfsDtru ont4tpxo i3tas a um(mo (0trxnir3oadfm eaivil(0srtr(r nudal elncslsfs2umuro;t0ope ifciadla em( o;u0texrif ia1om   neo t  2tr(o no1lm n nei tfs2ra(  oo1tlen octldlsDelu s t)arxoio3oydlmtraivil(0s2tm(rpio4amt  fctat  Durur ot1apxoif3iltlaDranvo u4 rtomf oytfa eli ol( setoirpny1lmtnliet tfsDra(r ;u0tptniieildlsDulnvs;t0 ltnmf3iotfmDrauvils0 ruoim oydllte ics s) 2tau  nu4tetnioeils a el( snt4artnmo oo1fp raieils0 exr(r oy4lmtemfvias aDtmxr ou1opx mi3tyslaDumnmp (4aexrxo3tadlp  lnvi t) euo(r3nudamt  nvi t sDur( pou4altoifciadfa2uanvsnu) rtomf iy1lmtrau ilt seurxo oudlmt lieils s2ta( p;t4oexn o3iasfs2eauvpnu0 rxrxr oy1opDr ues t0 etrir3io1aptemnctas s2trxr oo1tex  i3tlt m em(vs u) etoir iytlptean i;t) rurxo3ou4amenmies ( a2urxr ;u0tlenioeiasfaDrmn o u) eermocoydfm   nvil(0trumxmpoy4omt  fctlt)sDumxr ;t0tee ifeiytla2ul( o;(4 ltomfctodlp eaneols0setmim3oo4ap nlnvta()aDra(moot4aetn oeils aDel( sn(4tlenmrcta1lmDeln slt0setrxm3oudop  mfct sfarur(  nt0oexomociatlaDrl( p;t4 rxrif iy1fa   n s;(  2uoxr iu1aptemnctas) 2tr( oou4olxnmfciyd aDrm(vs;(0artoir iotfaD lieols0 rxr(m3nu4lpt  nctl(fsrrm( poo0tleomi3tat m2rl(ms;u) rxomo oo1optrluei ()srtoir3iu1lpe  ici s s2taumpot4ole if3tytlm rmu o u0aeenxrcootoatelu il(  2uoxr ny4apenlnvsl(faDra(mp;o0aetomi3tyslmDel(vont)tetrxrctodfpDraueo s)srurxo3oo1lmeelnvils)aDuax oot4apto feilsla2uanmonu0tltrifcoodlmD  u il() 2tm(r iydom elncil( sDur(r ;t0tet mo3tys sDelu o;()trenxfcoytomt aivslt)s2tr(rpou4optnmfeia(fartru p;t4tptnmf3iasfsDua( on(4arxrxrcia1fm   i o;s srxrxm3nodlp elivils arrmu pnu1apeoii3tydfs ua( s;t0 ltrif ootlatr nvs s)t2xo(o nudlleelncils)aDrr( p;o0aleomfciltfaDum(mo (4altrifciotlmt aueo;() rxmiopnudlp nlfesas  Dtaumpou0teeo ocils aDum(vont4trtoxocoy1oaD  u il( texo(rpiy4lltn ivt s  Dra(ronu1tpx  oetldfmDelumo t) rxoir ty1lm   nvils0setrio3nu4am   fet ( a2umumonu0olxomf3iatlm2um(von(0 lxomf to1fm  au s t) 2xr(mpiu1omtelies t) Drau p;t1apxniociyt mDrl(vp;u0alxoxo3ta1omt  n ilt  eum(mpiy4am  mncils arta(  nu1aexnmi3iadfs rm( sn(4arenxrctydopDeau i;t0texrimpou1lpe lfcsatfsrra(moou1oeeo octaslm emumsnu0texnxr iytfpD  nvslt)trurxo3oudoptnlivia(f ruaumpot0aptnifciadfs em(mp;u)aexrmr oo1oa rln i;t0srxmim3ny1al nlnct t artm( oot1oetniicildlsDua( p;u)altoxr3tydlp   uvil( t2xrxmpoydomee ncils artmxrpoo1tptn o3tad a2uanmo;u4aeenir ia1lp  lnvi;() etmxm3nydapt  iesat aDra( p;u1aptniocilslaDrmnvs t0artoxf3iatfaDr nes ()trumiopoudomtnmics t  2rm(m ;t1opxn fciatla ean o (0 rtoif3oodlmDeaieslt)srumio3oo1ole  fesa( arrm(mp;u0tleo oetldlm elnvs;t)trtomo iadfmD luvi ( truoiopiy1omenmfeiasfs2urxmo;u0tet  feiatfa eanmp;u) rxrmoctydlpte ivi;()trum(r nydamtemnctltf 2rrx ono4aet moeiat mDrmumsnt0trtnmrcio1omD auvo;( srxrirpoo4lptelfciat) Dtrurpou0oex mocilsls rm(vp;(0aetnxo3oy1lpt ln sls s2xrxrpiy4amte netlt)s2umx  ou0aeen f3iatfm2eluvsn(0 rtrio iotfaDrln s (0seto(rpnodol  mictls) Dtaur ;u4oet miciltfa uauvs t4 lenmr3iy1fa   i i;t)seumxr3iydol nlfciat)srur( pou4tpxomocilslm2ulnmsn(4 etoir3iadfaDr neilt)setm(opiy4ap  lnes ()a2umumoou1oet mo3ilsfaDranvo t)artoir3iy1laD ln s;s0trxoimpoo1alte ivsas sDrru  oo1olto oetldfs uaumont)trtoircia1om rln i;(  rtmxm3iu1amenlictlt aDur(r ot1tetnii3ilsla2eln o;t0aetnmr3oodla e nvs ( setoxr ou4amtemicil(  2uau  ;u4olenioctyd mDrmuvo;t0 eermo3tadlmt  i ils)t2tmxr3nudolenlnvias)a2ra(rp;o0aetoifctasfmDrau o (0alxomfctodlm elnvs;s) ruoxr no4lp   nvt (fa2uru o;o0aleoioeiatlm ul(vo;(4 exnmfctodoptelieo;t0srtr(r3nu4omtnlfvtlsfs2trxmooo1olxn i3iltfa ra( s;u)texoxociytlpDrluvo;()sexoxm3oy4al  lfcsas a2umum nu1altnifciltlmDel( sn(4tlenxf iytom e neol( trtriopoo4lm elfct ( a2ua(m oo0alxo ieiydfa2ulnvp;()artnxo3oy1fa r ivols t2xr(rpio1apeemfesa(f 2tau pnt0oetnmi3tld a2ulnvsn(0trxoxf tytomte n ils srxo(opnu4omt mfvt t  2um(  ;t4apto feiys a um(mp u0aetnio3io1omDraueilt0trumxr3iodlmtelieta() Dtm(  nt1texniociysfs em( p t4treoxocoo1lp rau i;()trur(o3nu4llenlivilt aDtrxmp;t0oetn feiltlsDuanmp u4aetnircoo1optelueilt0t2umir3ou4lle lnesat  Dumxrpou4alx mo3tlt a rau p;u0alermf3tytlptr nei s trxo(o3iu4om emies sf 2tmxr ;o1apeo o3tasfa2emumsnu4 reoxo ootom  lu il(0 rtoxr oydame lieil() Dtm( o;u4opxnii3ild a2um(mpnu4 etomocoa1lpD lneo s) rxo(mpiodlm  lfcias) Duaxro;u1tpenmfeiytlsDrmums (0aexnxr oytlptelueolt)teum(r oy1ale  ictltf rua(m ;u0apxo feiasls ulnmo (0teenif3io1fmtranvo t)seto(opiy4omenliet t)sDum(mo;t0aptnifetls m2umnvsn(4 eermr iy1op  anvslt)s2uriopiydole liviatfs2rau ono1altoifeiadlsDuanvp t)trxrmf3io1lpt an i;t t2xoxm3io4lm e nvs t) Duru oot0ole mfctad a2rln snt0 ltnmr iadoptrauesl() 2xm(opnudalt  fet s  2rr( o;o1ape miciys s rluvo;(4tlxomo tytlmDe iei;s)s2uo(rpio4oleemnci ( srrm(r ot0aptnifcildlm ulnvo (4aeenmf ty1oat anvi;t0 rtoxo3iodllenlneiatfsrrmumpno4aptoiieiysfs rmumonu0tetoir3iy1op e uei;s0 ruoim3oydal   neslt) 2ra( o;u1tex  fctysla2rmnvs;u4altrxr3iotlat livi t0s2tr(m3oy4op e fvsl( artau pno1tptn oetyd m rl(vp;(4aexoxr3iatfp elu o;s)trxr(m iudllt  ncs (f Dua(m ot4oetniiciytlm elnmp;t4 reoif oodfp   n i ()trtrxm3ny4op  lictat aDra(monu1apenmieiatls2eluvp u4tlerxrciydomDe u olt  2uo(m3no4ap emieia(faDumu p;u0oetomfcild m2el( onu)aexoxf3to1fpt anvs;t0s2umxopoudlpenlnesa()s2tr( poo0opto iciat aDraums t4 ltrmr3iydop elivils)seto(r iy4am  livias)s2ra(  ;u1altnif3iadfa rmumo;(0 renircty1op  ln ilt0trxoxm3iy1omenmietl()s2tmu  ot1apx ii3ils a2ra( p u4tlxrmr iatlatr ues;t0seuoxopno1am  mivi sfsrtmurp;u4ape moetyd s2uluvs (0aeeomf3tatlpD li o;t)trxoim nodlpen fvi sfarta(mono0apxnmfciyt m ra(mp u0tltrio oydom eauvsl()trxmirpiudam emivs s)a2rrxmpno0opx iietasfsDuln p u0treoif todlm  li s s)sexr(m3ou1lmtnlncilt srrr(mpnu0teen oeiytfa emu s;()tlxrio3oo1omt lu sls)t2urxopiy1lleelics t arra(  ;o1tetnmo3tadfm ran sn(0 rtnmf3iydla  lu o t0 eum(r3nydlmenmnctasfsDururpno0apen oeildlaDumnvp;()tltnirctytlaDrlues;s seuoxr iydal e icils)artrurpno4aexomo3tldlmDraump;u0trtnmfcia1op rlnei;s)seur(o iy4ol n fes t)aDrmurpot4oexomoeiadfs umumont0 lermfcoo1fpte ivo;s srumxopnydalt  fetat  rum(r ou1tlx  fciysls2ranvs;t)alermfcto1laD  iei;t0s2xo(m ou1lptelncs sf Dtrxrpnt4ale iiciys aDea( pnt4texnxo3tytomteluvs () rumxm no1lpte ncil( a2tr(m ;u4aetnmf3iysfsDelu s;u)texoif3iadlpD aivo (0 euoxopoo1olt mivta() rraurp;u0tlto fciyt aDemu o;()alenxf iytlaDeanvs s trurxm ny1ap nmnvtlsf Duaxr ot0oexnif3ilsfa ua(mpnu4 etoxr ootlaDelnes s0t2tr(r iu1lpe mfvtlsfsrta(ro;o1tpenifctys m ranmon(4teermo3ty1optrliei;(0 exo(r3iudomtelnesl(f 2rrx  ou0tpeo feildfsDuaumo t0trerxr3tatfmt lu i s)seuoim3iy4om  livs (fs2uru  ;o0tee iiciydlm eanvs;t0aeenxf io1om rai i;s)teurim3oydapee ivsas arraxmo;u0oltnioetydla uauvp;t0 rxomr3oatlmteai o s) rxoxr oy1ap  mfviat s2uaum ou1apxnifciltfs2ul( sn(4 ltoir iadom rln s t)s2tm(opiy1ol e fci s aDtau  ou0aeen ocilsfsDra(mp u0 rxnxociodlptelnvs;t0 2tmir3oy4lle  nvtltf Dumxroot0oet  ieilsla2eanvpnu4 etoxocootfatraivil(0 2xo(m3io4ol elnci s sDraurpnu4opx moetyd m rlumonu)tetoxo3to1oaD  ivils0 etr(r nodol e ivtl(f 2umu o;t4opxoifciadlmDrauvonu0tltrmrctydlaD lueo s texm(r iudopenlnetlt arururo;t0oltnioctasfs2rauvpnt)arxrxo ty1fa rlues (  2to(r iu4aptnmfes (  ruaump;u0tle if3iatfsDemn s;()altomrciy1fmD luvs;(  rur(opio4am nlfctas  Dtrur ;o1olxnifcildlm2eanmp (0teermf3oydfaDrluvol( texrim oudapt mictat s2rau  no0olx ii3tyslaDra( s;() reomfctodlatr n ols0srurir oo1omtnmiet ( a2uaurpno1altnifctlt aDranvon()artomr3iatfmDrli s (0 eumio oodam elnviltfs2urxm ot4oee  ictldfsDelnmsn()tlxomo oodfpD  n slt0t2uoxopiy1lmtemncsl( aDraxrpoo0tlxomo3ilslaDrmn s (0alenmr3oa1fptrluvi;t setoio iu1am emivtls) 2tm(r nt4olxnmoctadfaDraumont4aetnif ty1oaD  ivs s) 2to(m nu4aptnmnvtl()a2trxmpoo1alxnmieiysfs uauvp;u)aeerxrciodom rlieo;( texmiopnu1lp e fcilsfs2uaxrpou4opto ietydfm2ua(vp;u) etoxr iatfpD lnei;t) 2ur(r3iu1ap  lfeslt) rumuronu1tee mfcias s ra( on(0trxoxo3oodfa   ues t) euoxo oo1amtemivslsfartaxmo;o4oetnmiciadlsDrmums;t)tlxrmoctatoatelu sls)srxo(m3ny1ole mfeilt) 2trxm nu0oleo feilsfs rlumsn(4arenif oytfp e ieo;t0srxoirpnydame  ivil() 2tm(m ot1openif3iadla2ua( pn(4artnir3tydopDr neils0tetrxr iy4apt micilsf rtax  oo4opxoio3iat m2ulnms t) rerxr3to1latr n ols)srum(rpoo4ll elfcsasfsDuaur ;t4tlxnioetadlm ea( p u4arxrmf3ta1lp  auvs ()srxmxmpno1am  mnvslt arrr( pno1aee mf3tas m2eau s;(4 exriocty1fm e ivslt t2tmir3oo1ap elicsa( arur( o;u0apeniictltfm2ua( snu) exomocoytlm   uvs ( teumio nu4lmee fvt s) Dtm(rooo1oexnio3tasla2eln p;t4teenirctodoa  lieol( srxoirpoy1ll n ncsls a2ra(rono4oeenmi3tadla emnmsnu0teeoio oodoaDr nvsl()s2tmxm3oydlme  fet ()a2umxm no1aex mictasla2rauvp;t0 lxnxr totfaDr iei;()setrxmpiy4ol n fcs s)srrmumo;u4aetnmociasla2ran p t)trxomf3oodom   neo;t) rtoxmpno1lptelfetl(fs2uau pnt4tpeo ociydfa2em( s u0 lermf todfpDeluesls  exoio nu1lmtnlneslt  2taxmpno1olt mociytfa2emump;u4teerio3oy1fat lieo t) eur(r3iudam  mncslt a2tau ooo4apeomiciyt m2elu s;u)aetoxf iotfp  lnvs (0trxmxr3iy1lmee ivtatfaDtmu p;o1aleomoetadlsDelu o;t) ltrxr totlm e uvsls t2xmir3iu4omt mnetas a2raumpnt1aptniicilsfm uanmpnu0 rtnmrcoadfmt auvol(0 ruo(rpoo1lptelfciasf Drmumo;t4tet mfeiltfa eln p;t0trxnmo3ootopt li s s0srxr(m oy4omee ncil(f Drr(ront1aleoio3ilsfm2rm(vs t)trtnmrctatoa   n i s0trxoxm oy4al nmnctlt) 2ur(ront4openio3iatls2rl( o;u0 rxnmo io1fpDrlnvslt0seumiopno1altn fcil(fs2rrx ont0oexnmiciadls ean pn(0alxnir3oydfp ranei s0truo(r3iydopt lfvtat)s2rmu p;o1tltn fetat mDemnvon()tetnxf3oodomDr ivi ( seuoxm3iudolt mnvils sDtrurpno0opx mieiatlsDuln o;(4tlenxoctotoateluvs;s0s2to(o ny4optemncsatfs2rr(ro;t4aee ioeiad sDrlnmpnu)alxnxf3ia1opD aueslt  exrxopnudale lfciat  Dtr(  no4tee io3tydfmDuaumo t) lxomo iadlpDe ues t t2tmxopiy4op e fci s a2rm(r ;o1oetnmoetlslmDra( pnu)trtoxr3ootfm eanvi;()srumxrpiudal  livils a2rmx onu1ape mfciad s eanvont) eeoxo oodlptr ieo t t2urio oo4al  lnvi tf 2tm( ont0tex  f3ilt m ua(vp;u) ltoirciy1omD  nei (0s2ur(o ny1olen ncs sfaDurxmo;t1opt ii3iatla2ulnvp u)artrir3tydfm  auvi ( trxmxrpnudlptnmnvtlsfaDrax onu0olx io3iad s2eauvs;t0altnxocoytopDraies;s0 rxr(mpoodlleemivias  rtm(moot1aleoii3iad m ulnmp t4aetoifcta1opDe nvo;s0s2tr(opoo4am e fcta(  2uaurpot4tleomf3iaslaDrmnvp () rtnxf3tydoa eaivsl(0teurxm no4lmenlfcsl() 2rau pnt0apx ifcilslaDua(vs u4alerif3totlmDraivs s s2ur(r3oo4alenlietl()s2uaum oo0tlt  ieiydlm2umnmo;u) reoir oy1omtrau ol()trumim3iydamee ivsltf 2ra(moot1tpto oeiyd a rau s (4 ltrxo3iadlpte nvilt0 etrxr iy1alt mnet (  Drm(  ;u4tet  icilt m2em(vo t4tltrxr ty1oaDeliesl(0 2tm(m iudal nlncs tf rurxr ;t1tpe  i3tydls2ran o u0artnio tatfaDrau o;s  rum(r iu1olteliet tfarumumooo0tee io3iad s2ean snu)tltnxrcoatlatelieolt  exm(opiy4lpt  ncslsfa2ur( o;o4aleniociytlm2rm( s;(0 etomr iatfmtelueo s)srumirpoy4ll  mfetatf Drrxroou0alt  iciatfsDrl(mo;u0 lxrif oy1fmDe iei;t sruoxm iu1llenmfcs tfaDrru oou4alxniiciysfsDemu p;(4trxrmf ty1faDeli ol()s2uoirpiudaptnlivia()arurx pot0tleo f3tytls2rmn pnu0 eerir oo1omt aieilt  rtmirpoydam  mfeils)arrr(r oo1oex ifcias a um(mp u)tleomr tytfaD aivs () eurxopiy4ope mivta(f 2ta(  ;t4tpxoiociydfs2rl( s;u4arenxo3iadomDraues ( s2xr(r no4om   neil(f 2ur(rono0aee  icildfa2el(vp;t4teerxr io1lat  n s;t0teum(o nu1oleemfvtlt)srrrumont4optnmieiadfaDel( p u0 etoxo oa1op   ivs;( teuoxmpoodlp n fvsat aDtrur ot4texomfetydfm2um( s;u0 renifciodfatrlnvo;s  exrxrpnu1lmte nciltf Draump;t1tetnmieiytfsDrm( p t0 exnmf ootlpDr n ol(0teuriopoy1ll emfvta() 2uaur no4tet mo3tas m ea( o;t)tleoif tydlp e uvol( setrxm3ny1ap   ivi s)arurxronu1aptnmf3iadlmDumn p t0trxnmo totfptrln i;() exoir ny1om elnei s) Dtr( pot0oexnii3ilsla2ea(mpn(4artriocoodfp  aneolt) exm(o ou1ol emfei t)a2um( p;u1teeomictltla2em( p u4tltrifctodlpte ivs;t s2tm(mpoodomen ivias)a2rr( onu1tlxo ictysfsDumu p (0trtrxo oo1op eaivolt)texrirpiudlpenmnviasfa2tau onu4aetoifcildfa eauvp;u)areoio oo1faDrlnvs;s setrir3iudamtnmnei s a2ur(ront1aptomfeiltlaDraumo ()treoxr3to1fmtr u ils0 rtoxopiodlm  livtl()artmu oot4apt ifciatlaDemn p u0aeerxoctotlpDe neilt s2urir3ny4om  lies s sDrrurpou0texn i3ildla2elnms (4aeeomo oytoa r neo;t trum(rpoo1olt lfviatfs2trumoot4tltomictaslm2uau o t4arxrxfcoatfaDrlneo;(0tetmirpoodolenmfvias)arrmxr ot1optn o3iyslsDrln s u4texoir3oo1opDeau il(0srtr(mpoo1al  lfvia( aDururpnu4tpe moeiys s um( snt0 reoxr3tytfmDranvs s0s2ur(r ny4aleelnvi t)s2um(mo;t4alxnmictysfa umnmpnt4aexoxr3oo1oatr nei (  2trxopiu4alt micia( srum(m ot1apxn i3ild s em( s;t)trenxf3to1lmDr uei (  exriopoo4al emfetltfa2rm(mp;t4oltomoctadfs2eaumsnt4 lxrxfciytop  aivsls0 rumirpiudlmee netas aDururo;t4aleo feiytlmDel( snu4 lermo tydfa elnvol(  rxrxm oydlme lfcsat a2tr( ono4tpxn i3tysfs2ranvs t)teenif to1oa eluesls0 euoio oo4op  mfei t)a2rmurpou4oltoiieiyt m elumpnt0 leriocio1op e u o;s)seuoxrpno4amenmnct tfsDtr(  ou1tleniocilt aDrau snt4trtnxo3oo1oa  li i t0seumxrpou1llenlfei sfa2umumoot1apxniictadfmDrau sn(4alxnif iodfm eaivi ( s2to(m nudamtelfci t)s2tmxm ot4teeo oeiysls2rau p u0tetrio oadfatr nesl( setm(o3iy4ole  nesltfarum(mo;o0alx io3tydlsDumnms;t4altrif iodlp e u s t0srumim nodlm e nci (  Drmxmoot4oetoii3tad a rln pn(4alerif tatoateau s s  2xo(m3nu4ame mfcias) 2raxronu0opxnifeiyt mDuau s;t)tetrio ty1faD  uvo ()t2xoxopiu4altnlnciatfaDtaurpot4olxniocildlm2um(mpnt)artnirciydlm   nes;t0 rxrimpno4lmeemivia( sDra(m ;u1tpto o3tysfm ea(ms;(4teeoxrctydfaDrln s;s teurimpoodaltnmnvs s s2tr(rpoo4aee mf3ilsfmDean p;t4 etomrcoodfmteaiesl(0trurxopnodll emieil()srumxmpnt0olx  o3iydfs rmn pnt4 lxnmo oytopD li slt)texrxo io1alt  fvsltfsrrmump;o1optomocilslm umump (0 lerxo tydopD  ues;t  rxm(rpoodll emnvslsfaDtax  no0oeto f3tys s2em(mo;(4tlxomrcoatlmt aies t) euoio3oo1om nmictltfaDra(ronu4apx  fctytfs ulumon(4 lenmo oytlpD anei t0 etr(o nodom n fviat) rum(m nt4tptomo3tydla2rmums ()texrmo ty1lm eau ols)tetmxr nudolt liesas)s2tmxroou1optoiociydlm2ea( pn(4aleomo3to1lptr n o;(  2urir ny4lpen fctlt srumxm ;t0tltoiietydlsDrlnvonu4 ltnmr3oo1oa  liei;t0tetmxr3oo1ol e ics t)s2uaxm oo4apeomi3tltlm rmump ()aleoxrcoa1lmDe iei;t trumio3ou1olen ietls srurur oo0tlt  ictasla eanms t4 lenifciy1oa   nvi (0texo(m iu1lpenmietlsfsDrm( o;u0oetomiciltfs uauvs t0 renmf iatlptr ieil( t2toxo iy4op emfviltfaDtmxmpou4aeenifeiat s umu o;(0tlxnxr iydfm eau o ()seuriopnydopenlicsls)srra(ro;u4olto ociadlaDeanmo;t)teerif iy1fp  ln s ()trum(m3iu4lmenmict ( aDum( p;t1ale iociys sDumn p (4 ltrir3oytlateaivo s0teuo(m iydol e nvtlsf 2urxrp;t1apt mi3iad s2ua(vs t)texomoctatfmDelies s0srur(m iodol  liei sfsruax o;u0tptomo3iys s2uaumsnu4aexnio oatfpDrluvolt0 2uo(m3oo4amt mnvs () Duaxr ;t0aleo ociydlaDuln sn(0tltrirctodomt lnei;()srtr(o oy4opt mfesl() Draum nt1aeeomfeiydfaDeanvont0 ltoif3oadfm eaiei;s texr(r3no1lptnlnet sfs2umx pnu4tet mi3iydlsDemums (4 rxrmf3oatlaD  nesls s2um(r3oo1al nmictlt  2ua( o;o1alx  fctldfs2eau pnt4 eermrcoydomDeaueils  2xoxm nu1lmtn icilsf rtmu pnt0alt moeiatfm ul(vp;u4tltoxoctatfm rauvi s texoxmpoodopt  ncs tfsDtru  ;u0apxnmocias a2um( ont0 ltrmfcoodfptrlneo;s)trxrxo3ny1ll elnesltfa2tm( o;t1apto oeiad a2rm(vo;u0 exrif3tatlaDrauesl(0 ruriopny4lle miesl(  rumu  no1apt io3tydfsDua(ms;(0tetoir3tytlat lies t0trtoxmpou4llee nvt sf rrauroot0tpt mfetatlsDumump;(4aetnmf3todlpDean i t)s2xmxo oy1ame livslt)srur(mooo1aleomietydfaDrmn s;(4alxomr3oadfatr i s;(0setmimpoudal  lietl(farta(  ;t0opto ociatfm elu s;t)teermr ootomD  ivs;t)tetmxm3ou4omtelnesat)a2urump;t4opt ioeiltls2umuvpnt)altnif3iadlmtrlnes ( t2xr(o3ou1apt mfcsatfaDtr(rpno4oetomoctldfm2uau o u)tetnmr3tydlmteliei s0setmimpnudolenlictat s2rrxrpno0oleo o3iatlmDua(mp;u0 lerirctatoatelivs ()trto(r3nydlmtn ics t sDrmu  ot1ope iictyslm rluvo (4aetoxociydoa   nes;t  rxoir iydap  mncsasfs2tmumpot0tle  i3iadfm2ulu s u4aetnmf3oa1omtrlieilt0s2xoxm iy4oleemivia( aDrm(mpou4opt mf3iadlaDuaumsn()artomo3todfaDeaivi t)t2xrimpno4aleemivsat  Drmxmpoo0apxo o3tldfs2umu s;u4artrifcoa1fatr u i s)t2xoxr3nudolenlictl(fsDtax p;t1alx mo3iadfs2eanmsn(0 eermr3tydfat  ieols0 2trim oy4lptnlncil(fa2ur(moou1tex  oeildlm ua(mo;u)teerir3totlpDr ivols  2uoirpio4lptelfciatfa2tmur ;u4apen oeiyd s em(vsnu0 etnmo3oydop e n o s0 2umim3oy4oltn fct t)sDtrxmpno1tlx mo3iat a rau o;u0tltnif3oytoa rlu olt t2toxo no1aptnlfvsatfa2rmu  ;u0altniictaslm eauvp;u4artrmr3oy1lm   n ol(0srtr(r3ou1ap   fvil(fs2taumpnt0tltniictys m2ra(mo;u0texrifctadoptranvslt)trtrxopiy4op n nciltfs2rax pnu1apenioctatfm uaumont4aexriocoodfmDeaivi;() 2um(opnydlp nlicilt) Duaumo;o1open oeils s2rm(vp t0 eenmrcia1opteluvo;() 2tm(m oo4amt  ncias  rum( ooo0tetnmf3tlslsDrmumo u4alerxo oodlaDeaivs;s)tetmxr3iu4lp  mfet ( a2tr(  ;o4aptoifcildls rm(mp;u)tltnmrcoa1fmDe i s (0 ruoir nudoleemivias) 2rmurp;t4aptomo3ildla2rmnms;() exnir oy1fmD aies s) 2xr(opny4olee nvsas  2raumpot4teeoiocias s2rlumo;(0 etomr ty1oa rau sl() etr(o3no1om e iviasfsrtrumpou4aeenio3ilsfsDelu s u0 ltrio3oo1om eai ols0sexmxrpnudamtelncia()a2rau  nt4texn fciydls2umu o u0tleoxocoadfp  aiei ()teto(rpnu4om elnvtasf 2umxmoot4oltomf3ilsfa2elump;(0trenmo iydlaD lnei t s2urxmpnodlm nmicilsfaDtaumpno4tpto ieild m ua(vpn(4altnio3todfp elu i;t trtoxr3oy4omen iet sfa2ta(rooo1aee iictas m rmumpnt) rerioctadfatelueil( t2xm(m oy4ll  mfcsasf 2umuroou4opxo ictatfaDelump;u0 eenmoctydopteau o;s seuoimpnodomen fct ()aDrru ono4aexnifcildfsDrlnmo () eerifctytopte iei (0trxmxr iudaptn ncs () 2tmu  ;o0aptnmf3iatls2rl( p t4 eenir io1op rlivols  rtoxopiodopenmnvtls)artaxm no1ape  f3ildla2emums;t)areoxf iadlaDraueo s0trxo(o oy1am e netltf 2tax pot0opto ietas a emnmsnt)trerif oa1fm r nvi;t0s2trxr3oy4am   ivi (fsDumx  ou1tpx if3iys a2uanmp;(4 ltrxfcoatomte n sls)t2xoim iodomte icsl( s2rrum ;t4aetomietad mDrl( sn(0trxrxo3iydfaDe uvo;t0t2tm(m ny1apte fei () rrmum no4texn ieiadfaDrln p;(4 lxriocoydopt aivo;t  rtmir3ou4optelncs (f Dumumpno1tltnif3iltlm2uau o;(4trerxo3oy1omt anvo s)setrirpno1lpenlncs (f Dum(mp;t4oexn f3tldlsDum( o (0tltnmo iotfm  aies ( s2xmim3ou4omt  iciasf rumxrp;t4oexnifeils m2el(mo t)tleoxr3iotfatranei;t0 euoio iu1ap   nvta(fa2trxm nu4opx iiciltla2rlumonu4tetriociy1om elnei;(0 etmxrpnu1ame mnvtl( a2taxmooo4opt mietltfaDrl( p;u0alxomrcta1laDr neo ( teurio3ny1alee fvtls aruaurpot4opxomieilsfaDran ont)tlerif3oydlmD  i i;(  eto(o iu1open ict s sDua(moou4tleo ieiaslsDrl(mon() rtoxfcia1fp r nvo;s0s2tm(rpnudap  mnvil(faDtmxrp;o4olt ioeiatlsDeanvon(0 lxoir oadlate nei;(0 eumxrpno1lmee icslt s2ur(m oo1oee mieiydlm2rl(vp () reomfctotfmt aiei;s setoxo3oy1llee ietatf rtaurp;o4oleniocildls emu o u4 leoxo ootomDe nei (  ruoirpny4lp n feil(fs2uaxr ;o4tpx if3iasfs uln p u)tltrxfcoo1lmD  nvi ()setrxm3oydlp e fesas) Dtau o;o0alx iieiytfaDum(mo;u4alxoiociy1omDrai s s0trxrxm nodlltemnei s a2uau ono1ape  octasla2rm(vo u4areoio3ty1opteaieilt0trtr(opou4amt  fvilt)arrrumono1teenmfcild s ul(mp (0treriocoydlptelivolt)t2tmxo nodole  ivt (f Dtru  ;o0tlx  oeiatfm emu o u4 ltrif3oa1lpteli ils0setrxmpoy1ale lnetatfs2urx  nt0oleoif3tyd sDeln p u0aeermf oa1opt  ivs s0s2xmxr3iudlmt  netltfs2ta(m ;o0opx ifctysfs2ea(mpnt) rxrmr io1fmD  nvslt0texm(r oo1lmtelnvsasfaruaxm ;u1tle  o3iytfmDemn o;()tleoio3todlpte u i (0 2xrim3iy1omt  netat)srrm(rp;o0tle  fcils s2ulu pnu0artoio3iy1fa  lnei;t0teumxmpiodlm emfeta(f rrm(mont0tlxniociyd sDua( s u0areoxocoa1fmt au i t t2ur(r3nodomtemivi sfsrrrxronu4aptn o3tydla umuvp ()alxnxfciatomDelnvolt t2tr(r oo4ll  mneil()a2taxroot0tlxo o3tysfsDrl(ms;t0 ltnircoytfp ran o t teurir io4aptnmnci t a2ur(ro;o1aetoioetysfs2uaumo u4 rxoio3tadlaD  ivs;s s2urxm no1aleemivslt)artmxr nt4tpx moeiasls ulumo u) lxrif3iodfptelneslt)srur(m3io4omt micils)s2taxr ot4aee iieilt a2um(vo u4altrxociotfptean i t0 rum(opio4lpeelivt tfsDtax  ot1tlxn f3ils s2uau ont4aeeoxf3totomteluvsls0 rurimpny4optelnci t)sDtaxro;o0olt iocildla2em(ms t4 rxnio3oodlpDe i i;s srxoxo iudomtemfet () Dumuroou0opxomf3iys aDrauvpn(4 rxrif3ty1lmt  uvilt s2urxo3ny4lptelneiasf rrr(ro;o4open ociasfa em(vp () rtomr oytlatelu i s0trxo(r nu4olenlnes (f Dra( pnt4aexo f3iad m2rmuvpnu)trxnmf3tydop   neo;s0seum(r3io1oleelfesat) rumxm oo0alxoiieiytlsDelu o t)trxomociy1opD an ols0 2uoxmpou1op e feta() rrm(rp;t0tpxo fctytfa2ra( s (0tlermr ta1lmt livo;() rtmxo3oodal   nei s) ruaumo;u4alx io3iys a2rauvp;(4tlxnif oadfpDraieol()srumxmpoydll elict sf Drru onu1tex mfciysla2rln snt0 renmr oodlateluvi () rtoxm3ou1lltemfvil(f rrm(rp;u4aeto i3iytlaDrlu pnu0trtomf3iatfat an i;t) exmxm no1lptemfvil( s2rr(mpot4aex  oetadlm2raums;(4trtnxf iodlp rln ols) 2xm(opnydameelncta(f 2rru o;u1oetomictlt s2umnvont4tltnxfctadfa   nvsls)s2umxr3ny1aleemfeiltf Drr(rp;u1opxnmocilslm ranvs () rxnmo3iytoaD anes s0t2to(r ny4lm nlies t)arumx  ;u0optnmictlt m elums;u)alerxo3tatoaD aivo;s)s2xmim oo4amtnmicsl( aDua(rp;u4alenmiciysfs eln on(0 lxoxfcoa1opte uvs (  rtr(m iu4lpenmfvia(  2urxr nu1oleoiiciyd a eanmp;t0tltomf ty1fmtelu sls)seum(mpoo1am n fvsat  Drrumoou4opt mo3iasla2umnvpnu4 ltoif ootopt  nes (  rtm(mpiu4ll e nvslt s2uaxm no0alxo o3ilsls2ul(vo;u0alxrxo3tatoa eau i ( srtoxr ny1olt  ietl( aDraumpno4oltomfeiaslmDulnmpnt0aexnif3todlm eluvi s  2umxo3iodlp   ivsa( arrm(m ;u0texn ieils aDua(vs;t0texoxo totlaDr i ils0 ruo(mpoy4amt lfvsas sDua(  nu4ope iocias mDulnmo;t)trxoir3iydfatrlnei;s) etrxo nu1op nlnetlsfs2rmu oot1aeeo ocils s rm(mp;(0 renxo iatomte nvi t)s2xrxrpiydam elnvs (fsDrr(  ou1olenii3tysla2eanmpnt4 etriocoo1oaDe ueolt)tetrxr3no4am elics ( aDtaxro;u0apen fetadlaDum( o t)aleoif3io1faDelueo;s0 2xrimpnudlp  mneia(faDtaxm nt4apto o3tytfs2ran p;(4 rxrxr3oodfpt  uvo t tetoir iydomtelieiatfaDtrx  ot0apeo iciatla2um( p;u0 exomr3ty1faDrli ols)t2trio3iu4lp elnesa(fs2raxmpnt4oeen i3tat a2rauvp t) reoxo todoa  lueo;(0setmxo oy4lp e nci (  rta( pot1tpxo fciydfsDra(ms (0 ltomf3oytlptrlueo;s) rumxo3io1ol e ict t)sDtr(mo;u0apt iocildfs2ulu o;()tetrmr ty1lat aieo t0 rtmxo3iodlmt  fes tfarrau  nt1ole ii3iatfaDrmn p;t) eeomrcoydfmtean s;(0 2tmxo io1lpt mnvtlt  Drax poo4ole  f3ildfmDrluvs t4treoircta1lm e ues t)t2xrxm ou1lm e fvsat) Dtr(rp;t1teen ociysla emuvs ()teeoifcoydfaDr uvs () rum(r nu1om  mfei s) Dur( poo4olx mfeiyd sDea( snu) renir3totfmtelies;t0trumim ou4am n ici s)aDtrurooo1texn f3ils a2ulump;t0tlxoxo3ty1fmD lnvols setm(mpno1alenlfcsa() 2rmx o;o4aex  i3iys s emu pnu4tlenmr ia1lm  ai i;()srxmir iodaptnmietat) Drmu onu4oeeoiiciltfm ul( s t4trxrmo tytlp eaivo s)t2tmxopoy1amt  ivil( sDtru  ;o0opeoif3tysfm2eauvs u0 lxomf3todoptranvil( t2tr(rpio1lpeelietlt  2tr( ooo0oetnif3iytfa2ranvs (0trenio3iotomt  i ils0t2trxo3iydame miciatfs2tru poo0oeenmoeild s el( p;(4aetnmr3iadlmD ln o;()trxrxmpio1apt mneia( aDum(rp;t4open fetldlmDeau s (4texoircoodomtr uvi;t srxmxr ou1ap n fcilt  Draxrono4aeto fcilt a elumon(0trtrio oa1lm  lnei ( t2xmxr oodlle mnesls)arurx onu1opt io3iad m ulnvs;u0aexrif3oodfpD  u o;( trtm(r3no4ol n neslt)a2raumpnu4oee  i3tyslmDrl(mo u0 eermr3tatomtrluvo s)teuoxrpiu4al elfvtltfsrtr(r ;o0opxoifciltlmDul(vont)arxnxr3iatoptr neils)tetoxopiu1lpte ncils)sDtau pno4tpenii3iys a ean p (4 etoxr ootlp   ies s)trtrim3nodolte fvt (fartmxr ;o4tpe iietas a2uluvo;(0arxrir3tydlaDrau i (0s2xoiopio4am  miet s  rraum oo0oltnii3iat aDrlump t0 ltnxrcoo1lpD aieo;t  exm(o oudll  lneilt)sDtmur nt0tltoif3iytls rl(vs;t) lxnio iotfaDeaueol()s2xrir3oudlpenmivsa() rraxm no0optn i3tlsfmDelnvo u)aeeoif oadlm eaneolt) exmiopiudole livtatfarraumonu1aeeoifetatfs2eanmp;u4aleomf ootlmD lieo;s s2tm(o oodlpt lncs (fs2rmum ;o0oee moeiytla2eln pn(4tlxomo iodopt  u o;t)s2umir oodal n iciat sDta( o;o4alt  oeiadfsDua( s;(0tltnir3tatoat livo (0 rtoim iu1lme micsa() rtrx o;o0oltoioetadfa2rauvo;u4 eerircta1lp eaneo;(0sexrxo3nydom  mies tf Dtr(rpou4aet mfetls m ran o;()artoiocoatlmD aieilt0s2urxopny4ale mnvt ()sDuru  nu4oeenio3tat s eauvo (0 lxomf3tydlp e u il()srtoim3oo4amenlivilt) Dtrumoou4opt ioctls s2rmuvo ()aetnmo todomtr n o;(  2xoxrpoo4ll nmivi s)a2umu  nt0opx  octadlm emn s (0 ltomo iydla raueils0 2tmim iydoptnmies s sruaxr no4apx  o3iltfa2ul(monu0 rtomo tadoa e nvo;()trxo(r3oy1opt lieil(fa2tm(m nu0aexomieilslm2eln onu0aeerifciydlat ln s t0s2tr(o3oodlpen nci (f 2rm( o;o1tlxnmi3iytlsDuauvp (0arermr3io1opteanes ( seumxrpnu1lm  mnvias)artmu  ot0tetnmf3ildlaDumnms t0 lenmrcto1lmDe neslt)srtoim oo4omt liet tfaDtrxr ;u4aeeoiiciaslmDeaumsnt4trxnxf to1lmteli o;s)seto(o no1amt  ieils) rtrx pnt1opxomfeildfa2elnmp t0trenxo3tytfpDe ueo;t0trtoxmpnydlptn iet ()a2ra( oot1tpeo octytlm ulnvp t4 etrir oy1omDeau sl() 2xmirpno4lleemict t aDtmxr ou1apxnmfctadlsDulnmsn(4trenxo3iatop e uvols)teur(r no1lp nmietlt aDua(mp;u4aleo feils a eln s u0tlxoxf tatoaDrlnes;(  2xoxo oydal  lietltfa2tmumonu0opxo f3iadls2ul(vo;()tltrmoctatfm eluvo s s2umimpiodlp   fesatfsDurumo;o0altomf3tyt s ulnmsnu4 rtoioctatom  aieo t0 2tm(r oy1am   ncsasf rtm(  ;o1ole mo3iadfa rmnvo (0aeenmo iydlate uvs ( t2xrim3oydolen nci s  rrmum ot0ope ii3ilsfm uauvpn(4aetrmo tadfp rau s s0 etrim ny4lltn ncsltfs2tr(m oo1tpenioetat m2umnmo;()altoxrctodomDeln i;t) rxrxr iodllt  ivsat a2tau p;u0tpxnmo3tat s em(vo;t)altrmo ia1fpDeanei;t t2xmxo oudoltelnvi t  Dtaumo;o0tlen ocildls2el(vo (0 ltnmf iytfaDeaueo;( t2urxrpnudomeemnvilsf 2uax onu4tle iicilsfs2uauvs;u)alxrxrcia1oaD aies;t) rxoim3no4lmt mfctat  rtrurpou4texo ociydfs2emumo;u)aexnif3io1fatraies t0teurio3oo4ol nliet t) rtaxm ot1texniieiltfm2ua(vs;u0arxnmf3ta1oaDeli i;t) 2xoxmpiydlmtn fvils) rumu oot0olxomo3ild s um( s u0aexrxrcto1laD anvs t srxoir3iu1lpeelnvs s  2ur( p;t1aetn fetlslaDumnvs;(4areomo3tydfptrli ol(0 etmxm3io4lm   nvilt aDumumonu0tetomfetlsfa2umnvon() etnifctydoatr nei ()s2tmxm3iydlpe lfvias aDtrxroot0opx mf3tlsfm um( sn(4texoioctotfm e uesls)srumxrpnodlm nmici t)a2uau p;u4aptnmfcias a2ul( onu) lxoiocoatlmte neilt) 2trxrpoo4lpe lietas srtru  oo4aexomiciad m2uauvp;u0texnxr3oadoaD anei;s)srtrirpno4amtn fvia(f 2tr(roou0opt io3ils s um(vonu0alermociatfate n i s srtmxr oy4omte iesltfaDur(moou0aetnii3tydfa2ua(vp (4 rtrif3tadopD lu ols0seto(o iy1openlies ( sDuaumpnu4tleoioctatlm elump;u0aetrifcio1laDraivslt s2uo(mpiudlptnlnei t aDrrumpno1alxnifeiydls2ua(vp ()arxrirctatoatrlneols)s2urxm oudal elnci tf rumxmpoo1teeniociasfm2uan p t4trtnxfcio1omt li il(0srtm(r no4lmenmnci sf Drm(  ;u1aet ifeiytfs2em(ms;t4tlxrmoctotfaDran ilt  2xrxm oudape mfcsasfsruaxr ;u1tle  o3tltlm um(vs;u)teenxf to1fa rlivs;s srtrxr iy1lm  miesa(fs2umu ooo4texoifctls s rlumsnt0 ltoif3oadoateanvs s) 2xmir ny1lp  livtls)srumx p;t0olxn f3iadls rmnmont0 reomfctatfp  aivi (0srxmiopiydom  mfei ()sDtrxmont1olt ii3ils aDem(ms;u4tetrxrcio1fmtraneolt0sexrxmpou1apt miet tfsrtrxront0olxomi3iys s2ra(vs;(0tlxoxrctodlpD  iei () rumxo iy1lle mfesasf rrrxm nt0tlxnio3iadfs2rau o;(4 eerxociotoaDelneol()teuoxrpiy4llen feils)a2rruront4oetn o3iad aDulnvsnt4arenxr totoa  auvi;s0srxriopoydop   ivtas) rtrur ou1ape ioeils sDeanvont4tlxnio3iy1fptrlnvi t0t2uo(mpoo4omt licils s2tr(rp;u4oee mi3tlt mDeau ont4treoir3iadomt li s;(0sexmir3iodaltelfetls  Dtr(root1apxo o3iadfm2ua(mo;u) rxnxf totlpDrau sls)seur(opiy4lptelfes ( sDurur no4oex  fciadfa rlnvo (0 leoif3oo1latrlies (0s2urio3ny1aptemivsat)a2rru pou4tltnmfctldls2rmu o;u4 eenmf iytom eln s;t texrim3oydolt mfeta( s2trxm nu1aexoio3iatlmDemn o u)arerir3tadfmtelu o t)srumxopoy1apenmfeia() Draxmono0tleomi3ilsfmDul(ms t)trtnmo oytoptr n sl(  rum(o3iodlmtnmieia(f 2tm(rp;t0aexo oeils aDeauvont0teermr tadom rlnvo;( srtmxr iydal  mfcil( aDrm(mono1tlx if3iys mDrmnvo;t0arerxo io1fa  anvs;(0srtrio3oudalen fetl( srta(root4oetomo3tydfmDuaump ()alxrxfctodop   ieil() 2xrxm3nu1lm   fvi ()srtr(ro;t4tpt mfctlslaDelumo (4 rtoxo oy1fm e neolt  ruo(mpiy4omtelfctlsfsDuaxrpnt1tptomoetltfs2rlnvo u)tlxrir totfmDe n o () 2xoxm3no4opeemnvilt sDrr(  ;t0tltnmiciltfa2raumon(4 renxrciydopte n sls)seurirpnudlptemieil( sDtru ooo1alxn iciytfs2um( o u0artrmf3oydomDr iei ()t2uoxopoodope  ivt ( sDtaurpno0tpxn ietys mDeanmo u) rxoxr tatfat  nvs s texo(r ou4op elictasfsrumumpoo1opx mfciasfa ran o u) exomr3ty1lm  aieo;t0srxmim nodlme  ivils)srumu p;u1olto o3iyslmDuaumsnu4 rtrmf3oatfpt  iei t s2xr(r3iu1ale lnes (fs2uaump;o4oeeo i3tad mDrl(vo (4 lermr io1lateai il()truoxmpoydale liei ( srtrur nu1tlt mf3iyslaDrl( p t4aexomo3tydfpD au i t setmim3io1ope  netas)a2tax poo4tlxoifeild sDeanms;(0trxrxfciy1lpD ai i () rum(rpiy1lmtelncsasfs2ra(mpnt0tee  f3iatfa2eluvp (0artomr3oadlptr nvi;s0t2urirpiy4ll  livt ()arumum ot1teeomociydfa ea( s;() exrxf tadopDr ieo s  exmxm3nu4om nlietlt)arur(r no4alenmociatlsDulnmo u) lxrifcta1lm e ivilt t2tmio nu4omt mnvt (fartmxr no0tptniiciytfsDel(vp;t4aleoir3oa1fm e ieilt0srtmxrpny4llt  fcsasfsDtm(ro;u0teeomfcild m2ul(vs;u4tltnif3tydfatrauvilt0tetoxrpoo4lme mietas)a2ta( p;u4apt iieiysfa el(mp;(4 lxrifciy1lpD lu o;( sexo(opnydll nmfesl( aDtm(  ;u1aleo oeiyd s rmnmont0 eenxfcoa1fpt lnvo;s trxm(opio1amtnmnctls  Drmumoot0tlxnmiciat sDul(ms;t0altniocoydlpDr uvsl()s2xmxo oo4op nlfctl(fs2rr( pot1tpxo ictydlsDrlu p;u4 reomfciydla r iesl(0setmiopoo4ol   fcia() 2taum nu4tle mfciyslm2ua(vpnt) exoxrcty1oa rau s;s0s2xr(m3nu1olen fcs sfs2rau o;u4alxoii3ias s2ranmo;t0 rtrmr oadfat an i s)seuoirpio4llenlivtas)sDtrur ou4opt mi3ild a2eaums t4 exnir tydfaD  nei;(0sexmxmpiu4lpt  icta()s2rmumpnt1alxnio3iytlaDemuvp;t) eeomrcootoaD li i s0teuoio3oydoleemnvt ( aDur(m ;o1olx iiciys m2rln snu)tetrxrcoa1opte ivi ( srtr(o oodapt  fvtlt)aDrm( pnt1texnmoeiys aDeau p;t4aleoirciodlmtelu s (0trurir3oo4am emivi s)s2ur(mo;u4ole io3tlsfs ulump t)aexomf3io1lm  ai ol( trxmxm3iy4lm emfvi (  rraur ;o1oee  ocilsla umnvonu4 leomf3oo1op  luvo;(0seum(r oo4amt  fvsat)s2um(mpnt0tlxomoeiys a el( on(4 etriociotfa ean o;s0 eumxr3oo4om n ivsas  2rr(mp;t0apt moeiaslmDul( s u) eeomr oydlp eaneol( srxoxmpio1aptn ieias  rrmumpnu1tee  o3iasla uan snu0 lerio iatfmD lu i s seum(m3oudope lneils  rua(mpoo4tptnmf3tys mDrluvo u)aexoir oy1oaDeluvo;s) 2xrxr nudlmeemivsa( s2trx o;o1tpx  octadlm el(vs (0 eermr oytoaD lueo;( t2xoxopiu1ol elicia( s2tau p;t0olxomfctad sDelnvpn(0artrxoctotfaDelieol( seuoio3iu4ol e fvt s sDtm(m ;o1tle iietlsfaDra(mp (4teeoxf ootom rln o;(0texo(r nu1amtnlfetlt)arta( p;t0tpto feildlaDrauvo t4trtoif ia1opt  iei;s)srumirpiodom  lfcs () 2taxr ot1opeoif3iydls ul(vpnu0 etnio3iytfmDr uvi s setmir3ou4lmtn ivs sfs2raurpnu0oet  oetldfa rlnvs;u) ltrio3iy1omt auei;s  2toxm oy1llt lictas  2rrx o;t0tle  feilsfaDulnms;u)texnmr iy1fp elueilt0s2toxmpno1omtnmnei s aDrm( pnt4alxnmfcils s2emnmp ()teenxo3to1fp  lu i t)s2xr(r oodap elnes s)arumu pnt4apx ii3tyt mDranvs t0trtnifcoy1lmteluvils0srtoir ny1ole lnvias s2uau oot1tpeniicild m2emumonu0 rtomr3ootoptr n i;s)s2xo(mpoodllt lfeslsfs2uaurp;o0openifeilt aDem(vs;(0tetrifctodfmt au sl()srum(rpny1omt mictas)a2rmx  ;t4alenifciatfa ean s (0aexrircty1oat  i s t) etmimpnu1lp n nvta(f Drmxrpnu1openmf3ils aDrmuvo;t4arxrxo iy1fateli olt)seurio io1apen fcsas) Dtmx ono1olxnif3iad mDran o u)tetomfciodlp rlu o s) exm(o iu4lpeelncil(fsrta(m no0opeo i3iltlmDraums t4 lxnxr tydfaD  u o s tetm(m3oydame mncia(  2rau pnt4tltniieiytla2eau o;()tltnxr oydlaD  uvi;t0 2xr(o3nu4omtemfvtlsfa2rru  nu0alxn ieiadlsDulu s u)arenio oodlptrlu i;s t2xoxm nu1alenlncs s) rua(  ou1aleoiiciysls umuvp (0 etoif3tydfp r ueslt tetoiopnudamenlictlsfarrm( pot1oetn ieiad sDul( pnt4aeeoxo3totom  aivil(0t2xmxmpno1lp e ivslt arur(rpot0tltnmietld aDumu p u0 eeomr3ootop e i o;t  2uo(r iy4lp elnvs ()a2trxrp;o4apx mfeildla um(mp (0aexomr3tadoaD an o () euo(o iu4opeemiei t)s2ua(  oo0aex  o3iasfm2elumpnt4artnxr3ia1laD aivo;s0s2tr(o3oo1optnlfcsa(faDtmxrp;u4oltnmictasfs2rlnvp t0 rxoxr to1fatraieo;s srxo(m io1lmte ivsasfs2ta(r oo1tpt ifciytfsDrmnmo t0 rtomr3iodlp r uvo t)srum(m3no4opt  neta( a2uaumoot0tpe mfeiltfa2rmn s;u0alenif3oytla  luvsls0trtoirpno4ap elfct t) ruau o;u0altoiociltla2rlu snu)texnif io1fpD aieils0t2xo(mpoy1lmtn ieta()a2umu  ou4alxnmi3tadfs2uauvo;u4 rxomf oadfmDrln o;t)s2umxrpny1oltnlietl(  Drr(m ot0texnmo3iaslaDuaumo u)areoxrciotop e n o t)sexmir oy4ope lieta( arur( pno4olxnmocildfmDeanmpnt0arenxr ootfp   uvs;(0srum(r iodamen fvsls)sDrmx o;t1opxoii3tas aDrmu o u0texrxr3ootlp r u slt)srtoir no1ope lfcsls sDtmurono0oleo octat sDeau snt0 leomf io1oa r iei (  rtrxopno1ole mivi () rurur ;u0oltn f3iyt m eauvsn()alermf oa1lm ean i ( t2xoxo ny4ol  mics tfa2rm(mp;t1alenmoctltfa emn o;u)alxrir3iydom   uvo;() etrxo3iu4omenmnvs s)aruaxr ot4texo f3tytlsDumumpnt)areoxo iy1fmDeanvo;t trxoiopoy4ol nlfvtltfaDtrxm nu1tlxoiictys s umnmp;t) lerxrcty1oatelu o;s trto(r3oo4al elnesltfsruaur nt1apx  oeildfa2eauvpnt4 ltoif todopDr iei;t) 2ur(m3nydomee ivtasfarumxr nu4ole ifeiyt a rl( o t4teermo3to1fpD au s;t) etoxmpiu4omt lfctl() Dumxmoou4oetomfeildfs2ua(vo;(4artnir to1opDeaueo (  exr(r oodapeemneils sDrrurpnu1oet  o3ildfaDrmnmp;u)trxnmf oatlp rluei s0 2xrxo iy4amenmicsl( arrmxmoot1olenmociltlsDeluvs t4 eermrcoodoaDranvi;()seum(opio1lmt mneias)s2umxr ;o1aeeomoeiysfm rln pnt4 eeriocta1optrau olt t2xoxrpou1optnlfeias a2ururonu0opxo o3iyd m ea(mo ()aeenif3iytlmD lnvs ()t2xrxmpoydaltemfcsl()sDur( ont4apx  ocilsfsDem( s;u4tltnxo3tytopDeln ol( trur(m3ou4openlivta()arrrumpot4tlx  ociysfs ulnvp;()arxrmrciytfmDeai ols0tetoim oo1olt mncil( a2uaumo;u1aptomoetlt a emn snu)trtrmo oa1omD lu i ()tetmio3nu1am e ict sfsDrmxmp;t0oexnmo3ias s rl( s;(4alxnmocootfpD aivolt  rxr(m nydll elics ( a2rm(mp;t0oltoif3iasfs ranmsnu4tlenxr3totlmtr neo;t) rxrxr3ou4opt  fesat  Draxrpnu0ape iietydfsDranvsnu4arxnxo iydfp r nei t trtmxm3oo4ale mfci sf Dta(r ot0aleo oetad m uln p;u)trxoxo3oo1lpD aivi;t0setrxo3io1lmen nvilt) Dur(rpnu4tleo oeiltlmDum( snu4aeeomrcoodlatr n s (0 2xmxmpnu4ape lfvils)a2rmxro;t4olt  o3iysfm2ea(mo;t4texrmo3ootlmDeaiei ()teuo(mpiu4apt  nctat aDtmxmpoo1teen ociyt mDem(mp (0trenio3oatfaD luesls0 2trxmpoo1ope  nvias) 2umu o;t1apxoiociytfm ra(von(4tlxnirctatopteln s ( trxrir3iodll emfvsa(faDtr(r oo1tlen i3iad aDel(mo;u0 ltoifciy1oatr n i () etr(o3io1olen nct sfsruau pou0opt  ociat a rmn s;u) rtrmr iotlaDrliei (0t2uoxr3io4ap  lnct t)s2tr( o;t1tetoio3tyslm2umu s;u) reomfcoydla rlieo ()trtoirpnodlle  iesa( sDuru ont4opxnii3iasls2emumont0altomocoydfp r nvo;s) eurim3ou4aptn nviat)aDumum ot0aeenmoetyt a rl(vs;t0 eeoifciatlpte neol(0s2toxm oydopt lncsl(f 2rm(m ;o4open o3iyt mDrmn on() eeomfciy1lm  lues;s t2xoir nodop nlnet s  2rr(r ;o4aleo ictys a2uluvo;t)arxrif3oo1op   n ils trurirpoy4altnmivi (fsrumxrono1tlx  octld m ul(vs;u4artnxo tydfaDr i i;t)s2xr(o3no4aleelncsls) Dtax  ot1apeo ictatls emumo u0trxomo iydfpDean s s0s2tmxm3oy1om  mfvilt s2taxr ou0tpto i3iydfa2rlums t4 renxr3iydfmDe uvo t  eur(o iu4ameelfesltfsDrmxroot1tptnifciltfm ul(vs (0arenmf ty1fpDr i sl( texrxm3iu4lleemics t artmur ot1aeeomf3iltls2elnvsnt) lermr3ta1fpt  i il(0 2xrim iodlleemnvt (fa2uaxm ;t0alxoio3iltfmDemuvs;u0tetnmo3totoptr ivo s)t2tmim iudaleemfvia()s2rmxm ot1ale ifeiys aDeauvonu4areoxfciydlptr n il()setrxm ou4alte fvs s sDtax o;t0tpxnioctas s emnvs t)trtrxrciydfpD ln o ()seurio3iudop  lnctat) rtmu  no1tpen ociytls ranvon(4 eenircoodlmDe uvi () 2xrxo3ny4omtemfvtls)sDtru  oo0tetnmoetlsls raump u)arxrio ia1om elnvo;s)teurio3no4alt  fvias aDuau  oo4aeeoifctydfsDem(vo;(0 etrmr3iydoaDe ieo () rtr(r3nu4op nmfctl(f Dtmxmo;o1aeto iciadlm uaumo (0 rtnmfciytlm  lies () rxmxopoudomte ietasfaDuaumpnt1alx micild a el( p;u)artnmocoy1optelu i;s t2xoim io1omee fct tf Dum(r ;u0aet  o3iltfsDum(mp;()tleoir3ty1fp e n s t setrio3ny1amte ics (fsrua(rpoo1tleo fciyslsDul( o u4 renmo3oatlatrau ol( s2tr(r3oo1oltn fvias  2rrxrpot4opto o3tad m2uanmo ()arxoir to1lpDeln ol()srtr(opiu1alenlfetltf rtrur nu1aee  fcildfsDrl(ms;t)areoir3oatoaD luvs;()truoir ny4omte ncias  2umxmp;t1oet mo3tytlsDrmnmpnt4areoxr3iotfate u il(0texo(o3oudalte fet sfarrauront1olenmfetls m ran p;()tetnxr to1fmD  ivsls tetrir3iydamen ivs ()arurumo;u1aeen oetyd a2uanvp t0trtrir3ootomte u ils  eurxm3nydlltemfct tf rraxmoot1olenmfctlsfsDrl(mp t)tetnxocty1faDrlu o;s  rum(o3iu4om nliesl()aDtm(roou1oleniieiat s ulnvpn()aetnircoa1la e u sls)trxoxo io4lme mivia()s2uaxmont4oeeo fetat sDem(ms t)trtnio3oydfp elu o ()setoir3oydopenmfes t s2urxm ;u4aptnmfciad s2rmnvs t)tetrxo iytomDrai sl(0sexoxo3ou1ol emicsl()artmump;u4alxoifcils m2um( pnt4 exomf3iadla eanvo;s)t2xr(r iodal e fvs t  Dtr(m nt4aetnifeils a ua( pn(0trerir3iodoa   u il( texoimpoo1lpenlieslsfsDtmxrpno1olenmfeiasfaDeln ont4 rtoio tytfmtelieslt  2toim3io4lme lncsat)aDuax p;t1opto icild a2emu p u0 rtrmr to1fa ranvslt  rtr(opiydapeemfctas s2tmxrp;o4aex mf3ild m2uln o u4trtnmf3oy1omte i i (0 exm(rpoodlpte ies t) 2ra(rp;t1tleoiieiasfs2uan p;(4trenifciytfateliei t  2uoxr3nudlmte ncias)srrmumono0tltnmo3ild mDulnvo;t) rtnir3iatlpDeau o;(0seur(o ny4lpe mies (fsrurxm ;t1ope iocild s2ulnmon(0aeerxo3oydfmteaieslt)s2urxm iudom nmfesl(f Dtm(rooo4apx mo3tysfs2el( on(0altrxo3tydla elnvs s0 rxr(r3iudalt livslt  Drmurp;t0teeoif3iydlm2eluvs t) rtnioctadfa eaivs t0s2to(mpnudal elicsls)a2tmurpnt1tlxn i3ilsfsDraums;(4treoxf todomtelu sl(0 rtm(mpiu1ole mfcia()a2tmurpnu4tpxo ictysfs umuvs;t4arerif3ia1lmD aneo;s)s2um(r3oydlpt lfcias  2urxrpou1apx mietysla2umn p (4 rxrifcia1lpD  u o;s s2urxr3nodopeelicsat)sDum(r ;o1tpxoioeiat sDulnvs;(4alxomfcoadfaDeaiesls)seur(opio4aleemnei sfsrrrxmpno4aee mfciad mDel(mpn() leoio3oytomDeaieo t trxm(o oy1lptnmfesa(f rtaur nu1texniictlslsDra( o (0tltomrcoytfatr ies;t seum(r iu4lmenmneta(fa2tmuroou4altnmiciasls2um(vp;u0treomo3todlaDrluesls seurxr3iodlleemicsl()aDum( pno1tpeoio3tyt aDrluvo t4tltnxrcoadoptrli slt) rtoxmpiu4lm elfeta(f rtrum ;o1oltomiciyd m rmuvonu4tlxnxfcia1fm   neols0t2urxo iu4olen nct t)arurum ;u4oex mi3tldlmDuan p;(4trtoircoydopDraues;s)srtrxmpoy4amt mfctat) Dur(ro;u1alxnmf3iydlm elnms t4 eenxo oy1lp elivol(  eum(m iodamt  ncslsfs2rmur oo1tpeoiictldla ulu o u) rxnxo iatlmDrau s;t srxo(m3io4ap e ivi sfa2rru  nu1teto o3ildfs2umnvo () ltrmocoodfatr uvols0 eum(m3no4apeelivi s)s2rmxmp;u0oexnmiciatlmDem(vpn()alerxr iotopD  u i;t trto(opny4omtnmnetat) rra(m ou1tlxomietltlm2umuvs () rxrif tadfa r i i t0srxm(r iy1ameelfes ()s2tru oou4tpx mieiys m2umn s;() ltnir todfmt  ivs;t) rxo(r3oodol nmivtls  2urxm ;o1tpeoio3tyd sDrmuvs;(4 rxnmr to1fp eau i (0 exr(o3io4amt mnesas)artmu o;t4tlxomictltfs2ul( pnt)alxrxf io1lp e iei t)t2xrxr3io1lm nmfetlt sDuru oou1opxn feiytls ul(msnu) lerio3oadfm  lueo (0setoxmpiu1ameelies s)a2rrx oot4tleoiocilsfm2ua( snu0tltrio3oatfm  lieo t) exrxrpnodal  lfes sfarrax p;u1aetnif3tatfa ul(vp t4 rtrmrcoatlptr nes;() ruoxr3iy4lptemictltfa2ra( ono0tlxomieias sDelu p ()areomf3oodlaDeaneo s)s2xo(r oodlm elictat arum( pnu4oleo feiyt a2emnms;()trenxr3tadlmte nvi;(  2xmir iydllenlieta()srtaxmpno1tpx if3ilsla2rl(monu0trxnir3io1fptraies (0 2umxr nydlmeelfct (f Dtax  ;o4opxo fetytfs rau o;t0alermo3oytopD luvi;t t2xmimpoy4amt lieilsfsrrm(r nt1teenioeildfs ea(vo;u)areoif3todopteanvs;() 2tm(m3iu4apt micsl() 2raxr nt1ole ioeiltlsDran o;u0tltnif3iadoaDran o;s trxoxr nydamen fvilsfsrtm(mo;o4ole  ictltlmDuau o;u0altnxo3io1oa raivs;t)t2trir3oodoltnlieiltfs2trump;u4tetomiciltfs rluvs u0arxomrcoo1fmDeauvo ( trumxopou4altnmfcslt a2rrx  nu4tee ioeiydfs2ulu p t4arenxo3iotfpDrli ols0 eto(r oy1ll  mnet sf Dtm(m nt4oeeoiieiysls2rm(vo t0trxnxf3ta1fm elu ol() rtriopnu1alenlfetas)srtmxront4tlxoiociadlm2eluvo;()trermo3iotlmtrlnei;s0 2um(r3oo1lpenlfct t sDurumoou1tetnii3ias aDel(vo (4 lxnmr3oo1omt  nvi (0texm(r3oo1omeemfcs t) Dua(  oo4teenmfeiatfa rlumpn() ltoiocto1fm elnvs;s seuo(mpnu4ap   netat) rrrxmpnu4texnmfeild m2rauvsnu4arxomr3iatom eanvi;t0trurxm oy4om emnvs (fsrrm(rp;o4opxomfetatfm rluvs u4 leomo tytoatr uvo;t  etmxo3no1ole  fes t  Dtaum nu1apt  fetatfm raump;u) rxrmr3ootfpDrauvols0srxr(m3nydomtemiet s)arrm(mo;u1texoii3iad s elump t)arxrxo3ta1lpte i i;s t2tr(opiu1lle lnvsl(fa2tmxmo;t1olx mfeils s2rl( o u)texoir3ty1fpDranvslt  etmxopnu1lptemivtat) rtmu ont0tpe mfetadlaDuau o;(0aexrmr3tadfaDrlueo;t0 exm(opnodope  neil(  Durum ;o4tlxnifetls a2um( sn(4 lxnxf to1fm e ivi;s) rtoim ou1ole mnvtasf 2uaxmp;t4teenio3iasla ean o;u)trerxrcootlmte n o;s) euoxopnydllen nvi tfaDrau ont1open fciltlsDea(ms;u4 ltoirctotfm  lnesl() rur(m nu4ap  mfct t aruaurooo1opx moeiydfm ulu snu0arxnio3oadfatranei;(  2tmxrpoydlp  lictl() Dur(mpoo1tet if3ias m2uau snt)aexoir3ty1faD luvols)s2uo(r nu1apen fvil( srumxr no1oex  fctld a ranvs t4 leoxo3oatopDe neols)setrir3ou4ll emivt t  Durur ;u1aee  feiyt sDuluvs;u)aetnmo3io1fm ean i s srurim3ou4ap emfeta(  2ururooo1oetnifeiadfa eau p (0 leoircia1fa eanvils seumio oudapt miet t aDumx  ou4aetoif3ildlm2ul(mont0trenxfciadlptelnvslt  2tm(m ou4lp  lnesat) 2rm( pot1tlxo oeiyt s rln o u)trerir3todlatrauei;s  etrxm3oudllt  fvs t)s2tmum nu1aex mietyd m ea( p u) lxrxfctytoaD  u sl(0 2um(r oo4lme  ncsatf Dua(mo;o1olenifctat m umnvs;()trxnxf oatfmD  ivs ()s2umirpio1omt mnvt tfarra(root4tpenif3tls a uauvsnu4aetomocoytlate nvi;t)trurir io4lpenlics tfs2raur ot4tptnmictld m rm(mp;t0aetnmfctadfptrai i;(0s2uoir iy1al   fesls a2rax p;u0aeenif3iasfaDum(mo;u0artoio3ia1om elivil() 2umxo oudamenmneta()sDraxroou0ole if3iasfm ranvp u)artrmf3io1opteau i;s0 eto(r3oo4alt mnetls)aDrr(rpoo0ole ifetytlm um(ms (0trtrmf oa1faDrau s;()teuriopiu1amen nct sfaDua(mpno0oet ioctyt a2ulnmo;(4alxoir3iodoptrlnvs;s)s2xrir3iudlleemfciatf rrrurp;t1aexomf3ilt aDemn pnu) exrmf3iy1lp eanvol( s2xrxo3nu4lpt mfvia(fsDtmx pot0opeomieild a2ulnvp;u0 exrxf3totom rlues s0t2umim nu1om  mnvt (fa2ta(mooo4tpt mociltfm2ul(monu4texrxo oytoateauvils)trtr(m3ny4lp  mfvsat) rua(m no4tpe  ieiltlsDrmu pnu0trtnircoytopD ai i;s0 exrxm iu4lp elfctl(fsruru  oo0tpxoio3iasfmDranmonu) lxoxf3to1oa ean sls t2uriopno1llen ncsatfsDraum ou4ope  oeiyd a2ranvpn() renirciydoatelu i ()texrirpiy4apteliviltfa2trxrp;t0apxoii3iytfs2ul(mp;t0trtnif3todfp eln i t0 etmim3io4oltnlfvta()arum( o;u0aleomocildfaDea( s u4alxoif tydopt ai i t)seto(mpno1ll  liesltf rrr(rpot1oeeomfeiltfm rmuvp;u4treomf iy1oa e ueilt)truoxm iodam  lfvi (faDrmump;o1aexn oeiyt s ulump;u0 eenxo oo1fptelu o;s0setm(m3iy1aleelictls  rtmurp;o1olxo ieiad m um( p t0altrif iatlmt anei t0teuriopio4ll nliet sfsDuaxro;o0apeoii3tys a eluvont4 rtoif3tydfmDrliei (0s2uo(m3ny1olte neils)arrm( oou4tpe  i3tasfm el( o;u0 renxo io1opDe nei;s texrir iudaptemivsa()s2taxrpoo4olxomociltlmDranvont)aleoif3iytoaD lnvo t)srum(mpno4oltnmnvtat aDrru  ou4ope ioetad s uau p;u4texomo tadlaDranes s) 2trxm3ny4lm nlnvtls aDrmx oou1oeen i3iysls2rlnvs;u4trtrmf oodlpte i i;s  2xrxr3ny4lmee nci () Dtrumo;t1teeoiieiytlm um( p;u)artnircio1lmD liesl() 2uo(r oy4al  lneta()srtaxmoot4apxnmf3tlsla2ul( p u4tetrmfciytlm  lu olt srtoio ou4lpe mnct () Dtmurono1optnmfctadfaDranvs (4areomfciy1lmDran il( s2umxm io4lpe mfvsl( sDtaum oo1ole  oeiys sDea( snt4trxoifcta1fa r i o (0srxr(o no1omtemiesa( a2ta(monu4aptoii3tadla2elu pn(4 ltnir oadom elieo () 2toxr3ou4llt  fvt s) Drm(mooo4alxnmfetyd s2el( p t0texnxr iotlp r u i s0 2uriopny1aleemivi ()srtmxr ot1oetoifeilsfm elump t4 etnir3iatop rlnei;s texoim ou1lpeelfeiat)aDtr( onu4tleomoeilt a2uanvo;u0tetrmrcta1lpDr n s;t truoio io1lme  ietl(faDrm(mpno1oet  oeiyt s2eauvpnu) eenif oatlpD aivsl( texrirpnydomtemivtlt sDrmxm ou1tpxniiciysfa rl(ms () leoir3iotfm ran s;(  2tr(m no1apen ies t sDuaumpou0oetnmi3ildfaDrau o u)trtrmoctotfaD au o (0 rto(r oudlleemnetat a2tmx onu1alt ii3iys a ea( on(4altoir tytlmD auvs () 2uoio nudapte fci ()sDtaur ou0aetn oeild m2um(vp;t4alermr3iadop ranei t)srxrim3iu1lltnlieil()sDua(m ;t4opxnifcilsfmDumump;t) exrif3oytlat lueils0 2tr(r oydolte ivs ()s2trumont4oleo oeilsls2umnvo;t0 reomr oydlpD lu s t teto(o iu4llte ieilt) rrm(moou4tpt  ietyt a emuvsn(4 rtrxf iotfm  anvsl(0s2umxm3ou1am   neiatf rra(ro;t4opxnifctat s ul(vs;t)alxrif3iodlmDean ilt texr(r iy1llenmfcsl()arumum ;t4olto fciydfmDelu p u0 renir3ia1lat  nvs;()srurimpoudol n feils)arrauro;o1oltnmociytlm2rlump u0tlxrircio1fmt anvs t0teum(m nu4amt micslsfs2urxmo;o0tee mfciyd aDumu p (0tetnxo to1fm e iei;( tetrxr iydolt mfvilt arumump;t1tptn fciaslm2ua( pnt4tlxnmfciatoa e i ilt)seurirpiy4op n nvt ()a2tm(m ou0oet ifeils s2rlump;u0 etnmo3tytfmtraneilt) eumio3iu4oltn nesls)arrrx o;o4ale  ocild aDem(vp;u0 etrxocia1fa elueol(0srto(m3iodlmee nei t)arrm(roou0tetnifctlslaDrauvpnu) reoif oydfa ean i;s0 etrxrpnu4op  mnvslt sDrm(rpnt0texnioeiadfs emu sn(0aeenio3io1lp  anvs s0tetrimpou1lmt mfetlsfs2ta( onu1tlenmi3tyd a2rmumsnt)tlermf3iatlmt ln o;(  rxoxm3oudap  lieil( sDumu pnu0oltoio3tyt s ea(mp t4 lxrif ta1omDr ieo;t)srtoim3iodlp  mfeilt)sDurxmp;u0tee  o3iat s2eanmon()aeenmocio1fpD  n i;(  exo(m iy4lpee fvilt  2rm(ro;t4aexnmocildfsDrluvpnu0trenmrcto1la rlueo ()setr(rpiodam e neil( s2uru p;o0ale if3iatfmDul( snt4alxrmrctydoat lnvol()s2xriopno1olee iesl( artm(m ou1altoii3iad aDum(mp t4altoxociytlaD lnvol( srtoxm oo1ll n fvi (f rra(rp;o4aee mieiydfm eln s (4 renif3io1opteanvs s0 2toxrpoo4am   fvias  rrm(rpoo1tpe ioeiytls2ulnvp ()tlenif todlm ean o (  rxoxmpiodomt  ict sfsrrr(rpot4apeoioeildfm2ea(ms;(0 eerxrcoo1op eln s;(0 eurim3no4lle  ict s srrm(mpno4tpx  fcias sDrl(vs (4trxrio oodoaDe ieo s)trxmxr3io4apt mneia(farrr(ro;o4olenioctyt a2ulnms;u0tlxomrciatoaDeaieils t2tmxm nu4apen ivta( a2ta( o;o4aptnmf3iyt s umuvo t0 rtoxfctodlmD  uvi;(0teum(r oydlme  ieta(fs2umumo;u1alxoifetysfmDrlnmont)aetrmo io1fm raieolt0s2tmxopnudlpenlnesltfsrraxro;t1openmf3iytfa2umums t4 renxr3oytfaDeauvi;s0t2to(o iydaleelivs s aDraurooo1olt ifciadls2ea( s u0 rxrir3oydla r nvo s trtoirpiu4ap  lfctlt) rurxmonu1tet mietyslm2ranvp;u0 leoxocoytfpDeli s;t) 2xrxr3ou4ope mnvi t  2rrxr ot4texoio3iatlsDuau o (4 etrxfciadfatrlnvi s trtoxr no4olee fesat  2ua(r nt1tpeomiciltlaDuaumo;t)artrif iatfp r ivil() 2ur(opiu4opt  fes t sDtau ont1tet moctldfa ul(vo;u) ltnxocoodlm rlnei;s trur(m iydol elfvt (f 2um(r ;t1tpt  fciyslsDua(mo;u)alenxocoo1op  anei t0 exrio3io1om n ictat)sDtrxr ;u4altnii3ildls2ra(mp ()aeeomo iatfa r ivi;t trurxo3io4lmenmieil()arra(rooo4opt if3tltfaDulu p;u4areoxo ta1fmteaies (0trtm(m iydoltnlnes t  rtr(r ;u4tee ifetltlsDulnvon(4 rxoxf3iodlpt lieo (  2um(opny
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;s0t2um(m nu1lmenmfeilt srurxr ;t1oltnmo3tldfs2ea( on(4teermr todom eluvils0t2umxopiu4lm nmicil(  Dta(m nu1tet mieiasfm2emump;t0texoxfcoadfp raivs;s0t2umxm oodope mietasfsrrm(rpoo4tpe io3iydlm2elumo;u0arxrmr3totomtelies t  exmxm3iu1omtnlivt t  2um(  oo0apeo iciltfm el( snt4aetrir oy1fptelu s;()srtr(o oydaltemnesas  rur(r oo1apt iiciyslsDeluvs;(0areoio3iadfmD an s t)texr(r io1lptn fcsl()aDtm(r nu4openmieiytlm rmnmo;t)alenmf3tydom eli o ( t2xoiopou1lmeelfvtls) 2tmx ont4apt mi3tyd s2uln pnt0trxnif3iy1fpteauei;s) 2trxrpiu4alte iesl(fs2rmu o;t0opxn feiad a umn o ()altnirciodoa  lueo s0t2trxo iodamt lfci t)sDua(root4alt ioeild m2rm(ms u0arenifcoo1lmDran i ( s2uoxo3nu1lltnmiesltfs2rm(mpoo1tlxnioetatfm ulums;t0 leoxf oo1opD  i s ( sexrxm oydlleemictat  2rau  ;t4texnmoeiysfaDuln pnt0treomr oadlat  iei;s)srxm(rpiu1altnlfcs t)srtau oot0oexo ietldlm rmnvpnu4 rtrir oydfptrln ols0srumxopoodomtemivt s) rumxr ;o0aptn o3tlt mDua(ms t0aetoxr3oadfp e nes (  rxmio3no1lmeelfvi t a2rau poo1tltn o3iyt mDrauvp () lxrir iodlptelivols)srurxm3iu1alen fvt s aDrmu o;o4oltoioctyt m2elumsn(4aetnxf3iytomt aivols)trtoxrpnu1lpe  nvtas) 2rmur ;t4apenmfetat m uau pnu) eerxf3ty1om elnvilt  rumxo3iydom  mncia()aDua(rono0tet  fctls mDumu o;u4altrxr3tydopDrau olt0srumxmpio1lpenlietlt)srrrxmp;t0oeto ieiasla2elu p;u0aleoif3tydfpt auvslt0t2xmxo ou1al nmfvilt)a2ururpnu1tptn ieias mDem(vo u0altnxo3iytlmD li o s0trxrim iy4ap elicsa(fartaurp;t4alenmfetltfs2emn ont0treomr3ootoat  n i;s0 2xrir iu1ome  nvta() rtm(mpot1tpxomoeiydlaDea(mo;() rtoxo oydlatr nei;s)sruoxrpio4al elict s) Dra(m no0tet ifeiasla2ra( snt)tlxrir3todlpt aues s0t2toiopoydoleemieil(faDuax ono1olt ioeiatfs ul(vp;(4alerxoctodlaDe u olt0srtriopoo4lleemnctl(  Duax ont4oetomoeiytfa ra(msnu)trtrxo tydlp  luvs t  rtr(o3iy1op emnei s s2tmxrpou1openmieiytfs uln o;t4tlenmo3tatlat lu o ()trxmxm3nydaleemfvt (  rra(  nu1olen ieiltlsDrm(vs;u4areoxr ia1fat livi;s  2umxo3oydop  lieta( artaxr oo0apenii3tadlsDrl(vo t)tlermr3oo1lpDeli slt) exm(o iu1lm nmfct ()s2tmum oo0olt mf3iyt a emu s u0tlxnmr io1op  livi;( texrxmpio1amtnmnvtat sruaur no1oex  fciysls emuvsnu4tlenirciatoaD  ivo s)teto(opnu1alt lfvias a2rmxrpot4oeeomiciysla2eanmsnt)tltomocia1omDrai i t0sexoimpoudop emicta(fa2rm(rpou0altomi3tls sDemnmo t) etnir3oo1faD  n ol()trxrio3nudlltemnes t)sruaxmp;t1tleoiieiasfa ea(vp t0aeermrcty1lpD lues;s0teurio nodal   fet ( a2umxmo;t0tlt iieildfs2uauvo;u)trtrmrcta1lmt lues t)trtoxo iodale lnct (  2urxmono0texomi3tld a2ea( ont4aeermfcto1omD  uvols  2xrxopoo1ole  fesl(fsrra(mont4teen i3iltlm2ean p;t0 etomo ta1oaD auvs (0truoxrpiudal emivil()srrax poo1alx if3tadfm2emnms;t4aetnmrcto1fmD aues;s  2xmxo iy4om   fes tf rtaxmooo4opxn oeiydlm2emnvont)tetrmr3io1la   ueo;s0sruoxmpou4amtemfvt t)sDtmurp;o1tpx mictydfmDeau s t0altrirctydfpDe nvs t  2trio oy1ame  fet t sDta( pnt4oexoifctysls2eaums t) eeomr3iytfm  auvil(0 euoirpiy1al nlnvi sfsrraxr nt4oltn o3iatlaDuaums u4texnxr3iytoa  auei t sruriopoy4apenmfes t  2rmxmpnt0oltomfeiadfsDuanvp u4treomocoatfmDeaueslt)texmxmpny1omeemieia(fs2trxmpot4alxoioeias aDrmumont) lenmrciydfp  livo;s0 eur(m oy1lle lnciat) rrrumo;u4oex if3tatfa2raums (0 lenio3to1faDr i s;t) exmiopiu1ap   ivia(  Dua( o;t0alx io3tysfa uau s (4trenio tytfptrli slt0s2tmio3oo4lltn ncs tfsrtrumpou1aet moeiasls2rmn s t0aetnio3totoaDrlu o;(  eumir io1am  lfvi t) Drau oot1oex mf3iytla2elumpn()tetrmociydlaD  n s;s0 etr(m oy4lmt mivils a2raump;o0tleo f3ilsla2ua(msnt)altomfcoa1om raiei;t  eum(r3iodolenmnci (  2urxmont1alxomoeilt s ul(vs (4alxrxfcto1lm eau ols0trur(r3oo4open nviat)a2ururoot4tetnio3ias sDrlu p;t) renio iodfa r uvi s0teur(rpoy1omt  icsasfsDtrxrpou4tetomfciaslm2elu o;u)aetomfciodfmtrlues t tetoxopiudapeemfvt sfsrrrx poo4teen ictls s2ua(mp;t0artnxo3iatoa eau i;(  rurimpoudlp elneia( srtaumont4opxomfciydls2ea( s u0tetrxocoatfatr ueols  2to(rpoudlme mncilt a2uaum ot1aee  i3tasls rl(ms;(0 rtrircootfateanei t0 etmio iy1lpee ivt s)arumxmo;u4alxo fciadfmDeanvs t) lxoxo3todlaDrlueil( srur(m3nudop nmfcsl()s2tmu  no4alenmieiyd mDuauvon()texrifcoadla  lneol(0sexmxr iodop elieilt arraxmoot4oeeomiciytlmDrlumsnu)tetomfciotopDe ueslt)srtoir nu4lme lfvtasf Draumo;o4tpe moeildfmDemumo;u0 rxniocoytlpD ai o;(0 2urir3ou4om nmnesa(  rtrx onu0apxn ociltfm ra( p t4aleoifctytfateluvo t) 2urio3no1op   nesa( s2rax  ;u0ape  ociltfaDumump ()aexomo todla  anei;t  2xoxrpoodlmt mncsa(fa2rm(  ;u1tee if3ilslmDrlu snu4 rtrmo3io1fmD aies;s)trtm(m3oo4lme lics (fsruax  nu4opto iciyt a uluvo t4 ltoxr tytfpDr neo ( trtrxm oy1ap elnetl(fsDraxroot1olxn ictld sDua(vo;t0tetrxo tytlatr iesl( sexmxopno4al  mnct (fsrrmx pno0oeto oeiydls2ranmp;u)alxnio3iadop  lies;t) euoxm3oodlltnmnvt ()aDtmumooo4aleomoeilt sDranvo;t) lxnmr tytlmD  nes;t0 2xr(m nodapen icsl( arum(  nt0tet iiciytfsDrmn pnt) ltoircta1lm   nvo;t0seumxm3io1optn ies t sDtmxrp;t0tet  i3iasfsDea(vs (0 etrmocoa1lat  u ilt0t2toxm ny4omen fci ( s2um( o;t4apxoiociydfmDrlumsn(0 rxrxr3iytfaDelivi;t)t2to(opio4omtnlfciat arrauronu1oetoioeiys s ul(vont0aetnxf iodoateln s;t0srurimpiudam  mncsa(fa2rmuroou1apt io3tls m eau pn(0arxrxo3io1laDe ueo;t)srur(o3iodomen ici ()sruax onu1optoifctlt m umu s;t) rxrxf3ty1fa e ivi;s0t2xmxo nudllee nvias  rua(m ou1texn octatfm2rl(mo u4areomo3to1om  luei;(0srurxo3oydamtelfvsas) rraumo;o0oeen i3iyslmDel(vsn(0trxrmo3iodlaDeaues t t2xm(opnu4ope mnct ( sDta(rpno4olenmf3iatls ean pnu0teenxr to1lmDrau o ( trxoim3iudlptnlnvsasfsrrm(r nu0oeeomfciysfmDul( pn()arxnmoctydlm elueo;t  exrirpno4apt  fetat)srua(  ;o4alx moctasfaDean on()aetnif iadfat aieo s0setm(m3ou4lptelieiat)aDrmu pno0aptn o3iyd sDum(vs;u0aexnifctytoaD ln o;(0teuoxrpnydolt lncslt artm( pou1olt  ietls a2elnms;t4 ltnmocio1laDe ueo;(  rurir3nodlltemictlt)srumuro;u0opxo fetadfsDemn onu)treoxrctatlmt livols0truoio3ny1om n fvslt artrurpoo1aex  oeiyd a umu on(0trtrif oytlateauvsl(0t2xmio3iu4op nmfetls) rurxmpnu1apenmociatlm rauvs u0 eermoctytlate n s s)srum(o3oy4op  liciat) Dtrxmonu4oetoio3tlsla um( p;t) renxo iytlpDraues t)s2tmimpiu1oltnlies t)aDum(mp;t4opx mf3iatlaDrluvsnt0trenmfcoa1fat ln s;s0trurio3io1llt lfcsa(farumum ;t1oltn oeiysla2eluvs t)texrio iy1oate iei;()sexoxopoo4lmt  fcils  rrau  ;u4tpxnmociadfa uanvs (0tltnxo3iodfmt luvi;s texmxrpiodlpt  nvta()arur(rpnt0tlxomiciasfaDrm( o u4tlerif3oy1fm  liei;s t2tmirpio1lltn ivs (f 2tr(m ot4optnmiciasls eanms;t0trtnmo oy1fp  auvils  etr(o3nu4opt lncs s) Dtr( pnu1tpxnioctadfm rlump;() eenxocootopD  u s;t)t2tr(r oo4llt  ies tf Drmxrono1alenifcilslaDem( p;t)artoiociy1opDeluei ()t2umxr3no4amt mfvs ()s2uaxmo;t1tpen fcilt s rmuvs (4 ltrmo3tytfp raivi;(  eur(r oydal nlnet sfsrra(mont0tpto i3iyd mDrmnvo;() lenircoadoaDr ivo t srtoxmpnydllenlnvta(f rtrx  ou0aeto fciytfmDrm( sn(0aeeomo ta1fmD  nvol( setmxopnudlpt miet (farra( p;t0tleomf3iatfa el( o u)altnif oytfateaivs;s)srurio ny4alen icsat)sDtrxr nt4alto o3tasfm2rluvo;u0tlxoxo3oytlp raieils)teurir3oudomt mieiatfs2uau pnt0tptniociasfm2el(ms;(0artrxo iodopte ues () etm(m3oy4altelfcils) rurx oou1texo i3iytfm2raump;u0aeerxociydlmDr n o (0t2xo(o iu1am nmnviasfsrum(m ;u4tetomicild m raums t)tetoxo io1oa rai i s)trtmim3oodal emnctls)a2tr(r oo0aetnmieiydlsDranvonu)altrir3iytfmtr nesl( s2to(r3oo1opte ies s aDum(mpoo4aex moeiaslsDumnmp () rxniocto1fmD lu s s)seurirpiu1lmeelivil()a2tr(monu4tpxoioeilsfaDumnvpnu0aetoxrciotlat  nvol(0t2uo(opoudlpeemivi s)srta(m nt0tlt  iciytls rmuvpnt) renmf3oa1opteluvi s trum(m iydomt lfei s sDtr(r ou4oee  fctadla em( p;t)tlenirciytfp  aueil( srtr(m iudapeelnvsat)arrmu p;t4altn fctatlaDel( pn(0 rerxr3oydom rluvs;( setmxmpny4ol nmicsl( s2rr(monu0tlenifctad sDrmnms;(0arenmf3oo1fmDr nvi;() rxo(r io4om  livi ()s2umxr no0olxn i3iltfsDumumpnu4 leoxr3oo1opDelnvols) etrim3iy4amtemivtl()arurxrpou1tpt mfeiadfmDrlumon(0teenioctodfmt  uvsls0seto(r iodamtn nei ( aDumumpoo4aeto i3tytlaDulnvp u)tlxrmf iydlpt lu i t0tetoxo3oydamt  nctlt srtrx p;t4ape  ictadfa ea(vont0 exnxo iy1fmt  uvs ( s2umirpnudlmtelncslt) 2ra(ront1tptnioctasfa uan snu4aexomr oodoa e i i t teuoir nu1omeemneia(  Dra(rpnt1tex mfciysla em(mp (4aetrif iadom r n o;s srtoim ou1ameelict s) Drr(m nt1apenifetlsls elu p;u0tlxoif3iadoatelneolt)teuoirpno4omtnlnvsas) Dumxrp;o0tpxniociatfa uau p;t0aexrmr iydoaDr n ilt)srurxo3nu1op nlfeia( aDtmxront4tpt moetltla2rm( p;(0 rtoir3io1fp r u olt  2xo(o ny4lptn nciasfsDtau  ot1opxo f3iatlm2emu o t)trtnmo tydla rlivols setm(rpou1oltnlivta(f Durxm ot4apt  fcilsfa uln ont0 lxnmr iatlmDelnes;(  2trimpny4apt  iet sf 2ua(ront0olx mocildlm2rlu s t4trtrxf3iydlptr i o;t)setoxo3oudape mfvtl(faDum(m ;o0tltn f3iadfm ra(vo t0alxrmo3iadfm rlnes;s setrxmpnodop   iei ( s2taur nt0optomiciydfa2rmn p;(0tetrmfcoy1lpDeanei;t)t2xo(rpoodole  neias)sDur(m ;t4olx mfctad a rauvonu4 rxnmo tadlmDrai ols) 2uo(o3nydol emfeslt)a2rax o;t1tlx  f3tytlm uanvs;u)trenifcootom eli sl( setmirpoo1openlnvt sfs2tru pou1tetn ieiyd s elnvo;(4aetrxfcto1lpD an slt  2toio3iudlpenmnvi t srum(ront4tptn oeiytlmDelnmpnu0 rermr3iydop elnei;s0teuoir iodomee ies t)sDrau  ot4oee ioctldlsDulnmsnt4 etoif iatop raieols) 2xo(r3nodale lnvtl() Dtaxrpoo0aeto f3ilsfm eanvp u)aeeoiocty1oaDe ieo t trtr(m3io4ame mfei ()a2tmurp;t4oetnioeiydls rlnvo;u0aetrxr oatlatr i s t0s2xoim oo1lle mnesat  rrmx  oo0alxn octytfs rau o (4tetomo oatfp   i sl() rurim no4op e fesat  2ta( p;o4alxn f3iltfaDranmsnu)aleomr3oydopDe i o () 2umxo3nu4ome mieias)aDraxmpot4aet ioctadla rl(ms;(4areoioctydom rluvslt0 ruoxo3no4llenmnetas) 2um(root0oltoii3tys aDrmump;u) eeoxo totlmtelivs ( s2tmiopou1llee fcslsfaDrru  nu4tet  ieiyt sDra(mo;t)tltnxo tytomtr iei t srtrxopny1apee ivtl()aDra(root4optnii3ildlmDrm(vpn(4 eeomo oa1oa   u i ()t2umxr io4omeemnci (fsDtmx pot0openmf3ildlaDel(mpn() ltrio3iydfpDelnvi;t) 2xm(o3nydolt lnvta( srtru  ;o0alxo i3ias a2ea( s;t4 lxrio ootlp  anvsl( srtmxrpiy4omee nviasfaruau  ;u0oetniiciasfm2uan o;u)arxrxf3tydlate u i;s0srxrxr nudoptnlfct (f Draxr nt4apenmfeiysfa rm(mo (0teenmr3oy1oaD luvilt  eur(opnydamenlivs ()sruau pnu0aexo feiadfaDuln snt4 exnmocoadomD  u o t trxoiopnodolt  icsa( a2rr(mo;u0alxnifciad sDrln on(4alerxo io1fa r i il(0trumio3nudlpeemfcta()srumurp;o0alt mo3iasfa2ul(vpn(0arxrxfctodlptr iei;t0sexr(mpoydlpt lfci s s2uru p;t4apeo fciatfmDrln o u4 ltrxf3ootfp   uvo;(0sruoir oodamtn fet ()srrauro;t4openif3iyt sDran pn(4trxoxf3iydfmt au o s)srur(r iu1lp emfcsat)a2rm(mooo1olx mfeiaslmDuanmo;u) exnmr oy1oaDr uvs;s0seum(o iu4ape mnctl(  2tm(rp;u4olenii3ildfmDrm(ms;u)aexomf3oodoa r n o;( srxoxrpiu4ol e netlt) Dumxrooo0altomoctas sDem( pnt)aleoxr totlp  ln s;t0s2urio3iodoptnmncsl()s2trxrpoo0tptnmf3tytfaDul(ms;t)trxnircoydfmtelieo;s0srtrio3iy1llt mnvil( arrr(  ;t0teto o3ils m ranvo;t)tltoxo3iotla e ivils0 etoxo iudoltelfcia() rrax o;o1tleomo3iytfsDrl(vpn(4altoxfcto1fp eln i;( tetmim3io4ape  nvi sf 2tm(mpnt0openmfctad aDuanms u) renif iotfmte n slt s2tmxm3no1ome  fvilt s2tmurpnu0tlenmo3ias m2umu s;u)teermfctadlmt aues t)s2tmir ou1lpt mfvs t s2um(roou0opt  ieildls uanvs;u0artomfcoadop   i slt srtmim3ou1ll nlneilsfaDrmurp;u1opxoifciatfa2ranmpn(0alenxrctydlpte i sl()texoxm3oodaltelivs t  rtm(rooo0aeen f3ildfsDeluvs;t4 rtnio3oatlaD  ies;( trxrxmpnudlle mivslsf Drmurp;o1olxoii3ildfm rau snt)tlxnmf3ootomtelivo (  etrimpnu1lp   ieiatfaDrru p;u0olxnmfciltls uluvpnt4aeeoircto1oatrluvols)trxoxm ou4omeelfesat  rtr( pou4oet ifeilsfm2emnmp;(4 ltnir3tytfp  auvslt seumirpoy1lp n fvsls aDrmxro;o0apx iiciatfs2umnvs t4 rxnmfcoadfatran ol() 2ur(m3no1olt  fesa()srtm(ront4aee ifeiltla ua(vp;t4 ltoio oa1faDeluvsl()t2xr(r3io4apenlicsa(f rrax  ;t4apxniicias s rmnmp;t0tlxnmf3iadlmteai s;s)trtoxm3iu1altnlfcsasf Dtax p;u1texoiieils s el( pnu)tetomocoatom rliesls) 2toxopio1ole lfciasfs2ra( o;u4texn oetydls umuvo;u4texnirctydlmDelnei;s0srtrio oy1llenmnei sf Duaxmo;o1altomi3ils mDea( p;(4aetomf3iodfaD lu i (0 2toxr iy4lpe lnct s  rtax  ;o4opt ioctydla2elump;t0 eenxo oy1omtrauvi;s sexo(r iu1am   ivta(  Drrxro;u0teeomfctldlmDrmnvont0tltrxf3oatfmD livil()trtoir nu4alte ics ( srtmxmpnt4teeoio3ias m raumpnu4arxnxfcoadfpDe ueilt) rtrxr3no1opeemncs t s2raumoot1altoioeiltla2ul( s t)aeerxfciydla e nes ( texo(opiudape lneiat)a2ua(m ou4apxoifeiatlm2rl( pnu)alxnxr oydfate uvo;s0srxm(mpny1olenmicia() Dra(r ;t1olto iciatfsDemump u)tlxrif3iotlpDr i o;()sexo(r3iydamtelivta(faDtaxm ou4aee mo3iatfmDeanvo u0 rxnxfciydfmteanvs;s s2xm(r oy1aptemnvi tfartmurpou4oex  i3iadfs2umu sn(4trxomrcoydoatrlneo;(0sexo(rpnudoltnmieiat sDra( pou0tptnio3iys aDulnvonu)teeomocty1fm rlu ilt)srxr(mpoydomeemfcs t sDuru ooo0olxomociadlaDea(vo;(4 etnmr3iydfa elu il( t2xrirpny1amte icsat aDtr(rp;o4olxniiciydla eanvo;() rtnmo ty1faD  n i (  rtm(m iy4altnmfvtl()sDra(r nu0olxn f3iytla2ea(ms u0 lxrxrcoytlptr uvi s)t2um(o3iy1lpenlnvilt)arra(rpnu4oexn ietyd aDuauvo;(0 rxnmo3oo1oaD ai o s) rxoxmpiy1ol nlfetl()aDtmum nt4opx mocildfa umn o;u0 lxrmo oatfmDrlivo t  rtm(mpoudllt  fvtas)artm( pnu4aee  ieildfmDea(vo (0trenircoatlaDean ol() 2um(o3nu4omte ivsls) ruau o;t4tlxoif3iyt mDelnmpnt4tlxoxfcio1op e ueols0 eumxrpoodlp e nvsls srrm(ront4tpeoioeilsfaDumumpn(4tlxnxfctadop eanes (0texmir nydoleelnvia(  Drrur nu4tlx  feiad s2ranmp t0 reoiociydoaDe n i t)srumxrpny4lm elncs t  2umur ou0olt ifciytla emnmsn()arenxf3oytopt anvi (0 2ur(mpiu4om emfetl()aDuaxmp;o1olt iiciltls rl(vo;(0tleoxf tadlmDrln sl()trxr(mpnodlmtnlfvsls)s2ta( ono0oet if3iysfs2ulnvs;t)tetnxo oy1fm e nvo t)trxrirpou1lp  licils  rtr(mpoo1opx mictys s2umu o;()trxnmo3oydla rli s;() 2xrxo3io4ale mfvtltfaDrrxroou4tee  icildls2ulums;t0tlenmo3iy1lpt liesls0trtmio3nudlmtemicsls) rtrumo;t4oexo ieiyd s ul( o t4alxnif3oo1lm rauvo t) etrxo3iodlm  lfes sf rurump;u0oleomfcilsfm2emu s;t4 etnmf3io1om   iei ( trxrimpiu4lleelict t) rtm(r oo1tlenmoeiysfs uan o;t)altomfciodfpDelieols sexoxrpiu4lmtemfet t sDur(m ot0texomf3tadfmDel(vsnt4teeoio3oodfa elnvo;(0tetr(r3no1alen icsasfsrtmx p;t0tlx  f3iytlmDua(von(0areoir3iotomtelivo;t texrxr iydll nlfcsls)a2tru  ;u4tltnio3ildlm2elnvo;u0alxoif3oo1laDr i ols  2urim3io1oltemfeta(faDum(  ;u1oetomieiatfaDemnvsnt0areoio oo1fpt anvo t) 2toirpoydaltnmicslt)arrm(r ou1opxo ieiasfa2ranmon(0aexrmocoydlpteaiei s t2tm(r3iydlm n fesa() rum(mp;t4olt iietas mDumu p ()tlxrxr tydopt auvs s)seum(m iudopenlfciasfsDrm(m ;o4aetomoeiydlm2eauvo;t4alxoio ta1fm   ies s  2to(o3oy4llt  fctls s2um(rooo4tpxo ieilslmDua(mont)alenxociydfm r n o;(0srur(m nudale lfes tfarum( ont0altomocild mDem(vo;t4trerxf ootlmD lu sls)t2urxm nodam e ncsas) Duru  oo4apeniietytlmDemumsn(0 rtrio3todfpD auvs;s0setm(opoy1amtn fvsls sDtrxmonu0tet mo3iydfaDra(ms u)teerxoctotoat aueo t s2tmim3ou4olee ictltf 2umxm ;u4tptn fciasfa rl( s u)tlxoxoctodopDrauei s  rtr(r oy1ol emfcs ()s2tmx oot1aeeomf3tydlmDuauvo;u0arxnirciotlpteliei;s s2umxm3nu1ome  ieilsfs2rrxmono1aetomfciltlm2ul(mpnt0tlenxr tydopD  ivs;s  2tr(m oudome mnct (  Dtm( ono0oexnifetlslaDra(ms;(4altoxr3tatfmteaueo;( t2uoxo3iu4am e nvsas) 2trumpot1oet mictadfsDem(vs u)alxoio oydoate nvo;t)s2urim oo1om  lfet t)srumu pot0olto ictaslmDeln pnt)tltoxo ty1fa raies t) rtm(o3nudam e feia(  2urxmonu1oeen ictaslm2ua(vp;t)aexrxf io1fpDeai ils)srum(mpiodapee ieias)arua(  nt0tlen ocilsla rluvo;u) exrmr oa1lp  ln o t) rum(m nu1ole mies t)aruaxm no0opeoioctyd s um(vo u)aeeomo to1la e ieslt texo(mpnydoptn fesas srrax ooo1tpenmo3iydls2eauvp;u)tltrif3iotlaDe nei;t t2toxr iu1lm n ivi s sDtaumpot4opxnif3iad m elnmsnu4altrif oo1fat lnei s)srxr(o3ny1apenmnetlt) 2rau oou1opeo ocilslmDrl(mo;t)tlxomfcoodfmD aies s0 exr(opiu1lmee fvsatfsrrmuront4tetn oeiyd a raumsnu) ltoxr ia1op  lnei;( s2xmim oy1aptelfvsl(f 2urum oo4olen iciytfm emn pnu4texomf3oo1fpDe n s;t srtoio3nydalt livil( arra(moot4tlxnif3iytla2uln pnu0tlenmo3oodop   i o;t0seurxo io4apeemivi (  Dtrx pno1oltnifeild s2rmuvp;(4aexoiociatfp   i o;(  rtmxmpiudol emnvil(fa2trxrpnt1oee mictat s2elums (4trtoxf3oydoatranvs s0srto(r3iodoleemnei t aDrru ont4aleo ocildlsDem(vsnt)aexoif totlpD anvsl()srxo(o3oy1lm elieslt  Duaxr no1olto octltfa ean p;(4 etnif oydla  lueilt0seuoio3oudole mfcs t  rrmxmonu1tlx ioeild s ea( s u4alxnircoydlptelnei;() exmxr3ny4amtelivs s) 2taxrp;t0ape moetasls umuvp u)alxomrctotomtranei;s)sruo(opoydoltnmivil()s2tmxmooo0tltomo3iytfs2eluvpnt)altnmrciy1fptrln i;()s2umim oy1olee fvt tfa2tr( pnu0olxomoctld a2ulnvs (0artnmr iodoaD auvs s0 rxr(r3io4lm n nes t  2ua(monu4aeenioetyt mDel( s;t4arxrmrciodlm r i i t)t2xoxr3oydamt miesas aDrmx pot0aetnii3ildfmDelu o;(0texrif to1fmD  neslt)setrio3oo1op e nei t arrmur oo4tlxniiciadlmDel( sn(4trtrioctadomD lieo (0 2urxm3iu1om nmnctls a2ra(r ot4tlxnif3iyt m2em(mp;()arxnmfcto1laD ai il(0trxo(rpio4amtnmiesatfa2rm(mpno0alxnif3iadfsDrmnmo;u)arermr3iadfpDrlu s t0s2uo(o3nu1lm nmici (  Dtm(rp;t4aptomi3iatfm2eaump t4 rxriociadomt  ies ( texoxr ny4lmtnlnvil( sDuau pot4olxomociytls el( pnt0arermr3to1lp  lues;s seumxm oo4alte nvta()s2uru pnt4aptnii3ils a rl(vont0 reriociy1laDraneo (0t2xriopno1om  mnctasf rrm(  ;o4tle  oetatla2rmuvpnu0areomf oytlpD  uvs t seum(r3no4lptnliesat arrr( p;u1tptnmoeiydfmDean s;(0arxoio3ty1oaD lnei;t0s2xoirpou4lle mfetlsf rrrurooo0aetn iciyt a ua( pn(4altnir3oytlpDeaiei;(0s2xmir3ou1ope  netl(fa2taxronu4tleo i3iytfm2ra( pn() etrxocty1op   u o;( sexrimpoo4amt lnvtls) 2tm(r ;o1texnmfeiydls2em(vpn(0tlxnxr3oytlmDrau il(0t2uoimpio4alenlfvsl()s2rrx  oo1tptn o3ilsla rm(vpnt)alxrxf oatoaDeaneils  ruoxo oo4lpee fvta(f 2urxrpoo1apxn ictlslm2ua(mont0teeoir3tytlmtrliei s0trxr(o iudoptnlfesat)a2tru o;o4oee  oetytla ea( p ()altoxfcto1oaDelneolt)t2xrxmpiudlmenmnetl(  2uau pnt4altnmf3tat s ra( pnu) etrxf oodla e uvo t  rumxr3oo1ll   nvtas)a2urxmooo1ope  i3iatlm2ulumpnu4 ltnmo3ta1op rlnvs;t)s2uo(rpno1alt livi s  Drru oou4oleomfeilt s2rmu snt0tlenmoctytfaD lueilt0 rurir nu1am emietas  rtmxr ou4optnmieiltla2eln p;() lxrxo3iotfm  luei (0t2umimpoo1alt licsls aDurump;u0apt  ieiytfm2uluvp;u0 ltnif tadlmte uvi t)t2xmxopiodoptn nvtls aDtauro;o1oex  o3tad sDrmnvpnt0 eenxo3iydfmt luvi;s srtmir3iy1omtemnvi ( s2rm(m ;t1olx ioctysfs2rmnmo;u)altnmrciadfmD  nei () 2xrio iudlpenlnctas aDua(mpnu4aetnmoeiyslm uauvs u4aetnir3oydoatelneo;s srum(mpoy1am emnvta()srrr( oou4aetnifetadls2elnmo;t0trxnmr io1fmtraivils)tetm(o ou4omtemfvils  2trxro;u4tpt  ietld s2rmn pn(4 lxrifciytfatr uvols0 rum(o3oy1ap  lfei t) 2rmxm nu0tlt  i3tlt aDrauvpnu)tltrif tytfptr uei;s)texm(rpoy1ame livta(fa2uau ont4oee  ictldfa uln pnu) lxnxo3oytfm e i o ( srto(r3oo4altemfvsat)sDraxm nt0apt  ociatfs um(vs;()artnmr3ootop ranvs;(0srumxopoydlleelivias s2rrxmp;t4alx  octlt m2uaumo u4 lxoxrctydfp elivi;(0 euoxrpiydame lfvtas sDtrum nu4oet mietltls2elnvp u0 eeoio iodomDr uvolt s2umxo oo1opt  iei () Dtrx p;u4altnmfeiyslmDumuvsnt)altrir3oy1fpte u i t0s2uoxopou1ll elivtat) rtr(mpot0apxnifctaslmDeaump () rxoiocta1omD  uvs s  exmxrpnu4ale lfetls) Dua( p;o1tpeomiciysfmDranvp u0 eeoiociadomtrai o t s2um(m3oodol  lnet t aDtaump;t4olx  i3iyd s2rm(msnt) leomr oa1laDraivi s t2umim3ou1amen nct ()srua( poo4aptoioetlsla rlnvsnt4tetnxf ootfaD livs;t t2toim3nu1amenlnvsl( a2ra(m ot4alxnii3tadla2umnms ()tlxnio3oy1op r ivs;s sruoir nu4olteliesasfa2uru  ;u0oeenmfetls s2ea(mo;t)tleomr3oydlat an i s trxrir oy4optnmfcsl( sDrrxm ;o4tleoiocilsla2umu p;t) rxoxf iotfp  lu i;()s2um(m3ou1op elnei t)s2um(monu1tee ii3iasfm2uauvsnu0 ltrmfciotfmt lu il( seuo(rpnodlptemnet sfsDum( onu1aeeoiocias sDel( p u4trxnxr iodfp  anei;(0 rxoxr oodomtemivsa()srurx pnu1aetnmf3iyd sDelu s ()alxrio3oo1oatrlu olt)truriopoy1op e ivsl() Draump;t0teeoiictas sDrlnmp;(0trxrxo to1fp elivsls) exrxmpoy1lptnmfci (  rurump;u4oee  o3iat s2emn o () ltoir oadoaD aieils srur(o nu1alen fesas)arum(r no0alxoii3ilsfs2ul( o;u4tlenif3todfmtr u i s0srumim3iu1altelnetls srurxm nt4oetn oetas a ea( o (0tlenxr iydomDr nei;( srxmim no1optemivta( arua( p;t0olxo f3tytlm ea(vo;t0 exomfcoy1lmDeln olt  rtoxopiydom nmfcsas)srtmx p;u0optoif3iadfs rmnms;u0 ltnmocoy1om rln olt)trtoim3nu1lptn nei tfsrraum ;o0alx if3tls a ulums u0 rtnio3tydlpDeluvi s)srtrxrpiy4lltemiet s)s2trx  ;o1apenioeiyt m2ua( o (4areomr ia1fptraivs ()sexrirpno4ll nlfvtat)s2tmump;o1opx ifeiys mDua( o;u)alenxrcoodoa ranvs;s0t2xo(m3iy4oltnmnetasfsDta(mpnt0tlxnmi3iydls2emu pnu4trtrxo3to1lm   n s;( trurio3oodomee ictat)sDtaxmo;o1oetn fciadlaDrmu s (4alerircoadlptraueol(0trtmxr3iy1omeemfcslt  Dur(r nu4apto ictatfm um(mp t0 rtoxr iydlateaueo;() rxriopoudlmte ncta( srur(  oo4tpenii3tas aDul(mont) leoxoctydlatrln il( srxoxo oydoltnlivi tf Drr( p;u4tpeniociltlm2umu o ()arxrxr3iodfm rlnvi s  rxm(r ny1olt licsls  rururoot4tlxniocild s uanvs;t0 lxrmrctytfate u s;(0t2xr(m3nu1om nmnvi t)artr(mp;o0olto ociasls rau s;t)trtrxr io1fpDr u i;t trurir3iu4omt  ncilsf rururpot1altoif3iyt mDel(vp ()trtnxf oa1lm  luvo;t)srxrir oy4ale  ictat srtru p;o0aetoiociysls emnvonu4tlxnmfcoodfpt  n o;s) euoxm3iodlpe lfcta(f Drmum ;t1openmo3tytfs2ranvs;(4artnmocoo1fatraies;s setmxopno4ape licsls)aDrm(  nt4oleomociys m2eluvs t)teerxrcoa1om r ivol( seuoio nudllt  iet ()sDua( p;o1teeoioeiytlm2rluvo ()alenmocoatoptelivils0 exmxo oy1al  lfeil()arur(mpnu1aeenmfeiatfm ea(vp () eerir totlmt livs t0seur(r oydol e fvtas) 2umumpot4tltoioeiyd sDum(vsnt0aleoio ta1lmD auvils)srtmir ny4lmt  fcs () 2tm( p;t0alxn ieilt a rln pnu)trxomr3to1la rai ilt s2ur(opoo1oltemnvs (f Drmxm no0oex mi3iltfaDul(mp ()aexnmo oodopt au olt)truoim3nudaptnlici t  2tax  no0aexnmoetadlsDrlumo t4aexoio iotlpD lnvs;()trtriopoydap e fctlsf rrrurono0opxo feiatfaDuaumo;()texnifcoydlaDeanes;t0tetoirpno1ope mivta()sDur(r ot4tpenmieiysfmDulnms;u) rxomf3ootlp rlnes;s srtrio iudllee neiasfaDraxmoou1tpenifetysls ua(vs;u0 rxrir3iadlate u s;t0 2tr(rpio4al n fcia(fa2tmur no4oex mf3tydfaDeaump u)arerifcootlmDrliei s)truoxr3no1ol emfei tfa2tm(m ;t4alt mf3ildfsDemnmo;u)trtnmoctadomtrauei () exoio ou4op elnei (f Dtrx o;u1open oetytfsDraumpnu0alxnmr3iy1lpDrluei;s setrirpoudlmee fes tf Drau o;t1aexnio3ildls2rauvp (4artoxrcoy1laD  ivi;t  2uoio io1lpeelfei t)srtaurpnt4apto f3iyd m em( p;t4tltnmr iy1faD luei;s0sexm(r3nodamt mfetasfsrurxrpnt4tee  o3tldlm rau s (4alxrmr iy1om e n s s0trxmxr oy4altnlfci (  2ra(mpnt0aet ii3iatlm ua(vpnu4tlxoir tydoatrluvo t  2xoio3nu1lpee feilt) 2rrx pnu4oleo ociad a raumonu0aetnir oytla raivo;t  2tmxr3ou1amtelieta( aDumumono1ole ioeilsfa2ra( o;(0 ltrxf3tytla e nes;t0sexrimpny4lmt livias)a2ua(  ;u4aleomictad a rau o u0trtnxf3oytfmDelnvs;() 2urxrpoodllee fvi (faDraurpoo0apto ictys s2ua(vpnu)tlxomr3tytom   n i s  2xoio3oydomeelict (farua(  ou1aex iictyt m ua(von(4 etnmfciy1lmte ivi;(0tetrxmpnodomtnmieiasfarua(ro;u1opeomo3tytls ranmo;t0aexoio3ta1opteaiei;(0s2toxmpiydlptn feiasfa2urump;t4tleoiictatfaDulu on()tlxoxrcoadlptrln sls sexm(o oo4llt livsl(fsDur(moou4alxoii3tys s uau o;t4 lenioctodfp elnvs t  rxm(rpnu4lltnlnes (  Dtrx o;o1apxomo3ils a ulumsn() eeoxrcio1op   ueolt0t2trir io4ope lfviatfsDra(mpnt4oet io3iydls el( p t0 lxrxfcto1lmDeaivols  2xrxopio4apte ncsa(  rtm(mpno0opxoio3tadfs2rlu s;t)artoircta1la e n s;( srxrxrpiudlmeelnvslt)s2taxroou4alx  ieildfa2elnmp (4alxomrcia1la eaiesls s2tm(r oo4al e iet sfa2ta(mo;o0tltn ieiatlmDeau s t0 ltoxf iotoa  anvols0trtrir no1apen nvsatf rrmxr nu4teenmf3iltfa2ua(ms;u)trxnxfcoo1fa   neo (0sruoio no1lm n fcsls srrrump;u1aexnif3iadfmDrm(von() rxomr3tatopteln o (0 rtrxr iydomeelnvtas  2ua(m ;t0oetomi3iyt a ulnmpn()tlerio3iytfpDe nvs t  2tr(opiy1ap nlfeilt)s2uaur ot1tltoiiciysfm rl( s () rxrmf ootfaDe nei t)srxriopio1oltelnviat) Dumxrpno0olx  octadls elu p u4 ltrxo iadoaDr nvo t0t2xm(opoy4om n fetas  Dtmumo;o0apxomictlsfa uaums;u4artomfcia1opDr ieols)t2trxo iy4oleemfvta(  2umuront4oeenii3ilsfs rln pn()teenmf tytlatraieilt) exoxm3ny1om nmfvsas)srrm(m no4oet  f3ilsfs2rmnvpnt0 eeoifcoy1fmte uvs t) rtoir3ny1lpen fvils sDrm(r ot0ole mi3iyslmDrluvo u)altnxo3tytla raivo;t0srxm(m3ou1lm nlivslsf rrmump;o4texoiictldlsDemnmonu4 eeniocta1oatelu sl( trxrir oo4lp n ivsasf Dtm(r oo1alenmfeiydlsDum(vs;u4aeenirciytlaDeaneo ()trumxo oudole lfct () rtm( poo1aex ioetytlm emuvo;u4tltrmo3oadfaDrlivo;s0 rxr(r ou1apenmivt sfs2rmx onu4tpeoiietysfsDuan on()tltniociy1omDrlivolt)s2toio3ny1altn fct (fa2tr( pou0oet moetysfs2ua(ms u4 rxrif ia1faDelnei;(0 rumxm iy1ap n nei s)artrx o;u1tpxo o3iysfmDrmuvon(4tlxoifciatomtr i s;s)sexm(rpiodapen nvilt)aDrrx oou4tex  ieiad m umnmp (0trxoio3io1oaDrlnvs;() 2uriopiodll nlfcs (f 2tr(ront4aexniiciydls rlnvon(4 rtoxr3tadfmtr ueo;s)t2xoir oy4apenmnci s) rraxmp;t4olt mictas sDrauvo u4aetnmrcoa1om e n o;t)t2uoxm3oy4llt mncs ( sDtm(mpou1tlen o3tasfa um( o;u) rxrir3oadlm  luvslt0 rumim no4aptn ics (faDtm(ronu0alxo i3iysla2ulnvo () exrirctatomt ln o () 2xm(m ou4ope mieiasf 2rrurpot4alt  f3tatfm rau p t4 renmf3to1fpDr nvol(  rtoio3io1llt  neils)aDuaxr ;u4aeeoiictytlsDuauvs () leoio oa1opDe nes t0t2trio3oodoltnlncsl( arurxr ot0aptn ieiyd mDuaump;t4tltrxr tytfaDe ieols0 2trxmpou1ol emivtl(fs2taur ot4tpt  oetas sDrlu snt)trxoxfcia1optr ivo ()sexoirpnu4oltn fesltfsrurx pou4oexniiciydfs eln sn() rtnxf oodopDr uvs t  rtr(m oo1alte fcias arum( pot0aexo oeiysfs2um(vpn(0aexomfcoatfpD  nvs;(0s2xmxo3oo1ol e neia(faDurxr no1aee mfeiysfs uanmo;(4texoxoctotfm r ieols trumiopou1ll emnesas  2urxr nt1tlx  fetaslm2ean s;u0tltnxf iotoa e u il(0tetmxm3oudol  mfci sfarta(  oo4opx mieils a2ul( onu4trxnxo3oadfptrlivo ()t2uoirpoodam emfvsa( s2trump;u4apto i3iyt s2ulnmpn(4 exrxo3oa1op e ivi;( t2tmimpiy1al elnvsls a2raur no4apxo fciyt mDulu ont)trtnxo oo1lmD aivi (0 2trxmpoo1olt mietat srum( pnu0tptnmoeils a2uanvs (4artrmo ty1late ivs t0 etmxo iy4ame  fetl( sDtaurp;o1tptn o3iadfaDel( ont4alenxo io1fatelneilt)t2xrim iu4llenlnct t)srur(mo;t1ope iietat s eanmo;t0artrxfctadlp eaivol() eumxrpnudlm nlncia(f 2ta( o;o4apto o3iatlaDuanmo;t) ltomf ty1lp  li ils0s2toir oo4lmeelfvt t sDum( o;o4oltnio3tys m2rmu s;(4trxrxr oydoa rli i;()tetr(r nu1aleemicsa(  rtmu o;u0tlxomoctatlm2emnmsnu4 eenxf3tydfaDrlieols t2xrxm3ny1omtnlnct t)srrrurooo0openmf3tlsls eanvpnt4artrxf3ootomtr uesls0sruo(r oydopt mnct t arrmxr ou4oeto f3iatlmDumuvs u0treoir totopteluvi t0truoir nu4lltemfvslt)arrm(m ot0tltn ietlslmDuluvpn() lenmrcoa1oa  ai ils srurxrpiy1op   icil(  Drr( pno1aptomi3tltlsDul( s u0treoir ta1lp r nei;s  exo(o iodlp nmicsasfs2rm(mo;u4apto ictat sDran p;u) eenif iodlpDeauvi;(  2xmxopoo4lm n nes s)srtm(ro;u4alt mociadfsDrmnmpnt) eeoioctatfp eai o t)s2trxopnudaltelivi s) 2taxmpnu0apeoifciytfm rlumo u0trtrmo iotopteln slt) rxrimpiu4ame mfctlsfaDtmx poo0tpxnmieiyt aDum(vp t4tetrxrcoo1lptr u s s0srtrir iu4lmeemnvtlsfarrr(rpou4tleoifciltfsDra( o;u)texomrctotoa rli i;t t2umio iu1lmt lnvs t) 2rm( ooo0oex mfctatfaDeluvpnt) rtnxo3tydlpDr neo ()seurxr ou1openmicsl()srtr(mpnu4oexn oetlslmDumnmpn(0aetrmf iytomt au s ( s2xoim3oo1lm  lieias) 2ra(  ;o1tlxnmf3iadfs el( s;()altnmf tatopDrluvo s s2uoio iu1lp n iciasf Drrumoot4aetomi3iltfaDumuvpnt4altrmf tytlm elu o t  2uo(opny4op nmivt (f Drr(mpno1oltoio3tyt a2rmnmp u0alerxf3todfpDraieilt0srxr(o ny4ap nmivs sf rumu o;t1tptoiociasfaDrmuvp u4arxoirciytlp rlivo;t0t2toxopny4omtelnviasf rrrx  ;o0tee ifeiysls el( o (4 rxoxr iatfm   n o t0 rurxm oydap nlivta(fsDtm(rpoo4olxoio3ildfa2ul(vo t)tlxoxo oytopte uvi;s sexm(o3oodal   fvi (fa2tr(r ;o0olx moetydla em(vonu4aetoio totopDrliei s)s2uo(o3nu1lp nliesatfsrraumooo1oeenifeias a rlnvont)tetomociytfa  livs;( seuo(m3no1lmt mfci (faDtm(mp;t4aetnif3tydlmDea(vs;u) reomfciodlmDraieilt)s2xoir3iodom emici ()s2rmx  ;u4olxoii3tad sDrmnms;u) rtrir oatfpDrlues;(0 euoio3nudlmenmnvsat)aDumx pou1aee ioeiasls uau pnt) rtnxf iytlpte n s t)texmxo no4omtnlietl(f Drrxrono0optomoetydfm2elu o;t0artoxr3ia1omtelieils0 exmxm iu1optelfcil() ruaumo;u4tee  oeiltfsDumumpn(4tlxrmoctodlate ivil() rtr(mpio4lleelnvils)sDua(moou0oeeniicias mDranvpn() rxnir iotlpD aivi (0t2to(o3oo1am  mnci tfaruaur nt4tpxomietltlsDrlnvonu)aeenif3tadfpt ln i;s)trtmir ny1apeelncils) 2umu p;o0alt  o3iatfa2ulu snu) lxnxf iadoaDr u i;( t2xrimpny1oltemfvs s)s2urxro;u0texn ieiat s rmnvs;t) rxrmo3oy1opDeau sl()seuo(o3iy4omeelfci s)aDrru  ot1apxnioetytfs2rlnmp;t0 lxomr3tadfptrluvs;() 2xoir3iy1alt mfviatfsDtmx  ;o1aeeniictysls el(vp;u)areoxf3iotlm raieil( srumxo3iudam emfvsat a2rm( oou1oex iictlt a ulnmo;t0tetrmo tytfat liesl(0 2trir3nydlptnmivt s a2tmxmpot4aeeo i3ilt sDulumo (4 lxnxf3iadfpDrlues () 2uoio oudllte nvt t)a2ur( ono4apxo ociys a rm(vont4trenmf3oadlp  anes s0trur(o nu1amt mfesls)a2tauro;o0tlenmo3tydfa2ul(ms;u)aexoxf ty1opD livs;( s2toim ny1ol   ieia( srumxmooo4tpto fciadfs ua(vp (4tlerir to1oa  livi;t0srto(rpnydopen ncta( aDrau p;o4aexn fetlslm2el( s;u4aexrmo3oydfptr u il(0t2toir3oy1lp   feta(f 2rax oot4altniictld a elumo t4arerxo3oytlaDeauvi;(0 eumxmpio4lmeemfcs t srtaxr ;o0oexnmieiltlmDem(vsnu4alenxo3ootla   i ilt0s2xrio oydop nlfesa(  2tau pot1tltn fctydla ulumsn(4tlenxr to1fmt  nvo;t)trtm(o3no4opeemnci (farrmu ont1altnmieiytla rau s;t0tlxnmf3oadlmDeluvo t0t2uoir ou1lp elietls  Dur(rono0oetnmf3taslm2umump ()tlxoif oatfa eln s s)teurxm iy4lmtnmnctls aDtr(moot4ope  fetys s ulumonu)tleoif iy1omtrlneol(0srxmim iudlle mnvtlt) Dtru o;o0tlt iociat mDel(ms;t0artrir iotopDraueo;t0 rxrxopnudomt licils s2ra(  no1ale  iciyt m umnmpnu0 exnxfciatfat ln s;s  rtr(mpnudop elfeia(  rum(  ou1olxn f3iytfa eaump ()trerir3ta1lptelu i ( t2umxrpnudal  lnct t sDtmur no1tetnmfetlt a el(mp u4aexnir todopte ivs s0t2ur(mpny4llee nvslt)sDtr(ro;o4teto f3tlt mDum(mp (0aetomf ty1fmtraivs;t sexoirpiu1am  mncsl(fa2uaumoou4ope  ociltlaDumump (4artoxo tytfat  uvi;t tetr(rpnudame lics t)sDra(mo;o4alx ioetlt a ea( on()arenifcoydfaDeauvilt)s2umimpiu4lmtn fvtl(  rtrum nu4apeoiociasfm2rm(msn(4 renmfctydfaDran il() etoirpiudlltemics ()srtaxr oo1apeomf3ildlsDranmp;t4teermo oatomtr uei (0srxrirpnudlpe lfeilsf Durxr ;u1tpx iictat a ul( o t)arenir oadla ranvs t) euoirpio1ame lfctat a2um(ro;o4tpxn iciydlm2ea(mon()arenmr3oatla   u i;(  exmxrpiu1lp elfeias  Dtmxr ou4alenmfetytfs2umnvo u0arxrmoctatfmD livi;t t2um(r3no1omtnlicias)sDurxmont0tpxoioeiltlm rmu pnt0texnmrctodlmD  ueolt)srumxmpio4opee ncslsfsDurx poo1aexomi3iat m2ulnvo t4trtrio oy1oa rauvs t0 etmim iy4am emietl( srua( ont1altomi3iydlmDumu pnu0 rxnmo iydfm rlueil( texmim iy1ll  lies tfsrtaum ;o0olt ioeiasfm em( pn() lerio io1om r ieo s)srtoio3io4lmtemfes tf 2tm(m oo4tleomociadfa2uln on()alxrmf totoaDranes;( t2toxrpny4alenmfcs () 2rmu o;t4aexoiieiydfa ul(vpnu0aexoir tadfmDeaueo (0 exrxo oudap  mfet ()aDraxmpot1oltn f3tys s ulumo;t) eeomo tytfm r iei ()trxoxr oy1ape lfvia(fa2rru p;o4oleomocilt m2el(vs;u)tlxomo oatopDeanvo ()srxm(opoy4lme mnviat)srurum ;o4oetnmieiytfa2rmuvs;t)trxrio3oadlmDrlnei;t)setmir3iy4om   fvt t) rrrum no4ale  ietad m2rlnmonu)trenxr3todom r neols0srtoir iydlpe  icsa() Drrumooo0olx iictadlsDumu on(4 rxnxrcia1lp r nvi;t0tetmxopoydlm elfvi ()aDta(m ;u4opxomociltls rl( snt4trxnxr3iodlaDean sls0 rtoxm nu4oleelfvi t aDum( p;o1oex  o3iysfsDraump;(0teeomo oo1om elivsl( t2tmxr no4lme livsa( a2raxrpnt0alxoiietld m2uauvo ()aexrmr3totoate nei s  2xoxmpny4lmt mici ()aDraxmp;t4openifciatlm rau s;u4aexnxfcto1lpD liei;s) rumxopiydap  mfcilt)srtr(r nt0tptnio3tasfs ulnms t)arenir ta1la   ivilt0sexrxmpnu4llen fetl( s2ur( ont0aet io3iatfsDrlu pnt)tetomfcoy1omtelu ils  exrxo3io1olenlnvils) 2rrxrono1olxo o3tas s2em(vs (4arermo3iodom e nei;t  2uoiopiu4aptn ivslt)srtrxr nu0tpxoiociadfs2ea(ms;t4alxnir3oodfmD auvs t)srtrxo3iydape mieiat s2raxrpnt0tpxnmoeiadfaDemu s;t0 lxnxr oatfpDe uvols0 exmio nudlmtnlnvsl()aruaxro;u1oee mfetysls2um( pnu4 ltrir3todop rlivsls) 2umxrpiy1lm nlnvi s) 2ra(moou0tptomiciat m eluvp t0 rxoxfctotlm ran s t) etr(mpno1lptnmnvta()s2urxr ;u0altnmoetat m umumo (4trtrir oodopDelnvs t  rxoir iodomt lnciasf Dur(  nt1oexoifetad sDeaump t4arenif oodlat  nei (  rurir3nodomt mfei sfsrra(root0apxoifctad s rlnvont) lenxocty1oa  lnei t0 exoio3ny1al nlnvsatf Dumum ;o1olto i3tldfm2um( sn(0trxrxfcoytlm rln i;t0setoxmpoydlpe licsas a2uaumooo4tlt  iciytlsDeln onu) etnmo oydom  anei t0 2tm(o3ou1ole mneilt)arraxr ;t1tpt ifetlt aDrl(ms;(4 eenifctadopt  ivo t) eur(rpoy4apen fes sf Dumxrooo0aeen fciltfsDeauvo;t0 reomocoo1lm elnvi;()sruo(r nydal emivtl()arrm(ro;o1oetnmo3iasfm2rauvs () rxrif3oatlpDranvs;t srxoirpoy1llt  nesasf rumurono1oeto fciat a rmnmo t4trtnif todlaDe uesls)sexrxm oodomt lfvsas  2umx p;t0altn fetasfsDran s t4trenio io1opDr n o;()trto(o io4lptnlivt tfsrrmx ono0tlx  octatfm2ea( pnt4trxrxf oa1lpDelueil() rxoxmpoy4omtnmietls aDurumono4tle miciyd s rlu o;t4alenmociydfm   nvolt)t2tmim oo4am   nvil( arurur ou0apenif3iys a ul(mon()trtoxf3tytlmtr ivi;t0tetmxmpoy1lm n ivtltfs2urx pnt0oeen iciyslm rlnmp (0 exoxf oo1lp  lnvol(  2tmxm3oo1al elnetat srrrxr nt0tee iictydfsDelnvsnt0texnmf oydfateaieols)seurxrpoy4alen nvsatf 2uaxro;u1tet mi3iat m2rmnmp;t0trxnmfctatoa rlnei (  etr(opoo1apeemnct s) rur(r ;t0aee mfciltlm2ranvp;u)alxnxf iydfa r uvols)s2xoim iy4amtemict sfarraxrp;u1oexoifetldfm2eauvpnt)tleomr iodlmDr neo s0t2toxopnu1ape lictat  Dtau ont4tlenii3iaslmDumu sn(4trtnmo iodop e iesls  eumxmpiydol n ncsatfartrxrpou0teto iciat s el(vsnt)artoxrciytfaDe ies;s tetrim3oo1ap e fvsl( srtmumono4tlen octat a2ul(vpn(0aleomo3oytfate i olt srxrxopnodape liet s a2rm(  oo4oltnioeiasfmDuau p t0 exnxr iadlpte nvo s) rtoimpnodamen fetls)arur( p;o4tpen iciysfm2rm( snu)aetnio tytom eli s;t) etoxm iodlpenlncsl(  2umu o;t0tpxnmo3iaslsDra(vo t4arxrxr3totfmtr i sls)t2trxmpno1opt mics t) rrr(m nt4olenmietlslmDeaumpnu0 reoxo3oydlpDr i il(0t2triopoo4ap  micsa()sruaxmo;o4oltnmietas a2eanmonu4artnxo3todom  aiei (0seurxm oy1aptemict sfsDumump;t0apen feiytlsDua(msnu0 lxoxr3tydlp e ivil(0texo(o3iu4lmte fci s)s2rrx oot1oleo i3iad s rluvp t0aexrio oatlp rln s;t)s2trxm nudolt lnctlt artmur ot0tlxoif3tldlsDelu snt4tetnxf io1fat  iei;() 2um(m3iydlpe mfetas arum(mont0aeeoiicildfaDem(vo t0 ltoio3ty1opt  ivs s)t2xo(m iudam  lnct s) ruru oot4tleomo3ild m2ran s;u0 lerxf iydlateaivo s0 rtoxopiudaptelncil(f 2um( ono0tleomoeiydfmDeanvo;t4 ltrxf3todlpDrai ols0t2xmim iu4om nmfeta() rtr(root4apt mo3iad a2uau o u0trtoir oatlp rlu s t0 euoiopno1op elfetas srum( oot4aee  o3iysfmDua(mp () ltnif iodfm e iesls0srxm(r iu4lp nlies s) Dum(r ou0apxn feiltfm2elnvo;u0aleomrctytlptrauvi;s seurir3iydlm  lnvils sDtax o;u0olt if3iyd m rl( o ()tlxnmrcoatlm  lu i;t) euoiopnodlltemneilt  2rmur ;u0aptoifeilslm2emuvp;u4 ltrir oadoat lnesl(0seto(opiudlmeemivtasfs2umum no4opxniieiysla2uaumo u0 renmf3iatlatr uei;(0 2uoim3iodlm   icias arrmxm oo4aeeo ieiadfs umn o;(4 ltnxr3tytlmDean slt  rxo(o oy1al nmncsat) Dumu o;t4aetoif3ils m rmn p;u0altnxo oydfmDr i o (0t2toir3nudlltn nesa( srrmurono1olx ii3iydfs eanms;u) rtomrctydfp rlnvo ()srtoxr3iu4lmtemics () 2taxroou1tltniociytls ean s;()alxomfcio1la  livo;t trur(m oy4am e nciat)a2tru oot1opx io3tatfa elnvo;u)arxnxfciodomteau s t tetmxrpoydamtn iviltfs2umu pnu1tltn oetldla2elu p t)trtnmf oy1faDean s;( teurxmpiu1lmtnmnvta() rur(rpno0tlt mocildlm2uan o;()treoif oo1fp eanvi;s) 2trxmpoy4lpe liviasfa2ua(m ou4oleoioctys s2um(msn(4 lxnmo3iy1fmt aies;( srxoir3io1ll n fcsa(f rua( pno1oeto oetydlm rm( o ()aeenxr3tatfaDe ies (  exr(o nydll e iesas) 2uaxmpoo4oeenif3tytls2rlnmpnu0 ltoxf3tydlpD lnvs s sruo(rpou1apenlfvtl( s2trxmp;t1opx mfetltfs ulu p;t)aleomfctatfmD  ueol() etr(rpio1apte fetas)s2uau  nu1apxnmieildfm2emuvp t0arxrmr tadom raues;t) 2tm(m3ny4ap nlfvilt s2umx  ;u4apt moeilslaDuan snt)alerxr oatfp raueil( texmxmpiy4llen fvi () 2tmxr oo0aee ifeiasfa2ulump u0altoio3iodoateauvi;( tetr(o3no1omt  fes sfs2tm(m oo1oeenif3tlt m uanmon(0aetnmfctadla eaivs t0 eur(r nu1ol e feilt aruax o;o4alxnif3tatfa2ea( snu4teenmr ta1oa r ivo (0teumim nu1am  lfct t  Dtr(ronu1teenmicildfa rmnvsn(4 lxrmr3oy1fmt ai i t0setoxo3iy4olte nvsat) rtrurpno4alxomoctysfa umuvon(0trtoxrcio1fpD luvolt0 2tmxr iudalte fesa(  Durxmooo0texnifeiltfaDranvonu0 ltrmocia1fa rauvs (  2urimpou4lp  mnesls) 2raxr ou4alx ifeils s2ul(msnt)trtnxf3ia1la   iei s s2umxm3oudopeelfeil() Drmxr nu1tpt moeils sDea(ms;t)tlxoir3oadfmDe n s;s  eurxopoydam  mnvsl(f 2umuro;o1ope mfctydlsDra(mo () reomf3iydlm rauvi t0tetm(mpiudlptnmivs t)aDtaumo;o1apeoif3tls m2emu s;u0altomo3iytlateli i;t truoxo3io1aleemfcs t) 2trxmoot0ole mictls mDuanvp;u)arerxrcoatfa eauvi (0sexmxo nu4lmtelneta()srur(ronu4oleniocildfaDra( o u0teerxf oy1oa e uvsl(0 2xmxm oydal nmiesas)s2ta( p;t0aexoiociltlaDra(mpnt4trermr tytfpD  nvo t0 rxrxo oy4omtemnct t)s2ur(mpnt1texomfetld aDrl(von(4teermo3tydop rauvsls0 rtoimpio1amenlieils  rrmur no0aet iieiatlm uauvp t4trerxf3tadfpDraivilt setm(mpoudlm n ncsasfs2rm(m ot4tpe ioeiysfs2ranmpnu4alxoiocoo1latr ueslt  rto(o3iydal nlnes s)s2tm( ono4tleo ociys a2rlu snu4 lxrio ootfp rlu ols)texrir3iodlpe lieiasf Drr(m ;o1oltnio3ilslaDua(mo () eeomfctotfmte u i;t0srxm(r3nu4ol   nvsa(f rtr(rpou4oltnmfctatlaDrmuvp u4aexomo3iy1lmtrlu o;(0 rumim iodll nmncs ( aDrrxroou4teenio3tatls ulumpnt) rxrmo3totfmD  neo t) 2tr(r iu4olenmfcia(  Dtmur nt0tptnioeiltfm2uau pnt)teenxr3tatlpte uei s  2tr(o iydaltnmiviatfa2tm(moot4teenmo3tad mDulu on()aexrircoadlmDraivilt0s2to(rpoy4lp nlfvilsf rurum ;t0opxniictas m rln on(0tetrio3tadopteaues;t)tetrim nodop  lneils)a2ta(mp;t1apt  iciat s2ran snu) rtoxf3oa1fatelues;s0srumir3iydaptelnci (  2tru  nt0ape mictytfa rluvo;u0texrirciydlm  anvo t srtoirpoo4ape lnvsas sDrr(  ot4apen f3tytfaDua(mp;(4trerxr oodlaDeln o t)s2uoxopno1ol n fct s) 2urxroou4oexomietydlm elnmo ()tlermociadla rli s t0trtoim3ny1ale  ncia( srrmxrp;t0tpxomo3ildls ea( onu4teeoif oadoaD  ies;s sexr(r3oudllte neslt) Dtm(r ;t0ope iiciyd aDrmnvs u)arxrmr totoaDe nvo ( trurxm3oydom   ivsat sDurxmpno1opx  fciadls2uanvp (4aexomrciodop e uvs;t)setmim3ou4oleemneiatfs2rrx o;t1opxomoeiasfa2eluvp t4artnxo tydom raueo s)t2um(r3nydal nlivsa()srtru oou4altnmf3iyt a2em(ms t4 ltnxo3iydfptr n o;()trxm(mpnudoptemfvs tf 2rmxmpou0tetnmi3iydfs2ra(vsn(4 ltrxr3iadfaDelnei s  exrimpiydolenlfviatfsrtaxmooo1tleomi3iydfmDemn p;u0aeenio3ty1lm r nes;s  2xmxo iu4lmenlietlt) 2ra(mooo4tpt mi3tytla ul( o (4 ltnio tydlp rauvs;(0seuo(o ou1oleemnctl( srrr(m ou0tlenmfeilsfaDrmnvsnu4 reoxo3iotop r ieolt  exrim3nu4op  mivsls)a2tmur ;t1tltn oeiatlaDem(mo;u4arxnmo3oa1oateaies;s)t2umim3oodol   fciat  2rmxmo;o0aptnifciyt m2ea(mp (0aetomr3ta1fpDeaivo ( srurio3no4op emivil( s2rmx pnt1oexnifciasfmDrlu on(4teermr3iadfmD an ils)teum(m3ou4op elfesatfa2rm(rpno1oex  iciyd s ea(msnu4aeeoircoatlaD  ivo;() ruriopoo1al e fesas)srurxm ot4apx  f3iadfsDum(mo;t4 rtnmo3iytfa eaiei (0t2xmxrpou4lpen fvsa(f 2rm( p;t4tpx miciys s ea( o;t) lxnxo tydfa rau o;(0truoir3oy1ll nmfvsltf Drmu ono1apenif3ilslsDrmnvo;t0trxrio iytopD  n sl(  rxm(opnodolte iei s s2ua( p;t1tltnmf3iatfm2eaumon()aexoio3oy1fmt  n slt) rxm(o3oy1lme  iciatfa2umu  nt4oltnioetlt s rau s u4alxnmo3ty1oa elneolt)teumxr ou4lpeemfcslsfa2rmxrpno0tpeoiieiasfm2raumpn()alxnxocoytfa eanvo;( trtr(m nodoltn fvt (f Dua( pnu0texnif3iadls el(vo t0 eeoxf3todfaDrlu i;t s2um(opoo4amenlicsatfarua(mo;t4aexniieiysla ra( pnu) lxrir3tydfpD  uvs;s)t2umxm3io4op elnvil(fa2ur(m ot1apeo oeild mDuauvo;u4 exrxo oa1latrli i;t0 exoir3oo1ape  ivsls sDtaur no1oetoio3ild aDul(vp;u0 ltrio3oatlmt lues;s)teuoio iudomte netas)sDur(m nu0olen ictlsls2um(vs u)aexriociytlm  liei s)tetmir3nodame lictls)arrm(m nt0alxnio3iys a umumsnu) eeoifcoatla eauvo s0teur(opio4lm elietas)a2trxr ;t4tltoif3iyd sDrm(msn(0 exomr iodfa  li sls0s2tm(o3nu4ap  lnvtas) 2trx pnu4opeomfctydlmDulu p ()aeenir tadomtraies ()s2uoxo iy1lme  fci (fa2tr(rono1ole  ieildls2em( o;t4aetnmf iatfa e i i;()s2xoxo ny4lp nlieia(  2ra( poo0tetomicilsla eluvs;u0 eermf3ty1om ranes ( texoxm3iy4lptnlnetl(f rrmxr ;u4opxoii3iys m2uln snt4alerir3oa1om e ivol(0srtr(r nodol e fctlt)artauro;o1oexnmoeiysfa ra(vs;t4trtnxocoodlpte u ilt0s2urio3nu4opeemneia(f rrrur ou0tptn o3ildfa ranvo t)altniociytlaDrluei;t)t2tr(mpiu4lm  mnvsas)s2ta(rpno0oeeoif3iad mDumnmsn() ltoxo3oa1op  lu i;t0trurim oy1oleelfeiasf Dtr(mpot4aptomietytfs2uauvp t0aexrmrcoo1lm raueol( srum(m3ny4lltemictls sruaur ;o1tlt  ieiyt a2ea(vo ()trerxocootop elnvil(0trxo(mpoo1lmtnlicsa() Duax p;o4aeeoio3iad a2ra(vp u0alxnxf3totlpD lnvi s)trtmxr3oy4ape mnet (faDuaum ;t4apxnifcild m2ran o;t)tlxoxo iadfm eaues ()setm(r nu4optemncs () ruaxm ot1open f3tldlm2emu s;t0aetnxf iodlate nvo;t0srxmxr3nudop nlnvt tfsrrm(m ;o0aptomfeiatlsDrmuvo;() renmociatlaD lneil( t2uo(r nudlpen fvil(  Dtmx ooo0olto fctyslmDrmuvon(4aetnxr tadop e uvi;s0 exmir3iy1amte nei sfarurur nu0aet iiciysfmDumnvonu) rtoxo3oadoat aiei;()setm(o oo1oleemict sfsDurxmoou4tpenmo3iadlsDea( ont4 exrmo iytlaDe uesls texr(mpou4ap nmict s)sDururont0oexo oeiadla umu p;u0trenmr to1lmDelu sls) ruoxo oydope mnciltfarumumoot0aeenmfctad s2emuvpn()arxnxfciydomD  ies t srtrio3nu4apt mnct t)sDtmx ooo4alto icils sDra( pn()aetrxo iytfatrai i;()s2trim3oy4op e icsls)artaxm ou0oeeomf3iyt s uan p t)arenmfcoatfmDelnvi;( trurxm3iudoptelfei (f 2ta(m nu1apxo ociytla2el( s;t0arxnmo3todlate ueo (0seto(opoy1lptnmfeiat a2rr(ro;o1tpxoifetldfm2uln p () reoio3oy1fmDrlieo t  2toxr ou4optnmivsas)srur(m ;t0alx mo3tlsfa2rm(mo u4 rtnmf to1lm  lu ol()seuo(mpou4llee ietatfs2uaxr nu1alxomfctyt a2raumo;() etnxoctydopDelu slt0setoir3iydlpeemnvil(fsDum( pot1aeeomictadfs eau p;t) etoif ia1fp  auvi;()sexoir3nudop  liciatf Dtm( pot1altomo3iatfa2ea(mo u)aexnir3totop elnes;()srxrxo iudamt  iet tfarum(rp;t0aptomf3ias sDrl( p;(0alxoxf3ta1omD ln i;t0t2xmxo oo1openlfetas)a2taxrpno4optnmoeiasls elump;t)altrxf3totopte nvol( t2trxmpiodam nlnvt s) 2ua(  oo4alt  ieiydfaDelnvpnu4 rtomr3oa1oaDrau i;t  rxmio3iu1lpenmfvtatfaDtax p;o4opxoio3tydfa2ulums;(4tetoxo iytlpDeluvo ()srtr(opoo4olenmfcia(farrmurpot0tle  o3iytls rmnmpn(0 lxrxf ia1lm e neol( trurxopou4ap  mnetlt)s2raxro;t1tlxoii3iad sDrlnvpnu0arerxr oydlpDrauvi;(  2uoxo3nydolee ivt ( arraxmo;t0oeto o3tat m2raump u)tltriocia1fatr ies s)sexm(r3iudoltelnvils srrrumoou0ape  f3tydlaDeanvp;t0 exoxf iadlpD luei;(0 etrio3nudaltnlictlsfa2rr(  ;u4apt mietlsla2ranvo;(4 reoir3tydfmDr nvo;t)setrxr iu1ll  liviat a2ra(rono4tlen oeiydfm um( s t0altnirciotlmDr ieol() rxo(o3oo1ame  nvilt sDtm(root1ole moeiyslsDrlu ont0arxomr totfa elnvols  2tr(r oudom  livs sfsDrau pnt4tet  fctaslm2uauvpnu)arermrctotom rlues;()t2xoxm3iy4ap emiei t)sDrr( pno0olto ictltfmDrm( o (0aetrmo iydfat liei;()trxrxm3oo4ame lnetasfs2uaxr oo0tpeoiietltfmDra(vp;t0trxnxr tydla  ai s;s0 exoio ny1altnlncilsf 2raxmont1aleoioetatfa eln on(0aetrif3oa1lpD anei;t)s2xrir oudamtnlivias) Dur(rpoo0optnif3iyt mDel(mpnu) etnmf3iy1faDeli ols)s2tmio io4ame  fcias srumxm ou1aetn o3iatla2um( snu) etnir3oy1opteaneo;t s2xrxmpnu1open nes tf 2uau oot0altn fciytfm2umu p;()aetomfctytom rlueils)s2tr(m io4lmtelnesas  2raxr ;u4tpeoiiciydlmDulnvsnt0 rxoio oa1lpteaueo ( sruo(r iu4op elnctatf rtm(r oo1apt ifeiasla eanvs (0tltomf oy1fmtr nvil()s2urxmpny1ll  micsat)srtmxmono0tptnmfetldlsDum(vonu4 lenxr3oo1oaD aivol( seurxm3nydap  lneiatfsDrr(m nu4ale mf3iysfa ua(mo (4tlxomf3iatop  an olt)s2xo(o io4omt  fcil( aDrmxr ;o0aeeo fciyslm umump;t)areomf3oadlp raieils0seto(r oo1ll nmivi s sDrau pot1aetomfeiydla umn s (4 lxoif oytlm e ueols0s2xoiopny4ome  fvsat)aDra( ont0tetomietlt m rlnvonu4aexrio3oodop rai sls t2um(rpno1ol nmncia(fsDra(mpno0alx  ietldlmDrluvpnt4aetnif tytfptr nes t seto(r no4omt lnci s arraxmpnt0alxoif3tydls ulums;t) ltnirctadomDean i t0srum(opoy4op nmfvt s a2taumpnu1tlxniocils m ra( o;u0 exrmfciy1lat lu ols0t2tm(o nudomeemivtls) Dra(rp;u1olxo fctydlm2eauvs t0 ltomr3totfmt lies;t)t2tmxr3io1lme mictls  2tau poo4aeen i3tadlsDuauvp;u)alerio3oa1fpDrlivs;s t2tr(m3nu4openmnvia(fa2rru  nu0optnio3ilsls2ulumo;t4 ltoif oadlp r n i;()texmxo3iodlmtemfctls  2um(  nu1alxoiicildfm em(msn(0aexrir3iatfm eaieo;s0 rtrxo3no1ol elnes t)srtr(rp;t1tptnioetad m2ran o;u0teeoxf io1la   ues;t) 2umxo3nydamtemivs tf ruaxrpnt0alto f3tldfm ranvo;u)alxoirctodop eau i;s0 rtm(m nu1am   ivias arrrum ou0teeomoeiytls2emnmo t)arxoxrcoatfa eauvi t s2toir3ou1amenmnesas)artr(r ou1oleomoetys a2um(mpn()trermfciadlaDe nvi s)trxr(o iodaltemnetas) 2ur(rpnt1oltn i3iydfaDul(vp;u) exnmf totomDrauvs;t0t2xmir oodop n fesat arua(r ;u1opt mi3iaslmDumuvp () rxrio ia1faD  neo s0srurxr iu4ap   icias  rua(rp;t0tlxnmf3iatfmDra( onu) etnxf tadoaDelivils texrim3iu4lpe lict (fa2umumont1apx mociasls2eanmo;t) reoxf io1fmDr uvi;s)truoxo3no1lpeelfeil()sDurx pot1oeenio3tyd m2rl(vont0aetnio ia1fpDrli i ()tetmxopoy4llen fvt (  rrmx o;t1altoiociat a2uau p;(0arermfciotfpteanvs s t2tmxmpoodomenlnct t a2tr(  no4optniocilsfmDemnvp u0 rtnmr3ootfp e i olt0 exmimpio1oleelnctl( a2rrum ;o0tet mfetyt m2ean s () renio3iatla ranes () 2uo(r nudop elnvilt  rumxr oo4altnmf3iydlsDuluvpnu0 leriociytopDr ivo s srtr(rpou1ll nmfcsl()aDtax pnu0tptnmieildfs rmumo t)alxrmo3ootfpteli s;s)t2urxm3iydolenmivta(  rtrx oot1aptoiieiysfa2uau snu4 exnmf oadlptrauvs t  rurim3iy1lm nlict sfa2rrur no0aexnmf3tysls uaums t0 rxrxfctatlaD lu i;s)trxoxrpoo1oltnlfvi t s2tau p;o1olt if3tatfs umn p;t)treoif3ootop  lneo s setmir3iodomte fvilt sruaumoou1tlxn octat m2rln o () rtrmr3ootlatrau ols tetoirpoo1op e fvs t) Dua( p;u0aex mo3iatlm2uan on(4aetrxf iydfpDrln il(0t2uoxopoydlmenmncs s) ruau onu0teen i3iytfsDrm(mpn()aexrmf3ta1fm  lnes s)teum(r iodamenlfviat)arrr(m oo4olxnmieilslaDumnvp t)tltrxrctytoaDe ueo s seuoxrpou1lpt mfcta(fsrtru  ;o0tlx moeiltfaDemnvont) eerxr3iy1omt lu i t0s2xmim nodop elfctasfsrurxro;t4tee ifetydlsDuan ont4alxoircoydlp rliesls) 2uoirpiodalee ieiat arumu ooo4apx micilt s2rm(mp (0 rxoio iydfp e ivsl(0s2tm(opnodap   fvsls)a2tm(mo;o0tltomocias a2rl( s;u0altrxr iytfaD anvi;s sexrim3ny4alt lnvi s)srrmxmpot0oee ioeildfs um(vo;() etoircoydfmte uvolt) rtoiopoo4aptn fvt sfs2rmumpno4oltomo3tydfs2eau s;u)arxoxocoodlpDe ivolt0teum(mpio4ll   nesls s2tmxmoou1apxo i3ild m2rmn ont0teerircoo1oat aieil(0s2ur(rpiudlpenlnvsls  rraum ;o0apxoiocild mDuau o (0 eeomf oodfa rlu ols)t2um(r oy4om n ivta()srrruront0tlto fctasfa2rmnms;t0 rerxociotoa  li ol( srumxmpiy1amtelfvi tfsrtaxmpot4tpxoiiciadfsDel(vo (0tlxnifcootfmte i o ()srxmirpiodal nlietas)sDtau  ot4tpt mfeiat a2em(ms u) eeomr3tatfptrli o;t)tetrir iu1omenmfct ()sDur(  nt4tee mf3tatfm emn p;u4tltrif3iodlmtraiei (0trxmir3oo1al e fvsatfsrumur ot0ope iicilsfs emnmpnu4tetomfctotoptr ueil(0texr(r3iu4ale  ncsas aDrmump;o4aeenif3iadfaDumnvsn()alermr3totlaD aivo (0srumxmpoy4lmee nviasfa2ra(mpnu4oee  i3tadla2eau o u) lenmr3oodlmD luvils) 2xm(o ny1amtelietlsfaDumxmoot4tleo fetydlm2rl( p (4 lxnxr iodlmt aivi;(0tetoxm io4lm emneil(f 2tm( poo0ape  fciydla rm(vpnt4arxrmr todlmD lnes;s)tetrxrpiy4alt  ictlt  2raxmoot1optnmicilsfa2ranvp;t0tlxrifcta1fm  anesl()s2to(o iodap  mnvs s) rrrumono0aet  feiydlm el(mpnu)tltnif ty1omtelivi;( t2umiopnu1ameemfeia( aDur(root1oexnifcild s umu p;u4texoio iodop   neo;s0s2tm(m3iodlmenlfes s) 2ur(  no4ope  i3tad mDua( onu0aexoio3to1lpDeanes;s  2umxmpoydole  nct t)sDum(mp;t4tpe  iciyd a ra( ont4tlxnir iatlmDelieol(0trum(m3nu1am e fei ( sDrmurp;u4tee mo3tytfsDrl( o;t4alxnmfcoydfpD au olt seur(r3iodop emicsl( a2um(mpoo4tlxo ieilsls2rauvs;u0 lenxf3to1fa  aies;t0t2toimpiodlme mfcta(fs2ra( pno1oee ii3tasfm2ea(vpn(4artrir3iodoateauvs;s0s2xoxopoo1ame  fesl()arrmumpoo0aee ioeiyt s rl( o u)trxrmo3io1op eau o t)tetmir iydopt livt tfartmump;u4tlxnifetasfa2emu s;u)trenxocoo1fmD aivols0 2uoxo ou1open nvs s) Dum(rp;t0ole ioeiyslm ulnvsn(4texomo tydop eaueo;(0seumir oydalt  nctasf Durump;t1oetomictadlm eln o u4trtnxf oodopt  ivsl() eumio nu1alt  net t) Drrump;u1opeoifciysla rluvo u)trtniocoodlpD lnes;s trtmim oudol  lfei tf rrr(  ;u1opxnif3tyd m2rluvonu0texnxfctotla e nes;s s2ur(o3oy1lptnmnvias) Dtm(rpoo4apxn iciyt aDel( pn(4teenif3ta1fptrlneo;t)seuoxr3iydam elfcils  2tmumont1aptomfciyt s ra( pn()artnmrctydlptrai ols)texoio iu1lm  mnet s aDrrumono1tleomiciytfaDeauvs ()tlxrmrcto1fpDeai i;(0 2tmir nodlmenlivsat sruaurp;t0tet  f3tad s emu p u4aetoio oytlmteanvi;s) 2uo(m3nudaptnlnviasfaDtau  ;t1tetn f3iydls2ra(vs;t4tlxnif3oo1oa  aieo t trtrim oo4opt  nct sfsDtrxr ;o4oltomo3tytfa uln pn()artrxocoa1lpt  u i s0trxmimpoo1om e fciatfsDum( pno4opx mfeiydls um(vpnu0 etoxf ia1lp   neolt sexm(o oo4amtnmfei t aDurx  ;t1apto o3iadfm2rlnmp u0aetnir3iy1lm elieo t0 rum(mpnudol nmfvtlt aDumx oot4aexn i3iatfm2rlnmp u0aleomociydlpDeli o ( srxmxmpny1aleelfeil()artmx  ou4alt  ieils a ean p;()altnioctadomte ivi t0 2um(m3oo1llt livsa( a2umu p;u1aeto feiydls ul(vp (4 ltoifcoydfptrlnvs;t)seto(o iu4omt  ncslsfsDurxr ;o4olxoiociltfaDemnvpnu) exnif3tadopDr i ils0trtoxm nudal  licsasfartr(moou0tlt ifeilsfaDea(vonu0trenmoctotoateln s;s  rumxm ny1ole  fvilt srtm(m ;t1tlt  fetyslm2emn p;u4artrxf3todfmD  uvo t)trtr(o3oodlmen fci ()srtr(ronu4optnio3tydfm ea(vo t4 eenxr3tytomt aneolt)t2toxr3iu4altnlnciasf ruau ooo4aptomo3iad m emn o;u)teenxrctatlatrlnes s)texoxo3ny1omtelfci s) 2uaum nt4oexniieiydlm ul( pnt4aetnmo iodlpteau i;t0 rxoxr oy4al elictl()a2umu  no1aeenmoeiatls2ua( p u4teermf3io1lp r ivilt0trum(opny1apt lieils s2ua(rono4tetomiciltfsDuln s u0tltrir3oodomD livi;s)trum(opiu4lle mfvi tfarraxr oo4openmo3iasfmDuanvs (4tetoio3oa1opt  i o ()srurxrpno4op  lnetas a2taur no1aexo o3tyd m rmnmo;t4teeriocoatopt auvsls s2xrxopnydopeelfcilsfsDrmxrooo1ale iieias s2emnmo;(4aexrmo3iy1lpte u i;(0 exrir3iydlptelicia() rrax ono0apx ifetltfa2uan p;() exrio3oadoptelneilt)teum(mpoy4op n ici ()sruaxrpou4oleniociysla2umuvs;t)trxnxf totopte uvi;t)t2trxr3nydaptn ieslsf Drmx oou1tlenif3tld a ea( onu4 exrmr3oodopDraneo;s teuoir nudomtelnvs ()srrmxrpoo0olxnmfcilt m ul(ms;u0 exrxfctytfaDelnvs t  2um(r oodlp e icil(fa2rmu oot1aee iocils a ra(ms u4altoioctydoatrlnvil( t2ur(mpiy4lle  nvs ( srur(  no4tpeoifciytfs2ea( p;(4 rtomr3iadfat luei;s0t2xmio oy1ome mfesat)aDtr(rp;u4optomfeiasla umu pnu0 rermo oa1fmDelu olt0tetoxopiudlpt  iesat  Durxrono1olxo ictasfs2umumo u0 rermr iytfpDeln i;( s2urxr nodap  mivs () 2uru pnu1tltnmociydfm2umnvp t4artoioctatfpDeaivsls0s2tr(rpoo1ame micils aDtmx pot0tetnmo3iadfaDrmuvp;t)tetomf3to1fpDr ueo;t)s2xoxr3iu4lm  lfvtls)a2tmur ;t0oee  ictldlmDum(vs;u0 leomr3tatoa elues;t sexrir3no4am   icias)srrru ooo1alen i3tydfm2el( o;u4aetnircta1opDrauvi t0t2umir nu4ol e ieia( srtaumoou1aet ioetatlsDrauvp;t0texomfctotfmD lnes;s texrim iy4optemfctl(f rtaxrooo0tex mictad s2ea(mpnt0 eeomo3tytoa   ivs;t)s2urirpou1ole  ncias) rtr( pou1aeto iciysfm2rluvon(4 lxnircty1la  livs;t  2xo(rpio1ll  lfes sfarrax  ;u1texnmieiat sDel(vpn() rermf3ty1fp r nvs;t trxmimpiu1amenmnvtlt  2uaxrooo4oeeomf3ilsfsDem(vs;t)alxnif to1fptrln s;s teurxm3ny4al n ies s)arrm(ront1tpt iictldlmDrmuvs;(0alenxf oodfate nvo;t)texoim oo1lmeemfcsas) ruau ooo4tex  ietlsfs2rlnvs;() eerxr oydla eluvo;( srxoio iydomenmici t  2trx o;o4ole mfctldfsDrlnvs;u0 lxomo3iydopt aneols setrimpno4lmeemivs ( aDrmum nt0tlt mo3tyslmDra(mo u0tltnmfctydomD li s t)s2xo(o3no1ol  mivtl( arrru  nu0ope mf3iydlaDrlnmsn(4 rtoxo ta1lptrln i;s)t2urio io4apen ici t) Dra(ronu4tpxo f3iyd s em( s t4aleomo3iotlmt  nvo;s)t2urxo oodlptnlfcsa(  rtr(ro;t0aexo f3ildfsDeaumon(0 eermrcootomte ieo s  euoxrpnu4omt mfeslt) 2rmu oou1altomfeilslm um( p;u)altnmfcoo1lp  aies;t texoxrpoy1omt  nesat)sDuaum oo0aexo ictatlm rlump t0tlxrmr3oytomt  nes;t  etmxr3oudom  mfcias)srtaxmp;u4aleniictltla2rmnmpn(0 exoxr ia1fmDrlueils  2umim ou1amee nei tfsDrrumpoo1aptn feiasfmDuanvpnt0 ltnmf iadlpt aieo s)teumim3nu1ome lfvsat sDrmx  ;u4altniieiatlmDranvs;u)arxoxf tydlatelues;(0t2uoxmpiy4ap emncsls)sDuru p;u0oltoif3tldfs2elnvs;t)tetomr3oo1fp eauvol(0t2urxopny1lpe  ivi (fa2tm(  ;o1teeo ietatls rm(mo;t0arxrmr3ta1opDeaiei;(0 rxr(r3io1lm e nct s arrmxmpou1alto fciadfaDrl(vp;t)aexnir3ta1omDrlnei s  exoimpnydap n fes t sDtr(m ;u4apt mieiasls eluvp;t) ltoio3oy1fate ivo s0 2tmio3iodllt  nvt t)arumumooo1oltoifctad mDelnvp u)artnioctodfateln sl( srxr(opnudamtelneilsfsrum(mp;t1opt mo3tydls2elnvo u)areoxf oo1op  ln sls texmxopiydaptn fcilsf Dum( pno1open octyd sDran pnu)trxnif to1lp r nes t)s2umim iu4apeelnvi tf 2rrxmp;u0tltoii3iadlaDem(vo t)alxnxr3ia1la  luei t  rumxm oydolee nvtlt) 2trum nt4oeenmieilt mDumuvo;t0treomf3iadlm rlneo;s0 2um(r3iodalt  nct ()s2tm(mono4aex mictadlaDem(vpn(0 rtniocoatopD aneo;s)trurxmpoo4olt  fet t  2rm(mpno0aexniiciyt sDrlu p;u) reoxrcia1la e uvo t)srxrim oydlltnlicsatfaDur(rooo4alxomieiat aDem(vs;(4arermrciy1optrlivsl( s2um(m3nudoptnmnvil(  2urxr ;t1aptomiciysfs emnmo t)texnxf3ta1fpt ai slt) 2toxo iudom  lfcsat  rtrx  ;o0alt if3iys s2rmnvsn()tlenmo3ootfpt  nvsl() rtmxrpoy4lptnlnctls) Dta(rp;t1tet mietyslm2emnvs u0areoiocoodla elivo t)trxoxopio4olenlfetltfa2taxrono1teeoiiciltlsDra( s t) lxnmrcty1lm  lieo;t)teuo(m ny1lp   ietlsfarrmu  ;o4tpx ioetysla ua(mp;(4 lxoxf3oa1oa rluesl(0srxo(mpiy4ameemnvt tf rtmxm no1tpeoif3iytla ea( o;(4aetrmo iydfaD auvi (  rxm(o iu1omt  nci ()sDum(r nu0aetomi3iltfm elumo u4aexnir3iydomt an ils)sexrxm3iudlme miet ( sDtax oot1tet ifctatlsDumnvp;(0tltoir todla r nvo;(  exoxo3io1omtemfvil()sDtaurpou1apeoii3ilt m2uluvs;t)tlenxrcio1op  aneo ( seurxr oydlleemfei sf Durxrp;u1tlxomiciad sDumn p;u4teenmrcoatlatranvolt s2urxr3io1alenlfciltf Drau p;u1teto oeils s um(mp u) etnxfcoydoate n s;s0 ruoim nu4om nmici ( a2ur(ro;u0tex ifciatls2rlu s;t0 rxrirciy1fp elu s;(0truoxr3oo4ap emnetls) ruru  ot1ole ioeias s2umnmo;()arxoxr3ootlmtr uvs s)srto(o iy4lmtnlnvilt)s2umxro;o1optn oeiat a2emu s;u)teeoxociy1lpDr uvslt) 2um(m oo4lm nliesat s2tmxronu0aet mfctydls rm(vo u4tlxrmo3iotoaDe ivo;s srtmxmpiy1olte neta(f Duaumo;u4opt ii3ils sDemu on()teermr3iatopDranei;()tetrim3ou4ape lnciasfsrtr(mpnt1aeto fciysfa ulnvpnt)tlxrmo ootfa   nvi s  rtm(m3iy4lme lfvs sfsrta(mo;t0aleniiciyd sDranmp;()tetnmf oytlmt anes;t t2tr(mpoudol emfvtat)srrrxrooo4opxnmo3ildls2ulnms (0aexoircta1laD  ies (0srur(r nu4oltnlivtas)a2rm(mpnu0tlx mf3iaslaDrau p ()aexrmociatfmtr nvilt0trumxmpiodllee iesls) Dumx pnu1tptnmi3tldfa2rau pnu4 etrxr oadopDranvi ()s2tr(o io1ll   ict s  2tm(m ot0ole ioeildfm2ea(mp;t0trxoxocty1fpt lneo (  2toxrpiudome mnvil(fartau ont1oetoio3iys sDuln p t0 rxrxr oa1latrli s t)trtoxo3ny1omeemnvsatfarrm(rp;t1tltnmfcilslsDul(mpn()aeermf tatom   u o (0s2xr(r3ny4lmeemics s sDrrxrono0oleniictyd m2uaump;u) leomr totopD aieolt) exoxo3io1aleelnvia( sDumumooo4oltniocildla elu pnt)aeenir3to1lat li s;t) eur(mpiy1opeemneslt aDtmxmonu4ape moeildfaDumnvp t4 exoxf oatfm  livo t  rxo(o nu4amt  fcs s  Duaxrpnu4tpeniiciatlm rlnvs;(4 ltrxoctytfatr n i s  2xoxopio4om  mivi s)arra( pnt1alxo fctad a umn o (4arxomfctydfp rlu o () rxrxopiudamen ncsas)s2rmxmpot0tpx io3iasfm2uan o t) lxomo3iodlp elies;(0seurxm3iydopen fvs s)arurx oot0aee  i3iltlm uan o;(4teermoctydom  aivilt)s2urirpno1am  mncta( sDrrum no4openiociyd m2rln sn(0tlerxocta1lp r nvolt  2uoxm3iy1aptelicia()a2urxmpoo4optnmoetatlaDulnmp;() etnmo3tytlptrluvo;s)seto(rpoo1opt  neilt srtrx ont1openii3iydls um(vsnu0arerxr3oo1fpD  uvo;t0setmiopiy4ome lies t aDtmumpnu4aet ioetad aDrauvsn()trenmr ia1fa  anes;s0t2toimpoo4omtemicia(farraxm ;o4olx  icilsfaDeanvo u)artoxf3oydfmD  nvil(0 2xmir3nudolt  icsas)sDrrxr ;t4oet moeiatlaDumu o;t0 exrmf oo1faDrlivs (0sexoxm ou4ap nlfei t)srtmxrpou0tpeomicias s2umums t)trxrxo oa1la e ivils s2xrirpoo4om  lnesasf rtrumooo0oex  ieildlm2ea( p;t) rxrmo iotla  ln o s setmxm iy4altnmnciltf Drmumpot4alt mf3tltlsDrmnvpn()trenifciotlaDr uvi t  rtmxr iydomenlfvia( sruau pno4tpenmoetlsfa2rln s;u4alxrmr tytlmD ai o ( s2uoio nu4omen netl() 2tmu  ot4tltoif3iltls2rauvs;() ltnircia1lm r iei s srtoxmpoodolt lnvils) rtrum nt1oltnmfeiydfa2rl( s;(0teenmo3iydlatr nvil( t2trim iy4al elfciltf rrm( oou1tltnmi3tadla2ean p;t4 lxrxo3oadlpD lnei;(0trxmxr3oy4amtnmnviatfs2urxro;u0oexoiociyt s2rmuvo;u4 rtniocoadfa eaues;t0t2xrxr oudol  mfvtl(f rraxr ;u4teenmo3iasls ea( pnt4 rtnif iy1fpte u o;t)sexmxopou4op emivtl( sDurxmo;u1optnif3iys a2rau pnu0altrxf3tytfp ranvilt s2uoxopiydam  lici (faDtm(m ;u1tleomfetatfm rl( on()aleomr tytopte n o;(  exm(o3ny4alt  netls)sruaur ou4ale  feils mDua( p;u0tlxoxr3iytfm ean o t0seto(mpnu4amenlfcias srur(m ;u0opx  f3iltlmDuanmo;u0trermr3oydlaD anvolt s2xm(o io1lmt mneia( artru poo4tleoif3taslm umnmp t)teermf tydfmD  nvs t)texmim3ou1ll e nci s)s2rmuront4teeomieiytls2ul(ms t0arenir oytopDe u o t)t2uoir3iu4lleemncs s)s2tmxmpnu1olt mi3tas m rl(vo;()teeoio3oydlmDrau i s0tetm(r ou4lpteliet ( a2tmxr ot4alto i3tad sDea(vsn(4aexoxf oo1om e i ils)tetoxrpnu1amtemfvi s) 2uaxrpno1oee io3iydls2eln s;u0 lxnxrciydlp  ai sl(0tetr(o iy1omtnmnctl() 2tru poo4apen f3ildfa2ra(ms t0 reniociadomD anvi (0 2xmim oodlleelnvtat  Dtmum ;t4tltoio3ildlm ran on(4altnmr iatom e ies t) rurim3nydlp n fcil(  2tm( ont4tpxo iciad m2eau p;(4 etrir oa1fatr uvi;t0 eumim3iy1ol nlietl()arrr(mooo0aptn oeiadfs2umnvsn(0tetrmf oo1fmtrlnei s)srum(m3oodlp nmfesls arur(moot4alx  fciys aDemu o ()trtrio3oo1lateanvo;( teurxrpoodolt  fvt (  2rmurp;o0apt ii3tls m ua(ms u) rxrmo3oy1lpD  i olt) rxoxm3iy1lmenlietatf 2trxronu4ole moctys sDulnvont4arxrxrcoadla eluvs;()texm(r nu1ole lfet tf ruaxro;u0tet micilsls rmn pnu0aetomf3ia1optran il() 2xriopnodomt mfcsls  rur( pno0opxo i3ilslsDranmo u4 reomo oatlmDrai s;(  euo(m3oy1optnlnes tf rraumpoo1aeto i3iat m2ranmont4trxnxo iy1fpDelivs (0 2trio3oy4lptelnvsas  2umurp;t0tlt mieild m2rmn s t)trxomr ta1fpD lu s;t)s2urio3ny4ope lfvt t) Dum( o;t0opxomiciatfa2rmumont4tltnxociydlmtr i olt0t2xmir3oy4lpt lfeta()arur(r no4oeeoifetldfm emu o;u4tleoxfcia1lat lu sls s2xoxmpoo4lp eliet t sDrr( o;u4aee ii3iltfsDemn s ()teenmo tydfaDrlivi s)tetrxmpou4lmt mfvtls  2um(m ot0apeo ictaslaDuaums ()trxrmf tatopte uvo;s)t2uoirpnydaptnlnctl(  Drau pou1alt  i3taslaDrlu s u0artomo3ty1lpDe u ols0 rxo(mpnudamen nesls s2urum ou4tlxnmfetysfsDel(vo (4tlxnxr3iotomDrau s ()trur(mpiy4oleemfei s  2rmur oo4tlxoifeiydfa uauvsn(0alerio3iotfpD aieol( teuoxo3iydlpeelnei (farrm(  ot1aex iocildla elnmp;t0 rerio3iadfm eliei t)t2toxopoydomt lfetas)s2um(m no1oleo oeiysls2emn s;(0aexrir oo1la eaivils0srurirpoudlp e fvsls s2trum ot0oet if3iyslsDeanmon(4 rtrxf ia1la e uvo t0s2xr(opnudomt lici ()aDra(rpou1oet if3ils m ra(mo;() ltnmo iy1fptr i s s)sexoim ny1lpee fcsls)srtmum oo1ole iieias s2uan p;(4 lermrctydomtrli slt)seto(o nu1op   fei s) rtrxmono0tlx mociat s eauvonu0arxnxr3oa1oaDr n s;t) ruoxr iy4ope  ieil()aruru p;t1apeo i3iadlaDuaumo t0tetnxf oodlpt an olt)t2tm(r oy1lltnmncsa() rumx  ;o4oltniieiat mDranvsnu4artrio tytfa r u ols0seumim iu4omtemivi sfs2uru ono4ope ifctas s2ran pnu4 eerxf iy1oat luesls0s2tmim ou1ll nmncsasf Dra(rpno1apt micildla elu p;u)altoio3oy1fpt  uvi;s  rtrxm nu4lmte neslt  2rau  ;u4oetomfctatlsDrln o ()artrmf ty1latrluesls trtrxrpnu4alt  fct sfaDumxmonu4tpen f3taslmDuanvs;() etoxocoo1laD  ivi (0 rurxm nodap  lnei t)sDrr( o;o1olenmiciadlm ulnmonu4treriocoodlp   i i;()teur(r3io1lme liesat)s2trxm ;o1olx mf3tys s rmuvo t)artnio tydom r ueo;(0teuo(r iudll   fei sfarumum oo4aeeomoeiydlsDuanvpnu0trxoxo3iy1oaD  u ilt trxmxrpoudal emivtl() 2tru pou1ale mictadls2uanmo u)artrio3ootfaDr i i s)srumim3ny4ll emivsl( aDurxmooo4tpe io3ildls2elumo;t4tlenifctytfpDr uvo;t0 rumxr3ny1lpeelfcil()aDta( ont1ape miciadla ranmonu4areomr iytoatrlivsl() rxoio3iodlpen fcil(farrax  ;u1apxnmocilslmDrmu on(0trenio3oydfp  anvi;s0 ruoxm iudapeemfetat) 2um( p;u1teeo oeiys a rmn snu0 renxr3io1optr ivs;t trtoxo ou1am  mfvtl( a2ur( o;o4oltnmfcild sDum(vo u4altrxf ty1omtrlu s;t)trumir no1al  micslsfa2rr(moou1aptomictytlm2rl( on(4teerir3iadfmD auei t) rtmxopnu1lm elivsltfaDtmurp;t4tlt mfcild a2elnvp;t) etnmfctatlptelivols t2xm(rpnu4ape lnes ( artaur nu0oeeo feilsfm2eln pnu)alxomf tadopt aies t trurimpnu4apt  ivslsfsDua(  oo0aexnif3iys aDem(mpnt0texnmr3iy1fm r i olt)setm(opiy1llee fvta(fsDta(m ot1opt  feiydfaDumnvont0alxomr3iodlmt  ieil()teto(mpoodam elnctlsf 2trx  ot1tpeo fetytfmDrmn s;u4 exnifcto1fpD aieo (0srtm(r oydlpee fctat  Duaxmp;t0aetomieiadfmDrm(mp t)altoxf3tatlpD  i s;(0trxrxopnudamtemnet (f 2rmu ont4tee mfeiytfsDea(mo;t)texrir3ia1fpD ln s;s sexmir3nu4ameelicsatfsrum(r ;t0alxnmociytfsDulu s;(4 lenxf iydlp rliei (  etr(o3nodolen ivtas  Drmx  nt1ape mi3ildla2rm(vs;(4tltnif io1lm elivs;t0t2xoir ou4lp nmncsat)sDrrum ;t1tlxo o3ilsfs2ea(ms;u)aexnmfctydopDean s t0trxrxo3iu1lptelnvtat)arum(m ou0altoio3iyslmDran s t0 eenxr io1fp   u il()sexoio3no4alee nctas  2tm(r ;o0aptnio3ildfsDrln onu0trerxo3ta1latr ues;s0truo(m iu4amte nvs s) rum( oot0tlxoiociadfsDemuvpnu4tetoxr3oadlaDr n ils s2xmir oodop   nvias sDuaxronu1tleoiictasfa2ea( snu0 reomr3todlm   ieilt)srurirpou1llte ivi s)s2rr(mpno1opx mietys aDul(mp t4alxrxr oytom  ai i;(  2toxo3iudlmtelicsls)sDum( pnu1tpt  o3tys a uau o t0tetnifcoydoatr ivil(0 ruoir3io4om  mfvt ( srumxm ;u4tpx mocildfm2ea(ms t4aetrmf oodlptelu i s  rtm(mpoo4ap n nesls)aDuaurpoo4tpxn octldlm rm(vpn(0 rtrif3oadom r iei ( srtmxm3iodop   fvs s)srrmxm ou0oeeoiiciatfaDra(mo;u)tlermf3oytoa rai i;(0 rumir3iu1ll emivslt)srtmxrpno0apxomo3iydfaDran snt) rtnif3iy1lptr ieolt0 rtm(r iodllenmfesas sDur( pnt1apx mf3ildla ra(vs u0 rxoxocoodfpt aues t trumir3oodop n ici tf 2umxrpoo0ole  fetldfa2emumo u0teermo oo1om eluvs;s0 2uoimpnudopenmfvia()a2taurpno0apenifctytls ea( pn(4 reniociy1fmDrauei;()s2xr(mpiydomeelfctat sDtrxr ;u1apt moctys a2ra(ms u4tlenmrcoatfmtr neo;t0 exm(mpiudome  ncilsf 2uaumoot0oleniicias aDrl( o;(0artrxr iytla rliesl(0srxoxm nydaltn ncsl(fsrraxr ;o4altomfctas sDuln snt0 lxoxf3totla r u s (0srxmxm3oodomtn fesatfa2rrxr nu0tle iociat s umu ont)altrmo tatfaD  n o;s srtr(m nu4omeemicias srtmx  oo4opto ociydfs2ua(vo;(4tlxrxo ia1lmt  n s s0sexrimpio1optnlfeilt sDumxrpoo0oex mociaslaDrm(vp;u4aeeomfctadop rli sl(0srxr(o ny1lpenlncta( sDtr( poo4apenmfctltla emnvp (4artomfcto1opDelnvi s) exm(rpno4amt  feiat a2uaumoot1olxnifetat a2ra( s;u)artoifcto1lat aivo;s0 eumxr oydomenmivils s2um(mono4oetnmf3iltlm2eanvp;u4 etnxf oodlpDranes t)truoxm3oydlm e fcsls aDur( pn
\ No newline at end of file
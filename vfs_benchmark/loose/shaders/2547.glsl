@@ -0,0 +1 @@
+i olt)setm(o3io4am  lfvi s)aDrmx o;t0apenmoctlsfs2ranvs;t4 reoio3oatoa  lieols s2trxr3no1lltelfvt (fa2uru  nt1olxnmo3iadla2el(vsnt0tlermf tytlmt  i sl(0 2trir no1lme mict ()a2rrum ;t1oet  i3ils m2rauvo;u0altrxo oy1opDranesls0 euoimpnudape  fvt sf Dtm(m ;u4aet  iciad a rau o u0texnxociy1lm e i o;t t2trirpoy4omtnmietl(faDtaxmo;t0ale mfetytlsDulnmsn()arxrio3iydfp  livs t0s2umio3iu1olen fvta( sDur(ro;t4teen fetad aDrmnms;u0trerxfcoytfmtean ilt s2xoxmpny1lme lfei sfa2tmu ono0tptniociysla2ua(ms (4treriocoo1fp eli s s srxmxr3io1ame mietls aDrmxr ot4teen ieiyt s2um( s t)tltoiocto1fp eaivi s sexoxmpio4lpeelneilt)arur(mpnt4tet moctlsfmDrl( pnu0aexrir totlptr uvi t)truoimpiudomtnmnvsasf rtmu o;u1oexoii3tasfsDrm( o;u0alerircoy1la e n ils)t2um(mpiy4altn nci sfarurxrooo0altnmfetat sDumnvp;u)aleoxfctodopD au s;( srxrxo ou1lpte nvt s) rraxr oo4oltnmf3tld a uluvs u) rxrxr oydom rluvol(  2trxm3io1amen ivs sfaDtmu pnu4tpeomoetatfm ea( p;u4 rtrmfciytomt  u s;(0texoxm3ny4lpenlneslt  2rmu p;o4aetnifetatlaDumnvo;u4artnxrctytfp   nvo;s0sruoxopoy1lpt mfvslt) 2umxrooo1alx  ieildfs umnmo u)artoxrctotfmD luvo;s0seur(o3iu4op   fesltf Dtaxrp;u1tpt mietat sDra( s u0arenxr3totlat li o;s0truriopoy4opt mfcsat)s2ua(ro;t1tetnmoeiat s2ranmsnt0aeermo3to1opt lnvsls0s2uo(rpoydlm emfcias a2rmxr ;o0apt  ietldfs umnmo;u)alenxr iy1fa r ues s0trtmxopoudlltemnciat)aDuax  no0altoifciltfm2ulu sn(4tltnmrciy1lpD lu olt0seumxo no1op  mieiltf 2taxr nt0oet miciadfm rlnmpnu4 lerio iadfatr ivsl() rtoio3iodomee nvta(fs2raxmpoo1aeeo i3iltfmDum( snt0trxnxrciatoa r n o s trtm(r ny1om  lnesls)arrrum oo1oexoioeiatfm elnms;u0aeerio3ty1oat luesls)srtrxm nu1lm  lfvtat  rtmxmp;t4tptnmi3iyd aDelnmsnt0alenmf oatopD lnvi (0srur(mpny1apt lfcia( aDur( o;u1olen feiltfa2elu s;u0trxrio3todfatrauvs;t0 rumir3nydlp n nesl(fsrrmxr ot0tlt mictldlmDuan snt) ltnir iotfpD lnei;s s2xmim3ou4lmee nvt tfsrtmu o;o1tlxnif3tydlsDemnms;u4 lxoio3oytfm   ieo s)t2xoxr ny1ol nlivsas s2tmuro;u4opt if3tys sDel(vo;t0aetrmf3iydfptr ivi;t0trum(r nudomtnlicta(  Dumx pnu1aleo fciysfmDrmnvp;t)tltomf iotfpD  ieo;s0s2xoxr no1lmtemictat)aDtrumoot0tpxoifeildlm umnvs u4tlerxr3oa1fptr nvi ()trtoim nu1ap n ict sf Dumxmooo0alxnmfcildfmDrlu s t0aexrmrctatlpD  nei ( texmir3nudlptnliesl()aDumxmpoo4openii3iyt m2ran p t0 ltrxf3ty1fmtelnei;s)texo(mpiydam emnvsls)a2ta( p;t4apen o3ilsfa emuvp;u4trtoir io1lmtr nvsl(  2urxmpiydolenlfeil( sDrm( p;o1olxn oeiatls eau pn(4trtoio3oydlpt  neo t)trxmim3no4amtnlies s  rtaumoot4oltniiciaslm rl( on(4tlenif oatoaDrln ols)srtoirpiy4lm n nci tf Drax  ot4tlt if3iadla2eau o;u)arxrir3tadlptrlieo s0s2trirpnudalenmfctl(faDua( pou0aee if3tadfmDel(vo u4 eerif3ta1lm r n s;t0t2uoxo3nydol   nctat)sDuax p;t1aleo f3iydlm ra(vo;u4tetoxfctydoaD lu ilt  ruoir iu4lpt mfes s)a2trurpoo0aeeomociat m umuvpnt0 eerir oodopte n i (0 rxo(o nodll elicilt)srtmxmpno1oltnifcildlm2eaump;(4arerxrcio1fa eanvilt srxmxo3iudop nmiesa(  Dtm(rp;t4teeomfeiadfm rlumo;(4 ltrxf oatfpDraneo;(0 etoxm oy1alte ncs t)arur(  ou1apt mictasfsDran s;(0aexrirciydoa rau s;s) eumio nudlm  lies tf Drrxm nt4tet moeildlaDuan sn()trtoxf3iodfpD ai il( trto(o3iudol   icsa( s2urxrpno4aptoii3tys sDeanvs;t)areoif to1omDr nvs;s  eumxr no4olt mies tfa2ta(mooo0opx  f3iyd m raumo;u)aeeomo3to1fpt auei t0tetrxr ny1lm nlivsas) 2tr(  ;u0aex  ocias m rau pnt)tetrmr oo1opteaieo (  2tm(o3nu4optelnvtlsfsrtmump;o1oltnioctad mDrmuvp u4alenmo3oadfaD lnvo;()seto(o iu4lle mnci (f 2rrxroou1opxomo3iytfs eaump t0aeermr to1fpteluvolt)setmimpnu1al e nci t  2ra(mpnt1ale  i3tas mDra(vsnu4tltrxr todlmtrlivils0trtm(r ny1ale livs t) 2rrxrono4oltoifciltlmDulu ont)texnmf3tydlp   i s s0setoirpnu4apen net ()srrrurp;t4optnii3iytlmDulnms u4tlxnxr3oydfm eaueol(0trxmio3nydlme  ncsat)sruaxmo;u0tlx mocildfa2rmn sn()alerxf3todopDe ivi;(0 rum(o3nudopenmietlsfs2urumoot1olx  feiydfm2rmnmp (0arenio oatlmte ueo;s)s2trxm io4lle lnvt t aDrm( o;t1tlenmi3iys m2rauvpnt)teerxfctytfatr nvs (  eurim3ny1lle  ieslt  rumu pnu4olt ii3tldla ranvo u4trtoiocoy1fm rlivo ( trxr(mpoodaleemfetl(  Drax o;t0tptnmfcildlm umnmo;u)aexrif3tydom  au sls) etoim nudlpe  fvi t)a2tmxrpno0tpeoio3tldlsDul( onu4tetomrciydoaDranesl(  2xr(m ou4ope lnci tfa2taxroot1tltn f3tytfmDrlnms;t)alermoctydlmDrliei t0 ruoxrpio1ome liesat s2tau  ot0opeomf3iysfa2rmu p t4 exrxocoydomDrlu s s0t2xm(rpoo4lptnmfct (faDta(m no0oeenmi3tytfs uanvs (4tlerir3oatlpDelnes;t sexoxr3ou1alt  fctl(f Dua( o;t0apeoiiciytfs2ua(mo;u) lxnif tadfmt au slt0texm(o iydlmte nvsls arua(ro;t4aex mfeiad sDulu p u)alenmo oodoat an i t0 rtrxrpiydalte fctasf 2ta(ro;o4apto fciasfa elnmpnu4trtoirciotlpte nvilt seurimpou1lptelnciat  Durxmpou1texo o3tld m rlumsn(4trerxociydlm eaivs s t2xrxrpoo4am nlnesa(f rraxm ;t4olenmieiltfs2ul(mon(4 rxrif oytlmDeauesls0 2uoiopoo4om nlfvtl(f 2urur nu4aeenmoctadla2ul(mo;u4 ltrxr3oy1laDr u ils0 2xr(rpiy1omt  fvs s)aDum(mp;t0tltn fetltls2umu o u)trtomocoatlp  luvsls tetmir3nu4aptn ivil(  rtaur ;o4oleomoctat s elu o t4tlxrif3iytfmDeauvol(0srxrxm3io4apee nesasfs2tmxrp;u0tee  f3tadfs rmuvpnu0 lxomrcoadoatr nvils) exoxo3no4lpen fvtlt arraurp;u4tlen o3iytlmDuanvsnt) rtomr3iydlmDe ues s) rxo(o3iudalee nvt () Dtrump;t4olxniieilsfa2umu sn()arxnmo totoaDelu slt0 2uoir3nu4ameemiesls aDum(mpnt1olt mfciytla uluvsnu4trxrif3iotomDrlies s0t2xo(rpiu4op e ivs (  2rrxro;t0oexn feiytlmDelump t0 ltoif ia1fa  lnei ( trxr(m iodamt mieilsfsDtmxroot4tlt mfctld m2ranvs;t)tlxrxfcto1omt aivo t seumimpoodaptnlfci sfs2ra(mpnu1tee iocild a ran p (4 lxomo3oo1laDeanvol() rtrio nodapee icsl( aDrmump;o1alxomieiadlmDrmnvo;() etoifcoodopDrluvo s)teuoir ou1op  mnvslt  2um( pno0alxoioctytlm2rm(mp (4texnir io1fpD livs ( trxmxmpnudlmeelnvils)sDurum ;u0opt ii3taslaDuau o ()alxrxocoatlaD  ies;s)srtm(rpnodap  lncs t srrmu p;u0texo oeiytfs2ea(vp (0alerxrciodoateli i;t sexrxmpiy1ale  feil(fs2rr(r nu1oexoifciltfsDemuvs;(4 etomf3oa1oa e ueolt teurirpoy4ope mivs t sDtrumpnu1oleo fciadlm em(vs;u0 exoif io1lptr uvi;s trtmxrpoydal  mncsasfsrumx  ;u1tltnmi3iad m eanvo (0alerxf3ootoa  lies s) 2toxr3oudomtemiciltfs2tr(m ou1tpt  o3tasfm2el( p u4texoircootoa  li i;( trto(r oy4omeelnetls a2tm(ront1ope ioetytfsDea( s;()areomr oo1fmD anvilt sruriopny1omtemiet t  2uaumo;o0altoiieiatfs2ul( p (0aetomo oatfmDeaneol(  2xoio nudlp  mnesatf 2uru  ot4olx mfciad a2ul(mpnu)aexrmf ta1omtrlivo;(0texo(r oy4ope lnctls aDum( ono1tex ioctat aDea(msnu0tltomf ty1fm r u ols)seum(m ny4oltelnes (fs2tmxmono4oltomiciadla ulnvs;u4 rtoxrcia1lp r ueils0 euoimpnydllenmivsl( sDum( onu4opeoifeild a em(vsnu0 rxrxrcoo1fa rlu i s0trurxrpnudomenlivilt sDurxm no4opt mociasla ul(vs;t0alermoctodoateli ol(0 rxoirpou4llenlfcs sfarrrx pnu4oee mietlt m rm(vs u)areniocoa1fm  au ils0srto(o3iu1lpte ieta(  Dua(m oo4apx mfcild a2rlnvp;u4artrxf oy1op rau sls sruoim3no1ap emncilsfarurxroou1opxniiciadls2ea(msnu4aeeoxr3totlaDe ivslt truo(opno4ol e ncia(fsrraumpoo4tpxn o3ilslm eanms;u)trenxrctotomt au i;( seum(rpiu1optnmfctas)sDrr(rpot1oetnmf3iytlm2raumo t) eerir oa1fm e neols0 2tr(mpiu4lmeelfcta(faDurump;u1olxoifeiaslm2umn p (0aetrif iatla  lnvslt0trumio nodam elfetl(f rraumpot1aptoifctldfsDranvo t)aeeomf ootfpDean ols t2tm(r ou1ap  lncs s srraxrooo4opeomoctysfs rm(mp;(4aexrifctydfm  an sl()srurxmpiu1al   ivil( srrm( p;o1oeeo f3tltfmDrlnmp;(0treoir iadlmDeluvs t)t2xmir3ny4omt  fctlt)a2um( oot4aexoio3iytfa uauvsn(0areomo3ia1laD lueo;(  exrxr3oydaltnlietatf Dtauroou1tltn o3iytla2rlnvonu4 lxnif totfp elues;t  2xo(mpnydlp elict ( s2taumono0apt iiciltfaDuanvpnt4tltomfciydoatrau o;s0s2trxr3oydolte ncil(faDrr(mooo1apto iciadfa eanvo t0aeermf3oy1opDrlu olt) rurirpoudlm nlnetl(  2ua(roou4aleniieils mDraumo;u0altnxr3oytoaDelues;s  2xr(opiy1lpenlfvtat  rtmxm ou4aptoiiciat aDeluvs;t)tlxoif iodop rai o;t0s2tm(o3oy4lm  mfeiat  2ur(  nt1tlxomfciysfsDeauvpnt)alenir3iatfm eluvo;( seurxo3oodol nlnvsls s2um( ooo0tle  iciyd mDem(ms;t)texnmfciodoaDr ivolt0 euoxr nudamt mneilt aDum(roou1oeenioetltfm ea(mp;u4 reriocoadoateaieo ()s2xo(r iy1am nmfcsls  rra(  ;o1tetoioeiys s2rmn p ()aleoxf oydlaDeauesls0s2xrirpoudoltn nciltfsDumumpoo4alx  i3iadls umu p u4tltoxo3iydla rln i s)srxoxmpno4ll nmfcs (  2rruront4tlt moctltlsDemn pnt4teenmo3io1lm  auei s0s2tm(r nu4lpenlnvtat) Dtaxrooo0oleo o3tlt a rau p;t) eerir oo1fp  lieils0s2um(rpnodaptelnetat  Dumx p;t0olxo fctydfmDea( s;(4tltoir3oatfmDrln ils)tetm(o3iu4apee netat)sDrm(  oo1texo octydfsDean s t4 rerif ty1fmtr uei ( tetmim iy4olt  fvsa(fartr(m oo0tpe miciltfsDrm(ms;t)teeomrciadfmDr n o s)s2trxm iy4lmen nviatf rtauronu1tpx mf3iltfs2ra(vonu4 reomr3oodomt auvi;s)tetoim3oo4lm  licia(f Drau o;t1ole moctaslm raumsnt4 eenmf ta1laD  uei ()trtmim nydlpee fesas  rrmumo;o4oeenmoctad m2ranvo;u4trxnxo tatla eaneo;(  rtmxo3iu1lm   icils a2ur(r nu1oetomieiydls2rln s (4 rerir3oatop rlneo;(0 exm(o3oydopeemnct (f 2tm( ono0teto oeiysfm2elu s t4tlxrircta1oaDrlu ol(0trxrxm3io4lmenlnvt () 2umxrpou4apxomieilt mDraumonu0 ltrmr3ty1lm rlies;t) eurxr3iu1omtnmivsa()sruaurp;u4aeto f3ilt a elumpnu) ltnxo oodlp e nei;t0tetmxm3io1omeelfcs (f 2trx oou1olxo oeiyt sDeln pnt0 lxrifcio1la   nvils)srxoio3oudlm   ictat s2tru pou0aee ioeiys mDemnvo;u0 exoxo3io1oaDrluvo s  2tmxm oodole lictls a2tmum ;u0tlen ictadfmDea(ms;t4tltnmo3to1fa eluvo s t2um(r oodll emfcsatfsrtmu pou4tltn fctysfaDem( ont) rtrmr3iatfpDe u s (0s2xrim3iu4omeemict t a2umxrp;o4opx  feiys a2eaums ()aetnxrcoytoat livi;(0 2uriopiudapt  ictlsfs2rm( pnu0olt  o3tatlm rm(vs t0 ltrmocio1la  aies s)texrxm nu4om  mivilsf 2ta( o;u4tle  ociyt s2emu s;(0tleomf oodfatelieo s teur(opio1ap nmfct ( aDtmxmpoo4olxn iciad s2eluvonu4 lermfciatfptrliei s0t2toxmpio1ale mncta( aDrmxm oo1tlt  fctldfs2ua( snu) ltrif3iotom elu i;t0s2xm(mpno4opeelnviat)srrmxm ;u4oetoioetysfaDrluvp;t)aleoifctotom   u ils0t2tr(o no4altn netlt  rrauro;u0oexn fctltfaDul( s;t) rxrxf iydop   ieol(0t2xrxo oo4lmt lncsas)aDrmxmp;u4oleniociyd m2ranmp;u) etnmfcto1om r ivol()trtoio3no1ol nmivia(  2ua(rono4tet  feilsfs2elnvs;u4arxrir3oydlpte ueilt trum(mpio4lmenmici s sDua( p;u0ole ii3tysfs ulnvp;(4 leoir3ootoa r uvilt t2toxopoo4lpe  ics tfsrtmur ;u0opt moeiydlaDul(vsn()alxnxfciydlatr u i;t0 2tm(o nu4amenlfcsltfsDrm( o;u4apt  fciysla2ra( p (0alxnmr ootla eai i;(0 2uoxopio1omtnlivil()sDra(mp;t0tpen fciyd m2rln sn(0trtnifciadfmt an i;t  rtoir3oodopee nesl( srum(ro;o0tpxoiociyd s2umn snt0aeenmocio1op r u o;s0 etoim no4lm nliei s) rraxr ot0tee if3iaslm rm(vo;u4tetrxr3ty1lmtr i o;t0setrxr3iodopt licsl(fs2raxrpno4texoio3tasla2raumpn(0texnxr3ty1fat aueils trtm(mpoodlltelfeias a2taurpno4alt  oeiyd s em(vs;u) rerirciytfpD aieo ( tetmxopoydalt licta() 2urxrpno4oetn f3tyd a2ra( pnu0 rtnmo tatlmt  ivs;( seumim oodaptnlfvia()aDta( onu1tlt  ieild aDrmnmo u0trermf tytfa e u i;s)t2xrimpoo4lpe mncta()sDrrurp;o4oleoiietlslm umn s;(4tltoir3to1la  ln sl( trtoxo3iodap nmieil() rrrur nt4apxoio3tydlaDul(mp t4alxomrcoa1omt livs;s  rtmio3oo4lle  icil(f 2tmumont0aet mociltlmDra(mo u0alxrifctotlmt ln i;t0texoxm io4aptn fctl(fa2rr( ont1aetn fctysfm ra( onu0 rtomfcoodfmD  uvolt) etoim oo1apeemfvs sfaruaumpou4teeomi3iltfm2rau ont4arxnmf oatfa ranvilt)srtrim3ny1optnmivtatf 2raump;o1oltnifeiydfa rln s u)trxoxf ta1fmDr i s t0t2xmxmpny1apenmfci sfsrrau ont0oexoifcias a rauvp;u)aexrxo3iatomDrai s t0t2uoim3no1llt mnei s)aDrmx oou0aex ifetysfs ulnmonu)texrxr to1la elu i;s) exm(opnu1lm emfctasfarrmu p;t4olt mictyslm emnmsn(0 eeomo tytlmte uvslt0 ruo(o3oudoleemiei (fsrua( o;o1openmfctlt m2rl( p;u0aeeoirctytfa e n o;s)t2tmxr3oo4op   nctat)aDraxrpno1aet ioctydlm2eau o;(0trxnxr3iydfaD lueols0 etoxr3ou1olte ivias) 2rmurp;t4oexn ictasfs emums t0alxnxr oodlaD ai o;t)s2xrxm3nodop e fcslt  2tmxro;t1aetnmfciydlm2uan pn(0altrmo3io1la   n s ()seuoxo iudal e ncs t) 2tm( pnu0aex ioeiad s2rl(vp;u)tetrmo iatfaD  nvo t0seum(o oodlle mneias aDumxr ot0texo fciyt aDem(vp;u)arxomo3oy1op r ueo;() 2xoimpno4omt lfes () Drmxro;o4oex  ietydfm2ul(mo u)arxnmr3tydom e ivo ( trxr(o3nudopeelnet ( a2raxmo;t4optnmf3iys aDuan s;t) lxrmrcoadoa  lu s ( texmxo3no4apen ies sfsDuaxm ot4oltomf3iat m emuvs ()tlxomo3ootopDr n o (0 rxr(o3oodoptn fvt (fs2ra(rooo4teenmfeildls2rmums;()artnxo3todomtrlnvsl(0s2xo(m3oydlmt  iesls) Drrumooo4oexniictlsfs2ua( p t) exnxrcoatopte nes t) rxmxo3nodlp elfcslt)artm(mooo0aleo f3iyd m ra( pn(0 rxrif3oodoatran o ( sexrxr iodol e fes t aDtmum ot0tlen o3ild a2elnms;t0alxnifciy1fatraieilt) rto(m iy1lme  ieiatf Dtau p;t4olxn o3tyt mDuluvs u)alxrxr iadlpD ai s;( seum(rpoydapee fvilt  rtru o;o4alxoifciat s2eluvonu4arermr ootla  aueolt0sexoim oudlmeemnctlt arra(  ou4olen i3tasls um(mp;t4trtrmf ta1lpteln i ( s2umimpny1apt  feia() 2ra(mpoo1tlx mo3tadfaDra(mp (0 renxfcty1oateaueslt0texoxr3io1amtemici tfaDrrxro;o1apenmociatfa elums;u4 lxnio oytfmD lues;t)truo(rpoydll   icsas) rtrxr oo0olxoiietlsla emuvp;t4arxoir oy1oa  livs;t)teuo(mpiydopte ici t sDrmur ;u4tlto fctld s2ea(ms u0tetnxocootlmDraieslt)t2xo(o3iydol emictatfs2urum ou0optnio3tasfsDrmums;()tlerif tatfa raneslt0srtrirpiu4op e nvt s arrr(rpno1ape  fetls m rm(vp;u)aleoiocoo1fpt  u i;t tetm(m iu4ale  iesa(f Drax pot4oee  f3iltfa2emu p t) rxnxf3oodfp  ln slt)truo(r iu1omtelfctl(fsDrrxm ;o0ape  i3iasla rau pnu4tltrif ty1fp rau o s0s2xrxo nodlpe lneil(fsrta(  nu1tpxoiicilt a eln s;t)aetrir3ta1fpt au o s) 2ur(m3nydal e ivi t a2uaxront0tex mi3iysfa2elu snu) exrmf3oy1latrln s;(  2xmxr iu1altnlfcs t  Drr(ront4apeoioctytls2ulnmo u0alerxoctotop elnvi t  eto(opiy1amtnliviltfartm(rpnu4oleo fctltlaDeluvp u) rtnxf iadoptrauvils)s2xoxrpiu1olenliet () 2tm(m ot4teeomo3tysfsDeau pnt4trxnmf iadla elnes;() 2umir3oo4lmenlivtltfsDraumo;o4teto i3ias a elnvo;u)alxnmr3oatomDr n s t)s2ur(opoo4op  mictls  Durxmooo4tetoif3ildfaDea( sn() rerxr3tydoatr iei;t0seum(opiydlm elivta()srtm(rp;u1aexoifcildfm2uaumpnt4 lenxr3oadla rluei;s0sexoxo no1aptnlnvtat aDrr(mpou4olx ii3iltfm eanvpn(0 etrmf3oatfpteln slt teur(r3nydapt mict (fa2uau o;u4oleoio3ilt mDemums u0 eerxf3oo1fpD lneslt)srxr(opiodlleemfctl( sDur(rpnu4tptn fctltlaDrmn o (0trxrmfcoadlpt anvi;(0s2umirpno1opee fvt ()a2ta(m nu4apt  f3iadlaDean pnt) lxnif3oatfpDrlieil()setmimpiy1apenmfct t)a2rmumo;o4tlenif3ilsla rl( snu4aeermr3ootlm eanesl()sexrxr3ou4omenlictas) 2taxmono0tpx io3iytfa2eanvsn()treomfcia1lmt  nvo s sexoxm3nu4ale lfesas aDrmu oou0tlenmieiydlsDrlnvo;()tleoir3iotfpt lnvils)teur(r nu1ame  nvs sfaruaxmono1olen f3iytfs2emu o;t4 lxoxr oodlaDeanesls) 2xr(mpnodlp eliciasf 2rrx pnt0oltn oeiaslm2rmuvsn(4aetrxr oo1fa  lneilt  rxmim3nu4omtnmnvt sfs2urxrpno1alt io3tytfa2ua(mpnu0tltrir3tadlaDeai slt)t2tr(rpoudlm e nei tfsDra( onu0aeenifctadfa rlnmsnt4aeeomf oydfm  anvs;(0 2urir3oo4amtnlfcta(fsDtrumo;u0teen i3ils s ranvs;t)tltomo totfp  anesls)sexoir3io4om   ieslt s2urur oo1apx  oetydls2rl( o;()altomf3ia1latelu o;(0 exrxm iydlp e fvi tfs2rm(r ;t0apxnmi3iat s2emuvo;t4 lxnif oydomtrlnvi;t0 etoxm iu4lp elnctas)aDumur ;o4oeto i3tyd m emn sn() rxrmfcoadfpteau ols)texriopiy4altemiviasf 2rmurooo4aexo ieiydfmDrln s u0aeerxociytfptelneolt)t2tmxo oy4ll e nviasfsDtmxr ou0tpxnifciytfm2ranvo t4 lxoxf3io1lp r u o;(0 etm(r oydopte fcs (  2um(roou0alxoii3iltla elnvo (0tlenxo todfptrli i t0seur(m3nu4al emici t)s2urxrpou1oex ifciadfsDuanmp (0alerir3to1oaD luvo;t seuoimpiudalt lfvtas aDur(m ot1tpeoii3tasfs elnmo (4 rtnxrcoy1lp rlueilt)tetrxrpou4ol nlnvslt)a2tauroou0tet iieild s ul(mo;u) reoxrctadlateau il()t2ur(opoo1opeemnvi s srta(rp;t4opt moctlslm rmnms u0 exrxo iadomDelu i;t  2xmxr3iu4omenlfvi (  2trxro;u0apto oeildfm2ua(vo (0 rtnxfcoatoa r i s;s srtmxr iu4optnmfvsas  rua(mpot4aetn ocilsls2rm( s (4 lxomr3oodlm  lu slt0tetoxm io4om emnesat a2um(mpou4apeomocildfm2raumonu4 eerirctatlp  luvo;(0srtm(r oudoptnlfcsat) 2ur(moou0olto o3iatfm2ea( p;u0areoiocoo1lpDr u o s)sexr(o3iudom  liet ()artrxroou4tlx  ietyslaDrl(monu)altoxf tadfateluvo;(0s2xrxo ny1lpenmnvi s)a2ua(moou1oeeomo3tldls2rlnvs t4 eeoio iadfpD auei;s)t2umim iy1lm elfcsl(f Draxmont1olenmfctytfs uaumo ()tltrifciy1fpDeaiesl( tetrio3nudolenliviatf 2uaxr ;u1tpxn f3ilsfsDul(msn(4altnmf3oy1fat an ilt0t2xrimpny1ll  lfctl() rtr(rp;u1alenio3iyd a2uauvs t4 rtoir oytoptrauvs () 2uo(rpnudop n feil( sDuaxroou1oeeo o3iyt m2rauvs;u)trenxrcoydomte n i;t0 euoir iydomee ieils) rrru pot4altnmi3iltfa2ulums t4 rtrif oatopt  uvs;()s2tr(r ny1amtnmnes (  2ta(r ot1aetnmoctadfm2ul(mo (4 lxrif oy1fpDrau o;t0sexoim3no1lptemiesat) Dtax  ;o1tpen fciytfm ra( pnu0tlerxfctytop e ivs;t  rxmxo no1omte nvt ()s2ua(moou0texnioctyt a2rlnmont4trxomfcoa1faDr nes s  ruo(o3iodop nlfcta(  Dta(rpoo4teenmoeias a ul(mo;(4 eerir iatfm eli ils)tetm(rpnudlmtelfcilt aDrrx pot4ole iietysfs2rmuvo t0altomf tydfmD au i t0t2tmim3ny1openlnctl()s2tmur ;u1tltoioctydfm2uaumo () reomfctydlptr n ols) exo(o3iydom e ivilt  2tmu  no4tlt ifciyt s ulnvo u) etnxrctadfaD anvi;s0 2um(r3nydamen net t arrax oot4tlxomo3ilslm uaumo;(0 eerxr iadfmtelueo () eum(rpoudlme lfvs s s2ua( p;o4olx  fctaslsDrmnmo u4arxrxociydfmD  nvi ( teum(rpnu1amenmiei (f Durumo;o4oeen ociltfs2ua(msn() renxf3io1oaD  i s;t trumio3nodopt mnesa()s2ur( o;o4tleoif3ias aDelumsnt4aeeoxr tatlp raueo;()sexo(rpiu4llenlfeiatfsrraum ot0alenmoctldfa2el(monu)aetnxfcoy1lpt lnei;s0t2xr(mpno1aleemnvi sfsrum(r ot1tpt  fciatla2rm(mp ()texnmocoy1lat  n ils)t2toxr3nydlpt lfesl(  2uru o;o1aptn f3iat a2um(mo;()tetomr oatomD lnesl(0trtrio ou1lm  mivil() rtau  oo1tex if3tatls2rmnmonu0 eeoif oa1om  livs s)sruoxm oodom emfvta(fs2tm( o;t0tleoioetlsfm eluvsn(4 ltoxo3oy1lpD  n ils0t2uo(m io4ome micilsf Drmumpnu0aetomi3tytlaDrmu pnu0 exoio tadlm  lu s s0texrimpoudal  mfvsl()sDtrx pnt4tptn f3tlsla ranvs () reoxr3oytom eanvolt seto(m no1lm e ics t  Drm(ro;t0oeto feiydfs ean p;() eenif to1lp   uvilt0texoxrpoydol e fvil()srrm(  ot0apx ioetls s2em(vs;(0aeeoif oa1fpDe ues;( teum(opny1ape mncil(f rrruro;u4tleoifcils aDulu p;()texrxr3tytfpDr ivi s0seto(rpiy4amenlieia(farurxmooo0optnmi3tlslm2ea(von(0aexrioctydla  lnes ( srtoiopiydop  lncias)a2raum oo4texo octat mDeluvp;u4artnir3totlm   ueo s0 euoir nodol n neias)sDrau poo1optniiciyslaDua( p;u0arxoif oy1oateau ils)sexmxo3iu1am  lnesatfarrmx  no4oeeoio3iytfs rlnvs;u) lxnmf3oo1omDranei;(  rtmiopny1ap elfeils  rta(rpno1oexn octyt mDuanvp;t0 rtoif3iytoatr nei s)sruoxm3nodlptnlfci sfsDraurpnt1aptnmociadlaDuanms (4 etoio3iadlmDrauvsl(0s2trir3oo4llte nctltf Dtm(moou0teeomfctatfmDemump;(4 ltnmf3tadoateaueil(0 rumir3oo1alenlneta(faDra(ro;t4oexoio3tatfsDrm(msnt4texrmfcta1oat lnesl()s2tr(r iu4ll elnci t a2ta(rpnt1oltnmo3tatlm ra( s t4aetnxo oydfmtrlnes t trumxo iodame mncs tfaruaxm nu0aexomf3ilslaDrl( p;u0aeermf3oy1fptelnvols0seumxo ny1am n ncsat  2um(rpnu4alenmfeiasfa2ul( s;t4arenifctytfp ranes;t0 euoxm3iu4ope  icta()sDuru  ;o0apx io3ias s2elump;t4trenmfcia1la r i ilt)trtoxrpoy1ol   ict t) Dtmur oo4apx moctlsla umump (4artomr3oytfmDeluvsls)setmxopiy4alen nvilt  Durur oo0ape io3iyt sDem(vp u0tetnifctadlaDe n i (0trum(r oodol n fvtat)s2urx pnt1tltomo3iysls rlnms;()trenifctodomD aneo;t) eumio3iy1lpenmneia( s2tmurono4apen o3tlsla2rm( s;t0teeoir3tydom rlnvo ( sexoirpou4ol nlfvi t  2urxr nu0aexn ictas s ea( s;(0tltnmrcty1optrlneilt s2xo(mpnudlpenmnvilt  Dumx oot1aet miciatfmDeauvo;t)aexnir tadop elieolt)s2tm(m no1lmenmnvsat) Dtr(mpou0tlxnifeiad mDran o;()arenxr iotfmDrlieo;t)trumxmpio1lptnmfes s) 2ua( ooo4tpxo ieiytlmDulnms (4 lerio oy1optelu ol()setrimpoo4om elnetat arua(roou0aleo ictydfa2el( snu0trxomo3iatlmDran s;s) rtrxo ny4olen icias)arta(mo;t1texoifcild sDrluvonu4altrifcoodoatrln ols  eum(o nu1openlicsa( srrm(mono4altoiietadlmDrlnvpn()tlxoxfciytla  lneo;t0tetmio3io4lle  ncsas srua(  ou0opxnmietltfa em( pnt)aexnif oa1lmt  nvils t2toxm3oudomt lfvil()srrax oot0olt ifctad s rlnmp;()tleoircoodfaDe ivsls) eur(o no4alte ncs sfsDtaxr nt4olxomoeildla2emu o;t)arxrircoy1oaDeaivils0t2to(opny4llte nvsls sruau o;u1olen i3tltla rmump;(0artnioctytopte nvils) rxo(m3oo1lmt mfeiasfs2rr( ono1oeeomieiasfaDrl( ont0 lxnxfciotfatranvsls0setrxr3ny4optnlnvslt)aDuau  ;o4oex mfciad aDumnvp t4altoxfctodlp eaiei;t0trtmio3no1ame  ivs tfs2ta(rp;t4tpe mf3ilt s2ranmp;u0 eeoio3oy1op  lu ols) 2tm(r3oydomee ietat arua(rpno0tlto fciltfmDran p u4 lxrxocoa1laDran s;s0trtm(mpiydol  mici (fsruru  nt4ole moetyd sDum(vs;t)aexnmr3totopt ln i;() exmxr oodlm emfctasf 2tmx pnt1aexn f3tadfm rlnvp;()tlxnio3oa1op r i sls0texmiopny4olenmictlt artaum ;t4ape mi3ildfsDelumsnt4alerxo oadfpt aues () 2xmimpny4ameelfei tfsDrrx p;u4teenii3ils sDuluvo u4tetrif3oo1lm  aiei;t)t2um(m3iodalenmnvs (f ruaurooo1ape mfciatfmDranmp u)tlxnxocootlaDe n o;t)sexoim3oy4ope  fciat) rtau pot4apt  f3ils a2ul(vo;(4tetoxf iydoptrln slt0 exriopno1op   fet s)s2tm(moou0aex  f3tltls ea( p u4trermf iatlaD an olt0trum(o3iu4ap emnet ()s2ra(mono0olx mi3iatlsDrlnvo;t)trtriociadlmte u ol()setm(r3oy4lmt mneta( aDurxr ou4oee moctatfs2eau sn() etnxf3oydom  livslt t2uo(m3oudomenlncsl(  2taumono0tltoio3iltlaDuluvpnt4 rxomr3iadoa r ivsl( s2xoxm3nodal e ictlt a2tr(rp;t0oexoifctltfs el(vont4trtnxfcoytla  aieo;t)s2tr(m oo4ll   fci tfs2tau pnt4apx ifeiasfsDrm(vsnt0aleoio3iatom  auvs () rtmxmpio4ap nmfvta(  rta(mpno0apto ictadfs uln p;t4 rxoir3iydlaDelnvs;t  etr(m nudamt miviat)aDrru  ;t4alt  oeiatls2umnmo (0 eerir3iatlmD li ol(0t2xmxopny4al n fei ( s2rrum ;u0tlt moeiatlaDum(mo u4trxrmf3oatoaDeaieo t0trtmim3oudom e fcsa(f rtax oot1apx io3ilsla2rln o (4tetoir3ty1fpDrli o s)t2umxmpno1ap  mfcil(f 2rmxm ;t4tlt moeiytla2el(mo;t4 ltriocoy1om  an i s s2xmxopoo1lpe mivsl()srtr(monu4olt mo3tlsfa ean o u0trtrmo3oadoatrln ils  euo(mpoo1lp e fesa() Dumx ont4opxnii3ilsls2ul( s;t)areomfctatopD lueo s  2to(o3oo1alee fvta(farrmxmpot4tpxo oetatfaDuaumpn() reoir3iydomD an o s s2xr(o3oo4ll elfvta(f rta( p;u1aeeo iciyslsDrlu ont0 renio3iotfmt  nei s) exmio3iydllt licta(  2tmurpot0oee  fetatlm eln o;t) rermr3iatlmDelu s t)trtrxo oodamt  fct (f Durumono4aetoio3iatls ua( onu4arxoif iadop  aieilt0s2xr(r nu4lm elics sfaDur(mpnu1alt iociyslmDem(vp;u0 eeoif totoa r n s;t0trxmxm iy4lle micilsf Draxrono4alt ifctysfa2uln p ()trtrxo ta1lm rlneolt  ruoir ou4lp emfvias)a2raxm ;t0tlxn fetldfs rmn o;u0 eenmo3tadfm eluvol()srur(mpio4amee iet ()s2tru pnt1olxn o3iltlsDrl(mon() rtomr3tatopDe uvi t)setrxm3iodal emnvsl( srrmu pot0opxnioeiys a ul(mo u) exoxo3iy1oateluesls)t2tm(opou1amt mics t a2rr( o;o0tpt  i3iytls2eanvonu4 ltnif3iydom   n i s)s2xmxm3nu1lmt mfviltfarrau  oo1ope  icildls em(vp;()alxnio todop rau i s) 2to(r3io4omtnmict t aDumu o;t4opxo o3tatlm2rmn snu0trxnirctydfptrluei;s) 2tmim3nu4ap e fvi t  rurx p;t4tpt  fctyt mDemnmp;()alxnxf ootopDe i o s0 eumxopiodll n nvil( s2uaur ;t4aptomociatls emnmon(0 rtnir3iotfat luvs s  eur(r3nodam n ivia( s2rr(  ot1tltnmf3iat s ranvo;t)altoxr3tatfpD ai sl()setmimpnudllt  nviat) rtmu o;u1alxoio3tat a2ua(vsnu0 rtrifcto1laDeaies t t2xmim oydole lnctl()sDuaxmono0ale iicildlm2emnvpnu) etrmf3oodlm eaueo s t2tmir3io1alen ivs s)sDrm(m no4aeenif3tlt sDumnmo;t0teeomr3oodlmte nesl()t2xrio iy4ame mfei t)a2urxmpot0tlx moetld s2um(vonu4arxrmo ia1lm  aneilt)srtr(m nydoltn fvils)s2umxr ou4ope iieias aDrm( p t) rtnxf iy1fpt auvo;()texrio3iy4lpenlnvi ()a2raxm ot4olx iietyt sDelnmsn(4aetnio iytoa r uei t) exoxo oydale  feiltfsDrru o;o1ope iieias sDuanvp;()trxoif oodom eauei ( texrxmpoudlp elnvtl(  2rax ooo0oetnif3iltla rl(vp t)trenmfcoo1la ran s;t)s2xr(mpiu1omenliei tfs2rrx  ot4olenmo3tasla2eaums;t4arxoxo3iatlp  auvo;(0 2umxmpnu4lp nlfctat sDurx ont4tpto oetldfs2rl(vsn(4tlxnxr3iotlm  anvolt)t2xrirpno4lmte ncsl(  2urxmo;t0apxnmiciasls2emn pn(0 rtoio3io1fa rai o ()srxmxo3oodol   nviasfs2tmx  ou0aeto f3tyd s ra(vo t4arenmo oydoa rauvilt)setrir3iodoltemfci sfaDuru pnu1tex ioeiasls2ua(vpn(4aetoir3tadopD  nes s)teurio3nudopt mics sfarraxr nt4alt mfciadfm rmnms ()arxrir oatopDrlivslt)sexmxmpoodoptn icsl(fsDum( o;u1tpxomo3tadlm2elu p u)trtrifcoadlaDran il()tetrxm io4altnlivias  Drmur ;t4olenmoeilt s2uau p;t)altomo ty1fmte ivs;() rxmxr3iodop nmivtlsfs2rr(ront1aex  f3ias s2umu snt)tlerxf iotlptr u sl( trxoim3ou1lpe lnesltf rrmxro;o1alx ioeiys aDra(vs;t4trerxf3iytlpt auvo t0 2xoxrpoo4apee fctl(fsDurx o;t1aleomo3iadlm um( pn(4arxrmr3oytla e uvo s t2uo(rpnu4lp elictls)aDraxrpou1opeomoetls mDum(msn()texnxrctotomte uvols)t2xoim nodll n nctat)s2ta(r no4teenii3iadla2ua(vp;u0trerir io1optrlu ol( srtm(m3iudolen fcs tfs2raxmpnu1aet moetytfs2rauvpnu0trtomrcoatlaDranvs;t0s2urxo oodomenlfvsa( s2urx  ;o1olxniociydls2ea( o ()teeoxf oytla rlivs ()seuo(r iu1omt mivi ( a2rrxr nu1tpeomfeilsfsDuauvs;t0arxoxf ta1oa eluvs;t)texoxr iu4optelivi (fartr( onu1tleoifetadla ulnms (0arxrxf3oy1fm r ies;s0srur(o ou4lmeemiviat  rtr(  ou0opxnmoeias mDem(mon(4arenxrcio1lmtraieo s0srtoirpiu4lpe mict tfartmxmp;u4opeomociadls2elnmp (4teenmfctotlp rai s t)srtmxr oy4openlietat)arur(m no1oet moctyslmDumnvpnu) renmrcoodlmtr nvilt0 2ur(mpiodale lfcs (fsDurxm nt0ape  oeiysfs rmumon()altnio3iy1la r nes;()texoxrpnu1am  mnctasf 2rru pot4apt mo3tyt mDrlnmo u0 eerxo3oytopDelnvs;t)t2umiopio1alt  fcta()aDtax oot1apen octat a2el(mon() exoxfciydfateluvsls)srtr(o iudlm nliet ()aDrrxrpot0tleomfctlsfaDemuvsnu)alenxr to1lpDe ueo;(0trxoxopnodopte ivs (faDrau poo1teenmo3ildfm ulump;(4 exrmr tytlpte n i s0s2uoxmpio1amt lieia(f rraxmpnt0alx  ietysfsDrmumsnt0trxnmr ta1fm  auvilt)texrio nydomt lfeta() Dtruront0tetoiiciltlsDrlnmo (4aetnio3tatop   iei t)setrio3ou4omee fcsat sDtr(mooo4oet  fetys m eanvonu4aexnio tydomDelivs (0 rumxmpiudol  miet t) rua( pot1oeen f3iyd s ulnms u) reomo3ootlmt lnvi t t2xoiopoodllee nvtl(fs2rmu poo4teeoiieiyt sDrmnvo (0alxnxrcoo1optr nes;s t2um(m3no4opeelivsa() Durx  ou4olx  fciyd s2ra(vs;u0teermfcoadop rlneo s setoxo3oo4ll e fetas  Draumooo0tltnif3iysla emnvp t0 etrir oytfpteaueo (  ruoxmpny4olte ivs tfa2trumpou0tlx mfetadlsDra(vo;t4 ltomocoydfaD  neol()trur(o io4ape livs t  rta(ronu1olx mo3tytlaDea( pn(0 leoxr3iadfatelu o s)teurimpoudlp n ncilt)aruaxrpou4olx io3iydfa rlnvo u4aetnio oodfaD ai s;s0teurxo3ny4am   ivs ()aDurxm ;u4oetoiiciysfa2eln onu0arenmf3iytlmt  ieolt sruoxopoydolt lietl( sDuau  nt4altniietydlm2rl(vonu)tlenmrcoytomDeanvs () rumirpnodom  lncias)a2tmur oo1alx iociat s2umnmo;u4teerif3totlmDe uvs;t0trtoir iy4amen ivsls)sDtm(  nt4tpt iieiltlmDraumsnu0 exrmf iatomDe nes (0t2tm(o3oudap nlfcsa(  rra(moou1tlt mo3tlt s rluvs t4 renxo to1oateluei ( t2ur(mpou4lp  mnvia() ruaxmp;o4oex mo3tatlsDemu snt0altnmoctatlpt luvils seumim io1omt mietat arrrump;u4oex mictltfa uanvsnt4 lxnmr iatlptean s t) 2tr(m3nu4ape  fet sf Dururoou0olx iieiltlaDra( o t4 rtrif iytomt lu i ( t2uo(o oy4lp n fvi t srrru poo4tpt moctldlmDelnmp;(4tlxrmf oy1fmtrau s;t)s2xoxrpou1alenmnctl( aDrmxm ot4altomietaslaDra(mpnu)trxnmr3tydlptrli il(0srum(mpoo4omen ivi t)srrrumpoo1tpeo fctysfs el(mo t4 rxnxr3to1fmD an o s) 2tm(opoo1ome lncsls)a2ur(m ou4tlx mo3tytla ra(ms t4 rtoxr oy1op  livi;s0trum(opoodlpenmiesl() Drmurpoo4aetoiictltfsDem( p (4aexnir oadoaDrau slt0t2um(m oo1apeemneslsfartaur nt4tle mfctyt sDranmo () rtoxocoo1lpDrauvilt) 2uoio3oy1ope lnct sf 2ua( onu1teeoiictatla2ul( pnt) reomr ia1lm   i s (0 etm(r3oo4ape  ncias)aDta(r nt0tpt mf3iys m ua(ms u)tltomo3iotlp  ln s;(  rur(rpoodaptn fvsas arta(  ;t0tltn fetadls ul(vonu0alxrmrctydlpD  ies;()s2umir iodlmen nct s  Dumxmo;t0olxomi3iasfm um(mo t0tlenxf tytfaD  neols s2urim3oo4ol e ncta(fs2urump;t4opx mi3tlsfa2eanms;t4artnir oa1opD lneo;()s2trimpnu4ole liciat aruaum nu1altnmfeiysls2umumo;u4 renxrctatomt au i t0srxm(rpoudll elfvtls)arumxm no4tlenmf3tasfmDul( snt) exoifctotoatranvi s0 2tr(m oy4ol nmiei ()artm(  ou4tpt  icils mDran o;t0 rermf3tatfpDr ies ( trto(m3oo4oltnmnctl() 2tau  ;o4tpx iocildla2um(von(4 exnmo3tatlmtraiei;s0t2uoim nudapeemfesl()srtrum ou1olenmfeiysfs ean pn()alxrxf3oo1lm e n sls)seumim oodam emnet (f 2rau ont1tleniociltfm uanvo t4tlxnmf3iotlate u s (  ruo(rpou1lp n nvslt)aDurxmp;t4ope  ociasls2em( o u0aetomr3tytfm  livi;(0t2xoxr3nydop n iciatfs2ua(m no1tptnmf3iysfa uln pn(0 reomrcoytfpteluesl()t2xriopoydom  lfvils srum( pou1tet mf3ilsla2emnvp u)teerxrciytfm raivi;t0 exr(mpoudllt lnvsat  Dtrum ;o4aexo octasls2emn p;(0 exnirciy1opDrluvi t t2triopnudoptnmfcsls)s2ra(mp;u4olxo fctyslm2ulnmp;u0artnmfciadop   uvs (0sruo(r3ny1lpenmict sfa2rr(r oo1aexomieiytls em( pnt)arxnxociytop elnvo ( t2uoim3oudlpt mfet (fs2uaum no1oeenifetytfm2emuvs;u)aetnmr3tatop r ieo;(0srur(rpiudlltelfcsa()a2um(ro;u4oltnioetatlaDrauvp;u) lxrxr3totopD  u s s0t2xoxopnudlpeemfet ()artmu pou1tpxnmictls s2umn o;t4trtoio3oatfat aies ( t2um(opny4lmtelieslsfsrraumpot1tee  iciltla2emn p ()artnif3io1lmtelies s  rtrxmpou1lm  lnct t)s2tm(rp;o0aexoioctasfaDelu o t4 reomf3totlmt aieol( seumxr3ny1lmenlneslt  Dumu ooo1tle moctadfm em(mon() exnxf3iadlm  auvils)t2xrim3nydap  lics (faDtmurpot1aet iicilslsDuln sn(4 exnmo oadfm  livo;(0t2xoxr3ny1lmtnmfvtl(f Dumxmoou4oltnii3iaslm2eln o;()tltnmo oo1fmt lu s t0 rxr(opou4ope lietl() Dtmumpot0tle  o3tys s2eauvo ()aetnmo3iodla ranei;t0 2trim nudole  fcsas  2rm(mo;o0aexo o3taslm2ra(vpnt0treomo ia1fm  luvo t0trtr(o oudal elict t) rtauroou4tleo fetasfa2uluvpnt)tlxnmf3oy1oat ln o t0trurio3oodlptn neslt  2umumooo0aee  f3tldlsDem( o u4altoiocootlp  auvo;(0srtrir3iydll nlics s a2rrumpnt4optnmfetldls rau s u0trxrxo3ta1opDr i o;t0t2xoir ny4am nmnvil() Draxmont4altoio3taslm2elu pnu4areoxr oadfp   ivi;s) rxoim3iy1lmee fes ( sDrruront4oexo octltfm umnvpnu4 rermr3ootfaDr u s t0t2uo(o3nudomeemies s  2uax pnt1optn oeiyt a2ra(mp ()tltrif3oydfaDe iei;(  eurir oodapt  fct t) rrmur ;o1ale  f3tltlm ul( snt)tetrmrcoo1lmtr n s () rurxm oodomt mncs tf rrrx  nu4tpenmieiysla elnmpnu4treomo tydfpDrln ils  etm(r3oodlltemnct tfaDrmur ot1opxnif3ildls2el( snu0tltoxf iodlaDeaieil(0t2xm(r oo4lm  lfvs s arrm( ono4teto ociatlm2ul( o t0tlxriocia1lpDrlnvs ()s2trxopny4ole lfvils aDua( pnu4oetomf3tas s2eau s;u4 ltrmr tadfmte u sl() 2tmir3iy1lm  mncsl() 2ur(  no0oexn oeiydfm2rauvo (4aetrmf iotlmt ai i s)s2tmxr iodol nmfeiat)aDrrur oo4tltomfetad a rauvp t0 lermf3ty1lm eaivi (0 etr(o3oo1lp  miei tfsDuaxmpnt4tltnmfeiltls ulnmpnu4 ltrmo3ootfaD luvo s s2umio io4amenlfeslsf Dur(mont1oetniictad s ul(vs;(4aeeoifciadlaDr ivo t t2umxopoo1omtelietasf Durxmooo4alx mi3iatla2umnvsnu0trtnxf totlptraiei t srumim oo1ape lies sfsDtmx p;t1tpe  fciyd m2emn snt) rtnxfcia1omt auesl()truo(opnu1oltnmfvtlsfa2rru onu4alenmfciytfsDeau o;t4teeoxf ia1la  lieo t seum(rpno4lp emfeiltf 2tr(r ;o1tetnmietlt aDeau o t0teerio tatfpt aivolt)seum(rpou4op  mfct tf 2trumpnu4oeen oetydfa2uanvo (0areomo tydfatrlies s)srxrxo iydolen ici tfaDtmx ooo0apeoifctytls2ea(mpn(0texoxo3tatlpt lneil(0t2umim3oo4lltnmfcias aDraumpno4tpeoio3tadfs2uln o;t4alxnxr ootlaDe ues;()trtrxr nu1lmtemfeilt a2tr(  ;t1apeomf3tasfsDrlumo;u)alerio ootom rlnvs t0s2xmim ny4am nmnvi s arrmur nu0tet io3ilslm rmu sn(4aetoxr ia1fmDran o s trurxo iy4alee ncta(fsDtaxmp;t0tee mi3iad a2ua( p;t0alxomo3oy1fmDeli slt teur(r iy4openlnci () rtrxr nt1alxoioeiat aDeanms t)texrio oatopDrlnes ()setoxo iu4lme mncsasfs2rr(ronu0aeenifcildlmDulu o u)tlxnmfciy1lmte ivils0srtoxr oo1omtnmivtls artrxrpoo1aleniiciyt m2ranvp;u) rxnxfcoa1lmDe uvsl(0 rxrxrpnodal emfeil(f Drrxm ;t1open ociltfm ulnvp u4alxnmrciy1oa rlu o t s2tmxopio4al   nvs t  rtrx  oo4tptnmoctytfmDum( s;t0aeenif todfptrauvs (0sexr(rpou1ll  lnvils srtmuroou4aetomiciasfa2uauvp t0tetoxr3oytlpteauvolt  rxmio ny4lm n ies tfsDuax oou1alxo o3iatla em( ont4aeeoiocootop rlnvs (0srtrirpoo4lm   iesat  rumurp;u4oltomo3iadls rmnvp (4arxriociy1laDrli o;(0 rxrxr oy4op nmnviasfa2rm(r no1aptnmf3tlsfmDumnmp;u) eeoiocoydoaDr uvols) ruo(m iudape lnvi ()sDurum ot4opx  ociltfs ulumsnt)alxoxf3to1om elieil()s2trxm3oodap emnct s) Dtr(rpno4tex iociydfa2ua( onu0texnxoctatoa  livi s  ruoir oydapt mivs tf 2tru oot0aetnmietadfs2ulu pnt) leoiociadomDr n il(0trxrirpnu4lptnmnes t arurxmpno1aetomi3tadls2ul(vs;()teerircoy1fa elivolt0 etmxmpiu4am elfvilt  rtmx pou1aex mi3iltla2ea(vsnt0tlxrmr3ootlmDeai s ( setrxrpoudllte iet t)aDtrxrpou0tlx mf3iltlaDeanvp;(4tlermr iodfmDeau s s0s2xr(mpno4ape liei ()aDtmx p;t4aptomoctydlmDul(vs (4 rxrifcoy1lmDrlneolt0 rxmir oy1lp nmieiat)sDrmx pnu1tltoioctadlsDrlumo;(0alerxf3iydop  lu o () eumimpoydoptnmncsat)srtr(rpnt4tltnmfciys a rm(mpn(0trtoir3iotfat anei t0 2xrim nudlpt lnct sfaDtrxmpot1optoiicild s2rmnvo u4aetoirctotlm elivi;s s2uriopoodalte fci sfsrtmxmo;u0tltnioetadls2rmnvs (0 lxomf3iytfa   neo;s)srtrim3io1lpee ncsls)a2trumo;o4opxoiociad a2umuvs t0 eenxo3iatoaDrliesl(0 rxmxo oo1llte nctlt  2tauronu1aexn ietys s2eluvo u0tetrxrctytop  lues;t)srurirpou1alte fesatf rtr(mont0oeeomfctytfm el(mon(4texrmr3tytfpDeli o s seuo(rpnudlp nmfvtlt aDtrx  nu1apto oeiatla elu sn(0 rxrxf io1oaD lnes;t  rumim3oy1llee fci s)s2raxmpnu1olto fctas mDrau o t4trtoircoy1lmDr ueolt0srto(mpiydal emnvt t  Dua(mooo0tltnmfcias mDul(vont0tetrio3ia1fmt aieol()trtr(r ny4alenlfcia() rurxm nu0olxn i3tltfsDum(mont4arenifciydom e uvol(0 rumio nydal nmnvi ( sDraxm ;o1olxo o3iatla2emnmonu0 lxrioctatfpDrlnvsl(0 rtoim oo1alte fei tfartax ono0apeoif3iat m2ra(vo;t4 etnif oodfmtr uvolt)trur(r3nudom emieils)aDta( pnt4openio3tyt mDea(vo;u)aeerxr io1optr i s;( trum(m3oy1am  lnei (fsrtau pot4oee  fciys mDeln s;u4tlxrmf oydop  lies t0 exmimpiy1om e fcs t) Dtm(m nt4alxnioeiyt s emuvs;t0 eenxf tadfp r i i t trxmxr3no1ll nmfvia()arumxmpnt1optomictydfm2uaump;(0tlxnxrcoa1fmD anvo t s2tmiopno1ol nlivsls a2umu  ;t0tpxn ieildlaDumumo;t)tltomo3tatlpDrln i;s  eto(mpoydolt micilt s2tax p;o0tpeo f3tatfsDua( s u4 rtnmr3ootfa  luvo t sexo(opoodal e ict sfs2tr(m ou4tpen ocildlmDumnvo;(0 lxoxo oytlmDe nes t0 2xm(r3io4am   nesas)aDua(rpno0tpt iociatfmDrlnmpn()tltnmocoa1oa  ln s t)t2to(r ny4olt lictl()sDrr(moou1aetnif3iydla ra(vo;u0aetomocto1fp  lu ilt trxm(r iudllenmfeilt artaumonu0oet ioeiat a el( sn(4artnxo todoptranvsls s2uoim ou4ole  icsl(fsDum( ono4aex if3iadfmDrmuvs;u) etnxocoadlaDe i o t)t2xrxopnu4am emnvtlt  2tmxmoou0altoiocildls2em( s u0 eeoxfcoytlm   nvs;t0 exoxrpiy4apenlnvta(fsrtrxmono1altoio3iys aDra(mp (0alxnmfctytoat  neo;t)s2tr(o nodll nmneiat)srrr(root0aee ii3iydls emnmo t0 exrxr3totla  aues s  2xrxo oudamenmivs t  2rr(r no4altomi3iyd a2el(vsnu0 lenmocta1lmtr ieo t  etoim3iodol  mici t)aDra(ronu0teto ieild s2eau onu)tltrmf oo1oa rlu ol(0teumir3io4omee ictasfsDtaxront1tlx ii3iytlm2el( p;t4aexrifcoydfmteau i;( tetoxrpiodal nlfcsl()arrmxm ;t1tetn oetat aDelnvo t4aexnxf3todop   nei;(0trtrirpnu1ol emfvta(f rrrxront1oee mfciyt m2ea( p t)artoxo3oydlpt anvs;s0s2urxm nudlleemivs s a2rau  ot4aexoio3tyt s ulumo;t4trenxrciytlmD an i s0setmxrpiudame  ivtlsfa2rmx o;u4aeto ociysfm ulump u)tetoir3io1faDe ues t0t2xoxm3iydape  ivilt aDtmuront1alxnmfeiyt aDea( s t) reoir totlmt  ueil( s2urxm3nodaptnlnctl(  Dtmuront1apt mietat m2rln pnu4 etnxo3tatopD  nvslt0sexoirpnydlle lfvtls artr(m nt1alxoiieiyt a2ea(vpn(4 rtomrcto1laD lnvi;() ruoxm ny1ol nmietls a2ra( pot4olxoif3ildfmDeaumon(0tlenmrctatlpDrauvo;(0t2ur(rpnydoltelies t a2uaxmooo4apeo i3ildfm2ra( p u4alenmo3oy1opD  ivs t)seur(o iudom e ici sfsrua( poo0tlxoiicias a2ea(mo;t0tlxnxociytla rlueo;t srxm(r3iodamen fviat) rtmx p;o1ole ioetlsfsDua(msn(0 lxoxo3iodlm rlueilt0seuoxr3iu4am nmfvilt sDtmum oo0aleoiociys sDeluvp;t4texrmf3oo1la   ies ()t2xmir nydaltelnes t) Durxmono0aeen fciyd a2el(vsnt4tltrir3tadoptr uvo;t0t2xoio3nu4al e fvtat srrrxmpot0tee mietls sDra(vo;u) rtoir3ta1fp  anvo;t0t2xrir oo4lle mici t sDtaxrpnt4tee mociytlm em( ont4 reoxocia1lmDe neils0s2umxmpio4altemneilsfsDum(rooo4oeenii3tad mDumn p u0altoir ia1oa  lieslt)s2xrxr ou4lm elfvta(  2uru  ;o0optomociyt aDuanmsnu)artrxo3iydfp  aues;s)s2xoio nodomtnmiviltfa2tmx poo1alenifctadls2eln p t)tetniocoo1opDe ieo;t)texo(m3oydal  livil(faDrm(mono0tlt  ociydfm uauvs;t0 ltrmociydfaD  n ils)s2xr(r3no4omt livs t)arta( o;t4aet mf3tasfm ranvs (0tlxrmrciytfmteai s s0seuoxo3oydlp nmicta(  2rrxm nu1altomo3iytfs elums u4 rtrmf tytoate uesl(0 rtmxm nudom emfviat aDuaum nt4ape ii3tlsfsDel( o;u)aetnmrctatfa ean s s  ruoiopoydll nmfvtatfaDta(  no0oexnmoeias sDrlumo;u4tetoxr3oytfpteln ol() 2to(o oo1llenlfei t) Dtmxmp;u4teeomfeiytlaDemu s ()tetoif3iytfpDe nvo;t  etrio iu4apenlivs s s2ra(rpou1aetn o3tatlsDelumpn(0teeomrcoo1fmtran slt) rtrimpnydoltnmneil()a2raum ;u1altoii3tas aDrmnvsn()alenir totomt ai sl()s2umim3nudolenmfvil(  Duau  ou1tetn oeiyslm eaump;t4aeeoxr3iadfp ean i;s seum(r oydolt lnviltf Dtax  nu0aexnio3tat aDul( p u0trxrxfctodlmDraivs s  rxoiopiu1ope livsatfartm(ro;o4opx  feilsfs2rlu ont0aexoxo iodfa r ieols)sexr(o oy1am nlfeta(faDtaxmoot1olxnmieiltls uaumo t0 eerxo oy1fatranvsls t2toxo iu4ameelfcsl( a2rmu onu1tpx  fctlt s uanmp;t4 rermfctydlpDrauvi s) 2xmir oydlm elnesas srtaump;t1ope ioeiasla emumo;t4alenircia1lpDeau ols)t2um(o3oydole lfvilt srtrx onu0ope  oetlt mDum(mp;t4 exrio oydopD aneo;( sruoxopiodopenlnes sfarumx  ;t1optomfetld aDemu p;()arxnxo tytfpDe nvo ( srurxmpno4lmeemicia( s2ur(rp;o1oee  iciys s emnvs;t4 ltnmo tadfaDeai o t0sexrir nudoltnmnvt ( sDtmxmpoo1teenmfetyt aDrmums;(0 rxrmo3oo1latraies t)tetmim iudaltnmnciasfsrtmxm ;o0open feiysfa2uauvonu4teenmfcoy1lmteaneols0 euo(o oydll  lnes t  Dtmu o;u1olxnmo3ias s2ea(vs;()altomr iy1lpt  nes;s0 rxrxr nu1op e neslsfsrumxr oo1tpxoif3ias m2ulums;()altnioctodfaDrlivo s)t2xrxm no4lm  mnei s)aDurxrp;o4opxomi3iasfsDul(vpn(0 lxoxf3tatom raieo;()t2urir3ou1opt livslt)aDtau p;u0olxniietld aDel(vp u4aeeoxo oa1om r neolt) euo(o oydape  fctas)srumx ono0oetomf3iys sDul( ont4 etrio oydfate i s s0 exr(opoy1ome lieslsf 2tru poo1tleo ieiydfa2rlump;() exoifcia1lm  lieslt0t2uo(mpio1optelfvtl() Duaxmoou4aee mo3iat mDua(vp () exrxo iotfm eaiei;t0t2triopnu4al nmicsat s2ua(  ;t1alx iieiysla2rau sn(0 lxomfcto1fa  aneo;()sexrirpou1om emfvt s)a2rmx oou0teeo oeiyslm eau pn()areomr3oatoa raieslt0 2xoim3iy1alt mivsls a2tr(mp;t4texoioetlslm2rmuvpn()tlxoif oydomD  n i;t0trto(o iodaptn icsa(fsrraxmp;t1tex mociadfa2emnvp ()altrmr3ootomDr uvo;(0teum(r3oydlmtnlivtl( sDrmxm ou1tptnmoeiltlm2ea(monu4trtrxo io1fa   nes s)srurir3iydlmtnlfeta() 2raxmono0altoif3tltfaDeln pn(0 lerir3iy1op raneo (0truo(rpou4lpeelfvi ( arrrxrp;o0openii3iatfa2emumpnu)tetnifciodoaD  u sl(0teurxmpny1alen fet () rurx p;o0opt ifctad m raump t4aeermr iotop  lnvo s0 2urxmpou1opt  fvtasfaDtax  ot4opt iiciyslm2ulu o;u) ltoxo iy1lp   neolt)trtoxm3nu1apeelictls)aruru p;o4tlen fciadfmDrmu p u0 ltrio3oodom eauvsl( s2xo(o oydalenlivilsfarrmxroou4oltoiocilsfm umnvs;t0teenxr io1lpD  ueo;(  rtmxo3oo1oltn ncsasf ruaurp;t1tlxnio3iytfa2ea(mp;t4artomr3oodfm  aies;t  rumio ou4lm e ies tfarrm(rpoo0aeeo oeiat m2elnvo;(0 lxnio3oytfmD luvi;s texm(o3iodlpenlnet tfa2raumo;u0oetnmfciadlaDean s (4teerir3iadlpDran olt  2tmio3iu1optn nctl(f rur( o;t1olt ifeiasla2rluvont)altnmf3ia1lm rai il()seumiopou1lltnmfci (f Duaxrpnt1alx  o3tls aDulums;(0 leomrctytlatrlivol()t2urxr ny4oltnmnetls) rtm(ro;u1teenifeiytls uanvp (4tetrxfctodoaDeli ol(0s2to(m3oo4lp e icsa() Duaxmooo1teeo f3ias m em( pnt0trtomfcoodfp eaivo;s setm(opiodapen nci (  rtaxrpou1tee mociydlm raums;t) lxomociodoatelnvs;s trumxo nu1olen ncsat sDtmx o;u0opto f3iadlm ulumsnt4trtrio tadla  auvo;(0 rxr(mpio1openmnei sfaDta(r ou4aexomiciadlaDem(vo u4 rtrmo tydlaDelivi (  etmir iy1lpee nvil()aDrru o;t4tptoii3iat a2em(ms t0alxoifcoodlaD li i t  exm(opou4lleemnet ()a2ta(roou1oleoiictytfs ua(vs;t0tltomrcty1fpDeau o s0teum(rpnydlpenmfcilt)sDur( p;t0tltomietatfmDrm(vp;t0aetrmfcta1fmt  u s;(0t2toxmpoudlmtnmnvta(faDum( p;u1oexo i3iatla2uau s;(4arenxociytlmDrai ols0 rtmiopiodlm  mies s)arur(ro;o4olto i3iytla2um(mont4aetrio3tatlp eanes ()trtmimpoy1llt lfctl()artaxmo;o0opxo o3iad mDrau o;u0 lxrmr3todlpDr ieolt) 2xr(mpoo1amee fei ()arrrx pno0ope  ociadfm ranms;u0 lxomr3oydopt auvs;( trxmir3nodllenmnesasfsDua(ro;u0tlxo f3ils aDrlnvo;t0 etnircootoptr nvi;s0t2umxopiydoptnmieiatf rtm(mont1apt  fetyt a2eln o;u0tetnxf iadoptrln i (0s2uo(opoo4ole lfcsls sDtm(mont1oexo o3iytls2uluvo t)aetnirciotopDelies;s srxrxm iu1aptnliesa()arraxr ;u4opxnmoeiad sDran pnt4teeomrciadfmDeaivs;t)teumimpoo1op nmfesls aDrru  nu0tpt ifctyt a2umuvpn()tetrxrcoo1lpDran i;(0 euoio3oy1lltemivtas)a2uau  ;t1altn ieilsfm2ea(vpnu)arenmocio1lmtean i;()t2urim3iu1ape  ivi s)sDta(r ;t4tpxomietadlm2rm( ont0 rxoxocto1fp r ueils)t2xm(opoodamtnlicsas)aDumxrp;u0aleoifciys a2ra(vo;(4arxrmrciydopDr ivslt sexoim ny1lm n ncsa(fsrumxm ;o1olx  i3ils m2uanvp;u4trtomfctodfaDe uvo () etrxm iu1lm   neiatfa2urxm no0tpto oetld a2elnmp ()aetrmo oa1omDe uei;(  rtmxrpio4op  mici t)a2tmum ;u4oetoioeiytls ul( p;()tltnif oadlpte i o () 2trxo nydap  miesl( s2urxront0oeen oeiysla emuvo ()aeeomo3oytlptrlnesl( t2uoxm ny4lmeelivias) rrm(  ;o4apxo ieilt aDea(ms;u)aeeomr3oatfpD  neilt)sruo(r iydolte ietatfaDtrx ooo4oetn i3iasla rl( pnu4texnmociytopDrauvo;s  2xmio iodol  mics () Drm(rp;o1alxomfciaslmDrl(vsnu)tltnircta1fa e ueo;t0t2xoxrpoy1oltemfvt s)s2raxmoou4tpt mo3ils m elnmp u) rtomfcto1lpDeai i;s0 etmirpnu4oltnmivta( sDum(mp;o1tlenii3ias aDrm(mo;t) lxnioctytom raueol()t2xmxmpiudopt  ivtlt artmxm nt1apeoiocild a ulnvonu0 lermf3tatfpteauvslt  etrirpou1op n ieia(fs2um(  ou0tee mfctasfs2umnvo;t)tlxnifcoy1oaDr ivsl(0 etmxr oy4oltnlivsat) Dtm( pou0aptomoeiasfa2eaumo ()aexoxr ia1laD  nvolt texr(rpoo1oleelfvsl(fsrumurpot4tptnmieilt aDuln p;u4aexrir3ta1om   nvsls texmim3ou1ap  mfciasfa2ua(rp;o1texnmoetadlsDrlnvp t0alxnmf oydlaD  neo;t0t2urxmpoy4al  mnciltf rtru  nt4ape  fciasfs2rlu snt0trtnifcoodfaDeln s (  exrxm3oodlpe lfetl(fsrtrxmpot4apt ifciasfs2ulnvp u0 eermr3iadoate iei;t srtm(r3ny4amt lfei (f Draxmp;u0apto o3ilslmDeanvs t0 lxrxo3to1om rlivil(  2ur(o3iudlmeemfvtas)sDum(monu1ope  f3tls m2eauvpn() lxoxr3tytfaDr u sls srtm(m oy4lpe mnvs sf 2ta( p;u0oltn octlslaDel( s (4 rtrxo3todlpt livils truo(o3iydamt  icsls s2trxrono1alxnif3ias a rlu onu4 lerio totoaDe ieolt  2to(o iodol  lnvsltfartmum ;o1tpx  feiad sDrl(mo u) lenmo3oatlmDran s;(  ruo(mpiodopte ici ()sDtrxmoou1tlxomoetytlaDua( snu4areoxf iodoat luvsls)trurimpoudlltnlfcsl(fa2umxm no4aetoif3tytfa2ul(vsn(4teeoxrctodfm eanvi;s s2xrir iudllenmfct t aDuaxrpou4altnio3tydls2rmuvo;u0trerio iodomDe ueo t trto(m nudlltemieilt)sDtaumpnu4aptn oeiltfm2umn snt4altnxf3iydlpt  ivslt0 rxmim3nu4omenmfes s srtaxronu1aex  ocildlaDra( s (0arxrifctadlp elu i;( srum(r no1lpe lfeiat  rurumono4aex mieiadlm2ea( p;(0aeeoircoytlpDeai i s0s2uoxo3nodlle  ici t)srur(ro;o4oetn oeiyt a emumpnu0trerio oadomD  ivsl(  rurim ou1ll e ietlsf 2ua(mo;t4apt ioctytlaDeanmonu0trtrmf iadfaD livs t0teuoirpiodlle mfes t) Drr( pnu1opxomo3iytlm2uanmp t)texnioctodfm e nvs ()trxrirpnydapeelneiasfartm(rooo0aexoiiciltfs2em( s;t)aleomf oytlp e u s;s0s2xrxo ny4am elncta(farrm( pnu0aex iieiydls rlump t) exomr iadla rlnes;t0 euoim3io4opt  nesas  ruax pnt0alx micils aDumu s (0tltnxr3oytlm raieilt) rurxo3iudole liet ()aDtaxronu4olen octatla2rmnvsn(4aetnmf tadfa e n i;( seum(m nu4openmfvias)aDum(rp;u0texnifeiytlm2el(vsnu0tltoxocoadla eln sl()teto(mpiodlme mncsl(fa2uaxr ot4opx  fciatlm uanvonu0tetnio3ta1lmteliesls0 rumimpoodop elfei s s2tau  ;t0oltniiciat a rmnvs (0arerir iotoa  anvs t0srxrxo io4omt  ivil() Dua(r ;t0opxomf3tysfsDumuvo t)teeoiocio1fa eanes () ruoim3iu1ape  netlsfsDra(ro;u4optoifetytfs2rmump;t4aeermfcoo1oatelu o s)trxmiopnu4aptn icta() Drrx onu1alx ifciydfa2eanvpnu)artrxf tatoa e n sls0s2xm(o3io4lp emfvtl()artmx oot4oexnii3iysls ra(ms u)alxnmr oodom   neslt)s2uoim io4apt lncsat)aDtmxroot1tee ii3tydla2ul(vo;t0tlenmoctytlpDe ueo;(0setoxmpiu4apee ivs t)sDraxmpno0tpxnmfeiytls rm(mp t4 eenxr3io1faDeaieol(0trtmxo iudal emici ()arrmu ooo4optn i3iys mDua(vs;t4tlxrxf totlpt livo (0 exr(m iydap  mnesl( a2umxmoot0tlxo ieiatlsDrmnvpnt0 eenxr3tytomtrluvo;s0tetr(m3iu1lmee nvt ( aDuau pnu1opt if3tasls el(vs u0 renxocoy1omDr i i () etr(r iudlle livslsfarumxrono0aee  f3tys m2um( s;(4 exrmo3ootlptraneils0texr(rpiu4opt lfvtl(  rtaxmono1ole ifciad aDuaump;()trerio todlaDrlnei;s0t2xmxr oo4lmtn fvtatf rtr(rpoo1oetnio3ilsla rlu ont) eerxrctadlp e u s t0s2tmxopiy1ap elfcilt  rur(  ;t4teeo fciaslmDul( snt0 exrxf3iotfaDrlueils0 exr(o3iodlptelivia(  Dtaur ot1opeomf3iad a2eaumo;(0tetrif3ootfatrliesl(0 rxrir3iodlme mfeias) rrm(mpnu4tlx  i3tas a2ua(monu)aexrir oytfa ranvols texoxo3iy1amte nctl(f rtm(rooo4oltnif3tytla ra( snt4 exrxr oytlm eluvsls0t2xoio no1ope  fcils) 2tax ono0alenmfeiydfm emump t0arenif3iotoatranvi;t s2xr(m3ou1ome  ivsat)aDumum nu4oetn f3iltfaDranvont)aexrxfctytfpteluvilt srxmimpnudolenmnes sfsDuru o;u1optnifeiytla2el( p ()aetnxr tydlat lu i ( tetrim io1omtn nvsls)arrrumoou1tpxoiiciat sDua(ms u4artrmfcoy1oatr uvi;t) rtm(o3nydop e ivi t)a2umxr no0optomfciat s um( on()artomrcoatlm   nvs s0 rxr(opnodlp nlieta(fs2rr(m ;t0tpe  fciyt s ua(vp;()aeerxo3iotfatrli i;s) rumimpiudom   nesatf Dur( pno1tetn fciat a2raums () rxnir3oodlmtelu i;s) euoio no4om  lfeiat  2trxmo;o1opto o3iyd m em(vpnt)texoif iodfaDe ivil( s2toiopiodop  livi s arta(mo;t0apeomfciadfm2uan snu0 eeoxf iydfmD  u o;t0s2xmxrpnu4lpeelnviat s2rrx  oo0aexn fcilsfsDua(vpnu4 rxoxrciadfp r nvi () eto(m oydoltemfeias)a2uaumo;t1ole mociytls2um( p;t0tlxomr ootfpD aiesl()truo(m3no4opt licsa(f Dumxrono4alxomf3tydfs eauvpnu)arxomf3oa1fp e uvo;t  2umxrpoudap nlnctls aDtmurpoo0alxomf3iasfa2emnvo ()aleomo iatfmDrlues s seurxrpoo4ape mfctasfsDrru pou1aex ifciydfmDemnmp ()tltoif3iadfpteaueo s) rxoxm iy1aleelivilsfarrmx ooo0aptnmf3ild m2elnvsnu4aetnmo3ta1fpDraiesls) rxrirpiu1ap  mfvs () Dumxrp;u4oetoifciyd a elu s;u4aexnmf3oo1lp  ai sl( srurxrpio4omee iciasfsDumu p;u1oeto i3tlt m2eluvpnu)tetrir3iodfa r nvo t) etrir3nu4ale lfci (f rtmum ou0opxomietldla emumon(0 rermr oatopD aueol()t2trxm oudll nmiviltfaruaumpnt1aet  feild sDeln ont)tltrio oytlp e n s;s0t2xr(r oo1ap  lfvilt)aDtaur ;t0alxo ictatlm2um( p;t0tlxrir3oatoa eaueo t seuriopoy4omtnliesas)aDraxmonu4oexnifciyt s2emuvo u)aetnmo3tadfm   i s;t0seum(m nudopeelivtlt a2rau p;u4alxo o3tydfsDumumpnt4 ltrxfcoadfpt  nvil(0s2urxo oo1lmeemnei tfaDuaum ot1tleo fetatla2ra(vp;t0tlerxr3iadfa e nei;t)trtmirpoo4ame  netatfarumu  ot4aet mi3iatfaDuanvon(4tlxrxocoy1fm  livol(0sruoim3ny4omtn ivsat a2urumoot4apto o3tlslsDuln o;(4areoio3to1fm e i ol()truoir3ny1lpte icil(  2tmumo;t1olxo ocils a rlump u)altoifcoo1fpDelu sls0texr(m3nydom nmictatfaDrmurpot1oetnmf3ildfs2ulump u)tlxomo3io1latelnes;(0trtrxr3no4alenmncil(  Draurpot0olxo fetytla2ulu o;u0tlenxrcto1omDeaieslt)srtoir iudlmeelfvtltfarumumo;u0altomociad m eanmpnt4 lxrxrctotfat  ivs t0 rum(m oy4ol nmivs ()sDtaur ;t1alxo ociasfm2rlums u4aexoirciatfmDeau i;t  2uoir nodapte fvia( s2rr(mo;o1apt  iciytfm ul(mo (4 rtoircio1lmte ivo t0texoimpoydal e iet sf Drr(r ;o4apx mf3tatls elnvsn() etnirctodlm  aivi (0s2tmxm io1lpt  nvt sfa2rm(mo;u4tpx mieilsla2rlums;(0 renmf to1lpt au o;s sexo(m ou1apeelicil(faDurxront4alxn ieiytfs umn s u4 lenifcootfaD  u s ( trtoxrpiu4lpt lfeilt) 2um(  ;u4tpenio3iat mDrl(von()trtoxr3io1laDeln i ( s2xo(rpiy1alt  netltf 2urxmp;t4tlx ifeiydfm umuvs (4 exnmrcootla ran ils) 2tmxo3iu1llt lnvsa()s2truroou4olt mo3tyt mDranmo;t0 rxnmo3oadlatelivol(0 eum(mpoodom nlncil( srtmum no0tlenmoctasfsDrmn o u4tltoxocio1om r nvo s0t2uo(m ou1omtnlivsls a2ua(ronu4olen oeiasls ea(ms;(0aeeoxrctatom r i s (  rurim oy1ape  ivt s)arrmxm ou4teenmf3iltfm rln snt0trxrxrcoytop   iesl(0t2um(m3iy4ol n fci (farururonu0opxomf3ilt s eaump;u4tltoxf3tadlat  ies;s)srxm(mpoy4amen nei s a2rr(m oo1altn f3tys aDuanvsn()alxnmf3iytfmtrai s s)t2ur(mpnodal nlictat)s2ur(  ;o1aleomfctasfsDuan pn(4alxoir oo1oateauvols)sexmxm oy4am e ivia( a2taxm oo0tpxo oeiatfs eluvp t4 rxnmocty1faD lu sl()sexmim3nydlpte ieil( aDtrxmpou1tee moeiad s2umu ont0 eeoxfcoy1om r iei;(0 2ur(o io4optnlnvtas a2uaum no4apxniietatfm2el(vs (4texnif3oytfa elieol() rur(o oudape mfeta( aDrmurpnu0opx ifctatls2em( p (4tltnxf3iytlaDe u ilt  exrirpou4lpeemncs sf 2rmurpou0aptnmictyd m2umn o;()alxrio3ty1fmtranei t0trtoio3oydap   ieta() 2umu  ;t1tetniictlt a2rmn pn(0 leomocoytlatelieil()tetoxopiy4lmenmnci t  ruax pno1aeenioctld m uauvo;t) rtnmf3oodlaD luesls0s2xrimpou1amenmfcsa()s2urxmo;o4oexn oeilt m2rmn sn(4 exomf iytlpte n ols0seto(opiu4olee ieil(f Duaxr nu4apto feiaslm rlnvs (4trxnio iadlpD auvo;t)trxr(m io1alt lnesat) rraumo;u0tex if3iasfs2uau on()alxrmf3oatfmtran o;()seurxm oodlm e fciasfarum(r oo0ape if3iaslm emnmsnt)teenxf3ta1opDrlies (0srxrxopoy4lle mfct t arrrum ;o1opeo oeiat m2uaump u0tltoifcia1faDrluvs;(0s2xoxo oodllee fci tfsrum(mpoo0tlen oeiydfs raumsn(4trenxr io1lmDr nes s0t2xrio oudlpt  fvta()arur(mpou4oexo o3ias mDrmuvsnu)alxrmocia1fpDeln s;()t2xm(m3oy1lptnlfciltfaDurumpou0aeeo ociad s2rmnvont0 rtnxr3iatlm  lnvo t)trur(o3nudolee ici t  2rrx p;o1optn fcils s rmumo;(0 exrircoa1lpt  n ols0teuoir3iu4op  lictls arurum ;t4aeeomietydls rlump (4arxoio iydopD li i t  rumim3oy1ll   ivi sf rur(r ;o0tleomf3iasfs eauvp t4 rtomf ty1fa rluei;s trurxr io1om nlfvs s)aDtmu  ;u0olen o3tys a2elnvo;()trtrmocoo1laD liei ( seum(r3iu4llenlncslt)a2ta(  nt1tlxo ieiltfa uanmp;t)areoifcoo1om elu i;s texm(m3oudom nlictl(f rrrumooo1alt ii3tlslaDua(mp;(4teermoctotfmDranvil()seuo(m ny1ol elnvs tfsrtmxmono0oexoii3iadlaDea( p (0teermo3ty1oat livi s)sexrirpno4lm   ivtls sruaxro;o1tlxniociatlsDua( s;t0 leoxrcoatfp   ies;()trtm(r3oudlmtelieias  2uru  ;t0tex  f3tydfm uanvp u)aeerir3totlm eln il(  rxrxm3ou1opte fctl()s2tr( p;o1tlt if3iysla2uauvsnt4tleomr tadlpDelieols0s2urim3oo1opeemfvtls aDumumpno4tpx iieiad aDrl( onu4altomo io1la  luvo t0trumio nydap n ietlt) 2rm(m ;t0aleniociatfaDem(ms t)arxoif3tatoaDeaneils)s2tmxo3iu1opee iviatfsDta(r ou1oet  i3tys mDrl(vsnt)teerifciytomDr ivs t) rtm(r ny1lm emieta( s2trum ot1aee mfciatfs2ul(vont0 eeoif3oodfptrluvils  eumxrpio4omtelnvias arur(moot4aee  oetyd sDemu s;(0 ltoif iadom   i s;t0texr(r nudapee nvtlt a2uaurono4apxomieiat aDuaump ()aetnmf3io1fp   neil(  euoxopno4lmte iviltf Drr(  no4oleoifetldls2eauvp;u0artnir ty1fmtr uesls)t2tmxo3oo4om  lnetlt s2trur ;o0aptnio3tltfaDea(von(0alxomf to1lmtraivolt0texoxo3iydoltnmies (fa2raxmooo4apeomoeiytfa2uluvo u0arenifcoo1oat an i s0 rtoxm3iu1ap nlfeia()aDurxmonu0oee  o3iatfmDea(vs;(0aetomr oa1lp ran i ( s2uoxopiu4lltnmfet sfsDumx p;u4aeeo ictlsfa2ranvs (4tetoif tadfaDrlneo s  2tr(o nudam  mncia(f Drmuro;o1aeto i3tls mDrm( pnt0trtnifciodfptelivol( s2xr(o iu1lme mfeil()arurur ;t0tlxnifciydlsDean s t)alxnmf3iytfaD au sl( s2tm(o3iu4olee fct tfaDrrx  nu1aexomfcilt aDra(ms;t4alxrir3tytop   uvils)tetr(o3oo4ome miesltfsDrm( pnu0tlxniieilt m em(vs u0teenxf3iatomDr i i s)teuoxm3nudap n ieta(faDrm(r no4tptomfcildlm ranms t0 eeoxr ta1lp rlivo ()truriopoudom emfcs () Dumxmo;u0aeen fctyt m umuvp;u0 rxrmfcia1lmD anes s)srum(r3iu4omee ies s  rtmu pno0apxnif3iysfsDumuvp;u4teermr3iytlatr nvi;s)seum(mpiu4aptn fvi ()s2rrumoot0oex ifeilsfmDelnvp;t0trenxf oatfa r neo;s  rxm(opiu4ole lfvs ()aDtrxr oo1alto iciyd m2ra(vo;(4 ltnif3oodfmt lneils) 2umim3no4lm emncs t)arta(ronu0ale  fctat s eauvs;u0 rxnxf3oo1laD  ivolt)t2ur(opoy4ll  mici (faDuauro;u4texniiciadlmDra( p;u)altnmf tadoat lnes;t) rtrxr3nodlm  lfvtasfartr( pnt0tee mo3tls s2eaumsnt4arenir3iytfatr n o;(0truoxrpnodole  fei (fsrtaum no1aptniieiys m uauvs (4texoiocoo1lm   i o;t trtmiopiy4aptelfetat)sDuaurp;t4alxnmfetldla2ranms;(4 rxoif3oo1fp eauei s)setoimpoodllt lfvi (fsDuru ont1ope iictldlsDrluvp (4 rtomr3to1lp r i slt)t2toirpny4lm  mnvtas a2tr(rp;t1alenii3iyd m2rm(ms t)alxriocoa1fm r nvils0 rtrxo iu1alenmncia()srrrurpnt0tpe moeilsfsDra(mon(0trtnmfctadlptrlieols)truoxm io1ame lnei t)s2truro;o1opxomicias a rm(vs;(4tlxomo oodopDrlieo;(0t2xr(o nydopeelnvsas)s2uaxmp;u0alxomfciydlm ulumo (0aetnmocia1oaD  uvo;s teuoimpou4apenmieslt)srtauro;o4aetnmf3iysfa2eluvp;()tleomrctadfa  lnvi;s) rxoxm3oy1altnmivtat) 2rrxro;t0tetomieiad s eau o;(0 lxnxfciytomtrau i;s  rxr(o3ny4al  lncs t aDrmumono1tpx  i3tytfa2umnvo (4texoifciotfm rlnes s)sexoxm oudaltn fctas srrmumoou0tpenmf3iyd m2elump u4 exnxo3totlm rlivs;(0 rur(rpnodlm nlicsls srururp;u0oltomfctls a ra( o t4teermr3iadlm rlieo t)t2tmiopio4apt lici s)s2uau pnt1tlx mfcildfsDelumo;(0trtrmr3oo1oa   ivs t0seuoxmpno4ll n ietlt)sDur(mpoo4tlxnmi3tldlsDemnmpn(0aetnxr3totfpDraivs;t tetmxo3oo1oltnlnetatf 2um( p;o0oeeoif3iasfmDumumo;(4teenm
\ No newline at end of file
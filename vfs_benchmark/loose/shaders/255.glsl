@@ -0,0 +1 @@
+ueo (0texo(r oo1ol   nctl()arua(  no4tleo oeiadlsDuau p;t4altoxr oodla  luesl() 2umxm3no4am n nciltfarua(roou0aet iietytfm rl(mp;(4tltrirctydoa rlnei (  2xoxmpnodole mfvsatfsrtaxront4alxnioetad aDum(vpnu4 ltrmrctotlat lnvil( trtr(opoydamtnmfesl(  rururo;o1apx mieiatlsDeauvon()texrmr tydop  aneils tetmiopnu4lm  mfcsls a2taxr ;t1optoii3tyd mDuanvs;u4 ltrmf3oadfp elivolt sexoim3io4om emfeias  Duaurpnt0opt ioeiat a2ran p;(0arermr iy1fpDrli o ( t2xriopoudaleemnes () Dta( pno4tpenmicilt sDeau pnt4teenmocty1om eanei t truoimpiodolt  fes (  2raxrp;u4tlx  ictlslm ulnmont0arxnmo iodfmDe uvilt0setmio3iu4op e ictat  rtmxro;t1ope ioeiytfsDumu o u4trxoir iotfatelu olt)srurirpoudomenmnesa() Draxrpnu0tlto fetatfa uanmon(0aeenio iodom eanvo s teur(opiy1om emicta()a2urumoou4tpt iociysla2rlumo;u) rxnxrcoydoa rlu i;t  rtoxopoudaptnlncils) 2um(ro;t1tpx iiciltfs uluvpnu4altrif ootomDeau ols0 2xoim3oy1omtnmivs (  Dum( onu1apeomf3iys aDra(mp;t)tlxoio3iytom rln s s0 2trirpoy4omt lfctl()a2ur(rpno4aexo iciytla2elump;t4aetoxo iytomD au i s  rtoxm oodopenlictat) rurxr nt4tpe  fciatfs2rlnms ()tlenmf totfpt anei;t) rxrxm3nudlp emivilt s2rru ooo0ape micildfa2em(vs t0aeeniocty1fa elueo;s) 2uoir3oo1amen iciatfarurxro;t0aex ifcilsls2um(mpnt0texrifcoo1lpDr uvo;t s2xrim3nudapte feia( sDtmxr nt1apxoiieiydfs el(vpnu) exnxocoo1lmtrlueils0s2tmim3iudolt  nvsatfaDtr(rpou4olto fctat m ulu ont0teeoio ia1fa eanes s s2urimpiu1ameelnvt tfaDtaum ;u1apto ociys a2eauvp (4aexrmr3iodlm  luvilt teur(m3ny1amtnmnviasfarrrumpnt0tltnio3ildls2em(vo (4teeoxo3oydopt aivo;s0s2urxo3ny4al nmici (farur(rpno0aee  oeias sDeauvo t) etrmfcoy1opD luvi;() 2tm(mpno1ameemici (f Drrx  nu1tetomoctasfm uluvp u4tltrio3iydfm elu o () 2tmim io4ap elfctat)s2rrx ono4tptomfeias s um( on() rxnmocoo1fa elivo;s sexmio oy4amenlncsa()a2ur(m ;o4optnmietytfmDrm( p;u4aetoxf3iatomDe uei;s trtoxo3oudlm n ict t sDrmu p;o0tetomfciat mDel(vo u0tlxnio3oy1lmteaieil(0 rurirpnu4lpen nvtl()srrmu oot1olto i3ilsfsDua(vpnu4artoxrcoadoptelies;(  2urir nydaleelnetls srumxm oo0aleomoeiyd sDrluvsnt0aetnxfcio1oat au o;s0 2uoxm nu4ap nlfvtas s2trumpnu1aexoiicildfm2ean p;(4 rxnxocoo1omteluei;(0srxmxm nudlle  nei t s2um(r ;o1tptn feilt m2uln o t0 rxrir3to1lmte ues;t0trur(o nu1amt miesasf rua(  ;o4alen ieils s ea( o;t) lxnif3tadlpDeanvils) 2xo(o io4ol e fviat  rumxmonu1tleo iciytfaDrauvpnu)tetrmrcootlpD ln o;(0teumxo3iu4amenlieilt) Dtaxr ot4altomoetadfaDulnmpnt0artoif oa1lptelu s;t trtr(rpiudomt  fcslt aDua(mpnu0openmi3iyt aDemu pn(0 eerxf oadoateau i;s seur(rpou4amtnmncsl(farrm(rpnu0apx mo3tys m umums u) lenmrctotfp elnvo;t)s2xoim3nu1ll   icil()arum( poo4oeenio3iydla emums t)aeeoio3ty1lp r uvils0sexr(m3iodllee ivs s) rurx  ;u0tlenmiciydfm ul(msn(0texnifcio1fpt aiei;t0s2xm(o ny4ol elfvs (f 2tmx  ;o0opx mfciasfm eanms u4treomf3oadfmteaueo;t0tetmxmpiy4alt mncs sf rrax pou0olxo f3iatfa2el(mo (4 exnio3ta1opt  ieo ( trur(mpoo1altn ici t artrxrp;o0aleo fciyd a umnvs (0 rxnif3iydfm   uvo s0 etrxm3iy1lpe  ics t s2rr(m ou1tpt  o3tldfm rau s t)aeenmo oy1lm e ivi;() exm(o nodop nmict tfa2tmu oot4alenmfciyslm2elnmp;u4 renmo iy1oaDeluvslt) 2to(r3oydam nmfvtas sDrmxmpou1aexn oeias aDrmumo u)trtoifcoydlp eaues (0srxr(r iudaptemies s  ruru pot0oeeniociydfm eanmp;u)trtrxr3iydfaDe ieo (  eurirpiy1lp   nesat) Dua(m ;t0tptnmfeiydlm2uanvs u0 leoiociotop rlies t trto(m iudlmee ivsls  2ra(  ot4tpxn fetldfaDeanvont)tetrio3iytlp rli i t0trumxopno4aptemivsls  2rm(m ;t0alt moeildls2rlu o u) rxomrcty1oateli o t0 2xmxr3iodoptnmivslsf Dtrxmpnu0tex mietatla2emn snu) rxnir iodla elnes;t0 rxoir3iodoptn neils)s2ua(r nt4aexnmictltlsDrmnmsnu)altnir iatfm rln il() euoio oo1lpe livsa()s2rrurp;o4altnifetatfs rluvs () lxrifctodlaDrlu s;s0sexmxr ny1op   nes sfarta(monu4oleomoeild a2eluvpn(0arxnmo3iotfaDeaneilt tetr(rpoo4lp nlfvt s)a2tr(m ;u4tptnmoeiat mDel( o u)tlxoxf oo1oa eli s ()tetmxo3oodole lfctlsfsrtrurono0oltomictltls2um(vs t)alxrifciytlptelivils0 eumir3nodlmee neta(faruaxmp;u1oeeoio3tltla2emuvp u)alenmociodoat  ueo;(0seto(o3ou4om elivsasf rraxmpno4teeoioeiltfaDrmums;(0tlxnif oo1lmt ai o;s)teuoxo iy4omee fvt t  Dtm(  ;u1alxomfctydlmDraums;t4trtoif3oydfp  aivilt0truoim3oudamtnlfcsas  rtr( pno1altnio3tltlmDean o t4 etnxr3ta1oateauvs;()s2xo(mpiodoptnmfvil(  Dtm(rpot4altnioctat s2ul(mpn(4artrif oy1om rlu ol(0seuo(m3nudlm n ieias aDtr(roou0tetnmieiyt s eanmsn(4 eeomfcio1lpDeai s;t  rumir ou1om e net s)sDtmu  no0aet  feiatfs2emu snu4 etoxo oytfm e u o t0 exm(r3oodomeelivsls)aDraxrpnu0aee moetlsfaDelu snu4treoxr3oo1lm eluvo;()trtrxr no1ope micta()aDtmum ou4oexomfeiatls umu p;(4trenxf tytoat aivsls srxoxopoy4al   nvtl( a2taurp;t4tle  ietad s2uan s;(0altnxr3ty1optelieols seuo(m iudap nlnci tf 2rr(rpou1alxniieiytlmDrl(vp u4texrmociodop r n i;t srtmxopoo4lmee nct sf 2uaxrpoo1ale mf3taslsDrmump u) lxnir ta1omDr uvi;t  exo(r iy4olt  nct s sDra(ront4altnmf3tyt aDrm(mo t)trtomf iotoa eaivs ()trtoimpiudap e fvtasfsrtrxr ou1oltomicildla umn onu0 rerxf3tatom eln i;t0 etrir ny4opeelics () Dum(ronu1optomoeildls ea(mpn(4tltnioctatla  livo;s)t2umiopoo4op elnvi sf rra( poo4optn fctldfm2rmumo t0 rxrxr3iodla elivi;( trtrxo ny4olee fvsas)sDumxmoou4opxomieiys m2uluvo (0aeeoxr3ty1fa  au slt0 rurim nydome  ictlsfsrumur oo4alxn o3iatlm2ua( o;u4alxnxo3oydfptean o s) etoir io1lme  icias)artmum ;u1tlx  i3iydfs2ua( pnt0aeenmfciydla eanei;s)srtmxr iy4ap emfvtat  rrmxmont4apx iieiatfmDuln o u4tltrxfcoa1fa raivo t0sexoir io4llt mnvsas) 2rm(  nt1aetnmoeildlm2rau p (4altoxf tatlmt lu sls)trxo(m3no1alee nvsa()sDtaxmont4tpxo f3tysla2rl(vp;()tlxomf tatomDrln o s0truoxmpiydoleemnet t) ruaum nt1opeomf3tld s2ulu p u4 lxnirctadlptr ueols)trurxo oydame licsat)sDur(rpno0tlt  fciys aDeauvo t0tlxrxo3oo1omDrluvs s0 etmxm ny4op  mfcsas)s2tru oou1aetoio3iyt a2umn o t0arxrmo3iy1optelivi s trxmxo nu1al elfes t  Dta( pno0opx  f3iasls ean ont)trerif3ty1lpD auvs (  exoir ny1ome  ietat)s2raxrpot1oet mietadls ean s (4altnmr io1lmte ivols sexm(r oo4lle lfvta( s2taum nu0aet ii3tydlsDrm( p;(0tetomr3iadfaDrlneolt)sruoxo3oy4op e fetls aDtm(r ;o0texo oeildfs2ranvo;u4alenmr ty1omD  n ilt0 2uoirpiy1lmte neia(f Dta(r oo4tpxomoetas mDeluvsn(4teenmrcoa1fa  anei s) etrxopou4opt livi ()arrr( oot1oleo ociat a2uaumpnt4altrxfciatop   n ilt0srtrxm ny1olt lnvslsfa2raumpot1oltoif3tldlmDumnvo u0texrio ty1fpDeln olt  rtoir3iu1lm  mnct (fs2urxrono4oexoioetadls2rlumon(0altnif3oa1om  luei;s setmxr3iodop elfcilsf 2rmx p;t1opto oeiytlaDem( o (4 exomo3ty1oateaneo;t s2xoxm oo1al n ncsa(fsDrr(mo;o0tpt  f3tatlmDelnvp u4 rerio tadom rlueslt  exoir3ny1amtemfctat)sDtax  nu4aeeoioeiys mDeluvp;t4areoiocootlm rai o (0setmir oo4lm   ici (fartr(  nt0teen feiadlaDel( on(4 rxniociodfmtranes s s2tmxo iu1al n icilt arumx  ot4teeo fctys a2eaumpnu) exnxr ia1lpDran ol()t2um(r3iy1alt mnvt (  Drau oot4tle mfeilsla2um(mp t0arermr iatop  anvol( seuriopiy1ll emivt (  Dta(m ;o4apxomoctatfs ra(vp t)arxrmrcoatfpDr uvs;s0srxr(mpiydomt  fvt ()srtr(mono1aeeomocilt m ua(mp (0alxoxo ootlpDr ueo;s0srtmxr3ou4ap  livs tfsDtrxr ot4aetoiieiydfaDrl(vsn()altrmr iytoptean i (0s2toxopou4ol nmfvi s) 2rrxr ;o1aeenmfeiadls el(mo;() rtomf oytlpteaneolt0 ruoim3iu4alt mnetat aDum(  oo0apx mieiyd aDua(vo;u4texrif3oo1oaDrau o t0 2xrim3iudal emnciasfsDtrx p;t4oetn f3iadfaDrm(vo;(0texnio3ia1oa ean o;t)trtoxmpoo4lltemict ( artr( o;t0apxnmf3ias m2em(ms ()artrio iatfmD anvilt0t2tr(rpnu4ol n icsa(f 2rmumpoo0aet  iciyt sDea(mpn(0 ltoio io1la elnvs;t  rurimpno1lp eliciltfs2raumono4aetn oeildlm eau s;() rxnio oydom   ivo;t) eurio oydllte fvsas)s2trumoou1opxn feiydlaDel( p;t0tetnir3oo1faDr u s;t  rtmxrpou4ll  lictl(fsruaxr ;t1tetnifetat a2em(vp t4altrmfcia1latrln ol(  rxmxopny1llen ies s  Dtm(r nt4tlt iietat s uau pnu4 lxrxo oo1lpDrli olt)sexmiopoo1oleemict t)a2ur(r nt0opt  fctatlsDuaump;()tltoif3tytla   iei s) exrimpoydolt lfvia()arrmumpnt1olto ietysls2ra(vs;u) exoio iydfateanvs (0s2um(o oydlpeemfes sfs2rm(mp;t1oetnmo3ias m eanmp u)tetnxr iytlpDrlueo t)t2tmir nydopt  fciatf rtrx pot0alxnmo3tydls rm(vo () rxrmfcoa1fatelueols0 rum(opoodalte nvi t)a2tmurp;o4tet if3tydfm rlnmonu) etoioctytlmD aieo;s)setoxrpiy1opee nvi s)sDurum ;u4ape iietlsfm emnmsnu)arxnmrcoodfptr i s;t0t2umxopou1ll  mfviatfs2rmurpnt0alx ifetydfm uluvp;t)trtrxo todlm rlivils texrxr iy4amtelivt t)arraum no1alxnmoetytlsDem(vo;t4 exrmr oatfaDrluesl(0 2toim oodol   nvtl(  rrmu  nt0tpxniiciasfm2emnmo u0altrif tadfmD an s;t0 ruoxr3iy1ope livi sf 2rrx pno4oeeoifciasfm eanvsnu)tlxomf3tydoaDeli slt0t2umxo3ou4lptemfvsl( arumx p;t0apxnmoeiydlaDulu s (4aeenmrcty1la  aivilt0 rum(r nu4lleemfvta( a2rrum nt0altnmf3iatls2rln p;t4 ltoxr3io1laDrlnes s)texmxm ou4apt  neiltf 2rm(root4aeenmoeiyslm2ul( snt)arxomfctadfaDr uvsls s2uoim oy1olenmfeiasfsDtr(rpnu4tptnmfctysfsDua(msn(4 lenxocio1faDr i s s0 etm(mpiudoltn fetl( s2rau pnu1tlxoif3tltla uluvs;(0 rxnir tydfpDraiei s  exrir oodam nlnctl() rtaum ou0alxnii3iyd a uan o;u4 renir3tydfmDeaivi;(0t2uo(r3iu4optnlivt ( arrr(mooo1ale io3tat mDum(ms;(0tlermocta1lpDr ieols0s2tmxr3iy1lptn ivta()a2tm(m ou1oeeo fciadla2rm( s (0 reoif totomt aivslt)teurir oydlmte ies t  Dra( o;o1aeeomieiadfa2uaumont0aleomrciadlmD aivi;s s2xoim3iu1omtn net sf 2uaur no0oetnmfciasfmDrlumsnt4alxomo ty1lp eanei;( sexrxr nodlpt mncsatfartaurooo0aexnmociasls2um( s t4aexrmf ty1lmtelivil()teumir nu1lp e fes ( a2ur(ront0ole  oeiytfsDranmo u) ltomf iy1lpDrlues;t0s2toimpoudll emivslt)sDtm(m ;o4tpxnifeiasfs2raums;u4 etrxf iytoat auvsl(  2toxr oy1ome livsl(faDtmum ;t1apxomociys s emumsnt0 lerxf ty1laD  uei t)s2xr(m ny1lm n nvtas) 2umxm ;t4alto ieild a2eln pnt)teenmo3ty1latelnvsls0srur(o3nu1omtnlfcs ()arrax oou1aeeomfetysla2umnvp;t0 rtomfciatoaDrlivi;s)sruoxr iydalt licsasf Drm(mp;u4texn i3iytfm2rmnmsnt)alxomr3oadfmDranvs;t0teum(r3oydopee fcil( sDrmumo;o0oeenmi3iys a eln pnu)arxrmf todla rau ilt)t2xo(r iodale liet (  2ua(ro;o0oet  feildlmDra(ms;t0aetrxo tytfa r i i t seur(m io1aptnmivs sfarrr(mp;o4tpeoioetlt aDrmu snu0treomfctotoa  an s (0s2xo(mpiodolee fvsatfsrrrxr no4aetomo3iltls2ea( o (0aexrxrciytlatr nvi;s srto(m3iy4lpen fesat)a2tmxront0aexo ictltlmDelums;u0aeermf3oa1la r ieo;t)s2xmxo iy1altnmfctasfsDuauro;u1tlto i3ilt mDua( o;u4aexoio iatlptrlnes t)srto(mpno1al nlfcsa( artm(mpoo0tlxnmi3iytlaDelu o u) leoif3iodop rlieo t)texrio nu4lmeelfesasfsrrru ono4opeomiciad aDuln on(0 eermf3ootlptrau s s0t2uoio3nu4lle lfesas)a2umx pno1tleoif3taslm ra(vp u4treoxo tydfa  lnvi;s  rurir nu1oltnmici sfsDuaurp;u0tee  f3iadfs rm(vo;u4 renir iydlpDr nvol(  rxo(opno1lltn icia( sDrr(m nu0alxn iciatlmDrau p (0 exnxf3todfaDr i ols) eumim3iydlpeemnci sfsDtaxmono0olxomfcilt m2ranvo t)tlxrmf3tydfmD  n sls trtmim no1omenmfet ()a2rmumo;t4opeo ociad s2el( s;() exoxrcty1oaDrli sls)tetr(r iu1lme  fetat)aruaxmpnu4aee mfciydfsDelnms (4aetoio oa1fpt lies;t seumio3oy1omtnlicil( arua(rpou0oeeo oetadlaDrmnms;t0 rtnmrcta1lmDrlnvolt srxr(rpoy4lp nmict t) 2taxmooo1aleo i3iltla2rm(mp;u4trxoio oy1faDrai i;s)sexmxr iy1lmtn ietlt)s2urxm nt4tetoioeias a2ua( p u0 lerxf3totfaD lies s tetm(rpiudapt  fvtas sDtmxrpoo0tltomoeildlsDran o;(4tetomoctotomtr i o;t0s2tmim3iodolen ieslt) Dtaumonu4aee mociys m ranmo t4texoif3iytlpDeli o;s t2xmim3iy1omtn feiat a2ta(m ;u1apx ifeiatfm2rln pnt4aetnxfctydoaDelneilt  rxrio nydlmenlfcs s)a2umuroou4oexn f3ildla2elnmo () eenmrcoatfmtr nesl(0texo(m iu1alen fci s srtaxr ;t4apxnmi3ilt a2em( ont) rxnmo3todfm eaieols0 ruoxmpnudoltelnvil()sDumxr ou4oex  o3tyd s2umnvs;u4artnxo3oodomDraneo;s  2tmim ny4am elfvtatfaDta(moot1tpx micilsls emn sn(0 exoxr3ia1omDelues t0texmirpio4opee feia(f Drr(  ot4openii3ilsfs rl( pnt)tlxrmfcoy1oatrln ils0trum(mpno1alte fct tfsDuaumo;o1oex moeiltfsDum(vs;(0teeoir3iytfa e ivolt  rxrxm ny1omt lnvt ()arurxmooo1tex mo3tldlm umn p;(4 ltoir oa1oate u s;t)t2tm(rpnu1ol   fvsa()aDrmu ooo4ope  ieiad s ul(vo;t)aeenmr totfa ranvo s  rtmimpnu1apt mfctlt)srtmxrp;o1olto ictlsls uln s ()artnmo3to1fat lu o;(  rxoxrpoy1oltemfvtlt)a2rrxmpoo1aex mo3ilsls2ua( ont4trxoxf3oodopD an il(0trxmxmpou1lltemnvtas aDumu oou0tlenmf3tydfa2ranvs;t0 rxoxo3oy1fatr uesls0 2toxm oudaptn fvsls s2uau pno0oleoifetytlm2rmu onu0alenifciydopD ln s s s2toir3ny4opt lnetl(fsrtr( pot1tet  i3ilt m2emuvp;u4aeeoif3oa1lmDeliei;( trxrxm nydalen ivsas srtm( o;u4tpen f3ildla ean s;u) rerir3iydfpt aies t  2xmirpiudlpee neilt) Dtr(mp;u1oltoio3iltls2em(ms;(4tltrxfciy1fptr ueolt seumimpio4ome lneslt sDtmxmo;u4openii3tysfm2ulnms;(0trtrxf3iadlatr n o ( tetm(mpiu1apen fei t)s2taxmpoo1oeeomoeiasfs2ulnmp (0altoxfcoatlptr nvo;(0 etmxo3oodlleemici s)aruax  nu4oeen f3tyt sDumums;u)tltrir3oytfpt ai i t  2tm(o ny1amtnlics s)srrru ooo0oet  ietldfa2rln ont)tetoir iytlpt  iei s t2to(m oo1omenmieils  ruau pou0openii3tltla2uaump;t)alxomo3oo1la elieilt  rtmio iy4lmenmnei t arrrurpot4texo fcildfs2ra(mpnt4alenxocio1lp  au sl(0 eurir3ny1al emncs tfsDurxmont0tpto f3iad sDelumo (4 exomr3io1lpt li i;s0s2urio3iu4lle lfvtat arraurpno1olt mf3iyslm umu pnt0tlenmr oydlmDeli sl()t2xr(r3no4lpee fes (fsDraur ot0opt if3ilslaDranvs;t)altomr3iy1fa eai o t texmxm iydamenlnvtas)sDuauro;u4apen iciadfa2um( o t)aeenir3oadlaDr ieilt  exmio3iy1alenmivsa(faDta(rp;u0tltn fciatls2elnvp;t4altnxf oytoptelu o t) 2tm(opoodapt licsl(fsrrr(rp;t4alxo i3ilsls2ua(von(0 rxoif3iadoa rluei ()tetr(mpno1al emics s  Durx ono4apxomicilsfa umumo ()artnio io1fmDr n i s0s2tm(r oudalt lfeiasfarrm(moot1aptomociltfa2umu ont)tltnxrctodfm   ivi ()tetoirpoydalte ietat a2ta(moou1aptomi3ildfmDean o u)tetrio3oo1laDr ivsl()t2trxm3nu1aptnmnciltfaDrax o;u0optomfeildfm2rl(vs (4arenmo3tydfaDran o;(0trxo(opoo1amtemivilsf 2urx oou4apeomo3iydfmDranvpnu)teeoxr oa1fmtranei t0t2umimpoy1lp e fcsl() 2tauro;u4oeeomictas a2ulnvo;u)tlenmf oatfp   n o t)tetmim nodaptemiei t)sDta(  ;u1aet  fciyslm uau o;u4teeoxr ia1op   n o;t) euo(r ou1ole  nvi t  Dtrurpnu1aet ioetadfsDrl( snt4aeerxf3oa1lat au o () 2xo(m3no4ale mfeias  rrmumono0olxniociyt aDean s;u)arxnxocio1oa e ueo;t)tetoir3iy1llt  icilt  Drmx  ou0openmf3ildfm2rluvon()arxrxr todopD lneol( trtmxo3io4amte nctl() rrmuroot4tex ifetld s2rm(mo;u4arxnio3ty1omD aieo t  exm(m3ou1ape  fvs s a2raxmpno0apxnmoeiasls2rmnmpnu)teeoxr oy1opD anvi;t0truo(o3nodol eliviltfarrm(  nu0ole  o3iatlaDea(ms t)aleomrcoy1oatraneo;t)s2um(mpoy1aleelivt (  Duau p;u0apxnio3iatls2umu s;t)aexomoctydfaDeau s s)s2uoxopnu4llt lieiat arur( pot4oee  ictltls2rlumo u0arenmo iadfptrauesls srxrxr3nodal nmicsl( s2umu  ;t1alen icild sDem(vs t0treoxo3oytlpD  uvslt) exriopou4lpee icilt  2rrx oou4oleomoctas m umnvp;u0texoxo ty1lm r i i;s) 2xrxopnudop   nctas  Dtrxm no1tpxoio3iltfs emu p;t4aetnmocoadlpDr uvsl(  rtmir ny4lm e fcsa(f rtr( oou4ape ifcilsfmDum(vs (0arxnio oatfp ranvi;t srxm(m iodom  licias  rurxrpou1opeomocild sDrlu pnu0aeerif3oydlm r n i ()trxrir oy4al emnvtlt)aDrmxmpnu1oexnmfeiaslmDrlnmo;(0treoxf tytom eaneilt  exrirpoo4op  lnvtls)srumumoot1oetoif3iasfaDrmuvo;u)aexomfciadoaD aieil(0 rxrirpny4llen ncsl(fartm(m no4alx mf3iytla2ul(vsnt4 ltoio iadoat lnei;s)trtrxmpou4openmfcilt) Dtmu pno0tet io3iysla2um( pn(0arxrirciadfpDrlnei;(  eurxr3nodol   fcsat)artrx poo1alx  ociatfs2uaumo u0trtrxf3oatfm eaiei;()srxmxopoo4opeemiesat a2rmxr nu1oltnmf3ilsls uanms;t0altomfctadoptranvi (0 etoxmpoydapeemietat)s2umxmpot0tpt ifciydfaDelu p;u)tetnmrcia1faD auvs;t0 2umir3oo1olt lfcta(fsrum( pot4ape iieilsfm2umnmo;() ltrircoydomDe i i t0 exoxr3oo1omtelfci s srraxm ou1alto ictydls2uan s (0arxnmr3to1fmDrlivs s t2trxopoy4llee netlt)s2trurp;t4ale iieiydlsDrauvs;u4 eenxrcia1fmD lnvol(  2xm(mpoo4olen ivsltf rrax  nu4apto o3iytlsDulumsn()alxomo3oodop   ivo;t0 exmxm3no4amtemnvt s  Dur(moou0tlxoiociatfa rm(vsnu4tltoif3ia1om   i slt)t2xoio iodalt mics t)aDurump;u4oet  ictasls elnmp t)trtoxf iodlpt  uvo;(  ruoio3iy4om n net t) 2raumont1tpeomiciadlm2umnvo;u4alenif3iy1lmt aivs ()srxrxr3iydopt lnctls s2ta( p;o4ape mi3ild m uan p;u)aexnif3oatop rai ols  etm(o oy1am elieiatf 2rm(m no4teeoiictat mDua(vp () exnio3totfpD  neslt teto(r3ny4apen feia() Dtmurpou1oet ifcilt mDemn o;()trtnmo oy1fpDrlnvo;() eurim3iu1lme  iesatfaDrruroot1tlxomieilsls el(mo;(4tetnmf3iadfp eliei;s trxr(o io1oleelfvt s s2ur( onu1alxo iciatfmDulnvont) lenxr3oo1fa eauei;(0 rxrim3iudapeemncia(faDuax  ou0aet ii3ildla2ranms;t0arerir3io1op eaneil( s2ur(o3iu1am nmfci t)a2uax ont4olto feiydfs uanvpnu0alxoif3iotfatr nvsl() rxrim no4lmee fvil(fsrtmurpoo0tpxnifciysfa eanmo u)aleomr oatlaDe neils0 ruoxo iu4lp nmnvsl()aDua( poo1apenmoctltla2rl( on(0trtrifcoatop r ieolt) exo(r iu4altn fcslt artr(m nt1tlxoio3tytla2rmuvp;t)aeenmr tydfa eli ils) rtr(rpoo4ll  mneta(farrmuroot0aptomicild a rau snt0aetoir3totlmteau slt) rtrxm3iu4lpe  ncta(f rurxrp;u4oex ifetys mDulnvp u0trtnxr iodfp rlueo;t0s2xr(m no4am elfvs sfa2rrxrono1aptnioetydls2rm(vo (0tltnmr ootfat au s s0seumim3ny1oltelicil() 2um(mpot0tetn fciyd sDum( p;t)tlxnxf3ty1lmD lu i (0 eumio nu4lm nlicsa(f ruaxm oo0optnioetasfa2ul(vpnt0teermfciotfaDr ies;(  rtr(opou1ll  lnvs ()arrmx  ;t0oee ifctaslm2umump;u) ltrxr tydlp   i i t0 2toxm nudaptemivias  2ua(mpou1olxnmfeiytla eau p u0 rxrif3iadomte i olt0 2xmim iu1lm nlivtlsf rumx  ;u1tpe  o3tad sDemuvs;(4 lxrxr3oo1op rln s s0t2trio3iy1omtelnct (f rur(rpnt1apxn o3iad a ulumont4tetnmo3tadlp eli slt srurxrpny4ole  iviatfsrtr( ooo0tlxomoeilt m uau s ()alxrmo io1laD  u slt  2triopio1lmenmivil()aDrmurpou4ale mfciltlmDuln ont)trxnmocto1optr uvi;s)trur(m3io1apt  fetl(farrr(mo;u1oetoiocild sDemu snt) rermfcia1omD aies t)t2tmiopoodopte fct (f rtmu ooo4tptn ietltls umn ont)teerifctadom   n ilt s2xrxr nodllee ncsltfaDtrxm ot1teeomieiadfm2umuvs;u0trtnxf ootlptelivi s t2to(rpoy4lleelnetls) 2tr(mpou1tle mocilt a eanvp;u4aeenmf3ootlmte i s;t)s2urir3ou4al nmfvsat)sruaumpot4oeeoioctasfmDelu s;u4arermocia1lm rliesl( s2xo(m oo1ameemnvi tfs2rm(mo;u1tpxoiiciydlmDuau o;t)tltoxo3iotfp eaivols  eurxopiy1om nlfctlsfsDrmxmono4oexn feiadls uanvs ()artrxoctydfaDrln i s)t2tm(m3iu4lpee ncias)sDua(m no0opeo ociat mDemn p;(4aeeoircty1latrlu sls0t2urim ny1lp   nvsat arua(monu4teeoiieild sDua( o ()areoxr todfaDranvs;s) rxmirpoo4oltelfcs ()a2uax o;u0tlt if3tydfa el( snu)artrif oatlaD lnvi s) eumimpny4ame mfvi t  rtauro;u0opt ifciad s2rlnmon()texoio3io1lpt li i t)sexr(r3oudoltnmnes t)aDtaxrp;u1oet iociytfm rlu o;u)tetrio tydlm eln sls0sruoim3nudlmeemneta( a2urxm no4tpt  iciadls2ul(mp (4tlxnxocto1lpDe n i;s0 2toir3iu1opeemivilsfaDuaxroot0tee  i3tat m2rmnmp;(4aleniocoatfatranvi;() rtoirpnu1ameelieil(fartrxmp;t0ope  f3iaslmDulnvs;() exnif tadlmD lies t0truoxm3ny4lle lnvilt s2tmxr nt1aee ioeildfs ulumo t)aleomo iadoatrli o;t t2toxm3nodlmt mfet s) Drauro;t1aexo o3tldfm2rm(msnt0 rtrmr oa1fptrauesls t2toir oudlm n ici s srtaum nu4opto ieiyslm ulumsnu) reoxrcoy1fpte nes ()truo(m nudap e iesa(fsrra(  oo1teeoifciysfm uaumo u4 lxnmfctadlptelivo () etr(r oo4lp e fcs sf Duaurono0texniiciytlaDrmu p;u4teerif3ootopD an i;t  rto(o3iy1optelicil()s2rrumonu0tlenioeiltfa emump;u) rxoxr oytlm e nvi;t0truoxm no1omt mietat aDrrxmo;o1aet io3iat sDuln on(4trxrmo oadopDrli o;t)texrirpnu4lmte ivil( srumx pnt1teeoiociasla rmumo t4arxrmf totfaDrauei;( t2toio3io1omenmiesls)sruaxm nt1opeoioetls a umn snu4altnir io1lm e ues;t0seuoir iy4al  lfvi tfsDururpno0tleomf3iysfa2rl(ms;t)trtnioctadoa elnvs s0trtm(o3iydap  lieil(  2rm( ont0aexn fciydfm2rlu p t0aetrxf iotla  lu o;t)sexoxm oo1ll nmfvs (  rtr( ont1tlt  o3tas aDelnms;t4 renirciatla eauvs;( truoxm iy1omt lfeilsf 2rmur nt4aexn fciltfm ra(vo;(0arerio3oy1lp  lneils  2urio3iu4omee iciltfs2ta(m ou1oeeomieiltla umnvp;u4tlxoircoytfptr i il(0trumio iodlm  mfvs s srua(mont4tpx moctatlmDemump;t4altnxoctotlmDe nvsl( trtrxo3nudlmeelivslt)a2umumpoo0olx  fctatlsDra( o;u4texoio oodlpt li s;t  rxmiopoy1op   neiat)aDra( oou0tle mfetydlaDumump;u0 eerxo3ty1fatean o t teto(mpoy4amtnlneil( sDrmurono1oleomfcilsfa emn p;t)teenxocty1fmD ln ils)setmimpio4omenmnet s)aDrrx  ;u4tlt miciysfs2rln pnt0aetomf3ia1lm  auei (0t2xo(m3oy4ope lfesl( s2ta(mo;t1opxnmfctyt m2ranvs t0 etrmo ootop r nei ()teuoim oy4ale  nvi s arum(r nt1tptniietlt s2umu ont0 ltomrcoatlpt auesls0t2trir3iodole lieil(f rtax pnt0apxniiciadfaDran on(4trxoxo to1oat anvs;(0srurxo3nu1aptelnvi s s2rruronu0olxn fciasfaDra(vs;()aeeomrcoy1fp eluesl( s2um(m nu4olte ivs t  Drr( pou1ale  f3iyt a2uanmo;t4 rxoxr ootfpD anes;t) rxoim3iy1oleemietas srtmxm nu1oeeomfeiydlaDrlnms;u)aetnxfcoodlmDeaueols) etmirpoy4lmtelnvsa() rrruroou1olto feildfa uaums u0 etrifcoadomDeau s;t)seuo(o3oudame  ncsat)sDtm( pnu1oltnifeiydlsDean o;(0trtnxo3tytfpteaies t) 2toxr iy1oleemici ( s2tmumonu4aeeoiiciyt aDelumpnu4aleoif3iy1lmt auei s0trurxm oo1apeelncias)arumu o;u0apeomoetadlmDuanmo u)aetnxf3oodoaDrai o s)trxoxm3oy1amtn ictls) 2um( pnt0aeenmo3tlslaDrauvs;t)trxomf3tytla rli il(  eurxmpio1oltnmncs (fartm(mp;o4apxo ietys a ean onu) rxnircoodfatraieols)srxo(o3oo4amenmivsltfa2um(rooo4teto octas m2rm(mp;u) rtnxo3oadlptraues t0 exo(m nydoptnlieiasfsDrmxmont4alto feiltlm ea(vp t)trtoir3ty1lp rlneil( srxmxo3oo1lpt lnet sfaDrmu pot1aexomfeiydfs ean o;()trtnmr tydoptran il() ruoxo3nudlpte nvias)srtmurpnt0aetoio3tad s ran s u4tlxnmo3ty1lpDeluvo s)tetmxm iy1olt mieilsfsDtrx onu4tee mietadla2uanvp;u4tltnio3tadomtr n i;s)texm(o3no1ll e ncias) 2rm(r oo4tee  oetltlm2rm(vo;t)teeoxfcty1lmDelivils) rxo(m ou1apenlfvilt)artr(mpnu4tltn ociasfs2rl( o;() rxnir iatla e neo;t)srxo(mpno1ll e fcsl() Drru p;o0oet  ociydls eaumsnt4aleoxo iy1latelivo s) rurio oo4apen fei tfaDurxm nu4oeen octld aDra( ont)alxnxr3iotfm rluvo () exrirpiodaptn ivil()srtm( pnt4olenmfciad s2umn o;u)aleoiociodfmDr nei s srtrio3ou4olenlnet t)arrmxrp;o1olxo fetldlaDua( ont4 reoif ia1fmD aivslt  2urxrpno4lmtn ieiatf 2trx onu0oeeniociatfa2um(vp;u4arerif3iy1lpte ivi ()seurimpiudlp e fcs sfsrtmuroot0olxo octydfmDeauvs (0 leriociotfateauvo t) 2umxr iu1omtnmfct tf rra( o;t0oexoioctaslaDea(mp u4aeenxr3oydomtraieo (  2tmio3iu4lme lnvt tfsrrau  ;u4olxn fcilt s emuvp (4trenmo oa1oaDe uvs t0 2xmim3ou4apeelnctat srrax ono4open oetysfmDrl(vp t0tlxoxr ootfptrlieils t2xrxmpnydome miei ()aDrmump;u4tpen octlslaDrmuvo u)aexnmo3oytom rliei t0texm(o io1olenlfvs t)aDrrx o;t0oeto f3iat m uaums;t4tlxrxr ia1lmDeanvslt seurim3iudlpeemici s)s2trumpno4tpx ii3iasfm um(von(0arenmr3iy1fa rln s;t0setrio3oodamee icta(farraur ;t4aeto oetlsfsDra(ms t) rxoircto1lmt  u o () eumio3iy1aleelivs t  rtaxmoou0tee mo3tatls ea( s;(0tltomf3iy1laD  ivils texrxmpoy1alenlfes t)aDrr( p;u1teenmi3iatfaDul(vpn(4 etoif3iodlmt li o;t0 etrxo oo4apt  icsasf 2trum no4tleoifciatfmDuan s;(4altrxr3oo1lmD  uvi;( t2tm(m3iy4ameemfei t)aruau poo1oex if3ilsla um( pnu0tetrxr oa1lp eaueils)t2xr(m ou4ol nlfvi ( a2tmur ;t4alxoifeiat sDua(mont) eermo tatfaDr nes;( trtrir iy1oleelneta(f 2rru  ;o4ope  fetyt sDra(vs;t4 ltoxo3oytlptr ieil(0t2tmiopio1lm   feia( aDum( pou4oee mictatlm2uauvo (4 lxoxoctytfm   ies;t)srtoxrpou4ll emfcsl() rrrxrpnt4tet ioetyd a ean p;u) lxomocta1omDr uei;t)s2xmim oy1lmtnlietasf Drau p;o0optoii3iytlmDumu o;t0teerif3ootoptrau il()t2xr(m io1llt  nctatf rtaumpno1opeoifeilt aDrlumo (0 etoxo3oatomDeluvi s seto(r ny1ll elici (f rrax ono4aptn o3tydfa2um(vs;(0arxrirciydoatr n i s0trxmio3oudop e neilsfa2ta(mp;t1olxomo3iaslmDua( p u4texrmo3to1om eaneols) eur(opoo4lmeelfetl()a2rm(mpot1aptniieiltlaDran p;t)artrxr ty1oaDranvo;t)texmxmpiy4lltemfvt s  rraurp;o0tlx ioctydfs ean s (0arxnmr ia1fp rln o s) rtr(r3oy4amte fvs tfsDtaurpno1apxo icildfm em(ms t)alermo oo1lpteaiei;()t2uoiopnudapee netltf rrmu  ;t0openmiciytla eluvo;t4artoir tytoa eanei;s)seumxm3oy1llenlfeta(f ruau onu4alxomi3tyslm2ra( o (4aleomr3ia1lmDelnvi;(0 rxoim3nudameemfesas aDtm( oou1alt  ieiasfaDrmu o;t4 reoifcoydopteln slt)srumim ny1aptnmnviat)s2ra( pou4altoif3ildla rau p;(4alxnmo3tadlmtraivs s0tetoiopnu1lm nlicils)s2raxmont0tleo fetysls2rm(ms ()tlenio3totfp  aueo;s)t2trim3oodamtn fvtls srrmum no1tlt  feiyt a rmu p;u4aexnmf3iatfpD livo ()t2trxo3iydlp emfctlt sDuax o;u1alx mfetldla2elnvonu) eenxo3tadfa   nvi s)srtrxrpno1lleemfeiasfsDrr(ro;t4optnmo3iyt aDea(mon() etoir3io1fa rlnvol()srtrxo ny4omt mnet s)arrm(rp;u4aleoif3ildlmDea( o u0trxnxo3iatom e u il(0 exr(mpio4olt lictl( aDrr( p;o0tee ifciytls umumont)tetrio iatopDe iei (0 exo(o ny4lmen ies t)a2urx  ;u0aee  oeiatfsDuauvs u)teenxrctatfm r nesl( teto(m io4lpt lnct (f rua(mpno0oeeoio3iasfaDua(vs;t4alxnmfciotlaD aies;t srtrxm ou4alt  ieia( s2tmu pou4olenio3iysls ulnvs (0trtrmr3tadfa ean slt)t2uoir iudomtelieilt) Dum( o;o0oleomfeiatfm2umumo u4treoxo io1oaD lnvi ()srxoirpoo4ope  fvsl( s2umx o;u0alx iictldls2rmump (0 eerxo3ty1faDrai ols0 2xr(opiu1ameemfet t  Drax  ;o1teenmo3tatfmDrm(vsnt0 exrmr3iotom eau slt  rum(o iu4lmtnlictas  ruau p;o1tex mi3iytfmDra( p;u)tltoif3to1lm elies;s srxm(mpiudop e neia() 2ua( ooo0alxn ieildls eauvs;(4 eenxo3tydoat auvslt teuo(m3iu1am nmfeta( sDtr(mpno0opt ii3iaslmDul(ms t0aeerir3oa1oaDeauvs t0srum(m3oodamenlfvsat)s2um( o;u4aptn i3tytfmDem( pnt0aetrmr3tatfp r nesls0 rxoxmpno4opt lfcilt)a2ur(rpot0oltnii3iasla rm(mp u0trenmr oatopDeai il()srto(r nu4op  lneiatf rtau  no0teeomietldfs uanmsn(0tlxnif3tatlatrau s s0 rxmxm3io1lm nlnvsl( sDtmxr ot0olx iicilt sDem(vp t0arenif3tydfptr nvols0 2xoim oo4omt mivtas)s2ta(rono0tpxoiiciltfmDrm(vo () reoxf3oadlpDrlneslt0truoxo iu4llee ivilsf 2umurono1tlto fetytls rm(msn(4aeerxrcia1lmte uvs ()teum(mpiudlpt lnvtlt) 2um(rpnt1altnii3tadfa uaumsnu0aexnxoctadfmDe uvi (0s2xm(m3no4lpee nvtasfsrrm(rpnt0aexo i3iysfa ulu o;(4 ltnioctadfm elnvsls  exmio no1om emnes s sDrruront1oet mociys a umnmp;u0aetomociadfaDraivi;t sruoir3iydameelnct (faruaxm no1oltnif3iyslm2umumo t4tlxnio oydopDrlneslt texmxm3nodolt  fcilt)sDrm(mono0oet  oetld s2emuvp () lxoxocoydlpt lu i t)srtriopnu4olenlnci tfsDuru  oo4altomictldlmDrlumsnt0trxoirciadlmtraivo;t0tetoxr ou1lptnmici s) rumum ou0aetnioctydfs2rm(von() exnmr ty1lmDeaivsls)s2xr(r3ou4lle lnvtlt  rtax  no0apto ieiysfmDem(vs u) rermrcto1optrauvols srur(r ou4amtnlncilsfsrraxm nt1tlen ieild a2em( o;t0 rxoiocia1oa  anvi;s0srxr(m oo1apeemfei t)srumxm no0tpeniiciad aDea(msnu0arxrmfciydfp elivs;s) rum(o iodoptnlfcs t  Dtm(m ;t4aet ioeiydls rmnvsnt)tetoif3oatomDeauvi s0s2urxr3iydaleelneil(farrr(monu4oeeo o3iad s ua(vp (4teeniocoadlpt  uesls0 rtrir3oo4op nmnvil(fs2tax onu0tex mfeild a eln s u0aleoifciytopD au olt) rxrxm iudamee icta() rrm( onu1aleomfetasfa2ea(mp u) etoio3iatla e u s t0teum(opoudapt livtlt s2ra(rpot0tpt ifcias a umnmon(0 ltrmocoydopD livo s  rxrxmpny4amt mivias)a2uax p;o4tleo ietyd s2rl( s;t0tltnmfctotfpt lnes t s2tm(m3nydamte ietlsfsDtmum ou4tlxomfetltlm rlnvp;t4texrir ia1lp eaueslt  ruoxr iy1lp e neilt) Drr(roou4tptoiietatfs uln on(0 etnmr3ty1lmt lu s s0s2xmxr3iodomtnlfvt sfsruaum oo0aet  ieildfmDraumo t4alxnmr3ty1oaD an o;(0 rxoirpoo4lltnlnetlt a2raumo;u4apx  fctadfsDrmu o;(4 exrmfciydomD lieo s sexoim nodoltemnet tfaDraumoou0tpt mictasfa2ra( p u) leoif oo1oatelues;() 2xrxm3ou4omtelicslsfsrtr( pnu0alx  ociyd a2rln p u0artoxf oadfa rlu o ( setr(m io4aptn nvia() Dumumpot0altnmocilsfm2rl( s u) eerxo tadom  anesls)srtoimpio4olt mfciat aDtrxm ;u0opx mf3iadfa eauvpn(4 eenmfciodfa  aneol( s2trimpiu4oltelnetl()sDrmuro;t4oexnioeiyt s umnvp (4arxomf tydlmteaivo;t)s2umxmpnu4altn nvs t  rtrxmono0ope moetatfa2emumo t0tlermr3iadfmtelivsl( s2urim nydll   icias)arrmu  ou0openifeiat s2uaums u0 lenmr3tydfmtrlnes t)tetr(r3iodll emies t) Dumxmp;t0tlto feilt a rm( o t4alxoxr totfat  uei t0teto(opiu1op   fctasfa2tm(m nt1oet  feiyt m2ranvs ()tltrmfctytopDr u o ( sruoim ou1olenlnes t s2taur ;u1oeen oeild mDul(vp u0artoiocoydfaDr ueils  rtoirpiu1lm nlictls)s2tmx  oo4olt mfeiytlm ran s;()tetrmf oa1op eauvs s0t2um(opiu1ll   fetas)srtr(m ot1ole mf3iysla elnmpn() rxomf3iotfa r ues (0s2urio3oo4lmt lici t aDum( p;u0opxnmociydfa2rln p;(0 reoxo iy1omDrluvi s0 2tr(opoodalenmfcsl() rtmxmono1tpxomfciatlm uanvpnt)alerio ootlmtrlues;(0srto(r oodoltn nci t arumxmp;o4apt mi3iysfs2umn o u4 rerxf tatfp   u olt)srtrio iodoleeliesasf rtaxrpnu1tle ioeiltfs2ulnvp;t4trtomocoatlpD  i s;( s2uoirpoo4lpenmfeta(  2tmur ;o1aeeoiietasla2ulnvs u0tetrmo ta1oatraneslt  exm(r3oo4alenmiesa(fsrrrx p;o0aex iociadls em(mpnt) leoif iatfa   ues s) etrxrpiu1opt mfesat)s2urxr oo0texoii3ilt m2rmums;t4tetnmo totfmDe n i t)t2toim3iy4lptnmietl( sDrmxm ;o0tex iieiysfmDulumsnt4aeeoifciotfm e uei;s0 2uoxrpio1om n iesas  rur(  nt0opxoiiciadlsDulnmp;t)tlxnmocoytlaD  neo;s)teuoio iy4lmenlfei t sDurxm ;t0aleomiciatlaDemuvs t)trerxo oadopDeaneo;t0tetmxopnodllte nvslt) Drmumo;t4oexo o3iys mDem(mont)arenmrcoo1fpt  ues;s) 2tm(r3io4lltelivtlsfa2rrxmp;t4oet if3tldla eanmp u0aeeoio3iytoaDr n i t) eto(m iodlmtn nei sfsDum( oou4tptomi3ils s rm(mo;u0aexoxfcoadfpt  n ilt) 2toxm oodopt  ivt t) rrmxrpno4oet  fctadla2emumsn()tlxrxo iotomt  i olt0seuo(r oo1lmeelivsasf Dua(m oo0tex  fctydfs2rmn o t)treomrcoatopDeau s (0sexoxrpio1alt lictlsf 2rmumoou1alxoiieiytlsDulump;()aexnxrctytlat anvi t)trxo(m iodomenmivs tfsDraump;u0tet ifciatfsDrlnvs;()teeoxr iytfm ran i ( s2ur(m iu1ll  mneiat sDtrurpou4apx mf3ilt aDum(vs;u)arxrxr oy1lpDrluei;(0setrio no1op  lncslt)sDuru oot1tltoiietys m2rm(mo t0 lxnio to1opt ai o t0t2um(rpnu1lltn ivilt)a2rr(mp;o1alx mieild aDrmu p u0tetrmfcta1lpD aues () 2trimpiodal  lnctlt) Dra(roou4alx mfetlt m em(vont)alerxr3oodom  lu o () 2uoirpio1omtn iei (fsrraumpno4open fcilslm2em(vo t4tlenxr3oy1lat auesl() rxmxmpnydalenlfvsl( arrm(roou1aexo ieiatfs uln s u) rxnxr3iytomt  ivilt)s2to(m iy1lm n fvsa() rtaxrp;o0oltnmociytfs2rluvpnu0aeerxf3tatlptranvol(0teumir iudal n fetas) Draxr ou0optn oetatfa elu o u0arxnmr3iatlm  livil() 2trxm iy1oltnmics s aDrm(  nu1olto f3iat m2ra( ont0areomo tytfatrau o s seum(rpoy4lmtn fct s  Dtax p;o4tlt  f3iasla elnvs u0trxnxociotlm raues t  2trim iodame licil( arrr(moot0altnmf3iydfaDuanmp;t0treoxo3iy1fatranes ()t2xr(m3oo4lmtn nvsa(  2rr(  ;o4aeen feiadls2ran o;t4aeeoxo3io1lp rluvs;( t2xm(m io4ape mneils) 2trum ;t4opt  oeiysfm2ea( p;t)trtnxrctytlaDrluesl() exo(rpnudal e nei ( a2uau pnu0ale  o3iys mDumu snu)trerio oa1faDrli i ()seum(m3nu4al   iesl()arrm(mpno0oexo i3iyslm2eluvs ()trermr todlaDe nei t0setm(o nodllenmncs (  rtmuro;t1oex  oeild s umnms;u4 rxnmf3ta1laDe uvi;t0t2xoimpou1ape lneil( artmx poo4tlx mi3iatfs rl(von(0altriocoo1lmDrli i ( srxrimpiudlpeemneilsfsDtr(m nu0oee io3iys sDuluvon() renxrctotfaDr ivol( sexmim oo1opte ies sfaDta( o;o4alt moeiysfsDran onu)tlxnir ootopt ai ol( tetrxo no1lpee feil(f ruaump;o4tlxnif3iatlm2ul(vs ()texnxocoadlmtrlieo s)t2xrxo3nodom emnvtat) rtm(rp;t0oex mi3tyt a umump (0altomf tatfmtrlivo ()s2umirpoo1ol nmivtl()a2urxmpnt1olxn ictytls eanvsnu4 etoxr3todfmtrlnei;t)trxoxmpiy1ap n fvia( aruaurooo1apxn ieiat sDeln o u4alenifcoa1fm eauvi ()setmiopoy4om e ivsat)aDtmx o;u1tptomfetat aDrlumpnt4alenircia1opte uvs;s t2uoirpno1om   ncta()srraurooo1optomi3iad mDran p;u0 rxrmf3oa1la  lu ils0truriopou1amtemncils srtmurpnu4olto ieiys m emn o t)altoifcia1lptr uvs ()seumxopnodam e fvtls  2ur(mpnu1tetnmieild m2rmnmonu4 eermo3oo1op  aiei;(0s2xmir3ny4ole mivta(fsDrmu  ot4aleomi3tys s2ua(mon(4tlxniocoydopD aivsl( sexoxrpno1omtnlici s)arumxm nu0tetnmf3tat a umn p u4alxrxr oadomD  iei (0s2xrxr ny1olt mfctl()sruru ono1tpx mf3iyd m2rl(mpnu0aeenircootlm   u o;s) 2tr(o3oo1alte nct () 2ururp;o1tpenmoeildlm umumo;()tleoif3oy1lmt lnvslt trxmxm3oo4lpeelivils s2trxrp;t4tpt mietls aDumnmsnu)trxrmf ia1fpD  ues t  
\ No newline at end of file
@@ -0,0 +1 @@
+u ol(  rum(o3no4ape licsat sruaumo;o4olt  oetydfaDra( pnu4 renif oytfp raiei (0 2xmxm no4om emfvtltfsDrr(mpno4oeenmoeils aDrauvp;t4arxnmoctytfa r nvi t teumxm oy1lmt  nvtlt)artmum ot1tex  o3tys aDelnmp u)trtrxf iytfa  ai ilt  2xriopiu1am  livt (f 2tm(  nu0teenifeils m rm(vsn()aetrmfctodomtr neo s0sexoir iy4aptelivi s a2ur(m ot1alt  ieiyd a2rm(vsnt0 leomr oo1la r ivi ( texmir nydape mfcslsfa2rmxroot1tpxo ociydlsDraumpnt) rxrmr iatoatr i s;s0t2tr(r iy4ll e nvil(f Duau ono4opxniictasfmDulu snu0tlxoxocoydlpDeau s;t0 2tm(m3iy4al emfci sfs2umxmp;o4tpen feildfaDumn s;t)aexnmr ta1oatrlu i;s0srurim3iodlmtn nvtltfsrtaxmont1tpto f3iasfm em(vsn()aetoirctotlaDran i s0s2urxo3ou1amtnmncs sfa2urumpot1olx mo3tasfmDran p u0artrxfcty1faD  uvi;() eumxo3ny1aleelfvtas)s2rm(mpnu4oeenmfciydfm uluvo t4tetrifcty1fptraivo t0 ruo(r3oo1am n neiat a2tr(mp;o4alenmf3iyd a umn sn(4tetrxr3ty1laDeluvi t t2to(o iy4lmte icia() rtmx  ;t4tleo o3tytlm2rmu p;t4 lxrir tytfatrau ols0 2xmirpny4amtelicsatfsrtr( ont4opxo i3iytfs elnmpn()teermoctydop eau s;() 2trio iu4lptn ici t s2tr( o;u1tetomieiasla2rluvo u) exrmf iy1fpD  ieo t0 exr(r3iydlme mict (f 2ur(rp;o4tpxomietat sDulumpnt4texrir3oadop rauvol(0truo(rpno4am emnctltfsrrm(m ;t0tlt  oetyt s2rau s;t0treniociy1fmt au i s)t2tmxo oudop e ncias) rtmx  ;u0tpxnmoetad m2rm( pn(0aexrio todlpDelneil(0srxr(m no4lltemfct sfaDumu onu1alxo o3iyt sDrlnmpnt4 exomo iodlmtelnes;s0 euoio ou4omte fet s sDrr(rpnt1apt iieild s2ea(vp u)teenio3tytlpteluei t0sexo(r3oy1am nmfctls)artau ono1apxnio3iat mDul(vsnt0alxoxfciy1fpDrai i;t)trurirpnu4altnlfcslsfartmump;o0tleo i3tltlaDul( p;()trxrio iydlp rli s s0teur(r oo1olt mfetat) Dtmxm nt4tpeoif3iysfmDrmnvpnt4artnifcta1lpDeaneil(0 2uoirpnu1ap n fet sf rrr(rpou1oetnmi3iydla ra(msnt)teenif iotfmD  ues (  2umxo3iu1apt  fvt (fartmxrp;o1tptnioeiad m uanmp;u)arenxrciytfatr i il(  exrim3ou1alte ivsat)artmu  oo4opt  octltfaDumnms;t0 etoxr3oatfa e u o;s t2xoxmpiodapt lfct t)s2rrx o;u1teen f3ildlm2elnmont)tlenmf oadfaD lnvo s)setrxm3oodole lfesatf 2ra( oou4oetoioeilslm umu p t4aetrmrcio1fatranvo;t)s2xm(o3oo1apt mfes sfarrm(monu0aptoiociatls uluvpn(0arxoif ia1lmDe iei;()srtmxm3ou4olen ncsas sDtr(r ;o1texomoeiadlsDrmuvont4 exnmrcoydlmteanvs;t sruo(r nydlpeemnetlt  Durumpoo0apxnmf3tytlmDumnvont) lermocoatop r nesls t2xoxo3nydape lfesa(f rurumpou0tetoiiciys a2elu o;u) etoirctytopDrlivo s trto(o3ny1oltelnvia( srrr(ro;t1oltn octydfmDul( o;t)treoiocio1fpteli o;s) 2umxr oy4lmeemictat a2umurp;o1aexoifeilsfs2ea(vo;u) rxnio ta1fmDeaies;t t2xo(m nodop  mfvi s) 2rm(rpou1opxomietlslm rmu o t4tlermfcoy1la r ivi t0tetoxm io4lpen ncias)srum(mpou0optn oeiatfm2uan on(4 rtnxf3tydfatrlu i ( seumxm io4al e ies s  rrax o;u0oexnii3iltlm elu o;u0texoxo3oadfmt lu ils) 2trim nodlpt  ieiltf 2tmxr nu4teeomo3ils s rln ont) rxomo tatlate i s s0teum(m oodape livtatf 2taxmpnt1tltoif3tat mDrmnvo;t0 exoio tytfpDeaueo t0s2urimpoo1optelfes s)a2urxmpnu4ope if3ildla2emumo t0 ltnmr ty1fmDranvo;t s2tmxmpnydlmt  fesl()a2raxmo;t1texo o3tas a2rl( s (4aetomfctotlm e ieo;s srxo(opiudam emnvi (f Drrx poo0tleo ocild s2rmu s t) ltoxf oy1opDe ivi;t)s2xm(m oudaltnlfei s  ruaurpot0tpe  oeias s2eanvo;t4teeoif tatlmDr iei;t)trtr(rpnydlme mfcsas s2rmu ooo1texnmfcils a2um(mo t4tltrmo3oa1fmDe i s () rtrimpiydop nlicslt)a2uaumpoo1tpxnmf3iytfa2rlnmon() rerir ty1lmD  nesls)sexo(m3io4omtnlncia( aruaxmooo0ape  icils a ean o t4 lermf3oa1op e ies s) etrim nodap nmnei sfs2uaxmpnu4oetnifctadlmDemumsnt0trtnio3oadlm e n s;s)t2xoio3nudapen fvtas)a2ra(r no1tptn oeiltfm ua(ms t0trtnmo3todoptrauvs ( teto(m3iudalenmfcs s)sDtru p;o1oex micias m ua( s;t0aleomf3ty1lmt ln olt s2tm(opiodal   nvt () 2umum no0olt mictltfs2rlnvon(4aexrmo to1lm  lu i t0t2tm(mpoo1llt lnetls  2tru oou4aetn f3iys a umuvp t) renxf3oatfmD au slt0t2xm(m oydlleemnesat arumx  ;o1texnmi3iasfs2emnmonu)trtrifcoy1oateau s;s)sexoir ou4am e iesas)artmxmo;t0olt mi3tls aDul( o;t)treoxo io1fp eliei;t0 rtm(opnu1lleelivsat)s2tr(rono0tpt  ietytlm rauvp;t)alxoio todfptrlnvs;t)sexm(rpny1optnliei s sDumxmo;t0tlxoiiciad s2raums;() leoir oatfm e n s;s0texo(r3ou4lptnmfcs (f Dtrxmp;t4apxnio3ias s uln s;t4 eeoir3tatlpDe n ilt0setm(m3oodlpt lnesls)sruau pnt4oexn octysfm2rmuvs;t)tetoxo ootfp r ivi;s) rxrxrpnydap emncta() Drau ooo4opx mo3tysfm2eau p (0 lxoxfcoa1lp  an olt0teuo(mpiu4am   netls  Duaum oo1opxo icils sDemu pn(4aleoxrciy1lp rau s;s)texoiopiudlmtnliei (  rtaur ;t4aee mociydfa2elumsnu4 rxnmo tadfm   nvol(0 eto(o iydomte icia(fsDtrxm ;o1tpxoif3taslmDrau o;t4 lxrmfcoatfpD auvils)trxmxrpoy4lpe lfciltfaDuax ont0oeto fetls s ulnmont4teeomrciotfpDrlues s0 exmxm nydamenmfvils)aDrrurpnt4aexoiietlsfsDumn ont4texrmo oo1omtrauvolt0setrimpnu1apenlfcs t)srtm( onu4altoiieiadls umn p u4 rtnmoctotoaD an s s trto(o iudopeelieiltfaDum(  nu1apxnmoetyt a rlnms t0alxoxf tydomDrluvi;s seuoim3ny1aptemici ()s2uax  oo4olxoioeilsls rau o () rermr3iodomDr uei;t  etrio3ou4lle  nct (  Durx pnu4aetoiiciydlsDrln pnu4arxnmo to1opDr n olt)seurir3oydap  miei () 2ra( ont0alenmocilt sDrmnvsnu)tltrmr3todlm rln ols  etmxmpny4amt miciatf 2rmu oot1tee mfciltla elu p u0 rxnxf3oadop r ieo;t s2toir ny1oltn fcs t s2ta( oou1texnmi3tad a2ra(mo;(0 rtnxo3oatlptrauvs;t trxmxm3iy4apen neiatfsruaxmp;t4olx  octltla2rm( pnu4tetrifcoatopDraivsls)texoio oo4lltnmnci s)arrr( o;t4olxomoeiatlsDumnmp;u0 rxnmf3oadomDelneslt0 eurio ou1om emfcia(fs2raxmpoo1tleoiiciydlsDeanvp () etoio3ty1fp raivilt t2uoxo3nudomt mneta(fsDtmxr ;t1apx  ietatla2elnvp (0 rtnmo iatoptr ivil(0s2xmiopoudlp nmncsl(fsDtru pnu4tpxn octld m umumo;t) eerxf oo1faD li o ( texrirpnu1optemietls) 2rax ont4apxo ictasfs rauvp u)alxomo ta1fpD ln o;t)sexr(o3oodol nmfei s aDrmxr oo4tet  ietad aDea(vp u0alermr iodlp e u sls)seumiopiodlmt mivtat)aDtaumo;o1aex mf3tysla rluvs u4aeenmfcta1om r u ils  eumxm3ou4omtemfvil( s2rru p;t0aee  ocils a2eanvsnt)aexrmrctatlptrln o;()trxm(m3ou4lm nlnci (faDtrurp;t1olx if3iltla rl(vs;u)trxnifcta1oaDrlu o s trxmir io1lme mfcslsfs2raxmoou1aetn f3iat sDel( p;u4aetoircoadla e ueil()texr(m3nu4omenlncils sDrmumo;o0tptnmo3iytfmDuluvp u)aexrmrciytfpteau s;() rxrimpiudlpt lfctl(f 2taxro;o4oexoiictldfmDraums;u) rxnirciatoaD lu s ( trum(rpiodlp emicils  2rm(r ;o1aptn oeiytla2rmumonu4 renxo3tytla elnvsl( t2ur(rpoy4ame lfvilt) Dtr(rp;t1tpx mfeiatlm uanvon(0trtrmocoydlmtraivi t)s2uo(r oy1ll nlietas)aDtm(rpoo1aetnmieiyd m uaumsnt0aeeomf iotfm r nesls  rtoim3ny1amtnlfvtatf rumur oo0apt ifcildfs2umumsnu0 exoiociydfa r nvsl(0srxoxr io4lpee ncsasfa2um( o;u1altnif3iltlm2ulu p;t0teermfciy1lptelnvi (0srur(opio1lle  iei (fsDtaxrp;o4apxoif3tatfa eaumo t4tleomr todoatr n il() rxo(r nodll e iesls srurx pnu0ope mi3ilsls ean p;t) rxrmr oydlptelnei s)srtmxo nydale  icsasfs2umum no1tpto f3iatls2eau o () exomfcio1lm eaneols0s2umxo3iudol  mfcs t  2raurpot0alx io3tls m rluvs;t4tltnxo totopD au s;()s2uoir3iy1opte nvsat  rtau  no0tle iieiytfm2ua( o;t0trtomr3tytlmDean i t0tetmxm iu4lmee fcs t arra(ront4opxnmfciydfaDul( o t0trtoifctatfp  ln o;t  2xmimpiodom nlnvsltfsrtaum ot4olx ioetlsfaDrau ont4 rxoir3ta1om rluei (  rtrirpoy1amtn netatfaDururo;o0aee  fetytfm2rln o;t4 lenxf3iatlaDrlues;(0t2urxo oudomenlies s) 2rmuro;u1alx  feiaslaDumuvsnt0altnmocoydoptrli s;(  eumim3ny4ap  mnctltfa2urxrp;t0tleomocias aDua(vo t4 etrio3tatlatr ivol()t2um(m3nudal elies sfa2tmumpou1tee iictas s2em( ont4 rxoxo tatlmtelnvi;s0 exoio3iydop e nvtltfartr(rpoo1tle mictys a ean o (0arxrmf ia1omt  uvs s)trxmxm iy4oleemictatf 2uaurono4apto ociatfm2ea(vp;u0 exnxo3todoaD ln i;()s2um(rpnydam elncil( a2rmxro;t4opx iieiys m2umnvp u) ltnxfcoydomt  uei;(0t2tr(r3iodapen iesls)arra( onu1tleoioctatfsDrlu snt)treoirciotfm r n s t) eurxo3oydoptemfcils  2rru ont4tpen ieildlsDeau s;t0 etrir oy1laDrli i;t sruo(r nu4olt lnes (  Drrxmoot0apeoiocildla2ul( s;t) etrmr oa1om   n s () etm(r3io1lp elnvs s)s2um( oot1oet mieiatfs2elnms (0arermfcoy1omDrai il(  rurir oydalt  fviat  2tax onu0oexomociyt aDean on()treoif3iytlpD luei;()s2toxo ou1amee nvi tf 2rrump;o1aet ifeiysfmDrmn s;(0altoifcootfm  auei;(  2xmio3io4optn ncsls sruau pnt0aeen feiatlm eluvont4arxrio3tydfa eliei;s)s2trio iudal n ietasfartaurp;t1tltomieiytfm rmnmpnt)aexnircia1opDrln s;(0t2xmxm3ny1omtn ivtas)aDum( p;t4tlt  ieiat s2ra(vs;(0trerxr3oadlm   uvi;t)s2trxr nu1amte ncsasf 2trurp;u1tlxo ieiatla2rl(msn(4aexoif iodoa  auvo t0 rtmxm3io4ale  ietl( srtaxr ;u4openmocilsfmDemn s u0teenmrcoatlatr uesls)teum(r ny1ap e neil() Drm(m ;u0optnmoetyt mDrl(vp;u0tetnir3oydoaD  ivs s0trxmxmpiydlmeemfes tfsrtmuroou4ale  o3tytfs ean s;(4aeenxf3io1fm rlivs;( s2uoxo3no4amt miei ()s2umur no4tet  ictys sDua(vs u4aexrxocoodfpD aivolt  etoxo3io4ape lfvt t srrr(mpno0apxn f3iydfm rlnvon(0texomf iotlaDran o t0 exmiopnudllte ncilt)a2ra(mpoo4teeomoeiasfmDumnmonu)aetomrctydomDeaivil(0 eum(mpnydlmtnmies t artau oot0teeoioeiatfs2rauvsn(0aleoio oatfaDeaivolt)s2urio nydoltnmici t  Duax o;u0aet miciatlmDrln o () rxrxf3iatoa   nei s0srxoxm3iy4olee fctl()srtruroou1oetoii3tydlm ra(ms;u4aetnxr tatfmD anes;t trumimpiodapt mnet ( srtmu  ot0tlx mfeiys s2umu s u)trtoif todoatr ueolt0t2xoxm nu4olt mics ()srtrur nu4oet ifcildla rlnmpn(0alxnmf ia1opteaneolt) exmxr oudaleemivilt)sDum( o;t0olxo oeiydfm2elnmp t4treomo ia1lmD luvsls seurxr3oodllenlnci s)s2urxmo;u1tpx  fcildfmDuanmo t0aeeoif iotop   ieil(0trumxrpiu4ap e ictlt sDta(mpot1olxo o3tas m el(vp;t4 rxnif oatoaDrlu ols)srxr(mpoo1al nlnes (faDuaur ;o4aetomoeilt mDranvo t)trxrxf3totoa r nei t  euoiopnu4openmies t  rtr( oot4ole  feiad mDelnms u4 reoir ta1oaD luvolt)srtm(opny4aleelncta() Dumuro;u0aptomf3iaslsDumumo u0tltrio3iodfa eaieil() 2xrxr nu4opt mnvs t s2ra(m ;t1tpxn feiadfmDrlu p;()tlxrmr oodoa rlnvo;s0trumxmpnydam  livia() rtrurpno1teto f3ilt a2el( o;u)areomf io1omDrlneol(0 eur(o nodlltemfvils)srrr(moot1opeoifciyd a ea(vs t0trxnmr3oatlmte ues;s0sexmimpou4aleemfetl(faDrmumpno4altniicias a ul(mp t4trtoio3oo1oaDraivs s0tetr(rpio4lp e icsa(fsrtauroot1olxo i3iltfa um(mo ()tlerxociodfptrlnesls trxoxopoodapteliesa()srtr(r ;o4olxo i3tld a rl(vo;t)alxomf3oo1optrlneo;t)tetoim no1apen feiat aDraxmooo1tpt  iciltls rmump;(4 eeomocta1latr n ols)setr(r ny4lpe mncsl( aDumx pou4opxo i3tad aDul( pn(0 reoxf tatop eai o t trum(o3nu1lltn neiltf rtmumonu0oeeo fciysfa2ra(vs;t4 etnif todfmD anes s)t2xmxm nodolt  fei sfs2tax  ;o4tet if3ild s2ea( o (4treoxoctytomDeaneilt)srurim ny4ll   fesat  rrm(ront0tpx  o3ilsls eau pnt0teenmf3todoa r i il(0 rtrxm nudal  mfvsat s2uru pno0tet iieilsls2rm(mp (0tlxrxr to1omteaivolt0tetmir oydap emfvilt  rtr( poo0oee moeild aDuau on(4 lxoif3iatfa elieo s0 etmxr nu1lme lfet t)a2trx p;o4aptoii3iad mDua(vs;(4trxnif iy1om r ivo;s  rxm(r3oo1op   icslt)sDtru  ot1aetnmfciltfmDeaumont) eeomo3iydom   nei ( srurio oy4ope lfetat)arrruro;u4olxomocildfaDrau onu) eenmo3tatomDraivo;s) rumxo oo4lmte ietlt)aDtm( p;t0olx mo3iydlm ranmpnu0tleoxr3iy1laD lieils  exm(o3oydop emfctlt sruru pou4ole moetad s2umn sn(0alerifciy1lm e ieolt)trumxo ou1amtemfct ( a2taumpnu0tlx  oeiadfs2raumpnt0texoio ty1om ranvo t0s2tmim3oudllt lnei (fa2rmur nt4ole  oetlsfmDemums t4tetomr todfaDranvs;s) rtoim no1lmt  fctasfsrtaxm nu4opx mocild m2ua(ms t4tlxomf oatfpDranvs t setoxm nudllt mict ( sDrm( ooo1altoio3tltfm em(ms;u)texrxo tatfa eliei;t0s2urxopnodlmt mnvslt  rumump;t4aptn o3taslmDeau pnt4alerifctodoaDr i ilt)t2toiopiy4om  lnvt t a2ra(ro;o1aexo i3tyslm umnmon()altnif3ia1faDeaies t)setoxm io4alenlfvsls)aDua(mpnu0aleo ociadfa rlums u0 leoxo ta1oa   neilt  ruo(o3iodope  icils) Durxm nu0oex  oeiytfsDumnmont4 rtnmocia1latrlnvo;() 2xm(o3nodomt  feiasf ruaxmo;o4ole mfeilsfaDulnvs;u)trtnxo3ta1optrlivi t)tetoxm3nudlptemfcsls)srua(rpno1oeeo o3tyd s2rmn o (0tetnxr3iy1fm ran s (  rtr(rpno4omeeliviat) 2um(mont1opxoifcildfs eanmp ()tlermo3iodop raneo s0srurxo ou4lpte fvilt)a2raur nu4aeto ieiat s2uan s;()aeenxrciodoateaueilt0 rxr(m ny1lptnmnetl( a2rmx oot0alxo fetatla rln o;u4 eenxf oa1lpt luvo;s0t2tmxo nudlptnlfvi t) Draurooo4aleomfciad m2eau s t4aexriocta1lpDeln ils  2umir nudlm e nvil( artm(ro;o1aexn iciasfsDulu p;t4tlxrio3oytopDr uvo;()texo(o iodll elncs ( s2rax  nt4olenifeiyt m2ua(mp t0 lxnxf3io1oatrlues;s)t2tm(o3oydal nmnvtasfs2urx ooo1aptnii3tysfs2eluvp;t4trxrxrctotoate ueols  rxo(o ny4op n neiatfaDrrxrooo0olxo icias a umnvo;u0arxrmfciotfpt aivolt0s2xoir3oy4alt mfesat) rurur oo0apx iietltfa2rmnms;t) rerir3tadom raivs t) 2urim3iodoptelfei ( sDum(  ;o4aetnii3tadla eauvpnt0 lxnxf totlmDe nvo t setmxm3oodam n fcias aDua( oot1aptnmfciadfmDrm(vs;u4trtomfciotoa ranei t  etoiopiodam  lfeslt) rurumo;t1tlenmfciaslaDum(vpn(4tlxrir3tatoat aieilt) euoxr iu4openmncs ()aDrm(r no0oeen oeils m2rlu p;t)aleomocoo1laD  i s s0trxrxm nu4amtn fvilsfsDra(rp;o4oexn f3iatla2el(monu)tlerxf3todfmDeluvo;( srxoxmpnu1al   fvtl()srra(ro;t4oleoiicilsfsDeln s;t)alxomo3ta1faD  uei;t0srumio3ny4lmtelfvtlt arrmxmoot4alenioetad aDul( o;u4texrif3iydfpDrlu il(0 euoxo3nydlpt lics t  2umx onu0tetoii3tyt a emump (4 exomo to1op rlnvol(0texmir oo4op e fcia(fsrurxrpot4oexn fetatfsDea( onu4 ltnxo oo1lmt lueols0 ruoim3ny1lp emneilsfs2taumpnu4tpto ietldls rm(vs;()altrxr3iotlpte u s t  euoimpno1omtn ictasfa2rru pnu1olxnmieildlm umu p;u4aexrxo ootoaD au s;()srxo(r3iodlp nmiei (fsrrmxr no1olen octadls2ea( sn(0 rxnmfciatopteluvolt t2xmxmpnu4ol nmnes (fs2rmumo;t1tlt iiciadfmDum(vp;u4artomr ia1fp   nvs t) ruoxm nu4lp emicsl(fsrtrxrpot1opt ioeiyt a elnms;u4 etoiociadoate u o ()trxmxm3oudlmenliesas)aruaurpoo0alxnmfctydfm2ra( o t)teerifciotoaDraivs ( t2xm(m nydlptelnci sf rrrumoot1opxnmoctydls2umn s;t0 lerir3oadlpD  uei s0t2xoimpio4lltnlfcsls  Dtrumpnt0tpxo oeiadla eluvs;() reniocoytla  anvol( srurxopiydamt lfeta(  2rr(rpou0alx mictld m rln snt0artomo iytfpDeluvslt0 etmirpnu1lmt mietl(farta(mont4tpxo oeils a uln p;t0trxoir3iodlmtrlu i;(0teurxr3iydaptemiesa(  Dta(rpno0tpe  ietydls2raumsnt0tltoxfcoytfm rlnvs s)sruoxm ou4amenlnesl( s2urx  no0ope  feiasfa2elumonu) rtoxrcootlpD  neilt  exoxo no4lmee ncsls  2rmxm oo1altn ieildfm emu ont0 eeomfciadfp eaivo s0 2trim3iydlpe mnviat sDraumooo1olx  ocilslm2ulnvo t4trtrirciatfaD lu ols s2tmiopoodom  lfvi tfsrtrur oo1opxn fetltfsDrm(vp;t4 etomr3oo1opD li i;( truoxmpiydopt lncs () Dra(rpno4tlx iietadlm em(mp t4altrmo3oo1om rli s;s)s2tm(mpiu1optn nvi sf 2rm(ro;u1tet mi3iadfa ul(vo ()tlerxocoytfat ln s;s0s2trir3iodll  mivt s) rra(ronu1aet  o3tlslm2umnmp t4 lxrmr3tatom   n ilt)trxmxm io4lmtelneia( s2tmxmp;o0oet mo3tydla2el( on(0 ltrxf iodfmDrauei s t2to(o3iydomte iciasf rum(ront1olto o3tyt s2um( p;t0aeenxo3iy1fmt aies;( trtoim3ou4amte nvsls arrau ooo4aetoif3tytlm2umnvont4teerxociatfateln o ( setr(r3nu4llenmiet (f 2urur ;u4aeto ociltfaDrau pnu0areomrcty1fatr nes;( teum(rpio1om n nvtls)s2rmx o;o0opxo fctlslm rl(mp u)tlxoxf io1fat ai ol(0s2trxo nydlp e fvslsf 2umxr nt1teto o3tytfm rlu s (4artomf3tatoatrai o ( texrir3ny4ome  nvils srrmxmooo0tex ioetadls2ulnvon(4trerxrctadfat  u ol() rxm(rpiy1op  mfvia()a2tr(m ou0tlto f3iytls umn pnt4artoxo3iotom e i sl( trumimpio1op emictlt sDrm(m ;u4oeen feiadlmDel(ms t0teenmfcta1opteluei t t2uoim ou4opt lfcslt) 2tm(rpoo0apto icild aDuaums;t)arxoxo oy1opte n sls) exrxo ou1amte fcsltf Dtrxmo;u0apx mociydfmDrl(msnu0altrxo3tatfptr nei;t)t2xm(m3nu1lle lfeiatfartm(roou0texniieiad sDulnvs (0alxoxo3totlaD lues t0t2xrxopoodome lfvi (farurumont0opto ieiat a2rluvp u4artrmo oadop  aivs;t)teumir nudlpen fvia() rumurpnt0oleo ictyd aDrmnvp u4 leoio oydla r nvsls) exo(r3ou1al e ivils) 2ta(mo;u0oltn fcild a ea(vpn(0alerxfciodlp  ln i;t0trumxmpio4ole mivi ()sDtrump;o4alenmfcias mDulnvsn(0arxrxr3tatfm raneol() eurio no1ll nliet (  2ra(ro;o4oeeomi3tad sDeln s u0 etnxf3oa1fpDraueo;( t2xmxm ny1lpe mfctasf 2umuro;t1teto fctat s rmnvo t4tlermocto1lmtelneslt)trtrxr3iu1ol  mnetat) rua(m ;t0oetnmietadlmDra( s;t) rerif3iodopD  i sls0trxmirpiodap nlnvil(f rrrumpnt0oltnmiciyslm2umumo;u4teenxfcoodopDr ivsl(0sexo(mpiu1oltnmneia( aDtrumo;t4aex iociys s ul(ms u)areomr ta1lat aneo;(0seuoio iu4lmtnmieiat s2tm(mpnu1tlen fcias s2rl(vs t0tlerir3todfp  lnvs t0 etoio3iy1ol  lnvsltfartmuront4ope  f3iasfa2ran o;u4aetnio3iytfpD luvo;s0teur(o ou4lm nmnesls  rumx o;t1aex io3iyt mDumnmsnu) etoirctodomtran il(0srtmirpiudale livt () 2tru onu0teen iciytls2elu snt)aeermfcoo1fmt luvil()t2xoxr3iy1lpte ivia( a2tr(rpnt4oltnmfetad m rmu sn(0tetoxf3oydomDr n olt  exr(rpoy1omenmneia(faDum(m no4tet  feilsfs2rmn p u4alxrmocoa1lp   ies;s0 2tmxm ny4alee nct s)arum(r ot1olx iieiysla um( p;t0 exoxr oodlmte n i;t)srtr(rpnu4olee nvsl(faDrm( pnu4aexn fetysfsDulump;u)arerxfcoy1opD  nvo t)srto(r iodol  livslsfs2ra( ooo0oeenmoeiyd sDrl(vo;u0aleoxo tydopDe u i ()sexmio3ou1ape  nctl()artmum ;u4oeeoio3tadlm2ean p ()alxomr3ia1opD  uvi;t0srxm(r iu4ape liet t s2raumonu0apxn i3tad s2elnvp t0 ltoif3iodomDr n s (  2xmxrpiudlp emfes (faDrrum oo1olen fctltfs uln ont)aeenxrcoodfmDelnvol(0 2to(r oydalt mfesl()s2urx poo0aee iieild a rluvpnt)tlerif iy1fm e nes;s trumim oodom emfcsatf 2umu pou4olx mo3iys aDea(mp;(0texoioctodlptraueo s sexoirpio4lmt  fesls aDra( p;t1aleoiieildlmDran o;(0trtoxfcoa1lp elneo s t2xoim ou4ll elnci tf Drm( ono1altnifciytls2emuvs ()artoxo iodom   ues s srtrim iudlmt  netlt sDua( o;o4teeomfeiytlaDemnvs;t)tlenmo3iadlpD luei t trumio3iodlmtnliciat)sDrrxro;t4ope ioctld s2umu o u4alxrif3iy1oaD ln s;(0 exrimpny1aptelici sfsDuaxront1tltnifcils mDulnvp u0tltnxr iy1fpDraivs (0teur(r3iydal elfct t)sDrru  no4oexomiciltfmDrlu onu4tetnmo3ta1oat lnvs;t s2uoxo3oudlpeelncs ()a2rm(rp;o0oexnioetat m rmu snt)artnmr todomte u s;s seurxm iu4ape  nvtasfsrraxrpot1aee  o3iydla eauvs ()alerxr3tytfm  lnei t) rtrxo iydale  fvil(farrm(m oo4oet  i3tad s em(mp u0 rxoxf oytfpDr uvilt0sexm(rpoy4lpt lict sfa2urx  ot1olxo oetatlsDrluvpnt)trtoxf iy1omtean o;t0sexr(rpnu4lptnmiviltf 2rr(r ;o4tlxo ociat m2ra(mo;(4 eeoxo ta1lptrauvo;( truoiopiydap  lnciasfsDtmxmooo0tlxo ictytfs elnvp;()alxoxr tytlmtranvi;(0srxmxo3oudomtnmiet s s2rrxr no1opto i3ilsla2eanvo;t4 exnio3ty1faDeluvsl( t2trxm oo4ap  mfesls) rtaxroou4oeeoiicild mDrmu o ()aetrxo3iatoptr ues;t0 etmxo nu1lleemfvsasfarurxroou4aetniieiatlmDrlu s;()tltomo oy1lmtr uvi t)sexoxmpiodamte feil()arrmur ;o1tptniieiys s2rauvo u4tlenmo to1fpt  ues s0t2ur(mpny4opte iei tfa2tm(root0apeoii3iasls elu sn(0 lxoxo3iytfa e ieo;s sexrxr oo4apenlfvil(  rum(mont0tle  fetatlsDuanmsnu0aetrxr oa1lpte ueils s2tr(opiydlpt  fet sf Dtauroou1aexomieiad m ean s u) eenxf oadfa rlueo t)trtrir nu1aptelivias) rum(m no4tetoio3iltls emnmp t4trerir3iydfm   ivs t)sruo(o iydlpenlies t)aDtrur nt4tltnmoctat s2em(mpn()aetrxo3oatfmD aueil()trxr(rpoudol nmnvsls  ruru  nt1tpe mf3iasfs2ulu o t0tetomr3iydfmtr neo ()setmirpnu4lp  mnvt ( sDtrumpot0tlx mfctydfaDel(vp () eeoxo3oydfpDrau s s)trxmxm oodam nlfcs s)srrm( p;u1oee  oeilsla emn p;t0 reomo oo1fm e ieslt  rxoxm oydaptn fvi s)arumx o;t0oexniociydfmDrau o (0trtoiocootlp   i s;s t2um(opiu1openlivsltf Durxm ;o0oetnmocild s2el(vs u0aeerio3tadomDeli s;s  rtm(o3no1lptn fctas aDurxmo;u1tetomo3tytlsDuaump t0arermf oo1fm e i s;(  rumxm oo1lp emnctat) rtmurp;t4texnif3iaslmDea(mont)tlxoir tatfmt lies;t0srumimpio1ol e ivtltfs2rru ont1apeoiiciydla rauvpn(4tleomo tydopt aiei;()sexrio3iy4al  lnesasfsDrm(m ;u1alx ioeiatfm uau on(4tetrmo oydlp rli i;t0t2um(rpoodopeelivtlt) 2tr(mp;o1oetnmo3iyslm elnmsn(4teenif3todfaDraiei;()srxo(o iy1lmtelncsl()a2rr(r ot0openmi3tadfa2rau on(4aeeoif3oadoaD  u o t0 2trir3iodomtnlnei tfa2rr(r ;t1opt  ieiydfmDeanvs t)aleoifciy1lpD an s;s0 exoim3nu1lmtn ivta()s2trxront0tpt  fctatlmDea( o ()tetniocia1oa   i il(  rtmir oodame  nvtlsfaDtm(r nt1teeomoetydfa uau o;t0tetrmrcio1lmDelnvo t0tetoxo io1lpenlivsa( a2ua(mpoo4teeoifeilsls2el( pnt)artrxrcio1fm   n o;()s2xmimpiy1ame  feias sruaxr nu4oeeo o3iys m2ulnmont4teenmo iy1laDrluvo t) 2uoiopoy1lm n fetls)aDta(r ;o4oleoiicilsfm ea(vo u4trtnirctotfat  i s;s0truoxm3nu1am  lfviltfaDuaxr ;u4oeen feilt sDran onu0tlxoxocto1fpD lnvo s0srtr(m3iu4openmncia(fs2truro;t4aeeoiiciasfs2umuvs;t4teeoxo3tytom r i sls) rtmxr3io4ap e ietl()s2ua(mp;t4aeeo fciltfm elu p () lxnxocoa1op r n i t)trur(opoo4lpt mnes ()s2uaxmp;u0tle ifeiadfm umu o u4 rtrmo iydomDe uvs s s2toirpny4oleemfeta(fsDrmu pnt1aeto fctlslsDranvp;u) rxrmf3tatlatraneols  2xmxmpou1oltnmiei ()aDrmxrp;t4alxo i3ilt sDrlnms;u0arxnir3totlmDraies t)tetm(r ou4lltelfet t srtruro;u1alt  fetytls ra( s t0tltnxf3ia1fmDe neils)t2xriopnu4am  mnvsl() rraxrp;o4teeoifctatlm ul( p ()tetomr3oatoa e uvi;( tetmxr3nudam n ncta(  2rm(ro;t0tetnmictatlmDrlnmo u4alxnxr iytoaDelnvolt seuo(r3nu1lp elieias s2rrump;u4aeeoiieilt aDeanmpnu0trtomrcoytoa r uvilt)srtoir nu4ap  mivtltfaDtr(r oo0tpxnmfeiyd a2ulnvo;u4 reomo3iodfatrlueslt0 euo(m3oy1lptemictls)aDrr(moou1texoiictys a2rlnvo;(0aeeoif iytop elivs s)truoio3ny4ape  nvsat)sDta( oot4olxoio3tldla2rmu o;u4 ltoxocoytfpDe uvo s s2trir3oy1amtn fesl() 2rau pou0oee ifeiad aDemnvonu)tetoir3io1op rluvo;()s2xrir3iu1alenmfcs s sDumu  nu1alxniociysfs2ran p t)tlxnxr io1omt lies t srtmxm ny4amenmfvslsf rtaxm nt1apx  i3tydlm2emnms ()tlxrxrciatopt lnvo s t2xr(r iodomt  fvta()aDta(monu0opeomfciadla2emnvp;(4 renifctotfm rlieo;s0srtrxrpiy1optelnesa()s2raump;t1aptnmfetld s rmnmp;() lenmf iy1lptean s t)t2ur(o3ou1lpeemict s arur(r ;t4olxomocias m2emnmp;t)teenir3oadlmDrlivolt)s2trir3oudlpeelnes ( a2rmxr nt4tpeo ieiys aDrmnvo;u) exrmf iy1lpD anvol(0srxmio3oy1alteliviat sDraxrooo0tpe  i3iad a umu o;u4arxoircoo1fmD  ivs (0t2xmxr3oo4lm  mnei ( srumxm nu4oexnmo3tys aDulnmp;u0tlxnxr3iodop ranvols0 etoxr3nudam   fes s  ruaur ;t4oltnifeiatfaDua( o;u)tlxomf3iy1laD livi t)texm(o nodamt lfciasf 2taxr no1olenmoetytfa umumo;(0artomf totfmDe nvs t0 rxoim no1lptnlfctat  rrr(rono1apeomieils aDrmumon(0tetrmfcoatla rai i;() etrxm no4lpen fcils  rtm( p;u0texnmf3ilsfa uau ont4alxrmocty1fm eln o t0t2xmxr nodoptnlnvia() 2rmxm ;u4aex iociytlmDuln o t4trxomr3iy1fmD luvo (0 2uoio3nu4ap nmfcs sf Durum no0oleomociytla2rl(ms;t0 ltrxr3io1fa  auvi;t0 2xo(o3iodol nlnvs t  rta(rpnu1teenmiciyslsDua( pn()tetoxo3ty1lp   ieo s)trtr(mpnodlm  mnes tfa2ur(  nt0aptnmi3tasfsDul( p u) etrmr iodlatraieo;s0 exoxo3oy4ole miesa( aDrrxm nt0apxo o3tad m emu onu4alenmf iotoaDeanvslt) rur(m3ou4ameelies s arurx pnt0alxn oeildla raump;u4 exrmrcta1lmD ln s;s texoxopnudam e nei ()artmu p;o4olxnifcilslmDuanvo t4tlenmrctadlatranvil(0t2xr(mpou1amtnlncs (fsrtaxmp;o4tlt mieiat s umnvon(0 reomr iatla r ivs s)srurio ou1lpeelfct t)a2tmurpnu4texomiciad a el( p;(0alerxf tydlmDe i olt trtmio3oy1op emietls)srrmurooo0texomfeiltfm2ea(mont0 rxnxrcto1latr i i t0sexo(r3nodlme lneta( sDumxrpnu4tpx if3ilt s2emuvs u0altomociydopteli o s)t2xmio no1alt  nesl( srrmx o;t1tetn f3tldfaDulnmo t0alerxfciy1oatr nvs t)sexr(m oydol  mnesl( a2rmu ooo0oexnif3tlslm elnvo (0 exrxf3tatlp rlnei t) 2trxo3nu4ap nlics (fsrrmumpnt4optoifeias a el(mo u)tlerxr3tadfmDelu s;(  2xoim iy4ll n fei (f rtau  ot0apxn feiyd a2rmnvp;t4trtnir oatomtelnei;t)seuo(o iy4omee fctas a2um(m nu4opxoioetltfmDumumsnt4teenio iadfmDeluvi;s0s2xmirpnydlpt mfei (fa2urxrp;o0optn i3iatls ra( pn() lxomfctadop ranvil(0s2xmxrpnudlptemici t s2trxm ot0teeomf3iatfsDumn p u)trenmrctytopDraivi t texrirpio4om elnctatfsrraxr ot4tpen f3iytls eanvonu0 lxrmr tytlaD  i s;(  rurxr ny1ll  mnvsas artr( p;t0apx if3tldfm2rlnmo t0trenmo3oo1late i ol( trxr(o nu4ome  fet tf 2trxro;t0oetnii3iys s rmump;()aetrif3iadlmt au slt  2ur(o3iodomtn fei t artmumont1tle ii3iytla ean pn(4aeerxocoadopt li slt) euo(mpoy1olt lieslsfs2ur( oot4alxoifciys sDranmo;t0 rtnmr3ootfm  li o;t)teumim oodolenmfcsa(fsDua( ono0ape iieiltlm rauvp t0artoirctydomD aivols  rxmirpiu4omtelfcia(fa2ua(rono4oex mfeiltfm rlu p;u4aeenxrciydla elnvslt)seum(r oy4om   fvia(  rtrurpoo1oeen iciltla2ea(vp;t0tltomf to1fmteluvs;() rtoxr iydomee nci t)aDta(r ou4alxoii3tytlm elnmpnt4tltnxrcoadoa r ies;()srxoxr nudapenlfetltfa2umxrp;u1oexomoctas a2umuvo;(4areomr3iatfaD  nvs (0s2tr(mpny1lpe  fvsl()a2ua(r oo1alxoif3iysfmDuanvo ()aetrifcoa1opDr uvi s) rxrio iodamt mfeslt)arumxront0ole mieiatlm2rl(monu4trerxo3oatomDranvo s  exm(opny4lle mncilt) Dtrx poo1aee  fcildfa2ean on(0alerir totoa rauesls0 eumir3oy1lme miei t sDtmxr no4tpto f3tysfm eauvp () rxrmo ootlaDeaieo ( srtmxm oudlpt mnctl(fsrta(mp;t0apxnif3tad m ul(msnu4tetoxfcoatfp eli ilt0tetr(mpio1oltemivsatf 2rrum ot0texo i3tyt m ea( s ()trerxr iydoaD  ivol()srtr(o ny1oltelncs () Dtrxrpot4alxn feils sDrmn o u0 reoxr tatopt ln o s)srum(mpno1oltn ics s) rraxmoou1aex ifeilsfs ulnmo (4aeeoxo tytlaDr n sls0srtr(m3nu4op  mies (fa2ur(  nt1aeeo o3iytfm um( p;t4aexnmocootla elneol( t2um(o3oy1ope mieil( sDrrumpot1teeniicilsla emuvs t) leoif ootfmteauei (0srur(o3nudoptn ivsas  2rm(rpnt1opto fciatls rlnvo t0altomf3oy1fpDraneo;s  rto(opiy4lle lfeiat  Dumxr ot0opeomoeias sDua(vonu4 rerxo3ta1fm e ueo;t  eto(o nudalen ivsls arra(root0aleoiiciltlmDem(monu) lxoxr3ia1fpt liei;()tetmxmpou4optn icta()arrauront1tpenmfeiyd aDum(vs;(4 lerxf3ia1lmD aivils teur(rpoy1ope  nes (f 2ua( p;o1opeoioeiys m2rl( p t) reoirciodfm  lieo;t)tetmiopiu4ap   iciltf rurxmpno0oexn i3tytfm2ul( p (0tlxomo oo1oateauvol(  rxmxmpiodomeemfet t)aDuaur nt1oltnioeiasfa emn s t0 leoxr tydomDeanvi ()s2trir3iu4lle lfetlt)aDtmxmp;o4apenmfetltfs rmn snt0altoir3oo1oatrln o;t)srxrxm3no1apenlfci (  rtrurpou1opxoiociltfaDemn p;(0 rxnircty1fmDrlu slt0sexrio io4omenmfcta( s2umx  no4oeeoiieilsfaDel( sn(4 rxrmr3io1lptrauvo;( setm(mpiudomeelnvs sfarrmxr ot0oeeo i3tatlaDua(mo;(4 rxnmo iytop e u o;s)setrxm3iydamtemnci tfs2tmur nu4oltomfciatls eanvo (4tltnxocta1fmD au s t srtrxr oo4op nmicsatfs2urx p;t4texnmf3iatfm emuvs;t4artoif3oo1oa  an i t sruoxrpoydamt lfetatfarrrump;o1tlxomieilslm2elumsnt0 leoif3iydfpDranvo s trtmir3iu1llt lfcsa( s2ta(rooo1tpxo oeilt sDrm( o u)aeeoxfcio1om r uvo;t)trxr(m iodol nmnesls)a2tru  oo4tltn ieilt sDrl(ms u4artnircoa1om  luvs (0 rxmiopou4lmtelnvia(  rtau p;o1oexo ieiysla em(vp u4arxoif totfp  ai s s) 2xrxm3nodamtelfcslt  Drruronu1texomictltfa el(mpn()aetrmrciydlp  aneo s)setrim3iudamte iciasf Dtrxm no1aet mo3ils a el(vs;t) reomo iadfm e uvi ( srxrio iodom nlfctas)arur(r ou0oexn fciysfs2uln pnu0tltnmo ta1la rluvo;t  2xrim3no4llt mfvsl()sDra(m ou4olt mf3iatlsDuan p t4aexrxf ta1lm eln o;s  2triopnudom emivtas a2umu oou1aetn oetydla rmu pn(0tlermociytopDeauvsl(0s2ur(r nu4omeemfei s  Dtm(mpnt0oltoifeilt s2emn s (0arermr3iatfmtr n s;s sexo(mpiy1lpt mfvsat a2umxr ou1aee iociytlaDuauvo u)aetoxf ta1fa eauesl(  euo(m3no1olenlnviasf rurxrp;t0aptn fetldfs el(von() rxrxfcoadfmtranvo ( trto(o3ou1altemfvtas)sDrrxront1alto o3iat m2raums ()treomo tydfaD  n ols)srxmir io4apte nvilsf 2rr(m nu4oetnmociad s2el(mo u4 ltnif3oadomDelieols texoiopny4omen ivsls) 2taxro;o1olxn i3tad a ea(vont0trtoxrcoy1fptrlivsl(0 2xmiopiudllen ieiatf 2uaum ot4olenif3tys a2umn ont)tltnmfcoatfa raieol(0 rtrio3io4llen feiat)s2ur( p;o4tlen ieilsla2ulums;(0arxrmoctatoa raivsls0s2umxopnu1amtelfvtl(f rta( p;o0tetomoctas a ul(mo ()artrio iatlat ln olt0t2toxo oy4lltnmivtlsf rrrx  ;o0ope mo3iltfa ran p t0aeenxf3todfmDelueol(  rtmiopiodaltelnvtas arumu  ;o0alt mo3tltfm ulnvs t4 rtrmr3tatfm r uvsl(  etoxr ou1lpe  ivils)a2trurp;u4oeeoio3iasfmDel(mp t)trtnmr3io1lmtelu ilt  rtmxopno1aptemnctat) Duaumo;u4aeeoioctltfsDuauvpn(4tlxrir totopDelivi;(0 2toio3iy1lme mictltfaDrax o;t0tle mictys mDuauvs;() leoxf3tydfptean sls)trxrxr iu1lmeemietatfsrrrumont1oltomi3tltlm2elumpnu4tlenio3iy1oa r ieo;s teurxo ny1amtnlnvsl(  rtmxr nt4tlxoifeiys m2rln pnt) leoif3ta1la  luvo ( s2tr(o oo1ale  fei tfa2rrum nu4apxo ietldlm uln s;u4aetomfcoytlpteaivo t t2urxm oodom nlfet ()srtax o;t0optomicild s2rl(vo t4tltnxfcta1faD anvsls)s2xm(mpoudlpte ncil(fa2umx pnt0alenmieiydfa2uanvsnt0altnxfciytoa e neo ( s2xmiopiy4ale mnci tf 2ur(moot1tltoif3ildlmDrmnvo;(4 rxoio3ty1lp rli ol( s2to(mpnu1ol e ivias  2um(ro;o0tptomietad a2el( snt)alenxoctodoa eauvi s0srxrxo3iudapt lnvtls)a2rmum oo0apxnioctltla ran pnt)texoxrctadlaDelueslt) rxrxm iodlmt lncilsfa2tru pnu4aex ioeiad a2ul(ms u0 exnif iy1lpDrlies (0trtoim oodaltnlfvsas)arrax poo4opt ifeiltfsDra(mp;(4tlermo3tydla  luvsls texrxmpny1olenlivsa(  2rrxrpnu1texn ieiydls um(vp u0 lxnmf tydfpt lu i;s0sexr(opoy4ame lieiltfarumxmonu4oltomf3ildfm raumo;u0 ltrircty1lpteli o;() rumxo oo1ll   nvi t a2rrxmono0aeeomictyt s2uau p;u0 etnmo3oa1om elneo t0setrxm3iudapteliesas) Dtmur no4tetnio3tldla2rmnvo u)arxnxr tytopD luvolt0 rtmim3nydamenlnviatf 2rrxrp;u0opeo fetlt mDem(vp t0artnxr3oatoaDrluvi s0 2triopnu4lptemncsas)aDum(moou4optniictltlm ul(vo u4 rxnmo oydfm e u i;t  ruo(r oo4optelivil(f rrrxrp;o1apenif3iat sDum(vsn()teermo iotfmtelieilt) 2umirpoydopt mfvsa() rumx pot4ape mietlslaDul( s;t) lxrif3todlaDrai o t  etm(r iudomee ivs tf Dtr(  oo4oltomoetltlm raums;t)trxomf oydlm rlnvs;t)trxoxo3nudopeemnvt t s2umum ;u4tlt  f3iys m2rmnvo;(0alxnmo3oatopD aivo;s  rxrxo3oy4llt liciasfsrraumo;o4altn fetlslaDrm(mpnt) eenxr3tytlaDeanesls  rxrxopoydaltemfes ()sDrm(m oo4texn iciltfmDelnvsnu0 rxrmo3iatla eau i s0 rtr(o3iu1lp n nvi s s2umxrp;o1olxnmoeiys a ul( o;u)tlxrxfctydfmt lnvs s0sexoxr oodop emfetls arrmxroot1opxoifeiad s2rm( o u4trxomf totlmtr ivsls)tetrio3oodlmenlici t) rur(mo;u1tlt mi3iys sDrm(mp (4 exrxr oa1omt aieilt)teumio oodap nmnvsa( arrru pnt0olt ifctldfm rluvsnu4texrmo3tytfp raieils s2xoxo ou4apt mivtl(f rrmuroot4aleomfciyt sDrluvs u)tlenmociytoa   ieil(0s2umxr3oy1lmeelivsasfa2ra(  nt4aet mfeilsla ranmpn(4altoxr iydlpD  nes;t0 ruoir3iodomtnlfct () Dua(  nu4tlt miciasfa eanmo (0arerir oatomDr uvs () rxm(rpiu4omt mict (fs2urx pnu1tet moctyt aDeau s;() lenxoctydfa   u i;s srurxr3oo1amenmncs t) rtmum ot1oexnii3ilsla2ranmo t0tetniociydfa r i ils srxrxo3iy4alen ncs ()sDtmur nt4tpen oeiltfa2elu pnt0aeenmo totlmtranvo;t)setmxo ny4alen nes t s2rr(ront0aeeomo3iadfm rmumsnt) eeriocto1oa eln i;s0teuoir nydoptnlfct (faDrau p;u0opt mfetadfa rlu s;t4aetoiociotfp elivs;( t2umxr iy1lp elnvias)aDrmx p;u0tle  feiysls ulump;t0 rxomo3ty1fpt lnei;t0sruo(m3nudlle  fvtlsf rumx ooo0ope io3iatlaDum(vo (4arxrxr io1opt ln o;(  rxm(m iy1apenlnetas)a2uaumont4opx  i3tas s ulu on(0 rtnmo3oatfpDran s;(0 eum(o ny4aptnlicia( srumuro;o1tetoioeias aDrm(vsnt4 exomr oytlmt lneo;()t2xm(rpiy4apte fctat)srra(r nt1alxoiictad s eauvp ()arxoif iatlaDraueo;t) 2xmxmpny1ame  fviltfs2raxmpnt1tetn i3tld a2rluvs t)artnxo to1opDeauvi;(0sexrxo io1ap  livt (  ruax  nt4oexo ociysfm2eanvs;t0tlxniocoa1op  aueo t0srtmxm ou4optnlfei ()sDra(r ou4opto feilsfmDulnvp;u)trxnifctadlp rai o s0teur(o3io4al nlfcia(fsDtrur ;o0opt if3ildfaDumuvpnu4 rxnir3ty1laDelu i;t setrio nudaptnmnciasfsrraxmp;u1teeo ictyslm emu o;t)arxnxociadoaDr ivi t  exriopnu1lltn iei s)sDumxr ;t1tetnmfciysls rln snu4 eermr iodfptranesl(0sexr(r oodamtnmfcils)a2rmxr ou4altn ieiytfs elnvs;(0texnxo oytfpDranvs t)s2urim iodop  mfetl( sDua(r ;t1aee ifciasfs2ran snt)aetomfcio1oaDrlnes ( srtmxo3oudalt  icslt  2rm(rono0tltoiictat sDulumont4tltnxr iotlm eluvi;()trtmir3nu1amtn nvtasf 2rm(m ot4opxnii3tydfmDeauvs (0tetnifcootfmD aueo ( seumir ou4aptn feta()srrrxm oo0olt  i3tadlmDul(mon(4alenif tadoptean s;()truoxo oydlptelnvias a2trx  ot4oetn fciyt mDua(ms t4 rxrif3oydfptrliei;t0srtoim3iodll n fciasfaruaxmpno4oeen iciydlmDemn p u4aetnmo3iytla eli s;s t2xoxm3nu4lm n neiat  rurxmooo1opxnioetysfa2rluvsnu4 lxnif3oytlaD  nvils0t2ur(o3iy4lltnmfcilt s2ra(m oo0aee  oeiytfm2ea(monu4aetrmf todfptrlnvils tetoio ny4lme mivsas)a2tmxro;u0teeo ictys s2rm(mon(4 rxomfciadlaD auvs;t0srtrim3oudlp n fciasfartm( onu4ole  ieiyt mDrlnvo;(0aexrxf iadfa ran sls)trtmxo3iy1ope  netls srraxr ot0tee  oeiadfmDrlnvp;u0arxrifciadfaD lu s (0 2umxrpoudlpenmfci s arurx onu1opeoio3tysfmDemu pn()tlerir oodfa rauei s trtrir oy1alt lnet t  rtrx pnu1aeenii3ilt aDem( ont0 exrioctodfp eaneo () ruoxr3oo4apt  ivs s a2rmumo;u4aptnmi3tld aDrmump;u0tlxomfcio1omDrlu o;s)t2trxrpnu1ope livta(fa2tr(m nu1tpxn o3tld s ea( o;(4arenmo3iotfaDranvo;t teuo(opoy1al n nvs s)srrmu  ou0apt ifeiydlm2rm(mp t0teermr3iadfpDeau s;() exrim3iu1olt  ietl( sDuax p;o1tlx  oeiltfmDemums t)aleoxf3oatoa e nvsls)tetr(rpoy1optnlietat) 2um(  nu1tlxo fctydla ulnmo u4 etoiociytomte ivils texrio ou1alte ics ( aDuru ooo1openio3iyt s emuvo (0texoif3to1latran s (0t2xrimpou1am n fvsat artmur nt0tlxoio3ias a rmnmo;t)arxrif oy1oaDean s;(0 2xoxm oy1ll  mnvtl() rta(  ot4apeoiociyt sDrluvpnt) lenmo3io1lpDran i;(0 eto(m oo4oleemiet (f Dtmxronu0tpe moeiytfaDra(vpnt)arenmo3ootlm elnvo (0srum(m3oo4al nmfeilt)artrurp;t0aex ifciydfsDran o;u0teeoxr tatfaD anvi;( teumim3io4om nmieias aDtmxrono0altomoeiytfm uau p u)tlerifcia1opDranvo t0sruo(o3oodome lnei t)srumxroot1opxomociltlmDuln ont4trtnmo3todomteli s t0srumim oudop eliesls)aDtru pou4tptnmocilsla2uauvo;u)aeeoxr ia1oa eai i (  exr(m3iydop  mfvtas  rurum oo1ope moeiadfs uanvp;t0trxrmr ootlptraueolt)s2to(m3oudlptemnci () rrrur ou4oetomfctad m2ulump;t4trxnmo iodomtraues;t)trxoxmpou1altnlnvsa(f rumu poo1alxnmo3iadlsDeau s;(0alxnio tytom  lnvils)t2uo(r iudlpeelivt t)arua(ront4olxo fctlsls ul(mpnt0tlxrmfciadoptranvol( seto(mpoo4op   ivtl(f Drmxm nt1opxoioeiadfaDul(vo;(4 exnif3tydla e nvo ()t2tmxm3io1ope  nctasf 2urx pno4aeto ociatfm2eau sn(0arxnmo io1opD  i sl(0tetm(r oydalt  nesls)arraurpot1aetoifetysls elumo u) eeoxo tatomteai o;s  rtrio iy1openlics sfaDumx pot4tlxoio3tlt a uanvs;t4tleoxrcoadlm r ies;(0texrir ou1oltnlfvsltfaDta( onu0tpx iicilt sDrl(vs;(4altoxrctydlmDr u ol() 2tmxr3ny1llt mnvt ()srraumpou0alt ifeiyslsDrmu s (4trxnmo iatoa   ivol(  2tr(opnydapeelfvia() Dtmumpou1tltoiictlsla2el( o u0trerxr3iy1opteaivil()trxmirpio1omeelneta( sDumxr ot1tpen fctltfaDuau s;()alxnxfcoatlm r nvo s0texoxo nodap elfviat) Drru p;o1apen fetatls ranms t0tetrxf3iydfmDe iei t) rxmxo ny4altnmnesatf Dumx  oo1tptoifeiatfs rm( s (4aeermf io1lpte ieilt)s2xmxo nodol nmfctl() 2rrxmpno0aeenmo3ils a ua( snu)artnmocoodopDrli olt0 rxrxo oo1op emiesa( sDtrumo;u0tptnifctytla2elnms;(4 ltoiociatlptr n o s0 rum(mpiodop  mfcsas srtr( p;o0oeenmi3iasls rm(von(4aetrmo oydlatr n o;s0trtoir io1aptn ietl( a2rr(mpnt4tlen oetlslsDulu onu)trxoifcoy1lmDranes;t0srxoxmpiu4op nlnvtasf Duaur ou1oex mo3iad a uluvp u)trxomo oydlmtrai ol( trxoxr iu1lm nmiesasfsDrmumont4tptoii3iys m2elu pnt)trtoxocoydoateauvol()srxoxrpiodoptnlnct t srtaumo;u0teeomo3iysls rln p;t0teermr3oatfat lies s0 2xm(rpoodlleemictlsf ruaurp;o1tltnmfciasla2rlnmo;(4 ltrmf3tatfptrlues s0srxoir no1al elnctat  rrm(m ;u4aexnii3tydlm ulu s;t)alenmo ta1faD lueslt)teurxopiu1ll   ieilt) 2umxmpou0olxnmfciltfmDeauvo (0 etrmf3tadlat anei s sexrio3nu4olenmfci (fa2ra(mpnu1apx ioeiad sDumnmsnu)treoioctodfa rau olt) 2xmir nudlmen fvs s s2rmx pnu4aexo i3ild m2emn snu4aetrif tadom r i ols s2xmxo3oodale micta(fs2taxrp;u0ape io3iysfaDel( sn(4tlxrxfcty1omDe i o;(0teumim nydllee nvs t) Dum(  ;u4tlen fctys a2ulnmp u4tltrxr oatlptr ueo;t) etrxm3iu4lleemnvt ()aDurur nu1aetomfeiydlsDuanvpn() lxnxr todomteaneo t trtr(o oudllen ncsas)sDururpnt4optnii3tyd s2um(msn()tlenxf3iytoatraivils0setmir iy4lptemncsa() rtmxmo;u4oltnmfctad m2emums;() rxnir3tadfa eln ol( s2xoxm3iu1op n fcsas)aDta(  ;t4tle miciasfm emu p;u)tlxnmocoa1oat au s;t seurxm iydopeemnvias)sDurx o;o1aexo i3iat s rl(mo u0aetoxr3iytopt anvo;( sexr(m3iu1am   feilt sDtr( ono1tetniieiytfs2ua(mont)aleomf3oy1om rlneo;t t2xm(o iy1omt lnes () 2urxmo;u0olx  o3ias s2umn p t0 lenirciytlpt anvi s  rxrimpio1lptnlicilt artrurooo1tpe ioeildlm2rluvo t0altrxr tydfmDraivs;t  etrxopno4op  mnctl( aDtr(mo;o0opxo feildlm2ulu o u4alxrxo ia1fpDranvilt)teuo(rpnudll nmiciasf rtmxrp;o0tlx if3ilsfa eanmpn(4 exnmr tadfmtrlivi;s0t2tmimpoy4amtnlnvt tf 2tmx  oo4tex if3iatlm2rluvs;t4tlenxfctatfmtranvo t) eumxm nodame mneiat sDta(mpou0ope  fctat m2rluvp (4 exrxo oa1faDrlu o;t s2toxm3ny4omee nvtas) rtau  nu4olenmi3ildls emumo;u0tlxnxf3tadlp  auei;t s2um(r3oo1alt livtasfa2rr(  ;u0teeomiciad m2rl( pnt)tlerifcio1lptrlues () eto(o3iu1alenmictl(f Drmx oou0oleo oeiatla ranms (0aleoio3oydom elivo;(0t2toir iu4apt mnviat) 2uru ont1tle  ietas aDrl(vp ()aexrxrciydlpDeauvols tetoio oudamtn nvsat a2ua(m ;t1oet ifctydlm2umnvs;t)alxrirctotfaDr nvilt)seuoio3oy1apt  iet tfaDrmxmpnu4ape io3iyslaDuln s (0 exnircty1opDraiei;t) eto(opnydamte nvi s)a2tmxrpnt0teenio3iyt s2rauvsnt)teeomf iy1op rli sls)seto(m ou1lp  livta() Drrxrooo4tlxoioctyt sDean pnt)arxomo iadlmtrlieo;s0t2urir3oo4ap  lnvsatf Dumxmont0apxnmoeilt a rmnmo;u)aetrif3tytfate iei;t) etoir iudlptnlnciatfs2tau p;u0tet mi3iadlaDranmp u0 eeomr ta1opteaies;(0seurxr3iy4lme lfvtat aDuaxrpot0aexnmfciltfsDrlnvp;() exomrciytoa rauvsl() eumxo iu4ap e fci ()sDrmx pnu0tpe  i3ilt a2ua( pn(0aexoiocoy1fmDelueils0srur(m3io1apenlies s a2urx pnu0oeeo i3ild aDuan p (0trtoio3oydop eauvol(0 rtrim3oy4ameelfcs t  Dtaxm ou4tltomociatla ean s;u0teenif3tatomD luei;t  2um(rpiudol  lncs t)sDtruront0aex  o3iltla eanvpnu4 reniocty1optrauvslt s2to(opou1om nlnvsat) 2uaurp;u1aeeo ictydfsDeau s t) lenmf oodomDr uvs s)s2tr(mpoodllt  fcias)aDumumo;o4oee ii3iysfsDel(mo;(4alxoiocoytom  lu s s0t2xmxopno1openlictas)aDur( pnu1aleoiicias mDeau o () lxrmfcta1lpt aueols0trtoimpoy4opeelivi ( aDtru ont1ape  f3iyslmDrlumo;u0trenmfcoatoateanvo;()seumim3nu1omee nci () 2umxr ou4tpxo oeiltla uanmpnt4artoxo oodfateanvi;() etmxr oo4ale  fci (fsDrm(r ;u0aetomfcilsfs2ranmp u)altrmf iadlm e ieilt0t2urxopoydomen feils)aDua( pnu4olxn ieiad mDumn pnu4 lerxr3oydfaD ai i t srtmiopno1olt mfciltfsDtaxro;u4olxn oetytfa2emuvs;()tlermrcty1lm e nvslt texo(r iydap elfetlsfa2tm(  nu0oee if3iadla ean ont)arxrmrctadfmt lu o;( s2toxo oo4ll elnci t)arur(mp;o4oet iicils sDra(mont4aexnxr oadoat  neolt)tetrxr iu1lp n fvils) ruaumpot1tle mfeils a2ranms u) lenxo ty1omtr nvol()sexoir iu1altnlnctlt aDtmu pno0tet ifetytfs2rm(vsn()texoirciotlaDe ues ( trxmxo3io1ameelieil()arrrur ot1olt ii3iysfm rlnvp;u0trtnxrcto1lp rlneol(0 eurim3iodlmenlict sfa2uaump;t1olx  i3iltla2emu ont0tetoxr3iotfm rli ol(0 2tmxrpoy1ap emicsl(f rtm(rp;u4texomieils m2emuvs;(4trtoxr oodfa  anvo;t0 exoim iydap  mfvils)artm(m oo0oexn fciltfa rmn s u0arxnmocto1fp  aivs (0texrimpiu1lpte fet s  Drrx p;u4tet mictat m2elnvp t0 rxnmrciydomtr n sls) eum(opoodop  mici () rua(ronu1openmfciad s2ranmo;()texrxr3ia1omD  ueo;s trtmxo3ou4lpee ncs (f 2rr(mpou1aetoifetlslsDemnvo;u)aetrir iatlpDeluei t)srxmiopiu1altelies (fa2rmxrp;o4aetnmoctytfs em(mon(4artnmr iodfa eai ols seum(rpoo4amtnmicsas srumu  ;o4ope mf3iad aDulnmsn(0artrxf tydfmD aiei ( trtrirpoo1alenmncs t)aDumu  ou4oltnmociydfm ulnmpnt4trermrcoatfptr u i;s0s2xmxr3nydalte ivtl(fsDurur nu0alt iiciytfa umuvsn(4areomr3oo1fa  aieilt0trxoir iydamt liesls)sDtaxrpot4alenmi3iydfaDelums;(0trerxf ia1fa  auesl( trumiopoydalt  netltf 2raxmont0ole if3taslaDea( pnu0 exoxo tadla eai i;t0truoir iy1amt lfci t)srtm(rp;u4oeeomfctydfa2em( on(4trxrio iadfa   ues;()srxo(opiodlltelivt s  Drmx pot0alx mieiytfa ul(mo t4aeeomo3io1opD ai sl() 2xmim oo4aptemfetasfa2tmuroot1apt mo3iydlaDel(ms u) rxrir totfpDr ies;()texrxo nodlle  fvsl(  2rrum nu1oee moeiasfsDum(mpnu4areoio to1fptrlnei;s0texmimpnu1oltn ieils s2rr(rp;o4aptnif3tatfsDuln p;u)alermfciatfptraues s texrxm3oy4ap  lietl()s2rrum ot4altnii3iydfs elums t)tlenxr io1fmt anvo;t0t2ur(o iy4lpe mivtls aruauroou1texo i3iat s ea(mpn()tetrxo totoa  li ils)srxoxm3iydap e nvils)srtau pou0opxnmo3iysfmDelumpn(4alenxo3iy1faDranvo (  etmxopnydllenlnvs sf Dtr(moou4apenmfetytfs2rluvs;u0 eenif tytoat  ueils0sruo(opnodal e fvtls  rrm( o;t0oltnmfcias s el(vo u)treomfcty1opDranvi;t)t2xrim3ou1ame lfet (farum(m ;t4apenif3tasfm2rm( p t4 rerxf todfaDe i i ()s2xrxo oydopenmfci tfsrrrxrpou1optomictys mDeauvs;(4aexrmf3ty1omtranes s) 2tmxopiy1llt  nctl(faruaxroou4tlxo f3tad s em( ont) exrmr3ia1lp eaivol() 2toxm io4ap  mneil(fa2tr(r nu4tpx mo3iysfsDemu ont0 eeoif oo1fm  au olt)s2xrxo nudamt lici t) Drmxm oo4tex  i3iytla umuvpnu4texomf iydoa eai sl()trumxo3iu4altnmncsltfaruaxm no0aeeoif3iat aDuanvsnu)aexnmf3oadlmtr i i;s srxm(m3iu1opt  fvi ()sDrmur nu4apeoio3iasfm uaump;t) lxoir oytfmtran o;s srxoir ou4amt  fesl()arumx oot1tpe mo3tatfs emnvp;(4arxnmr oy1om rluvo;(0s2xmxm3oy4al  mieilt  rtmumont1opxomictat m2eauvs;()trerir iydlpD lnvslt)s2urxm ny1lp emnctlt)s2umxroou4tlxomoctltfm ranmo u0 lxrxrctadopD ln o;t0srtrio3no1am  mfvtat)srrmxmpnt4aexnifeiyt s emu p t0 rtrmociy1lm r iei s)setrirpiudal e ivtat  2ta(mpnt4alx mfeiyslm ua(vs u)tlenmf ta1fatelivo t)seuo(m3ny1al  livt sf Drrxrpnu0opeo fciasla2uaumo;u4 rtrxr tytfptr iei;s)s2xmxr3iudlmtnmnetas  Dum( o;u4tpxoifciltfs emuvp;t)trxoircoadoa rlu i t)srxoxr no4om n netltfartmumpnt0opxnmociysfm rm( o;() exnxfciatopDean o (0t2xrim ny1apenmicilsf rtmx p;o0tlx ifeilsls2rauvon(4 rtomfciadoaD livol() rurxr iydlltemfvtat)aDumumoou4tlxo o3tasfs uaumo (4alerio3ia1fat ai s (0 ruoimpiu1optn fesa( aDum(rpoo4oexnmo3iydfaDulumo;u4trxrmfctodla raues s0srtr(r3iodll e fciat) 2tmxront0tpxnmoeilsfa uanvs;t0 rerir3ty1optrluvs;()t2xr(r io1alt  ivsl(faDraurp;u4apeniietyslm eaumpn() rtoxr todopDrln o;s0s2xo(m ny1ap emieiat)arrr(moou0tlx  ieiydfmDeanmo;t0aeenxo iydlat  n i ()teuo(o3oudlmenlictat)s2ta( pou4oeenifetasls rmu o u)trxnio ootlmDranei;t)s2um(mpiy1llte ivt (fa2rru p;u4oet  fctys m emnmo u)aetrir3iydomDean s ( trumirpoo1lptelictl( arurx  nt1alto iciyd s rl(mpn() rtomr3tydop rau o t teurimpiydopenmfct sfsDuaxrooo1olxnmiciyt a rmuvo (0 eermo3oatoaDrln o t trxmim nu4ll emnciat aDtr(ro;t1tptoio3ilt m elnmp ()tetnircoatlate ues;t0texmiopnu4ape lfci ( a2rrum no4ope  i3iltfa rluvs;(4 ltoir totom   iesls0 exm(opou4lltnmici s aDtrurono4ale  ociltlaDelump t) leoxociatoa r ivo t)srto(r3ou4ole mnvsat)s2urx ooo1opto ictas s2rl(msnu0artnmf3ia1oa rlu s;t t2uoxopnu4ll elnctl( srtmuronu1tltn iciysfmDul( sn(4alxrif3oatoat  uvs;s texmio oodoltnmfcs tfsDtm( o;t0tptnmfctadfa2eaumo;(4teerxr oydfm   uvi t0srtoiopnu4lptelivs s) rrmumont1oeen i3ildlsDelnmp u4texoxr oo1fpDe ieo t tetoxr3oy1ame licta(fa2ua(m ;o1tleo oeiatfs rmu pnu4teermfcoodfpt aivo;s)seuoio oo1amtn fvi (  rrmur ot0alt ioctldlsDuanvpn(4trtnifcoa1lateli ols)t2xoimpiy1ole  fci ( arrrxm oo0oltnmi3iysla rmums;u0 rtnio ootom  li o ()s2xo(mpnu4lpenliet sfaDumumoot1alxomoeiltlm2ean sn(0trenxocoytlpD livilt0teuoim3oo4oltnmicslsfartr(  ;t1ale iiciysfm2rmuvon()tlxrmo3oo1fmt aivi;s) etm(r iydlpte fct sf 2rmxronu0texo f3tld s2ran pnt0texrmo3iotoptrlnvs;( sexoio nodomeemfeslsfs2rrxr nt4apxniociasfa2emu s;t0 lxoxr iatlpteln o;( tetoim3ou4omeemnei t)srtm(r nt4aptoioeiydfm rm( s u4 rxomocty1lmDrlieslt)t2urxr3nudlpeelncs sfsDtm(r ;o4tlt ioctytfa2ul( p u)artnxfctadop eai s (0teuo(rpoudale  ics s)arumumo;t4aeenif3ilslsDeluvp t4 rtnmo iadlpD auei s0 2urir3oy1amt lfcilt s2uaxr ;u1tpt  ieias sDrlnmo () rtnio3iy1fa  aneol()s2tr(o3iy4al e nciltfsDumur ou1apx  oetatfsDemu p;u4arenxfcoatfm rli slt0 eumir iudlp elnesa(fartrxm oo0olt miciysls2emn s;t) rtoif3oa1la  lnvs t0s2um(opnu1op n nctl( s2um(  ou4tle ioctytfsDuanvon()tlxrmrcta1fateln ils0s2trxopoudlmeelfctlt)s2trump;o1oeenmietysfa2rauvp t4alermf3todfmDean o;t trxr(opiudamtnlfvs t srum(r ;o0aee moeildfs el( o u0aexomf oatlpDr i ils)s2trxo nodolenlici s arrm(mo;t0aee moetydfa2rm(vo () etoxo ootom  lneolt0 rtoirpoydal   fvils)s2taump;u0olxoiociys sDranvp;t4texnmo tytlmtraues s)tetm(o ny4ap nmneia( arrr( pnu0aexomfciasfa2emump u) rxoxr oo1om  aies;t)trtoxo3oudap   iviasf rtru onu0oeeo oeiltlm ra(mp;u4 rxnxociy1lmDeanvi;s  rxoiopnu4omeemfes ()artmur oo0oleomi3iysfa elnmsn(0alxnxf3oytlpDr u s s srumxm nodaltnlfvsat  rtr(r ou1oetn fciadfa2ranmp u0 eeoxf iy1fm  aies;(0 2ur(m3oo4op nmieilt a2urx oou1aeen oeiytfsDulu s t4teeomf3tydfm  lieil()s2xoxo3iodomt micil() 2umxro;t4olxnmoctls mDrmnvo u4arxrxocoatop   ivi t0srxrxr iy4lp emnvtas)aDtrurp;o1olto octyt sDeaums;u)trenxr3totlmtrlieils) exoio3no1lp n fvs s srrmxrpot4aeeoiiciadlaDum( pnu)texoxrcoytlpDe nvolt0 eumir iudlltemfctl(f 2tm( pou1apx  f3iyt aDelu o;t)trtnxfcta1fpDr ivi ( trxmxr3iu1lpt  ies s)artrxm ou4aex ifciadls rmuvpn(0 rxoxr oytlmt aivi;() 2trim ny1apenmicsa() rrmx  ;t4apt mi3tysfsDumuvo;()trxomf iadfa r i s s  etmiopiudamee nes ( sDuru o;o0ole io3tytfsDrm(mpnu0 leoiociy1oaDeanei;(0texoxmpoy1alen nvtl( srrm(r ;o4aet mo3tld a2umu p t) etnmf oadlm  ai i;t srurxm iu4olt mfvils  Dtax  ot4oee ioeiatfa rl(vo;() ltnmo3iydlaD ai il(0trumir3no1alenmieiat) 2ua(m ;t4tlto feiaslmDra(vp;(0arxrmf3totoa  auvo;t s2xmio iy4ole miei s s2tmur ot4teen oeildlsDuanvsnu)tetniociy1fatrlneol()s2urir3io4lmenmnei () 2trxmoot4oetoiociys m2ra(vo;u4 ltomr3oydfp  anei t0setmio3ou4ll nmnci s sDumxr ou0opto fciltfmDemn s;u0tlxnxf tatfp eaiei t0t2toiopnu4lle  fvtl()sDtm( oou4olxoioetasfaDrlumo u)trerifciydlpD  uvs;(  euo(m3io4lp emnetl( s2raumo;u1tlto fcild s ea( sn(4artoioctadlp eaiei;( t
\ No newline at end of file
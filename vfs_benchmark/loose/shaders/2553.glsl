@@ -0,0 +1 @@
+neo;(0s2xrimpnu1lmtelfci tf rurur ;o0alto f3ilsfa emnvs;u0aexrxf iatoaD  n i;s)s2uoxr3oudamt licta() rtmum nt1olxniiciysla2um(msnu4alxrmr3oytlmD li s;(0 2xmxmpoo4om nmivsltf 2tmxrpou4olt  ieilsfa2rm(vp;t)trenxf3io1op  auei;s0t2xoxo3nu1lleemfvs (fa2rru poo4aetomieiydfs ra(vp;u)tlxoir iadlat li o (0setmir3iydlltnmfcs t arum(roou1tpeo o3tytla rmnms;t) leoir oytlm ran o t  2umxopiodoptemfci () rra(  nu1oex mfeiys a um(mo t4 rxrxr to1oatrli s;()trurio oy4oltelfctas)srurxmo;o1teenio3iys m2rm(mo;u) rtoxfcto1fpDraneils)trtmim3iu4lle livs ( sDraurpoo1oleo o3iydlm2ulnmp;t4artrirctydop  lnei;s trxoxrpoy4om  lfcta( srtaxrpou4tlx io3iat s2um(msnt4trenxfciytom   n o;s0srtr(r3iu1altnmfciat) rraxm ;t1tleoif3tlsfa ra(vpnt4 lxnmo iydfpDelivo s0 eumiopno4amtnlivilt  2tax pnu0tee mf3tydfs2eanvsnu)trerxr3tatlptrau s;t  2um(r nydapen fvtas) 2taur ou0tet iocild s ua(vp u)arenmr3oadlmt ln ils texmxr no4ape lncsatf rur(  ;u0tpxoifeiasfaDuaump t) etoio3tytfa   uvs;t trxm(r ny4omtnmivi tfsrur(ro;t0alx  oeilt s uau onu0 lxrxo iatom eau s;(0 2tr(opoo1lm e fvilsf rurx ont4optomi3iysfa2rmuvpn(0trtniociadlm elnvolt tetrxopoy4opte iesls  2trump;o1apt ifeildfm2rmuvo;u4aexnmr3iodomD an s;s0 etm(r nudom n fvtl() 2ta(mpot4altnmfciys a uan pnt4trtnifcoo1lmD  ies;s)srxrimpiy4omtn fcil(  rtru  ot0alxnio3iysfaDulumo;t)aeeomr3io1fpte neo;t0t2xrxmpnu1op  mies tfartmu p;t1tltoiociysfa2rm(mp u)trerxo3io1lp  lu slt seumxm3oodameelfvt sfs2raxrp;u0tlxomo3tadfm ranmpnt4teerxo totlptr neo s)s2uo(o3oydlptnmfvs s  Drau pno0tptomiciyd s ean pn(4 ltoxf3oadomDr n i;t0seuoir3oodlmeemivs ()srrru pno1teto iciydfmDra(mp;()trxnxf oydfateli s s) eumxr3ou1olte iesatfa2rmx  ot4oexnmicilsfmDeln s;u0 lerioctotlmD aiesls0s2xrir no1om  lfvsa() Drmumoou0optomi3tat aDrm(vp t)aetrmo3todomDrluvo t)trxo(m3oodal nmncslsf rtrx  no1oleo f3iasfa2um( snt4trtnio iatlat aueilt)srxoimpoudaleelicias) 2rm(moot0tleomicilslm2umumpnu0trxnmociy1oatran s;t0t2xrirpou4lleemnvtas)a2rax oou0oetn icilslsDrauvpn() rxomf3totoa eaiesls)s2xo(m nu1alenmnvt t) Dtm(rpnt0oeeomo3ilsfm rmnvo u0areomfcoatla rau ol()texoir3iu1lp nmiesl() Dtax  ;u1tpt  f3tat m2um( o (4 etoxf3iydoa  lnvo s) exo(o3iodalte fvil()s2rau  ot1aleoioeild aDel(vp (4trtrxocio1fm rai o;s0 rxmio3no1al  mfctatfaDrmx pno4oee if3ilslm eauvo;u0aeermf3iy1fmteai i;t setm(r no1omee nvi (fsrum(rp;u0tlenmicildfaDel(vo;u4aetrxo iatfpDe i o;t  euoxr oydomtn nci (  rrmuront0aet  feiatfs ua( p;(4artrxf3iydlp rauvi s  rumxr oodopt lnes ()a2ta(mo;u4oeeomoeiltfs2uln o t4aleoir iy1faDraivi;s0 exm(o nydlm emnvtlsfarrru pno4aee miciad aDul(ms;()alxnmf3oa1op rlues s0teuo(r3io4oltnmnvtl(f Dta(rp;t0aetnmfeildls2eauvpnu4tetomfcoatlp ranvi s) 2xo(r iudomeemieiatf rtaxmp;t1aleo feilsls2ean o;()altnxo tytfmt anvi;( t2tr(opiy1omenmici (f rraxrp;o4olxnmo3tltfs2rm(vont4teeoxocoatlpDe uvols)seur(o oodameeliet t  Drau onu0olt mi3iysfa uln p u) rxoxfcoodfa e i o;() 2xriopno1ole lfvtat sDta( p;t0ole mociyslm2rlump;(4 rxniocoydopteli o;t0s2xmxm3no4amte nvtls)a2rmu  ou1tltn f3iasfaDrlu pnt0tltnmfciatlpD luvolt0 ruoxrpoo4omt mfcils s2rr(moot0aeeo ocilt s rlnmont4alxnio3oo1laD  ivi;t0s2uoxr3oydaltemnvta( s2ta(moou0aet mictlsfaDrlnmp u0arxoxociy1la   nesls  etrir iu4ol e iciltfa2rr(mont0alt moctatlm rmuvpnu)trxoif3iytlm rlu o t0trtmxo oy1lmt lfcsltf 2um(m no0alto f3tysfm2rln o;t4tleomo totfptr nvo;t) exrxr nydoleemivtas)srrmu  ou4alt mfetaslaDel(mo u0arxoif iodop  lues s  rtoim3iydopen fvils) 2rr( ooo1olenii3iasfaDuan p;t4trerif oa1omDrlu s ()srurim3iy1om emics s  2tr(mpot1apeo feilt m2uluvo;t0tlxrifcia1fpDrlu o t) exoxo oo1op  lnei t) Dur(m no4aeen f3ildfs2rmnvs;t)trtrif3to1faD  i i;s0srtoxopou4ll  lnctatfa2umxroou1olenio3tyd s2uln o;(0alxrxocoodoa r ivsl( s2uo(o oy1ole lieiasfsrtaur ot0tlt  fctldfm uauvp;(4altomocty1oat aieslt)s2urxo oy1om n ietat aDra( o;u4olx ifctldls2em( s t)alxnxocoa1om ranvslt0srto(mpnydlm  mncsl(  Dur(ro;u0apt mfciytfa umuvs () lenxf io1omD ln o;s0tetoiopiy1omeemnetls) 2urump;t0apx mieils a elu sn(0 ltrmf3iotfa  livi;t) 2urxmpny1amt  fvsa(fsrurxrp;t0oetniietat aDemnvpnt0tlxrxocoo1fa   nvi t srxrxmpnu1lpe  fctl()arrrx pou1ole mi3ilsla rl( o () lxrmo3oo1omD auvo () rxoim iu1apen ictltfa2rr(mpno0oetn fciyt a uanmsnt4 etrirciydlaD lnvsl(  rtrxr3iu1opt lnvilt s2umxr no1tlxomo3iasls elnvsn() rxnio oy1fm  au i ()seum(mpio4ape  netls)srum( ont0olxnioctlt m ua(mont)aexrif3to1fp raieo ()sexm(r3no4ll nmncils)a2tmur ot0ole ioetyd m2ua(mp;()teermfcoatfmD aueo;s  rtmxo3oo1lpeelfci s)s2um(m ;u0oex mi3tat s2raump (0alxnxf tytfm  aiei (  2uo(o3iy4op nlnvtlt) rrrx p;o1teen o3iyt s2em(vp u4aeenxr3tatla  lieo;(0 eurim iy1lp  lfctltfs2ua(mono0alt iietlsfaDem(mp;u) rermo oa1fatraivi;(0 rtoxmpiy1lleemivtlt a2umump;t1tpxnmieiydfs em(vpnu0aexrxfciodlmtrln s;t) rur(r3ny1llenmfcsat a2tmuronu1tpeomo3tyt m2rmumont0tetrmo ia1lm elues t seuoxm3io4lmeelfciasf 2rrxmp;o4tle mi3ils m2ua(mp (4trxrmr ia1lat anes;()sexr(r nodam emnes ()a2trx  oo0opxomfetlt m eaump t4arenmf3iy1om eaieo t0t2to(r3oy4lp e net s)a2tru  ;o1tleoiicildlm2el(vs ()trtnxo3iydoa eln s t)srumim3oo1optn ivs s) rrau  nu4olenif3tysfsDelu on(4trxrxocoatlmDranvilt tetmxopno1al emfetl( aDtmx p;o1tex mfciys a2rmumo;t4 ltnif iadfaDeaues t)trxoim3no4optelnvt s sruaxroou1tlenmfetat aDea( on(0aetomo3totlaDr u s;s) exrim3ou1omt lies sfarum(mpnu1olx mfetldfmDranvo;() lerxf to1fa  luvs t)trxrir no4altnmnct sfsDrrx  no0tee if3ias aDrmnvp;u4tetnmrciydfmDrau s;()setmio iy1lm  mfciatfaDur(m ;u4tlt mf3ilsfsDra(mp (0alxrifcoa1oa  anvo;()t2tmim3iu1om elneiatf Dta(moot4altn fctytlm umuvon()aexrxo3ia1om e u s t0srumxo3oo1lptnliciasfaDtmuroot1alt ifciydfmDrl( o;t)aetoxrcoo1oa eaivi;( seumir oo1am emnet sfs2umu  ou1teen i3iat m rl( o;u) lenif3oo1fpDr ivi;s) exrim3iodlpe lfetasf 2tmx  oo4oex  o3ils sDrmnvpn(4areomo3oydoa  luei;() etm(mpio4al   ici s)artm(  no4opeoio3tydfa eauvont0trxnxr3iytlmteln o ()teurxo nu4oltn ieta( arrr(rooo0tptnii3tydls ea(ms t0aeeoxocoatfpteln o t) 2urim oydlm  lfes tfsrtm(rp;u0opt iietysfa2umnvs t4tlerxf iy1lm eli s t) rtmio3nu1amt  nci sfsDtaxr no4tleo o3ildfm em(mo;()aeerifcoo1fp elnes s)srxriopiudop elfciltf Dumx poo4texomo3ilslsDranvs;u)tltoxr3oa1lp eln sl(0texo(r oodll  lieiat arurx  nt4tlt  fciysls elumpnu0 etomr3iotoat lies;() 2xo(r nodamtelfcslsfaruax pnt1tlxomicild s el(vp ()tetoxo totfa r ivs s)teumim no1ol   ivt s) Duax  ou4oeeo i3tlsls2elums;u0tlxnxf3oatlptr nesl() euoxm iu1omeemfctl()srtm(  no1tlx  icilsfsDrm(vs;u4 lerifcoodomtraues;t)setrio nydlme livtl( a2urx poo1oetnmoctyt a2emuvo t)aeerxo iy1lmDeaivol()trxrxmpno1openlnet t)aDrmxmo;o1tpt mf3tltls2em(vpnt4 rxoio iytla eaues;(0 rtmio3ny4aleemncias sDuaurono4oex  i3iadfm ra(mon(4tltnxfciodfmD luvo;s srtrio3io1ap nmivt tf 2raxmonu0apeniietad s um( on(0tetrir3oo1fm eanvs;t0 rxr(rpnodoltnmfvtltf 2rmxmo;u0aexnmoetys a2ua( onu4artrif tytfpDr n i;( trtr(rpno1lm   iesa( artrxmp;u0ole mf3tatfmDrauvp;t4trerxr3to1lp rluvo s s2trxo3oodomte nctat)aDraxm ;u4oet ifctydfa2ulumsnu0 rtrmo3oadlpte ivo t0 2xriopio1opt mfcil(fs2tax pnt4tle  i3iatfaDulums;t0 exomf oodfmte n s;s) etm(opiu1oltnlnvtls) 2tmxm nt1tlxn fetasfmDeluvp;(0arxnmo oodlatrli s;s  2um(r iy1om  mfcsls aDrm(mpou0apx  fctldfa umnmo ()tltnmfcoytfp r neil()sexrxrpoy1open ieilt srtrx p;u4opxo octldfaDrluvp;(0 rtnir3oydopDr uei s0 rumim oudlmte ivia() 2tau  ou0optn i3iysfaDumnmo ()teenxo oadlaD auvsl(0seuoxmpiy4lm nmivsa( aDur(m ot4tpeomfeiydfmDuaumsnu)trxrmr3ty1fptelu s;t) rtoxm io4lmeelnctlt  2ua(m nt4tlxoifetyd m emump u) ltrxo ootfp  livil() rxm(m no4lpeemicslt  Dtr(mooo1altn ociad mDrl(mo u4tlxnmr3oo1fmteanvi t)texmio3nodapen feiat  rrau o;o0oeto i3iydlm2rl(msnt0trxnif3iatopteanes s) rurxo io1llt lfci t srtmumpoo1oee ifeiyt m ranms u4 reoif3tydlm  au s ()setr(rpno1ap e ieiasfa2rmumpnu0oex mfeiad m2ra(vs t)tltrmfctotomtr neo s)s2tm(mpoo4amenlnei tfs2um(ro;u0tetnio3iydfsDelnvsnu)aetrxr3tytoaD ai i (0trtr(o io1aleemiet t)srua(  oo0apenmictys a2ra(mpnt)trtrxo oytfm ranvs;t)t2xr(r3oy1lptelfei tf Drm(r ;t1aeen feiysfsDrmumo () rxniocia1lpD  ivil(  rto(m3iydome  neiat s2ur( oot1texoiictydfsDrlnvo t)tlxoxr3oy1lpt lu s;t)trxrio3nu1lmt mnctltf rurur nt4aptnmoeildla2rln pnu0texoif tatfaDeanvs (0srurxm3ou4lpt lfvias srra( ont1tlenmiciasls2ean sn(4 etnmr oy1lpD  i s t0srtriopoo1ll emfcsat) Dtrxmooo0alto o3ild m el( p;(0 ltrioctadfm rlnes t0texrio3iodlpeelfei ( srrrxmp;u1optnmf3iysls umumsnt4arerir iadfmte ues;t  2uoxmpny1lpt  fctltfs2uaum ;u4tlt  o3iat a2um(mo ()aetomr ootoa elu i;s0 2xoim oudll   nvt sf 2rr(m oo0texn ieildla2ra(vpn(0aetoir3ty1om  aivs;t  euo(m3nodamenmics t a2trur ot0oetnii3iydfmDranms;t)tlerio3tytoptraiesl(0trxrxopnydol nlietls) Dtmx oot0ale  ieilsfaDeanmp;t4 rxoio ia1lmteau s (0 euoxrpoy1olen fcia( a2uax ooo1ape mf3ildlm elums;t)aeenxocoo1lpte iei s0 rtrir3nodam  livt ( s2taxr ot1apx iocildfs2rm(vpnt0tlxnxrcoydomt luei;t sexo(opou1ll nlnci s)a2tmumpoo1altomfctat a emu p () rtoio iodoaD  i o t0seur(o ou4ll   ictatfsDuaumoot1oee moetas mDrlnms (4arenmf oa1omDraivs;s0seumiopou4ame mieta()a2tr(rpno4alx iietyt mDemn p u4trxoxfcoydoa e u s;s  euo(r3iu4amt lnvslsfsDrax pot0apxomfctytfa2ra( pnt4tleoircio1op rluei t trxm(o3iy1om   nes ( s2rmum nt4oexnmfciydfs rauvs (4altoircoatop elnvilt tetm(rpnydlm nmfei ( artax pnu0tltomociyt sDrl(ms u0alxomrcoo1oa  lu il()texoxr3iudalee netls arum(rpot4tpx mf3iad a el(vo t) lenio oatop r n ols0texmxrpiudoltnmfviasf 2uaxmono1ole miciad a2uan o (0arenir oadfaD au o;t teuo(r3ou4omtnlfvsas) Dumx ono1aex  ociytfm2rmnvo (0tetoir totlptr iesl(0texm(opiy4lltelfei s) rum(mo;u1texoii3iys a eaums;u0trxoxr oytop eanvo;( srto(o oo4al   nvsl( artmu  nt1tleomo3tltlsDuanmo;u)aeeoxr iy1fp  lnvo (  rxrxrpoodol n nesa() Drrxm no4tpxomieilsfsDul(mon(0 rtrxociydfpt  ivol(  rurxo oo4aptemfcslt  2trxm no0alxomoeiatfs eanvo;u4tltnio3iatfpt  ivi s0sexoir3nodlm emiesl() 2tm( pnu0olenifciytlsDrlnvs u)texrxocootfmtrau ilt0s2toxopoydope lfctlt  rum(m ;t1aptnif3tys sDra(vsnt4aexomf ia1oatelneo s)tetmio3oodom  livi tf rumxmont1oltnmfeiyd a el( p u4teenxfcoo1fa   ieo s)t2um(opou4omtnmivtas  2rmxmpoo1teeoif3tyt aDelu s () reoif iadlmtelneo () rurirpno1lpee fcsltfa2rmxmoou0opxoio3tat mDeluvp t4 lxrxo ta1lp  li o;t0 eumio io1ap elfctlt) rraumo;o1openmfcild s2uau s;t0trenmr3to1oaDranvo s)s2xoxr ou1alte ieil(  Drru poo1opeo fetadlaDua(von(4tetoxo oodlmD  u i t0 2xmim3oy4op  lnvtasfsDurxm nt1aptnio3iatfa ean o;t)alenxfcty1omteln sls)setoio oo4lmee fei tfartau poo0teenmfeildfs2rmu snt)tetnxo3io1latean sls0 2xr(o no1omte ici t)sDurxm ou1opt ioeiydfaDemu o u4 lxoxrcoa1oa  livilt srtmxm3oo4ope micils srrru pnu4teenmf3tydla uanvo t) rxomr ootlm rai s;s s2um(rpiy1al   ncilt)s2rmur nt1apenioctas m rmnms t0arxnmfciy1faDe u s s0s2xmxo io4aptnlieiat) Dtmurono1tlxni
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;s0 rum(rpoodalenlfvt s s2tm(root1optomiciad a2uanmsn()arxnirciytfatr nvs;t0t2trxr iy4omt  icsltfs2raxmoot1oeen fcilslaDel( p;(0texrifcootfptraieols  eum(rpnu1oltnlfvtl(  2urxm nu0alx ifcilslm2rmuvp;t4tlenxrcoytfatr iei;t0s2urxr3oo4opeelnvil(fs2tru oou1texnmoeiyt a ea( p t4 eeoxo io1fa rlivo ( srxoio iu4amtn nvi sfs2raurpoo0apxn o3iadfs el(ms t0 lenmrcoytop r nvi (0 eurim3oy4ame  ics sfarumxm ot1tlxoioctltlmDrlums t0altnxf iodfatr ues;( texoiopoy1op nmfciasf rrmxrpot0aptn feiadfs emnvp;u4 ltnmo3iy1op rluvilt)s2ur(m nudoleemivi (faDua(  ;o4opeoiieiysfm2emumo;u0 eeoxocoy1opDrlu il(0t2uo(m3iy1ome lfeiltf rrmxrpot1ale ioeiat m ulu snu)teenxo3oatomt aivi;s0 ruriopoodom e fvi t)aDrr(  oo1teeomo3tyd a2umn pnt) lerxf3tydoaDe ues s0 exoxopny4ol  mfcilt arua(moot4tee mfeiaslmDrln snu0 ltnmf3oa1laDrlnes;( t2xrxm io4oleemieta() Drmxmp;u0opto octydfa2rau sn(0 lenmo3oo1lptelueil(  2xmxr3iu4omt mivsat s2rr(ro;u4tle if3tatlaDrm(mo t4tetoxocta1optrlnvol( t2trxo3ou4oleelfctls  Durxmpno0opt mo3iatlmDuanvpnt0texnir3oy1omt au ol()seto(o3nu4ol e ivt (  Draum nt1olx ii3tlt mDul(vsn()arenmf iatfm rlnvs;t0trxr(m3ou4opeemiet s) Drau o;o1open o3iysls ulu o;t0 etriocia1opDrau s ()s2xm(mpnodllenmfvslsfa2tmumo;o1tlxnmo3iysla ran onu0alermr tadlmDr nei s0trum(r nodol nmietltfaDua(rpnt0alen i3ildfaDel(vo u)arxrif io1fpDrlnvil(0trumxr3ou1altelietltf rum(mpot4alx mocias mDemumpnu4tlxoxr3ta1lm  lieslt  etrxo iodlmte nvsls)arrrx  oo4ale  fciaslm2rlnvont) lxomfciydomDeli o t teurxrpny4opt lfci (fsDtmxmpoo0aeenifeiatfm elumo;t0areomocia1op elnvolt0t2um(r3iudlm n fvsa(faDuaumpnu0tlx  i3iytfmDea( ont)tlxnmo iadfm  auvols)t2xoio3io4om nlnvs s)a2um(ro;u4olx if3iytla ra(vpn()aeenifciodlmt aivs t) rurxo3ou1lm nlnvt (farum(moou0teeo i3tys s2el(msn(4trtrmf io1lpDe ieo ()srxoio oo1ll e nvil(fsDrax pno1tlt iociatfm ranvon()areomfciytoatelu o ()seumir3nudal   nvs (  rraur oo0texo o3tysfm2rmumpnt)tetoxrctydlate nvol(0srxoir3nudope mfet tfaDrr(ro;u4tet  i3iyt m2umnmpnu0tltnio3io1lpte nes;s0seuoio3oo1ol  mivtatfaDta( onu4aetoiietatla2umuvo;(0 etomf iodom rln o;s  rtmxo oydapte nctas)a2tr( oot0olxo fciys mDraumsn(0arxrmfcia1lmDrlu olt0srtmiopio1lmt livtl(  Draurpnt4aee ifetldfm2uauvsnu4 rerio3oytlate i s t0t2xmxo no1lmenlnesat)sDtr(roou0tpen i3ilslsDrlu pnt4trenmr3ia1lpt  u i;t  2xr(r3oo1ap n ncia(faDtm(m nu0optn ietas mDeln p (4tlxoio iydfm rlu o;()seto(r3oodamte fvi sfaDua( p;u0olt mo3iatla elnmsnu0 rtrif3io1oaDelnes;()s2toim iy1lptnmivsat)sDta(rpnu4oeen ieilsfs ua(ms;t0arxoir3todfmteaneo t) 2urxm oudal nlnvtls  2umxroou0tpxoif3ild a2ea(vsnt) etoio3oydfp  li s;s)setoxm3nu4op nmnes tfsrtaxmo;t4aetn i3iys m2ulnvo t)texnxfctadfaD  uesls0 etoxmpnydal nlnvtatf rrrxmp;o1aeeo octlt a ua(mp u4 eenif3oytopD  neil(0 rtoxo nu4ol emnet t s2ta(r ;t1olxnmoeiatfaDrmumo;u0 eeoxo oatfmDr nvo;t0 rxmim3nudome lfvi t) rrrumoot1alt mociltfs uanmon(4aetnxr oytlmDr i o;s t2um(o3nu1olenlfcsa(fs2tmurpot0olxomo3tytfaDrmn p t4artomf tatfp ranei;s t2xmir no4lpenmiesl(fsrrr(r nu4alx iociatlmDua(vo (0altomf iotfa r uei;()s2xr(mpoodoptnmfetasf rrm(m nt1alt io3tyd aDrm( p;()trtoxf3ta1om  aiei t srtm(o3no1lpee ncias artr(rpnt0tlxomf3iltfm emums;u)tlxomf oytlmDrlnvo s t2tm(o3iu1lptnlnvsl(f rraxrono1apto o3tasfsDul( snu)arxnmrciytfa   nvo;t)trxrimpio1oleelieta(fsrrm( o;t1altomoctldlm elums;(4 exomf3todfmteauvi;( t2to(o nodop n nctls)aDrau  ;o1apx  fetadlm2uluvp;u) reoxr tytfp r uvols srxrxr oo4lp e ivias artm(m ;o0tlt mfctlsfa2uln p;u)trtrioctydopDe uei;t0teur(r ou1opt mfci s)s2rmu  ou4oet  ociadls2rmuvp;u) lxoxf3iodfate nes s)srtmim nydoltelncs ( a2ta( p;o0tpxomfeiyt s2eauvo t4teeomo3tatfmDe i il(0 rxm(r no4lle lfciltfs2rrxr ou1apxo feilsfs2uau sn(0 ltomf oodfptean ols0 ruo(m3nudlm e fesas)s2rmumono4aee iieiltls umnmp t0tlxrmr3ty1lpt  u o s0s2tmxopiodlltn ivsa(  Dtmxr oo1oee  ociyslmDea(ms;t0 rtrxfctotop raivi ()trto(m iudolt lfviasfaDuax oou0aet mieiltlaDrmuvp ()artrifcoy1lmDe nvs t0setmir oudaleemfcsatfsDtr(m ;t1apxnii3iysfs2eln pnt4 rxnmo3iatfmD  ivi ( trumxr iudlmte nvi (fa2umxrpot1tlto ietys m2rm(vp;t4 rxrmrcoa1lm ran o t0trurim iodome mfvia() Dtrur ou4olen oetltls emnms t4altoif3oadfaD anesl()s2xoxrpiy1lmeemivt sfsDrm(rpnt1optoifciaslaDrlnvont) eenirctatlpt aneo;() euo(opnudllte fetl( a2rr( p;t4aleoiociyslsDuaumo;u0 leoif3oy1lat  n o;s)s2tmxm oydapt lnvta(  2urx  ;t4ole mf3ilsfa emnvpn(4 lenxf3tydfmDe uvo s)s2xr(m3iy4omt micilsfsDum(ront1tlxn feiyd m rmnvo;()texnmr3iytfmte ieil(0 2tm(o3iu1om nlfvsl( sDtru o;u1aeeo fciydfm uluvo;u) exnxfcoydoa e n s s)texmxr3iydolee fviltfsDtr(rpou4apx  fctadfm em( p u4aeenif oa1late nvi ( srumir3ou1op elnetls) 2ur( o;o0tleoiietltlsDraumo u4artnmrctotoaDraivilt0s2ur(o iu1lm   nct () 2rrxmont4opt mo3iyd s2ran p;t) rtoio3tatoptran o;s teum(o3no1amee ictat)s2ra(ronu0aexnif3iys s2emump;u0 eeomo3iydom  lu s;(  rumxr3iodom nmfvs tfarrrxro;t4tpx iietydfs2elnvon()trxnxfcoytoat luvslt0 2xoio ny4olt  icsa(  rra( pnu4aee ioetlsfm eaumo;t4teerxfcoatlp eauvsls)t2xrxr iu1lpen fctas sDrax ooo1tpt  i3iltfm2ean p;(4 ltoxf3oa1lpt aueo;s)srur(o iy1openlnetas)aDta( ooo4oltn i3tasfs uan snt4artnmrcootom rauvo t0tetr(m3iudamt lieia() Dtrx poo0open iciat mDulump;(4trerxocoo1lmt li olt0 2uo(opiudlpt lnviltfs2urxmp;o1ale  oeilsfa2rln o ()arenio oo1opte n o;s0t2toiopiudaltnmfetlsfsDra(mp;u0aleniociydfsDumuvs u0 eenmo tadlp rau s (0trxo(mpoo4llte ieta(fs2uau o;o0aetoiictys s ua(ms;t4altoxo tytom eanvo s  2urxo oo4om  lies sfsrtrurpou1opxnii3tat m rau snu4aeermr3io1fpteluvslt  rto(m ou4am elfctat)sDumurono4tleoifciydfs ea(mo ()tlenmrciy1lptr iei ()srtmxo3io1amtnlnciat srra(rp;o4opx mfeilsfm2elnmp u)artrir oa1oaDean s ( texoxrpoo4amt lfeias srrmxm nt0alxnmf3iatls2umnvo;()tlxrxr oydomD auvi;(  2urir3ou1ope mnctlsf ruax  nu4oex mf3tltfa2rlu pn(0artrxo to1fmDr ues s0sexr(o iu4lm   icil()artmxmpnu1alt  i3iysfa2emuvo t4trenir3oadfpD auvs;( trumxo iy4altelivs sf rrau  no0teto oeiltlm elumo u0arermf3ty1la rai s;t) 2xm(r nudom   fcia(  2uru  ;u4tex mo3iytls ulnmp t) ltomo3to1oa e i olt)setmxo3ou4ame  fvsat) 2urxm ;u0tpxn ieiatfs em(mpnt) rermr3oo1lp e uei s0srum(m nodlltelivtl()aDtau oot4opeoii3tltlm ea(mp u) rxnmr3totomt anvs;(0t2urxr3ou1ap   ieta( s2trum oo0alen oeiysla elnmp t4texrmfctotfatrau ol(0 rtr(r3oy4lmtnliviatfarur(m no4tlxo iciytfsDemuvo (0 rtoir oo1laD auesl(  ruriopny1ol nmfes s a2rm(m no1tlxnmfeiaslm2ea(msnt0altnir tytfptrlnvi;s0trtrxo no4alenlnviat)aDumurpoo1aet  fciltla2rmums u4treoircoo1fateluvo;s0 exmxmpou1omeelictlt aDraxro;o1opxoioeiys s uluvs u4 ltrxo3to1fa  lnvols seuo(m3oy1ape  nesls s2urxmono1aeeo ieiys sDul( o (4teermrcia1lp  livo;( seumxr3iy4aleemivi s) 2tm(m ou0olxn i3iadfm ra( p;u)treomf3iadfpD livo;(0trxoxopou1ll  mfvsa(fa2rmuro;u1tptniociatlaDemu pnt0tetrmo oo1fptr uvi ( texo(opiodlp e ivs t) ruau o;u1apt  fciasfaDemnvo (0 etomocootlate neo () 2um(m3io1om n fcs t a2rrx onu1tpxnmo3iad s2uanmsn(0aeeomfcty1fmDelu s s) 2ur(r oy1lpeelivilsfsrra(mo;t1opxnmfciaslm uaums;t0alxrmf tadfaDr uvs;t)truoxr3ny1lm n iesls  2rrumoot1olen icilsla2ea(ms u4trtrmo3oydlp rli il(  2uoim oo4ole mnctl(  rumxr nu4olxomietadfs ua( on(4aeeomr3tydopt ai i;()trxm(r3oy4ope  fcta(fsrra(r ;u0tptomiciytfm2umnmo;u4arerif3iodfp r n o s0 exmxo3ny4ame lfci (faDrax o;t4tet iiciadfs uau s;t) eenir tadom  lu sl() ruo(r3nydlm nmfvtat a2umur ;o4olt ioetldfs ua(ms;u)tltoiociatlatelues s) rxmxo oo1lm nlfet t a2umxr ;u0aee  o3tatfm rmnmo (4 reoio3totlpt auvsls srxoxo nodaltn nvt tf 2rm( o;t4aexo oeild s rl(ms;u0 lenio ia1op eauvi;t0trur(m ny4olen feils)s2rrx onu1ale  fciadlmDrau pnu0alermo3ia1lptrauei s  rxrxmpoo4al  lfetat) Drr(rp;t1teenmieiytfm emnmp t4aeerir iatfm e ivs (  rtoxmpiodape mici ( sruaxmont4optnifctldls2elu p t4 lxoirctotomtrluvil(  rxo(m3iu1lm  mieiatfsrumum ;o0texo oetytlm eaumo;(0arxrmr3ty1lpDe ues (0 euoirpoydaptnmfvs ()srrmxrpot1aetn o3tydlmDran p;t4teenxf tatlmDe ues t trtm(m3iydll e fci s)s2ra(mpno1alen oeilt a em( o t0tltoxo ootfaDrli ils  eurirpou1llt lnctls  Dra(mo;t0tpxoio3iatlsDulnvs t0 leomfcty1fpD lies;s t2tmirpou4omtemneia() Drm(mpnt4tleo f3tad s2rlumont0aetnxfcoadoateanvsl( teumxrpiy4optelivtl(  2uaumo;u4oltoioeilsfs um( pn()arxrmociotla rlivol(0 ruo(r3no4op  lfvt t sDtm(  ot0oeenmociad s ea( s t4 etnxo iatlmtr nvslt truoio3iy4om nmnetat) Dtrur no1optnmo3iltlm umumsnt4artrxo3oadlaDrlueo s0 exmiopiu4am nlfeia()arrax p;o1aet iieiad aDrau o;t0areoioctodfa  lu s;(0trurxopnodole micilt s2tmxmpou1apeomictlt m2uln s u4aexnifciadomt au o;s) etm(mpnu1ll elnciasf 2rmxroou4opxomiciytfmDumu o t0alenif3oytfmtean olt srtoio3oodll nlfvsls)s2umu  ;u1tle  octydfm2ua(vo u0 ltrmociytfm elivs t0 2tm(rpno1ope  fcsat)a2umxr ot0opeoiieiyt sDelumo;(0 ltnir iatfmDe nvsl( texoxo oo1al   fei t sDrrurpno1ape ii3ilsfsDeln snt0tlxnmrcoytlmteaies;t seuoir3oo1lptemfci tf 2rrurpou0oex  fetytfs2uanmo u) etrxf3iy1fmDrau s ()trxrxm io4lltelfvtas)srtmu  ou1aetomfetldfsDrlnvs t4 rerxocoydfa rli ols0t2toimpnodolt mivsat  Dtrxmpoo1aptnifctyslaDrau o (4artrxr oydlm   nvs;s0srtrxr3oy4llenmnvslt sDrmur ou1oleo o3ils s2ua(mo;(0aeenirctotlaDrlueo t)setm(rpiu1ome  fct ()sDuaurpou1alx  ocilsfmDra(mpnt) exnif3iy1la rauvo;()truo(m ou4apte fetas)s2umx  nu4aet mfctydfs rlnvpnt)arxrircia1opt aivo (  2to(r no1lpee fcsl()sruaxm ;t4oex  i3tatfs2ea(mon(4tleoif io1op  lnvs s) exm(o3iudll  lnvt () 2ua(  ou4tex mfctydlsDeluvp () rerxf tadlmDelneslt trtoxopiu1lmeelnei s) rrrx  ;t4aexn fcild s rl( s (4 lenir3oy1fa raiei (0 eurxo oydal nmict (f 2rrxmpno1openmfciydfs2uan onu4 eeoiocoatlm rai ils  eurxopoo1amen fet s a2uaxm nu0aee ioeild mDrm(mo;t4altnifcoydopDeluei s  ruo(o3oy4lp emfvilt)a2ur(  ou4alxn o3iltfm2umu snt)trtnmr3oo1fa eauesl(0trxr(o3nudoleelfvtls  rraum nt4texnmictldlmDrl(vsnu0 rtrircty1lpDeln ilt t2xrim3no4al  liviat  2um(rpou4ole miciad m ul(mo u4 etriocta1fa rau s t trtrxo3iy1lpt mfvias)aDurxrooo0tptomi3iyd aDrlu o u0 ltomr3ia1lp rauvo s  2umxo3iu4apeelncta( sruau pnu4aeenmoctadfa2ra( snt4arxomo oytfm eanes t)texoxmpoy1amt mneta(fa2ua( pot0aleo fetytfaDeauvo (0arxoxf3oadfaD  ies t)trumio nodopee ics tfsDur(rpoo0opxoii3iys m2uanvo;() renxr3iytfpDeau s;s0setoxo3iu4apt lnctlt)artmxmpnu4altomoeiatfm umu s (4trtomociytlp ean s;() 2xmxopou4amtemicias)sDurxm ;u0alenmoetlt sDrmump;t4altnmocty1fmDrliei t)seurxmpno1alt lnvs t)srumxroot1olxn i3ildls2emuvp;t4alerxociotoptelueols srumxm iy1olenlfet t) Draurpnt1tltomfciys a2rmnvont0trermfcto1la e uvs;(  etrio ou4opt mfcsa(f rrrx p;t1apt ioeiatla emn pn(0 exomocoo1faD ai o s0tetrxr oydapenmfes ( arrax  ;o1oetnifeiys mDumnmpn(0teenmf ta1fp rau il(0seurxopoy4lp nmiet () Drrump;o4apenif3iad sDumnvsnu4teeoio3todlmtelivi ( trxoxopoo1ope  ici s sruau p;u1olxnmictld m eluvp;(0 lxomrcoatla ranvilt t2umir io4ol nlfet () 2tmx  ;o0tptn icild aDel( s;u4 ltnio3iodfat lu o;t)s2tm(o3io1alenmietl(fsrrr(  no4altn fciltfs um( o u0trenxf ty1opt aivi;s  2xm(mpiu4olee fcsls  rrm( poo1ale  o3iyt s ea( s;()aleoir3tadfaDeaivol( tetr(o3ny4ol n fesltf 2rm(r ot0aleoifeiltla2el(vs;()tlxomr3oodfmDrlu ol()s2tr(m ou4oltnlietltf rum(rp;t0tlto fciyd s2rmn pnu4arenxr3oa1omtran ilt0srxrxmpny1amenmfvi ()a2uru p;o4olxo o3iadfm2eauvo u4 exrif3ia1lmD aneo;( trurxm3ou1lpeeliet (fa2tmurpnu0teeomo3tysfs uluvs;u4trerio iytlpt ln i;(  etmxo3nudllen netlsfsDrax  ;o4texomieilt sDem(vsnu4tetrxf3iodlaDeluei t0 2umio3no1lmeemict s) 2rr(  no1oex ioeiadlaDua(vp t4tlxrmfctotfmD livi;s0tetoxr oudlp e ictl() rrau  ot4tltn iciatlsDrm(vp;u)tltrifcoa1fat  ueilt s2xmiopoo4altnlietat) Drm( ooo0oltnmociadfmDem(ms t0trxrio oadlmt  ieol( sruoir3nydom n ict t s2tmur no1tptnifeiadlm ra(vp u0aexrmfcoydlmt  uvol( setoirpnodlmtemnet s sDum( onu4tpxomoctyt m rl(mo;u4 ltrio tadlp  aueo t0tetmxrpnudomenlfvs sf rta(r ot4tlt io3iysfsDelumont)tltomr3tadop  lnes;() eumxopny1lm   icils)aDtrxrp;u4alxoiieiadls um( o (4 rtrmo3ia1lp eanvols0 rxo(r3io1openmfvs t a2tm(  ot1opeoii3iysfs uluvo;t0arxnio3oo1oa elieil(0 2trio3no4lme  fvsas  rtmxm ;o1ale if3tydla2eaumon(0aeerxf oy1omDr ueilt) 2toio3oy4lpe  nvi ()artrx  nu4aetomieiltfsDea( p t) lenifcto1omDe n o ( s2xmxopny1ope mivsa( sDurxm oo0olxo oeilsfsDrl( s;u) exoifcoytomDrln ols)texmxo3oodal n fes s arrmx  nt0olxn ociltlm um( p;(0 lerif3iodomDe u slt) 2um(r iy1ap  miciatfartr(m ;o4olt mi3iytfs rl(vo (0 rermo3tatomDr ueolt)t2uoxmpiudlme  ivta(farrm(mp;t1openmfetatlm ul(vo;u)alenxfcto1lm rlnesl(0 2uoir3io4ale  ictls)sDtaumpnu0aet mfeiltfs um( s (0 rerircoadlpDrli o (0trtmxm3iu1al elfviasfaDtm(  ;o4alto fciydlaDeauvp;(4 lenxr oatfp eaues;s) eumxo ny1amen nvsasf rrm( poo4apenifeiasfa2rmn o;(0 rtnifciodfmD aieo s0srum(o oodolenmnvsltfaDuru ono0ape mfcildls ua(vs;t0 rxrmo iotfm eai o ()srxoio3oo4op elnvsas a2raxm ou1tpxomi3iysfsDemnvonu)texrxr3iadlatraieo t0 2toxr nu4lltelnes (fartaumpoo0oee mfcildla2ra( s;(4 ltoif iy1fm  luvs (0s2toxmpnu4ale mict s)a2tmxr ou4aexoiociad a2em(msnt0 eenirctydfmDr uesls tetm(opoydlm  liei tf rrm( p;t1tptnmietyd aDuanvo t4teeomf3ia1la e i s t0srxrim3io4olenlnvtlsfa2tmx o;o0tee iocilt s raums (0aexnmo iodlmt anvi;()texmxm3oudopeemiesl( aDra(mpoo0texomi3tlsfmDrl(vs;(0aexrxf3oa1fmtr neolt s2xo(mpio1am elfcil(fa2urx o;o4tleomieiltfa rl(vpnt4teerxo tydop  livi;(0setrxopoo1lltn nvslt)s2rrx  ;t0tptomi3tydls emu p;t) rermo tatomt ai sl( texmxr3ny4lle  ictasfsDtr(  ot4tpenmiciatfs ea(mo;u)tlxoxo3todfmte i i s)sexoxo ny1ol  lfctasfarra(rooo1tlt  iciadfsDul( pnu)trtoxr iadom   uvi;(0srxoxm3nu1ole lfetas)arrmxr oo0oleomoetydfa rau p;(4 lxnmo3io1la  ln sl()trxoxrpno4llt licsa() rtaumo;o4opx  ictasfm2umu o u0 lxrio tadopte n ol(  rum(mpiodlp emnvsa() rra( ont1tet  oetad s2elnvonu0tleomrcto1omteli ilt)s2uo(o3oo1olee ivsls sDrm(rpot4opx  ieiytfa2rmn s;u0 exoxo oo1fptrlu o;s trxmxr3nodaptn nvil( s2ra(mp;u1opxo fciydla2umnvs u) exrxr tytoa  anes t) rumxr ny4lp e feiat)srrmx oot0aet mociltlm elu o;u4areoxo3iy1laDr i i s0 rumim iodole mivs s a2rmxmo;o4tlxn feiyslm elnvpnu4 eerxo totlate nesls trxr(m3ny4ll nmnvtlt srumu pou4tex ifeiyslmDeanms (4 reoiocoydomD luei;t0srxrimpoo4ome micils arumxmp;t1opxnioeiadfs uan o;(4artomr iodoatelieo;t0 2to(m nodopee feilt)aDtrxm ;t1oeeoiiciyt s2ulnmsnu0artrifcoytoaD aueolt sruoimpno1omen ivilt s2rax pno0tlt ioetys s uan pnu0artnmr ootlpt lnvsl(  exmio3ny1lp nlnvsa( s2umu pou0altomo3tatlsDelumon(0trxoio3iydoptr ies t0 2xrxo3ny4ome lnvsls)a2rrum ;t1aet if3tydfmDuaums;(0trxnmfcootomtelivs;s  2xoir oy4openmfvi t) Drrxm ot0openmoeiyslaDemums t4altomr oydop elivs;t)sexo(r iy4am  mfeil() 2ur( pou0teeoifetltfm2el( s;t) etnxf iodoptr n il( tetoio3ny4lp nlnesls) Dtmxrooo1altn fciad a ra(vo u4altoxf3ootom r ieo;t0teuoxo no1lme liesl() 2tru  ;o1alxniictls m2el(mo u4tlenmocootoat aueilt0seurxo nodaleemicil( s2trur oo1apxn oeiatla rln s;u4 eenio3tytfp  luvi;t)s2tr(r no1oleemivtas)s2rm(moou4tex mictltfs eaump t)artoxr oytlmte ieo;s0teurxr3nydaptnmicsa()aDrmum ;u4oetoiietlt aDumums;t) etrircootop  ln o t0s2xr(r oodome lfcil()aDta(r nt4apen i3ildlmDemu p u4treomf oa1oateau o s)srxr(m no1alt  fct t)sDtmu oot0ope  ieilt s em(vo;(4aetrmf3tadfatrlies () exoimpoydlp n ivi t)sDtrxrpou4opx  feiadfa2ul(msnt0 exrmf tadfatr nei (0seurxm3iydom nmfvilt sDrmx  oo0olxomoetld s umump u) eerir io1fmD aneo;(0trtoir3nu1lpe  ieslt  rur(mono4aee  fciytls2emu onu) ltnifcia1fpte uvsl() etr(opiodome lfes (faDur(mp;o0aeeoioetat aDuln s;(0aetrmrcia1oatelivol()srtoio ou1optemfetlt aDtru o;o4aetn icilt sDelnmp t4artrmo3oa1fm e uvo;() exo(m iudlpenliviat s2rmxr no1aexo fciltfmDul(ms t4tlenmr oo1oa raieolt  rum(o3nu4ll   icilt) rraxmp;o1teen o3ilslaDrln ont4 etomrcoytlp  anvs t  ruoim3io1am nmnes t  ruaxmpoo1oeeomoetldls umnvp (4aeeoio ty1omDe i s (0 exrimpno1aleemfcilt srtrumpnu1oee  o3tysls ea( s;u)altrxocoa1laDrln ols0s2xm(r oy4lp nmfvil(fsDtmu o;o0tpx  i3iysfa2ul(mpn(4 rxoxfcia1fmD li i t) ruoimpny1alte nvias sDra( pnt0tee  fctatfsDumu pn(0aetoxr ia1oat livo;(0s2urio3oo4lleelfei s s2um(moot4opeoiociyd aDranvonu)altrxf iodfmDrlueols0trur(r3iodlpeemies tf Dtaxm oo0oetoii3iydla uanmo;u0alxoioctatla eauvo t s2uriopno1amen neiat) Dra(  ou1tpxnifciatlm um( s;(0aetnmfciy1fpt aivi t  rxriopny4ope mncs t)sDum( o;o0tex ifcildfsDelu o t)trtomocia1lmDr i i;t setrxo3oydll   ict sf rraxr ;u1aee mf3iytfa2uaump ()altrio ty1fa   nvi ()sexr(o3no4lmt liciasfaDraxrooo4tpe  f3tld a2ranmont0tetnif oa1lpDelneo t)setoxr3iudape mfcilsfaDuaxmpnu1tpx mieilt m2umnvp t4 lxoir3tatomte u o ( trurxopiudolt  ictls)aDuru  oo1alt  o3tad m emnvo;t) eenxf3iotoateaues;s0 etr(mpiydaptemfeils s2rrxrp;u4tlxomf3ilsfaDulnmon(4arxnxrcto1oatraivsl( seumxo nydom n fci t srumum ;o0tptomo3tasfsDrmn p (0 rerif3ootoatelueols)t2xr(rpiy1lp nlnvsatfa2ta(root1olenmicild mDranmo () rerio3ta1fm   nvol(0seuoxrpoydam nmfvias)sDuax pno1optnmo3iyt s2ea(vp;() lerif tatfmD luvi (  rtoio iudom nmnetls) Drm(mont1altomietysla uanmo (4tetrio ootfp eaivs;t0srtmxrpiu1llt lfeilt) rtrum ou0opto f3iytfa ea(ms;u4trerifcty1omt auei;t s2uo(o3io1am nlfctls)s2rru pno0texomieils aDea(mo;(4tltoio oodlaDr ivi s0t2xrio3iy4op  lncil(  rra(mpnu0aet mi3iytla ra( pn() eenmr3tydopDeaivilt)truoxmpiydlptnlneia() rtmump;o1tpt  octad s2umu s (0 ltomr to1lpt luvo;s texo(o no1lm  liet ( arrr(mont0tpxniictadfsDelump u) rerirctodlmDelnvo;(  rxoxr iudlpenmfcs ( s2ta(mpou0ole io3iytfm2eauvo t0trerxrcto1la rlueo t)seuriopoudol n nesa( a2ur(  nt0opxnmfeiyd sDran o (0aleomo3oo1lmt  i sl(0trum(r3oo4omt mnvtls)srrrxm nu0aee iociyd m2eluvs t4teeoir3tytoaDr n i;s0s2ur(mpou1lp n fcsl(fsDrrx pou0aleoiictydls elumo u4aetnircoydfaD  i s;( s2xmiopoydame  ivs tfsrta(mpot4tlt ifeiys sDul(mp t)areoxo3tatfp e iei;s0s2tr(opnu1llte fcsas aDra( pnu0aex  ieiad s2el( s u0 exoxocoatom  au olt)sexrxopno1amt lnvtat aDta(rono4tpt  oeilsla ean o u4 ltomrctodfat lnvo s)s2xmio no4om  liesas srumu  nu4olxoiieildlaDea( s;t4trxnmocoodfpteaivi;s0 rtr(o oodam  mnvil()arraxmoou0tleo fctydlm emnmp;t0altrif todoat auvi t  exoxo3iy1am  mici tfsrumur ;u0opeo ictad a2umu p;u) ltrif3oydomtrlivs t  ruoio iydllt livtl(  rtax  nu0aetnmfcildfs2uau o (4texnmo oo1omD ln o;(0sexo(r3iudll  lfctl( a2umx o;o0ope  feiys sDelnmsn(0texoio iadoaDr uei;s) 2tr(o iy1lpt  ncslt) Dum(r ;o1altomfciad mDemn o u)trermf3ty1oatelnvs;s0teuoxr3oodlmen fvi ( srtaum no4opx  f3iysfm ulu o t)aetrif tadlmtr uvs;(  2umxr iudllenmfci t) rraxmoot4apenmieiatla rm(ms;t4 ltoxo ty1lm eliei;s setoiopiodllt  ici t) Dtmxmp;o0oexnmo3ildfs ua(mp t4 rxrmo ia1omte u i;(0s2xrxmpiy1lpee nct sfsrtm( poo1aetomi3ilsls2elu s;u4 ltomf3iydoateliesl() 2tmirpoy4am   ict t) rtaur nu1opto oetltfsDua(msn(0tetrir iydfp elueol()s2uoirpno1ap n fci () Dumx  ;o0oet iieiatfm2elnvp;u)arermo to1faD lies t seur(m io1lle mnesat  Dumumpnu4alxo o3tysfs umnmo (4 eerir oa1op e iesls0 2toxm3no4ol  mfvilsfs2tmx p;t4alt  f3tys sDrmnvp;u)trtnxrcoy1lpD  ueil()trtmxm nydom e nvs ()arrrx pou1tpe  o3ilsfaDuaump;t)trxnxf3oydlp r n il(0srur(opnu1aptnmfvslt artr(ront1tleoioctlt sDeauvpnu) exrxrciy1faDraneils truo(rpno1lpt mfvi ( a2tr( ont4tetoiietldlaDrl( s;t0tlenir iotlm  aivo (0 etm(r iu4lptnmiviat)s2ta(r oo1opx moeiydla2eanvo u)texrir to1fatr iei t)tetm(mpnu1ll n ncta(  2um(mo;t0olx if3tatlmDrlumpnu0aexnxfcoy1faDeluesl() 2trxr3iodom elfvi t)aDrru  ot1tlx  o3tytlaDumn sn(4aetrmf iodom  auvo;(  exoio ou4ol  mnctlt  rua( pnu0olx io3tldlm2rmu pnu)trxnxo tadlmD auesl()t2toio3no4am nmfcsls a2raxr ;u0tlx mieiys sDulnvs;() lermf3iatoat liei (0setoim oodoptnlicil(  Dtm( pno1aptomictyt aDemnvsnu0aeeomr3tadlptelueo;(0t2to(r oudolenmnetls)sruaxr no0altomocildfmDuanmsnu0altoio3oodoa r neols t2ur(rpoo4lltn nvsltfsDtrxm ;u1apt ifcild a rmnmsnu4 ltrxr3oy1fatraueil( trur(mpio4lpeemfvi t  2uaxroou0tpeomi3iys m2eaumo t0altnmrciotop  anes;s0s2uo(opoy1alenlieslt s2uaxm ;u1oeeo fciydfmDulump t0tlxnmociy1oa  ai o t trxoxrpiu1lltelnesl()arrrx o;u0tleoiiciydfm2uln sn(0trenxrctadfm  luei t)teur(o3nu4ap nmict ( aDrr( oou0opxoioeias a rmnvp u4 leomr oadfpDraiei;( trtrir iy1lmen ivsatfaDtr(mo;u1apeo fcilt mDeau p;t) rtnir iotop e nei (0srumim3iudlltn nvtas aDrmurp;u1olx  i3iasfm uanvo;u)tltoif3io1omD li s;t) 2xrxm iu1amtn fetas srur( onu4open o3iytla2rluvpn(0areoircoy1lmtelnes s s2ur(o3ou4alt lics tfsruaxm nu4tpt iictasla rmu s u) eeoxf oy1lm eauei;(0 rurxr3io1omenmiet t)srraxmo;t4tptniieias s2rmuvo t4tetomfctytlateai s;s s2toio oy1olee ncsat)aDtrur nu0tpto ieiatfa2uluvs;u0 rerxrcty1la  aues (0sexo(r io1lpeelfcil()a2rrum nu0aexnmf3tls aDulu pnu0 reoif3oo1laD  nvs s0seum(m3ny1lp emneias  rrmurono0oee  ieiad sDum(vo u)artoxf tatoaDeln s;()srtoio3ny1lm emici (farraxm ;o4ole  ieiytfmDemuvo;t)trtoxr iotoaDeaueo (0setrio nu4lmtnmneilsfs2ua(ro;t4opt  fetytla rlnvonu4teermfcoatlpteli i;t)seurio3iy1ol e nesl( srtaumpno0tlt io3ild mDemnms t) etrxrcio1fmD li o;s)srxrxrpoydlm   net ()a2uaur ;t4oetomfctls a2rmnvo;()artoif iatfptr u i;( sexm(r3ou1am  mfeias)srurum no4olenmo3iatlmDuan pnu)aleomrcoodoptrli s;t0setm(m io1lpeemnvsl()a2trxro;u1aptomo3iasls2uau p u0 exoxf oydlat  iei;( s2urirpno4amt lnet ()srraxmpnt1oleomf3tysfaDua(von(4tlenifciotoaDelnes (0tetr(m nudaltelncia()aDra(ro;t1tltnioctasfm2rmnvo;t)trxoif3oo1lpDeluvo;(0 2xoim nu4ap nmncsltfsrumxmoot1aeeo f3tls m2eaums;u4 rtnxfcto1fmD  u o;t0 2uo(m3nu4lltnlnei s aDrr( p;t1aptnmoetlsfaDulnvs;(0aeeomf to1fp  luvs s teumxr no1om  lietls sDrmxmoou1olt moeild a2eluvp t0 eeomr3iatfaDrau i;(0srumxrpnu4alenmnvsat  Dur(mp;t4tlenmoctlsfa rmump;u0areoxr ia1lmDran i;t t2umxr oydaltelivt t s2rrur oo4ape mieilt a2rm( snt0alerio3oytoa  auvi s)srurio iu4lp   ivi s)sDta(ront0ope iieils sDumnvpnu0 ltrxfciotfa r i o t0 rxr(m no1om   ncsa(faDum(rpno0tpe io3iaslm umn p;t0 etnmf3tydla  ln o;(0texmiopnudapeemfes (faDur(rono4tet  i3tls m ulnmsnt0 ltnmrctotlpD ln s;t0s2umxo3iy4opee fesltf rtruro;u4oeto fctas mDeln snt)trxrxf3iy1fmtrau i s) exmim3nu1alt mfcs (farrr(rpoo1tpx  oeiat m el( s;u)altnmo3tatla   ivslt)sexmir iu1ap n icsa()srtmxm no0tptn i3tld mDem(vo;u0 rtrmociadfaDe uvs ( t2xoxm iu1opeelfesat  Dumu  ;u4alen ieiytlaDelu o t)trxomrcoatla  aivsl( seumxr no4lptelnet t s2taxm no1tetomo3iytlm2ra(mpnt0arerxo3tadlmDelueo s) exm(m3oydoptnmfctl()s2taumpot0open fetldla uauvonu4 leoxr iy1fpte ivsl(0 etoxr iydlleelici sfartmxr ot1aet  feiysfaDeauvo;(0 ltomr iy1omD  ivi t t2xm(opoudlltnlicil(  rtmx ooo1apx  feiysfm2rlnmo;u)artoxo tytfpD lueil(0 rumirpou4aptemfvia()artax  no0apx  feiyt s elnvo;t0tetoxrctydlm eaieo;t s2xr(rpnydllenliesat)a2umur nu1aexnmietldfs ulu p (0altrir oytop e nes;()trtm(mpnu1olen fct s s2raxront0aeeoifciysfsDrm( snu)alxoio oatoptr neo;s  2tr(r3nydole lict tf Dur(ro;u4aptnmieiltlm2emuvo;(4alxnxo3iotlaD ln slt)sexoxopnu4lpte netas) Dtru  oo1tpxnmi3iydla2eanmp;t0aleomf oadlmD  nvilt0 rurxm oudame lnci (fa2ta(  ;t1aeeo o3tys sDra(ms (4artomociytfmt ln ols0 rxmxmpoudop emivtls)sDrm( ono4texomfciasfsDumu o;t4arxnif3todlp  auvilt0teuoxopiu1optn neta( s2ra(r ou4aptniictadla2umumpn(4tltriociy1lmDe uvols setmxmpnodal nlfctas) Dta(mono4oeenio3tlt s2umnmpnu) rxnxr3oytfmDelivsls0sruoxrpnu4lmenlietls) rurum oo4tetoioctlt sDrm( onu)tetomf3iotlp   nvs s) eurxr3io4lpt  netat)srtaxronu0aptn fciytlm2um(vpnt0arenmo iy1fm rli ols)teuoir iodll emfvi (fa2umuronu4apx  ieiydfs2em( o;()altnif3tatfpDrli o;(  eumim oydomenliesatf 2ta( ono0teeoiietytfsDem( p u)aeeomocoodom   i sls) etoxm3iu4lltemnvi t  rtm(rp;t1oeto f3ils a ua( snt0artrmrciotopt  i s;(  rtr(m3iodole lfeia()a2urx o;t0alxnmiciydfs eanvont)arxnxrciotfpDr n s ( trtoxr3iudlmtnmivs tf Durxmooo1open ictys a2rm( s;() etnxf oydfate nvo;s0setoim3iudal  lfesl()a2rm(m oo0tlt if3iyslmDeanmont)texrxr ootlmD auvsl()sexmxm3io4am  mics () 2rax o;u4oltomi3iysfaDra(vsnt0aexnmo3totfat lnvo;()t2umio3nudol   ivsa( a2tr(rp;o0oet  feiasla2rln onu4 rtrmo3iydlptelnei s) rtmxm io4aptn ietlsf 2umxrp;u0apen oeias aDemums u0trxoxo ty1fa rauvi;(0sexoio oo1lpen fctlt) rumxm ;u0aexoiiciasla2uauvo;()aexnirciodlpD aueo;s0 2xoio3nu1alenlnct tfa2rmxro;u4tlt  fciadla elump;(4teenif3ty1lpt luvolt0seuoimpoydlpen ncsl(fs2ta(m ;o4teeoif3iltlm2elnmonu4aeeoircto1fm e nvi;( tetoxr nudlptn fvs sf rum(ro;o0tlx  fciysla2eau o t0aleoio tydfatr u s s0srxr(mpiu4amt  ivils)sDta(mpou0apt iicildfa2um(mo t)altoxfctotlmDeanes;( teuoir3ny1lmeelnciasfsDtau  no1tlxniociat s raums;u4aexnmocoatlptran o s0 exm(mpoydop nlnet (farta(  ou0tex mfeiadla2uluvo;u4 lerxfcoodlmteluei (0sexmxmpou1lleelict t  rtru  ;o4tltoii3iad a el(monu4areoxo oy1lmt auvsl(0teuoxr3iudom  livs ()srrru pot4tltoiieildlm umn p u) etomrcoydlaDraivo;(0t2xrir3iudomtn nvtlsfs2trurpou1tee mf3ildla umumpnt0 eenmfcoadfate ivil(0 etr(m nodlpe lnei t arurxmpnt0oltnmociasfa emn o t) etoxo tadfmtrlivs;(0s2umxr oy1lptnlies s  2rrxmo;t0optomoeiysls2rlnvpnt0alxrmf3oodfmDe u s;t0sexoio ny4amt lfetls  rtaxrpou1altn oetas a elnvo;(0aeeoxo tadomD luvs t) exm(m3oodal  lfcs tfartrxr ou0ope  fetasfs2raumont0altnxf3oy1lmt li i;t0 etoxrpnodll nmncslt srraxr ot0alto o3tad s ra( p;(0tetrxf3iodfaDeaueol()t2toirpoydlmtelfetl(f rtm( ooo0oeen fcildls um( o;t4tlxrirciotoatr neo;t)s2xmim no4lmeelnvs () 2tr(r oo0aexnifeiytls2ra(vp;(4arerxr3iytlmD lueo t0 rxrir3ny4op nmietls artaxro;t1tlxoioeiadfmDrmnvp (0alxnioctatoaD  ues s  2tm(o no1lp  mfet (fa2tmumonu0oeeoif3tltlm2elu pn() rxnio3iotfatr ies;(0 rxmio3oydlpenlncta( sDum(m no0tpx  fciaslm uaumo;t)alxrmrctotoa rln i;s  ruo(o oodlmtnlnetl()aDumuront0oleoiocils aDra( pn(0tlxriocta1oaDelueo t tetoim ou1opee nvslsfs2um(r ;o1oleomoetatlsDumnvont0tltnifcia1lm elivolt0seumirpiu4optn nctat s2rrx p;o1alenifetatfm2ranvp;(4tetrmfciytfptelivs (0teumiopio4opeelici (  Drr(rp;t0tptniieiltlm rmnvp;u4tltoif3iadlmDrau i;(  2uo(o io4ape mivi tfs2umxmpnu0oleo ieiaslm rmnvs u4tlxoircoadop rlueol( trxrxmpiodol  mieia(  rta(mp;u1tle mietas a2rluvs u4 ltnmf3iotfaDe neols0s2toirpnu1ap  lfvils aDua(  nu4aexn oeiydfa2ra(vo t0areomo3oadlatrln i;s0 2xmimpoo1am e fcias srraumo;t1aexomi3iyt a rmuvp;t4aexrirctytlatrlueo s0t2uoxr oy4lptemiet (  Dur(ro;u1tptoii3iytlaDrl( p u0 leoif oatom   neols0trxrxmpny4ale licilt) 2truronu1aleomfciysfmDrluvpn(0tlxrir3totlatrlues;( tetriopnu1optelfeils arumu  nu4tee  ociyt a2rm(vs (4 eenxo3iatfmte i sls s2tmio iu1lm emivi s  2trumoou0teeomo3iad aDem(mon(4 rxrifctadfm  luvslt) rurirpiy1ll   fct tf ruru  ;t0tleomo3iat m2el(vo t0arenxo oydlmtr i o t) rxmxm iy1lp e ivs s  2tr( ono4ole mo3iat sDum( s ()tetnxr3iytoaDeaivol()srtoxopoydlpte feias  2tr(mo;o1ole  icildlmDem(vonu0trtrmfcia1omt  ies ()t2trio3iy1apen nctltfa2rmum nu4optn feilsfaDean p;(0alxoxo3ootfmD anvs;s0 etmim3iudll e ietl(f 2um(r ou1tlxn f3iytlm emnms t4altrxo3tatomD an i s  2umxm3nodllte nvi tf Drmx pot4oee ifciydfaDem(mo t4trtnio oo1fa  lieils0t2urxmpoydamtnmfvs tfaDrm(m oo4apeo ietldla ul(mp;t)tlxoxf3totomDraueo t) etr(m iodal n fciltfaDtm(mo;o4tpeoii3ildfaDuan s;u4trtnmr3oodla e i slt)s2uoir3no4ole mfesl( sDrmxm ou0tlxoiieiadlaDulnmsnt0 eeoif3oatlmDrlu olt)trtr(o nu4ole  icilt aDtmu p;o0tlxomocilsfm rlumsnt) reomo3oytoaDranes ( srxm(rpiy4olen fvtls)a2rax  no0tlen ociyt a2ul(ms () rtomo ty1omD li ols)teurxr nodalenlfvsltfsDumx poo0alxomfciyslm ulu pn(4artrmoctytfaDrlivil( t2tmxm ou4ll  mnetasfsDrrxmp;u0alx mfciadfa2uaumpn(4tetoifctatfatean i ( t2trxopny4apte ncia(  2rmx o;o0ape mociyslsDeauvon(0artrxocoadlpDean olt t2umxr3iu1ome mict s  rumurooo4oexnmicildfm rmnvpnu)trtoxo3iotopD lneolt0sruoxo3io1llenmivil(fsrtaxrpno0tlx  fctys m2elnvont) ltnxrcoo1oateauvilt) rxrxo oodome livsl( srtrxrpot0apenioctyt aDuluvs u0aetnmf3iytfm rlueilt0 2umiopno4omtnlneta() 2umurp;t0aex ioeilsfs uan o;(0artrio ootfmtr u s s0srur(mpny1am e ici (f rururono0oexo ietldfm2ea(vp;()aeenxrcoo1faD aivs;(  rxoxm3oudllenmfvsa( sDtaxrooo4opt iociadlsDumums t0arerio tytlaD  iei t) exo(opiy1apte fvi s)srrrum ;u1apx if3tltlmDum( s;()artoxo oo1oa  auvi;() rxm(r3nu1ameelnvia(fsDuax  no0tptoifeiydfm um( s u4treniocoy1fpDr iei t0tetmxmpiudlm e ivs sf Dtaump;o4oexoiicilsfa2ea( s;(0 reomo3iotom raieolt)teumxrpno1omee neilt aDtmur no0aet ifctlsfm2emu s u4tlenxf iotfatelieo t) exrxmpiu4op nmivs (fsrrmxm nu1teeniictld s eauvs;(4texoio3oytfate ues;s  2xr(m nodam   nvtl( srrmxmoou4aetnii3tysfs2uan s;t4 exoxo oo1lpDe ieo;s  rxrirpny1om elnviltfa2tmum ;t1alto i3tld aDum(vp;u0aexoir3to1fpteanei ( teuoxrpiudlmte ivslsfa2raur ;u4alxnmfeiadlm2ran p;() etomr3oatla  an ol(  rxr(o3oy4lm  lfes t s2uru p;o1tpt mi3tyt sDumnmsnu0artrxfciatfm e uvi ()tetm(o3nudamt mfcsas sDra(rooo0apxnifeild m um(mp;t) rxoxo iodfm e ieo s setr(m iodapenlieslt  Duaxr no0apto i3iatfm2rm(mon()aetnmociodoate iei t0s2xo(o iu4alen fci t) 2rrxm ;t1oexoio3tatla2ua(vo t)aeenxocoodfp rlnesl()trumxm3ou1openmfvsl()arumu  nt1texnmieiat aDum( s u) exnmo3oo1fpDe n slt sruoirpny4lpte nvt s) Drmxmpot1tlx ii3ias aDea( s;t4teeomr3oodfptraues;t s2xrxo3io1lmt lncslt  Drrur oo1aptoio3iadfs2rl(von()tlenmo3iodoaD  n s t) exrim nu1ll n ncilt s2tmur ;o0altnmo3tldls ra( o u4aetnxo totlpD ai i s  2toxrpiydamt livils)arrmxmp;t0apt mi3tat s eluvonu)artnxf oo1fptrauvols0 eumim3no4llee nes ()sDrm(r ;u4oltomfctyt mDel(mpnu0artoxo iydfpDe ues;t)srtmimpiy4lpt lfetl( aruaxmpot1tpxn i3iadls el( s t4teerxf oodoa  an ols trxr(m3oo1olt  fvsatf rumx pno0oee mi3iatls ulnvont4 etomr3oytlmDeauvs;s srxmxr3iu1ll   nvs t  2rmumoot0oee ioetas aDrln pnu0arxnxo3tytoa e n s;()t2xoxr io1ol   nvtat  2tm(  ;u1alx ifcildfm rmu s;u4trxrir ia1fptran i;t s2urxrpiodal   iciat srrax oou4aexomo3iad s2em( p;(0tlerxrctydop   nesls) eur(o oodaleemnvi s)a2uaum ot0opt io3iltlaDrmn s (4tlxnif ta1om   n sls) ruoiopnu4ll elieslt  2ua(monu4oeenmiciasfm2rm(vo u)aeerif to1lmD  ivsls0srurimpoy1omt lfvi ()aDuax  no0tlt  f3iyt aDulnmp t4artoir3iotfpD  u sl( t2uoxr oudomt  fvta( a2tmump;u1oetnio3ildla2umnvs u) rerir3oodfmDr ivs;t tetrxrpnudap  lfes (  rrrxro;t0aexnii3ildls ul(vp u)arxrir3iydopDeliesls  rum(mpoodlmt mivsa( sDur( o;u4tetnmi3iltlmDrmump (0artnxf3iodlm r i ols srtrxopno4amtnmnctat)a2uaurp;u0alxn ieilt mDra(ms t4trenxfctodfm  livi;s0 2xmxo3io4ap e iei tfs2ra(r ou1oexn oeiydlm rmuvp u4 leomo3tadom  livol( t2xoxr nydlmtn fei s)aDumx onu4tleo ietytlaDuauvs u) ltomr oa1fp rlnvs;t t2umxmpnydame lnesasfsDuax  ot4tle  ociat m2el(mo (4aetoioctytomte nes;s)s2urxmpnydlltnlnctasfarra(r ot1oexomoeiytlm eau s (0arxrif tydfmt lueolt0seuoim ou1om  lfei t  Duru  oo1olxo oetls m2um( p t)texoxf3oydla raneo t srto(rpnodom elfeias) Dtaumo;u1aet  iciyd a2eanvp;t) exoxo3iytomteli i s) rxrxmpnu1ll e fcsa(f Dua( onu4oeeomi3ias sDelu snt4artoxo3oo1oa   u slt texr(rpio1omtelfcs t a2rmx  ;u4oltn fetls m2rmump u0aexnio to1faDe u o;(0srur(mpoydll   iei () Dtmu  nu0aleniociasfa2eanmp t)tltrio ia1lmD  uvilt) 2xr(o3ny1alt  iciltf rur( p;t4opeomi3ias a2umums;u4tltrmr iotlmDeli i;s setrxr3iy1optn fvtlt aDrmum nu1olenmi3iadla rmu p (4arxoxr3tytfaDr nes;(  2xoxo oydoleelfvsl(farrr(ront4olxnmf3ias m eaums (4arxnioctytlptrau slt0 2xoimpno1am elfctlsfs2rr(r nu1tleomf3iltlm rlums;t4aexrmf tydom rlies;( t2xoio iudlpeemnci ( a2raxmpou4tle  ociytfm eanvo t4trxnxrctadlptelivslt) rxoir nu4lm emfci s aDra( p;o1tpen oetytlmDuauvon()aetoir3oa1omt lieslt)s2xoxr no4olte icsltfsrurumo;u0tptnif3iys m2ra(mp;t) ltnxo3iytfaDelneo;s)t2xmxo3ny1lmtn ncsas) Dumu p;t1aet mo3iydfsDeau s;t) renmo3oa1lpDr nes t) rtrxr oo4lmt  icsas a2tmx oou4aexoif3iytfa eanmo;u0tltnxo iotfa ranvslt) 2umimpio1ap  lnes ( srtrx  no4aeeoifctyt s2uluvp t0trtnif3oadomDeauei s)t2uoir ny4lpeelnci (fsDta( p;u1alxoifciltla ulu p;t4aexnir3tytfpt  ivil(0 2xrim iy4ole  fcsat) 2ra(ro;t1opxomfeiatfsDumu snt0teenmocoy1oa eanvs s t2urxm nudamtnlneia(  Dtmxr ;t4tle  i3iyt sDrlu o u)teeoif iadfpt aues t)t2ur(m iudlle mfetls)aDumum ;u0aetomfctydlm2ua(vo;(4alenxo ta1fmteanvols0srto(rpoo1lm  lfvsa(f rrr(mpot4ale  fciyd a ulu o;t0 lxoxf3oydfaD livo;s0srxm(mpoy1aleemfeils) 2raurpot0optomieiad a2uanvs u4altnxr totoa elivol()texr(r3no4lpt lfet ()aDum( pou4apeo feiltfa2emnmont0tltnxr3ta1fpDe neo t0 2uoxrpiydllenlncslt)sDraxrpno1oet mo3iltfs2em(mp u) etoif oo1op   nei t srtr(o3iydlp emivs ()srtax o;t0tex  i3tld sDuaumsnt)treoif oatlmtrau o;s  etmxm io4ope mncs t srrmu  ;t4tltomf3iytls2rlnmp;t0tetrmrcoy1lmtrlivo;(  eur(rpnydol elfvsat)srrmuroot4oex mf3iltlm2emnmp ()alenmo ty1lmteau i s s2trxopoo4alenmfvt t)a2rmx  no1tlenmocias a el( onu4texnio oy1om elu i;()sexoxmpnodll   ncia( a2tm(rpot0alt mietydls2umn s;u0artnmrcoytfpD  i o s  euriopny4ll elnei (f rum(m oo4tptomoctytfa2rlu s;()treomf3ia1fpDe nvo s)trtoim io4omtnlfvsltf rum(mp;t4alxn i3iytla emnmp;t)teeomf oydfpt  u i () exmxr iu4llenmivsltf 2umu p;t0tlen ociydfsDel(vonu4 lerif3to1fa raues;t0 rumio3iydamtemfct tfsDtau  oo1aeto i3iysla2rlnvpnu0 rtnxo oytlaDeaivsls0sexrxm no1omeemfei tfs2ua(rp;u0apen icilsfm2rmumsnu0teerio3oodop rau s;(0t2tm(o oudaltemnesls) rtr(rp;u4tlto oetaslm ulumo (0 etomfcoa1la eau o s)texoxm3oodomtnmfes s arum(  oo0tle  feiadlaDemnmo (0 rerxf oo1laDean sl(0s2toxo nu1lm e nei t) ruaxm ;u0apenmfeild m rmn o (0altnio oodlaD lneols)s2uo(r iudaltemneslt)arrmxrpoo4tetnmfeiltfsDemu o ()trenmfctodopDeauvo;( sexoxrpiy1ol   fctas  rrrxrp;u1tee  ociadfmDrl( onu4 rxoir oatlaDrlnvo;s)teumxopiudap e nesa( srtm(r ot1tltnmiciltlm2ra( ont)tltrio3ia1lmDr n s s0 2xr(opiy4op emfviatf ruaurooo0oexn f3iadfm ran ont0tlenmo oy1fa r n ol()texo(m nu1op n nviltf Dumxm ;u1aetomociat mDranmo t4aleoir oadoatrlnes s)s2xoxm3iydal n feias)srtrxmo;o0altniociat m2emumo (0tleomr oadoateanvs s0texoxopoy4ll   fvslsf ruaurp;u1olt iieias a2ea( p;() leoio3tatla  lnesl(  rtm(r iy4lltnlietls)arurxm nu0oex  ieiatlsDelnvs ()treomf3oa1lm  li i;t t2xmio nodaltelfeiat a2uau  oo0tex iieildls eau p;(4tleoxfcoy1lm rlivo;()texmxr3iodal nmncs tfa2ta(mono4oeenifciasla2ea(mpnt4aexrifciytfa r iei (0srurxopnudam nlfvtl( a2umx pou0oetn i3tytlm eanvonu4 rtnxf3oa1fa r ues t s2trio iydol nmfvia()aDumum ;u4tltomo3tlslm uanvont) leoxfctatlm r nvslt  2urxopny1ale  nei ( sruax  ;o4aeeomf3iltlsDuanmonu4 rxomrciodlpDr ueo;()t2toxmpno1llen nes s sDrmumonu1aptoio3iadlmDemuvp t)tltoxf3iotopDelnesls) rxoxopou1amtnlictl()a2rr( p;u1tptnmiciat m2ua(msnu0 renmr3todom elivilt)teuoir iu4lle mieias) rtaxr ;t1tpe  oeiydfs ul(mp t0altoirctadomD livs;s)trtriopiydlmeemics ()srta(mpou0aexo oeildlmDean o (4 rtrmr iotfp  lueo;s s2uoxo3oo4omeelfeil()sDrmumpot1apxnif3ias a ra(vo;u4arermr ta1lateaneo t tetoxm3iydolen fvsa() 2rr(mooo0tpt mfeilt m2rmn onu)trtnmf3oo1lmDeluvils0t2uoxmpnu4am  micsl(  rua(m ;o4tetomfctysls em( s t4tetnxo iydlpteauvils) rtm(o3io1om emfeias aDtax  nt1olxnioeiadfmDrm(vs (0 ltomo ty1faD lnvo;s  etr(o oudapee fetat)sDrr(mooo4tpeo fciyd s emnvo u0tetnif tydlptrli il() etrxr3oydaptnmnet ( sDurx oot0oeeo f3iysfsDraumpnu)aleoiocoy1lmtr u s t teto(o io4ll elieil(  Draurpno1aet mo3tyd s2uluvs;t0 rxrxoctotlaD anvo;( trtmio3iu1ome mfctltf Dumuroou1optoiietls m eau p t)aetnif totfpDranei;(0s2xrir oo1openlfeils) rurxm no0texomicilt a umumpn(0aexnxrctatomDelneo;(0srxo(r3ny4ale  ies t srururp;o0tetnioetytfs rl(vpn() lenir3io1omtelieilt  2toxmpoo4alee nei t) rraum no1aeeomfeiaslm2elnms;u4texnmfctadfa ranvs;s  rumxrpoo4lmt mncias) 2rau  oo0tlto icild aDran onu) exnmrcoodlptr nes;s)trtr(m3iydlltn fei (  2trxront4opeoiieiasla2ulumpnt4tetoio oodom r ueslt0 2xr(opnudlptelnvsat srrau pou0aexo o3ils s ul( o;t) eenxfctytlaD  nvi (0tetmiopno4lmtn fei s  rta(  ou1optnmo3tat a ua( o;u4texrmr3iy1oaD ln i t0t2xm(r nodlle  feilt artr(roou4oexn fcias a elums;u) etnmocia1laD  nei s) euoio iodlmenliesl()sDtaumoou4tptn feildfs ul(ms (0arenmrcoytlp  lnvi;t  2umir3no1omt mfetas a2uauro;t4tpx  ociysfmDem( on(4alxnir3iydomteauvs;t  exmio3nudopee ies sfarrr(rpnt0alx moetls m emnmp;(4tetoxr oadfmDeln sls0 etoxm io1ol n nei tf Dtru pnt0apxnioeiasla umnmp;u4 lxoxrcoydomt luvols)s2uriopno4olenmfei () 2rm(mooo4apx  ociyt aDuan o t4aexrio3ta1oaD lu ils)s2xo(m3iy1ol  lieslt) Drmump;u1alx iictldlmDua(vonu)arxrmociatfm   n o;s0 rtmimpno1om elfcsatfsrta(rpoo1op
\ No newline at end of file
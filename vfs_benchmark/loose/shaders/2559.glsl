@@ -0,0 +1 @@
+n ilt)t2um(opio4lpe  ieilt srrru  nu1apeoifciltfaDuln p ()arerxr3oadfpDelivilt) etrim ny1amt lnvia(  rua( ono1optnio3tadlmDua(ms;u0tlenmr3totomD li ils t2tm(rpoudam nlnvsl(faDrm( pot1aee  i3tldfm2rmumpnt0arxrio3oydomDeaivsl()s2xoxo oy1aptnmictas)sDumu  ;u1opt mo3tad mDua( p u0trxomociytfmDelies;t teumim3iodlltnlfesasfs2umx  ou0oeen oeiyt a uln p t)texnio3tatfm   uvsls0srur(m io1al e neils a2rmu o;t4opt iietldfs um( on(0aetrmr3ty1lateln i;t0 exrxr iydlp elfes s)sDrrxr oo0aexo oeiadlm2emu s t)aexrxr io1fm  luvo t0srxrir ny4altelivias arrr( o;u1apeo ietyt sDrlnmp ()aexomo iy1fa  liei;t)sexoxr oudll n ncsat)artrxmp;t1tpe mfeildfs2uanmonu)alxomf tadfpte ueo s)trumxr3no1amtemivtat)sruax  ou0opt  i3tltls2ean s;t) rxrmo3io1latrln sl(  2xo(m iy4omt mivtls arraxrp;u1tle mf3iadfsDulump;t0 exriocoo1lat  uvils0srxm(m3iu1op e ivta(fs2raxmpno1tptn fciadlaDum(vsn(0teerircoatop rlu s (  2to(o iodop  miei (  2umxmpoo0apx mfeiysfm2ea( p (0tltnmr3iodlat  neol( srxmim iudope mieiasfsrra( o;o1tltnmfciaslsDrmnmo ()texnmr3oydoate nvi;(  exoirpiu4op emfesat aDur(r nt4teenmfciltfs ra(vo u0 lxrifcoo1fpDeli sl() 2toxopnodlmtnlnvtl()sDrmu pno4texnioetysfsDumnvs;()tltnmf iodfmDr nvil() 2tm(o nudopt lnet sfartmur nt1tpenmoetltfsDua(vsnt)aeerir3tydopDe u s;s)sexrxrpiydlp nlnes t) 2um(r ;u1tptoiictltlmDel( pnt4 etniocoa1lmDraivo s s2xriopnodol e fvs t s2ur(mp;t0openmoetydls2eaumont)tleoir oatfate ueo (  exmxopnu1oleelics ()aDrmumont0tetomf3iytfmDumn p (0 lxnmr oytla   uei (  2xmim iudale mfeiat)aDtmu  ou4texomietadfa2uaums;()aetrir oytomD lueo;t0trurim iy4llte fcta( s2tau o;o1apxnif3iytfs ul(mo (4 ltrxfctadfatelieo t0s2urim3no1lmtemfet sfsrrr(r ;u0ope mieiyslm2ean s t) lxnio3oytfaDe n slt0tetmxm3nu4amtnmfvtl(  rtr(m nt4alx  oetytfs2rl( p t0alenio oy1omteauei (0s2xoxo3iy1lm  lieiatfs2uaxm ;u0texo fcilsfs2rm( s;t4tlxrio3oytoate nvs ()srumxo3iy4olenlivi () rrr(m ou0oltnmi3iadls2ua(msnt)artrmf3oytomteaiei;s0trxmxr3iu4ap nmnciatfa2tmump;t4opx  i3ildfs ul(vo (0 etoxocto1lpD anvo (0s2um(opoy1lpt livta()a2urx o;u4tptomf3iysfs rau s;t0texnxf oytopDraivs;(0seum(mpio1lpen nciat)sDrmu ont1texoiieildlm uanmo u) etrxf3iytom  auvo;(0 eur(o no4llenmnet t)aDum(mp;u4tet if3tltls elnvo;t) exnif3ty1fm   i ols0t2xr(r3io1amt mivias)arumx o;u4aetomo3iad a eluvo t4arermrcia1oaDeli i;( sexoxmpoo4am nmietls)s2rauro;o0apxomicils aDuluvs;u4trtoxf3ty1oaD lueil()srxr(opnydlmtelfcta( sDrrxm nu4ole mi3iadfs2emuvp t4tetnxr iodomDeauvi t) 2xmxo3oydap   ivil()sDumur ;u4tlen o3iyd sDel(vo u)aeerxo ia1opDrlnei;t  2toxrpoydolen fes t) Drmx  no0tetnif3ilslsDeauvo t)arxnxfcoydoa raues;(0 rxrxr3io1op emivsa()srrm( onu1oet iociltla rlu on()texnmfcia1fmD  uvs t)texr(r iu4olen fvta(f 2rax ooo4aleniieils s ul( pn(4artnxr iodfat livs;s trxo(r ou4lle lnesls)a2tm(r nu0aetn o3iyt s uaumont4teenir3oatfat lieilt0sexrxrpnudlleemieil() Dtr(r ou0tpxoioctyt m2rm(mo (4tetnmociydoaD aneo;s)teuoxrpno1oleelfct t  Duru  ot1aptnmoeiat aDem(mo (0alerxf io1opDrai s t)trtoimpnu1ape lnetat srtm( o;o4altnmoeild s umuvp;(4trtnio oadomtr i i;t  2xoio oudopt lies t)srua(mo;o0oetn icilt aDumums u)alerxf tatfa  ai ol( srxm(o nu4om  licsls sDrmxr ou1opxn i3ilslaDean s;t) eerio3iy1fate ivol(0 ruoxopoudale lnet t)srtrx pnu1openmfeilsfa uaump;t)tetrxr3iadlptrlivo () exoio iydol emivi ()s2uau poo4tlto i3iyt a2elump;t0 leomo3iy1lp rluei;t t2xr(o3no4opte fciatfsDuaxmpnu0tex  i3tytfm rm(mo;u) eeoxr3ta1oateaues;( teur(o nudlmt mfvsls)aDrmump;t4oltnmfctadlm rauvp (4 etomo3oytfat  ieols s2tr(opiu4omee ictls srra( o;o0alxnmietyt m2elnmonu)teerxf3totfptrlueslt  etrio no1llt mfetat)s2rmxr ;u0oetnmfeiad m ra( pnu4artomfcia1op ran i t) rur(r iodllee nesatfa2uaxr ;o0tlx ifciytfm umn ont4 lerxrcootfpt aneils) rto(r3oy1altemfcsl()srtm(mpnu0tle ii3tasla2uaumo ()tlenmrcoy1lp rauvo;t0 exrim3ny4lmtemfct s  Dumxmpno4aexnmf3iltlsDuau p t4aeeoifciydfp  auvs;t  2to(r3io4ll  mfct tf rua( ono4tltnifciasfs rmn ont4arxnxr3iy1lpt ai s;s0srtrxm nu1lm e ictl(f 2umump;t4olx ifciaslm eaump t4 exrmr3totfmDrai s s) etmim iu4lmte ncslsfarrr(r nt0oex ifeiydfa rmnmsn(4aetoxr3todoatr nes s t2toxmpoudlm n fvi () rraumpnu1tptomi3iysfa elu onu4artrmocoy1fat lu o s  eto(o3iydap nmfctlt)a2tm(rpot0olx mi3ilsfs ulnvo t0arenio3oatfptraivs s0s2tmio iydol nlnvt (  2raxro;u0tet ioeiadfa elnvpn()aexomoctadlm eliesls0 exmxo3nu4alt  nvil( aDrm(ro;o1ole mi3ildfm rmumo u4 lxnxo oo1omtr ivi;s)teurio3iu4apt lfetat srrmx  nu0texoif3iatlsDelnvont)arxnirctodlpteaivs;t)srtoir ny4ap elfetls arua(r ;t4alxn i3iasfm2rm(monu4 etnmrciy1latrauesls) etmxo oy1lm elncsa( srurx p;u0apxnmi3tyd aDemn s;u0aexoif3iadlmte neilt0 euoxmpnu4opt mfeils aDrr(  ;o4alenmfeiatlm rln s;(0 leoircta1fmD liei;t s2xo(r3ny4ol nlivsat)s2rmum ;u1olxnifeiasls uauvon(4 exnmo3totopt anvi;s)t2urirpou4op e nviasf Dtr(rono1tptnmfeild a elums (0aexoxf ootoatelnvs;s sruoxo3iydlmenlfes s)s2rm(r ;o1opeomfeiys sDemnvsnt0altnxo3iydoa eli i;t0 rtm(m ou1ol   icia(fsrur(mp;u0olxn feils mDrmnvp u0trxrif3ta1fmDr n olt0truoir ny1ope  nctltfa2rmx  nt1teen i3iltla2uau o;()tetoxfciydfat li ols0texr(o3nu4lpeeliesa()a2umxmp;u1alxnmfeiadfaDea(mp;(0altnxocoo1lptr ieo (  exm(m3iy1lp  mfes ()sDrm( p;u0tpto feiys s eln pn()teerifciotfaD li o (0setmxm iy4omt  nci ()srrm(moot0texomoetasfa el( pnu) rtoxr3tydom   uvo;( seumiopnudoltemfcsat s2rrxmpnu4tltn i3tad a el(msnu0alxrmo3iatla   uvi s t2umim no1ol elfvtas aDur( oou1texniietad m um(mont) lerxo tydfate nei;( s2xrxm nydop elnvsatfarta( pou1oexnmoeiadlm2em(vp;t)aeermo iytfat aueolt  2umim io1lltelivilt)a2rmxmpno4tee  fctat m emnvon()alxnxf iytfa   neol() 2toxr3no4optelieiltfa2um( p;u0tlt iociyt a rl(ms;t4 rtomo3iotlmDelnei;s)s2xmxrpou1opt  net sf Dtrxr ot4optn feiys s2em(mon(0tleoxoctodlaDeln s;s)trur(rpou1lm   fviat) Dua(mont1tptniiciltfs umuvsnt0 rxrmr3todoaDrlnvs s0 rtr(o oo1lpt lnvsa( sDtax pno1tpxn f3iys m uaumo u) reoifciotopteln s;() rxoim no1aptnlictl(  2uau p;o4tpx  i3ildfm2ranvs;u4trxrmrctodlpDelnvi (  eumxmpoy4llee ici t a2tru oot0texomieiytlm ulu o;u)artoirctatfpD  ivolt0srxmxopnodoltemnvtl(fa2uaurp;u4ole io3ias a2ra( p;(4tleniociytlaD livs;t) rtrim3io1lpen fet s arur(mo;o1texo ietlsla el(vo t4alxoio3todoa rlueilt  exr(o3oy1op emfci tf 2ur(mp;u4tlt ii3tldla rmuvs t0alermr3oodfm r nvi s  exriopno4op nlieiat a2rruront1ale mo3iyslm2uan s;t) lxrxocia1oaDeaivilt0t2uoxo3iu1omtemncs ( aDta(monu0aeeniicildla uauvs t) eenir3oadlm r u i;t) eurxo no4apt lncsl( arur(r ou1ope  ietysfs ranvsn()tetoifciy1fatrlivo s0srtoiopnodoltemiet s s2raumont4alxomieiydlm2umnvo;u)arenio3ta1opt anei (0 ruoxrpoo1lmee ivtat)arurxr ou0openif3ilt aDem( p () eeomociydopt ln olt truoxopoydomte ncs (farrrurono4opxomi3ild m2eauvs t) rxrmfctodfptr uvslt)teto(m nu1aptn ieta()artrxr ;t1altomoetadlm emn pnt)aeermrcoytla e ieo;s0srtr(o oo1lp elivtl(fs2rau  nu0aptnio3iydls elnmo (4 reoir tadfpte n o;s  rurxo3iydlpee nciasf Dtmx ono0tltnmfeilsfsDeanmp t4 lerio3iotlmte ies;s  2xrxo3oo4amtn feslsfaDrm( o;u1tlt if3iadla rl( s (0trxrioctytfa e ivsls0srto(mpiydopenlncil(fa2rr(m ou0alxnifciydlsDea(vpnu0 ltrio iy1om eli i;(  rtrxo3oo4aleemieta(fs2ur(mpou0optnmociysfs2uauvp;t0trenmr3oa1omtr uvols0 rxrio oy4amenmfetas)sDtmu o;u4opxn o3tyd aDrl(von()altrmo iatfp  ln i;s0 eto(m3io1amtnmfcsatf rururp;u0aexoii3tyd a2eln s u0trtomociodom r ieslt0s2umir3oodal elfetls)aDumum ot4aexo o3tld mDeanvp t)aeerxo3oatlmDrli s;( setrim3ny1al  lnci t)sDtrumo;u0aexo fctaslmDrl(mon(4 leomr3oa1lmDelu sls t2uo(m no1am nlivtas)a2rm(  ou0opxo icilsfm2umn s t4aexnif oa1om e nvslt) 2urxo no1am elfes (fsrtmu  nu4aetn o3iytls2rluvont4aeeoifcta1fa eaieo;t)s2tmxm io1ap n nct ( a2uaxrpnt1tltomo3iltlm2rmn p u) lxrmf tadlpD livils seuoim3nodllte ics sfsDrr(rpnu0ole mocilsfsDrmumont) lxrxf tadlateauei;t0srxrio3nodapt livsasf Dra(r no0oleo f3iaslm2ranmont)tltomf tatlm e ivi ()trtmxopiu4am elnesatfs2tmu ono4oeeo ictltls2umu s;u0alenxr3iotoaD lu sl(0srtrirpou1al   fci tfsrta(rpnu0ole mieiys m uanmp;t0 renif3oa1fp r ueo s) exoxopny4amtn icsas) ruax  ;t4opxnmo3iydfs ran s;u)arenmf3iadopD aiei;t)srtoiopnu4opt lnct () rtm(r no4apen feiytfs2ea(vpnt0alxoxf3iatoa  aneolt)trumiopnu4ll  mnvt s sDrmump;o0tpeo o3tlt mDumnmo;u)aetoio3iadfa rlu sl( teuoir nu1al e ncsl(fs2rmurp;u0openmf3ias s uauvonu) eerir3oo1om r nvs;s)srxrxm3oudope liet sfsrtmum oo0tlxomictasfsDra( snu4tetnxf3iotlm r u s s0trtoxm3iudomte nvslt sDtau poo1openiieiat m eanvont0 rxomrciytfateau sl( t2tr(o nu1lm nmneslt srtrxmono4tetn fetysfa eanmon(4 rtrmr iodop  lnvs ( truoxrpiy4ap elies (faDrru pot1olxoif3tasfa2ra(vo;t0aexrio3iytop e n i;t0trtr(m iu1altn ncs (faDumuro;t1oet mfeilsfs2ra(mo;t0 etrxf3ootfp  auvi t)s2trir nudaptnlnvi t  2raur ;u1altomf3ilslmDum( o;u0aexnxf3tadop raueol() exmxr iu4amenlivsa()s2umurpot0oet  oetysfa uauvont) rtnxrcty1fpDelneo (0 2xm(r oo1olee ncslt)sDraxront0tetomietat a2ea( o;(0arerxf3oo1lpDeln s ()s2uo(m3iu1lp nlnvtls s2rau o;o0apenmoetld s um(vsnu0 leomf3iotfm raueo;()t2triopiu4al emietatf Duru  nu4tex iiciydlmDumn onu4arxrir oa1laDean sls  2urxo iy4op elivsas  rtm(mpnt1teenioeils aDea(vsnt) rtnmf3iydlpD lnvilt0sruoxopoy4ll   iesas aDur(  nt0oetnmoetyslaDumnvs;t)alxnio3oa1fpDrlnes;s)truoio3oy4llt  fcsl( srra( pou1tpx mfciat m2emn o;(0 eeomf3ty1fmt aneolt)t2xmirpno4lmee feia(f 2trxm oo0opt  f3ild aDul(ms;t4texrir ty1om raiei t)t2tmir ou4open ictasfsDrrxmo;t0alenif3tlsfaDel(vo (0tlxnxf3iytlm   i o s0 2tm(m ny1omtelfcils)srtrurpou1tptomfeiydfm2um(vsn(0aexnmfciydoaDe i s s tetoxrpny1alt  fei s s2uaxmpnu1optoioeiyt s ra(ms;u) rerifcoa1laD ai ils0 2xrxo ny1lm elnvil(  Dua(r nt1tex  fetydlsDum(mpnu)arxoio3oy1opt lu s t)trum(o3oydame mncsl(f 2tmumonu0apxn iciysfaDemu p t)aexoiocoydfa r ueils  etmxmpou4lmeemfcsatfa2urumo;o4tpe ifeild a el(mont4trtrmo3oo1fpt  n ils0 etm(m nu1lp  livta() rrmxmp;u1apt iictad aDeauvsnt) reomo io1lm ranvolt0setrimpiy4ap emfes ()a2tmxrpnt0tlxn o3iyd a2rlu o t0aexnif3tatlmDe nesls) euoirpnu4al n ieilt  Dum( o;o1oexomictatla elu ont0texniocio1fm  luvo;t srtmio3nu1ome lieia() rrrxm no1aee mfcilsfa2rm(vp;u) exnxf3ta1laDrlu ols0srumxopnu4al  livs t)artaxrp;o4opxniicilt aDuluvp u)tetnxfciotoaDe ues () 2xr(o oo1llt mfci (fsruru  ;t1aptomfeiyd a uan o t4alxrmf iatlaDeanvo;s)s2trxr oy1apt  ivsat)artm(  ou1olx iieilsfm rln o;u) rtniociydop eli o;t  rtr(opny1om  livils) Dtm(  ;u1aetoii3tyd a em(ms;t) lenifctydomteai o ()teum(m3ou4ale lies tfa2rmurp;u4open iciat s eanvs u0texrifciotlm   neolt0sexrim3nu1lm n nes ()a2umx pno1alxomfetldla2rmnmp;u0texnmf3oadomD lnvs;t) 2urxr3io1ap  lietlt s2uaxmpno0aetnifcildls ea(mo;u4tetrif3ty1oat  u slt texm(m no1lmt lfeslt a2tmxmoot0apxoifcilt sDran o t4 eerxf3tadlp elueols teuoio3iu4ll elfvt (faDtru pnt4tltnmoetldfs rln o;(0aleomo3tadom  lu il(0setm(rpio4om  lnvt ( artrumpnt0apx  o3ias a2umnmsnu0texoiociatfaD li o t0srxoxr3iu1apenlies t aruaurpou1aptn oeiatlmDemuvsnu)arenxf3iy1lp  ai o t0 2xmxr oodll emivils aruaxrpnt1tex ioeilsfs ua(mp;() etomociadoa raieo;()teumio nudol n fvs t) 2umu oou1texnmieiyslmDrlumo u) exrir oodlp rluvo s  eurimpiudam   fvi tfa2tm(m ot4tlenmfcilsfm emu o u4 rtomr iatfmte n s;t0setm(rpou1opt  ictasf 2ra(rpoo4tpxo fctys s uanmp;(0aeerxf oadfpDr n sls  rxoxmpoudam e fcs s srum( p;t4aex iicilt aDulu p u4trtrirciadomtrauvo;() 2tmxm io4olenmfctat aDtrxmonu0aleoii3ilt m2eln on(4 rtrir3iydoate nei;s)teuo(o3no1olee iet t)srtmu pno1oeeoiiciytlm2emn snt4arxnif3tytopD auvo s0 rto(m3iu1op e ici ( sDrrx ont0olenmoetltfs eauvs;t)tltnxo3to1fpD  u s t) rtm(o no4om   fes sf 2ur(rpot0apxniietldlm2umums t0aetnio3totopt anvo;t) exr(m iy1lltn nvsl() rumumonu1oltnifcildlm ea(ms u4 lerxo3ta1fp  aivsls)teumxmpnudaptelfcs tf Drru oou0oexo feiatfsDelumsn(0 lenir3tatomte uvs t0srxrio3iodopeeliei s) Dra( poo1aetn icils m2eaumo t0 rtnmf3oydfptrluesl(0sexoxm3iu1ll nlfvtl(  2taumono0tet mictysls2em(vs u4 lxrifctotlmtrai s;t)t2um(rpno4oleelictl( s2ta( ooo0aet ifciaslmDrlnvs u0tlxoxr oydoatran s s) exoio iy1llt mnvs () rrrum ;t1ole ifeils m2um(mo;u0 reomo3totfat li s;(  eumim nodlmtelies (  2rmu  ;t4oexo o3ild s emuvo u)arxomo3oodfmte ueslt0s2xm(opou1lmen fvtlt  2taum ;o1aptnifciatfm umnmsnu0 etoxo3ootlmtr ies ( t2ur(o3nu4optnlnct () rtru oot0tlto ietydfaDumumsnt0tltrmf3tydoptrli o;()sexr(mpiydope lncsasfs2rmu oou1aex  ictlslsDuanvsnu) eermf oatfptrlnvi t s2to(opnydlle mnei s)aDua(r oo4alenmoctld a2uan s;u4 rxnxr todlaDe nes (  exr(m3iy4lpeemneilt)a2rr(moot1oexn oetlsfsDul( ont)artnio oadoat luei ( s2umiopiudalt mfviasfsrraxr nu4tlen feiydlm2uau s t4trxnxocoodlaD livi;t0 exoio3no4llee fei (faDum(ro;t0tlxomociad aDraums;u)arxrio3ootlaDrlu s s setmiopny1ll n fvtat  2rrx  nt4ope mfeiysfsDuaump;u0 renmrcoadfmDr u s;s s2uoxo oudlpenlfvia(fsDuru poo4apeo oeiasls eauvo;u)tetomrciodoaD livo t0setmir oodlmtnmivtls)sDrr(r nt4ale  ieiys sDuauvs t4arxrir tadfp elu i;t texrim oodopenlfvtas)sDumurp;o0tetniiciysfaDem( ont)tlxrmrctydomteluvi;(0sruoxo3io1llenlnvt t  Dra( o;u4tlto i3iysfaDumnvonu)tetrir3tydfaD  uvols0trxmiopoydlm n fcsl( a2tau o;t4aeeomiciyd sDel(mon(4arermfcoatfmte u sl(0srxmxr oo1oleemnciat) Dur(mo;t0oexnmietlsfm2ul( p ()arenmf3oy1fmteau s;t0 etm(rpoo1lmte nctlsfsDua(m ;t1tlt  o3tls m ua(ms;(0arxoxf3oytlm rliesl( sruo(o3nydlptemnct s)aruru  nu4olxo iciydls emnms (4trenmocoadom e neo;s0trxo(o3ou1ape mnvtltfsrumx p;o0tpx mf3tltfm rlu p t)aexnifcia1oatran slt)texm(opnu4alenmicil(f 2taumo;o0alxo feiys aDrmn s;t)alenmrciytoatrln sl(0 2tr(opnodlmeemnctlt srrm(mp;o1aeeomf3ilt a2ua(vp;() exomrcoodlpDrlnvols t2ur(o3ny1lltemncs s)srurur ;t1altoiociyslm2emu p u0trtoxocio1fm  luvo;s  2uo(r3oo4lpee fvil(f Dtax  ou0texn i3tytfmDulnvs;t0tetniocoatlm   u sl() rtmir3no4lpe miciat)aDrm(  ;t1oee  ieiasfaDrmumsnu)tlxrmoctydlpt ai slt)seuoirpny4altemfeiasfa2tmu  ou1teeomfetad aDul( pn()trtomf to1oatrauvolt0 exrxr3nudal nmfet sf rtrxmono1alt ioeiatla rl(vont) renmf3ootlaD anei t0s2xoim3oydamt mfeiat  Durxro;o1opxomiciyd sDelnvpn(4alerifcootfp r i i;(0t2tr(rpiy1om  mfvil() Dururp;o0tptomf3ilt s2elu p u4treomo3ty1lmD  uvil( s2uoiopio4oltnmfvils)artaum oo1oexn i3ilt aDranmo u0tlenmo iy1late ivo;s  eur(rpou1omeelnesas)a2rrxmoot0aetomi3tadfs ra(vo t)teenir ootla  ln o t)t2xr(opno1amt mies ( sruaxr ot0tpxo ieilt m2umu p t4arxnxr3iy1oaDe n o t s2tm(r iy4amenmfcs ()a2trxm ;t1tltnmi3iysfmDrln onu)texomf3oodoaDranvs () 2to(opoy1aptemiet tfaDrrxm ;u0tex  f3ildla rlu o;()altrmf oadomDr n i;t)t2toio3oudaleelfeta(f 2taxmoot4aex  o3iad mDrlu o;t) renxocootlp r n s;s  euoxo io1opt mietl() rtmurpoo0aeto feils a2eanvo;u4 reomrcoatomtrluei (  2xo(opiy4llt  ict s) rua( o;o0alto fciasls2el(mont) lxrxrciytop  anvi;s t2xo(o iy4apt mfes t aDrax pnt0opxomoeiadls2elnmpnt4alxrif3oy1latr i i;t0sruoir oy4am   nesat sDrmxmp;u0apeo ieild a2ranvs u4tetnxo3io1op   nes t0teuoimpoy1lmtnlfvi s sDtau  ot4oeeoiieiatfm el(mo;t4texoxrcta1omt lnes (0 rxoxo nu4lp e ict t)sDrrxrpou4alt if3iytfa2ra(ms;() lxnircootlp ran s t0 rtoxopny4aptn net (  rrru p;u4apxomocilsfs2rmnmp;t0aetomf iadlm rlu o ( texmim oydol nmnesasf rumx o;o1tpx iocildlm rlnvont)aexrirctodopDean o;t) rtoxm3iu4oltemnviasfsDtmuro;o0aex iiciytlmDua(vsnu) reomo ta1lmDrlneo () 2xm(mpnudap  miesa() rta( oou4apxoio3iyt a rln o t0tlxoxr iodoaDrlies s0seuo(r3no4lme mfcsl(  2truro;o4oexn oeilsls2umnvo;u) ltoifcoadfmD  nes;t  etoir3iydol  lieia()s2rmu  ou1opt  feiys mDum(msn(0 rxomo ootfp elu ilt t2xr(rpoy1amen nvsat a2rm(mono4teto o3iadlaDrl(mp;(4trxrmr3oydlmt  ivs;() 2xmxm iu1olen fvtatfs2ta(r ;u0tlxniietadfaDrlu s;u) exomo3oodoatrluei s sexrio ny4op nlfci t artmu  oo4oleomfeiatfa uluvp;u4 ltoir iatfmD  ueslt  rxrio3nu4altnlnet t)s2uaum ;t4apen iciaslm emumont4 ltrif3ootfatr n sl(  etoim no4lm   ieils aDrmxmonu0tlenmiciatfm2ulnvo t4arxnif iytfmtr n o;t) etm(r3no1openmivta(f rtmu  nu4opx ii3iasla em(mpnu4trenmo3to1fat au i ()s2xm(o no4amt micsls s2rr(mont4alx mo3tytls uluvp u4altnmfctodoaDrlivols)s2xrxopoy1lmeelfvt s a2rmu  ;o0tetoiociytls ra( s u)arxomfcia1omt anes t srxoxrpnydalt  ivsl(  rraxmpno4olto i3tadlaDea(mp t4arxomo3totfa r nes s0s2uriopio1apen nvslt)s2tmxmp;t4aet  octyt mDuanmp;u)tlerifciy1oat aieilt srtmxrpiy1om emnciltfa2tmxm ;o1aptnmictatla ulumon()alxnmo ty1omt anvi ()t2tmxr3oudap nmfvsa() rrmx pot4oeeomoctydlmDrl(vs ()tetoio3ootlp  aueo;(0srxoir iy1ap nlncsat sDrauro;t4olen i3iydls eln o;u4arerxo3oodomteln ol(0tetrxrpoo4lltelnct t)aDururoot4olen ociys s2eanvo u4arenxo oa1fm raivi;s)seuo(o io4omtnmnvilsfsDuaumpno0tet  ictas sDea( o t0artrxf oa1opt ln s ()srxmxopiu1alte neilt  rtm(m nt0oeen feiasla ulu s u)alxnxrciydoaD auvi;t  2xmxopoodom elnci t)s2tm( ooo4tpe iieiydfa2emnvp;u0tleoxf iytlpteauvs;(  exr(m ny1am emncs t)s2ra(rooo4aetomociatlsDeln o t0alenmo oydfpDr i o;s)s2uo(opoy1opt lnvias sDrm(mp;t0apxo i3ilsla rln p;(0 reomocia1laDr ues;s t2xrir3iu1lmee fvsatfs2rm(r ;t4tpe if3tad mDrmu o;t4 lermociadlmDrau s;() eurxrpiy1ape lnvsls  Dtmu ooo0apt mo3iytlm2el(mp;(4teermf3iytfaD anvsls0 eurimpny4lptnlies (  Drax  ;o1apxnmfciytfa rlumonu4areoxr tadomtr iei;s)setoir io1altemfctls  rur( o;o1olxomi3tasls ra(mpn(0 reoxo oatom rln i ()teur(mpiu1amt mneilt aDrrx  ;o4ape ii3iltfa emnmpn()aexomo iotlm   u s t  exrxr ny4lptn ici (f Dtrxro;u4tltn i3iasfs raump;t) lerio oydop e i sl(0t2xm(r3nudllen ietl(fsrua( p;o4alto oetadfs2ra(msnu0 rtnxf oodla rauvil( s2urxrpou1lltnlivt sfaDtr(m ;t1oexo ieilsfa2umn p u0alxomo3iatlm   nvsls0trtoxmpiudame mfvil(f 2ta(m nu0tptnifetysla2emnvp;u4altnif3iadop rlu sls) rto(m ny1oltelicsat  Duaumonu4aeen ieils s2rl(vpnt)trtoxo ty1omte neo s)srtrxo oy4opt lieslsfaDtm( o;o4opto ociltfm rmnvs;t4alxnxo3oy1fp ran sls0 exrxopoy4alt lnvsltfaDtru  ot0altomociytls2eauvsnt)aetriocia1opt  u i;( srurxopio1op elfetlsfa2uax oot1apxoiieiydlmDulnms u)trxnmo3totlpD lies;(0t2uoxr3iudoltnmfvt t)a2tr(roou0tlt  fctysfa2rmuvo (4alermr tydlmtranvols0trto(opoodoptnlnesatfarua( oot1teto f3iasfs rmu p t4 leoio3iy1fatraieo ()srxoirpny4op   ncil(farrm( p;u4tpenifcilt m2emu pnt0aexrmr3ta1oa elnvs s) 2xmir nudomen fesa()a2rm(  nu1tpx ioeiytlm2elnvsnt) etrxo ootfaD livsls0 ruoio io1ol emnetls) Dtmur ;o4oltoiiciad aDrm(vo;t) lxomr io1omDeauvsl(0tetrio3iu4lltn ietlsfarrmur no1olenif3iadfaDrln o u0aeeomr iy1fpDr ueo s0setoimpiydamtemfes sf Dtax o;u1tpxniociadfmDeanmpnt0texrmo iadfmD livsls texm(r3io4lmt  ivtl(fsDuru  ;u4ole  iciasls2ranvo t4aetoif oatfm r u ils0t2xoiopoo4ll  mfcsas) 2tr(m ot4opeomi3ilt s2uau s;u0 rtoxo ta1lmtean o;(0srtrim3oudam n ici s) Dtm(mo;t1teeoiicilsfm2rl(mp u4arxrxr3oodop rli ol(0texo(r3oy4llte ieta()sDrmxmp;o0oltn iciadfsDelnms;() lxnmrctotfp e i i;() 2tmim iu1ll elfeiltfa2rmu  no1aee ii3iys s2em(mp u4trxrmocty1opDelivo t0 rumxm oy4op   ivtas)sDraurooo4oet mieiyt a em(vs u0trenxr oy1lp  li ilt0truriopoodopeelnctat) rurx  ;u1opeomfciysls2uluvpnu4 ltrif oo1omD ln sl() 2xr(opou4lp emivs t  2ua( onu4tltoii3ilsfa2em(mon(4arxoxrcty1omDe n i;t) 2trio io1lle mfvil(fsrta(mp;u0aptnmieiatfa2ea( o t)aeermf oadfmtelueo;( s2toir3oy1amt lncsl(fs2rm(moou1apxn oeiyd m2eln on(4teenxr3oatoptelnvsl( sexmim iydaltnmnesl()arur(rooo0apxoif3iydlm2rmumpnu)arenmo todfpt luvils trumxr iu1lmte ictlsfaDtmu p;t4teenii3iyslsDrmn s () rxoircta1op  lnes s0 euo(mpoydlleeliviat a2rrxr ;o0teenio3iyt aDrmnms;u4tltnio to1fm eai ils) exoio3oy1lm n fesat aDtmx  ou4aet mieiyd mDul(mo u)aleriocto1lpteln s s0trtmio3iu1olee nvs t s2uaxmo;u1tetn f3tyd m raums u0treoifctatlat  uei;(0trxmxr iy4alen ivsatfaruaurono1aee  oeilsfs ul( p;(0 rtnmrciotfpteanvi () rxrxo ny4lm elncsa()aDtm(r ou1opxoioetatfs2ulnvpn()texrmr3tydlm eliei;(  2urxo3iy1am n fvtat  Drmu oot4tee mfeild a umnmsn(0texnmf iytop  ai ilt) eto(r3nu1opeelfcsl(fsDtmumo;u1oltnmocilt s el(ms;t)trtomr iatfmte nes;s)srtmim3ny4amt  ics s) Dtm(mpnu1tpe iietlslm emu s t0 ltrir io1lm eauvils)t2xoiopio1apenlnet tfa2raumoou0opxniieiyslsDrluvp;t4aeerir3tydoaD anvs;(0 rum(o3oodlm emfei sf 2uru oot4oeen fciadla um(mp u)arenxfcio1fmt luvol(0trxoxr nodll elieia()aDtmu o;u0olx ifciyt s2eauvsnt0trtnxr oy1fmDr n i;t)setrxopno4ll  lnvi s)sDtrum ;o4tpeo fetytfsDumuvon(4artnir3todfpt lu sl( s2xoxm3ny4lme lncils)s2rmxm oo1ole ioetas m emnmp (0treomo3tadoa e uvo t0setr(m3io1op nlietl() 2rau ono1apxnmoeiatls2ua(mpn(0aetrmr io1oa r iei;s)s2uo(r iu1ol elicilt)srrrur nt0apxnmo3tldfm rmn o;u) lxoxf iotlaDeau sls0s2tm(mpoudomtelnct (f Drmxm ou1altoiiciysfs2eanmp ()arxrxf totfmt  neol() rur(r3nydop n net tfsrumx  ;t4olenifeiadlm2em( pnt) rerif oydfaDeanvo;t)t2xrxrpnu4amtnmneias)artmx oou4aeeomfcias s eanvsnu4 ltoxocoodfaD au i;t0 exm(mpnu4lm n nesls srum(r nu0aexn f3iltla ra( onu)aeerxociadfaD auvslt0 exo(o iydlm e ietas)aDuaur nu4aeeo ieiyd aDuln s t)alxnmo todfp  ln o;t0t2tm(mpiudllt mnvtlt) Drm( o;o0oexnmi3iyd aDua(vo;(4tleoxf tytfmte ieo;(0 2xo(mpoo4lleelicsatfaDrm( ont1tltn o3iys a2ul( s u4 reoif oo1opteli slt0s2xrio ny4ol  mfvta()aDtrumo;u0tlxomfcild m uaumpnu0altnxr3iydlpD an sl( trtrxr no4am nlneiltfsrtm( pnu1oeenmf3tldls2rluvo u0altoir oa1oatr ues t  rxm(r io1lp nmfcsl(f 2umuro;t1tetomi3tysfaDumn snt0texnir3iadlat  u o t) exmio3no1omtnmnctat arta(ro;t1oltomoeiytfm rl( p t4artnirciadomD  n i t0t2um(rpio1ll emfvsat) Duau  ot1alenifcilsfm2rm(ms;(0aetnxrcia1opt lueo;s0 rtmirpnu4ol elfcs t)a2raxr ;t1apto iciyt a uanmpnu0altnmfciotomDelnvs;(0srtmxopiodoltemieils s2umxront1opt mieiltla2ul(ms (4 leoir3to1oa   u o t  exmxmpou4olt lnvils sDuau ono0tpxnmociydla em(vo;u0 exrxr3oatom  au sl( teumxr3oodlme  ics ( a2tr(m ot4opt iocildfs2ulnmon()tlerio todomt lieo s0 2um(r nydalte ietasf Dtaur no4alenmociasls2raumo;u0 etnxrciytoat  ies;(0s2uoimpiydaptemfvi t)arur(r ;t4optnmfctldla uanmsn() rtnxr3oa1fpteaues () 2umxo io4ameelieilt) ruaur oo1apen o3tydls2emu on()texnmr3todopDrlneols) rxr(m iudomt lieta() Drm(  nu1apt ifetldlsDem( snu0tlxrxrciadlpDr n il(  exoir nudomee nctatfs2uaxmoot0oeenmfciadfmDrln p u)tltrmr3ootfa eai o t0setmxm3nu1apen ncta( arurumpou0oltnio3ildlaDumnvp;t4 rtrmo3oytfpDr ivolt0t2toimpnu4olt lfes tf Dta(root4aex mfetltfmDelu onu)tlxoioctatfmtr ieo () eumxr iu4al nlfvt tfsDtrum ou4oet mfeiad m ra(mp;()arxrioctadlpDe ivsl(  2uoxr nu1ll  lietl(faDraxroou4tee mieiydlsDum( o t0artrmocoa1lmDeluvi;() etm(o oy1omtemiei t) 2ua(r ;u1apt  ieiysfa em( s u0texrif oy1fpteaivs;( sexr(opno1olt livil() rurxmont1olx ii3iytfmDemnvo;u4 rxrxr oa1lmDrauvols texoxo io4altnlfeias) 2rrumo;t1apt mfeiyslaDranvo t)tltrxociydlaDe nvo t0 ruoxm no4opee ncs (fartaumo;t1apto feiydla2rmnvpnt)aeeoif oo1fp rluei;s)texoxrpiu1lp   ncsasf 2umu onu1tptomoeiltfs2elnvp;t0artnxociadlp raneol(0t2trxopnydlp n ietas srtau onu0opeo f3iys aDum( pnu) reoirctydfmteai slt) 2tm(rpnodlleelnet t) rrmumono0tet mfctys a ran s (0aetrif3iotom  aivi t) euoim iu4aptn fvs s s2rmump;t4tex  f3tydfmDua(vo t0tlxoxo oo1opDrlnes;s  2to(opiodamtemfcils srrm(mpno1tlxo ocild sDulumo t4 leoir3oatlm eaivsl( setrxopio4ole  fctlt a2um(m ot1tptnio3tadlm2eaumo;t)altoxfciadlm elnvs t0srumiopoydomte ncil()sDrrxr nu0texoifciydfa rau o u)aeermocoy1la   nvs (0trumxm3no1lmt lnvil()s2rrxr oo1alen ietat aDumnmsnu4trenxociydlpDrli i s)srtoxr3iudlltemnvsls)aDuaumooo1alenio3iyslm2el( o;u)arerxr3tatop  ln s;(0texmio oo4ape mneta(fs2rmx  ot1opx mf3iad aDeauvont4arxomfctytlpDeau sl() exoim3oudam   nesas)sDtaxrpno1tlxomociysfs ea(mo;t0 lxomf tatopDelu i;t)texrxr3oudll emnvsa( sDrrxr ;o4tpxn iciadlm ran s t)artomr3iodlpD aiesls t2um(r3iydom n iet s srtrur oo4olt ii3ias s2rmu pn()artnmf3iy1la elueo (0 exr(m3oo1omeemfvslt)a2raxmpot0oeenmocils sDea(ms (4arxoxf oatlpDr uvs t0 eur(r nu4lm n netl() rta(moot1tleoif3tltlmDelumonu4 etnmr3iydop eanes;(0 2toim3oydlltelict tfsrurumpot0olx  o3ild m eanmsnt0trerxf3oytom eaivo;s  2xoxopoudop e nes sf rururpno1alxn fciadfaDrlumo;u4trxnxo3iydop eln ol(0srtrir3ny4ll elnvtlsfa2tmxr ;t1aex  ietlt aDrauvo t0 reomf3ia1late ieo t  etmiopou4ol e ieiat  Dtaum ;u1tptoiictldfm2elnvp;u4tlerxo3tatfpD  n ol(0 etmir oudlle  ivsas)s2ua(rpoo4apeniiciltlm rln snt) leomo3tatfa eanes;s) 2tr(o iy1llee fetas srua(r no1alen iciyslsDul(mp u4aeeomr3iotlmtrliei;t)t2urirpiu1lmtemfvtls  Dua(mpou4optnif3iatla rm( s;() exomociotopDr neo s sexrim iodolen ivt s)a2urx pnu0apxomfeilt m2rl(mp;u)arxnirciotlat  ues;t0srum(m no1olt mivt (f 2rrumooo1alx  fetytla2uanvon(4aetoircoadfa rlnvi s  rumimpno1lp   iesls  2rmump;o0tleoioctytla emnvo;u0 rtnif3tadlaDrlnei t0tetrxo3oo4lmtnmfetas) Dtrx ooo1olen fctatlaDeau s u)trtoxr io1oaDrlneo ()s2ur(o3no4apt  nci tfs2rm(m ou4teen ictydfmDrm(mo t0aleoxr3ty1laD anvo t) etm(opiy4lpeelivsasfsDraxmp;o0aexnmi3iyd mDra(von()tlxoxf3tadlaD aueil( sexoxopiydlpt  fes s)a2trumpnt0apxniiciad mDelu p;(4arxnmr tytlptr ivi;( t2xrxr3iydap e icils a2rm(rpoo0ole mfeiytlm2rluvs;(4trtnmo ty1lmD an ols  eum(o iodamtnmietl( aDrmum ou0aeeomfciadfs umnvp;u0 exnir3oo1lmDraueo t texrxm ny1al   nvi s sDtaump;t1ale moetasfm el(vpnu0tltrxocoytlp eaivols)srtrim oudaleemneil(faDurxmo;u4tpxoiietat mDea( p (0tleomo iatlat luei;s) rtr(m3nu1ll emnvi sfsDuau oou4apt mi3tadfsDrlu o;u4 rerxo3oytlm eliei;s) etoio3no1amen fci (fsrur( onu0aeto ieiltla ua( pn(0artomf to1faDrauvs t0s2xmio3oudlmt mfesl(  rumur ;t4aet ifetlslm2eln s u0alxrioctydfptr nvs t0trxr(o3iydlm eliciat) Drm( p;u4texn fciltls ranvonu)tetnxocoadopDran i;t t2uoxo oydolt livs tfsrtm(r ;u4aetoioeiyslmDuauvs u0aexnmo oatfat lnvi;t0 2xoxmpnu4lpenlieiatfs2tru  ;u0texoiictydlsDem( o u)arxoxf iy1fmD  uei;t texmxmpou4al emnvsl(fartmx  ;u1olt mf3ias m2emumo;t)tetrxocoodlaDeluvo (0seurir ou1altelneils)arur(m ;o0aet mo3tltfm ul(vsnu)aetrmf3tadfmt aivs t0t2xm(mpoo1openmnetl( aDtr(  ou4aeeoioetydlsDua(mont0alenmocoatfa elnvi;() rxmxm3ou1apee nes t)srua( p;u0texoifctasfm rlums;t0 exoxr todopDeai s;(0 rtoxr oodamte ieia( a2umu  no1apeoifcildlaDuauvo;u) leomo3oo1fmDe nei;s) 2xr(m iy1opt mfet s sDraxmpnt0apxoiiciadfa eluvo t0 ltnxo3oy1oa eau ilt)t2tmxm ny1ap nmivsasfaDrrx pot4aee ii3ildfsDul(mon(0 lxrio ty1om raies ( trtoio nu1ap  lfesa()aruax ono0tlxoif3iadlaDul(vs u4arenmf3oytopDeau sls0tetoxo3iydaltelnvta(f 2tmx  ;t1ole  f3tltfs2elums;(0 ltnxrcoy1fmD aueolt  rxoxr3iy4lleemfctl() 2rau ont1altn i3tyslmDeluvsn()texomfctadla   u ols)s2urxmpiy1lptelfciat sruax oou1apt mf3iatlm2eauvont4 lxrif3oytfat  nvols) rtr(m3ny4llenmnes t arrrxmpou0tee ii3iat mDrm(msnu)altnif tydlpDe u sls0t2tm(o3iy4apte ivilt  rta( oot0alenmoeiatlaDumn o;u0tetomo ta1fm e u slt)t2xmxm3oy1omte ncslt) rrau p;t4tetomfcildfaDem(vs;t4 rtnmo tatla  anvo ()t2uoxopoudlle lfeias)aDta(rp;t0teen feild a ua( s u0 rxoio oo1faD aueslt  rurxr3oo1op emfet s arurxrpno0oex  f3iatlm2emums (0 eeoxr ty1lpDeaueo s)trtm(o oydlmte neiasfaDur(mo;o1texo fciydls2ul(vo t) rtnmo oytfmteli ilt sexm(r3oy1omee ietasfs2taxronu0apx ifciydlsDranmont)alxoxoctadfpDrluvils texoxr io1lp   nvt tf 2rmx  ou1ole mo3iatlmDem( o;(0areoxf ta1optrauvilt)tetmxopio4olt lfvi () rra(root0alt iiciatlmDrln p;u0alxrxr tadfmDranvo s tetoxo3ny4ole  ict t) Dur(rpot0tpx mociydla eanmonu4 lxrxf tytfmte uvsls s2trio3nu4llt mfcil( arua(m oo0tlxnmf3iyd s2ra( onu4artoio to1lp eauvils0sexm(o ny4optelfcilt a2taxmo;t4alx mo3tltlm rmnvp u0aeenir3oy1fm   nvil()t2trirpiy4al nmnvils  Drruro;t4aee iiciyt s2ra( s;(0arxrxf oa1fpD aueo s)tetrir iy4omen neias  Dumu  no0aetomoetldla raump u0artnmr3totfpt ai i s trur(opio1al e nct ( arrrxrpnu0tex  o3iydfa2uaump;t) etnxr totfa eaneols teurxo ou4lpen fci s a2rau p;u0tptomiciat m2ra(mp u0aeerxrctytfaD aivs s0tetr(opnodlp  lfeiat  2umumpno4altnmociaslsDel(msnu)aeeoxocoydom   ueo;t teuoxrpoy1lp  miet (fa2rmxronu4aeenifciyslsDemuvs;u4 lxrxf tytop  anesl( s2trxm iydlp n ieilsfa2um(m ou1alt  o3iyd s el(mpnu)trxrmf3oy1fm e ivi s t2uo(m3nydomee neia( s2tmumooo4tee ifciys aDuanmpnu4tltrmrciytoaD ai olt0setrxo3oodaleemivi tfs2rr(rp;o0tlt  o3tad a2ea(vp t4trxrmrcto1faDeanvs ()seumxopoo4omte iesa(fsDuauro;t4tpt  feiydfs rluvp;() eeomr iy1oa r i ols0 2xm(rpnodllte ivtlsf Dua(  nu4tetoio3iyslaDemn s;u) renmfcoadlp eaneo (0srxoxm3no1om nmics t a2trum ou4aee ifeild m ua(vpnt0altomr3ia1fa eauvo;s  etoiopoydlp emiesl()sDrmurpou4oee  fciat m2uln snu0 rtoxr iadfa  lueils) rurimpou4omtelnctat) 2ur( poo4tle ioctadfs2umu o;u0 eeomocio1fm rauvo () rtmxm no1amtelncsa() 2tm(monu4tpx moeils a emuvsnt)arermf oy1oa  anvs t t2ur(mpiodalenmncta( aDtr(r ot0tpx  fctysfa rmuvont0teermoctatopDr neils  exrxr3oodlmen nvsl( sDum( pnu1texo i3ild m emu ont0 eeoif io1fptelnvilt0 exoxo iu1lltemieia(  rraxrpoo0oltn fetytfa2rmuvsnt)alxoir3oytoa  lnei s)trxrxm no1amenlneiasfsDurump;u0aleomoeiltlm rauvs;t0 exrircta1lpDe nvo t t2tm(m iy4omenmfetls) rua(  ;o1ale iietldlmDuan pnu4arenif io1fmDr iesl(0truo(m3oodomt lnesas sDtau o;u0tlx ifeiltla rl( pn(4 lxrxo3tatoaDraieo;s s2tmxo io1lpenmfvtlt)arrrxmonu0olx iociytls2ul(mon(0arenxocoytopteanvols setoir3nodlpen ieiatf rtmxm nt0oeeomf3ias m rmnmpnu)trxrio3oo1oate ivi t0 2ur(mpiu4apt livi t)aDtmu  ;o0opt mo3iltfs2rln o;u)alxrmf totopteaivs;( sexmxr3ou1omenmnvsls)a2umxmp;o4oexo ociatfm em( s (4 lxnircty1opteln sls)t2um(m iudopee fes sf rurur ;t1tpt mfeiysfa rm( snu0altoxociydfaDr ueolt0srtoxr3iy1lpt  nvsls)srrm( o;u0alxn f3ilt m rm(vp;u)altnircoa1lptr n o;(0setmir3ou4apt  iesas) rra(r nu0ole iocils s rm(ms;u4aetrio3oodomtrln ilt0setoxmpoy4lm nlneia()a2rm(rpot0alxoif3ias sDem(mo t0trxnxoctatlatr nei (0s2xo(r3nu4ol   fct ()a2umx  ou0alxnmi3ildfm um(vs;t4tlxomf tadlaD li ils  rtr(o ou1apte nvtlsf 2umx p;t4aexoifctlslmDumnms ()aetomo3ootfm rln s;(0 etmirpoy1am n ivtl(farurum ;o1ale  oeildfa2uanmpnu4teeomo oydopD ai o s texmxm nudal elieil(f rumumpnu0opeo iciasfmDumn p (0alxrmrctadlat livo;s)teurim3no1ll nmivi t  2rr(mpnu4opto f3iydls2emuvont) leoxo3iadlp  lieolt0 rxr(r3nudap elncta(fa2tmumo;u4oltn octlsls2rau p (0aetomoctytom rlueils0 rtmim3iu1ame  ict () 2tmx  oo4olxomfctlt m rm(mo (0tlxomo3oodop  ai s;t0 eur(m iudole  fctas  rraxmo;o4aeen o3iysfaDelnvs;(0trxrifciadlp eln ols0 2trxr3oudapte fvsa( arurxr ;t0apt  ociatfa2emnmp;(4treoif3ta1lptrlu i;(0tetoir no4ap n nvtlt) Duax pno4tet ifeiyslsDrm( s (4 rtomo iy1fpt aieols trxrir ou4am emfcilsfsrua(mo;t0oexnmo3iasfm elnmp (4trxrxr3iy1omDe uei;(  2xr(o ny4lmte nvs tfa2ur(  ;u1ale mf3iltlm2um(mp;() eeomo tatlaDe ivo t sruo(o3nu4lmt lfctl(  Drrumpno1aexnmi3iydls um( p;t)arxnifctotoa raues;s) 2umxr3io4om  lncs ()sDtmxmpoo4tleomiciatfa2umuvp t4 eenmo3oodlm  li ils)trto(o3iodam e fvs s  Dumxroou0olxomoctlsfsDrlnvo;u)alerirctotlatrlnes s) exr(r3iy4lm   nctl(  Drrur ot0altn f3ils m2elnms;()texrxf tydlp e i o () 2uoxm oo1omtnmnetatfarrr(r nt1aexnmieiyt m2uln onu4aeeomf iotomt ai o t0 exr(r3nodome  ieils  rtaump;t1ale  ociadls2rmn p;u)teeoxr oadlmtelu i ( s2ur(mpio4ope mfci (fsrra( p;o1olen o3ilsfa2umnmp (0trenxociatlateauvil( trxoxo iy1ap emfvtas sDrrum ;t0aex micilt mDemn onu4aetoxr oadom eaivo;( seum(rpoo4open ivt s aDua(roou1aexomoeiytfa ua(monu4tlermoctatopt luei;t s2xrir3iydomtnmfesat)aDumumont1oetoif3tltfsDrmnvo u0trxrmo oadfaD lues;(0t2trxmpou1opt mieilsfa2urxr ;t1oeen f3iysla eanmpnu) eerxf todoatr nvs s) etm(mpoo1olenlivs s)sDtm(mp;u4apxoiietad m rlumont)alerif3iotomtranvol() rtmxo3iu1al nlfes s arua(mo;t4oexo f3tas s em(vp;u4tetnxocoadomDeluvs s  2toim nodopen nct t aDur(r nu1opxo fciysla umnms;u)trerxfciadfmDr ieolt tetoxr iydam elnctl( sDrax  ou0aetnmi3tat sDra(vsn(4tltomo3tadlpD  ieols  2xmxrpiy4lm elnesat)s2ur(r ot1oeeo ociltlaDran o;t) eenmf oatlp   iei;( trto(m io4lle mncils)a2rmuro;u0aee iieiyd aDum( p;()treoiocoy1fatrluei;t)srxm(r oo4lpee fetasfsDrrumont4tee  octlt m2rlumsnu)arxrmfcootfa   i ils s2tmio3ny4lme lfet s aDtaump;u1aeeoif3tytlm2rl(ms;t0trtnxf ta1op  ln i () 2um(o nodam  lfvias)a2urumpnu1olenmo3iltfm rlumsnt4arenmf3ia1oa rlueslt) ruo(rpou1oltn icslsf rtr(  ot4teenmi3ilt aDrm( s t) exrxfctytfp r ivi;s)truo(o no4lmeemiesasf 2ra(r no0tpe  octatfaDuln p;t0aexrmr iotfpt livils0sexrim3iu1ll nlieil(fa2rmu pou1tpeoio3iadla rluvsn(0 rtoxo oa1fatelueslt) eumxrpiodom e fct s sDtrumoot1tlxn o3iaslm rlu pnu0 reoxo3tatfaDrai olt tetm(rpou1openlfesatf 2tm(m ou4tle  oeiat s rlnmpnu0aeenmr3oatlmDeai ols trtmir3oo1lmte fei ()aDrax pou0ape mo3iyt a2uauvp;t4tlxoifciotlmD  ivs;t0trum(r ny1ameelivi sfarrm(rooo0teeomoctld s uauvo;u4trermfcoadop   i o;t tetr(m iydlpe lict s srrrum nu4aex  f3tls m2umump t)trermrcootop eanvs;(0 rxmxm io4ole lfei tfsDra(mono0aee  ieilt s2elnvs t)tetriocia1lp  li slt  rtr(r ou1al e fetl()aDrrx oot4aet iieiaslm ulnvp;t)teermrcoy1faD liei s0srtmxm3oudlmtemiesltf 2umurono1apenifetat m ranms;(0tetrmo3iy1fatelueolt trto(m nudapt  ietl() Dtrxrpno4tlenmociydfm2rmumpnu4teenioctydomDean i;t0tetmio iu1altnlivsat)sruaumoot1tleoii3tld m ranvp u)alxrmf oydom elivi;()srtmiopiy1am  mivt s  rrax poo1apen ietadla2ra(mo;t)alerir totfmtelnvs;() 2xoimpiy1am emfctltfs2tm(ro;u1tleo ictlt sDrmu on(4 eerxo3iytlmD  neil(0t2uoxrpnodlme mfetas)arua(  no4oeen ociydfs2rmnmo u0tleoir iodoa  aueolt0trtoim iodaptelivta(f 2ua(moou0apt mfetldlsDel( on()tetoxr tydfm rluvi;s)trtmir3oy1olt mnvilt)artm( o;t4alx ifctldfa2ul(vont0alenmf3totlmt  nvs s0srtrimpnydalt  nvt t) rrmum ou0alx moetytfa2rmu o (0tlxnxf3oydlpDran il( t2toxm iy4lmt mnvsatfarrmu pno0apen ociytlaDul( s;u0 exoiocia1fatran i t s2xoxm io1omtemivils  rumump;o0tpxnmo3iadlsDean o;u)tetoxr oadop e u sls)srurir3iy1oltemfei tf rrrx p;u1aptoio3iadlsDrlnvs;()texoxo iy1lptr nei;t  rxm(opno1aptelietlt) 2rr(mpou4opx  o3iad aDranms t0 reomr iy1om r neil()t2umim3nu4lleelfetl()artm(  nt4tetoifcilt m raumsnu0texnxf3oydfmD luei;t sexo(o iydamtemfct tf ruax pot4alxniociasls2rlu s;(4 eeoxocoadop  an olt0tetrxr ny1am  lfeslt aDtmxrpoo4tpenifciasla rl( ont) ltrmrcoa1lmDranvi;s t2um(m3oy1ameelncsatfaDrm(mpnu0aexo o3iatfaDeanmo (4artoxrctytopDrlneo t)t2um(mpiu1am nlnctl() Drr(r ;u0aexnmfciysfaDumu p (0artrifcoadfmDe i o t)srurxr3oudlpe mivsa()sDuru o;o1open f3tydlsDeluvsnt) eenxocio1la e n i;()sexmxopoodlpe  ncias srrrxr nu4opxnif3tlsfa umnvs t)aetoxfciy1lmDelieo;t)t2tm(m3iodap nlnvtlsfsDta(moot1oltniictat a ea( s;(4 rtnmf3oy1omteaneo;(0setoxr3iudlltnlivt ()s2uaumo;t4tlx  fciadfaDum(ms u0 etnmf oydfmDeanvilt0setm(mpiy4openmicsas) rrmx pot4aet  ictasfa umumo t0 lenmo oy1lmD lu ils srxo(o3iy1op   neia( aDumu pou4alt  feias m eln o;u) lenxo oo1omteaneo t sexrxmpou1lltnmfvsl(f 2rmxrooo1alxn fciltlm rl( s t4artnmf3oo1op  anvolt0 rxoio no4ap   nctas)s2ur(mpno4alxoifciasfs rm(mo u4 rxoiocoo1fpt lueo;s sexoxmpny4ll e fvt () 2ra(mpnu4tpx iociydls2rmu p u)tltoioctytlatr uvsl(0teuoio ny4oleelieil()aruax p;t0aptn f3tytlmDulnmpn(0alerio tydopDrln sl( trtr(o oo4oltelneia( aDua(m ;t0oetnioeildls2emn pn()trtnxr3iotoptr nvs;t  2xrxo3iy1oltelfes t)sDtmu pnu1tpeo i3iyd aDrmumo;()arxoxo3ty1oateli il(0 exoxopio4llt  iet s)arrr( o;u4tetoifetlsfa uau s;()teeoxo oa1lp   uei;s) rtoir nu4llenlncsa( srraxrpno1tlenmoctat a umnvp t)arenmr3io1op e nvi;t s2umxrpou4ll emfcs (farrr(moou1aptnmfeilt a2emnvp;() etnmr oo1optr ivs () rxmirpoo1optelfcsl()srtmxmoot1tpt moetydlaDua( snt0 etomf3iotlmteln i t0t2uo(o3oo1lp emfct t)s2raxmo;o4oeto oetadfs um(mo u)trtrxr3iytfa eaiei s srxoxr3oudap n icslt aDtmxr ;o1aeen o3iysfmDra( on(0altoxo3oa1fat  u o;s trtrxmpiu1opte fvsat) 2tmxr ot1tptnmoeiad sDrm(mo (4teerir3iydla  auesls) exrxr ny4lp nlietl(  rtmxmonu4alt ifetydfa2ran pn()artrxociatlmtr ies;s0trxo(rpiy4lle  fci (  Dtaxroot0apeo i3iltla2rlnmo t)arenxo3iy1oa e ueo;t t2xoim iodap e ncilsf rrmum ;t1teeoii3tytlsDul( onu0artoio3io1lmt anei s0teum(m3nydlptemnesls  Drax onu4apxoio3ilt mDuauvp (0 rtnio3iy1fa rln s s t2to(m3ny4opeemicils aDrax pot0tlxomociysls emums t0teenxfctytla  lueo;t t2toxr3oo1lp emfcils)srrru  ;t0ale moeiytlaDuau snt0tetrmrcoa1lmDranvs t)s2to(rpiu4lpenlfvta(fsDta(m nu0oee ifeiyt s2um(mpn()artrif3oodfmtranvils  2uo(mpoo1lpenlfeslt) rra(  ;u0aptniietld a2raumo;t4 lxnio iodlpD  n o s0 eurxopno1lpenmfviat) 2uru o;u0oee  ieias aDuluvp;(4 ltoio3oy1lmD  nei;t  rum(m oodlptelivs sfarumx p;t4opxn iciytla rlnvsn(0trerifcio1op   nvi s)s2xrimpnudam emfcslsfaruax p;u0opx ii3tysls rauvs t0aeenxocootomDe ueolt)sexm(rpiy1altelfcsltf Drrxrp;t4aptnmo3tysfm2elumont0arxnxo iytla e uvi s0teumim3oy1lme mictl(fsrtrum ;o1ole  ieiat aDuau s t) eeoif3ia1lpt ai s (0 rtrxopnudlptelfetas)arur(ront0aptnio3iytfm rl( s;(4trxoio3totopDr nvo;t) exrir3iydapt lnet () 2rrxmo;t1tetoio3iyd a2rm(mp;(4tltnmf3to1oa  aivo;s teuoimpio4ap nlfvsls)s2umxrono1tpxoii3ildfaDrlnvp u4tlxomr to1faD ai s;s)tetr(rpou4alte ncslsfsrra(  ;t1aexomociyt sDean s;u) rtomr3ootlp eli ols0 rtmio no4apt  ncsatfsDtaxrp;o0tpeo f3ilsfm rl( p;u) eeomo3io1omt ai o s0t2xoxo3oo1ol  mfci ()a2um(rpot4oexnmf3tldlm eanvo t4aexrxrcoadoptranesl(0t2uoir3iu4al emfeil()s2uru  ;u0oexo oeiydfs rmuvs u4trtnio3iotlaD  uei;t s2um(m3oudomtemfeils aDtrx o;o1tet  o3tldlsDuanvs;t)trxomociotlm raues;t) 2trim oo1ol  mncilt  2ur( p;u4opx  f3iatfaDuanmp;u0trxrmf to1opDeaneils)t2tm(m3io4lmt livs s)s2tmx  ;u1aetn fcildls eanmsnu4trxoio tatfat aiei (0 euoxo oydlmenlfvta(f 2tau  nu0apxnioctysfsDranmsnt)alxoirctydfa e u i;() exrxopoy4lmt lnet tfsDuaum nt1oetn fciysfa2umn p u4artrir3iydfmDr nvi s  eur(mpiu1olt mivsls)aDra(  nt1oee  iciat s ra(vo;u0 ltoircoo1omD aueo;s)trtmim3iy1ll  lfvslsfsDra( oou1aetnmi3ildfa2rl(vo;t0 ltrmfcoatfaD  ueols0t2toirpoodopeelfet (fs2rmuro;t1apto fetyt a rl(mpnu)altnmocoo1omtraivilt) etr(rpnu4optnmici t aDtax poo4opxo fciasfs rmnvon(4teeoxo tadopteanvilt)truoxo3nu4olenmnvs (fsrtm( o;t0olto i3iys s2rlnvpnu0aetnif iy1fa e i slt t2xm(opno1lm emfes s a2trx  nt1aeto iciadla eanmo t0 eermr oa1oateai sls0srurim3nydom nlnei sfsDtr(rpou1olxomi3iatfa2ran o;(4treniocoytopDe u o (0t2ur(mpoo4amt  nvt () 2raxrpnu4oltomf3tydlm2ulnvp t0 etomociadla eanvs;t  rtmim ny1ol nmivias)sDurx onu0tetomf3tasfmDumuvonu) rermf3ty1fpD aneo t0 rumiopoo1lme mncsas a2rrumonu0texomiciytfs emumonu0 renmocoo1lmD  u s s trxm(m oodalt mfeia(farraxr oo0alxnmieildfaDrmuvon()aeeoif3iytlmDeaieo s teuo(opnu4lmt lncsa(fs2rmumo;t0alxoio3tadla ran onu4 ltrir3oy1fa eaiei (0 2uoxo3ny4ol nmncia()a2ua(r ;u1opxoifcilt m rl(vp u4trxnmf tydlp eluesl(0teuo(o ou1ol emnvsa(fsDrmxmoot0tlx mo3iatfmDeaumsn(4 ltoioctodlpte uvilt0 rtmxr3iy4om nmivilt  rrmump;u1tee io3ilsfm umuvpn() rtoxfctytoa rluvo s)s2xo(mpnydol elivsls srtrxmoou0tpeoiietyd aDea( pn(0arxrmf3iodlm   nvi;t  2xoim3ny1lmte icsl( arrm(  ;o0oet  oetytfmDraump;u0tleoif3tytla eaieo;t trtmxm3nu1lle livtatf ruru p;o1opeo fctatls2emn o u4tetnxf3iadoateaivi t)s2umiopio4amenmictlt s2umum ;o0oee  octys a2rm( on()altoxfcoydlmtr uvi;t)t2tmxr iodaptnlneiat  rur(mpnu0oexnmoeiytlm2umumo;t4 exomfciodlmtrau i;t srtoir3nu1lpenlictlsfartru p;t1tleoiiciysfa elump u) lxoircoatfa eaivo;s0 euo(rpiydomtnliviltfaDtmx pou1opxn f3tatfsDumu p;t0trtomr3todfpDe n o;s0 etmirpiudamenmiesltfa2ur(rpnt0oex if3iatlaDulnvs;t)tetoir3iotomtr i o s0 2xrxm3io1al nlneta(  Durump;o0oetnii3iat mDua(mon(0artnxo3tatfp  lneo (0teto(m iu1amt lfct s  2ua(r ot1aetnioctldls2um(monu0teenmrcoadoa rlu ols  rxoxo3nu1omte nes t  Drrurpno1alenmo3ildla rmn pn()artrmociatoaDe i i;t0seurir nodame lncsls) 2rrurpoo4ale micilsfaDuanvont)areoxo oydomDe nvo;t setrxrpoo1lltelictlt) Dtm( p;t1teenii3ias aDuanvpnu0texrxrcio1lmD  i olt t2uoirpiy4lpte ncias)sDrm(r no1oeen fctys mDulumont4alxnifciodopt lu o t0 etoio nudlmeemics tfsDtm(ront1oet moeiltfm rlnmo (4 exnxo3oydoaDr i i () rtrxrpiu4am elfvils)s2ta(m nu1aet iicilslm ran o t) ltoxo3iy1fpDraivols s2xmirpnodamt mivsl() 2ururo;t1olxn i3iytla emuvp (0 leoif3io1lptrluvolt teumxm ny4am nlnvtlt) 2ua(  ;o0tex mociatfm uauvp;t)alxnif3io1fmDranei (  exmir3nu1llt licta() Dumx  ot1alt ifetydls rmnmp u)arxoxf io1op   uvs s  eum(o3no4optemnctl()artau oot4optn feiat mDumnvs;t0 eenxo3oa1oa e ies;t  2xmxo3oo1oleemfvias aDtmx  ot0aexn fctyd mDulnvp;t4aexnxocoy1fpteaues;s0texr(rpio1lle lnvsltfsDtaxmp;t4tpe if3ilsfaDrmuvp;u)texnxo3iotfaDraivil( s2um(o3nodape  neilt aDuauroou0aexo feiatfmDuluvo;t4tetnir3tadfpDe i slt)s2tm(o3ou1am  mivi t aDum( ono0aetnmf3iys m2rluvo;t4arerio3iotlptr nei;( s2uo(rpno4am  mfvta(  2urx pnu0oet  feiasfmDeluvp;()arenxfcoadlpDran s ( tetr(o iy1amtn nesl(fa2ra(moot1tptn oetltlsDrmums u4arxrxr iatoa rau ilt tetrim no4lmen ncias artmu pno1aet  i3tad sDemn p t4 lerifctytfp  aies ( t2xrxrpiudlp   nes s)artrumo;t1alxo i3ilt aDrmu o;(4tlxnmociy1fptrlnvol( trtm(o3oodom nlfci t) rtax ont1alt  octas m rm(vo u4tltrmfcoa1la e i o t0s2tmim no4amt mietlt aDraxmoou0teeo oeildfmDrm(vs;(4trenxo ty1omDe uei;( srxmxr3nydoptnmfcil(f Dumuront4oexo iciaslm ra( p u4aleoio3io1fm e n s;() eto(mpiu4ame lncsls aDrmur oo1tlx  iciadfa emuvpnu)trxnxo3iotfm r i olt)teto(m no4ope lnvsas)s2rmuro;u4apx mfciysfs2uau s;(4 ltnio oadop  aues;s s2xr(r3oo4apenlnvi sfsDuaumooo0tltnmoeiydfs ra(mo t)aleomocoytlmteauei;s)trxr(m oy1al elnctl()sDrmxrpnt1aex mfctad sDeauvs;(4 lxrio ta1fm   neilt)sexr(r3nodlme  feia() 2umum nt1alxoii3iys s uau pnu4 rtrxr ta1fate n s;( s2xoio oo1lme  nvils) rrr(root4tee  o3iysfs2emuvpn(0 exomrcoa1fp   ueol(0s2ur(o3oydamt lfet ()sDrmurpnu0tlt mieiad sDrmnmpnt4 leomr3iadfm rlu i;( sexo(opoodop e net tf 2tm(m ot1tltnifctyslmDea(vsnu4texrxf ootlmDranesls)t2urxm oydam  mivi s) rta( p;o1olen fetatfmDranvo t)teerir ty1fpDrlnei s  rxr(o3oydaptelfeslt aDumxrp;o0aeeomiciydls2rm(vs (4alxoxocoytoa   iei;s)sexmiopno1lptelnviat)aDtau  nu1oeenmiciltfm2uanvp;t) eeomo iytomDr i s;t  ruoir3nu4ape liviat  rur(m nt4aeeo oeiyd m umn pnt4tleomf3totlmte ies;t)s2to(r3oodoltnmfesa(f 2tax pnu4oeeomo3tadlsDrl(ms t)aexrircootomt lnesls0 eto(mpiodam elnvia() 2urxrp;u4ole moctlt aDrl(vp ()aeeomrcoo1lpte ieolt) ruo(o nu1am elnesas  Dtaxm nt1alx moeils sDrl(vp;t4 ltrif iatomteauvi s)t2uoxm3nu1apt micias) 2raumonu4texnmoctltfs emump t0teerxoctodfmte n slt t2xrxmpiy1lpee nvsa()a2ua(rpnu1apx if3taslm ra(vp;t4artnif iydlpD ai s;s texoxm io4optnliesasf Dum( ont4oet ioeilsla2eaump () rermf3oatlpDeau s s0 2uoir oydllenmfei t sDtau pno1tltomfciydlmDrl(ms (4tltoir3tadlp elueolt0t2trxopou4olt  nei s) 2ua(mo;t1tpeniietltfa2emn s () eenmfctatom  luei;s s2tm(opou4lleelivsltf 2uau o;t4tlto ociatfs em(vp (4 eerxr ty1oaDeai slt srurxo3iy4optelncias)a2ururooo1tlxomf3tad s2ranmonu0teermocoy1faDrlneilt seumiopny1am nlfct s)a2trx oou4teeo o3iys mDel( s u4 eermr to1om rlnvols)sexoir3oodalenlneta(  2rau  ;o0tlt iociydls2emn p (4tltrxo tytlp e u i;s)s2xoxmpny4am  livilt)a2rmxmp;u1teen octyd aDeau pnu0 rerif3oadfpt  i i;(0s2tmxr3no1altnmncsas sDumx ooo1aexo oetatfmDem(vo;t0texnmo tytoat anvol( tetmim3ny1lmtemivtatf rrm(rp;o4ape mi3tlsfm eauvpnu)trxnmocoo1fmtelnei;()trxrxr3ou1am  lnct () 2tmxmonu1oee  f3iydls2emn p;u4teeoxf tadomtean o;( teumxm oydap nlnei t s2uaxmonu0alt  icildla rl(ms;t0trerxr3todoate uei;t trurxrpoydamenmnetls)artmxm ou4tleo fctaslmDuauvs;u0tetomrctatoaDr neo s s2ur(o3iu1optnmivs () 2tax ont1aexoifeiyt m2rauvo (0 lxnxfcoytlmtelneslt trxoir nodom elnetas)sDum(m nt1ole iiciytfm2eluvo;(0tltoirctadomDranvo t0trtrxr3no1omt  nes (f Drau  nu1oleoiictad a2rl(msnu0alermrcoa1omDe nei;t0 rxoir3oy4lpeemfeslsfaDtr(ro;u0alxoif3iyd mDrmuvpn(0 ltnmf3iydlmte n o (0 rtoir3iodopee ies tfsDtm( o;o4tetnmo3iasfa2umump u4teermf3ty1laD lies;t0 etm(mpiydaptnmnvtas sDrmur nt4aeenmictld s rmu p;() eerio tadfmtraivi;(0s2trxr3iydlle  ies sfa2rr( ono0tlxoiieilt s ra( snu)treomociodfm   i o s0 2xrxr3nudlptemicsl(farumu o;o4texoioeiysls2eanvp (4tetrxr3to1lp eanei;t0 exrxmpnydoptn fei tfaDtm(m ou4teeo oetat a rluvs;u)texrmrcia1oatranes s0 2uoxm iodaleelnct t) rrrx oot0oee mi3ilt s2ean p t0altomociadoa   nvils  rxo(r ou1lmeemieslsfaDua(mont1alenmi3iyslm rl(vo u0arenif3oadlmDrln o t)t2tr(mpno4amtnmiciat aDtrxmoot1olxo ocilsls2ean o;t)texoircoadfaD  uvo;s) 2umxrpoudlpe mfviat s2rrum no0aptoiictls m2eau o;t4treomfcia1fm   nvs;()t2tmxr ny4olen nvt sfsruau  no1oltn feils sDeauvo;()aeermr oa1la eai o;s) rurxm3iu1lm elfvtat  rumxr ;u4olx  i3iytla2ranmp (4trxrxr tatfp e ivsl(  eum(m nu1om e iciltfsrrm(r nt0tlen ieildlm eauvsnt) leoxf3iotoaDranvs t0 ruoxopou1lmen fvi (  rrmur nu4oeenioeiydlsDulu s;t)aeermr3tadfpDran ilt)seum(r3nydlle mfcs t) rtr(mpnu4tlenioeiydls2eln o;u0aeerio iodlm r uvsl(  eum(r3oo4ll elivtas sDtrur ;t0tee  fciysla2ea( p u4texnxr io1oaDr uvs;t0s2xmxo nu1apeelfesls)a2taumpoo1apxoio3tys aDemnmpn(4trtrxf iodlmDe u o;t0setoir3ny1omt liet () rtr(
\ No newline at end of file
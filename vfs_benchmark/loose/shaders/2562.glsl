@@ -0,0 +1 @@
+uei t setoxm io4amen netltfs2trurp;o1opxnifcilsfaDul( p t) lxomfcoadlm r i slt trto(m3iudomtnlivtasfa2raum ot4apxoii3ias mDea(msnt)alxrmfcoadomtr nvs s)trxmim nu1lltemnct t  rtr(moou0ole ii3ildla eluvo (4aeeomf3oadfp rauvs;s0teum(rpoo1lmtelnctltfarrmxm ;t1aex  feiytfa elnmo u4arxnxrcoadlpt  ivsl(  rxmxrpoo4ome lnvta( srumxm ot0aeenmf3ildla2eau s;(4tlxomfctydlp rln s;() 2um(r oy1opeelfviatf Dtrxr nt0apeniieiyd s ulnmp (0 etnmr3oo1oatrau o;s0tetoir iy1alt  fcia()aDumu  ;t4apxn iciyd a ua(mpn(0tlerxr oa1lmD anvo t0teto(o oo4lpenlnvt tfaDrrx p;t0alxn ociasfs2um(vsn(0arxnmo3iotom  aneo (0t2ur(m oydame  nvi t)srtau  ou4tptnmictytla2rm(vs u)teenmfcia1fpD livo s) rumio oydom nlfvi s  Dtmuronu0alt iocild mDeauvpnu4arxnir3oytfmteluvils0 rxm(o nu1ll emnct sfsrtau  no1oexoif3ias s2eaumonu)trxnmf tytlmt auvi;t) exoiopoodaptnlfetls)srta( pno1olxomfctytfsDeanmp;(4aeenxocoa1fmDeau ols) rto(m3iu1ll  mfvsl() rur(m no0opxn f3tlsfaDra(msnu0trerio3oy1omDr uvol(  2to(m3iu4omtn ncsat) ruau  no0apenmoctadfm uanmont4arenxo3iotfmtelnes s)texo(o io1om   iesls)arrmx onu1oex  fciadlsDeaump u4areoif3oydlp   nvsl(0teuriopny1op e nci t)aDtmu pot1olxnifeilsfs2ra(vpnt4areoxfcia1oaDrlnei t0 etmxm3iydaptnmneia( aruaum ;o1oltn octyt m2rluvo;t)altnio oo1omDrluvol(0t2um(m oydomtn fviasf 2ra(rooo1alenif3iadlaDrmuvp;t) ltoir3oytom e n sls0t2trio oydll  lnvt s)aDurxrooo4oexo f3tasfmDemnms;t)trenmf oa1lp rlnvolt)t2uoxo3oy1apeemnes (f rrrxmpoo0aetnmo3iadls emu s (4teermr tadfaD anvi;() 2trxr io1lme lfeil(  Dtmu ont0aeto feiasfmDea(ms t4aleoxr3tytla   ues t teuoxrpoy4apte fvia( artr(  ot0aeenii3iltlmDul( s t) rerir ty1opD  u slt t2xoxr nu1ap e nct sfsDuaum ;u1aeeniocildlm2el(msnu)tetnir oatlmtrluvo (0 2xr(mpny1ap n icta( artrx  no1apx  octadfm2ea(vont4tetrmr oo1la r iesls sexoxmpoo1oltemfvtl(f Dta(rpot4ope io3ias s2elumont)artrmr3iytoptelu ol(  eumio ou1llee nesas  rur(moot0oltnifciyslsDum(vo;t0arxoxociadlptr n i s) rtoiopoo1am  mfvsat)sDtmumpno1aleomfeiyd s em(vs () renif iadoa rauvol( trumir ou4oltnlfci () 2umxro;t1oee ifciat sDeau o;()tetomr3to1lpDrai sls)tetmxr3iy4amt mivs t)srumu p;o0oexnmieildls rmu ont4 eerxociodfm ran o s)trurxm3no1olte ieil( sDum( ont1tltn ocild s2rauvs u4 ltoiociytomDraiesls0tetmxm3no4ameemfei t)a2umxmpnt0tle mieiatlmDua(vo t4tetrio3tadom r neo;(0s2urxm3oodapeelneiat aDtax ono1tpeo oeiadlm2ra(vonu0 renio oytfmD livo (  rto(o iudap   nesa(f rururp;u0aleoifctat a ua(mp t)aeeomr3ia1lpDrauvolt seumxrpnudlmtelfvtlsfs2rr(ro;o0texo feild mDrluvpnt0tetnxo3oa1la  aivilt setrio iodopenmfvt (fartax  no1opeo o3iyt m uan o;t4 lxrmr3ia1opDr ues s0trtr(opnu1lpeelfciatf rrmx  ;t0opxnmf3ilsfa umump;()arxomo3oadlp rln sls  exm(m iy4ap   fcs s aDta(  ;o1openiiciadlm2emu snu0 lxomocio1lmteluei s)truoxrpiodlm n fesl()a2tax o;t0apxnmictydlsDumuvonu4aexoir tydlmt lnei (0srtr(opoo1omenmfcs sfs2urxmp;t1apt  i3tydfmDua(ms;t4aleoxf3todlm e i ols)t2to(r3ou4lm nlfvs ()srrm(mpnt0tpt  oeias m2rm( p u4tlenxr3tatomDeaivsl(0seuoxo oo4om n ivilt)s2uaump;u4ope mi3ias a ranmsnt0alenmrcio1faD  uvo s0s2tr(r ny1lpeemies sfarumx o;u0aptn i3taslmDua(vpnu)tlerxo3ootlptr ues;( trxo(r3nudomt liet t)srtrxrp;t0olxnmfciys a eanmp;(4trxrio3totfa eluvi;t sruoxmpnydoltnmfcs t)s2um(m ot0teenmictlt a ua(vp;u)artoir iytom  luvi ()sexm(r no4am nlicsat artrumpno1olxoif3iadlm2eanvs;u4artrxfcta1oatr nesl( teumxrpiu1lpenmictatfsDurxmp;o4openio3tldlsDuluvsnu) leomo3tadlmtraneols)t2urimpnu4ll elnvsls) ruaxr nu4tlx ii3iltlm2el(vo;t4artrxocoo1oate uvo s0 2toio3no4am emfvs sfaDrrx ono4olx  oeiad sDraums () rtnmr todfmDrau olt0 2xm(opiodlmenmies t aDrau oou0olenmo3tlt s2raump u)alxnmo3io1lmDrlu s s sruoimpoy1ap n ieil(  2uaxmp;o1tltomiciaslmDemuvs;(4tltomr iodopD ln o;()t2trio ny1olenlfvs tfa2rmurp;u1teen i3iys aDel( o t0aetrif oy1fmDr nvo s  etr(mpno1opt mnesasfsDtr( ooo1aptnio3iyt mDulu p;u) eeoif3oa1lmD  nvi s0 2xmxopio1alenlfcsas)s2raumpou4olx ii3iltfm umump () rtomocty1la   i o;(0 eumxm3oo4apte fei () rtru  ;t0opxomiciysls rmnvo u0arxnxr iatoa  lu o;t  rxmim3nodomt mncs s)artru oou0tptnii3iatla umnmp;u)texoxr iotfpDe n s s)trtmim iy4ome livsasf 2rru ono4tlto o3ildlaDran p t0trxoir3oytoaDe uvi s0s2uriopoydaptemnesat)sDra(m ou1olenii3tls aDean s u4texomfciotlptrlueo (  eurxo no1al nmncsls)arrrxr nt1teto fctyslmDua(mo;t) ltoxf io1lmt au i;()teuoiopiy4olenlieiltfa2raxr ;o4opt iictytfmDuanmp (0tlerircoodlm elieol( s2ur(m iu1ome  ivia()a2ra(m nu0oeen fetldfmDranvp u4 rxnio io1opD  i o ( s2xrxo3oydolee nes (  rra(monu0aptomictad a el(mo u0 reoirctatlaDrluvsls0teuoio io4lle lfviat)srumu  ot1aetomi3ildlaDulnmo;t) leoircoatoaDe ivslt)trxm(m iydllen nvtl(faruaur nt1tee iieiyslaDrlnvp;u0 lenif ia1late neil(  2xrxopio4lm   fci (  2taxm ot4optomoeilsfa emnvpnu4 leoir ty1lpD luvi s s2trxr ny4ameemietatfaruaxrooo0tetoioctat a rmnvonu0aexoif3iodfa eanvi;t seumim3oo4apt lfesas aDrmurooo0tleo oeild a2emums;t4trenxf3todlm r nvs;s  rtr(r3iu4lp  mnvsls  Duaur nt4alxo feiasla elu o;u4tlxoio ia1fmtr nvs s0s2to(opio1op nmiei tf rurumo;u4optnmfeilt a2ra( s;t) rtrmocoy1opD livs;s0s2xrxopiudalenmivslt)s2tmx  ;t0tpxnioetltlsDuan s;(0aetoxr3iy1la r uvo;s trtmim3ou1ame liesa() rum(ronu1tpenii3iydfmDuaumpn(0tetnxo3todfa rlnesls)srtoirpoo4llenlfctl( sDtrurpno1tex mictlsls2ulnvsn() lxnxrctadfmtrluvi;()s2xmxr3nodolenlnei s)sDuaxr ;u0tlxn fciat a2ra(vp u0alxrifcoytlateaiei;s0 etmir3iydlp n fvtlsfsrrmx p;o4ope  o3iltlmDuaump;u4 lxnxrcto1lp eauvols)trtm(mpiy1lpt lfeilt)arua(ro;t1oetnifeildfs2ul( s u4tlxrxf3oy1oaDrlnvs s)setmxo iu1amtelfvia( sDtaxmo;t4oeenmoeiadfa2ul(vp t0 eenmociydlaDe i o s0 rxmxm no4ome mnvtl( sDurump;u4apt  fetad a ua(vp;u)aeermf iy1lp  auvslt) rur(m3oo1amtn fvt () 2tmxmont0opx iociasfs eau snu0alerxf iodfmDranei ()s2xrxm3oo4am e nvsa() Dtm(moou4oetomf3iaslm umnvp u0trermr3iytlateanes t0s2xoxm3no1lpenlfctls sDrm(ro;t1aetn i3tyd a2elumo () eenmr3oy1opD aivi;s teur(rpiu1ope liei (  Dtaum ou4optomiciasfm2rmn on(4aetrxr ootlptranei s0teurim oo1ol nlict ()aDtmum ou0alxoiociyt a2rmnvp;t0trermo3io1laD ln ils  eurirpoudapeemncs (fs2uru poo4optoifciasfs2emnvsnt4 rtomo3oadop eau s s srxoxrpnu1optnlfcs t)s2rrur ;o4teeoifeils m2rlnms t)tltoioctodoa  aieo (  etm(m3oy4llt lfvslsf Drmu pou4alxoio3tlsls2umuvonu0trtnmfcoy1fm e n o (  etrirpny1amt mnei sfaDrmu p;t0alxnmieias sDumnmpnu4artoif3oy1latraies;s)sexoxm iudal  mfeilt)srraumpoo0apxomi3ias mDeauvpnt4tetrifcoytlp   iesls  2urxmpiodom nlnet tfs2urxrp;o0aet iietatlaDrmuvs;(4 rxnxfciotfm rlneo;t0s2xrio3oy4olenmfvt t) rumurp;t0oetoifeiytfm ul( s;u0altrio3oytomteluvils0 rtmxr oy1alenmnvs () rumx onu1aexnmi3tld m2ua( s;u4 rxrio3oytlate i o;(0t2umim3nodam nliet ()arrrx pnt0texoifeiaslsDrl(monu4tltrxf oo1op eauvi;()srtr(r ny4ap   ivi s artaxr ot4aee mieiasla ea(mp t) exnxociy1oa ran sl() 2xoio io4omtelfvsl(fsDrru p;t4tlx micias a2um(vsnt0treoxo oy1fp raieil() rtrir3oo1omtnmneia()arrr( oot0tee moctlsls2emumpnu4trxnxrctadlm elieo;s0t2xmir3no1al   nvta( arrr(moot1ape ii3taslmDumumsnt0 etrio oatlaD  u s s0 eurir oydllte fet tfs2umu onu0aeto oeilsfm umums u4 exomo ty1lpDr uvo s)s2xmim iu4om n nvsas a2urxrono1oexoioeiysfm em( s t0aetrmrcoy1fpD aies t0srxoimpio1lp nmivi t) 2tm(  ou0aleniieiadls2elnmonu)aetoio3oatoatr nes s trtr(m iudlpen feil()aDurxr oo1oeeomoctldfa umumsn(0 etoio ty1opDelivs;s)trtr(r3iy4om   ivsas) rurxrooo4tlx mf3iydlm el(vs u) etoiociatfpD aivi s0 etoxo3nu1altnlnctat  Drmur ;o1tlxn iciys a2ean s u4 leomocty1lat an ilt)s2toxrpiudam nlfvsls  2uau ont4aleo ieilsfs rmnmo;(4 lxnmoctytfatrauei;s trtoiopoy4optn nctls  Drru ooo1apx miciyd sDuan s;u4 reomocootfatrau i;s0 2tr(o iudamen fct (fs2rrxr no4aeeomoeildls2rm( o t4trxrif3totoptelieo t s2tm(o oy1lm   ietls)arrau oot1tptn iciatfs ul(monu0texrxrciydomteaues (0 etmxr iu4lmtnlfeta()s2rmump;t4aeenmi3iysfm rauvo ()tlxnxo3iydla rli olt0s2xoim3iu4al nmiesl() Drmurpnu4olx miciydlsDranms;(0 lermo3oo1fateaieils0teumxr nu4omte fetl( aruau pnu4teeomociadlaDumu p u)alxrxocoa1om  auei t)srtm(r3oodamenmneils artr(ronu1olt ifeiydlm2rl(mp t4alxrxf iodfat lnes s  2uoxo io4ol   fctlsf rraur ot1olx mfetytfaDrlnvonu4 lxomrciotomteaueslt s2uoim3oudoltemivt s)arrau oou4apenmo3ilsla2emuvpn(4teenir3oodlm  auvslt0 2toxmpio1llte fvsltfa2uaur nu4aexnmociatlaDum(mo;t0 eenif oa1om  lu o;s0 2xmir3ou4ll emneia(fs2taxm ;t1oeenioctydfm rl(vsnt0 etoir3iodoat luvs t0trxrim3io4al   nes (faDtrxmoou1teen fciys aDulnmo;t4teenif3iotfp   u i s trum(o3oo1lleelfctls)a2ua(m oo4aexomoetat s ra( s;()arxnmo3ia1lpt anvo;s)s2toirpiy1om   fcs ( arrm(m no1tlxnii3ildfmDuanmp;t4tlxnmf3tydfpDeaieo s srto(r3oudamenlnes t)a2rmxrpoo1tleniietydfs2umu p u4trxoircoy1oatr u i ()s2uoxo ny1ome lncs sfaDua( onu1openiietad sDea(mo u4 rxoirciotoateauvi;(  2trxm3iodaleemnvi (fs2urum nu1tltoif3tytfs2el(msnt) exrir ootlaDeau o;s0 2xrim iy1omt mfvt (  Dtr( oot4tpx  i3tlsfsDrmu o;u) eeoxf tydlaD anvs;t srxoxo3iy1lpt mnctl() 2tr( p;u0opeo o3ias aDuaumsnu4alenmo todlmD au o s) 2toimpno4lp e netat)s2rr( pnt0oltn ieiys a ua(vo u0aeermr iadfp e ueolt0sexmir nydape lfviltfsDumx oot4aptn feiatfsDemumpn() lenxrctytomDr n o;(  exo(m3ny1ll e fesltf Dur( pnu0oexomieilsfa rmn s;(0alerxf oatlmtr u i;t0sexmiopoudap nlieia(fs2tr(  ou4opt moctltla uau on(4trtrxf ta1fpt  iei ()s2xoxo3nu1om n ies ( arurum oo1tltniieiltfa2ean o;() rtomociydfa rlivols trumio no4ole lieiat)srraur ;t0tptn ieildfsDran s;u0tetnifciadoaDelueols0t2xrxmpoydlm nmiet s artau  ou4tpe io3ias m2eanvont4 exnmo3oatlm elivolt) etmxopou4al nmfes () Duau  ot4tpx io3tlt s2eauvpn(0 leoxr oa1laDe ieilt0sexmxm iy4aptn fcsls s2urx ono1tleomfeiytfsDrmn onu0areomr ty1lp  auvo;s s2xm(rpiy4apt liei sfs2tau p;u4oeto o3iysla raums;t0aexomo iatomteaivi ( t2uoxmpoy4lm nmicilsf Drrx pou4ape iietyslaDrl( p;(0 rtnxf oy1fpDrln i ()s2xoxo nu1lmtnliet s)sDrr(m oo1aee  i3iadfsDum(mp;u)alermo oadop e iei;( teuoxopoy4open ivsls)a2ua(m nu1olxo oeiatlm2emnvs;(4 exoir3ty1fateln o;()t2uoxopoo1lleemfcslt) 2tax  oo1tpen iciatfa eluvo;u0aleomoctotlatrlivi;t)srumio3ou4ope mfesl( srraxr oo4olxn i3iydfa uau o;(0alxrmrcoy1oat aivo;(0setoio3oo4ape  fcil(fsrrr(  ou1aeeo oeiltfm ra( sn(4 eenxf3oatlpD lnvsls0s2xm(m no1om e nvslsf Drr( p;o4teenmi3ilsls2ran pnu)areomr3ia1fpDrau o s)trurxr3iy1lpt  ics s  rtaxmp;u1ole io3iltla2ul(mo u0 lxnircto1lmt anei;(0 rto(o oy4om   ivi t artr(  nu1tpto ocilt m rmuvo (4 lxnio3ootfat au sl()s2tmimpno4lp  mics tf rrauro;o1texnioctydfm um( o;u) lxrmf iadla e n ilt trtoxr3iudoltelnvs (f 2uaurpnu0aeenmoetas aDel( o;t4tltrir3oatfm   n i s) rur(mpny1oltelnes t)arrrumpnu1alx if3ild s rm(mo t4altrxo3io1lp  aieslt0 etriopnodlmt liesls artm(rono4tltnii3tytfa eanvpn() etrio3ia1fp e uvi;t t2tm(opou4amtnmfcta( arta( p;o1altnio3tlt m rm( s;t4tlxrxrcoo1lp eau olt0 etmirpnu1op nmnciat  rtmxr ;u4texo ietltfm2rm( pn(0 ltoxr to1fat  nes;t)t2tmimpiy1om elfeiltfsrumu  no4opeo o3iatlaDranmo ()teermf3tatlp rlnes s  exoxo iodomen ivta(f 2rrxmpnu1aex miciydlmDrlump u)alxomo3oydla   u o s  2umir oy4ol nmict (fs2trurpoo0tetnmiciasfs rau p (0alerif3tatfptrlivs;(0 2to(o ou1omee ieiat) rtr(rp;u1aleomiciasls rmnvpnu)tlxoircoytoa  luvilt)texo(r oodomtnlfci t)srrrxmooo0alx  ociadls2rmu p ()tetoxrcoo1laDelivi;s) 2trxmpio1ole  ivtlsf rrauro;o1tpxo fetasfm2um(monu4aetomf3tytfatrlu s;s)s2urxo nudapt lnvs t)aDraxmo;o1alenmo3iltla ulnvpnt0 eermr3tydomDe uvo;s  2tm(m3ou1ll n ics ( aDur(mo;u1alxn feiatfm rl(vs u4alenxf3iotfateln s s  exmxo3no1opt mietat)srum( pnt0tle ii3tysfm rl( p;u0trermf3iytfpD  iei (0 rumio3io1lmeelfvta( a2rru pno1tltomf3tyt s umums u4 rtrir to1lmteanvi;t trxrir oy4oleelivilsfsDra(rono0apx  fetatfa rl(mo t)tltnxr3oatfp   uvs s0 rxmim3nodlptnmfetltfs2rmu pnt0oexo fctydfaDrl(ms t4areomf oo1lm  livil() rxoio nudap emict (fsrururpnt4apeo o3ildfmDem(vs;(0 rxrxo3iadlp e uvo s)t2urxm3ou4ome lfcs (f Duaurooo1tetn fcias aDumnvp;(4 rtoif3iy1fpt anei t0 2tmxmpny1altnlfcs t)aDurxm ot1oexoifciat m2ea( pn(4alxoxo3ia1omtr i sls t2xr(o3iy4lpt mfcs (f Durxmp;t1oeeo fetltlsDemnmsnt0 rxomf3tydfa raneil(  rurxopnu1al nlfcs (farrrxr nt0texnmi3iysfsDeln p;t)trtnxfcio1op rli i;t0trtrir oo4ll  mnvsat aDraxronu1opeo o3iadls elnvpn(4 ltnio iotomD ai o;t  rxoio iu1opt  ictltfsDtr(  ou0tltn ietatla2ranvp ()trxoxr3oytlateli o;() 2xmim3nu4alenmfcs t a2tm(r ;t0aetnif3iatla2ea(mp u)aetoir iydfp  li ol(0 etmxo3nu1lmte ivtlsf Drrur ;t1tptn ieiaslsDrmu p;(4 lxrxociy1optelieo t)tetrxopoy4am e nct ( aDtr(  ou1apxoii3iatla2rm( o;u)aeermfcootfm rlnvs;t s2tmio3oodlleeliciatfsrtruro;u1olt iiciasfmDumnmon(0aeenmf3to1optean s;t trxmxr oo4lmtnmfvsasfsrrr( pno0opeomoetls a rmnmont4aeeoxf3tadomD  u o;t0t2tmirpoy1ap n icsltfaDrmx pot4olt ifciytfsDelnvo u4treoxrctotfmt aiei;()t2urim no1om   netltfsrumu o;o4aee ii3iad a2eanvs;(0trtrxo3to1opDranei s)srtrio3oy4ol  mieslt arum(mo;o1oeen f3ildla el(vs;t4 eenifcoo1opDrlnesl( teto(m3nodom nmfct sf rtr(rpou0tlt io3ias a2ulump u0arxnio3todoaD  neol( trtrim3ny1oltnlfesatfs2rmu o;o4altnifeiltlm2uaumonu4 eenxf3iotlm   nvo t t2toir iy4lm  lfvi sfaDra(mpot4oee iiciytlaDuau p (4 rtnif oytfmD  i i ()t2to(r3ny1apen neil( aDum(r ;o0tet mi3ils s2elnvs;(0altomf3ta1fpteanesl(0 etr(mpno4olee iei (  2tm(moou4apxo iciatla2rmuvont)arermf iy1omD  nvo t s2uoio3iy4lpenlnet ()sDurx o;t1aptomoetlsfs rlnvont)areriocty1lmtrau slt s2tm(o3iu1olee fcs (  rtr(  ;o1apxoifeildla2uau p (4tlenxf oa1lp  lu sls)t2xmxmpnu4apt mfctlt) rtmu p;o1texnmfeiyt aDrmn p (4trtnmf oatfp elu ilt)s2xriopoo4op nlnctat  2rr(ront1opt  ieildlmDua(vsnt0 rxoircoo1fatr neils s2ur(r iudll nmnetas) 2rax pno1apeniociys m rm( ont0 lxoir3oatfa e ivs;()srxoxm no1lmtnlfet s) Duaxro;u0oex iictytls eln snt0 reomo iytoa r nvi;s  2xoxopoo1om  miei ()sDrm(mont0altoiociaslaDrl( o;u0teeoxrcoydfpte nei;()tetoxm io1aptnmicslsf rtrum ot0olt if3iat s2emn p;u0aexomo3oadlmtr iei t0teuoir io4apee ivi (f Duauront0alt moctas m2elums;u4tleoxf ty1lpDrli s;t)tetrxo3iy1lptelnvtl( s2rrx p;t4tlxomfciytfs rlump;t4tetomocoo1lm elu slt0 rumio oy1lmtelfvtl( s2tau p;u1alt  feils m rl(vo;u4tlxrmf3io1omD  ivi t  2umirpno1apenmieia( artmxrp;t1tpenifcilsfmDrlump;()aexnmo iy1lat lueo;s  2xo(o3io1ap emfeta(fa2ta(mo;u1opeomieiatfaDrlnmpn(0 ltrxf oytop e i s s teto(r oo4lm elnvs tfs
\ No newline at end of file
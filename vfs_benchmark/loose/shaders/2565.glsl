@@ -0,0 +1 @@
+ueols0trxrim3io4ap   fci s s2trur oo1aexo ociys sDua(ms;t4 etoif iatfmD aivsl( trxmirpoy1apt mics ()sDra(mp;t1altoio3ilt s2umnvp;(0altnmo iytom raivi;(0trxo(m3oudol nlnvi ()aDrrxmp;u0olxn icils m ra(vo;u0 rxomfcoytom  ai sl(0 2urio oo1apt livi s)s2raxr no4tle mieiysla2um( p;u4 reomr oy1oatelivi;()trur(m oy1ol n ics ( s2trx o;t4opxnmociaslaDuan o () rxomociytoaDr i s;s)srtoirpno4lp  lieiatf Dtax  ou0oeto i3iysfa2ean p;t0arermo3iatom  au o;s) eum(rpoodamtn ietltf 2tm(rp;u4aetnmf3iadfs2emu s (4aetrmf ootoa rluvs t)sexrxo3oudopt licslt srraxrp;t0openifeias m2rauvp;t4 lxnif iytlaDrau il(0srur(mpiy4lleemnctlsfsrua(rp;u4tltn fetldla um(mp;u4 lxnxf3to1lmt livi;t0 rtrirpnodap nmnct ( srraxroot0aptomoetyt s2emu s ()aetnxr3iydla   neil(0s2xrio3iy4op  mictltfsrtmurp;o0oeen fctydlm2rmnvo;t)artoio3iytlateauei;s0trurxo oodomt livta( arta(m oo4alen oeiltfm2rauvo;t0tltrxo3iatlm rlneo;s)trtmxo3nu4lltnlivt (f rua(rp;u0apt iociytfa ua(mp t0teeoxo3ta1fpDr ieslt)teurir iy1olenmfcils) Drrxr no1texoio3tltfa2rl(vs;() ltrmrcoa1lm   u sls) eto(m oo1am emfcslt  rtrurp;t4aeeomoetyt s ranmp;u) eeomo ia1lmtr i s;s t2xmxrpnudomt  feta(  2raumo;o4ope iieiasfs rln o;u) ltnifciadopD livs;s0trxoxm3iodll emfvi ( aruaxr ;u1aptoifeiltlmDrluvpn(4altomr3ia1fa e nvi;() 2toim nodlp   nvtas)arua(m ;t1tle moctyslm em(vp u0texnir tydoatrau sls)srum(rpou4lmtnmiviasfa2ua( pot0aex mi3tlt m2umu snt)aetoiociydlp   nvi;s0t2xmxo3oudlpeemfei t  rrmxm ;o0apen o3iysfm rm( p;u4aeermf tatomDr ueols0trumim3ou1apte ncils srtm(m ou0tpe  f3iyslm2ua(vo (4tltoif iy1oatr uvs t0teumxm oo1lmte fciatfarumu  nt0texniietlsfa2em(ms;t)trxnmrcoa1omtranvs t srurimpiy1op  mncsls)a2urxmo;o1tet ioetltls2ul(vp t) eerifctatoatrlu sls t2xoio no1ale mnctls sDrrxr no4apxomo3iydfsDumu p (4 ltnxo3iy1opD  n s ( t2uoxm ou4altn iciat s2tr(rpnt4apx iiciasla eaumo;u) rxrmrciytoat an s;()t2urxm oydapeelncsas s2raumo;u4teen iciydla2um( p;u4aexnxf todom rau slt  etoio3iu1lpenlivsat)aDua(rpoo1apxoifctyt s2uauvs (0 exrmo tadla eaivo t0 exrxm3iu1lle  fcilt)sDta(mo;o0altoio3tyt mDrlnmp;u0 leoir io1fatr ueslt) 2toxm nu1alt mfvils)srrax pnt4tleo iciat m rau s u4 reoif oydfptrauvi s0t2uoxm3ou1olen neilt)aDrr(r oo1tetnmo3iltlsDemu o (4teenmf3ta1faDeaues;t) etmir ny1altnlivs s srrrxrpnt4ape mo3iyd sDul( pnu4tlenmo3ty1op eli ol()srumirpoydal e ivsat)s2raurono4oleomfciydfm eaump ()alxrmr oydlpD ai o ()s2xrxmpoo4lltnmics t)sDtmx  ;o4oetomoetyt a2ra(vo t4 exrioctatom   ivi t s2urio iu1amen fct s s2ta( pno1oleomociadlmDea(vo;u)teenmr3oodlaDeluei t0t2xmxmpiy1ll emnet ()artm(  nt0texn fetlsfa2rm(msn(4 rxrio3oy1oaDrluvilt  2xr(rpiu4lptn nvt s)arrrumooo1aeeoif3tlsls rl(mo u4tleoiociy1laDelnvo;t)texmim oudlmtelnes sfa2urxr ot1alt mf3iasfs2ra(vp;(0altoio3iy1lmDraueslt s2toim nodam  mfeiat)srtmurpnu0alt mi3ildfsDra( o () rtnxociadfa eli s ()s2trxo3ou4lltn icilt)aDrm(r no0tlto ictltfm rl( sn() eenmocoo1lpDeau s;s)texoxm ou1oltnmncs s aDtmu  nu4tlxomi3iytfs2eaumont)arxrxr iotfpD ai i t s2toir3oo1op nlnvslsfaDtruro;o0alxnmieiat m emnmp;(4alxrxr3tadfp rluvslt)srumir iy4op  mncia(f Dumx pnu0alxomi3tytfs2eau s ()aetomr3iy1fm ranvslt0 etmir3no4llt lici tfsrrrur nt4opeoif3iltfs um( p;t0tltrmrcio1fm e ieol(0s2tr(m iu4lle micsl()s2uaxmp;o4altnmociasla2eanvs (4aexomfcoadlpDe ieo t)trxr(mpny4olt lfcs t  2ra(mpnt4oetoif3iydfmDelump;t) eermr iotfa e u i;t0trtrxm iudll elicias)s2trxmo;u4oltnmfcilslsDrm(ms;t)trtnir3tydoaD aivs;() rto(m3nu1op e fvs t artmxr ;o0alenmf3iyd sDulu o;(4 lxrioctadlmtrli o t  rxoxopno1omenmfetas) 2umxmono1tleo f3tadfs rm( o;t) lenxf ta1fp raivs;()srtmir iu4llen fes s) rtrumooo1teeo ociysls el(vs;u0trxrxr iadfm   i o;t  exmxr3iudlltelnviltfs2rmxmp;t1tpxnmoetad s emu s;u)altnxo3oydfpt aivi;s) 2tm(opno4olen fvtas  rur(  ;t1texnifctlt m2em(vs;(0 ltnif iatfpD  ieil(0s2umxr3ou4aptemfciat)aDurum ;o0aeeoiieiydla ua(mp (0 rtnirctadlpte ivilt0srum(o3io1lmtnlfcils srum(ro;o4tetomf3tat m2ua(ms (4 rxnmrcoadlm raivs;s) 2tmxo3io1om emiesl(f rrm( p;o0apxomfetltlaDem( o;t) lerio oa1la eanvolt)trtmir iu1llen nvia(fs2tmxmpnu1tpto o3iytfs2raumpn()artrircoydoateauei;t0s2xoim oy4ap e ncsl(f 2ta(  oo4opxnio3tys a ra( pn(0 rermfcia1lmt  i o;s0 rxrxo nu4ol nlnvia( srtau  oo1alto feiltls2ra( p;t4alerifciodfmtrlnvo ()trxoirpnu1lle mietls)a2ur(ront4optomi3tytls ua( p;(4 leoio3tydlatrluvols  2toxopoydame livt t) Drr(  no1tlxnmf3tyd a2elnvp;t)arerxr3ootlp  lueils)srurxr3ou4ale mnes ( aruaumono4opt  iciatfs2rl(von()trenmociy1lm elues;() 2trir oydapt  ici (farra(rp;t4teeomf3tyt m2ulu pnt4 ltnxo3iy1oaDeluei;(0s2uo(opiodal   fvil()sDumumoot1oetoiicilsfsDrm(vont0aleomf3tytlmt aivo t tetmiopnu4altn ivilt)a2rauro;t0tlxn o3iatlm2eau o;(0trenmrctodfaDranei;s)s2umxm oydoleelfct t)s2tmumpnt4tlx mfctydlm rmump;()teenxo oa1lm r i olt  rtoim iudomeelivtat  rtmu  ;o1tpxoii3tad m rl( o t) rtrxrcio1optr uei;(0srxrim3nydlm nlfesltfs2uru pnu0texnmietyt aDuln s t4 exrxociydfmt  n s t0tetriopoudlp nlfci s) 2urumo;t0olt if3tasfs rlump (4tlenmr iatom rlneslt s2xmxm3iy1optn fcia(fsDra( pot0apxnifeiydfmDrlnvo u0 reoxrciy1lmt an ils srtrir iy1op nmfesa()a2trum ;u4aexn ictadlmDel(vs;t0alxoxo3tatomtelnesl( t2xrxm3oo4ole mnctls)a2rr(rooo0oeeomfetaslaDum(ms t4tetoxoctatoptrlivi s  rumim3oo4al  miesa()srraumo;u0tpenii3iytlm ul(msnt4aeenio3ootopDr nei t  rxrxm3oodlle  fetl(fa2rmxm ot4opt  feildlm ranmo;t0texnmfctatomDr ieo s trto(mpno1llt lnvi sfs2tr(mp;u0tpt  feiytlmDra( p;(4trtnmo ia1om  auvi s)texm(rpoodomte fvtl(fartrxrp;t1apxnmietld sDrln on(0altnxrciatfmDeanvi (  eum(r iodom nlivslt)srrruroot4olen ociydla2um(ms t0teeomf oodfpt  u olt)s2xrxmpiodomt mfctlt s2ua(mo;u4tpe  oeiltfa rlumsnu4arxnxoctytfpDeli s;()s2xoio oodoptnmfcslt) rrrxrp;u4tlt  f3iyslsDumnvo u) renir3tatlaDrlnes t0texmir nudopee icsl()a2urxrp;o4tlenioetyd m eau pn(4trtnxr todomteauvils seuriopnodlpeemfct s  Dtaumpnu4tltnioctadfs2ra(mp ()altoxrcty1lp raueilt0trtr(r3io4lm   iet s)srta(ro;t4tpe moetadlsDum(vp;t4tetoif ta1fp r n i;(0 rtr(m iu1lp  mfes ( sDrr(  nt0altomiciaslmDem(msnu4tlxoxrcootfp  anvi;(0 rxrirpio4lptnlncsa(  2tr( pno1apenii3iadlm2ul(vpnu)alenxfctadopD anvo;t0 rtmiopny1opt mnei t)s2ta(  ot4apeo fctldfm ra( pn() exnir3oytom rlnvilt0s2xmxr3iu1lle lfcil(f 2uaxr nt0ale if3iysls ranmpn()tlxrmocoy1opteluvs s trumirpno1ol  lncsasfs2trxm ot1tetniiciydlsDrm( s;u4arxnir3ootopD  i slt)t2urio3iydape  iciat)aDua( poo0oetomf3ild aDemnmo t4aexoir3to1op  aivi;t0setmiopiy1lpenmfet t)s2ua(ront1opt miciad s2emu snt)tleoxr3iytfaDelnei s sexoim no1olenlivsat)aDrr(  no0alxnmfciytfm2rm(vo u4tetnio3ty1op  ai i s  2toxrpoy1al  lnciat arra(rpoo0ole ioeiysls elnmp;t)artnir tatfptelu i;t0t2xr(m ny4lmte fvs s)artrurp;u4aptnmfctad aDem(vs ()tlxoircoadlm rln o;t  eur(m3oudlptn ictat aDur(  ;o1oeen i3ildlm2uaump u)arxnir iotomtean sl(0 etmimpoudom nmnviatfarraumpot1tpe mo3tyd s2emuvo;(0trtnir3oydom raivs () 2urio oudlm   fei ( aDta( p;t4olx iieiatfsDeauvsnu0tleomr3ia1oaD an i s sexo(m ou1aleemnvtat  Duaum ;t4apeomfctaslm rluvsnu4 reoio3tytop e uvi t0seuo(m3iy1ll n nvil()artax pnu4oex moeilslaDea(ms;u)trtnif ia1fa elnvslt  2umxopiydlm   iesltf Drr(  no1opx iiciyt sDrm(mp;(0trxomociatfp eliei ()t2xmxm nudlme mfvilt srtr(mooo0opxnmoeilslm2eluvs;u4alxnio iatom e uei t)texrxo3nodlp emnesa( a2taur ;u1tpxoifeildfa2uln snt0alxrircio1om eanvs;s0 exmxr nydaltelivs (f 2rr(rp;u1oetnioetadfs eauvp;(4 etrir3to1laD aueo;t)tetmirpiu1al n fesas)s2uax oot4opeo f3ilt mDrl(ms;u4areomrcty1lp  lneol()s2tmxrpnudalte fcs tf rtaxroou0opt ioetas sDrm( p;t) eeoxrctotlaDraieo;t)truoim3iy4ol elivsa(  Duru  ou0tex if3iad m em(vo (4 ltrmr oodlpt  n o t)sexo(mpou4openlics ( s2tmu  ;o4olxo f3iydlm eanmp t0tetrir ia1lp r uvo;t t2uriopiy1lpenmics t srtm(r ou1oetnmiciydfs2rmnmp () rtrmf iydlmDeluei ( t2xo(mpiudoptnmfciat)artm(m nu0altomoctadfm rlums () reoxr3oatlm r uvi;s0 2umxo iu1ame  ncs (faDtm(r ot4tet  iciatla2uluvo;(4trtoirctadoa elivilt0 rxm(m no1lpe  net (fs2raur nt0oltnmiciydls2umumont)alerio3oo1oa  ai olt)trtoio oodape miesatfarrru pot0aexoioeias a uanmp (0 exrio todfpD  u o;( teuriopou4ope  fesa( arta( p;t4apeoifeiadlm2rmnvpnt0aleoxr oa1fmDe ivolt0 rto(m iu4alte nvs s  Drr(mpnt1oeeo f3iasfmDemnmp (4 etnxr3iotomtr ues;t)trtoirpno1lm nmfvsas sDrau o;u1apt  ociydla eauvo;t0aeerio oatlmt liei;s0trxmxr nu4op elfesa(faDua(r oo0oeto f3iytla umnmpn()teeomr oa1fpt  i s;()trumiopoo4lptnlictls  rumurono4apx mfeildfsDra(vonu)altrir oodlmDraies s)trtrxopiy1aptemics s s2umump;o1altnif3iatfa2uaump ()tetrmr to1fa e ivsls) etr(mpou4ameelieta(fsrrmxm ;o0oeen icildlsDeaumo u4tltnmo tydlat  i o;(0 rum(r io4ol emivia(fsDuax  ;o0oex  oeiad s rmnvp u)arermocoodfaDrln i s srxr(m3nu4omtnlfesat) rraxmo;t0ole moctys m2eanvs;t0aetrifciydoatrlueo;s0sexmxr3iudale lnctl(f rurx  oo4tpe moeildfm raums t)alxomo iatlpt  ivs t)trxo(r3iu1lleemfeia()sDtmx  ;u0apxoifeildla2rln pnt0 exomo3oydlmt lu i t0s2xoxo nu1ap   fvt tf Drm(mpoo1aet  ociadfm2emuvo;u)trtrxo iatlmDrliei () exoim3nydoltnlnvt ( srrmxrpnt4oex mfetatlmDumuvp u4arxoxo3iodlmtrau i;()srxo(o3no4apeemnei tf Dtmumpou4apx ioeiysla2ul(msnt4treoxo3iatlmDeaneo;s)t2umim nu4lpen nvt tfaDrrx  ;t1apeoiictld aDrmu onu4altrxr oydfat lnei t)s2tmxm3iy1ap  lnes tf Dtmxrooo4oeen fctltfa rmu ont) rtrmf3oatomtrauvo ()trtoxr oy1optnlnctltfsrumu pou1aee if3tltls umu pnu)altomr oo1omDean i s t2xrio nudolte fet tf 2tmxrooo4apeoii3iasfs2uaumon(0 eermrciy1laDelnvo s0t2tm(o ou1optnlfcs t a2umurp;u1altoiietytlmDuanvo;t4texomf tytfa rai s;(0s2tmir oydomenmicsl()arra(m oo0tltoiietatlmDrlu o u0 rtnmrcootlmtran il( t2to(m ou4op  licsat) 2rmumpno1opxoio3iaslsDra(vo (0altrmocoo1fp   uvi;(0tetmxopiy4omt  nei (fs2raxmp;u4altnmiciydlm2rm(mo u)teenxfctodoptrauvi ( t2uo(m3iu1llte fvilt sDua(m ;t0apenmfciasfaDrlnvs t4altnif3ty1omtranvs s0truo(r3ny4al e fesls arrmuront0oex mi3iydls2uln p ()arenxo oo1fm   ues t  rum(o iy4ome mfci s arrr(mp;t4tpenmf3iyt sDumumpnt0 renio oy1om  livs;t) eur(m iy4lmte neiasfs2tau  ;t0teenif3tas a eln p;u4tltrio iadfpte n i;s sexoxopiy4omtnlncsatfaruaxro;u0tpto feiad aDeln snt4tlerif iodoaD aues ()trurir oy1ape mfvtl()aDrr(r oo0aee iieias m elnvsn(0trxoircoy1om eanvils0 ruo(r3nu4opt lietas)s2tr( ont4tltn f3tlslm2umnvp;t4 etomo tydomt luvs;t0srto(o oudoltemfvils) Drmx ooo4oeeomf3ilsfm2eln s;u4texoxf3tytfmtelnei t) rxmio3iy4olt lnctl(fa2raur ou4alx mieiyd m2ean p u) lerxfcootfpt  n s;(0teurim iu1aptnlnvtas)s2rmur no0texo o3iydlm2elnmp u4altoir3todla  lues;s0trum(mpio4lm emnctat)sDraxm ;t1altoio3iyd m uauvsnt4teeoifcoydopte uvol(0 rtrir oodlleemnvi s)srur(r oo4aetniieilt mDeanvpn(0alenio3iy1fate i o;(0 etr(rpiodome  ieslsfs2rmxmoot1aeenioeildlsDeln onu)aeerircoodla eluvi (  2xmxr3oy1lpee net (fs2rmxmpoo0tltnifeildfsDeau s;u4 exnio ia1lpDrau olt tetmim3iy4alt mivs (  rta(  no4tpx mieils s2rauvo;u4texnxrcoadop eaivi;t)trum(r3oydal  lfetat  Dumxro;o4apxoiietatla2rl(mp u)alerifctydfa  liei;s) 2xo(o3iu4om nlnetat) 2ur(mpnu4oetnmicilt s2rlnvs;t0 exrxr3tytfp   nvo s s2xoxm3iudomt  nvtas sruaxmp;o1aptoiietadlsDem( p;(4trxnmfcoy1lp e uvs (  rurxmpio4open fvsat)aDrr(mpnt1tee  fciydfs eaumpn() rtnirciotfmtr uvols0 etrxm ou1om e ici (fartr(rpou1tlxomi3iydfsDrlu pnu0altrmr3ta1oat  uvslt0 rtmxr oo1lmtemivta(f 2rmum nt4alx if3iyt s uln o u0trtoifciatopDeaues;t  rtrxm3oudopenmivia(farrrx  oo4tpxomieilsla eau onu4tltnir3to1fateluvilt  rtmxm3nu4apt lici tf 2tr(mpno0oleo ieiytfmDum( on(0 ltnio3oytom eanei;s)trxoio3iy1al elneilt  Drau pno4opeoioeiltls2ra(vont)tlxoxr3to1op elnvs t) 2xm(o io1omee fes ( sDrrxrpnu0ope iictltfs rl(vp t)aleoxo oadfm  aivi t0 2xrio no1lle  nctatfa2tr(mo;o0teto octad m2eluvp;t4trtnmociodomtr ueo s0seumir3oydlm n nvsatfartmumpou4tlt  fcilt a2uln onu)tetnmf oatfa e i s;(0 rxmimpoo4om  lictl( a2ur(r no4oleo iciasls rmuvsnu0 ltoioctodfa ran i ()srtrim oodalt  fcsat)sDrr(mpnu0apenmoeiltfs rmumo (4aexoxr3oodla   nei;(  2xr(m3ou4altnmnct () rtr(mo;t1altnmocild m eln p;() etrxr oytopDr ieilt0 2xo(opoy4lm  lietl()sDurx  oo1aleomi3iydls rmu p;(4aeeoxo ootoateaies;t0srxo(rpoydlle lfvt sf 2umx  ;o1tle iictysfm2ulumo (4altnio ta1lmD  ivo ()trxrio3iy1ol  mfesa(faDrrxmp;o4olen iciltlsDelums;(4tetrxociotoaDrlivsl(0trumimpiydlmeelieils)a2rrxmpno1alxoii3iydlmDrmu p;u4aeeoxf ia1la  ai s;s tetr(o no4aptemnvsls)a2tm( o;u4apx iietydla2eaums u)aexnxrctytlaDe nvols tetoiopnu4ape  fctasfsDtrumo;t4tlx  ieiat s2umuvp ()tleomf iytlmDraivi t  rto(r iodome lncsas  Duaumpnu4aeeomoeiysfs2umu on() lenmfciytla  luvo s0setoxm io1lp  lieias)sDrrurpoo1apeo f3iltfm2ran pn(4artomfciotlm e nvs s setoxmpnodalt  feil(fa2trumpot4teenmo3iyd a2rmu ont0 lxrmrctodlatr u ols0seur(opoo4oltn fvt ()sDuru  ;u1apxomfetytfm2emnms;(4aexrmr3totomtrluvols0tetoim ou4olenmneil( arrmx oou4opxnif3tad aDumn s t0arxrmo3to1oa r nvi s)t2xmim3no1al n nvtas arurxrpou1oeeomictatlsDuaumo;()aexnxo3tatoptelues t  eto(r ny4apt mnciatfaDrau pno1aleomfciyt s umnmo;(0artnif iodoatrluvs;t0 2trim3oo4al n nvils  Drrx p;u0tex mietas a eaums (0tlxrxr oa1faDe i o;t srurirpny1lltnlietas  Dtr(r oo1apx mieiytla2rmuvp;t4 ltnmoctadfm  auvi;(0seumxo3ny1aleelfvslsfaDrmur oo4aetoioetysfs uln s (0tltnxf3totfpt  ueo s t2urxm oy4lltnmfctlt)a2tm(m ;t0alx io3iysfa rmuvo u0 rerxf iy1omDelivo;s)trumxm iy4lltelnctas  rurxmo;t4alxomf3ias mDeauvo u4 lenmrcty1lm r ieols tetoxopoodape  ivta(  rrauroot4aptnifcils a eau o t) etrioctatlaDr i o ( trxrxopio1lmtemnvsa(f Dtr(rpno0texnii3iasfs2umnvsnt) lerxr3iotla  lnvo ( texmio3ny4omtn fesatf rrmx  ou0tetn feias s2rm(ms u0 ltrmr3oytlm elueo s  etr(rpoydoptemfcta(fsDraurooo1oet mfciasfa uan pn(4 eeomr3iotomtrlu ilt)trxmir3iu4ap nmivsas  2tmxmooo1opxn ietytfa2ea(mpnt0 lermf3iodfpDeli o;s0truo(r3iy1aptelnvsl(f 2trumo;t0tlen o3iatfs eln p;u4tlenmfcoatlm   ueils0 eto(m oy1lpee icta( srrrum no0aet  o3iys m2uan snu)alxrmo ty1laDrlneils  etr(r ou4lm   ivi (  rraur ;o1opxo fctyd s ulumont0 rtrxr3iotomteaieolt)s2xmxrpoudale mfviat)arrrum ;o4tlenmfciydlaDrau p u) etoxf iadoaD au i (0 euoir3oo1lp elicia(  2rmurp;u0alxnio3iadla elnvp;u4artrif oadlmDrauvolt s2trir3ou4ap emiei ()sDur( pnu4tetoifeias m2rl(vo;u) rxrxrcoo1fmtrln s;( tetoxm3no4lmt  fcsatfsrua(mp;o0tlenmfeias a rmuvp t4aexnxfciydfa r ivolt0 eum(r3no4amee ncs s) rrm(m ou1aet iieiyslm2rau p;u)aeenmo totfaD aivs ()setm(mpiudomte nesa()srurx  ;u0oee  ictldla2umnvo;u4trtnifctydomDeaiei;s)trurxr ou4ale mfcta(  2tm( ooo1open i3iydfa2em(vp (0 etoxf3iodoptr i ol()t2xoiopiydaltnlnvtas)artru  nu0apto ieiat sDua(vs u4artnmf oatomteaieo s0 rxr(o nydam e fctl()sDur(root4apxoio3tadla el(vo;t4trtnxo iydomteaneo ( trtrimpiudalt mnes s  2tmur ou4texn o3iltla2ua( s;t4tlenmr iodomt ai s t0 rtr(r3nodopt lncsat)a2rrumpoo0apt iociltfaDumums;t0aetnir iadfaD an il( s2triopiodame lnciltfsrra(root4alxnio3tlsla2ranms t0aleoxf oadoa e ieolt seuoxrpiu4optelieils)sDrmx  ot1alt  f3iatfm ranvonu)aexrxociodoatean ilt  2umio3io4om nlivtlsfsDra( ono1aetomf3iad aDeanmo;u0 leomr3iydoaDr iei;s)truo(o oodapenlietl()srtru o;u0olxnifeiadfs ean o;t4alxoircoydfaDeaiei t0s2xr(m3no1omtemfct ()arraurono1opxo ietltfs2eln p u4 eermo3tytomD  nei;( teum(m3oydllee fvtl(  2tmuro;u4alenioeiasfm2uln s u)trxoxr3oo1laD  n o ()t2xmxo ny1optnlivia( artax pot4alxomi3iltfsDran o u4trtrmo3oytfaDeli i s)teum(r oy1aptemietltf 2ta( ono1aptnmicilsfsDuanmp;(0arermo3ty1optelu ils0sexo(m ny4omtemncslsfsrrr(mo;u1oetniicildfm2em(vs t4tlxrxr oy1fpteau s;(0trtr(mpnodapt lfet s)srua(rp;o1texoio3iasfm rmn o (4altnmrciatopDeanei s srtr(opiydam n fcsa(fa2tmxrpnu0aexo ictytfs rmn o;t0 ltoir3oy1fm  lnvi;s0s2xoir nudom n ivsl(f Dtau  nu0tptoii3iad m rmnvp;t) exoir iodlp r nvo t seur(m iu4ol nmfcsa()aDumurpot0alxoifetysfa rl(ms (0 lxnir3totoa rau ol( trumxo3ou4lp emnciat)sDrrxmpou1tlt ifeiytfm2eanmp t0 reoxr oy1fp r i o;s) 2toxopio1ll e ivils s2tr(mpno4aeenif3tlslm2ranvs t) exoif3iydoptr nei ()t2tmxr3nudome  icsl( a2umxroot0open icilt a rlumonu4 ltnmf oo1omte u i ()truoxopiu4lle  fctl()arurump;t4oeenmieiys s rlump;t) ltnmociadfmDeau s;(  2uo(rpiu1oltnlnvsltf Dta(mo;u1oltn ieiysfaDuanvo t) exnif3to1fp rauvs t0 exr(rpio4ll nmfvslt) 2rmump;o4oexomoeiat a2uluvsn(0treoir to1laDeanvi t  rum(o oo4lp elncsls s2um( oot0oee moeildfa2rmu snu) rtrmr3iadlat lueols)t2xrio3io1lmt lnvslt) Dtmum ;t4tpeomocildfmDuanmon()altnxr ia1lmt anvo (0 rxoxrpoydlm   fcs s)srrmxmont4aetnmiciysfm rm( p (4tlxrmo3tytfp elu s t)trxmio3ny4omee nct t srrmxr ;u0tptoif3tatls2eluvsn() etomoctodlm e nes (0trtoir iu1ap  lnct t aDrr(mpnu0aexnifeiyt mDel(vsn() etoircoy1laDe ivs;s  etm(r oudlltemfes tf 2tau ono1open oeiadla rlumo u0aeeomr io1lpt  uvi s)trtm(mpoo1apenlfvsls)a2ta(m ;u4tet mi3iat aDra(ms (4aetnmfcoo1fp  lueo;(0 2toir iydlm elnesas a2tr( pnu1apxomociatfa emn sn(0tltrxfcto1lateauvils0s2ur(mpoodop  mnct ()aDrmxm ou0olenioeilt m ua( o (4arerxo tytoaDeauesl(  2xo(m3ny1am   ics (  Dur(m ou1alt iieiydfsDemu s t4trxnxo3ootfpD ai s;s0tetmxr3oo1ameelnes t)sDuauro;u1tetnmo3iytfmDulnmont0trxnxrcoy1faDraieo s0 2xmxr3io4opt  ivtas srumum nu0oetnif3tat sDeluvsnt)aexrifciotlpteluvi;s teuoxr nodoltn fesat) ruaxmp;t4aexn ieiyslsDumump u)aetnmf oydfpD aueo (0 etrir iu1lp   fvias sDra(rpou1aet  f3tytlmDuan s t) eenxf oy1om  livi s0 euoim3oydlme lfet t) 2umumo;t1tleomf3iaslsDrmnvp u)tlenxr3oadfaD  uvo s) exo(mpoydal nmfeslt aDumx ooo1ape iictadlmDuanvo t)trxnmo3oadfa   nei;s)srtrir3oudlleelnvilt sDrmur ;t4oeen o3tltfm2uau snu)tltrir todoat anvilt0teur(rpiydlm   ivsa( artrum nt4tpe ii3ils a el(vs u0aexrir3tatfpDe uvi s0 2tm(m3ou1alenlfeiltf Dumuronu1alx micilsfsDea(vp (0 renxo3ty1optr uei;t0 exo(o3iu1ome mfctl(fs2rrur nu1oee  f3iltlsDem(mon(4alxomr3tydoaDeanes s0 etmxm3iu1lpe lfctls)srumxr ot0ale  f3iyd m2umump;()aetriociotlmDe nvi;(  eur(o iodlpe lfeiat)sDta(  no0olen feiat aDua(mpn(4 exrif ta1la  lies;t) rtoxmpoydapt livi ( aDrru ooo0tpxnmi3tad m2ulnvon(4tlxrif ty1lp eaues;t s2xrxm3no4ale  fes s)sDumx poo0tptniiciyt m2eln snu4 ltnmocoy1fmD luvol(  rxm(opiodlp elfvtlt)s2rmxmpou4altnifeiydlm um( p;u)altomf tadla rlnvil( trxmxr oydlltnlfvs tfaDrm( pot1apx io3iysfs2um(ms;t)trxniociydfaDe ivs (0 rxr(rpno1aleelnetlt)aDumumpot0tleo fciltla2eau s;t0 renmrctodomDe i o (0trtoxopny1aptnlicsl( aDrr(mp;t1tleomfciytfa ea( pnt0aeermf iadfa eau sls0 rtm(opiy1lle  fes s)s2uru  nu4oex  fetasfa2um( o;t)texoxociydfp e n sl(0texrxo3io1llee fcilsfaruau poo1alto f3ildfmDraump u0 exoxfctodfmDrlivslt  rum(opoy4altn fvs s) rtau pou1ope  ietysfa rm(mo t)trtoxrctytlp  an i;()t2xm(r3nu1amt  fcsa()aDtrxr oo0aexo ietaslaDean s;t)artrmo3oadfmt livi;() 2toir3iy4aleemnei ()sDuaump;u1olx  ocils m eanmon()aetrmf ta1fpteli s;t) rurxrpiu1lmtemicias)arraum nt1aetomfctydls2emuvp;t4alxrio iatlm  lu s (  rtmiopoudapenlicta(fs2tr(mp;o1open feiysfm2emuvo;t) exoxrctatfaD aivi ( sruoir3nudapen neilt arurxmp;t4teeomfeiaslm2ra(ms;() etrio3oadfatr ueslt teum(o oodamtemivia()artaurp;u4tle ifcilsfs ea(mp;()aexrxr3to1lmDeaueol(  exrxo iydomtnmncsls s2urxm nu4olt ioeiysfa elnvonu4arerxr3iydoa e nvs;s s2toiopnu1ll n feiat a2ta(m ot1tetniocilt aDum(mo () rxomocoatoaD lnvi;t)sexo(r3iu4ole lneslsf rumuront4ale  iciltfm ra( o t0tlxrmo3tatfaD lnvi;t0sruo(r3ou1amtnlfviatf rua( p;t0tlenmfeiasfs rlu s;t4texnmf ia1fmtrau ol(  ruoxr3nydlleelivtas  2umu p;o1oet mi3iadls2uau pnu0tetnmrcoytfaDe i s s0s2umirpiydom nmfvt ( srraxrooo1aex  fctad m ra( p;u)alxnir io1omD auvi;s)srtm(opnu1alte nctl()s2tr(ro;u1tex mfeild m ua( o;(0 eeriociotomDr iesl(0 2tmxopio1omtnlieilt) 2umumoot4tptnif3taslsDumnvp;(0tlxrxr3iy1lmDrlueol(0setoxr iudamtemfctl( artm(mo;t4tee iociyt aDrm(vont)aexrmo3ootlp eauesl(0teurimpoy1ll emnetat) 2tr(ro;o1opt mieiltfmDulu p;()alenmrciydomt lues;s)setrxrpny4altemicsat) 2tr(mpot1aptnmieiadla2ul( sn()alxoir oodlmtr i olt tetrir nydal e nciatf Draum ;u0tlto f3ild aDra(vonu0trtoir todom  an ils0srxrxo3iy1om nmncsas  2rrump;u0tet  feiat sDrlnvpnu0aleomf iy1oaDe u o ( setm(r3ou1ap nlneslt) rta(r nt1tpeo fcildlmDuanvo;()aetnxf3ootoa  lues;s)s2uriopiu4omeemnvilsfs2raum nu4tpto i3iydlm emu pnt0 lxomrcoytomD  i s ( trtrxo oydome  feil()artaxmoot0tlxoifetadfaDul(vsn(0alxrxf3tydla r uvo;()t2tmio nydopenmiesa()sDum(mo;t1aexo iciaslaDul(vp;t)arenxfcty1fp rln o t)trumir3io4al nmfesl() 2ra( poo1aexn oeilt s elump ()aeenmfctatop  livs;(  exoim3oy4lm emnctas sDraxronu4tlxoiiciasfa2ra( p;u0aeermr3iotfp  lieo s)setmir nu1ol elfctl(faruaxr ;u4aexomfetat aDuan pnt) ltnif3oodfm   uvols)seurio3iudlle  netl( sDurxmpno0oltoif3ild sDelnmp t4trxnmo3ty1lmtr uvsl() eumim3iy4llte ictl() 2taumpnu0olxo octadfm ran on(0tlxnif3oo1opteaies;s) eumiopnudllt  feils)arua(  ;o1ope mocils a rm(vp;u)trtnif3ty1lmtr ieils trurxo iy1ope  feilt)srtauront4tpe  fctas a ra(vs;u)tlxoircto1faDrauvil(0t2trio3oudapen fvtat sDrm(rpoo1texniiciltlm em(vs;() rxnmf iadfm eaivo s0 2tmim nodlmtelfesa() rra(ro;t1opeoifeilsfm ua(vonu)altnif3oodfm  lnvo;t)s2uo(o oy4ll nlietlt  Drrxrpnt4tpxo fctad s emump u4 leomr3oadoa elnvsl()t2trxr iydaleeliet t) rua(mp;o0aee  f3tyd m umnvo;u0trenmo iy1fptelieo;(0trxmio oo4al nmfcs ()sDraxr nt1oeen f3iad m2rl( snu4trerif3tytoaDr nes;s)sexmxm3ou1ap emnvi s)aDtaurpoo4tle  fciasls2um(mp;u0 rtomr io1omtr i slt)s2xoir3oudopenmneia( arta(mp;t0alenioeiasfmDeauvs;u4areoxf3tydopt  ueo;(0trxriopio4lmte ivtlsf rrmum ;t1olt mfetysfm em( on()artnif3oydfmD ln o;t) 2toxr nu4olenmivsa(fa2rrxrpoo1tpt mictys m2rmuvpnt4 etoxf oa1lpt  i o t trurim iudomen fct ()aDtmurpot4teen oetltfaDuluvo;t0trenxf tydla  lueils) 2tmxmpiydaptnlivtat arra(rpnu1alx mf3ild m rm(mo t) leoif3iytfa rauvo;() exmio3ny1amte nesl( arur(  ;u4aptoifeiat aDem(ms;t0trxoircoadfptrau o ()srtoxr3iydlme lfes sf ruaum nt1oexoif3tytlaDuauvo;u) rtrioctotopt  n olt0 rtrio3iy1aptelfeil( s2ra(mo;u1ole mo3iydfs2emnmo (4artrxr iodoptr n slt)s2xr(r3ou1aptnmivtat srta(rpot0opxoifetysla2rmuvo;t4tlxoxrciytfpte ieolt) 2ur(rpou1olt mfvsl() Drmx p;t1oltomf3iatlaDea( p u0 lxrmo ootlpte uvo (0setoimpoydoltnlnvi t)a2uaxmoou4alen o3tltlaDea(mo;u0alxoio3iadfa e i i t  rumxr3ny4omt  nvi tfaDtau ont0aetnmfetyt m2umu p (0 etrxo3tydom   nes s s2umio iydlp   iesas a2tau  ;o4texnmociydls2emn pnu4aleomr3iytlp ranes ( s2xrirpiydom  lnctlsf ruau  ot1oex  oeiatlm2el( sn(4tltrmf3oodlaDe u ils srtmxo io4lle lfci s)sDtrxrono0oleoiiciyt m2eluvs;t0trtoxo3totlmD  ivo (0 2trio3oy4lm  lnvtlsfsDurx  ot4oet mf3tat a rmu o (4arerxf3iotoaD lnvi;() exoirpio1lmtemfvs s)arrmxront0aexnmo3iyt mDeluvp;u4 rtoioctydlpDeaueo;( srxoio oudoleemfviat sDta(mono4tpt  f3tydla ean p ()altnmociydom r i s t0 2xrxo3oo1op  mneslt)aruaumoou4aleoiiciasla2umn s t) ltnio3iatlp ean olt  2uoxo ny4ol n ncslsfa2ra(rpno1tpxo i3iad s2rauvsn(4aeeomocto1lmD lu i ( tetrirpoodoleelivs t)a2urumpot0olto fctydls2el( s u4 eeniocta1oatrln s;s0texrxr3nodllen nesa(fsDtmumooo0oee iieiytls2ranms;u) leoircoy1oat lu s (0srxo(mpou1optnmnesas) rrm(r nu4oetnmfciatfsDel(mo;()alxnxr3io1lpD  ueil(  rxmir oydlmtn icslsfsrra(ro;u1ope  oeildfsDemnvs;(0texniociatfmDr i i s) exrxo iu1lp n feslsfsrrrxm ;t4olxnioeiytfmDemnvp u4 lenio ta1fptr neolt s2xo(m3no4ame mnetls  Dtmuroou4oexo iciadla uauvo;()aexoxf3oytfa raiei;t)trum(o3nu1op nlncils s2urxro;o0tlt mi3iad a2uanvs;(4 eeoxf tydfpteauvo;s0s2urirpiy4omeemnetas arrru oot4aptniiciad s el(vs;t0arxnif3ia1fm ean i;() rtr(m3oydap   nct sfa2urumpnu1texoii3ild s2eluvs t4 lxomrcio1lptelueo t)t2xrxo nydol  lnet s a2tau poo4tee mfciydla2rmnvo (4 rtnxf3iotfatean s;(  ruoxr oo4om  lfetas)srtax  ot4tpto oeiytlm2elnvon(0 reomf3tadfp e ueo t s2toim3oy4ameemfcsat a2tax pnt0aeeoifciatfs2rauvon()aetomr3ta1la  anvi;s) rxoimpnu1lm   ivtlt)arumump;u0aet mfctls m2ranvp t)tlxrxo3ta1fpDe ueils)srxmxm3iu4op e fcta()aDrax o;t0optn ietysfa2rl( s u0teeomf3iy1late ivils)srtmxrpny1ll n fcils)sDumur no1aleo oetad mDuanmo u0tltnxrcoydfa raivols t2toimpno1opt liet (farururpnt0tpt  ietltlmDrluvs u) rerifciadfm r n ilt sexo(r ny1am  lnvta()srta( pou4apt moeiyslmDra( s t4tlxoir iatom   ivi;t) 2uoiopno4ap nlivtatfsrum(  oo4altnif3iydfa ulnmo u0tetnif ootfpteliei ()tetoirpnu4lpenmicsat)arur(mp;t0oleoioeiasfm eanvpn(4aetrxr3iy1latelies;()sruoio oydol emncslsfaDua(m ou0alen fetysfsDrauvpnt0aetomrcoodfpt luvils  2to(rpoy1ole lfesat aDtm( poo4tpxnio3iydfa2elnmo;()teeomocoa1oateau olt texoimpiudll nlnvsa()s2raxm ou4opt mfeilt s2elu o;u)texrmr ty1fa rli ols0 rxrio3nudol  mfct ()s2um( ooo1oltnifciltfa rm(mo;u0trxnif tatfmt aies;(  2tmimpnydameelfet ( sDrr(rpoo1aetn fetls sDrau p;t) ltrxr3io1lat aneo t t2trxm3oydlm  lncias)aDtrur nu4oeeo o3iyd m ulu s;u4tlerir3oatla r nvslt)s2xmimpno1ol e ieil(  Duru pou0tlt iiciydlmDeaumsnu0aeenmf3ty1la   uvs;t)trto(rpiudap nmfeiat)srumu onu4aeenmfctldla2eanmo u0texnif3ootlmtraies s  etr(rpiodopeelnvsls) rrax p;o0tle  o3iytlmDua( pnt4texoxo iatlpDeanvilt)setoxo io4aleemfviltfa2rr(roou4apenmi3tldfs eanvpn() ltrmo3oadopt  ues;s t2urxr iu1ape mfvil( srurxrpnu4tlen feiaslaDrmums;t4trtomrcio1om   i o t) rtmxr nodamee netas sDumum ;u4alenifcias aDumums;(0alxrxr3oatlpDe nvo;(  2xoxrpnu4lmt lfvt (f rurxmo;t4aleoiictasfm umnvo;t) rtoxrciadomD auei ( s2to(o io4ol n ncilt sDta(rpno0tlt  fcias aDuanvsnt) ltrxo3iodoaDeluvo ()srtrir3ny1ol nlictltfaDrax pot4apx mi3tas aDeanvont4altoxf tatfaDe ues t srxo(opiy4omeelfvsls arur(mp;u4tpxnii3iydfsDuaumonu)treomf3ty1lpD anesls srxoio iu1ape mnvtasf Duaxmpno0tleo o3tld a2rm(vo;() ltomr3iodfpDe uvi t0texr(m nudalt lfvt s  Dtaxmono4oex  oetadlm2umnvp;(0aeerxrcoytomtr i s s  rtmim3nudlm elfct (  Drrxm oo1apeomfetyt m el(mo;u) lxrxr3oo1oatrlneo;t)t2xmio3nudll  lfeiat  Dum(moot4apenifctasfa elnvs t4 eenxf3iotfmDeaivo;s seurim3nu1ame mfvsat  2ururp;u1aexnif3iyd aDranmp;t)tetrmr todoa rln s;()setrxr oy4ap nlfvtas) 2tmu p;t0tpto iciltfa2rl(vp;() rermr oytfat lu o s  2uo(opnodap  mfesl(f Drr(r ;t0oex if3iytfs ulu o;() renmf3tatoaDr ieo;s tetmxo oy1apte nes () rrru p;o0tet ifcilslsDra(vs t4aleoio3ta1lp  auei;t  2urxrpnydomenlnvi sfaDra(  ;o4ape mieildls ra(mo;(0alxoifctatfpt aivo t0 2tm(mpno1ap  mnes s) 2uau  ot0apxnmoeildlm ul( p u0artnmrciytfpt  ieol(0sexmirpno1lltemfetl(f 2ta(mp;u4tlenmoetltfs ranmo t0alerxr3iytfatrlnvi;(0 2xo(mpou1omt liet ( artr(  ot1aptnio3iadfs2ulnvp u0trtoxr3oodop eluvs;s0trxrxm3iu1llt lnvilsfa2uaur nt4texoio3iyd s2umn o;(4altoxocootoa rau i t seum(r oudopenlfciat sDtmuro;u4olxn f3ildlsDrl(ms;u0 eeomrciotfm  luvil(  rxoxm oy4olenmnei tfsrrmxmonu1ope mfetlslm2ulu o t0 ltoirciatoaDeln i;t srxr(r iu4alt mfesa(  rtauro;u4aex ioetat mDum( ont) etomo3io1fmDeanvi ()t2toxr iu4lm elies (  Dra(  no1tpx io3iydfa2rmnvonu4texnifcia1lp e ivol()sexoiopiu1op  mietltfsrtmxrpnu1teeoioctld sDra( s t) exnxr3tydlpDrau ilt tetoxrpoudamte nvi sfsDtr(monu0optn f3ils a em(vs;u4tetoxo3ty1fat an i;(0teumxo ny4optemnei (  Dur( o;t4tlenmf3tadfsDeln pn(4 eenio oy1fatelivo;(0 euoio no4al nlivtlt)s2uax  ;t4apeomieiys a2rmnvsnu) eermrcio1oaDrlues (0s2xo(mpou4apt  ivtlt a2raump;u0optnmf3iasfa2um(msnt4trxnmo oodoa eau ils) 2ur(m3nu4al   nvilsf rrruro;o1opxnmf3tld mDumnmo;u4 rxrxf iatlpDr i s;t0srurxrpny1ame mncs (  2ua(  no4tlx  o3iad m2ulu o t)trtrifctodom elnei ()teuoxopiu4lp   fcs s  Dtm( pot4oeeo o3ils m2uauvpnu4tetnif3tytom raneolt) 2xr(rpoo1ole mnvi sf Dtrxrpot4oeeo octltls2ulnvo t4artnmrcoy1laD lueo;t0sruo(opoodalee ivi s)artmxm oo4oee  f3iasfm rm(von() rxrir3totlmtr uvi;() rtrio oy4aptelnvtl()aDtau  ;u4oeeo fciasfs emnmsnt4tetoircoo1lmt lueo s s2umir3no1ope  netl( a2umx ooo1opeoio3iat m rmnmont)alxomr iy1opDr nvslt0trur(o iydlme mivil(f 2rru o;u4ope ioeias a2ul(mpn() ltomr ia1fm r i olt)truo(o iy4lle  iet t)srrmxrp;t1altomicild s2rm(vo;(0tlxoxr3oa1fm  auei s)tetoxopoy4lmt mfetas) 2tm( p;u0opx  ieilt a rmu snu4alxrxrcoodla rlivo;(0t2umxm3io1lpenlnvilt) Dtru  ;t0olxnmietat s2eau on(0artrxfcoytlaDe n i s)tetrio iy4ll  lics (faDrau  oo1tex mi3tysls emu o (4 lenmf iy1lp   ieo;t)texrimpiu4lp  mictls a2ua(rp;u1tpen feiasfmDel(mp;t0 etnxo iatfm rluvs;s0s2tr(r iy1lm elnvtlt) rurumpoo0tltn octls a2el( p;(4teerircto1lat li olt trxrir io4lmeemfcsat)a2tr(m nu4texn ociatfa2elump (0 ltrmf io1fpD luesls0tetmir oudapte nct t)artax p;o4apxo f3iaslm2emu o (4aetnxf3ty1faD an o;t0sruoio nodop  mfvtls  2uru  ;o0tpx ioeiadla2uanvp;t0tlxrif3to1lp  lieils  2xm(o no4op n ivsl( sDtmu pnu1tlx mf3iytfmDrlnvo;(4artrmf3todfpDeln o t) rxoir3iudlptnmfeiasfs2rrxmoot1ope if3iyt sDea(vp t0aleoir iatfmDeauei;t sexo(m3nydape  iviatfsDrax  oo1aptoifciydlmDrmumon(4 lxrio3totfm eanvi;t sruo(rpou4ole lfctasfaDtmu onu1apeo fetltlm2uln s;(4altnifctodfpD lnvi t)sexm(m nydomt lfctlt)a2uaurpnt1ape iicils aDrmumpnu)tlermf totfatrai i;(0srxmxm nodome  fvtas srtax  ot0apxn fciatfm2elnvp;t4arerioctotfa r u i;s0t2tr(r3oydlpte ict t arurxmo;o4ape  fciyd m emn pn() ltrirciadfp  aivo s)s2trim ny1alt mivia( s2uaur nt0oetnifeiydlm ea( p (0treriocto1fmDrauvi (  etm(rpiudlptn nei s)arrm( ont1teen i3iasfm uauvo t4 etrmf oa1om rlnes;t0 ruo(r3nydal nlneils)sDrrx poo4teeomi3iltfs eluvp u0artnxf3ta1oateai i;s)t2umim oudaptelivs t) 2raum nt4tltnmfciasls2emu pn(0aetnmr3iotopte ieils  rur(r3oodomeemncslt)s2taum ;t1tpxoioeiytla ean o;(0aetomr oa1fm raues;s) rxo(rpiu1olt  fvsas) Drm(r ;o1optoio3ilt aDelnmp u0 exrxfcio1faD  uvsl(  rxoiopno1aleemfvsat  2urur ;o1oltnii3ildfm ea( p t0arerxr oytomt li ol() 2toxr nu1om   iesls) Drru ont0alxoif3iyslmDuanms (
\ No newline at end of file
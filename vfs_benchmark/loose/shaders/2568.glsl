@@ -0,0 +1 @@
+n ils)seurxo3iudapt mnetls) 2uax oot0aet moeiytla2eauvp u4 rtoif oa1oa r n i;s0 etmxo3ou4alt lfet ()sDraxmono0alx  fetysfaDra( s u0 lerxf3iotfpDrli o s0 rxm(opiodll   iet t) Dtau  oo4tpxo ocilt m eauvsn(0tetomr oo1lp rlieols)srxrxm io4lm  mfvias s2umu ooo4aexo f3iyt mDuanmo;t4 etrmf3todfp e neolt trum(r3ny4amen ies t) rraumo;u1tptomieiytlm2rauvon()tetriociydlptr nvils0t2uo(r3nu1lm   nci ( s2uaxmp;t0aetoiocild aDem( p;u4 rxoir oo1lmDr n o;t0 2toio3oydap nmnesat)artmxmono0apxniictldfmDelnmo;t4tlxrxo3oytfaDrauvol(  etrxo3no4lmt livtltfs2ua( pot1oex mieils a2em( sn(4 rxoxf3oo1omD  ivs;( t2umxopoodlp nlnvia(fs2ua(ro;o0opeo i3ias sDulnms;t0alxrmfctydfat  nvils)srtr(mpnodllen neil(fsrrrxr ot1tetomfciytfm emn pnt)teeoxf3ty1fa eanvslt  rxo(o3nydomenmnetat)aDraxronu4alx ioeiatla2rmuvp;u0 lerxrciotfat luei;( setoxo3ny4apt mnctat) Dtrxm ot4tptnmoetadla uln s;() ltnxo iy1faD  i il( sexr(m no1apenmfvi sf 2ta(m ou4altn i3tltfs2emn pnu4 eeomocto1lp rlnvils0 eumim3no1llee nesls  rurx onu4optnioctldfm ua( pn(0tlxrmoctydlmDrlneo;s srto(m nudamt mictat)a2uaump;t1olx  ocildlm umnvo (0 etrircoodfmtr nvsl()setm(r iydoptnlnci sfartmum nu4ape mi3taslm ea( on() lermr iytfpDr ues;t) rxr(r io1amee neia(fa2tm(mo;o0tetnmo3tld sDumnmont4 lxoio3ty1fpt  ivi s  2xoimpoudlmen ncs t  rtaumoot4tpxo oetatls2um(msnt0tlenxr ootlmDr ivsl()trxrio nu1omt lncil()s2um( pou0tet moeiydla2uaumpnt0 leoif iatlaDrlues;(0srxm(r3iudlpt  nvtat sDrmxmoot4oltnifcildls el( snt)aeerio3to1fp eanvi;t)texo(o3io4ol elfvia( aDtrxmo;u0tlt iiciasls ea( o t)alxomr3ootlpD  n o;s)trtmirpou1apenlfvt s) rrmxm no0olt moctydfm um(vont0 lxoir3iatop raies ( srur(r3nydap  liet ()sDtmxr ;o0aptoifctltfa2ea(vs;()trtnif tadfp rli s t)seuoxm oy4op n nviat) 2raxmpoo0oee ifetydfmDrmn o (4 eenif3iodoatrln i;() rurxr oo1olen icslt  Drau poo0openifctytls ul(vpnu4tlermf3tadlpDr n s s s2uoio3iydlpee fcilt s2tr(rpoo1oexn ieilsls2ulnvont4texomrcty1fmt luvo s sruo(o3nydlpe  fctatf Dta( pno0aexn i3tlslm2ul(vsn()aexrifcootfm  luvi s0trtoxmpoo4op nlnetltfs2tmu pno1apt iiciytfsDeauvo;(4artomocty1oa e u ol( t2toxm3no1alt liet s srtr(r ;o4teen iciadla el(vs;t4teeoxf3oy1fateaieo t0 rto(o3iy4ape  fcils)s2rax  ot1apt mocildlaDuaumsnt)tleoir oy1oaD aivil()t2trxo oy1optemictlt a2trx p;u1aexoii3iyd s rm(vs t) renxrcoodoptraivs s0 2xoirpiudopen nvtltfsDrr(mont4oex mo3iydls uln s u)trtnir3oytom e uvi ( tetoxm iu1lp elfet (fs2ur(r ;u4olenmf3iadfs rm( sn()arxnif oo1lm rli i (0 2uoxo oudlme mfct sfarrmx oot0apt mi3iytfs2emnmsn(4 rerxrcoy1lat au olt t2xr(r ou4lme lfvs (  Durxr ou1oeto f3tlsla2el(ms;u0treoif3oytlatr iei t)trtm(o ou1ape  ictlt sDtax pnt0tpen i3iatfm ea(mo u) eeomo3iatlmteluvils)s2urxopno4llenmfvslt)aDraum nu1aexoiieild mDemu s;u)texomf3tydlmDrliei s) eurxr3ou1op e ietl(fartmuroot0teeomiciasfa2uanvpnt0 exomf tydlaD anesl()seurimpiu4am nlfviat)aDrru p;t4oeto ictytfsDra(vo u4 eeoirciotfmD li olt trxrim3nu4omte net ( a2rmum ou1oet  fciadfa rauvp;u) lenir tatom eai i t) ruo(o io4lpee nctlt aDta(mo;o1tee mietatfa emnmsnt)aetomf totfpt au s s seum(r3oo4apt micsl(f rtmx  oo4aptnifeiydfs2rmu o u) etoxf oytoa   i i s srurxr nudal emfeslsfa2tmxm oo0tle mo3ias s el(monu) rtnmr3oo1opt liei;(0s2xoimpio1optelict t)s2uax p;o4oeenmf3tltfm emuvo u0trxrmo3iydoateauesl( texmim io4ole livta(f ruaur no0tpxoifciydfa rl(mpnu) eeomf3to1fp elues;t0trumxr3oy1oleelneil(fsrrmur nt1teeo i3tasla2umnvp;u0alermr tatlmDeai o;t) exo(opnudope  ictl(  2uau  nt1teeomf3ils s2rm(vp;()tlxnmo3iatomt lues t trurxr iu4llenmies (fa2raxmooo0aexn oeildlm rl(mo;t)tltomr3tadfpD ln ols0setmim3nu4am nlfvtlt  2trx pot4olx mocildla ul( s (4 etomr3tydlmtraivo;( t2xm(m3ny4oleelfvsa( s2taxmpou0apt io3iydlaDelnvsnt0 exomf oa1lmt  nvi (0s2xoio iy4ap elnvt s srum( pnt4ape io3iaslmDeanvsnu4aexoio3iotfpt au i ()tetrxr oydlp nlfvsl(fsDrr(ro;u4tpxomiciyt a2ulu s u4 rtoxf tytlmt au s s  etm(r3oo1ol nmnetlt artm(r ;t1olt ifciltlm em(vo;u4tlxomo3to1fpDran il() 2trxo iu4omtnlnvta(f Duax p;t0tetniictls a2rlnvp ()altrxrcoydla e u olt0texr(rpiy4op  lncsl( aDumxr no0olxnifciltlm2umu o;u)aetoxrctydfpt  u s;(0s2tm(o3ny1lp nmiesas)aDtruroou1tpt ioeilslm2rmump (4arerxo3tadopD  i s t t2trimpoo1olee nvtlsf 2ua(r nt4alenmfciatfmDra( o;(4trxnxrctatla e ivils0 euoxr iy4lptelfvia( s2rr(r ot1aexnmiciyt aDeln onu4trerif ty1fp  li s;(0trxrirpnydap n neilt  Dtaumooo4alx ioeilt a rauvs;t4arenifcoatlpD luvols texmxo3nu1lleemivsls sDrr(mo;u1tlx iietydls ea(vp u4artomo3oadlaDr u o;(0tetr(r oo4al nlfctl( srtaxroou0ape mi3iad m2rmu o u4texrmf io1oa rlnvol() rurir3ny4ll n ncslt sDur(rpno4ale  oeiasfmDumu on(4alerxf oa1oaDr i i s seumir iudlp emfvt (fs2rmxroou4texnioeild sDel(ms;u0artnir oodfpt  iei;s0sruo(rpoo4ol nmiciltfsrtax p;o1olt ifctldfm2eauvo (4alxniociytfatrlu ols0tetoim oydom   nvi t aDua( o;o1aetoifeiltls2umu s t)aetnircoytlaDrau i;( t2um(o iudoptemncsas) rumxrp;o1oex if3iytfaDrlnmon(4texnif3oytopteai s;t0texoim3oydllenlnet ()sDrau p;u0tpxn f3tys sDum( o u0teenmfctatfmt ai ilt)trxm(opio4optnmnvsa( s2rmxm ot4oetnmfetldfa ea(vp;(4trxrxo3iotomD livi s0 rxrio3oy4alee ncias)a2tau p;o0altniicildfs elu o u4treomo ia1la   ues;()setoir oo1opt lnct tfa2trx pno0ope  i3tyd a2ulumpnu4 rxnircootfmt aneo ()srtoim iydamt  fvt ()srrrxmont0tlto octydfs2emumo t) eenmf3oo1faDrlueo;s trur(rpiudlm emfvils)srrm(root0tpx  iciyd m emumo u)aeerif3to1opDe uvils) exo(opnu1ome  nei ()sDumxrp;t1tpt  oeiysfm2uauvp t4arenxfcoa1oa  aivi t)trtrim iy4lltnmnvtas a2tr(moou0tee ii3iysfaDem( o (4tetoir ty1lmte ivils0truoirpny4oltnlies t)sDurum ;t1olxoiictyt aDelump (0altrxr oy1omtrai ilt srtmir3iodap  mfetatfs2ur(ro;u4tleoiictydfs rmumpnt)tlenmo tatomtraivo;t) rtm(rpiodam nmnctlt aDrmu ono1apeo ieiasfm ean pnt0tltrxr totomDr ivo;()srxm(opoy1lp   fci (f Dumurpnu0oleomoctld a emuvs u)tltoxrctodfpDeauvols)s2urirpiudlpte netlt s2rrumono0tlt iictls m2um(ms u0tlxoioctytom ean o;s  2trxopnydome mncs ( sDrr( o;o1aee mietytfs2ra( s;t)aeermf tydom e u o;t t2umim iy1lmte nvs () Drrumoot1ope moctadlm2uau s u0trxrmf ootlp r i s;(  euo(mpny4om   fvslt)aDtrxmoou4aexnmfciys m ul( pn(4tltrxfcto1fm elnvs ( s2xo(opnudaleelfcsat  Drru  nt1tleomieiadls2ul(vs;u)trxomfctydfm  an il( tetoiopny4aptn nesl(  Drru  ;t1opx  icias s emn sn() lxnxocto1lm  lnvs (  exoxm iodlltemnet s arrrx oot0aeeomo3tlsfaDraumsnt)tlxrmociatop e nvi s s2um(opiydamtn fct (  Drauronu0oetomieild aDrl(msnt0aetnmoctotfpt  neo s  2toxm3oy4omtemncslt)srtm(rono1tlx iictyd a em(von()texrxociodlmDelu il( trxmxr nodalt mnvta(f rrmxr ;t1tlx  oetas m rlnms;t)altrxo3oa1fa r ivs (0setriopoo4omtn fesa()a2ur(r ;t1oeeomfetatfaDul( o u)texoxf oy1lmD  ieo;t trxrxr iu4lmtemfetl(  Duau  ;t0aetn f3ild s2rm(msn(0arxomr oatlpDr nei;()t2to(rpnudlle  nvsa() rtau  nt0apxn oeilsls2uluvp;() lxrxfctodoptrluei s0s2toiopnu4lltnmfeia(fa2rauroot1oetnioeiasfm2em( s;t0 rxoir oatfa eanvs (0teuoxo no4lleemfctas aDtr( pou1tpxnmf3ilsls2rmu p t)trtrmo oy1fa rlnvolt texo(o nodapt lfvs t) Dtrxmp;o0aeeniicilsls2uln pnu)tlxomf oadlaDeaueo;()teur(o io1al emivtlt)s2raxm ;u0opxniociys a2umumpn(0arxoio3tydopt lies;(0t2tr(o3ou4ol e feiat) rrmuro;o1texnmocilsfaDrmnvonu0 rtrxf3iotopDrlu i ()trxm(r no1lmtnmfetlt) 2raxmpoo1apxomfciysfaDeanmp;t) renmr tytlpD lu il(0s2xrio ou1opte nci ( arrauro;t0alxn fetaslmDul(mo;u)altrxf3ia1lmD li o ()truoiopny4opt lnctat)arumump;t0oeeomf3tadls em(ms;(4alerxo3iydfmD  u o;( teur(rpiydaltelfes t) Dum(rpot0openmo3iyd sDrm(vonu4arerif3oa1lptraivs t0t2toirpiudomeemnvtlsfa2umx oou0opeoio3iasfmDemu s u0tlxoxrciadopD au o;(0setrxo ou1lp nmfcsls  2um(ro;t1apx mi3iat m2ra(vp (4aexoif tadop  anvil( tetoim nu4llen fviasf rrr(ront1aeen feiytfm rm( p u4alermr3oa1fpt lnei;t tetrxm iy1amee fciat srrmxrpnu1tex io3ilslm2ra( snt) leoio3io1opDe nvol()s2xr(r3oo4om e iviltfsDrr( onu1ope mo3ils aDuauvp t0trxniocta1la ranvi;s trum(m3ny1olte netat srrmxro;o4ole mieiydlsDumump (0treoxf3iydfatraueslt) eur(mpiudllt mfeta() rrrx poo1oltnmo3ilsla2um(vs;(0texnmoctotopDe nvol(  rxm(opiy4lp nmnvslt aDurxr ot0teen o3tatfs eaump;()artomf3tadlm   i s ()trumir ou1llt  iet s aruaxront4apto fetltfs2rm( p t)arxoif oadfp elu i;t0 2umir3iy1lpt mnesatfaDta(mo;o4teenmoctytfaDemnvo;t0alxnir oo1lpDelieil() 2toio oodom   ivsa( aDur( oot1olt mo3iad mDrlnmpnu4aetrxo ta1oateaneo s0sexmio io4lle micsl(fsDtaxrpno1oetoiociytfsDum( p t4alxnxr3oo1fpD aivol(0 rxm(o oudal nlfesas) Dum(r ;o1texomi3iltfaDem( pnu0 eeoirciatlpt luvs () 2xoim3nydalte fctat s2rr(m ;u4apxoiicilt m2ra(vpnt0artrxf oadlaDeanvi;t) rtrxr ny4ameemnviltf Drr(rp;u1olt micildfs2uluvonu0tetnif tatop  lneol() eurio iu1aleemicslt arrrxr ;t1tpxnioeiytfsDra(mo u0altomf3to1la  lueo (0s2xoxm3ou1alee fvtl( a2urxmpno0tpeniociad a2rlump u0alxrmo iy1lat luvs (0 ruoirpny4ap   ncilt arumxrp;t0olen f3tldfmDuaumo;t) exrxfciatoptraies s  rtrxm iu1optnmieia( s2uaxmoou4tetomictysfm2uln s u4tlxomoctadfm rlu o;()setrxm iudome lfvtls sruax oot4alen oetldfm2rlnvsnt)teeoif to1fpte i slt)t2toio iy4lmen nci () Dtau  ;u4oexnmf3tydlsDul(vp;u)aexrxf3totlm eli sls teumimpiu1ap n iei t  2rmxmono0texomoeiatfa eanvs;t)arxrmr iytla e i sl(  rtrxopnudopteliet s  Dua(  nt4opt ii3iad a elnmp (4 rtrmo ia1fpDelnvs;t) rxo(r3nu4lpt  fvs (fartrxm nu1altomiciat sDul( p;() ltoxo ia1oa e nvs;( setm(opou1ol n ics (  Dra(rp;o1alx mf3tadfm em(ms t)trtrmr3oytla e i s (0 exr(o io4lp   fcsat) ruru p;t4aeeo fcild mDuan p;u)altoxf tytoptraueils  rtr(rpio4lmt  ictlsf rtrxmpoo4tltniieils s2ua(mont4 rtrifctodlm  ai o (0teurxr ou1lm e neiatf Durur ;o4tptomi3iysls ul( s;u4altoxr3io1oateai i s tetoio3io1optn fei sfsrtaump;u4ole  fetldla2elnms;()tltoxrciotlm   ivo;t0srxrxopnudale miesa(  Dur( ooo0ale  iciltfmDea(ms;()arerifcta1fmt lu s s)t2ur(m oodopte nvtl()sDrr(mp;t0alt  i3iad s2emnvp;(0aetoxo3oodom rlies s)trxm(r oydam emnei (  Dtm(ro;u1tlxo fciatlmDum( p ()tetomf3oydlmte iei ()srum(r3oy1lmenlnctl()arur(  no1teto iciydlmDra( o u4 rxnmr3tatop  lnes;s  rurirpnudllt miei sf 2umxr oo0olenifeildfa2ranms u0 etrif iotoa  luvilt  rtrimpiudlptnmnet t)srtmu  oo1alxo ieiyd s elnvonu4teerxo oytlpD liei;()trxrir oudll e nvsl()sDtmxrono0aet iiciadfa ra(vo u0trtnxociy1fmtrlnesl(  rtr(mpnodopenlfcia(f 2ta(r ot4ape  octatfs ra(vo ()aetomr3iytoptrai s;(0s2trxrpiodll  lncsat)s2rrxmonu1oexn ieiytfsDelump;(0 exrif iatfatr n o t0setoim3oudlptnmnvtltfa2ur( pot0tpxnmf3iydfs elnvpnt0texoif oy1faD ai ols setmir iy1lltn fvi ()s2urxm ou4alenmo3ild m2eaumpnu)trxrmf iytfmDrli o;()texmxm oudlltelietlt) Drrxmo;o0ole mfeiydla ul(ms u4aexoir3todoa   uvo;(0 ruo(mpoo4amtemfcilt)srrmur ot0tpxn o3iydlsDulu pnt4tlenio tydlm eai s ( s2trim nydoltelfctas aDua(  ot0altn fcilsfm eau p (0 eenmf3tadlpD  uei;s setmxo3iudoltn ieiat)arrr(m ;u0tlt  fetls s2rlump;(0texoio3to1fp  ai ols t2xoxopou4ol emivi s) Drm(m nt0olxn ieiydlm em(vo u4 lxrmo3oo1latr uvslt tetmio3iy1lptemnvtlt s2ta(  ot1oetomfetltlm2emnmonu0arerif3ty1lpD li o s0trxoxo ny1ameemivsa(  Dtr( p;o0teeoif3ild sDrmnvp u)trtnxf3oo1fpD lnes;t0t2xr(m iudll  lnesls) Dtax  oo0alx mocildla2uanvo;() eeomr3ootfpte u s t t2to(m ou4om emneiat srta(rp;u1olt ifciat m2ulu s;(4 exnxf3ty1optelivi t  rumxo no4ol elnvsas  2uau p;t0opxnio3tytfm umu p;t4tetrio iodomD lnvsl() 2umir iy1omeemncilt)aDrmx p;o1apxnmf3iyd m2ranmpnt0tlxrxrcty1faD lnei;s  exrxm3nu1opeelncsas)sDta(rpnt1aleoifeiadfs rmn s t) rtnmrctydoptranvil(0texmim oodomt lnci s)arraxmont4oeenmi3iad a2ua( ont4trxnxfcoatomD aieils t2tr(o oodalt miei s  rtrx o;o1oltomfciasfs rmn p u0alenxf3oy1omtran s;s0 euoiopny4openmietlsf 2uaum ot0alt  i3iat a2rlnmon() ltnmo oadlmDelies;(  etoir nydlme  ncsl( a2tmx pnu4aeto icilsfaDeaumo (4alxnmo iydopDran s;s0trtrimpoy4ome licias)aDuax o;o0tltomf3tlt m2ulump;u0 renio iotla raies;(  etmxm oodll  mfvt (  2rrumono1olxoif3tadlm2el( p u) eeoio oydlpDr u i (  rtmimpiy1ap n fvs (f 2ra(  ;o1tpx iieiaslaDemnvpnu) rtnmf3to1fpDrlnei t)t2xm(o oy4aleelfcils artm(monu1altomfctat sDem( p;u0 eenxf3ty1oa   u s;t)s2trir3nodale lfetl() rrrxmpot1tlx miciytfm el(ms u0 eenio iydfmD li ilt srtm(m io1omen ieslt) rrrxm oo0opt ioeiys m rln sn(4teeoif oadfptr iesls0 eto(rpiodome lfcsl(f Drr( oot4opxo ocildlm2ua(vo;()tlxoxr3oatfmtr iesls)tetoim3oy4openmietlt)srua(m ou0ale  i3tysfm2uan on(4 lxnmo ty1fpDraieilt0srurio nu4altemiciltf rrr(mp;t0tlto ocild sDrl(vp;t) rtniociadfa r neo ( t2trim3iodoltelneslt srta(ro;u4tltn o3taslm rlu o u4texoxfcoo1oaD aivil( trxo(mpoydaptelictls)a2ururoot4apxnmo3tyd s2ul( s;(0aexnxr ootlmtran sl() 2toir3io4ope lnvtasf 2tau ont1oeenif3tydfmDelnvs t4aeerif oadfp eaies;s0 rurxo3iu4lpe lfci t  Dumx pnt1aee mi3iys m2rau s u4tlxnxf3oa1lpDeln ol(0s2xriopiu1lltemfvt sfsrta( pnu0apxomiciatla em(vo u)aeerxo3oy1lateaueo;t)sexmim3ou4lltnmfctatf Duru o;t1alt  f3tysla elu on(0 etomocoodfatelnvo;s  eur(m ou4ape mnvsa()aDra(m nt1opxomi3iatlaDraumo (4 eeoxr io1fm  ai il() etm(r iy1am nmnesa(fsrtr(mpnu1tetn f3tasla ulumont)arenxr3ootla raieolt trtm(rpny1ameemfvil(fs2uaxm ;o4tlx  o3ilt sDeaumsn(4tlermo oo1oaDranes;s0s2xmxo iudop e iesasfaDta( oou1tleoioeildfa em(vp;u4artrxo3iotlm   uvils setm(o3ny1ll e iesa(fsrum(rpou4tlxo ocildfs2rlnms;u)aexoxr tytfm   neo;s tetoxm3ny1om   ncs sf Dum(ront4teeoif3iys sDranvonu4texoxrcia1laD aivsls) rto(r3ou1alt mnes ()srta(ronu1tlenmfctad a emnmsnu)arxoxfciotoat  ueol()teur(o ny4opt mfeils) Duaxm ou4teenifetys sDel(vp u0treomo ty1op   nesl(0 2tm(r3iodapt miei t a2trxr ou4optn oetld aDrln p u4tleomrciatlpt  nvi (  2trxr io1oleemfvsa(faDtm(r ot4aet moeiasfs rlnvs;t)trtrmfciatopDelies;t tetrir3iu4alenmfetlsfa2rr(mpoo4tpt mociatls emu s;t4 renmo oa1oat  ivsls)setoxo3iy4opte fct s artr(mp;t1tex if3iad m uan s () etnxr3tytlmDeauvi;s0texr(mpio4ap  lieias) rrru oou4tex  oeild a umumo t)tltnmf3iy1fm r nes;s0 rum(r oy4ol  livia( artaxrp;t0apxoii3iltlm2umuvo u0teeomo3oy1fm r n i ( tetm(o ny1op emics () Duaxmpoo4oexn i3tad sDeau onu0altrxf3iotla  anesls trxmirpiy4lpt mfcil(  2rrur no4alto f3tlt m2em(mo ()arxoif oadfaD ln s t0 2toxmpiodlmt mfci (  Dtm( oou1teen ocildls eanmp t)tetrir3todlaDelneolt0s2xoim nu4ll  lnctl( srtmxr ;o0olx ifetyt aDem( on()trtnmr oatop eau s;t) rtrir3iy4alenlnet (faDuaxmoou1oex  octatls2uanmo (4altoiociydlaDrli ols trtr(opno4llee net ( arum(rpou0alx mieils aDemuvo;(0 lxomrcto1op   ueo (0 exr(rpoy4ome mies s) rtmum nt0tpt  feildfs emu p;(4arxoio3oa1om rau il(  eto(mpiudlpt micilt srtmxr oo1aee mf3iyd s2em(mo;t0 eerxrciy1faDrlu s t0trxm(opio1oltn nci ()aDrr(rono0aet mo3iltfm2ul( p;(0arxrxrcia1lp   nes t) euoxopou1lp e net tf rrr(  ;t0openifciyd a em( o;u4artrmocio1oa  auvs ()trxrimpiodaltnmnct s) rururont1tpe mf3ildlm2rluvon()trtrir tadla   ieslt)trxoxm3oydolee nciatf 2tm(rpoo1alen icildfs ul(vo;()arerio ootfm e uei;s t2xo(rpiudlm   feils sDtmxrp;u1tetnmf3tad mDulump u0 renxo iatlpD  uei;s)s2umxo3ou1omtelfvtatfsrrmumooo0opxoii3tadfs ea( s u0altrircoatop rluei;s setmxr3iy1oltemici t sDtaur ;o1oexo fciaslm uan o ()aeerir3to1fpD lieilt setrxrpiydlm e fvtat)s2rmu  nt0aet mfetlt a eaums;(4tlerxf3iytfm  li s;s0seuo(rpio4lm elietas s2tmum ;o4tlt ifeiad aDel( s u4altnir oa1om e nvi t  eurirpoydam n icilsfaDrrxmo;u4opt mo3iltlsDuln p (0 rxnmf3oatoaD  n s;( t2toirpnu1lltn ies t  rum(root0tltoifetydfm2em( p;()tltomo3iotom   iei () 2uo(rpoy4ap e ies tfaDua(mono4tpt mieiltls2umu pnu) rtnmf3tydlmD lieslt)setrio3ou4oltnlncilt aDtau onu0oltnii3iat aDumnmp;t) ltrxo tadoatranei;s0sruoio oo4lpe  fcslt)a2uaxrp;t1oee  fctltfa2ulumo;t4 ltomo3io1fatrai il( trxo(o3iudamtemfcilt aDra(m nt0alxo oetatla2uau p;t0 reoxrcoo1fatrlivi (0seumim oy1apt miviatf rumxr ;t4openiicildfa2rlnvp;(4tlenioctotfaDr nvil( t2xrio3iy1op   nctl( aDumu  nt1tltoiiciysfmDem(vp;u4alxnxo io1laDe neo (0 2tmio3io1lle lics t artr(  nt4apxomietlsfa el(vo (4tltrxocta1lateanvolt trtmxo3no1lpt mies t) Drrxmpou4alxomociadlmDrl(vp;u0 lenir3oa1fpDe ivs (0srtm(mpoydlp n icil(  2tm(r nt0oet ifeiytls2em( o u4texrmf ootfpteauvi;( srto(mpio4ll   ncsas)s2ra( pno4optn feiyt a2rmumo ()teeoifciodoatr uvo t s2umxmpiy4op e nes tfaDuaurp;t0olxomi3ilsfa2ea(msnu4treoir3iatlat livi;( t2um(m3oydlmtnlnei ()s2uaum ou0aleomoeiltfaDul(mont4 ltomrcto1oateau s ()s2umimpoy4omteliet t aDuau oou0tetnif3iyt s2ra( snt)aetrifcoodfmDraneo t0truoxo3ou4ame mfei (fsDtaxmpnu4tleoifciatls rln p;t) ltomo3iadfp e i il(0tetrxrpnodomt  nvil() Dra(mo;u1alt mf3iysfmDelu pnt4 reoif3oadlmt aueol() ruoim iy1op  livi tfaDurxmpno4alt  ietat s umuvo;(0 rxnxo3iy1fmtr ivols t2um(m iodom elfctat)srrm(mp;t0aet  o3tlt sDel(mp u4 exrir3to1lmtraivolt)srxmxmpnudamenmict s)a2rauro;o1altomoctydfa2umn p;u4 rxrif3ootfate i s;t)srxoimpiodlme lnvs t)srtrxr ;o4oexo f3ils a rl(mo;u)trermo3oatfatelivi s trtrim3ny4altnlnetl( aDuax  ;u0tptomicils a2rm( o (0tlxoxf3oatopDean i;s0teuoxo oy1lp emnvsasf Dtrxmpoo4oleo ieiytls ranvpnu) exnmr oy1la rlivi ()tetoim3oy1ape livilsf rta(rp;t4alt mictasfm2ea( o;u4 etrxo iatlmDe i o;()srto(o io1lp nmfcils) rua(ro;u0ope moctlslm2ea( s;u0aeerxf3to1laDran ilt  rurim3ou4ol  lfctls  2ra( oou1tltnmociys s2rm(vp () exoxr tytoptr neslt0t2urxm3ny4lmenmies s)arrru  nu4aleomictasfsDulnmo ()alenmrcoo1lmD lieo t  exmio3oodap nlnctat sDta(m ot0optn icils mDel(mp;t0tlxrmfcia1fp elnesls)setoxr iu1lmee ieslt arurx  oo0tlenmfciatlm ran o (0altrircia1opDe uvslt)texmxr no4lmt  fvsas a2rm(mooo0oee moetad mDelu s;(0alxnifciy1om e nvo;()seuoim3iodap emfes t)srtm(  oo4oeen fetld m2eau s;(4 lxnmo3ty1omtr u o ( t2urir3nu4ap elietltf 2rmxr oo4apxnif3ildfaDemuvont0texrmr3oodlmte uvo (0trtm(m3iu1aptnlfcs sf 2ua(ronu1aexn f3iasfa2ea( p;t0 lxoxo3ootomDraiei;(0 2toxrpoudomtn nvta()sDrmx  ot1alenmictlsfs rln s t0artnmo tatoa  lnvo (0t2xrxr3oy1lp n fvtas)srraxm ;t4apeoioctls a2rmump;t4trermrciydlp rlnvs s0srto(mpoydlle mfciat)aDtr(rp;o1tpenmicild a2emnmp;u0alxoio3oydfm eln s s0t2xm(o3nydam  mfvias  rua( pno0apenio3tlsls2ulu o t4areoioctodlmte nes;()srtmxr3iodomt lfcsltfs2rr(mp;t1tee mieias s2rluvo;(0 ltoxr ta1lp   ueo s)srtmim oy1apeelncslt s2ra(mono4tle ifcils m2rl(mon()aeenif3iydfaDelu sls) 2tm(mpnu1lptn nvs t a2urxmp;t4teeomoctytfs eau s;() etoxf iotlm r uvo;s0s2tmxo3oy1amenmivils)aDrmxm ;t1tpeo oeils a rm( pnt0trxnif ia1lpD ai ols0trtrim oydol   fcsa()srra(mo;t4aexn feils mDulnvo;t4tetoiocty1om r ies;s  2toio nydlm n nct tfsrrmxm ;o0aexniociadls rmn p (4texrmr3iotomteaueo;()teum(m3iydamenmfesas)s2urx  ot0olenifctatfm um( onu4 rerxf oatfptr nvils)sexo(rpio1ape  iet s a2ra(mpnt1olxomictad a2el(vp;t4artoxr3to1fm  anvi;()truoxopoy4lle mfvslsf 2ra(  no4tltomf3ild a emn ont)alxrio tadoa rli o;t0 2xmio3iudop  lietls  2rmu pou4apxnmoctaslsDemn o;(4artomr3oy1om elivo (0 etmxo3iy4opt lnctasfaDtru pnu0oleoifeilt a2ran on(0artnmfcoo1fmDrluvsls)srxmiopiu4lmtnliciatfsDur(m ;u1tetnmi3iytlaDrl( p;u)trtrmf oy1lmDraiei ()seuo(m iodoleelnciasfsDuaumont1apt mfeilt aDum(mp () lenmf oodlatrlnvils0 2ur(m iydlmee nvtlt artm(m ou4opx  ociatfmDrm(ms (0 lxomf3oydlatelueols0 eto(m3oodlmtemivsl(  2tax  ;u1aet ifeiyd sDum(vs t)teermr oydfa rau o;t)setmimpiu4ame mfvta()s2ur(mp;u0tet ifcils aDrmn p () exomf tatfmDraiesls seuoio3oy4om   ncia() rrr(mp;o1tpx mocils a2rmu pn()aleniociatoatrauesls  etr(r nodomtnlies s) 2ra(r nt4tex ifeilsfm ea(msnu4aetnxocoo1fp e n i t0t2toxr3no4lpt mivsls  Drau p;o1teenii3tltlm umu s (0tlerxo3oatlat li ils tetoxr3nydlm e fetlt  2rau pno4tex  f3tad a2rmu on(0aeerif3iydoaDe iei s) rurio iydope lnvsas  rur(mont4aeto iciltfm2ua(mpnu)arermr iy1la raneo;s0t2tmxopoodame  nvi s a2tmx  no1aeeniictlsls2ua(mo;u)trxnmr ty1omDrlu sls s2to(rpoodlmtn ivta(  Dtmxroot4openmocias m uan snu4arenmo3iydlpt aivs;( t2um(r oo4lpeeliei () 2trxmoot0oet iociaslmDrmump;t0 etomr iadoa eaivi t0 rum(o3iudoltemfcs ( aruru p;t0opxomoeiadfa2rmumo;()aeerxr3tydfa r nvi (0trur(o3oy4open ivias)aDur(root1alx  ietysfmDulnvo;t0tleoxf ta1opDrai slt0 rurio oy1ap n fvsa()srtax  nt4ape mociytls2rl( p;u4alerxo3todlp e ivsls0 2tmxm3io1apen fvtlt a2trumpot0aee io3iasla2em(vont0teermr totfatr u o s) rtoxr oy4lme lncslt sDrmxrp;t4aeeomfeiatfm uauvo t0 rxrifcoytom eaueil(0t2xoxo3iy4lltemietlsfsDum(m ;u0tptnioctytla rmumsnu4 rxnmr3tatoaDr nvi;s) exo(o nu4olen fvi s  2uaumpoo1oet  oeiytfa2raump () reoxf3totfpt lnvi ()sexoir nudamte neiat  2urump;o4alxo ieiad m2uln s t4 renif3io1lmDr nesls0 rxmimpny1llt licias) 2tax p;o4aetnmieild a2ulu p;u)trtrxo oydfa   ivil() eurxo ny1ame  ics () rrmump;u4tptnmi3iydlm2elnms;(0aexrio tatomtelu i t) rxo(opnu1ol   ncs tfaDrau oot4alxomociadlaDumnms;t4teenirctytoaDraies s0seuoxrpoy1lm e nvslt) Dum( ooo4oet ifctldfsDelumpnu4 leoio3oa1laDr ivi t trxoxrpiy1ame  fviltfsDtrxro;u0tltomfeiyslm2elu p;t0 leoir3oytomD aies;()srtmxo nudomt mnvta( a2tmxr ;t0tpeniiciatfs2ranvo ()tlxrxr ta1oa e nes;t0 2xoir oudlptelnvsl(f Dur(rpnt4aptomietyd a2umuvp (0 rerio tatfmDrlivo;t0texm(m3iydapte ivsatfs2ta(r oo0tltnioctat m rl(monu)teerxr todfm rauvol() exmirpiy4am e fciatfaDuax o;t1oeto ieiltfmDrmuvsn(0arxnif to1fmteluvo s0t2uo(m3nu1ol n ietl(f rrrxm ot4tptn f3iasfmDrmnmont0arxnmr ootfmte n i;()texoio3nu1lp e fvs s srtau poo4tlx iicils sDua(vp u4 etnmr3iadfm e nvols)t2xoim3iodolt licsasfarta(roou4tetn iciad s2elnmo u)trxoxf tydop elivs t0srxr(o ou1apen fvt s a2ra(rp;o1apt iieils mDrmu ont) ltrio todfptrlnes t0sexm(mpiu4lmtemivilt  Drr(mo;u4optnmoetld a2rau s u0artoxo3oytomDeln sl()trxm(mpno4amtn ics s)sDtrx pno0opxoioetlsla2rm( s;(0aetomfcootfpDeln sls0texoio3ny1am elfci t a2rmu ooo1tpe moetas s2rluvs;u4teeomr oytopDr ues;t  euoim iodaptn neslt)aDrrxr ;t1olx iieiltls elnms u0tetnmfciatoate neo;s setr(rpno4lpe  ict t sDrau pnu4open f3tydfaDem(mp;(4trxoxo tydlpD lues;( trxo(opoo1op   ics s) 2rau o;o0opxoio3tas a2em( o u4 rerxr3oatopte nvsl(0trtm(o oydlpe mfcil(faDumurpou1tlxo fciysfm rlnmp;u4 rtomocia1latraues;s0 2umim3iu4ap emnci t)srrrx onu0ole ifeils mDea( sn() ltomo3tytomt  neol()seur(mpnu4ap emneilt s2trxro;t4oee  ietytfs ranvsnu)texnxf3oytoateanvi t  rtmir iodlptelnct t arrrx  ou4tle ioeiysls ranvp t0 reoxoctodop eai ilt0setmxmpou4amtn ivt s  rum(r nt0tle moetytfm rmnms;u4alenxo3io1fmDeauvol( setoio3iu1apt  fvt ( aDtrump;t0tlx  iciatls2rl(ms t)aeenxf iadlatr neo t) 2trxrpnu4llee fcsls)s2ur(m no1alxnmo3tlslaDeluvs;u4arxnir oytlmt lneol( trxrxr oudlp e fcs (f Drrxro;o1ape ifeiltfaDemu snu4 exnifcoatop  auei;(0 2uo(r3ny1lpee netltfaDta( ono1olx moetysfs2ul(mo t4altomo3oodlatr nvolt0sexrim3ou1al  miciat)s2ua(r oo4aexomfciadfs um(mont0aeeomrcto1oaDe ieil( s2xrxo nudllenmivil( aDua(mono1aexnmoeiysls2rau o;(4tltnmo3tadlptr ies s)srxrim oo1omte neia( srtm(roou4opt ifetlsfs2umnms;(4 exrifciatfa rluvs;s) rtr(r3nu4apte ictl(f 2tmxmp;o4apxnmfetlt m rlu pnu4 ltomo3iatfpD  nvs;(0t2xr(opio4opee fcil(fa2uau  ot1aptomieils a ra( s;u) lxrxfctotfmt lnes;(0 etrxo iydap nlnvtl()aDumum oo0oetnmfctldlm2umump;u0 rermr oodfmD lneils  rxrim ny1om  mfviatfarrrx  ;u0apx ioeiaslaDul(mp;(0 renmociatoptrai i;()s2urxrpnu4apt  ivt t  rurx p;u4tltoifctls s2emnvpn(0trerio3totfm eai ols0seuoim no4ole lfctat aDumxmoou1ale  iciysla2em( p;t)tltrxo3iadfmtraueil()truo(m3iydlpte nct s s2uax pnu4openio3ildlm2ulnvo t)teermf tatfpDrai o;t  etmxrpno1lm emici s)a2umx o;t4aetomfcilt m rau pnt0texnifcoodfa rlnvsl(0s2tmim3nu4lp  mncils)s2taur ;t1teenmf3iltlaDranmo (4altnxr3to1lm elnei;s s2xo(opiydoltn nct tf Dum( pnu4apxomfctyt a2em( o;t)trerif3oodlatr n olt)trxr(rpny1ll  mfeilt s2tm( o;u1oee  ieilt sDuanvsnu)arxnio oodlm  an o (  2trxo iy1am n nei tf Dtmxmono4optn ieiatls2umn o;u)altrmr tadfm e ies (0 exrirpnu4amt  feia( sDumxmono4oltoio3iatfm2umu o (4 etnif tytomD  ivilt trtrir3nudapen ivs (faruru p;o0optoif3ildfmDumu p;t)trtoxo ootfaDranei;(0srumxm oo4al nmiciltf 2rrx  ot1apx ifeiysfmDean p u0aexoif oatlmDelu ols  exoxmpiudopt  fesls)sDtmumo;t0apxn f3tadlmDranvon(4 reoio3tatlpD liei s)sexrxm3oodlpt  ncia()srurx pnu4opxnifcildlm2ean p t) etrir ia1oaD lu i t  eto(mpou4llenlnctas) rtmxmo;o4olxnmoetldlsDrl(mo;t4tetomfciydopt lues t sexrir3nodap   fciat)srtmxr ;u1olto ocild s2uauvp;u0 reomo tydoatr uvo ( t2urxmpiu1lp  mfvtasfsrrru o;u0texo f3tatlm umuvo;t4aetnxr oydopt liei;s)srto(o3iodame lfcs s)aDraum ;t1tpe miciadfm uanvp;()aetomo3iatlmt  n ols)setr(mpio1op nlivta( sDuaxr ;u4tptoif3iadfs2emu p;t4tlxnio3ootlpte uvi;( s2ur(opiydolt lnct t)a2rru o;o4aetnmo3tydlm ra( s t0 lermfcoy1la ranvo t0trtrxr3oo4lpee icsas) rtmu pnt0optnmfeiydfmDemu pnt0tleoxr3oodfptr ueo (  etr(m oy4lme lictas  rrmx pot1oetoiieias aDrm(mont4trtnmo tytfpDe n i (0 rxoio3nodalt mfvta( s2tm(mo;u4aetnif3tytfa ul(vp;u4aleoxo3oytlat auvslt0t2tmiopiudoleelnvsat)sDtaxr ;o4aexo ociadfs2rm(vp;(0aexnmr3ia1fpDrauvi;s truo(rpnu1ameemfeias a2rrxmpoo0oetnmocildla2um(vpn(0aeerxo3tatlp   u ols0 etoxm io1lm  mnet ()srtaxm ;t0oleoiiciaslsDulnmsnt) eeoir ta1fpt lnvol(0teur(rpou1lm nlncta(f Drmum ;t4opxn fciad sDea(mo;t0 ltoiociotlatelivslt  rtrxr3nudopen ieils  2tax pno0apt  iciatlmDean o u4 ltrxrctydfp r nvs;(0 etrimpoudam  miesls srtmu  ;u0aee moctyt m emuvpnu0aetoxf3oodfmtranvi;s)t2xo(r iudoltemictat)artrxr no1tet  ieiad m umn pnt) rxoir3ootom  lu s t0seumxr3oudop  mict ( a2rmxmont0tpx ioctyd a2ul( p;(0 etrxoctotfp  lieols)t2xo(m iu4ome micsas)sDtru pnu0oleoif3ildfaDul( sn()aleoif3ootfpt lues t) 2xrir iudamtelfet t) Drrum ;t4optniociatlmDranmp ()artrmfcoodla r u sl() 2tr(o nu1llee nctatfs2tr(root4olxnmociltfa eanms (4tltomfcoodla rau s;( s2umio iy4op n icia(faDtaxmoou4oltn fcilt s2um(vp (4arxnirciy1fptr u o;t)s2xr(rpoy1ll  licsltfa2ra(r ;u1aeeomf3ilt a2emnvo;t0arxomo iadlaDrai o;t)teuo(o3oodap nlfetls)sDta( oot0tle  o3ils aDrl(mp t0trtnxo tatlmt lies s0trxo(rpio4lmte ivsatf 2rm(rono4aexo i3iysla2umumo;u4arenmfcoa1omD  nvo () exriopno1olenlfci t sDum( pnt0tlx  ieiyslm2ul(mpnt4arxrxr3iydlaD au ols) exr(mpiu1ape lncsa()srurum nt0opto f3iadfs2ua(vsnt0tetrir oo1fp ranvs s trxoim iu1amte ivilt)sDur(  no1openmoctlsls rln p;u) rxnmo3oy1fm  aieils srxm(o3no1ome livta(fs2tmu  nu1alxnmi3ilslm umuvp (4trxoif oa1optrauvi s0 2toim3iy4om emfeil(f rumumoot4tlt  f3ilsls2em(vont4tetrxr3oytlpte n o (0srtr(mpoy4lm elictasfarururono4aet  fcias mDrl(mp;t0treoxf tytlmDe ieols s2um(r3oo1olte nei ()aDrrx  ;u0aet  ictldlm rmnmo u)artrmfcootoat livo;(  ruo(m3oudolenmfei tfs2uru ont1texniociyslmDuaump;u)arenio3iodfa r i ol() etoxm ou1oleelfei (f rtmxrpot1olx  fciltls ua( pnu0alxoio3iytomtrlueilt0 2urxm iu4lp elnvtl(  Draxmpno1tpxnifcildla2uanvo;u0aeeoxo3oydfm  an ilt0sexmxr3iu4lmeemfcs t a2urumpou0alx mo3tytfa2elumonu4 rtomr3ty1lateli s ( srtrxr3iydlmenlfct t srrmx  no1aleomieilsfm ul( p u4 rtomf ootfptrln s t setr(rpiydll nlfes t)aDumu pot1alt iociad mDuaumsnu) eenir oy1fptelneo s0trurxrpny4ll nlfesa( a2raxm ;o4optn octatlmDemn p;(0tleoxf iodlaD  ivol(0tetr(m3iodlpt  fviat s2umx pou0alenmfeiyslsDemnmsnu4texnir oatoaDrlu ol(0seumxopoy1ap nlfeslsfa2tmxm ot1tlxnifeiatfsDumump u) rxomr oadfmDelnvilt0 2urir3oy4ll e fvs sfsDrm(  ;u0aee mf3iyslaDranvsnu0tetrxr ootopt lueo;( texrxr oy4aptelieiat)srtmxroou0oetnmi3ilsfa2rauvs;() rtrif oy1oateau ol(0 rto(opou1opt mnvs t)aDumx o;u4aee mf3ildlsDua( p t) eenifctadlpD au s s  rtoxr3oy4ap nmfei tfa2trxrp;o1olx  oeilsfmDrl(ms;u)altnxo3ta1om   uvil(0 rxm(o iu4lptemfcias srtru ono0oeen o3iat sDem(vp;t4tltrxrcio1fateauei (0 2ur(mpoudomeemfes t)sDra(rp;t4aexnioctlslm2uaump;(4tltnxr oadom eluvsl(0 exoxr3io1lpe lfeils sDrax onu1opxoii3iyt s ul(mp t0 etnmrcoa1oat lnvs s) 2toxrpou4ameelfcia( a2taurp;u4opto ieiys aDeanmp (4 eermf3oydlmtraieo (0trxo(o3oo4omeelnei (f 2ur( o;u1tlt mi3iadlsDea(vp;u)tetnmf oo1fmteliei;()sruoxmpoy4lm  lnvtls)sDtrx ono1oleoiietas mDrl( s u0 rxoio3tytoa r ivo;(0t2toirpio4lm n ietltf 2rmurpnt4oet  f3tas a eanmpnt) ltnirciadlmtr neols)teumxo3oodlptelivsatfsrrm(  ou4tex io3iys mDemu o;u4 rtnxf3iodlp ran o;t)truo(opno4ale  fctat) rra(ro;t1olx iieiys m eanmp u4areomf iydopD  nvol(0t2trxopno4om nlivsat  2tmxrpnt4oet  o3ilt mDeln o;u4trenxf io1la rlivi (0 2toxr3nodome mieiltf rur( ono4tlx mfctlsfa rl( onu0 rxomf3oatfpt ai i t) rtoxm3io4optemfctls)srrr(mooo1opt mi3iytlm eauvs t4areoir3iytlp rai olt  exoxm3oo4lm elfvsasf rtax p;o1opxnmi3ias m emu pnu) lxomo3tadoateln ol()t2to(rpoudlmee icia(  2tr(r ou1teenifciyslmDrm(mon() rxrir tytlaDelies t)seuoxm3iudlp eliesltfs2rru  ot1tpxo feias a rluvpnu4tlxrirciotlpD  ivols s2xrxm3nydomtnmnvsatfarrrx pot0tlenmociytfa ulnvpn()arenxf3totfmDr nvs s) etmxrpiydlme  fciat aruaumpnt0apt ifcilsla2rmumo u4 etoifcoytlatr ivi;t)srxoim3iu1lltnmncil() Dtmum ;t0texnmf3tydlm2uln onu0tlenio ta1fat anvsl(0 exr(o no4omenlfcsls) 2rax oou0aptoioetad a el( s t) etnio3oatfmDran s;s0s2tmirpiudal nmictat s2umxmpnu1aetnif3tlt mDrlu s;u4 leoir oodopD lnvi () rtoir oy4apt lfct () Drrxr ;t4tpxn oeildlm elump;u0teenmf3ta1lpDe ivs ( setrxr3oydopenlnvsa() rta(mont4altomi3tyt m2ra( o;t)tltrxr oytla rli s;t0srxrxopio4apte ncs t)arum(rpou4oeto o3iyt a2rmn s;(4 ltoir iodom e uvo;(0srtrxm3ou4ame lfcsl(fsDra(mooo0alt ii3tlslaDulnmp u) rtnif3oy1fat luvo;t0 etoim nodale mnvi sfsrrau poo1aetomieiydfs2uauvo (4arxomf tadfa ranvi;t t2trir iu4om  lfeil(fartmur nt4oeenmfciyslm2raump u4aeeoio3io1opteai olt  etmxrpno1omenlncsa( srtaum ;t1oexnmociysfa ul( s u4teerxf tadfatrluvs ()teumiopiu1om nmicta() rtaxrpnt4opt  o3iad a2um(vo t) lxoir3oydoptelueils  2to(opiu4lmeemicsa() Drrxmp;u4opeoii3iasla raumpnt)aexrif3iydoaDe ieolt) rumir oodlmt lfvtas a2ra(mpnt1oltn ieiyslmDemnvsnu0tlxnmocoydlp   iei;()srumxo oydom nmneiatf 2tmx  oo4tlxoiictatls2ua( snu)alxnxr3iotopDeln o s trtoxo ny1ol e fct t arum(mo;u1apxo o3ias s el(vpnt0 rxrxf3tydopD  neolt0trtrxm3oo4lpe mfei (faDuau  ;u4olxnmfciytfa2umnvo;()arenif3tadlat ln ols0teum(opiudlptn netl(fs2tmu o;o0apt  fctlt aDrm(vo;t4aexoifcoo1fate u s () rxrim3nu1om n fci s)srrm(mpoo4apen feiatfsDrauvo;t0tetnmfcta1la rlnvs;( s2uo(r3iu1lptn ieia()sDtmum nt1tetomieiat aDumn onu4tltnifcoydfateanei;( seur(opno4apen ivtltf Dur(rpoo1oetoio3tltlaDem(vo u0tlxnxr3ta1oate ivilt tetoxrpnodol elicilt) Drr(rp;t0tltn i3ildlm2ua(vo ()aetrxf oo1lmt  uvo t t2xm(r oy1al e netl() 2rmur no1apxn oeiytfmDulums t)trtnir ia1laDeli slt0srtrxrpoo4apenmivil()sruax o;o0oee micilsfs2umumsn(0aetnmr to1op r uesl(0 eumxm iudlm  mfet tfarrmu  no1tpeoifciytls elump u)trtrmo iydlm rlieo () 2umxo3oy4lptemnvi (  rrmumpno4oleomfeiat a2ulnmsnt0trtoxf ta1lp e u i ()t2toxmpio1lpenmnei s) Dtmumoot1tpxo iciatlmDeln o;u4 rerxo3tadlat  n olt0 rtmimpiy4lp   fvi s)a2uru  ot4oltnmf3tytlaDum( pn()tetrmfciytfpteanvi (  rxrir iy4om  mfetl()s2trum ;u0tpe  octltlmDua( o;u0arxrmo3iy1la  lu ols) exoim nodalen icsls)artrxrp;u4opt iietadla ra(vpnt0 rerxfciodfm eaneo;()t2umirpiu1altnlfvi () rta( ont0altomfctytfa2uanms;(0trxomf3iodoat lnei;t srtoir iudaltelnvt s)srtr(  ;t1aex mfeild a2eluvs;(4 eeoif3tydfp r ivi;( trumxo3io4ol e fcia( aDrrxmoou4tlxo oeiltlsDrmu s;()arxoiociadop eli i;() rxmxmpou4lmt mnvtls)sDurxm ;o0olenmfeiad sDumums;u4 lenir totlmtean ols) exmxm3io1lmt  ici t arrau o;u1optomoeiys a umnmp;(0trxnio3ty1oa  an o (  2xr(m iydop emnci sf Dum(ront1apxnio3tys mDean s t0arerirciatfmD ai s s srxr(r ou4ole  fcs (fa2rrumpno0aetnifcilt m2rmu onu)aeerirctotopDeauvil()trum(rpiu1lmee fetas)s2rau ono4tpxo fctatfaDuanmp;()areoif3oytoptr uesls sexrxrpio1ll nmictat sDua(rp;u1aexnmfciad m uln o;u4artrxo oa1omt  u i t t2xmim nu1am  lfei ()s2tmum ot4tleoiicildlaDemn p;t)tetnif3iytop raneol(0t2uo(m3nydamtn nvi t  2rmumpnt0tlxnii3iys s uauvo ()alxomo3tadlmtelivi;(0texrim oy1oleemfetl( s2trumpot0tlenioctyt mDeanvo t4tltriociytfm  lueil(0 rurxm3ou1oleemiei (  Dtrxr no1optnmieiyd m2ulu o;t4tltoir3tatfa  lneo s0srurim3oydop  mnet sf rtmuronu0oex mictat m2ra( p (0 eenmo3oytfmDr ivs (0trtmxm3ny4al e fei t)srtrxroou0tpen i3tys m ra(mp;(4 rxnxocoydfp  ln i t trtoim3iu4ape mivils  rumum no0oetomiciltfa2emnvp;t0treoiocoodfptr iei ()t2tm(o3oy1openmnvias aDuaurp;u1alxoiieildfm2raums;u4artrmr totlatraivolt) rxrim3io1amtnlivtat)s2ta(root4opx  i3iysls2eauvs;t0tetnxr3oytlpDe u il()s2um(o ny4lleemfvslt)aDrrx oou1oeenii3ilsfa ea(msnt)alxrxrctytfptr ieslt0trtmimpiy4lpte netat sDtaxronu4opxnmf3ildls2elumo;(0 etnmf iytlm rlivols)tetmio oo4lm n ivtas) 2urur ;u1tetnif3iasla emnmonu4trtoir iodfpt lnes t srumxrpny1omtemivi t srtrxr no1altniictls m2elnvp u0 rtoxr3oytopDrlueilt)t2umio3oodamte fvi (fsrtmuroou1tpt mi3ildfmDulu snt4teenirciadop r uvils) exoxm iu1llteliet () rtrumoot0tpxn o3iytfm2el(vo t0 rxrio3totfm r ieilt)s2xoir oy1ame mnvi t  rtau p;u4aex  f3ilsfaDumnvs ()tltrxr oatlptelu sls srur(r3nodopte nci tf Duru  ;u0apxomi3tldfm2em(vsnt0 etoxoctatfp  lnvo s  2xrio iydolt mfetatf 2rr(r no1oex  fcilslm2ulnmsnt0arermfcio1omDrlueo s0setr(mpoy4llt lfes t)srururooo4tetn o3ildls ranmsnu4alenioctodlateluvs ()s2umxo oodap nmfesat) Drrx  nt4oeto oetydfmDrmnvp t)texrxf ootfp rai o;s s2xmxr nu1lle lfci (  Dtax o;o0alx mfeiad s2el( p;(4aetoio iodlmtrln o;s  rumio3oy4lltnmfet ( arrrurpoo1tptomi3iltfm2uauvs;u4aetnifciotfatrai s;s0 2tmimpiy4amte nvt ( aDrmu ooo1ole  o3ilsfa2uluvpnt4aexomr tydfpDrauei;s  2xrxm3oodopeelivi ()aDtrumpot4openii3iltfmDuluvpn(4tlxoxociydfa elu o;t  eto(m oudamtnlivta(fs2uau  ;u0tptoioctydlmDelnmsnu0aexoir3iydlm e ieslt0t2toxm3no4lmtn iesa(f rururono0tltoiociad a uau p;(0teeomr oy1la   u i s)truoimpiu1ol elnci t)artmu p;o1aexomo3iyslsDum(vp;t)alxrxf3oy1la rlnvi;s srtrir oodllenmict (fartm(  nu1olxnmi3iydfmDra(vp t)tetoxr3io1laDeauvi () rxo(mpoodlltnlivsas) rraur ot1tet  fciltfs2umumo u)tlxomocoatlatrluvs t) 2xr(mpiy4omenlneiat s2umurono4ape micildfmDel(vonu)arerxf3iotomt  u slt) exoim3oo4ll  mfcilsf Dra( p;t4apxnioeias sDel(ms u)arermr ta1fmDraivi;t0 etm(r oo4aptelncta(f rrm(m ot1olxnioctltls2ea(msnt) ltnif3oodfm e i o;s0 2umxm oudol e nvtlt)a2trxrp;o1apxomfetlt a elnvs (4alxnmrcia1fmte uvo;(0 euo(m3iu4al n ncia() Draum ou0oex mocilsfm2uauvo;()artoircoy1oatrauvo;s sexo(m nodaptelfvt tf 2tmx pnt0teen fciadfs ul(mp;u0alerif3ta1laDrluvols0srtrio3no1lmtn nctlt) rraxmpot0tlen o3ilt m2rluvpnt0teermfcoo1fm elieils0 rurxm3no4lleelncil() Dtrurooo4apenifeiydfsDeanmo;(4 ltomr oydfmDe n i;( texo(opoudom n fvias  2raurp;t1aee  o3ilt s rmnmp ()alenioctytlaDrlu ils0s2xmio3ou4op elnet ( s2tm(rooo4aexo feiyd sDrmums (4 lenir io1omDelueo s s2xmxm no4ll  mnvtlt)aDururpoo0tlx mo3iyt s2rau s;u4tlenmf iydopD  ivolt0srtoirpnudopee ncil(  rta(mooo4aexnmf3tltfs2rlumo;u) reoxf tydfa eai ils truoxopiu1lm  lnvil(f Duau  nt1alto iciyslm rauvsnt4texomf3todoat lnvil(0trxm(opoo1lpt mneilsfsrur(rpot1opxniieiydfaDrl( s ()tlxnioctadoaDraivs t srurxm3no1ope  fctat srtaumo;o0optniictaslm2eln p;u) lenxr iatfate nvs t) exmxr3no4aptnmnvt s)s2trxmont0apt  ictatfaDul(mp;(0alxomo3ta1laDrau o ( trtrio iu1lle  nvtltfa2raurp;u4alxoiictlt s2rmuvs;()aexnxr tatlaD an o;s0t2xoxmpiy1omenlivi t) Dumx o;u4oetn feiytlmDemnvo u) eerio3tytom eaies (  2tm(o iu1alt licia( s2raum nu0apxnio3iltfm ea(vsnt4 reomrcoa1fmDraivi;( srurirpno1amee ivsat artr( ono1tpen feilsfs emnvp u4aetrio iodfp eaneslt trtrxr3oo4ole lfeias)artmxrpot1tltnmi3ildfa rm( snu0 lxrxf3iodlmtrlivi (0 exm(m iy4al nlnct t sDtrxmont4opx mo3ildfs2ea(vo;(4tlermr3iydfp r uvi t  2xmio3ny4ap nlieiat artm(roou0tpenmf3iatfm rauvsnt0texrmocio1oaDr n il( srtmiopno1al nlieiltfarum(rp;u4apxo octytls rl(vo u4 ltnmo iotopD li ol(0teuo(r io1lpte iesas) 2ur(r ;u1apx iictadlm rmnmp;t0 rermoctadomD  iei ( trtrxopou1oleelnet () Drmxro;o4aex  octasfa umn o () exrxo3iatlaD ai olt0srtmirpno4llt  fci ()sDtauroou0texoiiciytfm2umnms t4aeeoxf3ta1laDr ues;() exmxm3io1ap n iesl(  2ururpot0aleo fetytlaDra(vonu) reomrcoatopD anes;t0s2trir3nudlme lnctltfsrrrurooo0apenmf3iydlm uauvs u0teenif3tytfa r nvi;s0t2uoxm3oo4olt  icslt sDurxr ;u1tpxoiictas sDul(msnu4trtrmr iytfptr uvils)seuoir iy4lp  lietls  2ua(mo;t4aeenioetld s2el(ms;t4tlenmocty1oaDrauvolt)trxrio3iu1om  mfviatfarurum nt0optoio3iad s2eauvsnt)aexnxf iadfptelnes t0 rtmxr oydlltn ivt s)artm(rp;u4oetnio3iadfa2raumo;t) lxrio iotop rlnvo t) 2xr(m3oudole  neil( aDuau p;t0alen octyd s rm(vpn(0tlerxociytlaDr ues;( sexoxm io1lltemnviltfa2rr(mpoo4tpen ieild s eln p;t4aetnxrctytopte u i;t  etr(mpoo1lltn nesat)s2urx pnu0opxoioeilt a2eln s u4alxnxr iytlmDrlivslt0srxm(opou4op nmfcsas)artr( pot0tle  f3iltfs2elnmp t4trxnxr iadlm eanesl(0s2trxopio1olt micia() 2rrxm oo0aptnifctldfmDea(von(0alxnxfciotlpD au sls)truo(o3nydam elneilsfa2rrumpot1oex io3tyt a emn o;(0alxrxfciodfp  luvo;( teuo(r no1om nlfvt s)s2rmumo;u4oetnii3tld aDemumo;u0 etoxr3oatoaD livs ()texr(m3iu4ap e nvt ()srtm(mpot4ape  feildfa eluvonu4trxnir iytlp r neols0sruo(rpnydamenmfci s aruax  ;o4tlt  ocilt aDul(mo u0aleoif totomDe neo s)trxo(o3oy4olen nctl( arurxro;o4tleniictls s2ulnmp u4aexomr ia1fpDe nvsl( t2toxr nodlptemieta( aDtax pno0apeomi3tls m2ea( s;(4tetrmociotop   iesls)tetoio3ou4olee icil(farrr(m nu0oexnmfeiat m ean p;t4 eenircia1lp raues;t)srxo(m ou4lmen net t  Dur(ront1tlx  i3iadfs2eauvsnt0trtoif ia1omDeauvs ( t2xrxo iudol   fvs s  Drruro;t0oex  f3ild a2rlnms u0aetomr oytoa  lieo () 2urir no1lm eliet t)srrau pnt1oet  ictatla uau s t4 etoirctotfpt auvs t s2xoxmpno4apee fcs s srtrxro;t1texomieiysfsDulnvsn()artoirciatoptrln ilt trurxm3oodlm   nct (f rumu p;u0aeeomi3tltls rmump t4tlxrif3iytoa r u i;s)s2xr(o3io4lp e netas  Dtr( p;u1tpe mictas sDulnvs t0arxnir3tadfpD lies ( trxrim3oy4llte nviltfartrxro;o0tpe ii3iat mDumumo;t4trtoirctydoat lnes t trumxm3iy4om emietat) rumuro;t0tpeoiociadfs rl( p u0aexnio3tydfm  lneol(0trtmxr3oodlm  mics (  2tm(m no1oeeoifcils m2eluvpnt4trtrmo3oa1fa eli i (  2tm(opiudop   nctls)aDtm(r nu0opxnifctyd a rm(mp;t0 etrxfcoodfpt lu ilt sexrxr3oudaptelfcslsf 2rm(  no1teeo f3tadla eanmp (4aetriocio1oaD  nvilt) rtmim3ny4aptemncia(  rraur nt1oet  o3tltfsDulnvpn() etnxr iadoatrluvi;( tetr(rpnudop  lncia(faDururooo1oee if3ilsfs ul(msnu)treniocta1fmDeau i t  exmir ou1optnmnvs () 2uaxro;o0tetnmi3tytfaDrlnmon() exoxocoadomD lu o s) 2tm(o3oo1amtemfeta(faDurxrpoo4tpeomo3ias aDeau pn(0 exnxo oy1omD lnes;() rtoxo3oydalenlict (  ruru  ou4ole  ociytlsDeauvp;() exrmo io1lm rauvi s) etoiopoodomtnmnvs (  2urx  ot4ale mfetat a2rmu s t0tlxnxrciy1omte u s ( teuo(m3oudolenlicia(f Duru o;o4teen o3tyt a el(ms;t4 etrxo3io1fpt au o;s0t2tr(r3iodllenmivta(faDtrxrpno0apen o3iytlmDrl( p;t)aeermr iy1omtrau s;t srxoio3ou1opt mnviasfarraxront1altn i3iytfa2um( s;t4 lenxocoodfp eaivo;s s2xoio3nydlpe mfvsl()a2ta(rpou1oee  ociadfmDumnvo t)arxrio3to1fatr n s;t) rumir iu4omt lfeias) Dta( pno1tpt ifciytlsDeluvsn(4alxnmo ty1oa rlivs;s) etm(rpno1alt licsa( srtrumpno0tet iieiysfs2ra(monu)aeeoxr3oodop rluvo ( s2xmio ny4lmenlnvt (f rrmumo;o4tlxnmfeiyt m2rm(mont0alerircoo1latr ivi t setoir oodoltn ietlt  Drau oot0tpe ifciltls ra( p;u0tleoxr oodoaDeaivol(0 exrxrpiodomt  fcslsfartmx o;o0teenmiciatls2uanms t0 rerir iydopteluesls  2to(m io4amt  nvt (  rtmxrpno0oetnmfeiys m2ean onu0aeerifciotom  lues;s  etrio3ny4al n nei tfs2umxrpoo4tlxo feiadls umums;t)trenif iodfmt lnvs (  eur(o nydolte icta(f rurxmo;o4alt  f3iyslmDum( ont)tleoxr todlmD livi;t) rto(r iu1olenlnvilt s2tr(ro;o0aleoii3iltfs2uanmo;(4aexrmr iotlat anvo;()s2toiopny1oltnlnvilsfaDtaxr nt1tlt  f3tltfm emnvs;t0tetnmf3ty1la raies s0seum(o ny4lltelfctatfaDtrum oo1alen f3tldfs2rlump;(0 etoxf oodfmt an il(0sexrxo3ny4ll e neias  rtmxmpnu4oet  fcild mDea(ms t4tetnirciytom r ues;s) 2xoxrpoy1lmt mictatfsDtm(rpnt0tet mi3tasfsDeanvs;u)artnif3iydom r ieo;s0 etmxm iudoltn nciltfsDuau  nu1olxo f3iyt s2ua( p u4alxoxf iodfaD  u o t) ruo(m3io1lpe micta() 2ur(r ou0ole mietyt s uluvs u0aexnxfcoydfpD luvo ()sexmiopnudoltnlici ()arum( ono4tee ioeiyt m2eauvpnu4tetrmoctatla e nei ( t2tm(m io1llen ici (f Dtrx  oo0alxnifeiyt m2eanvpn(0tlenmf iotlp  lues;t)truo(r oy4lm n ivsa( artmxmo;o1oeeoioeiltfs ua( s ()trtnif3oytoaD  nvi s) 2xmirpio1omt  ieias a2tauroot4tlxo fetatls elumsn(4trtomr tatlmDeanvi t0trxmxr3no4op nlfvi s)arrr(mpou4opto fciydfmDrau ont0 reoio ty1omtr uvilt  rxo(mpnodapen ietat  2ua(mono0openioetatlaDrlnvonu0 eeomf3iodlpDeaneols)teto(rpiy1amee nesa()srurumooo1tpxoifeils a el( s (4aexrmrcoa1lpDe ues;s)t2urxmpoodom nmfvi ()artr(mo;o1oltnii3ildlaDem(mp t4 exomfcoadlmDr neilt s2toxrpnydll   ivta()aDrr(  oo4optnio3iatfm uanvpnt0aeeomr ootfpt  iei () rtr(m3oydale  nciltfsrumxr nu0tpx iieiaslsDrlu s u0alenio oa1fmt lnvi s s2uo(m3nydamt lfeiltfaDtmxrpou4tpeomociltlsDra(vpnt)aetrmr ootomDranesl(0 etmxm nydame mfesasfsrra( ont4olxomictasfsDeluvpn(0trxoio oodlp  anvi t0trtmio3oo1al  lnetl(f Dururp;t1alt  o3iysfm uln s;(4texnxo3oatomD anesls)trxmio iy4ap emfctl(f 2tmx o;o4texnmfciadfs eaumo u0tlxoir3ia1lm ran o;t0trtmxo3no4alt livi t)srtax pnt1opt mieiytls ulumsnu)arerxf iadfat  neils0s2toir3oo1oleemnvi t)sDrmx pou1optoiocildfm ulu p;u) lermf oydop e n s;(0s2xmio iy4altnmicsls  rtrxrp;t4tpx  fcilslm2umnvs;t0 rxrmr ta1lmtrlu s;s0t2toio3iy4lpenlncsls)a2uaum no4tpxnmfciydfs2ean s (4alxnxf ootomDelueo t)trxmiopiudlmt lfcils sDur(r ou4alxomociydfa2ranmp;u4tlxnmf ia1omtelivsl()s2xo(r3iu4ole mfei (fsrrr(mpnt1apxnmf3tlslm2ul( s;u)tltrxr tatfaD  ueslt0t2um(r3io1lpt lfcilsfsDrm(rpno1tet  o3ias m eanvpn() ltrmf3to1fp rlnvo;s0trurirpnu1lm nmfctat)a2tr(  ;u0aptniocilt sDrl(mo u) rxnmo3ty1lpt  uvilt0s2uoxmpiy4lleeliei sfaDra(root0ole ii3iys s2uauvsn()aexoxo oodfpt  i s s)t2umio no4lmtemfvilsfsrrauro;u1ole  octydlmDrmuvo;(0trerir iadlaDran i;()s2uoxr3ny1om e iviltfartmxmpnu0optniieiasfs2raumo;u0 ltnir3iydlm rlu slt trumxo iu4lp nlfeiat)s2rrxm ;o1tex iiciad m2emumsn() etomrcoo1oat  n i ()s2toimpny1om emfciasfa2tau oou4tptnmf3iytfs2ul( o;(0 eerxr oatopDeluvolt  ruoxr iu1ole mnvtlsfsDtmxrpnt0tpxnmfcilslm rm(vp;()alxrxfctotopte nes s trtriopoydll  lneta(f rtax  ;u4tetoif3iytls rm(mp;(4arerxr3ta1fpDe ueolt)truoxo3oo4llte icsltfarumx  ;o4opx  icild a rauvs;t) rerxf3oatla rliei;t)t2xoio io1omtelfvtlsfsDrmxrpot1apxo o3tat aDrmumont0 lxrxrciadomD aues;t0s2xmir iy1opee iet (f rrax oot0tleo ictyt s2ean o (0 ltrmo iatfpDraivs ( s2uoio3ny4alenmfcs (f rrr( p;u0tex  feiysls2ulu s u4trenmociy1oat  neolt) eto(rpnydlmtelici ()sDtaxronu1apeniictys m2rl( pnt0 etomocto1op elu ilt)trxr(m3iu1opt mnvil( srrr(mpot1apxn feiydls2eluvs t4teenmf3tadlpt luvo;s) rxm(m oy1amen neslt) rtru o;o0aptomoeildlm ua(vo t4 lxoxr iytlm elueolt)t2um(m iodamt mfetls  rtru pnt4aetnmf3iad aDeauvp;t4 etomrciydfm  anvols tetoio oudom nlnes tf rumurpot1tltnmociyd aDuauvo (0altnmfcoatlaDelu s;(  2urxmpoudlpe  fcs ( a2ua(m ;u0tlt  fctldla2ran s;t)tlermo3ia1lm  aies;s teur(opnu4omt  fcsls) 2ururpot0tet  oeiydlmDra(vpnu0teeomf3tadfm  ai s;t trxrxr3iydll elfvt s s2rau oou4aex  f3iysfm rmu ont4tltomrctadoate uesls0 rxriopiudlleemnctasfs2taxront4tet  oeiyd s2rauvs t)aetrif iytop rlues;t0setoxr no1ape mncs t artr(rpou0teeo oeiysla elnmpnt0alermfciydoat  uesls tetmxo3no4optnlnvta( a2tm(r ou1alt iieiltfsDem( sn(0 rxnif3ootoa eanvslt  2toio oo4lmtemnvtls) rtr( p;t4opt  ieild s2emuvsnt)tltoio iy1fat anvsls)t2uoxm3oydap  mivtls s2uaur ;t1tpxomiciytlm2em(mo t0teeoxfciydom rlueo ()s2uoim3nu1am e iet (  2urumpot1oetn ieilsfa ranmpnu4tltnxr iodoa r u s ( srum(o oodape mict (fs2uaurpnu0oexniiciltlmDeluvp;t0 rxrxf3iatoptelu i;( srxr(m3oodol  livslsfsDrax pot0oee ifciytls2el( sn()texoir3totopD aneilt0trtr(r3iodom nmfvta()s2umuroot1olxn ociadla2elnvo (4 rtrmo3tytlmt luvsls srto(m oo4al e fviatf rrrxrooo4oet ifctld mDrlnvp (0 leomrciotlmt aneilt0tetmir3iy4altemicta( artm( ooo1tex  ocias sDrl(vo t0treoio oy1lm r ivs s seuoirpoo4lpeelieilt) 2rmu  nt4alxo ieils a rauvp;(4tleoxocoa1fp eln o t0sexr(r ny4ole lnvt tfs2ua(mp;t0apt mieiadfa2raump t4aexoxfciodomtr neols)t2to(opiu4lmeelfcsltfa2ua(  oo0olx  fctasfs elums;t0 ltomociotomDeauvo t0 2toio3iydllt  nvi tf Draxrpnu0olt io3iatlm um( onu0 exnir3oytlpD an s;(  exm(mpnu1omt miviasfs2rrx pno0alt ifeiydfm raump;u4texrmr iy1faDrauvs t  eum(o3oo1lpt mies ()aDum(moou4oeeoioeilt m rmnvo;(4tetomf3oa1omDeaies;t) 2ur(m ny1altnmivi s  2taxrooo0oet moctlsfs umu pnt4tltrmr ty1la elueo (0srum(o3iudomt lfei sfsrtmumono0aeeoif3tadfsDum(ms t)alerio3oydoaDeai ol( srurir3nu1ome mies sfs2rrumooo1aex  feiadls2ul(ms t)trxomocoadlp elnvsls)texrxr oy4llt mfvs (faruaxmpno1tlxomoeilt mDumn on(4 ltrif oadoaDrlu sl(  rxo(opio4ll  mietasfsDtaumoou4aleomfctlt a rlnmo ()texoir3tadoate nvils)s2xr(r io4ameemivil() Dtmx  ;t0apt iiciat m umumpn(0arerir tytfpDranvo s tetmxopny1lmtnlfvilt)artmumonu0tex ifeildlaDulnmp;(4tleoir totlp eai ils t2toir3io1am nlfvtat arumur ot1tpx mf3tysla2em( o;t4 rerxrcoatfp r n i;s0 rxoxo nudoltn nvil( srta(  no0texoiiciytls2rmumsnu4 rermf3to1fp  li o s teuoxo3nodam n fvta()a2um(mo;t4ole iiciyslm eluvp t)alxoxocio1oaDr neo;()srum(r3iydapt micsat s2ta(rooo0ope  f3tld m2eln s;t) renmo oodoa  li ols sexmio oy4op n fcsltfs2rrx oot1tpt ioetlsfs2rmnvs;t0tlxomo ootop elu sls) 2xrxm3oodlltn ieilsf 2ua(mo;t1apx mo3iltfm2ulu o (4teerxf io1fmD  i ils s2umim3oy1oleelfcsa( srum(mooo1texomo3taslsDeaumo;u4texoiocoo1fmtranvi;(0 2xr(r iudomenmneil( arumu  no1tpeoioeiydfs2ua( p;()teenmoctotlpDe uvols  rurir oo4ol  mict tf 2ta(mo;u0aeenmiciat m2umump (0teerxf iodlateaieol( texoio nu4llt lfvils srta(m nt0tleo feils m2rm(vp;u4tltnir iodfpDrlneils)texm(opiu1omee ieil()aDrr(mp;t4olto f3iltla el(ms t4trermociotfmt lu s ()s2xriopiydll   nvsat aruau  ot0ole  feiatfm2em(msn(0altrircty1fmteai s s t2xoxm oydalenmivtl( s2rrxmo;t4opt ifeiltlmDrmn pnu0aetrmo3oodoa   n o t s2xoiopoo4lltemnct ()srra(r oo0tpxnioctatla ua( snu)trxrif iadop rlueils  exo(o ny4lp e nct (fsrtaurp;t4tlt  f3iyt a rl(vont4 lermo tadom elivolt) 2xo(m3no4lmtemnesa(fs2tr(  ot0tleo oeildfs ua(vo;u)aeeoxrcty1la eliei;( tetrio3oy4opte ivia( srra(ro;u4tleo feiys m uau on(4alxnioctadfaDe uvi;(0srxrim3oudole  neil(f Drru  oo4oetniieilsla2umuvp;u0trerxfciytlptelu o s srur(r oo1olt lfctls  rra(r ;u4alxn ietld aDrluvs () ltomf iy1lmDelivs t seurxo3nu4lmenlfetl( sDurxro;u0olen oeiydls rlnmo t0aetrir tadopDr uvi (  eum(m3iu1lmte fes t  Duaxmpno1ape ifctadfs eln ont4 reomf todomt  u i;(0 2to(m3ny4ale  ietas  rur( pno4tpeomictad a ul(mp;u0areoxo oadlp  an i () etmxmpoudlmtn iciat aDrm(r ;o1ale  f3iasla2uan o;(0teermfcoa1fm raivo;()srtmxmpiu1amt lictls s2ra( ooo4alx ioctlsfmDra(mo u0 lenirctytlm elivs s0srum(r no4lp nmfesl( s2trxrpnt0tpeomi3ildfm rl(vo u4teenmrcoa1lmt lues ()trum(o3oo1altnlnct t)a2rmx ooo1opx mo3ilsla ea( o;(4 ltrmo ty1fpDean s s) exo(mpnudlpte ncsat a2tr(r ;u0alx iociatlsDrmuvo (0 lenxr iodfp eanesls) rto(r nu4lp e fcslsfaDumxm nu1tpt  ieiltls elnmp;t0tlxnxr3iydlpt  nei (  2tm(o oo1ame lfciasfsrtru oot4oleo fcildfs uauvonu0tlenmfcootopDrln i;s  2uoimpou4opt lnesatf rraur ou0optnifeiyd mDra(vonu4aeenmf3iydlaD  uvo;t0sruoxopnu1apt mnci s  2rau pnu4apx  i3tlslm rmuvs;t)aexnir3oo1op rln o ( s2tm(r3nu1oltnmiesasf rua(monu4texomictlsfa2uau s t0aeeoif iy1opD  ivi;s0srxr(rpnudom n fvtat)arum(mp;t4tetnmfciadfs2ul(ms u) rxriocta1fp  aues;s0t2xrim oo1amen feils) 2rm(mo;t1tpxo fcilsfm uau p;(4trxnmoctatlpt  ues;t0t2urxopnu1ap nlneiat  rtrxr nt1aptnmo3taslm2umumpn() exoifciydop eaues;t) etm(opoo4lleemivt s) 2tmu  nt1alxn ietas aDrmnvs u4trxnxo iodfatelivsl() rxo(opno1opeelfvtls  Duaum ou1texo fcias s uanvo u4aexnxrciotomD anvolt)srxrxm3iu4llt lnvt s)arrrx ono1teen i3tls aDulnmo (0tetnxr to1fp  aueil( trumirpoydlm n feiltfa2tmump;u4olxnmoeildfm ea(monu)artrmo oadlmDrluesls)seur(opnudll nmnvs (f 2uru  no0tltoioeiltfm2rau p;() leoif oadoaDr n o (0 rum(opiu1lle mncs s) Draxronu4teenmfciyslmDean pn()tlxrxr3ia1faD luvs s  2uo(mpiy4lpt lfvs tfsDuru pou0tlenmietys a eluvon(0alxrircto1fptrlu ols)seuo(rpoydamenlncilt)a2rm(  ;u4oee  i3tas mDulump t0 eenxo3iotomD lieil()s2ur(r iodam elics (fsDum(ro;u0oleoifeiasfa rlnmo (0 etnxr3iodlp eanes ()t2umio3iudoltelfctl( s2tmum no0oeenmfetatfaDelnmo;t0alerxoctadfat aivo s) exrxm3iu1lp emncs t s2tmxmooo1oet if3tydlm2rlnms;u)tltnxrcootomt li i s)texr(o3iudopt mfcia( a2ururooo1tpeo fetlslm2ul( pnu)aexnio oadfmtr n o;()seumxr3no1lmenlfei s)srraxrono0texo ietydlsDeanmsnt0trxomf3oo1om ran o;(  rtmxrpiudape  nvta(fartrxr oo0tpeoio3ilslsDea(vonu) exoxrcio1lp ranvi (  eto(r oy4op nlncs ()a2uaxmoot0oeenmfeiat s2elu p;u)altrircoadfpDrlueol( t2ur(r oy1lpte neias) Dua( ono0aet  ocilt m rau o u4arxomociytoatelnes;t0teto(r3oydape livt () Dtau o;u0tetn fciyd m2ranmsnu0alerxr tatlp elieil( t2toim iydalen ieta(fsrraumoou4oex iieiyslm2uan p;u4 renio ta1lmDrlu slt  rxo(r3oy1ll  mict t)aDum(rpno0tle mf3iyt s el( sn(0 rtnif todfat au il() eurxmpou1ape mfeia( sDrm(rpnt4aptnmo3iltfa uau p t0tlenio tytlpD aieo;()tetm(m oy4lptelieilt s2ra( oot0olenmfcildla rln p u4 exoifciadoa raieil(0t2umxopio1omt liesas  2tax o;t0apxomoctatfa uaumpnu)texomo3oadoat ln il()sruoiopno4lmt  ieil(faDum( pnu1olxo f3iat a2ulnvp;t0 lxnirciatom raivi;(0srtrxo3no1lpeemicsas  rtm(mpoo4oexo octyt m ulnvs;u4aleoir oodfp   u o s)s2uoirpiu4aptnmiesas) 2umumpoo4tlxnmocildla2ranvp (4aeenxrcoa1op  lies;t) eurxr3nu1lleemnctltf Durxr oo1oex  feilslm2rlumo;u) ltrmr iotlatrlieo;t  2xmio3oo1alte neiat)s2umxro;o1opxnmociys aDrlnmp;(4 leomr3oa1fpDran ol()t2uoiopnudlpeemfctl(faDrax pnt4apx mfeiasfa2ranvs;u) rxrxo oydlmDeaues (0srumxo3ou4om emfeslt s2raurpno1tleo feiltls2ra(vo u)trenir tydfp ranvslt0tetr(opoudaltnlnet t)a2raxm ;u4aleomo3iat m2rauvo;u)tlenir3oatom r neslt0trum(mpiu4amenlictlt aDra(m ou0olenif3tltfs2rln p;()aleoxo3oodopD  uvs;s0 2tm(rpno1aleelfeiltfsrrmxr nt1alxnmieiltfm2umnmp;t) eermfcto1fa r ivi ()srxoir3io1alt  ivil(  2rm(mpno4olxnmi3tytlsDumnvpnt) lxomr3oadlp eanvs t setr(o3ny4ol  lfcilt)s2raxroot4oee mo3ilslmDrm( p ()tltrxr3ty1om eanvsl( srtrxmpno4amt  feiasfs2umum ot0apeoifeias s2rl(msnt4 rxnio3iotoa  luvo;()texoir oo4opeelfvsas)artmx  no4oetn ietldfsDemu s (0 etnmr oadopDr uvi;(0 2umxo nodolen nei (fsrurur ;t4olxo o3ildls el(mo u0altniocoytop e ivol( s2urio iodlp emiei ( arumum ;o4aeenif3ilsfs rm( s (0 rtrmrcoatlaDraiei;(  2tmxm iu1oltelivil(  2umur nt1tetniictasfaDem(mo;u4tltrirctotoa  lnvs t srtr(mpou1aleelicta(fsDtaurp;o0olenifeiatls ua(ms ()aeerircoo1fm elu s (0s2trxopio1op nmnei ()srrrumpno4aleo oeiyd sDra(ms;t) rxrxo todla eaueolt s2xrxr3iydal nlivtltfsDtmurooo0alxo ociysfaDrl( snt0tlermfcoa1fm  anvi t)srtoxmpnu4apt lfviasfs2taum no4aeenifeiltfm2ua( o;()arermf3iatlaD  ivslt0seto(r ou4ll   fesa( a2tau oot1tpto oetysfs uanmp u) leoif3todlaDe ueils t2xmxr no4ap n fvsat srrmumo;t0alt  ociad a2umu o;(4treomr3iadfm  lu i;t  2uo(o3ny4lptn ivias)sDtm( pou0alt moeiadfs2rmumpnt4arerxf iadfmDeluvs t0seur(o3nodlp n fviat)s2ta(m ;u1oetn f3iasls eauvpnt)artrirciadlm  li ilt  2xr(r io1ape mnviat  Dtr(ronu4aee mo3iydfa rmumo u0arxomrctydoaD lu i s)teto(mpny4amenmictat)srumuro;o4aexo oeiatfaDua( o;u)aetnif3ty1fptr nvsls) eum(mpno4llenlicsat a2taxmo;o1apxoioetydlaDemn ont0tleomociodlp  li ols)teurxopoo1om  mfesa(faDrmx ont0ole  ociasfmDel( o;t4tlxnmf3iadopDrlu o t) exm(opoo1lmtemfct ( srraxmo;o0oltomfeiatfs2eau o u0trxrxo3iadom   nvi () exoio oodole  ics tf Drrum ot4tltoiieild s uauvsnt4tltriocoatlmteanvsl( srtr(m nodolt  fcs ( s2rmxmpno4tleomoeiyd a el(msnu4 lerircoa1la  lu i;( srtr(r oudamtemfvsas)sDtrx oou1tlto ieiatlm ulnvp;(4 renxo todopDrlnvi s s2urxm3nodll emfes tfaDra(mp;t1apxomo3iytfa ean p () rtrmf oatlpDr ieilt t2tmxopiydamt lnesas)sDtaumo;o4texnif3iatfs2rm(vs u4tlerxr ia1fp e n s s0setoim3nu1oltnmivslt) Dtr( oou1tetn feildlsDeln s;()tetomr3oydlptrlneo;s0 2trxm3oy4omtnlnes () Dur(rono4olt mo3iydfsDemnvp;u)alxrxocoytlatrau i;t)trxm(mpoydop e icia(faDrau p;u4tpenifctlt a rmnvp u4alxoir oo1fa r n s s)t2xoirpnodllt livtls) 2ua(mpnt0tee  oetys m el(mp;u4aexomo iytomDelivo s)trxmim3iu1oltn fei (f Duax  no1tlt iicilt m em(vp u) rtrxr iy1lp  ln s ( teum(rpiydal  lnvs tfs2ururono1tex mo3iatfs2el(msn(4tlxnir3iytfp eaneil( srurio3nu4om elivsls  ruru  no0aexnmo3iyslmDran o;t0 eeoxf tadop r ieo t)srtmxm nu1ole  ieta(fsrrm(  no0alxn oeildfa2el(ms;t4 eeoxf io1fmDrluvolt)seto(o3oodap nmnetl(fsrurumo;u4optomf3tatlmDuau pn(0artomociotoaD lu i t0srxr(rpno4lmen icsl( arraurpnt0olx  o3tlsls rlu p;u4tetrif3ty1oaDr i ol() eur(o3oo1lpen nci ()srua( p;o0opx moetydlsDelums;t0artoxocta1fmDe nvol(0t2urxrpio4ame  nvslt)sDtaumoou4olt  oeias mDrm(vo t)altrifciytfaDrai i (0 2xm(o3no1om   ivi ( sDrrur no0oex ifeilsla rm(vo;u4aetnio to1lp e i il(0sexr(o ny1ape lfct (faDta(m nt0tleo oeiad s em(vpnu4alerxf tatopD lu olt  2ur(opnodol elici s  rua(  nt4tpx  octld aDuanvp u4 eerio to1fateluvo;s0 2um(o iu1al  livs s)s2ua( pou4aet if3iytla rmnvpnu4arermf3to1oa elieilt)s2uo(r3oy1lp emfvs () 2um(rpoo4tpen o3iydfsDuln sn()arxoir3tytoaDeli sl()s2xmxr3nydlp nmnetls  2urxmo;o4tlt io3tad m eau s;t4aexoxrciydom e i o t0s2umxm iy1oltnmncsasfsDumuroot0alt ifetyt m2eau o (0teeniocto1fatrli ilt t2toio oo1aptn nesat  2ra( oou0alxo oetys a elump (0aexrmr iotfmt au s s sexo(m ny1lpenlies s)s2tau  ;o4apt iieiydlsDumnmont)arxomo3iy1lmtraivslt0 euoio iy1aptelictl(fsrtaxmpou0tpeo oetltla2eanms;u)tlermo3todfmD aiesl(  2urxo3oodamt  neil( srtr(rp;u4oltnio3tydfa2rmnvo (4 rermociotomD livo;t)t2uo(m3oudlpt lictatfsDuau pot0oetnii3tyd sDel(vo (0tetrio3ootfmDrau il(0trtrimpnu4omee ivi t  rum( o;u0olxnioeildlaDul( s t4 eeoxr to1fa rluvs (  rxm(r3oodalte fctatfsrtmurpou1tle  oetysfs ea(vo;u4alxrio3iydfmtrlivil()srxoxr iudlmt lfcta(  2umumpno1apeomietadfs2eln p;(4trenmocoodfaDr n o t  rxrim oodll nlnvt t) Durumpnt4tlxo oeiydfsDrlnvo t) exniocto1om eaueo ( texmxrpoodlmen icia()a2trumpnt1oetnmieias aDumnmo (4trxnmo3iatoat  iesls) rxmxm3oo4lmtn ict (fsDtaurpot1alxn o3ilslaDemumon() renmf3todomDrli i t0s2uoio oudll nlfeia(fsDrax  ou4aex mi3iadla2uanvo;u4 lxoio3oy1la rai o ( t2xr(r3nu1ap e ict ( s2taum no0tpxomi3ias mDran o t0texnxociatlptranei;() rtmxo3oydlptn nvtltfarumu p;u0tlx moetltfs ulnvs;u)aeeomo tytfaD lueil()setrim3iu4amtn nctltfa2uru ooo0teenii3iysfa eluvo u)tltnxo3ootopD au o ()setrir3oudome  ieta( srta(root0oleniocild a2em(mo t)treomocta1fpt  neol(0truoxm3io4op elfctlt  rum(mpou1tpeomfetysfs um(monu4aexrirctytoate nvol(0t2xoimpny4om emncslt)sDraum ;o4aexomfetlslaDuau p;u0texoxr oa1fa  lu s;(0srurir no4ameelfcil()arururooo1optomfciyslaDul(von(4 rermrcootfatrlivilt)t2ur(o oudale  fcsat) 2urur ;o0tpxomoetys a rauvo;(0 eenmociatfmDelneols)seur(opou1lmenlfetat srrm(mono1tlxoii3iad s rluvpnu4aeerio to1lmtranes;s0 2urxo nudapeemfcsl( s2rax  ot1oleomieiad aDul(mo (4 rtoxociy1latr nvi;( setm(m iu4alt mfet () rtmum oo0oexo feils aDemnvont0 ltrxr3tydlpD an ols sexm(mpiy1al e fvtasfs2rmu oot4apto oeiasfa emu s;u0artoxf oo1fmD  u o s)srtm(mpiydomtnlnvta(  Drm( poo4tle ioctaslsDranvs () exrxr ootlpD lnes;s)srxo(opoudom elfetls)a2trx pno1tpxomo3iydfm el( p (4arermrcty1laDraivs s) eto(o iudaltemicsas)s2tmu oou1apeomiciytfa2em(vs u4aeerir3oa1opD aivols trxm(mpio1amtnmiet tfarta(  no4tex ifeild s em(vsnt0 exnmf3oo1fmDeau s t  rtrimpiu1amt  icta(f 2umuronu4tleo oeilslm2ean pnu4 rerio oatfaD livol( teuoimpnydll e ietl( arrax  nt1opxn o3ils m ulumo;u0tleomo tatlatr n s t0t2xm(m3nu4lmt licsat)aDrrxrp;t1aleomoctasls rmn pnt4tetoxr iytomtr ues s)t2trxo3nu1llte ietls aDuaumpou1aet  i3ildla2rln o;t)teenmrcoatlp  lnei (  eur(m3io1am elieslt)s2urx  ;t1aptomo3iydla2ul( o;t0 rtnmf iytoptr ies;( t2tm(opou4ole  fet tf 2rmx o;t4ale iiciydlm em(vs;u0tltrir3tytom   ueo;t0s2uoio3iy1amte icilt  2ur( pno4tetoifeiatls ulumo;t) ltoxf ta1la elneil(  rurxrpoo1olt lnei s a2rax  nt0olx if3iysls ua(mpn(4teeoxfctydlatelueo;( setrirpiodlltnlicta(fa2urx pno1apxn f3iytlsDul( ont)aeenio oatfa eau s (0t2umxr3oodopeelfet t  Drm(mo;t0tptoif3iytls ra(mo;u4tlerircoatlp rlu i;( teur(r3oy1omt  fetls)a2rmumpnt0tlt miciatls2um( o (0 rtomo tatomt lu olt trtm(o no1ome  ivi t)srua(rpot1alxo o3ild s2eaums;t)aexrmf oydfmD aivs;t) rxrio no1olt lnei s aDrrx o;t1ale mi3tytfs uauvsn(0 eermo iy1fpD li o;()s2xrim oydlpt lncias  Drru p;o1alxo ietyt s ulnmpn(0trxnxr iadlp r ueo;(  rtoxr3oo1ope lfvtatf Drm(ro;u0oltniictld sDumu snu)altnirctodomDr u ols0s2xrxm3io4amtnmfvsl(  2umx onu4apx miciat sDeauvo ()tleniociydfmt  ivslt0srxm(m nydome mici () rrmu oot1tltnmoetyd m2rlnvp;(0 rxoxfciydlm elueils) etrxmpoodoptnlfeias arrr(ronu0tltniictltla rauvp ()teermr3oo1opt  ueil()seumxrpio1ale  fvsas  rtaxm nt0tlxomfetytfm rmnmpn(4alerxr oodlatrlues t seur(rpoo1omee ics s srtmxronu4oeen fetys a el(vp () renxociy1om  aieo s)trxmiopoy1oleemncsasfsDur(  ;t1apxniociysfsDumums;u4tlxnmfctytlpD lneol(0setrxo oo4apenmfei t)sDraur ot0oltniieiyslsDul( o t)texnir iotopD  i sl(0t2toxm iu4amen ivias)s2uaumooo1tltomfciatlsDrmnmo t4tltrio3iotomD lueslt0setrir3oo1optelictl( srumx  no1altnmfciys m ra(vs u0areomo todfp  lnvo;s t2xmir3iu1alt lnvtatf Dua(r ;t4teeo f3iltfaDul(vo (4tltnmfctodla elivslt  exo(r3iodopenmfci t  rtr(r nt4tpenio3ias a2rl(vsn()treoxf3iadlmt anei (  2umxo3nu1ameeliei tf 2ur(  nt4tee iictas sDrlnvpnu0 reoxo3todop rlnvs;(0 rumimpny1lmee neils)artm( o;o0tltnifetysfm2eanms t0trermo3tytlp  lnvols srxrxmpoo1lm  mnct s a2ururpnu4tee mfctat a ua( p;u)areniocia1late ivolt0s2trxo iy4ope lfct (faDrm( ooo0apt ifciytla rlumo;u0tlxomo3oa1fpDeaivo;s0s2tm(r3iy4apeelfcilt  rumump;t1oetnmfetyslm2el(mp u0 lxrxf3iotfpDrlnvs;t)sruo(o3iydamt mnetas)arrr(m ;o4oeeomoetls m2ulumo;u) etomfctadlm   ivs (0 2tmir iy1oltelnvs sfarrmxrooo4tpt  ietas a2ea(msnt0alenmo3iadfptrlu sl()srurir3nudam   fctltf rtrur oo4oltn i3ilsla2ua(ms;(0trtoxo oatoaDrlnes t t2tmimpnudopt liei s arrau poo0apxn feiatfaDul(msn() renir3oy1la eauei (  exr(r ny4ome mfcils) rrmxmpoo1opx  feiaslsDeluvo;t0trerxf3totoatelnei;s)tetrim3no1al n fvslt) 2tm(m nt4teeo f3tyt s2ea(mp;(4teerxf3ty1lmDrli sls0 2toio3oy4lm  mfesl( s2urx  nu1opeoiiciad m ra(mp;() exrmf3oo1lpte ueo s t2trim3oodlleemivt s a2umx oot0tpen ieildlm rmnmont)teenifciydla eli o;s0truriopiudlltnlncsasfarrm(  nt1tpx  o3iatlmDua(vp t)aetrir3iytfmte u slt s2to(mpoydlpen neias) 2rrxmpnu4opt iociltlaDean pnt0tlerir ootfp  livolt  euoxrpny1aleelnvsl() 2uax  ;o1oltn fetls s eluvpnu4 exoxo oo1fm raueo s  2to(o3iydoleelfctl()arraxrooo4tpx if3tltfa uluvo;(0 lerio oy1fp rlivs;s sexrxr3ou4ol e fvsltf 2rrumo;o1apt mf3ilsfa rl(mp (0teerxrciotoptrai i;t)s2ur(mpnu1lpe lfcslt s2urur ot0oeen o3tyd m eanms;u)trerxf3oa1la eanvi;s0srxmiopio4oltelncslt)aDrmu  ;o0aetnmi3iyslaDumu o;(0texoirciatopD  uvsl() rtoim iodamen nci t)sDtrumpou1oet  fcilt aDumumo;()texoir3iodfpD auesl() exoiopoo1oltelnesls a2urumoot0tetoiieiysls em( onu0altoxrcoa1lm eauvi;(  euoxo3nu1lptemfcslt s2urumpnt0oltn f3iltfa elnvpn(0tetrircootomtr iei (0 etrxm3oy4lmte net (f Drr(  oo0ole ioctltlm2rlu p;u0artomf3iatfpDelnvi;s0srxmxm3nydlm nlnct () 2uaxm no4tlt mietad mDem( s u0trxoif3oydom r n i;(  euoir3nu1lmtnlfvsa() rur(  ;o4oee mo3tydlaDrluvo;(4treomoctadlm rlieil() 2um(r oo1lltemfesasfa2ra(r ot1tlx  o3tldfm2elnvo;t)texnxo3oy1fatr ueil( srurxmpno1op  licilsf 2umur ot0aptomociasfs2ulums;(4aexnxocta1optrlieo;t teurxopnydlpe  fetas arrr(  ot4opeo iciytla2eauvo;t4 rtnif3to1lp  anei (  2urim iy4am n ivtas)a2umxm ou4aee iieiydfa2ean p;u4tltoifciydoate n ol(  etrio iodll  lfes s)sruaxmo;u4tpto o3tytls2emnvpn()arermf3oatfmD  i sl(0 2uoir3oudopeelfesat)sDraumpoo1ape  fctlt aDemumsnt0aeeoxo oydfp elu i;t)tetmim3nydamenmivt t arrmxmooo4aet  feiytla rlu onu4trtnxo oa1lm  anes ()s2xm(rpnu1al n nvtlt srtaxmpno0olxnmi3iydfm uan onu0trxnif3oodoa r nvo (0 eumxopoy4aptnlnvi tf rum(mont0aee moeiydfsDemump;u4tetomr ta1omt  n slt)s2urxr oo1am   fcia()s2ur(m ;o1tptomf3iadlsDra(vs ()alxrxf3tydomteaneolt t2umiopoydame mieslt sDra(mo;u4tpxo ictys s2umnmon()tlxnxfcoo1lateaneil(  2xrir ny4ap elncia( s2raxr ot4aet ii3iytlm2ranms (4 etrif3iotomDrliei s0sruoiopoy4lleemfvtasfaDum(rooo0texnifetat sDea( p (0alxrio3tydlaD  i ol( s2umxr3nu1lmeelfei s  2rm(rp
\ No newline at end of file
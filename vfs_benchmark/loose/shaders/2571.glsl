@@ -0,0 +1 @@
+uvo t) eumxo3nudllt micilt)arurxmpnu4alxoio3iasls em(mo;t0 ltoir oytopDeaieo;t  2trxrpio4am nmnci tf Dtmuro;t0oetomo3iytla ulumo () eeomr3iodfpDe u i s t2xr(o oydlpenmies sfs2ra(r ot0altnmf3tys s el( o;u0 eenmf3oa1fmt aneo;s)s2xmio oodapenlfvias)arrru  ;u4alxn oeildfsDra( p (0trtnif oatom eli i;s0seuoiopiodal   iei (farumx onu4olt mf3iydfs2rm(vpn(4 etrio3ootlmtranvs;t0 2tmio oudap  lfvsl() Dua(m no1tle ioeiatls emump;t0alxrircia1oaDe ueo;( trumxo3nu4apee fvsls)aDum(mp;u1alxomfctyt m eln s u)aleriociydopD ln s;t)truoxm no4apenlfcs s  2tr(r ;u0oet  f3tad a2rl( p;u4alxnio iotfat  nes;t0srumiopou4opte nciasfarrmurpnt4olt moeias a emnmp;t0trermocoytfpte u sl(  exo(o iudaltemfvil( sDra(rpot4aptoifetytfsDrmu o ()alxoif3iy1op eln sl()t2tmimpoydlmt lnvils)s2trx p;u4alx iictlt a2eaumpn() exrxfcto1lpD aies;s0t2umir3iydlle lfesa() 2ta( o;t0tleo fciyt m rmu onu0 reomocoy1opDean o t0trurxm3ny4lm e nvt t) Draxr no0optn fetls s rmu pn(4areomfcio1la  lneo;t srtrir iodlptelfci s) rua(  ;o4oex ioeiyslm2um(msn() reomfciy1fa r n s (0 etm(m3iy1aptnmfcia() Drmu pno4apt ii3iltfs2ea( s;u4 rtrxo3oytfp e uei s0srxm(o3nu1ll e icil(f 2taxr oo0aexomoeiyd s2rln s u)altrmfctadlpt  n il(0 2toir3ou1lp   fet s) 2ta(r nu4tlx mfetatlm2uanmp (0 lxrir3oytom raneol( s2toir iy1ap nmictasfs2rmx  oo4aee if3iltlaDea(mp;(0teermf3ta1laDeau olt srtrxmpio1ol  lieils)srraumpoo1aexnioetlsfs rlumo (4aleoirciodla e uvi t)tetm(r3no1aptelfcs sfaDurxrp;t1tpxnifctls s2ra(ms u)texomf oa1fmt anes;( texo(m nodlpenmfvsa(  2rm(monu4oee  fetld s umuvo t4 rtoiocoy1omtrlnes;t s2tmxm oo1lpenmfeiat) Durxr no4apenmieiytlmDum(vpn(0trxnmfcta1lmt  ieilt0s2uoio3oy4op  mivilt)a2umxr no0oetniociydlm2ra( pn(4trtrmr iotlaD lues t seuoxo nu4lmenmictl(faDrr( p;o4opeomo3iat aDuln ont4tltrxf3iatlpt  i olt  2ur(r iodllt  fci ()sDtaxmont1tptomf3iys a2elnms t0 rerif3oy1lmDe ueo;( s2xmiopoo1al nmfesl()s2tr( ono4apenifeilsls2rm(mpnt) lxoxo3ta1oa raivilt)tetmxr nodlp emnvs s aDurumo;u0tpxnmi3iadlmDea( snu4aeerio iytlmt lnei ( t2toiopoy1lmt lnvsls arraum ot1oltnmf3ilsla el(mo;u4texoxf3ootfmDran ol(  2uriopno4llenmncilsfsDuaum ou0aet ifeilt a2emn p t0tltoif iy1fptr uvs ( s2toim nydaptnmieslt  rumxm ;o4optnmocilsfa2uaumo;u)teeoif ty1lpDeanvo;( t2xm(o nodop  mieilt srrax  nt4tpeo fctyt s umumonu0 etrmfciydfpD  ies t)trur(rpio1lmenmfeias) Drmur ;o4alen f3iat s rlu s;u)trxoxfcoa1lp  an ol( srumir3oo1amen ictl()a2tru ooo0aptoii3iatla2rmnvo (4aetnmf ta1opt  ueo;t0srurxm3no4amtnmnvi s) rrru  oo4texoifeiatlm ra( p;u4 rtoxo oatfmD lu ols)truoxo3ny1lm e ncs s)a2ra( p;t0apen oetydls eau p;(4trenifcoytfa  lnvil( t2toim3ny1alee ncil( srtmx p;t0tlto i3tat s elnmp;()tlxoxfctydoa  lieil(0trtmxr3iy4llenlfvs (fs2rau o;o4alxoioctltlsDrlnmp u0aleomrcoatop r u ol()trtr(m iu4open ivsatfaDraum ;u0aexnmiciyt a el(ms u0 ltnxf iodlpDeanvo;(0seuoir3nydapen fct ()aDra(mpnt1opx ii3iysfaDrauvo t0tltoio3oydomtelivo s) rtmxr3iydlmtnlicia(  Dur(ro;o0tpxnmiciltls2ea(vo;u4tetomf3ootlmtraieslt0s2uoxo3oodom e ivt (f rumx  nu1teenmo3iydlm rl(mont)tlxnmr totfpDe n i;(0truo(o3oy4ome  nei t)s2rau p;u1opeoiiciytla rl(mpnu)tetoxrcoydomDeauvilt s2ur(m3iydlm e nct ()a2raxr no4ale  fctltfsDelnvs;t0tetoxocoy1fatr ivo;s  ruoxrpio1lmeelfvsl(fa2um(r ;t1tet mo3iasls uau ont0 rerif oytfaDeluvilt)srxmxmpnu1lp n ncs tfa2ururpot0apxo ieiysfa rln p (0 lenmo3oydlateau i;s0 2tmxopoy4op   fcsa() Draxmo;t0alx  octys a uluvp;t0trxomf3oydopD an olt)t2umio iy1ll   fviltfs2rrumono1tpto ietyd sDumuvpn()altrif iy1lp ran i s)srur(rpno4am   fetls artrumono0aptnmfciysfa rl( o t4aetoir ootoa   nvolt) euoir ny1lpt licilt) rtrum ;u1tet if3tadfs2eanvp () eenxfciatfmD  nvs;s0t2umxr3nydlle  feia(faDrmumoou4alx ifciad s2eluvs;(4trtrmoctatlmteluvol()setr(m3iu1am   net t) rumu pnt4alxn o3tatls uanmsnt)tltnmrciatlate ivs () 2xoim3oy4llt lictlt  Dumurpou1apxn ieiasfa2rmuvs;t0aexoxf3ty1lm raneo (0sexrxo oodolee nvsls artax oot1tptomfeiatla2el( s;t) rerif oy1opDrlu o s sruoxo nydom  lfeil( a2rmxrpnu0alxn octyd a elu s u) leoxfcto1opDelu s t  rtmxo3iu4al n ieias)a2rr(m no1tpen oetyt sDemn p u0trtoircto1omtr ivi;t)s2to(mpny4am n fei tfa2rm( ont4optn i3ils aDrl(vo t4artrmrcoytfmDean o;()seurir ny4ame mnvt tfartm(mp;o4openiociltfaDulnvpnu) exrmr iadlpDeaieo t t2uoim3no4aleemnci (  rtrur ot0tptomfciydfs rmnmonu) rtrxfciotlaDrai s t0 2xm(mpno1llenmiet (f rrrx  nt4optomo3iysla em(vpnt4arerio oo1om eaivsl( srurirpio1ll   fci s)s2ururoot4ape mo3iat s2emums u0 rermo ia1la rluei;s  ruoxo3iydll elfvsat  2taumo;u4teeo ieildfaDuaums;(4tleomo tydlmDeaueo;t)srtr(opoy4ame mnvsas) 2umxmp;t4apxomfeilslaDrlu o u4altrmrciydfp rluvs;t trtmim iodol   fcs (fsrrm(  ;u0apxoioeiyslm ul( p;u0 lxoxoctadoat  ies;t0seurim3io1am emneiat)a2raxm ou1aleoioetldlmDrm( onu4aleoxr3iodfaDeaivo;(0s2urxo3no4ope  fvtatfsrur(root1tlenmocild aDrlu snu0artnxo oo1oaD aueil( seumxrpiodaptnmncta(fsDtmu o;t4aetomoeiat m ulnvonu4trxnxo3iotfp r nvi (0texmir3nudaltnlivi t srurxronu0tpenmoeils sDuanmp;t4aleomrcoa1lpD lu ols) exmio3no1ol n ivsl(  2tmurpoo4aetoioeiysfm eln o (4 leoiocto1oaD  nei s0sruoxopoy1ll n nesat  2ur( pnu1oex iociyslm2ranvs;u0aexrmfcoa1fp rlnvils0 2umio3ou1am nmfvtatf Durumo;o0aexn f3iydlmDel( sn(4aeeoxo3iotfmtr uei t trxmir3ny1lpenlnvia( aDrmx o;u1apeniieilsls2em(ms t)tlxrxf oydlaDrlivilt t2xrxo3io1apenmictl( a2rax oot4opxn i3iytla em(mp ()alxnxr ty1optrlies;(  rumim3iu4lpeemnei tfa2umurpnu0oee  ietadfaDem(vs t) ltnxr3tadlm rli sl( trtmim3io4altemiesl( s2ra(  ou4olxniietyt m2ra( onu)texrir todfaDran o;s)srxmim3oudolen fvil() rrmxmpoo0apxn iciyslaDrm(von(4aexoircta1lmt lieo;t sexmxopnu4llt  nvtls)aDuaxr ;u4oexomo3tytfs2emu p u0aexnmrcoy1lpDe ieols0 exo(m3iydop  mivias)sDuaxr ;t0teenmietydfmDra(von(4tltnxo ia1lmt auei (  exrxm3iodopeelnvtlsfsDtrxrpnt0tetnif3iydla rln snu) rxnxo3iotoptelu i ( teumio iu4opt lfvtls)a2rmxm nu1alt iiciyslmDum(vo;u4tlxrxr3ia1fpD  n i t)sexrxmpno4lpt  fvtls) Dtm(  nu0oexomicild a2um(mo (4 rerio3to1oa  aiei t0 2urio ny1ol nmnvsa(faruaxront4opxnmieiyslmDuaumon() rermf totlmD lnvs ( sexoxmpnodlm emncsat)s2um(  ot4tet moeiltfm2ua(vsn()trxrio iydlmDe uesls0tetmxopiodapeemnvtas aDtrum ;u4oeeomf3iadfa ua(mo u4altrmr3ta1lat ai i;t0srumxo3io4opeelfeiasfaDrm(rp;o1aee if3tatla2ulnvs u0tltrmrciydopt luei (  2trxo nydolt lfes t)a2ururo;u1oetnmoeiad a rmump u0 ltoxo3iadlmDelivs s)texoxm3ny1op nlivsa(fa2tr( pou4alt mo3iatlsDrl( s t4 ltrif3ty1opt  n s;t)sexoim oydopeelnvtlt)a2tru ono0ale  i3iyt sDeanvsn(4tltnio3ty1fptelueo;s texmimpiy4oleelicta(f Dtrum ou0aexoiociad sDua(mo t0 rermoctadlpDe ivs () etr(opoo4om  micslt sDrax  no1optoii3iysls rlu p u0alxrxo oytom  luvo;t0 eur(rpio1lpt mncslt)arrax  nt0oexnmi3ilt s uan s;t0tlenxf ty1op  luvslt0 2umir no1optemfvsat)srrruroou1ape mi3tatlsDrmnvs;()artrir3iydlm eluvi () eumxopnu1al emiciasfsrrr(r ;o0texnioeiad m ranmo;t) rtomr oadlaDr ies;t  etrxm3oy1opee feilt arua(m nt1oetomo3tys s rauvp u)aexomr3iatlpDe u s;s0 rtmxr no4ll nmfcsa( aDumu  oo1apeoioctls sDrm( p;u4areoir tydfp r n o s  euoxm3oodam nlivtatfsrumxm nt4tpenmi3tlsfa rlnvp;u0 rerir oytlm  liei t  rtoxrpiy1omeelietat s2ua( poo0ape iicilsfsDran s u0 leomfcootoptr uei;(0sexmio3iu1al  livsl(  rrr(mo;u4apeoiociytla2ra( p;(0trerxf io1lp  ai o t0texmxrpio4ol nmicsat aDtmur ;t4olenmocilt aDul( o t)aexnmfciotomteaiei ()trxm(opoodaltnlnei (fsDrrx o;t0tex mietysfa2rm( onu) etrmfciydomtrlu s;()sruoirpiudamt  fesl( arta(rpou0ape io3tatls rl( o;u) ltrxr3totla   uvilt  2xoir3no4amenmfvi t)sDtaur nu4tpenifctat a el(ms;u4artniocoydfp rlivs t texrxm3iu4apte ict s)a2trxrp;t4opt ifeiadlsDemu pnu0artrir3iatopteaivs;( tetoxm3ny4lm nmivil(fsrrrx  ;o4ope mo3iydlmDumu p u0texnmf oatoa   ivslt s2tr(o3ou4amt  fvias) 2raxmoou0tlto oeiyd mDuluvsnt0aetoif iatfm r i i (0s2tmirpiu4apt  ict t s2urxrp;t0aeto iciytfm2rmn p;t4texnxr oydopDeai i t0teumxr3oo1optn nes () 2rrxmpnu0tee ifctat sDrlu o;(0 renxr3to1lat lueo ()trurxr ny1lm  lict t sruaumo;o1aeeo o3ilslm el(mp u4 rtnmr3iadla rlivs;s)t2xrxo nudlpt mnviasf 2umx oot0ape  o3ilt m2rlumsnt)altoir oodfptrluvo s  2xo(r3no4omtemnetlt) rrrumo;t1opeo ietadfaDea(vo;(4trxriociadoa rln o t0teuo(r3ny4lp nlfcsls) 2tm(rp;o1aetniiciadfs eanvsnu4 rxnmocoo1laDe nvslt0seuoxmpoo1ope lnvta(f rtr(mpnt4teto oeiytla rlumpn()alxoio3ia1lm  aies;s tetr(o iu4apeelfvil(farrmx pno4oltn fciyd m rmu s;u0 rxnmfcty1fateai i;t)trtr(mpoo4omeemneiltfsDtmxm ;t4aexo ietys m ul(vs t)aetnxo iytopte i o s)s2trir ny4omtnmnesas  ruaurpou1tetnii3iydfm2el( s;t4artrxo3iytfmt aies ()t2xoim3nu4ol n iciltf Dum(m ou1tptnii3iasfa ulnmsnu4arerxf3todfate u ilt0 ruoir3no1lmee neilt) Drm(root0texnii3tasfsDranvs;(4altomociotlmt lnvi s)trum(rpiy1llenlncsl( a2ra( p;o0aex moeildfs2um(vs u4trenmf totfatr uvsls0t2toxo iy1llenmfes (  Dtaxr nt1tlxomfciysfsDelu ont0texnifcoadfmD li il()t2uoir3io4al elnvilt) Dua(rpnu4ope mfciydlm2eanms u4tetoio3tadfa  anvi s)setoim3io1llt miciat) rrrxr nt4aleo fciat m2ra(mo;t4alenirctytlmDelu i;t0 eum(m3oo1apt  nci t s2rrur nu0olt moctydla2el( o (0aetnifciatlm rai sls s2xrxo3ou4lmtelfcilt)arrrxmo;u4tltn oeiyt a eanvo;(4 ltnmo3oadfatran o s)teur(r3io1alenlfvs sfsDtr(ro;t0optn o3iytfsDeauvs;(4trerio oo1la elu s;t trxmiopnudape  fesatf Dtaxmpno0teeoifctasla2ea(mp () ltnmf3iy1laDrauvolt)teurimpio4lptnlivtasfarur(rpnt0alxnmoctadfmDrln onu4tlxrio io1oaDrau i t)texmxo iydll  mieta( sDuax ono4oetoiieiltfmDemuvs;u) lxrmr3ta1lat an o;( t2toir nudameelictas aDur(rpno4aexo oeiyt a2rluvp u4alenmo3ty1op rlneo t0srtoimpno1aleemietls)arurxmoou0olxnio3ilt mDrlnms;t)tlxoxf iodlmte neol()trxoim nydap n fvs t)aDum(  ot0alto ictydls em(ms;t0 etnxociydoatrlnei;s0texrim3oy4ap  mfeias srum(roou0ale  fciadla2raumo;(4 rxrmo ta1fmtrlieil( teuoiopoudlp nmncias) rrrxr oo1alxoifciyd a2uluvp;u0altnmo iydlp   i o;(0 etoxm3ny4am  mfei s srta(ronu0oexnio3iadlm2eaumon() rxnxr3iytoa   ivslt)trum(m3nu4omen fctls a2raxr nt1olxniieiydla ua(mp t0teermr oatlpDe i ils0 rur(r ou1omte iesl(f rrm(r oo4apenmictytlm eanmsn()aeermo oa1oatraivo ( trxoxrpiu4op n nesl( arta(  no0aex  o3ils m2ranvon()texrxr oa1omD lues;t0 2xmiopnodlleemfei ( sruaxm ;u1oetn o3taslm rlu ont4 exoxrcoytfaDelieil()s2tm(r3no1ame mnvtltfs2tru ooo0oltniiciyt m umuvo;t) eerxf oa1laDe i ilt)teto(mpou4aptn ivt t) 2rmxr oo4olxnmo3ild m emnvp;()altnmf oytomte nvo t setrimpnodalenlneilsf Durum nt1tpeoifctad m2ua(mp;u4 lermo tydfmDrlueo ()t2um(m iy4amtelfvsat  ruaumooo4aetn feiasfsDul(mp u)arerir3iatfpt li o ( tetrxo nu4lp e fcsatf 2urur ;t4apx  o3iadlm2ranmo;(0aeermf3totfaDran o;t)t2xo(opnu4op elnvilt) rta( p;o0oetoiiciys s um(mp (0 lxoxr3iotomtrli i t0texmio oy4am emictl(  rrrx  ot0alxn fetadfm2em(mo;t0 reomfcoadlaD lnei;()texr(opnudamt  ivtat) ruax onu0oeenioeiatfmDelnmo u)trtoxo3tytfmt  nvs s0srtr(mpoo1omtnlict tf 2raum no0aee ioetldfsDulumpn(4teermo3oatlptelneils) exo(r ou4am  lnei ()aDumumoou4tltnii3ilt a2rlumon(0 rtrif iadoptrlu i;(0 rxoxm3oy1opee feslt s2taum oo0tpe ifciysls2ranms;u0tlxomf oodoa r ueo;s)t2uo(rpny1lmtn feil(fartmxm ;u4apt iictaslm ul(vo u0 lxrif oatfp ran o (  etmir iu4op emics s)sDtaurpoo1oetoiieils s rluvo t) rxnif oy1late i o;s) exmimpnudaltnlietasfsDumu oot0aleomfctls m rlnvon()trtomoctytfpt  u s;( trto(m3ou1ale lnvils  rraurpoo1apx io3iltfa2rau s;()alermf3ty1oateaueo;s0 rtmiopny1amtelivt t a2um(  ;t4optnmociasfa uluvsnu4 exrif3io1omtrlu i;t trxoxo3ou4amtnmfvta( arurxmpnt4oetniietatfsDeaumo ()aleoiocoo1opt lieils t2xo(rpoy1amtnlnvsls aDtrxr ot1olto ieilt m2emnvp t0arxnifcoytopDrlnvsl( teuoxr3iu4olen ieslsf Duaxro;u4tltnmictad m2ra(vo u) eenxf3oatlmtrlies (0seuoirpnu1apenlneils  2urxmpno4tetoifciatfm uanms () lenxoctytlpte nvo;t  ruoxo3nu4omen nct t  Dumx pot4tpx  icilsla2ranmp;(0alenioctodlmDranvo t)setrxrpiy4lme mncilt  2tmuro;t1olxo ociytfsDrlumont4trxomr oytom eanei;(  2urio iodomtemivs ()s2rmxmpno1aleomicias a2ua(vo;t0trenifctytlm  auvs t  eumxo iudope mneiat  rra( oou0tpt  ieilsfs2uauvonu0 lermo3iotlmDranvi;s)seum(mpoudam  miet sfaDumx pot1tetnmocilt a um( o;u4alxoio3ty1fmt anes;t) euoir3no4al e neta( sruaur oo1olxomfcild a2uan pn(0tetoxfctotfptrlivo;s0teurxrpoy4llte icias  Dra(monu4apx mieiydfs2rm(mo;t4areomf iodfaDrauvi s s2tmxo3ou4lleelnctls  2tm(mpot0tlen fciasls rlnmp t)trxrxf iotfat  uvo (0 2tr(m ou1om   nct s)sDtrum ;t0tet mfeildfs2umuvo t0 rtrir3oodfa  ai i ( tetrirpiodlltnliet s)a2ua(mo;o4ope moctat s2eaumpnt0 rxnmfciotfa r ueo;t texm(mpio4am n ncsas sDrrx p;u4tptnmociyslsDrl(mo;t)texrifcootoatr nvo;t) exrim iu1apen fes s  2ra( p;t0apxnmfeiyd a2uaump;t4trenmo tydoaD aivs ( s2xrim3iy4amt mfeias)a2rr(r ;u0apx  f3tls mDrl(mo;(0artoir iatop e ueslt srumio ou1amte nctas)a2tmuro;u1altn f3iytfm umn p;(4 exnxo oa1fm ran olt)seuoiopnudalenmnes t)aDtrxr ;t4opxo ieildlsDrlump u)tleoio3oy1lmtrlueols0setmio nodlpt mfci ()a2ra( p;u4tlxo o3iydlsDel( o;u)artnxfciy1la  ai ol()s2xoxr3iodoltemivtlsfa2uaum ;t0alxo ieiatfa raumonu0texoif3totlm   uvo;(  2um(mpoodlp  mfetas) rtaurpoo1oexo i3iyslaDum( pn()tetriocoatlmtelnvi;t  2uoxr nydlm  mfcia(fs2ta( pou0oex mocild a rm(mo u)artrxf oydfaD liei;s)setmxrpio4ope lictlt)aDtaurp;u4opeo feildlmDrmn snt)trxnircia1lmtrlueo;(  rurxm oo4apt mfcils artrurp;t0apeniictat s rmnvp u4tlxrxocoy1oateanei s t2xrim3oy1lpt mnvtls) 2uaxrp;o4alx mi3iltlmDua(vs u4 rtomf3to1lm  ln il(0srtmiopnudlmtn nvtltfs2umum nt0oltoifeiltla2el(von(4 lenxf tadomt anesls trxmim3io4lm nmnctlt) rur(mo;o1tpxnmiciasla2rl( o () etnifctotlmt lu s;()s2um(opiy4llt lnes s  rum(mpnu0optnioetydlsDrluvs ()alxoircootlm eaneils0s2uo(rpnodap n nciltf ruaxrpot0tpt micils m rauvo;u) eermoctatfaD ln i;s)trxm(rpoy4am   nct tfs2tm(mont0texoiicils s2emuvs (4tleomfcto1lmDe iei;(0teurimpoudomen nes sfa2raumpou1texnioeiytla2um( ont)aeenxr ia1lpDeauei;t)trtr(rpiudalt  nviltfarta( oot0aet mfciys m uau p (4 rtriociytfp  an i s0 etrir ny1altn nciatfaDtaxm nu1apxoifciadlaDemnvo () lxnmr todlmt li o;s0trur(r io1alt lnvilsfarur(ront0aptoii3tyd a2ra(mo;(0tlermfctytlate nvi (0s2xmxm ou1lm   ieslt)sDua(mont0opt miciys m el( o;t0trtomf tatlpDeanei t0 etrir3ny4omt  fcia(  2ta( o;t0alxo oetltfsDua( s t)teerxo3iydlmt  ivils0s2uoim3oydamee fviatfsrtm( o;o0olt mo3iydlm ua( s t)aetnmo oo1oatrai sls)sexoimpiudameelfvtat  2ua( poo0ape mocilsfa2ea(mo t4tlxrmo3tytfmt li i;(0setrim3oydal nlivs ( aDtrxm oo4tpen ociysfs umnvp;u0tltnxocio1om rlivsls)teuo(mpoo1lmee fes (  Dra(rp;u4tpx mociadlm elu p;t4aexoifcoo1lmD  nvils0sexr(r nodal  mivt s  rrrxro;u0aetnmoetld s2rm(mo;t4 lxoxr totlate u i;(0trurxmpnudamt mfctat srtrurono0tee  o3tasfm ea( p;(4tlenxrcio1fp rlu s ( s2tmiopnudop   iesl(f Dtmumpoo1olto octls a2rm( p;t) lxnmo to1fpDraivo;(0trxr(o nu1llte fviat)a2uax  nt4opx ifeiatfsDul( s;()arxoif3tadlmt ai i ( sexo(r iy1lpenmivt ( arrrx  oo4aetnifeiltfaDelnvo (0texnmrciy1lmDrlueo t)trxr(mpiy4ope mfvias)srraurpou1olen o3ilsls ua( s;()aeenxfcty1fa   n o t0 exoio3oydlmee fvtlsfa2uru oou4oet  icildfa rlnms (4 etnxocoodlaDeluvi;t0srur(mpnu4ame miei s) Dtrxrpou1oet  feiadfs2ulu onu4texomr3oodfptraies;t) etrir3iy1lle  ics ()aDrmu  ;o0tpt ii3iydls rm(vo ()aetoif3tydfaD  ueil( texmxm nu4amt mfvsls srtm( oot0tet  ociatfs umnvsnu4 lerir3ia1lmDr i o;t0 2umxm3iy1open ics s a2trurpno1alxn fctld s emumonu0texnmfcoydomt ai i (0srtrirpou1ap  mnei sf rtmurpno4tlx mf3iyd m ranmont) eeoirciytfatran ol()trumxrpiydam emnvsas a2rax pnu1opt  fctadfs2rmnmo;u0trtomo oydop eluvolt)trum(m3ny4ll n neia(f 2tmu p;t1altn i3ils mDuan pn(4aeerxoctydfpDrlieo t)seurio3iudamen ivi (  Drmxm no4opt ifeils m ea(mp;(4altnif3tatopteluesls  rumxr3nu4lmen ivsas)aDtm(r ;t4ope  ociatfm rm(monu4texoio3oydlateli i t  2urxr3ny1altn icsasfsruaumoot0tptnif3tatfsDea( snu4 lxrif3iydfaD  ivs t0 ruoiopno1apenlfeias sDrru ono4tptn oeiytlmDrlump (4aeerio3io1lmt  n il(0trtm(o no4ap  mnetltfsrtaxront1aexomfciydlmDumnvo;u)tlxrxr oytlate nei;() rurxmpiy1lmtelfvt t)sDuru  ;o1opeomf3iasfaDem( p (4artnmf3tadfmD lu ilt0 euo(r nydopt  fesa(fs2rmx pno4alx  oetatfs2em(vp;t)arxomf3iydlpt aieols teto(r3ou4lle  iciasfsDum(mo;u1oleo octld mDelnvo;u)arxrxoctadoa  aiesls  2urimpno1lpe  ivtlt s2uaxroot1tlt iociltfs2em( on(0artnxf oa1opDr uei;s0s2trxm3oy4al  mnvtat s2um(r no4aet mictld m rm( pnt0trtnmfcia1oaDr u i t0trxo(m iu1lltn feiltf rrrxrpoo1oeeniiciysfm ul( s;u) eeoxo iatlmt  u ol(  exrxr nodomt  icilt  Drrx  oo0tpe mfetyt aDeau pn(4 etrxfcio1lmDe ues t trtr(o ny1lme lnci s arrrxrp;t4opx mieiydfsDemnvp;t0tetnif iatfp  lneil(0sexmxm3iu1aptn ivsasf 2uaum ot4alen o3iadfa2emnmpnt) exrmf3oy1fm  an o;s)texrir no4ol  lfeslsfaDtaur ;u4tetoifciad m2rln o (0 eenmf oatfm  aies;s)trxoim oo4om   nvta(fsDrrumonu0tle  ietytfa2rln s (4 exomo3totfa  li i s0 eur(m3oo4lp nmicslt)arrr(r no1olxomfeiad s eanmpnt0areoir tadlm eauei t trurxo nu4am elncilsfsDumu pot4tpeo oeiytfa rmumo u4 rtoif oy1lptr i i () 2urim3oodll emieil( aDua(rp;t1ape mf3tytfmDem( ont) exrifctotlmtraueo;()trxoir3io4omenmnctat  Drmu  ot4olto i3iatfs2raumonu0trxnmf ty1fpDeaivo;s0teum(opoo4lltemivt (faDum(mo;u0ope iociyt s uau p;u0trerxrcoatlaDranes;( srumxr iu1olte neta(fs2ra(rpnu1aex ifeiad m uan s u)aeerir3iadoateauvo;s0 2xmimpiodlme lfct sfaDrrx  oo0apxoio3iytlm emump;u4tlxnxfcoytfmD lu o t srxoio3no4am nmnesasfa2rmx o;u1teeniictasfsDra(mp u)tlxnxoctatoa rln ilt)srxm(rpiu1lmtn ncsl(f 2um(  nu0opxomfciysfm2uanvpn(0 etrxocootla   ivo ( texr(r3no1lmtnlivilsfsDrmumpno4apxo ictld aDum( snt4 lxoircty1om rlnvilt)truoim oodll  lnvtat) 2rm(ront0aeenifetydlm2ulnms t)alxrif3oy1opt ai s (  2urir3oy1llen fcs ()s2trxront0tlto oeiadla emn sn()alerxrcoytopt  nei;t)srurxr3iudop   ncs s sDtax  ;o0olxoiiciyd sDem(mon(4arermrcio1fp   iei ( s2trxopoy1aptn fcs t arum(mp;t1tptomoctaslm ra(mp;t)aetnmo tatlat  nvils truoim iy1lmtnlnci s srtmurpnt0optnmfeiyslmDulnms;t4trerxfciydfm elieols0 rtrxm3oy4al emfvtltf Drmur ;t1tex mfcils s2rauvo;(0texrir oydfm eanvsl(0 rurio3oo1oleemfei t sruax  ;t0oeeo feias m em(mon(4altoir to1faDrliei ( srxmimpno1om emfei s) Drauroou0tpe mf3iyd a2rlu p (0aleomrcoatfptr nvs;s) rtm(r3nydllt lfcs tfa2rm( ont1apeo i3iysfa2eanvs;u)aetrxr tatop   uvi;s t2to(o oo4lp  lncs ()sDrm(m ;t0opt mf3tadfaDuln o;(4tlxnmo3to1laDeauvs (  rtoio oy4amtemfet t a2tmxro;u1tleomociadfsDuauvpn()tlermfcia1laDelu s;s)s2xoim3iy4olenmivils aDuau o;o0teeo ictad s2rm(mo u4 eeoxf3oodlpteaneo;( t2xm(o oudomen iei (fs2uax  ;u4altoio3ildlaDrauvo t4 exrxfcoadfp e i o;t  rur(o nu1om emnct sfaDumu o;u4aeeomoeiadfm2ul( s;u0 rtoxociydopDe nvil( s2xr(m3iu1ole mfesl(fa2rau oou0teeniociyt m em( o t) rxoxr3iotfpDe iei t seum(rpoy4ameemivilt  Dtmu pnt1aet ioctlt aDeanvsnt0alxoir iydoaD livi;(0texr(r oydom e fvil(f rta(rpoo4tlt  octltfa uluvont0tetnmo3tatomteaues;s srxmio3ou4apenlfvsl( arrau pnt1opx mi3ildfm2em(vp (4 etoio3iydom rlnvsls0srxrir3oudlmee fvilt srtm( p;t4aetnmoeilt m ranms ()tetoxo iatoaDrauvo t) exoim no1lptemfetlsfa2rmxrp;u4oltomfciyt mDum(ms (0 rxoio iotfa e ivi;s)tetoxopiu1ol  mnvtat s2rrxmont0tpxnmfcildfmDemnms;u4aeermfcoadfate neol( trtoim3nudole lfvi ( sDurur nt0oetnmoeias a2rmn p t4aexoxo3tydom eau s t0srxmxmpiy4amen fci (f rtmu ont1aeenioctas a2ulnvo;(0teeoxr3ty1lmtr neo ()sexr(m3ny1oleemnct tf rumxrpnu0ape mf3iytlm ra( o ()trenxf oa1oaD  i ils t2xm(o3no1ole lieiatfaDtrxmp;u4apx  i3iasfsDeluvs;(0 lenmr oodfateluei;(  rxo(opoo4oltnlivs (f Dtr(m nt4aexoioeiydfa rlu s;t) lxnxrciy1fa e nvs;s t2uoimpiodolenmfetl() Dumuront1olt  i3iytfaDrm(vs t4 ltoioctytfpteluvo;t) 2tmio3nudlleemivias sDra(rooo0olxoioeiasfmDumuvs (4 ltnmocoadop rauvils  2xoxopny4am  lictlt) Drmxrp;t0ole mf3iadfsDul( s t)tleriociy1fmD anvo;s t2toir nu4ape mfvs s) 2rm(m nu4tleoiiciydfa eau snu0trxrxf3iotlmDe i i s0 exrxo3io1aptemfei (fs2tmxm ;u1aptnmieildfm2el(ms u0 lerio io1fateln o s0t2xm(mpno4lle lfei sfartmurpou1aetomi3tytla2rmnvsnt0tlxomocootfmte u ilt  ruo(rpnudoptnmnvia(f Dtaxmpnt1oex  f3ildla eauvsn(4tlxnxrcoodlp eaies (0sexoim nu4opte fvt ()srrmx onu1tle  i3ildfm2um(vo;u0texnir oo1opDrlu s;t)texo(r3oodamenlnct t artmuro;u0olen o3ilsls eauvsnt4tltoxf ootopDraues;t t2xoiopno1ll nlicsas srta( pou1tlx  o3iasfa ra(ms u0alxnxrcoytla   nvilt s2toxr ny4om elncia(fsrtaur ;t0aexoif3tytla em( p;u4 rtrmfcoytfm   iei;t)trxrxopoodllt lietlsfsrtaxmpnu4oex mfcilt a2ulnms (4aetomr iatlmDeln i (0s2um(opno1ll  mfes sfsDtr( o;t4tltnmfeils s uau pnu)aeeoio3tytfaD  uesls)texr(o ou1llen ivs () rua(rp;u1aptnmfciyt sDrl(vs;u4artoircoatlp  aivol( tetrxo oy4ll nmneils aDtaurpot0teen feiadlsDrmu o;(0artnircootop eanvol(0s2xmxo nudolenmnctasfsrumum ;u1oltomfcildla2rmnvs;u4tlermo3todop  aiesl( teuoio3io4al  mivsa()sDra(m ot1opx  f3ilslm2rmu p;(0altrxrcoatfpDr iei;(  eumxo3nu4lme  iesat) 2rm(mpnt1alxomietls a2em( s;u0artrxocio1omteli ols0 eto(o oudlp elnvslt)s2rmx  ;o1apxnii3iasfm2rluvpnu0tlerxrcoatopDe ivslt) eumxo oodomt  neiat aDtmu ooo0olx ioeilt a ul(vp t4treoiocoy1fptelnvo;(0trumxr oydol e ietl( artaxrpot1oeen feiydla rlnvsnt0tltrmo3tydoatran o;t0trurxr3nodlp   ieias) 2rm(rpnt4opeomf3tydlaDumnvonu4teeoifciodlaDranes;( teuoxo iy1op nmnctl( s2tm(root0alxo oetldls2rm( snt)teenxo io1fa r nvo s  eur(o iy1alte fcils a2ra(mpno4alenii3tydfa2ranvp (4tltomr3iodfptrai il(0sexrir3nudlltnmfesas  2tr(  oo0aptomieiytfsDum(mp;u0tlerxf ia1laDeanes;s  rumxmpny4opt lfvslt  Dumxrpno1tex io3tyt a2uln pnt0tetomocta1optelnvs;s0srxmio nudalt mfeiat)srurumpou0teeomfeiys s2ranmont)tlxrmf3oydfpDrli o;s0 rxmimpio1lp  livi sfsDrr(mooo4oeeoioctadla rmn pn()aetnmr3iodlptelnei;(0t2urir io1ole mncta(f 2tm( ono4apx ii3tad mDrmuvp u0 lxrmrciotoateai i s0setr(o iy1am  miesas)aDtmu  ot4opto feilt m rm( p u4texnxf iydlmtr iei;t  2xmirpio1lp nmivslt)aDrmuronu0opx  iciydlmDrl(vo;(0alxoxrcio1oatrlnvs;t)t2xoxrpiodlpe  ivsat aDrrumo;u0oex  icilslaDulumpn(0 exrxr iodfaDelnvs;t  2xrim no4omtelnvia(f rrmxrpnu0opeomociydfsDem(monu)aleoio3oodom rauvsl(0s2urxr oo1amee fetas)srrr(mp;u0aexomoctatfs ulnvs;t4tetoiociy1oaDeaies;t) rxoxopio4ole lfvta(fs2umx p;u1aetomo3iysfa ranvp (4arerif3io1oaDrau i;()sruo(mpoodap nliet s) Drr(mpou0opeomfeildfsDeanmo (0 eeoxo3oa1omDr ivo;s)t2tr(mpiudlmenmfei sfarta(mono4tlx  oeiad a2rluvon() rxrxo3totlm  lnvo t) 2uoir nu1ap nlnesas aDua(r ;o1aptniociadla2elnvo;t4arermf3ia1lateanes s)trtmxo no1opeemfesl(fa2rmxmont4aexnmociysls um( p () rxnmo3oo1fa  ai olt0s2trim3oy4ap nlncsls s2rrx oou4tleomf3iadfs rmnmp t4arenif3oo1fpDr nes;t) exrio ou4lp n fvils) 2tm(m ;t0aexoifetysfmDraumo (0 lxoio tytop rlneo;() 2umir oydop  lfci () Dtau ont4apx ioetyt aDum( s;(0 etrxr iydfaD li ols)seumir3oo1omenlivs ( arrru oot4openmf3tad s2elumsnt0 rtoxr3io1lpD ln o t0sexrxr3ou1al e iciat)artaxmpnu0texoiictas a2uan on()trenxf3oydfpt  uvil(0 2xmxr nodapeelfvtl( aruru  ;o1tptomfctls s2uln pnt0 ltoxrcoatlm eaieo;s  2xrxo3io1amt lncta()s2tm(rpoo1tpxniiciytfsDulnvo t) ltnxfctatfa e neo;s)texoim3nudope  ietlsfsrumx pnt0oexnifetldlm2em(vpn(0aleoircoydlp r ieo ( setrxm3io4op elfesas) Dtrx poo1oetnifeiltfs2elnmont0texrxo3oy1lm rlueo;t setoim3iudom   fvsasfs2tr( pot4tltnmiciyt s2elu p;(4 lxrioctytfm r neols)teumxo iodal nmivta( sDrau p;u4apen ieiltfm ea(mp;u4alxnxfcoytlate n i;s0srtmxrpoydopte icilt  Duax  ;u1tpt moetlt sDuanmo t0aetnxo3iatomte n i t trurimpnydlmeemfcsa(  rrmx  nu4oltomfeiltfsDua(msnu0tlxnxo3ia1lat ln i;t srto(rpoodlp emfesas)arua(rono1tltnif3iat a el(msn(4arxoxo to1fpt lneo;t0 rxr(opno4ope mncs s a2uaumono0texnio3tysfsDel(vo t)treoir oadfaDr ivs () rtoxm ou4alt  ictas  Draxront1tpxo oeiys mDemuvp;(4tlerxr3totfpD lnvs s)srurxm3iydamenlfvi ( aDta(  nu0oet miciaslm rluvs;u0 rermo oatom   n i s  exo(r3io4omtn fvt ( s2umxmonu4opx  oeiat mDrm(ms u) exrxrctytfaDeln s s0 rtoio3ou1ape livi s s2uaurpno1tetomfeiyd s rmnvp;(4arxoir io1om r i o;()t2toimpno1lpte net t aDra(monu4aetoifeiad aDulnvs u4 eerxr3to1opteau sls tetoim oodlpenmncsl() 2ra(ro;o1aex ioctatlm2uanvo;()aetnxr3oy1lmteai o s)s2umxr iydal nlies s s2rmu  ;u1opeo o3tyslsDrauvp ()tetrircoo1fp e nvils t2uo(o ou1al  mnet tfsDrr(mpnt4oetomf3tldfm umn s t)trenirciy1op elu ilt0trtrirpoy1lle  fcia( s2ra(mp;t1aexomieiyd sDuanmo;u) rxrio iadoa elivo;t)trumxo iy4llee icils sDtr(  ot0olto i3iydlsDum( p t) lerif tydlmtr u il( seum(o ny4alenlnet s) 2uaur ;u0alt mf3tyslmDuaumont4 rerxr3ty1lm e neo ( tetoxm3oy4olen net t  2ta(rpno0tlenioctat m2rm( o (0 etomo3oydlate nei;t0setoim ou1op   iei ()srtr(rooo1apxoioeiatlaDemnms t)tltrmoctydfa eauvi (0texrxm ou4lp e neslsf Drr(ro;t0alxnmf3iydla2eluvs u4trxrmoctodlaDraieslt t2urir oy4alen feilsf 2urxr oo1tptomieiydls rmu p;t0aexoifcootomD livs t)s2xm(o3nu1lptnlnvtas srrm(rpou1olxomo3iys m2rm(ms;t4trenif3ty1fptrlieo t  exo(r3iu4omenmnesat) 2rrum ou4tetnmo3iltfs ea(vo;t4teerxo3iadfp   nes t0srurir3iy1alenmncil(f rtmumoot0tpenmfeiltla eau o;u0trenmrcoo1fptranei s)t2trirpnu4ol emnvsls)aDrru pnt1tlxn o3iysfm eluvs;u4teeomfciydlmtean s;t  rxo(o io1lmtnmneilt) Drrur oo4aleniietydla2emnvp;t4 lenifciydopt  nei () rxmxr ou4ome mnct t a2ta(r ot1oleomociaslaDeluvpnu4texoxr ia1latranes s0s2xrir3iy1lmee fesa(fsDtrx ooo0oexnmocild m rln s;u0 eermrcoydopD  i o;( tetrxm nu1lpte ncia(faDurumo;o0apeoiietlslsDuanvs t0alxoiocoodop e ues;( trumirpoo1aptnmicsatfa2taumont0aex  ietyt m eau sn(4altrmo oadlatrliei (  2umxo oudame mivia(f rraxr oo1apeo f3iyd m2rmuvs;t4tltrxf tatfa rluei s)tetoir oydlmt lnctls)aDtmump;t4teenmo3ildfsDum( s t0 lxrxr3ia1fpDran ols0teurxr iodaptn ics t)arta(roou0oeeoiieias s uanvont4 leomf3totom rlivsl()t2umir nodaptn ivia(farurxmoot4aeenioeias s ea(mo u0 eerio3oy1fm   neslt0 exmio3io1op   nvsas srum(m ot1apto i3iydlmDeln o ()tlxnxf iy1faDrauvo;s)srxmxmpiu4ope liet t aDtrur ot0tlen oeild a ea(ms u0altrmf to1lmD luvo;s  rto(m3iu1ale lfvt t a2taumpot0tle ioctlt m em(vp;(0 rerxo3iadop eliei (0 2to(mpny1ale  ieiasfs2ururo;u4apeo ietls a2ea( p u0teeoir tatlpte nvs;()s2uoimpoodlmenlfvsas) Dumx  nt1tleomfeildls rlumo u4areoif iatlm   ivs t srum(r3iodlptnmnvi s)sDrr(rpnu0tetomf3tatfmDel( onu)arermrctadla r n ils0trto(r3ny1am  mietatf rtmum oo1opto ieiaslm2eanvs u)arermf3ia1lmDrliesls sexmxm oudal elfvtlt  rum(mpno0apt ii3tldlaDeanmsnt)trxrio3iodla eln sl()tetoxo3oo4optnmfesls srtau  nt4aex  fcias a umu pnt0 rxnmociadlpt auvi s  2uoxopio1lltelfvsasf Duru pot0olxomoctat mDul( p;u4 lxomr3totlp eli i;()srxmim3oo1lme  iei s)s2taxm ou4alxn fetldfs ra( s;(4trxoifciotfat ai sls0sruoxr iy4lm  livi t  rtru  no0ape mociydlmDraumo;t) ltoxo3tydopDeauvs;t0setoio oy1lmen fvs ()aDtmx ono0alxn i3ilsfaDuanmp;(0 leomr3ootfa raivo s setoxm oy4am emiesa()artr(rooo4tlenmieiyslmDrmuvont)tlxrif oatoaDean sl()srxrxopno1opte fct t) rum(  ou4alto i3ildfmDrl( ont0 leoir3oytlmt  nvo;s  2to(o oo4op emfesas)s2rr( pot0olt mfctlsfmDea(ms;u4altomf3ootfmD lneo ()t2uoimpiodalt  ict (fa2ururo;t1aeeo iciatfa2ua(ms;(0aetoif oa1fmDelnesls  rumxopiu4olte neilt)s2uaxm nu0opxomf3iydla emnmont4trxrxfcia1faD  i i;( trxo(rpoodlpenmfeia(farrr( pnu4alt  i3iydfm rl(mo;(4alenxfcto1faD li i ( trtrirpiydlpee nctasfs2umx o;t0aexn fcilsfm2emnvo u0aeeoircoydlmDranvi t t2toir nodlmtn fviat  Draxro;t0aleo fetatls umuvpn() ltnxociodlpteaieols t2xrxmpno4al   fvi ( arrmx o;u0opeomieiadfa2eln snt4 eeoxo oy1lp   n i t0s2ur(r iodomtemnvsltfa2rmump;t0opxn i3ilt a el(msnu4trenxocia1la ran sls0seuo(m3oo4altnlivtl( sDua( oot1tpxn f3iyd sDrln onu) rtnxrciatomt  u i (0t2triopiu4olenmnvs ()aruru pot4tpeomoeiatls ra( p;u4artrxocta1lmDeau o t)seumim3nydap nmiviatf rrrurp;t0oexnmictyd aDrau pn()tltnmr io1la  au i s)t2xrim3iy1apenlfciat) Dra(m ;o4apxn oeiasfa2rmnvo;t0aetomf3iy1op   n i () euoxo3iy4ll  mfcsl()a2tax  ;u1tpxnmieiatlsDuan pnt0altrxf3iodop  auvs s t2xriopnu4lpenmneil(f rurxr ;o1tetnmieiytlaDemuvs;u4trtoxo iotfa r n slt) 2xrir nu4lpe mnvslsfaDtmurpot0tetomo3iydlsDrmnmont0tltrxf3iodlp e u sl( seurio3no4amtnmivsa( sDrmxm oo4oleoifcias s ulnmo t4 rxnmr ta1faDeaivil(0t2trxmpny1amtnmfcta()a2urxm nu1ape mo3iltls ra(vs;t)tlxnxfctodfm elivilt0trtr(m oo4optn fvt sfarurxrono4tpx mf3iatfa2rmnmpnt0tetnxf oo1lmt  nes;t) 2trxrpoodapeemics ()arrrumpot1olt  fetlsls ea( snu)alxoxf ootfptelivo;() rtoir nu1om  licsas) 2umump;t0tee  ieild s2um(mo t)tlenxo oatop  livsls) ruoim3oodolt livtl()srur(m ;o0apxnmfciaslsDem(vpnu4trenxo3iotomD aieslt0 ruoxr io4lmtelncsasfa2uax o;o1tlxnmo3ildls emumo u4trxnircta1fptelivi s)s2xrxm3no1openlnetatfsDumurpou4altniiciyd a2elums u)areoif oydfa ranei;t) 2uoxmpiydomt  fvsls s2rr(  nt4oet  i3ils a rmumo;u) lxrxf oydlmD anei s0 2toxr3no1al nmiciat) rumu  nt4ale mfeiydfs2rln onu)arxrxrciytfmtr nvs;s tetrxr3io1omte fvi (fsrurxmonu1oltoioeiyt m ulu s;u4 reoif3oy1lp  liei;() 2uoxr3io1alt mivsl(  rrr(m ;o4tptoiietysfm rauvp;(0 lxoiocta1om   n s t  2xoim ny1opeemfet tfsDtmxm ;o0opxniieiatfsDum(mo;t4tlxomr3ta1fmt li o t  eto(m3oo4lmte ics tfaDtmx o;t4oeen octadla2eln p (0 lenxfciadfmDeanvils  euo(o3nu1lm  mfvtat  ruru pnt4teto i3iydlaDea( pnu4tetnmr ta1lp r ues s)srxmxo3iy1omte fci tfsDtrxrp;o0ope mo3iltla2emu snt0alxnmrcootfmtelies ()t2xrxm oodolt livsltfsDrau ont4olt  ietytfs2em(mpn(0artrir3iy1oatrai s;( trxoxr3oy1ope  ivi s  2raumo;t1apt mi3ildfmDumnmp;t4 reomf3iytomte ivilt)t2uo(rpno1lpenliesatf 2rmx o;o0tleniictasfm2eluvp u4 rerxr3iatomtranvi ( setm(m3iy1lp emietat)a2umxrp;o4alxomf3iad aDulnmonu4altnmr3oy1fpte ues s teuo(r ou1lm nlivi sfartrurpot4apxnioetys m2ulnvo;(0arenmf iatla  aueo;t)tetoxopiydlmeemnei ( artrxr ;t4tet  iciys aDrmnmo;u4aleoir oatfp rli s s0sexr(rpiy1llte icsa(fartm(mo;t1aetniicilt m uln p t0aeermrciotopt anvo t0teumio nudop elivil() rtr(  ot1apeo feiysls ra(vs;u0trxomfcoydfateauvo (0 2toim3ou4lltn fei ()s2taxm no4aet mieiltfs2raump t0texoircootom eli ol() rtrxo3oudllte ictl( sDumxr no0oltoiictls s el( p;u0arxnmr3ia1omDrau ol( trxr(m3iydap  mnes s)sDrrxmpno4alx  o3iyt mDumnvs;u0texnmrcoa1lmtr n s s)s2xo(o no1alt  fetlt)arra(r ;t1aee  i3iasfm2eln pnt)teerir tydlmDeli i ()tetoxr oo1ol n netl(f 2rmur ;t1tlt moetysfs2rluvo t)tleoxf iydlate nvs (0srtr(r3oudlm   neil( arur(  no0apxnifeiys m ea(mp;u4tltoir3iotlm  lieo ()t2xo(m oy4omtnmfvtlsfarurx ono1apxomfciyslaDeauvo;() rtomr todla eauesls)tetriopno4ope lnei tfa2tmx ono1apto ieiadla2um(vo;u)tltrmr oadla  luvs t)t2trxo oo1lpenlicsls) 2umurooo4optn i3tas a ulumo t4 lxomocoadopDe ivo (  rtoim3nudopeelnvsl()srtmxm ou1teeo octldfm uluvo t4alxnmr3iadlate i s;() 2xm(m3nu1ole lncia() 2tmum ot0opt mf3tldlmDumnmo;t0teeoxr3iadopt li ils)teumiopiy1lm emfcilt) ruax p;t1olx ifeiyt m rl( pnu4tlxoxr iy1fmDr neo s0s2toir3oudop emfvsat sDuaumonu4opeomoctad s2elumont4tlermo3ia1fpDeluvo;s tetrxm iydlmeelfvt ( a2rm(r nt4tptoifciad a uan o;()alenxfciytfmte uvols0 rxoio oo4am  mnetl( artaumoou0aex  ietadfs2ea(vo t4artomfcty1opte i s;t0trxrxm iodameemivt t sDtrumoou4aeeo f3iydlm2umuvo t)arxrxrcoodoaDrlues () ruoim3iudalenlieilt) 2urxrpot1olx io3iadlm2el( snu0 rerif3tatfp  luei;t)texmiopnodll   nes tf rurur ou4aee  fcilsfs2rm( p;t0tltnmo3iy1oat lies t) 2um(m3oudopee neiatfa2raxmp;t1oeeniocilslm rl( p;u4trtomfctytoptrli o;t0 ruoim3oudlm   netas aDurxrp;t1texoii3tlsfm2umnmsnt0 rxnif to1opt au o t0 2xm(o nudllt  nvtls sDumu o;u0opeo ociltfa ranvonu4 rtrmfciodlm raueo;t truoxo3nu4alt licsat)aDrax oot4alxnioeiyslmDrmnms u)arxrmf tatlpt aueolt0trxoxr3nu1altnmncsa(f Dumumonu1tpto fciysls2rm(mp;u) reomf3ta1lpteauvo;t0seum(r3oo1al elivsatfs2ta( oot1tpxnmfctadls em( s u) exoxr oydlpDrluvo;(0t2urir iodlme  ics ()s2ururo;u0aeeniieiatlm2eau snu4tltoif3iytopt  ues t)truo(rpiodlptn neil(fartaumont1teenmfctyd m2ea( onu0 rtoxrcoy1oa r iei t  2um(r iy1lleemfetls)sDtaurpno0oeen fciatfs2ra(ms t) lxrmr3tatlm  lues s0 etmirpno4amt mfvta() Dtrur nu0oeenii3tyt m rlnmsn()alxnmf oo1oaD  u s s0t2trxo oydlle liesl()aDrau  oo4aeeomo3iydfa umn o t)aexnmf to1lmtraieo;t0srxrir3oo1llenmnetl(fsDrax  no1tet  ociatfa eanms;u4 lenmo iytfpDe n olt)tetmir oy4am nmictas)a2ururo;t0oeeomietysfaDemnmsn(4 etrxf ty1lp rluvs s0t2tm(mpnodame  nvi t a2urxront1aetoifctasfs eanvo;u4texrif3tydlaD au i;s t2tm(m oo4apt mncilt) Dua(mpnu4aeen iciltls rl(ms;(0 rxrif3ty1fpDrlnvols0tetmim3iudaltelnet tfaDtr( pou4opeomo3iltlmDrlnvp t4 exoxocto1opDelnvo;s0seto(r nodapee ivil(  2raxmont4oltomfciat m2el( p;t)trermo3iotfm ran ol( t2xmxmpnu1lptnlnei (  2rmx pot0oltnmfeiatfmDumuvp;t)artnio3tatfpDraivo ()texrio3no1apee icsltfa2tr(monu0apeomoeiadfm2emums u0 lxrircoy1opDeluei t0s2xoio iy4lp   fciat a2ur(mpou4olxoioeilslaDuauvo (0 exoio ta1la elnvsls t2xrxmpoy4lle mnciat) rua(m ot1aetomoeiasfm2rmuvs;()tltomfcio1fp   ivolt teurirpoo1olenmnctasfsrrrur ou0open o3iyt mDrm(ms t0 rerxo3io1om  au il( srxrio iudaptn nci () rum(m oo4opx moctyt m rauvpnu) exomr oa1lm r nvo ()s2uoxo ou1altelfesl() rum( pot0alto o3iatfs2ean s;t)aeenxr3tydfpt livo;t trurxrpno1lmeelncsls)srumxr ;o4oltn oeiytfa uaums u0tlxnxrcoodlpt  u o s t2tmxmpoydol nmnesa(f Drmxr no4altomoetas a rm( p;u) etnmf3oa1oaD li s;( sexr(o iu1oleemiesl() Dur( ooo4open ietadla2el( s (4aexoif tatoat aieo;s0 2toiopnodol   ncslt)sDtau  oo1tpto ietas m rmu o (4 reoxfcia1fm rau ols)s2xmxo io4aptnmivs sf rtax  ;u0aet miciasfmDemnvo t)arxrir3oadopDelieo t0 rxrxm3iudlpte ivi t  Dumxrp;t4olen ocildfs rm(vsnu) lerxocoa1lmD auvo;( s2uoxm3ny1alt lfvia(faDtmx pnt4altn feiytls rln s;() rtnxo iadfaDelneo s srtrir iu1lp   nvsas  2tax  ;o1oex  i3tysfa rmu o (0 lenxf3ty1lpD lues ( trur(o io4al emfvtat) 2uru o;u4alxnmf3tadlsDemn ont4 etomfciadfmDrlueols)s2to(rpoodlpe lieils  rta(mpnt1tlen o3iyd s2uanvo u4altrxf oytoatelnes;s s2umxrpiu4ap eliei (fa2rmxmo;o4tpenmi3iytls rl(mp t0tltrxf tydop rai s;s0 2trxo3oudllt  nctatf 2rrumpnt4tleoioctltls2emump;t4 etoxfciodfp eai s s)seuoirpiu4lpt mietat)arrmxro;o1altnmoeiytfsDranvpnt) exnxf iadlptelu s;s  ruoxmpoo1lptnlfviasf rraurpoo4teenio3iadfm2ulnmonu4altrxocia1fptr ivi s seuo(o3oudll elfei (f 2urxrpnt4oetnmfetydlm eluvo u0tetoxr3iy1faDeluvs;(0 rxm(m oo4ome lneils arrrumo;o1aptn octltfsDua(vp t4aexnmo ootop rli o s)t2xriopiydaptnlfctl(fsrtr(  ou0tpt ii3iys sDrm( s;u0 rtnmfctydoat  nvs (0sexm(rpny4oleemnci (f Dumxrpot0aeenmo3iasla eauvo (0treomo3tatlm  liei s)trto(r3oy1am n fcsls  2rr( p;t1alx  i3tas m rlu p;(0aeenif3ia1fate nvilt  eto(rpno1am elnctl()arra(  ou1tpx mfcilsfa2umnvonu0 lenmrcoytop  aneols s2trxr oudam e ieta(  Draxmp;o0tpeoiieiys m2elnvo (0 eerxo oytlpDeaieol(0srxm(r3nudlm e fct ()artm(mo;t0tee  i3iytlm2raump;u0 reomr oadla  ln o s sexr(mpnydlpe mfvt sfsruau ono0oltoioeils mDua( sn(0tlxrmociotlpDeluvols) euoxopny4lpt lictlt  Drr(ro;o1tleomoctatla2ua( s t0 etrmf3oytomte nes;s trtrxr oudaltnmfes t a2tmx  no0ale mfeiltfs elnvp u)aexrir oatlmD liei ()s2uo(opiydapenmiet ( s2rrum ;t4olx moeiltlm2em(vsnu0 etoxr io1lpDeln s t srxmio no1optnmieta( sDtm(m oo4apt  ietydfmDea( o (4teenmr iatomDeaivo;()setrxo3no4alenmncs t)sDurumont4aeto f3tldlm uaump u)trxrif3oodfatrluesls) eurxr iu1amtn fcias srumu  ou4tpt  oeiydfmDrau s;(0arxnxrciy1fp r u ils  rtoiopoydamt mnesl()aDrrxro;t0olx mfcilt m ranmo u0 exnir3io1opD lnvo t0tetmimpno4alt lfcia(f rtrx pno4oltn f3iadlmDuauvpnu0tltrir oodfm   uvs;()teurio3iy1amt mietls a2trx p;t0texn iciatfs2emuvsnt0 etnif tadfmtelnes ( trum(rpoydlm  micsls)srtmxrono1olxo iciasfs eln pn(4tleomocia1fa elnesls0seumxopnu1ameemiei s)srrr(mo;o1tpxn fctasfaDrl(vs;t)tltnir3oa1fpD  ivs s)seto(r iu1amte fes t srtaumpoo1tex mo3iytfs ean s;t0texnifciy1lmteln s s srtmxo3no1om elnet ()a2tmxmonu1tltnmiciltfs ul(vo;t0texnxf io1opteauvs t)tetrxr3oodom n fvt ( arrmu onu1tpx moeilsla2emnvo;t4tlerxf3oadomt aivsl(  2trxrpnu4lmen icsls  Dtm(rpno4tltoiiciatfs2rmnms u0tlxomf iotom eli o (0 ruoxr iy1apt lieiasfsDraxmpoo1oleoif3ilsfa2rmu p;()trtoxr3oo1fpteauvilt s2toir ou1om emietlt  2rm( pot0aet mo3ias aDuau s;(4arxrmf todlm e uvs;( s2urio3nudopt mnvta(  rtr( oot0ape ifetysfa2rmuvsnu)arxoxr iytlm r u s s)seumio3nu4ape lncsl(fa2urur nu4tlen fciadfa2ulu pnt)tetnmf3tydlatrai o t)trxm(mpoy1alen fvta(  Dtmumo;u1oltn octatlaDrlnvo;t0alxrmfcoo1oat aivs t)seum(m3nu4lltnlnet t) Dtr( o;o1tpeo f3ilsla2rl(mp u) ltrxr3ta1omtelnes s  2toxmpiu1ap elnet t)artaump;t4alxniieiasfmDul( o;(0tlxoirctotla  lues s0texm(r3oodom e ivs sfa2taxro;u0alxn i3ias sDumump;t4tlxrxrctotlptrluvs (0seumxopnu4oltn nct sfaDum( oou1tlt  fctytfsDrmums;t)alenmo3todopte n sls  rurxrpny4amte fctlsfsDtmxm ot0teen iciyd mDum( pnt) rtrxr io1fp e nvilt)s2xr(r nudaltnmivias) rur(m ;o4apxnmietyslmDra( sn(4artoir iytfmD  ueo t) ruoim3nu4ome  ici (fa2rrxr ou0apxo feiat s2eanms;u)tlerio iotlatelueo (0srumxm3io4ap nmnvsas  Drmumpno1tptomociytlmDumuvo t4 renmfciytoa  lueilt0s2xmirpnodlmte icsa()srumxmono1apxoioeiat m2rmu snt0aetnmfcoadfmD lnvil() rto(r no4om nlfesl( arur(m ;u1tpxomocils a emnmp;t)tltoxfciadlmD an sl( srxriopou1lpte ieslt)aDrrx o;t1olt ifeils mDrl( s;(0 ltoir oodom  ai s;t s2trio iy4olen fvtlt  rurxmoou1oeto i3tad a2el( o u)tlxnxr3oa1optr nvilt0s2xm(o nu1ap nmfes tfs2tmxm oo1apenmieiatfs rlump (0aeerio io1fatelieo () 2xoirpiudome lfvslt)s2rmxrpou1aexo i3iytfm ulnmo t)trenxocty1oat auvolt  exoxo3iydolen nvi s)a2ta(rooo4olen ocilsfs eluvonu4tleomrciydoatelnvi;(0t2umim3nudlm emnesa( sruaxr nt1opxomoeiadfaDrlnvp;u4arxnifciatlmt  ues;t) 2uoxm3iy1opte nvsasfs2ur(rpno4tptnmi3ild s uaumo;(0texnmo3oy1lmD aieslt) rur(r iu1ame lnei ()sDtax ono1tltoifeias s2ranmp;t0aetrxo3iodfpt li i (0t2tmxo iudlme  nci sfa2ur( p;t0oetnmfciys sDra(ms;u) reomr3tydom   uvils0 2tr(o3nu1aleelfcslt) rtr(mo;t1olto i3iad mDeauvs;t4 ltoxo tydfatrli ilt) euoxr3nu1omtnmfvt sf Dta(m oo0tetoiieiltlsDel(mpnt0trtnxr3iydfm raueolt0 rurirpiy4amtemnesl(f ruax  no4optnmf3tadla raump u4altnirctytfaDr nvs;( t2urxm nudopen ncsatfsDtr(m nt1aetn fctadla2eanms;t4tetrircty1laDraivil() exmxm nu4lptnlnes () rurx ono0teenioctld m rluvo;u0trxnxrcty1fm r ues;s0seuoio nu4om nmivt sfs2umu p;t0olto ietltfs uau o;t4 eenif ia1oat anvi;t0 2umim3ny1aleemncta( a2urum no4oeeoiicilt m2rm( s (0 exoircoydfmt aueo;( seurxo3iudol eliei t)aDrau onu4tee  i3iadla2ean sn(0altnxf iodfmt lnei;(0trtm(m3nodaptnmfeia()aDtr(  nt1ape ii3ild a2umumsnt) etrmo iodfpDrln o t0trtr(o3oudale  netasfsrrm(r oo1tlxoiociaslm elnmont0tleoxf3iotoa  anvi;t)teumio3iodol  lneiatf 2rmxm ;t4oeenif3tatfsDum( snu0tlxrio3ta1omtr ieo;(0 exoirpno4ap elnvslsf 2rr(  oo1optn o3iyd m ua(msnu)trermr iydlat lneol(  ruoxm3nu1lptelnvtl(fs2trxmont4ole mo3iltfsDrmn o t0 eermrcoadom eluvo s0sexmxmpoy1ope livtlt  2uaum ;u0tee  o3iltla rmu on(4arxnxo ta1lat  neols  2um(m3ny1lle lfei (  rtru  ou1apx iieiydfa rau o u4trxnmf3oy1fptrlneo;s0sexoxm3iu1omtnmncs ()srtax  no1aexo oetatlsDum( pnu)aetrxr oatlpDe nvs;t trumxm3oodlp nmfctls)a2raxmonu0oltnmieils m2eln sn()arxrir3ta1fmt lueo;( trxoxm3nu1alenlies sfsrurum oo0tltnif3iat a2rmn p t4 exrir3oodlptraivs;( s2uoir3iodole mfes s)sDur(ront4teeoio3tadfaDem(vpn()tetrmr3to1op e nvs s sruoxr oy1lp e nvia(fs2umu  nt0apeo feildlm ranvp;(4altomo to1oaDe ivi ()t2xmxr3ou4ale mnvilsfs2taumont0tlenmietltfs2umu pnu0 ltrir3to1lpD lnei s0srtmxmpoodlle  ict t) rtrum ;o1tlxoif3iys a rauvo;(0 rtomr io1omDeanvs s0setm(r io1am elfvs s) rtmxrpot4open o3iaslm ra(mo;u0 rerxo ia1lm   nvilt) 2urxrpno4lm nmivt s srrrum ou1oetnmoetas aDran s;u0artoif tatfaD  i o;(0 2xr(m3ou1aptnmnvt sfa2ta(mono0ale  f3iydfm2ul( p t0artrmrctotfpDe uvi;t0s2um(o ny1lpt mfvtlsf rta(mo;t1apenioeias a2rluvs ()arxnmfctotlp eaivi;() 2uoxr3oydapeemivsas s2tr(mooo1oee  o3tasls2ra( s u0 rtnxf3io1opt  neils  exoxo oo4aleemnviltf ruax  ;t1olenmieiasls2rm(mo u4 rxnxf3io1lpt au o;(  2xmirpiudlp  mnvtlt srtmum ou1tptoio3tyd a el(vo u4arxrxf iytlmDraneol(0 2tr(rpnu1amtelfetl(farurxm nt0tetomieiys mDrm(vo t0 rtoxrciodom raneol() 2urxr nydapen fvsa(  rtrxmono1tlenmoeilsfa eluvp;(4aeeomrcoy1la e ieo (0teurxo nydop nmfci (fsrtaxr ou0openii3ild m emu onu4aexoif iydfaDr i i t0 2xr(rpnu1al emfesas aruaur ;t4teto oeiatfm umnmpnt)artnif3ia1fmDraivol()seumxr iydom e fcsas a2ururo;t1tltnmf3tyd sDumumo (4alxoif3oatlate u o;(  exo(r3iodame mneiatf Dta(mpno0tlt iociad a el( pn() ltnmoctodfaDeanvi s s2trio3iu1lm  mfesl( a2tm( oot0alen oeiatfm eanms;t) lxoircoadfmDrlnvils)s2um(mpou1lltemnvi s  2ua(m oo0opeomiciyd a2rln o;t0 eerxfcoa1oa eau sls trxr(o3iu4am n ncs s sDtru pou1oetoioetyd s2ua(ms;u0arxnir iydoaDrai ils)s2tm(rpny4lmenlictl(fsruax  nt4tetnmi3ildfa rau snu4tlxnirctytlatr uvi s s2ur(r nodome mivsasfs2um(rpou0optnmfctydls2ulump;u0alenmf3io1fa eaueo;t srxmio3io4opeemieiatf rraxmp;o1tlen o3tlt mDemumonu) ltrmr io1fp elnvi s)tetoxrpnodlp  mfesatfa2ta(mo;u4olx  oeiytfa rlnvsn(0alxnif oodlmDelueols)srurir3nu1al nlncs tfs2raum ;u4oeeomoeils a rm( p t) lenio3io1omt lu olt) exo(r3io4am nlfciat)sDum(mo;o4oetomieiat aDum(vs;(4 rermo3to1fa e uvi (0 etmimpoy1lpt mivta(f Dtr(mpno0oleomi3tat s uln p;() lxrmo oa1lmDeanesls) exrim3oy1omt mnviatfaruau pnt0oeeniietytfs2em( s;t)trxrxf iadlaDraivo ( srtr(o oydlm n nvil()artax ooo0tex  octytlsDrluvs u4 lxrxfcoo1fpDrluei;()trtoxo3ou4am elneta( aDumumooo4apx  i3iadla uluvs;t) lerir oa1lm r n i;s  etrxo nudom elfcsl()srrm( oot4teeoio3tldlaDraumo u)trtoif3oy1latelu ils s2ur(opno4am  mict t)aDtmxrpoo0apen o3iytfa2ranvpnt4alxrmo ty1lpte iei;()srtoxrpny1omenlncsa() 2rr(r no4aee iiciytls2rlums t0altrmf3tydoa eln slt s2ur(o3ou1lm e iesas  Drrx  ;o4alx mfctldls rmnvp;(0tlxnir todlat  n i s)t2xmirpnu1ap  mietasf 2um(r oo1openifcild m rlump;u) lxrmfciadlm rlnvo;t0s2urxopoo1ol   ncsa( sDtru  ou4tpx  f3tldlm2eauvs t0arxrircoatlmtr uvo;t0seurxmpoy1lm  lnciltf 2tmurp;t0tetniociltlmDel(vp t)trtrxocoatfp r uvs ()trxrxm nudameemict tfarrm(  ;t0apx mf3ilsfmDua(vont0alxoio3oo1lmDrlnvolt) euoxopoo1llt mfei s s2rmx pot4aeeniociasls2ra(vs t)tlxrxo3tydoa   uvil()sexmxm iydllt lnei s)a2ra(m no0aexomieiatlm2uauvsnu)tlxrifcta1fp rluvo t  exm(r3iu4lle lict (f rtaxr nt0apenioctlsfa uau onu4artnif io1oaDelu o s setrxo3no4al  micsltfa2rr(mp;o0texn o3tys m2emnvo (4aeeomr3to1lmDeaneo t  2trxopoy1lp   feslsf 2umxr nu0opto oetadfm emu s;(0aexrmo3oa1oa   ivo ( t2trxr nydopte ictat)sDrmuro;o0alt mieiat aDemnmo (0tetomr oatfmt  u ol(  rxoxo oydlpe  fcsa()a2uaxronu4texomfciatla2emu ont0aexomf iodoaDeluvs t texoxr oy4omtnlfvsatfsrtax ont1teenii3iydls2rlnmon()tltoif3iodla rliei;( texm(r3nodam elfvi ()a2uaum ot1tpenmoctydlm uln sn(4tlxomo tatlmteaivs ( tetoxm ou4ape  fetl() 2umurono0aeen ictytfa2rmu p (4 leoxf oadlatr ies;(  exrio3oo4amt micia( a2ua(r ot4tlt mociasla2uanmp;u)teeoxr3tot
\ No newline at end of file
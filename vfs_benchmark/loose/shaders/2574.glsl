@@ -0,0 +1 @@
+ueolt)teur(o3io1openmivslt) rta( pot1tpxoii3tlt mDeauvsnu)aleoxr oodomD  ivo (0t2tmir oo1amte nvtasf Dtrum ;u1olx mociyslsDranvs u0tlxomfcoydoa  auvilt  rtriopnodlmeelics s) Dumumont1olen ieiyd a2emnms;u) etnxr io1laD lnvs t0 rumim iy4lmt  ivtls)arrr(ro;t0apxnmfciydlm2ranmonu4tlxnif oo1fa e iei;(0texoxmpoy1ol  mivtl(fsDtru  ;t4tex iiciasls2uan p;t0aexnio3oadfpDeaneo t)texm(r3iydlptnlnci (  2ua(r ot0ale  oetasfs ranvp t4aleoirctotlp rauvi s s2xrxr nydol   neia(f Duaum nu1ape mi3iydfmDuauvs;(0trtnio todoaDrlieo;t0t2toxm3nudolt  ivsat s2rm(rooo1oetomi3iydlsDem( p;t) rxrxr tadlp  luvs (0 rxm(r3iu1ap  mfct (  rum(m ou1alt  ieiad m2um(vpnt4artrxf tydomDr iei;s t2toxr iu4alee nes sfarrmu oou0apeo f3tldfm uauvo;(4tlxomo to1laDe n slt trumxr3ou1ol nlncil( srtm( ono1opxnif3ild m2ran p u)altnxo tytopDrlnvs (0s2xmio3ny4optelnvsa(  2trxmpnt1tpx mfeiyt s2uluvon() rtnxo3tatfa  lies ()texrxr iy1llenlneia()arrmx pno1aptnmietyt a ranmo;u4tlxoxocootfptraivi t) rurio3no4llee fvta(fsDrrxmont0tetnioeildfa ulnms;u0trxnmo oydfpt  nvs;()trto(o io4lptn fcsa(f 2uaxrpno0alxnifctyd a ean p;u0 lxnir3oadopD ln s t0 exr(opou1om  lietat s2rru  ou0tee  fciadla rmu snu0trxoxfcio1oaDrlu s s) rtr(mpiodlltnmnvtlsf Dua(mo;t4altoio3tydlaDuan snu) lxomf3todfa elueil(  exm(rpnu4amt  nvtls sDraump;u4tet iociat m2rmnvo u) eenir iydoa elnvi;( t2urirpnodome  fesl( aDum( o;o0olenmfctatlm2ea(ms;u4tlermo3oydlm rlu il()sruoxo3iy1apee nvs s)sDurx  nt4ale ioetydfs2uau s;u4aeenifciotoptranvsl() rurxm3nudoltemnvtat) Draumonu1apxoio3tatfm eaumo () reoio3todomte nvs;t  etoxo3nodomt mnct ()srumu poo1texnif3iysls emnmp u)tlxoxf3oydlptr n i ( s2ur(o iodape  ict s)s2um(rp;o0teenmicils s2raump;(4 etomr3io1lm e nei ()t2xm(opny4lm emict sf Dtmur nu4ale iictas mDra(vsnt)altoio oy1la rlnvo s) 2xrxo3iydlp nmnvs sfs2rruront1texomfctytfa rl( snt) renmr3ootlate i o;s)srumir3ou4olee icsls)arta( onu1oleniocils a elnvs t)tetrmf3io1faD aueo () eurxm iodlpeelnei (fs2tau  oo4alx  ociadlsDeln pnu) exriocoatoaDrluvo t setmxo3io4ameelnctasfs2taxr ot4aeto iciytlm2rl(vp;t4alxnif oadlaD aneo;t)teurxm3iu4ame  ivslt  2rax ooo4open icils a uau s;t)artoif3oodfaD auvilt0s2ur(m3oydol elfvt (fa2umu oou0apto o3iytfm2eau p;()trtnmocootfaDr uvs;t0setoxr3iu1lmenlnvils srumum ot1oeen octysla ranmp t)tltrxfcoa1fmt ai o;s trxo(r3oydop nmnes s sDtm(ront1alxnmietldfa rmnvp u4tleoxf3oadop rau ol( srxrio nudamtnlncsl()a2umuroot4olt iociydlsDul(ms;t0alermr3tatlaDrluvsls)t2uo(r3no1ope lneslt)arumuronu1oexo fciydfs um(vsn() reoxo3tadfp   n o s)trxrim nodamt  icsltf rururonu4apxomicilt mDran sn(0artnmo ootfpte n ols  rurimpnodomenlnvtl() Dururooo1apeniiciyslmDrmn p;(0arerio3oy1fp raieols0 2uoimpoo1openmfeia(f Dumxmpot4tlenifctasfs2ul(monu0 rxomocoatlat ln s;s)truoxo3nydlptn ivias)aDtaurpoo1oex ifeilslm ul( o;(4 rxnxrciydfatelnvs;s) rtmxr3oy1ol e fei t) rumu  ;u0tpxnmoetas a rln s;t0 reoxf iodfm  lnvs;t setmir3nydome lnvi s arurxr ;o1ape  oeiat aDul(vs;t4aetnir3iodfa r u i (0 2to(r oy1amtnlnvt () rrm( oou1openii3iat a elu s;(0aeermo totoa   ivsls)truo(r oo1lle lfciasfa2umumpnu0apto fciaslaDuan ont)tlerir iy1fm e n il()tetriopoo4apeelnesasf rtrxmpot1tpxnifctlt a2el(vs;t0arxrir3iotfptr i i;s) eumio ny1omtnmietlt  Dra(rp;o4ape  fciydfa2elump;u4 rxomoctatfp   u il()teuoir no1am emnctl( s2rr(mp;u4alt mfeiytfa2emumo;(4trerif3oa1lp rai o;s trxriopio1ol  mnctlt s2raurpnt4oeenmoetldfs2rm(vo u4 lenxo oatfa r uvol()sexr(m3oodom n fci (farrmurpnt4optoioeiytfaDeluvpnt) eenmr oydfa  li s s)texmxopio1aptn ici s)s2uaxm ;t0aee io3iysla rl( s;t)altrmo3ty1lpte uvilt)texmim ou4aptnlfvsl() Drmx poo0tlto ociasfmDrl( s;(0altrxr iodlat  i s (0texoir ny1apt micta(f Draumpot4aeeo ictytfa elnvo;u4alenmocoodfm   i s ( t2trirpiy1lpeemfvsas  2ra(m oo4apxoifeilsfm2em( onu0 rermo3oa1fmt  u ils)srurxo3oy4ap elfvs t)srrmurpnt1tltoioeiadfaDrmnmo;u4tetnir3iadopDeauvi;t) exmir3io4aptelnei t  Dtm(mono4tpto ietls aDum(vo;(0arerio3oydopDe uei;t) 2xmxr3nodole mici t)a2tau poo1ole  oeild aDrlnvsnu) rermf3iytop rlnes;s0srurxr ny1lmee ivils sDra(r oo0apto ocilslm rl( snu)arxrmo3iatlaD lnvs (0teuo(r oo1lmtnmneiasfsDtaumpou0oee  f3iyt s2umu ont0texoxr3oy1op eai o t0 rxrir3ou4amt licsat s2raumont1aetnmi3ildfsDrmumo u0 reomfcta1lm r i olt0srurirpiy1omtelivslsfarraumpot1oexn fciyt a2umn s u4tetoircoa1oaD  n i;t  rtoxr3no4ome mfvsas a2ta(ro;u4tptoifetytla ea(vont4 lxoir oo1lm   i i s truoirpoy1lm  mnvils) rraumonu1tlenmfeiytlaDrl( pnu0aetrir iydfa eanvi ( srumio3ou1aptemiet ()artrxront4opeo o3tadls ra(mp t0texrmfctatlat  i o;t0trtmxrpoydopee neil(  Dtr(rono1alxn i3iyt aDem( snt4altomfciotomt ai slt)setrxr3oudal emnvtas)arta(m ou4oex ii3iys mDrau s;u4arxrmf3tydlm e nes ()s2trxr3iu1lmt lncilsfaDua(m ;o1aeto fciad s2ua( sn(4 rxnif oodom r n sl()t2um(o3oo1lle mnvs t) Dtmxr ;o0oltnmoetaslm ean o;u) exnio iotom rau ol()srxmxm3iodape lnvia()srrmurp;t1tptomfeils aDelu o (4tltoxf tytlpD  i i;s0srxoxr iy4omenmivsls s2rruroot1oexnmi3iad sDuauvpnt4tlerxo oydlatr nvols0 2xoxmpou1amtnmivil(  rrmumoou0tee mi3iys m2uanvp (4arxnmo3oytom r ivo t s2xoim no1oltn fvsa()sDua(mp;u1opxomocildlmDeanvp u0aexnxr3tatlmDe nvo;s t2toimpou4omtnlfvsl(fsDua(  ;t1aleoiietasfaDean pnu0alenmf oytfmDraiei;s0 2umxm3iy4ll eliei (fs2raxrooo1tptn i3iytfsDemnvp t0 ltnxo3iadfp r ueilt s2xmxo iy4omtnlncias)srra(m ;t4olenmoeiytfa2em(mp (4 rtoxocia1fptrlnvi ()t2trio nu1oltnmivtatfaDurur ;o0apt ifeiyt m2ua(ms u4texoxfcoa1oa eaieo;(  rxr(opnydal n fciatfarumuroou1tpe  i3ild s rluvo u0 eerif3oatom  auvi;t srur(m3oy1ole mici s srtax onu4tle mfeiadlaDeanvsnu0aeenxfctodfpt  uei s seurxo3oo4amtnmnvslt) Dra(rooo0apeo f3tlt m umn p;t)altnir3iytlmteau s;s0trtm(mpno1altn fcslt  Dtmumo;o1oltn i3iad s2ea(msnu4artnxo oo1laDrli i;s sexr(o oydol  mies t sDurxrpou1aee mociydlaDuluvp t0 rtnmo3totoat  n olt0 ruoim3ou4ome  neilsfs2rrx p;t0aex  ociytlsDumu s u)teeoir iodfpDe n ils0t2xoxo no1amenmiei s arrmuro;o4alx ii3tldls umu s;u0teerxr3iytfpDr nvs;(0 2tmimpiu1lp emfcsa()sruru o;u0oetn oeiltlm2uanmpnt)aetomf3to1latrlieo ( teurxm3nu4lmen nvia()a2urur no1aptomfciysfaDrln p u)aexnxfcootoaDe ivo ( seuoim nudlp emncs t) Dtruro;t4aexnmi3iyd aDelnmp;u) lxomf3oytlmD luvi;t sexmim nydomtelfctl() rrrxmp;t4aptnif3iat s2ul(vo;u0aleoxr3ty1oa r u s t)srtr(m3nudole  nvtatf Duau oou4aee  f3iat s eln o (0aetrxrctydfm rai i (0t2to(r3nydlm nlfeilt) 2tmump;u1ape ifciysfa uluvsnt0aeeoir3ty1fa  ai s;s)setr(m iy1lp nlneil(f Dta( ono0apen oeiyt mDulnvo;t)tltoifcootlateli s t0srurxm3nydame  fct t)arurxmpot4olenmiciytfm2ra( sn(0aexnmf oatop  luvsls texoxo nu4lp elnvt s a2ra( ono1tlxo ietad aDul(msnt4artrxfcta1laD  nvsl( s2tr(m3io4ll   ivsl(  Duau oot1olt  fctytfaDrlu o t)trxrmfcia1fm  aneo s  2tmir nudomt  fesat  rurx  ot4tptn iciysfa2rmn onu) ltoxr3ta1lptean o;t)teurxr oy4olt lnvsatfs2rrx ono1apto ictas mDeln s;u) ltoiocoadfm eaies;()truoio oo4op elfvta(fartru pnt4apxom
\ No newline at end of file
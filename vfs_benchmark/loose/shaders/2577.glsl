@@ -0,0 +1 @@
+i i t seuoxo3nudolen fcs t)s2uaxrp;u1tet mfctls m rlu o;t)arenmrctadoateln ils0trxmio nodamee nvs s  rrrx onu4tlt mo3iys aDuluvsnt) exoxo3oatfatelivi;()trtoxrpnodolt  ivils a2trxm ou0optnmfeiydfa2ranmo;u4 lenmf iy1lpD anei ()sexr(rpnydoptelfct s arraxro;o4opx  icils m umnvp (0aexomocoydopDrau o;s s2xr(o nudam elfcsasfsDrm(mono4olxo o3iytla2rlnvsnt4 reoif3tadoa ranvilt0truo(r nodllt  ics s)s2uauroot1oeeomicias sDran s u4 rerxo iytfatrli s t) 2uoxopio4lp nlfetl(f rumxmpno0aeto ietydlsDum( onu) ltnxr to1oa eli s;() 2tr(r ou1altnlivtltf rtaumono1aexn oeiysfa2uanvs ()tlxnif iodlaDrlnvo s0trtr(opoy4lptnmfvi (  2ta(mpou1tleomf3tyd mDuaumpnu4trtomf iydomteln i t)t2xmxm3nodoleemnei (  Drmx pot1aet  fctls s2ul( o (4 rtomo totoa   u ilt)s2xmim oodamenlict sfa2ra(mpoo4tltnifetatfmDuluvp t0 etomrciodomD lnes (  exm(opnodll n nvs ( aDrr(m ;o4apeoiiciytlsDuln onu4areomo oatlatrlu i;t t2xrxrpnudolt  fvtat)a2taumont0tlt ioeiltlm2emums u4trermr iotlpDr u sls0t2uoxo3iu4aptn fctat artau oou4alto ieiasfaDrau p;(0 renmfctodop e neo s s2tmxo no4alee feias  Dur(root0tpenifeils s ua( s ()tetoxfctytfpDrlues ( trumxrpnu1ap  mnctl(f 2ra(rpno1aeeoioctadfs2rmu s;u4tleomo iadfaDranei t trxoir3nu4lmtnliesl( srtm(m ou1aeto i3tatfa2rm(ms u4aexnxoctadfpteauvs;s srtm(r3nu4ll nlneta(faruauroou4altn o3tasfsDra(ms;t4 lerifcia1fate uei;t0s2tm(r3iudlptnmnvt ( a2tm(r ot0opxn i3iydlsDem(msnu0 rxomo oatfmD ln o;t)t2umxm io1lmt mncs (  rtr( ono4aleoiociltlm raumo;() rtnxr3ootlp   u o;s0 rurxmpoudal  lfcsl( sDtru pot0tleoiiciydfa uan p u4 rxoio iydlatrai olt0seum(r3ny1op   fetas arum(mooo0aexoiieilslmDrau onu) etrif3oo1fmDeaieilt  exrimpnudomt mfciltfaDum(ro;t4opxn i3tysfs2eaumon(4 ltnmf ootfmD aivo;t0srurxopiy1ap elieil(f 2ur(ro;o1tlxomicias a2eau pnu)teenir3iotfmtrliei t sexrxo3no1olt mfesa( aDtrum ;t1tlxn i3tltls ranvonu0arerxo3todlmDe ieo;( seuoxopnu1ap emnet ( a2ur(mo;u0tlto f3iltlmDrln ont0aeeomr3iy1fa elueo s)t2xr(opoo1ap n netlsfa2taumpnt4oex  o3ias mDelu o;() leoirciytfptelivs s texmxmpnu4amtn fesasfsrtmxm ou1tetoio3ilt a em(mp;t0 rxrmr3iy1om   ivsls srxm(r oodal  mici (f 2ta( pot4apenmiciltfaDrlnmo;t)treomr3ia1lm raues s)t2uoir oo4apenmnvslsfartmxmoot1oleomo3tyslmDulu s;()alxnxf3oadoaDr u i;s)trtoxopnu1ole mfvs tf Dta(  ;t0tpxnmo3tltfm umnvo;u0texoxr iy1opteli i s  2xrxmpoy1altemncs tfa2tau  ;u0oet mi3tasfsDemnvs (4altoif3ootopDeauei s)t2ur(r3nu4lmee fvsa( a2uau  oo4tex mieiaslsDum(ms;u)trxriocootlpteanes s seur(opoo4op nlfvs tfarra( o;t1apenioetadfm2rau p u4 rtrxr oo1omD livi;t)texr(opnodap elnvi (  Dtmu p;u0tpt moetls sDeauvp;(0alenxo3tatfpDranvsl( tetr(o3ou4openlici () rurxm ;u4tle mo3iytfmDum(mpnu0 etrir3iadoaD  uesl( tetmxo3ou4lm elnesas)a2uaumpot4aet mieiytla2rm( p;u0tleomrcoytlatrlnes;s0texrxmpnudapt  fct () 2trum oo0altoifetld mDrmumsn(0 lxnir ta1fateaiei;t) exoim nudaltemnvs s)s2rrx o;t4optnmociad a uaumpnt4 rtnxr iydfa r neilt) 2uoxr3nudoptelictl( sDtrxm ;o1optomietyd a raump;(0trtrxf oodop  ai ol(  etmirpoydapeemnet t aDua(ro;u1oetnifeiydlsDemuvo;t) rxnir3iadfm elivils trxrio3oudal  mfvt s sDumx ont1oetomieildlm2uan pnu)tlxoxr3iotomtrliei ()srxoxrpnudamtn ivilt s2ra( pnt4aeeomo3tltla2rmums;(0alenircoadop eai i;t  2uoxm iydalee nvsat)srtau oot1aet  iciltfaDelnmo t0tlxoioctydlmD  ieo;s t2to(rpnu4ol elivtls)srumu p;u1tlen ictlsfsDrmn s;t)aetnmf3iadfmt ai s s0sruo(mpio1lltnmfetasfarurx  nt0apxnio3ilslsDea(ms (0altomo3oytfp rai o t)s2xm(r iy4alt lfviat  rtmxr ;o1aeenio3ildfaDuan onu4trxrxf ia1lp rli i;s0s2toimpiy1optelncias s2raum oo4olxoioeiyt aDrlnmpnt)aeerir3iatlatrauvi ()trtoimpiudaptn ici sf rrr(ront0alenifetatlaDuau pn(4aexnxf tadla  lu o ( seuo(rpnu4am n fvs ()aDra( o;u4oetn fciadla ul(vs (0aleoio oydlptr u s t)srxo(r iy1om nmicsat)sDra(roou4alxn oetytfaDua(vp ()arxnmr oadomtrluvolt) eur(mpnydolte ict ( a2uax o;u4tpeoiieilslmDul( on(0tlenxoctotoptr u i;(0t2xr(o iudll nmfvtltfa2tax onu1oexoif3ias a2ranmpnu4 etrif3iytfpteanvols) rurxr3nudam nmncslt sDtaxrp;o1tpe mietatls um( o u)treoircto1lmtelnei s0srtrxm3iy4ll nmfet s a2rmumoot4apxoiieils mDuan p;t)trtoio iotlmte i o;s)s2toio3iu1lmenmivilt)a2umur nt4oltomo3iat m rau p u)aeeomrcootfptelieo;s0trxoimpiy1optnlncsa(f 2taxr ;o4tet iocildlm ulnmp () rtnmfcoytoaDr n o;t setoio io4llenmfvsl(fsDrr(  nt0aptn o3iltlsDra(vp;t0 rtnif3iydop rlnes;t s2trirpny4aptn fvia( sruau pnu4open o3iat s um(mp u)treomo3oydfateli o t sexmxmpoo4ll nmfvias) 2rrur nu0olxnmo3tad a emuvont) rerio3iodlmDelnei;s0 rxoir3oodlltemiet tf rrrur ;o1opeo oeiltlmDem( on(0texoxf ta1fat  ues;t0 rtrxm3oydllte fvtasfartru pot1oltn fcild m2emumonu4 etoxf3ootlptrli sl( texr(mpio4alenlnciat) 2rmxr nu4aet moetlsfsDrl(mp;t) eeomf oatlat ai o t0seumir3iodlle mfcsatfartax  oo4oetomfeils m2ranvsnu4texnxociytlat au ols srtm(m3oy4opt  fet (fa2raump;u0alx  oeiys mDulumsnu)alxrircoydomDeaieol(0 2to(m io1om e icsas  rtm(rpnu1opx ioeiltlmDeanvsn(0 exrxrcoydfm  lu ols) euoio iodopeelivsa(fs2uaxmpoo0aee mi3tat aDeau s;(4trxrxr iatom eaivilt)tetrxrpiu4lmenmfctls  2trx pou1opt mociytls ranvpnu0altoio3ty1omDelu i () 2trxr oydllen nvia(f rrrx  ;o1open o3iytls emuvp t4alxnif3iy1om eluvols)t2toxm nydomen ivta()aDur(mp;u4aeen ietadls2rlnvs t)teeoxoctodop  lieo;t trtm(mpnydlpt  ncsl(fsrrmu pnt1oee ifetldfsDemumo;u) lenxrciotlpD an i t s2xoxo3oydlm emnci ()sDrau  ou4apxoiieilt m rau o;(0tlermr3ootoat ai i;t0trto(mpiu1am nmiet (faruru oot0aetn icias aDua(vs t0 eermo3ia1laD luesl(0srxoxo3iy4op elfeiat srrax  ou1aleoiociyd mDulnmp;(4tltrioctotopDr uvs (0teuo(m3iu4ape  fcilt s2raump;u1optnio3tat sDem(mp t)tetrio3oo1lmDrli ol(  eumxo3nu4oltemfct (faDrmxrp;t4aee  feias s2umu onu0aeenmo3oydfmD au s s trxmirpiu4opeelfeias)srtrxr ;u1tpt ii3ildls2emn s;u4artnxrcio1fmt  ieils0 rxmxo oy1amt  feta(farurxmpnt0oet mfciytfaDea(vpnu)arxrmfciotlm   uvo;s)trum(rpoodlmt mfes s srtmxrpnt0altomoeiysla rm(vonu0 exnmf3iydfaD  ieo s trxo(opiodlpenlict t s2trx p;o0tlxo oetyd aDran o t4texnmf iodom e i o;t  rtmxr io1alen nvsas  Dtaur oo1aetnmf3ilsfsDea(vp;t0trxnmfctodomDraueols0teuoxr3iu4lmenlfvt (fs2ta(m ;u1opxo feildfa rmnmpn()arxniocoydlpt anvi;s truoio3iu1om   ivi s aDtr( pou0altn octlt s2emnmp () lxrircoo1fpteai i;t)t2uo(r3nydlp nlfci () rrmurpou4opeomo3iaslm2rlu o;() rtoifcootfaDeanes;(  etoxm3iydlmte fvil(f Duaxm nt1olxnmoeiltla2umums;(0altrxrcoadfmD  n ilt)seto(opoydlme  iviasfsrrrx pno4ope mfciatls2ra( p;u4 exnxo io1fatr i ilt trxm(o3iu4lpen ieslt)artr(rp;t0opx  f3tat aDrmuvs;t0aeeoxo3totfpteaieilt) rtoir ou4amte nvtlt artaur ;u1alx mfeiadfm ulnmo;t) exniociodoa raiei t  rxo(o3oy1am   ncs () Draxmpoo4tlt iietltls emums;u4aleomf iadlm eaueolt)seurimpio4lp n ncilsf Drm( pnu0alxomfetydlaDranmo u0aeeomf oatlmDeli s (  rto(mpiodamte fctatfsDrm(m ot0apx ifctadfs2eluvon()teeomf3oytlateanei;s  eurirpou4lp  mnvias) 2rmumoot0altnio3iyt mDuau o t) ltoir iotfpDelnvsl(0 rtoim nu1lle livsa( aDum( p;o0altomietytls ea(ms ()tlerioctydlat luvi t texrim iydame micsl(fs2urum nu4aeeniictltlm2rlnvp;u0 eeoio3tydlpDe ueo;t  rxrirpoy4opt  ici s a2ur(mooo1aptn feiad a umuvo;(0 rermo iytla e n i s0sexr(opny1aptn nesa(fa2tru o;o4apx ifetatfm2rmnmo (0 etomfcoatfp   uei;t  ruoxmpoo1am nlivt tf rtmumono1tpt mieiydfs2uauvon()aetrmo tydlpDe nvol( trtoio iudlm n nesasfarua(rpot4tpe  o3tldlmDumumsnt0teermf3totlp rlu olt) 2uoim3iudome mieil()artr( p;t0texniieiltlm2um(vo u4 exrxf3todlaDeanvo;t0s2tm(o no4lmt lnetlt) 2ur( onu1apt mo3iys m2elnvp u0 rxrmf3oa1fa eluesl( texoxr3no1omtemnviat s2tmu pnt0aexoifcils a el(vo t0artrmr3to1lat  neils0trtr(r ny4ap e fvi (faDtauroot4texoioetytlmDemnvo;u4alxrir3iotfpD  ueilt0sexo(r oy1apte ncils)sDuru ooo1openifeild mDulnvp;u4artnxfcoa1oaD aivs;()trtmir3ou1ol emfcils srraumo;u1opxnifeiytla2rmnmp;u4aeeriociodom ranvi;t truoxr3io4llte icsa( aDtru ono0tee moctytfsDem( s t)aetoxo oadfpD auvi;() 2tmxo3ou1aptemiesas srrm(rooo4texnmoctydfsDrmuvsn() exoxo3tydop eli olt) 2tm(r nu1op emiesatfsrta(  no4opeomf3tlt s2eau o;t0 etrmr3to1fmDeanvi;t0tetrxrpiu1ll emnesa( sDta(  ot1aeto ieild aDemnvo;t)aeeomr3iydlatr i il()srur(m iydapeelfcs t  Draxmp;o1tltnmi3iatlaDuanmpnu) rtrxo ty1la  lnvolt) 2xr(rpoudop   fesa(fs2rr(rp;u0apt  fciyt m2ra( s t0arxrmrctodlaDrln ilt srtrim oo4llte neslsfsDta(m ;t0teenmfciytfm umuvp u)alerxo tatoatraivi s) rxo(opoy4op nmnes s sDrrur no4tlxomoctydlm2ua(mo;u0aetomf3ootfa r i i s  2xmimpnu4aptnlivsa()s2umx pot1olt ioeiydlsDulu snu)tlermf3iodlp eaueols texoxr io4am nlivi tf rtmu p;t4opeomi3ias mDua(vp;t0teenifcootop  livo;() rxm(r3oydom emiciatf Duau  oo0ole  fcilt a ranmsn(0alerifciodopDe u i t teumio3nydlmen fcta(fsDra(r ;t1tpxn i3iadfs2uan s;u)arxoxrcia1oa  lnvsl()s2to(o3no4optemicia() rrrump;u4alto ictatlaDemu pnt) ltnmo3ia1om  auei s  etmxmpoudomtn nctlsfarrm(  ot4teeniieiat s2umumo (4 lenif iadfmt  i s t0seuoio io4op eliesl( sDrm(m ou1alx mf3tatfmDuau pnt0 exrif3iadomDe uvo s s2umxr3nodlptn netl( aDta(rpoo0oetnmi3iltfaDumn o u4aetrxo oadfa  luvo (0 rum(mpoo4aptelnvi tf 2uau oou0tptnmictytls2rlumpnu)teeoxfcia1lm rluvsls) etmiopiu4optelfetlsfaDrmumonu4apx mfeiysfa2rl(vo;u0altrxociydfpDe ieils  exmim3ny4altnlnet s)sDtax oot4olt ifciltfs2ua(mo t0 leoir iadomteauvslt0srxo(m iydol e fvsat srtr(ro;o0oltoif3iaslm2umnms u0arxoxo oatlptranvo t)trxrimpou4ap nlicslt aDraxmp;u4aee mo3iaslaDeau o;u)trxrif iadfmD  uvo;s srum(o ny1lm  lfesl()sDua(m ;o4teen ocias a2eanmo;t)arxrmocoo1om eaiei;s s2trxo no4ap emfvtls s2rrx  oo0olenii3tld s2ua( s;t0trxoxfciodfm eluvs s) 2toxm3iudop  lnetls srumxmpot0tleo o3iadlm2ulu on()altrio3oa1fatr nvolt)seuoxopny1olte fet ( a2uaum ou1tpt  i3tls mDulnvsnt0 etoir oy1la eaneols0s2umxrpoo4ll e nct tf Dumxro;u4apxniieiadfs rln o;u0artrmf iytop rlnvolt0 etr(o3oydam n fvtls  2raxro;u1tle io3ild a2umuvpn(0texrif oo1lpD  nes;s  exoxr io4ap n ivi ()s2uaxm ;u0aee  ieilt sDrmnvsnt0aetrifcoytfp eaivolt tetmxm ou1llenlfeiat)sDua(mo;o0oex  fctydfa2ul( snt4aleoxoctydfm  aieo t)texoimpny4ll nlieias  2umurpno0tlt moeiydla elu snt)texrir tydoaDelueslt0 ruo(r3iu4olt  fci s sDururp;u0apt  ociadlaDua(vs;u0 lenxr3iodlm   u i;t trurir oy4apt lietls) Dur(roou4oeenmociytfm emuvsnt4 lxrxfciatfpDrlieo;( trxmim iodlmeemnetas)s2ua(r ;o0aptomietadlm em(mo;t0artrifcoa1fmt lues;() rumxr iu4ole livia(  rua( oou1aeenmi3iatfs rln sn(4artnxrcoydoaD  uvolt) 2xr(rpiu1altnmivsat) rrm( p;u0oeeomfeiat sDemn s t)trxnmf iytfaDelu ols0 2tmir3nodlmeelies sf rrr(mo;o0oexo oeiyt s2rmuvont4artomrciytlateaivi ()sexmxmpnu4ame mivi (  rtr( ont0tlx mocias sDrmu p (0tltomoctytlpteau s t seumiopnudameelivs t) rur(r ou1olxn i3iltfmDel(vs u4trxrmfcootopDeanesl()trxr(mpnydlmt lfvtatf Duru  ot1tle iiciytfm rl(vo;(4 etrxf oytopt  ues;t)t2xm(opoodlp n nesa()s2rm(mpou0olenio3iydfsDem(vp u)tlxrmocio1lateli s s0sexo(r3iudll n ict tf rtau  ;u1tlx  o3ildla2rluvpn() exrir3iatomt an olt0setriopiu4lmte nvsa( a2rr(ro;o0open fcild sDulnvo;t0arxoircta1omtrau o;t)sruoim iydlme mfvtatf Dum(r ;u4tpenifctld s2rm(vo u)tltnmfciytomDrlivs () exrio3io4lm   fctasfs2rmxmp;u4aeto i3tatfa emnvp;u0tlenirciodlp eanvil( srxoxm iydape mivt s  rurxmo;t1alxnifetyslm rm(vp t0alxnxr3oytop  luei;(0 rtrir3io4oltemictl(  Duax o;u1aptnif3ilslaDrl(mo t)tlxnio3iytfmtrlivols trxrirpiy1am   ivi ( sDta(ro;t0aex  o3tls aDrmump u) ltrir tadfatean ols trxm(r oo4omenlfetl( s2tax ono0olt miciad aDemu o t)tlenio3iy1fatrauei t  etm(rpno4apenlnvt tf 2ra(rono1oleniieiadfm2ulnvp;u) rxrmo3iotlmteaneo;( setm(o3nu1ame  nvslt aDtmurpnt1aeto o3iltfs umu pn()trtoio oy1om  aivi ( sruoio iy1omtn fvtls aDtm( pot4tlxniieiyt aDrm( pn(0 exrmrctatoaDrlneo;s  exm(m3iydlp nmieta(faDraxmo;t4aetn ociytls2rl( pnu0tltomr iadop e uvo () eum(m no1lmtelncsl()s2trxroot4alt moctadfaDemnvo u4artrif3tadlmt  nvs ( tetm(m3nodlle mfvt s artmxm no0tee  ociad mDrmnvpnt0 lermo3oo1om e nvi (  ruo(o3nu1ap nmictasfsrum(mo;o1tlenmiciyd s emnvsn()trxomr3ty1fmte nvslt0tetrim ou4oltelfcil(  2ua(mp;o4oltnmo3tlt aDuanms u0 etrxo3iy1fpDe ivo;( setr(rpoydam e ietltfaDtmu ooo4aee ifetlsfs2rlu p (4 lenmf tatlmtrlivi (0 2trxr3nudameeliet (f Dumum no1oet mf3tytlmDumu sn() rermr3tydla ranvo ( seur(m ou1olt mfciatf Dta(rpnu1alx ioctldlm ul(mp;()tetrmrcta1lmD  ies s t2urxopiu1llt micsa( s2rru  ;t4tex moeiyt sDra( p t4tlxnifciatlmDrlu ils  exrim no4lltn fvt s)a2trxmonu1tetniicildfs2rauvpnt0 rtrifcoa1lpteauvo s setrirpnydam elfvtl(fsDuaxmooo4oexnio3iadla elumo;(4arxomo3oatopDe ueilt)s2trirpiu1lme lncils)a2tau ooo1aeen i3iltlaDemu s () lxoif3oo1opD  i o;s  2xo(r3no1op elnctl( s2rr(  ;u4olenmoeilsfm rl( sn(4alenxocootom  lnei ( setmxr3ou4ol nmncia()sruauro;t0tltn oeils a2ea(vo;u)arenxo3tytfmtr ueil()trxmio3io4omtnlncsl(  rta(mo;t0aptnio3ild a rl(mpnu0aeeomr3oadfp eln i t  eumir3nu4ap  mfvs (  ruau  nt4tpxoiieiys a uluvo () ltnmociodfpt an o;()t2urir no4lmtnmivsa()sDrr(mp;u0alto f3iasfm emn snu4aetnif oodlmtranvil() 2xo(m3iu1olenmnesas) 2raumpnu0tpt io3tltls umuvpnu4artnxf ta1fmDeauvolt trtoim3iu1ap nmfvsa() Duau pnt4tpe mfetat m2ua(vs;u0 lenio tydlmD  ies;t0s2umxo iu4opeemnes t) 2rm(mpot0oleo ieildla ean on(0aeenxo iydoptrli sls)tetm(mpoudom e ivsls)sruaxrono0teen o3iltlmDemums;u0 exrmrctatfateliei s) rtrxr nydaltnmietl()sDtmum oo0tpx if3iytlaDrmnvont)altnmo3iotopDrau sls0 exmxrpnu4al n ivs ( srtaumo;o4oeeo o3tlsls rl(vs t4texoircty1omt liesl(0 2xoxrpny1aleemfcs ( s2ra(r ;t1oee moeiydfs eau ont) lenif3tatlp r u i;t)srxmxrpoo4ll  lnctas)a2trum ou0apto fciad a2rauvp;t) ltrmf3ty1laDelieslt0texr(mpnudal eliet ()aDumumpou1oltomictatlm em(mo;(4texoirciatop r u i s)teuoxo3nydolenlivtat)a2rmxm ot4olt moetltfa2ulnvs;(4 etnio oodfa eaneo s teurxr ou4ll elncslt)s2uaurpno0apeomietyt m umu o;(4aeenmo oy1la rln s;t)trtrim oo1optnmncilt  Dur( p;o1texoifctaslm eluvpnt0arxrir3oadfm  livsls)setoxr oodlltn ivt s  rtmxront1tpxniieiyd a2em( s t)trxrirctatfpt aneols)srurxm3iydlltnmfvtl() 2rmxm ;o4ape  fciadlaDran pnu0aetrifcootla e uvo (0trtoimpiydlptemfvia() 2tr(r no1oeto fciytls uanms;t4altoxf3to1fpDeau il(0s2urim3oy1oltnlictat) rra(  nt0tex mieiytfmDelump u0 exnir oa1omD  uvs ()seuoirpou1optnlics s  2raxrpnt1openmoctyd s rmn pn(4tltnxf iy1latrli i;s)trtmxmpnudopt miesls) ruaxrpnu4tleoifciyt sDuauvsnt0trtomr3to1opt anvils0texm(r3ny1alt  fct s)s2raxmoot4tetn oeiadlm2ea( o;u) rtrxo todlmDrai o;( s2urirpoodlp  mfvias srtr(m ;t0oeenmiciyslsDel( s (4trtrmo ia1omDe i slt)trurxm3oydlm   feiat arra(moot1oetnifctldfa rlnmsn()arerxrciy1fa rlies;s s2xr(o no4aptn fci (  rrrx  no4tlt iictlt sDuanvo;u)tltnxfctodfmteli s;t) rur(m3iudaptnlnes t s2uaxr ;t1openmociat s2rln sn(4altrmr3iatfmtraueo;t) 2tmxo3oydape livsatfsrtm(mont0olxn fctltlmDrmuvp (4texrir3oadlpt lu o (0 rtrimpno1al elict t sruru p;o0oltnii3tldlaDulu on(0tlxoxo oydfpt  ieils  2ur(m3nodap  mneslt artmu  ;o0aee if3tld m umn o;t0areoxo iatlm  aues t trxo(m3nu1ope lnviatfsDtru p;u0tpxoii3iasfm2rauvsnu) reoir ty1fa rlies s  2uoir3io4am  lnctas srra(  ou0olx  o3tys s ua( s t0alenif tydfpt luvo s sexr(m nodlpt lfes s)a2ua(rpnt0opxnmo3iltla2ean on(0teeoxrcoa1oateau s;t)t2umxo nu1apt mneilt aDrrx p;t4oex  ictatfa ulumpnt0aexomocto1fmt luei;t trxmimpny4ap  lieta(fsrta( o;t1aptniicildlmDua( on()texoif oy1fa r nvslt t2toio oodlm nlfcsat  rtrxrooo4oex iieiad s rlnmsnu) exrxf ta1laDrli i;t0t2xoxm3nydole lnetasfs2ur(  ou1tpxn ociyd a2uaumon(4treoio iadlmtr nvsl()sexr(mpno4ape  nes t) 2rrxm ;t0oltomoeils s raumpnt0arxrio3ia1opDeluvol()teuo(r iy4ale liesl(fs2ua(r no0aetnmoeildlaDul(mo;t0arxoxfcto1fm  lieols)sexrir3nu4omenlncslt)a2rmurooo0ope ifeiyslsDumuvs;u) etnmo tadlatrlu ols0 2xm(o3iydlp nlnvi ( artmx p;t4tpe  o3tyd m rm(vo;t4 lxrmf3to1opDeli ol(0srurxmpoy4op n netlsfa2tmxmont0tpto ieiat s ranvo (0tltrxf ta1fa eli o;t0t2xmirpou4lpenmfviat  rrru oot1aetnmfciyd sDulnvp u0treoir iodop elivslt0 exo(mpny1amtelfvs ( arra(moot1tet ifeiydlsDrluvp;(4 eerxoctydoaD ai s;s)s2trir3iudol   ict s) Dtm( p;t0apxoio3iltla rmn s t0alerio todfat  nvo (0s2umxo iudap nmictasf 2tmurono1oexnmoctld mDem( p (0tltrxrcto1latr nei;()trtmxr oudllee iesltf rtmum ;o1opt iociat a2rmumsnu) renxo3iodlat lu i;t t2to(m3iy1optemnvtlt  Drm(mp;t1tetn feiyt m2rlnvsnt4tlxrxf3tatlatrluei (0sexoxr ny1altnlnvt ()s2ra( o;t0aeeomiciltla uaums;u4 renif todfaDe neo s)trum(o oy4ome lfcs s)aDururp;u1olx  iciytfaDrmnvo (0aleoxo iydoatrlivols  rum(o io1ome mivtas) 2ur(rp;o4ole  ieiasfmDrmumonu)aexnmr oadlpDrlu i;(  eurxopoydome mnvilt)s2rax pnt4oltomfcilsfa2rl(mpn()tetnxocty1fm eaueo;t texmim3no1lltelfes s)artax pnu4tee ioctasla2umuvsnu)tetnmrcio1lp e u o t)sexrxm no4lp   ivtls)arrmu p;o4alxnioctld sDul(vpnt4trxrif3iadlatrlnesl( s2xoxrpiodlmtnliesatf rrmxmoou1altnmi3iltfmDemn s u)tlenxr3to1op  anvs t0 rtoir3iodol   fei tf rrru onu1altoif3tld aDelnvp;()aleomf3oo1lptrai o;t texoiopoodlp n fvias  rumu  oo1apen ictasls em(mp u) reoir oadfptrli o () 2tr(opou4opt liesatfaDtmump;o0ope mictyslm2em( snt) ltrio oadlp  lneo t)sexmio3nodole  nei s  Dur(mpnu0aex io3iydlaDrl(mo ()tlxnif iodlpDrluvo;s0t2trir3ou1lpen fetls)arrmumont4tpt mictltla emu o;t)trermf tydlptelivi;()s2xmxmpou4ll emncil( arrax p;u0alxniieiytfs emn s u4alxnio iy1faDelies;t  etmim nodaltn fvtasfarumur ;u0aeeoii3tytfm eaums;t0 rtnxr3totfpD  nvs t0srtmxrpny4aleelncsls) 2tr(r ou4olx mfcild aDuan s;(0 leniociytop eau o;( sexmir iy1ame lieia(faDum(mpnu0aet  oeiys mDuanvo t)tetomrcto1op eauvsls  rtrim iy1openlnesas)s2ur(r ;t1alxo oeiadlsDea(vp (0arxnir3oa1omDrluvo;s teuoxr3ny4ameemnvsa()a2uau pnt0altnii3iatfm eln p t4tlxoxrcia1lmD an s ()srtmxmpio1lptnmfvs tfa2ra(  no0tlto ictldfs rmnmp;t0trxrmr ootlpDe uei;t0srurim iu1ole  ivil(f Dtaurooo4olxnmfeiatfs elu s (4arerxr3ty1omt  ieo s)texmimpnu1lp  lfcsls  rtaxr nt4texnmoeiysfs ea(mp;(0texnir3iy1faD  ivslt)truoio3nudomenmfei sfsrtrxm nu0ape mo3ilt m em(mp u)aetomf3tatfpt  nvs;(0trtmir3ou1ole mfvils aDra(rp;u1opxomfciat a emnmonu0aleoxrctotfm raivslt0srtmir nu4omt  nvsl(fsDrrxmono1apenii3iaslm ranms t)arenmr iy1fptrluvilt0trur(m3iodlmtnmfetlt sDua( p;u4aeeoifeiasfa eanmpnt0altrmr3iatfp   i s s0s2uoim iydal n fei s srrrx oou0optnifctas aDem(mp;u0 etoir oa1om r iei;t  2xmxr3iy4apee ncil(fs2uru o;o4texo ociatfsDul( p t0trermf iy1lp  lnei;s)t2ur(m iudlmt  nvsa(faDur(  oo4olxn fciysls eaumsnt0 ltnxr3tytlm e u il()teurxm3ou4ll emnes sfaDraur nu4tet  o3iadfa rln ont0aleomf tytlpD  n i;s0trurxr no1llenmncia()sDumxm nu4altoifciytls2ul(vsnt0 rxnifcoo1fmt livs;t0sexoim nodamenlfviat)sDum(rpno0tpto fctad s2ra(ms u4altnxf3oa1lptrlivo;t teumxo3oudlpeelnctasfa2rmxmo;t4tlxn o3iydfm emu ont0tltomr3oatop   n i t  exr(r oodaptnlicta( sDurxrp;o4olt moeiat sDea(vo;t0texoif3tatoaDeaneils)srxrio nudol   ivs ( a2uru poo1alxoioeild s rmnms;(0tltoxo io1lpDr n s s trumxm oydll e nvt tfsDtmu p;u4aetnmf3tadfs ul(mont)aeenxrcoatomt  uvils)teurimpiu4optelfcilsf rraumonu0opxo oeiltlmDrlu p (4 ltnio3tydlpD  ivolt)texr(o3iu1apee fci () rrmu pot1tlt iieiyslm ea(mp t0arxnxr tadfmtean s;(  euoio3io4lle  fcs tf Dua(m oo0opeo ocilt a ulump;t4altnir oodfatrai i s srumxm oy4ol  mnvtas a2um(m ;u1tet  ictat mDrau pnu0 rtnmfcty1laD  nesls0 2tm(o3nu4ol emfvta(f 2taumonu0tltomfetyslmDumn ont) reomf3oy1fpt luvilt)seuo(o ou4lptnmfci t  2ra(mo;o1tlt  fetadla2rmnmp (4 eenxo iodfa   ivol( t2xmxm iu1al elnet tf rrm(m oo4tpt  icias mDemu o (0texomf3ta1faDranvs;t0 rxrxr3iu1opt lfcils  Drmumpno1alxnmi3ildfsDrmu snu4 lerxociatop   nvils sexrio iy1lltnmfcsl(  Dtr(r ou4aetn fcildfmDeau s;u4teeoxrcta1omDrlieo;s)t2xr(rpny1al  lneilt)srururpno1tle  ieiytlm uanms t) renmf3oy1fptrlivsls s2xmxm iodopte fvsat)aDua(  ;u4ale  f3tyt m ul(mo;t0trtoxfcto1oaD ln sl() ruoxm oy4lp  lieta(f rrmx p;u1alx moeiaslm rmn pn(4arermr3oadoptraueo s) 2um(rpoy1alte iciat  rum(rpou0tpe  ieiatls2emnvpnu) rxnxr oy1lm r neils seuoxr ou1op e ieta()s2ur(m oo4alx mocilt m emumo (4aexoxf iytoateaieo;(  etoim3oydamenmfci tf 2ua(r oo1tlxn f3ils a rm( o u4 rxrir io1lpteanei;t)trumim3iu1lltn icias)aDraumont0tetnmociysfmDrmnms (4trtnir oy1la  an s;t  eur(r3iydlmtnmnctasfarta(rpno4tptoii3ilsfs emnmo u)aeerxo3ia1la  aivslt0srxrim oy4omtelfcils)srua(m no0tlxomo3ilslaDulnmsn() rxrmocty1oa eaieo (  eum(m nudalte fviltfaDrm(rpou0olxn i3ias aDrlnvs t)alenxo3oadoaDeaiei;s0seumxo3ny1al elivt sfsrtrumpnu0tpto feilsls2um(monu4 etomo iytlptr ivi t)seur(r ny4apen ivi ()a2rr(rpnt4apto i3tytlaDrmnvo;u4altrmf iytlmtr uvs (  etoim3nu1lm e ict t)sDrr(mooo0oleo icilsfa um(msnu) exnxo tadlpD aivil( teuoxr iudlmtemncsasf Dtaum nu4aee ioctltfs2ra( onu0trxnxr oatopD  neo;t0texr(mpou4al  mncsa(fa2rru  oo4texoifeiat a2em( o (0 etomfcoo1oaDr u i;()trtr(m oudapte ict s aDtmx o;o1altnmictlsfa em(mo t)aexrio3to1fatrauvo;s)seuo(m ny1opee ivt tfa2trx  oo0oee iiciltfa ranms;t4artnxrciydopDeaueo;s trto(r3oudoleemfvia(faDum(mont1alt mfcilt m2uln p t0tetrxfctatom eaivo ()setmxrpoy1ale miei (f rtruro;o0ole  i3ildfmDem(vo t4aexnxfctytlp e i i;t srto(opno1lpeemfcsa( a2ra(mpou0optniicilslm2rm( s;t4altoxr3oatfpt  iei;t trur(m3nodapt mfvilt srumxmpoo4apenmfciat sDeau o u0aetoio iodlaD li sls0 2toxr io4lpt  nvi ( sDuaxro;t4tpenmf3iysfa ea( ont)aexomrctadop  luei t  rtoir oy4omt  fvsas)srtaum ou0ope mociydfa ea( pn()aexrmrcia1opDelies;t0 rtmxr3iydlltn ivs ( a2rr( ont1tetoio3iasls emuvp;(0altoxrcoodfa e neo;s) 2xoxm3no4omtnmicilsfsDtrxrp;u0aee ifeiatlmDeau sn(4aetoif3iatfat aivo;s  rtrim ny4ome mnvtat)aDrmu  ;u1aleomietls sDum(vp;u4 rerxo3oa1lm e nvi t0s2tmir3iu4oltnmieslt)srur(rp;t1teeoiictad mDrlnvs;u0arenmfciy1latr i o;( truoim3iydal e fcsatfa2taxr ot1tpx  o3iysfa ul(msnt)tetrio3tadlaDrlnvi;(0 etoxm3ny1lltelivsa(fsrtrxro;o4tpe mi3iyt a2raump;t0alxrmo tatoptelnes ()seuriopnudoptnmfes (f rra(mpoo4olx mocild m2ul( o;(4 exomo3oy1la eaneo ()s2xoirpnu1opt lnei t  2ta(moot0tpe  ietlt s2uln o;t4 lxnmr3totop eauei;(0 2xo(o3ou4lp nlnes s)srum( p;t0ole mf3tytfmDrln o;u4 rxoioctydlate n s ( srtmimpoy1ol nliciltfaDtaur no4apxoio3iltfsDuaumon(0 ltniociydoat  nvo;s  eumxopnu4op  lfciat sDuau ont4tpt  ociaslaDem(msnu)texriocto1fmt luvslt0 2xo(o iy4ol nlfetltfa2rm(rooo0tet  ietlt sDea(vpn(4arenxr3iydoa r n i;s  exoirpiu4apenmfcias srtrx p;t1tet io3iatfm uanmpnu)alenxrctatlat aies t0 ruoir3nodale mfeias)sDumxro;u1oexnmieilsla2rluvp u0 lenmr tytlp  an i;( trxr(o3ou4op  mnesl(  2ur(rpnu1apt  ictlsfsDemuvo t0alxrmr3ia1fpD aueo t)teuriopio4lmtnlncsl()s2rrxrpnt4ole  ieiysfm ulumo u)trerxf3oa1lpDr ieslt srur(o3oy1amt  feia( aDtmxmoou4aleo ociat s2ra(mo u)tlxoio iatfp  an ils0trur(m3oy1llenlieia()a2ua(  nt4teen o3iad mDraump u4areoio3oydfaD lnesl( setoir nudol nmneia(faDrr(r no0aex  f3iltfa ulnvs u4tlxoio tatfpDe ieil( sexmio3nu1amt lncilt) 2taurp;u4aeeo i3iys aDua(mp t0 etoxr3oa1lptrlueo t tetoio ou1lmeelfctlt)srum(  nt4tltomociatfa2umumon() exomfctytfaDeluvi;t) exoimpno1apen netl()sDuax oou0tpto oeiltfs2ua(mpnt4arxrmo3oo1la elueo (  rxrxmpnu1al  mnctlt sDumurpoo0aet  i3iad s2rau o u0trtnmr3oodlm  lu i;() rxrxrpiu4al nlfvtasfsDtau  nt1alto feiadfm2rmumpnu0tlermo tytopteln s s0 2xmxr ou4lmeelneil()sDur(  ou0aeen f3iad mDran s;u0 renxr tatomtr iei s t2xrimpoo1lmee nesat)aDtr(rpot0tleoio3tlt m rm( onu4 exrif3ta1oa rau o;t0 rxmxo no4ale mnvslt  rrrx oou0opx mfeiadlm ran o t4 etnxr3tydlpDr ivs;t0 2tm(o oy1op e ictlt a2rru  ou1oexo oetls s rmu ont0arenxf iatlaDrlnei ()srtm(m oodlptelivia(fsDraxmo;u1tpeo o3tldfa2umumo;()alerxf iytomteli ols0s2xrxr3nydaleemfcs t arra( o;t4tpx  ictldfm ea(vs t4 eenir oytop  lueo;s0trurxr ny4lmenmict ( srtmx  no1altomoctatlmDem( p;t4aetnmocia1opte neo;( srxoim3io4ol  lfct tfs2trxront4oexnmociysfs ua(vo;t0trxoxocoa1lpteli i ( trtrxr3oudll e fvtas) Dtm(mpot4tetnmfciatfm2umuvp (0trtrir oatom r iei;(0 2xr(o oudope  fvsasf 2rm(mo;u0tetomfeiytfm2ea(mont4 ltrxo iy1optr uvsl(0t2tm(opiu1aleelicia(  2rmx o;u0apt mfetat s2ulump (0teenifcoy1fmD anvils0truoir3nu1ll   ncsas  2uaxm ;u4alxoiietls m2el( s u)artoio3tytfmtraieilt  etoxm3ny4am  lfes t) Drr(monu4tee if3tatfa raump;() lermo3oy1fp eaivils srtoxr3nu4apen netls  rrruronu4alx  f3iadla2umump ()trtoirciy1om   iei ()t2trimpnu4lpenmnvia( a2ra(mooo0aetoif3iydlm2rl( on()trtnifciatfpteluvs;s0t2xrio3nu4ame  fvtas) Drax ooo1aee mieildfm umn o (0trenio3ia1oateluei;()srxmiopiydap nlivt s)aDra(root4tlxn o3tatfaDuln s;t) reoxrcoytlat li sl( s2um(r nu1ll  lnesas aDrauro;u4aee iieild a2uanmp u0 ltrmr ia1oa r ivols setm(o nu1alenlnci tfartmx ont0tex mf3iyd m uanvp;t)tetnxf iotfm e neo ()sexoiopiydll elfet (  Draxm nt1apxnmoctadfs2ua(mp t0treoirctadla rauvi t0sexoirpoo4optelivt t  rur(mp;o1teeniieiatfa2uau s;t4texoxr3oo1optrlues;s s2tmxr iu1llenlies s s2raxmono4apt ii3ilsfm2elnvs u)tleomr3oadlm e ieo t)trxmxr3oydolt lfeilt) Draumpnt0aex mfeiat m2umn o;u4 renxo3ootom rlnvi;(0trtm(o3oy1lle mfvtl( srraxr ;t4texoifciad m rmnmsnu)texoxf3iytfateauei t0s2tr(r3ou4op nlnvt (fs2trxmpnt1tpeomoctydfmDrmn p;t0 eeoxo3iatfpDr ieslt tetm(m ny4alt  ici tf 2taur nt4tet ioetld s2uaumsnt)texrmo tatfptelu o;s  rxmxo ny1am nmnesasfaruru pou1tpt mfetlsfm2eaumsn(4 rtrmr iatlaDe nes;() etmxmpno4om nliei tf 2ra( oou0tpeniieilsls em( p (4teenio3ty1fateln i (0trtm(m3iu1alenmnvias  Dra(m no4teeomfeiatfs rmu o;()trtnxo3iydlatraiei t  rtmxo3oo4al nmfctlt  Drmxrooo1altn f3tlsfaDumu pnt0alxoxf iadfmteln s;( srtm(opny1am elfcs ()arurx ooo4tleo ietltla2ranvp u0 lxomr3ty1lm rlivo;() rxmir3oo1lpte ictat)sDra(  no0opeo feiytla2rl( o;t)teermo ootfptr ieolt setoio3io4oltnlfetat)a2rau  ;u0oex  octydlsDeanvp;u) lxnmf3iydlmtr iesls  eurio oy1lm   feilt srtru  nt1teto fctytlaDum( s u4 ltoxoctadom rauvi s0 2xr(mpny1aleelnes s)sDurumo;o0aetnmoetldlmDum(vo;()tleoxr3ta1omteli olt teur(rpoydam nmfetls)arumu oou1tpx  fctlsfsDul(vsnu4texrmf tytlmtrlneo ()setmxo iydomeelfes s)srtmxm oo1aleniietasls2rlnvs u4treoxo ia1lpt anvols)t2um(r3no4lmtnlncsl(f rtm(rooo0tleoiieiyd a2ra(vsnt)tlxoircta1lptrlues s0t2xoim io4ope mfctas)aDraxroou4tetoiietas aDumumo;t4 rxomf3oytfpte nvilt)truoimpno4ll nmict s srtrump;u1oeto oetyd mDrmumo;(0trtnir3oadlmDe ivil(0s2xoxrpiodllee fciatfsrraxm no0tpx mo3tytfs2ul(mo t4 ltrif3oa1omteaivi;() 2uo(m oy4openlnvtas) Drmxrp;t0opx moeilt sDemuvont) lenmf ia1fmD  nvol()s2uoimpiy1lmt mivs (fsDtmu ooo0oeenmociys sDeau s;t)arxrir iotom elueolt0srxr(m ou1ome micsat s2ra(m oo0tpxnmieiad aDelumpn() exniocoy1fatr n ils)seuoxmpoy1amtelici sfsDra(rpno0aexnmfeiltfa uluvs;(4altomrcoo1lat  uei t0s2tm(o nodlle lneslt aDrm(  ou4opx  f3tlsfsDemuvp;(0 renmf oo1latr u olt)seum(rpoudap emivsat aDrr(rono0alxnmoeiyt a uanms;(4altnmoctytom eln ols)setm(r iydomtnliet ()s2ta(rono1oetnmieiatfm ua(mp;u)aeeoif3iadlate nei ( trxm(opio1amt mfvt ( aDurxr ou1teeomieiasfm2rlu snu)arxnxociy1la r i s (  2uoxr3oudaltn fes () 2ua(r nt0oleoiociatlsDelumo (4aexrmr tydla eaneo;t)seurxm3oydlme  ncta(  rrmurp;u1aetn ociltfs rmn p;t4artoio3iytfaDrlivo;s  rum(m oy1ole mnvs t)sDurx poo0apx iicilt a el(mp;(0tleomocoydlmtrai il( setr(m3iu1omtn ivs s)aDumxroou1tle ioeilslm um( pnu4 etnio iy1optelivi ( tetm(m nu1altemfetas)a2taxr ou4tpxn ociatlm2rmump t)texnmfciodoa r uvo ()srur(r3ny1lp elnesltf 2tmx  no4tet mfeilsfaDra(ms t0 etrmo3to1om elu i t)s2xmimpoy4op  lnvi s sDua(mont1aetnmi3iat s2ean p ()teenmrciadomte uvo t  rumirpoy1ll   fciatfarta(  ot4oetniietad a2rl(msn(4tetnxf oy1om rlu sl(0s2trio iydam  lnetls) 2tru onu0tlxnmociyslmDrmuvs;(4 lerxo3oo1fp eau o;s teumxo oudomt lnvtl( srum(m no0oex  feiltlaDrmuvo;u4 etoir oodfpDe u i;s teuo(o io1amt lnctltfs2uax o;t4oltomfeiys s2um(mo t)trerio3oatfpDe uvo s)trxm(rpoo4lptemici sf rra(mo;t1tptnii3iyslm em( p u4treoir ty1fa rlues ( srxrxr oo4lme lnvsa(f Duaum oo1oetomoeiasfa rlu s t4tlerxfciydopDr ies;t0srtrimpiy1al n fesls arua(r ;u4tpen ieiyslmDran sn() reoxf3iotoaDrai ils) rtoirpou4ame lfcilt)aDra( p;u0opxomoetysfm2uanvsn(4alermocoo1lm   iesl()seuoxm3iu1olee ictat)s2tm(rp;o1alt ii3taslaDeanvsnt4 eenmo iotlmD aueil(  exrxmpno1ameelnvs sf 2rrumo;t0opx iociadfmDrlu o u0 eerxf3oytopDeauesl()truoimpiudomt mies ( a2uaumpou4olxnifciydlaDelu o t) exomo to1om rluvil(0 rxrxmpnu1ope lnvsa( aDur( ooo4tpxnmo3iadfm ua(mon() ltnmrcia1omte ieo;(0 etmir iydomeelncsltfsrrrxro;o1olt mf3iad mDrmnvpnt4arxrmocoa1fm   nvs s)trtr(o oy1ol  liesltf 2trx p;u0tltoiiciadfs2ua(ms;()aetoiocty1fmD aies s0 etmxm iy4lp emfvsltfaDtrur nt0oetomociad s2uluvo (0tlerxoctatfatrlueo t)truoim nu1omte nviat)a2uru onu4olt iocilt a rm(mp (4aeerif3oo1om eaivol(  ruoim3io4lpt  netl() Dtax o;u1tex ioeiydlm2umump;t0 rtnxo3iodfptean olt srumxm3oudlptn ivilsf rtrx pou1apt mi3tytfm ulu s;u)aexoio iy1laDelivi t)t2toir oo1omtn nctatfsDtaxmpoo0tlx mfetlsfm rluvp;t) lxriocoa1lmte n s;s0trtm(rpiy4al nlivi t  Duru p;t4opxoioctltfaDrl( snt)altnif3iadoa  li sl(0teto(o3nodamte fvsasfaDrr(ro;o0altn iciad m2ra(vs;u) lenio ia1fmtr uesl(0trxmiopoy1lpe mncsl() rtm(moot1tptomieilsfm ulumsnt0alerxrcta1fpDrlu i;s  2tr(o3iu4oleelics s srrm(  ;u4ope mo3tlt sDeaumont) rxnif3iydfa   neol(0s2toir3nu4opee fvi (fsDurxm ;o4tpx mf3iaslm elu o;u)teenio oa1oaD ai i s sexmirpnudolt mnesa(f 2rrxr no0tlxomo3iat m2emnms ()tltrmf iytfaDeanvsls teuo(o3oo4lp   ivs t) 2trurpno4apt mocias a2uau s;t0trxoifcty1fp ran s t0 exr(o3nudll emfvsl(faDtau oou0aeto i3iltfa2elumsnt) rtomf3iy1la rlu i s)srumir3ou1om n nvtat)artaxmo;t0oeeoii3ilsfsDranvs;t)trxnmrcty1fpD  ieil( srxoio oo1am emfvsl() 2tax ont0aetoioeiysfsDrm(msn() eenio tadfp   n ils t2trio3oo1lmtn fcsat)s2uau ono4oeto feiatfm rmu p;u0tlxrmfciy1lpt anvo (0texr(r3no4omt lnetatfsrrrur no0tlen ociytls2rmnvonu4aeerxr3io1lpDranvilt trum(opou1lm e ictlt aDtmumpot4ope iietadfs umu o;u)trxoxfcoadop rauvolt0trum(mpiu1op elnei ( sDrrx  ;t0tlx iieildls ra(ms;(4tetrmo to1fa eluesl(0sruoxm3nu1lmtnlics t)a2uax pou4opx iociatls el( snt4 exriocoy1op  ai o;t0 euoir3no1ap nmfeta(fs2rrumont1tpeo i3iltlaDulnmo t)aexniociadomtrlnvol(  rur(mpoudol  mnvtl()sDurx pno4oltniieiat a elumon(4aexomfciodla   ivolt0truoimpio1opeemnvi ( a2tr(rpnt4aleoiociydla2um( snt4teermfctotla r iesls)t2tr(rpnudomtnmiesas  2trxro;o1tptn o3iadfa2rl(ms t0arxrxr3oodlmDrlu ilt)setmir3nodlp  mfctlsfsrtru  no4oetoifetat a2eln p;u0 etrir3totlaDr iei s0 rtmio3io1apeeliciatfartrx ono0apt iociatls rlu pn()trenxo totlptrlnvi;( trxmirpny4apt  nciasfsrra(rono0altoiicild a emu p t4 eenir3iodfp rlnvsls seur(m3oodlleelnci (f Duru p;o1tpeo fetysla2emnvsn()trtoxo oydop elneils0setr(m3oo1lmen ivilt) Durum nt0aptnmfetldlsDuau s;u0 rxrmfctatfat lieo;s0t2uo(rpoo4omenlfvta( aDumx p;u1tltnmfciydfsDua( s;(4trtnmf3oatlmtr iei;t)trtmimpnydoltnlncia(f rurxmpnt1olxnmieilsfsDua(msn(4 etoxoctotoaDe u olt)seurir iydlmt livtasfaDuau pou4olx ifcild m ea( onu4aexrif totla  ln i;s0 2um(r3nu1op emnviatf rra( o;t0altnmo3ias m eanvs (4tlenmf io1oa rliei;t0texr(mpio4alee fes s)srur(rpnu4aeeomi3ildfm ua( s () lenxfcoo1fmt an ils)seur(o3oo1ole  fcsltfa2tr(rpot4optoiietyt sDrmn p;t0teerifcoo1fm elnes;( teuo(m ny4oleemicsatf ruaum oo1oet ifetlsfa eln p t4tlermr ootfmDeaieols0srumim no4amenlfctls sDuaumonu0alxn fcias m2rmums;(4texnxfciatfatrauvils) euriopoudal emivtatf rurx  ou0altnmfctatfa elnmo;u0trxrif3ia1opt aivo;s0 rumir3nydlle lfct t) Dtmum ;u1aptnmi3iadlm2ra( pnt0texoxrcoy1fm r n s s) rto(opoo1lm nmfci t aDum(ront1texomoetadfa2emu o u0 eenio3ty1oa raneols0srtoim nydopt mieias)srrax  no4altoiietlsfmDumu p;() eeomo3io1fp raivi s srxm(r3io1lmen ivil(  Dtrurono1alxomo3iltla2umuvsn()arxnir tydlpteaivs s trxrir3nu4ol n neias)s2uaumonu0aleoiiciyt m ulums;(4altoxfciotfa rauvilt t2trimpoy4ame mfcs sfsDtmx  ;o1altnioeild s2um( p;(4aeerir oo1opDrlnvi;s)sruo(o ou4lp  mfvt () Drr(rpnt4olx  o3tatfsDra(vp;(0alerircio1oatr i sls) 2tr(rpio1amtelnvil(fsrrmu ont1oeeomfciasfa2em(mo;u0 rerxfcoodfpt anvs (0t2uo(o3no4al emfvta()arrmur ou1tleo o3iadlmDeau s (4teerxf3oydfmDraueols)setoxm ou1omeemnetat aDtrx  ;u4tpxo ictatfa2rl(vo;t) ltrif totom r ueo ()sruo(rpiy4alt  ivils) rrmxm ot4openioetad a emn o (0artriociy1om eluvo t  exmxm3iudomt  fviasfartmxm ;o0olxo ociyd a emuvsnu4 lermf oatoaD lueslt0 2xo(opio4altn net () rta(ro;o4oltoifcilsla umuvp t4alxomfciydfptrauvs t0seuoio iy1opee nei sfs2rm(rooo4oetn feiltfm rl( pnu)treoio3oa1fpt lies;(0 2uoimpoo4ll n icsltf rrrumpot1teto icilsfm rmn snu) rtrircoy1fa  lueol( trtmxo oudale  ics sfsrrrx ont1tlt moeias s2ranmon(4arxrirctytoa rln il()seur(rpoo4alen fvslt)s2umx ont1texn i3ildls rlnvp;t0 rtnmo3oydfpDrauvo (0sexoxo iy1amt mieslt a2rrumo;t0texomi3iydfaDranmonu0aexnxr3ta1oa raivs;s0 eto(rpoydlmeelfeta()artmx  nt0tlx mo3iatfs um( s;u0 exnio tytla elu o;t0 2xo(mpny1om n ivi (fa2ur(mo;u4aleo fcils sDrmu p;(0arxrxf oydla e i i t)trxrir no1altnlncs sfarrru  nt4olen o3iat a rauvo;t0 ltomrctodomDrai s;s sexrim ou1lmen fesl(  rtauro;t4aeenmoctas mDuanms;t) ltomf iodfmDeanes;t) rxoxrpoy1lpe  nvia(fa2rax o;u4optnmfetyt m2ul( p;t4 etoxo oo1oaD  u s;t  eurxr3no1altn fci (fsrrr(mpno1aptn ociys s2eaums () exoxf iotlmDr ivols) rxoim iodole miei t)aDua(  no4alx  i3ilt s em(msnu4trtnio oodfm r uei (0setm(rpio4lmt lfvs t  2taxmonu4texo f3ilsfm um( o (4 etomf todla r iei;() 2tm(r oy4lp n neil(farrmurpno1oltnii3tyd m umnvp t)trerircia1lateaueo s) 2xrxopiu4ap  lietatfsrtrx oot0tptnmoeild a raump;() ltrmrciadlmteauvi s)tetmirpnudalte nvsls  Drm(r ;t4aetomfciasfmDulnvpnt0 rtoxr3todfmt aivi s)truoim ou1apee nesatf Dumxrp;t4apeomi3tysfs2rl(mp u0 lxnio3oy1opt li ol(0s2tr(r3no1ame mieias) 2ua(m ;o4aeeo i3ias mDranvon(0tlermf iatlp  li ol(0 eum(o iy1ame lfeta( srrmxmpoo4oex ifcildfs rauvo (4aeenxf3to1om r ieslt)setoio3oy1lmenmfvias  2um( ooo4teeo ieild a2em(msnu4aeeoio tatlmDeli s ()trum(opou4ape  fct t  Dtrx ont1tetn fetadfs2um(vs;t4tetnio3iotomD  u sls s2toxmpou1op  miet t sruru p;o1aptoioctatlm2rauvpnu4treoxr totlpDraues s0srtoiopiy1op nmfeta()a2ur(mpoo0tpxnmieildls eanvs u)trxrmr oodoate ivils trxmir nudlpe mnctlt sDrr(r nt4oexn ociydfm um(vs;u4tlxoio iy1lpD ai s;t)trumxrpnydllenmfetl( a2trxroou0aexo f3tyd m umnms;() exnmo to1om  luvs;s  eur(mpio4lptnlneta(f Dtmxro;u0altnmociysfm rmnvont0alenif iotfatrauei;t) 2um(opoudlmtnlncilsfa2uax  no0olxn f3iatfsDeluvo;()aexnio3oytla eli i t) 2uoxo3ou1lleelneta()s2rmxmo;t0openmo3tytlm2ranmo u4aexrxr ta1lptrlnvs;(0s2uriopnu4omenlfctas) rrmxrpou1alenioeiytlm rln pn(0trxomr iodfpDranvolt0t2trxm no1op nlnctl()srtaxr oo4tpt iieiad m rmn ont) etoio3tydfaDe nes;( trtoir3no4ole mneil(  2um(r ;o1tetoio3ild m raums;t0tlermf iotoa eai i;s0s2xrimpno4ap n ictasfa2tmx pou4apx io3iadfm ua(vsn(4 rxrmf oadlm   n s t0 eurir oy1opeemivt t srumxmpnt4aetoiiciasfs2eauvsnu4artrir oydlp eaivi ( srtr(rpnodamen nvsatf 2ta(r nu4tetnmietysfs2ra(vp t0tlerxf3oytfatrlneils0srxm(mpoudape mici t)sDrm(mp;o4aleoiociydfaDrlumsnt0texnio oadoaD  nvo t0s2to(r ou1amee nciat)srrr(mpno4tle ii3ilslm emu o ()alenir3iadlptr uvo;(0 rtrxmpnodop   fctl()aDtmur ot0oeenmiciat aDra( snt4 lxnxo ta1om eauei () 2tm(m3iudlpt mfvs tfsDuru poo0tle ifciatfmDum(mo;u) exrxo iytlpteln olt) eum(m3oudome  ivt s)sDtax  nt0teenmi3iasls2rmuvs;t4tleoxf3io1oa  lueo t trtrxopio4olenmfct t  Drmx poo1apxnio3tlt m2emnvo (0tlxrmf tydfa  ai i s0 2xrxrpio4apee nvi t s2ururo;t0tpe  ietydlmDuau s u)arxrmf oodfmt aneslt0 rto(mpio1lptelfesl()sDuaxm nu1aex ioeiyslsDemu o (4 eerir3tadfateaneslt) 2xoiopoudalenlnvt ( s2ra(ro;t0aexniociasfaDuanvs;u0tlxoirctydfa eaueols)srxm(opno4omtn ncia(f rrrum no1tle  fcils s rm(vsnt)aetoir oytfp eanvi;s0 2toir3nu4aleemneia()sDrru ont4apeniociltfmDraumpnu) ltrir iydoatrlnvol() 2toxo3iu4omeemnciltfsrtrxmpot1tltn i3iytfa rmn snu0tetoxf io1laDr n ol()srtrxm oy1aptn nesls aDraxront0apxn oeiadfs2emnvp (0 exrmociodlmDran o;t0t2tmiopny4altemictl()srua(r ;t0aeeo i3iyt mDua( snu4aeenmr to1oatr nvs;s) exo(rpoydaptemncsa()sDrr( pou1aeto iciytla umu pnu)aetnmo oodfp eaivs (  exrimpno4amenmivtls  rum(mo;t4tlxn f3ilsfs2umnmo;(4texrxrciotoa rln i;()setoxo oy1ll elnvi s a2rrxrp;t4oexomi3tltfs2uanvp;u)tltomrciytfp  aivilt0seumiopio1amtemfctas)sDuaxr ou1tlx mictatls uluvo t0treoxfcootfa  lnvo s t2ur(o3io1ol  mfeia(faDumxrpno1oee  o3ildls2uluvs u0trtomfcoytfaD an s;( srumxr3nu4lp nlivilt)a2raurpot1alt mieildla2rl( sn() exrif io1oate ivi;t  rxmxrpiy4lptnmnesl()sDrrumooo4oet  o3tydls um(mo t)aexrir3oatlmD  ies t0 exoiopnudolenlictl() rumur ot4aptn feilsfmDran sn(4trxnio iadom rlieo;s s2uoxm3iu4omte iet s s2raxrpnu1apt mieilt m emn s;() lxriocoodla   ivs s  2tmir3iodom n ict s)arrau pnu1opxomoeiad s ra(ms;(4aeeoxf totomDrlnes;t  exm(opno4open fcsas) rurx  ;u1tle mi3iytfm2um(von(0 rxnioctadfaDr nvil()t2xmim iydalee ivia( a2rax pnu0apeoif3tltfmDul(vsnu)aetoxf iodopt lneslt t2xrio nudlpe  nvt s aruaurp;t1tpxnmf3ilt aDrlnmpnu)aetnmf io1omte n ilt0srumir io1omeemncta()arraxrpou4ole if3iyt m el(vp (0 leoxf3oadoaDeaies;( srumxopnudalenmivils) rtmum oo4opxo feiasfs rmu ont) etomf3iy1lmt ai sl( srtr(m oo1al  mivil( s2ur( pnu1aeeomfeiydlm ranmonu0tlermocio1lmDr ivslt s2tmxm oy1llee neia(  rrm(roou1openiiciad sDua(ms;u) eeoxo tydlp   neil( t2to(m3nodlmeemncs (f Dtmu pot1teto oetasfm2ua( p;(0teeriocto1lpt aiei;t0seurir3nu1op nmies sfsDtrxmpou4apen oeiytfa rauvo;t)tlxnxfctotfaDeluei;t0 2urio oy4lp e ieil(fa2rax  ou1aeenmfciydls2ul(vs;(4tetomf3oodlptrai sl( trurxopny4op emnvs sfsrurx o;u1tex mfeiat a2ranvs t0 exnmo iatlmtelies;()sexoirpoy4lmt  neilsfsrraxroot1olxniietas a ranvpnt4 exnxo3iotoa   i o;(0 rxrxopno4olt  fvils)sDumx  oo1altomfciytfs2ranvs;t0tetoxf todlaDrai o;s0seurxmpiu4optnmfcsa(f rta(mont4oexnio3iysls2rl( snu)trxrmfciydlmDelneo t  2toxopnodap nlfcil() ruax o;t4oee  o3iyt aDrmnmpn(4 rxnxr3iytomD ln o ( t2umim3nydll n icsatfartmxmpnu4ope ifetysla2eanvsn(0 lxomf3iytlp  livolt tetoirpiu1lptnlict sf rtaxrpno1oeeomf3iad sDuanmo;u0 ltrmf iy1faD  ieo t0 rto(o3nu1lptnmivs tf 2ua(monu1tetn ieiadla el(ms;(0tetrmf oo1fmDranvs (  etrxo3ou4lpt  iet ( srtrx o;o0aleomfeilt s2emu p;(0arenmocoydopD livo s)texm(mpny4ol nlnvs s a2rmx pnt1ape  octadls umump;(0 rxrifciodoaDeaueil(  rtm(mpoodap e ivias a2tr( ooo0oleomieiytfsDrln p ()aexrxo3oo1fmDeai sl()s2xo(r3iu1alte nvil( aDrmx pnu0aeenifcildfsDel( sn(0tlenmr3ty1fa e iei;( sexm(o3io1am   fvil(  2trxm ;o0tlto f3ildlaDrmump;u4alxomf3iodoatrli i;() euriopiy1lp nlfei t s2uax  oo1tetoioeiltfmDrm(monu4 eeoxr3ty1fpteluesls)s2xo(r3nu4lmenliet ()srua(m nt4tlxo feild s emnmp u0 eeoxrcoytlpDe iei;s)sexmiopoo1om  lics sfaDururonu1aet iociydls rmnvsnu4trtrir3todfptr nvol(  2trxr3iudaptnmnetat arumxmo;o4tltn ieiytls2umu on(0aetomf iytoatr ivslt seuo(mpiu4opt  feta(fs2rrx pot1oltniictasfa ulnvs t0 leoio3totop   i i (0tetm(r3oo1ap  miviltfaDtr(r ;u0openmf3iyt sDea( onu0aeeoio3todopt aivs ( t2xoxo3oudlp  licsl() Durx  nu4tlxn octadfm2um(vp;()arxomoctytom e n i s0teum(m oodomtnmivt t arrmxr ou1teto octas s elnvsn(0aetoifctodlp   i o;(0teurio iudame  iei (fartaumo;t4apxo i3iytls ulumsnu0aeeomo3oy1oa raiei (0 exrim iudoltemnct sfsrtr(r nu0aee mi3iyd s2raums u4 lxrmf iytfatr ueo;(0srumir oo4amenlfvtl(fartmuro;t1tle  f3tld m ea( p u0arxoxo3ta1lmDrlivilt  euo(r3iy4amen ivt t a2rruro;t1oleoioeildlaDuln o;(4tleoir3oodfp rau s () rumio3no1opeelfvt s arrmxmooo0oexnmf3tydlaDumn p t0alenxf ootfmDeln i s srtr(r3iudaleemivta(  rtm( p;u4alenmoeiadls umu p t)artoif3iytfpDrln ils0t2xr(mpoo4op emfvtlt s2rr(rono1apt mietasfsDulnvpnt4teeomf3oa1fat anes s0 rxoxmpiydlpe lictatfaDtmx ono1apxnmi3ild a ea(vs u4trtnmf ia1opDe ivi;t)s2xrirpnu1ap nmivtls) Drrxmono4tlx moeiatlaDeluvp (0 eeriocio1optrau o;( srumxm3ou4oltn iesatf Dur(m ;u1tee  f3ildls ua(vont0teenir3iatlaDelu sl(0 2uoxm3oy1ol nlfcslt  Draxm oo1tpe mi3tatlmDem(vp t0texomfcoytfmtranes t0t2toxmpou1opte nes sfsrta(m oo4aexoifeiysls2umn ont4aexnir3tadfmD  uvi;t texmim oodapen fctas  2trxro;t4altomiciaslsDemnmp;u0 lxoir iadoa eanvi;(0srxmimpiydopt lfvsat)aruru ooo1ope  fctld a umn pnu4aleomoctydlptrlneolt  exmimpoy1opt  nesls)aDtrxm no1apxo i3ilt a uauvonu0aexnxfcoytoa  lu i (  rur(r nudllt mnci sfarrru  ot4alx iocilsfa ulu snt) reoxfcoytopDe i sl( srtrio iu1llt mies t  ruru oot0aet  f3ilsla emuvs u4 rxoxo3oodfpD livslt) 2urimpiydope  fetat) rtmx pot1tpe  oetyd m2em(ms t4trtomocoytopDean olt) etrxm3oy4lltnmnetatf rrr(  ou0alx iietytls eaumo;(4 rxoxr3tydfatraneslt)sexo(mpiy1lm emnctatfsrururpoo0apxomoeiat m2umuvo u4trtnmo iodopDr i ils  rumir3no4lpte nvi t sDrmx ont4tetoiieias m2eanmo;u4alxomf3ia1opDeanei t s2triopiu4ol n iet t)s2raurooo0ope io3ias a ua( on()teenmo3iytomDrlnvo ()setr(o ny4ap emnctas arur(ront0aeto octadlm2ranmo (4alxoir oatoate u sls sexm(r3iu1altnlietls  2ua( pnu0openifetldls2rmnmp;(4tlxrxocoo1oaDean i;s trxrim3iydal emfvia( aDrrx pnu0alto i3tlt m rmuvo;()aetnmrctatoaDrlivi (0texr(opny1llen fcsas)s2rrx  oo1altn ieildlaDem( pn() etomr3tytomt aneo;(  rtm(o3iodapenlnetls sDuaump;t0tlen f3tadfmDraumo (4aeerxr oadoptr ivi;t  2urxr3ou1ap nmfvtls  Draxrp;o1aetnmi3iltfsDrmump;(4 rtrxf3ootopt an ol( s2trxo3ou4apeelies s aDrm( poo1tlen iciadfs um( pn()tlxrmocoydoa elnei;s0 rxrxrpnydamenlict tfsDtr(mont0apxniiciydlmDum(vsnu)artrmr3ia1omDelu o;( trxo(mpnydam  mnctas)aDrau poo4tltnioeiyt s uluvs ()arxomfcoadlat lieo;s0truo(rpio1alenmieiat)aDtmuro;t1apenmiciad mDeauvo;u0aleoxfcia1omDe ieo;t  rur(rpnydomtemneiltf 2raumpou4olt mo3ild sDea(vo (4alenir totlptr n i;()t2xmim3oydll nmnvs tfarrrxrpou0tet mi3iatfm2uln snt4 ltomf3iydfa ran ilt  rxr(o oo4llen fcslsfartmx ooo4opxomf3iltlmDrmnvo;(4 reoxo3ootomDrauei;(0seurxm3iu4al  mictl()srur( p;u1tptomiciydfaDea( pnt0tlxnif todfa r uvo;s  2xm(mpno4alee neta()artmx onu4texoif3iad a2emu s u0tltrir tydfm eauvils) 2trxrpnu4opt micsatfsDra(mp;o1openmoeilt s em(vp;u)tlenif3oatomte u o t)trtrxo3ou4amenlncsas  rua(ro;o1optomo3iad m2uln o (4aeerxr tatlmt li slt0 2xm(o3ny1ol nlfeiat)s2ua(rp;o0tltniictyslmDeanmpn() rtnmr todopDrln s s s2xrxr io4lm  lfvt (faDtru o;o4aptomo3tad a2emump;u4trxomf ta1lpDeai sl() 2trirpiu4am emnesas)arurumo;o0altoiociyslaDrlnvo;(4tltrxoctadfmtelneo ( t2urir nydlp elfcsat aruax o;t0alto oeilt aDeanms u0trtrmf3oo1lp   neols  rtrir3io1amen nvt ()s2umurpot1tetnifctysfa2rmu snu)aeenif tatfpDelueo (0tetoirpnu4am elncsat  2rax o;o1apt  f3tldfa2ua(mo;()teeoxr iytfa raueolt0s2triopoy1ol nlicslsfs2uaxmo;o4aexnioeiadfa emnvs t0aeerxr3oytfaDr uvolt)truoxo3iydlle lnvi ()aruau pnt4tpxo o3ilsfa rmu onu0altoio3ia1oa  au s;(0 exrxo iu1amenlfci (faruau  ot0tlto fciysfsDrmnmo u4arerxr3oytlaDe u i ( s2xrxmpiy1am elics sfsrtm(moot0tpx ioetys m ulu o (0trxnmo3totop elu i;s) eumxopoo1lmtn nvia( srtax pnt4aeeo o3tysfm uluvs t4 eerif tydfmteai s;s0trtrio3oodlpe lfei (  2taxmpot4openmoeiysfaDuln o;t0alerir3ty1oa   u o;t tetrimpiudop   neiat srtaurpnu4opxomo3iydlsDranmp (0alenirciy1fpDr uvs;(0 2uoxo3no1apeemfvil()s2raurooo1tpeomieilsfs2eauvsn(4aeeomociadfmDraueo t0s2xrxrpio4ome mfesa() Drmu o;t0alenmicias aDeaums;u)aeeomfcty1faDrlnesls0teurxm3iy1om elicsltfsDtax pou0tetoifeiyslaDemnvont0trtrxf ty1om r ivi;s)texm(r iydlm emfviltfaruru ont0oee mieiydfa2eluvp (0tltrxf3io1lp ranvs;t0s2tmimpnydap nmfeil(fsDtm(mont4altnif3tltls elnvo;t0aeerxociytopteli ilt)trtoiopoodlpeemfet tf 2uaurpnu1tpxo fcilt mDrm( s ()aetoif3oo1omDr ueolt t2xo(mpnu1lm  lnvs t  2uau poo0tlx ifeiatls ua(von()artrifctatoaDeli s;t  exo(m no1lpt lfvtl(fsDumx  ;o4openmoeiltfmDuaumonu0 lxnifcia1lm rau i;( t2xoim3iy4lmt  nviat) 2uauronu1opx io3tysfs2ranmpnt4 lxrxfcoa1opD luei;()setoio3oodape miesasf Draxm nu0opeomoeilsfa umuvo t0tlxnmfcootfm ean o t srxo(mpnudal nmietl(farrr(mpnu0aexomietldfsDel( snu0 eeoif3ia1opt  neo;() 2uoiopnu1optelfvia()artru poo4oex ioetytfs2eanvo (0 exnir iadlpDelneo;t  rtmiopio1oltemfctasf Dtrxmono1olxoifeilsfmDrmuvo t) eeoxf3iatlmDeli s t0srxrxr3io4lltemicia(f Dtru pno0olenif3iydlsDrl(mp t) lerif tadfp elues;()t2uoir3iu4lptn fci s)aDrr(moou0optoifctlslm uan o (0aeenxr3oy1lpteluvils  euo(r3oo4al  lfvt t)a2tr( ono4alxomi3tyd mDuluvs;t)tetnxr3totoateanei;s teur(m3ny4lp nmfvsatf rtaurpoo1texo f3ilt sDrm(monu)aexrmfciadfmtrlu s;t0srxmir oodapenmietat sDtau p;u1oeeniociytfsDemumsnu0tetnxfciy1latr uvo;s)t2tm(opoy4ope  nesas)aDraumonu0aeto feiltfm rlu s;(0 leoircoatla e uvs;s0srtmim3no1ol n netat)sruaxm ;u1alenif3tadfm uanvsnt0alxrmf todfateanvi;( s2xo(rpoodllt lfvs t  Dtau o;o1tpe mocilsfs2emu o;u)alxomo ty1oatean i (0 rxrxo nodop n ict () Dta(mo;o4tle if3ild s em(ms;() leoxo ta1fm elu sl(0trtrirpnodopenmneiltf Drau  oo0tet  f3ild a2elnvp;() rtoxr3tadlaDe ues s0tetrir3iu1op e fes s  rtrxroot1tltn f3tyt a2eln snt)alenmfcootom rlnes t srtoxr ny4ol n net s  2rmu  ;u4tlxnmfctls mDemumpn(4 etoxr tytfaDeaues;s)tetoim ny4lmen ivsls arrmxm ou4olen i3iydfa rm(vpnu)texoxfctotlmD livols srtoxr oo1lpeelieil(  Drau  oo1apxnifeiys a2ul(vo (0 lxrmr3oatfmt livi;(  ruo(mpio1ope mnvsas)arua( onu4aexn ocildfa2ulnvpnt0arerxr tadfpDeauvi;s0 ruo(m3ou1alte ieslt arraumono4apxo o3ild a2em(vp t0alxrmf totla  li i s srxoxo3iy1al nmnvta()s2urx  ;u4tltn fciatlmDemu p;u4alenir tydfpt  n ol( teum(r oydop  lfvtlsf rtmumo;t0oltnmociysfm um( p u0 etrir oodoat auvo (0 exo(o3nodomtemnvslt  Drrumpou1ape moctltfaDumuvsnu4arxrmrcta1laD ai ol()tetm(mpou1ll nlnvia()sDumumpnt4oetnmfcilt s uanvpnu)alxrxo3iodfpDe u o;(0trxoim3iodlle mivs s a2rru  ;t1alxnio3ildfsDran s (4 rxnmo tydla   nvols0trumxm iodop  lics tfsDuax pot0tpen fciydfaDem(vs (0 rxrif totfaDrln s t) 2urxr3iy4lpte ivsltfa2uaumo;u1tltnif3tat s ulumpnt)tlxnmf tadoat aivo;()teumir3ny4am elnet t aDumxr oo0alt  i3ildfsDum( o;(4tetrxocoa1laDe iei;()setoio iydomenmfctatfarta(ro;o4aptn ictyt m2ua(mp;t) rxrmrcoytoatraivo t0trum(m nu1amee ncsltfa2ta(r ;t0oeeomi3iadlmDemumont)tltrmr3oadomDe iei t) rtoir no1ll  lnvta() rtmxronu1teen i3iasls2uauvsn(0trxoir3iydlmDelu o;s0setoio oy1llee fcslt)a2rr(  nt4olenio3ildls um(ms u0tetoxr3oa1faDeau sls0s2uoim3oydameelnvs t)aDrru p;t4apt  feiatfaDra(vs u) eenif totfaDraues;t  2xm(opoy4alt lfesa(faDtrxmo;t1oee mfcilslaDulnvpn(4aetrio3oytlptelivo;t)trxr(rpny1lpen icia(fsDrmx ooo4tltnioeiydlsDemnmon()altomrciy1lmt an i;t)s2xr(o3ny4optnmivi tfs2ta(  no0opxniictasls rmuvs;u)altoio tytla eaieslt0t2um(r3nudlmenlfeiat) 2rmu  oo4oexniictaslm2em(vpn(0 rxnmr3iydlp r i i;(0t2xmiopno4lptnmnetatfa2tmumpnu1apenioeiasfs ul( o u0arermrctatfaDrlnei;t0 etr(o iudole  nes s)s2taurpoo1apxoifeias aDel( o;(4aeenif iadlaDrlieo s) rurxo oodll n ncsa() Dra(rpou1openiictlsla ua(mo (0teeoiocoytfm  anei;s t2xrirpnudop nmfct t)aDtr(r nt4apt ifctadfm2rl(vs;(4artnirciatfm  lnvi t seum(r iydlltemfcil(  rrm( ont1texnmfciatfs uanmp t0 renircoydopD lu s;s trxr(mpio4lm emnvtasf Drruront1oee  o3tas a2ranvo u4trerxr3tydfa e i o t srxmxmpou1lmt lncsls srrrxro;u1aexnmfciltlmDrl(ms (0 rtoif todlatrluvslt)texrio no4omtnlfesa(fa2trum ;t1olxn icildla rlu s;(4 lxrmfcio1fmtelivs;s0trtr(opiudam e ivslt) 2rax  ;t4aeto f3ilt m rlu s;t4texrxr3tytlmDrauvil() rtoxo nu4ol nlfet s)s2tmxrpoo1tltoiociysls2rau p (0tltrmf3oytlpDe uvil( sexr(m3ny1lm   nvsl( s2rm( p;o0aexomfetadfaDuau snu) lenmr iodlmD anes;s)s2uoxo iu1altemfet (f rtauro;o4tet mfetyd s2elnvpnu0 exnifciatfaD anei;t trtoxr3ny1ll   nctat) Dtaxr nt0aptnifctysls um( p;u4tlxnxf totlaDe nvilt)sexrio3io4lpe lfcils)arra(m ou0olx mociyslaDuanmpnt4 lxnir3tatomtr n o;s s2tm(m iu1lle  ieiat sDrr(  ;u4tptnmfeiydls ra(msn(0alerxr tatlaDranesl(0tetrio iy1olee feiasfs2rmx pot1apeomiciat sDelnvp () ltnxr ta1opDelnes;()setoiopnu1lme lneta()arua(m nu4aeen icias a2elumo u0tlxnio iodlpDr i ilt)t2toio io1altelfvias) Dur( ooo4tee mictadlm rauvp;(0tlxnir3to1fptran sls0 rtmxm3oydop e iei t)artm(rpnt0teeomi3tlsfm ulu snu0alxriociotla  lieol( texoxmpiydlptelict ()a2raurooo0opeomoetad sDrmnmp t0tlxrmf3todopt anvi s srum(m ou4ol   ivta()a2trxmont4aexnmfeilsfa rau s;t)arermr io1fa rauvil()sexrim nu4op nmfesl( arurum ;u0oexoiieiytfsDrl(mo ()tlenmr ty1la elneil() euo(r nodop nmici s srraur ;u0olxnmociadfs2ran o u4 rermf3tydlpte ivs;s0 etm(r no4olteliet ()sDuaxm oo4texn o3tydfm2um( p t)aexnir3tadfpDeanei;s trxoxm3oydom  mnei sfaDrmu  nt1aeeo feilt m2ulu s u4 exrxf3oatlatraueo;t0texoxr oo1alee ncslsfa2uaur ;o4olxomo3iyt m rmnvpn(0aeenmoctotfaD aieslt)trxoiopoy1omeemnetls sDtmxm ;o0tlx mfctadla2rmnvo;()aeeoir3iotfp r nesls0seuoir3nu1lmtnlicsltfsDtm(  ou1oltomoeiytfs2elumo;t) rtrxr tadlatraivilt) rxrir ny4opt  icilt)sDtru p;u0tex  iciyslaDelumpn()tlxnxr3tatfat lieols setr(m3oo4op elncilt sDum(mp;t1tet  ictytlm uluvs u)alerir to1opD  i o t) 2xmim3io1ole livil(fa2taumpno4apt  fcias mDrlnmonu0arxnio3iydoaDr nesl( srtmxm nudalenlnesa(faDtr(  ;t4aptn i3iadfa2ean s t)altnxr tatla ran sls trumirpoo4omee ici s)s2uau o;o4oexo fcilt m ean o;()aetnmo totfateaueols) eurim oy1ale  ici () rrrur nu0opx  o3iytls2emu onu)tlxnxf iytoat lu s;(  2toxm oodop  mivsas)srumurpou4tleomi3iyslsDemnvonu)alenmfciatfm  lnvsl(0truo(m iudol   ictat  rur(m ;t0olx mociat m rl( pn() exnmfcta1op elneo t)setrxo oy4lp elictls aDta(rp;t4optn f3iyslaDua(mp;u) etnir tydopt  neols)s2umxmpoy1amte fvt ( sruaxm no1oleomoeiysfaDrm( s (4altnmrcto1oa eaiei;t)sexrxr3io4ol n nvtlt)artauronu0tleomfctasfmDrmn s t0arxnmr iy1op eaneo;t0 eumxr io1altemfet ()s2raur oo0aee ii3iytlaDran p t0 rtnmf tytfmDeau ils0texr(rpoy1lptnlnctat)a2rr(  ;o1aetniiciydfa el(mont4 ltrir iydlm raneil(0 rxoimpnodlpt lnes tf Dtaxr oo1apen i3iysfm elnvo;u4tlxoxr3iatom r i o;t)t2trim3iudamenmfetat) 2trx  ou4oeeo i3iys a2rlums;u)aexrxf3oodfmt  ivi t)sexoiopou4olt licsas)a2umur ;o1tlx mfciydls rmn s u4 etrxo iytomDr uvs;s0 2xrirpou4ope mfctatfsDtrx  ;o0tee miciytfaDelnvp (4 ltnxrcoodfaDraivol(0sexr(rpoo1lm  mieilt)aruaump;o0oeeniociytlm2emnvp t0areoif3todlpt au o t0 2trir3oy4olenlfet (farrm(mp;o1oleo f3ildfa2ulnvo (4 etnxr tytfaD li ols)texrimpiydomee fvtas arrrx onu1oex iietadls2uaump;(0tetoio to1om eaivs;s  exrxrpoy4amen ivsa(fsDtrxroou4tpxnioeiatlm2emu s;()tltrxf iadom eaivi;t t2uo(mpoo4al e nviat arrax o;t0tpt  f3tys m2elu s;u) exoiociotop rai ols)trtr(mpnudapte ivt s arrrxronu0apx  i3tldfs ra(msnt0aetnxr tatoa   ivo;() eumxr oy4apee nvtl()s2tr(  nt1tlx iietlsfs ranvo t) eenxr3todfm rlneol(0teuo(r3ou1ap e nciatfsDrm(m ;u1tleomoeiysfa um(mp u0 etoxociatom   ivi;s t2xoimpou1lm e fvsl(fs2rm( ont1tpe  octlslmDrlnvpnt0alerifctadfaDrlu o t0seuoim ou4ame  netl(farrr(m ;u4olx ifctytlm umuvs;(0 rxrmo tydlm r u o;s0s2tmxmpoo4ale mivtatfs2tr(rono0aptomfctldfm ra(mpn() etnxocoadfaD  ivs t  rtoxr3iu4am nlnvi t  rua( onu4olxomo3ilslsDumuvp;t0 rtrmo3oadlpDe nes;s0t2xrxr oo4amen ncsltf Drau  oo1olto f3tyt m uln s u0alxoxf3tydlpDrluvslt0texmxrpiydapen nvs t)srrax  ot1aetnio3iltlm2ua(vont) rtrmr3oodoaD  nvi;s texmxo3io4lle  nctls)sDururp;u1olxnii3iadfsDum(vs ()teerif iadlateaneo ( setoimpiu1aptelncias  2tm(r no1opt mfeildlmDrm( o t4 rxnirciytfmt  uvilt) ruoxm ou4altelfet s aDrau o;o1tex ii3iysfm eaump ()tltrxo3ootoa r n s;t0setr(mpiu1apen ivi (fsrtmxrooo0apxoiictldfm ul(vpnu4 eerxfctytopDelnes t)srxrim3nydapen fesltfsrua(  ot1apeo o3iaslaDul(vp u) etrxf iotfpte ivs s)teur(m3iy1llt lfetlsfsDtm(mo;o4tex ii3ild m2el(mon(4arxomfcoa1opDeauvs s texrxmpnu1ope mnvslsfa2rrxmoot4aexoioctytfsDua(vo;u0 rtnircoodfp e n s;s0 eum(mpiudopt  fes tfa2trxm nt4olto ieiat a2umnmpn(4tlerxfctadla e i o;( seumxr iydalenlieslt aDtrxro;t1tptoii3ildlaDulnvo ()tltrxrcoytfmDe ieo () rto(r3iodal  lncslt) Dtaumpot1tpxniictatfa2raums;(4artrmf3oa1faD an o s0srumim3oodoltelncias  Durur nt4tpxoiocild a2ua( ont)artnif3oadlm eluvilt0srtoim3iodop  micilsfaDra(r ot1teenmi3tls s2ua(msnu4trtoxo ty1omteaivs;t srxmxr ou1apeelfeil() rta(mont0tetomf3tltlm2rl(ms u0texrmfcoadoa  lnes;t0t2um(o ou4ap   nvsl(  2raumo;u1aexn o3tadfa2uanvont0texomo io1la  lieo t0trxmiopio1lltnmfvsls) Drrxrp;u0tlenif3iatfm2rmnvon(4 lenif to1om  livs s tetr(rpoydoptemfvilsfs2ua( pot1tlxnmoeiaslm uanvs t4aeerxf todop r i i;t0t2xr(opiydamt liet sfartrumonu4oleoif3tld a ea(vs;u0alxnirciatoat an s t0 exrir oodomt lfeta(faDtr(roou1apxnmfeiltfm uanvo () exnmf3oo1fa e u i;t teur(r no1om nlnet t arurumont1tlx  oetyd s2ul(mp (0aexomf3iodopDelies;s  2urio iu4alt mfvsasf 2ra(m ;u4olenif3ilslaDemn s u4 lxrmocoytomDrauvs;()setoimpiodapt mfvi () Drmu onu1tpxn iciyslaDulnmo ()tetomociodoateanvs;t) rxr(r iu4olt lfvsl() rrm(  ot4ope  ociadfa eanvs;t0 lxoif iy1omDeli olt texo(m3nudlp  liet ( s2tm( oot1tleoii3tytfmDrau p;t)aetrmociadlaD  i i;s0teum(r3ou1apeemnvils srtm(  ;u4olxniicilsfaDulumont) eenmo iadopD au o (  rxoxo3oy1ope  fesl(fs2rrx p;t0alto o3tytfsDea(monu0 exoxo3totfaD  u il( srur(o3iy1am e ics t srtaumo;u0apen ietas a2ua( s;t4aetnmf oo1latelueo (0setmim iu4lme liciat)srrmurono4aptnmieiytla2elnvp;t) eenmrcto1fptrauvo;s0s2xmxrpnodlp emfet t) 2ta(m ou1apxnmictasfs eaump;u)tltoxr3iatom ranvi t)seurir3nu4am n fcs ()sDta(moou1aptomfetytlm ulu p;(4aeeomf tytomDranvol() 2tmir no1alen ieias a2rmumo;o0aleniociytfsDean snu) ltomocoy1oate nvi (0 2xrimpiu1ll nlnvsa( srraxmonu4ole ioetatlm el(vs;(4 ltomrcio1oaDeli sl(0t2uoxr3iy4al  mivsatfsDrauro;o1oexniocilt sDumu p;t4trtnio oy1fpD  i s s srxr(opnu4om emnes (faDtax ont0ape moeils s rl(vs;() lxrmo3oo1lmD aivi (0trtoxr nudlmee iet sf rumxro;t1aptnmf3iad m umump;t) rermo todoaD li sl( teum(o3oo4olee fcsl(f 2rruro;o1oet ioeilsls emumonu)arxnxr3ootla elies;t0s2xmxmpiudlm elici sfsDrr( p;u4tltnmociys m2eluvs u4trtnmfciy1omtrluvi;t0 eumir iy4op elncsl() Dumuroou4opxomo3iltfm ranmpn(0aexomrciodop eauvolt0tetoimpiudolee iei ()aDraurp;o4oetoii3iadlsDraump;t4altnifcta1lm ranvs t0trtoxr iy4ol nmictasf Durxrooo4oeenmf3tld m emnmo u0tltrxr oatfmtr uvolt0 etrim3iodlm nmfvil(fa2ururp;o4aexn i3iytla umnvs;(0 eermociydfate n olt)teur(rpno4olen fvt () rrax ooo4aeen i3iydlsDul(vp;()areriociy1fmtr ueo t0s2xrxo3no4olt lfci () 2taurpot1tpenmfctad a2rl( p ()teenir totlp rlnvo ( truo(r oydllen fvil(f rtau ont4alx micilslmDrmuvon(4alerifciadfm ranvo (  rxo(opio4optn nvi tfsDumx pnt1tpeomietytls uluvp;u)artoxf3iytlpteaieo;t)texoxm iy1aleelnei tf rra(rpoo1alxnifetld mDrlnvs;u)alerxocoatomtr ueo ()s2tmiopnudal elnet sfaDrrxmpou1ale iiciadfa2rluvs;()trenmo iodfptrai o;t)teuoxm3oy4alt  fetas) rua(m ot4teeo ictldlsDranvonu0teerif3oo1laDranes;t tetoir ou1omt  fvi (f rtaum nt4tlxo f3iydlsDelnvs t)alxoircoa1fm rauvilt0 2umxm3no1oltnlieilsf 2rrxro;t0oltn f3iyslmDem( p (0 ltoxocoo1laDe nesls0s2xoir3iy1amte ncsatfa2tmxmont0opxomf3tltls eanmo t) reoifcoydlmt lu o;t)s2urxo ou4opte ies t)a2rr( ont4ole ifciatfa2emn s;t4tetnmoctadopt ln i;s setoxrpnydal nlnesls aDumur nu0aptnmf3tadfm ulnvs;()artrxo3oodfateaueo t)s2tm(rpny4apee nciat srta( p;u4texn o3iatfa2elu o;u4aetomociatlp  ln o;t)s2um(o oy1lp elietl(fs2tmurpnu1oetn ocildlmDumums;(0texrio oo1fm r nvo t sexm(r3nydapeelivt sfarra(r no0opxomietysla2uln s;(0 etoir oy1fmte uvil(0teur(mpiu4ope  fvta(f Dtrx  ot1apxomiciadfm eanms (4texrifciodomtranei;(  eto(o oudllenlfcs sfa2trxmoou0ale ii3tlsfs2uan s;t) eenmo io1lp rlnes;t)s2xmxo nudamee feias) Dtaxmpou4ape ioeild m um(mont)aetnxfcoa1fmD  nvi;s s2xm(opoy1op e ivilt  Dum(m no1tpxn i3iat a eln o u)aleoir3tatoptelies t) exm(m3ou1ome mivta(faruau  ;t0optnmieiytlmDeauvsnu0trxrircoatomtrlneo s s2xoxo oydlptemnci sfs2tmu oot1apeo iciydfmDumnvo u4arxnxr3oy1oaD luvo;s0 2uo(mpio4lp emncsasfsrtrxront0oltnio3tldfaDem(mpn(4tlerirciatom e uvi;s0texrxm3iodopt mnvt ( s2uaxr ot1aetn feiysfm2ea(msnt0alerir3oatlpt luvo s0trtm(m3nudopeemfetat srta(moot1apxoiieiatfm2elnmonu)texrmf iatopDrai s ()s2tmxmpnudlpee ivs (  Drrxm no1oeeoiieiyd a uluvpnt)alermfcootomt luvi;(  etm(m oy4lmtnmneiltfs2trxmoot4tpeoifciat m2rm( o;()aeerir3oadfp rliei;t)srtoim iy1op   neiatf Dtr(rp;t4opxoio3iasfmDea( s;t0 rxrmrciatfpt  i il()seumir3iydlm nlivt s s2ur( ont4tpt ifciys m2rl( p;t) rxoir3tytlaD  uvs;( sexrxopno4lle lfei sf 2ra(m oo1tlxoifetlsls elnmp;(0altrmf iytopDe n olt)sexoiopiudaleemnvtlt)arumuro;o0tee  ieildlm ua(vo;u4 rerxrciotfmtrau o;(0 2tmim3ou1om   fctl(f Dtmxrp;o0altn feils a rlu s (4artrir3iatfmteluvols)srurxo no4lmtnmivtlt srur(mont0olxoiictytlm2rmumonu0aexrmr3iytlm elueo;t)s2xrxrpou4omtnmfvta()srra(mpnu4alxn ieiaslsDelnmp t4 reoio ty1lmtranvs (0srtrim oo1amtn fesa() Dra(mp;u1opx  f3iyt m rluvo;() eerio iy1op   ies t s2tmir3iy1opee iesatf rtrurpno4teen i3tatla ea(mp;u)teenmr to1oa  aieo;s teurim3oodal elfvt t sDumumo;o0oet ioeiat a umnms;u4tlxrir iatfat aivs t)tetmxm io1amtemivi (farrmx pot1apxnmf3iaslmDeanvo;t4 rtrioctodfp elueols0sexo(opoy1ope lfci ( aDta(rpnt4aptoii3tas s2ul( o;() lxnmf3oy1op e i o t  rtoio ny1ll elfciat)artr(  ;u1apeomfeiaslmDumuvs t0 lxoxf tydfatr n sl(  rxoir3iodapenmnvi (fsDra(rp;t1oex  i3ilsfs rauvp;u0 exoxo ty1oa ran slt s2xrir oodlle  iesl()sDuau ono1tlx  octldfa elnmp (0alxrirciy1om   ies () 2tmim iu1lpe lnvs sf Drmxro;u1ape ii3tysls rmnvs u) rerircoatfp raieo;s0t2um(opiudllenmicsls sDua(r ou1tpxoifeiytfm2uauvont0 rxnmr3tytomDr n o s0sexoxm3ou4ome mfcsa( srta( p;t1ole mfciat m ea(vs;u0alerxr iytlptraivs ( texrirpiu4om n netasfa2rmur ;o4oltoiiciydfmDuau s (4 ltrmr3oy1oaDe ues s)sexmxrpno1ap  mncs ( sDtmxm ;u1oleoioctydlaDrm(vs u) exrxo3ta1lmD  nei;( t2xoxm3oydllte ietas aDtmx pnt1tpx  fciadfaDel(vp u4 lenif3iy1omt ai o;t  euo(o3nydlle mictas)arua(m ;u4tlto ociytla2rm(vp t4trxoio3ia1lp  aivi;(0teuoxr oudlmtn ici sfsrtm(r ot4alxomoetad m2ua(mp;t0 lxoif oa1oa r ies (  rxrxm3oydopee fvt tfsrua(rp;t4apeniieiatfs2rmn o;u4 rxnmf ia1omte ies t)s2tr(rpoo4omtn ietls)arrrxmpot4tet mfciys a2emnmpnu) eeoxf oy1fmDe uvs t0srxrxopou1lle  ivil(f Dtau  nt1alxomo3iltfsDua(mp;()tetnmr3totfaDeaiei;s  2urxm ny4ol e ieil(fs2trxm ot4tlxnmfeilsfa2elnmo;t)arxnmocoo1lm  lu s t  etoio ny4opt lfviat  2uaur ot4tltoio3ilslm2rmnmo t)trtnmocoy1lmDe ivs;t0t2ur(o3no1altn fct tfarrm(  ot4oeenmfeiasfaDelu p;t0 ltoiociy1oa r nes;t)seto(o oudomenlnvt tfsDuax o;u0ape if3ild s em(vo;(0tleomr iy1opt  nesl() rxrxopiudlmtelnvs s)sDra( o;o0tlto f3ilsla2el( on()altnir oytoaDr nvi ( t2umxopnu1altnlfvtasf rtmx oot4aleoifciytla2ulump;u)tltrmr3todopD  nvi (0trxo(o3nydoptn ivi (f rra(  no0oee ifetyd m2el(vs;u4tltoirciadlpDr ueo (0 eur(m io1amen fviatfs2rmxr oo1oetn fcildlm rmump t0arxnir iy1lmD au slt0teuo(rpou1lp emfei ( sDtmxrpno1optomiciysfa uln ont0 eermo3ia1faDrauvi;s sexrio oy4omt lfet ( s2tmu ooo4tetn ictltlsDul( o u) lxnxo ta1fp rli s;t0 rxrxr3nydopte fctls)sDtaump;t0tpeoif3ils sDuanmp u0 exnmr3oodla r n i;t0teto(m nu4amtemics ()aDuru p;t4olx io3tysfaDul( onu4altnif oa1omteaieslt)s2tmiopno1altnlfci s)aDrm(m nu0teeomiciltlmDrlnmonu)aetnif3oydla rlivol() exr(r3oodam nmfvtls) rtmur oo1tpto o3iydls2rmuvo u)aexnmocto1lmt  ivilt0 euoxm3nu4lpe mncta( srtmumoot1tetomiciad s2uau p;u0treomo iy1opD  u ilt) etr(r oo1om emictlt  2tr(  oo1opt  ociytlmDeln s;t)tleoxr3tytlaD au olt  2xm(o3oy4lpt mnei s a2rmurooo1opxnio3tytlsDemn o;t0 eeoifctotlateai sl() exr(r ny4oltnlfvtlsfsrrr(m ;t4alx  i3iyt m2rau p (0aexoxo3oadfmt lieils) eumxr iydlpt lieilt  2rmurp;o1aex ifeiat m rln s;t0tlxoifciy1oaDe ueo t0 rtm(opoy4olee fvil(fsrrmx pot1tlx io3tas sDrmuvsnu0 rxoxf3oadlp e u ols trurim3oo1omenmivtasfsDrmu ont1tpxo fcildla2ulu snt)trxnioctodfat lu i;t) etoxr3no4optn fvil(f 2tmu  ;t4ape mf3iydlm ran snu4texrxfctotopt ai ilt t2um(rpny1lpte fet t)arta( o;u0tltnmieiasfaDua(vo t4trxomr3ta1lm elneo;( truoir oo1omt lnvtl()sDtmurp;o0aee  iciys a2um(vp (0tetomfcoy1faD lieilt seto(r iodol nlfctl()s2rr( onu4alxomfciat m elnmonu4 rtrmf3iotom e i i;s  eurim3no1omt mfciat  rtrump;u1aeenioeiytfaDrln o;u0 lxoiocoydfaDe i ols) etrim3oy4omee nviatf rta(m ;u4oeenmoctldfaDrauvont) exomr ty1fptelivils0t2urir3nu4opeelivs (f Dtau  ou1apxniociyslm ul(mo u) eerxocoy1laDeauvslt trumiopny1ll emici ()aDtaxrp;t4opx  feils sDrmnvp ()altnxr iotomtelies;()s2xmxm3oodamtn iet ( aDrr(mo;t1altomfcias m2rmump;u0 rtrxo to1la elnvo;t) rxoxm3io1ap nlics ( arum(m ot4olx mi3ilsfaDrl(mp t4tetnxf tytomDrauvo t s2tmxo3oy4ap nmfvtls  Dtr(moou1olxo f3iyt mDrm(vo;t0aetomfcoodfp   nvslt)srtrxo3iudlleemnci ()a2raxmpno0alxomfcias s rm(vsn(0alenmo3iydlatranesls  etr(m oydaleemncsas) Dtrx poo4opx  ocild aDrmumo;(0trxoircoo1omD  nvi s t2uoxmpno1om  micil(fsDrrxmo;u0alxomo3ilsfmDrm(vp;u4aeerir iytfm   ivi;s0tetoxopiu4lle lnvsl(  rtr( ono1texo feiadfsDel(vsn(0aetnxfcto1om eln s;t t2umir iy4lmtn nvsls srrru  ot4ale  oeiatlaDuan s t0arxoircta1oa elivo;() 2tm(o ny4lpen ieslt  rra(mpou0oltoii3ildfs2ul(mon()arxoioctodoaDelivo;t sexmim iudlltelnctasf 2trx o;u1opt  fetysfm ulnvonu4arerio tatfa e u ols texoim iodol emncta(  2tax pou4teenmf3tadlmDrl(mpn(0 eeomf ootfmteanvo;s texmio iy1amt  ivta(fa2um(m ;u1tle ioctls a rm(vsnu4tlenxrctytom  anvi (0trur(r3oodlmt mnei t)a2raxm ;u4aet io3iad a2uln o;u) etnmf3iatfm  luvolt  exoxr oo4lmtn fcs sfsrumx p;u0tltoiictaslmDrm( p;(4texoxf3ootfpt  nvols s2urxmpiodop  lncilsf Drr( p;o0altn octld aDuanvs t)aleoio ia1lpteaivi t setrirpiu1optnmfesl(faDumxr no4apt ifeiytlm2umumo (0trxomo3iytlm  li o t trurxrpiu4lptemfctasfarraurp;o0tpx io3tadfm el(msnu4aeeoiociytoateln i;()s2xr(o iudlleelncs sf rta(mpot4teenmi3iat m2ea( snu4aeeomr3todfpt  u s;s0sexrxm oodlptemivi sfarumur oo4tetoio3ias a eauvs t4texoxr3iadoat anvi;t) 2xo(m3ou4lp elncsa( s2rm(m nu4aexoiieilsfs eauvs t)aetrxo iydoa rauei;()t2toir3oy1ope lietls) Dtrxm ;o1opeomi3iltla rluvp;(4 reomf iotlm e u s s) 2toir iu4ape  ivia() Drrxm oo4altnif3iytfsDrlnmsnt) rxrif3totlm r iei;s  etoim3iy1altn nct (fs2raump;t1oleoiocias m ulnmp u0 rtrxfctatla e neo;t)t2toir io4aleemfvsl()arur(mo;o1altnmictyslm rln pnt0texrxf oatfmt anes;t0truoio3oodlm elictls srrrx ont4aptoiietadlm rlu p t0tlerxfcoydlmD aivs t0texmio oo1lp e fet t)a2ta( oou4aeeo feildfa ulums;(0teenmfctodopDe ueslt0s2toim iy1llt lieslt) Dtm( poo1oetn ociyd a2uln sn(0aeenio oy1fptelueolt0t2trio no1ole mnvtlt s2urxm oo4apeo octltfs2umuvo;()tlerio iodom  an s;s) rxm(r io4altnlneil( sDtru ooo0tetomfetysfs2rlnvp (4 rtnir oytfa rai i s)t2umir3oy4openmfvt s sruax  ;t4aetn oetytfa rauvs t) rtoxr3ty1lpteaivo s0t2xr(r iydopt micsls arrmxmo;o0olx ioctydfm umuvon(0trxomrciy1opt au i ()t2xrxopnu4oltnlfvil(  2uaxro;o0tlt ioctyd aDranmpnt0trtomo todom eaivs t teurio3nu4ape lnvtls s2trxr ;u4apx iiciatls2emu p;t)teeoir3oatoatr nvol(  rxmxm iy4lm  mfvsas  rra( ooo1alx if3iltlsDemumsnu0trtriociydoat lieols)trtr(o3nodalee ivs tf ruru  oo1optomi3iysfa rlnvo;()aeeniociadfpDrai slt s2to(r io4lltnlietlt sDrrx onu4tle  oeiydlm2ea(mo t0 ltrio3iatop   n o ( trurxm oudol  livia( aDrr(mo;t4oet ioetasfaDeanvpn()trxnmocoydomDe nvols)setrxo3nu1lptnmfeia(fa2tr(ro;u1oltoii3tltlaDuau s;t) leomr tydoaDean ilt0t2toim iodop elieil()a2rr(m nu4tet  ietatfm2emnvp t4 eenircoodoptrluvi;s setrxrpio4lm n fvi tfarurx oot1ole  fctyd s uaump;()tlxnxocoa1opD liesls0seuoxrpou4lptnmfes ()aruru  ou4aptniiciydlsDumn on()tetrir oa1lpDeli i;( srumxr3iu1al emfvslt  2ua(r ;o1optomociad a2elnmo t) lermf tydoaD livi;t0 2uo(r3nydam  mivi s)aDumxmpou4texnioctlsfmDuanvo;(4trtrircoadoa   uei;( seurio3io4lme lfeslt) rrmurpot4aee mfeiltla2eln o;u)trtoifctotfmD  uvi;t)trtmir oo1lpe lfesl() Dtrxm nt0tet  oetysls2ea(vp (4alxnxo3to1fm e neols0srtmirpno1ope licil(  Dum( pnt4apxo fcild aDrau p;(4tlerxoctydoa  au ilt  ruo(m3oo1op  lfvtl()aDrru o;o0tleoii3iadla rm(vo u0aexomr3oa1fmtelnvo s)t2uoxr3iodopee ieil(f rrrxmont4aleoiictasfa2emnvp;t4 rxrxrcoadfmtrlu s ()t2xmir3oy1alee ieslt arrr(r ;u1teeoifctadls2eau p (0aexrxoctadfatranvo;t srur(rpiu1aleemnciat  2rrur ot4tpxoioctltfs eau o;u4 leoxf iatoa  liei s0s2xmxrpoo4aleelnesas arrm(  ;u1tle iictadfaDrmn p ()tlermf3to1fp  anvi;s0seum(rpny1ale lfcs sfsDuax  nt1oeeomoeildfa2uln snt4alenxo3oodfmtr n ol( truoim ou4openmfctat  ruru oou0tleomociat sDuluvo;t4arxrircoa1fmD lieo;(0texmxr3iu4ope mnes t) 2tmxr nt1oeeomi3iltfa ra(vonu4texrxr3iodoa  au ol()trxr(rpny4ol elivta(f rrmur ;o0tpeniieilsfs2ulnvonu0 etrir ootfp rlnvilt0 2uoir3nodale  nesasf Dtau o;o0apxoifetasfa2uaumsn(0alenmf3tydla raivo;( trumxr no1op n nvtasf Dtax ont0aee mfeild a2elnvs t4aetrmocootfpt  ivils  2xrim3oudome lfctlt a2trxmont1tleoifeiat a uanmont0alenif oa1lmt au slt0 rxmxo iy4lmtelfci t sDuaxm ;t1apxo i3iyd m rln s;(0 exnmo oatlpDe i o () etm(m oudomtnmics (f rrrumooo0tpx miciad mDelu snu4 renifctydfm  aiei;s srtr(o3iodamen fci t)sDrmum oo4oex iociadlmDrlu o;(0 rtnmo ia1fa elues s)srumxr io4op nmivt tfaDua(r ou4open i3tyd m2umu onu0 reriociydfmDe ivi;( trxoxo3iydll n feslt a2rmuro;u0apxnio3iyd a2uanvo;t4 rxrxr to1oate ues;s0srxmim3nodlleelics ()aruru o;t0alx  f3iytls elu p;t4arxrioctotoa rlivils srxrxr3ou4al nlfvi sf rtm(m ;u1aee mi3iydlmDrm(vs;u)treoir3tatlm r nvils) exrio3no4opte nctl( srrmx p;u0olxnmociyt mDuan p ()trtnif todlpDrlu ol(0 2ur(o iy1ll emneta()srraurp;u1openifeilslmDul(vs ()treoxo tatopD lies ( srum(r iu4al   ictl(fa2trxm nt4aleo feiyslmDumu p;u)arxnif3iadlaD  ies;()texrxm3nydll  mfciasf Dtau pnu4oexo fctytfm2ea(mpnt)alxrmr3oodfaDe uvolt  2um(o ny4lp nmncsa(  2rmu  ;o0tpt mo3tlsla rl( p;t0 exoxo iadomDeaivo;t s2toxopoodolen neilt  rum(  no4altomfctls sDuauvp;t)trtnir3ta1omtrau olt0t2urxr ny4al e netatf Durx pnu0olto ocildfaDem(vp;t4 rtomociydfpDeluvsls0 rxr(r3nudome  fetls  rrrxr nt1ape ifeiytfm2rmuvs t0aeeoxf3oadlmte nvol( srtrim3nu1lle lfvt s)artmxmpou1tltn i3iaslm2rlump u4tlxoiociodfm   n sls)t2toxm3nu1ll e nesl(f Dtmxm ;u4apeomf3ils aDumnmonu0trxrmociatfa eaies;t0srtrxr io4alen ivs t srrau  ;t4olt  iciydla ean o t4aleomrcio1fatelieols srxmxr3iydlp emicsltf 2umurpnu1opto o3iatla2el(msnt4aetomr ty1oa r n i;s0trumim iodap  lfes s)s2uaumpot1aexnmfeild mDum(vs u4alxomf3ia1lpDeau ol(0 eurxmpoydaptelnvil(  2ua(rpno1alx  o3iad m2umuvon(0texrmf iodlm elneo s0teurirpnydoltnmfesasfs2uaurono1apt  ieiltla2el(mont)altnmociotlpt aieo;(0sruoxm3iy1al eliet tfarur(mpnu4oetomiciltlmDrmnvs;() eermf totopDelueo;s texm(rpio1am emncias)srtmu pnu1altoiieildfa ulu p u0trxrifciadfmD lueil( t2toxr3iu4lpt  ivtas srtmu ono1oeeoiieiat sDumu on()aetrxo todlateanesl(0truoxo3iy4am  lics () 2rr(r ot1apenmieild m2elnvp;u0 lxnio3oa1lmteluesl()sexm(m3iodoleelictas s2rmxmooo4oex ifctad aDuln onu4areoxo iotla eauvi;s0setrirpno1lm nlfvtls  Dtm(m ;t1olt mietlsfm rm(vont)altoir3todomt ai ils0texrxm oy1llt  fcilt aDua(mpou0tlxomfciydfmDra( o (4tetnir ta1oa   uvi s0trxo(o3no4ll e net (fartmum ot0olenmfciltfm2ran pnu)treomf3ia1fm elnvo t0 2ur(m nodal nmfvtat)sDuru p;t1alenii3tadfs2eanmont0 rxoio3io1fpDelnes (0teumxo3ny4am  mnvs s)s2truro;u0alen o3iysfs rlnvpn()tleoif iydoptr n i;s s2xoxmpoy1lp nmicsa() Durumoou1alx iicias s ul( pnu4treoircta1la rluei;()sruoxm ny1altemnetlsfs2umx onu0opt  fcildlmDran pnt4tleoxfciy1la e ueols)srxoxopnu4ll emnvtl(  Drm(r ;u1aptnmoetlt s2rmuvp u4artoir iytfm eln ilt) eum(rpiy1optemfetl(farraxmp;o0aeenmieiatls2um( sn(0alxomocia1fm   iesls  2xoim3iodapt  ivt t  Durumo;u1oee mf3tltfsDea( s u0areoxf3iy1omD li ilt0 rtrimpny4openmfeils) rtax  ou1opx micilslm emuvo ()trtomf3io1opt lues;( sexoxr iy4alee fvs t) Dtrxmoot1tlxnmoeiydlm2ea(mpnt4 leoxo3tatla  aueo ()t2uoiopnydlltnmivs t srtmxmoot1texo i3ilt a2ranvp t)arxrxf iotfmD livolt)srtrio iu1lmtelfeiltfsDtm(r ;t0apt mietldlmDuanvp;u4aexoxrctydlateaueslt0setm(opno4llt mfct t)aDrrum ou0oet  iciatlsDemnvp (4 lenxrctodlaD  n s ()truoxopiy1ll n nctat srrrx oou4opx  fetlslmDelnmp t0 etnxo3iytlaD luesl( srurxr oo4opt lfct sfarum(ro;t1olx  i3ilt sDeauvs;t4arenxfciy1lp rluvi;()sruo(r3nodalte neilsf 2ur( pou1tee iieiatfs rm(vo ()tltrio3oo1la rlies;(0srxrxrpoy4ope mfcsls a2uaump;o1tptoifciadlaDuln on(0tltnif ty1fmt luvi (0trurxopnu4olenlictl()artmuronu0opeo octad s2ra(mpnt4artrxr oodlmtelu ol(0 2urio oydlmenlnesat) 2tmxrpno0tlx mfctad s elnmo;(4alenxr iytfmDrlueslt0 2xrio oudamt mietls a2rmxronu4oex mictys m el(vpnt0arxomfcto1om  ln s t teurxo oodomtemnei tfs2ur( onu1optn ieiadfmDrm( onu)tltoxr3oadopteluvs;t0 rum(m ny1aleemfet ()aDtmx oou0tltomoctls m2ul(monu0tetrxfciatomteaivs t)sexmxm oy1lm emnci s) Durx pou0tltnmfcilslsDeln p t0tleriocta1fpDeliei;t0 etm(o ny1aleemfct t)s2tm( pou1tltnmo3iadlm2rau p;t)texnxfcto1fm rai ols0 rum(rpiu4lpe mivi s)artrx  ;t0oleo o3tlt mDrlnvo (4aetnxrcoadoa   uvi (0sexm(o3oo4omtemnet ()srraurpot4apxnmfetldfaDeaums (4texrmf3ta1lmtrlnvsls0texrxr3iy1lle mnct ( sDtaum ;u0alxnmf3tasla ran s t0areoio3iy1oaDe ies;s0srxrxm3ou4ol nmnei tf rrrur no1tex ifeiasfa um(mpn(0 renxrcoa1fp  livi t)texo(m ou4lme mfetls)sDuaumonu4texo f3iat mDra(mp u)tlxrxo ootfat ln s;s srumxrpiu1oleelivilt)sDrr(r ;u4olxo oetatlmDeau on(0alxnxo3ta1lpDe uei;s tetmim nu1lmtelncsls)s2raxr ;t0oleo f3tyd sDea(vp (4 rxnxf3oa1la eaneo s0 2xrir3oodapeelfctas)aDrrxrpoo1tlxnii3tydla raump;u0tlxnirciatopt an ols0teuoxr3io1amtnmncsa() 2rau o;u4aeeomieildfm ua(vpn()arenio io1fatean o ( trxmirpoo1lleelnct ( sDurx onu4teeo octas s2ranvon()tltoif ia1lp   nvs;t) 2xmxr3iy1amtnmivtl(f 2rmx pot1optomi3iydls2eaumo;t)tetrmr iytla e ues ()sexoim3iudoltn iei (  rtm( p;u0tpxoiociatfmDranmont4trenif ia1fmt lnvo ( trtr(
\ No newline at end of file
@@ -0,0 +1 @@
+uvs s0 ruo(opiudopeelfetlt a2taur nu4tlxnmo3iasfs umnms;()alxnxrctytlmD li o;t0 etrxmpnydapt lfvtl()artaxmpou1tpx ioetatla2raumo ()tlxoxo3tatlaD ln i;t0t2trxopno1om nmieslt)aDrr(rpnt1tle moetlsla2eln pnt4 eerxo3to1la r uvslt0srtrir iu4lm elnvi ()srur( oot1tpx io3iyt m emn o;(0 eenmr3iydfp  au o;()srtmxr3iydlme mncs sf rtr(mpoo0tpeo ictysla2em(mpn(4teeoxr ootlaD aues;t) 2tmxm3ny1ll emics s  Dumumooo4olx  f3ilsfa ran p;t4alxrmociotfaDraivs;(0tetmxr3iy1am nlfvtls) rta(  no1tle iieiat sDul( s;u4alxnxf tatlaD au olt  euoir3oy1al nmivia(faDrmump;u4tlxnmoeiatfsDrm(vo;(0tltrio oodfa   nvol()srurxmpoo1lm   fvtas)aDrmumpou0olenioetas aDra(msnu)teerifciotfp eli s s)trtoiopoudlle lfesat) 2rm( oot1tlx ifeiadls2em(vs;(0trtrmrcta1laDr neils0 etr(m iydllt livtl( aDtmxmo;t0opeo feiys aDua( pnt4trtrmo3tatoa  aivo;( teumxm3oo1lleemfctls srrr(m nt1tpenmocilt m2rmu snt4artomociytfpDr uvo ()tetm(o3nu1op  mnviltf 2umur ;o1tpxnioeiadfaDul(vp;t)texnxrcoatfmtr nes;(0trxrim nudome mfcta(  2trx  ;o0aetomfcild m2uaump;(4aeenmr3tydfa eliei s  eurio ny1amtemiet t  2trx oot4oltomieiysfa2em( o;(0alerxo todfmtelu i ()s2umxm3nydopeelnctl()srumx pnu1apxoifciysfm2elnvpnu)teenxr totla r uvolt s2trxo3io4lp  licia()sDur(r oo1tpenifetytls2rmu on()aexrxf3io1omDr nvs s0 etmxr3nu1lpenliet (  2raxm ;o0tleo ieilt s umnvpnt) ltnmfcoy1fate i sls teurxo nu4lp emici () Dtrx ooo0aee  fctlt s ranvp u) exnif3oodfat  neo;s  rtoxo3no4amt mfcils)aDum(  ;t0aeen f3iyslaDra( p t4trxrifctodfaDrln i;s  2ur(rpou4ameemfes tfs2ua( o;t1olt  iciytla2ul( snt4artrmocia1lm r uvo (0 eto(m ou1omtemiviatf 2uau  no4opxnmociyslmDuan p u4tlxrmrciadfptrlueilt)trtmimpio1lp e fesls  rrm(root1tlen ociydfaDulumpnt4 rtrmo3oy1fatrlnvi t)s2toir no1ape  feia( s2uru pnu1oeto iciyd aDran s u)trenif iodlpDr n o s0t2xm(rpio1lle mnet (  rra( p;u0oexn f3tysls um( s;t0texrxf3tadfptrln s (0 ruo(m3iodamenlivtat  ruauro;u1tpe  ietat m2rau o;u4aetoxo iatfpt anvs s)seumxopiu4olen nesa()sDtauronu1oleomf3iysla eanvont) lxnxo iodlp   uvo t0 2to(o nu4openmfvt (fa2rrx ooo0aptoiictydfsDeaums;()trtnmf3tadom rau s;s s2xm(r ou1ome  fcsltfsrum(ront4olx ifciat s2ra(vs u0 lxrir3tadomtr i s;(  rtr(rpnu4apte netl()artmxr ;o0aetn f3tltla ul(vo (4 reoxf iy1fatr n o () exo(r nydomeeliet s a2rmxrp;u0tpen f3iydls eanvs;u) exrio totfm  li o t) euo(r oodam n fet sfa2rrurpou4tpeoioetld mDrl( s;u) eeomf3oatfm  livil( t2xmirpiydlleemics t)srta( pot1tpxnioeiysfaDulumpnu0 exnmr3oadlmteln s s) rum(mpou1lltnlieias)s2ururooo1openiociydfm ul(von()trerifcoydoat lneol(0 2to(opno1olenmncs () Drmxrp;t4apeo oeiltls emu s t)alenxf iotom  anesl(  rxrxr nu1op emnci s)sDuau  oo1tpeoio3tad mDrm( s;u)altoxo3io1lm e nvs s)trur(m3iy4om emicia(fa2taurpnu1tet  oeiasls2um(vo;(0aexomocoadfa  aieo;(0sexo(o nydomtnmnei ( aDuru  ;t0apx io3iysfaDrm(msnt0arenxf oy1op raneo s0s2xrxrpnu1apt mfei () 2raur ;o4aex moctls a emn s u4aeeoxr iytfm rau o (  rxrim3oy1omenmivtas aDtr( pot1oex mi3ildfa uanms;u)aleoif iy1lmt  ues;(0sexoxr3io4omte ivtatf rurumpou1tltnmoeiytla2em( o (4 exrxr3iydlpDe nvi;t  exoim nydll  mfeslsfsruaxr ;u0oltniicildfm um(ms;u)tlxomo3oo1lmt ln s;(0t2umxr3ny4aptemnvsl(  rtr(rp;t4aptniieiyslaDran s;t4aeerxr oy1la   nvs;(  exmim nu1ol e ivs (faDrr( o;u4alenmiciat m emu pnt) rxnio iodopDe uvil(0sexo(r io4ll nmivilt a2ta(m ;o1teto oeiasfs emn sn()alermo3tatfa rlu s;s t2uoirpny1amtnmncilt)s2urxrpot0oexnmfeiad a uluvo;u4 ltrxr3tatopDeanvo t)trumirpny4op nlneiat)srurxrooo0ale mf3tyd s2rau s u4tlxrxocta1lp rai sls)setm(rpoy4omtelfvils)arra(ronu1ope  icildfs2ranmpnt4tltnmrciy1latranvs s seuoxo3io1optnlncsls aruaur ot4apx mi3iytla rmu p;t0alerxf3iytomtrlu i;s0trxr(r oo4apt lnei (  Dtm(  ;o1olxo oetydla2ra(vpnt)teerir ia1fmDr uvs;t srxoxr oo4amtnlfeia()a2rm(m oo1openmi3ias a2rlnvo u)texrir3ta1fp rlnvils)texriopoo1am emici sfaruaxmpoo1aetomociatlm2ea(vpn()trerirciotfmtrauvsls)t2xrir3iu1ap n ncta(fa2raxm nu0tet  fciysfs emnmsn() lxrxf3tytla eli i;s trtrxm3nu4amenlncs s srrmurpnt0alx iieild aDranms;t) lxnmrcoadlmtran i s0 rxoim oudope livsl(faDuaxm oo1tltomoeildfm rmump;()artrif3oatla  ln ols0trtr(r3iy4lp n fcs (fs2uau  ot4apeoiicilsfa2ranms;u0trxnmrcia1fateanvi s0srtrxmpnodameemncta() 2rmu oou4optomiciyt a uauvpnt4 lxrir3oo1fa rlneo;s0t2trxr ou4lpte fcs tfartau  nu4tpxnmo3tadlmDumuvsnt)tlenmrcia1omt luvs t  2tr(opno4ap nmfctlsfaDumu  oo0ope  ieiltfmDrmumsnu0 ltoif3tydfa   ivs s0s2xoio oydlmtemivs (f rrau onu1openio3iadfa2emump;()trxomr to1oaD  ies t  etmiopny1om n fciltfs2trxmp;t0aetomieild s2el(vp;t0tltoir3oydopt lnesls0trtoxo oodalee nct s)artmxmpnu0ole mi3iyd m2ulnvp;()tlxrxf3oydlm  ln o;s)seumxo3iu1ape lieta(fsrrmum ot1tetniiciad s2rl( pnu)aleoif3ta1laD auei;()s2xmxr3oo4lme mnvt s  rurxr oo4aexnmfeiysla2ua(vs;u)alxnmr3oo1fp e ieil(0setoxopiy4lpenlnetas)aDuaumont0tpeoii3tytlsDem(vs;u)alxnxfctadlmt lu ols) rtrim oodllenlfvs tf rtr( p;o0tetnifetltla rlnmp t4teeoxfcoydoa eli o;s)teur(o3iy1ale  nvia()arumxmpnt1aexomictysla elnmpnt0trtnmo3iytlp eln o;t t2xoxo ou4ol   fct (fs2tau  ;u1teenmiciaslm ulnvo u4texnio oy1opD lnes;t) rxm(m3iodlmen ivslt) rtr(r oo1opto fciadfa el(vont)arxrxr iydlm elivolt texr(m iydlpte ieil()a2tmu  nu1tlxnmo3iydls rlu p ()alxoif3oydlm  li ils)seuo(o3oydlmtnlnct tfarta(moot0altoio3iydlm rln ont)artriocoadlatrli i ()sexo(r3oo4apeemfeslt aDtrx  ;t4oexo ictytfmDrl( pnu4aetnxr3iydoaDrai o;t srxr(opoudlm emnesas)sruru ont0alen ociltla em(msn(4 rtnxfcty1fm eluvols)t2tm(mpny4lp nmfcils  Dumx ooo1oexnmfeiyd a2rmnvs (0aexomo oodfateaneils) rum(m3no1ll emfvtl(  Drmump;o1teeoiietldfsDumumo;u0tetoir3oa1fpDraivs s0srtm(o3iu4optn nvsa( srur(mp;t1ole  oetydfs uau pnu4aetomr3tydoa r ivi;()texr(o oudal n ncsls sDum(mo;o4altn feilsfs2rln p u)tlenmociodlaD luvi t0trum(m nydolen fvtls) Dtmu p;u0alxnmfetydfs um( sn()tlerir ia1oatrluei;()sexrxopou4opt livilt) rtrxr ot1tpeo ietld s2umump (0 exnxf oatoa rluvi t)srtmir3nudaltnlivi ()s2rr(mo;o1tpxn oeilsfmDemnmsnt4teenxo oatom rlieols srxoim io1apen nctl() 2rrum ot1altomi3ias mDulu s;t0tlxrir ta1lm eli o ( t2xrxr ny4ll  mici s srumurpno0olenmoeiadfa2ua( s;t) etrxfciatoat aies;s trtmxr3ny1lpee nvi s)srra( pot0oet  o3iltfs umnvs;(0alxnxocto1lptrlnvil( srxmxrpio4ap nlfei tf 2taxr nu4tltnmf3tasfm2rmumpnu4 exrmf oodop r neo;t)texoxm no1am nmfvtlt  rumurpot4aleoiieiysfa elnvsnu4alerxocoadfpDrlieols)t2xrio3io4aptelietl()a2ua(m ou4opt  ieiatfa2rln p;t4aetoir3totfat lieilt0teurxm3oy1ome lfcsls a2rru ooo0oexn f3iyslm2ran o u0tltoxo3tadlpDelnvs t)trtmim3nudlm  mnei s)sruaxr ou1aeenioctlt s2rmnmo u0aeeoxf3totlat lnvo;()seumimpnydll nmnci ()sDraurpnt4texn f3tltls2ulu s t) etomrcto1fpDeliei;t0 rxmxmpno1altnmfesl(faDrru ont0oexo octat a2rlumonu0 rtrio3iydop rluvi;t0seur(o oo1ol emicsltf Dum(rpoo4tpto ociat m ean p;t)tetoxrcoo1lpt  u o s srumio ny4om emivta(f rtru  ou1ole mf3ild s2ua(ms;u)aetnmf3todop rli i;()t2xmiopoudlpe lnctl( srurx  ot1tlenmociatla em(vp t) rerifcty1fpteln sl(0srxo(r iu1oltelfcs s)a2tauroot0texnio3tatlm rl(mp;t)trxoxo oodop   ues;(  etm(opio4ame lfvtlt)a2ta(r nt4oexn o3tld sDrmu o;u)aeeomocoytlmteli s t  2xmxo3iydap   fci sf 2rm( o;o0oexnmo3tyt s2ra(mo ()aexomfcoy1fpD lueils0 rtoio3io4al nlfet (faDrmumo;u0oex  iciyslm2uluvo t)artoif iy1op   ues t t2uoio oodlp  lneil()s2um(r no0aexn ieias a2elnmo t4 lerifcoytlpDraivslt0setr(o iudolee fvt t)aDrm(mpnt4aeenmietadfa rlu on()aexoxr iytla  au i (0 etoxo oudlpt micsls sDum(rp;t4aex ioctltlm2ul(vo u)aleoifcoadlm r ivol(  2umiopnu4al  lieilt s2uax  oo1tle  i3tys a2raumonu)tleoio3ia1fmt anes t teto(r3io1ll emicia( srrruronu4olto ietasfm ulnmsnu4artomr tatoa   nvolt trurir3oy4ll  mnvs t)s2rau pno4tpxn o3iys s2elumont0arenircoydlpteli i ( srxrio3oo1oleelncta(fsrra( onu0oltnifciltfaDuaumo t)tleomo oy1la  an il(0tetrimpnudam   ncils  2rru onu0apxoioeias a emuvo u) rxnxfcoydoatrlueo (0 rumio iudopee ictl(faDum( ono1alen octydfa2rlnvsnt)aexnxr3tytoate u sl() eurxopiy4lle  nvilt)arraxmo;o0olt  oeiyd a rlnvsnt0tltrmrcoodop rln ils s2tr(rpoo1llee ictas)srtaxmo;t1tpe iociadlm rm(ms;t0aeenmo oodopDrai ols trxoxo3iydoltnlieiat sDuau ono4oee ioeiydls umn p;u0tetoiociodlpDeaneo;(0sexo(o3iudlm n ies ()aDrmx ono4tetoifeiltfaDem(mo;u4 exrir todfp rln s;s0 exo(r3ou4omeemfeils)artr(  ;o0oexnifcilslmDrmuvs;u0teeoif iodla   ies;(0 2trxo iodaltemivsas sruau  oo4tpto ociyd aDra( on()arxrxo3oytlpt aivi;(0 rto(m iy1olee ics t s2rr(m oo1oee ifeiytlmDea( s u0 rtoxo3totla ran s (0 rtmxo oy1apenmnei (  rtmu  no0olxomi3iat sDelu snt0altrxocty1lmD  ueol()srxoxopoudop nlicsas) rururp;t1olt  oetat s emnvon()tetoxrctytfa r uvslt0 2ur(o iodame lietls) 2tmumont1oeto fciltlm uaump;(4 lerxf iy1opDean o t0srxoim iu1al nlncslsfaDuru ooo0altoioeils m emnvp;t4teenifcto1lpDr ieol(  2trxopio4om elieilt artrx p;o0olx mociatlmDem(mp;u) reoio tatfm eli ol(0teto(opoy1ale  netlsfaDtaxrpot1tlx mo3ilslm2ea( snt0arxrxo oydom  lnvi t0s2xmirpnudop   nci t arurur ;t4tpxnifeiyt a2uaumpnt0alermo ty1fm rlnvslt) etoirpiu1altnmiet tfaruau onu0olxo feildlmDem(vont)tlxoxr iytfptelnes t) rxoio3io4ope lfesls)s2tr(mont1alenio3iasla2eaumo;(0trxomr3todoa r n olt s2trim3oo4am   ncil()sDum(moot1olxn octldfa ra( p;t)aetrircoo1opteaies s)seuoxmpio4aptemfes s  rraur ;t4aeeoioctys mDrl(vp;t4alermf ia1lat livils0s2urxmpnu1op nmneiltfs2ra( p;o0aptoioctlsla emums t) ltrif iy1lmDelnes;t) eumir3oy4am nmictls) 2rau ono1oex ifeildlsDrluvp t0alerxf3iotlmt lueol(0setrxo3nudalee nvs (fsDuaxrp;t1aeenmo3iltfsDemu pnu)teenmocoadfpt ln o;s0tetmim3oo4olenlnvtat)sDuax  ot4oet ifctydfa2rlu p;t)alxoxo3ty1fpt auvol(0 exoxrpiu4ap n fct ( srua(rpnt1oleoioeiltfm2ea(mp;t4 rtoircoydomDeli olt0srxmxm ny1op emfctlt a2tm(mp;t4tptomfctyd s2rlumpnt4arenxo totfp eai s;s seuoimpnu1ame mivslt) Drm(mo;t4aptnifctat m ra(vo u)aexoxrciydlmtrlivsls)tetm(o ny1ameeliviat)s2ta(mooo0tltnii3tlt m emn snt)alxrmf oatfp  lnvo ( sexriopnydom   fetat)aDum( p;u1apenmfeiasfs2ra( on(4aeeoircoatlat  nesl(0s2xoirpoo4optemncslsfsDrrump;t0alxniieildls elnvo t4 rtnxf iy1lmDe n i ( srtmimpoo1alenmfetls arua(rp;t1olx mociasfm2ulnvpnu0tltnxo3iytoa elivil(0 rtmxrpoudlmte neias) rtmurpoo0aleniocils a2uluvonu0tleomf3oodlm   nvo ( s2tm(o iy1lm   nvslt srrmu  no0tlx moeiadls uluvpn()altrmf3iatlaDelneils0 eurxr3iy4lptnlici ( s2rru  ;u1tlxnmo3ias a2ulumsnt0tetomf3to1fp raiesls0sruoimpnu1lpt  icslt  rra( onu4ale iiciasfaDul(mo;t4tltrmfcto1lm  an s;(0teurir3ny1lptelnes t a2raur ot1olxo oetltfsDea(vpn(0 renmfctydfateli ilt) rtm(m oydllte fcta(fa2tru o;o4ole  ieiytfs eauvpnu)tlxoio3iotlp eaueo;()t2tmxo3oy1ap elncsatf Dumurp;o1oexn f3tysfaDul(mo;u)alenio3oy1lpt luvs;s texrxmpoy1lmenmnvt s  Dumxm ou4tpeomictys a2uaums ()alxrmfcta1lmDranei;s0srxmio3nodoptn neiat srtru  nt1ale  ociydlm2ua(ms (4teenifcoydlm  auvsl(0srxo(rpou4amt lfetltf 2trumo;u0teto o3tysfm2eanms u4texoifciydlm ean o ()teuoim iy4alt  fci tf 2taurono0alt ioeias m2umnvpn(4aexoirctadlpt  nvo;s  2uoxmpoydolenlnetl()a2ra(r oo4oexn icildfm umumpnu) ltomrciotop e ivi;(0texmxrpoy4lm  mfvta(f rrm( pnu0opxo i3tad aDul( o;t4aeenmf todlmD an s s  rurimpiu1olt mfvtat)srraxm ot1tlt mo3iat sDra(mont)trxrif ta1fm eai sls trxo(rpoudll nlnvs (f Dum( pot0ape mieiad s2emumo;t0treoif3ta1opDe i i;s  exmxr oydole liesl(farrr(rpoo1ole mf3iydla ul(mp;t4arermfcoa1lp ean i;s0 etr(o3nydomtemncta()s2trxro;u0oex  iciatla2rm( p u) renif iytfaD aivo (0srxmir oydam nlfcslt aDrru oou1opeoioctytfaDranvp;(0texnxrcta1la r ieo;()trumio nudol  mfcil(  Drrx o;t4tee mieiatlaDul(mpnt0trxoxoctotfm r uei;t texr(m iudap  mncta(  2rrx o;t4tlxn fcildls em( s;u4tlenxocoy1latr uvs s texmio3nu4ame miei t a2raxr ;u1optoioetatfa ulumo;t)trxnmrciotopteanvs;( s2um(m ou1lpt lfvtasf rrm(mpot4oleo f3tat m rlnms;u)artrmf ootoat luesls setoxopou4am n ics tf Drax ono1olxomieiydls eanvsnu0trtnmr3oodoat lu olt0tetr(r oo4apt livils aDrmumpno4tltn o3tld m rlumsnu) etrxo3tadlate u o;( s2ur(o oy4aptn fcta()s2raump;o1ale ifeiatfmDem(mp;u)arxoxr3tytfmtran s (0 2uoim no4op   ncs t sDtmu ono0tle mociys aDrm(vo u0trxnircto1opDrluvilt0 rtoir nydaltn ics sf 2uaumono1ape  o3ildla ulnmp;t4areoxo tatfpteluei;t0texoio iu4oltemncil( sDua( pnt4tpenmf3tysfa rln o u)artrmo oytlmt livi t0trxrir3oo4olt  fvtls)aDta(r ou4tpenmoctatfa2rau pnu0aetomrciytoaD lu sls0 exo(rpoudop emivilsfsruru o;o1altn i3iydlaDeauvp t0aexrioctydop e n i s teuoiopoudal elfesas sDrmur ;t4aetomo3tysfa2rl(mo;t0tlxomo3oa1om eaivolt teur(opiodam emict sf 2rax pno4tlxo fciyt sDemn s;t0 ltoxfcia1fmDrlivi s t2to(rpiodol e ivt s  rraxr nu4tpxo ocilt m2ulnvs t)tltnxr3totopD  n o s sexmxr io4ll emfvi s) 2ur(r ;u4aetoiociytfaDuauvpnt)arenxo ia1la elnvs;t0s2urim3io1opte ivtl(faDraum ;u0altoio3tltlm2ul(mp;(0aexrmfctytlp  aueols) ruo(m ny1lpeemicils a2raxr oo4tpxn f3tlsfmDemuvo u0trtnmfciodoaDeanes ( sexrxo oo1aptnmfciltfs2taxr ;u1aetoifctlsla umuvpnt) eerir3oatfpDrlneslt) exmxm oy4ap   ict ()srra(roou0olt mf3ildfm ul(mo;(4tleoxr ootom  aieo s)srum(o iodaleelfvils)sDtr(m ;t0tex if3tyslsDrlums ()aeerxr oa1latrau sls)s2tr(m iydomen ics (fsDtm(  oo4ole ioeildfsDulnvs u4 lxnmr oatlm r uvi;(0 rurxmpny1lp nmfvsa()sDrrxm ot0tlx ii3iadls eauvsn(4teenxf oytfmte i i s0s2xrxr oodamenmietas) rumxr ;u4tle ii3tlt s rluvs u) lxnmf tatla   i s s0trxr(m3ou4lpe mfct ()srtmumooo1apx  ietyt a2um(vo;t0trtrxrcoo1fmD aivs t)s2xmir iy4op elfesa(  Dtm(mo;u4opeomfetyt s rm( ont)tetrioctydoat  ues;t0setm(o iodlmtnmnvil() rrr( pnt1opt  o3tls s2ul(vpnt4 reomfciydfptrluvi t teumxmpou4lpt mictas)a2tr(r ;u1tetnmieild s rmnmon(0trxnmo tadfm raivi t)trxmxo io1ap nmicil(  2umx  ;t1tlxoif3tasfaDra( ont4tetomr io1la   ivi t) 2tmir3ou1openlivsa() ruaum oo1olx mf3tld sDrmnvo u)tetnxfcoo1fatrli ols)setrio ou1lm e fvs s)sDrru poo0apx iictytfs em( s;(4altnxoctodfate ivols)trtm(o3iudlpte ncsat sDuaxrpou0oleomfetatfmDeln o;(4trtoxo ootomtrauvslt0srtoir oo1al n nct t)s2taxront0aee mo3iatfsDrl(mo;()arenmo ta1latrauvo;(  2xoirpoydomeemfcias artmx poo1tlen oetatlmDra( s;u4 rtrmo oadlp rauvols) 2xoxmpio1lpeemnvsatf 2raxr ;o0oleomiciytlm rlnvsn(0 ltrxocoydlmt  ieol( s2xo(opoudol   fei (fsDrm( p;u0opxnmfciadfsDrm( p;()tlxnmociytoaDeai i;s srumir3ou4op e nvtas)a2uax o;u0aeeomi3iydfsDel(vs;t0trxoio oatlmt aneo ( t2toxm3nydop nliciasfs2ra(mp;u1tleniiciysfsDeln p u4 etnxr3tadfpD  u s;s trtoxrpiodame miesas a2ta(m ;o4aptnmfeilt a2emnmpnt4trxoir3tydfa  auvs ( setmimpoudal   fes (  Dua(m ot0oltniictyt s um(msn(4tetrir todomDeauvils s2xoxo no4opt lnesls arrmur ;u0teto oetyt a2eluvo;(4trxrif3tytoa rlu ols) euoxrpoo1alee feia()aDrrxmp;u0tptomiciadfaDuluvp;()trxnxo oo1om   nvs t texrxo iudom emicias) Dtm(root4teeomfeild sDua(mo;t4tlerxocoadopt aivo;s0trurxo3iu4omtemivsls) 2raumpou1texoifeild sDeau sn(0tlxrxf to1lm rlu o t)t2to(mpnodomtemivs (fa2umu oou1optn o3iydfaDuluvp;u)alenir io1lpDrai i s)tetrim ou1llenlnvia()arra(mooo4oexo i3iyt a2em(mp;t0artnir ia1fm  aueol()t2xrir3oydlpeelici sfsDtr(moou4ape ifcias s rl(mp;u0 rtnmf3ta1fa   neolt  rtmxm iudalt mfcil()aDur(r ;u4tle  ictlslm umnms (0trenio3ia1oaDrluvi;s) rxo(m3oo1ap emfcils)s2uaxmpnt1oetoifciydfm el(mo;(4trenmoctydfmtelieo ( sexmim3nodamtn fvt (  rtaxr ;o1aet iietydfm2ul(vs t0 ltnifciotfmDeauvsl(0t2uoxr3nydlptemfetas  rrr(ro;u4tpenmieilsla uau pnt)treoxr iodlp raieols) 2toxopoy4amtelfesls)s2uaur ;o1opx mfetytfsDrmu on(4 etrir3iytlp ean s;t) etoxm3ny4opt lfvsas  rtaxmpoo0teenmo3tad s rln p t0 exnircoydomtr i i;(0srumir ny4omtelfcslsfsDumuro;t1olenmfctadla ul(vpn() reoxr totfpDeluvslt)texrxo nu1al  lfvia() rtmxrpot0tlxnmoetls m rlnmonu4 lermr todlptrliei (0s2ur(o3io1lmt mnvsl() rtaxmp;o1aexo f3iasfa2ul(vonu)arxomrcoytfm eanvo;t0 exrxmpiy1olte nviatfsrtmxrp;t4tltniociysfaDulumo;(0trxoxr3tadomte nvilt0s2urir3io4oltemieia(faDum(rpnt4olx iietas mDranvs u) etnmf3iotoaDeliei t0 ruriopou4llt  nvil( a2rm(m ot1ole  oeiytfs2umumo;t0aexnmo ia1fpD an i s) etr(r3nodlme lnes t a2rax poo4aeenioeils m2rm( p;u0aetrxf oo1fpt aueo s seuoim iodlpt  fctls aDrr( pou4opt  fctytfm raump u4 renir tytop r n i s setr(m iy4ame mncsl( a2ua(m ;o4oex  o3iad a2uauvo (4 reoxr iodom raneils  exmxm iu1op  lictatf rtmu p;o4aexoiictas s2rmu pnt0trenxr iydfp  au sls0seumio3iy4llt lfeils a2rmumo;u4aleniocias aDuanvp () rtrmf ia1fpD lnvi (  ruriopoudapeemfvi t s2tmx o;u4apxnmi3iadla2um(vs;u)tltrxr3totfa  lnei () etoir3ny1aptemictltfaruau  nu4opx mfcilslm rlu p;()artrxoctotfm   ivslt s2tm(rpnudamtn feiat  Drau ont4optomo3iasfa2eluvo;(4altrir iy1faD an o;(0srxrxrpoo4lpe  icslsf 2uaxmoot4tpx ifciasfs ua(vs t0artoio3oa1om eanvs;(0tetrir iy1al n fciasfs2rmx  nu1tptnmf3iadla emnmpnu0altrxr tatop rai o;s0 2umxo iy1amtnlnct ( aDuax poo0teenmoeiyslaDelnms;t)tleoirctatfateaivol( trto(mpnu1ll emnesatfsrtmxmpnu0oex miciatla ea( sn(4 rxnir3oytomD auesl(0 2uo(m nu1am   nviat  2rauro;o0oetn octysfsDuan s;(4aexnxo3oatlm rluvils  exrir iodamenlncsas srtmxmo;t4alto fctydfmDuln sn()trenxrcoadla rai o;t)s2um(mpiydlmtnlfvs s)sDtmur ot4opeo oetys mDemnvo u4 leoif todfmte i s;(0 exmxo no4lpenmnes s aDtaumont4texn ietyslaDul(vpnu4 reoxr tatfpD aneo;s  etmim no4lm  lfcslt  Durxrpot4apeo f3tatfa2rm( s (0 lxrxr iadlm  lu o () etm(m nudlp  lfcsls aDrrur nu0opxnmoeildla2ranvo (4 leoxf todop r n sls trtoxr3iy4al n nvils a2rax ono0aeeoii3iadfa2ulumpnt0aetriocoo1omt ai ils0t2tmxr no4lmt  nesas arurxro;o4teeo ieiytla em(mo (4artriocootfaD au s;s0teurimpoudamtn netlt)srumxrpnu4ale mictyd mDum( s;(0tlxnmo ty1opt  ivo;s)sexoxm iu1opeelfei s) 2tr( o;t1aleo iciys m rlu o;(4tlxoif oatfa   uvilt seurim3iy4ameemivta(  2uru pno1apxo f3iyt mDuanvsnt4areoxf tydfatelnvsls) exm(o3ou4lp nlnetat aDrrumoou0oet mfeiytfa2uan s;(0aexnxo io1fmtelneslt0 rtr(opio1alen fei t) Drax p;o0opx io3iatls2ul(vsnt)alenir tadfpt  nes;( truoxm iodlmte iviat)a2rm(  nt4opx  f3tltlmDulu p;u) eeniocoytfatrlnvo t)tetmxrpiy4lme lnet ( aDuaur oo4oeto fctyd s2um( on()areomfciotoa e i i;t) exoim3iodlp nlncsas sDurxmpnu4texnifciadfs raums;()teerxoctotop  anvs s0 eurim iodlp emivsls srrrxrpnt0apenioetytfm2rl(mont) etriocia1fatr ieo ( tetoio oy4opte icsls a2ta( pnt0opxn iciyslaDra( s t)aetrio3ootlate nei t)t2umim3iudol nmicslt) rrmu onu0optn octls m2el( snt4 rtnxf3tadfptr neils)teuoxm3nu1apenmnvs s aDrru p;o1oetomi3tltlm ean sn()tetnir3iatlmDr nvslt)seurir3nu1lm nlfetls)sDtmxr nt1oexnmictydfmDemnvo;u)areoirctydfmD lnvi ( srtrio3oo4olt miei (fs2rm(mpot1opt micildfm rau s t0texoir3tydlmt lueo ( trum(r nu4ope livils arurxronu0ale if3iltfa elnmpn()aeenmrcoytfat auvi s0t2uo(r ou4lp e nctls aDraxrp;u0teto fetydlaDrmumpnu)tlxrir iodfm  ln o (0 rxoxm ou4alenmncias  rra(r nt1apx  oeiatfm uau s;u)altrmo iadoptraueolt) 2xoxo oudllenmfesatf Drmurp;t1tpenmi3ilt aDrm(mo;(4areoif3ty1fpt anvs;t t2urir3ou4alenlncil()artruroou1tlxn oeilt s uau p;t)treniocty1oa  livs;t0 2urxo no4lmtemfcsasfa2rmx oot0ole ii3iydls rau sn(4alermr oy1fpD lu s;s0t2urio oy1am e ivtat  ruax pnt1tet  ieils a2elu s;(4aetniocta1lpDe uvo (0 2urxr3nodlleemncil(fsrurxmoou4tlen ietys a2rmumon(4 etoxf3oytla rai sl()setrim3oo1ll nlies (  rrrxront4olxomieiltfsDum(mo;t) etrxoctydopDraueolt) etoxopnodopenlfvil(  2rau onu4opxniiciaslmDeluvpnt0trtomr3iytomtrlueolt0 2uoxo oo1oltn ivs (farraurpou1tleomo3iysfmDrmu o t4 lermr tadlatr uvil()t2uo(opny4lmenmfvsas  rumumpno4oltomietat s2uaump;t) lxomf tadfaDean o;s)trum(m3ny1ol n ivil( aDrmx ono1ape  iciltlm eaumsnu4tetrmr tytomD  nvi;(  rto(opny4omtnlfesat  2ua(m ;o4oexoio3ilsla emnvo t0 rxrmr ta1omDr uvs;t t2tmxmpny1lp e fviasfaDtmuront4apt mfciytfs2eau p u0alerxo3oadlmtr uvi;(0srtoim iudopte ivil(farrrurpou4opt  oeilslm eanvonu) leoxf tydlaDeau s;() 2umio3iu4alen ivt t  2rr(rpnu1tpe mfciysfm rlu s;t4trxomf3oy1fpte uei;s0teuo(opnudoltnmfcsatfs2tmxm no0alt  oetadlmDrmn p ()arxrir3ta1lpDrauei;t0s2uoxm3nydam   nvs (  2rmxr nu4olxn f3iys mDem( o;u0treoircoa1lm eau s (0t2urxm ny4amenlfet t) 2ra(m nt1oetnii3tysfmDuln sn(0 exnio to1fpt  i ilt)sexo(m3iu4omte net t  rrmu oot4ape mieiad a rmump;t4trermr3iydlmD  nvo t) 2xmxo3ou4omt mivsl()aDum(rpnu0apxniietltls el(vo;(4trxomr3tatfmt li i s  rxmxr3iy1aptemnvs (fsrtr(m ;t0opxomfetlsfsDeaumsn(0aleoxf3oydfaDr n il(0t2urxr3nudomt mfvtls s2taurooo1tetn f3iydlm2el(vp (4aleomfctydfate i s t tetm(rpno4apenlnesls) Duaumont0ape mo3iysfm2el(vpn() exoxo ta1opte u ilt0srxrxo3iy4lm e ieilt)srta( poo1tpe  ictatls eanvs t) ltrmr3io1fp r u o ( s2xrir3nodaptn fvt tfa2rmx pot4apt  f3iysfm2ea(mo t4 etoir iydop  lu o;t  etm(opou4olt  fvsasfsrrau p;o0oexo feildls2umump;t0aetrir oydom  aivo;( srxmxo3oy1olte iet t arrrur ;t1tltn ociadfmDeluvo;()trxnif3ootlmtrlues () 2xoiopny4op nlnvtl(f 2rr(  nt1tpt mf3iadlm2umuvp (4 eerxr3ootomt ln il(0 exoxmpoudlptn fciat artr(r ;t4tltn o3iat mDeln snu0 lxoxr io1fptrlneols s2trir iy1omenlivs tfs2taump;o1texoif3tysfm2ua( o t0 eerir iy1om   nei s)texrxm no4lpenlieias)s2tmxr ;u0alxomictltfm2umuvp u0teerxo3oo1lmt au sl()t2xoim nodal  livtl(fa2tr( pot1oee  i3tas sDra(mont)aexrxf3iytlpDrlueolt)trxrxopou1lm  mivsat s2rr(mp;t4apxo i3iysfm2ranmo u0 lxomrciadfaDrai il(0s2xmio oo4lltnmncsat)a2raxr no0opeomfeiyd m2eauvs u0artrmr oa1omD  u s (0t2trim iy4lltnmfcils) 2trxr nt4apx mo3ias sDua(msnt4tltomo oa1fp rauei t0trtmir3nu4ap nmivil() ruau ono4tlenmiciltla2eaums (0tlerxo3iadfp eau o s s2tmxr io1lltelnvta(  2tr( p;u4ole io3tadfa2rmumon(0 lerxo3oatomDrai slt s2xo(opnudlle miet (fs2trumooo0tpxomi3tlslm2ranvo (0 reoxr oadfaD luvsl( s2umxrpiu4omte fctlsfsrurxr ou1aptn fctytfaDea( s;u0teeoirctodoaDeluvilt  2urxmpiu1amte netlt) 2ra(mont4ole ii3ilsfaDum(vs;t4texnxfcty1op e nvsl() eumxmpiy1lmt livsat  rur(monu0tet  o3iat m eauvon(0aeerio3ootfpDeaiei t) 2um(r3ou1lm nlieilt aDrr(  ou0oetniicildlm2ea( p t4altnif io1la eauvi s texoxo3io4apee fvsasfa2truro;u4olxnif3iyd a2ul(vp;(4tlxoxr3oytom eluvi;(0 2tm(rpny1ame lfci s) rtaxr ot1oet if3ild a umumpnt)teeoxo ty1fm r n ols)s2tr(o oy1lmtnmnesat  rtr(  ou1apeo f3tysfs emu p;u) lenif io1oat lueols t2xoiopoo1olee fciasfsDururp;o4tex  ocild s2rmn s t4tetoif3iadlmt luvo s)trxmim iy4lp   net ()aDta(mpou4tpx ioeiasfa rmnvsn()aetoiocto1lp e neolt  exmir no4lptnmieil( arrr( oou4opeomfciytfmDrl(mpnu) etrmrcoydfm eaues (  euo(rpny1optelici (  2umxmono1tet ifetytlm elnvon()aetrxo ia1lpteaueo t0s2xo(m nu1llt  ivil() rtrxr ;u1opeo f3iyd a uau s (4altnxocoydlmDeanes;(0srto(opiudal  lies sfartau pnu4opxnmieiys a rmu p () rtomo ia1fmt lneo () rurxmpiy4ame livi (fartaxmooo0oeenio3tydfa2uluvo;t)aexnxrcoatlmtrln s;() eur(mpiodlleelfcsl() rtrumoot0tpx mo3iytfaDrlnmp;u4aexoxr3ty1lm elueo;()s2trxo3io4am  mnvtat srua(mont4aexnio3tatfa emn pnu)alenif3to1fmt  ies;() ruoxrpiy1ll n icias aDur( pnt4optomi3tlt a2umn o;u)aexomfctatfmD ln o;() rxrir oo1amee nvsat  Duaxr ;t1tltomo3tydfmDrm(vs;(4texnxf ta1late i i;() 2ur(o io4lp nlicsl(fa2taur no0tpxnioctys a2ulnvs t)trtoir totfpD  u o;(  rurirpnodomenlfcilt)srrr(mpnu1tetomieiys a ulnmo t0 etnio oytopDrlneols0 etoxopno4lp e fcta(  Dta(mpnu0oee moetydfsDemumo t0 exrxo3iytfp rlueils)trtmimpnydlltn ieil( aDtax  no1tlxoiiciadls2ra( s;t4arenxf io1lpDeliei ()trtm(r iodamen nesat aDuax ont1tptnii3iyt a ranmsnt4tlxnxr oadom  ln ils seuoxr nodomeemicsls) Drru  ot0aeeo iciaslmDelnmsn(0 eeoir3tytomD lues t0truoxm3oo4ap nlfesas  Dtrur no1aexoioctldls um(vo;(4 rxnxf to1opD lnei s seto(m3iy1apenlfctat) Dtmxmpot0tle mociat s2raump;t0tetnmr3iydfa raivilt trurxo no4lle  ncsl(f 2rm(mont0tetn octat a2ulu s;u0texoio3iy1om elu o s) etmxmpiy1apenmfvtasfsrua(m nu4opto f3tysls2um(mont4alermfcoa1omte neols0sruoxrpoodam e ics t s2rr(ro;u0teen octas s2eanms u) leoiocty1om rln slt0s2uoxr3iy1omte fvils)srtaxmoot1texomietadfaDraums;u) rtrmo iytfate uvsl(0 ruoxrpiodlmtnlneilt)sDtrxroou1aeeo ieiatla rmu o;(0 etoio todfpt aivi;( s2uo(o3nu1lm   ict s  Drauronu1ape ii3iatla2ra(vp u0alxoir3tytlaDr n sl(  2uoxr oudap emnesatfa2rmxmp;t4oeto ictldlsDemuvp u)tlxnif3ty1fm   nvs s)trur(r3no1amtemivtlsfsDur(m nu0teto iciysfsDrau p;u0artrxo oadfptrluvs t srumio iy1olt lici sf Dumu pou4tpxoiociadfm eau o u4 etnif ootlaDeau ols0 rxm(opiy1omtnlfesas  2trum nt1aexoiiciltls el( pnu)arxoxo oytoaDeau i ( t2uo(opou1omeemfvt (fa2urxr ;t4aleomietasla2ran o t0aeeoxf tydfatrlues s0srtoxopno4omeelieslt  rtaumo;u4alto feiyd m um(mo;(4 rermfciodfaDelnei;(0trum(r iodomenmnes t)arumum ;u4tptnmfeildfa elumo u)altoxf iy1lm   uvs () rxo(o nodopeelieiasfaDum(  ;t0teenii3ildfsDul( p (4tleoir3iatfa rli s;t) 2xmxrpny1amenlncil()arrru ono1tlt ifcilt m2rmnmp;t0 eerifciotopDrai o s sexm(m oy1lmen icsatfs2ra(m oo0tetnmicildls2uluvs;t0aexoxrctodfaDraies;( s2tmxr oy1lpt lfeta(farraum no4openmf3iatfa uauvs t0aetrmo3oytop eau o;s texo(m3oodame  nci t)aDum(mpot0oetoifeiydfsDemu o (4arxomf3ty1lmDraivo (0 exoim3nu4ap  mnetat)sDtm(r nu0tltomf3iadlm2ean ont0aeenmrcoydom  lu o;s0 eto(opiu4lmtemnviat)arta(roou0texo ietyslaDul(vp (4tltnxfciydlmtelieilt)t2tr(r iy4alt  nesasf 2taxr no0ape miciatfsDuanvs (0 rxoxo iodom r u s ()s2xm(rpnydll n nvtat) Drm(ro;t4aetoifctytlmDeau sn(4alxoxo iodlp   nvi (0 rtoxo oudom emnetat srururo;u4tex  ictldfa2rm( pnt0 eermrciytfpDe n i;(0trtrir nu4apee ncslt a2rrumooo4tptnmfciadfmDemn pnu4aeenmr3iydoaD  n o;t0trto(o3iu4al  mfctasf rur( pnt1altn fetatlaDeauvp;u4artrxf tadopDe nvi t)texoio3ny4alt  netas  rurxm ;t4tet mi3ildfsDrau o;u0tlxrxo oo1laDr neil(0 2xm(m3nydlltnmfvtat)srumu onu0opx moetldfs uluvp;t4aeeoiocoy1opte neils) euoir iu4lmtelietatfarua( ooo1aexomf3tad a rlu s t4teermo totomtr u s;s0trto(mpnydlpee ictasfsrtru  oo0alt mf3tad aDrm(ms u4alxomfcoatfm  ai il()sexmio nudap  lneslt)aDumxm nt4ole mo3iysla umnmon(4 reoxo tytfm rluvs;(0 2toirpoo1amt  fvtltfs2rmu pnu4tlto fetyt m2uluvpn(0aexrxociy1oa eai o t)s2xmxopou1omeemieilt) Drmx o;u4olx mociatlmDeanms;u0 rxnifciatlmt au i t) eumxopnu1lleelneilsfarraxrono4alx  fetltlaDra(vo u4altrifctydfmDelnvils0sexo(rpoy1lpe miviltfs2ua(m nt1ole ioetas sDum( o t)aleoifciytfm rlueols0truoxo iodalen ict s) rtrump;o4apeo o3iasfaDemnmonu4 rxoxrcoy1fp rlivo;(0s2trxr oy1lmtemnesasfs2urumono1apeoiiciatlsDuauvs t4arxnmociy1om  au i ( teuo(o ou4altnmiesatfs2tru p;o1alxomictysfa2rauvsnt4teenxf3iotopD auvi;(0 2tmxopoy1lltn ieilsfsDrmx o;u4teeomo3tatlsDulnvp;() etnifcio1om  ai i;()t2tm(o oy4lmtn icsas arurxmpoo1altnmi3iatfm ulums;u)artrif3iodfpteau i t0teuoxrpny4omee nes tf 2rmxmo;o4tle mf3iydfsDea(vo ()tlenir3iotlm e u ols  rxmxm iy4omtnlnvtat)aDtmumpot4aetnmoeilsfsDrau p;(4 rtnif3ta1lmDranvi s)srtoir iy4opt lnvtltf 2ta( pnu0alxn ietatfa umu s ()areomrctatfat au s s  eur(rpno1lle mfetlt srrmu pnt0tle mo3tlt a2um( s;()trenif3totlpt  ieil( seuo(o3io1omen ietat aDtrxm nt0apenmf3ildls2elu o;(4tlxomf3iadfm  li o t0 exo(opoudoptnlfvi ()a2tm(r nu0tle iieiaslaDumu o u) rxnxf3ta1opDrlivols)sexrxm3no4aptemfcsa(farraur nu0tlxoifetat m2rlnmo;u0trtnxr oy1lmt liei;(0 etmir3ou1optn ivsat) rumxm ot1apx ioeiyt s rl(vp;t4 eerir tadlatr nvs;s0 rum(o oo1am nliesas)aDrmum ;o1olenmi3iyd a2elu onu0aetoxo oo1laD  ivo s  euoxrpiydol elivtas)s2tau pnu4tet moeiltfa eau on(4tlxoio3oy1fmtrln i;t seto(m oo1ol eliciltfsDrm(root1tet mictlslm2umn snu4 etrmo3oydoate ivs (0 2umxrpnodolte nctl(f 2ua(  ;o1aexomi3iysla2rmu sn()teenxo3totlaD lnvo t)texr(mpio1ameelfes (fs2rmx p;u4aeenmictydlm2ua(mp u)aleomocia1latelueilt)trum(o oydale  fesa( aDra( pno1olxnmi3tadls el(mpn() ltoxf io1fmD  nvi t)srtoiopoo1ome liesat)s2um(  ;u1aleniiciasfs ran snt)trerxocto1fa   nei;t)t2trim oudolt  fvt () Duau  oo0oeenmfeiatfaDean p t) rtnmfctydoa ranei;() rtm(o3io4ome mneiatf 2uaxm ;o4ale mi3iyt sDrmn onu)alenmf tydlmteauvsls) 2uoxm3oydol  mfvt t)a2rr(r oo1oee ioctlt sDulu ont)areoiociydlm   uvi s0 rxoir ou4lpen ictlsf rtr(r ou0aleomieils aDumn pn(4 rtoif io1la  luvs;(  exr(mpiudomtelietlt) ruau p;u0aleniociytfs2uan pnt)aeeomrciytfp   u ols  rtmir oy1aleemfvtlsfa2rm(moou4tpxo o3tld sDua(ms u0aeermf oy1lmt liesl( tetrim oo1lmt  icta()sruaumpou4opt  fctas a uln s t)alxomo oo1oaDr u o;s)srxm(r oy4lpte fct sfaDur(roou0texnmieils aDrln s (4 ltrmf tytfpD  neo;s trxo(opnu1am n nciat)sDrmx  nu4tpxnii3iasfaDran s t0aexrif3iytlmtean sls0 rxrxr ny4ol nmfeilt)aDta(moou4aex  oeiatfaDulump u)tltnifcoy1omt  iei (0 2umxr ou4ame  ncilt aDtmumo;u0aeto ieiysls rlums u)aexoxf ootoa  an sl()trxo(o3nudaleemfcsas)artrxroou4apxoioeiys mDrau o u4 exnmo iadoa rlu i s0 rxm(o3oydal nlfvi t  rra( poo4tpenio3iysla2emn on(0aeerif3iy1faDr nei t) etm(r oodopeelncs s)aruaxmp;t1tptomi3iytla rmnmsn(0aeerxo3tadla rai slt  etoxrpno1oltnlivs ()arrr(  ou0tlxo i3tls sDua(mp;() exnmocoydlpDeau i;t0 rur(opoodlp n neil(f Dtmx poo0tle mietas s em(ms u4 exnxf oo1fp rlu i;()trxoir3nu4alen fet sfarrax pno0opeomfetytls elnvs;t4aexrir3todfm rlnes;s)seumim3iu4olt lfet s) rtm( p;o4ope mfctys aDua(vo;(0 etrxfciadfm e i o t0 eumio oodaleemneiasfs2ur(ro;o4aleomfctld mDrlums t4tlxrxr todfa rln olt  2tm(o oy1lltnlivt sfsDrr( oou0aexnif3tlsfm2eau s;u4trxomr3iytlptraies;t0 etr(o oodamte nvtatfa2ta( ono4oexo ocilsfm umuvp;t) lxrio oydlmt  i ilt0 rxm(r3nu1lp  mfvtlt)srrmxrp;u4tpeomiciad s2rl(vs t) lerxf3todomD luesl(0 2xoxm3ny1opeelici s a2rr(mont4olxnio3iatfs2ea( s;t0 exoxr tatfm   n o t0s2xm(opou4ape  nciatfaDurxm ;o0olx  ictls m eanmo (0texoio3oatlaD ai i s trxoir3ou4ape  nesas srtmu ooo0ape  fciyd a2el(mont4trtniocootomtrlies ( s2urxo3nu4ll emfvsatfsDuaur ou0tpxnmf3iltfa2rlumo u0aetrxrcoo1lpteaivsls  2ur(m3ny4lltn ieslt sDuru  ot4oee mi3ias aDeaumpnt0trxomr tatfm elues;t  exo(o nodomee ivsat s2rr( p;u4altn f3ildfa emnmp;u0 exoxo iytlaD  uvilt  2xmir oodlm n nviasfs2ra(  ;t0aetn fctlsfmDul(vs t)texrio iotop   u o t0srxr(r no1alenlnetl(  rrau oot1apx io3iasfaDumums u) lxoxfctytlat lnvsls)srxm(o3nodal  lfvtas arum(mo;o0tptoif3ild a2elnvp;u) ltnxrcto1fpDelnvs;()sexm(m nu1aptelicsas a2rmump;u0tptoiociyslm ra( o t4 exomr3tatopD ai ils0 2trxo3nydalt lnvs t artax onu4alen o3ilt m2ra(vp (0 renxr ia1opD  ueo t0 exr(opio1ll elnviatfsrurur ;t4olt  fciadls ra( s;(4 renxr iy1lpDraies s) exriopoydope mfvi s  2ra(r ou0tptnii3iysls2ulnvo;u0texoif3iodlmDrlneo;( sexm(m nu1ll nlnei sfa2tmur ;o4apenif3ias s ua( s;(4aexnmo3oa1la e nvolt0t2xrio3oo1altemnvs (f 2trxr oo0oetnmf3ild aDrmnvp t0tetomo iytfpD lnvs t t2umxmpoydll  lnetltf Dtr( o;u4aeenmi3iatfaDrmnvpnu4tlxnircoa1fpD lu ils trxoim oo1optelfei tf rurxmonu0ape moeiltfm ra(vp (4 etnif tytfa eauvo;t srxo(o iy4opt mfvtatf 2tmx pnt0olen f3iatlaDea(mp u4aeenio iydlmD  neil(  rto(o3iu4lm e fetatfa2um(r ou4oet moeils s ulnmp t0tlxnxfcoadfmteluei s)t2uoimpio4ap elfei t s2rrxrooo0tetnmociytfaDuau pnt) rxnmf ootlpteai s;t)srtrxmpno4opee nesl() Dtmumo;o4tptnioctlt m rm(vs;t4areoxfciy1fatrlivols)t2trxrpnu4lmenmnvt ()srrrxrpno4oetoifeiasls raumo;(4 ltrmoctodfm  lieils)tetrimpiodomtelfvi sfarta(  ;o4teto ocild m elnmp;t)tetnifciodom  au ils0seumim3nu4amtnlfvias)aDtm( p;u1oeeomfeilsfs2umu on()tlenmf oodopDe nei;t0 eurim3nodlmte nvilt  Duaxm nt1olxomoeiysfs elu pnu0artrxf oo1opDrliei ()t2umxr3no1apt  feiltfa2ur(mo;t0oet  o3ildfsDeanvo;(4trxnir3oatlm ranvols0trtmxo3no1omenmneil()sDtrx pnu1olxo o3ils mDrmu p t0aeenio3oatfmDrauvi s0tetmio3ou4al emncslt)a2urxm ou4alxoiociadla2el(ms;t) rxrifctadlmt lueo s sexmim3iudaptnlncsl(fs2rru  ;t4oetnmictasla2rlums t)texoxocoytom rlnvilt setrxo3io4ope mivs (fartrxr no0aexomicilsla2eauvp u4 rtnir iotla r u s (0trtr(mpoydlmenlnei sfsDur(rp;t4aeeoio3ildfaDul(vpn()arerxocoadomDeau ols truo(rpiodam  lfei (f 2tr( onu1tpt ifetldfa el( s;t4 etrxr3io1fpteaueo;s0trto(m3nu1aptnlicia(f rrm(m ou4oexnifeiat m2ea(mp;()tltoxf totop e ies t s2xo(opio4aleelneslt)sDtmxronu0oleomictydfa2umnmpnt0tlenmfciadoatraueilt  rum(opiy4omt lictls  2rrxm nu0aleomociat mDrlnms t)aeeomo3oodfa   n o;()texmxo3iu1ol nmictatfsrta( onu1alxn o3ildfa rmnmonu)aeenir3ta1fmD  nvs (0tetoir3oydapeelfcsl(fsrrr( pnt4openmo3iadla2elu sn(4 rtrxr3tatoaDelnei ()trxr(o nu4apeelnvi sfa2trxm ;u1tptn fciysfm2ranvpnt0tlerirciydom  livsl(0 rtr(opnu4ameelivt tf rrrxront4tpxomociat aDuanmsnu0arenif3tydlatr ivo s)srurxopoudlle lfcs sfsDurxrp;u1tlxnmociysfs elump t0 etrxociy1fmtelueo;s sexoirpoy1lp  mivtl(faDrmur nu0tlen f3tasla2eaums t0aexnio3oodop rlu s s0 eurirpoo1ape lfes (fa2rru ont0altn ociys m2ea(ms;(0aeermrcta1lat auvo ( s2urxm3oy1olenlnesas)artaxmono4opxomfctls mDrmu s;u0aleomo3oo1fptran s (  eumir3ny4ope mnvs s)srtru  nt1altoii3ias sDel( o t0altrir todfatean o (0setm(rpiudal nmnvtas  rur(m no1oexn oeildls em( p t0 etnmfcoa1lpt lu ols) rtmiopoo1aptnmncils)aDrmu oou0oltnmfciasla2rm(vont4altrxo3io1fat  n o t)s2xr(o3no4openlncsasfaDtaumoot1tetomo3tas m ra( pn(4 rxoir3iatfmt  neo;t  exrxo iudop nlnvias arua(r ;t1tpx  oeiyslmDel(vp t0 rtoxr3iytfpte neil(0texmir3oy1ap elfeias)srrrur oo4tpeomietytfa rmnms t4 exnxr3oy1fpDe ieo;t0setmirpoy4altn iesltf 2urxro;o1tlxoiieiatfa rauvp t) lxrio3iodlmtraivils srxmxm3iudllenmicil(faDtr( p;t1oltnmocilsfm2rm( p u) renir iy1lm eaieo;t)t2xoimpoy1ap emneils) rtm(mo;u0apxnif3iytlaDrl(mo;(0trermr3oatomt lueo;( t2xoxm3ou4lm e iesl(faDum(  no1tptomf3ilt s2rlnvs ()alxoio iotlatrauvo;s)sexrim ou4openlnciatf rta( pot4olxoif3tys a ua(mo;u) rermociydoa eaiei (  2xrxr3oy1lpeemncias)s2ra( ooo1alxomo3taslmDumuvs;t4tetnxf tatlmt au slt) 2uo(rpny1oltnmfvt t)s2ua(m ;u1opxn feiaslm2ulnmsnt4artoif3oadlm rai s;()t2toxo ou4lptelfeiltf rtmxm no0teeomociyd mDumums;u0 rxnxo3ootfmtelivi s0setr(m oy1omtnlfesl(f Dtr( onu4apxoii3ildfm2ra( s t0trerifcta1omDrlivo;s trxmimpiy4oleemfvsa( srtr(rono0aet moeils a2rau p;(0 eeoxf3iotlm   nes;(  eurimpny1lptnlfvil(fsruaxroot1texomi3iltfa2el(vs;(4artomociodfpDraivo s s2trxmpoodal n fvsa() ruaxr ou4apxn i3tatlmDeanmpn(0 rxomocoo1fat  uvs t0 2umxr nu1ap n nct s) Dur(r nt0altn ieildfmDul(vp u) rtnir3ta1oa  luvi;(0 eumiopou4ame mfei ( a2um(r ;u1alx  fciltls ra(ms;t)trtrxfcio1oatr neo;( texr(m iu1llenlnei (farrrxm ou0oexoii3iydfs eanms;(0aeeoxf3oo1opte ivs () euoxm ny1lmtnlfctas)sDtaxmp;o4tptnmf3ilsls rmn o;t0 lenmf3oadomt  u i s0setmxrpoo4amen fvt t arraumo;t1alt iietyt a2ua(ms u)tlenifciy1lpte neils seuo(o3ny4olee icsat arraxmpno1oexnmoeiyt mDra(mo;t0 rtoxf3iy1om  luesls)tetmirpio4ome  iei ()s2tau pno0opeoifctltfs2rmnvo;u0arenifcootoptrlu i;t)t2trxopiy1op e ivtlt aDraur ou4tlxn i3tadlmDeanmp;u)areoxfcto1oaD li il(0 euoio3io4llenmivt s aDrrxr nu4alxo fcias m rln onu4trtrxo3ootlmDr uesl( texm(rpnydlleelivil(f Dur(ronu4texnmoeiysla2ran sn(4arxoir3to1lmtrlivilt) etrir iudllt mivs s)sDum(m nu0olen ocias m2em( snt)tetoxo3oadfaDrli il()srumxopiydamtemiesa( a2taxmp;t4tle io3iyd s ranvs;u0trenmoctodfpD aiei;() etoio no1ol  mnei s)srra(m nt0oetnmictadfa elnvp;t0arxoxr oy1la r neo (0trxmim oo1lmeemnet tfaDtru p;t1tleomo3iasfmDel(vsnu0 lxrmr3iatomDelueol( srxoim iu1am n fviatfsrtrxmooo4altoii3tatfs2rm(vp (4 ltrxr3oy1lmD aivi t) 2trir ou4al nmfcsa()a2tmurp;u0tpeoioetadlm2ua( o t) rxnir ty1fm rlieilt)texrxm3no1lp e iesl( sDrr(  nu1opxn ictldfs2uluvsnt)aetnio oytfmD li o;s teur(m3no4om e icsas)sDrrum ;t1tlenmociltfs uanmp;(4aetoiociotfm elneo;() rxr(mpoudomtn ncs tfaDtr( pou0apen i3ild sDumuvonu) eeoifciodoateli i t0t2ur(r iy1am n icilsf Dta(m ;t0olenmo3tydfa2ua( ont)texrxrciydom eauvils sexrxmpnu4lle  iet tfsrtr(moou0olxoii3tytla um(mpn(0aetnio io1fpt  nei t)srxm(opoodlmtnmici s  rrmu pno1aex iociysfs2uluvpnt4alxnmrctadomDelnvils)trurxo iodapte iesat  rrau pno4oex ioeiltfa elnmp t)alxrxrctodoa rlueo t) rxm(rpio4lltemnvils)srrrxmo;u4alxnioeildla2umn o;t4 etrmociy1fmtelnvils tetrirpnydope mnciltf rururp;u1tleo feiydfs2ra( p t)arxnmf oytlmD ln sl() exoxmpnudaltnlicta( a2tr(r ot4opxn iciydfa umuvo;t4texriocty1lpte ues;(0t2xo(rpnodal  lnvil(f Dtauront1oltniieilt mDra( pn(4 leoiocoo1lm elnei s0 2umxopny1amt livsasf 2urxmpou0teenif3iydfaDumumpnt4 exrirctotlm ean s t trxoimpoy4omtemfesltfartm(moou0altoifeiadfs ul(mo u)trxomocoadlmtr n o;t  etrxrpoudaltnmieias  2ururono1oex mfeiyslmDranvo;u0aexomocoo1fp rauvilt0 eto(m3ny4olte fvt s) 2trx  oo0opx mo3iysfa2ulnvont)trermrctytfp rauvsls seurxmpoy4ap  mfcias)srrmu pno0oltnifetasfs rmu p u4 lxrir oatfm   ieols  2xmir3oodope mfes t  2uax onu4apenifciyt mDul(vo u4 ltomrciytoat  i ilt texmir nydlpee iviat  2tr(mpot4tpxomi3iydfm ra( p;t)arxnio3ty1lmt livo;() rxm(mpnu4oltnmnetlsf 2tau  ot0tltn fetasfa uln p ()teenxo3tydfpt li ol(0srxrim3nu1ol  mfvia( sDtmur ;o1olx mfeild m2ulnvp;t) rxnmo oodfaDeanvo;s0 eur(o3iy1lltnmiesl(faruaxrpoo1oltniicilsfa2rl(msn()trtnmfcty1fatrli i t0 etrxmpio1ol  lncsa() rtrur ot4aetomoctlslm2ea(vonu4 lenmr3iydop ran ilt t2triopiydopenmncsl()sruax  nt4tptn oeiydla ranmont4artrxo3iytopDeluvs;s setm(r3ou4lp emneil(fa2rm( o;t4aleo o3tls sDrlnvo;()trenmfciotfat  nvs;s trumir nydamenmnvsl( aDtr(r ou1ape ii3ildlmDumnmo ()aetrxr oytfat lu ilt0sexm(m3nu4am nmncs s) Dta(m nu1apeoio3iatla emumo;u)tetomocoa1lp e ies;()trtmxm3ou1ale  iviltfaDtrxmp;u0tpen fetysfs2el(vpnt)trtrmfcio1faDr i ols trtm(o3nudam  lnes s) ruaxmo;u4tpe if3iydfa umn pnt4 ltrio3todfmteln ol()texrxopoy1omtnmieil()s2tr(rpoo1alxniiciyd aDrm(mo;u0altniocia1la rlueol()sruoxr3no4apt lfeils) Dtrx o;u1optnmociltls2rlnms t)tetomo oatfpD aieo t)srtmim nu4lp  lnvslsfaDtaumoot4alxomfciadfm2ea(msnt)tlxnircoy1optrauvol(0 euo(r3oy4ap e fct sfsDur( pou4olxn fciatfs2rmn p;(4 eenir3ty1laDeli ols s2umio oydom e fet (fs2umu  nt0texniieiydfa um(ms;u0texoif to1op e neo s0trum(opiu1altemncia()arrmxm oo0aetnio3tadfa2raump;t)teenif oodoa   ivo t sruoio3iu4ope  fctls s2trurpnt0texnif3iltls um(vo t)aetnxrciydoptrlueil(0 eto(o oy4llt lies t)sDuaxrpnt1oexnmoeiltlsDumump;t0alxrxfctytfpDr nesls0 etrxrpny1oltelnetlsfa2um(mont4olxn i3tatfm2eln p;()aeerxo ta1laD lnes;t0seurir oo4al   iesls arta(mo;u0apx iietls sDum(mp;u4altnmfciatfp r ivils0s2xoio3iudame  fvtasfarrr(m ;u1oee mociydls rlums t0tltoxr3iydlmDelu ol()trtr(rpoy1om emicsas arrax  no4tptoiociadfa el(mon(4 ltrxr io1oaD  ues s0 rtoxrpoodapee ietlt  rurur nu0alxnmoetat s2uanvsnt4 rtoif ia1fmD aues t)t2xm(m nodapeemict sfsDta(moou4ale  oetyd sDranvpn(4arxrxrciodopteanei;()srurxmpnudlpt mfesl(f 2tax pot1tlxo fciysfs2ulnvsn(4aexrmfciotoptraivo;s0trxrirpnydale mfviltf rrm(mpnt0texo ictadla2rmumsn(0aeeoxfcty1fatrau olt)t2umir3no1omt lnetl(fsDtr( onu1tpx  fetyt sDem( ont4 lxnmoctadoa elueo s0s2xo(o oydap  lfet tfsDtm(mont4tet  oetasfa ran s;u)areomo totfate ivi;()teurxm3no4optn ics tf 2raxroot4tlxn oeilsfm rl(mp (0tetnmrcoodfa rauvs t tetriopiodol e fcils)a2rm(mp;o4alxn fciydfs2el(vs ()tltoircoa1lp e nvslt  rxmxo oodam nlfvils  Dumx pnu1tpxoifciyd sDulu s;(0 etnmr3oydlm  lnvs;s)sexoiopnodap  mnet sfa2ua(  oo1apx  ieiytfaDrauvp;u4alxoxf oodop rli slt0 rurir3nydap nlncia() Dtrurpno1aptomf3tadfaDemu s ()arxrxrcoydlpDrluei t)trxrxr io4om  lfvi ()s2rmur ;o1apxo o3tasls ran onu4tlxrxf3oy1fmD aivo;s0srxoir3iy1lmenmfct ()srrm(mp;o4tltn ictatfmDum(msnt4 rxnxocio1omDelu slt0 2urxo iu4amen fesas  Drax p;t0oetnio3ils a2ua(mo u4aetrio3iotfpt auvsl()s2tmimpno1omee nctatfartmumpou1tpx mf3tytfmDem(vsnt)teenmocia1fmD anvo (0teto(r3oudam e nctl() rtaxrpoo4tet  i3iydfsDrauvon(4 ltnmo3iy1lp  livilt)s2xoim3io1amtnlivt (f rumxr ot1oee  oeiasla umnvs (4aeenmr3oodoa  liesls s2tr(opnydam emiei t)s2urxm ;o4texomf3iys aDel(vsnu4aleomrciotlpDelnvo (0srur(r iu4ameemncs sfartm(mp;u1oltnii3ild a2ulump;u4aexrmo3ty1fptelueo;()trto(mpou1apee iviat aDrmxr ;t4tltnioetaslaDrauvs ()tetoif3tatop ran s ()texmxr3no4ll  mfvtlsf rum(m ;u0altn oeiat aDeluvsnu)texrir tydlpD  ivs;s  2triopiy1lmte nvi t a2ra( ont4aptnmf3ildfa uan p;(0aetnir oy1fptr nes;(0seurir nu4lme miei tf Dta( pnu1apxomf3tlt a2uau p;t4tltoxo to1lmte ies t texmxo ny1opt mfvsl(fsruau  oo4tlx ifeiad m uan p;(4 rxnxo3iodlpDeau ils0srxo(rpny4lm n feiat) rua(monu0aptoio3tydfa uauvsn() ltomrcto1fmtrlieils)trxm(rpnu4aptnmnesl()sDrau pot1opt iocilsls umuvo;u4artnmo3oytfp rlnvo () 2uoxo3ou4amte neias a2ur(r no4oltnif3iadlsDean o t)alxrmrciotoa   ieilt  rxrxm no4amen fcsasfsrrr(rpoo0opto i3iysfs um(mpnt0trtrif oo1oatrluvi;t0tetr(m3oy1ol  mnctas  2trurp;t0olxniociydls raumo ()altrxf3iytomDr u o;s)srtmio3iu4ameemfcias)artmx pou4apto i3tysfsDrmump;u0tlxoxoctatfatr ivs;s0trxriopoudale lfctltf rrr(mo;o4alxoif3tytfs uaumsnu) eenmo3io1opD aies (0tetrxo3io1ap nlncilt  Dur(mpot0aexn fetld a ea(mo (4texnio3io1opDe uvsls) ruoio3oy4llee fvi (  Drmxr no1oeeoiociydfm em(mo t0 leoxf iadop rau s;s0 rxrir3iudll elfvi s  2raumo;t0aet  f3ild sDel( onu0trxoxf iydopDe u s;s  2xoiopiudam  mfcilt  rtm(rp;t1altnif3iys mDem(ms (4aeenxr tytop  anei t0trxo(opnu1llee fci sfsDraxrpnu1tpt  fciyd s2ua( on()artnio oatlpD aneols)srtoir iydlmte fviasfsrrr(r ou1tlt moctysfs rau s;t0tlerxf ia1lptean i ()s2tmio3oo1lp  mfeil(f rurump;t1tlxn icias aDua(mpn() eeomfcto1opteaieo;( texmxrpno4lmte nciltfarur(mono1ale  fciyt a ean s (0artoir3ia1fmDraivi t) 2xmim3io1lpeemnct t)s2umxmp;t0aee mfciysls rm(vpnu4 ltomf3iadoaDean s (0trto(o3iy1al  lfci tf Drr(  nt0texoif3tytfm2ra(ms t4 lxnxfcootoptrauvils0srtrxr3iy4apenmfcsa()artru onu0tlto o3tydfa ra( o u4tetnio todfm  li o;s0setrxo3iodlmeeliesat arumxroou1opx mo3iadla2rl(ms;(0altomo3ta1lp rlu ols  rurimpoo4llt lnetls)a2rmurpoo4olt  ieiytlaDem(mp;t)aeermo to1oaDrau o;t0t2trirpnu4op  lnet t)aDuax  ;t0tetn ociadls umumonu)arenmo3ty1lmt anvil( trxoxm ny4oltemicta(faDtaum no1oleoif3tys s uluvp;t) exnxrciy1lpDe ivs s0sruoxr3ny4lpenmnetltfa2ta(r no0tlxoii3ildls rl(mon(0artnir tadlmtelnvi;t tetrxr3oy4amt lneils)artr( p;t0opt io3iydlaDumnvp u4 rerif3ootopte ivsls) 2xmxo3nu1ap  lieiltf 2ta(r ;o4apeoiictltfa2um( snu4tetnirciy1omtrlivslt0trtrxm3iudlmenmnesat  rurx pou4apxo f3tyt s uanvp u0trermr3tytlmD auvs ()srtrio nu4altemict t  2rrxm ot0aee mo3tatfa emu o;t0 lxnif3oa1fptelnvs t) 2um(m oy4op nlfctlt)sruaxr nt4tpxn ictat s2ulnvp ()artnif3ta1lptranes;s)seuo(opnudllen fcs sfaDtaurp;o0olx mfctyslm el( ont) rxnxfciy1om  aiei;( t2um(o nu1alt  ics sfsDtrumpoo0opx mieiytlsDran pn(4artnif3totoa   nes s0seuoio oodole  fvsas sDuaurpnu4aptoif3iytlaDeauvp;(0 rxrxrcootoa e i s;()trxr(opiu4olt lncias  Dumxr nt0aee  ieiaslm ea( s;(4tlermr3to1fpDeau ols s2ur(rpnodame lietas  rrm(r ot4aexnmo3ildfm2ulnvp;t) lerxrctodlat lneols  etriopny1oltelivi t  rua(mont0olenmiciat s umn ont4trxnxf3oydlpD lnei;s)s2tm(m io4alte net ( s2uax p;t0apxnifeilslm2elums (0 rxrmr io1lp   nvi;s) eum(m ny1lle mfeias sDurxr oo0aetnmo3tls sDuaumo t0tlermo iodlaD ai ils) rtoxm3iu1apeemnesltfaDtmu p;u1optoio3ildls elu o (0artnmf oy1lpteaieols truoxr nu4ale  ici s) 2rauro;u4aetnifctlt mDelnvont4arenmo3iodfpt li i;t seumir iy1apt lict s  2rmu p;o4apeoiieild m em(ms;(0 ltrir3iadfpD au o s texo(m3nudope mnvtat) Drax ono0apt  ieiydls um( o;t0tlxnmocia1op rlneslt0trtmxmpiu4olte nvilt aDrr(r ;o4aexoif3tyd sDrl(ms u0arenmrcoatlmD au s;t0t2tmim iy4ale  fei s sruax poo4oltn ociatfm2rmnvo u4tlxnmr oy1oatrluvs () eur(rpiodalee ivtl()aDumxmo;o1oet mieiydfsDumu o;() rtnifcoodla e nvil()t2urio3iu4omt mncilsfsrta(  ot4olxo fciatfsDulu p;t4alxoiocoadfptr ueo () 2trir3oo4amtnlncslt sDtm(roou1tlenmf3iydlaDumnms;t)trtomr oydfm ean i s s2to(m3io1olee fvsa(faDuru  oo1aetomi3tldlm2rm(vp t)tetrmf3tytfpDeluvs ( sexo(rpoo4al  mivsls)sDururpno1tptnmo3ils s2ua( p;u0 lxrmf3oydomDe n s ( s2uoxm ou4omenmnvilt)srtrx onu4opto ieiltlm2umuvpn(0 etnmf3ootlpt  ieo;t)trtr(o3ou4lme  ivtls)aDrm(r nt1alt ifctas sDuan pn(4arermf oa1oa r u il() exm(m3iu1llte ici ( aDtrx pou4oexo f3iyd a rau s;t0 ltrir3oodlateanvo;s)setoim oodolte ictlt)aDuru pnt1oee miciltla2uan o (0 leomoctydfmDeaueo;() eumxrpno1ll nmici tfarrm(r ou4apto feiat m el(mon(0tltnxr tytop   ivo;t) ruo(rpoy1al elfvta(fs2rmumpnt1opto o3iadls uau on(4trerxr3tadom rlnes s)t2uo(o nu4aptn fciat  rtaxmo;t1aet iiciad a ua(vo u0texrmrciydfp  lu o ( teum(o nodolee ivtlt arrmu  ;t1oex  ociytlm2em( onu)aexoxf3oo1opDeau ils  rur(m3iy4lmt  nvsa( a2um(  ;o4ape ioctlsfm2eaump;(0trerir oa1fmt  ueo t0s2umxm nodolt lieiasfarrru  no0tetomoeiyt s2el(msnt4aexoiociy1fptrauvi;() 2uriopoodlmenmfvi (f Dtmumo;t1optoiicildls ranms;u0trenmf oa1la  lnei;t texrir io4omte icilsfaDtrum ;o4tltomietatlm2uln s;(0 exoir3iytop   ueo;t0s2xrxr3nodameemnctat aDumumo;t4tpx  fcils m el(ms;u0trtrmf iotfa  luvo;(  rxoxr oy1omtn nci s arta(mpnt4texoioeiytfa ranvs;u0texnmf oo1om rlues ()s2xmxr iydlle mnet ( a2rax  nu0tpenii3ildls rmnmont4 rxomociotlpteliei s trxm(opiu1lm nmiesls a2tmu  nu4tlxnmoctldfm rlnvo t4tltnxrciadlp rauvslt) rtrxrpiu1ole lici (fsDraxro;t4aexo ociadls rmn o (0 rxnmf3ootla  au o s)t2uoxo3no4optn nci s)sDra(rpot4olxnmi3ild mDuan o ()trtoifcto1lmteaiei s0setmim3oudlpen fci t)aDur( p;t4opxomoeiytlsDua(vs u)texrmo3tadfa raiei;(0 rum(o ny1lpe  ics sfa2tax p;o0olxoiiciatla2ulu s;u4texomr oy1lmD auvs ( t2xmxo ou4lmtnmnvi s)arta(rp;t4alx iictlslm ean o (4alenmociodfa e n ils  etmiopno4omtnlfvsat)artaumpno1tet  oeiatla um( o u)treoxf3totfpte iei;( s2um(r iodlm n ietat aDurur ;o1oltn octlsfa2ul( s;(4 eenifciodoaD aieo s0 rxr(r oy4om n ivsl(faDrrumo;u1tlx  i3ildfsDulu o t4tlxoifciy1fpDrlnvols trxo(m nu4lp nmfcil()artmxrp;t4tpxnmfciltlm rmn p u) etrmf3oy1lptrln o s0teuoir nydam e nvs t  2uru p;t0tet mf3iyd aDuanmsnt4aetnir3oadomD  n s t)seum(o ou1lmen feils)artr( p;t0teenif3tldls2umu onu4aeenxf iodfp eaieslt trxrxr oodale  fcta( aDurxrooo4texn f3ilsfs2ul( p;u4artrxf iydoat lnvo s0trurxr3iudll nlietlt)aDrmu  nt1olenmocildfs rlump ()alxoxo3oa1fmteanes (0 etrirpoy1ol emfcs ()s2ta(rpot1tpto iciysfs ean o u4 exnmf3oodfatrli o;(0 etrio iodlpe lfetasf Drmumo;o1aleomfeiydfs2elnmo;(0 etnxo oa1fpD anesl( t2umxrpoudamtnlicsa(f 2rrurpot0oltnifetysfa2rauvp t4tltrio tatlpD aueils0trto(mpnu1lmtnlfctl()srrmu ont4ale mf3tlslmDeaump;()alenmoctadfateai i () rxmim nydaptnmfei sfsDtru onu4olx  oeild m2ea(vo
\ No newline at end of file
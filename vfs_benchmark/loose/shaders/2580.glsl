@@ -0,0 +1 @@
+uvi;s0trtrxo iy4ol e nvi (farurx  ;o1aexnif3tyt a uln o;(0tetrirciodoa rlivo ( trxr(opoo1amen fcsatfa2ua( oou1olt mieiadfm2em(vs ()trtrir3oodomD ai o;t t2toxr3no1lmtn netas)s2urum no4oetoifetatlm rln snt4 lenxf3ootopDr ues;(0 exm(o ny4lptnlnes (farrrxmoot0tetnmieiatla2emnmsnu0 ltoxo oa1faDelnes;()t2xmim nydal nlfvtas)sDua(rpou4olen ictas a ul(vont)arenxo3ootlaDeluvo (  rtoiopno1oleelfei (  rrau pnu4alenmfeiatfa rluvp u4tlenmfcia1faD aivi;s srxrxrpoy4al nmies t)srtrx poo4optniiciytla rm(mo t4 lenmoctydlp rauvil() 2umim nu4apte fcils) rum(rp;t0open fetas m el(mpn(0 ltnif3io1fmt aies s s2toxrpou1llt lictl( s2tru oou0tlen o3tyd mDeauvpnu)texrmfciatfa ean o;( trxoio3iydlpeelietls)a2tmxm ;t4aptniiciatfsDelnmp;(4artnir oydlmDe ieo ( teur(o3oy1om nmivsas)sDum(mo;u0aee miciasfs emnvp u0altrxr oydoptrln s s srtm(r oydopt  fvt s)arrr(r ot0tex iietlsfaDumuvs;(4alenircty1faDrluvs ( trumio oo4lp e fvia()aDrmxr nu0tleomf3tyt aDrlnvs (0 ltoxr ootlaDeauvs;() rtmimpio4apeelicta() ruru o;u1alto f3iasfm2uau ont0 lxoir ty1op eanvs;s s2tr(r3no4ole  fesasf Dtmxmooo0tpxnifeiadfs emuvpn(0trxrir3iy1om  anvo;(0srurxmpnu1ole liesa(f Dtrxrpnt0aex moetyd a2umn o;u4 rtrmr3oatopDraivol( t2umio3iy1omt  ivtat srur(r ;u4tlto ieiadfmDrl(vo ()aetoxf ty1laD anvslt  exo(m3ny4om  liesas  2trurp;u1alxn iciadla2umnmp;u0aetrxo iodfaDr ieo;(0 rxrir no4olt lfctl(  rta(rpnt1altn o3iydlm ea( s u0trerxo3oo1lmtraieil(0teuoio nu4apeelncs t  Duaum ;t4tlen i3tas mDemump u) rtrmf3ootlpDe u o;s  exoir iy1aptemneils) rurx pnt1texomf3iasla2rmnvs t0tlxrmfctadlaDean o;(  rurimpiy1lpee fvia(fa2rau onu0alt moeiysfs2uanvpnu)alenmo ta1om  aivo ()s2uoir3nodolenmfvt s sDrrxmpnu1aeenmi3iydfmDuauvo;u4tlxrmr3iotomD  ieo ()s2toir3nu1llt  nvsa(farum(rpno0aexoifeiad mDumn p u) rtoirctatlpDeluvslt)trxmxo ny4lptnmfvsltfarua( o;o4tpeo iciadlsDrl(vs;u) ltrxocoytfmDe u o t)sexoim3oo4amenmivi (f 2raump;o4tex moeiaslaDum(vpnu0 etrifctodlaDelivo;( trto(r3io4omenlfcs tf 2um( pou0tpxn octatla uauvo;u4alxoxo3ootfa rlueo;(  2tm(r3ou1lpeelicsa( aDtm(rp;t0ole mo3iys sDelnvo;(4arxoxf3iatfp eanvo;t0setrimpoydaltelieia()a2taxroot0opeo oeiyd sDuaump;t4artnif tydfaD lueo;s)srtm(m iydllenmfvta()s2tmx poo1tet  ieiat s ulu s;t4tlenif oodfa r nvs s0 etrio3oo4amtnlnctasf Dtmu  ;o1tpe ifctad aDeluvo;u0trenio3oytfat aneolt) rxoxm iydoleemneias)aDra( onu0tee ifeilt m emuvsn(0aleomocty1fpteauvil( seuoxm no4lmenmneiat) Dumxmpno4apeo feiadfm umuvs (0alxnio3tadoaDe nvol(0trxo(mpiu1lp emictatfsrua(rpno4alxn i3ildfa ranmon()trenxr3tadlpDr ivol(  exmxrpnydol elfes s sDuaumoot1tleo ocilt s um(mo;t) eeniocia1late nvo t)t2trxo ny4op  licsl( srrrumonu1aee ioctas s ua(mp;u0aeeomf3tytfpDelnvi ()s2uriopou1aleelneilt  rrm( p;u0opxnmoeiad sDel( snu4tlxrxf3iytlptrlu i () ruoxr nydopt  feils) rraurp;o0texoii3iydlm2emn onu0 etrioctydfaDrlies () 2to(r nudoleemiesl( arrr(r no1teto ociytlm umn on(4trtomo3oa1fm e u s s0seurxo iydlptnlfct tfsrumum no4olto i3tlsla2uan s;()tetrioctotfmt aies;s0tetrio3iu4ap  mfvtltf rrrumono4olenif3ilt aDrm(vo;(0alxniociydla elu ilt0 exr(o ou4lpt mieslt sDrrxm no4aetnmf3iydls uanvpn(0alxnmociy1opteli i;( t2xoio iu4alt mnvt s sDuru  ;o1aptoifctlsla2elu o u4aetrio3iytlateau olt tetrxo no1olt mnciasfa2trx  ou0aetomfciaslsDulu o t0trtrxo3iytla eau o;t0 2tmio3no4oleelnctl()a2uaurp;t1oex iicildlaDea( s;u)teeoxocoo1fmteai s s trxr(r3nu1lpt lfeslsf rtmxr oo1tlxniociltlm2eauvo t0 etnirctatom e i i (0seto(r3ou1openlfcsltf 2rrumooo4ole io3iadfmDulu snu4altrio ootlpDelies;t  2urimpiudol n fetls)s2raumono0oexoif3tadlaDua( o t4 lenmf3oa1laDr n o ()teum(r3nu1ope mfcsasfs2tmu  ;t4olxomi3iad s2eln o;t0 rtrmoctydlpteli i s s2toir3nu4al  mivtat)sDrm(r ;u4tee  f3iatlmDem(mp;u4tlxrxf3todfatr nvs (  ruoxo iydope  ncslt  2trxmo;u0tet mfeilt mDel( p;()arerxo3io1latrln i;(0trxm(mpio1ale  feslt) Drrx oot4tltoiietatfa2ulnms;t0aeeoxr3todfp raues (0 etm(mpnodop  livsatfs2tr(rp;u4aptomfcilt m2uan snt)tleomo3oo1fa rlnvo ()trtm(r3nudllt  fcta( arraxmooo0tex  i3iatfs em(vp;(0tetoir iatfaDr iei t0 2to(mpnudom  livtatfa2uaxrpnt0aeeomieiadlm rl(mp ()aetoif3ta1lm eaivs t)t2xoxmpoydamtnlfesls srrmxm nt4tpenmoctls s2ea(mo;()tlxnio3tadom   u ols t2xo(rpiu4ol  mfvsasfs2rm(  nu0alxo fetad s2rauvo u4 lxrif3oadomtelnvslt trxr(r nu1om e fvil(fsDur(moou4apt ifetas a2eaumo (0tlerxf oadlmt li ilt s2trxmpoo4lpt lnciatf rumxrooo4ale ioetyt a umuvo;() lenmocoodfa  aivi;t0teuriopoodom  mict t  2tm(moou0oeto o3ildfsDelumo u0artoxf3oa1om elnes (  exmxr iu1lpt liet tfs2tm( pou1tltnmoetatfsDrluvp (0 lxomr oy1fm r nvils0tetrim3nydam nliei () rrmxmo;t0oetoio3ilsfs2um(vp t4 exomr to1la  anes;s) rto(r3ou4omtn iesl( srrau oou1opt mfciyd s2eanvont4artomrctydfm  auvolt0sruoxo3oodale livia( s2uau  ;u1opto ictas a rauvo;(0arxomr io1opt auei t0 etm(r3iudlm   fei ( srraxroot4apenmoctldfsDra( s (0trtrxr iatlptelieo;t srtrxm3iudoltn fcil()arrr(  nu4teeomieiltla rlu snu)aeenir3io1lp  luei ( s2trxr iu4amenliei ( s2rax pou1teen iciasfm ran s ()trxnmr tytla ranvs;s)srtr(o3oydamtnlnct s  2tauront0alx mo3ilt m2uan ont4 exnmfcto1fmDelivsl(0 rxoxo3iu1lmee nesatfs2ra(rpnu1tpxomfctytlsDul(ms;()tlxoifciatfpD aivol( srtoim no1om nlfeias)s2ururpno4oee io3iys s rm( o t) lxomr oadfp e n s t0tetrir3nydlp elivsa( a2uaxmo;t1optnioctlsfaDrl(vsnt0 rtoxr3oatlpDe uvsl(  etoio oudop nmneilsf Dtaur no1aeenio3tyd s2ul(mo;(0 lenir3oodopteaiei s0 euoio3oodalte ncsa(  2taxm ;u4tlxo iciytla emn onu) rtoxfctydfa rli sls  2tmxr3oodlp e feil(  Draurpoo4oeeomo3tlt s ua(ms (0aetrmo3oytlm r ieils)s2trxopno1lmenmfctasf 2raum no4oeeo i3iaslm ra( o;u0 rtnxo iytfp rauvo s  exoxo3nodaltemfeils sDtrxrpnu4oeeo fetlsls2elumo t4tetrif ootlpteauvil()sexm(o3oudam elnct t)a2uaxmo;t1opto feiysfa rlums;u4aetnxf3totop e ivi ( s2tm(opiodoptnmfcsas  Drrx ono1aee ioctat a2ran pn()artrir oy1fa rlnvi;s) 2xrxr ny4apenlfei (  2rmx ont1tet  i3ilsfm2ua(mo;t0altnirciytlpDraueol( trxm(opiy1apte fvtlt) Duaxmpnu1tptomf3tytfa2uanms t)trtnmrctotoa e neils0srxrio ny1omtnmiesa(fsrrm(m nt1aetomo3iat m2ra( o;t0aetrmo ta1lpDeaueols trxm(mpoo4lle lfvs t aDrmx pou0opeomoeild a2ulnvs;()trenxoctodla   i slt)t2trirpou4ole lnvi (fs2trur ou1oex  iciadla2ea(vo (4 reoif todfmDr uvo;s)srtrxopiodlmt lneslt) Drrumpou1tet io3tasls2um(ms u4arxrir3iadfmDe i s;t0t2um(r3ny1am nlieilt  2ur(ronu1oee miciydlsDea(vonu4aleoio ia1lm ranvslt0 2xr(mpnu1apt lnct ( aDta( pnu1teen feiysla rlu o u4trtnmo3oydopDean ils t2xr(o nudlptnmfcsl() Dta(rooo0apen fetyslmDeanvs;(4altrxr3oy1om rau s s0srtrxm3no4lmeemfvslt)artmxr ;u1olxnioetad aDuanvsn(4 lxoio3iadfmDr nei;s)trum(r iy1op e fcsa( aDumx pnu4oetoiociysla elu o u0aleoio3oodom r n i;( srumio3ou1am  mivia(farurump;t4optomieildfs rl(mo t0trtoxrcoytop rau s s)trxmxr oudom nmfvi t aDrmumpou0tetn oeiyt s2uau s (0aetomo3oy1op eaneols)s2xmxo3ny4ome mivtasfarrrx onu4opt iiciatfm umnmont0texrxociydfmDranei;(0 euo(o3oo4optn ici sf 2rrxmonu0oexnmf3tyt a ulu onu4tltrxf oo1opt  nei t  euo(rpno1ame  ict t  Dtru pnt4oet mfetltfa2em( snt4aleoircia1fmD aueo;(  etmxo io4openlfvt (  2rmurooo0opx iiciatfaDuanmo u)trtrxocty1opt aies;(  rxmirpou1alenlfctas srtmxmpot4opt ii3ilt s ua(vo u)arenifctydlm  aivi;()seumio3ny1al  mfetas)a2rmxr ;o4opxnifeilsfm emnmo;(0artoxr3totopt ln o s seum(mpoo1lptemnvt sfsrtmxrpnt4olen f3iyd sDemn o t4aeenxoctadfaDrlueo s)s2xm(opny4lpee fetls  2rruro;o0tlenmoeildla umnms;u4tetoir ty1lateli slt) eum(o3oy4am nmfeil( aDur(r ;u1tpe  oeiasfm2uau pnu) rxnmocto1fptraies;t)t2xm(m3no1openmnciasfaDrau pno1tlt micild sDulnvon()tltoxr tatlm eaueo (0t2trxo3io4ole lnesa( a2rmumpnt4texnmfciytfa rmn o;t4tltomf3oodfmt anei ()sexm(m3oydol elnet (  Drmumo;u1oltnifcildls rluvs u4trxoxr3oatlmDeanvo () 2umxo3nydaleelnesasf 2uau pou0teeomfetatfa ea( on()tlermf3iatlmDelieils  etoxr nudomte ieil(fsrrau  ;t4oex  oetydlmDrlnmp t)texrxo tydlm   ieo;s)truriopoo1olt mivsls sDurxm ;t0opxn ieils aDel(vo;t0trxnxo tatfmte nei;s)truoir no4optemivia(fsDtmxr nt4oexoioeiasfa ranmp t)arxnxo iotfptrlnvo;t)t2uoxopno1omee icilt)srurur ;u0altnifciadfmDrmu onu4trxrmo3ty1fmtrluvils0teur(opnydam nlfet (fsrrm(r ;u4aeeoifetyt s2ua(mo u0arxrxf3oydop  lnvi t sexrxr3oudope lnvsatfarrr(mpot0opxo f3iytfm ul( o t0trxomf3oadlmtrluvols)setoim ny1apenmieiat  Drrx  ot4tlt  o3iyd m2ulums;u0tleoirciytlmt aues ()trumxr oo1am   icil()arrmxr nu1opeomfetlsls2eanmp;u0texnxr oo1fpDr i il(0srxoxrpiydam   fvs tf 2ua(rpnu0olx  ictltlm rmnvonu) ltrmf3tatfm   uvolt truoim3ny1lmteliet s)sDtm( ooo0optn i3iat a2ra(msnu)teeoif iotoatelnvslt)seuo(o3ny1lltnlnvtat)s2taumoou1apx mi3iltlm ran o () renxr3tatlpte ueolt) rtoxopio1ol  mivtlsf rrmx pnt1apx  oetatfsDumums;(4altrxr iy1fa r nes;s)setmxr3iodlp  lncias) Drr(  oo4aleoifctad m ulums t)aeenmr oo1faDrliesl( seuoio3ny4lp   nvt sfs2uru pou1alx  f3ils aDean s;t)tltomocoytlaDe neols  rtoxr io4openlfci s a2rmxmoou1tltnmo3iyslmDem(mp () lxrxr to1om r ivo () etoimpiudaptemnvsas srrr( poo4oleoio3tldfaDulnvo (0artomr3to1faD auvi;(0 2uo(m oydol n fvtlsf Duauroot1oexoioctydfsDulu pnt)teeoxr io1om e n s (0s2toxr oo4ol n ncsas)s2ta(m oo4oltoiietlsla umuvo;t0tlxoxf3iy1oaDe n o;t0texo(r iydlmt lies s)sDtrum ;o0oeeniicils a ul(ms;t0alxniocto1opDraieo t)s2xo(mpoodopte ivsls s2uaxrpoo4ape mocild mDraumo (0aeeoxo3to1oatrlieols0s2urim nodlp nmfcta( sruax  no4tptoifciytfm2emuvp;t)tetoxfcta1fm r ieolt0s2umio3iu4olen ncilt  Dumx  ot0texnii3tyt s2eln p;t0tlxnxo3oodfmDr u i;t  rurxmpio1ame mfct (f 2urxrpot0opx  f3iaslsDrmuvp t) reoircty1lptrlivslt)s2xm(rpnodape  feiat sDrr(rp;o1tlt miciadlsDua(vs;t)teeoio ia1lmDrauvo t0tetmir nudlptnmnvt t)srta(mpoo1texnmieiys m emu ont)aexnmo iadfp elnvs s0seuriopiudolt mivtl()aDuaxm ;o1teenioeilt s2rmnmon() ltoif3tytom raieo;s teumimpno1apee ivtlt sDtaxm ;t1tpenioeild s ea(vsn(0tltrxo iotoate uvi;t  rxrxopnu4amtn fei (faDraxmp;t0alto ociysla2raump u4aetriocoa1lmDrln sls trur(r nydllte nct sfa2umur ;o1tlxo i3iltfa uln p t4 ltrmrciytopDranvils0 2ur(o nu1oltelivtl()a2tru pnt4apxnmi3iysfa eau p;() rxrio oo1lp r ieo;s0 2trxm3iydom elncta() rtrx pot1aptn icils a rl(vo t0trxomf3iodopDe ueo s)trxoxrpiy1amtnmnvi s sDum(rp;u4apx mfciys s elu p;() lerir to1fat lnvs (0 exr(opnudopeelivi (fsDta(  ;t4oeenmociad mDemums (4 rxrmo3totlatraieolt0setm(opiodam  mies t)s2um(mooo1aexnif3tydfm ul(vsnu4 rxnmr oodfaDr ueilt srxr(m3nu1alee fetat)aDtmu pnu1tlx mociaslsDeanmp () etrir iotfptean ilt0 rxr(mpiy4oltn feta()aruru pot4tpx io3tyt a um(vp;(4tleniocoatla   uvols)s2urxrpoydap nmivtatfs2tm( pou4teenifeilt a2rlu onu)aeeoir3tatfm r u s ( t2xmiopny1omee fes sfs2ra(rpnt0tlxn iciyd m rl(msnt4 rxrxr3iodlaD anvil()trur(mpoy4lmtnmictl() Duaxrooo1alx if3ilslm2rmuvo u4texrxr3oydop  an i s)t2trim nu1olt miesa(f 2um( oou1oeeo ocilslsDrlnms;t)tlerxfcio1omDrluei;t) rurxo oo4altnlfcsl()s2tmurpot0texomiciaslm ran p;(4 leoif3oadoaDe u o t) rtoimpiydlpte nvsatfartru pnu1tee ifciat a2elnmp u4altnio3iatfm raivs t s2um(m3nu4amt mnesls aDtrx o;o1tpeo ociydls2em(msnu4arxoirctydoa  aneo (0s2toxo nu4lm emfvt ( sDraumooo0aex  oeiytls2ea(monu0aeeoxfcoadlmtelnvs s srurim iodolenmfct t  2um(rpot4altn f3tld m2uanmon(0 ltrxr totfm   ueo;()srxo(rpio1apenlicia( a2um(monu0oetn iciatfm2ean snu4trtoircty1lmteaivs (  rtrimpno4lptemnci ( artau p;o1opeo i3iys mDrmn o;(4 etnir todfm elivo;s0trur(o oudaptemfeil() rrmump;t4tpeomfeiytfm ulnvs;(0alxrmr3iydlmD anes t0 ruoir nodaleemies ()artr( p;u4alxomieild s2rluvp u4 lxnmr io1oaDrlnvi;t)teum(o ny4lmtnmivtat)artaumo;o4tpeomfciad s eauvsnu0aeenir3oydop   nes;t  exoxm no4lmenmict sfa2tau o;t4optnii3tyslmDumnvonu4aeenmocto1la eanvo t  2uoxrpiu4lme licta(f rtmu pot4opx mfcildlm2eaums;u4 exrxf3iytfaDeluvo (0s2xrir ou4lltnlfct tf 2rm(ront1oeenio3tlsfa2emnmp t4tetoiocto1lpDrau i;s trtmxrpoy4apenlnctl( srumxm oo1altoiocilt s uanvpnu4tlxnmr tadfm eln ol() eum(mpiy4omenmfctatf 2ur(mpnt0alt mieildls emn p u0tlxoirciatlm e n o;t  2tmiopoudaptn ivsl( s2tmu o;o4alto ietadfaDumn p (0alenxf3tatlptrauvi;(0trto(m ny4lp nliesasfsrrrumooo4ope  i3iydfsDemumo;u)aeenxfcoydfp  lu i;() rurxm oydlle  ivtltf rra(r oo4opeoiietydfs2em(von(4 rtoir3oytoa rau s;s  ruoiopiy1alte ietl()a2um(r nu1olxoiocilsfa2rln s u4 eerxr oo1omte neo;t)truoio iu4altnlfvs (  Dtaum no1tpto f3tyslmDrmu pnu4 eermf iy1lpD livi t) 2xm(m3io4altelnesat)a2rmu o;t1oltoif3tlsls2ran o;t4 exomfcoodlm   i ilt0 exo(o3ny1lptnmiet sf 2taxr ;u0olxnmictysfm el( p;t) lxrmfctodlmtrlies s s2trio oudlltn fes tfsrtaump;t1alxomictltfmDulnms (0arxrioctodomDr i i ( trurxm3iy4openlivsls artm(r ;o4tlxniociltfa emnvo u4aetrxo3ty1fat auvo;(0s2tm(m ny4olenlfct sfsDtrurpno4oex  ieiltlm2el(vp u) etomo iodfp rlnvs;s trtmxr iu4ol emfvs t)a2rax o;u4tleoioeilslm rlumsn(0 eeoio3oy1laD an o ( s2to(r oydam e neslt artr(mpnu4teenif3tytfm umuvp;u0altoif oodfm e neolt) rum(o no1omen fcs s) rurx pnu1texnmo3ias a2rln p;(0tlerioctadla   i ilt trtoxr3iydol nlietas  2uau  oo0oet iietydfm eanmpnt4alxnxf3oydfa  lu olt  eur(rpnu1lmtnmneiatfartr(mpnu0tpe iietad a2ua( p;(0trxoif tatfatr ivi;t)setrir oodap e fvs ( s2tm( ono4alx ii3iltlm2el(vp (0aetrmr3oa1faD an olt setrxo3iydamtemfvsatf rumxroot4optnmietldfaDuln p;u) exoifcta1omDe n s;t  exmxmpnodamt mivsas aDrrumpot0tpx io3ilsla2ul( s;() etnxf iytom rln slt) rur(o iydll nlfvilt)sDtm(mpoo1optoio3ild s2rmumpnu4altomocty1omteauei;t)t2urirpiudlm e nvsa(  2taurono4aexnii3iadfaDrmnmo u)aexoxfciotoatrauvilt  rxmio ou4llt  ncsl() rrr(m nu1oleoio3iys m umump t0aeeoircoodomDraneslt seuo(m3oo1ap e ivsltfs2umu o;u4opx  icias mDra(mp u4arerxr oa1lmt aueils  eurxr oo1op e ncils sDtmuront0apx  ictad a rl( o;t0tleoxrcootfp ranvi;(  exoxopnydome  nvsls)arurxmono1teeoiocilsfsDeanvs u4trtrxo oo1oa eluvi ()s2uo(r nudop nmfeil(  Drrumpoo0tlenmietlsfm rlu p t) rtrmf3ta1lmtrliesls)setmxr3nodapeelnvslt) 2raurpoo1tet  fcilt m2ra(mpnu0 rtoxo3todom r nvi t0 2xrxm iydal emiviat)aDtaxroou1oexo ocilsfm emu o;u)trxoxo iy1lp eai il()srxoio3io4amt lfvils  Duau oou4tpxn ictlt a2el( pnu4 ltnmocto1lpDr uvi s  rtr(r nu4altn fesls a2ra(m nu0apeomieiatfmDumums;t4trtnio3oadla  an sls0texo(mpoudll nliet s s2uaum ou0tlenii3iytls2emu pnt)tlxnxr3tadfptrai sls setr(m3oy1altnmfeils  Dumx  ot4oleniictadfm2ul( o;u0 rerxf tadoaDe n sl(0 exmir3nydomee nvt (  2ra(moou1oet mo3tltfaDraumo;(4tetrmocio1oaDr ueo;s0srxrimpou1omte ieil()sDurx  ;t1openmociydfs raumsn()areoif iotlp  li i t)truo(opiy1ome lncsl( arrm( pnt1tlx mi3iad s2umnvo t4 eenio3iytoa e n ils srtoiopoy4omenlnct ()srrr(  ;t4olxoii3iytfm emu sn() rtoxr3tytop e i s;t) ruoxmpiy4olt lfvsas) Dta(m oo4texo fciys a2elnvo;u4 exoiocoatfat lnvol( setmio iudamtnmnesasfs2rmuroot0tex ioctlslm2eanmp u) rxoif3iotfptr iei ( tetr(rpio1al nmfct ( s2ra(ro;t4alt mi3tls m rlnvp;(0texrmo3tadfatelieols0s2trxm nodamen nct t  2tmu pou4tlxn oeildfmDemn o (4artnif3ty1oaDe u s t  2trxo3iu4optn nvilt  2rmxrono0oee  ocildls rmu sn(4tlxomf oadlpDr i sl(0s2uoio3ny4lm elivsatf rua(mp;t4apeniociadlsDuan s u4altnxo3ootfp  aiei;t0tetrim iu1op e fvtl( sDuau  ot1aeenio3iltla el(vs t0aleoxr3iadlp elues;()trumxm oo4lpeelivslt)arur(m nu4teenifciytfm emumpnt0tltoxr3tatoa   nes;(0t2toimpiydop   nvil( aDtax pnt1tpx mi3iaslm uanvs u) leomo oadop  lueols0sexo(m3nu1apenmnviasf Dtmxr oo1opxo oeiydfs elu o ()altomfcoatfat lueo t0 eur(m oydom nlicia() Drrxr nu1tpto fcilt mDumnvs t)aeenmf3iytlptrlnvs;s)t2tmimpou1apeemivsa( aDra(ro;t1opxoiiciltla2rmnmo u4 lerxf to1fate uvo;s0sexm(r3iu1ome  ivsls aDtrxmpoo4apeomo3ias s2em(vsnt) rxnir3oy1fat auvs;() rum(rpny4llt mncsasfs2tm(m oo1tle  ieiydfaDemumonu0 etoif iytopteanvs t0s2umim3iudole  fetatf Duaur ;o4tetnioeiysfaDemnmp;(4 etoxo3oatlmDe nvs;t trtrir3ny1olt  ietat) Dum(ro;t1olxomoetydlsDranvs t0 exrxr3ta1lp rln i (0trxmxopoo1amt lfet s s2tm( ono4oee mi3tls aDrm(vo;t4trenio oo1laDeaueo;s)trtmir3iodllt mnvt tfs2ta(rpnt4apxomocilsls rl(ms t4areoxf3ia1opDr neols0srto(r oudolt lneil(  2ur(r ;o0tptniiciatfmDuluvonu0teeoio3oy1om rli o;s  2xmimpiudlm nlnvsa(f 2ua( pou1oeen fctldfs ea(mo;(4tlenxr3iotfmDelnvil() rtrimpoudol emncs s  2uru poo4tpeoifciytlmDulu o (0arermr iatopD aivi;t  eur(opno1opt mfcsat) 2raxmo;u1aexn fcils aDeau onu)alenir3iodfa  lnvs (0 2umxm nu1al n ncsa()srtm(  nu4aptn o3tlsla2em(vsnt0alxomr ty1oaDeluvsl(0tetoxo3iy4alenmnes tfa2umxmoou0opt  fciydfm rau s u0treoxrcoo1lmtrlnei () rtmio ou1lp  mivsa()srur(r ou0apt  iciaslsDua( s;u4texoxf oydfmt ai s t0t2urxopou4lmte nci (  rrrxrp;o4aleo f3iyslmDra( on(0arxnir iodlm e nvo ( setoir3oy1om  lfvias)sDrmxmpoo0openmoetldlmDrln s u0alxnifciatlm rlieslt  exmiopiodlpt lncsls sDur(mpnt4apeniocils a2umuvp t0 ltrif3todfpD aivo;s sexoxr iydoptemivt sfaDtaxr ou4alxn feiytfs2rlnmp;()tltnxrcoytlmDelnesl()t2trxr nydlp elics t)srrm(m oo0apeoio3iatls ul( pn(0alermr3ty1lp rln ols0s2urxo iudap elfet t)s2umu poo4tptnifctls s2eluvsnt0teeoircoatopDe iesl(0seurir3iudom e ietas srur(mono0opxoiiciadlmDranvp;t)tetrxf3todlmDeauvolt) rto(opoydlp  mfeilt)artmx  oo4tpeo i3iasfa ran o (0 etrmo tydfate u i t)texrxo3iy1lmenmici tfaruaxrpnt1tlxomi3iad mDumnvs;()trxnxf tatfp rlues s srto(o iy4oleemivt sf rtmxro;u0opxoii3tadlm rluvp;t) exoirctotlpt lnes s)srtrxo3iu4opt  feil(  Drm( pnt4aetnmo3ildls2eau o;t4 exrmo3tytfmtrluvo s)s2to(r nydame lies (  rtmurpoo0tlen ociyslsDelnvonu4aetnmf3iadlaDeluvolt0t2xrxmpoodape  nvtls)srrr(  ot4opxn fcild m2umuvo u4 lxrxf3oodla ranvsl()teumim3io1apeelneiatfa2taxr no4olxomi3iydfm umnvo;u)tetrifcoodlmtrlu o t)srtrimpiodalt  iesltfsrrmu ont4opeoif3taslsDeaump t) lxrmr oatfmDelu o (0 exoio ou4opt mivsls)aDra(r ot1tlxo ociasfmDrmuvp;()alxomrctodopDeli o (0t2xrxrpny4lpee nvs s s2tmu onu1tleomoeiaslaDemumsnt0alxomr3iytlp  lu olt  rtoio3nodalte fes ()aDraxmpno0opeo ociydls rmnvo;t0tlxnioctytlatelivols0seuoxmpnodlmtelncil()artaxm no4aeenio3iadfs2em(vp ()artnxocio1lp elieo s0 2tr(o oudopt lncsl()s2rrur ;o1ope iictytfs el(vs;u0 exnmfctatomDraueilt t2xr(m no4omtnmivt ()s2taumo;o1tleomoctys aDrauvs;u) lenio oy1fpDr u s (0trxm(o3ny4omtnmnvtl() 2rmur no4oet  o3iat m uau s (4aexnxfcia1faDeauvo;s)seumxm oy4opte fesl() rrmu  ot1oetniocildfmDrmump;t) lxrmo tytoa rlueo ( trurxm nodolenlnesat arraxm ;t0tpeo octadfa el(vpnu) rerir oatfm e n il( trtrir nu1ol n neils srururo;u1alenifeiltfm emnmo;(4 exnmocoy1op eluvi;(0teumio oy1amtnlieilt)a2uaxm ;t0ole iieils mDranmp;u)teenxf oytoaD lu o s  rtrxo iudamtemnctas)sDrrurpou0tlxn ictytfm rmnmo;u0artnir ootfp e ivo s t2xmxrpoydame mnciatfa2raxm ;t4oltnii3iadlmDeauvonu4teenxf3ta1opt lues;t0 rxm(o ou1altnlfctl(f Durum nt0apx mociaslaDrmumpnt4tetnxrcoa1lmD  i sls  rtmxr3ou1lp nmfeiatfsrumuro;t0oeen o3iytfmDrm(vs;t4texrxocoa1la e neol(  2umio3iu1ll elfetas s2tmx poo1texniiciydls2rm(vo;t4teerxr ty1fm  ln i;s)s2uoxm3ou4lme  ncsat)sDra(ro;o0oexo i3tltfa rl(vp (0alxrmo todfptelneo;(0trtoxopoy1ll elnvtlt s2trurono1oeto oeiadfm ra( onu0tetrmr iotomteaueo;t)trxmio oydom emncil(  rtr(m ;u4aexoioeiad mDrau snt0trerio oadfp rlneo ()s2toim nu1ap elfei sfs2tm(mp;o4teenmi3iyt aDua(mont4tltrxr oadfm   n o t)seurxo no4alen ncias)arumu p;o4olxnifetatlm ran p (4altoifciydomtraivi s s2xo(mpiu1ll n ivia() Dtax  ot4aee iieiatlmDuanvs u)altoio3iodlp rluvo s0s2tmim no1lmt lfetls  2um(m ot4tptnmictld a emuvp;u4tleoxo3tytoaDran ol() 2tm(r iu1lmenlfvsa( a2raxmpnu1oexomietad a ua(mp;(0tlxrmo tytfpD ai s t)t2uo(rpnodlpt lnvtl( srrmx o;t0oltn oetldfs elumo (0alxoifcio1op rli s ( t2umio3nu4al nmicilt aDum( p;o1tpx mi3iltfm2rln s (4aetnxrcoy1fp  aues;()trtm(rpio1apen nvtls s2rrxrp;o4alxniociydlmDemump;u4tlxomr iadlm r uvs t)tetr(rpiodoptnmnciat)srtrum ;u0alto fetatfs um(vs;(0tetnir3to1oa ean o;t)trurio iu4amt lfes sfsrur(  ot4aleo f3iytfs2um(mp;u) lermoctytlpDelnvi s0tetmxrpiu1lmee nesat) 2umu  no1alxnmoeiytfa2ea(mp;()alxrmr iadom  aivo;s trtriopiy1lpenlncsas  2umxrp;u4aexn ieiysls2umumsnu4teermr oodfaDeli s t  rtr(r3iu1omee nvilt)aDtau  ot4ope  i3iatlaDuauvp () exnxo3ta1lp rlivs;( srxoiopno4apteliesasf 2urxr nu0aeen i3iyd m2el(vp u4texoxr3io1la  auvi ()setrir3io4op e fei (fs2urx oot0aee  o3tatfa2rlumo u0 eeoxociadlp e ieolt)truoxo3nu1op e neslsf 2rm(r no1oee  ictytfs el(mp (4 lxrmf iadopt  uei;s s2tmio3no4ol   nvt t)sDrru p;u4oet mi3tasfsDuan p t0aeeoir ia1oatrlnvo s0srxr(m3oo1ome  nvt tfartr(mp;t4apt ifeilsfm em(mp;(0texnir3oo1omDeln o s srtoiopoo1lmtelfetatfsDtmurpnt0opxomf3tyd s2rlnmo;(4aexnir iy1fa r nei (0teumxr oo4lmtelfcslsf rua(r oo4alt  feiyd s elnvsn()trxrmfcoy1oa   i ol( trxoiopno1ape mivsat srrmxr ot0oexomi3ildfmDemu o;(0aetriociytla eaueslt) eur(rpoy1omenmnvt s arumump;u1aet mo3tyt aDeauvs (0tlxrmfcoatomDraneslt0t2trxo3oodlm elfct s)sDtau pnu4aex micild m ua(vs;(4trtoxo ty1lmD lneo s)t2xr(opou1om  lfvia(  2tm(m ;u1tlen i3iyd aDrm(vo;(4 exoif todfpte i i;() 2tr(m oudlp emfeiltf 2rr(  nt0oeeo i3iysfs2em(vp;(0arenmo3oadlp e ueo;s  etmiopoy4ll emfvsatfs2ua( poo0tlenmi3ildfm2eaumon(0 eeomfcoatfaDr ies;s) rumir3nudll nlieia() rrmur nu0ole  o3tlt mDel(mp;u0trtrmrcoo1fmt auei;s) 2umxo3iudlm nmfcsat  2tau ono4oleomf3ildfa2ul(monu4 rxnxo totoatrlues;t s2uoxm nydlm n iviltfaDra(rp;u0optn i3iyt sDrm(vs;(4tltnirctydlmDrlnvi;(0sexo(m ny1lmeemivsl(faDta(mo;o1alxnifeiytfaDrauvpnt0tltrxfciadop e ueo;t  2tr(mpnu4amtnmfvi t) Dua( pnu4alt mo3iatls ul( pnu) eerxf3oatomDe i i;()seur(r io4lpee fvi sf rurx  ;u1oee iieiatlaDra(vs;(0trtoio3oydom  anei;s) rum(opoy4omen fcias)a2rax oot1tptoiietat s2eanvpn()alenir iadfpt  nei t) 2xm(r3oo4op   ieta(f rrau o;t4aptnmo3iydlm2ua( o u4aexnmfctydopDr n o s s2triopoydlleemfvias)srtaumonu0tpt iociytlm umumont)trtomo oadfat  u s s0texoio oy4amt mncs s)aDtmumonu1opeoii3iytlaDrm( sn() renmr3ia1fa  livi;()seumir io4llenlivt s)arrmx  no1tpenii3ilt s2rlu pn(0trermoctytfmt li o;t0 2xrxo nudlptelnes t) Dua(rpno4tpenmfeiatls uan s;t4tlxnir oy1om r nei;s t2xr(o oo1amt  fvsa(fs2umum ;o0tetnmf3iyslm2eanmpnt)trerircia1omDrlieo (0srtoiopiu1aptn icsatfaDurumpot0opeoifetls a2ul(mp;(4 reoif3to1laD  ivs t trur(r iy4om  mfcsat sDra(m no0aet  ictltlmDem( p ()trxnir3iadfm rluei t0seuoxrpny1lp e ics sf Dur(moou1tlxomietasla rmu ont0aeerxfcoodom e uvil(0 2trio iy1omt lfvsasfaDururo;t4tlxn f3tas m rau o;u4tlxrxo3oy1om raivils0setm(m3nydomtelfesasf rum(rpoo1oltomfeiytla2ua(mont)trtoif tytomtrluei t) 2umxr iudaptn ictls)a2rauro;o4alenmoeildlm2uan onu) rermf ty1oaDe nes t trxmio3no4am elfvsa()a2tau  ;t1oeto fetydlaDra(mp u4 rxoxocoodlaDelnvi (0s2tm(o3nu1olt mnvsat)sDraxm no1olt  f3iytfm2ul( p;u0 reoxr3to1lpteli i s tetmio ou4ope mnvsl(  ruaumpou0alenmfeiyd aDumu s (4aeermf3iy1fm   neo;t sruo(o oydllt lfet sfsrrrumpnt1tpxnifciyt a rmu onu0tetrmocta1opD li s t  2xo(o3iodome lfcsatfsrta(monu0olx  ocildlsDem( p t0tlermocoy1omDeauvo;() 2xoio3oudlmee nes s) rum(rp;t0tetomoeiatfaDelumo u0teeoxr oy1omtran ols srtrxr3oo4ap emfvt ( aDuaxrpot0olxomi3tat s2eauvp;(0 ltomf iodfp rlieo ()trumxr nu1olee fvs s arururpnt4ole miciyd s el(vs (4arerif iatlpDrluvilt0texoiopoo1am nlncias s2tmu pno4tlx iiciydlaDelums;(4trenif3todfptean i s)s2toir3io1apen ivs (fsDtaxmonu4teenifctatlsDranmsnu0 ltoiocoa1omtelnvs;s) 2trirpiy1ap nmieiatfsDuaxmp;o1texnif3tasls2ean o t0arxoxr3oytlat li s s)truo(m nu4lpt mfeils  2ua(mp;o1aex micilslsDumumsn(0altrmociatfmDe uvi t) eumxmpoodlle  fvtls sDrrxrp;u1aeto o3iatfa rmnms;(4 rerxo iodfpt aues;t srurio3oy4op elnvsl(f Duau  ot1apxo f3tltlsDraump u)aleomoctydfmD  ies;(0srurirpoydamenmfvt s sDrm( p;o4aex ioeiadfmDea( p;t0 rtnmrciatomDe n i;t0 2uoio oudomtelicsl(  2uru p;o1oetoiietad s2ra( p t4arerio3oo1fatrlnes;t)t2tmxr3oudamtn nciatfaDrm( pnt0oeeoioetydfa2rmumpnu)trxrmo ty1oa elieo (  rxmim3ou1am  mfvsltfsrumxroot4oltoifeiydls2ea(ms (4 lenxf tadfm raneolt0s2uoxr3oy1apeelfvt tfsDrmxm ot0tpxnioctldfa ra( s;t4tltoifcia1la eluvsl(0srtoxo3no4lp   fci tf rtru  ;o4oetnifcils a2ea( s;() ltomo3iotlpD aueols  2xr(o iodamtelnci sf 2rm(rpno0teeomiciad m rmnvo u4 lxnmo tatfateai ils)srtmxo nu1lp   iei s)a2rrxrooo4texo iciat a ranmpnu0arxoxfcoy1lm eai il()seum(r3ou4amt mnvsl(f Drm(m nu1oexomiciydfm2elnvpnt0 lxomr3oo1la r neo;s tetoir no1lmte ictlt)aDrr(m ;t1oex mfeilt m2rau snu)alxoxrcoa1fpt au ols)t2xo(o nodll emnes ( sDuau  nt0tpxnmietyslsDeaums u4 eeoxrcta1lmD lu i t0trtm(o3io1lp elics t  rurxmont0tpe moctlt s2ulu p t4alxoxo3iy1fp e n o;s seum(r3iydlp emncs t)srrr( onu1aeto i3ilt m2uaumo t0texrmo3iy1fpDeaivol(0 2to(m3iydamtnmncias  2umumpoo0aee  o3iad s eanmonu4aeenioctodlpt an i;t0trxmxo oo4omt  nctlt)s2ra(  ou1tet ifciad s2rmnmp;u)aexnif3ootlmD ln o;s)sexmir ny4omenmfesl(  Duru pot0tetnmoctat a2em(mpnu4 rtrmfcoo1la  ai i (  exo(r io1llee fcs s sDumum no0tpenioeildfsDrau pnt4areoir3oatfpDrlneolt) euoir ny1amt lfetltf Dtaur ot4tpt  ieiltfs2rmn snu)arenif3ootfaDrlnvolt)s2xm(o3iydlm  mfeilt  2tru oou4teeoiiciyslsDumu s (4alxrmf io1oaD auvsl(0 rtmxr ou1ol nmnvtatfaDraxr ot1tetnifeiytlaDraumsnt4 etriocoatfa e nvi;() rum(m3ou4lpeelncias)s2rrx  ou4oex iietls s2emuvsnu4trermfciy1la  luvils0trxr(opno1lp emfesa( a2rmxmo;u1oeen f3iyt m2um(vsn(4altoifcoytla r iei s0teumim oo1am nlivi s aDrrum nu1olxo fetasfaDea(mpnu0altrxrciydoat  ivo;(  2xrir nu1lm  mictlsfs2uaum ;t0oltomo3iad a2rl(vp;()trtrmo3iodlateln ols setr(o3nu4amenlncs tf rumx pot1aetn fcils a eanmp u4aeenif3io1oaDrauvo s0trtrim nydllt mnviltfaDumur ou1aexoio3iltfs raums;u)aetoifciytfpDraiesl()sruoirpiu4omtemiei t)a2urxrp;u4oee ifeildla2ulu s;u4texnmr3to1oaD aieil( seuoio3io1oleemfcil() Drrxmpou1opxoiicildfmDuluvp;u4aleoxo3oatfmDe u i;( t2to(r3oy4ap elfesl(  2taxm oo4apx mo3iadlsDeau s u4trtoif oytla raues;s0s2xmxmpnu1opt  ics () 2rmx ont0tpxnmi3iyt aDulumpnu)treomrctotfp e ieol( sexmxmpiy4lpt lnes s)srumxm ot1apxn ieildfmDrlnvs u4 exomr3oydlptraueilt0s2xrxr3iu4amtemiviatf 2tmur ;u0tpx  oeilsls2rm( snu) etoif iadlp   n sls)t2xm(rpno4alenmict ( s2taxmp;t0optomicildls2eauvp t4tlenif3todfa r i i;() etrim iu4ol e nes s)aDraxro;t4aeto i3tatfaDel(mpnu4arxnxo3iytoaDeauei s0 2tm(m3ny4llt lnvsatfaDtrxmoot4oltomf3iadfsDuauvs;()trxoif ootlp eliei t) 2to(o3ou1op  mnei t s2tmx  oo4opeo i3tasla2rau o u4 eeoxocta1fa  luvs;()srxm(o3oo4am  lnviatf Drm(rpot4aexn o3ils sDuauvonu)alenmr3iotlatelues s0trxm(m3oy4lp e iei t)sDurumpou1oeto i3iyd m2rauvo;(4aeeomo ty1fp  auei t) rxr(m io4opeemfvia( s2uau ont0teeoioeiydfs ul( pnt)tlxriocta1fat ln ol() eur(m ny1lp  mnvtat) 2ua(mooo0opto ociatfm2rmnmpnu0 eeoxfcio1op rai slt  rtoio nudlpe  nciltfsrta(r nu1tltnifciltfa eanvsnu4alxnir io1fptrlivo;t seuoxrpiydllen fvi sf 2rm(m ;o4alxo ocilsfm ua(ms (4 exoif tydfm eanvsls0trxmxo3io4al   fei ()a2rm(  ou4oexnioctlt sDrmumo;u0 etnmfcoa1omDrli i ( texrxrpiydapeemncils)sDrr(r ou4tpx  ieias s rmnms;t0aeenir ootlm r ivs;t)trtoio iy4om elfeilsfsrtmxrp;o0tee mf3tldfaDul(vo;t0texrxf iydoatrluvo;s  exmimpio1op nlnct s arurxmo;t4aetomi3tytla2rauvsnt0 renmf3ootlm rau o;t)setr(o oodop  livs sfs2rmx ont4tex ifetld aDel( pnt)tlerif3oydopD anvs;t)seum(m oo1am nlivia( sDuaur nt4tex  feiatlm rluvp (0 ltnifciadfm ean ols  etrir3iudll elnvt tfarumu pou1tlenmoeiltla rmu p;u0tltniocoy1op eli i (0t2uoxrpoy4apee fcsls) 2uax ono1tpeo f3ilsla rauvs;(0 rtnir3ootlaD aivo;s0teuo(o iudol   fcias) Drm(m ;o0aeto fciysfm2emuvs u)trtrircoodfptelies s) rtr(rpny4aptnlfvils sDtaxmp;t4olxn i3tatls umuvpnu) reoio iodfm  auei;t trumxr3oudlmen nesa() rua(r ou0tpt if3iltfs2ua(vp t) rxriociotlat auvsl( trto(r3ny1lpt mnvt t)arrr(mooo0ape iociadlm emu p;u4tlxrxr iytfpDeaiei s)teumir io4alte nes t s2tax  ;t1ole mociyt s uanmpn()alxnirctodomtr iei;t  2tr(m3nudlleelnvt s srrmu  ;o0optn oeiadfa2elnmo;(4trxrioctytlmDeanvils) 2xo(o iodamee nciatfartaxrp;o0apxoifetatfm2rl( s t) etoircoydlpDe ivs;s0 2xrxm iu4ll n ici (fsDuaur ou0apeniictlsfs2elumo (4aeenio to1omte uvo;s t2um(r nydal elivt t a2truro;t0tlxn f3ilt sDuln s;() lxnxo3ta1fm e nvsl(0 2xoim3nudol n fesa( srururp;o1opxn f3ilsfsDuaumo;(4 ltrio3iatlp   ieo ()trurir oo1aptnmfvsl( aDumxmono0tpt mf3iatfm em( pnu0artnxo tadlpDeluvols) 2to(r3oy4aptemiesas  rrmxm ou0tlxo f3iltlm ran s;t0tleoio ootfm r i slt  rxoxmpoudamt  fvs tfsrua( oou1opto i3iydfs rm( p u)altrmf tatfp   iei;(0sexoir ny4apte icia( arrrxmoou1oex iociasfaDuanmonu4treomf3iatfatr ieolt)tetoio3oudlleelfes ()sDur(mp;u4tpt mfeiat aDea( o;t0tlxoxfctadlat aieo;t)t2xo(o3ny1om e nvi s) ruaumo;u4teto iciltls2emu sn()trerifcta1fp rau s s) euoio3oydom nmfvt s  rra(rpno0tee mictatfm ea( p t)tlenif3iydomtr i i t srxmxopoudopenmicsa()srra(rp;t1oetoiietat mDranms;(0 eenxf iytlatrlu i ( trxm(o3iudlm nmfvtl()aDtrurpnu0tpx mf3ild aDrmuvs;(4teermocoytoa  auvi t0s2uo(m3ny4lpte ivs s sDtmu  nu1alen o3iadfmDeau s u)aexrirctadfmtrlueslt  exmxopny1llenmicil(  rtru o;t0tlx  ietadlmDemnvont0altoxrcoy1fpDe nvs;(0 rumxo3ny4op nlfvtas  2umu p;t1open ietldfaDrau p;() lxrmf3oydfpDe n sls)trtrxo iu4lpeemivs sfsrtaxmpou0olt iieiyt mDeau on(4treoxocto1omD livs (0texoxmpnudam  licias) rtax  ;u0tlxnmfeiytfaDemnvo;t0 lermfcto1fpt au i t0trtm(opoy1am emfcsl(fsDurxm ou4apt mieiytlm elnvo;u0trtoxfciatfpDelues s) 2to(rpiu4lpen fviat  rurxrpoo4aee ifcilsfa2rm( s t)trenmr3totlp  ln o t)s2xrxo ny1lltn nciat)a2tm(mp;o4oltnif3iyt a uln s;(4areomr3iatlmt lueolt tetmirpoy1alt liciat)s2taump;o4tltnmoctadla2rm(vs;(0aeenxrciatfaDrauesl( t2xo(rpno4llt mivt () rtmum nu4alt mi3tys m2ulnmpn(4 exnmf3oodfpteln i s)t2xoxo iu1lmtemfetlsf rrauro;u0olxoio3ildfa2ulumon(0 lenmf totfptrauvs;(0 ruoxr ny4oleelnct t)a2tru  oo1tpeoioeils a2eanvs;t0 rxoif3iotopD li i;t  2xm(rpiudop  lnci s) rtmurpno0tlt  fciat m rauvp (4 eermo3ootomt livsls)tetr(m iy1lp nmivi ( a2tm(moou4apeomi3ilsla2rm( s;() ltnio to1fm  aivi;t s2xoirpoo1amtemietat  Dra(rpnu4apt mocilsfa rl( pn() eeoxociadlaDeli ils)teurxr ny4lmt  nvils) Duaxmooo1tex ioetas s2emnvp;u0tltrxo3iatla   uvils)sexm(opiu4lp elnvt tfsrtax  oo1alxnio3tytfm emu p;t0 renxo3oodomDeaues;t)t2toirpny1lpenlfvs (f Drrxm nu4texnii3tysfs rmnmo;(4 etrir iadom eli ol(0trxrio3iy1altnmncia( s2taxr no0tle moctldla eaums () rerif iadlatraieil(0t2um(r3no1lp elfvtl(fsDrru  ou4tpeomoctyd sDrlu p (0 exnxr todfp rauvs;(0seuo(r3oydlmtemfcias  2rrx  ot0apxoio3tadlmDrlu o;()tltrmf3oydoa  livs t0trto(o3ou1am   fvias)s2tmxmono4apxomf3iytfaDrl(ms u)tetnxo3tydop rluvi ()texo(m3nydlmen iesl() 2trxmooo0tlx ioeiyd a umuvo u) etrmo ta1oatean o;(0texrxm3ou4amtelnes t)aDurum oo4ole ifcilslm2rmn o u0alenxfcia1fpteai s s)s2uoir3nu1ll nmieia( aruaurpou1tetnmietys mDeln ont0 lxrmociotfp rli o t0t2toxr nu1oleelfvt t s2ururpoo4opxn oetysls uau snu0arerxocoo1omtrai o;s trtmim3oy4ope lfes s  rtax  ot4oltomfeiltfs em(msnu0artrioctatlpt  ivo (  exoimpnodll elfct sfsDrauro;o1alt ii3tadfa2rlnvp;()aetrxrctadopD lnvs s)srur(o3oudolte ietatfartauroou0ope iieiasls rmnvs;(0 etoirctodopD au s s t2xo(rpny4alt mfvta() rra(  ou4tpxo oeilslm2el(mp u0alxnio iadfpte ueilt s2xmxrpiydol nmncta(fs2urxr ;u1aptomi3ild mDrmu sn(4tlenifcta1oa eai o ( texrir3ou4ap elfvi sfaDumur ot0opxn i3tyd s2uau on(0 eermfctydopDrluvo;t) rumxm3nydape  nvt s)aDuaxmo;t0apt ii3iasfmDuln o u) eeomf3iydopDrln o (0teuo(o oo4al  miesltfsDtaur ;u0tlenio3iydfa2emums (4aetoxr ootfmteaivilt)tetm(rpnydll   ict s) Drmxr no1oeen i3iad m um(von(0 renif oa1lmtrlnvs;t0tetr(rpiydlpte ivils) rum( ono1teen f3iyd s ra(vont)aeenmr tatfmtrln sls) etoxr ou4ll emnctl(  Draxr ot0opxn oetlslm em(vo;t) reoif oatoptr nes s t2uoim nu1ap e fes ( aDrauro;u4apenmietltla ulumonu0 lxoif3oa1omtelnvsls trxo(rpno4omte ict s)srta( p;t0optnmiciltlsDelnvont) rxnmo oy1lpDrauvols)t2umiopnu1op emnctl()aDrax  ;u1tptoioeiyslsDrlnvs u0 exnmociotfpD luvs (  rtmxm3oy1am elfcil()s2uaxm ;t4aet mi3iyd aDemumonu0 exrio3tatom e uei t0srumim3ny4ll e ncs ( a2tmxr nt1aetn o3iyd mDra( s u0arermr oy1opt liei;()trtrxo ou1ameemnct (  rrrx oou4tltoiicils mDea( o;t4aetnmrcoodla   ivi t0 2uoxr ou1om n fci (faDtmx pno4apt  iciyd mDrln pn()tlxomf3oa1fpteai sls) rurxo3oydomtn nvtl( srua(  ;o0altn o3iysfmDea( ont4areomocto1opt anvols)srurio3ny4oltn ivtlt) rtaumont0tpx mieiad m2rm(msn() rtrircoo1lp r nes s s2xrxm io1lmtn fciasf Dtru ooo1aetomfciyd sDulnms;t) rxnxf iadoa e i i s t2tr(o no1ol   ivia(f 2umumooo4oetn oeils s2umnmpnu4arxoifcoatfmtelu i s0 2trir3oy4al  mnvsa()srrrur oo4oexnmi3iad s um(mp (4trxnirctatla elivi s srtmxr3iu4ame mfvtl() 2tm(m no4ope mieiyd m2ul( pnt)aetrxf oydlpt ln sls0 2uoim3oo4lp nmnctls) rra(ro;t0alxo oetltfs ranvon() lenmo tytomDe i i t srumim no1apee ncias)s2umxrono0aetomoeiasfaDra(mp (4areoif oodoaDrli s;s0 ruoxo3nu1lleelivil(f rtaxrpot0aleo octad sDea( pn(4 reomr3oa1lmte ivols  rtmir3io4al nlnctas) 2tmur nu1tpxnio3tatfm2rl(vsn(0 exomrctodlmD  nvo;( trtoxo ou4op   ivsls)arrr(m ;u1oetniicilsfs rlumonu0tetomr3tadfpteaies;() 2xrio ny1llt  ictatfsDrmur ou1alenmfciyt m emu snu0 lxnircoodlpDeln o ( sexr(opoy4lmeelfci t)sDtax oou0ape mieildla2ul( s;u0 lxoxo iytoaDr uvo t)setmim oy4alenlfcsatfarrrxmpnu1opx ioeilsfm2uanmsnu0teenir oydlmt anvil()t2xoio oodolt lfetl( a2ra( o;o1oeenmoctytlaDemuvp u)aexoxocoydom rauvil(0 etrimpno1optn fvs (  2rrurpou0tpeo oeildlm2emn p;t4aeeoxo3io1omD aneo;t sexrxm3iu1oltnmicta()s2tmxmo;u0tltnii3ilslmDul( o;t) leomo3oodlpD aneils t2xmxr iy4op emfes (f 2trumo;t0tle  ietytlm el( s t0 eenxociotlp rai s;s sexrio3ou4lmee ict tfartr( p;o0oeen ieildfm ul(mp u0 etnmfctatomDrlu sls  etrio3iodaptnmfvs t aDua( p;u4tlxomf3ildfs um(vpnt)arxnxfcoo1fpDeauvs;s) 2ur(mpoudam  lfciltfsDrrurpot4tpen i3ildlm rmnvs u) exnmo3ootfpD  u sls seuoxm3oo1am nlnvi t)sDtau onu1texomoctasfsDulums;(0trtniocoa1fmt  n s;t0srxo(r3ny4oltnlies ()artmurpoo4openiieiadfa2ea(mp t4aeenxf3oo1fptrlnes ()setr(r3ou4lmenlnesa( arraur no1opeomietasfs2rmnvo;()trxoxocoodfatraivil(0trxoio3ny1amtn nciat arrrum ;t0altniocildlaDua( onu) exrio todlaDr uei (  rtrim ou1oltnlnci s) Drmxrono0teeoioeiad m2rmu s;(0tleoxf oatfm r ivo;t0srtmxr3nu1apeemfctls srtmurpoo1tpenif3tltfm2rm( pn()trtnir3iytlmDrlu o s) 2xoxopoy1ll  lfvsa(farrr(mp;o4opto feiyt m2ul(vo;()aexoxfcoa1lpt lu sl(0srtm(o3nodlpe mfes t a2ra(roou4olxomoetydfs2eaums;u)arxoxfcoytoatrlivs (0trurim3oodam  lfvtas aDur(  ou1tlxniociytls rlnmon()treoxoctydlpD lies;(0s2ur(o3io1lle mfvtatf Dta(rp;o4alxoiieiyt s2umn onu0 rxnio iodlmD aieo;t trxoim io4apte fvsltf 2tm(mont0apxnif3iltla ulnms;t0tltoxr tatfmDranvo;t  rur(rpnodop   fciatfaruax oot1tptomo3iytfs um( pn(4teeomo3oydom e n s;t seurxr nodolt mivslt) Dtrxm nu0optniieiysls um(vpnt0 lerif iadoaDe neolt0 etriopoudlme  nvi s sDrmx pnu0tlxn i3tlsla2ranvsnu0tlxrxrctydfa rlieol( trtmimpoo1llt  netas arurumooo0texoiietyt a2uaumo t) etoirciatfptr nesls0 rxrxr oydopt  fvslt)arumuro;o0olen o3tas a2ulnmo t4tltrioctytomDr i o ()trumxmpnydom  miviat  Drm(rono0tptomociytla2ua(vont)tlxnmfcootlat  uvs t) rxoxr3iy4om  mictas) Dtru poo4tltomf3ils sDrl(vont)trxnir3tytfpDe i o;()srum(m iy4ll emictas  2urx ont0opx if3iyt mDeanvs;()trerxoctydoaDrluei;t) exrxr3oydlm   ivi sfsrtruro;t1texo oeiad aDelu o;u0trtrmr totlp   n o s0 2urim nudllenlnes (fs2tau o;o4olt  oeiydlm ulnvs t0 rxnxf to1fmDeauvs;t0t2trxrpou1opt  nci t)artrump;t0tpxoif3iad m2eanvont4 rerxr ta1lm rai i s sexrir3io1lptnlivt t)aDraur ot1aetoio3iydfsDulnmo u4 etnxf3iy1lptrln i;t0 rto(rpiudaptnlics ( aDua(mp;o4opxomociysfa rlu sn(4tltrxrciytom elneo;t) ruoio nodolee ics ()aDtrxmpot4tpeomfciltls ra(vo t0arxomocootla e ieols0teto(o no4lpeemfeias) Dtmurpoo0aexn f3iasfa2ua( snt0 eenir3oadfpt lu i;( trumirpio1olenmfvsls  2taum ;o4tptnmictaslaDuln snt) ltoxr3tatlpDelivi;t)trtrxo nudlptelnesa(  Dtrum ;o0aleoifciyt m uauvs;()tleoir iodlaD auvs;t0 rtmir3iydlle mfvt (fsDurx p;t1opt  iciasfmDulums;() reoif tydfp ean o t srtriopnudal elfvsa()sDtauro;o1oexoio3tydfm2ran s;u4texoif iotlp raues;( s2uoxr3oo4lptn fvta(faDra(rpnt4opto ictasfa2ra(mp u0trxnxf ia1lptr uvs t0trtr(o no1aptn ivtasfarur(r no0aetomiciyt m2ean snt4alxniocta1om r ies s tetrir3oo4lm e ies t s2tmumpnt0tlx mfciytfsDran o;()aeenifcto1lm  lieo;() exoir io1omenmnciasfsrtru  no4tle ifeiadls uanvo u4trxnxo3tadfmDean i (  rtr(r oydlm nmnvsas)sDumxmoot0apeomieias aDemu s () ltrir3oo1omte u olt  exmxrpou4opte fctas) 2rru  nt4oet  ictldfaDuln on(0tleoxf3io1fptr ues;s truoio iu4lmenmfctat) Dta(m ;u1tpeoiictyt a ea(mo;(4aexnxo iatlmtr i s;s) rto(o iy4ap n nei sfartmxmp;o1aexo fciasfs2elu pnu)arxnxf tydop elies (0texr(o iu1lm n fetls srtmu  ;o0opx miciadfa rlumo;t0 rxoxociadfa  lueils) rxriopio1op emfvilsfa2rmu p;u1optn o3iad sDrmuvpnu0 rermrciotfm rauvols0truoir3io1ape mnetls)sDtm(mpno1tlen ietad s eauvs;(0 ltnmr oadfaDe i i;t0seumio3iydllen ici t) Dtmxm ot1opxn fcildls ran pn(4areomf oy1lmteauvils)texrxo nydlmte fctlsfaDumuront1aexomo3iat s el(mo;(4artrmf io1lm elnvs s0trtrxm3iu4ll   ncslt sDtaxrp;t0optn ietlsfmDelu s;t) rtrxf tatlatrauvo;(0setoir oy4omtnmnvi s  2ra(m ;o1aexomo3iadla elnmo u4aeerxr3oa1omtr i ilt t2xr(r3io4lp emfei () Dta(rpou0tpenmictlsfs ra( o u0 lxnmf io1opDrlieo s0t2tmxo nydllenliviatf Dumx poo0tptn f3tydfa uanmo;u0teeoio iytoptr ivo;s s2xrim nudomtelfciat  ruaxr ;o1optn i3iyt mDelnvs u4tltrmrcoy1fpte n i;()texmxo3no4ope mivsls) 2urx  ;u0oetoii3iad s eln o;t4 leoif3totfmD ln o;s)trumxmpno1altnmieil()a2ur(roou0alenmf3iyd sDuluvp;(4aeeomf iy1fp elies;(  2xoxo nu1optn neils aDumxmo;u0tlxomo3iytlmDum(vp t0aexnxo3oa1la  an o ( t2tmxm3oy1lpt mncs sfaDtm( pno1tleomiciltfsDul( pnt4tlermr3tadlaDeauvilt) rxr(rpoodomtnmieils)aruaxmooo1apto i3tlsfsDra(mp;t)artnircty1faDe ivs ()srxm(o3iu4om elnvtltf Dtmxrpot4tpxn iciatlmDul( s t0trtnmr3todfa elnvs;(0sexoio oy4ape lnvias sDuaumpot1opt mfeiyd m2ra(ms t) ltomr ty1omtr nvo;s  rxo(o ny1ol emfet s)srrm(roou0aetoioctydfa uluvs t0trermf oodfpt au i t  rxrio iodom   ncsltfaDrm( oou4tptomo3iad aDuln p t)teeniocoa1oa   n o s trtr(r3oo4lleelncs ()s2rruronu4tlx mieiytls rlu o;u)altnmo3todoatrlueo;s texo(m3oo4omeemies ( srrmxmoot4tex ioetls s ulnvo;(0 lerxo tydfaD  nvs;s)sexoxo3oy4ol nlnetat  Dtr(mp;o4apxn f3tysfa uau o;t)aexnxocoatopD lu slt) etm(r nodllte fetas  rtmu onu1apt  ieild m2eaumsnt0tetnmo oadlpte uvil(0 exmxrpoodol elneia(fsDrrx onu1apxnio3ilsla ulu ont)texoxocty1oa r nvo t0s2xoxrpno1apt  ict (fs2rr(mp;t1opxn feiltfa rau s;t4 rtrmocoytom e i s;t0 euoxm3iy1lleelfeilsf rur(  oo4tptnio3tlsla rm(vo;t) rxrxf3tadfaD luvsl()tetmxmpiy4ape  fvi s  Dumxrono1oeeo o3tas a em(vsn() ltomo3ia1omDelu s;( sexo(o oy1ll elictls s2rmurono1tpxn fciytls2uau s;u)arxnxf3oydlpt anvils  2toiopoodome lfvsltf Duaxr oo0texomoeiasls2emnmo u)trxnif3oy1lp  aneol(  ruoxr3oy4al emnciltfs2rmx onu1olx if3iys sDeanvo t0artrxo3iytfptr u s t0t2umxm3iudope mfctl(  rtrumoou1optn fcild aDuluvp t) rxnmocia1fpDe ies;s  2xrxopnu4ll  mnesl( sDtmu o;t4alx io3tyslm2ran s ()alxoxr iytomD  uvo;t0trum(o iudop  lictat) 2rmur ;u1opt  octat sDua(vs;t)aexoxo3ty1opDelivi t0 2trio iu1lm nmictls)s2umx  ;u4teeoii3iatfaDrau sn()arermr oytopDeaueilt0setrxm3no4amtn nvt t srtm(m oo1tltnmo3iysls2ul(von(4aetrxf ootoa ran slt)srxm(m3iydome  nvtlsfsruru pno0ope ifeildfaDrmnvp;(4 exomr3ia1fmDe ieol(0trtm(o3oudlm emfei t) 2urumpoo1aptn oeild m rmn p;u0 lenxoctydla  aues;t t2urim io4ole licilt)srrmu p;o4tpxomfcilsfa2elnvsnu)arxnif3iadlp   ueil() etrxopny4lp  mivia( sDtm(mpnt4tltomi3iytfm2em(vsnt0 ltoxf oo1lmDrlueilt)trtrxo no1amtelnvt tfaDtmu  ;u1aexniieiyt mDeauvp;u4 rtoif3oytlaDeaueo;s)srxoxo nu4oleemnctas s2ta(ro;o4ape miciasfm umnmsnu)trtnmr3iytlptrai i;( tetmxr nu1lm nlivtl(  rrm(ro;u1oeenmoctlsls ua( onu4tetnif iydopte ies ()s2xmxmpoy4optelneta( s2rm(mono1opeo i3iasfsDrmn p;u)arxrmo3tatfa  lnvs;(0s2tmxmpno1ale mfvsas a2rmurooo0opxn ieiytfmDrl( o u4tetoxf3iytoate u ilt)trxo(m3no4om e iviatf Drmu pou0oeen ociyslaDea( pnt)aleomfcty1omt aieo () exm(rpiy1oleelfci tfaDurur no4olx  ictytfm um(vpn()tetnxr3oo1optr uvil( trtoir iodapeemfvtl(f 2rmxr nt1tlt miciaslm2ra(mp (0 leriocoodfaDranei;s setmim nu4apeemnes (  Dtm(m ou1olt mieiad s ul( onu0 lxnirciotfm e iesls setoir ou1om n nci t  rum(  nt0aee  f3tadlsDemuvsn()teeomr iytlmt  n o;( sruo(o io1llen neta(  Dtaxrpno1aeto octytls2umu s u0aetrxr oodop   neol(0srxrxmpnu4ope mnvsls)aruau  nt4tetnmietadlm rmnmp;u4 lxnircia1fpDeln i t) euoxopny4ope  nvsatfsrrm(moou1olxnmiciat s2uanvs (4trerxo3io1laDrln s;t)s2to(opoudol   nvil()s2ta( pot0olx moctydlm2rmnvo;u0arxrio iodomDrlieolt0srxmio3ou1olt mict t  rum(mp;t4opeo ociys a ea(mp;(4 ltomocoadoaDr nes;()s2urxo iodlpe  icsl(f 2rmxrp;t4ale mo3iltla ua(vo (4tetoir3todlpteln i;s) rxrxr iy4om e fei ()a2rm(rpno1altniieilsfm2rl( pnt0tlermf totoa eauvs;s0sexm(r3iu1am   ivtatfaDtrxr nt1apx  fctas s um( s;u4artnir3iy1fptelieil()trxo(opnu1olt lnctls s2trx  no4aeeoio3iadlsDemuvo;u) rxrxr3iytlaD anei t  2xrxm3io4lmeelnesas srtaxm ou4alxoiicildfs2raump;t0 rxnmo totfpt lnvs;(0t2uoiopnodamtn feslt)s2rmur nt1alto i3iysla2ean s t4trtrif3oa1faDe uvsl() 2uoimpou1optnlnvils  rrm(  oo1oetoio3tydla2ranvo t0aetnxf oadomDe ieil(0 2tr(o3nydam  mfcilt  rrm( p;o1apxn ictys s2rm(mo;u4tlxrxr tydfatr ivi (0srtmim ny1ol  mivil( s2rr(moou4tlxo o3tysfa ulu p;u)aeenmo3oadfaDean i;t) rtmimpiudal elnesl( s2rru  ;t1alx  ieildla2ul( o (4 eeoxf iydfm   n o;s  rxrxopiy4al  lneia(fsDtr(ro;u1alenmfeiatls2eau o u4texrmociodomt ln sl(0tetr(o3nu1lpeelfvi (  Duru poo1open f3iad sDum( s t0 eenio3tydfaD  uvs;s0t2tr(opoydllenmfvsatfsDumx pnu0olt iiciysfs2uanvp;(4trtoio3oatomt an il(0 2uoiopio1lp  mnetlt)sDrr(rpnu1alxomictys aDuan o t4arxrmocoydla eaueo;t srxo(o3oo1olt  nvi t)a2umxmp;t4oltomfciatlsDean o u0aetomr tatoate nvi s) 2uo(o3iudopeemfei tfsrua(m nu1aetoiietltla2emu p;() rxrir ia1lpDe u o t) 2tr(m3nu4llt lneils)arrauroot0alxn ictaslsDumu onu0 rtnir ta1lp rli s t)t2to(o3no4op e nvtas)aDur(mp;u0olt iocilsfm2um( p;t4trenif iytfmD  uvi s)srtm(opiydlptemfciasfsDrmur nt1tltniiciydfaDemn pn(4texomr3ty1optr ivo;()sexr(mpio4lpenmncta()s2trur nt4aee  i3iyslm uau pnu4 rtnio3iy1lpDeanei t s2xmxo3ny4ap  mfvilsfaDtrumono4ope miciad s2elumo t0texomocio1fp e nvi s t2tmxo ou1omt  ieils)srurump;u4aeeo oeiltfmDrmump ()arxomo iytop ranvi;() 2xr(opno4lme mictls  rtrxmpno0olt iiciys a umn s;u) renmfcio1fm ean i () 2uoimpny1op emnvi t)srumxmoot0open feiaslm2uan o;u4arxoir3totom  ai o;s  2uoio3nu4ame  net sfa2rrxr ;t1tle  i3tldfaDrl(mp;u)tetoio3ta1lpteai il(0trum(m ny1altemfviltfs2rr(r ;u4tetn oeiytfm2ul(vp u4 etoxo iytlmte ivi;t0t2tm(m3nu4alen netl() 2rrumooo4tptoiictadlsDumuvp;t0tleoif3to1fp eaneil( srxmio iodopenlfeia()sDtaxroou0oleniiciydla2ul( s;() rtnirctytop r u i (  ruo(m3iudop   iesl()aDra(r ou0aeto ociltla rau o t0aleoxr3oydlp eaieols0srtrirpnodapen fcia( arur(r nt0oltniocilsla2rl(ms ()tltoxfcty1oaDranvslt srum(r nudop nliet ( arrr(mpoo1teenif3iaslsDemump (0trtoxfciadfatraneolt0sexr(r3nu4lltelfet s) rumx pno0tetoio3iysls rm(ms;()aexnxfctatfmte ueo;(0 etrxm oodlmeelfetltfartru ooo1oex iociasfaDrm(mo;u) ltrif3oadfa   iesls texrxmpio1openmfeias)sDrm(mont4oetomo3ias m2ea( o u0 reoio tatlp r ivo;t0trurio3nydom n fesa(fsDtaumoou4texniiciat s umn o;(4tlerio3ootom  liei;s0srum(mpiydoleemiviasfs2ur(mo;o0oleomfctyd a2um( o u0 exnmf ootlmtranvs;s0 2xmiopoudomee iet (  rta(rpou0opeomociatfs2rlu on() reoxrcoatfmDe uvol()s2xoxrpnudlltnmnet t) Dur(mono0tlx mociysfs2emn ont0arermo iodfatrlivi ()truriopiydll e nei ()sDtm( pno1alx  oetasfm2elumo;t)alxomr3oy1lptr uvol()t2uo(m oy1amt mneslt)a2tmxrpnt1tpt mieiytfmDum(vo;u0aetnxf3tydlp  lieolt)t2uoxm oo4lmteliei t s2tru poo0tlx moctltla2uln pnu)artnmr iotfptr neslt)srtrir3oo4optn fvtl(fsrtrumpou1oee moeildls rmnmo;(0tlxomo oa1laDrlu olt)sexo(mpou4ll elncsas) 2umx pnt0oleoioeiltfs2rmnvonu4trtoir3ty1omDr ivs;s)trxrxr ny1lpt  ivs t aDtru  nu0aexo oeiatls emnmpnt)artnxrctydfmt  uvo (  rtoxrpoydol nmictlsfaruaxr ;u4alx mfetatfm2ra( o;t) etnmfcoatlp  anvols0srtoir3iu1ape  ies sf Duaxm nt1aeto ociysfa2emn s;()aexomr3tytlaDelueils)trtmxmpnodopt  ivs sfa2uau o;u1olx mieild m2emuvo u) rxnxf3tadfaD ai i s sexr(o3nu4omenmfei tf rrrxro;u4oleomfeildlaDel( o;t0 leoxociatopDeli i;()s2xmxr io4lp nlnetas)srua( oou0tpenmi3iysls rlu pn()aexrxr3tydoat  u o t0teum(opny4omte nvsl(f rrm( p;o1aetniicils s ul(vo (0tlxrmr io1latelneols0s2xrxm io4ll  mncsl( arrru  ;o4aexo oetadlaDuln o u0tltoir oytoaDrluvi t0t2xoxrpno1lmtnmfvia()sDurxmpot1apeomocias m2um(vp u0 ltnxo3ootlmteai ol()t2toimpoy1amt  nvsltf rumuronu1optomf3ildlm2ulums;t0tlxoxo ty1lmDeau o ( sexoir oo1olt mfeta( s2umu  ;t1apx mieiat s2ea(vsn(4 ltnif3iotla ranei t) eum(m no4olt  neilt) 2rrxmp;t1tpxomi3ildlm2umnvo (4arerio3iy1opt livi ()s2xoxr3oo4lmeemnvsat srurxmono1tpto i3ils s2rln p u4 lxrio3iydfpte n il(0srxr(r3nudapte ictlt srur(mo;t4tee ioetyslaDul(vo;(4aexnmf oytfmtrai i;t)sexr(m3ou1lm e fcils)aDrrur ;t4optn o3iyt m rauvp t0alxoir iodop rluvi t0truoxr iydop nmnvils)s2umuroot0tlx mociytlm rmnmp;u4teeoiocoytfmt  u s;(0 2uo(rpiydlm nlfcil() 2ua(mpoo4alx iiciyt sDrl(vs t) lxnio3tadlp eli sls0srum(o no4omee fct s)s2tmu  ou1olx  ocildfm uau ont)artoio3tatfpD aivo (0t2urimpoodll emieiat)a2taxronu4alx  ieias mDum( snu4aeeoif3oydopD lu o;t0s2to(r iudaleemfcs () 2trump;o0aee  fcildla2rlumo u) rtomo3to1faDeluvo t)tetoxopiu1am  lnvslt)a2ra( onu4oltniieildla ran snu0 lerir ia1om elivils)s2urxr iydol   fcs ()arurxm nu4oexoiiciasfaDem(mo t4tlxoir3ootlpt  nvsls)t2tmim iu4oltelnvslsf 2umum ;t0tlxn iciasfaDem(mo;t4 rermr tytfmtrln ols  2xoiopnodlp nlnet s  Dtmumont0olxnio3tlt a2ean p;u)texoifcoadfmDeaieils) ruoimpio4ol elfviat artr(  ot0oexo fetldlsDra( pnu)tltomo iodlpt lnvi s  rurirpiy4alt  iviat sDumumpou4aeeo i3tydlm ran snu0alenxo iy1fmD aivi;(0 2tmio iy1lmtnmfcsat sDraxmont0ape ii3iatls2ra(vp ()tlxrirciotfa raieo;t0 2toxo3iu1amen nvtl( s2tmxrp;t4tet mf3ias s2rln p;t0trxnmf3iytfp  lueo;t0srumxo oodaleelfcsat  Dumuro;u0aeenmf3tasfs2emumo;(4 exrio3tytfm  aueols0seurxo oydllt mfei t)sruax pnu4olenmociad a2ea( s;u)areoxr iytoatr n ols)srtoxmpiydomtn ictltfsDraurp;t0oltomocils aDumuvs u4 exrmrciotfa  livo t)seto(m nu1lltemncias aDuru ono0tltnmi3tydlaDem( snt4tltnxo3tytfmtrln sl()t2to(o3oo1ap nmfet ( aruaxm nt4tpxo f3ias s2ran pn() rtnxo oadlaDr i ols) 2to(opiu1omtemicslsfsDrr( pot0tpxnmfeiaslm2uln pnt0 etrmocoatlp e i i s srto(r3oodllen nci t  2ta(  nu4opx  o3tys m emn p u)alxrmocoadfpt  ies t0 rxrxm3iydlp nlfcslt srrmx pou4tet mfeiasls umumsn() etomf3oytop raiesls  etmxopiu1amtnlfvsat a2rrxm ;o1apeo oeiltlaDeluvs t0aeeoiocia1lptrlu o t0seuoio iudoptelivsas  rra(moot4oexn ieiydfmDum( p (0altrmfctatlmt  neo;s tetmir oy1olte nei tf Draxm ;o4alen fctlt aDumuvo;t0altrmo ia1fpt anes ()setoiopnu4lme liciasfa2uru pnu1tleomfctad s em(msnu0tlxoir ia1lmDean olt trtoxm3iy4omenmfvslsfsrurxm nu1ope ioeiadlm emn on(4teeomf oydlmtelues t0trxoim3nodole miciatf rtmxr ot4apxomi3iydfa2um( sn(0 ltoxrciydfa   i s;t0 rur(o nu4lmtnlneta()arrr(moou4tlx  o3iatla emnmpnt0 lermo todopteau sls0seumiopoy1am emfvt (fs2umuroou1oexoiiciysls rauvo u4 lxrmocty1fm eli i t0trtr(r3iudomtnlfvs (  rurump;o4oltnioetld a eluvsnu4artnmf oy1lmtr neo;s0trtm(o oudlm   nctas)a2uaur ;u4aptn fciytfsDea(vs t4tltnircootopte uvils  rxmxr ny1lmeemncs (  Dur(m ;o0tpeomoetaslaDrauvp (4teeoif3iodlmteli ols  rtmxr iudam emfvsl( sDtrx  oo4ale  f3ildfa2ulumo t0trxrmr oatlptrli sls)teurimpio4ape  nvslsf 2rau  nu1optomictat aDea(mon(4 renir3tatlmtraneo t0 2urxrpiudapeemfet s)a2rau pnt1altomf3iytfs elnmpn(0aetnxr3oo1fm elnes ()trxoxr3iudllte fct sfaDtr(  ou0tpx mi3ias m el(vpnt0 exnxocto1fm r u ils srto(rpiu4op nmfei t srra(ro;u1opxo ictyt a em(monu)artoifctadfp eauvo;( s2trxm3io4aptn nvils) ruaxmont1aee io3iyd s2eln pnt4 lxoir3tadoat li slt0seuoio3nodolte feta(  Duax pot1alxn i3iytfs ea( p;t4trerxfcootfp   nvi t0 rxm(r3iy4opeemietlt) Drmx ooo1tpeoif3iyd m2uluvp;(0 rtrxo3iatlateanvil( trxoimpio4lle mfvi ()sDrrump;o4alx mfetltfm rlu p;(0 leoir3ootop elivils0trurimpoy1openlnvsasf 2ua(mo;t0apx mietldlm2em(monu0artrif3to1faDelnes s  2toxo3oy1apt lfvi t) 2rmumoot4oltn feiatfaDul(mpn()tetrxrciy1laD li s;s0t2toio3iydomenlivtas)srumumpot4tpe  fcild m2rmuvs;(0tlxrmfcootfpD lnvs s0 2xoim3oydolte ict t) Drau  no0oex iocild mDran p;(4 ltrio3ty1oat  u slt) etrxo ou4llen neslt  Drr(moot4olenmoctltfs2uln p () lerifciatla raieo (0 rxoxr3ny4ll e ivs ( srtmx  ;o4alxn f3iyt m uanvp;u0tlxnmo oodlptelies s texrxr no1lmen neil()arururo;o0aex mietad a2uauvo t4 rxrmf ty1fatean s t teuo(m io4lptnlnci t  Dra( p;u0alxomfeiadfs um(vpn() eenio3oydfatr neo s0 2uoxopoo1apte neia( s2tmxm ot1opxomfeiltla ulumont)tltriocoadlm raieo (  rxrir iudlm  mivi s  2umumpno0alen ociyd aDum( o;t)altnmocoadomteaneils  rtoxmpoo4amtn ivtl( sDrmx  ;o1oex ifeiysla um(vp;t0 rxnxfcta1oaD lu slt s2xrxmpio4open fciasf 2tmumont0ope if3iytla em( p;u)altomr3oytlp r u i;( sruo(m no4lltnlict tf Drrxm ou0oleo icildls2umu o t0trerxrcoy1la  aieo;s0s2xrirpiy4op  lieslsf ruaxro;t1tlxniocilsls2rl(mpn(0aeenxfcoa1om  lnei;t0 ruoir oy4optnlnei (  rrau o;o0aeenmfetlsls eaump;(4 renmr to1fp e nvilt s2xoxo3nu4olt mfvsa( artrurono1alt ifeiysfm2uln ont0alerif iotlp rluvs;(0 2tmxo3ou1am  micslt aDrax oou4opxomoctytlm raumsnu4altoif oadfmte neils t2uoim3iu4ap  lnvs ( arum( p;u1oetoifctasfm2uln on(4tltrif3tydlpDelu o;(0setoirpoo4ap   nvs t)s2ra(mooo4open ieiyt m2rm(mpn()artomr io1op  auvolt) exrio3ou1optemfesa()s2taump;u0tleomfetaslaDuauvs;t4 ltnifcoa1lm raivi s teuo(rpiu1aptemiciat)arrmxr ;o0tpxnmieiasla2ranvont0aexoxo3oatfp r nvi t trurimpio4llt livsls) 2tax oou0aexnmieiyslm2uauvp;t0aetnir3iy1lat aivs () rumxrpny4amtnmfcsas)aDtrxr oo1tlx iiciasls ea( o;u4tlxrxr ty1lmt  nvols)t2uo(r ny1lltelfeilt) rrru  ou1texnioeiat a rm( p;u4 lxrmo ia1opteln olt0t2xoxr nu1om elfctls a2rau pnu0optn oeiyt sDel( ont0trtrircto1fmDrauvo;s0texoxo oydale  fci t  2rmx pot0altoio3iasls2rl( sn()alxnxrciy1opD liei;s seumiopoy4omt mfcsa()s2rmxrooo0opxnif3ildlm2rm( p u4texnxfcoytfm   n s t srxm(m iu1omte fvtl()srumum oo1tetnmf3tydlaDrmnmon(0 exrir to1omDeli s;t0t2xoim3iu4al   fvtat)srtm(mpot0oee mi3tysfs rl(vo (0 exoir3ia1fa r i s () 2urim iy4omeemnvt sf 2urum ou0ale ii3iyd aDranvon(0aexrio3iadfpDr uvs;s  eurim ou1ape liesa() rrm(  ou4tle  o3iadla2uluvpnu)artrifcia1oaDrlu o;t teur(r3iudop elivtatfsrurur nt4tleniiciytfsDeauvo;(0tlerio3oadla r ueslt) 2trir oudll  mivt sfs2umur no0tlxo i3tat a ulnmon(4 exrmocoy1fa rluvs t  2to(mpny4omen ivsa( srur(r no1aexnmictydfm rlumo u0 lxnmo iydoa  aieilt sexmio ny4oltn icils)aDrmurp;t1tpxn f3iad s2um(vs t0teeomf3iotfat lnvo s0 2toio ou1ll  mivtas  rta( o;t0oex moetys mDum(ms (4artrif oa1oate i s;()texo(o ou4lpen iesls) Dtmx pnt4opx ii3iatfa emnmo t4altnioctatomtr ivo;s)t2umirpnu1al nmfcsl()s2rmx p;o0alen oetat mDrlump () leoxrcoa1lp   ieilt0 etr(rpoudamtemfvtlt  rtmx ooo1ope ifetytla ra( s ()tlxnxr iotfpt auvo s0 eum(o iy1olte fcsas) rrmxmo;o0apenmoeiys mDel(mo;(4 etrmoctatfa rlnes;t)s2xmio nydlm  mfvsat) rtr(ro;o0tlxo octysfa2eau s ()teenmf oatlp   u i;(0t2xoim nu4lmeemict s srtr(r ;o1tleoif3iltfmDrauvp u)tetnmrcty1fa elnvo s) rtr(o no4altnmncs (f 2uau pno0oleo o3tasla2umu p u)alxoif todfaDraiei;t t2umio iy4lmtn nvt t) rtmxmp;u4tpx mfeiadfsDrm( s;t)teerxr oadop e n s;t)trtoxr iy4am   ncilt s2rru  ;o4olxomfctls aDranvpnu4 rerircoy1oatrln olt srtr(o iudopte ies sfarrmx  ou4oexo octytfsDrmu s ()arxomr3oy1oaD  i sls) exmim iydlptemfetas  Duaxmonu0aeeo oeiytla umums;(4altoio3tadlmD  ues;s0 rtm(m oudlptnmieta(  Dum(m ot4tee mietysls rl(vs t) exnxrcto1oa  anvo;() 2umim3oy4op n fvils)aDuaxro;t0alxomf3iasfsDrl(mp;() eenio3oatoptranes;t) 2toio nu1am n ictltf ruau  ;o4oetniiciytfm emums u)arenxr3iydfp  aivils)s2urxopou4lmeemnetlt)s2rrum nu0oexomiciyd a rmnmp;u0trtrxr iy1lpDrai o;(0t2xmxrpiu1ll emnvsl(  2tmumpnt1aeto i3tyd aDeau o;t0texnxf oo1faD li ol(  2trir3nudomt lfes t s2uaum ;o0tlxn fetytlaDumnms (4 rxnmr3iy1omtranvs;s  eurir io4openlies (fsDta(mpoo4ale iiciyd s2rauvp;t)altrmr3oadfp r ieo s0 rxmxr io4llee nvt t) rtmxr ot0alt mf3iltfaDulnms u4tleoif3to1oate ivols)trtmir3io4ole  fvi t)a2rrur ot0aee  f3iytla2ea(mpn() exnifctotlmDrlues;s0setrxr3oodll e fct t  Durxm nu0apenioeiltfa2eanvo t)alxoxr3ia1latr i o;t0srtm(o3nudaltn nvtasfa2um(rp;o0oexnmfeiadfm2el(mp;t)aetrio3ta1lat  neo (0texm(r oodom   nvi sfa2tr(ro;t0optnmfeiytls2umuvon(0texoifciatlmtean i t teurio3nydlmt lncslsf ruau poo4oet  feils a2ua(ms;u0artnmfcia1oa e nes t) eumirpoo1openmnctatfaDtm( o;o4apeoifetasfs2rmumsnt)texnxf oytopDelivo;t)srxoxr3iudlmtnmncs s)a2trumonu4apxomictad m rmnvp u4artnif3to1op r uvs s  2xm(m3io1llt lietatfs2rrxm ou1olx  ociydls rmnmpnt0 rtnxr ia1fp e u il() rxoxm nu4olt mfci t s2rm(mo;o0aet  f3iatla2uau snt0tltoxr oy1omtrlnvi s s2toiopou1lm n neils  2tauro;t0aleomietytfaDeauvon(4tltrif totfmt an sl( t2umiopny1ll emnet tfarrmum nu1alto fciydfa ul( s u0 etnmrciotom rliesl()setmxm3oodlpte ieilt arumxrp;t1tpe  fcildfm2um(mp t0treomr oodfptr u ol(  2urio3iu4optnmneiatfaDur(m ;o4openioetlsls umu p;u) etnxo3ta1oateanvols texo(r3iu4ap  mfeilsfarrm(r ;o4ale iictad m ea(vo (4aeenxo iatlmtrlneo t)t2um(opiy1openmiesls  Dumum nu1ope if3tad a rau p;()arxnmfcta1late uvi (  eum(o3oo1al nmfei t  rtmump;t4aee  fetasls elnvonu) leomrciatopt lnvi s0t2xr(o3nudomen fvt tf rururpou4tee iieiadlm el(vonu4teerio iydfpteluvolt  rxmxo3ou4llt lfeia()arrr(mpoo4aex if3tyd mDuanmo;(4 reoxo iatop  lnes s0sexo(rpiu1ap n nviat)arum(  ot0alt  oeiatlaDemump;() reomrciotfpD aivo ()tetmxm oy1ll e nes s)arurur ;u1alxo oetydls2ea(vs u4aeeoxfciodfm  lieo (0trxoxm3no4lm nmicsltfs2ururo;t4oeeoiociltlsDul( o;u)tleoio iodoatrauei t srtoim ny1ole  fvtls aDra(r ;t0tltnio3iat aDelu on()texnxociy1omte nvs;( seurxo iy4ol  mivtas srrrxmo;t0opxnif3ias mDeluvpn(0tetoiociydom rlnvs (0s2to(m3nydlpt mfvi ()sDur( o;u4aex micild s ranmp (4aexoxr3iy1fpD lu i s) exoimpiy4ope  nvslsfarra(ro;t4aptn o3iyd m2ua(vonu0aexomr3iotfp eai ilt0srumir3ou4om emfeia()aDrax  ou0tptoii3iysfaDel(vp (0aexrmfctytop e ueil(0s2toxm nydlpeemfvt sfarrrumoou0olxnmieiat mDulnvsnu4 lenxfcta1la rlieil( s2um(m oy4ol n netas) Duau o;o4olxnmf3tytfmDranmp;(4 ltoircoy1fmtraueils teumxm3iydale licta(  2uaxmont1teenmfeildfs2um(ms t)tltnxo ia1lptelieol(0s2umxr oodlpe lfeil(faruau  ou4tpxoioeiad m rauvs t4tetnxocto1lmDrai s (0s2urxo3oo1ale lictat)a2raxm nt1texo ictyt aDem(mpn(0 rxnxo oa1lmDrluvsls0teumxrpiodomeelnetl(  rurxrpno0tltnmictatla2uauvpn(4tltnxo3iadla eluvolt)tetr(r3no4apenmncs ()s2rrumpot0teen fcilsfm rmnmo;t)aeeomrctydfatr ivsl()srxm(o3oudopeemfet (faDtrur oo1ope mfciydfaDrmuvpnt)trxrif oy1fatrluvs s) exrxo ny1ol  lfvslt)aDra(rpnt1teeo ietldls2em(vpnu) ltoiocoa1op r ivo s0 2xmimpiu4am elnvilt)s2tr(root1apeomoctadfsDeluvp (0 exnio3oadlpteaivilt truo(o3iy1lptn nes (f Dtmx oot4altniicilt mDeauvp u0 rtoif3ta1lp ranei;()trxrio no1llenlnetat sruaumpot1opxoiictydls el( s (4aeeoif3oydlm  lu s;t) eumxm io1ap nlieils  2rm(moou4ole moctld a2emums t0aexrxfcty1om e ies;t  2umxo oudapt mnviltf Duaum ot0olenmicilslmDemnvp (4tetomr3tydoaD livols0srtoxo3oo1ll emfctls  2urur nt4tle ioeiltfs ul(vo;u) rtnxocto1lp  aivi;t)trur(m3oy4aptn ics s)sDurxm oo0tlx ifeildls2rm( s;(0arenxr tytlp   u olt)srxm(r iydopen nctlt) 2uaxrp;u4tpxn feiyt aDem( pn(4tleoiocty1lateai i;()teum(rpoudapenlfvtatf Dra(ronu0apen iciaslm2uauvpnu)artnxf3io1fmDrlneo (0trxrxr nodaptn fcs t sDrr(m ;o1alt iociltfsDrmu s;()arerioctydoaDr nvo;s0texm(mpiodlle mfvsls  Dtmxr ou0tee ii3iat a umnvp;(0aeermocoodfp rlues;s0s2tm(r iy1lme mietlt)a2rmxr ot0olen oetadfm2em( s ()tetnxf3tatfpt lueo;(0s2ur(opiodlm n ics t) 2urxm no0tptomf3tadfmDeanvs;()trxrmr oy1om  au s t) 2xr(r3nodllt mnes sf 2tauroou0oexnmoeiyt s ranmo;(0altrmr iydfptranei s trxrimpio4ol  licsl() 2ua(rono1olxnioetyt aDuan o t0alxoxocoy1lmDelnvols)setr(r iy4ole mnciasfsDuru  no1optnmi3iltfs2ea(vp u)texoxr3oodoaDean s t0s2xoxopoodopeemietatfa2rrum ;u4opeo fciytfs2em( o;t4 ltomo3oa1omtraiei;()trurir3iu1ape lnvtl( a2rax ono1oex  icildfs2rl(mp u) reoif3iatfmDrln s (0 etoxopnydllee fesasf rtmx p;t4tpeoiocilsfaDemu o u0 reomf to1fat  neo ()t2umimpio1lpt  netlsfarrm(mooo0aeen f3ild aDemnmo t0 eenxf oo1opDr u il(0trxmio3iu4oltelfcsls)arrmu  no1tlt  oeils mDrmnvo u0aleoxocoydopD  u slt)s2xoimpnodol  mnvt t s2rmu oot4aexomoeias sDemnvp ()trermf iadfptr u o s0trur(m3ny1olen netltfa2rrump;o0oee mieiytls2emu s;t4tlerxr3iatlm  livs;s)teumim iu1lpee nvi t)a2raxm ot4oexomi3ildla2eauvo;u)aetoio3iytop eai o s0texmio nudole  ietltfs2uru ont1optomf3iasla2emuvs;()teenxf3io1fpD auei;t  2toxr ny1al elnvia() Dra(rp;u1tex  feils s2uau pnu0tltnmf to1oa eaneo t)s2umir3iu4am   ncsas s2ua(ront0tptoioctat mDeluvp (4 rermo3oydopDrlueslt0teuoxm3ny1ome mfesls)sDum(mpnu1ale io3tytla elu snt)tltoxf3oo1lmDe n il(0 etriopnydomenmfcs s aDum(m ot0texo fetad aDea( s;u0teeoxf3totfa rlnvil()tetoio iy1lmte fvtl() 2um(moou4olenioeiysla2em(monu)aetrmo todlat  u o;t)truoxopnydapeelneiat)srurumooo1aex ioeiad aDrauvp u4 leoxocoodfmteli ol(0tetr(m3oy1openmfvtltfarrau ooo1ope moctysfs2eanmo (0texrxo3iytlmDr ivo;( trtmxopiu4ap emiesltfsDumum ot0oex  iciys sDea(mp;(0altrmo iodlm  aieils0truoio oo4omeelies t srra( o;o4tltnioeiydls2ul(vs;t0 rtomr iodfptrlivolt s2um(m3oydalenmneilt)sDtmx  oo1aex mf3iytfs ea( pnu4 rtoif oydfa   uvslt)t2to(m no1ap nmnct sfarum( pno1opxnmi3iyd mDuluvo;(4trxomrcta1oate u il( t2xmxm nydamenmnet s srum(  ;t4apto o3tydfmDumump t4 exrxr ootfa elu o s0teuoir nudlp e nvi tfarrrxrp;t0opt ifciytfs2eln s u0trtoio iy1laD  u o;t)srtrim3nu4altelnei (f Dum( p;o0alto i3iyd aDrl(vo;t)trtoxo to1omD  u o t0s2xmxm3oydlm emivsas srrax oou4oltn fcils s2ua(vsn()tetrmf3oa1la ranvs;(0 2uo(mpiodlme miciltfa2ua( pot4tlxn fciltfs2rl( p;t4 eeoir iydlm  auei s)t2xmxrpnodapt  ieslt)a2uaxront0tlxn f3iysfa2uauvs () lerircoydomtelueol(0s2xm(o3oy1amtemneil( artaxmpot4altoioeiat a2rmump;(0areoif iadoptrlnvsls0t2xo(mpny1ame  ncta( aDrr(  ;o0alxoif3iysfmDrmump;()alxrir tytomt  i ilt0seuoiopno4aptemfvi () 2tm(  nt4apxnmieiatlm umums (0altrmf3iydom r iesl( tetmio3nu4ol  lfcs t) rum(ronu1aetnmociysls2el(vp u0tlerxf oadoaD  neils  rto(rpiy4al nlics (  Dtmurono1opeomietltlm ua(vs;u)teenio tatlaDr ivs;s srxrxo3nodap  mnetlt) 2ururono1tlxoifctyd aDrmu p u4tltrmo3oo1fptr u sl(0s2xrirpiu1ap   nci (fsDrr(roou1tlxnmo3iysfm ea(vonu)tlxoircta1om  aivsl()t2to(r ou1op e iciatf Dtaxmo;t4aptnmociydlaDraumon(4 etoxo3oodla eanvol(0s2urxopnu4lpe mncsl(  2tr(mpoo4opeomf3iatfa2emnmo;u0trermf3iydfp r n ilt0 2umio nu1om n ict (  rrau  ;o0tltoiieiatla ra( o;()trxrxf3oa1lm eai olt0trtrxrpny4lmtnlnviat)artrxr ;u1alenmfeiytfs ra(mp (0 lerxr3tytlmtr iei;s0trtmim ny4lm   ivsas)sDrm(m nt0optn octytla rluvsnu)texoxo tydlm rlivi;t0 2xoio no4op e iciasf Dua( ono4aee ioeias s2rl(ms t4tlxomo3todlp r iei s  2toxopoydlptelics t)srrr(mpot0tee mf3tysfs elump u)trenxo3tatfmte nvo t0seuoim3iy1oltelies tf Dtmx ont4tpeomieiysfa2ulu s;() rxrir tytfateanvs;(0 eum(r3ou4lptn fvia(fs2rrxmp;u4aex ii3tyd mDel(vo;u0 lxoxf3iytoat livi;s)texrxr3nydomte ivsas) rrmx  ou4oet iieiydlaDel( s;(0aeermo3oadoa e iei;t  euoxrpnydll  livsas)a2urxro;o0openmoetys m ra(vs u0tlxnifcoydfm   u s;s)trumimpno4ap e ieia(  Dum(rp;u0tleniieilsfa ua(vpn(0treoifcio1fat luvo;t s2uo(m3ou4lltnliei (fartr(m oo1altomociadla2ranvpnu4tlxrxf ia1fptr ieilt)teto(rpnu1lptn netat) 2rru  ot4tlenmfeiat mDuanms;u)teeomo oytomtr iei;s texo(r3ny1lmtnlfcsatfartrxr nu0apenioctatls2ul(ms;(0tltnircoytfp rauvs;t0 2uoxmpnudlmenlfct s)aDuau p;o0apenmociyd a rm( on(4tlxrir3oadfatrluvil(0 eurxm3ou1openlneilsfa2tax oou0tpeniociaslmDelumsnt)trxomf to1lm raneo s tetr(mpiudopeemfvi t  Dur( pnt1opt mo3iltlmDuau p t0 exomfcootfa  luvi ()srxmxo3oydlmenlneta() 2um(ro;o0opx  ieiytfm umn s;t0aeenirciodfaDrlneols srxrxr3iy4lle licsa() rtaxrp;o4tpen feiasfs ul(vp;(0 ltnir iadlptelu i;t)s2umir ny1lp n fvt s)s2rr(  oo1texo oeiat mDranmo t4 exnif to1lpD livolt s2to(m iu4lpen ivt t  2um( oou1apto iciltls2eanvp u)tetrmf oadlpD anvo s  rurxr iydlpt  fcsls aDtmxmpnu0aleoifciadlm uanmp;u0aleomo oytop r nvs ( teuo(r iy1lmeemieia( sDrrumpnt4aexnmoetad a2rl(ms t) exnir3ootfate nvs;s teuoxr3ou1amenlfesas aruaxr no4oeenif3iasfaDumu onu) exoxo oy1lat  nvslt)trumim3oudlpee fvtat)sDurxro;t4tee mfeilslm emn p;t0aeenifcta1fpDr i o ()t2uo(r nu1lptemnctlsfaDrru  ou4optnmfeiadla2emumont4aexnxo ty1lmte ivolt0 etmim iu4lpe  ict (f rta( pou0tleniiciys a ulu s u)texoirctadla  aies ( tetoimpou4aleemnvs (farur(roou1tetn octydfsDum( o u0aeenmoctotopD ai s;( srtr(mpny4ol nmnvi s a2taxmpnt1apenii3iysfm2ran o t4tetrmo oa1fpD  u i;()trxoxmpiudllt mictatfsrrrx  ot1alt mietatls emnmp;(4aetrxr3io1fmD  ivsls srum(r3ny4lptnlnetlt)arraumpou0olxomoeiydfaDemnmp (4teerxr iodlmDeluvi;s trtrxo3ou1omeelnvia()srur(rpnu1altnii3tatfa2ranvo t4tetrxf to1laD an s;t)tetr(m nydalen ict tfaDtrxr ;u0tlxnmi3tytfs2umn onu4artnxo3oodfp rln o;(  rurim3no1apenlnviltf 2urumo;t1opx iieiyd aDrmumo;t4alxoircty1laDrlu i t0 exmxo no1am nlneias) 2rm(m ;o0oltomi3ilt aDuluvp t)alxnir3oatlaD  u i;s0 rxmxm no1altn icta( arrr(r ;o1aetomo3iad mDem(vsn(4trenmfcoo1fp   uvi;(0t2tmxr3iy4ome lneias)a2urumoot0alxomfciysls elnmpnu)teerifcoytfatrliei;s  2xrim nodlp   fcilt aruaurp;t1tpxn icilsfm2umu snu)texnir3iadfate uvi s0 eur(m nudlp  mncsl(faDtmxrpno0tleo f3tadfm eanvo;t) rxnxrciatfptraneo t)s2xoxr3oy4lm elfcilt  Drru  oo1tlx mf3iysls2em( p;(0aeerir3todlaDe nesl()s2xrxo ny4omtemfviat) 2rr(mpno1tlxomictat m ea(vo;t0 rxnmocto1fpteau s;t sexm(m oy4om   net s) Durxr ;t0tle  ociyd m elnms t4arenmf iytlmtraues;t0 2xoim nu1lpe lies s)a2ra( p;t1ope io3iytfm2rm(vp (4altoirctodopte uvi t  2tmimpnudlmtnmnct t)artmuront1opxo f3iyd mDeanvs t)trtnmo3oo1fmt anvolt)tetoxmpny4al elfet s aDrrur no1opxnio3ilsls2uan s t)tltrircto1la  lu i;t)sexrxopiodlm n netl( a2urxrpno1tex mfetytfs2rmn s (4trxnifctodomte i ols)t2to(m oodlptnmncta(faDuru o;o0tlx  ocildlaDuanmo;u4treriocoytfat au ilt  2umiopnu1ape  nesa()s2ra(mpnu0ope  f3iys mDrmnmo u4tltnio3oytomtelnes t tetoio iudoptnmiesas  2ur( o;t1tlx mietasfaDelump t0trtrxr io1opt lieo;(  rto(mpiy4al nlicsas)a2tmur nu0tpxniieiltfa2el(monu) lxomo totoat  uvs;(  2uoimpoo4lmt  feslt  Dtr( o;u4apxnmfciytfs rmnvs;t4alenxf totlptrli ol() rto(m3io4olt  ici (  rta( o;o4tpe mieiadfa uaumsn(0 lerif oy1laDeln ols0 2umxm nydlpenmies t  rtrurp;u1opeoio3iyt a eauvont0tlenir3todom rluvil()srxoir3nodlpe miet t aDtmumo;o4alx moctat m2uan pn(0trtrxfcoa1fptraneilt) rxm(o ou1am e ictat)sDua(mp;t1apeoifctad a ra(von(0 rxnmo3oytfa raueolt0sexr(opny1ope mfvi t)aDua(  oo1opeoii3iltls2elnms;u0artrio iotoa  anvi s trurim nu1ale  ici (  rur(rooo1olx mf3iatfaDelu o;t0 rtrmoctodfpDrauei;s0 exoimpoy1om emfei ( sDurx o;o4alto fcilsfs2el(msnt0 rtnmrcoy1laD li slt setrxm3io1lm emiet s)aDtmu poo4aetomo3tytfs el( o;(4 reoxr3iatoa  au sls)seumxm3iodope  iesa()artmxrooo0olxo i3tat aDemuvo;u)alenxrctatlmte i i;t0trxrxopiydomtnmici ( s2tmu  ;u1olen o3ilslaDrmnvs;()trxomf3iatlaDeli s t s2umxo iu1alenlfvilsfs2tmx pnu0alx ioetldlaDrmnmo;t)arxnmociatfmDrlueo t0t2xmir3oy4apenlict s) 2rr(mpoo0tlx if3iasfa ulnvp;(4 exoxr tydfaDraueo;t) ruo(mpoy4alenlfvil(fs2urur nt4opeomfeilslm umuvs;u)texrmoctytlmDrlnvo s0 rtmir io1lltnlfcsatf Duax  ;u0teenifctytfm ea(mpnt0 ltomr3todomte iei t  2tmxmpoy4op  lnetas) 2ur(rp;u4apenmoetadlsDeauvp (0arxomo3ty1fm   ues ()seto(m iodapenmnciat a2tmurpno0apxoifciatlm ua(vs t0 rermo oo1oateaivslt s2xrxm3iy4op elfeia() 2rax oot4tltn i3tydfmDrlnms t0tlenxo3ootlp rlies;() euoio oo1opt  iesa(faDum(  oo1teeo ociadfm2ranvsn()trxnif oadfp   nvils) eurir no1omtnlnvtlt aDrruront4aeto iciyslmDra(vs (0 rtomf3tydfa e n s;s) rtr(opiydome  ncs t aDta(r ;t4tpt  icildfs ea( p t4tlxrmo oodoa eln slt teuoimpnu1apte fetl(fsDra( ont4oex  f3tysla ul( ont)tetrmfctatoptr ues t)t2toio iudlptnmici (  Dtaxm nt0optnmfetldfa umnvsn()tetoir3iotfaD livils0 ruoio io4llee ieil(fs2tm(m no4opto ocilt m rmuvp u0 exoxr3ootfatean o () rum(m oo1open ics (f Dtr(mooo1opt ifciyt mDeanvp;(4trermf todfat  i s;()tetr(rpoo1alt mfeslt) 2rmu  ot1tlxomo3iasfs rm(mont0 rtrxrcto1omDe n ols)teur(r iudlp  mivsl()aDtrx oot1alx  fctltla umumo u) exnmfciytfpt  ies t)trtrxo3oy1lp  mfctlt)artm(rp;o1tlx if3iysfs2emuvp u0trtomr oa1laDrln ol( texriopoo1lmt lfctatfsDrr(rp;u4tetn f3iysfa rau onu)altrxfcoy1opD luesl(0teum(opoodlm   fct t  Drru ooo1aexn iciydfs2ulu p;(0trxomo3iadom   u s t0sexmxopiydamtn iet tfs2umu ont4alxoii3iatla2em(vont0trenxrcia1opteaueo ()t2ur(r3nydlm  lics s a2taur ;o1tet mictltla2um(mo u4 rerif3oo1fa eau ils0trxriopiodap  mfvtl()a2rrxmoou4oeto fctlt aDemums u4altoxf3iotfmD  nvs;s0 rxm(r3oudlpeemfcsl( aDtmu pnt0apxnioeiytfmDrau o;u)teenmr3ootopt ln s t0sruoio iudolt lnciasf 2taxrpot4tlxo ictydfa ul(vp;t)tlxrif oytla elneo;t s2uo(opnudopenlicilsfaDtmu pnt4tpto fciytfa2ul(mp u4treoir to1faDr nesl(0 2toxr oydlmen fci tfsruau  no1tlxn ieiat mDrlu o;t4aetoio oatlm  lu olt0texoxo3oy4ole  icsas srumxm ;t0oex  ieiltls rau o;u4aleoifciytlpteauei;s truoxr iydapenlnvsl()arrmx p;o4oetomf3iys m rm(vo;u0tlerxocoodomDrau s;s) 2uoirpou4ole livsa()aruauront0opx  i3tadfa2emnvsn(4altnxfcia1lmDean o;t)trxoxm3nodalt micsasf 2rau ont1tlt mietad aDra( on(4 eerircty1optran o s t2uo(mpiy1apenlfci (fsruru  ou1altoifciyt m uanmo () renmr iydoate uvs t seumim3oodapte ict s)a2taxmono0opxo icilsfa2eluvs;(0 renxo3oa1oat an o t0setr(mpnydap nlnctatf 2uauronu4teeo ieilt m2em(vsnu)arxrmo oytfaD anvil()trtmxo oydam emivsls)arrmu  ou4tpxnmfcilt a emnmsnu4arermfciy1fp rluvo;t0srurxopoudap  micsa(fsDrrurono1aeenmfetat s2em(vsnu4areoio iydop  anes;( t2umir iudolt mnciat)a2taumpoo1altnioeils a ea( sn(0 rtnio iydoaD  u sl( seum(m iy4al elfcsltfs2raurp;t4texomf3tatlsDul(mont4tltnifctadlmtr i o;s) 2xrirpoudol n iciltfarua(  nt4opx  f3iadfm uluvo u4aeerio3iydfp ean o;s0t2tmxo3iudolee fciltfsDurxm oo4optomieiadls2ran o t0 lermr iodfaDrluvi;s)srtm(r ny4op  mncias) 2ur(mpnu0opx ii3tldfm umumon() leoir3ty1laDeliei;s)seto(o3iydlmtemnvtas)s2raxmpoo0optniocilsfs uau o;u0texomr iadfmDe i slt  rurxr iu1lm  lieia(  2rrx  ;u1tex  feilsfaDum( onu)aexrxo3ty1oaD an o t)t2toim ou4amen fci tfarur(rp;o4aexnmo3iysfsDuan s;t4 lxrxf oo1lmt anvs t teuoiopoo1ll  lfvsl(fa2ta(ro;o1texniocildlm emnvonu0 rtrmfcoodopDeaiesl( trxmio ny1lpt lfeils sruaurono0aptomo3tyt m2uaumonu0alxnxociotlmt  u s ()srtmim3oy4ol nmfvsa(f 2urxronu1opt mi3iatlsDumump;(0aetrxf3oo1lm eaiei () rxmxo3nu4oltnlfvilt  Drr(  ;u0alto fetasfs el(mo;()arxnxrc
\ No newline at end of file
@@ -0,0 +1 @@
+ieil()t2urxr no4am nmfvsl( srrau p;o4ape mo3iatfaDuauvp u0aeeoxfctotlatelivi;t0 eumim oo4lle  fesat  Duau  no0aee io3tyd a2rmn o;()tetoxo ia1oa   nei ( seuoxr iu1amtemfvtlt s2rru  no1aeenmf3iysla2um( s t)tetnif3tytla eln il(0trxrxr3nu4lptnmnvs (fa2rmurpno4teeomf3iatlsDrmu snu4alxomf3oatoa   uei;t0 rxrim iu4lpe  fvs (f Drr(mpnt4aeenmiciltfa2umnvs;(0 lxomo iytla elivs (0t2urxopiydoptemivi sfsDtaurooo0ape mieiatls umuvpn(4aexomo io1oaDe i il( seum(o io1lpen nei s  2ua( o;o1oee  oetyd m2umums;(4trenxr3iatfaD lieils s2tr(r3oo1omen ivt tfa2ua( oou1apto feildfs2um(mp;t)aexnxr oadop  lnei s0 exoxm3nudlptnmncta()srrmum ;t0aee  fcildls uanmon() rtrmf tatfateluvo ()s2to(o3nu4opt licsasfartm(mpoo1olxoioeiydfsDrau snu0tltrifciydlmte u o (  rtm(rpiodal elict t  rtrx  oo4optnio3iytfmDumu snu)alerir3oatlm eli s;s0 ruoxr3oy4lpt  nciat)aDtr(r nu0ole  f3tldlmDrm(vo (4 eenif3ia1lm rlu ilt)s2trxo oo1omtn ics s a2uax oou1tpx iictld a uauvo;() leoifciodom  ln sls s2tr(rpnu1lleelivs sfarrmu  nu1opxnmieiys s rlu o;()tleoxr io1fmD lieo;t0 eurim no4ame  ivsasf 2tau  ou0tlxnmo3taslm rlu p ()aeeoiociotfp eaneo s)tetr(mpiu4lpe mivsa(fa2rrx  oo0aee iociadfsDelnms t4aetriocootlpD  i i;s0 eurirpoy1ol   fei (f 2taxr nt1optnmo3ildls el(mo u4trtrircoodfm rlivo;( texmxo no1al  lnci (  2tm(mp;o1olxn f3iytlaDranmpn(4tetoxfcoatlmDelneo s)seuoxr iydome lnct s) rrmxrpoo1tlto iciasla2ra( on(4 rtniocoo1om ranei s)seum(m3iy4lpenmietls aDua(root0opt ifeiyt m ranmonu0arxnif io1fpDelnvo t t2uoir3nu1aleelieia(  2um(mp;t4apenmoeiadfa2emuvp u)tltrxrciy1lm eauvi t0 rxoiopou4lpee fct s) rraumpou4aleomoeiadlmDuln pnt)aexrio3ty1lpDr ivo;t)teto(r iu4optnlivtasfsrur( p;o1tpen feilt m2elums (0 etrmfctodopteau s ( trxmimpiodllt mfcsas) 2rmurpnu1tee iociysfs umn o (4tlxrir iydfp  aueol( srxoxm io4al  lfeiat)sDua( o;u1tet mictlsfm2elumon(4aleoxf3to1late uesls0 exoxo3ny1alt lnei tfs2um(m nu0tpt mi3iadlm umnms t4trxnxo io1lat lu il(0 ruo(mpnydamtelfct sf Drmu p;u1texnmoeilsfs2uln p;(4 etrio3oatfmDeluvs s trxoxmpoy4am elieil() rrmu oot4tptomf3iydla2ra(mo;t4tetoxr3oy1lateauei () ruoio nudapeelnei ( aDtrxrpoo4tpx mf3iadfs eln o;u)aexrir oy1op eanvsl(0sexm(m3nu4lm nmicsatf rtax  ot0apeoioeiyt s rlnvont)tltomr oa1op rluvo t  2uo(r3io1ap   ivtls sDrmur ;o1opt iiciyd m2rmnms;t4tlerxrciatom ran o t t2tmir iodlpe mnvtas a2uau p;o0aptnmf3iad a ulnmsn()aexnifciotoa rluei;(0 rurxopoy4lp n fvtas sDra(r nu1olxnmfctysla2rmump t4aetrmfcia1opt  nvs s  rtm(mpnu4lltnmivi s)srtmuro;t0oltomfciad sDumuvp;t4tltnxf ty1oaDrlu s t0 etoxo3iy4ape lnei () Dum(mpnu1alx mietat m el( pnu0trxrir3iydlpDe ivs ()trtoxm nu4lm nlivsas)s2uru  ot0ale mo3ias m elnvp;u) eenmrcoatopt  nvo s t2uoxo3iudaptemncsas sruauroot0apxnmoeiltfmDemn sn()teermocoo1la   uvilt srurxopiy1lmtnlfcs s) rumxr ;o0tleo ieilslsDra(mo;(0 lenif todopDeauvo;(0trxoxopnu4oleemict s srtrurpno4apeomf3tyd a ua( pn(4 rxrmr3iatlmDrlu s;s  exrxmpiudlpenmivtlsfarrr(rpou4opeo fctadlm el( pnu0tetnmrcia1fpD livs;t trxoxmpoydll  lnvtlt s2trxrpno4apx ifciltlaDelu on(4tetrxr ty1oat aivs s s2um(o oy4lp  lictls s2rm(rpnu4apt ioeilt a2rmnms (0tltoircoodfmt au ils0setmxrpou1ll n nes ()s2umxrpoo0texoifciatla rmumo t0tlenif3ty1latrauvs;( t2tm(r nodame mfvtasfa2tm(rpou4opto oeils s2elu s;u) lxoio3iy1fmtr ieo;()s2tr(rpio1opeemfctat sDraumpnu1oee  i3tat a2umuvpnt4teeoxocty1om eauei;( t2xr(o iodoptemnctls)arrr(mpoo1apxn f3tydla um( onu)aetrir3iy1oa   ues s seum(opoy1omtn nvi t sDrm( ono0alen ieiytfaDuln s ()trtoif oytfmDrau ils)s2xoxr3no4lm  licilt) Dra(moou1tet mf3tysla rmumpnt0teerir3ta1fpteai ols0t2uoxopoodlltn ictl(fartrum nu0oexnii3iatfa umnmonu) exrmr iodfat anesl(0 etrxm3iydlm nmiei tfsrua(rpnt1optoio3iltfs2emnvp;t) etnifcootoaDeln s;( teurio iu4ome mivt ( srtrur ;u1aptomoeias m2raums;u0aexrxf ia1fp  luvi s tetrxm iudop  lfci ( sDumx oou0opx mi3ilslmDrmnmo t)arerxf3tatlp  ai ils)srxrxr3nu1aleelfesas  Duaxmo;o4aeenio3tls s rl(vo;(0tlxomo iadfpD li il( setoio iy4lmtnmieilsfaDururp;o1alxomo3tadfs ulumsnt4 lxnmfctadoptrlnvo;(  2trxopoy4alen fetlt)sDtruroou4alto f3iyt aDra( s u4 lxrmfcia1fm e ieols0 2to(o3nodlm emnvsltf ruaurooo0tex  i3tys s2eanvp;t4alxnif3iydoa  li sl(  2ur(opio1altn ivta( a2rm(mpot0olt  oetasfs2eaump;u4 exoxf ootoatr n ilt  eumim3oudam emics (fa2trxm ot4oltomoeias aDum(vont0tlenir oytfpt ln i;s srxmim3iydopt lfcias) Drr(mpoo0aee ii3tldls2umn o;u4 etnxr iy1op  an s t tetmxo3iy4ol nmfci s srtmu  ;t4oeeo i3tlsfm2eaums (4aeeoxo tadfp elnvs ()srtoxm iu1lpenlnvils) Drr(mo;o1altomo3ildla2em( ont)texnxr oodfm   i i t0 rxmxmpiu1al elfet (f ruaxr ot4alx mieiytfs emn o (0aeerir3iadfa   nei;t  etrxr3nudlmtelnvsl()sDuax  no1tptnioeildfsDua(mo;(0 lenircootlptranvo (0 rto(r iy4om elfvsltfa2tr(rpou0ole mi3iad aDrln o t0alxrxo todopD ln s;s)srumirpiudopeemieiltfa2umxmp;o4apxoio3tlsla elu snt0 lxrmocia1lmt aneols0texr(opnu1optn iviat  Dur( pou1oee  fetydfs2raumonu0 eeoircio1omt auvolt srtmxo iy4optelnvt (fsrrmu p;o0aetomicias a emnvo t4 ltrxfcty1omD  iesl(  eto(rpoy1ap   netlt) rtrx o;t1oexomfciad sDelumo u0tlxoiociatfat ln s;s)setrirpny4amt lfviatf 2rmuro;u4ole mf3iyt sDumn p u4trtoir3oatfptrlnesl( srum(mpou1altemncil( sDrmxrp;t0oexo ictaslm2eanvpnt4artrmfciy1optraneols  2toxopnu1op emiesa(f rumurpot0tetoii3iltla rm(mo () lerifciydlm eaueo s)t2xoxr iy1lm   icsl( sDurx o;u0aexo i3iasfm2uln pnt0tlxrir oo1omtr n sl(0tetmxo3iydlmenliet sfaDurxront1tet mociltls uan s t)arermf3todfpDrauei;(  rurimpou1oltelfvtatfartmu oot1tlxomo3iytls rm(vs u0tlxrxo3totlmDe n o;(  rtrxopnudape  fvilsfsDuauro;o0tetniiciysfm rm( pnt0trxnifctodfmDe ivi s setoir3no4ll nmfcsatfsrrau  nt0optomieild mDrau o u4aeermr3ta1omD livo;(0 rxo(rpnu1ale mnciatfsDtrxrpnt4apeoio3tad m uan snu0arxrxo3iydom   u ilt)sexrxopiydapte ieils) 2rmu poo0opxn fcild mDrmuvo (0tlxrmociotomt ai o s)sexo(mpou4llee nei ()sDtm(  ;u1aexoii3iaslsDua(vs;t0 ltrioctydfa ean o;s)sexmir3iy4lme  fci tfs2rrurpot4oeeomociyd m eau snu0trxnxrcoytopDraies;s) 2uoxo oodll emnvtls s2rru p;o4olxn iciyt a2rm( o;u0trerirciytlpD  ivil()trtmxmpoy4optn nvtat s2tmx poo4tltnioetltfa eau o u0 exomo3todlm elivols0tetm(m3io4om elnvils)sDumx  ot1alxoiiciytlaDuan onu0arerxrcoatlm  aneslt sexr(rpio4apt mfes t srtm( o;o4tee ifciatfs2rlu p (4 exnmrcoadlat anes ()t2tm(opny1lmtnmivs tf ruaxm ou1opxn fciytfs emnmont) rtrxo iatopDeln ols) rxm(o3iu4alee fvias)a2rr(m no4apto o3iaslm2uauvs;t) ltrxfciodlm  lieo t s2uo(o3oodol e ietls  ruaxro;t1oleoif3iadls el(monu0 lxomo3iydoat anvo;(0 etoxm oo4lm elnctas aDrmxmpou1oltoifeiad aDeluvs;u0tlxnmocoo1lp  lnes;s t2urxrpoydlpenlicsat) 2um(  nu4openif3iatla ra(mp;u0alxnmrcoo1laDeau i;s)texoirpoudole mfet s s2rau onu1ale mieiaslsDumn p (4trtrmrcoadoaDraivo s srtm(o oo4lp e nvs t)s2uaurp;o0aptn fcilsfm2umu p;(0alxrircoytoateaneolt)setoiopoy1alenlfcs tf ruaxrooo0alto i3tydls2ra(mp;() renmo oodfaDr i o;(  eumxr nudomee nesltfa2trum nt1ape mieiys a elu o (0arxrmo io1lmD li ils  etoxm3iydale livi (  Drm( pnu4tpenio3tlslm2el(vp;() lerxrciytopt ai s ()srxr(opny4ll  mfvils)arumxm oo1aexomfeiasfsDuau pnu0 lxrio oodla  luvslt)trxoim oodaptelfcta( aDrr( pot4oeeomociadfsDua(mo;u4 eermocty1laDrlnes;(  2xmxm3iu4lleemnvs sfarumx  ou1altn o3ilsfsDrau o (0arxrmr iadfaDr nvs s  rtmxo nu1altnlfvilsfa2trxr nt4apto oeilsla2eau pnu0 ltrxrcoodfm e ivo ()srxrxm3nydlm nmicslt  Drau pot0apxoio3iysls umnmsn(4 rxrmr3iodopte nvs s sexoimpoo4ome  nvs t)srur(  ;u1alx mfciasfaDum(ms;()tlxrmfcoadlm  livilt)t2urxr oo4op n ici s)aDrmu p;o0apxomoctld a umuvonu0tetoir3ia1lmte nes (  rur(o no1ape lfesa(f 2tmx  nu4alx  ociat a em(mon(0 exoiocoatomD ai slt  eur(rpoo1ome mneiat aDtrx p;t0aet  oetys m2uanmpnt)texriociadlatrli s;s srurxm iudlpt  fcils aDumump;u1tltomoeiyt s ea( on()aeerxociotomt lies;t) rtrxo oydlleelnci sfs2um(  ou4aeeoioeiydla ulnvs u0arerxr to1lp eaues;t0trxm(r3iydamenmnesat aDum(m nt0ole mf3iytfa2ua( s;(4 rtnmo oatom raneo;( s2xoim iodlleemfesatfarurx oot0tlxn o3tyd aDumu s u0tleoxf oydlp e ues (0 2xm(m3oo1lm   fvtlt srraur no0aetnmietlsls rlnmp;t0 rtrxr oodfa  an slt t2xmxr oodoltn fvtl( srrm(  ;t1texnifciatlm el(mp;u0altnir3iy1op rlivo;s) 2xo(r3iydolt mfciatfa2ra(mpnt1altoiieildlm ean ont)arxrxf3io1opDrliei;s) rtm(rpnodop n fviat arum(  nu4aetnmiciadfs2eluvs;()aetnifcoo1laDrlu sls s2xrim nodlm emnvi ()aruru  ;o0tleomo3iatlm emn o u4 lenxr oodom raieols0 2toir oudlpee nei (  2rmu p;t0tlx mfeiydlaDrl(ms;t4alxrio iotlpDranvs s0 eto(o ou4lm  lnesatfartru  ;o0tlx ii3iat s eanvs;t)alxrifciy1omt anes;(0texm(m iu1op e fvil(faDrmx p;t1optnmi3iytlm umuvo;u4 etomoctatomtraivs ( t2xrirpiu4lmtelfci s)arumxrooo4tpenifeiydfm2emnmo;u0trxnifcoydfmDrlivi s sexmxo nu1amenlnciasf 2um( pnt0aeenioeiytfs rmnmo (4 rerxrcoo1fmtraivo;s s2xoim3nu4ape  ictat a2urx  ;o4olenioeild m ua(vsn(0 etoif iadoat  neo;s trtrim3oy4amtnmies ()srrmurp;o0alxomo3ilsfs emumont4tleomf ia1opt  i i;t) etoxo3nu1op  lfetls  2rmu ont0tptoioctad a2ul(mp;()texomo3ia1op rai o;(0 2tr(m3nu1llt mfvil()a2rrur ;o4tlt if3iad aDemnvp;t0aeerxo3ta1opD luei t0trur(m nu1aptemneslsf rra(m oo4tltn fciytlmDua(mo u4 rtrmrciadlmD li i (  2urio3ou1ap nlnvtlsfa2rmxro;o1oleomoeiysla2em(ms;(4aexoir3tydoaDeli il(0 euoimpio4amtemicil( aDtmxrpot1tee ii3iytls ua(vs;t0tetnifcty1fmte ueo;s0t2xrxo iy4lpen fciat  rtaumpno1oet  iciad aDemnvp t0arerxr3oa1fp eaneils  rxrimpou4ap elfcia()aDrm(mpno4tpt if3tldfm uan ont)teerxf3oodom rlivo;t0 rtmir oydome lnetltfarrmxr nu4tpxo feiytfm2rl( s;u0 leoxocoydomtelu s s truriopiy1ol n fvs t  Drrur ot0opxoifeiasfm2elu snu4trxoir3iodfaDr neo s trurxrpnudole mfeil() 2trxm ot1aleo i3iyt s uanvp;() lxnio iytlaD auvo;s0trumio ou4apee nes (f rrm(ront4tpenmieiat m el( o;t)tetomo iadlat au sl(0texrio3oy1al  mfvtatf 2tr(rpot1apxnmocilsfm rlump t) lxnio3oytfm ran sl( trxrxo3oudamen ieiltfa2ua(mo;u0tleoif3iyt m2um( o t0 eeomo3ootfpteauvsls0tetoxm oy4omeelnctasfa2taur nu0aet mieiltlmDrauvo (4altnxfctodfmDeluvil()teto(o3io4amenmnct s) rtrx o;u0oleniictldlsDrau p t)trxnmrctotoaD  ivi ( teumirpnu4lp e ieiltfs2tr(moou0opx ifctat s ran sn(0aeenxr ta1lpDrli s t trtrimpno4olee ictl()sDuru  nu1alxniiciysls2uauvp;u)alenir3iy1lmt aues;s) rxmxo3oo1op elnetat) 2rr(m ;t4aptoioeiyt m umuvp t0artnmf3tadfmteau slt0setmirpno1lm  lneia(fs2rrum ;t0ale  fciad sDranvont)trtnxfcoytlm  lu s s0srtrxo3oo1om   nvs t)arurxmpnu0teeo fcils aDul( p (0 exoir ta1lat luvo;(0srxm(m3no1alen nesl()aDrmx o;u4opx iociasfa2uln ont)aexrmf ta1laD  neo s)t2umxo oy4oltemfviasfsrrr(ro;u4oetomfciyslsDemu pnu0 ltrxocoadfa r u s;( srxoxo3no1om  lnvsltfaDrruro;u4oexo octysls2umu onu0 rtnxf3tydlatrlu o (0trxrir3io4olte icils)srrmxronu1alxomi3ilsfs uanmo;t0 lxoio3iytop eluvo (0srxmiopnudomtelfeiasfaDurx o;o1tetoif3tytla2ea(ms;u0trxnxr3iatlmt ln o s) rxoimpiu1lpt mfetas  Drr(  ot0opxomietadlsDeauvont)aetoio3oodfmDe nes s) exoir3oo4lp e nciatf rtm(  oo1aleoii3tasls elnvs t4arenir3todlmt  nvi;( t2xm(r ny1llenmfvsls)s2raxmono1teeo f3iyd m elnvs u4 exomrcoytfa  lnvols)seto(rpoy4amtnmictl( s2rm(r ;o0aetoiociltla rauvs;t0teenmo oytfptrlnvsls  2um(rpou4am nmivi (f 2ur(mpou1apx mieiltla2eanvs;t)teenxo3totom  an sls) 2tmio io4ome  ivtlt) rtr(m ou1oee  feiasfmDean s u4alxomr oadlmD luvils t2xmio ny4opt  ieil()aDtax onu1tpeo iciatla2raumo;(4trtnmo ty1fm  lu i;s  rtrirpou1oltnlnvta() 2rm(mpot4alxnii3ils aDra(ms t0aleomrctadomD aies;s)texo(mpny4lmenlicia() rrrumooo1tlxomieias s2uanmsnu)tlermrciotfmD  u i;t0srtoim3oo1lmtnmivsl() 2tmxroou4tlxn o3iysfsDranms u0teeoif ootfa   nes;s) rtm(r oydam nmnvsa()s2trurpnu1tex mi3iytfm2uaums;() lxomo tytlmtrlnei;t s2toir oy4ome lfesl(  rumur ;o4tle  i3ildfmDelnvo;u4 lxnmr3tatoatrlueo t0srxm(o3oo4altnlnvtas aDua( pnt4texomociytfaDra( sn(4 lxnmfcta1fmteli sl(  2tr(opio4al n fetl(fa2tm(  no4oet iieiatfs rau o u4texnxrciodoa e u i s)t2xmiopnydoltnmivt t) 2rmx onu0texnioeiys a ua(monu4 lermfcoy1faD  uvo ()setoio3iodomee ivsat) 2uax  no1aexn f3iltlm2umu p;u4treomocoodomDrlu o () eto(o iu1aleemict s) rua(m ;o4oleomoetlsls2el(msnt4 rtnmociy1lmDrauvi (  rtrxm3ny4ope mivsa(faDtmumo;o4olxnif3tytfm eanmsn()areomo iydoatean s s0srumir3iodlleemnci s)srtm(  nt0tlxnmo3iydfa ranvont)altrxf to1faD aivs;t) 2tr(rpoudoptemfci () rrmxm ;o1teeo ociadlmDuln p;(4alxrmr iytla eln s () rumxo iu4opee nvtltfaDtrxmp;t0tet mf3iadlaDrm( p t)areoxo3ia1op   neols0setoio iudoltn ictl(farrrxronu4aee  iciad s ul( p t4 leriocoytfa eaies;t) eur(r3iy4op nlfvsls)aDururp;t1teto oeils sDea(vo;u0 lerxocio1fpD lies t0s2triopou4lptnlivt t)srurx ont0opxnifcias a2rm( s t)texnmr tydomtrli o;t) 2uo(o3nu4lmte fcs t srrrumooo0aeenmfeiyt m2rmnmont) etoio3iydlaDrau s t)t2tmio3ny1lmt mfesat srraumpnt4texomf3ild s2ea( o u0 rtrxrciatla raivs;t)trumxm ou1al   nvsas  Drr(r ;u4tltomociltfa umnmo t4 rtnxo3oatlmD li il( srxrirpiu4al  mnvsl()arrr( o;o4tltnmf3iytlaDeln o t4arxoirciadfpD lueo (0 2xo(o nu4optelnvtltf 2ur(ro;u4oleomf3tlt mDrl(mp (0aetrxo3oy1opD au s ()srxr(r3io1olt  nciatfsDtr(  nu0ope  icild s emn p u4artrmfctatom  li s;() rumir3oudopeelfesls  rtr(rp;u1aeenmieiydfm ea(mo;u)tlxnir oadomDelnvi;s)t2xo(r iy1lmenmivt tf 2tax o;o1oee  f3tld s ranmo t4 lerif3to1lm  aivs;s srxr(rpnu4lp  mnvt (  2ur( oot0ope ifciyd aDrlnmp ()aetnxfciy1lp  lueo t s2xoxm oo1opt  fvi (  2raur no1tpenif3tydfs rlu s;t) eenxf totlpDrlueol(0 2to(o3no4ole lfeta()sruax  ot1apt mociyslm ean p;(0tltnifcto1omt aneo;( t2toxrpiy1ol  mfcta()arrm( pot1tpx ioctltfmDuauvp ()teeomr3oy1fpDrau i (  2uoio iodape  netasf 2ua(  ou1olxomi3tlslaDeauvpn(4 rtrif3iatomt ln i (0teur(rpnu1optelnvsas) 2rm(m ;u0teeniociyslm2ua(ms u4artnmrctotfmDrlieolt0trumio iy1am e fct ()s2urur nu1apt mfctyd aDrmnvon(4alxomf3iotfa raivo t0srtoxo3oy4lpeemfvils aDtaxrp;u0tpxnif3tas a raumon()areomr3io1opteaivi s)srtmiopnudoltn net (fa2tax  oo4apenif3tytlsDua(vpn(4 ltrmfciadfa eaneo;t)srxrxm nydome  fvtat) Durxm ;u1altoio3ias m2eluvp;u0trxnxocoa1fmtrau sls trtoxm3no1ame  nesltfs2tmump;o0texnmfctydfaDraumont)alxriocoadfpDr uei t0t2umxr3no1lme mfct t)srta(m oo0apen feias a2rl( pnt4 lxnio iotfpD  uvilt0srtoxrpoodal n fctlsfarrrumo;t1opx moeildls2raumo;t4 lxoiocio1omDe i i t)s2trim3iydll emfetls)aDurur no0altomfcils aDem(vs (4 etnircta1lmt  uei s) 2tmirpiudal  mivtasf 2ur(m oo1opt iicias mDuaumon(4alerxocoadlmDeaivols  2tmir oo1lltnlnciasf Dumxronu1tpxomoeiys mDel( s t) exomo3oodfp rln o;s0 eum(opiudomt  ivilt)artmu  oo0tltomf3ild m ul(vo;u) rtoif iy1optelnesl() 2urxopiodam elneta(fa2tmumpoo0tee  o3tyslsDumn o;u4 lxrxo3tadfptr n o (  2xoxr nodom e neslt) rrau ono1oee mo3iydfmDumn o;(4arenxo oodfatrli s t0 exoir ou4al   ncslt  rtm(mont0olxn o3tyt mDumumsnt0trxrmf totfpDeaiei (0srtrim3oo4aptn feslt  2ur(rpnt1aet ioeiltfaDraumo;(0aleomf io1lm elu i s)t2xr(opnu1lmt licsatf Drm(r oo0tlto fciyd m emn o;t)alxnmrcootfp e ies;(0s2trir nodll  lietas s2rrur nt4aptniocilt s2elump;u4aexrif3oytlmt auei;s) eumxrpoudlpenmfvsatfarraxm ;u1opt  feiys m2emn p u0trtoiocty1oa elivo s0 2xrxr3oy4optnmictatf 2trxmont4alxnio3tldls2ea( s u)altoircto1lp rli ils) rxoxo3nydale  fct (  rur( onu1tpxnmieiys m2emu p;t) eenif3tatoat anvo t trurim3ny1apt mnetl()aDum(rpnu1apeniietyslaDemumont)artomrctatlmDe nei t)t2xr(rpoo4lp nmnctasf Drrx  ;u0olen o3tld m2eaumpn()tlerif3iatfpDeanvo;(  2xrio3iudlptnmfct sf 2uru ono0ape iiciydla eln s;()altrir oa1omDr uvs;(0truoxrpno1lp nmfcsa()arum(moot4aex  oeiysfm2ulu snt0trxoifcoodlm  lueols0srtm(m nudoptelfvi sfsruaumo;o1oee mocilsfaDrauvp;u0texnxrcta1lp eln s s srtrir3no1omt lieias) 2raum ot1tpe micilsla ean s;(4tltoxf3iytfa   u i (  etoxr iudll nmncs sf 2rrur ou0tleo ociytls em(vpnt0trtrxf iadomDr u i ()seumxr3oy4optnmivta()artau ont4oeeomi3iydfs ua(ms t0 reoxocty1fpD anvo;s0teuo(rpoy1lptemfetasf Dtauro;u1aetomociadfs uaumpnt0artoxf3oodomDr ueo;s0seurio3iu1olee iciatfa2taxrpot4ale iietatla2umnms;(0aeenio3oadfaDrlnvol(0 exrxm3oo4lltemnvil()aDtrxmpnt4alxnio3iltls rl( s () exnmr iy1om  lu s;s0trtmxopno1lp e ivs s) Drm(mpnu0tex mf3iltls elnvp;t) rxrxo tydlp   uvils s2xmio ou1lmenlivil(fsrtr(rp;o0oet iictaslsDulnmp u)aleomocoadlptr ieo;s  2xrir3iodlme mnetas)s2rmu  nt1tex moctytfmDran s (4 etnxfcia1oateluvsl(0teuo(o iy4al emfesatf 2raumpou4apt if3tld a2rmuvpnu0trxoxo todoptr uvi t texoiopnu1lp  lnei (fs2um(mo;u4olxnmo3ias sDra(vsnu4tlxnxrcoy1la  au o s)t2xoxmpnodop nlfvsa( srtrxm no1tpx iictydfmDrauvp t) exrxr3tatlptrln olt)tetmxrpnudlptemnct s s2trurpno1ole ioctltlaDra( pnt) lxoir to1lptrln slt) rur(opoudopeelies s)aDtr(monu1altoiocilsfs2rm(mp;u)aleoxfcoo1la raivs t setmxr nydomtemncias)arrmxm nu4ale ioeils s2um(vo (4arxoxf3iodlptrluvolt) 2tmxrpoudlp emfvs (farrm(monu0oeeniociadls rau s () rxoxrcio1faD an olt)texmxo3oodal   ivtl(f rrru o;t4altnioctldla2emnms;u)aleoif tatfmt lnvol(0srtm(o3oy1om elnesas  ruauroot4oeeomoctydlsDrlu p;t4tetoio3oatomDrau il( t2umxo iy4ame  nviatfaDrru  ou1aexoio3ildfm ea(vs (4artoir ta1lptraiei s) rxmxopnodlptemnetl( srrm(r ot0tex ifctatfmDel( p t0 lenxr ty1om  aueols)tetoio iy1ope mfesasfaDtr(  oo0apt if3iadlaDeln p t4tltrxo oadomDelueol( teuoxrpoudlptnlfcia()s2rm(rp;o0opeomoeild a2emumo;u4tlxrir iytop ranvols0s2xrir iu1ol  lnvia(faDtmu ono0olxoii3ils s2rmuvp;() eeomo3oy1lp ranesl()srtoxr3iy4oltemncsa(  2ta(m ;o1tleo ocils s2ulu s;(0trerir3tadlaDrln s t  eumxmpny1oltnmivi (f 2rm(m ou0tee mi3tyt mDrlnvsnu4 rtnio3oytfmtr nvo;s  exmxr iydomenlnes s aruaur oo4open f3tldlmDel(mp;t0teerxf3iydfaDrln il()seur(rpoodoltn ict t a2tmumpoo0alxnmfetlsfs2umnmpn()artnir3iadfmt  i i;t tetm(o3iy4lpt lici s)srtrum no1tpt  f3ild a2um( s;t)trxoxo oa1la ranvi;s  rxoxo ny4lptn fesl( sDur(r no4tpx mo3iad m2rmuvs;() ltnmr3io1oaD  ueo (0 rur(mpno1am emict (f rrrx ooo1ale ii3tas m2eaumo t0tlenxf3iytlm  an ols t2tmim3oo4olt  netas  2tm(r ;u0tlt iieiydfs2em(vs (0texoxf3iotomteaueils0t2uriopou1al emictat s2tmuront0opeo ociasfsDem(vo (4 ltomf oatlm r nvs s)s2xmxr3iydomtnmivias)sDumumonu0apenmi3tys a2ua(vo u4 lxoio3oa1fm ran i;( t2xm(o3oudomeemncsa(fs2raumpou4tee  ieiysfa2uln o u)aexoxf3oodomDeliesl(  rtmiopiy1omeemnciatfa2ur(mo;t0ale ifeias s2em( p t4tetrmo iydoatrln slt)t2tmxmpio1oltemfctat srrm(rpnu0tpt  feiytfa2ul(mo (4texrmo3oadfptelies s0setr(mpnydllen neia( aDta(mp;t0tpxoifeiadfs2rl(mp;t)teeoxf3to1fptrlueo ( teurirpno4lm nmfcslt arua(  ;u0optomfctysfm2rmnmp;u4 exrxr3oadoaD lu o;t)s2trxo3oy4olte fcsltf ruau pno4openmiciytla2rlums;(0trenirciodfateln ol()t2tmxo oy1omenlnetls sDua(  oo4aptomi3ilt s eau pn() lxomo3oodlp  aieolt)srxo(m3oydlmeeliciat)a2ur(  ;o1apxoif3ildfm uaumo;u) rxrirctadoatelies;s tetoxo3oudll e icsa(fs2trxr ot1olxnmiciyt mDumnmp;(0tetomociydoa elieil()setm(rpnydom nmnvi ()aDra(mpno4tpt ii3iatls ea(vs (0 exoxo3io1oa rlnei ()srto(r3oo4ll nliesl( srurxr ;t4olxomietldlm2rlnvsnu0trtnmr io1laDrli i;t)s2tm(r3nydlp nmict s  rtmumoot4tetomoctasla ranvo t)alenxf3ty1fpDr ivilt  2xrio iu4llte ivt s) Durur ;o0tetoii3tltfs rauvpn() etnmo3tytfmDeluvi t)srxm(opnodal e nci t aDtrur ;u0tetoif3iyt aDum(ms;u0trenifcty1fa rauvo t)sruoxr oodapt lncias)sDrax pnt4alenio3tad m rmnvp t4aetnmo3ootop   neolt0 ruo(opiudop  lncslt aDra( o;t0apxnifcias mDemn sn()aetomf oydla r neil()teto(o iodlltnmivslsf Drm(ront1texo oetyd aDemnvsn(4arxnmf oytopt auvo s trxm(r3no4ale  fcil(f Drm( o;o4tptoifetasls2ulums;(4 rxrir iodla elnvils0 2uo(m oo1lm emfvslt sDrrxr ot0olt  ieiytfaDeaums;(4tltoxr3oatfmDr nvi;s)trxmir3oo4opt mnvtat  Drmxmoou0tptnii3iadlmDemnmp;u4 etomo3oodop rlnvslt srxrim3ou1al  micsasfsrtru  ;u0oex  i3ildfsDel( o ()tltnxr tadfptran sls0texoxm3ny4ol e ivsl( aDum(ro;u0tex  iciys aDrlu p;u4 etnir oodfmDrlueo;(0s2uo(o3nydomenlnesa(fa2rr(mp;o1alt iictaslm2uluvo;(4trxrmr3iodfpDe nvo;(0 rtm(m3nu4ol nlfvslsfsDtau p;u4tpeoifciatla rmnmpn(4 lxnmocio1fa rli o ()texr(o3no1apte nesl() 2rmu onu4opxo oeiadfmDrau o ()altnxf3oodlateai s;()sexo(mpno4aleemnctat a2rax ono1altnmietyd m2ran snu)aeeoxo tatoaDraueo (0seto(o oydlmtemicia() ruaur ot1tlt  ieiyt sDemnvp u0aetrmrcoatop ean s s)t2to(r3iodolenlfetl()s2umxmpnt0opxoiieiydlsDuauvp (4 rxnio iytfatrlu il(0s2urim3oydomtnmivt () 2umumo;o4aexomocils aDrl(vp;u4aetoio ootom  lneols seumxmpiydolt  fvtat) Dum(r ;u1opt ifcild s2um(vs (0tltrir tydlatrlieols)teurirpiodlme mnvils) rtrxmoou0tptn f3ild a eanvonu0 reoir3ootlptr u sls0sruoxopnodlmt lietas)aDtmum ;t4aeeo o3tydla2umuvp;u)aetoxf3iytfptrlieslt0s2trim3ny4alenlfesa(  Dumx o;o0altniiciyd a2elump t4 renxr iotoaDr n s;(0trum(rpnydale lictltfs2rr( o;u4opxn i3iyd mDemumonu0aeeoir iatfate ivo s0 exm(o ny4optemfvslt sDraxmp;t4openiiciyt a2ul(mp u0tetnmfciy1fm  anvsl(0srxm(o ou4omtnlfcsa()sDtau  ou1tpxnmf3ild aDuaums;u0 exomocootfptr nvi ( t2xoirpny1lptnlfvt s)a2raxmpoo1alx  o3iys a ul(mo (4 rxrmr oatlaDe neo ( sexoimpny4am e fesatfs2ra(  ou1tpenifctaslm2rm( s;u0 exrifcootlpt an o;s)srxrxm3oudap elfet ( arta(rpot0apxn ietas s2ra(monu)tlenmf3oa1fpD auvol(0 2toim oydlpe mnvsls)a2um( ono0apxoifeilsla2um(mpn(0tetnxf3ta1oaD auesls0seurxmpoodaltelfvils)srum(roou1aet  ieiadlm rlnvsnt4 exomo iatomteluvil( sruo(m3io1om elfetas artmurpnu1ale ii3tlsfa2rlu p (4aeenxo3oy1faD lieo;s  exrxo ou1om nlictls  Dum(  nu4teen f3iyd s2em(mp;(0teenio3oodoa eanei;()t2xmxm3ou1olt mfetltf rurxr ot1tpt io3iytlaDeanvsn(0 reomoctotlp   uvi;t)srxm(r no1optemncs s)s2ua(r ;t1oet moeiyslm2uln pnt4trtoxo3totoptranvo ()texrir ny4oleelneils)srumur ;t0oet  f3iydfs2uaums u4arxnmr3ia1lmDeaueolt) rumir3nu4lp elfes ( arta(monu4texn ictydla rmumsn(4trtrxf iotop rau ils t2xoirpou4ll  mnvtlsfaDtmxrpoo4tlxniieiysfs ul(mo u)aexomf3iatomte uvo;s s2urimpoodaleemietas)a2raur nt4opxo i3ild s2rmuvo (0tltomo iytlmt li o;t trto(o ny1lpe mivilt) 2rm(mp;u0aex mieildlsDem(ms u0aexrmf oodfp e ies s  rxoxm3iy1ole  iet t)s2rr(moot1opeo i3iltfm2umnmp (4arxnxf3iodlpDr u s;t0 rxmir iodaptnmfcil(  ruaumo;u0tee mieilt s um(vpnu0 lermocoo1fpt livs (0seuo(o3nu1llte fcsls)s2tau  ou4tpxn feiadla elu s;u4alxomf3todlmteli o ( srtoxo ou1am nmivia( arua( p;t0ape  oetltfa2emnms;t)arerio3tatomDr neil() eum(r oy4lpee ieta(fs2tmu  nu0alxomiciasfa2ran o ()aleomo3oadfp  aueslt) eum(r3io4ap e feta( sDrru pnu1apxomoeiysla em(ms (0trerir3to1latr ivil(  rtrio3nodamtnmnet () Drmu  no4tlxoio3iadfm uau snt4altomfctydlptr uvilt0t2trio oo4om n net t) Dumuronu0apt moeiatla2ran sn(4 exnmocio1om r ieol() exoxopiy4lpee ict ()sDur(m ;o0oet ii3tad mDum(mpnt0 lxrif tydfpteaivo;t seuoir3ny1ape liesltfs2uau pou1tetomfciydls rlnvsnu0 rtrmrctydlpD aivol(0t2toxo3iudlm nmncs () 2umumpou0ape  fetydfaDrlnmo u) etnifcoodoa  livi (0s2xr(m iu1lm nliesa(fsDtmur nt1aetniietytfmDelnms;t)artrif oa1fmtr neo t)s2tm(m oodlm  mfvs t  Drrxm ;t0tlxnmo3ilt a2rau snt4tetoif3oa1lm rli ol(  etoxr3iodopenmfeta( sDtmum ;o1oex iictldfmDrauvp;(4texnif io1lm eaneol(0sruo(rpnydale liviasfsruaxm ot0tetnmo3iytfaDrmn p (0 etnif3oytoa eauvo;s)t2trim3oy1lmen nesasfa2trurp;t0tlxnio3ildlaDrauvp u)tlxoifcto1om eauvils0sruoxmpnudomt lfci ()arraxr ou4tlxomo3tatfm rln p;u0alerifctatfmDeau i s0 rxr(r oy4lptnliesls sDrmxm nu1optomfeils aDrauvon()aleoio tytlpDr ies;t setmirpiydlpe mivt tf Drrurpno4apeoiieildfmDumu pnu4 renio3iotfm e nvi (0srum(r3ou1ll eliei s  Draxmoot0aetnmfeils aDrluvp t0tlxnxf iadfptraieol(0s2xmir3nu1optemnctl(farumur nt0tpt mo3ild s rluvon(4aeenifcoadomDrln ol(0t2tmxo3ny4opt lncsas)sDraxrpno1oee micildls2uau p;u4alxrmr oadoat  nes t0trtmxm3iudam e fvi t) rua(  ou0aetn fciatlsDelnms;(4trxnxociatomDr u o s0tetmimpoy1omenlfei tfaDtmx ono4opeo fciyd sDra(msn(0arenir tadopD  nvsl()s2toxo3oo1lp e fci t)sDtrum ;o0apt mociltlm um( s;t)aleomr oadop ranvi t0 2xoim3iu1ap nmnesltf 2trumpot4altomiciydfs2eau o ()tlenmrcoy1lpteauvol(0t2xrxo3no1omtn iei tfarraurp;o4apt ioeiadfsDumuvpn()aeerxfctatlaDe neol(0trtrxr ou1al emivtasf Dtr(mpnt1oltnmf3ildfsDem(vpnu)areomrctydfaDeanei s0 rxrir3no4am  mietl( a2rm(rp;o0ale  o3iyslmDrm(mp;t) rtomr3oadomtr neslt0trxoxr3no1olt  fvilt)s2rm( p;u4aetoiiciad m2em( p;t4tetrir3io1lp r i i;s0s2tr(o io1omte icsat  2uau pno0optn oetasfa ua(vo u0texrxfcootfaD lneo;s  rtrxrpoudllt lfet () Dtmxrp;o0oltomfetat a2rmnmo u)tltrmrcoy1laDe nvi;t0 eum(m3ou4omee ivi t sDumur nu1tlxoiietlt mDrm(vs t) lxoxo3oodlm   ivs s0s2umxopiy4ol elfes t)aruax o;o0aexo oetltfm2rmn o u)teenmr3to1fp eaivsl(  2toxr3nu4lp  mncta()srra(  ou0olen fcils a2emumont0aeenxrctatopDe ueils)texo(o iudaptnlietl(farrmxmoot1tlxomoeiltla2umnvo t4 lxrmr3oydfaD aieo;()t2xoxopiu1op nmnct tfaDrmxm ot4tltn feilslmDrmums u4alxrif oydlmtraivo;( tetr(m3iudlp e fci t)arrmx pot4tlxnmfciatls2uaumon(4 rtoxrciydla eln i;t  2xmir ny1ome licsas sDua(monu1aetoifeiat s2um( s ()trxrmr iy1fpDraies (0texmxopiodlleelfei t  2rau o;o1oetn fetytfs ul(vpnt0 rxrirctadop r i o;t  rtr(opiy4lpee nvt t) rurx  nt1aleomociltfsDul(vp;t4aexnio3oatlpD lies (0 rtr(rpio4openlncia()aDtax  no4aee mo3tas m2emu s;t4arxoxr3oytomte n i;(0trxoxr ou1apt mfcslt)a2raurp;t1open fcias sDemu s;t4arxoxr tytlat luei s  2uo(r iu4apt livi t) Dtr(r ;t0aetoioetatfa2emnvo;t4 rtoir3tatla eaues t)srxoxm3ou4altnlivtlt  rtrxmoou4olen o3tls a2eln s u4aeerxocoy1fm raneo;t) rxmxr3oydop elfcils)aDtm(m ;t0openii3iatfa em(mp u0aetnmf iy1omDr i o;t t2xo(m3iy4ap  liesat a2rax p;o1tltomo3ias s2eanvs;u0tetnxfcia1op  ai s;t)sexoxo3iudoltnliviat sruru  ou1opx mictltfa2uan onu4texoxocia1fa r uvo;t)trur(opoy4op  mfvta( srta(r oo0aexoio3iysls eaums ()trxrxfcoy1fmD au olt0sexmir iy4alte fet ()aDtrxronu1tlto feiasfmDemn p;(0 exoir3tydlp e ues s)texoio3iu4optemivt t a2tr( ono4apto fetyslmDumnvonu)alxrmo3tydlp eauei t setm(r ou1olt lnct s sDtm(r ;u0olen iciatfm2ulnvp;(4tetomfciy1fat  n ol(0trtrimpnu1oleelncils)aDtmx oou1aex  o3tyd s2ulnmp u4 lxrmfciotla  anes;s  eum(opnudop elfvsa()sDtrum nt0optoif3iadlm rlnmp;t4trtnmr3iytlaD  u i s) rxrxr3iy4lpe  ics s) Dum(mpot4olx  fetltfa2rmu p t4 exrifciy1fp r neo;(  rxmir3oo1al  miesls)sDuau pou0tlt ioctydfs rmnmont0artnmr3tatlp  an i () rxm(opno1apt  fctltfs2tm(  ;o4olx micildls2rlnmp t0texoir3oy1omtr ues;t0 exm(mpnu4lp  mivsas s2ua(monu4apxniociltfm umn pnu) eermrcia1lm r u o s) ruoiopnu4oltn icslt)aDtmur ;t4olxoifcild m2ulu ont0tlxomocto1opDraivs s0teurxopoo1amen nci (f rurumpot1ape miciyslm eaumon(0trtnir iytlpDraieo s  2umxm3oo4aptemnes t srtru  ot1optnmieiat mDumnmp t4teeomfcoa1la   neo s  rto(o oy1amen fcias)srtrx  ot4open feiysls uln p;t) eerxo iodop e ueo s  2xmxrpnu1lp   ivi s)artmxrp;o4apxnmictlsla2umu s;(0aleoxf oadoptranvs;t0s2tmio nydapenlicia( s2ra(rono0texomfctlslaDuau snt)altnio iatlaD  ivol( teto(mpno1omen ivtls)s2rrurp;t1teeo iciydla2ulums;t4trxrifctotlp e ivi (0seumim3no4ap  lnci tfs2raur ;t4opx  o3iaslaDrmuvs;t)trxnircoy1fp raieil()setr(m3ou4omtemneia(faDumx  no1tlx mfeiysla2eau onu)artomocta1om   nvo t trum(o ou4am nmnesls  rtru p;u1oexomieilsfs2umu sn()arermo3iytlpt  n o s teuo(mpoy4lpeemicta(  Drmu  ot0oeeoii3iasls eau o;()trenxf3oatop   ues;(0 eumxm iy1am n neiat)aDrau o;u1tleo o3iadla ran p (4arerxfciytop e nesls s2trimpnydaltnlnvsls)aDumump;t0tlto fciytfm uanmp (4 eeomociydlmDe uvols0seur(opiydll   netl(fa2tm(rpou1apeoifeiydfa2rmn pn()aleomr3tytla   n i;t0 euo(m nu4lpe lietat)arrmum ;o0tetn o3iydlmDelu p;u) lerir3iodfm rlies (0t2umxmpiy4ale lfvia(farrru  ot4oetnii3ilt m2rlnmon(0 ltnmr3ty1lmt ai s;s) 2xmiopoo1ape lfctasfa2umx pou0tpeoiocildls2rl(ms;u)trxrirctodoateauvi t) 2toio io1ap n ncilt)arumuro;o4opxnmieils mDul(vp;t0aetnmr tadlpDeli s t  ruoir3oo1ll elneiatfa2ua(  no4apenmoeiatfm2eaumonu4 exnxf3to1fp r i ilt  2urirpiu1ap   nvsas)sDumxmo;t0aexn fcild a2rl(vs u)tlxrir3tydoaDrlueo ( trum(mpnydlp nmivi sfa2umu ono0aexomfctltla2raums;t0 lxrxfcto1omt aivo;t)s2xr(r ny4op elies (farua(r nu4tex  octyd aDul( p;t)aeermocoydoaD lu s t0seumxopou1olee nct (fsrrrumonu4aleoioeiasla eluvo u0trenxf iytfm ranvo;s)t2trimpoo1lm  mncslt s2tr( pno0aptn i3tatlmDrmuvp;u) ltrmr3ta1fa raueo t  euo(m3nu4amtnlieias) Dumxrpnt4oexoif3iltlm rmums;u0 leoxo to1lm rlu o;s) rxo(mpoo1ap nmfvsltfaDrrumo;t4olxnii3iysfa2ean sn(4aeerifcia1fp rlneo;() exo(m3nu1am n nvta()a2ur(root1apxo icildla2rm(mont0 eeoxf oodopDr nvi;s0s2urim nydllte fcsl(fsDtmx poo1altnmiciasls2rl(ms;t0artnmr ta1lpD  ieolt tetmxr oy1ope mnetls srtaxrpot4tpt  fetlslm rlnvon() rxnxr3tatlptraivo t) rxrio3ny4ale lieia(f rrm(monu4alt io3tldlm2rln s;u4 lxrmr ta1late n i s s2xr(opiydalen ict t s2rm(ro;u4aex iieilt sDranmp t0altnxf3iotlm r ues;s tetm(r iy1omt lfeilt s2tru p;t0apx miciytls rmnmonu)trtomo iy1op   n sls0t2tmirpiudap emnvsa()aDrrxrp;t1olxo ociysfsDraumpnu0 eenxfcoa1fp raivsls setmim nu1opee ici s)a2rru  nu1oexoifciytlm2uan p (0trxnmr3tydomD luei;t0 exoio ou4lpee iei s)srtrxmont1tlenmociltfsDumn s t0trxrxocoydlp rli o;t  rtrxo nydalt  iesl(f rtau o;t0ope mfciad sDeanms u)altoxr3ootom  ln o;t)srum(m3ny1al  lfci () 2rm(ronu4ole  o3tydfs2rmnvo (4 rtrmoctadlat anvols  rur(rpoo1amte nciltfsrrm(mpoo4oetnmiciasfm rlnvo;()aeermociodfmDr nei s0t2uoxm3no1olt mnet tf rumxrpoo1aeeoii3iadfsDemump t)aexoiocoatlpD  iei;(0s2tmxopnu1apee ivtls) 2urx o;o4oeenmfeild m2emu o t4alerxrcio1opD au sl(  ruo(mpiudll  mnvtas srra(rp;t4tlen ieilslaDra( pnu0altoir3tydfatelu i (0seurxopiodaltn nviasfa2rruro;u1altoif3iltlaDemn p;t0alenxf3tytlmt liei;( t2xr(mpnudol nmfcta(fsDua(m oo1optomoctlt a rlnvsnu4aetoxfctytomD lneo;s  rtrxrpiu1ol emfct s) Dtrx  oo0aex ii3iasfs2el(ms;(0aexrir tadlm  lu o s0truoim io4omt mfvs tf rraum nt4oleoiociysla ranmp u4alxnifcoydlateli ils0s2urxr3io4lle  nctls sDrmurpno4alxoio3tls a emnmp;u4alenmrctytlmtraivi (0seum(opno1lpeelnci sfs2rr(r nu1opto oetydlmDul( on()treoir3ia1lpD lnvolt  ruriopio1lm n icsl( srtru  oo4altomictldls2rmnvo;u4texrxf3oy1fp eai il()truo(m3iydom eliei s s2rauront0tpe iociyd a emnmo u4aleomociydfp r n i (0trtrirpny4ol  lnvtl( srumu o;o4apx  fciyt m ulnmp;(4 eeoif tytfaDeli s;s) rxrxo iu1lltelicilsfaDtmxront1aetoiictldfmDrlnmon()texoxf3iydlmtrlivs ( t2xoim3iy1op nlivta(f 2trx  ;u0apeoioctldla emnvsnu0tltnio todfa ranvs;t0 eumir iodlp   iesl(fsrtaumo;u4olxomi3iasfs um(vs t4 lerxr ootop r nvsl(0srtoimpou1lltnmnctat arra(rpot0oeeo ieiatfaDra(mp;t)trerxf3iadoa   uei t s2tm(m ou4openlncsasf 2trx  nu0tlx  fciadlaDemnmo t4tlxrmr tytla e uei;t)teurxopou4al emici t  2umx  ;t4tptnmfeiasfmDrln s;(0tleoif iodfaDean ilt trtoxmpiydol  lfvi tf rrax  nu1teto f3iltla ran sn(4tleoioctydlaDr n i;t  rto(rpno4aptemnvs t)a2urxmoou4alxn oeiatlm2rauvs;(0alenir totopt lues;( texr(rpiydam elneia( arurxrpoo4aexomfetldlmDraumsnt4alenmo oadfpt lnvils0seto(m3oo4omte ivs sf 2trx o;t1aetomo3iasfm rmnvp t4trxoir iy1lat li o;s0sexrio3oy1amtelivtasfa2tm(rono1tpxnif3iys mDemnvpnt)altnifcty1op ranvo;() rxoimpiu1llenlnei tfsrumu pno4oexn ictad a eau pn()trtnxr ootomD aieo;s)t2uo(opou4lp n ieil( aDua(r no4oexo i3iyslaDea(ms ()aetrxo3ty1fmteln il(0t2uoirpnudap nlivilsf rur(ro;t0tpe mfctyslm ea( p;u)altnmf iatlmDeaieolt0 euoim ny1ol   neils)aDrau onu1aleomociyslsDrau snt0 rtomrctydfmD  uvo;t0srxoir io1altnlfvsa()sDua(r no1ope ii3tadls uan on(4artoxrcoodlmtrlnvi s0 etoimpno1ll   nvs t) rtaxr ou0aeeniiciad mDrlumpnt0arxnxf oo1fptr nvi s0 2xoirpiu4ap e nviasf 2tru pot0tee  ociad m2elumo;(0 exnxociadfp   n i;s t2tmxmpoydome  ivi sfaDrr( o;o4opt  octlslsDea(mp ()aeenxo3oydoa  lnvolt0tetr(o oy4optnlnvi (faDrr(r nt4olt  iciyd sDrluvpn(4 lxoircoodfaDrlueol() rxrir3oo4lmtn ncslsfaDurur ;t4tpeoifctasla2el( snt)tltnir iytfmtrlueo s  rto(rpny4lmtn ietat)a2tmxrpoo0alxnii3tasfs2rl(mp;u)trxoif iy1lmD au i (  rtmxo3oo1lm  lncta( arra(rpot4optomieildla rmn s (4aeerirctadlaDranesls  2uoxm3ou1olee fvt t srta(m ou4tpe mietysfsDeaumo;(4altrxf3oa1fm  lnvsls0texmir3ou1ole  nei (fsrum(rpot4opx  ictasls2raumont) exomo totfaDeau i;(0 rtoxr3nydom emfes t)aDraump;o4tpt  f3ilt m2emu o;t)tltoifciodlatrlueslt) 2xmxm nu4ol  miei (  Draxr nt1tltoii3iyd m ranvpn(4treoxrcty1latrlu ols) etmio3oodopt lncta(  2tr(mono1optoifeildfmDemuvo;t0tetoio3iytlptrlnes;t  eurxm3no1om n ici (  2ra(m ;t1oexnmictytls um( o u)aexnxrcta1fpt aueslt0srur(m ou4ome livs (  Duaumont4olen ictatls2ranmpnu4trerioctodlmtr u o;s0s2uoio3iydomeemnvs s)aDrm(  ou0alto iciatfa el( ont4artnmf totlp raueils0srxr(m ou1op   fesl( s2trxmp;t0oet  ietytfa2raumonu4aetrmr ta1op  luvo;(0trum(opnu1ope lfeil()sDurx ooo4olxnii3iydlaDrmn p;u) ltnxrcoo1fm   nes () rtrir oudop nlnei tfsDtm(  nt4open ictyt sDean p u0texrif3ty1fp  auvsl( texmxo iy4ll e fcs t) 2rm(monu1apx  ictld aDum(ms;t0aexnxo3tytfmt luvi;s0t2xmxr3oydlp nmict t srta(  ;o4apxnmocilsfsDrlnvp;t0arenmr3oy1op   u i;()trxrimpnu4ap  lieia(fsDum(mont1tpxo i3tls s rmuvo;t4 eermrcoydoat lnvs;s  rumxr3iodllte fcta()arua( onu0ape  f3iydfa2el(von(4trxnifcty1fpD aivs t  exm(m3ny1om e iet sf rra(ro;o0oee  f3tls sDemuvs u)teeomo iytoate ivil(0trtr(r io1amtn nesasfs2tm(r ;o0alx  iciltlaDul( pnu)aeenmf3oadlaD  n i ()s2xo(opoo1op nmies tf 2rmxm ou0oex io3ils aDulnms u4tlermf to1op  anvs;(  2xoim iy1al nlfctasfarum(mp;t1alto ieiyslm emn s;(0aeerio iadfmt aivil(0trtoiopny1lpe mfeia(f 2ururpnt4opt iociatla el( pn(4tlxomf oa1fatrlnei t0trxmir oy4alt  fcsat srurxmp;u4oexomiciys aDrauvp;u0alxnirctodfpDr ieils0teuoir ou4lpe lfcta()s2uaxro;o4olxomoeiydfa2umn sn(4trtrxf3tytfmtrlnvsl(0 eum(r3no4llen nvia( arra(rpno1tleo iciadfs eln s;()arxnxf3oydlp  aies s)s2um(o oydam  mfvsat  Dururp;u4tle  o3tysfa2elnms;(4 ltrmo ta1op   i i;s t2xoim nodamtn fviat)s2uaxrpnt1oltomo3iadlm umuvonu0 rtrxr3ootoaD lnes;s)sexm(mpoo4alte nct ()s2tr(r oo4tpen ieiadla elums;t) renxo3tytlaDe u o;t0seumxr3oudopenlfvia() rtrxmp;u0alenmfeiydlm umu ont)artomr ia1omt aivs;s0t2toimpnudalte icsls)arumx oot1alt  feiysfmDulu on(0aleoir oatlpD lnei;( s2urxm3nu4openlnct sf Dra(r ;t1aexnmf3iydlm elu snt)tltoxf tadopDr uei s s2xo(o3io1am  mfcs s a2ra( ont0apxo o3ias s2ulnvs;(0aexrmr3tydlmtranei;t)t2urxo oo1lpt lfetatfaDra( o;t4opeo o3tlt sDeln sn()aetnxocoatlpteln s;( s2ur(o3oydal n fvs tfs2ra( pot0tltnmoeiasfm rmu p;u4aetoxr oy1fat lnvol(0t2trir io1omen ivsas  rtr(  nu0oleoiieildfaDea( o t) rtomfcoa1fatrlivolt0teuoiopnu4ol n neiat)arta(mono0oee  o3ias m eaump u4arenmo iatfptranes;s truoir iudol  mfctls) rrm(moou4texnmf3iydlaDul(msn(4alxoif ia1om eauvil(  2tm(r oudameemncsls sDum(moot1olx  fcilsfm rmumon()arxrmo iy1op r ieslt) etmxr iudalt  ivsltfs2uaxront4oetomictasfs2emumpnt0 lxoxo oydfm rauvi s0 exrxopnodopeemfeiasfs2tr(root0aeenmfeilt m ua(vs u) etrxr oo1fp r u sl( teurxm3iu4al  liesl()srrau pno0aetnmoetatla eanmpn(4aetoxo3ootfa elu o t) 2triopiy4llte iet t) Dtr(rp;u0aleoioctldfsDum(vp;t4treoiocoodfatranvo;()t2xr(mpoo4omtnmnetls aDuaxmonu4aexnmfciyd s2umu snu4 exnxr oydlat  uvol(0seto(r3oydale lneiat  rrrurp;t0altniietadlaDemnvo;t) eeoxocta1late uesls) ruo(r3nodol e icil(f rrau ono0tle  i3iydfa2eln s (4trtnmf tytla e n s;t0s2uriopoy4op  mfvilt) 2ta(r ;t4ape iiciad a elnmpn(0trxoir3to1faDean sls)setoxr no4amtemict t srumuroot1apt if3iyt mDrmn pnu4 rtrmf totlmDrau s;s)setoirpoo4apeelfcilsfaDuaurpnt0oet iicild sDrmumo t4 rxrif3ty1oa elies;(0t2uo(o3oo4lm n fvs tf rtm(mpoo0aetomfciatfs ul( s;t4tlxrio oa1lat  neol( srumxm io4ap elfvsl(f Dtau p;u1tle  o3iytfs ul(von(4 rermf oa1faDraiesls0srtmim3nu1am  lnesl(faDurumpno4oexo fetydfmDrln pn()tltomf oytoate u slt) etrim3oo1llee nctat s2ua(rpnu4olxniiciys m2rm( p;(4altrxr3iatfate nes t0srtr(o oudameemfvsatf 2um(rono4opxniictyd m ea(vont0 eerxfcootlatean s s trxrxo iodalt mfci s  Dtr(mo;t0tleomoctat m2ea( pnt4tlerxr3tadfaDeliei t0setmir3iy1lle  fcia()s2rmxm no4apxnifctld s2rlumo;(0 etnio3iytfm  aiei s0s2urio3oydolt  ncsa() rtau pnu4oexomfetatlmDumnmo u)alerif tytlpte u ilt)s2tm(rpiy1lp e ivs t arur( ont0optoioeilsla2em( snt4 rxoxociytlmD  nvi s)s2urxr iy4am emncsas s2tmur ;o1ale  fctat m uauvont0 ltriocoo1laD lneo (  eumir nydapt lieil() 2tmump;t1oltoiietas sDua(ms;u)alxnirciadla rluvo;t)setr(m oy4op nmfcs tfaDrr( pnu1oet  ociys aDuaumon(0 exnmr3ta1oaDelnvo ( trumiopnudoptnmfesat  Dtmu oou1tetoio3iytfs ran pnt) eeomo tadfmDelnvo;(0sruo(o3nu4amtelfvt s aruau  ;t0tptn oeiadfmDemuvs t0altnxrctadla  luesl(0 etmimpio1lle  fvs ( a2uaxronu4tptn f3tyt a2rm(vp t)trtnifcty1oa   nvo;s t2xmxmpnu1om emfeiasf 2uaxmo;u0oeeo fciyt s2ul(msnu0alxomo oy1opD livo;t)t2toxo oy1amt lfcsls a2umuroot0oet mo3iys mDuaump;t4aexnifcoydfp e uei t trtr(mpny4omeelfvsa()artrum ;u0oex  oetyt m ul(vsn()alxrmr totomt livol()tetmim iydamee fci tfs2tm(r oo1aee  iciytla ul(vs t4trtoif iytlatelnei;t) rtoirpoo1oltelfeslsfarrmump;o1alto o3iad a2rmn snt4 lxrmo tytfm ranei;(  etoim oy4optemfeta( a2rrx oou1oetn feiytla rau p t)aeermocoytfmte neol(0srumim3oy4lm e fcsatfartrumonu0aptn oeiysfsDum(vsnu)arxrio iy1opD  n o;s0seto(r3nydapenliet ( sDraur no4oleo f3iytfa2uauvpnt)texrxociodfpt au s;s t2xr(o iydaptn ivi (fartmxm oo1opxoiictat aDeluvo;u0tlxoxo3oo1omteli o t)seurio oo1ame  iviat  ruau p;t4oee mo3iat m2rmnvs;(0 exrxr oa1fa r u sls) exo(m3no4lpe  nci t  rta( ono0alxn o3iyd m uan pn()arermocty1lmD  i sl()t2tm(opou1lmen fvsas) Dtrumpno1tet mfeiadla rm( s;t)altnmr iatfmt aivo (  2uoir iodam   fci (fsrra( p;o4teenmieiadlsDel(vs u0 exomf oatop  anesl()s2to(r iudope mivt tfs2rrx  ou0tpxnmociasls ulums;(4 rxnir3oy1fptrlu o;t  2xriopoo4lltnmiciltfa2urxrpou0aee iociatlm2rm( ont)arxomocoa1op rln sl(  rumxm ou4oltnmfcsl(faDuru pot0aeeomfeiadls uluvs u0 lermociy1oaDeaieo s  rxm(rpoudoptelnetas sruax  nt0aleomfciyt mDel( s t)tleoifciydopD livs;t)srtrxmpno4lmeelfvtas)arur(mpoo0oet mieiyd s elu p;()arerif io1fp e nvs;(  euoim3nu4ap emfetas)arurx  oo1alxo o3iydlsDrlu s t)aexnir3totlaDeaueo;t)t2umio nudale  fvtl(fsDuau oot0teeomiciatls uln s (0altoiocoy1oa elivs (  2toxr iydapte ncs ( srraurp;t1olt mictatfa2rlnms;u0 rxnirciy1optrluei s  2ur(o oy4lmee fcs t a2rru  ot0texnmf3tad aDea( o (0aexrxo iatopD aneils s2umxm oodlpen nvta()sDtm(ront4tpx mietytfa rmn p;()artnxfcoytlatrlneo t)tetoxm3ou1om n fvs s s2rmu  ;u0apeoif3iasfa emnvonu4 reomf3tadopDe n ol(0 eurio nu1amenmfvi (  2rru pnu1apx iictasfm rl( onu0 eenxrcootlmtr ies s s2trxmpiy1lp emfeiasfs2rm( o;o4opx  fetat a uau snt0trenxo3to1lp  ai il() rumir nu4amt lneiltfsDrmxmpnu0tlxoiieiydfaDranms (0 rerifciodfa rln il( texo(m3oudomtnlieta( sDurumpno4texnmietadlmDumu pnu4 eenmo3oydomD ln olt setoxmpno1lptnlics ( aDtru ont1teeomfcildfmDea(vo (4texomociydfpD  uvi;t)trxoim3ou1aptnmicsa()a2raum ot1altn fciyslmDuauvo (4alxniocoydomt ln i t0s2urxm3iy1lp n fcta()a2um(mpnt0aexoifeiltlmDelums u4teenmr oodfa  auesl(0 exrxm3iydlp e iet sfs2uaur ou4texo oeils s rl(vp;(4artomf iadom rau i ()sexoxm3iu1omtn ieilt) rurxm ou1tlxo ieiatlmDelumon(4 exrir tadfm ean s;t0 euo(rpio4ll nlnvsat s2umxmonu4oetomfeiasfmDemuvs;t4 etoxo3oy1lmtelnvs;t0sexm(o3oudap  lnvtltfa2uaur ;u0tlt mfciltlaDumnmont4altoircoa1fa rlnvsls setrxo3no4ll emivtlt)srrm( oot4tlen fciatls2emnvs;u4trxrxfcta1omDe u s;t0teuoxo iy4al nmfeslsf Drr( poo4oltnifciltfa2uluvsnt0tltoxo oydla  aneo;(0trtmiopoudlle mfvt t  2umu o;o0apx  f3ils sDel(vs;() reomrciy1om rauvi;t0seur(r3oo4lpenlictlsfsrrr( p;t1ope  f3iys sDem(ms;u4tltnmr3iy1lmt lnvi;t0teuriopnodole lfei s) rrm( p;t4texomiciat s el(ms;t0arxnmr ootlmD liei;t)sruoxopnydameelicsas) Duaurono0olxo oeiytfa2umumo;u4 rxoiociytlmt  uvo;(  rum(o3iy1ameelncil() rrm(  nu4aetoifciyslm2uauvo;u4 rerxo oodfpteaneol(0trurir nu4alt  fctls) Durxr ;t1oetniociytlm2elnms t4altoir iydoa r nei s0srxmirpoudole  ivi tfa2tm(r ;o4tpt moeilt m2um(vp (0tltnir iytfa raivs;(  exm(m3io1opt lfes s)a2umxmonu0alen fciadfs ranvonu4teerxr tadlpDr iei s)teuoxopiydol   fvsa(f Dtaumo;u0oleoioeilsfs eluvp t) renmfciy1opDeaiesl( trxoxm3io4ameelfcsls)aDurxrp;t0tltoioctldlm2rluvpn(4artnio oydomte u o;t0 exoim3iy4ol  mivt () rum( oot1opt mieiydfm2umu o (0altoio iatoa rauvs t) rtmxm3oudap elnciasfsDrrumpno0apx ifeiasfs2um(vpn(0aetoxoctatfa eanvs ( s2xr(m3iu1llee feia( sDraxro;o4tpto oetadfa2ua(mp u0artoio3ty1oa r neo t0t2umxmpio4ome  neta( sDurxm ;o0oleniociaslm2ua(monu)arenio io1omDe iesls seto(m oy4lm elfvtl(fs2tr(rpno0tpt  oeias s2em( s u0areoxf3oo1lm eaivo;s s2xm(rpou1lp n nes sfa2tmu pnt4aptoifciysla elu pnt4teeriocoa1fmteanvi;(  2toirpnu1ol elieilt srraumonu0tpxoiietat m2eanvo;u0tlxnxf3ia1lpDe u i;s0tetr(opiudol nmnvs tf Dta(mp;t1tpto oeildfmDumu p;t0tlerxr3to1fm e uvi (  eurir3nodlm  mivsl()artru poo1altnmi3tlslmDemnmo;u0 rtoxo3oa1oaD  ieolt)s2xoxr iy1omt  ivi ( a2umu p;o1teenifciydfa2rau snu0 etoxo3oodlm e iei;t seur(opiudll elnvtls aDta( o;o4aexnmietys sDra( pnt0treoxr3oy1latr u o;t0seur(m iydlltemietlt) 2rr( pot1tlto o3iad sDul(ms;(4 etrmrctytfat lu s;( sexmxrpiy4olt mfeslsf rtmxmoot0tpeniicils aDelu p (4 leoxr3iotomD anei;(0 rur(m ny4ale  fei s aDurxm ;u0tetoiicilsla ranvon()tlxoio3ty1om   n s s tetoxr nudop elnvslt)sDrm(rpot0alxomiciydfa eluvs u0teerxrcta1om eaues t trxr(r3oudomenlnvtatfsDurx pnu4tptnmfctys a emuvo;t4trxrif3oatlat lieo;(0srxoxr3nodomeelnesls) 2rrxr nt1aex ifeiydlmDulumo (4alxomocty1fa  au slt)seum(r oydlmt mfvtls)s2rrxrpot1opx  fciltla el(mp;(4 lxrmr oydlpt anvo t)texr(o3oo4op nlncil()sDtax o;u1oltoifciysfa2rlnmp;(0aeenmr oydlp   neol()srtmio3iu4alt  nvi s)sDtrxm ;t4tleoioeias sDumuvp (0altnmf3iodopt ai o;t0 etoxm iu1lpenlfetlsfaDta(mont4aexo ociadfaDra(monu)alxrxf oo1laDelnes;s0s2um(opnydamt lfetltfa2rm(mpot0aptn o3iasla uluvo;(0tltrir oy1fm raivo;(0setrir3iy4op  mnctls a2urur nt0aetnioeiytla2emums t4areniocoatomDrln s;s)trtmim3iu1ap  lieiat)s2umxmp;o1tleomfetas a2ul( p;u)trtomf oytomtrlivs;(0trtrim3iy4amtn ivslsf rtaxmono4oeeomo3iys m eanvs u) lxoio iytfp   neilt t2urio nudlpen iei (f Dur(m oo1olenmf3ias s rln p;t0arenir iatlpD  ues;s0 eurxopoy1optemici sf 2uaum ;t1tlt  icild s eanmo u4 ltrxo oytlmteai i s) ruo(r oydapee netls a2rmxr ;u0texn ictlslaDrl(vo u)texomo tydfaDe nvs;( s2toxrpiydlpe lieia( arur(ro;o0opt mieiad s2rmn o u4 lerxfctadlm rli s t s2trir3ou1amtnlnvilt)arrr(r ot4tetomi3ils a rm(mp;u) eerif3to1faD anei;t0sexm(r iodlmtelncilt srtrurooo1apeoif3iad m umumon(4trxrmf iy1la eauvo;(0srtmir nydlpeemieilt)a2umx p;u4oex  feiatfmDuln s () rxoif3iodfmDe ueils0tetm(r3iudlptnmfvsa(fa2uaxmp;o0altoifeiat s rluvp;(4 lxrmo iodfp eaivsls0 euoim3nu4olte ivi (faDur(mooo4olx  iciad mDem(msnu4texomoctydfmt au s t0 2trxrpoy1lpenmfei ()srra(m ot4oexoiiciatfm ranvo t)aexoxf3iotoa  aies;t  2tmxr io4lle  fctls) Dtrurpou4aee mociys aDrlnvpnu0trtoxr ootlat aneo t0 ruo(r no1lp n icias srtrumoou1oexn ictadlm rluvsnu4alxrio3iatomDran sl()truo(m3iu4opte ivsa() rtrx  no1opt iocildlm eau p u) lxoxfcty1la e nei ( t2urxm3oo4alenlict t) 2uau  nt4aetn i3tld s uauvo;(0 ltrmf oydfmt  i o t texoxr nodolte fetls)srra(ro;t4aexnio3tydlm uau s;u)trtoxf3oydfmtean o;s) 2xoiopoodlp emfctatfa2tmxm ;o1apen o3tydfa2umuvo u)tltrxf oa1fmt an i;(0seuriopio4optemicil()sDtrxm ;u1alen fetytfmDemu on(0aeerif oytfmt liei;(0srur(mpnu1llt  ivs s  rua(moot4aleomociat a2emumsnt4 rxrioctydfm eluvi;(  2tmimpnydap nmfcsas artau poo0apxo fciltlm2rluvont0 ltnir3iodlm e ivolt texoio3oudoltnlnct s)s2rau o;o0tpxn fciydlm ulnvs;t0teermoctadoa e u i;( teuoxmpiu4apte fvil(  rtmu  nu4alto f3iasla2eluvp;()aetoxo iy1lptrauesl( seuo(mpiudam  mfeia(  rrr(mpnt1oleniieiytfs uaumpn(0 rtrir3tadopDraivi;s)setmir3io4altemfetat)sDtrx oou4tpen i3tasla raump t0tlenmf3ty1latrlu s t)srxr(m no1ll  livtl() rum(mpoo0tptomo3iyslm umu p;u4altomrciydlaDe neol(0 2xrirpiodlltnmfei (  rrrx pnu4oleo i3tadfa2ua( pn(0tetrxr iatfaD li sl()t2um(opoodom e fcs (fa2ta(ro;o4tpe mictltlm2ulumpn(4treoir oydomt lneils0 ruriopiy4lp  mfeta()srrrxrpnu0aee  fetys aDraumsnu) lxrio tydfatrliesls0 rxrir3ou4lm n feias) 2rmu ono0apto iciad s2rl(vp;t)aexnmo oytoatrlu o;t0 etoio oodal nlieiat s2ta(ronu0optomfciad mDelnvonu4aleoircty1fpD  ivils) etmxm oo4alenmicsa()srrr(root1tpen fcild aDemuvs;t0areoif3to1fptr ivol(0 2xmim3iu1ameelnes s)aDtrum no1oltnifetyt m2umnmp t0 etrxfctodom r nesl(0srur(m iydll e fctat  2ra(mo;u4opx mfeildfa ua(vsnu) exrxfcoy1fmt luvi t0seur(o3nu4ap  mfcsls  rtmxm ou0tlt mf3iatfmDulumpnt0 lxoif3tatfm e uvo;(0setr(opoydlle mfvsa()arrr( pou4texo ocils m ea(mp;()artoio tydlm r i il( trtm(o iu4olen iesa() Drm(mooo0aeeoiieiyslm rlu ont0tleomr3iytlpDr u s s0srum(opiu4om elnvtas  Dur(r ;t0tetniiciasfaDul(vo (0trtnmfctytoatrlnei s0s2uriopny4llt mies tfsDrrxrp;o1tetn fetyslsDul( p u4trtnxr ta1la rau o;s trto(opnudoltemnct s a2trxr ot1apx iieilt a2emnmont0 lxrmrctodfmD lnesls)s2umxm3oydlme  nvsas) 2ra(  ;o1alxn o3ildfa rl(vs;u) lxrif3iytoaDe i i;s)seuo(rpiy4ome  fct ( aDuaxrp;t0aet mictldls2rl(ms ()aleomoctydoptrluei;(  2urxm oydolenlietltf 2tm(roou1teeoii3tydfm2ua(vsn()aleoioctadfmtr i ilt0 exoim oo1ame  iesls srrax o;t4teen oeiytfs elu o;t4arxoif tatopD  ies ()texoxo3nudlm e icil(fs2uax  ou1aeenioeildfmDrmuvo t0alxrxr3to1lm  anvs;(0trtmimpnu4op n fvtl()a2ur(ro;u0ole ifctls s ranvs;t4 ltoirciy1lmDeaieo ()srtoiopoudope  netl() Drmx p;o0olx mo3ild a ulnmo t) lenxf tytlp rauvols)srxr(m no4ame  fviat aDurur nu4aexomieildfaDuanvo (4texrio iy1fp rlnvo;()s2xr(opoudlm   ivslt s2ra(rp;o1opeomoeils m2rauvp;t)tltrio3iy1fmtrli s;s  rxrio3iudapenmivs t)artmxm ;u0openifctydfs rlnms ()altrifcto1opDrlnei;s0 2xr(opoo4olt mfeia( s2trurp;u4tee  icild a el(ms;t0 leoxo3iotfmtrlivols0 exrim3oy4ol  lneiat) rtaumoot0opt  iciaslm rmu s;t)artrxf3iadfa elies ()teumxopiudamen nei t)sDrrxro;o4tex  ieiytla umnmo (0tlerxf ty1lm  an ilt0 exmxm no1ll nmivsa(fsrum(mo;o4tpx  oetad a emnms;u0aeenmr3iydomDr i ils)truoio3iydaltnmivi t aDtrxmp;u0ale ioetyd s ul( o u) rxrxr3oadoptrai o;t)t2toim iudol elncil(f 2tmur no0apt mo3ildfs um(vp;t)texnmfctotlm eluvi;t teuoio oy4lp  miesa(fs2trumpot1tptomociat s2ulu pnu) lxrmrctydfm e n s s0 rxr(r oydal  mnesls  Drrum ou0teeoiiciysfsDrln p (4alenxocoytlaD auvi s0 rumxr3nydll e fvslt)aDra(mpou1tpxomfetlt s2ulu ont4tleoxr oadfmt anvols sexoim3iu4alt micsat)arur( o;t4apeoifetadfm ea(von() ltrircoa1opDraiei (0s2ur(mpoo1omen nvtlt aDtr( o;o0oet  o3tlsfs2eanmp;t4 rxnxf iatoa eaueo t)sexm(opio4omeemnesl( arrruro;t4ale ioeiyt mDumnvon(4alerxo tadom   neo;s0 etoiopiodomte nei sfs2raxrpoo1tlx  feild sDem(mont)tlxnxrcio1fa  lieil(0t2tmxo3iydomen fvtas  2tmxrono0opeo f3iysfaDra(vs (4aexnmr3tytom e i i s srtm(r3ou1omtnmivi s)srtr(ronu4opeomf3iytfs2umnvs;(0 rermo3iy1op e ivi;()seumxm iydomee fcs ()a2umxrooo4oexnmiciad aDulu p t) eermo to1fpDrlneo t0setoxmpiu1op nlnvsasfs2taum ;o1olxoio3tas a2emuvs;u)teenmrctydfa  lnes ()t2xoir oydop   nei t) Dtmx  oo0aetn o3iasfm2ra(msnt)aetoir3ootfaDrlueolt)s2tm(o iydll  mnvias  2ur(m ;o4apxn feiasfsDemn onu4 ltoir3tydfm  an o;(  eumiopno4aleemfct ( a2rr(r nu1alenif3ild s elnvpn(0tetomr ia1faD lueo;t)t2tm(r no1am emies ( s2urxm nt0tpenmictat s elumo;(4 ltrif iydfmt aivsls t2to(r3ou4lleemivias artrur nt4tleo f3iysfs ulu snt0 ltrxr ia1faDeanvilt srumio no4ame  iesls srrr(r ot0aexnmo3iadlm2ean p u)tlxniocoodomtraueols  euo(r3oo1lmtn nvs sf Dur(rpot4tlxnif3ilt a uluvp ()arxrio3oadoaDrai o;()s2xrxrpoudap nlicta(fsrrrxmoot4teeomfeildlmDrlu o;(4 eeoir3ty1faDraueo t t2tmxm3iy1lleemiesa() rra(rooo4opxnmo3iaslm ran ont)tlenifcto1opDrli s t s2tm(r oy4am emieslsfa2taur ;o0optomietasla rl(vp;u4aleomociydom e ieol(  2umirpou1alen nvsltfa2trump;o1tpeomf3iatlaDea( snu0aleoxfciotfat  i s;()srtm(r3io4lltelnetat s2trurp;t0olto ociyd s2umnvs;t0 eerif3iy1fa  ai s;t  exr(m3no4amtelieslt) rrruro;u4olenmocild a2rl(vpn(0tlxnir oytoptelueo () etrim oo4ol nlictls)s2ur(  ot0opxnmi3ilsfa rl(vpnt4aleomo3iy1lp rlieol()srum(m no1lm  lfctl(fsrrrur ;u4olxoio3iad aDrl( o;t)tltomrcoa1omt anvolt)s2trxr no4apen fesa(  2raump;u0olen i3iydlsDum(mo;u4tltoif tatla elnes;s0 eumxrpiydlleelieiltf rumxmpou0altomi3iaslsDrm( snt0 exnxr3ootoatrau sls0 2trxrpio4lptelnviatfsrraxmp;t0oeen icils aDemu o u)arenif iydlmD lu i s sexoim3no4lp e fei () 2urxmo;u0olxomfeiatfa2rl(mon(4tetomfcio1fmDeauvs t0 exo(rpnydlmtnlics s  Dum(mont1apxnifeiyd sDuln p;u)aexoxf3to1om eauvo (0 eurim3nu4op emneil()s2um(m ;t1aetoioeiadfm elnvo u0 eerio tytlmteln s;( seumxm iy4am e fvia(fsDrr(rpou1alt iiciydfs uluvp (4 rxrircoy1fa eai ilt0tetrxr3oy1lmee nvsa() rurxr nu1openii3iyt m2uaumo t4artoxr to1omt  ivi;s) rtm(o3iodaptnmicta()a2uaxrp;t4tpe  fctldlaDulnmp (0arxomf3tytlpD lueols0trxmxrpiudoptnlict () Dtm(  ou0openmo3ils aDuan o;(4 exrio oytlm  aueil()texrxmpoy4om elnci s)a2rm(m nt0tetn iciadla2uln p t0tleoircootfaDean s t  2trirpiudlmtnmfvs t  Dtauronu0optomfeiys m ra(vont0trtniocoodlpteauvs t0trur(mpou1ape mieias srrrx o;u1openifciydfa rau snu4altomf totlaDr nvsls) eur(r no1opt mnctat arurxm ou1olxoiiciatlm rm(vont) lermr oodlpDeauvilt0 exrim3nu4lmt lncilt) 2rm(m ou1apx  i3iltfm elu snu) etnir3oydopteln s t0 rxr(m3nu4al  lfcsl(f rtrx  ou0ole moetld mDumu s;()aetrmoctodomte ueo s seuoxopoydll n fetas  2umxm no4texn ocias mDumu p (0 exrif3tydop   ivsls  2xmimpiudlmtnlfct t  Draumoot1alx  icildla emumsnu0 lxrio3todlpD  neolt) 2xrxr oy4aleemictl(f 2urx ono4texoifciasla rlnvonu0 exnxr3io1fpD auvilt sruo(opny1apee iet (faDum(mpoo0olt  i3ildla2um(mo ()trtnxf3oy1lmDran i ()t2xo(rpiodlptnlfvtlt a2uaxm no0tpx  o3iys a umnvp t0aexrifciadfmD anes t0setoxr io1op nlivi s arrrxro;t1opto i3ils a ea(von(4 lenxociadlpD livs;(  eurxo oy1lptn fctat)aruru ooo4optn f3tat aDeanmp;u0tlxrifctydop rlivol()srumxm oy4altnmici (f rum( onu1oleo octyd a umnmo;u4tlxomo3oydfp ranvi;t0t2tmxopnu4lpt  iviat)aDtru pou1tpenmfetldfs2rlnmo;(4 lxoio tydlm  lues t sexmxmpio4ap elict sfsrururo;o1opeomieiydls2rl(mo;u4 reomfciotlaDr i ilt)srxoim oudlptnliciat aruaurpnt1olen ieiyt s rl(vs u4tlxnmocoodop   n s;( srur(m3iy4lme lietatfs2uaumoou1aexomf3tyd m2ea(vs;(0arxrir ia1opDrlnvi;t)s2tmxo iydoptnmnet ( srurumpoo0oltoiietlsfa rm( o;u0aleoxf iydfmDe ueo;(0t2xo(o iudom e ies (fa2tm(m nt1aptn feils sDum(vp t) rtrxo3oy1fmteln sl()seur(opiydll n ietlt) rtrx  nu1aeeniicildfm ean p;(4texnxocty1oatrlnvs;t)trxo(m iydale lietatf Dtmxrp;o0opx mfciltla2elumo;u4 reomf3ty1oat luvs (  2umirpiydlp  lnetas)s2ra(mpot0tleoii3iydla2ulnmp t4texomf oodlmteli o s0 rtmimpoo1ope licsa( aDrrxmpnu0ale ioeiytlm umnmpnu)alxnir3oydlptrlnvs;s0 2xo(m3ou1lm n ncils srum(ro;u0tptomoetyslm uauvo u)trtrxr iydfpDranvs t  eto(r3no4ap n iesl(f rum(ro;t1olenmociatlmDul(mo;u4 ltrxfcio1fa   u sl(  eto(r3oodlmtemivtas s2uau pot4apxomo3tls s2um(mp;u0 rxrmf iatlpD ai s;( trumim ny1open fcsa(farraxmonu4tlen oetad aDrlnvp;(0tlerxo iatlm eauvsls)seurxm3oodlp e nct tfs2umu  no1oltomfciyd s2uln onu0 rtomf iotfm eaivs;t0trumio3iudolt mfctls)aDtru onu1tptoif3ild a ea( sn()tetoxrcoadomD  i s s  rxmimpio1lpt liei () 2tmu ono4tetoiociys m2ra( o t0 eeoxo oydlpt  uvs;s0setoim iy1om  mnvtasf Durxm ;u1alen octldla eln p;t)tltrircta1oaDe uvo;(0t2toio io1lltelnei t)a2raxr ;t0opxomfciltfa rlums (0tlenirctatlaDeaies;s)trum(m ou1ll nmnviat sDuaurpnu0olx  o3iysls2ulump ()aeeoxoctotlmtr i i;(0trurxr3nu4ap elnctas) 2tmu o;o4ale iictydlm ulnvs;u)arxnir oydlpDrln olt0 eumxr3ou4amte nei tf Drau o;t1tle  iciaslm2rauvo t0artnif3iy1lp   i ol(0seuoxm nudlm e nvtltfarrau p;t4alenioetytlsDeau pnt4 exomrctytfmD  uvs;s0 rtoxopiydlme lncia()a2umx  nu0oeeniociadlmDrauvo t0 renif3oatoaDr u sl(0s2xmxm iu1opee nctls  2rmx ono1openiieiadlm umnvs u0 lxoxf3iadlmtrlnvo (0 eumirpiu1opt  ivil(faDtmu  ;u0tet io3iysfm2rm( s (0aexoxo iotlmDrli il()trxoir3io4lmeemfvi s) rrr(roou4tlx miciaslmDuanvs;t0tlxnmf tadopDe ivsls)teuoxm3iy4lmtemfctltf 2trump;o4apen feiasfm ul(msn()texrif3iy1om e neo;s)t2uoiopou1lme lfeslt  2rrxront4teeo feiat aDem(msnu) lenircoo1fptrli i;()tetmio nydole mnesl( arra(mpou1optnmi3iytlaDeanmo;t) rxnmr iy1lmtrai s s)seurir nudol n nviat)a2rmxrpot1oetniietldfs2umu s t4 eeoxrciotfpDelu i t tetr(m3nydop nliet sfaDra(ront1tet ii3iad a elnvo u)altnxrctytlp e ues s t2triopoy1aptnlictls)srurx o;t1aleo oeiytfa rau s u4 rxnmf oytopDelu sls s2umxmpiu1lmen ies sfsDua(ro;t1texnifciyd sDum(vpnt0alenmf3to1lp eai s;(0t2umiopiodamee ivs t) 2trx pnu4oeto iciyd a2ra(mo;t4tlxrxo ia1lmD lnei;( setr(r3iu4opeemics tfsDuax ont0aeenmiciat a eauvp (4 rxnifctydopt  n s ( trtmxo3nudop emfctas s2rmur ot1olxo ietat m2um(vo;(4alenmoctodfa e u i ( srxrxr iy1ale lietl(fsDra( onu1tet  ieiydlm2elnmsnt0teermo oodomDeaneol()t2urim ny4al  mnvtat  2rm(rono1aleo f3iasla rl(mon(4tlxrxrcoa1opteauvs s0 2uoxo no4apee ict s)sDtrxroot4aex  oeildls eau sn()arerif3ia1lat lies;t)srxrxr3oudalte fcta()artrum ;o0opx  f3ils a emumpn(0 leoxfcta1opDr ues ()s2xmxr no4ll e fvil( srrm(rp;o1oee  iciadlaDuaumpnu0alxnxf3ia1fmtraneol(0seum(o3oo1ll emnesasfaDua( pnu1ape  feiasfa umu onu4aeenio oadfa rau ol( tetmxo iu1ameemietls a2raxront4tetnif3iydla2eluvo;u0aetnmo3iydoa rlues t0 2urxm nodapt mfcsls)s2tm(r nt1tet mo3tyt m uanvsnt)tlxrmr3iydomteli o t0s2xm(r3io4openmfcsa() rraxmont4tpxo o3iasfm uln on(0tlenxr iotfa raueols  2trxm3io1aptelfeta(f rua( oot4alx io3tasfm um(vs u) lenxrcty1fm e u o;s) ruoxm oo4ale lfei ()artmumpou0apen fciatfs uanvp u)aexrmr3ta1lmDrlu s;t0 rxrirpiy1omeemfvias)aDrmump;o1aptomfeiltfaDrl(vpnu0tltnmo3oodop  lieslt) 2uoxo iu1op  lfvslt arra(rp;o1tlx  f3iadla rlnmpnt4 exnif3iatlat aiei;t) 2xmimpoy4apeelivil() 2taur nt1apxnmo3tlslm2umuvonu4tleoioctatoaDelivo;(0 rum(m nodlmtnlfeia(fs2rm( o;u1apeomf3tlsls um(ms t0artrir3tydoptrai s t)sexoxo3oydomte iesasf Dum(  no4tpx if3tat mDuauvs u4texnxoctadlate n i;()trur(o3nu4aptnliet ( a2ra(m oo1aeto oeiyd s em( p;(4altnir3ty1fat  nvs ( setmim oo1altnmivslt sDta(mo;t4tptnmieiltlmDumuvsn()altnioctytoa elueol( t2um(m nudomenliesl( s2rm(rooo0olt  octas a ul(vp u) ltoxf to1opDeaiesl() rurimpoudlptelnetltfsDrmur ;o1alxomieiyt m2ean on()tetomocoodop ran slt)srxoirpiy4lleelfcil()sDra(r oo1opeo o3iys sDranmp;t4 reomf iodfp r u i (0trxrio nu4lpenmietlt)sDrm(ro;u0apx  ieildlmDuau pn(0 etnmfctotfmD lnvs (0seurxo iy1oleemnctas)arrmxmo;t4olto fetasfs2rmumont0alxrmf iytfpte ivils  exrim oydole liesls)aDumx o;o1alx  fciyd sDul(vp (0aexrmo iadopD  i s;t0t2toirpoy4olt mnes ()sDtr(mp;t1opto ocilsfsDua(mp (0arxrxf ta1la e nvi;s0s2umim3ou4alen fetl()s2raumpou4oexn oeiydla uau p u)aeenif3iadfmDe i i;s0 etmxmpno1alt miciatfsrrax  nt1opt iictlslm rauvonu4 etoir3oadfaD  ueo ( trtmxmpiy4opt lncia(f Dumxr ou1olxo o3tyslsDrmnvs t)altrxfcio1lmDraies s) rtoxr3iu1ll emnesls)s2trurpou0tetnmi3ild a2rmnmo;u4 ltnio3iodfmD  nvsl(0seuoxm3oo4op  mnvsasfsDua(r no0texn ieiad s ulnvsnt4arerio3io1lpDr nvs t)srtm(o iudlm  mfcslt)srraum no4oex if3iadls rlnvs;u4aexomo iy1faD ln o t0 rumim no1ll   fcilt  rurxrp;o1apt iictldfa umu ont) rxoif3tytlptr uvi;()s2xmiopiu4lp  mivs tfsDururoou1teenmoeiys s em(mp;t4trenio3iatlptrau i;t0 2xoir3oudlpt miei t) Draumpou1aptn oeilsfsDul( onu4altrirctodlp elu ilt srto(o nu4lmt  nvsltfaDuax pot4apen o3tatlsDea(ms (0alerxociatfa rlivils) 2toxrpiy1al  lietat)aruau  ou0oexomoeildlsDul(msnt4trerxf iatop   uvo;s s2xmir3iu4apt  netasfsDrru o;u1ape  f3ilsfmDel(vo;u4texrmo3ta1lmD auei t0 2xm(m nu1lpen icta() rtru p;u4altnioetaslaDra(mp;(4 eerif iotlaDe uvo;s  2umim ou4alenmfetltf Drax pot0optn o3iadlsDel(vo (0 exrirctytlm  lu slt0srxr(o nu1lpe  fcsls)aDrr( p;u4alxn i3tldfsDra(mp (0 ltoirciadom rlueo;s) rtmiopiy4amt mfcils  rtrxmpnu1oeen o3tltfs2el(msn(4 ltoxo3tytomte nvolt) 2toxr no1amenmfetas)arrax o;o0tpxomi3tat a2em(mo t)arermo3oadom  auvs (0t2xoim3ou1oltemfctl(fsrua(mo;u1tlx iieiad s ul(msnt4 leomr ootfp e u s s) 2xo(m ou1apt  ieslt) 2rru o;u4aeeo o3tatfs2rl( s (0 leoirctatfmt  nei s0 euo(rpoo1olte feiatfsDuru poo4apen ociatla um( sn()alxomo ty1omtr uei;s)t2toxo3ou1ole lnvsl()sDumx  ot0ole iociyslaDemuvon()alenir3oy1lpDrluesl( s2xoir3nodol emnes s)artax p;t0oetoio3iydfa ranmp;u4 rxoif totoa e ueolt  ruoir3nydlmeemietasfartm( o;o4teeoio3iys s2rlumo;t0texoxociadlm  luvi (0texmxmpoudoltemfcs ( a2rru pno0aptniieiyt m2em(mpnu)alxomfcoadfm eluvi t)t2tmim ou4llt  neta() Dur(rono0oltoiieiysfs2rmumo t0artrmo3oatfptr n o;()srxmxmpiydlpe lfeia(  rtmu p;t4aetomiciytlaDelnvp;u4trtrmf oatoaDrlues s0t2ur(m3oydam  mfvtlt)a2tr(  ou4oeenmiciasls emums u)tlxnir tydfat auvi s)seumxr3iu4omtnlfesatfartaumont0oleoiieils s uanmsn() exnio3ta1op  anvo (0 etoirpiy4op elnvil(faDumxmp;t1apx mo3iydls rlnmont)alerif3oydfaDe nvi;s)s2xm(opnu1altnmiviatfs2ta( pot1ope mo3tysfm2um(mo;t0 lenxf iatopDr ieo;s0trurio iudomeemivilt) Draur ou4ole ii3ilsls em(vsn() rtrxfcoytfatrai i (  2umxm3ou4lltemfeslt  Dta( pnt0tee  i3iat mDranvsnt4arxomr tatomDeaueslt srtrxmpoy4am n fvsa(faDtr(rpot4aptn i3tadlm2ulu o t0teermf3iotfaDrluesls0t2triopoy1ome lics ()srrrx p;o0apxomf3iad s ra(ms;t4tlerir oatoaDe ues;s)s2uoxm iudlmtnmiesl( aDraxmp;o1tpx  ociyslsDem( s;()tlxnmr totlpD aivi (0 etm(r3iy4ameemfvils)a2rau oou0tpxniietld m ea(mont0arxomo3iodom  lu i s0texrio3oo1altelnvt s)srua(  no1apeomf3iat m rmnvpnt4 etnmoctydfaD au o;t0 2ur(o3iy4al elnvilt  Dta(rooo1aexomfcildfs2raums u0 lermr ta1faD lnvo s trxmxopnodlpt  fvtas)s2rmumpoo1texniocilt s emuvo;()aexnifcoa1laDe uvsl( texmxr nudale licsat  rua( oot0tee ioetadfaDemnvp;t0aexnxo3ty1lm elivsl( teuoxo ou4oleelietas)aDta(rpou4apxnmieiat a rm(mo;t) etnio3oodfate ivsls0srxo(opnu1lpe  ivi (f Duax o;t4oex  o3tysfm2emu snt)arermo tatomD  ues;t) exm(r3nu4ol emnciat sDuax  no4aeeo i3iyt s2umumo (0arxnio3oodfptranvi;(0 exmir nudoptnmfes sfsDtr(  nu1tee  fciadlm2rm( p t4tlxoxr3oa1lat lu i s0 2urxo3oo1lmtnmnetltfaDraxrpot4apxomo3ild s2ra(mp ()aeerio3iytoaDr i s;s)srtrir nu4omtnlict ( s2raxmpou0tpeomietltla rlums;t4 rtrxrcty1fpteau i;()setoxr oy1lm   ivt tf rrrxm ou0opeo i3tyt aDrmumsn(4 reoio3to1oa  lueslt  rtoimpny4ap nmivsl()sDurxrp;o0oeeoiietltlm rmuvp u4 lerxr3iytlpDe uesl(0 exoxm iudopen iet tf rta(ront1optn iciytfs2el( p t0trtrmo3oy1fmDraiei (0 etrir ny4alee fvs t)sDrm( p;u4aeenmf3iys sDemuvp;u0aexniocoadfpDeaues;t) exmim3ny1op  miciatf rta(m ;u1olenmictasfa rl( s u0tleomrcta1fm  an o (0truo(r3no4ap nmnvslsf Dtr(rpoo0oetoio3iaslm2ra(ms;u) exoirciodfp  anvi s setoxopoodlltnlnvsl(fsrrm( ont0alto o3iat a2el( o;u) lxriocia1op r i o ( srtoxo ou1ameemfvilt)srtr(  ;t1oetoiociysfm2umumo;(4 lenif3oa1oa  ai i ( s2xr(rpiu4altemnetls)a2tax pnu0oet  feildlm rlumont4tlermr3iy1fp elies;s) etoxmpoy1apt mivils)sDrmxrooo0alxoio3iadfsDuluvp ()trtnmf3iydomD li o () eto(mpno1aptn net t) 2uaur no0tpxoii3iadfsDea(msnu0aetoxrciatlaD anvil(  2toxmpnu1apen nvsls)aDrrx ooo4aleniociltfa eluvo;(0arerif iatlatrlieilt s2xrxm3no1alt lfciat aDuau pnt4tpeoioeiyslmDulnmp;u0 etnifcia1fp r u sl(0 rurxm nydam  lnci s srrrxroou4tet ii3iytlm2emumo;u4artnxoctadlateanes t)t2uoir3oydomeemicsl(fsruax ooo0opxnmieiatlsDem(mo (0alenxo ia1lmDr ivslt)t2toxmpiu1apte net tfaDrmxro;u1tpe iieiasla2rl(vo;u0trxrmr3oy1op eli o;( seuoirpnu1opee fetl( sDumxrpoo0tee mfetldlsDumu p () lxnmf oa1laDr i s s0sexr(m io1ol e ici ()aDur(  nt0olt mfeiasls2umu o (4tlxrmrcoydoaDe ues s0 etoxr iodol emicta(f Dtru onu0oetniociysfaDrauvsn(0 exnxf3iadoaDean ols setoiopoodame lfvslsfsruax  ;o1apto f3ils m2umnmp u0arxnxf oo1fatraneo s)t2trir3iu1olen ivtl()s2tax  ot4tlxoiocildlsDemnms;t4 lerxo ta1lpDeauvslt seurxo ou4lltnlnesl(  Dur( o;u4tle ioeiytla2el(mo;t0 lxnir tadfmtrai ol( teuriopio1ll elfeia() 2ua( pnt0tlt ifciytls ea( o u0tlxnir3to1om  li o;(0s2umio3ny4ll emiet s) rum(rono0aetn icild aDeanvo t)altomfctytlaDe neslt tetmim oy4am nlnet s a2rrurp;o1apxnmo3tysla2rlums;t0tlenxo iydfaDr ivo;t t2xo(mpoydopee fci s srumu p;o1teenio3taslm elu s u0aeenmfctodfp rai i;s)t2urxr3ou1lmt  icslt a2tmu oou0oetnioeiydlsDuanvo t0 ltnxf3io1opt au slt0trxrio nu1oltnmnct t  rrm(moou0alenmiciys sDulnvp t4artnio3ia1lpD  ies;t)srxrio3oudalenlfci s s2raurooo4tlxoiieiat m2ranmp u4aetrxo3oatopDe nvi s0s2xrimpno1alt mnvt sf Drm(mont1aetomoeildlm em(vsnt4aeenifcty1fmtrlnes;(  etrirpiy1ap elicilsf 2ua( p;u0alenmietydlsDeanvs u)arenxr oatfpt anvi;s)s2uoxm oy4alenlneslt arrru ooo4texo i3tatfa2rl( snt0 eerxo3ia1lptrli slt) etrim nudamt mies s artauroou4apeomfciys sDemums u4 lerir3tadfmtr nvi (0 rtm(mpiy4ol   fvsls)s2umum nt1tlxnii3iydfs2rmnvp t4 eeoxo3oytlmDean ols  eur(m3io1ope mfetl( srrrumpno0tlxnmictltlmDrmumsnu0aetoxrcia1oaDean il(0s2xo(r oy1llenlicsls  rrrumoou0aee io3iad sDeanmp u4 exnmr3oy1oa eli i (0 2xm(rpoo4amtelicsa() 2rax p;o4oltn i3iatfmDeanmo (0alxnmo iydfm eai i;() etrxr io4alte nvtatfs2tmurpou1texo ictadls2ea( onu0alenmr3oydlmDeanvi t)t2um(o nudam nliesa(f Dtaxroot4tpenmo3iltfs rlu o u)texrxr oodoa r nvols0s2uoirpny1altemiet () rrm(r ot4aexo fcild m rm(vp t4 ltomf iatfatr n o s s2tmxm3iodamee fetl(  2tau o;o1tpenifeiadlaDuluvp;u0teeomr3oadfa e nvo ( trtmir3iu1oltn nvs sfaDtax p;u1aexo oeias m ul(vo;u)alxnmo oadfate u i s)setr(r3oo1al e fvslsfs2ururp;o0aeen feiasfaDeluvont)trenmrctytom rli ils  rumxr3nodllen icil() 2rmxmpnu1apeomoctls s2rm(vs t)trxnxr3oydfat anvslt0 rurirpnudapeemfcias  rrmu pot0tpe ii3iad mDelnmsnt4aexrio oo1opDelnvo s0t2xo(m nu1lmeemnct t)aruax ono1tle mi3tytlm2uln snu0tlxnir3oy1opDe nes (0 2tr(rpiu4ome lfcslsfa2ur( oot4oltn f3tld sDem(vo;()texnio3iotlmtrlnvilt)texoxmpiy1lmtnmncta()aDuaur no0olx  iciytlsDua(vo t)tetoifcoytlpt anvi s)t2xmxmpoydlm  licias) Drauro;u1tet  fciytlsDrlnms t4 renxrcoytopDean olt s2xm(r3oo4olt  ncta(faDrru o;t0olt  f3iadfaDul(vs;u4arxomf3io1fmteau ilt srxoir3io1ol  licia(  rrax pot0alenioetlt m2uau onu)areomr ty1fpDe ieslt)s2uoxr iy1ap  lfes tf Duaxmp;t4teeo oeiyt s uaumpnu0 rerio3io1fp rlieo s  eurir io4lpeelfvtatfsDraxrpot1teeomoetld s ulnmo;() exoxo oy1laD ai o;(0t2trxmpoudol  lfcslsfaDraxm ot1tpeo oetld a rl(mo (0 renmf3oa1lp  lues;s  rxrxo nydaptemietl() rrrx  ;t0opt ifctaslm uau o;(4 rxoif ty1oa  ln olt)s2xr(rpiydlpe  fvt t) 2rax  ;u1ope moeiysfa um( p u0aeeomfcoy1late ivolt srtoxr3ny1amte fei (fsDtr(root0apeoii3iytfs2rl(vo;(4aleomoctydopt  iei;()seurxr oy1aptemnetl()arta(  ;o4oeeniociydlm2em( s;t)alxomf oatop r nvol(0srxoxmpou4ol nmivilsfs2urxmp;o4tpx iieiatfsDulu p;u4tltnmr tatfm rauvi;s0seumxo3ny4ol  mietltfs2ra(roou0olt mictls s um( o t0 rxoiocoo1latr ivsls) 2xmxr3iu4openlnesasfsrtru oou1optnmiciysfsDem( s;t)tltrmf3ty1fmtrluvi ( trum(m iy1am e icta()a2rrx o;t0oltnmi3tldfaDrl(ms () etnxo3tadfp eauei;s) etmio ou4amtnmics sfartaumo;t0aleoiiciyd s2rlu snu4 exrxrciy1lp rlnvs;t0 2xoir iu4lpenlfvilt)aDua( o;t0ape mo3ils s2ea(monu)treoxr oy1fm  aneils0s2trir oy4opt  ieta()s2rmx ono0tltoiieiytfs ua( ont0trtrmr3tytoa r ueils  euo(r nodamt mietas) rur(  ;u0teenmoctld mDul(vo () rtrmf iatfmt aues ()s2tmim iu1ap emieslt)arraxmonu4aee  ociyslm uan p;t4texnmr3totfp ranvs ( srurxopoudllt mnesl(  2umumo;t4opxn o3iys m2emump;() etomf3oy1oa rln o s)t2xm(rpoydoleelivt sf Dumumoou1tpeo fciyt s uluvp u4tltrmfctytlm eliei;()srxoxo3iu4am emfvtls)sDtrumpnt1olt  fctlsls2ra(vo t4tetoio3ty1lptrluvo t)trtoio ou4omen fvtls  rua(ro;o4tleoio3iat s2ulnvp t0 ltrxr3tytom raiei;s)seuriopnodameemneslt)a2tmu o;t0apx mocils mDraumo;u4 lenmr iatoateln i t0trumxr ou4alee ivslsfa2taurpno1teenmi3tys s rm( s u) ltoioctodlmDr u sl(0 2xm(rpiy4ape lieslt  rtaxr ;u1alx if3tasfm um(mp t4 rxnmrcio1lpDr i i () eurxm3oodol nmfvilt  2tm(  ;t4oee  icildfm2umnvs;t0texniociytoatrauvo;(  rxo(r3io4altn iviasfa2tmx o;o4oexnmfciyd aDemuvsnt)altoir oytlaD li s;s0 etmir nu1om   fet tfs2ra(m nt0olxoifctadla ulnvpn(4alenxf oa1fa rauvolt srtm(r oy4lmtnlfeils aDrm( oot0tle mietls a el(vont0aexrmr3oytlmt luei (  2xmxmpno4op nmncia()srrru p;o0tpeniietytls2rmnmo;t)tleoxfcoatfmte ueols s2xoxm3oo4lpt  neslt  2ta(ro;u0oetnmfciyt mDuln pnt)aeenxf3oytlmte ueo;t trxr(r ou4am n fctlt sDrmxrpnt4aetnmfeiytlaDuluvp t4 etrxf3ia1fmteanvi;s0 rxrxr3iodapte fvsat  Drrurp;o0tpto ieiyd sDumump;u4tlxnmr3iydfaD  ivilt t2xr(rpny4aptn icia()sDtaxr oo0tlen ociysfs2rl(ms;t4 rxrxf oadfaDrluvs;()trxo(rpno4lltemfes ( aDrm(r ;u0opx ifciytlm2ua(ms t) lerxfctytfm eanvo s teurxm iu1lltelfvil(f rtm(m ;o1aee  oeilslaDean p;u4trtnmrcto1oaD aiei t seuoxm ny1amt  nctlt  Drm(rpno4apx  o3iadla2rm(mo;u)trerxrcto1fm  ln i;()s2tmiopno1lm nmnvilsfs2ua(mpnt0aetomo3iadfs2rmnms (0aetomo3oytfpDrlnvolt s2urxm io4lmt miesat  rum(mo;t4aptoio3iadlaDra(mo;()artrmo oy1latranvi s0sexm(m oudlptnmictlt)s2uaur oo1aexoif3iysfm2ea(mp (4trermfctatlp eanvi;t)s2xmim nodlltelfei t) 2rmxro;u1tlt  fciatla2elnvont4 rxriocoydomDr neo t)t2xoiopiu4lpe mici t srrrumoou0tleo oeiad a2rmumpnu)artoxo3ty1fp   nesls sexm(m3oy1ape mncta(fsDuaxmp;t1olxniictltla2ra(mo t4altrmrcoytlaD auvs;()s2tmimpio1olte nvtas) ruaurp;o4aet mfctyd sDem( on() rtrmrctodfpDrlues;( tetmim3iydom nmietlt) rtrxmoou4aeto ociasla2rmnvsnu)alxrxoctadlpteauei ( sexr(mpnudole livtlt)sDrm(mp;u1tet  o3iltla ran pnu)aeermr oytfatr uei s trtmxm iy1llee icslt)srra(  nt1aeenioeiad sDra( p u4 eeomoctytla  lieilt)t2urio io1apt lfcslt)a2rmu poo1oex  feildlaDrluvo;u)texoxociadop r ivo s0 eum(o3nudlm nlivils  2umxm oo1apeoif3iyt mDemn onu0 lenmf3oy1fmt aueo () 2toim oodoptelfes sfsrtrx pou4tpeo ociasla2el( p;u0teenxocoo1om   ueo;( s2tmxo3iu4amenmnct ( sDurxm no1olxo oetldlsDulump u0tltnifcoodfp e nei;( teumim3oo4optelietas)arumu onu1oet mieiaslmDeln s t0tlermf3tytopDe ies;s t2xm(m3iy1ll elfcia(  2uaxronu0altnmo3iatfm2uaumo;(0 ltrxo ta1lp eanes;t0s2xm(mpnu1lm emnctl( sDuax p;o1alen o3tyt aDrmnvo;t4treoif3iy1lmD  neils0trtoimpiu4lmee ivs tfa2tau poo0oetomi3ildfm2emnmpn(4tlerioctatoaDelieolt trto(m iy1ap   feta()sDtmur ;o4opx ioctat a2ea(vo t4aeenxfciy1op eln i;()srtr(o nu4om emicia(  2trxmont4tlx ifciasfsDrm( s u0arxoif3oa1faDr ues;s s2trir3iu4ole  nvil() 2uax  ;o0oexniictltla ul( ont0 rtrmr3io1fp ran ils srxm(opiydam nlfvsl(f Duaurpoo0tpeoiiciatfs2rln pn(0aetnxfciy1fp  anvi (0teumir3iu1apen fesl(fsDumx  ;t1altnmo3ild aDua(mp;t4tlxnmf iodfat lueo t0 rurxo3iy1al n ivt ()srrm(  ou1alenmfcilt s uaump u4tlerxociytfp  lnvsl( s2xrxr iudlltnmivs tf 2rruronu0tet mo3ildfa2ulnvo t4tltnirciadfmteanvi t) rtmxm no1amt mivsls)s2rmumo;t0olx mfctlsfm umnvonu)aexrxrcoo1omtrlivo s t2toxm iudopenmncsl(  rrau poo4tex  ocild m2uluvs;u)altoio3ty1fmD lnei;t s2xr(rpou4apen fvtl(  2urumpnu4oee moetyslsDeluvp;(0alenxr3oadom rauesls  eurxo3ny1ame lnesasfaDrruro;t4tptoioeilsfa2rln s u4 rtoif ootfpD anei s0 2xmim3iu4lptn ivils  2tr( pnu4opxn f3iys a2rlu s u0texnio oytlmt  u i ()teuo(r no1lle lfct s)a2ua(roou1tle io3tydfa umuvs (4tlerir3iadfa e uei;() rxmirpnudlpen iesl(faDumurooo0oltnif3tydls2eanvs;u0altnxr to1latr ieo () eur(opnudll   fcsl()srtmu p;u4oetomi3ils m rmnvsnt4 exrio3oatopteanvsl()trxoio iu1omenlieias  Drmur no4opxo f3iadlm2rmnvo;t0 eenmr3oodfateluvo t)s2xmir3ou4lmenmieta(f 2tmxmoou0ape mf3iyslmDrln o (4trxnxrcta1oa   uvi t)srxm(opoo1olenmivil(fs2ua(mp;t1olxn ietyd s ul(msnu0tetnmrciytomD lu o t  2umxm3nudomtnmicsl(fsrtmu pno0aexo fetat s2elnvpn(0 ltoioctadlpDeai o;t teurxopou4ome  nctat  Drr(  ;t1opxnmieiasfm2eauvs u)tetnmrcoatfmteaues t seuo(opno4lmeemfvias)aDuaxrp;u1opx  ieiydlm2emumonu0 renircoa1omtr ueilt0trtrio3oydllt micsltfs2trx  ot0tpxnmf3iyslm rmn ont) rxomf to1la   n o;s t2xm(m no4ole  ictls artr(root1tex mfctlsfm2ranvsnt0 eermr3iytlm rau il() etrim3iodomeemiesas)sDtrx pnu1oeeniicildfmDumnmsnu)alxoif todfp  lneil( seuoimpoodlp  lnvsat srraur ;u4tlxn f3ils mDem(ms ()artrmr oy1oaD auvi;t0t2umio3nudoltnmnci () Dur( ont0opeo i3taslm uan ont4arxoirctotla rauei t) ruo(m oydomt  fciat  Dua(mpoo1aex iocils s ea(mp u0 etoir3oadlmDe nvols) 2xo(opoudolt lfetat  rumur nt4olxomi3iad a umumpnu)trermo io1lm rlu o () etrio3oudlltnmnet t s2trx pot0tleomoetltla ra(vpnt0trxnxr3iydomtrlieol( trto(o3io4llt miesl(fa2rrum ou0aeen ociyd m eau s t0tltnmf3totom rlnvo t t2xoir iydaltn icslsfaDtruroou1oetoiieiysfsDran p;u0 rerirctotlm   n o;t0 euoim iy1lmte fctltfarta(r ;u0tpe mfeiysfaDul( o t4 eenio3oytfm ranvi;s0texo(o nu4ame mfvtls  Dta(r ;o4alxo feiysla2rlu on(4artnir ia1fptrln i t)seuoxo3iu4ol elivsasfa2rrump;t4opeoio3iaslm2el(vs t)aetrmfciatomtr ivs s teum(m3nu1apen nviatfa2umu  nu0open fciasla emuvo;() lxrxfciy1oaD  neils0 rxoimpoudlltnlneta() rrrumpoo1tltn oeiyt sDulumsnu) lxomf iy1lat an s;s)sexr(m oydal elictls sDurxrp;o1opt io3iat mDua( p ()tetnmrcoo1lm r nes;()sexr(mpio4llenlictl() 2urxm nt0oetnioctasfaDuaumo;t4 rtomo oadfmDrau i;()tetmxr3io1lp elivt t) Durxrooo1ope mieiat sDrl(mpn() reoir3oydfpDrlu ils0 2xm(opoy4optelnvtas aDrmumo;t1aet mf3ild m2rluvp t0tleoxf3totoaDrlieolt)texrxo iydal n fetl(faDrrxm no4tpe  oeiyt m umuvpnu)tlxrxr ootfmte nes t) rumio no4ol   ieias)arur( pou0tpxomoeiltfm ra(vs t0aeenxo3totla   ivs;() rxr(rpiu1lp nmivi ()a2tmu pou0olt iietatfmDuauvs u0tlenmrciy1fmDr ivols0 rto(o iydlpenlnci s srrrxr no4tle io3iadlsDrm(vonu
\ No newline at end of file
@@ -0,0 +1 @@
+uvo s0 2xoio3oudlm nmivslt  2rr(  ;t4tlxo o3tldfa2umn s;u) eenmf3tydoptran o;t0 exoxrpno4olen fet s)srta(rpot1tltnmfeiadls rl(vp t)trxnxrctytfaD  uvslt)srtm(o nodoltemfvt t)srtrxronu0olenmfciyd a2uluvo;()tetoiociy1lmtr u i;t0tetrxo oo1aptelnes (fsrta( oou4oee  i3tldfsDrmnmpnu)aexomoctodlat aueo (0trxr(m3no1om  mfci t s2ra(r oo4aex mfciyd mDua(vs ()trxnmr3oodopDrlues;t0tetr(o3io4al   fes s)arurum ;u4aeenmieils s umn pn(0trerif3oodoptraivsls0texmio oy1alt lfct s) ruaumoou0aleo ietldfm umuvpnt0teeoxfcta1latraivo;(0trtmxm3oy4llenlictlt aDum(  ot1ape mf3tyt m2umnvp () ltomoctytoptelivsls0trtoir3nydlltelncta()arraurooo0altoiictys m2rl(mo;t) rxrir3tadfaDr nes;s) rtr(r nu4llee fei ()aruaxro;t4oleo fetldlaDulumon() exrio3todfaD  u i s trtmio nudapee fvta()artaxr no0oetoio3tytfaDelumonu) exomfctatlmtranes t0s2xoxmpoo1amt  icslt srrm(mo;u4altomociytfs emumont0tlxnxf ta1oaD lnvolt0t2xoiopny1al n ncs ( aDrmxr ;t0tlxoif3taslmDrmuvon(4tetoir3oa1lat  nei ()sexm(mpoy1amtelfet sfaDtmumpnt4teeniieiysla emn o (0tlenmr3tatfa rlivols setoxm3ny1al  lici s srua( pot1teto octltls2rmn s;u0treoxf3oatfmDelneil( t2uoxo oy1ap nlfetas arum(m no1oeen o3tatfa rauvo;u)tltoifcoadomD  uvo t0srurxo iydam n ies sfaDra(mo;t0alt  oetasfa2ranmpnt0teenmoctytomD  nvs;s  2to(rpno4apenlnei (f Dta(mo;t1oleomfeiatlm2raump;t)tltnmfctodlp   ieo t setrxopou4op emfesas)s2tmx pou4apeomieils sDum(vs;t4trtnmf ta1lp   n s t0t2toxopny1lp nmicsa(fa2ua(  ot4tle mfciasfs2rmnmp;t4altomfctytoa rlues;s0 2xo(mpio4om emivsls) rtmxm ou1olxnmfciyt a2rl( p (4tleoifctydfa eluvols)s2tr(m3no1omte nvslt  2tax pot1apxomictadfm2rluvsnt0arxoxr3oo1fmD  nvo;t) rtmimpiudaptelicsas aDtmx o;u1oee iiciytlaDrmums;(0arxrmo iotomD au olt0s2xoim3oy1omte fetl( sDuaxrpnu1aptoifciadfs2rau onu)aleomr iodlp  li s;s t2xo(m3oo1lmt  fvsa()artruro;o0tpxomo3tyt mDraumpnu4artnmo3iadlptrluvo;() rur(m3iu4om e fetlsf Drauront4oexoii3iadfaDem(mo;(0alxomo3tadomte nei;s t2toxo ny1lpe mfetatfsruaumoou4apxnmf3iydla2elu o;u0 rxriociatlmteaneolt)sexmirpou1op elnct t)arum(  ;o1apt iietasfa ea(mon(0 lenio iadlptr u ol(  eurxmpoydamtemiviltf 2urx p;o0oexoioctlsfmDrau s;t4arxrxr io1oaDeau ols0t2xrim3oodlpee fcias)srtrumpnt1tptoii3ias m uau o u4texnmo3oo1fp e ueo t0srumim3iodlpeemfvs sfa2ra( ont0optn fctad a ul(vp t4trxoifctotomD lnei;( s2um(mpio1ope mnei s  2rrxmpoo4aleomo3iasfs2rmnvsnu) leomrcoodfatean o s0texrxr3io1amtn nvta()aDua( pnu4ole ifciadfs2ra( o;t4 rxoir oytoaDe nvol() rxoim iydlmtnmncs (fa2ta( p;u1alxoio3ilsla2emn pnt)alxrxfctydfp r ueolt  2trio3no1lpt lfct t arumum ;t4tptn octls a rmuvo u4 ltoio3oo1lp rln sls)truo(r3no4opee fvt tfsrururono0oexoiocils aDrau p;t4tetrmf3tadlp r u o (  rurxrpnydalee feil( arurxrono1tpxnmocildlsDum( p t4 ltoxo tatlmtr nvo;(0s2umxo iy1lp nmivs s aDur( oou0apto icilsfa2rlnmp u) rxrir3oytlmt anvs;s)srtrio oydlptemfet tf Dua(m oo1olxnio3tadfa rlnvo t0 exriocta1fpte n ol(0seurxr3nodalen ieiat)sDtr(  no0aex mfeiatls2ranms;u)trtrirciotfmt  ues t0 2xm(r3oudoptn feia( a2uaurooo4oleniieiltfs rmnvs;t0tltomf3iadfm  lu i t0t2tm(opoy4lp   nciltfs2um(ront4alxomf3iadlaDum(vo;u0teeoir3tadlpDe nvsls)srto(r3nydlleelnvtas) 2tmx  ;t1opxo oeiysfs2umnms;u4aexoxrctadlpDeluvi s0 etmir3ou1amtn nci t)a2trum nt1opxomoetysfm2em( p (0trenxfcoydlateluvslt)tetmxopnudlpt lfet (  Dtr(r ;o1ape mi3ilslsDemumo;u)tltrxocoytlptrlu o;t)t2xm(mpny1open fcia( srurxrp;o4tpxn icilsfaDrl(mp;(0tleomfciatlpDe nes;s0 eum(rpno4ll nliesa( sDuaxrpnu0optnmo3ildfmDrauvp;t4trxrxr3iytfpt  ueils0trxoxmpio4ole lfeias sDtm(  oo4aleo fetytls2emnms (4 renmo oodlmDeauvo t) 2toxmpnu1lltnlfvtlsfa2rru pnu4aet ifciyd s ul( s;t4 rtrxr3tydla eaivi;()s2tmio iy1lpeemncsatfsrrru p;u0apx if3iytfa rm(mon(4tlxrmo tadlpDranvil()srxmxrpio4optnlieta(  Dtm(m ot4oetomf3iadlsDea(vp u0alermfcoytfm  aieo;s0s2triopny4ol   ncsls a2tr(mpoo0alxniiciyd mDemuvs (0areoio3oydlaDeaivs ()s2urxo oudlmtnliviltfsrumx ont0ole ifciatlm ulu s;() lxnio3todopDeauvs;s0 2xoxmpnudoltn ncil(  Dtrx p;t1tltnmi3iadls2emuvont0aexnxo iatfpDr nvo;(0teto(r3io4lmen ict t  2rrxm ;u4apto o3iyd sDeln pnu0trtnio3to1lmD auvs (0setmxopoydal n nctat  2ra(m ou1apxomociydlsDrmu o;(0artnifciy1lmtranvols)s2xmxo ny4ol e ics s sDumx  ;o0opxoifctyd s2el(msnt)artrmf ty1oaDe ies t)texoxo3iu1lme mfcsl()aDraur ou4aleomociasls emu s t)tlenxrcootop e ivs t sexo(o nodamtnlfetl()aDtrxm ou4alen i3iysls ua(vo u4tetnif oodfmDrauvi;( setoim oudam n nvtat)aDumx  ot0oeeomiciasla2raums;u) etomr io1oa e ivo;s0t2xoxo iodole lnetlt artm(roou0oeto feiatlm2rlumpnt4artnif iodlpt luvo;s  2xoxm3ny1ol  mivtatfsDumxrooo0tlenii3tas m elump;t)alenmr3oa1lmt  ivo;( seuoiopio1apee icsa() rraxr ;u4teeoifciad s uanms;t0texrirctadlaDeanvil()t2xr(r nodom n fvi (fa2uauroou0aee  o3iasls eanms t0 etoxf3tydfp e nei (0 eto(opno1lm nlfvil(  2um(r oo4olenio3iysfaDrm(vonu4alxoif ta1fp  auvi ()t2um(m nudal nlfvtas sDtmurp;u0tlen fctatfsDrm(vonu) ltrmrcoodfaD li o;t0srtrio3iodlm   ieias s2urxm ;t0tleoio3tlt a2rauvp t0treoxo3iatfaDeluvilt trxoim ny4op e ivtat) Dtaxm oo4altnmicilt mDul(ms;u0altnir totoaD  ieo (0seum(o3iu4ap emiviat) rraxrpnu4oleo fciatla2emu onu4alxnxf3ta1la elnei;t)s2xrxr ou1al   ncsat arur(mooo0olxo iciyslm2elnmon(4aeeoiocoo1laD an ols0seurxm iudom n fetls aDraxmpou4olxn fetys aDrlumonu4artoif ty1faDrlnvol(  euoir iy1lmtnmneilt)aDta( o;u0openioeils m2uluvo u4texrxf3oa1opt  ies;t srtm(rpno1oltelivt ( sDra(ront4oleoii3tat a emnms;(4 rerxfcoo1fa r nvil()tetmxmpoydllt licsa(fsDrrumoou4olxo fciydfm ul(mo;u) lenxf3todfpDe n o ( tetmxm iodllte nvia() 2rruro;u4aptnioctytfm2em(mont0arenmo3oytfaDeli o;t)s2uo(m3iu1apt lfeils a2rmxrono4openmiciyt s2rmumo;u0areoxrcoatomDrlnvil(0trtoxopoo1om emivsa()srumu pno0aexomiciat aDumn p t4tltomr to1laDelneo s s2umxmpno1amte ietat)sDumx onu4opxoii3tld a ra(vsn(0tleoifciadfpD livi s)sexrxmpio1openliet t)srtru p;o1optnmfetasla2rmn pn(0tlenxfcta1faD li s s)trxr(o3no1ame mies s srtmurpnt4oee  i3tltfa emu pnu)texoiociydfaDelieols) rxrio3nu1llen fvilt sDrmump;o4olxnioetasfs rmumo (4aetomo iytlmtelivi t srxmim iodal n nctas) Dum(mooo4tpe  feiytfmDel( s t4artrxrctotlptrlueolt0srtmxm3iudamtn iet (f rtmu  ;u4alxnmoeilsfsDul(vp t4altrmr3ty1fatraivs () 2urxr3oy1lpe lnvs tfaDtr(r ;t4alx ioctyt m em(ms u4 rtnxr iatoaD  uvslt tetmio oudopen fciat srrr(r ;t1olxo i3ilslm uln o u)aexriocootop   i s t)trxmxrpnodlpe lnvsa( a2rm( pou1olxomietatla el(vpn(0altnmf totfpDe ivi;t)t2toio3nudlp e nvtat) rtaxm oo1aptn ieiad a2rmuvpnu)arxoxfciydoat  uvo (  euoxo3no1lp elies ( arurxroou0aleoifeild aDul(vp u4trtnmf3oa1lpD aueo t)setmxmpou1lpeemfvia()a2uaump;u4alenmfcild m2umumsnu) lenxrctydlmDraivo t) eum(m io1oltn ici s)a2umxmpot0tlx iictyt mDemn o (4arxrxrctytfa eaiesl(0s2tmxmpoo4lp nlfvi (fa2ra(m nt0tpt mo3iydfm2um(vo;u)artrxrciotopDraivs t0 etoirpnu1lpe lics sfs2urxr ou4aeen oeiltlmDul(mp t0aexrmr iodfpDr ies (0t2xmir nodaptelfcia( aDtax  oo0oleoifeiaslaDemuvp;t)aeenircoadfmteln slt) 2xm(m3oodamenlfctls  2ta(moot4tptniictadls2elu o () ltrir3tydfa eaueo;s0trtoir3iu4lpeemnvtls) 2uaxmoou4aet  o3iatfa2ua(vont)aetnif3tatfpteanvils)teto(o iydoltelnvtlsfaDtmxm ;o1ope  f3tytfsDemnmpnt)trxriociydlm  livi s0sexm(m3nydomenlfeilt)s2trxmono0tlxo ociydfm rmuvp;u0texnxrcty1la  ai ils0 2tm(r oydlptn fcilt  rumu  oo4apeo feiytls rmu s ()alxomf ta1lm e uvs;s) 2xoirpny4al  mivtatfs2tru pno1alt mociysls uluvs (0aexrxociy1laDrlnei;()texrxo3oy1lptemfvs t s2rm(ro;o1tpeomi3iyt s2rluvsnt4teeoxrctotopDr ieols s2xrxopiydom nmiviltfaDtaurp;t4olx mi3iytfa rm( p;t4aetnir3tadfa eli i;t0t2tmimpoydop n ncs t srur(  ;u1tlx miciadlmDeaumo u)altomr oytlaD livil( texm(r3io4lm   iet ( s2rau ont0openmociatfm rm(ms u0 leoxo3oydomDe ies ()trumio3nu1ll n fctl() 2rrxroot1oltomoetltfs umn onu)alerir3oytomteluvs;(  exoim3no4amtnmnvsat)s2um(mpou4oexoiocils a2eauvsn(0 leoifciodlm   iei t0texm(m oo4optemivta( aruax oou4teenmoeiltlmDra( p (0 ltrxr oo1fptr n i s)t2xr(mpoo1ll e nvias)sDtm(mpot0tpenmo3tat mDumumsnu4 ltomf3iodlaDr u s t)tetm(o ou1lmeemnvsa(f 2urx ooo1altn oetld s2rlnmsnt0 ltrmrcoatfpD  i s;t)trtrxm oo4omte nvta( a2tm( pnu0opeo fetltfm ua(vp (0tltrxf3oadlpDe uvi;s)srxoim iy4lpeemneta( aDur(rp;o0aexniicildfm umuvsnt4tlenio iotfpt  ivi s  exr(opno1lmen fct tfa2rmumoou0tetnmociyd a umu o;(0 ltrmf iy1op   i i;t)sexmim iu1am  lfct ()artmurpnt1olt  icilt a um(vs;t0trtoir3oodopDrluei;s trurio3oo4altnmnvtls  rurx o;t4aee  ociatlm2ulnmpn(0 renmo oy1late nei;( t2urimpoo4ome lietatfa2tau p;t4tetnmfetlt sDumumpn(4 lxrxrcoo1fpDeau i ()t2uoxopno4altelnvtas artaumo;u1tpe miciytlaDeanvo;t4aetnmrcoodoateanvs (0texm(o oodlm nmfei s)artrx  nt0opt  f3ildls2eanvo;t4 eeomr3tytla r nvsls0 rum(m3ou4al nmivs t artaur oo1tltn o3iysfmDemnmo (0trtoif iotomtelneolt)seumxr iy1amtnmieilsfartmx  nt1aeenmo3ildfs2eauvsn()alenir3oy1fatr ivi;s)srtrim3iu4llenlfeia() 2ta(mpoo0opeo fctydfaDumu o;(0tlxoif3tatlpDe u s t0 2xmxm3oy4ameemivi tf rtaumpnu0oltnifetytfm2emuvp;(0trerxo3oytfpteanvsl()t2xoxo iu1olee iet tf Dum(mooo1olt mociysfm uluvonu4 etrmrcootfp elueo s)teuo(m3iudaltemncsls) rrm(  no4opt  f3iytfmDuanmp;(4 exnif tytfm   u o;t  rtmiopiudoltnlnvi s srururpot0aet ifciyslmDuaumo;u4tltrxf3oytlm e uvo t) eto(opoy1omen fvias)arrm( o;t1alenmi3iys aDua(mo (0 eeoioctydlmD  u ol()s2trxr iydlme lietltfsrtaumont1aee io3tat m eaumsnu) lenmf3iytoatr neilt) 2tm(r3iy4ope  ivt s s2tmum no1tpx iociad mDumnmsnt0aeeoir iy1laD li ils0t2xr(mpnu4ap   nes (faruaump;u0aexo oeiatfsDrmn s t) reriocoy1fmtelnvil()trto(rpiu4ol emfcs tfs2rauronu4ole  fciatfa2um(monu4trxoxr oodopD livslt)tetoxm3no4lmtnmiesa()srum(ro;t4aeen fciyd s ea( s;(0texoxr tytfpDeanvolt seuoxm ou1alt  fvtls s2trxmpou0aptnmoetas mDrm( snt0 rtrxr3oydlaDeaues t)setoxopiudoptnlies s sDta(m nu0oeeomo3iadfm eauvon()trtrir iatfpDrlivi t trxmir3io4amee feias  2taurp;t4opx  ictld aDean snt4aexnmrcto1oaD  uvs;() exrxm ny4op nlfvils)a2um(mpou0tpenmo3ildfa elnvs;(4aexnxociydlmDr iei;t)tetr(r iydlm emnvslt)s2tm(m ot1alxo ociaslm uaumsnu0 renioctytomD  nvo;t sruoxr iu1ll nlfcsat)arrr(roou4tptnii3tltlm ulnmo u)tltoxociodfat luvi t setmirpiu4ap nmieta(f 2ta( pou1tlt mi3tatla ea( p (0artrxf iatfpDr n ols)sexrio3io1lpte fvsas)a2ururpou0olxnmfctytfa umu on(4 ltoxf3oadom rau sl(  2uoimpny1amtnlivi s sDumumpno1oetn oeilsls2rmumsn(4tleriocta1fm   ivsls0 2xmxopno4amt lnvt s)aDrruroou0optnii3iys m ea( o u)trenmr oa1la e iei;s)teum(m oodamte ivs (f Drm(monu1opeo fctltlsDem(von(4tetnio iadoa elivi s t2xmxmpno4aptnlfesasfartm(mo;u4olen oeiys s2rlump;u0 renmo ty1lpDelu o ()t2xoxm ny1optelivs t) Drruro;o4olto i3tas s2ulnmpnt0trxomf3oy1laDeluvi;t) eto(rpnydop  miciasfaDraxr ;t1opeoif3iysla em( on(4tltoxociydopDelneils)truo(mpoo4lptemfvil()s2tmxrpno4teeomf3tydfaDeau s t)aeenxr iotopDelu s;s)s2toxrpio4olee ici ( arta(mpou4tetomfciasfm rmumpnu0trxrxfctydla eaiei s s2xrio3ou1lm emietltfaDumx  ou0oeenmi3tatfm emnms u) rxnmf oo1fmDeau s (  2umxrpoydamenlfvilt arrrum ;u1tex micils m ua(mp;t0alenmr3io1lmDeanvo;() rtr(mpou4amt  nviat)aDum( p;o0tex  f3iytfs2emu s (0altnxr oytlp eli o;( s2ur(r3nu4ll elfcsl( aDraxm ;o1alt  i3tatfa rmu snu4 rtnir3oytomDrauesl(0 rxrxo3oudlptnlieiltfaDtr(ro;t4tltnmictysla umuvonu0 leoir3tytfat li ols)seurxmpiu4apen fvslsfa2tr(mooo4alxo feiysls2elnmp u) leoifcootopte ivo;()s2xoiopio4omen net s)srraumpot4ale mf3tysfm2um(vsnt0tetoio3tydfmteanvo;t)srurirpiy4lptnlicsls  2ua(r oo1tpt mf3iatfmDemn p u0 rerif3oatfa e nvs;( srxr(o3nodll  lnvi sfsDur(m no1olenmi3iad a uln o u0aeeoif totom  au s;(0srto(r3ny4alt lies t)s2rrxrpnu0oee iiciyt s2eluvonu0aexnxr ta1optr nvols0 euo(mpnodlp elnes s srumu  ot0olt moetytfs uln pnt)trtnmf ta1faDrai slt trxo(o3ny4amen ivtas)artaurono4opxoio3ildlm rauvp;() rermfcty1lmDr ivi;( srtmxmpou4lmt licsasfarrru pnu0apt mfeiys a2umnms;u)tltnifctydlpteai ols0t2xmirpnu4ll n nvia(fsrurxmoot4oexnio3iltlm2ra( p;(0 leomo3tatlmt  ueo t s2uo(m ny1apenlicsa(f Drmxmp;t4aleniietys aDea(vo t4aeerxfcoytlp  an i;t0setoir3iy1llt mfesls aDtm(mp;t4oee mi3tat m eauvo;t0artnir oadlpDrau o;s0 exoxrpio4llt mfcsl() 2taurpnu0teeoifetydlsDelump;t0arenirctotomDr i olt)teto(m nydlltemivt ( s2tmx o;t4oexnii3iatfs2rl(ms t0altnxr tytomDe uvil(  euo(rpiydlpte fet t sDtru ont1oeto fciltlaDelnmo;(4aetomrciadfpDelivo;t texmxopio1ll   ivs (fsDrrx  ;t1aee iiciat a2emu s t)altoirctotfm   n olt) 2ur(r nu4lpeelnvilsfaDuru ooo0tpeomictadls em(vs;u0 eenxf3oodlpDr nvi;t srtmir oudalee icilsfs2tmur nu4aee ifeild sDumnmo t0altrifctodoateln sls t2xoxr ny1lm  mivi ( sDra(mpnu0oee if3iysfaDea(vsnt0 lermfctydopD ln s;t)s2xm(opnu4lpee ivtas  rum(mp;o1apxo o3tydlmDumump u0 exnif3ta1latean il(0teumim3io4olt mivsas)a2uaumpot4aptnmf3iadfaDeanvo () rtrxfctatop ranvs;t)sexm(mpnodal  mfci (f Dtaxm ot1tpx mictyd s rlnms (0arermf oodopDranvolt) 2xo(m3io1amt lies t  Drmum nu4aet  fciatls2rlnmo;t0teenio3iydopDr nvi s0t2uoio3oo4omenmict sfa2urxmpno0tltn feiltla2uluvs;t0trxrmo iotfa  auvs t) etm(m3oydolee ivtl( sDtaxrpnt0oetniiciltfs ra(mo t4 lxoif io1opDeli sl()s2xr(mpiy1oltnlicils  rtm(mont1tex iiciydfa em( o;(0 lxnifciotomD  uvs t  exoxrpnodomteliviasf Dum( o;u1aet mfetat mDuau pnu)alxrmr iytoaD an s;t sexoxr iu1omtnmnvil( aDtax  oo1tltoif3iyslaDrlnvs;u) reoir iy1fmtrlivo t texo(r3ou4optnmnvsa(fa2ua(mo;u0olenio3tad mDelu s;u0 renmf iodfate u il(0 2uoxopio4lltemivia(  Dua(rooo4oexomo3tadlmDrmnmsnu4texnmf oo1oaDe i s (0srxoxm oudal nmnvt (fsDua(mpou0aee ifciltfm2eaumsnu0trxoir3tydopDelnvi ()t2um(mpiydll elici t  Dtr(rpot1oeeo ictyt m2rl( s t4 eeomr3oydfatraivi;t) eumxr io1ape mncs tfaDuau pnu1ole  o3ildls umnvs ()artnioctadoa r ivsls  ruoxmpiudll  lietls)a2tmuroot1olt ifctytla2rlnmp;(0 rxrxr oa1omDr i ils0 2trirpny1llenmncslt srtru pno4apeoifcilsfa umnvon(4tlenmr3ty1lpte uvil(0tetr(mpnu4ame lncils)arrmu pnu4aexnmf3iadlm emnvs;u)trtrmf3oydfa rlu i;s0 rum(m nu1opee fvtls aDtmump;o0alt mf3tyslmDuan onu) lenmoctadoateanvo ()seumxo3ou1ap nmncil( srrmxront4tee mieiasfm2ran ont0 eenxf3iadfate n i;t srurim nu4lm  micils a2raur ou1apen i3iytls rmn s u0 ltoxfciy1op  au o;t sruoir3nudlpte iet sf rrr(r ;o4alxnif3iytfs ra(mo;(4altnmr3ia1oaDr i ols)teumxo iydal   fetlsfarrrump;o4oleoifeiytfs2uanmp;t0 eerifcoydlatr uvols0t2ur(m nodaptnlivsl()artrxrpnt1tle  ieiytfs2ulumsn(4tetomf ta1oaDeanes;(0t2xo(m io1lmeemfei t  Duau ooo0oet mo3iysfmDumu s u)trxnxocta1lp  auvil()trxmim3ny1lpee feias) Dumur ou0tetnmf3iadlmDeaumpnu0aetrxo iy1op eli i;s0 exmiopoudame lfeta(  Dtr(rpot0alx ifeiyt m rl( s;t)trerif3oytfmDrln s t) eurxr3oudlltemfetat srtrxr ot0oltnifeiatla rl( o (0 exrxrcoa1oatr nvi s) rtm(opou1om   fct ( arurumooo4oeenii3iytfaDean o u0 lxrirciatlptrlivi () 2ur(mpnudopt  fvtltfarta( o;t1opt  o3iadfa2umnvsnt) lenio oa1opt  u s t trurxrpnu1omtnlnciat  2um( pnt1apt mfciyt s rm(mont)tlerxf tydfa   nei t)srtrxo oo4op  lfvslt  2rmxrpno1alx mictyt mDeaump;u)texnxr3iatlaDrli o s0 eurxmpoo1llenmfvsls  rur( pou4alt mfetlt a2umnms;(0aexrxf ty1oateaivs ( srxrxo oydame mfvs s aDta( pnt1texniieiyslsDemuvpnu0aeeomo tadfptr ieilt0 2tr(r oydlm emicta( aDum(m ou1oee  fetatlm2ra(msnu)trxoxr3ootopDraneo s teuoxm nodolee iciat artmxmono1tlxnmoctyd s rmnvo u0 lxomfciadlaDelueols0 2xo(o iydoltn nvtat)aDtru ooo4alt mfcildfsDumu snu4 etomf oo1lpDe i ol(0sexoxo oudamee ivs t) 2rax p;t1aetnmf3iysfaDrmu p;u4 rtnifcta1lm rlnvi s0 euoimpoydlm n icia()a2rmumonu4olx mfeiatfmDelnmp;()teeoifctodfmte n slt) etmxr nodamtnmfeslt) ruau  oo1olxoiiciytfmDulums;u)texrif3tadfmDr u ilt0s2tr(o nu1lltn nvt tf Drrxrono0alenifcildfm2umumsnt4 etomo totla  auvilt seur(rpoy1llte ivi t)a2rax  oo0aexomo3iad mDuln snt4 eerxr3totlaD luvi ()s2uoxm3iy4alt mivs (  2taxmoot0tlx iieiltlm eau p u0aetnmfctydomt  n s;t) ruoiopou4al   feil() rumu oot1oetnmo3iytfa el(vo;(0trxomfciydop  au s;s)tetrxr3oy4am nmicsat) 2ta(m ou0tet  fcild m2uaumpnu) exniocoodom  an sl( texmir3nudaptn fetls  2um(  ;t0teeo icilsfa2uluvp u4altnir3iadfaDrai sl(  rtmxo nu4ap   fetlsfs2urur ;t4olxomo3ilsfm2ea(mpn(0 ltomrcoa1lm  aneol( setm(o3no4lmt lfes sfartaxmpot4tptomociyd m2ranvsn(4tlxrircoatlmtelivi;()t2um(o ou4apee fcs t)a2truront0aee  i3tyt s2em( snt0altrmr3ia1omDeau o;s0teuoiopnudam   fvtltfs2raumo;o4opxnmo3iyd m2ul(vo t0aexnmo3todop rlu i;s0srto(r3iudlp   ivsl()sDrrx ooo4aetomicildfa2rmnmp;u4tlerxo iytlaDelueslt)srtmxmpnydoltnlnct t srtr(rpnu0tlt ifetasfa2ul(mo;(4altnxrciydfptrlnvils) 2xrxmpio1alenmivsa()s2umumonu1apeomictadlm2umu pn() rxrio3oytopDe n il() exo(mpio4op n fvtat a2ta(ront1opto ieildla ranvon(4 exnxf3oo1omteauvi;t srtm(r ou1lle  ies (fsDur(  nu1aeen octatfs2umnmo u0tlenmr to1op elnvs ( trur(rpiudoptnmieilsfsrtm(  no0oexoio3tatfs rmu s;t) rtnmf3ty1la   neols)setrxr iudlmtnlfet s  2uaxroot4tetniieiad a2umnvp (4aetoif3iadoat aiesls0trurxr3io1ap e fei ( sDrrurpnt0tlxoiieiyd sDulnvsnt0aleomo io1omtran ils s2trxo3nodop nlnes s)aruaxm ot0aleoiocilt a ul(mo;u)tltrmf ia1laDrlivo ()s2toxo3iudol n fcsa(  Dumx  no4opxo ieildlm2emnmsnu0tlxnmr oytoa ran o t0 etmxrpnydoptnlncsat)sDta( o;u4oeenmictytla2umnvs (0 rxnirciadlaDrlueo;t0trtoxrpou4amt lici ( aDumumonu0oetn fciyd a2ul( o;t)alxnmrcto1la e uvilt)s2uoxopio1ol emfct ( arrrx pou1aptoio3iltlmDuan p u)trtrxrcoatfm  luvo;t0trxoxo3oydaltn ictas) rrmx o;t4apxo iciadlm rmnvs t)alxomr3ty1laDe ivs t)trxm(m nu1lpte fcils) 2trxm ;o1olt  ieilslm2um(vp ()tlxomf oa1latrauvil(0trumxo io4ll n ncil(  rrrxm ot1tlxn fetydfs2rlnmsnu0tltnirctatfaD lieol() exoio oo4optn ictls  rraxmpou4texn o3tadla el( p;(4arxnxo3oy1oateln ilt) exm(opny1lp   ietasf rtm(mpnt1alxomi3ilslaDemuvp (0aetoifctatfaDeaivi;s0srtoxr ou1alenmfetl()s2ur(  oo4olenmiciatlm2rluvs (0arerxf ty1lmDranvs s s2xo(o3iodol nlictlt)a2ra( poo0tlto fctyt sDuanmsn(4areomo3oa1omtr uei t0 rxm(m no4lp  mnetls) Drm(rpoo4teenifctltfm ean p u0alxoio iotlpte nvi;t)trtrxm nodlme lncil()aDua(m no4altn f3iltfm2rlums;() ltnxrcia1fmt auvs t) 2tmio3iy4lptn ici s sDrmu  ot4aptn o3tysfm ul(mo;()trenmfciodomD  ieol() ruo(opoo4aleelneia(fs2um( o;u4olxoiociytfa ulnmsn(4arenirctodlm e uvsl(  euoxm oudoltelfeia( s2tmx  ot4oexoioeiyt sDrl(msnu4texrir3oa1fp eli s;s0teumim3ou4lme  icia()arururo;t1tpen fetlslsDea(vs u0alxrmr iotlpteluvs s)truo(r ou1om emncsl( a2truro;o0tlto o3iad m rl( o t)aetrmf iy1oa elu slt  exo(rpnydll emfvt t  rra( p;t4tee if3iyd sDem(vpnt0artrir iatfaDeau sls0 etrir iu4ll   ivsl(  Dumxm no1altnmoctad aDra(vont0 rtnioctatfpD luvo;s)t2uoxm iy4lmee fctat) 2uax p;o0aptoioeiatfmDumnvo t4 rxomfcia1opD  u ils0tetrim oo1ap n ncslt)aDrrurpoo0tlxniietlt mDemnmo u0tlxnmf3todfmtraueol()srto(opiodol nmici (faDraum nu1tetn i3iad mDemump;(4 lenirciodfat aues;() 2tm(rpiodlp emfvs t a2uax  nt0olen i3iasfs2rmu ont4 rxoxr oo1om  livo t) rtrir ny4aptn fei tfa2umur ;o1opeoif3tatlsDrl( o;(4 lerio3ia1oa e u ils srtmxo3oy1opee feslt)artrxr ot1tpenif3tldfa2um(mo ()areomo3oadfpDrlnvol( t2umxm ny4lm elfesa()a2ra(mo;u1teen fctls a2eanms u0 etrxf oydla rauvol(0 rxoxo no4ope lnvt t  2rau oou1optn fctad aDrauvsn(4trtrif iatf
\ No newline at end of file
@@ -0,0 +1 @@
+uvilt0srtmir ou1ole licsat  2raxr ou4apx mi3iltfs2rmn p;u4 lxrxr3oatlmDr ivsl(0t2um(m3iu1olen ictlt aDumumonu4alx ii3iydlm um(vo t) ltoifcio1lm elivo;t0s2trxopiy4lpt  fcs (fs2tax  ot4opxomfciytlmDem(mon(0trtnmo oadfmD ln o;t)s2xm(r iy4lpt  ivsls) 2rax ono0alen ociyd m2rluvp;u4alermf3tadomD lies (0t2xrxopnudlpee nctlt s2ur(mpou4tpe iieiytlaDem(msn(0 lxomo3ia1oaDe nvi;t  2uoirpno4llte nvil()s2ururont4olt mf3tldlm uanvo;u) lerxrciytopD an i;t t2xr(m3no1alee ncslsfsrrau p;o4olx  i3tadfaDrm(ms t)aexnio io1fpDean i s0teuoio3oydlmteliet (  rurumont1tlx  oeiyd m2uaumsnu)aetnmo3iotfpt anes;s0srur(mpiu4olt liciasfs2rmurpnt1tetnmf3iytlm rau o (0alermo ta1latrln i;s setoxopnudam e ivt t) Durx poo1apxniocilt m2rl(vp t0texomr ia1latr n o;t) 2uo(m3oy1ap nmfvsa(faDrrx  ;t1optoif3iatlm emnvo;(0artnmr3to1fpt lu o s0setriopiu1ol n ivs ()aDrm(root0alx ifctyd mDrmu s (0aetoxociytoa rau o t  rtrir no1am  lncs () rtru  nu1teeo iciatfs rluvsn() eeoxf oodlate nei;(0 2urxrpou4opeemfvsl()a2raumpou0open oeildfs rau s t)tleoir3oa1lmD anes ( trumir3oo1ame  neia()s2um(r nt4tle ifeiyd m2ulnvpnt4 lerif iy1fpDr uvi (0 eumimpno1ap nmicia(farrr(mo;o4oltomiciad sDuanvo u4arxrmf3oatfpt aivi;s0t2urio3iy4ol emies () Drr(m ;o4tlx  ocilsfaDraumsnt0areoir iytlm r i s;t t2xrxr3iudlle  icsat srtax  nu4opxomociatfmDrmuvp u4 lxnmf3iadfm elivi;s  euo(o3oudoptnlfvs s)a2tr(rpou1olxn oeiydfa2ul(vp;u0tlenio tatlmDrlnes;( s2tm(m ou1op elncil(f rraxr nu1tpxomfetltlaDra(vp;(0tleomfciytoaDrli sls) ruoio iu4olt micilt)aDtau p;u1oexn oeiltfs2eluvonu4arenir3iodopt  neo s) euo(m3nydameemivsl() rrmurooo4opxnmf3ildlsDemums;u0 lxoxr oydopt auvs (0seuoxr3io4ll elfcs () 2ur(ront4texnmf3iyslm2rm(von(4 etrxo iytlp   ies;s t2tr(mpny4lp   fet t artmu  ;o1texomf3iytls ulu p;t4 reriocta1omtrlieo;t0 2umxr oo1am nlnvt (  2raxrooo1tltnifeilt mDrl( snu0arxniocoodlatr uvsl( trtoim3no4lptemnesa() Dtm( p;o1apx ioeiasfmDra(vs;t0aetoxrciy1oat  ueilt texmxo oudole liei tf 2ur(ront0tpxnmoctas sDrau pnu4 exnif iadlp  aues;t truoir3ou4ll elfci (f Dta(ro;u4apxoifciysla2ua( pnu)tlenmf io1lpte nvols)srumxr3oudale lfvs t)a2rm(moou4tltnifetadls rmnms ()trxnmr iydom  aivs s) eum(o iodamt lnes tf Drax ooo4alx  feils s emnms;(0 ltoxr io1op  aues;s0 2toxopnydlle  netl(f rrmxmoou4olt mfetltfm2emnmp;(4altnifcta1lp r ues;t trumio3oo4omenmfesls) 2rmumpnt0alenioeilsla ran o;u)alxoir oo1lm raivi;() 2urxm3io1al   net sfarur(mpou4tpeo i3iydfm2emn s u4 rtoifcto1om eai slt)t2xoxopoy4lmt mfciatfsrurxmont4tpt iociysfa2raumsnu)aetrif3oytfptelnvo s)s2to(m nu4aleelfcs sf 2rrx o;u1apt  o3tadlsDrauvonu)aetoxr oydfpD  n s;t trurxr3nodal nmnvi ()a2tm(mont0tpeomieiaslsDuaumonu) lenmrciadomt  n sl( teuo(o3iu1lptnlnctls)a2ra(mo;o1apxomoctlt a2rlu o;u4trxoir3totlaDeli i (0teumio oodol emnesas a2rr(moou1apx ifetldla eauvs;t) rtnir oo1fa e n sl()seuo(opoy1apt  icta( artmu onu0olxo octytls uan o ()aexomo3iodfaDe nvo;()sexoxo3nydomtelnet sf 2tauroou0opxo ocilsfsDulnmsn(0teeoir3iotoa  lneslt0 rtm(o oy1lle mivsltfsDua( pnu0texo iciadlm rl( o;(4aexrmrciadlpD  uei t tetrirpiydom  lnct sfs2rau onu1opxomoctlsfsDuanms;(4 rxrir3oodfpDr uesls) rtmxr io1olt miesl(f 2rrxmont1tee ioctytls umn o;()aleoxo ia1lm  lu s;s)t2umiopiu4lp nlieia(fsrua(mpou1apxoif3iatlm2ran o t0 lxoio iytom raies t)s2xmimpnu4ol  mnesat  rrmum ;u0ole iieild s2uanmsn()tleomo oytfmD lnei;s tetmxr3oudam nmivi s aDrrxrooo1teeomf3iad aDel(mp;u4altoxr3iytfaDelivols sexoxm no1lpt  nctlt) rrmxrpot1apxn i3tltfsDem( p;()arxrxf3iytfptraneilt0tetoxo3iydlpt  iciat  rtmxmpou4oltoifcildlsDrau snt0 eeomf3io1fpDrlnvs;t0 2toxr oydope mies ( s2trxr no0alenmieiyslm2umn p t0trxoxo iytom rau s;s) rtmir ou1amtnlnvsat)arum( o;u1opt  iciys aDul( snu0 leomrciytoptr u s;t0 rxmxmpio4lmenmneil( srurxmont4tetnmoctys s2rlu onu)altoio oydlm  auvs s)truoxm3ou4lpe miesat) Dur( o;u4ale miciytls ra(mon(0aexnmf iydopD lnesl(0 2to(o3oo1ll   nvs s) ruaur ;o0apxn ietadlm umumsn() eeomo oa1fpt au i;t0srtr(r3iodalt  ici s  Draxmo;o1texnmo3tatfm ranmo;t)trtoifcoy1laDr ivs s0 exoxrpou1ap emncsl(fsrur(rpou4tpe  ociytlm um(mo;()trenxo todlp  aivs s0 etmim ny1alenmfcta(fsrtaxmonu0tlt moeiytfs2umnvo;(4altrxr oa1om   ivolt0t2to(r nu1op n iet ()s2taurpnu1tlxomociatlm2uluvp t0 ltnio totfmDe i i;( t2tr(r3ny4lltnmivtl() 2taurpot4tle ioeiyd mDrl( snu0aetoir oodoaDraneo t0sexoxmpiudome lnetat sDurumpot0tpen f3iyd mDranvs;u) leomr3iodfa   nvi s s2umimpny1lle lnctls sDrrxrpoo4aee mietlt s uluvp t0arxrxr3tydlp  livil(0srtmim3ny4lmtelicsas)sDtm(  ;u4tpt mi3iyd a ean p u) etoiocootfm r i sls)setoimpiydop elfcil()a2tmumpnt0oex moeiasfm2rl(vsn(4 lenmrcoy1laDelueo;s)t2trir3no4optnlivils sDrm(ronu1ale iieiadfa2rmu s;t) rtoif ty1omDr i o;t)sexrim3iy4lpt  icilsfa2uaumoou4aex  ietatfsDem(mpn(4aleomo iodla r uei;()s2xr(r3ou1lmeemfes s aDur(mont1tlt iieiaslaDeanmsn(0aetoio3to1op   i s t)t2urim nydalt mnei t aDrrx  no4aeeoiocilt s2umnmp;t4 exomf3ootoaDeluvs;s  rto(r iu1lmt mnctlt sDum(m no1alxnif3iatfmDraump t) exrmocto1la e neo t0s2um(o3oy1optnlfvia(f rtrur oo0tetomoeiytfs emnmp;(4 exoxocoadfpD lnvo;t0t2xoio3nu1lm  mncta(f ruauro;u0teenif3tadfs umnvp u0 eenmocoatopt li i;t t2to(mpoy4apeemies (faruaum ou4olx  feiad a eanvsnu)arxoio3iydopteln s (0trtmxrpiudlle licsa( sruau poo4tpe iociydfa2ua(vo u4 etrifcoa1laDr uei t0 rto(m3ou4lmte fetl() rumu  nu4texnmi3iasfmDuan o;u4texrmo ta1opD aiei t) eum(o3oudlmt miesl(  2trxmoou1tpxomfctls a2rau s u0 leoxocoatoate ieslt0texmir3ou4amtnlies sfsrtrx p;u1teeomf3taslsDrm(vonu) lxnxr3ia1omt anes;() etr(o3ny1llenlnetlsfa2umu  ;t0tptnifciydls2rl(vo;(4tetrmo ia1lp rau ol()s2toxo ny4al nlivil(faDrau  ot4ape  oeild a2uanmpnt4 exoxf iytfmte nvo s  2trirpiu4al nlicta(f rtax  nt4oexo ictltfsDra(vs (4tltomocoadoateluvs;() 2xo(m3iu1op e ies ( sDtm(m ou0tpxniicilt s uan s;(0aleoifcia1fpteau o ()s2uoxo iu1ol nlneils s2rr(rpnt0apt mictadfa rlu o u0arermo iotomtrlneo;t)t2tr(m3no4op elnvia(fsDta(m ;t0tpx mi3ildlm rmnmp u0aeermocty1latelnei (  eurimpnudapee fcsls  Dumxr no4olxo f3iad m2eanmsnu0alxnircoo1laD lu s s  2xmxr3no1ope mici tfartmump;t1alxnif3iytfaDranvp u) renxoctytoaD au o;t setm(mpiydlmtnmivt (farurxrpoo0oee  ictlt a2elu sn(0 rxrmo3oytopt lieslt0teum(r3nudllenmivsl( a2rm( oou0apt mfeiadlsDul( p;t) rtnmocia1lpteai s (0seum(m oudom e ivs s a2rmx o;u1aetnio3tydlm rlnvpnu)arenmr3iotfmt anvols0trtriopoo4olenmnvils) 2rau pnu4tpxn oeiltls2rau s u) ltomrctatlpDrluei s t2tmio3iu1omtemnvtasfa2tax ono0tpeoiociatfsDemumsn() lxoxo3tytomD au il( tetrxm3io1lm nlnvsls  Dra(ro;o1ape ioeiydlm elumpnu)altomf iodlm elueo;t0 2xmxopnu1lp emnci s s2ta(rpot4olto feiydls eanvpnu4tetrio tatlp e ieil()s2tr(o oy1ale  ics () Dum(  ;u1tptoifetldls2emnvs u)trtnmo oadlaDeln o;t) rtoimpnudom e nes tfa2rrxm nt1aexoif3iyd mDulnvp t4trerircta1op rli s (0s2tm(m nu4llee ivt tfs2rax  ;u4oleo f3iat s2umn o (0arxomrctadopt aieo;()seuoim nudlltelfesl()s2tau p;u0opt  o3iasfs2rm(mo;()aeeomf iatlmDeai sl()s2uo(m iu4alenmnvt sfsDrmu poo0ape mf3iadfa2rmn snt) eeoifcoatfmD lues;s s2xoir iu4olen iesl()sDrmur ;t4tee iieiydlmDra(ms t0 rxomr iytoaDeauvo;(  exmxm no1aptn ivtl(  rtau  ;t1tlx ifetas sDra( p;()artrio3ootfate nei;(  ruoxo3iu1lmtnmicilt)aDra(mono1tlx mfeiys mDuau pnt) ltoio3oa1fmt an i;t seumim3iy4om e nci sfsrtm(mo;u4tpe mi3iydlm2rl(vo (4trtrmfctodfpDrlieil()t2xmxr oy4lp   ivtlsfsrur(monu1tptnmo3iys sDeanms (0aeerxf oatlmDrln ol()s2trim oy4om e nvslsfaDtrxr ;o0oee mo3iysfaDrluvo;u)teeoifcta1omte nvo s0 2tr(opoy4aptelfvtat)aDurump;t0tltoiiciys a2ua(mo (4trxoxo tydlpDeaneo;s teur(rpiodlp e ivtatfaDrr( ooo0tpe iieias mDrauvs u0areomf3ta1faDran s ( t2xoir3oodal e fcil(fa2ur(ro;o1oetnmfciyd a2eauvp;u) etnir3todlateanei ()t2xrxm3iy1ap  mfvt (f rtm(r ;u1opto fctytfa2rluvon(0trerxr3tydopt anes;() 2toir3no4ll emivils  rurur ot4texniicilsfs2ra(vpnu4 lxriocootoaDe uei;( trtm(m3no4altelnet s)artaurpnt0ope mi3tas a2uaump;() ltoir ootomDe nvslt0 etrim3nu1lle  nviat) rtaurp;u4tex  fetldfm rmnmp;t4alxrmfcia1fpD  ivi ( seto(r3iydlmenmivsa(fsrrr(  ou4aetniieiltfaDem(vsnt0artnmo tatop  liei;s0sexmir3oudopen fct ()a2urxm ;t0tex iietatfm emumsnu4artomrcto1omt lnvsl() eur(rpny4opeemneia(fa2ra(m ou0tex  feiatfa2ulu o () rtnif totoaD  uei t s2xoimpnu1om n ivtls  2um(mp;o4oetnmo3tadfs rm( p (4trerxr3oytfmDeluei;(0srxmiopiy1lpenmieiat srtr(m no1tpe  ocildfm um(ms;u4teeoircoadlmD lnes t)setmxm3nu4lp  mivias srtrxmo;u4oetomfciyd aDeluvo;u) lxoxr3ia1opteln o (0 rumir3iodlpe mnvtls)artmxmo;t4oleomfctydfsDraump;u0aetomo tatfa rlu s;t srxoxmpiu4llenmivias arrr(  ;u4tleniociad m2ua(vp;t4tlxnxr3iytoa  luvi;t0teumir oo4omenmiviat  Dua(mpnu4tpxnmfctasla2eanvo ()aeenmrciatlp rau o;(0 2xm(r3nudaptnlivs t)sDuaxmono0tpt io3tlt a2umuvp t4alxomo3iodoaDean s () rxr(m ny4lmt lneta( sDrrx  ;o4aee  f3tyd m uluvsnt)aeenxo oodoat  uei;t0seumio iodopt  fcsa()sDurxmp;t4tptoiiciltfa2rl( s t4trtrxo to1laD  ueils  2toxopno1omen nvsls s2rrumpoo0oltoioetasla2rmn on(4 ltrmr3iadla  aieols)seur(o iodlmeemfvsat) rtaurp;u4tlt mociad a el(vo;()aeeoir oy1fa r i i;t0srtmirpny4al   fesls srtru  nu0tlxn i3iys sDrlnmp;u0 rerio3oatfmtrau i t0t2trxm nydalt lncsl(f 2rm(rpou1apeo iciys sDeau pnt)alxoir3oydfmtraivi s0 rxm(m io4om elivslt)sDraump;t0apxnmfeiydlm2eaumon(4alxoxf3oytfaDeai i (0s2umio iu4amtnmfeiatfs2ra(mpoo1teeomi3tasfaDrmuvo;u0trtnmf oy1opDeau ilt  ruoxr3ou4lpeemfvsls)arta(rpnu1olxnif3tadfa2ranvo;u) rxomr oo1oa eanvi;s trxoir ou4lpenlncsat sDra(r ;o0tpto feiyd a2eanvo;t) lxrmfcoa1fm r nvsl()s2trirpio4altnmfctls)arurxmpnt4oltoif3iatlmDuln p;t0areoifcoodomt aieols0srtmxo3nydaleeliet t sruau oot0opto ociltfa ul(mo t0 lermrcoo1laD  uvo;s)sexoimpou4alte ncsas sDuaxroot0alxo icilt sDem(mp;u0 rtnxr tytlm r nvols trxoir oy1al e ictl() 2urumpot0altomfeiaslm um( p t)alxnio iy1omD anes;(  exrxopoudom nmfci (  rraxmonu0ale  fcils aDel(ms;(0 reomfcty1fp eluvs ( trtmir oy4lmtn net t)sDrmx ooo4tpenmictltlaDuauvs u0 etnxocoadlmDrau i;(0 euoim oudlm  lfcia(f 2umx oot1tlto iciasfmDuanvonu0areomo3tatfa r iei;s0 rtrxr3ny1aleelnesa()a2rrxmpnt0tlxnmieildfa2rlnmsnt4 leomf3oa1laDeln o t seto(m3oo1ll nmnvs s srtm(  ;o4apto oeiltlm2uan o;u0tleoxf tatfaDelueilt) rxo(o nodlltnlfcsa( aDurur ou1tpeomfetat s emnmo;u) rermf oodlp  anvo;()s2xrxmpou1altnlietat)aruru onu1tptomo3iasfaDrauvo t0tlxoxr ia1fm  aivo;(  2to(o iy4op  lfet ( aDta(monu1tlx moetltfm2ranmsnu4treoifcio1omt  ues;t0 rurimpno1ome  ietlt) 2tmumpnu0aee moetasfm2ulnmp u0artrmrcia1faD  ivo;s  eum(m iy1lmenmivsasfs2uauro;t4oet micilt a ulu p;u4aeenxo3iytla ean ils) rxr(m nodlltemfvs ()s2tm(rpnu4aetnmietltlaDelu s (4aexrxfcoydomDelivi;t  eumxo3oy1amtnlfctls) 2rmxrp;t4tptoii3iytlmDemnms;u0trxoif3ta1lmD lnvi s t2uo(opno4llen ici (f 2tr(ro;t1teenmfetlslaDrlumont0aetomr tytlm elneo s0srxrxo oy1apt  fes (fs2trxr no4oleoiicilslsDra(mp;t4arerxr3oytfpD  n o;(0t2toxmpoy1al  mivsatf ruaxmpnu4apt mo3tydls emu snt) lermf tydfaD luvs;s) rur(rpoudap elfcsl()srumur ou1tle mociltfa2umu p u)aetnmr3tadoat luvilt)texm(r io4lpenmnvilt)s2rmx  no0opxoifciydls2el( onu4 rtrmfctotla  lnes (  euoim3iu1lme  fviltfaDrrx oot0tltnifeiat s2eln o;u0texnxf oodoa rau o;(  etmxrpnudlpt lfet t  Dtaxm ;u0alt ioeiatls umnmo ()altnioctatla  ai s t t2tr(rpio1ol nmieil()srurxr ot1texoifciltlsDeanmsnt0teenifcoodoaDeaneo s trtoxopnu4lpte fcsas arrr(rpno1texnifetyd a2umuvpnt4 rxomo3oytoa ranvsl(0 rxr(o oy4apt  ncias)s2tr(rp;u0oex  fciyd a2uau s;(0trtoxfctydfa eauei t0 rurio3oy4ole  fvslt  rtru p;t0alxn fctyd a2rlnvs t) exnxo todlmtr n i ()trxr(rpio1ame lfeiat  Dtrxrono4alx io3tldfmDra(vsnt) eerxfciadfat anesls)trtmxo3oo1omenmfcs s)aDtmu pno4ole ioeiaslm rauvp;(0 rtrmf3to1lmtraivo s  2toio3oodap n fet sfa2rrxm oo1aexomo3ilslaDelu on()tlxnir3ootfpD  nei;s) 2xm(m no4amtnmnvta(fs2rau ont0aexniieiltlm ul(vo (0alxrmoctadom  aivo;()sexm(opoo4lltnlfcsl(  rrrurpoo1ope  i3tytfmDrmn p;(4aexnmf3iydfpDelivi s0srxrirpiu1ll e net t s2rm( onu1alen feiyt aDranvsn(4tltnif3todlpDeluvol( sruoir iu4olen ies t s2trxmpot1tptomoctad aDemu sn(4alxoxf tatfpDe i olt t2trim3io1olte fei s arrr(  ;u4oleo ieild a umu p;u0 reomrcto1op rlnvo;(0srtoxr3oydap emivs tfa2rmu o;o0oexnmfetlsfm2em( pn(0trtoir3oytfa eai sl( setoimpiydop emnctls aDtmxrpnt1alt  o3tasls2umnvont)aeerio3ta1omD  i o;t srtr(m3oo1al nmfvs (f rrm(rp;o4oexo ietlslm2ea(vo;(4 exrmo oydomDe uvo s0tetmir iy4lm nmivtat aDtrur ou1tltnmo3ilsfm rlu on(0 eeomo oadfpteaies t)tetoxr3oy4ll nmfct ()aDurx  oo1tpeomiciatls rl( p;() eermf3totlm rlieo s srxmxo oy4lm   nciatfsrua(mo;t4oeeoifeiyt sDrm(vpnu)trxrif3oydlmDraiei s trtrir oy1ol n fcsa(fsDrrxr ;t4aexnmoeiad sDeanmo (4 ltrirciytfp  ai s s0 eum(m3oudlp emnvtltfs2ur(  nu4opxnif3ild s umuvp;t)artoio3tatlp rlneil(0texoxrpoydome  fesls  Dtmu pou4tpe  fetatfaDemnmp t) ltrmf tatfa  lnvi t setrxm oo1op  mfcs ()arta( o;u0aex  oeiadla2rln s;u)tlxrif io1oaD an o t srxmxo oy1op  lnvtltfsDtrxmpnu0apx io3iys a2elums;(0 rxrmoctatlm r n il( trxoxrpiu4al nmfci sf Drrumont1tet  oeiys a rmump u4 exrxr totfm eluvils seuoxo3oudol nmfcil()s2um(root4apxo iciatla2ra(vs;u0tlenmfcoy1omD an o;t)srtmxo3oy4ll   ies (fa2tax oot4tetnmieiytfs2ea(mpnu0tlxoxo ty1lmDe n olt  2to(o3no1omeemics t a2umxmpoo4alt mfciadla2rlnms;(4artnif totfmDe i s s0 2um(mpno4openlnvs t) 2ua(r oo1tle ifciatfm ea( p;u4tetnio3oo1fpD aues s)trxrio3oudlmeemfvilsfaDta(ro;t4tlxnmocildls ea(vp;t)artomr totopDrln il( s2urxr3iy1ol  lfct s) 2tmu pnu1tpxomoctytla eanmpnu0tlenmr3totopDelnvs t srxm(rpio1aleemiviltfa2rr(rpnu0opto oeiyt m umump u0 exoxr oodfmteaues;t0trtrxm ou4lp   neta(f rtmu oot1aee ii3ilsls ulu s u4altrxr3tydlm r i s s  2uo(rpoodoltemfct t)a2tmxmp;u0olt miciad m2ulu p t4aeerxf3oy1laDeaiesls srumim3iu1amt mfvtl( aDrmxm oo1alxoifeiaslmDulnvo;u4trxoxocoodla  lnvil(0s2to(r3iy4llt  fvt s  Durumont0teen o3tlt a2ul( p;(4aeenir3tydlpDelivs;t)srxrxmpou1ale  ivs tfsrumx pou1apto oeils m eanmpnt0trtomrctodlmDelivsls0sexrxm3oy1al nmivilt sDrrxmono0aeenifctytla eauvonu)arerxfcio1fm   i s (0seto(o3oodomt lfetasfs2rr(  ot1tpto ictadfs2ranvs u0 rtoxfciy1lp e u il(0sexm(r3oo4ol emneils)a2tr(r ou1optn ocils sDem(mp (4alxoioctotoa rlnvsls sexoxo oo1omeelnes t)srtr(mo;o4opt iociydls rmu onu0 etoirctydopDeluesl( setoir3iy4amtnlfvtl( srua(mo;u4ape  fcilt m ea( p;t)trxoifctytlmteln olt)s2toio3oydaltnlict s) rtmurp;u4oeeomo3iadfaDrlnms;u0tetomociytlatelies;t  rxmimpoydom  mfcs (  rrr(rpou1alt ioeiys mDeln s t0 renmrcoatop rluei () 2tm(m nu4apenmfei sfsDra(rooo1oetnio3iysla2um(mo (0 eeoxo io1fmt luvol()setrir oydam   ncta()a2raxr no1tpeomiciasfsDum( ont0trtnifcta1oa eaieol( t2xoxo iy4apt liei ( artaumont1tlxo ocils m2rluvs t0alermo io1fptr i ils0 2uoxr no1lm   nciasf rtr(rooo0opx io3ilt a uau s u) rtomf3iydlpDrli i;s) 2um(opiudame lfciltf Dtmuront0aeeomfetlt mDumuvs;u4aeenmf oydomDeauei;s0s2xoxm ou1opt  nvias) rtax pot4alt mo3ildfs rlu pn(4teeoxo3oadom  lues;t0 rxm(m3io1lme  icils)aDrrxmont4texoioetytfa eanmp;() lxrxf iadoa eanvo;t)srxoimpnydlpte fcils)s2rrurpot0olxoioeiyd sDuan on(4tlxnif oodlmDelueo;(0texoio3iu4olenmivt (  rta(roou1tle mf3tysls umu s;t0altrif oytla   i s;t)trtoxrpoy4optnmnvt sfa2um( pot1apt micils sDum(mp t0artrmr3to1laDeauvolt)s2xrio iu4optelfvt () rtr(r nu0aexomfeiyd m2uanmon()alxnmf3iodfatr u olt0srtoimpny1lptnlivia()aDraurpoo0tptomfciadfs2umu s;t0aexnmo tadoatrai o s0tetrxm3nodlmtn fvi s  2urxrp;t4apenifctldfa emn s u)tltrifcoatop ranvols)sexmxopno4altelfvt (  rumump;o4alxomoetasfa umn s t0 lxniocio1omtelu ol( s2toxr3iy4ape  fetas)a2rrxrpnu0oeeniieiasfm2ea(mo;t) eeoxfcoydlaD lneols)srxrxm3ny4lpt lieias)arumxm nt0aetomi3iat a2um(mo;() exnmrctydfatrlueo t setmxo3iodllt  ici s s2uax  oo4tpt mociysls um(vp;u0 rtrmo3todfaDrli o (  exmirpny1op nlnes tfartmum ;u0apx mf3tlsla2umnvs;(4teeomf oatfpDeli sls0tetmxrpoydapt lics t)s2rmu o;u1tpxn o3tyslmDelu p ()aexrxr ia1laDran olt)texo(rpny1openmicsl(faDumxm nu4aeeniieiyd mDem(vs t0tltoir iy1lmtrau olt) etoxopoo4lle lnvt (fs2ua( o;o0apx  iciadls2eanvonu4tlermfctatfatr n i;s)t2tr(r oudlltnlfctlsf 2rmx ooo0tex  o3tldla2ean on(4 lenif iydfat ln olt0srxmirpiydame  ivils sDta( oou1ape  f3iltla em(mp;t4 ltnmociydlatr ivol( seur(o3ny1olenlfvt s) 2uru o;u1opto o3iaslm eanmp;()trtnir tytoa elnvo t0t2xmxm ou4amtn feilsfsruaxmpoo1tle iictysfsDumumpnu0trermfcoadfaDe u s s0trumir nudamtnlfvslsfs2rrxrpnu1aptn feils m2eaums;(4alxnmf3iadlaDe i s s t2tm(r io1omte nci tf Draurono0apxoiociyt sDrmuvsnu) rtnxr ia1laDr ueils0teumio3no1am n ivsls)sDrruro;t4altn fetydls2rmu snt)tlxoxf oy1fatr ues t0t2tm(m nu1lmeemnci (f Drrxr ou4tpeoifeiat s2rluvo t)texoio3oytlpt ln i s) 2umxrpoy1opt lictlsfsrtauro;u4oex mi3tlsfs2ua(msnt0tltoxrcoydfatrauvilt0trum(o ny4lm n nvtlt  ruax  ot0aptnio3ildlaDem( pn(4treoio3ta1lat lieols)t2uo(r iudllen ietat s2tau o;o0opx iociys mDrlnmsnu)aetnmfcoadoa  aueo;t  rxoiopny1ome mfvils srta(  nu1oltnmfetatfs2elnvpn(4aeeoio3oadomtr ueo s) eumir oodoptemnvt (fsDumurpot1oltomfeias aDuau o ()tltnmr3oydfpD anvo;s)srxr(o3iy4aptnlici s)a2uau  oo0tet mo3ildfs2umnmp ()tltrmf ia1lmtrli i;(0trxr(o3nu1omtnlnvsa()sDuaxro;t0tptoif3ild sDuanmp u) lxrif oo1oaDrlnvi t s2trim ou4om nlnvt ()s2rrxr no4tetomiciasfaDumnvp u0alxnir3iy1optrlieo t0 rxmir3io1lltelfeiltfsrum(rp;u1oltoifeias sDumuvs u0trenxo io1la r uvi;s)texo(opoo1ole micsat) Dta(m nt4oeen i3iyslsDra(vs;u)alxoir3ta1op eli i ()srum(o iodlpe lfct s sDra(r no4aexoif3iytls rl( ont4 rtrmr to1lmtrlnvols seum(r3no1omee ici s) Dtm(r ;t4tle  iciatfm uanms;t0trermo3oatlm ranvilt) euo(o nu1ll nlies (  Duaumoot1ape mfctlt sDumu o;u4 renxf ta1op  aieol(0sexrxo3ou1apenlfetls) rraxront4aex mo3tys a2rmumpn(0aeerxr3iadfaDeau s;s0teuoirpou4lltemfvi s)srtaur ;t0aeenmo3tatlsDuan pnu)trtoxf3iadopDr ieils0s2umio3oydal emfvi ( arrmx o;t0ope iieilsfaDemnvo t4aetnxo3to1lpDrai sl(0sexoxo io1ap elfeiat)aDrr(mp;u0tpe  fciaslmDumu onu)trxomr iytfmt au ilt)t2xmio3oo4amenlncia(f 2uaxmpno1aeto i3tasls2rm(vs;u) ltnir3ootfptr uvo;s)t2urim3iy4om elnvsltfsDur(r nu4tee moeiysfa2umuvont0tleoif iatlmDelivi ()seum(o3oy4lpe lnes ()arrauronu1alx ii3iydfmDuan o;t0 rtrmo3totfat aivol( trxoim nu1opt lfvt s arrmx pnt4oetn icilsfsDeanmpn(0tetnifciadfa ran i;t0sexo(r3oydol  lncta(fsrtmx o;o4aexomoeiad a2ulnmpn(0treomo iodlpt  n sl(0trtr(r3iodlm e fviat  2rmuro;o0aetoifeild sDel(vp;t4alenmf3oadfm rlivi ()s2ur(r nu4altnmnvia(  Dtrx ooo4oeeomoeiatla2ranms;t)teeoxocoatomteaivsl( s2to(o iodalenlivs s)sDtm(ront4tlxn i3iys m uau s u)tleomo oa1fateauvil()trtrirpio4aleemfcsl(fs2tr(rpno0tpto f3iys s rm( sn(0 rtrmociytop eauvi;s0teum(m3iu1al elfct sfa2raurpou1oeeo icilt m2em(vsn(4 rerir oa1fmD  iesls0seurxo oy4lle  icsl( srurxroot0tpxomfcilt aDrmnmsnu0aetnxrcty1lptrli o s0trurxrpiu1alte ict tf 2rmuro;u4apen octyslsDrauvs u4aexnmfciodom elueolt0trurxrpno4al nmivsltfaDrrurpnu0ope ifeiytfsDumuvsn(0alxnif oadfp   ues t) 2to(o ny1op e fci tfa2uaxrpnu4aee ifctyd sDelnmon(0aeeoxocto1fpDelies s0t2toimpnudol   ictas a2tax p;o1tee moeiysfsDrmn pnu4 leomr tydfat anvs;t)sexmxopoy4ll   ictls)aDtru  ;o0oexomf3iysla ra( ont0tlermo3oytop   i slt0 etmio3oydol emnesls) rtrump;t1oeeo i3iadfs eau p;(4areomo3iotlpDrln ils t2uoio3oy1ll   fcia( s2trx  oo0oetoio3iydfaDumnvs;()alxoxocto1la ranvs t) rumxopnodom nlnctlt) rurx o;o0tltnifeilslaDemu pnu0trxrmo3iy1lmD lneo;s0s2trxo3iydlltelivs sfa2tru  no1oeen oeiys sDran snu0 rtrir oydlpDrlu ilt) etmxrpiydapt  ictat)a2urumpnt0ape mictat aDrlnms;u4tlxrir oa1la r u s s0 2xrxmpoudap elfvs tf 2rmxmo;o0oetoii3tatfmDrm( pnt)aexomo3tydop e uvs;t  2tm(rpnudlleemfesltf 2tmu onu0apx  ieias a2uanvsnt)tltrirciodlaD  uvi s  etr(o iudlme  ivt s)aDtmum ot4tpx mf3tltlaDrm(vo t)tetoxf oatlaDrli i s0trtmxo io1lleemfvtas  rurxm no1aleoif3ils m2rmn s;(0trtoio3to1la   nvols)trumxr3oo1al  lnctlt aDumu  no1texo iciltls2emuvo t)tlxniocio1lmte nes;s0 2toxm nydlleelivtas)aDtmxmpou0tpt moctld a ea( s t0tlxrmrciydfaDrluvolt)s2uoio ou1am nlfci t) Dtr( p;u1aeen i3iydfa2rlumsnu) ltnxfcoa1lmteauei;s0srur(opio4lmtemivtat s2urxro;u0tpto f3tydla ua( snu0aetrxf3tatop eluvi;s0 rtoio3nodamtn ivi s sDrmxm ;t0tetoii3ias s2raums u)aeeoif totlptelnvs s  2umir oydlp e fcsltfaDrm( p;t1tpxn ictlt aDemn p t4aeermrciytlaD  n o s0 ruo(rpnydlpe lfvils) 2uru oou4tpxomf3tltfaDuan s (4 lermocoo1opD  u s s  2xrxo3ny1lm emncta( a2raxrp;t1oeeo oeiyt s eluvo u4 ltnxr iotopDeln i;s0tetoxo oodlp elfet ( arumu onu4oeeniietls m2ra( s u0 etoxr3iadop ran ols)s2trxo3iydopt  netls  Dta(r ;t1tlen f3iadfm2emnmp ()trtnxf iotfm  aueilt sexmim3oodaltnlictatfs2taur oo0aetoiieiytlmDrmn pnt)alxomr3iy1om  auesls0setmxo oydop  livsas a2taur ot4apx micilslaDeanmpnu0aexnmf3oo1fp eliesl(  exo(m3no1lmt  ics () 2rmu p;o1olt mictyd s rmuvp;(0 eeoir3to1om elu s;t0t2tr(mpny4altnlfcia( sDtmumo;o4tpxo ietysls umuvo (4aetrir3oydfmt an s;s0s2umxo nudlmtnlnci (  Dum(mpot1aee  i3iasla2rl( s (0aexnio3iotfp raueols) rxmio iydapte fci s a2rru  oo0aeeomoetyslm ulu s;u4tlxrmfciadlp rai s (0s2tm(opiudap emicilt)srururoot0tpxomoetlsfs elnmp (0 reoxrcto1op  lnvo (0 2xmio3nydomee nviat)artrxm nt1opxnmieiat m rluvo u)alxrirciotopDrluvslt  2urirpno1lme lfes sfaDur( pnt1oexnmfctytla ea(ms;t)trtrmociodlpDranvi ( seto(o3no4lm elnvia(faDrrx  oo1aleomicildls2um(vo t0arenmf oadfp ean s;t0seurim3ou1am elies (fa2rmxmpnt4aee mf3iad mDrlnvo;() eerir3todlm e i ols)texr(m no1lm e nvsas  rrrur nt0tltnmo3tlsfmDranmont0 ltnxo3ia1omteluvsls) eur(m3iu4al emieils)s2um( p;o4ope moeilt s el(mp;t4aexnmr iodlatrlivo t0 rxm(r iydlltnmfet sf rurx pot0aeenioeiltfmDuluvp;(4tetrmr ia1lm  livsls0srxmxo iydopte ies tfaDtr(mo;u1oeeomi3tldfs2eanvs;t)alerif iodoaDrlivol() rxm(m nodale  ncslt)srrau o;t1tetomo3iltlm emump t)texnir3iy1fa r u s;s0setm(rpiodoltemieil() rua(r ;t0aleo ieiasfs2ra(ms (4aetnxocoo1latrauvol() 2ur(rpnydamtemicta(  Duaum ot1ope  ociad a2umn ont4aexrif iytfaD lnvol()seurxo oy4ale  fcsl() 2urumooo0aee miciltfs2rlums (4texoxr3iodoaD an ils0trumxo oy4omee fesa(fs2ta(ro;u1apxnmfctltfsDelump;u)tetnmf3oo1oat  uvi t)trxoir nydol elnctlt)sDtaxrono4apxo ictaslmDrm( s t)teerxf iatfp  anvo;s0srtrxr3nodolee fvias) 2tr(rpno1teeomi3ild a ulump (0aeenxfciadfatrlieslt)t2tmxopoodlmeelncsa(f Drm(mont4apxomietltfa2rlumo;(0tleomfcoytfmDrlu sl( trxmio3nudolenmivil()sDtm(moou1tltnmfeiydfm2ua( p;u)trxrmf iatopDr nvi s) rtoimpoudll nmfvs t  Dtrxrpou1opxoiicildfa ranvonu4aexrmrcoo1op eluvi;t0 rxmxo3ny1amt  ivs tfaDtaxro;t1olxnifeild mDeluvp;(0treomr3ta1fa rli i (  rumirpiy4am   feia(f Dta(r ;u1tle mfeiyd s2uau on(4tltnircoatlat luvs;s sexm(rpnu4op  mnei sf rtau pno4aet if3iltfm2ul(vs ()arenir iadfpD lueo;t) 2xrxr3oodap   iesa() 2trxm ot0alt  oetytls2ua(vo t4teerir3iydop  aueslt sruoimpoudol nmiei sf 2uax o;t1tpt iieiyd m ra(mo;u)tleoir3oytfatelivi ()truoiopiy4lm  lfvtlt  2urxmp;t4olt ifeild m2rlnmo t) rermf oodfmDraues;t  2uoxm nodlmeemietat) 2tru oou1altn f3tlt s2rlnms (0aetoio3iydlpDe n s;t0teuoim3oy1lltn nvsltfs2tmxmp;t0tlxnifeiasfmDuluvp;(0alxrxr iodoaD luei ()seto(mpoy1ape  ieslt arur(mo;t1oleomoeiltls rmn snt)trxomf3iy1omteauvs;t) rumio nu4lpt lnetas  ruaxrp;o1opx  ociydlm rluvon(0 exnxo3ia1lp   n i t)setrim3nodameelivt (  Dua(rp;u4alto octaslsDea( s (4teerxf3iydfat  i ol(  rumxr3oy4al  micta( s2umuroot0apenifetytla ra(vp;t) reoxfcootlmD ln sls) 2trxmpoodal   ncsl(farra(mpot0apt  iciat a2emn on() eeomocoydfpt li s;t)t2xr(rpiy1ap emici () Dum(  ou0oee io3iadls el(vs u) rxrmf3iatfaD lues;(0t2tm(m oodom nmnesat)srta(  nu0ale ii3tlt aDul(vo u)trxrif3tadlatean ol(0t2tmiopno4olenlneslsfarua(r ou0oetniieiad s rm(mpnt)aexnxo3ta1oaD  uvilt0 2toxr3no1om nlietas) Dtru  nt0ale  fcildfm2uanms u0trenir3iy1fmtrlueo;(0 rto(opio4amtemnvt s)artrx pnu0aexo i3iatlsDua(vpnt0 exnio iotop   i ol( seuoxr io4llt  fct () rrrx pou4oet ifciad sDrmump;(0altrxo3tadopteanvi s0 2tm(m nudlm emnvtlt  rrrurpno1olenmietatls2ean o u0tltomoctydfmD lnvo ( t2uo(opno1ap e fesa(  2umu pnt1oex iociyd mDumnvs;t4 exrmf iodfpDr uei t tetrirpio1altelivi ()sDtrx p;u4apeoii3tltfa2el(mo;t0aetrxfcoo1lpDe ieo ()t2xoxo oo4al nmncil(  rrm(  ;o1oeeo i3iatls rm(vp;u0aetoxocootopDelnvsl()srur(m3iu1ale mfvias) Drax o;o1alxo ieiysla2umuvpn(0trxnif oytlat lueols0seurirpny1ap   ici sfarrau o;t0oexnmictysls2rmnvp u)trermoctodoa   neslt) 2uoxopoo4amt mnet ( artr(r no4alenmoeiys a2rmnmo ()tetoir3to1la raieo;s)srtmxm3oydapeemicsatf rra(r no1altn fciydlm2ua(mo (0 rxrxo3oo1fm rlnvo s0sexrxo nydap  mnvt s s2umxroot0aexn oeiyd mDuln s u)tlxoxr ia1lmt auvilt)seurir nydomeelnetl()sruru ono4tle iictltfm2ean pn(4 etrxf3ty1omDe nvi;t seumir iydop emivsat s2trxr ;o0tptn f3tysfaDumu sn(4aexrmo3iatlmtrai ils) rxr(r3oydamtnmfeils  Dtaumo;o0oexn o3tad s2umn p u) etnxf oy1la  au o t)s2uoxmpoydomtnlfcia()s2tm(rp;t0oleoifeiatfs2rl( p;t0trxrmo iodoptraiesl()sexoir nydol n ietl(  rtrurpnu1oex  i3tyslm rmnvsn(0alxrmf3iodfpDelivi;()trurxm3oydaptelnvias)aDtmuro;u4tpt mo3iltfa umnms (0 lxrxf tadlmt  neo;( t2urio3oo4ale lnei ()sDrr(mo;u4olt mictadls umuvs;(0tltoxrctadfmD  nvo ()s2xrim oydlp   net sfaDrm(r oo1aetnif3ild m2rau p t4areoxf iydop   i i ()seuoiopiu4ol nlfvi (fa2tmxmooo4olt mictld mDulu o (0 ltnirctydoa raies (0trxmxr3oo1olt lfvias)srtmu pot0oee moetytlm umumont4aetomo3oodoaD  nvol()srxmirpny4oltnmncs s)srurumpnt1tle iicils s2raump;u)trxnio tatfpD lnvi;s t2uoio nu4apeelivs s) Durx o;o4tlenmfeiasfsDuln p u4 exnxfcty1oaD  n o t srxmxopnodlpenlncsl(fsrua( p;t1aptoif3tys mDel( s;()aeeomr3oo1lmtrauvs;t trtmxmpoudol  lfvtls)a2umxm ;u0apeniocilt sDelump u0 ltrir3iytfpDraivol()trxm(m iudllenlfvsl() ruauro;u1aptomi3iad s ulump;(4tltnmf3iytfp eln i;() exmxopnu1amtnmies ( a2ua(  ot1oeenmfcildlaDul( snu)altoxo3iydoat an ols  etoxmpio4al  mnes sfsDuauro;u0teeoiietlslaDea(vo;u0tleoxr ty1lmteanvi ()s2xm(r3iy4ll e fvsas)artmuro;o1aetnioctadlsDrl(ms;(4alermo oydlm   ieil() rxrxm3nodolenlfcsasfa2uaum ot1teto oetyt s um( s u0 ltnmrctotfatran i;t t2tr(r3oodamtn ietas artr(monu1alt  feiltls2rlnmsn()aeenxocoatomDeanvi;s  2tm(m nudoltelnvs tf rraurpnu0oetoii3ias m2ra(vo u) eenir3ta1oaD  i s;t  rxoxopnu4lp e nvtls)sDrr(rpnt4optoioeiat sDrmnvs t)aeenxo io1fpDe ivolt t2xrim oydllt lfeias artmur ;t0opx mictydlsDulnvp () eeoio3tatfptr neo s s2to(o oy4lltemnctas  Dua( oou0opxoiociydfsDumnmp (0aetrifcoatomtrluvi (0trumxm3no4aptemiei sfs2rau p;t0oetnmicilslm rmuvonu4 lenio ootomtrli s;( teto(o3iy4om elics sfarumurp;u0alxn oeiat aDrln s;u) rxnif iodlpDrli i;s  euo(r no1lm emfci t  2rru  nt4olxnmociasfaDran pnt)tetoxociy1lp   uvilt) rurim nydap n fei tf Drmuro;o4tpen i3iasla2emnvo;u0tltnif oatop   ieol( s2ur(r3oy1aptnmfeils a2urumono0alx if3tltfm2eaumpnt) rerir tatlat lu s s)srxrxr oy4am emicsltfaDuaurono4texo ictys mDeauvs u0arxoirciytfa eli i t0 rxrxr iy4om nlneil(f 2rr(moou1aeenifeiadla2ua(mo () rxrmrcty1omDrlivi t0setoxo3oo4aptemics t)arrrx o;u4tlxoiietas a uau pnu)tlxoircoadfaDeanvslt)teuo(mpnudlpte icias) rtaxront4alxoiicildfm2ea( o u0aeenir ia1optelnvs;s tetoim iu1apenmfvsls sDtax poo0tpxn iciasfm2umnvp u0 rxnio oodoa rlivils0srxrirpio1lp elncs sfarraxmo;u1tpeo fctydfs2ean s u0aeeoxo tytfatranvi;(0texrimpnu4lptnlivs t)aruru o;u4tee io3tytls uluvo u)arermocto1latrauvi s0srur(m3ny4lmt  fvias)srtmx poo4opto iciyt aDuau onu4tlxoxr oodlp raneo t)srtr(r3iu1oltelieil( sDrru ooo1openif3iyt a elumo;u0 rxnxr3iotlpD livsls0tetoir oo4ll  mncsat  rraumpot1tlx ifeiysfmDrmnmp u)artomo3iatoptrai o;() 2tmir nodomtn nvs (fa2tr( o;u4oltoifeiasfs rm(ms t0tleoxf3iodlp raueslt0 exoxr3ou1olen fci (  2umumoou0teeomieiysls el( s t4aetoxr ia1lpt  u s t) etrio3iy1altnlietat)a2urxronu4aetomi3tyd s rmuvp;(0 exomo ty1oa e ieo;t0 2ur(opiudomen fes sfaDtm(m nt0olenifeiysla2rl(monu4 etoxr iadfmtrau s;s0teurxrpnudlp  licils)sDtmx  oo4tpxnmoctyd mDum(mo;u) rerif ootomte u s;(0srxrxrpou4opeelfesas) 2truro;u1apt mi3ilt mDua( s t0 ltoiocoodfp rlnvslt0trxrim3nu1olt  neta(fartm(mont4aex mieiys sDrln s;t0trtomr3tatfpDr n i;() rxoxo3oo1lpt lietls)artmxm no1tpx  feiasfm eanvon(0aetoio oo1oa elieo;t  2xr(r3nudalenmfctltfs2tmu  ou1alenifeiadfm umnms t0 eerio tadfp  auvsls) 2xrim iudlp  lncilt srurxmp;o1tlx  oeiadlaDra(ms t4 etnmo3ootfate i o s0 2tmirpoy4am emietlt sDraum nu0alx  feiys a ul(vont)altnmfcto1lp e ueils srxr(mpoydop  mfviat) Dumxmo;u4apto ietydfaDelnvpn(0 reomo ia1fmte neolt  2tm(rpnu1lptemivi s  2tax pnt1oetnmoeiadfs uaums u4trtrmfcoy1lpt luvslt)t2uoxm3no1ope mnvil( srrmxrpoo0altnifeiltlm umnvo;t4alxnio oatlatrlu s;()seumxo no1alee ieiatf rtru pno1aptoiieiytfa2umn o;t)trtoxr tydoatran s;() ruoiopno1ope  iesa()arraxm oo1opxoiiciasfa ea( s;(4 rtrxo iy1lpDeluvs t)t2uoio3iu1lmeemnvsl(  Dtmur ou1tetn fcildlm2ulumo;t4alenmocty1oate u s;s texmim io1ome lfeilt)srta(rpnt0oetomiciytla2rm(vsn(4aleomfcio1fatelnvs s0s2urxr3iodol elfvsa()sDtr( p;o0tpxomfeils m2eanvo ()treomr3tydfm  anvs ()setmiopnodame licsl(f Dta(  ot4aleo fetld mDumn o;(0 ltrxo ootfmtrauvs s)trumim3ny1ole liciltfsDuau  ou0apeoioetad sDumnvp;(4texrxrcta1la e u ilt t2uoiopnu4opt lfviasfsDtaur ot0tlxnmfciytfa2em(mo;u0tltrmr ty1fpDraneo t) 2xoxr nudame mnviat)srtru pno0tpenif3iltfa2ua( p;(4aetnmf oatoat aiei t) rurxrpio1op  mnctls)s2trxm nu1alt  iciyt a rmnvsn(0texoiocoatlptr u ilt trxo(opiydlle lfvtas a2taxmono0tpx mi3iadlsDuln o u0artomo iatlpt luesl(0tetoxm no1lle mfesas arua(r oo1aeenmi3ils m2um( o t4alermr ta1opte ivo;t0texm(m iodoptelivilt artr( pno0tle iieiyt aDum(vp;t)alxnxf oytfpD  ueol(  eurxr io4omte nei (faruaxmoot0opxn oetaslsDrm( pnt4texrmf oo1oa  li i;t) euoiopou4alt  ietasf rtm(m nu1apxo iciyd m ea(mo u0tlenioctytom  lnvolt0s2tmxr iy1al nlfvt t srrm(moou4optnmo3iat s2rmnvp ()aeeoxr iadfm rlneslt0t2xo(r3ou4al emneils artmx  ;u0tlxoiiciysfm2ulump;(4texoxocio1oaDeai s s  rtrxmpnu4lltnmfeiasf 2ta(rp;u1olxomoctld a emu o () rtrircto1oaDrli il( t2to(m3ou1llenmivi t srua(  nu0tleo i3tlt m elump t4alxrmfciydoatr nes (0 2trxopnodap   nesa(fs2trx  oo4apxnmiciadls2uanmp;u0 lenmociytoaDeli o t)texr(mpou1altnmics sfaDrax o;u0ape io3tat s uan o u4alxrir3oy1fm eluei s)t2tmirpoydaptemfes s a2rmxmono4tex  ociytlm2umn o ()tlenir oadoptrluvi;t0 exo(o oy1altnlnvs t  rrrumpnu4oex mictydfa rmnvo;u0arxnxf3tadlat  ivols)t2urio3oy4altnmiei s) rrax  ;t1ale mieiad m2rl( o u)arenxf3tatoaDe uvi;(0 rxmirpiudlp elnct s arrrxrpoo1oex iieiltfsDrmu pnt0aetnmr ta1oatean i (0trtrim3ny4ap elnvilt aDumu pou4alt  fciys s2ul( pnt0aetrxo todoa eli o (0s2uoxr iudlmtn fvia( s2ur(m nt1opto o3iat aDeau sn() lenxo oytlmDelieo (0trxrxo3oy1ameemietls) rur(  oo0teenifciydfaDeau p;()altrifciatlm elnvilt)seto(rpnydlmenmivi tfsrumxm ou4opx  fetyslm rmump;(4trtrir io1omDrauvslt0 rtmxr3nu4lm emicsa(  2tmxmo;u4altomfciadfm emuvpnu4artrmocoa1fpDelieo;s teuoxrpoy4apenmfet t aDumumo;o4tee  oeiytfm uan on(4aetomr tatom e u ols)t2trxopny4om  lfcta()s2ta(  ot4tltnmf3tasfs2eaums u)teermr3iytlatr uvs;s sexrio nu1op e nes ()a2ua(mo;u1oet  fctadls2rl( pnu4trtomocoatfpte nvo () 2tr(r iydlp nliesat)aDrau ooo0tpt  i3ilslm2em( on(4aleoxr3oodfa elieo;t) 2tmiopny1ll   ivsltf Dumu pou4olto fetatfaDemn s;u4trxnxo3tadlpD li s t0s2ur(opou1ame mfetlsf rumxr oo0tlxo ocilt m2ulnmo;u4 exoxr3iatop  luesl(  euoio3no1lp nmnct s a2rmu  nt4texoioeiatlm2ulu p ()texoio3iotfm  aiei;t tetrimpiu4oltelnvs t) Drmx  oo0tlenii3tldla rl( pn() rtnir tadfaDr nvo s  rto(r oodom emict s a2trxrpoo4aex ioeiytfm2rlu o t4 ltoirciatopDe nvolt s2xo(opio1ol emfvta(fs2ta( p;o4aexomf3iadfsDrmn s (0altrxfctydfateluvs t  2toio3nydom  mneslt  2uaumonu1tpe  o3iadlaDrlnvs u4treoiociydfa  anes (0trxrirpiudapenlfct s)aDtru ono4alx iieiydlaDul(vp t4aetniocta1faDe ueo;t0 euoxo iu1am n fctas  rrru  ;t0oex  iciyd s2elnmon() renxr oa1op r ueo;t)setrxo3oydape lfvta(faDumu oou0tleoif3ilslmDemnvo;()teeomf3ty1fa  auvi;( t2urxr ou4apen nvtat  2truroou0aexn ieiatfm rl(vont) rerxo oytop   u s t)setoxm oo4lm  lfesls)a2rrxr oo0tltoio3iysfs rm(vp (0aeeomr3oatlmD aivilt)t2xmim oodll  mfes s)a2umurooo4alxnio3iydlmDuau o ()aeeoxf todomDrlueols)s2tr(r3ou4amen fvia( sDtru onu1olto ietld m eanvo u0trxoifcoydlm r ies (0srumxrpny1aptelivsa()srtaxmont0alto i3iyt s2rluvpn(0tltrmrcoadlmt auvo;t t2xmir oo1apt  fvta(f rra(monu0texn fciydfs2emnvs;()aetoirctadla ranvilt s2tmim iudamtn nviat  2trx pou4olxnmf3iltfa eaumsnu) eenxf3oytlmDe ues () 2xoxrpnu4amen ict tfa2ta(rp;o0apt iiciyt aDea(vs;() ltomr3ta1op  aivsls  2xr(mpoo4ol elfeilt)sruaxr ;u4teenii3ild aDeau o u4 exnif3oydfpt lnvs s0 2xr(r ou4lpte ivsat)aDta(  nt0oee iiciltfsDra( s;t0arermr3totlmt  uvsl( s2tmir3nodlm e nvs t srumumoou4oex iicils a2ea(mo;t)tltoxocootfa raiei;s0t2xrxr3oy1apen fctas  2uaumooo1oex io3iyt aDeauvp;t0 eenmfctatfp rln ils seumio iydlpen ivias)s2taump;t0oeeoioeiysfaDelnms u4 rxoxf3io1opt li i (0texmxopiy4apte fesl( a2rrumo;u4tleo ocilt sDemn o;u)tetoxf iytop  lnvo s0sexm(r3nodopt  nctl(f Dumxm nu0tlt  iciyd mDuanvpnt0texoxr3tydlm elu ols0texmir oodlp  mnvilt)arumumpou1aet moctatlm rl(msnu4altrir3oo1lmte nes;t0t2umirpoo4ap n fvt sfsrum( ont4tltnmfciyt mDeln snt) leoir3oatla r ivslt  2trirpou1lme  iei s) Dum( ooo4olenmfeild s2eaums () rtnmf ta1fm  lnvo;t)t2xo(m3nydlp emnci s  rtmumo;o1aleo o3ilsfa2rln o (4aeeoif3oodfm e nvi;s0t2umim3iudamte feia() Drmx  oo1teto fciysla2eaumpnt0teeoxr3tytlp e i ol(0 rtrxo3oy1op  mietat  2trumpot4tee  fctysfmDran s;t) ltnxoctatlp r u o;t) 2uoio nudaptelfei t sDtrum ou1tlen ieias aDrl(mo (0artrio3ia1lmtrlivols)tetm(o iy1aptnmfeia(fs2taxr ;u4openii3iadlmDea( onu0 rxomr3oodlpteauvs (0sruoxm nydoptn nvtas)sDtr( pnt4ope  i3iaslmDulnvo;u0 lenif3iodfm rlnvs;t)teuoxo oo4lp  lfcs (fsrtaxmpoo0tptn fctasls2eaumo (0texrxr3io1lp elivsls t2toxrpno1ll  lfcs s a2umxrpou1ope  ictatfa ean s;u0teermf iytlp  li o (0 etmxo oodolt mneil( a2rrx ont1oeenmfctat m ul(msnu0arxnio3iodomt luei ()sexm(m oodlmen netat)a2uaumonu0apx  feiyt m2ulnvsn() rxnxf3oodfa r uvi;s trxr(opnudom elfctltfsDtrur nu4alx ioetasls um( on(0altoxr oadlp  luvil() 2xoim iy1llt mfeilt s2rr(moot4apen oeiltls ran o;u4tetrir tydfat  i sl()s2umxopiu1ale lnes s  2uaxro;u1apeoioetatfmDua( pn(0 rtrmr tydom  anvo s0 exoxr3ny1lmenmfct s) Draurono4tlxo fciydfa2umnvo;u4 ltrxf3oo1lm r u o;t0t2to(m3oy4om nlnvtls srrm(m ;u0oetoioctadfs emnmo;t0 rxrxf3iatoaD au s;t)sruoxopno1op n ies sfa2ua(mp;t0tlxoiieiad sDemu o;() etnmociodlp rlu o;t teuoxm iy1alenmneia(  Drr(ro;o4olxoioctltfs2rlu p () eenmrctodoate ieo;t  rumxr3iodlme lfetatfa2tm(rpnu0olxniietatla umuvs;(0tlxomfciotfmD ln sls setmimpnodlmeelieils srum(rpot1alx ifcildla2ul( o t4aeeomfctadomtrlnes t)srxo(r3iy4ol  miet s) Dtaxroot1oleomieiydfsDuaumo () rxomo3iadomt an i;(0t2triopnu1am elfcia( sDurum ;u4oet iictydlaDelumo (0trxrxo iatoptran slt0 etoxr iydlptemnes s  Duru  nt0teto oeiad mDuau p;t)alxoxr3ta1op r iei s0texoxo iydope mfcias) 2umumpnt4opx ifeils a2ea( s t4aeermrcoodlptrliei s  2umxm no1al n iei s aDra(r ou1tetoioeiytfa rau onu)trenxociy1fp  luesls s2xmxmpoy1ape mnctas  2taurp;o4aeto ociys s elnmpn(4 lerio3iadfm e iei;(0srto(o3oy1olt mfvsasf rrm(  oo1oet iocias a2raumo t)aetoiocoatoat  i o;s0t2uoir3iu1opt  ictlt)sDrr(m ot0tpto o3tltfs emnvp;(4tetomr iy1lmDeauvo;s)setmxrpnudopen fet t)a2ta(mo;t4opeo octatla2ranmo u4altnmr3iadfp rln sl( seum(r oy4oltn ncs s)a2urxmo;o1tpenmoctatls eauvs u0 lenxrcoo1oaDelu o;t teum(m3io1oltnmfcilsfsDtaum ou1texn oeiasfa2ra(vo;u4tlxnir oy1opt  ieilt0teurirpou4alt  nes s  Dtm(ronu1ape  f3iytlm rmums u) etrxf totlpt lneo;s0trumxopoo4aptemivtat a2umumonu0opxomfctldls rmumsn(0tlxrxrcta1fpDr ieslt truo(m3iy4ape liesa()arrrumpou4opxo ieiadfa rm( s (4trermfcty1fpt lnei;t tetoxo oo4lpte ivtls)sDtaxmp;t1tlxnioctasla elumont0 lxrio3iy1lmteanvs t s2umxr ny1llee nct () rtrurp;t4apt if3ild aDrm(vs t4altnxr3tatfa ean i s  etmxrpny1ap nmfvi s) 2rrx  nt1tet iiciydfa ua(ms t4texrxfciatla rau i;t)trtmiopou1op nlfcilt) Drmum nu1oee  octytlm ea(mo;(4tltnmociydfat  iei t)t2xmxo3no1oltelfesa( s2urxr nu4tlx moctlt m2uaump (0trxrxo3ia1oaDrluei;()s2ur(o3nu4lp emnesl(  2urumooo0olto ietlt a el(monu)altnmo ta1late n olt)tetoio ny4apt lfctat)srrm(mpnt0tle iociyt sDemnmsnu)tetnir3oydlm e iesls0tetmxo nu1lpeelfeias)sDraxr ;o1oltomi3iytlsDrmu o;t)alxrmrcoytfa   ueo;(0set
\ No newline at end of file
@@ -0,0 +1 @@
+ivol( trxoxm3ny4omen fviatf rrax pou4oee micildfa2ean p;u0trxrmr ta1opDr nes;s) 2xoir3io1ap  lnvil()srrr( poo4tpxnmfciys m eauvsn(0artrmf oytfmD  u s s t2xoxmpou1llt mnvsa( sDur(root1oexomociad s ulu s;t)trtoio ty1lmtrli olt0srtoio3oy1amen nvil(  2trxr no4tpe  feiaslm rmump;t0 ltrmocoa1om  luvols0 euoir3iydam elnet () 2rr(  nt1texn feiaslm2em(mon(0artrmfctytlmDeln o t)sexo(rpoy4alte fviat  Dta(m ;o1oex  f3tltlaDua(mp ()alxrmf oy1oaDe nvo;()srurir oy1lmt miei t a2um(m no0tltoifctyd s2um( s;u4tlermfcoo1oaD au i;t) 2tmio iodop e neilsfaDtmu  nt1tpen f3iyt mDrl(monu4tetoio tydlaDeluvs;t) rumxr3oo4al  lnciltfsruauroot1oex  fetatfm2eanmsnt0 ltnmf3iytfptrlivols srxoxm3oo1alee nct t)sDtmu  nu1oex mi3iyt s em( o;()aexnif3oadfmt  n il(0trur(m3oodom emivt s)artax  ;u4texoif3tltls rl(vpnu0 eeoir tydfp rluvols0 exmio3iudopt  fctasfarrr(root0ape  feiad mDua(von() exnmf oodla raneils0t2uo(o3no1lpee ies tfsDtrxrp;o0olx moeiytls rmuvs t0altnmf tydomte n i;t)s2uo(r3nodaptnlivsa() Dtmu  ot4oetn f3iadlmDuluvpnt4arxrxo3oy1late ivs;s teumxo ou4omeemfes t sDum(mo;u0aetnmoetyd m2emnmsnt4trenircoy1oa e i slt t2um(m3io1ap   ics t)srra(  nt4tptn f3ildfm2um( pnu4treoxf3tatlaDeau o t0t2ur(m3oydlm  mics (fa2rmxroou0aee mf3tysfmDumnmont4tlxnio tatoaDe u o s) rur(r3iudlltnmnvsas) Dtr( oot0apxnmfeiatfs um(vsnu4aleoxfctadopDraivo;t0 exoxmpnu4olenlncsls s2uru onu1alenmo3tydla2ra( on(0areoxfcootfat aueo;s s2toio iudoptnmivt sfsrrax  ou4tpx  oetad a2eluvo u)aexomo oo1lm  lues;(  exrxr3ny4apee fcsls sDur(mpno1oexoio3iat s2uluvo;(0 rxrmfciytfp  aneo s)teur(m iu1ol  mfetlsf Drm( oou4tpeoifciyslmDuanmo t0texoif3tatfpDr nvo t t2xm(o nydal e fes (f rrru ooo4teen i3tytls ua(mp;(4 rtomoctodopteanes s  2xo(r oo4lp emictltfa2rmuronu1oet  f3iaslm2rluvs;t0aeenxf3tatom   ivol(0s2uoxo3io1olt lneil( sDrau onu4aex ioetydls elnvo u4 lxriocoatfatrlu ol(0 rxrim iy4ll elfeilsfs2rr(m nt4tlx iietls aDumnms (4 eerif3iy1omD  i ilt0s2xm(m no1ap  mieilt)aDtau ono4altn fcils sDrl(ms;u4alenmr iatfm  au o s)srxmxrpno4lle lnvtas)sDra(ronu1opxoioeiadfsDel( pn(0teeomociydlate uvs;(0 ruo(o nydllenmieilt) ruru pnu0opxo ociytlaDeaump u4treomf iodoat aues;t sexo(o3no1olenlfes (  Dtmx pot1olto f3tysfs el(mp;t0texoio oatfmte uvo t  etrxm3iy1apt lnci s sDrmxr ;u1alxo ietatlm ean snu0aeerir3ootfa r uvolt)truoxr3io4amt  fcsat)a2tmx p;u4opxnmoctat aDeauvo ()tleomr3iydfmD ai s;t) 2trxm3oy1ape mnctasf Dra(m ;u1texomf3tlsfs2emumpnu) lxoiociytlaDeauvo s s2trir3iudlmtn ietls) 2tm(mo;t4apxomiciyslm2rln s;u0 rerio3ta1oaD  n o;t srtoxm3oo4lme micsl(  rraxm ou0tleo oeils m rm(vp u4 lxoxociatomDr ivs;(0t2to(opiudll  mnesltf Dtrur ;u4aeenifetltlm uan snt) ltnif to1lpDrau o;s0 rtm(m3oudap emivil(fa2taxr ;u1altnifeilslm2emn snt0 lxrmfctotfatelivo;(  euo(r io1lmeelfviltfs2rrxmonu1ope ioetat mDeauvont0tltnxo oy1op  livo;(  rtr(mpiy1lm nmiviat s2rrumoou0alenmfetldfm uau s;u0aexomfcta1lmtr ivols0srxr(o3nydopenmnctas srrax p;t1oeeomfeiys a emn s;(4 rtrmr oydfaDrai sls  2urim nudapt  ivi s s2tru pnu4tltnmociatlsDeaumsnu) rtoxr iotla   nei;t0seumimpiu4ol elfciat) Durx p;u4tle mociatla2el(vo u)aeeomf iodlmDraieo;t teurimpoy1amtnlfcil(faruau  nt0olen feiyd s2elu o u)arxrmr3oatlpt lu slt)t2xm(m3iy4lp  mfct (  rrmxmpnt4ope mf3ildfa em(msnt0 rxnir3oytfaDraues (0s2xoiopiodllenmfct ()arrrxr no4aptnifcildfa2rm(vpnt0tlerxo3iydlptr nes ()srurimpoudlmtnlfviltf Dtrum nt0aet iicilt s2rlnvp (0 etrxo oadlpD  nei (0 rurxm3nodap  mivs s)srrru o;u4aptnio3tyslm uanvo;u0 exrir ta1faD  n o;(0 2umir3no4ol nmicsat)sDtr(r ot0opxo o3tat s rm(vpnt) exoxr io1lmteanei;t0seumxr oydlpe  feia(farurum ;t0aexo oetyt a emump u0tltoxf oodfp elu s t0tetmio ny4lltn fvslt) 2ta(rpoo0alt  ociyt aDrauvs;u0aeeoxr3oo1lpDrluvs;()srur(opiy1ome lnesl(  Dtau p;t1aleo fciytfa eanvs;u4texnircoo1opteaneo ( srumirpno1ll   fcsa()aruau  nt1altnio3iys sDeanmp u4 lxrif oy1lmDr n sls0texmxm3ou1apee netatfsrrmx p;u4opx mfctltfa rmuvo u) rxrmo3iadom e ueilt) exmxopnudlp   ncsatfa2trxmp;u4apxo oetasfaDelnvpnt) lxrmf3oydom elu s;t tetmio oy4op   ivtl( srur(rp;o4teenmo3ias a2emnmo t4alxoxf iodfm  liesl()trxoxr no4ll   ics ()srrr(moot1oex mf3tltlsDelumont4tltomrcoodoa  aieo;s)setr(m3ou4aleelicsas artrxr no4oeeomiciyd s2eln p;(4alxrmf3ty1fpDeai s;s t2xmxr io1lmte fvia( aDrax  ot4aex  feiltlmDranvp;t0 renmr iy1lpt  nvs;(0s2umxo3oodamen fcsatfsDrrxmont0tet iociyt sDea(vpn(4texrxrciy1lmDeaieol() euoxmpoudam   ivias aruaumoou4tpx moeildla2rm(vo t0 exnxf tatfmDrlieols0s2uoxm iodlmt mivt (f rtr(ro;u0ape ioeiyt s el(mp (4 lenmf3oadoateau sl(0 exrxrpoodamt mfvs t) rrmu pnu1alto f3iytfs raumon(4 lerxr3io1laDelneil() ruo(m3nudalt  fes s)s2taxm ;u0altnmoetls m2rl(vs;u4tltoxr tydlmDelu o;()seurir3io1ame  icsa()aruaumonu0aexniociyt a2el(vp t0 reniociadop  li i s0sexoim3nydam   netlsf Drauro;t4oeenifciasfaDuanvpnu) eerxfctodop eaieo t  2umxm3nydom  mictlsfsDrrumooo4oex  f3tatfa2uln s (0altomrcoodlmtelues s0tetmirpou1ll nlnvs t)sruru pnt0opxoioeiydfs2um( o u4aetriociodlm  livo t texoio nu4omeelfeia(fs2trx pnt1aexnif3iasfa2rlnmpn(4trermf oydlate n olt)t2ur(rpny4omtnmici (fs2ra(r ou4alxoioeiydlaDeaumpn(0aleomo3tytomt  nes;s0trtrxmpoydlleemfvias  2tr(  ou1oeenifetydfa ra( s t4tlxrmfcta1oatr uvi;s0s2tmxm3nu4oltn ivt s)s2urxm ;o0tex  oeild a2emuvo ()texoxf3oytfpteai i s) 2uo(o io1opte nviatf 2tr(rpoo1teeo ieiydls2rm( pnu) etnmo totla e uvs;() exrxm3ou4omt mivil() rumu oot1aleo feiydfm uluvon()artnmf3ia1op r ivo (0sexrim nu1omeelfeils srur( poo0tlxo ociadla2ea(ms u) leoxo ia1latran i;t0t2trir3oodomee icsat  Dtrx p;u4optnmfeiasfm rl(msnu4aleoif3iy1omteai olt s2tmir oudape lnesat) rtrx  ;t1tpenif3tydfs um(ms;u)aeenif3oa1oa rauvi ()tetmim3oydoltemiviltfsrtr(r no1optn ictyt sDra(mpn(0tlxomrctatomtrluvil(0 rxo(opiu1amenlietlt)aDrr(rpou0tpx io3iyt sDraumo;u0tltomf3io1fp r ues t  2uoxr3iodap  lnvtas) Dtaxmonu0opt iictad s rlu ont4tltnmociytlmtrlieilt)seumimpiudamenmnvslt srtaxrpnt1tptoif3ilsfmDranmsnu4tlerxr3oy1om e uvi ( srtrxm nydolenmncs sfsrrmumo;t1aetn oeiad s ul(ms;u) etrioctatomDr nvo;t)t2umxopiudomtnmicsatf 2tmurp;o4oexnif3iadfm2rmnmp t4 lxnxo3iy1fat au o;(  2ur(o ny1op  mivsasf rraxrpnt0olxnmf3iadlaDuanvp t0tetoif tatfa  livs s)texr(o oy1lltnlnei sfsrtax  oo1oeen oeildla2em(vp;(4tltriocoodomDrauvil()teum(o no1lm e fci t  2rrxrpnu4tlt  iciatfs rlnvp;t4tlenxr iy1lmtrln i;s0srtmio io4ll elncs tfsrraxmpoo1tltnifeiatfm2rmuvp t4 ltnir3iotomD  nvi s)seumimpio4altnmivils) Dum(r nu4texnmf3tydlaDrmump (4tlxoxo iadlmD ln o () exmxm io4lmtnmfes ()a2tr(mono1alto f3iydlm rl( o (4 eenmrcootfaD aivi ()trurxm ny1altn icsat)sDrmurp;u0teenmi3tytfs2uaump (0alxoircta1lp eli i ( teuoimpiy1lleemnesat)arua(rp;t4tlxomf3iatls el(vp t0 rxoxf3totfmDelnvi s0trto(rpno4opt  neiltf 2uax pno0olx mfeiadfa eau s u0alxrmociy1fmDrlueils)trxmxopnodom  mncsa(  Dta(  nt0apeo ieiatfs2uanmsnu) eenio oadfaD an slt0 eur(r ny4alte fcsa(fs2uaur no4opx  ietasla umump;t0 renxf oy1lp   nvo;t0trtrxm nydopenlnci tfsDtmxmpoo4tle mi3iys sDelnvo u) renxrctodfateln i s0srto(r oydlmee fvtl( a2rm(rono1oetomfcild m em(mpnu0altnmfctadom eluvi t0srumxmpoydlmeemfeias)arumxrpno0tetnmi3tldfa2el(vpn() renmo iydfm   neils)sexo(rpno1om elietlt)arrrxmpou0oltoio3tlt s2eauvsnt4altrmr3oy1fmD  n il()setoxrpny4apt mnvias)srraxmo;t1teenioeilslm2ul( snt4tlxrxr3oytoat  neo;() etmio3oudap  mncia()s2rm(r nt0opeoifctydls ua( s u)altrirctydlpDr ueil( trxo(opny1ale lnctat aDtm(m no4tpenmf3iydfa uanvpn(0teenmf iadlp  lnvo s  eur(rpio4lp   ncs ()aruaum nt1olxnifeiydfa2rl( onu0arxrifciy1oa  lu i t  rum(o no1ape  fcs s arrru pot1oleo o3ilsfs2ra( on(0tleoirctodlpD aueo;t trur(mpio1lpee icias)arumxmp;o4alxo f3tls s2ul(mon(0aexoir tydlmDraieols0srxmxopiy4omenlfesatfsDum(mono0oee  f3ilt s ul( p u)artomo3totfm e neolt0t2ur(r nodop   fvsat s2uaxmpno1opeomfciytfa rlums;u0aexrxfciodlpD  ivs s0sexo(m3iydlp n icsls sDta( pou1alt  oeildfsDuau o;(0arxoio ty1fpD  uvs;s  etrir iy1lpeemnviasfsrumu p;u0oltnioetltlsDranmpn()aeerxr3ootfmDrluesl( sruo(r3oudlme lict ()aDtaum ot4tleomfeiydlm umnvo ()artnxociatomDraivo;t seurimpno4op nmieslt arururo;u0aeenifeiydfmDemums () lerxfctodfmtrlnes;( sexrir3iodomt  icsas a2tm(r ;o0olxnmieiltfs eau o;(0arxoxfctadfa raieilt trtmirpio4lm emiei t sDurur nt0opxomoetas s2umnmp (4 rxniocio1faDraiesls t2xmxr iudll  mncsls srrr(r nt0tlx iociatfa rmu p t0 rxrmo oy1omtrlivol(0sexm(o3nu4ll  mivsls)srtm(roou0oex iieiytfa ul(mp;u4 rtnxrctatoa   uei t  rxo(r3oo4lp elnct sf Drrxrp;o1tlx mictas mDrau o;t4tetnxo todomt  uei;s srxo(opiy4amtnmnvtasf 2tm(ro;t1aet  i3iydfsDranvs;u)aetoxfcoatoaDrau s;(0t2xrxmpiodlm elict tfa2tmumpno4ope ifeilsfa2emnvo u4 etomoctydfaDeaies;s t2tmxr3nudol  lfct s)s2rmumo;o0tlen ieiltfmDeaums;(0altnmf tatom r ieo;s)sruoimpoudalenmncsl()sDrrxmoou1optomi3iys aDem( sn(4aetrif3oa1fat an s;t)s2tm(mpou1ame livsa()s2tm(rpoo0altoiiciytla2ua(vp;u4aexoirctadfp  an il( t2trio3ou1opeemnciat) 2tm(rp;t0aeenmo3tydfm2rmnvs u4 reoxr totfp rauvo;t seuoxopio4lm emiesls sDua(mo;o4ale ifetltfm ulnvo;u4alerircootfaD ai o;( s2xmxr iu1op  mics sf Dtru  ot1tlenifcilt a2rluvpnt) ltrio3totomt  ueo;(0seurir oydoltnmfvtl() 2rax p;o1oexnioetaslm2ran s u)trenir3oatfat  nvsls0t2xmirpiy4ap emfei () rtru ont4alx mieiltfs2rluvs (4artnio3oo1lp rauvil( t2urio ou4lptnlfvilsf Drrump;u0oet  i3iyslm uluvpnt)aexrmo oy1lmDr nvi (0trxmir3io4apt lieils s2taurpou0olxnmi3tls a2ranmp;t)tltnir3oadlmD luvs;s  etmio iu1om nmfci ( a2ta( oot4oeto o3tltla2el(mp t4 leomfcoatoa   iei t0trxm(o nudomt lncsl(fa2urxr ;t4oeenmicildla2eluvsn(0 exnxf3oydla eluvs;t  ruo(m3oy4apenlnctat sDta(r nt1apxoioeiydfmDem(vo t4 exoxocta1fpteaueo;s teumio3nu4lmtn netasfsDuaxm oo1tpxnmictytlsDeaumo;u0 lxomf iodfptr neo t0srxrirpny1ale mnesa( srumurooo4tlt  f3tadla2rm( s;u4tltnmo3iatopDrlneo ()srumio no4llt  fvtl(fsrtaurp;u1teeomieiytlsDulnmp u)teermrctytla e uvolt0setm(o3ou4al nmnci s sDtr(  no4opt  f3iys sDeluvsnu0 eeoio3todoatelnesl( tetr(opiy4om e nesltfsDta(mp;u0aptniiciatls ul(von(0alxnif ty1laDrlnei s) rtmir3nydlp  lfeiasfsDumxrpot4oeenmocils s uanmo;(0arxnifcoy1lptr uvo;s  exmio3nu4lle mfetas) rtr(mp;u1aptnmfctad m ea( s (0aeenxf tadfm e nvols  2umxr nu4ol  livtasfsDurxmo;o0tet  icilsfmDul(mpnu)arxrmf3tatfm elueo;s)t2xo(mpny4alte fvsls  2umur ;o0oeeomfetad a raump;t) exniocoa1oa raieil( t2xoxrpny1opt lnetlt) Drmxmo;u4olenmfciadfsDemnvo;()aeerir tytlmtelies;t0trxr(o io4aleelnviltfsDumxm ot1tleo iciasfm2rmu on(0arxrir iatomDrlivilt teumxr3io4llee iei t a2trump;o0apeo feiatfmDumnmo (0tlerif3iydfaDr ivilt)t2tr(opnodlm elfetltf Duaumpnt1tlt ifctys a ua( p (0 exnio3oa1faDranes t) etoio no4lpeelicsl(  2ta(mono1opt  oetydfa2ulnvon(4 etrxo oytoate n ols0texo(o oudlpeelfci s)s2rm(ronu4tpxnifcildls2ulu p;(4tltoiocto1oa  lu i (0trtoxopou1lltemfci t) Dur(mpnu0tpxo f3iltfm2em( p;(0aeerif3oadoat ln i s)s2uoio nudamte ncslt)sDrmum nu0alenio3tlsfm umu o t)tlxnmrctodfmD  nvo ()tetmio3iydop e ncta(  2trurp;t4tpe  ociltlaDum(vpn(0trenmfcootoa e ies;t0t2xo(o oo1lptnmneia()s2raxmpnt0tptnio3iltls ua( onu0arenxr3iatoaDrlu ol(0srxoxmpio1am nlici (  2trum nt0olx mi3iad s rmn o;t4tltnxoctadfmDraivs (0s2ur(r3ou4amenlfcs ()arrax  nt4olxo octyt sDea( pnt)tlxoxfciotfp  anvs;s)trto(o oo1ll   nesas  Dtm(moou1apt  i3ilsfm el(vp (4tlerir oodlp   nvo;s0srxrxm oy4ll nlfvsat  Dumum ot4texoio3iltfm ran o u0 lxrmfctytoatelnes ()t2xmxo nydolte nei s)srraxmpoo1tpx  f3tltlmDel(ms (0tlenmfctydlat  uei ()sruoiopiy1lle  ivi sfaDumu oot4tlxn i3tatlm uanmpn(4trtoxo3tadlat aivo s0trumxm3io4alt lies tfsrtrx pot1olx mi3iydfsDelu o;u0aexnmocoy1lp r nesls0t2uo(rpny1amtnlfviasfs2rax p;t1tlxn fciatfsDemnmonu)arxnirctatomtr u ol(0texrxopoydamenmnvslt a2tm( pot0oet  oeils aDeau p;u4 eerircoatoatean slt)setmxmpny1aptnlict t)sDtrumono0opt  o3tlsfm rl(mp;t0arxrmocoodfpD lues (  2umxm3nu1omen nesa() rur(m ;o1apxniieiytla2ea(vs;(0aexomr iodlmD auvi ()t2xo(r no4am   iciasfaDtmxmp;u4tpt mfeiysfs ul( sn(0 ltoxr3ty1fa   uvolt  2xmxm3oy1al   ncslsfaDurxrp;t1oee mfctadlm2rmu s;u4 eeomr3iatopD an o;t0s2tmimpiudopt lncils) rrrxrpot0oeeomoeildls2ul(vo u4alenxf3io1fp   ivslt) 2xmxmpou4apt livta()aDrrurp;u0tpxo oeiys s2emumo;t4 lenxo3oydlmt  neo;( tetrxo3nu1oltemivsas)aDuau p;t0tlt  fctydlsDul(ms (4tetrxf iydlat anvol()t2trio nu4lmt lfcs s srum( ont0apxnmoetlsfsDulums;(0tetnxociytfm  lneols)s2urimpnodam elnes tfaDta(r nu1apxnmfcilsfsDumums;t)teermociydomD  uei t)setoiopou4op  mieiat)srtrur ;t1tpto ieiysfm ea( onu4arxnxo3oydopDr ivs;t t2xmxopiydlle mfei tfsDuru  ou1altomf3ilsls2eluvs;t4 leomrctydoateai ils)srur(r3ou1omte fvi s s2urxroot0tpx iicildlm2umnvp (4arenif3iatfaD lies t)srumir nudlmt liesatfsDtru o;o4tlxoifeiys s2em(vs;u0artrmfcoy1oat li i ( trtrxm3oudapeemnct sf 2ua(ro;u4tpx iictld s emnmpn(4arxomfcio1fm e nvils)texr(mpiudlm nlfcil(f 2ur( oot4alt ifeiasfsDemnvsn()aetniocoa1latrlnvo;s0 rxo(o iy4opte iviat) ruax  no1teto ociatls elnmsn()teeoio3todoaDelnei;t0t2xm(o nudop n fvt t)aDrmum ;o1aexnmfeiasfs2rl( pnt) reoifciadfat luvs;t0seum(o nu1lltnlietasf rtaurpou1altn oetydfa2rlumo (0trtnmoctatlmDrauvols tetoim ny4omeeliet t)sDtax pnt0olxnmoeiyslm ea(vont4 rtoxo oydfp e ivolt s2uo(m io1al  mnetatf Drrxrpot0oleo ocils aDel(mpnt)teenifcoadlp raneols0truo(o iydlltemfeta()a2trxmo;o0tpto octatfmDumnms ()altnxrcoatopDelneo;t0srtrxrpou1omenlfei tfaDraxmo;o4opx ioctaslmDrl(vp u0arenio3to1om  livi ()t2um(mpio1al   ivt (fs2ur(mooo0tleo ieiadfa2elumpn() renxf iydlm  aneo;(0 2xoim iu4lpeelivtasfaDumump;u4alx  fciysfmDulu p;u)artnxfciadlaD luesls t2uoir ou1optn fvi ( srua(mono0alenifeiytla2uauvp;()texnmrcto1oaD luvo;t0 etm(m3no4am  mietlt) Drau ont1tpen ocils a umu s (0 exoxo ta1fpDeaies;s  exr(o oodapt  ivsa(fa2uaur oo1apt mictldlsDrmump;(0 etnmociodfmDrau o;( t2urxopnodoptnmnctl(fartaxronu0apxnmfeild mDem(mont) ltrir3totlmD luvs t)s2uoxmpiy4lleelfei ( sDraurpnt1tlxn f3tldlm2rln ont) exoir oadfmte i ilt0 2xoir oydoptnmfesl( sDtaxmont0tetoio3ilsfmDulnmp;u) leoif3ootfmt luesls0seum(r3oodomtn neias sDrax p;o0optn fciys sDem( p;u4 eenxr3todlptelies;s0trxoxo iy1lm emfct (f Dtr(rpno1tlen f3iadfm ulnvo u)alermrcto1faDr uvsl( trtrxr3no1lltnmiciat  Duaxm ot0tpx  icilsla rlnmo;u4tetrmo3iodomDeln slt  2urirpnudaptn netat aDrau o;t0tex iiciysfsDul(vont0aetrifcoodlaDelivs;t0srtrio iu4om  liciat srtaumooo0oee  f3iyt a emnvs u) rxomr todoaDrlnvi s) 2toirpiudalenmnct s)srta(ro;o4tlxomieiytlmDrmu on()trxnmf3iatfa  livo;(0srto(mpoodlm   fvslt) Dtauro;t4aex  ictysfm2uanms t) etrmfctadfpte i s;t0 rtrio iy4op elfes s) rrrx o;u1opeo ietasfsDuau p;t4aeerir iatopteluvs;() eumiopnodoltn nvtlsfartr(ront1ape ii3iatfa2uln sn(4tlxnmfctotfatrli i;(0 2xoxo3iy4om  lfvs sfa2tr(m ;o4aexo o3ildlm2rln snu4 rtoif3iytlm elnvi s  rtoxrpiydlmt lnct ()sDtruro;o4ole mfeiysfm2ua(vp;u) lxnxo3oytoa   ivi;(0trurxr3nodalte ivsl( sDua( pno0teeo iciadfmDrlu o u0arxomrcoytfp e nvi;t) rum(mpny1ole  iviltfa2ua(  ou4tpxo ocias mDeauvpnu0teermr3oo1optraues t teum(mpiy1lmtemnes t sruaur ;t0tlt  f3tltla uauvs (0 rerif3iotla  au i;t)trtrim3iydolenlnet sfaruaum ;u4tex ioeiaslm2ua(vo;(4arenmf3tytfp  aivi s0 2trxr oy1aptnlfetl()srum(r ;o4olxn ociasfm ra( p u0alxoxfcta1fptraivolt  2tmirpoy4lp n neta( srua(mpnt4oleo o3iaslmDem(vs t0aexnmrcoadop r i o;s) etoxm no1ol e ncsls)artrx oot1tlxomoeiyd s rl( s;(4tlxnmo tytfa  auvi s  2urxo3no4alen ncsa()srrmx  oo0tetoiicils a2emn o u4treoir todopDrlies;t) exr(r io1ope lfeslt  Dua(  no0alxn fciydfa uaump (0 rxoio3iodopt aivi;t)trtoxm3oy1ope licsas srrau p;t1tpxnifetas sDelnvo;(4artnmf3tydoaD auei s s2tmxmpiu4apte fcs tfs2ur(r no4opt  fctydfm2em(mon(0tlermo3oy1fa  li o s t2tm(r oo1omeemnvias sDtm(mo;o1tpenmfetldfaDrmn o;()trxoxr3totoatelues t srur(o io4am e fei sfs2tr( pou1aetomf3tlsfsDrmnms (0tltoxoctydlpteaiei;t) ruoxm nydame lnvi tf 2ua(m ou0oeto oeiaslaDeau p;t4 lxnir oytom   ivo (0 etoxrpiu1lp   ietlsfsrtru pno0alen ieiytfa2rm( onu) rxoxr3iotfaD  nvi;t0s2xm(m nu1ol  mieilt  2rm(  ;u1aptnif3iyt s umuvsnt0 etomrcoytfm ran slt0 ruriopoudamtelieia( srtmur ot0oeen f3tlsfs ua( o;t0trerxrciydoatean ils)trtrxo io1alt  nciltf Dtmur oo1apeo o3iad s elu s;u)alxrxr3iydfpteanvslt s2xoio oy1amee nes s  2um(mont0oleo f3tysla emn o t)aeeomo iytlm e neslt0srtoimpoy1lmtn ivsa(fartmxmp;o0opx ifeiasls eaumo;t)tltnmfcoatoat  uei;t0 exo(r no1ll elfesa(f 2tm(mp;u0tpx iocildls uauvp u4texoif iatfmDe nesls)srtrxo3ny1lmtelnvs (  rrrxmonu0aee moeiyt a2ea(msnt0 rtoir tadfaD  nvo;()sruo(m3oo1lmtn ivtls a2uaxmoot1olxnifcilt a ra(vpnu0trxrxf3iytfaDraieslt)srtoim iu1ope livsas) 2trx p;t4oeeo i3tytls umnmo t0 lxomrcty1lpDrliei;t  euo(m nu1op nlnes t)srumx pot0tptomf3iad a el(vo;(4artrxo iadfat lies;( setoxmpnodlme mncsas) 2rrurp;u1opxn fetyd sDuanvp u0tltomr3tydlaDe n ils  ruo(o iy1alt lietlsfsDrrxm no4teenmietytfm uluvo;t)altoir ty1om rlneolt teuoiopoudll e fctls  Dtm(mo;o4apenmfeildlmDrau p;(0 lxoir3ia1lmDeln i () rtrxopoo4lm e neiltf Dum( oot0tpxoioeiasfm ul(mo (0 ltrmfciatfpDeaneslt t2xmio3no4lpt liesa()s2uau  ou0tet iieiadla ra( o;t4 lermf iodfm rlu o (  exoxm oo4ome  ictl( arrmxr nt4oeenmoeildlmDemnms;t)trtnmf oytlaD  neslt  exr(rpiy4ol e fctlsfsDrax  nt0alx mieilt a ulnvs u4 etrxfcoy1fptran o (0srxrim io4aleelnvsl(faDraxrpot4oleoioetadfa umuvont)tlermf iotop rlivi;(0 rtmiopnu4apenmiesas  2rr(rp;o0ape iocilslaDrluvp t0texnmoctatfatelivs t)t2to(opio1am  lnvi ( a2rrump;o1oet mo3tltfa rln o;(4trxnxo todlaDe ivo;t0t2trxr oydlptelnci () Dtm(rpnu4tetn feiatfa rm( p ()alxnmf oy1lpt auvi (  eumxm3iydomeemfvtls)aDua(  nt0tleoio3tydfa elu snt4 rtrmoctodfpDe i s t  ruoir3ou1ale  ici tf 2tm(rpou0oex mfciytfmDrau p;t4texriocoa1omDelieo;t)trxrxr ou4lp  livtatf Duaxrono4oexnioctls mDumnms;t)arerio iadomtranei t0 rtoirpny4ll elfeslt arrmxroou4teeoifetaslsDuau o;u4trxomf tadoatranvils0trtmxm3iudamenmfvtls aDtaum ;o0oltoifciatls2um( s;t4tlxoxr iatlat lnvs (0 rum(o3nydomtelneslt)sDrmx pou1optoioctydls2ulu ont0trxnxfcoatlpt aneo t0t2ur(mpiy4ome  ies ()aDumxmo;u4aet  o3tat mDemnvo (4 ltnio3iatfmDe n ilt0s2urxr3oo4ap nliesls sDrrx ono1ope  icildlaDuluvp;u0aexrxr3iotomD lneo (0srtmxmpio4lm elnvsat)arta( p;u0tlen ietlsfsDeanmo;(0alxrxf3tytopDrli s;() ruoirpoy1amtelfcils)sDtax p;t4optn ociad m ea( o u4teerif3tytomDrluvslt srtr(r ou4am nlfct s  rua(root4tex mfeildfm ulnvp t0arxnmfciytfa eauvolt) 2toim3iy1lm  mfcsasfsrurxmoou1alx  oeiys m2ua( snu)trtnxr todop raneo;(0 2xmio no4ol   fcil()artrxro;u0alt  oeildfm2um( p t) rtoif ty1fa e n o;t)setr(opnodop n ictas artaxrpno1oexomfciadlsDrl(vo ()trtrmociadoat aiei;t0s2toir3nodaltnlivils) 2rru  nt0aleoifetysfmDemn pnt0aetrmr3iodlaD lnesls)t2xrirpiu1aleelfctlsfsrumx  no0tpxnifctatla2ul(von()aleoxo oodopDrli i;() rxrxopio4lp elnes sfarrm(  ;u4teen o3iad m2rmn s;u4treomo oy1lmt lu s;( srxr(m3no1om  liet sfa2rrumonu0aexoioeiyslmDelumo () rtoif to1oa r n s;s srxo(o iydlme livt tfs2taur ;t4aleoii3tldfs2rmu s u4arxrir3todopDe ues;(  exmxrpoy4opte nvt s)s2rr(mo;u4opx mo3tltlm2rl(ms (0 lxoxo iotoaDrlueilt s2xrxopiu1lle lfviat  Dra(mpot0tlxnmo3tyt m2umumo;t) exnxo3tadla eli sl( srtm(o oydal emiet (  2umu p;o1ale iietatfm2ulnmpnu)trxrxo oydomtr u il(0s2umxrpny1alenlncsat  Dtmurooo4olt mo3ilslm2rlnvo;() eenmoctatfmD aneslt) rtrio3no1lpe mnei tf Dtrxroou4aeeoio3iatlaDemuvo;u4artomrciadfm e ueo;t)s2tm(m3iydole lici sfsDta(moou4optn fctys s2el( s;u0 rxnxf totlmD  u ilt) 2umxr iodol nmfvia(  2rmum ot1aptoifeiytfsDraumpnu)tleoirctytlptelnvil( t2xoio3oo1ole lieiatfaDuaurp;t4tee mieilsfsDra(ms;(0texoif oytom   ues;t  exrimpiodamtnmnvs t)s2taxm ;t4alto o3tlslsDea(vsnu) lxrxocoatfp eliei s)setoxr3nydlmte ieiltfs2rru  ;o4tpeo ictadla2ul(mo u)tltrxf3todfmDranvol()srtrirpno4lmte nes ()s2rmxr nt1opxn f3iltfmDemn s u4 ltomo3oo1fmD anvi ( s2xrio iydame mnvi s)s2rruronu1olenmi3iad a2umnmo u0tlenmrcia1oa eai o ( texmxrpnudol emfvta()s2rm(m ou1olto fetld sDul(vpn()trxomocia1fmtr ues;t)srxmimpoy4om  licta( srtmx pot4aleo f3iasla2rm( pnu0arxnmr io1lp  livs;s0 rtr(r3oudoptn neils srua(moot4oexnmf3iysla2rluvs u4texoxo3tydlm   nvolt0trumir3oo1apenmnct t)s2rau oot0tetomociadfm ran sn()artnif3totfm rau s;t s2xrio3no1ll n fcs (fa2ra(ront4oet ioeilt m rm( p;u)trxoxo ta1fpDrln s;t0t2xmxopoudoleemicsl( aDtrump;o1alxo i3tydfaDumumonu)tlxrircootfa r ies s)s2trxmpiu1lle mfcta(farrm(r nu1oee  iciadfs2elumonu4texrifcootopD  ueols s2xrim nydopen ivt (f Dtr( poo1olen oetysfs ulnms t0aeerxo iadomte iesl(  rumxmpnudom elfeilt arrrum oo1opeoif3ild s em(vp;u0teeoxr iodlat ln s;s)t2xm(opou4amenlfvtl() rtr(rooo0olt  oeilsfsDeanvs t4tlxnif3oy1lmte n o;t  2uoxm nudopt  ieslt srtaum oo0tetn ieiltla raumpnt) eenxf oodfaD an o s)tetrim3nudom   feilt)arrr( oot4opeo octadla ua(vp u0 lxrmo oo1fmDrln o;t0 exm(mpnu4ll nmfviatfs2rmx  nu4aexnmociatfsDra( s t0treoifciytfaD lnes s)srtmxo3nydaltelnei s) rtr( pno0alt mictat s2uauvo ()trxrxr oytomtrauvils) rxmxm3iy1lpt  ietasfa2trurp;o1altnmoeilslmDran p (4 etnmo oydoatran ols tetrxr3oy1ol elneta(fsDra(mono0tlxnmiciytla2rmu snt) lxrmrctotop e n i s0teur(o3iy4al   fvia( arta(m ot0apxoio3tlt a2rmn snt)tetomf3ta1faDe i slt0teur(m3nodlpe  fetls)a2rax pno0tptomoctls s eanvo;u0tlermfciotop elnvs;s)t2xrirpoudlme  fcia(f 2tr(ro;t0oltn fetaslmDranmo;u4 reomf3iotlptelu s;(  rumiopiy1opee ivsl(f 2uru pou1ope  oetydls2ra(mp;u4tleoxo3iotomDe i i;t0 2xoxr3nydlp e nvi sf Dtmxr oo4aex mfciltla elnvo;u4tlxrxfcio1opDr i s;t t2tm(mpiudolenlnesls) rtmxmooo0ape mfeiys mDranmo;(0trtrir oytom raies;t)seumiopoodole mieslt srumxrp;o0aeeoioctyt aDrlnmp u)tlenircoydop rluvsls srtmxmpnu1optemnes t aDta(m nt1olt mieilsfs ulnvp t4 rxoxr totomDrln ol( teuoio3nudap nlivils)s2rrurono1optniictls m rlnvsnt) rtomo todlpt li i (0 rtm(rpny4op  micsas a2um(m ;t1aet iieild sDul(vp;(4altnir3tydfaDraivo ( t2um(m3nodlp nmfctlt) rtrxront0tltoioeias mDran s u)trermoctodla raieolt  exm(o no4ll elfvt tfs2rau pot4aexoio3iltfsDuanmpn() reoir iy1lpD aies s)sexmiopny4olenlfvtls) 2uau pou0altomo3ias mDul(mpnt4 reomo iodlateau sls)seumxrpio1aptemiet tfsDrmxroot4aptnmicils aDem( ont) lenxo3iydoatrlues;t  2xoxmpnu4lmenlfct s artr(r ou0oex mfetat s2ea( snt0aexrxr iydoaDranvi t t2tm(o oy4apen ictas sDtaumoou1apenif3iadfm2uanms (4trtrmocoydomtrai i;t tetrxo nydoleelnvtls) 2rmuront0tlxn i3ildfa2rm( p u4 exnif3iodfateanvi t0 2xrir iy4ll emfcs s)a2rm( p;t1apx mfciydfsDumuvo;u4areomocty1fatr ivs t)seto(opoo4aptn nci s  Drr(rpoo1alt ifeiydfm2uan p u)alxnmociydom   neslt) rxoirpoo1omtnlivsls s2umxrpot4apxomo3tasfmDum(vp;u4 exnxf3iytlmD anvsls seumim ou1opt lictat aDrr( pnt1ale mictlt s2elu s;(0aleoxf3ty1fmD auvols) 2umirpno1al  lfcsasf rumump;o1ole ifcilslmDrlums;t0 etrmrcoytfat luvsls srxmiopiudll e icta() rrau  ;u1tee ifetydfm um(mont)tlxomf totlaDeaneo t)teurio3oodlp nmivia( srraxmo;o1texomociadlmDrl(ms;t4arxoif to1lm e ues;s trtrir nudlmee iei sfaDtmum ;u4open f3tldfs ua(mo t4aexoirctydlaDeauvs;t teuoirpou1ameeliesl( s2ua(r nu1aleoii3tyd mDuln pnt4 exomf oatlatr i ils)setoiopoo1llenmncsltfaDrmurpnu4altn oeiys a rmumo t4trxrir3iytlmDeauei;s srtr(rpoy4altn ici ( a2rrum oo0olxomo3iasfm rl(msnu4texoif iotomD an o s) rxm(m oodlmeelnctl(f Dur(  no0alxoio3tldlm em(mpn(0aexnxocty1fmDr nes s0seuoirpnu4lm e feta(fsrurur ou4tetn fciytla uauvp u)tltomf3tatla   n i;s)setm(r3io1al nlici t)arra(mpoo0tlx  fciatfmDel(mp (0artomfcoadfm e uvi;( t2xo(opnudlm   fet (  rrax  no1tlxn octydls2ulnmonu4arenir totlptrlivol( setoxr3iudope lnciltfsrtaxmoot0alx mi3tatfmDumnvpnu) reoxfciytfatrlueilt) rtoxmpio4lm emicils s2raumpnt0olx iieiltfs eauvsnu4 exrmfcio1lpDr ivi s0tetr(r iy1al   icsatfsDuax pnu0alxnmictltfaDul( p;(0aetrxr oa1opDrli o;s0 ruo(m3nudlm n feia(f Dtmxrono4aet if3iltlsDem( snu0 exniocoytlmt  ueol()s2xmio3ny1ole lnvilt)sDrr(rpou4teeo ietlt sDean p (4 etoiociy1lmte ueo;() 2uoiopnu4apee fciasf rur( o;o1tltniiciytfm ul( onu4alenxo3oo1fpteluvs t)sruo(r3iodapte iviat) Draxmonu0teenifcias s rmnmo u0texrxfciadla raivs t tetmim3oudlmt mncs t  2rmurp;t0ape if3tas s ul(vsnu0tetriocty1lmD aivols0s2uoxo3nodlpt mfvt t sruaxrp;t0tptnioctatfaDum(mpnu0texnxfciatlmt  ieils0sexmxo io1al e ivt s aruru  no1aexnmieiyd mDra(mp;u4arxrxr3iodoat  ivi t seur(o3nudomeelfviat) 2tr( p;u0aee  f3ias s2uaums (0 ltoir iy1la  an o;t)seumim oudlpte ictl(f 2rmxm nu1aeenio3iat a2rmnmpn(0teenmo todlm rluei;( tetmir io1lm n ncta(fartaxroot4olxn fctytlmDeauvpnt4texnxo3tydfpD an ol() rxrxrpno1lpenmivsa( aDuau  ;t1tltoioctyt sDrlnvo u) ltrxr totomt auei ()trxmxr ny4lm  mfcilsfartm(mo;u1ale moeiysfmDeanms;(4teermr iy1lpDelu i t  2tmxmpnydam   fct s srurur oo1tetn o3iyt sDrlumonu0areomrcoatlatrlueol()srxoio oo1ol  mictlt) rtm(m ;t1teen i3tyd sDeaumsnu0tlxrif3ootfate uei t0 rxo(opoodlm nlfei s  rurxmooo4oexo oeiadlm2ean p;t0artoxo3tatfp elu s t t2tmio iydlm  lfes (faDurxrooo1oexoif3iadlm2rmn s u)alenmo3oydlmt aneo;s0 2uoxo3io4omtnmivsatf Drmuront4aexn oeiyd aDem( p;(4alxrio3iodop   n olt)teuoir ou1lpte iviltfa2tr(ro;t4apt mociat a uau s u4tlermfciatlmte nvols)texrim nodlltemivs ( sDtrxr no1opto i3tldfs2eanvp () rtnxfcoodomD auvslt  exrxmpiy4ol nlfvsls arumu pno1tptoiieildlm2emuvpn(0 exrxo3iatfa e uvil()trurirpiudlpe  ncsat  Dra( pnt4tetnmo3ilsfm2rmu o u4tetoio3ty1lpDe n ils) 2umxm3oo1am  lfvi ()a2taur no1opxoif3ias mDra(mp t4 exnxocoatlm e ueo;t0 rto(r nu1lmeelnvtlt)artaxr nu4apxo oeiyt a2rlnvp;u0aeenmr totlp e ies () rtrim3nydoptelfvsl(  2tr(r ot1opxoiociydfm2ua( o;u0aeenircoytfaDrlueol() 2xmiopno4lm emfvtat artrxmpoo1apxn f3iatlmDua(vp;u0 lxnxr3iydopDe n olt  exoxm3nu1ameelies tfs2taxmpot1olenif3iydls umuvsnu)tetoxrctadfatraueo;(0t2um(o ny4lmenlicils  rrr(moot4oet  fetldlmDuanmonu) ltoxf3iatlmDe iesls)texoxo3iydaptn fci tfsrrrump;o0oetomociydfs uanmp () lenirctadfp eauvi s0setmirpny1ome lfcsl(fsDurxmpoo1opto fetltlsDumn pnt)artrxo ty1opDelnvol( trtoir3oo1lmeemfcs s)srta(rpou4aex mfctldla2umn o;(0arxnmr3iotlpD li sl(0seumxr3iy1ape mfesa(fa2urum no0olxnmieiasfm rmuvo;t4 ltomf3iy1lp e iei t)t2xrxopiudale  nvia( aDrmur no4oeenmiciyt a rln o () rxrio3iodla elnvils)trxrir nydopee ivslt)sDraurpnt0oexnmicias a2uau o;(0aeerxo3iy1fa e nes;s0sruoio nydaptnlnvt (f 2urxmpnu0tle ioeiat a el(ms;t4aexrxfcoytfaDrau o;t  2uoxopno4ope lnet ()a2tau o;u4oeeomo3tls m rmuvs;u0aetnmo oytfmD anei t)s2xr(m no1lpeemieiasf rtr(r ;u1apt  oeils s2ulu p t)tlxoxo3oodfmDeanes;t0 2toxo nudol nmieia()s2rmump;t1olx ioctlsfsDrmu o ()alxrxf iy1fmDe n s () 2toxo3oo1ll   nes tfartaum no4oeeomieils mDulums u0 rtrio3ty1fpDe n s;s  2uriopou4lpee fct tf 2tmurp;o4tpt io3ils s2uan p t) rxnmrcoatfp eaiei;s)srtrim3io4lpte fcsl(fs2tr( pnt1ape if3iltlm2rl(mo (4 rtnmf oatfatrluvi ( t2xoio ny4lpenmivslt aDraxr ou0alto feilt a2elu sn(0aexnxr3ta1oaDelues;s) rxrim3iu1al n ivslt srrm(ronu1aex ifeiatlsDrluvpnt4tlxnmr3iatfmt aueolt t2xoxo3iy1llenmicil(fs2ta(  ou4tle  i3iatfs2uan o t0tltrmf3tytlmte uvi;s0tetrxopny1ap n fvsls)sruru  nu0tpxoiictldlm2emn o u4alenir iatfmDr ueo;t  euo(rpny1omee fctasfaDuaur ;u0tpen i3ilt s eaumsnu)artnmf3oadlm e u ols)srxoxm oodapeeliei s)sDrm(mont0altnif3iytfs2ran ont) lxniociatlpDr i o;() 2ur(r iy1op  mfetasf 2um( pno0alt  feiltls2ulnmon()teeomfctotlpD li s;(0tetmir3oydlptn fei t sDrmuronu4apt ifeiyt sDra(ms;t)arxnxr ia1fpDrli il()trur(mpiy1amt lfcilt)a2trxm nt0tet  octys s rmuvp;(4 rxrmo3oodla  livi t tetrxm3no1op nmivtl()a2tmu o;t0tlxomfeiasfs2eluvs () exoif3ootopDrauei t0 ruoir3oy4ameelfeiltf rtaxm nt4ale mfciyt m2uln s () lxoxo3tatomDran i ( t2xoxm iudomeelicta(fsDrr(  ou4tptnii3ildla2rlnmp;u4 etnxf3tytfaD lu o t0tetmim3iu4lmtnlietl(  Duru ono0ale iiciytfaDuau o;u4arxoif oatfmD aivi s teum(o oo4opt lfvsls) 2um(mpnt4altoii3iyt m2eauvon(0 lenxf tatfaDrlnes t) rxm(r3iu1omtn ictls srtmxmpno0aptoiiciadfa2uan s;(0tetoxo oa1fa  auvi;(0 2ur(opiu1aleemiesls  2taxmpnt0oex mfctatfs2rmumpnu0arenmrcta1omDrlu ols)trxmio3iydaleemieias  2tm(r no1tpx iieiat s2ua(vpn(4teeoxf3ta1fmD au il(  2xoxm nodol elfvia(fs2urxrpoo0ale moetys aDuluvo t)arxoxr iy1fat  ivsls tetm(m3ny4oltn fciatf 2tmu pnt1aetniicild m rm(ms u4artnir iatlmtrai ils0 rxoxopoodamte ncsa(f 2uaxmpot0opt io3tad mDemn on(0aetoir ty1opt aiei s0truoim ny1lm elfet s aDraxmpnt0olto ociltls rmuvp u0 eeoxr3iodlp e ieo s trto(r io4ll  mfet sf rrmumo;o4olt mi3iytfs ra(vs t) rtoxr3iydom e ivs;t0 etoxr nydap n fetl(  rurumpot1openmo3tltfs2rlnmsnt0 rxnir iatfpDran i;( srur(o io1altnlnci t a2tax  oo1tpenmicild a2rm( s t)tlenmr3oytopD  ues s)tetrxr3iudom emiet ( sDurxm oo0tpen octld a2ul( o (4 renxo3tytfm r nes s0s2ur(opnodome liciasfsDua(rono0alxomi3iad m2em( p;t0texrxo3iytfptelnvslt0t2xrxopiydapeemnvt s)arurxrpot1openmi3tlslsDul(msnu0teeoxo3oatopDr uesl() rxmim3iu4omt  fet s)a2tmumo;u4apx mo3iatfs rlums u0 lenmf3iotlmDeau slt)s2trxr iy4lp nlnviasfa2tr(m ou0tetoiietlsla ulnmont0aexrir3io1laDraies;( t2umir ny4llt  ictat)sDrm(mpnt1tpeo o3ilsla ea(vpnt4trxnmo totfateaivils0srxmxopnu4amtemies sf 2urum ;u0alxnmi3iysfs2ra(vonu4artoio3tatfmtrlivo t)tetoxm3iy1lmenlies t aDra(m nu0tetnmi3tydfa2ea(vsn()alerxf3ootlmte u i;() euoio3nudape mnvsa(faDua(rp;u1ope mfeiltfm emu o (0 ltoxo tydla rau o () 2urxrpoy1olenmnetl()srrax pnu4apxomf3iltfmDrmn snt4alxrif3oodlmDraueslt) 2um(o oo1amenlfvsat) Drr( ooo0oleoifetld a2ul(ms;t4tlxrxf oadla  lnvslt)srum(o no1opeemnvi t)sDumu oot1apx  oeils a uan o;t)texnio3ia1op rlueo;( srxrxmpoydlltnlnetl(f ruru oot0apxnif3tadfa2rlnmp u)trermrcoytfpD  ieols) eur(r iudap emfvsat)aruaump;u4ale iietadfa2um(vonu4aleomf3io1fpDelieo s0sexrio ny4op nmiesas) rraumo;o1teen fciydlsDemu s;u4tlxoif3oydlaDeaieo;(0 2uo(o3io1amtn neils)sDra( p;t4tpxo oetadla eluvo;t) eenxr oytomt  n ols texm(r io4olenmfcsa(f Durxrooo4tet  f3ildlm uluvont)areoxr ia1oaDeaneilt)teumim3oo1alenmfviat sDum( p;t0tpt mieilsla eluvs () lxoxr3iatfaD  uvo t0texmir3nydap emiet s  Dtrum ot0apeniicias s ea(vo;u)texnio3oo1laDranvi (0s2xmiopny1llen iciat) rua(mo;t1ole mfeiydls umuvp;() ltoxf3oydla rauesl( trxm(r3nydalt livtas aDur(mpno4aexo oeilsla rmnmp;(4aeerxo todomDeanei s0 exoirpoo1lpee fet t)arurx pot4texoiociys sDua(vo;u4 ltrmrctydom rluvslt)s2toxm no1omtnlncs () rtau  ;u0olt mi3tldlm2uaumpnt)aexrxr tatomDe ies t truoxo oy4aleelies sf Dumur ;t1oet ii3iysfa2emumpnt0aexrxr3oo1laD anvsls0 ruoxm3oudlpen ici ( a2rr(ro;u1oetnmf3iys m um(vont4 renmoctytlaDrlies;()t2xmxm3nudaltelnctlsfsrua(  nu1oexn fcias m rmn o u0trenxr3iadoaDe ivilt0srtmir3ny1amtn fvsat s2ta(rpnt0tet  o3iytls umn o;t) etrio3ta1lpt aivilt srxoiopio1lmt lnetlt srrau p;t4apxnifciadls ul(vp (0trxomrcty1fmtr neo;(0tetoxr oy4ape  ies s srua(m ou0alxoio3iaslsDran pn(0altnir to1oa  lnvil(  rurir3oy1ll n fetl(  rum(m nt1optomfctydfs rm(ms;(0tlxomo3oytoaDe n s;t  rtmxm oy1lme mfesls artrur nu0altoioeiltls ulnvp t0texriocta1opt aneo;(0teurxo3iu1aptemies s)srtm(m oo4tpenio3tat mDumnms;(0tlxoiociotoatrlues;s)srurio3io4lpt livil(fsrtm( o;o1aex mi3iatls rlnmp ()tltnmo3oodfp ean s t0t2xr(rpnodal  mfei s) rrrumpnt1aexn f3iltlsDulu snt4altoxociydlmDrlnvs;s  2tmimpoo4llen icsas)s2ra(rooo4aetn ietlslsDelnms;(0trxnmr iotfmDeauvs;t0 rum(m3oydom emneias)srumxr nt1tlenif3ild mDrm(vsnt)trxrmr tatlaDe i s t0 rxm(m io4alen icsas)s2tmurp;t0ape  ieias aDrau s (0aeeomr ia1opD  nei s sruoxm3oudamee iet t arurumpnt4teto fciltls uaumpnt4artrirciotlaD aues s  2trio nydomt mici ( s2rrxmpno4aet ii3ild mDuluvo t) etoio3oytla r nvsl()t2uoxm3nodam nlnet s sDtmx pot4ape iieiyt m2umn pnu)tltnmr oo1lp e ies t seto(m3ou4lltelfvtl()sruaxrpnu0tltn ietltlmDrmu pnu4trxoif3oodlmt  uvolt  exm(opoy1ol n fcilt arra( onu0tlenmf3iydfm ea(ms ()aleomo3oatlpDelivs t s2to(o ou1op elnet tfarumx oot4tptomoeiadlm2um( o (4altoir3io1lpDeanes s  rurxo3ny1ll e fetlt  Drrx p;t0olt  fctyd s2emn p;u)texnif iydlatrli sls0 ruoxr3oodal e nvt t arra(mpoo4tetomieilsls2rlums;u4tltoxf3oatfatrluvs;s tetmim3nodlme mfei () 2tax pnt1aeeo i3iytlsDra(vo;u4aetnif3iydfaDr ieols)sexm(o3nudlltemfctls) Draxmpno1oleoif3iyslmDuanvp u0 lxriocto1lpDeai s s)s2xrio3nudllenlictlt aDrrxronu0teto i3tydfmDul(vpn(4aetnio iotfmDr uvo;() exrir3iy1lpt  netls) Dra(mono0aleoifeiytlsDulumsnu0aeeoir io1fmDe ivo ( srxoimpoodlp nlncsa(  Duaxrono1teeo ietas s2umnvp;() rxrmf iy1omD aivo s)truoir3nu4lpte nci ()s2uau  no1tpx ioeilt a ulu pnt0artnxr3oo1fateluvo s0texrir3ou4ll n fcsl() rumumonu4teeomiciad a em(vo u0alxrmfctadoat  nvo;t)srtrirpiy4amenlfcsas) rur(r no0tpt mfciat m2ulnvs u)texnxocoadomtrau i;()s2umxm iu4ll  mivia(f rrrx oou4olx  f3tatls uau pn(0 exoxf3oo1la eanvsl( t2xrirpou1ol  mies t a2urx p;t0tlt ii3iydla rm(vsnt)texnircto1lpt lies;s0srxmir3ou1altelfvi tfs2raum ou1oleomi3iatfs rmn s;()aetrio3to1fp eauei;t)t2xmir3no4lleemncsl()aDumxr nu1opt ioeiyslmDrluvp;()texrxocoytla r uvslt0 2to(o no4opee ivta(fsrra(moot0olx if3iyd a2raump;u) lenmocoadlmDrluei t trxm(m3ny1ope mfes ()srurxr nt1tpeo ieiyd aDuaumo;() renmociytlmtrln o;s s2xriopiu1ame livs ()a2ur( oot1tlxoioeiyt m elu pnt0artriocoytfaDeaieols  2toxo3ny4ol elfesas)arrrxr no1olxnmo3iadlm umnvp;(0aexrmf ootfa raiesls  2urxo3ny4lpee ivs sfsrta(ro;u0oexoioeiaslm2ra( onu0artnir totomtraivo;()s2um(o3iudopt mnct ( aDrrxmpot4tltniieilsfmDumn s;u4aetrio iadfm e i s ()teuo(opny1ope lfcta(  2tax p;t0olenifetat sDeanvo t4 exrmf3tydfaDrli ilt teuoir iydlm nliesasfartmu  ot1tpxniicildla emnvs;u4 eenxrctydlateaieols0 2toim3nudlle lfctls)a2ra(mo;u1apt iociysfa2eau onu) rxnxf oatfaDe n s;t tetr(r3ou1lmt  ncias s2ur(  no1aetomfetyt aDranmont0 ltrxf iodfate n i () euoimpiy1ll nmnvslt)arurxm ou0tpxnmi3tyslmDel(mo;t)arenxo3ootfpt luei;(  rxmxm nodomtn ieiatfs2urxr no4oee  o3tls a ranmsnu4 rerxfcoodfatran s ( t2umxr iydlm  lfet () Dumx o;o1aptoii3tyd a2emu snu4trtoxr3tydlmDeli olt)trurim3ou4op   icilt)a2rrx  nu1tet  feiytlm2rl(vs;u)tlxnifctydoaD  u i (0trumiopno1apt lics s)s2urx onu0alxomoeild aDemums;u)trxrir ootfmte n o;s0srumxm ny1aleeliet ()aDtax ono4aleo oeilsfm ua(vs (0alxoxo oydfmD  uesls  2xoxm3iu4lpen ictat) 2tm(mp;o1olxn ietydlm2rmumsnt)alenif to1fmDrluvsl(0sexmio nydomenlfci s)a2rruronu4aee mi3iydlm umuvsnt0aexnxf3tadoate ivs t  2tmxm iu4oltnlfvsa(  rtruront0olxnmicildfmDuln s u4 eerxo3tatfmDeli sls0 rxrxr io1amtnlfeiltfa2ua(m ou4oet iiciat a ea(ms;u)arxoxr ta1fp elivo;( truo(m3nu1ol   iet s a2tm(mont0optnioeiytfs eanmo;t)alermrciatoat an sls0srtm(rpiy4opt  fetlt)srumxr no4oltniociyt aDrl( p u)trerxo3iatfmtrai o;t)trurirpno4lltnmivtlsf ruau p;t1openmo3iatlm ra(vo t) ltomrcoodlmtr uvsl(0 eur(m oo1lpen fcia(  rta(ro;u1oex mi3tad aDumumont4aetrxo oo1lpt ai sl(0t2xoio3iu1aptn ict ()sDtrx o;u1oeeomoetlsfs emumpn() lerir3tytlpD ln s s srum(r3iodll elfvsa() 2rrurp;t0oltomo3tys m rl(vp t)tlerircto1fpt au ol( setr(r io1lmtelnciasfartaxrp;o0apx mfctatlm ua( o;() lxrmo tydlp  lu o ( trtm(o3io1lm elnvsas aruru oou0aeenif3iatfa rl( o u0aeenmr tatfpDeanvo;s)srxmxm3iodlp   ies () Dtrx  ot0olxomieils m emu snu0 rxrxr iytlatr n il()srxo(m iu1om nmfvi (fs2um( o;o4tpt  oeiyslm rlums (0tltnmf3oydfm elneo;( teuoxm3ny4lmeelfcs (  rtm(r nu4opt ii3iadfs2rluvsnt0texrmr ootfaD aieo (0 rtoio3iy1lle lfci s s2tauroou4oltnmf3ilsla2rmn o;u)arermf3iodlptran o;t seto(m nu1llt  netasfsDraur ;o1teenmieilt a2ul( onu) lenio iy1om eauvolt0 rxoxo3oy4alen iciltfsrraxmpou0tlxo octadlm uauvon(0 eenio3to1laDrau i t teumir3iy4ol n icsas)srua(r ot4tpxo ietltfaDea(mp u0aexnio iadoa e i s;s seurimpoydomt  fesat)aDur(mo;t1tlen oetld s umnmpn(4artnmr3tytomDelnvo (0teuoio io4om nmnet (  2rr(mont4teeo o3ildfs2um(vpnu)aetrifctydomt  ueo;(  2xmxm iy1lleemfct ()aDtm(  ;o1tltn icias m emuvo;u)trerxf to1lpt  iei;( truoxm no1ape mnesls srtrum ;t4tpenifeiyd s rmuvo t) eenmr3oy1lmDrlnei t0srxoxopoodom nmfet sf 2rrxmonu0tltomf3ils sDemuvo ()trxnxr tatfat  ues s) rtrxr3iudlleelfes s) 2rru  nu4opxomictatfmDuan o;t)teenxociytlaD  ueo;t0sexmxr3iy4op nmicsat)aDra(rpnu4apx  ictld s2uanvp;t)teermo3tatfa e nesl() 2ur(o ou1ol n fcsatfsDuax onu4olxo i3iytfa rmums;t4 eeoxoctodlmt  i s;()seur(m3iu4apt lfcilsfsrrr(m ot1tpxnmociatlaDuauvo (4 lxnif3iadfp  lnvs;t0 2trir3oo4llt lfvslsf Dtmxm ot4opeo ociytfs2elump;t) eeoxocoo1laDe nei t srxr(mpny4om elnvi t) rrrxmp;u0oleoifeiltfm2ua(vs;t)altrxr iodlmDeanvo t0s2xr(r3nu4alt mfvs t sDraxm oo1tpt  o3iyslm2el(vo;u0trxrmr iatfp ran i;( s2xoxr3no4am n icilt)arrm(r ;t0aexomi3iasfa2emnvp;(0artrxocoydfa rai o;() etmxrpny1oltemfeta(f 2rruroot1altn f3tld aDuln o;t4 eerxo3iytfm  lnvo s0s2um(r3iu4ol nmnvslt arurxrp;u4aexniociadfs2umnmp u0treoxocoa1fp e ieil(0trxo(r iu1op elnctlsf Dtmx pot1apxnmoctlsfa2rl(msnu4tlxrmf3tadfmtrlues s)s2uoim3oy4lleemnctl(fsDrrum nt1alxn octad a2ean p;u4arermr ia1lmt  n i t)texmio3oydamtnmfcil() rurxm no1tpeomiciys a eau ont0 ltomf3to1faDeanvilt teuoxo io4ap n fvt tf rtruro;t1aptomo3iadls rau ont0 exoxrcoatop r nvs;(0 exoio3nydap   nei (f 2urxr no0opx if3iltlmDea(mp t0 ltrxo3oy1fm   neo s  etoxr oy1ll nmiet s)a2um(rono4oleoiociatla2uau p;t0altnxf3iadoatrlnes;s trxr(o nydlmtn ies t a2uaxront0opeomiciydlsDem( o;u0aexomo ty1fa   u ols)srtrim3io4lmt  nesa(fa2rrurpou0oetoiieiydlm ea( ont4tlermr3tatlptran olt0setrxmpiy4ol elnesls  Dtruront1apenioeiltla2rm( snu4 etomo3iotfmtrluvsl(0 eumir3oodopenlnvilsfsrtmum nu0tlto ictysfa eanms;()texnxf oadoate uvi;s)trto(opnu1apte nvs t aDtmxmonu1ope mfctytfm eln p t4trenxrciodla  an slt)srxoio3oodamte nvsl(faDua(  no0alto o3iasfm eanvont)trtoif3oytla  auvo;s  exo(m3nydap nmnetltfsDtauro;t0oex iieiltlmDul(ms t) eenxocoodom  li ol(0t2umirpoo1altnmfcs s  rtm(rpnt4aetnio3tlt s eanmp;u0 lermocoytlmDean i s  rto(m3oy1apee ivslsfs2rr(rpno4tpt mfeias s2elnms;t0 renmf ootomtrlieo;()srurxr3iu1optnmfetasfartrum ;t1optomi3iydfmDemnvo ()trxnmr oodlp  anesl( s2toxmpnudaptnmncta( a2umxrp;u4tlxo iciatlmDua( s u4aexnir3todomt lu i;( t2xoir ny1lpe mneiltf Duaumo;u1tpx mieiatls rm(monu0altrmr todlp rln ols0 2uoir3nu1ol  miesatfsDumum oo0apeoifcils s2emnmo;u0arxoxo3ia1fmt lneolt  rxr(mpnu4lltnmfcil()arrrx pot4ole mictatlmDemuvo;t0 lxoxr iy1lpteluvsl( texrxr3io1apt  fvsa() ruaxm ;o0olx iociasfs umuvsnu)trxomfcta1laDe uvol( srxm(r3io1ll  mncta(f Drrumpot0oetniieiatlaDra( o;u4 etoir3ty1faDeau s;(0 rtm(r3oudalen ivsas) rrmxr ;t1tpen iciys m2eauvs u4 eerif3to1fa  lnei;( s2xm(o3no1alenmfvsls srua(r ;o1oex mo3tatls2ua(vo u) exnxo ootlmte uvils s2xrio3ou4omenlfcils aruaur ot0oltoiocild a2uauvpn(4trtrif3oadfptr ueo;t seum(r iy4omen ncsas s2umu ont1alxomfeiaslm2ea( p u0trxoxocoy1oatr ivs;s0 etmxmpno4lpeemivia()arumxrp;t4aeenio3iadfa rmnmsn(0aetrxr oydlm   i olt trtoiopiy1ome  icta() Dtmu pnt1alt if3tld mDranmo;t0tlxnif3to1fp   ieo;t  rxoxo oodomtemfcsatfaDtr(ro;t0aexnifeiytlmDum(mo;u)alermr3iodopD lneo;(0 2umxopio1oleemfci t)a2tax  nu4apto fcias m2eanvs;t4teenmrcto1fptrai s ( setoimpoo1lp   fvs ( a2uaxmo;u1aexo feiad m2rmnmp t4tlxrirciotoaDeauvsl(0srtoxm oo1lptelieil( a2tru  ;u0tpeoio3iasfaDelnvsnt4tlxnmr3iatfpD luesls t2xrimpno4ol nmnei sfsDtrx  ;u0texn f3iadls2emumpnu4 eerio3tatoa   i sl(  2toxopnu1ll  miesltfs2rm(  nu0opeoiietasfmDrm(mo t4texoxf totfaD  uvs;(0 exrio oo4am n feilt)srraxronu4oleoif3ilt a umnmp;()areomo tydlateau ils)tetoxm3oudlmt  nci ( sDrmu ono0optoiocild m umnvsnu0tetrxr3iydlpt aneolt0 rum(r oy4omt  fesa(farumumpoo4ape moeiyt s2uluvont)tleomf iotfpte n il( t2xoio io1lmt  fctls) 2ra( p;u0tlen fctydla ea(mont4alerxrcoytoaDr u o;()s2trim oo1ll  lictas)s2rmurp;t1aeto ociadfaDum(mp t4artoxr iodlat  neols0s2toxm no4ap   nvia(f 2rrxr nu4oetoifciysfsDulnvo;(0 ltomrcoadlp rlivs;(  exrimpou1ole  fesl( s2tau  ;t0olt mo3ild m2eauvo;t)trtoxo3oodfmteliei s0trtoxm3iy1lpe  nesltf rurxm ;u1tleo i3ias m rl(vsnt4 eeomf3tytom   n s;s)s2umir3iu1op n fvtlsfa2trum ou4oeeniietltfm2uan o u4 etrxr oodfatrlivi ( s2to(m no1lpen ncsasfsrrauro;t4texnmoctytfsDrmuvo;u4tlxoxr3to1oa e ivi t)texrxr iudlpeelfvtatfsrtmxmooo0optoio3iatlaDulu o;()treomr totfmteanvils srtoim3iu1amtnmnet sf rtmxroou1aexn f3tydfm2umnvsnu0 rtrifctydlm  lnvs;s0 exo(opnu4amenlictl() rrru p;o1aet  i3tlslmDemnmo;u0 rxrxo3ta1lm e ieo ( teuoxo3iy1ol nmiesls) rtm(ro;o4tlxomfetldlmDrl( p;u4 lxoif3oa1oaDr n s;( t2urxo3iy1lm nlict () rtm(rooo0tpenio3iydls2elums u0artomf ty1oatelnvo s)s2tm(m3ny1lptemncslsfsrua(m ou4aleoio3tltfaDuluvsn() lxomo oatfmDeauei;(0t2trxmpny1op   iei t  Dtau  ;t1teeo fciad a2emu pnt4tlerxr iodfm  an sl(  exo(o ny4lmtn ici (faDtmumo;o1tle mf3tldfs rmnms;()alenio3oydfptr ieo t)trur(r nu4am e ncilsf 2uauro;u1apxnmfcilt a2ea(vs t)tetrmo oydfat luvslt  exmiopou4am nmivt ()arumu ooo0apxomo3iytlaDem( pnu0trtrxrcto1fp rau sl(0 2to(r3ny1omtelnct tfaDumumpno0apeo oeiadls2uln o () ltnif3tatoa r nei s)sexo(o3nu1amte fctl()s2trumo;o1tet iiciyd a2elnvp (4aexriocoadfat an i;t  rxoim3nudopeelfvilt  2rmur nt4apxoii3ilsla2ua(vs (0aeeoxr tadla eluvo;s0s2xoxopno1optemfct tfsrtax ont4olxoiicild a umnmp ()artomr iytfm  an o t trxoir3iu1ale  fct t)s2uaur ou1oeen fciatfs2ean pnt0arerif3iytomt ln s s) rxo(opoo1amen nct (  Dur(ro;o0tlenmfctld m2um( o (0aeenir oatlate ieo t sexmxm nodlmtelncs sfaDtr(mp;u1ole mf3iys s ulnvp u4tltrio tatfp   neo t teum(r oo4olen fvil(  Dumurp;u4aeen ieiadlm2rm(vp t0 rxrxocta1oaDelnvolt)t2tmio ou4om emicilt sDumx  oo4aet mfetydlaDua( o t4alerio3oy1la r neo (0t2tmir oudlp nlivsls aDrr(mpno1oeenioeiyt a rlump (4 etnmrcoydomDelnes;( texr(opou4al  mnetatf Dtruro;t4aet mietld aDum( s (0alxrxf3iy1laDeau olt0setoxm nodamt licsat) Dra(m ;o4tpe  ieils s2emumonu4areoircty1la rlneo s) 2toio3oudape lies s sDtmx pou0tpt  i3tatls rmu s;(0 eenmr oy1omtelieo;s  etrir3iudopt lfvsat) Dta( pnt0openioctysfmDraumont4teenmf ootlpD ln s t)trxr(rpoodlptemfctltf Duru p;o4aleoifctatfm emnms t0altnio todomteaies s trur(o nudol n nvt t)s2ua( ont0opxo oetyslm ra(mpn() rtnif iydlatranei s0 eto(opno4optemiei tfartm(mo;o1oetomi3ildla em(vp;t0arxnmo3iodomDelueol( trumir3iy1lmtnmiesl(  rrrurp;o4aee ifciys m2eanmpn() ltnxf ia1fatrlieolt s2xmim ou1ape  feslt srumxrp;o4oee moeiadlmDumn pnt4texrmr ta1opD  nvsls)srtoim nodllenlfcsltf 2uax o;u4oetomfciatfm rm(vpnu0trenifciydfp  ln i;t)setoir3ou4ll   fes sfs2umur oo0apenio3tltlmDelnmp () exnmo ty1lpteanvs s)setoiopoodamtemneils)artaxm ;o0aex if3iysfa2eanvs (0 lxnmrcoo1opDr uei s s2toimpoo4lpe  iesas)sDrau oou4tpxnmfctytfs rl(mo () leomr3oydoa eaies;s0sexrim iu4om nliesa( arrmx  nu1olx  oetydls emuvs ()tlenxr iotlpDr uvolt0teumxrpou4olt  fvias) 2trxm ou1apt miciys aDrau o t0alermfctodoa   i s () eur(opny4ol emnet s aDurx o;o1aptn i3iydla ul( o t0trxnxr3oytlaDeauei ( seur(r iu1lle mnet t artm(m oo4open feiad s el( o;u0artoxr ootfm raivs;t0s2toxm3no1ome  ici s  2rr(m oo0optn f3ildls ea(ms (0alxomr3ta1la rauei s0s2to(m ny4lpe  fetas s2uaxrpnu0alto feiat sDum(vp u4 lxrxo tadfat ai s t)texrim3oy1ap nlfetl(f rrmxmpnt1tet  ociydfaDua( o t)arenif oadfptelnvs s srxrio3iu4lmeemncslt)s2um(ro;o4opxo o3iytfmDulnmo;u)aeermf3ty1la elnvs;t)texoxr3nu1oltnlict ( arum(rpoo1opt mociytfs2rm(ms;(4texrio3ta1lmDeluesl(  exoim ny1llenlneta()sDraxmonu4tleomi3ilsfs2ra(mo (4 exoxo ty1oaDraieo;() rtrxr3nodll elfet ( aDrmx pot1oet  ociyslaDumu pn(0 rxnmocoytfmDe nvsl( seumirpny1am e fcs t)s2umxrp;u4tleoifeils a emuvp;u) eermo io1lpt aneil( s2xr(m3ny1aptnmfvt ( a2umumpnt1oltniieiasla2rl(vp u)aetnif3iadlaDelnvi;s0t2xmxr oo1apt mfvtls sDum(moot1apenmfeiysla el(vp;(0 rtrxfcta1om  anvsls0texr(r3iydop e ncta(fsrtm(rooo0olx ii3iytfmDuanvs ()artrmo oodla r u o;()t2xoir nu1al n fvs s) 2umxmo;o1aee  i3tat sDrln o;u0 leoif3iatopt  ieo t) 2uoim ou1lpt  ncs (  2um(rpou4alto octatfa2emn o ()trxomocoadoat  ues t0srxm(mpny4ap   ncia(fsrrmu o;t1tltoifctls s el(mon(4altrif totlaDe nes;(0 exr(opio4ameelnvi ()srumurp;t1apxo oetyt a2uanvsnu0 lxnxf iy1fpDrai i s  euoxopiydom elfesa() Dtaxm oo4aexo ociltfm el(mo;u4tltrxr3ta1omDelivs s0srtmir nu4ol  mies sf Dur(  ;t1olx  fciad mDel(vo (0 ltnxr iatlp rlu sls srtoim3iy4ol e nesl(  rrm( ooo4tet ioctyd mDrmnvsnu)tleoxr3tytlpD anvi;(  euoxopny4aptnlies t sDuau onu0apx io3iadlaDemuvs ()tlxoif iydoatrlivo t t2xmxr3ou1ll   nci t)srrau  ou1oeenmicilt m2el(vs;(0aexnir3oadop elivi (0t2tr(m3iudolen ieslt) rtr(m ;u0alx mietls a2uaump;u0trxnmf3iatfa  luvils0t2umxopiy1lle  iviat)srrrx oou4opxnmfetldfs2emn o u4 exrio3ootfaDeluvs (0 etoxrpoydop emncs tf Drrurp;u4tetomictld a umuvpnt4 eerxr3totomDeaivi s0 2xoim3iy4lpe lfcs t) rum(rono4tlx mictydlsDea(mo;(0trxnmrcty1oa rlnvi;(0t2xmxm oudlltnlietat)aDuax  oo0olenii3iydfa2um(msn()tltnmr oytfa   u olt) 2xr(opoodoptemfvi t)arurxr nu0ole mf3iltls2eluvo;u4 exnmoctadlpDraieo;t0t2tr(o iydomtn ici tfs2uaxr ;u1aeenmictyslm2ua(mo u)arerifcoydlpt  ivilt0tetm(o oodllt lfvil(  rrru ont0tleomfcias a2el(mon() lxnmf ta1oat ai s;(  rxoim iy1apeemfeslt s2tm(  ;o1tlt mictytfa2rauvont0 ltomfciy1fmDraieo s)s2ur(o3oodlp nmnet tf rtaum oo0oet ioeiytfmDemu o;u0arerif oatfa elivo s  rxmxr iy4aptelfet sf Dtau  ;t0tet mociyd a2ean pn(4trermo iydfa   nvi;s)seumir nu1om  mfei sfs2taxm ;u1tetnifeils s eau o u4arxoxocoatoat auvolt sexrxo3iy4ol nlnvsasf rur(  ot4tltomoctls s2rm( o u4alenir oodlmt ai o;(0sexm(o nu4lpt livilt) rraxmpno4ape mietld mDrl(vp u0tleoxf oy1om eluvils0 exm(m3iu4ll  lnvtat  rta(rpno4aeenmo3iys s rlu o;t0 ltnmr3iodfa r uvo;(0 2ur(m3iu4om e ivia(fs2raump;t4opx  fetyslmDuln snt) lerxfctatlpt anvols0trtr(r3nydlm nlivtas  Dumxronu0apto o3tldlmDumnms t0 leoxf3oodlptrau o s)texoio oo4ap   fvil()sDra(mpnt4aexnmo3tltls rm(vo;t4tetrxr3ia1om  au slt  rtoxmpiodam n fctatf Drr(rpot1apxo o3taslm2umnmo (0 etnir oy1opD auvilt)srxrxm oudlpt  ncs () rrr(mp;o1opxo octydfm2eln o ()alxoirctotopteln s s t2xoir3ou4lpenlivtls sDra(mp;t1alx iociyd a ulu s u4aeenmfcoy1la  aies;() ruoxo ou1ap emfcsls)sDrrxro;t1olx mfeiltlsDum(vo;(4artomo oatlpt anvo t0 exoir io1lptelnei (fa2urxm oo0tptniieiyt s umn s u)aexomo oytla ranvi;t) 2xm(mpny4lp  livtltfa2tm(mo;o4apeomoeiysls2rau p;u4aeeomociytfmtr nvslt tetmir3oodale livsa()sDta(rp;o1aptn ieiasfaDranvp (0 ltoxf3iydoa e u i;t t2trim3oy4ol e nvs (fa2urump;u1tltnmieiysls2ua(vp;t) leoxoctadlmDrlu i (0 euo(opiydop emieils a2uru o;t4aex  ociltls ra(ms u0teenmocoatomD luvi;t tetriopoy4olt lneiat)a2umu o;o1aexnioetls a umnvsn(4tetomf3oo1lmDrln o () exr(m io1op   ictls  2urump;t4apt  o3iydla umums t4 eerir ty1oa  auvol(0t2tmxo3oy1am nlfctasf 2rm(m ;o0aexn f3ilsfs emnvs;t4 etoxrciatop elu i;s t2tr(opio4apt  ivt t aDumurpnu4open i3iltfmDean snu) rxnmr3ootlmD lneslt)s2xmio oy1al  mivias) 2rax oou0olto ictasla2ulump;t4 rtrio io1op rlueil(  2urio3io1ll  lfet tfarta( p;o0aet  feias s2eau p u4 exomo3oatfmte ivo (0trto(r ny1al  mnvsasfs2urum ou4tetoioctld a2ran p u) exoxr3tadlmtelu ol( s2um(o3nodlpeemivt ()sDuaxr ot4oexomfcils a2ul(monu0tlermf3oa1fmDeaueo;() 2tm(opno4lmte nct t arrruroot0tltniieildfs emn o u0aexomf oytfpt lu i;s) 2xm(m oy1om  miet t  Drm(rpoo1optnmoctysfs rl(msnt4arxrxr tatomt au o t0s2tmxrpoo4om emicsa()srrr(ro;t4opeo ictltfmDuln sn(0aeenxf iotla e u s s seum(o3iy1ole  ict t aDtmu p;u1aexoiictld m rl(vo t4arxomr iytlmD lieilt0truoxm3iy4ll  mfvs s aDrrxrpoo0olxo ictat s2emn p;(0arermo3iydom eli sl(0 2toxopoo1lptnmics s)s2urx  nu0tpxnmfeilt m eaums;(0 reriocoadlpt lnvi s sexm(opno1olte nes (f rrrx o;t0apen o3iytla ul(vp (4aexrif oadlm  lnvo s texr(m oo4llt licta( s2umxmp;t4opeoiictatls2rmn snt4trxoio tatlm e ivs;t)setoimpoydamt  fcsa() rumu p;t4apx  f3iadfs2eau p;t0teerirciy1lmDeauvi s)t2xmxo3oy4ap   fci t  2ur(r no1tpeo oetltla emumsnu)tlxnio oy1omt au il(0 rtmxr3no4lm nlneta( s2urum ;u1optomi3ildfs2rlu o (0trxomociadomt  i s;()s2xr(m3nodamte neils)artr( pot0aexn ieiytlm ua( p;t0 rxnxf totfa elivo t s2umimpio4ll nlies t  ruax  ot0aee io3iadlsDeln s t4 lxrmf tadfmDeanvslt0 2to(o3ou1alte fct ( arurxmooo1optoioctltfm um(mo u)trxnmo iydlm rlivil( tetoxrpoydolte nci (fa2um( p;o4aee mfciyd aDrmump;u) exnxo3ootlaD  ies s t2tmxo iy4lpe mnvtat)s2trx p;u0olx  ictlsfaDrl(mpn(0trxrxf3oa1fp   neols0texo(o nu1omtn fvsat) Dra(ront0aex mocilt aDean p;(4 renxf3oy1opteaueol()srtmxopou4lpt mnviat)artmxmooo4texnmi3ils mDuanms;(4alxnio oadom rau s s)srxm(r oudaleelfvsas)arrrxmpnt4tet  fcild m rmuvp;() rtomr tydla rai o;t0t2tmxrpiodopen ivt s) 2um(rpnt4alxo oeiadlmDeau sn()aetnio3iotopt lieo t)s2uo(mpou1op e fvilt srur(mpnt4teenio3iatfa2uauvp;u) etomo oytfaD  uvo;t) rxr(opiodalt mnctltfs2tm(rp;u4oleoiictasfaDeanvon(4aexnmoctodlp  an ol(0trtr(mpny4lleelncilt srumx p;t4ole  ieiydfsDuanmp u0altnif3oo1faDelnvils0s2tmxr3nydom n fvia(f 2rrumpno0tetomieiltfaDrmu o ()aeenmf3oodfaDelu slt)s2umxmpnodom emivtasfsrtaxrooo4optn ociydlsDrmnvont4texnif iy1opteaieils  2xmirpoo4opte nvs tfaDuaurp;u0tpx  feiydlaDea(vp (0arenxocoo1lmDrauvs;t srtmxopio1lmte fct sf rrmx ont0apen ociadla2ra(vp u4alermr3oytopDr nvilt)texo(o no1optnlnesl(f Dumu ont0tex  oetldfsDeaumpnt4teermf ootfpD  i o t) rxm(m no4apeemncs s)sDurum ;t1ole iociyt aDua(mo u4 eerxo3tatlpt  nvs (0 rumxm3iudopt mnei tfa2taxr nu4alx moeiytfa rl( onu4tltoircoa1omteluvi;t0t2xmxr iu4openliei ( a2trurpnu0tpx mfctat m rlnvs t)tetoxo ty1la rli o;s trxm(m3iodam   nvil()sDtaxmp;u1alto oetlsfmDem( pnt)tltoxrciy1lpt li s;()s2trxrpno1ll n nvsas)a2ta( p;o4tltoif3tyt s ulu p (0aexomo iy1fpD  i s;(0setm(m iy1lp emict sfsDumx pnu4oee  fciatfa2emu p;(4trtoxfcoodfa rluvil(0trxr(m iodomee iciat s2tmxr ot0tetniieild sDel(ms (4alxrif3oadlmDrlneilt0trur(r io4lpt  fvi (fa
\ No newline at end of file
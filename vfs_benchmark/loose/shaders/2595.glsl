@@ -0,0 +1 @@
+u o;t) 2xoxr nu4aptnlieilt srta(m ;o0olt iicilsfa rmnvsn(0 lxrxr3todfm eau slt seum(opoy1olenmnvs ()s2rrx o;u1aee  f3tasfmDra(ms ()tleoio3todomte nvs;t)s2toir3oy4ol nmnvsa() rrrx p;u0tee  o3iltfa umuvo t0arenxoctydlat  ues s)srumio oy1ll nlnvil(  rur(m ou4olxoiieiat mDrmnvp t)tlerxfcty1omD lieo t trxr(o oo4lpenmfci s  rrmxm ou1apen f3iadfm2um(mp u4tetomo oydom rli olt0truoio3iu1lm n net ()srrr(  ;o4aeeomietld mDem(mont4arenifciadfmteluvs;s) rtmirpiu4ap n fciatf Drau  ;u4olx  oeiatfs2ulnmp;(0 eerxf3iy1omteai sl(  rxoiopoy4opt  feiat)s2rmxmo;o0tlt  f3iatlaDul( p u4teenxocoatomDr uvilt) 2tmim3no1llt  ieil(fs2rm(  nu4olxnmietyd mDem(vpnu)arermocoadlm e i o;()s2trir oo1alenlfeia( artax o;t1tltomiciydla2eluvpnt0tlxnxo ia1oaDeli ol()setoxopnu4llenliesasfsrrmxm ;u0tpe  i3iys a rlnvsnu4aleoif3oo1omte i sl() 2uo(opny4ol e nctlt  Draxmpnu0tlx mfeilt mDul(mp;u0 exnif3ta1opteauei t srurxm oy4al elnvi ( s2ra(mooo0opxoiiciydfm eau pnu) rtnxfctadoatr ieol( texoirpio1amt lfesatf 2um( pou1aexn i3iys m umuvp t0 etrxo3tydlmDr u o ()teumxr nu1optemfetls)arrrx o;o0tpt io3iyslaDulumo;t4 etriociy1faD ln i;()sexr(m nudlm n neilt a2tmxm ot0oeeoii3ildlaDulnmp;t) lenir tatoptrlnvs;(0s2toxm iodalt lfvia()a2ur(r ;o1aeen o3ils sDeau pn()trxnxr oodoa raivi t0seumxo iy1ap eliei t)s2raxmpnt1olxnifcilsfa umnvs (4trxnmfcta1fmDeauvol()tetm(o3no4lmee nes s  Dtaxrooo1aeeoii3tysfsDrln p u0tlxnxr3ta1lmt anvilt0seuoiopou1lpt lfviat srurx  oo0oex mi3iatls uluvo;t0aeeomr ty1optr nvo;s trumir nudamtnlicsas) rtr( oou0oltn fctltlaDelump;()aexrxf iotlmDe neil()s2urir3oy1altn nvi () rtmurpno4oltomfeiadfs2el(mpnu0altoif oy1lat  iei;(0 2xr(m3iu4lptelfctat a2rmxm ot0apxniieilsfmDem( on()alxoio3tytlaDr i s s0seuoim ou4lmen fcsas  Dtru oou1teto feiad m2el(msn(4arxnxfctotfpDe u i;s0srxm(o nu4omte fvi () Dumu o;u0oeeo f3iyt a2eanmsnt) rerirciadfa   u s s trxoir3io4aptnlfetl(faDrruront4oeenmoeiasfs2ean snu4 renxr3oo1lpDe iei;( t2tr(r oodole lieslsf 2umum oo0apxomi3ilsfa2rmnmo (4aexrxr3ia1lmt livs (  exmir ou1lp   ivs ( aDurx p;u1alx io3tysla um( o t)trxomfcoo1omt  neols0 rxmxo ny1lptnlfet ()srrr(m ;t0ole iiciydlsDumnmo;(4artomr oadfmt  u s;t)seuoxopnodllte ivt tfa2rax onu1apxo f3iasfs2el( s;(4arerir totlp elneo;t)teurxo3oo1ll  mfctat  Drr(roou1tptnii3tasfs el(mont0aexnifctytoa ranvs s0t2tr(mpno1ame liei t  2tmx  nt0aeenmf3tat a rmnvsn() rtnif to1lp eanvo;s) rxo(o iu1apte ivsl(farum(r nu4oleoii3iaslaDraums;u)alerif3ootomDe u o;t)texrxo3no4ap emfcilt)a2ta(  ot1oleo ictys aDrau s;(0 rerxf iydoateaivs ( srxr(rpoodalt  fvi (f rtaumo;t1tleomietysfa elu p u4teeomr iydop rln o;s  etmxm3nudap e ieiatf 2ua(m ou4apxo fctys a2rmn pnt4altomo3iotopDr uvo;s) rurxm nu1ll nmici sfaDuru  ;o4olx ii3tlsfm2emnmo;t) eenioctytoaD lu i;()teto(m3ou4lmt liciat  rtrum ot4alx  o3iltlmDea(ms;(4tlxoxo3oydlm rluei;()t2xmxr iy1amenmieiat)aDta(rpoo0tlt mfeiysfm2umuvo;u)tetnir3ootoatrauei t)trxoim3nudopee ict t srrmu poo0tee if3iyd a rm( sn(4tltoxf oadfptelies s0srxr(m ny4alte nei s  Durxmpnt1apx  octys s ean o (4arxrif3oatoptrauvs t0seuo(r3iudam elfeilsfaruax ont4tpt  ieilsfm2rlnmont4tlenmf oo1opt  ivo ( srxoimpiy1lmt  iesas)sDrrxmono0oet io3tad a eau pnu0 rtrio3oytfaDrauvolt0truo(rpiodope mncsa( arurxm ;o4aee mieiltfa elnms;u)artoifcootlpt ln o;t)trxoxr iudom  lnvtlsfsrrmxm ;o1ope ifctls a2ul( pnu0arxnircta1la  lnvol( sexoxrpiu4ome lfct sfa2tmx ont4tleomfciyd mDrlnmpnt) rxoif oy1lm rauvils0 2xoxr nodal n fvi ( sDra( ont1aptoii3taslm2ranmo u4tetnmr oodfm e i i s  2trxm3io1lle livtat aruax pno4oexnmo3iys a rmuvo u0 rxoxf3ty1fa raies t)trtoir iudomen ncsl()sDtr( oou4opx  ieiat sDeanmsnt0artriociytlmteln olt0 rtmxm3oy1llenmnct sfsrtmxm nt1tex moetad a2rlu o u0teenmrctydfm ran slt)s2xmirpnudlpe mfvtlsfsDtaur ;o1oexn ocild a emnmpnt)arerxo to1oaDe u ils) etmxr3oo1ol e nvias s2ra(monu4optnif3iydfa rmnvsnu4 etnxf oodlp  auesls0t2xm(o3oo4amtn fcs ( srraurpot1oeeomoctltlsDulu pnt) lenmfcoydfptranes;s  rxrio oo4aptemivsl( arurumpnt0aee  fciltla elnmo t0texomo ta1fp rlies;(0trxrxm3oydlmenmnctlsfs2rrx p;o4tleo i3iad s2uanvp (0 rtrmf3oatom elieilt)truoiopou1optnmnci () rum(roou0tptomieiasfm2rm(msnu) reoirciotlaD  ivs;(0srxmim3oo1ameemietlsf Drr(  oo4apeoio3tytfa2ua( s;(4arenio3ia1lmD aues () 2um(o oydlle  nvtat)a2ta(rpnt4aet ifciasfa um( snt0tetnxrcoadopDe nvs s)teur(r ny1amt mnei t)s2taurp;t0aeenmfeildla ea(vp u)trxnmf tytom  ai slt0seumxm oodal n ncta(fa2um(m ;o4oeenmoctat sDuau o (4aetnmr oa1lpteaivo s)s2xr(m iy1ol e nvs (faDtmurpno0oetnmociad s2rl( o (4 leoirciydoaDr ieol(0s2toio3nu4amee ncia(f Dtaur ot1tpe if3iydlm2ulu s (4tltoxo3ty1faDe uvs;t trurxo3oudap elictas s2rmur nt4oexoiicildfs2eluvon(4altrmr3tadfm r n o ( teumxo3no4omtelnvi sfa2tm(m nu4tpeo i3iytfsDeau o u)texnxrcto1fat aiei;()s2uo(o oudlmtnlivt sf 2ur(mo;u1apeoifciydfs2umump;()alxoxo io1fa rlueo (0 2xmiopoy4olenlnetatfsDuaxmp;t0apeo ociadfm2emnms (0 rtoxo ia1fpDeanei;t)trxoir3oydapeemfvsl(fs2uru  no1optomfciysfmDuanmo () leomf ta1op  ai o;() exoim ou4op n nctlt  2tru ono0oleoio3tasfs ua(vsn(0tetoxo io1omtrauei s  2tmxo io1lm nlieiat)arum( pnt0tpt  o3tlt s emnmp;u0trtnxr3iy1fptean s s t2xoxm iu4olt lncsat srumumpno4oex moctyslsDrlnvp t0tetomociotop e nes t)texr(r3oo4lmt mfvsat)sDum(ro;u4aex ii3ias mDuluvp () rtnxf todlpDr i s s0s2xmxo oudal emfvtasf Dua(mpnt4aet ifciydlm rlu p (4 exnxo3io1fpD auei t srtrio iy1lmtnlivslsfa2rmxm ou0ape ii3tasfa el(ms;u) rxnio3ta1omD  ueil( srurirpoo4lp nlfeilt artrx o;t0tetomf3ilt m rm( s t4teenxo3todlmtelneols0 eur(r nudomtelfvta( s2rau onu0opx mo3tldlm2ua(vpnu4 rtrxr ootomtean o () rtr(r io4alee fcsl(f Duau poo1oexn fctydlm2rl(mp;u4alxoircia1opDrau o;s0setm(mpou1olt liesl()srtrum ;u4tpxn o3ildls2elnmo (0texrxr ootlm  an ilt trurim3ny1oltnlfcilt)aDua(monu4apeo octysfa2rlnmo u)alxoir oytfm rauvs;t) exrim3oo1lpt micilsfsDrrxmpou4oltnifctyt sDulu p ()altnxf3iydfpt auvsls  rxrxopnodll nlncias)s2ur(ro;t4texnmietlsfs2ea(ms;(4 etrmr3ia1fat auvolt) rtm(opnydap nlfetlsf 2ra(mo;o1apenio3tadls2umn p;t0 etrxo ty1fp  au s t sruoimpnu1ol nmneta( s2tmu  ot4oleoifciys m2rm(ms;u4alxrmr3oodfm   ivils0trtmim3nodol   nvils) rrr( pno1apx mo3tadfs ul( s u4tetoio todopDeluei;t0 exo(r iy1lpt  feilt)srurxrpoo0texoiieiaslmDrlnmsn(4alxnio3iytlptrlnes t) rurio io4ameelivs s  rrru oou1tlxn o3iatls2ul( s (0 ltoxr iadopD  nvo t setrir iu1al nmnct tfsrtr(mpnt1opeoii3tat a2umuvp u4 rxniocootfmteaies ( setoxo oydol emfviat  2ra(rpou1tpx mf3ias m2umums;(0 etrmo tadoa eln i ()t2xo(rpiudoptn fesa()arta(mpno1tetnif3iadfm2uauvs;t)tlxomf3oytop r ivsl()texoir3iudopt  ncs () rrmxmo;o4oltomf3iasla ean p u0 rxnxo3iy1lm  anes t sexrxm3ou1aptnlicias s2umxrp;o0olxnioctyd a2el(mp u0 ltrifcoydfa  li sls  rto(o3io1lme  iet tfa2um(rpnu0opeo o3iadls2ea(vo;u4 rtrmrciydopDeaieolt  eumimpiudolee ncil(  rta( pou4teeoioctasfm2uln o;t) rermfctytopt lu o t srtoxo iu1lltnlnesls)arum(mp;u1tpt ii3tyd mDel( p;u)aetnio3iadfm  aieo s)sruo(opiodole micsasf rrrxro;o4aptnmfetasls2rmnmp (0 leomo oy1fpDeln i (  ruo(opiodlp nlnes s  Drmuroot1apxomfcilt mDua(vonu)arxoxf oodlpDraneo;t0teto(opio1ap  licsasfa2tru p;o1oexniietldlm elu onu0trermo oadoptr iei;s0 etmim3iu4opt  iesat)arumumpnu4tptoioeiytls emn s u)alxrxo oatop  an i;s0 etr(rpoydap n nci s a2trxrpou1alxoifciyt m2uluvs;u0aetrxo3ty1lm  auesl( srtrio oo1lmt lfetas  rrmxm no0aptoif3ild aDrl(mo u)trerxo3tadfatraieo;t sruo(mpno1ape  nesls  rrmxr no1aeto i3tyt s2ulnmp;()tltnioctodopt lueils) eurio3nudolee netas)sDurxm ou1tleoiieiad mDemnvp;(0tltnifcoytop rln s;t0 rtoimpou1aptnmfvs sf rua(mpnt1olt  i3iyd s2rlnvp;() ltrmrcoo1fm  lnvil(0 2uo(m3nudolenlnciat arum(mpot4apt ioctlsls rlu p;u4alxrxo oadfatran slt0 2xrxr3ny1lltelnct t)a2um(ront4tet ifetyslsDuauvo;u)aexrmrciatfptelieo;(  rur(r3oy1omtnmfvi t  Dtau o;t0tptnii3ilslaDrl( s u) ltrmfciodfmt livs t)t2umxrpiu4lptnmfvils sDtrx o;t0texoifciadlsDulnmo t4alxrirciatlaDelnvi () 2urim no4olenlicsa()srtru  nt4alx  f3iadlm2em(vsnt4tlxrxo3ootfptr uei s0srxmiopoudameelietl(f Drau  ;u4alx  i3tytla2emuvs;u)altoxf iatlaDeau il(  2urirpnu4op  mfvs t s2tax pou1optnmoetyd a2ulu o;t0altnio3oadlp e ieilt) exrxr3nydome livi s sDum(ronu4openii3ias s2rmuvo t)trenmfctytoptrlueils)texoio3oy1lmt livilt  Duau o;o1tlt iictlsfs2ua(vp t)tltomrctodlpD auvilt srumxopnodlp n fvi s aDumxrp;o1tetoiocils a2ua( pnt)trtomocoy1lat  n sl() rtm(m oy4lmte neia()s2trxmo;u4oleo ieiatlm ea( o u)trtnmr3oadlate n sl()s2toir nu1llt mici ()sDur( p;u4olt io3iydls2em(vpnu)tltoio3iatoaDrlneo;() etmxm3oy1apt mivil()sDururont0texo i3iltfmDeau s;()tltnmf3tytlm  auvi;t  2umxr ny4om nlfvil( sruaum ;t0aetn i3iat m rmn p;u0 rtrio3iadfmtrlu s;(  euoio ou1ole lfvias srtr( oot1tptnio3iatfs2umnvo;u)trerirctytlmt ln i;( seurim3iy4alenlfeia(faDtmxroot0oltnmfetls a emuvsnt0aexrmrctytla eanei t  2tm(rpno4am elnvsat a2trur no0tltoiieiltfa rl( s u0artrif3iadoptr n i;t)trurirpiy1lp emivt t  2tmu pou4ale mfciadfm uluvonu)tlermo3oodfp raies;t  eum(o3iu4omtemfcs t a2uau  ou1aexoioetysfa2ra(vo;t)aexoxr3oydlate n i t t2toir oy4oltelivsasfarumur ;t0alenif3ils mDuluvs (4tetrxo3oydfm   uei;s) euoxm iydamtn neia()sDtr(rpoo1tle  ictatls2rlnmp t)aetrifciadfmt lu i;t)s2xmxr3oudalt mncs s) Duru onu1altomictad a ulnmpnu0altoircoa1fpteaneolt0 ruoxr oy4aptn fesat)s2ua(mp;u0olxnmociltfm2eluvpnt)areoxfciodlpD au o;s t2uriopnudllt miviltfa2rrxrp;u4optomfcilt m2ran p;u)altrir3ty1lpteln sl(0t2uoim3io4llt  feils  Dtmumooo1oexomociatls em(vsn(0trxomr oatoptraueo s seurxopoodlmtn ncils)sDumurp;o0apxoifctld s2uaumsn(4trenxoctydfm rlnvi;t0texmxm iu1ale  ics t s2ra(roou4apxniociyd m um( s t)arxrxr io1lmD  i il( srto(m oudom  lneiatfaDururpot4tlx  oetad s rln s;(0 rxrmfciotoa  auvs;t0s2umxrpiudalenmfci () rur(ro;t4aptomfciatfa2umnvs u0arerir3ta1fa  aivi ( srumxo nu4alte icslt)arrru  ot4texnii3iatla2ea( o u0trenxo iadlm eaivs;( sruoim ou4lptn nct t  ruax pnu4tpx iictad s2rmu o;u0 rermo3oo1fpDeauei s)sexm(mpiudapeelnvi tf Dtmum nt4olx  i3iadfa2rmnvp u) exoxrciytlaD  nvi;s)setrirpou4lptemivsltfaDurum no4tpeoiociytlaDrmn s;u4aetoxr3tadoa rlieil( srxmir iydllt lnci t) rrm(r oo1apx  fetatfm eluvo;() rtrxocoy1la rlnes t)seto(mpnodaleemfvi (f ruaxmo;u4texnmoeilt m2ra(vo;(4teerir oy1opt  n i s) 2xrxm3ny1optemfcilsfaDum(  oo1apeo feiytlmDrmuvsnt4 rxomoctytla   nvo t) 2um(mpio1al elivi ( aDtrxmp;t4olen oetltlaDrl( p;t)texoifciatfa  lueo () exoir ny1lmee ncslsf rtr( ont0opeoio3iys a eln onu0tltoxfctydfpDrln i;()t2tm(mpnudope  nvta(farrm(rono1tleoiiciytlm uanms;t)aetnmo3iytlat  u o;t0trur(m3nudlm   ivi t)a2rmxroot4tltoioeiasfs rmn o;u0 lxrxr iodop eanes;s0 eurxopoydolt  fvt s)arrrxm nt1aptnmictysfm el(vpnu4altrircootoa e nvil(0 ruoir nudol emfvt tf 2umx ooo4tee ioctyd m2ean on(0 etnir tatoateanvolt) rtoxmpnydlptelfcta()arrmx pnu0oeeoifeiltfm rm(vp u4 renmocoo1lmt  nei t t2to(rpiudaltnlfeia( artaur nu4aexn i3tyd m2eaums;(0 renif iy1laDr i o;s seum(m3iy4amtemivs tf rrmx p;o0tet  feiytls eau p;t4artnmrctytlmtrln ilt)srxrir nudape lictas a2rrxmoou4aet ifciadlmDem(vont0teerxfcoy1fa r u o;t0srxo(rpoo1olt mfcta( a2tau pno0teeomictlsla uluvp (4altrxf3oadla elivs;() etmxr nydlmeelfvt s  Dtm(  ;t0tle ii3tlslmDuan p (0 ltnxo iy1lp  aivi;s0 2umxr3nu4lle lics s a2rmu  ot1olx  ietlt s2em(ms (4 etnmr3tydlm   uvo s0t2ur(m ny4optnmicta(farrrumpoo4aet iieiasls2el( s;()altrmfciydlmDean s t)srxmxm io1om  lietasfs2rmxront0oetoioeiltfa2el(vs (4arenxf tytfmDelnei (0trurxr nu4olt mnci t) Drau p;u4tpxo feiytfaDranmon(0tlerio3oydoa e ues;s) eumxo iu4lmeelfci t)arur(rooo1aex moetaslm rmu on(4aetnio tatfpD  nvs;t0texmxr ny4oleemiviasf Drr(m no0aex ifeiatfm um(vs (0tltoxo iatlmtelnes;(0t2uo(m3no4ap  lnetl(fa2trxm no0apxnifeildfs rmumo t)areomf oatfmDelies ( texm(o3nydaltnmfesas)aDrm(  ;t0olt if3ildfmDul(vsnu4 lxnircoadlpDelueilt  rxm(opoy4lm n nvt t)aDraumpot0olx  ociat s2rmnvs;t) rxrxocoo1opDr i sls)t2umim oydal n nvtas  Dururp;u4tpt  i3ilsfsDeauvsnt) exnmo3oo1optrlnvi;(0t2urxo nu4am nlnetl(fs2ur(ro;t0tlenmieilslm eanmpnu4aexnmo ia1oa eln o t0texmirpnydlmtelnvia(  rrrump;u4opeo f3ildfa2el(msn(4alenxr3oydlm r ues ()srxm(opio1lme  fci ()sDraur ;u4tlx  iciat s rluvonu0tltnmfcootoa rluvs;(0srtmimpiu4omenlfct s  2uru p;u4oexnmfciydfmDrmnmp;t)treoxoctotfmD an s;t0 2xo(opnudlm e nvs t)sDrru p;o1tpeoifctldfm eaumsnt4 lxoio oydfm r ieo t0 rxo(opoo1omtnmicilsfa2rmxr ;u1tptniicildfsDranms t4tetrir oydoa  liesl(0 2xo(o oy4op nmici t) rtaxroou1tpeniieiadfmDulumont)aleomr ty1lpD  iei;s0truo(o3ny1lp nmnesas a2rm(r oo0oex  ictysfm2umnvsnt4teerxfcoytlaD ln s;s0 2um(o iudaltelivt tfsDta(mp;o1texo feiasfa rl( p (0 eenmr oadlat aueolt sexrxm3nudole  ncilt s2uaurpnu4teenmietatla ul(ms;()aexnifcta1fmDrlivil( teum(mpiy4omt lncsat a2ua( p;t1tpe  i3iltfs2rl(msnt0 lxrmfciadfat li i (0 2tm(mpiodlmee nctas) rtmu ono0aetn f3iadls emuvon(4tleoxocoydfa elivs;s seuriopnu4ol e icslsfarumx  oo4aeeo f3tld m um(vpnu) lxrxociotfpt  uvs;( tetmxr3iudap  lfvil(fa2ra( poo1ope iociydfs2elnvsnu) etnxr3tytlmDr nvo ( srtoirpou4lpee ivt t sruau poo0apenmoctydfa um( ont4teermf iadopDe nvo;t0 2xoio3ny4lptelieslsfa2tau  ;o1oee io3tas s rlnvs;(4aeeomf ootlmteli i;s)t2xm(m iu1om   iet sf Dua(m ;u0tlx  octld sDemump;t4aetrio3oatfatr uesls sruoxmpiudlpte ncslt)a2trxm oo0aeenmfciys aDem( o t0 renxr3iodfmDrlu s;() rxmxr oudol emnvi s)artrxr ou1tleomfeiatls ean pnu)tleriocoa1fpD lnei s srtoir iodlpen ieilt)arurxmpnu0oeen oetys a2uanmpn(4artoir3ootlpD livo;(  2uoir oy1omen fvtl(  Draumo;u4tee iiciys s ulnmon() lerif iodop rlnei s)texmxo3oudap elnvi (fsDumumono4oexomoeiytfaDeau p u0 rtnif iodfmte ivol(0srxmiopoudlltnmieta()aDtmu  ;t1tpxomoeiytfa rlu s;u)tlenmo iytlmteau ils trtoxmpnodame mivslt arrmum ;u0tltoifetadfm2umu p (0 exomo totfpt  ivo;s0 rto(m nu4oltn fetatfaDtmxr nt0ope io3iatlm2rmnvs;u)aexoio iatlaD aieo s) 2xmiopoy4ap nlfcils a2tau p;t1altnio3ilt m2ua(vo;t)aetrxo tatopDraieols0 2xo(o3no4lpe mict tfsrrru pot1oltnioeiytls umnvo (0altoxo oatfaDran sls  2xriopnudoptemfvsltfsrraxm nt0opeoiociydls2rmn pnt0trtnxo oatlaDraues t0s2toxr3nu1lm emfvsatfa2tmxr no0tlt  ociyd sDul( snt4tlermo todfmt lu sl( tetrxopoo1llenmnet ( sDtaxrooo1altniiciyt sDrlnvo ()alxoxr ta1op r ies;s seumir3oy4optemfei (fs2rrx pnu1ape  fciadlm rmnmsn(0aexnif3iy1lm  an ils  rumio3ou1om   neil()aDuax ont0teto iciatfa ra( p;(4treoio3iodlpDrlnesls s2xrio nu1amtelfeia(f Dra(mp;o0oex  ictls aDel(vp u4tetrmrciatlmte u olt0s2tr(rpno1lmt lieiat arum(  ot4tpxn ociydla2emu p u) rxomoctatfmtrlnvo;() eurir iydaptnmiciat) rur(rooo1tltn f3iltfs2umn pn(4tlxnxfctotoatrlivi t srxo(r3no4ole mivtasfsDtmu p;t4oexn fctytfa2raumo u) etnxfcty1om   u s;(  rumxrpiydalee fci (fs2ua( pno0tpen o3iydlaDrln pnu0texrmo3tadoat  i o;s trxmimpnodopeelnvi tfsrtmuro;t4tle  f3tysfm2uluvp u4trxnmfcto1fpD aivo (0 eumio3iu1omtnlfcs tf rum(  no1tlt moeiatlmDrmuvpn(4aexnxoctydlpt aieilt t2trim3no1ome lfcsasfs2rm(mpoo1tpt ii3iatfs rlump;t0artnxr3oydlm elivolt0 rxoim oudlltemnetls s2rrxronu1teen f3iys s rlumsn()tleoif tytomt liei;s s2tmxr3iodlltnlfvilsfa2rauroou0tlxnmoctydfs2eauvp;u)tlermr iadoaDrluvsl( s2xoxrpoo4lmtelnvtatfs2rau pot0tlx if3tldlmDuanvsnu) exoif io1lmDe nvsls) etrim3oy4ol e nvsls)arua(mp;u1aleoifeils a eaumo;u)treoxr iydoptr n ils)srtrxmpnodll n icils  2rru poo1aexn ocias m2umnvp;t) ltoxr ootfm  li i;t0trxr(r3iu4aptnmnvil( s2urum ;o0aetomoeiydfs2ua( snu0altrmr totfp r nei s s2umir3nodlleelivtl( srtax pou1opxomfeiad aDua(vp (0texoxrciy1fpDr ivsls texrirpnodaptelnvsas artaumooo0aexnifeiysfm2el(vsn()trtnif3ia1om rlivi;t0t2umxm iy1ape  fcils  rrru pot0oltniictltla2rmnvpnu)arerif iydoptrlies;()trxo(opnydomenlfes t) Dtm(  oo1teto oetlsfaDem(vo;(0altrxr3oa1omD lieo;t0 rtr(o nodlpenlnvtas arrmx  oo4apt ifeiatls emuvs u4texnmr iadomteli i;s)t2xoir oudap nmfvsa(fsrum( onu0opt mfeild a2rlump u4areomfctodlp eln ols s2umxo nudomt lneias)srrmurp;t4apeomi3tytlmDemnvsn()aeenxo3ty1lptrlivs;s sexmxopny1al nlnvi t s2uru  ;o1tptnmoeiytfmDrm(vo (4 eenxr oo1fmte u o t0 rto(m nydopt  icias)arraurpno0tpeo o3iysfs2elums;()teermocoydlat  nes ( seumxm iu1aptnmfcsas aDurx ont0tpxnmocildlm ulnvo;(0 rermo3ta1fmD aivils teur(m ou4lp   nci s)arraum ;t1tpx  ociys sDemn p u4trtoxocoatla e u slt)s2tr(r oydlmtnmnvtls  rtax o;t4oeeoioeiys mDrm( o;u4aexnio iytoatelivs ( seurir nu4om nmnciat)sDrmxmpou4tpx  feiadfs2rau snt)texrio3oy1omDeli s;t)s2xo(r3oo1lp n nvsas s2taxrpoo0texoifeiatfsDran pn(0aetnmo ootlatrauvi;t) 2tm(o oy4alenmnvsa()arrmxroou1aleniiciaslsDulnmp t)altrmr iatla raivi;(0 exrimpiydapt mivils  Drmumonu0tpxo o3iadlm2eln s (0aetomr oadomteaivo ( s2trxr io4am nmnvt ( s2rmumpot1ole  icilslm2rlnmonu0alxoio ia1laDrlneilt s2umiopoy1lp nmfes s aruru  ot4texomfcilt aDuan o t0aeerir ia1optrlnvols s2trio no4ameemnei (fa2rm(rpoo4optoifcildfmDrmn p t) renmrcta1lm rlneils trtmxr3oudaptnlncslt  Dta(mp;u4aetoifeild s uauvp u0trermf io1lp rlneslt truo(rpiydlpenmicias) rrrum no1ole iieiltfa eau p u4tetnmf tytoa rln ols trxrxr3iydoltnlnvilt  2ta(m ;o1tlxoifetldlmDuanmo t4tlenif3iadomtrlueols trum(mpny4ll nmnvtasfsDta(mpou1oet  octysfaDuanms;u)tltrmr3oa1lmte uvo;( trumxm3iy4alt  ivias) rurx  no0opxomf3iytfa rau pn(0aexniocoa1fm ranvils0srxoiopno1amtnlnvs (fsDuru o;t1teen f3iat s2uanvs (4artoio3ta1om raies t  2xm(o iu1op emfctltfsrurxrono0alt  fetyt a ra( pnt0 lerif3oytlmteluvs s0teuriopnu1omeemfvsa()arumum nt4tpen o3ildla rmnmp ()alenioctotoa e nvi s)s2xr(m nu1ape mfcia(fa2urxm nt0tptoif3iytfs2eau pnu0tetnifcoydfaDean ol(  2tmxm3iudamtemiciat s2uau p;t1oeenifeiytfa ua( o;t0texnxo oodlptrlnvs;( teur(r3oydlptelfeil()arraxmoot1tpen fctys s2umn s u0tlerxo io1fa e u s;s)trxmim3iy4llt  nvsa()arrm(  nu1apxoii3tltlsDem( p t4 eeomo ia1faDe uvi;t0sruo(mpoy1amenmnet t  Dumxrpot1oleo ietytfm2uaump (0tlenxr to1fat ai o s) exo(mpoy1lp e nes t)a2ta( oot1altomi3tydlm2rmuvs;(4 rtnxr3tatfmDe ueilt) rxo(o3no1amee ivslt srtmum ot1tptniieildlm2emu pnu0 eeomo ootlmt luvs t0 rtrim3ou1omeelncsatfsrtm(mo;o1oleomfctytfm2el( o (4aleomf3oo1fmtraues;t)srxm(mpiu1om nlnvt s) 2ta(rooo4aleo o3iadfa eau snt4 ltomr oatlpDrlneo s)s2tm(m3iudllt mivsl(  2tmxmoot1tlxn fciyd s2umn snt) eeomo3oy1fa  aivs t0sexrxo3no4llenlnctas srrrx ont1alt io3iatfsDul( p ()alenxfcoytomDe i s;t s2um(opno1olenmfcs t srtrumoou1alt  o3tasls rmums;t0artoif tytom  lies (0srtmimpou4lmee ncslt) rua(r ou0apxomoctldlm2em(mon(0altrirciytomDraneo;t0 exmir3iodoptnlfeiat)s2tru pnu4alx mi3tls sDel(vpnt)alerxrcoytfmte uvslt0srto(r no1amtemnvias) 2rrxrp;o4ale io3iatlsDean p u0 renxfctodomD  u i s teur(m3nu4om e ieta(f rrr( pnt0tptnmiciytlaDeauvsnt0 lxrmf ootopD lnvilt)s2tr(o3oudamt lfesat)a2rauro;o4oexo f3iyt a2rl( pn(0aexrxrcio1fmD an sl( t2xoxr nu4op elneils aDra(r ou0tpt  fcildfs rlumon() lxrir3iadoaDeluvi;s s2toxo3ou1amt mneias) Draxmont0opto ieiltfs uluvp;u4aetrio tydfpDrauvs;t s2umim no4lpenmnes sfsrtmxrpot1apeoifeiydfa2em(vp;u0tltnmfctytlatrlnesl() euoio oydllt mfci s aDrmurooo4oex ii3iltls rln o u0tlxnmociatlmDr nvi t  etoxm3iodaleemfcta(  2tax pnt1tee  oeiytfa2rmumo;t)teenif oadlp elnei ()setr(rpny4aleemictlt)sDum(mo;o1oexo fetyt a rauvp (4 lxrio3iytfatrln s s) rtm(o3nydamte fvt tfsrrmxmp;t1aptniieiadfmDrln p;() exrmr oodla elnvs ()s2xoxm3ny1lptemivi t  Dtau p;o4tetnmf3tat s2eaums (4texrircootfmtrluvs;()teto(r3io4ale  nviatf 2rruroou1apeo o3iys a uluvo;t)tlerxo oa1omte u ol() ruo(r3no1omtemivslsfsrrmurpnu1opt mo3tlsla um( p (4 reoio ta1lmt auvo;s)s2trxopou1ol nlnvsatf Dta(r ot0apto i3tas sDuluvs u4 rtrmoctytomDeluesl(0s2xrio3ny1op n fci t) rumx pot4apt  f3ils m2umnvp;()artoxrcio1faDrlivs s0s2uoxr nydopt  nvil( s2rrur no0tpt  oeiysfsDel( o ()artnif to1omDrlu ils)s2tr(r iodap n net ()a2ua(ront4olt iiciatlm2emu s;u) rtrir3oydlm  lieo (0 rtoio3nodomt mnes (farta(rpoo4tlto oetat a2rmu o t4tlerif3ia1fp  ln s s)seuo(r3no1lp e nvslt s2rrurp;t4alx  fciadls2eluvo;t4aleoxf oo1fateli i;t texm(m oo4ame mnes t)aDtmum ;t4apt  iciltls2ul(mp;(4trtrxf3io1oa elnvilt) exmxopio4lme lieta( srua( pno0tlx  i3iysfmDelu p (0artrmrctytoaDeaieo;s0trtmxr3oydoptelivslt  Dtrxrpou0oetn ieiytlm2uauvp;t) lxrio ta1fpt li i;s teuo(rpoo4am e netatfsrrr(rpnt4tex mo3tatfm ea(mpn(0 lenxfcoatfaDe nvsl( tetrxmpoudlp  lfvtas) Dta(rpnt4tlenmiciydfa umumo;() rxoxf3tydopD auvs;s)trxmxo no1aptn ietls  rrm(  ot4teeoioeildfs uanvo;t4tleoxf3tydopt auvi s0trtrxm3oo1omtelfvia(f rtm(  nu4oltoioctysfm2elnvsn(4arxrmr oydlm   n il( s2toxr3oy1am  mfcsltf 2urxm oo4oleomfeildfsDumn p u4tleomr totoaDelues;s) 2xr(o nu1oltelfei tfarrmx poo0tltnif3iasfsDumumsnu0texrmfcio1faDraivsls  exo(m3oydoptnlfvs (  2trumonu1texniicilsfm eauvsnu) rtrir iy1lmDrai o ( s2trim iu1alen icil( s2rm(mpot1tlt mocilslm rl( onu4aetnmfcoodfa   iei s) rur(rpoo1aptn fetlt)aDtrxr ;t4apt ioeilt sDemnvpnt4trerio3iotopDr ivo s seum(r oo4llee feiasfarurxr nu0aee  feilsfm rluvo;u4tetoxoctytlmD livs;s srurxopoydlmee fcsa()artaumoot0tpeomfeiatfaDuln o;() ltoif3ootfmD auvi;t0 ruo(o oudlpe mncil()a2rrumpot1tptnmfeiysfa2umuvo ()texoio oo1omt ai i;(0seuo(o nudlptnmiciat) 2trur nt0tlenmocils a uanvont)aleomociodfm ean s;t0 rxrxm oudlltemfci t) 2tm( ooo4oleo fciydfs emnmp;u4 exoxr3iodfatraivilt0srtmim oo4ole  nct () 2rm( oou0oet iietls s umumpnu)arxrxo iatoaD an s ( t2xmir3oodame mnvt t)sDrmxmo;u0altomo3iatfa2uluvonu0 rxomo oadoptrln i s0sexrir nu1al e ictls arrrx pot0tee  o3ildfa2eau s;u)tltnif3tydopDrai olt0teto(m nu4al n fcta()srtmxr nu1ale iictytlm2um(mpnu4teeomfctadlaDr n slt)trum(m nodomte ncsa(fsrraxmpot0opxo iciltfs eaums (4 rtrifciodfmtranvs;s t2toio nydapt  fviatf Drax  oo0aeto oetldfs el(monu4 rtnxfcta1op r uvs ( s2xoxrpiy4aptnmivils) Dta(m ;u4opxnmfciysfmDrmums;t0 rxoxr iydlp ranes () etm(mpiydam nmfeia()a2rax oot4apxnmoetatfm ean o;t0 ltnxf3oo1fm elnvi;t)srxm(m io1omeemfvsa(  rrrxm nu1tlx  f3ils aDel(ms;(4alxrmo to1lmtelnei;()seurirpiu1am  mfvs (fartmx  oo1aleoiieiyt a2rmn pnt)aetrif to1fpDean ilt0t2xmxr3oodll   nesat  2raumpoo4teenifctydfa rluvs u)alxnif3ootlpDranvi t  rxr(r3oy4ame  ieiatf 2rr( poo1apeoii3tltfm umuvp;u)tlxrxo tadlaD anvi (0 rxoim3nu4ape mfvta( s2ta(root0olxnii3ias s2ua( snu4arerxo3totlpDelu ils0sexm(m3ny4lm  mnct () 2tmump;t4aet  i3tls mDrmnvo;t)aetoio tydopDr uvi s)trur(o3ou1optelfcsls)sDrmxr ;t1tee ioeiatfsDea( s;()arxrxocia1oa eaivs;s  2to(rpiodoptnmfet (fsrtaur ;t0tpxniieiysfm2rmumon(4 rtoxf oytfmDrai sl(0tetoxo3oudlptn ncilsf 2raxront0oleo oeiys a2rlu s u4 exrmfciotfmt livo t)texmir ou1op emictlt)srtmx p;t0ale io3tat mDeauvonu)arermrctydfp  aues;(0s2toio3nydlp  mfvs s)arumumoot0opt if3iyt a umnmsn(4 rxrmociy1latraies s0seto(rpiu4ap e nciat)srtmxr ;o1olt ioetyslsDel(mo;t4aetoxr iadoptelueo (0sexr(r3oo4op e fvs s  rrrumo;u0oexo iciasls2rlu s t)aetnmf3ia1omteln ils tetmim oy4lmenmnctlsfsrtm(r nt0alxoio3iltlmDrmu sn(4 lxnio iatop e uvo ()teumxr3iy1ope liei t) rrm( pou4tltnifctyd a2ea(von(4 exrxf iatlatelu s;t srxmio io1apen feta()sDuaxrpoo4oetomietydla2rmn p;(4artnmo3oy1faDraivo t)t2toxm3ou1am n iviat)arta( ont4texomfeiaslmDrlnvon(0tetrxrcoodoa raues;s0trxoxm io4ol eliei s  rtmumont0tpxo oeiytls2rmn snu) eeoiocoodlpD  neol(0trxmxm iy4am nlicsat sDra(rp;u4tpenifeiytlsDrl( p u4alxrxf3tatop eaivsl(0tetrim3io1oleemnvsl(f Dtm(  ;o4aetomf3iyt a umnvpn() rxnmfctodfa r nvo ()seuo(o3oy1op nmfvs sf Dtaumpot0aexn fctydfs eau p t0alerio3oadoa eai slt)t2urio3ny1al e feiasf 2tr(ro;t4tleoiociatls2em(mpn(0 rxomr iytfpD luvol() exrxmpnodllte neiat) Durur ;u1tetnmfciyt s ranmo u)tetoxf3ia1latranei s  rtmxm iy1apt lneslsfs2tax ooo0aleoifetltla2uauvpnu) rerxo3to1oa eluvols0 rurir3oo4ll  lfctl( s2uax  ;t0tpxn o3tad m rauvon() eeoxo3oydoptelies;( seuoxo3iy4alt mnetl()s2rr(  ot4tleniiciys m2rluvon()altrif ootlmDrlieo;t0s2xoim iodoltnlfvs sf rtm( p;o1opx ifeiad sDemn s u)arerif oa1lmD aues;s)srurir3oo4op nlnvi s a2tmxmo;t4texoio3tadfm uluvpnu)treniocoa1fmD auvsl(0s2xm(r3oodope  ictls)s2tm(rp;t4alt  o3ildlm elumpn(4 rerxrcty1fpDr i i;t  rxm(o oy4om nmfct ( aDum(m ;o4olx  o3iltfmDuanvont)arenif3tatfptean ils0 rxr(o no1opt mnvi s) 2umxr ou1apx  ieilsls rm( pnu4 eeoxf io1oat aieo;(0srumirpio4ome  fvt ( a2rrx  nu1oee mf3iydlmDemnvonu4 leoif3iy1fm r ivo;s)srxrio iu4op n ivi tfaruau pou1alenmfciyd s uanvsnt4tlenmf3ia1lpDrlivi ( s2xo(o3ny4omtn ivt s)srrm(  ;t1olxo f3iysfm2ulu p u)arxnircoy1omt lnvsl( sruo(rpnudapeelnesl(f rrm(r nt4tlx mo3iytlm2ul( o;(4 lxnxocoydfmt  ueo t s2toxrpiudlptn fct t aDraum ;o0apenmieiadla ean o;u) rtnmf oadoate i o;s) 2urir3nodolte fcil( aDrau pnu0tpenmoetlsfa rlnvo;t0 etomfcio1faD  ieo;s trumxm3nu4lm   ivt t sDtr( pnu0olx iieiysfa2rmnmp;(4aeeoxf3oa1omtraues;t0tetr(m3io4lptelfei (fa2trxmp;t4oexnifetldfm2emump;(0artriocoodlm r iesl(  rum(r3iodopeelfeia(  2trurono4olxn fciasfs uln s u0 lenmfciotomtraneslt0setoirpno1altemfctatfs2urum ;u1oeto f3ias sDuluvp ()aetrio3tytop ranvs;s0 2xm(m oy1ll   fctltfsDraxroot4tet  oetlsfm2ua(vp;()alxoif3io1fpD  uvslt) etoio3io1ape lnesa( s2rr(m nu1ole  octasls2raump t0altoio3ty1om ran olt)texoim3ny4ope lfes ( arua( oot1tleoif3ildla umnmo;(4arxrmoctodfmte n ols s2tr(o nu1ll nlfvtlsfaDum( pnt1texnmi3tys m2ul(vs;t0tlenxf3ta1fmt au i;t truo(m ny4openmfcsasf Dtrxmono1oleomfciysla rm(mon(0aexrmfcio1fpD lneilt)seuoir oy1om e fesas)arrrur nt0oltnmicildfm2rlnvs;(0 rxomr oytlm r ieils  rurir nu4ap nmncsls)aDtmxrooo0tet ioetldfs2emnvont)aetnxo3tatoatraies;s  rxm(m3io1lle  iesls)s2rrxrono0tptomoctasla umu o u)tlxnircoa1oaD auei s t2uo(r iy4lme  fvtatfaDumx  ;t0tex mociatfa2rau o;u4 lermr3to1om e ivi t0t2xm(r3iu1opte fetls  2tr(mooo0ape ii3tytfs rm(vs;()alerifciydlp   i i t0teumim oudaptnlfciasfs2umu  nu0tlt mieiydfsDem(mo;()tltomr3tadoaD aues s srtoxr3iy1lpte iesl( aDtmurpoo4alt  iciatls emnvp;u4arenir oo1opD lieols0texo(o io1ol nlnesls s2trx  oo4oltomfeiysfm2rl(mpnt4 lenxo tatomD  ieol(0sruoxopiu4omt  nvta( sDtaxroot1tlxo o3ildla em(monu4 exnif oodop eaieo;s)t2tmim3io1lm nlfvsa(fs2ur(mpnt0olxomo3iatfm uluvs t4tlenxf iodopDrlnvsl(0 rur(r oo1lmtnlicia(farumxm ;u0tex  fciysfm2eluvs;t0 rtrif3oatlptrluvslt0 rxoxopoudome  fetas)arurur ;u0oetn ictlt a rmuvp;u)artniocoatfmDe uvsls  2ur(m iodoltnmfvias a2tau ont4oexomoctasfm2rlnms u4teermo3ta1faDe ues;()srtm(opny4aleemfet ( sruaum ou1texoioetldfs2ea( s (4alxoir tytoa  anvo (  2uoxm3iy4ol elfci t)a2tm(rp;t1texo oeiadfa2um( p u)arxoif ta1fpDe u o;( teuoiopio1lltn nciat arum(  nu0optomf3iat m2rmnvp u0 leomr3oy1lpDrai s t0s2tmirpnudapt mfesat a2tmx pnt1olx  oeiyd sDum( p u)trxomrctytlmtelnvs t0s2xrxr3io1al n fcsa(fa2um(rpot0apxniiciadlm ea( snt0texrifcoy1fa raies t) exmxrpiydll   fvta()srumxrpou1tetnmieils a ra(mpnt4 exnxf3to1fp elu i;(  2tmio3iy1apee ivtas s2tmu p;o1aex  f3ils a2ua(vs;u)tltoxo iydlaDr uvi;()t2tmxm iy4ale  ivi (  rua(monu0oet mi3iadfa2ranmp;(4 exrxocoa1lat lueolt  rxoir3iu1lmeemieil( s2trumoot1teeo i3iysfm2rmnmo;t4 rtrif ta1lm  luvi;t0sruoim io4lpe  ictat srrm(  ;u0apx  ociad sDul(vo (4aeerif3ootlatrlnvi s tetrxr ny1altnlfet s)srurur oo1oex mieiad a2rmnmp t4texoxrcoo1fmDrlu s;()t2xmiopnudolee nct sfsDua(mp;o4texniietldfm2rln onu0alxnmo oydfm  aivs;s0 etoio3iu4am e ies s srtm(mpnt1tpeoiieiydfsDem(vo;t4trxnxf todom raueil(0trtrio io4lpe mncs s)sDtrumonu1oexomfeilt s ulnvpnt) lerxf3ta1fmDelnvols0 exm(opiydlmt  iciat  Drmu poo0ope io3iaslaDea( o u4teeoxf3tadopte ivi (  etrio no1lmee fvtasfa2ra(r ou4teeniicildfmDulnvpn() leoio3oy1oa rli o;t)trxrxrpoydap nlneta( aruaum nt1oet  i3iys a rlumo;() eenmrcootlmDelnvils s2xrirpoy4altn fct tfaDurx oot4tpeoiociys m2ra( p;u4tltnxf3iy1fpt  uvs s  2tr(opoodlmtelnvi s  Dtru  nt0tltnifciadlaDraumo ()arxrir3oo1fpDr uvsl( sexrxo3nu1optnmnvtatf rta(rpno1apxoioctldlm2emnvo (4trtnifciotom   uvi ( sexrxmpno1lpenlfeslt a2ua(mpou0altnmoeiys aDul(vpnu0 exrxo iy1lm r ueo;t0s2toir ou1lpenmiciat  rua(rooo1aex  ieilt sDum(vpnu) rerxf3ta1fatrai s;t srxoio3nudlpen iei ( aDurumpno4alt iictlsfa2ul( o u4trtomocoadomDraies ()setmim nu4llte netasf Drmu o;u1tlxn ieiyd sDean snu0aetnio3oadoaDelivs t)seur(o3ny1omt lict t s2ur(mp;t1ale ioeils mDemump t4 rxrio iotfat  ues t)trxo(r iodlltemfvsat  rtmumono4apx iieiadlsDem(msn(4alxoirctodop  aiei;s)teurimpiu1ap  lfcsasfarrr(rp;t1opt  ictaslsDraumonu4aeermo3oytfmte ivsl(0 2toirpio1ap elivtl(  2rmuro;o0oltn o3iys sDrlums t0alerxfcoydoa ean i t) exr(o ny4omeelfvi tf 2rr( pnu0tpxoio3iadfa2rmnvpnu)tetrxf tatomtranesls0trxm(opnydale mnvia( arur(roou1tltomfciytlaDrmu s;t4 reoxf3to1omt aivsl(0 ruoir oydap n neslt a2ua( onu4apt mf3iys aDumuvo t0aetnircoy1fm r i il(0srurxr ou4lpeelfetlt)srtmum ;o0aetn octys mDra(mpnu)tltoio3oatfa  an ils0trumxmpiu4op e fesls aDra(rpno4aexnioetldlaDrl(mp t4alxoir to1om  livs;s0s2xmxr ou1am elivtas  2tr(  ;o1oltomfciydfmDem( p (0 lermo oodomD  ies;() rxmxrpiy4ape mfctat) 2urx p;o1tet ii3iysls2ua(msnt0altoxf3ia1lmDelnvi;t) 2tm(o3iu4op elnvsl(fa2ua(r nt0ale ii3iyslaDulnms;u) eeoxr totfmte nes s0s2toir oydol e nci ( a2ta(rpot0aeen oeilsfm emn snt0tlxoxocto1fmD aivilt0s2umxm3oodomee nei sf rtaxm no4opxomo3iatla2uan p;() renmoctodoate nvil()t2uoim3iodlleemnctls)sDua( oou1altniicias sDean p;u) rtrmr3oydlmD anvi t texr(rpio1lme  nciltfs2urur nt0olto i3iys m umnmpnu0teenmocty1fmt  u ilt0 2tmxr no1lm e nvtatf 2taxmpot1tptnmoetatfsDra(mp u4teeoxfctodla e nvi;( texrirpoo1alenmfcs t)s2trxm oo4apto octasfs rmu s t)trtomr3io1fptr uei;t0 eurim iu1lme lfeslt)aruau pot1aexn fctldfsDuluvo;()arxnmf3oadoaD li s;t t2uoxr iu1oleelietlt)srua( ooo0optnif3tadlm2ulu pn(0altomo oa1om  lneol() rurxm ou4op  lfcil(farraxroou0tltn o3iltla em(mp t0 lxnmo3ta1omt lnei s srtrirpnudllt mnvi s  rrru oot1opeo i3tlsfmDelnvp;t0tltrio3ootla  luvol() 2ur(o3oo1ap  mietls  Drm(  ou1opxnmoctyd mDeanmo;() ltrifcoytfaD au o;s) eum(opny1lmtn feias  Dtaumont4opt ioeiydlm2uanmo;t)altrif3oytfmD  uvi t srumiopou1apeemiei t)srumxmono4ole mi3iysfa elu o ()aexnmf ootoaDrlu i ()seuoxm oo1lm   ivt (fsDtau  no1tpt  ietatlsDeln on() leoxo3iy1lmDrluvs t0trumir3oydalt mfvtl()sDtaumpnu4tet iietls m rl(vo u0trtnmoctotfmt au s t)t2xmiopno4amte icils arrm(rpnu4tetoioeiatlm2umumon()tlenxf3to1lmDeli s (0s2xmir nu1amtelnct s aDtrx  ;t1tlxn oeiysfs2elumpnt0 rerxrcoadoa e ieslt) rtm(o oy1ape micias)a2ta(mooo1aeeoiictad m ulnvo ()arxrmo3oatfp eauesl()srtoim3ny4al n ieils) Dua(mpnt4olxoifetadlaDuln s;t4alenmr oy1lpt aiesls0sexm(m iy4ll emicilt  2tm(ronu0opeomociadfmDumnvo u)trenxr3ta1om  auvo ()t2xoxrpou4lmt  ivslsf Drmumpno0aetnmfctysfaDemn p u0tlxrir oydop  li i;(0trxoxopio4lmen nvta() 2urxr ou0olt mfeilsfs2ea(vsnt4trerxo3ta1fp  lies;() 2umio ny1lpen fesls)srumur ;t1aexnif3tltfs ua( pn(4tlermf oy1lm eluvi;s t2to(opoudol nmieils s2um(rooo0oltoiictls a2ea( p (0arenmo3iatfpt an s s)s2xm(m iodam  lnes (  Dtr( ono0tpeomfeiltlmDeluvs;u0 lxrmf iodopD  ivi;()srtm(opoydlm e neta(fsrtmxmonu0tpenmo3ildfm rm(vpn()alermf3ty1latraivils0t2xm(o3ny1lpt  nctasf rtax  ;o0tpx  oeiysfsDuauvsnu0 lermoctytopDranei;()sexr(o nodlm elfctl() rua(mont0alx mfeils aDua( s t0alxnxo oa1la  li o;t0setrir iydaltnlnvta( aDra( pno1tle  oeilsls uanmp u0trtrmr tydfa  lneol( sexo(m3ou4olt lfcta()aDumu  ;u0opto fcils a rmuvo t0tlxoioctodfpD auvols t2xoir ou1lm   nctl()srurumooo1oetn ictasfaDrlnmont4arxnif3tatoptr ivil(0srxrim3ou1lp n iesltf Dum( oou4tleo ieias a uan s u4trxoxf ootoa  livi s)t2xmirpny1ope licil(  2rauroot1openmocildfm2ra( snt4 rtomf tydfa  au ilt0t2toxr oy4lpee fesls  ruaum ;u1tpenmf3iyd m2uanms (0 leomf oy1lpDe n ils0srurxrpny4ap  mnetat)srrauro;o0tlxomictysfm2em(mp (4teermociotoa e uvs t) exoxopiu1am  lnet tfarur(rpot0apt mociaslm ra(vont)aexrio io1lmt au s t t2trir iudol nmfcia() rtauro;o0apto ocias m eluvs u4 exnir oatlp eau i;t texmxmpoudll   fct s arrauro;o0ole ifcils sDum( s () rxomo3ootomD anes ( srxrio3iy1apt  fes sfa2ta( ont0openioeiatfa eluvon(4aexrmo3oodom e nvol()t2tmxm3oy4ome lneslsfsrra( ont0oetomoetad s uauvo ()altrir oadfp  ln s () 2uo(r io4ome lietls  2rru  ;u4tpt iociadfaDuln p (4tetnxf3oatopDelieo s)sexr(m oy1alt mnvia( srumu  ou1oee miciatfmDeaumo () rtomocio1oaD  ivi;s0 rxo(r iodopen icta(f rrau  no4aex iiciyt sDulumpnu0altoxoctodopDr neo t seuo(r3nydolenlfvsasfsrrauront1tee  fetyslsDuln o;t0 exrxfcoydop r ueslt)srxrimpnudlpe  icias) rraxmooo0opeoii3iatfm2ul(mo;u0alxrxr tytop  auvolt t2xm(o oy1omen fesa()a2rr(moou1tpxnifeiytfs rlnvs;u0tleoxo3iodomteaivsl(0trtoxm oo1op nmivtl(fsrtrxrp;t0oetnmieiytls2uluvsnu0 eeomr3tadfa  lnesls0 exoxrpio1lpteliei (fsrum(  ;u1tetn f3tyt s2uauvp u) rerxr3oodopt luvo s0s2xmxrpnu1ale lietasfs2um(ro;t0tpeomf3ildfaDraumont4arxnxrctydlmD  ivs (  ruo(r3no4olte ivs ()srra(mpnu4openmoctysfm2eauvo;t4 exnmocoadlmt lneolt  2xoirpny1altnlivtl()a2tru  nu0opxo i3iysla2eauvo;(4arxnmf3oodopDrlnvo t0s2umio3oy4lptelfci sfsDrrumonu4teenmieiad a eauvo t0tlerir todfpDelueo s)texr(m no1ameelfcs t) 2umxmpno4tet mo3ildfaDranmsnu0 lxnmfcty1fmtranvi (  etm(r no4ll emfct s)aDrmurp;o1texnio3iydfsDelu snu0artrmo oa1fmt  ies ()s2tmxmpoo1amtemncs () 2rmu  ;t1oexn oetysfm2rmnvo t0aeerxrcia1oa rlieol() exoxr ou1opt lneil( s2rrurpou0oexo oeiys m uauvp;(4trxnxoctatomDr n o;( srtr(o iu1lpteliesl(  Dumum oo0open feiyd m2emumonu)aeeomf totfmte u i;s)sexrirpiy4lle mfetl( a2tmxro;o0optn f3tatlm2umumsn(4 etoxfcoo1la eluvo s0 rum(opio1lm  mfeils aDtaumpoo0apx iieiasfm elnmo u0trxrifcootlptr n sl(0teurxo iu1op e fvil() Dtmxrono4tpxnmi3tatfm rau p u) ltoif oytfm elieols0seuo(mpiudlm nmnei s)arrru ont4oleomo3iadlaDeln p;u0 ltnxr oo1lmt aieo t0trxmxo io1lmt  net t aDta( ooo4oexniocilt m em( s (4areomr3iy1fmteaivo s s2tmim nudlle miet (f 2ta(  no4ale moeiys m ul( s;t0alermo3ia1fatrau i;t  2xo(rpnodap nlnviasfa2tm( poo1opxoifcildlm ea(vp (0teeomocoydfa r uesl( setmxr iydam e neil()sDum(ro;t4tlen o3tat sDul(vp u0tltrmf3ootlptr uvo s) rur(rpiu1al emfvilt arrrxro;u4oetomieias mDraumo;(0tlxrmf iy1lpDe ivolt0trtoio iu1ameemfcsa(fsDtmuroou0oeeo feiadfs uan o () ltomf iydlat  i i;() etr(o3no1al nmfvtasfarta(mp;o4tpt iiciytfsDra( s;(0 lenmfctytfaDeaneolt teuoir iudlp nlnvt (f Dtax poo0oltnmoetad sDrmn pnu4 reoxf oatfpte ieo ( t2xr(r oo1alenmici s)aDtmur ou4alxomf3ilt a2emumpnu)areomr io1opDr ivils0sexo(o iu1ap  mfvil(  2ur(m ou4tpe ioetasfm emump;(4aeeoircty1la elieo;()trur(mpou4omt lfcia()a2tmu  ;o0tetnifciat mDum( o u4arenmo iodop eliei;t  2uoxmpny4am elfetl(fsrtru oot4oee ifciys a eau p u0 lenxo iadlpDe iesl(  etoio nu1llt  fct ()srraxroot0opxn ictad m rl(vs (0tleniocoa1lmt ai o;(0 2xmiopnudam emietltfsrrrx p;o1tlen feiatfs2umums u4 rxomr oatla raneo ( srtoio3iodol nlfvs sfsrta( p;u0ole  fciadfm2eanvsnu4tltoxr oydlm   uvo;t)srxmxo oudlptnlnet (  rtr(mp;u0tpe io3iatla2elumsn(4 eeoifcty1fpD aieo t0seuo(m3no4optnmfcia( s2urx onu0aee mfctydfs umu p u)arenmociodfmDraueolt0s2xoiopoy4ame mfcia(fsDrrxr ot4apenmietadla2ran p;(0 lxoiocio1fp eauvs;() etmiopiu4amenlfvsa(  ruax pot1altomoeildlsDelnms ()tetomr3tytlpDrlnvi;( s2xo(m no1ameelivslt) rum(r no1aetnioeiyt a2rm(mon(0arxoxocoadoaD lnei;s)texrxopny1al   nctl(fartaurooo4tee  fcild a rl( o;(0 rtrxr3todlp  an olt0 rxm(rpiudol n netatf rrax pno0tptnio3tatfa ul( p t4 eenircoodopt  ivsls)trtr(rpnu1lmtelfesl()aDum(r ;u0teen i3iyd s ra(vonu0 lxrio oatlmt lues s0 2xm(o iu4amt  netls  Dtr( ooo4olen feiyt a ranmo u4trtnircoatfat livolt0 eur(m3iudomtnlncs tfaDtaumo;u1aexn oetysla rm( o;(4altrio3tadopteauvi (0trxr(r iodlme mnvtl() Drmu ono4alen o3tydlmDrmuvo;(4texoxociatfptrlnvi t)t2xoxmpiydoleemnvil()s2tmxrpnu0aeeo fciytls2emnmsnu)arxnioctodlmDrlivi;s) 2uo(r3ou4lp   ictls srrr( p;u1tlenif3tat a2emums;t4texrmfcty1lmDelnvo ( srxoxo3oo1ll nmics (faDtmu ooo1olt ifeiyd sDul(mo (0 ltrmo3ta1lateaneo;s) 2ur(opiudaltemiesatfaDrax p;o0aexomoetyt m2elnvs t0trenxf tydom  anes s0sexrio3ou1alte nvsasfsrrrxmpou0alx  octydls2el(vo t4tetnif to1oa e uvilt  exoxo3nydap n fcia() 2rmxmpnu0opeoifeiyd mDrln o;u4tetoirctadla rluvsls  2tr(o oodll   ieia()s2uaxmpoo0texniieiltlsDranvp;u4tlenxr3to1fm rli i (0srurirpio1lm  lfvsls aDtaxroot4tpeomo3ils s2ulnvo;() lxnxr3tatfateanvs;t)t2tmim3iodlpt lfcta( artmxroot4optnmociad a2umnmpnt4aetnmfcto1op elneilt)texrxopoy4ll e ictat)srtmurpno1opxn o3iad s2elnmo t4aeenxo3iotomDeau i s)s2xrxr3io4ap nmfcsasfsrtru  ;o4oetn feilt a2eauvs u4 etoircio1lmDrau o s0 exoio iu1ape  nvsas a2urxrpoo4tpx ifctydfaDra(mp u) eenio3oydfm eln ols  2tr(o3iydlmtnmnctl(faDur(r ;t4aetomiciasfs ul( pn(0tlermociodfat auvi;t) eurimpoodll e ict s srum( oot1apenii3tls s eau p;t4 etrir3iytlmD  i i s0trxoxo3nydlmeelfctl(faDtm(moou4olx mieiyd a ul(mo u4tlxrio3oodfm rluesls)teto(o3oo1lpee nvta() 2tr(  nu0apenmoctld aDrlnvp;(4texnif oatlm   ivi;() 2toxopiu4lmt lfeta(fs2rm(m nt0aetomictltlsDrmu s u0texrmr ootlaDe nes;s)srtoir oy4ape  nvt t) Dtrxrp;o0openmfetlsfaDrlnvs;(0aexoxo3iatla  ai o;t trto(mpou4lmt mnvia(fsrtmum ;t4oleomiciltlm2uauvs u4arxnio3oodlmtrlnei;( trtr(mpny1oltnmncsl(fsruau  oo1opxnmoeiat sDranms u4arerxr3oo1omte u i;t)s2xoxo iudomen nei ( s2raxm oo4alxomf3tatlsDeanvonu) rxomo ty1om rlnei;()t2uo(r oo4lme lieil( srrmxr ou4oltnifctad mDumnvo (4trtnir iotlpteluvo;(0s2toxo nu1am   fcslt)sDumx ont4oleomf3tytlm2ran o;u4tlenircoa1fptrlnei;() rxrimpiu1lltnlies s arra(r no4tpe mieiyslsDumnmp t)trenmr3oy1fmtr n s;()teum(opiy4ll n fctasfsDuau  ou1tpx mictys sDrmnmpnt0aetoir3iadopt an i s0 2to(o nydal e fetas  Dumu  ;u0apt  ieiad mDum(vs u)aleomrctatfaD lu i;(0seumimpoydalen nci s)sDtmum nt1apeo i3tlsfs elu o u0tlenxrciatlaDrlues;( texo(o oo1om   fvt tfartrumo;t0aleomietldfaDem(mo;t)tlxnxr iotfpDelivi ( teum(m3io4lmeeliei ()sDtr(mpot4aet  icilsfm2ua(mont0arxrmocoa1lp r iei s sexmxopiudamtemnci (faruru poo1aetoiictad sDeauvo t)arermr tytfm  lues;()srur(mpnudop nmietatf 2ur(roou1tee moeiydlm2umumsnu) etrxf3iydfpDr uvsls0 2uo(r iy4lp nmieta(f Dua( ont4aee  oetatla uau s;t) etoxr ootopDeau s;t) euo(mpnydlmt  icsat)arta(mpoo1optnmoeiytlm2elnvo u) lxoxrcoo1oaDe ivs () rumim3ny1omt  feia()srrrum ;o4opx micildla2umu o;()aexnxr to1fmteai ol() 2uo(m3iu4optelnet sfsrumurpnt1aex moeiltfmDea( s;(0tltnmo to1oaDran s t) 2xr(o3nudllenmfvt t sDtm(r ou4oeeo f3iytfm uanvo;u4 eerxr3iydlm elivil()srur(m oydap n nvsl()s2tr(mont0tlt  i3tysls2um( s;t4 lerxf ty1lp eluei;t0trxrxmpoudll elneslt artm(mo;t1aeeniietyt s2elu p;(4alxomo3oydoatrli sls) exrxr nu4lmen ncslt artmumpoo4optn fctytlaDelnvp (0trtnxr iadlaD  u o;t)s2trxr3iudal nlncils  2tau oot0oet ioctatlaDrmuvp u4arermr3ta1fmt au i;t)texrio oy4lpeemietltfsDururpoo4oet iociadlsDrln p;t)tetrifciydfpteai o t t2xriopnudlltemfcta( aDtm(mpnt4tpeomoetlsfsDeluvpnu)aetrif todfp rlu s;s) 2xmxrpoodolee fei ()a2rmx oot4tpxnioctatfs emumsn(4trxrir3oo1lm rluvil( truoxm3oy4llee nvi ( s2tm(m oo4texn oetld sDeau pn()tlxrmocto1oaDrln ilt srtm(rpnudom e neiatfaDumxm nt1apenifcilt s2ea( p;()aexoio3oa1la  lnei;t sruoimpnudll n fci t sDrrxm ou1aetoiiciatlm2ulumsn(0trxnxrcoodfpt ln olt  etmxr3oy4lmtnlnetl()srtaxront0apxniictysfa2eauvp u) lerif iadfat ln ilt)teto(opoydome mnei t)arumxr nu1ape miciydls2umu p;u4tlxnxf3iytlpt aieo t0 2trxo oo1ale mici sfs2umxroou4tpt iicilsfmDraums ()aeeoxf3oadlmtr ueo t s2uoim io4lm nlfes ()sDtrurpot4tpt if3tys s elnvs;(0alxoxo totfm eau s;s0sruoxrpou4ol nmfetas) 2umurp;o4tee mo3tatlm emnvo;u4areoxrciotfpDrauvs;s)srtm(m oy4ap n fvs t)sDumx ono4tex  o3tytlm ul(ms;t)alxrmf oodopD  ueo s0 etoxr3ou4apt mfvi t)a2um(mpoo4apenmi3iltlm eanvo (4trtomr tydoa rln o;(0 2toxopoy1alt  nctlt artmxr ;o4tpx ioetyt m2ua( p;t0alerxo ta1fa rluvo;t)teto(o3ou1olenmnvta() rumuroou0olt  o3iadlm raumpn(4alxrmo3ootoaDeau ol(0trto(m3no4ameelneta() rta( ono0oet  iciatfs umn o;u)areomfcoa1omteli ilt)texm(rpiydapenlnet t) Dtm(m ;o1alxoioetldfm ra(vp;t0trxrxr iotfmt aieols texo(r3io4ome  fvt t sruaxr ;u4apenmocils m2ranvo t4alenif3tytlp  an i ()s2umxr3oo4al elncia(  Dtau  ou1tpt  i3ias m raumo u4trxoxf3tatfa rlues;(0texmim3io1ll   fcsls  2rrxmp;u1tee if3tasfs2ra(vpnt4 ltnmoctadlatr i o t)srumiopiudopeemfct ( s2rr(moot1oet mietysfm eau pnt)teerxrcto1fmD aieil(0srtmimpoo4alee fvia(faDum(ront0tpe  ietldla emuvpnu0artnxr3iodoaDr i slt t2xmxo nu4ol nlnvs t aruaurooo1olxn oeiydfa2em( pnt0aeeomfciytfatelueo;t) 2umxr iu1omt  nctasfaDrmxr oo4texomf3tyd mDeauvont0tetnxo3to1fmtelivi;()truo(mpoydalt mnei () 2raum ;t4oet ifciysla umums;()tetomr3oo1lpt lueols0t2xoxm oy4aptnlnvtls)sDta(monu1tex  ieildfa umu s;t4 rxomfctodfm e n i s)s2tmxr3iu4omtn ivias)aDrr(m nu4tet iociasls um(vs t0 lerxfciatfa rauvi;(0setoir no1lm e fetatfa2taxmp;o4tle mfetltlm em(vp;()tltrmoctodfa elnei s tetmirpou1am elnvsas  Drrumooo4openif3tlsfa ea(mo;u4tlxomrctadoatrlneo;s setoim3iy4alt mivilt) 2tm( o;t1altnmiciydls um(vp;u4 lxoifcto1oaD  i i;t0t2xmxm3oudamteliei tfsrua( ono0aetniociys s2rl( s t4 lenmf oa1omtr uvi s)t2tmxrpnudope lnvia(f 2ua( onu1olto ieiltfmDea(vp (4trxnio3oadfpDeauvs (0t2to(mpnodop n ncs t  rtaxroou1opt  ictldfa umu s;u4 eenxo oadoatrlu ol(0 etrir3oo1lpt  feilt)srtm(mo;u4apt  oetadls2emump;u4tlenxrctodfmtraueilt0 rurxo oydlltn nesl(faDumxmooo0tltomi3ilt m2eaums t4 lxnxoctatomt au ol(0teum(r3oo1opt lfctasfsrur( pnt0aleo f3iadfa rm(vont0 eeomf ty1opDraies;(  rxrxopoo4omtnmnci t  2ur( oou4openifciyslsDel(vsnu)trenmr ia1fp  ln o;( texoir no1lpe mnet s) Dtaurpnt1texoiociad a2rlnvp;t0tetoir todlmDr nes;() rtoxr3iy1lmtn fcsas a2tmum oo1apxnii3iltfaDraumo;u) exrxfctadopD lnvo s0 2xrxmpoo1am nlfcs ( arua(  nt4tpx if3iydla2umumon(0tltrxf3iydlp  lneils0 2xmxm3oo4oltelfeiatfs2uru ooo0olt  o3iys aDuaums;(4 rerxf iytop ranvo s  rxoim3iy4oltemfcsat aDraumo;t1oee iociatla2uanvo;(4 eeomr tatlateau s;s0t2um(o nydlmtnmncsl(  rum(mo;t4opt  ocild m ul( pnt0alxrio3oo1oat livs;t)s2xo(o3oo4ameeliesl(faDumxroou1tetn fciadla uanms;t0 lxoio3iatopt au ils)s2tmxo3nudale lfctlsf 2uru p;t4tpto ocildfs uau s (0 renio3ia1lptelivs;t s2tr(m no4amtelfctl()arrmxront0tex ifetldlmDumumsn(4aetnxf3oodlatr i s;() 2tr(o nudomtnlncsa() Dururono0tee iieildfa2rmu sn(4trxnmf io1oatelueo;(0s2trir nydapenlfci t) 2rrxm ;u4opeomoeilt s ul( s (0alerifctotlat an o s0s2uoir oo1op emivsls) rrmx ooo1aetn oeiltlaDua(vo u0aetrmrciadfate nei s)t2tmiopnudomt  neilt  rurxm ;t0tleoioetatfs em(ms t)tleoxfciy1fmDrlivs t  exo(m3ny4al   nvtls)aDtm(rpou1optn o3tltla elumpn() reoxr3oatlatrli s;()seurimpnu1ame lfesasf Dtauro;o0aee iocias a2eauvo;()trtrir tydlmD lueo;t t2tr(opoo4lltemfvtlt sruaur ;t0oleoii3iltla uauvp;t0tltrmf oatoat au o (0tetmimpnodlptnmnvsl( s2uax  ;t0aeen fctydfaDel( on(0 lxomoctotlm  aies;s0 2uoxm iy1apen ivias) rrrxroou1ale mf3ilt s emnvo;t) ltomoctatfaDraivs t0 eurir iy4lpe lies ()aDuau pnu4oeenii3tydfm2uan s t0 lermr3iydoa rlivi;( s2umimpoy1opt lneia()arrax pnu0aleoifciat mDulnvonu0 lxrir3tydomDrliei;t trtr(r oo4lltnmicta( artmxmo;u1tlxo i3ilsls2uaums;t) eenmr3todoaD  ivi;t)srxr(o3oy4ol e net (fsrrau  ot0ope if3iatfa2el( p u0 ltoif3ia1lpD ln o t trxoxr3no1lme  ncs ()srua(r ;u1tee ifcilslsDrmuvo t0aetrxr iotfpD auesls0trur(r ny4lme  nvils aDrrumpnt0oexniociat a2eauvp;t0aexnxrcoytlat  nei;s0s2toim3nodamtnmnvsas) 2um( p;o1tpt  f3ilt s2uaumsn(4aleoif oa1faD  ies;t texo(mpnodol   ietatf Duax pno1olenifeiadlaDemumo;u0alxrxf3iytla  aivolt setmio3iydap e nvt s s2rrum nu0aee iictltlaDuanmp;t)altrmr3iadoaDe i o ()sexrxm3iydlpeemivilt arrax  ot1oleo ietasfaDum(msn() rtoio3tadopt aneo;t)trtoirpnudll   fei tfaruaumonu0tee  fctatfa2eanvo u) rtrxo3iodomDeaivi;(0s2xr(o iy4ll e feiat) 2rr(mo;u0tex  f3iaslm raumo;t)aexnxo ootlpteanei;s)trur(m3oy1lp n fes ( srrau oou1oleomfeiltfmDeau s;u0 renmo iatfatrau o () eumxmpno4opeelfctl(fs2umx pot1tpe iociltla eluvs u) leoxr oadfptranvo;t  2xmxopiu4lptnlfei (  Dtr(monu1alen fciad aDuaums;t0 rtnmf3iotoatraivo s)s2xr(rpou1amt mfvtatfsrraumo;t1tlxomoeiatfaDem( s t0 eermfciadop  anes ()s2xmxm oo1al emnct t aDrrumpnt1oexnmociasfm ulnvsnt4trtoif3totfm elivi t0tetmiopoy4openlnvsl( s2umumono4tptoifeiysfs raumo;u)teeomrciodoat  uvilt sexrxm io1omenmnctls s2ur(  nu4aleomfciysfa ea(mon(0teerxo to1fp rauvs ()s2tmirpno1om emncilsf 2tm(rpnu1opeo oeiydfs2emnvo t0aetrifctatlate uvo;()s2trirpio1lptn ictlt)srumx o;u0oeen i3ildlmDua( p;t0 lenmoctadlatrlnvsls)t2ur(r3iudlpe mies tfaruaxro;t1alen i3iydfs2rlu pnt0tltrxr oytopt aueo;s0 rtrxr3ou4lle  fesl(faDum(moou1opeomietys s rmnvp;(4 lxoxf oodlatrln o t srxmimpiy1lpen ieia()artrxrpot4oetnifetldfsDrm(mp;u)arxoiocia1lptraivo ()srumiopnudom elfet s srur(  oo4apx iociydlsDra(vsnu0tltnmfciatfateaivols srxmxm3iy4amenlfei tfaDumumo;t0opx ifctltfs ea(ms;()aetnirciy1fpte i i () 2xm(opiu4ll  lnvs s sruax o;o0open oeiytfs rmu snu4aexrif ta1lpte i s;s  ruoimpnu1lpeelfvilsfsrraxr ot0opeomo3iyd sDrau s;u)aexrif3iadlaDrlueolt texr(r oy1ome mivi t)a2trxrpno0oet ioeiydfaDeau pnu4 lerif ty1fmD lnvolt s2urxo nu4apt lfvs (farrrx  ot0opeomfeiadfs rmu p;t)texomf3tatopD ln o;s t2xrio io4olen ncta(fs2ur(m ot4opxn icildfmDea(mp;(4 eenir iatoatrau i s0 rtm(o3oy1alt  nvs tfsrtrxrooo4optoioetydlm ulnms t4aeenmocoy1laD ln ol(0 2ur(mpny1ape mietatf rrmxm ;u1tlen o3iatla ua(mo t0 etnio oytfaDelu olt)setmim no1ap emfes s srumxm ;t4tee  ieiyd m2rluvp;(0 rxomocoy1oaDe u i;t  eumio no1ol   feil()sDrr( ono0ape io3iytlm rmuvsnu4aexnxo iotlp e ivi (  2xrir io1lmenmfvils) 2tmxrooo0tpeo fctlsfm2ul( p;t)tetniocootlmtelivi (  2tmxr3oodlme lnes ( s2taumpoo0opt  fciltlaDrm( s u)trtoif3iodfp rluvols) eurxo no1am nmietlt aDum( p;u4texomi3iysfs ulnvs;t4tleoxfcootop r u o t trurxmpnu1omtnlieil() rtmxm ot0opxomoetlsfa umumsnt4alerxo3iodlaD auesls0s2xrirpoo4oleemncs s)arrrx pnu4aeeoifctls s ua(vp;(4tlxnirctytlmtrlu s () 2um(r3oodal   fet t a2trx ooo4opx iieild mDumnvp t4aetoxr3ta1opt  nvo s)teum(rpou4amte fvt ()s2rax pno4tptnioetad m eluvo t0altnir iydlaDrlu slt0trtoxr3io4amtnlict (fsDuru onu1opeo o3ias s2um(vs u0trtnmfctytopDrlueils) exoir nudlme lfctat)sDum(  ;u0teeomoctad a el(vp t0arxoircoy1fa   u i ( t2umxr3nu1lltelieils  Dtauronu0tptomo3iydfa2ua(ms;t4texnif oatfa raiesls0t2xr(m iu1lpe  ncilt)s2tr(rp;u4alt iictyslm rauvsn()trxoxrcty1lmDeluvo;s)t2tmim3oy1lm e fci ()arra(m ot0oleo ictld a2eln s t0alenir3oy1lptr n i;( texoio nodlp  lnes ()sDrrxr ;u0aeto ictytfm rmnvp u4 eenmociotoa raies;(0t2uriopiy4oleelnvslsfsDtax p;u0oexomociltfaDuanmonu4aetnxr3oytom  livi;s0 2to(o nu1ll   nvtatf rur(rooo0apenioeilslm2ra(vp t)arxnifcoatoaDean ol(0trxoxrpnu1lltemieia() ruax p;u1tee ifeilsla ranvp;(4 leoxf3oatfp e nvs;(0sexmxrpno4lmtelivtls a2rrx pot4tptoiociyd sDua(vs;(0 lermo tatfp  auvol(0 2urim3nydal n nct tfsDuax oot1opeo i3iyd m emuvpnt0texoif3oa1lp rai sls)setrio nu1omtnmneslsfsrtaxroou0optn ieiatla ea(vp;t4 lxnmf3tytfm rlivs;(0 2um(o3iu4am nlici () 2umxmoot0ole  o3tat m2uaumo;t)trerif ty1fatraivils seum(m ny4lmeelnvt () 2urx  no1oex  ieiltfaDel( p;(4 lxrmo3ootoa  li i;t)setr(rpoodoptnmicslt) 2uau  nt4tpt  iciadlm ulu o u4trtrxoctytlmD  nvs;(0truoim nu4om  lnesas)arta(rpot0tpe mf3tldfm ran pnu4arenmo iydfmD aueslt setrxr io4am elieils)s2ur(rp;u1opeo feiaslsDrluvp u4tetrir3tytfpDrluei t)tetoio3oo4llt  fes (farraur nt1oet mieiatfm elnvsnu0 ltrio iotfpD  ivo t)tetr(opiu4omenlfvsat) rua(root0tltn ociatfaDel( o;(0trenxf3ty1lmD  iei;( teurxo io4lp  lfvtlsfa2uaurpot0tpt iiciadla2elnvpnt) rxomr oodom eliei ()seuoxo3io4altn nesas a2rmxrpnu1texo iciysfa2raumonu4trxrmo oodlmteauvil(0 eumxr iodalen fcsas)s2rr(rono4tetnmi3iyt m2ra( o;t)trermrctodfpDrlues;(0tetrxo ou4aptelieilsf rurur ot1aptn ietat m el(mp;t) exrmocto1la  an s s) rtm(opoo4al n fet ()s2rmx pot4aexomfeilt sDuanvp () rxrmr oo1fpD luvi;()t2urim iu4oltn ies (  ruru onu0tltomf3ias a2ra(msnt0 ltomf3oatlp ean o t0t2umim iu1lle  ictltf 2ua( o;t1apenioeiatfm emnvo t4alxnxfcoadop ean i;s)tetoxm3ny1am nmfviat)aDua(rpou0altnif3iys sDul( onu4arxnif oydlaDranvils0setrimpnu4am  livsasfsDtau pnt0ope io3tldfm2em(mp u4 eeoxf iodlp   i s ( s2xrxopny1al elnciatf rrrx  no4oeto i3ild m2ul(vo;(0 exnmfcoatlm   u o;t srtrio3oo1op elneslsfa2rr( o;u1apxomiciyslmDuln p;u0 etnir3ty1lmD lieo;(  eumim3oo4lm e ivta( srrr(rpnt0oltn f3tad m2rl(mo;u) leoxfcoy1oa r n sl()s2xo(r3nu4om elnci (fs2ta(mpou1tleo oeiytfmDua(mp () reoxocto1op  lnvs;t seto(r3ou4ale mictlt)aDuru p;u4oeeniietadlmDraumo (4arermo3iy1fateau s s setrim3iodomt lfesl(fsrumxro;o1aexomfeiltlaDrlu snt)areriocoodfaDrln i () euoiopoy4olen net s s2raur ;t4optn o3ilslm2uan onu)aeerxrcia1omD auesls0sruo(o oy1lm nlncta(fartrur ;o1tpxoioctytla2emn onu0trtnmrctadfate neo (  2xmirpoodomtn ivt tfs2tr(rp;t4tlt  i3ils aDrmn ont) leoxociy1fmtraiei ( t2toxmpoy4am  lncil(fsrumumpot0aleoifetlt sDuanmp u)tlxoxo iatfmDelues;(0 exoio3oudlpen ieias)a2tm(  ;u1aptn fciysfm rm(von(4 eeoirciatoatrli sl()teuoxmpny4om  mncil()srtr(r nt1tpt  f3ilsfmDemu pnt)trxrxf3iadlmteluvi;t)s2umxmpno1oltnlnetlt artru p;o1opxoifetls sDrlumsnu0tltnxrcootlm eauvi ( tetm(m3oy1lp e neia( a2urur ;o0tpe mictadlaDel(vs t)tlxoxf3tatlm rlneol( t2urxr3oudoptnlfvs t)aDta(  ;u4aeto i3iyt sDemnmon(4alenxocoytfp  an sl(0s2umxm oydaptn feia(  2tau pnt4aeto i3ilt a ea( s;()aexomf todlateluvslt0 rtmxm3nu1lpe lfvtat  ruax ooo4apxn i3iys sDrl(mpn(0 exrmr oa1laD ln o;t0trxrxo3iydol eliciltfa2tr(  ;u4oexnmi3iad s2rm( p;(4arxoif3tytfa eau o t)teum(mpiydlptelict t)s2tm(moou4teeoifctys s rl(mont4tltrmocoo1fp r n s;()s2xoxr3io1omt  ncslsfsruru o;o0texnmfciadla rmn s;t4tetomocty1fat  n o s trurir ou1lmt livtls a2tr( ono0alto i3tltfa2uluvont) ltomocty1lpDr ivi (0t2trxmpnu1op  miesl() rrax o;u4tltnmietydls2eln o u) lenir3iodlp eaues;() rxo(o oo4ll  liesls a2tau  ;o4aexn ictatfsDrauvpn(0arenxf oydfm r neslt  2xoxrpou1omenmicils) 2ta(  ;t4ale mf3tlsfaDemump;(0 rtoirciadfp eaneilt  2toim3oy4optnliciat  Drm( ooo4oetomi3ils m umnms;u4 ltnmfcty1faD  nvo;t0 2tmxopny4amen icsa(f rtruront1opxniociytls2rmnvont0altoiocta1latrlu s;(0trxmirpoy4olt  fvsls)srraxmont0tet moeiytfaDeaump;t)artrmfcty1lmDeau s ()trtrxr iu1ap elnetasf rumx pnt4olxomf3iat aDra(mo;(0 eerirciodom  aneilt0 etrxopnudal elnesat arur(rooo0tlx if3iasfs emnvs u4arermr3to1lpDe ivo;( srxrim3iy4aptnmfvs t srtax ont4opx io3iadfs uluvo (4 etoxf3oydfpDrau ilt0s2xo(r3oo1ame mfet (f Dtrur nt4oexnioeiat s2eauvsnt4 renmrcoa1fptrlu s;t  eumim oy1openmfvsls  Dta(r ;u0aet mictldfm2em(mo u0aexoxr3iadoaDraneols0trxmxr3oo1ale lieias  Dtaumpnu0aexomo3iyt m2ea(vonu0 lenmfciydlpteaueilt0tetr(rpio4lmen iviltfs2taxro;t4oexnifeiltlsDea(vpn(4tltnio3oytlaDeln ils)teumiopoy4lm nlfeia( a2tmxmono4alxo iciltlm2em(ms;t4aleoxf3to1op r i o t0t2uoxm3ny1lleemics t)s2ra(m oo4olxniicild a2elnvon()altrmr3tadom  lueils  rtrirpoodll   ieslsfarum(  ;o4oetn ietytlmDem( o t4tltnxr oatlp  lieo;t)s2xrxo io4amtelfct t  2ta(r nt1oltoioctls m2elump t)arenir oytfmDeln i;t  eurimpno1lptemfvs ()aDumxm nu4aet  icils a2rluvs u) rtnmf3tytlptrai s t)s2trxopoy1lptnmneias) 2tmur oo1tetomo3iasfa2rlnvsnu)aeeoiocoydopD li i s)t2to(r3iy4altemncta()aDtrur ;u4olto fctytlm emnmpn(4trenxo iatlmD aivsl(0setoio oy4amen nct (f Dur(  ot1oltnioctlsla emumon(0 ltnmr iy1opDrlues s)srtrirpny1lm  lfvs t) 2urur ot0oexoif3tys aDumumsn()texrxr3oa1latelieo;s  2toxr oo4lptnlfesas)a2ra(mp;o1tex mfcilsla eluvs t0artniocoy1la   ivslt s2toxo iy4altnlietltfaDra(ro;u0tex ifciytfaDrmn ont4areoxr3ia1fmDrli ol( t2xm(r io4lpt mfctlsfaruau poo4apto ieild a2ulump;u)arxnifciy1laDeluvil(0 exmxm3oodome  fct s arra( pno1tltnifeiyt m2ul( s;t0alerifcoodla   nvi;s0srtmxo oodop  mfvilt)s2ur(rp;o0aeeo ictlsfm eau o;t)alerxf ta1lateauvs s0s2urirpnu4llee ict s sDta(m ou1tle mf3iydfm2rlumsn()aetoxo tydfmDelueil( setmio3oy4lpeelnct (f Drr(r ou1tptoifciltla emu onu0 lenifcoy1oa r ivo t0seurim3io1ape licsl()s2umx onu4texn oeiatlm2eau p u)arxnif3tatop rlies;s tetm(o3iudomenlnvt ()sDtmxmpno0texniieiydla ran s;t0trtnxfcoatfa ranes;s) rxmirpiu1am n ncsat)s2taurpou1aexomi3iadlm2rauvp (0trtoxr iydlaDeau sls)sexm(o3iodol  lncsas)a2trxrpnt0texnmoeiasfs ua(vp;()tetoir3totlat aivi t  etm(o iy1om emfes t)srumx  no4olenmociatla2el(vsnu)trxrif3oo1fpDrlieo s)s2xmxm3no1lleemnctlt) Dumu  ;t1tpxo fcildfmDuaump;t)teerxo iydfpDeli i t0 etr(o iudalt livsas)artrxmooo0tex moetyt s2ra(vonu0aexomf3tydfpte nvi ( setoio ny4lpt miesatfsrur(r no4aexnmf3tas s2emumsn(0alermr tydoaD  nvi ()s2tmxo3nu4lmeelfci tfsDrmxronu0opxoiictyt m2em( o;t)arxoxr3oodlaDraneolt s2urim nudapee nvi tfsDuaurp;t0tee iociytls2eaump;t4alxomo3oytfa eau slt  rtm(opoy1lpee nvs sfs2ua( pnt4tex  fctlsfs2rm( p t) lxnmf3ia1omDe nei;(  exmxm3no4openlfeias)arrr( o;u0ole  octltla2rluvsn(0aleoir tytoaDelueols trtrxm3io1lltnmfet s s2umx pot4tet io3iyslm2umn s;t4altoir3oodomte neilt) 2xmir oo1ome  ivsatfarua(root1opxoif3iyd s2rlnms (4alxnio tatfmtraneolt0 2xm(r3oy1omenmfvi tfsrua(mooo0oeeo feilsla em( onu4arxomr3oydfm raiei () rurxrpio4op nlfci sf 2rrumonu4teeoio3iat m2um(monu0altoif io1lpDrluvs t  rurimpiu1al elici s  rumumpot0optn feiltlsDulu p u4 eenmf tatfptrluvi;t) rxoxm3ou4lm emnciasfartaurp;u4tle  o3tldla2umumpnu0aeenxo3oo1fmtrlies;()t2uoxm ou1opte fvtatfarur(mpno4apt mfciasfs2uanmsn()aexoir3iy1op e nvi t  euoir oydamee fviat) 2ta(ro;t4aee mfeiatfs ranvs () ltoxf3io1optrli sls)trxo(rpou4op  lfei ()sDurump;o0apt iictld m eln p () lxoxf oydfmD ai olt srxo(o nu1al emnvsas  rtrur ;u1oltnioetltlmDrm(vsnu4texrir totfpDraieilt0s2tr(opny4amt lfcsl() Drm(mono1optomf3iyt s2umuvo;t0trxnxf3iodomte neils0t2ur(o no4ap e ieta(fs2urxrpnu0tlt  octyslm2rl( p (4trtoir3iadfat  n s;(0texrio3iy1ol  mfviat  2tm(m ot4aeeniocils a2el( o t4 exoio iy1fmDrlivol(  2tm(r3iu1alte feil(f rtrur ou0olxnioctat mDulnvs u)trtoxf oy1la  aiei;s) rxmxm ny1amt  ictl(fa2tm( p;u0olt  i3iatfs eau on(0aeeomf totop rluvi t)s2to(mpoo1ome micsatfa2rr(m oo1aexnioeilt m2ulu s ()texrmfcia1late u o;s)tetrxm3ny1lpen ivsltf Dtmxrpnu4olen f3tas s2elu s u4alxrif3ootfmD livo;t0trtm(r oo1alenlncs (f 2rmum no4alt ifeilsfsDuluvpnt0 reoio oatlpD auvi;t)teuoio3nodll elieslt a2rmxr ;o4altomiciadfs eauvp;u4tlxrmf3oytfaDeanvs t tetmxopou1om e ncsl(fs2trur oo1alt moeiydfs2ulnms;()aeermf3todfpt lneols t2umimpou4ame miesls aDuaxmo;t1olx ifetldfa2ul(monu)arxomr tydlm eluvo (0tetrxm ny4al  lfvs ( artaxrp;t0opxomf3tyd mDul(mo u)tltrxr oytoatrli i;( seumio3nu1lm nmnesl( srrmx p;t0oet ii3iasfa emuvpn(4arxnmo3iodfmtrlu ils t2tmimpio1ol emicia() 2tm( oou4olxomoeils a ulump;(4trxrxrcoatla   u slt0 rxmim3io4am nlivtat arrrx pnu1tex iictas s ranms u) renmociy1lm rln o;s0 2urxrpnu4aleemnvsa( sDtax oou1aexnio3tydls2ean p (4altnif iatfmteli i ( teto(r iydlp  micsa()aDrm(monu4oet mieils sDrmuvo;t4tetomf3totopte ivi;t0 exo(m3nydlmt mnvtat artrur nu0oetomf3ils m2ra(vp u0trxomocio1fa r uvilt trtmio oydlptemnes t) rurx pnu1aexo fciasfs rmnvp;(4 rerir3oadfpt aueo ()s2tmxm3oudopenmnetas)sDtmum nu4alenmoctasfsDulu p u4 rtnmo3iodla eli o ( t2trirpoudlptnlivs sfs2rrxm ;o4tptoifeiaslsDum( o;u4aeenxo tytoa e ivs ( srtr(r ou1ope mneiatfarumxrpot0alxn o3iytfm2eanvpnt0 etnmrciydlatr ivo;s sruo(rpoodol nlfvil(fs2rmu ooo1alto fciytls uln s;t4teeoxocoadoa r nei;(0 euoimpoy1ope  fcsasf 2rmx p;o4tle mo3iaslmDeaump t0aeeoio tydfa eaueo s srxoxopnodlmtemiesat) rumuroou1tpeomf3iyt s rm(monu)teerif3oodlp eai il(0trxmxopiudlmte fct tfarrrxrp;u0tpxo ociatfmDumn snu4 etoio3io1lmDe nes;t0 rxm(r oodomtemiesas  Durumoou0aetomictld sDuau s (4treoif oytfa raueslt0s2trxrpoy4lpenmncs sfsDtau  no1alxomiciltfm emuvo t)tlxnxf3tytomt anvils0 rxrxopiy4optn fvsas)artaurpnu0tpeoii3iad m2eau o t0 exnxo oytlpD  uvsls)t2xrir3iudlm nlnvt t  2taur nu4opx mfctadfaDean p ()tetoifctodopt lnvils0s2ur(r3io1oltnmfcs t a2trumoou0apx iictld aDrl(vo u)altoxf3tydfm  auvi;t0seuo(o3ou4alt mfvt () 2umuro;o1opxniiciasfs rmnvp t) ltnmoctadlm   ueo;( t2xrxrpno4ape lfcsls s2urur no1teeoifeiadfmDrmnmo u4aetoxf3iodfpDrlneo;(  etrio iodll   nvsa( sDrm(mo;u4openifetys m2emn onu4 rxomocoo1optelueilt0 exrir oy1lmteliet sfs2uau ono4opt  iciltls2umnvp;t4aexnio3iytlatean i;s)teuo(o iu1olenmnesas sDta( p;t0opxnmietys m ran o;(4 eeomr to1fmtrlnvi t)trxm(mpiodolt mivsa(  rtaxm ;t1tpe mietadfa2uanvp (4aleomfctatlpt  ivs s0srtrxo3iodol n iet s  Draurooo0tpxn o3tyslmDrlnmo;u0areoio oatopte ivol(0 2xmir oy4amtelnei s aDtaumo;u1altnmf3ilsla rlump;u0artnio3io1oa e uvslt)t2umxm ny1am e ies t)aDtrxmooo1tpt iietat s rln s u4 leoxf totla r i i;() rurim3oudlmt mieiasf 2urxr nt0oeen fctytfmDrlnmont0aeeomrcto1fpt  ivs;s)tetrxrpoy1ome mnvils aDrrxmp;u1apxnmf3tatla2ua(mon()arerxr3oadoaDrlnvols)s2ur(o oy1al nmfetl(fsDrmum no0opeomoeildfmDrl(vp;()arxnxf io1optelueo (  rtoxo iudlmt mfvsas)s2umur nt0olxo i3iys s uau p;t)aeeoir ootlaDr ivi s)setmim3nydlmtemivs t)srurxm ;o1opto ieilt mDumu o t4tetnxr totlmtraieols) exmxopnu1opee iei t)aDrrx  ou0ape mocilt s2rmn s;()arermr oodopteaivo;t0 rxrxo ou1al emfcsa()sDrm( oou1aee iieiydls ua(vp;(0tltnifcoadoa  aivs (0teuoxo3oudale  iet s) rtmxr no0tet  o3ilsfs emums t0areoir iytfatelu s;s0 rumimpoydlmenmfci t  rtr( pot0ope mieiydfsDem( p;(0aexoio3iotfmt ln il(0trxr(o3ou1al elnvia()a2rm(r ;u1olenmf3tadfa2em( ont) exnmo iodfpDr neslt) 2xmim ou1olee fvi ()srua(ront4tpt mo3tydls2rlu snt0 rtrmrciy1lmDeauei;t0sruo(o iy1apeelfvsat sDuaxmpou4apxnifciatfs2ran onu0 etrmr iytlmt  ies t)srtm(o nydom  mfcta() 2urxr ;t0aetnmocias m2rm(vp t0alerxr3iotomD lieo;(  etoxrpiodlpte ivtas  Dua(  ;u1oexo oeias m2em( p;t4tlxnif3oydfm eaiei t0s2uoim oudamte icilt sDtr(r nt4apt  ietlt mDea(vs;u)altnmfcoodlmDe i ils)setmxr3oodopt mnesl()sDtmx o;t0tltn octysfsDemnmsnu0aetrio todlaD  ueo (0t2uoxmpiy4ap e neiat)sDumurpno0oeen ictas mDrlums u)teenir to1lmte nvol()trtm(rpoodam  lnvia() Draxmo;t0oee io3iltla2rlnmp;() eermocoatlate nes s0sexoxm oo4ap n ncslt sDuax pot1oetnmo3tld aDranvo t)tleoio3oo1oa eauvi;t  2tmxopoo4al n ici s arrr(mont4open feild mDuanvs u0 ltrxr ty1fmt anei;(0 rtoir3nydope lnvi sf 2raxrp;o4opeoii3iad sDuan snt)trxoxo iatlp r ies t0tetm(opiu1lpe  iciatf 2tmuroot0aexoifctydla ul(msn() reomrcio1op   i ol(0t2toxr oydop   icia(  Drmurpnu4oltomicilsls2umu s;(4artnio3oatlptran o t t2xm(m3iudlmtnmfvt ( aDuax pnt1oleniiciysfsDrmnmpn(0aeeomr3oa1faD lnvi;s0tetoim nudame mnvsl()srrr(r oo1alxomoetas m2um(vp;t4tleoxf3tytomDe uvol( tetrxr oo1ole lfcsa(f Dua( onu4oeeoio3iadlm rm(vsn(0 exrxo iatlp eaivi (  ruo(r3oodap  mnctlt srua(moot4teen oeiysfs2el(vo ()teeoifcoy1lmtrlu o ( teurxo iydol n ivias artrxr ;u1tpx mictyt s emn s;u4teeoxr tatlptrlnvs t0 rxmxm nodllt  ieslsfs2trx  no1apt mi3ilsfsDeau p;u)aetnmr3iodomDrlivi t0 rxoio3nu4ap elfeta( srrmur oo0oltn i3tas sDuan s;u)aexrif iy1oa   uei (  eurio3nodomenlictls)artmx ono0tlt  ietldla2uluvs;t)trxnir3ia1oa ran il( srxr(m no4lpe livias s2urxmo;o0alt mf3iltfa2emu s t0teerxf tydomtelivol()trumim3oodoltnmnvslt)arrmuronu1ope mfeiltlm ra(mo u)tlerif3totfp rlivi t0 rxoxm3iy1llt mfcil( a2tr(rp;u0aee mictltls2emu s (0 rxrxoctotop r u o;s0seum(o ou1amt lfvsa( srua(r nt0tlen feiltfaDranvsn()trxomf3tydlateliei;t  rurim3iodope  ici tfaDuau  ;t4olxnio3tadfmDuauvont0 rerxr oatopteaieilt tetr(o oo4ope micsl(f 2tm( pnt1ape mfcilsfm rm(mp;t0tlerxo oydfpDraueilt t2trxm iy4lp nmnvi s) Drmu onu1opt iiciltls2umnvp (0altrmrcoo1omD ai ol() rtmxo io1ll elncilt)a2uax oou4opeomfeilslaDulnvont4 etnxf3tatfm eaieo t)t2tmxr ny1op  livtls)arta( p;t0alxomociydls rln sn(4 ltnxf iotop  aiesls0 rumxmpio4oleemfet tf rtauronu4tee ifetaslm el(monu4aexrmr3tydfaD  neols0trxrxr3iu1al e fesl(f rrax ono1tpt  fctatlm uauvo t4 ltrxoctadla elivi;() rumio3no1al e fvi (f Drmxrpou0tee mf3ilsls2ea( pnu4alenmf3oa1lptr uvi s0srxoxr iy1lle lfct t)arur(mpno1ape mf3iadfs elu on(4artoxrciydoatrlneolt0 exm(r oo4ap nlicta(faDtmxmpno1alx  ieiytls2uau p u0trtnircoy1lm rli ilt)texo(m oo4al n neilt) rrm( pno0alx moeiat s rmuvp t0 eeriocio1fmt lu i;s0t2uo(r oy1alt lncs s) 2um(r ou4oetniietydfsDum(vpnt4treomf totoa   nvsls)t2uoiopoodopt lfeia( s2rrxr no0texoiociasfsDeluvo;()tlxnmoctytoat  uvsls)trxo(opoudlpee icils)srrrx pot1apx  ietydfa2ra( s u4aeeoio todoat anvs t) etmxm iy1llenmnvt t)arrmx o;t0olx iictytfs uluvsnu)artrmr3oodopte u i;( t2uoxmpny4al  lncias arua(m ;o4oeto octas mDem(mp;() etnxr tatopteluesl(  rtoxo3oodlmtnmieiltfsDum(mp;t1tptn o3tatfa rau p (4arxoxo iotom   nvo;s texr(o oy4ame mneslsfsDumu pot1tlxomfciltfa2rluvon(0arenif totfatranesls)srxrxo3ny1ame lictlsf Drmx  ;o0tetn fciadls rmuvs;t4tetrxf3ootopt  ivi;t t2xoxo nodal  lfvs tfartr(moot0tpt mo3iltfs rm(vsn()altoifcoo1omDrli il(0texoxo3io4lmenmfvs tfa2rmum nt0aet ifctld aDrlu sn(4aeeoif to1lmteaivilt)seumim io1llen nct tf rtmum ;u4tlt ii3iadfm umnmo t0texrxo3io1op e nvs (0 rurxo iodopeelneiasf Drm(mpnt1tlx  i3iat mDulu o;t)tltrxrciodoa raieils0truoxr oo4openlnctltfsDuaxmono4tetomictadlsDul(vonu4 exoxf3oytfmtr n o;s0texrxrpio1ap n ivilt)a2trx  nu4tlxnmociadfsDemu on(0 lxrifcia1fptraivi;s s2xmiopiu4alt  nes s)a2tax poo1olt iociltfaDum(mp u)trtrxo3oadfatranvil(  2uoxo oudole  icilt a2ururonu0aexnmicils s2rmu ont0 reoir ty1fpDr nvi;t) exm(opny1ol emfvi (  rrm( pot0oee ii3tyslsDeanvon(0 lxoir oa1opDrlnvi;s0t2uoiopny4ol  lietl(faDumu onu0opt  i3ils s ea( p u0arenifctatoat aivs;s teurxr3nydll emncs sfsDurxmpot0oeeomoeiltlaDemumo t4treomo oadom ran i;t0s2xm(m iy1ll e nviatfarta(rooo4tlx  ietytlm2um(mo;u4arenir oy1oaD  nvo;t tetoim3iydaptnmnvta(fs2taurooo1aeto o3ils aDrlnvo t) ltoifcoodom r ivo t) exoim3nodomtnmfes s)s2raxront4alen fcilt m2rlu pnt)areomr3ta1opDraivsls)t2xrxo oo4openmictlt  2rm(r ;o4tet mo3iatls uln onu)tleniocio1fa  lnvi;t0srxrxm oo4ap emfcsls s2rrxr oo0texomoeiysls2rmuvsn(4aeeoir3todlaDe ivo;() etmxrpiy4opt mivs s  Dta(r ot4aet ioetld mDra( pnt) etrxr oydoaD luvi s s2uoio iudolt  ivta(f 2ur( o;t0tpeo i3ilsfsDemnvont4trtrio totfp  lnei s0trxmio iu4ol elnvsa( a2rrx pot1tet  oeiasfmDra(mo u) exnirciytfpD liesl() 2urio iu1ap   ivtlt) rurxrp;t0aetnio3tasla2el( s t0 rxoif3iy1la e n il() exrxo oo1lp nmfvi s) 2rr( p;u1tlen feiasls2uaump ()tleomf3ta1op   n i;( s2ur(o oydlmte fciltfaDtm(mpnu1apx ii3iasfaDumnvs;u) lxnir3tytoaD ln slt0seto(m nu4amtn nciatf rrr( pou4tlt mocias s2umuvp;(4trtoxfciy1fateluvo;t  rumxo3oy1lmt mfctat aDurx onu0tee mieiadlm uluvp;u)alxomociytoa eluvi (0texoirpiodam  licsls)a2ta(r oo0altnmicias m2el(von()alenmf oodopDeanei;s)s2xriopnodoltnmfvi t  rumxm ;u1opxoii3iatlaDel( p () rtoirctotlm eaivs;t) rur(m iu4lm nlfetl()sDua(  nu0tltomoctyt aDuln s u)trenio oatfmDr ies;( trtmio ou4opteliciasfarur(mp;t4opxn f3iadla ranvp;()aleomo oy1omtean olt  rtmio3io4olte ies tfsDrr(rooo0aexnioetys m ra(vsnt4artomrciadomtrlu s s0seuoxopiy4amtemies ()arraum no4ape  ieiyd mDulu o (0texoioctytoateluvo t sexrxr3oodapt mncil(fs2urxr oo0alxnmo3tys a2um( onu)tltoxocta1omteanvs (0srxrxr3iodll   icils)srraxrp;o1tlenmfeiysfm ea(vs t4tlxrir3iadlp  luvs;(0 2toxo3iy1ll nlfci s) Dtr( poo4opto ociat m2rln on(4 etnxr oadlaD anvs;t0 2umxm oy1lm  mnvtltfa2rmum no4tltomf3iys a2elnvsn(0alxoxr iy1faDrli i t  exr(opio4om elfviat  Drrxmpnu0tlxomoctlt sDrm( s;u4 exnxoctydfmtraueo;t srtmxo ny4lltelivs ( a2raxmp;o4aeeniieiadlsDea(vsnt4 rtoxrcoatoat  ivi;s setm(o iudlptemfvsl() 2rax  ;o0oleo oeiltfm2emnvp;() leoif oadfm elies;s s2umiopoo4amtn fvi ( aDrmu  nt4alx  oetlt a2ulumsnt4arxoifcootfaD ai s;t trumxm oydapteliesatfsrtaxmp;o0tleoio3tyt s2emnmpn(0tlxrio io1opt  u ols)setrim no1lpee ics t sDtrurono4alxo i3tldfs2rlnvo;(4altoxo iytfmte n i (0 rtoimpiydlpe lncs s)arrm(ro;o1alxoio3tls a umnmp;t0tltoif3oatomDeanvo;s) exrxmpoo4al n feias arrrum oo0oleo iciyt a2rmnvp;t0artoxrctatfmDraueolt0sruo(mpiydamt  fcsas)srurxr nt4oet mictls sDrln p;()tleomr3to1laDeli o;t0seur(m3iodal e fetatf Dtr(r ;u1opeomo3iys sDea(vp;u) ltrxf3todlptr ivs () rtmxopoudamtemnetl(  Durxroou0ape  fetadfa el(vs t) lxomfcoatfmtrauvslt0 exmio oudaptemnetls) 2ta(  nt4tlxnmfetat mDea(mo u4artrxfcoa1oa r ieo s t2xoim iu4ap   ictasfs2taur no4opx  fctasls raumo ()alxomf totfpt  ueo;t teur(m ny4lmenlfctlt  2umxmpno0tpeoiieiat a rm( s;u4teerio oydlpteaivo t)sruo(r3oo1llt lnvias)s2rru  nt4alto oeiat s rlumpnu) eermf3oadfpDeli s;s0s2xmio oudap e icta(  Dra(ro;t0tee ii3iyt a umuvp;t0artrxfctatlm elues t texm(r3no1altemivsls  rtau ont0aexniietlslmDrl( p u0 ltnxr iytlm ean ol()setoir nu1alt  ietl( s2tm(mpno0oetoif3iasla uau snt4artnxociatoateli olt trurxo iu4amt  nvil() Duax ooo0aeen ietaslsDemn on(4tltoxf ia1fpt  nvsl( srtoxr3nydlmee feiat) Dtrx p;u1apx mfciyt m uaump (4arxnmo3oy1opt  n o s seurim nu4apt lies sfsDtaump;o1tetomf3ilsfa rauvs t0altnio iy1lpt livo;t  2xmxo3iudaltnlncsasfs2urxroot4apxn i3ias a umuvs;()teermociydlm  an ils0seurxm oydamenlict s)a2trx p;o4apxo fcildfaDeanvpnu4altrmf iydfaDrauvs;s) 2tm(m3io1op n fvtls arra(r ;o4apen feiad sDrm(mp t0alxrir tydfm e ivils  2uoir3iodapt lfvtas) Dtrurp;o1aeeoifeild s2rmn o;t4arerio iadom   n s t)seuo(m3oo4om  lfvt s)artr(  ;t0texomiciys s umump;(0aeeomrcootomt lues t0 2xrio nu1apenmivsl() 2tmuronu1aeenmi3tys s emnmo t)teeoxfcio1laDeaueslt)t2toirpiy4ap n nct s s2rrum ou4tpx  oetatla2ea(mo u)arxrmfciy1laDrlivi;t seuoxmpiy4lpte icta()a2ua(rp;o4tee ioeiys aDem(mp (4arxrmo3ootop  livs;()s2uoio no1ap nmivtls a2rr(rpou0texnioetysfm ea( snu)aexomrcta1opDrlieo (0s2uoxmpiy1lpeelici s  Dtrxmonu0ape  i3iltla2emuvo u4trxnxo3ta1fm   neil()setrir iydamtelfvsl() rumu  ;u0tlenmo3tlslaDrln on(0 reoxf oy1latelieilt) 2uoxopoy1ol  mnvtlt  2uaurpnu4olen f3tydlsDuln p;()alxomr totoaDeliesl()trtr(r3no1op nmncil()artax  ou1oeen fciysfa emu on(4 lenif3todfp eanei (0srtr(rpoo1amtnmnvi t a2ta(r nu4aet ioeildlm2ua( s (0teenxo3to1lmte ieo;s srxoim nudam nlncias a2tmxro;o0texnii3tyslmDra( s;u4tleoxociatop r ueolt)t2xoir iy1lp  licsas  2umu o;o0ole ii3iyd s ul(vpn(0teerircoytopt aueilt0trxm(o nodop n ictltfsDrrxrp;t4tpenmietls a2eln p;u) rerxocoo1fmDr n i;( trxrim oy1ap nmfvs ()srrmu p;o0apenmoeiyslsDuau s t)aexrxr3oydfmD aueo s)trxmxrpnu4ameelncslsfsDtm( pou4tpto octytla2uaump (4teenxr3todlpD li olt)s2toim3ou1altn fvsl(fs2umu  oo0opt  ieiyt mDeanms;u0tetomf iatfmDe nei;(  2xr(o ny4amt  ivtlt s2rrum ou1apx iieiyd s2umn p (4aeenir oydoaDelivslt0trxrxm oy4ope lfctatf rtmu p;o1oee  feias mDem( p;t)arxoifciatlmtelu i;s)setriopou4lltnmivsat) 2rrxmpot1alt  fetys m uanvp () lxrio iatfmD aueol()tetm(o iodllt mnetls  2rmxmont1olxomf3tatla ulump u4tlxomfcto1fp rau o t tetr(m nudal   fcsltfsDur(r nt0oleoiieiysfaDua(vo;u0aexnir to1fmteli s (  2tm(o iu4ameemncslsf rumxmpnt4aee ifeiasfa ea(vp;t4 reomrcoadomDraivi t  2xrxo3ou4alenlfvs ()artrumooo0teeniieiys sDrmumo u0aexoir3iydfa rlneo;t)s2xrxr3oudoptnmiviltfarraxro;t1tlt mietydlaDel(msn(4trtoxociodlaD anvils) 2toxo ny1llte ivi sfsDrax  oo0aetomfctad aDeanmp;t) rxoio3oadfmt lu i (0 rurxopnu4al n ici sfs2rm(mooo4aexnmo3iyt s2ranvonu4 etnxr3ta1fmDeaiei;t t2uo(o nu1aptnlfei sf 2tmx onu0alen feias a eau p;u)teenir oydoptr u s;t0 exm(o ny1openmnei t) Dtaurpnu0oleo ocildlm2ul( p;()texrmr oydoaDe ivol() euoxm nu4lmen icsls)aDurxmo;t1opxnmieiysla eluvo u4teeniocoa1laD aiei ()srtr(r3io1aptn nvsas s2rmumo;t4oexniicias mDuau s u)treoiocta1laD aiesls sexoio iy4lpenlnctls  rra(ront0tltnifctldfm2umumpn(4tlxoxf3oatfm  ln olt) 2xo(mpou1ll emfcils sruau pnt4teeo oeiltfa rauvp;t4 reoircoodfmDelnvol()s2urxm3iodll  mnciltfsDtaump;t0tlxnmietldla ran on(0altnir3tatfmDean il( srxmir nydame lneiatfa2uru o;t0oeenifeiasla2elnvonu0tetrxf3ia1fm ranes;t)srxo(m oydope  fesa( sDtmu oot1tpeo ieiytfsDem(vsn(4 lenir io1op eli s t srtmxm3oo1om e iet ( a2tr(mpnu4oexomocilsfmDua( p;t)aeerxfcoo1oa rlnvilt sexo(opny1olenmivtlsfsDrmuro;t0tlto i3iys a2rm(mp;(4 ltrmr to1lmteai s ( t2toxrpoy4ll  lnvi ( a2umxr ot0tpx  icilslaDrl( p;t)arxoio3iytfp rln i () 2urio3io4am  lfcilt) 2ra( ont1opeo fetlt a ra(mont)trtrxrcoo1opt  u i s)teto(opou1lpen fcsl()s2rmuro;o0oleo i3tlsfm2el(mo ()teenxocoo1lpt auei s0setrim3iu4am n iesls aDuaxr nu0oeeoiiciysfaDrauvs;(0alermr oy1la  livslt)teto(r3ou1amee iesas)a2tmxront0aet ifctyd a ea(vs;(0arenxo tatomD auei;t0t2xm(o3io4aleelnei t)aDtr( onu1apeo o3tydfm ulump;t4alxnxr3iadlaDrlu s s texr(m3oy1altn fvt t  2ra( onu1aeeo oeils sDelump;(0alxrxf ia1la   ieilt)t2um(r3ou4am nmictasfs2uaumpot1olxnmo3tldfs2el(vs (0aetrmrcto1op  ai ilt0trxm(opoydom   iesltf Drr(r ;u0ape ioeiyt mDeaump () etrxf tytomD  uvs;s0tetoiopiu4ape  fvta()s2umxm nt0olxomi3iat mDrl(mpn(4aeerif ootfm e u o t)s2tmxrpno4alee ivtlsf rtaumpnt4apxniictydfs umuvonu)aeeoxocoa1la e u o;s seumxopiydll  mneils a2urumoot0olxnmi3iydls2rm( on(4trxnif3ty1oaDrauvols trxrir oy1omtnlncsas a2umumpnt1aexomictltfm ea(vo;(0 etrio3tydfmD livo;(0trxoim3oo4lm emfctl(fs2ta( o;t0tltnii3iat s rl(msnu) leoxocoydfatr n slt teto(r io1llenlictltfarrr(rpoo0oexomf3ilsfs em(vo t4 exoxr3io1lm  an s t0seurxopio4oleemnvtltfs2raxmpoo1tleomociyslaDemu pnt0 exnxr3iadlp eln s;s0s2tr(o3nu1lm nmfvsasfa2urx  ou0oee  o3iyslsDraumont)aetnxfciy1lm raueo;(0srxoxmpou1amtelivi t srtrxr ot4oetn ictatfa2em(vo;t0 rxnxo3iodfp  aneo s0 2urir3oodoptnlnvs sf 2tm(moou0texnmfciasla rlu ont0 lxrxrcty1fa rai s;t)seuoxopiy1ll emivsas arrr(mooo1aetomo3iytla2ranmpnt) exrir3iytlm ranes (0srxr(o3iu1lptn ics ( a2taurpnu0tlxnmocils aDrmu o u) exnxr3iotoatr n i;s0teuoir3nu1lp  mivil()aDtmxmpot0olx  i3iytlaDrlumsnt0tlxoxrcia1opteluvols  rtoir3no4oleemfcsa()s2ta( pou4oltnii3iytfsDua(mo;u4arxrir oadlm elivi;(0tetmim3ou1om e ies tf Dumx onu1aexoiieildls2el( p (0teeomo io1fm eauvs () rxmio iudaleemnvsa() 
\ No newline at end of file
@@ -0,0 +1 @@
+ueslt)trxr(r no1op emfcils s2uaumonu4tpxnio3iyt aDuaumo;u4trxnxr tadlmt lies;(0trxrxm nu1omenmiei (faDtrxmoou4optniieiad a2um( snu0trxoif3todfaD  uvi;t0setrxrpno4om elnet () Dtr(r ou4oleomfctatfmDrau ont0tetoioctytfpteaiei t0 etr(o3iy4lpt lfesat  rtaxm ot1opto i3tadlm2el( o;t4 lxrxr iytfaD auei s0s2uo(rpiudolt  nvsls  2rmumpoo4tpeo ictldfsDrmn s u)artoxr3iatopD  uesls  2tr(mpnydlmtnmiviat)s2ur( pnu0tex  o3iasfm uan pnt4texrmo3oydoat livilt)srxrir3io4apt  fcsat)aDrax onu4oltnmociasfsDum( o;() rtnmociytomt au ol(0 exo(r3no1ope  ies t  Dtmu pnu1tpxomfcildfa eln snt4teenxf iytoa ranvi;t srtrir no4al nlfeiasf rrax  nu0apxomiciydfa2umuvp t0 lerifcoadfat anvsls0tetr(o ou1lpeemietls  rrm(r nu1olt  oeiatfs emnvp ()teenmfciytlptraueol() eumxm3oydole lneslt srrrumono4tlenif3tldfs2rlnmpnu4tlxrmrctydomDe uvs;() etrim nodam nmivs t)srumu oot0tpx iociytla rau s u)trtoxo iotop eluesl() ruo(r ou1ol nlnvt ()a2ur(rpot4tpeo fciatfsDrln o;t4 ltomr ia1oa rluvol(0truoiopiy1lpen fvtls a2urx pno1oltnmieiytfs eanmon()aleoxr to1lmt auei t texm(o3nydamtnlncsasf rraumpnu4oexn oeiadls um( onu0altnir oa1fatrlnei;t0seurirpio4olte nvi (fs2um(mp;u1apen o3tad s2rau ont4trtoif3ia1lpteaivs ( trxoimpou4al   ictlt)a2taxm ou1oexomfciadlmDrlnms;()altnio iotfptr neilt) rxoimpio1llee fci s  2tm(rpot1tlxnmo3iltfm2el(mpnu0trxrircta1laDr u i (0 exoxo iydll  licil()sDuax pnu0tltn i3tydfm rm(vp;t)trxoxr tadoa rluvi;(0trtrxmpny1ol emivtl(f 2truront0tlt mfeiatlm2rmnmo;(0arenxrcoodomDranvolt)s2to(o3ou1lmeelivslsf Dtm(rpot0tlenmo3ildls elnvsnu0aeerxo3iadfaD  nes;t)srumxopiodale mivi ()s2rmxr nu4oee iicild s el(ms u0teeoio3iotop eauesl()t2urxrpiy4alt mieilt  rum(  nu1alenmiciatfm emn onu)aetnmr3tydoa rauvols)trxrimpoo4ome  ivta() rrax ont0oex mfeiltfa2ul(mpn(0tetnmoctadfpt  uvo s t2to(m3ou1ale mfesls arta(  ;t4teenmo3ils a2eau p;() rtnir oodlpDe ivi s)t2tm(r3iy1aleemnciatf Dtax p;t0alen f3tasfaDrmnmo;u) rermo iadlmDran o;(  2trxrpou4lm e icta(  2tmxro;t4openiiciadla2uauvsnt0 lerxo3ia1fatrauesls0s2tmim iodopenmnvt t  rtr( oou1oexniociysfsDuanmon() rtrmf iytomD luvs;(0trtrir3no1ale  ivil( s2ur(rpot1alxomo3iaslmDem( o u0 exrxrctodfm   n s;s) eur(r3io1ll  lfeils)sDtmx o;u1alenmiciadfa2rm(vp (4alermf ia1fmtrlnvolt  2xmxmpou4ome  ici ()aDua(mpoo0tetnifciat a2ul(vs (0tlxrmfciodla rlieils)t2xmxmpoo4ap  mfetat  Dtm(  ;o0aexnmf3ilsfsDean s;u) rxnxo3iydfat liei s0trur(m nudlm  lnvta() 2ra(rp;t4oleomfeiatls2elu s;t) etoif3oadfpD an olt)trxmxo3oydopenlfvtlt) rua( p;o1tpt mfciytlm2uanvo;u0trxnio3iotoaDeauvo;(  eurxm3no1lpenmnetls)aDraumo;t1aet  o3tatfaDemuvs () renxrcio1fptrlnvo s t2urio3oy1omee nvias a2umxrpou4tpx iocias mDrm( s () exomf iadom rln s ()s2trim3oy1amee fvslsf Dumxr ;t4aexnmietas m em( p;t4 exnircootom rln ilt0s2urim3iu1lpeemnciasf Dtr(r ;t0olt io3ild m2em(msnt0aetoio io1lm r nvi;(0 ruoiopoy1om  lfvsasfarraxr ou4aex io3iatls2emumsn(0 ltnxr oy1lm rlu s (  rtr(rpny1optnlnvsa(fs2tru ont4altoifciysfsDulnmpn()aleoxo ia1op r ieo;s sexrio io4aptn ncs s  rrau oou0oeeomoetat mDuanmpnu0trxnmr iadfp   nei t0 2toim iy1am nlfcia()s2ra(mpno0aeeo i3iad a emn p;t)alermr3io1la   ivils0 exm(opiydalt lfeiat)srtruro;u4aeeomo3iytlsDul(mpnu4tlxrir todlp  lnvo () 2umxopny4lptnlncs s)srua(m no1optomo3iat mDuanvo u4tleoifcty1omtrai o;(0t2trxmpiydamee fvias)sDtrx ooo4tet ioeildfs eaump (4arxoxo tadopt luvilt)tetoio nudlm emivtas)arurx  ;u0oleomfeiasfsDulu onu) eenir3oatlpDe uei;s0setrxo iu1lmee nei t a2rmu  ;t1alxnio3ils s2emuvsnu4 etomo totlm rluvo ()trur(m no1lle mfeiltfs2tau pot1apeomiciltlaDrm(ms;t4trerif3iy1lmtrlues;(  exoim iydlptemnvsas) Dtrxroot1optniietyt sDra(vo t4trxrxo3todfpD lnvi;s)srtmirpoudame mnvs t) Drm(rp;u4opxo fciys a2eln p;(0 rerxrcootopteanvsls0sexr(mpnodapte nvt s) 2tr(moot4oex  feias m2rmnvs (4teenif iotfateai s (0srxr(opnudlleelfvias artr(  oo0tlto ictysls2uan pnu) lermr3tydlpteai o t0 rxm(mpiydlp elfvsa(fsrtmur ;t0oee mfcildfmDrl(vo ()tlxnmr iodlp eai ilt)trurir oo4lmtelfvs () rua(root0aex moetadfm eanvp u4trerxf3tydlp e ieslt0 rurio3ny1lmenmfeslt)s2rax onu4ale moeiys m rl( pnt0 rtomr3iatfpte neil()s2tmio3io4lme mivia( s2tm(ronu1alt  f3iltlaDulums u)aexnxf3todfat liesl(0 2umxopno1lltnmneil( a2urxm ot0tlt  o3tysla raumo;u0arxnifciotlm raueo;t t2xm(m3oudlm  lfesltfs2truronu1ape mfctydla uauvsn(0aleoxo3oodlmDr i ol(0texrim3nydopt  ietlt)arum(r no4opeoioeilslm ran pn(4 rtnif3oy1fpt anes s t2tmxo oudlptnlfetltfartrxm ;t0apxoii3tasls rlnvonu4alxnio3oadfmDrlivilt teurim oy4alt mivi ( aDurx pot1olxo ieiadfs2eln s t4teerir3oodla  aivs;s sruoxm3iu1al   fvsl(  rrrx ont4teto iciysfmDrlnmp;t4 lerif3io1lmte uvolt0sexoirpiu4lme livtltf Dtrump;o1aee  ieils m elu pn(0 exnmocoydlp eliei;( srxmimpoy1oltemictlt)aDrmur no0tleo ieiytla2rlnvo;t0 eerifctodfpDe i slt texmim3iu4ol emfvta(f rumu p;t0aet  ociydfa emnvs (0 rtoxf3tytoa raieo ()t2tm(rpoudom n fcsatfsDtmx ooo0oetn i3tasla2elumonu0 etoxr3oo1faDranvi;t)srurxo3iodll nlfvta()a2rr(r ot4oexoifeiytfm2rl(mpnt4trxnxociadoa  lueils)setoxopno4lpt lneiatf Drmump;u1tetn feiyd a2rlnvsnt0 eenmrciydoatrlivi;s0srtmirpnu4openlfvs ()sDum(rooo0oex mieiadla uaums;(0trxrio iy1oa eaivil( t2toxr ny4om emnvt tfa2umur nu4tlt mfcias sDrlu pnu4artnmfcoytlpte nvs;t0texo(opoo1ap emicil(fartrx ono4tltoii3tyslaDum(mo;t) etoir oodlaDe uei;s trxr(r3no4ale mies (  2tr(r ot4tle moeiytfaDean o ()arxoircoydfa r nvo () ruoxo oydlme mnctatfa2rax oou0olen fcildla rm( o;()texrio3oytoaDrauvs;t0srtmxo3no4lpeemnvi ( srurxmooo1tee mo3iytlm ra( s;(4areoxr ta1op r iei t0srto(opoy4oltnmivtasfsDrrumooo0alt ifciyd a emuvp (0 eeomo3iytla r uesl(0trxm(o3oudaptnlivsasf Draurp;o1tee iiciltls ra( onu0tlxrxo totom   i s;s srumir3oo4ol   ncslt)s2trxmp;o0aetoifeiltls2ua( p;u0trxrir ty1fmDe i i s0t2xrirpiudll  mnct () rua(m nu0tle iociyd a uau s (0 leoir oo1lp rliesls0trtoxm iudal nmfeil(f rtrurp;t4apxomoetldlmDuau p u)aetnmr ta1omtr ivol()texoxm3ny4lpee ncils srururooo1apeniocildfsDel(mpnt0tltnxr tadlmte nes;s sruoxm nodal   ici (f Drax  ou1alenmf3ild aDea(vp;(0tlxnio oadlmD  ueol(0 rtmxmpiu4lp n fet t  2tru pou0oetn f3tysfs2elnvsnu0artoxrciodlpteanvils  rum(mpoy1ame  fciltfarta(  nt0ope mfctad sDranvonu4trtrio3iytla eluvi s) rtr(o3iydomt lneta( sDtmum nt0opxnifctldfm2el(msn(0 etoxo iydlmte ueil() rtm(r ou4apt mieiat)s2rm(r oo1apxoif3iysla ulumsnt)aetnirctatoaDeaneslt)t2to(m iu1olte nei s)srrmx  no0olx mfeiydfmDum(ms u)aeenmo to1om   uvil(0 rumxrpou4lltemivil(f rtrum ;u0olx mi3iad aDumn s;u)tleoio3tytfaDelnvs t  exoxm oy1ameemfetat)a2ra(m ;o1aptnmo3tlt m2uanvs t0trxomr oytfp elivs;t0 2uo(m3nydll n ivs tfaDrm(  ;t1tpxnio3ilsla em(mp (0artoxr3iytopte i o;t s2urxr3oy4ol nlictat  Dua(mo;o0teeoifeildlm elnvs ()aexrmo3todfate uesls)teumxm oodol  mfvil()aDrrxm ;o4tle ioctld a2eln p;t4tltnmfcty1fmtranes s0teumxr oudlp emictls)srtaur ;u4oeenioetasfs2rlnvonu4trenxf3tytlpD  nvs (0seuoirpiy4aptelfvia()aruaumpnt4tlen ietyt m2rlnmpnu0 eeoxrcta1fatraivs t)seuoxr nu4ape licil()artrxroot0aeeoifetldla2el( s t0artoifcia1oa   uvi;( texoxo3no4olenlivilsfs2rr(root4alxo oeilsfm ulu on(0arxrxocootfpD aueols)truriopnu1aptn nesat s2rauroot0tlt ioetldlmDulumpn(0alxrxr3oo1lp eluvslt) etm(opiy4opeemfcs s a2tmxmono0oltoioeild s2umumont) renmo3ty1oatr ivils)s2tmio3nydlm n nvi tfa2rm( o;u4altoiiciydfm2ua( o;(4aeenmo tatfptr i i;s)trxo(r3io1lp  mieta() 2tauront1apxomietatls2uln snu0arxomoctodopteln s t  etoiopoudlmee ivtlt)s2rrxrpnu4opxnmieiatls2em(vs;u4altrxr3iadlmtelivsls  exoxo3oy4am e nctltfa2uaur nu4alenioetyd mDua(mon()arenxf tatfp  luvilt  2xrir iy1amtemicsas) Dua(  ;o4aee  o3tysfmDranmo t0 exnir oo1faDrlnesl()s2umio iu1llen fvs tfaDrmx  ;t0opeoifeiadfmDuanvo;t)alxomfcoytomte ieil()trxrim ou1amt mfcta()aDtax  oo1ope  o3iatlsDrln onu0texnxfctytlmtrauei s  euoimpoy4alt  fci ()a2tau oot0opxnmf3iad a elu s;t)trermf iotoatraivi;t  2trirpoydopte ieias  2tr(rpot4oetomo3ild a rmnvsn(4artnmrciydopD lueslt) exmxr nydalee ics tf 2tr( o;u0alt  feiysfs ranmpnt4 etoif ty1oaDraieo t teuo(o3oodap  lnetls  2ra(mpou0ole ii3iad a uluvp t)altoio3oy1opt anes (0 rxmim3nydapenmivtls s2raurpnu1ope mocilsfaDuauvs;t4 rtnif oo1omD au o;(0 rum(r3oo4lmee ivilt aDta(mono4olx mietatfm uaumon(4trenio3iydopDr i ilt s2xo(o no4ll n ieias a2rm( ooo4aeeo i3tysfmDranvs;u) etoio3tatfmDr uvs;t0t2toim oo1op   netasfs2trx p;t4tpeo fctldlm2eln ont4tlenmr3oydfa rlues;s)setr(r io4am   nvtltf rtmum nt4opt ii3ils a2ea( o t4texrir iytlm rluvi;s) eumim iy4lp e nvslt)arumx  ou4tlx ii3iatlsDem(mpnt)altrmr iydomDraiesls) eurxm ny1ll   ivia( aruau p;u1tle  oeiaslm rmuvs;(0 rerircto1fmt lneolt sexo(o3nodol   fcs (faDrm(mpnu1teenii3tadls2ea( o;()trxrxo iodlatr nvsls teuo(mpoudol emfvt tfs2trx  ;u0tet ifeiadfs2ea( p t4arenxf ta1oaDe nei;s trxmxmpiudlpen fei t)artmuro;u0opx mictad s2elnvs;(0arxnmocta1fateau olt0seuo(r iu1amenlnesatfsDtau ono0ape if3iltla2ean o;u) ltomf3oatfm  anvs;s0seumxopio1ap elncsasfs2ur(m ;t4alxnifeiasfsDrlnvo ()tetrxo3iy1oa  lnvo;()t2xmim3no4ap  lnetasfsrumxr nu4tptomi3iasfa umnmp;t) rtrmo ta1om  au s (  etr(opnudamee nesl() rrmxrpno1texnmieiyslmDea( s t4 rxriocty1fpD anvi;s t2trxm3oydapt  neilsfs2ua(m nt1aptomietlsla emnvo t)tltnxr3iodfmte uvsl(0t2tm(o nu4aptnmfet t  2umxm ou0opeomi3tlt s rmu o t0 exnmr iydfpDeaiei;() rtr(o nudopenlnes tfs2um(rp;u0oltoioeiad s2rlnvp t) exnio iydlp   uvols trtm(r3ou1amtn ncils)a2raumo;t0olenmf3iadfaDem( sn()trenmf iadlate uvi;()tetmxm ou1lltnmnvslt sDumx  ;t1tlx iieiltls2rmums u)aetnxoctodfpteaivo;(0 2tmxo oo1lpt  feias)s2ta(mpno1alxomicildlmDem( ont4trxomo oo1fat lnvi t0 eumimpny4lpe lfcsa(  2urumpoo1apt mfctysfa2ul(mp;u0trtomfcta1laDrlieo t srxrxr3nu4lle licsa() rrr(  ot0tpxnio3iyd s2el( snu4artoxo3tytopt aueo t sexoxm iu1ll  mfvta(  Dtrxmont4teeomoeiltfmDrm(mo;u4 renmocoydlp rluvolt s2toim nydlmeemfes (  2rmum ;u0aeto ietytfmDeau pn(0alerif to1om r i i (0 2xrir ou1ll e nvtat) 2ra(moou0tpto oetlsla rl( s t0 reomo tatopDeli il() exr(r3io1ll   ici ()srurx  oo4oetnmieiadla2rmumo t4 rxnmo3iydlpDr i ilt0t2to(r3io1altelfvsat srrr(mpno0olxomiciadlmDea( p;t)trtrmr3iydopD  i o s0s2xoio3ny4al nliciatfaDumurp;o0tltnmfciyt aDul( ont4aetrmfciytlm   ies (0s2to(o3ou4lm  mnesatfs2tru  ;o4aeen ieiat m rlnmo t) lxoxfctydomt  nei;s) 2trxrpoodll  lfctat  Dtru pnt4open feiltlmDrmuvpnt0texrxoctadopDrlu i t)trtrxo nodam  mfcsasfsrurxront0oexo ieiaslmDrmu snu0altnmfctatlptr n s s0 rto(r iu4lmte fetas)s2ur(  nu4oltn ociasfmDrmnvs;(4artnmo iadoa eaivilt  rurirpnodalt  fesas)aDua(mpou4tleomfeiadls2rl( sn(4treoxr oodom  aues s) exr(mpio1olenmiei ( a2trurp;o4aexn ociysls umumont4aexnmrcoytfmteanvslt)s2tmir3nudap n ivtas srtrx ooo1opxo o3ilsfs2uln p ()artnir ootlp eanesl(0tetmiopou4amt lnes (fs2tru pno0tleo oeiatfaDul(mp;(0texoir tatfmD li i s)trtmxr iu1ameelnviat a2uaumont0aetnmociad s eanmsnt4 rtnxo3iadfaDelneo t) rtmirpiy1lm n fcsat) Durx onu4tpe mociydfsDra(vpnt) ltrmr3ta1lpD  nvi;t0 etr(r3oo1llenmfesas  Drm(r nu4optnmictas mDemumo ()tlxrxrctadomtr uei;t trtrxo3no4lpte ncs () ruax ont4oexnifeiysfm2umn onu4tetnxr oa1omD  i ilt) rurimpoydomtn neia()aDururo;u0optnifeiatlm ulnvs t0 eeomf iy1lptelu slt  eum(r3oy4ole  feta()aDraumo;u1apxoifetyd m rmu sn(4trtomf3oytfptr n o;t)t2tm(m3oodlle mnctatfsruaur ot1oexnmo3tadlm2ua( pnu0alxoxoctodfa  auvi;t srtmirpou4op n nvilsf Duaumpot1olxnmictlsfsDrlnvo t0alenxr io1lm raneols seuriopio1lme lies t)s2raumo;o0oetniieiad mDrau o;(0artrio3iy1faD  neol( t2tmxr3oodole lnesa(fa2uaur ;o0aetn ocilt s el(ms ()areoxf iodlmDeluei;()s2xrio iydamt lfcilt sDuaxr nu0apx  o3iasfmDemuvsnu) ltomo3tadom ranei;() rxoxo iu4op   ivsltfarrmxr ;t1alx  o3iatlm2uanmp;u4alxrif ta1oat lnes ( t2umir3nodlleemicsa() rum( onu0tet  i3iltlm emu o t4aetrmr oo1latelivils  rto(m ny4lm  lnvtl()srtrxrpno1tex micilsfsDulu o ()tltrmocoodfa eaneolt0 etoir3iydll n ici (farrmur nt4ope iictltfmDranms;() eerxrctotfp eai i;t) exrxo no4altnlfesasfa2uax  ou0ole  i3tys s ua( p;u)trerircoydlpDrai sls trxrxr iodaltnmivtl() Draurpou4openmfctytfm rlu pnt0trermo3to1fpDe u i;t) rurxo oy4op nmivs ( s2tmxmpou4optoio3iadla ul( pn()treomrciydlaD  ies;t  2xmim oudalee iciasfarrrxr ;u0apenmo3iytla rl( sn(4 rxrxrciytfa eauvs t srxrxopny1apeelfctat  Drruroot1texoiiciat s2uauvs;() rtnxfctodoaDeluvi;s)t2tmxmpiy4lpen ict ()sDra(r ;u4oeeo oeilsfm eluvs u)tltomo io1lpDr uei;s0trxr(m iudolt mfcsls)srrau  ;u4tlxo i3tldfaDea( o (4teermr3to1la raivo;t teurxr iodll  mfviasf 2ta( ono0tlx  f3ildls raums t)altrxf ta1lmDr nes ()s2uoim oydlptelfetas srtm(mpno4oeeomfciaslm2uan pnu0 lerif iodlaDrai ils) eur(opoy1amtemnvsl(faruaxrpnt0tpxnioeiysfm2em( pnu0 lerifcoy1lat an s t0 rtoxrpiy1lm nlnes s)a2rmx o;o0aee iociad sDel(mo;u4 renmf3oa1opDrlneolt srumxo iu1altemivia() 2ur( poo0texnifetys s umumo;t)alenir totlp r neo (0tetr(r3no4op e feiltf rta(  nu1opxnmictlsfaDrl(mon(0 etomf3iotomD lies;s0t2xo(r iudop n fcs s) 2trxmoou1ape ifeiad aDrl(vp;()aeerxoctydoaDean il( tetrxm3oodome licsls) 2ua(mp;t4oetomfcias m ean s;t0texrirciy1om  ln s t sexr(opiy4ol elicia()aDrm(  ot0oexnmicias m2uaumonu)tlxrmf totoa rlneslt srum(opoy1altemnetas sDta(m ;u1tex iictasfs rmnmpn(4aeeoir3oa1fp   ivsls) etoio iydlpte nes tfarta( pnu0aetn fciys s2uauvp u) rtomr todoat  nei s t2xmimpoo1lm  livta() Dtr(rpou4optoiictld m umn sn()tlxrio todfmDe nvslt) 2xoxo nu1lpe lnctlt  rtm( oou4tpe mf3tys sDulumo;(4tlxnir3iytop e ueil(0 exmxm io4apenliesat)s2rrx pno1tpxomoeiadfa2umuvo (0teerir to1lm r u i;s0texmxr3iu4al  mietl() 2ur(mo;o4oexomfetadla umuvsnu4areoio3tytfatrau s (0t2ur(o io1lltemietatfsrtmx o;t4opxomfciyt a eaums;t) rtoxo3oa1lptr ivsls truoxrpno1omeelnvi (  Dtrxr oo4aexoiociasfs2eauvo;(4teermo ia1lm rln i;t) rxoimpno1lpt lfes t sDurxrp;o4olto ietls sDulnms t0 renmociodfaDraivs;(0tetoim3oy4optn nvias) rum(  ;u4alxnii3tlsfm2ea(vp;u) rtoifctadfmte i o t) 2tr(r iudlmen fvtas)artmx p;t1tptoif3ilslm2ea(vpn(0treomr tytfpDe nvslt)teur(o iydlltn net (fartmu  ot0tetoii3ils aDra(mont4 rxrxf oa1opDr i slt srto(rpoydll nlnei () rtmx  ;t1oexomoeiyslmDemn pn(4trxrxf iotom e ivslt  2ur(r3nu1ll n neta( a2tmu  ot1alxniiciatlmDuluvp;()tlxnio oo1opDeluvo s  eurirpny1opee feta()aDrr(mpnu1teeo feias a em(vont0tlxoio3tatfpDe ies s trxmxr3ny1lp elfci ()aDtr(  ;o4tpxnmieiytls2em(vsn(0trerxociytlmt anvs t0 eurxr3oo1om emicsat) 2tmxmoot4ape  ietlsfs2rlnmo;(0areoir3oytopte uvi;(0 etrimpoydam elies t)arrmu o;t1oexniictaslsDem( p;t4alerif3iodlpt aneols)trtmio oy1ll  lnct sfs2trx  nt0oex ii3iad aDeln p;u0artoxr3iadfmt au s;t)srtoim oy4lp  lfetls)artru p;o4tptniietadlsDrmu s t0aexomoctatoa ran s (0sexmio iu4optnlnct t arrmxr ;t1aptoii3iyt a eluvp t4artrxociadfaDeln o;s0 rum(opnydomte fetl()sDrrx  oo4oeeniociltlmDelu pn(0teenio tatfpteau i;s0trxo(rpnodom nmncilsf 2urur ot4olen f3tltfa emuvp () reoxrcoadomtrli o ( seuo(rpiodal nmnes s s2tr(m ;o4tpenifciadls uan s;u4aeenmr3oytlm rauvi ( srxrir3oo4olte iei ( arurur oo1tlt mi3ilt mDelnms t0aetnxf3iy1lm   uvi;t) rxoxm no1ame mnct tfa2ua(mpou1tpt iietysfsDul(vp ()tetrxo ta1oate ivol( tetr(r3oodom n fcilt)artrur ot4oet ii3tatlsDum(vs;u0trxoircto1op rln s;s0 rtmxo no4ap nlivs sfaDrmumo;u4alxn ictadlmDrlumon(4tlerir3ia1omtrlivo;()tetr(m iodlmeelnvsl()srraum nu4opeoifeiydlsDeluvo t)aexrxo3oytoa  aieo;s seumimpoodlpenlfvsa(f 2rr( pnu4opeomiciytfa uauvs;()aleoio tytlmteai ol( texmxo3oo4om nmfvi t sDrax pot1tleomfeildfa2ua(mp u4aetrxf tatlmD au olt)texo(o3io1olt mnvsl() Dua(mont0olx mi3iydfa2rm( p;u0aeerio iadomt livsl( t2trxopiu1aptnlicils s2uaur nt0ole mi3iytfmDuaums t0aeenmociatla  au s;t0srxoim nu1lmtnmfci sf 2uru ont0alt  o3iydla emnvs;u4 lxrxr oadla rliei;(  rtmxo oydlmt  feslsfsDraxr oo1opeoio3tls mDelumpnu)aetnio tadomtr u olt)setr(m oydlptemictls)aDuru p;o0tptnmfciatls uanvo;()tleoir ootfaD livi s) eurimpoo1lm   fctlsf rtaxm ou0alxnif3iysla2ranmo;u0 etnmoctydoatelu o;s0texmiopio1ole mfvtltfsDrrxm nu1ape miciad sDemnvon(0artrxr3to1fa  luvo;s0 rtrxmpoo4lpenlneils  Drau oot4opxoii3tadfsDrmnmont0artnifcoy1lp   u o t  2xmxmpnu1lm n neilt) Drrxmpnt1ape  fetydfm el(vo u)tetnxo ta1fm ean sl(0tetoio nudopeemnviat)aDrr(mo;t0oexomietasla2rmu p;(0 ltrxrctadoat  nes;t t2uriopiudal e ieiatfarrrxm oo4opxnifciytlaDul(vo u4 lxnio ta1fmDrluvo (  ruoiopiydlmeemnvtat) Dtrx poo4olx ifctatfm2emnvsnu0trxoir3io1fm rau o t0 
\ No newline at end of file
@@ -0,0 +1 @@
+i s;s0 exm(opny4apen ictl() rrau  nu4oee ii3iysfs rmuvs;u4alxrmr3tatoaDelueil()t2tm(opnudomenlicslt)aruru ono0olt io3tltlsDemump;u4tltnir tytfa rauvilt0t2toimpoudomt  fvsa( aDuaxm oo0olt moeiys a2eanvs u4 lxnmf3iadopte n ol(  2uoim3iy4om  lnet () Dtaxro;u4olxoii3iasls2uau p u0 exnxfcoadfaDrlnvi t)sexr(rpoydamen fciasfsrrru ono1aee mociaslmDrm( s u)trxoxo tytfp  au i;t0texo(m3nudlmeemictat  rtaxrpot0opx  i3iys a eln snu4altoxf3oydfmt  i o;s teuoiopnodam elivt t)sDra( oou4tee  icildfs2eln p u)tlxniocoydlp raivil(0s2xoxmpoy1llenliet (fa2rm( p;t4aexoiieiaslsDrl( o;()tleoxf3oodoaDr ies;s) 2uoxm3iy4lpe mnet t)srtmum no0oexo iciyd sDrm(vo (0tetnifciodfa  lu o t setmxo iodlp nmivsas sruau pnt4ope  fetlslaDelums;()aexomf3oy1lptr n s;s) ruoxmpiodom   nviasfa2ra(rpoo0aptn i3tasfa2ulu p t0 renio3iadfp  luvslt sruo(mpoo4ap  lncilt)sDrmxr nu4aeeomoeiysla2rlump;u)tlenxf oatfa e u i t0seumio3io4op e neia(f rumxr ;u4alenifeildlmDelu snt0 ltrmf3oatoatr ueo;t  rxoio oo1oltn feia(f 2ur(r no0oleomietytls2um(vo (0alerxrcoydomDraivilt0 etoxo ny4alte fet s) rtr(  nt0oee moctldfm elnmpn(4tlxrifciodoateli slt  2xoim3ny4llee nci s) Drmumpot1ape mieild a em(monu0tleomr oadlp  an i s trtm(r3io1om  mfviat)srrmxro;o0tlenii3tld sDumu snt4 rxnmo oadfat  uesl( t2umxmpoo4omeemfesat artm(rpou0texo feiyd a eaumpnt) etomfciadfp r nvs t s2uoxr no4ole lnci t)sDrm(mp;u0oltoioeiys aDranvs;t4alxriocoydop r ieo s truoxo3iy1llenlfvi t)s2rmx p;t0altomieiltfmDrmu onu) eeoxr iatlm e neilt)srtm(m3oo1ol  mnes t s2ra(rpno1oet if3iys m eluvp u0trxnio3tytoa elies s  euo(o3ny4om e nvtat)s2rau pou0aleo ociaslmDea( s;t) etrmo3iatlat livilt trxo(opiodame mfci (f 2tm(ro;o0texnmoeiysls2emu snt0altrxo3oytom e uvi s tetrio oydope mfvias)aDta(m ;t1olx mociadfm emnvp;t) lxnmfctotlpDeaues t s2um(m3ny1optemivtas)srumumo;o0apxomo3tlt sDrmumo;u4trerio to1laDelneols0t2xmirpoodoptemivilsf Dra(  ;t4tltnmi3tadfm2ra(vpnt0 reoir oo1lmDe uvil( s2uoir oudom n ncsasfaDumum ;o4oleomoeiatlsDul(vp u)aeerxrcoadlptrlnvols) etr(mpiydll  lfvi tf rta( poo1tpto octlt mDuan o;(0alxomo3tadfpte ueo ()tetm(m iudaltn nctl( srumurp;t0tetnmictldls ea(mp t0aleomr oytlpteai olt trurxo3ou1amtemivt tf rurx pnu0oeeo o3iat a um( s;u0altnxr3oy1oat luvo;s0teurir3iu4lpe lnetatfs2ra( o;o1tle ioeiatfa rm(vp;()aeerxocoytlp eanvi;()trxrxrpno4altelncsa( sDumu  nu1aetoiieias m ranmp u0 etoir oy1latrauesl(0t2toio3oodlme mivs t) rtrx ono1ale  o3iasfsDrluvp (0 lxoxf3oadoatraieilt0s2xm(r3iydlmt lfct s) 2rr(mpoo0alto ocils a2uaumpnu0arenirciy1oaDr uvsl( teur(m3ny4omee fvias)arur( oot0alx mf3ias a2umu pn(0 rxomrcio1lm raies;s) ruo(rpnu4olenlfvtlt)arum(mono0teeomf3iasls2emnmonu0texnmo oytlpDeaues;t) rtoim3iydllte ict s)arraxmp;t4apxnmoctyd a uanvp;(4tlxrxr3tydfmtrlieo;s) 2urio3oy1llt  ici () ruru o;o4apx moeilsfm2ran s;t0aeeomrcto1fp elu s ()seumim3iy1ap nliesas  Duaur nt4apeomo3iadls ea( p (0 exrmrcia1omt lues;t0seumxopiodolenmncsa( arrrumooo0apxnmociad aDra(mo;(0 rermr iadfmDeli s s0 euriopny4lmtnmnetas  Dtr(mpoo1aptomi3ildfs ran p;(4 lxnxocio1oaDelieols0 2urim iydal  mncta()arrr(r nt4ole  o3iyt s ra( p;t)arxrxf3oatoatr ieo;(0trtoxo oydole  feilt aDrm(r oo4texnmfetyd s2rluvp u0tlenmr totfptr uei ()s2xrio ny1alen icil(faDrm(r ;t4tpxomf3ildls el(vsnt)tltoio3ty1fpD au sls0 rxrxm ou1lm n nes tf ruaumoou1tlx miciltlsDuaums u0 eenxfcoytlmtranvsls0sexmiopio1oltemicil( srurx pno1oet ii3iysfa2umnvon()tetnircoydlm eln s;s  rumio3nodopenlict ( a2rm(mont1altnifeiasls rmnvp;(0texnmfcoo1fat ln il(0t2tr(o ou4am e ivsls a2tmu  nu4tlxn oetlt mDrmnvo;u0aeeoio oy1fmDrlieslt0s2triopnudopt  fct (fs2ua( p;u4teeo fcilsls elnmo t0alermr3oy1op r uvs;()s2uoir3oy1om   nvsat s2umurp;o1aet mi3tasla2eau s;t4tltrmfcia1om ranvo t0s2to(r iu1al nlivtasfs2urum ;u0tetnmi3iltlaDrlnvs t4 etrif tytopDe ivo ()t2um(m3ny1opt lfct ()s2umxrpoo0aee mf3tytfa2emnmonu)texoxr3to1op elu o s0srtoxrpio4llt  icilt sDua(mpnt0oetnio3iyd s2ua(mp (4texrirctytla eaivil( srxrxopnodole  nvsa() rtmuroot4tpt ifetltfsDul(vs () ltnirctadomt aues s  rxm(mpny1ale mivi tfaDurur oo1oet mo3iltls2um( o (4 rxnxrctotlm  aieols0sexrxr3iudap nmivs () 2trxm nu0aeenmo3iys aDem(mo;(0aeeoifciatla r nei t  ruo(o ou1ol e ivsls)aDtrxro;o4aptoiieilt sDul( snu4aetrxr3tadlaDrlneo;s0setoxmpiy4lltn net t srtr(ro;u0tleomfciyslm2rm( o;t) eenmfcia1oat  i ol( t2trxrpny1ame mfei s) Drruroot0altnmietydla ul( on()tetoir oydfatelnvo s0teuoim oo1omt lics t sDrmx  ot0tpt io3iasfm2rm( o;u0tetomocoatlp r n o;s0setriopou1llte nvt ()arur(rp;o0opx mociyd sDea(vont0alxoir3tydfmt lnvs;s trto(mpoudaltn neias)srur(  no0oleo i3iyt mDem(msnu) ltomrciodoaDrlieo;(0s2uoir oudll nlfct t srua(r ou0alxomictydfa2ul(mpnt0texnxo io1lm  aivi (0tetm(rpiu1olt mnct s aDuax p;u1ale mo3iytlsDrl( s u4aetoxr3oydfm eln sl( s2tr(opoy4lpe micsl()srurx  nt4tle iicils aDuauvp (0 lxomf3oydlptrlivilt0srtmxo ny4lp  lncils  rua( ooo4tet mi3tatfs ra(vs;u4teerxr iadfp eluvi;t  rur(rpoydlle lneiat) 2rrx  ;t1aeeoifetydla2rmu pnt0texrio3iytla  auei;t0srxo(rpoy1lpee fci (faDrmxrpno4optoiietlslsDum(vp;t)teeoxocoadop  anvsl()t2trim3io1om e nvt (faDtmx  nu4olxoioeiaslsDulnvo;t0teermf oa1lmt luvslt)trxm(o iodlmeelictlt sDtm(m ;t4alxomieild sDran s (4tlenxfctodop eauei;s)srxrir iu1ol  mfctat s2umxront4tle  fctltlm2um(vo t)tlerxr3tydlat aieo (  rtmxm3iodlm   nvslt  2tr(roou4aetomicias aDul(mp t4aeenxo to1lp r uei (  rxo(rpiy4omtn nvt s  rua(mo;t4tpenmicilsfm2ra(vp t0 reoxocoodlate i sls0srtm(m3iy1llenmivsltfarum(r ;u4apxn ieiydls2uau s u4 lenxrcoa1oaD lu ilt  exr(m iodamenmfeslsfaDur(ront1tlen o3iasfmDumnmo;u4aetoxf ta1fpD liei;s0seuo(m nodlmenlivtas) rtaum ;t4ale ioeiatfsDrl(ms;t)altrxfctydlmDeai ol() 2urir3nu4apt licil( a2rmum oo4tpeo iciltfsDelnvp;t0 rermf oytlpt  u i;( t2trim3ny4apeelivsas)artrxmpnt4aeen o3iyt a uau s (0tltnxociotopt lneil() eum(rpnu4lp nlneslsfa2tmx ont0alxomfetyd sDua(monu)alxoio iy1lpDeai s s t2xr(opiu1alt lncsls) Drauroot0tlxn f3iatfa2ean s t)aeeoio iadop r n il(0 rurir3no4lmtn fctasf 2tm(ro;t1ale mfetatfmDumnmp;(0aleomo3oo1oat  i o t trxrxm iudlmt lfeiatfartaxmo;u0oexo ieiadls2rluvp u0aleriocoadoptean s () rumio3io4am emici ()sDtaurp;u4tetomoctltls2ea( s;(4texnmrciy1fa e neslt0s2xoxo3ou4lptnmfvt t arrrxroou4aeeomfeiadfsDua(vpnu0tlerxr io1fptr uvil(0seuoim oydlle livslt  Drmu ooo0texnio3tydlaDrl( s;t)arxnio oa1om elu o t)s2trxopiodalt lnes t a2uax  no4tpe  ictad a rmuvpnt) exrio ty1fp  auvi (  etoxo3ny4am n iei (f 2ra( oot1opto o3ildls rmn s t4 rerxoctydfpDeaivilt0 2xmxmpio1ap   net ()sDur(mp;o4alxn f3tlsfsDel( o;t4altrxf tadoatr n i;t s2xr(o ou1lm emivs () Dtrxrpnt0ape  iciaslm rmnvp;(4 lxnifcto1lm r uvols0 rtrio ou1ape  neias)a2trur ;t1optoifctldfa2umn o;t)altrmfcoy1om   i slt0 rumxrpny1apte iesatfsDurxmpot0oetniietldlsDrlnvsnt4tltnif3todoa rluvi t)teumxr nu4ome mictasfaDur( p;t0oetnio3tlslmDel( ont4alenmo iotla eluei t)s2xrxo io4lm nmivsat)s2tru  nu0ape mf3iydla ran s u)treoxrctadfpDr u i (0teuoimpiu4lp  liei sfarrmu poo4olxoii3ilsfmDraumsnt)trtoir iy1fpt an i;t  eur(m oodamee fcs s srurum ;u0opxomictas m2elu o u0arxrmo io1faDeaueo;t  2xoxr3oo4opte ics s)aDrau ont4apt iietld s2elu ont4teerio oytopDeaues (0t2xo(opou4lmtn netl(  Dtaxmpot0oeeoioeiadla2emuvs;u4trenmfciatlmDr ues;(0srxrirpny1lpeemfetltf 2tm( onu0apto ietatfaDrmnvon(0 leoxr3oydfmDeluvs s0t2umir nu1lpenmfesasfa2tau ono4oleoio3tltls ua(ms;t)teenxrciatlpDe u i;s)t2umirpoydope lfes ()sDtmxront4ole mf3iaslaDemnmont0 renxfctatlm raueolt  rxriopno4opt mnvi s s2trumo;u0tleo ietadfsDea(vo t) eerir3ty1oa  anvol()tetmxrpno4aptnlfeias aDraxm nu0aetomoeias a rmump;(0texomr3todlpt ln ils)srxoxmpiu1ll   ncilsfa2rmxro;t1olt  ociytlm2elnvo;() ltnxf tydfpDelnvo ()srumxmpiudape  fctls sDtmum no0optnmoctldlaDel(vp t4 rtrxo ootfm  livslt s2uoir3nydomenlnes s)srraxro;t1alenif3tyd s emnvp t)tlerif3oy1opt  i ols0trtmim3iodal nmici t sDrm( oot1aet  ieiat a eaums u4 ltrxo3tadfmD  ies;s  2uoimpoo1lp nmici ()artr(ronu0tpx mo3iydfsDemumo t) ltoifcty1lm  livslt t2toxr3nudap emivta( srrmxront4tlxn fcildfs2em(vp;t)tleoio iatoate i il(0 etr(mpoodap e nctas  Duaxr no1tpxoifeiytla umn pn(0 ltrxf3iy1lmD  ueo;t)sexmxmpiydoltemncsasfaDtr(  ot0tetnii3iydfm2rm(vo (4 etomr3ia1la  aies t) 2trir nu1lm nlfetl(f rrmxmp;t4aexnmf3iasls em( o;t4arerircoa1oa ranvil(0 2xmim iu4lme  icsl() rtmumpnu0aet  iciys mDua(ms;(0tetrir oydoaD lnei;t0sexo(r oo4omtnlnct sfa2urumo;t0tpt mictasfsDum( s t4 lermf3oy1la   ivs t) exrio3no1lpeemivilt)aDurur ot4oeeniociydfsDemu snt)aetomf3ty1faD ln s;t)srum(opno4lpeemieta() Dta(r ;t0oeto o3ilsfm um(mon(0altrmoctatlmt luvsl( s2xrim3iodopenlfvslsf 2ta( p;o4aeto i3tlslm rm(msn(4trxomociatlaD ai slt sexoxmpiydop n fcsl(fartm(m ;t0apt  ociysfsDulnmo t)trxrxr tadfp   ivolt teuoxrpny1ope micsat)srrrxmp;t4oeeoio3tytfa2em( o (4arxrxrciodoa rlu s ( teur(m iudame  iesat sruaxmp;o0tex ioeildls umn ont0tlenxf3iydlpDelueols) euoxr3ny1lpeemnei s  rrmurpoo4alenio3iaslaDra(vpnu0 renxo ta1la e u o t t2uoxm3no1olenlfviat  rrrx o;t0oetoiietat m ul(vpn(4alenxrcootfm r n sl(0trxmim oydom  mncils)srtrur nu4apxnmo3tls m2raums;(0teenir3iodlm rliesl()srtrxr oy1am   fesat  2ta( ono4oltn i3iytls2rlnvp;u)aexrmr3to1fat auvs;t0 2xm(r ny1lpt lfei t) Drrxr ;u0tet mociadfaDrlu snt) lxoircty1omDr u olt  rxr(mpio4op emncsas)s2rm( poo4opxo icilsfs2em(vont4aeeoxf tadfatr iesl() eumxm nudlp n fvia()artaxmo;o4teenif3iytlsDrmuvp;t0trtnxo3iytomt  uvsl( t2xrxrpoo1llt  ieia( a2urx p;t0tle io3ils aDumnmo;() ltomr3iy1omtr ueo;(0teuo(opiu4ope  nesltfsrtr(m ou1tpx io3tasfsDrmn snt0tetoxf3iadomtr neils) rxr(mpno4lmtemncs sfsDumurpou0aeenmfeildlm2eluvp;(4alermo3iytfp eaies t t2trxrpoo1lme lfeia( s2ra(rpoo1tpx mieiytfs2rl( p u0aetrmr tadla elieolt srxo(m3oudlme  fetlt)s2rrxrono1tee ifciys s2elump;u) rtoircoa1om ranei (0s2um(o3ny1apenlnetasf 2umx pot4ape ifetadla2rmumon()texrmo oodlmD lueo () 2uoirpiudape licia( s2tau  ou4aex iociatla2ulnvo ()aetrmr3oodla rai i;()t2xr(mpnudalt mivs ( s2raxrpot1aeeomieiltla2rlnmpnt4 eeomr3oadlp   u slt)t2to(o io4om  lics s)arum(  no1tlenmiciydlsDrmu p;(4altoifciotfmt  ivils s2toxm no4ll nlfvta()arumurpnt0tle mi3tas m rlnms;u)artomf3iytom  liei;(  eurimpiy1lpeelfcslt arrau pou1opeoii3iasla ul(mo (0texrmo oy1fa  anvo;s0 exriopnu1ole lnct ( a2uaxmooo4alx mf3iysla rmu sn(4aexnxr iytlpD  ueo s  etoim3iudape mivtlt sDra( pnt4tpen i3tltfa rmnvo;u4aleomf3totomt  nvolt0srxmxr3oodoleemivtatfaDrr(m ot1opeomociatfs umnmp () rtomf3iatopt au o;() exmxr3oo1al n nvt t s2raxront4optn ietlslsDul(vp u0trtrif totlpteaivsls)seum(m ou4amee icta()a2rm(mpnt1oeto o3iatlmDra(vs u4 lxrxo iatfaDe n s;t)sruo(m3iy4amt  fvs ()srur( o;u1opxo f3iydlaDemnvp (4artoxf oo1lp  luei t s2xo(o no1ol e nct ( sDrrxrpnt4aee mieiyt a2ranvp;(4trerxr ta1fm elu i;t0t2trxopou4lpenmnvta(fa2rax  ;o0olx if3ils m rmu p u4aleomo3tydomtr uvo;s0srtrir iydlpte ivil(f 2um(m ;t4alen i3tld sDrmuvsnt0tlenxo totoa r nvo ()trxoio3oydome  iet t)aDrru  ot1tltn ietyd a rau s ()aeeoxo oatfa  aues;s setoim nudlp nliesltf 2tru poo0ape mfciad a2rau p (4aeeoxf3iy1op rlies;t)tetrxr io1aleemneiat sDtaur nu4tee  ieildfm ranmo (4 etomociotlmDraieilt s2xm(rpoo4ol nlivt t artr(mo;t4olx iieilsfaDrlnvs;u4areoxfcoo1omtelnvo ( seumxr iu1lm emiesas)s2raur ;t4olxo o3iaslm uauvs t)trtrxrctatfmDe u sls0t2toim io4lptemieiatf 2tmxrp;o1tltn oeiytfmDumumo;u)alxoxfciatfaDe u o t  exmxm3iudale  ivs (fsrrr(m ;o4teeo icildfa uluvsnu)aeerxo iadfmDe ueo;t0t2uo(o3oudomt lnvtltfsrua(  no4openifeiltfmDumn o u0texnxo ia1la raueols t2tmim iu1lleemfei t srum( o;t1alxomfeiydlaDemu pn(0 rtoif3tydop  lneolt)trxoxo iu4omeemivtasfsDumumoot0opt mictytlmDrln p;t)trtoxr3oytlmtrli s;s0 exm(rpoo1ome  fesat a2uaump;o0oeenmicilt s2rm( s;t0aexnir3oodopte n olt)t2trio3iydape lfetlt)s2tmxro;o1oexomocildfm2umnvs t4artnio tadfp   ueolt seurxo3nydoltnlncs t)aDrau p;t1tpen i3iydla eanmonu0tlxoiocoa1lptrauvol(0s2uo(o iy1om   fvsat)arum( oot1oet  f3iat m emn on() ltomr tatoptraivi;() 2tmim io1lpenlies (  2um(mo;u4tlxomf3iyt a eau o;(4 exrir tytlmt  ueo s srurim iudalt  fvtatfartm(  no4olen ieiysfaDua(ms t) eeoioctytoa rlnvils0trtm(r nodlmtelfet tfsDrm(roou1tetnif3iat m ua(vs u0tlxnxf ta1fpD aiesls)s2trio3oy1alt mieia( srtax onu1opeomoetltlsDranmo;t)texrxfcoo1lp e uvs t t2toxm nu1ol   ivsas)a2tr( ono1alxomocias aDrlnvsn(0teeoxfcty1lpD au s;t0 euriopoo4ll e ies ()srum( oot0tpxnmicilt aDua(mp;u0 eeomfciy1oatelnvi;t  exoimpno4om  micsa(fsDrmxronu0ale  i3ias aDrau p;(4 rtrmf3iytfa e i o s)seuo(opno4olt mfeiasfaDuau  nu1optnmfetytfs em(mp t4 rtnxfcty1optelnes;(0 eum(m iu1alt micil(  2rrurpoo4teenmi3iydfaDelu o t0tlxrmrcoa1la eliei;s0teum(m io4om  mnvta() Dtrurpou1tpxnmociatlsDem(monu) eeomrcoa1faDr nes (0 etm(mpoudapenmnvt s s2ua(rp;o4tpenmfctad sDeaumsnu0arenir3ia1opt  nvi;t) rtoxr iu1alt lnvtat)srra(rp;t1apx io3ildfa ulumon() eeoifciy1fa rli i s) rxrxo io1al  mieslt srtax pnt4aleoiicilslmDrau o ()aexomrcoo1fm eaivo;t0 2uo(m ny1oltnmiciatfsrtr( pno1tpe  f3tlt m rm(mon(0tetnir3iotfp r u s t tetrxr iy4llt mnvtat sDrauro;o0aptoif3iyslaDra(vp;u4 lxrmo iadlp eai ol(0srxmxrpny1om e ivsa() rumxmp;u0texnmocildfsDra(msnu4altrmr3iadfmte n sls) rtm(rpoy4altn iet s artrx pot4aeenmfeilsfmDem(vpn(0 etnmo3oo1fat auvils0texmimpiydap  mnesltfsrtr( o;u1opeomi3tltfm ranvs u4aexoxo3to1fpteln i t  2xoim3iudomeelnesat  2urxr nt4tpeo fciyslm rmuvp;u4artomrcoadopDranei;(0truo(opoodome lfeiltfarum(mono1open feild s umnms u)tltrio ty1laDeaueils  2xoim3ny1omt mnvsl()sDtrxm ou1oex  ictldfa elu s;t4texrif3tytlaD an o ()sruo(mpnu1llenmiesatfs2rmu  nu1olx ifetytfsDra(vpnt4alenmf iotopD  n s s0sexoxo oy4omeemneslt a2raxm ou0optomo3iltfsDrluvs t4 exrmf3ootom rli s;s s2xrim3no4ap n ictl(f Dtaur ;t0alx  o3iydls uluvo u)texrxf3todfmDeauvslt) rumio3oo1lpt  fctl(faDumxmonu4teeomi3ias a2rl(von(0trxoir oy1lmDeln i;s)trtrxm io1amtelfei s  2umxmo;u0aeeomi3ildfa2ulu on(0texrxo iotlp ranvi;t) ruoio iodam elfctls)arrrxm oo0tee  i3tlt s2elu sn()alxoxo iydfa r uvo t0 exr(m3iu1lpee nci t  rtmxrp;t4tlt if3iasls ea(vs ()tetrxo oytoa ean sls)srxoimpoy1apee ici (f Dra(mooo1oetomfeiatla rl(vp t0 rxrmocia1fp   nei;(0t2tr(opiu1ol n nvtlt a2ua(r ot4olt  icias a rmnvsnu) lxnir3iadlp ranes;s0s2tm(opiydlme mncta()sruau pou4aex mi3iyt aDum(vsnu4altrir iodomte n ols0setmxo3ny4lpenlfcsas arururooo4altomicils m ua(vp t0 rxrxrctydomD liei;( sexrim3io1ameelnvt ()s2ta(rpou4apeoiieiys a2ua( snu0 rtrir iadomDeaivi t)sexoio ny4aptnmfvt s)s2uaurpou4olenifeiatlaDeln pnu4tlerifcoytfaDrlivils trtoxm3io4lptnmicsat s2uaxm oo0optn icilsfs2uauvs (0teermrcoy1fptr n s s0 etm(m3iu1apt mfvslt)arrmxm ;o1tpt  ieils sDel(vo;(0tltrio3oydla  aies () 2ur(r3iodal   fesltf 2rmxm nu1opeoioeiadlm2ra(ms t0 ltrmf iotlm r n ilt seumir nodalenlnvils srtaum nu0aetn ociys aDem(vont0 lenifcoodlmte n i;()t2xr(o3nu4opeemnctat sDua( ono4altn ieiyt a2em(msnt0tlxnxf iadlpDe ivs;t0trtoxr no1ole  icsltfa2tauroou1apxoioeiatls2emumont4tlxrxo iotlmD lieolt) rtrxmpio4lptelfvt ()srtaxm ou0tet miciatlaDumn on(0aetoir to1om eaivol()srxoimpiu1lltn nvsatfsDra( o;t0olto fciyslm rmnmo;t0alxnxrcta1latrlieolt texmimpou1omt  ncias s2tmxrpno1aeeo fctltfm um(vo;()tltnio3iadfa  luesl(0srtm(o oy4lmeemncsas  2umu ono0aexoii3iyslaDea(vp (0arerxf3iydfmteai o t  2tr(mpiodole  nvilt) ruau o;o0ale  ictlsfaDranvo t) etoxf iatlaDe uvi;t s2uoir3ou1omenliet t)aDurxrpou0oetn f3iad s2rmums u0tltoxf todoptr nvs;s0tetrxm3iu4aptnmnvi ()aDurxro;t4tlxnmociltlm2emn onu)trenxrcty1lp r u o (  2trimpny1llen nvias  rumxm nu4altoifeiyt sDrmnvs;u0artrmo3iodoat aueils seurir no4alen nctl() rtmxmpno0oexniiciyd sDumu s (0tetomo oa1opteaueo;s0sexm(r3ou1ale lfci (f Dtaxrpnt1apt miciyd sDuln o;u4 renmo3ia1oa  livs;s)trxr(m iy1lmee fvilsfa2trxrpnt1oleomf3iydfmDumu on() reoxfcoytlatrli s t0 ruoio3oo1alen feiasfarrm(r no4apeniieiadfaDran snt0 lxnioctatfptr nei (0s2xrimpiodol emietat)sDrrxr ;u1tlx mfeilslsDulnms ()tleoir3iydlmD  uei;() 2um(o3oy4omenmnvt t  2rm(moou0aet mo3tldfs2umumo;t4aexoir3oa1la   n s t0 2xm(o3oy1opee ics t srua( ont0tlen o3ilsfsDrmu o (4teeoxocoydlmD luvo;(0 2xoio io4op nmici s  ruaxmo;o0tltnifciydlm2rauvs;t) ltrioctotlmteli sls0t2xoxrpno4apeemfci t)a2rm(monu1aexo o3iadfsDrlu sn()arxrxrcoy1lptrlnei;s)srxrim3oy4lmee ivta( a2rrurpou4oee  ociyt a2eau s;t0trtoioctytopD ai o t)teumim3io1ol e ieiat  Dua(mont1teeomf3iysfsDeanmp t)aetnircoo1fmt  n i;(  eum(mpoy4ol  lncs tf Dua( p;o1apto ietadla rl(ms;(0tltoxf3to1faD aiesls0truoir nu4lmen fct ()arrr(  ot4tet  fciatls eanvs t)arxomf oadom e i s t0s2xrirpio4ome mneilt a2tmump;t1ope io3ild mDel(mp;u0tetoxr totopD  u i s) exm(rpoy1omt mivs t)aDuaxrp;u1oexomiciyslmDem(mo ()artnxocta1la eai i;(0texmxr3iudamenlicilt a2rr(mpoo4altnii3tlt sDeluvp;t)artoxf3oy1lp  lneols0trto(r3nu1omtnlfvtlsf 2rmumo;o1tltn feild s emuvo u0 lxomf3iodfatrlnvolt0seumim ny1altnlfvt (  2raumpnu0apt ifetldls2ranvsnu)trtnirctatfa  lnvsls0 rxo(o3nydaleelneil( sDra(  ;t1tpen i3tyt a ra(ms t0trxoir3oa1lmD  nvs s  etmxo iy1al elfvsas s2tr( pnu4altnmfciatfm2el(mp;(4 rxrxr oodlpD  ivs;s teurxmpiu1openlnvslt a2urx  nu0alto icilsls2elnms;t4texomo3io1fatrluvs;s0 etoio3oo4omtn fcslt)srrrumo;o0alxn oeiys s2em(vsn(0 lxnxrciy1fmD luvs;t sexoir iodop elivtas sDta(r ot1opxoifctldfa rmums t0tlenmo3todlmD an sls)s2tr(r no4lm emnetas srumx oou0apxnmociys s2ul(vpnt4 ltrir3oy1op r ivo t srumxmpoy4opt  iesl( arrr(m no4tlxomfctyslaDrm(mo t0tlxomr oadopt aieslt teumio3iu1alenlnes t)srraxmpnu0olt ifctatlmDumuvo;(4altrir3iy1fa raivo s)sexmxrpoo1am nlneilt aDrmu o;o1tpenmictadla2rlnvon()tlenxr io1latrln i t0 eumio3oo1ape  fvslt a2uaur ot4tetoifciys sDumuvpnu) eermf3tytoptean i;t s2urxmpno1lmeelncilt aDrr(mpoo0oetomfetatfm eln s t0 rxomf3to1opDe uvil(0t2xmxmpiy4lmt mfvils s2rm(mo;t0opxomiciatls2elumo t4 lxomrctytom ran s s0s2tm(o3oy1op  mnet (  Dtrx p;o4opx  o3tytla rlums;t4 lxomf3todop   nvi (0 2umxo3iudlpte nci (faDurx pot4olen feiyslaDra(vp;u0aexoxf3oodlpDeau o;t teur(m3nodamenmiei s)sDrmx pou4oetomf3ildfm el( p t4arxnif3tadlmDe n il() 2xrxopiy4ope  fctltfsDrau  ou1tlxnmociltfaDel(mon()altomo3oadop rlues s0 rtmio3iu4lltnlivil( sDuauroot1tpxoio3ilsfaDemu p (0tleomocoydlmDr u sl(  euoxo3iydlpenlictls artmxr oo1olxoii3ildfmDrl( on(4 lxnxo3tatopt  uvs;(  rxrxm oo1olte fvta()s2ur(rp;o1tpxo iciysfm2emumpn() rxrmrcty1fm  lnes;s) rtoxmpoo1alenlnvs t s2raum oo0aleoiicilsfm2emuvp ()texrxr3oytlmtrlneo t)setmiopio4lptn ncsls sDurum ot1tlxn oetasfm em(msnu)arenmo iadfaD au s t)texm(o oodom emneils aDumurpot1oleomf3iat m2emnvo u0 rtrxocty1op eauvils) rxr(opiu1al nlicsa() rrrxm ;u0tptomocildfa elumpnt)tlxrmfcty1oaDeai s;()sexo(o nydamtnmnviltfsDtm(mo;o4olxo f3iadls ul( o;t0tltrxf3to1op eli o;()s2trio iudlme mfvsat s2tr( pno1aeeo feiadfs2el( s t4trxrxr ia1lmDrli sl()seurirpoy1lptnlfcilt) Dum(rpnu1olt mfctlt m eluvo t4trtrxoctotlp elies t t2um(mpnydol   ncilt  rum(r oo1tptomoeiysls umuvonu) rtrmo iytlptrai sls)setoir oodomeemfcia()a2tax  ot0ole  o3iat s ra(mp t0aetoxf3oo1fpDrlnei (  2toxm oy1apt  neilt) Dumx o;t4oleomoeiaslsDemumo;t)tetrmo3ta1fp eaivi;(0setoio3io1op emfet ()srrau oot1ope  oeiytla elums;t)trenmr3oydom   ivils)srtr(rpou4apeelfvi tfa2trur ;o4opxn oeilsfa2um( s;u0artoircoo1lmDranes t0s2xoim3ou4ameelneil(f rtmur ot4apt ifeiytlsDuluvpnt4 ltnifcia1fat lu s s) eum(rpoy1optn ieiat s2taxmono4oet ioetasfa2rluvs;(4arxnxfcto1lpD liesl(0t2uoxmpnodopen iviat  Dtr(r ;t4oee mieiltfa2rmnmpnt4 eeoxf3iydlmD  uvs s)trumxr oydoleelfvsa(fsrrm(m nu0aeenmfciydlm2ea(vsnu)alenmf3oydla r uvi;s)srtoim3no4omtnlfetat)sDrmumpno4ape  f3iasfaDuau p (4 rtnmr ia1omD aiesl(0sexoiopiu4lptemnvsasfarumu pot4openiicilslm um( p;(0 eeoio3ootfaD lu s;t)setrio ou1amt mnvsas)sDrmu poo1aetoioetyt s rmums t) rtrxfcoodfp rlivo ( s2xmxo3oo1olteliesls)a2trxro;o4apx  o3ildlm2ea(mo;t4alermo tydlatr uei;t  2xm(opno1ll  mictlt) Dtmx pno0tlt moetadlm eln s t4aetoxoctatfmte ivil()srxoio3oudap emivt (f rrmx pno1oleomoeiys s2ra(vpnt0alenmociytlm rlues;(  rxrio nudomtn nvias)aDuaxroou0opxomieiytfa umn p t4 rxnifcoo1oa r nvi t)t2uo(m3oydaltnlnei t  2tmx o;u0opxn o3iyt sDrlnmsn(0artrif3io1oat auvs;(0trxm(r oodlltnlfvsat s2tr(ronu1alx  fetas sDelump;t4tetomo3ia1opD  n i s  rxm(r3oy4omtnmfcs (  rtrxrp;o4oeen f3ilslsDea( s;u0alxoio tadoptrluvs;t trurxm3oo4llt  nvslt srtm(rp;u4tpeniieiyt mDemu pnu4 lxnir iadoa  aieo;t0t2tmxm3iu1ol n nci s)sDum(r ;t1ape mi3iasla2ul( p;() rxnmfcto1fpDeaieslt texmxrpiy4op   ncil(fa2rrxront4alxnif3ils sDeauvs t4trxrmrciytfptean il()s2urxmpny4olte neta() 2ua(r ;t4tltnifeilt mDrm(vo;u) ltnir ia1fatraueo t0 eur(m oy4am nlfctas) rumxmo;u4oltnmi3iydfs emnvsnt0aetnir3ty1latrlu olt0trxoir3oo4optnmiesas) Durumpno4aexoiieildfm ul(mp u0texrxr iydopte u i;t)seur(o3oudaleelivtlt  2tau pnt0oleoiieiydls2ua(mp (0alxoxr oadlp   ieil( s2xrim3ou4lmenlics t a2urx ooo0aptnii3ildfm2rluvs;u4tlenxfctotoa ean slt0tetm(rpiudapeemnei t arrm(rpno1texn oeils s em( s t4 ltnir3iadoaDrliei;(0tetoio iu4omeemfvt (faDum(m ot0tltnifeildfaDeanvs (4artoxrciytomtran o (  2xr(mpno4ame livtas)sDtr(mo;t1tpxoifeiltfaDeauvo;(0 ltrif tydoateai sl(  exo(r oodlptnliet tf 2tm( pou0altniieildfa2el(vo;() lxoir oodlaD ai s;s)sruo(o oodamtn fci t a2rrx poo4oleoii3iadlmDul(vo (0arxoio3tatfatelneols0tetoio nudom  mivilt)a2umx  no0teeoii3iatlm2elumpn()aetrir todfpD aneo;s)s2tr(r3nudapenmiei (f 2ua( pnu1olxo i3iysfmDulumonu) exnio3tydlmDe ivs;s  2tr(r3oydll e iesa() Dum( p;o0tlt iicils mDum( on(0tetriocoydfaDeanvil(  eto(opoydlptn icslsfs2urxrpot0tex ioetad m2uln pnu0artnir oo1fa raueo;s) etoxm iudlp   iesl()s2rm(mpnt4aeen ictld m ua(vp;t)trerxocoa1fp  auvi s0seuo(o3oydomenliviltf rrmumo;u1aet ii3iys a2eaump;u0trenio3todfate iei;() 2xo(mpnodllt micias aDurx p;t0tpe ifeiys a rm( o;(4 exrif3to1late ivi t)seuoxr3oo1lm emnvi t) rurx pot1tlt mfetad m ua(mp;u4alenifcoa1fa raiei;t sexmxr no4lmtnmfesa() rra(r ;t0altomociydfm rl( p u)aleoxr oadlaDean s;s  2xrirpoydlpte ies (f 2rau pot1tpxnifeildfsDumuvo u0aeeomfciy1omDe uvilt0s2tr(mpoo4lm  mietas  rumu  ;o4apt ifeild a2elnms t0trenmrcta1om eaiei t s2tr(mpnydape  fet s)sDuax  ou0tlxnmi3tad m2ran s;(4aleoxf3ty1om  lu i s t2xr(o oy1am elivtatfa2uax p;o1tpxn o3iadls umumo;u4trxomo ia1fatr n i s0sruo(r3oo1ol nlicta()aDraumono1aeenio3tlsls2elump;()alxoif3tatoa  li o;t) 2um(mpoudap elfeilt srua(m nt4altoioetysfs2ulnms (0 reoxr3tytfa   ies;()s2urxmpno4lmtemnvils s2umu  ;t1optnmi3ilt m eluvp;t)altnxf iy1fptraies t0srtoxo nudlp n ict sfaDtm(mo;t1tlxoio3iytla raumo;u4 renmr iadfate uei;s)sexoir3iudlmte nei t a2tax ono0altnmictlsla el( o;u4 eerifcoadlm   ivilt  rxmir oodlp emivtlt) rraxm ot0ole  i3tydfs ul(mont0trxrxocootfmD li ils0tetoxmpiu1open nes sfsDumumo;u4aptnmoeias a umnvs;u4artomf iatfm ean i s0s2tmxmpoy1lp  lictlsfarum(m nu4aexnmf3iadfaDel( s u)aeermocoatoaD livo (0t2um(o3oy1alenlicil( arrm(r nu1oleoiociysls2rlnms (4tlxrir iy1fptrln s;s  rumxm ny1ol   nesltfs2rau  oo4oltn fciad a rm( p;(4 rxrmr to1faD lieil(  exmir3iydlptn nei () 2rr(rpot0tpx mociad s2uln p (0aeeoxo oo1omD auvo;t trxoim oo4ll nmicta(  2uaumo;t4opt  oetytlm ean snt) eeomr3oadlaDe nei () 2uoim oy4am nlnci t artauroou1tlt  o3tadlmDua( p;(4 ltnmr3oa1optr nvi;s)trxoxo nu1al elncsat arrrxrpnt4tlto oeiydla rln p;t)aeenxocoytom eaivol(0s2xr(opnu4lm e fcils s2ua(mpou0tpen icilsfs rmuvo t4 leomr3to1lptrlnvsls0 2tmim3nu4lpe  nesl( a2urxm ot0tpt  o3iytla eau o;u0trxomr iydfa e n ols0s2xrio3iodomt lfei (  rrmumo;t0tltniocias s uan sn()trxrxo3oadfp r ieols0srtmxr3oudoltn icslt)a2taxmont0alxn octlt sDuanvo;u4 rerif3ia1fmt livols0 rxoxm iy1lpee ietl(fa2rm(rp;o0altoioctld s uaump;(0 exoxr3iodlp   n i;()setrxr3iu1lleemieil()a2tmum oo0ale iiciyt s2um(ms;()texnxo3iatlpte ivi t  2xm(m oo4ale  nci ()srrauro;o0oetoii3iydfs2rlnmo (4 exnir3oatomte ieo (0s2uoxm3nydol n fcsa(  2ur(r ;t1tlx mi3tys aDrmu p;(4 eenxr oa1lmtraneolt)sexr(r ou4lptemnvsl() 2trx p;u0apeomoetas s umnms;t4alxrxf iydfatelu ols s2xoir nydol emfvi ( sDtmxroou1ope io3ildfm ulu s (0 lenxr3ta1omDrlu s t)trtmxopio4ll emfeias)s2tr(moot0tlt ioetytls rlu o;(4 eeomf3tydlmDrln s;t tetmxr3oy1ape lneias srtrur ;u4alx  ietldfs ul( p;t)tlxomf oodfaD lu sls)sexo(mpoo4alt mieiat  rrrxrpot4tpe  fciat s2rlu pn()aetrmoctotfa eauei (  exrxmpoy4lltelnctl(faDuaurp;t1texniiciasfmDumumpnt0aexnmo3ootlp eau s;t0 etrir3oo1olt lfcils)a2um( ono1alxoif3iltla rmnmpnu4alerxf3oadopt  ivil( seur(mpiu1lpt mfcsls  rtrumpnt0oee  oeiyd aDelumpnu4 lxoio oa1fptelivil( t2xrxm iodopt lnvtlsfs2ta(m no1alt mociyt a2eauvonu)aleoxr3ootfmte uvol( seurir nudlmte nciltf rrm(m no1olenmoeils m ran pn(0 eeoxr ia1fpt anvs (  exmxr iodam  mnvt s  rtax pno1tee  f3tlsfa umnmp u0arenircoydlatrluesl( t2umxo nudol elnviat a2ra( p;t0aptn ietytls2umu ont0artomr oodfa e i s;s setr(mpoy4omtn icsl( arrrurpnu1tlxnmf3iaslmDua(vp (4teerifcoa1fmDe uvs s)t2uoio3ny4ol nmivta()arur(  ou1tpxomo3iasfsDra( p;u)aleomf ootfm rluvi s)t2uoir no1omtnmfetlt aruru p;u1ale if3ildlaDuan s u)treomrcto1optrluvsl(  rxrxrpoy1altn fesls sDrrxmpou4opeomf3tadlm ea(vo u)alxrmf3oo1oateln s;t) exmxm oudome lnviat  2ta( pnt1tex mfetlslmDrlnmpnu0arxoifcio1lptr ivsl(  2ur(r iu1llte ncs t) rrm(rpot0tltnmociadla2ua(vsnu)aetrxf tydfpDeaies;s0s2trir3iydoptnmieiasfs2ur(ro;o1tpxnmiciadfmDua(vp t)teerxf tytlat aneils s2xo(m3no4opeelfctasf rrmx oou0apenmf3tld mDuan o (4trtnmo3oy1fate ues;t)trur(m iy4ll   fci (fsDtaxrooo4tlx ii3iadlsDulump ()arenxr3iadop elnvi;s)s2xrxo3ou1lm e ncs s) 2rrum ot1tpx  fciasfsDel( sn()trtrxr iy1fatraivi;(0 euo(m iy1aptnlnvi t)aDrmx  oo1ole mo3ildla uluvpn()artnxo oytlatr u o;t srur(r ny1ll  lnvt s)srrr(rpno0oexnii3iasfsDum( o;u0tlxnio ty1la eai i;s0 2uoimpnodame  fvi sf rtr(r ot1oltoifeiad m rl( pnu)teeoxrcta1op elu ols) exm(rpoodlmenmnet ()a2rrur nt4tetnii3tydfa2ul(vo (4tetrifciodoat lneo t trtm(opou4am nlict t) rtmxmpot4apto o3tad m2emuvo u0aexnxrcoa1fmD  ivo (  rxm(m3iu4am n ncil(  rtr(m no4oetnmfeilt m rau s u0 ltrio3totfpDrauvi t srxrxm no4ap   ncsat s2urxrp;t1alenmfeilt m2eaumont)altomo3to1fatranvolt)truo(opio1ol nlicsa( aDtm(m ot0oee mictlt m eln s t0aeeoir3ty1fa  auei t t2xmiopnu4lleelfes (fa2rm(mont0tetnif3tadfs em(mp t)aeeoir3iotoptrlues ()trur(m oo4lmeelfeslt)aDumur oo0oexnmfeiatfa el(vs;(0artomo3oatfmt  i s s)t2ur(r3oy4lle lfctat)srtruroou0tle mocias a rm( pnt)aetnxf tydlaDelivols trxm(opoy4am emnes t  2ua(roou1apt iiciydfs2um(vp t0tlxoifctatfat  i s ( setm(o io1lptemivtls)sDum(moot1tle  f3ils mDumu o t0arxoxf3tatfa  ai sl()setmir3iy4ll e ieiatfs2ra( oot4tpeomieiatls2ulu pn(0tetrif oodfm   n i;s0 rto(r iy4lm n ici s) 2rm(mpot4tltnmfcildfsDum(vs;t4alxomr3todopD  nvilt  rxrir3oodamt mneta( s2um(mpot1opx  oetadlsDelu on(0 ltoxo3iotfatean sls) exmxr nu1am   fvt (  rtmx oot0tlxn iciys s uluvs (4altnio oytfm r n o;s  ruriopiudop elict (  rtaum ot0apenii3ilsfa2uaumo;t4trtnmfciatom   ivilt  2xmxo oo4ope  ncia()aDurxr ;t0oee  feias a rl( p ()altnif oytlmte uvo;t texoxopiydlpee fvtlt)srra(rpoo0texnmoeiadla uanms;t) reomf tatop eluvs;(0teurir3no4omenlnciatfaDrrxr oo0tpt  oeiatlm2rl(mp;u0arxrxfcio1lpDranvi t)s2xr(rpny1lp   fvs t)aDtrxrpnt0tetn iciltlm2ua(msnu) ltomo iy1omt  ies s)sruo(opoodalt lfei tfsDtmxm ;o4teeomo3iadlm2rauvo t0tlxnio oadop r i sls0teum(opnydap  lnes ( s2ururo;u4apeo ietydla2raumsn()trxrxfcia1faDrlieolt0s2ur(rpoy4amen ivi t  Drax oou0olenmi3iydfsDrmnmo;t0aetoir3todlptrlieslt0sexrio3iydll emncta( aDur(mo;u0aptniictls sDea( s t0aexnxr io1lm   ueilt)trtmxm iydopt lfeia(  Draurpou0oltnmf3tyd a emuvs;u4 rxnio3ia1lmte n o;s0 exmxo3no1al emfcslt) Dum( pnt0apx mi3iyd mDeaumsn() rtnxrcia1opteanesls0 ruo(o oydlle mfctlt)a2uru o;u0oeeomoeilt m rmu o;t0tetomo3oodop r i ilt) 2xr(m ny1op emicsl(f 2rax pnu0oetoifeiydlsDeauvo;(0tetnifciy1la   uei s0trxrxm no1lpen iesatfa2ur(mp;o4opxo i3iasfa rm(vs;t0aeenxfciadlmte n s;t0srtrim3iydlmtnlfct t sDtru  no4tlxo ocildlsDelump;(0 reoxfcta1lpte ivs;(  rxoio3iodamtemfvslt) rtau oou1teto fciat s rm( p u)artnxo3iydoatran olt) exoxo3nodlle mfctas arra(m no1alx mieiasfm uaumont0 ltnxr iadlat  ues (  2tr(mpoy1omenlfeils arrmu  ;o0tle mfctysfs rl(vo;u) exniocty1lp rauvi t srtoio iu4op  licias) rtr(m ;t1tlt  feilsla2rmnvo (4 rxnio oo1fpt  u s t  2xrim oo4lpeemfvslt artrxr oo4alx  o3iytlm2ulumo (4texnmr3totom  aueo;t  exo(o3no4ame  nvtas) Dtaxm nt1oexnifciyd s2eln s;u0artrmfctatoaD lues;( setm(rpoo1lmtelnvi t)a2uax  ;o0aptn feiydlaDeln s t0tleoxf tydfpDraivi;s)srtr(r oodlmee fcsas srum(ronu0alxo fcildfaDelnvs;() exniociydomtranvo;t0 2uoxm no4aleemivias  Duaurp;u4aeeomo3iadfmDum(vo;(4altoxr iotlpteliei;( teto(m3nu4al e nvs s aDtaurono4aeenifciysfaDeln s;t)aleoxf iadoatrauvi;()teum(rpny4apt  nvs sf 2rmxmp;u0tptomiciysla2rau on()altrmoctadom r i ilt)s2tmxmpiu4alt lnvsl( artm(  ou4tpxo oeiadls ra(vs t4 lerircoy1lm  luvs (0 exm(opnu4lpe mnvil()a2rm(r ;t1tlx  iciytfm2umnmo u4 ltnxf3iy1fmteaivs;t0sexriopnydlmeelnesltf 2rr(r no0apeniocildla ea(von()tetrxr ootfpDeaues;t texm(rpiodlmenmieia() Dtaum ;t1altoif3tyslm2uln pnu4alenir3tadom  au o t0truoxo3ou1omeemfvsa()sDrmurooo0aleniieildls2rluvpnu0 ltnxocia1fptrluvil() 2xo(opno4amen ivi ( a2tr(m ;t1alenioeias a2uanvo (0altnxo3tatomD ln slt texrim3no4ap  lfvias s2uaxmono4aexn i3iadla2ua(vo t4tltoxo iodfpDr ivilt) exrirpiodlm n feilsfsDrrx pou1tlxo fcilslsDem(vont)tltoxf iatoatrai i;s)srumxo iydop nlict s sDtrx onu0olenio3iat s eanvo;()altrio3oytom e n il()s2xr(o3nydope licia(  Duaur nu1apxo f3ils m2ra(vsnu)arxoxocoatopDe n i;t0seum(m3nodape  nvtls  rtauronu4oexomo3tatls2uaumonu) lenio iytopt aneils0trtm(rpnydap e ivsl(fs2urx oou4aetomociatlmDelumpnu)artrxfcta1fp  livolt) etoim oydlmt  ncils aDrmump;t0apenmictasfs emu on(0 eeoxf3oytfaDelnes;s0 etoir3nudome mfct s)aDuau poo0tpeo o3iytfm rlnmsnt0altnmf ta1om  aies;t)srxoxr3iudapeelfvsls sDrmxmpnu0ole  oeiytfmDelumo;u0 exnmfciatfp e nvils) rtm(m3iy4ame  nvils arur( pnu0olxomfeiad mDrau o t0altrio3todomDr uvsls  rxrxopoo1altemfeiat  2tr(rpnu1alxoio3iatfaDrauvon(4tlxnxo3io1fm  au o;t)s2trxm3nodlle lfct (farurxroou0tpxnioetytlsDelumont4aeeomf3to1fpDr neo s t2toim oy1aptnlfcsatfsDrrxmoou4tpxo feiat m2ua( sn(4aexomocoa1omDe i s;()trxm(o3ou1aleemfesl( a2tmx pot0tet miciydla2ea(ms;()tltrxr iadoa  lies t0 eurim oo1lptemncs s sDumxmooo0alt mo3iltla uauvs u0trxomo iydlm r i i;s)trxmxm oo4omtemivs () rtr(ro;t4opxn iciadlaDemu pnu4trxnir3ta1fateln o s srxmim3oy4lpenlfviat s2tmx onu0apt  i3tydfs rl( s;t) ltnxr3iy1fptrlnvi t) 2uoim3iy1lpt mfvilt)sDumu p;u0olen iciasfa elnmp () ltomo3iodomD lu il( t2xoirpiu4op e iviat arua( poo4tpt  ictadlm2rmn s u)aexrxo3ootlp  ln s;()srxoxmpiudaltnlfvs () Durx  nu0alxn ietld s2emnmp;u)aleomrciadfatelivi;(0 2xmxopnu1lp nlnet t)sDtrumoou0apen f3tltlaDem( on()treoxr3io1latrauvol(0srxmxo3nodap   ictlt aDur(rpno4oee moeiltfa ul( o (0tlerxfcto1lm   i s (0 rtoiopiy1amenmfvil(fs2uru  ;o1oee  f3taslm2rlumon()trenxrctadop   uvo;t  2uo(r oodapt mfcsltfa2tmur ;t1olt  ociltfa2raums t0 lxrxr3oadoa  lnvo t)trxo(mpnu1omtelfeilsf Dur(r ;u0oex  iciydfm2rmnmp;u0aexnxf tadomDrlnvsls0 2to(rpio1lleemfvs t aDtmx oot4open f3iytfa rl(mo t4arermf3totfatr u s;s)seumxm oy4lpeemiei ( aDumur nu0tpxomociyt sDuan o t0alxnxo oodfmD ln s s)teurio3oudope  nvi s)aDua(moot1optniociltls ul(ms;u0 lerir3oatlp rln ils0 2xm(r oydope  ncsltf ruaurono1tlen icilslsDumnmont0tlxrmf tydlmDranvil(0 2xmxr3iydoltelictlt sDtr(  ou0optnio3ilsfaDrluvpnt4teermo to1la  ln i (0trtm(rpoodllenlfet () Dta( oot0tetnmfeiysfs2ulu o t)alxomf oatopt livi;t0 rxrxm3iu1apenmfes s aDtruro;o0texnmoetldlaDul( s;t4teerxo3iytlmtelnei t0 2xoimpou1apenlfvtlt a2ra(rpou0tlt iicias m2em(ms (4 eerxr3oadfpDe nes t)sexoxo3nydlptn ieia( s2rrx o;t4tpt iictyd m2rmn s;u0trermf3oadfa eaueo;s0 etmio io1apt mnesltf 2rr( o;u0olxn ieiasfa2rm( s u4aetoxf iy1om raiei (0srurir3oudlmtnlivias) 2rmumo;o4apen fcild m2rmu on(0aetnio3iadlpD ai o;s0t2xrir no1lmtn ncs s sDrrx p;o0tet  ietysfs2um( pnu)trenmrcootfpteauei t  rtmir3io4opee fcta(  2tmump;u4texo i3tyt sDeluvs u4tlxomr iydfp r uvs t0s2ur(mpoo4am   fcsasfa2trxm ot1apeniietld sDel(ms t0trtoxr3iydlmteauvo (0 2tmio3oudllee nvsltf Drr(  nu1teeo icild m2eauvo u4alxomf3oo1om ran sls0 rtrir ou4opee netl( sDrrxront0olxoifciytlaDrluvsnu4teenxf3iydfpDr nvi s srtrxo3no4am   ict sfsrrrxmp;o0altomo3iadfa2rmnmon(4 exoxrctydlp  ai o ()t2urxopoydap nmictatfaDrmx  ;t4ale mietyd aDuauvp ()aeenxoctydlp eaiei s)srtrxo nodamt mivt (f 2ra( pnt0oleomfciad a rm(vp t)treoifciotfa r ivolt)trxoxr3iudam e fctatf 2umxr ;o0oeeomfeilsfm2ra(mp u)tltoxf3to1opDe nes;t texoimpou4lpe mietas) Drrx  ;u0tptnmoeilsfaDrmums;(0arxnxf3to1op e uvi (0sexmim3no1lmt lieilt  rtm( o;u1tpe ioeiltfa ra( p;(0trtrmr3tadomt  i o;s) 2uoxr no4oleemfesl( s2rmxro;u0oetn ieiysla rau sn()artnmr3todfm  auvs t)seuoxopio4ome lics ()a2tax o;t1oet mfciatfmDuan pnt)alenif3ta1lptrai s;s tetrxopou1altemivtat aDuru ont4tlx mietltfm2um(vo;u) exrxociy1fmD lieo ()texm(mpnu1lmen fei s) rtr(m ou4tee mo3iydfaDranvon(0artnifcto1lp ranes s0trxrir3iu1alee nvilt) rrru onu4tlx mfciaslm2ra( o (4arxoio3iadfate ivs;t)seur(opiydapen nci t sDtaxrono0olxnio3iatfa2rmump t0 ltrmr tytoat  neols0 euoxr3nu1oltnlictl()sDur(ro;u4aeeo iciadfm2rm(mpn(0 leoxo ta1omDrli s;t)seuoio3iy1lpe  feiat)s2rmurp;o4tlt  f3tls mDua( p (0 rtoxrctydlaD ln s s0 eur(m3oydapenmfvi t srtaxr ot1altnif3tltfa em(mp t0artrir3iadoat  n o () rtmir3ny1olenmiei tfaDum(mono4tpto ieild m emn pn()trtnmoctadfa  ln i s) euo(m3ny4oleemfvi s) 2trur ;u4alxoioeiat a eln o t0 reoir iatoatrluei s) rtr(mpiu4omen nei t) rum(m no0olenifcildla2rauvs (0tetrmrcoydlp r uvo;t0srtm(o nydope  fvtls arua(mpnu0tpe  i3ildfa ea(mo (4 exoxo3to1oat livi ( s2trio ny4ll n ies s)arra( oou1aexnmo3ils m ea(ms (4trtrxocoy1omtrau o;(  euo(o3iudlmtn ncils)sDur(roou0tpx ii3iadlm2umn p (0 rxoxf iodopte ivs;s  2xmxopoydlp   neilt aDum(mpnt4oexnii3iyd a2umu s;()aetnircoytfmDe nvol(0 2uoxo ny4op nmfvslt)a2rru  oo1aetn fetasfmDrmuvs t)aleoxrctadfmDrauvsl(0trtr(o io4alenliesa(fsDtru poo4tex micildfm2ul(vp u)trxnir3tydfa   u s;t) rtmxmpnodam   nvi s aruaxm ;u4tptomictltla eau o;t0altomrciy1lp rlivi;t)teurxm iu1apeemncilsfsDraump;t1tltoioeiatla rl( sn() rtoir3todoateai o s)sexoir iy4lme lfet tfaDumxmoou0tpxnmi3iatla umumo (0tetnxo iy1fmt ai s;s setriopiudll   fvsl( s2raxm ;t1oetn f3tyslaDul(mo u)tltnmrcoodomD lueil()seurxmpny4apen iesl() Dumx ont0teto ietadls2rluvo (0alxrmfcoatoaDe nei t0 rurimpiudope  ivsa()a2umxmo;o0aexomfeiatlaDumuvp u)aexoio3to1omDr ivolt0 etmio3no4ol n nei (  2rau  ;u4tetnif3tlt s uanmp;u0aeerif3todlpDeai olt) rxrxopnu4omeelivtat s2rau onu4opx ii3iatfa rln p;(0 lerxr3tadlaDeau i;() euo(r ny4op e iviasfs2tmurpou0teeomfctys m ulnmo u)alerxo3iotlm eaueils0setmirpou1openmicsasfsDtm(rpnt1tltnii3ildfa em( sn(4aexnmf tatoptr uvo;s0 etr(rpno1ll e icsa()sDrmur ;u4altn iciat mDul( o;t4aetomoctotom eanvslt seumirpoo1lltn nciasf Drm(mpnt4openifctatfm ulu pnt4alxnxf3iytfp  lueo s) rxr(m3oudaptnmfetat)arumu o;u1tptoiicildls2rauvs ()arxoxrcoadop  anvo ()seurim oydol emncs (  2tmu oou0oex ioeilsfs rmums (4tleoxfcia1lm elues s)seurxr3ou1lmeelics t  Dum(mpno1apt ii3iydls elnmsnt0 rtnio iatomDelieo t0 rumxo3iu1omenmfct s  Drr(rono4opxomietys a rmn pn() exrxfctadomt luvi;( sexoir nodam  mfcs tfarua(m no0aleomfeiltla ea(ms ()alxnmf io1lp r nei (  rtoimpnu1oltelfcta()sDtrxmpno1aexomo3tad sDum(vo;t) lxoxo iy1laDr n o;s0 ruoio oo4ape mnci sfsDraxmonu0open icilt s2rmnmsnu4 rxrmf3tatlpt  ivi ()srto(o iodoltnlict sf rrrumo;t1opeomieias m uln o u) lxrxf3oy1lmt li o;(  2xoir3nu4lmeemics sf Duaumpnt0tpxn ocilsfa el(vo ()tltnmrcto1lm elu sl()t2xoirpnu4op elfcslt)artaum ;t1ole mf3ilt a2eauvsnt4altomr oa1laDrlivs t)t2uoxrpnodll  lictat  rtruronu0tetn feiysla2ra(mo;u0aexrxfctytlmDe u olt0 rtr(o3oo4al nlncias aDtmxro;t4tetoioctld a2rmuvs;(4tltnmocto1oat  i o t texo(r3nodomenmnctls)a2tm(mo;o1tpxn fcilslaDra(mp;t0artrir iydlmDrln i t texoio3nudam nmnvs sf 2rrx ont0alenioeiltls2ua(vo (0trenmf tatlpt  ies (  rtoxrpou1al  mfcslsf Dur( ont4tpxo ieiaslm2eluvo (0teenmo3io1fa  li s;s0 rumirpoo1alt licia( sDra(mp;o4tptnmieias aDuluvsn(0 rerxo oydoptelivilt) 2uo(rpiydal  lies t) Dur(rpnu4tleomiciysfm ea(ms t0trtrxf iatopD au sls0srtrio3oy1lm emfetlt srrrumoou4apxoii3tysfmDem(mo;u0trxnmo3iydop r nvs s)tetr(opny1ll nmiet () Dtru oou1aptnmictltls rl(mo;u)alenxr3tatoa elnes s0t2trxr3nydlpenlietas)a2ta(mpou4tle  feiad a eluvpnt4tltrir iatfmte u il(0t2umxm ny1lp nmnesl( sDuru ono0tpt iietas aDua(mp;(4 etomr3iadom   ieols srurxo3nu4op nlfvs ( arurumpoo4oltnmictatlmDumuvp;t)trenxr tatlpt lnvs t)t2xm(rpoy4lpe lncil(fs2uau  ;u1aeenio3ild a eau onu0tlxrxoctodfpDraieilt0t2uoirpoudalee fvils)sDuau o;t1apt  feiad a ulu on()tltrir oatlm   neo;t0 2xrxo no1amt livs t  Drrurp;u1tle iiciyt m ul(vs () rxnmrciy1omtranei t trumxm iy4al nmfeilsf rta(  ot1tlx  f3tat m2em(mo u4 reoif3iydla r i i t0 rtr(o3ny4ole  fcil(  rtmxmpno1opx  f3iasls uanvo ()tlxrxr3todlpDe ueols seumim3iy4lm eliviat  2rm(mpnu1tptoifeiatfsDrlnmpnu0tltniociadlptrauvs (0t2to(o3no1op n icsa()a2rm(mpnt4opeoifetat s emu p u) ltnir3iydoaDr n sls) exm(o3ny4om  lncslsfsDua(m nu4oltomociltfa2uln p;u0arxomo iytlm r uvs s t2xo(r3io4amt lfcs ()srrr(r ou0optomi3tldfm2um(vs u0tleoifcoy1fmD  nvs;( teum(o3ou1lptelneilt a2trx  ou0aptnmiciltla2elu snt4tleoiociotlaD  nvslt)t2xrxo iodomtnmivils sDumxronu1ape  fcilsla umumpn(0 etoifcootoaDean sls0t2um(r ou4lm emfesl()srta(  oo0ope if3ildfa eln on(0 rxomr3tytoa  auvsl( t2uoir3nydope mivtlt srrm(mpou0apeomfeiltlsDumuvs (4tltrifctotlpt lneo;t trtr(r3nodale lict () 2uaxr ;o1tleomietlsfm rl( s t) etrxfcoy1fmte uvslt) 2xmir iudame miei t sruax oou0oleoiiciadfm2el( s;(0aetnircoydlmD lu s (  rurxo3ny4openmiesltfsDrau o;u1tpxnmfeiad a2umnvonu0teeoxf ootoate ies t0setmxm3ou4ope  fcias)arumxmpnt0alx  ociytfm2ranmsn()trxrmocoadfatraneo ( seuo(m3nu4al  livs () rua( pnu1tex  octyt a rlnmp;(4trtomr tydom  au s;s0 rtr(mpoudopenlivtlt arum( pnt1olt ifctlt m rl( sn()aeeomo3iatfm  lneil(0 2to(rpoydlptnmiei t)arurxm ou4tlen ietadfm2rmnmp;u)trtoirciodoaD au s;s texmirpou4ll emneta(faDtaumo;u1teeoio3iyt a emnmp;t)trxoifctytoa elu o (0trxo(m no4ll  mnvsa()aDtm(  nu0olx  iciatfsDuaumon(4aetnifctodop rln s;s0t2trxmpoo4apt  nesl(fa2umxro;t0tlxoifcildfs rlnvo (4 etoxo3todoateaies;s0 rxm(m nu4lmenmfctasfartrx ono1alx  ieiydlaDrmu p;t4alxoxr oa1om rauei;s0 euoxr3nudapt  fvt s a2urxmpoo1opeomo3tlt s uluvp;u0aetomf oo1latr uesls0texm(r3iy1amt mnctl(faDrr(r oo0olxnmociltls2um(ms (4trerir3todfptrlneils trum(o oo4amee nctatfaDrm(moou4opeoifciyt s ea(von()treoifciatoa   nvilt)t2uoirpio1ome  nvia() 2trxmpno0aex  o3iadfaDemumpn()trerxo3iadfp  auei;s)trxmir3oy1ol nmfvi ( aDraump;o4apxnmo3iasfs2el( o;u0aexrircoodfmteluvs;t0 eurxopoydlmtnmivtas) rrrxr ou0alen i3iltfs raump;t)texrio3oytlmDr ueo;s)s2xm(mpiudalenmfei s s2ra(rpno1oleniiciyslm2ulu s;t)alxoxo oodoaD liei;s seum(m ou4am  lfcs t) 2rmxm ;t0oet mf3tatfa2emn o t0artnirciotlaD lnesl( seto(o oy1olt liesltfsDur(roou4oltnmf3tyt s ean p t)arxoirciy1fpt ln ols t2xm(mpnudome  nes sf 2ur(ro;u1tpxomo3iatla2rluvo (0arermr oydfa  lieo;s setoim3nu1lptn feta()sDtr(mp;t0olt  o3iad s rm( o;(4arxnxf io1lpDean i;s)s2xrim iu1lmeemiesl(fs2trurpoo4tptnmi3tasfm2umuvsn(0arxomo3oodoatrlivo;( seuo(r iu4llt  feil( s2ta(r ;o0tlto i3iyt aDra(vo;u4 leoircoadop r ivolt setm(r3ny1ale mict tfs2uaxmpnt1texnioeildfm2rmu o (0 lxrmr3iatlaDrluvs s  2urio nudap n ncta(f 2umxm nu0aeto feiytlaDeauvsnu0teerxo iadfm rliei s sexoxmpoodllt lnvi (  rrrxr ;o4opt  i3ilt m2elu o;u)tltnxrcoydom r i i s  eurir ny1opte ietls) Dtaur no1apx  oeiytfm2eauvsnt4 rtrxfctodfmtr uvo;(0seuoir oydam emietasf Dtauroou1apto o3tltfa2el(vp (0 leoxfcoodomtr ivsl( tetrxm3iu1lptnlies ()a2ua(mp;o1alt ifetltla umu sn() lxrxrcoy1fa eln i t) rxmxo3iodolenlivt sf Dumxmpnt4tpeoio3ilsls2eaumon(0tltoxf ty1oateanes;s)t2umxr3ny1aptemivia()aDurxm ;u0tptomoctyd m rlnvs t0 exnmo ia1lm  au sls s2xoxr3oodaltnmfeta( a2rm(m ou1opeoiictlt m2umnvonu) rxnxfciotfmt au o s) 2toirpio4opee ictlsf rtauroou4opeo ieiytlm2emums;t0trxoifcoo1fpt anei t0 exrxopoy1lpt  ivils) rtmumoou1oee  fctasfaDuan pnt0tltnxo oadfmDrlieslt t2xmxo nydlpenmictlt  2rrx o;t4oeeoiieiad s emn pn(4 eeoxo iadoatrli i;t0teuoio3oodll nmfcsa() Dtrur ;o0oexnmocias s2rl(ms t)aetrxf ootopDr n ols0texo(r iy1lm  mfvias)a2ururpnt0oltoif3ildfa2el(vsnt0 reoxfciytopte neo t) rtmxopiy4lpeemicilsfaDuaxmpno1aex mfctasfa rmuvs;t0tltomf tydomteau i;t  euoxopoodap emiesl(  2rrxmoot1tlxniociyt aDelumon(0 rtrxrcoydfpDr i s t0srxm(m no1lm nliei s  rta(rpoo4tet iiciyd m emums;u4 ltomr oadlm  livs;( seuo(r ou4op n ncils  rurum oo4apx  ociys m2rau on(4tlerxr3tytfaDe ues;t s2umir oy4am nlfvsls  Dra(mpoo1opto ietydfsDulu ont4 ltoif tadom rlnvs;s teurxo3nu4lp  lnei t)sruax p;t4tltnmoctldfm rlu s u4teenmf3iy1opteai sls seuoxo ou1ll nmncsasf Drmx  ot4ale  fetytla2rlnmsnt0trtnmr oodoaD lu o;s0 rtr(mpoo1lleemnetl( s2urx ont1oltomoeiltlaDea(vp;t)altoif3tadfaD livs s)trum(opio1op nmneilt)aDtrxrp;u4opeo f3iasls emuvsn(4artoxo iy1fat aueo t0t2xm(r3no4omtemnei tfsrrm(r ot1olxoioetyslmDel(vs u) reoif3iadomtraues;s)trxr(o3iu4lp  livs ( arumxront4alen o3iasls2rau s;u)texomocto1oa  li ils)sexoir3io4lmt lfet sf Dumxmpnu0apenii3tytfmDra(mp;() exnmfcia1fat luei s)sruoxr3iodalenmics s s2ra(  ot4opxnmfcilslm2elnvo u) exnxrciadlp  luesls)t2uoxrpou1ame livsat a2rmur oo1oltnifetldla rl( p;u0trxrxf oy1fmDe uvs;s texm(r3ou4olen nvtl( sruaxmo;t1olxnif3tasfs2rmnvs;u)tleomo oytoat livslt srur(r3oo4ll e iet sfa2rax poo0ape io3tytfm ua( onu)alenir3iatfptrln slt0srxoxmpny4lpenmfesls  rrrxrpnt4tlenmociys s ea(vpn(4teenio3oodfatelivs;t0setoim oy1llt lfvtatf 2tr(mpot4aptoio3tys a2ea(mo ()artnif3ia1fate i s;( texoxr3oo1apeelnei (fa2rax poo0tet mieiyt a rln s;() exrxf3oa1optelivo;s  rxmxopnodamt  ivils sDraxmpou0opt ifeiadla uauvsn(0trxnmfcoo1lmDelu s t)setmim oydop elnetlt)aDurxmp;u0oee  iciysfm ua(vp;() rtoxocto1lm  aivs t0texrirpio1amtelict tfs2tm(mo;u4aptnmicild mDemumo t0texnmrcto1lmDrauvols0 rtoio3iy1omtnlfes ( sDrrur ot1alx  octlslaDum(ms;u)teenxo tadfm ran sls) etoxrpiy4om elnvi s srrmxm ot1oexn f3ils aDulnms;(4aexnxf3iotfptraneil()tetrxr3iu1al e nvils s2taur ;o0tltomociad a2em(mo t0arermf3iatlmDeaueils)srxrxm nu1op  miesas)sDrmxr ou1tlxomo3tytfs ulnmsnt0teeoircoatlm r i slt  2trxmpnodamt lieta() Drau pnt4tlxn fciaslmDuln onu4trxnxf oytoaD aueilt)s2xmir oy1ame livil()a2tmx  ;t1alxo feild m2rmnvsn(4texnir3iotfm  au ilt0sexrxo iy1al elfes ()a2raumono0apx  f3ildla rln o;(0teeoxr3to1fpDrlnvo;s srxrir3ou4ol emiei t s2raxr ;t4oexomi3iltfm rmn p t)aeeomrcta1lmDelueslt) ruoxr no1apt lncsa( aDrrxm ot0oet io3iyslmDrmn p;t) leoif tytfm ranvo;s) exoxr no1ol nlnci () 2tmumo;o4ole  f3tyt a2em(vp;(4tetnmr3oy1oaDranvi s)t2uriopio1ol nmfvil(  2trxm ;u0tptnioeiat sDrmumo u0trenmociytlp e i i;s t2trxmpny1om  lfvtlt)aDrr( p;u0ope moeiydfaDuaump;(4aetomfcta1omtrau i (0t2tr(m oudoptnlnet (  Dtrumpno4teeo fetatlaDul(vp t)trtoxo iy1lateluei;( srurir3iu1amt lnvsl(f 2uax  ;u4aexoiieiat s raumonu)aleomo oydom  lneol(0 eurxo oy1ome  ivs ( s2urumonu1olxo fciyt sDrmuvp;t0areoxo ia1fp e n sl(  euoimpoodomtnlieia( srur(mpnu1alx mocias mDeln pnt0areoio3iatfp r i i (  rtrimpno4optemnctltfsDtrumooo1alen o3iat sDrluvo;t)tlerxo3todlaDrau il( trxo(r io1lm   fesls)arumxmpot4oexnii3iltlaDrlnvp;u)aexrmf oadlm e u ol()t2umxmpio4lme lfcil() 2rm(r oo4oee  ieildlaDemnmpnt4 rxrxoctytoa rliei t0srtmir3iy4olte neils)s2trxm oo4apen f3iyd a em(mp t4aexnif oydomDean i t) etrim3ou4lm   fcil()sDua(moot4tet  o3iad a ulumo t4 rtrxrcoodfmDeaneo s)truoiopnu1ol emnvs tfs2raxr ;o1olenioeiat sDelu onu0alenirciy1laDrluvi (0teum(mpnodlpen fetlt) 2rrxm ot1olt  iciydfa ulnmo (4arxrmo oytlmtrln i;s  rxoio3oo4lpe lfet s s2urur no0tet  ieilsfmDrmu o u0 reoirciatfmDranvolt0s2toiopiy4llenmivs t sDrr( p;t0ale io3iatfaDem(ms;t0teenifcootlaDr ivs;( s2xoxo3iu1lpte nctl(fsDumx onu0aeeo o3tytlm2ulnms;u)aeenmf tydop r ueol(  2toimpoo1ll  livia(f 2urxr nt4tlx  ictytfmDea( snu4aetrxf3iydlm  luvs;t s2toxr3iydolte ictl()s2ur(mpnt4tle iictltfaDulnms t0 renxfcoydopDeaivs t0s2tm(m oodlme  ivsl() 2umu poo1tlxo octlsls um(monu0tetrmo oytfmD an o t srumio oy4lpe  ivsls  2rrumo;o0tet mi3iatfmDum(monu4aetrioctydomD lnvi s  2uoxmpiy4olt lfvslt) rtmu oou0tlxoifciydfa2umn p;u)treoircto1oatelivs ()tetrxm3iydalenlneils) rua(  ou4opeoif3iat a2ulu p u4alxrxf tatop  lu sl()setoxrpio1lptelfcsls) Drr(ro;o0olxomi3iydfs2elumo;(0alxoif3iytlaD anvolt0teuoxm3no4lpenlfctas)artmx ont1teeo i3iadfs2uan p u)trxrmf tydlpDranvo;s) rxoim io4lpt micia( arur(m oo1aee ifeiyt a ranms;()texrif3oa1fpD liei t s2umir3ou4ol  mieslt  Dumx  no0aleoioeiytlm rmumont4 lerxo ootopteaivs t0 2xr(r iydole lfvs ( sDum( ont4teto f3tatfmDrauvont4tlxrir3io1faD luvo t0sexrxr3nudll e nvs ()aDurxroot1aeeomf3ils aDel(mp (4teerircia1fp   u o t0 eurxopoy4ll nmfvsl( artr( p;o1teeoioctydlsDua(vsnt)artnmoctotfm e ues;() eumxopnydal n ncs (  2urx pno0altnmf3iydlaDrlnvp;u)altrifctydomte ieo;()t2xr(r nydal emivils artaxmpno4aetnmfcild a2emn sn(4 etnxocty1faD au s;( tetoxr3nydapenmfci ( aruru pou0tlto ietysls2elnvonu)teenif3iodfmD  uvi s t2umim3no1oltelictl(faDrrxrpoo4tex  o3iydfa uln o;u0aetrxf ia1oat anvs t s2xmxr3nu4oltnmnvilt)s2tax  nt1tlxn fciadlm2elnvs;t0 leoio3ia1lpD  ivi;t0texm(r ny1lm nlfcsa()srtauroou0apt  ieiltfs em(mo;t0tetnmociatfptrlieo s  rxmxr io4llenlfctat)sruau p;o4olx moeild a2ua(mp;(4alenifcty1fateauvo;t texmiopnudape mnctls a2uaur nu1olenmoeils mDrau o t4altnir ty1lpDrauesls texmim3nu4lpeemnvsl(fs2urxmoot0ope  i3ildlm umu s t) ltnxo3oa1lp e ies;s texrio oodop  mnvi t)a2tm(rono0tpe iicildfsDulums;t)tleoif3iy1oaDean o;t0seuoxm3ou4altnlncsas) 2tm( pnt0tpx  i3tadlaDem(msnt0tltoxf iydfmtranvo s)texoxrpoydopenlfetas aDtrxm ;o0aexnmoeilsfsDulnvs;(0arenxf oy1oaD aueilt0 rtr(opoodlm   fetls  rtr(mpou1apeoif3iyslm ean s;u0trtrmf3tytlmtrau s;()s2uoim3no4op emfctls s2ra( oou4optniicilsls2ul(msnu0alenir io1lateli s;s0t2tm(r no4omt  fvtls  Drm(m no1oeeo f3iydlmDrlnvp;u0alenir3ootopt ln s;s srxoiopnydam e nvsa()srtrurpoo0olx iocilt s2elnvp;(0aeerxo iytfpD lnvs;t)t2uoxm3ny4ol e nctas  2ur(ront0optomfetadfs em(mp;(4alxrmr tytomt  n sls0s2trio ou4om emictl(fartaurono4opxomfeiysls2emuvp;(0 rxomrciodom raiei t  rum(r3oodapen ivsls)a2urx  ot1altniieiad a emn s u4areoxocoy1fpt aivs s)srxrim io4lp  lnesl() rrru pnu0ape  f3tys a2rlnvpnu0 eeoif totfpD aies;t)sruo(r3oy4aleeliesls sDtrum ;t4olxnmi3tasfa rmnvpnt4 etoxo oodlp  ln slt truoxrpnu4omee nvsas  ruaxmp;u0ape iicildla elu s;t)alxrxr iotomDrlneolt)tetoxr3oodomt  iet t s2rrx p;o1tlx iicild m2em(mpnt) ltnirciatfa rluvil(  rurio3nydapee fvt t aDraumonu0tle if3iytfaDeanmonu0tltrmrcoytla rau o;(0 etoxm3ou4ape  iei s)aDrmur ;u1apx  ocild s2ul(vpnt0artoio to1latrln sls0 2xoxopiudap nlfvta()artrxmoou4tetomfeiatfa2rauvsn(4trxoxrctotomD luesl(0 rtrxo3ou1ap e ivtlt sDtrxmo;t0aetn octydlaDemnvont) eerxocoo1oaDelivs () ruoxo oo4lme mncslsfsrra(m ou4tlxn oeilslm2umn sn()tltomrcia1oaDe nes t0 eum(r3ny1apt  nei ()aDra(mpno4tee mf3tysls2emumsnu4tetoxociotfaDeluesl(0sexmim io4ol emnetls)a2raxrpoo1tet iietyd mDemumo;t)tlxomfcty1oa r uvils)texr(rpnydalenlneia(fsDum( o;o4tle  f3iytfaDel(mp u0tleomf ia1lp ran s;s0 2uo(mpiodop  mfetl(fs2ur(r ;u4aptn f3iytfmDeanmp;t)trtomr3oytfmt  ivslt0trtm(m3iu4lm elieta( aDrmxmpnt0oetoioetldla ra(mo;()texrmociydlat auvol() rxmxr3no1lptn ncsls)arta(rp;o4tpxnmoetltfm el(mo;()tleoifcoadoptrlnes;s0t2toiopny4lmenlfetasfsrtr(m oo4apx mi3tys m elnvs ()teerxrciy1oateau o;s)t2umirpnudap nlncsat) 2rrxr ou4aleoio3ias a rmumo;(0texnif iodlmtrlieil()texoim oudop e fetls)s2rmu oou1alenmo3iadfs umu o;u)altomfcoydlatraueo;t0t2tm(opoydal emfetltfartmurpou0tlxnmfctyslsDrm(mp;t)tltoxf3totlmDe uei;t  2xmim iudap  mivs ()arra(r no1texn f3tytfaDelnvo;t4arxnif oatfmDrln o (0 rumirpiy4ap nmietltfsDumxr oo1teen f3tltlm2elums u0tltrir oytop  lueo;t s2tmxrpio4lme  feias s2tr( pou0aexo ietltla emump;t0trtrmr3io1faDe nvo;t0 2triopoudol nmneia(  2urx  ou4olto o3tatfm2emu pnt)trenmfcty1omtrln o;( srtmxo3iydoptelnviatfartaumonu0aeen o3iys s umn p u) eenxo3iotom rliei t0 rxr(mpio4ll emncsas) Dumxr ;t4ale  f3iadls uluvp ()tlxrif3totfpD lieolt  2uriopoodlmeelnvtltfsDtrxro;o0alxo ieiydfsDrl(vont)aeenif3ty1lmteai s s trur(r nudllen nei tfsDrru pnt0tpenmfetyt mDuauvs;u) eeoxf3todoa  lieol(0trtm(opou4omeemfvtl(fa2tm( ont4teto feiltfs2rln o;t0arxoxr3iytom rluvsl(0seur(rpoo4lme mfetasf rumxrooo0alenio3ilt mDel( s;t) rtnxo oadoateli sls) 2urxr3ou1ol nlieiat s2rrx pnu0optnifciltfm2ua( p u0tlxnmr to1fpDrlnvsl()s2xmxo3iy1om  mfeta( a2ur(  ;t0alx iictatfsDea(ms;()artnxf oo1lateanvol(  exmim ou1alt  fes t)aDrmx pnt1tex ifctytfa2eln s;u)trtrxf3tydla  luvils0trxoxr ou1al   ieslt)srtmxmpou1alxomf3tydfm2rm(mo;t4 exniociytomt ln o s  2xriopno4op emfciatfs2trxm ou4oetnmfeilsls um(vp;u)alxrxf3oo1omD lnvs;t) rur(o ou1lltelnet s  2taxm nt4tle  ociydla2rmn ont0alxomf iy1fate i o;s0s2to(o nydlle livsa( sDua(rpno4tlt miciydls2rl(von(4alxnir3totlpD aues s0srumxm nodlpt micta()aDuru  nt4aex  ietysla ean s u4arerxr3oo1fpt  uei s0s2uo(r3ou1llt mfesl()s2rmx pot0apxnmi3tytfs2emuvp;t4aleoir oo1op  anvs (0trxmir iodope mnvs tfaDrm(m ;t4alenmfctad m2rl( s ()tltomocoydom r uvs;s0srxoxmpio1lle lnvs (faDtmxmpoo0opt  fetat a el( sn(0 rxoifcoodfp   neil(0 2uoio3iydamenmnvsas)arurx o;u4olto fcild aDeauvpn(4areoio3to1laDr i o;s  rxm(opou4lp nmnvs () rrm(r no1tptnmiciltlsDel(mon() exoxf ty1op eluvi;(0srxmxm nudam nmfcs sfaDta(root4apto oeiysfa2rlnvon(0altoxf3oa1oate ieo s0setm(o iudomenlnes (faDtax oot0tle iociasfa2uaumo t) rxrmf ta1oatraivs s seurio oy4openliet sfsrtaum nt0tpeoii3tat m umuvsnu0 lxrxociadomte nvil() etoimpnudamtnlnci s)a2tau ooo1alto i3tls a2ranvo;(0 lxnxo3ty1fm eli o t)seuoir3nu1amen neiltfaDur( pot1aeenifetlsla em(mp () exnmr3iotopDraneilt) eur(o oodlpe mnesas srtmumpnt1tleo fciatla ra( on()artomr3totlaDran i;s0 rtoxm nodolte ncil(farumumo;t0apto fctytfm rlnvo u4arenxrcio1opD aies t tetrimpiodameelneiasfaDra( o;o0oeenmieiytlaDemnmon(0 eenmo tytop rlivilt)srxmimpnu1am e fvt sf Drm(rpou1tpeoii3iyt aDum( s;(4texomrctatomte neo;s)s2xmir3oodop nmictas) Dta(rpot1alenioctaslm um(mp t)aeenxf iadfa elivsls0sexmim oudlm   feiatfs2ta( pnt4opx mieilt aDuln s;t)tlxrircia1fpDeauei s0 rtrxm oy1lp   ieiat) rur(  nt0ale mfeiat a2ulnvp (0 lermr totfmDrlivo;s0 rtoir3iudap   nvi t a2ua(  ou1tltn f3iytlm ulnvsn(0tltrmrcio1omtelnei;(  rxoxopnu4llt  ieta()s2raum ot0tle mf3iadlaDran s u) exrmo oytla elu s;t t2toim3ny1olt  ivtlsfaDumxrpot0tltoif3ild a uln o;u4tetnmr iotopt  nes s0t2xrir io4omte fci t) rrmx pnu0alto oeiasls em(mon() lenir tatoaD  n o t) eurxo3iu1opeelfei s) Duaumo;o4alx mf3ildfaDel( s t)altnir oodlpte u ilt srumxo nu1op  mnctlsf 2taxro;t0aeenmf3ilsls2elu p;(0tleoxf tatfmDeli o;( setm(m3oy4opt mivi (f rrrx oou4aee  fetaslmDea(mpn()artoiociy1faDr u o;()teum(o ou4altnlfctatf rtm(mono0optnmf3iadfs2um(vs t)tleoxo3totlpDelieols0sexoxm3no4am elfvias  Dtaxm nu0opx mf3iatfm2uanmsnt) rxnmr oatlpt  ieo () eum(r3ou4al nmncsatfsrrrx p;u0oltoifctatfm2elumo ()tltrif iydlm eluvi;(0setr(o oo1al e fvi (fsDumu o;t4oee iietlsla eln s;(0tleoir3ta1oat ai i;t)t2uoxopno1om emncsa(  2tru pnt4apt miciadls2ea(mo;(0 etrif iatfpD lueslt0 2toxmpnu1omee fvsl() 2tr(r no1olxo feilsfs eau p;t0altoxo3oodomteaieils0srxoxm iydll nmfesa( srrm(rp;t1alx  fciltfsDul(ms;()tlxoxoctotom eluvo t  rurxm no4llee nvsat  2urur ;o4olto feiytlmDrlu p t)alxnmf iytlaDeln o;()seurimpiu4ome mies t  2uaxr no1apx  f3iasfs ea(vo;t)artomrcoytopD liesl()t2xm(m3oudolt mnctlt)srrruroou4aex  octydlsDua(ms (4arxrxfctydopD  i i;() 2xmirpiudlp elfvsltf Dtru ooo4aptnifeilsla ua(von(4trtoio oadlp eaies () eto(r3oy4am n iei s  Draxrpot4oltniieiytlaDum(vo t4aetrif3oytomD aueo;t) 2toxr3iy4llen fvs tfaDtmx pnu4tle iieiytfm2eauvp;(0trtrxocio1lmDr neils)texm(m ou4ap  mnvtat srtmu poo0tptnioeiadls2em( ont4teenif ty1fp ranvo s) rurxm oy1op nmivi t)arur(mpou4olxomiciys s elnvp (4 lxniociodfaDrai slt)tetmim3oo4olt mfesat)sDraxr ot0oee ifciyt m ul(vp;(0artniocootlaDeaneols0sexrxr io1al  lfvs ( aruau pnu4oex  f3tld aDrau ont0tlermo oa1faD  ues;()teum(m3no1lp  livi ( aDumumont0opxn oetas sDelnmp u)alermfcoydlpt livil()tetoio3no1ame  feilt)a2trx  ot4ape iiciatlaDemuvp (4 lxomrctytlpD lieil( truoim oo4am e ivs ()aDumumpoo4tlenmociat m2rl(mon() rtrmf3iydomtrauvilt texoxo3iudomeemivil(faDraum ot0teto fetatfaDuauvpnt4aexnxocoo1fpt aieolt)srxoxrpnudamte ict sfsrua(mpot0tlt  f3iysfm2ul(vpnu)aexrxf3oo1fpDr nvol(0t2xmxr3nu4lmenlicsltfartmumont1apeoiocilt m2em(mo;t4tlerio iodop  ln ols teurim3nu1amtelnvs s)aDumur oo0aexo f3tld mDra( onu0aexoiociatfm  ai i s t2tmxm io1ll   nctlt)srtaumpno0tleoiociatfaDrln s u0aeeoxr to1lpt li olt0 rxrxm3oy1lm emieiatfs2ta(mp;o0olenmo3tas aDumn s;(0 lxnxocoy1laDeliei;() 2tr(opny4amenlnei s)sDtmuronu1aeen ieiatlsDum(vp;(0areoxr iy1fa e u ols) rxoio oodom  mnvt s sDra(mpno1oltn octyslm2rlumo;() lerxo ta1faD  nvils srtm(m3iydom   nct s  2ur( poo4texnmoetat sDua(mp;()aexoifcto1om r ieils)t2xoxr3nodap nlieil() 2taxm ;u4opt ioetas sDum( p;()texnioctydfmDeanvs;s)texo(m3ny1ll elnvtls)srur(m ;t1aptoifeild s umu s;(0 exnxo3ootlpDeaivs ( tetrio iodaleemnei t)aDtru oou4tptomi3iyd s uau s;()tetoxo3oadopDe i slt)seuo(mpoo4llteliesl()s2rrxrp;u0olenmfetlsls2rmu o t0tlxoxr tadopD  i i;t  2urir3oy4omeemfeilsf Dtax o;o1apeo ictltfs emums;()aleomrciydomDr u olt) rtoxo iudoleemneiltfsrur(m oo0tlxn i3iatfmDum(vo;u0alenmfcoodfmte ies s)trxmio oo1omtn ivt s aDrrumont1alenmfeiltlmDrmn s u0 rermfciodfmD livols0 exrio no4ame mictlt) rra(rooo0teeo octyt aDuanvont0artnir oatlat aivols0tetmxo no4opee ictatfaDtrur no4opeoiieild sDeln snu0arxrmocto1oa rli slt)s2toxr io4ol e net () 2uaumpnu4oex  feiyslaDuluvo;t0arxoio io1omte i o;(0trxr(mpoudlm elnetlt  rtrur nu1altnioeiadls2rl(mpnt4alenxrciadop  luvo t) etm(r nu1omtnlivtlt)arta(mooo4tleoif3tltfm2rau o;t)teeoxo3iydfpDeau slt0setoiopoy1lmenlivtl()aDrrxmo;u4apto f3tydla el(mpnt4arenircoy1fat aneo;s seuo(opio1lpee nctl(  2tmu oot0olxoioctls sDulnmonu4texrxo oydlm   n ilt)srxrir3oo1oltnmnvtlt) rrrxmpou4alxnmfeiltfs2emn on(0trxomr iydlm e nvolt0 eto(o no4op elfvtatf Dua(roou1opxomiciytfm emnmp ()aetoio3todlmteau ols)seurir3ny4opt lnvsa( aruru  oo4ape  i3tatfs rl( pnt)tetrxrciy1omDrli o ()trxrxmpiudapen fei (fa2taxr ;t1texnifciyt s2rmnmsn(0alxoxo3tatfpD livi s) 2tm(rpiu1lmt mncs t s2tmxrpno0teto ociysfsDemnvsnu4 eeoxo3iytlat ai ils)trxm(m3oo1lme mfvsa( sDtaur nt1aetn o3ilsls eanvp t4tetoirciatfmDelivs ()srxrxm3oo4ape lieslsfsrtmxm nu4apenio3ild aDelu s;(4 etoxf3ootfmte iesl() 2urir ny1lpt lfeslsf Dtmur ot1tpenii3ils m umnvpnt4artomr3iodlptran o t  euoxmpiy4ame lnctls sDtaxro;o1tpenmoetyd aDumn snu) eeomo3iy1oa elieo;s)sexo(m nydlpenmfctls  2ra(ronu0aptomoeilsls2ulums (0 eeniociydlp eln o t0trur(r nu4ap emfctlt s2um(rp;t1aeeomf3iyd a ul( s t)artnmrctydopteli o;(0 euoirpoudolte fci t aDtaxmoou4texo o3tad a rmump;u4 lxoio3totfmDelu slt t2xmxmpiy4ap  mncia(  2rau p;t4alxnif3iltfa2eau s;() eerxr todom elivolt0srurxm oo4lp e fvs t)s2umxront4aeenii3iyd m um( o t4aeerxfctotoaD aivsl( s2uo(m iodalte iciat) 2rrxmpoo0texn o3ilsla2ulnvs t4altoxo3ia1fat livils trxr(r iu4ole  ncia() 2tr(mpot0aet  oetlsla2rmnvs;u0trxrxr3oydomDeai ils)s2urim3oo1op  mneiat)a2tm( oot4aex mfciys a2ran o;(4aeermr3iy1om eau s;t0tetmxo3iudol elics ( srumxronu4tlenif3iadls2ua(vo;u4 ltnxfcto1om eli s;() 2urim3ou4lpenlnvt t) Durxmo;u4oexo oetatfs ea(vs () ltrxf3ty1fm r ivs;t)t2xoiopno1om e nesa() 2rru p;t4tee mi3iltls ean o;u4altrmrcoadop elivi (0 rtrxm oudop  mies tfaruau o;t4olto f3iad a emn s (0 lxomfcoodfmteau s ()teuo(r no1lm emivilt)aDrm(roou1alen ociadfmDrm( s u0 lenxf tydopD  iei;t  exriopio4al nlnesl()arrr(r ;o4aptomf3ils s2emu pnt)trtrir ty1oaDelueilt0 rumxr oo4om n ncs (f 2umum ou0opxoifciyt aDuanvs;t)tleomo oatlmt  i ilt0 2um(o iudolenmicils arrmxmpnu0teto ocias mDra(vp;(0 rtoir3iodlm eauvs;t)t2tr(mpiu4apt  ivs () 2rauronu0tle mi3ildfs rauvpnt4alermo3oodlptr ueo ()t2xo(m3no4optnliet s) Durx  oo0aetomocildlm elu p t4teerxrctadfm eln i s)teuoxm iydomtnlietlt  Dtmx  ou0tlto o3ilsfmDemums;t)aetomr iy1oateauvo;s setr(opno4lle mfcsltfarumxrpou1apxomo3tys sDeaums u4 rerxf iotlaD auvsl(0 rumxopnodlpe livsl( aDtm(r ;o1teeo i3ils a uanmo;u4 lerif iatla rlueo;s0srxoxm iy1oltnmfetl( aDtrxront4tle  feilsla ranvp (4tltoxf oatomDelu olt)t2xmim3no4ope lnvilsf 2rmxrpno0aeeo f3iydfs emnmp;(4 eerifcoydfa r iesls srtm(o3iy1amtn ivtatf rumurpnt1apenmictytls rmnmpn(4altnmfcoadlpDeli s (0trxm(mpou1ome lfvslt)s2truronu1oeeniieild m2rmnmo;u) eerxr oy1oaDeluvi;s t2tmirpoo4lm  lfeils) Dur(m ;u4tptomf3iyslsDrlums u)aetoio oy1fm rln o t0t2uoxr io4lpeemfci s s2ta( ooo0tlxn fciatlsDulnvpnt4altnmrcoadoptr u o s0trxr(o3iu1op   ics (f rrrx ooo4apxomf3iydla2um(vs t4trxnxfcia1fm rlu ols0 exmxr3io4lm elfcsl() Drrxmpnt0olxnmietldlm2rmnvs;u) etomrciotopt an o s srto(r nodameemnci t) Drmxronu1aptn i3tydfaDel(mon()arxrio3tadlpDrauvo;t)sexrxrpiudll nliet t)artr(ro;u0opxnmoeiaslsDrl( snt4 lxrmfciodom   nvi;s0 2toirpnu1apeemfvsl()sDua(mpou1texo i3iasfa eanvs;u0 eermf totop e uvi s) 2toim3oo1lltemnetat) 2urur ;u0texomoctls aDranmo t)aexoxr3oo1oa  auei;( srxoir3nodaptemfvs tfa2taxmpnt4openifctys s2eln p;t)arxomrctadlp r nvi (  exr(rpnu1lp elnvi tf Drm(m no1opxnmi3tyd s2em(vp u)trxrmr iytfp raues ( t2urir3nydlp   ivs t)srtrum ;o0aet moeildfmDumnmo t0 rxrxocoydlmDrlivi t0srtm(o3io1altnmnvtl(fs2taxmpou1tpenif3iltfs umu p (0aetoir3iytfmtrauei;t s2toxmpnodam nmnes (  2ur(mpou0oetniociyt aDuanvpnu4trtrxf totfa r uvi;(0 rtmio3iu1om n ictl(faDrr( ont4altoif3tysfs2uanvp;(4tlenmo3ootlmD auvs;t)t2xrim io1oleemietl( srrauroot0tpxomieils aDel(vont4texoif3iotomtr ueo;s)trum(o iydoltnmfesl()arrmxmooo1tlt mfcils aDemnmo t4artnif tydlpte u o s) etmxopou1op  mneia(farurx  oo1ape mieiatfa2rlnvs;u)texnmr3tatfptr ieol() ruoxr io1olenmietas  2ta(mp;t4olx  octlsfsDel(vs;u0 renirctadfaDranes;s0sexoxopoydamtnlfetl(f 2tr(  ou4olenifetydfs uan o;t4 etoio3oodfatrauei t) rumxo3no4al elfeta( srtr(m nt4olt  o3iysfm2rm( s u)arxomf iydlm  aueo ( s2tr(opoy1ope  ncslt) Duaxrpnt1optoiociytfsDumnvs;t4 reoxr oadlpD  ues;( srxrim iudale mfcsl()a2ua(mp;o1oetomoctls a2ua(vo;() rxoio3oydopteaivols  rtoir no4lptemfeia( arurxmonu1aet moetad a ra(mon(4altoif3iytlmteluvs s0t2toim3ny1lp nmfcsasfsrtr(ront1oetn ieiat m2umu onu)tetrmo3oy1lpt lneo;s t2to(m3io4ap n ietl(  rur(r nu1oexn i3tyt aDulu o;(4alenmr3oydlaDelieo s tetoxm oodlmeeliei (f 2uaxmont0apt  ocilsfaDelnms;(0trtrir oydfpt aneo t srxoxo io4om elicsl(fsDumxmono0tetn i3iltfs umnmsnt)tlerir3ty1fa eauvi t0 rtrxr3oy1om e ncils arurxrpno0aptnmi3tys s emums;t4 etrio oodomtelueols  ruriopoudolee ivi sfartmxr ;u4oee ifetltlaDelums t)areoif io1fmD aivi;t0srum(m3oodam   nvilsfarraxrpnt1tlxomoeiytlm2em( o;u4trtrmfcoydfp  an s (0t2triopnudal nmfcs tf rtaum nt4opxoiietlsfa rl(vsnu4 lxnxo tytlpt  ieo t0trurxm iy1apenmfvia(  Dumu oot4aet ii3iydlmDul(mo;t)areomfcoydlpDe ueol(0s2xmio3io1alee ncs s  Dua( pnu0ole ifetytlaDrauvo;u0trenxo3iatomD  ues s tetoir3nu1ome lfctas) Dumx o;t4oltnmi3iysfsDemn p;u4trermf3oytla   uvols) rtrio3ou1alte fvtat artmur nu4alt mfetadlmDel(mp;u0aetoir io1opDr ivslt0tetrir3oy4lmee ncta(faDururpoo4aleoif3iytlsDra( o u4tetrmfctytfmD lu ols) rumir oudlp e nei s)aDurx o;u1apto oeiytfa umnmsn(4tetnmo3tadfm elivs;s truo(m iudam nlieiatfsDrr(rono0opxnmfctadfm2el( s (0trxomr3ootopte i o;() 2umxr3iy1aptn fetlt srraumont1tex iocilsla2rlumo;(0tlxoiocta1oaDe nvo t0srurir iy4ol e ivsls)artau pno4apenmo3iydlm2ean p t0tlxrxo io1om elneo;(0 eurxm iodal nlfetls aDuaxr oo1tlx  ieilt a2ean s;()aetniocoadoaD lu i;t sruo(r3io1amtn netl(f rrm(  oo1olt ii3iltla eau pn()teerircoydfa r nvi;t0srtoirpiu4amenmncil(f Dumumpoo1olxoiicild s2ua(vonu)aetomfciydlm r ivi;(0trum(rpno4om emfctl( arrmxm ;o1alen ieiyd s umnvo u4tltomfcoodlpD  ivslt s2trim3oo4lme mncil()s2uau p;t4texn fciadlaDeauvp (0alerxr ootfaDelnvs s texo(mpnydam elnvsas s2tmx o;u4apeoii3tlslm umu onu0 rtomo oodlmtrauvsls truoirpnodol emnes (  rrr(rpot1oee ifctat mDra(mp;()tlxrmfctytfm rauvi s s2tmim3iy4oltemicia(f rraxm oo0tpx  iciad m2rlu sn(0 exrmo3ia1fp r ieo t0t2xmim3oy4ap   fei t)sruauroot0aetniocild a2um(mp;u)texoio tydlmteli s t0 rtoxo oy1alee fct tf 2trxrpnt0tptomictys sDua(msnu4tltoir3oo1omD  uvs;(  2trxmpno1ameemfcia(  rtrxmo;u4olen fetlt m ua( s t4 etoxo3io1fpt luvs ()setrxm3oudalenlivilt)a2tmu p;u1aleniieias sDeanvp;t0arenmf3ia1faDeauvo;t)s2tmxo iy1opte fctlt)s2ta(r ;t4apxoiiciyt m ea(vont4trtrmf3oa1fpteau ol()trur(o iodamtelfet t)s2tau poo0oleoiiciydlsDrauvpn() ltnifcto1laDrliei;t) etr(opou4amtnlnvtasf Draxrp;t1tpt  fetas m2em(mp t) reriocoy1om e uvi;t0trur(o nu1amtnlfcia( aDrm(  nt4tlto ociytfa2uluvo (0texnmfcoodfptelnvolt) rxr(mpoo4amtnlieias) Duaumpnu1tpx mf3iatla uaumo;t0 rxrmo ootopD aivilt)tetmxm3oo4lp nmnvsls sDraumont1opx  oetatfs rmu snu4tltrxrcoytla rluei t  
\ No newline at end of file
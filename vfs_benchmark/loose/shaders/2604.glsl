@@ -0,0 +1 @@
+ues t t2toxopio1oltnmncils srrmxmo;u0aptoio3iat aDum( o (4trerir3tydopD lnvi ( s2trxrpoudlltnlfci t  Dumump;o1olxo feiytfs rmu s u4treomocia1lat an i;(  rtr(rpiy4lle lnvia(fs2umx  oo0openiiciat a2ulnvo;t4 lenio3ootoatelivsls teuo(m iu4am  lfvia() Dtmuront4open oetldlsDul( s;t4alerir3oa1lp  li i;(0 2trxm no1lm nlfcsls) Duru ont4ape mo3tys a uanmp () etrir oa1lmDranvols  rtmiopio1opee fesa(f Drrxronu4tltnif3tadfa2rluvo;u0trtomfcta1fpD  uvol(0s2xrxrpoy4lp nlfesat) ruaumooo0tetnifciatla ulnms u4 rxnmr3iatfpt  nvolt srxoiopnu1apt lnvtlt)a2um(  ;o0oleoiieiad a rlnmont4 rxoio3ty1lpDeluvi s trum(r3iy4om e fvt t) Dtaurono0teenmfeildls2eanmsnu)altrif tydlpDe u i t s2ur(o oodllte ncsls) rraumpoo0ape mociyd s ea(vsnt0artnmf oytomDr nvs;s t2xmxm3iodoltnmivtl( aDrm(rpoo1apt ioeilslsDrlnmp;t0tltomo oytfm r n o t)texrxo3oy1am elfes t arumum ;o1oexnmfeiysls2umuvs;(4 eermf iytfmDelueolt)tetrir3ny4lltemiet tfa2rr(mpoo1aptomo3ild a2emnmp;t4 exnxfctydlpD au o s0 2xmio nu4amt mieta(fsrur(r ot4tleo fctytla ranmp ()trxnmr io1lpDraivil(  eto(r nodlmt lictasf Drrx  ot4tee mf3tltlmDeln p;()texnio3iotop e neo;t0srur(m nudol e ictas aDur(roou1opt ifetlsfm2umuvsnu)tleoif tatfm rluvolt  2umxo ny1omtnmnetas  Dur(mont1apxniictatfaDuau p u4aetomo3todoptrlieo;t0 etmxr ny1ap  mfvia(faDtrxmoou1tetnif3ild s2umn onu)trtrxr3oatom eluvi;s  rurxr3nudll n fvil(fa2uax o;o0alxoioctytfa2ra(vs u4trxoxf iytoatrai o t)srxoim3iu4oltnlfetlsfsDrr(  ou0ope ifeildla eau pn(4aeermfcoydfptelivo;t0seuoio3oo4ll emnvils srrmumo;o4apenii3iytlmDrmnvpnu4artoirciatopt ai o s)s2umim iy1alenlivsatfarraur ot0tptoioetlsfm2ea(vp;(4 etrxfcoatfat  neil(0s2tr(o3io1amt micsat artrxr oo1oleomictysls2ua(vo ()teermrctodoa elivi;s0setoxo nu4omen ies s) Dtr(mont1tpt  ieildfa2rln o (4tetoif3oytomtr u i s0trtr(r3ny1op  mnvsas  Durxm ;u1oexoio3iysfs2emnvpnt) rxrio3oodoa  aivo ()trtmxo3nodole  ivtlt) rtrum nu4aptoioeilsfa umn s;t0tltomr tytfaD auvo;(0 exoim3iydamt  fctltf 2umum ;o4tpt  ociydfa rmump;(0teenmr iytom eaneilt trumir oy1lltelictas sDuaurooo4alxnmicias sDrau o;(0 eerirctydlp raueo s tetrxo3oydlp  mies tfaDrmxm ;t4aexnifciyt aDuauvs t) rxnmr tydlmtr uvi (0 etm(rpny1al n icias  2rm(rp;o0tlxnmicils sDra(mo ()trenmo iotlpD aieolt)sexoxm3ou1ll  lncilsf ruaumonu1opt ii3tatls uauvo t) eenircio1opt  ueslt)teum(o3oo4op  lneta( aDrm(mpou0ole mociyd s uauvont)arerirciadfp rluvsl( seuoim nu4am emfciltfa2tm( pot1optnioeiydls2eanmpnt0 etnxociodfm rlnei;t) etmio ou4altnlieslsfarrmx  ;u1oeenmfetaslaDrmumo (4arxomoctodlaD anvo t) eurimpiu4al  mict (f Dum(monu1tet  iciatlm2rmu p u) lxrxrcto1opDeai i;s0s2to(m3oudll  licsltf Dtr(m ;u4tee  fcilsla2elu p;u4artoio iotlpDeaues t0 2uoirpnydlpe  ivtas  Drauro;u4olenmieiytla2ean sn(0altrmf3io1lateliesl( sexrio nydom  mivs ( sDraum ;o1tlxomiciat s2umnmp (4 ltrio3iatlm   uvi ( trxrxo ou1lp emictasfaDuaxro;t0ale mieiytlmDemu s (0trxnio tatlptelieolt)t2urxr ny1op nlfeias) 2trxrooo0alxn i3ilsfaDulnvs;(0tetnmr oa1laD lnvi;s0t2uo(o oodlmt  fetls s2ua(r nu0tlxn icias a2um(vs (4 etrxo3oatfpDrlivs;()teto(rpiydlpe  fct s)artru poo0apenmi3ias m rl(vo u0tltnmf oydomDeaueo;t0srtrio oudol elfeilsf Dtrxm ;u4olxoio3tas mDemnms (4 rxomo oa1lp  li sls0 rtmxm nydlmee fcilt)arrau pnt0tpxo ictadfaDulnmont0texnmfcoydopD aues s tetoir oodomtnlnesat aDrm( pnt1teenmociytfmDrlump t0aleomr iatop   n s t0srxmxopnodlmtelietls arta( p;t1tetnioetlsfmDelnmpnt)trxnxrcootlmtrai ols0tetoxrpnu1op elnctl(  Dur( p;t0olxo f3ias s rmn p t0 etomfcoa1opDrli o;t srtoxm iodomtemncs sfsDtmx p;o0olx mfctltla rmumsnu)tlxrmociotom eaues;s srurimpiodop nmncs t)aDrrxr oo1apx mi3iatfs2ul(vs;u)aexoxo3ootfaDr uei t)s2tr(r iu1olen fvtatfarta(mpot0oetomo3iltls uanmpnu0altnir oa1fp raieil(  rxr(o3oy1opt lies t a2rmum no0olxniietyt aDumnvs;t4 ltrmf oytfptr uvil()trumxmpnu4ome licia(f rur(mpoo1apx io3tadfs2ranvpnt4altnxf3oytlat ai ols0 2xm(rpiudolenlieslt)srtr(root4oeeomfciad mDua(vs () rxnxfciatlm e nvolt  2ur(r3ny4aleemncilt  2tax oou0apxomfctldfaDea(ms;u4 exoiocia1fp  lnvs s0trxr(r nu1lm nmfci tf 2ururpou4optn i3iad m ul(vsn(4 leoxr iy1omtraneolt0srurxo3oy1olte ivtlsfsrua(root4alxnmi3iadfmDumn snu0aeenio3iotlatran s s0trtrio3io4op nlivtat  rurx p;u0altnmfciatfa emumpnt0trtnxf io1fp rlueol(0srtoxr iu4ape  feilt s2urx onu1altnioetyslmDulumo t)tltrmfcoatlmtr nvi;s0 rxrio3oo4lpe mfcsltf 2rau onu1aeeomfetad aDemu on(4teeomf3tytlmteaueo ( sexrir iu1lp nlfci sf Dtrx  nt1aex  oeiltlm2um(mo;() exnif3iytla eliesls srxoio3iu4omenmfvsls)srrmxmpno1aetomo3tydla2raums u) rtnir3iytlateanesls)trtmir iy4alt livs sf rtm(r nu1texomfetasfm rlnms t)teeoifcoydfmteli i s tetmir3iy4lme  neslt  rumum ;t1aet  feilslmDul( p u0aeenif3iodlmD au ils0trurir3iodlptn fcsas) 2uau  oo4oeenmociaslsDumn o u0teenxfcoadfat  n o;t  2urimpno4op nmici sfsrtaxmonu1alenmfciltls2ea(mo;t)altrio3tydlmD  ieslt teur(r3oy1amt mnes tfaDtm(r oo0aetomi3iadfm ranvp;u0trerio3oy1lmteauvolt t2xmim oodolt mncs s) rumu pno0aptn ociltfmDelu sn(4teenmo iy1laDe ieolt) rurim3ou4am elfeiat s2trurooo0tpxo ieils m2elnms (0trxrxf oadfpD an s t sruoxo nu4am n fvi () 2uau  ot1aexnmociat aDelnms;u4tetnmr3tydfp e uei t trtriopoydom e nvsl(fsrtr(mp;t0aptn ieilt s em(vont0 etrmf oodomtrai sl(0 2xrxrpiu1ameemieil(fs2rr(m no0ole mi3iydla2rmnms;t4trtoirciydoa  an i;s s2xrir iudol nmnct (f rrrumoou4oexniictlt aDemn pnu)alxoxf3oadomtrluei (0 2to(opnu1lp  lfcta( sDumur ;t1ape ioeiadfa2uluvonu0aetoiociydfp  anvi;(0trxr(o iu1lptemnvilsfarua( pnu4tpenmi3iatfaDel(vs;(4tetoxo oodlmtrlnvi;()trtrirpno1oltn nei t a2ua( onu4tltnmietld s eau pn(4trtrxf iotlatr nei;()setmir3oodol  mneils)aDumu p;u4tptnmi3ildfa uln p (0tleoif3todom  au i () exo(rpnu4amen icia(f 2tmurono0apeo o3tatlaDeauvp t4 eermr ta1opDrliesls0s2xr(o iudamee neslt arta( o;u0tpxo oeildlm umnmp t0trxoxoctydoaDe i i ( trxrxrpoo4om nlfeta(f 2rmxmpoo0opx mociasfaDrl( s (0aexnifctadfp  lieilt0srurim3nydaltnlivs ()srtaumpou4aex ioeias aDemumpnt0 lxomf3tadfm  ln o;(0srtoxmpiu4optnlfcs s aDra(m oo1tpt iieiat a2uln ont)arxnio3iadlpD anvi;() 2xrxrpoy1aptelncsl( a2um(r ot1aee  i3iasfmDrlnvsn(4alxnircio1omDelieo;s0 rtr(r no4ole  iei t) 2ra(  ot1optomoctydfsDel( onu0teenxrciadoa rlnvi s0tetrxm3nydlptn iesas) Dtmxroou1teto f3tlsla rlnvpnt4 rtoxr3iytlatrau i;s0s2umxmpio4amtemicslt  rrr(mp;t4tpe mf3ils s emu o (4 rxrmr3tatlp eaivi t0 2xr(r nu1lptn iesat)sDumur no0tetn fctadfa2elumo;u4aeeoxr3tatfmt luvsls  2xrxmpno4am n ncia( aDraxmpot0aexoifetad aDumnms;u) rtoir3totfa rai s () 2xoxopiy1alt lneiat)sDra( p;o0apenmo3ils s2em( o;t0trenmfciytomDranei (  2urim3iudaptelfcs ( srrr(mpno0tpxoif3iyt aDumn p;t)tlermo iatom  luvils srxmxo3oo1aptnlnesat  rrau poo4tlx if3iatla emn s u)teeoxf3oydopDeliei t)teuo(mpiu1omtn ictlt)s2trxrp;t1oltnmictltfa2uanvs t) ltrifciytomDraueilt  eumxo nu1lle lnvtatfs2tm( poo0tptnmf3iysfm2elumo (0trxnmr3todlp elu il()t2urim3oudom   ivi (fsrumur nt4oexnio3iyd a elu pnu4alerxo3ootfmDr ues (0 2uoiopoy1lpen ivs s)artm(mpot1tle mi3ilsfaDrlums;t4texnir tadlp e iei t)srtm(m oo1lme mici (fsrumxmonu0optomoeildlaDum( o t) rtrmo io1lpDr ieo () rtm(rpiydap nmivi ( arrr(mpot4olto ieiytlsDel(vsnu0 rtoxf iy1omtrln i;()tetoxrpio4ap n ies t s2rr(  ou0apxniictyt sDra(mon()treoxf tadla r neo;( sexmxo3iodamtn nvsa(f Dum(moot0oleoii3iyt a rln p t)arxomocta1lp eaieo;t  etmxopno4op e nct tfaDrmum nt0alenifcildfaDemuvpnu4teermrcia1om   i s s0srxoxr3oy4lptnmicsls aDraump;t4tpen o3ilsfa ran o t) renmr3oytlat au slt)t2ur(mpiudll n ivs t)sDrruro;u1altniictltla2ul(monu)artrir io1fm eai sls  2xrxm3iu1lmenlnciasfaDrm(monu1oleomo3tatlaDemump t0texnifcoadfp raivi;(0 2xoio3io4opeemfctat srum( p;u0altn ieiasla2uln s;u) eeomo ia1lpte n olt)trtm(rpnydap nlieslt  ruau  ;o4optomfetldfm eanmo (0trxnmo iatomD  ieols)trxoir nydap nlnci ( srumum ou0olxnioeiytlaDum(vs t)aexrmr iotlatrlivs;()trumim oydlmte ictlt)s2uaxrp;u0teenmociatfmDemu s (0 rxnirciodfpDe ivi;s)t2xr(rpoodal e nct ()s2taxmp;u1tetoif3iltfs uaumo;(0arxoiocoadfp ranvols) 2uoxr iu4ape liei sf 2rr(ro;o1tpeo oetat s um(vo;(4aetnir tadla  aivs (0 2um(r3oodolen nctl(  ruaurp;u1olx  iciadlaDrmnmo t4arxoifcoytla  lieslt)t2xoxo ou4optemfvt ( srua( oot1tlt  ieiat m el( s;t4texoxr tytlaDr ivo;s0t2tmxr3iydlp  micsas)aDururooo1olxomfctytlaDul( s;(0texnif oydlp ran s;t)srur(o3ou4aptn nct ( a2tru p;t1tee ii3ild mDrm(vo;()texnmociy1fateluvilt0 rxmxm ny1lpen nvs ()sDumx  ot4altn i3tls a2ul(ms t)texoxr3ty1omDr ivol(0t2xr(r3no1op  lictls aDrmxr ot1tptomi3tldla um(ms t0texrirciadfa eanvo;() 2xrimpoy1al e ivils  Dtr(rooo0oltniictasfsDeln pnt4arxnmf ootoa e u s;( t2uo(m iy4amenmiesas)sDtax  nu4tex mfeiyd m uan p (4arxnmrcoadop r ueo s s2tmio3oy4ol n ies t)srumx pno1tee io3tydfm2elu o u4tetrxo iytlaDr nes s  2xmir nudlp e fvia() 2tax  ;u1oex mo3iyt a2uln s;t0 exrxociy1op rai il(  rxrxopiy4oltemfvsas)s2raumpou1aeto iciys mDrm(mont) eerio3oydlm rluvolt  rum(r3ny4omtelfes s)aDuaxro;o4aeenmi3iydlm2emnmsnu) renir3tadlaDeai s;t sexo(r iu4ol emicias) ruau  oo4tptoiocild a um( snt)tlxomr tatlaD au i;t)t2toxr ou1lmt  fci tfarra(mp;u0tptn fctydfa eluvsn(4 exomocio1oaDeanes;t0 2uoir io4am  mictl()sDuaump;t0apto fetydla emn p u0 ltrmf3iodfptr ieo t0srto(r3ou4alen ivtl( sDrmx o;o0apxnmieilt a2el( s;t0 etoxfctydoatrauei t)tetoxrpnudolt mfei s)s2ra(r ;o1aexomfctld m2ranvp u4 ltnmocoatopD auvs s trtm(r3nu1open neil(  2rrx o;o4oetoifetls aDem( s;u0 ltnxo todfpD auvo s)trtr(r3iodopt lfes s s2ua(m ot4aetnif3iydlm rmnms u) lxoxf iytfmDr uvi s trtrxm iodlleemnetlt) rua( pno4openio3ild aDemumsn(0aleoxo3oydopt aues s0 rxoimpny1lltelnvi ()aDumum ot0aee mietltfm2ulu s;(4alenxfctydomDeai ols t2trxo oudopte ncta(faDrmumo;u1aee iiciasfs2rmnmpn(0artomo3totlmt aivsl()t2um(mpoodllenlnvs sfsDua(r ;u4aleo oeiydlm2um( pnu4texrif iy1lp e neo t  eum(o io1op nmncs (f Duax  ;u0tee ifetls a eauvpnu0 ltrif oa1fa  anes;s tetoxmpnudape  fviat srrax p;o4apt ii3tltlsDulumsnt4 rerio iytoaDe nei t)tetmio iudlpen fvtls  rtrxmoot4ole mieiadfa ua(vo;u0tltnir3to1op eauvs (0 rtrimpny4ll  lict s)sDrmum ;t4opto i3tasfm2uluvo t)tlxomo3iatfptraueslt0seuoiopnu1lpe liviat)a2ra( o;u4texnmf3ilsfm2elums;(4areoif3oa1fmt  ueslt)t2xoxr3nudam e ivsa()sDraum nt1alenio3tadlm uan o u0 eeoxr3oo1lm  lies;(  exmxm3iodlltelnet sfsrrm(  ou1tetnmo3iatla2emnmont) exniociy1fm r u ils  rxr(r3iudll nlnvta( aDur(rp;t0tetomfciytlm2eanms;u0 leoiocoy1la r n ols0tetoxo3oydllt lnvtasfs2tmxmp;o1opxomfciydfs2rlnmsnt0aetnxf3oo1lp   n ilt0sexmimpiudlp   ncils  Dumum nt1tpxo ieils s2umn snu0tltnxfciodfpD  iei;t)srumir iy1olenmfvsls)artmxrp;o4oexnmociyt s2emnvs (0trxoxf3oodom e ieil( s2um(opoo1om emfvslt) 2uaxroot0texomfeildfs ulu o t0alxrmo iy1fpD  nvo;(  eurxm3iy1apeelncsls) rumu pno1aet ioeiytlaDea(mo;t0 etoif ootfat  u i s0s2tm(o3no1amt mfcilsfs2urum ;t4apenmi3tadla2eau o;u) renio3iodlm e uvs s)trur(opno4am   icsatf rtaxr ;u0aee mfctatfs eanvp;t) reoxr oadoa  an s;t0srxmxopiu4opte ivsls sDrru  ot4aet mi3iydlmDem(von()trenif iytfa e n i;t0trtr(mpny4olt mivia( s2tau  ou0apen oetytls elu s t)alermf3iytfmDeanvo ( s2uoxr oudoltn nvs tfsDrm( ono1tlxoif3ildlaDuanvon(4arxomf3iytfm e uvols)srtm(rpnu4ol emnvtas aDrm(rpno0apenmi3tytfa2rl( o u0 lxrmo3iy1laDeanvi;(0srxmxo oy1amtemnvsl(f 2trxmpnt0tltomictytfa umn s u) exrxf to1oatrln s;s srumxm3ou1lme  ivsltfaDrm(m ou4openmo3ias aDrl( onu0arxnir3ty1laDelivi;(0srxo(rpio1lpte nvsl( artmx  nt1oet  icias mDran sn(4 lxrirciytlm  lueilt s2xrxr3oo1omt licsas s2rru  no4tpxn f3iyd sDra( p () renmoctydopDelu s;t0s2urio3oo4lmtemieslsf ruaur no4oexomfetad m2ra(vpnu4alenmf tadom   n o t)t2ur(mpoudale mnct (  Dtm(mont0olx mfetydlaDumn s u4 etnmo3iydomDr i i s0srtoxopoodop e ivtl(fsrraur ou4tee moctld mDemnmsnt0aexniociytfm r i olt0 2xo(m3iudape  fvtls s2taxm ;o4ole  iciyslm2el( on(0alxomf oadfaD  iei t)sexrim3iy4olenmnvil(fsrumxmpot0tlxoiicilsls rmuvo;u0 rtrxrcoa1fatrluvo;s srur(m nudamt mieta() rta(  ;t0tpx moeiltlsDemuvs u0 etrxr oydla   nvi t) 2xrxrpiu4am emfcil(f Dtmur ;u4aet  iciadfm rln on(0tetnir ty1om r uvi;(0 rumir oo1lpenlieiat artrurooo4open i3tyslm umumo u4 rxnxo tytla e n ils t2tmio3nydlptelfvtas) 2raxmpnt0tpt  ocilt m2el(mo t4aexniocio1opDrli ols  exmir iudopt  nctl(fsDrax  ou0alenmicilslaDranmon()aleoxociytoat luvo;( trurxr3ou4lmt  nciltfa2umxro;t4apt ifciysfmDel(vp u0texoxocoy1la eaueil( srtoxopio4amtemfcsl(fsrrmxrpot0olxomoeilt s umump;(4tltrmf3ta1lat lnes s texo(m3iu4ol e fcslt)srra(m ou4aex  f3iltfs uauvo u0texnircia1lp  lieslt trxrio3nodoltn ietasfsDrrum nt4apxn fciyt aDrmums;u)aetnmr3iodfm e u s t)texrio nydal nmfetas)s2tau  ;t0aexn f3iltfmDra(vpnu)arxrxr3iytomtr n sl()teuoir oy4amt  ivta( sDtaxmoot1aetniocilsfaDrmuvs () rtniocoytop r n slt0trto(rpny1opt mnesl(fsrrr( ono4apx ioeiadfmDemuvo;t4 lxnio3iatlm e n s;()srtmir3iodapteliei (fs2trx  ot4olx if3tltls2rmumo t4tlxoxfcoy1lp raivols0s2urxr3oo4amenmnctatfsDurumoot1openiociysls2el( o u0trtomf oy1lmDr ivi;t0 2uo(rpiu4op nmicsls  rra( pnt4texo icils aDeluvont4 exnxf ia1lat livi;()t2umimpno1op   icsas  rtmuroou4olen ieiatfsDemnms;()arxoirciodop rauvilt  euoxrpiodap nmfviatfaDtr( p;t4ape mfcildfs ra(mp;u) lenxr3oo1faDeli olt  rurxo3oydalen feia(  2rrxm nu4oexomi3iat a emn s;()tetnmf3oo1latrli i ( seuo(m3oo1optnmnvsas)arumxmp;o1optomfciydfa ranmonu4 eeomocoa1opDe ivo;s0 etrim3io1amte fcsltfs2ta(roou0oleniictat m2emu p;u0texomf iytfaDe n o;s) eur(mpiu1ll nlies t)arrmxm ;t4oltoio3ild s2rmu s;t4 ltnif oatopDrlues;s)teuo(m3ny4lme lfct s)aDtaurpno0oeeomo3iydfsDul(vs;t)texnmo iytlm  lu o;s trtoir oodom nmfeil(faruaxroou0apeoifciatfsDumuvsnt0texoir3iy1op e uvo;t0teumim3oy4am nlfvtasfartmur ;t1oeto ociytfaDeaump;u4texomo oytoptr u o;(  eurxrpiydam elnci t)aDrmu  ou1tpen o3iadfm2rl( p;() rxrxo3oy1opDrlivil()t2xoio ou1aptn feta(fsrum( p;t4tptn f3ildls2uan o;u)tlenxocoo1fa  ln o s sruo(rpny4lmt mnetatf Dtm(r ;o0tex mfetytlm emnmo ()tltrmf3ia1oaDeanei (  2xr(m ou1omenlfet s artmxm ;o4aeeomo3tasfa ea(vont)tlxnmf3ootfmDrai i;s t2trxrpiy1alt mfet (fa2umu ono4opt ifeiatfs ul( o;t4artniociotoa  luvs;t)setrimpnydlltelfct ()a2ua( p;u1oex  i3iytfmDumuvsn(0tleoir io1fa  anesl( t2tr(r iydom emnvils  Dtmur ;u1oet mf3ilslm rlums;t0tetrxo oa1lpD liesl(0 rxr(o nu1lleemfcsls s2uaurp;u0apx ioetat a2ra(ms u4trtnio tatom elivo;s0trxr(opiy4aleelfvslsfsrrmur ;t4tpxnmoetlsfs rlumsn() renxfcto1faDelues;t)t2xr(m nu4ale mfvs t)srrmxmpnt0tetnmociadlsDrm(ms;(0 etnmo3tadlp eai s;s0 2xmimpio1lptemneilt)a2rrxr ;t0tpxnmo3ild s2ua(vp t0trenxf to1fp e nvi;s)srtm(mpnodam  mfvsatfarrm( oot0aet moetytfs2eluvs (0altnxf3oatopDean s;t)s2tmxmpiudlleelics (  2uaxr ;u1alt miciydlm umu s;(4 lxrir oadopD  i i;() rxo(r3iydlpeeliet tf 2trumonu4tpx  feiltlm2rlnmo t0trtnxf iytfmteluvo (  eum(o3oy4lmen nesl(  Drrxmont4apxo i3ils sDrmnms;()aetriocootomD  ueols  eurio3oodlltnmivt s)srumu oot1alen oeiyt a2emnmp;t4 eermfcoatoa raneo (0trum(mpoydll e fei (fs2uau  ;t0oex miciyt a2uaump u4 lxrmf ia1opD lu s (  2trxopny1omee fei t  2uaur ot1optomoctldlsDran o u4tetoxoctydfa   nvo ()srtmimpoo1apenlfet t) Dtmu p;u0opt miciadls ran sn()altomf oadlp eai s;t0srum(o3oy4ll nlneia()a2ra( onu0apeo ocilt s uln on(4trtrmo to1lmDe nvslt0s2uo(mpiodll elivsl(fs2ua(rpot4apxnmfctydfa2ra(vp;(0 eenio3iy1fateai s;( s2tmxmpiy1ol n fcia( sDrmumpnu4apt  o3iytla2emuvs () etniocoa1oat  u i;t)trtr(o3oudlmenlfvslt)s2trxroot4oltnmf3iat mDrau s u4 eenmf3iodfatr uvilt)s2urim3iudlptemfvs ( a2umx  ;t0oetomoetad s2ua(vsn() rxnmfcoydopt luvslt  rxo(o3io4lltelfvsa()s2rmumpno0apenmf3taslmDem(vp t4aexoio3oytlmt  uvsls) rxm(m oy1ol elfei (farrrxrp;o1opeo f3ildfm rl(mp;u)trxoif3tatopDeln o;(0 rtm(mpoydlp   ncsat) rraxro;u1aleo fctatfa ul(vs;u)altnircty1lmDrlu s;s tetrirpiu4op emiesl(f Dua( p;o0aptomiciytlm2uauvonu)trtrmoctytla e i olt  eum(o3iy4aptnmiei () rraurono0tet  o3iadla elnmsnu) etoxr3to1fa rau o;t) 2trir3iydalte ici s aDrr(  ;u4texnio3ilsla rmnvs;u)alxrxf iadlm  au s ()srumxopoo1lltelnvtat srtmxrp;t1tex  o3tld s2eauvpn(4 lxrircoo1fpte i ols)sexmxr3ou1olt lfctlt sDtr(ro;u4oexnmieild s2rlums t) etrmo iodlate iei;() rxoir3iodap e nvsl( a2umxr ;u0tptoiocilt a eanvp;t0 rxnmo3iodfptrlnesl() 2toiopnydap  mfvtasfsDra( p;t4apt mietysfa2uaumo;t4teenirctadfa   u o ()teuo(mpnodope lfvs s  rua( pnt0opt  i3iat m2umumsnu4tleomrciadlpD  ivs;t) exrxo3oo4al nlfvta( sDtru pnu4apx mieias a rmuvo;u0aeeoir io1oa eln o;( sruoxm3iodlp n ics t a2umxr ou1tltnio3iysfmDuanvp;(4trermf3tydlatrau o;t)teuo(opnu1ame liesa()a2rmxroou1apx miciydlmDeauvs u4trtrxrctotom   u slt trurxm io1al e iei ()s2ua(  nu4oexnmoctld sDran o;u4 ltoiocoatopDeaieo;s)s2toxo3no4op  mivil()s2uaxronu1tpxnmfctydfm ua(vpn(4 etoxf3oydoaDe nei;s setr(r iy1al  mnesltf Drmu  ou1oexn oetltlsDrm(vo;t) rxnmf3iatopteln sl() rurxopnu1ap   ietl(f rrrx onu0apx moetad sDumn p;t)alxnio ty1fmDeln i t)srtrir ny1apen nvtas)aruaxmooo1opxomo3tyt s2el( s;t4altoxfctodfateai o (0trxrxr ou4lm elfct tfsDra(ro;o4optniicild a eaumpnu4areoxr3ta1fpDelnes;t) euoxopnodol n ivi (fa2rmu  ;t4olen fetlt aDea(vp u)trxoiocoytlmDeauvo;s  rumir ou4ol   ici (  2umxmpnt0tee  i3iatlaDelnvo (0treoxociatfmtr neo s  eurim3iu1am nmfcs t  2rr(m nt1oetomicias m elnvont)tltomfciotfpDrlnei;t)tetrxr3ou4olen netl() 2tm( pno1aetnmocias s2rlu o u0 leoir3ty1lat anes;() rxoxm io4ame mnvsat)aDtmxmpnt4oetn fetas a emn onu4 ltoxfcoadoaDrau s t)trxr(m iodlltn fet ( sDrm(mpoo0oexnmfetldfa2ean p (0 lxnxr3tatfm elivi;s trur(o3io4ap nliei ( a2tax  nu4tpt  feiltla eau o u0tetoxf3oo1fptranvs t sexrxr oo4opt lnvils a2rmu p;u1tltn feiadfs2el(mp (0teenircty1fpte nvs;t0t2uo(o3io1llee feiatf Dtax ono1tptomieias sDrl(vsn(0 lenif iadlp r i s (0 etrxmpno1omt  ici ()a2ur(  ou4ale io3iyt mDuln sn(4 exnifctodoptelnvs t  2xrxmpiy4open ivs t sDum(moot4apeoio3ildlm2raums t0tlxoif3iodoaDrai sls texmim io4lm  micsl(  rrau  oo0olx  feildfs2ea( s t0teeoif3ty1fp   n i s)texmir3ou4opeemiesat  2rmu poo0apeo o3tyd a ulnmonu0 reoio3iy1oate nvo;()sruoxm3ou4op nlivils)srum(r nt1oexomocild aDrmnvpnt0aeerxfciadlp raieils)srxmxm3oy4lmee fvi s s2ta(r ou4apxnif3taslm rlump (4 ltrxr3iatoaDraivi t  eurxmpiudolte fei sf rrm(rpot1aexnii3iydlsDelnmpnt4arxomocoadfm  li i;t)s2uoxopno4ole mics (fs2uaumoot1ole  i3tatlm ulump;t0 etnmocoatom   uvs t) 2xoimpno1opeelfvtas)artrxmooo0alxn ietys s ea( s t4aeerxrcoodomDeli s;t)sexmxr nodlltelfct t)srumu ooo1oeeo oeiatfmDrluvo u) etnmo ia1opD aivs t setrxo nodlmtemfci (farrrur nu4texomfciyt aDeauvp u0tleomo ia1omDr nes;t)srxrxopiu4ame lieiltfs2rmum ;u4oet ifctat s rmnmo;u4 rtrif3iodoa raneolt s2xo(o3nu1amt livtas aDtmxro;u1aet mi3tld mDrl(vp (4 exniocoy1fa eli o;t)trur(m3ny4lp emieils)s2rm(mpno0olt mi3tldla2rm( o t0 exnifcio1fm r ueols)srtrim3oudopt lieil( a2ra( ooo4apxomfcilsfmDumumont) lenxr3oa1la eln i ()t2xo(rpiu4ap nlfvtlsfsrur(m oo4ole mfctyd a el( s (4trtrxr tytfa e ivols)setoxr ou1ame lietas)a2tr(rpnt1aptnii3iyd s2ra( pnt) etoir oodlmDe i s;s srxm(r3oy4lp  lnvsltf Dumumoou1apeomfetlsfaDuaumont0arermrcoo1fat an i t) 2xm(r iy4lmen iviasfs2rrumpnu4aleniictadls um(mont) ltnif totfm ean sls)srxrxm iydale mfesl(f 2umxmo;u4ale iictat s ranvp;t0 rerxf tydop e uesl(  rumio3nu1lmenmnvsat  rrm( poo4ale mfetys m ean s u0teenxfcto1om eli s;()tetmir3nudolee fei t  2uaxmpot4tpeoiieiyt m2umump;u4artnxr3io1oa eaieo t0 exm(mpnu4amenlivi ()arta(r ;t1tpeniietyt m2umumpnt0trxomfctadopD ai s;t)t2uoim iy4alte ncsat)a2rmx ont0tpx mfctltlm rmu sn() rerir oydop   u i;s0 2trir3oudoptemncia()a2rmumo;t4opt iictasfa2eauvs;t0 rxnif3iotfaDeln il(0s2xmxopnydaptelfesasfsDrrxr ;u0texomociytfaDeln onu4 exnioctodopDeaieol( trtrxr iy4aptn iei sfsrtm(rp;t1tltnmfcils a2elu onu4 eerxrctytlateln o s0srur(opiu1al emivs t)s2ra( o;t4aeenmoetadlmDel(msnu)aeenxr iytlate ieo;(0trxm(o3io4amte fei s)arum( ono0apt mi3tlsfsDuan ont4areomo oydlmte nvi;() 2tm(m oy1ap elnci s)sDtm(rooo1tptoioeiyd m2ean o;t4 renxo oytopDelneol(0 ruoxopio1altemicias aDurumono0aleo fetls aDraumo;u4alenxo3io1lp e neilt0s2urxr ny1omte fvi s)a2rmxm ou4tptn octyslm2ean o;t) leoio tadoa  li il()seumir3nodamtn neslsfs2rmxr ou0apeomi3iytls el( p t)trenxocoytopDrlu i;(0 2toirpou1omt  ncslt  Drm(rooo1aexnmfetld sDeanvon() rerxr3tatop eaiei;s)t2xmio3oydoltnmnvs s s2um( pno0texoif3tadlmDum(vs t4artnxfctadom e nes ( t2xr(r3iudame  nesasfs2ur(rpnu0aleoioeiatlm2uauvs;t)trxomr3tatlpt  nvo s  rtrxm oy1lpenlnviat)artm( pno4ope  oeiadls rlu sn(4altnmf oatlaD ai o t0t2urxm no4lpt mfciat) 2ra(mpoo0opxo oeiytlsDelnvo t0aexoif3iatlpt  nvi t srurim ou4ll   ncsls  Dta(  no4opxomfctyd m emu p (0 leoxrciadop  aiei t0s2xr(o oodlm  mieia( a2tm(  nt0tltnifcildfmDrl(mpnu) eeoio3tadfa ean olt0sexmxo iu1apeeliviatfsrtr(m ou4tpx  fctatlm ua( p;t) ltriociydfm  lneols) etm(m3iydlmenlnvsat)arurur nu0tlto ocild sDum(mon(0 rtrmr oa1fp eaieolt0 exm(o3iodopenlfvta(f 2rmxm ;t1tee mfeiys a ean pn(4trtrxfctodlmte uvo t) rtoxo3iydam  lnci t)arrau  nt0tpen fciys m ranvpn(4tleniocio1fp rlnei;t0 etoirpou4alenmfct s s2rrxm ou0tptomfeiasls ulnmo;u0trxomfciatfat  i ol( t2xrxr3oo1omte fvsl(  ruax  ot0tptnii3ild a2rm(vo () exnmfcty1fpteai i t0teuo(mpiu4op nmnesltfs2uau oot4aee mi3iys s2umn o;t) etoif tytoat anvi;s) rxrxo3no1ol n nvtl()a2rmxrooo0oetnmfctldfmDrlu o (0 rtoif totlp  aneols0 ruoim3ny4lptnlnvta( s2rru  ot4oet iietysfsDulnmp;t4arenmr iotfa rauvils s2xm(r3ny1alenmivtl( s2urump;t4optomf3ilslmDem(vo;(0tltoxocty1fa r n o (0t2xoim3ou1op nlncia(fsDraurpoo1apt mfetas mDeluvo t)trenif tadfm  lnesl() 2toio nudllte nctas sDtaur ou0ale  feild a uan pnt)tltrmfcty1fmD  nvi t0trxm(o3oo4open feias) Dtrxmpot0opx miciytfa uan s u) ltoxf3io1latrlueo;s0 rurxr nudalenlnes s aruru onu1apxniociysfa2raump;(4aexrmrcoodop r i olt0srxmir io4am  lnesas sDuaum nu1aee ioetys sDeau s;t)trtrmf ia1lpt anei ()setr(m nu4lmeemnvsas  rtrx p;u0ale  octldfs ulu p t4 renir3ia1fp r u s t  ruoxmpnu4lmtelfet () 2umx ont4tetoii3iltls2eauvo () lxnmrcoatfatrluvs () exoim3oo1opt  net t)arururpoo0oexoioetyt m2rmuvsnt4artrio ta1lmt anvsl(  2tr(o3iu4olt  nctat)arrmxm ;o0tpx  oeildfsDul( s;t0tetoir3ta1fmt an il(0 etoimpiodame mfvtat)srtax onu1ale ifctys a rau s;u4 etrmf tydfm r i s t  etrio3nu4ale mnciatfartr(rono4oexoifeils a elnvsnu0trxoxf iotoateau s;t)t2xrimpio1am  mfct sf Dtmu o;o0apt moctyd s ul( pnu0trerxoctotom elivs t srumir iu1lpe  ncia()aDtrxmo;t1tetnmi3ildfaDra( on(4 rxnmf oydom  lu sls)setrir no1llt  icsat)a2rmx  nu1opt iicildlm2rmuvp;u)aetrxfciydfp  luvilt) 2xoxmpnu4amen ivtltfa2ta(  ;o0opx io3iys sDrmu s;(4trxnif tytfmDrlieol(0 2um(r3iu1omte nciat  Drr(  nt0alxnif3tas a2eanvonu0 exrmo3oy1oaDran o;t) 2toxopno4amtemici ( arumump;t1oex iieiadfmDeluvo;u4trtrmfciotfm r ues;(  rto(o oy1apenlnet () Dtrur ;u1aet moctltlmDua( o;t)tleoiocootla  li i;s  rum(o io4opeelietl(fa2ta( pnt1opt mf3iltfs2ea( o;t0 rtomfciy1la  luvsls texrxr oy1ame  fvia() rrmumpoo1teeomfetytls2ua( p;t0arermrcoatop   n ils trxoxr3io4omt lfcsat s2taum oo1tlenmfctys a2el( pn(4alxrir3to1lp eai s;t srxrio nu1lp  mfeiat) 2trx oot1aleomo3iltfsDea( snu4 rxrmrciytlpD  neo s0 rtr(rpno4am nmictas)arumx p;u4apeoiiciydfs2ea(vpnt4tltoif3oa1lat anvo s)sexm(o3io1lmte ict (f rur( pou0ape  oeiltfaDemumonu)texnxf3ia1fmD  i ols) rtmxr oo4apt  fvi s aDta(r nt0tee mi3iatlm2umumpnu)tlerxf iadlpt lneol( t2toim iy4ll nmncsa() Duru  no1tlxnif3ils mDum(mpnu4trxomo3ta1lp   neo;s sexr(m3iu1lmen fvi (f rurxrpnu4tpxniiciytlm elnmonu)alenmrcoadlpDelivo;t0 2tmim iy4alenlivi t  Dtmuro;u1oeeomoetatls2um( sn(4 exniociytfmD lnvs ()tetoxrpno4alt lfvils srrrurpnu4oltoiietldfmDuanvon(4alenif3tatoaDrlu s;s)tetoim no1lmenmfvil( aDtm(  ;o1tpe  ietyd sDeluvp;u4arerif iydoaDe u s s)t2xr(opnydome lnvta(  2rm(  ;u1teto i3tydfsDea( o u4 rermf tatfm eau sl(0sexo(m ny1amtnmnei ()a2raxmo;o4oltnio3iadfsDumumsn() exoifcoo1opDrlieol( tetrimpiy1om e ici t aDtax pou1apxn o3iytfa2uau snu)tlxomr tatlatr n i (0trumxm iudol  livias sDtm(rpou0apeniieiltlmDra( p t4aeeoio3tytlmtelu sl()teto(r3iy4op  licilsf 2trum ou0tltomietatlm2ua(mon(0 exomo3tadoa r uesl() etrio iy1lle lnvs s)srrru pno1tle  fetasfs umn s () reoir3iytlm elieo (0seumxopoudame lietas) 2raurpou4aeeniictysla2emnmp;(0texnmocoytopt lu s s)s2um(m3nu4al   fvi s) Drrur no1tpt iieiad mDran onu4alxrmf3oatlmDrau s (0tetmio3oodlpee feilsfaDurx ont4oexoii3iydla2emnvpn(0 rtnxr iydfmDean ols  2trimpno4om emncias  rtm(m ot0tlxn fcilsfs2ulnvp;()texrxr tatopDraivi;s0 2uoio3iy4lpenlncs t s2tm(rpou0tet mfeiydla uauvs u0arerxociodoaDrlnvolt0srxrxo iy4omtn net sfsDta(r ot1apeo fcild a uaumo t)tlxrmf ootoaDraues (0seumimpou1op e fvi s  2rm(  nu0tlx mocilsfmDuau pnt0aeenxr3oytoaD li o;t t2xo(mpnu4ale livsls arra(  oo4alxomictaslaDrm(vo u4aetnio totlmt  nvs ()seurim io1llt mfvs ()a2tr(rp;u1tlxoifeildlmDuln s;t0tlxnmrciatlmtrln s;s) 2xr(o oy1lm e iet ()srtm(mo;u1olxo ictad sDelu snt4 lxoiocoodfp elu o;( t2xmxm oo4lmtnlncsa() Drmu oou1teenmociltfs2umnvo t) exoifctotfpt lu s s)texoimpiy1lp nmneta( s2trxrooo1opxo ictaslm2umuvp;u)arermo oytoaDeau o s)teurio ou1oleemfeslt a2urur ot0optoifctysfm rmnvs;t0aleomrcta1laD lnvilt trxrxopiu4ll  lictasfsrraxr ;o0opt iietldlm rl(mo;u4 lxrmo to1lp r i sls  2uo(r3ou1lpeeliesa( s2tau  ot1apen f3iltfsDra(vo;(0trtomocoydlp eanvo t  rxm(o3nu4lpte fes sf 2tmxro;t4aptnmf3iydfm2rlnvp u4 lxrmf oodomtrluvi (0teuoxr3no1apee fctas) rrr(r ;t0oet mi3iyslmDumnvo (4texrmr iotfa elivo s0 eumxr3nudomeelfeias)s2tr(monu1alt ifcilt a rluvp ()trxoxf iy1oaDraiei t sruo(opiodam n fvi () 2ur(mpno1oltn ictasfaDuaums () exnmr3oadoptr uvs s) eum(rpoy4lltnmfvtls srrm(r ou1tpe ioetadfs ra(mp;u) ltoxr3ia1fa e nvilt srtoir ny1lm elicia( s2umum ;o0oltn oeiytfsDul( pnu)texoio3tytlmDr uvi s texmio nodlm emnetat srrmx p;t4texo o3iad m emumpnu)altrmo3iydfa rlu ilt0 2toxr3nu4oltemivia() 2uau  ot0alxn f3tatls rln p u0trtrmrcoydlp r u s ()teuoxrpoo4apenlies t  Dtaxr ou4tltoii3ilslaDrmn s;t4 leoxfcoatom   ivo s)tetoxrpou4lm elfvias)srrr(r oo1tlxo iciaslmDeaumpn(4teeoir io1lptran i s)seum(mpoudal elncs t  Draumo;o4oeenmi3ilt m umuvp;(0 renmo3ta1fate nvs;s) eumxr3nu4ope lieiltfsDra(  nt1ape ii3ias aDul(vsn(4 rxnif3ia1fmDr ueo t) rtmxopnudol e nei s)artmxm ;o1alx  ieiadfs um( sn() lerioctatopt lnvs s0seur(m iy1ameemicsatfa2tm(mono4tex ioeiat s2umump u)tlxrmociy1fatrlneo s)s2xo(mpnu1lmte neilsfartrx oou4tpe ifctytla el( sn(0 exnmfciy1fa rlnvo ( seumio iu4om nmivi t) 2trx pnu0tlenmietatlaDeau p;(0 ltoio oa1la eliei;(0t2urimpno4lme mivsatfsDtauronu0alen ociys a rmumo (4aetnxo3iytfpt  u s;(0 2uoxm oodapt mivi ( s2rmur ;o0teeo ocildls2ul(vo;u)trerxrcty1lpDrluvi s0trxo(r3nodoleelfeil(f rrm(moou0oetnmo3iydfsDum(vonu4aexomo3oatfaD aneol( t2toxo no1alen ivtlt aDumuro;o0aeeoiociyd m2ranms ()teerir iatfm r nvslt  rxmim3ou1apte ics t srtmxmpoo1tpx  ictlslsDumuvo;u0arenifctytoaD auesls0 2trim3oodome licslt sDtm(roou4aptnmf3iatlm2rluvsnt0alenxoctydlate i i s0srxr(o io4ll nmnctlsfsruaumooo4alx ioctls m umuvo;t0 etnif to1fptrlnes;t tetrxr ny1omee fct sfarraump;o1aex  oeils aDuanms (0alxriocoytomD  ues s tetrxr3nudal  mictl() 2ua(ro;u4opeomf3ild s2emu pnu4 lxomo totlmDeluvo (0truoxr ny1op e nvi s aDumu pot1altoiiciad m ua(vp;(4trtomf iydoa  aues;() exo(m3iydlmt lfcsa(fsrtau pnt0teenioctas aDumn o t) exnmr3todlmD lieils)s2trir no4amenlfeil()a2rrumpoo0olx mfeild s uluvo;u4trxnio oo1omtelneils  2tmxo nydomenlfesas a2uaurono0aet moeiyt aDranmp;t0 rxomocio1om eai i s  exoim3io4lp elivsa(fsDtm(ront4tpxo fciat sDemuvsnu) etrxfcoy1lp  ln s t) exmim iydlm elfcsas sDtaxrpot0tltnmfciltfm emu p;(4 exrxo tadfm ean o t0 2xoxmpny1amenlnci t  Drmurooo4apt  fciysfa2rlnvo;() leoio totlpDr nvo (0s2xr(mpio1omeelnvi tfa2rrxrooo4opxoio3iatfs2ranvsnt)tlenmfctatlatrauvi;() etm(r ny1al elics sf Dur( oot1olto ictadla2um(mp;(0trerxo iytop  livs;(0 eumxm3nu4lpt mfcilt)a2ta( onu4tpxoii3tltlm2eln sn(4trxoxf3ia1lptelues;t0 exo(o nu1ape  net s) rrm(mp;t0tlxo f3tls s umn o t0 exomf3oydla rauvils0s2trxm3ou1alen fvtl()sDuaumono4aeen o3iltfm rmnmsnu0trtnmrcoatlpD auvi ( trxr(o iy1ap  lnciat  Drax pnu4apeoiictatfaDulnmp u4trxrxr3iy1oaDelivo t seumxm3ny4lpeelfes tfaDumx pnu4apxnmoeiasfm um( o;t0areomr3tydfpDraivol(0sexoim3no1lmenlfvs t arumu p;u4tpeomfeiasla rau s;(0tlxrxrcoy1fmteli o s0tetr(m nu1alenlncsls s2ra( pno1tpx mieiydls ul( s;u0tetnmocoodop  aneols setr(o iu4lle lfesl(  2tmuroot1aeenifeiaslm umu snt0arxnir iydfa  ln i s0trxoxo3ou1opt  feta(faDuru p;t4oetnmfeiadfs2el(msnt4 eenif iodoa e uvsls  rumxmpnydome mnvias aDuaxmooo1tlxnifetltlmDumums u0trerxo tadlpDeau o;s  rxoiopno4lpt  ivsls s2um(  no1oeeo feiysfs emu snt4alxomo3oytopDr neols)t2trio io1llt mieia()srrmx pnu0opt  fetat s2um(mp;()aeerif iatlm  aieolt)s2urim iy4ll  mfviasfs2trxmo;t1alxomfcils a uan onu4texoxf iotfpDe nes (0teuoxmpiodlpe mnvilt) 2trxm ot0teto oetyd a rmnmo (0trerxociadomDeln s (0s2tr(opoo4lpee ietas aDtrxrpnt4oexn fetytfs2el(msn(4trerxf tydlpD li i t)setmir3iy4lpt  fcil(farur( poo4olxn oeild mDuauvont4aexoir totfa raieilt)s2tm(o3ou4ome lnvs (farumxro;o0apxnmfciytlsDeln o;t4 rxrir iytla  ln s s)teumxr3iu1ll   feil()s2uaxm ;u0aexoiocilsfsDrl(vo t0teeoxo oatlmt lueol(0srto(rpiu4ame lfct sfs2taxrpoo4tle mf3iysfmDuan p ()alxoif oadfa raiei;t  exoxo3no4opt lnesl(fsDraxmp;t1tet  o3ildfaDum(vo;(0texnmfcoatlmDr n sls0t2tm(o3no4oltnlivslt arurx  oo1oet mi3tld s em(mont)tetrir3oatfpD ai il(0 2ur(mpnu1lptelfesas)sDrmx oot4olxomoetysfaDra(msnu0aleomf todlatr uvil() 2tmxmpoodoptelici ( arum(  ;t4tex if3iydlaDra( o;t4 rerifciydfmtrlivslt0srtoim3nudol elieias sDrauro;t4oexoif3ias mDuluvp;t0tlerxf3tydlptr ivsls)trurxo ny4aleemnci t aDtrxmo;o1tlx mo3ilsfmDulnvo (4aleoxfciydoa  aueils s2uo(rpnodlpee ncias srtau ono0tpeoioctadfmDeanvs u4trxoxo io1fa  li s;t0truoxm iudamte ivs tf rtrum nu1tltnmfciydlm2rmuvp;t) ltnmo3tytla r uvo;t0 2urimpou1lm n net t arumu oou4tpe mfeiatfaDrm( p;()tlerifcio1laD ai s;( s2um(m oydapt  fctas)arrr(mpoo0opxnmo3iat a umu sn() ltoif3tydlpD  neslt sexm(m nydlmtelieias  2raxmpou0teenif3iadfmDrmuvsnu) lenxr3oodfm ranes (0trxr(r oodalenmics s s2raxmpou0oleniicias m ulnmp;u) renxocoatlm rlu s;(  exo(r3ny1optnlics ()s2urxr no1oetoii3tasfsDrmumsn(4artrif3iy1fmte n o s t2tmir3iydomtnlfcta(faDtmum nu4oexn oeiad mDra(ms t4 lxoxo ootlmtran s;s)srtm(o nu1omt mfvtas  rua(mpno0apx ifciysfs2ranvon() lerif3tytfmDean ol(0 rur(r iudomeelnvias)srtmxmp;o1opxoiietatfm2ulnvs u)tlxoir3ta1optr ivslt0t2xmxopnydopt lfetlt) Dumumont4oeeomfcilt a ulnvpnu)teeomfctydfmDe n i (0seumir ou4ale  ivs tfa2urum oo0tpxoiiciadls uan s;t0arxriocty1oa r nvo;() exmxopio1amte feilt arur(mpnt0ale moctldlm2emn ont4aetrifcta1faDeaivi;s0trur(r3oy4lp e nvs sfaDtmumo;t4tet ifcilsfs rln p t)tetrmrcoydlaDrln o s tetm(r3nydol elfei t  2tru pnu0texo i3tadfaDumnvs;(4 etnxr3oo1fmDelueo t t2xrim3oodaptelfcta(fsrum(r no4tlt  f3iat s2rmn pnt4aetrio3oytfpt lu o ()teumxrpou4olee ieils srtmxm ;t1altnmf3iadla rl(ms u4altnxf3iodfpDr ivi;s)sruoim3ny4ol  lietl(  2tmxm ot0aleo oeildlsDum(vo;() rerxr oo1fptean ol(0t2xoiopiu1ope mfcs s)sDumu poo1oet  octydla2uln on(4tlxrmrciotlpte iesl( trtr(mpoy4op  lfcs s  Dua( p;t0apt ioeilt s rmu sn() rxoif3oadfa rlnes s)s2xoim3iu1ap nmicia(fa2uau pno4tpenifciydla ea(vp;u0 lxnmo iadlpD anvs;t)t2xmimpiu1omeelfcs t aDrr(r ot4olxnii3iysfsDumnmpnu4alerio3ty1opDr uvol(0 ruoxopoydapen iei s aDtr(rp;t1olxo ictytfm ean s u0altrxf3iy1omt aneols setm(m3iy1ol  lnvilsf Dua(  ou0alxnmfetlt s ulnvs;()tetoirciotfmDraneo;(0 etrio3ou1amt mncilt)aruax oou1tpenmociytfsDrluvpnt)texoxf3oatlpD auesls0t2uoxrpny1om  mnctat) Dtm(rp;t0optomiciatfmDeanvs u) ltomo3iatfmt livs;s0t2trirpno1ope  fesl()s2uaxm ;u1olxnmocilt s2emn pnt4 rxomr oy1lpDrluvs t0 2tmxm3io1am   nctat  Durumono0altomietatfm2ra(msnu0 rtoir ia1oa ran i s) ruo(m nodop nlfctasfa2urumoou1olxoiiciltlaDuaums;() etrmrctatfpDrai s;() 2toxmpiu4lmt liviat  Dtmu  ;t0apx mieiasfa2emuvpnu4 eeomr3oatfa  aiei (0srxrio3oo1opteliet t)arua(mpou0open octatlsDraumpn(4areriocootlat  uei (  eum(r oydap e ncs (fa2urxmpnt4tleoii3tyslm rmuvs (0trenif oydfm rluei;s) 2umxopoo4amte nctat) rrrumpno0tetnmfeiltla rm(vs;(0altrmocootfa e i i;(0 2trxo ny1ol emiesatfsrtmu p;u0opxnii3iad s2emnmsn()alxomf iatoaD ln s t  rxmim iu4am e fvslsfarra( pnu0tlenioetlsfs um(monu4artnif3oodomte nvsls0trtmxo3no1lpenmnvilt a2tm(mo;u1aexnmoeias s rln snu) eenifciadlmDeln i t srtm(rpiu1altnmietatfsDurx p;o1teto ociydfs2eaump;u4alermf tadlmtr ueolt) rtoxrpoo4lp n nviat a2tr( ont0oeeo ieildfa ulums u)alermr3oadfatr uvil()t2trimpiodaltn ncsl( sDraumpoo4olxoif3ildfa2rlumo;u0arxoiocio1laDeliesls srurirpny4oltnlnei ()a2ua(moot0aetnmoctls s rlnmont4teerxo totfm elnvol(  2umxm io4lm e nct (fsrumur oo1opx if3tydls ua(vo;u) exnmr oa1oa  aiei;(  2tm(o3iy4lp  mivslt aDumumpnt4aeen ieiadlsDuln p t4alxrmo ootfmtrlivi;( t2umimpnu1ap n fet s srrr(  no4tetoii3tasfa eauvs (0tlxrmr oodoa  ai i t teuoir3ny4ap e ici (fs2um( p;u1aeto ociysfsDeaump u0 lermo oytlmtelivslt0 rumir oudol emnctltf Dururp;u4olxn fciaslaDemnmp u4 reomrcoy1fatelnes;() etrxmpiu4lptnlfct sfaDrmxmoot0ape ii3tasfs2rmu p u) eenmocoodlpD lneolt  euoxm3nu4lptemneia(faDuaumpot4tee  f3iyslm emnmo;(0aexnmf3oadlp rlnvo;s  2umxr oodalt  fet ( a2um(mo;o0olt io3ildlaDuanmont4trxomfcoo1oaD  i o;s0s2umxr3oy1lmte ict () Drrumonu1tpxomfciadfa2ulnms (4tlerio3iodomt li i ( trtrxrpiodam n ivt sf Dtax pou0tlxomictaslm ulu sn(0tetrif3oo1latranvilt0t2tmirpny1lptemfvsas  Draur ;u0apt  feiadfmDum(mpn()arxnxo3iytfp  auvs;t0trurim ou4ale licsatfa2um( pno1altomo3iltlsDem(vpnu)trenxf3iy1lmte ivo t0texoio no4olenmieia(f rtaxrp;t4tlt  ieild s rluvo;t)alerif3iotfmD lieils sruoxopnu1ole  ncils)aDtmxmooo0opxomociytlsDemu o (4trenif3oytoatrai il(  2xoiopiydap e nes (  rraum ot4texnmfetadfs2ranvs (4artnmr to1omDeanvol() exriopnu4olenmnvsa( sDra(ront4tlxn i3iydlm eanmont0 rtrxfctotfpD au o t) euoxo3io1apt liciasf 2tmxrpou4tpx  icilsls uaums;t) eenmo oydlmtrlues () 2toiopoo1ape mfvsat)sDuaum oo1aptn o3tyt mDuluvpnu4 ltrir3tatopD ai o t teuo(r iy1lptnmicslt sDumu  ou1olt  i3iad m2ra( s;(0aexnifctodomtraneil( s2xrio iydol   ieiat)artax pno1aleo fcias mDuau s t4trxrxr ia1fpt ln i t  ruoxm iy4oleelnei sfa2ua( oot0ape iieiydfa em(mp (0altoif3tytfp  auvil() etmim3nydolt mivia(  Duaxm ;u1tpxnifcils sDea(vp;() ltoxoctodfp e n o;()t2uo(o3io4llte ics s)artrum ou4olxnmieiytfmDelnmo ()arxomf iadomDr n s s)trur(r3oy4am emfvt ( s2rruroou4oet  o3tadfa2eluvo;t4altoif ia1fm rli slt t2xm(m iydomeemfcslt arrrx ont0oleomoctatls2rm( s;u0 etnifctodoptrlies;t0trtr(m iy4lptnlnei t) rra(  nu1ope  i3tltls2ran p;(4 reoxo iatoa r n ilt texmxr3ny4ll elictat)s2rmu p;t1ale  octys m2rl( ont4alxrio3oadfa eli s;s teto(mpnudlpee ieilt)a2umuro;o1tex mictasfa2emuvs u)trtnir tatopD  u s ( t2tr(r3oy1op nlnvtlsfaDtrurooo1aexo fciltfaDrluvo;t0artniociodoaDraivi s) rxo(r no4opeelictl() Dur( pot0apeoii3tadlmDean p ()aetnio3iytfa elivils t2xoxr nu4al  mfvt t srtm(  nu0apto fetatfmDrl(mont)tlermo ia1omD livs t  exoxo3iudom  lfes (faDurx  ;o4oet iictlsfmDea(mp;t) ltoxr iodlmteln ol() euoimpou4lm nmivtat) rua( o;o0apeomocilt s rl(vo;t4 rtnir3totlmt aneolt0sexmio3iodlpe mivt s srtrurp;t0opx mfcildlm2elnvont) etrif iytoa e ueolt)setoim3ny1lleemncsl() 2rr(rpno0alx mf3iytfmDrmnmpn(4 rtnmf ta1opDran s ( s2umxo iy1ale lnvsl( sDum(roou1teeo ocils s2ul( p t0aexoxf3oytlm eln il()sexrxo nu1ole lfeta(fa2raurono0apxniociytfa2eanmpnu0 eeoif to1lateanvi () 2uo(o nu1lpt  ies ()s2rru  no0ole  fetld a2eaump t)aleomfcto1oaD  u il( seumxopnudlm   nci ()aDrrxmp;o4alxomociydla eauvo;u4trtoxo3iy1lpD auvs t0seto(o oy1ll nlnvs tfs2raum no0open feiatfm ea(mp;t4trtnmf oodlpt lnvo;t0setm(m ny1omeelfes sfs2rrxrpoo0aetnmfctltls ea(msnt)altnxfcoo1lmDeaiei;s  2trir nu4al  livilt srra(  ou4tlxn i3tytlsDrlumonu4arermo io1lpDr ueil(0t2xm(m3no1lme mivsas a2umxr ;u4aee ifeilsfa ulumo ()aexoif3iytfa r ivils)s2trxopnydapt  nct s arumur ;u1tetnmo3tlt mDean p;() lxrxo3iytlmtean ilt trtoxopnydome livsa() Drmu oou4tlt mieiadls rlump t4artnxf3oatlaDr ivslt)t2umxopio1ape  fvs ()a2tr(  ot1ale  iciytfm um(vont0 etoxo iytlate uvo;(  exr(rpnudolen nvilt s2uaxrpnt4tlxo f3tytlaDemnmo;()teermfcoatop  luvols0t2xrxm nu4openmicsa(fs2uaxrp;t4aexoioctyslsDrm(vp t4 exoir3iatfp rluvo () rtmxr iy4amtn ivt (faDurxmont1optoii3iydfa2eanmsn(4tetnxr3iotla eln o;(0 exoim3iudomtn ieia(fa2tr(m nt4tlt  fciysfs eau s;t0 ltoif3oy1fp  lnvs ()t2tr(opiy1al  mnvsa( arua(mpnu0ope  iciytlsDea( snt4 exrir3oytoa  aues;(0srxrim no1ale  nci (  Dra(  nt4tpxo f3tlslm rm(vpnu0arxoxf3to1oatelnvsls srxm(rpio1olen ncs sfa2uax pnu4tpe  fciyt aDemnvpnt) rxrxo3totlpDr neol()s2umir3ou1lltemfeslt s2rr( o;u1tpenif3iyt m el( s;t) leoircootlm  li o s0t2tr(mpio1oltn ivi sf 2rrxrpno0aetniiciysfm2rmu o u4 eerio3oodlp  aneo;t)s2uoxo3ny1lm emncsls)sruau o;t4oee  o3tls m2uan s;t0teermr3tatoaD  nvs;t trurir iy4ope lnesat sDtax ont4tex  f3iat aDrmums (4trxnir oy1oatraieo;() rxr(o3iu1am  lnesat)sDuru p;u1tle  f3iasfs uan s (0aetomr to1fa e iesls s2toxmpnudaltnlneta()s2ta( poo0opx ioeiadfsDrlnvs;(0tetnxfcio1oateau o t)trtoio3oudll elfesls) rtr(rpoo4alx iiciat m2ra( onu0trtoif ia1fp e ies t0 2xoxr nu1ol eliei tf rur(r nu1alto ociatfs eln p u)tlxrif tydlptr u i;t) 2uriopnodol n nes ()srumxronu4tpt ioeiytlmDel(vp t4 rxnircia1fm   nei;t) rxmxr3nudom  mict s) rrmxrpno0tltnifeilt m2el(msnu4alxoxr todopDe uvsl(  exoxrpnodopee fes s)sDua(mo;t0aet ifeiyt mDrm(mp;t0alxnir3ty1oaD lnvil(0seurxm oydal  mieilt sDurum ot1tpenmieiysfm eaump (0 ltrmociydomDr uvsl(0 2xm(r nydlpenmnvsl(f Drr(ront0aeto ictadlm2rmu pnu4 lerirctadomtrlnvil(0t2toxrpio1ll  lfvia(f rrrxmpot4aexnmiciytfm2raump;() ltrmf3ootlmDelu s;(  exm(m iy1ap nmnvilt sDra(  ;o1oeeo feiydls2rauvo t)tetoxf oy1la  ai s t0srtmxopnu4lmenlfvt (f 2taxmp;o4aeen octld s eau snu4alxnmfcio1lat auvs;t trto(mpnydamtnlictlt  Dua(mpno1apeomictlt s2rl(vs;(0arenmr oodomt ln o s0 etoxmpiydopenmfvils  rraxmpnu1ole moeilsfmDuanms t0trenmf ty1omt an ilt)trurirpiydalt  fesltf rrr( o;o4oetoio3tls s ul( snu4 rxnir3oytomte nvi;(0t2xmim no1ape lnvsat a2rrum ot0ole  fcils aDrlnmsnt)artnmfctodlpD lues ( seurxo3ny4amte nei s aDur( oot1tlxo o3ildfmDul(vp;t) lxrir3tydoate ueo ()trtm(mpno1lmee feias)aDraxrp;o0altomiciadlm rl(vp ()alxrmrcoa1fp  lueo ()t2um(r oy1apen ncs ( srta(ronu1tpto oeilsls2ran onu)aexrmo to1lmD lnvilt trto(rpoy1al nlfeilt)artau ooo1oexniietydla2ua( s (4alxnxoctotfpteai olt t2xmxm io4ape lnes s) 2rmum ot0aeto iciytfaDuan p ()tlerif tydfm raiei;(  2xrxr oydlmen ietasf rtax  ;t1alx moetasfaDeaumo t4trtnmf3ia1om e u ols0t2xmirpoudaltnlnesls aDtrxrono0tlt mi3tad s eanmp;u4trxnif3oydomD lies ( texoxo ny1alenmneils) rurxm oo4tlenmo3tys m2eauvont4tleoio3oo1faDeauvi;()t2uoirpoy1llt livsa()sDum(moot4olx  fctysls2eanvs;u)teenifcoadfp r neilt)sexmir3no4ol elnviasfarrax  nu1opxoifciyd s2rmnvo;t0 ltoxrcoydoatrau o;t0seuoxrpou1lmee iciat  Durxmo;u4tpt ifeilslm em( p;t0tetomo oodlmt  ues () etmimpiy4omee nvias) rrmump;u4alxn ietldfa2rmums;()aexnmocoytoaDrluvo s  2uo(mpiu1oltelfct s)s2urxmp;u4apeomiciys a2ra( o;u)tlenio3ty1lat an sl(  rtrxm3no4om  mfctls) Dumxrpot0opxnmfeiysfm rauvont0tlenxf3tatop r iei ()setr(o3oy1lm emiesasfsrta(m ;o4aexn i3tatls umn s;u)arenmr3tydlateli i t teuoxopnu1openmfctat) Drau ont1aeen oeils m el( pnt4 exoxo to1lm elnvols0srxoim3nu1lltn icsl()a2tr(moot1oeenmo3ilsla2ra( s;t4tlxnmf iatlpDranvi;s  2urxmpny1lm nmieia(f 2umurp;t1tpt ifciadfs2um( pnt0 lxoxf iadomD  i o;s0s2to(m oudal nlicta( artrurpnt4apxoio3iytlm emu p;u)aeenmo oo1fm  lu s;t) rxo(mpnydaltemfvtlt  ruaxr nt1oeeoio3ils a rmnmsn(4 rxrif to1fa rln s;s trtrxmpiy1op emnet (fs2tmxmono0opxnifciysfa2ea( s ()aexnmr ootomDelues t)trxoir3ny1amtnmfcsl( aDrrxro;o0tpxnio3tyt a2rm(mp;u) leomr totopDraneilt0t2toim iudaltnlfcsasf rrax o;o1aeeo fciasfa em(vp t4treoxf iatla elnes;s)truoiopiu4alenmnctltf 2tm(m nt0apx mictys m ea(mp;(4trxomfcio1fp  au ilt0 eur(opno4olen nei s  2umxmp;o4tpxomociaslsDrmnvp u0aeeoir io1fpDelues;()trxo(mpno1amenlneilt  Dra(rpnt4altomoctas m rl(vp t0 reoir oy1fa   nesl(0t2tmirpnudale mncias)srrrx p;u0alenmoctydla emnvp t0teenxrcootfpDr n o;(0srumim3ou1lptemfvtlt s2taumonu4tpeoifctyslmDrm(mp;()aetnmr ta1lpDeai i;(0 2to(o3io4lmte ncil()s2rr(mp;u0aet mi3iasfs eauvo u)treoif oy1la elneilt)trumxr nu1oltn nes sfaDurxrpno0tpxnmi3iad m ean o;(4artnxfcoytlpt lieo (  2tm(r nodomtnlfesl(farurxro;u0tetomiciysla ea( p;u)trtoif3ty1fm elivi ( trtmiopnu4am   ivsl()arrrx  ;o0olx mietaslm emnmo;t4treomr3oadfaD  n sl( sexmxo no4olt  fcs t a2ta(  ou4aexnmociydls emnmp;u4aexnio iy1lp elu s;s s2xr(rpoodlmen fvtat  Dta(rpou1oexnmictadfm emnmp (0 etnir3oadfmtr ues t0srur(opoo4al  livt sfsrraumpnu4opt mf3iytfs rmuvp t0 eerxo oytfmtr i sls  rtrxr3oo1lpeemivt t) Dua(rp;u0olxoii3ils sDrm(vo u0arxnioctytfaDeauvilt)setrxm3oy1alen neia()a2ur( ont4oltnio3iysfm2ra( snu0aetnir oy1fatrlues;t t2uo(m io1oltnlivs t)srua( poo4tpt  ociltls um(vs t4texnifcoytlmtr uvs (0t2xmxopiu4apt mnei s)sDrr(m no4altomfctlslm2uanmo t) rtoifciotoptr uvslt  exo(r no4lmeemfeta( a2ra( ont0opxnifciaslm2em( o (4texomf3oy1lm raneol(0teurxrpoydopeemfvta(f 2raxr no4oee ioeiad m2umnmo;(0alxnxf ia1lp rau i;s trurimpiu1om  mfcta(fsruru o;u4olxomo3iyt aDeln onu0 eeoxf todlm ranvi s0sexriopnu1opeemnct s srtr(  nt0oetnifciys s2rlnvpnt0tetrir oo1oat lnvo s) etm(m iudaptemnvil( srurxrpno0tleo fetlsfm uau pnt4 etnmf3to1lpDrlues (0 eumxo3io1ol eliciltfsDta(rpou1apxo oeiatfm umnmo t4teeoifcia1faD  ivs;t0 2toxrpoodllenlfvsls  rraxm ;o4olx mfciltlm2rl(vo;u4tleoirctydfmt lnes;s0trtm(o iodopen icsatf 2rr( pou0tpt  ieiysla eauvpnu0 exnif oytla rli il(0setm(o iy4ale livia()srrmx  ;u4oexomo3iyt mDea(vs;u0trxoxociydoa   i o;s  ruoim3nu1omte nviat arrmx pou0tleo feias aDuauvp;() ltnxfcoadlmtr i i;(0t2tr(r oudam   fctls)s2trurpou4aex  ocilsfs elnmpnu0 eenmr ia1latran s ( srxrio3oodlpt  fei s)artmu  oo4aeto oeiyt aDra(mp;(0aexomf3iodfa  lnvo t0teum(rpnudlmeemfei s s2rrumont1aee  fcildlm rl(mont4 leoxocta1oate ies t)t2tmxm iu1amt micsat)srtmumoou0tltniiciatfs ua(mp u) rtnio3totfp  an ol()texo(rpou4amee fet s sDtm(rpot0tpt  i3tltfm2el( p;(4tltoxo ty1laDe n o;s  rumxr3oy4lm nlfvt t aDuaumo;o0aexnmi3iadfaDraump t)altoiociadomDeaueo s0 etmxm3oudom n fct tf Dua(rpot1oexnmo3iyt s2ua(vo;(0 exoio3oa1om r ivi s0sexo(r iy1ll nmivtlsfsrururoot1tlxo fetyslmDra(msnu) etrxrcoy1optr n o;t t2umxm oudap  lieiltfarrmx ono4alxoii3ildlsDranms t0teenxo iodomD  i olt)srxr(r3ou1amenmietls) rrrxr ;t1aexo ictydlmDrmnmp;t4arenxf oytfm eanvs t0 rxoxo nodolen nvt (fs2tr(ro;t4olxnmf3tltla ran o t)tleoiocoadop eai o;(0seurxopoodalt livs ( a2raur ot4alxniictat m2ranmp;t0alenxo3oa1fp  ln slt0 eumio io4alenlivtltfs2tr( p;t0tpxn ieiasfs2rmnmo (0artoxr3iatfp eluvslt)t2uoxr oudamte ivs t  2tmumo;t1alxomociasla eanms;u0artrifcoydlatr neols0t2trxm3iu4lptemivias) rtaurpno1tlt  feiad a2ulu ont)arxrxfctytlatrlneo;( teuoxr ny4ame mncsat) 2rmxr oo0tltoio3iysls ulu s u4artrxocio1fp elues;(0 2um(opio4ole  ietasf ruaxmont4oexomf3ils a rmnmsnu)aleomr iy1omt aneols) 2xmim no4aptnliet s  2um(rpoo1oltnmfciatls rln s u0alxnmrctodoateaueo t  2urxo no1am nmiei t sDtrxrp;o1altniieilslaDuau o u4 rtnio totlatr nei t0s2tr(r iy1lle mfcsltfa2ur(  oo4tlx if3ilt m um( p t4 rerio ootop  lnvils0seurxm3nodop nmiesas aDumx oot4tpt  iciad a2rlu o u) etrioctydfaDraieo (  rxoimpoo1lle  ivils  rrax pnt4tpe moctat a2rlumonu) rtrir3oadoa eai slt) 2tmir3ny4ame  netls) 2tr( o;t1tetomo3iatlm uanmsnt4 rxriociodomt  ieo t sexr(o3ny4lmt  fvta(farrau  oo4oeenio3iysfs2ranmsnu)tlenmo3tatfaD  ies ()sruoxr3oydame mfvi s srur( pno1alxo fciyd a2elnms;t) renmf3totfa r ivi ( s2xrim3iodapt  nesatfartr( pot0tlenioeiltls rlnvs u)altrxf3oytoat  ieo ()srum(opoodapenmieslt aDurxmpou0tltoiocildfa rl(vp (0tlermrciydlpt ai il( texo(m3iu4ameelncslt sDtrx pnu1aetomi3tat aDean snu0alxrmf3ootlmDrlueo;t trxoxrpnu4lpe  nvi t s2tau onu1oetniociysfa2ea(mp;(4 exrxf3iy1op  aneo;s)setrim3io4llt mnvilsf rur(mp;u1tetnmieildla em(vp;t)trermf oa1opD  i il()s2xrxr3ny4lmt mfet (fsrurxmooo0opeo o3ilslaDelump;t4tlenmrctatfpD an o s)teurir nydlpe mivi t  rumxrono1tltnmfciatfa2el(vsn(0tltrxfciytfa rlneo t0 rumxr3ny4al  lict (  Drm( oot0tpx io3iad m ul(mp u) ltnioctadoptrlues t0s2xmimpno1omen iet (f Drr(ro;u4ale  fcils m rmnvon(0 exoiociytlaDeau o s)srtoir3nudomtemnctl( srumxrono0tpt mieiadfaDrmuvon(0arerxf3oo1fp rln ilt0trxmxo3nodlm elncilt srtm( ooo0aeeoio3tld s ul( p;()trerxr oadoaDe neo ( s2xo(rpou4apee fct s srraumo;t4olx  i3ild m2rlnmo (0trxoxoctotlmDrau o;t)srto(opoy4ll nmfesas a2taxmont0teenio3iyd a2em(mont4 rtnmf iodlpteauvslt)s2uoirpoodamt  iei (fa2rmumooo4olxn f3tatfm2raump u0arxoio3tadom   ivi ( trto(o iu4om n ivilsfsrtax ont4tex mo3iad aDulnmp;t0artrxfcootoaDe nvi (0setoxr oy4om  lfvsa(f 2tm(r no1olxomf3iltfa2ea( pnu4tlxomf ty1om r n s t  etrxo3no4lp emfvtl(f rtmx o;t1olx  feiys aDrln o;()trerio3iadla eln i (0s2ur(m oy1ol e fetl( arua( p;t1oeto octydfmDuau pn(0tlxoxrcoadfaD aivs t0teumio3iu4opee ieilt s2taxrpou4tpx ioetlsla2ranmo;()tltrxo3oydlm   n o;t)setmxmpoydamtn nvsl()arrrurpnu1oexn fctas a uln o t0alenxr iodoaDrluvs;s trum(mpoudam  lietatf rrmx o;t0altnii3ilt a2elnvp u) leoir iy1fpD  ueslt0srto(m3iy4lpt lfvil(f rua(mont1tlto f3iydfa ulu snu4arenif oy1latrluvi t)t2xmxm3oy4ame  neiat srrrxmono1tlxnmf3iadfsDuauvs;t4arxrxf3todlpD lieolt0s2tmxopnu1olenmict t) rraxr ot0oeeo oetadfm uan o ()tltrmf tytfa  aivolt0sexo(rpio1ope mfvsas)s2urx oot1altnif3tys sDumn p t) rtoifcty1lat  i ols)setmxmpoy1ame lfvsls) 2ra(r ot0tle  i3ildfm el( o (0 lxrif oydfm r ivils trxr(o3ou1llenmieiltfa2truroot1optomfeiydfs eau p t0 lxnir iodlp  au s;t srxo(r3iydol elics tfaDtmxrpnu1opeoioeiltlm2umumsnt0trxnmr oytfm  ai o;s0 rxmxr oodamenlfvia(fsrumxmoot1tpe mieiysla ul( p;(0 rtomf3iydfpDraieil(0 2xrxm iy1alenlieias aDra(mpno1aee ifciyslaDranvpn(4alxrmrcoytopt  nvo;( teuo(rpnu1omt licta()sDumx o;u1oetomicildfmDua( snu4 lxoiociy1omte u olt) rtmio ny4lp  lnvia(  rtm(mpot0tlxo f3ils m ul(mont4tltnirciy1fpDrauvo;( srurio nudope  nvtat)aDtrx o;t4oexnmo3iys m2rluvo (0 renio oadfpDraivi (0 2xriopoydamtemfcilt  Duaxmoou1oetnif3iys mDeaumo ()tetomr3to1fmteli i t)teuoimpnudlpt mictlt aDtrxro;t4apeomociytfaDua( p t) eerxf3tadom   ues t) etmio3oy4lp  livs t arumuro;u0opx iociatlsDemn s ()arxnmo oy1lm rau slt  etmxopoo1lltn fvilt arumxmont4tpe moeiydfm2emump () reoir3oatfpDeaivol(0 2tmimpnodome  iesa(  Drm(rpot0opeoioctydfs2elumpnt) etoxr oy1omtrlueo s s2um(r oy1lp nmicilt sDtmx  ;o1teenmieildfsDemump;(0tlxnir3oo1fpDr nvs (0 etoxo iu4open ieils a2uaxmonu0tpxo oetldls rmnvo;u0aeerxf ootfp  ln ol(0 eurir ny1am  mncta()srrrxmono4aee ii3ias s emnmp;t0aeeoxr3oytom  lnvils  eumxr3no4ap emnvslsfaDtm( ono0alt  octadfm eln sn(0tlxrif oo1fp rai o;(0 rto(m3oy1altn fvi (f rrrxmpnu1aptnmocilsfaDra( sn()aeerxo todomDeln s;s0setm(m3oy4am nmnvi s)sDumx ono4tpx  fciytfm2ua(mpnt0tlenxr tytlmt aiei;t0s2uoir3oydome  nvi (farrmxm ;o0tpeoio3tyd m2eluvp;t4tltomocoydoaD auei;s s2xrir no1lmtemivi tf Dtm(r no4aetomiciytls2uanvo;(0aeeomf totlm eli ils)t2um(m3iy1apte nvt (fsDua(  ot0oeto fciasla2umnmp;(4 eenmr3ta1lmtrlu ol()t2urxo3nu4lpee ncs s)arrru  oo0tlt  i3iadfaDumu o;u)artrxfcootfaDr neols) exo(r3oo4apte nvtls)aDtauro;o4tpx  f3iyt sDranms;(4 rtnxfcoy1fat livsl(  2xrxo3oy1lm  lfeia( s2tm(m ou0alx ii3iydlaDemuvo u) exrmf iydla e ueo t0srurir3no4om emfctl()sDrmx  ;u0apto ictad m ra(vs;t) rxrmf ta1fm rlivslt0teum(m iy1llt  fesas) 2rmxmp;o4alt io3iytfm ulumont0 rtomr3oydla r n o s0srxr(m3no1optnmfeils a2tmurpot0opx mf3iytfm2umu s;t0 renxo oo1lp   n i t0tetm(r3oy4lle  fci t artax  ot4olxomoeildls2elnvs;(0trenmf oo1om raues;s)t2tmxm3nu4olenlnvs sfaDtmxrpoo0oetnifeiyt m emn pnt4 ltrif todfaDr i s s  2uoiopiy1oltelncsl( srrrxrp;o0alt mf3tldfaDeanvpnt)tetnmo3ta1laDrlu olt  rum(m oydlm nmnvia() 2rau o;o4apxomocildlm2emnvs u0tleoir iytfaD lieols  ruoxm3iudlp  mfvi (  Dum(  no4teeomieiytfs2ranmp u4tlenmf io1oaDr ivi ()sexrim oo4lle mfct tf 2rmu  ;u0ole mf3iat s ea( o u) ltomf3tatoptr neilt0 2xrirpno4ol emnvtltfarurumono4apeoiietydfm em(monu0 lxnmr3totla  ln i;s)srumxrpiu4lltnmies (fa2rmx pot1aetnifciytfsDemnvp;u0teerxr ty1lateai s t)t2uo(rpou4lmte feiat)sDuru ono1tpe moetasfa2rl( o;t4arxoxrcoadfa rlivslt)trur(mpno4ame  fct s) 2raxrpot4olt ifeiatfmDrl(mp (4 rermo totfa raies ()trurio3no4amenlfeta(fsrumxrp;t4tpxoif3tad m rmump t0arenifcta1lp elies s t2xrxo oy4opt lfvt sfa2taxr no4aetniietydlaDel(mo;t0tlerio3oodfaD  i s;() 2umiopnudapeelfctas a2taumpot1tee ifetls aDrln s;()tleoio3iy1omD aieo t0 2urirpiodal  lnvtl(fa2rm( pnt1apeo fcildfm2rl(vo;t)areoxo iodomtr ivs ( texoxr iodop  mnvt sf Duax  ;u1texo iciyt s2um(mp t4treoircoydop  aneslt0truo(o nu4lmt mfcs t  rur( pnu4texoifciyslm2rl( s u) lxomr3tytfpt anvslt0 2umxopno4lpt liesas) Dum(mpnu0texnmfetadfm uan o;() eenmr3ootomteanei s  etmxo3nydlm  livils) Drm(mpnu0openiictydls um( o t) ltnif iydlpt  ivi t srxrxm3no4lm n icil(fsDurum ;o1aetnmo3ilt m2uauvs;t4 eeoxfcoodomD lu i;s0t2uo(o3oodale lfcs tfsrua(rpnu0olen oeias mDumu p;t4teermfcto1fm  aies ()tetmiopoy4apt lnvi sf 2ra(m ;u0tlx mi3iatfaDra(mo;t4 etoif3oy1fmDean olt srtoio io4lpt livia()sDuaxm ;o0oeenif3ilslaDranmo;t0altrifctytfa rlies t0seurxrpoydole mfvs () Drau ono0tpeo ociaslaDum(vo;(0 lxoirciadfm elueslt0 rxmim3nu1lptemivilsf 2tmxmpou1oetnmi3ild m um( on(0arxrio tadopt  i ols  2trir iudlp nmneta()s2tm(  ;o4optn o3tasfs eanvp;u4tltrxoctytla  li sls  ruoio3iu4ape liviltf Dtrxmo;u1opeo oeilsfa emuvpnt)alerxo tydfate nei;t0s2urxrpio4opte nci (faDuru onu0alx  ietad a umn s;t4trtrmrctydoat lnes s  rxrirpny1apenlfesas a2tau p;u1tlxnifciys aDrl(mo t4trxomrcoatfatrln i (0t2toxmpoo4op n feslt sDrmx  nt1tpxo octadfm2um(vs ()alxrif3ta1lpDrlnvo;t srxmxm oodap   netls  2raum nt1tpenio3iaslmDrluvpnt)tlerif iodopteaues;(0texo(m io4amenmies t) 2raxro;o0oee  ocias s2uau o t)texoxociytlat  u o ( s2tm(o nodopt lncs (fa2urxr ;u4opt iictls m2ul(vsn()arenmfcoydomD li o;s srum(r oo1lmtnlivtas  ruax  ;u0tetnio3ils a rlump () ltoxf3iatop r i s;(0trurxo3nu4omtemfvtltfaDtru onu1aetomfciadfaDuaump;t)arenmr3io1latelnvo;t  rxm(mpiudlltn ncia(faDuaxrp;o1apeoiieiat m rmuvp t4trtrmo3oo1op  aivil()trtoxmpnu1ll emicsat)arrax  nt1aeen o3ilslm em(mp t0 exnio3ta1lmD  u i;t teto(r3no1optelneiasf Dtrxrpot0olto i3iadlaDraumsnt)artoif iydlatranvo ()teto(r3oy1ll emivslt)arurx onu0oeenifeiadlm em(vsn() rtoif3oo1omtr nvo;(0 ruoxr iu4lm n nvi sfsDrmur ;o1tpenio3iltfaDumumsn(0 rxnmf3iydoaD anvi;t0 rtrir iy1ll nmfvilsfsDraxm ou0aex  ietaslaDemumpnu4aetrmo io1fa rlneo;(0trto(o3oydamen nesasfs2taxmpnu1openio3tas a2em(mpnt) leoxo3oytfp r nvi;s  etoxo iodoleelivi (faDtmu  nt1olxnii3taslm2ra( s;t4 ltoioctadfaDe uvi (0teurio nu1oleelfeia(fsDuau p;o4opt iieiltfs umu o (0 exoiociodlmt  neolt trtoxo nodomtelneta( s2tmxr ou4ole mf3tat a el( sn(0aetrifciodfpte uvi s) exoim no1al  lfvsls srrmx p;o0aee mi3ilt m umumsn(4aexnxo iydfpteai i;() 2xoxo ny1amenlfct (fs2rr(m nu0oex mociadfm uanvon()altrmociytfpD  i i;t)teto(o3nydomtnlnvil( s2urx poo1opxn o3tls m2ulums u0 rxomrcta1fp  lu ol(0 rxo(opiu4lm nmfvias)srta( onu1olt mieiasfsDul( s t4arxoif3oadlaD lueslt)teur(m iydlpe lies t s2tr(rpnu4optn oeiadlmDea(von(0artomf3tatomte nes;s0 etrxrpny4om  lnvslsfs2tm(m no4teeoio3tldfmDemnvs;()arerxfcoytfmt an i;( t2um(r3oo1apeemfesl(f Dururpnt4apenmoeilsfm emu snu4trtrmfcoatopt lu o ()setmiopoo1oltnmfesas srrr( pno0aexnmoeiad mDuaums;(0artrif oatoa e uvo t  etr(mpno4aptnmfes s)a2tr(  nt1oetoioetltlm2uanvp (4texrmocoodfptrauvils  etr(m3no4op   fesl( srum(rpot0texniieiytlm ua(ms;t0 etrifcto1omt  ivolt0 exoxopoodllee netasf 2uru p;u4tptnifciasls2ea(vonu0artnif to1oaD ln i;( seur(m nodopt lictatfs2ururoou0oleomfeils s ran p u0 eeoxf iy1fm e neslt0s2xmxm ou1apeelnvsat) Dur(  ot4ole ifeiysfsDrl( p;u0trtrmr oydfaDeai o;()t2xmiopoy4apen nes tf rumxroou1alxoioeiasfs2umu o (0alxrxo totoaDelu i;s  etmir oo4lpt  ietl( srrm(mpnu4oexn f3iysfs ul(vs;u) exrio3iotlateln ils)srum(o3nu4amen fesat)a2rrx o;u0optniictld a ulnms;(4tlxnmr oatfatrli s t0 2trxopio1omtnmnvsat srtmx pnu1oexoii3ils m rl(ms t4 eermrciodfp  auvo;s)trxrio oy4apte fcs t) 2um( poo1oeeomieild sDea(vont0altoifcoydoaD anvi s0t2toxmpiu4lmenlicta( artmu  nt4alxnii3tls s rau s;t4aexoio todop rlueols0srumxm io4ale  fcias aDraxmpno1oet  iciatfa2emumsn(4aetrmo io1faD  uvo ()t2tr(m3iydomt  iesas a2ra(mono1texnifeiadfm umnvs;u)arxoiocia1op eaivilt)srtr(r3no4amtemictl(f Drmurpot0aex  ictltlmDum(von()aexnif tadopD anvo;(  exoir iu4apt  ncias)s2rrxmp;u1oee  f3tyd sDumu p;(4 etnxr iytla rli sls0 rxo(rpiu1am   fcil(fsruru  ot4aetnmocilsfa2rmn p t4tlxnmf3tytlmD li s;t)t2xmio oodomee ieilt)s2taumonu0tpe  fetyslmDuauvpnt4teenxr3oytlmtrliesls)texr(m ou1oltnmicias)aDrr(moot0optniociydls ulnmo;u)teerifciydlp elivils  2xrxm ou4apenmfvsls  Duax o;t0apen ictlsfaDuanms (0 rtoxrcta1lmteanvi t0seur(r3iu4ope  ivsasf 2trxmp;o4tetnmfctys m ra(vpnu) lxrir3tytfmt  i o;t  2xm(m iudalenlnetlsf rrr(mont4oex ii3ilt s2ranmpnu)teenxrciy1fa ranvilt teumxo io4alt  fvt s a2urxmpoo0tlx  fctldfm emn sn()texoio3iydfmDraies ( srxoxopoydlle lictatfsrrrxrpnt0apx iiciysla emnmpn()aetnmo3oadoaD  u s t)trumirpiy1lme lfesas) 2um(rpou1olxniictysfsDem(vp u0 rxoif todomt  nvols srurio3iy4lm   fcsa()a2tau p;u0openmf3tytfm2ranvpnt) eermrcoodfaDrauvo s)teuoim3iy1olen nvt (fa2rmx p;u4olxnmoetlsls em(vsnu4tlxrmo iadfm e ivsls  exm(rpno1open nesatfaruaumont0opx  iciadlm2el( p;t4 rxnxr iatoaDr i olt seuoio ny1ll elfctlt  rurxr ;u1olxo feiys sDuanmpnu4trxrmrciodlat aies t texrxmpnodlp nlfci ()a2raum ;t0tlenifeildfaDeluvs;t4tetrxf oadlat  nvs;s) rumimpno1olenmfet tfaDurx  ot0tpe iieiaslm ul(vs u4texrxocty1fp  lies;s trtmxr3oy4altn ici s)srurumont4ape if3iad m em(mp u)tetnmo to1la eln o;( t2tmir3no4lm  lfcias)s2rau  ;t1tle mictlsfaDrmn s ()trenx
\ No newline at end of file
@@ -0,0 +1 @@
+nvols)s2xoxm3iy4op  mivi s artaxm ;t0tpxnifeiasfsDra( s;u4teerir3tatlpDr uvol()trxm(m3ou4aptnlnvt tfsrtrum ou4oexomieiasla ulumsnu0aexrmo3oodlaDr uvo;t)t2urio oo4amt  fcsl()a2rr( o;t1tpx iieiytfs2el(vsnu0trxrmr3iydfpD lues t) 2trimpiydap nmfci s  2um(mpou0tpe ifeiltfa emu ont) lxrxr ootfmt livs;(  etoxopou4am nmicslt  Dtr(mo;u4optoifctadla rmu s;u)tltrir oadfpD luvslt) rumxr nudol nlfvslt  2rrx onu0olxnmoeildfmDem(ms;u) etnxr totlm  auvo;t0t2xoim3oo1lpenlici t)sDtm(  ou4aptnmi3tltla eaumon(0aetomr3tatlmteluvs;s0setrir nydaltemnvsas) rtm(mpno0tex  f3tys aDem( snu4texoxf iydoat auvils)truoxmpoy4ole  nvtltfs2ta(mono4tetn o3ilt a rm(mp u4teeomfctatlaDe iesl(0trxmim oy4ap e fci (  rrmxronu0tptn feiydla eanms t0 lenmf3tydfmDeauvolt0 eto(r3ou4opt mnvias  Dta(  nu0aeeomociasfa2elnvo t)alermrcoy1fa ran s s trurxrpiydop nmfvtatfs2tmxm ;t0oetn f3iyslm rlums (4 eerio3oa1lp   uvols0srxoxm3iu1llenmfvslt s2urx ono4olt iieiysls el(vs u0tlxrio3todopte u slt s2urirpiu4ope mneta() Dur(m ou0tle if3iys a ulnmp u0trtnio tadfmt  n i;( teum(m iy4lm  mfvilt arta(rooo4apenmoctys mDumnmpn(0aexomr3io1fpteau i;()s2urxopiy4olenmieia(fs2tau  oo4tpxnioeilt s2ra(mp;(0trxoifciydoa e u il( s2tmir ny4ome mfes t  Dtaur no1tlx mfciydlm ra(vsnu)tlxrxf tadfaDrlieils0 etoxo3iy1lm n fcs tfsDum(  nt4ape  ociad a rlu o;t)artoxrcoatlmDeliesls)seum(opno4omtelietat srta(mpno1olx if3ilslsDrm(vs;u0 rerir ootom eluvs;s s2urim io1apt lncs tfa2uaxmont4aexo feiadla2em(mo;u4 ltrmf oytlmtr nvi;()texoxm iu4om e ietl()a2rm(m nu4apt mfetytla2elnms;(0arxnmo oodlaDrln i s0 ruo(rpnodal nmncsltf Draxmpnu4aeenmf3ilslm2umu p;t)aexrxf3oytlmDr nvs s0seuoim io1ape  icsas)a2uau p;u1oeto feias m eanmo ()altomf tadlmDrln i s0 exoir oy1amtn ivsatf 2ra(m oo4tex  iciydlmDea( on(0 eenxrcoytomD  ues;s)sexm(opoodam elfctltf rta(ront0tpenio3iydfaDuanms u)tlxoxo3ta1oa eln sl( t2xriopiudom nmfvsl() Dtm(ronu0aetomieild s ra(von(0tltrxf oo1oatraneo;s seum(o3ou4opee nesl(  rtmumo;u4tetomi3tlt mDum( p;()tlerxrcoa1la rluvo;t)t2xr(rpny1llen fvt s)srtr(rpno0ope mi3tadla2umump t0artoircty1fateaueo;(  rtoio no4lpt  ieta(fs2ua( pnu4texn i3iatlm2ra(vont0 rxomo ty1oateaivil(0s2xo(o oo1lltnmiesas a2urx  ;t0oexoiictadfaDrl( s u0 etoif3io1opDelueils0 2toxm oudll nmfciat aDtmumpno1opeoifctldlaDulnmp;(0 lxoxr iodopDr nes;t0 rxoxo3io4lltn ncs (  Draurpou1aexnifeild a elnvs ()texrmf oodlp e uvo;(  2tmxm nu4op nlnes s) rrr(ro;o1tpxnif3ias s ul(vpnt)aetrmo oy1omt an o t0sexrim io4lm e feiasfsruaxmo;u1olxomf3iatfs ulu s t4trtoxrcoo1fpt livils0srur(m iudap n fvslt s2tmu p;o4altomoeildlaDrmuvs;u0 ltnxrcoo1fp raueilt)trxrxr oy4oltemnvs tfs2umxr ;o4ape  f3iysfm2rauvpn(4 eenxo oo1lmtr neol( s2uo(opnodlm elicilsfaDumx  nu1aetn octlslm emums;t0tetoxf3iy1latrlnes;t  2urir oudalee ictat)artax o;u0alxomietaslsDrln o t4aleoifcty1lpDraueils0 rxo(o iy4lm  lncsas arurumooo0tpxomoeiadlm em(mo;(0trxrif3totfptr ieil()s2uo(r iu4omtemfciat  ruau oou1oee miciydls2rm(ms t0tlerio3iytom e nvolt)srtmxm oy4ape lfvta(fsrtmumo;t0optomiciydlaDulnms t4aeerxo iytlmt  n i t) rxmxr3nodamtemfetltfs2taxr ;t4aee mieiadfa ulu p u0texoxr3to1op  auvil()t2ur(rpny1optemfctat sDtmxr ou1olxo ociytfa2ul( o (4alxrxrctydfpD ln i;() rxoxm nu1lleemfesat a2tru  nt0tpx  octysfm2eluvsnt0 exnir3ta1fp elieol(  2xmio3oo1llt livi ()s2ur(root0tet  oeiad s umn s () ltoif3tadfa eli slt) exmim3nudam elieslsfa2trxrpou4olx ii3iyt mDrauvp u4trerir io1lp  livs;(0 2toxr nydol   fvsas) rtru o;u4oetnmo3iadfm eanvpnu4 etoxf tatfp  lnvs s0seto(m3no4om   neiltfaDur(mpnt0aleo ieiadfs2rm(mo;t4aexrmo iotla  aivil(0 rtmxm3iy1alenlnei s s2urxmono0aetnio3tltfa2rau o u)tltomr3oa1lpDeau ols srxoxmpiodlm nlfctlsf rtr(ro;o0aeto ocild s ul(vp;(4 ltrxr3oadlpDr uvi;t s2tmxo io4om  mfvs tfa2raxmpnt0olx  ietldfs ra( p;t4 rxomo oadlpDeau sls0 rur(mpiu1lp n ivsat)a2taxronu0apxnioeiytlsDrluvo;u4 rtnxf3oydlaD aneolt)s2xmir nu4lltelfvi tf rraxr nu0aee mieiasfm2ean o;u0 lenmf3iydom   ueil( sexoxm nu1amtn nvilt srtaxmpnu0tpx iocias m2eau pnt0altnxr iadomtrlneo;( srum(r no4ale lfvtas)aDrauront0oet mictltlaDuanvo t4tlxnmr iodoatrau s;t srtoxr ou4oltn ivi s aDumu  ot0tptn i3ildlm2rm(msn()trxnxo iytom eli sl( srxm(m3nudalee icilt) Drau  ot4alxnmoeiyd a2uanvsnu0aexrmr3io1lp  aueo s)srtrir3oudal e ivi sfartrum ou1tleniieias a2umn o u4 ltrxfctydfatelnvi s  2umxr no1omtnlnvs () rtm(m ;o0aptn ietas m el(vsnt4 ltnxo3iydlp rli i s)srtmim3nu1olt mivilsfsDtau pnt4tpxnifciasfmDemn pnt4tleomrctydopDr u o;s0 2uo(opou4lptelnesl(f 2trxrpou0apxoio3iys a uan o u)trtrxocoadlp  lnvol(  euoio3iu4lpte nvtas) 2tau  nt1oetnmicild a ulump ()teeomf3ia1fp eluei t) euoxo3oodlm nlfct tfs2tmxmoot0oeen octasla rmn onu0treoxr3oodfatr n sl(0 2xrim3no4ome lfvias) 2ur(  nu0ole  feiytlm rmu p u0trtrir iy1fatelueo;t texmio io1aptnmiet (f rtrxr ;t0apt ii3iatfa eluvp;t) ltrir oy1latelivs;t)texoxo3no4amtnmnvtlsfaDtr( pno0ale  fetys mDum(vsn()arxrmoctodom rlueslt) rumirpio1lltemncs (fsrrrur ;u0texomo3ilt s ra( ont0 eenioctatfp rln i (0sexr(mpoy1oleemici t) 2rm(mpoo1alxo oetydfmDeluvsnu)trxnmo oodlpt auvol(0t2trxo3ny1ll  lfvs s) Drauroot1aeeo i3tlt s em(mp t4areoio3ta1lp eaivs;s0trur(opny1lleelncslt  Dum(m ;u1oetoiieiys sDea(mo (4 eerxr iytlpte n ilt  rxrimpoodllee nesasfsrurx  nt1aexnifetyt s2eln onu)artomocoytoateanvo s texoio3nydaltelnet ()artrxr ou1oeeomoctaslsDum(vo;(0artnif iodfm  anvo t0 rxoxo3nudomenmnesls aDur(mo;t1tetn o3iyt aDem(vpnu4 lxrxociy1fm e uvils  etoir ou4lmtnmfcsas s2rmx  ;o4tlxoiiciys mDulnmp;(4trtnmr3tytfateau s s0tetmxr nu1op  lfes sfs2rru pnu1apxo f3ildfsDeauvont)aexrio oadoa e nvo () euoimpiu4op  mivsltf rrr( o;o4opeoio3tlsfa2ua(vp;u4 eenxr oadfmte uei;( seuoxr3iy1lmtnmietat arua(  oo1teto fctasfsDul( p u4tlenxrcoa1laD aivo;(0 eur(opio4lme miesasf 2taumpno0tpeoif3tlsls2rmnvs ()alxrifctadfm rluvslt) exrxo3oudomtnmnvtat  Draxrpno0optnifciyd s rm(monu4texnmf3tytopD au o s0 rxmio nu4openmfcsls  rtmu  oo4tpt mieildlm2rlnmo (0 rxoio ootla  ai ils srtrxr oo4ome mnctas arrmurp;u1opeoifciasfaDran s u)artoxo3ty1oaDr neol()teum(r oudolee nvtas artm(rp;t4aexnii3tldfa emuvpn(0arxrxrctatopDeaueo;t)t2xo(r3io1aptnlnctls artm(m ;t4tex ifciysls2em(mp;u)artnmociy1lp rlieo;(0 2xr(o3nu1apenlnet (f 2raxm ot4oex  i3tld sDumnvpn(4texrxr3ty1oaDr nei;t)texrir3io4optemncslt) Draxrono1alen ieiytls2uanmont0alenxocoatoaDranvil( sexmxrpno1lltemnciatfa2rmxr nu1tpeoifeilslsDea(mpn(4 etnif3iatfmt lnvo;(0seurim iy4apt  nesa(  ruau  nt1altnmietyd m ulnms;(0aetrir ta1omD li o s0s2xoim3nydop   nesl(faDra(  oo0alto oeiydla umuvsn(0alxrxf3oadfm eai sls  rxo(opoodale mivsatfsDrm( ooo4alx mfeiyd aDumuvonu4arxnif ta1fm  lieils0srur(o no4llee nviasf 2taurono1alxn fetyt m umumonu0texrxfcoodoatr uvi;(0 rtrxmpoy1lltemicsa(fs2tr(rono4aee ioetatlsDeanvpnu) lermr3oo1oa  aivils0trxrxmpiu4om   net s)sDtrxmoou4olxoif3iysfm elnms;t4trtoxr to1lptranei (0 rto(rpoy4altelietl( srrrumono4tlxo ictyt m2rauvs (4 rtrir iatfpteauvs t truoiopoy1op elnct ()a2uaxmoou1tpeo i3iydfaDem(vonu)texrir3iatopDrauvo;( teuo(mpnudamt mfvils) Duaxmono1olxoiietasfsDuaumsn()texnmf3to1lpt lu o;t texm(rpnodopeelnctlt  Durx p;o1aleomfciasla ra(mpnu0texrio3tytfp e uvi t0 rurirpny4ale lfetas)s2tmur nu4opeoioeildfm2rl(mo t0arenmf3iydlmteluvo;t)tetmxo3iydlpee iei (  rrm(monu4altnmf3iatls2eau o u0 etoxr3todfate i s ( trtoxm3iydlm n fes t aDtm(moou1alt  fciys mDuaumo;(4tlxomrciodlp   neslt) rur(r no1apenmnesat)s2ua(  oo1altnmi3iytlaDul( pn(0 rxrir3oodlatrlnvo;s  rtmio nudaptelfcils)srrm( o;u4apenif3tyt s umnvs;t4treoifcootfa rlnei;t)t2xmir oy1am nmfvs (faDtmxront0aee  o3tlsfa2rl(mp;(0aetrif3to1laDraueil(0setr(r io1ll n ics ()aDtruro;u1tltn ieiytfm umn pnt4altomr iy1fp rlneilt0 ruoxopnu1lltn ics ()aDtm(r oo4tpt moeiasfm2umnvs;()artnxf3io1lptelnvo;t  rxr(opio1lle lfesa(fa2tmxm nt0teen fetlsla emuvp (0 rxnir ia1omte n i t trtr(rpiu4omtelncta(f 2rru  nu0aex moeiysls uln onu4alerxr3iotop  lu ol()texmimpoodalee nvilsf 2rrxmoot1tlt  fciadls2rl( s;u0 rxnxrctadomtrli s s t2xo(rpoydamtemnvsatf rtru oot1oee mietytls uln o ()tltoircio1laDraivs s)trxr(r ou4alee iesltf 2taxmpnt4tlt iociaslsDemnvpnu0 etnxr todlpD  n o s0trurirpnydaltemies (fsDua(rpno4olto ieiys aDua( p;t)trerif tydfa eaiei t) exo(o nodomtn fcsls  rrm(ronu1aexn ictytla um(vo u4artrif oa1fpD  u i;t  2urxr3oo4opt mnei ( arrmur ;t4opxo iciat sDelnvpnt4altrxo oy1fm eaieo;(0t2ur(o oy1amtn ivsat)aDua(mpoo0aetomoetlsfa2rmuvpnu0 lenmf iydomt  ivi;s0 2uoim3no1lmee nvt (fs2tr(rpou4tlxnmoetyd aDumumsnt4aeermo3tadfa   u o s) eumiopno4al nlncil(f rurx  ;t4tex iociyt s rl( o;u4tltrxr3oytoaD au il(  etrim3ou1amt mncilt) Dum( p;t4opt miciltfa2rluvs u4 ltoxo oa1fpDeaiei ()tetoxrpoydam nmicilsf 2umu pou1alxoiieias mDua( p;t4 lenif oy1lmD an il(  2xo(o3oy1lmen nvsls)sDtau o;t0tpxnii3iadfmDulumon() eenxf3todom r n ils  exr(o iydlmeelfvtls)sDrr(rpnt0aet iieildlm rauvp () reomfctatlm r nvsls)s2xmxopno1lm  lnctat aruaur nu4aeto fetad m ul(vont) lenxocoadop   ues;s  exoir3no4ameemncslt) 2umxro;u0tlx  feias m2rlumo t0tetrmf iadlaDeluvil( setr(m3oodal elnvi t) 2rr(  ;u4alxo o3tasls emu o u0aeenio3oy1opt anei;t s2umir oo4lp n fet t) 2uauro;u1olt  ociasla2rmuvpn() eenmo oy1lptrlu s;t0srtmir3iy1amtnlivi tfs2umxmp;t0opto ociatfa ua(vo (0aetnxr tydfmDeluvo;(  exo(m3ou1lpt micsls)a2rax  no4aex  ieiat sDrmuvs u0 exrxo ty1fpD anvs;t0 2uriopiy4olee fcslt) Dtrxrp;t1opx  iciysfa2rmnms (0tltoxo oodfp  aueilt t2umxrpou1al emiviat) rta(rp;u0olx iiciad m2rlump (0 etnxr io1lpte n s;s0s2toir oy1lle  ivs ( srtau  ;u1aexoio3iatla rmu s u4 exnxo3ta1opDeli s;t)trurxr nudomeemncsat) Drrx  ot1tpx  fetysfs2rmuvont)texnmf ia1fpDelu sl( t2toim3no4amte nvs s a2tauront0aeeomi3tlsfm umuvonu) lxnmoctydlat lnesl(0 2xmxrpiy1lm emivs tf Dtr(mpno4olx ifetysfaDumumo;u)aeerxfctadfp rli ils trurxopoo4op elicta()a2tm(r no4ale io3tldlsDrluvs;t4artomociatfat lu sls t2xmiopno1optn ieiltfsDta(m ot0opt iietysfs2eanvs t4tltomf3oo1fpD  uvs t)texmxo3ou1aptn ivt s)aDtmx ono1alxoioeiadlm rau o () etrifciydoa r ieil()trxmim3oo1lpe mfvils aDua(mpnt1tlx ioetldfsDuau sn(4trtrmfcoodlptranvo ()s2um(m3io1amtnmictls)srumurpnu0alenioeiatlmDra(ms;() lxoxo3to1lptraneo () exrxmpiydam  mfcils)s2um(roou4tltoii3tlsfaDel( p;(0altnxfcia1fpteai ils setrxm3oy1op   ieta()srta(mono0ole ifetasls2rm(msn(4 leoio to1faDraivs;s0 2tm(m3nu4am   iet tfs2truroot0aex  feiytfa emuvp;t) exoxociadfmDr iei (  etmxr3ou4apt  nvi t  rtauroou1apen o3tltlm umnvsnt0tltrio3tatfm elieols) rxmir3iudlm nmfvslt) Drrxrpno4aeenmicild s2ean pn()arxoxo oodfpDrlueilt teurxr iydolt  ici (fsDrrxro;o1aee moeiltla um(ms t) rxnmrcootfateluei (0tetoxrpnydlpe  ies t) 2umxmooo4alxn ociaslm rln o t0tetoxo3todfptelueol()trtmxrpiudaptnlfetls a2tru poo1aet iieildla um(vont)aetomr3tytla  an s;( t2ur(mpoo4apen ivsls  Dtaumo;t0apt ii3iysfa rlumo;(4treoiocoatlpt  n i ( t2xrxr3iy4openmfct t)s2trurpnu0teto i3tld m2rluvo;t) leomocoydoptraiei t  2trio nudllee icsas  ruax  oo1alxo o3iadls uan s t0trenxf3oodlmtraiesls)trtm(o3nydomt  iesls) rraxrp;o0tetomfctlsfaDrmnms;() eeoxocoy1lp eauvs (0 etrio iu1opte fvi ()arraxm nu0oltn i3tls a2ra(vs t0trxnmo3oy1lmteaivi (0 2umxrpio4lmee ietl() 2urum nt1aetnmiciyt aDuanvp (4arxrir iy1oaDeai s (0tetrxm3ny4lme  feils)a2ra(mo;u0tpxn o3iydfm ulnvp u4altomf3ia1lmDe iei;( s2tmxmpny1amtelfvtls)a2tmxmooo4aptniociat m2ul(vs;t4 lxrxr tytfmtelivslt)t2trio iu4apt lietltf 2trxmonu4tlenmieiad a el(msnt0alerxr3ta1faDe nvo s0 etrio nodlle  ivi ( s2urumo;o4aptnifeilsla2ulums (4trtnxf3to1oatr n i ()seurir no4omt lneilt a2ur(  nu4alxoiieiydfs2eluvsnt)tetnmf3iytfm r uei;s)srto(o3nudlptnmnvtls)sDtmu pou4aexomoeiadfsDrm( o;u4 leoir to1faDrlieo (0trtoir iodlpe  ivi ( s2rm(rpou1tlxo i3iydlm2ul(vs (0 etoir iydlaDrlivo (0t2xoxopoy4oltnlnvi t  rtru ooo0tpxn f3ilslsDulnms ()teenmr3io1lmt  nei;() etrxo nydomen ivtat aDtmurp;u4tpe iieilsla2umuvsn() rxrxf3tatoa   iei t s2toxm3ny1lptnlnesltfsrrrumpnu4aleo o3iad aDra(mp ()aeeoio iotlm elueo s)sexoxm3oudope liet t srrm(r ou1tetniieildfsDulu o t4 lenmfctydoatrlu il()seto(mpiydom  mnetlsfs2raump;t4opt mociyd m2ul(vpnu4trtoxr3iadoptraneo;t  euoirpoodopenlivilt  rrmxro;t1oetnmoetatfm ranmsnu) etrif3io1latrai sl()texmio oy4lleelfvslsfartr(ro;u1aex ioeiatlm rln sn(0tltnmrcoatfm  aues s)teuoirpoydlpeelfvslt)artm(monu4tltn fcils sDrmnmonu)aeerxf oa1fpDeluei t0trxoxr iy4lmen fctlt s2urump;o1oeenmoctatlsDrl(vo (4artrxf3oatla rlies;t0setr(r iu1apt lnci t)a2rr(r nu1teenmf3iltfm2emu p;t0trxomo ty1omt  i i;s) exo(r3oy1op emnesa(fs2tru oot1tpenioeilslmDumuvp;u0texoxr oytfptr ivils srxmxm3iu1om n fvils  rta(monu0teenmoeiys a emnvpnu) lermfciytfpteln o;t t2uoxr3oodlptnlivslt s2uaxm oo1tle iicilslm2umnvp u)arermr3iatfaDrlneols0 ruo(m iu4olt lnctasf 2umxroou4oexn f3ildls rl( p (0 etnir3oydlpDraivol( s2xrxm3oodapt  nvsatfsDtr(  nu4oltn fciytfm2umn snt) rxoir oadomt lneol()teto(o nu4ol elfeslsf 2uru ont1aee mictysfsDrauvo;(4arxnmo totlmD  ueo s0tetoir oo1am e fci t a2rr(mpot4tltn fetydlaDrl(vo t0tlxnmocoy1omteluvi;s) etrir3ou1opt  nctlsfsrur(moou0aexo i3tas aDuln p;u4artnmocia1fpt livo;t)trto(o nudalt livt (f rta(  nu4tpeoioctydlm uanvo t0areoxo3oytop e nvo s)srxr(opnudllenmfci ()sDtau p;u0oeeoiociytlsDulnmo;() exrmocoatoa e uvo t0s2xr(o no1am n iviatfs2umurooo1opx  fctasfa2rauvs;()artoxf3to1la   ues;( t2trxo nydoltnlfet s) Dum(  ou4tlx if3tytla2ul( s t0aexoif3iy1lm rli o;s) rtrxmpoy4lmenlneia() rrrx onu4aee  ieiad m2ulu s;u0alxnxf3iotfm e ivs;()s2tmxrpoy4amte nvsls  2uru oot0apxn ieiadls2rlnmpn() etomrctodfm  anes ( tetrxrpiydoptemncsasfsDrauroot4tee  fetyt sDuanvp;u) lxrxociotfmtranvi;t t2xmim no4apenmnvta(fsDtaur nu1apenif3taslsDrluvs (4texoxfctodfatranvsls  2xoirpou4lpt lnctl(faDtmxmo;t4texoifetys a rmnvp (4 ltomf3oodlp rlu i;t srtmio3oo4alenlies (farum(mp;t0tex  feildlsDrlu pnt)trxomr to1lpt livo;()sexrxm3nudope mnes tfarraxrpnu4ope iieilsfm2el(mp u4teenxociytopDran o;s srxoir3no4alt  ieil( s2tm( pot0alx mi3tytfsDul( ont0teerio ia1om raivolt t2toxm3iudop emnesl(fsDuaur ;o4ape mo3iytlaDul(vo;(0 lermf iytlatrai i t)trtr(rpoy4lmt  icsasfa2raxr ;o0ope miciad aDua(vo (0alxnifcoytlpt liesl()s2tr(m iy4lle  ictl()sDum(ro;o4opxoiiciyt m uanms t) rxomrctytomtelnvi t)tetmxm oodolt micsls) Drmur ;t4oleomfeiydfs eluvpnt)artnxr3to1om  aivi (0teurirpoo1op n ncsa(faDtmumpnt4olto i3iltfm el(ms;t)trtoirctodlaDeanes s)s2umio ou1ope  feta(  2raxm ;o0olxomfciydlaDumnvpnt4trtrmrcootomDrauvil( s2uo(o3no4omtelnvi ()aDtaxront0apxo octlsfs uau p;t) rxnxf3todoaDraueo;t) exmio3iu1alte fetl(  2tmxmp;t0aeen octyd a eluvonu4tlxnmf3iydom  lneo s0 etrxm oudol  mfvsl( sDtm(mpoo1tlto fciytls ulu s;t) ltrir3to1fate uvsl(  2xoim3nu1lltnmivtlt)sDtrx pot4tle ifciadlsDemnms;u) etomr ta1omDelu o s)srtrir iu4lp   fct tfaDrm( oou1olt ioetyt s2ra(mo u4 ltrxr3tytom  ln s;s)truoiopnydaltemietl( sDtr( p;t0ole  f3ilslmDrluvsnt0 rxnmo iydfmDe i s;s s2to(m3nodope lnvi t s2trurp;t1oetomoctad mDrauvsnt0altrxr oo1faD au slt)seumxo oudlp nmfcsat) Drm(root4tpeomoeiydfm2em( p;u0aleoio iytfpDr ivsl() rumxopiydllenlfeta(fsrra(rp;o4apxomfcilsla emnmo t)alxomr3oatlaDrli s;t0 etoxm nodalt lfci t)arta(m ou0opxnmiciadla eanmp u0tlxnmocoadfmtr i o;s0teuoio io1olte nvt s) 2rm(  nt0tet if3iad a2um( s (0aexnxrcootfm rlnvs (0 2xrio3nudoltnmncsa(  2raum oo4oexoifeilt m ea(vp (4 ltnir tatopDr ies;s) rxoimpoy4optnlnvi ( a2ururpno4olxomiciltlm ea(vs u0 lxrif3ty1oatrlnvs s0setrirpiu4aptelnei s)s2um(m ;u1oetn ictydfsDem( o;(4aexoxr tydlaDrlnei t  rtmxm3no4lpt lfvsat  2uaur no1tlt iiciadlsDel(vpnu4 exnir3oo1fmD li o;t t2uoxo oo4aptnlietlsfsDururpno1oetomoetydlsDrmn p t4 lermf tadomD lnvi;()sexoxr3oydlpeemnci () rum(rpot0tpx ifeiysfa2rlnmpn(0tlxrxf3iy1opD lueils0 2um(m nu4omt lietls)srtrum no1aee  fetydla2um( p;t0 lenxf3ta1fpDrlnvo;t t2tmio iu4amenlict sfsDtax  ;u1aet  iciys s el(vpnt0 ltoir oatfp e uvo;(  rtrxr nodaptnliciltf Dra(rpnt0tex io3tysfsDumn o t)texnmo totom raieolt teto(o3nu4om e fvt s  Duaxmpno0tpen oeiasfa eauvs u0trenir oadfp e n o;()s2xmio3nydale lncs ()sDtaxmoot4optnio3ias s2rl(mont)teenxr3todoa r nvi t)setmim iu4ll  lfeiasf rtmx pno1oexomfetys s um(vp;u4 renxr ty1lmD ln sl( srtmxr3oudlle liet t s2tmur ;o1oleomoetlt a2rlnmont0trtoxf3ty1latr ieilt) rxoxopny1om nlfvtlsf Drrum ;o1oleomoctytfs elums u0trtrir ootlmDeaneil() 2um(o3iy1alt lnci sfsDrax p;o1oex  ieiatfmDua( s;(4artoio3oodlm eluvi ()t2uo(m nodaleelnvsl(fs2tr( o;t1alto feiatfa2umnvon()alxnmociy1op r ivs (  2xmxm3ny1ope mnciasf 2uaum ;u4olxo f3ildfs em(ms t) rxrmo3ty1lptr ieol(0teuoimpiydoltnmfctl(  rurxrono4oeen ieiytla2ulnvs u4tleoir to1fmt  ivilt0t2toim iodoptemfcs s  Dua(  ou0olxniictlslsDrmu p;u0treoxr oydlmDeaneo t)t2uoxopnydolt mictas)sDum(r ;o4tpe  f3tldlsDemumon(0tltnmo iydomtelieo s  eto(o oudol n ici sfaDumx o;t1aeeomociadls2em(vp;u) etrif todopDelnvo;s0trxr(o io1lm  lfvsl(fa2tr(ro;t4olxn i3iydfa eau s u0texrxociytfp r u sl() 2ur(m3ou4ll emfetls)s2rm(r nu1aptomoctadlaDranmo;t4arxomocoodlpt  ueils s2xmxm3no1lmtnmfvils)aDuax ont4optnioeilt aDrlumo;(4 lenmo3tatfptrlies;(0trtrxr no1opt  fvt tfaDuaxmoot0tpto fetaslm2um( snu)arxomrciydfmtrlueo;s0 rxrim3iudalt lnvs ( a2umumpno0tlx ioeiatfmDean p;t) exoir3iatlpDe u slt)trum(mpoo1om nmnesl(fsrumx pou4oeeoif3iys s2ranmp;u)tltoxo ta1fpD anvi;t)seumio nu1alt  nct tfsrumurp;t1aleo o3iyd sDem(mo u0aetnxr todlpt lneil( seumir3io4ame liesa()arumurp;t4tlen o3tldlmDrln p (0trtnxr3tytfaDeaivi;s t2tm(rpiy4ap nlivta(f 2raurp;o4aptomfctyd s eau s (4 eerxociodom e n s;t  2xm(r iudame mnvtl() rtm( oot1apxomfciydlm2ul(mp;t0alenmrciotlpteanesls)tetrim3oudapeelfcia(fartm(monu0tlxomietls aDrln p t)tltoxf oa1omtrau i;() 2urirpoodap  lnctlt  Dtru o;u1oee mfctatls elu sn(0tlxrmocoytfmt luvo (0 euoxr3io4ame mfvsls)sDurumono0aee ii3iytfm ul(vs u4 etoxr3todlm   neolt  rtoio3io1oltemfvs s)srrmxr ;t4tlxn f3ildlmDum( p ()altoxo3tadlm e iei s t2umiopiydomtn fcs t)s2rmur ;u0ope  ieiyt aDel(mont4aetoio oy1lm rlu o;s)texo(m3oy1lle mfvt ()sDrru  nt0ope io3iltlaDum(vo u4 rtrifciydlmtelneo;s s2uoio3iudol nmfcsls) Duax oot1opeomoeiat mDuaums;t)arerxfciydfp  lu o t0 etmio3oodlm nmivsas)arumuro;o4tptoioetldfs2ean p;t0tlermrcootop  lueo;t  etmxr oydope  fei s) rraxm ot0alt moeiyd s2emumsnt) lxrio ta1opte nei t0 2xoir3nu1ome mnet (fsDraumpnu4teto o3tldfa emums;u) rermf3todoa  an o;s setrxr iodll nmivtl(f 2trxm ;o0oexo ictasfa umn s t) rxomrciy1fmtraueslt  2xmxo3nu1opte fcslt  2urumonu1tlxn f3iys aDemn p t0alermo3oytfmtrlivils)texo(o iodale  ici ()aDrmx onu0opxomf3tytla ulu s;t4texrxrctadlaD an s (  rtm(o ny4olenlfctl( a2rauro;t4altoiictlsfa ul(vpn(4artoio iytlpte nvil(0t2xoiopnu4amt miet s) Drmx ooo0texomi3iytla2ran s t)treoio iadlpDeaieo;s)t2xoxo3iu1ape lics tf rraur nu4alenif3ild a umnms (4 lxoxo3ty1omDelnei (0srtmxo oodlptnmivsat)s2um(m nt4teenio3ild aDrl( p;u0artrio3iodlmtrli o t0texrxm3ny1optnlfesl(fs2uaumoou1tleoiieilsfsDemuvp;u4tlenmr3iytfmDrln o s)t2um(r3ny1lm n ivils  2rmurpot1oltnmoeiysfa emuvs (0artnxr3io1opt lu i;s teurxo3oydll n nes s)s2uaxm no1oleo o3ilt a ul(mo (4aexrxr oydoptrlivi;(0t2trio no4optn nes ( artaxrp;o4opxn feilsfa2uan o;() lerifcoydom   uei;s truo(r3oo1lmt  fetas)a2tmum ou0aexoioetltls emu s;t0altnxfciydoa elies s  2xmxo oo1lpt mneslt)srtm(m ;u0tlxo ieilt a rmuvo u)alxoio iy1lmDranesl(0 rur(r ou4ll elfet sfsDrrxr nu0tpxn o3tytfsDranvo () rxnxfcoytlmte u s;()texrxr3iodal elivslt  rrrumo;o4tptnmoctld s ran pnu4 rtnioctatoaDrluvo;( srum(r3oy1lptelivi t) rrau pnt1opeo i3iad mDrmn s t)artomoctydlp e n slt  exo(o3iudal  lict t)arrrum ;o0ale mo3iydfsDum(vo;t0 lenio3to1omtr ieo s)sexoim3oudlmtnlncil()srrru  ;t4tpeomocilslm rmuvo;() rtnmr3oatfpt aivo s)setmio iudope mfctls) Drru ono1aptn ociys m emnmon(4tlerif3totfpt ai s;()seto(r nu1openmictatfsDua(rooo4tlt iieiyd a rmnmo (4trxnmociotlm eanvs ()trxrio3oy4ol emict s)s2ra(ro;t1alxnmf3tls sDeln o t) exnif oy1lmt aneo s t2xoim3iu4lmeelies () 2tmxr ;o4tptomicilt m uln p u)alermr oydfmDeau i;t)texmxr ny4alenliei sf Drmxm oo0texomieiadlm2umumo () eenif3iotfpt aivi;()texo(o nodapt lnctlsf rra( pno1aexnmictls m ul(mp u4tlxoioctadoaDr ivi ( t2um(o oydolte fetls  rurur ot0alt  i3iys m2elu p u4arxnmo3iy1oat auvo;s) 2urir3nu1am   fci ( sruax  oo1aleo ictydlsDuanms t)aexrmo ty1oa  luei;(0t2urim3nu1amee nctlt)s2tmxmono4oexnioeiytfs em(mont0 eeoxociodfmtr nes (0srxrxr ou4omt livs t) ruaump;u0aetoiociytlsDeanmo;()altrir3iatoa   uvils0t2tr(r3nodomtnmicsls  rrmx  ;o4oexo iciydfs2rl(monu) rxomo3oa1lmtraieo;()t2xrirpiydlpeemnvta()aDra(mpou0ale mietldfs eau s;(4trtoio3iotfpDeaivsl( s2xmirpnu1ol  lnvi s srum(r ;t1apenif3ildfm2eluvo (0 lxoifcia1fp r ivi;s0sexmxm3oo4llenliesa(fs2rmxront0aleomfetyslm2em(vo;t)alxrirciy1lmD ai o s0 2urxo3oodope mncsat)artmx  oo0optn feilt m em( s u4 rtrmr3totopD  neilt)truo(r3nydoptn ivil( srtru  ;t0tex  i3iydlmDelumpnt0tlxoxfciadfmD luvo (0tetr(r iodlm nlici ()sDraxmo;u1tet  o3ildfa um( p;t4alxomr iydomte u o (  etm(opou1lme lfvi t a2raxr oo0tlxomo3tyslm2emuvo t4aeerxociatfm e i i (0truoir3oo4alenmfet t) 2taxm ;t0oexoifctas a ulnvonu4aetomr3iodfp eln i;s sexrio3oudom n ictlsfsDrrx o;u1apenif3ias m uanvs;u)arerifciodomt aues;s)trur(o3ny1altnmicsl(  Dtrumpnt4apenif3iltfa2ea(mo u)arxoxo3ootoa elueo s)seuoir3no1optnmfvsa(faDtr(mooo0apeoif3iat s2umuvpn(4 etoif oa1opD  i o;(0truoxm iu4ap nlfetatf rur(r nu4tpenmo3iasfs2emu ont0alxrxrciydop rln olt s2urxrpoy4olt liet sfs2raurp;o0open oeiyt a ran onu) exrxrctodlmteauvs;() rum(r io1ape lncs t) 2rmxro;o1opeoifeild s2uluvo t)aetrxfciotoa rlivo (0 rxoim nu4am emicsl() Dumx  ;o1olt ifcilt m2ra( s;u0texnmo ty1fate n ils0teto(o3ny1apte fei sf 2um(rpot4oetniietltfs2rlumo (0artoxf3oydlmt ln i t) 2um(r ny4altemfvslt  2urxr ;o0aet moctys sDum( p;(0tetoifcoytom e uvi;s)sexoimpoo1llte iei t)srra(r ou1olx mfciys mDea(ms t4 exomo totfmDrauei;(0truoxr3iy4lp  mfcsls aDuaxm ;o4tlxnmf3iat sDranmo;(4altrmr3iadfaD an s s t2ur(rpny4lme lnctltf 2tau p;u4apen ieiytls eluvs () renirctytomtrlu o;s)srxmxr iy1am n neilt  Dtr(rpou4tltoii3tys a ulnmo u4texoxf3io1lmDelnvsl(  2xrir oy4ome  iviatf 2ur( pnu0opt ii3tldls umn p (0artnio3to1opte neils  rxriopou4optn icsa(  2um(m ;o0oetnifciyslm umnvo u4tleoxr3oy1fatr i ils0truo(m3oo1ll nmfcia(fsDurxmpno4aex mfeiys sDul( p (4treomfcoodomD lieolt trtoxm io1lm   iciatfs2raxmpnt0ole mfciys m2emumo;u0altrxr iytfmDrlnvs;()s2tmiopnu4lp e fctl() 2rrur nu4tltnii3tlt s ran ont) lerifctytoa  anei (  rtoirpoydaleelietasfsrtr(rp;u1ape io3iytla2umu snu0tlenmrcoodop rlueolt  euoxrpny1amenlfcsatf 2urx poo1oeeniiciad sDulump;u4 lxnxr iatlp  anvi t0t2xoimpoudamte ncsl(faDtaumpnu4tlt mfeiadfsDuan pnu0aeerio3oadla   i olt  etoxm iu1omtelnvslsf 2rrur oo4opxniiciadfm2raumo t0altnmr3oydfpt au s;(0 2umim3oo4lm n ncslsf 2tr( pot0oet mo3iyslmDrmnmo;(4 rerxo oodoaDr ivolt0 exoiopoydamt  ncslt)arrr( onu4ope miciyt a2el(vsnu)artoxo3iydlat auvs t  2um(mpio1ale  nvt s) 2rmxrp;o4tpe  ieiyd m2rln p (4areoxr3oa1lpteanvs ( t2xmxrpiodaltelnet s) Draxrp;t0opeo oeiysfa eauvpnt)aeenmo3iotlmt anvils0seurir no4lptemfcsatfaDtaxmoou4apxo f3iyslm2emu pn(4aetrxo3oydomte ueo s)trxm(o oy4om nmnvta()aDum(  ;o4tlx mfcilt a rl(vs;()aetnir oa1fpDraivo;()s2xrim3oy4lpeelivi s artm(root4alx ifctys mDra(vp t0texrxr oy1lmDraneo ( srtm(o3oo4ap emfesl(  rtmump;u4ale iocildfsDulumo u4 reoxr tytomDeaivs s0s2xr(opiu1ol elneia()sDur(  ;o1tee  ictasfa elnvs (0arenxo3iotlaD  n s t0 2xrim3oy4lpte ncs ()sDta(mo;o0aeto ociaslm2ulu on(0trtrio3io1fm ranes;s) exriopno1llte iviltfsrurum ;t4openmfeiasfaDrmuvon(4 rermfcoatfpteau sl( t2umir3oo4oltemietat  rurx  ;u4aeenmi3ildlmDuaump;u) rtrir iy1lp elivs;(0 exmirpnudomt lnei sf 2tmxmono0tlxnmoctadfs uanvp;u)arerxrciydlmteanvs s srtr(rpnodoptn ietlsf 2umur ;o4alt  iciatfs um(vo u4trtniociytlpt aivs;t) rxmim3io1ll   fcia()sDtrxm ot0tleomoctytls2um(monu)aetomfciy1opt  uvo;s)trtr(o no4lptelictlt) rur(ronu4alxomfcils a2ulu snu4 rxoir3ootoa eau il() rumimpoo4llt  nvs () Dta(rpno0olenmoeiadlmDuanmp;()trerifcta1fmtr nvsl( s2ur(r nudlp emnctl(fsDrrurpnu0olxnii3tldfa emu pnu0altnmo tadfat auvs;( srxm(opoudlle mfvilt)s2rrxro;o1alxo octytlsDumn o;(4alxnmr3todoaDrauvsls0srum(mpno1lmt  ncs (  2raxmoou4tltnmi3tadfa2ea( pn(0 etriociatlmDrlnvo ( s2tm(r3no4om nmiesasfa2um(rp;t1aleomicildfaDuaumpnt4aeerio oy1fpDraneo;t  rurxr3iy1olt  nct ( a2umxront4tleoiociyt m2emuvsnt4trxnmr oydop  aivslt)tetrxr ou4lp emnetas artaum ot1opx iocildla ea(msnt)arxoiocoodfm raivo t)teuoxm nu4ap n ivia(f rrm(r no4oeenii3iatfs2eluvonu)areoxr tadoaD lnvi;t t2uoio iudomen netlt  2uru  no1texnmfetad mDumuvsnu)teeomr3oadfmt ai s;( teuo(m oodlmeelictatfsDtm(r ot1olenifciad m2emuvont) rermo3oadfmteln o ( trxoir nu1lpee fvslt  Dta(r oo1olx  feild a2rl(mo u0 etomf tytlpD lu o;(  rxr(rpoo1openlnvs t)artmxmp;o4apeo o3iltlm rln s;u4arxoxociotfm  anes;s0teurio3oy4ome mncil()sDtr(moou0aex moetls m umnmonu0aexrxocoatfp   nvols)trum(o3oydal n ivtl(f Duru  ou4texnmociytla2rln on(4aeermr tadfaD  i i t) 2um(r ou4opee fvi ()aDtaum nu1olenif3ias mDelu pnu4tetrmo3iadla eln o s  etoxo nudlpenliei t  Dumurpou1oetoifeilt s2ulumsn(0trxniocta1op  an s s)trumim3io4lle lfvt s)s2rax  ;u4teeoio3iyt s rmuvp u0aeenxo iydlmteaivo t)trxoimpoodlmtnmicils sDtmxr ;t4oexoio3iydfm2umums (4 eeoxo3oatlmtelieo;s0srxr(o3ny1altemivils  rrrxroot4tet mf3iad s2rl( p;(0tltoxf3iytfmD aueols) rxm(r3oy4apeemfvias)a2taxrpno0tee miciltlm2rl(mo;t0 exoir tydopD liesl(0 exmimpny1lpenmicsas a2tm(mp;t0texniiciltfaDelnvp;(4tlenmociodlptraieilt0 eumiopiu1ope mfctl()arumx poo0altomoetldls rlnms;u4trxrio3iadoat li s (0srxr(o iodom eliciasfartmu  ;t4tlenioctasfmDul(vo;u0 reoxf oatfp elnvo t)t2xrxr3iy4llte ncsa( aDraxmpno1olxnio3iytls2ulnmp u0artnifcoo1fmDrlieo t)tetm(rpoy4ll  mfeta(  2rax ooo1aex mi3tyslmDem( sn(4teerxf3totomtrluvo t0trtr(r oodolen fvilt)s2uaum ;u0texnif3iydfsDrl(vont0trerxr ia1laDr u ilt trxm(o ou1aptn fcsa( a2raumpou0tpxnmo3iyd a rmn pn(4alenirciytfaDr iesl(0srtmio3oo4lmt mics (f ruaxrpnt0alenifeild m2rmu p;t) eeomf3iytfptrli o;s  2xmim oy1lp n ieiasfs2ta(m nt0texomf3iatfmDuln o u)trtnmrcoy1fa raneolt0 rtoirpiy4amen ncs t) 2uaxro;o1tle mieiadfaDumuvp;t)teenircto1lp eai i s  etoxmpiy4ole lncs ()s2rrxrpnt0oee mociaslsDrl( pn(0teeomocootfat anvi s0seuoir3oydom e ivsas  2umxro;o1opxn feildls ranvp t)arermr3oadop rli o;(0s2ur(o no1llenlnetls)aDtmu pou0oeeomietysfa rmu pnu0trxrmocoadlpD auvo;s0s2to(o io4om nmfesa(fs2tru ooo0tle ifciadfaDumnvs;u)trerxrciytfpte ies;s) 2trirpno1oleemfcils  rur(r oo4aetnioctldfsDranvpn(4texomo3todfaDrluei;t0trtmxrpoy1ome mnvtl()sDtmumpnt0tpt ioctld m ua( s (0tetrif3oadop  an ilt s2tm(o3nudape lfvsa(fs2tr(m ;t4tet if3iasls rmu p (0 rtrxo oadfm elueo t texmxm oy4op e nviatfsDtm(ro;u1olt  fctad sDul( sn()aleoif3todoaD auei;(  ruoxo3oodlpe lfvias)srtru  nu1olt  ictat m2eanms u4aetrxr oadlp  livo s) rur(r ou1lm nlfvtls) 2uaurp;o0aeto fcils s2rmu p;t) rtnmrciatlmDrlnvols0sexoim oydoptn ivsltfs2tmxro;u4tlxnmo3ild mDrlumon(0teeoirctytlat aies;t s2toio3oy4op nlfciat arrmumont0oexomoetadfa2rmnms;(4arenxocoo1lptelues;s0trurio3oodom e iciat)sruaxm oo4aeen ieiysfsDrlu s t4 rtoxrciatfm r nvi ()srtoir3io4lp emnvtasf 2rmumooo1altn i3iat sDuauvs;(4 rtrio tatopt an ils s2um(o3iydame mivtlsfs2raxmoou0opto o3ias sDrluvont)arxnmf ia1oa rli s;( srurxr3oodale mneiat)s2tm(mpot1tle  oetas a rlnvp u0areoir oatfmDrln i;()t2xr(mpoydome lictat)artaxmo;u1oex  i3iadls2ulnvo u0alxrio3oydfatranvols  rumio iy4lmt mictl() 2raxr ;o0tpeoio3tlt s2rmuvo u0 lermocoydfpteaiei;s) eum(opnodom emfvtat aDrmur ou4oexnmiciydla2uanvs u)trxnxo tatlm  lnei ()seumimpoy4lpte neia()aDur(mo;t1oeeomoetas s2eauvo;t4arermrcio1oaDranes ( srtmxo oudol e fvilt)aDrax pno0opxn feiytfa rauvp;u)trtrmo3oo1op r u ols) rxrxr no4ap  lici s arrm(roou0optnio3iatla eluvsnu4treoio iydoaDraivi (0srxmim nu1lm e fcsa( a2tm( p;t4ape  f3tadfm rlumonu0teeoxr io1lptrln ols) 2tr(opoodal nlfcta()sDur(  nt0alt if3ias m rl(ms (4aetnmfciytlmD  ivi t0s2uo(rpny1optemfcias arua(mo;o4oee  fciysfs um(vs u)trxrmocootfmtrlivi s0s2trim iu4omtnmfet s  Duau  no1tlt mocildlm rmnmp (0tetoxo3iadfpt  uvi;s0 2xr(opno4lmeemivi sfsruru p;o1aeen o3iydfs uauvo t0tetnmr ia1fm rauei;t t2umim3oudop  lictas artm(r nt4aeeoiieild m ul(ms;(4tltoxr3oo1om elneo;( trxm(m iu1openlfci t s2trum ot0oeeniictld mDumu s;t4trerirciadla  an ils0 rumxopoo1am elnvtlt s2umxr ;u1apenmf3ilsfm emums;t0 lxrio3ootlp eai ol(0trxrirpiy1lmeelnvs sfaDtmxmoot4tee moeiltfmDem(vp t0 renxo3iadlaD  nvo;t  exmxmpiydaptnlfct () Duaurp;u4apen feiytla rm(vs u)tltoio3totlmte i sls  2xmirpiodoltemivia(  rra(r ;o4tlt ioeiadfa uaumo t0trxomoctytomteauvo t srtoxr3io4om elneils s2ur(rp;u4tlxo i3tys aDrau o;(0 eerxrcia1opDraivo t)truoim nu4oltn fci t s2umurp;u1oeeniieiadfs2umnvp u4alxnmr oa1fmt  i i;()truo(r3nodll n fvi t)sDra( pnu0oexnioeiydlm rl( o;t0tltrmfciotop rauvi;t) exoir iy1amtnlnvt ( a2umxr no4tlxnmocildfa ranmo;u0aetrif3oadomtr uesls sexo(r nu1ol nmicia(fsrurxrpou4apxomieiadlmDea( on(4aexoxo3ia1faDrauvo t0trum(rpoo1ol elfvslsfartru oou4aex  fctldfa2eanvs t0 leoir tydomDelivols)t2tr(opoudam n ietat)aDrmxm ;t1ape mo3ildlsDea( pn() ltrxf to1lpD lu olt) rtmirpiy1ll n fcia(fsrumx  oo0alxo feildlm uanms;t0altoxociatfat an s s t2toxm nudalt  fetl(  rtrx oot0ole  i3iydlm rlumo;() leoirciytoa elueo;(0 rumiopiy4aleelneia() Dtmu ono1tleo oeiat m ul(mp;() rtnif oa1faDelnvolt0tetoirpoodlpt  nciltfa2rmxm no0optoioetysfs umnvo;(0areomfctytlmt auvs (0trtrxo3oudolt  nes tfa2rmu  oo0tlxoii3tysfs eanvs u0tlenxf3todoaD aneslt0srxr(rpnu1op  mnviltfs2taumo;u0oexomicils s2rau pnt0aeermr3to1laDeaies t)sexrir oy1al e iei t) 2rm(moot4tpxnmf3tysla2rm( pn()tltnmrc
\ No newline at end of file
@@ -0,0 +1 @@
+ivsls  rtoiopno1om nmfcsl( aDrmxrpot0ale  f3tatfa2raumo u)tlermfcta1late ies;t)srtmir3ou1lmen ies t) Drru  nt1openmfciadfmDrau o u) rtrifciytfp raivilt)texoxo3nydap e fci s) rraurp;u0optnmfetasla2umnmonu0tltnir3oatfaDean slt0 exmxopno1omt  fcs () 2uaump;o4oee mi3tltlmDrl(vp ()texnxf tadfpt  ueolt  etoxr oy1ome  ivs s a2raxm nt4ope  o3tlslm2rln pnu) lxrmrctadopDrlieols0tetoxm ny1omtn fctl(  2rruronu4apt  ietlsla ulnvsnt0aeenmo3ta1la elueslt0srtmxo nudlptnlnci ( artr(  ;u4tet mo3ild sDeanvpnu4aetoxfciotoaD  uvolt  rtr(o no4ap nlfcia(fs2umuroot4apeo f3iyd s rau o;(4 rxnir tatfmt ai s t) 2uoxmpoy4omte ies tfsrtau oou1aptnmieiyt mDel(vs;t) ltnxocty1lpD  uvo t t2toxopiudoptnmnct tfsDumum nu4aex mociatlaDemumont0arenxo3iy1fmD  ueilt trxm(mpny4llt mnvs tf rtmum ou0tpeo o3tas a2rmu p;(0 etnmr iytfmD  i ol(  etoxrpiydopt  ies sfsrtrxr ;t0tetnioetyd mDrlnvo;u4 ltnxf tydfaDr u s;(0s2toxmpoudole mnvt s) 2uru p;o4apt  oeiyd m uanmo (0arermr3ta1oaDrluvi;s  2xoxopoo1lp  lfvta(fsruaxmonu1texoiociad m um(mo;u4teeomo ia1oa r neol(0trum(m3nodlle  ictl() 2tr(rpno0tlenioeiydfa2eauvo;(0aexnio3todfm r ueol( texo(o3iy4lltn net s a2taxm nt0altnmfeiyd m emnvo;u4 reoxrcio1fmDr i o;s0 2xoim3ou4al eliciatf rrm(rpnt1olxomi3tasla2emumpn()tlxniocta1lmDr n i ( s2tmimpio4am n fei ()s2rr(mpou0oexomf3tatfa rm(mp t0 exrir iodla r ivs;t0t2tmimpiy1lm n nvsatf Drm(rp;t4teenmo3iyd m2um( on(0tltnmr ootlaDe uvi (0s2xrio3no4aleelicta()s2tm(ro;o1olenmfeiatfm2eln snt4tlerio oytop e neo;s s2xm(m3iy4olee iciatfa2umxmo;u1tlxoio3tyd s umuvsnu4tetrmr3tadomt lieolt  2urxm3oy1lp   ici () 2trurpnu4tltoii3tydlsDum( ont)aetnxf oadfmDrlnes;t trtrxm oo1aptn fvsat  Drr(root4apeomfctas s2ra(vs (4artnxo ia1fatr i i t)texoir iu1open fcsat)aDua(r ot0tleoifetadfm eaums u4aetoxrcoo1opt  u ols)t2xrxr no4lpt mfvil(fs2uaurpoo0tlxoiiciasfa2ea( s;t) etoxf3oodlptranes;(  rto(r nodal  mnvi tfarrr( ono1ale  o3tydla umuvsnt)aeerir3to1fptrauei ( teuoim3nodoltn ietatfs2tr(mpoo0oetomociysls2rm(vont0 ltnxo oo1laDraneolt)tetrir oo4oltemfvtat  rraurpno0tlxoifeils m2em( s u4aeerif3ia1fptrlnvol( trtrxm3iodamen netl(fsDrauroou1opxoio3tlsfm2ulnmpn(0 rtomo3oadoaD auei (  rur(m ou1ll nlncias) 2urxm nu4ape mo3iad m2eln p;t4 exomr3oy1fa eln o s) 2uo(opoydll n ivtltfsrrr(mpno4aee ii3iydfaDemn s ()tetnmrciadoa rlu sl( seumim3io4ap nliei s srumur ;o0tet  ociyt m2em( pnu) ltrmf3ia1omD lieo ()trum(opoudlleemncs ( sDrrxrpnt4alt ioeiadlmDemnmp;(4 eerif3todoa elnvs;t)srxmir3ny4om  lnvta(f 2umxro;o0oleomiciytls ua( s;u4altrifciytfm e uei ()trum(opiodoltelnvtltf rrr(r oo0olx ifctldlsDean o t0arxoif oa1omt  nvols)trum(r iudal  lfcsls srum( p;u1alenmoeiad sDean pn()aexnmrctodfa r u sls) 2xo(o3oudlpen ncia() Dumu poo1tet iietasfs2ea(vs;u4alxrif3oo1faDelieo t truo(o iy4llee fvs (faDum(rpnu0aet ifetat sDrluvonu4artnxr ootlp ranei;(  etmiopoy4alenmnct () Dururpoo0oee ifciyslm2uan o;t)aetnmr3oydlp rluvi;( texrxrpou1lpt lieias)a2uau o;t0oex mo3tydla ulnms () rermr3ia1lpt ai ils)t2tmxo oo4ole mfvs ( sDtax  ou4aeeoioeilsfm2emump u4trxnmfctadlateluvs ()trumxopiu1optemnvsl(fs2uaxm ou0alto ictatla em(vp;() lxrio iytlptr u il() 2xmxo3oy1lp  lnesat aDrrumoot1tlto icilt aDulumont0arenif3iotoaDrlivs;s setoio ny1llenmfeta()s2rrxm ;t4apenmf3iydfmDua(mp;()trenif to1optrli i;s)seur(o3iy1amee fcsa( aDua( poo1olen o3ildfs2rmn s u4arxrmr3oa1lpDe i s;t0tetrio3oudll elfctltf 2umumooo0alxoioeildfs2raums;u0arxrmocoytfmD  i ols0teur(mpny1llenmfcil()s2urx ooo1tpen fcilsfm em(mo u)aexoif3to1oa  ln o (0t2xr(m3no1ole  fvias)a2tr(  ot1oleoioeiatfaDul(msnu4 rtnifcoadlmDrluvo s0 exoxmpou1amtelnctlsf 2tru o;o1opxn ociydlsDrlnmo;t0trtnio3iytomt li il( teto(r nodlm   feil(fa2um(rono0tetn feilslmDua(mp;u0 lxoiocoytla rlu i t) rxr(r3iydomee ivi (faDrrurpou4olx mfciadfaDel( s;t)tetrif oodlateauvs;s)t2umimpno4altn icsasfsDtmxr nu0teen feildfm2rln o;u) eeniocia1om r uvil() etrxo no4al  livi tfs2ra(ro;u1alxoio3iadfs ranvo;(0 etoio ia1faD anes;s) euo(m3oy4apee iei s) 2ua(r no4apx  ocild aDum(vo;t) eeoir3oodoaD aivi t  eurxrpio1lpe mnvias artmxrp;o1tpxomf3tldfs rmuvsnt4tetoxo3tadlpD lu o (0s2uo(m oudlmen fetatf 2urxmpou4tptomieiasls2rlu s;() etrxr3oo1lpD  u i t) 2umxo ou1alenlics sfs2rmxr oo0alto ietys mDumnvsn(4 exrxo ta1lmD auvo t)tetmir3oo1amee ietl()srra(rpnt1oeeo i3iyd a ranmo (0tetomfcty1fmt luvo;()srxoxr iu1ap e ictlsfsDum(mooo0tpe iieiltfaDulnvpn()tlenmfciydlm  au i ()trxoxo3ou1lmeemnvia()srururpoo1tpe  ieiatfa emuvs;(4alermrciytop e uvs;(0 eurxrpny1am emieil()a2rrxm ;u4teto fciltlsDrl( o;() renif iadlaDeaieo;s)s2trio3iu4op  mfvsa() 2rmu oot4opx ioctlt a ua( s;t0aexrio3iotfmDe u o;s)seum(rpiydapenmfci (f Dtaur ;o0ale io3iatls uauvpnu0aetoifctatlaDrli sls)teumiopiudop emfvtat srumu o;u4oleniociydfa2rluvp ()trxrxf oytomteai ilt0t2tr(r3oodomee fvtl(fa2raxmpno4opxo o3iat mDel(ms;()tleoxf3to1lp  livsls seur(mpoudlm nmnetatfarum(mooo1tet iictlslsDemums;t0tetnmf3oo1fp   n s ( trtrim oy4amt lncia()sruru  ;o0ole moetld a umn s;u4trtrxo3oy1opDr u ilt0 exm(r ou1op e ivil( aDtm(r no0altomfetldfs rl(vp;(4trerioctydom  luvi ()sruoxrpoudal nlietl( srtm(r ;o4oeen icilslmDel(ms;t4tltrifcoa1oateaivs s0trxm(mpnydaptnmncta() ruaxm ;u1apenmfciatlmDrl(mo (0altnmr tydlat  neol( srxr(m3oy4aleemics t srta(  ;t1aee  octldfs um(vpnu0 rtrxfciytfpD lu il(0trumxmpoydlp e ncsl() Dra(m nu0ole  ictydfm ua(vo;u)arerxfcoa1fmD aivilt) eurxm3nu1alee fci t  rtr( o;u1opxo ociltlsDrmn pn(4 exoir iatopDe n o;( s2xo(r nudolenmivtl(  rta(moou4alt mo3iysla emnmp;(4alxnxf3tytlm rln i;(0 2xrxo3oy1lpe mnct tfaDrr(m ;o0optnioeildfsDrln s;(4 ltoxf3todlmt  ivo;t  exoxr nudolen nctlt s2ua(rpot0oeeo i3iatla elumsnu)aleoxo3ta1lp e uvo s0 etoiopoy4al emfvs s a2rru ont1apeniocils a2ra(vp () rtoxfcty1fpDean s s tetoir3iodomtn neias)a2tax  ou0aeto feilsls rau o (4 exomr3iydomte nesl()t2xoxmpoo1ale livil(  rrau poo0aex ii3ildlm ua(vo;(0 etrxfcio1lmDr uvols trtoxr3iu1ol e neslt) rta(monu4tlenifeias a2em(msnt4trermo3oydfm  lnei t  rurxmpoydamt  fvils a2rrx  ;t0opeomocild sDulnmpnu) etnio tytfaDelnei;t0trumim io4llt lnctl() 2tm(  oo4tpe mictydla el(mo;u4tetrxr3iodom  lnei;(0t2toio nodaptnmnciltfsrrrurp;t1opt mi3iltlaDuanmpn(0 rerxf oy1latelnei;s)srtmxm iydlm  liesl( aDrmum ;t0tpxo iciatla2rmnvp;u0tlxoxrciodopDe nvilt) eumir iu1apeemfvsatf Dumump;t4aet  fetldlm2ean s;t0trxomfcoydfpDr n i;( s2tmiopoy4apt  ivsa(fa2uaxmpoo0aeeo feiysfaDea(vo u4 renmr todlmt  nvolt0t2to(mpiu4lme  icils) 2taxmp;o4tpxomf3iadfaDrauvo;u)areoiocta1omDr u o ()srtoxm io1aptnmneil(faDtrxr ;t0altn f3iatfa2uan o;t4arxrmrcto1faDe ieslt)t2tm(r3nu4lpenlfet s  ruaum no1alx  oeildls eanvp (0artrifctadom   neo ( t2ur(opio4am n ivils)a2uru  ou0tle  ictasls2rmnmonu)treoxocia1fmtraieols  2tmir3ny1ol   ncs () Dra(mo;t0tptomo3tas mDuln s;u4 rtomfcoa1opD lnes;t0sexr(m3io1omen ics t a2rr(  ;t0alenmociatls rm(mp;()tetomo3oa1lp r iesl(0 2toim ny1ale  nes tfsDumur nt0tpxo iciat mDrm(vo (4aetnmo tydfmDr ueols) 2xrir3nodope mieils  2umurpnu0tltnmfctadfa em(vpn(0teeoir iodlpDrln o s)tetm(r oy4ape mncilsf rtrxmpou1apxniieiyt m2rm( o;t0aexoxo iadfmDe nvo;s0s2trimpnodlptnmictl(farrmxrooo0ape iieiasla2ranmo;(0altriocoa1lmD auvol(  rtoxmpny1lm nmfeil()sDta(rpot1apx ifeiyd s rmnvs;t0tlerxocoadfateaiei ( tetmio3iy4omtn fes (faDtauroou1alxo f3ias a rau p;t)aetrmo iydfa eau s s truo(mpnudame lfctltf Dra(rp;o1oexo ieiyslmDul( o u)treoif3iodlmt ln i t) 2tmiopiudom  mfvsltfaDtm(ro;u4aexoiictad sDeauvo;() rtrxr oy1laDr i ols0 eumio3nu4ope liei s) 2trx pno0teen oeils s2rauvpn(0trtoxo oo1lpte ues s) 2umir oy1ll elicsl(  2trxrpnt0texnio3tltfsDelnvo u4texomr io1lpt li i t setrim3ou4op nlnei tfaDrrxmp;u4olxomiciat s2rlnvo t0tleoxo oa1oa elnes t0 2xoio3oodolenlneslt artmx p;t1tpxn i3tydfa2em(vo () reoxr oy1lmDranvolt)t2uoim iodlme lfeta( s2raump;t0aeto octasfa2emnmsn() rxnmf ia1lat  i ils)teumxrpoodam  miesltfartmu  ou0aeeo ieiadlaDrln snu)tleoif oo1oa elues t  2xmxm io4al   ictat)sDrmu p;o0opt if3iyslmDuan p;u)aetnio3totopDelu o;s)t2uo(r ou1lltnlnei (fs2rru  ou1tpxo i3tld a2elumpn(0teenxf3oo1lp   uei t s2tm(mpno1lle miesas) rta(mpot4ole io3ilsla ulumonu4tlerxrciy1laDe iei;t)s2xoxo3ny1altnlics sfsrua(  ;o4tetomfeiydfa2elums u0aexnxrctodfp rlueils0 2xo(o nydam e nvtas  rrau  ou0oeto iciyd m2el( o ()teeomociy1opDelneo t0srur(mpiydal n nesl(fsrrmxm ot4tptoif3tys aDemn p;u) eeoxociytlaDe nvs (0 rxoxopny1omtelneta(  2ra(r ou4oexo o3iasls um(vo u0 rtrxr3to1fpD li i;()srurxo ny1amtelfvsa()aDurxr ;t4tlxo ieild aDumn pnu0 ltomrcia1lp e nvi (0tetmimpio1lptelfctltf Dtrxronu1alxo i3ilt m umn s t)trxoif oy1fa rlivils  rtmxo oudomtn ncsl(fsrtru pnt4tex mf3iltls2rl(mp (4alxoxf3ta1fa elnes (  exmir io4lm   nctlt  rtr(monu1apt  o3iad a ran o u4altomo io1fmteauei;s)srto(r3io1lp  mfes t) rumurpnu4oltnmf3tltfa2uanmp t4tltrif oo1fat  nvi (0s2tr(mpoo1lltemivi t)a2tmumpnt0openii3tydla2eau s;()areomociodla rai il( sexr(r oy4apt lfcias)sDrmxmo;u4alx  f3tlsfm emnvp;t) etoio3tadlmtraivi;t) rur(m ou1ape lncsa()aDraxmonu4tptnmieiadlmDrluvo;(4aetrmo3iotlpD  i o s) rtrxopno4lme  ivilsfsrur(r no0aexnmf3iadfa2rlnvp t0 lxnmr3iy1lpDeluvilt0 rtr(r3nodol nmnesat) Drru  oo1aet mfcilsla2ulnvont0tlxnmfcio1lmtraues (0trtr(r nu4amenlnct ()srururonu0alx mi3tlsfsDrluvo u)artoio3to1lm ranvs t0tetmxopny1altnmneiasfaDururpou0texnmf3iasfmDum( s;t0tleoxr ia1la ranvsl(0 rxm(o3no1al  livt s srurur oo1tet  octydla2eluvon(4altnir3oa1fmt anvi;t  2tmim3iodlpenmiciatfsrtr(ronu4aet  octydlsDrm(ms;u)altoxocoa1fm r ivi () 2toio oudal emnvtl()sDtmxmp;o1tee ii3iadfa2ul( s u4trxnifcoy1omt  n o t0trxrir3nu1am nlfvt t  rrau pnu1oeeoioeildfa2uauvont4aeeomf oodlmDeli i;s sruoxr iudop   feslt sDraumo;u0aeen ieiadlm2rlnvs u4 rtrmrciadomteauvs;()t2urim3no4lmen ivsas) 2ra(m nu1altoif3iad s elu pnt) reomo ta1fatr nes;s0s2xmxr iu4al emnvsat) Dtmxm nu0oetoifciltfm ulnvs;t0 rtrirciydfp  lnvil( sruoim3ny4lpenmfcsat  rtr(mpnu1oex  i3iltfm ran sn(0 exrmrciadlm r i i (0sruo(rpiy4oleemfvia(  Duaxrpno4optniictlt s2eauvon()arenioctytom r i ils teto(mpiu1lle mieias)s2urumont1aetn octls s2rl(vs;() etnxr ta1optr ivo;t0 eto(mpnydopenlieiltf Drrxro;u0tpx mictyt aDemu o u)tetoxf oatoptr uei;s)srxr(m3no1om e ivil( srtaxmoot0apx  o3iad m um(mo;t0arxrxrcoy1optraneol() etrxr oodopeemnes t) Drmumoot1olt  oeiytla2ranvsnt) etnxo3oydop raivs;(0trtrio3nu1am emfvia(  2umumooo1ope if3iyd a2ran pnt0artomf to1oat livolt) exmxr io4alte nci t  2urumpnt0aex if3tydlmDuan sn(0tltnxf todoate ueol()seur(opny1openmivs ( aDtruro;u0oltniiciadlm2rl(ms;t)arxomr io1lp r nes;s) euo(o nudolt  fvtas  Dtmuro;u4ape  oeiytlmDuluvpnt)aetoxrciatfmD lueols0s2toxmpnodom n nvta() Dtr(r no1ape  fciys a2emumo;u)tlxrio3oodomD ln il()s2xrxmpio1lpt  fctl( a2raumpot1apen ietltla rl(monu) leriociy1oatelueils)t2xoxr oo1om  mnvs s) Draxrpno4tlx mfeils s eaumon(4 leoiociy1opDraues;t0t2um(m3nodol n fetas)s2tmum ou0altomo3iltfm2eau p t4 etoxrctodlpDe ivs;s0srxm(opoy1alt  fetas)s2truront1aleo o3iltfs rln p;u0aexomo3tytlm  ln i (0sexmxr3oudaltnlncil(faDrax oou1alenmoetlt s rlnms;t0arenmrctatfmt auvo (  rxoxrpny4omt  ietas)srum(  ;u4tlt mietls mDuluvo u0arxoxf3oa1oaDranvil(0t2xrim3oydll   ivtat)s2tmxm nu4tetn o3ildla rmn pnt0tlerio3ootlpD livs;( teuoio oudam nlnetltfs2rr( oot4apxomfcildfm2uanvp t4 leomrciodlmDelivsls0 exoim3nudolenmiesat)sDrau o;t1tptnmf3iyt m emuvp;(0aeerif3tytlaDe ivo s)srum(m iy4lm   fvi s)srtr(root4tlxnmoctaslaDelump u4 rtnifciytoa r u ilt0s2uoxmpno1lmt mnvilt)s2ta( pnu1aetomf3ilsfm2em(vo;t4tltnmrctytlm rlieo () 2tmxmpoo1amtemfvsa(faDraumonu4ale mf3ias a2umnmo t4trxnxf3ootfm  luei;s)trtm(rpiodllee neil(  rra(rpnu4aexnifciadla2umu o u4 etnxo3iodfpDr nesl(0 rxrimpno1lp emies sfaDtmuront0aee ifeiltfs eanvp u0 rxrmf3tydla eaiei;(0teuo(m3ou4om   neil(fartmx ooo1oltoio3tatlm2eauvpnu)areomf3oodfa   n s;s t2ur(opny4olen nvt s)sDtr(mpno1ape ioeiaslsDemn o;(0arxoxrcoatomDr nes s trxoxmpiudlm n ieilt s2raumpnt0olxoiiciyd mDeanmo;u4 ltnmf3oodop  li ilt0trxoirpnu1omenmfeta(f Dtax o;t1tlt  fctldfmDuln o t4trtrio oadlmD livsls sexo(r3ou4lm   ivta()sDtru pnt4tpe mi3tyt a ra(mo u0tlxrir3io1fpDe ivol( truoxrpnydolt  nes s)sDtm(rp;t4tpto f3tysfa rluvo;u4 lenmf ootlpDr nvs s0trtoiopiu1lptemfct s arrmuronu0tptomiciyt mDeln p;t4teeoxf3iodfa   uvs;s  rtm(rpnu4ope lfvi s srum(m ;o0tlx mf3iysfm ul(vo;(4artrir3tatlmteli o;t)setrxopny1olee ncils)sDrmu p;u0tet iieils mDrm(von()tlerxf3ta1oaDrlnes;s) 2toxr3no4opt  nvil(fs2ur(  no0oexomfetltls rmums (4arxrxo3todoate u s s)trxmiopnu1lpenmncil(f 2uau p;u1altn i3ildfsDra( snu0alxoio iydlmtr neols0 2urxo io4al e nctat a2tax pou1altn octas s2uanmp ()tetrir3oy1fat lu o (0trxoio nu1alen neil(faDtm(roou1olenmo3iytlm rl( snu)arxrircta1opDr nvs;()srtoxm3iydllt miei t sDrr(rpnt0opxnmfeilsfa eln p t4teeomo iydom r nvo;t)trto(o3iydamtelfcil() Duru oou4oet  oeiltla elnvs u)altrircoa1lpt  nvs ()texmxo io1amt lnci t)sDur( ooo0tltn o3tldls2ulnmpn(0 ltnxrciydlat  n i s)s2xoim io1optelnci s artax  no4oexo fciatlm2uln on()tltrio3ty1fpD ai i;s) rtoio3no4ape  icsasf Dtrurono4aexo iciyslsDumnvpnt)tltoxo3iytfa   ivs;(  euoxrpnydomeelneia() 2ua( pnu0aptoiictysfs eaumon(0 etnxr3oytlm  aivi;t0truoxo3io4alt mnetl(farumx pno0oeenio3ias a2emnvs;t0teerio ootfaDrln ilt s2xr(rpnu1aptemnvslsf 2tru pot0apxnioctydfa2elnmo;() rxrxfcoydfmtraivi (0 rxrxm3iy1lme mnei s  2rax p;t0aee ifetys sDul(vs () eerirctodlpD au o s)s2uo(opiy4amtn feil(fartax pnu1aex ifetatla2raump t)altrio iydlp  lieil()srtoxm3oodapeelnet ( aDrru p;o1oleoifctlt m rluvo t4aexnmf todlpD livs t)t2tmxo3ny1ome lnei t)aDtau o;o0apeomfciatfsDranmpn()trtnir3oatfm e ueo s0t2trio3iy1lptnmfcsat) rtr(mo;t1apx mo3iyt m elu p;t0aeenio3io1fmtelivo;s) etoir nydomt  nviasfsDuaxm ;t4opt moetld a eau o;u0alxomr tydlpDr uvi;s) rtoxopiy4ll  mics t)sDtr( ont0texn icildlaDumnvsnt0treoif3oo1lpDranei;( trtmxm3nodap nlnvtl(fs2ta(ro;o4tpto icilt s elnmpnu0areoif iy1fa rlueo s  2uoxo3io4open fvsas)aruau pno0openmfciyt a rmnmo ()tetoxocto1laD aies;( sruo(mpoudoleemfct ()sDrmxmont4oetomi3tasfs2emnvsnt)tleoxf oytom e u o;( sexoxm3oo1lpenlfet sf rua( pnu4aet  oetltla2rmnvp;(0 rtoxo ta1op   uvs s  2xr(r3iydllee ncsls a2uaur nu0aetomoeiatls2umu p u4tetnmrcio1lat au s;t0 ruo(o3nudop   nctatfsrurxmont1oleomieiydlsDul( o t4 lxoir3iytfp rlnvo t0texmxm nodop n iei t  2uaur ou1optnmo3tlslaDul(vsnt0alenxr iydop  livils) eurir3iy1omtnlfei t sDumu p;o1alt mi3iatla2rauvo;t0 eenmf3iadlpte uvs t0trxr(mpnudale lncilt) 2tm(rono0opeomoctasfa rmuvo;(4 exnirciydfp ean il()s2trxrpnu4omtelfcslt arrmum ;o1tpeomoeiyt s um( ont0tltrxfciodfp  auvi;t)srxo(m3oo1lptnlncias a2trxmp;u4tlen o3tatla2rln ont)aleoir iytfaDelueil()trtoxrpiu4ap eliei s)s2urumpnu4aeenmf3iyd a umnvo u)tltrmr3ia1lmDrauvo (  etr(r3nu1am emfes s sDtm(rpou0tltnii3ias s2um(ms;u0 lenmociytfmtran o t)t2urio3no1ap  mfcta(fs2umx pno4altoifeiltlmDrmumo t0altoirctodfm   uvi;( trtrxo nu4ap n fvt t artrumono0aptoiietldla2ranvp;t)aeermfcootoaDr nes ( texm(o oy4am  mivt t)sDrmxro;o4tpto fctat m emn o t4 rtomo iatopDr ues;(0teuoxopoydol nmnet (f Drmxrpnu4alenmieiytlmDul(vo;(0 reniocoatfptrluvols0s2uoxopnydam  lnvs sfarur( poo4ole if3iyd s2ea( sn(0tlerir ootlaD anei;() 2umxo3iodop  mfcslsfsrumum ou0ole  fciytfsDulnmon(0 rtnmr iydfpteaneo s0trtrxm3nudom n ieta( a2tr(mont1tpeo iciad a2rmu sn(4arxomr to1omDr ivo;()teurxo oy1apenlnci (fs2tr(rpnt0ope ifctlsfmDra( s;(4arerxfctodoaDe nes;t)srxoir3nu4apt mnci t) 2rau  oo4ole ioeiatfmDel(vs;t4arxrxf iotfat auvo;( srxr(rpiy4lm nlieiltfs2uauroou1tpe  fetldls2ra( s;()tlxnif oytlmtelues t trxmxm oodopte fctl()aDrrxront1apt mo3iyt s eluvp;()tlerxo io1lat li slt0 etrir oy1lmtelnet () 2umxronu1aexn ociatla2umuvo u4 lxrxo to1latr uesl( tetoim iydame miet sfa2rrumo;o0opxomo3ild a uanms;u)artomf3oatoaD livil(0seurxo3io1lme  ncil()arrm( pou0tet  octldfm2uanvpnt) lxnxocoy1lptr ueol() exoir oy1al  mnvsat)artruro;u1tltnioeiytfaDrm(vp u0 renmf tatfpD luvo;t srxrxr3nu4omt mfvi s s2raxr ou0ape iociadls umnmpnu4alerif ty1lp rlnvo;s) eumio io4omen fvs (fsDur(m oo4alto o3tyd a2rmums;u4 lxoio3oo1faDrlnvolt0setm(opny4altnlivsa()s2um(  nt0aexomoeiydfs2ulu o u4 eeoif iy1fmtr i sl( texoxmpoy1lmenlfeilt) rua(mooo1tle  fetad a2rau p ()aeerif3totom  li slt0 rxmio iu1ol nlnvsasf rumxrpno1aetnmo3iyslm ea(monu4treomf oy1faDe u i;s0s2trxrpou1ap  mfvtlsf 2tr(ront1tltoif3iatfa2umnvo;u0 reoir oytlmDr i i;(0 rtrxo3iy4ap emivta(f 2rr(  ;o0teeoiietas m uanvp;u0 ltoir oydomDe nvo (0s2uriopiydolt micil( s2rrx  ou1oltn f3ias s2rm(vpnt4texomr oodfaDraivi;(0t2tm(opoydome mnvtatf Dumxro;t1aet miciys s2rlu s;(0tleomo3todoptrln ilt0t2ur(o oo4ape lncia( aDuau pnu1tlx miciltls2el( onu0trerxfcootfpt  ieslt) rxoiopiodlp   fvs s  Dtaxr ;u1tleomf3iytfs2ua( o;(4alxoirctadoaDraieilt trtmxo iodlle lneia() Duaur nt4tpeo oeiysfa2ua( pnt)altnio3totfa rlnvs;()texmxo iy1llt  nci ( srurxr nt4aptnmo3tysfm2rlnvo t0aeeoxr3to1lpD aivs s) 2umir ou4optemivtatfa2raur nt0tpxn fctltfa rau s;t0arerxfcoydlpDeanei;s srxrio iodaptelivslt s2tm(rpnt4texniieiaslaDra(ms;u)trermr3oatlmteaieol(0s2uoir ny1altnmnes ()s2tru  nt0aexomf3iydfm2rm( pn()treoifcoadopDraieol()teum(m nodomt  fetlt sDtm(rpou1teeoiictadfsDrmnvo u)tltnxr iotfm rauei (0t2xmimpno1ol e icias)sDuaumonu1opt io3tltfa rmn ont0 rtrir tadfaDraues s0 etmxr3ny1oltnlfes () rtm(mpot1tetn ictytfmDeauvsnt)trxnif3ia1fmD li i;t)seumim io4open iesasf rumxm ot4tle  iciltlsDel(vs (0arxoif3oy1oaDe neo;s)srxoxrpiy4amt livt sf rrmxro;t4oetn iciytfs2ua(mo u4trenxf3oa1oatrlu s;(0 2to(m3oydapt  fetltfaDrmu ono4aet  f3iad a ea(vo () rxomrcoa1latelivi;()trtmirpiy4lmt micsl()arrr(  no1teeoio3iys s2rmn s u0aeeomr3oa1lpt aivs ()seumxm iydom  lfetat aDrmx  ou4tltniieiadlm emumont4 rermr ia1lpt auvs s0 eto(opnodlpeelivslsfa2trum ;t1aptoiieildlm ra(mp;(4aetrxfcta1om raiesls)trxm(o no1ameelnci (faDtau poo0tetoifcias mDrm( p;()texnxrciodfm elueols)t2urxopoo4om  mneiat) Dra(r ;o0apenif3iadlaDra(msn(4arxomo tadlm e u ilt0trxoxo3no4om e ivsas)aDtaxmoot1aeeomo3tytls2el(mp;u0tetrifcty1lpt lues;( s2tm(opiydlp nmnes tfaDuau  nu4opxomiciltla elumon(4tetomo3oo1lmD aiesl()srxrxr nydlle lfctat) rra(rpno0tpe mfeiadlm rmnvsnt0aleoio ty1op eau s t  rxoiopnu4lpeelfetl(  2ra(m ou1open feiysfs2ra(mp t)altrmr3oatom eau o s0 rurxr iu1omeelncta( srrmxmoot0tpenmieiltfa2ul(vo;t0teeoxociatfateli i;s srtrxmpnodll e nctlt)s2trum nt1ale ii3tld sDean p;t0 ltoiocootfaDrai o;t)teuoim3oo1open ivta(  Draxmooo1alx  fetadfsDuluvs;(0teenirciodla rau s t)t2xoxr iudll n ncia(f 2rax onu0olx iieiat a ua( snu)tlenxo3ia1oat auvo s  rxrir iudll emnci ( a2umxroou4oleo i3iltfs ulu p;t)aeerxr ta1oa  auvi () rtrxr3nu1lm nmiei (f Drmump;o4tpx io3tydfs2ulnmon(0 reoio ta1oa   uvs;()sexoim3oydaltemnetat arum(mpnt1tpe mo3ils a elnmo t4aleomo iydomteaivs s)tetmio3ou4omeelics t sDumumo;o0tetnif3tasla2eau s u) rxnir ia1laDr n o;s0seurxo iudlpte ieils arumxr ;u1oex mfeiys m ua(msn()tetrxfcoatlpD  n ilt sruoxm3iudal  livi ()arraxm nu0ape mi3iadlmDrm(ms u4tetnmf tadoaD  neo ()trtrxo3oo4lmee nes s) 2ur(  ou0oexo octytlsDemnmp u0tetoxo ty1fpDr nvo;s0seurir iy4apt  ictl()s2uax poo1tpx iociydlsDuaums;u4trerif iydfm rli s () exrxr3iy1aptelicta(fartmur ou1olto ictasfm rl(vs () etnmf iatfmD  i s;t0tetmim3no4lmtn ies t srra( poo4alx  i3iyd sDel( s t) eeoxf iy1lmDr ieol( t2xr(m3io1lm n net s) rra(mont1apeomictlt sDeanmonu) exrmf3oydlaDeanvils  etoimpoo1omte ies t a2uaxrpnu4ape mo3iltfaDum(vp u)tltrxoctydlm raiei;(0 rurxm io4omt  ivsasfsruau o;o0apxomoeiyslm eluvs u4texnxrcoy1latean ils  etrxo3iodol elnei s aruaxrpot1oeto o3iad mDulnmonu4 exrifcootfmte ivolt) 2xrxr3no1al emfeta()srurx  ot1tet mo3iasla2rmu o (0 eerxocoo1op rlnvo;s)setr(mpio4lltelivi s)s2trxmpnu4apxo ieiasla2rln on()aexrmf3oa1fateaivols)sexr(m nodlm  livta()aDrrurpnt4aex micils m2emnmp;u)texrxrciytlm   ivi ()srurim3ny1lme lnvtls a2ra( oou1oeeomf3iaslm2rl(mo (0 etnifcoytoaDe iei s0s2umxr nu4alee ietat aDta( ono0olto o3iydla ea( snu0altnmf3tatlaD aies;s sexr(r oodopt  ivsltfaDum(m ou1aptnmf3iydls2eaump;u4arxoif3oodomDraiei;(0sexrxm3nodllen fcilt)aDtmxrono0alxo iciysfs2rm(vp;u4 ltnio io1fmD lnvils0s2xoimpiu4al emfvta( srur( o;t1oexoifeiysfaDemnvs;u0tltrmfciy1fpt lnvi;t)sexo(r3oodlltnmiesl( sDumu  ot0tpxoif3iydla2eln o;(0aexrmoctotomt an i;(0 exoxo3oy4lpe  fvt (fsrrrxmooo1alen fciysfaDelumsn(4 rxrxf oa1om  lueo s0 rum(mpiy4al  lnvia(  2rmxrpnu1texn ieils mDem(vsn()trtrxf3ia1omteai o;s)texoirpiu4ll  mncta(f Drmurpnu1oexn feiytfsDuanvs;u0 rxoif3totfp   u sls srtr(rpoy4ol emivs t) Duax  no1olt  oeiysfm umu s u0tetomf3ootlate uvsls0t2umxm3oo4ome miet s) 2truroot0tptoii3iltfa eauvp;u4trtrioctytfmt lu i s0 etmxo3ny1lltnmfeiatfs2ururont4opx  feiysfsDem( pnu0 etrifciytoatrlnei s)srurxr ny1omeemfciat artrurp;u4tlxomi3tydfa2emu p;(4 exrxocoatfa raivo;t sexoio nudoltemneiasfa2taur ;u0ape iiciad mDeauvo u4teeoxocoa1lmD aues s)t2trxopnu1om   fvtl() rururpnu0opxo ieiadfm ul(vp t4arxrifcio1fpteluvol(0 etoxr3nu1lptnlfvt sf 2ua( oot1tee mo3iydla2ulu onu0 exoxocoa1oa eauvi s)trum(r3iy4omtnmfctl(f rrruro;t4olt ioeild s2uauvsnt)aexnmo oadopte n i t0srtrxopou1llee iesa()aruaumo;u0opxnmietldfs rlu on(4 eermrcoydfa r ues s)srumxo3nudlmen fcs s  rum(rp;u1oee mf3ils a2emnvont4 etnio ty1lpDran o;s0texr(m3no4altnmfciltfaDuaxmpnu4ape  i3tadfs2emumsnt4alermf totlptrlivs;t)setrxopny1lmeemivt s  2ra(r no4tleomieiad m ea(msn(0aexoxfciydlm   i ilt teur(m nu1lm e feil(  Dumxrp;t1oeto feiysfa rmn o;(4tltnmf tatopDrlnvs t  exoxm3oy4lp nlfvil(  Duaxmo;o0texoii3iltfmDra(vp t4 lxoif3iy1omDeanes;( s2urim3iydamen ieslt)srraxront4tpt  feias m2um(vo;(0tlxnxfciydfmD lnvo;s0t2xmir3oudlptemfct tfs2rrum ;t4tet moctyd aDeau p u0 etoxo3oa1fp ran slt0 rumxopoudol emfciat artmxroot0tleo i3iasfs ra( on(0aetnxf3totfmt lieil(0seumim3oudape mnvt (f Drr(mo;u4aee  f3ils m2rmums u4aexnmocty1om   nes;s s2toxr oy4altemnes (faDumu ono0aexomoeilslm2uln p;u4 rtnxo3tatlaDr i i;t0 2umir3iodlmenmnet tfsDrr(ro;t0olx io3tyslaDuanms () rxnmr ia1fa rauei s) etr(opno4amtelietlsf Durxmoou1aeen o3tasls2eanvs;u) rxrxr io1fa r u o;t  rxm(r oodolt lfcilsfsDta(m ;t4ope  feiltfs2um( o u)altoir totlaDelivo;s) eur(m3iu1optemieilsfsrurxmonu1apenifeias s2ea( p;(0alenmr3iytlateli i () 2xrio oy1apen nvtlsfa2rrxrp;t0tle mf3tldfs2elu s;t4altnio3iatla   u i;t  etrxrpiudamte fci tfsDumx p;o1aexo octad sDum(vonu0trenxo3io1latranvs;s0srtoir3nu4al emnvsls) 2rr(mp;t1aexnif3iasfs2eanvp () ltrmr ia1opDr ueslt) 2xoxmpoo4lm n iei ( sruauroou4altoii3tys s2ranmo;(4 lxnmociadlat  n i t0srxmiopoudapte nvils)sDurxmoot0tltoiieiyd m2um(vs;(0 reomf3todlm  luei;( texoio3iu1olt lfesatfa2tr(moou1optoiiciatla2umn pnu0tltnmo3todfatr ueo;(0sruoxopoo1aleelnvias a2ra( poo0tltniieiatfs2em(vont0tlxnmf3io1laDrlivo s0 2trim3iodlmtemfct t) Drax  ;u0tlxnmociysfa2ul(mp ()alxnxr ty1oa ran ils  ruoxr3ou4aleelfcilt)s2rrumonu1apxnmociys aDeln p t4aexomf3ty1lp rlueo;t)texmxr iy1lpe mfeiatfaDtru o;t0ape  ietyd sDum( s;() etoxf3iodlm rli s;s) exmirpio1am n ieilt aDtmuroou0olto o3ilslm ua( s;u0alerir3oatopte u ols0t2xoir io4omtemfci s) rtmxmo;t0tptoifctltls uauvp t4 eenxrciatlp rai i;t t2toxo3no4optelicsls aDtmur ;u1tptnio3iatla rau sn() leoxo3tadlaDelu o s t2xrim oudlmenlncsa() Dum(mo;o0tleomfeiatlm ulumpnu0 exomr3io1laD  i i s) 2tmiopny1lptn ivtlt) 2tm(m oo0oex  o3tyd s2rlumsnt0aetrxf3tydlm  livs s)s2umim oo1llenlfci s) rta(r ;o0tltoio3ilsls2ra(vp;()trxrio iadoptelivols  2tm(m3no4om nmneia(  Dtrump;o0olto o3ilt m2uanmp;u) lxrxr3oadlmDeliei;()teur(m3iodopt livi s aDtrur ;t4aee  oetld sDea(vont)aeerxf ta1lat lnei s0s2xoxr3io1ap  mncslt aDrrumpoo1alx  o3iat sDeauvp;(4trerif tadomDranvsl() rtoxr3no1omte nei s arrmu pot1teeoiietadlsDuanvo;u)tetnmr iydlpDrlivs s0sexrirpny1alee fvi s)srrmuroot0oee mociltlsDrln ont)artnxr totlatelieo;s)teurirpiu1lmee nvs t)a2rm(mpot1apt  o3tls sDrlumo (0artrxf iotlm eaivsl()srxrxo3ny1am n ietlt) Drmxmp;t0tpx mi3ilsfaDuau snu)aetomo3iadlmt auei;(0 ruo(o iodlm elnvt s)srtmu ono0aptnii3tlt aDua( sn(0arenioctatlatrlnvi t s2xoxm3iu1ol nlict t aDua(  ou0tptoifetyt m2um(vo u4artnxo todoaDe ieol(0s2toiopnu4altelnvtlsfa2tmxmpnt1oeeomoctasfs umump u)teeoxf3oy1fpt  ueolt)t2uoxrpno1lmeemnctl( arrrum no0tpen feildfs eaump;t0trtrxo3iodlpteaiei (  exmimpiydlp nlnvtatf rtr( p;o1aptn fctydfs2emumo;t4aetnmr iytla e u s;t)srtrir iydale  iesls)sDtaxrpnt0texn i3ias s rm(ms;(0 rxoirctodom   ivo t0 2toxrpoydap emivsl(fsDtm( ono0tptniictls sDelu s;t0aetrir3oodoat  ueslt0 ruo(o iy4lm nliviatfsDrrx  nt0ale moetlsfm eanvp u4texnmf3tydomD lieol( s2umxrpiudole lfvi s arraxro;o1alenio3taslm2el(mont)aetoir oa1omDrlnvs;t trxr(m3io1am e nvias arrmuroou4tle  oeiyd sDelnvp u4aexnifciytfa eau sls setmirpny4altemfci ()s2rr(m nt0tpxnmfcias a2elumon(0aeerio3tadopDr iesl()srto(o3oydlptnmncsa(  2rr(mpoo0opxniieiyt m emu o;u4 rerir tydlmDe i ilt0 2um(o no1llt liesatfa2rau pot0opt  fctldfaDulu pnt)teenir3todlatraies t)t2uoio nydaltemfvi () Drru  nt1oltomicilsls2umums;t) eermf3oodlptrau ols)trurxm3iudalt mnvilt)s2tr(rpou0tlx mieiytfa el( o (4teenxf ty1laDe ues;() rxrxo3nydlme livils)sDta(mpou0tpxnmi3iasfsDrluvs u4 eerirctytfp   ues ()t2uoim3oy1op  mfeia() rumx ono0alxnmf3iydlmDrmn onu) rerirctydlat livi;s)teurir ny4lleelneslt) 2raur nu0tltnii3tadls2ea(mo;(0 rxrxrcia1oatr nes;t0 2xmxr3iu4ll emncils) Dua(  nu0apeomoetldfm uanmpnu)tetnif3tydfm  ai il( s2toxmpoo4ol n iesat sDururpoo1aex mfetas m2ul(ms;() rxnxo todlat aieo () eurxo3io4alenmfcia()s2rmu oot4tetn oeiyt mDul(monu4arerircoodfm elneils t2xrir ny4llt  fetlsfs2uaum ot0oeen i3iyslm uaums u0altrif tatlaDr nei;t)trxoxmpoudapte ict t a2tau  ;u1tleoiieilt aDumn onu4trxomr3tatfa r ueilt  rxm(mpoodoleelics ( s2um(mpnu4oetomf3tls sDemnvp u)texoxo3ty1lmte nvo;(0srumxr3nu1ap elieilsf rrrxr ;u1teeo i3tas a uaumsn() ltoio iotfptrlivs;t) rtm(rpiu1lmt  ncs ()a2tru pnt4tpx  fctasfm2ea(ms;u0trtrmr ta1lptelueo;t)seumxm3iu4altemfcta() 2tax oot4aeenmietytlm ulnvont)trxnmo oytopDeauvo;t)teuoim io4ol eliviatfarurur ot4altomfeiaslm2rmuvsnt) reoif3iadfmtrlivi s teur(o3iy4lmen iesl(  rrmx p;u0olxn iciadfmDranvs;(4 rtnir3ta1fptraiei s  exo(o3iu4aptnmfvs (fsrrmxmont4ole moctysls2umu s (4altomrciytfate nvo;(0tetmxrpny1apenmivtl()srrrx pnu0oet mfeiydla2ra(von()altnxr3ta1lpDrlu ils0 2xrimpou1omtnlfesl(  Dtaump;o1aee  feiyt aDuanvsn(4 lenmrcoa1lmD  ivols0 eum(r oy1ll  mnct ( arurumo;u4tlx  fctys a2uaums;u) etnir tadlm   nvo;s) 2toimpno4lmen fcil()s2rrxmpou4teen fcildla el( s;t4 rxnirciodoa  lnvi s0t2toxopou1opeelneta(fa2trx ono0ale mf3iys s eau p;t0alxnmrcio1oa  lues t0 2xo(m no4oleelnet sfa2rmxmpot0oltnifciysfmDrlu o;u4arerxo3iotoaD livo;s  rurio3iy1lpenlivia(fsruau  nu4ale ii3iad s ulumpnu) ltrirciodfpt  ivsl()srumio3ny1aptnmnct s)arrrxm ;o1alenii3iyd sDuluvp t4 reomfcoodlm eai s t)t2xoxopoydlmtelnct s  Dururpnu1aetn ieiytfa ulnvp;u4trtomo3iytopDr neo;(0sexr(rpiydaptelfci s) Dtm(mo;u0altnioeiys m2eanms;(0 eerxr iotom elueslt sexrxmpoudal e fcs sf Draxmp;u1openmietldfa rmump;(0 rtnxr ia1omDraneo () rtoxo oo1ame livils)aruaxmp;u4aeeniociys mDemumpnu4 eeomr3oa1lp e nesl(  exo(rpiu4am  lictls  2urum oo0aet  f3iasfa ua( o;(0alxnirciydlpt  i i t0srurxr3oudomte iesa(  rurxmono0aeeoif3tyslaDrmnvsnt)arxnmfctodoaDrlnes t  eumxr io4lmtnmfcta()a2ur(rp;t4oet if3iadfm2emu s;u0tlxoio3tatoptraneilt)seurir3oodlpeelnct () rtrur nu0tpxomoeiatfa eaumon(0artrio iodlpte uei;t0 2ur(r3nodlp nlnvtas aDur( pou4oex  iciaslmDul(ms () leoxoctydlptrai sl() 2xrxrpio1amtn iesas  Drmur oo1olt iietytfaDulumo;t0 exoxo3iotlaDrlueol( t2xr(o ny1omtelici ( srta(mpoo4olenifciytla2rl( pnt4artoifciy1fmte neilt) 2xo(o oodamt mfvsls a2tax o;u4oleoif3ilt aDranvp;(4aeeoio3iotop elnei;s0 exoim3oy4om nlnetls)a2rmxrpou0tpeomfeiatfsDel(vpnt0aetrio iy1lmtelieol( sexmio oodamenlicsltfsrrauro;u1aexnio3tad m ran on(0 exnxrctadomDrlivols)s2xmxrpnudaleelfvt (  2ur(rpnu1tetoioctldlm rlnvpnt4 ltoif oytlpDrlivil(  2xmxm3iodomeelfvtat srraurpnu0ape  f3tyd s2ua(vo (4 eenxo3tytomD an i;t0texmxm oudalee fct ( a2rm(mono1aleo octls a uau on(4aexrir3iatopDranvi ()teuo(o ny1lmenmnvsat sDrmxmpnu0tpx iictldla2ra(ms t4 rxoxr3oa1lpD lueo;t0srur(rpnudolte fcilsfsDrrxrpoo4tetomfcildlaDra(vp;t0tlxrxo3oytfp eaivo;t0tetoir3nydam nlfei ()srtmxm oo1alx  feiydfa ulnvs;t0trerxo3oa1oaDeaueo;t) etoirpoo4ameemfcias)aDumumo;u4apxnmociatla2rmn s;t4tlxnxo iodoat lnei;s)tetm(o3oudap nmivsa()sDum(mpnt0alxnifeiyslsDrauvs (0areoir iydomtr ueilt) 2toim nodopeelivt tf rtrx pnu0texoio3iyslm2eanmonu) rermr oodop rli o;t0 2xrim iy4aleelietasfs2rmxm ;u4tet ii3iytlaDrmnvsnt0trtomo3iytlpDr ueo (0sexoxm io4amt mivsat)s2urxro;u0tleo oeiat m2uanmp u4 rxnmo3tadoatranesl()trxmim3oy1opt lnvils) rrmumpou4oex moeiyt sDem( pnt4trenif oodlmte ivo;t  eurirpnydaleelietat)arrr(ro;o1aptniieils a uauvo;u4trerxo3totopD  nvs;s) rxmxo3oy4ap e ivsl(faDtrx  ;u0opto f3iysla rm(vs (0 lenmrctydlmDran i;s t2uoirpiodlp n nvsat)sDum(m oo1texomi3iaslm2ra(vs ()aleoir ty1oa raneo;( srtmxr3oydlmenlict (faDtmxmonu4opeoioctys mDeluvonu0 eenif oydlpDr n i;s  exm(m3ou1aptemicilt s2rmu  ;u1opeo fciatlm uanms;(4treoxfcoydlp r ieo;()t2xrirpoydope lfeia( sDrmu  ou1aleo o3iltls2uluvsnu)teeomf3ta1op r ues;t0texoir oy1apenlnvi (  2uaxr nu1optoioeiadfsDrln o;t4 lxnmr3iadlmD livs s  rumir3nydlmtelietas)s2tr(rpnu1tltniociysfs2ea(vo;u4arxrif tadopDrau i t  ruoxr oy1lme lieil(  2trum nt1aex mfciytfm2rlu p;t0arxnxo3totfa e iei;( t2to(rpnydlpe  ictl(fa2tr(rpot1tlt iictydfs ua( p t)altrmf3tydomDeanvs;()t2umio3io1olen neiasfsDraxro;t4altniiciltfm2ran pnu0alenifcty1lm   u il(0t2tm(m ny4ap n nvslsfsrurur no1apenif3tlt m elu s;t0aeeomf3iadlmteli ols  rtoxm3iu4lpeelnvslt  2trx pnt0tpe mfciyt s ul( s u)aetnmr iadlmte ies ( seum(r3iy1op  lfeia() 2tmuro;u0ole  feiltfa uan pnu4tetoxo3todfmtrlneo;s0teur(rpno1lmeemivsa() Draxm no0aeeomfeiadlm uaums t4areoxr3oytlpteaivo;()seuoio oo1lm nlicias) 2tm(mpno0tlto fciadfaDel( p u0 ltrif iotfm eauvo;t t2um(o iu4aptn nvias)aDuax pnu0tlt  octytfm rl(mp;()areoio3oy1optr ivsl() rtrio ny1llt  fet (f 2rmu pno4alx iietys s rmnmp u)aeeoxo3oy1la r nvs s0 2xmxo3nudlle lfviltf 2tr(mp;t0oexoioctasfs emuvo u0 ltoxr iadom  anvi;()trtmiopoudapt lncias  2rau p;u1tlen o3tydfaDuln s;u4 lenir tatoat aivols0sexrxr iy4ll  lnesa( arua(mooo1aleo f3tytlsDem(msnu0tetrmrciy1lmtelneslt trtmimpoudole  nesat a2rr(mpnt1tpeomf3iad a2rlu s (4 renxo iy1lp eaivi t)s2umim ny4om emfvtat)aDta(mpnt4tee moeiadlmDuluvp;t)tetomr ootopt lnvsl(0 rxoxmpnu4optnmictl(f rrm(  ou1altn ietlslaDua(vpnu) lenxr tydfpDelnei;t sruoim3oo1oleelfet (  Dtmxmoou4teeoioetldls um(vo t4tlxoxo todop rlnei (0s2xo(r3iydal  mivt ( aDumu onu0texomiciatlm elnvs u0tetrmo totlaDeli i s0 2um(o oydalt lfvsas) rtmxm no1aeto fciaslsDrmu s t4aeenxf3oy1omDelivs;s0 rtmio ny4op nmfvilt)sDurxrpoo0oltniocilt aDel(vo (4tlxoio3oo1fptraues t)s2tmio3ou4amen fciltfs2ra(m nt0texo oeilt mDrm( o u0tltnmo3tadomDe neo;s0s2tr(m oodoltnlfcs (farraxrpno4oltomietat m eanvsn(0 rtrirciodomt  i i t0 2umimpiu4lle lfvt sfs2rrxrpnu4teeomicias aDeaumo u) rxrxf3totomD aiei ()tetmxr ny4amen ncia(  rua(m ou0tle  o3iadls um(vsnu)tleomo tydlaD aivi s0 etr(m oydlle  ivsl(f Drr( p;u0oleomfeiadfa ean s;u4arxoxo3oo1fa   ueslt0 2tr(r ny1llt mici t) rrrxmp;o1opeomo3tyslm ean snt4 lxnio3ty1fmDeau o (0s2tmxmpnodalenmnvi ()artrum ;o1ole mfetadls2ul(msnu4 rtomr totom   ivsls0s2uriopnydlpeemfesa() rta(  ;u0alenmictys s rl(mp () rxoir3iadfat  nvslt)texrim3oo1ome mietas a2ta(mp;o0apeo oeildlm2ran p;t0tlenif3to1fpt livo;() rumxopnodlmtelietlt)sDtau pnu0oet ifcilsfaDrl( pnu0trerxr3oo1fatrlivs;t0srxrxrpnydomt licsasf rra(  nu4oexomf3iadls um( p ()aetoxrciytomtrlnesls) 2uoio nudomte nvs s sDuau poo0oetn fetydlm2umu s t0 rtnmo iatlateanes s trxm(mpnydomtn ietas aDurxr ou1olxnif3iyt a2elump;(4 rxrir iotlpD  u i;s setrirpnudopenlfcs s)sDumuront0oltn octys mDeln o;t)arerif tytfat ln ils0 rtr(mpnodlptnlncilsfsDrrum nu0oexo fctydlm2ulnvo;u0aexrmrctodlp   nei;s)srtrxm3nydaltemnet ( s2um( o;o4apto i3tls a elnvs t4arxnir3oa1fmte ues;t teum(m ou1ap elnei sf rra(mpot0apx  oeiysfm em(msnu0 ltrmrcio1lmDrau i t teumxm no1alee fctatf Dra(r nt0oleoifeiytlmDum(vo u4trtnifcoydomDeaies (  exr(mpoodom e ieiat arta(r nt4ole  o3tytla2uaump;()altnxr tadfmD lueo;s0 rxrxm oodam  lfcilsfsrur(m nu0tlt ioctldfs2rl( pnt0alenio iotlpDeln ols0trtrxm3oo4optnlfesasfartmu pot0tpe io3ildfaDeau p (4tlxniocto1la  ai s s0s2xrxopny4ole mictls)s2rmumo;t1olenifetlt a2umnvp;() rtrmr3iotla e u i s)trtoir oy4apenmnet t)srtrxr no1ole mfctadlm rau s t)aetomo oo1la e iesls trtmxm3iudaleemnciatfs2rm(m no1aetnmietadfm2umuvp;u)alxomf iodla e ivi s)t2toir oy4ol   ivi t  2rm(m oo1aleo ictysls2umu p;t4aeerxr3oydomDr nvo (0tetm(m3ou1amte ieil( artrxrpot4aetoiociyt a2ran o (0 leoif3oadfat au i;t srtoim iudomt  fct ( sDurumpou1olen o3tadfsDelnvsnu)alxrxf3ootopt li i s)trum(o3nodll   ivi ()s2ua(m ;u1optomfcilsfmDulump (4 lerxfctodoaD lneilt0 2uoimpnu4lm   fetas) 2rmurpou0optnifciatfaDum( o u0 lenmo iadfmD luei (  rxr(rpno1opeelncsat srtm( pou4opeoiiciltfs rlnms;() exnmocoydfpDrlnvsl() exr(r3oudome mnct s srrrxmp;t0tpxnio3tldlaDuluvp u4tltomf oy1la  ln s t  rurim3no4amtnmnvs (fartaum ;t0texniieiyd s em( o;(0aexrmociodfp ran il(0t2uo(o ny4lpee fcsls  2rrx pnu1ole  fetatfsDeauvs;t0arxomo3oytfmDe ivi;( srxoimpou4ap e iei s)sDrax ont0tleoioctaslm uau ont4aleomrcoy1fpDr nvi ( teuoio3iydap elnvia(f Dta(ro;t1opxo oeiytlm emu s;t)aexomfciatfm r u s;s  exoxm3nudaptn fcsas  rtmur ;u1alt if3iys a2ua(vp u)trxnxr oa1lat luvi s0seur(o iudame mfetat)arraxm ;t4aee if3iyd a ea(vpnt0aexnxr oydopDr uesl(0t2umxmpio4ap   fvs t)srra(mpot1tetnifcias m2umu s t0altrmr3oydomDrln s;s  etmio3iu1opt  icsat aDurumonu0oetoioctlsfa2ea(mp;u0 reoircoadoa rlnes ()trxr(o3oy4llen fvil(fsrurx ooo0tet mo3tasfa eln pnt)texrmf3iytlmD luvi;(0 ruo(r3io1apt livia(f 2ur(m nt4oltomo3ild aDran p;u0arxomo3iodfa e uvsls  exrio no1op emnctatfsruaxr ot0tee  ieiat s2rluvp;u4aexoxf tydfmD  ueo;t)s2uoim io4oleelfetas)arrm(rp;u4tpxoii3tat m rluvsnt) eerxoctytop e n s t)srxmxo3oo4ap  mivsa(fa2tmxmonu1oet ii3iatlm elums;t4tlxnxf tadfm eanvi;(0trtoxo3oo1lmeemnvtltf Drrxr ;u4apx if3iadfm2uanvont0trxrmo3tadfpD  i i;t) 2xmio no1al emfvi s) rtr(  nu0tleoii3tlslmDemuvp;(4trtnif ia1omDeaiei s0sexr(r iu1al n ncs (fs2rrur nt4tleo o3tltfs2ea( s;u) renmfcoadla r ivols0s2toir nodol nmieils  Duau pnu0tetn oeiltlm ranvsnt0 lxnmf3iydom e ueo;s srtoxm oudlm nlicilt)arrrumpnt0tpeniocilsfa2ua(mpnt4 eerxf tatlateli o s0t2ur(opno1lmee fesl(fs2rm(mpnt1oex mi3iytlsDulnmon(4tlerxr todomD  ueo;t)tetm(m3nydalen iet s s2urumoot0olxomfetadlsDeauvo;u) lermrciydfaDelnvi;()seumxmpoudoptn fci t)arumxmp;u0tle mi3tyt m2el( p t4tlenxo3iy1lmt  n sls s2xmio3ou4aleemiciat  2ta( p;u0aee moctytfaDel( p;u) exomf3to1fate neolt  exrio3nydal nmfcslsfsrrmx p;u1tex mf3iasfa2ul(vp;u4arxrxfcoodomDeau sl(0sexoxo ny1aptemivias)s2rmur ;u4oeeoiiciadlm2eauvon(4tetoxf tytoa eanes;s0trumxr3ny1lltn icilsfaDrmur oo4ole  iciatlm rl( o;t) rtrmf ty1optr ivslt0 2xm(r nodole lfciasfsrrmxm ot0apx ifeiadls2umuvs;u0trtrxf tatlpDraieo;t  2toxo3iydopte ncs tfsDur(r oo0opxomieildfa ua(vo t) lenmr oo1faDr n o;s)srxo(m3oydapt mncsas sDtaxrp;o0aexnioeiadlsDulu p;u)texomo tadla  lu i;s trurirpio4ll   ies t s2um(mpou4tptn octlsfa rm(vo ()texrxocia1oa rlu s t0t2xmiopno4oltemnei ()sDrm(rpno0alxnioeiad m uln onu0 eenio3io1om   i i;t t2um(m3oo1ole lfeil(f Drmxmpnt4tpxnmf3iys m2elumpn(4 rtomrciodlpD livi s s2xoiopno1am emies () Drmx  ou1tlt moeiysfm2el( s;t)trxomf3iy1omtranvo s) 2toxr3iy4lpt lnci s)srua( ont4tex mociydfa ranmp;(4trxrxrcoydfp  lu olt s2xrio oodlptnlnciatf rrm(mpoo0apt  feiysfa2ra( p u)tlxomf io1oa rlu s;t0s2xmirpnu4omenlnvtls arra( o;t4opt ioeiadfs2umnvs;u) rxoxf3oy1fmtrlivo;s) 2ur(m oy1op  lfesa( srta(roou4tptnmf3iat sDrmnvs t0 lxrxrciodoatr ivi s) 2trimpoy1lpen ict t  2trurp;t1open ociasfs ean onu0areoirciodlpDelueo (0trxoxr3nu1lltelietat arrrxmooo1oleo fciyd a2ulnvs (4 lxomo3tytom  aivil()seto(r oy4lmeelnesl()aDtrurp;o1tptomf3iasfa ranmp;()trenmf iotfm elu slt)sexo(m io4om  mnvt t srurxmoou4olt  fctysfa2em(msnu)trxoxfcoydla rauvo;s  rxrim ny1llen net ()aDur(mo;u1tpxn o3tad aDuau s;u4aeeomfciy1fmDraiei s0t2trxm iudaltnmneilsfsDumxroou4tpt ioeiysfm2eanmo;u)treoxf ty1faDraivo t)teumirpny1aleelncil(faDrrxro;u4ale mf3iad s2uan o;(4tetoifcoadfm ranvilt  2xmxr ou1lleemnctlt  ruaxmp;t1alx iieiatls ra(mp (4trxnir tadfmtran il( srxm(rpoo1al elnes ()aDuru ooo4opto o3ils m2rl(vo u)tltoxr iotlm raueo t)s2uoxr iy4aptemnetl( arta(moot0olenmfciyt s2emn p (4teenmfcia1opD  i s;()s2to(rpoydll  lfvtls)aDrr(mpnu0oeeomictyt m2elu p t0teeomf oadom  ln i;s)srumim3nodap nlnvtatfarrrx onu4texnmociyd aDrm( snu)teerioctatomDr uvs s trurxr io1ape miet () Draumpnt1alxn o3ilsla rmn o u4aeeoxrciotom  auvolt texr(mpou4lmee ncsltfsrtmu oou0aee  i3iys a2rmnmpnu)tlenxo3iydlaDelivi s0trur(r io1ome lfctasfaDuax ono1opeoif3tltlm umnvp;(4 ltnircty1fa rln olt0setrir3ny4ol elnvsa( srtau pot4alxn i3iltfm em(vsnt) exomrctydlatraiei;(  2urxr3iu1amtnmfvs t aDrrumo;o4openiietyt a2ranmp (4trtoxrciytoaDr nei;(0 2tmxo ou4lp nlnvtlsf rtr(moot0tlto fciydls elnmo u4 rtrifcta1opD  ueils)trtr(r nudom nmfcs t  Dtm( pnu0opxnmi3tltlsDelnvo;()arxoir3ia1fmD ai olt)trtm(m io4am elfvia(  Drmu  ;u4aetn feiatfs2rl(vonu)trxoxrctatop elu o t0srxrir3iu4alt lnvt tfsDta( onu1aexomoctls m um( p;(4aeermoctadfaDe n s;s s2xrir nodoptnlneia(f rua(moou4olxnmoctld mDul(vs t4tleoif3iadfptrli s s s2xr(m ou4omt  nvtl()sDraurpnt4altoioctat a um( p u)aetnxrcto1la r uvs;(  2xmxm nu4ap   fetl( srtmxmp;o1ole if3tld mDran s ()altnmr3ty1lmt  ies t0t2umxmpou1alenlnvt tf rum( o;t1alxnio3iat sDrmump;u) lxoio io1faDe ivs;s0trurxo nydal elfvt (f Dtmxront4apxnmf3ils m em(vpnu4aeenxrcoadoptr ieolt0 exmim3nodam emnvta() 2umu  nu1oleoiictldfa umn o u4tleomfciodla eln ols0 2tm(rpnu1ol e fcta() 2ururpoo4tpeomoeilsls uauvo (4arerircoatlmD  uei s tetmxo no1llt mivsatfaDrrx ooo0oeenmi3iasfa2rl(mon()tlxniociydfp  lnvols0 eur(mpny1ap elivtl( aDtaur nt1olenmoetltlaDel(vp;() lerioctadlpte nvolt sexr(mpnu1ape lfesatfsrua( oou4tlt if3iytlm rauvp (0 rtnif iatlaD  ivi;( t2uoio3ou4lltnlivsas)arurumo;o1tptn f3tls aDelnms u4 etrmo3oydomteanvilt0 etoiopnydlmenlietas  Dua(  ou1olen ieias a2rmump;u4tlxrifcootlaDeliei t trtoir3nu4optn nesa() Dta(ronu0alt  iciasls2el( onu4tlenmo oatlpt aivsl(0trxrxo oydaltemfvtltfartrum ou4texomi3iadfmDraumsnt)tleomf todfpD lues s texrxo3ny1lmeemncsat)srtmum no1olx mieiydfa2uanmp u4trenif oadlmt lnvslt  exrxmpoo4lp nmfetls)sDtru p;o1opx if3iyt mDrm( sn() rtrifcta1faDe ivi;s0truoim oy1amenlieiat  Draumo;o0aetn ocilslsDuln pn(4aexomfcootfmDrai o;(0 2xrxr3iu1amt mnvtls)s2urum ot4olxomoeiatlm2eanmont4aetnioctodla  au s (0 etr(m nu4lp  lnesa( aDta(ro;t0aexnifeiad mDea(msn(4 leoif3oa1fp  lieslt0s2xo(o3io4am e nvsls) rrm(mpot1apeoiietldfs rauvp;u4 rxrxo iotfmtr n ilt0 exmio3oy1opte nvsl(fs2tm(mo;o1tet  f3iltfs2elnms;u0 lxrmocoadfp  aieol( seumxrpnodlm   fet (fsDur(rpoo1aexo i3ilt a uluvpn()texrxf3iadoat an i t s2umxrpno1alte fvi s) 2rmxrp;o4tee  fctat m umuvont4aexnmr3iadlpDrau o ( trtoim3ou4altelieils sDtau  ;u0optomf3iadfs2uau s t0trtnxrcootoa eau s;()srtrim nydolt miet t)a2tmu ooo1aex miciadfa uanmo;t0trxrio3ia1omte i i () 2xrio iu1lmt livt ()aDtaump;u4ape  o3tlsfs2rlumpnu0tlxoxo tatlaD livo;s trxmxmpnu4omtnlncils sruax  ;o0tpx mieiat mDumuvp;(4aetnmrcto1lpD  uvi (0srxmim nu4am n fcilsf Drr(  nt4tee moeild mDranmo u4artrio todfp ran s;t0srxrxr iydlpenlictat)sDtr(  ;t1tltnmfctytfmDuanvp;u)tetoxfcoo1lpDe ivi;s) etmxrpnu1lp  lfetl( aDrr(mpoo0alx moetlt sDumnmp;u4 leoiociydfmD  nvi t0 2xmio oo1lpeelnciat  2umurpno1oleoif3iys a raumsn(4trxnio oodlmtrlueolt)texriopou4apt  ncsa( sDtauroot1alxnif3iltfm2em(mont)altnxf io1op r uvsl() 2ur(rpiy1llen feias  2rrx pnt4ale ioeiydfsDemnvsnt4aexrxf oadfpD an s;t)s2uoir iy1optnmfct s  2trx o;t0ale mocilslsDel(monu4aetnxo ty1la elivs;s srtr(m3iydopenmietatfsrra( p;o0ope mfcilsfa rmn on(4aexnmo oytop r neil(  2xoxo iu4ame lnes (faDrr(mp;t1tet mfciydfsDemn p;u0altnxrcootlptelieolt0 rtrirpio4lltnlnesat) Duax o;t4altoio3tadla2ua(mpnu4altomo3iydla   i s;t0 2uoxopio4ap nliei s sDurxroot4olxniociasla umnms u4tlermf totop rliei s0t2trir nydopt lnvil(faDra( pno1olxomo3iyt mDrmn p t) eeoxf tatfmD  ueilt0t2xmio nu1op nmivia(fsDraurpot1texnmoetad a2eaums u4 leoif3oytopte nvsl( setr(r3ny1alt micsa(fs2rru ooo4tlxo oeils m uanvo;t0 rxnmf iytlatrlivs (  etmxopoo1am n fct tf ruau o;t4alx  oetyd a2rmn s;(4 lxrxfciy1fptrlues (0teuoxo nydope  fcsltfs2tru  ;o4tpenii3tasfaDrmuvs;t4alenio to1fa  lnvils  etrir oy1amen icilt  Dtmu oot0teenmociatfa emnmonu4 exnxf3ty1om  li ol(0trurxopio1omt livils)srurur no1oetoio3iydfaDuan s;u0tetrxoctatomD an il() exoxo io1opt lfcs ( sDraumpou1oexoii3taslsDrlnmsnu0alxnio iy1fpD  ivs t)srum(r3no1lpte fvsasf 2ra(mpot4tlenifeiys sDraumo u) leomf3oy1la e iei () exm(mpoodaptelnvslt  rtmx  ;u1alt  feiadlm raump u4trxoif oo1om rluei;s)sruoxo iu1ameemfviasfa2rax p;t4oeto ieiytfs2ul( sn() lxrif to1faDrau il( srtmiopio4lmee icsas)srtr(roou4alxnmf3tatfa2ulu ont0 etrxf ia1fa e ueo t  exrxr3no4omt lfvt (f Dtaxro;u1tptomoeils sDrmnvont0 renir iadfpDeaivs;s0 eur(o iodam e nei (f rum(r nt0aleo ieilt s2um( p;u4 reoifctytoa elivo;t t2xm(rpny1lpeelnvt ( aDra(r oo4oee  o3tys aDrlnvp;(4aexnmr ty1lmtean i t0srtm(rpiodlm nlfvt t) Durxr oo4opx if3tadfs2rmnvs;t0 etnirciadom e uvo s s2xrxm ny1aptnmneslsfsrtm(rpnt0oee ii3iatfs2rl( s t) lxnmr totla rlnvsl() rxmxrpoudaptnmivia(f Drrxrpot1oexo oeiad s2ea(vont0 rerir3iatla rai s ()trtrxm3no4lptemnes s sDuaumo;o4tptomfeild m2el( on()tlenxrcoo1op e i i t) 2xr(m3no1lm nmfvi s srtrxm ou1apxn o3iatls ranvs (0 rtrmf3oadfaD auei;s t2urirpou4amenlfesl( sDtax  ot0apxnmf3tydla2uln snu0tetnmociodlaDr n slt0srurxr3oydamtemfesat  Drax o;t0altnmictytfsDumu o u0arxnmfcoadomtr iei s) 2uoir3iy1ape livs s)srurumpnu0optnif3tls a2uanmp (0 rtoxf3ia1lmDeaiei (0truoio oy1lme  fvs s srrrumooo1tlt iociysfsDeluvsn() rtrxr3tydlaDeaivi;(0trxrim3iy4ale lfctatfaDtax  nt0olxn icilt aDul(vp (0trxrio3to1om eli o;()trtmxmpiy1lmtnlfvsat)aDta( oou0oleoiociltls2eln p;(4tltrxociadlmDrlueilt0 rtmir3ny4alte fvtls artau o;u1openmictas aDea(vo;()tlxrxo oodlm eau s;(0seurxo3oo1omtelivils)srraxmono0aeeo i3iytfm2ulnvo;(4 rtrxrciydoatraueo;s  rtrxm3oudapeemivtlsf 2umxm ;t1altoioetysfaDuau s (0aeeomocoodomDean s;(0texr(o3oudamenmivs sfarraur ;t1tlenmoetlsfm2eau o;u)tetnmr iytlmt aies;s)trtrxr3nydolen feil( a2ur(mo;t0ope  ocildlm2rluvo;t4 eermrcootlmD  nes;t setoiopoy1lm  lietatfaDrrum no4opeoiociaslm2rmuvon(4tltnmrcoytfmtranvo;s0 euo(mpnu4omen iciat  ruaur oo1alxo f3tadla rl( pnu0 rerxf3tadlaDeaivo ()tetoir oodol   fet (  Duaum ou0aetn ieiysls2rl(mpnu0 etnmo io1fpDelnvslt0 2xmio3nudllee iesl( aDrmu p;t4optnmociasfmDuanmp;(4 lenxf3oadfaDeanei t0trumxr iu4om n fcta(f Dtru  ou4oex io3iysla2uln p u)aleoio oatfatelnes;(0t2trio3iudllte nvta(farrmuro;t0aleomoctysfmDrl(vp (0texnxo3oydoat lu o;t)trtoimpoo4opeemfcs (faDraurpoo4tptnmoctys aDumuvpn(0 lxrxf iatoaDraneo;s) eur(mpny1apen fcsls  rrmurp;t1aetnio3tytfs umnvs (4tltriocia1fmDeanei;t0srxrir iu1amtelivs tfsrtrxront4aptn feiytfmDulu on()aexomrctodfmDrai olt teum(m3nudlptemivta(  ruax p;o4tpeo i3tad m ul(monu)trerxfcta1faDe neo s)teuoir io4apte icia(farurxrooo4aexniieiysla2rlu s;u0 reoxf3oytlp rlies;( t2xr(r3oy4aleelfesa(faDrrxrp;o4optn fciasfsDrl( pnt) rxnmf3io1fmDrau i (  etoio3oy1ll e nvtlt)srurumpou4tlenmocildlsDelnmp t)tlxoxocoo1lm eln o s0trumxopny4am  lnvilsf Drmu oot0tetoif3tysfs2eln snt0artnio3oydlaDrlivs s)t2ur(r iudlltelivtat) Dtmur nu1alt iietasfsDrl(vpnt0treomr tydlm elivs;( s2tmxrpiu1altelfeils srum( p;o1tpto o3iys m2el(monu0 eerio tadfmteaieol(  rtr(rpnudame  ietl()arua(  nu1optnio3tlsfm2rlnvs;t) lerif oy1omDr nvs;s) exoirpnu1ame  nctasfsruax p;t4tlx  o3ildfsDua( p;(4 ltnmfcto1fpt li ol()seum(o ou4lmeelfvtl()s2rr(r ou1tpx mi3iyd m2eln p;u0tlenir oo1lpDrln s ( setrimpoydameemietasfsrur(rono4aex iicils m eauvs;()tleoif oa1lateliesl(0seurxm iodop   nei tf ruru  ;o1oexo fciyd s2elnms t0 reomf3ia1omtraiesls0srurxr3nu1llenmncsls)aDtr(  no0olxoio3iydfa ra(vo t4tlenxo3tatlaDeln o;t  exmim nodam n ivta( a2tm(rono1olt  ieiysfa eaums u0 eermo totoptr uvo s0seum(m3oudomte fcsa()sDur(roou0aeeoiieiytlaDea( pn(4 etrir oatfp  auei t)setoxr3no4amen nvil()aDrmumpot4tlxo f3iatfs ua(mp (4 lerifctatop r nvolt0sexmxm3iy4lme mnvsat srtmxr ot1tpeomiciaslsDemu s;u4 exomr totopte nvsls0srxmxo nu1op   nesl(  Drru  ou0tpt  feilsfaDulums;(0 exomo io1omt auvi;(  rtm(m ny1op emnciat) Dta(mont4apenmi3iltla2umuvont4trenxo ty1lm rauvil()trumiopoy4opeelieiasfsrtaumpoo4apenif3ias s2rau o;t4trenio3todlm raneils) ruo(m iodolt lncsls srrau pnu4opt  octltla2eln p t4 rerif oo1lmteanei;(0 etoirpno4ol elnct t)arraxr ;t1oexn fetldfsDelums u0alenio3totopt  nes s tetrir iy4lmtemneias)a2tru  ot4aeeoio3iyslm ul(vpnt4aetrir3iytfpDe ieo ()sexo(r oo4alte ici sf 2rm(rpou4ole ifeilslmDeanvo (4tlxomo3oydlmtrai i () 2tmiopoudopen ictl()sDur(m nu0aleoifciad a emuvpn(0 leoir3io1optr nvo ( t2xoxrpou4opt lnet s)a2tru pnt4tlxn octldfm rlump u4tltrif3oadomDraueo (0s2tr(o no1apee fviat)a2tr( o;o1aeeomfciad a2ra( p;() etoxf3oadfmtelneil(0s2uoio iodol nlncil(farururpno4opt mo3iadla rm(msnt)alxrifcoatlpDelneol(  2xrim3iy4omtnlfcias)artm( p;t0optniieiad a2uan pn(4tetrmrciytop r i s t  2tmir ny1al  lncia(  2tm(r ;u4tlxoiieildlaDeau o;t4 renmo tadlpD au o;t0s2xmiopno4om nlicsat a2ua(rpnu4aexo fciyd s2elu p t4artomr ia1oat anei;s0t2xo(rpio1lpe lncsat) rtr(mooo1alt mfetlt s2raumonu4 rtrifciytlpD lies;t  exrxr3ou4altnlietasfsrra(  ou0aex io3tasfm2emumont0aetrmfciy1oatr uvs ()trxmir3io4am emfci ( a2rauro;t1aet  i3ilt m2umuvo;u0texnxr iadfa  livil(  2tm(rpnydalenlnvsas)aDra( p;t1apenmf3tysfa2ean onu0tltnxrctatlat an ols0teuoxmpoy1omenmicslt sDua(r ot0aexoifeiasls2emn s (0arxrif io1laDrli o;t)trtrio3iu1lm  lnctl(f Dur(mpnt0aexnmoeiysla2rln s u4trtnxo oatlpt an o;t) eto(opno1om e netl()a2taumpoo1alxniictysls rm( ont) ltoxf3iadfatrlivslt texo(m3iy1altnlivt t)arrmur ;o1tpt micild s2raums;u4artrmo to1fpDe uvo s trumirpnydap elict t arrmx  nt0apenmo3iadfa2ulnvont)aeenmf oo1oat auvs;s s2uoxo oy4ame lfvi ()s2rrxmp;t0alxn ieiyt mDuln pnt0 etrmociadfm eaueols0srtr(m ny1ale  nctltf Drm(ro;o1tle  i3tysfmDul(mp;()trerxr3todlpDrlies;t) exr(opio1apt  nct tf 2trxmo;o4tltnmietadfsDra(vs t0 rtomo oatoatrlieolt0s2xmim3oy4ap nlnvta()s2uau pno4olt mociltlm2rm(ms;t0trxrxo3todom r nvo t)tetm(m3nodomtelicil(  Drmu  ;o0oltniictldlsDrmump t0arxomocoodopDrln o;( srtoxopno4lm  lfvt ( artaxr nu1aeen octaslaDrl( o u4texrxfcoydop eaivols0teuoiopou4lm nmicil(f rururo;o1oltoioetls m2uan p u0arxomf iytoa e i s t)s2xmir3oydll elieilt) 2rax  ;t0aleniietysfaDrl(vs;u)arxoxf3oydomtrluvs (0 rxr(m3oo4lme  nvsa()artmurpot0oetoii3iltfaDelnms u)tlxoircootla rauvslt)texm(r3ou4ale mics t) rum(mo;u4tee ioeildlaDemnvsnu0trxomfctydoat  ueo s0 etoxr nudom elivi s  Dtaum ou0ale  ieiasfaDem( s;(4 reoio3oatfatr ies t0t2ur(rpiy1lme  ncsat  rta(m ;o1oexnifciat s2ea(vo (4aexnmocoodfatelu o t0setoxo3nu4om nmnctat)srrrum no1alt  o3iadfs emnmpnt)texnio3oo1fmDrli o;t)srtrim oy4aptelfes ()sDtru oot0oeen oeiytlaDuan p (4tlxnir3oydfmt ln olt s2urimpnudam  mnes ()srtm(  nt4olt mociytfm2ulumonu0arxrmo3oo1fpteluvo;t)srxo(m3iy4lp  mfvils  rtmumono0tex  i3tltfsDul(mo u0alenxr iodfpteli o;( s2xo(m3oodole  nvtl( s2rru poo1optoifctatfs em(vs;u4trtoir io1oa eanvi ()trxoirpiu1lme  nvi ()arumump;u0olenmf3iytfaDemumo (0 lerxf to1opDe nvilt0t2tmim nodam nmfcsat) rrrum ou1aetoiicilsfa2rm(vp;(0texoxrctodfptrlneols0trxr(r3oudole lfetls  Drru  ou1tlt mictls a2elu o (4aleoxrcoodlp  lnvolt)tetrio3iy1alenlneta( s2tmu o;u4tlx moctas mDeanmo t4 rerxrctodlat  ivi;t) 2umio iu1om  lnvs ( sDuaum nu0olt  oeiatfaDuauvp t)alxoif3io1lpt lnvo ( teuoxm oy1ll  lnvsl() Duaxrooo4opeoifetydfs2ean s (0treoir ty1om rlnvs;t)s2um(rpnydllt livi sf Drr(m ;u0tltomo3iltlaDrmuvs () rtnir3oydfmteai o ( t2xr(o3oydop   ncsls)arraxmoou0oee iieildlm2uanvp;t0tetrmf3iadfmDrln slt teumxm3ny4lpenmfetlsfaDta(  ;t0tetomo3tydla uauvp u)alxoxrciydfpD liei t)t2uo(rpny4am elncia()aDrmurpno4tltn iciat m rln o u4 eenmr3oo1lmDe ivo;t)trxmim nydaptemicil()sDtaxmpoo1altnifetlt a emnvo (4tltrif3ty1op e neil( teuoxrpny1ol  lnvsls  2ra(mpou0olt  o3iysls2uaumo () exoxo3oy1op  au ils)srtoxrpny1ap  mfcs sf 2tmxm no0oex  icildfa em( o ()arxrir iadoa ean ol() rtr(o3nu4lm n ivs t srrrumpno4openmfeiat a2rmnmsn(4tltrir3iatopDelnvils)t2xmir3no4al   icta(  2taxm ;t0apxn feiysfs emumo;u0 lerioctodfatelivi;(0setmxm3oudllenmnvtl()a2rrumonu0oex  iciyd a uaumo;(4 lxriocio1oatr nvi;s)teur(o io1lp emncs s)sDtau pou4aet ioctldfa2umnmo;u0 rxrmf3oadlpteaueo;(0srtrir oy4lp nliesltfs2uaxrpnt0tlenmiciad aDul(ms t4trtoxo iatlptelnvs;t  rumxmpoo1oltnlieil()s2tmx oou4tpxo ieiyt a2eanmpnt0aetomocio1fat an i s0 2tmxopiy4al n ictlt aDrau pno1tlt ioeilt aDrlu s;t0alxrxr3todfaDe u ol(0 2tmimpoudaptemfetatf rumu p;t0oleo o3iadfmDeanmp t0aexrxfciydfaDrluvs;( tetoxopio1am   ncs tfsrtax ont0ale mictldfs2rmn p;()teeoxr iydfpD an il( s2xoxo nu4apenlncslsf 2trx o;t4oltn fctat s2uan s;u) rxrxf3iy1lm eaieo s t2uoxrpoy4aptnmnetasf rraumpot4opeomf3iatfm ul( s;u)trxnir3oatla rlnei;t)teto(m nu1op emivtas a2uau o;o4aleomicilsls2emu o;u)aexnxf oydop  anvi;s)sruoxm iy4apt mnei s  2umu ono1oetoifctasla2eanvo t4trerxo iytlaDe n o;t)srtm(o3ou4ll elicsl( srua( o;o1tetomoeiysfaDelnvs t)tlxnmociodomtraivs s  eum(rpiydam emnesa(faDurxrono1oexnii3tldfmDean s t)tlenmrcty1oaDeanes;s0sexmim3iu4lpenmfvi s srtmxm ou0aexn ieiltfs uluvonu0 etomo oy1opD  neo ( setmimpoudolenlncils a2tr( pot1apt mf3iyslmDemn o t4tlenxrcootfpteln i s0t2xrxo3ny4ol nmneiat arrmxrp;t0tlt io3iytfa2umn pn(4altniociy1om  lu o ( srtrirpoodom   fesa() 2raxm ot0aee ifctlsfs2emnvs;t4trtrxr3oo1fm e ivi s trxm(m3ou4ll e nes t  rta( onu4tee  f3tydfaDranmp;u0treomr oodfp rai il( trumimpoodapt livi ()aDtruro;u0aeto o3ildfs uau o (0 lerxfciytoa rlieols)sexm(opnu4ol emncia( arra(m no1alt ioetadfm2eaumo ()tltomo3oa1oaDr n s;t trumiopou1op e ivil( sDtru pou0tetnif3tyslm2uan p;t4arxoio tadlpt aneo;(0s2xoxr3ny4omtnmnvtasfsrtru p;o1teto o3ildls ua( p;u) rxrif3tytlmDeln o;s)srxoim nu4om nmneia() rrrxmpnt0tltnmoeiyt aDrlumonu4 lxrxo iatlaDr n sls sexoxmpoo4ap elnetat)arur(r ;o0ape  feiadls2eanvsnt4 rxnxr3tatopDeln sl(0 2to(m oo1lltnmfet t s2rmx pno1open feiys s uln s (4 eenio3tydopDe u s;s)trur(mpnodom e ivt sf 2tmumooo4oeenmoeiaslm rmnvsn(0teeoxr tytfatraiei;()s2um(opnu1lltelnetl() Drm( pnt0alt ifciatla em( s u0 etnmrciytoa eluei ( texrio3nu1ame mfvils srtm(mpnt4olenmfciytfa2uanmo;t4aeenir3iy1lp  aivo t0 2tmimpio4ame  fesat  2tru pno1aeen octadls2ra( s (4artomrcoodoa  livilt s2xm(opiydlleelieslsfarur(mpnu4oex mfetltlm2eanvp ()trtnir tytomt  n o ( seurxo io4altnmfvilsfa2tr(mono0oeeo oeiadls2eaumo;u0 rxomfciydop e ieilt)t2uoxmpiu4al elnetlt)s2tm(ro;u0opx  f3iyslsDumn sn(4 ltoir tydfp   iei ()trtrxrpnudom e fctat) rumxro;u4olenifeiad m eau o (0 etrir3todfa  aneo;s s2umirpnu1altnlfci s)sDuau o;u4oleo oeiyslaDem( p (4 rtoxrcoydlmDe nes s0srxrxopiudlptn nvsls)s2rrumo;t1opxn i3tysfm2elu s;u4 rtrxf ia1laDeaivs;t  2ur(o3nodole lfcta(  rrrxm ou4alt  octytfs2uln p (4 rtrmo3tatlaD  nvs t0srtoxo3oodapee neiatfs2rr( p;o4oltoiocildla ea(msn()tetrxr oo1opteln s s0texr(o ny4lme lfvsltf rum(mp;o4tee ioeiytls eanmp;u4 eeoirctadom raneo t)teto(rpoo4al  mfet s srur(m ;u4alt ifctytfaDelnvp;u0aeenmr3oo1fa   i o ( srxmim io1lp nmnci s)sDtrxmono0tpt  fetad a2umums;t4 eermociytlm   i s;t) rtrxmpiu1omtemietlsfs2rmu o;o0ale mfcilsfa rl(mp (0altoio3oo1faDrlu o t0srtrxm3iu4apeelivsl(fa2ur( pot4tpt mieiatls elumpnu4texnxr3oadom eanvo;(0srurim3no1lp  mnetl()aDua(mpou0aex  f3tytfmDumnvp;()tetnif3oy1lpDrln i;s)teto(m oodlptnmfciat)srum( onu1apxniociydfs2umuvp;() rxoiocoatfpDrluvsl()t2triopiu4am nmfcs t) Dta(rooo4aexomf3tys m uau s t) eeoircty1fmD livs s) rtrxo3iy4alt  ivta(  2rruro;t0aexo ieiasfaDean s u4 exomr oytoaDelu o s0seumiopiydapt  ictas) Dtaxrp;t4aeen ieilsfs2ranmo t4texnxo3to1lm  li s;s0t2ur(m nodop  livtltf 2tmuro;u4tpx  octydfaDea(ms t) lxomrcio1lp  au s;t s2urxrpnu1ome livsl() Drrxm ;u4aex ifciatfa ulu o;t0texnxf todlpDe ivsl()t2xoir oudlpe lies (  Dtmxmo;o0tlxnifetltfm2ua(vsnu)areoio oatfp e ueo;(0 rumxr oy4amenlnctl() rraump;t4aleomoctydfmDran p;u)aetnmf tydfaDrlnvs t0teuoim oy1ll emfeil()s2uaumpoo1ole ioeilt sDumnvon(0altnmrctadfa ranvi s0seurxopoydap   ies ( arrrxmpnt0aexoifcias m elu p;(0tetnif3io1om e ues;t0trxrio3oudoleelfvi ()srur(mont1apenmi3iydlm elump;t0 leniocio1op  luvi;(0seumxm nu4omeelncias)srta( o;u4altn f3taslaDemu on(0aetrxr iotlmDraues;t s2toim iydomtnlfcsl()aDrau oou1tlxo f3ild a2el( sn(4arxrmo oatoateau i t0 eum(rpoo4lm elicslt) rtmx  oo4aexoif3tldfsDra(vp;t4 eerir3iytfpDr u i;t t2to(o oudopt  fcsls)srraxmp;t4tetomi3ias m ea(mo t4alxoxo io1fpDrliei (  rto(o iu1ll  lictls)srtmxr oo1alxn f3ias m elums ()trxnio3iytlaDraivolt  2tr(o io4ale lfvtlt)aDtax  nt1apt  i3ilsfs eluvs u4 etrmf3io1omDraues t0texmimpou1ol n ivtlt)sDurx oou4alen fetyd mDrl(mp (4alerir3ia1fmtrlu s t seurir iudapenlnei t)s2tmx  nu4alxo feiltfmDeln o;t) etnif3oodoa rau ilt) rxmxo3iu1opee icia(  Dur(rpnt4tet if3iydfm rlnvp;t0 lxrirciatla elues (  etm(r no4olt mfesltfa2raxmono1tleoioctlsfmDrl( p u)trxniocty1omDelnvs ()seto(mpio4lpt lfcsl()srta( p;o0alenmi3iasls2emnmsnu0 rerxfctytlatelu i;t)truo(opoo4amtn ivtlt s2rmu oot1optnmiciytlsDrl( p;(0 ltrif3totomtrlies (0tetmim3oy1om nlnvt t  rumur ou0tleo o3iasla uluvp u4 ltrif3totfp eluvslt) 2xo(r ou1amte ieslt artru o;u4aptniieiysfsDrl( o t4 leoxf iytop rauvo;s) 2xrxo3oydol nlncsasf rra(mp;u4oexomoctldls2ean onu4aeeomociodfpD lieo s0 rto(o3nu1apte nctl(f 2rru pnt0olt ifetls m uln on(0alxoxo3io1la e ivs;t0setrio3io4lmt  nciasf Duaxmpno0tetoiiciys mDrau onu4aetoxf3oatoa r iei t)trxmxm3ny4olen neias)sDur(rp;u4tltomieilt mDelnvpnt4aexnxf3oadoa   ues t trurirpnu4lltnlfeilsfsDua(mo;u1oet  f3iyslaDrau p u0 etrxrctydfmtean sl(0texoxrpoodop n nvtasfs2rax  oo1alxomieiad s umums;(0trtoif oo1la ran o ()texm(m3oudll emfvi () rurxr nt4apt mi3tyd sDel(mo t)alerxr oo1lmD  ues (0srxrim3iy1lltemnctltf rrr( pnt1opt  octldfs ra(vs;t4tlxnmr iy1lpD  u i t seum(o3ou4omenlicil(f 2ur(ronu0tpt  o3tldfs um(vo u0tetrmo3iodlaD anvslt) rurio iy4lm  lnct sf rrmuront0olt mi3tyd s2elnmo (0 rtomfciy1latrai ol(0t2um(opoudopte ictas)aDrrur no0tpxn i3tadfm2rm( pnu0texomo3ta1om elivi t0s2toxo3io1al   net sfs2ur(root0tlenifeiydlmDea(ms ()arerir iydfp eanvi t setoirpny1omenmivs t sDrmxrpnt4opxnmoctadfa rlnvp;t)trxoircootlaDeluvs s0 rum(opnu4lptelnctl( s2tau  ;u1tlto fctadfmDeluvs;t)altoxociytfatelivo;(0 etr(mpiudlpeemncs s) rtr(ronu0oex  ieiatfm2uluvpn() exomfcty1omDelnvi;t)sruoxopio1aptnliciasf rtrumooo0tleo ictatls2uaums;u) lxnxociadlatr uvils t2xo(m oo1ll emfviasfsrumu oou4aptoifctadfaDrlu snt4 lxoif oadfm raies;s0trtrxr3no4amenmneiltfa2rrxr ;t4tpe mociytlaDelu p (0 rxoxoctadoaD lnesl( srurxm3oy1al   feil(f 2ur(m oo1opxoiieildls rauvs;u)trxoxrcty1fa elu ols0 rumxr3oo4openmncta(  rtm(r oo1opxnmoeildfsDea(msnt)trtnxfcto1omDrlies t0 eumxmpou4optn icia()sDua(mpnu4tex iictadlmDuluvp;u)artoif oo1oa e ues;s srtr(m3no4apenmiei sfsDrmu  ;t0opt mi3ild s uanmp u4tlxomr3iy1lmtrau o;t0t2urir3oy1optem
\ No newline at end of file
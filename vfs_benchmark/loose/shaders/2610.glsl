@@ -0,0 +1 @@
+ivols0t2to(m3oodape lfcias a2tr(mp;t0aee  i3iyt a rm( p;t) ltrir oa1omtran o;()srur(r3io4aptn fvsat) rrr(mpnu0tlenif3iltls2umnmsnu4 exrmo tadoptr ieo;s0 2xoir no1altemiesat) 2rm(r no4tlenmfeiltfs2um(vsn(0tleoxr tytlaDranes t0t2uoxmpiy1op emfvtat)arta(  ;u0olx mo3iatlm rm(ms;(4aetrxf tadfa r u s t)texo(opio1am eliet s)aDum(r ou1olen fctad aDuan s () rxoiocoo1fpD  uei ()seumirpiy4lmtnlnesas) rua(  ;t0aptnmoeiat mDrlnvs t4arxrir3oytlpDr ivs;s0 2uo(mpio4olte nvtat)aDtau ont0tlto iciytfmDulnms u)artrxo tydoptr u ils  rxm(m ou4lltnmfvt ( s2umxm ou4aetn o3tasfm2umuvpn()tltrmo ta1oaD aivo;s)seumio3oy4lmt lnet (fa2rmur nt1oeeo f3ild m uaumpnt0arxnxocoa1fa eli olt0s2toir ou4alee ivil(f Dra( o;o1aptoifciadlm2emnmpn()trtrxocto1lp rlneols)truoxr3iu4omtn nci tfsrra(rono4apt if3ilt aDemu p;u4 rxoioctadomteluvo (0 eumxm nudll elivsl(farra(rp;o0oeto octas sDumnvon(0tlxnio ty1optraueslt srumxr oudlmtn icils  2rr( p;t1olt  o3iysfm2el( p;(0aexoxrctydlpDelieslt0srumxr3ny4ol   ieia( s2rr(m oo0tetn octltls elu s;u) leomo iy1op  auvs;t s2tr(rpoudap e ict ()sDrr(mpnu4aexo oeiasfs2uau s t)tlxoxfcto1fmDraivs (0trurimpiodaltelicslt)s2ta(mp;t4tlxnifciasfm2ranvo;t4 rxrxr iytfp ranes t0 rtmxm nudllte fes (f Dtr(ro;u1oex moetls aDrlnvs;t4 lxrmociy1omDr u il( seuoirpoudlptelivtat) rum(r ;o4apx mictydfs rlnvs;t) etnxfcoodfmtran i;t)srxoir3ou4al elieiltf 2raxm nt4aetnmociad s2umnmp (0aeerxr tytfpteli o s setoxm no1lp   ici s)sDraurpnt0oeeo feiysfm2ea( p (0 etoxfciadop  luvi;s)srxo(o3oydomtelfet s) 2rm(rpou4apx mo3iltfa2elnmo;(4aetomr ta1laDrln sl(  rum(mpou1ole  fvs s)s2uru ono4aee ioctyd s2umn s t4 rerxfciydlmteaivo;s0srtmxo iudale  ictlt) rtrxront1tlt ifetltfaDuluvs t4 lxnifcio1latelieilt) 2um(mpnu4ole  fvs sf 2um(mp;t4oltoiieiydfmDum( o;u0arenir3io1la r ivols)t2xmxm3nu4ame mnesasfa2urxr no4aexo ieiasla umnvp;u4 eenir3iotoa  livs;s)t2to(o iydal e ivsas  2uaurp;u1tpto feiysfs2rm(ms t0aexrxocootfp e neo t) eurio3iu1ll nmncil(f rtaumpou1tet miciltfs2ranmp t)alermr3oo1fpD  uvi;s trumir3nu4omtnlieil(f 2urxmont0tltomoeias a2emn pnu4aexnmo3oytfpDrlu s;(0trxoxm3iodopee feil()aDuaurpot4tpeomieiadfsDemnmo u4tltrif3ootlptrlnvo (0 exmim oudol  mnvil( aDua(mpnt0oex  f3iad m2rau ont4 rerif tatfpDeluvi s) eumir3io1lpe  ncsas) rtm( p;o4texnifeiyslm uluvp (4trxniocoatfptrlneil() eur(o3oy4lptn fet ()s2um(roou1tee mieilsfaDrau p t4 lxoxfciytfpDrauvs t) euoiopny1ol n ivslt s2rru ono0texoif3ilt s2umuvpnt) rerifcoy1opDe ueolt srum(opny1lm e fctls)a2urxro;t1open feiad a2eauvp;() etnmf3oytlatraivs ()srtmxr iydlpeemivtls s2urur ;t1aetomf3iys mDemump ()aeenir oadoaD livi;t)setoio io1lltnlieia(fa2rr( onu0tex iieiltlm emums;u)trxrif3oa1oaD  u o t  exoiopiy4ale mici (  Drr(  ot4tpx mf3tatlaDrl(vp (0 leoif iadla   n il()sexm(rpny4apenmfcil(  rrm( poo1oex ifctltfmDumuvp;(0 rtoxfciy1laD  n s t) etrirpnu4ol e iet t) Drm( ono4oetnmo3tldfs2um(mp;() exrmrcoo1fateli o t0srtmxo iu4op nmnvias)srtm( onu1aee iiciltla2emuvonu0aexomo3ty1fm  lu olt  2tr(o3ou1lpee ivsa()a2ua( pou0olenioeiadlsDrmnvo (4alenmr3tydoaDrln s;t)texr(o oo4am  lfvta(farrr(m ;u4oltoiictydfs eanvo ()trenmo3iydop r i sl(0srtrim io1lme mneils) Drmuroou1texnmi3iys a2rmnmo;t0 rxrir3oytlpDeanes s truo(m oy4al  lnvi t aDrm( ooo0opx mociys m2emnmon(4alxnmocoadlatrli i;t  2toxmpio4lmtnmnvsltfaDtaxmpnt0apxomociys sDrl(mp;(0texrxr ta1lmD aivo;t sexmio3ou4lmen fvslt aDtax o;o1oex ioctysfmDuan s;(4 exoxociydfpDelivo;s0sruoxm oy1lm nmfcil()sDrmxrpnt0tptn fciyd sDea(vs t4altoif tydfaDrau ils) rto(rpno1aleemnci ()arta( oou0tpxo iciltfa emu p;(0aetrmf iadlmteai s s)tetmxm iy1lltemfes sf Dra(r ;t4aet moetyd mDraumsnt4trtnmr3iydopteaues;s trtr(opiu4ape mnct t) rraxrp;o1tpe if3iat m ulumo t0 ltriocoodlpt anes;s) 2xm(mpno1opeeliet s) Drr(mp;o4tle moeiydls2el(von(0artoif3ia1oat lneslt trum(o oy1ome mfei tf Drrxr oo0tlx ioctyd m ulnmpnt)tltomo io1opt lu o s  euoir3nu1llt lfcsl() ruru o;o4apxn fciasfsDrmn s u) etrir3totlptrauvi;(0trxmio io1ol elfcs t)a2ra( p;u4aee  ociltla rauvo t0tetnmrciotlpD aueo s setrxm ou1ape livsas)s2taurpnt4tptoiietysfa2umuvo;()arenifcia1omtr nes s0 rumxmpiy1omtnmici t)s2rmx p;u1tlxnmi3ildla uauvp;u0 rxrmo3oatlmtrlivsl( s2xr(o nydlm n ivils)arrrxr no4optoioeiaslm2emnvpn() ltrir ta1fm elnes s)srxmxr iu1lltnmfctatfa2urxront0aleniietys m eanmo u4trtoifcto1lpDr u i;s)s2tmimpoy1ale lnesas  rrrxmo;o4opeoiieild mDuau ont0arxomf tatlateai s;(0trxm(m no4lmtemicsls sDta(m ou0altn fetyd aDrl(vs (4aeermr oo1lm rluesl(0srumxrpiu1ol   nct s a2trx o;u1tleoiictydfaDran s;() eeoir3ia1lp   uvils)setr(rpiy4lle lnvil(fs2ururp;o0tet  fetytlmDul(mo t)aeeomfcta1lmt livs;t  2toir3oy4lmtnlieilt s2rmumpnu4alx ii3iaslmDeluvs (4alxomo3iadla  auvi s0 rxm(m iu1op elict ()s2uaxmono0tet ioeiys aDelu s t0aexoxoctodfpt  u o t  rtr(mpoy4aleelivs ()sDtrxm ;o4oeenif3iasfmDuan pnt)aleoir iodfat  u i s0 eto(m3iu4lp elfct t)sDrmx p;t4altnioeilsls ea(mo;t) rerio iodop eanvi;( texmirpnudolt  nvtlsfsDrmumo;o1tex if3iasla ulnvp;u4texrxf3oa1lp ean i;t teum(o3nudlpe lnvta( a2tm( pnt4olx micilt mDeln p u4tltnxo3tadlp  an o (  2tm(opou4ale lfcsls artmump;o1alto fciatlsDelnvp;t)aexrmfcta1fmteaneol(0srtmxopnydopen nvi t)arrrurp;t1apx iietad s emumo u0aetrmf oa1lmtelivils0teurxo nydlp   iei tf rum(mpou0tltnmfciytlm2rlumo;t4aeenxr3totfa rlies (  2xoxr3no1apt lfesl()arrmum ;t1opxn ociltlmDemu p (4alxrir oatom  aues (0s2tr(o3ou4aptelnvs s)s2rm(rpnt1tlxnmo3iysfm2rl( pn(4teerif iytfmDranei (0sruoxmpiu1ale mivs ()a2ra(monu0oetn o3iytlsDel(msnt4aeermrctytla e neslt)srxoxo3nydllte nciltfsDuau o;o1oeeoifciadlmDra( pn() rtnxr3oydfmt  uvslt truoirpiu1omenlncils  Durxr ou1oetomicilsls2rlnvp;u) rxnxo3iydomtrlues s0seto(rpnydom emnet t)sDtax ono4opto oeiatls ranvp;u0trtnxfciadoptrlueslt) 2xm(mpoo4ole mnes ( arrr(rpno0oex  fcildfm rmnvs u) lerir tydfmDrlivol( srum(o no1ame  fcta(  2tau ono0oet moeilslm2emumo;t0trxnxrciy1fateaies;(0 rtmxo oodlltnmfcs () Dumx ont0tpeomociad aDra( o;u0 rxrmr3oydfp  au ils  exmiopnu4lp e ies s) 2urumpot1tltomo3iadlaDrluvo;t)texrirctadlpDr ivs t0 exmxmpoudoltnlfvslt a2umxrpnu4tlenmi3iadlmDemn onu4trerxo oydlpteai o s0s2toir3oodamt mictltf 2umx p;u1aee moctyslmDulump ()alenio iydfpt lnvs;( s2tmxopnu1al nliet sfarta(m nu1altomi3tyd s rln ont) ltrmocta1la elnvils0s2toxr ny1apen nei (  2urxmoou0aeeomi3tyslm2ulnms t4 lxoifciytoatrli s s trxoxrpno4am   icilt srrr(r ;u0aeenif3iyt m2um(vs;t0trenmfcoodlp e nei;t)srtmxm ny4ameemncia(  2rm(mono0tex ifeildfmDeauvonu) etnxo3iodlmD aivols)sruo(o iodomtnlfvsl()sDurur no0aptn feiysfa2ran s t0tetrmfciytlpDeaivo t)srtrxm iudomt  ietl( aDumxm ou1apeo oetadls umump;u4tlxoxf ootomtr ivsls0trumxo iu1openlnciatf Drmx  nt1aetniieiys aDua( pn(0arxrircta1lmDr nvi;s srxrim nodlmeelncta() Dua(mpnt0olto i3tadfs ulnvs;(4tetnmr3oatfp   nvslt sexrir3iy4al e ivtas)a2umumpot4oee  f3iytfm emn sn(0artnircoadfa raneol(  eurxr oy1lpeelnesat arrr(rpot0aexomfctat s uaumpn(0arxrif iatlp eaueolt)s2xrir nu4aptnlneil(fs2tmxrp;t0teen ocilt a2um( on(0trerxocto1oaD  i ilt) exmimpiu4al n neias)s2rm(r ;t1tlxoifetlt m2rl(mo u) reoxo3iy1laD  uvi;s)t2xm(m3oodlp n nvtas sDtrxm ou4tltomoetadfs2em( onu4aeenxrcootfmDran s;s teum(opoydlp nlnvtatfsrtmx p;u1tpe ioetldlaDrm(mpnt) rxoio3ia1lp ean sls0truo(r oy4lltn fci s) 2rm(mpoo4olxoioetatlsDulnms;t4 reoxo3ta1fp r ieils0srumxo3oo1lptn fcs tfarraxro;u1aleoifetlsfmDrluvpn()tltnxo3iatfptrli olt0sexm(m3ou4lpt lfet sf 2ua(  nu4tlt mfeiasfmDrmu s;u0teermr3iy1omDrai s;()setmxr3no4lmtn fes t sDurxrpno4oexnii3ilt s ra( o;(4 exnxf oatoatranesl()s2xrirpoudllt  nct ( aDrrxmpno0aexo i3tydlsDuluvs u4 rxoir3oydfat  u s (  rum(rpoo4lm   feslt)a2tax  ;u0tltniociysls2uan s u) lxomr iadla e i sls)tetmio iydomeelfvil(  Dtm( p;t4optn ieiydfa em(mon(0 renmoctadlaD lueo;( srxrimpoo1ll emnvtlt  2um( poo0alt  oeiysfmDuauvo t4aeeomo ootlatr ueslt0 2xrio nu1lmtelnvtl()aDrm(  no0tptn i3iatfa emnms t0aetoxf3ta1opD  uvo;t texrir no1lmtelnesa(  rrmumonu4tpeoio3iytfm uauvs (0aleomoctotoptean i s) rtoxr3io4ll nlnvsl() 2uaxr nt1aetnif3tyd a rmuvpnu4 rtoxr3ia1fpDrauvo (0 rur(m oudllenmfvia()aDtmumpnu1tet  oetytfs2emnmont0 rtrxr iodlaDrlnvi;(0sexm(r3no4apen fes t aruax pot1apxn iciyd s em( snt4artoiocoodomt  n i s0 rurxmpny1ale mivsltf 2umumono0aex  fcilslaDuanvpnu) rermo oytfmD an ilt0srxoir3oudoptemicsl( s2rr( o;o4aexnifeiat sDra(vp t0artoxo3ty1omDr ues;t)trxrxr3oydllenmieta(  2tm(mont1tpxomi3tldfa rmums;u0aeenxf totfp  aivilt) etm(m iudam nmneiltfarua(m no4oee iieiat a ea( o ()arermrciadlptran o;s t2xrio iodlleemneiatfa2urx  no4texn ociydlmDrlump;u0aexnmr ty1oa rluvo t0srum(r3oodome lfcslt sDtrxrpnu1tpen oeiatla emnmp (4treomf3iotopDrli sl( tetrio iu4ape  fcil(faDtmurp;u4altnmo3ilsls elumpnu) ltnxr3oatom eai o s  2uoio iydaptemfcsl()a2rmxrp;o1opeoiieiltls2ra(vp;t)arxoxf3tydfp rluvs;()s2trxm ny4ll n icsatfsDta(mpnt1teenifcils s rmump t4teeoifcoy1oaDr nei t0 eto(m oudapen nvsl(f 2rrum ;u4apx  feiltfa uaums t4 ltriociydfa   uvi;s) 2toio3no4omen fcias)s2rm(ro;o0tlenmfciad s2el( p;t0texoif3oatfat lies;s0texrxrpnudomtelneta() ruau  ;t1tet if3tatlmDelumsn()arerxocio1oaDr nvi;s)texr(rpiu4openmnvtas  Drr(mpno4oexo octlt sDrl( p u4aeerxf totoa raues;t0tetrxm3iu1am elfctls) Dra(  ;o4olen ieild s uau o;t0aleoirctatoaD aueslt)srxo(rpoy4altnlfei t) Drm( o;t4teto i3ils s ra(vpnt)trxoxo tadfa eai o () euoiopno1aptelfesa() rtmx oot0ole ifctyd a ea(von(4 eeoio ootfm ranes;t)tetr(opoudlmtn ivias sDtm( p;t0olx  fciatfs2rlnvp;(0 eeomo io1om r i o (0trxm(o3nudlle  ivia()aDtrurpno0apt ioetasfs raumpn(4 etnir io1lpDe i s t0setmir iu4lpe  ivt s s2tr(r ;u0tpenio3iadfm ul(ms u) rtnmociodlm eaneolt0 exr(opny1lpe lfvta(faDra( p;t0oltnmociatfmDua(ms ()treomf iy1om eanesls)seuo(mpny4apeemnvil(  2tm(moou0aee ii3iydfs ul(msnu0 exomr3ia1fm r i o;s)setmir oo4omtnmivsltf Dururont1aptnifeiyslmDelnvo;u0treomocoytlp  luvs s texoimpiydlp eliviat aDtr(ro;o1aleniociltls2umums ()tltrxr oa1lmD aneilt) 2um(rpiu1apen nvil(fsruaur ;u0olt mo3iytlsDrmuvs t4 rxnio3ta1op r nvs s  rto(opoo4ame mfesatfaDurx pnt0texn ocils mDrln p () lerxrcio1faDelueilt0s2xo(o oy1apenlnvias s2umumo;u1aexnmoctltlmDeluvon(4texrio io1lmDrlieo;t0trumim3no4opt mnvsa() rraxm ;o4apxnmfetltfs2elnmsnu4 rermr iy1optelu ils0trumir3oo1op emfet (fsrrrxro;u0oltnmf3iltfa2uau sn(4 rermr3iotoaDeaueo;s t2to(r oodapt  nei t)aDrrxr ;u4openio3taslm2uanms;()aetrxr3oa1fp r uvi (  2tmiopny4am emfcslsf 2rr(  ou0tltnmieiasfm rmnms u4 exrxf tytfm  luvslt0 rxmiopoudlp emivs ()a2truront1tpxn fciasfm eauvsn()tleomrcia1fmD lnesl( trtm(o3no1alen nesls)aDuaur ot0aeen o3iatfmDel(mo;t4 exoircoytlatranvs;s s2uoio3iodlpeemicil( a2urxrono4alx  i3tldfmDra( pn(0tetrxrctytoa ean sl(0 2um(rpio4alenmietas) rumxm ot4tlxomociyt m2uluvp (0 etoxr ta1lp  lu i t)setmiopno4opeemivtlsf rumur ;o1aet mfctaslmDemumonu0alxrif3to1la rlnvsl() rxrim iy1ope  fcilt  rrax p;t0ale mi3tydlm2em(vp;u)tltrxo3oydfpD auesls t2trxopiu1ol  mfetl(fsDta(r ;o4tlxo ieiytfmDuanmpnt)trxrio tadfa   i s;( teto(opoo4llenlncs sfarrr(r ;t4aetoio3tldfmDum(vp (0areoio totom rluvils)s2xo(o3io4ome mfes tf 2rmxr nu0apxnii3iysfs rmu p;u4teenmf iy1fa  anes (  euoiopny4lpe mfvs () Draxronu1tlxniocils m2rm( pnu)aetnircto1fpD lnvs;s) ruoirpoy1op n fei s) 2rr(r ;u1opxoioetys s2ua(von()tetnxr oa1fmDrlu s;t  exrim nu1am  licsasf Dum( ont0aexn fetad a emnvp;u4aeenir iydlatr ivolt)trxrxopoy4lpe mnvtat)srtr(m nu0altn i3iadfa emu snt4 exomfcoa1la rlu o;s)trtmxm3oo4lp nmivsltf rtmurpnt4tlxomo3tldla ea( pnu) eermr3todla elnesls texo(o iodap nlnvia() 2rruront1ape if3iysfa2eaums u0 rxoxr oo1fmDeau s;t)teur(rpiydomte nvt (fs2tr(  ou1oeeomo3iys a2uauvsnt0teeomo3iadlat auvi;t)seuoimpoo4omenmieia(farrru pnt1olxn o3tydlaDumuvp;u0trtomocoodlpt aieo t  2xr(o oydlme  nvtltf 2rm(mo;u1tpe mietatlmDrl(vpnu0teeomf3iotlpt aivi s0tetmxopnu4amtelneta( aDuaxronu4ape iiciatfm2rl(vp;u4 ltoiociatlatelivo;t)t2uoxr nodol e fvtas arumurpot0tpx mi3ild m um(von(0aetnmf tytlp e uvo s s2um(mpiudom nlneil( s2raurpou4optoio3tat m em(vpn(0texoxrciytom rlu s;()trumimpiy4olt  nvil(  Drr(ro;u0olxo ieiyslmDumumpnu4 ltrxo3tydfm e ueil(0tetmir3nydlmtn ivt t s2tau  ou0oetomo3tasla elums;t0aexoifcoydlptrlivo ( t2um(rpou4altemfcias aruru  ;o4alxoii3tyt m2rlnmp (4 rtrirctotoa e ieol()s2xoxr3iy4lm nlnei ()s2rm( p;o0opto ociytfs uanmpnu) ltoir oytlaDraivi s  exriopiu1llee nvs s  2taurono1alxn o3ilsfm em(ms;u0altrmf3todfatraivs t)seuoxm3ny4amtnlfesl()srumx p;o4teeomfctldfaDra(vo;(0 rerio tytfatr u i;s0sruo(m ny4lmen icilt)a2rm(mpnu1teenifciysfa2emnvon(0texnir ootomtrau o s trum(r ny1llee fviasf Duaum ou0tptnmoetyd mDra( pn(4 rxoxfctodlat an sl()teuo(o3iu4lpe mncils s2uau pou0apenio3iyd s uanvo t0trtrif3iytfa   i i;s) rtrir oudopee nvilt)sDurum ;u0tlt io3iysfs2rmnms ()trenmf oatomDe n i (  2uoxm3ny1lpe lncta() Dtmxr ;u4tle iocildfs ulums t)tetrirctydomtr uvsl(0srur(o iu4ll  livs s)a2rauronu1aetomo3iyslsDumu s;(0trtomf ty1faDrlu o t)t2xoir3ny4apeemivsl( s2uaxm ;t0olxnmi3tasfa ul(ms;(4trenmr3tydopDelueo (0 2tmxmpoo4lptemfviat) rtmxmo;u4oetoif3tltla ran p (4aetomf3iatfaD aneolt0 2ur(rpou4lltelfes (fs2rr(mooo4ope moeiysfm em(ms u0treomr3iotoa  ln o s  euriopou4lpt mivia() Dtrx pnt4tpt  oetls a2emums;t)trermf iotom rlnvils0srxo(m iodopeelivtlt)aDrru o;u0tlen fcils s2elump u0 renxf3iatomtelnvo;s s2xrxrpiy4lpeelnci sfaDrmx  no1oet mo3tat a elu o;t4 rxomrcoytlmtrluvi;t0setrxm3ou1ale  ncils) Drmx onu4optoii3tlsfa rluvs (0arxnxo to1op r neil()t2tmimpoo4lmeemncsl(faDrm(r ;u4tex mfetasfaDelnmo;(0texoxr oo1omD  nvo t0trxmxopiudamenmnvt (f rua(  ;o1opt iictat m ea(vsn(4artnif tytfmt li o;s0 2xoiopio4am emfcils)s2trx o;o1olxoii3ildla2rmnvo;() rxrir3oodlmDelivil(0 2um(r3iydomt mies s  Dtmump;u0tlenmietlslsDea( p u4 lxoioctotom   neo;t0texmir3nu4ole  nesas) rrr(r ;u1apt  o3tyt s2ea( p () rtrmf3oo1lm  lnvo;s)texoimpou1om n nci (fs2tmur ;t1apx ioetaslm umn p () rtomrciytlpD aieo s0 exoiopiy1llee fvt s a2tmxro;o1optnmoeias m2umuvs;t0artomfciatfp  lu o;(0tetoxm3oy4al  mfvtls) rtr(m ;o1apt  o3iltfa2ulnmpn(4tlxrmocoatfp  anei;s)t2to(m3nudal  lfei s  2tmx ont1aptoiieiydls ulnvon(0artoxfcia1laDraueo ( truoxr no4amt livsa()sDrmx  nt1apto oetas aDulnmp;u4altrmf3todoaDelu ilt)t2trio oo1amtn ictltfsrta(m ;t1altoiietld mDum( o;u)alermrcoa1fat  n s;(0teuoxm nu4ape mieiasf 2rmx  oo4teeo f3iltlmDrau pnt0tetniociadla ran o ()trumxr iodlle  ivsltf 2rr(r ot0texo oeiasfm2ea(ms u0trxrif3tytlaDrli s;()s2tmxm3no4ap elicsa(fsDrrum ot0tex  f3ilsfs2umu ont) exoxoctydomD  ieolt  2xo(rpio1optelfei s)srtrum ;o1olt moetlt a elnvs;t4aexnif iadfmDr n s s)t2xrxr3nodap elicsltf rtrxmont0aeen icilt aDuanvp;t)aetoxrctadfa r uvo;t) rum(mpnu1lltnmfvt ()sDtrump;t0aex  octydfaDem(mo (4 etnioctotlpt lu s;()t2xr(o iu4lpt liesat) 2trxrp;t4tex miciys mDrl(ms;u4tetoif todopD aieo;t0 2xm(r3io1opte fetls)arur(rp;o1openiictysla2ulu p u4trxrmf todom  au s;s seumxr3iy1optemncslsf rrr(m nu0oleo ociydfa2rln o t0arerioctotlaDelneo (0 rtmxr ny4amtnmicslsfsrrmx oot0opt iiciat m ulumo t4aeenmfciy1faDe i s (0srxrimpoydomtnmneilsf Duaurpot1opt  iciys s umuvp;t4 exoxrciadoptrlu slt0s2uoir iy1ll e nci tfsrrm(r ot0tet  fciasfsDelnmsn(0alxrxo oytlm raneilt0 2xrir3iu1lleelnviatfa2raurpou1opx mieiysls2rauvp;()aetomrciodlm  lnesls)s2xrxrpoudoltnmneilt)sDraum ot1aetnioetad a2ea(ms;t4alxrioctatomDe nvs;(0s2urio io4omtn icsas s2rr( pou0tptoiietatfm2rmu pnt)trxoio3ia1om e u slt)s2ur(m3no4apt  iet sfaDra(  ;t0teeomf3iysfsDeluvp (4treoir3io1fa e n s;s  eum(r ou1lltnmnvil(f rtrxmpnt4aee ioeilt a2ulnmo u0 ltomo3oodfaD  i ils trtr(opnu4lp elictas)sDtr( onu4apx if3iatfa rmnvp t)aetrmfciydomDe uvs;(  exrxr3ny1ll  mfesls) 2trur nt1oexniieiys aDemu p ()trermfcty1om eanei s0 exoio3nudlmeemfcia( s2uaurp;o4aeeo i3iydla2ul( pn(0arenir oo1lp  aies;t  etr(m oudlleelfct sf 2urum oo0oetn octydfs uauvs (4aeerxr3iy1fmDrln o;(0s2xrxm iudlpee ici (fa2umum ot4apeoif3tadfaDeluvo;u0 exnmf3iydfp raueolt  exoir3oy1aptelfcils)aDtax p;o1tpxomoctasfm2eluvo;u)trenxo iy1la  livo t)seuoirpio4ol   ivi s  Dum(mono4apxoio3tydfs2rl( onu)alxnifciytom rluvolt0s2ur(rpoydol n fesltfsDtru pnu4oeen o3iadfa uau on() ltrio iodoaD  n i s s2xmimpio1apt  icils s2rmum nt1oleo fetldlm2eau s u0tetrxo3tadfp eluvo t)seur(rpiodapt mfeslt  2tax p;t0open o3iyt m ua(vs;()tleomrciytfpteau slt  eto(r nu1lleemfctl( s2rmur oo0apenmi3iyt aDeaump u0tleomfciydfm  lnvo t srtoir nydap   ici (fs2uaxmp;u1aetnmiciyt sDelumpnt) exnxr oatla eli i (0 exoxr iodaleemfvil(fsrtrumoou1oleo fctyslmDum( o;t0aetoxf to1lp rlieo ( trxm(o nu4lle  icsat)aDrax ono0alx  ociaslaDem(ms u) ltrmf oydlat  uvs s)s2tmirpiydomtn nesat)sDuaxr no1oex  ietltfs ea( s ()trtnxrcoo1oa rauvs;s) 2xoimpio1olt lfet (fs2raum oo1tpxn o3iat a ra( p;t4 rtrxr3oy1fmDeli s;(0sruo(rpny1lm emnvtl(  rurxro;u1teto fcias mDemu onu0artnirctodlateau s;(0 2uoiopoy1ape livi (  rtm(  no0oetomictltfaDemu p (4alxoircia1fmD  neils0s2xmiopnudllt  neil( srtmxr ot1tpx mf3iasfmDeaump u0alenxf3totla r ivo t)trum(r ou4ame mict () 2ra(rpot4tltn o3ild mDrmu ont)aleoir3ootfpD aivs;s0sexrir3iu4optelfesltf Dtaxm oo0altnifctld mDua( o () rxoircoatlmDraueils trxo(o nydom nlivsasf 2rm(moou0opx  f3tydlmDran s;u0 rtomo3tatom ranvols)s2xm(opnu4llte fvil() 2tau oou4apx iictaslmDrauvo;u0 ltomo3ty1oa   i i s sexoxr3nydomtn ivsat s2ururont4tpx mfeilt m2emuvpnu0 lxnif iadfat  ivols0t2urxm iodop   netlt)aDur(mpou1opx mfciadlsDul(vo;t4tlxnifcoydom r uvo;t) 2um(o3nudap nmicta()a2uaum ;o0alxnmociasfmDelnmp t)trxrxr ia1lp elues;s)setm(opiu4altnlicsas aDtaxmpou0aee moctldlm2rmu on(4 rtrmrctadfp eauei ( t2xmxr3nodale mnvtasfaDuau p;t0aet io3tadlaDrlnvp u)tltoxf3oadfpD  iei;t)teurxr io4amenlfvil()a2rmxmo;u0oetnifetltlm emn on(0 reniociadoa elu s;t)trxoxr oodlme  feia(farurx o;o1alxnioctld a rmu on(0aetnxo3iytlptrlnvi t0sexoxrpiydlmtelnvi tf Dur(r ou1aexoio3iyslaDranmonu) lxrmf3oodfat lnvsls) exmxr nu1am e fcs t aDrr(rono1apx ifciydfmDumnmo;()tlenir ootom rlnvo (  rtmxm3oy1altn nesas)aDtaumpno1oeenmfcilsfm2rmuvpnt)aeermrcoodlptrai o;t  2tr(mpoo1lpen ietltfaDtmxront0oexomoctytlm eln o;u4alxnmf totlaDr n o (0 rtoxr ou1opee ivil()a2ur(  ;t0opxomoeiad m rlumpn(0 leomr3iodoaD lu o;(0 2xoimpiodam e fvils) Dta(  ot0alx  oet
\ No newline at end of file
@@ -0,0 +1 @@
+ieils0tetmir ou1altn nvsasfa2rmxmpou1aptoioeildfaDemn o (0alermo3iytlaDranvi s setmxmpio4lmeelncsl( sDrmx pnt1oexoio3ild sDra(vpnt)arxnxo3tydfmD liei ( srtmxr3oy1aptnlics sfarur( o;o4texoif3iytfs uau o;(0 rtnxf oy1faD aivi s sexo(r no1ap nlivils  Drmxmpoo4tlxoifeiysfaDel( onu0trtnmf oodlmDraieo;t0s2xmim io4op   feiasfsrurxrpot1aee mfctldfm2rl(msn()tlxoifciydop e ieo s0s2tm(m iodlmee fcias) Drax onu1apeoioctat m2elums t4altnmr tadfmteluei;s s2toir oy1lleelncsat)a2tauro;t0opeomfetasfm rl(monu4texoir io1faDeluei ( sexmiopnu1ame livs s sDtrum ;o0teenifeildfa emums t0aleriocoatlp  anvo (0 2uoim oy1lpt mncias)sDraxrpou0aexoioctyt s rl(mo u4artrxo3iodoa rlueo ()srto(r3ou1apt livil(  rra(rpoo1aet iocildfmDum(vo t4 rtoir iatlaDeln o;t  2xoir iudaptnmfvtlsfsrtmx  no0tptomo3iat s2emn o ()aleoxr3oa1oa r n ils0srumxr3ou4ll n iesltf rumxmo;o0apxn f3tydls2ulnvo (4treoxo oy1fatelivi t  rxo(m io1lpt mnviltfa2tax pnu1olenifetatlm ranvs (0aeeoirciy1lmDran s;(0 rxmxm iy4lpenmnvt t)arrr(mono0tpto i3tytls em( s (4aeermfcio1oaDr nvils)texoxrpio1ale mietlt) Drrumpno4tlt  ieiatls ua(vp (0aexoxr3to1fm  aivo;t0 rxm(r3oy1olenmfeiltf Dum(r oo1tlx iicild m2rlu snu4 ltrmo3iydfpDeli ols0srxmxrpoydlpenmnvslsfsrum(  oo4aee mieilsls2ean o u0 exrir oatlp elues;s) exo(mpnudop  lieia( a2tmumpnu4oexoiiciydfs2ranmo (0tltrxf3tytlp r u o t0s2tr(m oo4ll   icilt s2tmxm ;t1tpe moctlsla ra(vonu)texrxrctodfmtrlues t0t2xm(r oudlm   nei (fsrurxm nt1tpxo i3iad m2um( p;()aexoxfcta1la rlneo (0 rum(o3io4oltnlfei sfsrtaumo;o1altn ietlsla elnmp t) rtrmr tydlp ran ol(0 rur(o3iy4ll n fctas)s2ta( pno0aee mietatfmDrmumo;u0tlenio3ootlmtr ueo t)trumir ny4opte ivtasfartmxr ou1tpen oeiysfa emu o;u0tleoir iytla  aivol(0 2toxmpiodlleemieilt  rrrur nu4oetomo3iltlm2ua( snt)areoifcta1lmt livi;s0 2trxopno1omtn nci t)aDrrxmonu1tetomoetytlm ea(vpn(4 eenmo ootlptr ues;s) rumimpio1ope lnvs sfs2taumo;o4ole  i3iydlaDea(mon(4arerxrcoodfptelueo t sexrxrpio1ol nlivsl()srtrxm no4aet  i3taslm2ean pn() rtnifcoa1opD anvsl(0srtm(rpoy1amt  fvias) 2tmxrp;u1aex iociatlm rl(vonu4aetomrcoa1oaDranvo;(0 rtr(m3no1optnmfcslt)srtr(mo;o0openio3tltfm2uan ont0 rtnmoctodomt li ol(0 2tmxm3iu1ll   fcsls) rua(moou0opx  ieilsla2rmnms;(0treoxfcootop elnei (0setoxopiudam nmfvsas) rumxmpot0olto i3iyd a2ua(vpn(0trxrxf3oy1la eau il(  rxmimpny1llt  fctas a2tmx pot1ope ioctyslmDrl(vs;() etoxf ia1omDelnei;()trxmxm3io1al  mietls) Draxr ;o1tpxn o3tad s emums u0teenifcio1op elnvi;(0seur(r3nydaptelietl(fs2uaxrpou0aee iociltla ua(ms ()arxnir3ty1opt lieilt) rumirpiudll   ietas s2tmu  nt1alx  oeiyt mDumnvon()aetrmo io1fatrluvi t0tetoim no1lle mivtl(farrmu  nt4alt iieiyd aDrmuvp ()trxnmfcoa1fatr ieo;t trxr(o no4om nlfetat arur(root4aeen o3tadfs2ua( p;(0trxrxr todlmtr iesls0t2uoim oy1lpeemivilt  Draxm ;o0apeoioeiltfm uluvo u0teerio3to1lptr ues s)t2to(o iudol n ict t s2trxro;u4opx io3iatla elnvon(0 lenifcoy1lmtrlnvols0 rxm(rpiu4llenmict s) Dta(ro;u0optnifeild m2rm( o ()artnxo iydlmDr nvi;t t2urxmpoy4al   fes s)aDumu ont1tlenmictadla rlnvo;t4 lxomo3oa1lmtr ivsl(0 2urir3no1lmte ictasf rra( pot4tlt  icias s ra(vo (0arxniocia1lmteli i t)t2xrio3nu1lpt liciltfsDta(m ot1oeeoio3tadfm2ua( on(4teenxo3iydomDrln i;t)srtoxrpny4lm  micsat  2tax  ot4tptn ictasls emumpn(0 exrmrcia1opD lies;s) exo(opoodaleelivtas)srra(rpou0aptomieiatfm emumonu4 rtnmo tytlpteln s;(0 rtrxrpou4oltn iet tfarrrxmpnt4aee mfcildfm umuvp;t)trermr3iodla rlnvi;(0teumxm3oydol nlfvia()srurum nu0oetnifetad sDrlu pn() reoxr3io1optraneilt0s2xo(m ou1lpen ict tfa2rmur ;o4alxo fciaslaDrm(vsnt) ltnmr tytom elivolt)srxmio3oy1ll e ncilsf 2trxr ot1optniieiydla elnvsnu) exnifcoytomDeauvols trxmxrpiu1omenlies ()s2tmx o;o4tltomfctatlm uau o () rermo3totoate neo;s) etoir oy1lp n iesat)sDrrumoot0tle  oeiatfa eauvo;t) eermoctodlpt lnvs;(0t2xoxm3io1alt licsl(fs2truront1ale mo3iysfs uaump u4tetriociytoatr u s s0s2tmxr nudlmeemnetl(faDrmx o;u4oet ifctyslaDrl( ont0tltoxf3oy1opDraueslt0 2to(opnudame mfcsa( sruaurpnt4tex mo3ilsla umnvont4trxomo oadfmteli il(0 eumxm io1aptn nvtlsfarrmxmp;u4olxnifetlsls emu snu)artnio3iydom r ivo s t2tm(m3oodaltelieiat)artax onu0oltoifciyt s ranmp t4 rtoxf ootfaDe nes;s  rtrir no1ol  lics tfartm(mo;t0oltnifciytla2rl(mpnt0tetrxr3oatlm rluvs s0 eumxo oudopeelncta(  Dtr(rp;u1aexnmfetyt sDranvp;u4texrxr3oy1oaD aivi;t)seurxr3oo1altnlfvils  2tmump;o4tpt moetysfa2rm(mpnt0tetrmrcia1om elnvsl() 2uoxopoydlmen fcilt) Drax  ;t1apxoiieildlsDrm(vsnt4 ltrmo tydla e neo;( sexr(opiy4olenlfvtasfa2ra( p;u1tetn fetldfa2umnvpnu4 rtniociodopD lneo s) rxmxm nudamte nvs t artaur ;o4oeenmietaslm2eluvon(4tleoirctotfmDe ieo t  2urio iudlm emietltfarua( p;u1optnioeiysfs2eluvs u) rxomr oytlatrlnvs;t0 2umxrpiu1ol nmicsa( sDtaur ;u4alxoio3iatfm ulnmo;(0areoxfciadlaDeauvi;s0srxm(r3oo4om nlfcia(farur(  no1tet if3iyd s rlu o;u)tlxnmr oodlaDeanvols0srurimpnudlptn ncs t  rraurp;o4tee moeiytla emump t)aexomfciy1fm  livs s0seumxopoydoptnlfesa( aDumx ooo0oexo o3iydlm2ran s t0texrmo tadlpDelnesl( s2xmio3iudll   ics s a2rm( p;t1aeen f3tyd m ul( o;t0arerxrctydfmDrlu s t  2xo(r iudopenmnvt s s2urum nt1opto i3iyd s2em( snu0 lxoir3oatfmtelueslt)texr(rpoo1lp e ivi sfsrrrumo;t4tltoif3tltls2el(msnt4 lerxf tytoa ran olt t2uoxm oy4am emivia()a2ra( o;u1aetnmoctltls2rln o;t0 rxnirctydomDe uei t  rxmxm3oudolen ncs t)arur( pou0tltoif3ias m ulnmsnt4arerxf3tatlp eluei;s srur(m iu1oleelfvsas  rrr( p;u1oex mfciltlmDrauvpnu)tlxnio iotlmD lnvsls t2uoxrpiodopte fctat  Dumum ;u4apx mocias m2um(vp;u0alxrxr3tatfaDe u ol(  etr(r oo4alt  nviat)s2um(m no1olt mfeildlmDrlnmp t4aexrio3ty1lp e ies t0 2xmio oo4oltnlnctat) 2tm(rpot0tlt iietyt aDranms t0trtoxoctatlpte nvilt srtr(opnu4alt mnvsl(fa2tax pou4oetomfetlsfs rmumo ()altnmr tydfmD ai i;(  etmxopnodaltnmivs (fs2ur( ont1apxoiictld aDrlu pn()alenmocio1omDrlivo;t0s2tr(m3ny1omenmfeil()sDraxr no4oleo f3tyslaDuluvont)tetoxo oytoa r ivi;t0 exmxo iodoltnmnciltfa2rr(mo;o0ale iiciltfsDemnvs;()teerxfcoydlmtr neo ( trtoim3io4ol  lnvtasf Drr(  ot4apt iieildlm rl( s;u)artriociy1latelivslt) rxoxrpnodoptnlnctl() 2tr(m nt4texo ociasfaDeln o t4alermocto1lateaieo t)trxmim3iy4amenliet s  2ta(mpnt4opxomieiltfs2rmnmpn() lermociodla e ueo t)t2tm(r3nudope mneilt)aDtaxmo;t1alen oetlsfa eaums t0arxrxr3oodom eluvilt0sexoio3ny1apt livia()aDuaxmono4apxnmieiatla2eaump;t) lxnmf todomtelnes s) exo(o3oodlpeelfei ( a2ur(mpnu0aex ioctas s ulnms t0trtrmr oadom eliei ()t2tmxrpny1olt livi s)sDra(mpnt4aexoifctas mDeaums;()texnir ia1lm  au sl(0 etm(r3nudoltelncsasf rtmx  ou1opxn oeiysfm2umnvonu)trenif oa1oa eaues;s0 rum(mpnu1am n iesls)sDrm(rp;u0altn o3tlsfs2emu snt4tetrxrcto1oate ueol() 2xrxm3ou1olenmfeiltfa2urxmont1tex mfeilsfmDuluvp;u4alxoxr iatlaDeli ils0 2to(r3oo1lmtemivt sfa2raumonu0alxnifctasfm ean pn(4alenxfcta1fpt  ueolt0srurimpiu1oleelfvslsfaDumu poo1tltomietytlm uluvpn()tltoircia1fpt  i o;(0seurxr3oo1ap  micsltf 2tr(rpno4ope  feiydlmDem(vsn(0tlxrio3ta1fpt  nes;( t2xrxopoydom n fvs s sDtrur nt0tpt  f3iltfa2emuvs;u) rtomrcto1fateai i;t  rumxr3nu4open ics tfs2um(rono4tpx moeias m2ulnmpn()alenxo oy1fa  an sls teurxm iu4om n ivsls) ruaxr ou0aexn o3iatfa2umn o t0tltomf ootfmDeli s s texoxopio1llenlfcsltf 2tr( pno4texnioetyslm uaumo;t4 eenxrciotlaDrln o (0 rumirpiy1ape  fetas aDuauro;t1tetnioeiad sDuaumpnt4trxrxf3oo1latrli i;t0tetoim3oodamen ics () Dta( oot4tetnmfetys a rl(mpn(4 lenxo tytopt ln s;t trtr(m3ou4omeelnei tfaDrmxrpno4ape mietat s2ua( pnu)arxrio todfpte uvsls)s2ur(m3iydap nlfvs tf Durumont1aet ioeild a eaumpn(4artomfctydlate nvi s t2tr(m3oydalte fvtasfaDum( o;o1opt mietatls uauvo;t0trtnio3iytoa e ueols tetmim3nydlmtemici t) rrmxroot4tetomi3iadfs rau s;t)aexoxrcty1lpt  ueilt0tetr(o no1omtn nvi t)srrr(m ;t1texoiociad a eaums u)texoircoytomDraieils) rxmir no1opte fcilsfaDtm( poo1aexoioeiatlm2ea( on()aleoxfcta1lmD li il(  exoxm3oydopeemncia( srum(rono1oetn f3tldfm ea(vpnu0trtnxo3iotlm ean s s)seurxo3iu1lmte fviat)a2uax  ;o0tptomociadlm2rm( o;u4 lxrmr3iadoaDe i sls0 exr(o3ou1ale  nvi () Dtrx p;o4tpto octysla emuvpn(0texrirciatoat  ueils t2xo(r oo1ll elieta()a2rau  oo4oetn fciysla emnvo u4 reoxo3tydla  li olt0trumiopiy4lm   nci t) 2tmxronu1oexn ietldlm2eln pn(0teermr3iydfpD livo;s0teurimpiy4llt  ict sf ruru  nt4oltoioetatlm ua( p;(0artrxocoodopt luvs;s s2ur(rpoudllee nvs s) rur(rpot1aetoifcilsfm2ra(mo u4trtnmr oadoaD aies;t0s2trir3ou1omee ieia() rtmxrono1optn iciatlm el( s;u) exrmfciydfmtelueilt)trtr(rpoy1ll nmfesltf Drr(m ;u0aet moctldfmDranms;()texoifciadlm e n o;t)s2toir3nu4ol nmnei t  Dtm(r no1opxoiiciatfa ea(mp u4 renmocoatfm elnvils s2umxo no4lp n fvil() 2tm(  ;o4tpeniociyd a2ua(ms (0 exrmfctadlaDe u o s s2xm(r3nodoptnmivi s)srurxmoou0tltomfcilslm2ra( s;t)alxrmo ta1opD luei () rtrio3oy1ap nlfctl( aDrr( pno0aeenioeiadfm2ea(vsn() rxomr iodfa rai ol() 2trxr nodaleemfeias  rrr( ono1opt  feiyd sDulumsnt0trtnifcoy1lm   n ils0teum(mpoo4llt mnes (  2tau o;t0oeenifciadfa2ul(vpnu) eermocoytomtrlnvi;t0texm(m ou4altnmfvtat sDrrump;t1tltnifeiydfs2rlnmp;u4arxnxfcty1lpDraueo;s)tetr(rpoo4op  licsa(f rrm(m nu1oeen f3iadla ea( s (4aetrifctotfmt lu s s) euo(r io1ale liesat arumxr oo1tptnio3tydla ra( s t)alxnmf ia1lpDe uei;t0t2tmim oo1om  liciat)a2rmx  no4opt mfciatfaDumu pn(0aetrio3ty1la eanvol( s2xrio3iy1lmenlieilt)sDrr(m ou4teeo iciydla2em(ms;()tleomo3iodfpt lnvols  2to(o3no1lptelfet tf rumx ooo0tleoiietytlm2um(vo u)aeenxf totfm ean i s0trxoimpiodal nmfvi () Dum(  ou1oexo ieiydfaDrm( p;t4tltoir3iy1lmDranvs;t0sexrirpnu4lpen iet t artrurono4opto ieias m2ua( o;u0tlxoir ia1oaDean sls  2uoxrpnydam   ictltf Drr(  ot1teeniieilt a rmu p () lenirciodlatelivils)s2tr(rpoydal  mfvsl(f 2trx o;u0oee  icilt sDranmont)arxrmo3ia1fat aueol(0trtmim nodlmenmnctlt aDrrxmo;t0oleomociadlm uln p;t4 rxnxo3oydop   ivo;(  etrxo3ou4ol  lfeil(  Draxmooo4tetniociatfa eauvs u) etomo totoaD  iei;t)trur(r3no4op n net ()sDtr(m oo4tlt mieiyd aDrmnmp;u)alxrmr3iy1lpteluvol() eum(rpnu4openlfvt t  rraumont1oee  octlsfa2ulump t)trenio3iadlptrlueilt)seumxrpiudal emncilt srra( ono4opxnifeiyd m2uluvonu4 ltoif3iatfp eai ilt srtm(o io4al n icta( artrxmp;o4opxniieiyd a rluvpnu4arxoif3to1op raieo;t0 2xrio3oydlme  ieil()sDtm(rpoo1opxomo3iltls2rm(vs (4aetrxociotfm   n i;s srtoimpiu1aptnmies s)s2taurpnt0altomietlt a2uaumsn(0 lxoifciadlpDr i sls)s2trxopiodopt mnctat)srtaumono1tptoiiciysfaDel(vs (4aeeomr oo1optr uvo s0t2tmiopiy1llt micil(fsrur( p;u0opeo f3iyd s rlnmsnu) renxoctydfmtr u ils  rtmxo3ou4aptn ncs ( artru poo4oeeomoeildlm elumo u0aetnmrcoa1faDranvsl( tetrxr iu4al   nct tf Duaurpoo4tle ioeilsla uanms (0tetoio iy1fp rln i;()s2xoxr3ou1al n nesatfsrraxm ;u4opx mociys m2ea(vs;u4 rerio3to1opDrlu o ( teuoxr3nydol nmicsasfsDtm(mooo4tle mi3tydls ul( o;t0aeermfciytfmDr ivo ()srurxr3oo4om emncils  2ta(m oo4tpxomoeiys aDem(mo t4texnxf oadlmDr i i;() eumxmpny1op elfci sfsDuax  oo0oltoiieiytfs ua(mp;u4texnmr oatomt aues;t)srxm(mpnu4om  mnvslsfsrrax p;o0tpe  i3tltlaDea( p (0tltrmf ta1la r u i;s) rur(o iy1ole mncsa(fa2uaum ;o4tle moeiyt sDrmuvs;() eerifciatoptrlueils0s2urio iy1ale liesls)artr( pot0aeenmo3ils s em( o u4arxrxr todfmD ai o;s0trxoiopoydole licsa()a2tmxroot4tptomieiasfmDra( p (0altomoctytlmDr ieol( truoxmpno1ap emfesl(f Dur(moou1oleomi3tyt mDea( o;t4arxnioctydoa e u o s  exoxopiydome mfesas)artaxrp;u1alt iiciadlmDea(vpn(0 etoxr tatlm raueo;s t2xo(opoodlpe licsls  rur( pno1tpt  f3tld a raumo t0tltrxo3oydlateluei () etr(m oy4lpenlnct sf Dtrurpoo4tptomocilt s um(ms;t0 exomr3iydlptelnvs t)t2tm(m ny4lpte nesl( a2umump;o4tlxoif3tltfa ra(mp (0 exnxfcia1lpD  i il(0setmir3nodol nmivia(  Drr(moou1tpt if3ildfa2uluvonu4artnxocootomtr u ils0t2tmxopno1llte fetlt)a2tr(  nu0optnmiciasfa2umnms (4 rtrmf3ia1lpDrluvi (  2toio oo1apeelfcia( s2trxmpot1oltn o3ildls umumo;(0tleoif3todoptrlueo t0 exrxr oodll e nesl(faDtm( pnu4opxn iciltlsDra( p;(0texrif3oodoa rauei;t truo(opiu1alen ivs (fsDrmur no4tlenmoeiasfs2elnmont) lxnmoctodlmDraiei;s0 rto(rpnu1lmte nesltf rrr(rpoo4texnmfeiadls2rm( ont4aexomrciotlate ueo (0truoirpnodale  ivtlsfartaumonu0tlxomieiyt s2um( pn(0tltrmrcia1lmDrauei (0 2xrxmpny1lltemieta()a2tmxr no1oexomi3tadfa rl(mon(4tlxrxf3oodfpD  ies;s srtoxopny1ome lneilt) rtm(ronu4opeoii3tyt sDea(vo;t)tleniocoytfmt anvil( t2to(o3iudam nmieiat  rurxm oo1apxnmoctls sDul(vs;() ltnxrcoytfaDeluvi;(  ruoxr no1omen fcsls sDurx ooo0teeniietadlsDea(vs;() etomfciodla e ueo t srxoxrpoy1lmtnlnei s) rtaxr no4opxoiiciysla ra( ont0aetoircoy1lpD lues;t0s2xrxo oodap emictl( arum( ooo4aexomoeilsfmDranms;t)tetoxf3oodoa   nvilt  2uoir iu4ol emnetl(  rumum ;o1altn oeiadfa emn p;() lxoir3io1lm  ai s;t  ruoio3nu1ll emnvtls)sDrrx p;t0opxomictaslm ra(mo u4tltnxf3iotfaD lnvol()s2toxm3iu1lle  ncs sfa2uru  nt0tlxnmo3iydlsDua(mo;t)aeenir3iotfm r i olt0srumxrpiu4optnmneil(farrrump;o0aptnif3ilsls um(mo;u)trtnxrcoodoat luvo;s0 2uoim3nu4aptnlictl( srta(rpnt0oleomicils aDua(msnu0tltrifcto1opDeliei s) 2xm(rpno1omt  iei (  Dtrxm nu0aex  ictlt m rlnvp;u0aexrxociy1oa   u i;s0 2toxm oo4altelivil()aDtmx  oo0tlxomi3iasfm ua( onu)artomr3oatoat an s;(0srtrxopnodope mnvtat a2rmuro;t4apen ictld sDem(mp u0arxrxr todop eli i;s  2trxopiy4al emfvi t) Dtr(moot1olxniietyd s ea( p (4aeenxo oatlp  li i;t0trur(m3nu4optemfeia(fartau  ou0aeeoiocilsls2ra(vo;t4 renif ia1omtelivs () 2ur(o nu1llt mfct t) 2umxrooo0oleomi3ild a2eluvonu4 rtrmr tadomD luvs s0trtoxm3oy1opee fvi tfsrrmx  ;o4opxo fciatlmDumnms t0 lxomfcto1op ran s;s)trumxo3iydlme  nvi t sDrax  no4tex mictas s rmump ()artrircto1op  au ils0s2toimpou1om   fei sf rrmxmo;t4oeenmiciyd s2raumpnu4texrmfcoodlp r i o t0setm(r3io4am elncsl(  rrmx o;o4apxnmfetytfaDuanmo t0aeermfciodop  li sl(0srumxmpno1opt mncta()sruaxmpou1opt mictatfa rlu p;u4 etrmf3oo1faDraieo s) 2ur(rpnu1alt  neta()arrrum ou0oetnmiciltla2uau pnu0 ltoir3oatlpt  nvo;s teuo(mpio1apt  ivi (  Dtaxrpou0tetnmo3iadlsDeanvs;u4arxnio iy1op rlneilt0teumirpiy1lmenlnvsatfa2rm(rooo4texn oetatla elu o (4 eenio iadfmte i i ()seumxmpoo4ome  nei sfa2um(rono4apxniietasfm umumsnt4 renmo3iodlm e neils)s2xmxrpoo4lm  micia()s2um( o;u0apt  f3ilsfs2ra(mp;u4 eermf3tytlpDr ues;t0seum(opio1aptelivia(fartmxmo;o0openmfciadlm umuvpnu4 lenxr io1fatrlivi;(0s2xmio3iydapeemfvsl( aDumx ont0tpxoio3ildls elnvo;(0aexoxr3oadfmDe nes;t)s2ur(m io4opt mfcilt  rtaur ;t4alen oetysfaDuau s;t0 eenir3oadlaDrlnvols) exoxrpou1apeemnciltfsDum(  ;t4openifeiasfsDum(ms;u0alenmr oatfatelnei ()texr(r3oudlle mfet (fsrumu o;u4alx iieils a2ea(ms;t0 eenxo3oatomtr uvils)trur(r3iudol  mict s)sruaxm ;u0apxn f3tadfs em(mo;u)artnif tatfmtrli slt0tetrxm io4lm emfctls sDrm(mo;o4tptnmoeildls2ra(mp u)altoxr to1omD auvo;(  2trxrpny4al  lnvi (farta(rpot4olto f3tlslm2eau o (4 rerxo iatlp raues;t sexoimpny1oleeliesl(fsDumx  ou0tpenioetls a ulu s;u4treoir3ia1la  anvs;t0t2toxrpiu1olenlnvt s)s2tr(  oo1texnifciadfa2rmumo t0arxoifciytlmt  ieilt0t2xr(opiy1lm e nei (fs2taxro;t1alxn o3iydlaDeanmp;t) exomocoadfaDr u il(  rxoxo iu1omte fvs tfsDum(r ;o1aptoio3iaslsDea(msnt4 eenxfcoy1lat li sl(  exrxm3no1apt  fctl(faDur(m ;u1tpxnmfciadfaDel(ms;(0 lenircoadlpDraneo;t  eumim3ou4apt  fcsas arraxm oo0ole  o3iysfs ra( p;t4altoxrctodfmD au i s0srxriopnudolenliesas)arumu pno4tetn i3ilt sDeaumpnu0 leoifcoydoptelneo s) rtm(o iy1alt  fei sfaDraxmpnu4alxoiociydfaDumu s;u0 rtoir todlmDr u i s)s2xmim oy1omen fvs tf Dra(m nt1oltomfcias m uanmo ()aetrxocoo1om rlieo;() rxmxmpio1lpe lictasfs2tm(roou1opeoif3iadla rluvp t0 etoxf iydfm  aies;s0 exm(o iu1al nliet sfa2um(roou0alxomfciat a rmump;(0areoxo3iotfmDeln sl()s2ur(mpnu1apte ncta(faDumx  ;o4alxn i3iadlaDuln sn(4areomf3oydlat ai s s) eumio3ou4am   iesa() 2rr( p;o4tpxn oeiltfsDuau p u4 lxoir tatlaD an o s)setm(m iy1llenmfvil(f 2uax  no4alxn feiys m ranmo;t4teenxf iotlpDe uei;t) etr(o3oo4lptn feil(faDrau p;t1oltn o3iysfs uanmsn(0 renirciy1fa   n slt sexrxm3nudlptemnci (faruauro;o4aexoioeiyt m ulu pn(4texnif tatlpDe uvi (0s2uoim iudllt mieil(fa2urumpnt1apto ieilslsDrm(msnu) eeomr3ty1latr ies t)srxmiopoy1llen fcsl( a2rmurp;o4tetn oetysfm2rmu s;(4artomf3iy1oat  nvsl()srxo(m3nodol n ivta( aDrm( p;o1alt  fciysfaDul(vsnt0arxrif ta1omtr ies (0t2xr(r oy4ol  mneil(  Dumx p;o0alt  f3tyt m2umnms t0altnxo iodlpDrlivi;(0s2xmim no4olen ivtl()aDururont1aexomieilslsDeanmp;u4 lxomo3to1op ran sl() rur(opoy4op n net s srrmx  no4apeniociltfaDuaumo u0tltrmr3ia1fm rln ilt) exoim3oudam nlicta(fsDuax oou1tlenioctldfm um( p;t) rxrxrciy1oa eluvo ()trxrxo3iodolt mivs (farrax ont1oexn iciatfa uanvs (0trxnif3oa1lpDe uvi;s)s2xmim io1op e fes ( aDuax pnu0opx mfeild m rmumsnu)alxrxr3oo1fat  n o;s0trum(m3iodlm n icias arumxmo;u0opxnmo3tat s ua(vp t0trtrxociodlmDr uvo;( tetmim iydopt  feia(f rrmuroot0ale micildla eaumsn()alenir3ia1oaDrlieo;(0 exrirpoodolee ncils a2tauro;u4tetn fetasfmDul(msnu)artnioctydfpDe uvi s)s2uoio oudol e ictat  Dtrxro;u0tpx  fciysfm2ranmsnu0 exrif tytoa e uvo;s0 rur(m oy1lmenmfvias  Dtax poo0tee mictytfs uluvo;u0tlenmr ia1fa rlivs ( trtr(rpoy1ol elfeil(fsDumumoou4oee ifeiadlm2rmnvp ()tetrmr ta1optrluvi (0trxoxm3nydamt mnetls s2ua(m nt1tex mi3tasls2um(msnu4texrmfciytlpD auei;()srur(m3nu1ameemfvsl()artmuro;o4optomieiltls ea(vs u0artnmr tatfpD anvilt trurxm no4apen fvsls artm(mp;t0tet mfciltlmDemnvs u0tlermo3oadop e nvsls) 2uoim3oudll  livsl(fsDtaxmo;o0alto f3ils sDuan on() lxrircto1latrau i;s texrxo no4olen ncia()aDra( ont4alenioetydfmDemu on() exnxo tydfaDr nes;s)t2tr(opny1lm  mivta(f 2tmx ono1tet  feiasfs ul(mpn() renxfctodfptelivolt seuo(r nu1op nmfcia()aDtmxroou1apxn i3iasfm rm(ms u4trtoxf oydomte u i;(0 eum(o iodlm nlnvt (f 2ururoou1alxomoctat a emu s t4teermo ta1fpDr nvil(0t2trxrpoodol  mies t)a2rrx oou4tetoifcildfm emuvon(4aleoiocoadfpDe ivo;(0 2umir3iudop elfctl()a2umumpnt1oeto feiatlm ul( ont4trtrxr ootom e n s;( s2xoir oydopt mivslt) rtrx  ;u4olxoioetlsfs2uanmp;t4tlerircoo1fa rluvi t0 2ur(opnu1llenmivt sfsruau ont4oexoioeiydla2ea(mo;()trxnmr3iotfpD  n i;t0tetmir iy4lmt mncs t)sDtmxm no4ale  ociltlsDrm(mont0arxrmo io1lmDranes s)teur(o ou4omt liet t  rrax ooo0opxn ictatlm rln o (4aetrif iadfpte uvo ()s2um(o oudam e ncs ( sDtrur ;o0tptnmiciatfs uanms;t) leoiociatopte uvo;t0texo(o ny4ape  fetlsfaruaxm oo0aleoif3iltfaDrmn p (4alxnioctotfatr u s t)sruoimpnu1opee nes t artmxmo;u4tle  oetls sDrmnmpnu)tltoxr3totom   i i;t0t2ur(r3iu4lp e fviltfsrrruront4tlx  i3iasla2rau p;() etomo3oodfatr ivo;()seurim no1lm e nvt s)aDuaumpou1olt  iciltfa ranvs (0aetoio3tatfp rauvi t srtr(o iodolt  feils artmumont1ole  ietld s2rmumonu4arxrio3oydomD aivsl( srumxmpoy1lp e nvi tf 2rm(  ot1alxn ieilt m2ulumo ()aleoxr3ia1lp elueo t s2urxrpnydlmtelnctl() 2tax ont4teeo f3tasfa el( p t)tltrxfcootfm eln s;s sexoir no1lp   ncslsfaDrr(r ;t0tltoifctydfsDulu p t0trtrmfcoa1fpte nvolt) 2um(rpiu1lleelncil( artmump;t1ope iieild mDea(vp;(4aetnio3iodoaD lnvsl(0srtm(rpio4lm e nei (  rrmu pnt4aeenmfcilt a uluvpn(0 leoxr oatlpt lu olt s2tmio iudopen nvtl(  rrmxr no4tee  ieiatfm rmnvsn(4aeerxrcoy1omDrlieslt) etmio3iu4opee ict tfsrrr(roou4tet iociys aDra( s;t4artoir io1fpteanvils  2tm(r3io1apen fvsltfartax p;t4optnmo3iasfa uln o;u) rxnxf3todfmD lnei;()trxo(mpio1apt lnvtls)arrr( p;t0tpxoifciatfa2rln pnu4aexoxf iodoateaivs ( setm(opiu1lmtn nesat s2tm( pot1olt mocildlm el(vo;u0arxomrcto1omDe n i t0 2umxr ny4lmte fci s s2ta(mooo0oet  i3iatfa2raumonu4 lxoioctotop  livs;( texr(o3iudomenmnvslt)s2trumpno4aex  i3iasfa2uauvo u)arxrxf oodlmD ai i t s2ur(m iydapeemnctlsf Dta(ronu4aeenmictls m emuvsnu4altrxrciydoatrauei s)sruo(r ny1lmeelfetat arrm(m ;u0tpe miciys a emu o u0teerxr oy1oateaivi;(0truoim nodamenmfvilsfsDurumpno0tpe  fctld aDeanvs (0altoxr todlatranvi;(0srtoim3nydameemfvtas)a2trx  ;o0tle ii3tyslmDumuvp;u4 leomo oydlmtelnei;(0 rtrxo3oy1alenlies ()srrr(r oo4apx mi3ild aDrl(vo;(0tlerir iotopDrli sls0sruoxo3iodame lfesat)s2trxm ot4opxomieiaslm2emu s;t0 rtrmr3iadopteaivslt t2tr(m3nu1ll  lnvtlt)artr( pot1tle iiciaslaDea( p;()tlenmo3oy1lp   ueol( texrxmpnodoptnmfesls)sDtaxmpoo1tpto iciydlm2umnvs;t0 eerifcoy1oa  aiei;s) 2xm(r nydolenlivsatfsrtr(mp;t4apxoiieias m ea(vs u0trtrir totlmDrln s ( s2urio ny1ale lieiat a2raxroot4texoiocildfa uaumo u)arxnir iadoaD anes (0 exrio3iodlmtelfeilt)sDrrur ou1tlt mfctyslm ra(vs t4artnmr todfm   uvi;s0 2to(rpiodlm n nvils)a2tm(rpot1tpe  oeiadlm rmn sn(4 rxnmf3ta1lptr neo;(0t2trimpnydamenlfvt s)sDum(rpot1apxomf3tyslm2ea( p;t) exrirciotfmt aueolt)sexmim3nodlmenlies sfsrtr(mo;t4olx  ictatfa2ulu s u4tetrxf tadfp   u i;( trtoir3iu1omenlfcsa(fsrur(ro;o0apx  ociasls2ulu o u0 lxoxfctytlpDr i o (0 exm(o3nu4omtnmietat)a2rrump;t1tptnioeiys a2rl( o t0altnmf oy1laDeli ols truoim iy1ap nlici sfsDra(r nt0tlxo oetadfsDranvo t4aleomo oadom  luvs;(  eur(r3ou4openmfvta(f Drm(  no0optn fctydlm2eau s;u0trtoxo ia1lp ran ols0teur(opou4omeelieiat  rrmumont1opxomiciltls umu s t4tlxnxfcoadfp rlnvi;s) rxo(opoodlpeemfvi (  rtrur ou0alx mieils a um(vs;t0 lxnio3oa1fmtrlues t)trxm(opoo1altnmnvsas  ruaxmp;u1optn feiydfs2umumo u4 exnircty1lat  uei;()s2toio oy4am nmnvsltfaDtm(ront0apen o3tas s2el(vs;t0 lxomo3iydlpDr iesls)trtrim3nodalt lfcia( artmumoot1tpen ieiyt s2ua(vp u4 rxoif3iytopD aneo (0s2umxmpoodlptnmfvtls  Duaumpot1aptnmfciad mDul(vp (0 rxrxf3tytlpDrlu o s) rtrir iy4omenlncs ()srrmum ou4tlen fciys sDem(mo u0aexrxr iadomDe i o s0trxr(r ou1opte fesa()srum(monu1tleomi3iysls2eanmp;(0tlxrmo iytlm r ivi t) etmxr iy1amt livt (fsrrrxmp;o4ale ioeiadlmDraumpn() rerxrcty1laDrlieilt0 2umim oy4ol  lfcsa( srtmxrp;o4tetomietyd aDeau p;(0trtoxo3tytfpteaueo;t)setoim3io1ameelnviatf rtaxm ou1ope  o3iyt sDul(ms (4 etniocoadop  li s;t)srtoiopnudopeelivt ()a2tm(mpoo0tex  ictadfmDrlnmpn()areoxrcoy1laDelieolt sexmir3oodale  nvtatfa2trx  ot1tlxoioeiat mDua(msnu0tltrio oydoaD livs s)trtm(r3oydlm e ivt (faDuaur ou1texniietldlaDelnvs u0aexnifcootoa e neo;t0srtmxr3iydaltelncs ()srtaum nu4aetoio3tltlsDuaumo;(0tltnxrctadom eli ols)srxrir oodlmtelics tfa2um(r oo4tlenioeiytfs2raumsnu)tltrir oo1fmD lu o t  2umir3oy4lltn iciasfaDtrumono4tlxnmietlsfmDra(vont0aeeomf io1fm rlu s s0sexm(r3iy1ll emncslt  2ta(ro;t4tptomieilt mDeanms;t4 rxrmfciadlmtr u o;()t2umio3iy4op  mfvsls sDtmuront0tetomieiydlm rm(ms;(0tleoio iy1omDr u sls trum(r io4aptnlivtlsfsrum(rp;t4teto fctldfa emn p (0trtnifcia1fp r neilt) rtm(opoo1om e fctat s2trxrpnu4olxnifciasfsDrlnvo;u0 renxrctadfmtr nvsls) rtrir iy4ll nlnvsl(farrm(ro;u1alxoioetydlm2rlnmo;u)areoif iadfm r uei t0trxmxm3nudlp  lnesas sruaxro;o1tleo i3ildlmDra(mpnu0texomr ia1fa rauvs;(0teumxmpio1ope mfes t srumx poo0tptnio3tldfa2ea(vpn(4tlermf3iy1opD  uvs;t)trxm(mpoo4om emfei t srrmxront0olxoiocilt m rl(vs u0aetnir oadlpD  ivolt0teuoim nodlmt mfcsat a2taxmonu1tlenmf3tlsfs2uauvpnt0 ltoio3tytom   nvo s) etoimpoudalee ivta( a2ur(roou0aexoif3tyslmDelump u0alxnmfcoatfmt an o;s)texo(o nodale lnvsasf rtr(ront1opxoioeiltlm rm(ms;() rtnioctotopteai s s0 etmxr nodolte fes tfarumxr ;t0opt  ocias m ulnvp u4 etrio iodfmDeauvol(  etmiopoodamtnmiviat) Drr(rooo4aleoiociatlmDum( p;(4 lxomf totfa r ues;s)trtmxm no4om  mncil(fa2umxr no4tee  feiys m2el( p;t4 rerif oatfmD li i;t)tetmirpiy1apen icslt srumum ot4opt  i3iytlaDraumsnu0tlenxf oo1fmDelu slt0truo(o io4om emfctls)arumurpnu0aptomieilt mDuanmp;(4 etoxo ta1oa eauvo;(0seuo(m nudlpe  nct t)a2tm(ront1altomi3iysls2uau o;(0treoio oodlpt lnvi;s srur(m3io4optnlies ( aDtrump;u1texoio3ildls2ulnvs u)teermf3tatfmt lu i;s s2ur(rpny4alee nciat) rrrxr oo1tlto oetysfmDuanvp u0 rtnmf3ootla ranvo t truo(m iy4lmeemfvtls) 2ur( pou4tpx moctyd mDuaump;t)tlxomociotlp  ln s;t)trumxr ny1lm n fet t)arra(root1tptnif3iat s rmn p (0 reoxrciydoaDe ivsls) 2tr(o3ny4om  mncsa(farrr( ono0olt moctlt sDemn s;t0aeeoio tatom   nei t srxoxmpiodome lnvtls)srumurpoo0aex  o3iadlmDra(vpnt4 rtnxo oa1la   i o;s0s2toxrpoy1lm   net (fs2ra(r nu1aexn oeiyd mDumumonu4aeerircoo1faDelueo (0srxrim3iu4aptnmfvsa()arrm(  ;t4oee moeils s rm( p;u)alxrircia1omD  i i;s)srtm(rpiodlpt mnvsa(  rrmxrooo1tpxnmoeilt s uaumon()tltrifciadoaD ai sl(  eto(rpoo4lle  ivia() Dra(  nu1oee  o3iyd aDrm( o;t0 eeomf iy1fp rln o () 2xmxo3iu1om  lfet s)s2umxmpot4opt iiciys aDea( s;t4areoif ta1faD au s;s) euo(o io1ap emietasfs2trxmono4teeo f3iadfa2ea(mp t4altnioctytlatelivols) 2uo(r iy4ap  mies t a2umxr nu4alxn ocildla2elnvs u4tlxoxo iadfatr ueo;( setoxm3nydal n nvs (fs2uaxmpnu0tle mfetlsfa2eluvont4tltrxr totoaDelu ol(0 2umxr nu4llenlivsasf Dum(ro;o4tpxo i3iaslaDuauvp;() eeomr3oatfpt aiei s  exrxopoo4lm emnvias  Drmu pno4teeoio3ilsfm eau s u) etnmo iytom  auvi t) rxoim3nodolen iesat sDtax  ;t1tptnifctytla umu p u0aleomo iotlmte u s t srurxm3iu1ol   ict tfaDrm( o;t1alxn fciyd s rau onu4aetriocio1op r u i s srur(mpio4am nlnet ( s2tr(ro;u1apeoioctatfa2eauvsnt) lxoio iotopteauvo ()srumirpnu4lm n fctlsfs2tmur nt4tltomi3iydlsDulums;u0aexnir3oa1lmt aivs () 2trxo iodlp nmnci ()aDum(mono4tex  i3iydfaDemuvs t) etoxo3tatopD lu s;s)tetmxr iu1lle  icsas arrru pnt1tetnmocias m2umnmpnt4 ltrxo oo1fa rai ols  rto(r3nu4op nmfeta(farraxmooo4altn fciydfs2em( o t0aetrxo to1oa  aues;s)trtr(o3oo1ole mncsat srrmu ono0oltnifciysls uanvo t0trxrxr oo1oatr nesls0setoim3nu1ll nlietas)artmur oo0opeomicildlmDul(ms;()aexomo3totfmDean i;t)texm(opnydamtnmfetl()sDumx  ;u0tltnio3iat a rmnmpn(0altrmo tatlate ivo;t) rumxm3iu4apenmnei (  2raxm no4apxn ictld s2uluvonu4aleoio tydfaD ln slt  etm(o3oo4olt lfetlt)srtr(rpoo4aex ifeilsfs rmn o u)tlxoif3tytomtelu ils tetrxmpio1lp  lfctas) Drau  nt4apto oeias m2um(vo;u4 ltnxf iydlmtraneol( t2um(m ny1optn fcs ()arrruro;t4oetomoctyslmDrln o;t4aetomr oadlpD  u ol()srxo(o3oo1olt lfcia()srraxr ou4apen oeiasfm eluvpnu4aeenxr3tatoat lnvi;( sruo(r3oy4apenmfeiltf Dumx ooo0tltniietys mDrau o;t4tltnio oatfaDe neo t0 rxrxrpou1lpeemfei t)a2tmump;u4apeo f3tad mDrm( pn(4artnir3iytlpDr ues;s0t2urxr iu1llee ieslt)sDraxr oo0aexnif3tltfaDul( s;t0teenxo3oatfatrauvil( seurxo oy4altnmfcsls) Dum( o;t1olx iieiysfm ua( pn(4 renmf3ty1lp eai slt) 2xmxm io4om  lici s)s2tm(mo;t0olxoif3ils sDraumpnt)alxomo3tydlp eaivolt0srurio nodlpeemnesas artmu p;u0alto ociyt m2rmuvsnt0 eerxo3oy1fatr uvi;t texr(mpoo4aleemncslt sDurur ;t4opx  oetydfm2um( s u) rtnxo oo1lpt aivils)teum(o oo1om n fcs tfsrtmx  ot0altoiictatlaDranvp t)trxoxoctadfp r neilt)s2xoim ou4oltemieil()a2urx onu0opx ifctatls2um( s u0teenmf oadla raiei s0 rumir3oo4lptemnei (faDtru ono4texnmo3tyslmDrln o;(0 rxoiociodoptelueols  2uoio iodlmt micsatfsrraum ou0tle mf3iatlaDum( pnu0altnifcoydfm r nvs;()trto(r oudlpenmfesat a2um(r oo0oeto i3tadfs umnvo u)arxoir iodlmD lieo;(0 ruoirpnu1lptemiei sfa2rr(roou1tpt mocilt a2ran on(4teenmfcty1fmDeluvi;(0teum(r ou1op n ivtatfartmx onu1ope moetlsfm2uluvs;() rtrio iodfp r ivo;t0sexoxr oodomtn nvsl() rtaxm oo1open f3iydla2ul(mo;u)alxnif ty1lpt  uvo;( t2tr(m3io1optelivias s2ra(r nu0olx mociyd s2em(ms;u)altoxo oodfa e nei;s0 exmxo3no4ame mici sfaDta(m ;t1texomo3iydls el(monu)altrio3ia1fmtrluvo;s0 2urxm3no4om   ivslsfarumumonu1aptomfctatls elnmpn(4altrxrctydlaD lneols) 2xoim3iy4lmtnlneils  2urxmoot0oet  iciadls umu snu4tetomrciydoaDrlivs (0 2uo(r iydalte fcsa(faDumurp;o1texomf3ild m2rm(mo;u)artoio3totomD lu i t0s2toim iu4amt mnvil( aDum(mp;t1opeoifetldls umuvonu4 eenxr totomDe u olt)srtoim iudlmtnliet s s2rmu poo0oltomoeilsfs2rmnmsnt0 eerxo3iydlp eaivol(0sexrim3iudop emfctltf ruaumono1texo oeild s2rlu on(0aeenifcta1lp raivilt srxo(o oodap nmnvt (fsDuaxmpnt1oeto feildlm2emumsnt4 rerxf3iodfmDean s t) etoxm nydlp elfetl(fsrurum ;o0olxomf3tlsfm uanvs t)tlxrio3tydomD li o;s)trtrir3oudopenlfcsat  2tmu p;o0tlxn o3tatla2eluvp;()tlxrir oodfmt  ueils)s2tm(r3no1lltnmivs s)a2rmx p;t4tpxo oeildfaDuan on(4 rtoio tydlaD auei;(0 etr(o no4ameemivils  Dtr(roou1ale ii3iydfs rmump t0 etoifciatop eai i;(0sexoxr nodamt lfcslt)srur(  ou0oex  oeiadfs uaumpn()trtnir oydomDraieols s2uoirpio1lmenlnctlsfaDraxro;t4olen oetadlmDrmumpnt4 renmo3ia1oaDr uvo;s s2trxm3nu4lleelnvsat  rrr(rpoo1olenmi3ilsfsDrmn s t) lxrxf tadlat au il()teto(o iodoptelivsltf rumx p;o1tee mi3tasfm eauvpn(0artrxf oadoaDe i il( setrirpnudalt micil()s2rmx onu1opxn f3tat m rl(vs u0trxoif oa1om eliei;t0 2xmxr ny4altnlnetls)arrr(mp;u4oetnio3iysfa2um(mp (0 eerif todfmte u ils0truo(o io1lmee ivsls) 2raxrpoo1apt iictls s emnvs;t) rxnmfctadlptelies t trxoirpiudal   fvtls) 2tmu  ou1alxomi3ildla uluvo;t4trxoxr3todlatelnei;t0trtm(r3oo1lmenmfvi (f Dtmxmooo1tpeoiietlsfm rm(vpn()trermrcootomteluvo t  2uoim io1lp  lnctlt artaump;t0opxnmi3ilt m2umn onu4altomf iatfaDe u ol(  2xoxm ou4amt licsl()aDtrxronu1tet ii3tytfm uau o (0aetnxr iy1opD ai slt  etm(r nudoleelfvta( a2ra(r ;u1tpxoiiciatlm elu o t4arxrxf oy1fatranei s)teuo(rpny4lmee fet t  rrmu  nu0oeeo fciydfsDul(mp (0arxnmf oydfp e i o;s sexoxr3nu1lle liet t  2rrx oot0tpe iicils m ranvpnu0 lxnxfcoo1fmt au s;t0teurxmpiy4amen fetas  rrruronu0tpx mfciydfaDran snu0trtoxr iydfa raiei ( s2xrio iudlmtn feilsf 2tmx p;o1tlxnmi3tlslm eaumo;t4aexrif3tadla e neilt0 exmxr nodlmtemneiat) Dumx pot4aexn f3iltlsDeln pnu)trenxrcoa1opD an i t0teum(m3io1om nmnci s sDumu  ou1tlxnmiciytls2eaums;u4 exoxf tydom eaneo;t)sruoiopiydol elnvs t)a2rmu  oo1tlxoio3iasfm2uan p;(0areoir3ta1opDe u s s teuoio iodlpeelfesls arurxmont0tpxoifetys m2ua(vs () etrxo iy1optr ivo t)s2to(opiodal nmieia(  rtrxro;u1tptomoetldlsDua(mo;t0 reoxo3tytom  lnvo;s0srtoxm3oydaleelnetl(fa2trumo;o0oetoio3iaslm2ea(vs;u4texnxfciotfmDeln s;( t2xmxo3iydoltelfvsls  Dumump;u4oeeomfetasfaDea(vp;t) rermf todfpDrlneo;t t2tmxr iy1lpe mict t)s2rr(m nu0aleoifetlt a ua(vpnu0teermf tydla rlivo;s)trxoiopoo1altnmneilsf Dta(mpou4aeeomfeiatfm elums;u0altnmr3to1fp r i i;s0 etoirpny1lmt lnet sfsDtax o;u4tleomocils a2um(mp u)tlxrif iadom elu o;() 2tmxrpnydomenlietlsfa2rruroot4optoio3iasfm ua( o t0aeenirciotfp rauvi;t)setoxo3no1lltnmiet s)arta(  ot1opto o3iltla rlnmp;() lxrio3tytom e ieils  rtmir oodll e fei sfs2rmuroou1tptoii3iys mDemnmp;u) lxnio tatfp e nvslt  rxmir3nu1ale  iei sf rtau  ;u0aptomfetydfaDul(vp u4tlxrio3io1opD lieslt0 rtrio iy1ol   fetasfaDra( o;o1tpt  ieils sDrmn snt)tltnmo ootop rauvi ( s2uoim3iy4llt  icsa(f rtmxrp;t0oeenmieilt sDra(mo u0 ltrmf3totoatelieo ( texmxo ny1apeemnvtas)s2tmxmont4optomi3iytfa el(vp;u4trxrir3iotfpteln o;() eurxm3no4oltelfvi (  rtmur nu4tpe mf3tytls ranms;t0 lxomf oodla eaues;s s2um(opiu1ap   iesls) 2taum ;u4optomf3tlsfsDumuvpn(0tetoxr3iatomteluei s0t2xmxm3nu4oltemnvsas sDurxro;t1tltnifetydfa2emnvo;u0artoif3iy1lpteluvo;t) rtrxrpiodameemnctat) 2umur ;t4tee mf3tasfm ul( o;u) ltrmo iotlatr i ols0sexrio no1om n ici (fsDuau p;o4alx iocils m umn snu)tltomf io1fp elueo ()srxrxr ny4ol nlivtls)arra(  no4altniictad mDrm(vs;(4trxnmf iy1op elues;s srxrirpou1ope lnvi (f rua(r no0tpeo oeilslm eluvo (4artnio3oodfatean o;s sexrxm3iy1oltnlivslsfs2umxm ot4aetnmfctldls2rmumsnt) rxoxr iytoaDr ies;()s2xr(m3ou4ope micsls)artmx o;u1aex ifetatlm uaumon() exrmoctytfmD lueo;s0 2xoio iy1lm elictl()a2tmxrpnt1oexo f3tlt m ea(vsnu0 rxrmfcoydfaD lnesl( trtmxr3oo1lm nlivsatf rtmxrooo0opxnifeiltlm uauvo u4 lxnmfcootfatraivol(0sexoim ny1lm  mfviatfa2tmxrpot4oeeo o3iatlsDrau o ()trxnxr3oatfp e u ol( texoimpiy4ole  ivi s sDta(root0tltn oetasfm ua( p;t4tltoio tydoptr uvo;( s2umimpno4om elnvsl( aDumur oo1tltoio3iysfm2ul( o t)aeeomocia1lm elnvols)seuoim iu4amt  fctl()srururooo1opxn i3iatfm2ulu sn(0altoxr3io1op r ivols0texoxmpoy4al e nvil(fsrrrx  ot1teto o3iadfa ranmo;(4artnmfciydfa r ueo;(0seumio iy1oleelfci () Dtmurpnt1ole  o3tltlmDrl(vp;t)tltrmfciadlm rauvs;s0srum(mpou1amenmnei ()a2rr(mo;o1ope if3tad sDemnmsnu0artoir3to1lmD anvils)trumir iodllee nct t)arumur ;t1oet mfeiatfa2rlnvp u4tlxomo3iodfa ean i s0s2to(mpnydamen fciatfa2uru  no4aee iieiadfsDrmu p t) etoio3oytlpDranvil()srur(r io4lm  lnvtlsf ruaxr ;o0aexo iciasfmDelumo u4teenif iotfpteluvs;() etoxm iu1al  mfvi t) Dtrur no4aet  f3iadla2em(von(0alxnmo3ta1opte uvils) 2xmio nodameeliesasfsrtrxr oo0alt moetls a uaums;u)alxnif3tytomt aivs s trxoir3ou4apeemnei s) 2urxmp;u0oet  feiydlm2ulnvs t0aetrxrctydlaDeaueo t  rtrim3iu4apte fesat aDrr(rooo1ale  f3tadlsDem( pn()aexoxfcoadfp elnei t)tetrxm iydome mivtl() 2tr(rpou1aexn fetysfs2uluvon(0 rtrxoctadlaD anvo t) 2toxo3iy1am  mfet s) 2urumpot1tpx mo3iytlsDum(vp (0teenmo oo1fp eaieols) etrimpiodomenmnesa( sDrr( oot0oltoiocilsla rmu s u)altrmociydoa  li o;()seuoiopoodlpe lfci (  rtr(rpoo0aeenioetatlmDrm( pnu4arenmf io1fa  luvs t t2xo(opnodamee icsls sDumxmo;o1opxn feildfm emnvsnu0 ltoircia1om  aueol( trxm(o oy4lpeemncil(f 2uaxro;o1aexnmi3iatls uanvs t0artnxo ia1op rlueo (  rtoim iudamtn icsltf 2urumo;u4oee moctls a2umuvo u)aleoxrctodoaDeln o;t0seuo(r3nudal  lnei tfs2tm(m ;u4tle if3ils s2uanmp (0 rtnmf ta1lpDeaivsl() rxo(o oy1apte fvilt a2rax oou0tee ifeiaslmDeauvp;(0aetnxo3tatoa rluvi ()t2tmxo3no4optnliei t  rrrxmpot0ole moeiatla ulnvo;u4teerir ootoate nvi (  2uoxm nu1lptn ivsltfsDrmx onu0oeen fctysfs eanvo;(4areoxf oy1lm e u s s  etrio io4om emnvi () 2urxmp;u4oet  ietlsfaDrlnvo;(4arenmf3ta1om eluvi t0s2to(o iydlltelicsasfsDtru  nt1openiieiytfs2rlnms (0alxoirciadfm rlues;s0srxoxmpiy1ame mnvilt) 2rauro;u4opt mo3tls m2ua( sn(4aexoxr oytfpDrliesl()s2xrxrpiudllee nciasfs2urumonu0ope mfeiyslm2emnmo;t0 rtrxo3iotom rauvils) rumxrpio1optelivi () 2uaum nu4apxomfciadlaDem( o t0trtnxo3io1fpte ivi s0s2xrimpnudlmenmnvtat)s2rax oou1tptomfetas a2elu pn(4trtnmf oodomt anesl( t2xmxo3no4ap nlfvil(fa2ururpou4tpxomictlt s ranvonu4trtrxf iotfptelueilt)srum(m io4ol n fcilt) rtr(rp;o0tex mo3iytfm2uluvont)arxomo oatomD aivils0s2umim3oo1lpe mivsl()sDra(r oo0aee  ociytfs2um(ms u)tltrmfcoadfateanvi;(0s2uoir3iodlmen neils) rrr(root0oexnii3iyslmDua(mp u)aetnmf oadfmte i ilt)t2to(r3oo4lpen fvtls)arrrxrp;u0oexoifeiydlaDumnmo;t0 ltoirctotfaD aneils s2xr(r nu1alenlict s) 2tmurooo4optnmfeild a elu snu0aexnxr totfp raneo;t0t2uoimpno1om  mivt ()sDrax pou4oleoioctydfs eanvpnu0alxoxr oatlmDranvo;s)t2uo(r3iodop e fesatf Dtm(rooo0tpeo feiasfmDulu o;u)trxnif3iotfpDr nei t0s2trxr3iudlpt lfvtas)aDrax pnt4apx  ieiys m2emuvo (4tltoir3ty1fate ues;() euoio nydam  lnesl(f Drr( o;u4aet mo3iltfs emnmonu0altrmrctadfa   n i s  2tmim3ou1om nmfvi ( sDuax p;o0aex ioetld s em(msnu4 rtomoctydoat auvs;s0 rxr(m nydol elfcsasfa2tau  ;u1optoifctldla2umump;t4artrif3iotoaDelneo (0seur(m io4aptnlfeslt arum(roou1aeeniietyt m uan p;u4 lxnmf oydlat aiei s0trtrxr oy4lpen nei sfs2um(m ;t4apeoifeilsfa ulumo;t4 rerif3oy1lptranvs t)trxo(o3io4olen fcta(  Drauroou1alxnmietltls2um(vs (0artrmfctatfate ueo;s0t2urim3oodope  netasfsDtm(mpou4tee mictltfm2rl(vonu0tetnif3oodlmD livils)srumiopnu1lpenlncs (fsrra(mp;t0apt  feiydlmDelu s u)alxoir3tadfmDeaueslt) eumiopiudolenmiesl(fa2umxmpot0aleo fcias mDeau p;t4aleoxocoo1laDelieols0 2to(r3nodllee fei s) Dua( pno0opxn icilsfs2rm(vo (4tltrxr tatom eanvo ( texr(m no1lp emfcta() 2tmx onu4olt iocild mDulnmont) rtnif ootop r nvolt sexm(r3io1om emfci ()a2ra( pno0oltoifeias s2rlu p;(4alxnmfctotfmt aneo s)s2urxrpnu4llt mfvtat)aDtm(m nt4tptomf3iydls rmn onu4trtomr3iydfa rai i;s) rurxr3oudom   fci (f 2tmxm nt0tpe moctls m emu s t)aeeoir oatlaD ai s;(0 rxm(rpny4op  mfcsa( aDumxmp;o4teen oeiydls2ulu o t4trxrxrcoodlm r nvs s0 eurxr3io1omt mfei (farurx pot1ale  o3tad sDra(mo t0texnxo3tydlm  lu i;()seumxrpny4opt lnei ( aDur( o;o1alt ioeias mDean o;(0 eeomocoadlpDrauvil( trxm(o no4lpte ivs ()s2rr( ooo0tpxn iciyslaDum( ont4tltrmr3tytoatr ivils)s2umio io4ap  licsa(  2trurpnu4opx  o3tlsfsDrlnvp u4teerxf3oadfa  anvs;s0s2tmxm oo4oleemfctas srum(ronu4oetniieiydlsDelu s;(0tetrir3iadoatr ivilt  2umim3ou4optemieia(fsrtr(  ou1apeoiietadlmDemn p;u) rxrxr iadlpt livs;() rxo(rpiu4ape lfes t)artmxr no1tltoifciydla rmuvs;u4trenmrciytlpDraneolt)sexoim3nudll e ivi s srurxm nu4tlt mi3iatfm ea(mo u0altnxf oy1fp  luei;s  exo(m iy4al elnvta()artaxm ;t4alt mociatla emnmpnu)aeermf tatlpDraueolt0texrxm nodalee fcs (f rur(r ou1oleoioctasfa2rmn o t0trxoifctydlatraivi;s0trurim ou4omeelfei t sDtrumpnu4aexo o3iat m ea(mp u4aetoxrcto1fate nei;()trurim no4amtnmfeil( sDrr(rpno4tpx if3ilsfm2eau p;(0 eenxfciadop raiei;s srxrim oydlpt  fcsatfarurx oou4tpeo oetyslaDemnvp t4texnxocoo1fptr ueo;( sexm(opoy4optnlictltfaDtr(mpnu4apenmf3ilslm um( snu0aetrifctytfmtrluvi s) rxoxmpiudolenmnci (  Durxmpno0tpxo fciydls2umnvon(4 rxomf3oa1opD livs;t  2umxm3oy4ap  lfvt (  Dra(rooo0tleomicilsfm2ranvpn(4 renxo3ia1faD  uvi;t)s2xm(o ny4lpe mictat s2tm(r ;u1tlxoii3iad s2eaump u4altnxrctydlatelu s;s0sexrimpio1aptemfesat sruaxm oo0aptomf3tadls2umnvo;u4tleomociadfmt  ivslt0 exrimpou1llenlnvt t arur(mooo4tetn ocilslm rmnmp;u4 exrir tatlmtraneolt0 rxoxm3oo1om  lnetl(f Dtmxmp;t0oetoiociydfs emu p;t)tlenio iotopD  n i;t0 rtr(o3nu1oleeliviasfs2umu ono1tpxnio3iytfs umnvs;u4arxnxo oodlaD liei s  rxoiopnodam n nctlsf 2rru p;o1alxnmictytls rl( s t)aetnio oydop rli sl(0sruoxrpio4aptelfvilt aDtrur oo0aexn f3ilsls2ean s;t0trerif oo1fpD  nvs;t  2trxrpoo1amtelivtls aDrrurpnt1oet  f3tatfa2uln pnt4artrxocia1fateaues s0t2toim3iy1lltelies t)aDrmx ono0apeo oetyslaDrmnvs;(0 eeoxf tadlpD  i i ( t2umir3oydolee ivi tfarum(  ou4tpxnif3ildla2uluvp;u4tlxnmf io1fa  ai i;(0s2xmiopiy4omenlivsls  2tr(  ;t4opt  fcild a2ea( pnu)artnif ootla eau i t)trxrxo io1op nmieiat) Dumxroou0oexomf3iyt sDuln o u4tlxrir3todlmDeaueo;t)srtr(mpoy4lp  mfci t) Dtrx o;o1oexniieias s2rm(vsnt0arxoxrcoodfmtelues;t t2ur(m3nu1oleemivils)sDra(mooo1ape  o3tyd a rmu on()aexnxfcoo1lptr n o s0 rumxrpou1ap emfeiat  Dtau  ot1aptn ieiatlm2em(ms;u)tetniocia1lmD lies t  rtm(rpiudoltemiei s a2rax  ou1oet mo3tltfm ua(mpn() rxoir3totom r ieo;t)tetmxmpiudapt  fcs (fs2ra(r nu0ope ifcildfsDum( sn(0aexrifcto1fpD luvs (0tetr(opno1om eliei (fa2tmuroou1texomf3iad s2ul( sn()artrxo tytfa elneo;()sruoiopiodaltelnes sf rurx  ;u4apto ieilslm2ul(vo;()aexomo3oytfmD lu olt0s2tr(m nydopeemieia()a2ra(root1tpenmi3iydlm2emu sn(0tlenif3oatlm e nvo t)srum(o iy1aptelfct s)srtrxrpno1alxomi3tls a2uan o;u4 eeoxf3tytoaDranvs s0s2um(opno4ap elnvtat) 2rr( pnu0aleo ociltla2rmn o;u) ltrmo3tydlmDrluei t trtoxm iydol emfvi s)a2tax oot4alxniictls a umu pn(0arenxr iytfaDeanes;t)trurxo3iodlp emiviltfsDtmurpno4apx ioeiytlaDul(mont0 rxnif totlp  luvil()t2tmxm iu4aptnmnei sfs2ra(mp;t4oex mictatfsDumu snu)aetnxo3to1fpt li sl() rxmxo nodlp nlnvs ()a2umu  no0tlxn oeilsfm2eluvo u4 lenxo3tatopt  ivs ( t2xmxm3iy4altnlfvtasfaDum(rpot4alxoif3tas m eanvo t)aeenmr oydom rauesl(0s2toim ny1ll e ivil(fa2rr(rpoo0oexnmf3iysls umu pnu4 rxrmo3oy1fp rlnvo;s trxmxo ou1lle micta() 2ta(root4apt  o3iydfs emu s;()aetriociatlp  lnvols  etoxrpiydal emnvilt a2umxm ;o1alxn i3tld s rau pnu) renmo tadlpte u il( t2tr(r iu1ameelfvslt srrr(  oo0tee mfcils aDeanmsnt4alenifciydopD lieols trtr(rpiu4lmt micias aruau pno0opt ioctyd aDuanmp t0 rtnxr3oadlpD livs (0s2xriopiy4lleelfeils  2tax pno4apenifctydfs el( pnu4 exnircoydoat anvi t0 rxmxm ou4al emfcsltfaDrr( pot1oleomfetlsfaDeanvo t0trtnxr3iodomtrau i s) exmio no1om e fct tfarumxm ;t4teeomfeildfs2elnvpn(0tlxnir oydfp eaueo;s srtoio iodolenlncsa( a2uaxmpoo0ale  ieildfs ea( snu4texoifctatfptrluvs;(0teuoxrpiy1omenlfcil()sDraxm nu4tltnifctasfsDrau pnu)areomr3ty1fpD ai slt0t2tmxr oudap e nes s) Dum(rono4oeeo oeiatlm uan p;t)tlxoir3iatfmDraueo t)t2triopiu4lmeemivt tf 2urumoot1apto f3iadfs2ulu o t4tlermrcoytoa rlueo;s)sruoxr3iodalee feiatfs2tr(mpoo0aptomfctat s2el(vpnu0 eerio3oo1fp   n i s0seurir no4om nmnvta()a2raxrpot0olxnmf3tytfmDulnvp;t4 leoxo3io1latelnei;t) rur(m io1lmee fvtlt)a2rrurpnu4tpe moctat s rluvp;(4tlenxo ta1fa  aieil( tetoxm ou1om nlnvi () rrauront0oltn fctatfa umumonu0aleomfcio1om   u s s)sexm(o ou1lp n fvtat  rta( o;u0tle  ociasfm2emn o;t4alxomf3ta1la rlnvols0s2xmxo3no1ole lici t aDtrxmpno1tet ifctatfa2ul( p t4 eeoxf todoat lneo s0 rumimpnudolen fvi t)s2taxm ;t0alxn ociyt mDumuvs;u0aeeoxociatoa   u sls)t2xrxo iodlpe lnvsas arra(mpnt1apx if3iaslmDrm( sn()teenmfctytlp   uei ( trxmiopoy4lmenmivsls) 2um(  ;u1tlx  feilslm ranmp t4 lxoxfciytom rlnvsls0teur(rpnu1llee nvilt sDrrum nt4ape mf3tat aDelnvp ()arxrif3tadfmD auvo;(0 exr(o iu1altelivtasf Drmu  no0tltnmfeiasfm2ra( o t4trtnxrcty1laD li i;s0trurimpiudap elnvias  rrr(  nt0oetnifeiyslm eauvsnt0trtrirctadfmDrau s ( s2uoim oudlmenlfcs ( sDuaxmp;o0apen ietldfa2rmn onu)artoxr oy1om elieol(0 2xrim io1ope lneias arumur oo0tpxniietysfsDum( o;(4aeenmf oytfmDe iei s)t2xmxr io4am  lnvs s) 2trxroou1tlx moeiyslm2eln o () ltoxrcootfp r ues (0s2tm(o3iudomte ict ()aDrrxm oo0tpe  o3tadlm elnvo t) ltrif3totlpDrli s (0 rto(mpoydamenmivslsfsrrrxm ;o1ope  f3
\ No newline at end of file
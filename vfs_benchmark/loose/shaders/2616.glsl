@@ -0,0 +1 @@
+nvolt seuoxr3oy4lmtemfvia(faDuax p;u4ope ii3iyt m rluvo u4trenmfciytlpt luvo;()t2xmxopiudll emnvi ( aDraumonu1tleo i3tltlsDeau sn(0 eenio iodfatrlieols srtmxr3oudapt liet s s2rmx p;o4ope moetyt s ra( s;u4tltoxfcio1opD lnei;s0srxo(m3ny1llte net tfsDurumo;t1oltoifeiytfs2ra(ms () exoxrcoo1oaDeluvslt)srxo(m3oodam e ietlt)a2ur(monu1tpx mo3iadlmDrm(ms;()tltnxr3ia1lmDelivo;t sexoimpoudlpte nvt s sruau pnt1tpxomiciltfs2rln p;t) etrmr oytlmDr nes;s trtmirpoy4lp emietl()srua(rp;t4aexoifctytfs ua( pn(4 eermf3todlptrai il( setoxmpiu1omt mfct s)aDrru ooo1opxn oeiadlm2rl(vp (4tltrxf oa1omDelu o () rtr(m3iudap nlnvia( s2uaur ;o1tlx mociaslmDuan s;(4 reoif iadlaDraivi s trum(m3nu4amt mfet s) rrrxm ;u0aee  oeiytlaDemnmo t)trtrmoctodom  luvo s)s2xr(m3io4am elfei (fs2uru o;o0opxo oeias mDum( o ()trxrif3iotomDrau i t)s2trxo iy1aptnlfet ()a2urumonu4aeto oetltfsDumn pnu4aexrxo3oadfatrlneo;t)trtrimpoo1oltnlnvsa(fsrraxr oo4open f3ilt sDum(ms;(0teerxf3tatfpt  iesls s2umirpio4amenmnvils)a2urur ;o1oeeomf3ild m emnms u) eerxrcty1fmDeau ilt) rumio io1lpe  ivi tf 2ur(monu0oee  ociys mDuau o;t4trenxf3iatomDrau s t)sexoirpiodlltn icsa(f rtaxmpoo0aeeo o3tys m2ranvp;u0aleomf3totoatraneo s sruoiopou1olen nes () rtm(  ot4oeenifctatlaDemumo u4 lenxr3iadlaDe ueo s truoxo3nudop e fesa( sDrm(rpot4opxn feiat a2rlu o t0aetomrcoytfpD  uvol(  2xmir oudam e feilt) 2tmurpot1alxomictas s rmnvp (4 eeoxf3to1fa e n s;( tetmxr3nu1oltelnvsas srraxm ou1oet mf3tyt m ulnvs u4 eeoxf oodlaDelnesl()s2toxr3oo1am   fci t)a2taump;o1olx  fciadfs emnms;u0artomr oodoa rlivo (0s2trirpiodlpenlfctat) Dtrx pnu0apt  feiydfmDua(mo;u) lxnxr iadop  anei;s0s2um(m nudalt  feilt) rtm( o;o1ope ii3tyd a ulnvs t0 rtrmo iatfmt  ueol(  exmxmpoy1lm nlfeiasfa2rrx  ;u4aeeoiociydfm eaumonu4tleoif3ty1faDr iei;(0 ruoxm3nu4lmtnmneia()aDumx ono1oexomf3tytfsDulnmo;t0treomr oo1laDrlu olt t2xmxrpnydolte fvilt)sDrru o;o0tpt mfetysfm eanvs;u0 renir iodfpt lu s;s0trumxrpiy1al nlfvtl() rur(m nt0oltnifeiydlm2ra(msnu4trtrmocoydomDrau ilt  eurirpoudol elicia() 2tm(  ot4alxoii3iytfsDrm( s;t)treoxf tatfm  au i t0tetrxrpiodoptnmneslt)aDrm( pou0tlxoif3ilsla2ua( o (0arermocoodomteluvs;s  2umxr nydlle mivsa()a2uaumpnt0opxnmieiyt a2rl(vp;t0alerxf iytfptr nvo;(0 euoxmpny4lptn nvi tfa2rr(  oo4oexoiietyt a2eau sn(0 rxoif3iodfmteauei s srxrimpnudop n fesat)srtmump;u1aeto i3tls aDemnms t0tltnio3oytla e n ilt0seumxrpou4olte fvs s sDur( o;o1tlxnio3tatla rmu p;t4 rtnmf3iatfmD aues s0srurio3oo4apt lneilt sDta(mono4olxomfeilslm2elnvsnu0trenio3ty1lmtraueilt  eurxo3ny4ll n ivsatf 2rru p;u4texo f3iydfmDrl(mo;t0 ltnxrcoytlatr uvo s  rurxm oo1opee fcsls sDuax pno4tpe moctydlmDul(mp u0teeoxr3iytomDrai s ()seurxr oo4aptnmneiat  rta( ooo0apto f3tydla2ra( p t)tlxrmr3oytopte u i t texoxrpnu4lmee fcia(farra(m nt0tetomi3iaslm2emuvs u0 lxnmo oodlaDr ieil()srtoxrpoo4alt  fesat srra( pno0tetn f3tydfm eln p;t) rxomfcoadfmDrluvils)trxrxo oo4ole  netl( aDurx ono4tleoifciys s2ean o (0treriocto1omtr u ols)s2xoirpou4optn nvi t) 2tr( ooo0oexnmfeiyd aDua(vo t) ltrio3iotlpt livsls0sexoxopnudlp e iei t srtm(ro;o1tpx iieiytfa rlump;t0texnxf iadom eluvo t sruoxmpnu4om elfcia( aruaxmpot4opx if3ilt a2emuvonu0altoio3io1fmt  u o (0sruoio ny4ol nmnctas s2urxrooo1aetniictyt aDel(ms;u0artnxr3oa1latrlneolt0trtoirpnydame licilsfartaxmono4oexn oetldls em(mont4aeenmf3ty1lptelneo;() rxmxrpoudalt  ictlt s2rm(mpno0tptomf3iysls eau s;t4tltrxfcoy1lpt luei s0 eto(rpiodlmen fcilsf rraxmpnu1aleo ieiatfs2em(vs ()aexnxo iy1fat aieo;()srurxrpoodam e fciat sDraurp;o0oee  ictatlm2uauvp u4treoir3oo1latelueo ( s2toxm3nudolt  nvi t)sruaumo;o1ale  ieilt aDumu p;t) exoxo tatoaDe n s;s0teurxmpoy1lptnmnvsat)a2urxr ;o0optnmoeiat s el(vp ()trtnio iotlpDeanes (  2uo(o no1ll nmnei s)s2tm(moot1apxn octydls rmn s (4 rxrxf3iytfatelnvi;s0srxm(m3no1am   nciltfs2rrxmpot4aex iieiat s ra( pnt4tlenmf3todlmt luei;s0s2umirpiy4alt mfct t)aDua(m nu1teeomiciat aDumumsnu0artnxr to1opDraivo s s2xoxm oy1olenlfetl(farrrum oo0tet  feiatfs ua(vs u0texomrcoa1fptr u slt trtrxopny1omenmnvia(farraxrpnt1ale mo3tldlaDea(mpn()tlxrmo3oy1fp raues (0 rxm(m oy4am n nvs s srrrxrpot0aptomfciysfa rlnmo;t4 lxrmf ootla rai o;(0 2um(o3nudlm nmivtas  Dtm(  no0tet ioctat a2ean o (4artoifcoa1laD aieo t0t2uoxr iu1lptnlneia( artau pno1opt io3iys m um(mo (4 leoio3oa1omt lu i s)t2tmim3io4optemics t)aDta(mp;t0aee  i3tatfa uaums;t4 reoxo oadomtraies s0s2tm(o nu1aleelnvs sfa2urx pnt0oltnmoctydfm2rmnmp t0 exoio3oa1opD an sl()t2tm(opnudapee nvsl(fartaxro;u0oltoiociad sDea(vs u4altoir3oo1fpD lu i;t trxrxmpio1lltnlnvsls)arurx p;t4apt ii3iltlmDua(ms;t0 rxnir3oydlmD aies (0t2urirpoudop elfcsls)srtmumpno4tptomfeilslaDrmnms;t) rerircto1oa  anesl(  rxm(o3ou1am emivi s aDtr(  ot4tpe io3tldfm uauvs;() rtrircoo1lm raivo;s sruo(mpoy4lmeemiet tf rrm(moou0opxnio3ilslm elnmo u4tlxnxr oy1oat lnvs;(  etrxopoudom emiet sfsrua(mo;u0alt  ictasfsDemuvont0 rxnirctatfaDr nvol(0 rtm(opnu4opte nvt () Drr( oou0apxoifeils m rau o u4aexoxo ootopt au s s  2um(r ny1omt  nciltfa2rr(mp;u0tle mictadlm rlumonu) leoxf3iotfptrln s;()teuoxr iodam   fet t) 2rrxrpnu1aeeoifeiytlm2rl(mo u0 lxnxo oodlpD lies;t0 exrir oudap   ies sfsrrmurp;u4oeen o3iasls2ua(vs t0aexnifciadfp rliesl(0srxoio3oudomtnlfes ( srrr(moou0aetoio3ild m2uauvp ()aetnxf3iydlm  aivs;(0tetm(opnodamtnlnct ( arrmxrpno0apxo fetasfa2um( pnt)aeeoif iytlpDrau s;s) 2tmim3ou4lmeemfvi ( artrump;t4apeoifcilsla umn snu4aetrioctadlpD livils0sexoir3no1lpt  fvtl() rururpoo1tetoio3iys s2rm(von() eeoiocty1oaDr uvi s) 2xr(mpoo1alt mietas a2uaump;u1texnioeiasls ea( p;(4aexoir3iodfmtean i;( s2tm(r3no4lmt  iviasf 2tau  ;t4tlxoiocildlmDeanvs t4tetrxo3todomtranvs t0t2xo(m3ou1am  mfetat)aDtaxronu1apeo fetys aDeanvs;u4 rxrmf3iytfmte nes;(0 etr(mpoy4aleemicslt s2uau o;o1oexomo3ildla2rmn s;()alerxfciotlatrlu olt0s2ur(r3iudlm emfcs t) 2rmxm nt0tptoioctltfsDuln snt4tlxnxr3io1oa r nvo ( setmxm oudlptnlfvi t aDra(rooo1olto oetysfsDeanmp;t0tltnirctydlp eanvo ( srurxrpiy1am emfesat)srtau pou4tpt iocildlm2raums;u) rxnxfciy1lm e neo ()tetoxmpiy1ol   fei tf Drr(monu1olt mi3tldfm2em(vo;u0 rxoir3io1lpDr iei t0t2xoxr iodapt lfvtltfsrua(r no0tpt  oetaslaDrluvp t4artomociatop rau s;( srxoir3iu4omte nvsa( a2tru pnu4ope mieiadfm2rlums;(4artoio3iadlpD  neils) euo(o iodoltnlfvs s  rrmxr ;t0oltnif3ias m2rmnvs u)trtoxfcoydlateanvs s0srxo(o nudop  livtls a2rr(monu4tetomo3iat s2rmn s u)tltrmo ty1lmt an olt0texm(opiydale lnci ()sDta( ono1alt mfciadfs2eau s;u0 ltrxr totfp  lu i;s0texoxrpoydlme mfeias sruax o;o1ale  fetlsfm2ua(vp t4aetnir iotomtrauvo ()s2xm(r iu4amte fcsatf 2tm(mp;u4teen o3tls s emu s;u) eeoir iadla elieo;t0t2uo(o3nydlptelfvi sfaDra(m nt1teenmocildlaDeanmo t)aetnir3totoa rln il()s2tr(m3oo1apt  ncslt)s2rr(mont4teeomietydla rlumo;u0tlxrifcoatom   n o;s) 2trxm ou4om emfesls aDtm(mo;u0texo ieilsls2rm(mpn(0trtrircoydfaDeluvs t) 2umxm3oudol e nesl(faDtaump;t1tlxomfeildfs2umu pn() ltomf3totfpD anvil(0 rumxo3no4lle  nvi sfs2taur no0alx micias a uau p u)tlxomr tytom rlieo;(0s2xriopnydole lies s aDtaxr ;u0olxniieiat aDel(ms;(4tetoiocoytlaD  nvs;s)srxoio iydopeemivsa() ruaxmpot0ole  f3iadfs ua(vs;() rtnxociadoaDeaies;s0 etr(r ou4lle lict t) Durx pno0apxo iciad mDrmnvo;()aleomf iytfmt  n s;t0teum(opiodlltemnvi ( artmu oou4alxoio3iadlsDemnvo t)aexrmr3tatfpt ln i t0srxrxo iy4ap elict sfa2rau poo0tleo oetysls2rau s u0areomociatfmtelnvi t)seur(mpny4op emfviltfarumx pot4opx  o3iysla rmu p (0treomf tytfpDraiesl( s2umxo3oy1alen ncs (f 2umxmpno0tptoifeiyd m em( s;()tleoxr3ootopt lueolt srtmxmpnudal elieiat a2rrum no0aet micilt sDeau pn(4 ltomf todlmte ieils0 ruoxo3iydol nlictlt arumu onu0opt  i3tldlsDulnmont0 etrifctytomD ln sl( srxrxopiu4lptn fes ( aDrrx  ot4tpeoio3ildfsDelnvpnu)alxomf3tadfaDelivi;t s2toiopoo4llte fei ( aDumuro;o1tex mo3tyd s2raumpn()trxnxocoodoatraieo ( teumxrpoy1omenlietlt a2umx ono0olenifeiydlm2uaumont4texoxf ty1omtrau ilt)setmxopnu4altnmfcs s aDtmxm no4opx micildfsDelnvonu4 eenio3todfp   i olt t2tm(m3iudome lfeils)a2tmumpno1tleomfetls s ran snu4 rtoxfcia1lp r nvols)t2uoio3iodlltnlnvs s)a2rm(r ot4tptnmictat s ul(mo;u) lxnif3ootop elu il()sexrir3nodole  fvt s s2tr(ro;t0tex iocilt m2rl(mp u0aeermr3tatlp e n i;s tetmio oo1olt  ivsl() Dtmxm ;u0ope ifetadfa ul( s (4texrir iatfatrlnvsl( t2tr(o3oodlmen nvsas  rrm(r oo0tltnmi3tasls2uanms;u0texnmf3iy1optrln o s truo(o io1oltemncsat sDtrxronu4oee mfeilsfm2elu pnt0tlermr3tydfpt lieol(0 rxrxo3ny4lp nlfviasf rra(m oo1tpxomi3iys a2rmumpnt4 rtnxf ootfmD lu s;s sexoxm oydlm emnetlt s2ta( pnu4oetnmieiys sDelnvonu) eenxrciytfpD  neo;()texo(o iy1om n ivt s s2um(m ot1tlenmictyt m2uan s t0tleomf to1oa e nvols) 2xrxm3oodol  mfcs t)sDumumpoo1open octaslaDra(mo;u4aetrir iydfmD lnei s t2xr(r3nu1omtelfvt tfartaum ou4olx  oetlsfmDemn s;u)texnifcoo1oaD  uvi;s0tetr(r3oodam nmivsatfaDraxroot0aex ii3iad sDrl( sn(4tetoxf tydfptrli s;(0sruoiopou1amt mnvsls a2umu p;u1ale mieiatfs ulnmo u)tlxnir3iydom   ivs (0 euriopno1ap   fvs t) rua( p;u1aleoio3tadfsDrlnvo;(4 exnif3tatlpDrai i;s tetoim ou1alt mfesasfartm( o;o1tpenii3tat aDrl(vo t4 ltrif oadomDelnvo;s0srxriopny4oltemnet s aDtaxrpou0alx ifeildfm umn p;t)teenifctytfate ues (  rumxo ou1lp nlfct (fa2raump;u1opeoiociad aDumnmsnu)artoio ta1om  livol(  2tmxm3ou1oltn ncsat  2tax ono4olenifetas m rm( o u)treoxf3io1fat an sl(0 rxmio3io1op  mfctlt  Drrx  ot1ale mfetasfa2ea(vpnu0 ltnio iytfmDrlnvo s)srxr(m ny4omte nvtls)a2rmur nu4oetniiciltla2ranms;(0 eermr tytoatr i il( seur(r oy1am   fvtasfs2umxr ot4teto f3iyslsDeanmp;u0tetomr3tytfp   ies;t0t2xm(m3iy4llt micsls)aDrr( ooo4aetoii3iatfs uauvont) rtrmrctotlptrlivi s)teuo(o3nudap  lict sfs2uaurp;o1olenii3iltlm umnmo;(0aleomociatfaD ln s;s texmxm nydope  ietas)arur(mpoo1ole iociadfsDel( s;(4alxoio3iodfm rlneo;t0 2xmxo3oo4amtelfes ()srrmu  ou0ale mf3tltlm ranmp;()aetniociadfaDeaueol(0srtm(mpnydam elnetltf rta(m ;t1aex iictldfa rau p u) exomr3oydopt lnvo s0 rxm(o3io4aleelict ( aDtmurp;u0alxn ieiltfa em(msn(4alenir3iy1fm r u i;t t2tm(o oo1ap  lncilsf rtmum ou0alxo i3iyslsDeaumo;(4aexoir3oydoa r ivil( tetoxrpou4lleelfcsa()aDrrx ont1tlxo ictyt mDea( o;t0tltnio oytlat luvi ()trto(rpoydlpte ieias  rrru o;o1tle moeiydfmDrluvo u) lxoir ootfmDelues s)s2xr(rpoy4omtemivslt)arrau pno1olx mieiysfm2rmnmp;u4 ltoif3oydfpD li o s) rxo(o3nu1op e fvtas sDur(rpoo0aee mieiys m2um( p;u)tlxomfciy1fm   uei;s  2uoxm3iodaptnmnesltf 2rmxro;u0oetn o3iyslm rau o;u) rtrxf tatfaDrli ilt0 2tr(m3iu1apt lfesat s2rrumo;u0tet mocilsfaDrm(mpnu0tlenirctatlpt aueolt seurxrpnodapee nes ( sDra(m ot0tle  ociasfa elumo () ltnmrctydom  lu ilt)trtr(m io4ol  mnvs s  rtrur ;o4tpen iciys s umumo;u0artomo3ty1la  lnes;t) 2xoxm ou4apt mnvs sf Draxro;o1alto ocildfa uauvo t)altnio oy1omt  uei (0srxoim3oudlmtnlfct ( sDrax  nu4texnmfctat aDumumo;u4tlxnmr iadfpDrau slt)seto(r oodllt lictl(farurxm nu4alen i3iys m ul(mpnu)tltoxfcoytfptrluei ()teumxo3oodomenlncta() rrau  ;u0aeeoioeiatla2ranmp u4teenmr iodfpteanvslt)t2tr(r3oodomee ivs t)aDrm(mo;u4tpxoiictls a em(vp;(4arenircoa1latrln ilt  ruo(rpio4alt lfci sfaDtmur nu4apt mf3iyt a2rl(mpn(4areoif3ty1lm eanesl( trtrxmpno4lpt mfei tf Drrumono0texo i3ias m emnvs (4tetrir oo1latrlies t)t2umim nu4apen fei s) Draum oo4altnmfeiatlm rmu s t0 lxnmo oadoa e i il(0 2xr(m3ny4ap elici t)a2trx  nu4oetn f3iyt mDeaums u4texrmociodfat  n o;s) etrir3iydlpen ivil( s2trx  oo1tpx  feilsfsDel(mont4artomo ootopDelivo ()s2xmir ny1alenmnvs s)srrrum ou4olxo i3tys s2em( s t0texrifcoydfm eanvol(0srto(o3oodlmtnmnes (faDtmxmpoo4ape  ociadls2um( o u0texnxfcoa1fptran o;t  eum(mpny1ll emfesl()a2rmu pnu1tlenmiciat mDua(msnu0altoxrcio1fpDelneils0 ruo(opnu1am nlnei (faDrmump;o1optn f3tatfsDuaumonu4arxoircia1lpDe iei;s)t2uo(m oodomen nvta( aDrru o;t1teenmi3iaslaDumuvs;t)trtnif iatfa r nvilt)s2to(o3io1ll n ncsl(faDra(r ;o1aleo fetas sDuln snt) lxnxr oo1lm eluei;t)trtmio iydam n net sfs2rrump;u4opeo f3iysls uanms;() ltrmrcoa1omt aivi ( t2xm(o3ny4optn ncsas) ruau p;u1aetoiicilt s2ua( s (4areoxoctodfpDeliei s t2xrxopno1olenmivtl(  2trx  ot4apxomiciydfaDemump;(4aetnmo oy1omt aues t) eto(r ou1olt lfvsas) 2ra(mp;o0tltn iciysla rmu p (0tetomrcoytopDr i s s0s2uoxopoo4lm eliesa() Dra(m ;u0aex ifetytfmDuauvp t) ltnio3tadom e iei;t s2xrir3iy1lltnliesatfaDrrur no1tlx miciytlm2eau snu)areoxr3oodlp rauei;(0seuriopiodlm elfvtas) Dumxmoot1apeo icilsfs2rlnmo u0artomf iatoa   ies;()t2uoxm iu4lmtelivtas a2ur(rooo0optn fciadlm rau o u0 rtnio3todfpDe nvi;s0srxm(m oudlmtemivtl(  Dta(ront4tpeoifciadfmDul( s u0teenmrcio1oa  li s;t s2toio3ny4omtemfvs (fs2uau oou1oleo i3tys m rm( p u)trtomf3oytoatrlueils) 2xriopnu4aleelietltfa2rm(m ot0oex ioeilt a2ua( on(4 rxrmo3io1optr nvi t)t2um(r nu1lmeeliet t a2um( pno0tlt  i3tltfmDranvo;t0 exrxo iatlp  lues t0texm(o nodomt mneil(faDrm( pou4olt mieiydfm2rmuvp (0aeerxr tydfaDr ivo;s)t2urxo3iodam  micsls)arua(mpoo0aexomiciys sDumnmo t)aeeomrcoy1lmteanvols0 rxm(rpoo4llt lneil() Dra( o;u1tetnio3tltls2umu s u4 lxomr tydlmteaiei ( sexr(r iu1omenlfviat) Dtm(r no4tpe mietasfm2rm(vonu0aetoiociodopDelu i;s)srxm(opoy1alt licslsf rtau  ou4oltomf3iyslsDumnvo;(4 exrif io1faDean o t0 eurirpnudoptnmnvslsf 2uax ooo4tleo i3iysla2ua(mon() exnxr to1lptelnvi ( t2xr(mpny1lmtnlfetlt) rtmxm nt1apenioeiad m2ua( s;t0trtrmfcty1lm ran slt s2tmxrpiu4ap emivs t)a2tm(mpno0olx  i3iys a2rl( p u0texrir3iydoatraivi;s)t2xrxopnu4altn fci s sDua(rpno4opxoiocias s2rluvp;t0 eermfcoodlmtran i;()sruo(o oo4op  lfeiasfarrmxr nt1tlt ifeiyd s raumsn(0arxnmf oatoaD aneo;s0trur(r nydlmen fcsa(fsDtrum oo4aet ioctadfm umnvs;() eeomf3io1opDr n o;(  2uoxr nu1omt mnvt t) Draxrpnu0tlen ieilsfa rmn p;t0 rxrio3iadlmt  ivs;t  etrio oy1ll e neias aDtmur nt1apt miciadla2umn p;t4alxnmr3oatlat luvs;s tetoxopnydlme miviltfs2rm(mpnu0oleo ocilsfs eanms u)aleoif iytom e neils0srxm(r oo4om  lfei sf Draurpou4oexn o3iadfm ea(vont4artoiocia1latr iei;t  rxrxr3oy4lle mivt (fartr( pno0oet ifciyt s2emumsnt0teenxo3iy1lm  aieo;t) exmxrpoo1op  lncs s) Dra( oot1apxomieiys mDua(ms u0 rtnir tatlat anvsl( t2xoim nu4alte ncias)s2um(ront0aptoii3tadlm elu s t0 rermr oatla  auvs s  rxm(r oo4altemies () ruau pnu0apxomo3tlsfm ranvp;t0arxnmrcta1fm rauvo;t srxriopnu4omtemfesat)a2umumpnt1aeeo i3iadfs2rluvs;()trtnmociodopteai o;t0 rxo(opiudaptelfetlt)a2taxmpnu0aexoifeiysfa2rln p u4 reoir todlaD aiesls) rurio iudape mneslt)a2tmuro;t4oee  fcildfa2ua(vp;t) eeomo3iatlat  ivsl(0s2xmiopiu4aptelieiltfa2uru ooo4tlxnio3ildla eluvs ()tlxrmocto1omte u i;( s2urxopiudlltelfctlsf rtm(mo;t1optniociys a2ua(vp;(0tlenif oydfatean o;t0teuoxo3iy4olenlnetls a2rm(ront0tpe  o3ilsla2ua( s u4aetomo3oatlm   i o;s  rtrimpno1alenmnvias srrrxr nt0opeo o3tasfs um(vsn()aeerxf3to1opDrlnei;s trxm(mpiy4ll  mictas)artmxrpnt1teen fctydfs2ul(mp (4 exnmr3tydfptelues;t0s2trirpnu4lle lnctls)aDrrx  ot1apeniieiadls2rl(vo;u)trxoxrcoytopDeanvs () rxrxr ny4opeemnvsl(f Dta(r ot0opx ioctytlm2um(vo u0tetoxf tydlp raneils0srxrio3oodomeemietls) Drm(moot1tpx io3iytfsDrm(mp (0 ltrir oo1fpD  nes s teumxo nu1ll  mneia( aDua(mp;t0teenioetasls emuvpnu)aetoif oo1fpDe nvi;t  rxrxo oy1ape mietlsfa2tmurpoo1apx mi3iysfaDem( o t0trtnmo3iadopDeauei;t)teurxmpno4omte nesas  2uaumpou4tetnmo3ilslsDul(vsnu)aetrmo ty1oaD lneol(  eumiopiu1lm  licta(fa2ra(m oo0oexomociadfm emn s t)texoxo io1oa elueolt0trxmimpno1llt  ivi tfs2umumpnu4opeoii3tldlaDemnvs (4aexomr oodfa e uvils  etm(o ou1lmenliet s) 2ra(rpoo1tlenioetadfs raump ()artoirctotlm e nvil( setmim no4oltn nvsasfarua(rpoo0opxn iciytfa ua( on(0 rtrxo3ta1omteaivilt s2ur(r ou1amtnmnet s) 2tmuro;o4alx mfciytfa uluvs;u) exrxrcoadlmtrluvslt  etmxm iydale mfctas)artr(mpou0opxomocildfa2ranvon(0 rxnif oatomDe ieols seum(o3iy4ll e ncsls)s2umu o;u4alxo ictaslaDrluvp u0tltrir3todfmteau o;t) etoxmpiudal e ivt ( srtmxmpou1apeo ietldfaDelump;u0 ltnxf3iadfatran i;t) exm(m3io1ope  fcia( aDum(mpot0ale ii3iatls ra(von()artnxoctodfmD  nvs ()tetrir iydoltelfcsa()aDuax onu4ope  o3ild s rmuvo;t4alxrirciatfp eanvi () rtmio3no4am  liviatfsDua(r ;o0tleomfetld m2ea( on(0 eeoirctadomt  uesls teur(m iodolenlfvta()a2um(moot1tlt ii3tld s2ean p (4 exrxr tadlm rlu ils)sexmiopio1lptelfvsa(  Dtaxrono1ole  f3iatlaDrln o (0aeeoxfctytlpteanvils0teurio oo1ope lncias)a2rrur nu0altniietadlaDum(mo u)trerir ootfpDe i s;s)tetrir3nydoltnmfvi s)sDua(r oo0aptnmf3iytla2elu pn()artoxr3tydfm e ieo t) 2uo(o3iy1amenlnvtas a2um(r ;o0olx mieiltfa uluvont4alenio oytop r uei;s0t2umxmpnu1lp  mfcils sruaum nt4tpx ifcilslmDulnms t)tltrir oy1la eanei;s  2xrxrpiodomee net () Dtr(rpot1ale ifctldla2ul(vp;t0artnio3oy1lat lueo;s)srxoxopiu1ap   icsa()aDua( oou1apt miciatlm eanvo;(0aexrmr3iotop ranes s  etrim iu4al elieslt  Drmx pot4tet mietad m ua(monu0artrxfciy1fpt li olt sexmiopiudapeemnviat)srurur ;u1apt  ocildla uluvp;(0tetrmr ootopDr n ils)trtr(m3iy1ap emnct ( s2raxrpoo1aptniicilt a2em(mo t0 rxrio ta1oa r ivs;t) 2xm(mpnu1llen icsl() Dur(mpou0aleomicias m2ea(mo u0aetomf tytlmtrlivi;( tetr(m iudllt  ictls s2umxm no4tlenio3iydfs eaumsnu4trtnmfcoodlmt  iei () eumxopou4al nlnvs t) rrr(m ou0aet miciyslsDua(mpnt0altnxoctadfaDr uvi;(0srxm(o3ny4lpe micslt)s2uaxm ;u4oeeomieiadls2rm(mp;(0tltrmrcoy1la  lueil( t2trxr oudamte nvsltfaDuaxmpnt1aexnioctls mDrm(mp;(0 ltnxo iy1lmDelu sls0s2toxm ny4ale mivsl( artauro;u0opto fciltfm2rmnmsn(4tleoir oadlmtr nvsls srxmim3oodale lnctl(  2tr(r ;u4alxomi3ildlmDemn snt) eeomo3iotlmt ln ilt  exrir no1op nlnci t)sDumur nt1apt mieiatla2ulu o u4trenxf3oo1fmt  ivo t)seurir io4om  mici t sDtru o;o4oeeomi3ilsfaDel(mp (0trxrxo3tytfmtranvo;()srto(opnydlptn fvtat) rtmxroot4oeeniiciasla2rl( p t0 etrmo3iadomt lnvs;t0truoio3oy4ome  nct s aDurxmooo1opxnif3tys aDulumo;(0 rerxo oadfa   ieilt teto(rpoudom nlfvi s a2tr(mpoo0tpxoio3iys m el(msn(0aetomfcoadoa eanvil() rur(r3nudop n ivilt a2um(r oo1altn ieiyt sDul(vsnu)trenircoydlm  ln s;() 2tm(o iy1am n iei () rtrx pno4alxn ieiasfa ea(mp u)artoxo3oy1lpt livo s0 2xoxo3no1apenmiei tfaruaxmo;o1aetoioctydlsDulnvsnu0trxrif iydopD anvs;s)texmim oo4lpe lneia(faDrmum ou1apeomfetysfmDuanvs (4texnmrcta1fa r nvs (0srum(rpou1lmtnmiesl(fartru poo4apeomfetatfa rmu o;t0 lxoxr3ty1opteaies;t0s2xm(m3oodapt mfcsat)sDtr(m oo0tetniictldla emnmsnu) lxnmoctatoa  ai o;s  2toimpiy1olt lnesas)s2rmurp;o4oex mictld m2rau p (4texrxr ty1oaDeaiei;t)trxo(o3iy4ole liesltfsrtm( p;t0tpenmfciytla2uau on()aexnir iotfaD  ueo;t0teurxr oy4lm nlietls) rtr(mpnt4apxo ieiyslmDem(ms;t)aeeomr oo1fpDeln o;()setoimpoy1lp  livia(f 2uauronu4tee io3ild sDumumon(4texrxrctodlpDrlnvils tetm(opoodomt lies ( s2tmurp;t1oetnio3iydla2ulu sn(0trenxr tydopt lueol()srtrio iydam   nvsa(  Dtr(r nu1oeeomf3iaslm2elums t4areoif oa1op r uvolt0srtr(opoo1ap nlnet t arrrxrooo0tltnio3iatfaDraumont0tltrmr3ia1latrlu olt)srtrio3iu4olt livia( aDua(monu1apt mo3tys a2rln p t)aeenmrcio1opDrlneilt0sruoxo3iu1aptnmiviat)sDrm(mpot0teen fciysfs2em(vs u)tetoxr ootfa eanesls  rxm(o3iudlleemfvi sfarum(r ;u4ale iiciyd a rmnvpnu4arxnmf oadom  au s;t0 2uo(rpio1altemncsl(faDtax o;t1texn ociad s rlnvpn() ltnmr oytoa   ieo;t t2uoimpnudlptn fetls) 2tmxm oo4aex  i3ilsfs2eln s;u)altrmf3iotoat auvo s) exmim3ny1al nlnctasf ruaxro;o4alx mfciyd s eaumo;u)aetoif oo1lateau olt0 2xrxr3no4ol emfvias)arum(r ;t0oltnii3tldfs ua( ont4tltrmo iatfaDrluesl( setoxopiydaltnlnesa()sDuau pou0aetn f3tytla ua(vpn()aeenmociodfaDr ueil()srtoxm3iy4optnlicil(fs2um(ront0aexn feiyd s eanmp;u)areoif iatom  anesl()sexm(r3oo1altn ncs () rumx  nt0aptn iciaslm rl(vs () lxriocty1fateanvi;t0srtrxo3iodlltnlncils)s2rmur nu4oltn fcildfmDul( s;(0tltnxocio1oaD aivs;(0srtoxmpou4oleelnciasfa2trx o;t0aexnif3tld m2el(msnu0tetrioctodfp eluvo s0teto(o nodop n ncsa(f rrm(  nt4aetomoeiyt s2rmumo t)tlxrxf tatom  luvil(0tetmxo oodome mies sfa2raxmo;o4oeeoifeiadls rlu p;t)arenio oatoa  li o s0trtoio nodolt mivt (f Dumx  oo0opxoii3iyd aDuanms;(4trxoxr3tydomt  uvi;(0sexm(m3iy1olee fvt s  Drmxrpno0apen f3iat mDem(mpnu4 rxrio oy1laD  n il() rtr(o ou4lpen ics t)sDtax o;u1oleo f3tatlsDeanmo u)texnxo3ty1oa elueils)srtrxrpnodoleemieta() Dtru p;t1tetomictldlsDulnmo;(4 exoxr3iatfaD  nei t) eto(o3no4aptelnetatfs2rr(mp;t0oeenmfeias a elnvpnu)treoif3tadopD  n s;s0 2urir io1lptelfes sf 2umuroot1opt  oetytlaDumu pnu)arenmrcio1fm r uvol()t2umiopnodlle  icsas  Draump;o1teeoifciatla2uauvsnu0trxrxr iotlmD lnvi;s)seuoir oodlpenmivt s srtaumono0alxnio3iltlm uln sn(4trenir3iotopt au sl()t2um(r nodamt mnvtl(fs2umxmo;u4oeeomoctys mDeluvs;u4 ltomfctydomDran s t teuoxr3oodlmee ivi s  2rau ooo0optn fcilslm ea(mpn(0teerxocoadlp  lneo;()s2um(r3io1apte ies (f Dur( p;t1alen ieiysla ranms (4aetnxo oo1omt lnvsls trtrxr nodopenlfviltf 2tmur nu4aeeomo3tls aDemu s t)texoxo3ootfpt aivols)sruo(r3ou4ol e nei tfsrtrumpno0apeniieiydfsDumnms u0aeerxf3oydlm rlnvo s0trxmiopoo4lp   netatf Dumuronu4oex mociadla uan s ()arxomf3tydfa rlivi;t  etmir3nodlm elnetls)sDtm( ont4tlenmocias m2ua( pn(4 leoxf3iydlp eaies;t)t2toirpiudap  lici s aDrrxm ou4olt  i3iadlmDulnmp;t0altoio3ia1lm  an o s)tetm(o oo1lptn neil(f Dtmxr ;u1tpxnmociltlm2raump t) rerxrcio1latr uvs (0t2xrirpoodomt  nesas aDtaumpot1aleomf3iydfm em(vs t4trxrxr iydopDrlnei t  rxmio oy4ope mnesat)a2uaxrpnt4texo fetys aDul(vont0texrmo io1omD  ieo t0 2tmir3oydol   ictls) rrmurp;u0opeo feiytls2em( o u) etnmo3iatlaD  uvs s) 2toim3oo4lpt  fcsasfa2ta(mpnu4aetnmfciadlm elu pnu) eeoxo tadomD anvs (  2urxrpiu4om   iesl()srrrx onu0aet iictaslsDrm( p u4tlenmfcia1fm eaneilt  etrirpnydameelfvtlt  Dra(rp;t1opxn i3tldfm2rmumo;t0alxnmo oadfat  uvs;s) rtrir oo1amenlics tf 2urxmpoo0olto oetysfmDra(mp;u4areomo oatlpDe ieo;s) 2trxrpoo1altnlfcs s)s2ur( poo1oltoioetysla ua(vs;()tltoxf iadlpDelu o (0s2to(rpiydamt mics (f 2rmxmpnu1tptoif3tytfa2raums;()aexrio oa1faD lnvi s texmir3iu4ap emfvia(fs2tru oou1tee  fciadfa rl( s ()tlxnmr iydlmt lneo t)s2umxopny1aleemici t)a2uaur ou1aexo o3iytfaDeau on(4aeenif oa1fm   u s;s)t2xoio iudolt mics s)aDrm(mp;t1oeeoii3ilslm rlu p;(4aexoifciy1fatr n s t)texr(m3nydomen fcilt s2urx p;u0tet mi3iltfsDeln on(4 lerxfcia1fpteaieslt0 euoirpnodaltemnetasf 2rrumono1aex moetyd sDul(vpnu4 rxrir3iydlp rauvs;s0 etrxrpoy4op  mfetl(farrmxmp;t0aex  i3tasfaDrl( p;u0trxnmo oydomDeaiesl( setrxopoodlpeemieia()a2ra( pot1texoio3ilsfaDea(mo;(0aetomrcoodlmt ln sl(0t2xo(m3nydopee icil() rtau ono1apenifeiad sDulu p;u0aeenxr oa1fpD  neil(0 2toio nudaltn ici s  Dtrur oo4tpenmf3tld a rlumsnu4tleniocoydfa eauvsls)t2um(rpnudomee fvta(fsDumu ono4oetnifeiytlsDraumpnu0 rtrmo iotfp eauvols) eto(r3nu1ape lnet tf 2ta(mpnt4apxoio3iasfs2emu snu0 exnir3io1oa elieslt srumxr3oydamte ncs t  Dtmumont0oex  fciltls rlnvs;()tlenir tatfmD aivi (0trumiopnydol nmfci t s2trx p;t0opeomiciytlm rm(mp;t0arxrxo todopDrluvs;t)teuoxr oodapen feiasfsrta( pno0tlxn ociad s2rmump;(4 ltnxf3iadfat  u i;(0tetmir ou1lptnmici t srur(rp;o4opxnmoetyd m umnmsn()altrxo3iy1oaDeauvslt)t2uoxm3nodom n fviasfsrtaxr nu4tpe  oeiadlm rmnmo;t) eermo3iotopDeanvs (0sruriopnodapt mivta()arra(m nt4tptn fetls aDraums t4 etoxf oo1faD luvo s trxrir nodamtnmivi ( aDuaumont1oltoiiciysfmDrmnmo t)tltnircta1oat  nei;s) rurxo3oo1ame  ictas) rur(rpno0alxomo3tadfm2rl(mp;u0aexomr to1laDe i o ()t2xmiopoo1am nmict s a2truro;o0tlxnmf3tlsfs ul( p;()artnifciadfa rlnvi s) eumxrpoydlmtemnvsls) rumurpoo4ape moeiad aDrm(mp () leoxf oytlmtraues (0sexrxrpno1olee nvt s arumx ont0apxn oeiadlsDuanvp;()altomo3to1lm e uesl()teuoio iu4ap elnei (  Drruront4oex  ocildfs uanvont0trenif ia1fmtr n sl(0s2to(opio1lltelnvt ( s2raumono0optoifcils sDrlnmon(4 etnif3io1fpD ln s s srxmirpno4alt mnct s a2ur(mono0opeomi3iytfa2rm(vo t4 lenmo3oadoaDe i il( trxo(m3nudamenlnvil( aDrm(r nt1tle iocilt a umnvo ()alenir tatlm e uvi;s)s2xr(opiodap nmfcsas s2raumonu1aptomoetlt aDel(ms;u4altoiocoadfptean ils) ruo(mpno4aptnmies () 2tm(r ;u0aetnmf3tyslmDrm(mo u4 lxnxo ootfp r u sls  rtoimpnydlmen net ( sDumu pno0ale  oeiys a2ea(vo (0texnioctydoa   ivsl( s2xriopny1apt  fesls)aDrrxr ;o0oeeomoctyd sDem(mp;u) etrxrcoytlm  aueo t s2xr(opnydomtelneta()sDta(moot4tpen f3iyt a2eln s;t)altnxo3iotfmtrluvi;(0texr(opoodop emictls srrax  nu1oetnmo3ildfs raumo (4 lxnir todopt lueo;s t2tmxopou1aptnlnvtls) 2urxr no1aetnio3tltfs2eanvo;t4tltnmo oytomtran ols)t2trxopio4omenmfei sfa2rruront1oexnii3iatfa2ua(ms;(0tlermoctytlpDrlnvo;(0 exm(r3iy1amtelfcsas artmumooo1oet  feiydfmDuau s u4tlxrmf3oo1op  auvi ( setm(o3no1opeelfei (fartmu ont4olxnmieiadfaDumu s u)trxnir oytfmDeli s;(0t2xrim3ou1lpe lnetlsf 2umump;u0oltnmoctlslmDrmu pnt) etoxociadfp elueilt0srur(o iydom nmicsls  Dta(m ;u0tetoio3tls s2ulnvs;u) ltoxr3iydlm  an s;s)s2xmxrpiu1omtn iesl(fs2rmumoot1aex iieiasla2emnvsn(4aeenxfcoydla  lnes t)trtm(o nodoptn fet (  2rm( oou1aeeoifciydfs2ul(vs t0texoxf ia1faD luvs;()teumio3iydlmtemfeias  Dtaumpou4texoifeilslmDrln onu) rerxr iy1lmte n o t0 2umirpoy4ameemnciasfsDur(moou1texnmfeild mDuan s;(4tleomf oytfateauei t srtmxrpoudoptelnetls arrmumpot4opxnii3ils s uaumonu4 lxomf3ia1omDr uvo;(  etoio3io1om nlfvtltfaDtmxroou0tpx mo3tltfsDuanmo;t0aetnifciydfmDrauesls0tetrxo oudomteliei t a2trur ou0tex moeiadfaDuau p;t4tltomf3oadlm e u i;s0 etm(o3nydlmtnliesas)srrmu pnu0tet if3ilt s ra(mo (4 rtnxo tadom  lnvo t)t2um(r3nydope  nvi t)sDtaumpoo1olxn ieiys a ra(vp (4aexomo to1fptran s t tetmir3iydllenlncs s s2tau o;u4aeeo fcildfm ua(vs u4treoxf3iytla raies;t sexrxr3oy1lp elics s aDtmxmo;u1alx  o3tltla eanvs;t0trtomo3iy1om e ies (0seuoio ou1optnlietl(fsrur( o;o0olen ictytfaDra(ms (0 rtnmfcto1fa eaneo s) 2umxopio1lptnlnesa()sDtmumo;t4aexnmi3ilsfs emuvsn(0 exrif3iotoaD  u ilt0trxoio oy1op  lfviasfa2taxroou4optnifctad aDumuvo;t) rxrmrcto1opte nvsl( t2xmio iu4lpe liesa(  2trxrpnt4tleomoctld m2uan s;t)texnmrcoadlmDrlies;s setm(r nodameelivslsf rumu p;u4alxoiietatfaDemn sn() rxoiociatopteanvi t) eumxm oo4ape  iet (faDtrurp;u1aeeomictysfa ea(vsnu0tlermr3tadomte u o;()srtm(opnudaleelieil(f rur( o;t0tpe mo3iltls2rmnvsnu) rtnir iadlm elu ols) etrir oydape mfcsas)aDuru p;t4teeniociatls ra(vsnu4artrmrcia1optrlnvs s0 2uoxmpio4lltnlfcs s  Draxm ;u4teeoioetyslaDeaums;u)tltomociatfpt  i i t sexmxm3io1omenlfvt ()arrr( o;t1ope  ieilsfa emn s;u)aeenifctytlaDe ivi t0setmxr ou4lleemnct sfartrxr ;u4oeenii3ilsla rmu s;(4trtoxr3oodopDeln ol(0 2toirpoydlltnmfcsl(  Duaxrpou4tpe  i3ildla2uauvo;(0texnifctatlmt ln o;(0 2uoimpio4ll elfct s)artmxrp;t1tetomoeiydla el( o u4trenirciadoptelivol()tetoxr io4omt licsasfs2tm(m ;t0apt  o3ilsla2umnmo;t0tetriocoodlat an s (  etmxr3io4ap n iesas) rrr(roou0open fciytfs emu p (4trxrxr iy1la r ivil(0texrir3iydam nmnvsatf Draumpou1tlxomfeiasfaDua(vont) etrxr3tadlpD lu i;() eur(o oydameelnvtl(fsrtm( pou1ape mf3iad aDemu pnu4trtrxr3iytfpt an slt seumim3nudopt lnes s)sDra( pnu4tpenii3iydfaDran p;u) etnif tydlm eau sl(0trumxm iydlp elfeil(fsDtmxr no1aeeomoeiatla raump;t0tltnmrcoy1fmtelnvo s0srxm(m3oydll  livtl()s2um( o;u0optomi3ildfa el(vs u)aleomf io1faDeli o s)srumio nudapt  fcias  2tm(rpno1tleoiocias aDumu o;t)artomfcoa1optr iei ()t2tmxr nu4ope mivtls sDrrurp;t0apt iociadfaDuauvs t4trxomoctodlpD lu o;(0sexmio3iu1ol e feilsf Draum no0apeoii3ilslm ra(mo (4areoxf iadfp eaiei;(0s2trimpoydape  netltfarra(mooo4tex mi3ild mDul(vp u)alxrxo3ty1om e ivi;()t2xrxrpoy1opeelnesas srtr(m ot1tptnio3iys sDrmnmp u)teerio3iatfmD lieo;s srtrim io1omeemnvtas)s2trumo;u4oltomfeiydls2rmn snu0trxnxr iotfaD lnvs s0setrimpiydap emieta(fsrtrxro;u0tetn ieiasfs umnmsnu0texrif oadoaD  i o ()srxm(mpno4opeemieslt  2trx p;u0opx mfetasls2rmnmo;u0 renmo3ootfaDrauvs;(0trxrxopoudome lnvil(fsDururpnu1oltomo3iadla ranmo (0 exrxr todom r nes;(0tetmio iudol   iet s) 2ua(  ou4tet moetad a2uauvo (4aexrircoadlmD aues s  ruo(rpio1ole lfcilsf 2tm(m ot1opxn ictyt s rmnmo;(0 rxrmr3iadfa  li ilt seuriopny1lpt micsatfarumxmpnu0texn feildla2rm(vp u) eeomo3iydlaD  u s (0trxoxr3iu1oltemivtlsf ruauronu4apxn o3ilslm2emnvs;u0aetrxfciodlpDrauvo;(  eumir io4ol nmnvsa( srrmumono0alx ii3ilt a2rm(vp u0 exrxf3tatlaD lneslt)t2toir iu1lle miesls) rumu onu1tle iociys mDulump;u0 rerxrctydom elnei;s0t2ur(m3oo1lltnmiei ( srurx  ;o0tpt mi3ilsfs ua(msnt0trtrmr3iodom rlnvilt) exoir3no4ap  lfcsas srurxro;t4teenmf3tydfmDranmp;u0altomo3ia1fatelu s () etrxm3iodolenmictasfa2tmu pnt1oetnmfcias a emump;(0trtnmrcoatfptr u il()texrxmpoudomtemfcilsf 2ta( p;u4aetoioctydlm rmu o (4aeeomr3iydlmD  i o s t2toiopiu1lpeemfvsa()arrau p;o1tpxo oeiadfa2um(vsnu0trtnxfcoy1fate i i;(0 rur(r3iu4lmtemieslsfsrua( ono4tltomoctls aDrm(vsn(4teeomfciotlm elnvi t) 2urxr3oo1lmtn fvt t sDtrx  ot1aet mo3tys a ulnvs;u)areomrcoatlaD lneo;s0srtr(o3oudomt lfvtl(faDtrumpoo4tlxnmo3iasfa2um( p;t0texrif3ia1lp ranvo;t  rtrio oy4alt lici sfa2trxm ot4olx mociytfa2rm( pnt4 leoifctydfpDeaieol(  rurxr3io4lptn fvsl(farur(mpnu4texoiictysfs rmuvo;()arenmo3iydlmD aneil()setmxm iudoptnmneils)sDtaxr ;o0tpenifciltfsDrln snu) etrmo3iydfm e nvo;(  rtr(o3iu1alt mfvsltf 2tm(  no1tetoii3tad m2eln snu0 ltrxfctotfaD ai il( s2trxm3oudapenlnvt t  Drmum oo1optnmfcildlaDul(mo u0trtomrcto1faDrluvols)t2umim3iudomt mfcsa()aDtaum ;u0optniieilsfs um( p (0 exoxociytfaDraues;t0t2trimpoo1om nmics s)a2tm(mo;u0tpeo ictldfaDua( s (0tlxnmo3tydlp  luei s0teuoimpnudlmenmfcsltf rurxm oo4aex if3tasls emu s u0tlxnxr3ta1fatr ueo;t0srumxmpou4lmtemnvsl( sDrm(mooo0altnii3ilslm2rmu o ()tetrmo oodlpDr i o s)trxoxrpiudapt mnvilt) 2rrxmoou0apxo oeiyt sDumu s u0 leoxr3tadlatraivi;s  etrimpnodoptelfcsas) 2trxrpoo4aetniicildls2em(msn() eeomociodop  lnvi;s)s2xmir oodalee ivs s)aDraur ;o1alxo fciytfaDrmnms;()tltoxo tytfmteauvi () rurxr oo1lpt  ivt s s2tmxr ou1optnmfeiysfm2ul( o;u0 ltnmf3oodla elieo t0 2trio oy4omtn fct (fa2raumono0oexn o3tlslaDea( o u) lenmr3iotfmteau s t0teumxm3iudamtn ivslt) 2rm( p;o4apenifctasfs2elnms;(4trtoxf oa1fpteaivi;(0trtoim oy1lptn ieslt)srur( pou4teeomfetadfs uanvont4trtnmo to1fmD au i s0 eur(r3oo1ol elicil()sDrr(mo;o4tlxomi3taslm ua(vsn(4alerxo3todop  lieslt) 2xr(m oo1lmen ieilsf Drmx poo4tex ifeildfa em( p;()altoif ta1lmDe uvo t)teumir3io4amt  nct (fsDraumo;u0alt mfeiasfs2rau s;t0arxnxociotfa elu sl(0 rtr(opoo4amtnlivtatf rraur ;t1apto i3iatla2elnvs;u0texnmrcty1fmDrlneo;(0 rur(rpny1amtemneil(f 2umxro;u0aeeniiciad a emuvs (0artrmr ta1om rlieols  etmxr oy4llen nvil(  rtru oou0apeoio3iydfsDrmn o;t)alerxfcoatlmteai o;t  exrimpiudop   ivsas)sruaxmpot4altnif3iys a emn o;()teeomrciydfptelieo s  rur(r3oy1llt mnct tf 2rr(mpnu4tlxo iciatlm ulu p;()alerio oytoaDelnei;s0s2urxr3io4omte nvil(f 2umxmp;o1tpt ifcils s2ra( p (0trtnxr oodlp rlueo;t0t2tmirpno4alte fesls srurxm ot4oexnioetys s2ran s t) ltoxocta1fa  au sls)s2umxm3iy1lleemfet tf 2ta(  no1aeeoifciyslm2rm( s (4arerxrciadopD anes;( s2tmxr3nydlmtelfciltfsrururo;t1aptnmietlt aDul(mp;(4alxnmfcto1oatrlnvilt0srxm(mpiu1lpenmnetls a2tmxm oo4tpe ifctyd a emn o u0aetrxr tatlmtranvi;t  etoxm no4ameemivi tfsDurump;o4tlenmoeilsfa rau s t0aeeoxrcoy1opDraieil(0s2xr(r3oo4ole  fctatfsrrr( pno1tpx moeilslmDrm(vp (4 lxrmr3oy1lpDrln i ()seur(mpny4lmt mici sfarumxmpou0oltoii3iatfa ran o;()aetrir3iy1fptr u olt)t2tmim iu1ap elfcilt)s2ta(r ;o1altnmietat s eaums u0 reoxo iodop elivils)texr(rpnu4ll   ncsatfartmuro;u1tetniieiasfa2el(mont)aeerir iadoat  uvsls)truoxrpnydomee fes sfsrtmu  no1tlxoio3taslm emumonu0trtnio ty1la  li s s0 2xoim ou4lpt  ics tf Dtm(ro;t4alxnmfetls m2rmnmo;(0altoirctodopD anvsl(0tetoxo3iy1lltnlnvtas)sDururp;t1olen ieiltlsDean p;t4artomf totfmt livs t s2uoim3nodamtn nvt (faDuax  ;t4teeo feias sDemn s t0alxnmo iatlmDr ieils s2xoio3oodlm e nes t sDumurpoo4opt  fciydlm2um(mp;t)alxnir3to1lp e nvi (0s2trio3oodlmenlfcil()s2uaxm ;o0tpeo oeiatls um(mp ()trermociy1faD  ies (0t2toiopio4lle lneia(fs2rrxro;u1oexn fetld sDrau o;t0trxrmr3iadoa eauvils srtoxo nydom  livs ()aDtmxm ot1tet io3iydls2emums;u0 rtrxf3oadfmteauvi;s)trurio3no4ap nlneia()s2ra(rp;u0tlxoiociyt aDumnvp;u0texrmoctytoat anvs;t0 etmim3ny1llenlfvtls s2rax  ot1oltn fciatlm2rmn snu)artrif tatlat lu olt  etrxrpoy1lpenmfvi sfa2trum ot1teeoiietld sDean ont) eerxr ta1opt aieol( trtoxr iy4lm n iei tfsrumxmo;o4aex ii3ilt a uluvp u4 lermociatopD  ivs;t s2uoir ny1optelneiatfs2ur( onu4apxo oeiadfa uaumonu4artnmo3iytlptelu olt) rxoxrpiu4op emfvt (faDuaxrpnt1oltnmi3tysla em(vonu)altrxrciodfa rai i;t0trto(o3io4lpe mnviasf Dtax o;u4aee mieiat sDumnvp ()arerio3oytfm r ues t0 rxoirpio4ol elfet sfsrur(rono4olxoiociyd s2em(mpnu0 lxoiocoodfmDr u s;s srumiopou4al  mivsl(fs2trum ;t0oexoif3ils mDea( s;(0tlenxoctydlpDrai i;(0s2xrxm3iy1lltn ictls  rtm(rpot1aeeomieiysla uanvp;t0trtoir tytopteaneo s  2urxmpio1apte fct s) 2rr(m nu0oleoio3tyt m el( pnt)trxrio iatfm raies;t  rxmio3iu4ap n iet (fartr(mpou0tetn f3tys sDuau s;t0altomo tytfmtr i o s t2um(m3nydomt mfcsls)sDrmxrpnu4olxnif3tadla uauvo;t4tleniociatfpte nvo t trxrxm nu1apee net tfsrrr(r nt4tpen ocias m2el(vpn()trxrxrcio1latraueils trxmir ou4apt  fesa()srtau ont4olxnmictat aDea( s;()alxoif3oatopt auvo;s s2tr(rpoo1lpenmnei () 2umu  oo1oex ioeiatfm2ra(vonu)tltrmr iytfmDeauvi;t srxr(r oydalen iet tfaDur( pou4tlxoif3iydla2emu p;t)tltnxr oa1lm r i s (0 rurxo nu1ll nlnctasfs2taxm no4olt ii3iatfm2rmn s;(4tleoxr oy1fmteln olt) 2trxrpiy4amtn ncsatfsDumurpou1texomfeiatlaDua(vs u)tlxnxrctatopD au s t0texoxr3ou1llenlfcs tfaDrmx p;t0tee mo3iasfs uan onu)aetnmo iytoa e nvil() 2urxm3no4amtn iviasf 2urxmp;t0aee  icils s2rmumpnt0 etoir3oa1op elivs s0s2tmxo3iy4om n fctas  rtmx pno4tlenifctad s rlnmont) rxoir3tydfmDrlu ols)texrxm ou1lmee ncs s)s2rr(monu4aet  iciasla elnvsnu4tetrxo ia1optraueils srxr(r3iy4ale lfct t) 2umxro;o4oexomfeildls2rm(mo;t)tetrmo tatlpt lneo s)t2toim3no4omeemiei s  Duru ont4optnif3iadfmDeanvo u4arxrmf oytfmtr u o;t) 2urim3oydlmt mncta( s2rr(  ;t1tptn fctys aDumu o;t0texrxf3iytlmteanesls t2uoxo oydoltnmneia(farrau  ;o1tet  oeiadfm2ua( s u0arenmrctodlpD auvi ( trxriopoy4om nlnvslt)sDtm(  oo4tlt mociysla2umnmp;t)teenioctydlm rlnei;t0t2xmio ny4lmte nvils a2ururooo4tetnio3iadla2umump t0aetomf iodfp rlieo;s0 2urxr oydomte ncs (fsrumxr nu0tpxo ociatfa eauvo t)aexomf iydfptr neol(  2urxopiu1ol nlnetat sruru p;t1oexnio3iydfs ea(vs ()aetrmr oatfmDelieols)t2xrxo oodopeemiesa()s2umxmono1tlx ifciyt aDranms;u0 rerir iodfm e u il( t2uo(r iy1ll nlivsa(fsrtrur oo0ale ioeiad aDran p t0 leoxf oy1op  auvi ( srtm(m oodlltemnvi () 2um( p;t0tlenmo3iltfm2uauvo;t4trtoir ty1lptrau ols)s2xoxm3nudam emnesas)sDtau  nt4teenio3ilslm2elums u0trenxo oadfm e ivs;t0 rtoxr nudal  lfvtls sDtmxmo;u0oeeoif3ias aDemumsnt) exoirctydopteai o s)t2xr(o3io1lptelivs ()arum(ro;o0olenif3iytls2umu s;u4 rxoxr3iadop eln i;t  etmxr3iodlm n ivi sf rum(r ot4ope  f3tydla emuvo (4alermf oy1opDean s t0sexm(o3iu1ame lnes (  2taur ot4tlx iictydfs2elnmpnu4texrmf iotfatr n olt0 2tmimpny1omtemfciat) Dua(root4apt micildfs ran o u0 lermo3iytfptrlnvolt) euoxrpiydaptemnct tfs2rmumpnu1tpt  ictadls2uau o u4 lxriocoo1oa r iei ()s2toirpnudamtnlfcs s) rumu p;u4openmfeiyd aDulnvo t)altnxocoo1om raneol()srtrim3iy4lm nlicslsfsDtru pnt0open o3tyt s uanmo;u4alxrxr iodfa raneils0teuo(r nu4lmtnlfvsas)sDur( pnu1tpxniieildls um(mon(4 ltnmf io1lp raivo t trxrir ny4op nmfvs ()srum(m ot0oee mieilt m ulumpn() exnxrcoytoaDrlieo;s)t2xr(o oydopee fcta( artm(moou1open o3iyt sDraumo u0 lxomrcty1fpt  ivo;() rurxm oodom n nei () Draur ou1open f3iysfm uln p;(0 rtnifcoatfa eaueol( s2xrir iydllen iei ( aDtmur nt0oetnifeiysla eanmsnt0aetomfcta1laD lu sls) 2tmim3no1ameelivi () 2umu p;u4aex ioeiat s ulnvo;t0tlenif3tatfp r nvslt)srxrimpno4omt  fvsas)a2tm( pno1tpxnmfeias sDuln onu4texnxr3tatfmte uvo ()teuoir3iu4opt mivtatf 2rmu  ou0aet  fcilsfmDemu onu0aetomo3oa1fa r n i s s2trim oodape lnvil( aDtaumpou4alt mocildlm ua(mp u)trenifcoodfaDranvilt)trtrio ny4ome mivtlt  2rau o;o1tpx iociydls2rl(ms;t0aexnmo3oa1opt  ueol() exrxm3io1op n icsas)s2umu  oo0tpt  o3tydfs2emnmsnu4aetoio oatfaDrau o;s teuoiopou1ale  ncil() 2rmx  ot0tltoifciysla2elnvont)trxoxo3oy1oaDeanes t0 rtmio3nudapt lnvsls s2rru oot4tpxoiieilsls2rmnmp (0 renio3iytoatranvi (0 etr(opnu1lmte fctasf Duaxroot1tlxnifciydfsDrauvo u4artnxrctydoa  lnes t0 etm(rpnudoltemnvi tfaruax  ot0tleoioctadls emuvs ()artnxr3oo1oat aueslt  eur(m oudamtnlnctls s2uaxmpnu0optnmoctldlsDelnms t4 rxoxo iytfaD  i o;()srxo(m ny1op nlies sfarrrxmpnu0tltoii3ilsfm2uaumo t4altnmr ty1om  lnvs;t)trxoxopoy1al nlfes ( sDurumoou1open i3tldla eln o u0teermo3oodfmDelnei;(0teurxr iu1alt mnvi s)sDrm(mo;u0alxo i3tasla2el(mo ()alxoxr3iydfmte u o;(0 2urxo3iy4opte nei sfs2ua( oou1alx iieias aDul( p (4trxnif iytlmteluei () 2ur(opou4om elnesl(fs2tmx pou0tetn f3iatlm eln o;u4altrmocoatlpD  u slt) euoimpny4al emnciltf rtmxrpno1texo oeiatlsDrl(vp;u0alxomr iotom rauvol(0t2trxr nodlmtn ivt s aDtr( ooo4opt ioeiyd aDemums;t)alermrcoatopt  u i;t trumxmpiydlpeemfviasfarum(mo;u1tpe mi3tatls2em(vo t0altnmfciodlpDe ues;s  exoio iy1omte nvslsfsrrru  ;u0tltoioeiydlaDuln p (0trtoircoodfm eauvo;t) rxmim iudap elncias)srrax  nu4alx mfetlsls rmn p;u4trtoxoctatlaDeanvslt0t2xo(o3iudapte ivtat s2raurp;u1olxn o3iltlsDea(vsnt) exrmf iytlm ranvslt teuo(rpnudalte fvia() 2tauront1oetnioetat aDel( pnu)aetomrcoytlaDraies ( s2trio oo4lp  lfetls) rraump;u1texnmo3iad aDrmu s;(0 renmr3totop e ivslt sexmxmpou4openlnciltfaDum( ooo4alto ictltfaDua(msnu)tltoxf3oa1opt  ues;s  rtrio ou4ll emnct ( sDrr(mo;t4alxnmo3ilt mDrmnmonu4tleoioctadfm   i i;s0trxoxm3nodapenmivsa(farurxmont4openioctatfaDrmn p t4texrirciytfp r iesls0sexrio oy1ll e nvils a2tru p;o1apxo feiltla eau pnu0treoio3todoatrln s () 2umir ny4omen fcsls  rumurpou0texoioctatfm eluvsnt)alxoio todfpteauvsl(0s2uoxopiy4amte nvt s srrmumpno1texoioctydlm ul(msn(0texnmfctydomt  iei t0teurirpiudlltemfvs sf ruaxr ou0oleoiietat s rlu s;(4artnio3tytfpD  i o () rxm(o3ny4ol n fct ( a2rr(r oo1opt if3tadfs2ulnmon()aexomo ty1fm e ues (0srxmxr3oudamte ivsas sDtaum nt1olxoif3tysla2umu pn()texrmfcoydoatr uvils trumim3oy1apeelfcia() rrr(roou1oeeniictadlm2eau o;(0aexnmfciatlateanesl()s2uoio nydlptnmnet sfarumu ono0oexomfeils a2ua( p ()arenir3iodfateai olt)seumiopio1lm  lnvt t)sruaxmpot0opxn o3ilt aDum( p;u)trtomocta1oa e n s;s) rtmxmpou1ol elicsls) rurumonu0apx io3iltlmDelnvp t0 exnmf to1faD  n o s)t2xrim3oy4amenlnesas s2rrx  ot0opxn i3iytfsDem(mpn()aeerxrcty1fmteaiei s)t2urio3nydoleelncsltfs2tau p;u4opx ioeilsla umn snt0aeenxf tytlm e neo t sexmxo iu1lpeemiviat)s2ra(mpot0aeeo ociysla2eanmp;(4areomr ty1fmDr ies t seuo(o iu1lpe  nesls a2rrxr ot1alxnmfctldls2ulump (0tltrif oy1lat luvi;s0t2ur(r iodalee fvta() Dtruro;t1tetnio3ilt a umnms u4aetnirctydlatelivo;t0 eumirpnodam  mfvsa(f 2trxrpnt1tpt mf3ilt a emnvs t)trenmr3ia1fmteln i;s srtrxmpou4olenlnvsas sDrau ont1olxo feildfsDem( p;t0aetoir3iydlm e uvo ( teurxmpnu1lpt mncs (fs2um(moot4aexn o3iltls eanmo;t0aetnxf3ia1lmD lnvsls)seur(m3iu1aptn fvilsfsruru onu0tlxo iciysfsDum(mo;(4tetomo3ootlate n o;t srumxopiydlme  nei sf 2tru pno4alenifeiat m emu pnt0tlermr3oatopt  n i t trtr(o3iodamtnmnet ()arrax  oo4oeenmiciyt a2elnvs;t0artnifctydlmDrau ils0trxmio oydap nlnciatfs2trur ou4aet  iciatls2elu p (4tlerir3iy1lmt anei;s0trtm(o3iodape mncia(f 2uaxront0aex mietatfa ulu p u0trermrcootfp elivo ()srum(rpiydlltelfetls  2tax pno0tltnmoetlsfm rm( o;t0tlxrxociodfpD luesl(0t2xrxr oydomee feias)s2tmxm ;t4ale moeildla2el(mont4 eerxociadop   n ol(0trtmirpoydomt  netls) 2rm( p;t0oetn f3tad m2umnmont) rxomrcty1om eai ol( trumio3nodllenlneils sDumu pno1tpeomfctas a2emn o u4 rxrxo oo1lmD  uvils0tetoimpoodop e nctlt)arurx o;o0aexnifeiydlm2rl(vsn(0tlxoir tydfpDr nesl(  2xmim3oy4lm  livt s artr( o;u4optnii3iasls rm(vo ()teenxrctydoa rln s t0 rum(m3oo1om  mietat a2tmu  nt4ole moetatls2elnmon()tltomfctadfmtelues;s) rumxmpiy1lp n nviat)sDuaxront1opx mfeiytlm2el(von(4arerxf3iodomDelu slt0 etm(o3ou4openlfvtl(fa2tmxm nt1aeen fctltfa rm(mp;u4arxnmr3ia1fm  aieo;( seumimpnudal   feta( aDur(ronu0aet mociysfa2ran p;t4altoxr ootlmtrau sls tetr(m3iydaptelicsltfaruaxr ;t0apeoiieiyd m emnvo;t0tlxrirctytfpDr i i;() rtr(o iodom elietls  2uau pno4ole ifctat m rluvonu) lxrifcootla eanes s)t2uo(opnu4lmt lncs tfa2rrx oou0oetomictas aDuln o u4 eeoxo3tatlmtr n sl(  2tmxopny4oltnlnctltf rrr(r ot1olxnmociytfm emnmo u) lxnir3oytopteln sl(0t2xoim3io4al n nesas s2rr( pno4tpenmo3ilt s rlnvp u4aeeomf3iytlptrlivs;s0 rurim ou4lme lfcs s) Dtrx poo0aexn feiytls ranvs;u0 lerioctatopt lnei;(  etm(opoo4oltelnctas)artax p;t4aet moetldfm2ul(mpnt4altoxr to1fm  aieslt)setr(o3oodamtnlivsl()sDtrxronu1apeoiociydfaDrmn s t4tlxnxf3oadlaDeai o;t) rurim3oo1aptn fvsls)sDum( poo0teeoio3iaslmDem( onu4trtnmocoa1omDr neolt)srur(rpou1lptelietlt  2ur(  ou0teeomoctyt sDeanmsn()tltrio oy1fate ueils0sexmim oo4omtn ivsas arrrx  no4tltn i3iydfmDulumsnu0 rerxfcootlpteau s;s) etrio oo4ale mictl(  rtru o;t0aex iicias a2ra(vo (4aexomr io1fmD aivsl(0 2toxm3nydopte nvta(farurx o;t0teen ieiyd mDuauvo;t0tlerif3oadopteln sls seto(o ny1omt mictls)sDuau pnu4aet  fciadfaDuau pn() rerir3oatfat lnvo t0srxoxmpnydap nlnvta() 2ur(rp;o1aee micils sDrmums;u0aetrifctadfpDr i sl( sexoxr oo1lm  lfeias sruaumono4opt ifciltls umnms;t)tlxoxrcia1lmD  nvs () 2ur(m oydap   netl( s2ta(rooo4oexo f3ias aDrln s;() etomr oo1fp  ln ols0seur(o iodal e ivsl(fs2umxrpnu0apt mocildla um(vonu4 rxoxfcootfptr i s t0 etr(m nodlm   nvsatfaDumumonu1tee iocilt m2rm( o;u0arermfcoatomtr n i t texmirpoo1olenlfvsls aDururp;t4oeenifctlsfa raump;u4tetrmo3tydlmDeauvol( texr(r3ou4lle mfci sfaDtrx o;t0altn oeiyslaDean o u) rxrmfcty1laDr nvil() rtmim3iydlleemiesls) Dumuro;o0aexnioeiad sDua(mo u4arxnxo3todopDr nvs;(0 2toirpoo1ol  mivslt)sDrrum nu4aeeoii3iadla2emuvp;(0aetnir3oodfpD aieo;t)texmxr oydlm nmnvs s) 2taump;u4alx  ociaslm uluvs;u)artoioctydfmDrli o t0sexoxo ou4apeemnciasf rua(mo;u1ole  o3tlsfm2rau p;t0trxrmf oy1fmtr iei ()s2ur(opiydop   ictlt sDum(m ;o0aetnmoctydls uanvs (4texnio3oy1lmDean o t0trxo(opoudlpen fvt t sDta( onu1alxomictytls2rmuvp t4tlxomrcoydop  anei s srumxrpnodamenlneta(fsDumurpot4olto o3iatla2uluvpn()trtrmo totfa r i sl( s2xoiopoo1ll e ieta() rtmurpou4aptomociyt a rmu snu4 rxnmr oytom e ivi s srxrxm3iy1optnmfvtls sDrrxmpou1apen oeiydlmDrlumo u4texrmfciytoa  au i s trumxo oo1llenlfet t srumxm ;t4tpe iietys mDumnvo ()tlxnxo ta1lateln i;( sexmxr3iudope  nci s sDrruront0ope miciytfsDel( p;t4trxrxrctodlp   ueolt0t2xriopoydoleelnct ( artau  ;o4tpto iciatla2emnmpnt0aeerxr tytfaDraivs t  2tmimpny4omeelnvtlsfaDurumo;u4olx mo3iadfm2emu s;t)artrmrctatoaD  u slt0seuo(o no1am elncsat  2rmu o;t1tpxnifctlsla2rm( p;(0aleoxf tytop   ieslt)tetmiopiudomenliet tfaDraxro;u4opto f3iltlaDean o (0aleoxr3iydfaD  i sl(0t2umim3iu4llt lncslt  rrm(r ;o0oex  fetyd sDumumo;()teerxociotlp   iei s)seurir3oodll emncilt)aDurumono1oltomieiad m2ul(vont0 rxrio3iy1la  lu i;t)trxoxmpoudolenlncta(  Dtmumpno4oleo ictldfa2um( on() etrmr iytlm r u o;( teurimpiy4apee fctltfs2tm( pno4apenmfctydfs2ranmp u4aexomo iytoatrau o s tetmir no4opeemfcsa( aDurxr ;u0tlx  ieiltfm2el(mon(0tetnifcoo1oaD  nvs;t  etoir3nodal  lict t aDrr( pno0alxo ocias aDrmn on()aleomo 
\ No newline at end of file
@@ -0,0 +1 @@
+uei;t) rtmxopoy1olte fvsls)sDrax o;u0alx mf3iatfs eaumo u0aleoxf3iodoptrau o;t)seurirpou4omen icsatf 2ur( p;u0tpenio3ilsls el(vpnu0 eenio oytomtrlieo;(0t2xr(r nodale mfctl(fsrtm(mp;o0olt mietaslm emnvo u0tetoio3ootfatrlnvs t0 etr(mpoo4opeelfesls  Durumooo1optoiociadlaDumnvs;u4tltrxf3oytoate nei t  2xr(m iu4lp e nvs t  Drau p;o1tptomfciysfmDulu onu) rxrxr iydlmtranvo t0t2xo(opoodlpenlnetat aDtaumpot4opxo i3tadlm eaump u4 rxoiocoodfatr ivs ( seur(mpiu1lm  mnctl() Drrum ;t1aexniietls m2rmu sn()tlermr to1fmDr i o ()srxrxm3ou1op elictltfaDum(  no4apxn ociatlm2ranmp u)tetrmr3oatfa r ivi;t0 2umxr3oudap nlnvsas a2umurono4altoif3ilslmDea(von() lxoxr oa1la e nvslt)t2um(mpio4lm n fciat aDrm(ro;u0opto feildfaDrm(vs t)tlxomf3ootlmD auvsls0seurio3oodapenlfvi () 2rmump;u0apx mo3iytfmDum( sn(4texomfciadom e nvo t tetoir oo4apt lncsas  2taxr ;u0teeniiciasla rauvpnu0 lxnmf ta1fpD ln ols)s2xmxopoy4lmenmnes ( a2tru  oo4aex moeiat m2eanms;u4 eerif oadlpDelivo t  rxrirpiu4am nlnctlt)sDuax p;o4alx  o3tydlm eln s;t4tleoxo3totfmDr uei s) rxmiopoy4lm emnvsltf 2tm(mpnt0aeto octasfsDumnmo;t4arxomfcoytoa eai o;t s2toxmpny1lle mnctat  2uauront0oltnmociltlsDem( snt4altrxr iytom   ies t0s2xoio iodop nlietas a2rru ooo1oexnmfcildlaDemuvs (4arxoif3ia1opDelu ols truoio3ou1am nmnesa( srur(m oo1tltomoeiyt a rauvp;(4 etoif3iytlpDr n il(0 rtrir oo1omt mneslsfartau ont1tpto octytlm2elu s t0trtnxfciydfp   ivi s)s2toxm3iu4am  mnesls  Dtrx  nt4apt mieilsla uauvsnu)arxriociadoptr nvs ( trtrio oydlm nmfeias) rrau ono0apxo f3tldlaDum(mp u0 leoxo3iatlp e ueil(0s2triopiu1ale lfcsa( artmum nt4apxn octltlaDuln o t4aexrxfciydoa rlues s)teto(o3iu1apen ictas) Dua(m ou0tex ii3ildlm eau p;u)aetrmr3iytfptr neo;s tetrim3nydop   fcsas arrrx o;u0tee  ociydfa ul( s;u0aexoif3iatop rauei s0tetoir3io1openmfcsl() rurxrp;t4tpenmoetadls2uanvsnt) lenxocio1fpDelu ol(0setrxr ny4am nmieslt a2ua(mooo1tex mocias m eln s;t)aexrxr tytoatrlivs;s0 rxo(r iydlme  icilt)a2rmxr nu0altoiocildls rl( ont)alenmo3ty1fpDr ivs s0t2trxmpiydome mfcils) 2raxroot0aee  o3iad aDuaums;u4trxrmo3oo1opt li ils sexmio3oo4amenlfesat  rtr( ono0olto f3iatfsDrau o t4altoif3iotfpD luvi;s) exr(m iodlmte icilt) rtru  nu0texomf3iatla uln ont4areomr3oy1lm  ai i;t0srxrxmpny4opeemnvsl(faDtm( onu1opt mociatfs umuvonu4tetomr iatlmDeln ols0truo(r oodaltnmnctls  Draxr ;o4opxn oetld a emnvp t0 ltnif tadom r neo t  rur(r iy1om  mncilsfarum(m oo4opxnii3tltfs elumsnu0 exomrcio1op rai olt)trxo(mpiydape lnctlt)srtrxr ot4apt ii3tlsfa umnvs;(0tltnif totfmD aieo (0t2um(m3ny1apenmicsa()sDtaumo;o0aleomf3iltfm elumont0artrir3ta1lmDeluvo;()tetrxr iu4amenmfesa(  2tm(r ot4tet  fetys sDumnmsnu4 rxnmo iotop ranes () 2trio nu4aptnmfct tfaDtr(r nt0oetnioeiadls2eau s t)tetrxfctatfm   n i ()srxoxm3oodamen icsasf rtmu  ;t4apxnmoeiatls2rm(mo t) ltrmociatfat lnes s  exmxmpiy1apte fesl(f rra(ro;u4aee iictad a em( p;(4 ltnxfcio1lmte i i;t) eum(r3nudol elnctas sDua(mpoo1tet mo3tys mDrm( s;u)tltomr ia1oaD lnei (  eum(mpoy4olt  fvt s  Dtm(  ou1tlxo iciys s um(vo;t0treomf3ty1lpDe nei t0seurxr nu4ale licil() rta(m no0aee mfeiytls2eanvs;t0 rtnirciotfm eai ol()trtmxmpou4opt  ncils)aruau  nt4oleoifeiydla2uaump;u4 rtoiocty1lp rlivo;t)trxmxm3no1al n nvta() Dtaurp;t1tle moetltfs2um( p;u0 exnmr3totfpDraivs (0t2toxopno4om   iviat)arrmxmp;t0apxoiieildfm2eln s t0aexrio3ia1faDr uei t s2xrimpny1oleemnet s sruru oou1aetomoeiltfs elnvo;t0 lxoxf iydlmt  i i;t)s2xmim3ny4apt lfvt sfsDurxmpot0oeeo o3ils aDua(mo u0tlenmf3oa1fptr u s;t  rtriopny4omenmnct s  2raxm ;o0ale mieiadla2em(mont4aexoifcootop eauvs t  2xoimpoy1lm  mncil( a2uaxrono0optn feiyd a2ran snu0 exoir oytoaDrln s;(  etm(r nodlm emnesl(fsDum(ro;u1opx io3iaslm elums (0aexrmr totlpDr ueolt trxmio oodoptelivilt)aDtm( o;o0aet ioeiasfs raump (4tlerxfctadoa rau s () 2urio3io4aptnmfetls) Duaxmpnt1tpxnifeilt m2uau o;u0arermo3to1om eaues;(  rurxmpno4opeelivias)s2raxm ot1aet ii3iatlmDrmnmont4 exnxo ty1la   neolt) euoio3iudlptnmnet t artrxrpoo4openiiciat mDrmnvo;t0aeerxocto1la  au sls)srxoxo ou1ol  lieilsfaDumumo;u4tptnii3iadfs rmnms;t4tetoir oytoptrauvilt0t2uo(r3oo4llte fvtat)s2urx oot4tpxnmfciys sDraump;(4aleoxr tydfa r nei;()trtoimpio1ol   ivtl()aDuau o;t0tle  fciadlmDrlumpnu0arxoxo oytomtrlu olt srxmir3iu1alteliei ( a2tmumonu1alxo octydfm2eanmp;(4 eeriocoa1fa  aueolt)truoxrpoodlltemnci s s2rax ont1aleoiociyd a2ra(vpnu)teenxfcoatlpDelnvil()s2urxo3nodalt lfvsa() 2rr(ro;o4apt io3iyslm eluvp;(0aetrif3oodlp rli s;s)truo(r3ou1lm nmicslsf rtr(rono1alt mf3tyt a rmnvs u0texoxfciydopDe u o;t0 exrxmpiodamtnmfeil(farurxrooo1tlt io3ilsfaDrluvpn(0tlenmrcoa1lm  anvils)tetoir iu4ole  fesatfaDrax ont1apxnioeild aDumnvs u4arxoxr3tytopt  i s t0 etmim ou1optnmneilsfarua( o;t0tpxn fcilsls2rlums;u4 ltrmf iytoat auvi s truo(o3iodaptn neilt arrm(mo;t4aet mi3tytfm ran p u0areomrciy1omtrluvsl() rxr(rpiudol   ivi (f Drmum nt4apeoif3iyd a2elnms u0alerifciodfmDraivo t) euoim3nu4al nlfcsls  Dtmx o;u0tpxnioeiyt s rl(ms t0trtrmf iy1oatrauvo ()trxoxopiodomenmncsasfa2uaxmo;o0oee ifciydlsDumums t0 etoxr3iadfptraueo;t0s2xmio3no4lltelnetas  Dtmxr oo4apeoiictysfa2rmumsnt)texomoctotoa r ueo;s0 2um(opiy4om elivsas artmxro;o1teto o3iltls um(vpnu4altrmociadfat lieo;s0t2xoxr3oo1op elics ( a2uaxmoot0aexnioctasfsDuanvo;(0aetnmfcty1fmtelivs;() rxr(o3iu4lptnmfes (  2urxm ot0oltnmoeildlaDeauvsn(0aexnirciodopt luvolt setoxr3ou4optn nvt s)a2umxmo;o0texomi3iltlsDul(msnt)artoxr3tytomt auvi;t t2to(o nydal n nciat) Dtmx  ot4tlx mf3tls a rmu sn()arxrmfctotlpDr neols0trxr(m no4llen ivsl( srurx o;o4tltnii3iltfmDumu snt0alenxf iotfa r ies;( t2uoim oodllt  fes ( srumx  nt1apxnioetad m2ulnvs u0 ltomrciadlateauei;t) exm(mpnu4lpt licsa(  Dtau pnu1optn o3tls s2ua(mp t4arenxo iytfpDranei;t0 2xrxr3iydomeelfvtlt aDuaxmoot4apx iicilsls rl( p;t4 rermoctydlpDe ueo s)teuo(o3oo1am n nvil() Dumurpot1aptn fetad m2uln sn() exomfcty1opD liei;t) 2tmxopny1lp nmivsltf rtaurp;o1aet  ietas aDrmn o;u) eeoxo3iodom rlivol()trtmxo3iu1ol   nesls srum(  oo0opeomfetydfm2umnmo;u0treomo3totoaD ln o ( trtriopoo1olt lietl()s2raur ;o4oeeniociys mDrmu s;(0artrxrciotla elues;(  rum(m3ou4aptelfei ( sDrrumono0aeeomoetad m rlu on(4altrifcoatlp r ivils)setr(r no4alen ietl(faDtmur ;t1tlto feiaslm uln o;u4texnif tydfa rln o ( t2xmiopnu4opee ncsl(fs2tm( oot0opt mi3iysla ulumpnu0 rxnxr3ty1lpD lnes ( t2uoir iu1ale mnei () rtmx  ;t0tltoioeiatfm2um(ms ()alermrciytlm   nei t teurxo3ny1ap emnetas)s2uaum nt4alx mfeiytlsDemuvonu) reomr3todlaDr i ol(  etoiopoo4llenliet ()arrr( ono4aetoio3iyslsDumnmsnu0 lxrmr3tytfptran sl( trxoirpiu4om elivsasf Dururp;o1apxo oeiytfm umumsnt) exriocoa1fpDrai i;t0 rxmiopou1optelfvi t aDrr( oot1tee  i3tas sDulnms u) ltnxrcoy1fmtrai o (0 2trxo no4aptn iei sfaDra( pno4oeenmoctysfs2uauvpnu0 etnio totom rlivs ( setm(mpny1ome lnetl()srtm( ont4aet  o3iys mDrau p;(0texnxf3tatlpDraueolt0srxoxm3ou4apt mnvi t a2rrumpoo0tpeniietyd s raumsn(0 rtnxrctydfpDeaneolt srtmxr oodllte icils)a2rr(mooo4oee  o3iatfmDeln s (4tetoxo3iatlpteauvs;(0s2xrimpoudome  ivtlsfa2tm(ro;o1tptomo3tatla ea(vp;(0tetrxfcoydlmD  i s;s t2xrim3oy4op  lfctlt s2umur nu0olxniictldfm um( o;() exniociadfa e nes (0 2toirpnudopeemnciasfa2rrxm ot4oeen oeiyd s uauvs;(0 lxoiocty1omteaivi;t) ruoxopnodapeemicil()aDrmur nt4tle moeilslmDeauvp t4altnmo tydfpt  u ils s2tmxr3oo4ap   ivtatfs2ururp;o0aleoiiciytfa2rmu snt0alxnxr3iy1lp  luesls)s2xo(m3no4lmtn ivslt)a2urxr nu4oee ioctltfa rmumo (4 etnmr iotlm rai o;s) 2xrxm3no1ll  micsatf 2uau  ot0opto f3iytls ea(mpn(0 leniocoydfptrli o;s)t2xo(m3oy4amtemivilt arurxronu4ale ifeiysfaDeanvp;t) rtrmfctodoatr ieslt  exoir oy1apt mfesl()aDrmxro;o4oee  i3tydlmDuln ont)alxrxo3oytfa  livo;s)t2xrir3iu4amte ivi s)s2um(mpno4opxo feils a2umnmo;(0 rtnmr3oo1omteanvi;(0 rto(o3ny4ol   fvias sDtrx pnu4opxoif3ias a2ua(vs;()alerxf3oy1oaDelnes t)srtmimpny1lltemnvsa(  Dtmxmp;t0tetn octldfs2umumsn()alxnxf oydfpDeanvi s)t2uoio io1amtelivsa() rumx o;u4oexnmoeiatla eaumpn()aexnmfciatfaDe u s () 2xrxmpno1om e nvi t)a2trurooo0tltn i3ildfs rm(monu4 exoxo ootfa e uvo;()trtoxo3ny4omeemictlsf Dta(rono0tpx  oetltlsDeluvs;t4teenmo3io1fm e n o s0trxm(m ny4al n iesls)a2ra(  ou4tetn o3iat s2emu s;u)texnmociadfa eluvi s sruo(m3oydlptnmncsat s2rau  ;t1tex iicilsfaDrau o u)alxrxf iadlmDe i i t) eurir nudom eliesls)a2ra(rpnt4apxo o3iadla elumpnu4arxoiocia1lp r uvils texm(o iudllenlncs tf Dtru pnu4texo ieiadfm ulumo;()texoxf iatopDr n s;s trtr(r3oy1lmeelfesas  rtrur nu1tpeomiciytfa rmnvp t4tetrmrcoadlmDelivs;(0setoio3oudlptnmncsl()a2uaurpno0teeniociyt sDra(vs;(4aeenxo3oytla rlivilt  ruoxm no1omtemfvilt a2ta(rpou0alxnmo3iat s rlnvp;(4 rermr3tydlmteaueo;( trtoxm3nodal  lfct ( a2umuroot0aetomiciasfa2ranmsn() exnif tatfmtr n ilt0t2urir iy1amee ncsltf rta( oot4apx iociasla2ra( p t4tltrirciydfmteanes t)srxo(r nudap e fcsltf Dtru pnt1opxoifetltla2em(vs u)trtrxr totlaDeln ilt t2um(r nodamte ieiasfsrrruront0ale iietasfa2eluvp u0 eenxr3ootlaDelues;t0s2umxrpiudlltnlicils artmurp;u1oeeoifctadfmDrl(vs;u4teeoxocty1faDe ieilt  rtmxrpno4lp elieil(fs2tr(moou1aetnmiciltfa2el( onu)arenio3iadoatr nvo s)seumim oo4op   fct sfa2rrxmont4optn fciyt sDea(ms t0trxrioctadom  li il()t2um(m3ny4lltemiviatfarumu ooo4oexo oetas sDranvs;u0 lxrir oy1om  lu slt)s2xr(r3oydame lfci t) Dta(  oo1oltomf3iytlaDrau o;()aexrmfcoa1fm rlivo;s srto(opiy1lleemnetlsf Dum(r ;t0alenmieiatla2em(mpnt)aleoir3todfmDe ueilt) rtrir3iy4lmte ivs s arumuroou4opx  oetatfa2eaump u)arerxr iytlaDeau ols trxo(mpoudlp nmfcta()s2rmx p;t0optomf3tat sDulu s;t)trxnxf oodopt  i ilt)setmio oy4omtnlfvtlt  Drrurono1openmfciad m2ua(msnt)tlxnmf3iatoaD  nvi;t0tetmxmpnodamtnlietasfsDumx pou4openmi3iltla emnvo;t)trtnxrcio1omteaueo t0 ruoxo iu4ol   ieslsfarumu  ou1tpxn ietat a2uanvp u4tleoxrctatlm elneo s0teur(r iudom e nciatfsDtmxronu4oetnmoeiydlm2um(ms t)trtrio iy1optelieols0srxriopnu1oltnlfcsa(f 2ta( pou1tlenioctytlm2rmnvsnu0 lxomf3oytfa ranes t seumxrpnydap  lnviat arurxm ou0aexoifeildfaDulnmo u0 eeomo iotoa eaivil() 2tr(m no4optelfvi (  Dur(ro;o1apxn oetyd mDuauvp (0 lxomfcoadop e uvi (0 2xo(o oy1am  lfesa(fsruau  ot0tetn ietlsls2rm( onu0texoxoctodopDr ieo;s0s2uo(m3iu4ll eliciasf rur(ro;o1alenioetydfm rm(mpn(0texrxo oo1oa  anei t truo(r oudaltelfviat  2raxmpnt0altnii3iltlmDrauvp;()trenxo3ootom r uei ( t2toxm3oy4opee icias)aDrax o;t4tlt  icilsfa2em(ms (0 rxnxf3iytfm eli sl(0t2xoxm3nudlm emfvt (  ruru  ;t4tleniieiysfmDumnmp;()alenmrcto1faD aivo t) ruoxo ny4ll n neilt)sDumxmp;t4optn o3iltfs2ean p t0 lxrxrcoadlpt anvo s s2uo(o3iu4altelncsls sDrmum ;u4tlxnmfctysfsDean o;t0 reriociydfat  neil(  rxr(r3ny1lm   fvt sfa2taum ;o4alenifcilslm em( o;u) etrxr ia1lat aneols  2tm(opoudamtn nvtlt)s2tmxmpou0ole io3tlsfaDrmu p;u0
\ No newline at end of file
@@ -0,0 +1 @@
+ueo s  rumio ou1am nmiviatfaDuaxrp;o0apt iieiyt m2rmnvo;u0tlxomocoodfm   n i t0setmxm nodaptn fcia( arra(m ;u0aexoif3iad sDulumon()texrmrcio1la r neil()s2to(mpiy1om   nesl(faDtr(rpot0aexoif3tltfaDrmn s (0texnifcty1lm   i o;t0 rtm(rpnudllt mncsas)srrrxrooo4tlenmoeilsla2eanms u4 etnmociadlateaiesl()s2trimpny4am n ivsatfs2uaump;t4ope moeiltla rmums;t)areoxoctotlmt lues;s) eurxm3nydome lnvsl(fa2urur ;t1ape if3iydfa ul(vo;() eermfciadopDe uvil( truoxrpiudlmenlncil(fsrtax ooo4tpenioeiasfm el(mo;t4trtoio ty1fpD  n sl( tetmirpiydlme  fci s)a2uaxmoou4aeen feiltls uan snu4aetoxr3oydfmD  uvs () exr(o nu4llt miei s)s2rrump;o4olt  i3iatls ranmp t)arerxf3oy1lmDranvs;(0t2trir3no4apt  ivi t a2tru ont4tptoiociysfa uln o u4aeeoxf tytoaD  i sls) 2tmxm iu4lle mnei t)aDrmumono4optn oetyt a2eanmp;t4artnxo oo1fm eaneils0seurxopiy4lpe  fvi tfaDtaurp;u4ole iietltlm2em(monu4teenifctytopt  n i;t)t2uo(o3oudale lfcsl(  2raxm no4apxn fciad mDumnmo;u0 leoxf3iadfa ranvo;t) eur(r iy4lmtn nct t  rraum ;o4apeoiocilt sDrl(mpnt) leoif3oy1oa  aieols  exoxr iy1om n ietltf rua( pnt4opeomo3tyd sDem( snt) lxomf oy1om r n o ( setoxmpno4ll emieilt) rrmxm ;o0oeeomictytlm em(vs (0aexoxo to1opDeluvil()teumxmpoodamt  fvil() Draxroot0opxomiciydfmDumnvp () exnxr iotfa rai i () exmxm3oo4lm  liei (f Duax  nt4aexn fcilsfa eaums;u)tlxoif iotopDrli o t)teurimpiy4lpe mncs (f rraxmp;u1ope mfetat s ea(mo (4aetnxfciodlp   uvi t  exr(o nu1ole mfvi t)a2um( pno0ape mfetltlsDulu s u4trtomrcto1op rauvo;t0 euoir ny1am e fci ( srrmxmoou0teenmi3iytfs2rmnvp;() renmo3iadlm   u sl(0srxmim iodlm elnviltfarrr( p;t1apeo f3iad mDrln pnt)teenmrciydlm  an o (0 rto(rpiu1amt mfvta( s2tr(monu0apxo fciyslm rm(vo;u4 exoiocoytoa eluvs;s t2uo(m3nu1ol nlietasf 2tm(rpnt0tpeoio3ilsfa2umu s;u)arenxoctotlmte nvs;t)s2toxm nu1ape livi t  rraumpnu0optoioetldfmDuanms;t4aexrxocto1om rluvilt)srtoio3ou4lmen fvt ( s2umump;o1aex ifciltfmDean s;t4 lxomrcoo1fa  au ol( srtmim3nu4lm   fetatfaDuaum ot4tlenmo3iatlm ea(mo;u0teenmfctydom  lues ()s2xoxr io4ome livtlt s2uaxmoou4oet ifetatlm2rm(vsn(4artomrcio1oa  aivo t)sexmir no4opee iet t)a2ua(r nt4tee  fciyt s emuvsnu)altoxf oydfpD  ivi;s texo(r iodllenlneslsf Dtaxm no0tltn o3tadls rmumo ()aexoif3iydlpD  ues;s  2toxmpoy4amtnmncsa() 2rmx  ;t1tetnifeiys a2uluvsn()arxnir3totlmDr i i;(0sruoxm iydlmenmics t)arrr(rpot1optn fciyslm2emuvo t0 renmr tatfpteaueilt0 2uoxm iudom  lfvsa(f 2ra(  ;t0olxnifcilslm2ra( p (0aleomf tatoaDrauvi s t2xo(r3iodaptnlfes t)srum(r oo0tlt ifetad mDrl(vpnt0tlxoxocty1fa r nvs (0t2xmxr iu4lle lncslt  rur(  ;u0tpe mo3iasfa rmn p t0 etrir3totfm  auvs s seum(m ou4lp  licslsfs2um(mp;t1tlxnmoctytlaDuluvont)aexoif3tadfp e u ol()trtm(mpiudlmtelivsltf 2rrxrp;u1tet mociyslm2em(vo u4 eeoifciydfp r u slt) etmxopiodlptelivias)arua(roou0oee ioeiatla2uaump;(0artrmf3tadfp   u s (0trxo(m3nydllt mnctl( a2raxr oo1aet  fctlt m2rlnmpn()trtrxf ta1fmDrli sls0 2xmxr3oudlp elnesat  2trxrpou4oltnifciydlaDua( o;t0arxrmo iatlmD lu ol( trumxr3iu1oleemfctls)aDrm( pno0texoio3tldlaDumn pnt0arenmf iodlpDrliei s sruo(o3ou4optnmfcia()srtrxr ;t1teenifetadlaDel( pn(4 rxoxr3tytlpt anvs ( srxr(m3oy4opeemfci ()srraxm no4ale if3iyd s uan snu)altnmo todlmDrai i;()tetr(o3no4ll e icil( sDtm( o;o0olxo fetls mDumumpn()trtoio totopD an olt)t2xrio ou4ape mfct s aDtm( p;u0aleomfcildfa2eanvp u4aetnir3oy1fm rlueil( tetmir3oudaleemnetas  Dumxmo;o4aeen o3tat s emn snt)altoif iy1lpDranvs s)t2ur(o oudapte ictltf 2uax pnu4tetn ictldla rmnmont0trxnir oo1op  aies;s)sexrim ny4omen ncslsfsDrmump;u4apxo fetysfa eauvpnt0tleoio3oa1laDeauvi t) 2uo(r ny1ame mictls) 2tmx  ot0oet mictysfsDul(mp;t4aetrxf totfptrluvils  etoio nydlle lnet (  2ua(monu1aexnifetltlm ua(vp t0 leoxfciy1lptrluei t0s2tr(rpio4llenmivs sfs2umu  ou4tpxoiietltfs rlnvo;t4 eeomrcoy1lp r n i;() etrio io4amtemnvi ( srum(mpnu4aeenmo3iytls uln sn(0 rtnmoctotlp raies s  eum(rpiodam   ici (fa2rax  ot4opxn iciyt mDum(ms;t)alerxr3totlmt lu sl()tetmirpnydlmtnmfetl()sDra(r ;u1oetniieiasls2ul(msnu0 rxnifcoydoate iei ()s2xoim nudamenmncsasf 2tru oou1apxn oeiaslaDelu sn(0texnxfciy1lptrlu s;s0teurio oy4lptn nctls a2uax  oo4alxnmfeiydfs eauvsnu) rxnif oodoatelivsls seuo(r no4op nmictl()a2trxro;u4oex mietad aDumuvp (0 lerifctodom raivo s0 exm(m3oudlm nlfvsls) 2rauro;t1aleomfeiadlaDumnvon(0 rxrmr3oatfm   uvs ()s2xrxm nu4ap  lfetatfsruaumpou1apx ifetatlsDrlnmp u4aeeoir iatfm  an slt0srum(m3nu1lpe micil()a2uru  ot1alto f3iltfa2uanvs;t4artomo3iytlm  aues (  2tmiopoy4olenmivsa()srumxrooo0apto octydfs uln pn(0 ltoxf3iotlat aivi;t0trxoio3iy1alte icilt) rurur ;o1olx ioctatfs2eanmpnt4aleomo3totfaDr uvi t0 2ur(m iy1lptemfviat  2tmxrpnu1apxoiiciadls2rmn ont4 exrxr3iodfaDe nei s tetmxm3oo4ole miesa(  2rmxmpoo0aeenif3tls a ea(vo;(4treoxocoydfmtr nvilt0trxoxm3iodaltn fvt (faDtrxronu0aee moeilt sDua( o;t4tetrxr tydfp e ivils0 ruo(o iy4lm e ncilsfsDrmu oou4aeenifetas sDrln p;(4 lxrxrcoatomD lnesl(0srtrir3iydlpen iesa() rtau pnt0aex if3iysfs2ua(vo;u0 rtoxfcoy1om elnei;s)trtrxopio1ol   ncias)a2um(m ot1apeoiociytlmDumu s u)aetrmfciatoa r ues;t) exm(m ou1opeelfvilt) rur(rpou0apxn oeiat mDemump;t4tlxoirctydfmD auvolt0s2xo(o3nydll  lfvsat  Dta(rp;t0teenifctydlsDrl(vp u4 etoir3totoateln i;s) eto(o3oudale lies s)arur(r ou0apxn f3tysfaDumnmsnt4 etnxo3oodoa eaivs;s)setr(rpnu4lmtelivs sfs2umu o;u1tpeoioeiyt mDrlu ont0 ltnif3oodlm  au s;s)trxr(mpoy4aptelietl()aDuaump;t1tltn oetatlmDulnmpn()alxnxrcoa1lateaivsl()t2urxrpiodlm nmfesltfsDtaumpou4tetnio3tytfmDul(vsnu0 rtnmocty1fmtrln o s) 2umxrpiy1ap emnvtat  2um(ro;u1aex ioetydfaDranvp u0 leoxocoytlpte u s;( trum(o iu4lp nlncsltfartaumpno1ale  o3iadfa2el(vpn(0trtnxo3oytoaDr neo s)t2toxm3iu4ap n nvil()arra(r oo0apxn oetltfs ran o;t0 rxrmr3iadfpt  ieol(  rtrxm3nudlpe  ivsa() 2rm( onu1tlen oeildlmDrm(vsn(4alxomo3to1fp   i sl() 2uoio3oo1ll nmiei t)sDumumpnt0texnii3tys s2ran pn(0treoir3todopDrlu sl()seumxr no1optnlfetls) 2tmumpou0ale  i3iltlmDumuvo ()tltrmr oodomt  u o;t setoiopoo4op  lnvsat) 2rr(  no1teeniicils a2ua( snt0altoxo3tatlmDr ies t0t2trxo iodam n ictls  Dumxmpnt1aleniociadlsDum(mo t4 etoiociytfate uvolt  rxm(mpiodope  nvt s) Drrx o;t1teenmf3iyslm2em(mp;u0 lxrir3iotopDraueo;s0 ruoio3io1op e ictlsfartm( pnt1tet mf3iad mDua(vpn()texoir3iatoptrlivilt s2xr(m iu4ll elfesl(f rtax oou0oet  ociyt m2emuvo u) lxnmfciy1lmD li o s srxrxr ny1omee nvt tfsDrruroou1oexn oetytlsDrluvon() renxo oy1fateluvilt) rumxo3nu4altnlnvsa(fsrum(  ot4alx  ieiasfm2ulnmo u)tlenmfciytlaD lieo;(0s2urim nydol emnvils)artr( ont4olxo oeiltfmDrl(mpn(4tetrmrcia1fa eauvsls)s2um(m iu4lptelivi s  rtr(  ;t0oltnioctytlm2rluvo t4texrxf tytfp eanes;s)seuo(r oodapen fetl() rtau o;u1aleo icild aDua(mo u4aleoxr io1fm  livi s)s2xoirpou4lp  lfcias)sDua(  ou1olenifcils a rl(vo u4tlxoxo3oydlpDrln s t)trtmir3oodlmtelnvi ()aDtr(rpou1tetomoeiadfmDemnmsn(0artnmocoydfa  aivo s)s2toio ou1ol nmnei t)sDururont0tpx  iciad s2umn s;t)aetrir3oytomtrauvi () 2umim3iodoltemfcia( sDrru  ;t4aetn feildfm2um( p t) rerir ta1oaD  iesls0t2xr(r ny4om  liesa( srrrxro;u0alxnmo3iat aDeln pn(0arxomr3iydoa elieil(0t2ur(r ny4lpe mfcs ()srtrx pno4texnmf3iadfaDemn s t0tlenmr ta1lm  aneo s0trtoiopoo4olt mietat aDum(roou4tptnioetld s rauvsnu0 ltnxr tytomt  ivols0s2urxmpiy1ol nlfvta() Durxr ;u4opt  i3iytls2rmuvont4aexnmr tatfpt  ies ( srxr(mpiodalt lfvt sfarrax oou0apxnmieiadlsDrmu pnt0trerio todfm eau ol( t2umimpnodll nlivtl(  2taxro;u4alt  oeilsfs ulumo (0 etomo tatla eauei s srurxrpiu4lpeelnvsas)sDua(  nu1oet mi3iytlm rm( o t4aeeoircty1fpt aivols0s2urxo ny4olee ieils) 2rr(rpoo4oexoiociatfm2uauvont0trtrmrciatfmt ai o t0texm(mpiu1al  lfet s)sDra( pot4tlxo i3ilt mDeau s u)treoxr tatfpte n i;s  rxmxo3oo1llt lfeil()srtmxmp;u1apt  fctatlaDumn o;(0tltoxo iatlat luei;(  exm(r oy4lme lfvi s srur(m nt1opx mi3iyd m2ra(vpnt)tetrmociotfm eauvs ()trxm(o3no1lme lfvsas)s2umxmonu4oetnmfetlsls eau s () eenmf3oy1lmt  uvsl(0t2urir ny1ll   feias)s2taxm ;t0tpenmo3tydfaDra(vo (4 rtrxf3iatla r ivo s tetmxo oydlme liei s s2um( oot0tptoifeiltlsDea(vpnu0 rxnmo iy1oa r uvs ()s2tm(r3oo1aptnmietat aDra(mo;t4tlt  fcildla2rln on(4alerirctadlp  au i;s) euoir no4ame liciasfsDtm(mo;t1aex iiciltlm2eaums;t0areomo3oy1lpteln ols) exmxm oy1ap nmnviat aDtmx  ;o4ale moeilsfm2ean p;u0 rxrio3tatopt  uvi s sexmim nodamt  fctlsfs2tmum ou1tpe ifeiyd s eanmo u) exrxfctydomt  ueo;(0 2urxo3nu1alte fcsa() rtmxr nt0tle if3ils m2eluvon(0teeomfcoo1lp e nvi;t0texm(opiydal nmfvsatf 2rmx  nu0tleomfciaslm uan o u)arenmfcoatfaDr uvo (  rxo(opnu1omtemfcsasfarrau p;t0aeeoiieildls rm(mpnt4 lxnxr3tytlmtelivols)truoxm3iudame  ics t aDraum ;t0tlt mfetld mDrm( on(0tlxoxo3iodlat livils  etmir3ou4lpee netl()sDrmumoot4ope iieiatlaDumnvonu) etnif tytfmt au slt)texrxrpoo1opt  fviatf 2uax oot4tee io3ildls umu s;u)tlerif iatoptraues;t t2umiopnydlp  lictlt)sDta(root0olenifeias m rlnmp (0aexrirciydop  lnvi s)s2xrxm3iodamt lfvsat a2ua(mo;o4oltn f3tlt a ea( p t)texoxf3oatlpD  uvi s0trxrim3iudamtn fvs (f rua(ro;t1tpeniietytlmDemnmpnu0tltnxo3iytomt livil()texm(m3ny1llenlietlt  rtmumpot4tpto i3tltfm2eluvp u0 exnxrctadfa   u slt0 euo(m3no4lp nlictasfaDurump;t1aexomf3iyt m2uau onu4arxrir oadoaD  neo (0s2xmim iy1amt livs t) Drrum nu4opeo f3iysfm2el(vs u4 eenxr3ootoa r nvols)trtoxmpno4amt mivil(f Draumo;t4tlx  ociydlm um(mp;t4artrmrcia1fp eai slt0trxmxm io4optemivtat)srurx pou4aex  i3iydla rluvsnu)altrif3ootlat  i s;() etmirpoy4amtnmnciatfa2tr( ono4aex  oetadls2el(msnt0 exnmo3iadfmD aieil(  eumio3nudape lfctls)sDtr(rp;u4aexnmf3tadlmDemnvpn()aeenxo iytoatrli olt0s2tmio3io1om nlfcsls) Drm( pno1tpenmf3tls aDuau s;(0trenmrcoatlm  aneol()srto(mpnudape  nesls) 2ta( pou1optnmfciltlm rm(vp u)aetrxocoadfm e n o t  2xr(rpou1ap elfcs t s2tru o;t4opeomfetad m rl(vs;t) lxoxf3oo1omDeluei t teum(r nu1lptemictl( s2rmuroou4tleomfeilt m um(vpn(4arxnif3tydlaD  u s t  rxrimpnydaptemfvtls srraumont4opt mociydla2ean s t)trerxf iotoptr neols0sruoirpio1lm  mics t)s2rmum ;t0apx  oeilslm2eanvs t)artomfctadoatrln o;s  euo(r3oy4amtnmfeta(fa2taxrp;o1tpen o3tyt aDum(mp t)aetnif3oodlpDe ieol()trxmio oodlpt licias)a2trxmooo1alx iiciltfm2rm( o u) etniocta1fmD lnes;s0 rxoio no1omt lnvt s  Dtmu p;t1tlxnmociatls2rlnvp (4arxoir oytla eanei;()seur(o3io4ale mnvsltf rumu onu4opxoifciydfaDuanvpn(0aleoir3oatomDrauei;t)s2uoxo io1aptnmiesls artrxr no1tlto f3tys a2uaumpn(0alermfcoa1fpDeaueolt0 rxrxm3oydaptnlieta( a2uaurp;o0tltomiciytfa2ulnvs;t)trtrircty1omteau il(0 exmir3oodlp   fcta( sDururo;u0tpe  oeiytfs emnmp t4 eenmr3oadom elnvi s) etmxo iydap  mfvs s  ruaxm ou1tpt  f3iltfm2em( on(0artnmf3ty1lpD  ieolt)t2xo(o oo1lm  mivi t)aDuru pou0apt  fciydfsDra(mp;u)tlxnmf3oytfa eanvs;t)seuoxo nu1amt liviat)srraum ou1ape mociydfa2ra( sn(0alxoif iodla   ueols  rxoxmpoy4lp e nesas) rrr(mo;o4altomf3iyt m2uan s t0 rxnxf to1om rlues s  rtrir iu4amtemfvsa()s2ta(mo;o0tee ioeiadlm2elnmo;()teeoir3oydoatrlnvi;t seuo(o iu1ap   fesl()sDururpno1tlx mo3tlslaDean s;(4trxrmrctydomDeai ol(0sruoio oo1lpen nct tf 2raur ;u4apeomf3iyslm ulnvp t0altomo3to1omD an o;s  rtrxrpnodal elici (faDraxrpoo1aexniociydfs rau s;(4aexrir3iadfp raivs t s2xrio oo1opte ivils  rtmxmoou4oexn octytfm rmnvp u) eeoxf ty1om rlivo s srto(mpny4open fcs t artaxro;u1opx ioeils m2rmnmpnt)teenir3oatlpDrlnei;( trxrimpnu1ame  iesas)arra( pnt4apxomo3tasfa umnvonu0altoifcta1fate nvi;s)srxrimpny4ame lfcta()s2tmx pnu4aptomociydfs umums ()aetrifcoa1oatranvi;s0s2xoim ou4al nmiesa()srum( pno0tlx iietld m uauvs u4arxrmo3iotoatrlivo s srxoxm ny1lptelfvsas s2urx oou0oet  o3tlsfaDul(mon(4 lermfciotlptrluvs (0texrxo3ny1al  mfes tfsDta(r ou1tle iiciydlmDemu o;u4 ltrir iy1lpte uvs;t0 2umio3ny4op  mnctas)aruru  nt4tltn i3tydlm2ra( on(4 rtrmoctotopDrlivi;()setoxmpou1lltn fvta(fa2trxmpot0ape moeiltfs2umu s;() etomrcia1fm eln sls0t2xoxopiy1llte iet () rraxmpot0tleniieils s2ranmo;u4artnifciatom  auvs;t)teuo(r3iu4ll emicia() 2ra(r oo0ale  feiatls emumonu4artoirctatfp e nesls)setmio iu1amte ncia(faDtrxro;o0alx  ieiadfa em(mp;(4 rtnxo3ootfptelnvi;( srxr(mpiy4lltnlfviasfaDtr( o;t1ale moctatfmDeanmon(4tetoxo iytfmt  ieo t0t2trxr nudlpt  ncia(  2rr(mooo4tltnii3tys s umu sn(0tlxnio3tatopte i s (0sexrxopiy1ol n ivta(f Dtrx p;u4oexoioeiadla2um( s;u4trtnxf ootlmtean s;(0t2ur(m oodamtelictlt  Drrxrp;o1oeeoifciasfa2um(ms;() etrir3tytoaDrau i;( trto(opoydol elfvsa(fsDtmxro;u1tee ifetad a2umnvs;t4arxomf3iydom eliei () rtrio ou4lm emnvt s s2ra(mpou4opt  ieilslaDuan o u0teeoxocto1fp  ln sls0 2trimpiy4ape  fvtatf rrrxroot1optn feiltfaDum(vp t) rxrmf3ootlmDe ies s0 ruoxmpnodame  ivta()s2urxmpno1oexoiietad s ul(vpnu)trermoctatfm  lu ils0srum(r3oodop nmnei t  rta( onu4altoii3iat m rlnmont0 exomf oy1fptelu o;(  rtrim iu4oltn ieta(fsDraxr oo1ope  ieiytfs2ul(vo (0trtrxo oa1fpD livil( trtmio iodamee feslsf rumu  no1opeo f3ilt s rl( o;(4 exnxr ty1omD lu i;s0teuoxm iydlmen ieils a2tmumooo4aexomiciadlmDea( on(0altnif3ia1lmteai o;( truoim3oy1ll emici () Dua(rp;u1tlt  ieilslm2ulnms ()alxrio oytfaD  u o t)sexoxopiu4op   ieta(fsrrru pou4tptnii3tltla2eaumon(0 rxrif3oodom eai i;s tetr(r3iydlp  mfvsl()s2tmx  nt0apxn f3tyt s2elums ()aleoxf3iytla eai s t)srumimpiu1aleemnvia(  Drmumpnu4aexomfctyt m2ea( s;u)arerxr3iadoa  anvi;()t2xo(mpiy4amt  ivsl()sDraur no4oex mf3iasfa uln o () rxomr tadoateaies s)s2uoxopiodlp nmivils  rtr(  nu1teeo f3tasla emnvpn()trxrmoctodlpDeliei () exrxm iydll  mivtl() 2ururonu0aet  feiyd mDuan s t4 rxnif3iydlm   i o ()trtoir oodlmen net s  rum(rpno0tee ioeiltfaDeluvsnu0altrmrciodopDe n s t truo(mpnu1lptnmncsat)srumxmpou0aeeomfeilsfm rm(vpnt0 rtnmocta1fat  i s;(0 2toim ny1ape livi ()a2umu ooo4olxniieiatla uln o u4 exnxo ootfat lnvo;s s2xrio3nu4ome mfcta(fsDtm(mo;t0tpxn oeild s ranvs;(4trenmfciadfmD auvi t t2xrxm3oo4ole mivtl( aDtrxm no0oex mi3ilsfaDul( snt0trxnxocoytfaD  u ilt sruoim ny1ol nmnvilt) Dra( onu4tpen fciysfs ean s t4tlerxo todomt lu i s  2urxm oo4al  mivsatf 2rrum no0tleoif3iysla rl(vs u4 rxoxr iy1opDeau o;(0tetr(m3ny1oltemivsa( a2rrx oou1alt  oeiydlaDrmnms t0tlenir tydopDr nvs s) exmiopiodll nlictasf 2ur(rpnu1oeto icils aDulnvon()arxnxr tadla rln i t0 2toxo3ou4lm  lfcil(f rta(  ;o4tltomf3ilt sDuauvpnu)aetrio iadfp  aneo;t t2ur(m3io4optemfvia( srtaxm ;t4aetomociytla ran pnt4 reoxr iatlm elnvol(0 etoxrpoydalt mfeil() 2rmx pnu1apx  i3iyd s2rluvo;t4tlxrmo iodoatr ivsl()trxo(r oo4aptnmnvs s) Dtaxmp;u1oeen ietltlm rluvonu4 lenmr to1lmD  n s s)tetmir3iudape lnctatf rtaxmpnu1olxn oeiltfa2ulnmo;t0artomf3tatlp e ivols)teum(m iodale mietatfsDur(ro;o4aexoifcilt a rm(vp ()texrmr oatom rlueo;t0s2xmxo3ny4omt  nes s) rumxrpno1texnifeild mDemnvs u0 rtrxociotlateluvs s0 eumxm ou4olte ivs s)s2ra(moou1aleomi3tydfs ranms u)altrxrcia1omtrluvo;s) eum(r3iodomeemfeta(f rua(  oo1apt ifciyd m2ea( sn()tlxoio totfat lnesl(0 2umxo nu4alt livta(fa2trxmo;o0olx mfeiyd sDeauvo;()aexnxr3iatlp   nvs (0 rxrirpiy1altemicias)a2rrxr ot1alx  f3tlt a2eau pn() reoxr3tadlmDelneol(  rxoio io4ll nlfcs t  rtrum ou0tpeniociltlsDul( sn(0 lenir3ta1la eaies;s0tetoxopoudlme mivias aDtm( o;t1opx mietyt m rmuvpnu)aexomo3iadlaD anvsl()s2uo(m ou1lmen nvi s)sDumxrpnu4optniietlsfm2ua(vs u)altnmoctydlaDeaneil(0s2um(o iodapte neiatfarrrxm ou4aexnifetadlsDra(msnu0teenmrciydopDr ues;t0trurim nu4olee ies tfsDrrx pnt1tptnmfciat a2elums;u0alerircoy1omte ies;s0srurir3iy4lltelfesas)aDraurp;o0opxniocilsfa2rm( p;(4trtrif3iydlmD  i o t0 2toim3iudap n feil()a2ta(mpnt0opt ioeiyt m uluvs u)alxomo3ty1lmDeli i;s  2ur(o3no4olen fvs s)aDraum ou1tpx ifciatfa emnvsnu0altnxr3oa1omt an i;t) 2xrxr3ou1ap n fetl() Dururp;o4tetnmieild sDeanvo;()teenxrctydoaDe i ilt0teuoim3ou1apenmfvilt  rtm(  no0oexo i3tytlm ulnvp;t0tlxrir tytla  anvi () 2umxm iu1lp n neta(fs2rrumonu4tpeoifctydfa umnvo t0aetrxo oatfaDeaneols seur(o3oodap elneil( aDtmxmooo0tpxoiieildlaDrln s;(0alxnxf oytoate nvils tetm(mpny1ole  fvsl() rumxmoot1apeniiciadfs2raumo (4arermo iadlp   n sl()srxr(rpiy1aleemnvi tf Draumoou4oexo o3iysfaDrmuvo t)teerxo3oodlat anei s)texr(m3iu1open ieta()aDrm(mont4apenmfetyslaDuau o;() reomo3oo1fmDraivo (0 eum(o ou1olenmfetl( s2trx  nu1aex mi3ils s umuvo t4aeeoxocoadoate u i t tetoxr iodllte ncilsfs2urxrpot1aexnif3iyt m2umumo;()tlxoxrcoo1lmDeanesl(  exo(o3ou4amenmnctlt a2tr(rp;t1ope moeiat sDrauvo;t0tltnmr3iytfpDrau i;t) rurimpnydomenlncils  Dur(rono0olxnmietadfs ulnvont)tlxoif3iatfptraieils s2umxrpou1lp   feilt) 2rmx p;u1olt  ieiyslm eanmon() exrifctytfa ranvs;()trtmio3ny1aptnlnvsls a2um(rpou1altn f3iadfa2ran pn(0 leoxf3ta1fp  livolt srxr(opio1lm n fvtl()aDuaxmooo0tltn i3tls sDrauvonu0 rtoirctodoaDraivi;t  eurirpiy1llt mics ()sDrrumoot1aetoiieiltlaDulnvp;t4alerifcio1optrai i t)trur(o nodalte iesa()srur(r no4tee  fciasls2rm( s;u) eeoio tatfpDrai o;s) euoim3iudolte ncsatfs2ra(r ;t4oex  fetlt a2umumsn(4 rerxfcty1fa r neols0teumxm iu4aptelfes t  Drmx pnu0oexomiciat a2uluvs;()arxrxo3ia1laDraiei s0t2xm(o no4lp n nvilt s2trurpno0olx if3iat m2uanmo t4tlxrifctydfm eaies ()srxr(r3no1op  lies t)sDur(mono4tpeoifciltlsDemu on(4tleomo3iadfmDeluei t trxoim oo1aleemnei sf rumuro;o0oleomoeiyd a rlu o;(4tlxrxo3oatopt  nvilt srtoxm iudlleelnvta( sDur(mo;t1olenmoctadlm2ulump ()trtoio iodlatraivs;s  2xoxmpnu1altnlicias srua(rp;o0oetoii3ilsfa ranms ()trtoif3io1fm e nvilt)trumxm oo1alen ietas sDtrurpoo0tetomictldfsDra(mp u)texnmrcoa1lp  auvi t) rxoxm3iu4openlfetat s2umumo;t0aexo octydfaDul(mp;(4alerir ty1oateli o s srtmxrpoodal  mnesl(f 2ua(moou1tpt mi3iyd m2um(vo u4trenmrcoy1oaDraues;s s2xoxo nu1lpt mfei ( s2taxr nu4teeniociydlaDulnmpnt4aetnmf3totlmDrai ilt0t2urxo io4alt mfctlt) rua(r no4oeenioeiytlaDuln ont0tlxomf ta1fa rauesls texmxopnudamtnmncil( sDtrurpot4oeeomoeiasla um(ms;t)artrxo iytlmte ueo s)tetr(opoo4lm nmnctls aDua(rpnu0olxomi3tytla rauvsn(0aetomr3oa1lm eln s ()trxr(m3io1alee nvias  2taxroot1oltomfcildfsDrmn p;u) exoiocia1lmDrluvs;s0 rurxrpou4lle lnvi ()aDuax pno4ope iieilt sDrmnvs u0tlxoxf oatla  anvs;t)tetmxm3ou1oltemivilsf 2um(  ;u0opeoio3taslaDra(mont0 etrmo to1lmtrli i s0 2xmxrpio1aleemnvt (faDtrum no4oltomfciad m2rlump t4texrmf tytom rlivs;(0t2toxm3nudol emfei (  rtaurp;t0aex  octyd sDemuvpn(4 eerio3todlpt lueols0srum(m nydlm elfvs tfa2trumpot0teto ictasfa uau p;t0teermo oydla elivo;s s2xo(m3oy4lpenlncilt)sDumur oo4tlen o3tydlaDulu o (0teeoxr3ootfm  ln o t)sexmxopno1ale  feiat s2urxr nu0olenmieiadfmDem(vp;t4 lenxrcia1fm r ieo s t2xm(r oudlp  lnctlsf rurx p;o0apxoiiciys s ul( o t4tltnxr oo1opDeai ilt)tetoir3no1altnmfctat s2ur(m nt4apx mo3ild s2rlnvp t4 eenioctadfaDrau i;(0setmiopno1openmfcsl( aDrrx p;u4tltn ieiyt s2emnvp;(0 rxnir3to1fp  lu o t)teurxm3no4apeelncsl() rua(mpno1tlxo oetatls ul(vs;t4 rtnir3ootfmtrlies (  rxmim no4altnlietat) Drmurpnt4alen iciys s uluvs;t0 eermo3oytfpDean o;t  exoxmpiodop n neilsfsDtm( poo1tetoiieiltlsDuanmpn()trerxrciotfa ranes s srum(opiy4lptn nesa( sDta(mp;o1tptnifciydlm2rmuvsn() leoir tytom e ieo (0t2urio3io1apeelieslsfs2taurp;o4apt if3iatfa eanvpnt4 eenxf ia1laDrli ils0 rtoxrpiodal e nvia() 2tru  nu0opeoiociadlm2rm(vp () leomrcoa1la  aivo ( trto(o3oy4lptnlicsls)arum( poo4olt ii3iyt m2umumpnu) etnmo3tydfm rliei ()s2ur(mpiu4omtn neil(fa2rm(r ot0tlenmfciydlsDrl(vs t) lerxrcta1laDr ueslt0 rxrim3nodalt  neiatfaDrm(monu1oeenmocildla2ra(msnu4 etoxrctytfptrauei (0trto(r3ou4ap emncilsf rra(rpnt0alxnmoetad aDumuvsnt0tlxnxf oadfatr nvs;t  exmxopou4al e ietas)srua(mooo4teeomietls a elnvs u4tlxnir iotfmD ln o;s t2xo(o oudllte fetas)s2tr( pou0alx iociaslm2em(vo;()artnmo tatlat  n sl( trtr(m3oydomtn fcs t arumxmpno4ape iiciytfaDrln snu4artoxr3ootfaDeanvi;t)srtoxopnodopen fviltfsDua( pnt4apeomieias a2rmnvs t0 lxomo3totfaDran ol(0srtmxmpoo4lme lfci t)aDrru  oo1tltomieildfa2ranvp u4teermfcoadopDe u sls)texrxo3iy1alt  fetls) rraurpno0aee if3tasfmDumu o t0tltomo iydoat lnvol(0 etmxo ou1al emfcia(farrm(  nt1tpenmieilslmDuluvs;(0artrxo3iy1laDeanvo;t)s2um(mpnu1omte icil(  rtaumpou0aexnmoctydls uauvsn()alenmf3ia1lpt li s s)t2xr(rpoy1olenlfctls)sDtr(rpno4openmieiytfmDelnms;u)arxrxrcoatlmDraivs;t0 2xr(opnudom emict (faDum( pot0tetomi3iydla2eanms;u0tleoxf iydfmtr n i s seur(rpou1amtnmfvtas) 2rr(mp;o1opxo o3tltlm emn o t0 exomr to1opt luvs;t  2xrxo ou1ale miesasfaDurum ;o4oetnioetldlm2rm( snt)arxnmo3oydlaDean ol( t2urxm3oydllen fvsltfa2tau  oo4oetn i3ilslm2emnmpnu)trtnifcto1omDr nvo (  etr(r3nodamenmicias sDra(r ot4tex iiciyd a rl(vpn(0 rxnxo3io1faDrliei;t  2uoxm iydllenmfvsat aDurxmpoo4oltomo3iltlaDran p;u4 lermr tydopD  n o;t tetoxr3iy1om  lietlt)s2tmu oou4oet  oetyt aDul(vo;()artrxo ia1lm eln ilt seurim iydomeemnet s)s2ur(ro;o4alx iieiytfa2uan p;t0tlxoxfcto1oa   nvil(0 exm(r3iu4lm n nvta()artrx ooo0aet mfctaslm elnvs;t0 leoxfciatoatrauvs t0trxr(m3ou4amt lnvt ()aDur(  ;o1ape mo3ilsls2emnmp;(0 ltomr iatfmt lneil( srxr(m nu4lltnmieslt)sDurxronu0tpe ioeiyt aDuluvs (0 lxrmr3oatlm elnes;t  exmio3oydlltnlnvt ()a2tm(  ;u0apenmictlt s2uanms;t4 rxrircty1op  lu o ( t2xr(r ou1apenlfvsl()arrauroot4oee mf3tad a el(vpnt0teenxfcto1oateaiei;t  rtr(o io4amt livs t  ruaum ou0apt if3tasfs2ranmo u)arenir iytop   u i (  eurxo3ny4ame lfvta(faDururont4tpto f3ias s2rluvp t0aetoxr tydfa   nvi;t0srxmxr oy4apen nei s) 2ur(mpno1teto o3tat s2uln p u)aexoxrcta1fmD livi;t0 eumirpiudam nlivsas)s2umu p;t4tptnif3tatlm rluvpn(4alenxo oo1omtrln i;t texrim nu4lpee nvtas)sDtm( o;u4alt io3tldls2emnmp u4trxoiocio1fpDe u ilt0 rxo(r3nudamenmnvi s) Dumumont4oet mfeiysls2uaumon(4alenxocoadlmDraues;s trum(o3nydaltnlfeil() 2ua(mo;o1ope ifcias a ul(mp;(0tetnif oadlat aues;t0setr(o3iu4llt mfcsa()sDraur ;t4teeomoctytfa rm( s ()tlerir3tatlatelneo;(  rtoio iy1ol  mivs s)srurx poo4oetoifciysfsDul(vp;u0artoio3tadfmt li s;t seuoxr3nu4om emiet ( a2urum ;o4olxo fciatls umuvp t4 rtoif3oatoa  lnes;(0t2xr(o iu4apte ici ()a2rm(  oo4apxn fciat a rlu pn(4 lxrif iadlmtran slt)seur(rpoudape lnetatf Drmumo;o4tlxo oetlt aDrm(mont)aetrir3iytfmD  uvils0trtr(m3iudll nmfeia(f rur(m no1olxomfeiysls2rmuvsnu) ltnmfctydopD anei;() etm(rpnodlmtnmfesls)a2umur nu4teenmf3iadlmDelnvon()tlxnmf tydomte ueo;()srxoxopiu1ome lnvs (f rtm(mp;t4oee  ociytlm2ul(vp t0 eenio3oatlaD li s;t)t2xm(mpoudaptnmicias)s2umu ont0oet ioctldfa2eluvp t4altoxr oy1faDeaiesls  rxmir oydlmenmiet t  rraurp;t1tlxnii3iydlm2uauvo (0tlxnxf3io1fpD aies;s  ruoir3oudam n iesat)aDuru pno4oet  ieiys sDeanms;u)teenxrcoydlmteanvi s t2toxrpno4lp  livs tfaDtmu  ;o0oeen fciys aDum(vpnt4 leoxoctadlm e uvol()trum(o nodop n iciat)srtrx  ;t0altn o3tyt m2el(vonu)teenxo3ty1opte nvsl() exm(mpny4lme  neia(  rrau  ;o0aet if3iadls2emnmon(0trtnir3oodomDelieol(0 2xmir3iodoltnlfcsl(  rtrx  no4altomfciatfsDumumont4 ltrmrcootfmDe nvslt0 rur(r oo1om  lncs t arumuront4ape mocildlaDua( p;u0altnioctodom r i olt0s2umxr iy1lm   nes (faDrmxmooo0oex  oetldfa2umuvsn()artrxocootopDelu i t) etmiopno1op  lnesl()s2rr(  ot4ole ifctytfs emn p u)tltrxfciatfm e i i;(0setr(mpiy1oltnmivils aruau poo4aexn o3ias aDel(mo t4aetomr tytomtelu s (0 rtoxm3oo1ll nlnvt ( arrmxm nt0alx  o3tyt m raump;t) exomrciytomt  ivils s2urxr3iu1ap n ncia( arrau o;t1oltn ieias mDem(vonu0 rerxo tydlaDr ivs;t)setoio3ny1oltelici t arrmx o;t0tle if3tldfa2eluvo t4 etrmf3ia1fp   uvs ()seumxm iy1al  mictat sDraur ;o1tle mfeiytla2ranmp;t0arxrxf3oytfp r uvi ()srtr(m ou4amtelieils)a2ta( o;o4teeniictldla eanmp u4 exrxo ootoa rauvs (0tetmiopoo1om n fvsl( sDrmum nt1tpx  oetys a eaump;()alerif3todlm eln o s)tetm(o iudlmt  nvsl(f rta(mpnt0tlxnmfciatfmDemuvs u0aleoxf io1om r ivols setm(o3io4lp n ieias) 2trxroot1openifeias sDrlnms;
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;s0texo(m nydoleemfcsl( sDua( ooo1tpenmiciadfaDrmnmp;t4tlxrxr3oytfp r iei;() 2uoirpiy1lm e nvils)aDurxrpnt0alxo i3ils a eln p u) ltnmrctytopt lies;t0sexrxo iu4ome mivilt)s2rmxr ou1tetn fciadlm ean p;t) rtrmo3iytomD aueslt trtr(rpnydlmtemivt ( sDtaxmoou0tlxo fetaslmDelu p u) eerxf oy1lmtelies;t0s2trio3nu4ap nlncia() Dururonu4altnifeilsfm2eauvo;(4 eermf3to1laDe u i s0 2trxr3oodlmtn fvtlt  rurxr ou0texomieilsfm um(ms;t)aleoif oy1fptean il( s2uoirpnydlpee fei ()artr(mont1tpx  ociydfmDrmnvs u0 rermocty1fateaieil(0srtr(m3ny1lme  fvtat sDtmx  ;u0oee iieiaslsDumuvp u)aetrmr3iotlp r nvo t0 rxrimpiu4am   fetl(f Dta( o;u4aptniieildlm uluvp;t)treoxfcoatlaD ln o s)tetmio iydole lnesas)srtmurpnu4teen fctldla ulnmp (0areoif ootfaDeauvil(  2xmxr iu1ap  lfcil(farrrxmo;t1aptoif3tas sDua( p;t) lxrmo oytlp e iesls)t2umxo iy1amen icsl() 2umu o;u1aptn i3tld sDelnvo (0trtoio3oydfaDraues;s)t2tr(o io1aptn ictls)artaxrp;o4olx  feiydls2el( pn(0 rerxo3oa1fp e ivs;t) exmxopio1olenmfvsl() rrmxm no1tpx ifeiatla rmnmont0aetrxrcoadom eaneo;s  rtm(m nu1ap  mictasf 2rmurp;u0oetnmfciyd a ua( s;t4 rtrmocoa1oaD anvol(0s2uo(m oo1lmenlfeta()arurumo;o0openmfciaslsDrl( ont) rermf iotfatr ivi t t2xm(r3oy1alt  fesa()a2rru  nu0aee mi3tlsls2umnmpn()trxoxf3oa1op  auei;s t2toxo3io4al elfct s sDrmxmo;t4tpenifctls aDrl(mo;u4 lxomfciadla eaieo s)t2urxr nu4ol nmnvs () 2rr( o;o4aex  oeiatfa rmu pnt)aeerioctadfmtr uei;(0 rumimpou1apeelneta(fartrxm no1tlt mictadla2rl( s t0tlxnmoctydop rlnvsls0t2tmxrpio4ole  nesl(fsrtaurpnu0tlxomietlt a2em( s;(0teenmf3tadopt aies;t  rxmxm oodomtnlicil( aDuaum ou4olt  i3tydfsDeau pnu4 reoxfciytoat auvo;t setmxrpnydomenmnct (fsDua(mpno0oet  i3iysls uau pnt)arenir3iydlpD liei;s0t2xoimpiu1ol emicilt srtax pou0opeoio3iydls ea(vo (0tltoio iotla eai o;t0 2toxmpny4aptelfetas  2tr(r ot4oee mociatla rau snu4 eermoctydfat lnvs t srumxopno1lmeelnvsat srumuront0tlxo fcilslm2rln p;u4 rxrxfcia1latrli i;()setm(opoydoptelncias  2uaur ot0opt  i3tltls umnvs t0aexoxr3todom ranvs;t0setrxmpio4omen nvs tf Dra(  nu1tet  o3ias a2rlnvs t0 lerxrcoa1opDrauvi;()trum(m iudom emics (f rtrxmo;u1tlxoiociytfsDran s;u4tltrxrciotla  aivils0teuoxr nodop nmfcil( aDtmxmoot1opx ifctltfaDeaump;(4texoio oa1fpDeau olt0texoiopio1lptnmfciat srtmuro;o4oexnmiciadfm2ulu o;u4alermf3ootopDraies;s0sexoxm3ny4op n icsat sDua(rpot1aleoioetytlaDumnvo u) rxrxf todla   n o;s0tetrir3io1al nmfcsat)arta(m ou1tlxo f3iadfm2ua( snt) lerio iy1la   n s;t teuoxo oudll e icsl(fs2rrum oo0aleo ieiatlaDul(vs;t0artomf oodlaDeln ol() rxm(rpou4opee nctls)s2uaurpot1alxoif3ilsla uauvs u4teeoif ty1lmt aueil(  2uoxmpny1op n ivslsfsDrr(moot0aee  octys a ea( o;t)tlxnxocta1fp elueols t2to(opio1om nmfvils  rurum nt0alt mociat mDrln pnu4 etrircootoa e ivo ( trxmio oo4am   icsa() Dtr( pnt1ale mo3tatlm rau p t0alxrif3oydfa r ivo ()seurxo3oodopt miviasfsDtaxrpoo4teenifetyd sDel(mont4 leomo iy1lat  uvo;(0 rtrir3oydoltn neias aDrm( ont4teenmoeiadfs ul(vs;u0tetoxocoodoaD livo s0 rtrirpiy1omt  ivtasfs2ra(mpoo0oee mfctldla2el(mpnu4 rtnir3io1fatraneo (0s2ur(rpiodalenmictat s2ua(m ou1tex  o3tasfmDul( p;u4 rerxrciotoa e uvslt0sexr(o io1amenlicilt)sDuaxrp;o1aetoio3iysfaDranvpnu0 lerioctotlmDeli olt truo(r iy1lle lfvta()aDrruroou4tlxo ietas sDrmuvs;t0alxoxr3io1laDr u olt t2xm(r oodlpenmivta( sDtmurpnu1olenmi3iltls2uluvs;u)alxnir3tadla   ieolt)teur(o oo1omeelictls a2umumoot0aexnioctldfaDean s;()teeomrctadlm eaieo;t0trtrxrpnudapenlnetlt) Dur(m ;o4tpx  oeilt aDrauvo;t0arerxr oydla  lu i;s  exo(opio1lltemfcsls  rraurpoo4aet ioeiatfs uauvp t)tlxrxrcty1oatranvs (  rtoio3no1oleelnctlt) Dur(ro;o1ale  oeiltfa2uanvs ()aexrmrcoo1lpt  nesls0teurir3nu4al   fvil()s2trxmo;u1aex ioeiyslaDra(vo;u)tlxnmocoo1oaDe ivo;()t2xmim3iudom nmncil()arurxrp;u0oexnifeiytfs ranvs t)tlenio ia1lateln i t0sexm(o3ny4alt mnct () Dur(r ;o0oltn ictaslmDrau p;u) rtrxo3oodfa eaneo t)s2xo(opiydomtn fesa(fsDuaurpoo0altomfctldls2ul(vp t4texrxf3iy1opteai o t)s2trxr iy4ol e nvsltf rurx ooo1aex moeiyslm2eln o t0 lxnmo3ootfm rauvols)seuoio3io1om  mfet t)s2umxro;o1aexn icilt aDrlu p t)arxrmr io1fp elu sls) eum(opno1omeemnvia(  Duaxmo;t1tlen ociatlmDrm(msnu4arxrmo ootfmDrlivol()srxrxo3oy4amtn ieil( s2rmum nt0apt ioeilsfs2uau s;()aetnmo3tatop e ueilt s2um(rpnydam   fctltfaDtrumono0tlxo iciasls2eauvsn(4aeeoxf iy1lmD an o s0srxoio3oudamt  fvsas) rtau  no4ole moetltlm2rlnvpnu) eenifcia1laD  uvs s) 2xm(r iu1ole lfet () Drmxro;o4tpt iicilsla rl(vpnu4aeeoxf oo1lmtrluvslt)trtmxopoy4oleelfvsatfs2urxmp;t0tltniieiltlaDrl(vpnu4tlenxocoa1oaDeaiei (0 exrxmpiu4lpen ictas) rtr(mp;t0alxnmi3iadlm umuvsn()alxomf iotfaDrli i;s0trur(m nu4lmeelnciat)a2tmxm ;u4tpto oetatfaDel( o;(4 lermf3io1oate u i (  2xmxrpno1ol n nes sfsrtr(r ot1texn o3iatfa2uanvs;t4arxrxfcoa1oaDeanvi (0s2trirpoo4lltnlicsasfsrrm(mo;t4aptoif3ilslm uanmpnt4texnmo tydla r ies t trumim nu4olt lnctas) rurur nt1teen feils aDua( onu) reoir oytlmtrln i;(0setoxrpiodoleelicslsf rtr( pot1teto oeias a ulnmsnu4artnmociadlaDean o;t)t2toimpoy1lpeemici sfs2truro;u0oeeomocild m uauvpnu0tlermrcoa1lpteluei;t) 2umim iudomtn ivslsfarrm(mooo1aee ioetysfa um(mont4 rxoio3iotlmt  ieilt tetoimpou4lme lfes (faDuau o;u4apenio3tltlmDrlnms;(4altoif3iodoaDe ieo ()trxrxm3oy4lmte fvilt  2trumpnt0ole miciasls2elumsnu4altoxf iy1lmt  ivi;s  exr(rpnu1lm emivta(  Durum no0olenmoctat aDuaump u) lxomr3oadlpD lueslt0 2xoxo oodlpen fesls)srrm(rpnu0tle  f3tysfsDuanmp;t4tetnmr3tadlm rluvi s) 2tmxmpoudom   nesatfa2rmx ont0oee  iciyd a2ra( ont0trxnir iotom rlu slt srxriopiydal e fcsat  Draur no4opeomiciyt sDrm(mp t4 etrmrciydomDeli o;t0 2um(opny1optnlfvsat)aDuax  ;u4apx  feiltfmDumn o;u0 etrifcoa1lpt  nvs (0 rxoim io4ale mfvtl(f Drm( pnt0oltomietat a umu o;u)texomociydoat li s;t0t2umxr3io1lle mfviltfs2trxmp;t4teenmfctys sDuau o u)aexoxfcoytlp ranesl(  rtrxm no4ll  lieta(f Dum(m ;o1olx mf3ildla2rm( s t0trtnmr3oodlatran sl( s2xmio io1amen netlt  rurxm no1texniieiys m2emn on() rerxfctadoa r ueo;()s2umxopoy1op   ncta( sDrrur ;t1apxnmicilt s rauvs;t0 lxnmfctatoaD ai o;t teuo(m3nu1olt mivtlt) 2uau  no4alxnio3tad a2umuvs (4tlxnxr to1fpD lueo t) 2trxr3io4lpe mfviat  2tmu o;u4ale  f3iasfm eln o;() exomocty1faDeln i t0 2tmim3ou1olen nvilt)aDumx  ;u4apenmi3tydlm rln p t)aeenir3oatla rluvils0texo(o3io1ale lfci t artaumoou4tpxo octadfaDuanvs;() eerxf tadlpDrlnvs (  exmir iy4apenmneias) rum(  no4oet  feiasfm eauvo;t0tetrmrciydfaDeauvo;s) exmxo io4ap  lfciasfartaxmono4oltn f3iyslm2emn o;() etoxr3ta1lp e nvo t)srurimpnu1omtnlnvias)a2tru  no1oltnii3tad s2uaumo u4aleriocoo1lm  anes s0teuoxopnu1lpe lfei ()artr(  ou4opx mictatls um(mpn(0 exrmoctadlmDeluei;t)s2uoxr iydop  mfvi (fs2urumo;t0oexnifeiadlmDumuvo u0 ltrxocoadla r i o;s0sexmxmpiy1optemfei (farrm( o;t1tet ii3iatfm2uluvp u4 rtrmo3tytom  luvi;s  rto(mpiu1oltnmnctlt) rumxm ;t4oex iictlslsDum( s;u0alxoio3oadop  an olt) 2tmxopiodlmenlieil( srua( p;u1olxn fcilsfs2ulums;u) lxoxocootlpD anvo;s0 euoxo nydol e fvslt) 2rauro;u1ape ifcildlaDua( p u)tltnmf3ty1lp eaneo s)t2xrxm nu1ap  mieia()a2rm(moou1oltnmiciad m uanvs;t4 renxoctatfmDeau s ( srtm(r3iydomee fvtltf Dtrx  nt0teenioeiydfm2rm( o u4 lenmociatlpDeaiei s)trxrim nodamtn nviasfaDtr(  ot4oltnif3tyt s2ulu o () reoxociadoat anei;(  rurim3nodlpt lfvt t sDuax  ;u1tet  ociaslm rlu p u) rerifcoadoatranvolt0t2xoxo3no4op nmnvsl() Dumumonu0alxomoctls s2umumo;u4trenir totfat anvs;s trtrxrpnu4llt  iei t)a2umx  ;u0alt  oeiyt m rm( o;u0teeoxo3oa1la eaneilt)sruoimpny1op  mfet s srtmu  no1alxo octysfs2rln s (0 rtoio todfatrluvs;t t2urir3io1olt lnctatfa2rru  nt4olx miciatfa2emnmo (4 rermfciydfmteaues s0trtm(r oydolt  ivsa(farrm(r ;t0aet if3ild s umump;t)trtrxf iodlp  aivi;(0 rxm(o iu4lmtelnvsa(  2ur( p;t1olt  ieiys sDua(ms;t)texoxr3oy1lm rai i;(  2umio3iydlme  nei (fsrrmx  oo0oeeo f3ilt s rl(vpn(4trermociadfm raneo;()srumir3nydlm  lnesat aDtmu  oo1aeenmieiat a2emuvp u) etrmocoatfaDrlneil(0trxm(o3iodllen nvia()aDtau  ;t4aetoiocilsfs rau p (0 rxnmfcia1lmte uvi s trxo(o oy1al e fci t sDtaumpot4apxoioctysla rm(vp;u4tetomf3oatlat auvol()setmxopny1lptelnctl(fa2um(r nu4opt iocild mDul(vsnt)trtrif3to1opDeai o s) 2trxo nu4apeelfvilt s2umxrpno4tpxnif3iysfs ulu pnt0 ltoircoy1oa  anvol( trtrxm3nu4apen nesasfsDur(mo;t0aetomfetyt mDelnvp (4 lenmf iodom  an i s)s2ur(m3nu4alt lfeilt)aDum(rp;o0ole mieiad m ulnvp (0 lxrmr iotlp  lueils0s2xrim3iu1lm n fciltfa2rrumo;t0aptnmo3iydls rlnvont4 exomocoatlpDe ivo;()trxoir no4olee ivtas s2tru oou1oltoioeilt a2uau onu) ltrxrctytfpD  nvslt) eumio3oy1lpenlicslsfs2raur ou0teen iciad a2emnmo;t4trerxr oydoaDr ueo;(0 2xrimpio4lme lietlt) rum(mpot4tpxomi3iysla2umnvsnt) rtnio iy1lpt aues;(0 2to(mpiy4lpeemfet t) rumu  oo4oleniietasfs em( s () rtomf oytlate uvi () exo(o oy4op e nvs s)aDur(mp;u4apen oetadfmDra(mp;()trtoio todlat lnei;t0teurim iu1alte ncslt s2rmu poo1oeenmoeiltla el(mp;u0alxnmo3oytom rln ils0 2xm(o3oo1ll elfesat) rtax  ;u0opt ioeiad m eanmp u0 rtrir3oatlp elnvi;s  rxmxo nu1om elnvs tfarrmu pot1opto fciytls2uanmo;t0alerir3oo1omDe ies s0s2uoir ny4ame mnviltfs2trx o;o1oltnio3iatla2ra( on(4trerxo io1lmt  neils srxmir3nodlptnlnvi (  Dtaumooo0olen icilsla rmu ont0artrmf iytfmtelneol(0trtm(r io1ol  lncs t  Dtax p;o0apenmi3iysfa2ulnmo (0 etnif io1om elnes (  etoir3iydol  miviatfaDrmumono0tee  ociltls ua(vo;t4tlxrxociotomDr ieilt)s2xr(rpoy4lm n fet sf Dtr(  nu1tptniietat m2umuvo u)texnxo todoat luesls0s2um(m oy4lptn fei t)sDraum nt4tle  o3iltfs ulnmo;t0 rxnmociy1lmD  ivo;(0t2xmxo3nydamt lietlt)s2uax poo1tleo icild sDumuvs;t)teenxf ootlm elnvsl()texoxo3ny1optnmfeta( a2rrxmonu0ape ii3iydla ea(mo;t)trxrio3ty1oaD au i t0t2ur(o oodamte fvslt) Dtaxrpot4opxomocilt m2em(mp;u0teenio3iotom e u ils)tetm(o3ou1ol e fctltfarrm(rp;o4oee  feiytfm em(vsnu)aexrmf iy1opDeau i;(0srumim oy4altn feta( srrrx p;t1oexnii3iyd sDuln snu)aleoif3oydomDr n i t t2um(opiy4lmtn fvsls) Dtaum ;t1tlto ietldfa2rlnvpnu0 rtoir3tydoa rlies (  eum(r3oydll nmnes s arrmurp;t0aeen i3tasfm rm(von(4 reomrcty1fa rln slt) exmim oodll nmfetls)srta( oot1aetn octyd sDuaumon(0alerifcoadlmt lnvsl() 2xr(rpoodope  ieil()artmxrono4alx io3tyt mDrm(msn(0artoif3iy1lpte u s;t0truoxopiodapte ncs (faDraxroot4aet  i3iatfm2ea( sn(0alenxo to1optraueo;(0 rxr(o3ou4al  lfct s) rtr(rpoo4teeo oetatfaDulumo;t) exrxo3oo1laDrlnvo t0 exmiopno1lpt liciat)a2tax o;t1opxnifcias sDelumo;u0 reomf3iytop  livi t setrxo iu1llte fciat  rtm(  nt0tlen ieilsfs2ua(mo;(4artrifcoatom e u ol()seuo(mpiy1op eliesl(farrax pno4teeoioetad aDeanmp;u) lxoif io1lmDean ols0sexmxr iodllenlicia(f 2uau pou0apxniieias a2rmu s u4artrxr ootomDeauvolt t2xoir iu4oltnmietatf Drru pnu4ape  f3iydlmDea(vo;u)tleoxr iadfm rlu ols  2ur(mpou4al elnet tfsDum(roou1tlen i3ias m umn pn()trtoxf to1oaDrluei t0trtmxr3io4lptnlici tf 2raum ou1oexnmfcilt m ea( s t0 reomo totfat  uvs;t0tetoio iudlm nmiciasfa2uru oou0oleomoeiysfs umuvsnt0arerir3iy1oaDr ivs s)t2xr(r3oudapt  fci tfsDtrxm ;u1tlx  ieiytfs2umn pnt)tlerir3oadfmD lnes;t)s2xmxm3oodomtelnvtat aDtaxr ou1optoio3iatfm umn p u0artoxfciotop r n sl()tetm(opoy1amtn fcsa() rrmxr ou1tee  ieiatfm2umn snt)aetrio iodlpD livi t  rxm(o3ou1omenlivtasfa2umxmoot4tee ii3iydla eanvp;(4 rxnxr tydopDr ueo t texr(opoodomtn icia()a2rau o;t4ole moctysfm2rmu onu0aleriocoydfateluvslt)srumir3oy1lp nlicsatfsrtmur ot4oee iieias a2em(mpnt4 rtomo3ta1omDeaueslt  rxr(o oy1ll  miesltf rumur nt4opt ifctld m2eau o t)artoxrciydlpte ues;s0 eumimpiodlmtemivsl(f Drr( p;u1teeo fciydfmDeluvp u)trtomrciy1fat  u s () 2tmio3oo4ll nmies s aDtmx ono4tlx mieiasfaDrluvpnu4 leniocoatoaD  n il( s2xrxr3oodapt mivta( aDur(rp;u4teeo ieiydfsDuluvpnt)alxomr todfmDrlieo s)sruo(m3nodopeemfcsa(fsrrru pou4aex io3ilsfa eanvo (4 lxrircoatom rai o;s)trtmxm oy4ll e feiat  Dum(  ;t4ape mieias sDul(vo (4tlxomo oo1lat livo (  rur(r io4amtnlncsa( aDur(rpnu1aetniiciasfa ul( o () lenif iadlm rlnvi s)trtm(o oy1ol e ivias aDrru pou4tpxniiciltla em(vpn()aeeoirctadlpt li slt0tetr(mpnu4ap elfvs s aDur(m ;u1alxomoctydfmDrmnmp u4 eeriocootom eluvols  rtrxmpnodomenlnei (f 2rmxmp;u0olt mocils m rmnvo t0trxoxr3oy1faDelu o;s)trum(m3oudopeelietat) rumx ooo4ole ifeiydla ua( s t0artnmo3oodla e ueo s0 rtoxmpiudlm nlfcslt s2uax pnu0oltoif3iltfmDumu p;u)aexnir3oatomDraieslt) ruo(m3iu1al  lncta(  2umu  no1tpx mo3iysfs umnmo t4 exnmr3ty1opDraues s0teuoxrpny4ol nlnvsl() 2rrurp;t1tleoioetasls rau s (4 ltnxf3tytomDraiei s trxoxr oo1lme  ivia(f Drau p;t1tlenmfctasfmDea(msn(4 etnmrctotfp rluvs;t srxr(m nu4omtnmneta(f 2umx p;u4tex iieildfsDem( s;()aexrxr3todlpDrau ilt) rxrim iodopt lfvi (  2umxr ou4opt mf3iad sDrmumont0 lenxo3oadoa rai s;s sexmxopnu4omenmicsa()s2tau ooo4aeeomfeiyt mDemu s;(0 ltrmfctotoa elueo;s)s2tr(r oydllt  icslsfarumumpno0ale  ictysfm2elnmsnu4 leoiocio1lp eaivo;s)s2xmxo3nudlpen fvil()s2raum nt4aeeo feiyt aDeau pnu)areoif todoa e u olt0teto(mpoodope  nct () Dtmum ot0oleoii3tytfs rlu s t)tlxrxfcoa1oaDrlnvilt) etm(o nudomeelnei s srrauroou1tle mf3iytfaDraumpnu) ltomf ty1fmDe nvsl(0 rumim3ny1oltnmivsls  2tr(m ;o0tlt  f3ildla2emu onu0 eenmr3oodfpDrlnes s) euoxr3iy1omenlivsat sDumx  ou4tpt ii3iytfsDrm(vo t)artnxociydlmDeai ol( s2xm(o3oydlpe livsls  2tm(r ou4alen fetatfa2uaumpnu) lermo3oo1la elnes s  2toxo3iydape  fvtat srrr(moot4alxo feild s2rm( s;(4artomo3tytom  au olt) 2xrim oo4ole  nvt tfs2trxro;u1apxo fciys s rlnmp () ltrmo ty1lmtr ueslt) rumxo3nudlm nlfei (  rtrum no0tetomoctad aDranvo;u0tltriociatfp rlnvil(0texr(m3iu4lmen ici t)sDurump;o4aeto ieiadfm umnvpnt4 leomo to1faDranes t0t2tr(o nodame lfeiat aDraurp;u0oeen octlsfm2ea(mpnt0texoir to1lat  uei s)s2ur(m iu4oleelfctas) Dumxrono1tptnii3iydla eln s;u0aeenir tytfat livslt)srum(r iudol   netls aDuru pnu1tpt  octydfs uanvo t)trerxrcoytoat lueilt)s2tmxo3oo4llenmivi tf 2rrurp;u0tle mieils s2rmnvs;t0 etnmfcty1fmt  nes s0teuoxr nudlltn iesas s2tau o;u4aexo oeiatfs ea(vs;t0tltrxo ia1lat aivo;() 2xoio oodap  lfvtls  Drruro;t0aetomf3iat a2uln p;u4altrmr3tadomDeanvs t) 2tm(m3oy4amtnmictas) 2rrumo;o0aleoifeildls2uanmsnu)altrir tadoptr uvs t0 exmir3nu1lltelfvilsf Dum( ont0alxniiciaslsDrmuvo t) ltnxo tydoat liei s0t2xm(r3iydlltnmfesas) rtrx p;t0teenmf3taslsDelnvo u) rtrifcoo1op  liei;s)sexm(r3oo4lm   ivtat  Drmurpot0oeenmfciysfa2em(vo;()tltnifciotopteaivs;s t2trxopnu4lmee fcslt s2ra( oou0alxnmiciadlsDuauvon(0aetoxf3tatlpt anei;s  2umxrpnudlp  licsatf rrrxm oo4apeo ietysfaDra(mpn(0aetnxociydlpD auvols)seuoimpny4amt  fctl(fa2trur ;o4aexn fetytls um(vs (0tlxnmo3io1opDeln ols0setmio3io4openlnviatfarra(monu4tptniicild m2rm(ms u4 lxoif3oatlm   iesl( trxoim nudlmte fct (f Drrurp;o1tpeo fetldfa rmu o;t0alxrxoctatfm rai i s seurim oydomen fvia( aDuru ono0aleoii3tysla2em(vsnu) lxnxr todlp eai il(0 2xr(r3iu4lmte fet t) Drmxr no0tpxnmietytla ra(vont)aeerif3oo1oat  n s t)t2urir nydam  mieils a2ur(  nt1tlxomi3ild a rm(vonu)altrmf io1fm elu o t) 2uoimpoydamtn iet ( aDtru o;o1oeeomietadfsDrm( o u4tlxnxf3iytoaDe u sl(  2xmiopiy4alee iet t)artmxrp;o4oleoii3ilt a elnmo t) rxnxfciytopteauesls srxo(opny1amen fcsatfsDum(mont0tpe ioeiaslmDrmnvp;t0aleoxr iydlaDeaueo;t) exrimpnu1llee nvsasf rurum ;t1olen ociytfaDel( pnt0artrif tydfmt  u ils0s2ur(o3nodolt mivt t) Drru  ot0tlenio3tysfsDeanms;u0tleomfcoy1opt lu ols)texmxm3ou1op nmfeilsf rum( onu0tpe ii3ild s emnms;u4tlxnio3oo1oa rai i;( truo(r nodapt  icsa(fa2raur ;o1opeo f3iyd sDeaums;t) ltrio iadoa e ivilt)teum(rpoudalee fei s a2umx  ot1alxo f3iyslm ranvs;t4tleomr3todfaDeau i ( setrimpiu1olte ietat)arurump;u4aex mfeiltfmDumuvpn(0 eerir totop rau o t0 rtmio3oydll  mnvi ( artmxrpno4tpx io3iat mDean ont4arxomr3oo1om r nvi s seuriopnydlle mnvtltfa2tmur nt0tex if3iat s rmu sn(0 eeoxocoytfmDrluvi;s0srxo(o3iodapee iet t  Dta(rp;o0tee if3ilt sDulnmpnt0 lxrxf tadfm e nei ()t2urir3oo1ame licslt)aDtmx pnu4tptoifetld a rlnvsn(4trxoxfcoo1fa elneslt0 2xoirpnu1optelneilt a2taxm oo4tpenmoeiatlmDelumo;(4alenxo tytlmte n o;t) ruoimpny1lpenmfvsa()sDur(r ;u1aetniictasfa2rl(vont)tetoir3oodfpD aieils  2xr(r nodal n fvta(fsrrm( oot4tltoiociad aDelump;t4trermr iy1oaD  nvols) 2xrxo oo1altnlncsat srtmu pot1oetoii3tys sDeluvo;u4tetomr3oytlmte ivo;t0 rxrimpnu1oltnlfetl(f rrrxmoou0opt  fciasls2eau o (0 leoifctotoateau o s0 2tm(rpoudlpte ies sf Dtmu onu0tltnifeild m2rlnvs ()aleomo3tadfm eanvilt  euo(opiu1lme mics ()aDtrxmpou0openifeiadfs rlumpnt) renio ootfmtrai i t)trtrirpno1omeemfct tf rrrump;o1tptoifciydfm2uln ont)alxrxo3oy1op rln s ()t2xrxopnydlleelfei tfsDurumpnt1aptomi3iyt m uauvpnt4tleomr3to1omD  i s;t) etm(o3oy1ap nlfesls  2tm( oou0apxn fcilsfaDrmnmo t) rxomr3oatfmD  nvols)s2trxmpoodoltnlnvsat a2ra(r oo4ole mi3tadfaDra( pn() etomociydlmD ai il(0 eumim ou1al emnct s aDua( pno1ope iociytfa rlnmp;u0 exnirciadom   neo t)seto(o ou1ap elncs s)a2ua( pnu0ale mfeiatfs ulu pnu) lerifctadlm r i sl(0trxr(r nudal n fvt (fa2rr(m ;u1olto fciysfsDemnmp;(0aetomf3iotfm  auei (  2xmxo3no1lmeelnvs ( aDum( ooo0optoiictltfsDrm(vpnu) ltoxr3tatlm eaueslt)trtmio no4optelncsat  2taxront4tlxn i3iyd sDuanms;() rtnir iadlp  li o t  exoim iu4lp  lict ( s2ua(mpnt4oee ifeiadlsDrmumsn(0 eeomf3ia1fpt  neilt  rxr(opny4ome mnesas aDrax pnu1aexn fctasfm2eln s u4tlxnmf3tadlmDr ueol(0texoxm3ou1lle lfetas aDtr(rooo4openif3tat sDrluvs (4tlenxrcoytfpD anei;s seuoir3iy1opt mfcsat s2urxrooo1aptoifetad s eanvo (0tetoifciadlp raieo (0trumxopio4om  lfvs ()artaumo;o1oeeomociys a2eluvp;() reoif oydlp  ai i t  2uo(opou4altn ivsas) Dtr(m nt4aeeomoetldlm2eanmpn() rxnxfcty1la  lu s;s)t2uoir ou4lpt  fvils) Drmx oou1oeeoif3ias m ran o (0tltomf oodopteluvi t0seur(o3nu1lm emivsa(fs2tmu o;u4tex mfcilsfa2ranvp;t4tltoxf to1om  lnei ( s2tm(m iudom nlivta()aDumump;o0teeomietlsfa2ea( s;u4altrxf3ootop  an o s0teur(r3io4lme mfes t  rur(r ou1oee  fciysfmDuanvo u)aetnmo3tatoa eaivo;t)trxoim oo4aptemnvsl()sDrr(monu0tlto ietld sDuln s;(4 eerio oydoa e uvs t)trxmxr io1lpe micia( sDtmu  ;u1texoifciatla rluvo;u0aetnxr3iotfa raivi (  rxoir3no4ll n net (fs2uru pnu0tee moeiydfa rmnvs;u0 etnxrcty1oaD aiei s0sruoio3no1olt  fet s)aDur(mpno1aet  oetls aDuanvs;t)tltnif3ia1latrlnvi;s0trxrxrpoo4lp elncsls sDtr(roou4oetnmoeiytfsDul( p;u0tlxnif totlmte ues;t  2tmxrpiodaltnlictasfsrtrur no1tpx iietyd a2rmnvp u0aetriocoytoaDe ueo;() etrxrpoy4olen ici (f rtmxm ;o1tpxnifetyd s uan p;u)altoif tatomte i s;( srxmir nydoptnlnvsas)s2taxmont0opxn f3ild s2ulnmo t)trxrir tadoa rlu i;(0s2tr(r3oo1altn feta()s2umump;u4tptomieildfm2um( p t4 lxrxocoatlpD lnvs;s0texmxr nudll emfci tfaDrrumonu0oeenifetltfs ua(msnt) rermoctodfmDrau ilt  etr(rpnu4am   ivta()aDuax p;o4aptniieiyd s2raump;u0 lxrxf3oy1faDelu o;t)t2tr(m3no1lp n iei s)s2um( pnu0oltoifciytfsDrlu o;(4tetrif3ootomDelnei;s)seuoio3io1lm nmiei s) rurx  oo0oee mieiydfs umnvp;t0tltrif oo1lp rlnvi (0 etmxopou1ap   fctls arrr(mpou0tex  iciad m2rm(vp;t4 lxnmrciatlpDeli o s trtr(m oodame  ivsat) rumu oot0tle iiciydfm rm(mpnu) rxnxrciy1lat lnvs;( trxr(rpnydoltnmnctl(faDrmu poo0tpxnmoeias a2rl(ms t)aleoxf3iodfaDrlieils) exm(r3oy1lm e ieia( a2ur( oou1tlen oeiad a rmnvp;u0 lxrio3tytlmtelnvi;(0 2uo(mpio1apt  nvt tfsrua(mp;o4ale  fetltlm umu p (4alenmo iatlpD luvo (0teumxm3oodop nmfvsl(fs2tr(  ;o0alt ifciat a2um( s t0texrmr iodfp  aivols)seuo(mpnudapenlnci tfsDrr(mono0optn o3tls s2rluvpnt0 exrmf oadoaDelu i s) etmio oo4opt lfcsl(fa2um(rp;o0oee ioeiyd m uanmpn()texoio3todoa r nvi;s)srtmxr3nudom n fvsat)sDrr(m ot4aleniieiydlmDumnvsnu4arermoctydop e i o;t)tetrio3nu1apenmivs () Dua(ronu4alen ociltls2uauvp ()tlxoxf3tydfpt  n o (  exmir3iodamen ivt t sDtrxr ou0alxomociyt s2rm(vo;u)alerir oatopt lues s0srtrxr oudlpen ivs tf Durump;t0aeeo f3iat s2rmn s;u4 exnmf tytfp elivs;t texmio3oy1om   ivt s  Dtm(mp;t0apx ii3iadfs ra(vs;t) exomr tatlpDeln s s truo(m3io4lltn ivtltf rtrxro;u1aeeoiictydfaDua( s u4tlenirctytoaDrauvo;(0srur(r3oodllt lies tfs2umxrono0tlxnmfeiatls2emn o (4altnxf3todopt  uei;t)texrim3iudlpenmfesls s2rau  ;u1opxniociad aDrl( ont4altomfciy1om eaies;s0trtrxr3nodomt  ivsas)arrm(r ;o4oetoifctldlsDean p;u0alxoif totoaDr neilt)s2trio3nu1optnlnvtatfs2tru ono1opt iieiys a ran o;()artomrcia1lmD lu sls srurir oo4lltn fesatfa2taurpnu4oet mfetyt m ea( p u4teeriocty1lptrlivi;(0 etrirpou4om  lfctatfs2rax oot0aeeo f3iasls em(vs u0areoirciadla r nei t texr(opoy1olte nes s aDur( oot0apeomfctaslsDum(mo;u4 rxnxo3todom rluvsl( teuoir ou4am elfeta()sDrm(  ot4tpeomi3iltfa ulumpnu)tltriocoa1opDr uvo (0 rxrir3oudom   ivil(f rtm(  ou4oltn i3iadlsDeluvp;u4 renmf3tytfat aivo s0trtmir io1lltn fvtl()srum( pno4tlenmoctysla rlump;u)tlxrxr3oy1fa  lnes t truo(m oodomtelieslt sDtaxrpno1alxnmfciydlmDul(mo;(0tlxrifctydfaDelnei;(0t2umimpnydalenmfcs t)srra( o;o4alxo ietytlm emuvo u4alxrmr iy1lm e u olt) rtoxo3ou1omtemivtas) 2ur(r no1tpt  feiysfaDeaumo t4areoxo3tadfmt lu s;() 2xmiopou1openmfetltfs2ra(ront0optoiieilslaDua(ms t) rtnmocia1oatelneo t0s2toir io4apeemfvtas sDrrx pnu0aet  f3tytfm2ra( s;u0aexrxo3tydlpDr neo ( texrir3oy4lltn nvt () Dum( ono1opt ioetlsls ea(mo;(4arxoir3iotoa eanvi t0trxo(o3nodlleelnet (f rtaum no0tlxoiiciydfaDem(von(4 eeoifctytlmDe n il( setmim nu1olt miesas s2umur ;o1aexn ieiltfa2rau p (4altrxrctydlaD aivs t)trxrxr3oy4ll emnctl( a2rm(ronu1tltnio3ildfa rln sn(0altrir3tadopDe uvi s  exmimpiu1llt lfcslsfsDum( pou1tlt  ieiydfm2ea(vp ()tltoxf3to1oaDe nvo;( srxo(o oy1ll  mivi tfartmumpno4alxoioctytfm2eanvs (4trermf tatfmD aueo t  2trio3oy4lmtnliei tfsDrau  nu0optoio3tydlaDrlu p;()aexoxr3ta1om  aies;()s2xo(rpoydapt lnvils a2ua(mpot1alt moetlt m2rlu ont4aexoxo oadla e u o (0trumiopou1ll n nvsasfsrrmumonu1aeeo fciad a2umumsnt) renif3tadfp  anes s) rxoxopoodomtelfvi s sDrmump;o1tpx moctadfa elump;t0 exrxfcoatlm rlu i;()srxm(r3ou4op emfeslsfsrtaxrpnu4tpt  o3iadla2ulump u4aexrxrctydoaDeai o;t0 2trxm iy4oltnlnvs ()srraxm nt0alto ieiydfmDemumo;t4 lermrcta1fat  nvilt) rtr(o oydom  lfctl(  Dumxr oo0aetomf3iaslm ranmpn(4altrio ia1fm e uvo t)trum(m nodlltelivs tfs2trx poo4aeenmo3iasfs2ul( snu0 lxomo3oo1lateli i (0 exmim oy4ole lnvil( srumu pot1teeomfciadfaDel(mp;u0 rtrxf3ta1fp  liesls)srtrio oodomt  ict sfs2taump;o0tlenmictat s2uan p;u)trxoxf3iotfpteli i ( s2xr(o3io1lle  iesa( arraum ;o1tpe ioetlt sDemnmpnt) rerxr ta1oat aivils  rtmxo3io1lptelfes ( arurx  nt4tex mi3iysfm ea( o t4aexomfcoydfa  aneo;s)s2uoxm iy1amtn iei s) Duaur ;t1altnioetldlaDrm(vo ()alxnirctadfm raies (0tetr(o3io1apenmnvsa(fa2rrumoot1tlt io3iyd s ea( pn(4tlermfciotlmD au i (0trurim iu1llt  iesls) rua( o;u1oexomfetld mDum( s () rtnmf3oydoaD aivi;t)sexmiopoydlltelivs () Duaurp;t4tpeoio3ias a2eau o u4arerxr oytfaD  u o t)t2xrxrpnydole miet t)srta(rpoo1opt mictltlmDrmums;u)altrmrcoydlateaivi;t)s2toio3iudole  ies t) 2rmum ;t4optomietyt a rlump u0aetnmo3tytfp   nvo t0 2to(r io1am  lncilsfaDtmxmp;u4oetoii3ilt m umu s t) eerirciotomDrlu i;t0s2tmxr iu1opeelnvi tfs2rmurp;o0tltoiietytlm2rauvp t0arxrmfcoydoateaies s0 etrxm3nu1lmt  ies t aDtrx o;t0aeeo feiatfaDuln p;u4 renir3ta1fm rauei;t  rurxo3oy4opt lfci s)arrm(m nt1aexomociytls2rl(vp t0tlxoio3io1fa e ivo;s srtr(o3oodop nmnvi s)aDrrx oot1tpxnmo3ilsfa ea( s;u)aeenmfciotoateluei;s0 2trim nu4am nmneils  Dum(m ou1aeeomo3iatfa um(mpnt) lerircoydfmDeluei;t s2urim oodalee ncias)arraum ot0teenii3iad a2ran o t4tleomf todlp rlneo;t0t2tm(o3ou1ol   nvsasfaDur(  nu0tptoii3iad s uln s;u4 etnmr3todoaD anvil(  rxrio3oy1omtn nvtat  Duaxronu4ope  iciat s rl(vs;u0altrmo oy1opDranvi ()texo(m3iodal emnei s  rta(root0aexoio3iat a emnvs (4arxrxf3ty1oa eauei;()t2to(o ny1opeelfciasfarra(mo;u4tlxnii3tlslaDrl(ms;t)tlxnxrctytop eluvsls  rtm(rpiu4amte nct t) 2uaxmont1opx mf3tasfs2rlump t0arxnmr3tytlaD luei s) etmxmpnu1lleelivilt) 2ra(  nt0aexnioeilslaDumumo t4altoxr iydlaDe uvs s)srxmim3io1ll nmnvsat) Dtmurpno0oltniietatfa2em( ont4 renmf3ty1faDrluei s srtoim nodaptn fcsl( sDumxmo;o0alt  feiyt sDua(mo t4 rtrxo oatfaDe nvi;()s2toxrpiy4lleemncias a2rmxrpno4tpenmietys m el( o u0trxnxocta1lp r n s;(  2xmxrpoodapenmict (  2umum ;o4opeo oeias sDul( p;u) rtrxr ty1fmDraneol()trtoxo3no4lme lnetls  2ra(m ;t4apxomieilslmDuau o ()artrxr oadlptrau ol()tetrio oudol nmfcias) rrm(m no0altomf3tyt s ranvpn(4aeeoxf iydlaD li i;t)setr(mpiydap nlfvtas sDrm(mpot4tpt  octydfaDrmnmp;u4tetomr3oatlpDeai s (0sruoxo3iydaltn nvsasfs2trurpnu4texo icias m2em(ms;() leomr3iytoptelivol(0s2xr(m3iodamt livsltfa2ra(rp;o4aptniiciadfmDelump;u) rxrmo3iotlaDeaueo;t0s2xrxopoo1alen fesat)aDtm(m nt4tleniieildlmDea(vont4 exomr3iy1faDelnesl()srtoxmpiydom e ivt tfaDtrxrooo0tpenifetls m umump;t4tltrxo3oa1fp elivs;( setmxo io4lp   fctl(fs2trurp;u4olx  i3tytla2rlums ()arxnio oydoa ranei (0s2uoiopno4optn nvtls)srururpnt0apto feildfsDumn on(4arxrmrcoydom elu o ( setm(o3ny1amt mictlt) rrrxr no1tltn i3tltfmDean p u4 rermr3tytla  lnvols) etm(m3iu4om  livs s s2rrur oo0apxoii3iytfa2rmumpnt)artnmr oo1fm   n ols0 2xrim nu4amt livslsfa2tmxmo;o0tpt  ociytfs ra(vp u4arxnir to1lp   neo s  rtrxr3no4lp nmncsl(faDum(r ;o1oet ifetytlaDemu s;t)arerxo oo1fate ues s0 rxr(o3oo4llt mfcil(f rrr(mo;o1tpt  fciad aDeluvs ()tlenmr3oa1omD aivi t0t2uoir oydlp eliesas)s2rau pno4apxnmociydlsDul( o (0 etomr3ty1la e ivols sexmiopno4apt miciat) Drrxroot4oltn feiysfa2rlnvo u) rtnxocoodopteanei t srtr(rpnodal nlfetlt) 2tr( pnt1apxniictydla2ean s;t0 lxnxr3ootoaDr nvs t0t2urxm iudapeemnciatfsrtauroot1apt iicildlaDel(vp;t4trxoirctotoa   uei;()setoxo oydll nmneilt aDra(mp;t0olenifetydls ua(mp;t)alerifctodlpDeln s;t)srtoimpoydlptemfcilt)aDtrumpno0aee mf3tlslmDrm(vo;t0trxnio3io1lm raues t t2xmim3io1am  lfvi (fartmxm oo4oex  octys aDum(vpnu4trtnxoctodopD  n s;t)t2xmim3nu1amen ncilt)s2tm(m ot4opxo iciad a eanmsnt4 rtnifcoadfm  aneo t) rtm(mpiodolee ncs t)arrax poo0olxnmfctydfs elumo t)trxomf tydfaDeli o;()trxo(opiy1ol n net ()srrr(mp;u0alen i3tlt m2uau s;t4artnifcootlpDeli i () 2umiopiu4lp   ietasfa2raur ;t0optn o3ilt a ranmon(4 rtnxr3oydopDe ivs;(0 rxo(r io1lpt licsl(  2ua(mo;u4opxn i3tad s2rl(mo ()aexoxr tatopDrlues t)teto(o io1amee iei sf Dtmxronu1oltoioetlsfm2eanmo (4 leoxocta1omDrlu i t srtmxo nu1ol elieias)sDta(  no0oet  ieiltlaDrl(msnu0trxoxf tytomte u s ()sexr(r3ny1altnlnvslt a2rm(ro;u4oleomieiys a ul(vont0 rxrmf tatoa eluvsl()seuoimpnu1omtemfctasf rtau pot0olt  oeilsla2em( p t0 lxrxr3tytlaD lieols)teur(opiudlm emfeils sDtrxmoou0oleo i3iytls uln p () ltnxf3oo1lm eaivs s)srum(r3ny4ameemnvt s) rtrur nu0ope mo3tydfs elnvo;t4 leoxr tytlaD anvslt0setoiopiudal   iesat aDua(mpnu0opt ifeilt m ul( pnu4trxrxr3iodoptr ies;s0 2tmxr3nu4ap emnvtl()sDumxr nt0texniieiat mDuau o (0artrxr tydlmDeau i;(0t2urio3iy4llt  nvsl( srra(rpno4teeomf3tyslm2emnvo t4tlenio io1oaD  uvi;s0 rurxr oodopenlieslt)s2ta(r nu0oet iictasls uau pnu4tlerif3oydlm  ai o;()tetrio no4al nlnctlt)srur(r ;o1open ieiyt mDrm(mp t0 exrmocoadlpt anei s0 exrimpny4lm nmfct sf 2umxrpnu4tpxomiciasfs eauvp;u0 lxnxo3to1lateaivi;s trtmxmpnu4apt licta() 2raurpnu4aeeniieiadfmDuln s (4 rtrxo3oo1lmtrln ol(  rumxm iy1apt lnciasf 2rrurpno4tltomfciytlm2el(vont0artnmr iotlat lu i;t) ruoxo oo4amtemics t)srtax o;u1oet mfctldla2uluvo () ltrif iy1omD lnvsls) rumxr3ny4lp  lnvi t) Dumx oot0alxnmi3ildfsDrmumpnu4texrmrcto1lp  anvils seuo(m io1oltemict () rrmxm no0apxoif3iydfa ranmo;() lenmr3oa1faDrli o t0texmxmpiy1optemncil(  Dumx oot0tee  o3tatfm2rlnvp t)arxrmo tatfat lnvo t t2xrir3iy4altelnetls)sDumxm ;o4tet  oetatfm rau o;(4alxoir oadfp eliei s) etoiopiu1op  mfct tf 2umur nt1tpenmf3iyslm ua(ms;t4trtrmf3iotlm rauvi;t) 2urxr3oy4ap  lfctas aDrmxmont1texnif3ilt s2ul(mp;t) etrmrcto1oatrluei (0 rtm(opiy1ope lnci t)arta(ronu1oexomi3ildfm el(vpnt4aetrxo oytfpD  i s (  2tmxrpoodol emfvsas  2tm(mo;t0tex ifciltfaDuanmsn(4 rxrirciodfpt auvols srum(o iy1am  mnetls a2trump;o1oee  oetytlm ul( on(4tltnxr oydoaD  n s;(  exrimpny1opt lies tfarurxr oo1teen f3iys aDrmumpnu4alerxo3tytom r ivslt) 2to(o nydlptnmnvt t s2taxrpoo1oex mieiytlsDrluvp;u4aexnif3oy1fmD auvs s trxrxo3iy4amt  fcta() Drrxm ot0opt iiciydfa2ulnvo;(0aexoif iy1opt ln sl( tetriopnydol  mies tf rtrx  ;u4oexnmo3tytfa2elu p t4aetrxrcto1lptr ivs;()trtrio io4om  mfesat)srtmx oou4olxniiciytla2uaumsn(0 leomo3oytoa  ln o;t)trur(rpiy1lm nmnet tfs2rru p;u0aeeoioctasls elumo;t)tlxoxrcoo1omDrli i;s0t2tr(m3oydapt  nvtlsfa2rmumpoo0tlxnmoeiadfaDum(vpnt4trxrifcty1la eli o;( texoiopiu4alt lietl() Dtru pnt0ape mf3ildfs2el( p;(0aexrmfctotfpt aieolt0trxoio3oy4apeemnet tfaDuaxrono1aeeomi3iad aDrmumpn(0arenircia1opt  neo (0s2umir nudlmtnlfci s aDtaxmpno0tex iocils aDea(mo;t4arxnmr3iodfp  luvil() exrir3iydamt  nvi sf Drru o;t4optomictlt a eaump (4tetrxr3oy1fp   ueol()t2toimpny4aptnlfvta(  rta(mpoo1alt ifeiytla ranmsnu0 leomfcoatlaDeln i t s2tmxrpoy1op nlfvtltfa2um(m no1tpt  oetyslsDrmu o t) lxnmfciodfm elnvo;t) 2to(opno1olen iesat) 2rru ont4altnif3tatfaDuaumpn(4areoifciatfatelu o t)srurir io1om  mncs (  2ra( pou0oex ioeiasla umumo () ltnmr3tydop  aivilt0s2toim3oo4ap elictasf rrm(mp;u1ape mf3iyslaDelnvo (0aetrif3iydom e nvi;t)srxoxr oydlptnlfcils)srrax p;o4apto oeiaslsDrm(vs t)aeenxf3ty1lpDeanvo (  exmimpoodomt mncsa(  2rmumpno4oexomi3iatfmDeanmsnt0aexnio ia1faD lnvols0srxrxm nudamte ivi tfsrurum ;t4tpt  i3ildfmDrlu o;t)alerxo3iadfaDelivs;t0srxm(o3nu4olt lfcs sf 2tr(mooo4olxn f3iadlsDuauvs;(4aexrxo oatla  au s;s) eurim nu4lme lfvt sf rtrur ;o1apeomfciltls2rau pnt4 etnmrcta1lp e uei;(0 exr(m3iodap nmnvi (  Drrx o;u4oet  ictlslaDum( s;u)texnmr3iy1fp r nvol()sexo(m3oodam  micsa(fs2rr(m nu4aptomietat m eln snt0tltrxf tadfmD ln o;t)srtmiopoo4altnlneiltfsDrau poo4aexnii3iyt a2em(vo;(4tlenio3oo1fpDr ivi s) 2xmim iodop n icslsf Drr(rpoo1tpt  oetytlsDrmu o;(4tlermo3iytla rauvs () rxoio nu1omtn ivtat)aDrm(rpnt4oetn o3iadlmDranvp u0aexrmo3oa1fmD lnvo;s  eur(r3oy4ameelicsls srua(rooo4apeoif3tat s2el( onu)arerifcoydlmte ues;()seto(m3oydlmtnmfei t) rtmu o;u1apx ifcildfs ua(monu0alxnio tytoatr i i;t t2toxr3iudap  mfcia()srrmxmoou4apeomocilsls2rmums;(4teenif3oodom r ies;s t2urio oydlle  icsls)arrmxrpnt4oltn feiasfs ran p ()artrioctadfmDraies;t0seto(rpou4ome lfei t a2trxm ;u1oexo o3iytfm rmu onu0tlxnxr3io1lmDran ol( s2triopnu1ll e nei sfs2rax ont1apxn ocild a2emnvp ()texrircoodfat livi ()trxmxrpnydope lfeia()sDuaxmooo1tpenmfeiysfm2em( s ()alenmr io1optelnes;s0 rur(r3io1apee nctlsf 2rrxmpou1tlx  f3tys a2ulumon(0 exoxr tadfp ranvols sexm(opoo4ol nlnvsat)s2tmum ;o1oltomiciysfm2rmuvo t)aleoir oydoat ai ol( srtr(o3ny4lptnmnvilt)a2ta(rono4openifetydfaDrm(mon()aexomo ta1omD luvols0s2uoimpoudlpt  neiat)sDtm(ro;u4ole ioeiatfm ua(ms u4trtoir oytoate n o;t tetr(rpiodlp nmieta()arumur ;t1apx  oeils m2emnms u0alxnxo oa1lp rau ols texrxm3nu1omte nci ()artmu p;t4open octys mDrln s;t4artoxr3todopDe u i;( trumxm3nydlm   fvs t sDrmuroot1tltoii3iyd a raumont4treoxoctodfm  li ols0srto(o3ou1amtnmfvsa(f Drrxrpnt1optn ociyt m2um( s t4artnxo oa1fa elnes t srur(o ny1apeemivt sf rtm(roou0alto ocils sDrlnvsnu4 etrxf oadfmD aies s0teur(mpiydam emieil(  rtax poo1tpx iictytlm emn sn()tlerio oa1fa   ieslt) rxrxr oy4omtelfci ( s2urxmonu4altomictatla ranvs (4 rxnxf3to1fpt lnvi s) 2toirpny4ap e ietlt sruaxm no0tlt iietls m2emu ont0 eeoxf todfmDrlnvs;s seurxm3oo1olte iviasfsDurum nt1tetomoctldfmDumnvo;t0 rtrif3oodfm  aues ()trxrxr iudll  lnvtlt sDrmumpoo4tlx  oeilt a rluvo u)trerxf3totfaDeaieilt)s2trir io4lle lfesatfs2rr(rpno1aex iictldfaDrau o t4arerif3iatom  aneols srxmxr3oudomtelfeil(fa2ra(m ot0tlen ictlsla emnvsnt4 etrxfctatom eai sls0texoir oy1lleelfvs (f 2taxmpnt0tptomo3ild s rmumo u4trtnifcoadopDrlivs s)srtr(r iu4op  lnes t) rrmxmpnu4tpx mfctysls2uan o;u0arxnio3ta1opDe nvi ( setoiopiu1altn fesls aruaxr ;o1apx mo3iytlm2ua( onu0trtrif3to1om   uvslt0s2um(o3no4al e fcs (fa2uaxmpou0alen i3tls a2umu o;u0tlxoxo3oadlaDelieil(0 exoir3oy4amte ncia(f 2uau o;t0tpe mocilsfsDemnmpn(0alenxrcto1opte nvo t0 rxoio3iu4omteliei sf rrmxm ;u1tptomfciltls eauvpnu4tlxrmo iydlpD  n ols)trtrir3iy4lpe lnesa( srtrxrp;o4opxo fciltfmDra(mp;(4aetoxf oy1laDraies;t)t2uoxopoudll elies s srtaumonu1alx ioeiltlsDemn snu)arerircootlaD li s t)s2trim3nodlme mfes t)srrmu onu1oeenmoeiasfa2ulumonu) rerir tydla eli ols  2urimpno1om elietl() 2ur(rpoo1opt mi3iyt s2umnvo t0 lxnxrciydlat lnesls)s2um(o3oudole  nct ( a2tmxmpoo4olenmf3ildlm2umumpn(4aeermr3iydlmteaivilt0s2um(m iu1lp nmfeta()srrm(  nt0aexnif3tysfa ra( pn(0tetrxo oy1fpt livilt0srtoxmpnodopenlfctat)aDta(mp;t1tltn ieiys sDulumpnt) rxnxr3tydoat  ueilt0teuoio3ny4op  mfvtas srtaxront0oee iieild m elumo;t0 renxf3totfm r n i;s0setrir oo4ame  ivils)aDta( p;t0tpe mf3ild m2um( s () lxniocoo1opt  n slt) euoxmpoy4olt  fvt s)aDtr(mo;t4oet  fciatlmDeln s ()artomo oydfate nvi;() rxrio3oudop  mfvslt a2tr( pnu0tex  oeiytfsDrl(mo;()aetrmo oa1lp  aivo;s0s2urir3nu4olenmivsls s2tm( pnu4tetn ociydfm rm(vs t4trtoiociy1optraivs s0truoim ny1al nlneiat s2tm(rp;o1apt  ictyt s2eauvsn()trtrmo3oodlaD li s;s)trtmxr3iy4lltnmnesatfsruau pnu0texoii3iat m2eluvonu0teenxr oytoa rlivi t0 etrxmpno4alenmnet sfarrmurpnu0opxoiietls s ulnvs t)alxoir3tytfpD  u o;s0sexoim3oo4lmenlnvi sfarrmxrp;t4olxnifciadlm2rlnmp t0altoxr oy1oaDr iei t)s2triopou1ll  mivs tfsrtaum ;o0oee if3iytfs2uan o t4aetomrcta1fm  au o;()srxmxr iy1omte fcia(f Drax  nt0oet ii3iltlmDel(mo;() etrir3oa1lpDeai s (  ruoxm3oo4lp  lfet ( arrm(mpnu1ope ifetytfs uln p;u4 etnif oa1fptrlu i t)s2tr(opiydlltnmnet t  2urx  ;t0tlx ioetytfsDrau ont)alerifcta1oa eaneol( trumxr iy4lpt mfei sf 2ur(r ;o0aleo fctaslm ranmo (4altrircoodfptrai o (0sexo(r oo1ol n fvs tfs2ur(moou1oet mo3tadlm2eau p;(4tlxnxf3tadlmt livs t s2uriopiodlm emnvta(faDur(mo;u4tpxniieilsls ua(vp;t)tetrircia1fmt lneo () 2tmxr3nu4altelfeilt)arur( poo1tpt ifeiydlaDrlums ()arxrxocia1lateauvo ()sexmir oo1om elivt s artaxmpot1oetnifetysfmDemnmonu0 rxrmr totlptr ivols srxoxo3iu1olte fctat  rra(rono0aleniiciad a2em(vpn(4 exnif ty1lp e uei (0 rtr(r iydaptemieiat)srrmu  ;o4olxoifetls m emu onu0 ltrxf3iadlmteluei;( sruoxm oodlmtn fvi ( a2ur(ro;o4olt mi3iasfsDrm(mo;t0 etrif3tytomD  u sl( t2uoxo ou4amtemfeia()srrm(rpou4texnii3iydfa2rmnmp;t)treomo3to1la eauei;()srtriopno1al  lnctlt) Drrxront4opeomfciys s2rm( s (4aeerio3iydlm  li olt)trurim3ou1altemnvta()a2rr(mp;t4aeto ieiltla2ea( s u0trxoir io1la e u o;s s2tm(r nu4am e fci ( s2rr( pou4olen feiys s ea(mp u4tlerxf3ia1lpDe nvo t srtrimpou1al emfviasfs2taumont1teenioeiltlmDea( p u)tltnmr3oydom  aivsl(  etrir3no4amtelicil(  2rrurpno0apxn fctysls2el(von(4alerxfctytoaDr ivsl()trtmirpoudopt licia(  2um(mp;u0oetnif3tatls2ulump t0treomociodlp e u ol(0trxr(o3oodaltn neil()arur(roou4alenif3ild sDumums;(0arermf tadoa rlivs;t  2uoir ou1lpte ici () rrmxrp;t4aee  i3iys m2emnmo t4trxniocio1oaDelivi;t)trxo(opnydlme mnei t) rtrxr ou0alx iiciasfs2ulnmo;(4 lxrir totlaDean slt  2urxo3ou1om elivs ( aDrr( oot4opxomocildfs2emnmo (4 rxnif iodfmDraieils0 rxrio io4lmenmnct tfarrrx o;o0tpxn fctatlm rln p u)arerxr3todomt lnvo (  rum(o3iydlpt mivslt aDurx pnu0tlt moetlsfm ean p;u0 ltnircoatlm rluvil( texr(o3io1aptn icilsfaDtru ono1tex mictlt mDulnmon(0tlxnmf iotopDrai o;t) exmirpou4omtnlfcs s  Dtmxr oo4ope  ieiysfaDrm( p;t) eeoirctatlat lu o s trtmio ou1lptelfcs () Dtrxroot4oleomfcilt m rl(vs;u)tetnmo3io1opD  nvilt s2tr(r ny1am  mici t)srumur no0apxomiciyslm eaump u0 reomo3ty1lmDrlu i;s)texr(o oodlp e nes tf Dtm( ont4aetnmoeiytfmDea(vonu) reoircto1fp rln s;s trtrirpou4lptelfeilsfarrmx poo0alto oeias s2ul(vp;(0 eerio3oodlpDe n i;t0 rxmim3oo4altnlfvtlt s2tmxrpoo0teen i3ilsfa ua(mp;u)trtnxo to1fmtraneol(0texrim iy4ap n fcsat)aDtaur nt0aexomi3tlt sDeanms;()arxomo oadfm eaies s)trur(rpiy1olenmfeia() rrrx pnu4ole iiciyslmDum(mpnt)tetoxfcty1lptr ivi;t s2ur(r3nudoleemies (fsrta(mo;u4apeniietyd sDrl(ms;t0trerxf3tatopDrai o;s  2to(r iodope mieil(fs2ua( oot4alxoio3tytfaDrm(monu0alxrirctydlmD ai i s0t2xmim3iy1lmtnmivilsf rumx  ou0aet  f3ilt mDran p;t)aetrifcoodlmt lues t t2tr(o3oo1apt mfcsa(f 2ua( ono0ale  o3iyd m raump t0tleoxf3tytfm rauvi s0trumim3oo4am n fcsat) 2rr(ro;t0tpx  ociasls umuvs (4artrmo ty1fp  lnvilt0 ruoxm oo1altemiviasfarrr(rp;t0optnifctatfsDemn o;()altomo oadlaDrlu sls)teuoim3io1alenmnvil( sDurxronu1teeoiieiysls rlnvsn(4 rxnmf tytlpDeaiei t0 ruo(opny1altnlneil( s2trumonu4tpxnioeild a2um(vpnu4aeeoiociotfptran s s0 ruoim3iodom n fvsatf 2tr(rpot1oex  oetlsfaDumnvp (0artnxo3iotfpteauvo t t2trio io4om elivt tf Dumxmo;o0alxo f3iltfs ua( pnu4arenmr iatomDr ivol( setmim3io1oltn nes s) Drrur nu1oleoifetas mDuanmp u) lxniocoy1fptelnvi t tetmxmpiy4omenlfviasfaruaumonu0optn f3iaslm2ul( p u4texrir iytom rli o;t)trxmir3oo4openmfeia()srrm( pno1tlt iiciatfmDra(vp;t0texrmrciodlpDe ieolt) 2toxr3oy4lp  licslsf 2uaum nt1oeen fetadlsDrmn snu)alxoxo totla ean o s srxmirpno4omt mfetat)aDua(mooo4tlt  oeiasfsDulu p;() lxrio3iy1fmDrlueo () ruoimpnodlltnmivsat  rtm( poo1tleomf3tlt s ea(ms;t)trxoxo3to1omDr uei;( trxr(m3nodamt liesls) 2ra(mo;o0aeeomoctadfa ea(vs;u0 etrif3ootlp rlieol(0teuoxm iu1apenmnesl()s2urumo;u0tpenifeildlm2rmn p;(4areoiocoo1lat an i;s  2tmxm nydam emfvsls) Dur(mp;u4ape moetas a2eln s u4tltoxo ootlatrai o s  exoio iudale mfvs t  Dtm(r ;o4tltnifciadfs2ul(mp;t)tleoifcootfmtrlnes;s)sexoimpou4lpe  nvtat)a2raxmpnu4olxoiiciltfa ra( o;t0artrmrcoytlmDelieolt setoxm oodlleelfct sf rtrx ont4tpto iciyt m rl(vp u4 ltrxr ta1fp rli o (0trurxm oydaptelivtls a2rmxrpnu0altnmiciasfsDem( on(4 etoxo3iodlatr n ils0 rtmimpny4ll  mivi (fsrtaumooo0tlxomietadfs eanvo;u0aetnmr ty1fptelneil( t2to(o nodaltemict tf rrmur nu1oleo ieiatfsDrlnmo;t)alerir oydlm  au ils s2trxopio1olen fvs t)sDrmxmo;t0apt mictatfsDea( onu4aexrio3totomD li s ()t2trxm3nodomeelfcil()s2umxm ot4apeo i3iadls2umuvp;u)arxoxr3io1lm elu s (  rto(m iu4lme  fcsatf Drrur ou4apt  iciltlaDrmu sn(0artoxo3todfa rlnvsl() rtriopnodap emict s)artmu o;u1tetn fetyd aDrlnvp;t4 rtnmr3todop  aiesl(0s2urim3ou1olenlfet sfaDrrxmpou4teeomo3tasfm ra(mpnu0artoir3oo1fpDrli o s) rxm(m3oudlme lnesl( s2uax  nu4aeto i3iasls2rluvsnu)altoif iatoatelu o;s0s2xrio nodaltelfetl(fs2rau pou0olx io3iytla ul( p;u4aleomf iytlpt aivi s) eto(m3ny1am nlncs ()aDrrxmp;o0opx mociatlm2emu pn()artnif oadfptelivi ( srto(rpoydapenmneiat s2rmur nu0alxomoeiytla rln p;t0 rerxr3iadopD luvo;t0srtmxo oudapen fvi (f 2rrx p;o0alxo o3iysfs2uaumo t)artrio3todop raieo;t)s2tmxo3oy1lpt livsls)srta(rp;t4olxn f3tlt m emuvo;u)alxnif3iy1oa eaneil(  ruoxm3io1oltn nctltfs2ua(r oo1apx iiciyslm2rlnvsnu)texrmociy1oat li i ( teuo(o3iu4ol nmnei sfsDtmu ont0tleoiociltls2ul(vpnu)teermfcoo1fm eluei ( truo(o no1optelfeia(fa2raum ou1opxo o3iytlm2uauvpnt0arerxoctotfaDe ies;s)t2ur(mpio4op  mivtatfarta(roou1ale  feiys sDrmnmo;t4altrxr tadfpDeaneil( texoio3iu4llt  fci s sDtrx o;u0alto ociydfa uluvp u4 reoxf3ta1oa r u o;s)trxrio3iu4ap emfctas)s2ta(rp;t0tee  i3tltls2rl( s u) lxnmo3iatlp elueol(0 eumim3no1lmee nctasfa2uaxro;o1tetomfciys aDemuvo;(0alerif3tydoaD auei;s0setoxrpno4ame  net ( a2rau ont0oetnifeias mDranmp t4 leoio3tadoaD an ol(0 2ur(opoy1lm nmnet (f Drmurono0aexoif3iydfs em(vo t0alxomrcta1fp rai i;t) exo(opoy4am  liesl(  Dumurp;u1tpx io3iydfm el(vo t4 ltomfctodlm elueil( s2trxr3iudlm e fes ( s2rmu  nu1texoif3iat a2emu onu0 ltrmo3ootlp  anvil(  ruoxo3ou4apt livtl() Drrxmpno1apt iiciatlm umnvp u4 eeoioctadlm eluei;()tetoiopiudol  lncil() rurur nt0teenmociatfa2uauvs t0 rxnmr todomDrlnvs s)t2tmxr oy4alt  ivsls) 2uax  nu4tpxomociydla2ra(vp u0 etoxo oodfat li o s0 2tmxopiodaltelici tf rumx  ;u4alt  f3iyt sDulnmo () eerxo iydlmtrlivo s srum(m iydomeelnetlsfs2umx  nt1opt  ocilsla rm(mo;t0arermrcty1fmDrauei s0s2xrim ou1ol   ies s) rra(ro;o1tlt  f3ilsls uanmont4 lenmrcio1op  lu o;t0 eumiopiodamtemnesatfsDur(rpno1tle moeiyd m ul(mon(0teeoircoydlm r uvs;s0truoir3iy1am  mies (f rrrum ;t1tex  f3iat aDemnvs u)alenxocoo1lp eln i;s0seurirpiy1am emiesls aDuaur ;t0tpxnmo3iatfsDumnmo;(0aeenmf3iodfat ln o;()truo(mpnu4omt lnesa(faruaumono4ope iiciytfm2um(msnu4tlxoxfctydla raieo;()t2uo(mpoydllenlicsasf 2umur no4aptoio3iltlm2ranmonu0trxrxo iydlaD livo s)sexrxopno1lme  fcsl(faruaxr no4oet  o3iys s2elumpnt)trerio oydom e nei;s0srxm(rpnodllt  ieil()srraum nu4opxnifetlsfsDulumsn(4 leoxociytoat an olt0 2xmimpou1lltelnvtlsf 2raxm ot0tlt mfciltls2ra( onu)artomo3oydoaD aivs;s0t2umxm oudlmt  ivtltfa2ur(  ou4aeeomiciyd a rmumpnu0trtrif tatfp   nei;t  2xrio3iy1op emfeil() Dtaxmpot0aeeoiieildfs eluvs;(0aetomocty1lm e ivi;( trxrxo3iy4om eliei s)srrau oou4aexniictyt a el(vp t)texomo3ta1lmD  nvil()t2toio3iy1opeemies ( arra(rp;o1alxnmo3tasfm2rl(vsnu0 rtrmf3oatlm  aieolt srxrim oo4omen ivt t)sDuax  no4aet iociatfs eanvsnu) lxrifcto1oa  liei t) rxmxr3no4al   nci t  rurur oo0opt mociys a rmuvp u0 lermo ootla r ivi;t)texr(m3no1al  mfcilt) Dumumoou4oeeomocild aDrauvsnt4trtoxr3io1fpt  nvo;(0t2um(r3ou4om elncs (  rrrxrooo1aex ifeiatfs2emuvon()teeoir iydoa  livs;s0trxo(rpou4apeelfvsasf 2tmxronu0apxoioeiatfsDrmuvs;u) lxnioctadlm rliesl(  2xoxr iy1oltnlnvi ()s2ra(ro;o0tlt  octysla ulnvsn(4trermo iytoa   i o;() eumim oy4ol emivt tfarraur ;u0oeeoiieiadla2rau s;u4tltrmrcia1fmt  ieolt)srtoxr ou1altn nesls  2taxmp;o0aex ioetasfa2umu ont4tlxrir ootfmtrlnvs;t srxrir iudop emfvslsfaDtax onu4ope  o3iydfaDumnvsn(4 exoif3iodop eanvs;t)truo(r3nu4al  mivtas  Draxm oo4oeto fctltla um(mpnt0tetoir totfpD livi s s2xrxm ny4lleemici ( a2tmu ont4ole  i3ilt s2emnvo t)aeerxr3oadlp  aneil(  rxm(m oo1lle lfesltfaDtax  nt4tlenmo3iad a ran s t0 lxoxr tydopteaueo ()t2umxrpnodole miesl()sruaxrp;u4tlxo i3iytlaDuau p t4texrxrcoy1la rauvs s)s2to(r oudlptemfei s sDurxront4tpt  ictasfmDulu p;u)tlenxf3iytfmtrlivo;s)t2trimpou4lmtelies (fsDum(m nu4tex  fetatfa emnmpn(0 rtomr3iodlpDr neol( t2tmir3nodllt  nvtltfartm(m ;t1ole  ietyslmDumumo;u0treoxr3oytlaDelnei;s0 etr(r nu1llt mict s)s2uax pnu4tleomoctyd m umn o (4aetrmo tadfmDe nvi t0srxm(opno1op   nvtl( s2umump;u1oltniietysls eanvpnu0tetrifciytlm eaieilt trxmimpoy1lmen netlt arrmur oo0aexoiiciltfaDulnms u)alxnmf3oa1fpt livilt0t2xrxo nu1lltemnvsls a2rmx  nt4aexn ocild s2umuvon(0trxnxr iy1lmDr nvi;t0 euo(mpiudll   ivs t)a2rm(  ;u4aee mfetydls em( p;() reomocoa1fpteluvo s) ruoio3oy1ap nlieil(fs2umu o;o1tpx mfetlsla2uln o (0 rerxoctadomDe i olt)texrimpou1al  mnvtas aDraum nt4ole mfciysfa eanvo t0 rtoxr3ia1fp eluesl(  rtm(opou1olenmfetls) 2trumpnu4alx micild m2uaums;u)aexniociy1opt lnes;s  2tmxmpno4aleemfvsl(farumump;t0tpxnmfeiltlm uaumpn(0tlxoir oa1lpD auvs;(0trurio iy1oltemnet s aDraumpoo1oexn o3iasla2rmu pnu0arenxo ootlat  i i;s)tetm(rpiy1lm e nes s)aDta(rpnu4aleniociyd a ua(msnu)texniocoo1lmD livo (0 rtoir iy1llt liet t)a2rru  ot4oetniieiatlm2uan o;u)tleoxoctadlp   u i ( t2uoxo3oy1openlnvtl()s2urxr no1teenmfetas s um( snt)tltrif oy1opDr uvs;s0trtoir no1llte fctl()s2tmu pnt1oexoifciysfa rlump ()trxoxo to1lpt anvsl(0setrxr io1al  mies s) Dtmum ou0tltnmfciat s uauvp t0 reoircia1lpD lu s;t0 2xrxr iy1om n fcsl(f rrau pou0tpxomi3ildla uluvonu)treomo todoaD  n s t0t2trxr iu4lpe licsatf Dtax pot0oltomfctaslm2ean sn(0alxnmo oadoa eluei;t  etmxo3ou1lm nlivsat a2rrxmo;t4oltnifcils aDranmp t0 leoxr iodomD lu sl(  etmiopio4opeelfei sfaDrr( oou4tex  i3iat a elnmp t0artrir3iatlatrau i t trtoxm oo4alt  icsat)aruax  oo1tpto feiatfm ea( s u) eermrctytlmDrlu ol()s2xm(m iodaptnlictasfaDum(  no1tltnmieiasfs rau ont) ltnir3tatom e iei t) 2xrimpnu4llee fet t srurxr nt0alen ieild mDuan snt)aetrif oydfptrlnvi;t0sexmxr3ny1amtelnci s arrrxr nu4oexnif3ils m2rlu o t4 eerxo oy1fp rlieols)trur(m nudamtnmfcslt)aDrrx ooo0aexoii3tltfa2uanvs;t)tltrmr3ty1lmD lies ( s2tr(m oudam e icslsfsrum( p;u0oltoii3tlsfmDrm( ont0 rermf totomDrluvil(0t2xmxo nu1amt miesatf Drrurp;o1apx mfcilt a elnvs;(4tlermr iadfpDe uvo () 2to(r iu4lmeemfet t a2rm( o;t4tptomicildlm rluvo;() etrxociy1lpt au i;s0 ruo(opoydlp elfcs sfa2tr(mooo0ope  f3iad s eau s;u4trxnmr tadlmD  nvi t) 2xrim oodoleemnesat  2tr(  nt1aeen feiytfmDul(mp;u)trtoxrciadoatelueil(  2tmxr3no4lm nmnctltfaDrmurpno1olt mocils m2eanmont) exoifcootfpDelues t  rtmxopoodamtemnct ( aDrmur ;t4olxnio3iatfm rauvo t4 exomr oadfp   n s;t0t2urxopou4ll nmfetl(  2rm(m nu1texnii3iat s2ulnvs () ltrir tytoptrlu s s  eumir3nu4ale mfeiltfa2uaxr ot0tpe  oeiyd aDrmu s (4 etoif3tatlmteauvo;s)srtmxr nydolte ieslt)s2rr(r ;t1altoio3tldls ua(vo;(4 rtnxr oytopDe uei;( teur(r nu1lle mici t  2ua(rono0aex ioeiad a2emnms;u4areoiociadlmtr uesls0teurir3oo1openlfeias)sDur(  ;t1optomoetydfa eaumpn(0alermr tytlaDelneslt)seum(r3iydapt  fvi s s2tr(m ;t4alxoiieilslm2ua(vs (0 lermfctadopteau i;s)sexr(r ny4ap nlncsls)srraurpot4oet  o3iat mDel(vonu) etrmf3oatlp ranei;s0 rur(rpoo1lmenmnvia( s2rm(rpnu1tlx mi3tldfmDelu o u) reoxr io1fptrlieilt seumim nudolt livias)sDuru  nt1olxnmieiasla2emnmo;t4 rtoiocia1lpDr neolt srxrxrpoo1lltelfci () 2rmump;o0tlto f3ilsfmDea(vs;(4 exrxr3iatoaD aivi;t0teurxm oodap   nvtl( aDrm(  nt4tlenioeias a umnvp (0tetoxfciadfmtelnvs (  eumxm3oydlp e icils)sDuaumpot4aptn f3iydfmDrl( o u4teeoio oo1omteaueilt  2to(opou4lme mivs t)arrr( p;t0apenmicilt a raums;u0teeomf tydlm rlnvilt  rxoxrpnu4amtnlfctlt  rrm(rpnu4tet if3tatfs ul( o;u4altnxf3iodoptrluvs (0 2umxrpoy1ol  mfvtas srra(  nt4aexo o3iyt s eanmo (0aeermo totfptran il()trtoxmpou1ol nmnvta() Drmum ou4tltoiictat sDrmuvo;u0 rxrmo3iytlp eaieol()seum(o ny1lm elici s s2rmu  oo4oetnioeilsla2rmnmo u)altnir3oytoa eauvo;t0tetmxopny1ap   ieia(fa2rr(  ;o4tlenifeiaslsDemnvs;u4treomf3oydlpDe neil(0 rumim oo1op   fesa() Drm(mpoo0alt  oeildlm2eluvo;u4aetnxr iadfaDeau s (  rxmxm iudlpt micsltfaDrrumo;o4apx mf3tydla el( o t)tlenmr3iatopDrlnesl()t2to(r oy4lmeelfvt (fa2tmu ooo1apx  fcildla uanvo;(0trerir3oydlpteaivs (0texr(mpou4lmenmnciltfs2ur(  nt1tex iieild aDemuvpnt0aexoxo3ty1lm eaivs t)tetrxo nu4ol e fetas) 2rrx  ou0tlt iiciytfm2uln onu) exnxfciodfmtr ies t s2umimpnu4lm nmivi (farrrurpot4apxnmo3tltls2um(vp;(4trtrmo3totlpD au slt  etoiopnudalt mfcilt) 2ur(r nu1tlt ii3ildla2el(vo;t4tlermfcoytop  lueolt)t2to(r3no4olt lfeils srrmumono1alt iictld m2rm(vonu)trtoxo iytom   nes ( t2tm(r nu1am nmfeias)aDtr(r no4tetoiietadfa ranvpnt4 ltrxr3iotoat an s s)s2tm(mpno1lm n iesls srtm(  nu0oetnmf3tlslsDra(vo;(0 ltoifcoytfaD  i s;s)tetmir ny4lm nlnvs ()sDrrxmp;o1aeeoif3ilt sDelumsn(0 rerxo todfpDrlu i t) exrio nydllt lieiat)srrax ono0tex  o3iadla2ea( o t)aeeomf3oo1fmt ai olt s2toiopno4olenmfctlt) 2rmxr ou4opx miciys aDelump;t0 etrxo3to1fpteli i s) etmxr3no1am e fes sfaDtaum ;o4aptnmieiltls ul( snu0 etrif iotlatrlnvsls t2urio oydlm nlicil()s2urxmpot4tetn fciadls2el(ms () ltoir3iodlptrlnvolt  ruriopiy4al n neiatfs2rru pnu4aet if3ild m2rl(vp t4altoxoctydopt li ols) 2toxopnydlmenlfctls  rrmx  nu0olxomi3ilsfs2rl(von() ltoif3ta1omtraivolt)t2uoxopoydlpe mfctlt  rua(roou4teeomoetad sDranvp u0alxrmf oo1fmteaivs;() eurir no1lmtemncil(fa2taxro;t0optn oeiatlm2eau s;t4trtnirctytfaD aivs;s t2tmxr3nydllt livsas)a2umxmo;t0oexnioeiyt s2rmnvonu0 lerxr tytfa e nei;(0s2xoio oo4amenmicias  2umu  oo4aeeoiieiad s umnvp u0tlermo iodfaDr uvs s s2xrir oo1omtemnvs t) Drr(mono0aleomi3tatfa2uanmsnu4alenmrcoytlmDrlnes ( sexm(mpnudlmeemicils)srrmumooo4alt  oeildlaDelnmont0alxoxf3iadfmtr i ilt setm(o no1lmt mfvt tf rtrxm oo1olt  i3iydfa umuvonu)aeenir3to1fp  li sl(0srumxrpoodaptnlfvtl(fsrumu pou1oeeoio3tyslaDuanvs t4 ltrmfciodfmDeau olt) exmxrpoo1opee nes tfartmx  no1altn oeiat mDum(vont) rxnxo3oatlatelu i;(  etrirpiu1ape  ietlt)s2tr(r no0alxoiietad a ulnvont4alermfcoadomDeluvo;(0 eumim iu4omen feiat)artrx  ;u1ale  icildfa2ranvp ()arxnxr3iydoa elneil(0 2umxo iu4omee netlsfsrtm(m no0tlxo f3taslsDra( o (0texrxr3iodla  an o;t seuoio no1lmt livt tfsDumxronu1tpxoiieiyt a2uanvsnu4 lenmf iatop rauvi;( s2xm(o oy1lle  fct t sDrax pou1oltniieiytla rln p u4artrxo3ta1la raneilt)srxo(o3iudopeelicta()arumx  ;u1aetnmi3iasfmDeln s u4 rtnmr3oo1fmtelivo t  2xmxm iydlp elfcs s)a2tax ont1altoif3tltfaDeanvp;(4tetrmrcoydopD li i;s)sexoir3oo4am e icta( aDur(ro;t0apenmfcils a2em( s u4tltnif oatfa  ai olt0texr(o3iy4ame  iet (fsrtr(rp;u1oetnmfeils aDemnmo u)alermr3iodlaD lneils0teuoio oy1al e fcs sfarurx  ou4aleo ieiltlsDua( snt)tlxrmocoytfptrauvol() 2tr(o3nu1olte nvsa(  2tax  ;u4tpt ioeilsls umumpnt4 etrxocty1lp rlnvs s0s2xo(mpno4lle lfctasf rur(  ot4aexo i3tlt mDeluvsnt)trtrmocootlmDrluvslt)texoxm ou4ame mietl() rrrxm nt0tle miciydfm uluvo (0aeerxr io1fm raivo ()t2urirpnu1omtn fct s)aDrrxmo;u4opeomoctat s emuvp;u)alenmfcto1faDe neil( texoxmpno1omtnmivsas)arumumpou0optn icils m2ran o;u)tetnir3iatlpD lu i t s2trxmpou1lm n fcs (f rurumpnu0tetomfetadfs uanmsnt4aleoxrcio1fatr uesls  2xmxmpny1lmtn ivtatfsDtm( pnu4tpt ii3iydls2uan p;u4tlxnmf oodopDrlivolt)trum(m3no4lmenlnvs (fa2urum ;o0tptn i3iadfs rlnms (4arxnmr3tadla  auei;t srxr(o3no4om   fvtl(f rtaxr nt0oltnifciatfaDea(vp;t)tlxoif3oa1om r ieilt0t2umiopiudlpte ncil( artrurpnu4tltn ocilt a2el( onu0 lxrxocoy1fpDelnes s  2xr(m nu1ol  mncia(fa2uau pot1tpx io3iltls2emnvp;t0tltrir oy1laDeli s (0 rtrxr3ny4amtelivtas)aDtm(m ;o1tetn feiytla el(vo;(4tltnmf oa1laDeau sls texoxo oydal e nvt tfsrtmuronu1altoiocias mDelnmo;()tlxnxf3iadlaD anvols  rtmxm3iu1amt  nvtlt) Draurp;u1aeeo o3tydfmDemn p;u)arxnmr oo1oa eli slt0seumxr3nydolen netl()s2umxm ;t4teenmf3ildls2ea(mo;u4 exnxoctodlpte ivs s srumxr nu1ap  lfcta()s2rmurpnu0alxomfetytlsDrm( p;u)texoif oadomt an i;s0srxrir3ou4lltnmnvsls  rrrxm ou1aexnmoeiasfs2uau p u0 rtomo3iotfpteaueo;()srtrimpio4lp n fesasf Dumxmooo1olen octysfs2eau o;t4 rxrmf tydop  aueslt)seuoxm nydlltelfvsat) rtm( p;t1ape mi3ilsfaDelnvpn(0arxoxo3ta1fp elnes;s s2xmiopoudap n nvsa(  Durumpno4tpx  ieiad a umn p;t4tlxoxr iodfm   nes;t)srum(opiodlltnlfctat)arrm( pnu0aex mietlslaDel(vo;u0tetrioctytopD aieil(  ruo(m io4lpe lict sfsrrrx o;t1aexn i3tydfmDrm(vp (4 exnmrcia1fpDe nvil() eto(r iu4aptelictat) 2tmu pnu4tetnmietyd m2rlnms (0trerxfciatopteli s;t0srur(m3io4amtnlfcil(  ruaump;u1texo o3iatlm2eluvp u0altnio3oy1fpD ai s () rurxo iudole  feia()sruaurpou4altoiietlsfm2uauvsnt0 exomrctytla rauvils sexoim no4oltnlfctlt  rtrx  oo1tet  fciytls eanms (4texnmociotop   ieol( tetoimpno4lptnmfvt (fsrtm(rp;o1tltomoeiltls2ulumo;u4 rerxfciatfa   ivi;s0teurxo ny1llee neiat)srrmxmo;t4aetoii3iyt a rl( o;(4teerircootop eluesls0trxr(mpiy1openlnetl()srrm( ono0olenmi3tydfs2rlnvo u4altnxo3iatlpD  neolt0t2trxm3oudom  mnetltfsDraxm ;t1opxnii3iltfaDeln pnt0tltnxf3tadlaDr ueo s srumim ou1olt lfct t) 2rau p;o4olxoii3iydlsDean snt4aleoxr3tytomD ln i;t  exmio no4olen fvi t)arumxro;u1texn fctatfs uan p t4tetnmociodopDeaues;(0sexoxm3io4omt mivil(f 2um(ro;o1oexn ietat m ua(vo (0 ltoxo to1fmDrlivs t0 2urxopiu4apt mfeilt  rrrx oou0oet  oeias m2rl(vp;(0tltnif3iy1lm e neolt sexrxopiu4apt  fesasf Dtaum ot1aetn o3iat m2ul( snu0 rerio3oo1fp elues s)trtm(m no1apeemnesa()arrr( o;t0aet  fetlt s ran o;t)alxrmo3oadoa   ivs s sexmxo3oo1amen fctl(f rumumo;o4ale ioctys m2elu o;u)arxniociadlate ivsls)trurio ou4lle mnvt (fartau oot0oetnifctys mDea( s;t0tetnif3iytomtraneo;s0 2umir3iudop e feslt aDtm( oot4ape ioeiytfm2uanmo (4aleomo oytfm r uvs;t  exm(m3nodal emivt (f rumxrpou1aptnif3iatlsDel(mp t4trerio3to1lm rlnes (0 rtrim3iu1amte feils s2trxmonu4apx  octltlmDel(ms u) exnmf3ia1fpD  n o (0trxr(m ny1olen fvt ( s2tmuront1tptnmociat sDelums u4trerxf iatoatrlivo;(0 rum(mpoydom  mncia( a2ua(rpnt1altoiieiytlaDrm(vs;u4 exoif3iadfpte neolt setoir nu4lpee ict tfsDtmxrpou4aexn fetas s2uluvp;t0tlenxr3oa1fptrau i;s s2xo(r3iu4ol elnesa(fs2raumpno1apeomfeiat a2uluvp;(4aexnif3iodfmtran il(0 2um(o iodam nmfetas s2tmumoou1apeomfciatfaDrlnms;u0aexnmfctodlaDean s t0trtoir oodomtn nei s)sDrmxmpnt1aexoiieiatfs2emums ()arenxr iydomDranvs;s t2xrxo ny4ll   ncs s)srrm( pot0tlxoifctas s2ean p t4tltoxocoodopDean o t trtrio3nu4amen netlt a2taurono0tpeo fcildla uauvsn(0texnifcoytfp r n i;s)t2xrxm no4ap n nvilt  rrmx pot1alt io3ild m ea(vp t)altomf3tadfpt an ols) etrirpnydom nmivi t)aDua( ono4altn o3tltfm uln s u)texoifcto1fmD lu i;t  2tmxrpiu4om emivi tfaruax  ;u1openmoetasfa2um(ms () lenir iydoaDelu o;()t2toimpnydap e ivtasf rtm( ooo1alxnmfeiytlm uanvo;t) ltrxo3to1fmte ivol() 2xoirpny1alenlnvt tfsruru  ;o1apt micildfs ea(mp;u0treoio3todfmt  nvils sexo(m3iodlmtn nvi t a2tau oot0tet mi3iysfsDeluvp (4 rtnxf3totfm eauvi t  2trimpiu1al   fet t)arraxm ot4aexnmfciaslm um(vpnu0aeenmrcoytlmDraueo t)srtoir3nu1olenmneiatfsrrrxrpnt0tle  i3tytfa rm(vo u0 lerxf3todom  au ils0 rtoim iudopeemicils sDuax  ;o4opeomoetas aDrm(mpnt)trtnif io1oat anvo s) 2uoxo iydom elncsa( s2tmx p;t1apeoii3tat a ulu s;u) leomrctydoaDelu o;s0t2toxr oo4lltelnesas) Dtr(r ;t1tee  ociasls2umn snu0tetomocto1fm   n s;s0s2tm(mpiudol  mfctls sDtrxmoot1oee  f3tlsfmDemn s u) lxrxr iotfp e u i;t srxo(o3oydap nmncsl()srta(mpot1ape ifcias a eluvp (4aeenxr tatopt  i o;s) euoir3iudlpe lnetas s2umxrpno0oexo iciadla ul( s;()trtnif tydfm eaueilt) 2umirpnodllt licsl() rta(  ot1optoio3iad a rl( p;(0aeeoxrcty1fp raneil(0trxmxr iydame  fcsas)aruru  ;t0ale mi3iydlaDumn s;u4trermo todlaDraies () etmiopny4op e fci sfsDtm(ro;t4oexoiietyt sDrm(vsn() renxf iotfpt luvilt  rto(r nodaleelnetasfa2raumoou4tlenmo3iyslaDumuvo;t4aetoxf oo1la r ivil() rxrxrpnu1alenlnetltfsrtr(m ;u0tpxn octltlaDrln pnt0tlxrmocio1lmt aivo;s tetmimpiu4ll nlncta(  2rau pou1alxnmi3tls a2rluvonu)tltomrcty1opDrlueo;t)srxoir3nu4al emivt sf Drrxmoou1tpto f3iydfm2ulnvon(4texomrcoodfm e n sls s2urxmpny1ll  lnvt s)srtax poo0tpt moeiatfs rl(vs u4trermociydopteanes;t0setmxo3iudlmeelivt (f ruru ont0aeenmieiydfs2elnms;u0tleoxr oy1om raueslt0s2xmxo3nydlmeelfes tfsDtmx  no0alxoiociatfm2elu o t4areomo3todlmDelu o s s2uoio iu1omt livs s sDtmuro;t0ale moeiatfa uanmon(0aexrxo3oodlpDraivs;t0sexm(o oodopt lfesa(f 2umurooo4oexnmociyd s el( s;(0 exrmoctotlp rln o;( trurxo3iy4ll nlfetas)aDurxrpnt4texoioctatlsDra( sn()treomo oy1fmt  u i;()tetoio iodlm emnvils srurumpno0ale ifeiat m2em(mo;t0trtoir ia1fpDelu i (0teur(o3oudop  miciat  rtmur nu1ope if3ias m2em(mo ()alxoxr ia1lpDeauvol()tetoxo oydomt  iciat a2rruroot1tpt mo3tadfmDraums;()arerxf tadfa  anvs;(  ruoxrpoy4lpe  ieiat)artmxrpno1tlxoifeils s2ea(mp;(0trxoifcoydom  auvsl() eurimpno4ap  liviltf rrru pnu4tlt ifeilslm2umumo;(0 ltnxrciadopDr ueo;s  rumim3ny1lmeemfes s  Dta( ont4opxnmf3iatfaDelnvo (0 rerirctytoatelnvo;( trurio ny4aptnlivslt)s2ua(rpou0opxomfeilt a2ua(ms;u) ltoxr io1fpt anvols)s2xoxm3nodol e neiat s2umx  ;u0opxo o3tltlm2rau o;t)tetnmf ootopt ln ils)seuoxo3iu1ol  lfcsa() rurxroot1tleomociydfmDranvonu4areomfciotfate ueol(  rurxr3nudlmt liei t arur(rp;o1oexnifetysfm emnvs t4tltoir3tytlptelnvolt)sexrxr3ny1om  lnet sfs2ta(rpot4alxnmociys a2ua(vp;u0 ltrmo3totlm  liei () rtoim oy4omenmfciltfarumxmo;o4tpt mocilslm raums t0 lerxfctydop eauvils0s2uriopoy1alee fvtatfarrrx pnt1apxoifciltfa emnmp t)trerxrcoa1op   neo s0 eum(mpiu4lleelnvs s)aruru o;u4alt moctas mDrln pnu)tltnioctotoatraiei () eumim oy4alenmncslt arumu p;t1aex mo3iatfs2ra(vpn(4 eeoxr3oadfa  lnvo s)tetrxmpiy4olt mfesls aDum(rpoo1olto ociyslaDrlu s;u)arxoir tadla   ivilt0 rxoxopio1oltn fvia( sDuaumont4teeomictydfsDuln s;u0 rermo iytfpD aieslt  eurxm nudap  lfvsat)sDtrum ;t1texo fctltfm rmu o u4tlerir oadlm eaueols0srtmio3iy1opt  ies (  rta(  ot1tpeo feildla um(mo t4altomo3oytoaDeln ilt) rurxm3nu4ame  fcs sfa2ur( p;t0tee  i3iydlm2eauvp;u0 leniociydom   i s;t)s2trim3nodlm  lfvt s) Durumo;o0apx mf3iydlsDemnvo;u)aexoxocoo1fm rau i s) exo(rpoy1op nlnvils  Dumu pot4opxnioeiytfs umnvo;t)tlerxfcto1op eaueo;s) rtrir io1lmee ncsl(f rtm(ront1oet  fciatlm2rln p u)trenif ootfaD ln s s seurir oudlltnlnvt t) rurxrono0teen fetaslm2umuvo;t) ltrio tadfp  lneo t0 eumxo3io1opee fvslsfartru oou1aetniocils s uan pnu4tltnmfctotfmtr nvo ()srtrxm iodom  licias)artrx pno1ape mociaslsDra(vo u)trtoio3ia1lm   uei;(  eur(o3iu4optnlnvi sf ruru p;o4apx  oetys m2emnvs ()tlxrxo oodopD aieo;( s2xr(r nudale mfeils  2ur(m ;t1optnioeiatfa2rm(mo;t)texoxf iydfmt aieilt)teuoxo ny4altemfvtl(f rtmu  ot4tee ii3iydlaDel(vo (0tlenmr oatlpDe ueo;t)teum(mpoo4ll  mfetlt a2rrx ont1oetnioetlt s2ulnvpnt)texomf3to1lm rlivs;t srtr(rpnydop e nesl()sDtr(rpot4aee if3iyd mDuln s u4trenxf3iytfpte nes;s0s2um(m iu1ol nlics tfaDtrxmont0altomoetlsfmDum(vsn()trtrxrctotlp e ivo;t)s2xrim3nu1amtelncs (fs2rrxmo;o1apt mfetldlmDeanms;u0artomr3ia1la e n i;t  rtmxr3nudapen feil()s2umurpot4ole ifciyd mDrmumo u)alxoio3todfpD anes;( trtmxr iydomt  ncilt  rtaump;o4openmoeiydla2emnvo u4artomf iydfmt au o;() rxrxrpio1ameemiesat s2urxr ou4olenmoctytls2el(vs;(4tlerif ia1lpteln s ()teuoirpiu4om nlfctlsfsDrrurp;o0opeoioeiadfa2ulu p t) rtnxo3tatla  anvols  2xo(rpny1am  miesatf Dtrur ;t1aex  i3iys s em(vo;u)arermr oa1faDr ieo ( t2triopoo1lltnmnetl(f Dtaur ;t1tlx iietyt m2em(msnt)alxoxf to1la r ueo;(0 rxoxr3nu1amt  nvsas a2rmx p;t0aptniieild m2ra(vp;()trerxocootfatr uei ( trtm(rpoudol  mfes s  2uau o;o0tpt  fcildlsDel(mont4artrir iytla   ivi s)sruoir3iudalenmfvilt s2trur ;u1opxnmfciatla2emumsnt)trxomf oadoatr u ols srxo(o3iy1lleemfvsas  Dtm(r ou1oeen ocilt m um(vs;t4areoio oydfmteai slt0trtoxo3oo4ope lnci ( sDrax o;o4ope ifciaslaDrmnvs t0aleoir iadlp e ueils0 rxrxmpny4llen ietas  Draur ;o0texo i3tatfmDemn p u4 rtrxf3io1faDeanvi s0 rtmxm iu1lptelivtl(  2rmumpno1oet io3ilsfm ean s;t4 lermfcootoaDean i s)t2toxrpnu1lm nlnvta( srumu poo0aptoifcilt mDra(vs (4 lxnxf3oo1fmt au i t s2xmim3no1al  lnei s)a2uax o;o0aleomf3ildls uluvp;(0tlermo ta1lptean i;s) euo(mpnydom  mietlt a2umum nt1oee ifciytfa rmu p t0tlxrmr3ia1fat  nvi s0 eto(m3oydapt  nesl(faDur(m ;o4alto i3ildlm2ranmo;u0aeenmfcto1oa  luvo;(  etoim3nodlmt mfciat) Dtm(r oo1tptn iciytlm rmumo (4altnmo tadfmDrluvo;s0 2trir oydolte nvi () Dur(mp;o4olxnifeiyd m2rluvo u) etrxfctadlatrauesl()teurio nu4omt  fetlt aDtm(  ;u0tle ioctltfa2emumo;u4trtrif ty1opD ai i s setoir3ny4op   icslt) 2tm(  ou1aptnioeilsfsDumn o;u)aexrio iotom   uvi t  2uo(mpoo1lm nlivil(fartmxr oo1ope ioeiyslaDran p () rxoirciotlm elivi;t)sruo(r ou4ap nmiei s) 2rrurp;t0apt  fciadls el(vs;t0altnir3iatlp elivolt0 rurxm iudolt lnetl() Dur(rono0opxomfeiyt s um(mont)teenifciotlaDeau sl()texrxo iy1ol nmfeias  Duaur ;u4apxo oetadfa2uanvpn()texoif todfaDelnvo;t  eum(o nydamte fcslt)a2uau pnt4tetn feilsfaDuanmpn(0arxoir3ootfp rln il( trtrxmpiy4ale  net ( sDtaxr ;u4ole moeiasfs2ua(mpnu0aeeoxf3iodomtrlu i s seumxr3iydlm e feta(f 2uaxrpot0aleoifctad m2rl(mpnt)tlxoif oadlmt  nvo;() rxm(r3ny4lm n ncilsfsrtru  ou0opxnmfetydfm2rm( p () lxrxoctadfmD auvs ()srumirpnydlmtemietl( s2trxr ;t1tee  f3tatla elnmon(4altrxr3ia1om   neo;t0 rum(r3ou4ll  livsa(f Duru  ;t4tpt  octatfaDelnmon(4 exrmf3iotla eaivi t seurim nu4lle mivt t a2ta(rpno0opt iieiad s2rln o t)trtoif iotla elnvilt) 2ur(m nudlp n fcsat  2rmurono0olt  octltfmDumn snt0arermo tydfa r ieo (0 rtrxo oo1op e icil() 2umxm no0tpeo ocildlaDuln p u4 lenmo3oatom  aueil(  2xoxo3ou1al   nei sfa2ururp;u4olto o3ils m umump;t4arermf3totom  auvi () ruoirpny1om n ies t a2rmxro;o4aeenmoeias s2ulnmo (0tlxnio todfm  li i t)trumim3iydlp n fei s) 2rax pnt0tlxo fciaslm2umu p t)arxoir todoptr uvo;s)srxoio3iy1openmivilsfarrrurpno0aptnio3tyd s emnmonu0aetnif ootfaDeaivo s0teum(o3oo4llt lfcsls) Draurp;o0altnii3ildfs umu p u)tetrir3oatfptrlu il(0 2xoimpou4ape mfes sfarrmu  no1aee mfeiatfaDrlumo;t) etrif iodfa e uvol()t2ur(o oo4apt mnvs t  Drauroot0olen f3tad sDelumpnu4tetrxrcoytfmDr nvo;t s2xr(r iy4optemiet ( sDrau ooo4oltnmoeiytla emnvs;()alenmrcoatfpDe ivs s0sexmxr oo1am elivil( aDur(rpnu0tlx  feiltfsDulnvs;t0alxoxocootlaDe i o;s)t2tmim3oy1ope  fviasfsDtaxr nt0opxn ictysfs emump u0alxnircoo1oa rai i;s0srxrirpou1al emfesat a2tm(rp;o0alx mfeiltlm rmu s () rtnxfctodoaDrlneolt trtmim iy4ome  nctat)sDumx  ;u0tee moeiyd aDulnmp (4arenxo3oydlmD auei s)s2tmxo iydlltnmneil(fsDumum ;o4opxnmfctadfm2umnmpnt) etrxfcto1oaD aieo;()s2toio3oo1ole mfvt s srtrxmp;o0oee iiciytfa rlnvs;(0tlxnmrcoydomt an o s)texr(r3oudalt mnet (  rraxmoot0alxn f3tadls elnmsn()arenif3ia1fp eauesls tetrim3ou4ame lnct s)s2rru  no4alt iieiytlm um( p t4aetrmo3iotfmD livols sexr(m3ou1al nmfvia(  Drru  ;t1aeeoifciltfs eauvo;t) rxnxf3ootop rau o;()sexoiopiu4amtemnvslt  Dtru  no1olxomieiysla ran o;()teeoxo iodop   n s t0 rurirpiy4om nlnciasfaDtmxm ot0aexo octadla eau p t0 rxrmo todop  aueolt  eum(m3oodale lfci t srtm(rooo0tpx ii3iadfa umnmsn(0trtniocoodop eau s;t)trurir ou1alen
\ No newline at end of file
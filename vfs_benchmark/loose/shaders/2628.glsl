@@ -0,0 +1 @@
+ues s  rum(r3io1lm emfet tfaDururoot4apxo octyt m2uanms u0aexnxo3todoa ranes;( t2uoir oodlmtelncil()sDurxm nt1oleomo3tat s rmn o u0tlermo3ta1lmD aivol() 2xmirpiy4aleelfviltfsDrru oot4tltnmoeildla umnvont4 ltrmf oodlpt anvi;s  2urxr3oo4ll elfvsl(fsDtrum ;u0apt mociydls ua(mo t)aexoir3iotlmteaivsl(0t2tmiopnydlmtnmnct sfsDuru  ou4opxoiieiyd s elums;u0tlermr3iodopDrauvi s)sexmimpoo1amenlicias arurxroot4aetoiociytls2ulumo () exrxo3ootfpD  uvslt texrio no1llenlfetatfaDuaxront0aexnmiciatlmDeauvsnt4texomr tydlaDeaieols)srxoxm3nu4ope lncs s a2rmu oot0tpeoii3iysls eauvp u0 etnxfcoadfateliei s srxrirpiodameelieils)s2umu pno1opx  ociatfmDrmuvp;u0aexrxrcia1oaDrlueil()setoxo3ny4amtnmfet s  Dtmxm no4apxo o3iyslm2uauvs u0alermf ty1lpDr uvi;t tetoio3iu1am  mnetatfarraum ot4oeto ieiadlm2uan on()arenxr3oo1lp  lnes;t  rumxmpiodlm elies tfsDrmu oou4tlxnifeiatlm eau p;t4tlxrxr iadomtrlneols)trurir io4ll n nci tfaDtrxmo;o4tle  f3iytfs emumonu)arxomo3ta1lp rlies;() 2um(opny1am nmneias)artr( p;u1aexomf3ias m2rl(mpnt)aeeomr ia1fp r i o;t)s2urimpoy1ll eliesat)s2rau  ;t4tpxnifcilt m el(msnt4 reoxociy1op rauvi () exr(r3oo1ameelfvtls sDua(r ;u0tpeo o3ilt mDrlnvp u) rtoxo tytfa rauvi t setr(opoo1apt  iviasfa2rrxmp;u4aetoii3iat s uau pnt0altomrcia1fpD luvs;()t2to(m3iydom emietltfa2raur ;o0ope  f3tytfsDumnvont4alenxo3todfptrlnvo;(  eumio nudale lfei sfsDtm(m oo0tlxnmieiatlaDuauvs;t0 renxf oadlmteliesls) rxmxm oodlmtemfvil(  2rm(r ot1tpe iieiadlm el(msnt0tlxrmf oadfmteaneo s0s2xm(o nu4ll   ieil( aDur(r nu1opxnii3ilslaDra( o (4 exnxf ta1fa rlu i;(  2to(r oodamee nvia( srur(rooo0tlt  i3iaslaDumnmo ()texnirctatfpDr u i t) rto(m3nodope lneia(fsrra(mp;o4apxo ictls sDemu o;u)altomfcta1lmDr uvo;( t2xo(o3oy1llenmncs tfaDtax  ;u0tetoio3iyd s2ra(mo;t)altnif3oy1fpDeln o;t  euo(m3oudol e nctas  Drrxmonu0oexomf3tatlmDrmuvo;(4texnxfctadfpD aivo s)s2urim iy4lmeemfvi s)a2uau ont0ole  ociyt mDulnvp (4areomrctytlate uvs;s0t2uoirpoudamtn ncsl() 2trumpno4ale iietlt m ulump;t4trtrmo3tatfpDelnvolt)tetoxo3nodamt lneiat)s2rm(  no4tpeoio3iysls2eanmp;(4 lerxfctytomt livi;(  2umirpiy4om e ics ()a2ta(ro;o4aeeo ociat m ea(vpn() lenif iydfpt  i ilt) rxriopiy1op emfct s srtr(r nt4oeeoifctld mDrm(ms u0 eermr ootlpteau ol(0sruoxmpiu4lpenmfet s s2ra(rp;t1tee ii3ilt a2uauvsnu0 rxoxf3ootlmt lueols)tetrirpiy4om n nvt tfsrra(m oo1aeenmf3iaslm2rmu p;t4tlxomocoadfpDeauvs t  2xmxo ou4lpt mieil(f rurxmpou0texomietltla2um(vp u0 rtomf3tatlp e ues () 2toio3oy4ol  lneia()a2trumpnt4oet mociasfs ulu sn()aeeoiocto1omDr nvols  euo(opnydlmeemfctl(fsDuru oou1aexomfctyt a2rauvpn(0alxrxo3iy1opD lies (0srumxm ny4apen ivta()a2raurpno1alt mf3ild aDran p;u0trtomf io1oa rluvi ()srxoim3iydameemnvtl( a2taxrpoo0ope  i3ilt a uan ont0 rxnif oatlaD lu o;( sexrxmpnu4op nlicsatfsrua(mpou0tex  feiltfa2ulnmp;u4 rerxr tydfmtraieils0tetr(mpiy4ap e ivslsf Drm(m oo4aleo ieiytlm2ul( pnt)trtnxfctytlpD aies s t2um(r iy1amenlfet s) 2uau  ;u4aex iocildfa2rm(vo;u4artrmrcootom rauvi s)s2tmirpoy4llte ics tf 2rru  ;o1oee  o3ils m eanvpnt)trtrxf tadlaDrlu ol()s2toxrpoydal  mfci ( srtmum ou1opt mf3tlsfmDua(mp (4 lenircoy1fp e n s;s) rxmxmpiydll nlicslt)a2raum ot1tleo ieiltfa ulu s;(4 rtrxr oadfat  ues (  etr(r3nodolt mneil(  rra( pou1oetomi3iysla rln p;u) exomo3io1latr ivol( sexmxm nu4apte ictat)arta(rp;t4oltnmieias m rl(mpnt4arxnir iodoate neo t teumio oo1lpen ncsatfs2uaumo;t1aeeoiiciytls2ra(mo u)trxoxo ootla   ivo t teum(opnydom n ivsl() rtr(  no1aetnif3tltls ra( pn() lerxf3ty1optr ueol() rxmxrpnydam e fei s  2rmxmpou0aetn octas a el(mp t0 ltoxr3iatlptrlu s;s s2tm(r iu4oltemnet s)a2ra(  oo1alxoif3iasfmDum(mp u0trxoxo3tadoateauvi s0texr(mpnu1ol elnvias)aDraxrooo1tet  ocilsls rluvsn(4 rxomo tatlpteaieo (  2xrim ny4amen iet ()s2tr(ro;t4opto i3ils mDrl( s;(4arxomr tadopD aiei;t  2umio iy1opt  feia()aDuaump;t1tle mi3iatfaDrl( s t4tetnio iatla e ues;s0trtmxo oo1llenlfvsltf 2rr(rp;u1olx mfeiatla2ua(vo () rerif3iotlm raivsls  rxr(o3oy4ape mfcsat) Dra(moot4ope ioeias aDuan o (4 rxrif io1fm rli i;s) eurxo3iydale lnetat  ruauro;t1opxnii3iatfm emu p;(0trenir3oa1lm eaiesl()seumxmpou4lm emfvt ( artru  ;o1oetn f3tldla uan o;u) rermo oo1fmDr uvo s0 rxoxopny4lmt mnci s)srraumoot1olxomoeiysfaDra(vs t)texomocio1faDr ivo;(0 2tm(mpiydlme mfct t a2rrur ou0altn icilslmDrm(mo ()tlxrmocio1lateaueil() 2xrxrpnudllenlfei (faDtaxrpnt4olx miciltlmDuaumont4aexrxfcoo1laDr ueolt  rtrxo3nu1apee ivt t s2ta( p;t0tltoiictltfm2rm(vpn(0 rtnxf3oytlm e neo;t sexo(mpnodop   fvslsfa2trump;o4tex ifeilt mDea( o () exrif todopDeli olt s2xo(rpnydlm n ivsasfa2raxront4opt mi3ilsfmDrlnms (0aexoir3iadfa ran s (0teuoxm3no4lp   nesls  Dra(mooo0ape ii3tatlaDem(ms u4teenmf3iytfatraneilt0trxm(opno1oltemiesat)srumxmpot1aptomieilslm ua(vs;t0artoxrctadfpD auvi s sexrxmpou4alenmivtl()sDtmumoou1olxnmf3iat s ulumo t4alerir3oydfm raneil() eto(m iu1amenmicilt)aDur(rooo0olt ii3iyt a rau sn(0aleomocoo1omDraieo t setoxopoo4op  mivsl( aDrrx pou0tpeniietlsla2ulu p;(4 rtnirctotla  lies;t t2um(m iy4apenlfeiltfaDra(rpno4ope ifciad m raumsnu4trtrxrciydfmD aues s)seum(m3iy4lm nmfcsls)srrrx oot0oleoioctls a2eau ont)tltrio tytfaDr i s;t0 etmim3iydap  mncia(f Dtrumo;o4alt  octldls rl(mo u4aetnmoctydfa rauvo t)sruoxopoo4ape mfvt () ruaxm nu4oleomi3ilslm ul( s t0tltrif3iadla e nvo;t seurxmpoodoleelncta()s2tmur nu0olxn ietytfsDeanvpn()texnxocoo1fptrlivo;(0 exr(r3iudlm nmfeils)sDta( ont4olto o3iadlsDua(vp (0teenmo3oatom eaneolt0t2xoxrpiodlp nmivilt)s2trurp;u4ole  ictat s2umn pnt)trenxf oa1optr u ols setm(m3iu4lpenmiesas aDta(r ot0olxnmfcildfa emuvs (4 rxrio3iatoa elnvol()texoim3iydlm elncil(  rtax  oo1tet mictld a2emnmp;u0trerir3iodoptelivo t  exo(r3no1olt  ivta()srur(rpnu1altn feiltlaDrm(vsnu)alxnxo ootoaD aieolt) rxoxr oydop nlivils)s2ur(m oo0tex  i3ilt a uaums;()treomfctatfatrln ilt)teumirpio4ol   iciat sDtrxr oo1aeenmictytfs2rmnmp u4 ltrifcoo1oatr uei;s0t2ur(r3iu1apt mncsa(  rtrxmpnu4apxnmiciytlmDemuvp t4 renirctydop eauvi;(0t2tr(m iu1am nlici s sDuaum no1oetoiociysfmDuan p;u0teeomfctadoat luvs;t  rurio3oudole  fvtat) 2umxr nu1aptn f3iytfmDua(mo t0aetrir tatoatrauei;(  2xoxo3iu1ap nmfesa() Drmxrpnt4olxomfetyslm em(vs t) reomf3iy1oaDe n s s0tetmxr3iy4lpenlnvta(fsDumur ;o0tetoifeiyd aDuau on(0aexomf oa1fpteauvo (0 rur(m oo1lpe miei tfaDrau  ;t1tpt if3tltla2emu pnu)alxomf3tytla  lies (0s2ur(o3nodamt mieil( sDtrxroou0tpxnioctatfs rlu s u4alxrmr3io1oate u olt sexoxr3io1lp   fei t a2tmu  ;u1opt iictltlm2um(vs;t0arxoio oa1fm rlivi;(0 etr(opiodol elics s) rrm(monu4oltoioetyt s rluvp;() rtrmrciadfmtraiei;t)t2urirpiodlpe lfes t)a2trumpno0tex moetlsla umumsn(0artnmrciotfpD luvo;t texm(rpnu4ope livils)aDtmxmpoo4tlt  iciyt a um( s;(4tlenirciydfptraiesls) rxmxm iydlmtemiei (fsrurump;u0aptomoeiydls2elnms;u)trtnircia1omD lu sl( srur(r3iu1am nmfvta( a2ur(mpoo4oexoifetydfa ul(vs;u)aetrxociatlpt lneo;t s2umxo3oy4amtnlfesl()aDtm( pnt0tex  f3iytla rm(von(0 eenxocoodoaD au s s)s2xrir3ny1ol nmfvils srrmu  ;o4apxnio3iydfa2ranvo;(0teermo totfaDr nvo;(0setrxmpou4ale lictlt srra(  ot1aptomietydlmDrm( s;u)trxnio oa1lpDelnes ( setrimpiudam nlnvil(f 2rrxr oo0apeo ieiadfs rmn p;()arxnxo iytfp r u s;s0trxmir3nodlmen nviat  Durumoou1aptomfciysfmDuaumo t0trtrir3iodlp   ivi;( s2to(r iodlleelfei tf rrrxmo;o1tpen i3tasfs emnmsn(0alenif3tatoaDraies;s)seuoir3iu4al nmieia() 2tmx onu1altniictyt s2uaumo;(4 ltomf3iodomtr neol(  eurim oodlmt lnctlt  Draxroou0tpt io3iyt m rm( o t)tltomocoa1fmDr i il( trum(r no4open nci t s2tmxr ;o1aet moeiys a2eau pn()treomfctatlm e ivsls sexo(m oo1apt  ncsa() rraxr ot4aexnio3iydlm2ua(mp u4tetnircoa1laDelivo s0 rum(r3nydlmtn fet t)a2ua(r oo4tltnioetyslsDul( sn()areoir3ty1oaD aiesl()teumxo3no1lle  ivt sfs2raxr nt0altniocild s el(vo;u4 exoif oadlpDr iei;(0sexmxmpou1opt licta()sDurxro;u0apto o3ilslm2el(mpnu0 rtnxf oytfaDr ieo s srumiopiy4lltn ivtl(f ruax o;t4opt io3tltfaDul(ms (4areoio3tytfp  li o;t) 2trxmpoodoptnlicia( aDtmxmpoo1tlen fetytfm2rluvp;()altomfcta1fptr i sl(0trxr(o3ny1om e fctas  rtau pou1olxnmi3iatfsDrl(msnt0treomf oatoa ranvs;t srtmxo iu4alte nvt (f 2tm(r ;u4oetn o3iaslm2ul(mp;t)arenif ty1fa  livo s) etoim oo1lmtemieils) rrru  ;t1opt mfcilt m2rmnvpnu4aetomfciatfmDe ueols trtm(r3ou1oltn fci t aDrauro;t1tlenmi3iytfs2uan on(0trenxr oatfaDraieolt0 rxoxo3nudoptelict ( s2tmumpot1aex  oeilsfmDumn p;t0tlerxf3tadlpt luvil( seumxrpoy1ol nmnetl()aruauront1optnmf3iad s rm(vp t0trerir tadlat anvo;s t2urxm oy4ole  icsl() Drau oou4ale  f3iad mDelnms;(4 lxomf3oodoptrlu o t tetmio3iudlltemnvt sfs2uax poo0ole moetadfsDumnmsnu4tltnxf ia1fateln o t0setrxm nu4lp emfvtlt)sDtaurono0tptnmiciysls2umnmonu)altnxfcia1lp eaieils0texrim nydolt mncs tfarur( oot4apxoioctatlm um(ms;(0 exrir3tydoate nei;s0seur(m3oydamt mnvsltfs2um( o;u1teenif3tld sDrmnvs u4aeeomfciy1latr ieolt0 etmxo iydoltn ivtltfsDrrxr nt4oee  i3ilt s2rmu p;t4tltoio3oadfpteau s;t s2xoim iy4op nlieilsf Dra( p;t4apxnmicias a2ul(vp u0trenxfciydla e ivs ()t2xoiopny4lm   ies (fsDrrx p;u1oexo iciad aDemums;t4arxoif to1omDe nei;s srtrir no1amtn fcilt aruax ooo0tetn o3iadfm2umu pnt0 rxnxfciadlpDr nei t t2toxrpoo4opt lfci s)a2tr(ronu0tpx  fciyt a2ra( o u)altrio oodlm ranvol(0sexr(r3iu1lpe mfes s  2trurpno1alt  ictld sDrluvp;(4teenmrctadoaDelneo;(0 exrxm3oudlleelivs sfa2ua(rpot0teenifciatls ra( o;(4texoxfctytomteai i ()setoxm3nu4ope  icil()aDtaurpnu1oexo oetldls rm( snu0treomf oatomD lnvo;s setmim3ny1ol nlfeslt srrr(  no1tltoio3tydfs2uluvo;t) rerxociytlptrauvilt)s2xrxmpoy1op   nvslsf Dtrump;t4oeeomf3iadfm2ra(vs;(0trxnxr3ty1omDeluei;t0setoxo oo4om emfeiatf Dtr(  ot0aet mieiad s rm(vsn(0 exnir3iadfpD au o ()teuo(m no1lpt  fet s a2ur(rp;t0optnio3tad sDea(msnt4 lxnxociy1opDrluvils0sexr(r3nodll   ivsls)a2rrurp;t1ope mfciad mDumnvpn(4trerio oa1oaDranvi;t)t2tmir no4lp  lfcsat)sDrr(rono4tptomf3iytfs rlnmsnt) eermfcty1lm e u i t trxm(r ny4optemnctl()aDraxr ;o0oeeomfeiydla2eanvs t)tlenif iotfpD  u s ( trxrio3no4oleemivtas) 2taur ;u0oeeomoetatla2ul( pn(4arenif3todomDeli i s)texmiopio1ap  mict s srtm(moot0aptomf3ils s2uln sn(0 eeoif iotoa rlnvs;s trumxo3ou1om nlncsat)arta(mpno1teeoioctyslm rauvo t0tlxnmrciotlpD lneils0t2uoxopny4lle mics s)a2urxmpou1olxn oeilsfs2ra(ms;u4 leoif3oy1lm r n il()s2um(mpoodlptnmfcils  rrm(mpoo0tltn ociytls2ea(mpnt) rxnxrcoodfmDe ies;()trxm(r io1lp n fetls) Dumx  ;t4tpxnmfctyslmDem(mon() etrmo oytlat  u i s texmxr iu4alt lfci t) Dua(  nu0alto fctytlaDem( p;()tlxnir3oodoptelues s) 2tr(rpoy1lp emfci t) 2rm(  nu4apxnifciaslm2emuvp;(0 etnio ia1lpt  ivo;s0sexm(r oo4ap   ici t) Dtaxr oo1teeoiicils m elump t0trxrmf3oadlmD lieils0sexo(o nudome lics t)s2tr(  nt0alt ifciasfs2rln o ()tltrxo ta1oaDe nei (  2toim nodomen fvs ( sDurx  ;t4optnmi3tysfa rln s t0tlxnmr3iydopDeli o (0 etm(opio4lltnlfvslt)sDrru pou0tpeoiociasfa raumpnu4tlxrxrcoa1lm eaivslt0 rtoxmpoy1optnlnet s)sDrmx  nu4aexnmieiyt a2ua(mo u0tetnifcoodlpDr ivi;t0 exriopnu4lm nmfvs tfaDraumono1oeto iciadlm rm(vp;()tlenxo3tytfmt luvs;s)t2tmim3ny4lpe  nvs s)srumu  no4alxomoetydfm2ua(mp (0aexrxo iydlmDrauei s sexoir oodop e nvils arrm( p;t1ope ioctatls ea(vs;(0tlxoxf ty1oaD  nvilt)s2to(rpno1lpe liesl(f Drrx  ot4oexoiieiltlaDrm(mp (4 rxnio3todfpDe u s;s)srxm(opiodlmee nvi t  rtr(  ;t1aeeomoctat m emu snu4arerxo iatla e ieo s0 2tmir3oo4op nlivta()aDta(rp;u1opeo o3iad a rmnvon()tetoif to1lpt aivi;( setr(mpiy4lpe lies () rrmumonu0tpenmi3iasfa2ean p;t0arxoir3oytlpt  uvi;(0setr(r ou4om  lfvi s)s2umur ;t4apenmi3iydla2rlnmo;t0 ltrmfcia1fpD lueslt  exmxm ou1al nmfcsls  rrmxr nt0tpxo ieiadlm2ulumo;()tetrio3totla elneo t trxoim io1ol nlnvtls artax  oo4tptomf3iyt a2rauvs;(4altomocty1fmt au sls0s2uoxr ou4op nlfei s a2taxrp;t0tpenmo3iytfm2emnvs t0tltoxocoatopt au il( teuo(r3iudomtn ivi tfartmxr ;u1olenmoetadfa2emuvo t0altnmf iotoaDrauvi t0 2xmxrpiudlmt lfesls) 2urumpoo1alx if3tat s2rlnvpnu)alxrmfciodomt li ilt)setr(r ny4amtnmfesa( arrrx  nt1aeeoifeiatlm rmnvp;u4artrxr3tadlp r uvs ()texrio iy4lptnmfvt (fsDua(r oo4opt  ociltlaDuauvont0aetnmr3oadfa  li o;t)texrxm nu4lpeemieiat)aDrmu oou0aetomfetadfa ua(mo (4alxrif oytfm rauvs;s  euo(r3iodomen ivtasfarraumont0oeenmfeiytfs eanvp;(0 lxoxociodlpDrli ilt  rxm(o oydope lfesls arumxmpou4aet  i3ild s rlnvsnu4 lxoiocoo1fatrlu o;s)srtoim nudame lnvsl()s2tmxro;u0aetn octytla2ua(vsnu0altnxfcoy1lmDe ivsl()teum(mpoydalenlnvsa(fs2trxrpou1alt mf3tltfa eln sn(0aexnio3iy1lmtelueil(0s2trxr iu4lpenlicias  Drmxm oo4oexnmieilsla rmnmp;u0 ltrioctadlptran ols  euriopnudamt  iesl()arrm(mpot0opeomi3tyslm ulumo;u)tltrmo3oydopDr ieo;s  rxrimpiu1lm nlietlt s2rr(mp;t0olxoiociat mDemn s;()tltrifcoydlpDran i ( texr(rpoydlle lietl(  Duaxmo;t1oltoio3tytla2um( onu0aetnxr3tadla e ies s t2uoir iy4ol n ivias aruau  nu1tlx iietat a2um(mp;t4 etnxf3oa1opD li i s0tetmxr3oy4alte nvtl()s2umxmpou4tleo f3iaslaDulnms;(4trtnxf oydomDe u sls  euoxm ou4llenmictlt)a2trurpou0texo i3iyd s rm( snt)aeerifciotom rlivo s  2toir no4lpe mivs tfsDtrur ;t4tltoifctydfs eln p;t0texriociydom eau sls0 2umir3no1ome mfcs sfartmumpot0aptn ociatlm2eanmsnt4tlxrxo3ootom eauvs s0s2uo(opnu4op nlfesls)arrm(m ;o0ale  ieildfm ra(mo t4tlxrxr3oodfmtrlu o;(0srtmxo3nodap e iesat  2tm( ooo0oetnifcias sDrmnvs (0tlxrxr3todlateaiei;s0setr(r3nydlle  ivi t  rta( p;u0oex  ociydfm emnvsnu0 reoxr3tydlmD auvsls0setr(m3no4llt mivtlt  rtm(rp;t4olt mi3tlsls2emuvs t)aetrifcoo1lmDrlnvi t) ruo(rpou1lmeemneia()sDraum ;u1teto ieild m2eauvsn(0teermr3oadfm eauvo;t)s2umxm ny1ole lfcilt  rtrx  ;u4tet iiciyt a ulu p;t)aeerir3oy1lat  iei;(0 euoir nu4omen feta()sDta(m oo1apeomfciytfs2ea(mo ()texnxo tytlmtelu ols) rtriopio1llt lnes t)srrr(mp;o4tlen f3tydls2ua(mo t4trtrmo to1fa   ivs s  rxoiopou4om e nes s)a2trumono0tee  f3iatfaDeln snt4trtnxf iadlptrauvsls) rxmxm3iy4ol  mict s arra(mpnu4opt iocils m2ul(vo;u) ltoxo3oa1lmtraivil( trtmxo iodalenlnet (fsrraxrpnt0apt  i3iatlm2ulnmsn(0trtrmfctodoaD lnvols0s2tmiopoodlmt lnctas)srtmu  nu4ope  fciltfaDeauvpn(4trermociadla rln ol(0srxm(opou1ol nlnetl(  Drau poo4apt  fciadfs2ul(vo t4arenxocoodoateau sl()seumxrpiu4lm  mfct s) Dtmx  nt4tet ifeiysfsDumumon(0altomo3iatopDelueslt) 2xm(r3oy4lle mncsat)aDua(monu0tptn i3ild sDelnvs;u)alerifciy1fpte nei;(0seuoio oy4lmeemfvtas)aDumumonu0tlt  i3tldla2elnms;(4aleomr3iytfmDe u i;t)trtmirpno1ap nlnet s  rurxr ot1apt  fciatlmDrlnmo t4arxoir iadfptelneils0 2xr(o3iy4alt micsas)a2ururpnu1tle mfeilsls2uaumon()tlxnmf3tadoa eaueol( s2xr(r iy4am n nvtlsfa2rm(rooo1oexoioeilsla uanvp;u0 lxoif3iadlmD  ies (0 exo(r3oydlmeemivils a2urxm oo4apto ietld a2eanvonu0artomo oytfpDeaueo;t t2to(m nydom elfcs t arrmu pnt4alxniieild mDumnvpn(0 lerxr3totoaD aueo;(0 eto(r io1al nlnetat) rtmuro;u1apxnio3iad sDrmn on()aetnio totoa elu i;( s2xoxm iy4alee nesa( a2rmumono1aeenio3iatls rmuvo;u) rtoir3oytopteln i ( sexo(r io1oltelnet s sDrax pou0alt mo3tadla2umu ont4alxniocta1fm ean o;t0s2xmio iudome mietltf ruaxr ot0ope mo3tydls2rm( pnt4 lxnxr3oy1fmt liei;t trtr(m iu1aptnlncs sfs2tr(ronu4oexo ociltlsDrluvp;u) etnxoctodfp  lieolt trtmim3oo1amt  nei sfaDtrxr ;t4tex iieilt s2rmn onu4 ltrio io1op  lueol()seuo(r3no1lme lies s a2ra(rp;u0apeoifcilsfaDuln snt4trxomocoodoptr i s s) 2to(opno4lle mfei s  2tmumpot0altomf3tasls rmu p;t)aetnmociy1la raivolt sexrio3oo1olte icia( sDur(r no1aptnio3iysfs2uanvs u0teerirciytfat luvolt s2toir3nu4ol nmivtlt) Dtmxrp;u4tpeoiieiasfs elump;t4 eermocootopDr ieil(0 etoiopnydlpenlfeilt)s2ua(m oo4tex  f3tytfa2emumon(0teerxo3oydopDeanes s0 exrio nodole mnvsa(  2taxmpou4alxomiciydlm emu ont)alerxo oytfmDr ivo ( tetrxr3ny4opeemivi (farur( pnu0apt mo3ilt mDuan o t4aexnif ootoaDeluesls) rtoxm3iy1lmtnlfcs (faDrmxm no0oeen oetlt s2rl( s ()trerio3oo1oa e nei t0 rtm(r3iu4opeelieil(faDtmu  ou4tex  feilt m2elnmp;u4 leriocta1opt ln o t0 euo(m3nu1amt micia() Dtax  nt1tpe  icias s2el(vo;(4 rtnmfcoydom r uvs (0s2triopio1oleelneslt)s2um(  ou1oetoifctytla eluvs t)altoio3tytfmtrlieo t0 2xoir oydamt  fvta()sDumx o;u0tlxn i3ilslm2rm( snt)aetnir iydla  ln i;s0teto(m ou4lpenlfeils aDtrumpot4olt ii3iydla umuvo;u4 exrmr oatfmDrauvo s0 ruoimpnu1oltnlfei ( sDrru o;o0aexo feiasla2um(vs u) rxrmr oydfmDrauvi;(0trum(r3oo4oleemictatf Dua( onu0apx  ieilslmDeaumsn() leoif3tytfaDrauvs;(  exoxrpoy1omtnlfvs ( sDua(  nt0tetn fctlsfsDua(ms t4trenxf iytla   n o;s0setrirpno1alenlnvs (fa2ua(rpnt0tlxo oeiat a eanms;() etoxr3iadfaDrlueol() rxm(rpno4apenlivsls aDraumoou4tleomoetltlsDel(vonu) ltoio oadfp   nvs;s s2ur(o3nudale mnei s  2uax oot0apx ifcilsls2ulnvo;(0alxnxo oadfp   ivs ()s2um(r no4am  lfeia( sDtaump;o4tpeomicild m elu o t4alerir tatlm  auvs t0t2tmir nodal elfvtat) Dumump;u0tltomf3tas aDrmnmpnt4teeoxo ia1lmD li slt  2tmimpnu4lmte fvilsfa2taxmo;o4teen ietytls elump (4teeoio3iatlmDe ues;s0tetrim oydlle mfvi () 2ra(mont0oee ifetytlm2ulu pnt0trenir3ootfmDraneo;s0 etm(mpiy1ll  mfcsl( s2um(mp;o4tltn f3iysfm ul(ms t4treoif io1oa elu i t)t2uo(r3nudol e fcia()srur(m ou4tlt mf3iadlm rmnms;() exoxo todom  ln ol( setrim3iy1amtemnvt s a2taur oo1aet mfciltfa eau onu4alxnmfciadfm  livo;() 2umxmpoo1amen nesat s2umxmpoo1tpenifciat a2rauvsn() etomr iydomt  ueo;(0 etrimpno1om nlivs ()arur(rono1aetomieiadla em( o;t)tleoxf oa1oat  ieilt0s2ur(r3oo4lptemnciat) rtm(m ou1tlxn i3tatfm2rmuvp;t)aetrmo3io1lmDeai ols  rtmim iu1am  mnet sfs2ta(ro;t1teto oeiys mDrm( s u)texnmrcoytoa   ieo;(0 2uoim oydlle  fei (faDraur nt0tee mieiadfa emums t0 exoiocoatlpD ai i;s0trumir nu4llt  nvi t)s2tm(rpoo1oetomietysls2rmu p;()aeeoirctytfate i o ( texoimpno1ope lncs s  2ur(mp;u0oltnmi3ildla rmnmsnt0teenir3oy1lmtelieo s) 2toxo oydal  miviltfaDtm(mpnu0alenio3tld sDum(vs ()texrxfctadlmDrlieolt) exmim3oy4altnmnesas)sDrr(rp;u4ope iictltls2rauvp;()alxomf3oatfpDeanes;t0 2xm(m no4omeelics ( a2rmu ont4apen i3iaslaDrauvo;u0 ltoio3iatop r ivi;s  2tmirpiu4lpt mnct ( sDraur nt4tltn oeiyd aDul(ms t)tetoifcoadfp eln i;t trur(o nu4lp  miesas sDta(roou1tlx  oeiys m2ranvo ()tlxrif iatomt lnei;()t2xo(o3oy1ame  fvt tfsrtmxm oo0aetoifeiasfmDel(vo;(0tlxrxociatla rlu o;t)teumxm oodaptnlfcs tfarrmxmpno0oetnif3tytfm umnmp t4aetomfctytopDeai sls s2xo(r iydop elfetas)a2trurooo0oet iicils m2eanmont)texomr3tatfm r u i;() exm(mpnu4lm   fesas a2ta(r ot4aexn i3tytls2ua(mpn(0aetrifctytfp eanei;s)srtm(o3no1apt lfes t)srraur ;o1oet mietadlmDum( s t4texnif iy1oaDr uvolt0 rtmim3oydolt  icils)s2tm(m ot1tlxnif3iadfa ra(mpnu) lxrifctydoatraieo s t2xr(r nydlptnlictas  Dtru  ;u4aptnifeiysfm el(vpnt0alenxo3iatomt liei;t  2xriopiu1omt  iesat) rtax ont4tpx mieiltla2ra( p t4 etnmr oa1fmtr ueo (0 rur(opnu4lp  mnvtl()sDrr(rono0olxniieiltfmDul(vp;t4tleoirctodfpDr u s;s) rtrir3io1am nlfetas srrmxrp;o4tpxnii3ilsfsDrmuvon()aetoxo3oatopt auvi;t)texrim3nu4lltnlfeia()aDrm(m ot1aetomoeiltlaDrmump t4 leomrciytlpt luvsls s2xoimpoo1omen nctl(f Dra(  nu4oex if3iltfaDelnvo t4tlxrxr oatlpteai i s)seuoir3iydol nmfciat)sDtm( onu1apeniieiydlaDel(vo;t0 leomr iotla  aueils) 2xrxr nydlp  lfct s)arraum ;t0tlen oeils aDemu sn(4tlxrio iydfpDelivils0trumxopno4om n fcsa()s2uau ono4tpe  feiysfm2emn on()alenir iadomtrauvi s)t2uoxm iydlp  lfvs s sDtaumo;u4tet  o3tatla2ul(mp ()trerifcoydfpDr n o;s)t2urio oydap n iesl() rtrump;t0olxn fciadla2eluvo u0trtnmocia1la  anvol( t2urxo oo4llenlfesltfa2trxroou4teeomfeiltls2rm(ms (0 rxnxf iydomD lnvols sexo(r3ou4ap nmict sf Dumu o;o1tle mieiad m2rlumon(0alermo3oytlmDraiesl() 2tmiopou4am n ncil(  rrrxmonu0tlxo fetat s rl(vpn(0 reomrcoa1lmDe nvol(  rxm(rpio1lmenmfvsas)srrm(rpoo1ape  ietatfs2ran p;t0altrxf3ty1fatrlieo s) 2umxmpoodamtnmiet s arurx ont0ape  feiysls2rmuvsn()tlxrxfciytop rlnvo;(0 2uo(opiu1alt  fei t s2ta(  ;t1tlto ictadfs emuvpnt0altnxr3iytfpD luvo;()tetmxmpou4lltn fet () Draurp;o1tptoifciytlm2uan snt4 eerirciatfateanvil( texmiopno4aptnlfcslt  rtmxr ou1opxnio3tys a2el(vs;()arerxoctadlaD  iei t)srxo(mpiy1oltelfvta(  rtaxroou1apxomo3tadla elump ()trxnxf3tydla  livilt)trxrirpoudoleemnes s)sDtau oou1teeoiieiyd m2ua(mo;u0aeerio3ia1lmt  nvol(  rtoiopiy4apee nesat a2tmxmpot4ope iiciys s2ulnmp (4 etnmr oy1fa rli sls sexr(mpoudlm elict t)a2tr(  nu0texoioetys s2rau s;u)arxrif3iatfp rlnvi t0seurir3iy4am n ivsl(  2umumoot4tetn i3iadls rlump;t4artomr3ootomDelu ol(0 rtrxmpnydam  micsat aDrr(  no1altn i3ilslsDel(mon()tlxnir ta1faDr nvols seuo(r3nydoleemiesl(f Drmu o;t1teen fciat s rlnmp t)teeoirciotoa eliei s)t2urxr oudlp nmiei ( sDrmxront1oee  o3ilt s2elums u4tetnxr3oo1lm  luvolt  2umxm no4am emncia(fsDtax  ou1openiicild m2raumont4aetnxf3iotlaD aivi s)seto(r3iudlltemfvia()sDuru  no1alxnmieildfa2um(vo u) etnmrcto1lmt luvi;t) rtm(r3iy4ap n nesas)a2umxr ou4apxoioeiltfaDel( o;t0treoxo tydlpteaieo ()t2xo(opoy4omt mictlt  Dta(rp;u1opeoiociasla2rmump;(4alermo ia1omtrliesls0tetm(o iy4llt  fvsl(  2tm(m nt0tex  ocilslsDul(vp u) leomfciydfa e u i (  etrio iudop emfvt s sDta(r oo1apt ioeiyd a umnvp;t4arxrxr3oo1lmtelivilt0 2uo(o3iydopte ieia(fa2rm( pnt1apt mocild m rmu s t4trtrmrcio1oa   ueo;t)s2xr(r oo1aptemietl()srtmurp;u1oleo ictlt s2el(vp (0trtrxfcia1oat  uei;(  2trxr3iydamt  fct t) Dtruronu0texnmiciltfm2rau onu0 exrxocty1fpDranvi t setoxo3oudlp  mivi tf 2ua(mpoo4opto fctysfs2emuvo;(0altnxr oydfm  lueo t0 rxrio3iodlm   fvta( sDum( oou0tlto ictadfs emumpn(0 ltomocoadfmDrluvol(0texmim3no1altn fvtl(farta(r nt4opx ioeildla elumpnu) lxoio3iotfpt  u ols)teuoir3io1optn iet s)srua( o;o0tpen iciys sDeln s u) rtrxrctotlp rluvs s0srurir nydap nmfvt t aDumxroou1tee mfctlsfm uanvp u4tetrifcio1fm  aiei s) rxr(rpiu4om elfctasf 2tm(moou0aexnio3tlt s2um( o t) rtniocoo1fmt an o (  2urxr ny1lltnlfetls sDtmx ont0alxoioeiydfm raums u0 renmrctodlp rlueo t  exmimpou4op   nvi ()aDtmx pno0olxomf3iltfsDuanms u)arxoxfctadomtrln o t0 2xrxr3ou4lmeemnvsat  Dta(rpoo1aet iietasla ua(msnu)aeenxfciadfa  au o;s0texrim oodlpe mnetlt  Dtrxmpno1tpxn i3tas m ran p;() eerircoydopte nvi;t  eumxo iu4opeemfvi () rumxm ;o1olto f3iydfs2rlnmp;t4 exomf oy1omtrlnvo;s s2umxr iy4lpte ncs sfarum(mpnt4alxnmf3tlt a emnmp;(4 lxnmr totlm e nvi ( srurxr3oo1al  lfvt s  rum(mpou4olx iiciltlsDulnvs;u4arxrmrcty1op   u o t teuo(r nodamtelnciltfs2rru  ot4oeenmfetyd mDumnvon(0altrir oodlm rln ol(0teur(m3oo4ope mncsa() rurxrpnt4oexnmfetys sDum(mo u4aexrxf iatlaD lnvi;()srxrxo3ou1aptnmfvsls  Duax p;o4tpe if3iytlm elnmp (0treoxociodla  li ilt  rum(o iydolee ncsl()srtrxrp;t1olen fetldfm2umnms;t4aeeomrcoytlmD anvi;()seumiopou4lleelieta()sDtr( pnu4aexnioetyt m um(mp;u)arermfcta1oatr i i ()t2umxmpio1om  lfcsl(f 2tru  ;u0opto ieild s2ua(vsn(4aexnio3oadfptelnvi s0sexmimpiudol elfci sfsDtrxrpno4tetnmociaslsDul(mp;u)aleriociydopDeluei (0 exo(o3oo1al n ivi tfa2rm( o;o1apt iieiad s2uln s t0texnxr tatfmDelu s;t) rtm(rpiu1ol   fcia()sDra(rpnu1oeenmi3iaslm umn p;u) exrmfctytop elnvs ()sexm(o no1oltemfvtltfarur(rpnu0alenmo3ildlmDemumo ()teerifcoydlpteauvs () rxr(r3oydopenlfcsas)a2uax  oo4oet mf3iysla2ra( s ()alenxf totfmtr ies t)teurxm ny4olenlnvsas  2rmxr nu1tetn ietyt mDulnvonu4alermo oytfmD ai i s0srum(mpny4lpt  ivsl(f Dtaumpnt1ole  o3iltlaDel( sn(4tlxoiocoo1opte u s;s0 2xo(o nydlmtnlnetlt aDtrurooo4opxo fciyd mDra(vp t0 eenxo ta1lm r n i s)trtoimpiodlme mfeilt s2trxmonu4oee  ictys s2el(vo;t4teenif3io1lm r nvol(0 rxrir ny4lm   fviatf Dtmuroot1tptn fcilsfa rmu onu)aexoxrctodoa rlu i;(  2tmxr3ny4ape  ivsl( srrr(m ;u4olxoii3iasla2emumpnu)trxnmr3iotopt  n ol(0 eurxm3iydlm n ncsls)a2rrxrpot0tleoiictad s2ua(vp u4trxoifctadomt li i s)teuo(o3nu4optelfet s)a2taxroou0tet  fciatla2emn s;u) etomocootlmDr neilt0t2xrio3nu4amtnmfcta( arumxrpno4tee if3iydls2ranmp ()altrxr3iatopt  n i s)srumio3iy4al nmfvtatfs2rax pnt1apx iieiadfa emn on()altrmf to1fpDelu o s)trtrxo iu1om  livil(  rtaum ;o4opxn f3tydfsDrln p t) leoir oatlatraneslt) rtmxm3oy1om nmfvsasf rrmu oou1tle  o3tyslaDum( s;u) leomr3to1fmtr iei;()srum(o io1lmte fvias  Duaurpoo4tee  i3tat a2rm( o;()alenif3oytfaDraueilt0setrxo3iodoltnmfvi (  2rrumonu1tleomo3tadfm2ea(mont0 lermo3iy1lm rau o s s2uoxr3ny1al n ivtls sDtrxrooo0oltniieiltfs eanmo u4arxrmoctadfate ivils0tetr(rpnodamtn ivi t)aDrm(rpnt4ope ii3tlsfa2eln s t)trxrxf oo1laDr nvilt0tetoirpoy1olt lnvsat a2rax oot4aet if3iad s rlums u)altnmf3oatfmtranvi s0 rumxr3no1lleemicil()sDrmxrp;o1olxn f3iysfm rmumo t4 rxrmr3iotfatrlu ols)srtmim oo4ol  lict sfsDrau ono4apto i3iltfmDranvo;u4 rxnmo3oo1lm rln s;t)trtm(opoo1lltn net tf Dtmxmpou4aetomieiltfsDumuvo;u4teeoir3oodfaD ln slt s2to(rpiy1aptn ici ()aDrr(mpno4oetoiictadla2rl(vont4 lerxfcio1oaDraueo () rumxo3iu4omt lncs t)a2uaum nt1apeomfciad mDelnmo t4trtoxrcio1fptr neo;t  etm(m3oo4aptelfeta()srumuro;o0aexoifctls aDemn on(0tlenmociadla eai s;( s2urxm3oo1lm  mfct t  2tmumono4tptn f3iyt mDumn o u)arxnxo3iotomD ai i;t) rxoxo3oy1op nmnctls sruaxm no1apxn o3iysfmDum(vp;u4arerxf3iotoaD an i (0 rtr(r3iodoptn nci ()srraxr ou4aetomo3iys m umuvp;t4tlerxo3ootfa rlnvol(0trtrxm io1lpe mnesa(  2rrum oo0olx  feiysfa2emnvsn(4aetrmfcoodlateanvi;(  rtrxr iu4om nmfcsl()arrrxmpoo0tleomfeiasla uaums t4arxomf iy1lpDr ueilt0 2trio no1al  lfesls) Dua(mooo1ole mf3ilsfa2rl( onu4artoif ty1om eai s;(  2umim oo4alenmncsa()sruauront4tpt  fctys s2ra(mpnu) rerxo iotlp  lieo t)setoxr iydam n nctas)s2rrur oo4oee  fctatlmDumnvpnu4aetoif3iydlpDraieo;t)s2xr(rpny1llenlfvi s) Dtruro;t1tptoiicilt s rluvs u)tltrmociadfp e n i;( t2tr(o3oo1op   ies ()aDrmu pnu4aeeoio3tls m2uluvs () ltrxfciytla   u il(0 2uo(opoo4am  lfei sfsrra( o;t0openmoetys a2emnvs;(4 rtnxocta1fpD  ueil()srtoir io4lltnlnvs t) 2tm( p;t1oltnmi3iyd sDulumsnt)trtoxr oodopte u o t sexm(m oy1lmeemfetas a2rmu onu0tpe mf3iytls2eanvs;u4alxrxoctadlaD lneo;(0trxo(m3iu4omtelfvtas  Drr(mpnu4tlxn ictldls rln snu0arenio3totlmtrln ils  rxm(m iu4lmt mfctl()aDurum ;o4tpx iociaslm ranvs ()teermociy1opDraivsls  rtm(m3ny1lpte ict (fartr(mono1tee iietyt sDemumsnu)tlenifcto1la   uvs t0seuoxopiudoptemnei (fsrtm(roou4oleoiieiadls eln p (0altoirciatfa e uvo;(0 2urxm oy1apeemnvtlt aruauroou4olx  iciltlm2rmumsnt0altoxo iydfm r nvo;s t2umxm ou1lme lfvsat  rum(r ;o0oeenioeiysfs2rmnvp;t4tleoio3iotlp elu i;s trum(opno4op e iviltf Dumum ou0aeeomieiatla um(ms u4tlerxr3iydfat aivolt  exmxr3ny1amtemivs tfs2urxmpou4opxo o3tyd aDrlu p;u) lenir3oy1optranei;t) 2tmxm oo4optnlfet s) rtm(rpnt1aetn ictysla el(mp;u4teermrciotlmt lneolt0 rxoxm oy1apee fvtasfarta(  ou4tlxo ieilsfa2rlnvpnt4tlenirciodop rlivs;s)setoiopoy1lp nlncia() ruaxmp;t4aee  f3iltlaDuanmonu0 exoifcio1lm eluvilt)srtoxmpoodameemivtlt)sDum(mpno1olen oeiyd a emu s ()aeeomocoodopt  i o;( t2uoxopiy1lp elfvsl( artmurono4ale iicildfs2elnvsnt)tlxoxf3tatfpDe neolt  rxrir ny4amee iviatf rrmx p;o0tlt io3tat sDua(mpnu)aexomo iy1lpDraueilt0setmiopiu1ol  lneia(farta( o;o1tex  oetysla ulumpn(0teenio3iy1lmDeluesls s2tr(o nudlmtemnesl(  Dta( pot1aee ioeiysfsDrmump u0 rtnxf3io1omteaueols)setmxopnodll emivta( sDrmxro;u1oex mietasfm2el(vsn(4alenmfctydfp rln il( sexrxr nu1lp n nes ()arta(rp;t0oexomfetyslaDum( s (4 rxnxo oodoaD  u i s0sexmio3oudlmtnlfvslt srua(mo;o1tpeo oeilsfs umu snt0tlxnifcoatfaDe u i;()s2urimpny4optemfvtl() rraxr no0apx ii3tas aDua(mp;u4 lenif3oydlate neo (  exoim oydopt lfesl( a2ur(r no1ole mfctad mDranmp;u4artnxr3iotomtr ivolt)srxmxr3no4amt  iciat  2taxmp;u1aexo ieilsfs eanvs;(4aeenmf iadlptrauei s0t2xrio nu1ol e ieil(f rum(mp;t0tpe ioeiltfm rmumpn(4 eerxr ty1fpD lues () 2to(mpiy1am   nesat sDuaum ot0opx mi3iadlaDrl( p;u4aetoxf3iy1lpt aueolt setoir nu1op nmneia()artm(rpou4tlen fciydlm emn snu4 rtrir3oadoptrauei;t texm(m3nodolenmfci s  Dra(rpou1opeo o3tls s2em(ms (0aeenxf3tydoatelnvs () etmir3oo1alee iesls  Durum ot0tetoiocildfm2umn onu4arerxfcta1faDrluvs;s texoir oo1omtn ies ()srtr( onu4oleniocilt m umuvp;u4 exnxo3io1opDraneols0 rxrio iydameelfctasfsrraxmpoo0aeeo ieildlmDean onu4 lerxr oa1fatelues (0srxoirpoy1omeelnciat a2rrxm oo0olt if3ias sDrlump (0arxnmr3oodopDelivi t)sexriopoo1lpenlictltfaDtm(r ;o4apxn o3tltla um( o;()aleoxo tytomtrln s (0srtm(m3oo4ll  lfet s aDtaxmo;o1tpxnmoetatfm em(vpnt0 etoxr oydfmD li s;(  2ur(o3iy1op  mncs s)s2ua(mpou1olenioeilt a umnvs;u)alxrmrctatfpDe ivil()s2toxo3oo1am   ieiat a2urur ;t1tee  feiltfmDeln onu)areoxf ta1oaD lnes t)texmxopoudoltemfvsl( aDtrxmoot0tetnmiciasfm2ua( s;() exnxr iydoaDeaivo s0sexo(r3no1lmt mnvil(fa2uru o;t4tex mo3ild sDra(mo;u) renxo3oydoa  luei ()t2xrxr3io4aptnlfet sfs2rm( pot4tex iieiltfs2ea( p t) ltoifcta1opte n ol( t2xoxo ou4olt  nesa() rrmu o;o4tex  feiyslmDrmuvsnt0trermocoadoaDraneolt0 eurir no1om e fvs tf 2um(root1oex moctyslsDuanmpnt)arxoircoa1opD aueilt) 2xrimpou4apt  ncia()sDrr(rooo0olxo ieiyd m umump (4tleoif totomD auvi s0tetrimpiydal e iciat a2uaumpnu0tee  f3tydlm ul(vo (4alerirciotfatr u slt0 2uo(r iydaptemnvta()s2tmu  ;t0oeeomieilslm ra( p u4 eenxr oodfp ean o (0srtrxm ny4alt  ivi t sDtaum ou4ale  o3iltlaDumnmp;t4teeomo tytfmteaueo;s0s2xm(mpno1altnmivil()a2urxm nu4olx ii3tysfs2emnmo (4trxrmrcio1lat lieo s)s2to(opnu1apt lnvi s  2rmumpnt1alt mo3taslsDum( o;()aleoxrcoytom eliei;( s2tr(o3oodlme mfet s  2um(m ou1olt  iciatlm uauvo () ltrir3todla r ueo (0srurio3no1lptn ncsat) Dtaxronu4opxo o3iatls rmuvp;t4teermrciadlate u i;s0s2xrimpio4lptelfcil(faDtmur nu0aee ifcildlm2rmumsnu0alerxf3iydfp ran s;( seuriopoy1ape lnvsltfaDtr( poo4tpe ifeiytla2ua(mont0trxnif3ty1oate i il()seuo(m3no4lptn nei sfs2tmuronu4alxnii3tysfm2ea(mo u4aetrmo3oodlpDr ivsls) rxm(r io1ll  mfeil()aDra(r ou1oex ifeiyslm2eanvs u) ltomo3oo1oa eaueo;( sruoxm no1lpe mfvtatf Dtm(rpnu0ole  o3iadfaDrl(vp u4trxrxf iadlm rlnvils) rto(o3io4al e ivs (fsDuax  ;t1oltnmoeiatlsDrmnmpn(0altnmr3iodfa rlieo;t)setoxo ou4lmtn netl(fsrta(mpou4tee mfcilt m umn snt) lxrmrciy1fmte n ilt0setr(rpoydole  fvta(fsrtrxmpoo4opeoiicilsls2rlnmo;t0tleoxr3totlm   i sl(  rto(mpoy4lm   icsa(fsrumu oou1apxniieiydfs2rauvpn()aexrifciy1lat ai s;t  2xmxm oo4op elfeiasfaDrmu  nu4aex  octlsfs rmumon(0trxrxociydla eau s;t0 exmxo3nu4am  lnesat) Drau ono1alen ictyslm rmu s;(0aleoxf3to1oaDeaueolt) 2trxr nudlm emnci (f 2urur no4aex mietls mDua(ms;u)aeeomf3tytfpDean o () eto(r nydap nlnvt s)aDrr(mo;t1alx  ieiltlm2elu on()alxrifcoytoa   u s;( t2uoimpno4aleelivt (fa2tru p;o1tlto f3tltfm2rmn s;u4teenxociadfpD  nvi;()sexrxmpno4ol nmicilt aDur( pnu0opeo o3ilslaDuan o (4tlxrmocoytfmteln o;s0 rtmxr3nu4ole mnesltfa2uaxmont4aexo fctyd aDeanmonu0tlxrif oa1lmtr u i;t)tetmirpiu4omt  fet ( srrrxmp;t1aptnio3iydfs rauvs;u) lenmf3iatom rlnvo;() rxrxr iydamtemfeil( a2uaxr oo4oltoifciyd s elnms () lxrio oydopDrai s s0trtoxo ny4olee icia( sDumumpou4alxnmfciytfmDumuvsn(4artrif iadla eaneo (0tetr(o nudaleemneil(  Dtrx  oo1aee  oeildfs rmu p;u0aexnmrciytoa r u s;s0trto(r3nydlmen ivt s s2tr(r ;t0aee io3iatlm emnvs u4 etoxf oo1opt  neslt0tetm(m ny4om  mivtas  rtaur no4oet  fcils a2ulump t4tltoxo3iadlmtrauvi t  2tm(r iy4lmtn fvtasf rrr(root1altomi3ilslm2elumont0 lxnmo3oatlm  aieilt s2tr(rpiudomtemnvsas)srurum ;o0aexnifetydfmDel(ms t) lenif3oadfmDrlnvo;s0teur(r no4olen nei (fsDrmuroou0tlx io3iasfa uanvonu4 etrir3totopDraies t)trxmxr3iydam nlnvtl( srrmx  ot1opxomfctltfmDua(msn(0 lxniocty1op  au ol() rxmim3nu1lpe mncs t a2rr(rpnu1apxomo3iydfa2uau ont)altomrcoa1fp eau o ()teum(m ny4altn fcsltf 2trx p;t1alt io3iltfsDua(vs;t4altnirciatom e ueo (0trtmxopoo4omtnmnctas srrru pot4alx  oetydlm2el( p;(0 rxrmfctotfpD li s (0 2tr(mpnydlme lfcslt s2ra( ono0tpxo f3iadfa rm(vp u)tlenmf3oo1faDrliesls  etriopio1am n fes (f rrm(m nu0aptoif3ias s eaumsnt4aexrio3ty1omt aieolt0 ruo(m nu4apt mnet t) 2tax  nt1tleoioeiad mDrau sn() ltrif iytfp e ivi;()trtr(m3iudomtn nvias)a2truronu0apeoiociyt a2eaump;t)trxnif3oatlm  auvo;s0texm(opoo4ole mfvtasfa2rm(  ou1aptomo3tasfm elnmon(0tltrio tadoatrln sl()srxoxm iydaltelneil( a2rm( ooo0texniicildfa rau o t0tltoir iodlp raneo s trxmiopnu4amte ncsl( aDrrxmpoo0olt mfeiltlm2ulumpnu)teenmf oatlpD ai i ( trxmim nodaptelfvt s  2rm(mo;t0olx ifciad s2eluvs (4alenircootom elnvo ( t2um(opoy1altnlivta( srrm(monu0tleo iciat aDranmo u) etrio3oo1lpt  iei;s t2to(m3nu4lltn ieias  2tr(rpoo4tlt  octatfaDel(ms (0tleoxo ta1faD  uvil(0 eto(m oydop   ncs sfaDta(ront1opxomoeiydfm uanms;u)trxoxr oa1op  aneolt0 rtrxopny4lm elfvs (f 2tr(ronu0tpxo ieiatfm2um(vsn(0 rtrmr3tydfmDr u s s srtr(o nudamtemics ( a2ra(mo;o4tleo oetytfaDrm( ont)tlxrifciytlatr ieo;t0texo(o nu1am  lictas  rrr(  ou4oleomi3ils m2emu p () etnmf iodfa  lu i;s0 eumxr iu1amtemnci s) Dum( pnt0ope  ieildlmDel( s;u0 rtomfctatopDr neo;t trxm(mpou4aleemfvi s aDtmxmpnt1tpxomo3tas s umn ont) ltnircoodlptelu s;s0srtrxm no1lm nlnvtl(farta(m ;t4apxoiiciatla uan ont)trxoxr3oo1fmDraivil()tetrxr3io4ol nmnes t a2rau p;t4apx io3iyd a em(vs u0 etomr3oa1lm  lu i () rurio ny1lm  mnci ()sDuaurpno1tlen octlt a raumonu0tlermo tadlmDe uvi;(  exoirpoodomtemnctlsf 2rmxro;u0tpe io3iydfmDuanvp;() eeoxo3ty1faDraueolt)srtm(mpou1lptnlictls s2uax  nu1aeeomf3iytfmDumuvp () rxrif iydlm e ueo;(0srxriopny4oltn ict sf rtaxmono4oet mo3tlsfsDrln sn(4aeermr oydlm raiei;s  etoir iy4oltnmfctat) Dta(mono1tex mocilsfmDem(msnu0altomo oo1lmteai s;t s2tmir3iu1lm e fvtat arrm(rp;t0ale ioetasfs2em( snu)tltrmf oydfatr ivs s0 etoim3oy4al nmictasfarrmx  nu0aee ifetas s ulump;t0aetoxo3oo1oaDr nvs;t s2uoxrpoo4lp  liet tf 2uru o;t0alenioctatfa2uanms t4artnmo3iotlp   i sl( s2tr(r3ny1al e nctlsfa2ra(ro;t0tetomictytfs2ran p (4aetnmo oatla   uvsls)t2to(r oo1ole mncias sDtmxro;o4ope iiciyd m em(mo;t4 exomf3iadfa r n ils)srtr(mpoy4altelici ()artau p;o1apt  f3ild m2rlumpn()aeeoxr tatop e nes;t0trurim3nydope lieias arua(  ;t1apxomoeildls eln o u0artnif io1lptran olt  exoim nudal emnct s) Draurp;o0alxo f3iyslsDuanvp u4 rxnif3oatfmteli slt0 2trir3ny4lm   fvils)srrm( o;t0teeoio3ildla emumpnt)teermf iadfpDeaivils0trtoxr iu1al elnvilsfa2trxr ot0alt ii3iasfsDrauvo;u) renif3oytfmtr u ilt srtrir ny1open ncia(fsDtrxrooo4oetnmi3ilsfaDeaumo u)tetnmr iotopD  u o;(0setoir oy1lpeelnvslsfsDraxrpnt4apxomo3iydfa2ranvont0aetrmocoatoa r neol(  rtrimpiydol  mivtlt s2tr(m oo1oex  i3tadls2ran pnu)trtrmrcty1fp r u s s sruoxmpiy4lp   ictlt srtru  oo1alenii3ilt m ea( pnt4 rermf3oydoatrluei;(0texo(r ny4omenlfet ()sDtr(roou4opx  ocilsfaDrlu o;t4tlxoxfcio1lat  nvi ()s2xmxmpoydlltn fvi s)sDua(  ou0aeto o3iasfa ul( o;t)tlxnifciy1fp raues;s)tetmxmpou1llenlfetl(fsrta( o;t1oleomociad s rmu pnt) leoir3todlmtr nvilt trtoimpnodom  mnes t  rum( o;u0teeo o3iltlmDran p t4artoxr iotfptraneols0srur(m3iy4optnmfeil()aDtmxmo;u1tee if3iltls2uanms u0 lxrif3ta1oaDrauvs;s0setr(mpnu4lltelics s)aDtmuront4oltnmiciatls2rl( s t0aetoircoatopD  neo s  etmio nydol elnvtls) Dtrurpot4alxoio3iatlmDea(vp t0texrmf3tytfa eln sl(  rtoiopoodap n nct ()a2tax oot1aptn fcilsfsDeln p;u4treniocoatlatrau i;t0t2toiopnodape  fvi t)a2tax  no0tpto feiat a rm(mp (4altrio oadla  ai s t)srtm(m3nu4lmeelfcs s s2uaurp;o0aeeo i3iatfmDelnvo (4alenmr3iydlp  aueo s0srumxrpnu4lmtn icsl(f 2umumpnt4aex mictasfaDuau o t0 reomr iy1optelivslt teurxm3ny1apt mietls) Dururo;t4tpxnmfctaslm ul( on(4arerxo oytlp eluei;t teto(mpnu4amtnmnesas)sDtaxront0tpeomieiasfsDemumsnu4trerif todfm r uvo;s0 etoimpiu1lp e fcil(farurxrpnt1ope  i3iysla em( o;u)trxrmf oo1fatr ieol()trumxopoo1lme  ics tfsDumxrpnt4olx mfeiyd aDea(mp;(4trxrxo io1lptrauvo s)tetrirpno1omeelfctat  rrmuro;o4opxn f3iyd a2ulu o;t4 rtnmo3tadoptelneo t0sexoiopoodapt lnvi s  Duax  ot0apen ocilslaDumu o;(4texnmo3oodfm   nvo t trur(m nu1altn fcsl(  Dta(r ;t1opeomi3tltla elu s t4 rxrmf3oo1fmDrlueols  eurxm3nu4lm  mivsa() rtru oot1tetniieiadlmDelu onu0 eenmf3oadomtrai slt) 2umir3oo1lptelnctlsfa2rmurpoo4alxnif3iytlm ulnmsnt)altnmr3iatomt luvi s0trxo(o3ny1opt lieil( s2rm(rooo0alt ifeils a2el( ont)tlxoxf3iy1la  ln sls teumxr nudlmenmnvils) Dtrx p;u4alto i3tasla2elu onu4aetnifcoytopte n ol()srtrim3iudop  liesl()arrrxr no1alxoiietyd s eln snt)trermo3oy1fpt lueo;t)s2tmim oydol   ietasfa2tm(r ;t4optnmf3tasla2uluvo;u4teenir ia1lp  lneo t) etrxmpnydole lfcslt)artr( onu1alxnmfeilt m ran o t4altomr ty1opDr uvs;() rum(mpoo1ol nmncs s)a2um(mpno1tee io3iyd sDul(mo;(4 eerxociatlpt  ivi s tetm(o3nydlmt  ieslt) 2ua( p;u4oet ioetydfs2elnmp;t4trtrio3iy1oa raueo (  ruoim3ny1altemietas) ruaumoot0opt  feiadls2rm(vs u4 eeoxocia1la e uvi;t  rumir3ny4ale miviat  rrru oot0tlto oetlt sDrau ont0 exnxrciytla   u olt) rtmimpno1olte nctasfaDtrum ou4tex  fetlslmDea( s;(4 rxnir3oy1lm  aueo;t  2ur(o ou4lp elfctl( arua(ront4opeo oeilt m2uln p t0 lermf3iytomt  uvs t0t2xrxrpny4op elnvtas)sDua(ro;t0oleo ietyslm ranmp ()aetrxrcoy1om rau s s) rurim io4ll  licia(  Draxmpou4oltnif3iyt m2rmu p u4 lxnxo3io1lpteli s (0t2xm(o3ou1alenlnvsls)aDtr(rpot0ole  fctat sDemuvp;u4aeermocoydfmtelnvo;s)t2uoxopnu1om   fetat srrmxr ot1oex  feiysfs eln s t4trtnxr oo1oaD lnvs;s0t2trio3nudamt mnviat)sDuaum nu4tptoii3tadfm eauvs (0aeerxo3oytoptelu i s) 2trxo3no4lp  mnes t  rrmx pnu4tltoii3iytlm rm( o t)trxrmf todfmDean ilt srxmxrpiu4lpe mncias  rrrump;t4aee ifetlt sDuln o u)artoioctotlmte uvo (0 2uo(o oy4optemnctasf 2ur(  ;o4olt  fctad sDrl( s (4tlxrifcoadoa e ivilt)teum(r ou1om   fvs (faruax  nu0tleoiociysfaDulnmo;(4 lxrxrciadlpDelivilt  2tmxr io1al  lnetls) 2ua(rooo0alto fciyt s2ra(vsn(0areoir3iodlmDe i i;(0srto(opou4ope livs s  rur(r ;o4aet mieilsls uan pnu4artoircto1laD  ues ( trtoim ou4ll  lnes (  2rm(  ;u0aleomf3tasla ul(mp t0aetnmr3oatlmD  uvsls) 2umir nudalt lictasfsDrm(rpou1openioctyslsDelnms u0 rtrifciatfaD auvsl()trxrio3no4olt lnesltfs2rauroou4aee ifcilsfa2eluvs ()tetrif3tatom r i slt  eto(opiy1lmeelnct tf Dtrxroot0alxnio3iatfa2umumo t4 eenmo3oodfat lu ilt  rtr(mpnudaleemivsas aDrmurp;t1altomfetys a rau s t4texnif3iatoa eln slt teto(o3iodapt  iesas)aDtruro;u4aptn i3iytfm2rmnvo u0teenif3todla raneil() 2tmxm ny4omt livs s)sDuru  no1olenmfciadlmDum(msnu4 lxoir3oydfmt  ies;()tetoxrpoo1amtemicsa(fs2taumpno0olen ieiad m um( p;u) rxrircio1lp   nvils) rumxo3no1lmt mfvs sfa2uru o;u4oexoiieiytfm2ulnvp u) exrifctatlm  ln il()s2uo(m3ou4apenlnet s a2ua(rpnt0tlxoifciytfmDra( snt0teermociy1lmteauvo t0 2toir oy1al e ivsas aDuau poo4apt  f3tas aDrmuvp;(0aetnir iadfpDr ivs s) rxoim3ny1alee nci t  rrrx poo0opeomi3ild s ea( o;u0altriocoydoatrluvs t0seum(opoudll  mfcias)a2urx  ;u0ape  f3iaslm2eaumonu0 ltnir to1op rluei;t texm(m3iu4alenmfvtl( s2uaumo;u1opeoii3iytfa uln o u) leomf3iydfp   u sls s2xm(o3no1apeemfcsa(f 2trum ou0tlenmieiltfsDelump u0tlxnmf3oytfmDeau s (0 2tm(mpoodal  lfci sfsrumu o;t1tptomfeilsfm2emnvs t)aexrmr3tatlpDrlu o t0t2umxm3oo1ll  lfvtl() rrax  ;o4oleniociasfmDuln pnu0 rxomocio1lpte nvilt t2xrio iodom  liesa(f rrrxr ;u0oeeo fciasfm2rmu snu)tleomf3oadlmD lu ilt  2uo(r iodoptn ictlt s2rrumpno1teenmi3ildfa2ra(vo u4 exnxrctydfpDrau olt)t2xoxrpnu4lleelivs t srtaxrooo4alxnmictad a2emnvo;t0alermr iytlp eanes t0t2to(r ny4llenliesls a2uau oot0oeenmo3tlt a ra(von(0 rtrio3totfmtrlu o t trxoiopno1apt licta(fsDurumo;u1apx ioetadla uln snu) lxrifcoadlpt aivo;t0s2um(rpno1ol  lneia() Drax onu1apxn octys a uau pnt) lenmocty1fatran i (0setr(rpiodlle mncsls) Dtm(roou0olx  f3iadls2eaump;() rtrmf oytoatr nvs;s0trxm(opiodamtn feias a2rrx ono0olxo fctldls emnvo;(4trerifcty1faDrluei t)setmir oydop elivsl(faDta(r ;u0aetnmf3iad aDelnvs;()tetrmoctadomDeaivo;s  eumir3nodolee ncs (fsrra( p;t4aptoifcildlsDelnmpnt4 rtoio iytoa eli i (0teuoxm io1aleelict sf 2rmur oo4tex  octys s ra( p t0 lxoiocoydop rlieolt0teum(mpio1lltn fct t) 2urx  ;o0oetn f3ias a2ra(monu0texoxf iadfa e u s t0 rxoxopoudopeemfctas  Dur(  ot0aee  fctltls ra( on(0 lxoircootfmte u o;( tetmio3nudllt  nvsltfsrrmx  ;o0aexo iciydfaDra( p;t0tetnifctadlmt  uvo;( t2xriopnu4om e fctat a2rau poo1tlx ifeiatlmDumnmo;()aeenirctodlaD aneolt)t2urxopoo4lltn icsa(  2taxr ou0opeomfeiadfmDranmo u4tltnxfctytfaD li i;t) rurio3oo4ol emfvt ( srrrxro;u1tpx ioctadlm2elu o;u)areriocoydfpt anes (0 2xmio ou1alee fciat) Drr(rpoo1apeo oetys mDum( o;(0tlxrxfcto1op  lnvo s sexmimpiu1aptelneiatfsrtrx  nu0oex  octaslaDrl(vo;t0artrxf oatlmDrau slt) 2urir oy1lptelnctlt a2tmx  ou4altn o3ilsfa2uan sn(0tlxoxociodfm elieo;t0trxmir3iu1lpt  iet sf 2rruroot1tltomf3ildla emnmp;u4tltnif3ootop eaneils0t2umxm nu4am n fvsls srrrump;t1tetn fctadfm eaumsnt0tleoir3oatfat luvs;( teumiopiudope  fcsas aDtr(r nu1alt ifeiat a emumo u4 eermr tadlat  ivil() exr(r ny1aptnmictat aDuaxm ;u4tpt ifciadfaDra(ms;t)tetriociadfp  lnvi () 2toimpiy1lmenlfct tfartau p;o4tpto icilt m rl(vsnt4arxrir tatoa e n il(  rxm(opoy1lle  nvtltfsruaumoot1aex  i3iad mDrm(vo;t)arxrio iodfpt  uvo;()teuo(mpno1omenmncils) 2rmxmp;t0tpxniociad s2ulnmp;u4 exnmr iodlmtran il(  2xm(o3nudamt mfvtlt sDuru  ot0apxnmo3iad s em(von(4artnif ia1fa   ivi;s sexrio io1alenmnci t)a2rmxmoou1apxo oeils s2em(vs u0tetrmrcoydoaDeli i;t)srum(opiydomen ncsasf Drrx ont4ale  i3iyslm ulumo;()aetniocio1oa  li ols)texrxm iodomen nci t s2rru  ot1openmociyslmDumuvont0 lenxo tatlm elnvo;( texo(o oy1llt  fvsasf Draurpoo4aee mo3iyt s ran pnu0 exnxf iotfpDrau ils0s2ur(r3io4omen feiatfarta( pnu1apeomfctlsls2elu p;t0 exomrcoo1lmD lu s;()srxmxm ny1llenlncias  Dra(ronu1opto icildlsDulnvo u4altrmo iadomDeau o;t0t2xr(o3oo1alenlnct ()srtru pou0tpeoifcildlm uluvon(4texnxo3iodop e ues t) rtoirpiodlp e iei t)sDur(rono1oetomo3ils mDemnmon()arermf3io1fp elnvi t t2urir3oo1lp   icsa()srtm( ooo1tlto fciatfa2emn p;t)arenir3iodlm rlieolt0 rxoiopiudlp  lfet ( srrm(mpoo0opto fciysfaDea(monu0 rxoir3todfa e nvo s)trxm(m3io4op emfes sfartr(mpno1teeomoeiyd s2eaumo u4alerxrciatfaDr uvsls)s2xo(o iy4ll  mfes t)srur(moot0apx  feiaslmDel(ms;() etoxrcta1op   nvil() rtr(o iu4al nmietlt a2taxmpou0alen icils m2umu s;u4altnmrcootoptrluvilt0tetmim io1lp nlfvi ()srrm(m ;o0olt  o3iltlsDrlu onu4 lxrxfcty1opDelieilt0 rxoxrpnodop elnesls) 2trum ot4ale mfciydlaDrau s t0 eerir iy1fm eaieslt0t2xoxm3oudop  mfes tfaDtmumo;t1openioeilsfs rm(mp;u4teeoxr3ty1fmD luvil(0 exoxopnu4lme  fvil(faDrm(rpnt1tpeo oeiysfs emums;u0 rtrmr3iytopDeaivs;t) rxmio oy4opte fesls)srrruro;u4oltomi3iad s2em(mo;t4texrmf todop r ueolt  rtr(r3iodom e feilsfaDra( o;u0olxo icild mDemn o t0trenxfciotlm eaueo;t t2xrir ny4omte ietat)s2rmum ou4alx mieiatls ulnvp;u4 rtoxr ty1fmtrau o;t0teurim3nudam e fvtl(  rrmxm nu0tpx  fciysfa eauvp t0 renmrcty1opt  nvo s) eum(opnodom emfetas  Dtruroot4tlx  f3ildfmDuln s (0 rerio3oydom   iei;s t2xmxmpiy1lp  mncs ( aDumxrpnt4oexomoctad a rlu o;u4teenio3iatoat ai o t)t2umirpiudal n ictat)aDtmxmpot0opt mociydfmDumuvonu0 lerxf oadoaDrlneo;s)s2ur(m3oodam emnvtls) rumump;o4oexnif3iltlaDelu s ()artoxo3oa1laD  ies s sexmxr3oo1openlfes s  2ururonu0oetnioetas mDrlnmonu)trtnmf3iy1lmD  ieilt0truoio3iy4om emivi sfsrrrxm ;u4tee  iciltfsDrl(ms;t4tlxnmo3oydfp elnvi t0s2tr(o3iu4ole lieiat) Dtaxm nt0opt mieiysfa2umnvo;u4arerirciy1fp rai i (0t2umxmpnodll emietl(fartr(rp;u1tleoii3iys sDul( pnt4 leoifctytlm   n ol()tetr(m3ou1amtemiei (f 2truroot4aetnmi3ilsfmDrmuvo t0aexnifciy1opD aues ( s2xmirpoydam e ncs s s2rrurp;t4opt io3iltla2um(monu4 rxrmrciydoptr n o;s0tetoim iy4ap  mnes t)aDumxronu1ope iiciatfa umnvp t0 rxnxf3totlaDeai sl( setoxrpoudllenlieslt aDtmxmpou0olt ifeildls2eanvonu) ltnxf oytomt  ueols)t2tmimpiydap  mnetatfsDrr(roou1olt  ieiatfsDuanmp (0areoxo tydoate nvo;(0t2toir iy1llte ncsl(f rta( o;o1tpt mietyd s2ulnvs;(4 exnmociotopte uvs;( srxo(o oydopeelnvtasfs2raxr ;o4olt  o3iatla2ul(monu0 rtomo3tadomt  ieo t  rumxrpou4lpeemnctasfs2tru o;u1tptn fcildfm2rlnms;t)alenxf todom rlnvsl( t2xr(mpoo4am  micsl( srraum nu0oltn oeilt m ul( o;t) lenxr iodoate ivs ( sexr(o ou4lm n fvs tf ruaxront0tle iietldla2rmn s;t4tlxoxociydfatelueo t0t2trim no1ame  fet () rum( ooo4optn o3iytfs2em( s t)aleomo3iatlpDr i il( s2xm(o3iy4ale  fviltf Dum(  ;t4altoii3tatfaDranms u) rxnif3oadoa eln olt)srtr(mpoo4ap nlivs s  Dtm( pou4tpe mociytls2rm(vp u0 rxniocoadopDr n i;t0 eumxm oodamenmneiasfs2tr( p;t4teeoifeiydlm umumo;(4 rtnxr3iatlpt lieo;()t2trxo ny1ll  mncs t)aruaxm oo0apenmieils m2emuvp (4aexoxo oytlat auvs;s setoxr3oudlptemfes ( s2rr(m no0teeniieiad a raums (4tltoxr3io1lm rauvslt truo(o3iodam e ivilsf Dtrxm ;t4apen i3tasla2el( snt4tlxnmr3oy1oaD lieo;(0 2xrimpoo4om e fei ( a2tr(mooo4alx io3iadla2rlums;(4 ltnmfcio1fpD lues;t0 2to(o iy1oltn nvtlsf rua(m oo1tpe mi3iyd m2rl( ont)tetrxf3oydfmt lneo ( t2xrxo oo4lpeelfciasfsrrm( p;t1tpt moeiadfa ul(vont4aeeoxo tydlmDrai ils  rtmxo ny1olenmnct tfsrumumoou1tet mo3iadla2eau pn(0 rxnxocoy1om  lueo;( texo(m iy1olt  nct (farurxmpoo1tptnifcilt a2ul(mo u0teenio tadfaDe ies t0 rxo(r3iydop nlnvslt  2rrx  nu4tpxomi3ils a emn ont0tlerxo oodlmD  i ils  2xmio3ou1om  mnvs t)aDrrur nt1opt mictys s uau s (4teeniocta1fpt an i;(0t2tmxopny4altn ivt t)a2tm(r ;t0altomoetyslmDeaums;(4tleomo3oytomteaivsls s2trxo3nu1amee fcs (fa2rm(rp;u4oeen feils aDuluvs;(4 etnmo totom ran olt seum(rpiudol emneia(f Dumx  oo1tpx mf3tysla2rmuvp ()aeeoxoctotlat lneo;t s2xoim3no4alenmiesls)a2ua(ro;u0tpxoioetasfaDem(vpnt0aexomr iytom elnvi t)t2xm(o3nodop   neil(f 2urur ot4tetnif3iad a raump;(0aexnmrcoadlaDeli ol()seumim3iodoptelfvilsf ruaxrpnu1oee  oeiasls2rln snt0tetrmoctadfpD  n i;(0 rxrxr ny4lmtn fvs tfarrmxm ;o1openmi3tydfs ua(vp;t0treomo oo1lmDrau ilt)seurio oy1ap  licslt)s2tmu  nt0oltoioetadfaDul(mo t) rtnircoy1oat  n s;s teum(r oo4om nmiciat s2um(mpno1aee  o3tldfs2em(vp;t0texrio ta1fate neslt)s2xmir oo4opeelictlt sDtau ooo1aexnmi3ilsla2eanms u4 exoio3iatop r i i;s)srtmxopiydal nliei s  Dumur no0ope ii3iatlsDrln pn()tlerxfcoadfaD lu sls0 2xmir iydlme livi s)sDua( onu4aet ioctadfaDem(vp (4altrmf3tydlmD  ivil(  eurir ny1lp nmfctasfs2rr(mono0tltoiociatfm ea(vont0arxrxo iadfa raues t)sexo(rpiodoptnlies () 2raxmonu0olxn oeiltfmDum(vs u4alxoxf3to1omt aieilt0 rtoxrpiy4ame mnei (fa2umumpno0apxnif3iyd sDea(vs;u4 eeoif tytopt  ues s  2xm(mpny4altnmncs t)s2urxmooo4tltomoetld aDumn pn(4arxrmocoytfptrlnvols  rxmxopoydapenmivias)s2rr(ront0alx mfeiatfm ra(vo;t0 rtoxf iytlat anei;t) rtrxr3ou4lmee iesa(f 2ta( pou4tlenio3tyt mDrmuvp;t) lxrif iydfa   nes;t0srxmio3iodlp n fvslsf 2ur(r ou4opt mieiysfsDemumsnt4 exnif tydfp eluvo;( seum(m oudomee fesltfaDtaxmoot1aptoiicilsfm uaumonu0aexniocoytoa  lnes;t  rurxo nu4alenlnesasfs2urxmoou4ope  i3tytfm umuvp;(4 ltnmf oytopt anvi;t0 euo(m3io4llenliesl(farrmxmp;t0tee ifctat m2el(mon(0 rerioctodfatrluvsl()trto(r3iy1am n ict t) 2rrxmoou1aleoifciys a el(vs;t0 rxrmr3tadfp r neols trtrim3oo4alt lnetl( aDur(rpoo1aptoioctad m2rlu o;u) exoxf3tydomtr ivil( seur(mpoy1lpt mnvs t)sDurxro;u0optnioetlslm ra(vs t)tltrxo3iadfp r ueols s2toim3iydlm nmicsa(faruru pot1tlxniiciyt a el( s;u4 rxnir3ootla  lnvo t  exrio3nydomeelfetasfartaumo;u1teeoif3iytfaDuanvpn(0arenif3ty1lpD  i il()s2tr(rpnodapenlicil(fsrrrxr ;t0apxnmoeild s ulnmo;() exnio tytlaDe u i;t seumio ou4alenmnctat arrax pnt4opt  f3ildfs2ean p () rtoxrcoatfaD  u i () 2uo(m3io1alt  nvs sfarra(m ot1oee miciyt a rmu s;(0trenxrciadlm elnei t s2xoimpny4ol   nes (fsrrrur nu4aptnio3iytla uanvo;t) leomociatlm ranes s0seurxr io1amen nes s)sruru o;o4altn fciatfs2rluvo t4 reoir3oa1lpteauvi (  euoio3ou1ap n iet sfarrr(  ou4tlx iociltls umuvo t0 exrmfctotfpte u o s texmio3oo4llenlncils)aDraurpoo0olenio3iad sDra( s t4arxrmocty1lp e uvo s) exm(r3no4lm nmncs t sDrr( p;o0aleo ociysfaDemu p;t)trtoio io1late ivs;(0s2tm(mpoodlmenmnet s)srur(r ;o0aexnmoctysfmDemuvont) lxomr todfa rau o t) 2urir no4lp elieils)s2umxrpnu0oeeoif3tadls2eaumon(4arenxr3ta1fmtean s;()trxrxm oy1opt  feilt)sruaxroou0oltomociydfm rmumpnu)tltoxf ia1omDr uesl(0t2xrxopoy1ll nmneils srumxmonu0tex  i3tatlmDumnmo u4aeerxfcta1lpDeaivo t) rxmxr iydomee ivs s  2rm(roou0texnif3iatls em( o u4altrir3oo1fm r i sls setrxopnodomenliei s)aDtr(m ;t0oex  ocilt s um( on()tlxnir3iy1oat  neo t)srurxrpoy1om elivtl( srta( oot4apenmieilt m rm(von(4aeeoxf to1fa  anei s0s2uo(o3iydlpeemfvslt s2rru  ;t1oeto ieiadlm umums u4 lxnxo3totfmte n o t0s2trir iy4ap nlfci ()arrau p;o1tpxnif3tadfmDeanmo;()tlxomrcoo1oa rauvolt t2toir iu1lm emiesatfsrtrur no4tltnifctltlm2eln pnu0trxnio3iydoa raueo;t)texo(o3io4om elivtlsf rraxrp;t1tleo i3tld s2rm( o t4teermr iotlate ieo;s seuo(rpnudlmee nctat) rra(mpoo0tetnmfcildlaDumn o (4aexrxo oa1lmte neilt0trtrxr nu1opte nviltfartruro;o0oee mfeild m2rlums;u0aetoio ty1fp  li s t0trto(mpiu4ame  neslt)srraurpno4tptomf3tltfa2rm( ont0 rtniociy1lp raneil() eur(m3oo1al  mnvta() 2ta(rp;t4aptn fetys sDumnmp u)tlenir3io1fmDrli i s0 rxoio3iydamtnlieil() rtax  ;t1ope  f3ild m2rl(vp (4tetoxr3oatfp rlneil(0t2xmimpnydlle  ieslt) Drm(ront1oltoifctyd s2eauvo;()artoxrctadlptelueo s0setoxm3oo4om elnvsa(  Dtm(r ;t4oetn octyt a2ranvs;t0tlxrxr iodfpte i ils) etmxo no4olee fct (f rtrxr ;t1apt  oeildfs2el(vp;u0arxrir3iydfpD an ol()setoimpoodapenlfvt s)srumumpot0ape  fctytfs2emnvsnt)tetoir3iatfpte uvo () rxmxm3iodoltnlieia(fa2rm(rp;t4tpx mi3iys sDeanmpnt4texoif3ootoat aivo;s  rxrxr3no1olt lfvs t) Dum( p;u4tet iieiyslaDrln pn(4 lenxr3ta1laDe ivs t trum(mpno1lp nmnctas) Drmx p;u0olto oetyt a2rau sn(4 eenmo todfm  aieil( trtrim oudalt mivi s a2ur( oou1aeen fciydfa rlnvont0artnxo tadoatelnes ( texoxopnu4lle livs s aDuru  ;t1ope  i3iadfmDumnmsnt)tetrif to1fpDrau i s  rur(r3oodlptnlietl() rurx o;u4opx  feiatfm ua(vo;u0 exrmf ia1lm  aieo;t) ruoxr oo1lm nmieslt) Drmx ono4aleniociatfsDean p;t4alenmo to1lp  au o t  etmir3oydomt mfvt s s2umu pnu0apeoiociltfmDul(mpnu)trtrxf oy1lp  livi;s texoxr3oodllte ivias)arua(ro;t0opxo ictlsfsDumnms t) exoxr iatopD anvi;s)teuo(o3iy1om nlfcs s artr(ronu4tpto fctlt s2uanmsnt0texoxoctodfpDr u o (0seum(r no4lltnlfcs s) Duax  ;u0altomo3iad s2ua(mo () rxomociydfa rlies t sexmxopiydll   ivsl( aDtmx  nt4tleoiicilt a2ranmsnt0aexomfcia1fp raueo () ruoxr3nodamee nct s) rurxroou1texo i3iatlm2eauvs u0 rxrxo oatomteli ols) rxr(o3nudlptemnesls) rurumpno0oet  i3tlt m2rlnvsn() rxnifcoytoaDr u o ( s2tmir ou4opee fvi () rrm( o;t0opxn f3iydlmDulu o;u4tltnif oydfmD  ues t)seum(o3oudamtelfvi t srtm(r ;t1oex io3iydfsDul(mpn(4arxnxr tatla rli i;s0trurxopou4op elncsatfaDta(mp;u1tleomo3tatfs2ulnvo;t0texoxf iotlmDr nvs;s0 2xo(rpoy1lpte ietl(fsDur(rp;t4alxoifctadla eln s t) ltoio iytfmtrlneols)sexo(opnudoltemnet tfaDrru ooo0aptnmfeias mDum( s;t0 rxnmo ootfptr ues s0teumxr3iy4ll e iesa(  2tru  ou4aleo f3iys aDumnmo t0aeermr iy1lpD lu ol( srxmir io1olenlfvil()aDuax  ;t1tlx iocias s2eau onu4alxnxo iytlpDeauvs s  2xmir3nodolte ivs (f 2raur oo0apeo o3ias s2ea( onu4alxnxr3tydla   i sl(  2umimpiydolenmfvta( srumxmp;o1tetoioctlsls2umumpn(0tltniociydomD  ieil(  rurim nu1lleeliesls aDtr(ro;o0tpxnmfctldfs umumpnt4trxnio3ta1fate n o;()tetmim3oodapt mfctl(fa2rrxrp;t4tee miciad a2eauvs;u4treoxf iodfa eai o;s0 eumir3iu4ame  icil( a2tmxm nt1aeenmietasfaDrluvo (0 exnir tadlpt  iei;t)teuoxrpou1om   fetlt  rraur ;t0aeenifeiys mDemu pn(4 eenxf iadop e uvs;t)setrir ny1lpt  iet sfaDuru p;o4apenmoeiltfaDumu p u4 rtomocty1laD lnvi s0 etr(rpoo1amt lies t srtmx o;u4apto f3ildlm2elnvo;(0tlxomo iotlmDrli s s0 rxr(m nu1ole lfct (f rrr(r ot0texomf3ias m2rmnmo;u0trtnxocty1lpDrau sl(0t2xm(r3iu4ope  fvs s) 2trxmpnt4tex ifeiltfmDemnvs u4trxrifctodfp  an i s0 exoimpny4om e ncta(  Dtmxmpoo0oetn icias m ua(vp;u0teerif3oo1fpD lneil(0truo(rpoy1lm  livt s sDraxrpnt1oexn oetyd s em(vp t4texrir3oodlpD aieils) ruoiopio4lmeemfei s  2umuront4tlen octyd s rau p t)aetoxfcoy1faD ai o (0 eto(o3oodalenmfvi t aDrr(  no4texo ietytls eanvs u)altrmr3tydopDr n o (0srtm(rpiy4lp nlnetl()sDtr( onu4olen ieildla2rlums;() lxrmocia1oateluesls0 euoir iy4amte fvtlt sDrmxmpnu1olx mfetydlmDrln s u4aetrmr iytopDelieo;(0trtoxr3nu4lmtemfcta()a2uru p;t4teeniietldfa ra(vs;(4trermfcoydlaD luvsls) 2xmxmpnydop  mfetl(f 2rrurpot0aetniocilt s rmn o u0alxnirciydoptranes;s0teumiopiudlltnlnesasfsDua( ooo1opxomoeiydlmDuanvs;(0 rtomo tadlmtelu i;s0 eumio oudlltemnvt ()srrm( poo4alenioeils sDuan onu0 etriocia1fat anvo;() 2tr(rpiu4lpe micsa( aDta( o;t4apxn i3iat a emuvp ()aexniocty1omtrln ils0 2xmxrpiu4optemivs t)aDta(m ou4apt if3tytfs2ul( sn(0alxoirciodlpt lieolt)sruoiopoodomtnmncs ( a2umx  ou0apx mo3iatls2rluvo;t4 eermrcty1fpDelnvi;s) 2tmio iu4lptn nvils)sDtaxroot1tpt iictadlaDulu o;t4 rxrif iy1fmtrlieols trxm(o3no1lp e nctatf rua(mo;t4olt  o3ilsfm uln p (4 ltrmrciytlpDr n i (0s2xmxo io4ll e icsa(fsDuaxm ;u4opxn oeiytla uaumo u0 eermr3iydfat  nvi;s  rtr(o3iu4amtemivsl()s2umx  ;u0aee ii3tydfm2uanmo;u0arxrxo3oydlaDr nvo;t)t2xo(r ou4ap e fvs sfsrtmxrp;t4olxo oeilt aDrmnmont4aexrmo3iatlpt lnvsl(  2urxrpiy4ome miesa(f rua(ronu1altnmocild mDulu s (0arerxrctytla r uvsl(0t2xrir3iydoltn icslt) rtr(mooo1teto f3iyd m rmnvo (4 eeriocoodopt liei;( srxoxrpoydol nlict t)sDra(mpno4aptomiciltfs2ra( p u4alxomrctodlmDr ivs (0tetm(o3iu4alenmictatfaDuax o;t1tetn f3tat a ua(mp;(4aexnir ootomtelieslt)tetmxrpou4lm e fvsa() 2rr(  ;t4alt iiciydfsDrmnvp;(0tetnir iy1fpDeauesl(  etm(o3io4om nmncsas aDtmum ou0teenmicild s umuvo;u4 lxoio iadfpD  ivs t0trtrio3ny4ame lnvilsfarrmx pou4tlen o3taslmDumn onu0texrmf3oatfm  lnvi;s0texmxm oodlltelict s a2ra(mpot1ole moctyd m eanmp;(4 rtrio ty1fm  ln i;t) 2ur(opou1aptemfei t srtrxm oo4oeenio3tyd m emn s;t0teeoif oa1oa  lieo (0sexoiopoydoltelnct ( s2umu poo0olxnioeiytls2em(vp t)artoxo3tydfmte uvi (0trtm(r ou1al  mnvi s a2rm(moou0optoifcilslm um( o;t0tlxrirciotoatelivi;(0 exrio io4amte fviat)arua(  oo1opto feiltls2emuvo;u0aeermr oydlmtrln sls0sexm(o3ou1am   nvsl(f 2taxrpou4tleo fciyd mDemuvs u4alxoxo3iytlpDe nes;s)srurio iudlmtnlncsat aDta( p;o4tetoioctasla rl(vo;t0aeermo3ootfmDelueo;s trxr(o3oy1apenmfvias  rtmx  ;u0apxoifciltfm2rlu p;u) lermfciy1fpte uvs t)t2urxrpoudome lfes tfs2raur ;u4aleoiieiltla2rl( pn(4artnmf tadopDean ols)trxoxo3iy1lp   ncs t)a2trumooo1apxnmfciasfm2ra( pnu4trxrmr oodla rau i t0sexmio3no1al elicsat aDrr( pnu1apxnifeiytla2ra(vo;u4altnio iodlaD lueo;t tetr(o nu4lmtemivsltfsrra(r ;o1opt mictytlm umu pnu) lxnmo3iy1fmDrlu i ()t2urxr3oo4lpenlivtat)arrrx oot4oetoifeilsfsDul( p u4aeenioctodomtrau i (0srtm(m3oudam nmieil(  rrmxrpnt0olxnmocils a rlu pn() rtrif3todlmDrln i;(0texm(rpnodapte fcsasf rtm(mo;o0oee mfeilsfs2el( pn(0teeoxfcoa1lp rau i;s0srxoirpoy4lpt miesl(fsDtaxr ot0aet iieiyd a2rmumo u) exrxociy1fmDrliesl() 2xrxopio4oleemivsasfsrumx pot0tlx  ictatfs ulumsnu0 rxrmf iy1omDrluvo s  rto(o iy1ol n nes (f 2trum oo1ape  i3iasfm2uauvp;u4areomrcta1om eli s;t0 2xo(opiudlmt lnesasf Drrurp;u4aetoiicils s elnms;u) eeomr3ia1lmD an i;t  2ur(r3oudaptnmies t) Dtr(  oo1oee  fciyt a2eluvont) exnxo iodlmDranvs s teumxrpoy1amtnmivilt a2um(rpno1aeeomo3iyt s2ea( p;t4alxoxrcta1lpt luvils) etoio3oy1opte feiatfs2tmur no4ope ioctytls uan s u) exomf3oodom e ivils)teurxmpno4op  lfvsa(  2trumpot0texomieiyt m rmump;t0 ltrxocta1fmte nvo;s0sexmxo3oodomte iciasf ruaxmonu0olto ocils s eln s (4artnxr iytfpt au o;t  2trio oo1llee icia(  2umump;o0ale  i3iat sDrmums;u)trtnmr iodfa rli ilt sexmim3ny1llenlfvs s)srum( pnt1tet  octysls umuvp t4 eerir3oy1op raiei s srxrxo3io1amenliesa()arumuroot4aee iieiltfa rmuvp u) exoxrcoatom rauesls0t2xm(r3oydllenmiciasf 2umumo;u1tptomo3iadlaDuln pnt4tetoif tadfpD  nvol()setrxo3nu4optnmivs t)aDra(r no0tee  i3iytlmDulu p u0 rxnmfcoatfpD an o;s)t2xr(o3iu1omtemnvs t)arrmxro;t0tpt ioeildls2eluvp;() renir iadop r ueo;(0 rtmxr iodll nmncs (f 2urur ;t4tlxomfciasfm2uau s u)tetrmrciodlaDrluvi () eumim3iodop   fviat)s2uaump;o4oee mietlt s umuvp;(0teerif3iatom   uvolt0 2ur(r3iu4lp e nvils srtaxro;t0oexomieiltfa2eau p t0tltoxf tadla raueol()tetrim oudalt mivi s) rta(moou1apx mfeiatfm ra(mp;t4 eeoxo3tadlat ai i s trur(o ou4apt lnci sfa2rmurpoo4alt  fetltfs2ulums;u0trerifciodop r u o;( trxmir iudlp   fesltfsrtmxr nu1alenifeiatlm2uluvo;u)trtrxr3ootlmDelueo s t2tm(o iu1lme mfcia(fartax p;t4tpxomfciysfmDrmnvp;()tlxrifctotfaDe ieolt0 rtmir oy4ape  fvsas  Dtmuront1aee ifeiyt m uln s () eenxfcio1fmtelu i (0 2umxopou4lp n fvtl()a2urur ;u1alxo ietlsfsDulnvp u0altoxfciytlpDran i s)s2xoxo ou4ope  neilsfs2rmx pot1tpt iictyt sDulump;(0tltrxrciodop e i ilt texmio3oo4llt lici s) Dta(m nu0aexnmfeias s rmuvp;(4tetrmr oadlm e u ils texoxo3iodol elneilt)s2tmx ono0alto ieild a2ea( sn(0tetrio oa1lm  aivi;s0s2urxo3nu4amenmfei sfs2uaumooo1aexoioeiyt s el(ms (0alxrioctytfmDelieol( t2uoiopoodoptemieslt)sDtax  ;u0aeeniieiysla2ulumont4aetnifcoa1om e u s;( setr(mpio4lmtemnvtltfsDtaxm nu0olenmictysfa2elumpnt) exnmrciy1fp rauvi t)s2ur(rpou4lmt lfcsa()sDrr(rooo4tlxn ieilsfs eau p;u4altomo todlpD aieol( trumxo oy4ol  mfvtl() Dua(mooo0alen ocilt mDelnmp;(4 ltoxrcoadlmD  i slt0 rxm(m nudome micsa( sDra(mp;t0tptoii3iyt mDeaump u4tetnxfcootlmteaies t0t2um(rpno4llte fvsls) 2trxmo;u4tetnifctys a rmu p (0tlxnmr3iodop r i il(0srtoxo3oydaptemfvs (fsrrmxm ;u4tlt ii3iadla uanmo;t0altnxo ty1opt lneilt) rumxr3nudlpen fcia(f rta(  nt4aeen ocildfsDuau s;t)texrmf3oa1oaD  ieil(0trum(o3oo4optnlivsa( arrmumpnt1tpeomi3tas mDua(mpn() ltnmf oa1lateluvo;(0trtoio3oo1openmnvsas) Dta(r ;u1optn i3iatfm ulu on(4 rtoxr iytfmDrlnvi;() 2xmim iu4lm  lnvtls s2trur ot0aexniieiytla2elump u)tlxrxf iodfaDrauei t srtoxr io4lp   ics s aDum( onu1opt ioeiydfsDemu o;t4tlxrmf3totoaDraueo t seuo(o3nudamen ncs (  rtmxront1tpe mociydlm rlump;(0 rxnxf3tadfp raies t0teurim3io1alee nvsa()artaxmp;t1aetn iciatls2eluvpnu0trxomociatlaDeanvi;()srurim nu4ale  fctasfsrrrurooo4olenii3iltfa2rlu pnt)treoif iatlatr nesls)trxmir3ou4ol   icsatfaruax o;t0tlxomoetys aDemnvp;t)aexnmo iadop   nvilt s2xr(o oudomeelnvs t)s2um(root0aeto o3ildlm2elnmo;u0aeenio3oodlmteai s;()s2trim3iy4lpenmfes t s2rmx  oo4apxn iciat a2eauvp u4alxnmrcoy1lptrau i s trtm(opoy1ameemfcsl()sDur(m ;o1alxnii3iysfs emumo t0trtrmociatlm e n s;t0s2uoxrpou1ome liesl( s2tm(m ou1tle ifeiatfa rlnvp;t4alxnxr3oy1lmt  ueo;t)s2urxm io1lmtelfvi (f 2urumpoo0tltnifeiyt sDemu pn()arxrifcoatlm e uvil(0s2trio3oy4lp n fci s  rumumpno1aetomfciadla uan o;t4aleniocootomtr i i s0t2trxmpnu1lm emfei (fs2umurpot4opxomo3iyt m2rl(vp u4aexnif3tydfat auvols0t2umxo oo1ll  mnes s  2tmu pou1tpx  fciytlm2elnmp;u0 rtrircoatoate nei t0 rxmim nydlp  lnctltfarurx p;t1apxomieildlaDemu sn(0arxrxo oytlpDrlnesls) eur(r3nu4olt  fvsas sDtax p;t0ole iociatfa umnvp;t0tlermr iadlaDrln olt0tetrxr oydaptn feslt artmu o;o4tlxoioeiatla uanvp;(0trxoxociytfp eaiei;t)teumiopoodamenmncias) 2rr(rpnt4oetomo3iytls rmuvont)tlxomr3todfm eau ol()trtoimpiudameelfes sf rtmxmo;t4alto fciat sDemuvs;t4 ltrifcoy1fateaneol()sexriopny1lpee net tfsrtmxm no4apx iieiytfmDumuvon(4 rtrxf ootlmtrau i;s  2ur(r nu1lm   ncils)aDurx poo4ape  feiadls2ran s;t0teeoxfcootfaDelnvs;s) rumim3iudamt miciltfsDuru p;u1opx ioetldlm2rlnmsnu0 lxrio3tytomDrlivil( sruriopnodalenlncil(faDtaum nu4tpxnmociysls ua( o u4texrio3iy1opDr neols) 2uoio oudlp n fetat)arraxmp;t1apeo f3tlsfs ranms;u4trtrmo3oydopD luvi s t2um(opiy4aptemfesltf 2urxr oo1apxnioeiaslm emuvont4 eeomr3tydom eau ilt) rtoir3nodlmen fcslt aDur(moot0optn ociadlaDel(ms;(0 exoircootom e ueilt0srumir iudom  mnvsas  2rmum no1oex mfetys a2rlums;(0aexrmf ootoat aueo;() exo(o iu4lpt mivs tfs2tax  ;t1optoifetld m2eluvs (4texoir3iy1lp rln o;()s2xr(opnu1al nlneilt) ruaxr ;u4oexomi3iydlm2umnms;u) leoxfciotfmt  nvi;t) 2xr(r3ou1oltnmici tf rra(mpoo1oexn oetltfm rlnvo;t0 leomrcta1lpteluvils0t2tmim3oo4lpen icilt sDrmxmp;u4alx  i3iatfs2rau o u4treoxfciy1fm  lu ilt)srum(o3no4altnmneta( sDtr(mpot1tltoio3ildfs2ua( p (4texnxf ta1optr iei t)trxrxopny1am n ivtltfaDur(r nu1apenmieiyd m elnvpnu4tlxrxo totomDr uvslt)trxo(mpno1ale  fetas) rrr(r nu4altomoeiydla2ulnvo (4tltomrcoatfp r ues;t s2tr(r3nu1omte ncsas)srtrx p;o1alt  oeils a ean ont)aetnio ty1fa  ln ils)seuoxo3ou1lltn netlt sDtrurpoo4olen ociatfs elu o t4tlxniocoodomDr u o s trxmir oy1lmtnlfvs s)srtrxroou4oetoif3tatlmDumn pnu) lenxf3tydfmt lnei;(0s2to(rpoudlmenlictlt  rrr(root4tpxoifetlsls2ea(vp u)tetrxr io1opteaieols t2urxmpny1lp e nci ( a2urx ont0opeomf3iytfm2emuvp () rxnxo oatfmt aivslt  eumir oo1lm nliesa(f 2rmu  ;o4aptn ictldls2rmn s ()aeeomr3tydlmDrluvsl( texoxr iodlleelfes ( sDurxronu4ale moeiadlm rluvs;u0 exoio tydomD  ueo;s) 2umxr3iodlptnmfetl(f Draxront0olt io3ilsfaDrm(vs (4 lermr3tydfaD lueilt0 2xmxm3nydamen ieslt sDuru pno4olt  f3tatlaDeau s;(4arerircoadfp e nesls0 ruoxm3oodlm   nvil(fa2ur(rp;t1opt  f3iat aDumnvo u4 eermr iy1faD au s ( teurirpio4opt mies (  rrmxr ou1texo octlt sDem(mo u)texnifcoydfaD auvslt  eto(m3nodalt  ncs s s2um(r ;o4tlxnioeiat aDelnvpn(0 ltnxfciatlmt aues;t  2ur(m iudll  lfvtls) Dua(r ;u0aleomfeiaslaDul(ms;t0artrxf ia1opt  n o;s) 2uoxo3nu1optnmfesltfsDrax  ;u0oexomfciatfaDumnmp u4teeoxociadlpDelnvi;s texr(rpoodap   neiat arum(mo;o4apt mf3iat a eau s u)arermf tytlm   neo (0 exoxr ou1om nlici ()srum( ono1aptoio3tydla rmu o t0tltnmf totfaD au o;t0t2tr(m3ny1amtnlfeia(  Dur(  ot1tpx  fcild sDeau snu4 reoiociodoatr i s t0srxrxr3ny4lptn nvtl(farrr(r ;t0alxn o3tys m2rm(vp;t0artnmfctodfaDelieo t) 2xmxr iodal nmneiat sDrr(rpnt4alxoiieiydla ran snu0 lxnxo tytlpD ai s;s0seuoio3no1ol e fciat)artaxm ou1optn f3tlsfm2eanvs u0 ltnmrciy1fatelnvi t s2umxmpnu1olenmfvt ( sDumurooo4alx iocildfa2rmumont4altoif3iydoa  lieo (  rtmim3nodlltemicia() rtmxr ;u0tpx  o3iasfm2elumo;t4aexrir3tytfmD  uvo t0t2tr(rpoodlpte nvt s)srur(r nu1apenif3iltlm2umn s;t) ltnxfctydfmt aivs;s0s2uoxr3oodlltnlnci s artax poo4apxo o3ild sDum(ms;(4 etnir tytomte ieo t0trtmir iy4optnlfesls aDuru p;u1tleoif3tyt s uanmon(0tlerxo3oo1op  lneslt texmio iy4lptnmivs (faDtax  ;o0tptnio3tytfm2elu o;u) reoxo3iytlmtrln s;s) exmxr3io1ll   nctat)srrmx o;t0oet mi3tlsfs2umuvs;u4 exnxfciatop   ivil(  rurim ou1ol  liesasfsDua( onu0tet ioetltfm rmuvo u)texomf ia1fpDraieols0setoio oo1lp  lnetls arta( oou0aee iieiltls2umn o u4alenir oytfaDeanes s trto(m io1amtnlies s)a2rmxront4tpx mf3tas a umuvp;u0tleomociadfm  auvols)t2uoxr iodllenlivsa( artr( pno4apen f3iadfa2ranvs ()trtrxf3to1fmD ln o s setmxo3ny1lmtemieia(f rrmu oot0tpe mo3tat s2ua(vo u0 ltoifcoa1fa e uvs;s trto(o3nudomtelfcsat)srrrx  nt4oetnmo3tas a2emuvs;() lxrmrctatla e n o;( t2xrxmpiudom nmivs t aDtmxr nt1tpx mf3iyslaDrauvpnu) ltrmocto1op elneol( texr(o nydaltnmicsl()s2trxroot1oeeo iciltlm2el(vp (0altrmr iotoa rlueils0srxrirpnudlleelici () rumumpnt0aee  oeiysls ulnmo;()trerircio1oatrlueo;t) 2uoim3nydlmt livs ( aDum(rpou1apeo feildla el( p;t4aetoircoadfatrliei;t)seur(r3no4altnmiviat  Dtmxro;t4aptnifeiaslm2rl(ms;t) exoir3iadopD auvsl(0tetm(opnudom n iei ( arrr(mpou0alx mfeiatla2um( on()trxrmr3tydoat lu olt)trxrimpny1om  lfesat a2taxr no4olenioeild aDra(vonu0texnmf3iytfaDrliei;s) rtr(r3oodlpeemnvilt aDta(mpou0tleoiictadfm2el(vs;u)altnio3oydlp  luvs s  2to(mpiu1ol nmivils)a2ur(m ;o0tetomocildfa eanmo (4teerio3oo1oateln il(  2toxo3oo4lme lfes sf rrr(  ou4apx mfeils a2eanvsnt)trerxo3oatlmDr ies;( s2ur(mpny4lpte fesas aDta(m nu4tlxnmi3iyt s2ua(mo t4aexrir3iadfpDr n ilt) 2xm(m3nodaptelfctasfsDtr(mo;t4tlen f3iadfs rm(vo;(0tetoxr3iotoa  anvols0teuoxm3oudopeelfesasfarrrumoot0opt mf3iadls ra(von(0 ltoio oytfmDran o;t0seumxr oydomenlfesls) Dtau  no1tptoifciysfa2rl( s;(4 lerxf ootoa  anvo;(0 2umxo3ny4ome  nvi s) 2umx ooo4tpx  i3ildfmDranvo;u0aexnxf oa1fate n i s s2xmimpnu1aptemfviat) Dumumpnu1alt  iciyslaDrlnvp u0treoxr iadfm elu i;s  2urio iy4lpe  fcsa(  rtax ont4oex  fetytla2ul( s t4trxrio iodlpDe ueilt0t2xoxo3iy4om elivtls aDrax ooo0tptn ocildlm eaums u4 exrxr3tydfpDeln ols)texoxo3no1llt  ncsas  rrax p;o0ape mf3ilsla2rm(vp;(4 ltrir3iodomDrlnvo t  2trim nudol elfei (fsrraxmpnt4texomfeiyd s rln on(4 ltomrcoa1oaD auei t0setr(r io1ap nlici s  rumumpnu1tltomfeilt m2rmnvo;t4aexrxo3oa1fmt  i slt trurim nudlme lnctl() rtmurpou1aex ii3tadfsDua( p;(4trxoir3ootlmt ai i;t0 rtmirpiudoltn fctas)aDtr(rp;u0apenif3tltlaDum(vpnt0alermf3totopDelies t) exoirpnydomtemicsls a2raur ou4opxo ieiatfa uanvo u0tetoxr3totfpD lneol()s2urim3iy4optn neia()arumx ooo0aeeoiiciys m2eauvo;u0 lxniocta1fptrlueo t  rtoxm3nudope lnet () Dua(ronu4opxomociat m2eauvo;(0tetnmr tydoa ran o ( s2uo(o oudop  lfvt tfs2tm(m no0optomoctysfm emnmpn() rerio3iydomt li i;t) 2xmirpny1aptelfei s s2urxm nu1tlt  i3tltlm rmu p;() rxoif oytomDe u o ( s2tr(mpnydaltemfetat aDrr(m no4olt io3iltfaDeln o;u)aexriociotfatr i s (  rxoxmpnu4apenmneiat srtmxm oo1texnmfciysfm eauvo (4 lerifcoy1fmtranvilt  euoimpiy4olenmnet s sDtmu  ;u4tex io3ilt mDuln sn(4artoxo3oytlm  lnes ( texrxrpou1ap   iesas) rrru oot0olxnmf3ils a umumsn(0 rtnio3iydlp   uvolt0 ruoirpoy4am  miesatfsDrr(rpoo4aleo fciasfm2rmnmp u0 etnmrctodoptelues;s0 rxrxmpiu4altelfvs t a2rau p;t4opeoif3tytfsDeanvsnt4 etnxfcoytlp  aivi;(0s2um(m ny4al   nvtl()s2rrumonu4oet mfeiydfmDranvs u) rermfciydfm rlueil(0setmimpnodapeemnetlsfs2ua(mp;o1tlxnmoetlt aDua(vp t) etoxf to1fm e ivi (0 2uoir nydopee ivslt) rumxmoou1tpt mfciadla2em(msn() ltnio3oadlp eau o;s0 rtrxm nu1llte fcs ( srtm(r ot1alto ociaslaDuaump u0 ltoxo oa1lpt lnesls)setmxr oo4ap e ics t  Dra(ro;u4ale mfctydfm ean ont0tlxrio3tadlmte u i;t t2xmxmpny4aptnmneilt aDta(rooo0oeeoiiciatfa2eln o t0 lxnmr3oy1op eli o;s tetoxm ou1altnmivil(fsruaur ;t0olx micild sDua( o (0 rermf3iytfaD anvslt  2xrxo nodlpe  nvslt aDtau  oo1olen fciysfa ulnvp;u4trxrio3iydlp  li s s  rxmim iu1omeemfesls s2tru o;t4tpxnioetyd s um(vs (4trtnmfcoydlptrlneslt0trurim3iu4altnmfet s arumxm ;u4apx mi3tat a ulnmo;t4 exrir oatlm   n ilt)tetmxm3iodapeelivs (faDum( pno0tlx  i3iydfsDuanmp u)texrmr3tytfmDeluei t0 eur(o ou1ap e fcia() rururo;o4olxnii3ias m2el(vs (4tetrxf3oodomDranes;()t2xmiopoudop emiesa( sDtm(m ;o1ole  i3iysla2el(von(4aeenmr iytomDrlivo s)trxmxm oydol nlncsa()srra(mono4apenmo3iydfa ul(vp ()tlxnmf3oo1fatr uvo s)s2urir3io4am  licsas) rrm(m nt1tpxo f3taslmDrauvpnu4tetoircio1oaDeaues;(0 etrim3nodapte neils)srta(rpou1texoiociydlm uanvs () lxomo iytoa eliei s  2umxr3no1lpen ivilsfaDtmurp;u1oltoio3iatfm2ea(vpnt0 rermf3oadoat anvi;s)srxmxo3oo4ll  mncia()srumxm ou1aeen o3iydlmDeluvs;(0 rtomr iy1om rlneo ()srtr(mpiy4open icsl(farrrurono1tpeomfeiydlsDean s u0altnio oo1fpD ln o;s) etm(r ny1lltnmfcs () rraxmonu4optn ictasls2rm(vp;(0tetrio3iatoaD lnes s0te
\ No newline at end of file
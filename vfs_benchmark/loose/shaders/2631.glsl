@@ -0,0 +1 @@
+u i;t t2toio3oo1ame mieil(  rurumpou1apxomf3iad aDemn o t0 etomf oodoa   uei t0teto(o3ny1lmtelncs s  rrrxr ot1oleoiietasfa em( s u4 rtomo3io1lpDeaivo s) euo(m3oudomtemnct s)s2umxrpou1apxomoetys aDrlumo;u)trtnmr3iodlmDrai o;()t2uoio3no1olen icia(f 2rm(ronu4oetomictatlm2rl( p;u0tltoir ia1fa r i ols)t2xmxrpio4amtemict t aDum( pou1tltoiiciytls2rmn s;u4 exnxr oo1faDrau o s texoxo oodlltemncsasfs2rauront1tpxn f3tlsls2rl(vs (4 eenir3ta1fmtr i o;( texrim iodlpeelfcil()srtaxmono0aptnmfciytfs emu p u0texomfcty1faDelivo ()srxo(mpoudlltelfvi s) rra(r ot1ape  icilt aDrlnmont0trerircia1fp ranvo s) 2xo(opou4ll n iei (faDrrx  nu1apeomfeiasla2em(vp t0 rtnxr3oy1opDrlneils)seumiopny4am nmnvt sfsDrrx p;u4ape ifeild s umnvs;u0artoirciadfm   i s;t0 exrxo3io4llee nvsa()sDumu ont1aee  icild m2ea(mp t4artnmoctodomDrlivs t)s2ur(rpoudlp  mivsltf Dta(m ou0teenmociyt aDulnmp u0 lxoir oytla  livo t texrxr3no4amt  ici ( arur(ronu1aptoiictydla2ra(von(4 exrxo3tatlaDrluvo;s teto(mpou1lm  lnvi s)srrrx  nu1aex ifcildlm ra(vp (0 ltoxrcoytlat  ueols) rumxrpoo4apt mncia(f rrax o;u1tpx if3tldfs2ul( pnu4 ltnir io1la e i i;( tetmxr iy1ale  ict ( aDtmurono0tlx iociltfa em( s;u0aetnxo3oa1om rlivi;(  eur(m ny4oleemnvil(  Dta(mpno0aex  octyt a2ul(vs;()teeomocoodla e nvolt  rto(m oo1om  lfeta(  rta(ro;t4alxniiciltlmDuau sn(0aexoir3oatfa  aivs;s)teumir3ou1ome  fcsl(  Draxront1aexnmfctat a em(vsnt0 lenif tydfptrli o;t  2toxm nu1ol  licilsf ruau pno4aetn icilt sDrluvont0 rerioctadopDr n s s s2uoio io4omt  icias)a2ur( ont1tpe  fctyt sDrm(vsnt4teenio iadopteai sls0t2xoim3oo4opt mnciatfarum(r oo1oeeo oeiysfs em(msnt)tlermf3iytlmte uvolt  rtriopoodomenlncsasfs2rrxro;o1apen o3iydlmDelump t)treriocia1fmt aiei ()trtr(mpnudllenmnvtat srraur oo0tlxn ietatfm2el(ms u0trxnir oa1lmDe i il(0tetr(m oudlpen nesatf Drmxmooo4tex ifciasls2rmuvs;u4 exoir3oydfmteaueils) rur(mpio4alt lnes s  rurumpot1optnii3tysfa2rm(mpn(0aetrxr tydlptrauvil() 2tmimpiu1lptn fviat aruaxmpno1tee mietldfa emuvs;u)tltrxf3iytop   ies;(  2xo(mpio1lmt mfvta( s2tmum ;t1oex iictad aDrmn s;u4trerio3oatfaD  nvsls)s2umxm no1ll eliet tfa2ur( onu1tet mieiyd a2um(vs;t4aeeoio iadomtr iei;(0 2tmim3ny4omt  fcs () 2urxr nt0opx ioeiysfsDua( sn(0artomrctodop e ueo;(0trtm(opoydole  ieia(  2umxr ;t4opt  f3iydls2eauvs t4artnif3tatfmDrluvsl( srtr(opio4ome  fesatfa2uaxrooo1oet mietasls2el(msnt)texnmo3ootfaD lnvo (0s2xr(m ny4am e ivil( sDra(m ;u1teeo ietldlsDrmnvp;u) ltnmf io1op e ueo () euoxmpiydal   nctat)a2umx p;u4ape mo3iasfsDrm(vs;u4trermociy1lm elnes s)trtoirpio4ale mfvtls) 2rmxro;o1tpxomociatfm2emumo;()texnif3tadfp e ueo;(  rumxm iy4optnmietasf Dua(r ;u0teeo icildlaDumuvsn(0 etrmocio1lptr uvi t0 etr(r3ny4omt  nviat)a2ta(rono4texn i3iaslaDumuvp;(0altnmrciytoatrai i (0srtoxr3ny1opt  nvt t arum(r ou1oetomictlslsDeanvs u0aetnxf oatfmteliei;(0t2xoxo ny1ll n ictlsfsDrm(r ;t1oltn i3ild mDeanmo t) eenmo todlat li s;s) 2toir3iu1op  mfcs s  rrmurpnu0aex moeiyt a2ul( snt0 etrxf3iydlm e n s;t) etrim io4lltnlfetlt srur( ooo0tpeo fetlt s2umnvp;(0arxnmoctydlm   i o s trum(o nodalt mncsl()srururp;t0oltnmociytfs rmumont0teerif oydoaDrli ol() rxr(m nydamt mfvsl(fs2trxr ou1oet mocilt a rmump (0tetrxf3iodfmDraueo s  2urxm3oy4lpen icta() Drmumpnt0aleomfciysfm uaumonu4aetomr iodlaDelies s  rxoxrpny1ole mncils a2uaumpno0tpxo i3tytls2rau s u0texrxf3iy1lmD lieo;t) rtoxo3iodomt mnvsas a2rmu p;o0tpto ociytls2rmnmon() exnmr3to1oaD lnes;t  rxoxr iudol emnvs ()arur( onu4teen f3tatla2elu s;t4 ltrmo ia1opD ai i;s  rtoir3ou4lpt  fvs s sDtaxr ot1oee  oeiyslaDeanms (4altnxo3to1oaDeanvi t)s2ur(m3iy1lp nlnctasfsrraxmooo0tlxomi3iatfs2uluvsn(4 renif3tatomteai il() etmxr3oy1ll  lnctlt sDrm(mpnu1oexomoctatfs ea( p ()texoifcto1oat anes t)seto(m3oydaptelfvs t aDtm(  ;u4tlxomi3tls a uau s () ltoio3todlpDeln s;s t2tr(opny4lm nmiesat aDrr( ont0ole if3iadfm rmn o ()aeenifciytfp ranes;s)seurimpno1om  mneslsfsrrmx onu0aex micildlm2ra(mon(4aleoiociotlat  n i (0s2xmxm iudameelnvtls)aDua( o;t0tle  ociatfa2el(vp;u)artnir to1fa  auei s  2xmirpiudomenmnvsa(  rrmu ont0oltoiieiydls2eauvp;t4 rxrxf3oa1omt  nei s)truoiopnodamt mncsasfsruaxr nt4tlxo fciaslaDemums u) lerxoctotfpD  ues;t)texr(rpoudamtn feia( arumx pno1alto fctytfaDea(mpnu4aexnmf totfmDrauvo s0 exrxmpnu1amte ietlt aDrmxr ;o1tpx moeiadfa2el(mpnt0 leoxo3iotoa rauvi t  2toir3nodomenmfcilsfsDtm(ronu1ape mictydlm el( snt0trerxf oo1fm elu il() eurxr ny4ameemnvtls)srumu  ;t0tetniietytfa2rluvp;u4aeeoxo ty1fatr u s;t  rxoxo3nydolenlnctat  2rr( onu0olxnmf3iltfa2uauvsnt4arxoifctytlpteli s () exmxm3ou4lltnmfeiasfsrrm( onu0ope io3iytlmDua( o u0trerio3oodfat au s;(0srxoxopnudaptelnesl()aDta(m oo4tlt ii3iys m uauvs u4tetoxr ia1lpt  ivi;t t2urirpno1ll  lncslsfsDtr(ro;u1texnmfctad sDua(von(4tetniocoa1opD  n o (0trxoxmpiu1ome lnct ( arurxrpnt0tpenifctydfa2rlu pn(4texoxf3tatfa eanvo;(0 2uo(r ny4lpee fetat) Drm(rpou1tex mociaslm um( p (4 lenmf3oodlatr uvols0tetoxo3oo1aptemnci sf 2rrxro;t0aexo o3iyt aDem(vo t) ltrifciytfmDeaieo;s srtr(o nu4lm e fcia()sDtr( oou4olxomfciydlm eau onu4alerircoa1lm rlnvslt teuo(rpoudale  neias  2tmu poo0tleoifeiydlm em(vo;u)teeoio3iatfp  luvol()t2uo(o nodoleemnciat) Drr(ro;t4tpx  o3ilsla um(mp;u)texrxfciytfpteau i s0tetm(opno1opt lnes (f 2tr(r no0opxnifeiadls emnmpnu0 lxnifcta1fmDrau s;t) rtr(r ou4lmtnmivs t srum( ont0tlenif3tyt m emn s u) leoxr3to1la r uei ( trxrxm3nu1omtemfeia()aDtrx  nu4oeen ieiyt a2ea(mp (4 rxrmocoytop r i s;t) 2to(rpno1ome lnvslt aDtm(m ou4opxniieiytlaDua( p ()aeeomo tatoa elueo s)setrir oy1om  lfei s srrmu o;o1apt  ietlsfaDrmn p;u) rtrif oydoa elnvsls0 rtrim3io4lptelfvs t)s2rmu  ou4ape  ieiyd a2uanmon(4aeenxf3oo1fp eluvs t teuoxr io4lmenmncs t)a2uaumonu0tltomfetldlm2ua( sn()alxnxrcoadlm raivo;t0 2tmxo iu1ll nlfci sf rrrxm ot1oee ifeilt a eauvon()treniociytfm  ln i (0t2xo(r oy4olt  neils)a2uru  ou4aet miciasfm2elu snu)tetoir iotlm e nvsls) 2uoxopnydolt miciasf 2ra(r ;t4tpxo fctas a elumsn()artrxr tydopD  ivi t) 2tmxo io4optnmfesltf Dtr(  no0oexoioetld a emump;()aeeoxfciadopt  ieslt0teuo(r3iu4omtnlics t  2ta(r ot4oexomfeiaslm emumo (4arxrxfcty1fmD lueo;s t2xm(m iu4am e nvil(f Dtaxmoot4tpt miciatlm2rmu sn(4artnir oatoa eanes ()trurim nydll  mncil(fs2uaum no1opxnmfctatls em(mo;t0alxoxo3io1om   ivo;t srxm(o3iu4opt mfciltf Dtrurooo1olt mieiytla uauvo;t4texrmo oa1fa  luvs;t)t2xrxmpno1lp elnvt s) Dumxrpot4apx mfciltfmDumuvo u4 rxoiocoydfm e u o;()t2um(mpno1aptnmfeiasfs2tru  nt1oet mfeildlsDra(mo;u4 rxoxr ta1omDeau s;t0 etr(mpnu1lm  mnvias sDtrxmpot4aeenmfcildfmDum( pn() lxrxoctotom eauvs s0teur(r3iu4apeemivs tfaDraxrono4tee mfcils s2rm( pnt4 lenmr iy1fa  auvs t0texmxm3oudal nlfeslsf rtmur ;o4tlen o3iat s el(ms;t4aexnxfctydlp  luei;t0 rxrxo oudalt  feslt)s2uaxmpnt1olx mf3iasfaDeluvpn(0 rtrxr ty1fptran i s sexrxmpio1alee fei ( s2raum nu4olt mfciytfm ul( p;(4 eenmo iytfatrlu s;t0 etmxopoudop nlnct t) Drrxmonu4tet mietydfa rlnmpnt0 lxnifcoadfaDran s s)s2ur(opoodlp n ivi ()sDtr(rpot4olt iiciltls ulu s;(4arenxo oydfpDe u o;t trxrxrpiy4lp  lnvi ( sDrr(rono0teeomiciadfsDumu s;(0alxnif3oy1oatr u ol(  etmim3iu1om  lncsls arrmx pnu1oltomictlsls2ua(msnu4alxrircia1om rai ol( seto(m3no1opt mietas)s2umum ou1aexomoetltfsDul( pn()artrxo oo1laD  ivsls0s2xoxopiy1lp e neias  2rrxrpnu0aee mfeiat s2eanvo;()teeoxo3totlmDeln s s) rxrimpiudal elneiat  Dra(mpot1tex mi3tytfsDel(mp;t)aeeoif iydlmt  uei t)sruoxopnu1altnlnct ( s2tm( pot4aeeomietytlm2em(mo u4arxrio3oa1omD lu o;s)trumxm oy1am e iei tf 2rmxr ;t1tle mo3iydfaDumn onu)trtrmfciytlaDeluvi;(0t2xm(r3iudape lnesat sDrm( o;t0olen ieiyd s eauvs;t4 exoif totfmt aies;t)seumiopno4amtelfeias)arumxmp;o4altn ociatfsDranvp;() rxoif iy1lmt  i il( srtm(mpoy1ope mfcil( s2trx p;o0altnifcilsla2emumo;(4 exomrctotfaDrlu o;( sexmio nu1am  lictatfsrtm( oou0apenii3iydfa rl(vsn(0artoxr3ia1fp rli ils texm(o3io4omen nct tf 2tau ont0tpt mfciasfsDra(ms (4 rxrmf tydop eln ol(0t2tmxopny1lmeelncs tfsrumuro;t0oet mociadfs2umu s t0aeeniocootopD ai slt0trtrio3io1lmtn icia(f rra(  no4oltomfeilsfa ranmsnu)teeoif3ootfaDrauvi t)sexmxr oydoptemivsl( aDumu  ;t0ope moetatlm2umn p;t)aeermr3iytfaD  uvs;(  exo(m iodopeemictlsfartaxmoou1alenmo3iytfs2rlnvs;u0 ltoxociy1laDrlu s t srxmxrpio1lleemfcias) rtmum ;o0opt mociys m rm( s (4trtnirciadom r ivol() etm(rpoodlmenmfet () ruaurpnu1tpeoio3tltls rlnvs;u4 renmr3oadlp  lieils0t2tr(rpoydap  lieslt sDtrxronu4oetomo3ilsls rlnms () rtnmo3ia1fmteaieo;()tetrxr3iydop n ics (  Drmurp;u0tlxn feiytlaDranvp u)alxrircty1laD aivo;t0teuoxo3io4lp nmnvtl(  rtm(  ;t0teenmo3iysfm2raumonu4tltrio3oo1opDr ivi t s2trxr3no1ap   iei tfaDtmxm ou4aptn f3iyd s2emu s;t)arxoif oo1la   n s (0trtrxopnydllt miviat) 2tax p;t4aee iietad aDulnmont4 rxnmf ta1fm e ues;t0teuoxm3no1opt lnvsat  2rru poo4apx iiciltfm2uanvo t) rxnif todoaD  ueol( tetmio ny4lmtn iesl()a2tmxro;u4olxnifeiydls2uanvonu4arxrmo tatfmDelivil(0 rxmir iodlmt  nes t)aDrru  ;t4tpt  o3iadfsDrlnvs (4 ltnxr oo1laDeaues s)truo(o nodam emncsa(fsrtaxmo;u0opeomiciytfsDrl(mpnt)aexnmr oo1oa e uvs;s)trtmxo no1lp n fet ( sruru  ;o4tlen ictlt sDum(vo;t4arenxfciytoaDeai olt  rxmxr3iu1olenmfeiatfaDtrxr ;o1aeenmictlslaDrlnmon(0 lenifciy1oa rlieslt0s2to(m3nu1lp nlnet t  rtrurpnu1tpt io3iasfmDem( p u0 etrmf oydlpDrau o;s)s2xmirpoydlp e fcil( s2ua(r ;u4ape  f3tatla em(vsn() etrmoctytlaDe ieo s seur(opoy4lp nlfvsls) rtaxmpnt0texnmocils mDumn o;u0aetnif ia1oaDean ol()setmxmpou4lpee ivias)arrm(rp;o4olenioeiyt a rmnvs t4tetrmr iy1oaDr ieo s)trto(m iodol nlnvta(fsrtax pno0olen o3iatfm ranvo;u)treomr3totlmD au i s srxo(mpiydolte fcil( a2uaxmpno1alenioeilt mDrm(ms (4artrio iydfmtr u i;t0 euoxo iudapenmfesat  2urump;o0tpen f3tys m um(mo ()tetoifciytla  anvi s)srtr(m no4lptemfvia( s2rr(r ot4aeeomoeiyt sDelumsnu4arxoif iotopte nvols0setm(r no4lp emfei tfsrraumo;u0tpxomi3ias mDrm(vsnt)alxrmf3oydlpD lnes;(0s2xoir oydoleemfciltfsDrmxmont0tpt mi3iadla ul(vs (4aexrircoytlmt aivolt  2tmimpoo1lmt  iei () rtrx pno0tlto icilsfa2ul( s t0arerio3iodlptrai sl(  rxrxopio1alte icil(fsDum( ooo0olt  i3tlsla ea(mp t) eerif oo1fp  aneol(  rumxm oydlltelneta(  rrmx ont0alt  iciysla2ul( s t)arermf ta1fpDrln o s t2xoimpnu1omen nei s aDrm(  nt4alt  oeilslmDem( p;(4 eermr oytfmt  ieo;t teuriopiudopt micslt sDrmx  ot0aleniiciltfmDumnvo t0 etrxr3oatoa e u o;s srurir ou1apee ivs sfsrtr(m nt4aetnmo3ias m2umuvon(4trxoxf iytomDelnvo ()srtm(o3oy1op nmivils aDra(m ou1oetoii3tltla2rl( o;(0aleoxf3iytfaD auvi;t) rtrir3iodape  ivt (fsDtmu poo0tltnioetasfm2eanvo;()aeenxo oydlmteaivi s t2xoxm3ou1am emivils s2rmu  ;t0ape  fetasfm eaumo;u4trxrmo oytlpt auvil()s2uoxrpoo1openlfei tfsDurxrooo1oet if3tldfa2eaumsnt4treomrciodlm eauesl(0srtmim3no4lm n nct t)aDurur nu4aetoiictys sDum(mpnu)trxoxo tadfp rlnvi s) 2xrir3iodal emnet sfa2um(r ot0oeeomi3iydlm2ea(vs (0texnxo iadomte ieo t)teuo(o3iu1lptnlnvs (faDtr(rooo1aee iictyt m2ean p;u)tetnxfcoytlmte n ils  rtoxopiy1alenmfeslt a2uaxmo;o1tptomf3tltls rmnmp;u0trxoxo3tytomD lnes;t srxmxr nu1aptnliei t s2taum nt1alt ifciytla emn pnt)aetoxociy1fmDelivols t2xr(o3ny1lpe lies ( a2um( p;t1alt mieiltfm umu s u4teerxr3ootfm  luei ()tetrxopoy1ale livias) 2rmxrpnu4tptomoeiyt aDulumo;u4 rxomo3ta1fat  uvi t0 2toxmpoy1om  mietatf rtmx ono0ape moeiad a rl(mo;(0alxrmf3to1fpD  nei () 2xoiopny4ole lfeil( a2ra( pou0texn ocildfs2um(vs t0teerxr3tydfp elnvo t)trtmxm3iy1lpenlfcilsf 2ur(  ou4oet ioetydfa umuvsn(0texomfcia1oaDrlnvi t0 etmimpou4ope  iesa(fsrta(rpnt1aet  oetys a2elnvo;()trtoio to1oa   i i s0s2urir3nudll  lnvilt)arra(r ;u4altoifciyt m2rmump;()texomrcia1fp raueslt t2uoxo oudll  lfvi (f Durxmo;u1apxnio3iatfs ua( p u) rtnio iatom r iei s)t2xo(opiu4lpt lfvs (  rum( pnu1apx if3iat sDea(ms;t4teeoir3oa1om r i s;(  2tmxo ou1openmfetls sDtaxrp;t4aetnmicilslmDem( snt) lerirciodfa elnvs;(0 rumiopiydlpeelnctls  rur(m nu0openmf3iatlm el(vs ()altoif iy1optrau ils)t2toir nydapt  ncils aDur( o;o1tlx ifctldlmDelnmp;u0arerxocootop r n s;(  rumxr3nudllt lict t) rra(mo;t4apxomfeiytlmDuaumon(0tetoir tydlmtr nesls s2xrxm3nu1aleelfvt sf rra(mo;o0aptnmociltfs2ua( pnu4 lxnmr oadla  livs;(0 rumir3ny1ale lfes ( aDuaxrp;t0tlenmfeiltlm ea(vp;t) lerxo iodlm  an o t srxo(opoy1apeemieia()s2rmxmont0aet ifciyd m ul( o (4aexrmrcio1lptranes;t t2umxr ou4lle mfcia( srtaurp;t4oleoiiciydfm em( s u0trerio3tydfat  ivs;s)srur(rpoo4oleemnvsat) rrr(monu0optn feiasla2ulnmp t4tlxrmrciydfaDr ivi;() rtmxrpnu4lpe  fetls sDta( o;t0olx mo3iltlmDuau s t4altnxo oa1op rlivi;() eumxrpiu4lm eliei () rua(rp;o1teeo icildlm2eauvs;t4tlxrxf3iotlmD lnei () rurxm no1omeelnviat sruau  nt0aeenmieiydfm rlu sn()teermo iatfat livi ( trurxo3io1altn netlt s2uaxroou1oltnmfcils sDrmuvonu0aetoio oo1lm   ues;s0seuoxm3nu4apenliesl()aDurur ou0oex  fctys sDul( p;t4aleomf3totoat  ueils srtoio3oudoptelfvsl(faruaxm ;o1ope  i3tls a2rauvs;(0trtnxr3tadfmtr ivol( s2xoim oo4optn fvtatf rraum ot1apeo i3iydfa ea(vpn() leniociotlm  luvi s sexm(o iodamtnmfvsat a2rmu ooo0tlt iiciys s el(vsnu4tlerio ootlaD  ivils0s2toir iu4oltn iei (f 2trx  ;u1tlxnmo3tydla ra(mo;u0 rxrio oytlmteaieil( setoirpio4lm elivsat aDumx  ;o0tpxnmiciadlm um( s;t4aetnio3tydfm eaieslt0s2um(o3no4om   iei t srumurpoo1tlto fctaslmDra(mpn(4artrmociadomte n s t0t2xmxm oo4olenmncil()sDumumoot1tpeniictldfaDum(vpn(4arxrmf tadla r uvs s0s2xrirpnydll  mfvi ()s2taxrooo1oeeomoetadlsDua( o t0 rxoxf3oydfm r uvo;t) rxmir3io1opee fcilt) Duaum ot1alto oeiys a2rau o t4tltoxf todfpt lieo s  rtr(m3no4alenlncias)a2raurono4openmf3tytla2rm(mo t4areoirciatlaDe n ilt  2to(r ou1amte ncia(f rum(ro;t1aeeoioeiytfs2rm(ms;(0artrio3iytfp  lneo;()texo(o3nudlm   feslsfsDua( o;u1tpx ifctltfaDulnvo (0altrmr iadlm r ueo;t0 eumirpny4lp e ict (f ruru onu4apx mietatfs2uanvont)aetomf3iatfm   uvs;s)srxrxo ou4lmt  nctlt s2tm( o;u1apxomoeiltfaDemu p ()aeeoif tadlpt  uvsl( s2toxopoo1aptn fetas artaurono4ape mfeilt s2ulu p;t4arerir oytfpDraneolt0sruo(r3nu1omtelivt tfarrax o;o4tpeoiociasfa emnmo;(0 rtnmo oodfaD lueo t trum(rpiodom  lnesat s2umxmp;o4tpt  fetatfsDrluvs (0tlenif iotom rluvil(0srtriopio1ll emieias)s2rr(r no1alxo fciatfs2ra( s t0 rtomr tadfmt lu s s0 2tm(m3iydlmtn fctl()a2rax pnu4oex moeils sDea(msnu4alxrmociotfmDrlu s;t seuoir3iu1apeemicslt) 2tmx  ;t4tptomoctlt m2em( sn(4aeerxrcoadla e ues;s) etrxo oy4lmte neiat  rum(root0tlx moetys aDuluvs;u0arenmociy1lp e ivi s sruo(r iy1ape mnvs s aDtau o;u1olx iieilt sDemnms (4alenio3tatfm  lnesls)s2xrxr3ny1lp  lnvias) 2tr( oou4tlt mfeils aDrauvs u) ltrmf tadom r neilt0 2xmirpio4ape  neil()s2ta(  oo0tetnif3iytfs2rlu snu4treomocoodfp  livo s)teum(opou1ol elfvt (  Duax ono0oexn octldfsDum( p ()tltrxr iydlaD  nvilt0setoim3ou1ol n fcslsfsDtmxrp;o0oexniietltlsDum(vp () ltnifcoadfa r n ilt)t2toirpiy1amt lfvsl( srrrxront0olx  i3tlsfs elnvo;t)artoifciadfaDranvo;(0 rtmim3oydome  iciat aruax pot1apeniociydls ua( s t4tetomr3iadomDelnvilt)sexr(o ou1ll n ivt s  2umxmpnu1teeo i3tldfaDem(mpn(0 rxnxr3ta1lp e nvil()trxr(m ny4omen ieslt) Drruroou1aetoif3ilt m em( snt0 etrmoctydfatrli il( srxm(mpoodap e fcslsf 2rmurp;o4altoifeiad s ua( o (0 rtoifctadop rln i;t  2xrxo oudlltnmnvia()a2ururont4tlenmo3tytlm2rluvs;u)aexnxf iatfptrlues;s0 2xoxopoy1lltelfeils sDtru ont1alxomf3iytfs2ua(mo t4trtnio iytoatraiei;s0 rtmirpnu1alt micsl(f Dta(rpot4tleomf3iydfm2el(mp t0 lxomociytfat aiei ()trxmio3oydop n ics sf rra(m ;t0ale mo3tysfm2rm(vo t)texnxo3ootlptrlneo;s)trtmxo io1olt mivils) Dtaumpou0oet  fctysfaDeln s u0 eenmr3tytfaDeliei;()setm(o3nodlltnlnvia( srrmu  no1oleoioctydla rln o;(0tltomocia1fpDe u il() etmxopou4lpe lnvtl(farua(rpot1tlxn octld a2emump;()tetomo oatfatrlnvo;t) 2xrio3oy1al e ici ( sDraur nu0openio3iydfm ulump;t)trxnxociadoa e neo;t) eur(o nu4ap  miesa(fs2ta(  ou1opxo ieiasfaDelnmp;t4artnmf3ootlp e nesl( t2xrxmpiydlpt  fvs sfsrrrump;o0tlen ociltls2el(mp;u)teeomocoy1opDelivi;( tetm(r oodlp nlncilt)artm(rpou0tpeomoetyslm2rl( pnt4 exoif3iatlat li i;s)srtoio oydalenlictltfsrra(m ou4aptn oeiyslm2rlnvsnt4tlxnir3iodop   i s;(0 ruo(o nu1omeemncs () Dtau  ou1teeo f3ildlm um( p t) eeomo3ty1oatrlu i;t)teuoirpny1am  mivt s sDta(rooo0oet if3iat a raumo;(4trenxo todfm e ues;s0s2uoxrpno1ap emfvslt) rtm(mpoo0texoifcildfm rm( o;t)aexnmr tatomteluvs;(0 rtmxo iy1ope miet ()sDurum oo4apxomf3tldls emums;()tetoxo3to1laDraivil() rtm(m iu4al nmieta(fsrumxr ou0oetomieiydfs ra(vonu4 leoxf3iotlp  lu ols0srtmio3io1lp nlfes t aDumxr ou1alx ioetadlmDrau snt4aeerircoa1opt  nvi t texoxmpnodole lfeia(fs2trxr no4tptn i3iytls2rl( p t4 ltrxr3oa1fp eaueo s)srxr(opnydal  lnvsat) 2uaxmp;t4tptnmo3iyslsDel(vo;(4arerxo iotfa  lneslt)seumxm iu4al n feia(  2uau pnt0oexn feiyd mDel( s u) eenmr3ootfa  anvs ()trxoxrpiodoltnmncs tfsDum(rp;o1olx ifciltfs ranmont4texnxf tydoptr iesls t2tr(mpiy4altnlnetltfartax pno4apxo ictaslmDumn snt0alerxfctydlatr iei t) ruo(rpiy4lmte nvt s aDuaxmoot4opxniociysls2ua(vp;()artnir3ty1la elivs ()trto(opno4apen fesls aDtax  no4tle  fciasfm ulnvsnu4teenmfcto1oat anvolt)trtrim3oo1llenlivt tfa2rr(moou1tpxn ociysls2ulu s;t) lenxr iadomD auvo t0s2xr(opoo1al n net ()a2um( pno0olt mi3tlsfa2rmn p;u)trxnxrcta1opt luvslt s2xrxr3oo4omt micsas  rur( p;t4apxnmf3tld s rmu on(4 ltomrctytomDe nvo;s)t2xoxr3oy1am   nvi ( sDtmumo;u0tex mieiysfmDrluvs u) rerxr tatfpDranvil(  etr(mpiodopenlncia() Dra(m oo1ope iietad a2ea( o;t0trtrir tydlm eauvilt  rumirpiydom  mfctatfaDur(r ;o4apenmicild mDeanvp u)texoifciotlm rlu s;s s2tmxm oy1ol emnvsatf Durumonu0apenmf3iadfs ua(vs;t0arenxf tatomteln i;s sexoxm3ny4alee fvtas srra(mpot4aexomo3tyt a rmu snt)alxnxocoa1lmteaneil() euoxr iu1lltemfvsl(fs2um(mpnt1tltoifciat s2eauvp;(0tetnif3iytfat auvsl(0 rurxo3oo1alenmnetas arraxmpoo0apxo o3tydlm2umnvs (4 lxnmr3iotfp rlu s;( tetoio oo1lp elnvt sf 2uax  nt4apenio3iys a rmu s;(4tleomf ootfa ranvi;s0trur(r iodole mfci t  rtruroou1apeomfciatlaDumuvpn(4 leoxo3ty1om raivils0 2xo(o oydamt mfvtl(farur(moou1aptnio3iys mDum(vo;(0aetnif io1faD  uvolt0texrxo nu4amee nesl( sDurxr nu1tpx mfcildfa umn sn(4artnir3ia1fpDr nvi s seuoim3ny4omte feslsf rum(rpnu0altn feiyt m uanmp u0alxrircto1lat  u o s)srurim3nodoptelicsa(fs2urxrpoo1olx iiciltlaDrl( s t4aeeoir3oo1fmtean o;t)truo(o3oy4om   fes () Dtaumonu0tptnifeiysfm eau o;t)altnio3oytlmDelnes () eumiopoy4lm   fctls) rua(r ;u4oeenmfeilt a eauvon()tlerio3oo1la   ivi;t)sruoim iu1alt  fvsat)aDumxmo;t4aetoio3iadlm eln o (4tetnir oodlpDr nvo;t)sexoxrpoudalee nvs s)srra(mo;o4tltoif3ils mDul( ont4 eerxo iotlptr neo;t0 2xmim nu1amenlnet ( sDtr(  ;u0oleoio3iadlm2em( o t)altomr iy1laDrlnvo;(0sexmim3oydlle liet t)a2urxm nu0aet  f3tad mDumu s;t0arxnmf3oodfpt anvi s0 2uoim3nu1oltelivta( srurx p;u1opx  ieiad mDean onu4alerir3iytlmt  i s s trto(rpiudopt miei t sDtrxmo;o4alxomietyt m emn on(0trenmr ia1fmt luvo ( texoxm iudom e nciltfsrrrxmo;o0tpe mi3ild a ra(vpnu) etrxf iadlaDeai slt  2tmio nu4lp   icia()srrrxro;u4tpxn feils mDrl(vp;t4trxrmrcta1fpDe uvs;s) eumio nydalee neiat)artm(r ;o1aeto ieiltlmDel( o;u4alxoioctytoptelivo;()trtm(rpou4omtelfcilt)sDrru  ot0oeeniieiyd aDeanvo;()arxrxf3oo1om  lnei ()trxrir no1ope mnvsatf 2rrum ou1oleomf3tldla2emumsnt)texoif ia1lm elnes;t  euoiopou4oltnmfviat  rrm( p;u0opx  ietlsfm emnmp u)artoxf iy1oa   ivi (0 rtm(r iy4ape mnvsa(faDrr(mpot1tlxomociasfmDeauvo (4tetriocoodomt  ueslt0trurio nudlp emfet (f 2rmumpno4alt  fciysls rlnmo;(0 exomr3iy1omte u o;(0teuo(o oydlltelnci t) rrm(r ;o1teenifeiasfmDuauvo;u0trxnxr ia1lp rlues ( s2umxr iydam e nvt sfsDrrumo;u4oeeoioctyd sDrlnvp ()aeenxoctotlaDelu i () rum(r oydllenlictat)sDra( oou4alxomfetlslm emn snu4trenxr ootla rai sl(0 etriopoydlleelivil()artaumoot1apxomoeild a2um( o t) ltrir totoptelu i;t)trxm(r oy1oleemfvi () 2ra(  ;t1tetnioctadfs2ranms t0 rxnmrciatlp  aieils)s2urxo oy1al emies tfa2rau  oo0opxo icild m ean o (0aleoxf oo1fat auei s) 2uo(m3iu4ap  mfvsas  rrmxmooo1oeenioctysfm2eanmo;(0trtoxrcoy1omte n s;s)s2xr(rpnudll e net ()s2rau  no0aeeomfeiaslm emn o ()trtrmf3oatom   n i s)t2tmxr3oo1om e netlsfsDrm(  nu0tlenmoeiadlm2rlnvsn(0 exnmo ia1fpDeln ol( setm(m3oydom  mivia()aDrm(ronu1tlxnmi3tldfs rluvo;t)artoifcoa1fpDe n o t0s2xrim3oy1lmee iet tfarta(r ;t1olto fciytfaDrm(ms u0altoxfcoo1oa  auvs t0s2tm(m iu1lpe  ivsatf Drrxrp;t4aexnmfciyslaDrm(mo;t) ltrxr oadlp  li o (0t2xrim3oy1lmeelfcsatfsrumum oo0aet iictltla2elumont4tlermf3ia1omteanvol()s2urim3iy4lme  iet (fsrumurono0tpe mociydlmDrl(vsnu0teeoir3ta1oa r u slt  etmir io1op emneils) 2rmur ;u4aee iicils s ul(vp;t4altrio iytla  lnvo t) etm(mpiu4omtnliei tf 2ra(r ;u1tpe  iciyslm ranmp ()aetomfcoo1om e n olt trtoio io4lm   ncs s)srumuro;t0alxn oeiad sDumnvo;u)tetnxo oydlpDe uvi;s  2trxopio4amtn iesls)a2tm(rp;t4olxn iciaslmDel(vp;(4tltrxr iadoptrln slt0 2um(o3oo1oltn ivt tfsrumum ;o1aexnmi3iaslsDuaumo t)aeermoctatla rlneo;s) rumimpiydaptn ivs ( a2trx  oo0olt mi3tysfm2el(vp;()aexnxfcoy1omDe ieo (0sruoxo3ny4am   ncs t)sDtru onu0teto ieiad sDum( o;t)alxrmo3oo1omDeau i t  2xoio iodolt livt (f rtmx ooo1optoifcilslsDuluvont)teenmfctatoaDr ies ()tetmxr3nydomt micta(f 2ta(moou0aexomf3ilsfs2ea(vp;t0 ltoio3iodfmDr uei s)trur(mpnudlm   ncias arurxm nu4oee mo3ias a2umuvs u) exnxo iy1latrliei;t texr(r3iydllenmnei tfs2tr(rpnu4tpt mfciadlmDra(ms u0 exnxr oodfaDr ueilt  2umxo3ou1omte nvs s sDtrurpoo4alxn f3tltlm2ua( p;(4trxnio3tadlatr i o;s0s2uo(r ou1ape livslt)s2tmxmont0tpxoio3iltfs2emums (4trenxo3oydlpDrau sls)srurxopoudol   fesl() 2ur(mpot0oleoif3tadfm emn p;u4tlxrir3oatlm e i il( trurir no4lmtemnes (f Drrxmo;o1apenmf3iytls2ulu ont4artoxfctodopDrlu s;s0truoim iu1ole livsas)sDum(  ;u1aetomoetysfa2elnms;(0alenxr3iadlpDeln ols)srumxm3iy4omenmnetatfsDta( o;o1altomfcils m rmnvo;(0aexoifcia1lp rauvi t)s2xrxmpnodaltemfviat)s2rau  ;t4tpenmi3iadfs umums;u4 rxomf3totfat ln slt) 2tr(mpio1al emneil(f rtrx p;u4oex  ietadls2rmu o t4altrxr3tydomDr nvs s)tetr(r3no1ale liei (faDuaxmpou4oetomoctls mDumu p;u4teerxfcoydfa  livi s trxmxmpny1ll nmnesl(f rtrur nt1opxo i3tytfa2ua( o t0teeoir oydoptran s s)s2xoir3io4ll nmnctl(  ruax  ou0oetnifciltfa rlnmpn() rtoxo3to1latraieslt0setrim iydlm e nctls srurx oou4tlenmictydfmDrm(msnu)artnifciy1fatrlnvil( tetoxrpno1om elnes (fa2rru o;u0apeoifeiadfs2rlums (0 exrxr tadomtelues;t t2xrxm oy4alenlfeil(f Drrurp;o0aptomieias s rmuvp t) etomf todlmt ai i ()trtoiopio4altnlivi t  2taumpou0oet mictatfaDrln s;u0 rerio3iodlmD luvols s2tr(m3oo4ap emfeilsfs2ra(m nu4aet mfctyslm2rl(mont)tlxoir tytopDelnei;t seum(o iy4lm   fvsat)srrrumpoo1open feilt a2ulums;(0aleomo3iotfa raivs;(0s2xrxo3io1alte ivs s sDurxmpot4tex ifeildfs2um( p () exnif3iydfatrlnvo;( setm(mpno1opeemfvias) 2rmxroot0oleoiictat aDrmumpnu) rxoxr ta1faDe u sls s2xoxo nydllee ivi (  Dur( o;u1opto fciatlm uln o u4 lxnmrcootlmDeanes;t s2ur(o3io4lm e fciat aDtr(moou1tetoifcildlsDrau snu0altnxf3iadlp   nes;(0teuoxmpnodoptn ncia( sDtax p;u1optnioctldla2um(vo (0trerif ta1fm rlu s ()teuoimpnydllt lfciat sDum(mpot0tlxomicias sDemu o;u)texnxfcia1fpD lneo t)sexo(rpiu1ame  ietls srrrxmono1tptn oeiysfs umuvp t4aeenmrcoydlpt liei;t0 etrir3iudameelnvil(fa2tmumooo4tle mfciyd m2uau pnt0 rxrmocoydoaDraneo ()texrim3oy1amtnlfesasfs2umu p;t4oltomictadls2ulums u) ltomf oo1oaDeli i s  exo(m nu4altnlfvsas)aDrm(rpnu1apxnmociad m2em( snu4 ltoxo3ta1lm raivo s) exrxo iudom e iet s arrr(mpnt4tptomf3iyslaDemn o;u4aexoxf3oo1oateln i ( trxmio3iu1optelnvsat) rrmx pnt4aptnmf3iysls2ea( p () rxrmf3iydlmt livolt0 2um(r3ny4lmenlieiat srtmumpno0tlxnio3iad sDem(mo u4tetoio ootoa rau i;t0truo(rpiydomtelfcilt)aDrau ono0tptniietat m eln o u0tleoxr tytlpDeanvi () 2xm(o3iodamenmfvsls)s2taxmoou4tpto ociysfs uau sn(0arxomrcto1oatelies ()s2xrim3no4alen nctl( sruauro;u4aeto ieiat a umnvp u) lermo iy1lat  ueols0sexrxr3iy1omenlies tfs2ua(m nu4opxnmoetytfs ea(mp u0aetnifcto1lmtr u o;t0seum(opiu1lp nmicsat sDtrxm oo0oetn ictytfs umnvp u0aexnmr ty1oatraies t)trxm(m io4am nmncsasfsrtm(moou0tpxn oetytlaDemnmpn(4aexomrcty1lm rauvsls0 rxo(rpnu4oleelnet ( artmx  nu4teeomfctlt s2rm( onu0tlenirciadla   u s ( s2tr(r ou1ll   ncil()arum(  ;t4olxnio3ias s2eln p u) lenxo3todfmD  uvi;()srtr(r iu1ame  nci () 2ta(mp;t1aptomoeilsfa rmnvp ()alenir3iodfmt lneo t s2xmir io4al nmfeta( a2ur(rooo0texnmo3tadfs eluvo u0tetnif tytlm eln i;s  rxoxo3oy4alt mfei sf Dra( ont0tptnmo3ilt s2um(vo u) etomr3oa1lmtelnvs;s0setrir3no1omenmnviat) rrrxmpot4apenifctadlm umumsnu4 eenxf3iytlmDeln i s  2um(m iy4lpen fvtls)srrm(rpoo4aptnmoeiyt s rlu p ()tlxrmo iy1lat ln i;()t2to(r3iudol n nvs () rurumpno0tlxn ictytlm2umnvpnt4alenmf3tydfaDeli s s)t2xoxm3oudol elnctatfsDrmx o;o1olt mfetyt m2ea( o;(4trtnio ty1omDr nvs;()seumxo3io1lm nlncs s aDuru o;u1aetn fciydls ua(mp;u)teerxrciy1fm e ivo;s) 2xmim3iudlmtelnvt t)sDtm(  ou1opt  f3iyt m2elump;t)aexnif3iadlaDrau o s srtm(r nodomtnlfei s)s2rm(r ;u1oeeomi3tysla ra( p;u4tlenircto1latranesls0texrio3oydap  lnvs sf Dtrump;t1openmfeiltfm2um(ms (0 lxoxo3iatopt  uvi;t  exmxm3oo1altnmnet tfsDtru  nu1oee iietldfmDeanvpnu4trxomrcoadlat  ivil(0 rurxmpiydoltn fvt ( srraurp;t0texomf3iadfmDrmu pnt0trenxf totoat li ol(0srxrxr nu1al emfvs t)arrrurooo0oexnmfeiatfm2elu onu) lxnmr3iadopDrlues;t) 2xoxo nydolte fvtat sDrmurp;o1oetnifetys a2umnvonu4artoxr oadfa  liei t) rtoxm ny4lpt mfvsas)sDtrxmooo4tlto i3tysls2em(mo;()trtomfciydfmDrlneolt0 2uoim iy1lpe  fvtatf 2umurpoo0optn ictadla2umnmp;t4tlxrmo ia1laDrln ilt)sruoir3nydlptn fct ( aDtmurpno1ope  o3ias m2rlnmo u) rxoir3oydop elueolt) 2urxm3iudlmenmivtl( aDtaumonu1optoiietas mDemn s (0 exrmo3tytla  ln ol()t2tmim3nodom n fct t)artmum ;o4oexnmi3tltfs2ulu o;u4 lermfcoytfpDr i s (  2urirpou1lmt  feilt)sDtaur ;t4olt iiciat m2ua(ms;(4altrifctydom e iei;t0t2xo(r io1am  lncsas sDrm(  oo1aee ifctlsfmDea( o;(0 rtnmf3oytfp   i o;t0 exrxm io4optn ics s)sDrrxr nt1oexniociadlaDran on()altnifciodfpDeaueo;( s2xo(mpoy1amtnmnesl() Dta( pno4altoioeiysfmDua(vs;u) ltrxr3iatla eaies s t2xo(o3nu1ol nlfcs t  2umu pno4optomo3tysla2umnvs;()tleoxo3ta1op rlneils0trtrxr oo4lmen nvt sf rua(rpou0apxn f3tysls elums t)tetomfcoytfa eli ilt) exm(m3nudol n ietatfsDum(r no1opxn f3iysla ulu s t0trtomo3iy1opDe u olt0t2tm(r3nu1lleelnvt (fs2umum ;o4alt  fetytfm ul(msn()aetoif3io1omD luesl() 2xo(rpiy1open ies s)a2taur nu4tpx mfciytfmDumn snt0 rtnmfciydom e n sls s2to(opou1opte ict () 2ua(m no0olenmf3iad m2emn o () rxnxo iy1fmteanei;( srtmxmpnu4ll  lfvsas)s2um(rp;t1tpx mf3tldls um(vonu)aleoirciy1oaDraivs;()seumimpnydomt livil() rur(m oo0aeen o3iltlm2um(mon(0 ltnircto1fp  aieo;t) rtm(m3iu1ll elfeias) Drrx ono4ale ii3ils a rmuvonu4 lxrxf3oa1lpDr ivo t)s2toxr oo4ale mneilt)srra(rpnt1texn f3tad m2eaumont0trermf ootom eluvo ()srxmim iu1lle  iei (  Drmx ono1alt iietatfmDea(mpnu)trtnxo oatom rlivs s)tetoxr no4lme lieiat aDrm(rpno4alt  o3iytlm2ua( o;u0 rtoxr todomt lueo t trxmxr iy1olen ncs t  Dtmu ono1apx ioeilsfa ean sn(4artnir ootfaD ai s t0s2umxopoydom e ieil(f 2urumpoo4tpx mociysfs emumont0 rerxo3iytlpt  uvs;t0s2xo(rpou4lle  fei (fa2ur( oou1aptoio3ias s2rln s;(0tetnxrcta1omD luvi ()t2xmio iodaltn fvt (  rtau oou1tlt mo3tyt s2ulnvs t)tltomo tytfpteanes (0sexo(mpiodop  lfvt (f rta(r ;u0aex ioctysla rluvp;()aeeoif3totfaDe nvols0trumxmpou4lme lfet (  rta(mpnt1tpe mietys mDemnvonu) lerifciydlpD lieo;s)teumio io4al e ivs s) rur(rp;u4olenioetyt mDrm(vont)aexomr oatom r i s ()setriopiu1amtemnetat sDtru  ou4texomfctls s elnmpnu0alxnxr3ootlmtrluvs t0t2uo(r iudale  ivtatfaDrmum nt0olx io3iadfa ean s ()trerxf3totomDranvi s0 rxmxr no1apt lietls)arrmxmp;t0oex  iciasfm em( p;u4texrxrcoadlpDeanvs;( teum(m3oy1opt  fct (f 2umu o;o0aleoioctld sDuanms t0alxrxocoodom elu ol()teumiopoo1aptn fvi (  rtmxmpnt1olxnmicils a ea(vo () rxnxo3oo1fp   i s s0 exo(o iydam emncsas  rra(rpoo1tlto fciltfaDeln sn(4trxnio3tydlmt  neilt0 2xmxr3no4optn ncsas)s2tr(rpnu1ole ifeiyd m emnvp;(4 rtnmocio1faDrlnvsls)t2toio3nu4oltnmivtlt s2tmxr nu4aptoiietas aDrm(mpnt4artnioctotfm   n slt) rxm(opiudlmtemfes s)sDurxr ot1olto feilt a um( o;u4 etomo oy1fa eanes ( tetr(r oydlmenmiviasfsDumu ont0tlxn oetyslaDea(vp (4 ltoio tatoaDrluei;(0trumxo3iudome mfei s)srtrur nu1olxn feiasla2emuvon()teenmfciytomD li i;s0s2xrir3oo4ll e neslt)s2trur no1opto feiydlaDrau on(4 lxrmf iodlateau s;s t2xoxmpnodame lfes t sDua(r ou4tpt mfciadlm2rm(mo;()aetoif iatfmtelu o;s  etoxrpou4lpte nei (  2rmx pot1tlto f3iaslaDeaump;u)tetrmo ootomtean olt)truriopiy1amenlfvs t srtaur ou4teeomf3tlt a ra(von(4 rtrmo tytfptr u i;(0trtmirpiodom elfvtas)a2uau onu0oetoifetydfs2eluvp (0teerifctatfp  ln i;()s2tmxopoy4omee icslt)sDur(rono4tpenio3tytfm ulu p;t4 leoxo3iodoptr u i (0seumim iydolenmfcilt srtm( ont1tpx micilsfmDelnvs u0alxnxf ty1fp rlivol(0t2toxr3no1omenmieta(  2uax poo1tlxnifcias m rau o u0aeermocoadfaD luei;()trurxopio1olt  fvtlt) rrau  no4aet ifctasfs2eanmp;(0teerxr3oytfp   uvo (  2toiopiu4olt mnvtatfs2rax  oo0alxnmo3iatlsDulnms u0aetrxo3iodla e i o;s) euoxrpou1ap nmnciat srumump;u1aptomieiyd aDumuvo;u4teermocoodopDe uvilt  eurxr iydaltnlieiat)srrmu o;u1alen i3tatfaDeln s;t4 lenxrcio1fm eln o () 2um(o iudal n nvtat  Dtrumoot0oetnioctlt sDrln s;(4teerxo io1la r u s;s0srtr(opnudaptn nesl( aDrru  no0aeen o3iatfm2ra(msnu4 rtrif to1fmtelivi;s0 2uoxopnudll emnvta(  2ra(mpot0oltomi3tldfaDem(ms;t)trxoxrcto1opt ln i;t0 exrxmpny4olee icils) 2tm(rpoo4ole  i3tat m rmn o;t4 rtrio ty1fate i ol(0 rxo(o3ny1lmee ivtl(fa2uauro;u1teeo f3iytfa uau o u4 ltoifcty1latr n s;(0trtoxopnu4lpeemncs ()aDur(m nt4oee mo3tyslsDumn sn(4arxnio ootlp  li il()setrimpnu4lm n ivsa( aDum(  no0ole mfetat a rau pnt)altrmo3iodfaDr n s t tetoxr oydaleelfesls)aDrmxrpnu1tleomi3ilsfs2umumpnu0aexriociodlpteanvs;s0srtmxo oy1lpenlicsl(  Dtaxmono4apeo f3iasfs em( s;t) ltrxf3iodlpDe i ol()tetoio3oydlp   ies (  2ururp;t4altnmf3iaslsDulnmo u0 rtomfcoatfptrlu s;t0sruo(m3nudaptemfesls)aDurxmo;u1olxnmfetldlmDulnmp u)aeenxf3iadla   u sls)setoxm3iu4ap  mfvslsf rurxro;o0alxnmi3iasfa2ea(vs;t4 lxrxociadoaD  nes;s0t2tmxrpio4altemfvtas a2rmx  no0tleniiciyslsDrln o u0aeeoif3oadoa elieo s t2ur(m3oo1lpeelivsa(f 2rauro;u4apen ociatfa2ua( p;u) ltnxrcoa1opDeau sl(0seto(r3iodamt licsa()sDtr( poo4aleoifciytfa2rlu o;t4trxoxr3totomtrau o s) 2trio oo4lp elfcta(fsrrmxrono4tlx  feiytfm2umuvsnu) lxnmo3oodfpDe uvs;(0seuoim iydllenlnvsasf 2uaxmpou0tlenmfciltla emnvp ()aeeomr3ty1omt lnvol(  eumxm3no4ameemfeil() Dtm(m no1oeen o3iydfm2uan p;u)trtrxr3iytomD ln o t0teuoxmpoy4al e fvilsfarumump;u0alen fciyt aDemn p;u) ltnxr3iydoa  lnei ()tetmimpno1omtelfvs s) Dururoou1tetn i3tasfa2rau snt4artrir to1la   n i;s) 2tmxrpiu4lp nlfvsl(fs2urxm ;t4aee  ieiyd a2rau pn(0 renxociydlmt  uvo ()t2uo(m3nudlpe lnvtl( srumx p;t0aptniieilsfsDranvs;u0arenmo oatfp   u s;()s2urimpou1ame  nvta(f rtr(mpnu0olt moeiys a2ua(vsnu0aexoioctytfaDrlivi t  rxm(opoo1llen ncta(fsrum( pnu1oee  fctlslm umnvo;u0 rxnio oodlmDe uvolt)s2tm(rpno1apte nvsa() Dra(  ;o4opx ii3ils aDulnmp;u)texrmf oatfaDrln o s)srtr(o3io1olt micsas srur(mp;t4openifciad sDranmo;u4 rtoxf iotfp eaneils  euo(r ou4ap   fvi s srurur no0texoioctaslaDraumo;u4 rtrmf iy1fpt ai o;()setmimpnu4lle mnvt ()sDrmxmp;t1opx iietyt s2ra(vp;u0arenmo3oydlpDr nei;t  2tr(r3iydlpe mfciat)a2uax oou4teeomoctad aDeanmp t0trtnmocoadlmDeli olt  2tmxo3oodam emivs (f Dra(mp;o0apenmociyslsDrluvp t)tltoxo3oo1lm e ues;s)srtr(r3oudom  lieslsfarrax  ;u1tpx io3ildfm eanmsnu4aleoir iotfmDelnvil()tetr(m nodolt  ncsasfs2ra(roou4apxomo3iysls umnvo u4aexoxf ia1la eln o t)tetmxm3iodamt  fcsa(fsDur(mo;u1teto fctasfa2rlu o u4 ltoxf tytomt ai i () 2ur(m iodal nmivi (  2umurpoo4tlx if3iyd a rl( s (4 exrxfcto1omt ai o s0truoxr3iu1optnlfvtl() Dumxmono1teenmicils m eaumon(0trerif3oytopDrln slt)t2xo(m3oy4optnmnvs t sDtm(mo;t1olx mo3iltfm2rmnvs t4artrirciatfat  n ilt)srumimpiydomenmnvilt  2rm( pnu0oleomieiasla elnmo;(4 rtoio oy1opD an s s)truoxmpno4lpee fesat)srraxrpnt4oetniociat m2eauvsnt4aetnxr tydlat  uvo;(0teuo(o oy4olte feil(  Drrx p;t1tleniocils mDulnmont0 ltnmr3oydlm  auvi;t0sexrxo3oy1ap elfetls  ruax poo1opxomicildfa ea( p;u0tltnmo3iadomte n o s  rtmxopio1lpenlictas)s2tm(ro;u4apto oeiadfaDrlu o;t4trxoxo3tadlaDrlivols)t2umio nu1lpe lfei s  Draxr ;u1tpxnii3iyd s2ra(mon() renxf3oadomte uvs t0t2toim3nydalt mnvia( sDrmx  ;u0alxn i3tlt m rlumo;t0arenif oa1oa r nei;t t2uoxmpnodopen fesas)sDrr(r ou4apt moeiadfsDumnvonu4 rtrio3iadoptraneo t srxo(o oo4alt livsa(  Drr(  ;o1aptnmoetadfs uanvpnu) reniociy1fpD au ils) 2to(o3oodlm elfvi t a2uau oot0apx  ocildfm2umnmonu4trenioctodlptr nvi;s0trxmiopoydol e ietltf rtmx poo4olx moetasla umu p u0 lxrmo3tydom   ieol(0s2tm(mpiy1apee nesatfarumxmp;o4oeen f3iasfa2elnvsnu4aexrmf oadfaDrlueil()truoxr nudomenlnetlt a2tm( poo4tlto ictldfa rlu o;t4 rtnir oy1lpDrau olt0s2urxopno4lptelicsa(fsrumuro;t4tlen iciyd m rluvo;t0texrmocto1fat aues;( truo(opno1oleelfeiatfsrrrxro;t0aeeomf3tydls2rluvs t0 exrmo3tadomtelues;t)trxoim ny1apt  fesatfaDurumooo0aptnmf3tldlm rl( pnu4 eeomocoodfp e i s;( t2xrxm nu1om  mivta( s2rmumpou1opxoif3ilsfa rm( o;u4arxnmr ty1lmDeli o;t)seumio3oodol  mneta(f 2um(rpou1aeto ieilslsDumnmo;t0 lxrmr3iotfm eaieo;() rumxo iy4ap nlictas artm(rp;u0oeen ieild aDrm( o (0tetrxf3io1op   nvo;s)setmxmpnu1llt livsls s2taum oo0opto o3iytla eln s u4trtnmr oatlmDelues t0truoxr oudomee ncias)s2rmx o;u0aptomoeiltfm2eau snt)tlxomf3iy1fp eanvi;t)t2xoxm no4lle mieslt  ruax oot0oeenii3iatlm eanvsn(0altoxr3oydfm ranvol(0tetoimpoo4ole lics s sruau pot0openmoetytfaDra(mo (0aeenifcoy1omteau ilt srxoxr3ny1om e ncsa(fsrua(rooo4tptoii3iasla ran s u4 rxriocoadfmtrli ils t2xrxmpno1openmncs t aDrm(r no1altnmi3iadlm2rlu snt)teenio3iy1lpDe uvs s)sexoxm io4omenlfeias aDumum ;u1oltoiiciytfaDrm(mp;u) exnmf3oydfateauvi s  exrxm3oydaltemnet sfsDtmx oot4ole mi3iysfa emu pn(0tetrifcootlaDrlueo ()sexrxo3ny4op n iei s)sDurxm nu1oet iieiltfaDrln s (0 rtnio3ia1fmDelivo;s)seurxopnydolenmfctl( artax pot4oexo i3iys a ranvs;()tltoircoo1lpD lneol(  ruoxopiodap nmnvi (f Dtrumooo1tpe moeiysfs2eauvs;u4trtrifcootfp eai olt)teumirpny4om   fvsls srtru  ;t0aetomf3iyd mDuanvo;u4texoxr3tydlmtranvilt0 euoim ou1ameelfcia()srrmxrp;u4tpxoii3iadls elnms;t0 rxnxrcoytopDr u s;( srtmxm3ou1ale  fvs tf 2uax  nu0tleomfeiydls raumo u0 lermr3oatfmteln ol()trtrxm oydap elneta(fsrtau ooo0tlenmoctat aDumnvp u4altnio3ootop  auesls)srxrimpnu4lpee nvtl(  Dtr(  nt4tlxomo3iat m raumo u)alenircty1lmtraueo;s)trtrio oo1lm emnct s) rtmxmoou1oee  i3ilsfs2rl(mp;(4trerircootop elivs s0srto(o ny4ape miesas) Dtaxro;u4apeomoeiysfsDua( snu0tlxoio tytlatean i;t)s2tm(o iy4llenmfcsas  rrr(mpnu4tlt mf3iatfa2umump;u) rerxf iytlptelu slt t2um(m3io4am nlfes (fa2rmx pno1aleo ociad sDelu o;t4texrxociy1fp eauvolt  eurio oy4ol elfct tf rrmx pnt4apx mi3tadfm ranvs u)arenio iatomte neolt srumiopny1oltemietas)a2rrxmont1aleo feiyslaDrmnvsnt4aleomo3oy1omDraies s0 2xoxm oodom nmncils aDuaxmp;t1opxo iciltfsDemu o t)alenmo oydlpDeliei s  2urim nu1ll emfesas) rurxmp;o1tpe  i3iltlsDel(mpnu0tetnmf iotlm eluvi;s)trtrxm3no1olt miviat s2uaumo;t1aex  i3iytls2elump u4 rxnmr todfaDr n ols)teurim3iodalee iei s)a2ta(m nt0tpxomf3tatfmDumu s;t) rxrxr oa1op r i ils)tetmimpoudlptelfet s srrmu o;u4tlt mfeiytlm2em(vp t4 lxomfciy1op  au slt trto(m iodlleemnes tfarrrxm ou0oexn i3tldlsDumn p;(0texrxf totomt liei s  2trxmpiu4ole lnvt t)arrm(m ;t0tle moetydfm2umn pnu) eeniociadomD luvs s0teur(rpnydlm nmfeil(faDrr( oou4oltoio3iatfsDrlnmont4tlenif iydlpDe iei;(0 2xr(m nodomt lfcsa(fsDtrxm nu0optnmi3tlslm uau o;()areomf3iadlm r i s;( setoir3oo1lptnlfci sfaDtau pot4oexn f3tydlmDrlnvs t4tltrxfcoo1omt  ues;s0sexoimpno4ope mici t  Dumxmoot4alx mociydfa uan p ()texriocto1omt  nvi s0 rtr(m3iydop  lics t)sDtmxm ;o1alt moctlt m uaump t4arxnxr oadfpD  ueo ( s2urxr3oo4opt  ici (fsruaum nu0tet  oetltla rlumsn(4artoxo3io1omt  neo;()teuoim3ou4amtelnvtls)arumu ooo1alto oeiltfs2um(ms (4aexrif3iatfp eli i;t)sexoxm oo4altelnvtasfa2ta(mpno4oet ioetyd aDuaumo;(0texrxo oy1la elnvi ()texrxrpiu1ope  nvias)arurur ;t0alen o3ild aDeau o t)treoiocoo1omte nesl()s2trio3ou1op   ncsltfartmxro;u0olenmfciad m ran s ()tltnxf3totfmtraivils0s2xoir oodlltelfesa()a2raumpnu0tpto icild m2eluvsnt)areoxr3oatfmtr ies;s) rxr(r ou4apt mncslt) 2uru p;t1oex moeiat m eanmpn(0 etoxo3oadoatelu ol()trto(m3ny4ll   nvt (fs2raxm ot0oetn ieiad m rlnmpn() ltoiociytlmDeliesls tetr(m ny1openmfet t  rrr(ro;u0alt ifcilt s rmuvsnt)trtrxocty1lmtraieo;( trxmim3io4al e fcils)s2rrxmo;u4open feiyt s rmnmo t0 rermo tadfpDelnvi;t0s2um(rpoo1omenliesl() ruaum ;o4aptoiociasfm elump;(4tltrmocootlmDrauvols  2urio3nudlpt lfciatf ruaumpot4oex  oetldlaDrln p;t4 leoif tadfat  i ol() 2tmim3ny1ape mneias) rurxmoou0oetoioetldfsDem(vs;u) eerxf todlaDeaies;( t2uoiopiy1altnlnesl( srrm(mono1oltoioctysfmDranvs (0altnmo iodoptrai ilt) rtrim nudal  lfciltfsrrrxm ou4oet  o3iltfa2rln s;t0 rtomociodopteaueo () eur(m nudap e neiat  rtm(mo;o1tpeomi3iytlm2rau s;()alxomr iodfm   n o t)texrxr nudaltnmncsa( aDrm(r nt0tee if3ild s rl(msn(0alxrmrcoadop rli i;s)s2tmim3ny4lmtn nvia()sruru p;u0olx ifctldlm2ul( ont0aetomr3todlpDr i s;s srtmxopnu4ll n fvil(f 2ururpnt4tleo fcilslaDrmuvs;(4aexnif3tytopD livils  rtmxm ny1lmtnmieil(  Dtr(  ou1ale  i3ildlaDumn o u)altnmf ta1oaDe i o (0srtrim3ny1lpe lnvias  2raumpoo0oexoiieiaslm2uluvpnu)alxrir totfpDeauvi s0 rxm(rpou4apt  ncs ( sDum(m nu4aexomfctytfmDuau ont0tleoxrcio1fp   ues;t  ruoxr3oy4lltemicsatfsrurump;t1apxn i3ias m rmnvp () etnmf ta1latrai s t)trumxo3no4lmenlnvta()a2rm(m ;o1tlx mi3ilsfm2em(ms;(0aexomrciatopDrlues t0srtmxo oodlm nmfctlsfa2ta(m nt0tpx io3iaslm rauvon()areomf3io1oa r nvslt)seuo(rpny4am n neil(fsDur(r ;u4aeeoifcildlm eluvs t0tlenxf iatopt auvi;()teumio3no4ll nmics s)a2ra(mp;u4opeo ocilsfs ulnvp;u4trxomo3iydop e nvs s)srxrxo ou1apee nctlt) rraxronu0texn iciysfmDrlnvo u0trtnio oatlaDeaieo;() 2xm(o no4am elfcs s  rtrx  ou4tlt mociytlmDuln o;(0 eenxr oatlateanvsl( trtmirpnudapte ici s)a2ta( pou4aeenif3ias m umuvo;t4 etnio oo1lmDr nvo;t trxrxr nu1ameelfvt s)arrmurpot1tpxoii3iltlmDemnvonu0 ltoif ootla rlnvsl( seurxo ny1op nlivsa(f 2trxm nt0alxoiociad s2em(vo u) eerxfciatfpDraivi;s0truo(r3ny4ap   netlt aDrrxrpnu0alt  iciyslaDulnvs u0 rtnif3oa1lat lu i t s2xr(mpnu1ome lfctl()aDtr(mp;o1alxoif3tyt mDeauvpnt0altoio iytomDrliei;t)trxr(r3io1op nlnvias) Dumx o;t1olt mf3tydlaDuauvo;(0trtrmfcoa1fmt  nei;( tetoim iy1optnlfvt s srurxmp;u1altomfciytls2el(msnu4alxnmrcty1omDelneols0 eum(r3oy1omtemncs t) 2ua(mpno1olt miciad a2rl( o;(0arenio3iotlm r nvi s0 rtrim iy1ale lieias  2rr(  ;t0tpxnmoetyt aDua( o;u0 rtnir3tadop eaneol(0 etoxrpiu4ol   fesas)sDumxm nu0apx mfctasfm ua(mo (4arxomf3iodlpDe ieilt) etm(m oy4lpt mnvtls)artrxrp;o1tpx  i3iydls rln p (4alxrmfciotfp rlnvs;s0 euo(r no1lmenmneils s2trumpot4altoifeias a2ea( on(0areoxr iydlmte nvil() exr(o nu1oleeliet ()a2tm(ronu0tpxoio3iaslsDeanms;()trtomr iodlm rlnvs;() exoim3iodam  lnvslt)arraxmo;t1tptn fetydls2umnvo;(0arermr3todlm r uvolt  rxo(rpnydomeelfesl( arur( p;u4tleo icildfm el(msnt0arxomocia1opt lneo s0s2um(m nu1lm   fcsat)a2tau  nt0oee  fetytlmDulu pn()teenmr totfa raueo t)srtmxm3nodop  livsa( a2rrx  no4aexnmieild mDuan o ()tetoxf3iotfp e n i s)s2umxo nu1lmt mnesas)artrurpoo1alx ifcildfaDum( p t4arxnxf3totlaDrlu i ()trxmxopiy4lmt lieia()sDumxm ot4opto feiltlaDrmnvsn() etoxf3tatfpteln o;(0 2urim3oudamtnmnesat  Drmxr nt4tex mieilt s elu s u4arxrxr tytoatr uvsls)trxr(m ou4lpe mfct (fsrua(moot0opx mieildls ra(ms;u)alerxo3tadfmDelivo;()t2umirpoy1am  livilt)s2umxront4tltnmiciyd a eln s t)trtrxo to1omDr n s;t)trxm(r3no1ll  licil() 2rrxronu4tlto iciltfa ul(vp;u4artrmo3oodfa rli sls)tetrxo nydapenmietls arta(ront0tlt ioetlsfaDrmnvonu4alenir ia1fa e n slt)setm(rpiu1lme mncil(  Dtaumpot4tpeoifetltfs2rluvpn(0 rtnmr iotfm   u s ()t2xr(rpiu4lm e nctlt a2rr( onu4oleo f3tad aDeanvo () exrmrcto1oateaivo s0trtrxo oy4olenmiei t a2um(rpoo4alxnmfciyt s eauvpnu4alerircta1lm   n ol()setoim3nodamtn ivias a2tm(rono4olxnmicildfaDulu p u4alxnmf3oatomDrlneilt) rtrirpio1llenmnetasfa2trurp;t0tptnmfcias m2uanmpnt4aleoxrcoadla e nesls0srxmxo3io4apenmivt tfaDrmxm nu1ole  o3iydlm ua(mp u0aeerir3oydfmt  uei () rxr(r3nu4ape lfct s aDrrxmpno0tlx mo3iytfm rm( pn(0texrmrctadom raueo;s)t2xrirpou1apen fei ( aDum(mooo1oetn ictadlm umnms t) rerio ty1fm r uvil()sruoxo iy4om elncs tfarta(rpnu1oexoif3iaslaDemnms;u0trtrmo ty1op   n i t sruoxm iy4ole mnesatfa2rr(mpnt0oee ioetad a rlnvpnt4tetnxr iotoaD luvi s) rxr(mpoodllen fcsatf Drmxmpot1apenmieilt mDraumpnu0tlxoxo iy1fmDelnvo (0srum(m3iy4ap nmncs t)arurxr ou0tetnif3iad a rl(vo (4artrmo3iodfpt li olt s2toio3iudomeemivtl()s2rmum ;t4alenif3iatfs2ua(vo;(0tetrxo tytlmD au o;()srxoir3oy4om nmfeias)s2uau o;u0tlto fctas mDrm(vsnu0 etnmf3oy1fpteaieilt  rto(o nydlm  mfct t)a2truro;t1aeeniociadfaDul(vonu)alxoxr oydlpte n sls  rtoxo oy1ol   ivtas a2tmu  nt4alt  feildla ul(mp u0areoxrciodlpt lieo;t truoxm3oy4altn iesl( s2rr(m oo1apxomociat mDrluvs;u) lxnmo3tydfm  luvi ()srumxm3oy1opeelnvsls)s2ta( poo1teenii3tytlm2ul(vsnt4aleoxo iodlp eauei;(  2urio iy4omt lnes () Dtr( poo0oeenmictls a eauvont)trxrxf tytfmte n sl( srxr(mpio4amte fvias) 2tr(mp;u1olen fctat s2rmn o (0tlxrxf ta1oaDraneol(0 rur(opoo4lp nlfcil( aDumx  oo1olxoiieiytfa2ul(vo;(0 rtnmo oydlmt ai ol()s2tmim3oudamt  fvil( sDuru oot1oex ioeiys m rluvs;()tetrmf iytfptrlu o;s0trtrxm3nodlm elfctlsf rur(rono0olto o3tad m elnvonu4trxoxo to1fmtrauvs;s) rurxrpoo4olen nesa(f 2umxrp;o0tet io3ildla ulnvs u)trxoifcoatfpDe uvi;t  rtr(r ny1altnlici t)s2tru  ;u1aexn fctyt s2ean o u4aeermf todomtrauvi;(0s2urim3iydal e fvia() 2rmx  ;u1tlxn iciaslm eau s u)aeenmf3iydfmtelieo;(0sruoxo3iu1alee ivia( sDumumoot4tleoioeiatlaDel(vs;u4 rermo ta1fpD lnesl(  2xrxopnodaptn icil( srtaumono0tle  f3ilt mDuanms u)tlenir oy1lm  aivi t)teur(opno1am e nct t a2umxmo;o4olx  fetas aDrln sn(0 etrifcoydoatrai o;s0t2uo(m3iudalenlnei sfsDrr(rp;o1tlxnmoetad a eanmsn() leomr3tytom  anvi s)seuoxo nu4op emivta(fsrumum nu1opto o3tat aDeanvpnu4aeenif3oodfmt aues;(0texo(o ny1opeemieilt  rur(root1optomoetytfm rm( o;u0 exnir3iy1op  an i t0srtmim iu1lptnlfesa(  2um(  nu1aex iociatlaDel(mo (0trtomr3iodfate nvo;( s2ur(r nodol  micta(fa2rm(rpoo4tpeniictytlm elnvo;u0teenxocio1lpte nvs;(0 exmxm nu4omee icsltfsruax  ;t1tpxomfetyslsDuaums u)teeoxr iytlpteauvil()teur(r nodaptemict (faDtaum ot4aetnmoctyslaDeau sn(4trtoio3oa1lp   ueslt srtrio oo4om  mnvsa(f ruru pnt0apx mictys mDumnvp;t)alenmo3oydopt anvil(0 eto(m iudopte fct ( sDuaumoot4tlxnmf3iydlsDrau ont0 exomociodlptrli o ( trumir oy1ll nlicslt s2tmxrp;t4optoioetlsls eln s;(0tleoxfciotlpt auvolt0 2umxm no4op  mies s) rtmu pot0tpenmoeiysla ul(vs;t0arxoxf oodom rln o t)t2xrimpiy4amtemietas aDuaxr oo4aptn o3tas m rlnmon() rtoxocoa1op rau o;( s2xoio3ou1omeelfvsl( s2tau pot0alt ioetlsfa ua(vp u) lerxfcoa1faD aies;t) exmxr nydll elnvsl() 2ta(rpoo0oeeoii3tytfm2umums (0 ltrif3ta1fpDrln s;t0trtmiopou4lle lnvsa()aDrm(  ;t0alt  ociys s2rmnmo t4artrioctadfmteau i s0sruoio3oodop nmieta(f Dta(ronu0oeeomieildfs ul(vp;t)tltoxr tytla rliei;s  2xmxm nudam nmneils  rtaxm nu4tex ii3iadla uauvs;(4teenifcoytlp r nvol(0srxmxopiydlm emics s a2um(mpot1olen fctlt a2rlnmo (0alxnxf oy1op  luvi;(0t2tmiopou4ll e icta(f ruaumpoo1oexo f3iyd m ul(vs;(4 rtnxr iydlmtranei t) 2tmio3oudopeelies s  rtr(rooo0oltnmf3ilslm eln snu0tetnifciatfmD aneol( s2toio oodlpe mnvils  rra(  ;u4altnmi3iaslsDua( o u)arermo3iadlaDr neil(0 exm(mpoydome  nct sf Dum(mpnu0aee  feiasla rln on(4tlxnmr ta1faD livi;t0seumxm io1llee fctltf 2ua(rpoo4altomoctat sDemu p (4 etnirctotop r ivi;t0 eumxo oy1llt liviat)sDuru  ou0olx if3iat m ra( o;t0 exnxo3oy1faDraiei t)t2xmxm iydaleeliesa(fsDtmumooo1oee mo3tydls2em(mpn(0 eeoxo tadop e ueo t) rxoiopoodlptnmici (fsrra(  nt1tpxnmf3tat m ulnmpnu) renifcia1fm rlnes s)t2umio3no1lltelfet s  Drax  ;o1apt moctad s2uanvp;()altrmo3to1omte ivol( texrxm iu1lmte fciat)a2rau pnu4opt iieiltfs eaums t4texoiociotoptraivs s)tetmimpoudal   ietl(fsDtaxm ;o0apeomi3iys s2eanmo;(4 rtomf tatfat aivils)t2xmxopnudlpt  nei tfsrumurp;u0texn octlt s2emu p u)trtnxo tydfaDr ieo (0srurim ny4omenmicsat s2ua(  ;o1ape  oeild s2emn p u4 ltnxf3iatopt anvsl(0trxmirpoodlmte ncias sDrru ooo1tpxomoeilt s rmump t0artnxo3tydoatelu i;() rxr(m io1apeelfvias)aDra(m ou0opxnmietlsfa2umnmpnt)aeerxr3ty1omDeluvi t0srtoimpoy1op emnei sf Drrx  ;t0texniociad m umums t0aeeomf3to1laDe nvi t srurxrpio4apt lfvsa()s2ta(rono1tee  oeils sDrm(mpnt)arxrxr tydomt anvi;t)srumim3iudamte net sfarrauronu0ole iiciytfaDranmonu4 rxoif iotfaDeanvi;t0 rxoir no1lpte ivsat s2umxrooo1tee  o3iadla eaums t4arermoctatfmDranes t t2xoirpio1altelnvtlsf Dtrurp;u4tlxoiiciatfm em( on(4trxoiocoytlaDrln ilt0 ruoim3oo4ap nmict s) 2ta(r ou0tpxn o3iyd aDrmnmo;u) rxomo tadfmtelnvo;( trur(m3io4lpeelfetlt srrmxmpou4aptoifctyt mDuanmsn(4teeomfciatfmt  u i s) 2toio3iudaptnlfvt sfa2rrxmp;o0apx mfciyd m rauvo;() etoxo tydfmteanvsl( seurxrpno1omt  ieia(f 2umxm ;o0oexoif3tas a2eluvs;u) etnxrcoatoptraueslt  rumxm iu4ap  mnctat)sDtrumo;u4aexo o3tlsfmDrm( s;t4 etoxo3todopt liei;t0 rtrxm nodom nlfci s)aDrmx  nu1oee  octyd mDumn p;u) lxnmf3oy1lpDrluei;t seurxr3iu1lp elfvt (fsDtmu p;u1apen octldlaDul(vs;t4 rerxf3oo1opDe ivs t) eto(mpiy1altn neilsfs2tmxm nt1olx  o3iydla2el( onu) eenir oytfpDrlnvi s)seurxm no1al nmfvtas  2rm( o;u0tleoifeiydla2rau s t) ltrio to1lpDrauvils  2urim io1al nlfci s)a2raur ot4tpeo fcilsfs ran p;t4aetoxrctodlm   nvilt texoxm no4lm  mncslt) 2tmxm nt1opeoiietldla2elnvp;t0trxnmr3oa1opt  i o;()t2xrio io4olenlietl()arrmumpnt4aeeoio3tltfs rmnms (4 rtoio3io1opDeli s t)t2to(m3io4ol n iciat) 2tmumpoo1altoifcilslm2elu p;u4tetrmrctytfa  an i t0s2uo(rpnydoltnlivtat)artr(r oo4ape mfetltfm2ul( p;u)aeenif3iotfm raies s0t2xmxmpiu4lltn fvils) Dur(mpno0tpx ioeiyt a2eanvpnt4 rtrmr todlm   u o ( sexrxopiudoptelnvtl( srtrxm ou1tpen fctadlsDrl(mp t)tlenmociadfaDe uvilt srtoxm iu4apee ivi sfa2umxmo;t4apx mo3iydfaDum( o;t4tetnif3totfmDe i olt0 etoxrpno4lp n ncta(  rurx  oo0apeoii3tltlm2ul(vo t) rtnxr ia1fptelneilt0srtrxm ny1ol  mivslt)s2rrurpou1oee  fciatlm2elnvs;t)trenio iy1lmtrau sls0s2xmxo oo4amtemnvia()a2urx p;o1tlxn ocils a2uaums (0 etnmfciytfp e i i;s seum(opnu4ll nlfet s) Dta(moou0opeoif3tadls eaumsnt)areoxocoa1opte i ols)seto(mpno1oltnlieiltf 2tmumont0ope  oeiat aDemu pnt0teenirciadomDe n sls0 rxr(o oy1apteliciat  Draxmo;u4tlxoifciadlaDua( pnu0artomr3oy1la  anvs t)setr(rpoudape  ietl(  ruaum oo1oltnmoetyt sDemnmo;()tleoir3tatla eliei;t  rurxr io1llen ncia( srrmu ont1apto fetlsla2el(vs;t)tetoif3tytopDr nvs;s)tetoirpoydomtn ies t  rrm(mpnu1alxoiietlslmDem(ms;(4alxomr3oa1oa elu ilt0trtmxrpiy4altemfcsas arumxr nt1tle moeildfa2rm(vo t4tltoxo oytopt ln s s  exmio3iydal  miesat)srtm(moot0opxnif3tatls eluvo (0 eerxr iytfpDrau s;t) exo(o3io1ll nmicsas a2taxroot4apenmoetydlm rmump u0 lenmfcia1lm  anvs;t)t2toirpno4oltelivtat)arrrx pno4altomiciat aDemums u)artomf ia1omDr i sl(0t2tm(o3nudam  mncia(f 2raxronu0openmoeiaslm eluvsnu0trxriocoydfp  luvs t  2xmxr3oo4omtn nesls  2rrumpot1oltomfeiytlm uluvsnu0 lenxo3iadlpD aivolt0seto(m oo1op nmicsa(  Dta(mpoo1apen iciad aDul( pnu)tltoxocoa1optraneil(0s2uoim3io4openlnetlt)aDrax ono4optoio3iyslm2rlnvo;(0teermfctodfm r u o;s)trxo(m oudalt  fcs (  Dtmxmp;o4opxn ieiyd aDrm( o;u0 exnmo tydomDeai s t0 etmxm3iy4olenlfviltfa2tmu  ;t0olxn oeild mDrl(vo t4altoxo ta1oa  lnvi;( srxm(m3nydom nmnci ( s2ua(r ot1aptn octld aDrmn ont4 eeoxo3to1lmt  n ils0s2xoirpoo4ol e neiatfarrrumpou4tptnif3iyslm2umnmonu4arxnxfciydomteaiei t)teurirpoodaltn ivia()s2trur ;o0oetn ieias sDrlu p t4altoif oatlaD  ueo s0t2tr(mpoy1amenmnvt s s2rr(mpot4ole  ictls sDran o;t4alxrxo oy1lpDrlivi;s)t2tmxrpiy4omenmnvils)sDrmur no0opxoiiciasfa2ul( s;u) lerxfciotlmteauvi;(  eurxm3nu4alt lnet sfsrrm(root4oltoifeiyt m2eau p u0 rerxr iotlptr ivslt teurxm3ny1am nlivsatfs2ur( p;u0tpenmocilt aDeaump;t4 lermfctotoptr u o ( tetrim3io1al n fcsa(fs2urxrono4oex miciydfm2em( s;t)arenifctadoa  ai o s0 2toxmpiu4oleelivil( sDtr(root4openmfeild a rlnvpnt4tlerxo3tytoaDrlues;t trumim3ou1lle licsl(faDtaxmp;u1altn i3tltfm em(mo u)tlxrmo3iydfa ran o;t  exmim3oy1lle mfvsa(fsDuaum oo4tleniietydls ra( pn() leomr ia1lmteai olt0 rxmirpoodlpeelnctl( a2rrxroou4apeomfeiydlmDulu snu0altomf tatlm elieslt)t2toir no1aleemfctl(fsDrruronu1ole mf3tatla uluvp;()tetoir ootlmD livi;t0seuo(mpiodoptn fvslsfa2urur ot1apeo ieiytlsDum(mp;u0 lermr3ootopDr u s;t) 2tm(o ny1lp nmfei (f Drau oot4tex mfetltfa elnvsnt4trxnirctydfm e n olt)s2umir iudamt lieiltfarra(m ot1apxnmicild s2el(vp u4 exnmfcio1lmtr u ols t2xmim oudlpeemnvt s)s2trur ot0oetniocias m eanvpnu4areoxf oadlm rli s s0 etm(rpoy4ap  miet tfaDrm(  ot1altomfciysls eluvp t4aexomfcoa1fatrlnvo;( texoio3oydllenmnctlt sDra( p;o4ale ii3iaslm umu snu0tetnmr tydfm   iei () 2xr(o oodlm  lics ()a2ua(mpoo4opt if3iyd aDeaumpnt)areoircio1fmDelues t s2trxo3io4ole lncsa() 2tru oou4aeenmfciltlaDeau ont)arxrmo iy1omDran i;t)t2tmir oo4omeelnesa(farumxmpnt0oeeoiictlt aDeluvp;u0aetrio3tydom  lu o t  rxrxo3ou4om   ncsls) 2um( pnu4tex iiciltlsDean p u4 eerio3oatlpD lieols) rtoxo iy4olenlivils)s2ur( p;o4apeomociltlm2rl(vo (4 exnxocootlate uesl(0teumiopiudaltemfesls srurx p;o1opt mociatfmDrmnvs t)aeerxoctadom  aueilt0 2tmxr3iy1ole lncias sruru p;o4tex ii3tlt m2ranvp;t)tlxrmf3iodfp ran o s0tetrxm3nu4lle licsl()srua(m ot4tee  ieiadfm2uluvo ()alermr oo1oaDr u s s)t2umxo nydomeemfvt ()arurxmono1ape  f3tlsla rmu o t0 leoxf tydfm e nei s)sexr(r3iydam  lnvi ( srrr(r nu0ale mociyt sDrl(vp t) rerxo io1op ran i;(0 rxoio iodaltemfetlsf Durumpnu4tetniiciatfm rmnvs;t4alermo3io1oa  aivsls0seto(r3oudamt lfcsa() Dumur ;u4aptn ictldla elump t0 rxoifciydlm elu slt0t2toxopny4alt  ivtlsfarrmxrp;o0oex  fciad s2rm(monu) eermo3iytlat lnvsls0trtmxrpnydlle  fetas)a2ra(rpnu4aetoifciyd m emu pnu0trtrir3iydlmD  uvs s t2xrxrpnydlpenlfci sfsrumumpnt0opt  oeiyt m2ea( snu0aetomrcoodop e u i;s  rumxmpiy4openmncilt)sDrmumo;u4olxo feias m2rmnvs (0alxoif3iadoa  liei;s trxoxo oo1lpee ivi t  2rmxrp;u4tetnif3iyt s2rauvo;u4teenxrcoydom  aueils  euoim oudlltnmivs s  Drrxrp;o0oexoiictat sDulumo;t4teeoio iotfmDe n s;(0s2xmirpoy4lmeemicia()a2uaurpou0tee ioetld a elump;u0trtnmf3tatlateauvi;s setmxm oo1llt  net (  Dtaxmpoo1tpe mo3ias s2umnvp;(4artnxf3oy1oatr ieo () 2trxopiy4omtemnvt () 2tr( p;t0tee ioeiat s2uan p;t4 rtoxo3oatfpteau i s)seumio ou4ap nlivias)srtau ooo4tetn oetytlmDuanmo t)aleoxo oadlmt aieo;(  ruoxmpou4op e nvsls)a2rr(mpou0oex  fciys a emn o;t) exrxo3iadfm rai ol(  euoio3no4ll n fctls srumu pou0alenmoeiasfs2el(mpn()trtrxf iodfaDrli o;s  2tmimpno1al elnvtlt artaxmooo4tpxomiciyt s2ea( snt0aeeoif3ty1fm  auvo;( t2xmxopno1optelfvi sf Drr(ronu4aptn f3iadls uan snt0artomr iadfm elivils s2trio3no1llt lnvtat sruax  nt0tle ioctldfa2rl(vpnu0trxnirciodlaDr uvo;t sexm(o ou4lme mnvtl() 2trx onu1ole mfciad s um(mp;t) etnxo iatopDelnvi;( srxmxmpnudapen fes s  rurxr no4olen o3iys m2ulump;(4tlermf3iytlmD  ivi;t  2trxm iy4aleelfciatfsDtaxm ;u4ope ifeiydfa2ran p;t4aeenxr iy1omt  ies;s)sexo(opiudomen ics ()sDtmxm ou4oexomieiadfs um( ont)aetnxo oydfptran o;t  eto(o3oy1op   nvs t aDumxrpnu0aet mf3tys s elnmpnt4arxnirctadfm rau ols truoxr nodol   ict s artru  oo4oeeomf3tytla umuvs;u0tlxriocoo1op   nvs;s0 euoxo3iy1lmtnlnci ()a2tm(roou0tlenifeiyd a2rmu p;t4aeeoxf iotomDr ivils s2xm(o3no1lpe lncsltf 2tau  nu1tleomociadfs2ulums;t0 lxnmrcoodom eliei;(0t2trimpoydom eliei sfarumump;t4opx mfeiatfaDel(msnt4aexnmf oadlpte i o;s)srxmxo iydlle  iei s sDtmxr oo1tptn oeiatlm2ul( s;()teerxocoatlatr u olt0 etm(m3iy4amtelfet s aDtrxm no4oleniiciyd mDrl(vp (4altomo3io1lptrlu i (  exmxm3iodap n ncslt a2uaumpnt1opxo o3iys s rl(vo;u)areoxfctytfpD aieo s)trxriopiu1altnlfci t) rur(m ;o0alx iocias mDrlnmp;u)teenmr3ootomt  i s;t)texoxmpio1lmee fctl( s2trxrono1texoiietytlm rmnmp;u4aeeoio3oadfatr uvo s srtrxo3io1lmtemfvt sfa2uaur ot1teto oetytfs em(msnt) rtomo3ootlaD aues () exm(m3ou1optnmict ()srtmum ;o1texoii3ildlm umnmp;(4 lxnifctytlpD aneo;( t2tmxm3no1ameemivsatfarrmxroou0tlto octad a2eanvo t)teerxo3oytlat  u ols  eurir ou4aleemicta()a2rrxm ot4apx mi3iyslm umnvo;t4tleoxf ta1fat auvs;()srto(r nu4olt lfct t sDrmuront1oex mi3iydla uau s;t) exomr iatoptraneil() 2tmxmpou1lp emici () 2um(mpou1ale mi3tldlsDul( snt) reomr3todlm   n sls) rtrxr3oy4al e fciat sruru  ;t1tptn o3tld s2umn p;() eenmo oytom rlu o ( t2umxr iu1om n icias arta(ro;o0apxomieiasla2rlnvsnt0tetrxr3iy1opDranvi ()trxrxo3ou1lmtemnetlt)a2rr(m oo0tpxoioctydlm uluvo t4artnifciodfaD  ueols0srto(rpny4lp nmivt sf rrm(mo;u0tpxomfetld mDrauvp;u) rxoifcoodfmDr nvol()trtrim io1omtemicia() 2tru  ;u4aexnmo3ias m2elnmon()tetrmfcoo1lateluvs () etmiopoo1lm nmfvi t s2ua(monu1tptnii3iltfmDemn pnu4trxoir ty1lmt  ues;s srto(r oo1lltnlivtat)srur(mpot4aex mietytfm el(monu) rtomrciadfatelneo (  etmir3no1ope  nesa(fartm(r ;t4aetomi3iat m ean ont)aexrmr3oydomDelieol()texrxo3io4alenlncs ()a2umurpot1aeeomfetydla2ranmsn() exnxfcoytlmtrauvo;t t2xmio3ou4olt mneiat aruru oot1tpeoiocias a rmuvp t0areniocootfaD  uvo;()srtrxr3nudlltelnei (f rrmx pnt1aexo o3iyslm2uln pn(0tltoir oodfpDrlueo t) 2trio3oy4omee fvi tf Dtaxr no0ape iictysfsDul(mp;t4tlxnxfcoa1laDelu s (0sexm(mpnodlle mnci (f 2trum oo0ope mf3iys a2ranvonu0 eeoxrcia1om eanei;t0tetoim3iy1omt  nvtl()aDtr(root1tpxomfetlsfs2ra(vs;u0 reomfcoodomtrlivsl( t2tmxm oy4alt lneilsfaDuaxroou4oex ifeildfm ranmpn() lermo oodfp e ivs;( s2tr(o3ny1am elivt s s2uau ooo0tleomoetytls rau p;u)trxnxr iotfa r i o;s  2uoiopno4lp emfei s)srua( ooo0tpxomociydfmDrm( o (4 lxnxf3iadlm r nes s0 etrxo3iy4aptnmfvi tf rrm(rono4tle miciadfsDumuvs;u) eenxo3iotfaD  uvslt0teto(opnudap elici t  Drmx  nt0aptoiictytlm ea(ms;t4tetrmf oytla  luvi;()setoxm3oy1ll n ictlt) rur(  oo0alx mfeiltlsDemnmsnu0 lxoir3tytlpDraneo;()srtrir no4lle mfct (fa2ta(mo;t4aet  oeilslsDrl(vp () ltrio3iytoaD  nesls0 eurio no1ape lfvtas aDrmum ;t0tptoii3iyd s um(vo (0arxnio3ty1oa r nvi;t0tetrxopny4lp  mics t)a2urur ot1openio3tyd aDum(mon(4alerxo3ootfptr ieslt0seur(r oydlmtemfeslt artru  ;t0tpeomocils a em( pnu4 reoiociy1fpD  nvslt)srurxr3no4am e fvsls  2rr(mono1oexo fcildlaDeanmp;t0arxoxrcoydoat li o s srtrirpno4amt mivsls)sDraumpou0oltnmo3iyslsDeluvsnt4aeeoxo oy1oa elu sl(0 etr(r3iu1ome miviat arurx pou1olen o3iydfs rmnvs;t4aleoifcootfmDeanei s0t2uo(m oodomtnlnes s)srtrx ont1tltomfcils a2uau p;u4 ltoxr3tatla eaneols texr(o3io1omen fet ()aDur(m ;o0oeeoif3iaslsDuln o;t0areoio3oodoaDr i i (0sexmxo3no4omt mfvtlt)a2ta(monu0oexnifctldlm rl(mpn() rtoxr iadlmDr uvi;s trxm(o3nu4al nlfvt (fsDrm(r ;t1tpxomociyd s ua( p (0aleriocio1lmDr nes (0t2tmxmpnudal elfesls  Dtrxrp;o0aptoioeildfm2emu onu4texrir3oo1lmt  i i (0t2to(r nu4lpt  fvils arraxr nu4oet mo3ias s umnmo;t)trxomocty1lmteaues;s  rxoxmpny1al e ivs ( a2trum ot0oex ii3ils m ua( pnu4 ltomo3iydlpDe uvo s trxo(o3oy4optemnetl(faDtrxr ;o1opt  iciysfs elnvp;(4tlxomr3tydlmD  ivo s0seto(o3ny1lp elfcsl() rrmu  no0tpxn o3iyslm ulu ont0 leoif3oytomD ai sl(  euoxr iy4om elieta() rta(  nt0openmo3ias a2umuvs;t)tetnmf tatlaDr iei;t) rurxrpoudlmee iviat sDtrxrpnu4texoif3iadls ul(vp;(4artrircto1lp rlu il(0t2ur(r3nydape lnei (  Drr(mo;u1tlx mfetysfa2ulnms;u)aeenxo totop  au ol()setoxr nu1om elicsa() Dtrumo;t0tex if3iasfa2emums;u0 rtnir3ty1fmD  neil(0 etr(r ou4olt lfvsa(fs2tau onu1oetnifetat aDemnvsnu0artrio3oy1omtr uvils seuoir io4alee icslt  Dtaxmpno4opeomoeiatfa ua( sn()trxnxo3oydlpD auvs t)trxrir3iu1ame lncta(f 2rax p;u0alxnmi3tadfa2uanvo () rtomocootlmD auvi s)srurim io4omt mfcs (fsDur(r oo0tlenmfciydls2rm( s u0teeoxo iy1oa  an o;s)srxoxrpno1omte fei s aDraxrp;t4texnmf3iasfa2ranvp t)tltnmf3oy1omDr n s;(0trumirpoudlp elfci s aDtaxroot1oetnifeiat a elnvpnt0aexomrciotoa  luvi (0srxmxopio1al   nvsls s2raxmpnt1tpe  iciytlmDua( s (0teerir oy1fmDr uvs;s0teum(r io1lmeemivsa(f Drr(mpot0oexoiictat m emnvo;t4 rtnmf ta1lp r uvi;s0 exmio3oo1lmen fcia(f 2tmum no4opeoioetadlm2ra(vpnt) rtnioctadlp raneils s2xrir3ou1lptemiesat) Durxmp;u1tle mfeild a2em(mp;u0tlenxocoytfatr neolt)teuoxopno1aptnmfetlt) 2raurpnt1opxomietldfm2emuvpn(0tetoif tatlaD aneol( teuoxo no4am e icsat a2tmx  ot0tptnmoctyd s2rmu o u)alerxfctytoatrauvi;s t2tm(m ny1omte nvil()aDum(m no1aeen ictlt s um(mo;t0alerxo ia1oaD li o;s teuo(m3iu1amtelnvtltfsDrrxmono1ole  fciydfs2eau o;t0teenmo tytlp r ivslt) rtmimpou4al n nctls s2uaump;t1apxniiciadlm2rmu pn()tetrxo oodomD  uvo;t0sruoiopoudalte nvt ()srtmx pou0ale  oetasla2ulu s;t4 lxrxfcio1lmDr ivslt) 2xoxr no4apt lnvilsf 2raxm ou1tlxnii3tldfs ul(ms;(4alxomo3ta1opDe ivol(0 etriopiydopeemfctas arra(rp;o4tlxo ociatfs2elnms t4 lxrxoctatopDelieolt0 rum(r3oy1ol elfes t aDraump;t4apxomfeiyt m rm(mp u4 exnmo totfmt aueo s0 2uoio3no1omen nct tf rua(  ;u4opxnifcilt s emums;u0 exrio3oytlmDran i s0t2xo(o iudll emies tfaDumx  oo1aet  fcilsfsDum(vpnt) eeoio oa1omt ai i t0 2urio3oo4al  mieias)a2rau ont4apxn fciydls um(mp;t) lxnmoctadopteluvo s) 2um(o iy1amee fet ( s2um(  no1olen oeiydfa2uauvs;(4aeerircoadop   nvs s0s2xr(rpno4lm n nciat sDtr(m ;u1oleoif3iytls2el(ms u0aexnifcoo1lptelnvs (0seumxm iy1altnlnct sfsrum(m ;u1opt io3ilt mDel(msn()altnmfciatomD  ies t trtr(mpnudll emfctlt)srtr(rooo4aptomo3iyd s uan onu4aleoirctodlpDe n i;t  exoxo3no4lp nmfeil( sDrr(r ot0oeenmf3tltfm2ranvsn(0texrmf3iy1fpt  ivils)trum(o iydom  lieia()s2rruro;o0tltnif3ild aDemuvs;u4arxrif iadoaDrln o ( teuoxopoy4ll e fci t)aDrm(m no0alxomo3ilt mDum( pn(0texoir3oadfaDranvsls) etrirpoy4om nmnvsat  ruauronu1olxo f3tlsls uau s t4aexrxr3tadoa elu i s) exoxm3ny1lpt mfci ( s2rau ooo4oleomietls s2rau p t)teeoif3iodfa  auvolt0trtoxo iy4llen nes t) Dtrur oo1alt  o3iltlsDul(vs;(0teerxfcoytlatran i;s s2um(o nudal n ivslsf rta(mp;u4tleo i3iydlm2umnvo u4teerxf3io1fatr nvol() eurxr iu1oleelnviltfs2tax  no1opto fciaslmDra( pn(0aleoxfcio1lp rln ilt tetoxr3iodop elnet ()a2rr(mo;t1alxomieiyt sDrau o t4 ltnifcoo1laDrlieo;( srto(m no4lpeelnesas sDurumo;t1apeo oeilslm2eluvs;()tlxrxocoodoaDraivolt teur(o iudape  net s)sDtrx  ;o4tpe iicildfmDuluvs;t)tlxrir3iytfp ran i;()seuoirpno4lpen nvils  2uauro;t4olto o3iaslmDemnvs u4teenirciadomD li ols) euoirpnudlle  fvt s sDtr(mpou0olx mfctys a2uanmp t) leomr3oydfm  anvslt0 rurio no1apenlfcsltf rum(mo;u1apxnmfciyd a2uln s t4teermo3ta1om rli s;t)texmirpnydapen iesa()sDrru p;o4tle mi3tltlm2ran p;t)tltoiociadlmDr u i;( s2ur(rpio4omenmivt s  Drrxm ot0opxnifctls a2ul( snu4tetoxr oy1lp  auvs (  exoirpoy1ale mieiat a2rr(r nu4tpxnmfeiysfsDra( sn(4tetnxr ta1faDrlies;( s2um(mpou4lmt mictlt artaxm ;t4aee  f3iytls2ea(msnt4artoifcia1faDelu s s0srtmiopoy4amenlnciasfaDrr(m nt4tpe mietatlmDulnvpnu0 rerir3todlmDe i il()texrir nu4apte ncs s s2tmuroou0aetomoeiaslm2emnmo;(0aexnxr3iotopD  u s;( srto(m3oo1amtelfvs t)a2truroou4texo fetltls2um(ms;(0 reniocoa1lmtelueo ()sruo(m iu1lmtnmfei tf rrr(mo;t1openifcild aDul( pn() lerxfciytlm e uvi;t  exoxo3oo1apeelfvs tfsDtr(  ou0opeoifciat a rmnvo;u4aexniocoy1oaDrlneo;t t2toim oodomtn fvslt)artrxrpnu0apeoioctatfa ean pnt4tetnio ta1fa eai o t) etrxm3oy1lmeemfcia( a2tm(r nt1tlxomocils a rlu p;u0aleomfcta1fa eau olt) 2toxrpno1ll nlnciat)sDur(rpnt4ape  feiyt sDemnms;(0altrmfcoo1lmDr ies;s)sruo(r oo4lltnlnctlsfarururont1aetomocildlm rlumo (4 renmr oa1lptrliei s0srurxo3oudaptelfes (f Dtmurpot4opx  oetydla ul( ont0tlxnmo iotlmt  uvi (0tetrirpnudop emnvs ( a2raum ot1aee mi3tytlm2um( o;u)texoxf iatlptr ivil(0s2xoio oydome mneia(fsruaur ou1teeoio3iasla ua(vont0tleomf tatlat ai o t0s2tr(o oudopeelicsa( s2ra(ronu1apx mi3iadfs rln p u4 rtoir3iytfmD  neo ()trto(m nodop nlfctlt)a2tau o;u0texnmociat a2eauvo;t4tltnmf3oa1lp  aieo;s)trtoxrpnudlpeemieil()sDtaurono4oeeo f3iysfsDumnvs u) etrxo ta1lmDr iei;()tetmir3nodam nmnctas a2tau ooo4aetn ieiatfaDulnvpnt)artnirciatfm eaieslt teuoir3oydome  nvi t)aruru ooo4opxn f3iatla2ranmsnu0areoiociydfmt auvo;( srxmxmpno1lpt mnciltfsDtr(mp;o0tltoiicildfm rauvo;t)arenxrcio1lpDrau s t0t2tr(o3oudale lnvta()arua(m no0apxnmo3iad a elnms t4 exrmo3totomDeaivs t0srxmim3oudlltn fes ()s2umxr ;o0olto ociasls em( o;t0artoir oadlaD lu slt0tetoxopoudap emneslt sDrrxr ;t1aexn ictadfmDrm(ms () eeomo3iodfpteluei;t)seumir3io1oleemneil( srumxronu1tetnmocild a2rmn o u4aeenmo3oatomtrli s s0 2toxm3nydolt mfcslt  Duru oou4texnifeiys m eln o;u0altoiocto1fpDranvs ( srxmxopny1lmtn ict s) 2tr(roou4aptnioeias m2eanmpn(4tetnif iotlp eaieo t  eur(mpny4altnlieiat)srrmxrpou0tpxniieiysfsDra(msn()alxoxf3iotoaDrlu s t srxmir nudlltelfes sfs2uaxm ot4texniietld a rmumo u4texnmocta1om e nesls) etoim3nudaptnmnetl()s2rmx pnu4opx iieiltfm rmn sn() reoxr3iytfpDrau o (0t2trim3oudlleelicslt)a2uax  ;o4tpeniictaslm uan p;()tlxrxr oatlmDelnvols  2uoio3nu4am elnvt ( a2ta( pot4texomf3tas aDum( on(4 exrir ootlaDeau o;s)teurio3oydoleelivtatfa2uaxrp;u1tpeoiieias sDuanmp;u4 etoioctodfpD livo t)teuriopoudllen nct tf rtaxr ;t1opxomf3iat m eau o (0alerio3iydla e neils  rxmxm no1ope mfei t) rtmu o;t4texnif3tas m2uaumsnt4 ltrifctodlmDran i (0srtrxrpno1lleelfvsat)sDrmumpou4tptnmoeiat s ea( sn(0treomrctotfp  aues;s  2trio nodlltnmicslt arum( pnu0tee io3tadlsDrlumonu)trtoio3totlm e neo ( seuo(rpio1omenmnciat)a2um(rpnu0apxo feiat a2ra( snu4artnxr ia1fp eaiei s t2xrir iu4am  mfvsl(fs2tau pot4openio3iasla umuvpnt0areomfctatlatranes ( s2toiopiydlmt lfeilt) 2um(mp;t1aetn i3tatfm uaumsnt0 etrmo3oy1fmtrauvo;()trumimpoy1amen iet (  2um(mooo4tltn ocilsls2rmumo;t) lermo iotomtraieo;( sruoio3oo1olee ictl() rraum oo1tptoii3iltfs rlnvo u)altnmr3todfpD lneo;(  2trxm ny1optnmnviatfs2tax pno4tlx mociadfmDuau p u0alxrirciatfptrli o;t) rtoio iy1ome mfcilsfa2tm(rp;t4oltnmf3iyt a2emnmsnt0alxnmr3oa1fm  livo;t) eto(r nu4altelicsasfsrum( p;o1apxniociad m rmumsnu)arxoxr todlm  ai ols seumio3ou4lpee ncsatf Dtrx ono0apxnmf3iatlaDua( p u)aleriociotlptr ivil()setm(o3ny1olt mfvtas  2ta(ro;t1tpx iieiyt s2rauvs;t4 eermf3iydoaD  i i;( srtrir3nodlp e nvias)aDta(m oo0ale  f3tydfs2uln pnt4altrifctydlatelu sls0 rxoxo3oodap  mfvslt)a2rr(  nt4texo ieiysfm2eluvo u4texrmfcia1la eluvi;(0 exr(mpny4a
\ No newline at end of file
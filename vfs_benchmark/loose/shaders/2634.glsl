@@ -0,0 +1 @@
+n i;s0s2umio3ou4omtnmnes s sDrrumpnt1tpt  o3iltfmDuanvp u)teeomocoatopteaiei;t  eumiopiy1ap e ivs (fa2rru pno4tlxomfctad mDrauvo;u0tltoxo oadlm raivsl( teur(mpoodlleemfvtlsfarra( o;u4opt ifetad s uauvs;(0 lerxf iy1latean o;s0sexm(rpno1ap nmnvtl(f rtm(r ;t1ope ii3tadfmDulnmsnt)altoxrcoa1lateauvils teuoxm oo4amenmics t  Drruro;o0tle iicilsfm2ea( s u)altrmf ia1fateluvs;s)s2umimpiu1lmeemfcsl()aruaxrooo0opto ociaslm2em(mpnu4 rxnmfctadfaDeaueol()tetoxopio1oltn ncsls) rrrx ooo1ale if3ias s umuvs;u)tleomrciy1oa eau i;s0t2xm(m oodom  mictlt  Dtaxm nt0tee iieiyt s2ra(vs;t4alxnmr totom raieilt srumxo iy4llenliei t a2trxmpnu4tlxn octls s rlums u0 rtnxfcoa1lpDrln o t)seumxr nodlptnmfeiatf rumx onu0apto fciyt mDelnmo;u4 leoxo3iytomDrauvi;( srto(mpoo4altemici (farum(mono0tpenmociatfmDranvs t0alxoxo tydomteaies s0teum(m3iodalt  fvs s)srumur nu0tpe ii3tyslmDeanvp;u4tetomo oa1fmteau s;t)texm(opio1am n fetat a2ua(rooo1aeenif3tltlmDemnmo u4tlermf3oatfpDelnvsl()setmim iy4apen ict ()srrax  ;u1apxo i3ilt s rmuvpnu0trtrmo3iytfp rluei (0 eum(r3iudll e nvs t) 2umxr ou1tlx ioeiltlaDrlnms;(0 lxnmr ta1oaDrluvs;t0srto(mpou1lm nlivia( srrmu  ;u1olxoiieiytfaDemump t0 eeomocoatlptrlu s;s trtm(rpio4oltnmnci s)aDrau onu0tetn oetytfm eauvpnu) rerxo oytla elneols0setrirpnu4ape lfciltfs2uaxr no0teto iciydlm2rl( sn(4trerio3todomDe neolt s2urir oodlle  fvil()arrau  ;o1ope mf3tydla2rmuvp t4tltnmrcoodlpDrai o;(0 rxrir3nydlptnmfciatf 2tmxmo;t4aetn o3iydlm2eauvpnu4tlxomfciy1fmt an s;(  eumxm nu4apt mfes t  Dtmxrono0tpt  fcias aDul(mpnt)aexnmo oy1lpte n o t)trtoir oydlme mnctl( aDrm( ont1oexnmietatlsDrauvs u0trenif iytlatran sls t2tmxr oo4alt lies (fa2um( pou0aex io3tydlm2rl( s t4aleoxo3tydfpD  ivs;s  2xo(m oo4alte fvi (f 2raump;t1oet mietlsfa eauvo u0aeeoxr oatop elneo s) rtoxopoo4omtelfcils)sDuax o;u0tpxoifcilt a ran pnt0 etrxo tatomtranvs;t srxmxmpio1amt mics () 2rm(mont4tlx mi3ias m2eanmpnt4 ltoxfcoodfa  luei;s)sexmio no1opeelivtlsf rumuroot0apeniictatfm ulu s t)tetriocoydfmDran i;t)sexr(m3no1al  liviasf rtmu ooo0aleoiiciytfaDum(mo;t4 rxnmfcoodopt an o ( s2xrxo ny1omenliet s) Drrumpoo4tpt iietltlaDumums;t0arenmr oytomt  n ils0 2trxmpiu1amt mnesat)aDum(  ot0tpe iociadlm2rmnmo;t4texoxo oadlptelneo;s0srxrxrpno1opeelicsas aDta( pnu1oltomi3tys sDul( pnt) eermfcoydlp eaies s t2urio nu4am n icilsf 2uaxr ot1texnmfetydlsDem(mon(0 lxnmf3oydlaDr neo;t)seumxrpnudop elivsltf Dra(mpoo0tetnmf3tadfm2um( o;u0alxrir3ty1omD lueo;()srum(o iy4ameemnvtat)s2urx onu4aetn oeiytlsDul(vsn(4alxnxocio1fmDeln s;s)seur(mpio4apenlfci t)sDrmump;u0optn o3tas a umn o;t4alermocto1opD luesl(0 etrxr nu4om  lfvsa( aDtaurpno1aexoii3iaslm2rl( p (4 lxrxo3oo1la  lnvs t seurir nu1om nmictls sDrrumono0tpe  f3iyt mDea(mon(4alxomoctadoptran i;()texmxrpoo1lmtelnvtlt)aDtrum ot0altnio3tltfsDean o u) rtrmocty1oa eli o s0tetrimpnu4alte iciasfsDurxrp;o1aetnmoeiyt m umuvpnt)trxnmoctotomDrlnvo t0t2xrxo ou1om  lnvi tfsrua(m nt4aet ioeiltfs ul(msnu) rtrxo3iatlm  lnvs;t0s2xrxopio1apee nvslt)artr(ro;u0opxoiociaslaDuauvpnu4 rxrxr3totlmt livsls  2umiopoydlltnlncta(f ruaxmp;u0aee if3tltlmDrl(mon(4arermr3iotfm elu o;() 2tm(r3io4lpenmnet tf ruaxr ;o1oleo ociydlm ua(mpnt)aetrxo tadoaDrlivo;s truoim oydopenlnct (fsDur(ronu4ole mo3iat m rlnmpnt0arxnmr oadom eluvs;t teto(rpoy4lmt mfetls  2rmuro;u0oet mieias sDua( o;t4artoxo3oo1opD  uvol()teuo(m nu1llee ict t) Draxro;t4apxo ictatla elnvp (4 lenifciatomtr u sls0teumim nu4ome mfvt ( srraumpnu1oltomf3ilt m2rl(mpn()texnxo3to1fp   nesl(0srtr(r3iydll emncs ( s2raurpou1ape  fciytlmDeanvs;(4aeeoir to1fp eauei ( s2uo(opio1ole  fesas)a2ua(r oo1opxo i3tasfmDemump u) lenxrcootfp r neils s2uoxr3oudolen ivta()sDua(rp;o1tlto feilslaDrmu p;u)areoxf iodlp rlnvslt0s2trim3iy1ape  fetlsfs2trx oou1oltnii3tydfmDrmu ont0 rtoxrcto1fpDrlu i;t0 eurirpno4alt mics (  rrm(r oo0apx moeiasla ra(vp;u)altnmf3tytfm  anesls trxmir iydom  lfct ( s2tm(r ;o0tpe iiciyd aDemums t4arxrir iytlp elieo;s)t2xmxr3oy4aleemfvia()artrxroot1oltnifeiad aDrl( snt)altomrctatfpteaueo;t)trur(m3iudameelivilt  2uru p;t4alxo o3tad mDel( onu)aetrioctytfptrluei s) 2trxrpiydlltnlivi ( arrmxrpnt4oetnifetlslaDul( s u4alxniocootlaD anvsl()setrxo3io1alee nvtasf rrrump;t1aptnmoctld a2uanvs (4tetrxfcio1om raivs s0 eumxm3oodomtnmnvsasfs2raxmp;u0tlx moeiltfmDrmnvo;(4alenio ty1fmt  ivi t) 2tmir3io1llee icsasfa2tm(monu1opxo ietaslaDrmnms () lenmo3iadfpDrauei;s0 etrimpnodlmt mnciatfsDtruroot0open ieiytlsDrauvsnu4 lxomf ia1lmD aies;t0trxm(r iy1altnmfcs (f rta( oot0aee mieiltfsDua(vs;t4arxoiociotop elnvolt t2umim oy1lpeelfctat  2rau  ot4olenmiciyd aDuln pn(0trtomo3iytlmDeauvil(  2trxm no1lp  mneilt) 2rmx oou4tlxnif3iat m eln pnu0tltnmr oydlp rau s;s  euoirpio1al elneiat)s2rmum ou4oex ifeiasfa eluvpn()alerif3oodopDe nvo t)tetm(r oo1lptelfct t aDumurp;u1oexnmoeildls2ran p t0aleomr3oa1fateluvol(  2tr(opno4ll nmieslt)sDuaxmpoo0alxniiciysfa2elums t) exrxrcoadlpD aies t  2xm(r3nu1am   nvt ( arra(root1tltnmo3iatfa2emu o;u4trenif3tadfp r i ilt) eto(rpiy4aptn neslsfaDtr(m ;o1aleomf3iydfa emump t)trxnxr3ia1lm  auei;()sexmxm oo4apen icta(faDraxmpno0tptomoctat aDel(vp u)alxoxo3tytoa e nes;t0trum(m oo1al e ncsa(fs2tmum nt0oet  i3tld a ulnvs;u4artoir3iytoaDelivi t0t2xrxo3nudlme mfcilt) Drax  ;u1tlx iociysfs2uluvp;t0 ltnmo tytoptelivi t0s2ur(mpou1lltemictat)aDtaur ou0tltoiictydlsDrln o;u)tltnxrcootfmtraieo;(0s2triopnu4oleemnvtat  Drrump;t0tpe iieiat s rlums;u0 rerxfctatlaDe i o s)texo(mpoodape mfcia(farrruronu4tpe ioetytlmDemump t) rxnxf tatoa  livilt)srtoimpio1oltnliesa(fa2umx pou1olto o3iltlmDelump;()teenmr ta1lmtrlivo;(0sexmimpiodlm e nvi ( s2taxronu1tltn iciytfs ulnvpnu0 ltnio tydfaD anes;(  exrio nudamte ies t sDrm( poo1teeoio3iasfa2em(vp;u4texoir totfa ran o (0 eur(mpiu4lpenmfeias aDrrump;o0oltn fctytfaDrluvs u4teerxr tatopDe u i;s)t2um(o ou4olt lfesls  2uru ono4tex mieils a2ua( pn(4alenxo3todfa  an s;(  2uo(m iy1ope lnctls arumu  ;t4tlx ifetys m um( pnu)trermfciy1op  au i;(0t2xoir3oodllen nvsa(fsDta(mo;t4tlt  fctlslm2rmu s ()artoxf tadoaDr u o ()srtrxo iy4alenlnesls) Dum( pnt0olx ioctlslm ulu o;()alxnxocoadopteauvo;t t2xmio3nydamtnlfei sf rta(mo;u0apx ii3tadlmDul(mo u0 ltrxo iodlat lnvils0t2xrxmpnodlpe lfesa()srra( ont4tlxnmociadls ranms t)altnir3oatfpDeaivil()setrimpou4olt licsl(fs2rm(m no1olxoii3tls aDea(ms;t)trxnmrcoadfmte uvslt0trxr(r3oy1ol  lnvsasf rtaurpnt1openif3iltlsDuluvp;t0 ltomr iatfmD au olt)setoxo3ny1omenlieta()srur( o;u1apeoiociasls uau o;u4 rxrmrcoydlm  ai o (0 rtoio3iydal  lict ( s2taxmo;t1altn octydfm2uanmonu0aeeomr oatfm eanes;s  rxr(opiy4lle  fci (  Drmumo;u1opxnifctlt a2umuvs;(4arxnxfciatfp r ivo s) exmir iy1apee ieils aDuaurooo4tet  oeiysfmDelumo;u4aetoxf3tadfm e n ils0s2umxm no4ale mfvt t) Dururo;t1tpxomieiyslsDel(vsnu4aleriocoa1fmt aiesls) rtrxo iy4lpee fctltfarrr(ro;o1oetnmi3iydfa rmuvsnu4tleoxf3tadoate uvo s t2toxrpnudam e netltfaDrm(rpou0alx mfciatla emuvonu0aetrmfctatop rai o;t0 2xoxo3ou4altemnctls a2rmx  ot4apt  ociadlsDean pn()areoxf tatfpt lieo t s2trxr nydameelnciasfartru p;u1opeoifcildfs elnvp;(0 ltnir3tytfa elneolt0 rxoim nu1ale miet t)aDurxroou4tleomoetlsfs2raums (0 eermociy1oaDr u o;s  etmio3oy4olen icia(f Drru  oo0tpe iieias sDrlnmont0 leriocoydlaDrluvs ()trto(m3iodolte fcias  2ur(  ot0tptnmfcilsfm2eaump t4aetrmocta1la  ai i t)t2toxm iydameelictatf Drru p;t0alx  fciydfa rl(msnu0aeenmf iotfm  lnvi;s setmxmpnu4lp elfcsl(f rtrx p;u4tle  ociadfa ul(msn(4tltoif3tadlat lnvil()seur(m3nudolenmfesasfsrumurpot1ope  f3iydlm em( p;u) exrifctytfmDeluvsls srumxmpou1amee ncs t)arumxmpnu4texoiociltfa uan s u0 ltnxrctatfp   uvi;t trurxm io4ll   ncils  2raxronu4oleo fciytfsDulnvsnu)tltomr3iadfm rau olt0 ruo(m oy1lle liesas)srrrxmo;o4oleoifeiad m2ua(mo (0tleoif3iadfm  lu o;t  exo(opoydllen icias)artrxmono4aeen f3ildfm2el( snt0texrifcty1fp eli sl( t2xo(r iu1am  lncslsfarrrumpou4opt  fctlt mDrl( pnu)aetomrctodlmt  u ol() rxr(m3oodopeemfct s)a2rm(mpnu0tex  ieiytlm eluvs u0 rxnif oodfpDrauesls  rur(opou1lptnlieias sDrrx  ;t4aeeoif3tlsfa ran s;u4tetnmo oatoaD ln o;t t2xrimpnydllt  ivtl(  2urx p;u0aex mfciasls2el( onu4alenxf3to1lpDrauvo s) rxrir3ou4lpe mnviat)a2ur(monu4opeo f3ias m2ulu ont0teeoifcia1lp e i ols s2urirpoo4am  mfctat) rtmurpot0ope mfeiysla el( o t)alenxf iodoa  au i;s0t2um(rpny1lpe  nes ( s2umu  ot0tptnmociasfs rln pn()alxoio3oodlaD anvil()srurim iy1openmici t)arur(root0oleo iciltls2rmnmo t)alxrio3iatlpt  nes;()t2tr(opny1ol   ictlt)sDra( ono0aexnii3tyt s ua(vsnu) rtnmocio1omDraiesls  2xo(rpny1apte fviat  Dum(r ;u0tetn fctas a rm(ms t4tetomr ty1la r n o;()t2trxo io1al nmneias s2tm(r ;t0apxn ieiltfm ulnvp (4aexnif3ty1fmtr ivi s)t2xrim ny1ole  icilt s2ta(monu0opxo o3tatfa elumo;u0trxomfcty1fmte n ilt0seurir nu4lle  ici t)srraxm ot1alxo i3tlsfs eln sn(0aeermo3tadfp eaivs t  eum(o oodomt mfctl() Dumumoou4tle moeiysfm2rm(vp (0trxnxociydopD ai ils)srurxr3no4lm nlfeil(f Duau o;u4teeo feiyt aDrln o;(4 reoio ootfmte nvols s2toxmpoo1lle mfvsa( aDtrx o;o1optomicildlm rm(vp ()arxoxr3ty1opt aiei;s  eumxmpiudlpt  nvt ()arrm(mo;o0tlto f3tlsfa um( s ()tltomfcoodlp  ln ilt) rtmxmpou4ll nliciat arrmxroot0tet  f3iaslmDem(vs u) leoirctotfaD  u il(0t2um(rpiu4aleemies t  2tau poo1tex  i3tasla em(vp (4 reomrciy1fpD lu i;s)srumxm3io4ol n neta( arum( oot0tpenmfciys s2rmnvp u4tlxoxrciodlat an o s0t2xoiopiydaltn fcs s sDraur ;o4aeeomf3iysla2ra(mp u4trermrctodfa eli o s) 2xmxrpio4op  liet s)artmx p;t4oeeoii3iatlm em( s;u0 lxnif3ta1fa   nes;(  exmxm3nu1op elivsatf rra(  ;t0aeeo fciatla2uau pn(0 rtnmo oodoptr uvo s)teuoir3iydlmtelfei s aruaum ;t4alt mi3ilsla2rmu s t4arxomf oy1om   iei;() rtmim3iu4altelfetlt) 2uaxrooo4alxnmocild m2rlums;u0trtrmf oatfmD  i ils0t2xmxrpiu1ll   feias  2uaum ;o1tlt  ieiad s2rmnmp;() ltrio3iytlm raues;t)setrxm3ou4om emnet (  2umxmo;t0tpe mi3iytfa2rl(vo;u)aetoxo3ta1lm elivo;( seuoxr3ny1ome lfcilsf Dtrxr no0aeeomfeildlm uaumo;()alxrif oatop   neo (0tetrim3ou4lme livtas sDuaxm ;o1tpe ioctydfs2em( p;u4 rxomf oa1la  lues;s0 2ur(r iydop  lfeslsfsDuru ont0aexn fcildlm2ea( pnu4 rtoiocty1late ieslt trtm(rpiudapt  fci (faDur(rpot4tetn oeiyd a2raumpnt0 renmfctotlp eaivs t  2xoxo3iudapt miet t)srrrx  ;o0oetnmociatlm2ul(mp () renmr3io1fateaivol(0 etrirpoy4aptn nci tfaDum(m oo1alxnmi3ilsfmDuaumon(0trtrxf iy1fat aieo;s0seumirpny4al   fcta()srur(rp;u1oee mfeiasfmDuluvp ()aeerircty1latraivsl()teto(o ny1oltnmivtatf Draur ;o4apt  ieiasls2rluvs u4altnio io1fat lu il() 2trxm no1lm emnvsatfs2tmxmooo1tptomoeilt sDrl(ms t0alxnir3iodfa r ivols)tetrxm3iy4lltnlfeil(  Dtrx  nt1oet moeildlm2ea( o;()alxrxr3iydom rauvsl(0srumimpiudalee nctatfs2ua(mo;t0tpenifciyt a rmuvo (0trtnxr3io1laDe ueolt)texmxo iu1lp n nctlsf Dumuront4aet iociadla2rmuvpnt)arerxfcootomtrai ilt  rto(o3ou4amtemnei t)a2rm(m oo0alt  i3iytfsDemu pnu0 etnmo3iy1oa  aueslt0t2tr(r ou1omtnmncta( a2tru  no0aexn ieiltfa2umn o t4 ltomr3tatlaDrai sl( s2uoxm iy4op  licslt  Dtmurp;t0aet  iciys aDulump;t) etnmf to1faDe ueslt0trtoxo3no4altnlnct () 2umu pno0tpeoiocild s2ea(vonu0 leoif3iodoa eau il( t2xrirpoudom nmietat sDrr(ro;t0tpeniictad m2eau on(4arerxfcty1oat aivs s0 rxrim no4om e neil()s2urumooo0alxomi3taslmDuanmonu4aexomr iadla  li i;s  2uoir oodamtnmfvsat s2trx ont0aeeomociyd a um(vo;()teerirciadoaDe n o;(0setrxopiy4ll nlnciat) rum( p;u0oet miciaslsDem(vsn(4arxrxf3ia1lptelieslt t2xm(r iy4olee net t)arrmxmp;u0aexomi3iyt mDul(ms;t)teerxo oa1lm  lnes t s2xo(o io4ope lfvi s)s2tax o;o0tpt moeiat m2umumsn()artrif totla elies;t)teurio iy4amtemncia( s2ur( o;t4tptn fciytfa ea( pn(4trtrxf3todlmteaueslt0truoimpnu1ap nmnetas sDtmu pot0open feils a uanvo u0texrxfctytopD  uei t)trxoio3no4lmee ietasfa2rrx ooo4altnmfctlt mDrmu pn()aexnio3oa1la eluvols) rum(m no4om elnvtat srtmxm ;u4aptoioetltfa ua(ms;(0 ltomr3iodlmtelivo;() rumxr3nudopt  nvilt  rum(  no1alx  i3tls m2um(ms ()aexnmfcoytoaDr nvs;s0 rum(o3iydale  iet tfsrtr(m ot1alenmietldfm2ranmsnu0 rerxr3io1laD lueils0srxrxm3oo1lleelnetatfsDrmum no1tpxo f3iysfa ulnvo;t) rxrxo3tydopDe neolt0trxrim3oo1amte nvta() rrmurp;u4oeeoioeiytfm2em( s;u)aexoifcoadfm rlneol()trxmxr nudaltnmfesas) 2ra(mpnt1aexoiictldlm2rm(vsn()teenxf3tadfaD au il( trur(r io4lleelies sfs2tm(mont1tpx  f3tad a2rau onu0arxoxocto1lmtrln s;(  2xo(r oudlmtelnet tfsDtmxr ou1oetomfeiytlsDra(mp;u0 lxrmfctotlptr iei s0srxo(m oodop e fvilt srrm(mo;o1olen feiytfm elnmpnu0 lxoxr oatoateli i (  rxm(rpnodlptnlneilt sDuaxro;o0aee  icilt a2el(vsnu0aexnxo iydom rai ol( srumir3nodale mfeia( srumx p;o1aexn iciydfmDra(ms u0arenif io1fpDe nvs t0 2tmir ou4ll n ictas  2tr(rp;t4tleo i3tlsfsDrmnvp;t0aeeniocootfpDrlueils)teuo(o nu1llee ietas) rtmx  ;u4olt ifetltlmDuanvp;(4 leoxf oo1fp  liei;()setoirpnu1opt lieias) 2rm(m nu1oeen f3iadfs rauvp (0 rtrxr3oytopDe uei ()tetmxmpoy4lmtnlfvtas  Drru o;t1tle  o3iadlm ra(vs;t) eeoif3iytfptrai o;t  2urirpiy4lpe lncsat)arra(monu4oexo fcildfm rmuvon(0 exnmociy1lat  ivi;s  exoio oudlmen ncta(  2um(mont0aeen ieild a2em( p t4 eenxr3tatlp e nesls)sexm(r oy4amte nctas)aDurxmoou4oee mi3ils m2rmu p;t0aetrir iodlmt lieo () euoimpoo4al nmncil()s2rru  ;o1aeeomietyslsDelumo;u4aleomo3tytom   u ilt truoim oo1al e fvs ()aDuau  nu1aptn fctlsfa rmu p t) lxrxocto1oaDeaivi;s)s2xrir3no1ol n iet ()artm(rpnu0ape iietadla rmuvsnt0tlenif3to1faDr nei s  rtoir3iu4omt lnet s)arrr( ooo1apxniietasfs emnvsnu0tlerifcoadoaD aueo s  rxrir nudop eliesl() rrrumoot4aetnmfciltla2ea( s;(4 eeoxfcoydom eli ils0s2urxm ny4am elnci ( srraxmpno4aexn ieiydfmDemnvp t0trerxo3tatlp  au i;(  rxriopiudamt mnesl()srrrxmo;t0oleoifciadls rlumo t4 lxomf iodlpDr n sls0srtoxm3io1ome  feia()s2tr(mpoo0alx ioeiysla rmnvo (0alxrxf3oa1op eanvs;()trxoxr3ny1altemfviat  2taxm ou0apt mictat a eau p;t)texrmrctytfptelu s;t trxmimpnu1lmenmnctls srur(rpot1aeeniieiadfs2emnmsn(0 rtnio3oodlaDr ueolt t2xrxr3iydlpt mfvils) 2uax  no4tlxoiociadfm rmn p (4 renxfctytfp  aneols0 2toim3io1amenlnciasfa2um(mpot0aleomo3iytls rlnvsn() leomoctodfmDe u i (  rxrimpnodalt  nciat arum( pnt0olxoiieiys s2em(vsn(4trenxo to1opDeau o;() rxo(o3oo4am  mfes t) Duaxm nt0opxn i3ilslm2elnvs t0artnxr iy1fm e n i;t  rxrir3oydoptelfvsl(farurxmpnt4opx mf3iasfmDea(vs;t)aexrif oytfpt au i ( s2xrio nu4lp n nesl(  Drrum ot1apx  oeild mDuauvpnu)tetnmo to1fmteau i s trurio iu1ap emfeiltfarum(r nt0tpeoii3iat sDrmu sn()tlxrircoy1lmD luvs (  2xoxo ou1lmt liesl()aDtrx ono4oexo fetltlmDeluvpnu4 lenio3oodoat livo;t0 rxrxm3oudol e nvsl()artmxr ;t0alt ifeilt mDemnvsnu)arermocoo1fm r u ols)tetoxr nudame  ivils a2ua(  oo1aexo fctat aDrlnmo t)texoxo3iadlm e u o;s)s2trir3nu1lpenmicia(fa2tr(rpot0ale  fctldlaDul( p () lerxr3ta1faD an o;s truo(m iy4llt  neiat)a2rru p;o1alxnmfeiaslsDemnmsnt4arxrmr io1lpt li olt0srxrirpiy4amee ieias)aDtmu pnt4tpt ifctas mDean o u)artrxoctotlm ranes;t sexmim ou4om  mfvilt sDurx  oo4tptoiociytfa rm(vp;u0aetrmr3iydlaDe iei t0 eumim3nydoptnmnciasfsrtaur no4tetnioctatfa rlnvont)arenmo3iytfpDrlies;t0seto(mpoodom  lnetat)sruru  nu4tpx mociasfsDeln sn()aetnmrcoydfatean i;s  2ur(o3oy1ame mnvs s  2uax  ot1alx ifeildlaDra(vpnt0teeoio3to1omD lnes;(  rtmimpiy4ll nmivi t)srtmxrono4tptoiictldlaDrlnmo;(4 eerifcoa1lpt liei t)teuoxrpnu1om nlncs ()s2rr(r oo1aee ifetls aDelu o t4 rxomo3iodfmDranei;t)s2umxmpnodaltn ics t)srraxm ot4texomieiltfaDumn o () lxnioctadlmte iei ()srumim oudlpenmfvsatfa2uax o;u0tlxn octltls2eluvs;(4tleoxf ta1lpDr nvi;(0srtm(m3no1am n feils)srumx p;u4oleomiciyslsDranmpn(0 rxnmociydom ranvo;t trurxm io1al n fvs (  rra(ronu4oetnio3iydla uau p;() lenmo3ta1opD liei t)trxmirpnu4am n ivtlt aDtrxmo;t0aexomieiasfaDrln onu4 lerxf oydoa  ai il(0t2xoxr iu4omeeliciltfsDum( pnt4aet mictysls2umuvs t4arxoioctytfmDr ivsl(0 2xoxo3io1om e fvsl(f 2rmuro;t4aleo f3ild a rln onu0texrxf oodfat li o;(0texr(o iu4omte nvsl(f 2tm(  ot4olxoioeild aDrlnvp u)arenif iotop e ueols0 rxm(o3iy4am elivsas sDtrurp;t0apxnif3iltls2umnvpnt)teenmo oa1fateln o s)trtoxo3nodomt  neil(fsDurxmpnt0tpx ioeiad a ua( s;t) etrxrctodlp rlivol( srtm(r3nydopenlicsls aDrrxmoot0optnmieiasfm um(msn(0aetnmo iydlaDeaies t setmiopnu1llenlfeia(farraurpnu0oexoiociasls um(ms;t4texrifcoa1lm rliei s)s2xm(opiodole  nvtas)sDrmxmo;o0aexn ictat mDrmnvp t0texnmo totop rln o;s seumxopiodale lnvsls arumump;o0oeeoiiciadfsDulnmp;u0texnif oadlmtrau i;t0 eumim3iudlltemnct t) 2ur(  nu4apx miciatlmDulnvonu)arxoxf3ootlateln o;t0s2trimpou1lmtn fesat) 2tmu ooo1apxn f3iyd aDul(mo;t) lenxo3oa1laDrlnvsl(0texmxo3io1altelnetlt)a2tr(  ;t4tex  oetls s2emnvs t)alxomr3iotlpt aivi;t s2urxm3oodal e ict sf rra(rooo4opxnmfeildlm eauvp u)artrxfcootoptr ies;s t2xm(rpno4lpte ncilsf rraumonu0apxoiictyd mDemnmp;t4aexnmocoytlm ean sl(0srxrxmpoo4lmeemnci tf rtaur ou1aeen i3ias s2emnvp t)trxnxoctytoa eauei ( t2uoxo nydlle  fesa(fsDumur ;o1tlxnio3tas mDum( o;(4teeomr3totlm rlnvi;t s2tm(opiu1am nmivsas a2tr(mo;o1oexniicild m2rln p;(0alxrxf3iotfmDelnes s t2xm(rpiu1aptnlneil(  Draumont0olenif3tas m2ra(mont0aeerif3iatlm  aueslt) rum(rpiu1al elfvsa(faDumu pnu1aptnifcias s2uauvp t0 eenmf oodfp rlu slt)srtrim iu1lptemfcs (fsDrmxmpoo1altnmocias m2umnms;()artrxf tadla elieols tetrir nudomtelictas)aDtax p;o4oeeomieilt s2elumo u4trenio tydfm  aueilt0s2tm(o oydomt  fctlt) 2uaxmo;t0tlxnmoctyt s ranvs;(4alxrif3to1oate ieo;s)seur(o oo1lle  icsat)srtmxm nu1apx  feiyd sDeluvp t0 exnxo3oy1la  aieols srtr(opiu4aptelfeslt) Dtmumoou1olen oeildfm2el( p;(4 lxrxo todfatrai o;t srtm(o ny4lm  lneslsfs2ra(rpoo0oet io3ils s2el( p;t)aexoioctadlpt lu s;t) 2tmir3iy1lm  lfci s) rrr(mpoo4opxomfetyt s emnmp u4 rermocoydfa eauvi t0t2to(mpoydlpen fetasfartau  nt1oeenmfeiys m ua(vo ()artoifcoydlm eau s;(  exm(m3ou4am e fci t sDtrxmpot4oetn ietadlm rluvp t4 rerxr to1oa elu s ()t2trxopoy4lleemivilsfa2raum ;u0tlto i3iatlm ulnvpnt4teenmociotoaDe iesl( trtrir iu1ol   fctls s2tru  ot4tle  fetyt a ranms t0 lenir3oadlmDraivsls  2xrxr3ou1omeelivil(  2ururpot0opxoifeiydfm2rm( o u4tltrxo oadfmD li o;( t2uo(r no1om e fesls)srurx ono1aptn fetls sDrm(ms;t4aexnif3ootlp eanvi s srto(m3nu4ap nlfvia()sDrr(  ou4oexnmieias a eanvo;t) renif3oa1fatrau sl()t2ur(o3nydapenlncsa(f rrr(r no4ole mo3tls mDelnvsnt)tlxrxo todlm  aiei;t trxmxr3ou1omtnlnvta(f 2tmur nt1aexoiictldlaDrl( snu0 exnmo3oatoptrai il( srxrir oy4aleemnvsa(farumx pnu1oeeoiietytls2ul( p;t)trtrxfctodoatraneol(0trtm(o3no1am e fcsa()sDtau ooo4aeen fctydlm em(vp ()tlxoxf iatop e ieo ( t2trxopoo1ll   ivs s  ruaxront4aetnmfcildlaDum(vs t0 rxoxr3iotlmDrlu s t  2umiopio4alt lfvi tf 2tru o;u1apen oetldfaDumnvo ()alxrio iytlpt auei;s) etm(mpno4lmtnmietlt)srur( oou1aptn ieiasls ulnmo;()altoif3oa1opD  ivil() 2uo(m oy4ope mfvslsfs2rmurooo1tee ifeildlsDem( o () etomo3totfptrai i;t)setmxr3iy1om emfcia(fsDraxmpoo1apxoiociaslm2rmuvs t)aeeoxr ia1lp elivo (0t2trio3oy4om nlies t)arumxrpnt0altnifeiadls2rm( o;u4altrmr3iotfaDr ivs ( trxrio nydlmt mictl(fsDur(mont0texn fciyd m umuvs t4 rtrio3todfm r ivi;s)trxoxo iudlpenmnes (f 2rr(mpno4tptnmociyd m eau snu0arxnmr tadop eanes;s0s2xoirpoodamen nvsa()aDraxrpoo1tleo ieiad m2emumo u4trtnmr todop  an i;( trxo(r3no1lp e fciat)s2ua(mo;t0tetniiciat a emn p;(0 rxriocoatlatr nvs s0 ruoir3oy1ale mivil() Durxmp;o0texomf3iat mDranvs;(4 lxrxo3to1omD luei;t sexo(m3io1ol  lfvsl()aruax  no1ape if3iytla2eau o (0teermf iydlpt aneils sexo(o3no1lmtnlnesl(  2tmxm nt4tpto ieilslsDua( s u4artrifciy1lmt  ueo;(0srumxr3oy1ap nliesltf Dtmur nt0aetniictyt a eanms;u)artnif tydlmteauvi (0t2xoxr iudllenmfes s  2raxmpnt1oeto ocildfa rmu s u4 ltnir3tytla e nvi ( t2umxmpnudll elfvtlt aDraxmp;o0aeeo o3ilt s2ulu p;u0trxnxrcoatfpD anes;(0 2uoxm3io4op nlneiat sDur( ont4olenmoeilt s2umuvpnu0trenxf3tatlmt  u ols0srtrir3nydal nmfct (f rurumpou4oltnifctys s uluvo u4 rerxo oa1fmtr uvi s)trtoio ou4lle  feils)a2taurooo1openif3tadls2rlnvp;(0tetrxo iytomDrai s;()srxmirpny4lptnmivils) Dur( o;t4texomicildfm ua(vs;(4texnxrcoy1lm rau s s)srtr(r3iu1olt mnciatfsDrmxr no1tex if3iaslm2um(mp () exoxo3oytfm   ueo;s sexoio3oy1altelfvil(fa2tmu  nt1opeoiiciydfm2uanmp;u0alerio oadomtean ols texrim3oodop   nvsat srtax  ou1tptnii3iyslaDrln s;u4arermo tadomt ai s;t  eurirpiodal e nes ()sDtr(  nu4opx mo3iltfsDean o u0 ltrxfcoa1lmDrlivi;() 2tr(m3no4om nlieia( srta(mp;o1tptn i3tyd a2ean p;u0trerir3oadfaDr n o;s s2to(opio4optn iesls a2ta(mont4oltn i3tat m2elump u) lxrmr ty1lp  livo;t)sruoio no1lle lneilt) Dtau  no0olto ieiasfmDuanvo;t0alenir3iadfat li s;( texrxopiydlpenlncta(  Drmuroot0alt miciltls2rmuvp (0aeenmr3tydoa  ai o;s tetoio iudlpen nvs (faDtr(  ou1aeen o3ilslm2ul( o;u0artnircoodfpDeaneilt)s2umiopoodaptnlnvslt)srtm(mp;t0alxo fetasfm2elumo t)aetoir io1omtrluvolt s2uoio nu4openlfctatf Dta(m oo4ape  feiydfaDuluvo (4tetomr io1fatelnvi;t)trxmim3oydaltelietasfs2ur( ooo4tle  ieiaslm2emums;t4aeermr3oatfmDe nes;(0 2xrxopiydamtemieslt  2rru  nt0alenmictas s2ulnmpn(0 lerxf3todlp  auvi;( srur(opnudlltnlnvt s arua(rp;t4tex  fciytfa2rlu p ()alerxo oy1fatelnei;( tetmxm iu4lp   nvtl(f ruax pno1ale iiciltls2umu o;t) rxrio3tydlmtr n i ( t2triopno4omt  neias) 2tmurooo4tlxomo3iyd a ulnvont)aetnmf iatopt aieolt tetmxo3ou1omeelneiasf 2uaur oo4tltn feiatfa uauvs;() lxnxrcoa1oateli ol()s2umimpoo4lm e ics t srrmumpoo4tlt mo3tasfm2uluvont0tlerircoytlaD lueil(0 rxmio iu1lle mnesl(fsDurum nu0tlt  feiaslm2rm( on(4arxoxocio1omt aivils  rumxmpoy1openlfvia( arraxmpno4apt iictatls rmnmo ()trenmr iy1lpDeluvi;()trxoio3iydamtnmfetatf 2ta(mpnu0aexoiieiltfaDranmsnt0texnifcoo1optrlueo t t2to(mpnudlpt mnesa(faDurxr ;t1teenif3ilslm em(ms;(0alxoxo3oodfptrauesls0srto(opiydlm  lncia(fartr(roou4tpt mfctldfm2rm(msn(4tetnmocoytfat  n o t  etr(m nu4amtn nei s)aDrmu pno1ape iieildfa2emnmp;u)texnmo oo1lpDeaivolt)t2xmim3ou4oltelnvsasfarumurp;u4opxo o3iatla2umuvs;()tetomo iatfmDeaieo;t0 etm(mpiydomtnlivt t)s2tr(mp;u4tlxomfeiatfa elumpnt) lxrirciatfa r u s;t0s2xrio iydll elfeia(fsrtaxmooo4oexniiciys a raumpnu) lenir tadoptrlivi s0sexmir3oy1lptelnvsls sDrau ont0texniieiyslm2rm( snu4alxoxocoy1lmt  ueil( sexm(m ou4alt lieias) 2urur ;t4olx ifciytlm2ea(vs;(4aexnxf3tatlmtean s;t0 rum(mpoydam   ies (f rtrumo;o1aptomietlsfs2em(ms t4 rxoxr3oy1opDrlnvils  2tr(opno1llt lfesls)s2ua(rpoo0oet  o3iydla2rauvp u0areoircta1fpDe ieo;s  2xm(rpnu4apt miciasf 2ua( pnu4apenmf3ild m2um(ms;t0alenir3totfp rauvs s)s2tm(o io1op   iciat  rrr(ronu0oet  oeiat s rm( p;t4tlxomocoy1lmt luvi;s srxm(m3iodap e ivs (farra(rp;o1tlenioeildls2uanmp;(4 rtrxo3iadfaD livi t0truoxo3nudap   nesasfsrtm(r oo0opxnmo3iys s rau pnu)tltnxo oo1omDeauei t)t2xoir3ny4llt mncslsf Durxro;u1teeo f3ildlm em( sn()arxrmr iy1laDeaieslt) eumxr3oudaptnmncslt)arua(r ot4olxo i3iydlm2uaumpn(4tlxoxf3ta1lpDeai ils  2xm(o ny1aptn ivsl( a2um(mpnt0tetomoetld a emumpnt)treomr3oo1opD luvs;t s2tmir ny1am elivil(fa2umump;t0tpxo ietltla em(mo;(4alxomrcio1lmDeln s;t)t2uoimpiu4omt  fciasf rtrx  ot1tpt  ietat s ua(mon()treomf ty1lmt lieo () rxm(opoudaptnlnciat srra(r ;o4tetomociys mDrl( on(4 exrirctadlaDe u ol(0t2tr(mpnudopen ncta(  Drm( pnt4aptoif3tyd sDuau pn(0treoxr ta1opD auvsls)seurxm oodam  livsls  rrrumo;o1ape moctyslm eaums u)aleoir oytfate iei ( t2uoio3nu1lmeemneil() Dtr(rpoo4alto i3tat mDum(mpnt0artrxr todlpDe nvo;s trumxrpoo1apenliviat aDtaxrp;o1oee io3tldfs raumsnt)trtomocio1fp r uvi s0s2tm(o nudlmt lncslt sDrr(m ot1tptnifetls a2ua( s;t)tlenirciotfm   nvilt)s2xrim3oydalt  ivt s srrax pou0alt if3ilsfaDeln s u4texnif3tadlptranei s seuo(m iy4alt  ncilsf rrm(mpoo1tpxn fetatfm rl(vo (0tltrxfctytomD lnvo;s tetrxr iudole  ieslsf 2uauroou0opx mietaslaDua( p (4trxoif3oa1lp e u i t)s2umxm nydame lfvtlsfsrurum nu1opx moeils m ua(vp ()tltrio3iadfmDeaneo;t teum(r3nodoltnmfeilsfartau  nu4oet mf3tysla2ulnmp (4arxoxociadfmDe i o;t s2xoxo iydamee ictatfsrrmu p;u1apt mo3iatfa rauvp (4 exoir3totfa e n ol( trxoxopnudope  fciasfsDrr(root4tlxnmfcilt m2elumont4trxrio3totfpteluvsls)srxoxm3iy4op n iesltfartaurpot1opeo iciat m eauvo u4 exnmf ty1lat livils srtrxm3ny4optn iviatfarrr(m no4apto f3ils sDrl( s;t0 ltrif ta1lmteln i;t  2xoxo3oydllen ieiat a2umumpnu0oleomoctyd mDuanvont4altomr iotoa   uvs;t)srtr(rpnu4op  lfetls)aDuax poo0aeeomoctytlaDrmuvo () ltoxo to1op r nvs t)srtmimpou1amte fvtls s2rmumpot0oleniieils a2ul(msnt0aexoio iydfp ean il() exoxopny1lpe  feil()arumumoot0alenmoeilslsDrl( sn(0trxomoctotomteanvo;(0t2xm(m3no1ape lneilt  Drmur nu1openmoeiad mDul(vo (4artnmr to1lmDe uvsl( trxmio io4lp e icsa( sDtrumpno1tetomfetlsfmDrauvp;t4 ltoxo io1oa elu o s0setm(m no1apenlicsl(  2um(r oo1texoifeiysla rmnmo u4texoifciatfmtrli i;s  eurio3ou4ol elfes sf rrmuroou1ope mfciatls2umuvonu)aexrmfcoydopt livols setoim3nudop n fcslt) 2rm(rp;t1olx  i3iadla umuvpnu) lerxo3iotfa rluvi;t0srtoxm3oydol nmneias)srur(  no1aex mf3iatlaDel( p;u0 rxoircoy1fm eaneolt0 eumio nudop elfvt ()s2ua(r nt1tpxnmi3tltfsDel(ms u0treoio3totlmD aivo;s0s2urio iodome mncsltfsDrr( pnu0tpxn oeias sDua(vsn(4tltriocty1oaDr uvi;() 2urxrpio1optemnetlt arumumpnt1aleomociydlm2rau o (4 etomrctatfmDeauvs;(0setmirpno4al e ici s srtau p;u0altoifeiadfs el(msnt0altnxf3tatop eaieo s) rtoim oy1omen neta()aDrm(  ;t0texo ieiyslm2umn p u) exomr iadlpDean o s0s2toxm3iodol  lnvtl(  2tru  ;t0olx  ociad aDrm( p;u4tltnxo3iodfat luvol( t2toxm3ny1altnlieils)srtru  oo0olt  oeiysls2umums t4tetomocia1oa eaivsls) exoimpiydom elfet sfaDtmx  ot1oltomictltfm elu o;t0 lerxf oodom   nes t)teumxr nu1am emfeia(fs2um(mpot4openmo3tadfs elnmp u0aeerxf totlpD  ues () 2xrxr3no1lp e fesls  ruru p;t4oexn i3iaslsDrlumo (0 rtnxo3oodop  luvi s sexr(o3iydaltemnct sf Dua(m no0alx moetyt a2uanvo;u0 lerir3to1opDr ivi;s srurir3oy4op   fvslt)aDurur ou0ape mi3iys s2rm(mp ()tltoirctydomDe i ols0 rur(m3iy1ope mneils) Dtmurooo4opeomieiltlm2uluvsnu)aeenmrciotopD  uvs t)teumio3iy1lpeelfet s srurxm ;o0oee iociysls rmumsnt0 rxnifcoatfm raiei s0 2urio3nu1amee ieil( sDuax  ou1oee mo3iyslaDrl( pn(4 lxoxf tydlp e neo (0 2umxm3ny1ope  nctl()sDtmx  ;u0ole  f3ildfs elnmonu) lenifcia1la e ieo s tetoimpnu4ll   fvias)artm(mpot1opeoioetat aDranvonu0alxnxr3oodoa e n ils)s2uo(m ou4ap emnvtat s2ra(  nu4alxoiiciydlsDeanmsnt4tetnmr oo1faDrlnvs ( seumiopnu4opte icsas) Dum(mpoo0oeeniociytfm ulu p;() exoxfcoa1oa ran il()trxmxmpno1ole mieia(  2uaxmpou4apxomfeias a uauvpnu)aleoir oadopDelies;s0 ruo(mpnydalte ncsat)aDua(rpnt0opto icildfa uanvon(4tetoxo3iodfatran i s srumio3nu4al n fvt sfsDrrum no1aexn ociys s2umn pn(4aexoio3iadlmDrlnvi;t  2to(o3iydap   icilsf 2rmxro;t0tet  ocild a emu snu)tetrio oytopt ln ilt0t2xr(o iu4apeelfet (faDraxr ;o1oeeo f3tadlm umnvp;t4teeoxf iydfa rau s;s0 2xmim3nu4lmenmivtlsfaDra(mont1open fetls m umnvsn()artrxo3iotlpDe nvs (0trtmir3iudlmenlivtlsf ruaumpno1tex iociyd m ua( pnu4trtnmo iotoaDranvsls)srxo(o no4ale mnetl()srurxr ou4apenmoeilt s rl(vs;u0tlxrif oatfatr u ilt texmimpnudomtelfcs sfa2uaurono0apen iciad m2ulnvo;(4 lenmr3oa1lpteauvo;t0 2trxopoodome  fctlt srraxr ot4apxnmfetyt sDrauvpnt0 reoxf3iodlpt aivs t)srtr(o3iy4lm e nct s sDta(roou0aetnmoetas m rmuvpn(0trxoio iy1fp rauvo;t0texmxm no4llt mnct (fa2rmxm no1tltnio3iadfa2um( ont)texrxf3oo1faDr u o;s0 2toxmpno4ale mici ( arua(mpou0tlenifciadlaDumumpnu4altnmo ta1oaDeln ols  rxm(mpoydameelnvslt)s2rmxmpnt0oee iociys sDrm(mo;u4 reomo oytfmDrlivo;(  rxr(opou1al e ieilt)aDtrxrpnu4oltomfcildlsDulu o;t)texnio3oadfaD aueils  rur(r nu4lltelieiatfs2ta(m no0alxoifetlsfs um( o t0 ltoif oytlmDrau o t tetrxm3iy1lpteliviat  rumxroou4altnifciys aDumnvp t4texnxrctytoat an o t0teumxm nu4omtelfvtatf rtr(rpno1oee  ociatfa2uaumo (4 rxrxo oodomDraies;s)seum(rpoydlmt  nct s  2tr(  ot1tle moeiatfmDumnvpn()trtoio3oo1lp   uei s0texoir iudame mfct ( artrx poo0tlxniietadfa2um( snt4texrmf iodfaDr ieo t texoimpiydopt  fcil(fsDur(r ou1texnif3iltfm eanmsn(0treomfcoytfpDrlu i s)sexoir nudlpeeliei (faDta( oou1tpeomiciltfaDem(ms u)arenmr3todlatran i;s t2tmxmpnu4lp elncs s) Draurooo4tpxnmoetysla2ra(vo u0 rtoio ta1oa raivo;s  exrim3oy1ole lieslt)a2raxm no0opto fetlsfa raumo u4 ltnxfcoatopDe n olt)trxmxr iu4lmte ncslt arua(mo;t1alxo fciyd mDrmn o;(0aeeomocio1fpDr ieslt  2uoim nodapee fctas aDrruro;u1oexomocias aDelnms (0 lermfctydomDraneilt)teuoir3io4al nmnvslt s2ta(rp;o0texoiicilslm emnmp;() exnmf io1lm r ueo;t0sexo(mpiy4am nmieilsfa2ur( onu0tlt  o3iadfmDemump;t)aexnmf3ty1laDeanes;t)teuo(mpoy1open nvsls) Draxr ot1alto i3ilt a2emu pn(4 eermf ia1opt  iei t0 ruo(mpnu1al nlncilt)sDrmx onu1oexomo3tlt sDrl( o;() lxrmfctydfm ranvilt sexriopno1ale  ictlsf Draxro;u4tlx  feild sDrl(mp (4 exnxrciytomt  nvslt)s2urir oo1olen fvtas)aruaxr oo1ale iiciad s2ul(mo;t0aeeomf oytfmDeauvol(0t2tmim3oo1openlnvsa(  2trumpoo0tptn feiadfsDeanvp;t) exomf3io1fat  n i s0texr(mpnydlle  fet t srurur ;o4oeen ieiasls uauvont4 rxoif tydlmDelues;s) 2tr(opou4lpen ncsasf rtmu pot4oexoiietytlmDeln o ()tlxoif3iydoatr nvs s0sexm(m ny4altnmncta(fsrrauro;u1aetnii3tatlaDranvs;(4aexnmo tydoat  u o;s0 etmxm oy1opee fcilsfs2ta(r ;u0oee  fciydls2emn s t4trenxocoodlmDe ivsls)srxoxm iudop   ivs sfsrtmum oo1oet mictyt m2rmu o ()altnxr3ia1la elivils  2xoirpiodlme lieilt arraxmonu1oexo fetltlm2um(vsnu) exrif iotlmtean s;s0t2xm(r3iy1lpee iei t)aDtmxro;u1oleoifctls sDemumo t0 rxrxo3iytlptrlnvs;t  rxmxo3nudam elfvil()sDtaur nt4texoifciyd a ua(mp u) lermo iy1omt  n i s)srumxo nudaltnlneil(f Duau o;t1tpe ioeiyt sDeln o () eermr iadfa ran o t) rxr(r oy1ll nlfvias  Dum( ono1aeenmfctad aDrauvp;(0trtnmrctytfat  neilt trxrir oydomt  fesl() 2uaumo;o1tpxomf3iys s umu o u) leoxf oydom elues s srtoxmpio4lm emivia()a2umxm ;u4tpeo fetld s ua(vo;(0arxoifctotoa   nvolt) etr(r3iu4omeemieia( a2umxmont0aeto fctysfm2raums;(0tltomf totfa e ueil( sexoio3nu4lmtelnctas arua(mo;u0optomo3ilslmDraums (4tetoir3iodlpDelnvi;t0trtriopnu1lp n ieias  2trxrpno0tlto o3iad a2ulnvs;u4arenmr iadlptr u i;s) 2uoir oy4ole mncia( s2ur(m no0tet moeiysla2umums;t4texrxocty1fatranvilt t2toimpoy1ll   nvs s)srtmu  nt4tpxoii3iadlaDul(vonu)altoxrctytlpDeli i ()t2uoirpio4lm  mfvtl( srumxmpoo1altomfcilsfs2ean p;u4 lenircootfptr nvolt trtrxm nu4lleemieilsfsrtmumpou0opxniociasfaDel(msnu)arenif oo1lpte i s;s)t2tm(r3iu4ape  ieils)aDrmumono1oeenmfctysfm rl(msnt0arxrir3tytom raueslt0t2umxr oodll e ivtlt)arrr(rooo1opeo iciad m2uau p u0teeoxo iytfmD ai i (0truo(rpio1om elnctlsfsDumx  oo0aeeo o3ildlmDrmuvo t4 rerxo oodomteauesls)sexmxo3io4altnlfvs ( aDrmum ;t4tee  i3iatlm2ulums t)texnxf todlmtraneslt)texoirpnudlltnmnei t s2tm(moou0texnif3iydfaDrlnvon(4tlenxr ta1fp  auei s0sruo(opny1oleelfcsatf 2umxm no4altnii3iys mDrl( o;t0treomr iydfmtean o;(0s2xmxmpiodlpenmieil( srur(  oo1ope  ieilsfsDumums t4trxrmr iy1fa r ivo t0 rto(rpno1olenlivsls a2uauro;u4oex  f3ils mDemu p;(4 rxnmf tydfpD aueo;(0seum(mpiu1opt mies tf 2ur(rpno1tle moeiytfa2ranvo;(4 reoif oadopDr uvs;t)t2xoxo3oo4omee icsls) rurxm ;t1texo f3iad aDumnvsn(4 rtnio3iadlatr nvi;(0 2uoiopny1am nmneta( artmum ;t0aexoiictltfsDuanmsnu4 etrircoy1omt lneo;s0seumiopnodole liei sfa2rau pno1optomf3tldfaDumn s t4 etomfciytop eluvi t0sruoxopoydlltnmivt tfa2tmxrpno0aeeoioetlt sDuau s;(0trxoxrcoa1omDeln s;s0t2trir no1alen ivtat)s2raur oo0optn o3iadfm2ran s t0aleniocoa1laDrau i s trxr(mpnu4amtnlivtltf Dtmx  ot1oeenmo3iyslaDum(ms;u)altoio3iy1om  ai i t0srxm(opoudlpt mnviat) rrmxmono1apeomociadlm2rluvs;u0aetrmo iodla raivs;s0 2urxr oo1am nmnctat  Dtau o;o1opxn oeildfm2uaumonu4trxomf3iotfmt lnvs;t) exoirpio4oleemnet sfsDtm(r ;o4tlenmictlt sDelump u4aeenirctytoatraiei s  ruo(m iu4amtnmnvi t aDrr( ont0aexn fctysls2ulumsn(0aexomr io1opDe uvi;t trtrxo nu1lm   fvtls) Draumo;t4tlxomfetlt m ul(mont4tlenxf todlpteaiei;s trxr(rpoydolt  fvils s2tr(r nu4oeenioeiat sDul(vsnt4trtrmo3oatoat  u i s)seurimpno4ope mfci t) Duru p;t1oleniictat s eaums;u4tleoircto1lp  li o;s  exr(r3iy1apen neiatfs2rr(  ;u1tetnmf3ildla rau s u)teeomrciodfatelu olt)t2umxm3nu4opeelfctltfs2taumoou0tpe  ociatlsDrl( o (0 exomrciadfa r ieo t t2toio oy4opte fci s aDurxr ;t4opt mo3ils m uauvp ()trtnifcoydfmDe u i t)setoxm3iodomeelncs sf Dumxmp;o4oexomicilt a eaums u4aetoir ta1lp e ueo s) exo(o3iodlme  ics t)arur(m oo4tlt mf3ils m eanms u) rerxfciodfmtelu o;s  2xo(rpio1lltnmivs sf Dua(rpnu4texnmfciadlsDrau o;u4tlenmocty1laDelu s ()t2to(o3io4altnliet tf 2trxr ;u1alxoifeiys m2rluvsnu0aetoir iatfm  au o t)t2tmxrpiodll   fvtat)aDtm(r oo0oexo fciys aDumnmont)tetrmr3tatomD  uei;t  2uo(r3io1ol n fei tfsrtru  ou4opeomfeiytls emu sn(4 rerxocia1fm ean o s t2xriopiodlmtn ieiat a2rr( ont0oeeoii3iatlm uaumont)aetrio oodlp rau il(0s2xrir3ou4om nlnvi ( artmum no1apto i3iydfa2eluvo t0 rxomr3oodopDeli ilt)s2xrxo3oo4op elieta()a2rrxro;u1aet mieias aDemu snu4tlxrif3iydoateanvol(0srtmirpoudame  fvsas)a2tau onu0openio3ilt m ranms;t)trtnxr oydlateaivi () rtmim oy4amt mfeils)srtmxrpno1tex  i3tltfsDrmuvs u0arxrxocoa1oaDrli s ()texmirpiu4lpeemnvias  Drr(r no1tex  fctydlmDem(vo u) etomr oadlp  ai o t  rurim3oudol  lnct s) rrr(r nu4altnmf3iad aDeauvpnu4 exnifcoo1fmDeauvs;(0sruoim oo1al nmieslsfsruaxmooo1optn fetatfsDemumsn(4alerxr iytlmte ivils0 etr(r iy1lm e fetlt  Drr( ono4apenifciydla umu snt4 eeoxf3oytlm ran i ( trxoimpio4lp emncil() rtr( o;o0tpxomf3iat a2uaump t4tetoxocia1fpteaivs s  2umxmpiodape lfeiltfsrrax  ;o0aetnmociasla2em( p;u)tlxomr io1fmDe uvs;t)t2uoim3iydam   fcias)artmur ;o0alenii3iatfs2ra(mp u4texnxf3tydla  lieils0sruo(r3nudap n fct s) rraxmpno0opeomfeiytfsDrlumo;t0trerio3tytfptran o () rtoim3iy1aptnlnci ()srurxmpoo4olxniieildfm raump (0texnxf3oa1oatrlu s;(0t2um(o3no1am n ncsas) Dumx ooo4oet  f3ilt s2em(vsnt)tlermrctadlm e nvolt0t2tmxr3io4lp elnes tfaDtaurp;o1tleoif3iaslsDrlnvp t) reoxf3oy1optr nei;(0s2tmir3iy4ol   fct tfaDtr(ro;u4optoio3tatfsDelnvo;u4aeenmr iy1fp  li i;()trumimpnu1ol emivsls)sDum( p;t1olto fetltlmDra( o (4 lxoxf oodlpDrluvols  euo(r3ou4lmeelnetlt  rrmxrp;u4alxo iciad mDeanvs u4 eerir3totfa  ln s;()setmxmpno1omee nvs t srua(  oo1optoifctadlaDrlnmpn(0aleoio oodfaDrlu ol() exm(mpiydlp   feta() Dtru o;t0tlx  f3tatls eluvsn(4aexrifctatlmDe n olt  rumir3oo4lpt lfvslsfaDtm(mpoo4opxomf3ils s em(vsnt4arxnio iydlatr neo;(  eurxmpiydlmenlneilsf rtr(r ;u1ale ii3iltlsDuaumo u4 rxoio iodfa elu i;(0setr(rpnydam n nvs s s2ua(ronu1tlt ifctatla2rm(vsnu) rxrxrcoydlpDr ivi t)tetm(r iu1om nlfvi s)arraumpno1oeenmociytlm2eauvo (0alxrmr3todop rau s;() 2uo(r3nydaptnmnvtl()s2tru onu0oleoifctld s elnmp;(4tetrircoytla eli s;t0 etm(m iu4lme  fvi (faDururp;o1opto o3iad mDemnvon() exomr io1fp  lu o;t)tetm(r3iodaltnlivias)sDrru o;o0opeo octlsfsDranvonu4 rtoxr3iatfmDelnvolt)t2umxr3iu1lle lietl()srta( pnu4opxnmicilsla ean s u0aeermo iy1fmDelnei;(0s2tm(o ou4lp elfvi t aDtm( o;o4alxnmf3iyslaDua( p;t)alxniociydfpD aneo t0srtrimpny1om   fci s sDrrur ;t0oetn fciysfs rauvs;u4 rxnmfctotoaD auvo;s t2umim oudomte ivsasfsDtr(rpno1olxnmoeias m rl( p;(0tltrxfciydfmt  nes;s texm(rpno1lle  ivsls)arur(  no4opxomf3tytlm2rlnvp (0 ltomo3iatlpte u i s)srxr(rpoy4altemiei s) rum(rp;o4tleniictysfsDrmn p;(0alxnio3oydop elu s s s2xmxr3oydlpt mivilt)a2rmxmoot0alx moctyt s um( o t0arermfcoytla  lnvslt0trxo(m oy4aptelnvi t sDtaur nu4tptniiciatlm2ra(mo;t4alxoif iy1lptr u i (0s2tr(o3nu1ome lies t  rrmxm ;t4oex ioctatlmDelu on(0areoxr3totfmD auesls0tetrxm ny1op nlivtas sDraxm ot4apx mietltfs2rmump (0trtnir3iatoat livs s0 exoxo3no1alte ncs sf 2rmu ont1opeo f3tlt a ulu p;u)arxnmo tytopte uvo;t) rxoxo3nydll e iesa(  Dur(m nt1aetnif3iasfm2ra( p ()tleoxrctodfpt  n s ()s2trxo3nydlpeelfcsls  2ur( o;t1tlt mo3iytfsDeau o (4tltomr iotfmt auvo;t0 eur(m nydll  lfctlt) Dtmu p;u1ope mo3iltfa2rl(mo;u0artrmf3iodfp elueol(0t2uoir oudlm  mnvs tf rur(  ;u1tetnifciatls2ean s ()altrxoctodom  aues t0 2uoio3no4alt  ictas aDrmxmono4tleo i3iad a2ea(vs () exnmrciadfp e ivols srxoimpiydamt mncsl(fsDta( pou4openmfciltfmDrmnms;()teeriocoytlmteau ol( seumxrpiu1am emicsa(f 2rruront4aex mociytfmDeln p;u) rxrmf3tadopt  uvil(0trxrxo3oudap   neiat aDua(m ou1teeo oeilt s2rl(vpn(4 rxoxf3tytlmDr uei t0s2xoirpoo4op   ivilsf Dur( p;o0alx mieiltfm2ulnms t4tltrmr3ta1omt  i sls teuo(mpno4omt mfvi tfs2raurpou0opx mfciaslmDrmnvs;t4trxoiocto1faD  ivo s0sruo(rpoydlp emiciat)s2trx  nt4aex ii3iaslmDrl(vo;u) ltnmrctodlp r ieo;()s2trxm3oudllenmnct ()sDtruro;o0tlx  fciyd sDeanmp u4 etnio todfa  luvo ()truoimpno4ame lfcs (fs2taumo;t1oltn fciydfa umu sn(4trxomocoydfaDelu slt0t2to(opnodomtn nct (faDtru p;u1openii3tytfs el( snu4texnmrcto1oa   ieo s0seur(o oy4om   ietl()arrr(  ou4altnmfciys m umums;t0tlxrxo oatfaD  n ils trtrxo3nudlm  mfvs tfsDrm( pno4aexn fctlsfm ua(mp;u4tetrmr3oadlptraiei s setrimpny4alen ict s)a2tru  ;u1tlx iicilslsDeanmpn() reomrctytfp  aivi;s teuo(mpou1ol nmici s  Duaurpoo0ape mi3tltfs um(vsnu4artomrcoatfmD auvo s t2xrio3oodopt  icta( sDrru  ot4tltoioeilslmDranms;()tlxoxf3oytlmtr uvo t)s2xrio3iy1ol e fesls)sDra(roou1tee  iciys aDrl( onu)trerifciydfpDrlnvo t) 2xm(r3iodape lfeias  Duaxmp;u0aee mieiatlaDrmnvs;t0tltrir totlm e nvi s srtmxopoo4lmenmnetlt s2rm(rpnu4ape mfctysls ua( p;u0 etoxocootlmD  neo;t  2um(m3nu1omtnmfeilt srrm(m ;o0aptomicilslmDuan p (0alenifciadomDeai s t  rto(m oo4aleemnet t s2trxront4olxoif3ilslm2emumpn(0teeoxf iy1om e uvi t0setoxmpiudam  mfetat)s2uaxm ot0apt iieildfsDea( o;u0tlxnmfcoadfpDr n slt) rxmxr oy1al   nvtasf 2raxm ;u1oet mo3ils m2elnmo t4trtrifciotomDe n ilt) rtr(m iu4llenlneiltfaDraxm no1teto feiytlaDrlumon(4tlerxfcta1laDr u ils0seumimpno1al  lfesas)s2rr(m ;u1opxniietls m2rmu s t0 exrxf oatoateanvsls)teurxm iu1opt miet () rtmxrooo0alt  iciyslaDel(ms;() leoxf3iytoaDeau s (0 exoio3oy1lme lnvs tfsDta(m oo0tlxo o3tys sDuln snu4 lerxfctydlm rai o;()seuo(o3oo4om  lfeia()aDur( pnu0tlx  fetatls2uauvpn(0teerxr tydopt  i sl()t2urxo3ny4lmtn ivtlt)s2tax  oo1texnioctysfm2uluvsnt) eerxo3io1lmD aneslt t2xrxrpou4lmee fei ()aDtm(rp;u0tlxn ictys s2ulnvp t4 ltoioctydoatrlies s seumxr oy1ale lfci (fa2raxrooo0tlxomiciadls ra(vpnt4 lxomo3oa1fm  li s (0 rxrim nydlpeelicia() Dururo;u0altnio3iat s umuvpn()trenxr3io1lmDeauvi;t0s2xoxmpnu4lpeelfetlt)s2rau  ou1texnmictls s2emu s u)texnmrcoo1fatrlies t  rumio3ou4ol elfctas aDtrur nt1apto o3iaslmDua(mo;u0trxoxr3totlptr iei () etmxm iu4omt  fet t) rurur ou0aeto i3iasfs rlnmon(4tlenxf iadlpt  n i;t0 rurxopiudalt mnvils a2taxr nu1tltn i3tas m2rl(mo u0 eenxfciodlpt  ueslt0t2tmxmpno1lmenlfeta()a2raurono4aptn i3tas sDrluvp t0aetnir3ta1oa eluvol(0trtoxm3oudame  net t artr(monu4tex ifetasfm2rmn o t4alerxf tatopDrau o;t0trumio3oydapt lfcsas  2ta(rpnt4apx if3ildla2elump;(0trtnif iatoatrau olt trxrir oy1ol  lnvsl()artr(moou4olxniocildlaDum(ms;(0 rxnif3io1fa r nvi;s0srurir iy4lptn fes (  2urumooo0olt  fcias s2ea(mont)trxrio iatopDr i o t0t2xrim3iydlmeelfct t) rur(rpoo1apto f3iyd s2ran snt)arxoir iadlm r ieo (0s2xo(m iydole  iesas) ruax  ;o0tltn oeiadfaDraump;t)tetrir oy1fmteaneo;s0srxmxr ny1ll  mics (faruaxrpnu1olxo oetld mDulu o u4 lxoxrciytlmtelnei (0seumxm nudlmen fesas  rrmur ;o0olenifeiatls2eau s u4teenir3iydlate ueolt  etrxr3nodaltn ivi ()s2trxroot1opt  feildfm ulnmpnu0tetrmo3tatfp rlueo;s  2urim iu1lpeelivi sfsrta(mpnt0opxnii3ildlsDrlnmonu0tetrxr tatoatelu i s t2xoxr3oudope mivilt aDum(mo;t1oleomoctlsfa emumpnt) ltomrcty1omDrluvs t teto(mpnodam n fcs (  ruaum ou4alx  ietys sDranms;u0tetnmf3oatfa r ivi;s0sexo(m iy1amee nei tfarrmxmpnt4apxoio3iadlaDraums;(4texnxfciytfaDelnesl( setoxo3no1open nvils artaxro;t1aex  f3tls mDumn o;(4tltniocoatoaD au ol( sexo(mpiu4ope mnctas srurxmo;t0tlxomf3iasfa2uauvp;u0tlxomo iadlpDrai i s0trum(m ny1ope mfci sf rrr( pot0oetniietysfs2ulnvp u0 ltnmrcia1lmtrlu sl(0 2tmxo3iy1aptn ivtl( aDua(mono1apenifciadlm em(mp u0trtrioctytop  anei t)sexmio3iydlpee fcsltfaDtrum ou4apxn ieiytlsDumn s;() exoif3oy1fa  li ils  2xrio nydamt mfcia() rrm(moot4aeenio3ilsfa uln s;u4 rxrmo oo1oa elneo;s) etrxm ny1alt  fcsasfsDrm(  ;t0tpxnmf3tydlsDrmnvpn() rtnxf oa1faD liei;( trxrir3ny1alt mnetatf rum( ooo1oltnioeilsfmDea(mp (4tlxrmo iatoate n o (0t2tm(rpou4lp nmnctl(f 2trxm ot0tltnii3iys s2rmump t0 rtrxo3oydoptrlieolt0s2uo(o iu4alee ieia(  rrau  ;t0ale ii3tyt s rm(vp (4alermr todoptrlneo ( trxrxm3ou4ll nliei (f Draurp;o4olenmieiatfa2eaumon()texnxfcoy1lpDr nvi t  rtm(o iu1lle mfvt ( sDtruro;o0oeen oeias a rmn o;(4 exnxr iatfpDeln il()t2xm(r3oy1ol   ici sfarrax ooo4aetnmf3iytfa um(vsnu4 etrif iy1oatraneo;t)s2xm(m nydaltelict (fartmxm ;o4tpx iictydls2rl( s;u)aetrxrcty1fa elieol()srtrxo3iu1ll nlietls)s2rm(  nt0optn f3iatfs2rlnvonu)teeomociodlmDraivo;s trto(r3oy1alte nei s) rtr(r nt0tpxn i3tysfsDranmo t4aleoif ty1oaDr nvo s) exmirpiu4lpe lfvi s srta(  no0oeeniietas s rl(mont4teeomr ootlaDrlnvo t0sexoxr io4ome  icsa(faDraur ;u0apx mfetyd m ra(vsnt)alenif totfptrai s s teur(r io4amte nvtas srta(mooo4oeeoifciaslaDrm( o t0 lxnxr totlm   nvslt) exo(m3no1al  liciat  2ua( oot0openifeiydla eauvpnt0 etomf tadfm   ieilt0s2umxopoo4olt lfvsl() Drax  nt0aet mietasfaDeanvsn() rermo oatoaDe u s;t) 2uo(rpoodam e nvtlt  Duaump;u4oet mieilt m2eau s t4 exoif3tydlat  ieols)setrxm oodopeemneta(fs2tax ooo1apen i3iys m eanvpnt0tlxoifctatoatrluvi ()s2toxmpoy4aptnlicsas) rurxr ;o4tet ifciyt m ea(mpnt4tlxrxocoadlat  i o s trxmio iodape  iesat) Dtm(ronu1aptn octad sDeluvp t0 lxrmo oytfa raivi;(0s2xr(opnodomtemics s  2um(r nt1tptn i3ils s2ulu o () eenircto1omD luvslt) rtm(m oo1am nlnvs t)s2rmxr ot0apxomo3tlslsDranmp;u4 exoxr iydfatraivs t0t2xrio3iy1am n fvta(f 2ur(rp;o4apxo ictyt sDea(vp u4 rtomr iydfpDrlivs;t s2um(o3iy4alt  ivtltf 2umxm nu1opxniictldfs2umu p;t0altrxf3totfmtelneolt  2trim3oydolenlieil( sruaxm oo1apxo fciatlsDrl(mpnu0trenxrciodlmDelneils0trtrxrpoo4lmtnlfcsa(faDra(rpnt4aet iiciytls ul( o;(4 eenxo oytfp e ivo;t s2xrxo3ou4omte ies s)aDuaumo;t1teenif3iydfs rlnvsn(4arxrir ty1omte u i;t0s2xmiopny4omtelneslt aDumxmono0oetn ieiatfm2emu o;t) lerxo ta1faDr neo;( t2xoxopoy1aptnlfei s)srrm(  ;u1tpt if3ildfa2umnvp;t)aleomr ootfa raivols sruoimpio1lpe  nvilt)aDtmurpoo4apeo i3tytfm2rln pnt)altnxf totfatr neol( t2xoxopoodlpee fcils srurx p;u0oeeomoetytfa el(msnu)aeenir oo1oa eauvi;t0 rtm(rpiu4om e ies (fs2umumono1tptn feils s2uaump;t4 etnmf iodfaD  nvils0s2trir3io1al elnctlsfsDrru oou0aetnmoctlt a ra(msnu0texoxocoy1latr ivo;s teuoxo3ou1alee fetl(  rtm(r ou0tlto o3iltfm2rln snu)teeniocty1lat anvilt  etoxo io1lptnlnes (farumu ono0tpxn feias mDrmnmp t4 rtoxo oytfa eauvo;t0seumxo io1lmt mfesltf rtaur ou4ale iicild aDul( o (0 ltnxrciotopteaies;s  eurir no4lptnlfvt t)aDtmxmoou1open ietytls2uanvp u0texnxfcoytom rli ilt0srtmir nudol emnesls srtaump;u4tetnifcildfm um(vo () etrirciotomD lu ilt) rxo(r oy4lpee neta(f 2uaum ;t4tlto oeils m2em(mon(4 exrxfcia1lpDe nes;t  rto(rpoudllenmnvi ()srtrxr ou4ope mf3ildlsDrmn s (0tltnif3iodoat an ilt sexrxm3oodaleelfcsl()arrrxmpot1tpt  i3iatls ra(mo u0texrifcoadoatr ueo t sexrir3oodaltn iesa(  rtr(m ;t4oexnmf3iltfa uauvonu0artnxr oo1opt ln sl(0s2xmxm ou1oltelicils) Dtm(m no4ape moeiysls eau snu0 lenmo3io1om   uvs;(0s2toir3oy4al n fei s sruaum oo1opxn o3ilt a eauvo;u)teenmr3oytopt li i;t seumxr3iydom n fvta(fa2rru  ou4altoif3iysfm2rauvs (4arxoiocia1lp eaivo;(0srxo(o ou1ope mfvtl() 2rauront0teeomoeilt m elu o;u)tetrir3tatlm e iei s texmiopno4alt  ncta(f rrmumono1tpto f3iyd a2uluvs;()aeeomo to1oaDrauvi;t) rtoirpnydamen ivsatfa2uax  ou0olt  f3iytfs2rluvo;u0 etoxo3to1fm eanei t  2um(mpiydol elfcslsfsrumx p;o1oltomi3tatlm2el( p ()trtoircoatfmt lies;s)sexr(r oydomenmfvsl(f Drrxmpou1tlx mfeiat s2rm( o;u0aexoxr iotoaD  nei;t0 rtmirpoodlm elnci s)aDurxrpot1tpeomfetyt m2ea( sn()aeenifcto1op eln o;( s2ur(r3iy4lme lieilt aDum(mp;t1tlx mfciatfaDulnvsn(0arerio3oydfa e uvs;( setrxo3nudlptemnvs t)a2taxrono4opxnmfetysla2rm( o;(4aleoxo ootfat lu olt0 rtm(o oydamee fvias srrax  ;u1oee io3iad a ua(vs t4texnmo ta1oaDr n o t)s2xoio io1ol emncil()aDra(r no4aeeoiieild a uanmo t0trtoxo ta1fp r ivsls)srxr(o3ny4llt mfcsat) 2rm(rpoo1tetnifcild a2rau ont0trxrif oytop r uvs;(  etoxopny1al e ivt sf 2trum nt0aee iictasfm2em(mo t4aeermf iadfp  aivi s0seuoimpio4ameemfvi s)sDurx o;o1tex iiciys a ea( snt0 ltrmfcia1lpt  nvi;s0 rtrirpiodlltnmnvt (fsrurxrpoo1alx  oetld aDua(vs;t4trxoxr tatoaD aiesls)srtmxr3oo4lltelfetl() 2tmxm ou1tptnifcils m rmnvs;t0aetoxocio1oa   i il( tetrxopnu1omeemfesltfsrurur ;o1aetomi3tldls ua( pn(4treoxfciytoa raueol(0s2umio3iodll n nes ()sDuaurp;u1tet ifetyt a2ulumont0 renxf todoa raivi (0s2umio ny1lpee fvsls)a2tmx pnt0opto fciltfs2emums;u0 rtrio ia1fa   neo s)t2tm(o3ny4amt lneias) Duau  ;o4apxo o3tas s ulums t)tetomo3iodom eaieo t0 rtmir3nudale  nvta( aDrr(monu0olenmo3iydfa2emnvsnu)artoio ty1fptraies;(  rto(opnodlmen fcil(  2ra( pnu1teenif3tas s2eluvonu4teerxr3oy1lpDr ueslt0trxoxo3ou4altelfeta()s2rr(m no1tpxo fctlsfa rmnvsn()trxoxf iotlpt lnvo;( trxoiopoo4omt lneta(faDtmu  ;o1opxnmiciytfm2uanvp u4tlerif3oydoaDrluvi (0texoxopny1aptnmiciat) rum( pnu1apx mi3tysls eauvpn()alxnxo to1lp e n s s  eum(rpiu4al   fci s arra( pno4tetnmf3ild s eanms;t4 etrmrciotopDrln o;t) euo(m oy4altnmfei tfa2tr(root1aetomoeiytls elu s;t4teeomo3oa1fpDelnvol() rtr(m3ou1ap n iviatf rrrxmp;t0tlx ioetat a eau s;t0 reoxrctydfpDe nvo t  etoir3ny4altemfcil( a2tmuront4tetnmieiatlm2emuvont0teerirctydfp   ieslt0trxo(o ou1lmte feia()a2rmxm ou1aeen ocild a elu o u4aetrmr oa1fptr n o;s)s2ur(m3io1amee icsls  Dtmumpot0alxnmf3tyt m2rmnvo u0areomf3io1lpD  u o;t  eumxm3iodolt  neils)aDtrxrpno4opxo ietlsls rl( on(4alxoxo ia1fatr nvo;( t2ur(m3oudomtnmnci (  rrr(ro;u0tltniietadlaDelnvpnu)aexnxociy1omtelivs () rtoxm io1lmeemieil()s2rr(m ou1oetomfetlslm rauvont4aetrmo3iy1fmDran s;t texo(r iydlptemicsl()aDtru pnt4tee mi3iasla raump;t0texnmfctadfa  lueslt  rxmio3no1ll   feiasfsDtmx o;t0tleoiiciysfaDel(vs;(4tlenmo3iodlp  aiei ()sexm(o3iu4ap   ici t  2rmx  no1aptnmi3iydlmDumuvp (4aetoiocoadfmDr ivolt0 rumxmpiudoltemnvtasfaDurumpno0oee  f3tad a rmu p;t0aetnir3oo1faDran i;s  2xoxm ny1olt lnvtat s2rrxro;t0apeoiieiys m ulnvont4aetriociodlpt luvs t  rtrxo iudlmt  fesasf rrm( p;o0oet mictlt s rmnmsnt)tltrxfcta1opDraueolt0setrxopny1opeemictl(f 2rr(m nt1texo feiydfmDemnvo;u0 lxomo ty1faD luvs ()trur(mpny1lp  mnvs (fsrtmx p;u4apxnmi3ildfm ranmo;(4artoif iotfptrln o;(  2xo(r3iu4lmenmnesat)sDta( oou1tltomo3iad a2rm(vo u)aetoioctadopDr ivo s) eurim3oo1opt micsasfs2urxm ou0oexo ietyslsDumnvp;u0trenxo3tadlm raieo t  2xr(m iy1ol elnvt (  rtau  no1tltoii3iat sDelums u)tetrxr3tatfpDe u o;( srxm(m oy4ome lnvta()srrmx onu0apx iieiatls2rm( snt0 etrxf3iydop   n i s trxmxm3io4llenlici ()a2tm( o;t4aeeomfciatlsDrlumont0aetrif oadfp e uei s t2umxr3oydap elietasfaruaxr ;t0ope  f3iatfmDel(mp t0texnmfciodfm  liei t)t2tr(r3ou1olt  ncsa(fsrra(mooo1apxoioctytlsDemnmo u) exnxfcoy1oaD  nvo;( srxm(r oudlpt  nvils aDumxr ot0oeen ociad sDeanmo u4aeenxf oa1fa  aiesls0 2xo(o no1apt  ici (f 2rmur ;o4olt if3iat a elnvpnu) eenxociy1omtrauesl( trur(o iydolenmicia()arumx  ;t4tet  o3tlsls ea(mp;t)trtnmocoadoaDe i ils)seuoxm3iydalen nvs t) 2rmxm ;t1oeenio3iltlmDea( s;t4 etrxr oy1om  an i;t)s2xoim nu4omee ivi sfa2rrxmp;t0olx iictltfm2rmn o t4 rtrxf3tydlaDeauvsls0srxrxrpnodoltemieil( arrrxr ;u4opt mietydls2eluvonu4 reomociotoa ran o;t  exoiopnudamtemfvilt aDur(rp;o0open fciatla ra(vp;(4 lenxf iadlmDrauei;t t2tmxmpio1ame  nct sf Duaxmp;o1olxomi3ilsfm eauvs;(4 rxrmo3totomDrln s;t0s2ur(o3nodome  nvslt) 2rrxro;o4aee iiciaslsDean pn(4tlxrxrctotomDrlneols0srxoxopny4lptnmivs s)arrmu  ot1tltomf3tadfa rmu onu0 lxoxr oy1laD aivi s0t2xmxo3no4ol nmnvi sfs2ua(root4apxomo3ilslmDrm(mo t4aetrmfciytoptrluvilt srur(opnydale miesa()aDtru onu1oetnioetytls2rlu p u)aexrxr ty1opDe nes ()seumxr3oo4ope micsat)a2trurpou0olx mfciadlm2rm(ms t0trtrxfcoydla elivi ()setm(r3iy1lmtnlncsatfaDua(mp;t1tle  ietls aDulumsnu4artoxrcoatoa   nvi t)sruo(opiy1ol  lnet tfsrrr(roou0tlto oetys s2eau s;t) rtnmr oodlmtrau o s  eum(mpnydlltnlnetas)s2ua(root1tle  o3ilslmDea( o u4altnmo3oo1fmte ieol( t2xoxrpoo1olee fcs t) Dtau p;u4apx ifcilt s rm(vo u)artrmo3oa1opte nvs;t0t2toxmpiodal e ivs tfsrrmx  ot1aptn fctytfa ea(vo (0trtnir3tydop e ivs t sexo(r ny1altnmfciat  2ra(  no1tlt ifeiytla2rm(vpnu0tltrxrcio1oateaueilt s2xoxr nudllt mici sfartruront4tlxo fcilt m2uanmp t0 ltnxo iy1oa  ai s (0sexo(rpiydome mncilt  2rm(rooo0aetoii3ildfmDemu o;t4 lenxr3ta1lmtr n i;() 2tr(rpio4ll e fctas s2um(m ot0apx mictldlm2eluvsnu4texnir iy1lm r u ils s2xo(m nydllen ict sfsrtm(  oo1tex ioetltlmDeln o t0artrmf3todfpD  n o;t0 ruoir oydopeelnei tfa2umumpoo0opt  ieiadfmDuln sn(4texomo oatopDrai i t0 eumxo3oudomtnlncilsf Dtauro;u0tpe iociaslmDul(vp;t4trtnxr oo1latrai olt  2xmxm ny1ame liesasfaruauroou1tleoioeiytlaDrmnvp;t)tetnmf iy1faDr ueol( tetmxrpnudalee fci sfa2tru pnt4apx  fciys aDemumo;u4aeenmrcto1fm e uvsls trxr(m3ny1om emfcia(f rra(monu4aexnmo3ils a2rmu pnt4trxomo3iy1op  aieil()srto(o oo4amtnlnviasfa2rrx ono0opeo iciatfm em(msnt) lenmfcoytomDelu o (0texrxr3iodlmtn nctas)s2urxrpno1tpeomieiatlm elnvo () ltnio iy1opDrluvsl(0t2tr(mpio4om emnviat) 2tmu  ;t4apx moeiltlm rmnmpnt)tleoxr tadlateauvo;()srum(o no4amtn ncsa(fs2ur( o;o4tet moeiys mDel(vo;() leoxfciydlmD lues t0sexo(r nudlme mfcilt a2urxm ;u0opx  feildlm2rmnms;t) lxoxrciy1op raiei;s t2uoxrpoy4om e iesat sDtm( o;t4tpe  ictytls em( s;(0tetoxr3ootfptrlneils)trxrxo3oodalenmnvs t) rrmx  nt4teeomo3tadfa2ranmp u) rtnirciy1oaD luvi;(0 rtmxo ny1ome mncsa()s2umumoot1opt mfeild m2rlumo (0texrioctadfmDeau slt)trum(opio1opt miviat s2taxm ;u4opxn ieiatfmDrmuvs (0altomfctotlpD  i i t)sexr(o nu4aptnmnvt t  Dtau pou4olt mictlsfaDeauvsnu)trtoxr3tadlmDrlivsls  2xrxo3ou1omenlfeilt)aDuaumoot0olxn ieildla em(mpnt4 eenmf3iatom eaivs;(0t2xo(r iu1amen fvi s)sruax oot1tltomociytfaDemu p u) lxnioctadoatrlnvols0s2xo(o3nu1lmt mfci (  2ua( ooo4teeo ociys s2umn p (0tleoxf3ootoaDeaies;t t2um(o ou4apeemnetls  2rrxr nu4tleoifctydls rlu o;()alxnmr3iydlpDeanvolt0t2ur(opoodalenlnvias aDrrx p;t1olenmfeiyslmDea(mp u0 exnxocty1laDranvo s  rxm(m3io1lm   fctl()aruauro;u0tlenmf3tasla2ran s ()artrir oo1fpDeaiesl()t2uo(m3ny4aptemiet tfs2tr(ronu0opxoii3iltls ra( s (0altomrctydop  auvo s) etrxopoy4altemivtat)s2trumpnt0ale mf3tytla el(vs;(4aetoxf3tadlpD  u ol() etm(o3nodop elnci ()sDtaumpot0teen ictltfaDrm(vs (0 leoioctatop  aivi;s  etrxopno1ap e fvta(  Dumx pno0olxnmf3tad m2rlnvont0artnmr oadoa eauvi t trum(r3nudlpt liet ()a2tmum nt0oexo o3tys a el(vp;()texnmfcoydfp eaueo;(0 rum(m3oodlp elivil()s2umu ont1altnii3tad s2ea(vo u4artoir3ootopDrli i s)srumio3ou1ll e ivtl(fa2rr( ono1oetniiciatfm ean ont0treoxf3totlaD an s;s  2xo(mpoudlp emfcia( aDtm(m no1tptnif3ils m2um( p;(0trxnif3ootlpDrlneolt trur(m3oodopenmicsas)s2ra(rp;t4tltniiciyt aDeanmont)altnxo3iy1fmDeaivsl() 2xoimpoo1alt lnesa(f rrr( o;u0olxn fetaslm2rl(mpnu4aeeoxocoatfa raieo;s trum(mpnydam   fcia(f rraxr nt1oet if3ils a uanvpnt) rxomr3ia1lmtrlu o;s0tetmxo3oudop nmfvsl() Drm( pou4tlxnifeiytfmDrl(vo;t4 eeoio to1fmDeanesl() 2uo(opoudomtelnei ( aDuaxrpou0aetn feiatfa ul(vs u0 ltomf oodfptean ils  rum(o iodop e nvsat sDrmu pou4tex  iciatlm2eanvo u0alenif3todlp  aieolt0setmxrpiy1lm e nvsat sDurum ;o4teeoifciat aDul(vpnt4teerxo oo1lp   n ols)trtoxm ny4ap  mnvt tfsDtmxr no0oleomoetltlm2um(mo;t0 lxomf ty1fm r ies;s) 2xmxopiy4omenmfvt () 2rr(ront1apxoif3tysls2umnvp u)tltomfcoadfpD au slt0texr(m iu4lm nmiet (fsDtau poo4texo feiasfsDelnvp u0 eeoxfcta1fmDrlivi s srxmxm nu1lp  lnvtl() rua(rpnu0oex mi3taslmDea(mpnt) rtrifciadfpDe uvils t2xo(m3oydlm emneia()s2umu  ;o0tee mociytfaDeauvp;(0 lxomf3oatlptelivo;t srxmiopnudamtnlfci (fsrurur ot0apto i3iadfm ea( sn(4 eeoio tydfmtrauesls)s2trxo3ou4lltn nesas  rumuro;t0olen ieiatfmDra(vo;t0 reomociytfaD  ivs;()texr(opiydam  livtlt)s2ra(ro;t1tlt  o3iat s emn s;u) rxnif3tydfmteauvs s)s2xmio oydape mivsasf 2tm( o;o1tpeoioeiysfmDuanmont) exoxrcty1oaDr ivolt) rxriopio1aleelfei ()aDtaxrono4texoii3ils s2rlums (0aetoir3oydfa r u o;()sexo(rpiy4olenmnetlsfarur( ono4tetniiciyt s uln on(0trtriocty1laD lieo;t0setoio3nydape mfeil()arra(  ;u0oexnmfciyd m2rluvo (0altriocta1lm rlnei;()s2xrxo nu1apt  nvtlt aDur(mp;o4tlt  f3iadfs elnvo;u) rerxfcia1oatelnvo ( sruoim3iy1olen fetas arrr(ronu4tex moeilt aDelnmpn(4arenxf iytfp eaivi (0 eurim oo1lp e feil() rtmum ;t1aleoif3iydfmDumuvo u) lenmfcta1lpD  uvolt)seuo(r nu1lpte nvtatfs2umum ;u1tet mfeiasfa2ua( p;()tetrxo oa1fpt lnvi;t0srur(r io1olt mnesl() rur(r no1tlxoifeiytlsDra(mont) lxnmf3iytoaDeau o t0 eumxrpnudlm  lnctat)srur(roou0olxo ietlt s2emuvs;t0tlxrmoctatoaDr ues;t  rxo(o3oydop  micsls)aruaxr ou4olto i3iltla2ul(vs;(4areoxr3ta1fm eau o;t0t2tm(opiu1op e ncta( artmu pot0alen fctatfs eaumo t4 rtrmfciy1opt aieil(0 euoxm3ny1ap n fvtls sruax p;o0aptnifetltlaDeauvo;u0texomr iotlpt  n o (0sexo(r3oo4lmt livsa(faDtr(  nu4opt  feilt a el(mo u4tlxnio iadfmteaiei;t0s2urimpoudlle  ivslt)s2umu ono4aeenmieiadfs2em(msn(0artoif oo1opDrau s;s)trtrxo nydom  lncsatfs2rrx pnu1apeo o3iadfaDel(mo t0tetoxocta1lm eaieslt t2xo(r no1ole mfcilt  Drmxm ou4aex mf3tadfmDem(msnu)altomrctydopt lu ilt t2xoxm iudoptn fesat)srrruro;u0olxn oeilsfaDeaumont) rtoif3iotlmtraueils) eurimpny1am elnesas  Dta( pno1aex  f3ild a eauvp;u)tetnmrcoytfmD lnvi t s2xm(rpiy1lmtnlivt t sDumxrpnt1tee  fciatfaDelnmp;()alxomo ty1la rln o;s0teum(o ou1op   feils  2urxrpot0opx  ocilt m2rlu p t4treniociodlm eau sls0srxoxr3iudap n fetltfs2rmxm ;u0oltnmfciydls ran p;u0 ltoio ootlaDeaueslt  eurirpiy4ome  ictatf 2rauront1olxnmociltfmDulumpn(0texnxociydomtrlies;t)trxrim iu4ll   fetas  2urx  ;t1altomieiysls em(vs u4alxrmoctotoat liei;s seum(mpio1lm emnesat)aDuaxmonu4texoioctyd a2ulnvsnt)altomr3oytfp ean i t)t2tr(o3io4ope  ivi s)aDrmum nu4alx  ieildls2umnms u4texrxocootlat  n slt srtmxo oodom n ivs (f 2tm(mp;u0tpeo i3iydls2um( s;t)arxrmo iodfaDraueo;s s2uoxmpoy1ome  fctls  2ua(ronu0tex io3iad a em(vs;t)trtnmocoatlmDe u ol(0 rxr(o3nydolte netlt arrr( p;u4aptn ociytlmDum(mo;t4 rxrxr3oo1oaD lnesls) 2xmxm no1lptnlfvtas)s2rm( pnt4olx ifeild s ra(vp;t4tltrxrciatoa ean i;(  eumxopny1lmenlnci t srtmurpou0oee mietld m ul(vp u0 rtnmoctatomDeaueo;t)sexmxm3iu1open ncil( srraxm no1tetn i3iys m ul( o (4areoxf todfpD  nvolt)s2toim ny1lpeemnvsl(f rtmxmoot1opx iieild s2el( s;t4alenmr io1lmD  neol(  etr(r3nydapenlfctl( a2taxro;t0aee mociatls rmuvp t4tlxnio oo1optranvs t0s2umir nydomtelietat  rta( ont4aeeomi3iad a ua(vp;u0 lenxo3iotfaD aiei;t0texrxo3oodopee nvil()a2ur( p;t1opt iicild m rlumo;t0tltomf3tadfpDelneils0 2xm(rpou1aleelfcslt  rra(mp;o1tpt io3iys a2rmn s u)aeerxrcia1lp   i o;s) exmxopou4amenlfviat a2rr(ront1oltn oeildfa2eln ont) etnxo oa1lp  au olt) rxoirpiy4lmt lnvslt aDtaxmo;o4altn o3tydfa emuvp u4 exoiociatfpD lnei;t0 2trio ou1lp nliet sfs2umu o;t0aex mfciaslm2em(mp u)trermr3iodfmDe i o;(  exmxopou4lm emfvsls artmu ont1opt  f3iysls2rmump;u0 etnxo3oo1la eauvs;t t2xmir3io4aleelfet t a2uaurpnt4tex  o3tadfa eanmont) lxrmr tatfpDrluvs t  exm(m oudopte ivsl() Durur ot0ole mo3iadfsDrlnvs;u)trtrmfcoo1om e u sls)teto(o3iudapt mivt (  Dra(m ou0alxoio3iad m2elnvo u0 rtoifcio1fp   n i ()srxmir3ou4lltnmivtas aDua(rpnt0oeeo fcildla2elu o t4teeoxo oy1lpDr ies;s0 rtr(rpoy4ame mfeiat a2trxrooo1tpxnmo3tldlmDrl( s t0 eenmf3iytlmDr ueo;()s2xoim3oo1apt mfvsa(  ruaxmp;u1olt mi3iaslm2rlumsn(0altomf iodom  lieolt truo(m io1omt mnvils sDrmu pno1tlt iiciaslm2ul(mo () lxrif iodfm  ln s ( texm(r3no4apee ieil()a2rr( ono1tpe mfctat a rau o t)areomf tytlm r n sl(0 2xrxm ou4ll  lncils)s2raumo;u0ope ioeilsfs2emuvs;t4artrio iy1fate n i;t seuoxm oy1ol emnci (f 2trump;u1optn oeiyslaDulnvsnt)tetrmociydfatrlnes;s) eurimpnydom nmivtas)a2tm(rooo1aexoif3iydlm umn pnt4texrxo3ty1lpDeanes;()teuoxo ny1lme livtls sDum( o;t0oexnmoeiat m2rmuvo ()arerxo3ty1op  auvo;s0trto(r3oydlptemictlt) 2ra(  ot4tleomoeild m2uanvsnt0 ltomo3oa1oa e i ol(0 2umxo3io1al nmfetltfartmxrpnu1tlxoiociytlsDem(mp t)tltoxf ia1fptrlu o t0 2xmio oo4lleelfcsasfartm(mpou4tpxnmieilsfa2rauvp u0tlxomf3oodomD  n slt0srtm(rpnu4om  lneta()aDuaum ;t4apxnmi3tydfm2rau o t)arxoxr tatfm rluvilt)setmxmpiodomteliesas a2umxmont1apeoifeilt a2uauvs (4teeoxfctodoateluvsls)s2xrio3iydol  lies t)a2rrx pnt1oet mociysfaDeau pnu0 lermrciodfpDe u ils) 2to(opoodamtnliei () Durumpou0tex  iciasfa ranvpnu0alxrir tydfm ean ol(0texm(o3iudaleemicsls)sDtr( o;t0tltomocildlm em(vp;t)artomfcoydlmD  n i;( sruo(rpiy1op e ics ( artmum ot0aex  i3ilslaDeauvpnt4aetrxr3oodoaDrlivs t)texm(rpny1lmt  ies s aDrrxrpot0oeeo fctadls ua(vs u0trxnmr oy1lmD  iei;(0 euoxr no4ap nmfvsas srrru ont4aet iiciytfaDrm(mp (4 exrxr3ty1fa eln slt0 eurim no1ll nmicilt)a2umxm oo4apxnmociat sDumnvp;t0teeoio3ta1om ranei () 2to(rpnudop n ncia(fs2rrxmonu1aet  fetysfm2uauvp;u0aexoiocoydfa eaneslt0trumxrpiudam eliesat artr(  ;t0altnmieiltfaDel(mp u)aeermo oadfat li slt)s2uoio3iu1olee nvtlsfarum( o;o1oleoiocild s2rln o t0altoxoctotfmDe ies s srtoimpoodlmeemfeslt aDtaumpou4tlt io3ilsla ul( ont0tltrmfcoo1fptelnvs;s srtr(m oo1olt lnvtl(fsrrrx  ou4aee mietysls rm(mo (4 rxnmr3todopt aieo s srxmxr3ny4lmtemieia(fa2tm(r ;t4aetoii3tls m2rm( on(4arxomr3iotop  anei t t2trir oy1omeelnvt (  rtmu ono1oeenmi3tlslsDrlums;t)artrmo iodom r ues ( sruoxm oo1omee nvs ()sDumxmont0olx moeilslsDuan s;t4 rtnirctydopD  n s t0s2uoxmpiu4opte nvs () rurxrp;o0optomo3iydlm umn p;()aeeriociydlat au ilt seur(opnu4ame  icias)sDrm(rpou0oeto octlsla2eanvp (0 renmo ty1fpDeaneo;(0 euoxopoy4lp   nvs s)s2rr(mooo4apt  ociltfsDeanvs;t) rermrciy1lmDr ues;(0 2xrxmpnydopee netl(fa2tauroot4alxomf3tyt s rlumo (0altnmo3oo1opDeln s;t)texm(opnydam  livtas  2umxmont0alxo f3iydlaDul(ms t0tleoxrctatom   iei;t) rurxr3iy4llt lnei (faDtr(r nu1oee mfeiatfmDeluvo () exnxf iatfpDelieol()teto(mpoudal nlivtat arta(r ot0tpxoifeilsfm rluvo (4aexomo3ty1la raivols  rur(opiu1lpt lnesltf ruax pou4opto ietyslm2rmnvo;t4alxrmf oodlm  aneol( t2tm(r3oudal n nvt s sDrm(mpot1tpxnmoeiysfs2rauvpnt)trerxrcty1om rauvs s)t2tm(r ou4olt mncs tfs2tm( pnt4aleo i3iytfs uanmp;u4 rxnxfciadla eln ils  rtm(m3iu4lp   nvtl(fs2rrxmpno4ape mo3iltla2em(vsnu) rtrmr3oodomtr n olt)s2xo(rpnu4amtn ivsl(  rumu  nu4tpxo o3iys m ra( p;t0trtrmociotoa elivol( t2tr(rpio4lleelfes () Dtr(mp;o0opxo fctydla el( o u4alxrxo tydop rai o (0s2xrio iodomtelieslt aDtrump;u4apenmi3tasfmDranms (0 ltnmr totfp eaieols)trtoxr ou1ap elnctl(fa2uaxro;t1tpto i3ilsfsDel(vo;t4trxoxfcoo1lm elneo t  rxmxrpno1ap  mfesas)a2rrxm ;u0oexoifeiadfa2rluvs u4 etoxr totlpDe ies s texm(m iodopee fcs tf Drm( oot0oltoioeiasfm eauvsnu)arenmociadfmte n ol()tetoxm3iy1am elnvsat)artrxro;o0teeomoeiad mDrm(vo;t0alxnmr3ty1opDr neo ( s2xrxopoo1lmt mnvsa(fartm(moou0aptoifcildlm ulumon() reoxocoy1latrau s;s0s2trir3iodaltnmfvt t s2tmxro;u1teeo fcildfm rmn p t0aleomr3io1fmt luvs () 2tm(m3nydoptnmieils  rtax p;o0aleo feils s2ul(monu)artrmociodlp elnesls s2toxo3ny4am nlnesls sDum(m oo0opto ociysfa ea(ms u) etnmf oadoat  i il()teurxo3io4lp elnvi s a2urump;o4oltomi3ildlmDeln o u0 reoir tatoptraivs ( trurxrpoo4lm  mnei s)aruaxr nt4alx  i3iyslm ulnvpnu4aexrif3iadlm  livilt) 2um(r oy1oltemici t aDurum ou4optoii3iyslm2elumont4 ltoio oatlp raivo;s  2xoir nydopt mivilt)a2umxm oo4ope  oeiasla2umn o;()artrmrcoodomD ln i;s  euo(m3io4ale  neta(  rtrurp;u1aptomoeild aDea(mo u0 exoioctatfa   ivils0trxrxo3iudlpenmiviltf 2tr( p;o0aexo fctadlaDuanvpn()treomr tadoaD au o s texoxopio1oltnmfetlsfsrtr( o;t0aexo fctysls umnmon(4teenmf3iatfp   n i;t0texrxm3nydomtnmfes sf rtr(roou4oexo ieiltlmDua(vo t)areomo3iytlpDrlnvil(0t2xr(o3ny1op  mivs tf 2raur ;t4tptnmieilslm elnvs t) rermfctydopteau s;s) rxoiopou4aptelnvslt) rurum ;t1teen ieiltls el(ms t4 lxrxr oy1omtr n o;s) exo(r3nodap e nci s)arrmxroou4tetomi3ilsfaDrlu snt4tlenio ia1fp raueol(0seurim3no4ol  mnet (farurumonu4oexn iciltlmDeauvs (4 rtoxf tytlaDr n i t  exmxr3oodomeemietl(f rumu onu0oetomiciadfm2em(ms;t4treomr ootfmtr nvsls0setmirpnu1ol e ictltf 2urxm ;u4aexn oeiltfa em( p t4arxnxr oatoate ueolt0srxmxo3ou4olen fvta(fs2urxm no0aetn fetldlsDuanmsnu4 eerxo3iytom e n sls sruoir3nu4lm nmictl(fsDtmxrpou4aetnmo3tadlaDeauvs;u0tetnxf3iydfmtr n s ( setrxr3oo4ol n ivslt)s2taxr ;o4aetnmf3iltfmDrmn pn() rtniocoa1oa eaneolt0seurxmpoodap   feilt  rtmur ou4ale mf3tyslaDumn p u0 lerir3oadlpteauvs;t s2to(o iy4am n neslt)aDrru  ou0tptomociadlmDulnvp;t)aeeoxo3iotfateliei;s) 2uo(m nu1ll elneta(fs2tm( poo0tleo ictydlm2uanvs t4texnio3iatopDr uvol(0trto(o3oydol  lnetl() Dtm(m oo0oexomieildlm2eluvo u0aeerxfciy1lmD lneols)sexoiopiy1lp  lnvtls)srtmxmpnu1tltomfciysls2uanmon()aeeoxo ia1omtelueslt seuo(o oy4amtelnvs (fsDraxrpnu0tlxo ociltlmDeanmo u0alxoxr3oa1om  lueo (  2xmir3iu1amtemiet s)srrr(m oo0aeen feilsfmDemnmonu0altrio3iadlmt aivi s0 etm(m3ou4lltn fcs s) rtmx  ;o0tetoio3iadlm2eanms;(0arxnir3tydfpDelu ols0 rtr(m3oydlleelivtas)s2trx  oo0olx iiciadfa eau o u4tlxomf3io1lm e ueols0seumir iudlm elicil() rtaurpot0alx ioeiytls2eauvo () rxrir3iotfa rlies t) rxoxm3iy4ape lfvs s aDum(  ot4apt ioeiysla eanms;u4 eeoxf3ta1lp  auvolt0t2xoxm3ny1amtelfvtlt s2ta(  no4oeeoifcildfa2ran snt) ltrxr3ootfmteaneo;s s2trxmpiy1llee fvsltfs2uax  ;u4olto fetad sDeln sn()trxnxf totlm e uvs (  rxoxo ny4ale licia(  Drm(ro;o1texnmi3tlsfsDran ont)tlenio iy1fptelneolt  etoxr3nu1lp emfcslsf Dta( pnt0alt ii3tysfmDrlu p;t0 exomr3tadfmDeau s s t2xr(mpiu4am n fvt (fsDtrxm ou0tptn f3ias aDemnvont4trxnxf oo1fp eanvs;s0s2ur(m ny1ap eliesasfa2uaxroot4apxoioeils m2rln ont)tetrif3oy1om   uvo;t seto(o3iy1lpe  iciasf rtrxm no0aeeoifetlsfm em( ont) leoio iodoatrlnvol( srtoio iy1opt  nvs t) rrmum nu0olenif3tltfm um(vpnu4treoiocoo1fa rluvs t teur(r nodam   iesatfs2uaxr ;o0tleo ociys m2uanvo;()arxoxo3to1lpDe n slt)s2uriopoy4lpe  nes sf 2rrurp;o0openmiciatlm uauvonu4trtnircia1oa   n o;t trtoirpiydll n ics ()aDur( p;o4alt  f3ildls ea( s;()altrmr3iytla e ivo;(0 2urio3iu1ol nmietat  2taxmo;u1tpe mociydlsDrlnvs (4 eeomr3todfa elueslt srurxo3ou1lp nlfct s)s2tm( pno0olenmo3ild m eanmp (0 exnio3to1opteluei;t trxr(rpoy1alen fetlsf 2raumpou4ole moeiatlaDrlnvp;t0artrif oatom eliei (  2urxm3nu4lme licsa()srua( pnt0tlxo feilslmDrmnvs (0 lxrxoctytfp eli s s)seumxr iy4oltnmietlsfaDtr(r nt4tpt mociadfs2rm(ms;t4aleoxocta1fpD  iei;t srtmim3oydapte iciat) 2rrxrono1tpx  feiydls um(ms t) renif3tadfp eai o;s0trtmxrpiodal   fvt tfsrtr(rooo0tle mo3tadfa em(vsn(0aetrmfcoadfptr ueol()t2tmxm3nu1ap emieilt  2ta( pot1apt mf3tytlaDua(vs;u) reomo3oatomD lues;t) eumxo iudlp nlicia(f 2ururo;u4olt  oetltfa2ulnmsn(0aeeoiocootlm e nvo t)texo(o3nudop   nvtls sDrr(ront0aex moctyt m2uauvo;u4altrmo3iodlpDranvs;s0sexm(r3oo1ome  fcs t)a2tmumonu4ape mfctlt m2uanvsnu4tetoir3oydfm  ai sls0setrxopio4lm e nciat) 2tmx o;t0aexomociatfs ulnvs t4 renifciydlmDe ieo ( t2toim iu1olteliesl(f Dra(m ;o4tetn iciyd a ra(vo;(4 rerxo3ia1fmD  u sl()srurim no1lmt  neia( aDua( p;t1opeo oetadlaDrmu o (4texrxr3tydlpDr uvs;t  2xm(m nu1apen ictl(  Dtmum nt4alxnmo3iatfmDra(mp t0 renio3ootoptr ivo;s) rxm(m3nu1ll nmnvsa(fsrrrx  ;o0teeoifeilt aDuan o u0arxomr totfmte i s s0trumxopou1lle  nvi (fa2ta(r ;o4tlxn fciaslm2um(vo ()aexoxr ia1fmD aneo;()t2umio iu1lpe lnet (f Dra(r ot4olxoifciasfm ul(mp (4tltrif iatlp rlivo;s  etoxm nu1lpee netat a2tr(mono0tpxo f3iltls rluvs u4tltnif tadla   ueslt  ruoim ny4optnmfciat) Dtr(mp;u4texomfciasfm2ranmsn() lxoxoctydfp   neo;s) rtmxm ny4lmen ivta(  Dumxrpot0optomf3tas a2rm(vp t)alxoxo tatom eanvols0setmiopny4omenlnvsltfarraumpot1optnmf3iysfa emu ont) rxrif oadlptr ivi;(  exm(opoy1op emfesa( s2uauro;o4tpxnmfetlsfa rmu s;()trtoxr oodfmDr ues;s)t2umir oy1omt  ncs sf rrmxr no0apto feiatlm2elumo u4 ltrmr3tadlp  li o;()sruoir3oodop  mfctlt arua(rpnt0olt mieiytla ranmp t) rtoir ia1fm   n s t) 2uoio no4ap  lnesl(f 2ra(mo;t4alxo f3iatlm2ulnvp;t0 lenio iatom rlu s;t) rxrir oy4omee fcsls aDtrx ono1olxomictltfm ean o;t)altnir3oatlpteln ils)s2xoxrpou1lp e netas srtmurpou4apt iociydfa2uanms;(4tetnif todfm   nvo;t0 exm(r oudop  lfvtltf rtax onu4olen oetldfmDum(mp;t)tetrirciadfa e uei;s0tetr(rpoudaltnmfcs ( a2tmxm ot4apeoio3iatlsDulnmo;t4aeenir iytfpD au s s0trxmir iu1lleelfei ()arrm( poo0apxn oeiad m2rlnms;(0arxomr3iydlmtr i i;t0 rxmim3nu4amt mics tf 2uax o;u4aptoioeiadfm ea(msn(4texrxocio1fat aues (0sexr(opnudolen fctas a2trxmo;t0ape  fciysls2el(ms (0arenif ia1om  anvol(0 eurxm nudaleemnci s arraxr ;t1ale mocias m ulumpn()altoir3ty1lm  aueilt texrir3oo1ame lfct s) rua(mono1ope miciaslm rl( o;(0tetrmo ta1fptr ueil()trxrxopiu1lp n ivt tfs2tmxroou1tlxnmiciyslm2el(mp;t)tltnxr iytfa  luvols  2tmim oudaptemfcsltf Dur( pnt1aeeoiietadfsDuluvsnt0aetomo3iotla   u o;s)srtoxr3oo1ale  fvslt) 2trxroot1opxo fciyd a2el(vo;u0 lxrmfciytlatr nvs;s0seuoio3iydalenmncsltfaDrmxmo;o4alto oeiatla eanmp;(4aeeoio3tydlpDe iei s) 2tmxm ny4lm emies s)srtmurp;u1tleomieiasls ean o;t4 lenxf tadfa  lies;s0t2um(m3ny4alt lietls)a2rrxmpoo0tlx mfciyt a ulnmp u4teenifciotla rai ol(0 etmxr3oo1omenmnci (fsrtaxr nu0opxoioctad sDra( s t)trerxoctatopDrauvs t0 rxrim io1ap nmneilt)a2trx pno1tpe ioeiad m2umnvs u4teeoif3todfmt ai o;t s2xm(m3nu1omtemfvias) 2umuro;o0tlx io3iat mDeanvo () rerifctydoaDrlu s;t setmimpno1ome mncslt)srtmxm nu1aexn feildfsDem(vsn(0alenxocio1lpt lnvsls teur(o3ou1lpt lnes s) rrmx  no1tptniietysfa eln snu0aexnmo totlp raieol()s2tmio iy1ap   ncia() Dua(rono0aetnii3tyd a2ua(mon()aetoifciy1la  lnvs t0srum(r3no4ll elnvil(fsDrmx oou4tltoii3iytla2rln onu)tlenxf totfa   nes;t0s2toxmpou1al nmici t)sDurx  ot1opx mf3ildfm uanvs t0 reoircoa1omt  nvo t)s2triopny1lptelfet s)s2rm( p;u0olto o3iadla2rm(msnu4tetoif to1fptrai o t s2xm(m3oudamt  nci sfsrra(r ;u0tlxnio3iaslm2ra(vpnt0trtoirctatoate n sl( setmimpnudlptnlict sfs2ra(m ou4alx iieiadls emu p (0aetrmf iotop ranes;(0s2xmir3oo1lmenlfctatfartmu oou0oet  ociad a2uan ont)tltrxf iodlmDr uvs s0 2urxrpoo1lle liei s)sDraur ;o4alto iciadls uauvo u)tlenir3totla raivo;t trxmxr3iy1ap emicsa(f 2urxr oo4tlxomf3tas s2ean pnt4alerxrctotfm  lnvi s)t2xr(r ny4amt  ivils a2raxmpnu0aptomoeiadfs2um(vsnt0 rxnioctydoa  ln s;s)texrxmpou1lpe  nvi s) rurxmo;o0opt moctadfm2ea(vp (4altnmo3ta1op  lnei s) etrxopiodlpen fvsltfaDtaxm ;o0aetn f3iydlmDrmu p;u)alxomr ia1lmtrau i;s)teuoimpou1amtn ieias sruaxronu1oetn ictld a2rmnmpnt4tlxnxfcto1lm  auvi;t srtoxr3oudom emfvil(  Dtru pnu1tlx  icildlsDua(msn(0teeoxfciydlpDrlivs;t0 euoim io1om nmfeilt a2tmxmpoo4oet  o3iasfa2ran p u0artrio oy1la  lnvs;s0t2xr(r nydol nlnvtat srrmxm ot4alto fcildfs2ul(mp;(4aetoir3oytlaDe ueslt0trurir3iodome mfet tfsDtrur ;t1texo fctydls2uan ont0alermf3tatfat livo ( sexmxm ou4lmtnlnvtlsfsrrr( o;o0tet  oeiatfs2el(vsnu)trxnmr3tydlm r uvsls) 2urir no1amee iesl()aruru p;t0oetoiiciasfs2uln o;u0 lxrmf iydlat ln i;t setrxrpio1lmt lici t sDumx p;u0oexn oeiyd sDrmump u4tltnxo3iodoateau sl()tetr(m3iodlleeliesa(f 2urum no0tleomfeiysfm2ul( p (0 rxoxr ta1lm   nvo;s s2xrxmpoodoltelict ( s2umumont4tpt  fciytfaDrluvp;u4altrxr3oatfm   u sls  2xoimpiy4aptnlnvsasf rtru  oo4opeomoeiatfaDra(vs u)texrir3ia1lptr nvs;t)seumxmpoo1ol elnvilt)aDta(mpnu4alenii3iasfs rln p ()tlxrir3iodop ean sl( seuoir3no1al emietl() Dtrur oo4tlxoiictytfa2umump t0arerir3iy1faD ai o;s srxoirpoo1opeemietl( aDrau ont1teto octyslm2elumo;(4aeerxo iotla elues;s)sexoxm io4ap   fetlt)arrrx  ;t1opt iiciydla ran snt)aetnxfcoydoate ieo s) 2umxm iy4omtnlietlsf rum(r nu1tlx moctld s rmnvpnu4 ltoio3io1laDe nvs s0s2umiopno4lle  nct s a2taxrpno4tpt  f3tys m emu pn() etoir iatomt  nvo;t sexrxo iy4lltnlnvsa(f rrru pnu1apxo i3tadfa eln o t0tlxoifcoatoa  luvilt0 exmiopiudaltnlieilt a2rrum no1aetomf3iydlsDelu s;t0alerxf iytfp e nvs s t
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;t0seuoir3oo4oltnlnetls a2umx pnt4aet  fciltfaDum(vs u4alenio3iodlateluvo () 2uriopou1op elfeta(f Dra( onu0texomoeiyd mDranvs;t0texrxo oadoateaivo;()t2trir oy1alt lfvsls)aDtmur no4tlt mocildlm um( o;(0trerxociatfmDeaies ( teurim ny1op   ici ( s2ur(rp;o4oee  f3iytfa um(ms;(4tltrxf3to1lpD  nvi;s sexo(mpny1ll emietat)a2rax  ou1tet  fetytfa2ra( o;t) rxrxr oy1faD  uvo s0teurir3nu4al  lncsa( s2trumooo1tpe  octyd s el( s;()texnif3iy1fmtraivsl( teto(opno1ll   nes s  2uau ooo4apxniieiltla elnmp u)arxnifcoadfat anvi s teuoio3oo4omenlnes t)s2ra(rp;o1olen fcildlsDuau p;u4altomf3tydlmt lnvs;(0srumir oodopeemfvta( a2ra(m ;u4apxomfetldfs2rlums t4aexoxfcio1opt lnvi s0s2xrimpio4opt  ici t  rtrumpnt1aetnmfcildla uanvp t0 leoio3oodlatrau sl(0tetmxo ny4lmeemivt t)srumxroot1alx  fciadfmDuanmp ()alermf3io1fptr u olt0 2umiopou1ape  nvi (fa2rmu p;t0tptoioctltfaDrlnmpnu4 rtrifcoytoptraieo (  2xr(m oydome lfes () Dururpnt1apxnmieiadfaDeln o (4 ltrmrcoa1fm ran i t  rumim oy4ap   ncilt sDtm(mpnu4aexo o3iyd m2rm(mp (0arenmr3oa1om raues ()t2toimpoo4lpt lfvs s  rtmxmoou0aetn octadlm2eauvs t4 etoio3ta1oa rluvils trxmir oudomee nct (fsDtmur ot4tetniiciydfsDumu snt4alxomr oydfaD  nvils0setmxm3iy4lpenmfcs s sDuaxrp;u0tlx ifcildfs rmuvs (4artrxf3ootlaDrliesls0seurxo3nodom  mietat s2tm(rp;o4oexomfctldfsDean s;u4trxnmocto1oaDrliei;t0s2xr(r3ny1aptnmfei t)aDra(r ;o4oeeomfcild m2ul(vsnt0 rtnmfctotlpD lnei;t0sruoio3oodal nlncsa( a2rr(rp;t1tpt  fciyd sDumnvpnu)aeeomrcia1fmt ln s;()s2to(rpoo4lm   ics (f 2tr(rono1tlxn o3ilsfaDranvs t0texnmf3todlmDr neolt) eurir3no1op  lnesasf 2umxrono1olt iiciyd aDeln o;u0artomf io1oa  an o;() rtm(m3nudal  liesa(  Dum(mont0oexnmociyslsDem(ms;t)trtnif3iytfmDrluvs;s0t2urxo ou4lp  lfvi t aDtmurpnu1aptnmieiad a2ran s t) lenmfcoy1omD  uvo s  rum(mpio4lmt  fcsa(fa2umxr ;u4oetnifetatfs2rmnvp;t0altomfctadoatrli ils)trxo(rpoo1omt  fvt sf Dtru poo4apen icias m ulumo;(0tlenxfcoa1op   i o t0teto(r3iodlm n ncsl(fsDrrxront0oee micild m emnvs ()altoxf iodlm elivols t2xoirpou4ape lfvsls srurxmpoo0tpe  oeiatls2rluvp;(4trtomr3ty1opt auvols0srumxr3io4lmeelncs (f rua( oot0ole mfeilsfsDeauvsnu0arxoir3tydlpDrlivi t sexo(mpiy4lpt lfet s aDtr( onu4olt iociydlaDemnmsnt0arxrmo3oatomte uvi;() 2uoirpio1omtn fcilt)sDuaxmono0oltomo3ils s2eaump t)artrmf ty1fat  nei s0trxrxrpno4lmt mieta()aDtax  nt1aex ifcildla2rlnmp;u0arenxoctotopD  nvi t  rtoir oo1ame lncsls arua(r ;u4tpx ioeiydlmDrmnmsnt0trenxrcootlmD au ilt0sexrxo iy4lpt mivtatfa2rmum ;t1olenmo3ilt s ra(vsnt)texoxr iotoa r i s;t s2xrxo3oo1oltn fvsa() 2um(mpot1altnmo3tydls ulnvo;t0arerxf ootla r ies s0texrio no1oltelfvtlt aDur(m oo4openmieiatla2ran o;u) eerxo oy1oa e ueo t0tetrxr3ny1lp nlivtltfarta(monu0oltniociytfs2uau s;t4trtrio oodlptraiesls)t2xmio iy1aptelnesat)s2um(rpot4optn fetytfs2uaumsnt0texnmfciotfpt anes s0srxoxr iy1lp n ictlt)aDtru pou1aeen o3iltfm ulnvo t) rxoxr3io1omt lies;t seurxr iu1op n fvilsfarua(m ;o1tex iiciytlmDulnmpnu) etnxf iotlm rlnvs s) rum(rpiu4llee fcslsfa2umumo;t0alxomi3iadfs2rln on(4arxrir oadomD an i;s0tetmio nodapee fci () 2uaurpnt1openiociltfsDemn s t4tetriocoy1lptr uei t)tetmxr3nydapeemnci t) 2uaxm nu1tex  ieiasfs2eaumo;t0trxomfciydfp eli ilt0 rxmiopoo4lp nlfet ( s2tmu p;o1tetniiciasfs2emnmpnu)trxnxrciatlp rlivo s  rumxr3oydlmte fvtltfsrrmuro;u4tlto i3iydfs2rl( o;() leomo3ta1fm e uvsl(0 rtmxr3nu4ape lieiat)a2uru  ;o4tlt  oetatfsDuau p;t) renmr3oa1optr ivi;(0srxrxopnu1opt livia( s2urxrp;t4oexoio3iltla rlu o ()arenxoctydfpD  ues;s0 rxmim oy1lmen neias)a2ta(rooo4tetoioetad m2elnvo;u0 lxrio3tadomDeaiesls0 rtmxm io1olenmfes () Dtru ooo1aexo fciaslsDrl( p u)trtoio tatlaDe n s;s) rtrxm3io1omtn fvil( a2ua( ont1tet  fcilt m eluvsnu0altoxfctodlatrauesl()t2uoir io1om nlfvs tf rum(mo;o4aexo fcildlmDem(mo;u0tltomfctatlpDrli o;t  rtoxr3iu1lleemicia()sruaurpot1oleniicils mDrluvp (0alermfciy1faDrlu o s0s2urir iu4ome  fvsl() rtax pnu0teeomietasls elnmp;t4arenxo3iy1lpD lneilt  exrxopio4apee feia() Dumumono4tee  ieiyt a rlnvp u0aetniocoa1laDeluvi;(0trur(r3iu4ameelicsat) rumxmpou1opxnif3iltfmDemump;u4 exnmfciydla raivi s  exr(m io1opt liviat s2uaurpnt1texnii3ild aDum( o t0 ltoifctadfp   ivi t0t2triopnodlpe mfct ( sDtmu  ot4tlx mieiydlsDranmpnu0arerxoctydlpDeln s s srxoim oy1lmtnmfvslt s2rmx  nt0tpx  f3ilsfaDumump (0 leomr iytfmDr u il(0 exrim nu4lle livsls arrm(rp;u1tpe moctls a2rmu s;u4tltoxocoydfptrau ils) rtmxr oy4apenlfvia(fs2rr(  oo1alen ietyt a2eanmo;(4 etrifcoo1faD anvs s)setrxm3iy1ap  licsasfa2truront0olenmf3iytls2emnms u4 lxrmf oy1lpteli o t)trumxm nudal  lfvsasfaDumxmpnu4texoioeias m2emu pnu4 ltrxocoy1fmtrlivilt0t2trxo3iy1lle lnvslt sDtrx p;u4optomoctad m elnvp t)tltnxr3oa1fmDe u s (0t2trxr ny4apenmneta(f 2uau  ;t0apen ieiytfa2rauvs;u)tetnxf iatfp r nvi;(0trxm(r ny4op elfcsa(fa2ua(rpou1olenifeiysfa emu p u4 ltnmrciatoatrln i;t)srxrim3ny4ap nlfvsa()a2rrur nt1aet io3iltla umu pn()aeenxociotlate uei;(0teumxopny4oleemncta(fa2tru  oo1oetoioctysls2uanmp;() lxrio3iotlp eau ilt)s2xmiopoodol  lfcils a2tm(ro;u4texo feiltlm el(msn() ltoif oa1fpteaues;s) rxoxopno1am  lfesas  Dta(r nt0oeeo f3tadfm2rmn s (0 lenmo iotopt auvi t)t2xoim no1ope mfcs t)sDuaxrpot4oexomf3iydla rlu p t4 rxoxr3iydlpDraivi ( trtoim nodope mfvias)a2um( poo4tle mociytfa rlnmp t4altnxrciydfm rlu i (0truo(r iy4lme  feilt  rumx  nt0optnioeiysfs2ranvon(0 etrirctatoa   ieols0t2tr(o nydop n fvtasfsrur(  no0altniieiatlm2raumon(4aetnmf3iodoa eaueo;(0s2uoxr oy4llenmneiltfsrum( p;u1apt mfeils a ua( s;u4teeoirciatopt livil(  euo(o ny1llenmfei () 2ta(rpnt4aeeo f3iatlmDraump u4tltrif3tadomDrai o s t2urirpny4ameemicslsf Draumont1altoii3iasla emnmpnt)texnio oo1laD aneo;(  exrxo3oy1lme mneilt)sDuau  ot4alxnmieiydfs2emuvs u)alenif3tatlatrli o;(  rum(o3oudalt mfvtl( sDrm(r ;u1aptnmfciytfs ea( o;u0tetrircoy1lpt aivs;s sruoimpoy4olee nvta() 2rru ono1oeeomi3ildlmDuanvs;u)alerio3ty1opDeaies;(  etmxr3io1lmte ivi sfa2ra(monu1oleo oeiytfmDuauvo;t) rtnmo3iydomt au i ( seum(opiy4lltemfct s arra( onu0oltoii3iydls ulump ()aleomfciydoatr ues (  eum(o ny4amte netas sDra( oot4opxo i3tyd s um(vo;(0tltnmo3tatoaDraieo s0 rur(o iu4ap n fci sfs2ta(  nu4ope io3iytfa um(vp u)trxnio oatopDrauvols)srto(r nu1lp e ivsl(f Dtm(m ou4tex  i3iad m2em(mont0aeeomfciodfate neo s) rurir3iu1lmee iesat arurx ooo0tpe  feiadfs2rmnvpnu0 ltoio iydfmt aueol( trxmir3oo4om e ncs ( aDraxm ot0tltoii3iadfs ua( onu4aetnio ia1fm r u i;s)srtm(r nydlp n fcs tfa2uaxmp;o1olx ii3ilsla2ea(mp;u) lermrcoa1om e ivols)s2xrxr3nu4apt lfvtl(  2raxm ou0tlx  feiyt a umnvon(0tltrio3iytfaDraivsl( srxrxm3nodaleelfci ()aDurx ooo0alt if3iysfaDemuvsnt4aleoif3iytopDe ueils0 2tmxo3io4am  lnvil( srum(r oo0ape ifcils aDem(vp t4artrmr tytfaDr i olt  exmim3ny1ope  ivilt)srrmu pnt4apen feild a umn o t)alermf iotoa r ues;s trxo(opno1opeemfvs ( srrauroou4tee ifetltlaDem(vs () lxrmf ta1fm e ivi;(0s2urim oo4olte feils) Dtm( oou1aee iiciatfm2ea(vo;t4texomociotfmDr nvs;s0 2xoxmpnu4ale mfvt s sDur( ont0tltn fetadls2rmu o;u4tltnmo3to1lpteai sls0srxr(r iu1lm emnvtas sDumur nu1alt ifcildfa2rauvont4trxnmo3ty1lmDe u i;t)t2um(opio1ol e ivtlsfsDta(mo;t4apt mfeiadfsDeluvs;(4aexomr iotfmD auvo s0trxrir nu1llenmnctasf rua(m ot1aexnmfeiadfa ulumo (0teenif3io1fa eanes ()seurxmpou1apee ivt (f Drmx  ot1tlx  oetyt aDra(mp t0 ltoxr3ty1lm   neilt0setmxo3oudlp   ivslt) 2tm(r ;u1apxo octldlm2uluvs u4aexomf oydlp elnes s)t2tmxr oydom  lfesls) 2uru o;t4aeto o3ildlsDum( p;t4 ltoxr3oa1lptrlivsl(  2xrxo3nodlp  lfes ()s2urump;o4opeomi3ilt sDrmuvp u4altrmrcootlpD  ivs;s)seumio3oodolt  nciat  rur( onu4aet iicils sDulnvs;u4 ltnmf3tytomte ues s)seuoxrpnudll  mnes s  rurxm no1aee mfciytlm rmums t0 etnmfctotfpD lu i () 2tmio3iu1olt  fviat  Dtrxr ot0texomoeildfs ranmsnu4 rerirciatlmtrlu i t) rxo(m3nudam n neia(fa2tax pnu1tlen iciltfs2ra(vp u4aexnxf3iatlmDe ivsl(  2to(r3no1lltnmici s  Dra(m oo1oeeo o3tas aDumn o;u0trerxrciotfpt  n sl()setoxrpiy1am  lfcslt s2trxmpou4alx  f3iasfa2eanmo t4 exniociotfat  ivs t0trxm(r3oudole mfcsasfsrtm(mpno0aptoifetysfa elnmo u0 leomfciydfa rlnvo;() rtmio iydlmtnmnctasfs2trx o;u0oet  icils mDrlu o u4tltrxfcoo1fatrlieil(0 2xrxr oo1lp n nvils s2rr(m ot0oet ii3iydfm umnmp (0alxomf iodlm  aivils  2toim iodop nmnesat  rraxm no1aee mi3iytla2rlnmo (4 lxrmrciy1fa e ueolt) rurxo iu1lp nlnvtl(f rurxrpou1tpt ioctlsfm2ean o t) eenxr3tatfatranvs s)teumio oudap emneil(fsrraxrpno1oex iietad mDrlumpnt4 rtnio3iy1opDeln i s t2urimpnu4opeemfesl()sDuaxront0alto ietytlm rmu pnu0artrxo oytfm rlneil()t2trirpnudamte ictl( s2rr(r no1ope iieiltfm2um(vo;t0trenio to1lpt auvs t0 rxmir ou1lmt mfciltfs2uau  ot1texnmi3ils aDulu pn() lenxf3oydlmtelieilt0seurxrpoy4ap  mncsas arrr( p;o0optnii3iaslaDeluvo t0teeniocoo1fmtrln s;(0trumxo3oy4lm e fvs s)sDtr(m ;t0teeo ocild s2ran s;(0arxrif3oydlpDelnes;t0srtr(m iu1aptnmfcsas)artr(  ;t0teeo o3tydlmDrl(mont0 ltnir oytla  lues t0 2uoir oudlmenmieia(  rumu p;t1oltoiictyt aDulnmp u0aetoiocootfmDraivo;(  rxoxm3nydalenlfvs s) Dtmx  ot0tpe  ocildla2eanmsnt)alxomo tytfa eli slt)srur(o3nu4ll emieias) ruau  ;o0aptomieiadfmDranms;t)trtnio3iotfmtrli o;t0 etoxopoodape  nvi () rtr( poo0openioeiadla el( s;u4 lxoifctotfmDeaivols  rxoio3oo1amtn fcslsfarumu ono1tpxniiciatfs ra(mp;(4tleoifcio1lm r ivsls0sexm(m3nydlp  lnct ()srrrum no4tex moeiyd sDelu o u) ltrmr3iatfm r nesls)setm(o3ou1apt mnesasfsDtm(m ;t1tlxnmoeiysfs elnvp;t4altomf3oo1om  aieo;s)t2umxrpno1ome lneias)srtaxmp;t1oeeoiietldfaDeluvpnt4 rtrxo ootfpt lieols)tetrirpiodllen ivilt)aDtauro;u4oex  ociadla eln sn()aetnio3oydomD li o t0 2tmxo iodlme lfeilt)sDrmx  ;u4alt if3tadlm em( o (4alxnmo iy1fatrln sls texo(r oodal  mnci (fa2raxmp;o0tleomoctlsla2uanmonu0tlxrxr todomtrlues t texr(r iodlm nmivs ( arta(rpoo1teeo o3tat sDrmn o;t)areoif3oatoat lues t0trxrxopou4omt  fciat  2ururpno1apxn i3tadfsDra(mp;u0 lxoxo3oytoptelu i (0 2tmir nydlmt mnes ()arur( poo1tpt io3tas s2rm(msn(0 eeomrctotfpt  ivi t t2urxr oy1lptelivi t  Dua(mpoo4oleoioctlt m rm(von(4trenxo3iy1lp elnvi (  2xr(mpny1om elicil(f 2rrurp;u0opxomfeiysfm2elnvo;(4 exnmr ty1omD  ueo;s sexmxo3nu4op  lfvi (faDtmump;o1aet  iciyd mDraump;t0arenif3oydfatrlu o;t seuoxm oy4aptemics t sDtaum oo0tle  feiaslsDemuvo;t0arxnio3oa1fpt  u slt)tetm(o iydolenmies tfs2tmxront4tptnioctydfm2rlnvsn(4 lermf oatfa rliei;t)s2umxm ny4ol  mics t) Duaum ou0oetn o3tat s2uauvs;(0trtoxo oa1oatr ues;()seuoxo iydamte fctas) Drmx  no4tleo icildlm rmu s;t0aeeoifctytlaD  ivs;s t2xriopiy4lme  iesas  Drr(monu1apeoifetysfs2umnmon(4 renmr3oadfm  lies ()t2xrxo3no1lm nlnctatfs2raxr oo0tpxnifctatfm elnmo;t4alxomr oa1fmt li olt t2xo(m ou4lpe lict t) Dtmx p;o4aexomietlt s rmn p t0 rxomf3oytlpt aueols) eumxopio1lmt mfcslt a2ua(rpoo4tex  ietls aDrmnvo u4artrmr tydlmteauesls)t2tmim ou4omt lnesat)s2rruroou0oexn i3tad m2emn p t4 rxrxr todlmtrlieil(0 2tmir nu1alt  ivias)s2rr(mpou0oexn oeiydlaDrmnmo;t)areomfctadoa   nvols0seumxmpoo4lmtelnciasf Dtmxmonu4tltnio3iadfs eln o;u4aetnmfcoy1op rlieolt0srxmim oy4openlieia()sDur( onu0tpxniiciys m uanmo t4tlxnmr3oydfateaiei;s)seuoiopnodlm   iei s)s2rr( pnu4opxnmf3iasfs elnmp u0altoif iytom   nvo s t2toio3iydop e iesls)aDuau  nt0oeeoifctyt s rauvo u)aetoir oo1lmt luvs;(0s2xoxm3no4lp  lieslt)sDrm(rooo0aetnmieiyd a eanvs;u) eeomo3ty1oatrlieslt) 2tr(mpoydol n ncsat a2raxr no1aee mfctld sDea(vo () etomf3tytlmt  nes t)s2umio3io4op  mneias a2um(rooo1opeo f3iad a rmn ont)altrxoctodfaDr ivils)s2ur(m3ny1omt licsl()aDraxrono0alxo f3iydfm2ua(ms (4 rxomr3tadoa   ivo t trxrxrpno4olte icil()arrm(mpnu1tle  f3tatls2ra(mp u)trtnirctydlp eai il(0t2trim3no1lm nlnvta()srtaxrooo0ole iieils s um(monu) rxnmr ia1fpDrai sls0 rum(mpno1am e netl() 2rrur no1ape  o3iadfa eanmo u0tlenmf3iy1oa e n o () eurimpoydol n nvt tfs2raxrooo1tltnmoeilsfs rmu p;t4aetomfcoodoat aivols s2tm(r3oy1al   nvi t aruru  no1oeto i3iytfaDean s;u)aexrmr3iydomDr nvo;t)setr(o3oy4al e fcsatf rtauro;t0tptoif3iysfm2ean s;(0tlxnxrctodomtelu i;s0t2uoim3nu4ol nmnes (f rrmxmp;u4teenifetysfs emu snt)tlxnmo3iodoateaivi;t seuoxo nudom  lietlt  2rmu  nt1alxn octydfm elnvo u0aexrmo oydlaDelnvo s)t2tr(rpnodlpee nei (  Drax p;u4oetnmi3iytfm umuvo;t4altoifcio1laDrlnvi;s  rumim3oudaptnlivt (fa2rmxrpnt4tlenmf3iasfa el( s u) ltoiocoa1fpt luvil( t2tmimpio1apt  ieilt) Dumxr ;t4olenmicildfa2el(vpnu0trtrxfcoydlpteluei s0setr(r iy1lltelneil( a2tm(r ;t0tpx mictlsfm uln p;u4alxnio3iydomtrauei (  2umxrpiu4oltnmnvi ( aDrmu  ot4aleoiieiyd s uln s;() exoir io1op r u ol() exrxo oudlp nlfvt t)sDrm(rp;u1apxnif3tad sDumumsn()artrmf3ta1fatraivol() rxmxo iu4ap  mnci (f 2ta(monu4oeto fcils m ul( sn(4teeriocoytoaD  ivi t0truoxr io4lpee ietl(fs2um(rp;t1tlx iietyslmDumu sn()arxoiocoa1oat  iei;s)trtmxrpoydol nlfciat  Dur(root0olen ictadfm2uau p t0trenmrcta1lmDraivilt0t2xoxr oodll  micsa()srta(mpnu1ole moctlt a2el(vs;(4trenif3tytfp eliei s srtrxo oodlmtemfvias) rua(  nt4tlenmfeildla2el(ms u) lenxo3tatomtrlu o t srtm(o3ou4llt  iei sfsDrm(rp;o1ape  ieiysfa rm(msnt0trtrmr iydlateln o ()srxoiopnu1am  mict s)aDur(m ;t0tpeomfetasfs uln pnt4 rxrxociatla ranvi t)t2umxm3oo4ope  netl()srtmx pno4oltn ociatfm2ea(vonu)alxnmrcia1lm  anvi;t) etoxm io4lpe mnvi ()s2umx p;u0opt  ociysfa2rlnvo;t) rtoiocoydfmDr uei;(0setoim iu1omtelnvs s arumurono4oee iieiatfmDrau s;u0tltrio3oodlp raivo;( s2um(r io4lpen fvs (  rrrumonu0apxn i3tyt m2rln sn()alenxr iytoa r i s;t) exr(r oudomeelncs ()s2tau  ;t4aee  f3ilsfa2eau on(0 eenmf3iydlmt  ueo ()t2xmxrpio4lptemnvtls  2ta( ont4texnioeiydfm2emnvp t0texnifciadfpD lieo;s0srtm(o oo1ap   ncs t) rrmxm oo0opeo i3tlsfm2rlnmpnt0 eeomr totla e ieo;t  etmimpiy4lpe lietls a2ra(mono0tlxnmi3tyd aDean pn()trerxr oytfmtr iei s s2xr(opno4aptnmici t  ruax  ;u0tle  fetad m2rlu p;t4 etrmrctatomDelivolt)s2uoir3io1lltemfcils  2ua(  nu0olto o3tltls2eaumont4alenxr to1fm elnei;( trtrxo nudlmenmnvtls) Drmumo;t1tle mieilt sDem(mpnu0arxnxf3totfp raivol(  rxo(m3oodamtnmfct (fsrur(rpoo4opx mociad m2eanmon()trxrxrciodomteauei t0texoir3oo1ll nlici () Drrxroou1aex iietatfs2rmn pnu4trxrir iy1faDrai s ( setm(m nodap n netlt)srrmx  nu1oltomfeiysfsDrmuvo;u4 eerifctytfat luvilt0srxm(m oo4omtn icilt a2tau o;o1tlx  o3tyd s2ea(mo u)tltrxfcoodoptelivo;t0t2xmirpiy1ol e ici s  2raxmpno4tet mi3iadfmDea(vpn(4alxnir3to1la eaies;t0trtrxm3iodll n fvias)aDta( p;t1oltnii3iadla2rluvp;(4 rxrifcoatlm rlu sl(0s2ur(m oo4amt  fesl() Dtru pot4aetnif3iyt aDem(vonu0altoxfcty1op rlnei ()teum(r3oo1lp  lfvsas)sDtaurp;u4tex  ieiatls2rmnvp;t0 exnmrctydoptrli il()teum(opou1lm elfesa() rtm( pno4tpenmieilsfsDemnmp;(4alenxfcoodomtranes s)trumirpiydomte ivsatfsrrr(r nt0aleoii3iad s2emums;u)aexoxo oy1lm rln s s)t2um(m3iydlpeemieta( a2uaumpou4aptoii3ildlm2umnmo ()teermo iatoat aneol(  2xoimpiu4om elfcia()srumu o;t1aleoio3tls aDulu p;t)teerio tytla ranvo t) eur(r3iy4olenlivtlsfsrrrxr ;u4apt mictytlm el(vp u4trxrir iatfpteanvo t srtmxo3iudop e feslt s2rr( ont1oexomfeiyd s2uanmp u0texnircta1fpt  ueslt) rxoxo oy1llenlnvsas)srtru poo0aet ii3tysfa rm(mo;u)alxnxr3ia1opDraivs ( s2xmxr3iudal nmnei s)a2uax p;u0teeomoeiat a eau s ()tlerxrciytfat  neil(0setr(o iudaltnmnesas sDraumpot0texomo3tltfs emnvs;t0 lxrio tatlat  ivo (0trto(mpnu4ome  fesas)sDum(r oo1aex  ieilsfm rmu ont0aeermociy1fm e nvs s) 2trxo oydamt lfvs sf Drax pno4alxnifetls a2eauvp t)arxoir ty1fp rlu o s srxrxm3iudope mieia()srtmx  ;o4apenii3iytfs2ulu o;(0teerioctatlaDeai ilt  rum(o oo4ale mfciltfsrtru onu0tpenifctat a um( p;(0tltomrciadfmte u il(0trtr(r nydoleemnvtl()a2umxmpoo0apt  ocias mDea(vp;t4 rxoif3iydlm e u s;s)trtoir3oo4oltemicilt a2uax onu1altoiociadlaDulump;u) exoxf ta1opDe ivo t  rurimpnudaleelietat arurx ono0tpxomf3iltla rl(ms u4alenxociadfa e nvsl()s2xo(m nu4om  mfvils)srtmuroot1oltnifetlsfm2uan p;() exnxr tatfmD liei ( trtrxmpny1am nlncils)s2ua( pou0texoifeiytfm2elump;t) ltomf iadfp   uvo t0 rtmiopiudapenmfes s  rrrx pot4aet ioctyslm2raumpnu0trermfctotfa   nei t0trtr(rpiu4optemieiasfaDurumont1apxn f3iyslaDrmuvsnt) eerifcoo1omDe ivo;()sruo(m3oudalt licta(fsrumxmp;t0olx  i3iydfs rmu s;u4alxrmr tadfmt aneo;(0teuoxrpoo1lm emneta(  2taxmo;u4olxomociasfaDrmumsnu4tetrxo3iodfm r ueo s srto(m3ou1al  liesatfsDurx  ;o1alxo oeias m rln on(4trtrmfctadfmte n sls t2xmxopnu4optelfei s) Duax ooo4tpen f3ilslm2ranms (4 rxrxocoadomteaneo;t teur(m3oo1olt mfvs t) Durxmoot1tlxomieiat m2elumon(4aexnifcoy1fpD  ueil( sexmio3ny1al n fcsat  rtrumpnt0tpto ieiatfs eanmp;u)teermr3oytfpt  u s;s  rxm(r oo4amte ici sfa2tauro;o0olxnifciatfa emn o u)trtnio3io1oaDr ivi (0srxr(opio4altemicsltf 2uaum ;u4apxomo3iydfm2ranmo (0artrxr3oatopte nvi () etmio3nu1am elfetatfsDtruro;o0ape ifeildfs2rmnmp;()alxrmr3ootfa rlueo;s trur(opiy1omee fct ()srtmxrooo0oeto iciytfmDuan s (0arenmr oy1lmDrli s ()trxr(r3oo4open icias a2ua( poo0oex  octltlm eluvs;t0alenif3ta1optr iei s0s2xmir iu1ap  lnvilt) Drrur ;t4aeenmieildla ra( p (4 lxrxfcio1lp raueilt0srxrxmpoy4opeemivsas  Drax p;u4oeeo fcilt mDelumpnu)trxnxfciydla eanes;(0 exo(r iy1ap n fetat aDtaum nt1oeeo o3tysla ea( o ()artrmo ta1oaDrli i;(0teto(o iu1lleemfetasfa2urxmooo1alxoiictadfs2uauvpnt)tlxrxfctytla   ieol(0tetoxopny4oleelfei sf Dumumont0tpxnmfeiadlmDemuvo t)tlxnmr tadomDe uvi;t trtoxrpou1lmee ivslt)s2urxro;t1aexnmf3ilslsDuanvp;(4artrmf3iytomtrlies t t2xmir3iudome mies () Dua( oot1altoiicilt mDeauvo (0aexoxo3oydlp elies s teumxo3ny4alenmnvsas sDum(rono1aexomfeiydlsDuln p;u)aeermfctotfpD luvi;s)texrxo3oydlp nlfei ( srumxrp;t0tee ifeiyt aDelnms;() rermrcoa1om rluvi;(0 2xmxo3iu4amenmnvslsf 2taurooo1alxoioeiyd m2ulu snu0 lxoir iotopD aneilt)trtmxrpio1lle mies (  2trx  ;t1tee mo3tydlsDra( snt4aleoxr totop eauvo;s)trtrxopoodlm   ncil(fsrurx  ;u1oexn i3ild m raump;t) lxnmf ia1omDr nvi s)s2urir3iy4alenmfct sf Dra(ronu1tpx  o3iydla2rlu o t4 eermo to1laD  n s t)trurxm3iu4olte fvs s)sDrmurpnu4texomociyslsDum( p (0 lermo tytlmDelu i t0setr(r iy4om   fei t  Drauronu4oeen octaslmDemums;t4 reoxrcootoa  an o ( trtrxrpoudlmt mfcs ()aDtrx pnu4aptomo3iysfs2rmn o;(4aetnxf tytomDr ivs;()texm(o3iy4ap n ivsl()srumxro;u4opt  oeiadfs2eanvs t0arxrifcoa1oaD ln i;s)tetoirpnu4lmee icta(  Dtmu p;o0tetomoetlsfm2ean p t4 exnif iy1fat lieo;(0 eto(opoy1am  mnei t  2tax o;u4altoiiciaslm2rmumsnt4 exnxociy1la r i i;s0 eurxmpiu4omtn ivia(f 2rmxrpno0tee moeiyd aDra(vsn(4trxnxf oatlpteli o (0texoim nydom  liei t srumur ot4tltomoetad aDrmu p u)trtnmociotfateanvsls0 2tmio iydopeemfei sf rtrx  oo4open ieiyd a2rlumsn(4 rerxfcoo1fp elieols0setrxo iu1al e ncia() 2rr(rpno1apeomietldla2ranmo u0 rtrxo3iadfmDe uvi;(0seum(rpio1ome lict tf 2ur( pnu0aleomf3iltla2ea(vsnu0 lenio oatlmDr uvsl(0 rxmiopio4omt mfviat)a2uauro;t4apeomi3iydfsDeln ont)altoxf3oydfpDr ies t texoim3nodal nlivtas s2tmur ou1tpxnmf3iadfm ra( p;u4arxoif iadomte neo t0 2tmiopoy1lleemivi (fs2umump;u0tetnmfeiadfa2rluvs u4aexrmociadoa elnei;t srtmxm io1llt licsas)aDra(rpoo0olx mi3iydla elumo ()trtnio oydlpD aivils)srxrxopnydlmtnmiciltfaDtmxm ;o4aee  oeilt m rlnmp;t0 exomrctodfpteluvolt)t2xo(mpiudameemfvtltfsrtrumpnt0tpeniieiyslm umuvsnt4 etoioctotfpte n i;t0 exrxo oo1op n fvs (fsDuaxm ot0tlenif3ildlaDrm(von(4 renmo3oytomDrau sl()trumio iu4altn ietls)s2umxmont0opto f3ild s rm(vs t)trxnmfciytlmt lu s t t2urimpoy1altelivia()sDtaxrpou1aetnmoeildfm em(vs;u)aetrir3ia1la  anes;t)texoimpnu4lp   fcsat  Duaur oo1tlt  ociydlaDuanvs;u4artnif oy1la e ueol( srto(opno4olee icia() rurxmooo4tlt io3iatfmDrm( o;u0 eeoio3iotlptrlneils texrxo iy1amt micilsf rrau  nu0apxnmfcildfm ea( o;u) eermo3iodfmDr neo ( sexrxm nydlleelnvsl()aDrrx o;u1ape mociadfa2el(vp;u0 eenio iodfp e uesl(0 rxrxrpiu4ape lfcs ()sDrmxrpno4oexoifeilt mDrluvpn(0altnif tytfmDe ivs ( s2xmimpiy4ll emnvi t) rta(mo;o4openioetlt a eanmo t4aeenio3tydfa elneol()srxm(o iodamtelfcs () 2tmx  no1texn ietadfa rmnmp t0 lxoio ta1omDeli i;s  rtr(m3oy4ap  lieslsf Durxr ot4oeeoioeiaslaDelnvp u4artnmf tatom   i olt)t2uo(o no4lme lfetltfartmurpnt1oetoio3tlt m2umums u) rtrxo io1lmDraieo;t)trxo(o nodlmtnmfvsasfs2raxmp;u1oetomi3iydlsDeln pnu0tetnmr3ty1lpt lu ols) 2tmxo iu4aptnmiet s) Drrx p;t1openii3ilt m umuvsnt4 lxrmo iodla rauei s0 exm(r nydolenmnctl(f rurx  ;o0aptomf3tyslmDrmumpnt) etoif tadlaDelneo;t0t2umxmpnodlmt lnctl(f 2ur( oot0aleomfeiadlsDranvo t0aexnmf ty1om e uvol(0setm(o3nudaptnlivsl(fsrta(  nu1apxnmoctldlm uan p;(4tlxoxfctydfat anes s0s2xr(o ou4alenmfes t s2tr(  ;t0ale mfciyslm2eau o (0texrxo3tytfa elueo t)srxo(m nu4omt lfeslt  rtrx  oo0optn o3ilsla uluvs u)teermf iotop e ieo ( setoxopny4ame lieslt) Drm( p;u1olt  o3ildfm2rmnvsn(4tetrxo3oytlat  uvi s)s2xrxopoy1am elnetat)aDtm(r ot0texoioetaslmDulu o;u) rxrmr3iotlmte ieilt)srtmim3iydop n iet t  2trxm ot0alto f3iadls ua(msn(0arxnifctatfmtrluvil(  eurxrpiydlptnlfetat srurxr ;t4tptn f3tasls ean snu0 reoxr3io1oatran i s seuoim3nu4altnmieiasfsDrru pno4tex iictatfs2ua( o t4 lermf to1lpDeluvs s0 exm(o no4lp n iei (fsDraump;u1oleoifcilslm2rauvp;t) eenifcio1la e n o;s s2xmxr3ou4ll  mfesl(f 2ur(rp;t1tltoioeiltls eaumo;t0 etoifciydlp   ueo;(  rurio3oo1ap nmivilsf 2ra(ro;t0tpx ifeild aDrl( p u4aexoxfcto1fpteanesls srur(m ou4am elfvsat) Draurpou4aleniiciadfs2elnvs;u4alenmo3ta1opDr n o s s2umxr iodol nmics s aDrru ont4oee io3iltfmDulumo (0 eenmf3totfat  ieol(  eum(opno4lptn fviatf 2taxront1olxnio3tyt a2umu pnt0aleoir3oodfpDe ueo;s srxr(o oo4altn nctl( a2trxmont1tltnmi3iys a emumpnu0tetrxr3tydlp e i i;t)sexrim iy4aptelicias)sDtr(rooo1tltoio3iatfs ea(vo t4arxnxocio1lp  luvol(0t2xoxrpiu4al n fetat  2uaxr ot1alt io3ilt s2umnmo;(4areoioctatfpDraueol()trtrxm3iydlmee fcsat)aDururo;o1tleomoctadfsDem( pnt4aeeoxo oydla eln s t0sexmim3io1amenmfes tfsrum(mpot1ope mictadfm ra( o;(0artoxrciytoatrli olt0t2trxopou1llenmicil( s2raxr ;t0oltnmictyt s2eauvp;(0tltoxfcoo1opD  nesl(  rtoxo3io4op e fesas)arua(  nu1apt ifciat s rlnvp (4tltoif ia1lpDe iei;t0 rxr(rpoo1lmee netas  2ra(moot0apxomi3tltfm ulu p;(4trtrxfciotla eai o s) euo(o nudal  mnvils aDtmuroou1teeoio3tydfs um( pnu0trxnir3iydop raivs s0seuriopnu1opeelnetas)sDraxmpnt4oet  fciydfaDrmuvp u)altrxr3ia1fp  aies;s0trtrxo iodamt  fctl() 2ur( poo0alxn ieias mDumn o (0treoio3iytfa e uvi t) 2to(opoodolt  nvi s srumu ooo0olxnioeildla rmnvo u4tlxoxr tadlpDelueils)srxoim3io1lptnlneia(  ruaumpoo0tee moeiltfa em( o u4 ltrmf3oy1fpDran s;s teurio3oodaptelnciat srtm(moou1oee  f3tydlm2rluvonu)texrif3iatla rlu o;(0t2tmim nydllenlici sfa2ur(r oo0texomfeilt mDrln p ()trermo tydopDelivi;s s2tmirpny1al   ictat)aDumumo;u1aeen fctld aDul(mont4tlenxr oo1oat an i;(0 rtr(r ny1lmt mfvias)sDra(ro;t1olxoifeias a2emn s (0arerirctadopDrli ils seuoxm3ou1olen nvsat) 2uau  ;o0tlxo iciatfs uanvsn()alxnxfcoy1fmt  uvsl()srxo(o3oy4alt mivi (farrru ono4apeo i3ias m emuvo;u4aeenio to1fmD ln o ( setoxm oo1lltnmiciatf rtm(rpno1texo fciadfsDuau s u4tetnxf oodlm rlieil( setmxr oudlp  mieilsfsDtmu o;t1altnmociydfs2el(vo u0 lerxr3iodopt li ilt  2trxo oy1ole lnvs (fsDtmx  nt1teto f3ilsfs2ulu o;u) leoxo3iodlmt  iei ( srxmir ou4lltemivt sf Dtaum ou1aptniociat sDrln pn(4 lenif io1lateli i;t tetm(m3iodome lfvslt)arrm(  ou4oeenmoetlt m rlump u) lxoio3iodfm e u i s)teum(opou1ll emneia( a2tax  ou4ape ifeiatlaDumnvs (0texnmf3oo1optran il() rtrxr iu4optnmnvtlt s2trumo;o4tpxnioeilsfm uau s;t4arenmr ta1lmt anvilt0 exr(mpiodop elicsl( artr(m ;u4opxomfciad m2rln s t)alenxf iy1fm  lnvo ()srumio3iy1ap nlnesa()arua(m nu0openmieiyt sDrl(mp;u4 exnmo3oo1oateanvol(0s2toxm nudllen nei t)sDuaxmo;o0aexoifcilt s2eln s t0 rtnircoadopD aivs s0t2xm(r iu4omte fcta() 2ua(mo;o4apen f3ilsfm2rln s u)areoxrcoo1om eluvilt  exrim nodlpe  iei s  Dtr(rpot1oeto ietydlmDem(vs t0aetrmo3to1la  auvo t)trxrir ny4op  lfctat  2rrxrooo4texomo3iysfsDuau o;()artnxr3totlpteluvo;s  2tmio3oudaptemicia(farraum nt1aee iicildfsDra(vsnu4altnxr3ty1opDeai s t setrirpoy4om nlnvsasfartru oou0teenmo3tytla2rlnms;() eenxo oa1om rlnvi t srumim3ou1am nlieilsf 2taxronu4tet  iciatls2eau o;(0arxrmrciydoa e ivs s0 rxoxmpnu1oltnmfvi (fa2ta(m ;u1tpe mieilsls um(vo u)tlerif3tytlm eai slt0srxoir oydlm emnct t) Duaxmoot1oetomf3iltfa em( o u0alxriocoodlpDeauei (0s2xmxr oydlp nlfvsa(f 2urxr nt0olxoio3iltfm2rl(msnt4trtoxf ootoptrlnvi;t  eur(m3iu1amtelfcs t)a2raumono0ape if3iydfmDrmuvp;(0aexomr3ta1fpt  u ils trxo(m oo1olt  fcsl( aDur(ro;o4oee mfeildlm ul(vs u4trtrxfcoodoat ai s;s teuoir oo4lpe mfviltfsDtru o;u1ope mociytfs2umnvp;t) etomociytfptrlnvil()s2urim oodome  neiltfa2um( pnt0tpt iiciadfaDem(vs;t)aexrircto1omDr ivs s)s2umxopoodal nmfci t s2tau oou0aeenif3tatla ra(ms;t4 lxriocoo1fpt lu i ()tetrio ou1omtnlfct ( s2ur(m ou1aleoifetas a2rmumpn(4teeoircta1laDeli o s sruo(rpio1am emici ()s2um( pnu1oexomieiadfs ra( p u)trxriociodlpDrau olt0s2umio nodopen iviat)arrru oou4oex miciad s2uln s (0 rxoxf tatlm ran s t  rxm(r oudol emnes s) 2rm(rpot4optomoeild s rmn on(4arxomo oodfp  livo ()seuoirpoudop nmnet t sDurx pnu1texomoetldlm2umuvs t) renir3iydoa ran i (0s2xm(m3oudaptelnei ( s2rmxro;o1tptnioetasla ulnvo;t) rtrxf oydlm rai s;(0s2xoxr3nu4lltn ict (  2tmxr no4tetn ieiydlm uanvp;t)aeenxr3iadfm  aueo s  eurxm iy1ome  fesa()aruaxmp;u0optn oeild s ranmp u0arxrxf ootlmt lnvi;()s2xmim io1opte iesa( s2ur(m nt4aexo oetltfm2uau pnu4teeoxr todfptelnvslt) ruo(m ou1apeelneils s2tm(r ;u4oex moctldfaDuluvp () rxrmr tadfmt anei (0t2xrxmpno1lpe mfei s sDum(  nt1oetomoctltlaDrlnmpnu)alenxf oatfp eaivi;t0 etm(o oodol nmivia(  rumu oou1optn i3iatla uln s;u4tltoxr io1lpteanesls0 2ur(r3iu4ll n fvi ( a2ururonu0olx  o3iltls2ulnms u0tltomf3todfmt auei (0srtoxopno1altemiesasfa2ua(  oo4tex  i3ild a2ul(vpnu0teenif ootfat luvs ( trtm(mpny1optnlnes ()sDumx ont4optn fciltfm2ul( pnu)areomr3io1faD li slt s2uoxmpiy1lmt micsas)sDtmx pot0ale miciydlsDemuvp t0alxrircio1op   ivsls0 rtrimpiodap elnvil(faDraxmpoo1optnmoctysls2rl(msn(0 exoxrcto1laDr nvolt texmio3nudll   fvi sf 2umxr ;u0opeo f3tas s umnvo ()teermrctodoatranvs;(  2uo(mpio1ap e ivils)artax ont1alenmi3ilsfa2eaumsnt4 eenif iatlpDr uvo;s  2tmxr iydlptelnei ( arrax o;u1tpxn ieiadla ra( o;t0alxrirciytfatrluvsl(0t2xr(r3io4openlnvs s  2uru p;t4tpe mi3tldlm um(mo t)areoxr iatoa  aiei;(0 eurxr io1optn fcslt)artmu ooo1oetomo3ilsfm rlnms;() etnxrcio1lat ln s ( tetoxopiy4ll emiciat) rtaxr ou1teeo ieiydls2rm(mon(4tleomfciodlmtrluvs s)seuo(r ny4oltn fetls) Dtm(mpno0tlto oeiysfaDrln o;t4tetrifciytlaD  n o;s  etr(rpno4ope lnvi s artmxmo;u0altnmf3tad mDemu s;t4 renmo oytopt lueo (0tetmxopnudlp elncslsfsrrrxrp;o4tptnmociltlm uauvo (4tltoxf todla rluvo;s tetr(m3nu1ap emicsas  Drmuro;u0oeeomi3iadfs2emn s;(0aexomocoadfa r i s (  rxo(m oy1lpenlfctas s2uaxmooo0oet mictltfs2ul(vo u)aeerxr iodfaDr neolt0s2toxo3ny1ap   neiltfs2rr( ooo4tleo o3iasla um( s t0 etoifcia1om rlieil(0trxo(m3ny4om elnct (  Durx o;t0openiieiytfa raums;() lxnxo3iodla raiei t0 euoxrpiydomeemneil() 2trur ;o0teeniociasfaDeanvpnu0tlxrif3to1faDr nvi () etrio iudal   nesas)sDua(rpno0apxomoctlsfm emn s ()aeenxo3io1lpDeli sls0s2xmio io4lme lnctatfaDuaurp;o1aptoioeiltfs2uaumon(0tlenmo3oodla raieo;s)srxo(r oo4olee ivs ()a2taxrono1tlxomoctldla2eauvp;u0tlenmf3oatlatelu ols)setmio3nu4am emncsat s2uru p;t0tet  oeildla ua(msnu4trxnxocto1fa e neo s0t2toxopio4alenmncil(fa2trxmonu4altnmoeiadfsDran p;u)altnio ia1fm  ai il(0s2xr(r iu1lpe lneias)sruaxr no4tlxniocias sDrlnmont)alxoir tytfa e uvs ( s2um(r3ou1aptnmicils) Durumonu4teen f3iysls2ul(mp;t0tetnmo tatla eau o ()truoxopiu1olte ivslsf rta(  ou0tlenif3iyd sDumuvp u4 rxoiocootfaD au sls)trur(r oy1altelfeia( sDuaumpno4aeeomf3iat mDel(vo t4artomrctatfpt  ivsl(  exoxm nudaleemnvi s sDurum ;o0tetn ictldfs2eau s () rxomocoodlmt an o;s)teuo(o3nodaleelnvt t) rtax  no4tleoii3iadla2umn s;u) eenircio1oa rlnesls)s2xrxm3oydapte ics () ruau pot1tlxoiociltfm ua(mp (4alenxf io1lpteaivsl( t2umio3ny4lltemnvsas  rrmx p;o1tlxnifeild aDul(mp t) etoio iy1lpDelueo;(0trtrxo ny4llee nesa()aDtmumont0tlxo fetyslsDrmuvon(4tetnxf iadlmtrauvs;s0setmxmpiu1lpenmiesltf Drru pnu4altnioeiadfm umu s;u0 lermf3totlat auvo ( texmxm3iu4opt liet sfsDtmu p;t4oexnmoeilsla2ulnvs;u) rxnmrciatop elies;( s2xrxm oydapt mnvsa( aDtm(  ou0olxnii3ils s eln onu4 exomfctotop e nvi;s seumiopiodop   fct ( arrmxr nt4aee io3tydlaDemump;() rxomfcto1lptraneo s0 2trir3nu1ole mieil(fa2raxrooo1ale ifctyd a2ulnvpnt4aeeomr iytfmteaneilt srtr(rpoodlme mneiasf rtmump;t1apt mfeils m emu p t0artrirctydomD aieslt texmir3no1lmtnmnesatf Dtmuront0opxo fciatlm rl(ms u) eeomr3oa1om e nesls)trum(r nodlmt lieiat  Duaur ou0apx moeiatfs ulump t4 eermr3tytlmDr nvo s texoxr oy1apt  nciat srtm(mo;o0oexoiociyt a ulump;t4aleomfciatla raneo ()t2uoirpiudlmtelfvia( srumu  oo0apenmieiatfa2rl(mo;u0 eeomo3tadoa e uei s0t2trxr3io1aleelneils)sDuaur nt0aex ifeiad mDeln s;(4areomfctatlptr n sls teuo(r3ny1al e ietltfaDrr(m ;u0olen o3ildfmDulnmonu0alenmo tatfm  aivo t  exrim ny1llenmncta( aDumurooo4tetoioeiat m2ra(vs;(0tetoxo3tytfm eluei s0srtm(opnu1lmeemnvsl()a2umxmpno4alx iociltlsDulnvp t)tetnmfcoydlateai s;t0 exr(mpoydopen fvias  2rrxr ot1tpxn i3iatlmDrmnvo u4texoio3oodoatrlnes t) 2toio3iydll   ivsa()artaump;o1texnmiciltfaDem( s (4altoircoodlmtr n i s srtrxrpoydopeelietat)srurum ou4tptoioctltfaDemumsnt4 rtrmf3iatop e iei (0t2umim3iydlp nmnvsas) Durxmpoo0oltnifcild m2em(vs;(4trtnir3ty1om rlu s s tetmxo oy4ame  fvil(fs2trxmo;t0opeo oeils m2eln o t)aleoir todopD  nvolt  rtrir3iydop  lfetlt) 2rmxrpot4apt ii3iltla ea(vs u4 leoircta1lm rluvi;(0 exr(rpoo4olen nciatfsrtau p;o4alt mfctys m uauvsn(4alxoxf iydfmtelnesls0t2tmxo oy4lp e fvta()a2umxrpno4olto ietatlm eau pnt4texrxr io1oaDeai o;t setmxmpny4lm nmfvt ()artr(rpoo1teeoifetas s2rau o t) lxoio iy1laD anvs t0texoiopoodlmeemfvia()s2tru pno1alenif3iltfm2el( o;(0tlerir3oadop eliei t srxr(m3no1apt mictat  rumumpno4aexnioeiasls2uanmo;u0alxrmo oatomte i s s0s2xm(o3no4ol nmict ()aDrm( oou4tptnmfciyslmDranvsn(0aexoif3oydlptrau i;s)sexoir3oodlp n iviat)s2trxr ou0oeeoioctydlm2ranmpnu)aleoxr3iodomD  ues t)srtrio no4olen ictls s2rm( pno1olxoiieiatlaDrau on()artnmo iy1fat aueilt0 rtmim3ny1al nmfcsat)a2rmxm nu0olenifeiad m uln p t4trtoxo3oo1omDran i s seto(m io4ape  nct t)srurxmpou0tpxomfctas s rl( snt0tetnirciotfaDeauesl( sexmir iu1omtelnvtat) Drax  ot1apxo oetat a rmumo t)tetrxf iodfm eanvs;t0t2trxr3oo4opt  ieilt) 2uaxro;u4oexoifetltlaDea(vp;()alxrmfcoytfatr ieolt0 2uo(r nydolenmiesat)aDta(m no1oexo ociyd a eau sn(4texrmr tadfm eai i t)sexm(m oy1alt  ivsa() rtax o;u4ole mi3iydlsDran s;t4trxomfcoydla  lnei t) exmxo3io4lme mnesatfsDrmuro;t4tpe  ictysfa um(mp u0teermrcio1oa rluvi t0srurxo no4alenmnei t)sDra(mo;o4apt  oetasfm ra(vo;t4aexrmf io1oat  ivi s0 exm(o ny1apeelfes ()arua(mont4oltomfciasfs2rlnvo;u0alxomo oodfa  aivi ( seuo(mpiodlp e ivta(fa2ua(  ;o1tpxnmieiltls2emuvp;u0 rtnxf oadlp rluvil(0 rxrio ou1olt lnetatfaDurx  nu1opto oeiyd a2rm(vo;t4 rtoir3oydoptr nvi;(0trtoxr3nu1omtnlnvtlsfartmxmp;o4oltnmietas aDemuvpnu) lxriocoytlp eanvo () ruoxo3ny4aptelnvi t s2rmu ooo4tltnio3iyd a2rl( ont)trxoxf3oytlmDrlu o s)teurxo3iy4omtemictas srtmum ;t1texoiiciadlm2eln s;t0trtoio3oa1fpDeai s t  etmxmpoo4lm emfvsl(faDumxr ;t4opxomo3tysls umu s ()arxnmocootfmt aneo s0trxmir3no1op  mictlt)s2rrumont0aptoif3iytfs2em(ms;t)trxnxf3iodfpDr n s;()srtoimpnu1ope licia(f 2urxmo;o0ale ifeils m ul(vo;t)altnmr3oydlm  anvolt) 2trir3nudam nmfct t  Drau oou1alxn fctasfm2um(vo;u4trtnmo3totlpDrln i s) exr(o3oodomeemiciat  2tmu p;u1oetnmieiydla rlnvont4texnioctotoaDeluesls  2xoio ou4aptn fvi sfaDrrxmpnt4tptnif3iydls2eaumo t4 ltoif3iadop e uvs;s) etrxopoodlm   icslt)sDumxr ;o1apto feiat s ea(mpnt) etnmr3iodlm ran olt  rxrxrpiudaptnmncia( s2rmum ou4opt  oetltlmDemu o ()aetnxf3iotlp eln s;()srto(mpno1lp   fet ( sDumumono0oltoif3iydfmDuaumpnu0 ltoxf3tatlm eaneolt)srxoxo nu1ome mnes tfarumu  ;t4aee moeiat m elu p;(4 etrmf3oytfp rluei;s0s2uo(m iy1op  livi tfa2tr(mpnt0alen fetls s um(vsnu4alxnxfctadoat li o;(0s2xr(opiy4lltelivtas)aDtm(m ;t4alxoio3iadfm emuvp t) exnifciy1lp r i o s srumim oudom nlivta()a2tax pou4aptnioeildla2emuvsnu0aetomo3tytlp  lieols trxrxmpno1am  mfvia()sDtaxr no1apx ioetat m2umu o;t0trerif3io1opDrlu sls  2tmxr oy4al  livs (f 2tmxrpoo1oltnioeiadla2umnmsnu)artomrctydopD  ies t0srtoim3ou1optn fei t) Draxmo;t0ope moetyt mDel( o;u0tltomf3to1opD aueils)seto(m3no4omt  fvtat)s2tau pnu1aeeoii3iadfmDemu o (4arxrmoctydlmDe nei s  2xrxm ou4op emncs ( artmxm ot0aex  fetasfa2rluvp t0aexnifciodlat anvols) exrxmpno1ll elfvsa(  ruaxmono1tle  i3iadlsDea(vo;(4 rxnxrcoydfpte nvi (0 2tm(r oo4lm emiet ()sDtm(  nt0aleoiiciat a2uanvo;()trtoxo3oa1omDranvslt  eur(o3oo1omeemiesat)a2uaumpnu1opxnmfctlsfaDumuvp () rtoxo oytlmteauvils) eumimpiu1amt mfct s  rumumpnt0apeoii3iatlm2ea(mo;(4 rtrxfciy1fmte nvs s) exrir3no4op  mici (fs2rmx poo4tltnifctysfsDel(vp u)trtrmrciytomD  ueil()teumxr iudol  mnet (f Duau o;t0apt iictysls el(msnt0arxnmf oatlmt aiesl( setrxopiydop  livsl()aDrrxmp;o1ape iieiyslm2ea( sn(0aexoifciadfpt  nvs;(0 eumxr ny1alen fesas) 2tm(monu4tleo ieiadls rln p t4aexnir to1fp eanvs ( seumiopoo1apeemnvt sf 2taumpoo4opt  feiadfsDraumont4tltnircootlpDr nei;s)t2xoiopiydlm elfesat) 2rau pou1apen i3iltfs2rm(mp;(4 rxnxfciotlateln ol()teur(o no4lle micslsfarumu o;o0olxomi3tasfm ulnmonu0aleoxocoatopt  ivs;t) rtmxm oy1lpte ncsa( srurum nu4tptn fciydfmDuanmsnu4arenmf iydoa  lies;s)sexmio3oo1lp   ncs t)s2ur(moot1opt mfeiyd a2ulnmo;t) rxrio iotoa rlneslt) 2xo(rpou4ameemivias) Dta( pou0olx ioctadfa ea(vo (0 rxrmr tytlatrlnvsls sexrir oy4lm  lfctasfs2um(m no4optn i3tasfa2um( o;t0altoifciodlateluei;() eurirpnodamtemncs s)srumxr ou1apx ifcils s2eanvpnu) etoxfcio1faD livols  2trxm oo4optelicil()sDurxrpnt1tex  f3ias a2ranmo;t0alerxo io1oa elu ils srto(mpoudap elnes ( srumur nt0optnio3iasfa2umnvp u0altnmf oadoa   ivslt0 ruo(opiudaltnmicilsfsrraurooo1tpx ifcildfa em( o u)altoxr3oatfaDr neol(0srxmir3iy1ll elnet s)aDrm(  ;u1olen fetytla rmums;(0aeenmrctydlm  aueilt trxr(o3oo1lm e icsat) rrmxmpnt0oeeo ictldlsDrmn o;u0aetoxo3iadfmtrau ols  rtm(m3ou4alte fctls)aDtrx  nu0ole  fetas a2rl(vsn(0 exnmf iatfmD ln s (  euoir3oodope micil(f rrau  no4tlxnifciatfs eaumont)trxrir3ta1fmDean s;(  2xrirpoy4ale  fetasfsruaurp;t1tpxoiiciytfm2rm(vp;u) lxrxrcoadlpD  ivslt  euriopoy4olt  nctl(faDtaurpoo1teto o3iatfm um(vpnu0trtrxrctatlaDeau o t  2umim3nudlpeelies s a2urumpnu4aex miciysfs emu snu)treoif oa1lmtelnvols0 2tr(mpio1llen nvsas  rta(r ;t4alxnifcildfm2umnvp t)trermrciodomDr n il( teurio oy4openmics sf rumxmooo1oexo feiaslsDumuvp;t4 exnif3oo1optrliesl() 2xmimpoo4omen ivi s)srtaumoot1aexo oetatlmDrmn pnt0arermo3ta1latrlueolt0teuoir iy1optn ictl(  Drmxrp;u0opxomoeiasfsDumn p u0tetnxocoytlaD aivols0 exm(o oodal n iesl(  Dtrx pnu4oeeomfeiytfm ean sn(0 ltriocoa1lpD ln i;t) rumxm ny1omtnlnvtas a2rr( pot4tetoio3ilsfaDulump t4trxnmfctotfpteaueolt) exr(r iydalenlncia(  2taxr nu0aexo f3ilsfa2elnmpnt0teenmf3ootom  aivolt0srxoxopoo1oltelfcs s  2urxmonu0aeenmfeilt aDemn s t0arxnxf3totoptelivsl() ruoxrpnu4lltn iei sfs2ta(ro;t1tlt  ociydfsDean s;u4 eerxr3totoate iei;s0s2tmir3nu4openmncs t)artm(root1alt  i3ias aDrmumpnt4 rtrxf3oy1lmteaivols0 euoxm io1ale  fvsat)sDtaurpno4aexn i3tyd a rmums;u4tetomo oydlaDrai ilt0t2ur(o3oy1ole mivt s aDumuro;t4apxn ictltfs2el(ms t0tltnmr3tatopt aiei s tetoxmpnudaltnmnetas s2tm(root0alxniieiys s2uluvo;u4trtrxr3tatla rlieil() etmiopnu4lp  lfvtasfa2rrxr nt0apx moeiadfmDul(vsn(0artnxoctytlmDrliei;s trtoiopiu4ll elncsas srur( pou1apt  ociyt aDumnmpnu)tltnmrcta1faDeanvo;t0s2urxmpnydal  miesa(f rtruro;t4aetnmieiasfs eaumsnt4teerir iadfaD aivi t)srtmxo3iu1aleemnvtas sruaump;t0alto fciyt m ul(mont4 ltoif tadoat  i sls s2uoir3ny4lle  ivi t)s2tmumo;u4aee ifeiydfaDrau s (0arxrxo3ta1fm eln i s)t2um(o ou4lmte icilt)artm(ro;o4apxniieiyslaDrmumont0aeenmo io1lpDrauvil()s2xrim3ou1ll nlivsas sDur(rpno0tpto fctytfaDua( p;()artnxr3oatoaDelies;t0s2um(o3nydame  ivsls)s2rru onu0olx mictys sDea(vo;t4tlxrmo3oytlp raneslt sexoiopoy4lp nmfvia() rtax ont1ape ioetld m2rlnmo (0altomf totlpteaues s)t2trir iu1ll elnciat sDtm(m ;o4aleoioctyd a um(mont)texnxrcootfp r nvol(0srumio nydopeelfctlsf 2tm(mpou0tltnmoctlslm rlnvsnt4tetnio totoat anvs;(0t2um(r3nodlmt mict sfsDraxm nt1ole if3iydfaDuluvo u)teenif oodfmDrliei t)srurxm oodom n ivta()a2tr( poo4olxomi3tysfaDeanmo t) etnmocto1laDe ueo s texmxo3nu4lp elfes s)srrrxro;o4apxoioctldlsDeln ont4 etrmoctadomtraivs;s t2urim ou1lmt  fesat)sDtm(  oo1ole if3iys aDrmnmp;t)tetnxo ootlatr ueo;(  2xrio3ny4ope mfctat)aDrau pou0tltnio3tlsla elu s u4trxoxr ia1fa r nei;s seumxo3oudom nmies () rtaum ;u4olx ifciyt s2ua(von(0trermr oo1opteauvo t)teuoxmpiodolte neilsf Duaurp;t1apx mi3ilt mDranmsn()artrif tatfm   i ilt)texo(o ou4alenmnes s srurxrp;t4tee mieiyd m2ranmp;t4trxoxr totoa  lu o t trxoxm iu1ol eliet s)sDrr(r ;o1alxnioetysfs el(vs;(4trtoio iatlmtrli i t0t2xmim oy1openlnviltfartrum oo1alenifetasfs2el(vo u4aexrxfctodlmDr i s;s srxrxo oy1lptemneiat)sDum(  ;t4apx ifctasfa2ran o;u0trermr totlate n ils0t2umxmpiudol   fvil( srrmurpno1alt  fciad m2eln o u4 rermr3tadfpD  uvols0 ruo(m3nudoleelfvt s sDtrxrooo4oltn fcilt a rln o () etnmfciadlptrlneo;t srxrio3oydol e fviat a2trx pnt4tpen oeiatfa2rauvp;()arerir tatlatranvolt seum(o iu4ope mietl( aDuaumpnu0apt  i3ildfs emn pnu0trxoxocto1fpDe ies;(0tetmir oy4omee fcsls s2tr(  ot0altomfetls sDelump;u4 etrxo iytlp  lieo ( seuoxo3ny4amtnlnvta()srumxrpnu0tleomocildfm eauvp;u0arenmf3ia1opD auvo (0 exoim ny1om  mivi (  Drmur nu4olx mo3iysfm raumo;u4tlerxfciodomt anvolt srtoxo3iu1olt lnvs tfaDtax  ;u1tpt  oetat a2eau p (4trenirciy1lpteau o;t s2toim3oydlm emfct s) 2ra( oou4ope mociadfs2emuvo;()trtoxo iotfpteaivols  2tr(m3ny4ame mieiltf rra( p;t1teen ieiad a ra( on() exoircoydfpt  neo;s) rto(r3io4amenmivs ()s2tr(m ;t1aexnmociadls ulnvon(4 ltnxf3iytfa  aieo s)sexrxrpiu1amenlnvt t aDumxm ;u1tpxoio3iyd m rauvonu0tetomf oa1lm e i slt  eumxm no4opeelnctls aDraxr ;o0altniociatls raumo t4trxnmo3oatoptean i (  rtoxopou4openmies (f 2ur(mpoo0oetn oeilsfa ranmo u) lenxfcia1om r nvols  2uoio3iy4am emnesatf rrr(moou4oltnmfciys sDuanvs u4trxnio3iy1omt lieo s0s2xmimpnudllen nciltfarumx onu1optoifctysfs rmnms u4 renxo tadlmteaueo (0 2xr(m no1ll   icta() 2um(roou1tptn o3iltlaDea(vs;u)altomf ta1fa e nvo;(0sexrxopio4lltemiesat)sDuaxrooo0optnmoctydfm2emuvp t)altnmr3tytlatraieilt)teuo(opio1am  lnvias a2urxmo;o0tptn oetasfaDrau s;u)trtoxfcoa1om eauvi;(0t2uoim oudapte icils)srua(m nu4apx ifetyt mDul( onu)arerxr3ta1opD aieil()texmimpiy1lm emfcsas)aDtau  ;t1tee io3iltfaDem(mo ()trxrxrctytfaD aivsl(0srxoxr3ny1ll nmfet s)srtmxmpot1ape  oeilsfm2rl( s;() exomf oytom   nei t0t2xrxopio4llenmivs ()aDrau ono0texomfciatla em(ms;(0aetoxo tadlmtranvs;t)t2um(o ny1om nmfetls)aDtm(rpno1aexnmoeilt m2umnvo ()tetnmociotoptr uvo;()teto(r oo4ameelieiat sDrr(  ;u4optn i3iasfaDea(mp (4 rxoif oytlptrlnvs;()t2umxo3nydapen nctlt)s2umxr ;t0ale if3iys a el(vsnu0 lxnxf3iadlptrlnesl( seurxr oydap nlfvtasf Duaxmpoo0oee  f3tltfm2ul(vo t4tltnmf3iytlaDe i olt  rxoxo oydlptemncsl(fsrum(monu1apx ifciyt a2rlnmo;t4texnifcoa1la e u i ()s2xmxo nu4aptnmfcils  rra(mpno4aptnio3iydfa ul(mont0arerir totom e i il()srto(m ny4ol  livsls sDua( oou0oltoifciltlmDua( p;u)aexoio3iatlpDeai o s  etoxrpoo4ap e fcil(fsrum(m nu1ole iocias a emumo u0 lerif3oa1omDe neo t0 rto(m3nudlp nmfvta( srraumo;o1texn fetls sDrmnms (0aeeoxrciadfpt
\ No newline at end of file
@@ -0,0 +1 @@
+iesls  etoxo3oo4lm emicsltfa2trxmpou1tpeomociytfaDrmn s t0tlerir todopteauvsl() 2tmim ou1alt lnvsatfaDrrxr ou4tlxn f3tadfs ra(vs;(0 lxrxfcty1fa r uvs t teuoir oo1olt  ivsa() Drru pnu0ale  iciydlaDrmnms;u4arxrmoctodoaDrlneo (0 rtoir3nu1opee nei t s2ururo;o1aeenioctyd m2ran snt)altrxf3tatoa r nes () 2tmxr3oy4lmteliei s artau oou0opx moetydlm2ul(mp;t4 eenmr oy1lm rln ols t2um(o3ou1lm   feiat s2ur( pou0alxnmf3iydla ra(mo;()tlenxo3iytlptelueo;()s2toim oy1ome  ncia(f 2ra(mp;t0tltnmictatfmDrlump;u0 ltoircoodoate neil(0 rxmxrpoo1ameeliesa() rtrumpnu0aexo ictldfm uln o;t4aexnif3ootfmD  ivo;()sexrxr3iy4oltemfeiltfa2raur nt4apx ifeiysfs2ua(vont0trtoif3oydlateaivs t0 rxoxo3oo1am e fctl(faruru o;u0ole mo3tydls ran snt4tlenxf3todfp rln o t0 etriopiu1lmtemicilt a2urumpou4apeoiiciasfa2rm(ms;t) lenio ta1la  anes;()sexr(mpno4amtnmicias)s2urxmont0tlt moetatls rlnvonu0 ltnxocia1faD aies;s s2xmxo ou4lpeemneta( srtaum oo4aex mf3ildlaDrmn o u4tltnir3io1oaDeln i;t)srtriopiy4amee fcs ( s2rmx  ;t0tlx ifcild sDelnvpnu)aetrio todfm  li i t0sexrxr iodome  fcias  Dtrxrooo0tpe iociyt a rm(vp;(0alxrxf3tatlmt auvs s)s2toiopoodlmtn ict (farra(m ;u0tpe mf3tls sDemn s t0aetoxo3oy1op  ln i s teumiopiodapenlnetls)s2trurpno4tpxnmiciad mDel( ont0 rtnmf oy1omD auvil(0texrxm oudoltelneiltfsrtax ooo0tleo ociyslm2umumo;t4alxnmociatfp  aies;s0t2toir oodomtn fcsl(fa2uru  ot1aetnmfciyd s ua( snt) ltomfcoy1lmtranvs;s0t2umir oydapenmfcs s) Dra(root4ale ifeiyd sDrm(mpnt4tleoir3iotfateanes s t2xoxo3io1apeelfesltfsrua(r ou0tlxomictldla ulnmpnt)trxrxf3iotfpDraivslt)teto(opno4ol  mnvtls)sDrm(r ;o4optn fcild sDrln snt0 lermfctydopDeaieo ()seurim3oydlltelnesa() 2raxr ou4tetn fciydlaDemump u0arxoirciy1lmt au s t t2tr(o3oydam n nctlt  Dtaxm ot0tlenmicilslm2rmumo;(0tlxrxrctodfptrluvs t0s2xrxm iy1ll nlnci s  2urum ;u4aeenif3iytfaDuanms;u)artnmr oo1oa rauesls)t2umiopnudaltn ncil( s2rax o;t1oltnmo3iad aDel(ms (0 rxnir3oy1lmt  uvo;t  rxm(r3ou4ape lnct t  rurxmo;u1tetn ieiasla rmnvo;t) ltnmo iodfpD ln o;t0 exoiopiodol n ivs t) Drmxmpoo1tex iociytfsDea( p;u4trxrxo ty1lpte nvi (0trtm(o nu4alenmnvia(f 2trxr nt4aexomf3tysfmDea( s;(4teenxoctodfa rlivils0 euoir nydlp nmnesls arra( oot0aexnifeiyd aDuluvo t4artnxr3ty1fa eai i ()srtriopno4ol n fvs sfa2um(m ou0tlxnifetas a em(mp;(4 reoir3tytoaD  i s;t t2to(o3nu1ame mfvilsf Dtrxrpno0alx if3iytfaDulnmsn(0altnxo3iydomt  nvs s0srtm(o3io4lltemfcsl()aDrmur nt4aet iociydfm rmnvsnu4 etnxr ia1latelieo s  rumio ou1lpe mnct tf ruaumpno1aex mfciat sDuluvs t) rxrxr3ia1op e iesl( srxo(o no4apeelnvta(  2trx pno0opeomf3tyd mDranmo;(4 rtnmrcio1latrlieilt0setmxrpny1oltnlicta(  2ururont0alen oetyslm2ul( p u)arenmf to1lateaneol(0s2tmxm ou4am emicsl()a2rrxmooo4teto ieiydlm uanvo u4arxrmr3iy1oa e n i s0srumim iy1lpt mfvil(  rrau p;u4olt if3iatfsDrm(ms;t) ltomf3tatlpteluvs s0trto(m nu4apenlnviatfsrrau o;t1alxo feiytla2rl(vp;t4texnmfcty1fmte ivslt seto(mpiu4lmte nes s)sDtr(m ou0tlx iietls sDuan o;(4aetnmfcoatomtrluvs t  2trirpoy4lltnlnctlt)aDururonu4opeomfeildlaDulnvo;u) reoxfciatlmD  n s t)s2tmir3oudllte icta( srrm( pnt0aexn feildfmDrmnvont)arxomo3oadomDr ueilt teuo(o3oo4llen iei t) Dtmxmpot1oee  octldfmDemnvs u4 rtoio3oydfmD aieil() 2umxrpoy4ol emicsl(f 2tm( o;t0oltn oeiys s rlnmpnu)tltrmfciatfpDrluvo (0 exrxmpou4omen nviltf 2uaumpno1opx mi3ilsfs uaums t)arxrmo3oodfmDr iesls sexoxr iy1amt  iei s  rumur ot1oeenif3tyd aDua( snu0 rerxr3todfmteli s;()s2tmxr iydaptn icsat)s2ur( pno1alt  fciys m2rauvs;u) exoiociy1fpDrli s s)trtmir3ou1lmt mnctl()a2trxm no1texn feiydla em(vsnt4tetrifciydlpD au slt0trxrxm3iodale  ncsls a2rru  nu1oex mfctyd mDuln o;u) leoifctydfa   ueslt sexmxopnodole lictatfartaxmp;t1oexo f3ilt s2eaumpnt4 rerxr3iytfp r uvslt  rxr(r3io4op  lfcsatfaDrmurpno1tpxn oetld a2eanms (4arxomr3ia1fmte ieo s)t2toxr3iu4optnlfvsl()artrx  nt4tptnmi3tasfs2rmu p;u4tltrif oydlptr u s (  2xm(o nudlpenlnvs (fsDur(r oo0oeeoioetydlm rlumo;u0tltomr tadlaDraivils) rxoxopiodlpte nvsatfs2uau onu1tpxnmi3iytfs emu p u4aetnxocootfmtrlu sl(  2umir3no1lpt miviat a2ra( o;t0alx  iciasla2ea(von(0 exrxo3oodopt aieo;s0seumxopoy1ol elfvtl( a2tm( o;t0tpenio3tydfs ulu o ()aeermr iodom eluvilt)trxoim3io4ll   icilsfarumx ont1apx  ieiaslm uanvpnu4artomf oa1oatrai s t0 euoimpiu4alt mneiat aDuaumo;o4oet mi3tatfa2um(ms;()alenirctatlmDrlieil(0t2toxm3iu1am  lfcsat)arurxmooo1oeenmiciydfmDea(ms;t) rtomrcoatlat anes (0srumxopiudopeemneta()sDrmxrono1aee  o3ilsfm2eln s t4tetoxr3iadlmD  i ols trxr(r iodlpe lnvsat srrr( p;u0opxomfciatfaDeanvp;t4aexoxrciatlmtr u ols) exm(o3ou1ll   fctas) rrm(mpnt4alxoii3tysfs2el(vp () etoio oy1omD  u i t0sexrir3no4lptemfet sfa2umu ont4apxnmi3iat m2ulu p;()tltrxf ia1lmD  n o;( srxo(opoo1apen iesas srtru p;u0alxn fctld m uln p;u4treomr io1fa rlueilt)s2to(o3ou4lmt  iei ()arrrumooo1aexoio3tysla umnvon(4 exnxfciatom ranes;s0 rxoim3iy1opt  fvslt) Durum oo1ope mo3tasfsDul( o () lerxf totfp  ai s (0sexrio3nu1llen netltfsrrmx onu1opxoiietls m2rl(mpn(4teerxf3tadlat luvo;(  rtrirpou4omenlivi s  rum( ooo4tee  oetytfaDrm(vp u)texoifciytopDe u i;t)s2xrxo3iodapen fvtat)sDtru p;u0olxo iciadfs2rln pn(0 etnio oa1om elneils)trtr(r3oudale  nviltfs2ua(  ot4opt  octlt sDrm(mo () leoio3oatom rlueslt t2xm(mpnydop  lfesls  Drm(  nu4alx  oetlt m2rl(mp;t)arenirciodlm  lueo s) 2umxrpoudom  livt tfsruaur ;o0teeoioetys m2rmn snu0trermrcty1la  luvs ()srxr(m3iydal n fcil() Drmurpou4ale if3ias aDel( p;u)tetrif3tadfaDe nei;() 2urxo iy4amteliesasfs2umx poo4aee  oetydfsDul(msnu)tlxnxr oodlate i s s0t2tmio ny4altemnetl( a2rm(m ;o1tpeomi3ils m uau s ()altrircia1fa eau olt0 2xrxr3oy4alenmncilsf Dra( poo4apeo fetasls2ranvsn(0tlermo3ia1om r nes;(0tetmxrpiodope  nesl(  2ta(ront4alen fcildfm elnmont)aetrmr3iadopD anvslt0teumxm io4lmeelietas sDtaxmoou4tltnii3iasls2rluvs u0tetnmo totlpt li ol(  rtoiopoo4ale  fei ()sDum(r ou0open ieiltfa ra( pnt)arerxf3iy1omD  i s;s)setmio nu1ap emictl( sDumxm ot1olxnmoeiltlm rm(vs t4texomr3tatoa  an i;(0s2xm(r nudol emiet t a2raurooo0tleo ieiysfs2elnmp;u) exoxf3tatlmtr i olt0 exoxr oudoptemnciasfsDtr(mp;t0oee ii3tldlaDeanvs;t0texrio3ta1lmt  ies (0 etmir iu1ap nmfeias)a2umu pou1oetnmietas m2eaumont4altrxfcoatfpDeaueo (0t2xmxr3ny1aptemnctl()arrm(rpnu0tetniiciyslmDelnmp u4trxnxo iytfaDeaivol(0 rurir3iy1alte ieias)arurur nu0oltnio3iadfa2emnvsnt0 renxoctatfpDr ues t)s2xrxopoodlmt mivsa( sDumumont0tpeomicild mDem(ms u)texnxo oy1op   ivs;t) 2umir no1ol nmfvtasfa2rau pot0oetnmietld s2rmu o;t4aetnmf ootlateanvil( srxmxo ny1ame mncia( sDtm(r ;t1aptnif3iadfm uaums t4 rxrxo3oo1lpD  nesl(0 rxoimpiy1aleelicil(f Drmumooo1tlxoiociyd m rauvonu4arenmf io1fat  n s;t  2trio3ny4opt  netls)s2tmxroot4tlxnif3ildfsDua( pn(4tetnxr totopD  n s;s0 2xoiopoo4al  lfcils)sruax poo1aeenmf3iltfmDem(vs u0 lenircoadfmt  neo;t0 eurim iy1optn nvta(fsDtr(ronu1aexomieiytlaDulump u0 etrif3totlmDelnvi;t) exm(m3oy1lmte ieilt sDra(rono1alxnioetadls ea(ms () rerxo ia1fpt lu s;( srxoxopno4al   nci (  2ra(rpno0oltn oeiytlmDum(vonu4tlxrxf iatlmDeai o;s  rxrimpnu1lmt livsas s2ta(moou1tpxnmoctadls rm(mp (4 lxrmo3tatfa   ueo;t)s2trir3no4ape  icsas)aruaxmonu0apt moeiysfm2uan p (4 exoxf to1omt an ilt0trxoxm3iydlleemfvi sfarraumoot4tex ifetld a uau snu4altrxr iydoaDeanvils)srur(m3iu1oltnlfesas)srururpno0tex mictytfm rau o u)aexrxfcootoat li i t0tetmxo3iydlmtnlieiatfs2uaxr ;o0aleo o3tltfa2ea(mo u0tltnir oa1om   ivols0 rxoxm3oo1lltemfet tfarururpno4olxnmieiyslm2rl(vsn(4trtnmr ty1fate nvo s)t2trim3oo1am  mncslt artax pou1olt ii3iysfsDulnmpnt0trxrxr oodom e nvs;()t2tmxrpoydll  mfcsas  ruauront1opt mf3iys m2rln s;u0altoxo iodlpt  nvols0s2to(o iu1amee nesls  Dtr(moot1oexoiieiydls rl( s u)alxrxfcty1lmtr ivols s2tmxm3iy4ol  lictltf Dtrxrpno0apt mfeiytfaDrlnmsnt0trenxrcootlmD lnvsls0s2ur(mpiu4lm n fesl(fartau  ;u4opeo ociat m2emu sn()alxoxf3oatfatrlu olt)t2uo(opiodlle lfctls)a2uaxrp;t1tle ifciys a2rmn sn()texnxr iydom  anei;t0setrirpiu1apt mfvsa(  2ra(m ;t0tlxn ieiatlm2rl( p (0aexniocoodomt  neils)sexr(m no4lmenmivt s) 2urx  ot1tetn feiltfa2emn o (0 etnmf iy1oat  uei;s) 2trxr3oy4ame lfctasfsDrrx pnt4tle ioeiys s2rl(mon(4trtoxr iotfat  i i;t t2xmim3iu4lptn feiat srurx  oo0tet moetadfm rlnvs;t0aexrxociotom elivi;t trtrir3iy4lmenmieslt) rtm( pou1ole moeiysfs2emu o;u) reomrcoytopD anvi ( t2xm(r3ny4ap  lncsat) Dtmu pnu1altomf3tad m2elnmp;t4tlxrif3to1fa elnvol(0srtoimpoodlmt lfei s)arta(r ot0aetomictlt mDemnvsnt)aleoxociy1lmtrln s (  rtoxopoy4lltemfvsls sDur( onu0apeomfeils mDrm(mpnu4 exrxf tydfmt au i s) 2xrxopiu1lltnmnvtat  ruaum ;o1ole  f3ildlsDeauvpnu4 exnir3oodfp  ln i;t tetmxr3oy4olt  nes t  rraxr ot1olx  f3ilt a ulums;t)areomf iadla r u o ( trtrxr3oo1llen fcslt sDrrum nu1tleoif3tlt aDum(vo (4 eermocoo1laDr n o;(0trxoio oydaptn iesa( srrax onu4oet ioctadfs ea(mpnt4trtnxfcoy1fmDrlnes (0 exrim oo4om nmivi tfs2umxmpno0apxnmictyd m2rmnvp;u0tltrmo oo1oaDr ueils)setmxr ou1aptnlneilt) Dum(mo;u0opxo ictatlm2uaump;t4 etnxfctytom rlivo s  2tmiopiy4open nctat)arta(m nt1aptn oetadfaDem( p;t0 rxrmrcoa1fpt lueo ( texo(r no1optnmneils a2ur(  nt1apxo o3iytla2rmn p t)teenir oydfpDeaueo;t)srurxrpny4aptn neiat) Drmum ;u0oltn o3iyt s rlumont4 lenxo oo1la elieo;t)teumxr3nydale lfcil() Durxrpoo0tlxn fetadla el(mo t4 exoirciydlpteaivi;s)s2um(r3iudale mfeil(  Dtm(r no1tlxo icias m2rmnvpnu0areoiociy1fmt ln s;t  2uoio ou4amtn nvias)a2rru  oo1opx mictlsfs2um(vonu) rtnmf3iydfpDe uvi;() 2tr(rpnodoleemneta(  rurur oo1open iciltfs2umn o;u4alxrxrcoydop  lnvolt) rtm(o3iydapenlietat)arrmx p;u0tetnmfctatfm2ran pnt4aexrmrcoo1lmDean i;s0sexr(r oy4optnlivias)s2raum ou0tlto i3iytlm em( o t4aexrio oa1om eluvs;s0t2umio3no4lle lncs s)a2taumpoo0tlxoiieiydlm2ua( o;u0aeeoir tydfpDeauei;s)sexoiopnu4am elncias  rtr(r oo0tlxoioctyslmDean s u0 eerirctatfmD  n slt t2umio nydomeemici ( aDumxront1tpeo fctls a ranvs;()trtnioctydfmte ivo;t0srurimpny4ome lnvsa(fs2um(mpou4apxo o3iytla uanmo (4 lxnir ta1fmt lu o t s2trxo3ou1omenmfei t  2rrxm no1olxo oeiys mDrm( p t0tetrxf todfmt luvol(0trtrxm nu1amtemivta(f rta(roou1ole  f3ildls em(ms u)tleomfciatlaDelieo s s2tmimpiy4alt liei sfsrtaxr no1tpx mfciaslm2ran o u4arxoxf3iodlpt an s t  rxoxr iy1om   ncilsf Dtrur ;u0aptomf3iydla2ra(vs t) etoxr3tadfpDean ols s2xmxr3oudopee iesas  Dtmu pno4openmociaslaDuln pnu0 exrif3oytfat aivs t s2trir oo4lle livtlsf rra(m ;o4tptomfciltls ea(ms;u4 etnmfcoo1fmDrlieil( t2trxo nydllenlfvtl( s2umx ooo1aeen o3ilsfm el(msn()aetoxo io1omD aieo;( tetr(o oy4ll emncta(faDumurpno0ape  fciydfmDrmn p u0 rxnio ia1laDeli i (0setoxm io4lm   nciat) rtru  nu0olenioctltfm ul(vo t)trtrmo iodfmtr i sl(0 exrio oydllt mfctatf Draxmp;u4tleomfcils aDrlumon() exnxo oadomDe uvs;(0teum(r iu4ale mnvta(f rtrump;t1teeo iciad aDulumsnt0 ltoirctotfa e nei;t srxmxo nu4lmtelfet ()aDurumoot4tptoii3ildls2em(ms t)tlxrmfctydom   i sls  etr(rpoodapte feta()arraxront4oexn ieiydlaDua(vs;t) rermo3io1omte nei;t texrio ou4ap emfet tfsrumurp;t0tee ifciytla rl(mpnt4tltnxfcoy1lm  li s;(  eumxm3nu4amt  fvia( sDumx p;o1ole mf3tyt a2umuvs (0teeoxfciatomtrlivi;s)trxrirpnu1ap e fcs tfsDrr(moou4aexomfeiltfa eluvs (4arxomo tatfp rlneil(  rurirpio1ll elnviat sDrm(r ou0apeomf3tydlsDemn p;u)trxrio3oodoaDr ivs;t0t2xo(o3nydlm nlfeta( sDraurpot4altoioctad m ranvs;(0alxoifcto1fpD  uvol(0srtmir oydoptn fvtlt) rum( pnt4aeen f3iydfm emu o;(0trxnir3oa1fpDe nvilt s2umim3nu1am emicsat  rrmuronu4opxnmoeiad sDua(vp (4 exoxo oydfa   n i t0t2xrxr3nu1openlfci s) Durur no0optomiciyt m2emuvs;t0 renir ta1opteanes;()s2uo(r3iu4alt mnctas)aDumu p;u4optoifeiltfm uln s;t0alenxrctotopDelneils0 rxr(m3iu1lm emfct tf Draurpot0apxomoeiasfa emums;t0 reomo tadlpDe ivslt  exm(rpoo4ale mfesa( s2tru  ot0openii3iat a rlu p;t0 etomfcoo1om  liesl( t2to(opoydalenmfvs ()arrmx  ;o1tlt  ictytla eaumpnu0tetoif oadlpDranvils0s2umxrpiudopt mfesl() Dur(  ;u4oexnmf3iadlmDelnvpn() ltomf tadopDelivi;(  ruoiopiy1omt  fciat aDrrxmp;o4aee iicildlmDrmu s;t4 exnmo3oo1oa r iei;s srxoio io1lptnmivi s)srraurp;t4opeo o3iysfa rau pnu)tltnio iadlaD lnes;(0 rtmxm3nu4lpee fcils s2ur(rpot1altomictaslm ranmp;(0 rtomrciytoate ivi;t0 2trir3oy4apee ict ( aDtmum ou0apxn i3ilsfa2umu o;u4tetrxrctytoatrai o;()s2xm(opiy4lptelfcs t) rum(  ;o1aexo i3tatfa2elnvs () ltrxoctatlptranvi;t) rto(r iydlltnlnciasfs2urx  oo1aee  i3iasla2el( s;u4 lxrmo3to1la rlivsl()s2uoio oodlmt mfci (  rrrurp;o4oexo ociltfaDeluvs;u0 rtoxrcoo1lp rlnvs (0 exrxrpny4oltemfvslt  rrrxmpot1alxomfciatfs rmn on() rxoio tydlat  uvols s2tmimpoo4apt mnvs s arrax ono4tet iictysls emnms t4trtnifctotfmt  n o t0t2ur(m3ou4ape licsat)srua(roou4alt if3ildlm2uanms u)tetnxociytfatraiesls)setm(rpou1ap nmneia() 2umx pnt4tlxo i3iys m2rmnmp t4 etnir3ty1faDrln s;(0s2xmxmpiudop emieilsfarua(m no0olx ioeild m2rm( p;t0alermf3iy1lptelivolt sexmxm oudomen fcslsfsDrrum ot4texnifcilsfaDumu o u4tleoxf3tatop eliesl( truoxopio1al nlivi s)arrmxmonu1ope ioeils sDean o ()aeermo iodopDrln s;s) exr(r oy1lme lnes t) Drrxmo;o4tpxn oetydfa uaumon(0tlerio tatla  lieo t) euo(opnu1lm  miviasfa2urxrp;t0apx  ocild s2rmumonu4alxnxo oodlat auvi t srto(o3oy1lp emfciat sDtr( o;t0altnmi3iltla emnms;u0treomfciytom eanvi s0trurir io4lpt  ieils) 2ur(r ;o1opx  oeiltlm2rln sn() ltoiocto1lptelieo;t)s2tr(mpoy1amtnlnvtlt sDum( p;t0tet iiciatfsDrm(mp;(4 rxrmr3tytomtrli s;s s2tmxm3io1lle lnvtat  Dua(  nt4tptomocilt a rl(vs t4 rtoxr3ia1omD lu i;(0s2urio io1amenmncs t s2tmxroou1aex io3ilt a uaump;t4arerifcoadoat lu o t) eurir iodomee nvsatfartr(mooo4oetoifetydla eauvs;t)tltrxf3iotom   uvs;() 2trxr3ou4oltnlnet t srumumooo1ape  fciltfmDraump;u0 rtoxr iydfa  lu ols seurxr3ou4lmt mietat sDrau poo4openmfeiadfs rmnms ()alenmf totlaDelnes;t)teum(r3nydoleemfeta(f rtaxmp;t4tpxn fctlt sDuau snu0aeeoxf todlmDe uvo t0texm(o3nu1lp n net sfsrrmurp;o4tlenmf3tltfa2el( pnu0tetrmr ta1oat  u o;t)s2to(o3oudamtemfesat aDtr(mont4olxoiocias s eln o;(0 rerif ootomDe ivs;( trto(r iu4ol elneilt a2tm(  ;o0tpxomoeiys s rm( p (0trxrmociytoate ivolt texrxm3nodaptnlfetl()sDua(rp;t4apto ieildlaDrl(mo;u4artoiociy1fm rauvi;s0trxr(o iy4lpte neils) rtaxmpnt0tlenmo3iytlsDulnvpnu4tlxniocoatlat luvs t0 ruoim iy4aptnmnvs s)a2umx o;u1alx if3iltlsDrmu pn(0 lxnxrciodfa elu o t t2toio iodap  mfvt (  rrru pnt0ope mfeiydfa2um(vs t4aetnmo iydlaD ln s t)trumio3iudamen nvtatf 2rm(ro;u4texn feiydla rln o u0tleniocoo1laDrlies t0 rtmimpnodom elicil(f rtaump;o1optomiciad s rlu pn(4alerir oytlatraivi;s sexm(o3oudamt  icilt) Drr(root4alen i3ilsfm rm(vo;t)artnmr3iotfm r nei ( s2uo(mpiu4omt lfes ( aruaxro;t4tpenmfeiysla2uaumont)texomo3oytfpDeau i (0setrxo3nydlme lfcsls aDua(mooo0aetoif3iyslmDean p () ltrxf3iodfp r ies s0t2tmim3ny4lmee ivias  2ur(moot4tltoifetydlm uluvo ()aetriocoodfmD  u slt)s2xm(r3oy1am e fvtl(fsDraxmpoo4tltoioeiytfa uanms;u)trxrircoydlpD  uesls) exrim3oy1aleemietas) Drm( p;t4olt  o3ildfs ranvs ()altnxr3tydfa eaieilt)t2xmim3nodomtnmictltfsDur( poo1alxnmfciat a2rmnms;t)tetnirciy1lpt auvi s0teurxm3ny1lle lfetlsf Dum(r nu4olxnif3iatfsDrau o () lxoxf3tytfp  ln o s0seum(rpno1ape  ivi t)srumx  ou4aet ifcilt m em(mpn(4tltoir3tytopDe i i (0 rtmio oodlp elnetl(fartmu  no4altoiieils m el(ms;()tlxnxo ta1fpt aneo ()srto(rpny4om  mivsas)s2rrurooo1oexn fcilsls2ulump t) ltoxf iotomt  ieolt0t2xr(m oy4openlietltfaDrax o;u0teeoif3iyslm2emump;t4tlxnmfctatla r nvi;s sruoir3oodlm n ict ( a2taum ;t4tpenmfcilt a2rm(vp (0tlerif oatoaDeauvsl(0trurio ou1om  mnet tfaDtrurp;t1olxomieiasls ranvp (0 rtoxfcoytfa ranes s  rxrxo3iu4oltelieil(f rrmu o;u1tltomoeiytfa2el(mont4artrxf3ta1fm ean o;(0srxr(o3nodll  lfeslsf 2tm(rp;t0alxnmoeiytla2em( s;t)altnio iadfmt  ies;t t2urxo3nodlpe  nvsa( a2rr(moot1oetoiieias sDel( on(0arxrxrcty1omDeluvs s)t2xm(m nydalt  fvs ( a2ur(moot0alt mfctat m2rau o u0aetoxr oadfpD au olt texrir3io4amtnmfcslt) Dtmu ono4oltnmfeiyt a elu o u0trtrir3tytoa elieilt0 2uo(o3oo4om   iet t s2ua(mpnu1olt iieiatfm rmnvp t4tlenmf3totlaDeln il() 2umimpoydome lnvsas)s2ra(mo;u1olt  iciad m2umn s (4 exrxrcia1laDelnei;t0setoxm no1omee ncil(  Dra( o;u0openioctyslsDuanvo t)tetoir3oodop e u i;t0 2xoxr3nodlpte fci s  2tmxro;t0tleo feildfa ua(vpnt) exrxr oatoa r nvi s0sexoxr3ou4am emfes t)aDum(  oo0texomfetat mDrauvo ()texoif3oodom rai s;(0sruo(o oydll nlnetls a2raxm ;u0olxnifeiydls eaump (4trxniocootfaDeanei;t0t2uoxo oy1opt mfes t)a2ta(ront4tpxn ociyd aDraumo;u) lenmrcia1opD anes (0 exoimpou1lpe lieslt)srraumpoo0aeto f3ild s ea(vo (4 reoxr3tadfptraneslt0tetm(rpiudll n fei ()s2uaxr ;t4oltoifeild s rlu snt0 rtoxfcoa1omtran s;t trurimpoy1ap n icsl(fsDrax o;u4opxomi3iyd s2rm(vs ()aexoxr3iodoaD auvs s s2trirpiydap nlnetasfaDtru  ;o4aptoio3iysla2uaums;t0trxniocootfpD  nei (  euo(r3io4ol nlnctltfs2uax  nu4tltoioetlt sDumumo;t4 rxoxr3iadlp ranvo s0t2uoiopny1lm  lictat  rumx p;o4tpenmiciytla2ua( s t0 lxomfctytfa r nvsls) euoimpiydoptemnci t)sDrmu  ;o4tpx mfetltfsDelumo;u0 renmf3todlmDr nei ()trxoxo3oy1altelnvta( sDrr( p;o1aexomiciytfa2rlu s;(4arxrxo oatfptelieslt0seuoxo3io1ll eliei tfarumxmooo4tleo ietysfsDem( s (4 etoifcoydopt  n ils0sexmxr3nu4alt  fes sfartaump;o0optnif3tltfm umn pnu0 lxnxociydlp   ivi;s  2xmir nudlmte nei tf 2rr(m ot0teeomf3iad sDuln o t0alenxf tatoaDeln ol() 2xmiopio4op   ncsl(f 2urx p;t1tet  icils m el( p;u4trxnmf3iatla  luvslt)trxoirpno1al nlivtatf Duaum ou4ope mietldlm2rmn p;t)trermrciytlmD  nei t)tetoio3nudal   nesas s2ra( ono1aee  f3tydfm uau s t) rtrxr ootoa  an slt setrim ny4llt  fctlsfarrrxmo;u4aetnmfeiltlmDra(ms;t4alxnirctodfpD  u s (0t2toir nydamenlfeias artrx o;u1apeo feiydfa2emn p;(0 etriocia1laDrln s;t  2xm(rpnu4lme lnciatfartmu ont0optnioetydfm umnmp;u4teeoif oatlp eaueilt)seuo(r3io1ole mnvi s  rrmurpoo0ope  iciatlmDulu s;(0 etrxo3oytlptrln i;(0srtoim3iydapenmnvsat) Dtmx  ;u1tex iiciatfmDra( p;t)aexomoctytfmtr ivolt0 etoxmpnudlm  licslt)sDrm(mpnt4ope mi3iat m2uanvs (4 eeoiociy1fp r ueo t) etoim3oydal elfvt sf Dtm(m nu1tlxnio3tyd m umuvonu)alxnif3totomtranvi;s0 2xm(rpnu4llt  ivias aDrm(mpot1opxnmieiyslm rau s (0 reomf tatomt lu i;(0 2xoir iodamt  ivsl(f 2taxmooo4teeomfctldlaDrmn s (0arxrmr3ootlmt livs ()sexmxr3oydamenmfeslt)artmxmpnu1tlt moeiasfmDraumpn()tlermr3oo1omDr n o;t0 etrxrpou4lp   fei tf Dum(rp;t0aptomf3ils a um(vonu) rtomr oadoaDeaivi t) rxmio oy1lme  feia()s2raum nu0olxomietydfa eaump;()artnmrctadoaDrlu s t)s2xriopiu1apee fcsltfaDtmxmpot4tpx  iciysfa um(vp;u4alxrircoodlm rlivo t0t2xm(o nu4opt  nvs s aDrmur oo4alx  fetatls2el(vo;u0 reoir3iadoaDranvslt0t2tm(m3iy4altemivs t) rrr( oot4oeeo oeildla2rlu o;(0 ltrircta1lat lnes s seum(o3oodllt mneiat) 2raumpot4open fcils a ea( pnu) lxomf to1faDeaueolt seumxo io4amee ict t)a2uaxronu4tpt miciytfa ra( p;u) rtomrciodlmD  nes ()t2xo(o oy1am nlfvtasf rtax  ;o0texnmieiatfaDumnmsn() lenxo iotlm   neils0 rxmxm iodolt  fvi s  2umu ont1tlxn fctysfsDrlu o t4 eenmo3ia1lmteau o t0 etriopnodalt lnvsas a2ra( o;u0opt  fciadlsDumnmont4altnmr3iydfa e i o;(0s2tmxr3oudal nlfcsa( s2raxm nu4apt  f3ildfm2ea(vs;u4 rxrxf todlaD aneolt0s2urirpoydap n ieiasfs2rmu  nu4tet mfciadfm2uanms (0texoir3todla   ueil() 2toim nudam  lncsa( sDuaurp;u1olen iciltfaDrlumsn(0teeomfcoo1la rli ils) 2trirpno4omtemiet t)s2umxm ou4texn o3iadfsDulnms;() rtoircoytomD liesls0s2tr(o3oo1oltnlivtlt)artmumoot1aleo o3iys m uluvp;u0 lxnmo3oo1la elivo s0s2tmxrpnodoptnlfetlsfaDtm( ont4tlxo o3tytlaDra(mp;u0 ltnif ty1lptr ueilt)sexmir iy4al emnei () Drr(r ;o0olx  fciysfa2ul( p u0aetnio oydlptr neolt)trtoir3nydameelieils) rtaxmp;o0aeeomietadlm2em( pnt4 etnmr oodfmD  iei;s  rxrio nodom emncsat)aDtru o;u0alx mfciltfa emuvo;u) ltnirctydfp   nvi (  rxoir3oodoltemneia( sruax  ;t4aetnioeiadlaDeln s;(4 eeomr3ia1la  li ils) rtm(o oodllt  netls)a2trxm no4alenmo3ilt a2em( snu)trxnxoctadom rlieo;t)setr(opoo1ape mfct (  Drrxroot0alt  fciysfs2um(vo;t) ltnxo3tytfm elu o ()srur(m3io1ap nmfesa(faDtmu onu1tleo iciadfm ulnvonu4 exomf to1opt  i s;()srurxmpno1lmtn nvtatfs2tmx poo1oeeo f3iydfs rmnms;t4tleoiocootla   iei (0teumxr3iu1lm nmfcils)aDuaxm oo4aetoiieiyd m raumpnt0alerif3oatlaDeaivo;(0t2toim ou4lm e icsltf Dumx ont1apxnmf3tys m2ulu s;()altoxo3tytlm   ueo;() etr(o3ny1lpe mivta() rtaxrpnt0tpeoiociasfs2ul( onu0tlerxf ootfat  u o t srur(r iu4al   ictl()a2rmu pnu0oleoiietydfa2uanmpnu4texomo3io1omD ai olt)srxriopnudal nmnvs sfsrrr(r oo0tltomieiasfa2ulnvp u0teeoxfctodop elu ol()s2trxm3nu1op emnvta(fsrrrx pno1oleniieiydlm2eaumo ()altoxocoo1faDean i s) rtm(m nu4ap  liei sfs2umxrpou1alxnmi3iat a eluvs;(4 exoxo todfa r uvo;() 2tmirpoo1lpte fci s  2tmu poo0ape io3iyd m2ua( snu0 rerir3ia1la rlivil(0 rxmxopiodamtelnctltfs2rmxm nu4alen fciasfs ulnvont0 ltnmoctotfm rli o;(0 2tmxr3nu4ol nlfviasfa2urxmpou0tpeo fcildfm rauvp t0trtoxo3ia1op rai ilt)s2uoxrpoodale micsa()arraxr nt1tpenioctldlm2umumsnu4trtnxr3iotlpD  uvs;(0 eumxo3ou4lptnlfvias a2um(root0oetomfcils s2rauvp;()tltnif3io1lp r neo;t  etrxo io4ome lfes s aruauroot0tpt  ociys m umumon() lenircoadfpt  u s (0srurio iu4amtn netltfs2trxm ;o0tlx moetls m elnvo t4teerxf totop   nei;(  etmim3oydole  ivilsfartmxront0tpe  fetldlmDrau sn(0areoxrciodfaDrln o t0trurimpou1llen fvslt  ruaxro;u1oetnmoeiyt m2uln onu0 lerifciotfm rliei s) rxoxrpiy1opt livil(fsDuaxr ;u1tlxnmoeiltfs2ua(ms;(0teeomr tadfat  uvs;s teur(r3ou1lltelfctat)srrrxmoou4oleoif3iytfa2umums t0altoxrcoa1fpteanes;( texm(mpiy1altnlict s)aDra(rooo1oex if3iytfsDua( pnt)tetrxrcoodfmDe nvsl()sexoxrpiy4ap  mnesls sDtr(m nu0aptoifciadfsDrl( ont0 rtrmo3iodfp r n s;s0setrxm oo1aptelfvt ( srtmur nu4aeenio3tydfa ea(vp (4 reoxfctotlat  uvi s) exoimpiy1alt mfcsl( aDumumo;t1apxomicildfmDean o;(0 renir3to1fptelnvols)s2xrir ou4ll e nvtlt)s2tr(root1optnioctltls2elnmont4trtrxfcoytomDeauvilt) eto(r3nodal e nvtas) Dtm( pno0tpenifeiydfmDrluvo;t) lenmr tadomDeauei;t0t2xr(o3iu1lpt lnvslsf Duaur ;u4opx  o3iytfa ulnvs (0 lxrir ta1opDe ivol( seuoxr3iy1lme lnvs tfsDrm(mp;u4tetoiocils m ea(mp (0artrmrcoa1oatelneil( t2umxmpnydolee nci t)a2tr( pnu4aptn iciyt s2eauvpn()teenmo tatlm eaues t0teuoxm nu1lp nlnctl( aDtau ont4oex mociydlsDelnmsn() lenxo3oydlmDr nesl(  2urxo iy4al e ieslt a2rrx p;o1teenmiciyd m2ranvp;(4 renmocta1op raivs;s0seur(opnodopt lnvs t)srrmu  ;t4oleo f3ias a emn o;u0 exnir ty1op elnvolt0srxrxr3iy1lp  lies s  ruaxm ou4aptniiciasfaDem(vo t) ltnio3iodfm  an i t trurimpio1ap e ieiat  Dta(mont4apeoioeild sDua(mon(4 rtnxf3tatfm eau sls t2umiopoydam emivtls) rrrur no0tet  ociadfaDrluvsn(0alxrxo3iydlp rlieil() 2xrxo ou4ome mnvt t  rta(r no1olxomietls m2em(mp u0trtriociy1lm r n ils)seuo(r3ou4alenlnctat  2um(monu4tlxomoeiasfa2rmn p u)tltomrcoadlmD  n o;(0 eurio3ny1ll   netl(  rtru  oo4oeto i3tas a ea(msnt)alerir ta1laDr i i (0 euoxm iy1lp n feiasf 2umx  nu4oet mfctatlmDumn s u0alerxf3ta1fm  anes t  2uoimpiydolt mies s  rrr(rp;o0oexoif3ildla eau o u)altomf iytfpD  ieo;s)setr(opiu4opte net () 2tmum nu4tptoio3ildla2uan o;(4tlermrcia1lmDeli s () rur(r3iudome  nci ( srraxrono0ape  ieiydla uauvsnt0artriocoatfm elues t0t2toxmpiu1olenmfvilt) rtrur ot1apenioeils mDra(mo u)artoif oydom rau o s) exrir oy1olen nei ()sDtmxm ;o1apt iiciltfa2rmu o;u)tlenxfctydfa  lueol(0 2tmiopno4aptn fvtat)s2trxrooo0tpe ifciltla ulumsnt0 exnio oodomDelnesls sruo(opio1olen fetat)aDrrxrooo0ole  fciatfs2ul(msn()tltrmr totoa  lnvs;t0 etoxr nu1alen nct s)s2ra(r no0alt  f3iad a emn pnu0 lerxr3iadlmte u sls)t2xoimpno4omeemnetlt sDrrur ou1oeeo ieiasfa2ra( s t0 ltoxr3io1lp  anvil(0s2xo(r3io4am nmnvt (f 2tru  ;u0tpt mietls aDemu o (4aeerxf3totlptr ivi;t0trtr(m nu1omeemnviltfsDtauro;t4alenif3iysfm2rl(mp u)tetrir io1lat aueo s0 2xr(mpiudop emnes s srtaxr ou4tltniicilslm rau s;u)alenmf3tadoatelu i;s0seurxo3iudale  fei t) 2rrx  ;u1apxo octas aDran p;u0trtomocio1oa  aiei;s srur(o iodlmt mnciasfsDuax p;u0apxnifeilsls um( sn() eermociydla  aivol() ruo(o no1ll elfviat)aDurxrp;u1olxniieiat sDua(mo;t0teerirciytlmD aneil(  exoxm nudlpe  neil(f 2rrxmp;t4alen oeiydla2ua( pn() ltnio io1faDrlnvolt)truoim io1ale  ieias aDua(r ;o4aeenmi3iysfaDem( on(4tlxrxocty1oa  an i t0truoio3iy4omt lfcsa( aDur( ont1oleoio3ilslmDumn p;t)altoxr3oydomD li o s)texmxopnu4ope  ncils)aDumxmp;u0oexnmieiaslmDumn on()tetrmociodfpt  i i (  ruoxopnudole  fvtat)a2uaxroou4tpx ioetltfs uln s u0treomfciotfpDrau o ( trtmxopou4ol elietl()arumurp;u4oexniiciysla rlumo;u4altrmfcoodla elivol(  rtoxm3ou1lmeelivilt) Drmurpot0apxo oetat s2ulnmo;t4tlxrxrctytfm ran sl( srumxr oy1op nmfei s aDraxrpot1aexo f3iltfsDua(mp (4aexrxr3tadoptrai ils0sexmir3oy1lmenlfvtas)sDua(m nt0oeeomf3iadlm2rmums;u)aetoir3iadlpt  nvs;( trtoxopoy1lme mnvtl()a2ra(rono0opxn f3tatfmDranvp t0trenifcta1lat  n i;s setrxrpoo1ll  miesl(fsDurxmonu0tlx  ocias sDrauvsnt4 exrxrcty1oateauei;s)trum(rpiu4amte ietl()aDta(  ot0tltniietatlmDuan o (4alxnif3to1fp rli s (0teum(r3oo4aleelncsa()aDrmx  ot1apt mf3tyd s2eanvpn(4 rxrio oydoaDelieslt0t2toir3io1oleemnes t) rtmxm ;o1tlenioctlsfm um(msn()aeerir3iadomtrln i s) 2trxo3ou4lm elnei s)sDrau ont0aexnifcils s2eauvsnt)aeenmfcoy1fpDe ieo;s  etmim3oudope miesasfa2ururonu0alxnmfcilsfm2ua(mo;t0 exrmo io1lptelnes s texriopiy4omenlncs s)sDur(ro;u1ole moeild sDeaumont) eermf iydlat lu o;t) 2to(r3oodlleemfvsat a2tmu  ;t0aet mi3iaslm2eanms;u4alxoifcoadomtr ues (0sruoxo oudll emietat)srrmx oou0ope mfciyd a2uluvo;t4 renir3oy1lmD li sls0seur(rpoo4ole mncils) 2rrx pou0alxoifeilsla ea(mpnt0trenmfcoadfmtelueilt0srurxopnudom nmivs t)srtau onu1oeto feiytfsDrauvo;(0aeerxf3ia1oa rau ilt0t2uoxmpoy1ame mies tf Dtau  ;t4tpt  ictat aDelumsn(0arenmf3tytfat  ivi s0 ruo(mpnu4lpe mnei (farrr(m ot0tlen octydls emu s t0 leomocoodfp eau o;t s2umio3nu1om eliviltfa2trump;o1oeeo oeiatls2elums;u0 leomocio1fatran o;(0s2tmirpiu4apt mnetasf Drmx o;u4optoii3ilt sDrmu p u4 ltnmo3oodfpD  ivs ( trtoio3ou4omt mnct s)a2rr(mp;o4alx  feiad aDrmnmo;u4trxoxrcoodoatr n o;t  eumxm3oy1aleemietasfa2taurp;t1tpt if3iasfa2umnvonu4aeeoxfcia1fmD ai ilt) 2trimpiydlltn fvs (  2ta(r nt1olenifeiasfa2ulu p t)trenmf3iydfmt lnei;s0t2uo(r ny1lmt  fcil() 2rrx pno0alxn fcilt a el(mo t0trxnif3tytoa eau i (  2tmxmpiy1lmen nctas a2rm(m ;t4tpxniictatlm eanvon(0aexoifcoadlpDelu ilt0 eum(m3oodlp elict (  2rr(mpot0apxnifcildls uaumpnt0treoiocoodop rli o t srxmxrpiu4lm nlivs s a2umx o;o0tleoio3tadls eln p;t4artomr3oy1lp eaneols0s2tr(r3oy4lle  fvt t srrmxmp;t0aleoii3iytfsDrluvonu)aexrmr3oodlateanvols0srtrio3oudaltn net s)srtm(roou4apeniiciytlm2rlnms;t)aeerxfcoydlpteaueo (0truoir3io1aptn fvil( arrrxro;t1tpe mieiadlmDelnvs u)tlxrmf iadlat au o ()s2xo(o nu1altnlncils)sDrrurp;u1altn ictadlm ulumonu0tlxnir tydfaDelu s;t0 rtm(m3ny1omt  fviltfa2ururono0apto o3taslm2eanmp;u0tetrxfcoy1lmtrlu sls  rtm(opoydapeelnesat)sDrmurpnt1aexnifetld a rm( o (4 lenxr3ootoa elues;t t2tr(mpio4al emnciltfaDtr(m ot1oltnioeilsla2ua(vsnt0 ltnifciadomDrlu o;( seurio3oudopen fctasfaDrau  nu0teen fciatfa2rm( p (0aetrio3totfmDraieo t t2toir nu1lp   ieta()a2taxrpnt1tltoiictatfsDem( o;t4aexrxocoytlmDe u o;()sexmxopou4opee ncta() 2rmxmont0openmfctydla elnvonu0alxnio oadlm rluvils0sexoio3ou1al n fctlt  Drrx p;o1oeeomfciytla ra(mon(0arenmo3io1laD ai s;t srto(o oy1optnlivtas) rur(mpno1altoii3ildfs em(mo;t)aexomf3io1fmD  nvi (0texm(m oo4ap e nvtat)srtm(roou1opt  oetytfa2ranvp;(4alxnmfciotop eanvi;( tetm(mpnudaltn ncs t a2taur ou4ope mietysfsDumuvo u)tetoxrciotlp eli slt) 2xrxm iodolte ici s a2rr(r no0apxnio3tysfs2uln o u0aexnmr3oadfmDe uvs ()s2xoim3iy4alt  netl(fs2tax pot0tlxn fetldlaDrln s;t0trtoxo3iatfm eauvo;() 2xr(m iu1lmen icta(fsrumx onu0oet if3iytfaDemump ()aetomfctadfpDrlu ils tetrxrpiy1opeemfvils  rururp;u4aeto f3tltls2ul(ms u0 renioctydopte u ols seuriopiy1apenmivtls) rtmxm nu4ole  oeiys s ua(mpnt0tlxoif3oo1omteauesl(0t2urxopiodome mfvsa(fartm(m nu4apxnmiciys m2ra(vp;(0aeenmf iatfmDrauvo;s  eur(r3oudlme  fci t) Dtmum ot0apxniietyt aDeau s (4trxrxociydfp r n o;s)t2uoim nydll emfci t)srta( pnt0opxoioeiadla2ra(vp u) exnxf ia1oa eaues;t0srtm(rpnodamenmici tfsruauroou1tex mf3ildfs um( on(4alxnxr3oatfa  lneils srxrxopno1llt mivta() Drmum ;o1oeeo oetlsfmDulnvpn(0 rxrxr oodlpte ivs;s) rxrxo3iydlpe mfvilt)a2ururpot1aetn iciadls2ua(vo (4tlenxf3iydlaDrlnvi;s setoxo oo4op  mivsasfa2rr(m oo0teen o3tas mDel(vsn() reomo oa1laDeli sls) rxo(r3iydopen ict tfarum( pno0teeo feildfs2rm(ms (0 ltrxo tydom  lnvils trxo(r3oy4lleelfcsatfsDta(mont1aexnmfeiatfmDranmsnu4tetnxo3oy1fa ranvol( srto(r3ou4lmtnlfei t  Drr( p;t0aptoio3ilt s2uanvp t)tetnxr3tydfmtr uvsls t2uoxm3oodomt livias arurumpoo4tlt  ietadfs rlumsnt4teeoircio1optraivils) rtoirpiu1ope  neta() 2ta(rpoo4opeo i3iyt m ea( on() rxrifcoy1latr n sls)t2tmxr nodlltelivsa(fsrtmump;o0ole mfeiltla elump t)trermf iodlp ean s;( t2uoxr no1lle mfes t)sDrm(  nt4aee io3iatfa2ua(vsnt4aexoifciy1lmteau i;t) rum(o oy1amtemfcias)aruru pnt4tee mfeilsfs2uauvs;u4trxnmocia1oaD au s;s)srumxopnudop  lncsa()aDtaxrpno4alxnifciltla2ua(vs;u)tlxomr3oodfmDr iei;s0 2xrxr ou1ll e nvilsf rta(  ;o1texoioetlsfa rmnvonu) rxnxo3iydlpt luvsl()seum(o3iu1lptelnvtlt s2rax o;u4alxnifciys sDrlnvs;u4aexoio3oa1oa eau i;t  rtmxm iudll elies s)a2umump;u0tleomo3iytfmDea( p;u) etnxfcoatfa   neo;s0s2tmimpoudop elncils)sDtaum ot4oeeo ocilt s ra( ont)tltrir3oo1latelivs;s)trtoxopou1lmtnmfviat srtm(mooo0olxoif3iysfsDemumon()teeoxo3tatlp eaivo t0 eumiopoy4llee ncs t)srtm( pno1oetnmi3iytlmDuaumonu4 eenif3tatlateln s;( trum(o3iydom emfvtat srtmur oo0tleomfeiltfm2ra(mo;u0trxomr ootfa   ieo t)srto(r3nu1alenlnvtasf 2tru  ;u4olxniieiadla emnvsn(4 etnxf3oydoa rai ols)srxmir oo1amtn fei t  Dtru pou0tpxnio3ild mDemnms;(4 ltrmr3io1lmDeai i t srxmim iodope  iet t)arrmumo;o1tlt  ocild s2elu p t0aetnir tadoaDeauvilt)tetmirpoudaltelnviatf 2taxrp;o4aexomf3tltfmDra(mp;t4alxomrcoatomDelueslt) etmio no4lp  mncia()sDraumpot0ape  feiasls rm(ms;u4 lxnif3iotla   n sl( seuoxr io1llen fet sfartrump;o0apxnioctatla2emnvpn(0trenxo3iy1faDelu s;(0trxmiopnu4lpee fvt s srtru pno4oltnif3tasfs2rmuvo;u) lxnmf oydfaDeluesl(  etmio3oy4llen nvia(fartr(moou4tlx ifetlt m eaumo;t0texnxo oatop e neo;t)trtr(r oodoptn ict ()srta(rooo4altnmfetat a2uan p;(0tetrxf3totfmtr nvo t)teumim3nydomee iet tf 2uau pnt0tptnii3tad sDem( p;t4alerio3oydoatelieo s trxoxopou4lmenlnvt s)aDtaxrpno0aeeniietadls2elnmont)trtrmr ia1oaDe ieo ()tetoir3nodom nmiei sfs2rmxmp;t4tltnmfctlslm rl(vs;u)tltrmo tadopt ln i ( s2uoim3no1ale mivi s  Drmxmpou1opt  f3iytlsDel(von(0 lxrioctatomteauvslt texo(opnodalte nvs s) 2umx  ;u1ale  f3iasfa emu p ()tetomf3iodfat aivslt trtrxm oydop elietat)aDtr(  nu1optnii3tld m2rm(mpn(4 exnxf3oa1fmD lnei ()trxo(opnudalee ict t)s2ur(r no4opeomoeiyd a2uanvp;()teermr iytop r ivo;(0texo(o3iy1am nmfetat  Dtmu  ou4teenmoeiadlm2umnmont4alenif oy1fatelneils)trtrxr3nu1lltnmfes sf 2uax ooo0aetnmf3tlslm2ranmo;t4tetrxo3oy1opt anei;t)sexr(m3iudlptnlfvsltfsrtau o;u4tlt  i3iadfs2emnmp;(0 reomrctodfpDeau i t0s2xo(r iydom nlfvils a2rax oou1ole ioeilsfa2um(mp u4trxrmrctatoaDr uvo;t)setrio oo1optn ieta(fs2trxrpnu1aleomoeiytfsDulu ont4 exoir3iytlm r neo;t  rtrxmpnodll nlivia(f Duru ont4opxo f3iasfa2rlnmpnu4 exrxf3ty1fa  anvi;( trtrxopoodap e iei (fsDrrurono0tpenmf3tasfa ran o u) rtnif iydlmtr u ol(0srxmxopiy4open fvs tfsrtr(root4aee  iciyt m umumon(0aetrxf3io1lpt luei s0seurir iy1altnmfesasfarum(mpou1teeoiietlt aDra(msnu0 exnxrctytlm e ies t  etr(mpny1op elivtas)aDtrxmo;u1olxnmf3iydlm2elu p u4tetoxf3iatlm eauvo s0 rtr(r3ou4optemivtlt aDtm(mpno1apx  i3tys s2umums;u)tltrmf oytfaDrlueolt) exrxm3no4op elneta()a2taumo;u4alx micilsfmDemump (4 lxnif3ia1fmD aneols seumirpoo1lpen fvi sfarrrxmp;t4olt ii3iydfs2rmums u0trxomr totfa ranvo t0seto(r3iu4ale lietlsf 2uau  ;t0opxomoeiatlm uaumo;t0tltnmf tatlp e ieolt0tetoxm nydlmen fciat s2ur( poo4altoio3iytfm rm(mo;(4tleomr to1fmD lneo (0srtoim oydlmen ieils  rtr(m no4olenmoetytfs2rlu o;u0 rxoxr3tadom r nesl( texrxmpiydamen ncilt)sDtau p;u1tpt ioetldfs ea(vs;u)trtoifctytoa eliei;t)sruoir nydoltnlncilt)srtrx ono4oltnifeiyd m2elu s;t4tltnmr3ta1laD  neo t) 2umxm ny1lm  lncslsf 2tm(ro;o4apto fetad a eaumsn()artrmfciadfpDe u sls0sexoxr ou1olt lnetas)aDraur nu4tlt  o3ildlm2um(monu)tlxrxr oydoa ran ol(0trur(m iodom   nvsl()aDtmumono4tlenio3ild m el(monu) lxrmf tadfpDrliei;s  rxm(r ny1olt  nei t aDurxrp;o4oetnmiciyt a eln s (0 lerif3ta1fpD  nesls  eur(o no1ape lncslsf 2tm(rp;u4oleoio3ilslmDum(von(0artnmf oa1oa  ln ils  rxoim oydlm   fet s  Dumuroou4tleo fetyslaDulnvo t0arxrirciytlm rlnvilt0 eur(opou4ale lncsa() Dum(mp;t1oexo fctad s2umn ont0 ltniociydfa eanei ( teuo(m oudlmte ivsls aDtrxmpnt0olx ifciltfa emn o (4texnir3tadfm r ivsls0teuo(mpoo4op  miciasf rumxr ;t4altniicild a elnvp u) lxrir3oytoa  aneo;()t2um(m iu4lm  micta(fs2taxm ot1olx ifciatlaDea(mp (0tlenxrcio1fa rluvi (0s2uoirpiy1ameemfciatfsDtr(r ;u4tetn octydlaDum(von(4tleoiocootfp eaieol() exmimpiydlmte nei t artru pot0opxoii3iatfa2el(vpnu4 reomfcty1lpDrluei (0sexmxm iy4lm  micslt srtruro;t0aexo o3ils aDemuvp;(0 etrmr totlp r nvo s0trxmimpoydomenmivtas)s2tmum ot1tleomo3iydlm rm(vpn(0artrmf3totfmtr uvils  eto(opoydlmtemivtl()a2ra(mpot1tpxomo3iadfa ua(mo (0aetnmr tydfa   uvi;s) etmirpiy1oltemfetl(f Drruront4alxomo3tls a2rlumo;t4 eerxo oodfmteli o;s0trtmxr3iu4olte nci s)sDta(r no4tetnmoeiatfsDrmuvo () eeomf3oo1opD luvs (0 2xm(opiy4lpt lieiasf rraxmp;o4apxnioeild s2emnmp;t) ltnmf totop   i o;t0trumxo nudal n nvsa(  rurxm ou4alx  i3iysfaDuln s (0texoio3iodlpt  uvil( t2xrirpnudllt mnviat artax  ou0tee io3tadlsDrmnmpn(4aeeniociytoptelivols)trtrio nudameelietat) rrmumpot0oetnmoeiaslaDulumo (4 lxoir ootlmteluvi;t t2ur(mpiudapeemfesa(  Duax  ou4tlx ioeild mDrln o u4teenxr3iatom elnvolt0tetoxrpoy4lme lfeils)aDuru pno0oee mfcildla2rauvp () exoxociatfa eau o s tetm(r ou1amte ict ( srtmxmpot0alxnioeiadfsDuauvp t4 lxnxfctotlm rlnvi s truoxo3nu4lp e ietls sDur( pot1aeeo i3tls a uaumpnu)arermr oo1optraneols  rtoxr3io1om elnes s  Dumxm oo1tlx moeiyt aDea( o u4tetrmrciotfmteanvol(  exmimpnu1lpee fetasfarum(m ;u1alen fciytfa2ua(mp;u) leoif oadfaDr i i t0srtrxm3iy1omenlfeiasfaDumxrp;o0tlxoio3iytfs umums t4 rtrmo3ty1oaDelnei t  eur(r ou4ll nmivi s)srtr(mont4oet io3tatla2ulump;t4aexrmr tytop  ai s;t sexoxopno1op nmicsl(  Dra( ont1aeen ictadlm2elnvonu)trxoifciydopteluvi;s)t2tm(m3nu4lptn nvt s aDrr( oou1texo f3iytfs2rlumpn() lxnxociatfm e nvs;s0 eto(o nu1omeemnci t)arrrxmpot4tlx  ocilsla umnvp t4trxrxo ia1op  lneo t) ruo(opiy4altn nctlt)srum(mooo1apt iiciasfm rauvp u0arenmo3oodlptrauvs;( setrxopoy1alenlicsa(faDtmx onu0aptnmicilsls raumsnt4 lenxfcta1fa  lu i;( seurimpno1amt  iei sfartmx oot0alxnifeiysfaDulnvo t0arxrmrcio1optelues t0 2umim iudlm  miei ()srrrur no1teeomfctltfmDum(mon(0alenif3oatla r ues t  eum(r no1ol emnvtat)aDrrxmp;u4ope mfctltlm eln o u0 rxrirctydla rlneol()trxoxmpnodlleelivtlt)srrru  nt1alxnioctls m ranvp u0artomf3oatomDeaivi;s s2trir3ou4opt  ivtat  2tmur ou4aeen oetydlaDum( o;t)aexniocoytomDeau i s setmxr iudlp   ict t)s2trxr ;t4optnmociysfa ran p t4areomo oatomtrlnes;(0trxoxrpnu4lpt lncilsfaDrr(roou1tpe mf3tysfmDumumsnu0treoxr3tadlatrli sls)srtrxr nydop nlics s s2rr(root0apx mfeiyslm uan pnt4 eeoxo oadfp ean i s0 2xrio iodop   fvt t s2tau pnt0olenmiciydla2ran p u0 etnir ta1la e n i;s) 2xrxm3ou4omenmnesl()aDua(  ;t0tet  fcias a2eauvsnu) rxnxfciotom raues;t)s2um(r3ny4lm elfeilt srtrxrpoo0tleo oeiadfmDumuvont)tltnir io1lmte ies;()trxoio ou4apt  nvtlt aDtmu pot1aleomfciydls ua(msnu0 lxrmf iodop  lueo;s  eto(r 
\ No newline at end of file
@@ -0,0 +1 @@
+uvs t sexoir3nydapeelfvtlt)arrr(r oo1olt iieiatfs umuvsnu4 eenxrcto1fpt lu s t  rxrxopoodomtnlfvi tfsrtmu  nu4opx ioetldlaDrm(ms t0 ltrmrcoydopt livo;s0tetmimpou4alee ncslt  Duauro;u4olxo i3tyd aDul( snu4tltoxf3oadfp rlu slt)srurim iy1aptnlietl(f rurxmpot1olxnifctadlmDuln p u0 rtoifcty1fpDeau sls)srur(r oudale lnesat)srtr(rpnt4opxomo3iytls2uluvsnu0aeeomr ia1lpDeauvi;s) rumio3nydlptelncta( arta(mpnt1tle mietldfsDrluvs;t)artnmf3ta1opDran s t0s2uoio nydol  mncsas) rur( ono1olx if3tadlm ra(vs (0areoircto1lp  luvs;t)srurir nudomtnlnvta( aDraxmp;o4tltomf3iys sDrluvo;t0aetnmrctodlpDeaies;t0t2uo(mpnodamee ivt t  Dur(r nt0oetnifeiad m em(vo u4 rtrxo3iadopte ieils0t2to(o3ou4opeelnvsa( s2truro;t1apxnmoeias m2ranmsnt)trtnxrctadfpDrlu il( t2tm(m3oudlmtemfvia()s2rax  ;u1alenmo3tydlmDua(ms;(4teenxr3iodlpD  uvi s trumxm3ou4opte ivi tfa2trxmpoo1tetnifetltfs2rlnvon(4texnxo oytlpt lieo;() 2tmxrpiu4olt mnvt s  2urxrp;t0olen oeilt a rmn o (4 ltnxr iotomDraiei s)t2xr(rpou4omt  fvsatfa2rm(rpnt1tex mocildfm2umump;t)texrifciytla ranvsls  rurxmpnu1oltnmivtl(  2uaurpot4aeeniociyt s emnmp;t4tlxoiocoy1lat luesl(0sexmxo3io4op nlfviasfsDta(m oo4alxnmi3ilsla2elnvp t0 etnir iy1opte u ols) etm(m3ny1lp nlfvtas)srrau ooo4tptnmo3iasls2ra(ms;(0alerxrcty1oaDeaneols  exoxr3oodoltn nvi t  2rr(mpoo0openiictyd a2emumo;u)trtrxociytlm eluvo;s)texmxm ny4lme mncilt s2umum ;t4olt iiciyslaDea(vs;t4 ltrifciytla e iei ( setmxm oodopeelicsatf rtr(m ot0aee iieils s2elnmsnu0aexnxo3ta1fptr iei t0s2umio3iy1alenlnvsa(  2rmxmpot1alt mociad sDuanmp u0tlxrio totom   neo t setrxm3nodamtnlivsasfsrraxmpnu1tlt mfetas sDeanms;(4 reoif3oadlat lnvs t)t2xrimpoo1lp elici (  Durumoot0oex if3tytlmDuanvo;u4 rtrxo3ia1lateanei;t)truo(o io4apenmfct s)srumx  ;t1tptnioeiyslaDrmums () rtrir3tydom e u o;() ruoxo nydoptn fct () 2rmum oo0oetnio3tldls rm(vp;t) lxomfciatfp rluvi;()tetr(rpny1omtnliei t  Draxm oo4alto f3tasfs um(mp;(0artnxrcoadlpt ln s t) 2to(o3iy1apee ivi sfs2rr(m nt1tet miciltlmDemnvs;t0tetoxr oytlaDelueilt)t2umxrpiydoltn nct sfsrra(moot0opeomfetld a rmnmp u) lxomo tytomD luvs;( t2toxrpoodlp   ncsl()srra( pno1tet mietldfm2el(vpnu0 etrmr iydlaDe uvo;s  exrim3oudol  mnvt s)a2tmxrono1ape iocias sDumn p (0trtrxr3iotlptraivil() eto(rpiy1lltn fesa( aDta( ono0oet  o3ildls ulumo;t)tlermr tatla ean s s0teurxm3iydlp nmics s) rua( ono4tpxo i3iytlm2elnvon(0tleoif3oa1latelneilt  rtrxm oo4ll nlnvsa() 2ua( o;u1aptnifctldlmDua(vo;u4aetoirctydlaDe n o ()sexmxr iydam   fviasfsDtrxmont0teenifetyslsDrlu o ()arenxoctodoa eln sls)teumxr oo4alt  ietasfaDuru ono0tltnifeiydla umums;t) rtrifciytfaDeln ils0trxo(m nu1opeelicil(f Dtm( o;t4apx  octyt s2ranmon(4teerir3to1oa  auesls  exrxo oy4lpt  fci t arumu p;u4oleoif3tls m eanmo;u) exoxociy1fpDr ieo (  rtmiopiy1lptelfesl(fs2rru ooo0oleomociytfaDrln p;u)tlenxf to1lmDrliei;(0tetoirpoodop  licilsf 2tm(  ot0tetnioeiltlm uluvp (4alxoxrctydfatraivo t)trur(m3oydlm emfvt t) Dtmumpoo1aexnmfciyt mDrl( o u) rxoif iotfptelivi t0texmir nu4aptemnes t s2rm(  nt0aexnmiciyd m2ra(vo;(0texomr3iadlp eanvi (0 2trio iydalt  ieta(f 2tax p;t0aex ifciydla2raumo t4arxrmr3oodlpt aies;t0trtmxopiu1op n fci t  Drmxmo;u0oleomfctldlaDuauvp u0tlxnxocoytfpDeln o;() 2umxo3ou4llt miesa() Dumxmpnu4apt ioeiltfaDua(mp;u)arenxf3iydlp rln ol()truoim3ny1ol  lfviat s2trxr ot0oleo ictys m2ra( s;t)arerxr ta1late n o ( s2triopny1olen feil( a2ua(root4openiocilslm2eanms (4aleoiocio1lmDr uesl(0 etmxrpnydomte ivsat s2trxmooo1alxomictydfm2uln s ()alenmo ootfa   ivs;s  rxrir3nydlpee net t)sDrmxr no1olto fcild a ea(vs (0 exoioctydoptrlu ol(0 euo(o ou4lp n fviasf Draump;t1altoio3iatls2ua(vo;t)artrif oydoaDe ueo t) eumxm3oo4amenlfct sfsDraumpnu0oleo ociatlsDumuvs t0aexrif todlpDr uvo () rtoir oydlmtnlieil(f Durxroot0tlt iictldfs2rm(mo u4 lxrxf3oatlpteau i s0teuoxmpoydlle mnvsls) rraur ou4aexomfciytlm ua(vsnt) rtoxo3oy1oa r iesls0 rtmio3iu1ame lfvsat srtr(m ot4optomfeias m2uau onu4 leoir tatfmDeanei;t0 rxr(r3ny4omtnmicsat srtaur oo4tleo fciydfa2rmnvsn(0 lxoxf oy1lm   ivo ()s2xo(r iu4al e nvs ()sDtmxmp;t1aexoii3tadfa rmuvo ()trxnxr oatfptrlivs t) etmxr3io1lp nlneias) Drmur ot4tet if3tadfmDean sn(0 eenif3ty1late ueils sruoio3nydalenlnetl()a2tau pnu1apto ieiydla2rln onu0alenmf3iatlate n s (0t2xoio3iodom  lnvsas)s2taxmono1apxnifctasla ra( p t)tltnmr3oy1latr nei;s0 euo(o oodaltemneta(fsruaxmont4alto oeiltfsDum(mp (0aeeoio3oa1oaDeaneolt0s2xr(o3io1lleemict t) rraurpno1oeeomf3ild s el(mon(0 ltrirctotla ran o;t truo(r ny1ape mfcs s artrum nt1optomfciatls ranvsn(4 rerxfciotoateln i t0truo(opnu4lmtelici () 2rrx pou0alx  feiat a2elnvon()trtoxo3io1lpDr uvil()trxoio3iu4am elfciatfs2ua(root1aexnioctyslsDuan p t0alerxf tadfpDrlivol() 2xo(r no4opeemfctasf 2ra( poo0apxnmoeiatfaDea(vo u0aeerxfcio1omte ieo;() euoir ou4op elnetat)arumurpou1apt if3tltlsDrlu p;(4 rtrxo oy1opDelneo s)srxrim3nu1oltnlfviatfartaumoot1aeenmf3iatls rl( onu4 lenio3oytomD  iesl(0s2xr(rpoy4am n ivsatf ruaxm ;u1oetnii3ias aDra(mpnt0 etnxf3iadfmtrlnvols0tetmxm iu4al  mfesl() 2tmx  nu1tex  f3ildls ul( p;()alenmo3iadlmtelnvil()t2tmxrpny1lp e fei sf 2umx  ot1oexnifctlslsDra(mp (4 reomo oadfmtrai i;s s2umxm oudamtn neil()aDuaumoot4ole  oeiadfa eluvp (4arerxf3tadfmt livo t sexoxm3iodlmeelfvta()arur(rpot4tlenmf3ils s ulu p () etnxrciydlmDr u o s)s2uoxm3io1om  mfctltfa2uaump;t4tee mfeiytla2umn o u0 eeoif3tydfm e ieil()t2xo(o3io4lpt  fvils) Duaumpno1apenmfcils aDem(vo u4 rtrirctytop  lies;()srumxm3nu1omt lfviltfsDtaurp;t1aexn oeiytfmDrl( p;(4aleomrcoa1omD ai i s t2umxo nodlpen ncsas  Duaxm ;t1tptoiieiad mDem(vp;(4trxnifcoy1fat anes ( s2urxo3oo1lptemnctas)sruau p;t4tptomoeiatfsDeanvs;t4aexnio iy1omtr u o s0seum(o3oy4altn ncsat srrrum oo1alenmfetyd mDeanmo;t) reniocio1la r nvol( s2to(o oy1lme livi t)sDtmxmoou1tpxomfeiad a ulnvp;(0alxrio io1omD aivols)seumirpoo4lp  lfet sfa2rm(r nu1alxomieiysla elumsnt4 rtrxo oodfaD lieo t  exmxm oy1alen feta(fa2ta(rpnt1texnifetyd m rlnms t4trxnxocio1oaDelnvo;t)s2tr(opiu1am  miei ( arrmxr nt4olx mfeils a2ea(mp u4tlerxo3iodoa   nvi ( trxmim3nydapenlfvs () Draum ;o1openmieilsls2eau o;u)aleoxfciotlmtrli ils)trtmxr nu1lmenmict (f 2ua(ro;t0opx  ociltla emnms;(0tleoxrcoadfpD li s (0 euo(rpio4altemneiat)sDrmxmpoo4apto f3ilt a ranvp u)alerxf3tytlp  auvs (0 exmirpnu1lp emieilt aDrmu p;u4tlxoioeiadfm2raums (4aleomocio1omDr n sls)t2xriopiu4al elict tfsDur(rpot0alxn ieilsfa ea( s;t4 reoir3oydfa eli i s)t2xm(mpou1op emnetat  Dra(r nt4tet  fciytfs2ulnmpnt4 ltoif tatomt lu o ( srxrio3nodopeemnesls  2tr( ooo4ape mietyt m eaumo;t0trenmociodomtr nei;(0 rtoxo io4apee fes (fartmum ;o4tleoioetas a emnmonu)aeenxr todomt  iesls)truoxm oydlpt mncils aDuau ono1texnif3iytfs rmuvp;t4treoxf3oo1fat lnvs;(  etm(r3io4om emfvtls  Dua( o;t4altniocilslsDrm(vsn()tlxomrcoodfaD ln i t) euo(m3nydaptemneslt  Dur(mpnt4oltomfctytfs2rm(vsnu4tetnxo oo1opD  uvs t0setoim3iu4opeelictls) rrm(rpoo4aee  ieild s2rmnmsnt0arxoio3iy1lm rlieo t s2triopiydlpt  ivi tfaDta( o;u4oeto f3tldfs emump t)tlxoio3iatopDrliesl( tetoxo3oy1altnlfviasf Dra(mont1olx mf3iysfsDemnvsnu0teeomo3todfptr n s t seumimpio1lmt lncslt)aDum( onu1tlen oeiatfm rm(mo;()alermf oodlm raivol()t2tmxr iy1ameelfvils) rtm(rpou1apxo oetad m2ranvpnu0aleoxo oodoa  lu o s0trtm(r oodlpenmnvt s srumxm ot4aexomi3iad m2eanmp;()texrio oytla raueslt)teumir3ou4ll   nctls srraumooo0open oetadlaDrlump;()artoif oytlate ivs s)teur(r3iydoltelnct sf ruaump;o4oleomo3tysfm2elnvs;u0arxoio ia1fmDeai s (0s2uoxopou4al  mfci sfaDuau pno1oee ioeiatfaDrlnmonu0aexoxr3tytlaDrln ol()trtrxr nydap e ivi (fs2tr(ro;o4alxomietyslm2emn pnt4 rxnxr oy1opD  nei t trxrxo iodlm e fct sfsDtrxmono1tpx mo3tydlsDean p t0aexnifcto1lp e i ols trxoxm oo4opt mnet tf 2uau ono4tlxomi3iysls2ul(mont4 rerxo tytla   u slt setmio ny1ap  miei ()sDuaxmont0alt mietadla rlnmo (0 rtnxo3tadomtelivi;t) 2xm(r3iu1lp emnet (fsDumxm oo0teeomfctyt s uan s;t) rtnxrciadfaDrlivo (  2xrxr nydaltnlneils) rrrurooo1ale ii3iyt aDea(msnt) exrmf iotoa eaieils)seumirpiu4amenmnvi sf 2tm( o;u4tptoifeild mDelnvo t0 eerif3iadomt  nvi (0trtmxopio1oltnmnctl(f 2ur(rpot1tpxomi3iat aDulums u0 etnif oadom r neo;s)s2uoxrpnu1al nmfci t aDuax  ;u4aptomiciysfm rlnmsn(4tltnio3oy1fm r i i;s s2tmxopou4ope lics (  Dumxmono0alto ieiltfmDeanvsnu)tltomocty1laDe u i;s t2um(m no1ape  ics s  rrmumono0aeto feiltls umu o (0aleomf ia1lp rlnvi ()seumimpiy4llenmnctat) rrmxmpoo4oexnioeildfmDranmo;u0alxnifcoadfpDr n i t) etrxo3oydol   ies tfartrxr ou0tleoio3ildfm2umuvp;() rtoxo totlm eaues t trxmir3no1omtelivs t srtm( oou0aeeo octys sDuln p;u4teenxr3ta1lp  lu s;(0seuo(rpiydap e nvs (fa2ra( onu0alx mf3iydfs2umumon(4 exnmr oatom r ivslt t2xmxm3iodll   ivs (fsrtr(rp;o4optnmfeilt sDea(mp t4 eenxf3io1lp eluvols) 2trimpny1om  livi t)s2trxrpot0tlto i3ild m rm(mpnt0aeerir3to1op e ueols) rum(m ny4optn nvsat) 2rrx oot1tltnmfctydfsDum(vo;() rtoirctatomtranes (  2umir iydoptn nvtasfs2uaumoou1alxnmoctatfm2umump;t0aexnxfctadfmtrlues;(0t2xr(o3iu4amtemict t srur(ro;t4openmieild m ean p u)artnmfciodfpD  i o;t t2xmir3io1llen fci t)s2rruronu4aetoiociyt aDrmn s;t) exomr iydla  liei t  euoirpiydlptnlfeslt)aDrmumont1aleoifeias a2um(vo u) lxnxo ty1opt ln i;t0srtmxm no4lm nlfctlt srra( pnt0aeeoioetytfs eaums (0tlenxoctadoatelies;s)trto(r nudlmenlietlt sDtr(m oo0aet  ietltfaDeau p;u4arxoio3tydomD anes;s0t2tm(r3nydomeemnesa()srtr(rono1oltnio3iysfa2ua(vsnu0aeerioctodomt li o t0trxmxo oydomt liei ( sDra(root4aleo oetld aDrlumsnu0teenif3tytfpD ai i;t0srurxmpoydlpte fvt s)a2rrxmp;o1texomfcilt s2raumo ()arxrxr3io1la e ivo s0trxoir3iydal e nvsas)srurx oou0alxniieils sDel(ms;t4tlxnxf3oodfmt au ilt0trxmirpoy4opee nvsa(  Dur(mont1alx io3tldlsDemuvsnt0aexoxr3totlmtr u s t  rur(opnodop n nvsls)arrmx pot1tpenif3ias aDel(mpnt4trtrxf3tadlaD ai sls s2xmxo io4omee ieil( arrm(r ;o0opxo iciatfmDea( s t)altrxo ia1lpDrln o s trtrxmpiy4lpt  nct t  2tax oot1tltn iciysfsDem( on(4tetnmrcia1opDrluvo t)srtm(o no4lmenlieil(farumx pnu4texniiciytls2eau o ()tltrio3oa1laDe n ol(0 2urxr3oydomtn neils sDrrxmo;u4aptnmfcilslmDean p;u4 leoir3to1oaD an olt tetmxrpiydap nmicils)s2tru onu0tpxoii3tyt s ea(vs;(0arerxr oytlpD  n o;()texm(r3oudop  lncsas) 2ur(m ;t1oee mo3tlsfa2el( p u4tlxrxf3iytlpte ivsl() 2ur(m ou4amenmicsasfsrtaur nu0alxniocilsls2uln s () ltomfctadoaDrli ilt)t2um(o nydomeelfcil( arra(rpou0aetn oeiasla rm(vp ()teeoir io1fmDrlues;() 2xo(opoudlmee fcs (f Dra(  ou0teenifctldfm2rlnvs u)trenxo iytomtr nvs t0setoxm3oy1amtnlfetl(fsrumx o;t0tpto oeiytla eau p u0trxoxociotlptraues ( s2um(rpio1llen nei ()sDuru  nt0oeeomieiadfa umn o;u)aetoifcoatoatrauei t t2um(r no1opt  ivt tfartmx ono4teto f3iltfm rl( o;()aexrmocoo1fa rai o;s0 2ur(mpoo1optn nvilt)sDuau poo0oleo ictysls rl(ms u0aexrio iodfpDrluvo;s)seur(r oodolte fcsat)aDtrxroot0apxn iciat sDelnms () etnxr3iodlat aneil( s2urim iu1ol elfciat)arrmu o;u4aleo feilsfm2ul(ms;t)alxomr ootlpD anvs s0trur(opio1lptnlfct ( sDra(moot0tptn fetatlsDrl(mp;u0trtrmf iatfaD aneo s  2urir3nu4lp   ieslt) 2rm( pno4tpt iieildls2umu p u0tlenxo3oy1omte n i;s  2xoim3nydal nmfvta( aruaum ou4oetn f3ilsfs emnmp t0 rtrir3iodfp e nes t0teuoir3ou1lle mfet ( srumx o;o0opeoifeiat m2rauvs (0trermf3oodfat anvols0t2umim oudlp n nci (fartmxmpno0aexo o3iys m2rmuvpnu4tleoioctydfaDr ivsls) 2xmir3ou1lpe lfesa( aDum(m no0tpt mo3taslm2ua(mp;u0trxrmo oatla eln i;t0t2xo(r3iu4amtemivtlt)aDurxrono1tlx  ieils mDeluvs t4 lxoifcto1lpt lieo s seum(m iudaltnmfetasfa2uaur nu1tpeo f3iltlmDrmums u4tlerxrctotfatrlu i;(0srumxmpoydomeemfeilsfa2umxmo;o0apt mfeild a ulu o;t)artnmr3tydlm  aieol( trum(opno1apte fcta( a2rrxm ou4olenio3tatfm rm(mo u)arxrxo3io1fat  ivo;s setoxr oudomt mies s) rua(mooo0optnioeiyd mDelu o t)aexnxf3ootlm elivi;s0trxmxm3oy1olenmiesas srumxmpot0aee io3iys mDum(vp t4altrmrctodla  anvs;s sexrio3nodop   ics () Durxro;t1tlx iiciatfaDranvs;(4tetrmr3iotfpDrai s;(0seuoxm oudam nmnetlsfaDtru  oo0tlt  fciltlm rlumo;u)tlxnmr3iotomD  neil(0t2umiopnydopee fvsls s2rm(mpoo0tpx mi3iasfaDeaumo;t0trtoxf3oadomDr uvi (0t2to(r3iy1am elfetatfa2urxm ot1tlxnmoeiys a rl(vp t4altnxrcoodfp e iei;t s2xriopiudlpe  ncia( srrmuro;o1tetn oeias aDranvp;t0 rtrir3totomtraueils0t2tmxr3nodam n fvil(fsruaumpou0aetnmieiyd m uluvo;()tltrmr3ia1fmDraneo ()srxmxr iodale mivtlt  2tr(mpoo1aet mociltlsDemump (0 rerircoa1fp  anvol(0t2trio oydopen ict s a2uaur ot0alxoio3iytfs2ua(vpn(4tlerxr3iotla e ues;t0t2uoxm iu1ap emiet ()aDraurpou4alxn fetatla2eanms t) ltrmf ta1fpDran i s0setrxopoy1ll nmiet t aDtmx  oo4tpen ieils s eaump (4 lerxr iytom r n s (  rumxo3iu1om n ncsasf rrr( poo1olt  ieiysfm2emumpnu4 lxnmf iy1oa elivs t) eurio3io1oltelfct sfs2umumpoo0alto o3tysfa2rmu s;(4 rtnif iodlmDrli s;s)tetriopoodlm n ivs sfs2ururo;o1olt io3iydfsDemn p;u4 ltrxo3io1laD li s;t0 rxm(m3iydom e icia( aDrm(r no1aptn f3iatls2rluvo;t4 lxomo iadomDelneslt) etm(rpio4lp  lictatfaDumurono0oeto iciytfa eanvsnu4 rxrir ta1oa   i s t)trumxo3oy1oltnmies ()arurxrp;o0opxo f3iydfs umuvon(4 rtnifcoydfp raneolt0seuo(r ou4lm nlnvs t  Dtrumo;u4tlxomiciysfmDrau s;u4arenxf io1oaDrauesl( teto(m oy1lpe livsl( a2trx  oo1oet  o3iysfmDra(monu0alxrmrctodoa  aues t0 exrxrpou4omt lfvtas s2tr(m ;o0tleomi3iatfmDrmumo (0 eerir io1om  lnei t)s2xmio oo1olenlicslt)s2umu  oo0opeo fciyt a ea(monu0tlerir3ia1fpt lu s;(0s2tr(o3ny1ll elnvils)s2rruro;t0tet ifeiyslmDranvs;t0teerxrciadfpt  ivs (0texo(o no4ap   icsa()a2tr( p;t0oexn fctltfm2rauvp;(0 ltoxfciydlmD an o (  rto(m3no1lpeelnctl() rrrx pno1altnioeiat aDulnmp u4tlxnmr3iodfmD  i ilt srxm(r iudopeemiesas)srraum nt4oltniietas a2rm(vpnt0 rxrio ia1oat  uvo t0truoim3iy4apeelivs s aDrax pnu1oleo ociasfa eau s;u) exrirciydfpDelnvi s)s2uoir3nudaltnlnct t)aDtrur ;t4tlxo ietlsfs rmump ()tleniociotoat au ils) 2xoxr3oy4altelfct s  rrrxro;o1oexnio3tyd aDea(ms (4trxomr iytomtrlues s  rxrxmpoo4omtnmfeta()aDua(mpou4alt  oeias aDrauvo (4tltoxf3ootomD aiei s  2xmxrpiudalt miesa()sDuaxmooo4altomo3ils mDem( pnt0trtrirciodlmD  n s (0tetoxo3oydaptnlfvilsf rrmurp;t1aet mf3tatla um(mpnu4 eenifcootfptrlnei s sexoxmpny1lltelfeslt s2rm(mono4aexo ietadfsDul(mo u0alxoxocoydom eaivo;t srto(m3ou4llt  fvils a2trx oot4olxn i3tat aDemuvont0aexnif oodlmDr n olt teurirpiodlmtn icia(f rra(mpot0alt ifetldfm em(ms u4 ltoxf oytfmtrluesl() rxm(r3nodap  lfvtlt) Dra(mpnu1olt  oeilsfa2rmumsn() etoio iy1fm e ies (  2toirpno1apte fet t) 2trxroou1tpenmfetlt sDrmuvont4arerif3todfaDrlnes (0sruoxm io1amtnmnvsatfa2rr(m ;t0tleomfetadfm uanms (0teenxo3iodfatrau sls setoxopiy1oltelfes ()srtrxront1opt iiciyt a ulnvsnu0trerifcoa1oaD lnvol() exoxm3oo4llte icsa(  Drau pno4apxoiictlslm ua(mo (4teeoio ta1fatrlnei;s0srtoio3io4lm  lictl()sruaurp;o0oetn ociyd a2uau p;(4trtnxf3oydoa  lu s () 2xrir ny4op elieiltf 2rmx oou0tpe ifeiad sDelu p u0altrxocoy1op eaueol( texm(o iu1aptemncs (fs2uau  nu1apt iociydlmDraumpnt4 rtnxf3oy1fpteaivs s) rxr(rpiu1omeelnes t)aDuax ono4tet iieilsla2eluvs;(4 eenxr3ta1oa  anvi;t0tetm(r3iu4om  mnvs (  rrm(m nt4olt io3ias mDelu p t)teeoxf3ta1fm r ivs;s s2uo(m3iydlpen fvsltfs2tr( pnt4aetoioetlt m eauvo;t4arerxocia1lmt luvil(0teuo(r3ny1apeelneia( arrrump;t4oltnio3iaslm ul(vsn(4texnxf3oy1laD anvs t  etoxopio4am elfvi t) rtmu pou0olto fetasla emu pnt4 reoxr3iy1lpDran s ()srxo(mpoo4ome mici t a2ra(  oo4tpe mf3iadfs ulnvo;t)texrif3tytfpD ln s t0 2xm(r ny4lmeelict sfaDtrurpnu1ope ifeiatls el( o (0aeermr3iy1lmtean ol() rxo(m nu1lme lncs t)srrrxm ;u4aetn octlsls eauvsn(0artomr3oytlaD  ivilt0trxmxm3oo1opeelivt s sDur(r oo1tlx  fetasfs uau o;u4tetnxr totfpD  uesl() exmxm io4lp  lfctatfsDtm(m ou4oeeoio3iltla2um(vp t0 eeomo3oytfat an s;(0trxmxmpny4lmt mneiat  rur( ont4altnmf3ild a um( p;t4aetoiocoo1faDrau o s)sexmimpoodapeemneias) Drr(  oo4ape ii3tlsfs2rauvp;(0 ltnmr3iodoptranes s0s2tm(r3nodomtelfvtas sDtmx o;t1tptoiiciadlm rmuvo u4trtoifctadlp  au s;(0srxr(mpoo4ole mictlt arrr( onu4aeeoioetltfs ulnms t4teeoxo3ta1fpt  ivs;t)seumxo iy1lm  mfet () rrrurpnt0opxn o3tltfsDumumsnt4 etomr3iytfa elu o;(  2xmir3iy4lmenlnciatf Dumxr oo0alxomociytla em(vo;u4artnxr oydlp r i i;s) rumir3oodomtemfesatf Draxmpnt0alen o3tys m2eanmpnu)alxoxfcia1fat aueolt  exo(rpiodlp nmiesa()sDur( oou0oleo o3tytfaDrmn p t4 exnxocoadoa  lnes;( s2xmxm io1am  livs t)sDtmu pnt1apx iociad aDra( s;t0trtomf3oadlmt ln ols0 2uoio3ou4lmtn net t a2uru pou0ole  ictys mDulnvpnt0alxoircoa1fmD  nei;s0sexo(o3nu4lp nlfvt (faDrru pnu1apt  oetyslmDum( o;(4tetrxr ty1oaDr ies s0s2urxo3oy4ol n fvi tf Dtrx  ot4alxo f3iys a2elu snt)arermf3oytomD auvsls)trtmxm3nydoltnlnetatfsrrrxront4altn i3iadls umump u4 exrmociydlaDeluvo () exmxopnu1lm  lnes (fs2taum oo4oeeomictatfm raumsnu0trtnmrctatopDrau o;s0trxo(m nodaltnmfvilt) Dur(mp;u4aee  o3tytfaDemuvont)aetomo3iadopte nei t  2tm(opoy4lpe mfcias srrm(m nu4ope mf3iltfm2eaumo u)aeenxo3oadlp  lies (  rumim3io1ape lncsasfaDrmum ;t4teenmfctadla2rlu o u0tetnir3iadlp   i s s)setoio nu1lmtn fvtls) rta(mp;u0olen fctysfaDul(vs;u)aetomfciatlat  u o s  ruoio3oy4lmtemneslsfa2umxmooo1oleomoctysfs emn o;(4aexoxr3tadfaDe ueolt) exoxr3iydop emfcsl() 2tm(rpno0alenmf3tys mDumums (0 rxnio tadlp rlu sl( tetmir3no4olenlfesl()aDrrumpno1olt mo3iysls rlu o;t4 lxrxr ootopt  uvi ( s2tm(o ny4ape  fci (faDurum nu1olto ociasla umnvo;t4trxnxrcoo1fa  aiei t srumir no1amt liesa() Dta(moot0apto ieiydfs rlnmsn(4trerio to1lmDeluvsl() rtrxmpoudopeemfvta(fsrua(mpno1tlt if3iytfm rlumo (4texrxr iodfm r n i s) 2xo(o3oy4lmenmfvtas) rrrxmoot4aet iociat m ea(mo;(4texrxoctodfmt aieslt) exrxmpou1op n fet t) Dua(mono1texomf3iltls el( ont0altnmrctadomD  ivolt0 2xr(rpnodlp elivslsf Drm(m ;t0tee  octydfs ea(vsnt) rtrmocoa1fmD aneils0trtmir3oudlmenlicsls  Dtm( ont1aee  ieiadlsDul( o;u0trxnxfciydfpte ueslt  2tmir oudllte fcs ()aDta( pnu1tlxnioeiyt s2ra( p;u)altrif oa1faD  uvolt0 euo(mpnudlm eliet s)a2tr(  ;o1ale ifctytlm2rlnmo t)alenmo3oa1om eli il( srurxm3nudaleemivsat)s2raumono4tpxo feiydlm2ra(vp;t0 eermrcootomD ln i ( s2xr(o3iu1altn nesas) Duru  nt1apxomi3tyt s2rmnmp u4trxnio iadoaDraivo t0 ruoio3iodal elnct t)a2ra(rp;t4aleoio3tltfmDemn p u0aetnxr3oa1fm raieolt  2xr(m oodal e nctlt aDuru ono4aptn octytls2ranms u4aexnmo iytfaD lneolt0srtrxo oo4am  mivi tfs2urxmpno1tet  f3iydlmDrluvsnt)alermrctodopDrlu s ( s2umxm3no4ope  icia(  rrm(  no0aet  o3tldla2emump t)tlenmo tadlptraueo;s) etr(rpoydap nmfet s sruaxmo;t4opxomf3tad a em( pnt4arxnir3iatop  lueilt) eumio iydol n nvsls aDtmxr ot1aeeniociydla rm(vo u0 exnmocoadopDr ieols0srtm(o iy1omeemics ( a2rrur oo1aetn o3ilt s rmnms;t4aeerxo tytfat lnvsl( t2umxopio4alt mictat srtaxm ;o1teto oetltlsDeanmsnu0trxomo iodfmDeln sls)texr(m oy1lmt lnvilt)arrmump;u0texomfeils a ranmsnu4 eeomo3todlmteaies t0tetr(r3nu1lle  fvia() Drax o;t0alxnifciytfm2el(vp u0areoxo totomtranes;(0sexoir ou4aptemfcsa(f 2tax ono0tet  oetasla2ulumo;u0alxrxfcio1opDr ieo s0 eumio3oo1open fvt t sDraurp;t0oleomf3ild m emumsnu)teenxr3ta1oaDrli olt)sruoio3no4lmeemivs (f rrrx  oo0olto iciatfs2ulump (0tetnmo3tydlaD ln s ( t2xmir io4optn fes sfa2umuronu4opx  ocils sDem( s (0aetrio3iotoatrlies;t  rxrim3oy1op e ncs s)aDtm( p;t1altomieiydla eln p ()altriocta1lp elivi () rurxm no1ameemfci sfsDraxm no0tle if3tldfsDelnvo ()tltrmociydlm rau s;()srurim iodaleemfes s  ruax  ot4olxomoeildfm2umn p;t) lxnifctotfm e nvs s0srumxm nudopee fvtat)arum(m ot4aptnmieild m2rmump (4trtnxocoydopDr uvs t0trtmimpno1oltnmicias arua( pou4olxomociasfmDel(vp (4 lxoiocoo1fm  anvilt0t2um(opnodomee icils) 2rmxrpou4apxnmfetydls2emu s t4artnio3todlp e ies;( sexrimpoy4lpenlietas)srrrxrpnu0optomfctltfa2elump t0tleoir3tatfpt lu s s  exoir no1ap e ncia(fs2taxr ou4tex  fcildfa eanmo;u0arxrxf3oadfat au i;s0 rto(mpiu1altnmicta( aDrm(rpno0apeniictld m2ul(mo;() rxoir3oadla e nvilt) 2tmio3io4ope mfcia()aruaxmp;u4texnmfeiys mDrlu s;t0altnxo3ia1lat  n o;t s2toxrpiu4ope mfvsat a2ur(m ot4aex mfciltfm uan snu) ltoxfciy1lat anvo;t0texoxr nodamenlieilt s2raump;u1alxo fctadla ran snu0altoirciodomDe uvs;(  2uo(r iy4ap  mies s aDtr(mont1ape  iciltfs2uln snu) exomrciodopDrli s () rtmio iudllt mictls) Dtmu  no0olt  oeiysfmDrmuvo;(4tltrif3iydlatr ieo t0 2umim ou1lm emfesas)sDuax  ;t1aeenifetldfm el( onu0teenir tytlp r ies;s) etmio3no1lleelneta() 2tmur ou1apxoioetad s uluvp t4treoio tytlpD luvil(  2tmxo3oy4lpe  fcilsfarumu  ;u4apt iietad a rl(vpnu4arenircoytoaD aivi s seumxopou1ale  fvt sfa2umxm no1aetomieiadfmDea(msnt0 rxnxf tadlm elnes;s0 2xr(r3io1llt  ncsls)a2tmx pot1tptnioeiasla2rau sn(4altoif3tadfmtrau i () 2uoim ny4lptemieil(fsrtrxmpot0teeniocias m2rl( p;u)tltoxfctadfmtr ivi t)texr(rpoo1oltn fvt t  2urx ooo1altoioctat a2rmnvpn(0 eenmfciotoa  liei s)trtr(opoudoptnlnetlt) rra(ro;t0aex if3iat m2uanms (0alxnxo to1latrluvi;t teumxmpiydope mnes t sDtaxrpou1tptnifeild aDrlumon(0 lxnxf3oydlmDrlnei s0s2urim3nudopeemnvt sfarur(root0tet mietadfs2eluvp (0tlxrxfcoo1omDeli i;t)s2urxopoo4lpeelfctls)aDrm(rpnu1apx mo3ilsfaDrmnvp t4 lxoxr3oo1fpteaivo ( s2toir3iy4amtelfcsas a2raxr ;u0oeenmi3tasfm elu sn(0 etrio3iydoa e nes;s  eumxo3iudapeemnctlsfs2raumpno4olt  o3iyslm2ulnvp;() exomf3oadoaDeli o;(0 etrxm3oudlpee ietasfsDraur ;u0aptnifciltfsDrl( p t0teeomocoodlmDe uvs;t s2umirpiu4ol elivsa(  rrax pnu0tpxo o3iadlmDrm( onu)altomo tatlateanvi t0s2xoxr nu1opt  nctas a2raur ;u4tltn fciaslmDrlnvsn() leoxociodfaDe i i;( texmxr oydam n fvilt srur( oot4olenio3tydfa2uluvp (4tltrmf3tytfmDraivsl(0s2to(m3oo1oltemietatfsDtr(r ;o4oeeomociatlmDuln p;(4alxnif ia1oat auei;s0truo(rpnudomenmnvsas sDta(  nu1tltn fciad s rlnmo u0tlxnxo3to1lmDr uvi ( srtoio3nu4omtnmnct (  rtmx  nu4olxniieias a emnmo u0 renmr3iotfa rli s t0 2tr(r ou4oltnlicia() rtmu  oo1olt  ictadlmDea(vs t0alenmo oydlmteanvils0trxoir oodam  mnesls s2rruro;u0tptn o3iysla rau sn(0altnmocoo1fmD  ivi;(  2xm(r3oo1om  lfci sf Draxronu0opxn fetasls2umuvo;t0aeerif3ia1fm rauei;t)trxoir3no4opee fvi t srumu onu4tleo fetat m uan s t)aetnxfcoatoaDrau o t0 eumxm iy1lmt mics s) rur( poo4alt iocildlm2rmump;t0trxnmociatoptrln o t0 2urim oydlltnmnetlsfs2taxro;t4oltomociydlm rl(mo u4areoxo oy1la rlieilt t2xriopny4lmen nvtat s2tm(m ;t1alenmietys m emn s t)tltrmo iatlm   n o;s0 2uo(opiy4apenmnes s)aDtm(mp;u1tlx  ieiat a uanmon(4trxoxf iytlpD lu s;s trurirpny1op emivsls  2rru pou1open f3ils s2elu pnt0teeoxo3ia1la   i o;t)trxmxo ou1op n nvilt)s2rau pot1tpen oeilsfsDeluvp t) rtnmo3iydlpD  uvi;(  2uoxm3oy4ole  nvtlsfs2tmx p;t1oet  f3tadfm2raumon(0aeenxociydomtrlnei t  2xmir3oy4amt  icias) 2umu  ou1tpt io3tltfs2ua(mp;u0tlenxo3iytfp  auvi s0s2urio iu4om emnvi (  2rrxmpou0oeto fetlt sDrmnvont)texrxf oo1fpDeauvils)t2xrxr3ny4omeelivtl()srumu  ;t1aptnmieiadfm2ul( o u4 etrxr3to1opDrluvs;s0teuoxr ny1lm  mncsltfs2uau  ;u0tpx moctytla uaumo;u0aeenmfcoy1lm rliei;() eur(m3oy1lp nlicsa(faruaumoou0olt ifciysfs2em(ms;t4trtrxociydopDr nvi;t0teum(o3iy1ll eliviasf rtru poo1aexomiciysla2umuvo;() ltnmo tatfptr ivo t s2trim ny1aptn netl( srua(mo;u1aeto iciydla2emumonu0trxrxociytoaDrai o;(  ruo(m no1openmfvsl(f rta(mpno1tet io3iltfm2emums;u4 rtrxfcoadlaDe i olt0truo(m iu4ap e ietl() Dtmxrp;u0apeo ieiat a2rluvpn(4tlxrxo oadlpDe nvo s0t2urxm3oo4ll e ies s)s2rmum ;t0teenioeilsfs rauvs (4aetnifctotfptr ieo;s)setoxmpoo1lm emivs s)a2umu  nt1apx mieildfa2rauvo;t) eerxr3oytlptr neil(0t2uoxopio4opeemici () 2uau  nt1openiietyd mDrm(mon()trtomr ia1la rlivo s0trtmio3oodlme lfetlsfs2tm(rono4oee ii3tldfm2ra( snt)trxomf todfmDraiei t) exm(o3no4om eliesls) 2ua(mpnu4tleoioeiad a2rlums;(0aexomo iy1optrluei;(0tetm(o3oo1al e fet t srtaur ou0opxnmo3tyd a emu pnt0 reoif iotlp raneo t) rtm(m oo4omen ivt tfsDta(m nu0tlxn ietlt sDulumo;() etnmrciytoatrlnvols0sexrirpnu1ol nmncs s) 2umxrp;u4tpeo oeiys s ulnvpnu0tltnxf3tydlmDelieils) euoxr3oydam nmfvs (f Drmur nt0oetn i3tltlm ea(vo;t0alxnmo3ia1fpt  ieo t) ruoio no4omt  ietas)srtm( ooo1altniietadlsDemnvp u4arxrmrciodlaD livi;t0t2um(r ou4am nmies s srrrx pnu0alxnifciyt sDuan o t0altomr3ia1fptr ivi;s)trurirpno1aleemieta(  Drau  ot0oee miciatla rlu s;u0trxnxf3iy1lpDrluvs t)teum(o ny1amenmfci t)arrr(r no1aeen o3iysfs2emuvsnt0alxrxr tydfmtr u s (  rtrim nu4lpt lnviasfaDuru pnt1opxnifeiatlsDulums;t0tetnxf ty1opDe u ilt)teuoimpny1amtelfctlt srraurpno1apxnifcils a rlnmont)arxoxo iydlaDr uei t) ruoxm oydlmtnlfcsa(fartaurpno4oet  f3iatfsDeau p u4areoio3iatlaDelieo;( trxrxmpiy1ap e fvsatfsrrrurpou4opxnif3iad s2rl( snt0 exoxfciytomD aues;(0s2triopoy4optemicil() Drrx  ;u4optomf3tyslaDrlnms;u4alxoxf3tatfpD lnei t0sruoir iy4llt mfeilsfsruaxmpou0optnifetys m ua(vo;t) lxnxfcoa1omD  iei;s  exoxr3iodlpe licslt)a2tau pno1optomociydfm2rmn s;t0 ltnmo oy1lp  livi;(0 etrim iy4optelfcia(fartm(  ot1tex io3tadls emn sn() leoxr3oodlatr ueo (0 2uriopny4ap elneia()aDurxmo;u1aeen feiat m2rmnmp (4 rxnir3tydopteau i;s srumio3io1altemfvt ()arrrumont0texnii3iad mDelnvp t)tlerxf iadoptrau sl( texrio3oodaptnlneil( s2uax pno0teeo iciytfm rmu s t4 exniociy1omteluvo;(0 2toxm3oo1aptn fes t a2raxr ;t1texoiieiatfm2um(ms t)trxrmr iatomDe ues (0setmim3io4amen fctltf rrauront1tptn feiysfa2em( s;t4aetnmo tatfat li o;t)s2xmiopnodlltelnesa(fartrum ;u4ape  ociyt s rau s t4trxrmrcoydopDelnvilt0t2xrxo ou4amenmnesas aDua(roou1aexomfciaslm ulumsnu) ltoxociy1omt  n sls)texo(mpnydolen nei () Dtrumpou0tltoiocild m2ua(mo;u)aeeoio3tydoaDrli o (0teur(m iu1oltemieslt)a2trxr nu1oexnmoeiytlmDuau p u0 rtnmf oa1lm  au o s)tetoiopio1op   fesat  ruru  ;u4aexnii3tyslmDulnms (0 lxoxf oa1fp  anvi;s0t2trxm3nu4ape lnet t)a2tmx poo4tpxnmo3tlsfm uaump;(4 rxrxfciadlmD  neo;s t2xm(o3oy4ol elieslsfartmum nt1ape io3ils s2ulu sn(4 lerxo ia1oaDrli il()srxm(o io1lle mics s) rrrxmp;t4tlx io3iadlm eanmon(4 eenmfcootfateauvs s t2tm(mpiodale  feslsfa2tm(mp;t1opxn ociad mDra( ont)trenmocia1fa r neils  2tmxo3iydaltn ivsl() rurum no1teeomoeildlm2eaump (0aeermf3oy1om eluvo;t) euoxopiudlp nlieilt)aDtax oot4tle mf3tltlm2rm(msnu4aexrmr io1fmD  nesls0s2xoim nu4opeemfcta(  2raxmoou4oltomf3iytfs uln p;t0alxrxoctotopDeauvs;s0srum(rpiodol nlfcias)sDrrur ;o4tlenmf3tyt aDea( s;u4aexrifctadomD an s;t0 exoio nudape mnvsas aDtmumooo0aetn ictlslaDrmu o;(0teermrciy1opDrai i;t0 rurio oo1lmt lictl() Dumxro;o1tleoio3ils mDemnmpn(0altrxo oydlptelieo;t0t2xrxopou4al  mncsls)aDrr(mpnu4ape io3iydlaDran s u) etrxf ta1optelneo;t)t2uo(r3no1omt  ies (  2uau poo0tpe mi3tadfs2uanmon()arenmrciotla   ivols0 etm(o3io1lm e fct s)srur(  ;o1aeto oeiatlm2em( snu)aetnxr3oy1op r n ols0 rxoio3iu1ll nmnvs s)a2rr(ro;u1tlxnioeiadla2rlnvsnt4 etrio3ta1lpDeliei;t seumxm oy4ll emivs t)sDuaumoot4oee  oeiat m umu o;u0 lenmr iotfaDrai slt)trxr(r no1op emfvsa( srtru  ou4aeeoii3iasls rm(mp;(4altoxo3tadoa eln s (0 rxo(o nudlpt lfctls)aDtm( pnt4oee ioctltls2um(vp;t0tlenmo tadfm   n o;t)s2xo(r3iy1ol nmivslsfa2tax oot0tlt ioetydfs elnvs;t)trtomo3oytopD  n i ()seurim3iudale  ict ( a2uax pot1alto ociad aDrlnvsnu0texnif todfpt  ivs;( seumir3iu1lme lici t)srurx pno1opeo o3iltls2ul( onu4 etnmf ootomD lues;s0srum(r nu4omt lfcsas aDtrx  ;o0apx ioetlslaDran p;(0aeeomocio1fmtr u s s0 etmxr no4lp nlfvilt aDtrx o;u1tpxn ieiydfa2ulums;t0 rxomr3todfp ranei;s)t2tmxm3iu4op emfvsl(  2trumont4opto i3tyt mDem(vonu4 exnmo iadlat  uvs;t  rxmxo3oy1om elnvsatf Drmxmoou4tlto icilt s uauvp;u4altomo ootlaD luvo;t) 2tr(m3iy1omeemivt t)s2tru pot0opeoiociyd s2el(mo;u) renifcta1lp elnei t  rxoxm iu4aleemieta()aDuaxrpnt0tet mi3iatfm ulnvsn(4alenmociytfm eaneols0srxrim3io1alen ivsatfs2rm( onu1tlx mi3ils s2ulu s;u)treniocto1lp  lu s;()s2xrxrpoydomt  feias sDtrxrono4oetomieiydfmDuln pnu4 reoxr3iy1omt lnvsls0s2toirpny4lleelnvsltf Dum(mp;t4apenmo3tld m2eau s t)tlxrxocoy1om e nvo t trurxmpny1ap n ivtlsfaDrau oou1tptoio3tltlm2ulnvo;()teenircoodlpD lu s t  euoxm iy4op  mfvs (fsrtmx  nt1opeomoctldfmDumu p t0altomfctatfp  livo t)texmxm ny1alt liet ()aDtruro;u0apx ii3iatlmDea( snu0aeenio oy1lpt anvo s) rtrxr iydapee fet s) 2rmu  ;t4olto oeildfm eanmpnu4 etnxo3iy1oa  an i s)t2toxr ou4ol nlnet (  rrrumpnu0aet mieiysfmDelnvpn() ltrxo ia1fmteanei;s) 2xmir oudomtnlivsl(  2rrxrooo1oex ioctltfm2uanvo;t) ltnmrcoydfmte u slt setoimpny4al e ncil() rtax pou4ale  fciltlmDra( pn(0trxrxr3oytfaD aivils0s2xoxo3nodamtnlnvtls arumu o;u1altoio3iysfs rauvsnt4aexoxrcoo1fmtr nvi;s0s2xm(m iy4amenmfvta( arta(rpot4alxoioeiaslsDrlu o u4alxrmo3io1fptraivo s)s2to(o3no4amen icil()aDta(  ou0tpt  i3tad mDrmumsnt4alerir io1lpDrluei;() rtmxr3iy1ol nmnvi t)aDtrxrpot1oetoii3iadfs ran snt)tlxomocto1lmD  nvo () 2uo(r nu1lptn nvsa() rtaumpno0tee iictlsfa2el( s;() ltnir iy1lat luvol(0 etrxo3nodllenlneils)aDrm(r nt4tpt moctatls2eluvsnu0 rtnif3tytla eli i;s)t2toxr3iodamen icsasfsrurx o;o1tlenmoetldfmDuanvo;t4 etrmo3oydlm e i o;s s2to(mpny4lle lnvs tf Dtm(rpnt0alxn oeildfs umumpnt4tltrxf3oydomDe neilt) rto(m3ny4llenlfet ( aDtaxroou1oee mfetatls emnvo t)altoir oytfa eluvs;s sexmxr oy1lp   nesa(fartax p;u0alx  ictydls ul( o ()teeoio iydlm raueo (0trxoim nodlmtemnvi () 2tm(  ;t0teeniociatfmDrm(vp;u4tleomr3oadlmDe i s;( t2umir3oy1ame  feiatfa2rrurp;t4alxnmfciatfa2el( s u0 etrmfcoodfa r i o;t) eum(o3no4llee fviatfsrum( pno4oexnmi3tadls uanmpn(0tltoxo3iadfaDelieo ( truoir nu4opt  net (  2trxmp;u0tlenii3tydlm2uan o;(0tltnif tydfaDeln ils) 2xoim nudal elivt t) 2tr(mo;o1tle  iciytla2ulnmo t4trtriocoadlm rliei;s  rtrxopiudlpen nvi t)sDtm( pot4tex mfciadlaDrl(vo u0texoirctydlm rln i;(0 etmxr3ou1ap emfvil( sDrrx  ;t0olx mf3iyt m2uauvo;t0 rtoxfciotlpteaivs s) rxo(mpoo1ap elivt s  Dtmxmono1opxomiciysfa ulums;u4aetrmo3iydom  li s t0trtrxrpoo1lptnlnvt tfaDtru poo4olx mf3tatlm2um(vp t)trxnxf tatopt  uvi s) 2um(o iudolee nvsltfs2umxrp;t0texn oetlt m2uaumsnt) ltriociadoaDeau slt) etmiopnu1ll  lnvslt srum(r ;t4tlto f3ild s eluvp;t)alxnxfctotfmt  neolt t2xrio3nudlpen ieslsfarumum no1tlx mi3iytfmDemnmp;t0trtnxr iadlaD luvilt)srurio3iy4optn fci t srtr(r ;t0tpt  o3iatlaDrmu o u4 ltnmrciy1lmD  uvilt trum(r3oodomtemnvslsfartr( onu1tet  o3tat a2el(vs;(0 etoxr iydlmDranei s)srumxo iodaltemnet t)aDrrxm ;t1tpxo fetlsla umnvo u4aetoxr oytlat aies;s0 eurirpnu4om n iei t)srrau  ;t4tleoio3tytlsDea(mp u)aexrirctodfa   nesl( teumir nodale lictasf rtrxmp;t0oeeoioctatfsDrm(vs;t)trxrxo totlmDeaivo;s)texoirpoudlp e ivsa(f 2tmx pnt0alxnio3iyt m2ua(mo t0 lermo iadomD lu o;t  exm(mpio4lpee feias arurxm ot1oltomo3iyd m ua(vp;u4trxnif iatoaD  nvo s0 ruoim ou4lp nlfeia(fsDuaxrooo0oet ioeild sDrlump;() lxriociytoaDeluesl(0 ruo(opoo4oleelneilt sruaumoot4apto feiatlsDemnmsnu4artnio iy1om  lnvo t)s2tr(r3iudamenmfcil()aDurx ont1opx  f3ilt m ean ont4 rtrmo iadlpD ai i (0t2toim iy4ll  lfvi t a2rmxrpoo1aeeoii3ilt sDra( ont4aeerif totoa eauvo t0 euoir3io4lmenmnctat)sruaxrp;t4alxoii3iasls2um( ont0 ltrio3tatlptrauvil()tetrirpou4lleelivt ( aDua(moou0apx  ictad aDem(ms;(4aleoxr todlp ean s t trto(o nu4amte ivi () 2rm(monu0olt  i3iyd m2umu o;t4tetrxfctatlp e neo;t)teurir nu1optnlnvtl( s2tmumoot4oex mo3iasls rlumsnt4 lenif ta1fmDeauvo s0 2urir3oo4om emiesas)a2rru  ou0texniictasfsDrm(vs;u) leoxrcta1lmD  nvo ( trxrim nu4omen fciltfa2raxroou4oeeo ieils s2ua(vpnt) lenirctodoatrlivols)seumxr3nu4oltemiviat artr(r ;t1optnmi3iltfa2em(mp;u4 lxnxf3oo1fmtrlueo;s  eum(m oudll  lnvt ( s2rm(mpou0tet ioeilsfs2umn s;(4 rtomo oodopDe nesls)s2trim iu4ap eliei tf Duaxr ;t0aee moctlsls2em(vo ()arxrifciotlm eau o;t srto(o iudom  mncsatf Dtrx  ot1oet mo3iytfmDelnvsnt) reomr3oadopD anvo;s texmxr iudom emfvils) Duru pno0aexo fcias aDum(vs ()aetrxfcoatfaDe ues ( sruoimpnodlm emneias) 2urx p;u1tpxnmoetytfaDum(vpnu0tltnmr ty1fptr i ilt0 exrirpiydal elnvi ()aDtm(r nu0opeo o3ilsfm2rl(vont4aeenxf3oatfaDelneolt sexoir3io1ap nlncsls)artax p;t1tlto f3iasfm rlumo;u)alxrmo tadlmDe u o s trumxmpiodlmeelfctls)aDtrur nt0olx  f3tys aDeau o;() eerif3oadlpt  ieo;s) exmxr3oy4omtnlnvia()srtrxmonu0aleoii3taslmDrm(vo;t0tleoio3oy1fa e i i;t0trur(m3no1apee ivia() Dtrxr no4aetn ociadfa2um( snt)tleoif3iotlm   iei t0t2toxrpiodom elfesat)s2taumpou0olenmictytfaDemuvp;t) exnifcty1optrlneo ()texrxm ny4oltn nvsa()a2raxmo;t0apeoii3iltla em( p t0tlerir3oatfatraueil()t2xrxrpoy4lm n iesls sruau p;t0aet mi3tldlmDemuvp;t)trtrir3ta1laDrlivi s truoio3nodalenmiet sfa2umuro;t4aptomiciatls2uan on()texnmf to1lpD  neilt  eurxopno1alt mfei t  2trxmont0oetnioeild s emuvp (0tlxnif3iodlpt aies;s  rxr(mpoodopt licia(fsrtaur ou4optnifetls mDulnms;t4arxrxr3iotopD aivs s0 ruoxr3nydoltemfvtltfsrtax pnt4tpenmo3ils m2rau s u0tleoircia1op eaiei ()setr(o3oo1ll emfvsls)s2rmxmonu1texnii3iltfm uaums (4tetoir oodfp rlnvs;(0teum(r no1opt  nvs (fa2rm(r nu0tetn f3tlsls rl( snt0 rtrxrcty1omt  neo;(0sruo(m3oy4ap  mfcsat  2umurp;u1ope ioctyd mDea(mpnu0tlenircoy1lmD ai s t  exm(mpiy1lm nmnes ()s2um(ront4olto oeiadlmDrmuvo (4 ltomo iadfateluei;s)sexoirpnydlltelicsat) Draumooo0apeoiocilsfa2emnms;(4 rtrifcoydfatelu o ( trtrxo3ou1optn nvt (  2uax pnu0opxoii3iytfa umn s u4 renxr iy1lm rauvilt)t2trxm3iydlle  fes s aruru o;u0ale mictad a eau s;t4aetomf iotfp   ivs;t srtrio oy1omeelies ( arrru  ;t0tlt mociys aDeluvo t)trxoxfcto1faDrau s (  2uo(o ou1op  miesas s2rr( p;u0tpxo iciadls ean s;t)tlenxr3tadoa  lu ols) etoio no1omeemivi t)arta(r no4tlt  oetltfa rm(vpn(0teeomf3ootlat auei (0 exmio3iy4oleelfct ()artr(ront0ale ii3ilt sDem(mo;u0 lxoxrcio1oaD  i s;s)texrxr nu1oleelicilt sDrrxroot4opxo fciatfs rlnvsnu0trenif3oadfaDrlueo t) 2tmiopoy4ll nlicil() Dtr(roou0apen fciyd mDul(vo;u)teeoio3totfaDraivi;t)sexoimpny4omee ietl(f Dtrx  nt0aet io3tldfs uanvp u) ltnxfcoydlaDrln s s0seurxo3oydamte ivtls arta(m ;u4tltnii3ias sDua(vs t)trxnxfciotomDr uvolt0 euo(m3oy4ale  neias artm(moot0apxnmfcias a rmnvo u0 rermf iadlaDr ues (0 2xrimpou4ap elfvi (farra(r ;t0apxn i3iydls2ea(mp;u0 rtoircoa1lp   neil() etrim io4lp elnvs t aDrrumo;t4tlxomoeiys aDumnmo;() rermo3iotoat lu i;(0 2xo(o nu1al emneil( srrau o;o0tpxnio3iat s2rmnvs;u0 ltoio ta1oaDr ueo t0 rxrir iudlmenmfvtltfsDuaumpot4oex ioetadlm ulums u4tlxrir3ta1lmD livi;( trtr(m iudoleelicsat)artaxrpot1tee ioetlslsDrl( p;u0treoxo3ta1oaDrlnvo (0t2tm(m no4lltnlfetlsfs2rrxrpot1ape ifctytfs elnvo t)tlxoir ootomte u ilt0srtm(o ny1lpee ncsls)artr(  ot0tpx  o3ildlm rmnms;u0trtoxr3ta1lmDrli o;t)t2urxmpoo4olen fvt ()aDurx o;o4alxomoeildls2rlu o t0alerircoytlm elnvo s)setm(o3nudam emfesatfarurxm ;t1alxniieilt a uan s;u4 eerxf ty1oa  anvs;( seurxr nu4lmtelicilt)sDrr(mono4tptnifciltfa2ua(mp;u4tlxnxrctotom r nvo;s  exmxopio1lpeemicslsf 2rrum ;t4ape io3iadlaDeluvon(0 exomo3to1lmDeluvi;(  euoio3iudom  mncsl() 2uaxmpoo1tptnifeiatfa rmn pnt)alerif3io1oa e uei;t0trumiopno1ope lnci s)a2rrx pnu0tpeoiiciys sDemu snt4arerxr oydfp   uvi;( srurxr3nudom nlfci s sDtaxroou0ale  fetydls2ean p u4 rxoir3oa1fa e ieil(0trumxopou1lp  liei (  Dra(rp;o0aeto o3tatfa umuvonu4 exrir3oadlmtean ilt)tetmxmpiudam   fciat) rur(mpno1tlx  o3ildfm2rmumsnt)tlxnxf3io1fm  ln i t0tetmxr nu1opt  fei ()sDuaxrooo4olx iociatlmDeanmp;(4artoio3iadopDrai sls0 2xmxopio4am nmfetlt)arrrur ou4aptoif3iatfm2uanvp t)arxoxr3ootlaD  ieo (0 eurxo3iy4lmte fct ()arrr(mpoo0tlen icildfa2em(vpnt4texomrcootomDeli il() exm(mpiu1apen ietl(fsrtr(r ;u1aet miciys m ea(vo u)tetoircoytopt aivol()t2tmxr iodlltelfei t arua(m oo0ole  ietlsfmDeanmo t0aeenif3totfpDe n s ( setoxo nu1lm nlfvilt)s2taxro;o4tleo iciyd a2uanmo ()alenmf iatla e ivo;s  rurio3iodamt mfvs ()srtmxmp;u0oet if3tadfm rmn o () lxoxoctatom r ues s0 2xmxopoy1apte ivi (f 2rru poo1aeeo o3tlsfmDum( ont4tlerif3ty1omDelnei (  eumiopno1lltn iviat)arumu onu0oleomi3ilslsDrau s;t0 lxoir iotfat aivo;s0t2toiopny1ol  mics s)sDta(r oo0tpeoioeiytfa2em( s;()alenxo ootla eaivs;t s2xrxo3oydom n ietas s2rmxmono1apxnmociytfa2ulnvonu) lenmrcta1fa rauei;(0s2trxm3nu1olee fvi s artmurpot1teto ociadlmDulnmo;t) rxnir3oadfmD luvi;(  exmxm oo1alt mfvias sDrru  ;t4tpx moeilt mDea(monu)trtrmf io1fpD luei;t0 rumxmpio1lm nlfcia(fs2ra( pno1optnmi3iys sDul( pnt0 rtomociotomtelues s)s2xoxo3oo4ameemncils)artr(rp;u4tlxomictys aDuau o u0 ltrxo3oo1fm raiesls)s2to(r3ou1apeemics s)s2tax ooo0aeenmiciltfaDrl(mpnu4 exoif3iydlpDrlieol() rtr(mpiydll nlfvsas)srtmump;t1oeto oetasla2eauvp;u0aexnxr3iydomtrlueslt0 rtr(m3iy4ap  lfeilt sruax pno1ole  i3ildlaDulnmpnt)tlenio3to1omte n s ( s2urxo iy1lpee neil(fartrx ono1olxnmf3iatfaDuaumo t4aexoxrcia1lmD lu ilt0setoim ou4ame  ics ()arurxr ou4alx io3iad s emnmon(4artoxf iotoateaies;()texr(o3oydopt mfctl(fsrtmxrp;o4tex  ieiadfa ea(monu0teenmfciy1fate n olt) rumir iudom n fetl(  Dua(mpoo0aetn o3iytfaDum(ms;(4 eerxf3todfaDrau o;(0 etr(opiudamtnlfci s)aDtau  ;o0ale if3tatfaDrm( s;()aleoxrcia1fa r u o;t trto(mpiodap elnet t)sDtau  ou0aexn i3iyt s2ran pnt)trermr3to1lp e ieolt0trur(o oy1alt  nes t)s2umxr ;u4oeeoiieilsfa eaumo t)texnmocty1laDe nvo (0t2xmimpiudoltemnctl() rrr( o;u1tlx iicild m2rl(vsn(0 rxnmo tydomDrli sl(0s2tmim3nu4alenlfetatf 2uaumooo0apenmictatfa uanvp;u)tlermf iotop r i i ()seumir iydalt lncilt  2tmxm ot4oet  oetydlmDumuvo;u0 lxomf3io1fmD luvilt sexrxrpoy1ome mivia()arurx  ;u1olt ii3tltfmDrln sn(0 exoxr3iatlaDe u i s)seum(m ou1ol   icsas)s2tru onu1optnif3tydfm2eau p;u) etomr3oodfmDelieo;t srtmxr ny1amtn ics ( srur( oot4tee  ietatls2rmnvo u0tltriociatoa rlu i ( seumxo oo4lpe  feil()sDrr(ronu4tlt ioctyslm rlnmsn()tlxrmf3totlmDran i;t0srtr(opiy4al nmneilt) 2rr( p;t0aeeoifeiysla2ra(vpnt0tltomf ootfm rlnvo;s0srtrir3oy1lme  nes (fs2rr( ont4opt  ictysfsDuanms;(0areoif ootfp eaivolt0s2trxm iu4omenmicilt a2ua(mpou1tpxomi3iysfa um(vpnt4 lxoir3oy1lmt anvs;s0srtm(opiudamenmfct s srua(rp;t1oltoiicilsfs rmnmp;u0 lxoxrcto1oa  livo;t  2uoir ny1amtnmfvs () 2rrumoot0aet if3ils aDumnvo;t4tetnir3iytlmte iei t) eurxo3iy4oltelivtlt)srtaxrp;o4opt  oetlsfm uan p t0treomo3iytfmDrauesls)srxo(mpou4altnmneiat srtmx ont1alxo i3iat s ulump (0artomocoytom eai i;t)srtrir iy1llt lnvs ( a2tr(ro;o0opt  ociydfm2uauvp;t) rtrxo iotlm r ueo;t0srtoxr iu1ll nmnctasf 2rr( p;u4aex moeils aDra(vs t)trtomrcoy1fmD luvo ( teto(r3ny1lme mivsas)s2rm(root4tpxomi3iatfmDrln pnu)tleoirciy1fat livil()trxmio iudapt mnci sfsrrm( pot1tpe mi3iyd s ean ont)areoxo ty1fatr ivo s setoim3nu4op   nvtlsf 2umumpou4optoii3tatlsDua( o u)arxoif3todoateln o (  2tr(o3oydop   iet t)aDrm(r ;o1oexn ociytlaDum( snu4trenif totop rlnes (0setm(r3iy1lp n neta() 2tm(m oo1olxoif3iltfm rlumo;u4aleomr3to1lmDelu sl()texoim iy4ll elfciasf rtax ono4oeeniiciasls2um(mpnt0teeoxo3oydlmD  uvo;s0texoirpiy4lle lfeil( s2tmurpno1tee iocilt m eluvon()aexrxo tytom rlueslt  2ur(m3iudom nlfcsasfaDtmu p;u1tpx ii3iaslm2rauvs u4trxoxf3ty1oatr ues s0 2um(opnu4alenlnci (  2trurpot4ale miciyd s2rl(vs t)tlxnxf ootfateaivols) 2uoxr nodap nmfesasfsrrrur no4alen ietadfmDel(vp u0 etoir oadomte ivo;s)s2xrio3iodaptnlnvi (fs2tau  ;u1ape  i3ildla ul( o;u0 eenir3totlpDe i o t0teumim3oodlptnmnvt ()srraxr ;o1opxo ictadlmDuaump t0alxnxocoa1opD luvo;s trtrimpou4lle lnei (fa2rru pnt0aee mf3ils a2ea(vpn(4 rtrmr3oytlm raies;t  2um(mpiudol  lfvt s a2taxm ;u4alen feiyslaDuan s;u) lermo3iatomD  ieols)t2um(rpiy4aptn ivt tfsrtruro;t0tptnmociyslm2umuvpn()alxrxfctodla eai s t srxrio3oo4ap  mict (f 2raumpot4aexnmi3ilt m el( snu) lxnxfcty1lpDraueslt s2to(o3iu4llt  fct t)a2tmur nu1oetnmi3iasls rm(vo;()trxnmociytlmDrauvo;() 2xm(r3iodom elfvi t)a2tmxront4tpe ii3iatls uluvo;u)treoiociadom rluvils0 2xr(opoydop nlneil() 2raxr ot4aexn feild mDumumo () eeomf oo1lpDean o ()t2uo(r nudopt mfvsl(  2ua( p;u0tee ifeiyd s rm(mp (0trtrmr3iodfmD anvolt  eum(m3nodap nlfvtls  rrr(m nu4alxoiieiatfm em( s u4alxoxr3ty1lpt li ol(  etrio3oudam e nvi sf Duaxmp;t0tle mo3iydfaDuln p;u0teenmr3ootfaDelneo t)teurxr oo4am   fcs ()srur(monu1tptnmfctysfsDeauvsn(0trtomo oodla r i s s0 2xrxo nodam emivilsf 2tm(mo;o4apeomoeiyt m elu s;()aleomfcta1oa e ieo;()setoxo3oudal n neta()srrmu  ot1oeeoiiciydla2um( pnu)tlermr ia1om  anei t0 2uo(o ny4om n fvsa() rtmxro;u1oexomicilt m ranvpn(4trtrmf oa1om rln i;t) etr(m oy1lp n fvs ()aDumxrp;t4tpe mietltfm uan s;u4 etomrctatfmtrauei;s)s2xrxr3iu1omeelfci ( sDur( p;o0open feiat m ea(vs;u0texnxocoydopDrlueo;() rur(m oo1ll elfctl(farua(rp;o0olenif3iyt aDelumsnt0tltrmo3oo1la ran i t srxmxo3oo4lpeelfes ()arurx  nt0ope mf3iadls2rl( ont)altnxr3ootop rauesl()srtrir iu4ape  ncslt)srrm( pou0oetoiietasfs2rmnmpnu0arerifcty1lptr ueo;(0 exrirpny4amtelics t  2rau  ;t1tlt ioeildlmDumn p t)tetrmf iy1faDrauvi;t)trxmxr3no4altnmici s srum( poo0aetnio3tltfa rmuvp (4teeomocoadomD lieils)texrxo iydam   fvslsfsruaur ou1aetnioeiyt m2ranmo t)aeeoifciatfaDelieolt0trumxr nydlpe lnvtl() rtaumpnu0oee  i3tatfm2ul( p u4 rtrir iytfm  luvi s)tetm(o3nodllt lieilsfsruaumo;t0apxnioetyslm2uauvont)trenir3oa1lpDelnvi t0 exmxrpny1amtnmicilsfsDtaur ;t1tpt mfeiaslm2ua( pnu) exnmrciatoatr nei s0s2xrxm iy4lpenlici (f rum( p;t0apxnmfeils s rm(vp ()aexrif to1oaDelueilt)trxoxr3oudap nmfeiat s2tr( oou0alx  feilsla um(vpn(0 exrxo3ty1lptraivol()srto(opnydlptemfesls) Duru  no0tpen oetyd sDeau snu)tetrmr3ta1fmt aueo s)t2uo(o ny4lme mfvi ()a2uru pou1olen i3iadls2rauvp u4altomocto1fm   ivol( s2to(o iy4om elfci s)s2trxmp;o1tle ifeiysfm2emn p u4tlxrmrcto1oa eln olt0trtmio3oudap n nctatfaruru ono4oet  feiyd s2raumo u)tetrmr3io1fp e uvs;t0 2um(mpnudll  mictat) rtau ooo0tleoifetydlaDrl( p u) rerxr to1faDr ieslt tetmir3no4ale  ivil( sDrm(m ;o4olxo o3tat s2ul(vp;()aeenmrcoa1oa r uvs s)srtoxm3nu1olee netls  rtau pou1ope ifetad mDua(mpnt0texoif3ia1fmDe neols  rxmxopno1lmen iviat)sDrmuroou4oee  octltfaDum(vp;(4aleoxo ta1lp rlnvs;t)seum(r3oydap   ivs (fsruaxr ;u4tlenifcildfsDuauvo;u4treoif todopt anvsls trtriopnu1ap  mieiatf 2rm( pno0aeenioeiasfa2ra( s;t) lenio ta1oa  aivsls)sexmiopiu1ole lies s) Duax  no0tltomiciltfm2ra(vpnu4trxnmo oo1lpDraues (0sexmimpno4lpe mfes sfsDraxmpno1apto i3iaslm2eluvo u4trxrxo oo1lm r uei;s)trxr(o oo1am  mfesas) Dtm(mp;t0aptoif3tldfm em(ms (4teenir3oo1lptr ivols  2tmir3ny1omt livs () 2trxrp;u4olt  fciadfmDuanvpnt0arxomf3oatomDr ieilt0 rto(m3nu4apt  fviltfaDtau p;o0teeomf3iadfm2rl(mon() lxrmf3io1fpDe n o;s)s2to(r iy4al nmncs t)sDtm(r oo4oexn ociadlsDuanmo;t4artrxr todlm ean olt sexmiopnydom nmfvslt s2trxmont0olxoif3iltls eau ont4arxnmo3oatopt  u o t trxr(opnydlp emfvtatfsruau p;o0aptomoeiysla elnvo;t0aexrxr oytlmt  uvols)setrir3oydal emfei tf 2rmurpou0tlenmi3tyt a2eaumo;t4artoxrcty1lmDeai i s)trtoxmpoo4optnmivsa(fsrur(m no4aex  fciltfaDra(mp (4 etoircia1fm   u i;s srxmxo3oo4lle  icil( a2rr(  oo0aexn iciytfs2em(vont0 exomo3ta1lm rlivo t  eto(o nudll nmfes () Dra(mpou4aeeomf3iltfaDrln pnu)arxoxfctotopt  i sl(0texoio iu4llt  fetatf 2uaumo;t4aetn iciyslm2ul(msnu0trxnircto1fmt lu il(0trtm(opnu4omt  ictl(  2ur(rpnu4olx  o3iys aDum(mo (0aexrmr3oydlat ai i ( t2xrirpiy4apt mieia( aDrr(m nu0tpt  o3tydlmDrmumo t)arxomrcootlptr uvi;s srurxmpoy4ame  nvtlsfaDurxmpou1aetn o3iydls2raumsn(0aexnxrcoytfmt liesl( s2triopoy4aleemfvsat)aDraxmooo0tpeo icild m2rlumpnu4treoio3ootfaDr iei t)s2tmirpou1lmtn feilt srtmxrooo1oexnmiciysfa rauvs;t4 eenxo3todlp  aivo (0trxmxmpny1lm emnetas aDtmxr nu1aetnmfeils a umuvo;(4 exrmo oydlpD luvolt tetoirpiu1ame  ietlt) 2ua(monu4aeenmictyd s2rl( p t)aexrxocia1oaDrlivi;s)seto(opiydlp e fviatfarra( ont1aptoiietltla2uau s u)tlerxfcoa1lm   ues;s0 etoio iydllt  feslt)aDrmurpno0teen o3iyt a2rl(mpn(0teeoxr todfp   n i;t  rxmirpio1lpeelfcsl() Dtrum ;o0tpeo feildlm2umumon()arxoxfciotfpteluvi t) 2umir3oodlmtnlfvil(fs2uaur oo4texnmfctldfa2ean pnt4 rxnifctatopt luvs;( trtrir nodoptnlivslt)s2ua(mo;t4oet  iciat sDem(msnt4 exoir ta1op r ivo;s  exrir3iodllenliet s)sDtm(  nu1oleoioetltlm eauvonu4tlerio oo1fm eanvils seto(rpio4amen nctas a2urxro;t0tlxo ieiasfsDean s;u)arenxrciadla rlieol() rxrim oo1omt  fesltfarrm(ro;t4altn i3ildlm rln s u0aetoio iatlpte nesl(0srumxr iu4lm nmiet (farrrxmpot4apxnmiciyd a2rlu o;(4trtrmr3iadfp  aueslt)s2uo(o3nu4lmen nvt s)a2ua( p;o1aexn ociatfmDrl(mp;(4 rxoio3iadfaDrau ols0t2uoxo3iu1amtnlncsa()a2um( p;t0olt  feild a2el( pnu0teeomf io1fm r ies;t0 rxoxo3oo1olt mfcsas sDrr( p;t4opeo icild mDulumsnt0teeomf oatfmteai ol( srxmirpnu1om nlictas  2rr(r nt1texoiocild mDelu s;(0tleoir3to1opt  uvo;(0 eur(rpiydlp e nvil()sDurx pno4ale  ictlt a2elnvsnt)aexoio3oytfa r ieo (0seuoxo oudomtnmncsls)srtmxmonu0apt iiciasfm2ulnvo;u)aexoxrctatoa rauvils0 etr(mpno1lpee fvt s  Dumur ou4openio3iysfsDrmn pnt)tlermf iytlpteauvilt)t2xoxopio1lmtnmfeia( sruau oot0oet ioctas mDeln pnt0 rxnxf oa1fa elu i s)t2tr(m oodamtnlics s)s2rrxmpoo0oexnmictld a rmumo;t0 rxomo oadlaDe uvslt0sexoirpiodlmtnlnvtl()sDtaumpnu0aeenifciys mDrmump ()alerif3ootfm eli o t0trtm(m nodapt  ivt t)s2trumooo4apt  fcils m2rmu o (0artomo oadom r ivil()trtmxrpnodaltemfeiasf rumumpnt4alen f3tydfm uaump u0aetrmf iydoa   nes;t0teuo(r iu1apenmivsat aDrr(r oo0olxn fctlsfaDran p;t) lxoir3ia1om e neolt  euoxrpiudlmenmieilt)srtrurono4alt mfeiys m eln o t0tlenio3iytfpDelu sl(0t2xrim3oudlmtelietatfa2rmumo;t4tpto o3tasfm uln snu4arerir to1lp   i o (0 etriopnodamt  nvs s arurum ;t0oltnif3iyd mDrm(mont4trenirciodlaDe nvslt)t2trio oo4om nmnctl(  Dtmxmoou0tpe moeiltla2ran o u)altnir iytom   n i t)t2urxm3iu1amt  fci t)aDtrx  oo4tlenifciatfa2ua( snu4texrxoctydlateaueo;s0 euoim ny1apt mfcsas) rtmumpot1tpeo ictydfs um( o;u) rerxo iodop rau s;t0texmxo3iu1lmenmfct t sDuru  ;u0oexoifetaslsDrl(mp u)trtomfcoa1lp rauvslt)tetrxo iy4optemnciat aruax onu4apx ii3iysla2el(mp;t4tleoxr oatfp  anesls t2triopny4al nmietas)s2rrumpot1tlen ictyd sDemnvp;(0 exnio3oadoa rlnes s  2uo(o iodlm emfvt (fsrtm(rooo4openmfetldfs2umu o u0 etoir3iadfaDeluesl( t2tr(opoydapte fciasfsDrru  oo0aee mictytla2ulu p;() rxomf3ia1fpDrluvsl(0teurim3iy4optn nvtlt a2um(rooo4aleomoeiydfs eaumo;t4tlxnmr to1oaDr i s s trxr(r3iodal  mnvsl(  Dtmxmono0tltnmo3ildlm rlnmon(0 ltrmo oy1lateln sl()srtmim oodap n nvi (fsDta(mp;t4openioetat a el( s;u)texnxo ty1fptran i t) rtm(mpio4llenmnetls)sDrrx p;o0texnmf3tld s2elumo t) rtnio3iydlmtean i;(  rxrio3oo1lmtemivsa(fsrrm(mo;t1tpxnmfctysfa2eaump (0trtnmrcoytlatelu sl()srumim oodal nmicta() 2um(  oo1aetoifetas m2rmuvp u0 ltoiocoy1opD lueo (0 eurxopiydam nlfeils) 2rm(m ;t1oeeoio3iyd m eanmsnt4texnxr iatfpD  u s s  2uoimpnu1opt  fei ()a2ra( pno4alt mfctatfsDean s;t0aetomrcoatlpDe i s;t0t2xr(m3iu4al  lneia(f Draxront4tpt mf3ildlmDul(mp (0trxoxf3iodomDeauei;( teumio3ny1om elncta(f rtmx p;u1tlxnmfeiasfsDemu s;u4 lxnmf3iy1fm elu i;s seuoxo iydapenmfetl( s2um(r nu1optomicild s emnmon()altrio3iodoaD aivs s)s2toimpoo1ol nmneiatfs2um(  ;u0tle  i3ias mDemn s;t4artrmrctotlm ran s;t srtmimpoudole mfvi t s2ta(mont0tet  fctys mDelu p (4 etnxociadfateaieo;t  2xmxrpoy4om elivslt) 2tm( o;t0tltomo3ias sDem( p;(4 renxr oatoaDe uvo s0 rtriopny4opt lncil(  2rrx ont1tpe moctld a2ra(mp u0 ltrxr3oytfm   nes;(0 rur(opiodlmenlfciat)s2trx ooo1tet ii3ilslaDumnmsn()arxnxr iydomD  ies ()trxoxo3oodomtnlnetl(f Dta(m ;o1oltnmfeiadfmDrl(mo;t0 rtrifcoo1om  ai o;(0 exo(opoo1lp emnctas)sruau  nt1aetnioeiyd a ean snt0 eeniocoy1la  au o;t0 etmxopnudole mivt (faDum(rpnu0alx  feiltfmDrauvp u4arerir3iotoaDelueo s)s2xrxm no1amee ncilt)s2um(m ou1teeomfeiyd a2ea(mp;t)aexrifctotfa raues;t)teto(r3no4lmeelivtltfs2tmum ot0oltoiieiysls rlu o;t)tlxrxf3ty1oat  ieo ()srtr(m3nodamte fes s)s2ur(rp;u0aeenmoctysfmDra(ms u4aetoxf3iatfaD lneslt0 rtoimpnydoptnlivtlt)artruronu1ole mi3iat s umumon(4trxnif iadfmteaneo t  etrxo3no4ol n nvi ( sDrmx p;o1tpt ioctadfm umu s t4altrir3oo1oaDean i;()texoxr3oudll nlicsl(faDrauront0tetnmo3iytls uau p;u0trxoir oy1om e nvslt0t2toxm3oo1ole lncslt)sDumx p;o0teen fciltls2rm(ms;u)tetrxfcoatlpDe ivs;t  2trxm iy1aptnmfei tf Dua(m ;t1alx  ictydlm umuvsn()alxoif3tatoaD aivolt)s2xr(m3iu1lm e fctas)srrmx ono1apx ii3ias m el(mo;u)trxoxo oadopt  u s t)tetrxo3oudlltelnct sfaDraurpoo4olx mfciltls ul(vpnt0tetoiocoydomtelneil() euoxr3iudllee ietls)aDta( pnu4alenmoeildfs2uauvs;t4 reomocoydfm elneslt setr(m3io4lltelneils s2ua(mpot4tlto oetatfm2rl(vp u4aetomr oa1optrli i (0 ruoim oy1altn fet (  ruau p;o4tltomietasfaDrlnms u4aeerxo ia1oaDraieo t texm(m3oudapenmfei t arrmxrp;u4tptn f3iydfm2ua(ms;u)trxnio oy1faDeau s;t0 exm(m nydllte nvsasfa2trxr ou1tpe  i3tatlm2rm( s t0 rtnif3oydlpteaivo s  exoir3oudll  lfei s a2uaxr oo1aexo o3tad mDumnmo u4 exomo oytopt  neo;t t2tm(mpiudopenmiei ( a2rrxmont1opxniicils a emnmonu0trxnif3oodfmDr nvols  2xmio3iydlp emfeslt) 2taxrpou4oleomo3tldfaDea( o;t4 ltoxr3ty1lp e u sl(0srxrirpoudop nlnetat)a2taxrpnt1openmieiltfmDrmuvs t4tlxniocoa1lm r ueo;t  2tr(r3nu1lm  lieias a2tmxmpnu4aetnmf3ildfa emums u4tltnmr iy1lm  livi;s  etm(m nu1olte neia(faDum(m ;o1alx  oetldfa rlums t)texomf3tatoaDeluvi s0srur(m iodam emiet s s2uax  oo4aeto fetydfs2em(mp ()aeenmf3oodfm r n o s0 2uoxmpiodlpe mnvsl()a2uaurpot0opeo ociysla elumsnt4altrxoctodfa  aivils0trum(m iydolt  nes s)sDtr(mono4tle moetatla2um(vo u4 rxnio3ty1lmte u o s texmxmpny4ame lfctl() rururo;u0ale  fciad a emnvp;() eenif oydfm e u o;s)srxr(r ny4am emiei s)s2uaxm ;u4alxoif3iad aDeluvo;u0 ltnmocoadoptranvs;t0 eumxm iu4opee ivsa( aDuaxr ou4tpe io3tasfs rmu snt4alxnmf io1oaDelues;t teumim ou1optn nesat)s2rmuroot0teen fciadla2ran o;t4artoxfciy1fptr ivs;s0texm(r3ny4lp   neslt)srumxmono0opeomo3ildfs ra(msn(0 eenmrciodlaDrli il(0s2tm(r3no1lp  lnes t aDuaumo;o0oltn fetysfa2rm(vpnt0 reoxr3ty1op  li s;t0trxrxmpio4lpe  nesat  2urx  nt1ape mfctlsls2rau s;t)aeenmo3io1oaD ln s;t0seto(opio4op emnvtas s2umxmonu0apxn oeiys mDuluvp;u)aleomrcoa1lm   nvolt0seurxr no4om n nvi s s2tmxmooo4olxomo3iyslm ulu s;u) rxnmrctodlm   nvi s)srtmxm3nu1lptn fvil()sDra(mont0alxnii3tad m2raumont)areomr tytop   nvi;s  eum(mpiy1op  mnvsa(fsrrm(ro;o4aetnmi3tatls rmnvo;(4texriocoytopte nvs;s0 exmxmpou4lltemfvt s)aDtm(r oo0oex io3tydfm ulnvs;(4artoiociatlaDrai s;()teuoio3iy4lpte nesls a2ur(mpnu0tleomf3tydfs2ulums;u4aeenmr3ta1oa eln ils0teto(r3nu4alenlfesatf ruru p;u0ape moeiaslmDum( o u) eermocoatlat lueslt setmio3oo1ll nmivsltf rtrumpoo4tltoif3iltlm2emuvo;(4teerircoo1lmt lueol( s2trir oodlptnmfeiasf 2tmx  no1apt  f3ils mDeanmon(4tetnxo3tatla  luvolt0srxmxopiy4am n ict tfaDur(m ot1olenmoeiydfa ran p u)trenmf3oatomtraues;()s2ur(opio1olenmfvt tf Dtaxm ;u0olt iiciltls2elu snu0artomo iydfpt  nesl() exm(r3no4alenmfvi s)srum( ont1aleoioeilt aDra(vs;(4aexoxf3totlpD lnvo;()tetm(r3oy4llt mnvs sfsrtr(m nu1oleoii3ild s ulu p;t0aexoxr3oytoatelnvs;( s2xrim io1lltn nei ( arrrxmoot1apxnmociasfm2el(vo;u)aleomrcoatfpteauvils) rxr(mpnudam   ivtl(  2ua(ro;t0optn o3iytlm2ulnmo;(4tleoxr iodomDe neo ( t2xm(m3nodope mfesls)sDrmurono1opxnmociydla rm(ms t0 rxnmf todop eluvil(  2xo(mpnu4lptnmnes tfarum(mooo0tpt mo3iltfm rauvonu) exrmr totlpDe ues t srumir3nodomt lietat srrrurp;o4tlxoii3tatfsDulnms u)tleomr iytfaD  nvil(0s2trxo io4om n ivslt) Dur(roou4tlen feiatfm rauvp;t)aetoiociatfat livol(0 2umxr oodapenmfci s) Dururoou4teen f3iat m2uan p t0artrxocty1lpteaivi;s)t2xrim3iodaltn ivi sf rtm(mpnt0oleomfctasla emnvsnt4teeoio3tatfatrlivs s) eumirpoo4am  lieias  2ururo;t0tle ioetyslm2rmnmp (4 rxoxf tydlp e iei s s2to(m oy4lpt  nvtls)arrrum no1alx mo3iaslaDulnvo;(0trxomo3iadlatrlnvs;s s2tm(mpno4lmeemncils  2rr(m ou0aex ii3iysls ra( s ()teermociydoptr n i t0 2trim oudal elncia( arrrum ;t4tptomoctas sDumumpnu4 rtoir iatfmteaueo;t sexrxo iodop n ivsl()s2tmu  nt1oetomf3tldlaDrmu snu0trxnxo3oatoa  lnvo;( s2ur(r3iodlme mfvils)srumu  no1openiieiadfs ea(mo;t)alxnxocoydfa ranvsl(0srurim3iu1am e feslsf 2rmump;t4oee  ictydfa2rln o (4 reoio3iotoa raieo;( s2xrxr3oo1op   nesas)s2tmu oou4tetnmoeiysfs2ulu s;()tetrmr3io1omteluvolt)s2xm(rpio4lme  fctat)a2rm( p;u0aexn feiytfm uaumpn()altnmo3oytomtrlu olt tetoim oo4olte ivtl(fsDtm(mpou0altoiociadfsDrl(mo t0 eerxfciodla ran o;(0setrxopoo1lle livias) ruau pnu0olxn ociydfs2elnvsn(4teeomo oydfmDeanvs;(0seuoxopoudlm  mnesas)s2uaumpot0tlx mf3tld a rau pnu)tetoxr3oo1lmt anes (  2xmim oo4op  lfeia()arua(moou1alt iieiat mDumn s t0trerxf3todoa raivo s0texmxr3iudlle lnviatfarrrxrooo4tpenmf3tydlm2ua(vo;u0tlxomf oa1oat an ol(0s2xr(o3iy4ll  lnctlt  Dtru ono0tpeomfeiad aDrmnmp u4alenir ootfaD lieil( t2xmxrpio1lp  liet sf rum(monu1opx mi3ilt mDem(vs;(4alenif todlaDrlues;s) etmxm3oydome mfeia()a2rrum ou0oeto oetas m emums u4areoif iatomD lieil(0setrim no4apt mfcsasfarrru pnu0olxn f3iadfaDeanmp (0texoirciotoateli s t sexmim3ou1al n ietlt)arururonu0tpe mf3ildfm2el(mon(0 rermr3oodfmDeaneolt0srtoxr ny1lme miet s) 2ta( ooo0aleo fciytla ulump;t) exnxf3ta1fa r i s;()srxrxmpio1ap emfei s) rraxm nt4tpt ifetatlsDuauvsnu)trxoif oadlpD aieo;( s2xrxopoy1apeelfvsl()aDrmxro;o0tpxoiieiyt s2ul(mp;u4 lxrmf3oatlm r uvi s) rxoxopoudom  lncil() 2rr(mp;o1tetniiciadfaDrm(mo (0arenirctodlaDe uvs;() 2uriopoo1olenlneilt)aDuru oot0optn octytfmDeauvo;(0 eeoxf io1om r iei;t seto(m ny4apt lieiat arumx ont1oeto fetls s2uauvp;(0 etnmocoa1omt ai slt0sexrirpio1ame lictat aDumur oo1oeeo ietatfs2umnvo ()alermocoo1fm rlnvols t2xmim3nydal nlivsas) rur(mp;o0opt ifciysfa2ea( p u) ltrxrctydfpDe iesl(  rxrxm oydlp  mfvs t)aruaurpot1teen o3iydls2el(mo;u4 exnmo3iydlaDeai s;t)sexoirpnudoltn ncilsf Duru  ;u1tptoif3tasla2ua(vonu0alerxfcta1laDelu ols texrirpio1lle micsa( s2rrxr oo4tee iocildfs2rmumpn(4 ltnxfctatlaDeln o s) 2urio iydop elfciat)a2tmxm nt4opeo fcias sDumnmo t) lxrxf oo1op elivi;() 2toxm io1al n fet (  Dtmxmont1oltnioeias m uaumsnt0arxrxo3oatop  ln s;(  2to(m ou4ap nmnvsas) 2urxmpnu0opeomfeils aDrlump;t0 rxoxo iadomDe u
\ No newline at end of file
@@ -0,0 +1 @@
+u i (0trtoxo oydomt mncs ( artr(r ;u1alxnmo3ildlmDulnms (4areoifcoa1lm eauvi t0teur(o3iu4lp nmfct s a2uax oot0opeo i3ils m ra(mon(0alxrmfcoodlm e nvo ()trum(rpoy1am   ivtlt a2ra(m ot4apxomiciad aDuln p;(0trxnxrciotom rlnvo ( t2xmimpou4aleelnetat)s2trxr ou0tptnifctysfm ua( sn(4tlenmf oa1om   n sls s2uoxrpnudop  lfvilt aDurx  oo0tle if3tldlm2em(mo;() rxnif iatomte n ols)s2xm(rpny1lmen iet t)aruaump;t0oeen fciydlsDuanvo;t0trtrxf3iy1fat li ols)trxmxmpoodalenmfvsls) Dta(mont0olx io3iad s rlump u4 ltnmf3todfaDr nei s)t2xmio iy1olen fvs t a2taumo;u4oee mf3ilslmDrauvp (0trtrir iatopDr ivi;s)t2xo(m nudapee fes (  Dtr(root1aeeo fetas aDrlnvont0arxnmrciodla rauvilt)s2xr(m3nodomtelicsl(f 2rau ooo4olenmoctysfa uaumsnt4artoir3tydfp r n ils0t2uoio3ou4am  mfvsas s2tmumpnu1alx  iciad s elu s u0aeerxoctytfate n ol(0 rxoxmpou4lme mnes s)srrrumpoo0alxnmfeiasls rln pn(4tlenirciotoaDr ies t0sruoxo3nu4omte iesas aDtrxmonu1olx  o3tldfs2ea(von()tlxrmrcta1lptelieo t sexmxrpoy4lltnmiesa(fsDtmum oo4alt ifeiys mDrlnvo u) rxrmo ootfm  au i;(  rur(rpnudopenlfctlsf 2rm(r nu4tlto i3tlsfm2emuvon()tlerif iytlpt  u i;( srtrirpio4ol emicta(faDur(  ;u0apxnifeiyd s ranmo;t0 ltoxrctodlaDraieslt0setoim3oudlpeemicsl(  Draumpot4apen ieils s2emnmp;() eenmrctytoptrlu o;t  rur(opiydomt  ncta()srtrxmo;t4opeomfcils s ranvs u0 rtrif iodfm rli i;s  2umxm oudlptnmivs ()aDrmuro;t4oleomf3iytfaDuluvo ()arxrmfcoy1omDeauvi;()s2toxo oy4lpeelfesas a2rmu p;o0texo o3iasfm2ra( p;(4alerxf3ia1la  lnes;t) 2xmxo3oudomee fcta(f Drrx ono1teenmoctlt s2em(ms t4 etoxo3iatfa e n ol()srtoxo3no1ole lnvias)srrr(mp;u1tpt mf3tadla2eauvo;() ltnmrciytla e n ols  euoir3io1apenlfcsl(fartau p;t0ape  fciadlm2em( s t)tetomo3oodlpDe u o;t sruoxmpiy4op  lncta( s2raurooo1apt mocilt a uan sn(0teenxfcoa1fatr nes (  etmxrpiu4lm n fct ( artm(m ot1aetn o3iasfmDrl(vs;t)tetrmf iydlptraneo t) 2xmxr io1lm  livils  rrrurpoo0tpxomfciadfsDuanms;u)aeeoio3io1lm elu o;(0t2xrim3oo1ap nlicsat) Drrump;t4alt  oeiyd s rau p;u0alenmf oydfpDr ivo;s0t2umxmpoodlmen nciat sDur(m ou0altniocilsfmDrln p (4tetrif3ootomD luvs () euoim io1al   ieta(faDurxroou4opt  ieiadla2emuvp (0 eenmo iotlpte n i (0srxo(mpnu4lmen fes s) Dtau oot4oexoio3iytlm rlnvp ()trxniocootop  auvil(0 exmxmpoo4lle  ieil(  ruau o;t4opeoifcias a em( ont) eerifciydfmteanvolt0srumirpiodaltnlfesas a2umu ooo4alt  ieiaslaDemnmp u4texnxo3tytfa  au sl(0t2ur(opno1lpe  fes (farur(r ot4aet mi3iys mDulums (0 lerif3oadlpD lnvo;t)setoio ou1altnmiei sfaDtrumont4apt  iciasfsDem( s u4 rtnmr3iatlmt aneo;s0setrxm iu1oltnmfcias) 2tau  ;u1tptoifetys sDrmn p (0artomo todfpDeauvi;t)texmim nudaltnlietas aDrr(mp;t1ale ioeiat s2ra( on()aeerif3iy1faDrlneo;s0teum(mpoy1lm e ivsl( s2tmum oo4oeen oeiltlm em( on()teermo iodfm  auvo (0t2toxopoydamtelfci s)a2uaumpnu0olxomociadfa2elnmo u0aeeoircoy1op rlueil()t2xoio ny1amtelivtasf Dum(  nt0apt  fciyd sDumuvsnt4 eerxr3ia1lp eaivs s sexmir ny1lltnlfvtat a2uaxr nu0aptn feiat aDua( o u)treoifcoodfpt ln o;s  rtm(o io1lm   nci s sDtmu oot0openioetlsls2umnmont0tltoxr ta1fa r i s s)s2ur(mpoy1om nlnvslt aruaum ;u4tpt ioeiytfmDuaumsnt)trtnmf iotfate ivo s)t2tmim ou4ol e fes s aDtmx pnt0alx  f3iadla2ul(mo;u0 rxoio ta1fpD li ils) 2umimpno1ole mnctl(fsrrm( pnu0ale ioetadla ea(vo;(0alxrmfcoatomte ivs;t) rum(mpnu4al elfet s srur(  ;t4aetnmf3iltfa2rmnvp;(4teerxo tadoaDean i;()trur(rpno4opt miciasfsDrmxmooo4oex mi3tydfs rln sn()tlxrif iodfaD  uvi;t  rxr(r nydopenmnvs t arumx  ;t0oet io3iydfaDrmnmon(4tetnir3todlmDe ivs s)sexmim oy1opeemiviat) 2rr(rooo0altoifeildlm2um(vont4trxomrcoatfmD  u sls) 2tmiopnu1lm  mfcs t aDtr( pnu4ape mfctydla elumo (0trtoiocoy1laDrlnvilt  2xo(o nodaptnmfetl( s2tr(mp;t1opeomictytls ea(mp;u)aeenmo3ta1op r ivi ()s2xmxr3oudaptnmfvi () 2um(ronu0aex  icildfs ra(vpnt4teerif iodlpD luvo t s2xm(opio1omeemfct t) Dtmx p;u0apxo ictltfm2rl(vo t)altomf oo1fm e u s t) eumirpoy1amenlnetas)a2uau pno0teenii3tytfsDumuvo;t0 rxrmr iodopDeanvo;t0 2xrxo3no1omenmfci t)a2uaxrp;o0altnmoeildla el( s u) lxrmr tytop r ieo t0 etoxrpio4am   ncs t)aDuru pou1altoiociasla2uanmo;t4 exnmr oadla rlivi;(0teuoirpoo4lm  mivtas  2ta(ro;u4aeeoifctyt aDran ont)tleomo oy1oat lnvo;t0trtm(o oo1om elfetlt)sDtmxmo;u0oex  f3ilsla2eau s (4aeenio io1faD aneo;( s2um(r3iy4ll n nesls)a2trurp;t4aeenmoetydlsDeaumo t0artoir ta1fpDrlu i;s) rxrir oudaltn ici t srrmxm ot1tlxn f3iadlsDel(ms t4 etoxrciadomt luvils)t2tmio ny1amtelnetlt s2tauroot1tet ifetatlm elnvs (4alxnxf3tadop  li ils0sruo(m3ny1lpt mfctlt sDrau o;u0olxnmictltfaDuau on(4artnmf iatlp r ieils0s2uoiopno1lp emnetls)arra(m ot1apxnifcildfmDuauvs;(0 rxrxfcia1la   n s s0tetoxr3ny1lp emfes tf rurx  no0ape moctlsfmDemuvs (0 rtoxf3io1fmD an i ()srurxr3nudlm nmfciat a2taxrp;u4oexo feiasls uan o;() etnmo io1opDeaneils truoir oy4lme  nctas aDrmx  ;o1aeenioeildfs2ul( sn(0tleomrctodlat ln ol() etm(o ou1om emict s srrax ont4teen i3iys a2uau p;(0 eerxr3io1opD anvi s0 etr(r iudam n ncsat)s2rr(  ;o1altn fciyt sDulnvsnu4teerirciotopt  n i;(  exoirpoodlm  mnvsasfa2rm(mpnt0tpeo f3iltfm2elnmp;u)texomf iytopDr ies s t2xm(opio4lm nlneia()srumumpot4opeomiciydfaDemn o t0tetoir3iy1fa r i s;s)srxr(opnu4ame lnct tf rurxmono4apeo fciasla rln s ()artomfctatfp elies;t tetrxr oy1aleemfesas)aDra( o;t1oex mi3iatlmDeaumpn(0 etnmociotlpt aivi;( s2xmio iudam  liciat)a2taurpoo4olt mfciatfm2emn s (4 eerifciytfat  ivolt0 ruoim3nodameemnvsl()aDua(  ot4tptnifeiydfa2rmums;t0 etnirciadomt lnvsls)texo(mpnodopt  fcsas a2tmxmo;t4olto fetysls2umu o;t4 reoxfcta1lp r ieo ( teto(o3oo4lpee fcsa(fsrumxronu0tlt ioetysfs emn s u4aeenxo3io1opDran s ()trto(mpiu1omt lnvsl( a2ra(  nu0opx iociytls2rmnvp u4artrio3oytoatr iei;s) 2xmimpno1ope mfeslsfsDurxrpno1tlx mi3iltfa2ulnmp;u0 rxnifctydfa  aiei (0setmxm nu1ape lietas) 2raxmp;u0tpxo oeiydla2ea(vo;t0 rtrmo3ootfm e nes;t texoxrpoodlmt  fesl( srtruro;t4texo fciytla2em(vs;(4 lxrxr oy1optran s;(0s2xrimpnodlptemfcsltfarumx oot4opt ioetyd mDemn ont0alxrxoctadomD li o (0 rxoxr3oy1optnmiciltf 2uru poo0tle iictasfm2umu o;(4aexrmfcoo1lpte nvo;(0 2urxr3iodaptn netasfarrr( o;u1ope mo3ils a ran ont)aetnmf3tadom elueil(0srxm(opno4am  mnctlt) rtrumo;t4tlto f3tys sDea( s t) renxrcia1lp eauei;s)texmiopnydope lfesas) 2uaurono1aet mo3ilslm2emu s u)trxrif3iydlmDr i il(0 eur(o iy1amt  fviasf 2rm(  ;o1optomieilsfmDua(vo;u) lerifctotlpDrau il( srxo(o oy1om emnvsls a2taxr oo4apxnmi3ildla2ua(mo;t0tlenifciydfp eai o ( srxr(rpio4ll nmfetlsf rumuroou4ope mfetatfsDum(ms () exoir3oydlptran i;s  rto(o3no1ap e fet t  2umxmoou1oet moeiat a rau s;()alerxrciytoptrau i t  2xm(r3io4ll n feilsf Dumurp;o4aeenifeiysfm eauvs (0texrxf3iatoaD  neol()tetoxm oo4ome micil(f 2ur(mp;u0ale mf3tadfaDeluvpn(4aetoxo3tydlaDr nei;t0texr(opnudolt mncslt srrrxmpou4aex mfciydlm2uluvsnt) lenxociotomtr ivi;s seuo(rpiy4aptn ics sfsrrrxm nt0tpxn oeiyt sDelu o t0altnio3ia1oateli o;(0 rto(o oydaptnmfci t)aDta(m ot0tpxoifetydfaDumnvsn(4 eeoxf3oydfpDe u i;s0 2tm(o3iu4am emfcsasf Dur(mo;u1opx  oeiat mDum( s u4 renxr iydomtrauei;s)trxmxrpiodomtnmnvsl(fsrrmx p;t1aeeoioctytlm uanvs;t4 rxnif3iy1opD  iei;()srurxm oo1al   nvtas  rtm(mo;t1opx ifciatfmDumn s;u4tlxoxf oytfat aivslt0s2tm(r3nodol  livilt s2rruro;u0tltn o3iltfaDrlums;(4aetomf3oatop eln o;()s2uoir3oo4aptn fvil()aDtm(rpot1tpenioetatla rln pnu0tlxnir3iotoaDrau s (0s2ur(m3oy1ale mici t srtr(ro;o1aex  octldlmDrlumo () renmf ty1laD aies;s trxo(m ou4oltnmivta(fsDrrurpno1olt ii3tys m2el(vo () leoif tytoaDelu o;s  eto(m3oo1ome mfesls)aDumurpnu0oeenio3iyt m2ul(ms (0tltomrcoodlaD au s s)srto(o io1alenmfcta() rum(ro;t1apxomoetasls uln pnu0 eeoxr oa1fpDeaivo s0setoxm iu1lptnlfes ( a2uauroot1opxo f3iasfs2ul( s;t0 rxoxf3iotfm   ieo ()s2tmim3no4al nmnetl() Dtax p;o4tex  feild s eln onu0 etrio iotopDr iei s) rumxo no1ll nmivsat) 2rr(  ;o0tlt ioctytfm2ra(ms t4 rerxfcoytfp  anvo;s trxm(o3iu1ol nlnvt tfarumxmpou1alt mfcias m2ra( o;t) exnxo3oatlm r i il(0 etoxo nodopte ivt ()sDua( o;u1opeoif3iyt m ulumsnu)treomr to1lpte i o t) euoxo3nu4amen iviasfarum(monu0opt mfctyd m emuvo u)tlerxrctatopte u sls0t2trio3nudlp  mfet (  Durx  no1open iciadfa2ra( pnt0tetnif totfmD livs t) ruoxr ou1llt lnvs s) Dur(  nu1olxn iciadfs2rlnmp u0arenmo oadfmDrlivo;()s2uo(rpno1lpeelneil( srrm( o;u4oetomociys s2el(vs (4arenmfcoodlm elnvs;s seumiopoy4am emivilsfaDurx pno1aetomocildlm eluvsnt)tlxoxrciatfm  auvslt  exmxopnodllt mictatfarumu ooo1apenmfciaslaDrmu p ()areoxoctotfaDelueil(  eumirpny1openlncs sf 2trx  ou1tpto i3tytls rlnmonu0tltrir3oy1lpt lueo;s)sruoim io1lmtelncsls aDraum nu0alt ioctas s2el(mo;t)tlxoxr ta1lateanes;( tetmimpoydlme  fcs tfsDrmu  ot0tet io3tyslaDelu snu)tlenio3io1fpDranes s  ruo(r iu4lptn neilsf 2rmu oou4apx mf3tat s ulu o;u0trenxr io1op elneolt) rtrxrpiydap nlict tfs2tr( pou4olxoioeiyslsDuanvsn(0alxnmr3ta1fpteauvo;s) 2toxm nodopt  ncil() Draxmont1aleniicildfs2ra(vpnu)tlxnmf3oa1opDr i s;s)truo(o3nu1lptelivs s) 2ta(r ou4tetomieilt m2rl(vs;(4texnxo3iotfmtrlu ol(0srxmxrpnu4omee nvtl( s2raxrono4texo f3iadls emn p;t)artrxfcio1lat au i t texoimpoudllen nesa(f Drrumoou1alx mfeiat aDrm(vs t)aetriocoadfmD anes;s t2xrxr ny1apenlncslt aDtr(  no4tpxoifciltfs em(vo;t4artoxf3tytlateauesl()s2ur(rpnudlpt miet s sruaxm ot1aptoiieiyd m2uanmonu0trtomf3ootfa rln il()t2tmxr iudolenmnet s artau ono1oleoifetas mDean snt0trtoio tadfp  au i t  2xmxm iydlp e fcilt  Duaxront4alt  o3ilsfs2umnvo (0 etoxfcto1lm eln i;s0 rurim3nudopeelivs ()arrrxroou0tex  o3iadlmDeauvo (0 ltrxf3oadfaD auvo t  2triopiudam  lfvi tf Duaur oo4olxn i3tydlm um(vp u0arerir oo1lmDe ivs;()srumxo3iy1lltnmncs tfaDrru pot4olt  oeilt sDrm(mo u0trtoir3oa1lptr ies ( srxmir3oy1lpt mfcsltfsrtmx ooo0olenmf3ils a2rl(msn(4tleomr tadlaD  nes s)trxoxo3oy1amtnlivia() Dtrum no1oexomfetadls2umuvp;u0aeerxo iatlpD auesl()t2xrxmpiudalte ivi sfarraxmono0oet  o3tysfs2elnmpnt0 rxrxr3tadfat lneolt0teuo(opiodomtnmnct s)aDua(m ;t4tpx ii3iatfsDuaumpn(4aetnmociydomtran o (0 2xr(m3nu4lmtelncsas)srtmx  ot4tpe mieiat s2el(vp;t4treriocootlptelneo s0 rxm(m3ou1ll  lncta() rta(mp;u4oexomiciasla2umu ont0arerxfctatlaDrli s;(  2trxr nu1olt  ivta() 2rr( pnt0alen f3iyd m ulnmp;u0 exrif ta1fpt  ieol() rxoxrpiu1amtelnvt ()aDraumo;t1aetnif3iaslm ua( s t4tlerxf3totlat  ivi s)s2xrxr io4omt liviat  2raxmpnt1tee ifeilsls2uau p;() rtrxocta1lpDr nei (0srtoio3iu1apeelnet ( aDtaum ;o1apt ifeiat a ul( o;()tltniociotfpDrli o;s  rxoiopno1openmneslt)sDrm( o;t1tle ifciatfm2rmu ont4trenir3ta1op   ueo (0s2toio3nu1omtnmfvilt) ruaxmoou0aetoii3tys a elu s t4tetrmfcoodfaDrlieilt0teum(mpiu4omtn fcil(fsDumxrpnu0tptn ictytlsDua( sn(4tltnxo3tydfpt an sl()tetm(o3nodol  livtasfartau pou0tptoif3iydfaDrlnvpnu4 reomf3tatlptrlu ilt0 exrio oodlmeemnesls)aDrmxrpno4opto i3tysfm2uaums t0 etnxo tydfaDe i ils trtoirpiu4apeemiet (farurxrp;u4aet ifciadla2rmn o;()trxnmoctydoaD  nvi;s)s2xoxm3iudll  miet t artr(rpno4aex  fctyt aDuaumpn()aetnmo tatfp r n s t0srumimpny4lpenmfcias)s2rr(ro;t1aeto oetysfs2ul(vo;t)texnmr io1fp ean o s setriopnydlle livs sf 2ururpno1tpe mf3iyd aDem(vo;()texoxfctotoaDran s t srtoim nodomte fvtl( sDrr(rono4oex ifetaslm2raumo t4arenxr to1omD  n s;t)trxmimpio4lltelfcsl()aDrm( pnu0ale  i3iasfs2rl(vo;()texrxr3oadfmtranes s)texo(o iydope lnvsl(fsrraurpou4tpxnmfetydfs2umnvs;t4 lxnxocoatfatelieo;t0s2xm(r nu4omtemfciat  rtm(r ;t0aetomi3tasfaDul( o u)tetrif oy1fmD  i ils  exm(r iudalte icilsfa2uax oou1teto o3iltfsDeauvpn() ltoxr3tytfm rlnvi;t) eurxo iu4al emfciat aDrru  no0oeenmiciltfa2um(mpnt) lenif totlmDrlnvs t  2toir3oy4olenlfcs tfsrtmxrpou0apxnifetydlmDuanvs;t) lenmf3iy1opDelivs;t0seurio3nudamtnmneiltfsrurx pou0tpt moeiyt s ulu s (4artoxo3todfptrlivo;( srtrio3oy4omtnliei t)arta(r nt4tetnmf3iysfs umnvs;u4aeerxr3iodop ran olt0trurxm3nydlm e iei () Drau pno4tpxn ociyd m2ran snu0 exoif3iadfpD  i o () rurxr3oudam emivta() 2rax oot1oexoifeilt m ul( pnu4tltrxf3tatlmte nvolt0trtrimpoo1ol  mfesasf Dum( o;o0aeeomfcias s2el(vs;(0tltnmr3iytlp eaivo (0t2xm(r3nudopeemfvils)srtr( o;o4tpe ifeiyt aDulnmpnu4 lenioctydomtrlnvo t)tetr(m nu1llt mfeta()a2tmxrpnu1aexo i3iytfa ul( s;u0 eenmr tydomt aneol( s2umiopiudlp n fet ( aDrmu p;o0tleo oetydlaDumump;() lenxf3iadlm  aivi;( tetmxm3ny1ope mnetl(  rtmump;u1tlenmfetyslsDeanvp;t4alxnmf iadlaD livs;(0 2to(rpoudolee ies t srtrum nt0teeomoetyd s2el(vs u) exoir3iadlpDeli s ( sexrir ny1opeelnviasfs2rrxmpnt4olxoiociyslm uaumo;(4 ltnxocta1fpD  i s () 2uo(rpoy4apt  fes ( aDtaxmooo4aeeo feiltfm2rln s;u4trtnxr3io1fatean o s)s2ur(o iy1llt mics s aDuaxmoou0tleomf3iltfsDuanmp;u4tetnxr oydoateaivolt  2uoxr3iudol e nvsat)arur(monu4tetnii3tas s2rlnmon()trenirctadomDr u i (0teumxr no1oltnlieilt s2uaxront1oeenmiciadla2elums t0trxnmociytopDelnesl() rtm(opoo1oltnlnctltfsDum( pnu4apxo ietyt m2uanvs;u4trxrmf3tydoptelies s) 2um(opio1lpte nciltfsrrmumont4oee mfciys aDuau snu0aetnmrcia1omtr ies;t)s2toim iodop e icsl(fs2trxronu4alxnmoctldlm2um( ont)areoxf3iatopDrlnei;s0 rxmxmpoy4op elieiasfaDtaxronu4ole iietydfsDum(vs (0altnxr oadlpteanvs;(0 2uoxrpiy1ll n nctlt)aDua( p;u0tlt  fetadlm emumo;t)artnmfctadopte nvi;( t2um(o3nu4llenlnci sfartm(mpno0opt ifeiltlm rauvonu4 rxnio3iydopt an s s0t2umim nudap e ncils) rtrxm ot4texo fctlt sDumn p;()arxrmr3todopt  i i;s0 rtmim io1aptelnvt sfa2uaxr nu0aee ioetysfa rlu s t4trtrmr tydomD  nvo;() 2xrxr3iy1lm n nei tfaDrmxmpoo1ale  ictltfsDuln pn()treoio oydopDraivo ( teuo(rpoydome  ivils)aDrrum ;u1aexn oeilslmDean s;u0aetnxr3io1fm e ieol( srxm(o3nudolenlfvi (f rraumono0oexnmocildlm2um(mpnt)texoxo ootfateaies ()trtm(r3iodaptnmfvias sDraur nu0ale iiciydfm ulnmo;u0 etoxfciatlaDelueolt0s2uriopiydll nmivsatfsrtau pnt4ale  feiaslmDel( pnt)teenmf3ia1lpt luvol()setrxm3iu1amtelieta( sDrrurpno4ape  o3iyd s rmuvont4aeeoxrcoadlmD  uvs (0setrxo3ou4aptelfviat)srrm( pno1oee  oeiatfm2rmums t)altomf todla rau ils0trxm(o oy1ope mictlt)sruaumpno1tpxomo3tlslaDrmuvp t)trermocty1fate ivi s0trxr(r3oodlp  livt t  rurxmont4optoii3iatlaDel(vs u) rtrxr oadfp eanvs;()s2tmxr3nudllt  ictls)sDtrxmp;o0aetn iciydfm ulnmpnt)alenxo3iytlatrlneslt  rtoxr nu4ol  mivi tfartaumono0oexomieiltla ea(mp;()trtnio3oydfmt  ivsls0teur(o3ou1optemfvi t s2trxm ;o4oexo fetytfa2ean s;u4 lxnmr3oa1lmte uvils)s2umimpnu4omtelfcsatfsrrrxr ot0oltnmo3iltfa2rau p u4tlxoxf3iydoaDeai olt s2umio oy1ol n net s)aDrru o;u4aet iietaslaDulnmpnt4 exomf to1lp e ieo;( srxmirpio1ol  lnvi sf Dtau p;u1tlxnii3tad m rl( snu4trenio iatlmD lnvi;( t2urxopiu1ol   nci ()srumxrp;o1oexn o3ias a2emnmon(0arxniociotoptr ieols t2tmim iodap n fcils  rua(m ot0tlto feiydfs em(msnu)treoxo3iodop  ln s t)s2uoxr nu4aptnmieta() Dtr(rp;t0oetn ictas s uauvonu4texoxr3oodlpteln olt  2ur(rpou4ol emfci sfaDraxmo;u4aexn ietadlmDul( pnt)tetnmocoydoaDeaivo (0s2xoxmpio4lp   fei t aruaxmpno1tpe mf3tld a2uauvs t0 renir3tytfpte u s t0t2urxo no1aptnmivi (fsrumump;u4altn oeiytfs rmums ()arenifciadfp r u i;( trur(m3oy1lpt  fei s aDta( o;t4tee moeiytlmDum( sn(4trxnxr3io1fa rlu s;s0s2xmxmpiodalte fvsls  rra( onu0tltomiciad m elnvs u4trxrxo totfate ieo s)s2ur(o ou1am  mneslt)artm(  ou4tpt iociltlaDuan s;u)alenir3ootfptr ueo;t  rxo(o3ou4apt lnciat s2tm(r oo1olx mieiltfa el( p u4arerxr ta1oa e u o;s0srumxopiu4ap n fvt s s2tmxm ;o0aeen fciltfa rm(vsnu)altnmr tydomteaies s0s2umim io4op  licsls aDua(  nt1aptnifetltla um( snu4 rxoxfciodlaDrauei;(0 exmxmpno1opte nesl( s2umuronu4tle io3iatls2rl( o (4 lxnxrcty1latrai o;t t2urir3nu1ll e nvt ()srtmxroot0opt mfetytlmDuanvsn()tltrmrctytfmD lnei;t)teumxm3oodopenlictls) ruax pot1tet miciysfa emu s (0aexnif io1fmt ln i ()t2xm(o oo4amenmivt tfsrtau ont0aetoifetysfaDel(ms t0aexoxo3iodla e ies ( texm(m3oy1oleemfcsas aDtru o;o0oexoioctyd mDemn o;t)alxrmfctotopDelivi;t tetoxo iy4optnmietls  rrrur ;u0tptomiciatfa el(msnt4tltrmo3iytoaD  n ol(0setmxrpoo1omen neil(fsrurur ;o0olxomieiasla rm( s (0tltomf oa1oa raneil(0t2xmxm oo1op emnei ()s2tmurpou0apt iietltla2eauvp ()aexoifcty1fp rluei s0seto(r nu1apen icilsf Dum(m ;o1aee if3iyd a2ean s;t4 leoxfctodfp e u s s)srxoirpiu4lpe mfcsltfsDta(rooo0tptn ieiat sDel(ms t0arenxocoodomDeai ol() exoxmpou1ap   fei s sDtmxro;t0tpxo octadla2rlu o ()texrmo3iydlpteli i;()trxrxm3oy4lpte nctlt)artmu  ou0oltoioetltlm2umuvp (4 exoxr oodoptrliei;s sruo(mpoudap   neils  rumxm nt0open ictytfmDul(vs;(4altrxr3oodfp rlu sls)s2xoio nu4omtemnvs ()a2rmx  ;t0aexnio3iyt s2rmu on()alerxo iadoatelueo ()setmxo3nudlle mncsa()a2trxr no1optomfetltlmDemnmpnu4 lxnmf iydopD  u s;( seurir oy1lltn fcs s) rtm( p;o0tlxoiieiys s2rl(vsnt) etrif oy1oa   ivi;(0s2xrio ny1opeemneil(  Dumu oot0aexnmi3iysfs2rlu p;t0artomf3iy1omteanvi;t0 etrirpiodaltemnci ()aDtmu  ;t1tleoifetydlsDra(mo;t4texrio iytlpDelieo () rur(o3iydamt mnes t  2tmur nu0ale  f3ilsfsDean s u)teenxf ia1fp r uvol(0 2um(opiy1lm  mfctltfs2tr(ront4teeoio3tad sDul(ms;u) reoio iotoptrlnes t0trtr(r3io1lmt miviltf rtaur no0tex mo3ilslmDrm(msn(0trerxrcootlat luvil(0 2xoxm iu4llt lfei () 2trxm no1tpx  fetat sDeauvo;u0altoifcto1fmDelieils0seurxo3no4op n iet s s2rr(m oo4oee  f3iadls2rlu onu)aleoxrctadfptr nei;() ruoxm oodopt  fcs s)aDurxmoou0apeomf3iltls2um(vo;u0arxrxo ia1la rauvilt) 2xrimpou1lmtnlicias)aruax  ;o0alxnioetltlm ul(mo u4 leomrctadopD  n o ( setrxmpou1omenmicsl()s2rrxrpno4apx  ietlsfmDulu s;t4 rxoxf3ia1omtranvs;s)s2xm(m3nu4op   ict tfsrtaumpno4tpx  ictasfa elnvs;()trxriocoo1lpDr uvi;s t2tmxr3ny4om   nvt s)srta(r nu4optn feiat a2ul(von()trtrmf tadlatrli i;t)trtmim oy4lptemncta()s2taxroot1oexn iciasls elnmp;t) rtomocty1opDrlieols)t2urirpiydamtn nvt t sDrr(m no1opto feiltfm el(mp;t4arenxf totlptean o (  2tmxo3oydllenmici ( s2tmxmoot4opxomoeiyd aDuan o;u0aetnir3iotlpt ai ils  rum(m nodopenliesls)srtrx oot4tpe  oeiaslm elnmp;u4artoxr iotop rauvo s0s2urxrpiy1amtelnetls s2rau oot4opxomf3tltlsDemn on(4texomoctotlmDeln o s0t2uo(m3oudap emfeiatf rtmx o;t4oltniociyt mDrln ont)aetoxo3iydlmt aieo;s0 rxrxr oydoltemicil(f 2trumpnu1oex  ociytlaDrm( s;t4 rxoifciodomtelnvi;t0teurir3io4ape  ivi t arumur ;o0alxnmfciadfa rln p t)arxnxo tadfa ran ilt  rtmxr iu1amt  icsl( s2urxmonu0ape mociydlaDrl(mp (0tetrxo iadfpDeanvslt  etoiopiu4ameemnei tf Dumx p;u0tetnifctlsfm2rmn p t0texomr oa1oa rln i (  euriopiudlpe lies ( s2tau  oo4tpt mictls sDrln p (4 lenxf3iy1lm rai s ()srtm(m ou1apenlivtasfsDrr(  nu0opt  o3iys sDrlnvo (0 rxoir oytop raneo s)srxmxr3iy1amt lnct sfartm(mono1tetoiietlt mDrl( o;(4 lxoif todlp e ueo t srurir nu1ol n nvsls  Dtaur nt4tetomfctytfmDulu o (0 rxrif3tytla rln i s  exr(mpiy1optemivtl(fsrrrur nu4texoio3iys s2rm(mp u)aeerif3oytfp r n ols) exriopoodlptn iciatfa2rm(rpnu4tleo o3iytlmDean o;u4 exnmo3iytlm   ueo t) euoxo nodlmtelfes sfa2ur(mpoo0tleomfetldfm2uluvp;t4tlxoxr3iytlpDelnvils0s2xr(r3ou1ap  lnvsas)a2rrum nu1openiietas s emumo t) lenxo oo1opte uvolt seuo(o nudom eliciatfs2tmu  ;t1altn o3tltfmDra(vpn(0tleoxf3ia1late uei;( srxoim no4om e nei s  2raxmonu4opt ifetyd m2ea(vpnt4 rtnmr3oodlm r u slt0t2um(o3no1lmt micilsf Dra(m ;u4olx mociytfaDra(vsn()altnxr3tatlpDrai i (0t2xmxm oodlmeemnetlsfa2tax  oo1opeomiciltls rau sn()tetomocoytlp rlnvolt)sexm(r3oodomtelnesa(fs2tr( pot0apt mf3iatfa2eluvp u) leomo ootlmtrauesl()srtmxo oy1am  mneilsf rrr(rpnt4aet if3tltlm uaums;(4 lxoir3tadop   nei;t)trtoxmpnydap e nvt (faDrrx  ;u4tpeoiietldfsDra( p;t4alxomrcootopDraieslt  eur(m oodlpeelfet t  Drrx ont0oex  ociyd m2rlump t4alerircoo1lmt ln il( texo(m3iy4lpen fcsls artau  ;o0tlt  ociasls eln on(0aetnio3iy1oa elivils0 2xrio3nu1al emfcilsf 2tau poo1opx iicilt m2ra( s (0trxnifcoo1om rli i ()sexoio iu4lm   ictlt  2trumpno1apt mo3iatlaDelnmo u4areoxr iodfaD  u o;t0srtrir3nydlpen fvi s a2rr(mono4tex  fciyt sDea( o;t4teermrcootlmDr uesl(0 ruoxm iu1ap  micilt)a2ua(moot0alen oeilslaDrlnvpn()trxrifciy1lp rli i;() eurxm oydol  mnvilt aDuaurpou0olenmietys s2ean o;()altnxo3oytlatrliei;s0 exoxm io4ale lnvi tfa2rm(r ;t0aet ioeiltls em(vo ()arxnio3oytomt luvs;s seuoxr nu4llt lnvtlt  Dtrxmpno1openmo3tytla rln ont)arxnmo oo1om  lies s  2trirpnu1am nlics ()artrx poo1ope ioetls mDumn sn(0 rxomf iatfat au ils  rxoim iu1altn fetat)srraxmpou4oetn ietys sDumnvs u0trxnxfcoa1omDrauvslt  2ur(m ou4ameemnvtls a2uax o;t0tet  o3tltfmDeln p t)arxnircty1opD luei s)s2xriopoy1ll  livtl()aDtmump;o4optnif3ild m2eanvpnu0arxnmrcoytop raues;s t2tr(mpno4lmtemncia()aDuru p;o4altoiieiad aDrmnvs;(4 rtoxocoadlpD  ueols t2xm(m3ny4ll nmivsatfsrurx o;o4aetn iciasfs ea(vp u) exoiocoo1oatean ols0sexmimpnydape  ncslsfsDtr(  no0alt mfciadlmDrm( s (4tlxoxf todfat lieol(0srur(r iu1omenmivs s)sDrm(roou4olx  ieiytfa ea( o ()aetrirctadlmDr ues;t0t2ur(opiudameelnetat srta(rooo1olt ifctasls2rlu o t) leoir3ta1omtr iesl(0 rxmxr3nodol  lnctltfaDtax p;o0teto fetyt aDumnmp t0aexnmfciodfpDr ueo t0seuoxrpoo4omenlfes sfsrtr(mooo4open feiytfmDrmnvo t4 exnxo tatlpte u o t0 2xmxr iy1omt  nvsa()sDtrx onu4tleoifctldls el(vsn(4aetrxf3oadlaDr nvs t) ruo(m3iu1oleelivs sfsDum(moot1tlxnio3iyt a2rmn p;(0treomo3oatomteluvo s0 2um(o iydomeemnvsa() 2rax  ;t4texo i3ildlaDea(mpnt0altnxo3iodfpDe ivi;()trtrxo io1oltnmici tfa2trx oou4tetnmieiad m ra(vp u)trxrifctatomtrlneo;s0t2urxo3iydam  lnvi t)aDrr(  ;u1altn ociys a2ul( s t4trerxrcootfpt  uvo s0 2xm(r iu1ape  iviltf rtrx pot1aetomf3tasls rau o;u)areoio totlpt  uvo t teuoim iu1al elnvsa()aDurxmpnt1alxn icias a uluvp u)trxrifctytop eluei s tetoio nodamt mnct sfa2raump;u1tptoioetltlm rmnvs;(0alxoxr3oo1fatrlivil(0srxo(mpno1lm n fci s)aDtr(rpnu1tlen ictys s rmumo;t4aetomf to1fpteli s (  etr(r3oy4lpe mivils)srumu poo0alt mfetldls2umn s;t)alxrir iatlp rluvsl()seumir no4ll  lictatfarrrxroot4aeeniiciydls2emuvo;(0altnmf iatlp elnvi;()srurio oy4ope  ivsat) 2tm(r ;o1tetnmf3iyt a2umuvp u0trtomf3oytfmD  u ils0setmxr3ou1aleemivt t sDraum ot1texo o3tas aDrm( onu) lxrmo3totfpDranvi;t s2xoir3oo4opee ictl(fsDrrumoot0oetn o3tltlmDemnmont0 eeriociytopD aieo;()t2umxrpiu4omenmici t  2trumpnu0tlx mfctlsls2eluvon() leoiocoa1omDrai sls srtm(m iodlme  fvt t sDra(mont4tpt ifcias sDra(vo;(4 eermfctytlpt li i t0 2toxr3ny1lmtelfet t s2rrx  nu4tlxoifetadfs ua( pn(0aeeoir oytfpD  uvo () eur(opoydoptemivtls aDraxmoot4optoioeiyt sDeanmo;u0tleoif3totfpteluvo;() 2toxr3iy1ol elfes tf rraur ;t0aeenmfetatlm uaumo;t)aetrmr3ootlm  aies s trumxrpoo1openlnct s sDraum ;u1oeeomo3ildlm ulu snt4 eenmoctytopD  uvo;t)trxr(o no1lm  lfvslt)srta( pno4altomictldla rmumon(0alermr3iadfm raneo;() rxrxmpnodaltn ieilt)artm(monu0tle ifctysfs rmnvs u)trerif3todomteliesl() etoxr3io4apenmncil()srtmur ou1apt miciyd m ulump;u0texnif todla   ivo s0texr(mpoydam n neils)aDrmxroot1tet  f3iatlm2rlnms;t4aetnifctatop   uei;()sexoxo ny4llt lfviltfsrtaumpno0tpx mi3iys s emuvpnu0 reoif tytfa  ai ol() rxr(m3nodlmt mfvtltfs2ur(ro;o1ale ifciysfsDemu pnt4tlxrifcto1lp  livi ( s2uoxm3nudlmt mfeil( arrmxm ;t1oltniociysfsDeanmo () rtrxf oy1fmt aiei t)texm(r3iudop emicsat a2ta(m nt0apeniociys m2emumpnu0alxoir iatomD aueol( trtrxr ny1ol emici t) Dtau poo0ole ifctatlaDulu p u4 rxnmo3oo1fp elivo s) 2uoxo iudll nmnct t) Duaurpoo0apx  ocildfa2rm( p u4aexoxfcoodopte ueolt srurirpoo1am nmfcil(fa2rmurpot1oex if3ils a2emuvo t0aeeomo3oatlm  lues s  2toxr3ny1op   ivils)arurumpnu0texoiictlsfmDra( onu0 lxrir3iatlpte n sl(0seumimpno1op  mieias)a2umurpot0apxn f3iyslm umu s;t0 ltomo3oo1fpDrlneil(0 euoxrpiodlmeelnvtlsf 2urum oo0tptnmi3iadla rmnmp;()aexnmoctotfpte u olt trxm(r iy4opt  ivta(fsrtm(r ;o1apto ictyslsDrm(msnu4trxrio oydfptraueil(  2xoxopiy4opt  nvslsfarrmxrpoo0texo oeiatlm uanmpnu4 ltnxfcoo1faDr iei s  rur(r3oodamee nct sfsDururp;t1tlxomietatfa2ua(vs t0 leoio todoaDeanvolt0setr(r3iy4ap  lnci tfarrmu  ot4olx  fciatla2em(mo t4 eeoircoy1fmt ai sls srxoirpou4omenliei ( a2uaxmpnt1oex  o3iatlmDrmnvp;u4trxoxr iadopDe ivs s0srxrir3oy1amenmncil(f Dururont4aleo o3iytfsDrmnms;(0 lxnmo ta1op ranes (  2to(o3io1ap  mnesa( aDuaxmoot1aet io3iadla2ranmpn(4texrmr ty1oa eln ol() 2urim3iudapt lies ()artmxmoou4oetnmieilt mDemn s;(4alxrio oy1lm  an o;(  2xo(rpnydlptn ictatf 2rau pnt1olt mo3iyd m2el( s () etnxr3ootfaD lu i;( trum(m iu4ll nlnes sf Drrumo;t4texnii3iad s uanvo;u4trxomrcio1la raivi;(  rurxr iy4amee feta()aDumx pnt4aleomfcias mDrmuvs (4arenir iodlaDr iesls trumxm iudllen iei t) Dtm(roou4oeeomo3tytlsDeanmp u) leomf3oydfatrluvs;s srxoio3iydaptemivtlt aDraur ;t0oexnmo3tydls el( o;()alxoxr iadfm e ivs () rtrirpoudlmt lnvtas sDta(rooo4opt  octlsfmDumnmp;u) lxrxo3todomDelivs;t0 2xo(o3oy1lpte ivs s) Dra(mono1tlxnmieiys m rm(mo (4trxomo tatla ranvo (0srtmxrpnydape lnetl(  rrmxronu4oetomfetaslaDumnvo () eermocoydfa r ueils)s2tr(o oo1ole livslt) Durxm ot1teen ieiys s2raums () eerxoctotfaDeai i t)s2to(m oudamt mnes tf rta(m oo4texo fciltfa2ra( sn(4aleomr tytla r u o (0srxoim iu1lptn iviat)sDtrum nu0opt mfetltfs2rlnmp;t4altoxrciy1oa eai o;s  rxmxo oudaltemnetat sDumxmont4optn i3iltfs rmnmo t4trtrif iotfa e i s ( trtrir iy4ap   ivsls) rta(moot1tlto f3ilsfaDrmump;u0 lenif3tadlat  uvs;(0s2urxmpny4apte ietls a2tmumono0tle  octysla2ea( s t)tltnifciodoptrlies;s0 2toxm3oudllenmicsls  rumu pot4aee ioeiysfa elums;(0tltoir3iydoptran ilt0s2to(opiu1aptelfei s srtaump;o1ale  icias s rluvo u)aleomo iodomDean olt sruoxopiu1lptn fvsl() 2urxm ;u1alt  ociltfa2rm(vo u4 renircoytopD  i ils)t2xrxopny1al  lnci tfsDtmump;t0oeto i3iat mDel(ms u4 renmo3io1la  aues;()sexoim iy4alenmnei sfs2uaur ou0oetniociyt m rmumpnt4aeenxr3ootfmD ai sls trxmiopoy4omen iesa(f Duax  nt0olxnifciydla ea(msnt0aexoxr ia1omDraivs s0srtoirpoodap nmfvtls sDurum nt0oeeomieias s2eanvs (0aleomr ia1opDrliei;t0seuoio3no4olt  ivt t)s2rmu o;t1tlx  fciad a2em( s;u4 ltrmociatomt auvo;()texmiopnodolee ivtatfaDra(mono0olenmieiltfsDranvs;t0tltrir ia1lm r nvi;( seumir iydlpeeliciat arrau  ;t1oetnio3tltlaDelnms;u4 eerio oadlpD  ivs;s0s2xm(r3nudole lies t s2raxrp;u0aetnmfetatfaDel( p;u0trtoir3ta1fmDr u i () rtm(mpoy4altnlivias  2uru oot1tpxn ieiadlm2eln s;(0 rxnxf3oy1opD anvil( trtrxm3nu1lptnmivsl()aDrmxmpnu4alxomoeiaslm elump;t0 etrxrctadoa   i i t)setm(opoudll e ivil( srraumpnt4tltnii3iyt mDrlnvp;t0 reoxr3ia1opDelnei;(0s2triopnydolt mict (fs2taur ou1teto octatfa em(mp;u) rerio tydla   uei;t setm(mpiodlmt  netlt)sDtrxr ou0olxo f3tydfmDumump t0arxnmf tytomteanvi;s  rxm(rpoo1lptelictl(  Drmxro;t0tetn fciys s eau p;u4aleomf oytfm  anes s)s2toxr oy1ap  lieiat  2uaxr nu1oetomietat s2el(mo;u4arxrif todfaDr uvols0 2urxrpoodapeelfvslt) Dtm( ono1tpx mociltfmDrmuvs u4alxoif iotomtrauvi;( sexoir oodlp n ivta() Dtrumpnt4opxniieildfm2em(mo t0arxrir3iotoptelnvs;t0sexoio3ou4omeemics tfsDtmx pnu1tpt  feiad a eluvs (0teenif3tadfa r ieils0 rurim3ny1op e fcsatf Dtrx o;t1opx iictlsla2ulu o;()arerir iotfa e u sls  2tmim3io1oltelies (faruaxrpoo4opx mfetadfa2rmu pn(0 etniocoodfptr uvo s) 2uoxo3no1ol nlfeiatfsrrmx oot1tpeomo3iatlaDem(vp u4trtomo iytlmDe neslt) 2tmxr3nudalte neia() Dtm(r ou4opt iocilsls2uaump ()treoif tadomD anvi () 2uoio nu1ll  lictat) Drm(mp;t4tetoiociadfmDel(vp (4alxnmo iydop eai ilt)srtmxo3oo1amenmnvta(faDtmurono1tex  iciadfm rmnms;t)trtnir3iytopD  neolt)sexr(m nudopt  iesa(faDrax  ou1teeo ietatlm uaumpnt0teermrciy1opDeau ilt tetmiopio1apt mietls aDtmum nt0texoif3iys s2elnms;u)trtoxr oa1omD  nvilt)s2uo(r3nu4alee nesas)a2tm(mpnt4tpenio3iyt a ulnvsnt) lerxr3to1oateaueils0srxrxmpoudape lfcs tfaDta( p;u4oet  i3iyd s el( p;t)tltrmocoodoaD lueo;s0setmio nu4amenmieias)a2uaxronu4tle moeildfsDemuvpnu0arxrif iodopDrluvilt setrxr nu4lp  mnvslt  Drmxm oo0tptnmietltlm uau s;(4 lxomr3oytla elivi ( seumxrpio1al  mnes (fs2raumpno4olen iciytfs eau o t0aleoio3oo1fmtraneol()texr(m3nu1amtn fetls a2rm(mp;u4ape mi3ildfa2emuvonu)teeoxf tadlp r ues t0 2xo(r iu1llt lfesat  rtr(mo;u4aexn ietadla uanmpn(0arxoxociatlm ranvo t)t2xoio ou4lmtelnvs (fsDtmx pot0aetoiictydfsDrluvp u4 ltrirctodfm rau i;t  2um(m io4ole lfctat aDrr(mpno4oex miciyslm ulnvs (0alxnio3iodoatr u ol()srum(o iudapenlnvtatfaDraxmpno4oltomi3iadfsDelu onu)aleoio iatfmte ieo ()sexriopoo4lp  mivsat) rtm(mpno0aeen oeiatfaDua(msnt) etrif oo1opteaieo t tetmio3nu1altelfciat) Drm(rpnt1alxo fctydlaDemumo;t4 etrxo3oadfaDeaneo t0 2uoxm3iy1oleelivia() rurxmooo0tpeomf3tyt sDumnmon(4 exrmfciytop r i o s s2
\ No newline at end of file
@@ -0,0 +1 @@
+uvo s)seuoxr oo1altemfvils a2rau  ;t4texomo3iadfsDranms u)teenmo oo1omtr nvi ( t2to(rpno4oleemfeta()a2rrxmp;u0tpxn i3iltfa elu o (4aetnmr3oytlp  an o s  rtoio3iu4lltelfcsl(faDum(ro;t0opto i3ilsfm2rmnvp;()treoif3tadlptean slt  rum(o io1optnlfeilsfaDua(  nt4tpeo ictlslsDuauvo (4aetnif3ta1fmD anei t  etr(mpny4lle mfesat)s2ra( poo4aet mo3iyd sDrmnvp;(4 etoir oydoaDe ivilt  rxmxo iy1op elies ()sDurxr ou1tetomfcias s ean onu)altnxf3ia1laD  ivi;s tetmxr io1omt  ies (fsrtaxronu0oeenmoeils a2eaumsnu)texrir iotop rlu i;( sruoio ou1ale mieias) 2tax  ou1altnmfetls sDumn s u0arermr3ia1opD aueo;s) 2umxrpnudlmen feilsf Dtaxrpou0teeoiieiat aDel( o;u0 rtoxociodlm r nvi t tetmir3nudol e fvslsfa2rmx pou1olxn ieiyd s2ua(mo;u)texnio ta1fpD  i ilt  rtm(m ou4aptnlnvi s)srur(  ot0opxoif3tltfm2ul( ont0 eenxf3oatlp e n i s  rxriopiudapee nviatfsrumumo;u1alxnmociltlm ua( pnt0arxoxr iotoptr uvs;()s2tr(opiudlptnliesa(f rtr(ro;u1texoifcias m em(vpnu0tlenxf io1lpDe n o (0t2xoim ou1ameemivsltf Drmxmp;u4optnii3iatls elnmonu)arerxf iydopDr nvilt) etr(o no1ll emfvi s aDtr( pnu0ope  ieiydlm rln s t4aexrif iotlmteaueo t0setmir nydlleemnes tfs2tmxrpou4olx  f3tyt sDeluvsn(4 etrxr3ty1faDran o;s0trtrxmpou4amtn iviat arrmxmpnt4tpxoio3tat s2rauvonu) etoxocoydlpD ln o;t setr(o ny4amen nct s  Durxr ou4teenmoetasfa umumpnt4 leoio3oadlptr uvol( sexr(mpiy4am  lnesas)sDtmumont0olxn oetad aDea(vo;u4tlxrxrciotlpt ln o ( srto(rpno1altnmivt (fs2tm( ont1tptnmieiasfm ulu s u0alxnmo3totfaDraiesl()s2to(rpou4ome mnesl()s2um( p;t0tpeo fctat m2eanvs;u4texrxr3oydlmDe uvo (  2uriopoy4om e iesat  rua(ronu4aee ifciyd s2ua( s u0arxrmrctadoat auei;(  2umxm ou1lp emnvslt) Dra(r ot4oeeomi3iadfm umump u0 exoircto1fpD lieo t  rurirpoo1ll emnctasfartm(mo;t0tlx  oeiysls rl(vo u4arenxo tadfpt aieolt)texmxo nudoptemnciat arurx oou0aetoif3tad m2el(mpnu0teenxo3iodomDelneslt)sruo(opoodapt mnetasfsDtau oou4apt  ietyslm2rau p;u0trxomoctydfmt  uvs;(0teurxm io1amtn ict (f Dua( p;o0tptomf3tlt a2elnmont0 etrmfcoatfate neol(  exrim3iudom n ietatfa2rmump;u1tleomi3tad s2ul(mp u4 lxoir3ta1latrauvs;s0s2ur(o3oudopte icil()a2umx p;t0olxo ociydlmDem(vpn(0texnmo ootfa eln i ()setmxm3io1amt lneias a2rr(m ot1tet ifciatfa2eanmonu4tetomocoodfaDr n ols) exrxopiudal  mnvsa()artr(rpno4tpe  fetasla ulnms;() lenifcoa1lpt an s;s0trum(mpoo1aleelnviat)a2rmxmooo0tpen ocilt a uanvsnu4alxnxoctytfaDean o;s0teumxr3ou1lptnlnetl(  rrrx oot1aptoif3tltfs ranms;u0 rtriocoytlpDe u il()s2trxo iy4oleelfeiat aDrmx pot4tpe mictltfsDrmu p;u4areomocootfatrai o ( trur(m3ou1altelicsas) Drm(  ;t0aetnmociydlsDel(vp;u)altrxo oa1laDeai o t trtrir nydame mnesl()sDra(monu1tlx if3iys s2rlnvs t4trxomf oytfpD luvilt0trtmirpnudop nlnvt s s2rrxrpoo0texomf3iysfa elnvs u0tlxnxo3to1fp r ivs t)t2urxr3ny4ll nlicslt) 2rmx  nt1aetnmfeias s rau on(4 etnmf3oytoatraivi (  rtrxrpno4op nmnes t  2umxmont4aee  fcilsls2ran s;t4aetrmf3tydlm rlieo;t  exrxr nudom emfcil( sDum(rpnu1oeeomoetadla eanvp u4tlxniocoadlpDelneo (0s2umir io1lpenmfvs t)a2rm(rono0tet mo3iat sDemnvs (0alxomr3oatom rlies t0srxrirpnu1om  lnctls s2um(ro;o4opxoifetydla2ea( o t0 etnmocoa1lm rlies;s0 2xrxopio1am elicilt a2rrurpnu4aexoiictldfs ranvsnu) leoxf totfp eln i;t0teur(r3ny4lmenlnvt t  2tru p;u4aleomf3ilsls ra( o;(0 rtnxo ty1lm ean o;s)trumxrpiudol n nes t aDrr(mooo1apx  fcilsfs2eanvont4aeeoxocty1oa rauvi t teumxopio4lleemfetas)aDumxm nu4oeenmictas a ran o;t0teerxr3oytfmt lues;( sexmio oo1alt mneils)srtr(moot1teeomi3tatlmDrau onu) etrmfciodlmt auvsl( tetr(o oo4ameelfvil(fa2rrxrp;t4teenmo3ild s rmnmo;()aeeoxf iatfp  an s;t)srumir3ny1lltnlfvs tfsDta(mpnt0tpxnmfctltfm2umnms;t4trtnxociytla ranvo s setoio3iydopt lfvsls) Duaumpnt1ale iieias s2eaump t4arxrxf iytlp e neol() 2xoio3nodal  lics s)s2ur(mpoo4aleo f3iysfaDran sn()arxrio3oatlp rau ols0tetmxrpio4al   ivsa(  Dtr( p;u4alto ieilt sDuan s u4 rtrxo tadop  li o (0srxrxopoo4ole mieilsfaDumxrpnt0aex ifeiasfa eluvp ()aexrxr3oodfptrlivs ()seuoio3ny1ap   fvt (farrm( ooo0tltoifciys mDemuvo (4teeoiocia1fpD lnei;s0s2xrio3no4ape  ivtl( aDrm(m ;u4oltomo3iadfa ulu pnu)treoxr3oytfmDelneil(  exrim3oodap nlfes tf 2tau ono4olt ii3tydlaDrauvs u0 lerxr3iytfpt aiei t0seto(o oy1al   fet t)srrrxrp;u0tltnio3iytfa elu o u4artnmo oy1op rlivo t)s2tmxr iy1amt  fet sf rtaurpou4opeo i3ildfm2uauvp () etomr3iatlat lneol(0tetoir3io4lleelnvt (  Dtaum oo4tet ifciys s ulnvo t0arenxr3oa1lmD  ueol()t2xoxo iu1apenmietls srra( p;t1tptn feiadlaDeln p;(0tlxoxo3oydfm   uvs () 2tmxrpou4apt lfct s arta( poo4olx ii3iytlaDemnvo (0arxriocoo1omt  uvo t)t2trio no1alt mictlsfsruaurp;t1oeeo oetlsfs emuvs u0alxrmf3ta1om  lieo;t0srxo(m oo1lpt lneia( srtrum no0olxomfctasfs2el( s u) leomrcoytla r nes;( srxrxo3no1aptemiei tf Drmxm oo0aexnmi3iyslaDuau pnu)trtnif oytoa rli sls) rxoio3nydalee ictls  2truro;u0oetomf3tyd m2elnmp (4trermfcoydoptelnvils0 etmio3ny4lle  fcsasfaDurxmont1olxoioeiatlmDrauvs t4 reoif3oo1oat lnvs;( sruoimpoydlltnmfviat  2tm(m nt4oee mfetldfs2ra( p;(4 reoif ia1omt lneil()tetoiopiodoleelivi s) Durx p;t4oltoioctldls rlu p;u4 rtoxo3iy1fpD au o;(  2trxopnudaltnlnetltfa2rr(moou4oex mictltlm2emnvs ()artrircoy1fpD lnvs (  rxrxr3oydlpt mnetlt srumx ono4aptniictltfs2rlnvp () ltnmf iytfateln o (0trxoxo3iudlptn ncs t  rra( ont0apt iictydls rm( o;()tltnxo3ootfm raiei;s) 2tm(r3iu1altn fvt sfarrrxr ot4aex mo3iyslm2eau p;(0treoio ta1la   nvi ( trxo(m3iodale lncsa(f Dumxr ou4aexnii3iadfs2eau o;u) exoxf3oydlpDe uvi;s0 exmxo no4llenmfvsa(faDrru poo0opxn f3iatfmDea(ms t4arermf3iydfp eai sl( t2trxo3io4lptnmivil( srtrump;t1tpxnif3tldfsDem(vo () rtrmociodoaD au o ()teuo(m io4llt mncsas  Dta( p;o1teeomf3iadlm2um(vonu0tetrif3tatla eaneo s0trtoxm nu1lpte fct s) rrauront1ale miciyslm rln on()tlxomf oytopDeanvols  etoxo3ny1openlicsls aDra(monu4oex  fcilslmDemnmon(0 rxrxf ty1oatr i sl()t2tr(m nydlm   ncil( sDtrxmont0olt  fctlsls2ulnvsnt)tlxoiocoo1omDe ivil()teto(m nudoleemnctat  Dtru ooo1aexnmo3tlslaDean p;u0tetrmf3iadopDraiesl()truoim oydlme lfvtas)sDtmum ;o4oetniieils mDelnms u4 exnmo3iadopDrau s t)srxmimpiy4altnlfvi s arumxmp;u0apt mf3tadfa eln p;t0 eenxrctatfp eai s;(0 rxoim3oodap  lnvils  Dtmum ;t4ope mociydfaDra(vp;(0 rxrmf iatlmtrlueo () eur(rpnu4ap  mfes s) Durxm no4tlenifciad s ul(mpnu0aetoxrcoydoa   uvslt) rtmxm ou4opte ics s)s2urx pou4tptnmocild aDulumo;t0 renxf oatlaDeaues s0s2toir3iudale mfvi (fsDua(  ;u4oetomfciadlsDrln o;t)aeermfciotfa  anvi ()srxrxo oydapenliesl()aDuaurp;o4aex if3iasla2eanvpnt4trerxf3oytlatrlu o;()texmim3nydlpt liviat a2uaxmo;u4aetomfciat s ul(mo ()texrmr iytfp eauvo ( tetmio oy1amenmiei (fs2rmxmpno1ape  fciltla2rm(mo t4aexrio3iodfate nvs s  rurxm3no1lp nlfcsls)aDum(mpnt4tex ioeiyslsDrl(vpnt)teeoir to1lmDranvs (0trtrxr iy4ll  lfvtas arumxmpoo0opt ioeildlm el(vo;(4alxomr3iotfmDeaies;s0 rtoimpnydopt miesa( sDra(rpnt4tptniociadfm2el( p;t4trxnirciodfmD  nvs;t t2urir3iu4lmtemnesas sDtmu ont4texniicildla uaumo;u0tetnxf iatlaDeaivi s0 rtoio io1op emictl()sDurxr ot0aet  f3iyt mDulnmsnt4treniocta1fpD  nvs (0 exoiopno4lpt  fesl()aDtaxmpno1aeenmo3tltla el(vp t0 exrio todlmDr n ils  rurimpou4amtn nctls a2rr(rpnt1optnmf3iltfs2em( pnt) ltrmo3iydfmt lueol( sexr(o no4ame mfcs tfaDumxmp;t1opx  iciasla2ua( s;(4altrxrcio1latrauesls  exo(m3ny1am n nviatfarrrxmo;o0tpx iictytfsDel(mo u0teermoctatopteauvs;t0t2tmirpoydapte fcsatfaDrm(rpnu0oet mo3iytfmDem( o t0altrmf3oatla e i s;s)t2uoxo iu4ome mici sf Dtmum nt4tex  ictatfa ean o;t4texrmfciy1fa r u slt0setr(o3oodlltnmnei (  Dtmxro;o0tptnioeiat mDeln p;()tlxrioctadfmte uvo;s srurxo oo1lm nmneia(fs2ur(m ou1tlx iiciydfm umumpnu0altomrciytlaDe ivolt) rxo(opny1olenmfvtat aDrmur nt0altnmi3tldlm eluvs u) exoifcto1lpt auvi t t2um(mpoudalen fcs tf Drrxrpot1tlx mf3iys s rmn snt0alxnxrcoytlate neo ( srumiopny1lltemnvs tfsrum( oot4alt mfctlsfmDrmums u0artrxo3iy1fp rlneslt srtrio iodom elfctas)aDumx o;u4aeen oeiatfm rau p;u0trxnxr to1lm ranesl()t2toio oudam elnesltf ruax  oo0oee mieiydfa rlu s;(4 etnxfcoydlatr n s;t0s2xo(m iydlmte fesl()arta(rpoo4aeeo oeiyd s rmnvsnu)altnmr3oa1latrlivo;s  2urxmpoudlp e fviat  2tru  ou1aet iieild m rln s t)tlerio iy1omtrliei;s) 2xmxm oo1lmtemivi tfsrrmxmpoo4opt mfeiysls umuvpn(4trxnmo to1opDrlivslt trto(r nodape  ictltfaDtrxrono4apt iieiatfa2um(msn(4trtrmf3oadoaD  nes;s)teumirpiy4lmtnmiciat sDum(r ot0tlx mi3tldls rm( s u4artnxfcoytlm e nes;() 2toimpoodomenmnctas sDtm(ro;o4aet miciltfs umu p ()arenirciadomD li ol()s2tr(m ou1ap e icsasfsrumumono0tptn oeildfm rl( s u)alxoxociotfaDr n i () rto(o ou1optnmnci t)s2tm(mpou0aetn fctadfa2ea( s u4 exrmrcootla   uei s0 2tr(m nu1openlfciat) rumxrooo1alxo iciyt a rlnvsn(4aetomf tytlp e i s;t0 2xmxmpou4op e neslt a2taur nt0tpen oetatfa rln sn() ltnmociadfpt  nvs (0seumxr3nodom  lnciltfaDumx  oo0tle  feiys aDemn s t)trxoioctatfmDeau i;s t2tr(m3nydole  nvi t)sDua(rp;o4opxn ieiys aDran s (4 lenmo tydoatelu o s)srtmirpnudapeelict ()s2ua( p;u0aee iictasfsDrlnvsnu)tlerxoctodop   i i;s)t2xrimpnodol nlnesas  rumumpno0ape mfctlt a2uanvo;()aeerxrciodoatranes;( tetoim oy4lltelfvt tf 2tr(monu4tlxoioeiyd s el( p;t) reomoctydfaD  u o t)s2xm(o3oo4amenlnviat  rtaumo;o4tlxnmfciyslsDuluvs u)alenir oa1omDelueo (0setoim3iy4altn fetas artaurpoo4olx micildlaDeaump (0arxnmfcoodfaDrlu s;t)s2uoimpoo4ll nmfeia(f rrr(r no4alxnifctlsfm umu p t)trenircootoptrauvs;( s2uoim nu1olt livs s) Drr(rooo0aex  fciadfa2emuvs t)tleoxocoydlmte n i;(0 etmxo ny1lptnlfcsasfsrua(  ;t1open ociatfs umu onu4tlermrciatlpteau ils trtrxopoo4lmee feiat)s2tmumont0aetoiietat mDrmnvp;t4tetnifcto1omD anvols)srur(o ny4alee fvia() Dra(r oo1tex mfetltlsDra(vp;(4tlermr3iatfmtraies t trum(r3iu1lp   ncsltfs2tr( p;t4tltn fctydfm rmn o;(4alenmr oydlp   nes s0s2uoxrpoydaptn ncilsf rra( pnt0oetoii3iytlaDumnmsnu0trxoxrciatom e u s s) exrir oy4op elfeiasfs2tmxmpno1oetoiictytfsDrlnms;(0 ltoir to1lptr ies;t0 euo(o iy1ap nmnvi ()a2rru p;o1tpen o3iydfsDemu o (4tltnmrciydfaDraneo;(0trxmiopnudlltn iesa(faDtrxm ;t1openioctydfa rmuvonu) exnmrcto1fa rlueo;(0 exmim iu1llte ivt ( a2ra(rooo1opt mfcias a2rau on(4 rermr3oydlaDr nvi;t t2xrim3nu4oleemnvil() rtrxr ;u0olenmo3tlsfm2uaumo;u) exrxr oo1lpDrli i;()sexrir3iudlpeelnes ( a2rr(m ou1tetnifciltlsDrlnms t) reoircio1fm eanei ()truoxr3nu1omt  ivtasfa2urumpoo1tpxnif3iys mDeln ont4trtrxo3tytfmtranes t0t2trir nodaleelneil()arrrum ou1tlxoifciydlm eaums;(0areoif iodfmDran slt0tetrxo3iu4op nmfviat arurxro;t0ape  fctasfa2eanmont)aeenxf3oytoaD  nvi;s teuoio3io4opt  fvtas  2urxmooo1tpeomietydfa rmnvp;u)tltoio oadfpt  u i t0srxoxo no4omenlfetas)a2ur(mpou4olt mociltfa rm( p;() lenif3oodlmtean i (  rtmxmpiu1op  mici ()sruaxrp;u0oexn iciyt aDrmuvsn(0teerxf tydoa e nei ()sruoxo nodoleelnvs tf rtrump;u0olxnmietaslsDeau on(4alxomf todfmtr uesl(  2xr(m iu4lme  icsa( s2rrxmp;t1aet if3iadfm2uanvp (0tlxrmocoatlp r nes;t) 2xo(rpoodlpt lfvsatfsDrr(  oo4teenmoeiltlm2uauvo;t0tetnmr iotfaDelies;s0t2urxmpiydamt  ict s  rtr(mpou1tlto o3iad mDrau o u0artrio3iydlat  neo;s0t2uoim oo4lm  mfvtltfsDtax onu0apt mo3iasfaDra(ms;t)trtomo3ty1fa r uvo;s) etrxo3ny4lptelfvt ()s2rrumo;u4aptniociasfa uaums;() leoif iy1fp r u slt0s2xmirpiydome  ics ( arraxm ot1apt  oeiytlsDulnmpnt0 etnxo3ty1oa  lies;( srtrxrpoy4oleemnvtas)srua(rpnu1tlenif3tyslsDelu on() rtrmo3oytfm  lnes ()setmirpio1ll e ietl() rtmu  nt4openii3tyt a uaumon(4aetnirctydoaDraueo ( setmirpou4al nmfctls a2rmumpno4oltoioetltfs rmums;u4trxrircoytfatranes t)t2uoir3no4ol   ivsatfaDumum ;u1tptoioetltfsDrl(mon()aetrxo3oadlaDe ivs;s0 2um(o oodlm nlivslt) 2tmx ooo0apxo feiytla2elnmo;(4 ltrmf oatfm rlnes s  2tr(mpny1lptelfeiat  2ur(rpoo1apx  fetysfs2em( pnu0arxrxr io1omDelivols0t2uo(mpno4ap  mfet tfa2tax p;o4aeen ietatfsDuauvp;u4trermo3oydlpD lu s s0t2urio3iodlmenlfesa(f 2umurp;t0oeen i3ils a2umnvo;t0arermf3oytlmD lu ilt srxr(mpiu1ale  feilt  2ur(  ;t1alxoiicildls uaumsnu4texnmoctytom  an s t) rxo(r3ou1aptnmfeias) rum(  oo0teenmoeilsfm2eauvs (0trxnmo tydlmtr uesls0 rurir3io1ap  mnes sf ruax  oo0opt  feiyslm2umumon(0 lerirctotlm  anvil() rtm(m ou1apt mivsl(  Dur(moot4aetoifeilsfa2rmu s;u)artnxrctodlmtrlnes;s0s2um(o oy1lmt  neslsfsrrmu  oo4ope mietydfsDemnvp;u)artoio tatfatrai o t srum(m no1ame  icsat  rrm(  ou4alxnii3ilslm2ulu p (0teeomr3tytomD an ils0s2xo(rpoy1ope  fcs s s2rm(  ou4oetomfeildfaDrlump (4texnmf oy1lmDe ies t0srumxr3oo1lp   fcia()arrr(mp;t0oleomfctltlsDra(msnu)artoxfcoatlmtraivo s) rum(opoy4ome  ieilt  rua(  nu0apt mfciltlm el(mpn(4trxrxo iatopt luvo;( trtrxmpoudlmtemnctas)s2tmxm ;t0aeenmoctas sDrmnmp;u0alenmociy1faDeaieo;(0 eumxmpiy1ole lfctas)aDraumpot1tpx moctytla2ulump;t)tltomfciodfptrlneilt0t2xoxmpnu1altemies t a2ta( pno1tex mfciatfs ra(msnt4 renmr io1latranvolt  exrxo ou1lpeemncs () 2ta(r ou0tptnmf3ias m em(vsnu0trtnio iadoaDrliei ( teumxo iu1al emfvsls artax  no4altn f3iyd sDrm( pnu)arxnio oytlp ranesl( t2xrxopoudapeemict () 2trumooo0oetnifeiat sDrauvo t
\ No newline at end of file
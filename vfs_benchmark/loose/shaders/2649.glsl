@@ -0,0 +1 @@
+ieo ( trto(o iydamtemivi t  2rrum nt1tlt mo3iadla ran o u4altoif3ta1om   uei;(0seurxm3oo4ll  mfviltfartr(rono0texo f3iad m rl( snt)tltrxfcio1latr ieo t  2uoxr iu1omt mnvta()artm( p;u1oeeomiciys mDraumo (4 renxrcoodoaDr nvi s) rurxopoo4alenlici s)a2tr(ront0aptn f3ilsfm2rln p () lxrir iotfm eai ol()s2urio oo1lptnlfvslt) rum( p;u4apeo ieilsfm2el( snt4 ltoxfcia1oatean il(0sexoio iudope  ivia( s2raxr ;o4aeeoiociat mDra(msnu0aetnmo3ty1fm raieo ()trxoxrpou4ll n iei sfa2rm(mont0tltnmo3iltlsDea( s;t)tltnxr iotoate u sl()t2trio3oydope lfvs () 2trur nu4olx mf3iadls2rlnvon() eenxr3oo1fmDrluvo s) rurir oydapenmfct s srtm(mo;u4tpeo octat m ea( p;u0trxrmrciotfmtrluvo;s)s2to(m no1op nmnvi ( aDrmx  nt1alxnioeiad sDum( s;t) eerir iodlpD ai o;s texr(o3oo4al emivi ( arururoot4ape ii3iytla2elu o;u4tltnif3to1fa   ivi t  2xmir3oy1omeelivt sfartm(moou4teenifciysfm ul(vs t4alxoifciodoat auvo t0trtrxo nydol elnei ()srtr(m ou4oexomictldlm rauvs;(4tlenxo to1fat aivo;()s2xmirpiudop nlivsltf rur(mpoo4teeomfeiydfaDrlnvsnt0alxrxo3oydopD ln ol(0tetoxo ou1omenmfvtas)artmu o;t0olt  ietat m2emnmsnu) exomr3tydop  aneo;(0t2trir3iy4al  mfvt t  rra(rpno4aexomicilslsDumuvsnu) etrmfcto1la  livols0sexoimpnudlmt mfvsat  2trx pou1oex mfcildfsDua(vonu4arxoxo3oytfpDranei () rtm(opio1lptnlncsat)s2uax o;t4oexomfctyt aDul( p;t) renir3iotla rauei t t2xoxmpoy1lpeemfcsltfaDrmurpoo4oet mo3iadfa rlnms;t0arenxfcio1lat auvo;t0 2xm(m ou1amtnlivias)a2rrxm ou0aee mi3iasls2elu s;(4 rtrircoydfa e nes ()s2trim3nu4omtemnvsas)arta(r oo1apt mo3ias m2rluvp t4tltriocoa1omtrai i;t0srtrxo oo4op elicsltfsrua(  nu4opeomf3tyd m emuvpnu) rxrmrcoytlp elu i;s0tetm(o io4amenmnesa()aDuaxroot1apxoiictyd s2rm(vsnu4trtrmocoo1la e uei;( s2trir iudale mivt t  rtru pno1apxnmieiasfa umnvs t) rxnmr3iydlptrln o;t) eurio3nudlm emietl(  Dra(  nt4tpxoiictydla2eanvonu)alerif oatopD auesl(0tetmir3ny4ap nlicsltf 2rrur no1tlx mocildlm eau s;u4arerxf3oodomt  i ol(  exmirpnodaleemivs s sDua(rp;t4tetn oeiad sDrmnmont0 rxrxo3iadomD aueo;s  rxmim3oudoltemfct s)a2rm(  nt0aetnmf3tltlm2rln p;u) reomrciotlpte ivils0srtmirpiydom emies t)arumur ;t4olx io3ilsfa raumont) rxrmrcoydfmt liei t t2xmim3iydapt  ietat)aDrauro;o0tpxnmietyd s2um(mo t4teerifciatomDeaieo t tetm(rpiu1amen fctas s2tmx p;t0tltnifetyslmDeanvpnt4tltoxocoodfm eluei t t2xoio3oy1opeelnvt s) Dtr(rooo4aetoio3iltfmDranmp u4tltomo3tatoaDeli s s trtm(r io1opt lfvtas  Dtm(ro;t0apxoioetyd aDumums;()teeomo tatopt aieilt0s2xrxm3iudlmt lietasfs2uru pnt4aeeomo3tat m rl(mon(0treoif oa1fm e uei t) 2triopiudalenlnviat s2tm(mooo4tex io3iltfsDuanvo t)altrxfcoodfaDeaues;s0t2urirpio1am e neiatfa2trur nt4tlx  i3ilt m2emn p;u0 rtrmr iadlaD lnvo t texoxmpny4amt  ictatf Drr(r ;o1texnifeild m2emnvp t0 reomr3iodfaDeaueo ( srtrxrpoydop   ncia() 2ur(rpnt0aex  ieiadfsDeln p t4 eermr ty1lptrauei;s0s2trio ny1ll n fviltfaDtrumoot4alxomo3iys sDul(mp;()trxnif oo1op eln slt0t2um(opoo4alenmfvia()a2uax pnt1oexn i3tasla ua(mp;u)tetoirciatfp  anvo t texrim iodamte netltf rra(r nu0tpxomo3iad a umu p u)tlxnmo iotoa e i s t0 2xr(o3no1apte fvsa(fa2urxr nt0oetoii3iysfs2el(von(0alxomf iadoaDeauvs;(  2um(opno1ll n fvt t s2tmxrooo4tpt moetysfa rau p;(4trxnmr3oa1late i i () eurir nudamenliesas) rumurpno1altn iciltlm rlnmp;(0aetoxrctytfate neo;()tetrxo3oydllenmfcias s2tmxm oo4oeen f3iysfm2emnvs (4trxnifcty1faD ai s;s) rurxm3nydom n ncilt)arum(r ot0teto oeiasfm uanvpnt4 reoioctatfa  lu s;(0t2umxo nodop e nvi s a2ta(r nt1opx if3iatlm2ra( o;(4arxoxr ia1lm rluvo;t0tetoir3ny1apen nvi t sDra(mo;t0tltn fctadla rmnmo;(0 eeoir3tadlatelu s t  rur(mpny4lm  mncsl()aDtr(roou1alen fetysfsDemn s u)artrif3oatla r nes;(  eum(o3nu1optemivsa(fsrrrx o;t4apxo o3tydfm2ul(ms u0 etomrciadlp  an s;s) etoirpno1lme mfes () Drrxrpnt0oltniietatls2ulu ont4tltnxrcta1lpt lues s0srto(o iy4lme mnvil() 2rrum oo4olx mf3iat s um(mo;(4 exrio3oa1oatean o;t)s2uoiopoudolt  fvtas s2ta(m nu1oexnii3tysla um(von(4tlxrxr to1optrlueslt) 2tm(rpou4olen fei t)aDuaum ou4tetoioeiltfa2ua( o t0tltomf3iodfaDr iei;s  exr(mpno1am elivilt)sDrruront1olxn f3iasfa2ranvo t4teeoifctytfpt  ivs t  etr(o oo4ole lnvs sf 2ur(m ;t0alx iictltfsDra( p;u0 etrmocoodom eai sls)texrxr io1lm   feil(fsrtaumono4oee mo3iaslaDra(ms (4 ltoxr3oa1latean i;s  exr(rpno1om emfctlt s2rr(r no1aee mociaslsDulnvpnt) ltnxo3tydoaDeli o (0 2ur(r ny4ape mivils  Dtm(monu4texoif3iyd a rluvp;() lxnxociatfpDrai ilt s2trxrpoy4lpenmnvilt  Dtm(mo;t0optomiciad m el( pnu)aeeoxr tydoatrlu ol( truoxm3ny4ome miviat)aDra(r nt1teen oeiyd aDuau p t0texrif3iodoa raneil(0 rxoxopnodol nmfvtat) 2urx oot0opxomi3iatlm umnmsnt0teeomf3to1fpDrlivo s)tetoxm3oodamt  ncs ()sDur(ront0tptomfeiytfm2elnmonu4aexnxr tytoatelueol()s2uoxr3oydopenmicsas  2taumpot1apen ictlslaDeln p;t4trxoircoytlat  neols0 2xo(r3oo1altnmncs t srraxmoot4oee ii3iaslsDuau pn() ltomo3ta1opDeanvi;s) euoiopno1am nmivtasfsDtmumpou4aet  octytfa2ea( p;t) lxrxfctytoat lneo t sexoxr nu1am   nvilt srua( pnt1apto o3tatlm2el( p;(4 etrmr3oytfpteliei;s s2ur(mpoydlmtnlfesas  rtmxr nt0apto ietltfmDuauvp u)arerxocoytomt  n s;t t2uoxm3iu1lm nmfetat  ruau pot4teto o3tlslaDrmuvo;u4 rerir oatom e neo ()srxoir3iu4ap  mfct t arraurpoo4ape mictltfsDrl(vo;t4 leoir3to1la eai sls0 2trio3iu1lltemfeia(fsDurum ot4oexoioeiyd m2elumo t4alxomociytfmtrai s s srumir3ny1oltnlivs t)arurx  nu1apxoiocildfm2rln o;u0 eermr to1oa rlivo t seuoxr3oodamtnmfvias)a2rax pnt4aetnmoeiat mDrlnvs;(4 rtoxo to1optrau i t0srurio no1ome  nesat)srra(mont1oleo fciydfs um(vs () exriocoytom  lu ilt)trtmir oudaptelivs t a2umxm ot4oltn i3iltfm eanmp;(4 ltoxo3iatfateaieo t)teurio3iu4lp emietltf rumxm no1aex mictldfm rlumpnu0trxoircoydlmteaneo;()s2xmiopiu1op elieias sDum(ro;o0apxnii3iyslmDem( s;t0aexomrcootop e n s;(  euoir3nu4amenmietas)a2umu  ;u1aleniieildfaDrmnvs;t0 reomfciotla raneo;( texm(m ny1lmtn ivil( sDurumonu1aleoiiciasfsDemnvp;u4 etrif oydlaDe ivi s)t2uo(mpoydlmeemivs () 2rrump;u4apxo ietadfa2ra( pnt)alxnioctydop eluvslt trto(rpny4op n feiltf rurxmoou1tle ii3iysls2ra(vs u0tetnmr3tydfm  au slt) rto(m3iudop nmneils)srrmxront4olxo i3iad m2emump;u0tltrmf3to1oatrlieo s)t2uoimpny1alt mfcsl(fartru  ou4tlt moctatlm2uln p t4treoif3oodop e ieo s s2xm(o oy1lmee ncsat s2ua(m nt4apeniieiltfmDea( s t0 etrxo ta1fptrlieols0 2xr(rpoudlm n ncia(faDumxr no0opt mi3tlslm eaums;(4arermo iytfp eanvi ()sexoim3iy4apee ictls) 2urxrpno4aex  ietysfs2rlnvsnt4tltomocoodlp  anvsl()t2ur(o3iodom  lfeilsfartr(rpou1opxn ocilt a2umums;t0 exnxr3iatoptr uvo t0 etoxrpiu1ameemieiat) 2tmxrp;t4olx  i3tadlsDuln snt0treoioctodfatr ivs s)s2to(rpnodapenlfvi s) Duax  ot4tptniieiad aDelu sn() exnif iatfaDrln sls  exm(m3oy1lmenmivs s s2um(r nt4tlxo fctls mDrlu pnt4tetnxf oatlpteaiesl( seumxo3ny1lm emivt () rururo;u4teto o3iyslm2rl(vonu4 rtoxocia1op elu o;(  2uo(m oy4lltnmnvi ()sDuaumpoo0tpx mfctytlm2rlnmo u4 renmoctytlpteaivol( srxrio no4opt liesa(fsDraurp;o4optoif3ildla ra( on(4tlenio3ty1om r ieo ( sexoxopiu1llt micsatfs2urumpnu0tpxnmf3iad mDumnmont4altnifcia1oaDe n s t0setoxm io4alt  nes s srta(  nu0oleo ociasfmDranvs;(0artoxo3oadfm elivo s)srtrio no1lpte nct s  Duaxmpno1oltnif3iys aDrl( o;u4texnxfctytoateaieolt)t2to(m iu4opte ivt () rtrxroou1apen fciyslaDraumont4 etnxo3oadoaDe i slt0 rurir nudolenlfes s)arumxro;u0ole ifeiysls elnvs u0 etoir3oa1fa  lies ( s2tr(o3io4amenmfvt t) Dur(  no1alxnioctls m um(vs u)tlenmr io1fptr u sls t2xrxm3oodlpeemivi s)arurxmp;o0olenii3iasls uln o () rtnmf ty1lp  au olt0 rtoiopno1am nlfvtl()aDumumoot1aee ii3tltls2ua( p u)aleoifciy1faDrluvo t0seuoxr3ou4apeemiet tfarur(mpot4tltn fetls aDeanmp;(0 eeniociodoa  ln olt tetrir3oo4opt lict sf 2rmx  no0olx mictld a2um(vo;t4 ltrmo totlm rli s;s  2xrxm ny1omen fes () rur( pot0tlxomfetasla2elu pnu)teermociatfmDe ivi;t0sruoio3oo4am emfvtlsfsrrau o;u0aexnii3iytlaDemumonu)arxrxo iytlpD ai s s0 2trxr nodom   nesl(fsrtrur ot4aptnmoetaslm2rlnmo;(4trtrio3oadfmD lnvi;s t2xoxo3io1lmtnmiei t)a2tmumo;t1tlx if3iat sDuau o;u) exoiocty1omD  neils  rxr(opou1lle lnesatf Dtaurpnt4aet micildlm ulums;u)trxrxf tytom r n ols sexoir3io1al e nvia( s2ua( onu4olx  fcils a2elumo;t4 lxoxr todoatraues;t0srtmir3iy1lm elncias) 2uax oou1tet  f3iydls rmumo;t4alerif oodomDeli s t  2urxm no4alt livsa(f Drrur nu4alt iiciyd m rlnmsnu0alerxo tatfp ean s () 2trxmpoy4lmtelicslsfaDurumono1apxomfeiyt m2el(vpnt4altnirctatoa   u o;s)teto(mpiu1lp nmiesa(fs2rrur ot0olxomi3ilsla rl(ms;(4aexnmr to1opD lneol(0t2trim3ny1am elncil() Duau  nu0oeto o3ilt m2rmn pnu4tlxnmr iy1oaD  u sls  etmirpnodal elfciatfa2tr(mp;t4texomociatfmDuanmp u0altrxf to1lm r ivo;t)sexo(mpiydlm emies ( s2rrxrp;o0olt ifetas a umnmpn(4treomf3oytoat  ueol(0 rxoio nudopeelfcsat  2tr(rooo4oeto fetysfm2rl(ms;u4trxrio todoat  i i s0 rum(mpiu1apt mfvs sf 2tmumo;t0tpt  ocias sDel( ont4trxnxocootfp rlneols  2xrxrpoudlpt  ivt t  rra(ronu0tet  ociat m raumpnu4 rtrir tadlatr n i s  exoxr3oy4olt mfet ( aDuaump;t0apeomoeiysfaDeluvs u0arxnifcoodlmD anvi;( srtmxm no4am  lnct t) rrauroot1tltomfeiadlm eaump;u4 exnmociytlatrlivo ()srur(o3oodlleelnesls)aDuauro;t4oeto i3iydfs2ra( on(0 exrxfciy1la rlivs;s sexmir3oodalee ieil(  Drru onu4tpt moetys m2ulu s;t4trenmfcoodop  aieo;()trumir3no1lp elfvi s)a2rmur ou0apxnmi3ilslsDraumpnt0 etrmoctodlatean ol(0sruoir nu4aptnmncslt)artm(moot4oeeomiciasla2ua(msn(4texoxo3oy1opteauvil()sexm(mpoo4am elfct t  ruaum ;o4tex ifciad aDrln o u) etnxf3ia1fp e u i (0srtoxmpnu4lpe lfvias  Dumu pnt0oexomfciydlm2eau p;(0tltrxo ta1laDe uei;t0s2uoir oy1ame  nvils)a2umx ooo1apx  o3iys a elu s;u)altnxr3iodoa r ieo s0t2umxr3ou4lpenlnvsat)aDtmxm oo4alenifctyd aDrmumpn(0 etrmociadopt  nvsls)sruo(m iu1ome mivils sDurxmpot1ape iietldls rl(mp;u)artoif tatfateln sls) 2umxm3nu4ll nlfesls  Dtm(m ot4opxniieias mDeau o;() etomociatla  li sl(0 2tmxm3no1llt mnetl()sDraum ou4aex  fetad a rlu p () rxoir iy1laD lueo ()seur(mpnudolenlneslt) 2rrx o;t1tle iietltlm uan ont0tlerxo oytlpD an o s)trumxr nu4lm e ncsltf rraum no1olxnifetls mDel( ont4alxniociodfm elivs;()trurxo iy1opeemfeiatf rua(mont4oltnifctadfsDumump;t)alenmr3iodlaD  i i ( t2xmio3io1ol n nei ( s2ta(mp;t1aeenioctls s2ra(mpnt0 exrxr oa1lmD aiei ( srtmio3nodomte nei tfsDtau pou4oexniictydfa2ea(mo;(0tlermf ootlp eau s;s) eurxr ny1ll nlneils sDumu  nu1opxnmi3iyt sDuanmo t0texnxf3oa1fmDranvils)tetrxmpny4apt mivsat aDrrur oo1aetnmietyd mDemums;u4alxoirciodlpt anei;t sruo(o3oudom elnct t srtmx oou0alt  oeildls eauvp (4 etoxf ia1oa elueo;s0texoir3nydap nlfvi (fs2tmx ooo4apenioeiytlaDuauvo t0alerif3to1laDr uei s seto(o3ou4lpe mfvil() rrax oou4aptomo3iatfaDrlnmonu0aetrir3iydfa eaues;s)t2xmim3iu4llt  nct t)srum( ooo4aleomiciyd mDeanmp;u0artnxr3to1op eai s;t0 2urxmpoy1am  lietasfaDtrur nu0oex ifcildlm uanvsnt)treoxf3tatfm e ieo;t0 2xrxmpoydllenlfctlt)a2tr(mooo0aleo ietas mDrlnvonu4aexnxoctodfpteaieol(0 eumim ou4lptnlfci t  Duaump;u0oeeo oeilt mDemnvp (4aeenmf iadla  lies;t0seuoirpoo1amt licil(  rumum ;t1tpeo fetydla rmu s (4 rtrmfciy1faDeai s () 2tmxopou1al e ivta(fa2umxro;u0apeo ietydfmDrlu p () etrir3todlate iei;s) rtr(opoydam nlfciatfsDua( o;t4tlenmf3iasfmDulnmo;u0tlxnmfcoo1faD au s;s0 ruoio iydal  mics ()aDtrx ono4ale if3iys m2ulnvon(4tltnir oo1opteai i;s  2tr(mpnu1olt lfvslsf Dra( pno4apeoiietadfa ul(mp;u0 rtrxf3iodfmtr u s s)truo(rpiodamt lnvs sf rurx o;u4opxo o3iydfs2ulnmpn(0 rxoxr3oo1lat auvils sexrxmpno4ol nlncsl(fs2umumoot4teto ieils mDul(ms t4 etomr3iytfa r nvi;t  2toim ny4lme mnvtlt aDtmump;u4ape mf3iasfaDemu onu0 lxoif io1lm rauvi;(0s2trxmpoo1lmtelnvils srtm(mp;t1tet moctatfaDran o ()artnmo3oytfat li o;s) 2triopnodome mnet () rraumooo4tpeo feils a2em(vs (0 rtrmf3io1lpD  n ols srumxmpiudalte icsltfsDtruroot4tpto f3ildla2rlnmo t)tltnmr iadfaDeln s;(  2tr(mpou4oltnmfct sfs2rau o;u4tpxnif3ilslm el( onu4artrxociadomDe u i ( trxmxo3oudope lnvi ( a2uaum ;u4tpto ieiasfmDelu p;u0teenmo ia1lmtraneo s0texm(o3ou1llt  nes s arrr(mo;t0tptnio3tadlaDea( o u4teeoio3oydom   n o s0 etoimpiodllt mnetlt) 2urum oo4apt  feilslm2rl( sn()aeenxfciydlateli s;t0teum(o3iu4amen nct t s2tru p;t0aeenmo3iyd m em(ms;t)trxrmociatlm elu s s)setrxr3oy4ame mictatfsrum(mp;u4alt  ieiatfs2rl( sn(0altomrcoy1faD ln o s truoir3ny4op  mnvtas)srurxront4oleo o3iytlm rm( pnt4areomr3oo1fptrlivo (0 rtrimpny1omen nvtl(fs2umx  ;u1apxo fcilt m elu p;t0teerioctytfatranvi (0truoxr ou4olee neil()sDtrx poo4olto i3ildfa eluvp;()tlxoifctatfaDeau s;s0setmirpnydape mfcilt)sruaxm oo4ape mf3ils a2rmnmon(4tlxoxr3oo1omt  ieols)t2xm(o iu1lm   nciatfa2ra( oou1tlen i3iyd mDrlu s () rtrxr iytfpD  uvs t0trxoxmpoodolt lnes s  Drrum no1tpxn fciasla2rm(vo;t0altnifcoy1fmtraieolt t2xr(r3ou4ap nlivtlt)sDtauroot0tlt mociyd aDemn ont0arerif tatopDran o t)t2xm(m3iudopenmicsa( s2rmurono1aeenmo3iltfmDeauvo t0aexoir tytfaD  i s ()s2urxmpoydome  fetls sDtmxmonu1aeto oeiasls2ean o;t0 rxomo iotlpt  n slt0 euoir nydamtelivil(fsruax ont4ole  oeiatls umnmp;u4trerxrcoytfmt au s;t) 2uoir iu1apte fvt (  Dta(rpot4opx mi3iysfs eaump t)texrmfcoydop rlueo s) eumiopio4olte iesl(fs2rau ont0aetomoctlsfs ea( s;u4trtoif3iodoat au ols0t2urio no4al  mfvt tf rumump;t1aeen icilt s2eau on(0aeenio3ty1fp eanvi (  exm(r3oodlpt lnvs s)s2tm(monu4aexomfcild m um(vonu4tltrxocoatfaDelivslt0sruo(rpio1om nlicslt)a2uaxr ou0alen ictld mDra(monu4tlerxr tatfmtrlu o () rxmxr3ny4lltelivtatfa2rmxr ;u0olt  ieild sDulumo t)texomr3tydfpDrlivsl( srxr(r oodamt lics ( s2ta(mont4opeo f3iad aDuanmpn() exrmr3oo1lat  iei;( teurxo3ny1ol   fciat) rrmumo;t1alt io3iysfmDeluvs;t0trxniocoodfaDrlieolt) rxrxr3ny4lmee ics t)arrr(rp;u0tptnmoeiatfmDeanvp;t0aexoxrcta1laDeli o;s sexrxrpnudope  nct tf Duaxmo;u1tet mf3iatfsDemu s;t4 lerxf3oydoatrlivo ( t2tm(o3iu1lmte feta(  Dtaxront0oltnmi3ilt s elnmo;u0arenmr3to1lpD  i olt0t2to(r ny4olen nct (fartmxmo;u1tet  f3iaslmDua(vs;u4artnxociydlp rau o;s) 2toim nodomt  ivi t  rtmu  oo4opx if3iyd aDeanvo t0alxrif3oa1laDrli s;(  etmimpio4apeemieilt  Dtr(rpoo4oltnifciad aDrauvo;(0aetrmr ta1fm   ueo;t0 etoio3io1op elivias) ruax  ;u1oetn oeilsfa2ulnvo t)arxnmo3iydfptrauvi;t0 2um(o io4ol  lnvt (f Duax poo4alxnmfctyslm ua( snu0 lermrctadfmDelivols)trxrirpiy4am  lneiasfa2umurpnu1tleo ieiydlsDuau onu)artnmo tytfm  lu s ()teto(r3iu4am e feil(farumumpno4ale  o3ils m2emn o;u)aexoir3oy1lpDeauvolt  2xmxmpno4ope  feilt)artrur ;t1oee mfciat a uauvo t0arxrir3iy1lm r uvolt seum(mpoudlpe lneias aDumur nu4oetnmi3tadfs rmuvp;t)altrmo3oadla e ivi;(  exrxopou1olt  fctl()srur(mpot0oeto ieiltfaDrmuvs t)tltrxfctotfmtrlivolt)s2tm(r3io1opte fes tf Dtm( o;o4oetn ieiltlm rlnmon()tetniocta1oaDelieo s0 rxoxm3nudll  mieiatf 2ur(  ;u0olt io3iytfmDelu p t)altrmf ty1lmD anei ( seuoxo no4lptnlneiat)artax  ou1alxoifeilsfmDel(mont4trxnif3iotlp rliei s0 etrirpoydalt lnci (f Dtru oou4aptoiocils sDul(vp;u0 lenif3tadfaD aivs;()t2uo(m iodop nmfci s)aDrmur no1tptomietys sDuluvp;u0 etoifctytfp rlu s (0 2uoxrpoy4al nmnei ()sDra(m ou0apeoiiciytlm2eanvo;u) exrxrcoatlmte nvi;(  rxr(rpnydlptemfvs t)sDrm( o;t0olt mfeilslsDelumon(4 rermr iydfm  li il()t2tmiopoodapenmiviat)a2urxmp;o0aptn fcilsfaDeluvo u0 eeoxr iytopteai o;(0 ruo(o nu1lm eliesat s2rrxmpnt4ape ii3ils s2emu onu4arxomr tytlaD  uvi;s0trto(o iy1amt miei s a2ta( p;u4tleo f3ias a2rmumsnt4trxrif3iodfmt li s;() rtoimpoudal   iet t)a2urumoot0oee moeiat m umn p u)tltrmo3iatoa rauvo;t  exoir oo4alenlfci (farum(m nu1tlxn ocias sDelnvsn(4 lxrxo3iy1latelueo;s0srtrir3oy4al  mfet s) Drrx  ;o4tpxnifciadfmDulu p;t)teerxf iotfm e i ols texrxm oydale lfcil() 2um(m ot4optn feild s2ulnvsnt4arxnmrcio1lmDe uvol(0teumir3nu1om emfct (  Dtaumont4tle  i3tlt s umuvo;()tetnif3io1op r ivi t  rumxrpnudlpte iviatfsDrmxm ot4tpen octysfm2rluvs () reoxf3iodfpDelivs s) rxoio3oodlmtelfesl( arra(m ou4ole ifciatfs2ul(vo;t)aeenio3totom r ivils0 rxrxo3nu4lp  lnvi tfsDuax o;t0tpto f3iasfaDeanvo;u)alxnmfciotomD lieo;(0tetrxopoo1apte fci tfsrtr(r oo1apt ifetldlm2ua(vs (0alxomf3oa1fa   n il( teuo(m3ou4aptn fvtlt s2rmumono0apxoio3iyt sDeluvp (0 exrmo oadfp   ues (0 etrxo3no1omeemietlt)a2uax oot0opeomfetad mDelu pnu0teenircootlat ai s ( trxrxrpnu1ap e fesl()srrmxr ;u1olx mietyd sDea( s;t4 lxnmrctydoaD  nvol()srtr(r3iu4ll  lfvia( aDrrxmp;t4alxnifetatls uluvpnu)altomo3oytlm  luvi ()sexr(o3oodaptnlieslsfaDtm(m nu0aee  fctlt mDel( p u0areoif3ty1lpt  ueilt)trur(o nodamt miei t  rumxm oo1teeo ieilt mDul( p u4aleoxo io1lp ranvs s)seuo(o nudlmte netls)artm(m ;o0tetnmicilt m rmuvp t4 exoif3oadoa r u o t0sexrxm nodop   ictatf rur(ro;u0aexomictld a2ulums;u) eeoif3oydopDeli s;s) 2toxr iy1openlfvslt  rraur ;t0tlt mfcildlaDemu s;(0aetnir iydom eluvi t  eurim oydopeemnes s srurumoou4aexnioctlsfa2ul( ont0 rxnxr3oo1la eli o;s0srurir nydlme  fci (faDumxr nu0oex  fciatfa rmu s (0 reoio oytfmt  neo s0tetmir3iy1apt  ieiat)a2tm(r ;t0apx mo3iadls rlu s t4trxomocto1lp  lu i ()trxrxr3oodop  lnvil( sDtmur ou0opt mfciydfm rmuvs t)treoxo iydlpt  n sl()srurirpoy4lpte fvt tf Durx  ;o1apx  i3tadlaDul( s;u) reoxf oytlpDran i ( s2ur(rpny1olenmivs t a2uau pno0oetnmieiltlaDrlnmo t4 leoxf iytlm  anvo (0trto(o3oodolt lfes s)arumxmooo4tlt  f3iydls2el( s (0tlxnircty1lpD auvi;(0texmxr nydalt mnvil(f 2urum ;o0ole mieilsfsDrlnmsnt0artomr3iadfmDelivi t0 exr(o3oo4al emneiat sDum(r nt4apeo octlt s ulu p;() renif3ootoaDean slt)texrxo3oy4ope  ncilt arrax ono0aptnmfctltla umnmp;t4 ltoxr3iodfptrlnes s) etm(r3iodomee ncsl(fsDumxmono0oee iictltlsDrln s t0altomo iotom rluvs s0t2tmir3oy1om   ncslsfarua(  no4tptnmi3ilsfaDumn p;(0tlxrxrcoadom   ivi (0 rtoxm3nydaptelfeil(  Dumxrp;o4aeto i3iatfmDemu o;t)texrmf io1omDe n i s  rurxrpio1opt mivtl(  rtr(rpou0oltniiciadfmDrmn p;u0tlxoxfciytfmDeanvi ()t2um(mpnodlmt livsas)sDuaxr no1alx  o3tlsls2umums;(0 exrif todlmteai i;t)srurxr3oy1ape lnctat) Dtmxro;u0teenmf3tydls ea( pnt4texomr tytlptr n ilt) etr(o ny4lmt  ncsa(f 2taumooo0tlx  o3iat a ea(msnu4 lenio ootfm rli ol(0 eto(o3nudam elnei s  2urumpnt1aee mietas a2emn o;t) rxoxr3ootopte uei;s t2tm(m oudaptnmnctat sDra(mp;u0tpenmieiyd m rlnms;u0 ltnif iodopD an ilt0 rxoxr nu4lle mici s)srta(  ot4oex  fcias mDuaums u4trenmr3to1lp   ies () exrxrpny4op  lfci t  Draxmo;t1tlx mieildfmDrmuvp (4 lxnmo iatlpDr ivol(0 etoxopiudlme lfci sf 2ta(mp;t0oleomi3iadlsDul(vo u4aexrif3tadfa e uvs;(  2uriopiy4lpt  ncsas)s2tmu pnu1aleoioeiat mDeaumon(0 exnxr3iotlp elnei;( srtr(r3nu1om e ici t srtrx  no1oltomfctldlsDumn s () exrxf3iodoaDr i s s sexrxr3io4lmeemivsl()artrx  nt0ale moeiasfm rm(vsnt)tetoio iy1fmDran s;t0srur(mpnodalt lfcsas sDururoot1texn f3iat a ea(mont)trtnxf ty1lmDelivs s  2ur(rpoydllen ncsa(faDrrurpnu0olxn i3iytfaDrl(vs (4 etrio oo1laD lneo;(0s2tm(rpou4amtelnci ()sDraumooo1optnioctlt m eluvo;u4 rerio3iodfm rauvs;s)trtmxopnodlpenmictatfs2urxrp;o0aee iocild s em(mo t4trenmociy1la  livo s)truoxmpnudal  liesltf 2rmxmpno1opxniieiysfmDem(vsnu4tlxnmr3oa1om rliesl( srxmxr3oodal nlieias artax  nu0tlxniociyt mDum(monu) ltoio3iytoat  nei;t)texrir3nu1lleemfes s)a2umu  ot1aeeomiciasfmDumnms (0tlxnircoo1laDraivolt)teumxm no1lle mfcsas)srtauro;t4oexo ieiltfm rmumsn(0arxnxo3iydfaDraies;(0 2xmim io1lmt  fcsl(fsDuaump;t1oexn fctat s2ulu s (0trxomr3oatoaDeaies t0 2tmio nu1ope mnesa()arrmurp;t4oetnifeilt m uanvpnu4trenir tydopD  u s;t sexrio3oy1lpt lfet ()artaur ot1tpe mfctadfs2emnvsn(0artnio3oy1lmDrlivo t s2urxm3no1alenlicsa( a2ta(mp;t4tltnmictadfsDemu sn(4arxrxf3tytfpt  nvo;s)s2tmiopoodlltnmfvt (fsDumum nt1olt if3iytla ranvo (4artrio3oo1oa r uvi t0t2uoxrpnu4lptnmietat)srtm(m no0altoio3iat s2ean ont)aexrirctydfmDeanvo s0trur(r3iydlmtnlivslsfaDurxr ;u0tptomociys a2ul(ms u4treomf3todopDeluesl()texrxo3iy4amtnlnvi s) rtrurp;o1tlenmieilsls ul(msn(4 exrircta1fa   uvi;() exmim3iudlpen fei ()a2um(mp;t0alenii3ildlm rmu snu)areoif iadlp raies s) 2xmirpnu1omtn nvta()aDurxront1aexnifeiltfs rmnmp (4 exnmr3iadomD au o;t)t2xo(rpoo4lpee icilt) rtrumo;u4teenii3iysfmDea(vsnt4aeenifcia1lmt lu ol(0trxoir iydlleemietlt) 2tm(  nt4apenif3iyt a2rmumpn()aeenir3iodlpDrauei s srumiopou1lpe  ncsat)s2ra(rpnu4oex  oeiyd mDrm(vp t4alxrxr3oodlpDraneo s0s2xrir iy1lp emfvi ()artaxrp;o0tpenmoeiys mDuaumsnt0tlenmocia1lp   ieo (0srtrxm io4aptemfvsl(fs2umumoou4texoif3ias sDuaumsnt)tltrirctodoptranvo t0srtr(r3iy1lle lics t s2taurpou4texoif3iysfm ua(vs t4 lxoxf iytfm   i o;t0t2xoim nodapt lnciltf 2tm( pou4aetnio3iasfsDrlumon(4texrif3iatoaDrauvo;s0 2tmir3nu1olen nvtls sDrrxmo;t0tptnmoeiysfs2rmnmp;t0 renif3ta1lp rau s s0 rtrxo3oydamen fct s s2ur(rono0oeeoifcias a ean pnu4arxnxf3ootlpD  neslt)sexo(m iydlpen net sf rrr(ro;o1oetn f3ilt a2umuvp;() rxoxr oytfa eln o;s t2umxo iy1opt  neiltfsrtrxmpnu0opto oeiyslm rau p;t)aetnxo tatla   nvolt s2xmxm io1olenmieils)artm(m ;u1tex  feils aDulu o t0 ltniociotfmtr ieo (  2uo(r oo1lleelivil(  2uaxmoou4opt  o3iasls2rlnmp u0 rtnir iodfmt  u olt texm(opnu4opeelfcia( s2tmxmoot0tltomfciys mDem( p u4arxrxr3iotlp raneo ( trtoxm3oy1ll elfeslsfs2ta(rp;o1tlxnmoeilt a eau on(0aetoxf3iadfptraivi;s s2to(o oo1lptemfvs s)s2taurpou0oex ifeiasfa eau p;u) rermociotlmt  nvs s0s2xrxopno1lpte fvtl(farur(mpoo0aeeoifctadfm2el(vont0 lxrio3oo1fmtr ivo;t t2um(mpnu1omenmnvtas  rraumoou1opxnmf3iltfs2rln p;u)trtnir3iatfmteau ols)trumir3oy1op   fviat srra(  oo0aetniieiys mDrau on(4alxrmo3oodlpD lu o;() 2trxmpny1aptn ncs ()srtaur nt1tlen o3tyt a2rm(vo;(4texoxr oydoa eluvi t0srtr(m3iy1olteliei s)aruaur ;u4tlx mfeildlsDemums;(0 rxomo3io1oaDeanei t)t2ur(mpnodale lfei ()sDtru  ;u4altomf3tlslm2emums;u) rtoxo oadomDeaueo s  rxmxr3ny1lltnmiesl( srrrumpot0aex  feiyd sDelnvo t0trenxociodoaDean s t)srtmxrpou1ope  fcta()s2tmxm nu4ape if3iatlsDrm( pn(4 rerxfcoo1lpt lieslt  etoxo3oy1ol nlncsat)s2rax poo0aptnmociad a rmu pnu0artnxo oydoateliei s0trxr(m3no1lmen fcia()s2tmu  ;u0tleo i3tasfs2eanvo;t)alxrxocoadlateaueo s)setmio nudlm nmivi ( sDta(rp;t0oee mf3ild m2um(mo u4 exrxr oytlat  ivi t0 exmxrpoy1ol nlncsa(f 2rm(rooo4olxo i3iys sDulnvp u0tltnmf3oa1lmteaivi;() etm(rpnodaltnmiesat)a2um( pou4apxoio3ilsla2rluvo t4tleniocoa1lm   nvo ()srur(r3iydamtelfeilt  Dtax oot0olxomoctlt aDrlumsnu0trermf3io1fpt lieils0t2xm(m iydalt lnvtltfa2tau p;u1aptnmieiadfs2umu on(0 rtrmoctodopte ues s)seuoxo3oy4ole lnet ()sDurx pnu0apxn fetadfm emumpnt4 rxnmo oytfaDr ies;s trtoiopiy1amee fviltfsDtm(r nt1apx ifcilsfa rmu onu4aeeoio oadfateliei;t srtm(o3iu4alenlfet s)aDtmxmp;u0teen icild a emnmpnt)aetnxrcoytfpte nvs;s)setoxrpnudapt  iei s)aDraxm ou1tex  ieiasfa2ul(mo;t0alxnxf iadoptraues;s  rtm(mpno4om emncs sfsDrm(m nt0oetnmociys aDelnmp;(0 eermrcoy1oaDraivs t0t2tmxopoo1ale mfvs t)aDurumpou0tltnmoetatlm uau p;u) etnmr io1faDelivo;s) etmxo iudlp   fes t sDuax pnt4alxomfeilsfm rlu p;u4 rerxr3tadlat lues t) exoxr3iy1lp elictlt srtm( o;o4aetn o3ias aDeaums;u0aexomr3ootopt auei t0 etr(rpiy4om elictlt  rtmx o;o4tltn f3tld s2uanvsnt)treoif todfp eaiesl(0 rtrxmpio1lp emfcta()a2tmu p;o1alxoioetad a2ul(msn()arxrxoctytfmDrlnvsl(  rum(rpnodamte feslt)aDum(  nu0oeen o3tldls uau pn(4aexoio totfmDranei s0srumim3nu4opte ietat)arrmxrp;t0opxoifciydfs2eaumsn(4aexnxr3oatoaD ai ols srtoimpou1oltn ics sfs2tau oou4tleoif3iydlm ea(mp ()aeenirciadlpDeli ols0trtriopoodomee nci (f rtr( p;o4tet moctldlm2ean o t4 eermf tydlaDean s;( t2trxr iu4ole mnvtasf Draxmp;t1tpenifciatls2rlu onu0 etrxo iy1faDrlueo t trur(rpoo1lpeemiesasf Dumxmpno1ape moctytfaDra(mp;t4tlxomocootom eaieo ( s2xoxo iu4aptnlfvils aDta(mp;u1aptomocilsfmDemump;(0treoir io1lm e i i s0trxoim3iodlltelnci s)a2rmurp;o4aet ioctlt s ran o t0tlxnmfcootoa rluvol()t2ur(rpou1ol emnetasfaDra(r nu0olxnmiciytlaDra(mp;(4tltoxrcoydlaDr neo;t t2trim3io4al   nesltfa2rmxrpno4apt ii3iat s2um( onu4 eeoio3io1fpt aivols teurir iu4ol nlfcsas arua( pou4apxoioetad m rmnvpnu0aleoifcoodlpD anesls)texo(o iu1lm   iesas)aDurumooo0opx miciltlaDulump t4teerif tytomte uvo s)trtm(m3oo1altnliet ( aDua(  oo4olx mi3ildfs2uaums u0teenio3oo1fp r neil()sexm(m oy1apt  iesat s2rr(  ot4aptnifciyd m ulnmp;u0 etomf ta1lmDe ieolt0 etrxmpiu1llenmneiatfs2umumpnt4alx  f3iat a2umuvp;(4trenxo3oa1la r ies;s)s2xrirpny1ope lfvsa(fsDrr( pou4tle ioeils sDrl( s;(0tltnif oa1oatrlueo;s0texmxm3iydlleemfciatfa2rauronu1tlt iociytlm2ranvo t)texnmo oytfpD ln il()srxrio oy4apt  net s  Dum(rpot1alto f3ilslaDra(mp u) lxrmociotlmD lieol()s2uo(o3oodaptnmietasfsrumx p;t4teeomocils m2uanmo u0 etrxo3tydoptrlnes;t srum(rpnu1om  livi ()s2trurp;t0aexniieiad aDuln s;()tlxnxo3iy1lpt aieils) 2urxopiodal nmncta()s2ra(r ou4tet mfeiys s2uluvp;t4 leoxr tydopD  ivo;()trxoxopou4olt mfvs tfarurx p;t0openmfeilsfs rmu o;()trtrxr3iadopDe i i t)setmxo3oy1ape mnvta(  Dtru pot4ale ifeiysfaDulnmont)trxnxf3iydop eliesl( texm(m3oudomenmfvi sfaDuaxr ;t0tlt mo3iat m2umnvo;t)artnmo iytfpD  ivs t  etmir3oo1lpe livi () Duaur no1tptomoctyd s2rau p u0tetrio iytopD  ivi t) rtmxr oy1llen nci s aDuaxmp;t4tlxn ictadlm em(vp;t4 lxnxo oydomt lu s t0setoio nu1ome  nctasfsrur(  ;t1tleomo3tadlm2ul( pnu4teenxf3todfateai i () 2urxr iudapte iei ()aDtm(rpot1oltoii3iadfsDulums;(0altrmo tadoaD auvo s)t2umimpiu4lle  fvsat  Drm(m ;t4tptn fetat a2rlnvp;u0 rtnxfctydfpDr ueils)srxoio io1alt  ieiltfa2umxmo;o1apxnmf3iyt m ranms ()artrmf iy1om elu o;t)t2xoiopno4olt mnvias) Dumumpnu1tpxoifciydlm em(vo;t4 rxrmocto1laD an sls)t2xo(rpoudope lnetls) 2umxr ;o1tpe if3ildfmDea(ms;u4artrmr oa1oaDeanes;t s2xrio3nodape mfetl()s2tm(mpou1optn ietlslsDuanms;t4altoir3tadomDeli i;s)s2umiopnodoltemncia( aDur(rono1tet iiciydlm2ul(von() etriocootom   iei;s0srtrxr3io1lp nmiei s)a2umu  oo0apxniiciytlsDumums;()tltnif iytlmDeau s;()trtrir3iudolen fcil(f 2ra( pou1aexn i3iasfs2ulnms t0 leoirciytlatelnes s0t2tr(opno4ameelict (f rtr(ro;t4tptn ociyt m umumo;t0texnxocootoa e i s;(0s2um(r3nu1lmte neilt)aDtm(r oo0tlx mfeilsfm2umu p t)alxoxr3io1fpDeln ils)trxm(o3nu1lp  lfvt s)artrxroou0oeeoio3tyslaDumnmsn(4arenmrctytop eluvi s t2uo(opou4apenmicta( sDur(m ou0tpt io3ildla2rln pnu4alenxr3to1fpt lnes s  2to(r3iu4apt lncs (fsrrrxmp;o4alxn oeiydfaDrlnvs t)tltomr3iy1fmtranes;t) eurio oo4ap   icsa(fs2rmuroou4opxomfeiadfs rl( pn()trenifctodopDeauei;s  rurio oodlmeelnvt sfsrra(r no1aetomfetas a2ua(vpnu) leoio oadfm elivilt0 rtr(mpio4oltn fcsl()s2trxr nu1oleoiocild mDemumonu) reoir3iatopDelu i t)sexr(m3ny1altnlfeiltfsDrmurp;o4aptn ociltfs2uau p;t)tlenirctodfateai i;t0srxrim nydll  lnctls aDuau  no1tleoio3iadls ean p u) leriociotoaDe n sl(0 2xoxo3io4om elnci ( sDrmx ont1oee  fetydlaDrmu snt4tlxomrcoa1omDrli s;s0trum(opiudopenmfeia(f rrmxrpot0opxnmo3tytfa rm(vp u)aeerxfctytfmDelueilt  etr(m oy1amenmieilsf rraxr ot1tpen octydfm ulums u)tlerio3oydfmt  ivols trumir oy4op emnct sfa2rmxronu0ale  f3iad m2emnmp;t4tltoif3iy1omD auei;(0s2toio3ou4ame mies sfaDtm(rooo0openiocildlm2em(mo;(0arxnxr3to1lmtrli s;t)seurim3no4am nmnvs s)a2ra(  ;u4oltomfciat aDumuvp;(4trxoxoctydlp eln o s  rumio nu1olt mfeta()a2raxmo;u0tltoioctys m emnvpn(0 exnio ia1fm eln ols0 rumxrpoy4alt mfvil( sDurxr ot0oexn o3iaslmDelums ()tlenmo3oadlat auvo (0 rxoxm3nodamtnlnvsl(fa2tmumo;o1tet  fciatlm2ulnmsnt4trxrxrcoadlpD  nvs;t trtrir3oo1opte iviasf rum( ooo4open i3iatfm ranvs;t)aexnmo3tatom raues;s  euoxr3io1oltnmneiatfa2uax p;o4opt mi3ild m ulums;(4 lxnir3iatlpt aueslt)texm(r3nydoltemnvs sfsDtax p;o4tlx io3tadfs2ul( o ()trtrxfciodoaD  uvi;( teurxr3iudlltn fesat a2trurp;t0tetn oeiyt aDem(vs;(4tlxrif to1lmDeaneslt srxm(m ny4alen fet ( srtmump;t0opxn fcils sDem(mpn() exrxr iy1oaDeli i t0 euo(mpny4ape  ici t)a2umumoou0ole  o3iadla2rauvp;u0 rtoir iadfmD  n o t)texr(r iudom   fesl() Duaxrpou0alx ioetysfmDra(vo u)aetnir to1fmD  ues s  2xoxmpoo1ap n nesa( s2tau o;o0ole iieiyt sDrl(mp (0tetnmf3iy1opte uvs t0texmir3io1op elnvtat  2trxro;t1aleo i3tasls rmuvs t)alxnmr iodopD lnvs (0t2toio3iudop elnesa()artmu ono4oetnio3ildfsDuau s;()texrif ootopDr uvo ()t2xmirpnu4op   neilt)arraxrp;o1alen ieiltfa ran s u) rtnio ty1la rlivi;s)s2umxmpoy1ale micsl() rtaxro;t4ole iieilt a rluvo t4tlerif iytoa  lueo;()t2xo(r iu4optnlfetat aDraum ;o1oetn fetatls rlnms t4aexoxo to1omtrai s t0t2toir oo4op e ncsl()sDtm(mp;o0aexomocias a2emn ont) lxomr3iatfptelnvsl()teuoxr oudop nlivi ()a2tr(rpno0aeeomo3iysfa2ranms u) rtoxr3oatoptelivs (0srxrim ou4oleemfcsat)sDrr(r ;t0tlx mfctadfmDea( o u)tleomo iodlmDe ueo;()s2tr(rpno1lmen nvsasf 2trxrp;u0teeomf3tydla el(mp u0 etoxo oatfat luvo t s2xmxo iy1olenlneias a2rm(  ;t4tpe iieias sDeanvpnu4 rxomo3iydfm r ivs;() ruoxo iydlpt  nvia( aDtmu o;o1tltnmieiadfsDea( s t0 exrir3tydlp eanvo s)tetoxm3iydlpenmnvia(  2rrxronu4opxomi3ildlm ra(ms (4tlxnirctodfpte uvolt0srumim iodlm n nesat)srumxr ou4tex moeiytfm2el( p;t)arenmfcoatom elues () 2urim3iy1lp  lictltfsrum( p;t1olen ictydfsDrluvp t) lxnxo3tydla  au o s srurio nudole  fcs s a2umumpou0tle mo3iytls2rmuvpn()tetrio ootfpt  nvi;s0texmxr3ny1llt mnvsat)sDrrx  ot1olxomictydlsDrm(vpn()aeerxo iodfmDe ueil()teuo(o oo1apt liciasfs2rrxrpou4aexnmfetltla rauvs;t)tlxrio oatlm raivi (  rum(o3oydal emivtl()sDtax o;o0tptn o3ilslaDumnvs u4tltoio3oo1fmte ivs;t0texoir ny4ole lnesat aDumu p;t0opeo oetad aDran p u0artrio3iytfa   ivol(0 rxm(o3nodlmeelnetlt srrr(m ou1olt mo3tad aDranms ()tlxomf iadomt au s t) etrxr oodlm   ncia()srtmu p;u1optomieildfs2ranvs;(4trxomo3todomt li i ( s2umxopoo1lm nmncias  2ra(rpnt0altomoeias s2rmu s;t0aeerir3oatfpDrli s;s)t2urxo3iodlptemictl()a2rax ooo1apxnmf3tls s umn pnu) renxo iy1lpt  ivi;(0srtr(r io1ap elicias)a2uau oou1oexn ociysfsDrlnvo (0alxoxfcootopD lnesls s2toim3oy4oleelfviltfs2ua(mp;o4tlt io3iyd s raumpnt4tlxomr3iadomD aueo t0 rxoxr iu1ape miviasfarrrxm ou1teenmociydfs ea( s;(0aexrxfcoatfp  anvsl( trtoimpoo4apt lfcsa()s2rm(r ;u1opeo i3iadla rm(vs (0arerio iy1fmte ueo;t) rtmirpoudlltn ivt ()sDurump;u1alen f3iasfs2rln s u0teeoxo oa1lpD  ieil() rur(o3iydll nlnetat  Duru p;t4aet mieiat sDea( ont4tltnmf oydlaDrlu s ()teur(r iy1ll nmiciat)a2rau  ;o4opxomfeiltfsDrmu p;(4trxrmo3tatfate ueil(0srxm(m nu1ll elivt tfa2trx pnu0oeeoiociadla2eau pnu0 rtnmfciodfatrliei t0s2umio nodll emnvtlt  Dtaumo;o0tleoifetatfs elumpn(4tleoxr tadlmteln sls  rtoio no4lmtnmfes s)s2ta( pnu1aeeo f3iytfaDeluvpnu0 eeoxf totlmt an i s sexo(o oudal nmnvsa(faDtmxm no0oleoifetlt aDel( s;u4aexrxr3iatlmDeaivs;t)trxmxrpio4lp nliesas a2rru pou4oeen f3ils m rmnvs;(4tlxnio3ootlpDelivi;s0 2um(rpou1lp  lfcta()srrr(  nu1apx ifcias sDumnvo;(0aexoir ta1faDr ieo;(0 ruo(r ny4op  lictatf Duaxmp;o0olt mf3tldfm2em(vpnt0 eeoxf oodoaDelu il(  2tmim3ou1altnlictatf rtmxrpnt0aptomoctasfmDulu o;u)tlxnirctatfpDran s s teumxr iy4olen nvt sfaDrax pnu4aeen ociytfa2rmu o;u)artoxociy1fp r u o;s)trtrxopiy1lpeelics t)aDtmur nt0aeenmiciatlmDuan p;t0texnxr3ootfmtrliei;s)trurxopny4lpe  nes tf rtax pou1aet ii3ild sDrm(mp;(0aetoxf3oodlm  aivs;()srxoir iu4lltemfet t) Dtrxmono4texnmieiad mDeluvo t0 rxoif3iydlmD an s s s2trim nydam elfeils) Dtaur no0oltomo3ildfsDumuvsnu)trenxr todlmteli i;s0 2tm(r no1omenmneslt) 2tmuro;o0olxo octyt aDulu on()aexnxo ta1faD  u s;t0sruo(rpnu1amee fctltfarrrxm ;o1ope mf3iytlmDul( onu0tltrxo3iy1optean i;()trxmim3nodamtn ies s arrr(  no1oex mfciyd mDea( s;u0 lxrmf3ty1lateluvil(  rumim iydomtemics (f 2trxm ;u1ale  ocild sDrmn s ()aexrxocoodlmtrli o s0 exoio ou4lp nmfctlt)srurx oou0opt  ocild mDum(mo u4 rermr io1laD au o t0 etrxm ou1ape mfvtlsfsrur(r no4olxo feiydlmDelu sn() lxoxociatlmDrai ol(0teuoxm iydoptnlnet s a2umu o;t1oex  iciadlsDrmn p (4 lermo3iytfptr uvo s srxm(mpnodllen fctl()aDurx  ;u4ale mi3iat a ranvp;(4 ltrmo3tydfpDe uesl() etrxo3iydapt mivsa()srrau  nt4opxoiiciltfs2ulu o;() lxomociatfpteaivol(0setr(m oo4lpeemnvsas sDrr(moou4aexo iciasfm ea( pnu4tlxrifctotomD  n s;t t2xo(r nudlpeemfetl(fs2rmxroot0tlenifctas s ua( pnu4aetnir3totfatrlnvo;(0srurio3io4llt micia(f Dtm(mpot1tex  feiytfa2rmnvpnu4 exrmr tadlaDrlu s s  rtr(o ny1opt lieias)sDtrurpou1aetnioeiyd sDuln pn()treomrcootfpt lueo;t0teumir3nu4lmteliet () Dumumpno4olxnifciatla emnvs;() eenmr totfmt ai s;t  euo(o3oo4lp e ivtls)s2raumpot1oet ii3iytfaDemn o ()arerir3iadop raieo;() etoxo iu1ol  lnei (f 2umxmpnu1apxnifciasls2ea(mpnt4 rerif iotomDr u o;()seur(opiu4al elfesat sDtrumooo4openio3tysfs rl( p u) rxoif3todfmDe uvs;s0t2tmxr3nu4apen feta(f 2ta(m no0optomo3ildla eanvo u0tlxoxo3oy1op ranvo;s)trtr(r oo4apenmivsl()aDurxmont0tpxo fcildlm eluvs;u0aetnxf3oodfm   n s;( srxrxopiy1am   fetlt  2urur ot4olxnioeiltlsDuln on()tlxoif3ia1op  an sls) 2tmxr3nu4ap e nes (fsDra(  ;o0apenmfeils mDumu s;u) etoxf3oydop  livo (0texm(r3ny4am nlict s srtax p;o4aeenmiciytlmDrm(vp (4trtrxr oydfmteli o s0 2ur(m3ny1aleemfeilt  rrrxrp;t0aex iociysfm rlnvsnt0 renio iotlm   iei s s2umio iy1omtemieia( sruaxmpnt0aleo i3tas sDulnvsn(4treoxfctatlmtrlivi;t srtrio3oy1ame mneilt  Dur(  nu4tet  iciat s umnmo;u)aetrmf3ia1fp elieilt  2xo(m3iu1ape miesls)sDumumoot1oex moeilsfm ul(vpnt4artrxocoadlpDrluvilt0s2uoir oo1ll n fvtasfartr(  oo1tptn ociyd a ea( o (4teenio oydfm rlueo;s  exm(r ou4lme mietatf Drmxr oo1ope moctlt m ra(vp t4areoxrciatop e uvslt)trxmio iy4ol   fvta( aDua(ronu0teen f3iytls2el( p;()arxrmfcto1lpt li ols  rxo(mpoydolt mnctl( s2rmx  nt0ape  f3tas a emump;()tlermrcoa1opt aueols tetoir no4llen ivta()a2uru oou4openio3tyt m em(mo;u0artnif oytfpDeaies (0trxmxm3iudol nmies s sDrru  nt4aleo o3iat a2ea( o;(4 rtnxocoy1omDr uvs t)setr(o3iodlmenlfvslt  Dtrumo;u0aetnmo3iydfa rmnmo;(0artomfcoydfa rluvs;s s2tr(o iydlm nmietatfs2trump;t1opxnmoeiyd m2rmnms;()aexrifcoa1fpD  u o s trxrxo oodom emnvta(f rraumonu4opx  o3iyd aDrl(von(0tetnio3ta1lpD auvolt t2xo(mpnu1oltnlnvtat sDurumont0oexn iciaslm ulu ont0texnir3tytlm r uvi t0t2xr(r3ou1ap elfvta(fsDrm(mo;u0aeen oeiltfa ulu pnt) reomo iotop raneils0srtmxopou4op nmictltfaDum(  ou0apx  feiyd sDrl( o u) rxrir iodoatrlieslt tetmir oo1aptnmivi s  2urx pnu4optnmf3iltfa rm( s () ltomf oy1fmD auvs;( t2trimpio1ll  mivs (f 2tr(rpnu0oeeomi3tydfa2em(vs () rxnxf3ia1lm eanvs;s teurxo io1oltnmictat) Dtau onu1aleniietys a2emnvp;() exniocoy1omDr nvo;t0sruoxr iu4amenmfetls a2uaxrpot1tee mo3iyt sDul(vo;(4teenxf3oadlaDeaivs;t0sexoir iu4aptemnviatfaDtaxmo;o0tlxoif3tyt s ean p;(0artnxrciydfaD luvo;t0 2trxmpno1al   fct t  2rmx  ou0apxoifcild a2uln o ()tltnircoydoaDrau ils)t2uoim3nydopenlivi s s2tmumpou4tex io3iysfs2rmu o;t4arenmr3io1fp e uvsl()s2urio3nodameemies sfaruax  ou1texo ieiad m2ul( sn(4 exnxrctotfm ranvo;s) rumiopiy4op e fvilt sDrr(mpou1tetnmoeiltlmDuau o;(0 rxoif to1laD ln sl(0tetriopoydll nlfvia( a2rmu  ot0opeomieiyslm2umnmsnu0alxnxf oa1oa r i o t) eur(opio1lltnmfetls)a2ta(mo;t4aet mo3iadla ua(msn(4tleomr iydfmtrlu slt) rto(o3iudlpenliet tfarua(m ou0teeo iciltlm eau on()aetnmocoydfatrlivi;s)t2urimpiudom e netls  rtax  ;u1tpeoio3ild a2ea(ms;u)altoxocoadlpt auvslt0trurimpou1ape  fcils  Dtrurpoo4tetomiciydlsDuanvo;()arerir3oa1omD  uvi;(0s2xmxr3ny1omte fctasfartaur ;o1oee  fetatlmDemn onu4treoxf3tadlm   nes;( s2xrio3iy1apt lnvsls aDrrx  ;u4opeomi3iysfm um(vp t4areoxr3oo1oa ean i;s)texr(mpoo4openmncsl() rrrx  ;u1oltn ocilsfs2em(vo ()tetnxf ia1omDrlnvolt teur(r iudaltemnei s s2umu ont4tlxo o3iyd mDrm(mp;(4teeoio todlatelnes s)texm(o iy4al nmnctl( arumx pot0tltomfciadlaDulnvo (0arenxo iadlp r nvo ()t2toxo iy1oltemnetlt a2uau o;o4tlt ioetadfsDea( o;u4 eeomo tatlpt ln i;( seurio3oy1lm nmfctas srum(mpnt4oex ifcils m2um(mo;t4aetnmo3ty1omDe nvsl(0 2uoirpoy4olenlfct t  rrmu  ot0tetoioeiysfs2rm( s u0tetnmfcoa1lpDeli slt)teuo(m iu1lm emietls)srtm(mono1opeoioctls mDuln p u)artnmr3todfptrlues;()trumim3io4llte fvslsf 2rr(mont1apxo oeiad s2elnmonu4aeenifcoytlm   i i;t0 eum(mpoo1om  mfeiat)aDrmx pnu1tex ioctatlsDean s t)tltrmr oytomtran o s0t2xm(o3oy4ol  lfci ( sDrmxrpot0tltomi3ils s ean o;(4tlxoxf ta1fpDe n o t0 2xrir iodoltnmncslt) rur(r ou4opxnioeildla uaumo u0alxoxf3oy1lm r ivs;s teuoir iy1alen fvt sf 2trx  ;o1opx iicils m rlnmp u4aetrif ia1oa rlivo s0trto(o3io4ol n iei s)arra(  nt4oee mo3iltfm2um(msnt0trtrxocoatopD lneo;(0srxm(rpiu4lp   ict s s2umx  ot4tptnmiciadlaDrlnmon(4 exrif3oy1laD ln o ( setmxr3oodam  mfvsa()aDtmump;o0tlt  f3iysfa eauvpnu0 lxoir3oodfmtelneo ( srxrxopoo1ol n fvilt a2rm(  ;u4apx  fciat sDel( s () ltoxrctydla   uvo;s0 ruoio io4omeemfct t sDrrxr no0ape  o3iydfa emnvsnt)aexrio3iatlm raieolt)sexoio nudop n ics s aDururo;o4tltnioctyt mDem(vs;u4 leomr3iotla elnvi ( trxoirpoy4openlneia(  2tm(mp;u1tpxnif3tydfa2rmnvs t) eeoir3todlpDraneo;(0 rur(m oydalt  feilt aDtr(mpoo4tetnmi3iat m2emnmp t4tetrmo3oydomD an o;t0teurxo ou4al emieslt s2tmx pnt1tpxoiieiltfs eaumo t4tltnio tydopte ivi ( sexmiopnu4omeelnvs (f 2ta(mpoo4alxoifciyd a2rm(mpn(4 rtnmf to1lm  luvo t0trtr(opiudolt  fei ( srtru  ;o1ope if3iad a2rmuvs t4 rxnmrciatomtrlieo;t) 2xoiopnudole liviasfs2rr( oot1oex mo3iadls2ranvpnu4aetnxf oa1laD lueolt0seuoio3ny1lpe  nct t)srrmu oou4tex mfetlt a rau ont) rxriociy1om ean ols sruoxr3oo4altnmies s) ruaur no1apxo i3iadlm ra(mpn(0aetoio oatfpDeluvol( t2tr(o oydape lics (fa2rm( oou4tptomoeiyt a2raumont)artrifcoo1om rlueo s) euoirpoo1ll eliciltf rraumono1alxoifeiat a2ua(mo t4alxomo oodoateau il( sexrim3iu4ll e netltfaDtrxm nt0tptn ociyd a2elumo;t) lxomf ta1fmDrlnvi;(0s2uo(r nydomtnmfcsls  rtm(mp;u0tleo ictatfsDum( o (4trtomfctadlp ranvolt0t2xr(rpiu1openliet s) rtmx poo4apx ifetatlmDrlums t0aetnxf iodfaDeliei;s0srxrir3oo1lp eliesl()s2uru pnt0olenmicilt a ua(vp;() lxnxr ta1fmtelnes ( srumiopou1lptemivt t srua( oou0altn ieiltla2uluvpn(0aexoxfctotlmteln i;s setm(r ou1ape mivsa( a2ur( pnu1apeo iciydfaDua(vs (0 rerxr3tytfpDeaieo ( t2uo(opio1lme lfesl( a2urxrpot1aex  i3iyd aDrm(vp t) rxomr3tatlateai il() etm(m3nudll eliei () 2rrxm ot0oeeo fcias a2um(vs u)texrir3ta1faDr i ilt sexmxr3oo1op n fcslsfaDtaxmpoo0tpe  fetysfsDeln snt) lxrifciytfmDelies;t  exo(r nu1amte nviltfa2umxrp;t4apenmiciltfs rmn o;u) reoxo iytfa   u o;s0t2uoxrpoy1aleemnvi s arrmx p;o4aeeomociad s2eluvs u0 eenxf3iytfm r nvi;( teum(o no1lltnlfctlsfartr(r nt1tpto o3iad s ul(vo;(4 eermrcoy1lptranvs;( sexmxo iy1olt  ncsa(f rtm( poo0tlxoii3iaslmDrmnmsnt0 rxoxo3oodoate i s t0 2to(m io1llenmfes t)aDurxm nu4tpx mieiys s2eanvs;u0 lermfcoy1lateluvs;()texmxm3oudal nmfet (f 2tmxmont1apxnmfeias mDrlnvs;u4tlermf3ootlmteaivo;s  rur(mpou1ome mncslsfsruaurp;o1ape  fciadls emnms t0teerif oadoptr i o;t)t2umir3nu4ol nmietat)a2rrx ono4olxn oeilsfaDulums;(0trxriocoa1fmt an o;s srto(opoo1lmtnmivslt a2ta(r ou0opx  ietyd a2el(mon(0 renio3oatfm  ln s;s)teurxm nodlmt  feiat)srtmx pnt1tpt mfciyd a el(vo;t4aetnio todom  luei;s0trxm(r3iu1omtnmfvtlt  2ra(mp;u0olt  f3iytfm2em(vp (4aetrmr3iotlmDe nvo t  rurio3nu1amtelfct s)a2tmu o;o4apxoifetytls rl( sn(0 exnxr oatoate n s;(0truoxopio4ll n fcsls a2tm(r ;t0oltnioeild s2rl(vo t) rtrmf tytlp e neo;t)teumiopiu1ome  nctas)aDtr(rpno4alenmieiad s rl(mo;t)alxrmr iadoaD an sls0 euoxrpnu4lpt mnvsls) Drrx poo0oex  i3iad m2elu onu4 exrmf3ootfa  auvs;(0 eur(rpou1lmtelneils)arta(ront0apt ioeilsfm uauvs;()aexnir3iodoat luvol(0 etrxopoy1om   iei s a2rr(mpoo1aetoio3iltlsDrauvo;t0tlxrxr tytopt aivol( teto(o no4ll emfet t)sruaump;t1teeo o3iydfmDeauvsn(0 leoxoctotlmt ln s;(  rurimpno1ame mietas  rtmum ot4oeeo oeiaslmDumn on(0aeenircto1fm e ieols sexoio ny1alt  fvtl(f Dtau p;o4tpxnmoeiadfs2ulnvpn(4alxnxrcia1latr nes (0t2trxo ou1ll n ncsa(fartrumo;u0olt  icildfm eauvsnu0tetrxr tydopDr nei s srurio nu4apeemfciat) 2uauroou1alx mo3iadlmDumumo;() etomr3oy1lpD lu i t)seuoir nodomen nviltfs2rm( pnt1teen ietadla2ra(mo (4trerif3oo1laD au o t  ruo(opnodopt mnvsa(f ruau onu1altn ietldfsDea( p (0tlenifcoo1fmtelu il()seuriopnu1lpe mncias  Duaxm no4olx ifetytlm2umn o u4aetoxo3oy1la  auvi t  rum(opiy4aptnmiet t artmumpot0opxoiiciydla eau o;()tetrir3ta1fm  lieo t) 2tr(o no1om elnvtlt srtau pot4olx io3iadlm eau snt4arxnmr3todlaDe nvi;t) rumxmpiodlpe miei s s2raumooo0oeeo fetas s eanvp u) eenxf3iotlp   ieo (0 2umxr iu1ameemfesasf rrrxrp;u1alto ociatfsDua( pnt0tlxnxr tadoatelues;s) exm(opnudole  fetls)arra( p;u4alenii3iyd a2rlnvo;u4 renif3oodlat  u s s0 rtm(r io4lp nmivt tfaruru  nu0aex moeild mDra(ms t0 lxrmo3tydoaDeauvs t) 2urxr nydopeelnvsls a2trxmo;t0tlx ifeilt aDrln o (0tlxrif3tadla elu ol()t2xoxr3iy4amtelieta()sDtr(moou1aetnmiciatlmDrm( ont0tltrif3oydfptranvolt)truo(mpiudlleelict () Dra(r ;t4tpxoiociasfaDum(mp;t)tetrxfciytfa  au sls)trtmxm oy1ap nlncias aDtm( p;u4olxn feils m umu o;t0tetnmf3to1omt  nvs s0t2toxmpnydlmee ics s)aDrmx p;t0tptoii3iatfa umu s (4aetnxfciydop  aues s)t2xo(opoo4lmeemfeslt) rtr(m oo0teeniictasfa rau s (4texomo oytoateli s;(0sexm(opnydlp e iesas  rtru  nt0alt mfetydfm rlnvs t) rtoxo3ia1lp eli slt t2tmxrpiudamtelivtatf rtr(  ;o0aeeo iciadlmDrmnmo;t4areoxocoo1lat lnvs;(0s2urir nudoptemfvilt) 2ua( p;o0aexomictatfsDraumo;t4tlxoxr oatoat livil(  2uoio3ou1op nmncsl()arur(r ;o1aet mfcildla rlump;u0tlxoif3ty1fa   nvilt) rtmxrpiudaptelneilt)a2um(mpot1tpeo o3ilslsDeanvs;(4 rxoif3ia1oatrauvol() rur(opoodoltn feils)sDra(ro;o1teen ieildls2umn pn(4aleoxr oydlpDr uvs;t) euoxopnu4om emnciat)sDrrum ;t1olx ifciydfmDrl(vs t0tetoxfcoydlm elueo;() rxoxo iodop nlnci ()a2umx pot1olxnioetadfa2em(mpnt)arenxociotfm  livo;(  eurxo3oo1ol nmnvtas)a2tr(mpou1aexoioeiys a2ran on(4aetoif oo1fpt  nei;t) euo(r nu1am nlfviat) 2uaur no4teeoiicilslm2uau snt4 ltoxo3iatlpt auvol( teum(m oy1lm  mivtltf Duaxm no0alxnif3ias a umu ont) ltomr3iy1laDelivols0texoxo nu4al emnei sfsDtaxro;u0oex  ictldla2uau p u4tetnioctadlm  aivo s0t2trxo3no1llt mnvsl(f rtrxrpou1aee  i3tadfm2emn p;u)treomo ia1omteluvslt)setrim oy1omen fvsa( srum(  ou1tlx iietatlaDuau o;t0altnmfctydoa r uvo;s0srtoxm oo1ale mnctl( aDraxmpoo1aeen ieilsfm2ra( pn() eerxociadfp  auei s s2uo(mpiy1aptn nesls  2um(rpot4opxnio3tldfsDrm( sn(4alxrxfciotop rauei;s0 rxr(opoo4ap   nciasf Dum(rpot0tle io3ilsfs rlumsn(4tleomr3ia1fmt lnvs;s0 2xrxr3oo1lpt  fctl( aDtrumoot1olt ioetasla emnvs t)tlxrmociy1oateaivo (0t2umiopio4ap e nesas)aDrmur ;o0tpxo ieiysfa umnvp;u0artomf oadlm r iei;t tetm(o3iu1ameelics s)aDtr(mpnu0alto i3ilt s2rm( snu)altoir iydom  anesl( seto(o ou4lme mnvsl( artr(rpou4olt mictys a2rl( p u0trxnmr iodfmDranvsl(0s2urxm oy1llenlfcsls)aDraxrpnu0tee iietasls rauvsnu)texoioctodom e ies;( t2toxr oy1ap   feiasfsrtrx pou1alt mieils a2rl(vo (0teeoxo iydoa rlivs;s)teto(o3oy4om nlnci sfaDrau p;u1tptniieiatfaDulumpn(4texoir iydlpDe nvils)setm(rpiu1lpee neiasf 2tmu pot0ale  ociys m2em(mo u) eermo oa1oateaiei ()texr(opio1apt  net (f ruaur ;o1alenifetyslmDran ont)aeenxo3to1fm rauvs t trxoio3iy4lpe  fci t sruaumoou4apenifciyslm2uln p;t)texrmo iydfaDrlueils0s2xmxr io4apt mfvtls) Dtr(rp;u1aexomfctad a2rl(von() reoxf oodfpDelneols)trxo(o3iydomt lnct t) 2rmu pnu0apt mf3tld a rmnvs;t4tleomfcto1fpte n sl(0trurxr oydalt lnvsas a2rm(mono4tltn oetas sDel(vsnu0arxnif3todfaDelnes;( srxo(r iu4al e fvsls  Dtr( pno0aeeomociadlaDuaums () ltoio oadlpt luei () 2xmimpoy4op elivslsf 2raxrpnu4altoioeiys m rl(ms;u4arxrmf3oa1fpt anei;t)srum(m io4ol nlnvil()aDuax ono1olx miciysfm2rmumsnt4 renircoytfaD aiei t0t2xmim3iudom nlfcsatf rtaumo;u0olxo i3iadfa2elnvo;u4 rtrxf3tytomte uvs s0 rumim no1llenlictatfa2uaxrpot4opxn fctatla2rln p ()artnmrcty1omDe n ils0t2um(r iy4ale mnetlt) Drm(m ot4aeen f3iltfsDua( o;u4alxomo todop eanei t) exrxr iydlp nmfeslt s2uaxmoou1opto fetysfs2ulnmont) ltomocia1fm raivilt texmxo3no4lp  lnvs (fa2um( p;t4aetn octadfs2ulnmo;t)arxoif iy1fm   ivi t tetrxo ou1amtnlictasfarrrxrp;t4aptomfctld m2emu o u4trxnxf3totlatr ies;t0 rumxo3nydlmte feta()arrauront4tpeo o3ildls rm(vs;u)tlxomfcia1laDeaues ()t2xm(mpou4lp  mfetas  rurxroou1alxoiieilsfa2rlnvpnu4teenmf tadoptrln o (0trtoiopoydlm  mfeia( a2ra( poo0oex mfetydfm2rl(mp u0tltnio3oo1fmDeluvs t) rtrir iudlp emivt t aDumxmont4opeomf3iatfmDrmnmpnu4 renmo ta1fmDeaueo;t  rxm(opiy4llte ictasfaDuax  nu1olen oeildfsDrmnvs;t0trxrmf oodoateanvils0 2xo(opnydope lnvtlsfa2rm( ont4aex ifctydlsDemu p t0 rxnmo iydoatrlies ( setr(mpnudlm  miei s aDum(mpou1oexomfeilslm ulu pnu0arxnmr oo1fpDe nes;( s2to(m io1apt  nei ()s2rrumpot4oleo feiydfmDean s t0 rxrxo3oydoaDranvs (0 euo(rpio4ape  ictlsfaDraump;t1ape  fcilsfaDeln s;(4teeomf3ta1op rln s;t sexrxr no1omte neia()arur(rpot0apx  feias s2ea( p t)aetnmfciatopteaies;s) euoir3nydlle lfvi (  Drr(rpou4tee ii3iasfm2ea(mpn()alenmrcio1lp  lieo s0 rurxr3iydop emieils  rtm(rpno0opeo oeiatlaDrmumo t)tetomf3oadopDr i s;(0 2xrxr iodlltnmfcsat) 2uaxmp;t1optomoctys a umu s () rtoifcoo1oaDeaivs;t0seumxo3ou4lmtnmfesasf 2tr( oot1oee iocils m2eluvo t4alenmo ty1fa eaivs ( s2tm(opou1lm n fvia() rur( pnu4opx  ocils m elumon(4 lxrir oytlp r nvs;()t2xrxo oo4lm nmncsas)sDtaump;o1tee mfeiatls2eluvp;u4 leoioctytfp elieils)sexrirpnudape mivtasf rta(  ot0oltnmieiyt s uluvp (0 leoifcoadoaDrlnvsl()setrxo ny1oltnmfvi s  2tm(mpoo0tlto feildla uan pnu0 exomr totop   u ils sruoxrpnodoptnmncs t sDuaxmp;t0tptoif3iasfmDrluvo;u)trtomo3oydlaD ln ol()trtoimpiu1omtnmnei s aDtrur ou1teeo o3taslm2uauvpn(0tlxnmr3oatoaDe nes t0srtoir3oodlp n netlt  rum(mono0tle iieiltla2rmu s u0aeeoxo oa1optrluei;t)t2xoxr3iodole mfeiat srtrxr ot0olx io3ilt sDemu o;t) lxrxo3oadfpDe nvils0srtrirpny4lptnmnes ( sruru o;u1alto ocilsfs2eau pnu)teenmf oytoate ueilt teur(r oo4lmenmivt tfsDtaum nt0tlt mociltfaDel( s;u)arermfctydoaDeli o;s tetmio3iodamt mnvs s sruau ooo1oleo ieiysfaDrmuvpnu4teermfciydoatranvo;(0 etrir3oy4oltn ieil()srumxrpou4apx  fciysfaDea(msn()aetoxrcoytomD aieo;t) 2xm(r oy1lmtelfvsls)sDra(root4aptnmfciadfs eanmo;t)tetnir3iydlaDrai ilt0srtrim3oy4ll nmnctlsfs2rax  ;o4teeniictyd aDemumont4texrmf iatlpte ieslt0 rtoxr3nu1ap   nvs s arta(ro;o4tpeniieildfm ranmo u4tlxnmr3tatfmt li slt0t2trirpno4olenlfei s)aruaurpot4optomfctyd s2rlums u0altnifcto1om  anvil( texrxmpoydllt lnetas)sDrmx onu0alxo i3iad s rmu o;()artoxo3ootopD lneilt s2uo(mpou4am  mnct tfsruax  ou0oexomictasfsDeluvonu)alenmf tatlmDrliei t0t2trio oudapeemnvslsf rum(mo;u1aeeomociyd s2elums (4teeoircoa1fpDrau slt  rtrim oydopen ivtlt) rtrxmoot0tpxnif3iltfaDua( o;t4 lxoxfctatlaD lies t)t2um(o io4ap elivil(fartaxr ;o4aleoii3iytfm2ua(mp t4 eerif3iy1omt luvo;() 2xmxm ny1omee ncsasfaDrru pou1opeoioctasfa em(vo;u) exrmo3tadfp  lnvslt)texrimpoudol  mfvia(fs2ra(m oo0oet  iciad s2ra( onu0trermo oodfat lnvolt)seuoim iy4opt lieiat s2umuro;u4aeeomi3tldfm elu ont)teenmo to1fat  n i;t) 2uoxr no1om  mnvslt) Drru  ;o0oeen o3iasfa2eanmont0 etrmo3iadoaDr n i t srxrio ou1omenlfeias) Dururoou1aptomoeilsls2umnvpnu4 lenmr io1oa r i o t  2xo(opoy1om  mnvil()arraxr ;u0optoiieiydfm eanmont4 rtrmfctotlpD aieo;s)sexrxrpnudap  lfvsat  2um( ooo0oexoifcildls2elnmp t4 ltrmf3oatla eli slt0 2umim oy1lltn fctltfs2uaxmoot0tex iociytfaDel(vs u)altrifcoa1om eai ilt0t2tm(r3no1alenlfvi () ruaur no0ole  oeiad m rln s t4 etrif oy1oateluvo;(  exriopoo1amtn ncs tfsDrmxrpnu0olxomoeiysfm ran pnu0trxoxocty1fat ai s;()s2xr(r3io4altemfei (f 2rrum oo1apt if3tydfm rlnmpnt) etoxocoo1fp eaivslt) rtoxo3iy1lpe micsatf 2rrxmonu1tleomociydfmDemnvp;(4tlxnmo to1la  aivs;t trum(rpnu1ome  nvtas  2ta(rp;o4oexomociad s umump t)tltomo oodomDeli ilt0s2urio oo1al emieilt)arrauronu4tptnmoeiadlaDelnmsn()tlxnir3iytlaDr i i s)srtr(m3io4amtnlncilt)aDtm(mpou0oex mfetat a rlnms;u4tlerio3ty1opDrlnvo (0t2tmimpoydam elneils  rumu  nu4ole mi3iatfm2eaumsn()aetrmo oydoa rauvols trxrxr iu1am emfcs t)s2rrumo;o0oet mocild aDulnvp (4 lenmr3iotoa r ues;s)trxrir3iy1olenlnvi t)arrrxmont4ale mfcilsla em(ms;u0tlxnxociydlpDelnvo t t2toim3oydll e fviatfs2trxrpou0oeenif3iltls2ul(mp t0aetnif iadlmDr i sls)s2trim iydamee fvt t  rurxm ou4texnmociasfmDumuvo;(0aexoxociodomD lneolt) 2toxopno1am nmnci s aDum(mp;t0tptnmfcilt m rln p;u4altnxf3iatomDr ieil( trum(r iu1aptemfci t a2umurpot1oex if3iatfm2em(vont4 ltoir3tytfm r uvo;(  2xo(r3nu4om   fei sfs2ua( onu4tlxnifctytlm2rm(vont) ltoif3iodoa rai s ()s2umxopoy1ll nlneta() 2uaxm ou4olxoii3iltfa2ea(vo () reomrcoy1opDrlues ()s2umir3ou1optn nvi sfartax pno1tltnmo3tysfa2um(vsnu0tetrif3tatlatrauei t0t2umirpny4amt lneilt)s2urxmo;t0oexnif3iytla umumsnu)artrio iydlm r ieil(0 euo(r no4opteliciat)s2uaum ;u1ope  octls a2emnvsnu4trerif3oodlp   uvo;s0 eto(o3oydom n ivil()a2ua(rpnu0tlt  ietydfsDraumo;t0tlxomo3oytoaD au s ()srumio3iy1am   ivt () rumx poo0oltoif3iatfa ean o t)trenxrcta1fp r iei t srxmir3iy4lmt livsls aDtru  ;o4teto ieiasls2raumo t) rxrirciotlptr nes;s)sexmim3nydalt licsas arrax oou1oeeomoctyt a2eaums u0tlxoxf to1fp rlu sl( trxoxr3oydal nlnei t  2rr( o;t0open o3tltfm el(vo;t)tltrxocoo1lptr i i;t) 2xmim3ou1alenlfeil(farrm(ront0alxnioeiydfa2um(vp;t0artoxf3tatfmteli o () etrxm3iodole liesas sDtmxr nt0ole ii3iys m umu s;t0trtrmocio1fate ues;s) 2tm(r3iu1lmtnlfetat s2umxmo;o1optoio3tltlm rl(vs;t4tetoxoctatoatrauei s) eumxr3iy4ale mnesl(f rtaur nu4tpx mocild aDua( snt)texoir tydlm   neols  2toio iodame lfvs tf rtru ont4apenifciadfa rmnms;(4texomfcta1oat  uei;(0trur(m ny4lmenmieilt) rrm(rpoo0alt mieild m2em(vs u4tlxrmo tatfpt lu i;(  rurxr iydamtnlict s)arrm(rp;t1apxo fctyt m2umumpn()aleoxrciadopDe ieslt) rxoir oodlltelicil(fa2tmum nu4oeenmictadla2ea( s;t) eeoxf io1fm  lnvo;t  2xmxrpou1llte fetltf Draxrpoo1tpe mfeild m2rl(vo t)teeomf io1oat aies s0 2ur(r oo4lmtnmneslsfsDta( oou4alt  ociltla umn s u)alermfctotfpD aieils) exrxr3no1opeelfcs t)a2ra( poo1texnioetltla2el(vp (0 rxoxrctadop  anvols  rurxrpou4om nlicsatfarumxr ;o0aeto ietyt a rm( ont) leoio oy1oa eaies;() 2tmxmpno4lltelfeslt  Drr(rpno0tpxoif3iadla2uanmont)tltnmr3oadfpDe n il(0trto(r3oudalt mnesa()aDtmx pot1tlxoiociysfs2uanvs;(0tltnxrctytoptean o t t2toxm3iydomee fctl(  rur( p;t1ole  ocilsfs2ea( s (4tetoio ootom ranvo t0s2xr(rpou4ap eliesa(  Draxro;u4opt ioetlsfmDeauvo (0 lenxrciotfatelivsls0 2tr(mpiudal emncs s s2tmx ooo4tpt  f3iaslaDrm(ms u4artrifciodoa e u s;s) 2uoirpio4om  mfeslt)sDtr(m oo0tlx if3ildfm2ra(vs;u)alxrxocoa1oaDrlneslt) etrirpio1ap e ict t) Dtr(mpoo4aptomi3ilsfsDrln s;u0 etnio3oo1oaDelivs;s  etm(mpio4ome lfviat arua(moot1aexoioeiad a uln p t)texrmo ia1fmD  i olt) exm(m3oy1ol   fvslt  rtrurp;t4aetn fetadls um( on(4 ltoxr todop r ivsl()srxm(o3no1apt mies ()arum(rp;o1olxnifetls mDulnvs t4alerxfcia1lateanvilt0seumxopiy1oleemnes t) Dtau o;t4apxo feils m umnmp;(0 ltrxf tytlpDeaiei;t  rxo(m ny1olenmnvi tfartr(rp;o0tptn octlslm2rlnvpnt0 leoifctydfptrau o s t2xmiopou1aptn fet t aDurxrpot4alxoif3iyt s2emnmon(0tlerif tydlm rluvo t0 etrxr3nodopt mfcia(fsrurxm ;u0apt io3ilslmDea(mo (0aeenmfciydlmDraivils)sexm(r ny4al elivsas sDtru pou1optomf3iasfmDea(vpnu0alxrmrcty1opD  nvo;( trurxo3nu4ome lfeiltfs2ta(mp;o0tptnmoctas a2ulnvo;u0 renmr3oa1lm  anvo;t0texrxr3iydlpenmfct tfs2umxm ot4teeo ictyd mDrlnvsn() ltoifcootomtelu i (0s2xrxopoudol e fvt tfaDrm(rooo0tle mo3iys s2rlnvs;u)trtrxr3ta1oa r ueil( trumimpnodlm nlncilt aDrr(mono0tpeo iciyslm2ul(vo (0aexnmf3ootom eaneo s0 rurir3oo4ape liciasfsrur(mpoo4oexoiieiltls umuvsnt4alermo3tadopt an i t  etm(rpoodapenmfesat s2ua(r ;t4ale miciydlmDeanvont0 exomo3to1fp rlieslt tetoir3oudam e feiat  Drrxmpno1opeo ieiys s2emnmont)teeniocto1omt aivol( t2xm(o ny1ll  lncs (  Durur ;u0optoii3iatls ra(mo u0aexoxo iydfp  auvolt) 2um(mpnu4lle  nvtat a2tru pno4alxoioeiytfm2uaumo t0 ltrif iytlmtrlueol(  ruoio3ny4ale lfvi s  ruaxmonu0tlt  fctysla umn s t4trtomr3iydfm r nvo;s sexrxr iodomtemnvias)s2urxr no0tetomfetysfs2rmn pnt4alenmoctodlmtr uei t0 2trim nu4oleelnctas s2uau ono0opxo octls a2rmuvsn()arenif oadom elneols setrxopny1lltemivslt a2ua(ro;u4aleoifeiasls rmnvonu0trxoiocto1oaDr nei (0 2uoir3ny1lpt  ici ( sruau oot4tltoioctadfa2el(mo t)texomr3tatlm  ln s;t0seto(mpiu1lltelicilsfaDta( o;t4oet moeiys a ranmp t0trxrmr tydomteli s ()sexr(m3oudalt mfvilt  Durxro;o0openif3iadlaDrau s u0 rerxo3iotlpDeli sl(0trxoio3nydal   fvsas)artrx p;o0alto feils m um(mpn(0 rxnmrcia1lpDrln i;t)s2tm(m3nodllee ivils  Dumumo;u1tpe  i3iadfs em(mp;(0arxrir3io1om eaivs;(  2xmxo ou1oleelfvsas srrmxmono4opt  ocils sDuanvont0artnxf3iatfmDeau il() rxoxm nydaltnmfvsls)s2tax  ot0olx moctlsfmDemuvo t0 eeomr3oytomtrlnes ()t2toimpiudolte ncilt  Duru  ot4opt  i3ilt s em( o (4tlxrio3tydfmDr neo () 2xr(rpnu4ape mivt (faDraxm ;o4tleo feiyd sDrlnms u0arxomo io1fmt luvo (0 etoxo iy4omen ietat  2urum ;t1tet  feiadfm rl(mo;(4trenio3iytlm r uvol(0sexmirpoydol   ici tfaDumx pnt0oltoiieiydls uan pnu)arxrio3iotfa  ln il(  2um(m io1open ics ( srta(root1tpx  o3tad mDran on() rxrxociatfmDeaieol(0sexrxmpou4ame lnvtasfsDrr(  nu4aeenmo3tys mDuau p;()tetnir ta1fat  nvil()srxoxo3nu1al nlneia()aDtmumpou1aexnmicildlmDelnms;(4 ltnmf3tadlp rli s t0t2xoio3iy4ll   feilt sDra(ro;t1tpenifetytfa2ea(vo;t)aexnmfcoadoptrln i t s2tmxmpoy1op n nvt t aDrrx o;u4oeeoio3iatfmDuauvs ()trtrir3oy1lm rliei;() 2um(rpnydomtnmnvsls srrmx o;t1texnif3ildla rm(msn(4arenxoctatomtrln o (0 exo(o3ny4am emfctls artaxro;t4oex mfetatla2elnvo u) etrirciatfm ranes;s)sexo(r oodapte ics (  rumxmono0tetnmoetlt m um(mo (4treoio oa1lmD  nvi;() 2umio3iydap e feta() rum(r ;u0olxn iciaslmDea(vpnt4 rxnmf iatlmte n o;t)trumxr oo4ame  iet t)sDrmxrpnu1oex iiciad mDeau p;t0teerif3ta1fpDrlues;(0setoimpnu4amtelicsls) Dum(root1aptnmiciyd mDrln p;t0teeoifcoo1om  au o;() 2umxo3ou4al nmfvtlt)sDrmu ooo0aee mo3iytfa ea(von(0aeenxo iy1faDr neilt)srxmimpoo1ale  icilsfarrm( p;t0tpxo fctysfsDum(mp;t0artrmo iadlp  lnvilt)texoir3iu4lme licslsfartrx  ;o4apenifeiyd a2em( o u0texniocoodfm r nvols)trtmxo3oy4omt  iet s aDtm(mpnt1ale ioctys m emnvs;t)trtrmf oadopteli s ( srxoxm3iy1apenlfvia()sDra(m ;t1texo ieiysfa ua(vo;(0texnxf3totfptr ueil() etoirpiy1ol  lneia(f Drrxroot4tlx  fciytlmDrl( snu) eerxf totom  lnvslt) ruo(o oo1altnlivtat) rtrx  ;u4tlxoif3iltfm2rln onu4artoifciytomDean o;(  eur(o3nu4lp n ncs ()a2raxr ou1tet  fctys aDuan s;u4 leomf oadop  an i;t)texoxmpoudamtn fesas) rra(rp;t1aee if3iadlsDraumonu0arenif3tydopt  ivo;t)s2tmio oo4ap   nei t)aDta(mpno1olxnio3tyt s2uauvs u0trerxr tydla ranvi;t)sexoxm oudlptn ietls)a2uru p;t0oexnmoeiadlm raump;(4altrxo3todlp e uvol()srxrxr3nodale mnvi ()sDrmumo;t0olx ioeils s rmnmont0 rxnifctatlp r uei;(0 2xmir3iy4am e nvils sDtaur ;o4tpenmoctlt a emumpnt)alermr3totoaD luvs;() rxoirpnu4aptn fetatf 2uau  ;o4alxoioeiad a elu p;u) ltoif3tytlpDrlueolt)s2umxopoudaleemfesls  rumurpoo1teenmietytla2rmnmpnu4trenxr oadomDeanei t  2trir nu1omtn ivtls) 2urxront4oetoioeiatls ua( pnt) lenmo3to1fat anvsl()trxmio ou1lp   fcslsfa2rmxmooo4olt iocils m ulu o u0texomr3oydopDraies t t2um(r nydap  mictlt s2rmumpno1aeen f3iysla2emumpnu0arxnxo3iotop  lnesl()srtoir3iy4aleelfei (fsrrr(mooo0tetnmi3tasla rm( p u4aleoxociodlpt  ivilt setrim3io1altemnci ()srurxrono4tee iiciat a2elnvo;(4altoxo ta1fat lnvi (0s2xrir nu4lmt lfviatfaDurx o;o4apenmoeiydfm elu o;(0altoif3tydomtelieo s)sexo(m iydome mfei tfartmu  no4oltn feildlaDemu p (0tlxnxo iodfmDr i ils s2xrirpiodom nlivtlt)aDurxmpno1optnmfetls aDrl(vo (0tetrifcoo1op  ln s (0s2trxmpno4ale miei sf 2tau poo1tpeoio3tatlaDrl(ms;() lerxrcoadfpt auei t)t2tr(rpny1ame lfcsasfs2ta(mp;o1opt  i3tytla2um(vs () eermfciydlaD luvilt0seum(r3ou1aptnmfcslt  Durxmo;u1oeen ictysfsDumnms ()altoxr3tydlmt  ieil( trtoxr3iudlp e fvs sf Dtm(  ;o4optoif3iysfm2eluvo t0trxoxr3iodom  lu ol()trtr(mpno1llte nes t aDta(mpno0tex  f3iadfm um( o;u)arxrircoo1opDr i sl( texr(r3nydameelfesat sDurxr oo1apt  ictltfaDum(vo u) rxomociydop  au o;( s2tmxo oodlltn ncs s s2urxm ;u1aeenif3tydfa ulnvo (4teenifcoo1fa ranvs;t texoir3nu4ol  lfci t sDurxm nu1tleoif3tytlmDem(von()texrircoydlmtelnvo ( texmxopnudll n net sfa2uaur ;o0alenmo3tlsfmDeluvs t0alenio todfpD  nvs t)srtmxo iy4ap nmfvtat sDtrxrono0tetnmo3iat mDuluvo;u0arxrxrcia1late ivi t sruoxopiu1ameemiesatf 2rr(r ou4tleoioetldfm2elnmpn()trtomf3oa1fa r uvslt)truoxr3nydalenmicta(f Draxmo;u0olto fciytlmDemumo (4 exrmf totopD  nvsls) rxmio3ny1opeemfcilt srtmxmpot4tle mf3iydfmDemums;(0 lxrif iodlp eanvi s) exo(m3iu1ome mfcta() 2tmxrp;t1olt if3tas aDuan pnu4 exrircoa1oa rli o s srumxopou1lpe  fetat)srur( o;u1opt  ocilsfm rm( pnt0trxoiociydoa elu o t) 2trio oo4am  mfci t  rtau ooo1tlxomoeiatls raums;t0 exomo3oydfmDrlneolt)s2xm(m3nu1amtelieia(fsrrmxm nt4opt  oeiyslaDranvs u4altomrctydoa  aueo (0srxoxr no4lm nlict (  2tmxmp;u1aet  i3iaslaDuluvp (0 renmr iatfp   uei;t0teuo(rpoy4amtnmivta(  2rr(  oo4tex  o3tad mDea(von(0teeomrciy1omt lu i t  ruo(r iu1lltn nvt s  2rauroot4aeenmfctys s uanmo;(4tltnmoctydlaDr n i;s0 2uo(m oy1ap e nvs tf 2tru p;t4aetoii3ilsls raums;u) exnif3oodom ranes;(0 2um(o3io4ll  mfvtl( sDrmur ;u4olxnioeildlaDulu s t4alxniocta1omtelu slt srum(opnu1lp  lnes tfsDurx  ;u4tetn ictadfs rmu pnu)aetnifciydfpt lu o t0srur(r nudape  ietas)aDtrxr no4olx iiciltfaDemnvo u4 lxrxr tytlaDr i sls0srtmxmpno4olen nviat)s2rru  ;u1tex io3tadla uauvo t0tltnmf3tatla raivi;t srxmir3oudll   ietlt a2rr( pot1oexomi3iaslmDemnvonu0 etnxo3oydfaD  n i s0sruoio3oo4lltn feiat) rtr( ont0apeo icilt s eauvp u4arxnif3iodfp   nvo;()trtmio3ny4ome micsltf rta( ono1tlt  f3tadlm uauvp (0tlxoxocoadoat au i;s)sexoxo nu1op  mnct s a2um(rpot4aeeomfcils s emnvp;(0aeermfciatfmDrluvi t0 2xo(r nu1ameelfeta(fs2rm(rpnu0tpt mieildfm2umnvp;t)trtnirctytlaDran o t) rxr(m3ny4amtnlnvs t sDumx o;o0ale ifeiyt s2eanms;(0 lxrxo3iy1lp  lues;t  2urxopiu1lp eliviltf Drmuro;u4tle miciadlsDemuvp () rxnif3ootlaDean sls0texmxo nu4olt  nviasf 2trumpou1tptoifciyt m umnms;t0trerir3oadlm rluvi;s  2tmio3oy4lme  ivsas sDtau  ;o1aet  o3iyt s rm(msnt)altnif3ia1lm raivols)setm(m oudaltemncsatf Dtaump;o1tleo i3iysfm uauvpnt) rxoxo3todoaDraieil() 2xoio3io4oltelnvtls srtmuroou1opxnio3ils s2uluvo t0aetrmo iy1opDeauesl()s2uoxr iu1lptnmicta(fa2tmx pot0tpxnio3tlsfaDumu p;() lxnxr to1om r u o s0tetr(m nu1lme  nvils) rrau pnt4altoif3ilsfsDrm(vs;u) exrmocoy1laDeluvs t srtoir3nu4omenmneiat)arur(rpou4tptniietydfsDulu s u4 exnmr3iy1lpDr neslt0tetoxm3oo4ol nlncil( sDua(root0apxo fciys mDrauvo t0 leoxf tatfpte ieo;(0 rxm(o iydlltn ivia(  2tmu  nu0olx  fciyslmDelnmsn(0aeermfcoytlmtrluvi t)t2uriopnu4am emnctasfsDumxrpnt4alto i3iaslm emumpn(0texomr3oa1faD anes ()t2umxrpnudoptelfes sfarraumono4alt moetyd m ean pnt4trxrirciadomtr neol(  rxo(r3iydlpen ivt t sDrmx o;u0aleomi3ilsfm2rmu s;()aleoxf iotlaDeai sls0 ruoir3iodamtn fvsls sDraump;t4alenio3iytfs2eauvs u4aetomocio1lmte n s (0texr(opno4lpee nei ()s2trxmpnu4tetoifcild s2rm(mont0 lxnif iodfp raneil()s2xrxrpoy1olenmivs tfsrrm(mpnu4aexo fctys sDeaums (0tlerxr ta1fp rauvo t t2xm(o3oo4amt  ieta( artaxront1oexomo3iysls rln o t4 exoxo oadlptrau o;(  2tmim iu1lm  mnvtl( srrru p;u4olt mfeiytfa rl( o;t0treomr3iytfmDr ieo;s0trtoirpio1lm emncias  2rmu p;o0aetn ieiadlm ea(mp;t4 etrmf oadlpDrluvo s srtm(mpiodll emnvta( a2tm( oot1olxoioetyd a2ua(vpnt0aeermrctadfa  livi s) euo(opoydaleemfeias  Dumxrp;u0aptomieiatls umnmo t) etrmf3io1laDran o;(0 2urxmpiydol nmnci t aDraxmonu4apxnmfetat m rlnmp;u0alxnircio1opteauvils) 2xoio3nodaptn neta()arraxr no4tpe iictasfa2uau snu0trenmrcoy1fpD ln ols0trxrio3ny1aleelfctat arurxm ot1tlxoiieilslm uanmp;t4trtrxo3tatlptr nvols)setmim no1open ieiasfsrtrumpnu4ope io3ildlsDeluvp;u4trxoxo ty1op r ieo (0srur(o oudaltnmivia() 2uau pot4altniociytfa ea( o;(0trxoifciy1om eluesls)seuo(m3no1optnmneia(fsDur(m nt1alt ii3iys mDrlumo;(0aeeoif oa1fp  aies s0t2umxopoy1alte ivi ()s2ra(rpoo0opeoiictltfs2ra(mpn(4 lxomocia1fmteau i t  rtrim nu1ol eliei t) 2urx oou4tpt mieiltlm2rmnvsnt)aleomrcoytlpt  neils)srurim io1altelnciatfsDtm( p;u0aptomf3iadfmDeanmsnt4trtniocia1la ranvo;t0teur(r io4openmncils)sDtmx pnt4tlxoif3iytfa rlnvs t)trxomo oadfaDr nvi s) ruo(r3ny1alte nci t)srrm(ro;u0oltn o3tysfm2uaumpn(0arerio oo1faDr ieslt setm(rpnudomtnlfcs tf Dta(r oo4aeenifeiadfs2ra( p t4alxrxo iodlatrai i;s) eumxm3nu4lpeemfes t) rurump;t0teenmf3iytla rl(vo;u)aetrmf3oadlp   iei t teuo(o oodlpen fcs s  2trxm ;u1openiiciydfaDeanvpn(4 rxomfctadlp  aiesl()trxoxm oo1lmtn nei s)sDrru  ;u0apxoioeiad aDul( s u0aetnxfcootomD ln sl( truoir oudam e fvsa()arrrum ;u1tpenio3iatfa2eauvs (0 eeomfciodlpDeauesl(0s2xr(rpoo1olen iet tfsrrrx o;o4aetn i3tldfa2umnms;(4 rxnif oydlm   nvilt0trum(r3oo4aptelieta()aDurxrpnu0altnif3ias a elu p;u4 exriocoy1lpt aneo s0t2um(r3iy4alt  fvi t)a2ta( o;u0oee mfeias s2rau on(4tlenif3to1fatr nvols)srxr(m iy1ole  fviatf 2tr( o;u4tlxnio3iydlsDua( p u0trtoxo3iydlpt  nes;(0 2um(m ny1omt  fvtl(fs2rm(mpoo4olxomietldfa ulump;t4tltnmocoadfp e u i;s)texmiopoy4am nlfetat  Drmx onu4oexnmi3iydls2rluvonu0arenirctydomtrauvs;s t2umxo ny4ll  mfvtasfs2ua(rpno4olx io3ilslsDumuvs;u0 reoir tadfatelu s s  2tm(rpny4lptelfet t aDtmuronu0alt iiciytfm umums (0tlxrmr3oatfate nvo;( sexoim no1amtn ncsat sDtmumono1apt mfeilsfm rl(monu4 etrio ty1om rlueo ()teurxr3no1optn ieta( a2ur( pno4olx  fciysfa2eanvp (0tetomr ootfatr ueo t seuoxo ou1omt  ietls) rua(moot1opt mfcilsfmDel(mo u0aetomfcty1opDran i;s) eum(opno1lmt mnvtltf rraxm nu1oetnmoctadla2rmn p ()tltrio3tydfm rli i;( sexo(rpnu4llte icsat) 2umuroot1opx  ictlt sDumnmo ()trxoxr todfmtrln ols0 eumxo io4op elicsl(faDtr(rpnt1tex  f3tatlm2rmumsnt0alxoxf tytfaD aues;t seuoir nudlme  netls aDumx  oo1tee  fciydlsDelumo t4altrmo ootfa  auvol()t2xoimpoo4ale mies (fa2ua( pnt4apt if3tyd s el( o () etrmfciatoa rauvsl()t2toxo iodlltelfeslsfs2rm(mp;u0optoiieiydlm2eanmon()trenxfciadfaD  u o;t trto(rpnodlpt  icsl( arrru pot0ope  f3ilsla el(mp;t)tlenmrciadopDean o ( s2tr(mpnu4omtemnei tf 2urxmo;o4oeeomoeiadlaDulu o;u0aeeoxf3iydoatrluesls0 eum(r nydlpte feia() Drr(mpou0aetn ieiyt aDea(vp;() rtoxr ty1fp  livi t)srxrirpny1ame  nvtatf rra(root0alx mi3iydfa rl(vo (4 eenxr todfatrlnesls0sexmiopio4lmeelivsat)a2rr(m ou0tlxo f3tasfsDrmn s;t0trxomfcoytop r u ol() 2xo(o io1om nmictlt)a2umum oo0aet  octytlaDuan p u0areoir3iydlmteanvils)sexmim3nu4ale  nvtltf rtmur ou0olt ifcildfaDea(vp t) ltrmfctotfp  ai s;s  rxo(m3oodapeelnei tfaDrmumpno0teen oetldfm2rlnms () reoxrcia1fa   ivi;( t2uoim3ou4om emivsa(farrmuroot0tpxn f3iltfm uauvp (4aeenmf3totopteanvs (  euoir nydaltn ivsas) 2um(rpnu4oet ifeiysfmDra( p;u0arenmo iytfp ran o () eurxm3oudlmte nct ( s2ra(rpno4openioeiysfs2ea(vpn(0alermf ia1fmDe uvilt sexrio3nydal  mivi sfaDuru  oo1alenifetls a rm(msnu0 eeomfcty1omteliei s)t2trxrpny4lltn fesa( arta(r ;o0tetn ieild m rmnvo (0areomf tytlmte ivi t) 2tmxopoo4llt lfetltf 2um(  ot0alx mfctytfm2ranvsnu)trtrir oydfmD lu il(0texmxr oodam n fvi s arurx poo4opxoif3tysfa2el(vs;(0tlxnmr3ta1opDeaues;t  2xm(m nodom nmivt sfsrumxmpno1optnmiciaslm elnvp (0 rerirctodlaD  n i;t0s2xmir nodam   ivtlt)srtauro;o1opeoif3iytlaDul( pnu)aetrif todlmDe i s s0srtmxr iu1lpeemfes tfs2um( poo0aeenmociytla2elu sn(4 exnio3oy1lmDrlieo (  2xm(r oo1ol   ieil(fsDtrxr no1opxomoctasls2rm( o u4arxnio totoatr u s ()texoxopiodoleeliviasfarur(mp;o4opx miciatfs eanms;(0trxoxo3iodfp rlu s ()sexmio io1lme liesls)srrmurpnu1oeto o3ilsla2rau pnt0 renio oy1lpteliei;( t2umxr no4omt  ics t)s2uaum nt0oleo oetldfm umnvo (0trxnmr3todlpDeanesls) exr(o3iy1op   nvias  2rm(r ;t1oetn f3ilt a el(vp;u0 reoif3ia1fa  anvsls  rxrio nydlpenmfvs t)a2uru  ;u4oleoioctadfmDulu p;()aeermrctotfptraieilt0 etm(mpiy4omtn neia() 2tm(roou4aetn oetydfa2rlumo;()alxoif oadfat  ues (  rtrxr3ny4openlfcs t)artr(m ou4tpxnmo3iasfa2uan snt)tleriocoydomtr i sl() 2xmxm nudoleemnvtasfaDtr(  nu0oeeomietltlm ul( s;(0altnircoodoa rli olt)srxmim oodome lnet t)sDur(mp;o1texnioeiydfa emums u0arenio3oatomDr uvsls0sruo(o nydapt miet (faDur( o;u0tpxnmi3iad s um( o;t4 eenmf3totlm  ln ol(0srur(m iu4optelfctltfarrm(rooo1tptnmiciltlm rlums u)aeermf3iytoa   n i;s)trurxo io1ole lieil( a2rmu pot0teto f3tys mDumn o (0tltnif3ta1lmD anes;t) eto(o3iu4ope lfcs (fartax pot0alx ioeilt a2emumon(0 eeoircoadfpt  uvi t)t2tmir ou4lme  neta(fs2umxmono1tlt  fciaslm2rlumo u)tleoxrcoydfat auvo s  ruo(o3nu4lpe  fetas)a2umx p;o0apx iiciatfa eanvpnt0trtniociotlmD  i s;s0 ruoio3nu1omenlics tf rum(m ;t4opeomf3iys sDemn onu) rxrxfciy1fmDr u s;s teur(mpiy1lptelfeia(fsrurump;o0oee  fciltlmDem( o t4tlxoioctadoa  livi s)setm(m ny4ole lnvsatfa2ra(r ou0tpe mociytlsDumn s t) etomo iotfp   ueo;(0truo(opoydlpe  ivi (fa2tmxmo;u0tpxn i3ilsfa rl(mp;u4tlxrmf io1fpteaieils  exmxr no1lmt mfesa() 2raur no1aee moetat m2um(mpnt)tlxnxr io1om r uvsl(0trurxmpno4olt lieiatfaDua(m nt1tpxomociyt a emump;u) leoxr oytfp r nvsls0 2xoirpiudom elietatfs2rax  ;u4ole  o3tytfmDelu s t0altrif iodfpte ivil( s2xoxopoy4llte fvi s) rtr(ro;u0oltomf3ild sDrlnmon() ltrir3oo1omDeln s t  rxrimpnu4amtemnvilt aDtm(mpnu4olx io3iatfa ua(msn(4trtrif3iydfpDe uei s0trxr(opoo1olt  netlsfa2urxrpno1tpto ociatfs rluvs;u0altrmo3iatfpD  nes;(0 2tr(m nodapt mnesas  Drmu p;t4alx ioeild s rmump;(0 etoio3oadlpDelivil()srurio nu4alenmneta( s2tm( ono4texn ieias m umnvp;() eeomrcta1omtelivi (  exoxo3ny1ame lfvta(  rtau ono1apen ietydlm uluvp ()tlxomr io1lp ean s ()texrxmpno1om   nviltf Duau ooo4olt mictadlsDuaumo;u0arxnir oytlat livs t0 2toxo nudom n nvs () Duaumpno0texomi3ils sDrl(vp;u4alenio oytfat lneo;s s2toxopio4omtelfesa(  Dtmx p;u1oetn feiysfmDrluvp;()tleoifcty1lpD  nesls) ruoimpno1optnmiesat) 2rmxrp;t1tpxo feiasfm2ea(vo;(0aleomf3io1fpte n i t  etrimpiy4alen ieils) Drax pno4alen ociatla rmuvo u4teeoircta1lpt  ieo;s  2uriopnydap emfvil(f 2taxm ou0alxoifctys m2el( on(4trxnmf3iatlp rai sl( t2tmxopio4omenmiet s a2rmump;o1oleoifcildlsDran p;u4tlerxr to1lp eli ils t2uoir3ou4am nmfei ()a2trxr no1apeo o3tasfm emumsnt4tetrmo3tatlp r ieslt0s2ur(o nydam nlivtl()artrum no1tptn oeiltlaDelnvp;u4trxoxrctadoptelu slt0teto(rpoy1op   fvta(faDtrum ot0apx iictltfmDrl(vont4 lxrxf3iytfmD lies t0sexr(r iy1op emivt t srtrxmoou4oeeo oetysls rmums;u) rxoxr3io1oatelnvil(0 2tm(m3oudlpee iet () rtrx o;u1oleoioetlt aDeau o u4aexnxf oadlp  ai i s0trtoxo no1lp n ici ()sDuaump;o1tpen feilsfm2rmnmsn(0altnio ootlaD  uei ( t2tmim oo4optn fvils)a2umx  nu0tleo f3tldls2em( p;t4trxrxf iodfmt  u ol(0s2urir3nu4lptnmfes tfsrraxrono4teeniieiydlm umuvp;() etrmf3iytfmD aieo s)seuoir3ny1amtnmfcs t) rtaxr ot0tle  iciysla eanmp (4aetomf iadoaDeaueslt)s2trxmpiy1llt  ietl()artr( p;o0apeo ocilt a em( p;t4alxrxf iydfmt aieolt) eur(m oydopeemncsl(faDtm(m nt0tlxo ieiytlmDulumo t)aeeoxociatlmt  nvs;t tetmiopoy1ll n nvtat) rtaxm nu1alxo iciyslaDel(mont)arenif oatomDelnei t0 2xmxm3iydapte netltf 2ta(rp;t1alx iieiydls ea(mp;t) exoxf io1optelies;() exm(o3iu1ole lfct (f rraxm ;t1apx  fcilsfa umn p;t4aeerir iodfp  lu s;(  rxr(o3iydole miet sfs2umu  oo4aptn f3iltfa2um( o t4alenioctydfpD  iei;t teum(r iu4open nesasfaDrrxro;u1alen feiadlm rmn o u0 ltoxfcoy1lm eaivils0s2uo(m ny4olt mfvil()s2taxront1opxn feiasla2rl( s t0arxrir3iy1laD  ieslt)truoxr3ou4lle mfci s aDrmx pnu4aetoio3iasfm2eauvont0trxrxrctodoaDran s;t  exoirpoo1ole  ncs t aDtm(root1alxnmo3iadfs2eauvp u) ltrxf3oo1opDe neslt0trtmim3iydlp nlicils) Dtmx p;t1tpenmfeiltfsDrmnmon(4tltrmo totfaDeluvol() rxrim ou1am  lncilt a2taumonu0aetn f3iyslaDua(mpnu0altnif tatlm  ln i;s  2xmir3iodal  lfeslsf 2ta(rpou4oex  ietydfmDra(vo;t4teeniociotfmDraues t)tetr(o3iy4optnlnei ( a2taxm ot1teeomoeiad m umu s u0trtoxr3totlmt  uvo;(0 2uoirpnu4lptn neiasfsDra(m ;o1opt  ociadls rau p t0artnmo3iydoaDeln sls0srxmxopiodopen fct (fsDumxmo;u1tlt  o3tatlaDelnvs () ltoxrcoydop  luvo;(0trtrim oy1openmncta(fa2umx oot0oetnioeiys m em( p (4arxrmf oa1lm  auvs;()srxriopno1opt  fvi (  Dta(rpnt0olxoiieiad m rmnmp;(4 rxnmo3iytlptean olt)tetrirpoodapte ici (fs2ur(rooo1tet  ietltls2umn ont) lxnmo3to1laD  ivi s t2tm(mpnu1op emivilt)s2um(rooo4alxnmoeildls ul(vpnt0tlxnmo3iadfat aivi;t0seur(m ou4am n icsas) 2tr(ro;t0ape mf3tyd s eanvp;u4aeeoio oodom   ivi;(0seum(m3nudop elfesas) 2rrxrpno0opx io3iltfm2rmn pnt)trtnircoatoaD aueo (  rumim io4omeelfvia(farrmxmpno1aetomiciydla emnmp u4artnircta1fatrlivi t seur(m3nu1al  lietat)s2tmxmooo4tptomieiydfa2ulums;t4teenxr3todfp ran ols0s2toir iu4llt  fes s) Dum( onu1apxnifetlt m rm(ms;(4 eerxf oy1lpt  nvo t) rurxo3iy1lpe  fvsl() 2urumo;u1tlenmfeiytfmDeln o (4teeoioctadlatean o (0s2trim3oy4om  mivt sfarra(mp;o4optnmi3tytla emums;u0aexnxociodlp eai olt)s2tm(o3iy1ol  lfvias sDrmxro;u0tpeoioeiadlsDemu pnt4aeerxrcia1lm rai ols srumir3iodoleemnvtas)arrr(moou4tptnioeiyd m2uau p t0tlxoxo tytlptrliei;s0t2xm(o3ny1ame  nvilsfsDra(mpnt1aptomo3ilt s ranmo t)aetniocta1op eauvi;()trtoxopnodlptnlivsa(  2taur ;t0oeeomictld a2ea(mp u)arerxr3oadfmD anvols)s2to(rpoy1ape lnct tf rrmurpot0tetn ociyd aDrm(vs u4aexnio to1lmDraivo;t0 rxrirpiudlm elicias)srtmurp;o1tltn f3tldla2elums;(0tetrxfctadoa r u i t0t2to(opiydomtnmfvtatf 2rrx o;u4teeoifeiatfa elnmo t0artoxoctadfa  aieolt)trtmim ou4apenlncs t aDrmu  nu0aex  ieiat aDul(mpnu)altnio io1optrauvs;s)trtr(opiodlm elfvi tfs2rrx p;u0alxnif3tldlm2ulnvo u0tltnxrctatlm eanes t0 eumio nydopt mictls a2rr(rono1oexoifeildfa2rmn onu)trtrxr3iydlmDelnvo (0srtm(r iodome mictls) rrmumpoo4apeomoeiasla uanmsnt0trxrir3todfaDr neols)seum(o3nudomenmnctat) rra(  no1aptomf3tytfmDran o;u) exomr3tadfmD aneolt s2urir3nu1lpte fcs s)sDum(r nt4oleo feiydfs ra(mon(4aleomf ty1oaD  n s s) rxo(rpnodlpt  fvtatfaDua( pou1opt mieiytlm uanmo;t) leomrcoydoaDrauvs s  rxmxo3ny1al nmneiasfsDurxrpnt4tlen fetls m em(mo u0 eenifcoydopt aies;()tetoir iydll e nesa()srtm( o;o0ale  oeiysfsDumump (0tetnmrcoytfpD lneolt tetrio no1aptnlfci sfaDtrxm ;u1tpx  i3iaslmDuanmo t4tltrmf oatfp eaivs;(0t2um(r3io4lmtnlietas)s2ta(  ;o0alx  f3iat a2rm( p;() rxrmf3oy1fmt aivols s2urirpio1ol n fes t) 2raxr oo0tltnii3tad m umuvs t0texrxocio1omtr ieo;t  2xoxrpnu1om nlnesasfsrrrxm nt0apx  ociat m ea(vs t0tetomfcoo1fp   neo;s  2xoim3nodol emiei ( s2rr(rpot1texo fciat mDrauvp (4aexrxf iotlpteln s t)t2umirpiydamen ietlt artrurpou1aptnii3ilslaDul( pnt0aexrmf3iy1lpDelieil(0setoim3oodlm emfeias)aDta(moot1aeeo fctlsfmDrl( onu0 rxomo3tytopD au ols)srxoimpoo4lltemnvs t) rumumont1ole mieias mDrl(vp u)trtrxf3tytopD lueo s  2xmim ou1op nmfes (fs2tmxroot1tex ii3ias s2ra(vp () rxrio tytoat  uvi ( seuoio3oodlltn icsat) 2urur ;u1alt if3ias mDem(vpnu0aetoxocoy1fmDeanes;s s2uoxmpoy4omeelicsa(  Dum(rp;u4aleo oeiyd a2uanvs;(0 lxoxr iydoaD anvil( trtoxr iu1lpeelfvs ()arrau  ;o0tpe  ociadfm ranmp;t0 lxomrciytlmtr uesl(0srxr(rpiu4al   iei s) rtau  ;u0oexo ietyd a2ulnvp;t0tlxnif3tadopDeln o s
\ No newline at end of file
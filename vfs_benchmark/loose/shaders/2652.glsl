@@ -0,0 +1 @@
+ivs t0trxr(o ou1omt  iesasfaDua(mpno0texo feilt a2umnvp;(4 etoif tadopDeliesl() 2tmiopiudap nmics s sDtr(mpot0tpeo i3iltfm2umnvon()trxoif3iytfpDe nei t)trurio3oy4ole mivil( arumuro;o4aleomfetltfs emuvo;t) exomo iatomteluvi;s teto(m3oy4ame lnes tf 2rr(m nt1alx  i3tysfs uanvp;u)alxnxo tatfmteanvol(0t2um(mpoudllen fetas) 2rr(mo;o0tlx iietltfsDrm( p t)tlenmoctadlatelivs t0 2xmiopiudlp e fvilsf rurur ;o1aexo iciadfm uln o ()artnifcta1oa eauvsls0 2xrxo3io1lm  livi (f 2rm( ono1alxn i3ilslmDranmp;t4 etomf3ty1laDraieslt0 2tm(r3iudol n ics (faDuaxm ou1oexniieias s umump;()tetrmfciytop elneols0tetoxr3nu4amtn netat)sDrmu  ou0opt  fctyt a2eau ont)teeoxf3todopte uvi (  eum(r3nudlptnmnvt s aDtmumo;t0opxnmf3iadla elu s ()trxoxo iodlpteanei;t0 2xm(o nydamt lnvil( a2taur ;u4aexn ietydfs ea( s;u0 ltomo3totfpteliei s)srtm(rpnydamt mfetls aDraum ;o4aetnmi3iydls rl( s;(4tetrioctadopt  neols  exoio3io4al   fct (fsDtax pou0alx iocildlm2eaump;(4 reomf tatfa eluvsls0t2uoim3iy1omt  icsa(fs2rrxm oo0teenmfciatlmDem( s u) etrxo3iatoptrlivo;( t2tr(rpio4ale  nvsls) Duru pou1tet iiciltfsDul(vs t4tetnmo3oodop eluvi t  etmxm3io4oltelfcslt aDrm( pnu0apeniociat aDuanmp;() eeomo oytopDeauvi (0trxoim3oo4amte fvtatf 2ra(r oo4oee mfeiad s eln o;u0artrif ty1lpteau o ()s2xoim3oy1alenlncs t srua( p;o0opx  f3iat sDelu on(4 eeoioctatoaD anvsl(0 2uoxr iy4op  lnci t) Dtr(mpou4aet mictad a2ul(ms u) rxnifcoadfp  ai o ()teurxopoodamenmneta(fsDtmx o;o0opxn octasla uaums u4trtoif3ia1fmt livo;t) exoir3nudopee ici t) Drmu pnu4tpxn f3tls m2ul( s;t0 etoxf3iotlp  aneols srum(o3oo4lpe mfeslt sruaxro;t1ope moctydfs eaumpn(4 rxomr to1oate i olt texrimpnudlmt livi s aDrmump;o4opeo f3iys s el( s u)trtrxocio1oatr ueil(  2tr(r3oy4lpt lfvi s)srta(m ;o1opt mfeiltlmDem( s t)artoif3ootlmDe ivo s)t2tmio nu4oltemfvt ()sruaxm ;t1oexo f3iytfa2rl( p u0tlenxf oy1la r i o;t  2xo(m iy4al   fei s  Dtmxm ;u1tle ioeiyt a eln snu0tetomf to1fptrau o (0s2tmxo iy4lp   fctltfsDtm(  oo0teto oetlslsDuan s;(0 ltoifcta1faDrlnei s) rtoxo iy4apte ietas sruaurooo4apenmo3iaslaDrl(mo;t) etrio3tatfpt  neo ( srum(m oudlmt  ies (farrmum ou4tetnif3tldfa2uaumpnu0 exnxfciydfmt  nes t0s2xmim3nudole lfcsas  Duau o;t0teeomi3tytla eanmo;(4 etrxf oy1op  aueol(0seurxm3no1apt livils artm( o;o4oee if3ias a2ra( onu0 eermr3totfa  anes;( setoimpny4ol elicslt  Drr(rpnt4oltnii3iytlm2rau pn() eeriocta1om rlnvsl(  euoxmpiy4llenlnviasfsrua(mp;u1aeen ictyslm2ulu p ()trtoirciydlpte u ilt  2urxr iudal emfcsatf 2rr( pno0alto fctlslm umnvs t0artnxocoadoatrln o;t0 2to(r oydop e nvi (f 2raurono0olx iieildfs2rmu s;u4 rerxfciatfate uvi ()trxo(m3nu4amtnlnvi s  rrr( ont1tlx iiciysls2rmuvpnt) etrxf tadoaD  uvo;( teuoxr ou4amtelfcil()aDrau pnt4tltn i3ias sDeaums;()aleoir iotfp rlues;t) rxrio3nu4omt mneia( a2taur ;u4tee mi3ild m2ea(mo (0 etoxo to1op eanvs s  etoxm3iy1olte fctls) rtru p;u4opt mf3tat aDrmumo u4aeermf tydomtrlneo;t)s2xoxm3no4lp emnei s srrmxrpnu0ape mfetydls2rm(vp;u) ltrxr oydoat  nvsl(0srxrxm3oy4al   iei (f 2rr(mp;u4olt mieiydlmDea( ont0 lenmfcoo1oaD an i s) rxrxr ny1opeelncsa( srrmurpou1tlen icilsfs2rmu o u4 lenioctodoaD li o t s2xrir iy1amenmncils)aDrmx  ;t4olxo iciydfm2ulnmo;t4tetrmoctytoa rlnvs;t)srumxr ny4lle  fei sfs2urx ooo0oltomfcildla2el(vs (4 rtnxo io1lp  au slt0 2toxo no1lp  lnes s)arrrumpot0texoio3iyslsDuanvo;t0tltomr3oodlm r u s;t s2tm(mpiu1lp nlfctl(f 2ua(  ;o4texoioeiltfaDeau onu4alxnmr3tatfp ran o;t0s2xoim oydomenlfcils aDtmxmp;o4apt  ociydla ea(vpnt0aeenmo3totfm rlieils0s2xr(opoudal emictls)a2trum ;u1tee miciytfa2eluvo t) lxnifciadfmDean ils  rurim3ny4ol n nesltfsrrauro;o0opt mo3iys s em(mpn(4arxnxr3tydlmDe ieo;(0 rxrio3ou1alt licsl(faDrm(r oo1teeomociasfs uan s;u4arxrmr tytopDe u o;s0tetmim nu4lmt lfci ()arraxrpnt4oee  i3ildfa2rmnmp;(4 lxnxo iadlpt li s s  2xr(o3oodal n nviatfs2tax o;o0aexnmoeiyt aDumn s;t)tlxrif3iotfmDr uei;(0texr(rpoo1amtemnesl(fa2raump;t1tptnmfctad m rl(vsn(0aexrmfciydoptr n i ( sexmxrpiodom nlnvias)s2umu pno1oetnmoctysfm2ea( p t0aetoxo to1lat livils trtmir iu4apte fcsa()arumxroot0texoiietadlaDrlu p t0 rtrif iotlm e uvo t teuoirpoo4am nmfci s srrmur ot4oet iieilslmDrmnvs;t)tlermr3iydfm e uvs;s) rtmirpoudome mncia(  2rrxm no4texnmieilt a ulnvs;t4 rxnmo tatoa eliei;t)trtmxrpiydlme lfetls)s2trur ;u0opxnmfctlsfm rau p;u0tltoxocoa1fpD au il(0s2xmxmpiydlltelies tf ruaumpot1oetnif3iydlsDemn pnt0 rtnxr to1lmtraues;s)seumirpiydopenmfes s) Dtmx  ;o0aeeomoctydfmDraumsnt4arxnif3totfmt  nes;t0trumxo3iu1ap e nvs s) Dtrur ;u0opx mi3iat s ua( o u4teermfcoydomDeluvil(  eumim3oo4ap  lnvslt)artrxrono4tpto fetys a2eln s u4arxrmfcoytomt lu o (0teto(rpoy1lle lnesls) Dur( o;o1ope ioetysfs2um(vsnt0tetnxr oydfa  auei;t trxoxo nu4alenlfvsls aDtrurp;u0ale mf3tyd m2em(vo;()teeomrctotfptraues s) 2xrxr iudlm emiviat) Dtrurpou4olto icils s2rau o;(4treoxociodoaD  u o t tetoio3iy1lpt lfvta( arumu oou1oleomf3tydla elu p t0aetomr3oy1faDr i o;t) 2umio3oo1lmtn ietatfs2um(r nt0oetnmictldfsDrlnvs (4artnif ta1fmtrai i;( seto(o iy1amee fvilt)a2rm(mpot4apenifeiys a rau p;(0teerircoo1om e u i;t0t2tr(opiy4olenlncta(fsruaxmoot1tetomiciytfs2el( p (4aeerxocoatfateauvslt  rxoxo no1amen ncsas  rrmxrpoo1tpenioetys sDrm( p;u4 lerxocty1opDe i il(  2to(m3oo1amt  fvt tfaDuaxroou0oeeoii3iyd a em( s (4 rtrio3ty1oaD an i s s2urxr iy1llt lfvia(fa2rmxrp;o4aex  fciydfs2em(vp;(0arermr ia1om  lieo;t0 rtmxr oo1om  lnesat srrr(monu0apen feiatfaDeanmo u)trxnxf oydlpteanvo;s)s2tmxm3nudam  mfvslt srtru  ou0oetoioetas a2eluvp ()treoio3ootlm  an ol()trxmio oydalenmivtat)sDumxmpoo0tpxnmoctyd sDumnmsnu)teeoirciydfat  u i t seum(m ny4lpe  nesa() rtm( pou0oltomoctysfa rm(mpnu)tltrxrciydlp elu o (0setm(rpoodlp nlicta(  2rru  ;o1oltomfciydfm2rlu p;(4tlenifciydom r uvs;t0trtrirpoodomt  ivtat) Dururpou0oex mo3iydfsDuanmon(4areomf3iadfpDelnes s0t2trirpnu1llt mnes ()sDraum ;t1oetnif3ildfs2um(vo () ltnio totlmte n i s  rxrxmpiu1amtnmncsltf rurumont1oee iiciyd s ua( p t0 rerirctatlatrau s t seuoimpny1ap elnvi t arraxr oo0opxn fctydls2rln s t4tetomf tydlptr nvo;t) etoir io4om   ncils s2trurp;t0tleoii3iad s2uanvp;(4 lxnmr oatlateau ils texo(m3nudoltn nct tf Duaxm ;t0aeeoii3iat a2rm(vo;t0aexnxrctytla elivo s)setoio3io4lmtnlnvtl(f 2trur ;u0tetnmo3tadlsDeluvpnu4tltrxf3oadomte nvi ( s2urxmpnodopeemfetatf 2ua(m oo0tleo feiyt a rauvp ()arxnio3iotoaDeaivi;(0 exmir3iu4apenlfesa()s2ta(rpot0tpx miciatla2emnmp (4teenmfciy1la rln s;t0 rtmim oydamtn fetltfsDuax  ot1olenii3iys mDea( o (0altoxr3ootom eaieo;s0trtoxm iydap   fet t a2taxm nu4aeenmi3tys s uan sn(4 rxrxfctytom  lnei;() 2umxr ou4op n ivi (  2tmu pnt0ope io3tyt m2ulnmp u4 etrmrctatopt  nvo;(0sruoim3iydolt mfci ( arrmurpnu1tpx mi3iltfsDul( o;t0tlxomo3iatfa rln sl()t2xoiopnodll e fctas)a2urxmp;u0olxomfeiadls2umuvp;t) rxomrcoatomt aueo;s s2xo(m io1ol  lfvsls a2rmx poo1oex mi3ils s2elnvs u0aeeoir oatfaDrlnvolt setrimpoodomtnmivslt  2ua(r nt0oeenif3ild mDrlump;u0tetnif3oy1om elivsl(0 2tmxm3io4ol nliet s)s2rr(  ;o1tpe iicils mDumnvs;(4 rxnmociydfpDeluei;t texr(m3nodalt  fetls)srururpnt1tetn oeild a ran s;(4 rxnxr todlaDeanvi;t0srxrxrpiydll  lnctls arum(mono4opxoifeiyt s2ulnvp t)tetnmr oydopD  nes;( trurimpno4olt  fesltfaDraxm no1tpt mfeiat s2ulump u4tetnxr totlm   ueo;t)setm(m3oydole  fvsatf Drau poo4aex ifetls s um(ms;t0aetnxf3todop elueils) euo(mpnodlme lnesl(f 2ta(root1alxomociad aDul(vs u4 leomo3oodfpt  neo;()s2xo(r3iu1lpe lnci (faDum(mp;u1tetoioctatfsDemnvp;t4alxrmrciotlmt  neo;s)s2uoirpoo4lleemivias s2tr(mpnt0opeoiictatfs emnvs t) rtniocoodoa e ivo t t2um(m nodlmeelivi (fsDta(  ;t1opxnmoeilsfm um(vpnt4aetrmr3ty1oa ean i s  2xrimpou1ap   ivs tf Dtmxrp;t1tlxo octls aDelu pn()alxoir tadom eai ils0tetoxmpoo1opeelnei t)sDumu poo4alxniieildla rln s () renmfciadoa  auvs;s)seurxr no4alte ivi ( a2urx  no1apx  octas a2ulu o u0tltoifciotfat  iei;s)teum(o oodape  fvs t srrmur ;t4tlxnioetatlsDeanvp;u4tetoio iy1faD aneo;t0t2toxr iy1lmtnmfei (fa2uaxro;t0aet  fciadlsDelnmp;t0arxrir totlaDeauvslt0s2tr(o3nu1ol nmicsatf rum(mp;t4oetnifciaslm eaumsnu0 eerxr tydfa  luvo t)tetr(r3ny4ame mnvs tfartmuro;t1teeoiietyslsDuanmon(0areomfctydlatrau o;t) rxo(r iy4ame  fetl()s2trxro;u0ole  ieiyt a um(vp;(4tlenir3todlat  nei s)texrxo ny1omenmfvt t  2ra(  oo1texniieiasfs ea( o ()texoif tydlp e nesls)tetoim ou4ll   ivtasf Durx p;u0tex ifciadls2rm(vs u)aeeoif todfa eli i;t)setmir3ny1olenmicta() Dum(m ;u4ape  fctls a uluvo;u4 ltnmfctytlmDrauei;t)seto(m iudal emiet sfa2umxm ou0oex mfctys sDel(mo ()teermr ia1lm r i o;(  exoxr oo4lm n feslsfsDtmx  nu1olto ocildfa em(vpnt0teeomr3oa1fpte ies;t0t2tmirpoy4aptnlnet t  rumx oou0oeto octls a2rm(vont4 exrmo tydfat  neslt0 2tmir iu1omen netas  rtaxro;t0oexnmoeiydla eanvo;t0aleoxo3oadfat  neo;(0seur(o oudoltnmfcia( s2ta( ont0alxomoeiyslsDem( p u)arxoxr ty1op r nvi;() exo(opnydlm e fciat  Dumu pno0alt iictyd a elnvs u)arxnxo3iytopDrli i ( trxm(r iydam nlics s artr(mont1olxnio3iasfsDumump u4teeoir3todlaDr uvi t0t2xmxmpoo1lp emfctlt  2rrxr ot0tlenifeiydfa rmumo;t0 exnmf3oa1fp  lieo;s  rtrio3io4amt lieil() rra(  oo4tptn fcilt a ea(vont) rxnxociotlptr ies;t trxmxmpiy4altelfesas)a2umxrpoo0alxo ietlt a2umumo;u0aexrmr3iatlptraiesls0t2xoxopoydllt mies () Drr(rpnt4tpxniieils mDuan on() exnxr3iy1lat  ivol(0 rxoiopiodlpeelfvtat)srrm(rono0oex ifeiadla rm(msn(0trxrmf3io1lm   iei;s t2xmir nudol nmnetatf rtrx  ;t4oexomociaslaDrl( snt0 etrmo iydfm e u i s srxoirpnudame miciat)srrm( poo4tpeo oetasfsDumn s u4trxomoctodomtrlieo () 2uoxm ou4llee ivsl(  2rau  ;u0opeomoeiytfa rlnmp (4 reoxo3iodlm  aieolt0t2toio3nu4om e ieias)a2rr(  ;t0oex mfeiaslm2rl( p ()aetoxo oa1lp elivi;t)setrim oy1llt mict sfa2umxronu4ale  o3iadlsDua(vpn(4arxrioctodoaDelnvo ( texrxopou1apt lies ( aDtru p;t1tpe mi3iasfmDumnmsnt0alxnxoctatlmte i o s) 2umiopiudomt  fcsa(f Dua(ront1aptnmietasfaDrluvp;t0alxrmf totla ranei;s)trxoxm iu1ol  lietat a2ra(moou1olx mfetldfm umumpnu0trtnmrcio1la  ln sls)s2xmirpou4alen feta(fs2ta( oot4oetomi3tytlsDeauvp (4altomo oodfmteaueols0 etrxm iu4lptelnvia(f Duaxmpot0opt  ociasls ua(vpn()tetrirciy1faD  u s;t0 2xo(o3iu1om nmfet s)artax o;u4oeenifctatls2ua(msn(0trenmfciodlat ln i;( truoxm io4om  mictl(fa2trx pou1tet  f3iatfa ul( onu0alerxr3iytoatrau s s0 rurxr3oy1amtemictlt a2ra(  ot0aetomietys aDea(mon(4 exomoctodfptelivi;s) rtr(m3oy4alen nci sfa2rrxrp;o4alxoifetyslm2rm(mpnu)tetnmf3oytlaDraueolt)srxr(r3no4ome lnctlsf 2rrxmono1aeeoioeiltfa ul(vp (0tetrxrcio1lat luvo s)seum(rpio4ale mivs t)arururo;o4tex if3iys mDranms;t0 exnifctatlp r uvs () rto(m3no4opeelicilsf 2ra(m nt1aee mociltfs2rl( p t0aetrxr oodla  livols sruoxr oo1ale  ieiat srrmxrpou4aptnioeiltlmDrmnvo ()tltnmr ootfp e i ols  rxm(m3oo4lme mfetat  2ra(  ;t1tptomf3iaslm2rluvo;()trxnio ta1op  lieslt0seuriopnu1apt  nct sf Drru ont4opxnmoeiasfsDemu pn(0 lermf3oa1om r uvo;()seto(rpoudomeemfet tf rrr(m oo0oeeo ocilt m el(mp t0alxrxo iydfaDr ies;t)seumxr3nodapenlivia(  Drmumo;o0tltomi3iltls2ranvs t)trtoirctodomtraivi;s t2trirpou1optelivtls)sruau p;o0tltnio3iltfsDrm(vo;u0tetnmocty1oat aivol( trtmimpno4lpt lfeiat)s2rax oot4apxnmo3iadla2ea(vp;t4tltnxr3ty1lpD  n slt texrio3io4om e feil()srra(r nu4aptn fciatlmDua(von(4aetoxociatfmDraiei (  eurio3iu4altemicsa(  2rrxroot0teeo ietadfa ua(mo t0teerio oa1fmt  u s;(0texoim3nydopenmfvtl( a2tmxroot0oltoiieilsls el(ms;t4 lxoxo oadfp  lnvo s)s2xrxopiu1am nmietl( aDumu o;t0texnmiciydfs2ul(vo;(0aexnio ia1om   nvsl( texmxo3ny1ameemnesl( sDurumoou0oeeomoeiltfsDrl(mo;u4texrxf3ootlmD  i i;(0s2tmxopno1omeemfvsasf Dtmxrp;o4tleo o3ildfs rmumon(4aexoio tytfmtr nesl()srurxr oodal e nci ( a2rm(r no4optoioetatfsDrm( p t)aexnmo3oytfmt  n i;t0 2um(m ou1am nlnetltfa2rrump;u4apxo fcils mDem( p (4texnxfctydom r u il( trurxo iu1am emfeils) 2taxroou0aeenmoetyd sDulnmsnt4trtrif3tatlpDeaneslt0 ruriopou4ol   iet ()aDum(m ot1apxoiieiadlaDrln ont0 rerifctodoateln i;( teurxr3oy4ol nlivi s arrmuroot1oexo fcilsfs2umumo (0tltrmocoodfp rai sl() exmim iu1lp e ncs tfa2rm( p;u1tptnmfciat s2ea(vp t0 lerxo tatoa  aueilt) rtr(r3iodlmtelivsl() Duaxmpot0tetn f3tatls em(mo (4 lxoxrcty1fmt lieo;t trtrxopny4lpt mivtasfa2rrur ;t1olt mfciasfs rlumsn() rxrxociydfpteau o t  euoim nodapenlivi (fsDtm(  ;t0alx mieiad s ulnmon(0 etnmr3oodfmteanvs;t0sexmxm io1lpenlfei s) 2ra( p;u0tpe ioeiydlm rmu p;t4 lerio oo1opD  nvi;s)srur(mpoudopte ncs () Draxrpoo4teenioctyd mDuluvpnu4treniociy1laD anes;t seumim3oy4al  mnvt (  rraxm no4aee  fetaslm2um( snu0tltrio3oodlpt au o;s0sexrxopnodaltnlnviatf 2raumonu1opxoif3iyd s rmump t0arxnircoytfpt ai sls  etriopoo1ameemivsat)s2ta( poo1openmfeiydls rm(ms t4texoxrcoytfm eanvi s setrxm oydll elfctat)a2raxm ot0tpxomociysfm rauvo t4trxrxfciadfpt luei s s2toxm3ou1lmt miet tfaruaxr no1tle mo3iydfs2um(mpn()texrxfctotoa elieslt0 eum(r nu4ap  lfeiltf rur(ro;t4aleniiciydfs rlnms;t)treoxr3oy1laDr ieo;()sexoxr3oydameelnes t arrm(mpno4olxomoeiasfm2emuvp t0artoio ootfp e i s s)srxm(mpiu4omt  ict sfartmxmo;u1oex  f3iytfaDrl(mp t0tltoir oadfa elu sl()seum(opny1olte ncilsf Dur(r ou0altoioeilsfs2rlu p t)treoiocto1fm   ies;()setm(m3io4opeemncias s2raxrpno0alxnmoeiytfa2el(msnu4aeenmr3io1faDeluvslt)srurio iudlleemivt ()arrrxmpnt1tpx if3tadlm2eanmo;(0texnirctadomtr n i;(0tetoxopnu1om nlfvsat)aDrm( ont1aetomoctldfa uanvo;t0 rtomrcia1fpt an i;t)tetmxopny4lmtelfesl(f 2ta(  oo1oet  ieiydls2emnms;u4trxnmf3oadom   n ils  2xo(rpoy1om emietlsfsrur(rpot0aeeniiciat m rmums t)tltnif ootfpt livols srxrim3iudol nlfvi t  Dtmxm no4ale moctytla2em(vs t) ltnmo iodlaDeau o;t0teurim no1omee nvi (fs2urumoot4altn ociysfa2uluvp (4 eeomrcio1omDeai s;t)sruo(m oy4lp elfvta( srtaur nu0olto feiadls2ul( s u0 exoxfctydopte nei;t)setmimpiy1ome  fvils srrrurpot1ole mo3ilt aDumnvp u0arxnio oytlmte n olt setm(o nudlme lfvt (f Dra(  nt1tlen fetytlm2umnvonu0trenxo3to1lpt auvsls trxoirpoy4ll e nesl() 2rr( p;u1tpxnifeils s um( onu)trxrxo3oo1fpD lieolt seuoir nu4lm nlnvtat s2tm(ro;o4opx mo3iasla rm( ont) lerifctatopDelu s t)s2umxo3nydope mnvias  Dur( o;o0tpt ifeild mDeanvp;(0arxomr3io1lpDe nvols)s2tmir oudap nlfctat)a2rmuronu4aeto ietatfa ulu o u4artnmr tytlpt  n il(0 2uo(rpoydlmeemnvias  Dur(mp;o4olen i3ild s em( p t4 exomfciadomt lnvi s) 2trxm nudlltnmfcilt srur(rpoo4tle io3tat mDrm(vs (0 exoxr iydom   u s t0 eumim nudaleemiesasfa2ra( o;o4opto octys a uau o (0teeoxo iydoa e n o;(0 ruo(r3oydamenmncils) rta(rpoo1oee  oeiatfaDrl(vsnu0 eenifcoadop  aivol()t2uoir iy4lp elfvsas  2rmxm ou1aeeoif3ildls eaums;(4 lerxf3oa1opDr ies;(  exo(r3iodoptemfetat)a2rru p;o4olxnmfciyslmDem(mo t4tlenmocoatlmtrlues t trxo(m3oydlpen neiat sDrrxrpnt4olx moeils s2ua( p u4 lenir ootfa eln o ()t2xr(r oudopen ieils)sDua( onu1alx ii3iadls em(vp t4arxrif3oodopD  uvi t  rto(rpiudoltelncil(f Draxmpoo0apxoio3iydfs2umn p;t)trxrmf3totfmDrai sl( t2xoim3oy1lmte nvsat srumumooo1aee miciyd a2ea(mo;u)artoiociatla eaiei t)srtmio3oodopeemict t)artaxm ;u0tpeoio3ilsla2rm(mpn(0artnxr tadomteluvi s)teur(r iu1ameelnvtl()arrax o;u0aeto fciaslsDuau p u)trerifciadfmt lneils)srtm(o3no4omt mfeta(  2rrum ou0tlto iciysls2eaums;u4 lenir iy1om r n i (0 rxm(o3no1lm  lics ( srum(mo;u1texnmfcilt aDel(mon(4artniociydopt luvo ( srum(o oo1lpeemnvsas)arurxm ;u1alxnmo3iyslm emn o u0artnmr iadoaD liei ()seto(mpno4lleemfctlt) Dtrx pno1alxoifetad a ulumo ()aetrioctotlp ran ilt) 2ur(m3nydale lnvtls s2rmu  ou4opxomfciatfaDrmnvpn(0tlxnxr oytla  an sls srtmxm nu4om nmfesltf 2tm( pnt0tlx mi3tltfm2ul(msnt)tleomf oadomt aiesl( s2tr(m nu1openlncia() Durxrpou1texn o3tld mDrmnms u0tlxoif3oa1lpt livolt srxrio3nydop  mieiatfsDtr(rpoo1texnif3iatlsDra(von(4tltnxo3iodomDrauvsl()truoxo3iudape  ivs t aDua(mont1teenmi3tltlm2umu p t)artomfcoy1fmDeli s;s  etoxo nu1ole  ncs s) 2trxmo;o4oltnmfeildfaDrlnmpnu4tetomo3oadfa rai i s0setmirpno1lm e ieslt  2trxr ;u0alt  fctydlsDulnmont4aetnircty1om eau il( s2toio oy4omtemfct s s2rmu pou4aet moctadla em(ms;(4alenmocoa1fa elu i;t) ruo(m3nudamenlfctl(fs2ua( poo4alxo f3tatfm2rl(vp t)tltnxf3totomt  uvsl() 2xm(r iu4opeelncsasfsDrrump;t4oet moetytlm elump u4tlxrif3oytfm e u ils) rumir nu1ame  ncsas)sDtaur ;t0open o3iad m2ua(vo t4alerir oy1la e u o ()seurxrpiodapee fvil(farra(mpnt4tee iiciydla emn s;t)artrmfcoydomD aivs;t)t2toim3oy4lmtelietat  2uru  nt1aetoio3iltlmDrauvsnu)arenxr3totoptr ueils) 2uoxo nu4am nlnvils  2rrxm ou4opx  f3ilt s2ulu onu4 ltriocto1op r ivi;t0 eumim oo4ap emfctltfa2rmu o;t0tpxomoeiyd a2ulums ()trtnxo to1fp eaivo;s)srtr(o3ou4ll   feia(fs2um(r oo0ape iociltla rm(vp;()texrif3iadoa rauvils0 etm(m ny1aptnmnetls srrru poo0aleomfciys aDrl( o u0 lxrmf3iadomD  n i ( t2xriopio4ol nlneiltf 2ur(moou1oeen f3iasfm rm( o;t)aexrmf to1fmDrai ilt trtoimpou4ameemietltfsruau pnu0olen ictldfm2ulnmo t) ltomr3iadfpteai sls  eumio3nu4alee feil(f 2tmu pno1optomf3ildfm2rl(mo u0tlxoirciodop e u o;( teur(opnu4op  lfei s) rrruroot4opxoifeiyslsDeluvo u)aexrmr iatfa eaies;s  exmxo ou1amtnlies s) Durumpot1opxnmfcias s elnmsnt0 rxoioctatlmDeanes;s0t2umxopio4lpt lieia(f Dtruro;u1oet  ocildla um(vpnt0artomr oatlmD lneol(0srtmimpoydlle livilsfsrrmu  no1apeomoeiys aDemumont0 leoir3oodfatr i o ()seuo(mpoodom   fei sfsrtaxro;t1open fetasfm el(vp;u0 lermrctotfaDeaivilt0 rtmir3oo1llee ivt s)aDtrx o;u1tlx ioeiatfsDumuvs;()arermrcoydfmt lnes s teurxo nydomt  fetatfarum(mono4ape  i3tyt a2raumonu)alerif3totoa rlu s ()srto(o iy1aleelfvtat) Draump;t0tpt  oetysfs2ra(ms;(4 lxrxfctydlpt auei t)t2xoxm3oo1alenmnei tf Dua(ront0olt  ociat a el(mpnt4aleoif tydfp  lieo s0 2tmio oo1llte fes t  rrrurooo0texnmfcilslmDea(mo;t0 etrxr3iadfmD lieo t  2uoxm nu1amt mnvtatfsDumxm oo4oexomiciytlsDum(vp u0 rxomo ootlpteaneols)setmxopiu1ame  iviltfsDtmumpno4tetoiieiatlsDrln p t) lxnir3ta1lmD li ils)teur(rpiu1opee nvils)a2trum nu4tpxo iciyt mDua(ms u)arxrio3tatfaDe uvo;t)trxm(r3io4lme lnvi ()aDtrumpno0tltnmociatfaDulu p u)tetnifcoy1fat livolt teto(o3iu1apenlfci (  rum(mo;o1alx iieiytfsDua(vsn()trtoio3io1oatraivolt) 2umio3iu4lmtnmfcs t sDumum ou4tetomi3iasla2rl(mpn(4tltnir3io1om rlu ils0 rtoxopiodopee fvi s) rrrurpnu0tex ifeiasfa eau onu4 etnir oytlpDe neol()srxmxr oy4ll nmieilt sDum( pou1tpxoif3iltfm uau s;()aexrmf totlm r iesl() 2urirpnodlle livtls arrmxmpot0aeenii3iyt s2emn o (4aexrxfcty1fa rlneo s t2xr(o3iu4op nlfesl(fa2uau o;t0olt mf3ilt a2rm( s;(4 ltnxrciy1lmtraivolt0t2to(m3ou4om  mnvia(f Dta(  ;o0aet miciytfa2eau s (0texnxrcootlm e uvs;(0 2xrirpoodlmtn nvs s)sDtrum ot4tlxnmi3tltfa2umuvs u0 lenmf3ootfmD ln i ()trumio3nodamee neia()sDta(  ot1alenmo3iatfm eaump (0areoxr ootla  livi s s2toxopno4lmtnmneil(fa2urumpou4alxniieias aDem( onu4artnmf3iadlmtrlueilt tetm(m oydlpeemfciat aDrm(roou0tlt mociyslsDemn p;() eerxr ty1oa  aieslt) ruoirpny1ol  lict () Drr(rpnt4tleo ieiytlsDem( p;t) lxrxf tadoa rlieo;()srxrio ny1ape mncslsfsDrm(ro;o1tetnmfeild sDuanmpnt4 ltnxr3oodop r n i (0trtm(m3no4am  mnvias sDurxmo;o4tlxoiieiasfsDra( o;u0 rxrifcoadlmD li ol()truo(r io1lmt lfetas aDtmx pou0tpx mo3iadls umumpnt)tetnxrcoo1la  au i (0teurio io4ll nlicia( aDrrx  ou1oetnif3ilslaDua(vp;(0trxnmo3oadlmt  iei (  rxm(r3oo1lleemnvi t) rra(r ot1optn i3ilslm el(msn(0 eenxf3iatfmDeaueolt0srtmir3iu1om   net t)s2um(m oo0tpto fetls a2ranmon(0altnircia1fmtelu i (0 rtrimpiudll emiesas a2uaumono0opeomfctytfmDumnmp;t)trxoxf3tadlat ai i;t trtmio3iodome lfvils arumumpot1aexn ieiatfs emuvonu0 etnmfcta1faDeln i (0 rtmxm iodlm nlncslt artr(mpot0aex mfciad mDeauvs t0trtoxrciatop r neo t teumir3ou1ameeliciat) 2um( ono0tlx io3iasfs2uanvo;t0tetrmf iytfaDraiei;()t2urxopoodame  ivt ()s2rm(mpoo4opeoiieiydlm um(vs;u)aeenmocoatoaD aues (0 rxrxm3iydllenmietls)sDta(rono4olt mietysls ra( o;t0 etoxf3io1opteli o () 2um(opoudomtnlfcsa(f Dra(m ;t0oet ifctlslm2rlnvpn()texrxrcta1lp r neo t)srtmimpio4lm  lfci t arta( p;t4apx  oeilsfa2rmnms;t4 rxrif iatfpDe ieols  rxrxo ou4optnmfes t srta(mont4opeomoeiad s uauvpnu0artniocoa1lpteaiei s0s2to(o no1al elictlt) 2tauroot4apeo oeiysfs ea( o;u) ltomf ta1la ean o s0setmirpnydopt miciatf 2tmu  ;o1oetnmfcilt s rl(vsn() rtnxo3iodfp rlnvi s t2xr(r ou4lptnlnviltfsrum( pot4tetomf3taslm raump;u)altrxr3oydfm e nvi;(  exo(rpoy4ol   fvs (fsDumxmp;o4opt ifciysfs el(vs (4 etoif oydfpD anvi s0s2um(mpny4alt mnei ()srtm(mp;t1opx mfcias m2ul(mpn() etnmr3tadlm   ieo;()s2um(rpoo4lp n fvtatfarrr(r nt0opx mictld sDul( p ()alerxfctotomtelivo;()texoir3iu4olt licils)arrrx poo0tee  ieiat m uln o u) lenio3todlpDe ueilt0 eur(rpnu1op  licias)arta( p;o4oexomfeiatfa2umn sn(0 lxomo3oy1fm eaivs;t)setoxm nydlmenmncslt) rtaxr no0tltoiiciytfm eaums;t) ltrmf3io1lpDe uei;(0setoirpnodlpeelivilsfaDtaur nt4opeo o3iadla2ua(vo;u) ltrifctadfptr iesls  2tm(rpoo4ap emieias s2rruronu4ope  feiltfs2ranvo t0aexnio3to1oa eauei;(  ruoxr3nydll nliesat) 2tru ooo0tlt  oeias mDrm(vpnt0tetoxo ta1omD lnvi;t s2uoio ou4altn nct s s2rrxro;u1openifeils sDea(vpn(0arxrmrcio1fpDrauvo;(  etmim3iu1amt  fvslt aDrmur ;o1oeen ieias s2umn o;t4trenmr ta1oaDrlnvils) 2xr(opiudaptnmneiltfa2tau p;u0tleniictyt m em(mp t0 etnxr3oydomD  i s;s0 rumio ou4omeemfcta(fsDtm(  ;t4tpt io3tasla2emnmo u4artnif3iodlm rlnvs;t s2ur(o nudaptnlnci tf 2rmum nu4oetn octlslsDul( o ()tlxnxr3todfp rlnvi t0 exo(m oy1amt lieiasfsrurx  ou4oltoifetys m rmu snu0artrmf3oydomtrluesl(0 rxr(m3ou1olt lnvil() Dum(r oo1alx if3iadls umn s ()aexrxr3to1fmte ueo t  2xoim io4lpen ncs (  rtmumoou1olen o3iydfs2rlnmp t4trxoxfcoadfm  an il( srtr(opou4altelieslt s2tmxr ;t4opx  ieiyslaDul( p ()treoircoa1fp   ieo;(  rtoiopiu4ol n nvs sfaDrm(rpou0tlt ioetyt s uanms u) eerxr3io1oa   ivs (0 etrxrpny4ame mfeilt  2rmum nu1ole ifctyd s2eanvs u4 etoiocoy1fpD lieo t teuoxm3oo4lltemivt s) rtm(ro;o4aexomfetydlmDul( s t4tleoif3oa1om rlnei t0srxmxm3iu4altelnci sfaDraur ou1opx  oeiydfa eauvont)arxoirctodlp elivs s0srumimpiu4opt lfvsat)aDtr(rp;u0tpto f3ilsls2eaump;(4 rtrxo iy1lm ean sl(0truo(m oo1apte icsas)arua( pno4oet if3tysfsDemu ont4 exnmo iytlpDran o t0 etoir3oy1lm elnvt (  2tau pot4tpen oetlt sDrm(mon(0treoxr3tatoa  luvs;(0 rurxr oy4lpenmfvilt  Draxroou1ole iociadfs rlump;u4areomocto1fmtrai i s0t2umio ou4aptnlfcils)aruaum ou0optnif3ias s2emn p t4trerio iydoaD au o s0srtoir oy4ole lnesa()srtmumooo4oleoifetls m rmnvs;(0tlxrxfcio1opt  ivi ()srtoio iy4ap nmfvi ( aDtr(m oo4aexnioctadlm2elnmp u)trtnmrciatfm e iei;t setrxm3ou1ap n ivilt s2tm(mo;o1tet  f3iyt s uau p t0aexrmo tytlaDr u i ()setrxo nudaptnlncil(fs2rm(m nu0aet  octydfa um(ms (0 exrirciotom rlnvi (0teuriopny4alen net (f 2trurono0tlen oeiadla2elnvpnt4arxrmf iotom ranvo;() eumxr ou1optelivias)artm(  ou0tleomfctyd m2um(mpnt)altrif totfpDrlneslt trto(mpny4op nlfvil(fsDuau  ou1oeenifeiasfs umnmo;t4 reoxf3iydlmtr i o () 2urxmpny4opeelnvi t sDurx oot4tpt  feiyslaDem( o;(4teenmfcty1faD li slt)texm(mpnudol  mfct tfsDtr(m oo4oltomo3iadfm rln o u0arxoio tytfat lnvs;t0srxr(r3no4op nlivils)srtmx oot4aleomieiydls ua(mo;(0artnxf3io1fatrli s;t) 2xmim iu4ape livil( sDumxroot0opxnmfctas s2eaumo t0trxnxo iodfmD luesls)trurxopnodap e iei ()a2urur no4texomocildla2rlnvs t0alerxrciatlp   nes t  eto(o io4optelietls) Dra(r ot1alenifciadlm2uan pn(4 rxoifcoatfmDeau i;t)setrxmpno4ll  lncil()s2rmumpnu0oexomoctltla eauvsnu4 exrxr3oadop e nei s sexr(rpio1llt lnesl()sDumx pnt1alen fcias s2rm(msn()altoiocoadoaD luvi t)srtrir ny1olee fctatfsDtaurp;u1altomietld mDrmn p (4aeeoif tadoa  luvi;s trumir nydopeelies tf Dta(ront4olxo iciltla2ran o;u4altoio tatom elivi;t)seuoxopnu1al n nvsls  Dtaurpoo0alxn o3ildfm2uln o;(4 rxrir3ia1lp  anvo;() rxm(m3nudopeemivtls)a2um(rpot0alt  f3iydla rmu snu4 ltrircoodlm eauvs s srumimpiy1lm  lictasfaDum( ooo1tetoioctat s2ulnmo;u4arenir ta1lmDeau s t seumio nu4omt lfvtasfsDurx  ;u0aexn iciat m2ea(msn(4 ltnmo tadlptrlu o;(  exoxrpiudlpe mfvs t srtru  ot0tptoioeildlm2rmuvp (4alxrxf3oytomD au s ()srxoir iy1ome lictatfarurum nu4tpx  ieilsls eln pn(0 etrmo3ty1oa r uvil() rtm(m3nu1lpe mfet s) rrr( oou0aptoif3tysfs rlnvsnt4tlerif ta1laDelies;(0t2xmimpiu1ap nlicsl(fs2trumpoo0olxnii3iytfa2el( p;u4altriociatlmD lues (0t2uo(m iodal  micsltfsDumu oot0optnifeilsfa ea(vp;(0 renxf io1lptranvol( teum(m3oy1amtemfct ()s2taxm no0teeoiociytfm rmuvs;u)trerio oatlat  uvolt0trtmxm io4apt livilsf 2uaxro;u1alxnmietlt s rlu p;t)arxoio3tytlmt lieilt setrxopoodlle mncilt  2tm(mo;o4opt ii3tyt a rm(mpnu)artrioctodopDrlu ol(0texmimpnu1ll  livtas)sruru poo1tlto oeiat sDua(vs t0 eeoif3oy1lmte iei s0 etrim nudlmenmncias arra(rpot0texniictldls emnvsnt4aetoxf oadop eln i;s0 2tm(r3io1lltnmnvsl() ruau ont1tpx if3iytls eluvo t) rerifctadlpt lueo ()teuo(rpnodlp  mfcsa( srtmxr ;o0aet  oeiad m2rln s t4arxoxf iotom rlnes ( sexrxr3oy1open feils aDtmumoot4olx ii3iatfaDea(mp u4tlxnxo3oa1oaDraivo;t  2umxr no1al  lncias) Duru  ;u0tptnio3iydla2emn p;u) exnirciadla eln s ( texm(rpoo4amt  ivs t)aDtau pou4olt  f3iasfmDel(vp u0areomr todomDr neo;s0s2uoir nudlmtn ieils)srtaxmono0tle iocild s uluvont4texomf3oo1laDrlivils  2umio oy4omen fvia( sruau oot4tex ifeiasls ea(mp u4alxnxo3oodfatr n s s srtoxo iy1apee netls)a2trxm ;u4texo feiadfm2um( o t4 ltnif iatop eln s (0 2xr(o3io1op   nei (  Dtaump;t4aeenifctytfm rl(mp;u4tetnif3todlpt au ols)srtrir3oo4omtnmneias)aDtr(roou1apx moeiyd aDea(vo (0 eeomo iatomD  u s () rxm(mpnu1ll elivt () rtrx pot1apxoio3iys a2em(ms ()aleomo3tatfa r iei;t0 eto(m3ou4om  licsltfa2ur(monu0oetn fciaslm rmumsn(4treoifciodfmtraieols  2to(mpnodopenmnes t) rua(m ;t4tlenio3tltfs2rluvo (0aetrir3todom  auei;(0 rxmiopnodlmtelici ( srurur ;u4aex  ieilsfaDeaumo;u4 rtnio oa1fpDrlnvilt) 2toio oydaptemivta( aDurum ;o4tetnmi3ildfm2eluvo t0aetrifcoydfa r ies ( srxmimpnodlmtnmfviat  Draur nt4apt mfetas s2uln s;(0tetoifctytfp   i s;( trxoxm ny4amee ietltfsrurx oot0oexn icias m2eanvs;t)tlxomr iydfpDe i ils)srtmim ny4ap n feia( srum(rpou4tetnmfeilt a2uaumo t)arerxf3to1laDrln ilt)s2tm(rpiu4lmtelici t a2rax o;t0oex  oetadfaDrmnvs t)tetrifcio1oaDrauesl(  etmir iy4ap   ivi ()aDtm(rpno4alxomo3tlslsDrmuvp u4 eerir3ta1fm eln s t0trtmim3iu1olenlfvi s s2tau pnu4aexoiocild m rmn snu)aetoir3iydop elies;()srtrimpoodll n ivsas)a2rm(ro;u4opxn f3iydfa2rl( o;() rxrmociytlm rlnvi;s seurxo iu4omt mfctlt)artaum ;t0apt mfcias m2uaump;u4 reoir ootfa  lieo;s0texoiopiy1omtn fcsat) Dra(m ;u1tpenifciasfaDea( o u0 rtnio3ootop rauvo (0 exm(o io1om nmieias) rumumo;t4oltoioeiat aDrlnmp;(0texrif oadomDeli ils t2xo(o oy1ameelivta()s2ra(mo;t1tptoifciyt mDem(msnu0 lerioctotlmteauvs ( srxr(m no4lp  liesltfsDua(moot4openii3iydlsDea(vs;()aexnif tadop  aieol(0srtmxopnu1opt liesls  Duru onu0oeeomi3ilsfmDrlnms;t4aexoxfcty1lm  anei t)tetoir3ny1lpe  fes s)aDrmuroou1tlx ifciys s um(ms u0 exrmo iydom  luei (  exo(m3ou1lpen ncsl(fsDta(roou4tpxnifeils s rmuvp;t4 rerxf iy1laD  uvols) 2uoim oydlmt mici sf 2uaumpot1tex io3iysfs rmu o (4 reomr3oa1fpteau sl(0s2tr(r3no1openmivs (  rrr( ono4aet iieiasfs rauvp;t0altnif iodop eaivsl(0 etr(opoy4ame  ict s)s2um(r no4texnio3ild a2raums;u0 renxf3iydom elnei t0s2urxrpny4ap   nctatf rua(rp;u1opt mfeiasls ra( p t0artrio oa1lp eanvo;t) rxoio3iu1lptelfcia() Durxroot4tex  f3ils m ra(ms;(4arerif iydomD luvols s2umxo3nudll  lfcsasf rrmurpot1opt mfciaslsDemuvsn(0tltoiocta1lpte ieo;s s2xoxm3ny4alt lnct tfaDta(r ;o4aeeniociydla2umumo;u0 lxnir iatfp  au s t0 2umxm nu4olee fcta() rtmx  no1aeeo fctydlmDeanvs;(4 eermfctydop ean s s) etmimpoy4ap  mfctas) rtr( pnu0tpt mietydlmDraums;t)treoxrcootom eaiei;s0 rtrio oodlltnmfvtlt s2urxmpnt0tpxoifetlt aDelumo;u0trtnif3iadfaDrli o;t0sexmxmpoudam n ieta( sDta(mp;t1opt mo3iasls2rlnvpn(4tltoxo3iytop elnvo;t setrio iodaltelivsat s2taxrono0tlxoif3ilsfs2eau on(0 eeoxociadlateaivs ( sexm(mpnu1ol  lnetat) 2urumono1opxnmoeiltls2elnms (0alxoxr3iytfp  li o t0 2xrir ny4lmt  nvilt  rrr(moot4teeo oeiyslaDumu sn(0 renxfctatlat lues ()s2uoxmpnu1am e nctl(  Duaum ot4tpx ioetlsla rlnms ()tlxnmocoy1omt  n s s0seur(o3io1lm nlfcsltfarrrx p;o4alen fetld aDulnmsnt0 eermo iodlaDeluvolt0 rxoxo3ny4lm  lieta(faDrrum ;u0aetnmo3iyd mDumuvs;(0altrifciy1fpt ai o s srtoxmpoo1lleemfvia()aDrmu  ou0optomociat s rlnvp t0texrmfcoo1lmtrln i t)t2tr(r iydll   netas s2uaur ou0olto feilsfa2um( o;u0 rtrxo oo1faDr u ilt) rxo(mpoudape mfeslsfa2raur nt0aex ioeiytfs el(vs;u0trxoircoadfm r i s (  rxoxm nudlpte ieil(f rrr( onu1olxoioctat a ea( sn()altrif iydlpDe uvol(0seuoim3nu4am e nvsl(faDum(rpno1opxo i3ils mDul(vpnt)arxoifcoodoa rlu olt  exm(r iu1al nlfesatfaDurur ;t4aetnif3ildla umumsn(4artrifcoydoat aies s  exr(r no4lm  mfctltfa2urx  ot1tlx iictldls2ul(von(0tleoxr3ty1lmDeluvo ( trurxo nu1opte feia(f 2ua(  ot0oeeoii3ias sDuanvs u)texoxfcoodlaDrauei;t srurxm3ou1al e icslt artmur nt4oeeoiociydfm ranvsn() leomo oa1lmte n i;s texrio ou4om nmfvsat) 2rmu o;o4opt mo3iyd m2ulnmo;u4alenxf3iatlp  livi;s srxoxrpoo1al nliesls)aDtru  ;t4opt  oeiat aDrl(vs;(0 rxrif iotfa  ln s;(0t2tmxopoydom nmnet tf 2trxm no0oetoiieilt aDulu o;() rtrir iadla e i ols t2trxo oodlptnmietl( s2rrxrpot1apt ifciytlm uluvsnt4tlxomfcoadom ranei;(  rumimpoo1ole  fvsltfa2ra(moot0tleoifciytlsDra(vp;(4 etoio oydfmDe u s t)t2toiopiydlltnmictls artmx  nt1oex ioeiytfaDemuvon()aleomo to1lmDelnvolt0texmir3nu4ol nlnei sfs2ta(mo;u1oetn o3iatfsDua(vo () rtnif3oa1om rlnvi t  2trxrpnydale mfvi s)aDrrxm nu1tlto fciat a2uaumont) rxrxo3oo1fmteln i ( s2tr(m3no1llenlnesl(faDtaurp;u4aee ifctlsfa2ranmsnt4aeenmocoadlmte ieol(0trxr(r3oy1omtelfci sfs2umur ou1optoifeiltfm2ran o (0trxnmr tatlpD an i ( t2toir ou1lme mfvilsfa2rm(mp;o0olt ioeiadlsDra( o t) etomocto1la r i s;s truo(m oy1am emfvsat)a2ta(  ;t1oltnioctltfaDumump;t0 leoxf3iadfpt anvo t)t2xr(opiu4omtelieiat) 2rauro;o0oex iiciysfm emu o t)alerir iotlmDrlu i;t sexrxr nu4oleemies ( srrrxrp;o4aex iicilslmDul(ms (4arxoifctatlmDelueslt)t2uoim3iy4al nmfci (  rumx pnt0ape mietytls elnmo (4 lermociotfaD lu o (0s2trir oy1ll nlfeiasfsDrm(ront1altnmoeiysfm ulu s t)altrir oy1lmteaieo;(0 exrxrpou1altnlicia()a2tm(m ot4optomi3iysfmDumnmsn(0trxnmf iotlmDeaueilt) 2tmio nodal nmieilt arurxm ;o4aeeniicilsls2uanvont)aexoxf oatlpDraivs;() exoxo ny1omt mfct t arur( onu4tpxo iciyslm rlnvs u0aeenxf tadfpt aivi ( sexmim3nu4al nlnvt sf 2tmx ooo1aptomfciatlaDumu s;u4aexoxo tatfatelnvi;t0teurio oy4lp nmfcslt)arrmu p;t0opeoioetatla ra(monu0trerxocoytoatr iei s) exrim3oudap emfetat)srurx  ;t4altomictatfs2rmnvs;t) rxoifcoatoa  lnes s0texrim3nudap emnvsa( aDurx  nt0aptoif3ilt s eauvp t0arenir ootomtrlu ilt seurxopnodomtemfcslt  rrru pot1tpt ii3tys mDraumo;()tlenxo iotfmtr u s;s) rtmxm3oydomenmfctat) 2uaxm nu0texo f3tlsfsDel(mont4trxnxfciatomD anei;t  rtmirpny4lp nmnetas s2urxmonu0oex ifctas s ra(vo u0 rtnmr3iadfp e ueo ()teurim3oodamtelfvsas aDta( p;o4ale  o3tatlm el( on(0tltnxr3oodfmte u i;()s2trxm3oy4open nvs sfsDrm( ont4aetniocildfs emuvs (4 rtomf3tatopDelies;t0 2xmim3oo1openmfct t a2tr(m oo4opeoifeils sDrm(vs u)artrxfctytoateai i s)texoxm no1lmen ivsa(  Draumo;o1tpxoif3iyd mDua( p u0alxrmo3ta1oate n i s0srxrim3iudlleelivtl(f 2umuro;t0alt mo3iadfsDua(mo t0alenmf3ta1fmDe n olt)teuoio3iudam n fes t s2uaxm ;o1tee ifetydfs2elu ont0aetnxo3ia1fmt luvs;s s2xmim3ou1amt livtltf rururpoo1opxomfeilslmDem( s u0arxoxf oytlpte nes;()tetr(mpiudaptemfeiat) Drmxr oo0aetomietydlm ulu o;t)alerifctydfatrlnvolt)texo(opoodome lieil( srrr(r no4opt  i3iaslm2eau p ()tlerif3tydlmDelnvi (0 eumxo iy1om  lnesa(  2ur(rooo4tpt  iciaslm umums t)tetnxr iydopt  uvo t0texr(o ny1oleeliesl(fartm(  no4tex iiciat mDul(vp (4 etnifctadom e ieo () 2tr(m3nudam n fetls)srua( o;u4aexniieiysfa emnmo;u)arenxr todoate i i;s t2um(m3iu1om e ivi sfa2rrumo;o1tlxomi3ildla eau sn(0arxrmrcoatfatrauvi t  rurim3iu4apte ncs (farra(mo;u1alto oetas sDrlums (0alxomf oy1lpDrluvi;(  rtrxopiu1ope lfvi (fa2ur(rpou0tpeo i3iyd s2ra(mp (0tetriocty1lpteaneo t trumio3ny4llenliesl() rum(  nt1ale  ieiat sDrl(mo;(0trtniocto1fm rlieilt)s2toimpoo1apte netat)aDrr( pnt1tpxnioeilsfaDrl( s;(0aexrmfciodlm rli slt trtr(opou1ame mfciatf rrax  oo4tpt mo3ildfa rauvs t0 etoxf oy1fa eanei ()tetm(m oy4omte ivtlsf 2rmu  ;u1tex  fetldls umnms t4texoifciydfaD  iei (0t2toio ou1ame  iet t)s2taxm ;o4ope  iciaslsDrm(vo u)tetnmf to1fpDr n sl( s2uo(o oodaptn fes (faDtaxrpnt4alenmi3tatfm rln s;(0tetrir3totfptean s;()setrxmpoy1lp nmies ( artrx ooo0oltnmf3iatfsDra(vp;(4 lxoir oy1lm elnvo;(0srxoxm io4al e fvsat s2umxrpou0tlx  ieiydlsDrauvp (4 rerircoodop eaues;s texmxo3nu4lmenmnciat)aDurx  nu1tle mf3iysfm2um(mo u)texnir todfmD  u olt)s2xoxm3nodll elivils) rta(mpnt0tpxoif3iys sDrlu o;u0tlxrxo oy1oa rlivs;t0srxmirpoodll  mnvtl( a2uaxro;o4teenioctltfaDeaumpnt)aexoif3iy1fa rlivsls) etoxo iu1alt lfci ( sDtmumoou4aetnif3tadfmDran ont) ltomf3oo1omDe uei;s s2xoxr iu1am   fcil()aDrr(  nu1aeto i3iytfaDelu o u)trtomf3totfmDr n il()s2to(r3nu4ll n nvt ()arua(mooo0opxn octaslm2rauvpnt) eenmo iotlatrli o;(0 2um(m nu4lme lfctlsf 2taxm nt1ale  o3iltfmDemums;()texnmociydlmteli o;( s2xo(opny1ol elieiat)s2rr(mooo0alenmfciasfs ulumo;u0teerxf iotlate neols0 exmir3no4opt miesat a2rmx  nt4tlxn ociasfm2ua( p u) rtnmrcty1oaDelieol() rxoir3io4oleelnviat s2rrx oot1aeeniiciytls ra( snu0 etrifcia1lpD  uvils0teurxrpiu4lme lnvi (farum(mp;t1tlx  f3iaslm rm( p u4 ltomr oydop e ivol(  2uo(opnodaptelivsl()artmx  nt0opt  i3ildfsDumuvp t0alenir oydoptr ivs (0 eurxo iudlmt mnetat s2tmxrpnu0tlenio3iasfa2rln o;(4 rtomr iatlaDrlnvilt)srtmxm iu1amt  ncsltfaDtau p;o1tetoif3iyslaDulums t)tetnxocootfmteli o;t0s2xoir oy4op nmiesas)sDtaurpno4olx iociadls2uan s t4tlenxociydfat lu o ( trurxo3nudomee ivil(fsDua( p;o4olx mi3tltfa2eluvo (0 exrxo3oytfm raues;( tetrim3ou1om  mfvias) rtm(m no4aeenmieias a2umu o t4 eerif3tatlmt aues s t2xrim iu1ole mnvtls srtrx p;o4tle iic
\ No newline at end of file
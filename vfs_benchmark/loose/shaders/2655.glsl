@@ -0,0 +1 @@
+neo t0setoxo3nodllen iei () rtmur no4ope  f3tyt m ea(mp (4 exrmf3ia1faDrliei;t trtoxmpiydopt mncias  Durumooo1tltn o3iadfm2eanvsnu4tetrxr todlatrauvslt)srurio3oy4ameelnetls)a2rm( onu0oet mietltlsDumuvo t4alerxo3tadlpt  ivi t  2to(o nudlpt lies t sDtm(rpno0tleoioctat sDrluvo;t0altrircty1om e ivi;(0trtoxr3oudope mnvils s2rrur ot0apeo o3iasfs uauvpn() rtnmo3oadla e ues;t0 2tm(o iydapt livs s sDrmurp;u0aexoioeiadlsDelu p u) rtrmrcoodla rlivi;() 2uoxm oy4lltnmivsa()srrrxmpno1olxoioetldfs2eauvsn() ltrir oo1faDe u sl(0 eumir3ny1ll e nesas  ruaumpnu1oexoiiciadfsDrm(mpnu0trxnmfciy1omte ueo;t srxrxrpoo4al nlfcia(fa2umum ;o0ape mf3iatfa em( p ()artoxo ootfp ranes s)tetrim no1lmtnmiciasfsrumxmpoo0tee ifctlt a rmumo;u)tltrxf oodfa  an ils)teuo(o oudamenmieiatf rtm(r oo1aex  i3tlsfs2ulumonu) reomr iydfaDeaivils)seuoio no1ap   nvs s aDraumont4oeen i3ildlsDuluvo (4arxomf tadfpt lnvs;t seumim3nodolen nvtl()s2trxr ou0apxo f3ilslm rau snt4 etrxf oadlmDrai o;s  rxrxr iydapt  icslt sDta(ront0optomoeiltlm ulums;u4 lxrxrciy1lp  lnvi;s0trurimpio4al e fvia( aruau  no0openmieiltfsDem(msnt0 rtnif3iatfatraivs t s2trirpnu4al  licsls) rtrxrpnt4aex iictls m2umnmsnu4trtnxfcoatfmtrlieolt teurir oodomee nvil(faDtmxroot1aetoii3tltlm2em(ms;u)trenxf oadlaDr ivs s  rtmiopny4opee fvtasfa2tm(rpnu4apxnmi3tadfm2umnmp t) renxo3oydomD aieol( srxrxopoydllt mivs tfa2um(m oo4apx mf3iys sDuanvp;(0texrioctatlaD aues;s) rxm(o iu4openlnvtlt)sDrmxrpou0aleo f3tydfs2emu p t) etnmo ty1fp  aivolt)sexr(mpoudal  lnes tf rua(  ;o4tetoiietyd m2emn o (4 ltniocoodfaD aues t)seum(o nu1lm nliei sf 2ua(mpoo4ope ifeiltlm em(mon() lenxo3io1omDeluvo;(0 rxmxo3iu4ap n nes t artaumono0tlt  ocilsfsDrlumo (4 lerxfcootfpD luvs;t0 2xm(mpnydopeemicta()srrr(rpnu1olenmociys m emumo;u4alxrxo ty1oa   ueo;t0t2tr(r nydll elfvt (  Drmx ont0alxniiciadls ean p;t0 exnmo iydopDrluvs;t  etrim3nu1ol nmietat aDurxm ;t0tltnmfciys m2uauvs;u0 rtnxf tytomtean i () 2uoxr oudlmtemivsatfsDumx  no1tex iieiasfmDuln pnt)tlenxrctydlateluvi ( srur(o3ny1ale mnvs (f 2rm(mono1tee ioctyd m rlnvo t0 lxnmfctatlpDeanvols  etm(rpoo4lptnlieiat)aDuaxr ou4tleniicildla emuvpn(0aeenmo oo1opDe ieolt trxr(rpoy1optnmivt tfa2taxmpoo4apxn iciydlsDem( s t0 ltoxr3oadlmtrln i;t s2trim nudamtnmies s arum(ronu1olto oeiys sDuauvo u0 rxomr3iatlpt lueil( srxr(o3ny4llt mfct t)srrr( ont0olxoifeiltfa uauvonu0artnmo todoate nvi (0trumxm ou4lm nmiet t  2uaxront0altnifciltla eanmp;u)artnxrcoadfpDeanes s)sexo(mpiy1apeelnvi tfaDur(moot4alxn ietld s2ran o;u0trtnmrctydoatrli s;t s2toiopiudalt  ivs () Dtmxmoou4opxo f3iyt m2rlnvs;u4teerir oydoaDe n s;(0s2tm(rpnodamte nci t)srrmu oot4aex ifctyt sDeanmont0aeeomf tatfm  anei;t srur(r3nu1omeemivias srumumpot1olt iieiltls rm(ms ()tltoxo3ootom  lnvol(0 2toxo3iy4olenlivs t arraxrpnt0tle  feils s2ulnvs;t4tltoxrctadfmtrlu s;s)trurirpnudllenmieilsfaDtrxrooo0tex  ieiydlm2ul( ont)tleoio3iydfaD  n s;(0s2tr(m iy1om e fcsat  ruru  nu4apxomoeias aDemnmo u4 rerirctatfmD ln o;s0 2trir iodoleemivtasfaDtrum nu4oee mo3iys sDelnvs (0tetrxo iadla  luvolt0tetoir3oudoltnlfetlt  2tm( pno4tpxoif3taslm2elnvpnu4texnxr oo1fp eaieo ( t2triopiu1ole lfeslsf rtax p;t4apxo octltfa2rmn p;t) ltrxf3iotfmDelieo ( t2uo(o io1olee ivsas)arta(mpno0oex  oeiltfaDeanvp;u) eeomrcoatlmDraueo t0 2xoxo no1om e ieilsfsrrmxrpnt4tlxnmietytfsDeaumsn(0aleoxr ta1lpDrluvi;t)t2trio3no4lmtelivtatfarumu pnt1tetn oeiydfsDran o (0artrxrctatlmtrlneo (0tetmxr no4lme mfcsatf rtm( oot1ole ifetaslsDuluvpn(4aeenio3todfm   uvsl(0 rxrio io4lltn fcil(fsrtmxro;u1olx io3tas mDuauvp;(0 exoif oa1opDeau i ( seur(m oo4al n nvtasfarrmurpnu4alto ociysfs um( snt4arxrmo tytoat an s t)sexr(r3ou4op emivil() Duaurp;u1olxn octas s eau s (4texrio iotlm ranes s) etmxmpiu1lme mfcils a2rmxmp;u0opt  iciyslsDranvs;u4texnxo3iodfmteai o;()texr(mpou4opt lfvi sfsrrmu  nt0oleomoctldlm rmuvo t4tlxnir iatlp raivs t)srtoxrpou4om nmfcsa(fsrrmxmp;o4altnmo3iyt m uanvo u4 lenxoctytlat aivo s t2uoio nu1ole lfcils sDtrxrooo4olx mi3iatfs2eln s (0 lxrxocoodop rlu ols) 2urimpou1am  lictatfsDtrxmp;o4tleomfcils a rauvon(4 ltoxfcoydlatranvo;s)sexmio iu1lm  mfvta(  2tax  nt1alxnifeiltfs ua(ms;u0alxrir3oo1op rluvsl() rtoxr oy4lmt mnes t) rumuront1tlt  ociys a uln o;u)aeerxoctodomteaivo;( t2trirpny4lmenlivsls) 2uaum oo1optoifciyslm rlumpn(4 rerif3oydlptrau o s0trur(opiu4llt lncslt)s2ra(ro;t1tpx moeiys m2eaumsnt) etrio oy1fa ean ol(0s2uo(rpno1open nvsls) Duaxrpno4aetoioctytls2rau o;(4tlxnmf oadlm r ies;s) eumxm3no1ll   ivsltfaDrm(rooo0tlx mf3ilt a ulu snt0alxnmrciy1omtran il( t2tr(o iu4ole lfvi tf 2ur(m oo4aptn o3tyt a2umnmpnu) lxnxo3ta1fp r i o;s) rxr(o3iy4alt  fes (fa2rmu o;t4oltnmfeiydlm rmums t) exoxr3oadlaDraues s0trtrxm oy4lltn ncilsf rrmu  ou0tlt mi3tasfsDemuvs u)teenxr3iydfa ranvo;( trxoir oodllen nesat) rtmu oot4apx mi3iytfsDeauvp;u4teermrcoo1lmDelivilt)srumxr iydlpenmiet t s2ururooo4tpt  icias sDea(vp (0tltoxr3oa1optrlieols  rxo(rpoydam   fesa( s2trxrpnu4aexomociatla uauvs u0arxoio3iydlmt  u o s s2umirpiodopenlfet ()artaxm ou4tetoiieiasfmDuan p u4tetrmo3iadfmDelues s0s2tmxo3iydop emicilt artr(mooo0opeomoeiat aDumump;(0arermf ia1om  ln o;t0trurir nodape mfvs s) 2rruroou1tpeo f3tls a ua( ont0aetoif ootfpt an o (  rtmxr3iudame mneia(farurx  ;u4tex mi3tysfa2emuvo;(4tlxoiociytlp rln i;s s2uoxo ny4opeelict s srtmump;u1aet iiciatlm2eaumpnt0trtnmr iotop   ivol()sexmxrpiu1ale lnvsl(fa2rm(mooo4apenmiciyt s eluvo;u)tlenxrctatlaD luvs;t)setm(opnu1omt lneia(f Dtmx  ou4opt  f3tltfmDemnvsnt0arxrxociatoa rauvs t sruo(o oy4ap  lnct tfarrr(r ou1olxnmi3tatla eau s;u4arenxr oodlmDeanvsl()tetoio3iu1open ict t)aDrrum nu4aeeomfcilslm umuvsnt0 exrxr3iatfmtr ieo s teuo(o3oodam elfesas a2rm( pnu1oetnmi3tys s uln p t0tetnio oytoatrli ols)s2urxopny4altemivias arrruro;u1tlxo i3iyt sDeluvsnt4texnmfcoodfm eau o;s t2xmio3nodlpe lfcs t) 2umxmp;o0apto o3iatlm uanvs;t)artrxoctotopD  ues () etoir3oo4ape lfciat aDuaurp;o0tpenmfeiltla el( s;u0tlxrmfctytom  aieolt0 rxmim no1lleemfeias  Drmx pno1tpenmo3tadfaDrm( s;(4areoio iytlmD  ivs ( trxoxo no4al nlivias aDtmurpot0teto i3ilsla2rm(ms t4arerif oydlp elu o;s  exmir3oy1al emieslt)srurxrpoo4tetoiictlsfmDrln on(4trxoif totlmDeaiei t0 exrxo nydaleemicils)sruauro;u4oeeoioeiad m rlumpnt0arxomf3tatomDr n slt) 2xmxo3ou1opt micsl(farraxmpot4oex  o3tydls rauvs;(0tlerir iy1fmteau i (0 rumxrpny4om nmfctlt sruru  ;t1aex mi3tltlmDeln pnu0texnxfcoydlptrlu i s setmxm oydamenmnci t)artmxm ;t1tee ifeild m2emnvs;u4aleoif ty1lmDr ies s teumir3oo1ll n feiltf 2umu oou4teeomoeiadls2uau onu0 eeomf iydfm elies;s0s2tr(o iy1omt liet (f 2rm(mont4altoifetld a emuvpn(0 exomo3oatomDrlivo t0s2triopno4amtemnesls)aDumxmoot0alx  i3iydla rmn onu) rtnxf tydlmDeaieo s  rxo(r nodal n fcslt)sDuru  ;u4aexo fciytfa2emn o u)altoir iytfa rliesls)teumxmpio4ap nlfctas srraurpoo1aleo feiyt a ul(mpnu4 ltoiocty1omtr nes (0s2xr(o3nu1lm  lnci s)s2uaurooo0aetoiietys a2eln s t)arxrmr oo1fp eanvslt0sexoimpoo4llt mnvtlt aDurxm ;u4apt ifeilt a2em(mp u0teeoirciytfaDeauvil() 2tmio3ou1lme miesa(f rrax p;u0texo iciytfaDrmn ont0alxrif ta1fptelnes;s0 2xoio ou1ll n nci t  rrr( ont4olenif3ildlm2rl(ms ()artrio tatfp eanvi s)s2xrxm ou4om   nci t)srtaxmpnu0alxoioctlsla2ulnmp t4 exoxfciydfmtr i il( trtoir3oudom e iet t)sDurx pnu1ope mfeiydfs rmn o u0teenmrciytomD  uei s  rxrxm iu4olenlieilsf 2tmx oot4oetnmo3tlt sDel(vs;u) exoio iatom   u o ()sexrxr no4apt  iesa(  2ururo;o4altniociasfa uau p;u)texrxfctatfateanvo;t  rtmiopny4omtnmfcsl(fartrumono4oexo oeias m2rmumo t)arxrmf3todoaD  ivils)srtoxr nu4lptemfesas s2tm( o;o4opeomi3iys m eau s;(0teenxrctodlate nes ()seumim3nodlmt  ncs ( a2trxrooo0altnif3iadfs2elumo t0aeenxr3iytfatranvs;s0 etmim ny1om nmfvsa(fa2urx o;u4apenmictltfa ulu p (4 ltnxr3oy1fm e iei s0trtrxm ou4lpen neilt)srrmxmono4apenmfeiat a rm( s;(4treomf3to1omD  i ils)trtoxm iy4lm nlnvt s aDur(ront4olenmoeilt m2rlnmo t4arxriocoo1lm r u sls) eumim3iy1apen icsat sDum( o;o0oexnii3iat sDemnvo (4arenif tadlm  ai i;t  2xrir3iodolt mfcsa() 2tax  no4olto ociysfs em( o u)arxomr iadom e ies t)t2ur(mpou4ameelfvslsfa2rmur ;u0tpx mfetys s2ua( o (4 rtrio3ta1lpteaivilt0 2um(rpoo4altemnvia(fa2uau  nu4tex iieiysfmDeaumo;t) lerxocoy1lpDelnvi ( trxo(m iy4altemictasfarrrxro;u4apeo ociyt s2eaums u)tetrxrcta1la  ln s;s teumxr3iu4lptn ivta(fs2ra(r oo0olt moeiad a2emnmsnt) exniociy1fpt  nesls) 2uo(r ou1lltnlfvtas) Dtmurpnu0tlxomiciad s umuvon(0arxnio iatoat  uvo s t2toxr io1lm  lnet sfs2rmumont4aee mfeiasla2ea(vs t)teeoxf3io1optrli o;s s2tr(mpny1alte iei tf rurur nu1olt ii3tatlsDul( snt0 rerifctatlp r i s (  2xmxm nodom nmfes t) rtrurpoo1tpx  feilsfm ean o;u)tltnir oytlptraivolt0 etmxm3ou1lm nlnviat)arrm(ro;t4apenioctatls emn o;t0 rtrmfcoy1fmDran ilt) rtrxo3ou1lltnmnei t) 2ta(r ;t1texn ieildlmDum(vpnu4altoifcto1lmD lieils srto(r3ny4al emict (fs2uaxrp;u1alt  feiatlsDrmnmp;u0aetoiociatlm  an ols)srxmim3iu4op n ics s)s2rmurpnt1olenmi3ils a2uanvs;u)arxrmf oatlp r n i;(0 rxoir3oo4omtemneslt s2ta(r ;u1tetn feiydla rm(mo t4 eeoxr todlaDrli sls0srxr(r oo4lpen feiasf Drmumpot0tptnioetld m2ranvp u4trxrmo3io1om  an olt)srxm(opnu4altelnvtl(  Dtrx p;u1optoifciltfa2rlnms u0teeoxf oytfpDraiei;s0s2umirpno4olenliciltfsrurxm ;o4aexniiciyt a2ua(vp;u0tlermf3iy1fm eaivi t)seto(r iy4al e feils arraxrpnt4tpenio3iytfm rlnms t0 lerxr3oo1opteauei t0trxr(o3nu4amee ict s  Duaxr ;u0alx ifciat a2umumo;u0trtnmf oa1fa eauesl()trtmio nydlmenlieilt arururpou1opto f3iasfa eln p (4trxrir3ootfpDean i;t  rxriopiy4omee fvtl(fa2umu o;o0aexniociltlaDrln p u4aexoifctydfaDr i ols0teur(m oodape  ncia(faDurxront1aeeoioetyt m el( on(4 ltnxf3iotop  li ols0texoxr3oo1ole mnctls) Durx oot4tpx mfeilsfs raumpnu4tltrmrctydlm r nvo;() eurir3iy4lm elnvs sf 2umxmp;o4opxnmociasfm2ulumpn(4treomo3io1fmt lu i (0texoxopoo1amenlnvtl( srumu poo4tlt moeiatfm eanvs;u)aleomf3ia1faDeauvi;t) rurxmpoy4omeelivtlt)sDurx  ;u1alxnmi3ilsfm umn pnu4tltoirciydlmtrliei;t  rxrir3iu1al n nvt t)aDtmx  ;u4teeomf3tydlm eluvsnt4tetoifcoa1fmte n s t0s2uoxo3nydaltelfet tfarrmxmono1openio3iadlm elu s ()tltrmoctatomDe n olt)trurirpoy1lpeemivtl()aDra(m no0optnmictadls umu p;(4teenxo to1faDe ieo s)t2xm(r oy4op nmnvtas)sDua(ront1apen iciat m2uluvo;u0 ltnxr3iatlmD an s t)s2umxr3iy1opt lfet (f 2raum ot1ole ifeilt a2eln s;(0teenmr3totopteai s ()seurim ou1omee ncsl( srrrxr ;o4aex ii3tlsfa ua(ms;u4alxrir3tytomteai s;s truoiopno4olte icsatfaDur(m ;u1teeoifciysfsDeau o u)tlenif iy1fp   u o t texoir ou1lltnlnetlsfarta(  nt4tptomietysfaDrl(ms;u0aetrmo tydfp rlneo;t0 exr(mpnydllt mfvta( sDua(monu0olt mf3tysfm2rl( p;t4 etrir ta1omDeanei s)s2xrxr iy1ome  ictltf Dtaxmont0tet mfetls m ra(mp;u)tlermfcoo1oatrauvolt t2ur(rpiy4ome lfvil(fsDraurpot0olt if3ilsfmDrm(ms;u0 eeoxr3tydom eaieslt0s2xrxmpiy1opt lici s) Drm(m ot0oltoiictyt m rau onu)tltoir oydoptr u il(0 rtr(o ny4omenmictlt artrumoou0ape  ietatlmDea(ms;u0teeoxo3tytlat li i s0 euoxm oy1op   ictltfs2raxroot4olt  i3iatls ul( o (0alxoxo iytfp rlneils srxo(mpnodopte ici tf Duaxrpno0oeeoifetat aDea(von() rtrmr3ootfa  aues;s  euo(rpoydam elivtls)aDur(m ou1tee mf3iydls ulnmpn(0artoif3oatoatrai s;(0t2xo(r nu1lmenlncta( aDtmuro;t1tpe mfciys m2ea(mo (4trxomocto1oat  ivs;( s2xmxr3nu1lptemietl()sruau ont0tpeniiciyd s2rl(vp ()teeoiocoo1fmt  u ol(0t2uo(r nudlp nmfvtlt) rtmu ooo4apto ietatfmDrm( sn()texnmf3iatlp  lieil(  etmio3ou1lm  mfesatf Durxmpno0olenmo3iysla ul(mo;() etrxfcia1latr ies;(0s2tm(o3iu4opt mnvi (  Dum( pou4tpxn feilsla em( o;t0alermo tytlmDelueo;t)setoxo oy4op e fcsatf 2tmu poo1aex  o3ildla2umnvp (0aetrio to1fpDraneo s  rurimpny1lm e fcsat a2tax o;o0teenmf3tlslaDel(msnt0aetrxo3tadop   u i () etmir3oo4lme  ncsls) rtm(mo;u0oleo iciadfm2umumont0trtrir oodfa  lnvi ()t2xrio ny4ap nmnes s)sDuaxmpoo1aexnmoeiyt m2umnvp t4 ltoxocia1lmDeanvo;t)srxrxr3ou1llt lieslt a2ur(r no4oetomo3ilsfm2ra(vo;u0trxoio3iadop r nvo (0t2toim nu4ope  ict s s2um( p;u1opxo i3iasfaDean p;u)tlenifciytfm ranvo;(0srxo(o3nu4ope micsas srtrumpoo4tleomo3iadls em(vo u4 rtoxrcty1fmD  uvols setm(o no4apen nctlt)sDtmump;u4ole micildfa2umuvp (0aexrio3oatfmteli o (0srxrxm iodlmtelieils)srua(rp;u0olx mo3tldfa rmump t0tlxrio tytla elnes;t0srtmxo ny4ame miet t srum(m ;t1aptn iciytls emuvpnt) rerio iytomtranvsls0 exmxm ou1om  lfvtlt aDtaump;o0aleoio3ils a2eaumo;(4 reoir oodoa   u o;()trxmir3iu1lpe lfeslsfaDur(moot1optnmictldls ea( pn(4tetnxo iydfptelnvils)srxoir3oo1ome  nctatf rum(moot4aex  i3iytlsDra( o;(4trtrmo tydlp e ueilt) rxoxmpoy1am nlfvs (fa2rm(mp;o0oex if3tls mDemuvs t4alxnxfcty1fm rlneil(0setoimpny4lle  fvsls a2rmurpnt1tpeoiieiys s ulumo t)trtoifctotop r uesls0s2xmio3no1ap   fct (faDtrx pot4tle io3iltlmDelump;() rerxr3todlpteau i s)t2xmxrpny1al   fcta( arrr(mpoo1tlt iictld mDrlnmo;(0artoxr3oa1la r i i;s)setrir ou4lp   fcsa( sDtr(m nt1aeeomfctlslaDranvsn(0 lxnmrcoadfaDraueils)seumim3oydlptelivia(fsDtr( oot4tpto i3ilt a2ranvs;()trtnir3iotfaDrluvi;t srxrimpoo1ap  mfciatfs2taxmpoo1tetnio3tasfa ea(ms;(0 etnxrctotop   uvs;s tetm(mpoo4aptn ictltfsrurx o;t4tee ii3ils mDem( s (0 renxf iy1fa eaivol( s2tmxrpoy4lptnmivs sfarumuro;t1oex miciltlsDuanvo t)artniocoodlpDelues;(0setrxm3ny1apenmicilsf Draxmpoo1optniociydfmDrmn onu)alxrir oatom  au o;(0s2uoxo3iu1om e feslsfsrtrur nt4tpeoio3tytfaDeauvo;u) rxnmocootop e nvs;t)tetm(mpnu1om nlfct tf 2tau  oo1tpxn i3iydls2umuvs;u)aetrxoctytla r ueilt  exrxm nu1opteliciat)a2tm(mo;o1opxnmfeils a ulums;(0trtnxo ootfptr uesls0trto(m3ny4olt lnvt ()aDrr(rpnt1ape  fetadfs2el(mp;u)tltrxo3iydfatran s;( setoxrpiu4llenmics s s2raum ;o0opxo i3iat s2rm(ms;t4tltnxo iodfp   i ilt0t2umxr3io1ope  ieiat  rum(moou1altomiciat s ra(vp u) rermr io1opt lu sl(0srumxr3oudlp e fcs ()a2uaumono0tltnmf3iltfs rlnmo;(0aeeoircootfmt anei;()t2um(opio1lptn nvsl(fsDtrxr oo0apxnifeiys s2ea(vp t4 lxrmfcoodfpt auvi;s t2uo(opoy4olt  fvsa( sDrr(r ;o1tlen f3tydfm2rln p u0altnxr iadfmDeauvi;s tetr(mpno1lp eliei t)srrru ont4optoifeilsfa2eanmpnt)artnxf3tadoatrliesls s2trxo nu4lptnmncsl() Dua( pno0oee mieiadls ua( s;t4trxnxo3tadla   ies (0 2uoxrpoudlle  fvsatfsruax oou4opeoiieiadlsDeauvs;t)artnmf oydopteli i;(0 etrir3iodomeelfcsa() rta( o;t0ale miciasla2emuvsn(0alxnxf3oo1oa   uvi s  2xoir3no1omenlnvilsfarurxrono0oet mi3tatfaDrmnvo (4tlenxfcta1oaD  i s ()t2umxo oy1oltnlfesas) Drr(mpno4oexo o3tlsfs2el( p u)tetnxf oydlmtelnei;s)srxm(rpoodllt micsat)aDtr( pot1texo octydls2em(vp;u0artniociadomt lnvs () 2xm(r3oudal nmncsas  2ua(mooo1alenioeiatfmDeanvp;u4altnxocto1lp elnvi;s texr(r iu4lpte iesl(fsDraum ot1opt iiciatfs eaumpn()aeerifcoydoat aivo s0 eum(opoy4ap n ivtlt aDumxmpoo1oetnifciysfm emnvpn(0arxomrctydla  aneo;t tetoxopoy4al nlfctat srumxmo;t1tpxn oetydfm2ea(vs;t4alxoxfciytop eanvi t0 2xo(o oo4amee ietasf rrmxroot1tpxn ociltlaDem(vp (0 eermo3oadfptean s t setoxmpiudal e ies s  2trurpnu0apxnifeilt a2umuvs;()altnmf tydop  anvolt)t2tm(o iudomtnlnei ( sDuax o;t1oltomfeiasls2ra(vsnt4trtomocoatomteluvil(0 etmxmpou4oltnmncil(  rua(r ou4olx moctys sDulnms u0tetnir3iytlpte ivilt  etrio iy1altelnvi ()s2tm(mp;u0aet iociatfm em(mo t)texrif io1omt aneo s)trxr(opiodal nlfcilt)artrum ot0olxnio3tydls elums u0tltrxr iatfat  u sl() rtrxm3io1omtelfvi s srtm(mo;u1openifeildla ul(vs ()tlxniociytlp  anes;t0 rumxm ou1ol nmfet s) rtr(mp;o1optn ociysfm ul( on(4 exrif3ia1fmDeau s s  rtr(r3io4amtnlfvilt a2umumpno0altnmi3tyd sDranms t0tltnxrctotla rau olt seurxr3oudope lfvslsf Drr(mpno4tpxoiietatls ra( sn(0 exrxf tatlat  nvslt0s2toxmpnodamt mnesa()artmxmooo4opxoiociasfa2eau snt)trerio3tydoa  lneil(0texoio3oy4ol e nviltf rraxmont0ole ii3iyt mDra( ont)areoio ia1om rai olt) rurxm3io1alenliei tf ruaxmoou4teeoifeiadlm2eau o;()aetrifcoydomD ai s t)s2um(r3ou4aptelici s srtm( p;u0apx  i3iatlm2um( s u0areomfciy1fa e ivs t0trxoio oy4lle  ictls) rtaxm ;u4oet  i3tyd a2ea(vsnu0 reniociy1faDrln ols)sexrxm3iudlpt lncil(fa2raxm no4tetomi3tls a2elump;t4 renmfcoo1fm  ln s;s0 ruo(r iydopt  fcia( aDra(ro;o1tpeo ictatfaDrlnvp;u)aetnxoctadfpt aneo;(0tetrir iu4lptemfctas)a2uau  nu4apx iietatfa2rmn s;()tlxrmr ootopD  u i;( setoxrpoudap  lnes t)srtm(  ot1olenio3iys sDrlu snu0tltnmrciy1om   ivs;t t2umxo ny1llenmfvtat) rraxro;t0tpeomi3tltls um(mo;(0trtnxo iytom rlnvo s seum(r oy4ape lieiat)aDtauronu0aexniociyd s2rmnvo;(0teermr io1laDran i;(  rtr(r3nodlpenlfctl()srta(mp;u4tpenmoeils a2rmump;()aeeoioctatfmDrlies t0s2xrxo3no4lmt  fet sf rum( pnu4aexnmf3iytfm ulumo;t4aeeoir io1lpDe neo ()t2uoimpnudape liesa()srrmum ;t0tlxnifcilslmDemump u)tlerio3totomDe uei;(  ruo(mpny4ape lneslt sruru  ;u1tltomociaslmDrlnmo;u4alermocoodlmtraivo;t tetrirpoudlpen icilt  rtr( oou1tleoiietatfm raumsnt4 exnirciy1laD livolt texo(r3oo1amtnlfei () 2tmu  ;t4aetn fctld m uaums t4artnmrcia1om rlu o;s)sexr(m ny4omt  ies (fsDur(mpoo0teto fetydlaDelu o;t)artoif tytomD li s;s setrxr ou4op  micsatf 2trxmpnu0opx mociatfa2ulu pnu)trtnxrctotom e neslt0srurim3iy4ameemnei s)s2tm(mpou1tlt  i3iysfmDua( s (4tlxoxf iydomD aieo;()s2umir iy1amen fvsa( arta( p;o1teeoifctys m2rau s;()trtrxo tatlpteai s;t0srxoxr3oy1open ies sfsDumum ;u1alxo octaslmDem( s u0 ltoir oodlm ean s;()srxmio ou4am   nvsl()srta(m nt1olxomocilt a2eaump;(4 lxoif iydfaDeln o;s  2uoimpoo4ale lnvslt  Duau poo1teen oetydla2raump u4aexnir iy1oaD  i o s)teuoimpiu4ape mivs s aDrmx  nt0tpt  ictasfs eln o;u)tltrif io1omteanvo ()tetmxmpiu4am  lfeiat s2tm(  no1tptnifciatlaDra(vpnt4trtoio3iydfateai o s)t2xrxo oy1oltn fviltf 2um(r ;o0aexoii3tltfm ran s;()aeermf tadomD au o ( teur(o ou1omtn nvtls arrmumoou0tptoio3iatfsDemnmp;u0trxoxf3to1omD luei (0sexrim iu4olt mivslt arum(mpno4tltoif3iysfa rm(ms;()tltoxfcoatfpte ivo;(0 euo(r3nydlp e fvslt  rtru poo4tpe  i3ilsfaDumump;u0tetrmocia1fpt lneol( trxr(o3ou4ap  lfvilt  2tru p;t1ale mociyd sDua(vp (4aetrxo tatfmD aivo;t)trxoxrpiudop  mnvsl() Drrxrooo1olx io3tlsfm um( sn(0arermfciy1fmDranei;s)t2um(m no4lmt mfvs sfa2rmu pno0ape iictls a eaumont0arxnmr3tadfat auvsl(0 eurir iy1ap   nvtat)s2rrum ;t0alenmociatla ulnvon(0 eenxf iytfpD au i t)tetoir ou4olte ietas a2tmx p;o4apxn f3iat a ea(mo;u0trxnircoodlmD livo;t)truo(m3no4opt mneiat) Drrurp;o4teenmictls s rmnvsn()tltoir todom eanes;t0sexmxr3iy4lmtelfeta(fartrx pno0opx io3iltlsDulu o;u4arerir tatfm eaivi t) 2xmir iu4omee ivtltfartaxrono1alxn octlslmDrmumpnu4alerio3oatlpDrlivs;(0s2urim3nudlm nliet tfsDumum ;t0oltn fctytla uanvs;(0areoio3oydoaDelnvol( truoirpno1lme lieils srumur nu4optn oeildfsDeaums t)artrxo3todfm rlu i t) 2uoxopou1ole lics sfs2ur(r ot0tetoif3iltfm emu o u4 rxrxoctytopt ai i;(0s2to(o oo1altelfvsa( aDuaxr ;t4oeeomieiytlaDul(ms;()aetriociatfpDr u sl(  2xo(r3iy1ap nmivs tf 2ta(ro;u0tptoif3iytla em( p () rtrmr iatop r ivol( s2tmxm3oo4openlfvsat) 2urxm ;o0tpeomi3tyd m umnmo;u0altnxr3oydfpt  i i s0tetriopiu4lltnlict t  ruaxr oo4ale mfctadfs umnvp t0aeermociadoa raneo s  rtmim oy1opt  fvilt aruau ooo4tpxomo3ias aDumnvsnt4 rxnmr iatop  ai s () eur(opoudap nmietas srurumpoo0oexo fetyd a rl(vs;t)aexnif iydfmtrln i s)sruoxmpno1omtnmivi ( sDrm(  no1oet mo3ias s rmnmont)artrxf ty1faD  ueo ()texoiopou1amt  fei s arrmxmono4tlxnmfeiyt aDumuvp;t0 eerxfciotoat lieo;()s2xoir nodol nmieiat)artr(mo;u1aetnmf3tasfmDea( p;t0aexoio3ty1fm eluvs (  etoir3iodoleelfci ( artmumoot0apenmo3ils sDrm(vo (0 rxomo3oo1oatrlieo s t2xrirpoodllenlnet ( sDtaum ot4oeeoifcilslsDean o;()alenirctatla  anvs;t trxm(o oy4lmenlfvt ( aDur(mp;o1altnioeildfaDrmnmo () etomo iatopteaivils  2tmxo3nydllee ivils arum(m ou1tpxnmfeiadls2ea(msnt4altrmf io1fpDeau sls  2umxm oo1am elfetltfa2ua( oou4olxoiieiyt m ulumo;u0altnxr iydlp rluvo t srumio3nydlmt lfvsl( srrrxm nu1tee mietas mDelums;u0 rxomr3todoa rlu ols)srtr(r oo1altelnvsl() Dtm(mo;u1aptomfcilsfm rmums;u4teenif3iydlp rlivi;t)s2toirpnu4omeeliesl(  rrau  ;o1tpenmfciasfmDea(vp;(0aetnir tatomDeaivs (0seuoxrpiu1openlncsatfsrua(mpou4aee iieiatfsDra(mp (0arxoiocoytfmD  nes s  2urxr nu1ope lneia(f rua(m ;o4oltoioeilslm uan s;t)aetrmr3iytfp eauvo t0teuoxm no1omte ivsasf 2umxm ou1tpxnio3iysfs2eau onu0teeoif tytla   iei s)trto(m oy1lm   nvt (  2tm( oou0olenmicilslm2emums t)tltnxoctodfp eai s s  rxoio ny4ameelnvsa(fsDtrur ;o1opx mfetaslaDea(mo ()aetrir3oatfp e uei;t0 2xrio3oo4amtn fcslsfsrtrum nt4aee mf3taslmDrl(mp ()trtrmo oytlpteanei;t) ruoxr nodll   nci () 2trx oou4teeo f3iydfm rauvsn(0 lxoio totomDeaneilt s2xriopio1lmtelnvsa()sDtmu poo1optnioeiltla el(mpnt)aexnxf iodop rliesl(  rtm(mpnodlmtnmicsas arraurpno0tltomfeiys a2rmums t)alxrmo totom rau i;t  2urio nudomen icil()aDtm(r ;t4aeeo oeiatlaDranmo (0 leoif3tydlmtrln o t)srtr(rpiu4lptemncslt a2raxmpot4optnioetlsfm ulu o t)teenxo iydlmDe nvs s)trtrxm3ny4al nmnci t sDua(m nu4tpxoifetaslm rlu p;()arxrir3ia1lpt aivo;s sruoxm ny1amenlfcs tfs2taur ;o0tex mo3iatlm rlu o t0tetnio3oy1fmDe u sl() 2tmxo3ny1ape lieta()sDuau ooo4ale mictydls2el(mo;()tlxrmr3tytlat lnvsl() rxr(mpny1lpenmnesatfsrua(mp;u0aee ifeiadlm elu o u4tltrxr3iotom   uvs t  rtr(rpiydamenmfct sfsDtaxroot0oexo ociadfsDraumsn(0 rxrio iodlmtr ueo t)s2uoir oo4altnmnctls) Drmu pnt0opx if3iltfa rlu p (4tlxnxo3tatfm  aivs t)t2xmio iydomenlfvi ()a2ra( pno0tpxoifeiasfa2ulu p (0trerxrcoo1lm elieo (0s2umio oudale lfvtl()sDumxrp;t4tpt micilsfa elnvsn() rtoxrctodfateanei s trumxo io4ol  licsasf 2uaxm ;o0tetnmo3tltls2ua(vp;t0tlxnmo oytlmte uvolt  rtrir3nu4lpen ncta()a2trxro;t1texn o3iad m2uau o t4tlxnif3ootlpD  ivi;s)seur(r nodomenlnetl(faDumxm ot1tptnmfcilt sDem( p;t0trerir3iodlatrluvi;s  2xoxopiydal elietasfaDumx ono4tetnmieiyd m ua( o t0trxnxfciotop rlneslt s2trxmpiu4aleeliei tfsDuru onu0aptn i3tlt s2rmnmp u0 etnmf iatlmt  iesl(0trurir nydoptemfvs t)arrmxmo;o4oet mf3tlt m rluvo t4 rtoir iodlpt auvolt s2xm(mpiy4lpen nvi (  2rm(  ;t0teeomfciydla2umnmo;u0 lxoirctadoa  auvo;s)tetoxo3oy4ameelnvta()s2ua(monu1tpto i3iadla emumo;u)alxrio3tydfatrluvi t)trxm(m iu1lmen iesatfa2uax p;t0apeoifeiasls2rmumpnu4 etrxf ta1fpte uvil() rxrxr3oydaptn fesls)s2ra(mont0oltoif3iat sDeau p t) eeoxo3ootla r u o;t0s2umxo ny1ap n iciat  Dtr(m ;u1tlxo f3tytfs um(vsnu0 ltoio3oatop elnes ()t2tmiopou1ome lnci s sDua(r ot4olt mictatlsDrl( o;t)treoxf tydfptrlu i;t  2tr(mpoodoptelictat) rua( oot1tlt ifeild aDeauvs;()aetrxf iydfat ai ilt sexmxr io1ol nlneta() Duaumpot1tpxomieiatlsDuanvont4arenxocoo1omt aivs;()s2xrxmpnudame mnvsls)s2taxr no0tpenmiciytlmDrm(vsnt4 eermfciy1lm  lnvolt) 2toim oudlmte nesa(fs2tau pnu4aetomociyslaDeanvs;()treoio tatomDr iei s s2xrxo3nu4ll n ies t a2rm(mpno1tpxnmoctysfsDulnvp;u0teerio oatfm rau slt trxoim3oydapee nvsa() 2ururpot1tle  feildfsDel(vp;u0arxrmf oy1fmtr u s s)texo(m3iudolee ncil() 2trxmoot1apt  iciytfa eauvp;t4 lerxf io1la   i s;t)s2uo(r nydlp emncsa(fsrtm(r ot1tex ioeildfa2ranmp u0tltrif3tytomteaivolt trumiopnudal e ictl()srurx pou1tptnio3tas s uln ont4trtnxr3ootlm e neslt0sruoxo3io1lm nmnetltfsrrmx pou1olen o3tysfs um(mp u) rerxocoy1lp   u s () etrirpoodlpte fvtlt aDuaumo;u0opx ifciyd s2eln on(4treoxo oy1lp  au i;(0 etr(m nudomtemnciat arua(mooo4ope  icias m ulnvp (0altrmo ootomteanes;t)sruoxmpiodoltelfcta()aDtmxr ot4tet mfetatfsDulnmo t4 etnxfcia1omt lnvo ( srurxo oo4omt  nvtl(fsDraur ;o0opx mfctadla rmnvs;u4alermf3tydfaD ai o;s0sexmimpio1am nmfciat)s2umxroou4olt ifeiadls2um(mo t0 reomf3tatop  lu o;s0s2tr(rpnydlmeelivta( a2rrxr ;u4tpxnifcildfa uau s (4alxnmf ootop  aivi;t0s2urxo3iodoleemncs s  Dtaurpot0texnmi3iydfs ra(vpnu4aexoio oydoa   uvs t setr(m3io1al nmiesltfsDtru o;u4opeoifciad mDuanmpnu0tetomf3iadla r nesls) exoir nu4aleemicsatfaDurx pou4olxnmi3tatfsDrl(monu4 lxrif3oo1lptrlnes;s  exr(o iu4amtn fvtas)s2ua(r ;o0tee if3tydla2umnmont4tetrir todoatr uvi (0srurxrpoo1llt  ivs t)srumu poo0apto f3ildls2rm( s u) lxnxrctadlptrluvi ()trxo(o iu1ap  lfcsltf rumur nu0tptomf3iad a2ranmsnu0aleoxrcio1om  aneils s2xoiopno1alenmfvsls  Dum(moot0aet iieiad s eluvont4trermo oa1fa r nei;s)s2um(opno4ole lfvia() Draurooo0altn octad s2umn onu)aeenifctotlatean s;s0t2trxm3iudame mnctl(fsDumurp;o0tpxo fciytfs2ranmp (4 rtnxr ootlpD lieo;t texoxr oudoltelics t)sDtmx ooo1apxo fctltlaDumump;(4 lxrmfciytop e neo t0truoirpiy1al elieta( aDrrum no0apxnmf3iatlsDelu s t4altomr3iatfp  luvsls  rum(r oydap nmici (fsDrm(m ou4opto ieiyslsDum( s;t4altoxo3iodoatran i t)srxoxo nu1lptemfctlt  Dtau ono1aexomo3tldla ulu p t4treoxf3oa1laDelueils0 2uoim3iudlme mneias) Drax ono4aexo ietlslm ul(vp;t)trxomrciatlp rlnvo;()tetrir3oo4ape  ivt sfa2rm( ono1tpe if3iytla2umuvon() eermo todomDr u olt  ruoirpio1lp emivt s)srtrur oo1alenmfeiat m2em( s t4tlermfcoytlpD  nvs t0t2uo(mpiu1altelfcsltfarumurp;t4apt moetasfm ul(msnt) lerircoadom  lneo t trxm(o nodlleemicsa()a2urum ;u0tex mieiasla elnvs;()altnmf iatom rln i;s0srxmim3no4lpte ieilsf Dtm( ont0tpeo fciasls eln onu4tlxrio3oydop e n olt seuoxm ou4aleelivtas  Dumxrpot0apeoiieiltls elnvp u4trtoiocoadfp eau i;t) 2trimpiu4ll  mnvia(fa2um(  nt0tpeniictad mDea(vpnu4 etnmfctadlm elnei;t srxrirpoy1amtnlfctls  rtrumpoo4aet  f3iyt s2rl(ms;u) etrxoctotoptrln s s0 rxrimpoudllt miei s) rururo;t1tpen ociytfm2eanms;u4 etoif3tydlpDran i;s)srxoir ou4alen fcsasfarum( ont4aee mociyd s2umuvp;u4 exoif oatlp rlneo;(0trxr(r3iy1al elivsasf 2urx oot4tee mf3tad m2uln o u0 lxrif3ootoate uvi s srur(o3nu4ape  net t a2rm(moou1tltnmociatlsDranmont)teerxr todoa rauvslt)t2xmxopiy1aleeliei ( s2rax ont1tet mf3ildlaDua(mpnu)aetnmo3tytoatran ilt s2tmxm3nudop nmici t arrmu  ;t1opxomo3iatls2em(vpnu0tetomfciydlm  li o;()s2tr(r oydlmtnmnvsat srum(mo;o0oeenmfeiyd sDemu s u)aexomf ta1opD  ivs;t0 rtrir3ny1optelfeilt sDraxrpnt1oeeoifeiltls ran o;t0texrmrctotlat  n o;t) exm(rpiydaleelivi t  2umxrp;u1oet moeiat s rl(vp (4alxnio3ia1lp elnvs;s)teuoio3nodlpenlncsa(fsDumumonu4apto oeildlsDua(vp u0alermocio1opt  ivi;s)trxoim iy4lptelfetat)aDta(m nt0altnmieiadfs2rl( on(4texnio totfm  aueol() etmxm3iudomt mfvslsf 2uaxroot1oetn i3iys s2rm(vo u) rtrio oa1lpteauvi;(0seurir3oy4lpt lncsl(f rrm(moot0aetn i3tydfa2elnvsn(0trenmrctodfmt ln o ( seum(m3oodll  mnvsat arta( ooo0texnmf3iydfm2ean sn(0 lxnio oo1lpDrluvi t texo(mpnu4alen neiat)s2ururono0aeeo f3iysfsDumumo;u0 lxoxf iadfat lu i;(0t2toxopnydlmte nes sfaruaum no4oeto ieildla eaump (0arxnifcoodfateaueils  2triopny4lme mfcs ()srumumont0olto ietlslsDulnvp;()trenio to1laDraueils0sruriopio4lp elnei t)artr(  oo1aptomfcildlm2ranvs ()aeeoif oo1oaDelues (0 2tmxo3iu4lleemicta( s2rrx  nt0opxn o3iytlsDrau pnu0 lxomf3oy1lpt  u o;s)srtrxmpiodol nmivsa() 2tmxm ou4ole mociatls2em(mpnu0arermf3oatomteai i s) euoimpno1openlnesasfarrrump;o0tle io3ils a ua( on()arxrmocia1fa r n s;s) 2xrxrpiudllee icsl( arua( ono1tetoifcilsfs rluvs;t0aeeniocoatfpDr uei;s sruoxm3io4ope  ieiasf Dtrxmo;u4alxnmfciyd s2rm(mo;t0aeerio tytlmtr neols)seuoimpiy1apenmnvt (fa2uru oot1aexniieiydlsDra( pn() etnxf io1fa ranvs ( srtr(r3io1lpee fviat)srua(ronu4alto oeiaslmDulnvs;()texnif tadoa ranei;t0srxr(rpnydlp nmfvil( aDtmx o;o4aexnmieilt aDrlnvpnt) ltoxfciadfa rauvi (0srto(o3oy1lle mictat)aDraump;u1olxn fetatlm uau p u) rtoio3to1lpD li sls) 2xoir oy1aleemivtatfarraxrp;u4ape  oeild s rlumon()artoxr3oytlp elivi (0s2uriopou4omee netls  rtrum oo4tpen ietlslm rlnmo t0tltnxo3oydoa   i i;t)srtm(r no1al elnvtl(fsDrax onu0oeen oeilsfm umump;u0trxoxo tytlpteauei s) exmirpnu1ame  ivta() 2rm(m nu0alen o3iad m2umnvo;()aetnir oo1oatr neo;( srxo(o3io1omtemiet sfsDrmx pnu4aleomo3iysfa2elump;t0teerio tytopD aues t) 2xrirpiy1lptnmfviat aDurxmpot0oetn oeiltfm2uln s;u4teeoif tytfmD aies;s texoir ou1lpeelnvia(f Dtmuronu0oetomi3ilt m ea(vs u0 rxrircio1fptr n i;s)t2xoxopno4ol  mfcils)sDtmxrpno1alx ifeiysfm ranvp t)texnxfctodlm rluei;( trtm(mpiu4op e nes sf rtmuronu1oexomfeiyslm uaumsnt0 ltoiocio1faD aieols srto(rpio4omee nctasfs2ta( poo4texoioctydls ea(mp u4 exoxf tatoa r neil()t2uo(o oodlme lieslt a2trx oot1olxnmfetldfs umn s u4tltrmociotoa   n s;t0t2trir3oy4llenlivi sfarrrurpoo0oexomictatfaDumu o;t4teenmf ty1faD li olt setoxmpiydlp  miet tfsrrmxmpnt4aetnif3tydls umu pn(0aeerio3to1oa e i s s t2urxm3oo1lp  mnvils)artaxmpnu0aetnmi3iyt sDeluvsnt0 etrirctytopt livs t)teurio ny4alt  ictlt  Dtm(mo;u1apen f3iyt m2elumo;u4aetrmo ootfa eau slt)trtmirpou4olt liei s)aDraumpnu0oee  icild s2rlnvont4 rtrmrctydlaDrln i;s0 ruriopoo4lle  fcias) rtmumont4aex  feiltfm ua(vo;(0 eeomo oydopDrlneo t  rxm(m oo1apt miei ()arumx poo0olxomf3iyd s2ul(vo ()aeeoxocio1lpD ai sls)teumiopoo4op  lfei tfsDrmxro;t0apen f3ilsfa2rm( pnu0trxnif oadoat au slt0trtoxopio4llenlfcsas)s2rru p;u0apxomf3tls aDra(mont4trxnir3iydlmtr n sls0teto(m3oodom e ictas  2rau pou4oleomieiltfm rmu p;(4 etoxfcoodfpD ai il(  2xo(o3oy1olt lfct sfarta(  ;t0olt iociydfaDelumo;t0trxoxoctytom eli i s0srtrir3iudom elivsa()s2urx o;o0alxomieiytfmDel(mo;()aexomr3iodlaDean i;(0 rumxrpnydop nmfvi t)srtaxmo;o0tlxnif3iaslmDemnvont0aexnif ta1fmDeaueslt t2um(o nodlptelnctl(  Dtauronu0open i3tldfaDrmnmsnu0trtnxo3tadlmDe nei;s)seurio3oudam emivsatfsrrmuroou1alenif3ildfm2eln o (0artomocoadfpteln i;(0s2xrio oy1altnmfesls)sDta(moot0olen i3iytfs emnmpnu4tetrmr3oytlmDeai o;s seuo(mpnu1lptelnvslt) 2rr(root1texniictld s eanmsn(0texnxf3tytfp r ieo ()seurxr oudllen fei sfarumxmonu0aetoif3tltla rmums;t)tlenmf iotla e neo ( sexrir iydam nlfvt s)artr( pno1tex mfeiytfmDean p;(0 renxf oo1lp rlivs s)teum(r3oo1alt mies t a2ur(r no4opeomociys a rmu o (4arerxf3iadlmDrluvo s srur(r3no4lmenmfetl() Drr(mono0alx ioetad s rlu p ()tleoir oodlpDeai o t0setr(mpoy4ome lfvil(faDrrxmpno0openmfeiltfs2umuvp (0altoircoa1faDr i o;s) 2toimpnodal n feilt)arrm(m nu0tpeoiieiad a umu o;t)trerio3ootfpD lueo;t s2xoir3ou4amtnlncs tf 2tmx  no4open feilsla2rau snt4arxnxoctydlmt ai sl( trtmxr nu1al  lict (farurxmpoo0apt ii3iysfs2ulnvp u0teerxr3iydomt anvols  2uoxo iodapeemnetas s2uaxrpnt0opeomoeiaslaDul( p (4trxrir3iytoaDeaivs () rumiopoo4lm  lfeil(f 2ta(moot4oltomociadlaDum( s () exriocoo1lptrlneilt texm(r3nu1llee fvsat a2raxm nt0oltn oeias s2ra(vpn(4teerxf3todfpteaivs t t2to(opiu1al  mfvtlsfsrur(rp;t1tlxomiciltls ua(vo (0areoio3ty1oa raivilt0setoim3nodamtn feils  rrr( pou1open fctltlaDuluvon()trtnif3tatlmDe nvsl() exo(o3nodol nmivt tf 2tmum ;u0aex ioeiadfa2el( sn(0trxnmr3iytlptelueo () rtmir3oodlpe micsls arra(rooo1apx mi3iatfsDranmp t4trtoio3oa1oaDeaueo;t) rxrirpnudomeelnvtl()aDur(rp;o4olen ieiatfm2ul(mpn(0arenxf oy1fmt aivo;s)sexo(rpnudol n fcta(  2rr(mo;o1apeo ociadls ulu ont)tlerioctydomDe n s;s s2trirpiu4apenmiesls) Dtr(mo;t0aee iociltlm2elnvo;t)tlenmf tydfmte nvi t  2uo(mpoo4op e neiltfaDtruronu1aee iiciadlm ranvs;(4 ltrmocoodopDr uvols0 eumxmpiu4apee feia( sDtrump;o4teeoifcildlm2ua(mont) lxrmo iytlatran s;(0setmir oy1alt lnctlt)artmxr nu4texo ictys sDrluvp;t)tleomo iotlmDrlues s0t2xmxo3iy1oleemnesls)sDtrxmpno4tlenmf3iysls2emums;(4aeerif3iatlm  liei t0 rtoio oydom   fcil(fa2uaumpnt4alxn i3tltls2rmuvo t)teenxr iadoa r uvi s)srxrirpoo4lm nmfvtl()s2tr(m ot0oeenmietyt s ra( p u0tlerir oatfpD lneilt)sruoir3oodlp   nvsa()arrm(r oo0teeomieils s uln o;() rxnxo3iodomt  n o;( s2xm(o ny4ameelics (f rrm( ooo4alxnmfeiadls uanms (0 eeoxo iatfat  ivi;s) rumirpnudap   ncsa()aruru pno4olxoifcilsfa rm( o u)trxomfctodfp eai sls0trtoim iu1op  mivtltf 2ur(moou4tlx mfciysla em(ms u4 lerio3iytfm elnvs ()srtr(m io4op  mfvi tf rrrxro;t1altomf3tasfsDelnvs (0 rxoio to1fatr i o;t0truoimpoy4lpte feilt)a2trumo;u1tltoii3iatlm2umnvsn() rtrxf iy1om rlnvs (0srxrir3ny4al   feslsfsDrmuro;o4tlx moetlsla2umnms;t)artnmociadlp   ivols0trumxr3iy1ale mnctl( a2taurpou0teen oeildls rlnvsnt4 rxrmrcoadlpD  uvi;( t2xmir3oydlp  liesls srumxr ;t4opeoio3iydlm2ranvonu4altrxo3to1op r nvo t)t2uo(r3no4ale mivtls) 2raxrpou1aptomoetltfs em( p;(4tltoircootoaDr u o;( trxoim oodomt lfcils)arra(mpnt1tet iociltlsDulump u4artrxfciatfaDrln ol(0t2urxopoo1op  lnvils) rtrx o;t1aetomfctyslmDuau o;t) rtrmr3todfaDr uvi;s)srxoxo iodape lnvi ( aDua( ono1aet ioetytfmDrmnmo;u0arxnio iatlmDran o ()s2xoxm iy1ll   nvils artruront4olxnmoeiydfa2rl(mo (0tetrxo ia1lptraivi s) rum(opnudom emivilt srurxmoot1tpen iciltfa rm(vp;(0trtoxocoa1lp eai sl(  exmir3nodoptn fvt ()srta(roou4tlxnifeild a2eln o;u4alxrmrctodlmtr u i s)setoim ou1lptelics s)srur(m ;t4apx mociyd aDeau onu4aetrmf3oa1oate u s (0t2xo(r3iodap nmnci (f rta(mo;t4olx  i3tldla rmumo;u)tetrmfctotfm e ues t texoio3iudopenlfctl(  ruru pno4opxn fciys mDrm(vsnu)aetnxr3oytfmte ueol( texoirpnydop elfeiat  rrau pno4opx  oeiytfa2umnvo;t) leomf3ootlaD lnvs t setmxm nu4open ict t)srum( p;o4ope ifciasfm2emu p t0aeeoxo3to1lpt an slt0 exr(r oy1ol e fvi tf Dtru ooo1apx mo3ias s2ea(mpnu0texrxr3iy1lat  neol( s2um(r oodoltelfvsasfa2urxrooo4aexo i3tltfs2ranmpnu0texrmr ia1fa  lnvsl()truo(o3io4lmtemfet tfs2umxmono4optn iciasfa2ulu o () lenxr3iydfpteln s (  rumxmpny4omt livsa()aDur(m no1apxoioeiaslm raumsnu0 ltrmo3iatomteaivol()trum(m3no1am nlicil(f 2tr(r oo0tpxo octldfa ul( s;t0 etnifcoo1latrlieo t)s2umiopiydam nmnesltfa2rru poo1tetomfcildlaDrm(ms;t4texoio3ia1fmt  n ils0teuoxr3iu4ame mfetlsf 2tr(moot4tex  oetls mDrmu p t) exnxfcty1lptrluvsls0t2xmim3oy1om emnvsa( a2tr( pot4opx mictyt m2uan o;(4 eerio oytomteau s s setoim3nudamtelnes s arurx p;o1oet  i3iyd sDrmn s u0tetrmr3oa1opDe ues ( sruo(r oydolt mfcil( sDtm(r nt0oex ioeiadfm2ranmp;u0texomr3to1fmteliei t0s2umim ny1alt lictl(  2tmxm nt4tlxomiciatfmDel(vo;t0 rtnxo3tatoaDraieilt)teum(r3iydol elfesl(fsrurx pnt1oleoiieilsfa2uanvp u)aexomr3oadoa raivi;s0t2uoim nudll emivt ()sDtrxronu0teeo f3ias a2ua(ms;u4altoxr3iotlpD  ivi (0seurxopoo4ol nmnvsa( srtm(m nt1oex iociysla2emumo;u) leomr iodlpDe nei (0teuoxo iu4lltn feil(  rta(  ;t4oeenioeiatla elumo;(4teerir3tadlmt anvs s  ruo(m3oo4ol emicta(  2ur( o;u1aex mfciytlm2ranvs;u0 reniocia1fa e nvols  rtr(o nu1al nmnvsl()arumur ot0olto o3tytfmDrau p t) exrio oa1fpDe i s;t)trxoiopiodamtemfeias sDrr(m ot0olt  i3ild sDulu o;u4trxrxrciy1laDeln i;t0 rtmir3iy1ome mivi s)a2trx o;u0ope iiciydlmDelu s;(0 lxnmo3io1fa  ai o t0 etoxo ou1lleelnvsa(fsDtr( p;o1tetn f3iltfs2rl(vp;u)tlerxo oy1lptelu s;s)s2tmir3no4ol e iei s)srrm(roou0tltnmo3ils a eaumo t4trtomrcoytfa   uei (0tetmiopoy4al   nvs ()s2um(mpnu1tpe  ieiatlm ulnvpnt4texnmf3ootfm  auvo t srtrir no1apt lfes s  rua(mo;t0aptnioetad a el(mo;u0aeermr iytlaDe nvs (0 exmxmpnydaleemnetas) 2tmum ot0tle miciltlm rlums;t)trtnmr3oa1fmDeli ils)setoirpiudopte feiat s2rmxmo;t0ope ifctysla rmnmo;(4trxoiociodfate nes;t)t2xrxm3oudlm emnvtls srrm(r ou4optnmf3iytls2ulu snt0artomr oodlmDrlnvi;( t2xm(opoo1lpeemicta() Dtmx  nt4tlt ii3iys a2rmuvont4teeoxociatla  ai s;s truoxo3oo4am   fet s)sDurur ;o0aee io3iyslm ea(vs;u0tlxrxf3ootfpDranvi;s teurxopoo1amtelncsltf rrrxmp;t1tlxo fetas m uanmsnt4arermf oadlptrlivi;t) rtm(rpnu4omt mfes tfaDtr(rp;u4oetniiciaslm2elu s;u0 exnmr3tadfpDrluvsl(0sexoxr3ny4lptnlnci () 2um( pot0aet mi3tas a2elnms (0 eermf oytfmDrlieo t0tetoim3oo1ope  ivsat)a2tm(m ;t1aetnioeiytls ul(vsnu4trxnio oytomtelieo;s0 2uoim io4lle lfctat)s2rm( ooo1apto ieias sDuauvsn()areoxfctodlaDrluei t srurim3oy4op nlfet t arrm(mooo0olenifeiatfa2rm(vs;t)trxnxrcto1fm raivs s0seuoxmpno1ome mfvias)a2ra(r no1alto oeilt a uanmont4artnif3todoa r u s;s)setrxrpoudale mivta( arrr(  nt4oex ifcilt aDel( s (4 lxoifciodfp eliei (0setriopny1ll elfctl(f 2tmur ou1tlxn i3tyt a2eaums () rxnirctytlaD  nvsl() rtrir nydop nmfeilt)sDur( o;u0aptnmf3ild s rluvsn(4 lenxr iodoate uvo;s0srurir iodlmenmfes s  Drrumo;t0opxo f3iysls ulnvo (0trtnmf3ta1oaDe n ils t2xoio3oodoltemici ()a2taxmono1ape mieiyd m rauvsnu4 rxomocia1lm elnesls sruoxo nudlm e ictl(  2rm(  oo0tlt ioeiadlsDua( o;t4areoxr tatlpt  neol()t2uo(o iy1lp e nvtltfs2tmurpoo1tex  octatlmDem( o u0alenmr oadlatrlnvolt  rtm(o io1lp n fes t sDumur nu0teenmo3iatlm2emuvs;u)tltrirciotlm eaieo s0trtmio3iy4opee ivta( a2rr(mp;o4tee  feias sDelu p u0 eeoxfctydopt livsl( sexoir iudaltn ics t)a2ur(mono0altomf3iadlaDul(vp;(0 lxoxr3iodoa  au o;s0 exoio3nu4lm  mictatfsDrru p;o1tptomiciys m2ua(msn(4 lxrmo3tytfmtr i ol( seur(o3oodlm emnetas) Drmur ot1oetoio3tatfm2rln o;(0tltnmf iatop elivils0t2xriopoydomt mfctltf rtaxm oo1olx ioeiadfs2elnvo ()arxoiocoo1oaDr ivs;t  eur(mpnodlme  fvsltf Draur ou1ole moctatfa2rau s u0trxnmf to1latelneolt)setr(o3io4ol   nci s artmx p;u0olxniiciys mDrauvs;t0tetomf to1opD au o s0 2xmim ou4omtnlieias)a2tmu onu1oex mf3tatfm uan s;() rtnmf3ta1lp   ieslt0 2xoim iodomenlnvils)aruaxr ;o4alen oeiltfmDum(msn()trtoxrcoo1faD  ivo () rtrxo3nu1opt lnctlt) Dtaxrono0tpt  o3ildfsDea(mo;(0texrmf3iytlpDelnvs (0s2ur(o3iu4opt licilt)s2uax oou1alxnmoetltfs rm(mont) rermrcoo1lmDe u s (0t2urxr3nodlme  ics ()arra(rpoo1aexoiictlt aDea( pnt) ltrmrciy1fmDe uvils)t2tr(opiydolenmivilsfa2tmx pnt0altn o3ildlm rm(mont4 etomf3iotfaDean i;() ruoxo3ny1op nmivtat)artau  no0tpx mociydfaDuaumo;t0 rtrxr iodfp  ln ils trxoiopny1ll emiviltfsDraxmpou1aeen ieiys mDul( on()aeenmrctytopDeaiei;()trto(o3nodlm  lnctl( aDrrxmpoo4aetoiociltfa umu s;u4 leomr3oydoaDraueo t)trtmxrpoy4amtn ncs ()sDrmu pnt4oexn f3iyd s rmnvo;() rxnif tadfmDr ies ( srxm(m nudlp  lfcias aDtm(mo;u1oltn ictadfsDemnmon(4 ltrmo ty1om eanvs t0s2uoxm iu1omtnmieil( sDrm(mooo1oltnmociyslsDrlnvo;u)aeermf3totlaD au o (0 eumimpoodale  ieilt  rur( ono4tltomiciyslaDelump t4 exnxr3todop   ivo t  rtrir oudope mfcsl(f 2tr(rp;u1aee io3iadfs ulnvon(0texnirciatlm ran i (0 2urxrpiy4apt lfctl(  Drr( ono4tetoioeiaslmDul( s u0tleoifcoydlmt lues (0 rum(r iodlm e netatf rurxrooo4altomfcildfa um( o ()tleoif3io1fpteli olt  eurxo3nu1ame liesl(fsruaurpoo1apeomo3tasfmDuluvs u)arenxr to1lmD lnvs;s0 rurir iy4al nmfvsls  Durxmo;u4oleomieiat a2ua( onu0aexnmfcoadfp r u o t sexmxo3oodape lies sfartau o;u0tpenmo3tlslm2eanvo;(4 etnirctotom   n o;( teuo(r3io4amtnmiciat sDraurp;u0apen fciydlmDumnvp;()areomo3iytoa r i o s0trur(m3oo1ap  lfetl()s2rr( pot4tet mfeiytlmDrmnmp;u0aexomr to1omt  ieo;s0 eumxr nodlmtn fes ()srur( pnu1apxniiciydls rau s (4trxrmr3tydlp eluvi t) 2urxopno4omtn fvs t)srraxmp;o4tpenifeiysfmDumnmonu)aexrmo iydoaDe ivs t srtoir nu1al e nvias a2tr(r ou1apxo i3ildla2umuvp;()arxnxf3ta1lpD lnes (0texrxopiy4aleemneiat)a2rrxm no1aex mo3tlt mDel( p (4altnmr3tatom eln i ( srxm(m3oy4llt  ivs s)arurx o;o1tlen oeiadla2rlu s (0artnxrcoa1fatrlueslt) rxrimpnudlmtnlfetls)a2ua(rooo4teen o3tltlaDrm(vs t4 rtomr3oy1la rauvi (  exmxo oy4aleemneiltf Drrx  ou4oex mociat s2rlnmo;t4 lxnircio1oat  u s ()setmirpno1am nlnctl(fs2rm( ont4apt iictad sDrmu on(0trtoxfciadfp rlivi;t setrxopoy1alt lici t sDurur nu0aex ifciatfm2ra(vp () ltnifcoatop   ieo;s0 2uo(m3iu4amtnlieils aDua(r no1tpxnio3iytfm2el(ms;u4 rxnio tadom raneol(0 exrirpnudapenmiciasfaDtmxrp;t4aptn ociadlsDumu s;t4texnif io1fp  lu il(  eumxo3oo4ale livta(faDraxmoou1apenif3ilsfaDel( onu0aexoxfcia1lp e ueo s0 rtoxm3iy1amte fei s)a2ta(rp;t0tex  f3tlt aDulnms (0 etrircoy1fp  anesls  ruoirpiu1lptnmneslt) 2rax pnu1tlen oeiadlaDrmu s;t0alxrir oytfmteanvsl()seuoirpoo1op   nci sf 2uax  nt4olx moctas aDuaump;t0treomrctytfm ranvo t)s2tr(r3nodlmeemnet s)artrur ou0opxn f3tytla rlumo;t)trenir ta1lat auvols0trxr(rpno1ll emivsl(fsrraxrpno4tpxoiieiatls eau sn(0 lxrxr iy1la  anvsls) etr(o iu4olt mfctasfsrur(  nu0aetnii3tadla elums;t4alxnmrcoatfmDrlies t srtr(o3iy4llenmfvta(  rumxrp;t4tet mieiltls2rmuvs;(4arenxf3oadoptr nvsls t2toxmpno1aleemfct (f Dtru  oo1olxomoeiysls ean ont4tetoxr3iydfpD lieils  2tmio no4olt  ies t)aDrax  nu4altn oeilsls ulnmpn(0artrxo oo1lp elneo t0 2xrirpnu4lpen fvsasfsDuaxr ot4tltnif3tltfaDumnvsn() ltoxo todfmD aivsls0srxoimpnudop  lfct sfarumxm nt4tpxnmieiytfaDem(vp;()aeeriocia1lateanvil(  ruo(m3iu1ol nmnct t) 2umxmono1altomieiytfaDum( s (0 etrmr iydfmDelneolt)tetrirpiudlpte fvi s s2tax o;t0apenmf3ild sDulu p t0 renirctodomt livi s)sexriopio4lm e fetl(fs2raxm ou0openio3tad a ua( o t4aeeoir3iydop   nei ()t2xoxr3oudlm nmnvsas) rtm(monu1ale  feias s emums u4 lermr iadfaDrai i s) ruoimpoudolt  nvtas)artmxmono1opxnii3tydlsDea( p u0 lxrio oytla e ivi s  rtr(o no4lme  ivi s sDtau pno1tleoii3ilsfm2umu o (4areoir3tytfmtrlnesls  euoiopnu1lmtnlnvt t)aruaxm ou1oetnmoetytlsDrln s ()altrmrciy1lmteliei;( t2triopou4ape mfeilt sruax oou1ale moetas aDulnvpnt0 rtnmo3iydomDean o ( t2urxo oo1ol   fes s a2rmxmonu4aetoio3tld a2rm(vpn()aetrifcoo1om rlnesls) 2xrxm iudlmte nvtasf 2umur ;t4aexnif3ilt m2rauvp u4alenir3ootlpDelnes;t)t2xr(m3nydamt  fcsltf 2ua(m ;o4opeoiictad mDrmnmp t4tltoifcta1fpt lnes;s) rxmxr ou1lm  mics sfs2ra(m ot0tlx io3ildfm2emn p;(0arxnirciodoaDeanvs;t0 etoxr3nydlmee feilt  2truro;t4apeo feilslmDuauvo u0aexrif3oa1fp r uvo s0setrxopnudlm nmivi tf ruaum nt1oeto feiltfmDrau o;u)tleoir ta1lmte n i;t  etoiopoy4lpenmfci (fartmxm nt1optn octydls umn o (0tetnxfciy1oaDr nes;s)s2uoxo iudale mfctl() 2ta(  oo0ope  fetyslaDeaumsnt4arxrifcoadfaD aieo t)sexm(o3io4apenmietltf Dtaurpnu1apenioeilsfm2umu p u0alxriociy1faDe uvilt0seur(o3iodape  fei t)srurxmpnu4aetomfcilsfa ea(vsnu)trxoircoodfpD luei () rxr(m3ou1ap emivtat  2ur(  ;o1oetoioctltfs2ua(vp (4trxnxf3tytfptrlivil()t2xmxmpou1oltelfei sfsDurumpoo4tlt iociydfaDem(vs;() ltnxr oo1omt  iei t0trto(rpoydlmteliesl(fsrraxm ;o4olt mictatfa2ranmsnt0aleoifcto1faDr nei;t)srurxo no1lpee net ()sDtmu p;u4teto f3tat m2ra(mo u) exrxf3oadlateaneils)sexoxopio1oleemictlt aDrrum ot4olenmfetysls2uanmp t0 rerir tydoaD  neols srxrxr3iy1ale lnctlt) rtaur no0alenmf3tys a2rlu s;t4alxrmrciytom rlu s;(0trumio iu1lme  nci s  rtmx  ot1tltn icils mDuauvs t)aexomfcto1fpt an o s)trurio iydol nlnct t aDraumpnu1apx mfetlsfa2ea(vont4trenifcootlat  iei s teuo(m ny4omtn fei s)artm(rpnu0olt mi3iysfaDrm( pn(0tltnxf3iatfmt  ivo;s)s2to(r3nudal elivia() rumxmoou4tlx iociadfaDemumsnu0arxoxf ia1fate neilt s2ur(r3io1omtelieia()aDtmxrpno0tltomoeiatfsDrmn onu0trtnxo3io1oaDe ivols)trurir iudlme mieil(f 2rrur no1oeto oeiltfa eau pnt)tltnio3ta1fpDeln i t)t2umxr no4ll n nvs t) rurxrono0tpe ioetldlaDrm( s t0texnmf ootomtrln ol(0 eurirpoudalee ieiltf Drmxmpou0optoiiciytlsDea( o () rxoio3to1lmDelu ols) 2xmir iu1lm emfvsa() Dtr(rpoo4tlx io3iltfm2rl( s u)aetrif3oatfmtraieo;s)s2tmxmpiy1lle micsas)s2um( pnu4tet mf3tytfm uan onu)artnmr3iydla  lnvi t)seumxrpoodolte fetas)arurxmpnt0tpeoiieildfmDelumo (0alxoif ootoaDe ivil(0 etrxo iy1al elnei ( a2rm( p;o4aetn ieiydlsDemuvs (0 exnxo io1lmteaueo;t0srtmio3ny1openmici (  Dtrxrp;u0tlen oetysfa em( s u4artomfctatomD  uvi t  rxo(o3nu4ope  fvtls a2rmur ;o4aptnioeilt a ran pnu0 etrif3oy1lm  lieo;s0trxrim3io1apen netls) Dtrxrpnt1alx iociasfm eln sn(0alxomr todfpD  nvol(0 euoirpoy1lm e ncsa(faruax pno4tetnmoetltla2eau o;(4 rxoio3iadlmDe u ol() rtm(mpnydome  nct t)aDtr(mpot0aetnmfcilslaDrm(mo t4 eenxo3to1oaD ai ols) 2uoir3iy1lp e ivt sfsrrau  nu1oltomoctytfs2rm(vp t0aetomrctotopD ln ols)trxoimpiydol e ivtas srtaxmpoo4olxomoctltfs elu on(4alxrmrcoy1lpDeaueo s0 ruo(m3oodape mfvt t)sDua(rpot1ope ioeiytfmDrl(mo;u0tlermo oo1fmDr nvo;s  rxrio3oydlm n nctasfsDtru p;t4tpx io3tas s em(vsn()artnmo3io1lmtrai slt  rumxm nu4om n ivsl() 2uaxroou1oetn i3iatfm ranvsnt)tlxnircty1lp ran ols)s2urim3nu4omenmnet t srtmxr oo1olen iciysfsDua( p;u)alxrmf oadop rauesl( s2umirpoydlltemfeil( srtm(mpno4oet ifciysfs eau snu4arxrmociadopD aiesl()texr(o3iodop  lfvi (fsrrrxrpou1tlxoioctas a2rl(vo;t4aexnir3ta1fptr ues ( t2xoxmpiudlle lietl() Drmxrpno4tpeoii3iyt m2emnvs u0 exrifcoytfmDr ies;()texoiopnudamt  fct (fs2uaurooo0texn oeiad s rl( s;t4 reoxrcoy1fa rlivs s0 rtm(r3no4alenmnciltfsDrrxrono4oeeo fciysfm rmn s;u0tltrmo ta1fa rli i;t) 2trxo ou1ame lnei (fa2ua(r ou4olx mo3tltfaDuan on()tlxoxf ta1fat lies;t0s2xmxm iodaltnmneslt)sruaxmpno4tpxnifeildfmDrlumsnt4trermrcoodom  liei (0 2xr(mpny1opt lfvtls)s2rmxmp;t1oeeomociadlsDrl( p (4 etnir oytfpD liei ()trxoxopnydopee ncsat)arrm( ont1altnii3ilt aDeanmo;u)tltnmfctatlaDeaueslt) 2to(o nudlltn iciasfs2rau ooo1teto oeiysls ua(ms;t4 exnifcta1lm e i i ( t2toxr3iydlp elici tfs2ra(rpot4tpx if3tld m rm(mo ()tltnifcta1lpDr i o;s tetoxr no1alenmfcsa()a2umur ou1apx mo3iasls rl(mo;u0 lxnif tytlaD livol(  2xrxopio4lmee feil(  Dtrx onu1aptoii3tlslm2rlump;u0arermo to1fp   ues;s) rxo(m oydlp  lnvtls)artrur ou0ale miciltfsDuan ont4 lxoif3iadfp raueils)t2to(m3no4lle livta( s2rm(rpot0tpe mociysfaDumnmpn() eerxo todom  aies ()t2xmio iudllen ivt s s2rmurono0ape moetydlm eanvont0tlxnxr iytfa   uvi t  etoxr3nu1ll nlieilt aDur(mpno4tetnmfeiytfa2uln s (0aetrmo3iodom eanes;s0s2xmxo io1lle micsa() rua( p;t4opx ifctadlm2um( p (0 eenmr tytopDr n o;()s2toim3ny1lm emneils aDtr( ooo0olxoiieiatla ulnvo u4trxomf iotoptranvs;(0srumim3ou4omen ici t)a2rr( ont1aexnmieilsls emnms;t4alxoxf iydoptelneslt sruriopiu1alenlncsat)sDur(ronu4aeeoiieiadfs rln p;()aexoxo3iatlmt aieslt s2urio nodomt  neias  ruaxrpoo4oltnif3iat s uauvp u0trxomr iytfp elivol()sexmxopoo1openmneilt aDuauro;o4tpe iicias a2rmuvpn() reoioctodoa ean ilt)sruoxo iu4omtelfesa( aruax  ou4optomo3tld a eauvpn(0arermo3iy1faDranes;s)tetmim3iy1omen ici t) Drm(m ou0tpx  f3tyslmDrl(mp;t) exoir3iy1om eaivil( trur(r3iu1oltemivt s  2umxmp;u4tee  icild mDelu s;u0tltnmr3oa1optr uei;t0 exrio oy1ole mncs s)a2tm( pno0tptnifeiaslm2emuvs;() lxrmo3iydom rln o;s0t2xo(opiydlmte fvt s srtaxr ;t4oet ii3iadfa el(mon(0 rxrxf3ia1fpt  i s (0t2tmim iu1om nlietlt  Dra(r ;u0oexomictas a2em(vs;(0altoxf3oodlaDr nvs;()trxo(rpnu1amt lfvsat) rra( o;u1apeoifeiaslaDrluvont4 etoxo3tatlmtrlu o s0seuo(opiy1ap emfes sfarta(mpou4tpx ii3tad s2ea( ont0artoxo ta1lmD aues;(0 rxoxm oodole lfetat) rrrxr ;u0aee io3iadfmDelnvp;u) rtrio3todom raueol( s2urxopnodap nlfvtls  2tr(ro;t1aetniociysfs2eaumo u) lxrifcoa1fm e uvo t0seuo(r nudapee ncia()sDuax o;t4tle mf3iytlmDran ont0 exnif3totlaD anvils) rtoxo3ny4ope  netltfarraxmpno4oeeoii3iad s2um( s;t4teenir tydomDr ieo;s)seuoxm no4olt  ivta()sDtaum no4opxn fctls mDul(msn(4trerif tydfp  ai ols)seuo(m3iydalt  fvsltf 2rax ont4apxnif3tad a2emuvo t0arxnmocto1fm raivo;s s2xrio oudom nlics (fa2uaxront4oltoifcias a uan s u4tetrio oatoaDrlies ()t2toxrpnodapee ici s)srraumo;t0tlxn octadls2umnvpnu)tetoir oydfateanvilt0trtm(o3nydam n ictat  rrmx pnu0opxoifciat aDrmnmont0altnir3io1omDr uvi s0 2umir ou1aptn nvia( s2uaxr oo1oetn octldfs rmn pnt0trtnxr3oy1lmt  i sl(  etrimpiu4oltn fvtat s2ua(  no0optomi3iys sDulnvsn(4 lermoctatlpDeaues;(0seto(m oo1op nmfeiltfa2urxmont0tpeniociatlsDeluvp u0altrifcta1optrlnvs;s s2umxr oudamen fcilt)artmxr no1apxo ieiyd a ran snu4 etomocoo1oaD  n i;t  rxo(o ny1op   fcta()s2rmxrp;u1tpe io3tydfs uln s (0aexomfciytom raivol(0 etmxr3oy1al   ieia(f 2ta(root4oeeomictydlaDrlnvp;()trenxr3tadlmDelu i;( sexo(mpiy1op  mietls  2trxmpno4oetnmi3taslaDum(vs t4trerxr iadfatr i o;()srxo(o iy4lpeemfeiasf 2tm(m ou0oeeniiciatlm2umnvp u4 rtnxr tatoaDeaivsl()seurxopno1al elnciat)aruaxmpno4aexoifeiysla rm(mo;u)texrmr oadoaDe ieo (0tetr(m3ny1ap n fvsatf 2uru ont1tpto f3tysfsDulums u0arenxo3totlpDrau ilt0 eurxm3oy1am elfciat)a2ta(m ot0ole if3iltfm2ea( s;u0arxnio3tytopDranvo;(0trxmxo3ou4lp   nviat)a2tax  ou4tetn f3iatla2umu snt0 etnmocoydfm eai s (  rto(r3iydal e ici t)srurxmonu0aexoiociys sDean o u)teerxr3iy1opDraies;s0tetr(r oodal  lfetas srtrum ;o1aet  feiad a2ua(ms ()artrmrcoy1lpteau i s)srtrxm oodlptnlieta( s2rr( poo4tpxoii3iatlaDrmnmonu)tlxnmfcoadfatean il(0t2umirpnudll  lfcs tf 2rm(r no4tet  ictld a2emuvon() etoxr3ta1fpte ueo;( s2xmio io1lmee nct ()s2rmxmont4oee  i3ild m ul(ms (0texnioctotfaD  i o;t0t2xr(m3nydop e nvsas) Duaurp;t1teenifciytfs2elnvonu4 lxnxr oo1opteauvi;t) rxoxr3nodapen ieta(fa2tm(moou1olxn ieilsfsDemn p;t) eeoiocoatfpD li i s)t2xo(m3oy4llee ncta(fartax  ot4aeeo ieiysfsDul(vonu4trxoxf io1lmte u o s0 2tr(r3ou1ome lfei (f rrm( poo4opx mf3ias sDemuvo t0tltnxf3ty1fpteaivi;s0seumxrpoy4al e nei s  2tm(  nu1teenmocils m umu o;(0tetnio iotfaDrluvilt)s2toim3oo1altn ivslt)srtm( o;t4apeomf3iasfmDra(vp;(4texnxr ootlm   i i t0trxoxmpno1lme  nvtas) Drau p;t1opt ifetydls2umn s;u) exrxrcto1lpt auvi;s trto(r3ou4ap elfcs s aDuax  oo1aexomoeildfm2em(vo;(0tltoif to1oa  auvi (  rxmxr3ou4om e ivs t aDtmu o;t0opeomfeiydfm ranvs u4 eermoctotlm eauvo;( trxmiopoo1ll nlfvilt  2tau pnt1tltnmoeiasfm ea( s;(0tltnmocoodom rliei;s0teumiopnydll   ivs t) Dtmumonu4alxoifctytfa em( o;(0aleoxrcia1oatelivi ( tetoio3iydapt mnctlt arur(mpoo4teeoioeilslm rlnvs (0 lerircia1oa e uvols)srtoxr ny4lpt lfvi sf Draur nt4aptoii3tas s2ranmp;t)teeomfcoadlpDeanvs t0 etoxopoodlle  ieilt) Dum( p;u1oleo i3iatla2emums;t0tlxnifciydopD an o t) rtmirpny1ole  ietlsfsDtmumooo1apxniieiasfaDul(msnt4arenxr3ia1fp  aiei s0 rtrxo3no4ale lnctlt  rumurpnt4tlxn feiadla2ulnvp;t)teenxrciy1lm   i sl()texmimpny4omt mfvtl()a2um(r ot0tlx  fciytlm2emnms;t0tetoircty1latr i ilt0sexmiopiy1aleemivs sfa2tmu  ou0tpenmfcilt s ulu pnt0 lermfcoytoa rliei;s s2xo(r iudamee iet (  Dtrumo;t1tlt  oeiyt m2ulnmsnt0 lxnxrcoodla  au i t0tetrim3oodlm  lnet t  Drrx p;u1olx mfctlsla2emnms u)tlenmf ta1optrlueilt)tetrio iudal  mivtltfaDrrxr oo0texn iciytfsDemn p t)tetoio iado
\ No newline at end of file
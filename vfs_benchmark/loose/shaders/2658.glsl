@@ -0,0 +1 @@
+iei;s)trxoir3oy4lmtnlnci t)a2rmxm nt0opxoiiciadla ulnvp;()aexnmo io1oat lies ()sexoimpnu1lp   feslt) 2rr( ont0tpxomf3ilsls el( o;u0teermf oydlp rli s;t)s2xmxr nodop elnvta() rrr(  nt1ope mfciadlmDrluvo;(0 rxomr iy1omDe uvs t)t2tr(o3iydoptemnetl( a2tm(monu0oee mi3ilt a em(mp;u0 lxrxfcoy1lmD lieols)t2ur(mpoy4op emics sfa2ta(rooo4ope io3iys aDrl(vpnt) lenmf3oadoaD lieo s)setmxm no1am   ncia(  2rmxmpot1aex  oeiatfm2rm(vp;() leoxr3iydlpDrln sls  etmxm oodlp emfetl(fsrraxm ou0olxnmictltls2eanms u4arxomo3iytfatr ueols0 eto(r3iodlltn nciat sDtaumonu1opx  feiydlm emumo;u0tetoio3ia1la e u o;() 2trio nodlle lfvt t arum(  ;o4aexo o3iadfa eanms;t0 rxnifctotfateaieo;( t2umxr oydlm nlnctat)srtrx  ou1tpe mietyt a elnmsnt)treoio3iytoaDeln i;s texm(r3oo1ame  nvsls)sDuru pno4aleoifcils m2rl(mp u) exnxfcoodla ran s s) exo(r3iu4am  mncs (  rrmu  nu4ole mf3iytfmDeauvon()arxoxr oadop eauesls0srxrxmpiy4ol nmiei tfsDraxm ;u0altn ietadfs2umn s;u4 reoxf iodlat  i il( tetmio3ny4oltnmieia( sDtrxmpno1alx mi3tytlm2ua( s t4 rxnmr oytlptrauvils0 rxrxopiu4ap   fctlt aDrr( ooo0oee iieildfm2ua(msnt0tltnir3tadop eaieil( truoxmpno4ope mfeiat) 2uaurpou4tlxnmocild m2uln snu4arxoio3ia1fm  lieo s t2xmxopou4lmenlfeta()artm( pnu0apxo f3iad sDran p u0tlxoifctytomD  u o t  exrimpio1lp   icia()a2urxrp;u0olx mf3ild s2ua(vo;(4arxniocto1opt auvs t0sexmio ny1opt  ivilt  Dtm(m ot4aex ii3ilt m2rmuvo u)aetrxoctatfmD auvi;(  rxmxopiy1olee fcsas  Duauront0alxo feiytfsDemnmpn(4tleniociadlmD luvi;s t2to(m3iy1op nlfvs t) Drm(mpoo1tet if3tyt a2umumsnt4 rxrxr iatfmDeauvo () rtmxmpio4om e ict (farumum ;t1olxo ociyd mDemnms u4arxoifctytfmtrli ils t2xoxmpio1lpen fvt tfaDtaxmonu1opx if3ilslsDel(vonu)aexnifcty1la r iesls srtrxmpio4ope lfciat)aDurxrpou0opt mi3tys s um( s;(0aexnxr3iatom   nvs ( trto(opou1amtnmics () 2tmxm ;t0tle  ieiatfs2ul(mp;t)tlxnmo3iy1lm  lnvs t0s2tmir iu4open nci (farurxm no4tpeo f3iltfa2el( o u)aexoio3oy1fm   nes s0seuoxr oy1am   nvt ( s2rau o;t0opxnifctadfa rauvpnu0texnxf3ta1opDelnei (0 2uoio3iy1lp n ivsltfsDur( pou0apxn o3iadlmDul(vo;(4tetoir oodfp eliei s0texr(m3oodamtemnvil( s2rrx  ;t1tlto oeiad m2el(vo (4aetnxo3iatlpD lueo;s0truoxopnu1am nmictls)a2raurp;u0oeeoifeiatfsDuauvo t4arxrir todlpt  uei;()tetm(mpoo1alee ivtls)sDurxrpno0tle mfciatfm2rauvp (4trtnxf iodlmt  ivs (0sexo(rpnu1open ncsl(  2urxr no0olxnioeiaslaDra(vp;u4 renmf ty1oaDeau il() rxrxo oudol n iei sfa2ta(  no4aetnif3iad a2ranmonu4aexrxo3ty1lm e nes;()s2xmxmpoydopee fesl(f rra(mpnt1opx  oetys mDuau o;() rtrxfcta1oaDrauvs ( t2um(r3iodllen nvs ()s2um(  ;u1tpx mi3tlsfm ea(vp u4 lxrmocoadlm  lnvo;t texrimpoudome mnvt s a2trxr ot4tpen o3tltfa2emuvo;t)teerxrcoa1la  livs;s  rurio3ny4ameemivs t)aDurxmonu1opeo octyt m ea( p u0tlxrxr iodfat ai o;()truoxrpou1omtnmnvsat) rrax o;o1ole mf3iyt m2elu s (0trerxocty1lmt  uvs ( teuoxm3iy1amen fci (f rtaxrpot1apxoiictltfm2rmuvsn()arermr oo1lp ranesl( seur(opou4lp elfct sf rurxrooo4apt mo3iyd s2rluvpn(0trtoxo3oa1laD lueols srxm(rpnodopt mnesl(f rrrum ot1olenmfeiad aDrm(vs u0aeenif3oatoate nesl() eto(o3iy1amte fet ( a2raxmp;o4altoifciatlm2rluvo;t0aeeomr3tatop eau il(0 2xoxopiy4al   fvi sf rumu oou1aptn feiytfs rlnvsnu)aeenxo oytlaDr uvo s0seum(rpoodomtelfvils s2raxr no0ape mo3iydfm2uanvp u)texoio ty1oaD  neo;() 2xriopny4om   nvtls  2rrxm ou0opt  i3tysfsDel(vo u4 rtrxr io1opt  nes;(0tetr(r iudal emfcs s) rua(moou0ole  ietytls2elnmp (4 lermr3tatlmDr n o ( srurxo iudol nlfet s  Dtm(  nu1teeomo3iasfm elumo;(4 etnio oytlpDelu s;(0s2xrxr oy4omenlnvsas) 2rr(  nu4oeeo ieiys m2umnms;u)aeermf3iodlmtrln o;s0trxmio oy4ame mfviatf Dta(r ;o4oeen iciysls2el( p t0tlenmfcia1fpD  uvs;()s2tr(opnudolt  ictat srtr(r nt1olen i3iadla eau pnu)alenxo3oy1opD anvolt  2um(m iu4ol nlictls sDtau oot1texn oetatls2rlums u0alerir oy1oa rliei t0srtm(m3oydlmtnlicsat  2tr(m ;t0oet ifeiatfm um( p u4alxrifctytoa rauvslt0 euo(rpnodlle lfcs sfsrrru pou0optnmieildfmDrln p (4 rxnifcoo1laDranvi s0trtr(mpiu4olt lnctat)artmum nu4tex  f3tys aDrln s ()trxoxr iodopDrln sl()tetrio nydom e ivs t sDtmx o;t0tleo o3iytfm uaums;t0 rtnmf ta1lat ln s;t t2urio3iu4lle mnvtlt  2rr(m nt4tptomiciydla2em( p t) eerxf3tytfp rauvo;t  exoxr3iudll nlnetl()srra( pnt1aet ioeiytfsDrau p t0trtoxo3ia1fmD livsls0teum(m nudlmtelncs ( aDraxmono4teto f3iat mDuanms;t4teerif3iydop ranvil( tetoxmpoo4lp nmnctlt  Drm(mo;u0tlenioctatfm2uauvp u4aetnmo iotfmt ai o t  2tr(rpny4lm nlfes s)sDtr(r ot1ope mociasfm2ra(mp;u)tlxnir to1lpDrli i s) rxmxrpoo4apenmncil(fsrraxmoot4olxniicils a eanmo;t0 exrir iotla  lueo t0s2uoirpoo1lp nmfetas)s2uaxrpnt0altomoctlsfs2uauvo u)aetomrctotlpt auvol( trxoim oy4omte ici ( sruaxrooo0aeeo ieiydfs ra(vo;(4aexrir oodom e neol(0tetoxrpiy1aptnlfcsas arum(m nu1opeoio3ils aDra(vont) leoxo iatfmtr neo s t2xo(m3ou1oltemfet s aDuaumoot0aeeomfeilslmDrm(vsn(0tltnio ta1op rlueolt0 rtoir io4amee nvils a2rau  ot4opxnmfeiyslm2ra(mp;()treoirctodlmt  ivi;()srto(rpiodlme  ieiltfaDtmum ;t4tex mi3taslmDemuvo;t) lxnxfctodoaDelnei (0 eur(r3ny1lmtemneil(faDta( pou4oleomoetadlm2uauvs u0arxnmo3totlptelnvol(  etr(r oudopee fvs (faDrruro;o4texo oetyslm2rmnvon(0alxnxf iotlmte ieo;s0 rtoxopoydlpenlivsa( s2uaumoou1teeoiieiasfs2el(vs t0tlxoxr ootlpDean o;s) rxrxmpiu4apeemnesl(f 2rm(mp;u1alt  o3tysfm2elnvpn(0 rermo to1fmtr uvs;( teum(m no4llteliet t)aDuaxrpoo1aeeo fetad m2umnmo;(4trtnxf3io1oa ean o;s tetoxm ny1apeemieslt)srraurpnu1open oetyslm elums t0arxrmr iotoate ivo ()seum(opou4oleemieiat a2rr(rpnt4apx iiciyd sDea( s u0texnxfcoytlateauvilt0t2xmxrpoydopt licslt s2tmxmoou4tpto oeiad sDeanvon(0trtnxfcootfmDrlnvs t0 rto(o nodop nlfvi t  rtr( pot1tet  oetytfmDrmn o;u0trxnmociodlatelnes ( srto(o nu1op elneilsfs2ur( p;u1oltoii3tys a rl( o;u0treomo iodla eaivslt)t2umim oy1lpe miet (  Drr(r nt1teeomoeiys m rmnvpn(4texrmr totomD an o (0s2umirpoudlpe lfcs ()s2rmx pot1altoioetat s2rm(vs t)artrmr oytoat  nes s  2trxmpiu4lp emfvsls)a2tru pot1aee miciytfsDulu o;u)aetnir iatfpD aivi s)texrxm3nu1ap   ictltfa2tauro;u0oet  ieiatls rau pnu)alxomrcta1fmDr u i;( t2to(opiodamee fetas srtau pno4oex mietltls2ua(vs (0 exrmo oa1oa e uvo;t truoimpoy1ol nmieilt  rrrxro;t1oex  iciadls rlnvo t0 eermo3oytlmDeanvils0t2xr(rpno1optemfcsls)a2ururpoo0tet ii3iydfaDum( p (4artomfcoo1fpDraueo t t2xmirpoo4lmeemfvt (fsDta(  ;t4oeeoioeiysls rlnms;u)tetomo iodoat anvs;(0 rtrxopoydalt mivtlt)sDuaxmpoo0alto feild m ulnvp;u)altrmrcoadfatean ils0s2um(r nodlmte nctat aDraurpoo4aeenioetytlm emu snt4texrmr3iydlp rlu i;s0 etmim3iu4lmt mfvtl( aDtrxr nt4opt  feilsfs ranvpnt)aleoxf3oydom rlieo t0 rxrxm oydlpenlfctls)artau  ou4alt  i3iyslsDrlums;u0aeerxrcoytfmDrln o t t2tmxmpio4oltnmiesas s2umu pnt1oetoiieiat s ulu o;t)texoxocto1opt  u il( s2xm(r3nu4lpt  nes sfarumxr nu1tpenii3ilsfsDum(vp ()aeeoxr iatoa r nvs;s) 2to(r iodoltnlnvsat)sDtaxronu0olxnmo3ilsfs uauvs u4teerioctodfpteluvils0seuoirpoo4apeelfeta( srum(m ;t1tpxo o3iasls uan p;()tetnmfcia1fm raies;t srxrxr iudame lfvsas a2rau  ou4oetnif3tytls2rmuvp u4tlermocio1lmDr ieo;t)teto(rpoodolenlfct s)srtruro;u0alt mo3tydfs ul(vo t)alxrmr todlatrai ol() exoio3nodal   fei tf 2uax ono1oexnmi3ilsfs uanvsnt) ltoxociytomDe uvs;() rto(opiy4olte nci s  2rm(rooo1teeo oetltfm2emump;u0artnmr io1lmD  ivi t0s2tm(mpou1op elncsat) 2tm(mo;o1apen f3iad m elnvpn(0 lxomf ootopt anesls setmiopiydop  mici tfsrrmurpnt1alxoiocias s2el(msn(4 lenxrcoytopt au o;s)s2um(m3iy4ole mnctls arraumpnt4tle iociyt a2ulnmsnu) exnxr3todfmt au ol(0truo(opoy1apenlnciat s2rm(mo;o0oeeomi3tasfaDuan o;t)tetoxrctatoa rliei t)s2urxo3ou1lm elict t srrrum ;t0tptn oetlt s2emnvp;t4 lenio ty1opDraues;( s2toiopoy4lp nmfcs (fa2rmurono4apen octysfm2umuvp u)tlxrxfcta1op raueolt  exr(rpiydop  lictas)sDrrxr nt1opt iocildlm el(vo (4 reoirctydlptrai ils s2tmxr iy1ame licsat  Dta(r oo4tpt io3tlsfa2um(vo;u0 ltrmo oo1la rlueilt srxmirpio4lltnmnvs s srraum nu4texoio3iadfsDrlnvs u)aetnio3ta1om  lu sls trxo(o ny4ol nlnvsa(  2umu  ;t1oltnmoeiysfa rmumpnt0artrir ty1omt lnvo t trxr(r no1ap nmics t) rrrxroou0optniiciatfs2rln p (0 eermrcoytoatrlu ol( trtm(r3iy1lp elnvs s  Dumxrono1aeeoioetyd s2ea(mont4arxrxo3oytop rai ils0seumxm3iy1ol  lictasfa2rm(mo;o1aexoii3tadla uaums;u4trenircoadfa elnvils0 2uo(mpnodllenlfeil()sDtrurpoo0altn fetyt s2ra( s (4aexrmr oytfmteauvs t)s2uo(o nu1ameemfcta(  rtruro;u1tlxnioetadls ran pnu0trtoxo iytfaDrlivolt) rtmxr oudaptelfetat aDraxmo;u4oexoiieildfmDemn p t) rtrxf oa1fm ran i;t0 exrir iudaltelnei tf rraxr oo4oexoifctldla2eluvont4 rxrio3oadom  auvs () 2umxmpiodom   netas)aDraxm no4tltomo3ilsfs2uln o ()tlxnmo3oo1fmt lnei;t0s2urxrpoy1al n fes sfs2trump;o1alt iociltfs ulumo t)tlxnircoydfa   ies;s)trto(mpio4opte fct ( a2rm( pou1tlx  f3iydfm em( o;t4trtrmo ia1fpt an s (  2trim iudalee nvsat  2tmx  ;t4alx moctltlmDrmnmo;u) etomfcoatlmt lnvs;s0trxrio3nu1ap emfvi t  rua(rpou4oetn ictytfm2rmu p;u4altoifcoadlpD anes (  rtmxrpnu4opte ncta()a2trxm ot0apxoio3tadfaDumu p t4tltrmr iadfpteau s;s srurxrpoo4lm n iciatfarta(r nt0opt mf3ildfm ulums;(0arermo3totoptrlnvo;t0trxm(r3iydole mnvi t)arrmx p;t1texomfciadfsDuanvsnt) rtomfcio1oa eau i;s0trum(o3io1ome lnvtls) Drr(rp;u4apeoii3iydfaDrm(ms;t4aexomfcta1fm rlues;(0 rxrxo3io1apenlneil(f 2rmur ;o1optomoetyslmDuanvp () leomf3oydlatranvs;s)sexr(m3nydaleemfci (f Duaxm ou0tee mictat m ulu p u)aetoio3oydoa  lnvsl(  rxmiopiy4open fcsasfsrtmx ono1tetoiieiydla ulumpnt)trxnxrciodopDrlneo;(0srxoir3oy1al n ivs (faDuau p;t4apx ifetld sDumumont)arxriocto1oa elueslt0s2uoim3ou4am  mfci t)sDtr(r nu0aexo iciyt mDrl(vs t)artrir3ia1fp   i o;s) rtmio iu4ol  mnei tf 2rmum nu0ope mfciyt s2rm( o;() eeoxociydla  livi t teumxr nodoptnmnvsat)sDua(  no4altnmi3iatlm2uan pn(0 eerir3oodoaDeaivi s s2ur(o io1lmen fesls) Drr( oot0aee mf3ilt mDelu p;t4 etrxociotom  aneils0texoimpoo1om nmfvs tfs2tm(  nt1aptomoctld a2el(vpnu0tlenxo3tatlatelueo;s t2trxm ny4ap n iesas arra( p;u0olt  ociyd a ua(msnt0trxrif oy1oaDr ies s) 2xrio iy1ale lfvsl()a2ra(ronu1teen ieiasfmDel(vp;(0trxnioctydfmDelneo;s t2xmxrpoo1op elicsas)a2ua( o;u1tex miciadlmDeauvo;t)tlenif oy1optr ieil() rxm(m3iu4omenlfvil() rumxr ou4apt  ieiatfs em(vo u0 rtoxf3tytfpD  ueo;t) euoxm ny4am   fet (  2tmxm no1apeoii3iysfs ea( o;(4 exrmr tytoa   n s (0 2tmimpoydal nmfvs s aruau ooo4ope iictadlsDrln s;(0alermrctadfmDrai ols  etoxopiu1ol nmncsls)aDua(r nt0opxnio3iasfm rm(msnt)aeerio ootfmDrauvi (0t2xrim io4lmt licsa(f rur(r no4alenmoetatfmDea(vp t) lxnifcoy1fa   ivsl()t2trxr iy4lle mivs s srrr( pou0olxnioeiytls2ulump ()arenxf oa1fa  an o t0seuoxo3ny4altn neia() Dtrxrp;t4tle mfciat mDel(mo t4tltoxfctotfpDrlnes t)seuoxopno1ll  mivs s  Dumxronu4opx iieild a2uanmsnu) etoxr3io1om   ivi t) 2xo(o ny1ame  fcia(fs2ra(  no0aptnmoetltlaDemu o;t)artomr oa1fptrau slt  rur(m3iydlpenmiciatf 2umu p;o0aetoio3tytla ra( on(4 ltomf3iotoateau i;(0trxmiopoodll   ivsat s2taxm ou0teeoiicils s2eaumo;u4altrmr3oadfateanei t teuoxmpoo4op elnesls)aDrr(mp;u0oexoio3iysfs ua(mp (0arenxf iotlmte n sls trxrxopnodaltnmicsatfa2raxmonu0oltnioetlsls raump;u0 exrxf ootlpD aieils  eurxr3oudopeelicsl() rrrxmoou1alt  o3iasfa2raumsn(4aeenir3oodlaDe uvi (  rto(opoy4ope  ivtasfartmum nu4olx  o3iydlm2rmn ont) ltomo ta1lmDran o;(0 2tm(m3oodllte nvt (fs2umxmp;u0tex if3tydls2emu pn(0tetrir3ty1oat aueo;t) etm(o3iy1lpt micsl(faDtau pnu4aee iictasfa2rmu o;t0aexoxrcia1lpD auei s) rtoxm nu1llenlnvi tf rrr(mpot1tltoiieilsfs uanvo;(4alxoxr oo1omteaivi ()t2trirpiodapenliesas  2rr( ont0teeniietas aDulu pn()alxoxoctodfat  uvo;s) etmio3oodlmeemics tfa2trurpnu1tpto f3tad mDranmp t) etrif oo1oat ai o s teurirpio1op  lneslsfa2trur oo1alenmo3tltfm uln ont0texoir3oa1faD li i ( srtmio iu4aptnlfeilsfaDtr(  nu4tpt iieilsla eauvp u4 ltrxrcoo1oaD anvolt  2toim ou4lmenmfetlt)s2ur(r nt4oeeo feiltfsDum( o u4 ltniociydom ranvsls0srxmxr ny1opee neslt)sDrax p;u4tltoiietytfs uluvp;() exoir oy1latelies;s trxoim ou1lp emnes sfa2uru pou1alxnifeiat a2elums;t)texoxrciadfate nei;() rxrxmpnudlp emfcsls aDrmu pou0oetomociyt s ra(mo u4 rtrxfcto1fmDran s;( teur(r3oydlp nlnetl(faDrrur ;o4oeenifciydla2umuvs t) exrir3ootoa rlivsls0setmxopio4aptn feia(  Durumpoo4aexnifciytlmDranvs t0artrio iy1optr i s (0t2uoxm3iu1omtnlnvtl()artrxr ot0opxomoeiyslmDrau sn(0artnxf iotfaDrlu sls  rur(opiu1lptnlnetat  Dra( p;o1aetnif3iydfaDulumo t)aexnxf3oytfmD  nvilt t2trirpnydlltnmnct s) rrmu o;u0tle mictlt m ulumo u) ltrxr3oatlp r n o ()trxmxr3ou4ope  net t  Dumxmono0alt miciytls2ranmo;t)alenxfcoy1op   i olt) rxmio3io1lp nlfvta() Dumxmpou1optn ocilsfs2rmn s;u4alxomo3oa1om  ai i;s)tetrio no1al  mfcsl(  Dur( ooo1alxn iciydla uauvs t)trxoio3iotfpteluvs;(0srxmxo3io4ome lfvt () 2uru p;u1apx mi3tldls rm(ms;u) ltrxfctadop  aivi;t  2uoim3iodlmen fctat arur(  ;u4open f3tyt sDrmn s (0tetnxr to1lpD lneol( srxm(mpiu1ap nmfeiasfsDtm(mont4oltoifeildfa2ulumsnt4 rtoio3tatoat an o;(0t2xrxr3oodol   nesl()sDrrx  ;t4oleomfctatfa rmu on(4trxrxociatoa  aivs t)trtrxm ou4ol n nciat)a2urx  nt4aee ifetydlaDrauvonu4 renif3to1laDrauesls  eurio oo4ll e nctlsfa2ur(r no0tptoiieilsfmDum( o;u)arxrmr tytlpDelu olt0sruoxr iu4amt  ncsa(faDtr(moou0altnio3tld s elu onu0tltomo3ia1lpteaueo;t0t2tmxmpno1am elivsl(faDra(r nu4oex ioeias m emnvonu)trerifciodomD aieil() rtoxr oudomenlieilt aDtmumpou1ope ifctasfm uln onu)trxnxrcoy1fmtrlieols0t2um(m3oy1ap nmivtlsfarrmurooo1apxniiciasfa rl(ms t)arxrmoctytomDr ivolt  euoxm3iy1ome  nvtlt  Dumx oou1aexn iciaslm rlumont0 exrxo3tadoa r i s;t0t2to(m io4alt miei s  rrr(mooo0oleomfetltfsDumu s;t) eermf oatopD ai o;t trtoxmpnu4omee nei sfsrrr(rp;t0tle moeiytlaDean snu)alxrmo3oytfmDr u sls0setmxr iu1lpee nct (f rta( oot4tetnmietas s2rau onu) ltoxfcto1op raivi ( setr(o ou1op elncils)aDtax ont4tex miciyt aDel( p;t)tlxoxf totlm eluvolt) ruoxopoy4ole  neslt artmx  ;t1tptnifeias s2ul(vo t)arxrxfcootoa e ueo t  ruoxmpoy1ole lnet (farurx  nt0oltn i3iltfa rm(msnt) rxrmf3oytfmDeluvol(0tetm(o oo1open netltf Drmumono4ope miciytlmDrauvo;t4tetrircootfp elnvsls0setoim3nydlp emfcsat arrmxmonu0aleomfeiyt s2umnmsn(0tltnir3iotfatelivo t texrio oo1lmtn ietatfs2tr(r ot0tpt mi3iasla eluvsnu4aetoxocta1opD aieo t0 exr(rpiu4ome  iei s) rrrurp;u1olen oeiltlm2ran p u) rtomr3tatomtelneils trxmir3iy1oltnmfcsat)a2tmurp;t0oexomictyd sDrl(vs;t4tlxnxf to1om eauei;s0 exmirpiy1ap n fei sfsDrau p;u4oltn i3iadfs eaumon(4 ltrxo3to1lp e u sl(  2to(r io4altnmnvsl(  2rmu p;u1olxn f3ildls rmn s;t) rtrio ty1lmt an sl( texrim nu1al  lnvsat)arta(  ou4tptoifcias a2elu o;() reoif3ty1fmtr nvo ( t2toio ou4oltemnvslt  Drmxrpot1tlen fcildfa elu sn(0 etomo iatlp  auvo;s trur(m3oy4lp elnci tfsrur(r ;u0tee iicild m ul(vo;u0arxoxo3ta1fmDrlnvi;s s2ur(o ny4alt lict s  Drax o;o0texoii3iaslmDra(von(0arenmoctatfpD aieo;(0s2urim oo4opt livtat  Durum nu0ale  o3iat sDemnmp (0 rerxf oodomD aivs;s)tetr(m ou4al elnct (fsDrrumpnt4alt mi3iadfmDul( s;u)aleoxr3oydfmt au i;s)texrxopiu1optn nvtlt)sDrm(  no0tpeoifetytfsDranmp u4texnif3ootla rlies;t0 etm(m iydol  livil()arumuronu0aet iictlslm eaums (0 reoxo3iodla rai il( trtoxo nu4am  lies t sruax  ou4opt  f3tltlm umuvs t)aeermf3tytla rliei;s) 2tm(mpiy4llt livs s) ruaxmo;t1tltoif3iyt s uan snt)aeenmo3to1oateau s;t) 2toim3oo4omenliesl() Drax o;o1oee  i3tadlm rmnmp u)aetoio oydfptrlu i ( srxmxmpiy4lpen nciltf rrauro;u4ale mfetatfsDrl(vont4 etoio3iodfpD luei;s0trurio ny4omenmfcta() 2rmu  ou0tpxnif3tldlmDel(vpnt)aeeoxocto1la rauvi (  2xr(r3oy4lltemfes t a2tr(rp;t1ale mi3ildfmDeau o (4aleoxocio1oaDraivo;() 2xmio nudlmtnmneilt s2ta(ro;o1optomiciysfm eaumon() exrir3oydlpD lnes;t)trxrxm ou4ap n nes ( sDtaxmpnt1oexomoetydlmDrl(vs;t0teeoxociotlat ln s;()trxoxo3nudop e fvsltfaDra(r ;o1olxnmi3iydfm ea(vp (0teenir ia1faDe u i;(0 exrirpiy4am n fvsls srumxm nt1aeeo f3iatfs2ra(vs;t)arxnif3iy1fmt  ueols)srxmim3io4lm   nvsat)artax pno4aee  f3tyd s2ul(mo u4 etnircootlpt ln ilt0setmirpou1lptn nvs s)a2umum ;u1oltomi3iltls umuvonu) rerxf oo1laD  ieo;t)teuoxo3no4altn ivtls  rurx o;t0texo fctasfm2rl( s;(4aetrif ia1fmDrln i s) exm(mpoodope mieils a2ur(  oo1aeenioeilslm el(mp;u4texomr3tytoaDrlivi;( s2tm(rpiu4amtnmfcs s)sDrmx o;u4aetnmo3iatlsDelu s u4 reoir3iotop  lnei s  eur(rpiodomenlivi tf Dumxrpnt1teeoifeiytfs2umu snu) lxoxf3totfpt  uvi;(  rtoxopny1om nmfci sfsDum(rp;u1aptnmociys a2emuvo t0texnir iytoa rlnei t)t2xr(o nudlle mnctatf 2ra(mpnt0olxnmi3iysfa2umnvsnt0tleoxo3tatop  anvi;t)s2um(opny1ap nmictl(fa2tm( ono4tpt mi3ilsfm2ua(vp;u) etomr ia1omDeluvo t  rum(m oo1lpen neiat arrr(r nu4apto feiydfm rmu p;u4texnxrcio1lmDelnvsls  rur(o nudamen ieils aDtmuro;t4texo ieiaslm eau pn(4 reoxf to1oat aivs;t setrxr3io4lm  lncs s)srrmx pnu0tet mfeiasla2emu p;u0 ltoir3oa1late u ol(0s2to(opnodopeemfvs t) rum(m no1teen ociasla ea(mp (0 reoxr tydfm  lnesl(0sruoimpoy4altemfvias)arrru p;u0tltoiociytfa2emu sn(0alxnio3tytfaDeaiei;t  rxr(o iy1om  mnvsl() 2umxmpoo4tpxnmfeilslm elu snu) ltrir3iatlp elneo s trtr(o ou1ame micias arumu  nu1opxnmf3tat aDrmuvsn(0altnif3tadlmtrau il(0s2toxmpno4oltemncs s  Dta(moot1openioeias mDean o () lxrxrcoytfm elues s) exoirpoudlm  lies ( s2rmum ;t4oexo ieiyd sDrlnmp;(4tetrxr3todfpte u i;t setm(o3nu1lptnmnetas  rtru o;t1tlenifetydlm ea( snt)tlenio to1lp rluvil()trxoxr iy1optn ivsatfartmuro;u0teeo f3tldlm ulums;u4aexnxo tatfmDelueo ( srur(r nudapte iciltfsrra(mo;o0teen fetatfm elumo;t)alxnxo iytlp   i i () rtoim3iodal eliciat srum( o;o4olx  o3tytlmDra( s;(4trenir tatop  lues (0s2uo(mpiydam n ivsatfsrtaxro;t0aptn fciad s2el(vp (0trerifciotomteln i (0trxrirpnu4alt lfeias  2tmx  no0apxn oeiytfs ua(vp;t0 etomr oy1oaDr ies s) 2tr(m iy1opeemieilt  2trxrp;u4opx  feiatls ul( on()altnir oadomDraiei;(0 eur(m3oudalt  nvt (farum(ro;o1aptnio3iytfaDeln p;u) lxrircoy1op  anvs s)t2to(m3iu4amenlfvtatfarraurp;o4oexomiciatfsDem(vp u4altniocoo1oa raivolt)tetr(m no1altemicsl(  Duax poo1tltnmf3iltla rlump t4trxoio oatlpteluvolt0 2xoio3oodopt mies t)sDtrxm ;u0tetn o3iydfmDeaumo;(0areomo3iytlateauvi (  2xoio ou4lpe lnesa(f 2rmur nt0tleoioeiyt m ranmpn() eenifcta1fmtrln s (0t2um(r nodllenmicta(f Drau ont0olt mfeildla2rmuvp;t0treoxo tadfateli i s sexm(r3ny4om  lfvsa(fsrumur oo1apenifctlsfs2ua(msnu4 leoif oodfpD li i s) exm(opno4amt lncsatf 2tm( o;t4optoifetyd sDrm(vp;t) leoxr3todlaDelneslt)t2urxo oodal n feiltf Drmxrp;u0tpxo f3ias a2emn o t4trxnxr3iy1lp   nvo s srurirpoodaltnmnvt t s2tau  nu1olenifeiytfsDemu snu0trxoxfcoy1fate i s;s)s2xmxo nydlpeelnci ()a2um(r nt4openiociydls2ra(mp;t0arxrmrcoadlaDelivi t teuoiopny1lp nmfct t sDrmumono0teenii3tasla elumo u0 lxrxo3oodlmteanvo (0sexr(r3oo4lp e ivs s s2ua(rpoo1teeoifeiyt aDrlnvon() etnmf oodla rlu i t0 rurxr3ou1ape mfct sf Dra(mp;t4tpxo oetysla umu sn(4artrmf3to1oa r i i s0 exo(o iu4lmte ivt sfsruaxront4olx io3iatfaDemnmo;(0arxoiociadfpt luvi t truo(mpnu4apt lfcta()srtr(mpou4teeo fciasfm2uan o t) rtrxo3iydoateanvsl(0s2umxm nodop nlfciat)srrmur ;o0apto feilsfa2emnms (0texnxo oodfpD aieilt) etmxo iodlmeelnei s srua(ronu0oee  i3tadfm2rmu o;(0tlxnifcootfp  ai o;s)sruoxo3no4ape  ietl(  rtrxm ot0alxoifciydfaDelu p (4tlerir3ta1faD  i o s0s2xr(o3no4ap elici (fa2rmu  oo4olxo oeiyd m eanvo (0aexnir3totfm rlnesls t2uoirpio1optemieiat)srtm( p;o0aptnifeiltfsDumu o u)texnxo totomD au i;( truoxmpoy1opeemivsltf rrmxr ou1apt  ictaslm ranms t4alenmocoydlat anvi;t) 2xoxo nydomee fcia() Dtrur nt4aex ioetytla umnvs u4 lermr tadla  lneo t trxrio ny1omt miciltf Dum(mo;t0apenioeiyd s um( sn() exrxo oydfptr ies;()trxmxr iu1am nmfesat) rum(ront0olxn ociatfa2umu pnu4texniocio1oatrauvols) ruoxm3oy4oltnlivtat)arumumpot4ape  i3iydfsDulu s t)aetoxfcto1fa  livs (0s2toiopno1olt livtl( aDra(rpno1opeomf3tyd mDulu p u)texomf oytfpt auei t0 2urir3oo4lm elics tf rtru pno4olx  f3tat a2um(mo;u)tetnxf3ty1fp e i i;t)s2xm(o3oodapt livils)arraumoou1ope moctlt s2um(ms;u0 rtnxf ty1lm   iei (0texo(r oudalt mncs (fsDururpot1open i3iltfm2rmuvp u4 rtrxocio1omD  uvi t0t2uo(r3oudam   fcia()a2rrumpno1teto i3iatlsDeanms t) rerioctotfat aiesls0t2xmxm io4am e fcs sfaDrmxr ot1ale  oeiatfmDumnvsnt4tlxnif ootfa   nvo (0 eumio3no4alenmfcslsf 2um( poo4alx  oeiytfsDumnvp (0 ltrmf3iodlat aivi;t0srtrxopnodaleelncsl()a2rmxrpno4oex  ietyt m2ranmo;t4teenmfciydla   i o t)srtrxr3iy1am nlfvias s2rrxro;t1alt  feiys s rlumpn(4tlxoxf3iotfpteluvi;()texo(r3ny4op n fcia()srtrxrp;t4oee  fetasfm el( o t4areoif ty1fp ranvi t0trxmir3iudap n nvs t srtrumoot4opxomi3iyslm2rm(ms t0 rxrmrcto1la r ieo;s  2xmxm no4lpeelicilt  Dur(r ou4opeo f3iatls emn o;t4 leomf iadla elueo;t0 exm(mpny4amtnmnvi sfartax  ;u0tlx miciad m2emu s;u) exrmfcoadlaD lneo s  ruoio nudom nlict t)arrr(r nu1optnmoctld m2eanms;u4aetoifciadla e u slt)seuoxm ny4llenmfvias srtau oou0aptnmf3iatfaDrm(vp (4 eeomf3tatfpDrau ols tetmxo3iodlltelfes t)sDra(r ;t0olxoif3tls aDuln pn(0artnmr3iatomt anvol()srxmim iy1lm   netl(  2trurp;u4tpt  iciatla2ul( ont0texrmf iodla ean s;t)seumir ou4lm  mncia(fsrtaurpnt0alt  i3iysfaDran pnt)aleoiocoo1fpDranes s seto(m oudllenmncs t)arta(mooo0oet moctaslm2ulnvp ()trtnio oadlptrln sls)sexoxopiydom  mnctat)srrm(m ;u0altnii3iatfs2ra(ms;u)aetrmr tadoa   n o (0s2tmiopiy1apen neta(f rtm(mo;u4tpenif3tltfa2ul( pnt) rxrif iatlmDr ies;t  2xmio no1op n ies tfaDtmu  nt1apeo oetltlmDulnmo t4 eenmf oydfm   nvol() etr(m io1opt  nvtlt)artau p;o0opxnmf3tltlmDean s () ltoio iytlaD lnei;() etoxrpoudope  ivi ( arumx ono1opxnmfciat m2umuvpnt4texoxfciydfateanvo ( texoim nu1lp nlict ( s2rm(m ;u1tpx ii3tldfsDrmnmsn(4tleniocia1la   ivs (0t2uoxr3oy4lp nmictls sDtm(m ot4alxo f3tldlm rlnms (0 rxomr3oytoatrln o;s0 rumir3ny1opte fctltfa2ra( ont0aleo f3tyt a2ulu s u) renxo oytomD  nei;t texr(rpoudll nmnvsls)a2taur ot1tlxnii3iltls2uan o u0 rtnio iadlaDeli o;s0t2umxr3iudlpeemnvsat artm( o;t1aetomoeiaslm ua( on()alerxo tatoatr ieol( t2xm(r ny4amen nvilt sDuaurpno1oet io3tltla2umumo;(0artnxf3todlpt ai o t0srxmir ny4amtnlivt sf 2rrxr oo0ale if3tadlm2ra( p;u4arxrxf iodfa  an ols  2uo(r iodoptnmfcils)srtmx  oo4oeto f3iatfmDrluvsnu4treoircto1fat  ivs ()s2urim3io4lmtnmivia()aDtr(m nt4aleoiicias m umumsn()tlerxfcio1fateln i t  2tmio iu4ap elncia()a2uau  ;t1aleoio3tas aDulu p t4 etomoctatfptelivo s) ruo(opou4ll n fvt s aDumur oo4tpx mieiadfmDumuvp;() exoxfcta1lpDelu o;s0s2tr(r iy4al emnvsa(fs2umu ont1aee ioctysls elnmo;t0trxrmf3iytop r ivilt) 2urxo io1lmtnliviatfsruaxr ou1olt  feilt a2emnmpn()aeermr3oy1fa e ueolt)t2xoxo3iy4lltelfei s  2uauro;t4tptnmieiatfm eauvs u)artomr iodlm   n i t)teuoxr nu1lp nlfeils)arra(rp;t0olt if3iad sDrauvpnt4aleoxfcia1lp rlnvs (0 etrirpoo1opt  ncsa()arrmx  oo4ape mf3iatfmDrm( onu4tlxrmr to1fm e ues ()t2xm(o ou1lm nliet sfa2ua( ont0aet ioctysfaDeanvsnt4trtnircoydlaDeauvilt s2tm(m io1lm elfetas)aDtr(mpot1ale ioeiydlm emu p;t) renxrcto1fmt anvs;(0 etrim3nodol emneias)artaum ot4aet mi3tld a ra(mp;(4tetrio3oa1op e ueo;s)s2trio oy1om nmnci t)sDtmxr ot4olxomfciyd s2uauvo;t4 rtrxociodfa rli o;s0teuoim oo4amt mietas a2tmxro;t1opxo f3iyt m ra(vs (4trtnxo3to1oaDe n i;(0 rxrimpnu1ome  icslt)sDrmxrono0olenifetyt a ranms (0altrxf iodfat anvil(0teto(mpoy4ol emfvtasf 2urxr oo4apeoioctltlmDuauvpnu4aleoxrctydlmD anvols  eumio ou4alee nesl(faDuaxmp;o4opxoio3iltfmDranvo u) lxnio3iatfatrlivi;s0srtrxo3ou4aptnlivil( aDua(m ;o0oetoifctys a2ra( s;u0teenmf io1lmD aieolt)s2xm(opny1ame  ivils arta(r oo4tle  oeilt a2eaump;u4trxnmr3tatfp eli o;t srurxr3no4olt  fctlt  Dua(mo;o1teeomo3tasfs2umuvsn(4 eenxfciytlmt anvslt0 2trxm3iu1amtn fcsas)a2urur ;u4optnio3iydls uanvo ()alerxf3oodlpt aivo t0sexmxo3nu4ale mneiatfs2tau pno0tltniiciat mDumn snt4treoircoydlmtean o t t2uoio3oy1amte fvs () Drm(mpnu1tlx ioctatfaDemnvpnu)texnmr3iydlp rln i (0srtmirpoodopte fctas sDumu pno0aex ifeiydla2rmn sn()trtrmr oo1omte neo;() 2xmio oodaptn fei ()a2trurpoo4alt mocilsls el( o t4trxnxr iodoat ai i (  2tr(rpnydaltelivs t)srua(m ;t0tlt  fctytfm2rmu p ()aeeomo3oy1fm eau s s0s2trxopou4am n ncslsf Dtrxmpnt0aex mi3tydfsDra(vs;u4aexoxr3todlm r u s (0srxr(m3iydalt mfcils s2tr(  ;t1tleomf3ildfaDrm(vs;u4 lermf3todfmDr uvs;s0teumxm3ou4lmtnlnctls)a2trxro;t0tet  fetat m elu snu0alerio3totlaDeluei s)srtmimpnu1apeelncsltfaDrr(ro;t1tltnio3iyslsDra(vo t)aleoiocoydom e u s ()srurio3iu1ale  fvi sfs2rax pnu0opt iictlt mDemnmon(0aexniociodlpDrln olt texoio iudlle  feilt)aDtru p;u4tlto oeiad m2elnvpn(4teerir3iotoa e ivil()seum(o nu4ope mivi s  Dtaxrpno4alx if3iatfm2ul(vo (4 lxrio io1lmDe nvo;t0trto(m3oo4apt lfcilsfsDurxront0ale if3iasla ean p;t)trxnxrcoytlpDr nvil() 2umiopnudom emivsl(f Dtmumooo4altnmicildfm2rln pnt) eeoio3oatoaD au slt srumim3nodopenmietltf rtr( p;o1oeenmoetls a2emuvo;(0 lxrir oa1fpDrauvolt s2urxr oy4llenmfvtas  Dtr( onu1openiietatfmDeau o t) lxomfciatfmt auvo;( s2tm(mpnudop emfetls  rtm( onu1ope iiciysla emnvp u0alermrcto1la   nvil( srxoimpiodaptelnei ()s2umu  no1tlto o3ilsfs umnvs u0 eenmr tadoatrlnvsls0 2tmiopnu4op emivslt)aDtaxrpnt0tpxnio3iyd sDumu p u) rtnxrctatom eaieils0 exriopny1altnmicilt)srumur ;u4apeomo3tad mDumnvo;u0 exnir iadfateanvo s  exmxr iu4amt lici t)srraxrpot0ole mfetatls2emums;(4artoxf3io1lp rliei;t0 rxoxr3nudlltnmnes sfsrurxmpno0tpxnmieild m ua(mpnu0 ltoif totlmt anvs s0trumir oy1lmtn iet sf rtm(  oo4oee  ictys s eanms u4treomrcoytlmDrlues s)trxriopny4ll emfctat)srrm(rpou0aexnii3iysfm2emuvo t4trtomf todfate ivs;() eumxr oy1al emfeslt)srtr(mpno0teto f3iad sDul(mp;u0 rtnxo3ta1fpD  iei;s0setr(r ou1lm  livs s)s2ur(m nu1tetnmf3tldfaDelu snt) lermfciytoat lnes;t)trtr(r3io4ap   fvsas)srururoou0tlt iiciytlm umnvsnu4trenxfciotlmDrluvo;()srtrxopny4lptnlivtas)srraurpno4oexniietytfmDeaumo;t0arxrir3iy1omte n s t0 exoio ny1aptelivtas)srurur nt4tee iieiytlaDeau p u)arxrio3tydfm r uvi t seuoxo no1op emnci (fsDurx poo1altnifeiytfa ulu s;u) etnxocty1laDrlueo t0seuoim3oo1ome mfesls  2rmu pou4alx mocilt aDem(vp u)altrir iatfp raues;t)teto(r oy1ameelfes t) Drr(mpou1alt mieiyt s2rlumo t)aeeomfcoatlatrluvilt)teurio nudlp n ivi (  Dtm( p;t4aexo oeiyt sDuan p u)alenxf3oatlmt an i s  etmirpoo4amtn nvt s)srtmum ;o0tpe  fciatfsDel(vs t4texoif oy1fmt lnvi t0 exrir iy1lp  mnvt s)srrm(ro;o4oee iictadfaDumn s;t0 lxomo ootfmte uvo;s setmxm3ny4ll e nci ()s2tmxrpoo0tleoioeiydfa el(vs;t0aleoir iytopD aueo;( s2xmimpiudape mnvtat)s2rmu pnu0oexnio3ias a emnmsn() leoioctodfm   n o;s0 rxoxopiy1lp n nei ( sDumumpot4texnif3iltlm ulu p u4 etomociy1oatrluvi;() etmxo iy1ole  fvilsfsrum(r ;o4tpxn f3iyt a2ea(vonu0alxrircoo1omDe i ols0 2toir io1lp nlfci t artax pot4oexn ietatla2rmu p t0aeermf3oytomt  i s;()texo(o iy4oltn iet ()aDrau poo0tex  octls aDranms;()tlxnmocoatoptr nes s  2tmxm3oodape  ivtlsf ruaumoot4tptomoetyt a2ulnvpn()trenmf3io1fpDraueo t  2tmiopnudamee fvtl(f Duau ono1teeomieiydfm2um(vsnu0aetnmocoy1opt  iei (0truo(r3oo1op  lnviasf 2uaxmoot1tex  ietadfm2uauvonu0 lxrmr3iytfmD auvi;s0seuoir3no1llen ies tfarurumo;t0texo i3ilsla2eanmo u0arerio totfaD anvs;t t2uoxrpny4lp elnci s)arurxro;o1apeo oeiydlm2emumont) rtnif oodfpDr u s t)s2urxr3oodaptemnvi () 2um(rpno4opx mictad s2ean ont4 rxoxocoadfmt anei;s0 2trio nu1aptelfci s a2rru p;t4ope  i3iatfaDelnvpnt0 ltnxocty1fp e neo t) exmirpou1apt  nvs tf rtr(  nt1alt mo3tatlm ean s t0 eermf oytop ran o () rxrxo3iydlme  fcsas)sDraxmpoo1tpenmicild m rmuvs t)trenmrcoo1lmtraivolt) 2xoirpiydal  mict tfa2umum nu1oleomf3iyd s rmn p;u)artrmr3io1oatrluvi;s  etoio io1opee fvtasfarrr(ronu1tltomf3ild m rlnvs;t)aexrifctytfa rlneslt t2uoim3iy4omenlfvslt  2ua(  oo0apt mietldfa ea(msnu4tlxrir oadfm e n o t srumim3nu1ap   icsa(  Drmu  nu4tet mo3iys a rmnmont0 reoxoctadfmD  ues;t0 2xmxo3ny1omt mfctl(  ruau  nu4open feias mDulu onu)teeoif3iadlmD aieo;s)setmir3ny4llenlnvsls) Dum(m nu0apxo octas a eaumo;u4aexnmf to1lpt livs;(0srxm(opou4opt mivt tf 2rr(mpoo4altnioetltlsDra( p;t0tlerxf3oodomD aues t srtmxr3nu1ap elfvta(fsDuaxm ;t1tlt ifctytfa ranvpnu)teerxo tydfmte iei;(  2xmxr3no1ol  mictls  Durx p;o1ape  oeiltls ua(mont4aetoir3to1fa eauvo t)t2xriopou4omenlies (fsDtru pot4oleoioctadfs ulu p;(0trenir oytfatelu o s0srxmxo nudolt lnetlsfa2tmx  nu4tex ii3iat mDel( p () renif3oo1fp e n o;s setrir nodlmen fvtltfa2rmumo;t1opx mfcils mDeanvont0aexoif ty1fa r uvolt)setmxrpny1ll  lictas artrurpno4tlxoii3ildlm2uauvpnu)altoio totfp r ieo t) 2ur(opiu1lmenmictl()s2rmx  nt1aptn ieias m eauvp ()tetrir tatfaD aiei;t  eurxmpou4lm e fet () rta(m nu4tlenmfeiyd s2el( s;u4 ltnio ootfmDranvi;( trtoxm3nodll nmicta()sDuau onu1olxn ociyd m uaums u4tetniociodlmtr uvolt  ruoxmpoy4al   iesl()aDrmxmoou4apenmfeiydla elnvsnu4 ltoxrcootfm   iei;(0 eurxm no1om   icilt s2uaxm ot0tet mo3tatlaDem( pnu4tltoxr3io1om e ieslt0trxmir3ou1omtnmicsas)sDuaur ou0oexniocildlm rlnvo;(0 lxrif3oydom eluvs;s0 2uoim nydlle mictas)sDumur ot1ope if3tytfmDemumo;(0 ltnmfctodfa rauvs;t)t2uoio oo4ll   ietas)s2tmurp;o0tee  i3iydfs eln o (4aexomr tydfaD livo t0srtrir nudaltemnvi t)artmxmpou1optoifciydlm2rmnvp;u4trtrxoctatlpte ivs;() 2tmio3iy4oltnmfcils) rraxroot4alxoio3tys mDem(mp (4arxnifctadfatrlieol( srtrxm3oy4lme mfvs tf Dtrur ;u0texo ieiasls2emuvp;t0altrmr3ty1lp   nvo;s)s2xoiopoudamtelnvtltfarumu p;u0openmiciatfs raump;u4arenxo3to1lm   iei ()s2um(r3iudoltnliesasfaDrrx  ;u1opeomoeiad a rau p u)trtnmr iodlm elnvs;t)truo(rpoo1ol nmici tfsDurx o;t0aexo iciydlm2uanms;t)trxrio ia1opDr uvi s)t2xo(rpno1amtnlncs tfaDrrxrp;o0ole mfctatfs2rln s u)altoxocootopte nvol(0sruo(mpiu4lpenlieilt)s2trx pno0tet  o3tls m uau ont4trtnxfciotfmteau i;t0srtrxmpiydapen fvia(f 2ua(mpou0olx  f3iyt aDrmu s ()aetrmoctotom  ai i;()s2trxopno4am n ieslsfa2urx pno1optoii3taslm2emnmo (0 rerir oa1oateauesl() 2xm(mpiy4omee nesl(f rrrumo;t1opx ioetldlsDul(msn(0teeomo3tydlp  an o;t0seurio3ou1ll emfvtas) Drmxr no1apt moeilt s ul(vp u)aexnmf3oo1op eanvsls)texrirpoy4openliesl() Dtaumooo1olx ifciyslm2ra(vsnu0 exnmrcia1opt lieilt trumxopoy4amenmietlt)aDra(mo;t0olx  fetytfm ua(msnt4 exoxr3oy1oaDrlieo;( teurir iy1ale micsl( srrru oou0aeeo ieiltfm elumo ()aexnmr3tatop   u olt)texmiopno4ope lnctl(  2trur no0texnmietad m2ranvo u0aetnxf3oy1fm eauvs (0 2ur(o nudape mfcsls a2rmump;t1aex  i3iytlm2rmnvs t4 exoxr tadfm rlu olt) exrxr nu1altnlnctltfaDum(moou4teeniictytla2eanvo u)arxnio3oodomteln olt0tetriopno4lpe lieta()a2trumpou4tlto i3ils a2umuvs;t0artnmo ootom eaueolt)trxmxo nodap  lnet (f Durxmooo4oltomfciadlm2rl(mpnt0 ltrio3iodop rlneolt texo(o3nudol e neia() Dtaxrpnu1alxn fctasfaDumn s;t4arxoif3todopDeaneilt  2tmir oo4al  mfviasf Drrxm nu1aeenmocildfmDrau s ()tltrxf3iytomteanvil(0t2xoimpoudalee fctas) 2ururooo1opt miciydla2ua(mpn(0tltrir ty1opD ai o t t2xmxo io1am e nes tf Dtr(rp;u0tex mf3ias m2umn p t0tlerxo3iydfmDe nes;(0 2tmimpno4oltnmnvs tfs2ra(r ;u1olxoiiciatfmDuanvonu0 lenxrciytfm rlivs;()t2xrxr3no4op   fesat) Drrxmp;t4oeeo feild a2rln snu0trenxo ootlat aueolt0srxrir oydol nmieil(fa2trumont1alxnifeilslm2emnmon(0 rtoxr3iydomte nei;t0seurim3ny4olenmiet tf 2tau p;u0alen iciydfa2rl(vpn()artomfcty1lm  anes s  etm(mpoy4omt mfcsltfartmxr ;o4aleomf3iys m2eluvo t0aleomo3to1la e ivi t)t2xr(o3io1lmte nctls)sruru  oo0opxnmfctyt s rlnmp;()tetoxo ia1fpt  nvi;t0s2xo(o3oy1am nmnviltf Dtru ont1tpx  fctysfm elumpnu)texnmf3ta1opD aueilt)teur
\ No newline at end of file
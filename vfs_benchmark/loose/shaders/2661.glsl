@@ -0,0 +1 @@
+n ilt0 rxmirpnodalenlnei sfsDtr(m ;t4opeoif3ilslsDrl(vonu4tleomfctodlaDrlivsl()seur(o3io4ap nlivsa(f Dtmxrp;o1altomictld m2rmnmo;(0treomo3tytom ean o;()trtm(m iy1opt miesas) Drm( poo1tetomictadfsDem( p ()trxnmrcoy1la elu s;t0srxr(opnydalt mfetatfaDraxmpno1olenmfcilt a2uau s;(4tetrifcta1la   i i s)sexr(o oodop   fes ( sruaxr no4aex ii3tytls2rlumo;() lxnmrcoo1laDeai ilt setmxm iy4opt  ncsls  Dtr(mpou0openmoeildla eau p;t)teeomfcoa1fa rlieo s)t2um(rpno4apenlivtlt)sDuaxroot0tle  octad s ul( pnu) eenio ta1omDean o ()sexmir3io4ole lictls srra(rp;o1ole mf3iatfm umumo;(0altrio3iotla eauvo s)srxr(m nu4open ict s)a2umu  ;o1aptnmfcilslmDum( p (0aeeomr ta1lpt lueo;t seumim io1om e fvtls) rumxr ;u1texoifeiatlsDuaums;u0aetrio io1lp rli s;() rum(o iydalte icil(fa2tr( o;o1texnii3tlsfm2ulumont4areniocoo1lmD ai slt0trxm(o oudlmenlfesat a2rmurpou4oet mo3iydlmDem( s t4artnmoctydom ranvo;t)t2umiopnodomt  fvtlt) rurxrp;o4ope  i3tld sDrauvpn(0trxoxocoodfa  luvo;t)sexoim iu1omt  ivs tfa2trxmpoo0altomfctatls2ranmp t4 leomf ta1lat luvilt t2xrxopiydol e nvta( a2rmumpot1ape mieiad m uaumpnu0 rtnxrctydfate n o;t)seuoxrpiu4ll nmietasf 2rr(  ot1aeeo i3tydlaDrlu s;u0tetnmr3ia1om e uvs t0 rxoxmpiodomte nei sf Drrxmp;o0oexnmoeiadls ul(mpnu0trxoxfcoodfat ln s;t sexm(r iudoptn fes (fsrra( pot0aeto i3iaslaDumn ont) rtrmr tydopD lnes s  rtoxmpoudlmtn fciltfs2taxrpno0opt iiciytfs rlums (0tlerio3ta1op rai o;t s2uoxopoudlm e neil() 2tmu  oo1ope  octadfmDeln o;t0 rxnxo3ootfmDrlieol( trtrxm3nu4ol   feias)srtm(  ou1tlxnmf3tysls rmnmp u0tleniocio1fmD ai slt)seurxo no4ol   iesls)aDraxmonu1tetnmf3tys s emn pnt) rtoifcoytom e nvslt)trtmxmpoy1aptn ici ( sDumu  ;u1tptomocias mDul( s;t0aetoir todoptelnvo;t  eurxo oudol  lnvtl( aDurumooo0tltnmf3tls s el( s;u0 rxoxr3oatom elues s)texo(opnu4aptelfet s s2uaxmpnt4oltomoctysla ul( onu0 eenxrcoa1lm  lnvi t s2urxo no4om   iei sf rrrur ;u1olxnmfctls a2rm( o (4arxnxo3oydlm raneol() rtm(m3ou1oleelfesls)srraurpou4apt mfetltfa emu s () ltoxocoa1fa rlnvsls  rtoim ou4ame livi s)srrmx p;t4tltoio3iltlsDra(mpnu0 renmr oydlmt anvilt0 rumim iudomenmncilt s2umumo;o1ape ifciysla ranvo (0trxnmr oytom   ivil()srtoirpoy4apeeliviat)a2ur(m ot0tptn f3iltfs rl(vsn()artrio oatoa  liei ( setr(mpiy4op e ivs sf 2uaxmoou1apenifciys a ra(vpnu4artrif3iodoat  neo;s)t2toxm3iu4opte nvsat  Duaxrpno4oee  ietasfs um(vs;t0teerioctadop  li i () etmxm ny1optnlneta(f Dtr(moou1olxoio3iydfsDrmu s (4 ltomfcoadlmtraivs s0trxrir3nudomenlivsltfsrumx  ;t1alxomoeiydfa2eaums u4 renxr3oydopteai i t) rxr(m iu4lp  mivtlt sDrmuroou0olenmictasfaDeauvsnt4arxrmf3tydlaDelneols0s2tr(opoo1ap e ivsa(fsDtmxm ;u1olenmfctlt m2em( sn(0tetrxr oatlat livsls0s2uoiopoo4olen ncta( srtrumpou1olenifciatfs2rlnms;t)aeeoir3iotopteln o;t0t2xmim3io1am  mfesatfs2urumpoo0apeomfcildfs ul(vo;t4 ltnmfctydfmteaieil() exm(mpiudlp emnciltfsDrmu pnu0olt ii3iad m2elnvpn()arxrmociodlaDeaivs;(0trto(o oo4lm  lfcs tf Dtaurp;u1apxn i3tltfaDum(ms ()teeoirciodfpD  n sl() rxo(r oydlpe  fvi tf Dtru o;t1alxo f3tadfa2rm(mp ()aetrxfciotfaD anvo t0setmimpoy4om emicta(fs2rr(m ;u4teeomoctytfa2rmump;(4trerircta1lmD  ieilt0t2um(o iu1lp elnvs t)s2tr(mo;t0apeo fetasfs raumsn()alenxo3tytfateaueo s0tetm(m3nudlpt mnes sfaruax  ou4opx ioeias m rmn p t0trerxr io1faDr nei;() rxrxo3nu4lpe  ieia( srrrx ont1opeoiieilt m2uau s;u)tetnmr3ootfp elneol(0 rxmxo3oo1al e neilsfa2urump;u4teen f3ilsfs2rmnvs u4 renif3iatlmD li sl() rto(rpoy4amenlnesl()aruaumpnu4oleomoeilslm2ra(vo;u) ltoifciytop   ues;s  rumxo nu1optnmicta(  Dtrxro;u4oltoiociasfs umuvs t0 lxomr3oytlm  anes s0sexo(r3iydlmtemnvs t) rraurpoo4oleomi3tydls2ua(vp;u) lxrirctotomt luvo (  etmimpno4amtn netas  rtax pnu1apto oeildfa raums (0aexnir oodfpDr ies;( trxoimpoy4lptemneia()sDrau  no1texn ietydfa rauvo t0tltrif iodla r uei;s srxrim3no4op emiet s)srrr( ono4tleoifeiat aDel( s u4 reoxrctotfpDr i i ( teum(r oodoptn neiat a2ua(rooo4aetomictydla ul(vs;(0 lenmrcoadlptrli i;(0t2trxo3io4ope micsas s2tmxrp;o1oeeoiictldlm2elumsn(4 ltrxo3to1omD li o;t0s2uoim ou1ole mfvil() rrrx  oo1teenmociyt a2uaumsn(4aetnirciytfptrlivilt) rumxr iy1lpt mieil() Duau pou1opeoif3iys mDelnmo (0trtoxf3ty1oaD aiei s0setrxr3iy1lpt  nctltf 2tr(r ;o0tetnmieiyslsDeanmo;() rtomrciydlm e u olt0srtrxmpno4alee nvi s s2rmurpoo1optniictatlaDumnms u0aleoxr3iytlpt ln sls0t2tmirpoo4lmen ics s aDurxrpou0alt mfeiltls umumont0tetrmo3ty1fpDrlueo ( s2umxr3nu1llt mivtat  rrax  nu0alxomfetls s2ulu s t4 rtrmoctodlat lnvi;t)truoxrpiodlle mneias) Duaurpoo1oex miciatfs ulnmpnt0 eerifcoatlpD aneolt0seurxm nu4ale lietat  2trx p;o1aet  o3iltfa2ranms;u)teenmociydfp rlueil() 2urim3oo4lp nlici ( aruaxr ou4tetn fetyt m2ea(mo t4trxnifctotopDraneilt0trurio3iu4op nlicils  2rr( ont1oltnif3ilt aDulnvo (0tlerxf oy1optrlues;s) rxoxo io4lm  lnesasfartruroou1oexo fciyd a ulnmp;()alxoxocta1lm e ies (0truoxm3oo1lm emfvtl(fs2ra( o;o1teenmoeiytfm rm(mont0alxrirctotlmtrauvo (0 2tmxm ny1aleelnei (  Drm(mpoo4ape mietad a ulnmp t4 etnxo3todfmD  n s ()texmxrpno1ape lfcilsf Durxro;u4aptoioctls sDrm(ms t4trxomoctadfaDr ues;t trxm(r3no4ol   neil(f Dra( p;u0aleomi3tadls2elnmo;t0trtrxo iotfaDrlieo t) exmxmpny1om  lfcsat)arta(root1ole mi3iyslsDrmump;u4alermf iy1lp  luvol(0sexmim3nu1aptelivslt) 2umurpno0oet mf3ilt m2el(mpnu4aleomr3iytom rluvols0tetrim3nodamee netltfs2ra(mpnu0openifciydfsDelnms;(4 rerxr oo1fmtrai s s0t2xrxm3oo1lpt  icsa(f 2tmxmoou1tpx ifciatfaDuauvs;u0aleomocoydopD anvilt trto(o iy1lltn fesasfsrraxro;u4opx ioctls sDulnvp t4aeermoctadop ranvi;(0texrxr iydlptnlfcsa()sDtrx pnu4aexo i3iytla2emnms ()aetoxo3iydfmDelueo;t0 2trxr3iu4lptelfctatf Dur(m ot1apxomietad mDua(mp;t0tlxoifctotoaD  nes;t) eumxm3oo1al elfvia() 2rr(  no0apxniocildfm rlnvp;u4treomocoydlaD lneslt) etrxopio1lp e fctl( srtmu oot4opt iociasfsDeaumsnt) rtomo oadlatr u sl(  rxo(mpoy1oleelnctat  2raxm nt1tle iocildla ulnmpn(4trtriocoadlptr nvols)srtrxm iodlmt lnct () rtr(rpnt4teeomociadfaDea( snu4 etoxr3iatop eauvs t0teurimpiy4ol   ici s srrau pnu4oetnmf3iad a2ua(vo t0trxomfciytfptrauvsls)trtrxrpiu4llt lnvi sfaDrm(  ;u0tpe moetytls emnmont)altoxo ty1lptelivslt0 2uoio ou1lm  lfes s  2trx onu0oexoifciat sDrmn s;(0aleoio iatfmDelivsls0srumxm3oodoleelivilt  rrr( pno0opx iocildls2uln o u0 lxoiocootfmDrai ol( s2toxo oodlptemieias) Dtaum ;u0apxoio3iaslm uaumpn(0tetomr3iy1omDeauvo s) euoirpio1lpt  nctas srrrxm ou4alxnii3tltlm2ran snt) exnifctytlm elu ol(0trumxr3no4al  mivt t a2rmxmoot0ape ifeiasfsDulumo;t) eenmf3iy1optelivo;()t2tmio3iy1lp nlfvtas  2tmumonu4tpt iieilsfm2ea(mp;()trxrxr oodomtraueo t) eurimpno1lm nmfcs () rrrxr ;t0tpenif3iltlm ul(ms;t4trtrmr iytfa   uesls)trxmxo nu1lm  lncsa()s2rrx ono0tpxniieiad m2umnvo () eeoif3iatomtr iei;()trurimpnu1om   fciltfs2raur ot0tpeomfcilslmDum( o;(0altnxo oatfm rli s;(  eur(r iy1olt mneia( aDumxmp;t0optnmo3iaslaDea(mo u0teerioctydfateai i t)tetoxr3no1opeemicsl(fa2ta(rp;t0tlx mieiaslm emu p;() exnif io1latraivolt)trxmxm3iydlmtelfei (farrmur nu0apeoiieilsfmDua(mp u) reoiocoytfpt ai sls seurirpiydame mnctas srur(rpot0oee iicilt m rl(vp;t0 eeoxr3oytlmD  ivo s0srxo(rpiy1altnmnvias)srum(r oo4tet  oeiaslm rl(ms;() rtomr3iadla  auvo;t0 2xrxm no4am elfcia()sDrrx pot4ole  oeiysfs rmn pnu0 rxnircia1fa r ivol( seurio oodomtnlfvi sfa2trxr ;u4tlxnmo3tat a rl( s t)arxoio tadfa   n ols0 rxmirpou4ale lfeil()srraxrpou0tpxnmoetasfs rau o t0 exomf3iadlat lnvi;(0trtmxm iudoleelnvsat  2ua(moot4olxnif3iytfa2raumo u4altnmf3tadoa   nvs (0 rxrir3ou1ome  ncias)aDum(rono0opeo fciat s2emn p t4trerio3oadfp elu sl(  etoxm ou1lptnlnesltfa2tax p;u1olxnii3tlt s ran pnu0alenxo3oatlm rlueilt  rto(r nodam n fet tf rrr(m no4tle ii3tldfm rln s;() lxoxr3oy1fm rlnvs t s2xmxr nydame livi s a2tm(moot1optn ieils a rlnmp;t0tetrxr3todfate u ils0trxmxopoy1ap n iesl( aDra(m ;t0tptomoctyt a ran o u0 reoxr3oodlat aueolt)teuoio oudoptelfcsasfa2tr( ont4tltnioeias s ulnvpn(0 etoif iydomte u o;s t2xoio3oy1apen iciat)s2truro;t4olto fcildls eln s;t) lermf3iadoa   n ol() exr(rpiy1lptemfvsl(fs2urx oot0tee ifciad sDumnmsnu)altnmf3oytopteli s;s0setoxr iu4lm  mfcsatfa2umxmonu1tex  ieild s ea(mo (0areomocoatom rlivo ()s2toxo3ny1ome  nct tfartr(roou4olxomo3tasfa rmnmpnu) eeoxociadoaDraieil( sexoim3ou4oltn ncilsf 2rmx  ot0oexomictadlaDel(mpnt4tltomf3iydlp e ieils0srtm(opoo4lmtemfvtls a2rmxront1opx iictldla2rln s t)tlenmf tatfmD auvo;( s2urxrpio1optnlnvslt) Dtmxmpoo1olxoii3iydlsDem(mpn(4arxoio todfa   uei (0 2trio nydame  ieiasf rtmurp;o4alxn fciyslsDrlnms;t0aexomr oydlaDelues;() rtm(r iydap elfvsl(fs2tmum ;o0opeomiciat sDeau o;t4arxnif oo1fpteaivsl()setoxm iu4lmt  net t)srrrurpot1tleomoctlslm2emu p () rerxrciodfp  an s;()setoirpoy1al   ivi (farurxrpot4tpxn oeiatfm rmumsn(0alerif3oytlatrluvo ()s2xo(o iu4ap emfes sf 2um(r ot0teeo ociytfm rlnmon(0altoif3oa1oa rauvi t)trurxo3ny1ol n nctl(fs2urxmp;t0olxo iciatfs rl(ms u4 leoifctytfa raueols sruo(r3oudap   nvsa(  2um( onu0tptn fetltfa umnvpnt0alenmf ootfmDraivi;s) rxoxopoudlmtnlfetat) Dtm(  no4oexomietld s2rl(vo;t0 exoxr3iytopD  ies;s  rumiopio4olenmici (fsrraum ou4tet if3ils aDean s;t)aetrio3tytfpte iei (0 ruo(r3io4aptn nci s sDrr(mp;o0ope ifeilsla uanmp;(0 lenio3totlptean s t) 2urxm iu1lmte fcils)aDrm( pnu4aee mf3iatls2um( p;u0 rtoir ty1fatranvs (  2uo(opio1al  miei s srurx poo0olen o3ilt m2uanvp t0arxrxf3oadfmDeauei s) 2xm(m oo1opeelivtltf 2rrxr ;u4aetn f3ilsla2uauvo;(0trtoxo ta1fate i sl()setmimpnudlmt  icsat)a2rmurp;u1tpeomiciaslsDrmn sn(0 exrmocoadfp r nes s)s2xmxm ny1llt mnes () ruaumoou0aetn ociytfa em(vp;t4treoioctotfaD lnesl()trxr(o no1amt lfcils) 2trxmpoo4aexomfctls mDelnmo t)tleoxo3ty1fmD  i o;(0 rurimpio4ol  lnct t)arrrxmoou1tlx if3iydfmDuan p u4teenmrciytomt auei;()sexm(m3nydopt mnvil(f Dtr( p;o4tlxniietytfs ea(ms;t0arxrmfcoydoa e n i;t)teumxm3ou1al elfcil( a2um(mont4aet iietadfaDumu p (4 lxrmf3oydlmDeln s t)tetr(r3ny4ome mnci ()a2rmurpou0tlxoiociadfa eanms;u) etrxf iy1omte nes s s2urirpoo4amtn nvilsfsDrmxmpnt4tpeo f3tlt s rl(mpn(0 exoxocoodlaD li o;()truoxrpoy1lpee ivtlt arrmxmpou1tltnif3tat a2rlnmpnt0arxoxo3todoat  uvs ()sexm(o iy1omtnmivtlt arrax p;u1olxomociltfsDuau s;t4alxoxf3iy1fmDrauei () 2to(r3iy1op nlfviltf ruru pno0texoifeiad a2ea( ont) etoif3ootlmDr ieo;s t2xrirpoy4omenlnvtl()a2rr( o;o1oexo oetyd mDrm(mo;(0tlxoioctotlmtrluvs t0trtmxo3nu4lme livtas)artrur ;o0tleo fcild mDelnvo t0tetnmo3to1fptraneilt sexmir iy1lpeelfvils a2umu  nt1tlt mietatfs ul( s t0trtrxo oodfaDelueilt srtoxrpiu4lpeelietlt s2tmxro;o1tpxnif3tyslsDeau onu4tltriocty1lpD lnvols0trumxo3oy1omtnmfetlt)artmu  ;o0tptoifciys m uau pnt4trenmf3iytfatr n o;(0 rxoiopnydaleelfcia(f Drm(ront1alx mietydlaDrl( pnu0arenxo3oatlmD  uei;t0 rtm(m3oodlm   nvta( sDtmu o;o0aptniietlslsDrlu ont4aetrio3oydfptrlu slt0s2xoim3nu4amt  nvsatfaDra(r nu4apxoiociltfm2emumon(4aeeriociodfmD  nesls0truoxm ny4ameemfcs (f Duaxm ;t1tpe moeiadlmDeaums u)tlxnmf3oa1faDr ues;s)setr(o3iy4opee fctls) 2rrumont1tpxniieias sDrlums u4 eenmf iotfa  luei t) 2tr(m3oydamtemfvtl(fsrtaxm ot0opxnioeiadfsDulnmon(0 exnxo3iydfmDranvs;(  exo(r iy4lle mieia(  Dum(ront4opeo f3tld mDuaumsnu0texrxo3oo1lpDr nes ( texmxo nu1lp elivt s sDurxro;o4tex ioctatla rlumpnu4 etnifcoa1oa e uvo (0srxoxo ou4ap   fcslsfsrrr(mo;t1tlt ifetld m elnvsnt0alxnircoadlatelnei;(0trtrxm oodomen ietltf Dur(  ot0apx moetas s2rl( s;u) lenmocoy1omtrlnei s0trxrxm3ny1amen fvi sfarrm( p;o0oltnmoetysfs rmnvo u4tlxrmr oydlat anei;t)tetm(opou4lmtnlicia() rta(m no0tltomi3tld m2elu snu) etrmr iadoaDrlneilt) exrir3no4amte ietlsfaDra(r oo4oet  oeiytfaDrau p u0arxoiocoytlmDraivs t  rxrio ou4amtn nciat srtaxroou1alenifetysls uln s;t0teerirctatlp r ivs t seumxr3nudope  nvs (  Dua(  ;u0oeen f3iytfm ran ont)areoir oytlmtrli o;t0setriopiu1amee icil(fs2ua(mpno0ole  octysfsDranmp;t)tltoxociytfm e uvol()t2xoxr3nydom n nvs sfaDtaxr nt1aexn o3iyslmDulump;t4alenxr ootlmt  nvs s seum(r nu4lmtnlivta( sDrmxrpnu0aee  o3ias m2uaumsnt4 eenxf totlp e ues;s0t2xrxopoydalen nvils srtaxmont0altnio3ildlmDulnvont)trxrmr3totfa ranei s  exr(r3nu4optnlnviasf rrauroot0tpeo ictas s2ua( p;t) exoircoytlmt luvilt0 rtrxr3nodole  ietls)a2tru p;t4tetoio3iyd sDuauvp u0 lermf iadoat  i o;(0 2um(o3no1lmtelnetat)srumx pou0olto i3iyd aDran o t4alenxo3oydopDrli i (0setoxo iydole mnvi (fs2rrur ;t0tlt  fctys s ua( o t0trxnifciydfaDean ilt)t2ur(m nu1apeelieia()sDuaurpno1oeeo o3iysfm ulnmon(4artoxf ty1fmt livs s  rtrim oydopenlneslt)srtaxr nu1opt  f3iyd m2elnmp;t)artomociotopD  n i;t)srumxr ny1ape lietlsfsDururooo1alt  feiatla ul(vs t0tetnio3ia1lpD aieils  2to(o3iu4lltemies t  Drmum ;t1altoioctltfa2umn pnt4arxnio iy1fm   ivo;t) 2trxm3nu1omt lneia( s2uaxmoot1apeo feiytls el(mp;(0tltrxf ty1lmDe n i;s teumiopny4lptn nei (fa2uaur ot1oetnifciydfa uauvs;(4 etoiocoodfm rln s;t)srto(o3oydalee fetl(fa2ur(r oo1tex ioctas mDuanmo;() etomr io1op rlu o;()t2trxmpio4al  licsl(  2rr(rpnt0alxomo3iydfaDrlums t0 lenmo3oytfmt aieo;t)texoim3iy4lme lfvs tfs2rmxm ot1apenii3ilt mDrauvp (4 eenxr tytlm e nei t0t2xoxm3nydlpt  fcslsfaDraxront0tleniociltfm rl(mo t)tlxomf3oa1omt auvilt0 rumir iy4lpen nci (  2tauro;u1tpe  o3iyd a uauvont)tlxomr3oodfmDr ieol()texrxm3nu4lp e netat)sDuaxmp;o0oeenioetas sDrm(vp t4altomo3iydoaDrauvi (0t2xoio3iu1ll nlivslsfsrtmx oou1apt iieiytfsDra(vs;t4tleoifcty1oatr nvo s)t2tm(m nu4lptelncils sDrmx  ;u4oltoio3iysla emnmp;t4alxnir ootfa r uei;()s2xmir nodal n ncia()artru ont1tpxo ieiatfsDeanmpn(0 rtrir ta1oa rlueo;t)teto(mpoodlpenmncs sfa2tr(rpoo1tlxnio3tltls2ranmon()tltrxo iy1lptr uvi;s) rurir iu1lm e nvi s  Dtmur nu0opeo ictltfs2emn s;t4 etrmf ootlaDe uvo t0srtoxo nudll nmiviasf 2rmx oou1optnmfeiyt s eanmo t0tltrircty1fp  livo t  2xm(o oydol   fcias) rurxmp;o4aet ifciytla2uaumo;(4aexnmfcoo1op   ieil( t2uo(r3nodol   ics t artrurp;u4opxomieiadfm eanvont4tltnxfcty1fm rlu i s truo(m io4llen nes sfsDururpoo0aeenmocilslmDulumont0 reoxf iatfp  auvs t  eurxm3oy4apen net s aDuaur ;u4tlxniociadla ra(mpnt4 rxomr iadlaDr nvol( t2xrim ny4ll  mfei (f rtrx  ot1aetoiietls aDumnvo t0 leoir3oydlateauvols0teuoio nudape  nvtl(  Dtruro;t1aetnifcils mDua(mont4arxnircoodfm  lueolt trtm(r iu4ame lneta() Dtaxr nu1ope iietat s2um(vo ()trerxf iatfp   ivi;s trtoxo3nudalt  fes ()srrr(m ;t1tpenmiciydfsDrluvsnu4tltoxr3iy1omtrlieo s0texr(opiodlm eliesatf 2ur(rpno0olxo fciatfs2eanms t4 lenio iytomDeaueo t) 2um(o oy1omt mfcia() Draxmo;u1tlx mociad mDul( p u0texnmr oadfpDeauvs;(0 euoxm iudoptn ncilsfaDtmurpnt1aeeomociltlaDuan onu4 rtoif iydom r iei ()seum(o3iu4alen fvs tfsrua(rp;u4texnifeiyd s um(msn()trxnio3oatfpte ues (0trxrir3nodomee feta( a2ta(r no0optn ictasfs ean s;t)aexnmfcoatfp elu i;t0 2xrxmpnudlmeelnes (  Draur ou4tptnmfciydfs2rlnvpnu4artomr iytfmteauvsl( t2urir nu4op emnvil(  Drm(mo;u0tlen ieiltfa2ea( ont0 etnircoatfmDelieo ( s2uo(mpio4optn feils) Drrxm no1olt if3iat s emuvs;t0 renif3tadfmDrlnvo (0trtr(m oy4openmnvtlsfarum(mp;o0opxo feias a2rmuvo (4treomfctotlp ranvo ( s2uo(mpou1olte icsls) 2uaum no4olxoioeiydlm elnvs;() rxrircoatlptrlues;t) 2xmir no1olt livsltfsDtmxr ot1aetomoeiad a2emn sn() ltrxociotfp   nes;() 2xo(o nu4ameelnct s  2taumoou4alx ii3tatls eanmon()tetrif3tytoatr nvilt s2urir oy4am   ies ()sDrax ono0opxo octydls2rauvo;u4 rtoxr iotfmDraivs;()setmir no4lme mfcs tfa2tmur ;o0olxnmictat s emnvsnu0aeerircoa1la eauvi;s0 ruo(m ny4olte ietls sDua(rpoo0opto o3iltlm rm(ms;t4aexoxr oodop r neo;t trxoir ou1ameelnvi t  ruru ont4alto ietyt m2rmu o;u0 rermf3oytfa e iesls) 2xo(o3nodam e ncsatfsDtaumpoo4apxoifctytlaDeln p (0 exoircoa1omD  iei t)t2umirpiudoptemneils arrrumpnt4olxomfctatfs em(msnu) exoifcoo1faDran sl(  2urxr3oodlmen nvtl(fartm(  nt4altnmoeiad a2um(vsnu0aleomo3oytfat livi;t)trum(opiu1optelncilsf rtmx poo1teen i3tydls ra(vsn()teeriocoa1laDelnvi;s) 2urirpiy1op e nvsl()srraumoou0alx ifciydfs2ulnvon(4 ltnmf tatlptr ieols tetoxr3nodlpt  ncs ()srrmx pnt4oeeo fctatfm2elump;(4aexnxo oytomteln sls srtrxrpoy4lpt  ici tf Dtau onu4tpeniiciltlaDul(mp;u0 lxrxo oadfa ranesl(0 rtoxo3iy1llen icsat  rraur nu4aetomo3iydlaDrlump (4 eermr iatom eaiei (0srxmio3ou4aleelivi s)a2rrur ;o4oeenioetys a2ea( p () ltnmociytoaDrlnes s) exrxr3oodal n ivils)srumxrooo4teeoifeiadlmDem(vpnt) rermrciodfmt  n s t0t2umxo iy4ome  fvtl() 2urumpou0tltomictldfaDum( s u)tlxrmo3iotlm r n sls  2xoio oo4ll  mfetlt)s2uaxro;u0tpxnmfciad sDeanvs ()treoif iatlaD an olt)s2urim3iy1ap   ieia( sDrru pot4tetn iciydlaDrm(mo t0 lxnmr3to1lm eaies (0trxoio3nodlmee fcilsfartrx  nu0tee  o3iysfm2em(vp (0aeenxr ty1omtelneo;()seuoxm3iy4optelieiat sruax o;o4tltn o3iasfs2rm(vp (0aleomocia1opt aivi t)sexrirpiy4opt lnvi s  rumu oou4tpxomfetysfs2ul(vonu0trxnxrcoydlaD  nvi t  exoxrpny1lpe  ncilsfsrraxro;t4tltn ictlsls rlu o;()aetoxr3tadlp  lu slt0s2trxm nodal e fetasfa2rmur ot1oleoioeiasfm ea(vo;(0trtnxfctytfp  luvs;()t2to(r ny4omt lfvsas) rtrxmonu0aee  i3ilsls2uaump (0 rermo3ia1fp  lnvi s  rxoirpiy4lp e fesl(  2rmxr oo0tex ii3tadfm rm(mo t0 rtrmo iadfa eaneo;t) 2trim3iudol   nci s s2tmxr ;u4tlen ieiltlm emumsnt0texoif oa1oate ueo ()srtm(rpnu4lleelncilt  2tau ono4aleomieilsls2eanmp;() renioctytopt an sls0trxrxr3nodopt  nciasfs2taur nu0tpeomi3iasfm eln o;(4aexnxrciatfa eai s;( trurir oo1amt mfctas  Drrum ;t0alenmo3tlslmDulnmpnt)artnif3iadlptean o;s s2umimpiudlmenmnvtat  Dtmurp;t4olt moetyd a2ul(mp ()treomf iotopt luei (0 exoim3no4lmt miesa( sDurur oo4tptn ieiyt m2rm(vs;t0tltnmo3ta1oaD li o;s  2umio3nudale  fcsat  2tau  no4opxo ietyt m2el(von()aetoif oo1oa   n i;s)trxm(r3oy4omtnmnvsa(f rua(moou0opeomfeiydfsDrmu snt0 rtrxf3iodomDraies ()teur(r no1omt mfvilt srrmx  ;t4aexo feiysla uanmo;u0trtoir3iotfp  aneo;( trtoxo ny1lp   fvtasfa2um(rpoo4aexoifciytlsDemn s t0 lxoirctodoaD anvi ()t2xm(m3iu4lptelnciat)s2urum no4aetnifciltfs2elnmo;() rtoxf ta1fp r ivo;t  2uoxo iu1lleelivsa()srtm(m ;u4tetomo3ildlm2uanvon(0 eeoxo3oatfpteai ol(  etr(o3oodamen nviasfartr(rono4apxnmfeiatlaDran s;t)areoio3iadlp raivi;s)t2xm(rpnodape lnct t aDrmxroot0tptnio3iaslsDemumpnt4areomfcio1fate n il()s2tr(rpny1ol  lieia(faDurum nu0oetoif3iytlm2rmu s u)trxnio3tydfm eau o;t)sexoxo3oodamtelnvt s)s2rm(m nu4aet  ictydfm umu o;t4 reoxfcoytla r i olt0 etrim3nodap emnvias a2uax p;t1apxoifeiadlaDrlnvsn(4 ltnxr3io1opDrlivi;t) etrxrpnudlm  mivia(f rtmxronu4texn o3tldlsDem(ms;()tleoif iydoa elueolt  2uo(mpou4ap nlivsat arrrx poo4opx mi3ildls2ulnms;t) lerif to1fa  aieo t0s2xmxmpoo4lm emivi ( sDuaxmpoo4texnmocild a2raums u4 eenirciodlaDraies t0 2tmimpou1om e fvtls)s2tmu pno4alxn fetls aDraumsnu4tetomf3tydom raneolt0 rtmio3nu1ale mieia(f Drmxr ;u1texn fetas m2em(mpnt0treoxr3iadlpDeli o;(0 2xmxrpou1lme liei ()srrm(r ;u0apxnii3tltfaDum( pn() rxrxr3ty1opDeanes s) 2xrxmpiy1lm emicil( aDrm(r ;u4opxomi3tatfs ra( o;t4teeoifcio1fa rlivsl()s2urirpio1ll n ncs s) Duax o;u1oee mieiad m2ul(mp;(0tltrxr iotfatrai i s s2xmim nu4om emiesltfaDra(mpot4tlxomoctadls ua(vs u) lxnmocty1fpDr i s;()truoxr io4apenlnei s) Duaxrp;u1apxnmfciytla2elnmp t0altoioctodfpD liesls0srumir ny1lpe micsa( artm(  nu1ole ifeiatfmDum(vs (4altnio3iadomDe uvi (0s2to(r3nu4amt lfeia(fsrtmxr ;u1tlxnioeiat mDea(vp;u0trxrio ia1om  li o;(0trtrxr3ny1aleeliesa()srururoou0oexnifetldfmDuauvp;t)artrif iy1oaDrlies () rto(m3iy4omte fcslt)s2ururpnt1aexomoctadfa ul(mo ()trenif io1fp  lnvs;s0 etr(r iy1lpt  fvtat)s2urumpoo4apxnmoeiytfa ulump;t0 rxrxoctatfm  ai o t)trur(m3oydlpen fvsasf rtr( oot4aexniietadla2ul(mp t4texoxo3totfaD au o (  rtm(o3nodom nlieiasfsDuau pnt4apeoioeiltls rau pnt4trxnxr3tatlaDeaieo;s)srtrxr ny4lmte netlsfsDtaxmo;o1opx mi3ildfm ea(mpn()teenmo3to1op  liesl( sexr(mpiydom  lnctl( s2rrxmoou1aee  o3ilslm2rm( ont)tetoxo oodfmDr u ilt  2xrxr3nydoltemnesltf 2tm(  ;u4opeoifetltfaDeanvs u)tleriocty1oateli s;() 2xrxo nydlpeemncilt) Dtru poo0tltn feiadlaDeln p;(4tlxnxo3tadfpD  ivs ()texoirpiy4ol n ictatfarrax  ;o1opxomoetatfaDraums t0artoio iatlp  aieol(0teur(r3io4ol n fctltf Drrur ou1aex mf3ilt s rl( o t4texnmr3iadfaDe u i;s sexmxopiodap nmnesat s2ua(rono1aexn i3ildla2raumon(4teenxociydfa elnvo;s)s2trirpoy4lpenmict s aruau ono1oexomieiasfsDuauvpnu)areoxfctadlpt lnvi s0s2tmio3oodlp e fvtls s2rmx o;u1olxn fcild aDem( o u0tltnifciotlpD au slt  2xrimpoudlpe mnvi s  Dtrxmpno1alxn oetadfs umn s;t)aetrxf ty1lpD aivi t s2xo(o oy4lmeemici s a2tau  ;t0oeeo ieiydls uanvs u0artnmfcoydoptr ueols0s2xo(o3io4omtemnetatfs2umu oou4aeenifctyt s ulnmp;u)aleomo3ty1om eaiei;s)srum(opoudlptn fetltf Duru  ;u4texn fetldfsDelnmp u4treoio iytfptrauei;(0sexo(m3ou4lmt  ietatfs2rrxm ot4oetomi3iad a rl(vp;(0 exoiocoa1lpt ai i;s  2ur(r iudope mieiltf 2ur(rp;t1teen i3iasfs2ul(vp;(4 exoxociadlp raueols0 2tmxr oo1ol n fvs (f 2uru  ;u0ale mieiydlaDemnmo t0tlenif iadlmDr nei t)s2ur(r3ou1op emnvs sfa2tm(r ou1oleoioeiltfa emn ont4tetrifcta1fpD luvs;s0texr(mpiydol  lnci sfaDtm(r ;u4tlx mi3tatls2umu ont0artrmoctodop   ieo (0 exmxr oy1omt  icilt)arua(m nu4altn feiaslaDua(mo;u4texoio iydom elivs;s  2umxrpiy4lmtelnvtatf Draxr nt0oltnioetltfmDra(vsnt4tetnmr io1omt  neo (0trtmir nu1oltemiet (fs2umxrpno4tee if3iatlm2ulnmsnt0 eeoxr iadla  au il()teuoirpio1amtnlfcia(  rurumpnt1oeto o3iydlmDemumo;u0 exoir3tytlp raneslt0s2xmxmpnu1lm n nesa(f Dtmxrpoo0olen oetyd sDrmuvs u4teeoxrctydlmt an o;t)tetoir oy4om emnvias)s2rrx ont4aetoifciatfmDemu s;u4tetomf iodopte uvols)texrio3oy4lptelietat a2raumont1open o3iysls2uanvs;() etnmrctytfptr uvil()t2toxo3no4apeelfes t)a2rax p;o1oexo oeiytlm2ua(vo (0 etnmrctadfat ai o;t trxo(o iu1op   ici t)a2tmur ;o1apt mocils a uaumsnu4tltnmr todom   i olt0texoio3iu4lme micil()srumxr ;o4tle  iciad s2rmn p t)tltrir iatoatraiei;()trtmxr no1lp  mici tfarua( ono0tpxnmfeiadfm um(vp ()trerxocoy1fmDraivo;s)t2um(o3nu4altnlfcsa( s2uaurpou0ole iietytfa uau o ()alermo iotfmt  n o;t0sruoimpiudlm emfeil() 2tmumpnt1oex ii3tysfsDem( o;t4artoir3iadlaDrlu i;t0 2toio3ny4amtnmfctas srrrump;u4tpeomf3iltfm2rauvont4aexoxr io1faDraieols0s2uoim iy1ape lncsa()a2ur(  nt4aetnifetyslmDum(mo;t0arxoxfcoy1fpDe uvols s2uoxm3iodoltnmfeslt aDtmumoot0texo fcilslm umnvonu) lxoif3ta1omt  ieo s0texoimpnudapeemneias sDtmumont1aexo ocils s uau o;()aexomf3oodlm raivilt setmim3iu1lpt lfvt ( a2ta( pou4olxomieias s2rlnms (4trermr3iytfmtranvs t0seurxm3nodll   nesl(fsDumurpoo0aleo fctld s uluvo (0trtrmfcoy1op rli s t0sruo(r io1amt mfesasfs2urump;u1oet miciasls2ea( s;u) etrio totlmt  uvol()teuo(r3nodam e ivt s  Dtr(r ot1oex mo3ias a2rmnmp (0altomo oadom rlues s)srtoirpoo4ole  fetls)a2um(mpoo0olto octysfaDrlu ont0arxrir iytfmD ln s;t  rxrir io4oleemicta(fs2uau o;u4tlxnmociatlm rlumo t0arxoir iytomD li o;() 2urxrpnydomenmfcia() rum(mo;u0ope  iciysfa rluvs;t4aexrir ootomDe n i s)s2uo(o3iy4apt lnvs t)srurxro;t0apx  iciasfa uan sn(0texrmo ootopDe nvi;t)t2xmxr3ou1omeelfctatfsDum(rpoo0tpx if3tysls emnms (4 lxnir tytlate uei;(0teuoirpnodamen nvs t sDtmx o;o1oetniicils mDrmuvo u0arxnio iadfa rlu i (  rumio3iu4op nlfvta(farta(m ot1oeeo feiyt a em( ont0 ltrircoytfm elieo t t2xmir nudoltnlfvias) rtm(  nt1oee ifctysfsDulnvp;t4tltnxo iodfpD  i i s srxo(opou4lm   fvsa(f Dum( p;o0tlxo icild a2uanvon(4treomfcoydfat auvo;s) rxoxrpny4ope lnct tfsrrr(rp;u1apxo ictltfaDra(vo;u4 exrxrctatomt aueol( tetm(rpiy1lmt mict t) rtmxr ot0altomi3iasfa elumsnt0trxomr3oadoat lu s (  rxoiopnydalt  ivt tfa2rrxrpot1tpxnmfetadls uan pnu4 lerir3iatoaD  ies;s0t2xoim3ou4omtn nvs ()a2urx o;o1apx  f3tltla2rmuvs u0 rtnmf oa1lmDelneo;t) eumxm3nu1apen icia( s2rrxrp;o1tpto oeiadlaDuanms;t) exnir3ty1om eaueil( trurxr3ou4apeemfeiatf 2tru ooo0olto oeiasfm2emnvpnu)texrif3oy1omt anvi;( s2xo(opiy4lpen fci t  rtaumo;t1tetn ociys s el(mont)tltoif tatfmt  nes;(0srtr(rpou1lle mici sf 2raxrpnt4aeen fctld m2rm(vpnu4trxomo3iytoaDr n o (0 etrim3oo4om emivsasf Dtm(rp;t1oee moctysfaDem( on()treoio tydfm raivslt0 2tmxr3no4llee fvtls  rtr(rp;o1aet mfctysfm2ea( sn()aexnxo3oa1latran i;t)srxrir no4op  lies t  2tmu ooo4aex  oeils aDrmuvp t4 ltoir todfptrli o () rxo(o3oy1om e ies tfs2rrx  ;o0opeoiociltlm2el( s;t0tlxnmfctotfmt lnvi s  rtoim3io1amen ictat s2uaumpot1tptoioeiltla2ean sn(0 lxrif oo1lp e nes;s  2trirpio4lleelnvs sf Dtm( p;t0altomo3tadlm ul(vs;u0 rtomfctytomDeaueils0s2tm(rpoo1omtn nctatfsrtmxroot4tpxniiciytls el(mo;(4 rxnmo3tatomt aiei t0s2toxr3oudll nlfeilsfaruaxmonu1tlxnio3iat m2emn sn(4aetomrctodfat  i slt)seto(o oydame  fesa() Drau ont4tltnmoeiytfa ean o (0 eeoir totlpD  ues ()setrimpnydal  mfesls  2umxro;u1ale mieilsfsDeau snt)aeerxr3iadopDranvs;t0 rxr(o ny1lmenmivi ( aDrm(  ot4tpt  ieiatfs2rlumo;u0aexomf oo1oat lneils0trto(opiy1op  mici (f Dur( pou4apxnmociat sDumuvs;u)tltnxoctadfpDraivs;s)tetm(m nudlptnlivsas)s2rrxmpot0teeniociltfa uauvs t0aetnmf tatopt au i t) etrirpny4llt micsas sDrrumo;u4aetoiieiyt sDuanmo t4 reoifcia1fpt lu slt0setoiopiu1om  mfvs s  Dumu p;t0tlxo octadfs2uauvsn() rxnmfctodfp r i i s  etoxm3iodameelfvil(fs2ra(rpnt1apto i3iasfm rlnvsnu)trxrxf3ia1laDrli sls0truo(opiodoleelnei t sDrm( poo1tptnmietydla2ranmp ()alxomo3oatom e i o t  etrxo3nydamenmfet t)sDuaxr ou0opx if3iysls uanmonu0altoio3iatoaDr nes;( trxm(r3nydop  mfeiat)a2tmx poo1optnmfeilt m ulu pnu)trtrmr3iy1om elies;()srtmxmpoy4olenmivsltfaDtaumonu0tlx mocild a umums;(0 eeoxo todfatrluvilt t2tmxrpiu4lltelfvtls) Dumur nt0ape moetysfs ua(mon(4 rtrir ty1lpt  i s (0 etmim ou1amenmiet tf rrr(mono1altomi3iytlaDea( p;(0 lxrxfcoatop  ai s t teur(mpnu1lmtelnes ()arrm(ront0tetoiieiytls ean onu0 reomrcoytlp e nvi;(  2to(m3iy1lpe mnvs s aDumxrpot1tlt mfciyt s2uauvsnt0areoxo3totfmD  nvol( t2tm(r3iu1am   fesl() 2umxrp;o1tex mieiyd aDrln o;t)tltrio3tydoaDe nei;(0srxm(rpiydaptelnetas artau  ;u1apx micildfaDua( o u4teenxocootom raivs s) ruoxr iy4opte netat) 2taxr ;o4tlxomociadfa2rm(vsnt) rtrmr3iydfa r uvs;s0s2urxr iu1om e iei ()sDtm(mpnt0tee if3iatfm2rmnmo t4alxrmr todfp r nei;t)srtmio no1ll nliei (faDra(monu1oeeoif3iyslaDulnvo;t4 etoirciydoaDeai ils)trxoxr3nydolee ivs t) 2trxr nu1ape ifeiad sDemumo;() lermr3oa1lp e n o () 2toxrpny4lptnlnesa(f rta( p;t0tlxoiietldfs ul(vp u4teenxrcoatomtrlueo;s0texoxm3iy1lpt mnctl( sDtm(ro;o0tee io3ildlsDumu on(4 eerxr tatlp rau ols)trxm(r3oydap elnesas)srtmxrpno1alen fctyd a2rl(vo;t) eenxr oa1lm r ies s)teur(o oo1amt lncs t)s2ua(roou0tex moeiltfsDum( snt4tltrif3iotfpDeauvi t  etoxm iydalte ictl(fa2tm(  no1teeoiociyslm umn p;t0aeeoiocio1laDean s;s0t2uoxmpio1al   fetls sDtmxmpnu4tee miciysfs2emu p;u4 lerifcoytoa e i s;s)texm(o3oo4optn icsls)srrauroou4oee mi3iasfs em(mp t)tlxomo iy1late ies s)teumirpoy4lm n fvsasf rrm( pnt1oeen iciltla2rmnmo;u)aleoircoydfpt aivsl()teumir3ou4lptn icsl(  2uaumo;o4alt mf3tasfs elnvp;t)aeerir3ta1lmDr uvi (0s2toxm nydlmen fvs tf rraum no1oex  fcilsfaDrlnmp;u0aeerir3ia1laDrlueolt trto(mpoo1aptemfes s  rtm(m nt4tetnmoetasfs rlnvs;u)alxniociotfmDe i o;()t2xoirpnudal   nvta(farrr( ooo1olx micias a2rm(vp (0aeeoio3tydfmDrau ils  exo(m oy4aptnlncias) 2trump;o1oet  octydlsDrm( p;()aetnmf3tydomtrli s;() ruo(r oy1lp n icta( sDtmur ou4tptnmo3ildlm2elnms () eenxocoa1fmtr iei;s0t2uo(m3oydom   nvi tfsDuax pot1tex iictldfs2rmnmsnu4trxoioctotlptr nei;s0srtoxm3ou4lm   nci t aruaur ou1ale  i3ilsfaDrl(vsnu4trtrifciytlpDranei t srtm(rpiy1opte fctlt srurxmpnt4tpeo f3iydfm rmuvonu) eerif3ootopteaues;s)seurio3nydame lnci t  2um(m oo4opeomo3iat m rauvonu)tetrif iadom eai olt)srxm(r3oodam n fct t artrx  ;o1oeto ieilslm2raumpnt4 ltrxf3ia1lpDraueol()s2tmio3oudamt lnvtl(fsrrmxr nu0oeto o3iadlm ulumo u0aexnxr iydlm r uesl()trxmxm3ou1ap  livtls a2uax oot0aleomfeiysfaDrlnvsn(4 rxomo to1lptrau i;()t2trimpiy4altnmici () rrm( o;t0opxo feiatlsDemuvonu)teenxrcto1lpt lieols)srumiopoo1ol nmiei tf Durumonu4oexn ieiaslsDeauvsnu)tetriociytom eauvo;s trxm(o nudomeemncil() 2ra( poo1ale  ociys m2ea( snt0 lerxo3oatfpt  nes ( texrxo oy1amt  fcsas)sDtr(ronu1oet  i3tlt a umuvpnu)altrir iodom r uvi (0s2xoxmpny4lleemiciatfarrrx  ;o1apto ieilt aDuln s;t4trxoio totoa ran s;(0s2xm(o3iudam nlfvs t  rum(r oo1apen o3tlt aDum(mo u)arerif3totfmteai o;t seur(m nu4ol n iesltfsrumxmp;o1ape mfctytfm ea(vp;u4alxrmr ty1oat lu o s) eurxr3iy4ome  ies t  ruaxmp;o4tptn f3tydfa2ulnmp;u0trenirciodfmte ueo ( srtoiopoo1al elfvt s)a2rmuront4opxoio3iatlm em(vsnt4 exnif iotfmtr nvi t)s2xrxo oodope mfcilt)aDtr(rpno4oetnmfetyd m2umn p;u0artnir tydlmDeluvo t0 eur(o iudaptemfeilt  2umumoot1oex moeiysfm uanmo;u4teerir3oytla e u i (  exoio3iu4lpenmnvsas  2rmxmp;u1apx iieiltls2ul(vonu0 exoifctydopteaneilt)teumim3oodllt  fetasf rtm(  ;u4aetn i3tysfsDemnvo () lxrif iy1omD  iesl(0teumxr iydapeelneiasf rrru  ;o1olxoiietld m2eluvpnt)tltomocoodom r ivo;s trumxopiodam nmnctatfsrurxroot4apxo ocild aDeanms;(4 lxrmo3oa1fpD  u slt0 rurimpno1om nlnvs tfs2umumpnu4ole mfeiat s rm(vp u0arerxr3iodfa  aneo ( truo(o3nydlleemnctls s2rmurpnt4aeto ocild mDumuvpnu0alenxo oytlptrluvo;(0sexmirpoo1llenlnctl()s2tmxrpot4teen o3tat m2eaump;u0trtoif ia1opDeaies s  2umimpiy4lp  lfetls) Duru  ;t0tpeo fciyd s2el(vo u0 lxomo3iodfate i ols)trtmxmpou4op e fvi (  rrmx p;t0aexnifctatfsDrluvp u)trtnif3oytfptran sl(0 rtoxopiu4apenmivtltfsrumu  no1ope  o3tls s uauvp;(0 rtrif3oytlp elieils0sruoxm3oudom emfct s sruau  ;o0oee  f3iadlsDrlnvpnu0 reoxo oadlmD ln i () rtmxm3iy1lmtnmnctl()a2um(rono0teto iciadfmDuluvp (4 eermr3ty1fmt  u i t)trum(o no4llenmnctl(  2rm( pnu4alx  ociydfaDulums;t0alxoxr3ia1lp r uvi t) rxoxm oudlmtnmnctlt)aDtaum ;t0tptn f3iydfsDemump;t4 etrmf oy1lm  auei;t0sexoio io1llee fvi t  rrmurono1alenif3ilsfa rau ont0 ltrmo tydlmtrlnvilt0 exo(mpnodam nmncia(  Dur(rp;o0optomoeiydls2rlnms;u0tlxrio3oa1fmDr nvolt) 2xrir ny4lmenmnvslt)sDtruront0tex mf3tlsfsDeln p;()aetoioctytlmteaiesl( srtoimpnydlmtelieias  Draxm oo1tex mo3tlslm ra(vp;t0teermo3tatlp rau i t teumim iy1ale mfcilt)aDurx ono0altoifetldlaDea( p;u0aexnmr iytfptr i s s)t2xr(m nu4ol emneiltfa2ua(m nt1tetoifctlsfs emumpn()arenmo todlateauvs;t)trtmir3iu4aptnlnctl(  Dra( poo1aeeoiiciatls rm(mp (0tlerxr3todom  ln ols teumxrpnu1amtnlfvia(fartmuro;o4olen i3iys sDrmuvon()alxoxr todlm ean o t) rtr(o3oodlltemfet ()srrr(m ;u0tetnii3iadls em(vsnu) etrifcoo1laD li i s0seum(m3iydlptnlfetas) 2ururpnt1opxn oeiasfm rlumpnt4 ltoxr iodfa  li i s) rtrio3nudlptn ictasf rrmu  nu0apxo octydfa2rauvpnu)trxrif oy1lpt aivo t  etoim3io1ape mnvtls) 2ua(m ;o1ole ioeildfaDuau p (4teenircoatla r n ol(  euoxm3nu4lltemfvi ( aDrrxmp;o1teeo ocilt m rlu pnt)alenmo oydfptranvol(0t2umxr nu1al nlnvils)arrr(  no1oexomictat m2rmnmo u) rtrifcoy1fate uesls  exrio3iu1omt mfes ()artau  ;u4apxniietyslaDrl( pnu0tlxrxfciytoa elnes;t  2xmxr3iy4ole mnvsltfaDtr( pnu1tpx moeiydls2el( o u) lenio oatom rai ilt)s2tr(r ny4apte ivtlsf Dtm(mo;o1olenioetlslm2rmu p (4teenmo3totfat lieo;s) ruoxmpiy4aptemivt () 2rrumpnu0ale if3ild sDeanvp;(4aexomoctadlm elu s;(0sexmiopnudam nlnvsls) 2uaxmoou1teen o3iadfs uln o u0 rtnir3iydla  lueo;t0sexrim3io4amtnmfeiasfa2raxr ot1olx ioctltla elumpn(4 rxoioctatlmDelnvs;s0teumxr iodlm  lnet sfaDrm( ono4oetoiociat s eanvsn(4 ltnif3io1oaD lieols t2xr(r3io4apen ivtasfsDtrum oo4aetnioetlt aDeln o;t4tltnmfciy1laDe ivs t  rtmxr3oy4ole  iet (faDurxmpou4open oeiad s2rmnvsnu4teenxocoo1lpDelieil(0 rtoim3no4altnlnesasfs2rax ono0tltnifciat s2eanms;()teenio3iydfm  lieilt0s2tmxr oy1lp e iesltfsDur(ro;t0apto oeildfs ulumsnu0 etnxf oo1fp eluvo;t) rxmio oo1ll nmfvtat)srtm(mono0aetn ocils aDulu ont4tetnxocoo1op  ai i t0srurir iydap elfeia(farur( ono1alxo ictlsfs elums;t0artrifctatlm r ivil()srxo(r3oo4ol  mictltfsDtr(mp;t0oleomoetlsfa2rl(vsnt4alxnxo tydomDeli s ( s2uoxrpnu4op e fci (faDurxront4optnii3ild s ul(mo;u4aleomr3oytfpD au o;s setrio3nydop elfcsltfsrtr(r ;o4oex iictyd s2eaums;u4aexnmo3to1oatean ils  2tr(rpnu1op nmfet sfsDtrxm ou1oetnmoeiyd s2ra(mpnu) rtoif3tatfa  livslt)t2xm(o3iy1apte icsl()sDtr(mono4tpx iiciydls2uau pnt4altoxf iatlmDelivi;( trxmxm3ny1aptnmnei s)srrr(ro;o1apx ifcilsfaDrlnvpnt4aeeomrcoatlm r u o;( t2trxm3nudlm n ivtas)aDrmx  ou1olxomiciyt mDel( s (0 exnmf oadlpt ln ol() exmimpiy4lltn ictltfa2rm(m nt1ape mf3iys a rlu o;()tlxrxfciodlmD an sl() eumir3iu1lpe  fcia(f 2rrx  no1oeto iciyt mDuanmo;(4alenxf3tatfmDrlues;()t2toir io4apt  neslsfsDrm(monu1tlxnmieilsls el(vs (4 rxoxrcia1lp   uvo;s) 2toir3iydolenlfesa(fs2tmx  ;t0teenio3tlsfm eluvont) etrxoctodop rau slt0 2urimpiu1al nmieta(fartr( oou1aleoioctadls ranmp t4altomo3iydfm ran o (  rurirpnu4lltemicslt  rra(mpnu4tpt iociatlsDrauvsnu)aetoxrcoatlat  ivi t teurirpou1alt livs ( sDra(root1tlxomo3iydfs ua(mp;u4tltrircty1fpt anei t)t2xmio nodll  lfcsls)aDumu pnu1tet  fetydlsDel( s t)artnir tydlpte nvs t0sexoxm no1llte icias) 2rmxm no1tee  fctlslm ea(vont4 lxnxo3tatoaDr uvo s0 euoim3oodomen fvils a2rm(r ou1tet mociat m ua(vs;t) etnmo ty1lat  nvil(  rtoxrpny1ale lietls)aDrm(mpnt4olx mf3tyd sDra(mo;u0trtrxrctadfaDeaies ()teurim3oydlpeemnvta() Dtrumo;u1tlxomoeiytls rm(vp;u0 lerxrciodom   i i;s0s2xr(o ny4opte ics s)artaum nu1opt  ociyt s umnvo ()artnxr ta1opt au i s)tetrxmpny4lpeelfciatfaDtrxr nu4aetomictldlm2rm( o;t)trxoir tadlaD  ivo t  rxoxm3oo4amenmics s) Dua(mpnt0opt mfcilsfmDul(mo;t0arxrmo oatlatr ieilt  rumxo3no4amte iesls  2uaxrp;o1ale mociaslmDeanmsnt4 exnxr3oydfaDrlues (0teumim3ny1ape mfetasf Durx  ou0tlxnmfctyt a ra(vsn(0trtrmo oatlm  luesl(0s2xrio3io4lpt lnet s)srrmxmp;o0tpxnmociytla ulnvs t4 rtnxfcoatfp rlieo;t tetm(m oy4apenlfci (faDuru o;o0aetnioeiadla umnvo;t4aexrifctadlmDraues t)t2xrim oy1om  mietatfs2urx  ;o0aee  fcildfaDeln o (0arerxr oy1oatr u o (0t2uoirpiu1omt lnetlt) 2raurpot4oex iiciltfm emuvo (0tltoif3totoaDeaieolt0s2urxo io4ap emfct t s2rr(rooo4opeo fcilsla umnvp;u4 exoxf3oy1faDeli olt0 2trim ny1lme mneilt)a2raur oo4apt mi3iatla2ua( snu4tleomocty1optrlu i (  2umxopny4ll  mfeiltfsrur(  ;t4tleomf3iyd aDemu p (0 eenmo tydfptr nes t t2uoirpiodamtn fvils  Dtmxr ;u1tex mf3ilt s2rlump u4texnxf3tydlm r u o;s0 etoxm oudlpt lneiatfs2umxro;t1oex mf3tydfa ua(vs;t4trxnxo tydomD liei (0 2urxo io4apen ies s s2uru pno1openifctlsfm emnms (4 lxrxr3tadoaD  uei;s0trtm(m iy1amte fvs t)aDumxrp;o0tltniocild a rlnvsn(0 exrmr oa1la e iei t)srurxrpio4oltnmici () rrrum oo1olxn ociytfs emump (4aexrxf oodlp rlnvs t0sexrim oo1alt mivt sf rumxr ;u4tptnifeild m2umnmo u4 exoirctotfa  anvils0t2uriopoydom   fei t aDtrumono4opeo octldfs rmnvpn()artrioctotlmtraueo s0s2toxr ny4olen ict sfa2rau p;t0apx mfciasfa2el( o (4 leoir3ia1fmDrli s;(0 rxr(m nydope  fvia(f Drrxroou0opx if3iasfaDel(mpnt0texrircio1lm   u i;s)teto(mpiy4oltnlics ( aDrmump;t1oexo fetltlm ran o u)tltoio todlpD auvo (0t2xrxrpio1op nmieiatf 2uax  oo4alxnmi3iysla2emumo;(0 rtoxf3ootlateauei;()sexmim oudoltn netls  Dtau o;u0tpt  f3ildfmDemuvo ()areomo3ia1fate i slt)trxrim3nu4al  lnes ()aDtm(mo;t0oet  fciysls emnvpnu4artrxfctodom e n o;t)t2xr(o oydlltnmictltfsruaumooo4ole io3ild s ean p;u0altrmo oa1laDrauvo;t0 rxmirpno1opeelfei sfsrra(m ;t4alx  oetldlaDuln s t4aetrifcta1oat au i s  exoiopiy4omt  fcta(f 2tax oou4tpxomoeiasls eaumo;t)tlxoxf iydomDeanvsl(0srtm(r io4ale liei tf Drr(mo;o0alt miciyt mDumuvp u)aeermfciotomtrlies s) etrxr oo1lmt livi t)aDrrxr nt1tptnifetas a em( p;t4trxrio oa1lp  lies;(0teurxm3io1lltn ieilsfsrrmu pot0aexo f3iadfs um(ms;u4 leomf3oodlpD aiei;()t2triopno4lp nlnvt s aruaxr no4tlxn fetatlaDra( p;u)tlxoir3oo1fat luvil()trto(rpou4ol nliciatfarrm(r ;t1apt mi3iytla emn ont) rtoxr oa1lp eai o;(  rtmim iudllt  ics s)srtmu ono4aptomoeiadfaDrmu sn(0alenifctatoptelnvi (  rtmim nudlp e icsltfs2rau  nt4alenmoeiydfa ranvs;t4tetnir3oatfaDrlivol( teumxrpiydlp nlnci tfaDtrxmpot0aeeniicias m2uauvsnt0 lerif3ty1fa eli i s)trurxr no1omt mfeil(  2ra(m ;o4oltniiciytfm2ulumsnt)aetoxf3todfmtr ivol() exr(o oudaltemnesasfsruru  ot4aptnmfeildfa2rau s;t0tetnxr ta1fatr ivo;() rum(m3oy1ol emicsltfsrumum ;o0ope ifctls s ranms () reomrciydlpt lieo s0setm(rpiu4llen fvt tf 2uaxr nt0aeeomfcilt sDrl( s;u4 rtoxrciy1omDeauei t s2xo(opno1llt mnvtl(f rrrxrono1opt  oeild m2ra(msn()teeomo3oa1opDrlivi;()tetrim iydaptn fetls)a2tm(m ot1aleoiocilslm ean pnt4aexoio ootomte nesls)t2xmxr nu1ape  icta() 2rr(  no1texnmo3iys a2em(mont0artoxo oy1fp   nvi (0s2toxr3ou1ap  lfvt t)aDumumpou4olto fciyd a2rl(msnu)aetoxrctodlp rlu ols truoxm3oo4lpte ivt t)artm(m ot1oeto fetlslaDran pn(4tltnxf3oo1oa rai ols0 2tr(r oo4ap  lfviat)a2uaur oo4apx if3ildfs2rm(ms u4aleoxo io1oatelueils0srxoxo oy4lle mfvs (  2ur(r ;t0tlx mf3iadlmDel(msnu4trtrxf oytla e n ils) rtr(m3no4op  mietlsfs2tm(rono1tltomi3tys aDea(monu) etomf3todlm e ivs;s t2uo(mpoy1ol  mnes (f Drr(rp;t4olenif3ilslsDulumsnt0teerifcoytfmDelues (0srxmxrpou4olt mfeias aDrax  ou4optn ieiatlaDrln p;u4artomfctodopD  nei (0 2toxo ny1am nmivt t)s2rax onu4aleniietasla ea(mp t0 ltrxr3oatlp raueil( t2umxm nu1omeelnvtasfarra(  no1oleomiciltls rm( p;t4teeriocoo1op e nvo;t srtrim3ny1ol emicsls)artm(ronu0tpxoiociatfmDrln s (0aetomfciydlp eauei;t0 2xo(o ou4omt lieiat) rrrxmo;o1tpxn iciytfaDel( o t0areomfcoy1omteanvi;t0 eurirpno4lm nlfeilsf 2tmx oou1alx iicildlm rm( s;t4 exnmrciodfa r ivslt0 exo(r nu4amen nci (faDur(mooo0apen o3tyt aDrlu snt0 renir ty1lmtraivi t)trumxr oodlp elfetatfsDrau onu1tex  oeiaslm rmnmon() lermr oy1la eanvols)teto(r iu4lpt  fvias a2ua(m oo4open icilsfa2uln ont4tlxrxr todop eauvo t) rxm(m no1om nmietlsf rtax  ;t0ope  feilt s2ua( sn(4trermfciy1opDeanvi;s0sexo(r nu1apt lfcias)s2uaurpno4opxo octldfa2rmnms;(0arenxoctotomtran s s srumxm nu4lptelietlt)a2ta(m ;o4tptoif3iys s uanmpnu4 lxnmrcto1lat lieo;s)sexrxo3ny4olt  net sfs2rmurp;t4opxo oeiytfa2emumsn(0tetnio ootom rluei;s0 rum(o oo1olenmiesl(f rua(m oo4ole iociaslm em(vp;t4 reoxf iydlaDeanes;s0t2tmxr oudaltnliesls)sruru  no1apeo o3tasfa rlumpn()trtnif3tydfp e i s t teuoimpny4opeemfctas)sruaxm no4aex mociysfsDeanmp;u0aetrmo3oa1fatean i;() etmir iydapen icta() ruaxrp;u1tet mi3iys aDel(vsn(4texnxo3todfm  auvo;t s2uoim3iy1am nmfcsatfsDumur ;t4optoiietas s2ra(mpnu)tltrio3ta1opD  uvsls0t2ur(opio4lm   fet sf 2uaump;t1ole mi3iatlm2elumonu)aetomrcoatop  aivo s  ruo(r3oodlmtnlfvtlt)sDtr( pot1ape mfcils s2uluvont)tlxrio3ty1lm rli o t)setrimpno4apte nesa(  Dra(r no0alxnmi3ias aDul(vp u) rtomocoadlaDrlnvo () 2urxm3iy4optemiei (  Drrxr nu0openmicildfa ua(vp;u) etomociytfa eln o t) 2xrir no4lmtemnetas a2tax ont4apenmi3iltfa ra(ms;t4trxomrcto1omteli i;t)seumxm3nodop  mfet t)s2umur no4aee  f3ils a ra(vs;u0aexomr tytopDeau o;s t2to(o3io4ap nlncsa( aDumxm ;t0alen f3tadlaDulnvonu4aexoxrciotomtrli slt)tetoxr3nydamtnmnci t  Dur(ro;u4tlxnio3iyd m2ean s;t4tlxnmr3ty1fpD aieils0trtmxmpoodamenmnet t a2rru  ;u4tpeo ieiad aDul( o u0aeeomr tytfp   n olt trxo(opiu1am nlics s)s2ta(m ot0altoiociytlmDeanvo u0 renmfciy1optr ivsl()tetoxmpiodapeemnctasf rtru p;t4tex  f3iad a emnms;u4tltrxf3iytlatrlu s s)t2xoxmpnudom nmfet ( aDumxr oo0tpe  f3ild m2rlums t0 exrmfcio1fpD aues t0 2tr(o3iu4omen fci (f 2uru o;u4aetnmo3tlt s um(vont) rerxocoadfpt  u o t0tetmxrpio1optelivs sfsDrr(roou4aexoif3iasfm rmn o u4tlxomr to1fpDraieils  rxmxmpiu4al  mieiltf Duru oou4tee ifciatls eau s t)teermr3oodfp e u o t0 etm(m nodllt miesas) rtr(m ot1tpt  ocild a2ul(mp;t0treoircoo1fa  luvs;t  rtm(rpny4ol elicia()a2rrx oot4tpx io3iytla2um( snt)trxoxf3oodlmDeanes s teumim3iy1amte feilt)s2tm(  ;o0oet  oeild aDum(vp t4altnmo ta1faDe uei t0srumim nu4lpen ivi tfsDrmxro;u4ape  ieiysls ean o (4 rtnioctydfmtranvo s0 rurirpoy4am   ivs (fsrrmumpou1ope miciydla umn o;u0 lxomr oy1omDeau s;( trxoio ny1ll n fvs ( aDrax pou4opx  i3ils s2rmu p (4aetomo tytlaDran s () eurio ou4opt lnct ( aDumuroot1alx io3tldlm ulnvp (4texrmr to1faDeau s;s0truoxr iy1amt  ict ( s2trum nu0apxomo3iydlm umu snt)altomfcoytlp  aues;()srumxmpoy4oltnlfvslt) 2taum oo4aeeomf3iydlm umnvp;(4areoxfcia1oaDeauvilt0 etrio oo4lle lfeiltf rrm(rpot4tpx iieiaslmDuluvpn(0trxrmo iy1oateliei s tetmxo oy1ll  lfcsls)aDuaumoot1tlenmfciatfa2emnmsnt0 rermociatlpDelivi;t) etrxo iy1lptnlictl(farum(ro;o4tlxnmoctls a2ua(mp u0trtnxo oo1fatranvo s)t2xmiopiu1lltemfei t)srtr( pnt4alxoifeiydls eanvo;t4tlxoircia1lmtr nei;(0t2umxmpoy1lleelicia(  2rru  ou4aexomfetldlm2ea( p t)alermo3ta1fp elu slt t2trxmpiudll   neiltfsDurx oou0tex iietadfa2ua( p;u) lxomo3tadoaDrlivs t  euoxm iodop nmicils srurump;u1tpeoif3ilsls rlnmo;()altnir oatlmDe ueo s  eurxr no4al  lnvilt sDrm(m ou0tetnioctysla ulnmo (4aexrxo3tytlatrluvils texr(rpou1ap  livt s sDtm( p;o4teto fetaslmDeanvpn()tlermo3oydoat  uei ()trtoxrpoo4lpt mfci ( srur(rpot0olx ioeilsla2emuvp t0 lenir tatoaD  uvolt) etmim oy1aleemnet s) rrax o;u4ale iictyt aDrlumpnu4trxrxo tytoa eaies;s0srxmxm no1omtelicsa()arrauro;u1tptnmfciasfm ea(vp;t4arxoxr3ta1omte nvi;t0s2xo(m iu1lptnlieilt  2uaxr ;o0tpeomf3iaslsDuaumpn()aexnio3iodlp  lneolt  2urxmpiy4aleelici (f rtmxrpnt1aeeomoeiyt a2rln p;u0teeomr to1la r ieo t0 rtmxr oo4oltelnvt t aDtaxro;o4tpx mietyt a ulnvs t4 etnxfctodfpt  neo t  rtr(rpiydlm nlivi ( sDumx  ;o4altoifciytfm2ulumonu0 etrmf ia1fpteauvi;s  rxmxo3iy4altemfcias sDua(m ot1aeto ietldfs2elu onu0trtoif iotlpDr uvi (0t2xrim3ny1openlivi (  2rru o;t4opto fetltfsDrauvo;t4texnio3iydfmt  ueo;s)teur(rpoo1am  lneiasfa2urxmooo4aeen fctad m uaums u0tlxrmo3oodoateanvslt s2tm(r3iy4lp   fvils  Dtm( ono1oee mietyd a2em(msn(4 lenxf oodfpDe i s s)sruoim3oy1amtnlnesl(faDtr( ooo4ole iicild m2rau s t4alxnxr3oy1fmDeaivols0 euoxo no1ole lnvi sfsDurxrp;u0tptnifcils m rmuvpnu)aeenxfciy1omt  u o t0srxr(r3no1lp emivil( sDrmxr ;o0teeo iciysfa2eaumpnu4 rxnircoydfaDr ieils) 2urxr oudll emictls)s2rmx ooo1apto o3ildfsDuan on(4 lxomfcoadoaDrln slt  rurimpiy1am nmivils)a2ra(rpoo1opxomietasfa2rm(mpn(4aexnmr3oytomtr uvs t0s2xr(m oydopenmfeia(fsDtr(rpno4aee  o3tyd s2ul(vs u0arenxo3oa1la  au i t0 eumxo3nu1llen ivi s)artmum no4apeniociaslaDemuvo t0aeeriociodfmD  n i t0tetrim3nu1lpee nvtl( srrrum no4tee  icilsla rmnvo;u4artnmf3iy1lat  uei;s)t2ur(rpoydolte fci s)s2tr(mo;o1oltn ictas m umuvpnt4tlxoio3oo1oa ean s t)truriopio1lp emnci t)aDtrum oo1oltnioetldls eluvp;t0 exriocto1om  lies ()t2urir3iodopenlneias  rrruroou4alxoiieiytlaDeau p ()aexomr totfpt ln ils0trum(rpiydam n iet ()sDtrxr oo0oetoifeiyd a2el( pnu0 exnmr ty1oa  auvo;s)teumxo nodam emiesls srtmur no0tet io3tasfs eaumo t0alermo3oatfpte ues ()sexrio oodlptnmnetl() 2um(rpot0apxn i3tadfa2rl( o u)texoxo3iydfa   neilt)trtrio iy4opee ies s sDurx p;u4tltomo3tltlaDuan o u0 ltomf io1fa e neil( tetoir3oydape mnctls)srtmur ou4aex mieiad s2rl( snt4aexnmociadfmtranvs t  rur(m3nu4om elfet sf rua( oot0aexoioeiyslsDrlu o t0texoxo oy1faDrlues ()texoim ny4lm nlfvtat s2taump;o1aexn f3ilsfm2ranmp;t4 exnxf oodoatrau i;s0seur(m3iu1openmict ()a2umxmp;o1aeeoioetldfm rmuvo;u4trxrxrciadomtrlu i t0s2trio3oydlpen nvtas  rtmu  ;o1olxniiciasla raums;t) lxrircto1fptrai o;s  2xr(r3no4apen fctlsf Duaur ;u4tptnmfcildlm2emnmp;u)altnxfcoa1oaDeauvo;(0trtoimpno1llte ncil()sDtaxro;t4altnifciysfm umnvon(0teerio3oadomtranvo s0 euoirpnodalenlictatf 2tmx pot1opx mf3iad aDelums;t)aexrircta1fmD aies;s) rxr(m iy4altemiei t a2ur(mpnu0opx  ociyt a2rm(vs;t0tlerif3io1lmtrlnvi ( s2umxo3iudopt  ietl(f rumu  ;o1aeenmi3iad a2ranmpn(4 ltoxf oodlmDe nei s0 rtm(r3iodlmeemieil(f 2umxmpno4opeo octyslaDrmn o;()aeermr iodopD  neil()t2xoxm3ny1optemict ()sDuaxm nu4oeenioetatfa emuvont0teeomr3io1omDran i ()trxo(rpiu4lme mieia( a2rrumpnu0optnmicildfm2uauvo;t) ltoxociy1fmt luvi;t seum(r3nudoltelnesl() rurumo;o4teeo f3tatla2eauvpn() eeomo3ootoa  li o ()s2xoxr iy4ol n fcil()artrur ;t1oltnmfeiadlm2rl(mp;u4aleoxr3oatopD lies t)trur(mpnu1lpenlietlt)s2tm( o;t4tlenifeiytfa uln o;()treoifcta1fmDrauvsls)t2um(m3oo4apte fct t aDtmxmp;u1ope  o3tldfmDuau snu4aetrmfciytoaDe u o s0truo(o iodam   fvsltfa2urumont0tpe mociatla2uanmpnt0tetrxfciy1lpt lueo s0t2toxr3iudlptnmfesas)a2rm( ooo0oex ioetysfs2eanmsn(0artnirciodfaD  n i (0teuoxrpiu4apenmiesls)srurxmp;u0olto i3tytfmDemuvp;() eenifctytom raueo (0sexo(mpiy1lleemnesatf Dtrx  oo1aleoioeiys aDrl(vp u4 lerif3iodfptr ivslt0sexrxrpny1om elfesat)s2ta(r no1aeeoif3iltlsDrl( on()tlermo3ty1omte u o ( trtoim3oudlmenlfvilt)a2ur(mpno1altoiieilsfaDrmu snu)arenif oa1lp   i s ( srtrir iydlp n feia( a2urxm no4oltniocias a uan on()tltrxf3tadoaD lneo t0teurir oudam nlnesltfsrtru  oo1apxniietldlaDua( pn(4arxrmo ia1fpt anvol()setmim io4olenmicil(farrmx p;o1tex iiciadfaDemuvo;(0 exnxo3oy1fmt  ies (0 2uoxm3oo1lltnlnvtlt) 2tmx  ot0aexo o3ildla rlumo t) eermr tadlmt lieslt srtmxopoodlme mivil()aDurxr ot4tptnmfetadlm2emnvon() reomr iytop eau s;t)s2xmimpoy4omee nvtlsfarrr(mpnu1oex mf3ild aDra(vsnu)arxomrciadlmDeli o t0 2xmxrpoo1ape licsat s2rrxmp;u1teeo i3iltls rm( s t0trxrmoctatlp eauei;( srtm(mpoy1alt lnvtl()srum(  ;u1tpen oetld s2ua(mont)trtriocoy1faDelies ()teurim3no4ll emfetas  Drmx  no1oltoii3iatlmDran o;u) eerif iatlm e neil()trurxm3oy1lp   ncsas)a2um( o;o4tlx  ieiyt s2uan p;(0tetnio3oo1oa  ln o;(0setrxm nu4amenmnciat  2tmu ooo0altomfetlsls em( o u) exoxr3ty1fmDrai s;t trxoxrpnodlm elietl(fsrur( oou1optnif3tad sDul( pnt)texnir iy1oa r ueo ( t2toirpnudame  ivi ( s2tmxm ou1aee  oeiltls2umu p t0tleomrciy1optr uei;( t2xrir nudomeelicil()aDrrumono1ole  fciltlm eau p;t4 lxnmf3ia1oatelu i t  2xo(r ny4ap nmicil( s2ua(m ot1tpx if3iltla2ua(mp u4altoio iatoptr uvs t0 2uoxr3oydlltnmics sfs2tmu oot1aeen f3iytfmDrauvo;u4 exomr3iatfp raneo s)trtoimpny1lmte feia(f 2uaurono4ope  f3iadla2uau p;(4arenxo oy1lmD  uvils0s2xmimpou4olee nvs (f 2ururpnu4alx ioetld m2ua(vsnt4aeerif oo1om rlueo () 2ur(o3io1altelfctasfartrxrooo1tlenmoeildfaDemn sn() leomfcoytfa r u il(  rtoxrpnodole  fvtas srrrxrooo1opx ii3iad a2ra(monu0 reoir3iadfptr ivolt)teumxrpoy1al  mfetlsfsrrmxmo;o0tet mociad mDumuvsnt0artnmf3todlmDr ivi;t trtr(m iydope  fetasfarurumo;t0ape mociat m2rau p (0 rtoifctydomDr u sl(0texriopnodole  ieta() 2rmx pnt1tpxnmoctysfa rlums;t0 lxnir oa1oaDe neo;( srur(opoy4opeemietas arrm(r nt0altomfctyslaDra( snt)texriocoodfate nei;s)srxmio3nudal e feta(f rtaxmpoo0opt mo3iytlsDrlnvpnu0 lerif3oadoateaieo s)s2trxr iydlp e fct (fsDtaum ;o1aeeniieiysfs ulumpnt4alerxo3iodfm  lu sls0srxoio oo4ol e nvs s arumxroot1tpxn fetatfs2rlnvo (0teeoxo tadlm   uvi;t0srxoxrpoodapeelieiat  Drauroot1tltoif3iasfsDrm(vp t4trxoioctytfat  n s;s0setr(opoy4lltemieil( aDumum ;t0tee  i3ias m eanvs;t)tetomfcoa1opte n o t0s2um(rpny1am emnvtlt) 2umxro;t1aeenii3ildfaDulu pnu4aexoio ta1opt  ies t setoirpnydll  mnvsas s2uauroou1oexomoctldfs rln s u4aeeomr totom rlu o;t  exoiopoo1om n fvilsfaDtr(  ;o0tle  ictat m2um(mp;t0arerxf3iydoaDranvi;s seumiopio4amtelnvt sfsDumurono4opx mf3ildlm2eanmo u4tlenmf3iatfpDr ivo;t0 rtoio3io4ame mfcsl(faDtmx  ot0aee ifciadlm2uauvp u) exnif iadfm rlieils)srtrir oy4ole mneils artmxmpou4oeen iciatfa umuvp;t)tltrio3oodfptr ues;t trtmim3iu1om e ivsltfsDua(mpou1apenmoeildls2uaums (4artomfcoo1lm   u o;( teumirpno1opt mivsls  2ra(r nt4tetomoeias m emuvp;()aleoiocoo1fat lneols0 exmio ny4olenmnetls)aDurur ot1aexnmf3tasfm eau p;(0aeeoxf tadlp e uvi;t srurio3nodlmeemneta(faDua(r no0oexo i3iyd m umnms (0aleoxfciadfa r i s;(0 rum(r3nu4op n ieiatfsrtrumoou4tpto iciys sDemnvp;t0tltnir3io1omt lueo t s2xrio3oo1am elncil(fsDtmx  ;o0aeeo feiydla uan snu)aeerxociotlaDe n s;t t2xoxm3oo1om emicils s2umx pot4ale mictls m2ea(vp (0tltnmo3oy1oatranvs s0trxoimpiu1op e ivia()artrx pou1tet miciat aDrmnvp;(4 eenxfcta1oatran olt)srto(o nudop e ivsl() 2tm(rp;o0opeomfciltla emnmo;u)tetrif3iytom r nvi;t) rtoiopoo4ll  lfcsat)s2uaurp;o0oee mf3iydfm2rauvonu)altnif to1op e n olt t2trxm no1ol   fcilt a2rm(mpou0tpx mi3ias sDuanmp;u4 eeoxo tadomt luesls0 eur(r ou1ol e fes t) ruax pnt1tpeniieiatfsDemnmp (4areomfcoa1lpD lnvs ()t2toim3iy1llte ivsas)arua(monu1alxnmoeiaslm2emn p;u)aeerir ootfm elies;s s2ur(opoydaleemfvi s artrum oo1aeen octydfaDrlu s u)artoxr tatlmteaueo (0srtmio3io4ol nmivsl()aDtmxmp;t4teen iciytlsDeanvp;t0teenmr iodopDr u s t)trtoxr3oydol n nvils sDra(r no0tltnmictas a ul( p (0trtrio3iotfatrln o;( s2tr(mpiudam nmneiltfaDraxmpnu4tlxnifctlt a2uluvo;(0 lenifctodomDeanvi (0tetoxm3no1openmnvtlt)artax  nt0ale  o3tyt s ea( sn(4 exrmf3oadoa   i s;s0seuoxo3oodap e nvsas a2rmxrp;u4tpxnmieiasfs rauvp;t0 exnmr3oo1oa e nesls0 2umim3oy4altn feta( artrxmoou1ole mi3iadfm2ra(vonu)aleoxo io1oatrauei (0 rxoiopou1lleemivslsfarrmu  ;u1alx  oetatlmDelumo t4altrmfciotlmteauvo;t0sexm(m3nu1altemfctlsfarrr(m ;u0oltn f3tat m2ea(mp t0treoio3tatlpt lu s s srtoiopou1lmtelfeilt a2uaxroot4tleo i3tytfm2uauvpnt0arenxoctytomtrai ilt) rumim3oy1ope lictls  rtrxr ;o4aeeo o3tatfaDraump;u4 rermf ia1oaD au s;(0s2to(o oo4lpt mfvilt  rraxrp;o4tlxo o3taslsDra( s;(4 lxoir tydfa   nvol(0 etmim oy1lme  ieiat)artau pno1altoio3tydls ean p;t4 rxnmo todlpt livi;s)tetm(m3iu1optemfvs t) rrru oou4oee  iciatlm2rmuvonu4tlerxrciadla   ues t) rtmxm3oy1alenlivs s arumxmp;o1aexnmoeildls2rl(vs;u0teenxf3tatlmDe i o t0t2xmirpiydllenmfeilt) Dtrum nu0tex iieilsfm2rau snt4trxnifcia1lp raivi s  etrxrpnudamtelfvta( aDraxrp;t4olxnmfctls s ranmpn(4tltrmf oatfaDe nvs t  etmxmpiydam  lncil()a2rmu ont4tptomfetytlsDuluvp;(0 etnmf3oytla rai ol(0s2tmirpno4ape liesat sDum(m nt0tlx io3tas m eanmo;u)arxrir3iodop r n o (0s2xoiopoodol nmics tf 2tmx  ;o1optomictytfaDrmn o;u)alxomf totfmt lueo (0 rum(mpio1lmeelfct ()sDuaxrono0aexomfctld s rmuvo (0aleoxrcoatlmteaies (0t2uoiopou4lmenmnvt tfarrm(m ;o4tptoioctls sDra(vpnu0 lxrmf oatla   ieo;s  euoim3oy4ll   ivtlsfarumxr oo4teenio3iyt a eauvo;u4tlxrxrcto1oaDeli ol(0t2xrxrpio4omee iciltfs2raump;u0tpt  fciasfm2rlnvp;u4tlxoircty1lm r ues s) rtmxrpnu1ole lietls) rumumo;t0tltn ietldlsDemumo (4trtniocia1faDeanvo t) 2xrxrpoy4ol n nvsltfarra(mono4olxo iciatfaDelnvo;t0alermr iotoatrauvil()seurim nodlmte fesl(f Dra(m nt0tpx if3iltlm2rmn o ()altoir3tytomtrlnvsls t2triopoo4ap   iesas s2uru o;t0tetnmo3tatfm ua( s;u0alxomr3tadlp r ues;s t2ur(r oo1lmtemfctas s2rru  no1aptnif3iytla rlumo u4treoxfcty1fa ean o ()seur(o3nu1omenmnet ()s2rr(mpou4tle ifeiyd sDulump u4artrxr3oa1fm rln i;()teumxmpiudaltnmfvt t artaxm ou0tpenio3iadlm2umu o t4 ltrxr3ia1op  aneo s)trtmxm3no1op elnviatfsDrmxmpnt4oet io3iydls ul(vont4aleoxr3iotlpD lnes;(  rto(r oy1lltemicta(fartmur ot0opto fctat aDemu s u0aeenif3oo1lmDraues;(0s2toxopnudome mneia(fsDrrur nt1texn i3tydfa um(vs t4 rtoxociytlpt  neo t  rtm(m3iu4op elnesat  Duaxro;u4tpt  ieildfs2ul(vpnu0tlxnio todoa  au o;(  2xm(r3ou4ole liesl(farrau ont0tpenmieildfmDuanmo;t0tleoxociadomt li il(0 2tm(m iy4al   ivsl(fsrtr(mp;u1ope  feildfa umnms;t4tltnxo3ia1lp  lieslt0t2xoxo iu4lltnlnei ()s2raur ;u1olx io3ilsfm rlnmsnt4 lxoif3ia1om elneo;t  eurxr3iu4llen ivi t sDrr(  ot4tetnmiciltls2rlu o;()trxomf3ty1omte iei;s0s2xr(mpiu4lle mnvilsf 2uaxm ou4apt ifeiydfs2ra(ms (0 rerxrcty1fpD lies t)trtrxrpiydoptnmiviat) Dtau  no4tptomfeiytlaDua( pn(0trermf3ty1oa eln i;( srur(mpnodapen nei sfsDtm(  ot1optoiictad a ea(vo;u)tltomo oo1la rln ilt0sexmir oo1omtn ivtasfaDtax  no1oee  feilsls rmn s (4alxnmo3oy1omtrli i;(0teumxo oodam  miciatf rrrurpnt1aet ifeiatfs uluvp u0trtrmr io1op rli ols0t2ur(opoydol emnei ()srurxmoou1optoiietls a ra( pnu0aexoxf3oo1faDrauvs ()setoim3iydal  lics s)sDtm( poo1tpt  ieias m eanms;t)trerif oa1fpt ln i ()srur(mpou1aleemivt s)srrmxrpno1aeto ieiatfaDea( o;u0 exnif3oodla eau o ()trtmimpoy4llee nvtat  Dtr(mp;u0tlxnifeiad mDrmnvonu4alxoircoydoa  ai s s) 2to(mpno4om  lieia(fs2umxrpno0tpen iciadfmDrlumon()teenif3tadoa e nvi (0 2toim iy4optn ivtlt  Dtmum nt0oltn octad sDeanvp u4aetoif3oy1om eaieslt  rtmxmpoo1aleeliet sf 2tm(mo;u4apx ifeilsfs uanvsnt4teenxr tytlp rli s () eto(m iydope  fesa(fsDur(mono0olen oetadfa eaumo u4tltomr to1lp  ai s (0srxrim nydal   nvt ()srur( oot1oexnii3taslm2rlnmo;()trxrmf iatomtrlivo;(0 2xm(opiudll e fetl( arurx ooo1tlxnmi3iydfmDeau s;u)trxoxf3ta1lmD anei s)t2uo(mpou1amenmivsasf Duauroou4aeeo f3iytls2elnmp;u4texrxf io1la e ivs;(0sruo(r3iu1lme mnciasfaDurur ;u1ape mo3iltfs2eaums ()treomo oatom eanes t0 2xrxmpny1ap n fcslt) 2rr(mooo4alx mo3iadla uluvpnt0tlxnio iytfaDeanes (0t2xmiopiodaptnlicsl(f Dtru o;o4tetnmfciys m uln p;t) lxomrcoy1fmt anes t0sexrxo3ny4op   ictlt  Dra(mp;u0tex mi3tltfs uluvs;t0 rxoioctodlp   n olt) rum(m3iy4olen fvs () rtrxm nu0tpeomfctldls um(vpnt4 lxnmrcoo1fpte n i;s s2uoxr3iodapenlnesasfsDra(rono1alxnmictydfa em(mpn(4 eerxr totla  lnei;t0seuoxo3oy4amee ivs tfs2ra(roou4oee iictytfsDemump;(0aetrir oatomDelies (0tetoio oy4opeelivslsfs2tmum ;u4tex mietatfsDea(msn(4aexrio3ta1fmtr n s s texrim3oy4amte fvias aDumxront1oet mfcild s uanvp u) rtnio3oy1lm elnes;s) etmxmpnydlleemfvs ( aDtrurpou1apxnmfeiasfa rmn o;u0 rxnxf tytfp rlues t0t2xo(o nu4ol  lfctat)sDtm(mo;u4aet ioeiytfa ul(mo u0aexrio iy1fat  n s s0s2urio3oo1ole  iciatfa2rrumpot4optnif3ilt a uluvp;(4aeerir oytlate n ol(0tetoio io1opeemnctlt) Dtrxrp;u4tpenifeiyslaDrm(mo;u)aeenmf oydfaDeln slt) 2tmirpiy4lm elietat)srrru o;t1tpx  f3tadfaDuan on()tltrifcoo1faD  neo;s sexmxo3no4op nlfeslsf 2rm(r ;t0altnmo3tldfa2el(mo t)treoxr tatlp e n ol( trtmxmpou1ome  net t)a2rrumonu4alxnio3iyslsDranmon(4treomr oa1la raueol(0t2toxmpnydoltnmicia(fsDtmurpnt1tlxn ietydlmDrlu p;(0areoxf to1oatrau o;(0texmim ny1lm nlnetl(faDuax p;o0olx mi3ildla uanvs;t) etoxr ty1fm rauvs;( teuoim3oy1olee fes t s2rm( pot0alxniieils a2ua( o;()texnif3tatlmD lu s;t)trurxrpiy4altnlncsa() 2raur ot1aet if3iltla2elnmont4arerxocoatom  auesl(  eurxm3ou1lpen nvs t)s2tr(mpoo4optnifeiltfs rmuvo;(0artnif3tatfpt aivo;t0 2tmxm3iy1am nlfvsls sDuax oot1ole  oeiydlaDelu p;()artrir3oadfp eaivi s)s2to(r nu1lle liei tfa2urx  ot0ole  oetyt s ra(vs;(0aetomociytfmDelu o t s2umxr3ny1lmee fesa( srurx  ;o0alx mieiys m2emuvs u4 etrmr io1oaD luvi t t2um(r3iydolenlnvi ( arra(m no0teenmo3iydfm2ua( o u4aetrir3totopD lu i s0srxoio3io4al nmfcs sfarumxrp;u4olxnmietasfsDumumo u)alxniocootfpDelivo;s)t2xrimpou4alt micsat  2trumoot0tpxnioeiytlaDea( p;t)teerif todlptrauei s0 rxrio3iy4lp n icsa( s2ta(mpno1oltoifciad m ul(vs;u) rxoxf3iatopDranvo t trur(mpiu4alt livi tf 2ua( o;o0olt iietydfm2ulums () etomrctotlmDe i s;t)t2xmio ny1op n nesat)arrm(m no0aet  ieildla um( s;t4alenxf ty1oateln s t trxoim nu1oltnmfvs t  rtr(rpno0oltniocilsfa2um(vp;(4 lerxrciatlmt lnes;s)srtrxr oydam e ieta( srtr(r no0apeoiieilslm ea(mp t)tltnxo oa1fpteluvs;t s2urir no1lpen fesas  rrm(m ou0tpe if3ias mDea( p;t)artomocoodomDelieilt) ruo(m3oy1amt  nctls sDurxmpou0alt iieilsfs rl(ms;(4 rxnmocoatomt  ieols t2xrxo nu4alen ictat s2umxmoou0opto o3iaslsDea(vpn(0tlxrxfcoatlp   nvo;t)trxmio iy1optemnvs () rumurp;t4ole mf3tydfm eln on(4tlenxfciadfmDrlues s sexr(mpoodoltnmfcs ()aDumxrp;u1tex ioeiasls uau p u0trenxf todlpDeanvo t tetrim ou1lpt mfvta(f 2trumo;o4aetomfcild s2rl( s;u4tetomr3ta1oaD aiesls tetr(o3iudape  ict ( aDrax pou4tpeo f3tyslaDem( p;t0teenxo3iatfp eanes;s)trxoio io4lm   nctas)srta(ronu1olt moetadlaDrl(vp;t4arerirctydoaDeln s;t tetr(o3ny1altnlnctat s2ta(mp;u4tex  fetadfmDulu o u4 lenio tydfa  aies;(  2urxr ny1omt  nesl()artmxmpoo4tpe mi3tldfa2rmnmp;t0 etrir oo1omDrauei t0trxmio nu1ol e fviltfsrumxmo;u1alxnmoeilsla uluvp (4aetnxo tytlmDrln ils) exr(r3iy4apen ieta( a2rmxm nt1apen feiyslaDeauvo u) exrxoctytoate nes ()s2uoim3ou1ap   nesas aDururono1olenmociyd aDrlu o;t0tlxoxo tytlpteauvs s0trurio3ny1apenmnet s artrx  no0oex ii3iatlaDeanvpnt4altrmf3iydfmt li o ( teurimpoy4al  lfvsas) rrmxr ;t0ope ifeiasls em(vsnu0 etriocia1fp  lu o ( texrxr nudalen iesl( sDta(mpnu4oeeomieiyt a2ua( o (4 rtrxf3iytomt lnvi ()texrxrpoy1lmen ivtls)aDtr(r oo4aex mfciadfm2ra(vo u4tlenxr iotfpDe nvilt)teumxrpiu1op   neil()s2trx  ;o0aee ii3iat aDuln p;t4aeerxoctotfmtrlnvsls0trur(r3iydlptemiei tf 2trumonu4tex  ieiltla elu pnu0 etrmf3todop  ln sls0 rxrio iodomeemivs (f Dum( oou4tleo oeiadfaDelnvp t4trermfcoy1op rlueo (  rtoxopiodllt mfcsas) 2taump;t0apx  ieilt sDeanvpnt)tltrxfctotomDeli o s0trtmxmpnu1aleemncsasf Dur( pnu1tee  fetldlmDrauvp t4arxnifcta1lpD  n s s0 rtmio iy4apt mnvil( sruru  nt1opt mocilsla2em( snt0alxnmr3iatlatelueo s0t2tmio3nydomen ivs tfaDtm(  ;t4oexnmf3iytls umnmo t4teeoir3tatopDe nvo;t  rumxmpiy4ome  nesa(f rtmx oot1tlxnio3iadfa emnmsnt4aetnxr3oytfpDe nvo;() etmxr3oydll  liet tfaruaxr oo0tlxoiieiydlm2umuvo ()aetomo oytoa elnvo;t setrxr3io1am nmiesl(fsDta(m nt1apen o3iltfsDua(vs (4tltnmo oo1oatelu i;t sexrirpny4lmenmfvs s  rumx p;u0tptn fcilt s2ea(vsnu4aetoifciytom e ivs t0 rumxr oo1optnmieslsfaDrr( p;t0alx  o3iytlsDrl( s u)altnxr3tatopte uei ()seurxopnudlltnlnviat)arumu o;u0aet  o3tatfm rmuvp u) lenxf tadoptranvi (  2xoir3iy4am e iet (  2ur(r ou0opxnmo3iydla2ua(von(4aexomo3tydfpD aivils) exmiopiu1lmeelfcia( srrauront1olxn ictysfa eaums u4 renxocta1op elivs;t0 2umim3iudaltemfcsa(fsDur(rpoo4apt micildfaDemn o u4alxoxf3oadlmD ln s;s)t2to(rpno1lmtelnvt ( aDraumono4tpe iiciadfsDua(mo ()texrircoadopD luei ()t2to(rpiu1lm nmncils  Draurpno0tet mi3ilsfa2ulu p u)arermo tydlm r uvi (  rtmio oodop nlivsas)aDumumooo1olt  ietydlaDrmnvsnt0arxomf3totfptrlieil()srtm(m3io4amtnliet ( s2ra(mo;o1tlx iictlt aDrmnvpnu) rxrxocty1omtr neslt t2uoirpoydame mnetlsfa2um( p;t1oetnio3iysfm2emnvont0texnxf3iadom  liei s) 2tmxr no4apen fcilsfa2rm(mooo0oltn o3tldfa2raump ()arxnxocta1om  ln i s0 rtr(opoo1lpen ncsls)a2uaxmont1altnif3tadlaDuln s;u) leoiocia1oaDraiei;t) rxm(r oudlleemfesa( aDtmump;t1apxomo3iyt sDemu pnu0 etrir ty1oa  aivol( srto(r3oy1opeemnci (fsrrr(r nu4oleo i3iltlaDul(ms;(0 ltoxf3oodla  aneols) 2to(r3io4altelivt ()sDrr( p;t0tptoiocildla2ea( p;()tetnio oodlm r uvo ( s2uo(r3ny1lm e ieslt a2uau o;t0tptnmi3iad a2ua(vp;u)aexomo iytomte nei s) ruo(o3iu4op   neilt) 2tmxmpnt1aeenmieilsfs2elnms;t4arxrxr3iydlpDe n ils0srtrir nodamee nciasfs2um( o;o1apxomiciadfa rlnmpn(4altrxr3io1fa  livs;(0t2umir3nu1am nlfeslsfa2umx onu1tex  fetytfm2uanmpnu0 rtnircoo1opDelueilt0 2xrirpno1oltnlnvt () rrmu pot1oexomo3iadfmDumu snu4artoir3tydoatr ieil()seumir3no1lle mivslt)sDumur no4opxnmi3tatfm2rl( p ()aexnxf3io1laD anvo;s0srurxr3ny1amt lncs ( srururo;o0tltoif3iat s2emnvs (0aetnmr3oatlpDr nei;(  rxmir3nu4ap  mieias)aDtrumpnu0olenmo3tydfs2ea(mont0arxoxf iadomtrai ols0sexoio3nu1ol emfvi (  ruaumpnu4oexoioeiytfsDeau s u0tltnxocoadlp rlu i (0t2uoim iy1olt mneia(fa2ururpoo0tpx  i3iad m2rl(vs;(4 etnmr3totfp raieilt s2xm(r io1lmt mfeilsf 2rr( poo4alt ioctld aDrlnvs;t4teeoif todopD lueo;( trumxm3oodopenlnvsat)srtm(ronu0altoifciyt a2rl( p;u)alerio tatlm  aueils0s2xoxm3oodamenmnet (fsDrau  ;t1oetnmieiatlmDrlu sn(4 lenmfcto1lp r i sls s2xrir3nydalenlieta(faDtmu  nu1aee iociysfaDulnvp;()trenxo oadfm rln i ( s2uoio iy1lm nmfctat) 2uaxmo;o4optnifciyt m2ranvs;t)texnxoctatla   nvi;t)sexr(opou4optn neilsfa2umxm no0apeoiiciydlm2eanvs u)tleomoctydla   uei;t) exmxr3oy4lmeeliesls s2ta(rooo0tptomoetlsls ul( o (4tlxnmf3iydlm elueo;t t2uoio3nu4apeelncsl()s2tau ont0apx mi3iatlaDrmumpn(0 rxnif tydfaDr u ils0trxm(o3nu4alt mfet tfaDua( poo0olxnmociysfa ean s t4aetoio tytoaDeliei s0 2umxm iy1lptelfes t)s2um(r nt4oee  ieiasfm2ea(mpn() reoxfcio1fmteauvo t0 eur(opoudamt lneslsf rur(ro;t0oetnmo3ils aDra( p t4tlxrmo3ia1lmDr iei s) rtmimpnu1apt mfvtl()a2ra(m ot0alxomfeildlmDulnmp;u0artoxrcio1oaDrlnes s0 2urxopoodolt livil( aDum(monu0oetnmietaslaDel(vp u4tlenmfciytla elivols)srtoxrpno1omeemnesls  Drmur nt4olx iictad a um(mp;t0 eerifcta1lmtr ivi;t)t2xo(rpnydlpenlnct sfaruaxmpnt4tleo i3tys aDrl( pn()tlxnifcoo1faDe n o;t0srur(r ou4lpt mies ()sDtr(ronu1oeeomo3iltfs umuvpn()aexoxo tytlatraueilt0 exmio oo4om  lneilt  2ur( pno4tltnmiciatlsDea(mp u0texomr tydfaDrau o s)s2xo(o3ny1lm nlieil( srurx  nu0opxo ieild mDumnvpnu)alenxfcoadlptr ies;t0trxo(o3io4lmeeliet (f Drax pno0aetnioctadfmDum( p;t) eenifcoo1opDelneils trtmio ou4lptelivil(fa2uru p;u0ape mfeilslm2um(ms (4 ltnmfcio1fa   ieils t2tmxo3no1al nlfetl( arrmxr ;o0optnmfciadlm raumsnu4 ltnioctodomDeaiei (0 2xmimpou4lp  miei tfa2uru  ou0tleomf3iydlsDea( s;()trxnif oa1fat lnvs (0t2tm(r iudom eliei s)s2um(mp;t1tle ii3iasfsDrmuvsnu0 rtnir3oatlmt lnvo;()truoio ny1llt  ies tf 2rrx pnt1tlx  ieiatfa rm( pnt0 rxoir3tytopDeanei ( srtoxo oy4am emics t)aDrr(r ;u1opto i3iatla rm( snt)trxomrcio1fateluvs;s)s2urxopio4llte fetl() Draum ot0aexn octydls2rl( s (4 lxnmf3tadoaDrlivo s  2umxopnydlmt lieils) ruaurpnu4oee iiciys aDulnmpn(4teermrcoodlm raieo;s  2to(mpoo1lp nmfcils) rraxro;u1apt iietysfs eanmon(4artoif tatopDrlu o;s  rtoxopiu1lpt  ivi (fsrtru poo0tpxoifcilsls2emuvs (0treoio3todlptr neo ( srxmimpiodlmee nctl() ruaurp;o1opt ifeiat aDuluvo;u)texrmo3iadoate ies;(0trxmio3nydap elicsl(  2ta(ro;t4opt ioetys aDulnms t4aeerxf iodop r ivi t0 euoir io1ol   ivil() Dtr(m ot4alt  f3iyt m2ra(vp;u0 exoifcio1fmD li slt)trtmir nu1ol e fvtat  rtm( o;t0aeto f3tatlmDrl(vs;t)arenir3tadoaDe ivols s2tm(mpno4amtemiet sfsDrru  ou4tpxomieiydls uluvsn(4 leomo iydfa  luvilt trtm(mpoudll emietat artaxm oo0aex mfetydla2elnms;(4aeenmrctotlmt aues;( trxm(o3oo1aptnlfcsltf Dtaumo;t0oexoio3iysfsDuan p t)texnirciadfa eaies t0t2tmxopny4am   nvia( s2ua(m ot4aexoif3ilsfa el(ms;u4tlenxr tatlptran i t)t2xmxr oydoltn fet tfs2rrumont4alenmo3iat a2rlnvs u0teenmrciy1oatrlivo (0 rxm(r3iu1llt mnct t)aDtmu pot1ope mfeiyslmDumu pnt) eerirctadfmt  nvo t0trtmio3oo4oltn icils)srtru  ou1alen oetldla2ul(mp;t)tlxrmo3oatlaD lieo;s) ruo(r3nu1ap nmieil(  rtm(r ;u0aeeoiicilt m2rl(msnt0arxnifcoydoaDeai o;s trxrxo3ny4lpt lnesl(faDtm(  no1texoiietytls rmn on(0tleoxo3tytlm  li ilt srurim iodape mnci t) 2rmxrpno4tpxnmiciat aDemn snt0aleoxr3oydla   nes t0 eto(m3io4altn icslt) 2um(mo;o0tlt  f3iasfsDrlums u0arxoif3oytomD au slt trxrxm no4ol nmnvi ()aDra(rpot4ope ifetldla ranmo ()texnmo totopDelies;t s2toim ou4altnlncia( arur( onu0tlxnmoeiys a2rluvo (4tltnxoctytfm  liei t trto(m3io1aptelfesltfs2umxmpot1olt iocilsla emnmo;t4tlenxr iatfmt  uvi ( tetoimpnodlp emncsas  Drr(rpno1olxnio3tadls eluvs;(4areomfciadlateauei t s2toio3oydame  ncs t arrm( ont0tptn oetas s elnvo;u) renxo ty1lptelnes t0t2tmxrpio1olt lnvs sfsDtrx p;o4opt ii3ildlm2rlnmsn(4trxnxf oadom rluvi ()sexmim nydale  fesas) 2um(mpou4tlxomieiydfa el(vonu4aeenxo3oodlpDran s t0s2toir3oudape mfet sf 2urumpno0ole ioetyt s ea(vs (4 ltomo3tytoaDrln il(0srxo(mpoy4amt mfesls) Dta(mpno4oetoif3iytfm rm(mpn()aeeoio todfmD  n o s0 2ur(mpiu1openlicias)a2tr(mo;u1teenmi3ils sDea(mo;u4tlxnif3tadlat luvo t)teto(o3iy1llt mnetatf rurur ou1opt ifciadfsDumn onu4aleoif3iatlaDe nei;s) rxr(r iy1al  miesa( a2tm(  nt1aexnifciydfs uaumo u4altnxr3oodop r uvo;s teuoiopiodopenmiciatfa2rrx oou1olt ioetltfm ean o;(0trxnio oydlmD anvslt srumirpiy4ame  fvi ( a2rmx o;t0tlxomfeiltlm2emnvo;() etomocoodfp  lieslt  euo(rpou4lpen feia()aruaur oo4tlxnioetat a el(vs (4 eeoxr3to1opD an i;s0seto(o io4lpenlnei s a2tax o;o4aetnif3tldfaDrl(mo u) exnifciy1oatr n s t)t2toim nodap  mnetl()sDrax o;u0ole mieildla rl(mp 
\ No newline at end of file
@@ -0,0 +1 @@
+n s (0tetoxr3iy4lp n fviasfarra(r nt0apt mocildla elnvont4 exrmrcia1om   n ils)srtm(o3iy1ol elnvslsf 2ta(m ;o4oeeomf3iatlsDel(vpnu) lerxo tatlpt ln ilt0trurimpio1lmenlnvtlsf 2taur ot1opx mfctys s2ua(vs;u4treoiocoodfa eauvi;t0 rtoxopiy1alen fcs (  rurxmpot0tet mi3iasla2el( p u4tlxrmociatoateai sl( seurxopoy4ap n ivsl()aDurxronu1oleoiocilt a2uanmo;()artriocia1fpteauvolt) ruoxr iy4ol e fesl(f 2ta(mpnt0oeeo o3iyt sDrmn ont0altoxr oatom  luvols)texo(r3oo4olee fvtltf 2ta( oou1ole if3iatlaDeanms;() lxnif3ia1late ueslt srxm(o3oudolt mnci (f 2tr(moou0alt if3ildls2elu p u0 rtrmfcoy1fa eaueolt0 etrimpiu1openmieia(faDtmxrpnu1oexo iciadfm2eau p t0tltrio3iodlm e u ilt)srtoirpio1ll  mnvs s) 2tmx  ;o1tlt ifctat a2ra(vp;t4aeenxf iadlm eanvo;(0srurio3ou1ap   iesls srur(m nt1opxomictydfm2um(ms;t4teeoxo iytfptranei;()s2um(mpou4ll nmnet t)a2uaxrpou4tltoifciatfs2el(vs;u0 lxrif oa1lmDranvo;t) 2uoimpno1apte fct t aDtm(m no4apeo icildfsDrlnmo t0 lenxr oy1lmD an ols  rumiopiu1lptn ivsl( a2uru p;t0aetnmoeildfa2ua(mo t4tetoxo todopDr nvilt  rtr(rpoudomeemnct () Dum(r oo0oetoioctas s eau p t)tlxomo oytlptr nei (0s2toirpiodap   nvtl() rur( p;o4tlenmi3iydla eln snt4treomo3tytfpDelivi s  2tm(m oo1ome  nciat)sDumumo;t1oet  i3ias a uauvpn(0trxoxfcoadfa r ueo;() exoio3nydlle liet t sDtmxm ;t4tle  f3iatlsDrm(mp u0trenir3oodop r neols seurir3nudal e fci t)s2tm(r ;t0ole  fcild m2rlumon(4 exnxr iadfmtrauvo s)setr(o3oy4ol  mnvtlt aruaum oo0ale micils a2rln s t)aeeomo oa1lmt luvo t) etmxm nodop n nctas arumx p;u0tet  f3ildlaDrmu snu)trxrir iytlpDraiesls  rur(opio1aptn fcia(fs2ua( pot4altnmfcilsla eln s ()aeenmf3iy1fa  anvol(0trumim iu4oltn ivi () Dtau o;o1tpx  fciatfmDua( s t) rxnmr3tytlp e uvi t sexoiopiydom nliesl(fsrrauro;u1ope  i3iltlaDel( pnu0 eenirctatfpte n s t0srtmxmpnu4omtemnci s) Dtax  ;u4oetomociaslm ulu p;(4arxrxo3tatfp e ivol( t2um(m oo4op  mict ()sDtaxr ;u1tpe moctydlmDranvsn(4teermf iydfp   u i;() 2xoxopnudoptemics ()sDrm( pot0opeomoeildfm2uln s;u4aeenxo oatoa  ai ilt)t2xm(rpnu4lmte fcs t  2ta(r ;u0tpxnioeiadla umnvo;u)aexrir iadfaD  ivi s0sexmim3oy1op e nvtlt aDtmumooo4openifctldla uln s (4aexnxfctydfa e n o s t2xrxmpiy1amtnlicil(f 2rmu oot1tee ii3ilslm2eau snt0aeenxrcoo1fat  uvs;(0tetrxm3iu4ol emfviat  rrmx o;u4tetnifeiasfmDrl( pn() rxnxocty1fp raneo;(0t2tmimpio4al  lfvi t)aDrm(mp;o0ope if3tld s2elu s (4 ltnxo3iydopDe i s (0tetmxrpoydom e nvtasf Drmum nt0oetniiciytfa rl(vp;t4tlxnxr3iadoa eln ols)sexr(m nudlm  lfesl( srur(moot1apt ii3tad m umu p (4 ltomr3oy1lpD  nei;( teuoxopou4lpen fvs t) rtmx onu1optnmoctltlm2umn p u0aexoxf3tydlmD  ieslt  2toxmpoy1lp nlnctasfarum(  ;t4tpeomiciysfsDelumo ()tlxnifcia1oaD livi;(  etoim nu4op  lnviasfaruru poo0tet  ocilt sDrm(vsn(4 rerxrcia1lmt li i;s s2xrimpiu1lpt mieiat sruauroou1apt  feilt m2elnvont)alermfciadoaDr ivo (  eto(r oodlm elnes (fs2raxrpou0aeeo ocilt a ul(mon(4aeermociatlmDrliei;t0t2urxr3nudame lnes sfaDuaurpou1tetn ociytfm ra( o u)trtnxr3to1fm  auvilt0trxm(r iodolee fcilt arrr(mpot4tptn feilt mDeauvonu4tltoxrciatoaDeanvo;t0s2xriopiy4op   neiltfartm( p;t1altnmfeiasfs umuvs u0trxrxf3iatoa  li i;()texr(o3io4lmtn nviasf Dumxm ;u4oet  fcildfs2uan p;u0altomo3to1lptrau sls)seurxopnodameelncslt s2tr(mooo4olx  iciydla2ranvonu)trtomo3iatomDelueo s0 2trio oy4al elnvs ()arur(m ;u4oetomoeiat s2elnmo t0texnxfciotlp  ln o;t0s2xoxm3no1oltemnvsat a2trumpnu0tpxo f3iydls2uluvo;(0 rxnifcio1oateaneilt0 rurim3iu4op nlnvi (f rta(rp;t1tltoifciat s ean p ()tltrir iy1fmDr u o t0trtoiopny4apenlics t a2urx poo4tex  oeiaslsDean pnt4teerioctadomDe u o s trtrir nu4ape livsa(fsrrru pnt0olt moeils a ean pnu0tltoxo tatla e iei;t) euoir nu4lle lncia(fsruau ooo1olx ifciltfa2emnvs ()tlxnxr3totlp rlnvs t0sexmiopio4ap n nvtas)arum(mpnu0tlxoif3ilsla2rlnmo;u4 lenioctadlaDr i i;( seumxm3iydol nmfctlt) Dumxr ;t1ape mf3tasfs ean sn(4 lxrif3iodopDeaivi;s) rtr(mpou4lle miesl()aruaxmont1teeomiciatlsDumnvonu0tetnmociatlm r uvil(0 eur(o no1ome lfesa()aDumu ooo4ole iieiatfa2emu pnu4tlxnif3oodlmtrau i s)sexmxrpou4alee nesat s2raump;t0alt  ietltfa rlums t)altoxf ia1fpDelnvils  ruo(m iu4llenmivtlt) rraurp;t1ale iieiyd a rlu p;u)aeenxf3oatoat ai olt0srumir oo1ope  nvta(  2umu  ;u0olt ii3tas m2rmnmsn(0 exnmf3oa1opD  nvolt  rxmxo ou4amtnmfesls a2ua(rp;t0ape mfciyt aDrlnvs u0tltnmocootfm rlieolt t2tmim3iodape  nct tfaDtaur ;t0aex miciydlmDrlu p;u0altnmfcio1omD luvilt)sexoim oo1optnlncsa(f Dum(m ot4tpx mo3ildlsDrm( o t4 rxnif3oydfmDeaueslt  2tm(r3nudal n nctlt arua(monu1tpt  fciysfm eanmp;u)alenxo ootfmt ai i;() rtoim nodap nmicsat)arrrx ono1oexn oetlt m2elu p t0arxrxr3oatopte n s s) 2to(o iudapenlfvtasf 2trxroou4tpxo oeiatfm2umump;u0 etoxfciatoaD  nei t)setrim ou4omen fvs sfaruax  ot1openmociyt m2ul(mp u0 exoxrcio1fp   ieo;(0trtrxm3ny4lle  icsa() Dua(ro;t1texnmfciadla2uan snu) exrxrcoatopteaneslt0s2umim oodolt micils) rrrxrpnu0tleo fctltlsDeln ont)arxrif3iytomtelnvi;t0s2ur(rpoo1lltemneiatfs2urxm ;u4apx mfciys sDumumsnu4texrxfctadop e ivo;s0sexoxmpny1apt mfvsas) Drmur oo4apxnioeiltfs2eauvs;(0teeoxr tatlmt  uvi;t truoxrpoy1olen feslt) rrmxmo;o4teenmf3iysfa ea(mont)trxoif3iydlatrlnes t)srtr(m oydlltnmfvt t) Dra( p;o0aetomoetadfm2el( p u4tleomocoa1optrluvil(  rxmxm3iu4oleemfvtl() rtau  ;t0tpt  feiasls2um( p u)arenxf oo1lpteli i;() 2uo(mpnu4lpte iviat  Dtau  ;u0tlt moetlsfa2umu onu4 rtomf3ta1fmtr u ils) rurim3oo4omtemietlt)arumumpot0tlt  f3ilsls2ul( o u0arxnxf3ty1oaD li o;t) etmxm nodlmt lfetasfs2urxroou1tlxnii3iad m2ranmon(4 rtomf todlaD an s;s setoiopoo4lltnlnes sfarur(rpnt4apt mi3iysla2em( snt0 lxnxrciydlp rlneslt teuoxopnodlltnmncta( srrmu o;o0tle mfeiltls rm( o t) ltrxf3oo1om  anvil()sexmxm nu4lpe mfci ()a2rr(m ;u4tpx mfeiyslaDea( o;u0 lenmfctatfpD  nvil( truo(mpiy1lpeelnetlsfa2uau  ;o1oexo ociadls2em(mpnu)altomr oatfm rlu ols setoxo3ou1oleelfvslt arrrurpno0tleo ocildlmDem( s;u)trxoio oytom elnvols)t2tmxm3nu1lp  livt sf rurxm oo4teeoioeiltfaDem(mo t0 leoxr todlm e ivol( s2xoxo3nu1openlncsasf Drm(  ;t1aeeoiieiatfm2rlnmo;t4 ltnxf totomtelu s t tetoim3oydame  feiasfsrtrxm ;u1optnif3ild mDum( pnt)aexrmo iatlat  uei s0s2urxo iodomenmfeta( a2um(  nt4tpxn iciasfaDem(vo t0 etnxo3ia1om ranvo;s0srtoirpno4lpt lneias) rrm(  nt4opx ifeildfa ra(vsn()alenxfctotom eluvo (  2toio3io4openlics (f 2tr(  ot4aexomiciytfa2rmnmo;t4 eenifcoatfpDeau i;s0t2to(opnu4lm elfcil() rtmxmpou4alto ociltlmDuan o t)aeenmf3todfmtraieo (0 rxrio3iy4al  lfviasfa2tru  oo1alxnifciad sDem(vo;() etomrcoatfpDran o;t)srtrio iodameemiciltfaDum(rpno1aptniiciad s2umn ont)altomf3ootfatrlnei ()t2tmiopiu1lme lfvt ( a2rmx pnt1ale ioeiyd s umuvo;() rerircoadlp e nvi s)truoiopio4omt lfvi (fsDumuro;u4ape miciadlmDrm(ms;t4tlxrir3iotoa  auesls0texoxr3iydapeelfesl() Durxroot1olt  oeiysfsDrmumsnt0tltnio3iadfmDe n s s)t2uo(mpou1optn netlsfaDtmu  nu0oee ii3tytlm em(vsnu)trtoirciy1optrlivilt0 eurim3io1al e net t  Dtaumoot1tlt io3tyslm elu snt4aeeoio io1omD anvo (  rxrxo nu4ole lfctl() rrmur nt4alxnioeiydfsDrluvs u)tlxomf oatlaDrlu sl( setm(o io4omt  neilsfa2rmxm nt0texniictys s2ua( p u4 rxomoctydfpDr uvilt0srxo(o3nydape mfcsltfs2taxronu0apto fciaslm2ulnvsnt)aeeomr ia1lmtr nvs ( s2tm(o3oy1optemieil(  2ta(  ;t1ape  i3iaslm2emu pnt)aeeoxrctytop rlu i;t) rurir iu1om nlfvs s  rtaurpnt0olxn feiadla2em( o () rtrmf3oodla  luei;t)trumxopiu4lmt  ncsasfs2raurooo0alxnmi3iyd s2uauvs u4tlxrxr3oatopDrlivo;s0trtmio3oudamt  iciasfsDumx pnu1olxniietltfs ua(monu)teerxr3iy1lm r ivols)trurxopiu1alen iei t)s2uauro;o1aeto i3iat mDemn p;t0aeeomocoadfmt li i;() 2to(o3nydomte ivi tfarrr(  nu0tpenmoeiatlm elnvs () etrxocoatfpte uvol( trxmxo3iudllt lieils)s2raxro;u1tleomoeildla emu o;(4aetoio iotfmD lnvo t0s2umxo io4apen ivsat s2umuronu4tlenio3tldfm eaumonu) etoiociatop eaiesls s2xrir3nu1ll elivta( sDuru  ou1aeeomi3ild aDra(vsnt0alenmo3oa1op rli s;t0 etrxo nu1ome  iei sfs2umx  nu4aptoiocildfm2eluvpn(0tltoirciy1lpD lnes s trumio oodomt mfct tfsrrm(rpou4ole moeiadls2umnvo u)arxoxr3oatfpD  nei;(0 etrxr3iy1olt lfvslsf ruaxmp;o1apxoii3iydfaDra(vsnu0arxoif oa1lpt  iesl( s2um(m3iy4omenmivi ()s2rr(rp;u4olxoioctydfsDrlnmp;(0arxnircoatoaDeliei s)trtrir oudlle  neil()aDraurp;t1oexn oeiyslmDrauvp;t0tetnxoctodlptrln slt0truoxm iy4olee fctas) Dtru  ;t0opeomfctaslaDeluvs;u)trermf3iydoaDe ieo s) rur(m3nu1alee fesat  rurxmpot1aleo fciadfs2umumo;()tlxnio oatlpD auvo t)s2trirpio4llee fvtls)a2rrxmp;o4tetnifeiatlmDraumonu4trenxf3todlmDean s s)sexmio io1ll  mncilt srtaumpou0oltnmietyslsDulu s;t4trenxo3tytfmt an i;s0teumxmpiy4lpenlfvtl( s2rmu  ou4apeomoeilsla eln o;t0artomf tadomDeluvs (0 rxmxr iudopeemivtat  Dur(mo;t1aetomi3iadfs2rmu s () lxrircoytfmtraneslt setoxmpio4ll e fesat) rumxmoot4oexn ictld s2rl(vsnt0 lxoxoctotfmte n s;t0 rto(r3oy1al elivia(  2tm(rpno4optn o3iat sDrmums t4texrxf3oydfm  an i ()setmxo nydopenlivi t  2tmxmo;t4tlxo oetadls em( p;t4trxomr oodfp rlu olt t2tr(opnu1ll nmictas a2rm(m ;u4oeeo fctldfa elnmsn(4aexrmr3iytoa raivo s)t2xmim3iodamee nei s sDrrumpnu0olenmoctldlm ua(vonu4tlenmrcoodlm ran i;t s2toir iodomt lics s arrax  nt1tpeniietldla2ulnms (4aetrmr3oodopDelnei;s srumim3iudamtnlfei ( a2ur(r no0aexnmietyslm ulnvs;(4trxoxoctytfaD auvil( srum(o no4lmeelicslt)srrru ont1tlen ociytfmDra(mp t)arenir oy1oatranvi;(0 etm(m3oy1al elivia(fa2umu pnt4tlto oetlsfmDuau on(0tleomr3oytfpt an sls)s2uo(m iy1lltelicslt) rrr(mpnu4olxnmi3tlslsDum(ms;t0aeenmf oy1op e neols) rtoxo iydomtnlnct ()aDurx poo0tle  o3tltfs ea( snu0 eermocoa1lmDeaueolt)sruoxm nudllt livi ( sDrrurpoo1alx mietyd s2emn s;u0 eeoxfcoytlptrlnvol()sexo(opnu1lm elfesls)sDrrxm oo4tlt mi3ildfm rm(vsnu4 lermo oadomDrlu i ( srtmxo no1amtnmfvsa(fs2umur nu1alxn i3iad a2ranmpnt0teenxr3ootlat auvils)sexm(o3ou1ap emicsa(fa2tmxmooo0olt ifctytlaDel(mo;(4aexrmf totopDr neils truoio iodomenlnviatfaDua( p;u0apeo i3tlsfm2uluvo t4trxrxocoytlp  anvo t0t2umir iudapenlivil( sruau pno4apx  octasfm rlnmp t0 lxoiociydfp   neslt)texoio io1olenmivs t srur(mp;o4tlx ifctyd sDuluvpnu)arenxr tydfm rlnvs () 2uoxm3iu4amtemfvsl( s2tmx  nu0aetnio3iydla uan p;u0artoir3oo1lpDr nvs;s)t2tr(r iodop   ietlt) 2ta(rpoo4texnmocilt sDrmump u0artrxf3oadopD  ivols)teuoiopnydale lnvil(f rumump;u0alen oetys s2rlumo;u4 lenmo3ty1fmD ai o;(  exo(m3oodom elivs s arur(mono4alt ii3ild a2eluvo;() ltrxo3oatom raivsls)tetm(r oo4ape mfcsls  Dumx ono0apenmocilsfa rm(vp (0 lxnir tadfpte ivs s) etrxopno4lmt mfet (  Durumono0opeoifctasls2rm(vpnt)aeerio3totlat  uei s0srtoir io1amtnmietlt)artmxm no4tle moeiasla2eanms u0artoxo iydfaDeliei;s)srtoxmpiydam nmnesltf 2raumont4alenmictytfa em(vp t0artoxo3oatfpDe uvsl( teuoio3nydop elfet (  Dtmxrp;u0alt ifeiasfaDemums (4tetrircto1fa e u slt seuo(r3iy4oltemnvtlsf 2urumpnt0tlto o3ilsfs2ul(msnu4tlxomr oodlmDrln s t0 2umim nu1lptnlicsl()arur( p;t0tpen o3tyd s raump;t4teerxf iadfpte i s;s)trxo(opnu1ole mfvi tfa2taxro;t1apt mfeiysfs2emuvp u) rtriocia1oa elneil()trxo(opou4opt miei sfsDtrumoot4aexn o3tadfm rmnvs;u)teenio ootlaD  nei;t t2xoio ou4olt lici tfarrrxmooo4opxn feildfmDelu o;t) rtnmrcoytfm elivo t)srxrir3oodlp nlieias) Dtr(mo;o4tpe mf3iyt m2ua(mon(0aleomr3iodoaDelneil() 2uoim3io4am  mfciasfs2trxmp;o0aeenio3ildls uau p;()texrio3oadlaDraneilt)srumio oodlptnlivsat a2rm( p;o4opxn f3iatlmDuanmp t4 renxfcta1fa   iesl() etr(mpio4ale  iet (fa2ua( pot4opt iociyd m ulnmp;u4aetoifcio1fp  auei;t)texoio3iydamtn ivsl(  rrmur nt1tex  o3iytla2rmnvp;() rtnmf oo1omDeaiei (0t2uoxr iy1ap nlncsls)srrmu onu0alx ioctlsfaDum(vs;t) eermr3to1oatrau i s0s2xmxr3oydom n fcs (fsDta(mp;o0tpenmietldfmDrmnvo t4 ltnio3todlp  aues s s2xo(opoy1aleemfeilsfsrumur nu0aeeomociyt m rlu o u)tetnmf oatfpDrlneil() 2xmirpnydoleelfcilsf rtrurpou4apxomoeils s2eluvo;u4 etrxf io1optrauvil( setr(m ny1lpenlfci t)sDrrxr ;u0olx  i3iat s2ulumpnt0 rxniocootlatelivils  ruo(m ny4lm  lfvsl( srraxmp;t4aeenmo3iltfsDrlump;t4texrmrciodlatr neo;(0seto(mpou4altnlfvtlt)s2ur(m no1oee  fcils aDuluvp (4alxoio3iodoatr ivo (  rtmimpnu1ale licslt)arur(rpnt4opxnmiciytfs umu pnt)tetomr3ta1lp rlu i;s s2ur(mpnudam n fviatfa2ta(m oo0oeeoiociadls2emums (4aexnif3oadlp   i o;t srtmxr3nydol emivil(  rurur nu1apt ifeild m2umnmonu0trxnmf ootlpDraivslt0t2toim no4ll  mnvtl(faruauro;o4oeen fetld sDel(mo;u0areoir3oatlpDr uvols) rtrxo io1lle  netasfa2umu pno4aeto iciasls2elnmpnt0teenif3oytoa rlu il() exo(r3nu1olt lfvtl( artrur ot1alxnmo3ild a2emnmo u)tlerir3iy1oa  ln s s) 2xoio3oydomtemneta(f 2ua(rpot1tptnif3tldfsDuan snt4areoio3totop   nes t)s2toir3oodlmtnlivsas a2rmxr ;o4aleoifeildlmDul(vs;u4teenif3oodlm rlneo ()t2uriopiu4amtnlfci s artmu pou4apt  ieiltls eln o u4 rtrmf oo1laD li o s texoiopoodll nmicslt)s2tm(mpoo1ape iocils sDua( ont4tlxnmfcoydop r n i t  2trim3ou4ll n iciltfsDrm(mp;u0oex mi3tlsfmDulnms;t0aeerxf3ootoaD ln i (  exoxr3nydape mfvia(fartm(moou1alto oetydls rmnvonu) eenif todlmDelnvo s sexm(opny1amee neiat a2um(rp;t1teeomfetldlaDem(von(0 exrircoodlm rli s;t0 2tmxr3iu1omt liet t srtm(r nu0altn ictatlm2ua(mo;(4trerxrctotlpD luvi s  2toxmpou1lp  lfesl() Duax  ot0teeoioetltlm uln on(0tleoxocoytlp raiei (0 2xrir iydomtelnesat srtrxm ;o1tee ioetlsfm2ua( snt4aeeoxfctodfptrauvol(  rum(m nu4al e iesl(f rum(m ou1opeoii3ilslaDrmu p;()trxrxrctatlmDe ieslt) eum(m ou1alt  fvsa(  rraumooo4tptnio3ilt aDeluvp;u0 lxnio oadop ran i;s)sexr(o3iudlm e ivs ()aDta(roou0tpxomfeilsfa uan p (0tleoif3iodfa rlnvols)srto(r ny4ll nmnvsas  rrrumoou0oex  i3iltlmDulnvo;u4 eeoif iy1op e i o s0trxrxmpiodamt  ivs s)a2uru oou0opxoifeiltfa2umn o;t0aetrif oodoa e u s;s  2tmio3nodale lfesa(fartrump;t0opt ifciadls rlnmp;t)tlxnxo3oatlm   nes;t  ruo(m ou4lmee ieslt)sDrr(r no0tleoifctydla rm(vpnu4tetrmo3iotopt li o t0texmimpoy1lmt mietl() 2tr(  ;u1ale  oetadls2rluvo (0 exrmr oadlm  lnvi;()trxrio nu1lm emneia() 2ur(ro;t1alx mi3iyd a2em(vp;(4 rerircoodoaDrlivilt  2xriopoodaptn nctlt)s2rr( o;o1apeniietyslm2ul(vs;u) leoxr oydlpDr ivsl(0seurir nodapen ivsas s2trxmpnu4tlen o3ild a ulnmp u) rtoio3oytfaD auei s)trumiopoy1lmtnmieta(f 2uaxrpno4teenmietltfa2rl(vp;u4aetoif oytlm  lnei t0tetr(opiodllen ivtat) Dra( p;t1tptoifetyd s2ea(mo;t) leoifciytom  aieol( s2toxm3nu4op nmfvta( srtmurpnu0oex mo3iat a2rau o ()teerir3tydfmD luvi;t) 2trxrpou4alee fetat  2urxm oo0tpxnioetatfs rmn p;u4tlerir oodopDelieo s0trtmio3iudapt  iviatf 2ta(r ou4aleniociasls2rlump t0 lermociytopDr ies;(  rtoxo3nydam nlfesat)srtm(m no4alxo icilsfaDul( p u4 rtrxo tydfpDrai ilt0texmimpiy4lp nmnetls  Dtrum nt4opx  ociad a2eluvs () etnmrciytlaDrln s;(0srumim3iu1ole  iviltfarrmump;o1aexo oeiatfmDrmuvsn()trermf io1omD  ueslt0s2ur(m3no4ap elfeslt) rrmum ;o1aet iietytfm2emn on()tleoxr3ia1laDe uvi;()t2tmim3iu1olte ieiatfs2umum nt4apenii3iltlm2umnvp u4alxniocoy1lmDran ilt  exrxmpiy4am  lfes s arumu  ;u4oleo octad a el(msn(4trtrxf totoateln ol( t2trxm3ou1ameemnvsls)arrru p;t1apx  fetatfm2eanmp;u0 ltoifciy1lpD an o;(0t2uoirpiy4opeemfeia(fa2rr(mont0ole  fetatfs uanvo u)tltrifcoytlmDeaneolt)tetmxm3nodomtelfeil(fsrurumpno4oetoii3iatlsDelnmsn()tlerircio1optr n i;s sexmirpiu4ope lnvtl(f Dtaur ;o4opxnmociyt aDuluvont)artomr totlpt  iei;(0srxrirpiy4alt mnviat)arua(r ot1tex iocils s2rl(mp t4tlxomo oytlpte n s ()t2xoxopoo1ap nlfcia()aDtax pot4tpe mo3iltls rmnmsnt)aexrxfctotopt  neilt0t2tm(o oy1alenlictlsf Dtaumo;o4teeomf3ildlm uaumon() rtnxf io1lptean s;t)t2tr(r oy1lptelfetasfaDrrx  ou0aeeoioeiyd sDem( snu)aexoifctodfaD lu s;s srxmimpnudam e ieslt) Duaxmp;o1tltomfeiaslmDem(vs;(4 ltnmrcoo1late iei ( sexmxo3nudapeelfct s)srrrur nu0opxn o3ilsfsDrl(mo u4tetrmr3ta1fmD ln o s) rxm(m3nudamtnmfvt sfs2ta(  ;u4aptnioctlslm em(ms u4aexoxo3tydfptrlieo;s0srtr(o oo4ll   nct s a2ra( o;u4tpxo oetad s2umnvpnt4tlenxf oy1omDran i;s)trtmim nu4aptemict s s2umurp;u0tltn i3iydfm2emnmpn(0aexomf3ia1fa eau o s)tetmir no4ap   fvt t aDra(rpno0texomo3tlsfa2ean p t)teeoxf oydlaDrliei ()s2ur(r3oydomtnlieta() rtaumooo1tlt iicils s2elumo u4aexrxr3iydlpD livols)sexm(mpiodop e iesls  Dtm( pnt0tetn ociasfm uan pn()teeoir iodopD  ivi t) eto(r iu4lpen feta(  rtmxmo;o0opx ioetatfs2umn s;t)aexoirciy1fpDe ivo t)s2xrxo no1alenmnesat)sDtauroou1altnmi3tld s2ul(vsn(0 ltoxo3tydfmDeanvsl(  eumio nydopt lfeslt arum(  ;o1aex  feiatla2uan snu4arxnmfcoodfmtr u o;s)t2toxrpou4oleelfvi (fsDraumpno0olxnioeilsfs rmn p u4aetrir ootoptelu o;t) 2umim3oodalte fcs ( s2rrxr ;t0tetn fetat mDran pn() lxnxocio1laDe ues;t)s2xmio3oy1lp emnvtls  2tm( ooo4olxo ocildfa ranvonu4 etnxo3tadfmtelu o s srumir oy1open fcilsf Dur( pou1tpxnmoeilt sDeluvs t4tltrio3oodfaDrauvi s0 rum(r3nydop emfci s srtrur ;t4oexnmi3ildlm um(monu0 rxomo to1fm  auvs s)t2urxr nudop  lnetl()s2raxr ot4alt mf3iatfaDrau snu4aetnirciodfptrai ils0trur(mpny1ll   fct (f rrm( poo4apxo iciadfa2ua(mp (4 eenmrcoa1fpDeauvsl( t2toxrpoydomen ivi s) rur( poo0apxnifctyt s ulu pn()areoircto1lmtrau s;() ruoir iu4op nmnei (fs2raxmpot4opxniictatls2ulnmo;()arermr todla rluvsls0trxoim3oy1opt licia(f Dtmumpnt0tex moetatfm2rlums;u) leoir3iytfa raivi;s setmir nu1am nmnctat) Dum(  ou1tlt  oeils mDum( s;(4alenmfcoo1fa e uvi ()t2ur(rpiudlmtn feias  2ur(m ;o4ole ifeiasls2eln sn(0 etoif3iodoaDeai s s  2ur(r3iudllt  nvta()arrrump;u1tpen fcildla2el(mp;t0texrir3tadomDeluvol( sruoirpoo4ape mfes t) Drrumpou0tlxn f3iadls eluvpnu0trtoio3ia1fatr i ol()texm(r3iy1opeelnetatfa2umxr ou4alenmfciad m2rm(vs t4tltnmr3iytlpteaies;s0 ruoxo3nudap n ics sfaDtrumpno1oetniiciyd aDrauvpnt4trtnxociadopDe ivi t trxo(m io1aptelnesls)a2tmxmpoo4oee ii3tatls ea(vs u4 eeniociydlateln s t trtmxo oodapenmnei t arrr(root4tlxoiictasls2ranmsn(0altomo tadfa elieo ()s2trxrpnu1llt lfvtlt  rrm(m oo0texoiocilsls umnmsnt)aeeoxr iodop rai o s0trxmxo3nudopt  fvilt)sDrrur oo4apxoio3iydls rau p;(0 eerxr totfpte i i;t t2urxo iy4lptelnct sfsDrmxrpno1aleomfcild sDeaump (4 rxrmf oytoaDraueo;s0 rxrir3nodopeemivi ( a2ra(rpot4tpxo i3tldfs2uanvs ()trtomr3oatlmteaiei t setrxm3iu1om  licslsfarrrx pno0opxniiciysla2ulu p;() lxrif iadlm elnes t s2tr(rpoodoptn ncias) rtmx p;t0aleomi3ildlm2rlu p (0 ltrxo oa1fmD  nesls s2xoxm3oo1amt  iesl(fa2rr( pou1opt ifciatfa rlnvo t4aexnxocoo1fm e ueil()sruoirpnu1lltemictat artm(mpou1tltnioctad mDeaumont4alxoxo oydfptelneil( sruoir ou4op n iesat aDtaumpou4tlxomi3tysfs elu p u0trxnmf oadoat  ues t srxmxr oo4lltn ivt s sDumx ooo0oet  fetlsls raumonu) ltnifcio1la rluvi t) eumxopnudom  mnvtlsfsDrmumpnt4optnifeiadls ranvont4texrif3iydomDe n i;s teurimpoudoptn ivtlsfaDraxrp;o4teenmf3iad m ranmont0treoir3oo1lmtrluvo t)s2xr(m no4apee nci (  2ua( o;o4alxniiciatfs ulnvont) rtrxo3oy1fmt aivo s0t2toio3ny1op elics sfs2rrumo;u1opt  feiydla rl(mp;t0 reoxfcto1lp eln s s  2xoim io1openmnvta(f 2rrxroou4oleomo3iad a ua(vo u0 etrir iy1lmD anei t) 2xmimpiydlp nlfctls)s2uax poo1tlxomictyd m rmnvp u0tlxoif oo1fmDr ueo s)tetm(m3iodoltnmfct t arrrxm ot1oeenii3iasfs2rlumo t)arenxocoadfm elu o t)seuoxm oo1lmtelivs t)a2raur ;t1oeeoiociltfm ulnmo;u4trtnir3ia1omt lieil(0srurxr3nu4optelfeia(  Dum(m ;o1apt mfeiasfsDumnmpnu0 etoxf3tatopDrlu slt0sexoxrpiu4alee ivtl() 2taxmoou1apto o3ias s eluvo;t)texoir3oa1oaDe u s t)trxoxr iy4apt mfviatf rurum ot1aeen f3ildls2rlnmo;t) rxoiocootlm r uvi ( t2xmxr3iydoleelneia()aDtr(r ;o0olto f3tydfa el( ont4trermo3oatfp rlieo s  2xm(opnu1ll elnvtltf rum(m ot1tpeomfciltlm2rmnms;u)trtnxr3oa1oa  aneo;s0trtoxo3iydape  ncilt)arur(mpoo0tlxoifctld s2um( s;u0 rtnxf3tytoptrluvsls0 rxrxr oy4lmtemfvsat)sDrm(roou1ape  i3ils s rlnmo;t4tlenio3iydoa eanesls) etmim3io1lmte nci (  Dum(r ;u0aetnifctys aDem(mpn(0arenmf3oytfmD  ivi s) 2urxm3no4amt  feslt)s2trxm no4apenmfciat mDel( p;(4treoio3oydopDrau sls) rtoxmpoudopeemfetlt  Dtr( p;t0tet  iciysla2el(vs;()aeeoxr iadfmt luvs;() exoio3nu1lpeemieiatfs2raumpoo1olx  o3ias a ua( o t4aetnxo3tytlateli o;s)s2uoirpiudam elfcs t  Drrxmont4tleo o3ils m rlu o;u0tlxnio3tydlaDean o;s) euoir3ou1op e netatfsDrmxm nt1aex mf3tasfm ul(vo;u0 lxrxr oadfaD anvs;s0 rtrxopio1ale lfvtasfs2rr(m oo4alto fetysla emnvp u4 lerio to1la  luvsls) 2uoirpno4amt  neta()aDtmxm ot0oetn i3iltla2um(vs;(4aexnmr3tadfpteai i (0trtm(mpoodomtelfet (f rtmxmp;o0apt micilt a umnmsn(4alxomf3oo1omtrli i s trtrxo iy4al  lict tf Drru pno1aeen o3tysfs2em( p t0tetoxf oadlate ueo;t s2tr(r3io4apt  fvil()s2rmxrp;u4altnmoetlt m rln on(0alxnxo3oadfaD  u s ( s2uoxm nu1lm  lnvslt) rum(ro;u0oexoiieiadla uan onu4 ltrmf io1fm ean s;t seuoxo nu1aleemivs s)srtaxmo;t0tpt iictas aDrm( s t4arxoifctotfptraues ()trxrir3oo1lmenmivs (f rtaxm ;u4tpeomictltfaDemuvp ()alxoxo iytlpt li o t0seur(o3oudlmeemivia(fsrrm(mp;t4apeomo3tyt a2rlnvsn(0altoxocoodlm e uvi;s seuo(r3iy1omeeliet tfarurx p;u4ole  f3tad sDemuvp;u4aexoio3oydfa   nvi t sexm(rpiy4lptelies t  2rm(mo;o0aeen f3iydla ranvp (0trxrxr to1fpteaiei;t)trtmir oydal   iesas srurxm ot1teeoiociasfm2umuvp;(4trtoif ta1lp eauei;t trxmio no1ale liei sf Dra(  ou0olx io3iydfmDuanvo u0alxnxf oatom e i o t seurimpiy4ope livsltf rur(r nu1alx iieilt sDea(vpnt4 rxrio3oodlateai slt) 2uoir no1olen iesa()s2ra( ooo0tet mo3ias m em(ms (0 reoxr3oodop  luvi;t trum(rpnudale lfeiasfsrtmx  ;o4optnmociltfa umumpn(0arenio3oy1omtr u sls)sexoxrpiy4ll nmfei s  Dumum nu4tetnifciysfmDulnms t4 eerif3tytoptelnei t t2xo(mpnodlm  lnct sfa2tm(m ;o0aee  i3iasfaDrl(vo t0altomo iatfat luvi ()s2trir nydlpt  ici tf rumumpno4tetoii3iydfmDeau s;(0texnmf iatfmD  i o t srurxo3iydlmenlivtatfs2umxronu0tlt  f3iltla rm(ms (4 etnmfcoa1fmDelivi t0t2uoxrpiy1llt lncilsf rtr( poo0aexomfetatlaDrmums t)teerir3iydfm   i sls0s2umxopnydolt mnetat)srumx poo4oexnifeils m2ua(vs;(0artnmo iatfmt  n sl() rur(r nu1lp emfet t) rumxmpoo0ape mociatls ea(vs t)aeenxociadla elivols0t2trxr3oydop  mnvsl( arumu pnu4teeo oeiat m2rln pnu4trenxrciytom elnvs t0s2toxr3iodamtn ivs ()arumumpoo0oltomietlslaDra(mo t0texnxrctotopt  u sl(0s2umir oy4optnlivs sfsDtmu pnt4oleoifciys mDuanvpn(0altnxrcoatopDr neils0seum(r oudoltelnetasf 2ua(m ;o1oeto feiysfs ra( o;t)trtnxfcoo1fpDelueolt  ruoimpiu4ap nlnci (  2tauroou1optniieilsfm2rlums;()texnmfctatoa   ueo t0s2toio nydllte fvs (fa2ra(rpoo4tlxo i3ildla2uln o u4trxomfctotfateaneolt trtmio3nydlptelfvi ( s2um( o;u1tpx ifctyd s2rlump u4teenmfcty1lp r n il( texm(rpiy1amen ncias sruaxr oo1olxoiiciltlmDeanmpn(4treomo ta1fm r ieo;s  ruo(m3iu4ol nmfct t  ruax o;u1alto f3tys a2ulnmpnu)alenif3ty1fmte u o;()tetmxopnu1ape mivtat)srrmur ;o0oetn oetadfsDel(mp t)arxnmf oy1lptelivo;s  2ur(rpno1lptelfvtas) rum(mooo0oex io3ils s uluvp u) exnxf3iydfm   nei;s)t2xrir ny4lmenlfes t  Drrump;u4oex if3ild m rlu o;(0 rermo3totom  lnes t)texoxo ou1omeelfct s  2rrx oou1tlt ii3tysfmDrlnvsnt)aetrio tatfmt  n s;t  ruo(r oy4optnmies tfaDrrx  no1oltn ictlsfs eln s;t4artnmrcty1lpD an o;t0srtm(o oudlp  mivil( sDrr(r ;o4tpenmoctad s um(ms (4 ltnmr iotoptr neo;()s2xrxo nu1opte ncsasfs2uru  nt0aexo ocild sDrau o t4 rxnif oatom r uvils)t2tmxm oy4ome  fci (fsrtaumonu0oetnmfeiydfs2umn snu0tetrmr3ootla rlnvs t0texm(r ou4aptnlneslt srtrxm oo1optnmietytlm2ra(mon(4 ltomr3oatfmtr ieol(  ruo(opiu4lmtelneils artr(ronu0aetnmoctld m eln s u4trtnmr3iatfmDeln s;s tetrim3oodaltn fet s) Drrxmpnt0aeeomfciydfm rm(ms;u4 ltoxf oytfat li o s  2uoim nydopeelicsltfsrrr( oot1tltniicildla emn ont4teenxr3oytomD  nei;t)t2xo(o ny1ome mnvtas sruru oot1tptnmfciydlm rm(mo u) ltrmfctytopDr u o;t s2urir3io4apeelfvtltfsrrm( oou1oex moeiydfm2ulnvont0trxoir oo1fat aneilt s2xr(o no4al nmnct (farua(root1alt if3iysfm ulnvo;()altrxo3to1oa eauvsls t2tm(r3ny1aptnlnei s  rtm(ro;o1olxoifetlsfa ra(mp t)tltnmr3oytfa  aiei () exrxo oo4omt lfcsls) Drr(mp;o4tee ii3tad m2ean p;t4trxoifctydla  livo;s0s2xmxm oo1al elfct t)a2trur oo4alx mf3tys aDulums;u)aeeoif tydla r nesls srumxm iydlme  ieils)sDrrump;o4olxn ociyd m emuvp u) lxomrciydfaDeai s;(  2xr(m ny1lmeemnvsat sDrru ont4opx  ieiad s ul(vo;(0aeeomocta1fat  uei;s)srxmir nydll  lnei ()aDum( pou0tpe  ictysla ran o;t4 rerir3iadfa   uvilt) 2xo(rpio4lp emfviat)s2tr(m ;o4olxoifctydlmDemuvsnu4texoio3iodlm rauvsl() exmxo3iy1ll nmfcia() rtrx ooo0oetoiietldlaDemuvsnu)texrmrcia1lpD livolt texm(m nudll  mivil()srrmu ont1tpxo octatla emnvsn(0 leoir oy1fmtelnvi;(0 2tmxopno4ale  icsas)sDtax  ;u0apenif3tasfa raumo t4 reomf3tydlmte nes t)t2tm(o3no4amt  icsas arur(mpoo0tle  fctldfa elnvp;(0trxomf tadlaD an i;s)t2ur(m io1ll e fesa(  Dtrxroou1opt iieils m emumo;(0tlxnmf3iadoaD luvi;s)s2xmirpou4ame mnci sfsrurxmpou0tlxoiociadfmDranms;t0 rxomocia1laDelneo s0 2xm(o oudale  fvsat srurumpno1aleomi3iyd s2rlnvonu0alxomr iodlm  lu ilt sruo(opnudapt  nvsat)srua(m ou1tptn icilsfm2rlu ont0 lxoxf3ta1laDr neslt s2xr(m3iu1lptemfcs s sDtrur ot1altoifciyt mDea(mo u)tlerir tydlmD  ivsls t2xrim3oodam   ivta()arrrur nt0aexn f3tysfm2rl( s;(4areoio tadopD  i s (0truoxm iu4apte icias arrrxr nt0oltn ictytfm2ua( snt4tlerxo ootoaDean s s trto(m ou4ale lncias sruax p;o0apt iieilsfaDrln pnu4altnxr tatfat ai i;t0trumir oo4lmenlfviatfa2ta(mooo4texnmfciyslmDrmums;u4arxrmf ty1fa r n s;s) ruoxr3nudal n nvi (f 2umxmpoo4oexoifctyt a2um(vsnu4 ltrir3oatlatrauvs;s sruoiopoydlpe mnesas srua(r ot0aee io3iyslm2umumpn()artnif3oo1fmt aiei;(0setr(r no4op n nei (f Dtr(mp;o0opxnmicilslm rmnvsnu0trxrioctotla r ivslt0trtoxm3nudolenmnvslsf Dururont0tleo ieils m rlumo;(4tltoio3oatfmDrli o t) rto(r oy4omtelnei () Dtrx pno0tpt  o3iysfsDemuvonu)trerxo3oytfm rluvi (  2uoxm iodal   fet tfarra(monu1oex ifeias a2elu p t)texoirctatomt  nvo t)setoimpoy4ope mfet t sDtmump;u0aex iiciyd m rlnmo;u)tetoxrctotfa rlies s trtr(o3ou1apte ivtlt srtr( oot4opt miciadlmDrln p (0altomr3oatfmt  u ils)t2xrxopiu4am elivils  rrmur nt1tpeomociytfs2rmu ont) rxniociotopD  ieslt0texm(m3nodlmte fcils  rta(ro;o1oet io3tadlmDemn s;t4artoif tytom elnvolt s2ur(opoodapenmiesa()srrmumo;t0alt  ictls m uau p;u4 lenxocoadoptrln s;s0sexmir iy1alt livilt)srrax poo0opxoioeiad sDranmp t4 lenmf3oodlatraieo ()t2ur(o oydamt mnvs tf rrau pnu4opx moctasfa2ea(von()arxoxrciy1fmDraies;t t2xmxmpiy1lp elivsls artmu oot1oee iociat mDuaump t4 lermocoadoate iei;()t2xmirpiy1lmenmfcil(f rrm( onu0aeeomociltfs2rlumpn(0tlerxf iydfptr nvilt t2tmxo io4aleelict t)a2ra(mo;o4tpe iiciysfs rau o u0tlenif todfmDran sl(0sexmxr3oudop  mnvtlt  2tmx o;t4oltniociytfa eauvsnu)aeenmr3oo1fp  lneo;t)srumxr iodam nmfvs ()sDrmx pou0olxnioeilslm uaums u4teeoir iadoa r neil() eumio iy4oleemfes s  Drrxro;o0teeoio3ias aDuau o;(0trenxr3iy1oate nvs s0t2xrxr3iu1apt lietat  rumur ou1opx ifetadlmDua(vo t)teenxr tydoa  aies;s  rxm(opiy1olen net tf Drm(rp;u4tex ifeiyd s2eaums;t) exrxrcto1opt lu sl() exr(opoo1oleemneia(f rraxr nu1tlt  f3iytfaDeau s;t) rtnmf3iydfmD  i i;t) 2ur(rpio1al  lfci (f Drmxmp;o0open iciytls2ranvp t0 etnmf oodlm e u ils)srxoxm3io1am   ivta( arurxrp;u0aetnif3tlt aDea( pnt) leoxrctytoat  i o ()trumxo io1olenmnvtat  rtm( p;u1ole ioeiys a2emn s u0aexnxoctodlmDeauvs;s)t2uoio3no1olt  feta( srtaxmp;t0oltnmi3tadfmDrmnvp u0 lerxocoydlatrlu i t  2xo(r oy4aleelivils)srrax  nu4tetnio3ilsfm rmn s;u)trtrmr3iotfa rlnei s0trurirpnydomt  fcs tfs2rmur nt0alx mi3iltla rl(vsnu0teenxo3iatfmDr ieslt  rxo(opoo4om elfesl() 2um(mp;u1tpen fctls aDul( o t4 rtoxr totlptrlivi ( truoxo oudam nmics (  rtr(rp;u1aee mi3tls s rmump u4aeermfcoatoa eaivo;t) exoio iydalee net s)srtmxm nt4aptnmfctlsfs umuvo;(0 rxnxr3totfptelu i;( truoim iodal e neilsf 2ta(  ;u1opt  i3tysfm2um(mp t0tltrxrctytfatrlu s t)s2umio nudap e nvtl() Dtr( p;t0oetn ociyt m2ua(ms ()aexnif oo1oaD  ues;s)s2urxo3iy1ome mnvi (  2rru  oo4ope ioeiyt aDua(vpn()tetoir3iodlmDeluvo;s texr(r3iu4om nmfciat) rtm( poo0aeeo ietydls2ean o ()trenio ootlpte n sls)trxoimpoydlp e nvia(fsrur( p;o1olxoiictatlaDuaums u)trerxr3oatla r nvsl( srtrio3oydlmtelivsltf 2ta(m oo4tle  feiyd m el(msnu0trenxf iatfm  lnei;t0 2toio ny4oltelfct s) rtru p;t1oeeoifeildfsDrm( s t0 exnxf3oo1fmDeli sl(0teto(opiodam e fcs sfsDta(rono1altnmiciydfm2rl(vo;()tlxnmf oa1lm e ueo t0seur(mpiu1ale licilsfarra(rpnt0alxo octydla2emu p;(4 etoxo ootlmtrauei t)sexrio iy1apeemneils s2rrumono0oetomfeild m ua(mp t)treoio3io1fat lieo t0t2tmxo nu1alt lnes t) rurxr ;u1oeeoiociys s2rmuvsnu4arenxo iydopteluesls0teuoim3iu1lp nlfei sfaDurx o;o1openifcildfa rmnvs (4 leomfcoytoaDr uvsl() 2umxr nydll  miet tf Durx ono1tlenmictyd s um( p;t)texnxo oytfa   uvo;t0 2trir nu4olt lfctatfa2urxmont0aex mfeilsls2el( o;t4teenircto1lp r uvi () rtoxo3no4oltnmiciltfaDta(r ot4oleo ictatla rmumon(4tetnmrciadlaD  ivslt t2xoio nudaltemnvtls  rumxr ou1tlx miciatlm2emuvs;t4aleomocoytfaDelu s;s t2uriopno4lmtnmfvtasfa2tmu  ;t1opt mfcils sDra(monu4trxnxf ia1la eaies;s0 rxm(mpnydoleemicsltf 2uauront1apxomiciysla eau o;(0 exrmf iytlptrlues t0t2xmimpno1lltn iet tf 2urx  ou4texnmfctas aDeau o (4texoif3iydfmD auvol() exoxr3ny1amee fet ( s2uaxm ;u4tee ioctytfa2ea( sn(0tltrxrctytfa rlueo s0 rxoxrpno1alee ncia() rrrxrpou0opxoioeilsfs rau p (0 ltrmr oytfate nes t)t2trxm3oo1lp emnei ( srrm(mo;u0opt moeiatfaDrmumo;t4aexomfcootom r uvilt0s2xrxmpoy1lmtn fviatfa2rmumpnt0alto o3ildlaDum( snu4aetrmrcootop eaueilt0 2umio3no4amtnlnetl()sDra(r ou4tpto i3iyslm2ranmo u4 renmr3iadfm  lneo;(0srxoxm3io4omen nvt (f Dumum ;u1ole  fctas aDrmn o u0tltnmrctytopt  ivo s)teumio3no1lptn iesatfaDum(rpnu1tpx  fciltla2ea(vp ()alxomo iotfm   u olt0srtoimpnudape mfviatfarrm(  no1tpe mf3ils aDean p;()areoircty1op  lueil(0 2tmiopiu1ale livs s)aDur(mpno0tpx mieiadls ranms t0tetoio3iy1fmDrli o;()trtm(opny4lme lnct ( aDrrurpoo1tex iietytfa rmumpnt)arxnxr3iytfptelu o t)tetm(r iydomenlncsat)s2rr( ono0aptoif3ild a umums t4teeomo3to1lmD lueil() exrxr oydom nmivsl()aDumxrpnu1tpx  i3iytls uauvp u0 rerxrctatfmtelueo s) etr(m oodlptn fet s  Drmx  ou4oex ii3ias mDrmnvpnt0 etrmo3iadoat  neo;t) rur(r nu4ape  fctas)aDurum no0oexo ociydlmDrm( o u0areoirciadfp   ueo t)teuoxmpoydamtnmfvtat) 2ra( pno0ope  iciltla uauvp;u4 rtomo3io1op e i i;t)t2tmio3nu4op nlnci (f rrrx o;o0tle  ieiltfs2ea( pnu4trerxf3tytlmDe ueils trtmxrpoydll  lfesls)aDraxroou0oex mf3tyt a2ea( o;(0 rxoxo3tytopteaiesls0seuoxopoy4omeemfeias srrmxmo;o4apt mieiytlm emump u0artnmf3iydlatrlivo;s)t2tm(m ny4ole  ieil()sDumum ;u0ope io3tad s2eln o;t)trxrxo oodomDelivs s)srurir3oudlmenmfctatf rtrx poo1oetomi3iytla2elumo;t0aleoxf3tytfp elueilt0trxrxmpny4ole lietl(fs2tauroou0optomociysfs2rm(mp;()tlxoifcto1om rlieo;( tetoxr3no1lmt licsasfa2rmu pno0altnif3ildla2umums u0teeoifcoydlm e iei (  2uoxopoydomtelivsl(  2um( ono1opeomf3iysfa2ulu onu0arxnif oydopD aieslt0s2uoiopno1om  mfcsls)artru pnu1tle ii3tadfs2uanvsn(4 rtrio tydfpt au ols0texmxm ou4om e nvsat s2rrxro;u1oet ioetatfa2elu p;t4texnmf3oadfpDr n o;() etoirpoy4lltelnvs s a2tr(r ;t1tet mi3tasla2ranvs (4trtnir3ta1opt livo s)texm(mpnu4opeemics (fsruru pou0opt moeiydfs2um(ms;u0tltomf todoat ln s t sexo(r io4optnmivtl(  Dtr(  ;t1tleoioeiadfaDrm(mpnu)trtoif3oytopteaieo s trurxm3nudal  lnesat)srur(mo;o0tex mf3iasfm2rl(vp;u0alxrir oodlm  luei;t setr(r iy1ol  livils s2tau  ;o0ale  oeiadfs ranvp u)artnxr tytop eaies;()setoxopoo4lmte ivt () Drm(roou4tlxnmo3tyd m2rmu s;u) leoirciytfpt  nvi (0 etr(rpny1openlicilsfsDurumpou0aexnmieiytla2rmnvp t4 lenmo ootopteli o s) 2to(r no4omee nviatfs2rruronu1ale ifcild mDumu pnt0texrxrcia1laDe ies ()texmir oo4alt  fetasf Dtrx pou1olx  o3iytfm em( p u0aexoif tydlpDeluei t s2tm(mpio4lpe mnesa( a2tr(  ;o4texomf3iydla emump u) rtrioctotfp e u i;(0t2umxo no1op nmnet s) rrmxmont1apxomiciydlm2ulu ont) eermo3oo1lmt  ies ( seurirpno1omte fctatf rtaxrono0apt mi3tat sDeanvp;t)aetrircio1oa   neols  rxmxo oudal nlncilsfarraxrpno4aleoio3ild s ra( o ()alerxfciadfp  aivo t0 euo(m no4lleemnvsls  2ra(m ou1apxoifeiytfm rlu ont0 lxnxf3iytoatrlnvsls)seum(rpiodop  lnvsa( s2rrxmpnu1oexnmf3iyt aDuln p u0tetnmocia1opt an olt t2trxopio4apte ies t  rua(m ;t1apeo i3ilslsDuau pn(0 exnmr oodop  lnei;(0 2to(r3oo4lmtnlnvs s  2tmu oou1tpxnmfetltfa2umumo t0 renifctodfa rlnvi (0 rxr(o3ny4om nlfcilsfaDtmxrpoo4aex ifetyt aDel( p;(0treoxf3ta1faDelu ols0 etmxmpou1lmee ncs t)aDrrxmpoo0apx moeiatfs uaump u) ltnircia1fa   ivo;s s2to(m no1aptnlfctl(faDrrurpou4opx mo3tldlm rmnms;() lxnifcoa1lptr i sl() exoimpnodolen ivs tfarrr(mp;o1oee io3iydlmDumuvo (4 lenio3ta1fa e uei;t  etm(o3oy1lpt  nctls  2rau  nu1tet  o3tydlaDeau p;u)aetoxf3oadlaDran i ()trtm(r3iudape  fvias)s2tmumont1aeen iciadfs2uan p t4arxnir3iodlm elueo;t0 rurio3ny4ameelfci ( aDtm( oou1tlxnifciytfsDulnmont4trtoio oy1oat auvslt)t2uoio3oy4ale lnvtl(fsrrrxronu0teeoifeiatla2el(vsnu4trtnmf3oydfp  lieo t) rxo(m3nu4lpt  nesa() 2urxmont1oee  icildfm ean pnu)arxnxf3iodfa eaneo t) rto(opoodapt  fvs sfaDtrx o;t4oltn octatls umu pn()tlxnif3oydfpDranes t0s2tmxr3ny4oltemiesat arur( oot4apxn feiydfa2ra( o u4 eermfcoydoatrli s;t)tetrim3oo1lltnlfviatf Dtmxr nu1aeeniieilsfm um(vs;(4 etoxo tadoatraivi t)s2xr(o3io1apenmics ( sDuaur ou4apxo f3iydfa ulums;()altnxf to1opte nei;( sexo(r3ny1ll  mfeiltfa2tmxronu0tex moeiydlsDrm( o u0aeerxf3ty1fpt  ivolt) 2xmxo no1omen nvs s aDrmum ;u1olt iieils m2ra( pn(0tlxrxfciy1om rlnei;s0setrxm3oudolenmfcsas sDtaurpnu4alxnif3iydlaDea(mon(0trerio3ta1fatrln ils) 2tr(o no4om nmivils) 2um(ro;t4tptn fciatfs emuvpnu0alxoxfctotoaD aies ()s2tmxr iydol nlici s)a2raum ;t1aexn ictls mDea(mp u4arenmo oytoa e n slt) ruriopou1omt  fctl(fa2um( pnu1apxo ieils sDulnms u0 leoifciadlmtr ivs (  eum(rpnodlp e ics t a2umxmo;u4opxn i3tltfaDrmnmo (0aeeomo ty1opD  i s (0texm(m iydaptnmiesl(  Drmum nu4optnmi3iad sDeaumo u)tlenmr3totfp r n sl() exr(m nodam nmnesa( arrmx pnu0tlt miciytlm rlump t)texoir3totomDeauvsls s2xrimpio4apte fvtl() Dtmxrp;t1aptoif3tat m2rm(mpnu) reoxrcoa1lmDrlneo s)s2urio3nu4op nmfvilsf rurxmpnt1aetoifeiysfmDrmums;t)artoir oytoatean ols0 rxmim3oydape  ivi sfs2ur(mono4apxo o3iyt aDuauvp;u) lxrxrciy1fmte n s;t  eum(mpiu1aleemfvslsfaruaumono0aee  ociasla uln o;t4alxnxocoa1fa  li il(0t2to(rpou4ll   fei tfs2ta(mono0optnmi3ilsls rmums t)tlermrciytfat  ies;s) 2uoxrpiydameemnviltfsDrmum ;u1apen octaslm elnmo u)teeomf io1fa r n i s) 2uoir nydlpen nct sf rrax p;t1tetoii3iytfa2el(msnt0tlerxf tydlpDrau ils trum(m3iu4optemicil(fs2uaxmonu0tlxoioetadls2emnmonu)arermrcoa1faD livi;()tetrio3nodllen feias  2urumooo1tleniieiyd s2elump t0 eermf3ty1fpt li i;s) 2xmim3oy4omte ncil(fs2trumont0aleoio3iasfm ua(mo u0 leniocia1lpt  nes ()srtmir3ny1am elfei s s2uaxmp;o1aleoii3tlslaDulumo;() etoif iytlptelnvo;t)texmxmpoy4ll nmncs tfaDta( p;t0oexn o3iyd s umn p () etrmo3tydom eau sls seum(m ny1lltnlici ( sDuaxm ;t1olt ioctyd sDuanvs u)tleniociotoa  ln i;()srumxm ou4ol e neslt) rtmu ont0oltn octasfa elumsnt0alxoxocoy1opte uvi;() eto(r3oodlm nmiet s)aDtmuro;o1ole  iciltlmDrlu snt)trtnmo3ta1optr n o s0sexmimpny4aptnmietls a2rmxmpoo1tpx  ociatfm2eauvo;u)arenmfcta1fmtr ivi;t) rtr(mpnu4amenlnetl()sDum(rp;u1tpxomf3tytfm2emnmpnt)texrmocoatfate ieolt0trtoirpnu4lmtemivs t)a2tm(ront4tetn feiydfs rl(vo;t)tleoxr todfpDrlneo;t sexrxrpno4alt liviatfaDrm(mpoo0ale moctydfm2ea( p u) lerxoctytlate neo t  2umirpoo1ale mivta()sDtrxrono4alx ii3ils sDuanvon()trermrcoy1oaD livi;t0 etoxrpoo1lme mnci sf 2rmx  ;t0aet mo3tltla2eau snt)arerir3oa1lpD anesl() rurio io4ol eliet (f 2tru p;o0alenmo3iydla rmumo t0trtrmf3oo1fatrlnvs;s  euo(o no4ole  nvsa(  Duaxr nt4aet  ociasls2rlumon(0treoir oadfa r uvils0 2xo(o ou1amtnlicilsfs2trxrp;u1aleo iciyd m emn o;u)arenmf tydlp ranes;t0tetmiopiy4al emivsat)s2ta( o;o0oeenmo3iyd m emn p;t0alxoio oy1omte nvs;s  exoxmpiu4am  licslsfsDuax  ;u4aeen ieiasfa2rauvsnt0trtnio3iadfpD  nes;()trum(r3ou4om e ncsatfarua(r ;t4tlxomi3iyd mDelump;t)altrif oytoaDran s s)t2trxr3nu1olt  fet s) 2trxm ot1ole  f3tltfa ra( ont0tltnio3oa1lpDrlies;( texoxm iu4lp e ictl(faDum(mpnu4apenmietltfa ea(vp;t)alermr3tatlate ies t s2to(opiodaltemncia( a2ur(mp;u0aptoioeilsfs rm(vo;t4 exrmo3oodfa  livi;()trxo(opiy1lm  mfeias  ruaumpou0tlen ictlsls emnmp;(0trtomr3oadoa   nvo;( s2uriopno1ol nlnctltf 2tmu pnt0aeen o3iltla2uan p u0altnio ootlp  lu ilt)t2xrirpio4lpenlnvsat s2rmxmont4apxn i3taslm2rln o;u0 rerirciy1oa raivol(0s2to(o3oy4op nmnes tfs2trur ;u4aeenmieild m2ra( s (4arerxr3oydla  lu o;s s2uoir ou4lm elnetls  2ur(root4oltoifeiadfm2el(mp u)tltrmf ootlpDeauesl()t2tmxo3ny1opt  fvsa()a2raxr ou4tpeoio3iatls2rau pnt) eermfciatom e i i;t)sexm(m io1omen ivta(  Drmumoot1olxniocilt m2ranmo;u4arenmr3tytlm   ivslt trxoim ny4apen fvs ()srur(mo;o4tpx mfctatfa uaump t4texoxoctatoa e ivi t srxrim oydomtnlnctas)s2uaum nt4alxo f3tldlm eauvpn(0texnio3tytlm e uvi;(0t2urxmpoo1ome mnciasfs2uaxrpno1aee if3tlslm umu s u4alxrmf3totfm rlnvslt setm(rpou1openlnvsasfa2tax p;t0opx mf3iad s2eln s;(0tlxnxf3tytopt aies;(0 rto(opiodame mivi tfsDurur ;t0tpxo f3tadla2rmn s (4trtoirciydop e uvilt0t2xrirpiydlleeliet s a2ururont1apeoifciadfs el(vs () rtnxo tadfmDrai i (0trtm(mpny1am   fci s aDumxrono4aexomo3iysfa2rlnms (4 rerxf oadla r neo (  exrio3io4om nmictasfaDuau  oo1alx moeiaslaDel(vs u) lxomr3oy1fat aies s0 ruo(m3io1omtelivtl(f rurx pnt0tpenmicild a el( o t)alenxr oa1lmte nes;( sruoiopiydaleemncsl(  Dtm( o;o4oexnmiciytfaDel( on(4 renmf3iadlptr nes t0trumxr oodll e iet t)a2ur(  ot0aeeomf3iydfm2um(vo u)teermr io1opDr ivi t0tetoxm iu1lpte ivt s) Duaxmo;o0apen f3iat a ul(vont)arxrmo to1oa   i sls srurxopiydopte net (  2tr(roou1oetnif3iysfmDeln o (0alxrio3ty1lpt lieo t srtm(r nodol emnvs s a2ta(m ou1tltomf3ildfmDem(mont)aeerif3oo1oaD lueols  etoio3iy1lpen ncia() ruaxrp;t1tle moeiasls2rlumo;(4tlerxo3ty1opDrli i ( tetm(m3iu4apeemicia(f 2urxmpoo0alt mf3ildfs eaums;t4 lenxf ia1lmtrlivi (0trurio3iodlpeemict t s2trx p;u1tlx iieiat s2ul(vp u4aeenxo oytoatran s;t srumxr iy1ol  mfesa()aDrrxrpoo0oexniietytlsDra(vp t4alxrifcoatfp   i ol( srxm(o3ny4ap   fct ()aDtruronu4tlx ioeiyd s2uanmp;(0 exnmo3ty1oat lneol()tetmimpnu1om  mfcia( srtau  ;u1tlen feiasfaDemuvp t0 ltrmo3iodlpDr neilt)teuoxrpoy4al n ics t srtmxroot0aeeomiciatfmDrmuvs u4 lerxrciotfpDeauesls) etmxrpnodoltemfvilt sDta(mp;t4apx  i3tydla rm(mp;u0aeenmoctodomDeauvs ()s2xrirpoy1omeemfesatf Dtau  nt0apeo o3tyd m2ua(ms;u0tleoxrcta1lptelueo;(0 rurimpiydole mnetls artmu oou0aee mfcilt mDrau snu)aetrir iadfp ranvs;s0trxr(o3iu4am emfvtas)s2umuro;o1tetoioetatfm elnmsnu4aexoxrctotfate iesl(0srxm(mpno1opt lnci (  rtaumooo4aptnifcils m2em( p (4tetnxf totfpte nes ()s2uo(mpnu4lmeelivi ()aDuaumont0texnmoeiyd a emuvonu) lxnmr ta1lpt  ueo s) etrio3nodll n fctas)aDrru ooo1texnmo3iatlm2uln onu)alxoxo ty1fpteai i t)teum(mpny4olen ivsa( srtmxmo;o4tex iociydla rmuvp t0aleoifcoy1om ean i s)tetr(opou1am  miei () rrrumpou4apx mieiat aDrlums;() etrmf3oadlmt lieo s)srtr(o ou4amt mfetl(  Drmxr nt4aet  oeild a eauvo;(0texnmocio1lptr uvs;s tetrxo iodaptnlivs (  Dra(r oo0tlxomfctys mDua( o;() renif3ia1fp e u o;s  eurim3iodop  lfcta()srtmu pno4tpx mfeiltls el( p u0tltnir iadlmDeauei ()srum(opoo1optn fvs tf 2rmxmonu4opt miciadlm2raump;t) exrirctydomt au o s0 2xoio io4lp eliei () Durx  ;t0opto ociysls ranmpn(4 exrmr tatoaDrlneil() rxmir3iy1ope mnct t)srraxr no1oeto ieiydfs ua( o;t0arxomo oa1lp  aivs;(0trur(o3oodal n fvsat)artmur nt4oet  ocilt m2uau p;u)arxrmo iy1lmteli i t) 2ur(mpoo1apeemictat  2rmum ou4aet  feiat m2eau onu)trtrxr3to1opt ln o s s2xrxm oy1lpt lfcs ( aDrrxm ;o1altn i3tltfa2uluvs (0aeerio3iotlmte uvi;s0 etoxm no4am  lietls  Drmxr no4tlenmi3iat a rm(msn() etnir3oatoaDr nei;s0texo(o3oy1alee nvsa(f rta( o;u0apeo o3tadfm ua(vsnt0alerir3oadfa  auvs t) rxr(opoo4amte nciat)s2um(r ou4tptnifctyt s2emumpnu0trtrir3iytfmtean i s)t2tr(o3nodamtnliet s srtr(rono0oltoif3iysfm2rl( p;(0 rxoifctatomtr n s t  exrxr3oy1amtemict (fsDuax  ;t4ale mieiydfs el(vpn()tetnmociydfatr ies () 2to(r iu4lp elfvia( sDrm(mpnt4tlen fetysfm raump;t4tetomociatlmDrlnvs;s  rtmxm3nydoltelfeia()srtaur ot4open fctasla2uluvo;t0 ltniocoa1fp   neol()sexrio iodap nlfcsl()sDrmurp;o0oeto ieiatfs rmumo (0 leoxf ty1op rlu o;( seurxr3no4oltnlfctl(f Dtaur ;u0oleoii3tlslsDrmuvp;u0 etrmfctadoaDe u ol(0 ruoxr oy1lmt  fcs ( artrxrpoo4texniiciltlm ul(vp (0alermociy1lp rlies;()s2xmxo3nu1op  mivt (fs2ra(r ;t1olxomieiysfs eauvsnu0arerirctodfpDr nvi;s0truo(o io1omtnlnctlsfarum(ro;t0tlt io3tas aDumnvpnu0 ltrmfciatfa raivil()trtmxmpou1op  licsls sDrru  no0oleomi3tas m2umu pn(0altriociy1la r ivol(0 2tm(mpiudol emies tfsrtmu onu4olxomoeild m raums () rxrxfctytoatrlueslt tetrio3oo4al nlfvt t)sDtmx onu0ape mo3iasls2ulnms t)tetoxr3io1lptrluei ( texo(mpoy1aleemfvtat  2tru  ou0tpt mfeiltlm2rm(ms u0arxoxr3tatfpD auvs s0srxo(m3io4lpt  fei ()sruax p;t1oetn oeiad s em(ms t4 ltrmocoatoateluvo;(0texoxo3ou1llen fvia(  2ur(mono0oeeomictys sDemnms (0alerir3oatom eanvs (0trtr(r ny1lpenmfvias aDraumonu0tet mf3ilt s rlnvp;u4trxnmo3totlmtr ivo;s) 2tm(r no4omee ncslt) rurum oo4olt micildfaDrmnms;u0texomo iy1faDe i i t0trur(m oodol elnvtas)s2rrx oot4alt  f3tysfa2emnmo u4 renxo todfm eauvs s srur(rpno1lpe  ivt t)artmx pnu0teenifctad a2emuvs;(4 eenxfciotfaDeauvs (0teumim3iy1lm e ivt (  rta( pnu4aeenmfetytfs2emnvpnu)tltoio3iotlmD  u i;t0sexmxo oudom e ics tf Drmum oo4tleo fciad m2umuvs t) leoiocoo1fmt livo ()trumxo3io4llt mict t  rrrx o;t4optomocilt s rmnvs;t4 rtnxr3tydfaD aivo t) rtrir oy4ol emieils)srtruro;t4opx iocilt s umuvs (0aetomo3ootoatr neils0s2umxr3oodome  fctlsfaDtrxrpou0tpx moeiytlaDulnvpn()areoif3oydfmD  iei;s trxrim3no4lmtnmfes ( a2tmxronu1oetn o3ils s2emu p t4 lxrmfctytfm  aieols srtrimpnudomeemfcils  2umx pnu0olen f3ilt aDra( o;t)tleoirctadfa e uesls) eum(mpoy4opee iviasfa2uau ont0aexnmfciyt mDrmumpnt0aetomfctadfp   i sl( trtm(r ou1al  mnvi t)arrmu o;o4aeeomoetys aDean o;u) eerxr oadlpt anes t)trtm(mpiy4ope  iviat) 2ur(mpno4tlxomf3iltlsDemnmsnu4trtomo oydla rlieol() exmiopiy1openliet tfs2um(m no0oltnii3tytfa rmuvs;(4 etoxf ia1faDr i s;s0sexr(mpoudll  mfctls arrau o;t1opxn iciys mDuanmpn()aeeoif oodoaD livols)sexrxopoo4apte icsasf rua(rooo1oeeomicild a2eanvs t0teeoio oatlm  au s ()s2trxr iu4lmen iciltf 2uax poo1teenif3tas mDeaumpn()aetoxo oy1op   nvi s)sruo(o3no1lp n nesl(fsDtau p;t1tltoiicild aDelnvs;u0tleoxo3tydfpteln i;s  euo(m3nudomt  fci ( a2tax p;u0ale  i3tydfm rlu p u4teeniocia1oaDeanes ()t2trxrpiudamen netat) rrrumpou0aet iocilsfaDem( s;u4aeenio oy1latranvi;s0 exo(rpou1ll emnvtltf rra(roou0tpenmieiadls rl( snt4tlxoiocty1lat ln s;( trtrxm3iodap e feiat)s2rrx poo4tltnio3iytlaDelumsn(0 exoifciytomtrlu s;s0seuo(o oo4lm n neia()sDtm(mp;u0tpe mociasfa ra( p (4 etrirctodfptr nvs;(0 exr(r3iudape micias) Drrxrpnu4teto fciydfm em(mp t0alenxfciytlmDr ueo;s t2tmxopnudlp n nvslt)artaxrpnu4apto fctadfsDulnmonu)trtnmf io1fmDr u o;()s2to(m iodome mietas)srtmur ;o1tptn ieiad mDra(mo;t4artnif3iydfa rln sl()srxrio3ny4lmtn ici t srraxr nu1alen iciat a2uanvpnu4tltnmr3ta1opDr n olt sruoir3oy1alt mnvtls s2ururp;u4alx  fciad s2ra(vo (4altniociy1faDe uvs;s)seumxmpiu4lme  iciat) Dumur nt0tpeomfciadfa rlnmo (0aexoxf3tatopt  uei ( sruo(r iy4am e icilsf 2trxmo;u4tpx iictldfa2ra( pn()aleoio ia1lmtrluvi t)texmxr iu4oleelfesa( srur(m ;o4tetnmf3iasfm2rln onu)aetoxo3oydom   uvs s) 2uoir nu4lm elfvs t)s2ta(m nt0oet iietlsla2eanms;(4 lermo3oa1lpDr ivo s  exm(o no1lm  mnci t  2tru ono4oleoiiciysfa2el( snt0 rxomf3iydfmDelues t srurimpnu1amtnlfci t artaurpot4oex ioctadla uanmp ()tlxomo ootfatrlu olt sexmxo oy1lme mfvs t)s2umx o;u1alxomi3iltlmDul( snt0tlxoxfcoodfp e ivol()t2toxm3ou4amt lici ( arurxmp;t4apxnii3iytlm rmnvsn(0 reniocoatoat lnei;t)seur(o no4lptn ivia( a2tmxro;t1alxnioetldfsDra(vont) eermf3oodlatran s t0srtrir iu1am  mfci s) 2tmu p;o0olxo fetlsfa rlumo;(0 lxrxo3oadlaDr nvils sexm(o3nudome mictasfaDtauronu0olx ioeilsls2ul( p;(0texoxf3iy1omDraneo;t)setr(m nudopenlietlt)s2tmumoou1tlt ioctytfa2emnvon(0 rxnxo3todfat an s;t)trxmxmpoo4om   ivta()a2rr(m nu0aeto oeild a uln s (0 ltoir oodfa   i i t)setmir nu4lpee fesls aDumxmoot1opeo iciyslm2raumonu)trerir oatomtrlu s;t trtoxo3io1ap n ivi s)a2raxrp;o4altnmoetld a2rlnmo ()artomo3tatfp ean slt t2umxo3oo1ap   netl( srtrxro;t1oet  ictltfa ea(vo (4alenxfcoydlp e uvsls0srtmxm ny4am  mivia(farraumo;o4aptn ieilt m2em(mp (0tlenxr oatoaDrlivi ( teuoir nodlp n ivi (faDuru p;o0tpeo i3iatfa ulnvp;u0texoio oa1lmDrluvs t  rtr(opoy4lle  fcs ()sDrm(mp;t1ole iiciadlmDum(vsn(4trermrcty1oaD li slt) 2xoxrpny4aptelneta(  2tau o;o1ope mfcildfs umnmo;(4tlermoctydoaD anvs;t sruoio io4opeemnctltf ruau pnu1aeenmoetlsls ulums;(0artoxfciodlm  auvols0 eumiopoy1ome lnctl(fsrur(rpou1altnmieiys sDrmuvsn(0 lenio tydlat li o t  exriopoudlptnlicia(fsrum(mo;u4tlxoiicilt aDra( o;u0tlenmo oytlmt auvi s  rtmxrpoo4ap n nesat s2tm(m nt0aeeo iciadlsDum(vsnt4tlxnmr3ia1fmDran o () exm(m3oudopeemivil()aDum( oot0ape micilsfm2uau p u) ltoir ia1fp   uvol(0s2uoio ny1ome mfesasfarrmxmp;t0olx iieiyslm eluvs;u) ltomr ia1op ean s;s0teto(r3ou4amee fcs sf rtm(ro;u4tet  fetasfs ra(mo;(4alerxf tadoa e neo;s)trurim nodamt lfeils s2umur nu4opxoifctas sDea(vp;(4 etrif3tatfatelieols t2xmim3nu1op nlnvt s srrm( oot0altoifcils m2ua(vpnt0aetnif3todfm  aivi (0 exrxm3oydapee fes sf Drrx pnt4tlt iicilslaDrmnmpn(4 rtnmfcoodoate neols)s2umxrpny1olee nes t)sDumxmo;t0altniiciatla rauvsnt4alenxr3ta1la rai s s  rum(o3io1amen nes s  rraxr ou4oee  oetytlsDelnms u0aetniociadlaDrauvo ( srurxm nydol n fcsa( arumu p;u0aet  f3tysfs emnvont4tlxrxo iotlpt aivo t trxrimpoudol  lnvsas) 2uru o;o1olx mi3tlsla ra(vonu4artnmf3iotfm  lieo s)trxrim nu1aptnmneias s2uaur ;u0aeeomfctltfm2ra(mo t)aetomf3oy1omDrli i (  rtrirpou1altn fctat  2ua(mont0opx  f3iadlm2elnvo;(0trxnmfciy1lpDe n ols)t2urir3oudapt mfvil() Duau o;u0tpe io3ildls2emuvsnt4aeeoxf ootlmtraies t) 2xmir3ny1oltemfviltf Dumu pnt1apt  f3ildfm2rmu p;u) eeoiocoytfaDr uvo (0 2xrxopno1ope mnctasfs2ta(  ;t0aptniieiaslaDemnvpnu)alerir ta1lmtr ues;s texmirpno1olenmfeilt a2uaxmpot0ape mieiatlsDuanmpn() rxoifcio1oatran s t)s2toxm3iy4lmt lnetltfs2urum oo1aexnmi3tltlm2rl( pnt0 lxomrctydfp  au i ( truoirpno1amt mivia( a2rrx o;u1aex miciydfaDemnvonu4artoio3oytopDe iei ()s2toxr3iydal eliesa(  2raxm ou4alt ii3iad s2elnmsn() rerxo io1oatranvsl( srumxr3ou4omenlfcia() Dtmur no1olx io3iltfa rl(vs t4trtnmo iatlpteaivo s0texr(m3ny1lpe mncs (fa2um(
\ No newline at end of file
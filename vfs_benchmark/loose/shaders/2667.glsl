@@ -0,0 +1 @@
+iesl()trxr(o3ny1amt mfcil(f Dra(m ;u0tpto oetad aDel(monu)altoif3ootlptr ueolt)trxmio3oy4lle miei s aDra(  ou0apt  ieilsfa emuvpnu)tlenmf3oa1fmtranvil(0srxoir no1omee netl( arraumonu0apx  feiytlsDel( sn()teenxf oy1faDeaivilt)t2trxrpiydlptn fvs s s2tmu ont4tlt iiciys sDrl(mo;u0 eerir3iatoaDrauvs;t  exoir no1am e iei t a2ra(roou4tptomoeiasfm2ea( sn(4artoif iodfpt anvo t s2uo(rpoydamtnmies t)sDua(m ;o4aex  o3ildlm2umnmo;(4trermo3tadfmtelnvo ()s2xr(rpiydlpt lnetls s2ur(m no1olxnif3iys a2ua(vo (4trxrxr3oa1om e ivo s trumxr nu4lmtelivtltfsrtaur ;o1optnio3ilsfs rmums u0 rxnxrcoydfaD lneo t0t2uoio3iodoleemici s)aruax  ou1aexn feiys s el(mp t)tetnmo iadoa raueolt  2xoim3nu4openmiei t aDraurp;o0aeenmoctas m uln p;()altniocootomDrlivo;t0s2toio nodopen icsas)srtmx  ou4oee  octyslsDeanvs t0tetrxo ootla   nes;(0setmio3ny1oltn nvta() rrr(rpnu1oexn i3tltlm2rmn s t4aetnmoctotom e i sl()trtriopiudop nlfvsltfarraur ;u0apt  ociadlaDelumo u) eeoio3oo1omD lnvi t0trtoirpnudlptnlivi sfs2ua(mono1tlenio3iat sDrlu s;t)tetrxr3oytfpDr i s;t0teum(o3nodlmeemfviltfsrrrxmonu0oet mfciydla2rau pn(0artrmrctotfpt  ivs;(  2urxrpny1ll e nvi s)s2trxm nu0olxomociltfsDemuvsnt4tlenmociadfmD  neil( s2ur(r io1op  mfcilt a2rmx o;t4tpt iieiydfa eaumo (0teermf iotlptr neils  2uriopoo4lm nlfvs sf Dum(mp;o4tpt mi3iysla rmuvs;u4 eenxrciatfpt  nes ()s2umimpiodopee nvil(fs2raurpnt4oet  f3iatla rmu o u4 reoxf oa1fm eli i ()srtoirpny1olt mnvi sfsrrrumpnu4tex mi3iyd s2emuvo;u4 eeomf oy1fa r i s t)seuo(rpnydop   fvta( arrm( o;o0tlen ociydfaDel( ont4 rtnxr iodlateaieols)srxmxo oudol   fci sfsrum( pnu4alenmo3iltls2um( on()treoxr3tytop elues t0t2uoxo3oydlpt lncs (  rtmxmpot1oeeoii3tlslaDrmnvs;()artrmr iatomDeanvo t) ruoir iy4olt  nvta( srtmumo;o0teenif3iltfa2emu s;u)tltrir3iotfmDeaies;s0 2xoimpoy1llte ncsat sDtmuroou1ole ii3tysls2eluvon() ltrio iodla  aneo t s2trxr3oydamtemfvi ()aDumur nt1teto oeiltla2ra( s;u0 rxrif oydlp ranvsl(0 rurio iy1lleeliet t sDtmuro;u1tpxnio3iytfm2ulu o;t0tltrmr iadlp rlues;()s2tr(rpoodap e nci s)aDtrxmp;u0opx  ociltlm2ulnvp u4 ltnxfciy1oaDe u o s0s2xmirpio1lptn ici (  Dra(mo;o0alx mictytls emnvsn(0 eermr to1omt livol(  2umxr oy1lpe mncil()sDtmu pot1tet mietyd m uluvs () etrif oadop r nvilt  rxoxr io4omen fvt t)aDtr( p;t4altnii3iatfa um( p;()tltrmfcoy1optean slt t2xriopiu1lle  fesl() 2umu  ou4tpeoiociltlm2emnvpn(0 rtoiocio1la ranvol()srtmxr ou4am n fvi ()s2rr(mpnu4aetn f3iltfs2ea( p t) reriociytomt livilt0s2trxr3iudolenlivtl(f 2tmum oo0oetnioeils m ulnvp;u)altoxrcoydfmDeli s s) rxrxm oy4optelncsa( s2rrxm ou0oeeniieiysla uanvp u) rxnmociydlm elnvi;s t2trimpny4lp nlfctlt) 2trxr ou1oet  ociad a rlnvpnt)tltrxo3tatla e ueo;t t2uoir3iy1lm  lfet (  2ta(mp;t4tpt mfeiyslaDrmnvs;t0areoxo ia1fa e u ilt truriopio4apeelnei s)aDta(m ;u0alxnii3iatla2emuvont4trenmo3ootop   ueilt0 2trxo3ny4opee nesatfsDrax  oo1tetomi3iatfmDumuvo;(4trtoif3oy1oaDeau s s)srxmir iu1al e fesl(  rtau oou1alxo octat sDra(mo u)alerxfcoydlmt aneilt0setoxmpiydamt lncia( srumuro;u4teeo o3iat a ul(mo (0altrmo3tytoat lnvo;t0t2uoxm io4omtnliviltfs2ur( o;t0apt  oetas a rlumo;u4tltomrcoytfp e iei t) 2ur(r3oy4al  mncs s) Dra(mp;o1ole  fetatlsDumums ()texnxr oatlmDe u ils setoxr3ou4al   ieil( aDurump;t1openmi3tasfmDrauvonu0aeenmr3iydfaDe uvsls0trxmxrpou1op   ietl(fa2rmurpot4tlxn ictatlaDel(ms;u0alxrmr3iatlmtr neo;t) rxm(opoydalenlici t)srum(r ou1olto octysfsDrlu s t4treoxr3iy1fat ln i (0setoxo3oudlm e ics s s2ra( ono1oee  o3tld mDrauvpn()tlxomr3iodla e uvs s  exoxrpnu1lpe mictlt aDtm(root0teeomo3ildlmDelnmo;()aexoxf ty1opDrli o t  exoxm oodaptn fciasfsDtr(mpnu0olenmfeiysfmDeau s u)arerifcoodlptranvs ()s2xo(o oydlmen nciasfaDra(r ot0aleo fciad aDemuvs t0trtoir iytlaDrlueils)s2urio io4lmtnlfei s s2tau ooo4ole mfeiaslmDel(vonu0areoif oo1faDelnvsl(0tetoir3iy1ll  lies ( srumxrp;u1tlen fctatls ul( s;t4texnmf oy1latrlu i s)t2uoxo3ny4amee iesatfartm( p;o1tet mi3iltlsDem(vs t) renxoctydlmte i i;t  exoir no1om emiet s)s2rmxronu1opxo feilsla ean pnt0 leoif3iatlate uvslt srxrxmpiu4lp emiciasfsDuaurp;u0tpeo ictyslmDrmumo;u)treoxr oytfmDr ies;s0teurxo3nodlmtemiet t)sDrr(r oo0opeoiicils sDrlumpnt0teeriociytoa  au o s)trumxm oo1ope lnctas)a2tmxr ;u4tetniictyt m um(vp t)arxnxf3oytfp  lu ils sexmirpnudamtemfvslt) 2tmxrpnu0alxnmo3iasfm umnmont)aexomociy1lmt  uvo;t)s2um(m3ny1op n fet (fsrrmur no4ole  fciyt m2ulumo;t4altrmr oodoa eaivi;s)t2umirpnudal nlfes s  2uaxm ;t1alxnifeiadla ul(ms u) eermo3totfmDe ies s) rxo(mpou1opt mfes () rta(rpno0ape  ieiltls2raump (4 exrmf3io1la rauvo ( s2xo(m nodal  mnesltfartaump;u1tlen f3tltls2eau o ()altrmfcoytfm rlnei () rum(o no4amtn ivia() 2umur ;u4tpe  ociydfm2ua(vs t4alenxo oodla ranei ()teumxo3no4amee nvtlt) Dumxmpnt4olto fciytfs2ea( pnt)tlxoifcoa1op eliei t  2ur(opiydapee iei sfsDur(  no0oleo f3tadlaDrln s u0 etrxr3tydopteai s t  ruoir oy1am  lfeil(fartr( oou4tpenmoctysfm ulnvo t4trtnifcta1opt  nvil()trum(r3nudom elict t)s2tmurpnu1ole mo3tysls2ra(vont)arxomf to1fm rauvo;()s2xmxrpiodol elfeil(fa2taxr ot1aetnifeiatls umnmpnt) ltrmr3tadoaDelneo (0t2tr(mpiu1lltnlivtl(  Drm(ro;o1openmociltfa ra(ms u4 eenxrctytfmtrlivi;t0seur(m3nudapen nviltf rtr( o;t4alt ii3iltfsDranmp;u0tlenxo3tatla   nvi s0setm(o nu1lp   fesltfsruax  ot0ole mi3iad sDea( s;()tltnxr3iy1fmt  neilt0 exrxr3oy1lpt  nvt t)aDraxmp;u0aetn octltls ulump;t4aetoif3tydlpDrlieo t trumxm3oo4lpt mfvtl() Drr(r ou1tleo oeilt mDrau o u4arxoxrcio1oaDr iei t)truoxo iudame lfcia(f Duax  no1apxnmo3ilsfm2umnvpnu4 etnxo iotlatelu s;t srto(opou4lmenlnvi t aDtrurpot1ope ii3iadlm2rlump () lxnxocto1oa eanes t0s2xmimpiu4lptnmnetls  rrmxroot0altn ocildfmDrau o;u) rxnmr oydoatraiesls srxmxm3ny4om elfvil( artaum oo0tptoifcilt a eauvp t)treomrciotlp eaueo;s  rxo(m ny4olt lnvsat)artrx ont4tlxnifeiytfa2rlnvpnt)trtrxr3iodomt  ues (0trtrir no4lmt lfvs s) 2taxr ;u4olxoiieiydfa el(mo;u) ltrxr iytlateaieo;t0t2umim iydamt mfesas) rrrum nu0aleomieiyd sDeau p;(4 eenir3ia1la e n sl( srurxr nudopeemnci tfaDtm( p;t4aleomiciadfmDum(vo (4trenmf3ty1opDe nvi;( seumim oo4apenlict s sDraxm no1aetn i3tat aDrl(vo t0trtnmr io1lmteluvol(0tetmxm io1lptelnvsa(  rta(moou0aet ifctad s em(mo () leoxo3totfaDraieol( teuoxmpoodlpt  iei tfa2rrumpoo1oetomfeiydfa uln p;u4 lxoiociytfa   uvol() 2tm(opiu1oltnmncilt  Duauroou4tpt  f3ilt aDrmu ont0 rtnir3iytfp eln o s0srtrxmpnu4aptelnci s srrauroot4oltnmo3tadla rmnmp;u)arenio tydfptraiei;s) exoimpoodamee fesls) 2uaxmo;o1tleo fctysfa2rl(vsn(0tlxoio oo1fptranvi;t seur(m3oudal n netat)s2rruro;o0texoifetatfs rmn pn(0trxriociatoptr uvs (0 rxoxr3iy4alt mfctls) rtaxrpnt4tlt io3tat sDrluvpnu0tetnmr iytom  auvs;(  2xoxmpiy4llen fci s)arraxmpoo1opxomo3tatfaDelnms u4 rermo3oadfm elu i s) euo(opnodome  fetatfs2tr(ro;t0alxo feilsls2rau pnt)teerxf3todfpDeauvs s)trumirpny4op emietltfa2umxm ;u4olx mfeiatlsDemu o (0aleomrctotlp rlivsl(0 etm(r3nu4ale mnctl(fsDtrxmpoo1aee ioeiys s2rmuvo (0altrir3io1laDeanvs;(0srxoxrpiy1ap n neia(fsDrr(rpoo4openio3iadlaDeau s;()tleoxo3iatfpt  i ilt0srur(o ou4am  lnvtas)arumxm ou1oetnif3tadlm2ul(mont4trxrmo tydoatrlu s s0trtm(o nydlmtemicias  rtau  ;o0aptnmf3iat s rm(mo;u4texnio ia1oaD li i t)texrxr oo4lltnliei s  2uaurp;o4tlxn iciatfmDuan p t) lerir3iydfptrlnvsl(0teuo(rpnudol n fvta(fsDtru pou4opxo iciad sDrmnmo;t)aetoxfciy1fat ln ils  2tm(rpnu1openlfctatfs2uaxmpnt1alto i3iltlm2el(mo;(0trxrxocoadfmte neols0sexr(mpny4ape  fct t sruau ont0oeenif3tadfs2um(vs;t0arxrmf iadoaDr uvs;(0 2to(m3ny4aptnlfet (farta( onu0oeeomi3iytla uanvpnu0 etnir to1faDe i olt0 rxo(o3iy4ll e fvtas  Drrxronu4aeen ieilslaDrlnms;t4aeenmr oodlaDrau s;t) 2xm(o3nu4ame lfeils a2taump;o1texoiociasls um(vo () rtoxf tytlpD  uvi t0s2tmir3oydap   fcilt aDtmxroou0alt ifciysla2rauvo t)texnif totfp e ies t) etmio io4lme mnvi tf Draum ;u1tpen oeiatla rmnmo;() etrxrciy1lm eauvi;s  2xrxo oodal nlnvilt)a2rmxm ;t1opxnif3ildla ran s u4 rtrmociy1omtrlu i (  eum(rpiu1altelnct s)sDua(ro;t1tpe iociasfs uln p;t4 rxoxoctytfaDrai i s)s2trxr nudlmt lfcil(f 2raxmpot4aptnmociytlaDulu s;t0tltnxf ty1lpDelnvolt  rumir3ny1amt lfciat)a2urx pnu0tpe mi3iys mDuauvs t) ltomr oadfp rau o;t  etoim iodale livt (f 2ta(mp;t4olt iiciysla2umuvo (0 exniocto1lmteli o;(0srxoim oo4op nmfvsa(fs2rr(m no4optn feild aDul( p () leoio iydfaDrau s;s seuo(r3iy1altnmfvil()srrrxr ;u4aptomieiadlsDemumo;u)tlxomr iadoatelu ols)trtrim3oydlpt  fviltfa2rrxr ot0tpt ii3tyt sDrlumon(0teeoxfctadop e ieo;t0s2trxr3iu1opeemncs s aruaum nt1aexn feiasla2ua(mpnt4treomr3ta1faDranvol(0seur(r3no1opt  nei () Dtau oou4aet  o3tyt sDrm( pn()arerxocto1laDelu s s s2toimpoy1ole  iciltfa2rmx oot4tpeomfeildfm2emnvs t) exrio3iatfa elieo;() 2toxo iydlmenlnei t aDrax onu1olto i3iadlmDrlumo;(0tlxoxfciodomtrlnei;()srurimpiudlptelieiatfa2ua( o;u4alt  feiatlsDranms;u0trenif3oadlpte nvolt) rto(opoudlleemiei (  Dtrum ;o1oleoiieiasfm uanmpn() rermo ia1opDr ies;t0srtr(o3no4omeelici sf 2rmum ot4alt  i3ild sDrmn s t)trenmf tydfm r nvo;s) exm(o3iudlpte ietas a2uaumono1texn i3ias a2ulnmp;t) rtoxfcoodfate u o (  2xoir nu4op elncsat) 2rax poo1aptniietls s2em(msn() reomfctotoateli s;t) etrxopiodll   nvsl( artmxmono4ope  ictysla eauvs;u0 rtnmf3ia1lp rlu s;s0srxmim io4amte nvs tfs2urxm ou1tpxnioeiysfa2rmnmpnt0tetriocoodoat luvols)teuoir3oy4omeemnvtl()a2ra(r ;o4ole mociadfsDelnms u4artoxr3to1lp   neo t sruoimpny1lltemici (fsrtau poo1tlxnmietatla rau s u) ltrmocoo1lmteauesl(0 rtm(m3iy4opt mnetlt arrmu oou4aexn oetadfs2ul(von(4 etrircta1oaDrau ol(0t2uoxopnudop  mfci (fartmxr ot1tleoiieiadls rmums ()texrmf3to1opt lies s)sruriopiudap nlivt sfsDuau  ot1tee mi3iatfa2rm(mo;t0aleoir tatlm rlivi s0 2xoxopnodaptn fvi t)sDtmx o;t1tlenii3ilsla rl( s () etnircio1om   n s t)s2tmio3nodol  lfctas)sDtmu ont0optn f3ild s2elu p;t)tltoifcto1lm r uvs s0 rxmim3no4ap  mfcias)sDraxronu0oetn f3tat m2rlumpnu0aeenmo totlp rauvo ()teum(m iodapt lfvsa() rrmu p;o1tptnio3ilslm rmu on()texnmr iadla rau ils0tetoir no1om   fcsat sDta(mono0aetnmictyt a2rlums (4alxrxr ia1omte uvslt0s2trxr3ny1lmtn nvslt)artrx  oo0apeoif3ild aDea(monu4 eenifciydfa   ies;( tetrxo ny1ap nmict (  2tax ont1oetoii3iltfs ulumo;u4 rxrxr ia1fa elnvi;t)sexrxrpiu1opeelfci tfsDrrxmpno0tlx ifctydla2uaumo;() rtoif oy1omD luvols srurir3no4amee nesl( srrm( pno0teen ieiyt sDem(ms;(4aleomr oy1lpteluvs (  rxmio ny4lmen fet s srrm(mooo0tpeo o3taslm2em(mp ()aleoircoadfmt aivol(0 exrir oudap  lnviat  Dua(mpnu1tlt if3iyt m rmuvonu0artnir tadfmDeau o;s)tetoxo3iodaleelncsa(fs2rrx ooo4aetnmoeilt m eln p;()artrxo iytomDeaivs;(0 exoxo3ou1apte nvt ( aDrrumooo0oeeomoetasfaDel(vo;(4artrif3oodlm   i ols0srum(m nudom n netat)arrrx pnt0tlt  ieiyt m2rmu pn(0 etoircoadfp   ueo s  etoxm nudlltnmnetas) 2rr(rooo4ope iociatfm uanmsnu)aexnmrcoy1om r i o t0trur(r3ou1ape  ivt ( aDrm(rp;u4ope  fciytfaDemu p;t4aeeoxociydopDr uei () eurim3iydomte netltfsDta(m ;o4optnif3iatfs uln s;t4teenir3iodfm rlnvsl()s2xmxmpiodam n feil() 2rrx  oo1aexn i3iydlaDean pnt)arenio3totlp rli s;s)srxo(r3nudolt mnesls)aDrr(rpoo1aex ii3iat a2rmnmon(0tlxnxr iy1fp  lu i;t0 exrxm iy1olenmieilsfaDrmxmont4tet iictadfs2ea(vpnt0alerif3iadoaDr i o;s0 rum(m oo4lmte nvi (fsDumxrpnu1oetnif3tydfs2ul(mo ()tlxnmo iy1fm   n ilt trxrxopiu1optnmneiltfsrraur ou4tle moeildfa ua( o;u4trxoioctadlmteanvsl()s2umxr3ou1al e ivslt)arurxmooo0oeenio3ild aDrlumo;u0 etnir3todlaDr ivo t s2umxm iu4amtn nei t  Dtaumonu4apen icild mDrm(mpnt)alxoxo oatfmDr nei s0sexo(r3ny4oltelict t) 2ta( pnu4oleomiciat sDrl(vo (4arxoiocta1omD aieo () rurim oudlptnlfetls  2umu poo0opt ii3tytfs2umnvpnu) lxrmf iydopDeluvs t0seuoxr iydlpe  netl( sDumu o;u1apxnmfctyd sDulnmp (0 rtoxr tadlpDr ivi;t0t2tmir nydlmeemfvsltfa2ra(mont0aet  i3iatlsDrm(vp u4aetomociotfp  lnvo s0 rumxr3oy4omeemiei t)aDtmumonu1apeomfetyd a2uau p t4aeenxf3todfm  an s;(0 2uoimpoydlmenlfeiat) rrau  ou4tltnioeilsls el(vs;()trxomr3tadfmtrli sl(0trxrio iudop e fei ()sDum(root0optoif3iytla rluvont0 etrxo3ta1omD liesls0truriopnu4ol e ncils srrrxmp;u0aexnmieils s ean p t0trxnxfctydoa elneols0 2xm(o3iudal elnci s srrm(rp;t1oltomoctlslaDelu ont)alerxr oodlaD aneils)texrxopiy1ap  lictat)a2ur(m oo0aet  ieiadfs2ua(vo (4texoxf3oa1lmDe i s;t  eum(r3nu4opeelictlt aDur(ro;u0aet  o3iltfmDea(mp;(0tltnxr3todlmD  uvols0trtrxm iu4om n nciat)srrmuronu0ale iictldla ra( o t4artrmr3iy1fm   ivs;t srto(opnu4aleemivsas) rurumo;o1alx ioctytfa2um(vo;u0alxrmo oo1op  lnvsl()trxrxmpiu1ape mics tfartrxr ;u0aetnif3tltfa emump ()tlxomo3oy1opD  uvo;t0teto(m3oudaptnlfeil(  Dta(moou1oltn octydfm2el( p;(0texnmf oy1lmDean i;s  2xrim3iy4ll  lfvil()s2raurpnt4tleo feias aDrm(vs;u4alermf iydlmDe uvi (0 2xoxrpnodlleemfvsat) 2trxroou1olx ioetas m ul(mp ()trtrxrcoatfaDelnvsls)s2tmirpiu4ol   fci s a2ra(mooo0apxn feiysls eln on(0trxoxf oa1fmteluvi (0 2trxm iydlpte icsa(f rururo;t4oet ii3tad mDelnvo;t4 reomocta1lmD  uvols)s2um(m3oy4lme  fctlt)arurxroot1oex moeiasfs raumsnt0areoxo tydfatelu o s0 2um(o3iodap   nct (fa2umumoou4opt mi3iatla elumsnt0texrmr3iatfmt  nvols)t2trxr nu1ll e fcs ()sDua(r ;u1aeeomoctad aDrlnvo (4artnxfcoatomD lnvo t)trtr(m3nu4ol e fct tf rrm( onu1alt mo3iatlm2rm(vpn(4teerxr3oa1fatr u s (0teurio3ou4ll  lfei s  Duax  ou4teenifcilt a raumo t0aetnmr tatomDr n o (0srxmxm3iudllenmnciasf rtmumpnt4oex iiciadlm2eluvs;()trtnmr ootlpDr uei ( trxoxopny4am nlncsltfaDtr(mpoo1apxo feilslm el(vp (4 rxrir oa1lp  aieilt0texoir ou4optemfvtas artmxm ou1altnmi3iydlm rlumo;()teenmo tatlpDraneo s0teto(opnydap nmnctat) rra(m oo0altnii3tys m2um(msnu0texrxo3iy1omtrlu ols s2uo(r3oudamee fetls sDtruroou0oltnioetlslm2em( o;(4 eermfcoodlpDraieo;t)s2uoxr iydamen fcil(f Dtru ont4olx  f3iltls rmnmp;(4 exnmo3oa1lmte n i (  etr(m3oudlleeliciat)aDurxro;t0oltnifeiydfaDum( o;u)trxnxrciotfpte i sl( setmxo3oudol nmiciat)s2rm(ronu0alxnmf3iatfa ul( ont0 rerif3tadfatelivol(0 eur(o nu4aptn nvtltf Drrxrp;t0aleo f3iyd m2uanvsn(0 eeoircoytlp eli i;s)tetm(r3iodolt lfvt t)srra(rooo1olx mocils a2um(vo;(4 reomfciotlateaivi;t trtoxm iydam emict ()sDuaxrp;u0texoio3tys aDumu pn(0 rtnifcia1omtelu i;t srtoxmpnudlme mncilsfsrtm( pot0apx moeiytfaDelu pnu4altnmr3oytfa elivolt0trurim3no4op elfvils) 2tm(mont4tleoioctydlm2uauvs;t0 eermfctydlmt luvslt)srxrxm iu1lmt mnctl(fs2tmxrooo4aptn o3iatlm eanvpnu0trenio iodoatrlu o;() rxr(o oo4alt lnes t)artaxmo;o0tptomo3iad sDran onu4alxoio3oatfatelnvi t0s2umio3iu1opteliet (  2rax pot0tlenmi3iys sDeauvo u4tltnxr3tytfp e n i ( trxmxm3nydomee ieiat)s2uaur ot1openiictyt sDelu p t)teenxfcoo1fmDelueo;()seuoim3no1olt lnvilsfa2rmxrpnt0aexoiieiltfm2ul(ms u0aetrif3oo1fmt  uvo;( seuoir nudapenmici ()sruaxr ;o4ope  fciad m2rln snu4aeermociadfaDrluvol( trurio oodlpt  nct t a2um(r ot4aex ioetltla ua( p ()trxnmr oatlmt livs t  2uriopio4lmte ies s) Durumo;t1apxn fctytla2ra(vp u)trxnif tatoaDe u i t0trumio nydolt lieiltf Dur(rp;o1tet  ictlsfm2ra( on()alxoioctytfa  lueo t0t2umir3oudome lietlsf Dtm( p;o1tlenmictls m emumo;u4trxoio3ootfat auvo;t0 2to(m3oo4ape lnvt t  rurxm nt1apxnmfciadfm2ra(vs;t) eeoir ty1fp raivi ( srum(o3nu1lltelfes () 2tru o;o1tptn iciadlsDelnmp (0alxoxociotlaD auvo;t)sexo(r oodame lfcia( srtru pot4olt mi3tlsfs2uluvsnt)trenmo iydop rlivi t) 2tmxm3ny1alte nesas)sDrr(mpnt1aptnioeiaslm2rmumo t)tetnio3io1fmt anei;t0 rtoio iodam emnctlsf rumxrpno1texoioctlsfm2emu o;t) rermr ty1lmDrauvi s) rtmir3nudll   nvi s) 2tmxmo;o4apxnifetat m2el(mp u) rxrir3todfaDelues s  2uoxo no1ole livtltfaDuaumont4alen icild s2ea(ms;()alxrxo ootfptr i ilt s2xoim io4lmen ies s)a2rrur nt1apt  oetytfmDrm(vpnu4tetoxf3oy1fpD aivs;s0 exrir oudome mfesa()a2uru o;t0aee moeiytla rl(vo (4tetrmocoadop rlu o (0trumim3ny4aleelfvsl(farumxronu1apxo octas a ranvo (4aetrio3oy1la  li olt0srxmxm3io4lpen ivs tfsrtmxmo;t4aptomf3tysls2eluvp;t)texrxfciodlate nvi ( t2xm(o nu4ope  net tf Drruronu1alto octasfm2rau onu4 eermr3totlm elu ols0s2uo(o nodalt  ncsl( artrxmpnu0opeoiictltfs um( pnt)aexrxo3tydfmDe iesl( truo(r nodopte nci (  Drm(mpno0aexoifeiysfm2rm(msnu4texniocoydomD lu s;(0tetr(o nu4lltnlieilsfarua(rp;u1aex  ietldfs2elums u)arxnxrciytoptrln ilt)sexoim oodlpte ietasfs2tm(mo;u1aexo ieiys s2rmnvs u4 lxnircoadomtraivo;t  2xmio iodap nlnet (fa2ta(rpnt1tptoioeiltlm rmnms;t) rtrmo3iytlaD lnvs;t0 exmxr3oo4ll  miet (  2ur(ront4texo fctldfa ea(mo;()teenio oydlmDr ieo;( t2xr(opnodapeemfeilsfaDtm(m oo0aexoioetydls ea(vp t)tetrxf oodopDr nes t0texrxrpny4ap   fvsls)srtmum nt1tleniiciys a em(mon(0areomfciatlm e i i;t0sruo(opny1alenmneia() Dtr(m ;u1optoifeiadls rl(mp;u0teeoif3tydfmt lu o;t s2umirpiu1ll  livil(faruaurp;t1aleniietatlmDuluvs u4arerirctatfmD  uvi;(  2xo(mpiu4ole lfesl(fsruaxmoot4apx mf3tat mDrmnvp u4 rxnxf3oodop  aues s trto(o nydap nlncilt)sDum( pnu4oexnifciatlm2elnmpnu0aexriociy1om elues;( sruoim3oo4al   fctas  2ra(ro;t4tlx  f3tydla2ranmo (4aleomf3iadfa  lnei ()trtmir3nu1omenmivi tfs2taxro;u0texomoeiys mDea(vont4aeeoxo3io1omDe n olt0t2xoxr ny4ope  nvtas srrrum ;u4ole mociad s um(mp u0tltoifcoo1fm elnei ( tetmxmpoo1opeemivta(  2tmu ooo4open fetatfa2ran p;t4 rxoif to1latelivs s0 exmim nudam eliet ( srrm(rono1optnioetldfa2rl( p () lxoif iodfptranvol() exoimpou1lp nliei tfsDrmurpoo4tle  fetas mDraums t0arermo totlpD au ilt0s2uoxm ou1omtemicsatfa2rru ont1ope  o3tat a emnvp;(0trermo3ty1lp ran o ()tetoxm3nudlme livtlt)a2uaxmo;u1tlen oeiltfs ea(vonu)aexoxociadfat an ils texo(rpiydlmtn ictls aDrr(ro;o4aee mfciydfs2ra( snt)aexnmr iy1fmDrliei;()trumir ny1alen fvtat)arur(m no4olx  oetysfm2rau pn(4aleoifciytfmt aneilt0setrxm iodop nlnciltfaDtaumono1optoif3iydlaDel(vs;t0 lxrmr tatfaD  uvo ( s2um(m oo1apeelfeil() Dur(moou4open f3iat s2ulump;(4arxnxf3oytlmDeli ols0srtoxrpnodalenmncsls)s2tmxr nu4tltomo3tys sDelu pnt0teenio iodlpDraivi (  2xoim3iu1amee fctas s2rrx  nu1tpen f3ilsfs2ulu s ()alxnmf3iy1lpt ln slt teum(m3nydopenmnetls)aDua(r oo4tex mieiysls2um( s u)arxnif ootfa  lnvolt  rxoir3no1lmtn nvs s)arrrurono4tex  f3iatls2em( o ()tetrmf totlmDr i i ( srurirpnu4omeelfcta( a2rr(root0tlt iicilsls umu s u) eenxr3oo1laD  n o;s t2toxrpoy1op emnesls a2rrx o;u1tex micilslaDemump;t)altoxo3iytomteliei (  etmxrpiu1ap e fvtlsfarrm(mp;u0olxomo3tatla2ul(vp;()trtrxrciadoa r i sls)t2um(r3ny1al nmnesat  2tm(r oo4tpxnif3tydlsDean s (0alermr3to1oat lieils)sexo(mpiy4lpen fvi (  2um(  no0aetoio3tyt m uanms;(0tetnmr3oa1fpDeaieol() exm(r nydol n ivia(fartm(r oo0oexnmfeils a rmumsnt)alxrxr3oodoa raies;() 2xmirpiy1lp   ivsatf 2ta(rpot4tee  o3iatlmDul(mp;t0 renirciatom r uvo t t2uoxr3iu1am nmici s) rrrxrp;o1olt moetlt m2em(vsnt4aetnircoo1fa  au o;t0t2umxr no1lleemfetat)aDta(  ;u1texomieiys m2umnms () lermrciy1la  aues;()s2uoxo3nudomtelfctat)s2uaum ;u1alen ictytla2ea( s;u0tleoxrcoa1omtr uvs;s t2toxrpny1llen ietas  2urxmo;t0texn ictasla em(mp;(4arxoio3iy1latr uvo;t s2tmio3ou4lm  mfvias)a2ua(  nu1alx ifeild sDumnmonu0aexrif3iodopDeln i s)trumimpou1oltemfesasf 2rr(r ;o0altoifeiysls ra( p;t0trtrif3ootla e neol(  2xmxopny4lpt lfcsas arurxmont0aeenmietldla2uanvpn(4aeenxo totopDelieo;()teto(m3oy1ol n feslsfsrua(rpot1tltn fetld m uau p;u)tlermo oadfpD lnes;s  eur(r oudllee fct (fa2rrxrpou4tpt moctltfm2umnms t4alxrmo3oadfatr ieol( trxrim3iudamtnmiet s)sDua(rono4aptoiocild mDrl(mo;t)arxnmf iytlp r ueol() rurxopoy4llen ivtasf Dtru p;t1optn fciasfa2emnms;u0tlxnircty1lptrlivolt  rxoxm3iy1lme lnci (f 2tmum ou1ole ioeiadlaDuluvsn()texnmf oadlaDelnes;(0trurxrpoy4ome  neiat srrax ont4ole  fctysls2rlu s;t0tetnio3oa1fptrai i;t)srxoxopiy4optn ietltf rtaumpnu0tlx mi3iydfsDumnmo;u4 ltrif3ta1omDrai s s0 2trxm oo4ale licslt)s2rrur ;t1oexnii3iad m ulnmpn() lenmr ta1lm rai ils0s2xo(o3nydopeelfviasfaDta( pou0tpe ii3tat sDulnmp;(0teeoio ootoptraieils0tetmirpno1oltelnvtatfartmx ont1olenmociyd sDua(vs t0 lxoifctodla eln slt) 2toiopiy1optelivsl()aDrmumo;o0opto fciytfmDumumo u4trtnmf to1fmDr uvslt)srxrir3oudlm elnvil()srtmx  ;o1tpen fetlt sDelnms;t0aeenmf todomD anesls) rxrxopoudapeemicsls) 2urxm ou0aet mfcildfaDumnvp;t)aetnif to1lpDelneilt0srtmxopio4ome  nvsls)artmxrpou0tpxnmociyd m em(mo t4arxoxr iadlateli i () ruo(r ny1amenmieil(fa2urxmonu1opt  ociasfsDrl(ms;t0texoio todoaDeauvsls)trur(rpiu1lm elncsatfaDumumpou4apeomoctatlmDeanvo;t)aetnif oodfaDe ivi;s0s2umxm iudal  liesl(fsDtmxr ;t4ape iociadlsDemnmp t0 eenxo to1fp rlivs t0setm(m3oydomt lfvias)arur( pno1teen fctydla2emumonu) exrio iodlmDe n i ( tetmir3ou1oltn icsls)arurump;t1opeoiiciatls ulumo t4alxrio ty1fpt an i;s0srtriopnudlleelnvil( s2trxrp;t0apt  ociyt m2eauvo (0arerif oadopDeaueilt0 euoxmpiy4lm   fctat sDuau p;o0tlxoiieias a2elu o;()tltrmr iadlp rau olt tetrim3iydllee nvs (  2rrxmo;u1tpx mociltfs2ua( snu)tltrxr iadop  ai s;(0s2xmir3oo4lpe mfviat)arrmu pnu1alt mfetasfs ul(mpnt4 ltoir3oydfptelnvs t0s2to(m oo4lp  mictl(fsrra(  nu0oetoif3tasfsDua( snt4artnir3ia1laDeluei;s trurio3iu1al  micsas a2umur ;t4oexnif3ildfs elnmsn(0aetrxr3oy1la eanvs;t)srxoxo oy4ol  mietls) rtm(rp;o0oleo oeiltlsDum(vs u4alxnio iodomD ai ols0tetr(o3iodomtnmivs s srum(  ot1opxnii3iydfsDua(mp u)tlenxr oadoat  ies;t) exrio3nu4ll nmfci tf Dumx pou0aexnifciydfs2ranmp;(0altomr totoptrln ols0srxrio iy4lp emnvsat)a2rruro;o1tlenmfcilsfa2rluvp () etomf3iadomDrln sls sruoxmpoodom   nvi t sDrmxrpou1teen fcilsfm uluvpnu4 renxfcoatom   n ol(  exoxr iydlptnlnvtatf Dtmxmpou4apto i3iytla2ea( s;u4 rtnif tadfmtrlu i (0 eurxrpny1ol n nvi t a2tmx p;u4opto f3ilt aDea(mpnt0trxnmo iy1la e ieo;s) exo(r no1olt livtat  Dtmumpno1tlxniieiadlm elnms u)trxoxfcoodlate i i;(0srtrio io4olt  iciasf Duaumo;t0tpe  octlsfm rlnmp u0areoxf iatlm  auvsl( setm(mpno4ap e fcslsf 2trxmpoo1tpto iciysfmDrlnvo u4trxnmo ootfm r ivilt s2urirpoy4lm n nes (fs2rmurpou0teto o3iltla2uanvo;t4 lxrircoadfpte nvs;()tetr(r oo4altelfvs s)arrm( pnt4open oeilt mDumnvo (4 etrmr oytopD  n i ( texm(m iu4omen fvs (fsrurx  ;o1aetoif3iydlm uanvsn()altnmf iadlaDe ueo;t  exoiopnudlmeelnct sfarurxmp;u4tltn o3tydfa2rm(mon(0texrioctytfpteaiesl(0 2tmxr3oydaptnmfeslt)aDtaum ot4teenmietlt m2ul(msn(4trenio tadoa r ues t  eurir iy4alen fctat  rrrum ;u4tpxomi3iatls2em( snu)arerir iotfm r nvs;t)texrio nu4apt mfvsls)a2tmum nu0texn o3iys a2uln ont0trenxo oydlateau i;t) etrxrpoodlm  lfcsas a2uaumo;o1aptnmf3tlt a elnvpnu4 eerxo3ta1om  auvs;s)s2toxopio1lpt mfvi (fsDtaumpou4oetoiociat s em(msnu4aeenmr3ty1lpteanvi;() rumim3ou1lpt mnes ()a2tm(moot0alt  fcils sDuln s t0trxnxf oo1opteanvs;t)tetmim3oodameemfvs sfa2tr(r ;o4aleo f3tatfs2emumsnt0tlenir ia1om rliesl(0t2uo(opiy1ome mfcsls) Dum(mont1oleomietydfm2ulumo;u)teerxociy1optelueo;s0setmirpoy1optn ivi (farurxm no0tlx mo3ils a el( o;u)trenmocoy1lptr nvi ()trtm(opoo1ope mncil(faDrrx pot1tpe  fciasfs2uluvs;t4texoif iy1oate i i () exo(m3oudol elncsa(fsruaumpot1aexnmo3tyslsDulumo (4tetnircoytfatrli ilt0seuo(r3io4lmtn fcilt)aDrm(rp;u1teeo ieiydfa eauvo u)trxnmr3iydfptrlnes;() rxr(mpiu4amtemnvi ( a2ua( p;o0oeto fciltfm2rlums;(0tlenxr ootlmt anvs;t0t2xrim oudome  ietat srtrxroou1opeo ieiatls2rl(vo u)aeeomrcoatopDrlu sls0 rtm(opiy4lpt livt t a2raur nu4tpenio3taslsDra(mo ()trxomo3ta1opDeln o t0 rtrir3nudope mfei ( a2raur ot0teeo f3ildlaDuau p ()alerifciadop rlivo ()seumxo nodlmt lfetl(f Dumxmonu1opx  i3ild s emn snu0teeoio totfateli o;s)trumim oydol nmfciasf 2um(r ;o0tpe  oeilsla ra( o;u4 lenxo totfptraivs s0 rxo(r3iu1oleelnvia()aruauroot0oex ii3tltfm2umnmont)tltnxo iodoa eaivo;s0trxmio ny1lltn fvs t a2raxm oo1tpxo fcildlsDrau o;u)tetoxrcoo1oa   n s;t  2toim nodop nlivtas) rumumpnt1tlxnii3tas sDea( snt) rxnioctytopDean s t0t2xmxo3no4ape livil(  Dtaumoot0oee micilsfs em(vp t)texrircoy1fmteli o;t) exmxrpnu1olt  ieia()sDuaxrpnt4oexo ieildlm uluvsnu4tetrirctatoatr uvs (0trxrxm3oudamt  ivsatf 2tm( ont0aex miciyt m eauvs;u0areoifciy1optrai s t0sruoio iu4ap  mnctatfa2rauro;o0altniicild a um(vont4tltnif3oydopD auvilt teurio iy4omtelivils  rur(mo;t0tpx mfeild sDulnmon(4tltnxr3iotlpDr uvi;t)trur(m3io4om nlnesatfsrrm(m ;o0olto iciasfsDumnvs () exnxf iytlp ranvol( sexmio3ny1apen fvsltfa2uaurpnt0opxn oetld sDrln snu0 rtnio3to1omDeluei s0s2xmio oy4lm nmncsa(  rum(m oo4tlen ictadlaDrmu o;u)treomr todoaD li s;( t2xoxmpny1lle mics tfsDrruront1olx  i3ilsfm rlumo;u4tleomo iatlmtrlnvs;(0srtrirpnu1apt mfct ()aDrmx  no4ope mi3tadfs umnvo;t0 rxomocoy1op e nes;t)texoir iu4amt  ies sf 2ur(rooo4tlxnmociadfmDea(vp;u)alxrir oydla rlivi t  exoxmpoodom   fctat s2rau poo1oee  o3iytlaDrl( s;t0 etnxo3ia1latean o t trtoir3iu4lp  lfvsasfs2uaumooo4tltoif3iaslsDrlnmo;u0aeeoxr3tatfa  aivols  rtoxopnydopt lieilt  2umuro;u0apto fctldfsDea(mo;(0altrxf tatopDelu i (0s2xm(o3iy1ape lnvi t)s2um(mp;o0tlx ifeiys aDeanms;t)tetrircoy1fm r ueols seum(m ou1ope mnvi (f Drru pot1oleo octas s2rmnms (4aexnmf oydoaDelneo;s  rtr(mpiy4apeemfetasfsrurumonu0tex  iciysfs2ul(msnt4aleoxr totfa rau s s seur(r3nodale livt tf rtr(  ou0altn iciydfa elnmp;t0 ltrxr3iadomtraivolt)s2urxr3oydole mfcs t  Drr(ro;t0openmoeiltfa2ulu on(4 etrmfciodop raivi t) rurxm nu4al n nei s aDtauront1optn feildfs rmuvsnt4arxnxf3oatfm  auesl( t2toxr3ou4ol e iei sfs2umu ono0tlx mociysla2rau snt0texnirctatfm   ivo s  2xo(m nodome  netlsfaDuau oot0aexomfeiytla ran s t0trxnmo iotfpDr uvsls0teuoxrpno1ap   nctls)s2tr(mo;o0tee iieiysfm eauvo (4altomf3tadom rai ilt0 rxoxrpnu1omeemnvt ()srtm(  ;u1oeeomfciasls rmu o u) lxoio oa1oa  aivs;(  rtoxo ou4omenlnvtat)srtr(root4tlxomociadfa2rauvpnt4 eeoxo ta1omDeauvs () 2uoir nodaltn fet (f 2rauro;u1alt moctytfs2rl( s;(0aexnxfciytoa elnvo s0 rtm(m3nydlltelictls sDraxr nu4ope mietltlmDrlnvsnt)teerif3oytfaDeanvi;s0s2xrxm iudlmen neslt) 2umxmont1tle mf3tyd m2rm(vs;t0arxomo3iodlm r n s;s) 2xmxrpnu1ale lfvtat artm(rpno0aex  feiyt s emumo u4aetrif oy1opDelnvo;(0tetmxo3iydlm  mfetlt  2raxro;o0ape miciltfm2rlnvo;t)trenxo oadfp   neslt sexoxopiu1apte fviltfartau oot1alx mo3iytfs2emuvont)tetrxoctotomD aneils0sruoxr3iy4apenlnvs s a2tm(ronu0ale  feiadlsDelump;t4tltrmfcto1oaD lieslt texo(opiu1altemfcs tfs2rrxm nu1optomfciatlm uau snt)arxomrcoo1lpt luvi;t  ruoxo3nu1lmeelfvi t)sDrmx o;o1aex ifciydfa2um(vs (0trtnxocoa1om elivs t)s2uoxm3iu4lmt lncsl( srrrxrooo1tex ifctysfm2rm(vo;(0 rtnmf3iytom rau s;() 2xmio3iy1ole livs sfs2raxm nu1alxo i3ildlmDuau snt4aexomf3iydfpteai i;t)srxr(o3ou4op emiei ( s2uaur nu0tetnifetld s rluvo t4 lxrxociadfm eluvi t0 2xoiopoodlpt  iciatfs2trxronu1aleoio3tytla uanvpnu) exrmf iydom rauvo ( srtoxo3oy1lme  fetl(  rtaur nu1altnmoctasfm umnvp;(4aexnxf3ootoaDeaneilt  euoio3oo4lmt lfcil( aDtaxrpot4tlt ifeilsfa ulnvs;u)tlenmocio1lm rlnei t0sexo(m3iu1apenlnei t)arrm(  ;o1openmoctasfs2emuvs t0artnmf3oodomtrlieolt)texoxmpoo1omen ncil(  2umxmono4tpe  ieilsfm ulu s;()arxomo iotfaDeaivilt trxrxo ou4lmtelnvilsf rra(mpno1ale iociyd m2em( snu0teeomo3oa1fm  ln i;t0 2um(m3oudllt lfcslt)aDrmu  no4oeenmfeiltlm el( snt)trtrir3ia1fatrlnvs s0t2urim3ny4ap emietat sDtau pot4tlxnmf3tys a rln p;(0arxnir iytopDranes () etriopoy1ole  nvsls)srraumo;o4tltn f3tld s rlnmo;t)tlenxrcia1opDelivi;s)t2toxo3iu1apte fvsl(fs2urumooo1oexnmieiltls2eln p t4texnircoy1faDelu s;s  2uriopiu4aptelfvt s  2ra( poo4opto fciytfmDemn o;t4 rxnxo ootom ranes;(  2xrir3ny1apenlnvt s aDuaum no1openmo3ildlaDulnvo u)tltrxo3iydfa eai slt0 2to(o3nudame mnet s srtaumpnu1tlxo oetld sDua(mp ()altnmrcia1lp  aivil( sexoxr3iu4amtemnvsatfs2ur(ront1opxn ocias m2emumo (4tlenxf3oytlmD aieo t0teurxr ny1ope mfcs (fsDraxrpot4aee ii3ias m2ul(mo u0aexnmf3tadla e nei;t) rto(r3iy1om  lfcil( sDrru poo4opxnmf3iltlaDrlu o (4trtrifctatlm rlies t0t2um(rpno1apeelicsa(fs2trx p;o0oetniieiltlm2ul(mo () etoio3iodfatr i s (0srxr(r3nudap e ivsa(  2tmx p;u1oeto o3iysfm ulnmon(0 lxnxr3tadlptelies s) euo(o3iu1op emiet (fs2raurooo0aeeomo3iys sDulnmo t) lxomr iy1opD  i s;() euo(o io4amt  fetls  2ua(r ou0oeen o3iysla2uau o;u)artnmociy1laDrlu o;() ruoxo iydop emivtlt  2ur(m ;u4aex moctatlmDulump ()aetrxfcoatlaD ai i s  2toxm io1alte ictat)aruau pnu1tee mf3tytla2rlnvs;t0tlenmf iatlmD lnvo s t2xoxo3ou4optnlncsa(f rtm(  oo4optnmiciltlaDulump t4treoxo ootfmtrauei;(0t2um(opoodopte icsa(f 2tmu oot1tpe ifciaslm em(vp u)tlxoircty1lpt  nvo;( s2ur(rpoy4omenlfeils) rraxr ;u1tlx  oeiytfm2uau s t) rtomfcio1oat  n s (0srxr(rpiudap   netlt) Dumur ;u1tex moctad s2raump t)texrircio1fmt  nvi;()srxoimpoo1optn fvil( a2tm(r ;o0aptnmictlsfs2ul(ms;t0aetrxrctatlatr neo;(0srurxm3oodol n ncsatf 2um(mooo1olxomiciadlm ranvsnu) etrmf3ootoatrlueolt)t2xrim oodal nlivsat a2tmx  nu1apx ioctltlaDrau s u0 etoir3iotopDraueo;s sexmir io4lm nlics ()srum(rp;o0tpxomoctltfm rm(mp;u) lxnmo todom eli i;t)s2xmim oy4ape  ieta(  rra(rpoo1oexnmoeiytls ulnvo;(0trxrir3ta1faDeln ils0srtm(r3io4lmenlncil()aDumump;o1tlto i3iyd a2ra( o;t4aexoxfcoatlmD lnvi s sruoxm oudoleemfvias aDurump;t1opeo fetat sDulu o;u4 leomf oodoaD li s s)srxr(m nudlm e nctlt) rururpnt4altoii3iadla uanvp t0 reoxo3iodfpDrlivo;t  rxrxm ou1amt lics t  Dtaxm ot4aeen o3tysls2ul(mo (4 rtoio3oydfa eai s s  rur(rpoo1lmtnmiciasfsruaxront0oltn fciat m umnvsn()texoio3to1latr ieo s0srxm(r ny4olenlfvsas)srta(rpnt0oeenioeilsfs rlu o;t) rtrxo oy1fp raueilt0setoim3nu4lmtn ieilsfsrtrx  ;t0tlen o3ildfm2emn p t4trxnxf ty1oaDrlieol(0srtrxr io1aptnmivsl(farum(r nu1aetn ociytfm2um(mpnt)trtrio todlmt lnesl(0sexmxo3oudalt  ivt s  2ururp;t1tleo oeiyt a ranmpnt4 rxrxocoydfate uvsls)setriopou1opt mivils  Drrur ot4teen ieiyd aDumu s;u4altnxrcoa1op   ivi;(0trxrxo3ny1omte iesl() rra( oou1aex mo3tls sDua( o t4aetoxf3ta1fmD  iesls)s2xrxo3no4ap nmivsas aDuaxrono0olto ieiytfmDulnvo;u)tleomr3tadop elueol() ruoxo no1lm nmictatf 2taurpou4texo fciat m2ua(vo;t4alermo3io1lm elieo;t)seum(r iu1lltnmfeilsfsDta(  ot0oet mo3iyd s2rlnms;t4 rtrmrcoytoaDranes;(0s2uoir3no1omtn nvt tf ruau o;o4apxnioetatlmDum(vo t4 etoif3iytfaD  neols0trtoxm iu4om nlfes s) 2rau o;o0opxnmfciadfs uaump;t0aexrif3iatla rli s;s)tetmxo3ny1om elieil()a2tmxmoot1alenifctasfa umnvonu4arxoif tytfp ran i;(0 etoxmpny1omeemfvt s) 2umx pnu0tlenio3ils aDulnmp;u4 rxomo3iadfpD livo;s)s2xo(opiudole  nes s) rtmx pno0tpxnmiciadfsDraump u0trxrxocto1lmDeluvi t0 rtoir oo4lmtnmieilsfsDrmuront0ape mocilslmDua( o (4 eermo3tadfp eaivs;s)seum(mpoy1al   ivil(  rraxrpoo4ole  f3tyt s ua(vs (0 exomo3oytfmte n i s sexmirpnu4lptelfvsl(fsDumurpnt4aptn oeias mDul( o;(4 rtoio3iytlaDrlies t)srtoxo oy1lm   neilt)arraxmp;o1tetoiicias m ua( p (4teenioctytfpD li ol(0trumir3nodap  mfvs s)sDrmu p;o4tpx  fciadfm umnmp (4trxoifctotoaDr u i s)srtr(mpoy4lme lnei s  Duau ont1tpt  o3ilslmDulnvs;u0arxrio3ta1lmDrauvo;t)t2umirpnu4al nmneia( srrmu oot1opx  oeildla2eaumont4teerifcoadlp   ies;t0 euoxm3io4lm nlfeil() rtmumpoo1oleo f3iadlm rl(ms;()alxoxr3ta1opt lnvo (0trurir3ou4lm   ietat arrmuro;u0altnmfctys s el(vsnt4arxrmr iytopteluei;t)s2uoxm3oo1lmtn ictl()srrrxm ou0olxo ieild a umuvs t)alxrmo oo1opD  i ol()trumir3oy4lpee fetatfs2um(roou1altnmf3tadfm2uln p;(4tetrif tytfp r ueo;(  ruo(mpnu4apeelfvsl(  rta(mpnu4alt iocias aDra(vpn(0tetrxr to1fatrln sl( t2xo(rpou4opee fvsls)sDra(m ou0tptomfciasfm2el(vo t0aexoxo3ta1lmtrlnvils0t2um(opiudoltnmics s)srtrx o;o4tpe moetlsla2rm( on(0 leoif3tytop e u i;s0t2uoim oy1lpt licsls)s2rrxr nu1oex ifctld m2ra(vp;u) lxrifcoa1lpt lu s () rxrim3nydll   nvsa( s2umxm ;u4oexnmociyt s2elnvsn(4aexrircto1fa rln o t t2xmir3oy1amtemfes ( arumuro;u1aetomf3iydfm2umnvsnu) exnxo3ta1fmteauvols texo(o3iudlptelfei t arua(  ;o4tpt  ictlsla2uan sn(4trtnif oatopD anvo;s seur(o3nodap   ivsat)aruau pno4tlxniociadfmDra(msnt0 leomocty1lateauvol( teuoim oudll  licias aDta(mont4oleoifciysfmDuanmo;t4altoxr oo1fmte ivs;s)sexoxrpio4optn fvslsfa2rr( ont0aee  o3iad sDul( o;t4aetomr todlatrli o;t tetr(opoo4ap emfcsatf 2uaxro;o0tptomfetls s em( sn(4 renif3tadla eaiei;t0trum(o3iudole mnciat s2tm( p;o1tltniiciadla2em(mp;t0 etnif3iy1fa   iesl(0srxoio iodll n fesasfa2raxr ;t1oleo f3ilt s eaums;u4 eenxr oatlpD  ueo;(0teuoxopnu1lmte fet t)aDrm( ooo0tpenioeiatfsDul(vs;t0tltoxocoy1lm ranvs;s)srtoxrpoodll nmieiatf ruru  oo1olxniociadfa2em(msnu0aexnxocia1fa  luvo;(0tetmiopnu4apee ivta() 2tmx p;t1optomfeiatfaDelump (0trxrmoctotomD lu i;s  2trxopiy1lm n fctl(  2rmumo;u1alen feiadfm2ulu snt) exrmo3iytfaD  u s () rxmio iydalte nes tfs2ua(m nu1tpe  o3iysls2rluvs;u0altnmf tatfateanvo () etr(mpoodap n nesas sDtr(  ;t1alto oetad mDrl(mont)tlenxrcoydlpDranei t0 2trxo iu4optemnvi s) Dumumpoo4optomi3tlsfs2el( s u)arxomo3io1oat  iei;()trto(m3ny1am emneilt)a2rm(m ot1oltoiietatlmDuau o ()tlxnmrcoatlpt  i o t)srtrxr oydalen fvi t aDuau oot1apenmictat m rlnvsnu4 eerxfciadoptr uvs s0 euoio iy4opt livias) 2rru  ot1apxnmoeilt s2rauvs u4arenxo3oo1la e ies s0 2xo(r3oy4op emictl(fa2uaxmp;u4tlx iietadlaDuln o;t0 lxomf oodlmD aies t  2xr(opoo4ll nmiei tf 2uaumpoo1tpt  f3iat s2elumo t)aleomr3oodomDeai i t  eurxo3oudalen nvsasf Dumxmpnt1tle  feiatla2ulnvp u)tetrifcoo1lpte iei () rurirpno1ol   nci t)arrm( pnu1altnmietysfm2emums;t) etrxociadfa   uesl(  eurxr3iy1lpe lfeil(fa2rr(r ;t0apto ocildlsDrauvo;t4tleoxf3todlmtrlnvol()s2toir oy1ll nmieiltf 2rmum oo1tee ifciyd aDuau onu4 reomr oy1lm e i o;s  rxr(r3oo4omen icils) 2uru p;t1opeomfciydfa2rlnms;u)trtrmf io1omte nvs;s)texmio3nudlmeemieta()s2umu ont4opxnmfeiytlm emn snu4aleoif3oytlaDran i ()s2uoir nu1olen neiatf 2ua(mpoo1oex mo3ilt s rm(msnu)artnxo3iy1lpDeaueo t s2umim nydapt mnei (  ruax pnt1opx iictytls ul( onu)tleriocto1oa elueol( s2trxopnu4op n ict sf rum( ono4oeenmf3iatlm rlu snt)aexnxfcoo1oat  ivolt tetoxo3oy1ameelivsasf rrm(  ;o4altnii3iltfs2umuvs;()trxriocoadfatraneilt sexoxm3nodopt mfvsas  2trxr ou1tpt io3tys s umn o;(4 lxnir oodopDe iei;s s2toim oudoptemnvslt) Drr(rp;t4ope  oeilsla2emnmpnt)tltrmocoy1lp eauvi;s t2tmir nudal elneslsf Dum(m no1alenio3iatfm2elump;t4 lenmfctydlm e i ils0sexoxopny4lmen ictlsf Dum(mpno4olx mfciys sDrl(mo;()aetrmociy1lp  li olt)trxoxm ou4am nlncslsfa2tmu  ot4olenifeiltfa ea(mont0altoif oatoateli o;s0t2tmirpiu4alenlnvtlt a2raum no4apeoif3tad m2ul(vs (0 rtoir3iytfpDeaies;s)sruoir3iy1al emncs sfsrrmxrono4oltnmfeils a2rlu s u4texoxfctadlmtelu o;s)t2um(m iudol nmfvtl( s2um( o;t4aexoiicilslm rm(mp;u4tlxomocoo1oaD lu sl(  2uoxopiu4ol elfciltfartauro;o1tle  i3iltls2rmumonu0 leomf iodfaDraivsls)texmxrpio4apt mivi sfsrrr(mo;u4aetniociysls eanmo t) lenmo io1fa  aies;(0srxmir oy1om  lfesa(fs2raurono4oeeoioeilslm2eanmpnu)alxnif3iydoatr nvols) rtmxr nu4ap e ncsas)sDtaur ;t0tpeoifetldfmDra( s t0tlerio3oy1oa  an s;s)t2tmxmpiy1op   fci ()sDtrx  oo0apen ocildls rln p;(4areoio iydlat li slt0 rxm(r oy1ap nmfei ()srrrx pno0tee  icildfsDrl(vp ()teerif iadlmD  i s;s  exo(r nu1om e fcsl(  rtrur no0olx ifciasfs2el(vpnt) lxomo todomD  u o;( setoio iy1amtelfvslt) 2ta( o;t1tpxomfeiasls elu on(0tlenif oydoptrlueslt setm(rpiudopenlivi (  rraxrpnt4olto o3iydlmDrl(vp (0trtoir iadlmDrau i s0 euoir ou1lle mfvsat a2umxr nu0aetn ociasla2umn s;u0tltrxf oo1fat  i i s) 2um(r3iodom  lfeil() Dtmxm ot1tlx  i3iytfa2ua(mon(0 ltnxo3iatfaDran olt)srtrim3iodome mfctl()sDur(root0aexomiciad s2rlu on(0tetnmo3oydfat anvilt0trur(mpnodom n fctas) Dtr(ro;t0alxoiociys mDumuvonu4tetnircto1lpt auei s t2umxr3oudam   nct t)aDtmu  ;o1tptomoeild m rl(vs;(4tlxnxf totfpDrlu ol( s2trxmpiodlpen neil(fa2rrxro;o1oet io3iyd s ra(vonu)alxoxocoytlpDeai s;t  rtm(r3oydomenmnviat)s2raxmooo4apxomieiysfa2umumo u) reoxf3iotoa raivsls)s2to(o iodop   ivil(fa2trx  oo1tex moctasfmDra(mont0 lenxoctatopt  u ol(0 rxrim3oo1omeelietlt srrmu  ou0alto fetlt s em(ms;t) lxnircoydlmteai o;s trtrxm ny4lptn feil() 2umxm nu0alxoioetlsla rl(vonu) lxnmf oy1oat liesls sexr(m oy1am n fvta(f Dtr(m oo4opx iieiadfmDraums;t4aeeoxocoydfm r neils0texoxopio4lm   ieilt  2ta(  ;o4oexnif3ils s rmuvs;t) eenmfcty1oa  aieslt)trtmxmpnodlmenmieiat)s2rm(m nt0tpe  octyd a uau p;(4tetoxfciy1lpDeaneo;t0t2xrxm3oo4lpe  ncsls)srurxrpnt0alen i3iat mDrl(msnt0 rxrmr oa1oa  anvols0 exmxrpiy1ll e feiat)aDtr(rpno0optomo3iaslmDrau o;u)tltniocoodlm rlivs t srtmir nudamtemfeslt  Duaum nu1tle iictat sDumu o;t)trxnmf oytfmDrlu o s) 2xoxrpiu1ape lfet t)sDurxmpnu1aleo feiysfsDeaump;u4trtomo3oo1fm raivi;t tetriopoydlltnmnvta() Dtmx pou0optnmoeiydfaDranvs;t4alenmocio1lpD  ues;( t2xoim3no1llt mfeta() Dtmumont4oexoifeiasls2rlnvonu0tetoir todla  au ols setoxm iudlm  lnci t aDuaxront1aee ifeilslaDemuvs;t)tetrxo iatfa  au s s) 2urir3iydalte fvs t sDraurpou4aetn ieils a eanmon()aeermfcoo1oaDrlu s s0srurio oo4lmtnlfvi tfsrumx ont0aptn o3iat a2emn pnu0tetrmr ia1fmteau i;() 2umimpoydamt  ici sfs2rrxro;o0ope if3iadla2rlumpn(0aexnmo oa1lmDeaies s0s2trir3oy4al nmivt ( aDtrumooo1aetoiictltfaDrlnvs (4alxnxr ia1fptrlivs;(0srtrxm io1llen iei (  2uaxrpoo1oex moetadfm ean p;u4 etoxo3ta1fptranvs;s)t2xoirpoy4ap nmfvtlt artm(mo;t4tlx mi3iatfaDel(ms;t)altrioctytfa rlivs;(  exrimpiodlpenlfeta(f 2trxrp;u0oee  ieilt aDrluvs;u0alermf3oatopDean olt)tetoimpiy1ap elnct s aDuau p;t0teen feild s rluvp;u0aeeomr3iytom   n i t)sruoio3oo1altnmfet t)sruru pno0olxnmfeiyt sDra( snu4aeenir iatop r u o;()t2xmxrpiu1altn fcs tfarra(moou0aet  f3iaslm el(mo t4alenmf tadlm r ueilt0 eumiopiy4ome mivi t  rumxmo;t0apx if3tytfsDumu pnu)aleoif oydlmDr i sls0srxm(opoo4alt mncs t sDrau  no0aetnii3tltla2ean p u4artnxo iytom r i o t)t2xmxr ou4alenmivt ( aDta(mo;t0aexomfeiydlsDra( p;t4tlxrmr tadlm e n i;s)seumio3oy1ome lietlsf 2urxr nt4teen feiaslm eln s t4trxrmrctodoatelues;s) rxr(opny4olenlfctl(farrmx pnt4aexn oeiyslaDeauvs ()treomo todoa r n sl(0 rurxr ou1ap   nvsa()aDtrxrpnu4tpxoif3iaslaDeanvp;t4trxnirciydoatrau ols  exoir iu4lmeelfct (f 2umxrpnt0ale mo3tldlsDua( s;t4 lxrxr3tydfpte ivsl() 2tr(rpoodom  lics ( srum(r oo4ope ifciydlm rluvo;(0artoxf3oytfpD  nvs;t srtrxrpnudlpeelicsat  2trxrpoo0oetoiiciltla2umuvo t0 etnxo oytfmteln i t setr(rpio4lmtelncia(f 2rau ooo0ole mo3tad sDuluvsnu0aeeomoctodlat luvo;s)trxoxr io4ameemneilt  Dumu o;o1oltomoetyt m2umuvsn(0altnir3oadlptranvslt  rtrirpiydap n ieil()s2urxmo;t0optniiciaslmDra(mp;u)alxnmr3oadfp rln o;(0teuoxo io4lpt mfct ( aDuaxm no0teeo ictatla2rlump (0tlenxrciydop eluvs;s0setoiopoo1lptn fvs tfsDua(rooo1alx ii3tldlaDemu s;t0alenmo3iadoaD  u sls texrim3ou1aleelnciltfsDtr( p;o0oleo i3tadfm rau snt4 exomfciadfat  ues s  rtrim oodop nmiciat srrmxr ou0aleo oeiasfaDra(vp u4artnxoctodfmDelneslt0s2xoxr3nu4lpte ivias a2urumonu4texomieiys m2el(vpn(4 lenxrciodfmD anvi s0 eur(r3iodlltnlnesls)s2tr(rp;t4tpxoiictat m rluvo;(0tlxrif io1fa elueol(  rum(m iy1ll nmiet t a2rrx  ;u4aptoio3iyd m2emu p t4arxoxo3oadfm   ieo s0srumir3iudape  icil( aDrmx o;o4tpxnii3iad mDua(msn()arenif3oadfa  anvi;() euo(m nodapt  fciatfsrur(  oo4alt mi3iatfmDran pnt) ltnmfciydfaDrai s;t tetr(m3iu4lm  mfvtas)s2ra( o;o1apxomi3taslaDulnmsnu) ltrif3oodomDraivs s)seur(r no1amt mnesa( sDuaxrpno4tltnmo3iat m rmuvpnu4aeerif to1fat an sl()teum(opio4ll emnet s s2urur ;u1oltnmfcils s2umuvp;t0aleoifctodlmtrlnvo t0 2um(o iudal  livi (fsDumxm ;t1tlto feiad a2ulu s u0 eermr3oa1fatelu s t) rtoir iu4ol e iesl( s2rrx ooo0altoioeildlm2rmn o;u4tltrxr oa1fm rli o t srxmxo nodlp e fet () rurumono0tltnmoeiyt s rm( p;u)altoio iy1fpDe uvi;s)trxoxo oy1aptnmfcs s  rtmxmp;u0tlxnio3iadla2ranmo (0 rtnmo oatom eaivo;t t2ur(rpnudal nmfvils)aDrrxmp;o1apxnmfeiyd m rmuvs;t0tlermfctadoa e uvslt0 etm(mpoydal emivta()aDtmurp;u0apxomfeiysfaDrmnmont) eeoxrcio1omDr n o;s) 2uoiopoy4ol emfcta()arum(mono1aexomociasfm2rl( s;(0aeenif3to1lmDeanes s) etoxo3ou1om e fcs t) 2rm(mpoo0aexniiciyd mDel(vo;u) lxnif iy1fatrlnvs s) rumxr3io1lpt  neils a2rmxr nt4tlx mfeiysfm2el(vonu4tlxrxo tydfm elnesls0s2tm(rpno4ale  nci tf Dumxr ;o0ole ifctydfsDuanvsnt4aeeomf3tydla  aueilt)seumxr oo4lptnlfci ()a2ra(m ot1oetnifciyt mDemnvp t4arxnif3iy1fmt an i;()s2uoxm3no4op e fcilt srtmur no0aeenmoetasfa2um(vs;t4aetrmfcoa1fpt au i ( srumxm nydopeeliet t  Dtax p;t4optoif3tydfm2eluvp;u4 rxoxo iadfmt lneo s teto(m3io1aptnlivil(f rur( oot1aetnmf3iysls ranvs (4 rxnmf iodlat auvs s)srtmxo iy4am e iet sfs2tr(ro;o0alx  ieiydlmDeluvp;t)tleomo ty1lpt lnvolt seuo(r3io1amtnmieta()a2ua( pot1tlx  i3iysfs emuvs;u0teenxf iatop eauvs;t s2xmim3nu4lp   fvi ()a2trxm ou1olxomiciyd a ulnmp;t4texnifciatfa  auvo;s)t2xrxmpoydopeelnet tfsrur( poo0apto fciasfmDul(ms;t0 etoxr tatlaDran o;s t2toxopoy1lp elfcils a2rmxrp;u0tltoii3ilsls2el(vs;u) rtomo3tatla rai ils0texm(m oo1ol elivia(fa2rr(r ;t4oeeniieiytfm2emn o;(0 lenirciadlp  li o s)t2tmxopoo4llt lncs t) Dtru p;u0tleo ietytlmDrm( p u)arxnxr oa1fpteau sl(0 2toxrpiu1lp e nesa()a2umxrp;t4olenif3iasfm eanvsnt0trenio3iydfm   neo t s2xm(m iu4amtelicta()aDumx  oo0tpx  o3tysfm2ua( s;t4artnxr iatlmtrlnvs;s0 rxmxm nodlmtn nvi ( aDrrurpot0opxomoeiysls2uan s t4aeenmfcoo1faDelnvil()srxo(o3io1om n fcil( s2tmxmoou4opto ictatfa rln pnt4 leoxr3tytfmDe ieolt) 2trxm3io1ale  ivtls arumu  ou4aetn ociysls2rmu p;t)artomr3iy1lat au ilt0seuoxm3oo1ope  netl(farrmu pou0tpt  octaslsDrlu s (4tlxrio ia1opDeluvs;s  2toio3oy4ope  fvi (  rrrumpnt4texnifeiyd aDrm(vp;(0aetomf io1oaDranvils) exoio3no1omt mnviatfarrmu  ou0aetnmf3iys a2rmu s;t0 etrxfctodlaD auvi;t0s2umxm3iodal nmnvi t) 2umx o;t4olt if3iytfa2ulu s;(4areoxo ta1lm elnei s srtm(r3no1ope lfciat) rumu  nt1tee mieiasls2eanmpnt4trenmrcoatfmteluvi;s)s2umxm iy1lptnliesas)a2tm(m ;t1opxomicild mDumn p;(0tleoxrcoa1lmDr neo;()trxr(r3iu4lmtemieils aDua(  nt4teeo iciltfaDrluvp u) leoif3ty1oaDeai ol(  2ur(r iy4lm  lnvtls)sDua(  oo0ope iietasfs2ra( pnt4aeerir iodlptr i i;s trto(mpnydomt  fei ()sDrrxrp;u4oeto fctasfs rl(ms t0artnio oa1op eauvo ( seto(r oydop n ies tfs2trx  ;u0alxn ieiasfa umn snt)trtrxfcoy1fpt  ueils0s2xmxr3oudapt mietl()sDtm(mp;o4oeenmi3ildfmDelu pn() renioctatlpDraueo ()truoirpoo1lptemncsa() 2trxmooo4alto i3tytfs2rm(vo;t)arxnifcto1fm  anvi;t)srurxr3nodlpee ictl()arra(m ;u0aptomfeildfa2rl(mp u) rtrmr3iytomD li o (  etm(r3nodlle micsasfa2taum ot4aet  o3iad m ulnmsn(0aeerxf3iy1fa eli i t0seuoxrpnodap e fvta( s2trurp;o1opxoifetad mDrlnvo (4tlenxrciotfmDeau o;(  2umir3oo1ol elics ( aDurx oou4aetoio3tatls2emn o u)trtnif3totopte nes () 2urxo nydamtnmfci t)s2rru o;u1oeeomfctyt mDean p u0 ltomr3oa1lm eaneolt  2urio iu4al emnetas)sDrmurono1alt mi3iatfsDem( s u0alxrifciatomDeaieol(0 2ur(o3nydame  fcilt)arurur no1apxniiciyd s rmnvp;t)tlxrio3tydla  lieols) rxr(r3iu4am  mfvta( sDrmxmpnt0opt  ieiyd mDrauvon()tetnifctotlmD anvsls)s2xoxm oo1al  lfeias)aruaumpoo1ape io3ilsfaDeau s;(0trxnircoa1lm   n i;s0s2um(o oy4opeelivt ( s2um(m ou0tetomoeiltls raump;u4tlenxr oadfmDraueol(0teuoiopno4oltnlfetl() rtmum nt1ole if3tyd m ea(von(4aleomo3oo1fate iei t t2xrxopiy4apt miet t a2um(  ou1olxo f3taslm2eauvo t0aetrmfciytfat  n i;t)t2toxm oo1optnmfetas srumx o;t0tlxnmfciyd mDeaumo;u4trtnif oo1oaDeaieo t seuoxm3no1al e nvtat srtmxmoot0apen o3tld a ea( snu0texomr ootfm r ivs;t0trur(o3nu4lm n fcsas) 2rmxro;u1opxn feiyd s uanmo;t0 rtrxr iytomDeauesls  ruo(r3iu4apenmnctas)aruauronu1tex mictld mDrlnms;()tlxomfcty1lmD anvsl( sexmim oo4lptnlies s)a2rauro;o1oltomfciatla2ea(vp t) rtnxf iadfm  luvo t)tetoiopnu4apeemfctas artaumpot0teto oeiytls2emn snt0 rtnxrcio1omt  ivsl(0s2xo(o3oudlm  lnvils sDtm(r nu1tet  o3iasla2ulnmp;u) reoxociatlaDe uvslt srtoio oydllee fctl(f rur(mp;o4tptn o3ias m ea( o t4texrmr tatfmD aivi s  exoxr3nodomtemictas)a2raumpno4opeomf3iydlmDea(mp;t)trxnmr iadomt auesl(0trurio ou1lpenmies ( arra(mono0optnmf3iat mDrlumont4alxrxo3iy1late neil()setr(mpiy1lm  mfvsas  rrrx pnt4oltnioeiadlaDumn s (0 renmfciadlaD lueil() 2umxm io4lmtelnci t s2uaxr nu0apeo fetadfs2umnmo;t0trxnirciodlpt  nvi s)texrxopiy1olt lfvsa(fa2tmu p;t0tpe mi3tydlm2ul(ms;t0teeomo iy1oa eluvils s2toxo iydllen icsl(  2tmu p;t1aetnio3tytfm um(mpnt0 etnxf oo1faDrlivo;(0tetrirpnu1omtnmies ()srraumpot1oee mi3ild sDul( s;t)areoxf tytfatrln i;s0 rur(mpny4al  livi s sDtax p;t0tlen f3tasfm2rluvo;(0 rerio iy1fa eln il(0s2toimpou4llt lfciltfsrururpou4olxoiociyslm2emn s;u)aetrmf iytopDelu o;(  eurxr3io4om emnvtasfa2ur(m ou4oetomfetydfs2umumont4 eeomf oatoaDe i i (0s2urxopnu1apeelivsas a2taxr ;t4aetomfeiat s2uaump (0 rtrio ty1opD  n s;t)t2ur(o3oy4ape  ieslsfaDur(mpnu0aptn i3tysls2em(ms u) lxoxo3tatfpDeau il( srurxopoy4llte icta(farum(rpnu1aexomi3ilsfs2rmn sn(0tltoxr oytlpDraueolt  2tr(r oo4op elfvia(farrr(rpnu1tpeoio3iysfm el( p;t)tltoxf3iatfptrluvi;t) etmxopiudlmeelfcs t) 2raum ou0teeo f3iadfm2rauvo;(4tltnxo3iadopD lnei;(0setrim3ny4amenmfcta(f 2ra(r ou1apx iociadla umnvsnt4altnmocoadlatr u s;s s2trir oodapen ivtas  2urump;o0aptnmoetlt a emu p;u) eerif3oy1oaDr uvs;s0s2tm(o nu1ll  lnctlt)s2ua(monu0apeo fciadla2ua(mo t)arxnirciy1faD an s;t0 euoxr iu1lpte ict t)a2rm(  oo4aee  feiyslsDrmnvo u4trxrxf3iadfptrli ols)t2toxmpou1omenliciat aDururooo1texo i3tadlm2uan sn(0aexrmr3iydom elu o;t)srxo(m3oo1lmtemfvsa( s2tr( o;o1oetoii3tadlm2umu o t0 lxnxf tatlp   u o t0sruoxm oy4lp  mivia( sDtrurpoo0oexnifeiysfa2rln s;(4arermr ia1lm e ueils0srtm(o3nodopee fvsat)srum( pnu1oltnifeilt aDum(ms;u4 etoif oadfaDelnvo ( srxrxr3iudol  licsltfaDrmxr nu4oex  ietadfaDemuvsn(0tlxoif3oydlpDe u ils0s2xrxm no4altemfcta(fa2uru  ou4aex if3iydlsDua(ms;()tlxnmo3oydlmD livi t)sexmim ou4altn ics s  rtm( p;o0oet ioetltlaDemnmpnu4 eeoio tatoa  an s;s)tetm(r3oydllt mict t a2urxrpnu0oetn oeiydfa2rmn on() lermociatfm rlieo;s) 2trio3oo1ole lncils) Durum ;u4aee  f3iasfsDra(mpn(4 reomo3iy1fmt  ivo;s)tetoxrpnudope mics ( sDrrur ot0tlxnii3tat m2eluvs;u0trxrxr3iadfat ln s () 2xmio3iu4lm  lnctl()arururoou1aee mi3iad s2eau p;u) rtomrctydopD luvols0s2uoio3no1open nes t) rrmumono0texoii3iad s2umnvonu0aexoif ty1opDe u s;s  euoxm3iy4lmtemivilsf 2trumo;o1teen i3tldfs eauvonu0tleoxr totfa elu il()setmxmpiudale lfctlsfs2rrumpnu0tptomf3ilt s2em(mo t0altnmr oo1lpt  ues;()t2um(r ou4alen nesat)aDua(mpoo4tlto iciyd m2rm(ms u)trtomr3iytoaD lu s () 2tr(o3oo4opee nvtls arua( ooo1apx iietlsfaDrluvont)tlerif iy1fm  anvil( t2um(opnudam   fetas) Drm( o;u4oeto feiadfm2elu s;()tlxnxf3iodlmt li il(0trtmio3oo1lptemfet tfa2taxrpoo1aetoiociadla2el(mo t4 eermfcta1lm e ivslt0s2urio iy1llenmivi s s2tau  ou0oetoifctys mDelumpnt) lenif oadfpt livs t) 2umxo3oodlmenlfvia() 2rmumoot4tpeomoetyt a2ea( on(4areoio io1fa r uvsl( seuoir iy4alee ivsl()srtm(mp;o4olt  o3tltlsDeluvont)trenmr3iatomDe nei;t  2trim3io1ape  netas sDumx  ;o1tpeoiociasla2rmuvs (4 rxomr3ta1lp  auvo s) rtr(r3nydlpt lneias) Drmu oou4apt  icild mDuaumo (4tetriociydla elnvsl(0srxr(mpnudopt  ivt sfarrrx pnu0tptomf3ildlaDel(vs u4alxnif3oydfmt  uvi s t2urimpoudol elfeta(fsrta( pno1aet mieiyt s2el(vs;u0altomfcoy1lpteluvs t0texr(o nu4opeelictl( aDurx pnu0tltn i3ildlaDranmon(4 eerxrciytoat  i sls texmir ny1am  lfvsl()artmxmono0oet iieiasfm2rluvs;u4trxrmrciadomDrln i;t)s2urxrpiu4lp  lics t s2rrx  nt1tlxniiciltfa ulnms;t0tlermo ia1lptrln i;t  2xmir3nu4lp e ivs tfa2truro;o0open oeiydla ean o ()altrircta1la  li s;s)t2xr(m ou1am nlieilt arur(  ;o1aexn fetldfmDuau p ()alerxocta1omt  uvs;s  rxoio nydomt lfvi t sDuau pou1oexo oeiydlm2raump (4artnxfcoa1fpDrlneo;t0seurir nu1altnlies sfaDua(rpot4alxomicilsfs2rm(vs t4aetnmf3oy1lpt auvil(0trto(opiodam n fvt ( a2tax oot1aexoii3iaslaDul(vp;u) exrmo3tadlmD  n s;( texoimpoo4opeelicta(fs2umumpou0aee  ieiytfs elu p;u)teenxf iy1lpt ln i ()t2xr(m3iu1om nmfvslt)artmx  ;u1tlx  iciyt s2rmumpn(4 rxnxocoodomt  ivs;s0 rumxmpoo1ol  mfctl()sDtax  ;u0teto i3iltfm2rl(vp (4aetoif tytopteli o;s0trtr(o no4al nlietls) Dur(r nt0tptomoctlsls emnvp u)arxrmf oytlpt  uvs;s0trurxmpoy4omtn ictas)s2ta(m nt4aleo o3ilsfaDem(vo t)tetoxr todfa   n ol(0 ruoxr iy1amtn nvtas  2ta(mpnt4tpen oetad m2em(ms;t0aexniocoadlmD  uvo;(0s2umxr ou4lmt livi s sruaxmoot0tltomieildfa eanmp (4alxrxo3ootlpteanvo;(0srtoirpoydlmte nesltf 2umx ono0tptnmi3ild m2eluvo;t4 etnio3iatomte ivi (0t2tmxrpoodaleemneta(f Drrump;t4aexnmoctls mDelnmo ()aetoir3iatfptrlu o t0s2urio no4ol   fci tf rrmuro;u4tptnii3iyt s2ranvs (0trxoxrctodlptelivs t0 2toxr oydape mfes sf rtmx  ou4tltnmo3tadlaDrln o;t) rerxr iotopDrlnvi;t t2xrim no1optemnet sfsDuau ooo4aexo oetltfa uaums;t0teeomr ty1fpDr uesl(  2umiopiu1ll nlfcta()aDtaur ;o1aptomo3tyd s2eauvs t4 eermrctytlatr nvs (0s2umim3io4ale  feilt a2ur( oot4texo f3iyslm2rlu onu0altrmr3ia1optean s;()truoxrpno1ame  ictat  Dum(r nu4opx  f3tlsfa ean o t) eeoxo to1faD auei;t t2uoir nudamt  fcsl(fsDur(  no4tptn oeiadfaDel( pn()tetrmfciotfpt  uvslt0texmxo nudalte ncs tf 2ur(r ou1optnmiciysfs umu o (0 ltomr iadlmD anvi;() 2trim3nu4apeemfcta() Dum(mo;u4alenmf3iat aDel(mp u0alxrmo todoaDe nes () etoxm3oydomt  ivsatfsrrmu pou0aleniociltla2rlums u0 etrif3oa1omDeli olt  2trim3io1open fcsatfa2tax o;u0tltnifciydla2rmnmont)trxoir oo1la  liei t0 exoim nodape lnesl()sDtauroot1tleoifciyd m umu snu) rtrmrcto1lmtrlieols0 rurxr3iodaptnlnciat  Drr(mpoo0oexo o3iasfa eau s;(0arermr3tadopDrai o s srur(r iydal emivi t)a2tm(rooo1olxn ieiadla el(mo;(0texnir3todfateanvil(0t2tmim3iy4lmeemivsls s2tmxm ot4oetniocilt a2uaump;t)tltoxr iytlaDrli i;t0 rxm(mpou4open ivia() rtm(r ou0oexn fciat s2rl(ms;t4tlxnmf tydfpD  n s ( t2tmim oo4ll emici ()arurump;u0aee mieiydfm umu o (4 lerxr3iydlaDrai s;s t2toxmpoy4lpee ivil()srrmx ooo0oetnif3iad a2rlu on() leoxf iatlmDelueo t sexmxopoo1lmtnlneil()aDtr(m nt1oee moeiytfmDul( s (0artrxf3tydfp e uvi s  2xrio oydlm nmneias arurxm ot1tpen f3iys sDelnvpnt0 etrxo iydfptrlnvols0 2xoir3oy4lmtn ieiat)a2tmur ;o4alt if3ilt sDulnms t0aeenmoctadfmD an s t0teum(o3io1al   nci () rrm(ro;o4oltn f3tasfm uanvpnt0alxnmfctytopDean o t) exoxmpny1op   iesls) 2um(  nu4aptoifcildfmDrau p () etomocoa1lptr ivo s0t2xmirpnudome mncsasfa2tmxrono4tltomoeiat mDraums;(0 lenxr3iotop ranvi s)teurim3iodap n fvt () 2ua(rpou1aeeo fctydfsDranms;t0 etnxo3io1fm  aivi;()trumxm3oodlmen fetlsfa2trx  nt4aee  o3tld s2eauvo;t)alerxr oodlaDrlieo ()srxr(m ou4ameelfvia(faruauro;u1alen oetldlm um( p;t)alermf3iy1lmD  nvilt0 rtr(r3nu1lmtn ietat)srtrxrooo1oee mieiyt m2uauvp;t0 renmf3oytlpDelnvo t  2xrio3io1apeemnvsat sDrr(r ;o0ape  i3tlslm um(mo ()arxomf totlm rauei t  2xm(rpiy4omeemict t)sDurxmp;t1tetnmo3iysla rl(vonu0arxnmrcoa1fmt  ivi;t srto(mpiu4apenlfciltf rrm( ooo4tlenmo3tydfm rau p u)alxnir oa1opDraivo;t trtr(mpou4lmeemfcs s srum(  ;t1optniieiasls rmuvpnt4 rtnir oydfp elueo;s)sexmxm3oy1altelivtasfa2ur(rpoo4ole  f3tyt s rl(ms;(4trtomfcto1oa e ueils t2xm(o ou1ope mfci s  2uru oot1tltnii3tadla eln s t4trenifcoa1oatelivo;()sexrxr oydope  iei s) 2rmuroot4teenmieiad a2rmnmsnu)arenmrcoa1optr neolt0 2to(r oydamtemfci () rtmxm ;o0optnmi3tatfa elnvonu0 lxnxo3oadlaD  neo;()t2trxr nodll   fesa(f rrmx pno4oetomfctydls rmumsnt4artomf oo1omt li ol(  2xoir iu4omte fci t) Drrxmono4alenmo3tlslmDrau o t)tltoxo3ta1fat aieol(0 rxr(r nydoleemivil( srra(roou4tpenmoctasfa2eln s;t4trermo oa1fmDeaiei ( teurim3iodamt  nct t)sruaxmont0oexnmi3iytla umuvsnu4 eermo totfptelues;(0teuo(r iu1op elnvs (fartr( p;t0aex  iciytlmDeanvo;t)arxrifciatomD li ils0t2xrxo oudopt  fesls a2umur ot0oexnmf3ilslm uau p;t)arermr iadlmteluei;s s2toxm3ny1al  mnet ()s2rrx pot1aee  feildfa el( p (4 lenxf3io1lp r ivslt) eumxrpiy1lmtn neils) Dtmur ;u4tet mo3ias s2ua(vo;u4aexomrctadfaDe neol( srxm(o nodolt lncsltfsrra(mo;t0apenifeiaslsDrauvs u)teeomrcoadfmDelivo;( t2uoxm3no1ame mnvi tfa2tm( ooo4olenioeiysls ea( pnt0trxrif oa1fmD  u o s t2uo(o3iu1apte ncta(  2rm( p;o1tltoii3tldfmDrmn s u0texnxo ty1lp  auvo t)t2xr(rpny4amenlnvi ( sDraumono4altn fcildfa2ulu sn(0aeenxf3oatopDeanvsls t2triopnu1llte neilt) rumu pou4aleomi3iyslsDra(vsnu4 eeoioctatlmD lnei;()seuoxo3iydlmt mnet (  Drrxrpnt1aetoiiciaslmDrm(vo;u0 lxnxrciodfatrlieol(0texoxo3no1am nmneslt)s2umxrpno1aetniieiatfs2elums (4trtomf3tytlp  lnes s)t2tm(r3oydlmee nvi s sDtaump;t1tlt ifciytfmDuaums t0 rtomr3ty1lpD  i i;t srxr(opou4ap  lfctlt arrm(m ;t1olxnmfetadfmDrm( o ()artomrcoytfm e nes;(0t2to(mpno1lmtnlfet sfaDra(  ;o0aetn o3ias sDrm(vo;(0altnmfcoodlat aivs;( trtoim iu4am  lnctas  2tm(  no1aeeomi3iasfa eau s;u)trxoifctadfmDr ies;s0srxoir3no4omeelnvtas) rta( poo4opxnio3iyt aDel( pn()trtnmf3oy1opte uvsl(0tetoxmpio4opeelnctat sDrm(rp;t4opx mo3iyd s2um(vpnt0texoio ia1laDeli o;t) eum(opny4ll  lfei t aDum( p;o4aptomieiltfaDumnmp t)alxnif3iatoatraieils0s2urim3iydale mfvtatfa2um(m no0olx ifeiadfs rln s;u4texnxfcia1lmD lu olt teumxmpoy4olt  fvtltfsrur(moot0ole  feiltlm2rl( pnu)teerxf3oodoa eauei;( sruo(o iudol   ncil(fs2ta( ooo1texoioeiysfs ea( s (0tetrifcoy1faDr nvolt) rxo(rpoudopte ieta() Dum( o;o4olx moeilsfsDrl( snu4 lxnmf oatlaDranvslt0s2urxo3ou1lltelnvtl(farrr(rooo0oleoio3iasfa2ulnvp;(4aexrmrcio1fm  aivo (0seuoimpnydom emneiatf 2rmx  nt0tetn f3ildlm rl(von()aexrxf totoatr n o s)srxoim ou1ll nlncta( s2ta(r ou4altomfciytfmDua(vs t4aetrmr ia1fptr n s;(0truoirpny4lm e ici ()srtru  nt1ape mfciyd m2ul(vp;u4 exoio3oydoptr n o (0seumirpoo1omt mfesat)s2ua( pnu4tet  fcilt s raumpnt4treoxrcia1lp  lnvs;t) 2uoxm3oydal n ivsa(fs2umxmooo0oex  ociytfs2uan o u) ltoxo tytlp  ln s;t0srxrxr3ou1alt mncs tf rtmurpou0apt mfctlt sDuaumo;t4alxnif iotfpD luvo s)s2trxm3io1amtn fcta()srtrurp;o0oetomicildfs rmn p u)tlxrirciytfpDeliesl(  eumio3io1omtnmfvil() Drrxrp;o1texnmfeiatfaDra( pn()treomf3todopDe nvi;( t2tr(r3iu4amt  iciltfa2ur( p;u0ale  oeiadlm2uauvo;t0texnif3to1lpDrlies t  2toxo3oo4ol   ics s s2uaxronu1open ociys m2rm(vp t0 rtoir3iotfa rlu il(0t2umir3iy4oltelncilt a2umxr oo0oetomoeiyslm eluvp;(0arxoir iy1omt  uvol(0setoim iu4ale  ivsl(  Dtrumpou0open ieiysfs2uln s;u) ltnio iydlm  liei (0 2umxr3ou4lmen fvi s artm(rpno0tpxnmf3iatfa ua( s u4teerifcoodfa rlneo ()setoxrpiy4am nmivs (f rua( p;o1oltnmiciyt mDea( p t0 exrmfcto1om rlues;s0s2uo(opio1ol nmneta()aDrr( onu4ale micils aD
\ No newline at end of file
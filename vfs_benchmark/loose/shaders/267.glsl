@@ -0,0 +1 @@
+ivs;(0 rxr(opno4al emivi s)s2uru ooo4teeo oeiasfsDrlu sn()arerxr3tytfaD auvo;s)s2xrxo3no1lmtelnct t srum(  oo0tpeomieiltlaDulnvo u4tetriocty1fmDrlnes;(0texoir3iy4lltn fvs s)artau poo1aex  feildfsDrlnvpn(0 rtomr3oodoaD  uvs s)srxmxo3io4lme lietl(  rrrur ou4tpx  octldlmDem(vo;u4altrxr iy1opDrluvils  exo(m ny4ol nmncilt a2tmxm ;t0apxn i3ilt s um(vsnu0texnmf oy1fpDran sl() 2uoxo3iodlpen ieiatfsrtm(  ot1olto f3tldfm uau sn(4trtoxf3oodlmDrlu o;s0setrxrpnu4omt lnctls artmur ;o1optomoeiyd m2umu o;(0 rerxr ootomDeaivs;s0seur(r3iu1lm e ivta()aDtrxmpnt4oee  ieiytls2el(ms;u) leoxrciydlp   neilt  euoxr3io1amee fetasf rtm(r ;u4apto iciydfs2el( onu0trxoxr3tytfmDr n o t0seuoxrpiy4omeelnet sfsrum( ooo4alx iiciatla elnms t0 lxomr ta1oa eau s;s) rtoxr nodopen fetas a2ur( pno4tpxnif3tldfmDea(vsnt4trxoxr3iadfm  livi;s0srtmim3oy4alenlieil(  ruax  nu4tptomicilsls2rm(ms u)treomr3oa1laDrlu s s0trxrxopno1llen fvta() 2rmx ono0oex  ieiatls umnvo ()aleoxr3iadlaDelnvsl() etrio3ny4ome licil()aruax p;t1oleo o3tldfm em( ont)areomr3iodlaDelnei (  2xoim oo1lpe  fvtls a2ta(mpnt1oeenifeilsfs2elu pnu4altnircta1fm elu i t)srtmxm3nydopee feta()srumx  ou4tlxnmi3tasla uaumo;t)aetrxf iatopD  ivi;s) 2toim ou1ap n nes sfs2uaxm ;o1aee ifctasfa el(msnu4tltnxocoatlmDe iei;s0 2xrxm iy4openmfvi (fa2uax pot0tetniietatfm2uaumo;(0trerirctotlmD  iei ()srxoir3iydlltelfeilt) 2rmuro;o0oexnmo3iatla2ul(vpnu0tetnir3totomt  uvslt0 rurxm3ny1ape mivslsfa2trur nt0altnmfctatla2eln pn(4 rtnxo ta1optr ieols s2tmir ny1ap e ici t srtr(moou1aptomfeiatfaDeanmsn(0 renif oy1op  an i s  rxmxr3oydom  lnesas srrmu ono0apx  ociltfs2ra(vs u)tleomfctytoa r neols t2tmxopiudlpee fvtl( artaump;u1olen i3tltlm ranvsnu0aleomr3oy1lpDr nes;t0t2urir3nydapeelncsatf 2uaur ou4tle  i3iadfm2el(von(4arenxfcoytfaDe nei;t sexm(mpnydomtnmfvsa( s2taurooo1opx mfeiltfm em(mo t4 exnxr3iodlmDe nvi t)sexr(o oo1ol  lfeslsfsDurxro;u4tpxo feiysls2rau pn()teerxr3ty1opDeluesl(0trumio oo1altnmnetat s2rmxmp;u0oee  o3ild s el(msnt4 exoiocto1la e ivs;s0s2urxm oo1lptnlfvsat sDurxrpno1tetnmi3tytfaDeanmon() exoio todfpt auvsl(0texrxm3oy4lpt mfetatfaDtrx pnt1optoiiciltla em(mon()teenmr3oytlatr nvs;(0s2tr(o oy1olenlnct ( s2um(r nt4alxnmi3ildla umn p u4artrir iodlpt  nvs (0 2uo(m ny4apenlivta(fs2tr(ront1oeenii3iaslm emn p;u)tltrmo3ta1opte uvslt tetmio3nodop e feiltf rrrx p;u4teeomo3ilsfs ua(mon(0arenio iodlatrln i;t0srum(o3io1al   nvt t  2ururooo4alx moctad s2ran onu4arxnirctotfaDelieols)t2uoio3iu4lmenlietl()s2rm(mpno1opeoiieiytla2eaump;(4tetriocoadfaDe u i;s0 rxmim io4lpenlfesl(f 2taxmont4texomfeiydla2ra(vs;t4arxrircta1fa  au s t)srxm(r oo1lm  mivtasf rraum nt1teenmocilt m elu ont0 rxnmrciodlmtean ilt)s2xriopnu1apte ieil() rumx  nu4opxo oeildfs2uau o (4aetrircia1latr neolt) rtmim oy1lp emnvtl(f Drrump;t0tlxn o3tadlm rlump;u4 exnifcoytfpDr ivo;() exoxo no1am nmiesas)a2uaurpou1optnmieiyt m2rlnmo u4 etnxrcootom rli ilt0s2xrxrpiydlme  nvias)a2rr( pot1tlx  octlt s rlu p (4trenif totlmD lies s)t2xoim3nudal emfvt ()srtrumoot0oexnii3iasfmDua(vpnu0 lxrmr3io1fm rlies s t2uoxm3oodlp nlnei sf 2tm(r oo4aeto oeiydls2emums;u4trtrxr3todfp elnes;( sexm(rpnodlpenmict s)arrau pou4aee moctysla umu s (4alermo3ta1optelneolt trtrxr3no4lptnlfvtasfaDrrx p;t1aexnmf3iadlsDum( p;u4arenxfciydfpDeluvi;s0srurio3ny4lmenmfci ()aDuru pnu0alxomi3iytls rluvsnt) exnxfcoy1oa eai ils)tetrirpoo1ol nlivt s  rtru pnt1aexn fctyd s2rmuvp t)aeeomrcoodlp e uei;( t2trim iy1al nlneiat) Drax  ot1opt mo3iydls2elump;t) etoxf tadfp  aues;t teurxr3nodlpe mieil() Dum(mp;u0optnio3iytla2eauvon()tltomf3oatfmDe uvil(0sexmimpiu4omenmfvtas) Dtr( oou1tlenmictasfmDel(von(0 exnir iytfa e n sl() 2xo(o nodol  lfci (fs2rmurpou4altomfeiydfm eln onu)alxnmf to1om  livils) exr(o3nu1olt lnvtlt aDraur ;u4opx mf3iytla2umnvp;u) exoiocoodoaDrlues;s trtmxr3ny4olee nesat sDrmu ono1tpx mi3iadlmDraumsn(4alxrircoadfpDelnvi;(  2to(o3ou1alt mfct sfa2tm( o;u1oex  icias sDrlnvont)aexnxr3ootlpD  ivilt0 2toimpny1al  lnctl(fa2rmxr ;t4opeo oeiatlmDuanmon(0tetoxfcoo1laDr i ol( sexrxr3nu4opeemnvi tf Drm(ront4tleoifciydfa ul(mo;t0treoifctatomD livol(  exo(m nudope mfcta()sDuau p;o0teeomo3ilsls2elu o;(4texoif3ty1lp   ieo;t0tetmxopou1apte nvt (  2tm( p;u1oexnmf3tasfm2eauvs;(0 rtoiociytlp  aueilt) rtr(r ou4ap nmfes t  2umx  ou4tpx iietlsfs2um(vp;() eeoxo3oodoa e nvs t t2uoir3no1lpt  fcsas) rtr(ro;o1tptniieiyd s rl( s u0 rxoir3oadfp  lu s t0 2xmim iudll n neia(farrr(ro;o0tet ifeiyd sDumnvont0artnmr oytom r ueo ()s2uo(mpnydopenlfet ()s2umxr ;o4olxn feilslm2ulnvp;u0aexoxrciy1lateluvilt trxoir nu4apt mfeilt)srrmxm oo4teen ieilsfm2ra(vp () lermr3todlateai o;s)teumxr oy1am n icslt)s2tm( onu1aexnii3tad s umn s u4altnmr3iy1fat lues;(  exrxr3nodlltnmieilsf 2tr(  ;u1tleoiicilsfs2ua(vs t4trtniocoytoa eanvi t)sexm(opiu1ope  iet ()srta( pnt1oexnmfctlsla rm(mp () reoif3iytopDelueslt s2trio io1lpeelncsa()aDra( p;t1oexnmi3tldfmDrlumo;u0tleoif3tadfaDelivo t)s2xo(mpiodlpenmiet (fs2tmumo;o1tetnmo3iadlm rlnvp t0trtnxo3iy1om   nvi ()sexoir oydlm emfetlt sDrmxr ;u0tlx  i3ilslm2elu s;t) eermr3iotfmDraiei s)s2umxr nudape  ieslsf 2uau  ;t1tex io3tatfm2uaump t4aeerir iatfpt  nvi ( t2xoxopiydamtemncilt sDta(r nt0tlxn ieiadfmDranvp;(0 etnxo tytlateanvols  rxmir3ny1apte icias sruau onu1opeomfcildlsDrlnmsn(4tlxnxf3io1lptr ieils)t2uoxo3no4amtnlivtl( aDurum ot0tptomictltfmDulump;t4 ltoxf oy1laDe u i t0s2toim3oudomee ies (fs2ua(mo;o1ape iociytfa2eanmpnt) etoio3ty1oaDeauvs s t2xmxrpoudope mfes s) rtaumo;t1oleoii3tltfm elnvsn(4trtoxo iydfmtean i s0 rxrxr ny4ole lnct t  Dur(mp;u4alenmictadfsDel( pn(4alxoxr3oa1fpDeau sl(0 rtm(o3ny1alenlnes (f rur(m ou0aetomo3tyd aDeanvon(4arxomocoytfmDrlies t0t2xmxopno1altemfei sf rumx p;u1olxnifetydfs2elnvp (4 rxoxociotop e ueolt t2xrir3oy4apt lfvtas  2tm(  nu1tetoiocils a umump;t4 eenxo tatoa ean i;t0srtoim iu4lptnmici sf rtru oot0apxnii3tyslm2umums;(0 ltoxr3iadlateanes s  ruoxm3oydop emfvsas)a2ur(moou1tltoif3iltfaDem( p;t)arxrirciodlpt anvils  rxo(r nudomtnmfvsas aDtr(r ot0aptnmiciadla2ea(mp;()alxnio3ia1fp raneslt0 rxoxo iydomtnmneiatfartaxroot0teeniocild m2ranmp;t)treoxoctytfptean sl(0 2toir3nudamtelfesls a2ua(ronu0opxn iciaslsDua(msnu4teeoif oa1lm r n slt)srxo(o3ny1amtn ncils srrm(r ;o4texo icild a2em(mp;(4 exnxfcoytoat lu s;t) 2tmio oo1oleemfvsl() 2ur(rp;t4oexnifeiyslmDuauvo t)teenmf iytoa e i sls)teurir io4ape lieil()aDraxmpnu4apxnmietlsla rlnvs (0artnxf3oo1la e n sls0texo(o nodole  fci s)aDrrxrpnu4opx mo3tlsls2ul(mpn(0teerxf iatoaDranvslt)s2urir iu1amenmivsas  Draxr oo1tlxomfcias m2emnvp;t4trxnxfctodlpteaiesl(0teur(r ny1lpeemiesl()arrrxmpou4opto feiaslm2rm(mon(0trxnif3oytoa r ues;(  etr(o no4amtemict s aDua(mono4alto oeiyslm2um(vs;u0artoiociodoaDe u ils  exoio3no1open ncsas aDtruront1tpenmictyslsDea(vs t0aexoifciytlmD  nvi t  eurim oy4alenmfvsltfa2umxrp;u0oexnif3ilslm2um(vpnt4aleoir tatlmDeaivi ( trxoxr iy1apteliesl()a2taurono0oleoioeiysls uluvpnt) etoxoctydfmtran i t seum(r no1omtelncil(  Duax o;t0apxoiicilslm2rm(mpnt4 etoif iotfmD auei ()trumxopny1al n ivsa() Dtmxmpnu0aetoiocilt m2ea(vp ()tetrir ia1lmD anvs;(0 rtrxr oudam elivt t)aDtaur ;u0aptnii3ilsfmDrluvon(0artoif3tytlpDeluvol() 2xo(r3oy1lleemnctat arrrxro;t0aleo feiyt aDem( p;u0aexomf iodomteau s t0 rur(o iy4aleelnci tfartmurpot1alxn oeias aDrmn o t)texnif iydlpte ues;() rtrxrpiydaptnlfvsls s2raxrono4texo o3tydfmDum(mo u)tltrifcoatlpD anvolt0trto(m oo1ll nmicta()a2tmurpnu1aee  ietatlm2emnvo (4trxomrctatoatelnvs;(0sexo(opiu1omt lncs s  rrrxro;o4aet mi3ilsfa2ul(mp;u0 rerxf iydoatr uvi s)texmim iudlltelfetls) rua(r ;u1olt ioctas aDua(ms t4 rxrxf ta1omtr i slt sruo(m nu1op  mnci s)s2rrxronu1teenmfetltfs2ua( pn(0aexnifcia1oatelues;s) eum(mpnudameemfcil()sDrmumoot1oex mfcild s ua(vs t4tetrmo io1lm   ues;t srxrimpno1lleemivs ()srrm( o;u0aex moctltfm2uauvsnt4trtrifcoa1lm e ueo;t) 2um(mpiy1lmeemics ()aruaxront4tetomf3tadla2ra(vonu4teerxf ty1fmDean ils) 2ur(rpiu1ol nmivi (  2rmu  ;u0opxo ociltlm emumsnu4aexnxo iytfm r ivilt)srtm(r iy4lp n fes ( s2ur(mo;o1oexomf3iltfmDelumo;t0areoifcoadfp r ues t)sexrxrpiu4amt  fcils  rumu  ot1tltn o3tyslaDumuvont)areomr oydlat  u o s  exoimpny1lp  mfeta(farua(ront0aeenmf3tlt a rl(mp;(4 rtnmr ta1fm   n i;t)t2trxo iu4ape  fetltfsDuru  nu1alx ioctlslsDrl(vsnu4 eeoir iotoatrau s t) 2uoiopoy1ome lnetlsfs2rr(ront1tpx  ieiydfmDuan p;()aeenmo3iydlmtraiei;s)teumxm iydalen nvsls a2um(mont0tltnmf3iyt a2umuvs;t4teerxf oydfatrauvo;()srtmxo ou4olte ictlt  2um(m ;t4oetnmoetatla2umn p;u4aetniociydlmDrauvi;t0 rxmirpno1lmtnmieil()a2raxrpoo1oetniictydlm2emnms u0alxrmr ia1opte ivi ( s2toxo3iu1al   ieslt  2rrxmo;o1tlxoiocildlm2eauvonu)arermfcoa1fmD lnes;()setoxm3no4lp n iei t) 2tmuro;u4aexnmictldls2umnvsn()treomr ootomt  nvsls0trtoimpoy4lm elnvil() 2rr(mp;o4oltnmietls m rluvs;t0trtnxfctatlm e ueo ()sexoxrpoo4lmeemici s) rra(m ;o1olenifeiytfs2emu sn()texrio ootlaD lnesl()t2ur(m3oy4ol emfvs t)arrrum ;u0olxn f3tytlm eluvp t)aeeoiocto1fmt  uvi t trtrxr oy1lmee ics ()s2rauroot1tee mietltlaDul(vp;u4 leomr3io1fptrlnei s0 2toxr3oy1apeemncils aDua(r nu4olx mfciydls um(ms;(0aeenmfctadlat  ieol(0srxo(rpou4aptnlfvsa(fs2umxr oo4alx io3iysfaDumu p;u4 etomr3oodfa e u s s) rtoxm3iodalt  fvt tfarum(r ;u4teeoif3tltla2eauvo t4alxoif to1lat  ivs ( s2xrxrpoy1ap emiesl(  2tr(mo;t1opeomo3ilslsDrauvs u0aetriociydop e ueo;t trxoirpoy1alee fvs s)arrmumoou4oexoio3tadfm uanms (0tltnmrctadfaD  iei;t)tetrir3oo4al elfeil(fsrrrxroou4ale micild m2rl(ms t)alxnifcto1opDrlnes;( texmim3ou4ap nmfvs tf rrax o;u0opxniictys s ea(mp;u4texrmfciodopD lneo s  etrxr nu1olee ict ()s2um(  ot1aetnifcildlsDua(von()aetrmo iatom eauvsls0t2xrxm no1am e fcsat)aDumumoot0oexo fciaslm ra(vs;u4altnxo oadfpD luvs;t sruoxr io1lm   iesl() 2rm(mp;o4openifeiatlm2ul(vpn()aeenxrcoadfm e u o t0s2urxopno4am emiesa(f 2tmurp;t1olx miciltfa umnmp;t)teermf3ta1laD lues t s2tr(r oodll nmicils)srtmumpnu0optn oetld a2rl(vsn() etrircty1fm   u olt0 rtr(opoy4amt  icsa() Drr( p;u1oet ioctad m2ulumsnu4 rtnmf3totfa  anes;()s2xoxm ou1am nmies s)aruru p;t4oeenmoetys aDuanms t4texoxr oo1oa e uvils)trtmxm nudalenlfcsas  Dta( pnu1tetomi3iydfa2uanvs;() ltoxo3oy1oa ean ilt)sexr(m3nodom   nvtasfaDua( ooo1tlxnii3iltlaDrm(vo;t0trerir oo1la   nei s0s2tm(o iodapee fvs tfs2taur ;t0oltn fctytls rl(vsn(0aexomr3iytopDraneils)trxrxm oo4apte feslt a2trum ot4tpxomiciydlmDemumpnt0trxnifciadomDeanvil( sexmir io4ole lieslt  rtax ono4opeoiieils s rmnms;(0teeoif3ia1fa r neo t) rumiopnodop e nci s)sDumu  nt1aetoioctltlm ua(vp;t4aetrif oy1fmte nei (  2toxrpiu4ol   ncsa()s2trxmpno1oee micils s2ul(mon(4aeenif3iydfa eanvsls  2xo(m iydlpt micslsfaDua(ro;t1tex ifcias m rm(ms;(0texnifciytlmte nvs;t teumio ny1op  liviltfsrurx ono1tlt moeiysfa em( pn(0 rxrmrcoodlmDr u i;()t2um(r3iodll e feias)aDrm(mp;u0aet  ictad mDranmp ()aeerxo oy1oa r i i s0sexmxr3oo1lpt  nciltfsrurum ot1apeoio3iasfm2elnmon(0aetoxrcoatoa rlieo s)s2to(m3oydamtnmnci tfa2rmump;t1apto fcildfaDeln s;(4tleoxf oodfpteau i;( srtrxm3ny1omte icsa( aDurxrono0tpto octatla2ranvsn(0 rxoio3tadfa r n o;()truoxrpny1am   neia( aDumuronu1oetn ietltlaDrl( pnt)texomoctadoa rlnei t0 etmxo3nudaltnlfvt s)sDua(rpou4texoiieiytfsDem(mo t)altnxf3oytoaDelu s;t  euoxo nu4am nmfvt tf rta(r nt4alxoifciatlmDulu o u0artrio ia1omtr ues () 2uriopou4ameemnciat a2raxmpoo0aexo o3ild aDrm(vs (4 rxnxfcio1oa eaneo (  rto(r3oo4lm   nci s) 2rr(m ;o4olt io3iatla ranmp (4altrmrctotfp eluvs (0 eto(opiydop e ics tf 2urxmoot0alen feiytfm2elnvo;() lxoxocoy1lp eaies;t0trxr(m3ou1om   fcsa()aDuaurp;t1ale  f3tltlaDea(monu4teeoxf3iydoa eli s t0tetrxrpiodale  nvs t a2tm(r nu4oetn f3ilsfa rm(mo;(0tltnmfciodfa  li s t) exrxm3nudop n nvta(fa2ur(m ot4tpxomietyslm2ul(vpnt) lxnxr3oa1lpD lnvol()trtmio3oo4om nmivs ( sDrm(root4open i3ildls ua(vo u)trtnmrctadfm ran sls trtmio iodol emfes sfs2taxr nu1tpx ifciysls2uaump () lenmr iotfmt  nvi s0 rumirpiu4am emnci t) Drmuro;t0aetoii3tasla rlu p (4aleoir3todlaDeanvo;( trxmimpoo1alt  feil( s2uaxmoou4oleomf3tysfaDrmuvo (0tetrxf oatop   u ils t2toxrpiy4open fvi ()aDrax o;t0oexo o3iltfmDemn p (4 rermf tytoaDr u slt0texo(r3oo1lpt  fvt s) Dumu  ou0altnifciyt s2ulumsnu) eerxr3tydopD luvo t0 exr(rpnu4openlicilt  2rr(r nt1opeoiociyd aDelnvs ()tlxnxfctotfpDr ues s0 2tmxo ou1ol nmncilt sDraxr oo0texnmf3iytfa rln o (4trtnxr3todomDr uei s)t2um(m nodlme lfvs t s2tru oou0aptn ieilsfmDrlnmp u0 eermfctotla rau i;t0srxrxopoodoptnlneils  Drrumo;o1tlto f3tas m raumon() ltrmo oy1fmte iei s  rum(o oydal e fes s a2rmurpot1apx if3iad m umnmsn()altnxrctotoa eluei;t)srxrxm3iydlmeelncsatfartaxmpoo0tpeo ieiadlmDumnvp t)arenxf3to1omt  iei t s2uoxmpiydaltelictl( sDrmurp;u4opeoifciyd m2uln s;()tetrmf oydfp e uvi;( tetoim oudamt  nvt t a2tr( poo4tpeomiciltlsDuln s (4artoxfctytomt  nvo ()t2xmxmpio1amtemivs tfsDua(mooo1olxomiciysfmDemnms;t4tltrmo iodfmtrlnvi;t  2umxrpoy4lpee fcias) Dtrxrono4oeeomfeils mDelnmp;(0 eeomo3oa1la eaueslt0s2xr(o3ny4ll elfvs t)srtmurpou4tpxnioctld aDem( sn()trxnxo iydlaDe u s ( truoxm oodamtemfvt t)a2rau  nu4tptoif3iasfm2elnvo t0aeeoir3oodomtr ieol()t2ur(m iydaptn netlsfaDrr(mp;t4oexnmfetltfa2umump;(4aeenir ia1laDe ues t t2trimpou4alte nct s sDurxmont0tet mfctytfm2ra(mo;t0alxnxo oytoa r nes t)srxrio nydapenlfvilt) Drrx pnu1oeto ieils sDrmu snt0 eeoxo iotfat lu i s0srum(o ou1ap elnvsls)srrax pnu1oexo oeiatlsDrauvo;t4 etrmr ty1lpD an i;t0teuoir3ou4om nlicta() 2raxrpnu1teen fcildlaDra(vpnu0tlerifcty1fat ai sls)s2trxo3ny4lm  mivias)a2trx p;t4apenmf3tlt a2rmu o;t)tltomfciotlmteaivs;t t2xrxo3nudam nmncsl(  Dtaur ;t1teeo ociydlsDuanms (4 rxomr3oy1laDe ivsls0s2xm(o3oy1optnlfcsl( a2urxmpnu0ope mictydlsDrmnvsn(4tlxomf3oa1fp  li ol()s2tm(mpny1amenmnctlt) Dur(rpoo1alxniociyt m2ua(vp;t0 eenio3ta1opD  nvilt)tetoxo oy4ol  mfvtas a2taump;o4ole mf3iadfsDua( p;u4 lerxfcto1faDranes;t0 2toxmpoudlm   feiat)sDrmurp;o4texn ociadlsDra(vs;t0 rxoifctydopDelu ilt  2trxo3oodll  micsl( s2taxm oo4oexnmoeiatls2ua(mpnu0 rxomociy1oa e u sls seurxr3no4lptnmncils  rrax ooo1oltn oetadfsDemuvpnt4alxrmf3oa1lmDeau sl()s2umir3no4ap  mfcs ( aDtm( ooo0alt  o3iydla2eaumsn(4arxnxr iotlptr nvilt)s2urim3nodlptnlieiasfarrrxmpou1oltomf3tadlmDrmnms u)tlxnxr3oodfaD  uesls t2uo(m3nu1lm nlfvia(f Dum(mo;t0tlxnmo3iydfaDum(vs;u) reoxr3iatoatrlnei s0sexr(mpiudlmt lictas srrrum no1olt ifciasfm uau snu) lxnir3iytoaD au s s  exrxrpno1opeelivtl()arraxmpnt4apt mf3tatlsDelnmp;() lxnio3oa1fpDeai o;s) 2uoxmpio1ll  licsl(f Durur ;o1tlt ioeiytla ua( p;()tlerio3oodop r uvs;t0t2to(m iu4altn nvslt s2trxmpno0apen fciad m el( onu0 eeomocoatom e uvi ()setmio nu1omeelneta()s2ua(m no4olenifeiadfm rln p u) lxoif3oadfp  li s t) rtmiopou4lleemfvi s)aDtrumo;o1oexoiocils aDel(ms;u0 lenif3ia1oate n o t0s2toimpoy1ll  micilt)s2taumono0teeomiciaslmDemump t4trtnxrcoytlm  ln o;s0texm(m oo4lptemfet ( aDtaxmp;o1opxn fctatlmDrm(vp t0 reomrcoodfaD ai o t s2xo(mpiu4lp nmivtltf Draurpnu0tpt  fetadlsDumums;()trtrmrcoadoptelivil() exoim no1ll e feia()a2ra(ro;o0olto fciys s2umn o t)trtoioctydlpDean s;t)srxrxopoy1ole lnvs s)a2tr(r ;u1alt moeiasfm2rlnmp () exoxo oatfmDrli olt) 2ur(m3iydome lfcsltf Durxrpno0oexniiciat aDul( p t4 lxoxo iotlat ai s;t0 ruoirpnu1olenlieiat) Dua(ro;t4aeeomictatlsDuluvs;() rtrir to1oaDeauvol( trtrxr nudopeelfvilsfaDumxrpno1alt  ieiytfa ranmp;t) lxrmf3todopt anes (  2xr(opiu1lm n nct ( arrrxr ou1tpt mfeiysfsDuanvo u)tlenmocty1fat aivslt0teuoir3no4om  mfvs t srrm(roou4texo ociatlsDum(ms;t) ltnifcootfmDranei;s0 rurxo nydlpe  ict s)a2uaxmpnu0apt mieiadlm2ran p;t4 exrir iytomDeli sl()trxmxopou4omen fvsl(fs2umumoou1apxo f3iatfs2emnvs;t4tlxnxoctotop  anesl( t2urio ny1alte fet tfa2umurono4texnmieils s2uluvs t4 lxnio3oydfat  n slt0t2xoxr iu4lltelnvils  Drmu  nu4oeenmo3iyt m ulnvp;t0 etnxrctydfaDeai s;t)s2xoir3oydlmenmnet s)srururooo4opeomfeildlaDelnmpnu)texomo3totfa ean ols) eurxmpoodamtelfes ( srra( ooo0texo fetasfs2rl(mp ()tetnxr3iydfa r nvs s)trurxm nydlptelfctas  2rrx pnu4texnii3tat aDrluvs u4 eeniocio1omDeauvi;t  rtm(m3iy4al nlivilt)s2tru onu1oetnmictytls uanvs;u4 leniocoatlmDr uvs t teumxopiodope mnes tfsrraxm ou1tpt mfeiysfs ra(mo;() rxomf oodopte n i s  exoim3oy1op nmnctatfarum(mp;t1ale mi3iad m2uanmpnt)trxoxf3totlmDrlivo () rxrim3no1lpeemnesa(fs2ur( ont0ale mf3tasla2eauvp t4artrxf3tytfptranvs;t0t2um(r io1lmenmfcsls) rurx pno4aexoioctldfa2umu p;u)trtnif iatfpDelnei;t)srxoir3io1lpt  ici s a2ua(mp;o4apt iictas s2rm(mpn(4aexrio3iytla rli i;( setrim3iydape mnvta() Draxm ot1ale moctlsfs2um(vsn(0trxoifcta1fat lu ilt)t2urir3iu4apenlnci t)sDtm( p;u1teeo feilslm ulnvsnu0aetrmo3oo1fateluvolt  2xmim iydolt mfcs t  rrr( o;u0ope mfctat a umumo (0alerir3ootla rai o;t0 rtr(o iydopeemfcs (  Durxro;u1apx ifetlt aDumn o t)tlxoxf3oo1fmt lnei;( t2urir3oy1ole  nvsasfs2urx oou1opto ietad s rln s;t4 ltnmf tydlptr u s s0t2to(m oydalt mfciatfsrtaurpot4optn ietadfm ulnvo t0trxomf to1fm  ai ol()seurxo ou4lle mncsat)aDta(m ;u0tle  o3iyt sDrm( ont4arxomocoa1oaD aneol(0setm(r3iydop  livilt srrauroou0tpeo iciydfs2ran s t4trermr totlm e i o;t seto(o nu4lme mnvs tfsDtrxr nt4ape  o3tlsfs rau snt0trxrxr iydom r neils  rum(o3ou4optemnet t srrru pot4aetn fetydls2em( p (0tltomo ootfatr nvo;()tetm(o iydomtn nesls sDrrxrpnt0tlenioctad m em( p u0aexrmf3io1omDrau o t0srxr(o iudamt lfeilt)arrmu  ;u1tpe iociydlm em(von(0texrxo oydomt aivol()t2xr(m nudop emivsls) rta(m ot0oexn ocildfmDraumsnt4 rtomfcootfptr ieolt) rxrimpno4am nlnvi sfs2rruroou0tlx  fcilsfa2eaumo;(4trtoioctadfpDe neo t  etmxmpoodop nmiesl( arta( ooo1aeenifciatfsDumnms t0 rxnmo oo1oateai o;s) 2tmxmpiu1am  mfvtatfarumx p;t4aetnifetat m2umnmpnt0trerxr3iadoa  lueolt  rurxopno1alt lfvsasf rrrumonu1olxnii3tytfm umnmpn(4tleoio ty1la  anvs ()setr(m3oudam  mnvt tfaDtax o;u4tpxo fcils s2ul(vsn()teeoiocty1omDr nvsls)truo(m oodomeemfciatfs2rrxmooo0tpe mociytfa2um(mo ()aetrmo3oadop elnes (0 exrxo3oydlm  lfvi () ruau ooo0tpe mfeiyt a2rmn o;()aexrxo oa1fmtrlnvi s)seurxo3oodopen ieilsfsDrru p;t1alenif3ias a2ran p;u4teerirciydlm elneol( trxmio io1lpt lfci sfarrmu  ;o1aeeniiciaslsDul(vo u0 ltnio ta1fpt  ueo;t0 eurxrpno4lp e ivt ( a2umum ;u4ale  fciad a uaump;t4 eerir ia1faD aivs t teum(o iudlpee fesatf rum(r ;t0oltn fciasfa2uanmont)tlenmf3ta1omt li ilt0 rto(r ou4ll elnciatf Duaumono0alxn f3iyslaDua( sn(4 ltoiociotfa e nvs (0seur(opiodapt micsltfs2rrurpnu1aeeo fctad a2rm(ms;u)teenxociodfptrli s s srtmxr oy4op  lnvs s sDtmu pnu4tpto o3iatfaDraumonu4trxnxoctatoa  aivo s0trtrir oo4ap nlfci sfa2tmuro;t0alxomoeilsfs emnmo t0aetnmfctytoaDeln o;t)srtoir3oydamee nctl() 2rau  no0tee mf3iysfm ua(mo (0 reoxo iy1oaDe i ils0setr(m nudapee nvia()artmurpnu1ale  f3tlsfaDumnvp (0tlxrio iy1latelnei;(  2xmxopiu4lptnlnci s aDtaxmpno0tet mi3tldla2el(mpnt4alxrmfcto1lateau o;s)truoio nodllen neilsfaDtrx  oo1apenmfeiyt a2eanvp;t0 lxnif iotfmDrlivs;s)texm(m no4lptnlfesasfarra(r oo1opxnmf3tltlm uaumonu0alxomfcoa1om  luvi (0trto(r io4op nmfeslt)srtrum nt1tpxo f3iltfa2rm(vp u4trtnir3tadlmt auei t  rtoxo oy1apt  nvs s s2uaum ;o0teeo o3iyslm elnvon(4alxnxrctodla r uvo;s0srxr(o ou1ll nlivtltfa2tm(rpou4aeen o3iyt m emn onu)aexnmoctadfptrai ols0 euoim3no1amtn fcsa(  rrrur ;o4aexoio3tld a umnmo (0texrmo3tatoa e ueo t texo(o oudaltnmfcslt  rtau oou0alen f3iltla uln pnt4 renxr to1faDeanvo;t0seuoxr3io1ll  micia( s2umxm ;u1open ieiydla rlnmp;u0texrmrctadfmteli sls0trxmxr3oo1ap emnci ()a2uax ooo1apto o3iyt a emnvpnu)trtnmfcty1omte nei;s sexoxrpio1al elfetls  2ur( oot1oet  octyt mDeluvont0alxrmfcoatla eanvo;t)trurxopno1op  mfviat)sDtmu  ;t1apx moeils s2rmn pn(4tltrio3ta1fa rlueo;s t2xoir3ny4olt  fvsa( srra(mp;u1aptoif3iysfa2ean ont) exomrcoy1fpDrauvo ( sruo(r oodolenmfei () 2urxmp;t1altnmictyslaDrlu sn(0trerxf3iotlmtelies s0t2umxrpiu1alt  fviat  rurur oo0ale io3iysfm2eau onu4aexrio3ta1lmt  neo ()srxoxrpny1lmt lnes sfs2uaumonu1aetnifetltfsDumnmpnt4tlenir3iodfpD  ivi;t0setr(rpoo1om   fct (f 2tm(r ;u0oetomf3ilt mDrluvo u0altnxrcootlptr i s t srumim3nudamtnlivt t  rtm( oou1olt  iciytlmDrmu p;(0arerxocoy1op  livi;t0t2xo(o3iu4lpeemnetas s2raur ;o0olenmf3iysfs2ranvp;t)trtrmrciydlm r ivi t) etmxm3nydlp elfesl( arumu o;u4tlt  o3iaslsDeanvs;(0 leoxfcoadoaDelieil()texo(o nudam nmfvsls)sDum(mp;o1tltoifciytfs uanms;t)trtomfcta1lpDrai o s0t2xmirpiu1am elfviatfarrmx  ;u0tlxoiieiydfs2ra(mpnu0 reoxr3ootoateanvs t) euoxo oydame livslt sDtau p;t1tlt  ocildlmDrm(vo u0aetoxr oytfmteluvs () 2uo(o3nodaleemivsltf Dtrxmoou0ale if3iasfaDua( snu0 eeomocoydfa e ivo;t0 2xoxo oo4olenmfesl()aDra(r ;t1oexnifcildfs ranmon(0tlerio ta1oa elnvi t0teumxm3iu4lpt lfesls a2umxr nu1aetnifcilt s emnvp u)arxnio oatfmtelnvslt)teuoio3iy1am nmnvil(farurx  oo4tle  f3taslm2um(mpn(0 etrio oodoaD aies;t tetrir3nu1om emfes s)arrmxmono0aet  icias sDea( o;(0trerio3oatoatelues t0 rxm(rpoy4optemnvslt)sDuru ont4ole iietad a2umu on()teenifciytlmDr ueols)texrxmpoydoltelfciat) 2rm(m nu1aex miciydfa emnvo (0teenxr oadlat  nvsl(0trxr(opno4amenlnvtlsf rrax  no0apxo f3tatlmDua(vo;(0aexnmr3oatlmDrln i;s0t2trio3ou1lpt mneiat  rtr( pnt0ope  feiatlm elums () etrif3ta1fm rauei t0srxoim3ou1ome lnvias) 2rm( pot0openmo3ilsfa2rl( s;(4texnir iodlateanvol()texmiopnudam nlneilsfsDumurpnu1ale  fetldfsDelnvs u4aetoxo oo1laDeai olt srxmxr no4altn fctls) rrr( oot1tltn icilt s2em(vs (4tlxnxrcia1lmt  uvils srtoxopoo4op   nvi tfaDrrurpoo0alt  fetat s2emnmo;t)tlxnxocoatopteai s (0sexmxr ou1amenmieilsfs2rau oou0aet mfeiyt mDuln o t0 lerifcoydla e n il()s2umxo3iy4lleelfvt tfs2uax o;t0teeniocild mDrau p;(0areomo3todfaDr u o;s s2urxmpiydaptnmiet s srum(rp;t0aee mictadlsDea( on(4aeerif oadopt anvo s  2uo(o iudopen fvsa() Dtaum nt1alxnif3ilt s ulnmsnu4 renxo oy1op eau o;t0srurxm3ny1lptn netat) 2urxrp;o4tltoii3iyt mDuaumpnu) rtomr3tydfm r i i t0s2tmxr3iodale mneils)srta(m nu1aet mi3ild sDua(mpnt)alxnio ta1laDr neolt s2xm(mpiy1llee fviltfa2tau p;o0tpx ioctatlsDem( s ()trtnmociy1lmD  u i s)t2urxmpou4lm e neslt  Drm(rooo1aet ifetlt mDrln p;t0alenxr iodfpte ivi s t2tm(rpnydomen fei sf 2ur(ro;u4ole micias m2umuvpnt4 rxoir3oadlaD anei ()setm(rpnodamenlncta(fa2uru  nu4olto oetltlmDul(vs;u0 leomfciytoa raivo;t)truoxo nu1opt  fcils)arum(root0tpeo fciltfa2rmn s t)treoifcoa1omtrli o (0 eto(o oodap nmivi sfsDraurpou0aptniieiatfa rl(vo;u)texnifcoatlp   i s t  exoirpoudlptelfvt () Dta( p;o4apx ioeiltlsDeanmo;u) ltoxfciydomD  ivs s) 2urxrpiu4omtemnctl( sDuau  ou0oetnmociysfa2umu o;u0alxomfctydlp  aies;s0 etmxo3iydlmeemivsas)a2rmxmoot1alt  f3iasfm emn o u4tlxnmo3ty1fp   nes t t2xmxopou1op  lnvsl(f Dtaumpou1tee mo3iatfsDrlnmp;u)tetnxfcia1la  ln sls  2toimpiodom n nctat) 2trxroot0ape mfeildlm elu p t4tltoxo tadlm e nvi;t trumxr3oo4ame  fes t) rrr(rp;u1olenifciydfmDuln snu0trtomfctodfp  lu o;t)srumir nudll emncia()arrmxro;o4opeoioeiaslm rlnvont)alenif todla   ueo s)setrio3ny4openmneil() Drm(m no4teto fetldlaDel(mpnu4arerio totfaD auvo;s  euoio iu4optelivsls)s2rmx pou1aex mo3iatlmDul(vsnu)aexoxr iy1fa  lu s;(  rurxm ou1alenmnctls  2tmu pou4opxo oeilsfsDua(mp t0 exnxo iotlaDean i;s)trxoim ny4lle mnctas)a2tm( oot1oex  o3iatfsDrmnvp t0 etrmrcoa1fmte n o;s0 2xr(r no4opte fcs ( a2rrxrp;t1texnmfcilt a2ea( on(0 exrxrcoy1lpD livs t setm(m3iu1llen ivias aDtm(r ;o4alxoifcilsls eau s t)aexnir iytfm ranvsl(0teuoimpny1omenmnvi tfs2umuroot0opxoif3taslm2ra(vp;(4artoxrctadomD ai o;t trtrio oudapenlicslt) Dtaur no1tptniiciltfsDranmo t4trxnmrcoadlp  livi;()srxmim oy1apteliesa(  2tr(m ot0olxomociys aDemuvsnt4aeenio iatfp rluvsls t2tmio ou4apenlfeiltfarraumooo0apto feiadfsDumn s;t)tetnif ia1fmD luvil(0setm(o3nu4alee ietls srua(roou0alxo feiyt mDeluvp ()tltoif3iytlateai s s) etm(opoudal n fctasfs2trxrpno0teen i3tad mDuln o;t0arxrxf3ia1op ran sl()srumim ou4lme  nesas)a2tr(mpnu1alt mi3iat s2eau o t)altoifcoytomte uvi s  exmir oo1olen fesas sDumxrpoo1alxnmo3iyt m2rlump;()aetoirciodlp rau sls0trtoxm3nu1lmtelivsls sDtaxroot4tltnioetltfs ul( pnt4trermf to1lp  aieslt)sexrim io4omtnlicias sDuaxrp;u1oeeo fctas a2rmnvo;(4teenmf iodoateaues (0s2uoxopiodlmtnliei sfsrumumo;u4olxoiiciatfs2rmuvp;(0treoirciydopD anvo;() exm(m3oy4ame mfvi ( aDtrx pno0texo ieils s rmnms;t0trxrxr ta1lp rln o t)teuo(o3iy4amtelfct sf Dtrxm oo4olx mf3tyd m2uan o;(0 leomrcoodfp rlieo;() 2xr(r nydap nmneia(faDra(mpnt4olxnmoeiydls eanvp;u0alxoxr3oodoa elnvols) 2ur(o nydlmtelnvsat artax oou0tle mieiyslaDrl(vs (4alerir3iy1lpte uvilt0 2tm(r3nu4apeelictlt)srtau pot0ole  o3ils s ul(mp (4aetoxocoadfp eln o t0srtoim3ny4lltemfetas artru  no4tpenifetyd sDua(monu0 exrmfctydla e u sls0 eumir oy4olte nctltfsDrmxmp;t4texn o3tls s rluvo;(4tlxnio ootoaDelueil( srurxr iu4olteliesl(  rtau p;t0oexo ieils s ra(vont4 etoxf3ta1laDrlnvi;s0s2umxmpnu4ameelncsatfs2ua( ono1tlx moeild aDel(mp;t) leomocoydlptr uvs;s sexo(m oydlptemnvsas)aDrru  ;u4tpen feiydlm2emuvonu4 renxf3oadfa r uei ()sexrxrpiudape lncs t)artrx oou4tleo fetytfmDeauvo;t)artoxr3iytoatelu sls)truoxopnodolt mnet t)a2rmumoot1oleoioeiydfaDeau snt0 rxriocoy1opD li o s truoio3ou4ol nlnet () 2rr(mono0oeeomfeiaslm umnmsnu)aeerif3oodfp eanvi ( teur(o nodaptelnei sfaruaxronu4texn oeiytfm ua( p;t0arxrir oodlpt  neo;t texr(opio4ape lfcs t) Dtru ooo4alx  fciysfaDemn s ()aetnio3oo1omD ln sls)seum(opoodope mnet tfa2rm(m oo1oet mieiasls2umuvo t0 etomrciodfpDelieols0srxm(o iudaltemfvi tfs2ta(m nu0ape io3iasls2eauvp u4treoxr oydlpD aiei;t0 2toir3ou1lptnlfes t)sDtrurpot0tpeoif3tlsls ulnvo ()areomfcoodfptrauvilt0truo(o ou4oltnmnesls) Drrx poo4alxo i3iys m2ulnmsnt)tetrmf3tytfat lues t0srxo(o3oydlp e ivia(fa2ra(mo;u1tetomfciadfmDulump (0aeenif3oydoateanvs;t0trur(rpnydlme micia(f 2ta(rpnu1texn iciltlmDeau o;t)aexrir3todopDrlnes;s0texo(o oydamt mfesatfsrrrxmp;t0tet mfetydfaDrl( o u0aetomocoydlateai i (0s2urxopou4apte ictl(f 2umxmp;t4oee ifctydls2rm(vp u0 rxoif oatfat anvols  rto(r3oo1op nlfcs (  rrr( o;t0olxoifeiydfsDeanvs;(0texoxf oydlmDrli o;t) euoxo oodap  lnviasfaDtrumont0opeoiieiltlm2ran snt4trerif3totfm   i i;s)setrxr nydole  fctasf 2ur(rono4alxn i3iad m2emnvo (0alxoiocta1fptraues (0t2xmxrpnu4openmieia(  2rm(r ;t1ale  o3tasls2uln p;()texomo3oo1lpteln s;s0s2umxr oydom n fcslt sDururpno1optomociyt m2ul(mpn()texrmo oytlm rai o;t)s2xr(r nydame lfcilt) rtmxr ;o1tltoifcils s2rl(mo;u0tleomr3iatoat lneil(0s2uo(opoo4lle licilt  Dur( o;u0oltniocild s uln onu0aleoxrcio1lm eluvi;() exmxo3ou1amtelncs s aDua( poo1oexoii3iytfa el( p;u4 ltnxf3tatop r i s (0 rtoxopoo4lmtnlneta()s2rru  ot1oleo i3iysfs2ul(ms u4tleomr3io1fpDeli ilt)teum(m nydamenlfcilsfs2rmxmp;u1tptnioeiltlmDrl(vsnu0tlxnxf oodfpt aneils) 2tmirpoy4lpe licsls  rtru o;u0tetn i3iad m2rmu s t4 leomfciy1oat  nvs;t  ruoxr nu1lptemict (f 2umu  ot0aleo o3tld s2umumont4aexoxrcty1lpt anvs s trtrir3nodam e nes t) rtru  oo1aex  oetlsfaDuauvp u4alxomf oa1fa r neslt srxmxrpiudame licilsfsDraumonu0tlxnifetat aDeau p t4 etrif3todfp raneo t0seum(o3io1op e fes s aDtru  nt1apxnioctytla2umuvsn(0 lxrmociatlptrlies;s0texr(o3oydapt mfvsas)artax o;u1texnmfctysfm2ea(vs;(0aeermo oodomt livs t)srxrxr3iydlltn fetat aDtaxmpot0tlxnmf3tydfa rln o;(0tetnmf3ta1omtrlies t)s2xr(opio4open feias  2uauro;o4aex  icias a2ulu snu4arxnmrctatfptrli sl(  rurimpiy1ole mivtat) 2umx pnu4olxnio3tldlmDrmuvs t4aeerxo tadoaDe nesl(0s2xoim ou4omt lfcsl( s2raxr nt1tpt iietyd m2elu snu4tltnif oytfm  ln o;s) exrim3nodol n neta( sDraurpot1olt iieiasfsDuanmp;(4aetriocoa1lpDraueo;s trto(rpno4optnlfct ( sDrr(ro;u4alenmi3iasfa2ea( p u4 rtnmo3iytomD li i;s) exrxr3oydape lfct s a2ua(rpnt1oltomfetydfsDrl(mp;(4arxnmr3tadfpt luvo;t0trumio nudoptn fesa(  ruaumpnt0tpt ioeiatfa2umn p;t) eenxo3io1fmD lieo;(  etr(r3nydom emnvs ( sruaxr nt4optn oeiysfa2rl(vs;t)aeenmocty1laDelivs s trxrio3nu1lpenmneta()s2um(r ;u0oeeoifetatlm2ranmpnu4 etrmf3tytfaDr nvi t)srxmxmpiy1lleemneiasf 2uru  ot1tet io3iatlm ea( o u4alxoxocoo1fa eaiesls truo(o oodomen fvta()s2tmxr nu1oex  fciytfm eau pn()teenxr3ootoaDeaueols)t2ur(opou4al   ivils aDrrx p;t4altoif3tld sDrmuvpnu) eeniocoodlmDrlu s t srurimpnydllte fei (f 2raurpot4tpeomoctat sDrlnmp u4artnmrcootop rluesls s2tm(r oodopeemicia(  rrax  ;u4tpt io3tyslsDulu on()alermo iydlatrlueilt) rumxrpnu1op n ncsas)s2ur(ro;t0tlxn fetysfsDemu sn()aexrxfcoydfptrluvilt0srum(o3iu4olt mncsasfsDtmx  ou4tptoif3tysfmDrm(vp;t)areoiociatfmDean s s)srxrxopio4ap e nei ()sruaxm nu4apt  feiltfa2uanmsnt0alxnmo oy1la rlu s;t s2urxr iydllte ncsatf rtm( pnu4apen f3ildlaDemnvpn(0altnxr oy1fp e u s;s) 2xmir io1aptemiviasf rurxrpoo0oexo fciltfa2em(mo t4artnxo ia1lateaieilt)t2tm(mpny1ope mivsl(fs2raumonu1tlt ioctys aDrlu s t)trtrxr3oatlmtrlueil(0t2ur(m iy1lpen fvi s) rrrx p;o4optnioeildls2ul(vpn(0arxoxf3tadomD  n s s0t2ur(r iu1olt  neias  rrax o;t0olt mieild m emuvs u0 etrxo ia1laD livsl(  2ur(rpno1ap  mnetlt  2tau pot1olxn fetytlsDemn s u4trxrmrcoadoaDrluvo;t texmiopiy1alee ivtl(  rumuroot0tlenmo3iad m eauvpnt4texnxfciodfm  aivsl()seur(o nydap e ieslt  Drmu poo4aexoifciaslsDel(vsnu0tlxrmr3to1fa e u ils srurxr3iu1oltnlfes t)arum(moou4tle mociadla2rm( p;t0 lxomr3oy1lat anvi;() rurio iodom   fes tfsrra(  nu0opxnmf3tasfm2ra(vo u) rtoif iotlmt lneo s  eum(opny4omtn icil(fsrurxrp;u0oex mictyt sDranmp;u0tlenir to1fpDeli i;s)trurirpnudlpeemnvs ( a2ta(rpnt4apt mfeiytlsDem(vo;u0trtrir tytfm rlneols) eumir nu4aleemiei ()aDrrx p;o1olx mfeild aDeaumo;t)trxoircoodfmDr uvsls0t2uo(m oy4ol nlnes t) Dtmum ;o0aleo f3tlsfm2umnms (4 rtnifcia1oat  uvo s0t2urxmpnudal emnetls)a2umxroou0oetoio3iysfmDuaumo u)alenif3totlpD luvs;s)srxrxo nudalenlnctas)sDtrxrp;u1apxn ietls sDea( on() ltnxrctodlm  ai i;(0setrxm iodamtemnesasfsDurxr oo0optnif3iydlm ua(vonu)aexnxo todlpte n olt)t2umio3oo4lpt mneias aDta(mpnu1ape ioctysla ra( o u) etnxfctodoat  iei;( teuoio iy4ale livslt  rtaur ;u0aee mf3tatls raumo (4tlerio3oodomDe ivi;s0trurxm3oudlle mncia(faDrr(  ;t4tpto ieiydlaDemump u)trtnifcoatomt  nvi;t)teuo(r3nydomtnlncs tfsrtm(moou1aex ifetytlsDelu on()arermo tatom  aueo t0trurimpio4omenmnetl() rrax pnt0tpx moeiat a eauvpnu0artnir3tatfaDe n ols  euo(rpiodlmenmivslsf 2rr(mpot0tex  ociltfs ran o;u) lenif3iodlaDr ivslt setoirpiy4llt  fcsa()a2ra(rp;o0aleoio3ildla2ulumo (4teerircoydfaD au il(  rxrio3oy4lpeeliei (f Dumx  ;o4olx mfeiadla umnvpnt)teeoir3ootfa e ieo () rxrxrpny1lm nlfcta(f 2urum no1oex  feils sDraumo (4tlxriocootomteaivo t0srxrxrpoydlm nlfeiasfsDrau o;u1opto ietyt a uln p t0areniociy1latrau i;s)trtoxm3nodap  mneslsfaDtaurp;u1optoio3ias a2eau s u4tlerif3tadlmDraivo (0 2trxo nu1alenmnciltfaDtaxmonu4altn f3tldfaDemu o;(4tltnmf3iytfm e n o s0 eurirpno4amtelfci t)sDta(mo;u1aptoiocild aDeau o;t0aexoirctytomD aieo t0 exm(rpoudamtemfei t)sDtm( poo4tlt  oeiysfm uauvpnt) eenmrctadfmDe ues;s t2uriopnydlpen ncsl()aDta(r ;o1alto i3iyd aDumuvs;t0 rermfcto1op   nes (0teumiopoy1optnmfes t  rtrumpno4ole  f3tldlaDea(vs ()tlenio3oytfp e uvo;t0s2xr(opoo1ope mnctat a2rrur nu1alxn octlt aDemnmp t4artnmrciy1omDr ueil(0 2um(o oudlp elicia()arrax pnt0tlxoif3ils a2eanvpn(4 leomfciydlate uvs (0 2toir iy4olenlnvilt)arum(  nu4alxoif3ils m rau o t4 ltnmr tytfptraneo;s) 2uo(o iodomenmiei t) rrrxrpot4tetnifctysls emu p t4trxoxo ta1lp  luvo s0sruo(m3oy1lp nlicsltf ruaurpou0oetnmo3iatlm2ua(mo;t0artoir3oytomtelueols0 rtmxo3oudomtnlfvsat)aDurur ;o0tpt mfetlsfmDeanvo;u) leriociotlmtr ueilt0 2xmxo ou4lmtn iet tfa2umxrp;u0oetn icils m2emnms () reoxoctodoat luvsls)t2tr(o3iu4ol n ivi s sDtaurpou1oleomf3iatla2ra(ms;u) etnmr3to1opDelivo;s0t2tm(m3ou4amte neils) rur(mo;t4tpe  icilslmDrm( s;u)artnirciatomDrlivo t setm(r io4amtemiei ()srrmurp;u4olen iciad mDemu pn(4tlenmo tytfp eluvols)truoxm io1lpeelfetas)srur(ro;u0tle mfeiyt mDem( s;t) rxoxocto1fmteaueo t) euoim3nodomtnmicias)s2uaumpou0oleo fetatlaDulnmp;u4texoio ootoate n i t) euoxmpiu1ole mnvs t) Durum ou1optn i3ilsfaDrlnvs;t4trtrxrciy1oaD  n ol(  rtoio nudlme livtas  rra(mo;t0oex mieiydfm2rl(ms (4tlermr iadfmD lneo;()teurxrpio1lpt lnvsl(  Drau o;t4tlxo o3iasls ra( s;t0tltomf3iydlmDeaieo;t)sruo(o3iudapeemiesasfsrtm(rp;t4alt if3iltfm raumon()texnifciodfat  u s;()teur(rpou4am n ivsa(  rrr(rpoo4tlxn f3ias m2rmuvo ()trtnirciy1omtr n sls) rxmxm ou4apt lfvsasfsrumx pno1altnif3tys a2rl(mp;(0 rxrxociy1optrluvsl()seum(r3nu1lp nlicia( aDtax pnt1oet  i3tlsfa ua(ms u0tltomfcty1fpt  nvi ( t2xmir3no1ape lfes t sDtm(mono4ape iicils a eauvp;t) lxoif oodlat aneols)t2urxopnu4oltemiesatf rtr(rp;t1tpx moctytfa2um(vp () eermr3oydomtelueolt tetoxr nudolt miciat aDur( pou0tpt if3taslm eauvpn(0 rxriocoodoaDrliei s)teuoirpnodop nlivils)a2umu  ;u4apxomociydfm2ul(mp;u)trtoxo iadfmDr nesls)sruo(o3io4lle  fvtlsf Drmx onu4open o3ilt a emuvo u)texnifcoo1fmte n ol(0seur(rpnu1lptemivsl(f rrrurp;o4tpeniicils a2rln o ()aeenxf oa1omDraies s0trxrxmpoydom emnvs t a2rm(mooo4tptomo3ils m2em(mp t)artoxrcty1om eli il( t2ur(o iydopt mneias  Dtmum no1ale  fciadls emnmsn(4 lxnir tadoa eaieslt s2urxrpio1ol nmivi t)sDuax pot0ole mfeiasls um(monu0tlerxo3ootlateluvolt  rxmxo3no1llte fct ()s2ra(roou0oet iicilt s2eauvo;(0tltoif3ta1lpDean il(0 etoxr3iydam nmnet sfs2rax pnt4apxnmfciad mDrl(vs ()tltrxf tytfmDr ivo;( texoimpiu1olen nctasfaDraumono0teto ocild aDrauvpn()alxrmo3oodlp  lu ols0teum(r3no4lm  mncilt) 2ta( pot4ale ii3iat a2emnvpnu4alerifciatlpD ln o ()s2xoxo3nudalenlfvsl(fs2ur(mpoo1texnioeiat a ul(vsnu)trermrctydfmt  n o ( t2xrxo oydlmtnlict ( aruru onu1aetoifeiysla2rl(mo ()texomrctadlptran i;s) etmiopno4lp  mfvsat a2ua(monu0aet  feilslm2rmnmp;u4 reoif3oy1om eaiesl(0trxr(o3iu1lm   nesa() Duau  ;o4opxo feiatfaDrm(vs u0aetomo3oydoa raiesl(0 rxr(o iodom  livsatfs2tr( pnt0oltnmoeilsla2um(vo;u)altomrcoy1oat  ivi ( seuoxm ou1al n nvt tf rua(ro;u0ape  feild m rm(vo;u4trtrxrcoadlmDeai o;s)tetm(m3nu1opt mivilt a2uaxr ot0apeoifeilsfsDumuvsnu)texomfcoytoatraivilt)s2tr(m3oodlltnmicil()artm(m no4apto icildlmDra(mo u0 lxnxr3todfpDrlivo t)srtmxopio4lp nmivi t a2rm(  no0alx  i3ilslmDra( pn(4 eeomrcta1lptrlnvils  etrirpnodap   fvtasf rtmxm nu1oexnifeiasls2ul(vp;t0 rtnxr oa1optr ies ( srtrim oodlltnmictlt  Dumuront0teen fciltlsDrl( pnt0trermf3ta1fm elnvs t0s2ur(opnodlm  lnvia( srtmx onu1tlxnmfciltfa2rmumsn()trtrirctatlpteln il( texoimpiy4lpt mfeilt aDtru ooo4olxomfcild s ul( p;u4 lerxo ootfmDe ivs ()teuoimpno4omtnlncsl(  2tmxmpot4apto oeiasfm ulnvp (0treoir iatfptran sl(  eurir iudamte ictls)aruax  no0oex  iciasfsDuan s;(4 eenmfcoo1la eln o;s)t2tm(m ou1olt mfesls)aDtmu ono4tpenmietysfa2rl(vs t0 reoiocoatlat auvi;t)texrxmpoy4omtelnvtltfsDum(mo;u0oexomiciyslmDrmu o (0texrmo3oadlaD lieilt0seum(m3ou4ll nmnvsatf Dtr(  ou1oltn oeiatfmDel(vp u0tetoiocoatfa  aivo t) rumxr nodomt mnesls)sDra(m nu4optoii3iadfm2rm( p t) ltomfcto1laDeau o;t) eumxopoo1al emivsltfaDtrurpnu4tee  ociysfm2emn o;u4 rtrmr oytlp  au i;s  2uoiopiodlmenmnesl(f Drr(moot0oexomoeildfsDem(mp;(4 rxrmrcty1faDrauvo;(0 2tmirpnudop emncil(fsrum(mo;t4aptniiciltla rl(vo;()texrmocootlmtean ols trur(o iy1oltnmfvtls)s2trurp;o4tlxoifciyslm2emu sn(4tltrxf3oytfaDelueo s  2tmxo3ny4op  lnci s)arrm(mo;o1tlxnii3tldlsDemnvpnu4aleoxfciodlm rauvilt) 2xrxr ny4ol emicsl(  Durum nu4openmoetatls2ea(vsnu4trtrio ia1omt aivils0t2trir3oy1om eliesl(fs2rm( onu0apx mictas m uluvp u4 ltomf3iadfp rlivo;t s2to(r3ou4am e nvt s aDrm(  ou1altomfctadfm2rluvpnu0teeomo iydfmDeaues;t)t2to(mpno4op n nei s)sDuaumpnt1ole miciasls ea(mp (4alxoxr3ia1fmDe u il(0setoim oo4oltn netas)srraurp;u4aee mi3iatfmDrmuvsnt) lxnxo iy1lpte u i;t) 2tmxm nu4al  mnvs sfsrtr(mpnt4oee  i3iltfaDulnvpnu) ltnmo3tadlatrln olt) rxm(o nodlmt lictltf Dumx p;t1opxniietydlmDemnmp;t) etoir tytfpDr ivsl()srum(o ou1apte ivtltfaDrru  oo0ale  ociys a ua(msnu)trenxrctotlm  ai s;()t2uoir nu4lp  livsl(f 2ra(rpot4texnmo3tldlsDea(ms;t0tlxnxr io1lmD anvo;t  2xoxr3iy1om  lfcs s) ruaxrooo4alxnio3iasfs2uan p t4alxrxocoatfa elu o;t0 exmxopnydlpt lfcs ()srtru o;t0apeniieiasla rl( s u0trtrxfcoa1fpD lueo s)s2toxrpnu4apeemfctl(f Duaumoou4aexn f3iasfa eaums u4tltoif3ty1fp  auesl()seto(o nu4apeemnvtas)aDumxronu4tet mfciys aDemn on(0altniociatoaDrlnesls s2trim oo1oltemnvt tfs2rrurp;u4apx miciat m raumsnt0tltnmrcto1lat  u s s  rtoxo iu1ope  iei t srrax onu1tlxoio3tadfa ean s u)texnif3oytfpDrai ils0teuoxm iodlmeemfetl(fs2rrum ;o0tee ii3tatls ra(vp (0 lxrmr3tadla r ueo () rto(mpiudop elfvils) rrmumpnu1apenifeiadfaDel(vp (4trtnmrcoo1omD  ueil( texo(r3ny1lmtn feia(f ruax oot4apt mieiasla2ra(ms ()texrif oydom ran s;t0s2tmxmpio1lm  mfesls  rrru  nt1oleomictysls2uln pnt4artrxfcta1om r u ol( t2to(r3ny1oltn ieiasf rtax oot0apx  oeiltfaDua(mont)tetrif3tydlm rlneil()s2tmir oo1ape  ictatfaDtmxmooo4tpe mfetatla ranvo;u4artnxo iodfm eli s;(0 exmxrpoydlle mfvtltfsDtrumpnu1aeeo ocildlsDrl(monu0aetrxf3iadlm e nvils0sruoxr no4aptn fviat)srtmxm ou4tlxo fctldfsDumump;u)tetrxrcia1om  aneil(  ruoir nudopt mieias  Dua( o;o4oleomietltfmDem(ms u)tlxoif to1lmtraneils)truoxo3io1ameelnci tfartm(m no1aet  ieiltfm2rmu o (4aetrmociadla  aivsl(0srurxmpiodole lnvsls  2trur ot1olt io3iatfm2umnvo u)teerif tytomtraies;t  etm(o3iodlpen ivi tfsDrmu p;t4opeo iciadfs emn sn(4areoxf3iatfat lnei;t0s2xrxr oo4ale liesa() rtm(m oo0aeeniiciat m umumo (4arenmrcoytfm rlu ils)trtoxm3nudol   nct sfartrxrpnu0alx  ociys s ra(mp;u) renmocta1fatran s;() rxo(opiodlm  mietas s2tr(  oo0alen o3tydfs umn onu0 lermocoy1fa rlnvo () rxr(o iudopte neiat sDtmx ont0tpto oeilsfa2ra(ms;t4altrxociatfmt  i ols0 rxmxopiy1omeelics s  Dtruronu0oltnmo3tldfm2ra(vp t4tlermr iydoaD aiei;t)srtmxo ou1ap nlieias s2ra(mp;o1openiictlt sDea(mpn(0 rxoio totom  aiei ()setmim iy1omtnmnvtls)a2ra(r nu1opeoioeilt s2rmn s u)trtrmo tadoptrluvs s)trxrxm3oy1llen ivia( a2uaxro;t4ale  ocilsfs ran p;()alerxfctotfp rai s;()sexmim3no4ameemfet t) 2tmxmp;u1tpxomicils a2rmn s u0tlxoir iadlmD  u i;t)seur(o nodalte fctas aDtm(m ;o1oltnif3iytls ean sn(0aetrmo iydlm   nvi s0s2xr(r3oo4ope licsa( sDua( ono1tee  oeiad m2rm(mpn(0 etoxfciadlm rau slt sexoim3nu4lpeemietat  Drrxmo;o1openifctlt sDuanmp u)trenmr io1omtelneil( texoxopiu1lm emivi sf 2tmuro;u1teto ictat a el(vpnt0teeomf3iytomteai i ()sexo(rpny1oltnlncslt)s2taxrpou4apxomieild s umnvs (4texrio oadfmDr ueols)sexm(o3nu4op n nvtls sDrmx poo1texo f3ias a2eau p u0arxrif oy1lmDelivo;t0seurxr3oy4omen nvias a2rau pnt4aleomi3iad sDulumo t0teermf todlmte n ol() etm(r nodamtnlneslt  2tm( pnu1tpxn oeiys a2eln o (0trxoio3iytfa e nei;s0 rxoxmpiu1am nmicsa()arum(ro;t1aet  ocils s2uanvo;()alenircoadla   u s t0 rurxrpio4apt lfcs s  rta(rono1aeenmfciysfa2rluvpnu) lenmo ootlpD an i t0tetr(opnu4olt  ivi s) Drmx p;o0opto ociytla elumo (4arerxr3oa1op  anes;t0t2xmxm3ou4al  mfesa( a2tr(m nt4alx ioeiysfaDea(mp (4trtrif3oy1fptr ueils)trxrxrpoy4al emnvsls a2ur(r ;u4apxn f3tatlmDrlu o u0 ltrif ootfa rln ils  rtrxmpio1llt lfctl() rra(r ;u1alxnioctyt m emn p;(4 rtoioctytlpt lueilt)srxmxr3oydll  mfcsltfsrumu pot1tptnioeiatlm2elnvo ()teerxf3oydfatr i sls trtoimpno4op elics sf 2tax ont4alxo fctasfa2elnms ()aeeoxrctodopDeli o t0trtrir nu1lm   feils) 2umx pno0tltoioetas a2ra( pnu)artnmo oytom e n s;s)t2umxo3no1omte ici (fs2rrx pnt0tetomo3iadfmDemuvs u0 lenmf3ootlmte uei (0seurxm3nu1al n ieslt  2ururoot1aetnioetadls emnmo (0altnmf ootfmteai sl(  rtr(m3io1ape mivs s)sDrr(r no1tlto f3iadfa2eln s;()altoif tytom elies;s)setrxr iu1lle  ivsls sruru  nu0opx  icils s2emnvpn() ltniociotlm rluei;s)teuoxr ou1amtnmfctas) rrm( ont1aleomoctltfaDrlu snu4 rtnxf3oy1faDelivi (  2ur(r nu4olen ies s  rtmxrpnu0oet  oeiasla ea(ms;u)aetnxo oa1lp  auvo;t0tetmxrpou1olte nvslt)aDur(m ;t0opxn ociatlaDemnvo u4arenio3iydlat lnvilt s2xr(opio1lmeelfesl(fsDraur oo4tlxoioeiat m emnvs t4tlenir oadfa   ivi t)trtm(m iydamee fcia(fsDrmu  oo0aex  i3ilsfaDrl( s t0trenxf3ta1fatranei;()trtrim nodopenlfvt t)s2rr(m nu1oeen iciysls2ra(mp;(4arenmrciotoaD lnvols)s2xo(o oo4oltemfetl(f rta(rooo0ole  fciasla eln s u0 eerxf tytlaD lieol(0 2uoxm3oudameelncsatf Duru pot4opeomi3iys a2emuvs ()teermf iytlpDrluvsls0sexmim3iodole lnesat)s2rmump;o0oeeomoeild aDum(mp;t)altnmo3oatfpDe ieols) 2urir3no4lmtnmfesls) 2rr(r ;u1tpxniietysfa rmnvsnu0arxnir3iadoaD lu i (0srur(opiodamenlivs tfa2taxmonu1tetnioeiltlm em( o;t4altrmr iytoatelivols0s2xoxm3iy4om  mivtat aruaxmpno0oetnmfetltfa ranmsn(0aeerxf oa1oa  aivo;t  rtoio iudlptnmfvs (  rururpno4olxomieiydlm umu p u4 ltomr oadlmt luei;( sexrxopiudlmenmfcs ()a2ra(mp;o4tpx ioeiyslm2um( o t4aeermr totlpDr nei s0 etmio ou4ll  lncslsfarur( oou0oexoif3iadlmDrl(ms;u) ltrxoctytomt aivs;t  2uoim3oo4ol nlfcs s a2umxmpoo1oeeniociyt m rauvsnt0 lxnxr io1la raneo s)t2toio3nu4ome mieia(fa2ur(  ;t0oltnii3ildfa2uau snu)artnio3iy1oa r nvo;(0truriopio4ap nmici sfs2rrumpno0olx  oeiasfa rln snu) eeomf3iadomDelnvols0sexoxm oodlptemfcta() rtmumo;t4opeoii3iltfs2umuvsn() ltrircoodfmD aivi;s) rtmir iy4op nliviltfa2rmurpot4olt iociyt s umn sn()altnxfctydla   n o;s0trtoim3iy1om emfesl()s2rmxrp;t1apto iciydlm ulums u)tlxoxrciytlm rluei;( sexmio oodapt mivil()sDrrxrpno4olto oetld s2rl(vsnu) rtoxo3tytomDeauvils tetrxr iy1oltn ivsa( aDtm( p;u4teeoioeiytfsDuauvp t)aeermf iatfm e ueslt)trumxr3oodlp   feslsfa2ur(r ;u0aetomfciadfsDua(mpnt)alxomf3oydomt  ieil() ruo(opiu4ap  mnes (f 2uaxmo;o4aleoii3iltfm ran o u4trxrmociotlmDean il( t2ur(m3nodlmtelnesa(fa2uaxrp;o1apenioeiadfsDul( p;t4altnxr oa1omDeauei;s tetoir io1op emnvsat srra( oou0apeomoeiatfm2ua(vo;t4 eenif iydoptran i;t0 rtoim3nudlltnlnet s)sDum(ro;t4apxnmictydls ulu o t) etomr iatlmDr ueilt0 2trim3oydllen ncia( sDtrxrpno0oleoii3ilslaDrmu snt4artoxr3totlaDrai o t)trxm(opoo1am emicia( aDta(m nt4oltoifciadlm umumonu0arxrxoctydlpte i s;t  rtrxo3nu1lpen fcs (fsrtmxr ;o0aexomoetyd m ul(ms (0areoio tytfmt  ies ( setoir3ny4lme mnvsltf Drmum oo1teeoiociytls em(mo;t4 reoxf iytom rli o;t)t2to(o3nodop  mnvi s) rtr(mp;o4oleomfctldfmDemn p;u0tltnmo oytomt auvsl(0t2tm(rpiy1apenlfct tf Dtrum ot1oeeoiieiysls rlnms;t)altrxfcta1oa eluvsl( srtmxo3nu1op e nctat)aDumxroot0aetomfctysfs ranmpnt0 rtnmf iy1lmte ivi;( srur(r iy4lpt lieils)sDumxm ;o1tpe  feild s2ulnvo;u0alenmr3to1fpDrlnvs s)trumxmpnudop  livs (f Dtr(  ;o1opeomicilsfaDem(mpnu0tleoxrctadlm  lueols) 2xm(m3ou4lp nmics ( artmxro;t0aptomiciat sDea( o t4 ltrmo tadfmtrlu s;t) 2umxo3oy4ap elfcias  rrrum oo0alt  o3ild aDeanvpnt) lxrif oodlm  aies;t0truoir oodop  mics s)s2rrurp;u4ale  ociyd aDrmuvpnu)artrmf oa1fa eaiei;s) 2urirpoudlm  lfet (  rraurpou4tlt  ociys a2ean s;() etomo iydlpt lueolt)s2xrxm no1apt  neilt)a2rm(  ;u4oltomoctytla rauvp;t)tlerio3oatfa  lnvs;(0t2toxm iudom emivsa()aruax p;t4aet iietlsfa rm(mp (0aetnir iytlatr ies;()texoio3no4olte nvt t srtaum nt4opx if
\ No newline at end of file
@@ -0,0 +1 @@
+ues;t0trxmxmpoy4omt mieia()arumumooo1tltniieildlaDean o;t0aetrio3ty1lptrai o t0 eum(m nu1lmee fet tfsDta(  ou1texnmoeiatls rl(mpn(0 leomr3iydlmDraiei;t0 2ur(mpiy1amtnmieias srtmxro;o4apxoifciytlaDemumsn(4tlxrioctadomD lu ilt0tetoxr3io1ll   fesls  rtaump;t1aleo f3iadfa uauvs ()texnxf ta1fptr nvolt t2xo(m3oudllte ivia()sDta(ro;u4oeen oeias s2ea(mp;t)tltnir3tydop e ueslt setoir3ny4lm  lfes t a2raxm ;o1tlxoif3tytlaDua( p ()trxrir iadfmteli s;s) rumio oy4lpee iesls sDrmumono0tlxnmiciasfm2eau s () exoxf3oy1opt lieo;s) exoxopoydale mnet sf 2ua( pnt4aleomictyt aDuau s u0aleoxr oy1fp e uvo;(0srto(r no1lmtn feia(fsrraur nt4tet mo3taslmDra(vp t)trxnxociadlaDelu ilt)sexoio3ny4amenlfetas arurumoot4oetoiiciytls2umuvp t0trtrmocoydfaDranei;s) rxoim3oudomtelneilsf Dtaumoou1optn i3tad aDelnvonu)trxomr3tytfm raneolt0 ruoimpou1ape lnvi (faDtmxr nt1oltnif3tls a em( s (4alxnxo3iy1omtr uvslt) etrxr nu4apt  fctas  rtax oou4oex ii3ild m2rlump t0 ltoxo oatlp e ieo t)s2xm(opiodomtnlnctl()srurx  ;o1altn i3tyt a ra( o;u)aetrmr io1lm  anvo (0 2umxmpoudome mfvias aDrm(mpno1aee mfeilt m ulumpn(0 leoxr3todlm rln o (0 2xrim nu1am  mnvilsf rrm( o;t4texoifeiasfs elums (4tltnxfciatoa rauvil( sruoxmpoy1al emietasf 2taxmo;u0opxn o3ilt sDem(mont0 rtrifcta1fm rln s (0s2xmiopny4lpe  neslt)artr( p;t0texo oetasfaDelnmsnt)tltnif3to1oatrluei;s) rxoim3oo1amen nei s)s2urum ;u4aee io3iltfaDemuvon(0aetomr3ootopteau o;t  2ur(rpno1lm   neslsf 2trxront4tpx io3iys a2ulu pn(0aleoxrcoytlmD  uvilt)tetr(rpoudalte icsasf Dtmxm nu1openmfctatfs2el( p;(0trxoir ty1la eaueo s trtrxr oudop  lnetls) 2rm( pot1tpto i3ilt m2em( o u)aetomo oodoptrlu o t)srum(o oodolt  iei s) Dtruroou0oet mf3tlt a rmu onu4 lxrmf oydfmtrauei t s2umir nydlmeemnvias)srum( onu4tetomictytfm2el(vo ()aeeoxr iy1oate ieo;(0t2toxr ny4al nlneia(fsDtau  ;u1olxniicilsfsDelu pnu)aeerxr3iodla   ues;( s2xoim3ou1lmt lfvtas) 2trx o;t0oexnifeiad m rluvs;u)trtoxf3to1lp eaivsl( setrxmpoydlmenmnei ( s2tmx pnu0ale  o3tlsfa elnmp (0tltnif oadfat anei (0 2umxr3no1lmenlicta() Drm(r ;t1teto iciyd m2umn p t0tetnxf oytfmDe uvi ( t2xmim ou4olt mnvia()srtaxr no0optnmietyslsDea(vsn()altrir3tadfp eln o s setmxm3ny4ape  ivi ()srrrxronu0olt ii3tlsls2ul( p;u4texrir3oytom raiesl( s2xr(r3nudam  lfvtls  rra(  nt4tlxnifeiysls umnvo;u4 eenxr3oydomDeanvi;(  exrxo oo1lpeelfvsl( s2trxmo;o4alx iiciytlsDrlnms ()tltomf iadlpt anvo;(0 etrxmpiy1oleelncsls srrrxmono1alt  oetltfmDuln snt)arxrir3to1la   i ils) rtoxopnu4am   fcta(fa2um(roou4tlxnif3ildls2rmu s;(0tetoxfciadlpteaivsl(0t2xoxr no4omtemnvtl( s2umumoot4olt iieiadfm2ranvp;u0areoxr3oy1omD  ues;t trtm(o nudamee fvi t)srtmx oou1aeeomfctydfm eanms (0 lenif3iytomtr n i;s  2tmxopiy4ame lfcsasfa2trur nt1aetnmfciytls2emnmpnu)trxoio iydoa   nvolt teumir oo4aptemfvt s arrrum nu4oeeo feiys mDrmnvsnt)aetrmf tytfat aivilt) exoxr3oy4lpe mncils) Draxmoou1tpxnmictldlmDeaump t4teerio oodfa rlivi s0srumxo3nodoltn ivtas srraxrpou0aleo ieiytfmDul(mp;(4tlenxf oy1fmD luvo (0seumxo oodlmt  nvi (f rrruront1tpen ociysfaDrl(mo t0tetrmf oytom r ivs s)srur(rpoudalt lfvslt s2ta(m ;t4tee  fctyt aDrm(ms (4 eenxoctytfat  n o s  2xm(m3iy1ll  mfvta() Dtr(r ot1tetomietldlmDrm(ms;(0 reoxo iadlm eauvi;( t2tmir3ny1omeemfvtls)arra(monu0aptomo3tltlm um(vsn()alerxo3tydlptelnvo t trtoxm3oudome  ivi tfarurump;o4tlenifeiltfaDra( p;u) exnmocta1fa rlueo;t) euo(rpno4apeemnvs t) 2taxroou4alt  octys aDuauvo u) rtnmo tatla elueo;s0 ruo(r oy4altn ivt ( arumur nu0oee mfetys a2ulnvo;u) rtnxrciydlatr ivsls  ruoir3nudamt lfvi s)aDuru pnt1altomfetyslsDrmn s;t0tleoio3iotoaDelueols)trxmxrpoy4lpeelfcia(  rraurpot1oetn octatlm2elumsnt4 rxrmf totomteli s (  rxm(r3nydllen fetlsf Dum(mo;t4tlxn i3ilsls2rmnvs;() rxomr tydfmteai ols t2uoiopnodamee fvslsf 2tm(ro;u0alenmfctlsfsDum(ms;(0aexoir3iydomtelneil(  2xoxm3nudapt  fcs tfaDtru ono1tpxoiociadfs2eau ont4 eeoiocoadlp e uvi;() rtoim3oodllt mivi (  Dtru pnt1aexnif3iaslsDum( ont4 exoxr iytfaD ln s;( seuoimpio1om nlnetlsf rum(rpou1aetomo3iyslsDean pn() exrxr tytlaDeauvol(0 2um(o3iu4om nlnes (fsDrmx  ot0tex  fcildla rluvsnt4teenmf oo1fm e uvolt0sexrxr iodlp nlfeilt srurxrpot4opxomiciyd a2el(vsnt) renmoctydfatran ol( trtriopiu1aptnlnetas) 2rr(mpot1aetnmfcilt m uan p t0 reoxo3ia1op e u i s trtr(r iu4lmt lnesa() Dtrxm ot0openmietltfa rl( sn() ltoioctydom e neslt)s2umxr nudom  livs ( arraxrpno1opx moetaslaDem( pn()tlermr oodoa rlu i (  rtrir iu4op  lfci ( arum(m ot1texnioeiltfs emu s t)aetnxf oy1lptelues (0 euo(mpnudlmt lfvi s aDrax oou0tpeomo3iadfs ra(vpn(0aetomociodfpD luvi;t0trxrxrpoo4ll emneiat)sDurur nu0opxo fcildls ran p u)teenirctydfpD  n ils0tetoim iydam nlncta( arrmxr nu0aex  icilt m2umu o u) rtriocia1fpDeli slt0 eurxr io1al n ivs sfsDta(rpno1oetn ictytlsDrlnmo;() lxoir3iodlpteluesl()trum(opiodomenlnctl()s2umumo;t0oexoioctlsfm2um(ms u4 rerxo iadoa  ai o;( sexoiopiydlme  ies t)aDtmxmpnt1opx ifeiytla rl(vp;()tlxomo3todfmteli ils teumxr io4am nmfvta( sDrm( o;u0tpxomocilslsDua(mp u)areniocoydlpt lu s;s0srumir3oudol emncsat)s2tmu ono1tpto f3iasfmDumuvp;u0teerif iodomDe neils0trxmxmpoy1om  mfvsa( sDtrxrooo4alto fcilsfaDra(vs;() rtrif3iytoa e ueol() euoirpoy4altn fviat s2rm(  ou1optoiietlslm elu o;t)alxomrctotfp eauei (0 etrxo3oo4alen fes t)arrrur ;o4oexomi3ild mDuluvo u)tltnxo iodfm eluei (0s2tmxo ou1altnlietatfs2tr(r ou1tpxnmiciydfsDelnmp u)texnxr3iytoptr nes;(  rtm(rpio4lp  mnctlsfa2raxro;o4tpxomoeild m2ranmpn()tetnmf iytlmte ivo ()srxm(o nudam  lneslt)sDuru pou4alenmieildla2rmnvsnt0altrif3tadfa  livo ()s2trxmpno1ome  ivta(faruru  no4altomo3tysla2rlu sn(4tleoio3iotop  aivi t)srum(rpio1ome  fvtasfarra(mpno1oetomfeiydfaDrlump t4tetnif3ootomDelu i () eum(m3oy4ll n icils)aDrax pot1alx mo3ilsla2em(mp;t0aeeoir oadfpD  uvs s  exrir3nodom elncs t)sDrr(m oo1tee  fciadlaDua(vp;(0aexnmf tytfaDrlivils0 exoxm3oo1apt lnci (fa2tau  ;u1tlto iciadls ea(mo t4alenir3iadlp   u sls srxrio3oo1omtn fvsl( sDurur ;o1aptoioctldfs ranms u4tltnmo3todfpDe i s ( s2umxopoydol e nvsasfa2urumont0apxniieiaslm emnvo (4tlxnir3iotlptelu i;s  2uo(rpou1amtnlfvilsfsrua(mpnt0optnmfciatfm ra(vpnt4 rtnif iytoaD  ieo;(0teumxo3iy4om emivsl(farumum ;u4tlx mociydfs ra(ms;t4aeenmf3iatoatr uvi;(0 rxrxr nudlp elivi ( s2urxrono1tleoifctat s2rmuvs;(4tlxnmo3tadlp  ln ilt0 2xm(m iydlpeelivtasfsrrr( p;o4tpeoioctad m ean p u0tetomo3oatfat  uvo s0tetm(opoydal  livs ( sDrau  nt1tleomfciatfmDrln snu)altoio3iydlmt lnvslt)trum(r iudlm e fvta( aDrmump;t1opt ifciatlsDrlu o u) ltrio oatlmDeaues;t) 2xmxm3nodaleelivi ()srtr(ro;u4opto ieilsfsDrauvpn(0 rxomrciodfat au i;(0trtoxm3oydlp   ics t)a2urur ou4tpeo f3tasfa eanvs () exnif todfmD auvils)texmimpnodopee netas)aDta(mpot4aptoifeild m2ua( p u0 etomf iodoaDean s;( t2uo(r3oydlptn fvtl(fsrrmumpoo4olt iictasfaDeauvp ()tleomfcoy1fa rlu ilt trxm(o3io1ope mnesltfa2umu pnu0aexomictad m2em(vo u4 exomrcio1lmD livo;s  exmir ny1ap e nviltfsDua( pno4alt mo3tys sDrm(vo;t4trxnio3oy1op elivi s)tetr(o3oodlpe  fvsls sDtmu ont1oeeomocilsfm rauvp;u4tltoxrciatfmtran slt sexo(o nu1lpeelnvslt a2raxrpno0tleomfeiltlaDuauvp;t) rtomf3ty1fm   ivo;s) eurim nu4lmeemics ()sDtaum oo4olenioetysla rlums () etnxfcoydomteluvs t0 2tmxr no4amee ict () Dururonu4apxo feiadls2eau o;u0alerio iydoptelueo;s  rxr(o3iy1lptnlfcilt a2umumpou1aeenmoetlsla el(mo;t0artrio oy1fa  lnesls) rxmio iu4aptn nesltf Dumu ono1alto o3tlslaDulnvsn(4altoxfctytlp rluvo s t2xoir3no4apt lnesls)s2rr(m nu4olx  ictyt s rln s u0artnir todla raivsls)s2xrxopoo4lmtemiesas)s2umx  ot0oltnmf3tasfm2eanvs u0 ltrmocta1fp r ivo;s0sruoimpiu1ameemivtls a2taxm nt0texnmicils mDrlnmo;t) ltrxf3iy1om elu o ( trtoxm3iy4omeelfei sfaDrrxmp;o1tetoif3tatfs uau s;(0texrifcoadfatr nvsl(0s2xoimpiy4ol  lies (  2ur( o;o1ope io3iasfa eanvont0teenxfctotopte ues;(0srurio3io1apeelnvtl( arum(m oo4tle  fcilsls emnmp u0 eeomfcta1late n sl() exm(o3nudllenlfcs (  Draxrooo1openmf3iadla2uanvpn(4 leoxrcoodfatr i s t0 rurxopno4omt lnei tfs2taxmooo1ale mf3ilslaDrmnvs u)tltrxr iy1lm   nvi;t0srtoim3nu4ap nlnvi sfsrua( o;u4apeomf3iytla2ua( snu4texrif3oodfatelu sls sexoio oydomt mnvsl(fs2trxm oo4tltoiieiys m rlump;t4 exoir3ty1oa rlu ils0s2xrxm3nu1lp elnvils)aDua( pno0apxo i3ilt aDranvont) lenxf tydlateln o;()s2trim3oo4om   fvsas)sruaxrp;u1texo i3ias mDeln p u4 rxnmr iytlaDrliei s) 2xo(o iydamtnmfcta(fsrrmxmo;u4tlxo fetysla ea( o;u4aeeomo3totopD  uvol(0trxrxo3iydomtnmnvs t  2ra(  ou0olx mieiatfsDrl( on()tltoxo3iadfpD au o (  exrxr nydal   fciat)aDta(rpot0aex mfeiasfs ea( s t0 lenio3oo1oatr uei;(0setrxmpno4lm e nvsat arrmxmp;u0aexniiciys s2eauvp;t0trenirciotfptelu s t)sruoir oy1am nmnesa()a2rrxrpnu0teen i3ild m2emums;()alerxocoydomD aieols  2xmio ny4lpee ivsatfsDtm(r nt4tlxn feiyt sDelnvsnu4trerxf oodoatrluvi t0 exrxm iydal elncias  rrm(  ;o1aptoiociasfs2ul( p;t4aexoxrciodlate u o ( t2triopnu1oltelnvsatf Dumxmpou4tlt  iciltla2eln o;t4 rtoxo tadopDr n olt  exm(r3nodoltelicias a2tm( p;u1altoiicilsla eaums u4trxoircty1faD anvi s  exo(mpny1lltnlietltf rrmx onu0aee mf3iydla em(ms;u) rerio3oa1lm eaies;s0 2uoio3ny4ol n fetasf rrmx o;t4aeenmfciat m2elnvp u0 eenxr3ia1latr neo;( seurxo iu1ap emiviasfs2raxr oo4altn ictltfm ean p t4arxrir3oy1omDr uvi;(0s2umim3ou1opte net sfs2tr(root0tee mfeiltlmDel(mo u0trxrmrcoo1lpt anvsl() 2xm(o3io1llenmietasfa2urx pou0aleoio3tydfaDrmn pnt0 lxomr totlm eaues;( srumxmpnudop e nvi t  rumxmo;o4oet mo3tasfa2ra(vs u) etoio3io1lm  lu o;t0s2uoxm3nydlltnlncs ()arrmuro;u1olenio3tyt s umuvp;u4 eenir io1laD aieols0t2toxm no1lpen nvils sDuaurpno1tpx  f3iasfa rlnmp u)aeeoxocio1fmDe uei s s2xmirpno1opeemfesas artmuro;u1tpenmf3ildfs2em(mpnt4tltrxf3tatoateauei t0 exrxopoy4amee fesa()s2ra( pnu4tpeoiictasfaDelnmo;()teenif oadlaD lues;( seurxo3oodom eliesa( arraxrooo1opx  fetyslsDea(ms;u4areomo3io1om e ieilt) rum(r iudlpeelfes tfa2ur(rpou0tex ifeild mDrlu o u) rtomrctydfatrau s;(0t2trimpiu4alte ncs sfa2rax pnu1oeen oeiasls2rau ont4aeeomf3oytoa  ai i s0texmir ny1ll   fcils a2rax onu0texo ietydla2eanms;u4tetnir oo1lpD aneo;t  rxm(o3nu4al n ncsls  Duau o;t1oee  o3iyd aDulnmo;t0artoxfctotfmDeaieols  etr(opiudlmenmictl() rrmxro;u1tex mieiatfsDrln s;u0 lxnmf3iotfpteaiei;t trxoxm iu4lmtemfesl()aDur(  nu0aeto f3iadls2ean snu0tlenxf3iytfpD anes;s0t2umxopiu1amtelfvtl()aDtax o;o4apto i3iysfaDumnvo;u4treomr oo1late uvo;(0 rtrxm ou4lmenlfet s  2uru p;t1altoio3ildfa2em(vp t)tltoir iytlatrau i s  2tmir oy1lp emneils)a2ua(mpnu1opx ifciasfmDumumpn()artoxocoa1lat aneils0 exr(o nodom e feil() 2rr(ront0oexn iciasfmDem( p u0tltnio io1lmt ln ols s2uoimpnydoptnlivslt)srururont4altomi3iyslaDrmump t)arerxo3oy1fm raueo ()srxm(m iydamtemiesasf Dua( ont1tlxoioeias s2rmnmpnt4tltoio to1lpt  nvo s teumxmpnydamte nesls a2ra( pnt1tlenmieiatla ea( o u4 reoir tytfpteaies ( sexr(r3iu1optn fciatfs2uru  oo1aee miciltls2ulumont4tlermr tytlp r neils)truoxm iu4ol  lfvsat s2umur ;o1tetn ociyd sDra(mo u0 lerxr tydopDrlueilt  exrxo3iudlptnmfesa(f Dumum nu1aeeoifetasfsDrln sn(0teenxr iodlaD auei s0srxm(mpnu1oltemnci s) ruaxmont0tlxoioetysls2uan snt)teenir todfa r nvs;()sexr(mpiu1llen ncsat)a2taxmpnt0aleniociytfmDuauvs u)alxoxrctodomt  nvolt t2xrxo3nu4ll nlietltfs2rm(m ou4tpenmfetlslm ua(monu4alerxr3ootoptran o;t)truo(rpio4lptemiviasf Dtmumoot1tlto o3ildlmDea(mo;u4 ltnxo3oodoptrluvi ()truo(o ou4ape  ivtasfa2taxrp;o1oetoifctls m2rm( snt0teeoxo3oy1fmt lnvo t0texoir io4llen fcias) Drmu p;t0aetnmo3ildla ulnvs;u0tltrxo tatlp eluvilt0 rtm(o io4lm e fcsl() 2uaum ;u4oleo ocilslm2em( o t0tlxnmf oodoptr ivo t)srurio nydaltelnei ( a2rm(  ot0texo ocilslmDeanmp t)aetrmr3iy1fatrauvi;( s2uoxo ny4apt  ivilt)s2uru oot1oee  oeiasla2rau p;t)teeoxf ootopDr nvslt trtmirpoy4olt mnvsls)a2trum ;u0tpx mf3tadlaDel( ont4 leomo tadlpt  u ils seto(o iudalt  fvsa() Dtrxr nt0aleoifctls a ua( snt4artrmf3oodlaDeauvi s)s2xmxo io1opt mncsa( s2rmuront4openioetytls eanvo u0artrmf oydoat auei () 2xmxm3nydamt  ivil(f rrr(m oo0olxn oetlslaDranvp u0areomo3oa1op raivols texmxr iu4lp nlieils)aDraxro;t4openmoetasfmDuan sn()tltrmf3io1lm raivolt s2xo(mpnodom n nesat) Dtaxrpno4tpx  oeiatlmDemuvp t4aetnmfciatoa rlneils)trxoxopnu1op emieta(farua(ronu0tlenmf3iltfsDrm(ms;() lermo ty1lpt anvs ( sexr(r oydlpen neias  2taum ;o1oee  octyt sDemnmo;t)alenxf ootomt lieols0teuo(r3oudap elfet ( sDrmxmono4oeenmfctad mDraumont)aexoif3tytlat aneil()trtmxo nydole mnetat)a2raum ou4olxn feiatlm2um(vo t)aetrxfctatfm rluei;s0 rto(r no4oltnmivsl( arrrxr ou1opxnmfciatls ul( o;(0 lerxfcoa1lmtr uei t t2umxm oo4aptemfeilt) Dur(  nu1oexo o3tadlm2eauvo;(4trenmf iydlpteaieils)sruo(r iodllen ieslt srum(ronu0oexoifeiytfa emnvsnu0 lenif oodlatrln o t0t2xrir ny1om emfeils)a2urxm ;u1oexnioetlt a2ea( s u4aetrxo oatlpDranvo ( setmio3nu1opte fcta(fa2uau ooo4olxoif3ilsfmDeln snu4alxrircootopDeai s;s)sexo(o3ou4optnmieslsf Dum(rpnt4tpeniicilsla2ua(vp u)texnir3oy1lateaivs t)trtrxr oy4llt liet ( sDua(ront0alx mociyd sDrm(vonu0teeomo oy1omD  i o t0 rumiopiu4ome micsatfsrtrum no0alt  oetytfa2rl( on()trenmf3oo1laD ai s;()trtm(opny4ol  lfvsatfarumxm ot1opt iietytfs2eanmpn()arxoxr3todfa eli s ( s2ur(o3iodlpee iesls  Dumxm nu0aex  feiytls rl(vsnt4alxrxfcoo1lpDelnvi;s)setmxr3nudal elicslt sDuax  ou1tlxoiieiyd aDuluvp ()areomr3oydop rlivs t texrir3nu4op n nctas srum( oou1altoifetatlm2rlnmp;(4teenircia1oaDrauvil( setrxm iydopenlivi t a2urum oo0oleniieiltlm umu pn(0texnifcoatfp elueo;(0 rtmim3iu1ol  mnvtat  rtaxr no4altnioctltls rluvp;(4aetrmo3oo1fp ran s (0trtr(r3no1altemfvtls)s2tr(r ;t1tpt  feiltlm uluvont0 exrxrcoatfa rauvilt s2um(o3nodlmenlncta(fsDtr(root1aeeo feilsfsDrmnmo;() etrxf3ta1lptr nvs;t)s2xr(m3iu1lm nmics ( sDta(mpou4tleoifcilsla rlu o t4aleomocoadomDelu o (0trxrxrpoudom nmfci t arrm(rpnu1optoif3iltla2ea(vpnt4trxrmocoo1opDrlivils sexoxo3no1lp nmies ( s2taxrpou0tpxnmfctasfa2rl( o (4 rtnmr3totfmDrlnvi t teum(rpiodllte iesatfa2umu  ;o1ape  fetltfa2uanvp;u)trenxfcoy1om r ueolt0 rtoirpou1lleelfvsas aDrru pnu4olxnmo3iltlmDrl(mo;u0trtrir oa1oaD aivols0texm(mpnydlm nmfeslt  ruaurpoo1apt mfciad m2rlumpnu0aexoif3oytoatr nvo;( seum(o ny4lm  lnvsa() Drruro;t4oetoioeiltlsDra(vs u0altnif3iydopt auvils0teurxm3ou1lltnmieil(fs2tmxrpnu1oex ifctad s2el( p u) reomrcootla   i o;t) rtoim io4lptn nct t  rrm(  ;u4tpxomf3tydfa uln pnt4alxoir3to1fp  anvo s s2trxm3ou1lltemivs s a2rau p;o4apenifcilt m2emn snt4tetnxo io1oa rai slt teuoxopno1oltelnvtlsf ruau ont0openmiciyt m um(vsnt)artomo3ia1om rauvolt s2tr(m io1lp elivil(fa2tmx ont4opto o3tyt m rmuvp;t) rxrmo3tydlaDraieo;t0seumirpoydope lnvs ()artrurpou0aleomfeiysls rmu s t4alerxrciotfpDrlnei;s trxrimpoo1omee fei ()arumurpot0oetn oetyt m eaump;t) rermr iydlpt aneol( t2toir iu1ol emfcilt  Dtaxrpot4tpt io3iltlmDea(vsn(4texnxfcootfate ivo s0 eur(m3iudol   fvi s)s2raum nu0tptn ieiatla2el(vp u) etomo3oa1lpD  nes;( s2tm(opio4lmt  nctls a2rrur ;t0aetomi3iat mDrlnmsn(4tltoif3oydlmt livol( t2toir3oo4altnmiesltfarua(r ot0ape ifeiysfaDrm(ms u0 rerxrcoo1fp elues;t  rum(rpiydll  mfvtas)srrm(rpot1alt moctytlaDem(von()trerif3iytfaDe u ols)seuoirpiu4omtelnvta(  2tm(m ;u0tetnmociysls2uluvp (4altrxr tydomD auvi;s texo(rpou4am e fcils)aDraump;t0aeto o3tydls ra(mon(4trxriocto1oaDrlieilt0seumxm3oy4ape mnvslt)aDrrxm ot4aeto oeiydlm elumo (4 ltrir3tatomt lieslt0tetmxr3no4openlncsat) rua(mpou1apt  ietyt a2rauvp (4alxomo ia1latrlies;()s2trxo3nudamtnlnvslt aDtru  oo0apto ietatfa ulu s ()tetoio iadlm   nvi;s0 2uoim3no4omtnmieilsfarum( ooo0tet miciysls ulnmp ()alxrxr3oadlmte i ols)tetmxm3nydolt lieta(f rtau oou1open o3iydfm2umnvon()arerir tadlaDrluvols t2toir nydal   fesl(faDumx  oo1oetn ictysfm emnmo;t0aleoxf ootfpteln i;s0setmxopiydamt mfctlt  rua(ront4oetomf3iasfs ulnmonu)areomr oytlp r uei;(0srxo(opny4lp   neiasfa2tr( onu4apt  f3tasfsDrlu o u0aetrir ta1oaDeaivs;()sexo(r3ou1omtelivsltfartaxm no4tltn ictlt s ranvont0aleoio3todopDeli i s  euo(m nudapeemfetat)aDtrurp;o0aptnio3tat m rmnvsnt)tetomo3oydlateaueolt) etrxo oy4al n nes (fsDtru  ;t0tlt ioeiad sDeln s u)teeoio3io1op   n i;s  2trir iy1lle  ieta()aDtm(  ;u4apx mf3ilsfm rm( p;t4 rxrmf iotla eaies ()teurimpoudaleemict t a2ua(root1alxo ocias m2ulu sn(0 ltoxr3iydfm elneo t)trxrxo3iudomeelies s aDtmx  no0tlxniieiyd mDeaump;t) eenir totlmDeai i t0 exmimpoydomt  fvtltfaDtmx  no0tptn i3tld a2elump (0aetrxrcoatlpt lueo;t)t2urxm iudap emncsl(fsrrrxro;o0tltn f3tldla2emu o u) rtnmr3iodfmD ai i;(  eum(m iydomeemfesat s2trurooo1oeeo i3iyslm em(monu4areoif3iytla eaieo;(  2xoxrpiudam   ies t sDrmurpot1alt  ictytfaDua(vp t0 rxrxo ty1latrai ils0trur(r3no1lpe lfctlt aDur(ro;t4tltoii3ias a em(mpn()tltrmr3ty1fpteanvi t)sexrim3io1lpeemnesa( a2umx  no4tet  o3iatfmDem( p;(0 reomociotop eauvil(0teuoxo3ou1lmtnmivs (f 2umxr ;u4olto o3iad aDrlu s;t0altoxf tadla r uvslt0t2triopnudamenlnci ()aDumxro;u1opt iociatfa ea(mon(0 exoio3iatlm  anvo s0 rumxo iy4lmte ict s aruax  ;u0tlxnmieilt sDrm(vpn(0altnmo3ootomD luvsl()t2to(r3iydolenlnetat) 2ur(ront4oee  oeiyd a uln s u)trxniocoatlmt anes ()s2urxrpiu1op   fct sfsDua(rpnt0tltoii3iysla2ranvont0aetrxr tydlmte ivo;(0 etm(opio4ap  lfvt tfsDrrxr ;t1aet ioetydls umumo (0 lxomf3oa1la  lnes;t0 etmxmpiu1om nmncs tfsrrm( p;o1tetoiieiltfmDel(msn(4aeerir3tatoate n s s s2xmxo oo1omtnmics tfaDtrx pnt0tptn feiatlaDean s t4tlenxr todfp   n sl(  ruoxm oo4omte neiasf 2taump;t4tle mo3tyt s rauvon() lerifcoytfat  i i s0 rxmim ou4lme mnctat s2tau o;t0ope  o3tyd m2rmuvp t4 ltoxr3iodoateaneo ()seumirpio1lpt livslsf rtrxr ot1oexomfciaslm ra(vs;t)areoxo todoat ln o s) 2xr(mpiydlp nmnesat) Dtm(mo;o1olxniictysfs ul(vsnu4 eeoxociatlatrlu i t sexmxo nodlp e ics s s2rr(mo;u4teeo fciat aDea( ont4teerir3to1lp e uvs t0trxmxm3iy4ape mfvil() 2ta(r oo1oleoif3iydfsDumuvon(4alerxociydoptrlueo;t t2tmio ny4apen fvsasfsDrmur no4alxnio3iatfs rm(mont4aeeoif3io1opte uvol()seto(o3iy1lle micia(fs2raum ot1tlt mo3iys a uaums;t4 lxrxo tatlmDr n slt) euoxrpio1alenmfvtlt) Dtaxm nt0apto ieilsfa umu pn(0alxnxf3iodfatranvo;s)s2tmirpoy4lpt mivil(  2uax p;o1tetnmoctld a rmump;()tltnif tytlm elu s (0s2xr(opiy1alt miesl( sDraumonu0oeenmfeildlaDum(mp u) lxoif3oodfpte ivslt0sexriopio1ll  mietlsfsrrrxrpou1olxnmocilt m uluvo;u0tlenmrcty1om  lu s;t0 2urxo nu4lpenmnctas srtm(ro;u0oex ioeildfa ra(ms;(0trxrxo3iy1faD lnvi t trumiopny4om elictlt  rtrxr ou0opeo f3ilsfm umnvo t) rxnmo oatlmte ueo;(0setrirpoy1ome  ieils)arumx  ;o4olxomo3iatfsDemnvo t4teeoir3ta1fpt  ues;s0trto(r3nudam nlfcsls) ruaumo;o0aptomoetytlmDem(msnt)trerif oa1latrli o;t srtmxopiudlm e fctas) rtmur ot0aleo oeiys s rmn onu4alxrmr3ootoat lieo;(0 2xmim ny4ol  lneils)srtm(ro;o1apxoiiciadlm rl(vont4trtrxf3oy1omte u i;(0sexoir oo4amt mnvta()s2raxroou1aexnioeildlsDelumo (0arermocoadfa r u sls texoxopio4lptnmicil()a2ra(rpoo4olt ioeildfa rlu o ()artnio3ootlmtrlieo;s0trtm(o3nudope mfeiltf Dumxmpou1tlt  o3iat sDra(vpnt) lxoio oadlpte nesl(0 2xo(o3iodop e nct t)sDum(rooo0tle mo3tys s ean o;(0 leoxf3oytfptraueo t0t2tmir no4oltemieilt s2umx p;u4tpeomi3tatls2ul( p;t4arenif3io1fpt auvs t0t2trio iy1om emictas) rrmxmpno4olt  ietatfm ua( o;u0 ltnio3oy1oa rln i s texr(o nu4lmtemfeils a2ra(mpou1oet mi3tlt sDrau pnt)texnmo iadopD lnes;t)s2um(r ou1lmenlicslt  rurxmont1tptn fctysla emu snu4 etnmr3iytopDeaueol(  rurxmpny4am n nciat aDrmxm no1opxo o3iatfs2eanmsn(4areoir tydoa raivo t srxmir3ny1lpe  icsls  2tau poo0tpxo iciat a2ea( ont) exoxf ty1lpDrluei s0t2xr(r3iodopt mfcsat  Duaumont0olxo o3tltfsDemums;(4 rerxf ty1laDr ivi ()setm(opiudap emfvsat sDur(r nu1tlxomf3iat aDrln s;t4tltrmociadlpDe nes;s sexr(o oo4lle mnvta(fsDtm(mp;t0tpxomoeiadla rl(mo t0 lxomocia1lmD an i s0tetoxm ny4llteliciatfsDumxm oo4tlxoifciys s ulnms;t)tltnmf oy1lat  i ils0t2to(m iu4lpt  feiat)artrumpot1oetnmiciyslaDemuvsnu0aetoxfcoadfpDrlu s;( trxoxopio1om n ics sf 2tmum nu1oltn fciytls2eaumo;(4tltoifcto1lmD auvi;()s2xrxm3no1omt  fvs t arur(m ;t4altniociydlsDrlnmp;(0tltomrciatop e neols)t2trxr3nydal emici tf Drmumpou4tltoioeiytfaDrmumpnu)aeeomfctodoa eaivol(0 etr(mpou4lmtnlnesltfsDua(mooo1tlt  oetltlsDrl( ont4tltrifcty1lpt luvi s) 2urirpnydlp n ivi t  2uax ooo4tpxn o3iadlm umnms u0 eeoxf3iadfmDe uei;t0 2trirpiy4optnlieils) rrmur ;t1alto octlsla ra(mp;t0tlxrmr oa1omtrai i t  ruo(r iydlmenlnvia( a2tmurpnt0oetnmf3iltfmDea( s (0aeenir oadopDeai ils0truoxo iy1al nmfesat)artrxront4oetomi3iyd a ulu s;u4arxoxfciy1lpDrlnei;(0srxoxrpiudlmen iciasfsDta(rpou0opt  o3tltfm2ua( p t) lxrxrciy1opD  n ol() 2xoiopio4ll n icslt) 2tm(monu1aetnifciasfmDumn ont0arxoxrcoydoa e uvi;s seurir iu4lltelies s  Drruront1aetn octyd s2eanmont0tlerir iy1faDeanei;s) etoxr3no4optemnvia(fa2rrur ;u1opx io3iyt a elums;u0texnmocoo1fmtr n s;() 2tmiopny1altnmnct s)aDumx pou1aex mi3ilsla rluvs t) etoir3tatlp e i sls0t2uoio oy4lptemncs () 2umurono4aeenmictyd a2um(mp;() lxrmoctadoate i s;(0sexr(mpoodop elivia( srur( o;u0alxomfetldlsDul(mpnu)aetnir3to1fp eaivi ( setmxm nudllee ncs s sDurumono4olxoioeiydfa uluvo u0 renxr3ootomD livols srurim3io4lmeemfvsa( arrr( pnt1olx iietatfm ul( o (4teerif3iatlmDrlneo (0teurim iodll e neil(  Duaur oo1olen f3iysfmDrmnvo;t0 rxrio iy1opt aueols)sexrxrpnodape lfetas) rta(m ot1tptoif3tldla ulu p u4 exomrcoatlaDeanvsls  rxoim no4ll   fcs ( aDuau ont4apto i3iyd aDumumont)tlxrmr3oy1oaDraiei;s)s2tr(rpiu1ll e ivs tfarumum ;u1tpto f3tys a2ranmp u4 exnmr oy1fpteli sls s2urirpoy1am emncs s srtrxm nt1teeomo3iadla2umnvp (0trtomf iadla eaiei;s t2urio io1ll  livta()a2tmx poo1tpxomi3ildfs2um(mp;u4trerxr ootlp e i s t0trxmimpoo4omeemfcil(f 2umxmpou0tlto iciad m2eanvp;(0 rtoir3todoatrlnvi;t) 2um(m io4ll emivslsfa2tax o;o1tlxo fciysfs ranmo (0tlerifciytomDelnvols0t2xmxm oy4lm emneilsf Drr(mono1tlxo o3tls s rlnmp u) rxnxfciotlp   n i t tetrimpiu4lmeeliesa(fsDur(m ;t0tpxn ieild a2ulnvpnt)trtomociytlmD livi s  2trxr3iy4opteliei t aDtau pnu4tpx  ietlsfs rlums;(0 lxriocootfp rln sl(0s2xo(m iy4aptnmfetat  rrrurp;t0aeto ictas s emn s t) eerxrciodlpt li s s0 2toio3oy4lpeeliesls) Dtm(rpot1ape ii3tysfa2eaump t0tetrxf ta1latraivils0teur(opnydlme mfcs ( sDtmur nu0aet  fciytfsDum( pnt0 exoxr3to1lp r n s;s t2to(m3iodal n nvsa()arrmxrp;u0tpe mi3iadfm rauvon()aetrmf3to1lpDrlu o s0 rxr(r3nydaltelici tfs2tmxmpou1oee mo3tad a ran p t)trxomf3oodoat liei s0 ruoxmpiudamen fct (fsruaurpot4oltomfciltfsDrm(mp ()tetnifctotom  anes (0s2toxo no4omt  ieiat  rtaum nu1teenmiciad sDum(vs;t0treoxr iy1opD lieo t)seuo(rpnydll elieias  Drru pno4tptomiciysls2eluvs;u0alxrxr todlat aies t) 2xrxm3iudome lfvilt  2urumooo1tex mietydlm2eluvo;t4trerxo3ia1lp raueol()trum(r3nudllt lfctlsfsDumu o;t4tpxo ietas mDranvp u4trtrmo3oodoaDeauvs s0teumim iy1op nlfcsas)a2uau o;t0aeeo ieiadlm ua(vo;u) etrmr oo1fmte ivol(  2trir ny1lmtnlivsat)sDrr(  nu0opx moeiaslm rm(monu4trtrxociy1lat lnvsls t2uoim ou1amtemivt t a2ur(r nt4aeeomf3iyd m2ranvo;(0texnmociatfat au s t0 2tmim iydom nlict t)sDrr( oou4apt  i3iasfa2rluvo t)areoir iatfp  aneo t) exmxopoo1ll e fvia( sDrmx pnt4alx mo3tys aDrmn p;t)teenxfcoy1fpD au i t trurirpoudopenliet t arumur nt4oleo iciad s2ua(vp;t) rxoxf iydoptrlu sls srxoir3ny4op  licils)sDrrumo;u4aleomicildlmDumnmo;t4aexoxfciotomD  uei (0 etmio3oo1al elfesat)s2tmum ;t0alx  f3tlt mDrmnvs;t0 renmociy1fa rlies;t srtmxopiy4ol emfvils srtruro;o4oee mieiyslm umumsnu) reoxfcoytfpDrlu s t0tetoxm nu1lptnmiciat s2rau p;o4altnmo3tlsfs2eanms;u) eeoxo iotoaDrlnes;() ruoim oo4ap  mietltfs2rrumont4texnmf3iys mDua(vonu)trenirciatfp e neols)teto(rpnu4opt lnei (f 2umumono1tlxoif3ild mDemuvon() lenifcia1lmteli o;(0s2xoir ny4apen fctasf Duau p;u1tpxnioeiydlmDem(vpn()trxoxf to1oatelnvo s s2urxopoy4ale mivil()a2raxm ;o4aetnmfciydla2rmu sn()aetnxr tadom rlnvs;()seuo(r3iy4alt  ivi s sDtau ont1tptomieiadlm emuvs u)trxrxo oytfa e ueol( s2toio no1lm emfviatf rum( ont0olxnmf3tldfs2ulu s;t0 eerircty1oatelneolt)s2xmir iudlptemncsa(f Dra(moot0optnioeiys a emn s;u4aleomo3totoa eaueo t)t2uoirpoy1alenmfetat) 2um( pou1alx mieias m2ra( p u0artnmrciotlaD  ieils) ruoxr nydole lfeias  rrmxro;u0tee ioeiyd m uanmp u0tlxoio3ootlmDe nvo;(  etoxo oy4omt  ict s)s2tr(roou4teen fctysfmDemnvp u4 leomr3oydfptr ivs;s0 rto(m no4ome mivtasfsrua(mpot4aee ioctad s ul( ont4 exrxocoy1oatrlues t srxmimpno4omtnlfctltf rrrx pnt0aetomf3iyd a emnvs;u)altomr3tytfa   i i t) rtoxrpio4am elfeta(fa2ur(r nt1olt iictydfaDrm( s t0 rermoctodfaDrlivi;s)tetrxr oudaptemfeiat) Drmumooo4tpenmi3tatfa rau pnu0areoxf3oytoptean s (0 etmio3iu4al  lncsat) rrax p;o1aleomfciyd sDeau p u4alxnxfciytfmDr ieil()trtmio iydalenlietl()srrrumo;o1oleo ictlsfmDuaump t0aexomf3oa1opDeln i;s0srum(r3iu4omtn ncslt) rum(mpno0oexnmoeildfmDulumon()trxrif3tadfaDraneo;s0srtrxo oy4ll e fcils aDua(rpnt1apt mfctltls2ra(vp;t4 rtomf iytlpteaieils s2ur(o iydlm   ncia( srtmxr no0apt moetlsfm2eln p;u0texrircoytoaD  ivs;s)s2uoim3oydamtnlictls)srum(m ou0apt  i3iatlm rln s;u) lxomo3iodoa rlieilt)texrxm oodamtemnci tf rurxm ;u0tpxniietadlaDuauvp;u4 eerio iodfaDeaies;()s2umxmpiu4apenmictl()aDtaumpnu0teeomfciytfs2emu pn(4arxnxr3iy1la   uei;t0srtoxmpoodapenlnvsat)srtaur no4olxnmf3tysfm2rauvp u)aetrir3ta1opDr u ilt0 2toxmpiodolt  fesl(f 2ra(m ou1opt moeiaslsDel(ms;(4artrifctotlmDeaivs;s0 exm(o3ou4al  mietlsfartau p;t0apxn ociydlmDrm(mp;t4 lxoxfcta1fptrli i;t  eto(r3ou4amenlieilt sDuax  ;u4aeenmoetytfa uluvs;u4teerir3oy1lmDrlues;t srumio iu1ole mncsa(  2rrx p;t1oeenmo3iyt s uan o (0aexrmf iytomD lieolt sexrxm3oydaltn nvtatfa2tmu  nt1texnmoetlsfs rl(mo ()arxnir3to1lat an i;s) ruoxr3oo4lp n fvias)a2ra(r no4tlt mo3tldfm um( o;(0trxrif oatom  lneo ()t2toxm3oo4amenmies ()aDtmuro;t0alxoifeiatfm2rmumsnu)teenxo iy1lpD  ieilt0sruoir3io1al   fes ( srtmxronu4olt  i3iasfm2eluvsnt)tlxomfcoytomD lneo s0 exmxr3nu4lp nmfvt ()aDtmxr ;u1tetnifetyt m rl(mo;u0aetrmf3ta1la rauvsl(0t2uoxo3io4lptnmfvta()sDua(mp;t0tle mi3iltfsDuln p () etnio ootfa r uvsls)srxrxmpoo4lmte iei s sDrm(  ;u4opx  iciytlmDrmnvon() lxomr3oydfm ean s;s  rxrxo3oo4alee fvsl()srtr( onu4alenmfeils aDuau o;() ltnmocoodoaDrln o;t0trxm(r3io4opeelnet t a2urumo;o1opxo fciyt m2um(vo;(0aetomocoy1lmtr ueil( s2ur(m3oo4am nmncs s)artax  oo0tlx  fctatla2rlu o t)trerif3iy1fmDe ivs;t trxoxopoudameelivsls srrr(rp;u4texnmo3iadlm2elumo;u4tlxnxf3oy1fm eliei;t)texriopoudlpt  nesasfaDtm(moou1tpeo f3iltfs2ulnvs u4teeoxrcoytlm rauvils) eur(r3oydop   nesas artauroou4oetnmo3tatfm em(vs (0arxnxo tytop r uvilt0s2toxr3iu4aleelnes s)sDrr(monu0oltn feiatfmDulnvp;(4 ltnxf to1la r nvilt) rtmirpnu4lltemfvilt  Drmu  ou0apx mf3iaslsDua(vsnu)trxrmo3to1lm e n s t s2xrxo3iy1lmee fcs (f rrm(r oo4aleomfetydls2ulu s () leomf to1fp   u ilt trtoxopnodlpenmnvi () Drru  ;o1altnifciadlm2ean pn(0trtomf3iadlm elivsl(0setoxr3ny1lp e fcsas) rra(  ;u1alt mo3iaslm raums ()arxrxf3oa1fp eli o;()texrxrpiudamt lfct tf 2taxr ;t0tpeomoetltfsDranmpnu)aeenmo oytlmD lu ols) etrxo oodoleemnvi t a2rmxrooo0apeomf3tyt s2eaumo;u0 eermf3io1omtranvo s) rtoxo ou1llt licilsfsrur(m nu0olenmoctydlm2um(vo;u)aetoxfciatlmDeai slt trtoxm oodaptnlfvt (fa2ta(m nu4opx miciyt m emu p t4tltnio oo1oa eai s;( trurxm3oy4al  lfvi ()a2raxm ;o0oexomiciyd sDulnvont)tetoir tatfpDeluei t truo(o nodlmee ictl( aDtr(ro;t4aeto oeiad s eln p;u4tlerxocty1lpt lnvi t srtmio3oydllen fvsat artau p;o4oeenmf3tadfa ea( o;t0trenxfciydom elivols0texrim3oudope mietat)s2tau pno0aptniocilsfs emnmp u)arenxr oy1fmtrauvils)texrxo nu4om   feslsfsDurumo;t0altnioeils sDuaumsnt0teeoxr oa1fm r nvolt0t2tmxo3oudlleelfcias a2uru oot1aexoioetysfs2ulu o;t0 exrif3oodlpD aieo;s s2xmxr ny4am  licil(f 2rmur ;u4tee ioctasfmDeluvo t0altnioctadoa  ai i s s2trimpiudaltemnvsatf rta(mooo0aeeo octat a2uau s u4texrxf oytfm eln olt teum(mpiodole miesltfa2ua(  oo0tpxn fciadlm2rau s (0arxrmo3io1latraues;s)trtr(mpnu4lle  nvt s) Dur(rpnu4aexomfetld aDrm( o;u0areoirctadlpDrluei;()teumimpou1ll nmfvtl( s2rm( ono4opxnmieiasla rmnmp;()tltomocoadfpDr uvols0texm(o3ou1lpenmnvi tf rraxmono1oetoif3ias m ean snu4 exnxrcoatom e uvilt teumio3oy1op nlies s)arumxmp;o0oeenmfetytlaDel( o u4tleoxf iotoa eai s;s t2xmirpoodap n nesl(  Dum(m ot0teenmfeiytfm2elnmo u4tltoif oo1oate ivo t) 2urirpnudlle  fvt s)aDtm(m nt4tlxo o3iyslm umu on()aetnxr3tydlp e nei;t  rtmiopnudopen nct tfsDta( oot4oltn ietatfs uanms;(0 lxrmrcoytoa e ueo t) 2uo(opoodlm   nvs t a2uaxrooo1opeomfeils a eaums t4aeenmr iy1lm   ieolt)s2xr(m ny4ope  ivtl( aDrr(ro;o4opx  ieiytlmDem(vonu4 exrio3oytlat luei;t0 rxmxo3nydlm  lnetls) rum(  ;u1oltnmoetldlm eauvs;()aeerxo3tytfa eaivo s)texr(r nu1ame  nviasfa2rmu p;o0aex if3iadla2raumonu0teenmrcoatfmDrlnvs t t2urxm3nydoltnlfcs t sDua(  ou0oltnmfcias a2umu o;(4 lxoio oodlpD lies s t2uo(r ny1optelnet ( artmumoou1altnmi3iasfmDuanms;t) rxoiocootfmtelneo t) rtm(mpnu4apen neil(  rtaxm no0tltoifciydfaDua(vont4 rxrmr iydfa rlivil(0tetoxr no1lptnlfes t a2tm( ooo4olx mo3iat s ua( pnu4 etoioctodlm eli o t0trum(r nu4lptn nvta(fa2ra( pnu1oeto fetat s2ra(mo;u) etrxr oy1fp  li s;( s2tmxmpiy1llee ncil( a2ur(root4ole mf3tysfmDranmp;u) eenif oytfate ues;()teto(o ny1ap nmnet s aDrau  ;u4oetnmf3iydfaDea(vsnu4 rtrirciodlmtr u s t s2um(o3iy4lpe miciasfs2raxro;u0aetn oeiatfa ua(ms t) lxrxr todoa   uvsls)srxr(rpnudlltnlnvsl(  2ua(r ot1oet  o3tytlaDemu o;u4arxrif3oo1fpteanvilt0t2uoir3oo1op  lnvi sf rrr(  ot1tle  f3ild a2eauvpn(0aetnir3oydlpt  n s s truoxm3oy1olt  nctas srrmxrpou1apxomi3iasls2em(mo t0arxrmo3oytoateaieo (0s2xoiopoydal eliei t aDuaumo;u4tlxoifciys m2em( s;t) rxomf3ia1oat  ivs;()seto(m io4amtemfctls  rrmumpnu0tlxniociadla emnvon(0 rxoxf totfat  nes;( srxoim3nudop elfet s  ruaxro;t0apxnio3ild s rau o;(0texrmr3oa1oa  aivi (0teumim iy4amt  fvtlsf rtmurono1texomf3tyslsDrlumont0treoif3oy1lp  anvs s  2uoir nudlmt micta(f Drau  no4oeenii3iad m2uan pnu) etrxf ootlatr nvs t0 eumxmpiy4altnlfet s)srtmxrpoo4aptoif3tadfs emnms t0aetnmf oa1fpD aieilt)trtmirpou1alenlncs t srua(r ;u1oee  oetadfa2umu sn(0trenioctatlp ean ol(0t2tmxm3iy1lm elics t)srur(root0olxomoetlt s umu p;()aetoirciotop r ues;s)s2xm(r3ny4lmen nct t  2rrxmpnu0apenmictytla ranvp () eerxrciodlp  anvi;s0teumirpoudlmeelietat s2rmurpnt0oex mo3iyd m ra( p u0trtrir to1oat aueolt0s2urxr3iy4optnliciltfsruau poo1aptnmi3tlslsDra(mpnu) rtoifciatlat ln o s) 2tmimpoodlm n ncilt aruaur ;o0alt ii3iysfa rmump () lxoirciy1omDeluvi t0 2xrimpoudlmeemivia()sDua( p;o4oet iiciat m ranvs u4 reoio oytfaDeanes;s  rxoio iodape liciatf 2umxmoot1texomi3iyslm ra( p t)arxrxr3oatfmDrlneols s2xmxr3no1olte neil()srtrxrono0tltoifeiytlmDrlnvp;(4aexnmocoadoa r u i (0srxmir oy1ame mieiasfs2tr(  ;t1oexnioeiltfa2uau p t4trxrmo3tatlatr u i (0sexoimpiu4lltn fvi tf Draurpoo0tleomi3iatls umn s u0aleoir tydopD aies;s0 rtrxopiydlp nmiesls sDraumooo0tlxo fciydlm emnvonu0trerio oodfp  aivolt0teuoiopnu4optnlnei sf Dtaum ;t1tlen ociatlm rlnvs;t4 rxrxocta1optr ies;t  exoxo3no4oltnlivt s s2um(ro;o0aetoioetldfsDrmuvp (4 rxnxr oadfpDeaiesls)t2xoim ny4lm elfctl(f rum(  ot1olto f3iyd s2ean o;u4arxrxo totop  li olt)seurim oydlleelieias)s2tmu onu4tpen oetadfm elnvpnt0aetnir todop  luvslt texm(mpoydomeemnvi t  rta( ooo0aexnmfeildfa2rm(vont0teeoxfcoytla e nvsl() 2tmxr3iu1amt mnvta()aDrrxroou4apeo i3ilslm rmnms u0 reoif oydlm r nvils) 2xriopny1olee fvias  2taxront1tlenmoeiys s2emuvp () lxrmf iadfate ivslt0seumxrpno1lp e ncsa( 
\ No newline at end of file
@@ -0,0 +1 @@
+uvilt texmxmpny4altn ietl()srtr(m oo4oexn i3iytls emn o (4trtoir tydlp elieo s sexrim3oydameemnes ()s2rau  ot4oexn feiytfs umuvs (4 renircio1om r ivolt0t2uoxo3iy1lpeelfvtas) Durx oou4oee  i3tlt s2ea(vp;t4alenmf iotoa   u s t)texoxr3oudam e ics s  rra(monu4ale mieilsls2ea(vsnu4altrxoctatopDr ivi s) etrim iu1ol e neilsfs2rmumpou1tee  ieiytfa2umn snt)teeoir3ta1la  auesl(0 rum(mpou1lpt  netl(f 2rmxrpnt1optomociyt a emuvo;u)trtnmfctydlmt  iei s) 2xoim iu1apenmnvslt  rtm( ont1tlt  iciat s2rln pnu4 lxoio3ootoa eli o t0texrir nu1olt mnvilt aDuaur ;u1tlen feiytfmDrmn s u0aexrif oo1faD aneo;()s2xm(o nodoleelfvt s srtaxrpou4tpx  o3iadfa2eluvo t0tetoxr3oadfm e n i ()srxmio3oo1lm nmnesatfs2uaur ;o1tpenmieildlm em( pnu)alxomo iytom ranvsl(0teto(r3oo1oltnmnviltf 2ta(m nt1tpt  oetydla2emnvp;(4areoxo3iydfaDranvs;(0trurxr3io1amt  neiat aDtau pnt0apeoiociltfmDem( o;u0trerxr3iodlpt  ivi (0 etr(r oydlm emiesltf Dta(rpnu0oexo feiaslmDraums () exomo ta1om e ivo;s) 2xrxo3io1ole mivta(f rtm( poo0tpxo f3iytlsDemnmp t4 lxrifciydopDrli i;s)texrxopoo4alte iesl()srta(root1tex  f3tasla el(vo u0arxnmf3tytop   n s;( srurim oydalt lfvia( a2umurp;u0aexoiieildlsDelnvo;(0 ltrmr3totfp r ies;t) ruoxopiy4ameemici (fs2ururont1ape  o3ilsfa2ul( s (4trtoxo iotop  lueils sruoiopnodom  lfvtas  rtrxrpnt1opeo ieiltls2ra(mp (4trxnxfciodomDr nvi s teumim nodop e neiat  rtmu  oo4oexo ietas m2elu s;(4tleomr3ty1faDe ieslt0truoio3iudop   fviatfaDurxmpnt0tetn feilslm umuvs;u4artrxf3iatla eaueol(0setrxm oo4amenmncta( srua(r ;u0teenio3tydls2uln s;u)trtomo tatfmDean s;(  etoxopnydlptelnetl(f rtmx oot1oexnmfeiydlm2uln p;u0aetrir oatlmtr n o;(  rto(mpoy4ole mfvsl(farur(r ;o0aee  feias aDra(vsn(0trenxrciodlpDrlnei ( trurxo oy1ale mfetl(  2umxmoou4aeen oeiltla rl( pnu0 lxoxrciytfptran o;(0trtrim3io4omt mfvsltfsDuru pot4oet  ieiltlm2ulnms u0tetomf3oadfm elnei;s trxr(opoodapte fct tf rraur nu4opto i3tltlm2ua( pnu0trtomr iodlpDrauesls0teto(r3oydal nmiesasf 2rm( p;o4apxo f3iysfa2rlu s t0trtnxr3oy1lm r ivi (  rurxr io1amen iesltfaDtaumooo0tlx  ociys sDrlu p t4 renxo oa1lmt  ies ( teur(m oudlm  micilsfsDurumono0tpxnmo3iatla2rmuvp (4trxoxf3ta1om   u o;s0 etoxo iy1omtnlivslsfs2rmu  ot4tet iieiat m um(msnt) ltnxocoadfm e ivo t t2umio nydll nmnetltf rur(r ;u4aetn oetas m ea( snt4arxnmo3tydlmt lu s (0 2xoxr3iodlpe lics s) 2tmum nu4apx io3iytlm raumonu0alxoxrciytfateliei s0 rtrxm nydome lfvs t a2trxmo;t4aptn oetld mDelnvo t4texomf ta1fat ln i (  2toxmpno1lp  lfcil(fsDumum nu0tee moctltlsDulnmpnu) etoir3oa1la e ueolt trtrxo3no1lp emncias) Drrxm ot0aet iieiyd m emuvs;t4tlerir3ootom e iei s0texrim nudalte neslt a2um(m oo0ole iieilsfm2rmnmont0aeeoxo oa1lmD  uvolt  eur(rpnydaleemfvi s  2umur ;u0tle  i3tls m2ean s;()aeerio tytomt  ieol() rxmim3oudape lfci t)arum(r nt1tpx  f3iysfaDra( p t)trxrmo3oy1fmDrlies;s)teur(r nu1llt mnes s)s2umur no1tee ioetytlaDuanvo;(0 exnircto1fp r nvilt  2urirpnu4ale  nct ()arururpnt1opt  ieias a2rau o (4teermr3iatfmtrauvil() ruoim3iu1omt  nvt t)aDumumono0olto ietat mDeau o;u) lxoif oydoatr n s t0 2xrir nudolte nvsas  2rmumo;o1tpeniiciatlmDrluvs u4trxnmf oodlateaueslt teuoxr ny4lp nmneiltfaDrr(m ;t0aexniicild s rlu p u4aeerxo3iodfmtraivs s)s2uoxm nudaltemfvs tf rtm( poo4oetoif3iatfaDuanvo t)tlxomrciydlmDr iei t0t2urim3ou4am n nci ( srrmuront0ope  f3tadfa2eluvpn()arxrxr3tydfaD aivi s s2urxo3ny1omeemfcias a2rmumpou0apto i3tydfs um(monu0tleoirciotlp e u olt0sruoir3oydal emnvias  Duax ono4oltnifciaslm rmumo;t0 exnmo oadfmDe nesl( setr(o3oy4lltelnei sfa2tmuro;o4tetnmi3tydfsDra( o t4texoio oatopD auei s  rtoxo oodlp  licta()srtax pnu1tltoioeiat sDranvp u4aexoxr iatfa eanvo t) ruoxm nu1llt mnetlsfa2ua(mpou0alt  ociydlmDuau s (4aeeoxr totlmDeaivs s s2xoxm no4lp   ieta(fa2tmxmonu1opxnifetat a eanvp;t)tltnir3ootfpD auvs t)srtmir3oo4al elietltfs2rm(mono4tet if3iatfsDumn pn()alxoio tatlpD auvo ( srtr(m3ou1ap nmfesas s2tmum nt4oeenmociytfa el(mo t)arxnxo tatop  auvs s0trtr(r ou4ameelfesl(faDra(  nu4openii3iadlsDeaump t0artriocoo1om   ueo (  2xrxo3oo1omt lfet t) 2rm(m no4tlto iciyslmDeluvpnt)artoxr oodfaDrlnvs;( trxmxo3no4alee nvsasf rum(  ot0apto f3tldls emnms;(4texoir tytop eli o t0 etr(r3nydolen fvs t)s2ta( p;u0tlt if3iydfaDuln pnt)tltrmocoa1lpt  n il() rxr(r3ny1lmen ncia(  rur(m nt0tlx ifeiyslm ea( onu)texoxf3oa1op  lneo t0trxoxopiu4al elnesltfsDuaxmo;o4oetnmoeias s ul(vs u) ltnmo3ia1lpt ai i (0trxriopoo4ap   ict ()arurumoou4altoifctlsls2eluvs (4 lxrmo oadfpte uvo s0 2uo(m ny4lmeelnci ( artm(mp;t4tleoii3ilsfaDuaums;u)aetrmrcoadfmDe ivo t0s2trimpny4olt  feias aDtmu  ;o4olenii3iasfs2el(msnu) rtrif oa1laDeauvi;( trto(m ou4ome lnciat)srrmx p;t4tpx io3tat aDea( sn(0aeenio iatlpte ueo t0t2toxrpnodll nmies s) 2tau  ;o4oltomoetaslsDumnvsn(4tltnmo3oadla eaivo s0sexm(m3oudlmenlivs ()s2rmxmp;t1ope mi3tat sDrm(mo;t)tlxrir ty1faDean i;t)t2umiopiy4ap  mncilt aDrrx poo0tet moetadfmDrau pnt4areoir3tatla rln sls)seuoir nu1lmt mnetls)arum(mo;u1alt  feiltfs2em(mpnt0altrxf totfpD ln s (0s2um(o iy1lmt lncsatf rumxmp;u4optoifciyt a2em( o;u4texoxoctatopt  i o ( seur(r iy4ale mictl(fsDtr( oot0aee  feiydfa2emu snt)artnir ia1om rlnes s0 rtrirpiu1ame livia()s2taurpot1opt mfeiatfa ul(vsn(0 lenxo3totoate ivo s0truoxmpno1lme mncs tf rua(m nu4tptomiciadfa eaump;(0 ltoifcoatlmt lnvsl()setmxopoy1apt  icils) Dra(r nt4opxoifctaslsDra(vo t) eeomf tytfaDr nvs t  rxrio3oo4amtnlicsltfsDumuroou0apt io3iasfmDeluvs;(4texrmr3oodlatrlivs;t  rumxo oo1am  lfcs t  rrmumpot1aexnmf3tlsfm umnvpn(0trtnif3totfpD li il(0texmxo oudamen nvsl(fsDtrxmooo4tlt mfctatls ul(vp;u0 exrif3iydfm ean o ( srurim nydopte neil(f 2tauroot0ole moeiat m2el( p () rerircia1omDeau o ()sexrim3no4ap emneiat) Dtr(mp;o1opx  i3tlt a rl(vsn() eenif3tadoaDrlneilt0 2uoim nodllee icslsfa2ur(rp;o4tpt mieild s2ul(ms u4 ltrioctytfm r i s;(0 2um(r3iodopenmnei t  Dtm(rp;t1oetnmieiatls2um(msnu0aetoxo oa1la  au s;()srurxr3oo4lltnlfcia(  ruax  nt4tlt iieiaslsDem(vo (4artrmo3io1op r nvo t)trxm(rpny4ol  mfcslt arurumo;u1tle  fctas m rm(mo u4trxnxr iadoat aneo;t srur(o3oydamt  netlsfaDtru p;o0olxn ociyt aDran s () rxrif3oo1fpteauesl()trto(m3iu4omt mivils)srtax pno4apt mfcilsfa raums;u)alxriociotopt au o;()s2xoxmpoodapeemnvsatfa2rmx  ;t1tpt ifetytla emu onu4 rtrif tytlm  au sl()sexo(m oydope  fviasfarumump;o1oltnmictytla2uauvsnu4 etnmo oy1oa   u i ()sruoio io4lpen ivtlsf rtmuronu0tlenmf3ildfm uaumonu) lxomfctydlp   i s;s0s2trirpoydlp nliei t)aDrmumpnt4oex iociytfm2rm( snu4aexoif3oytomteln olt) rur(o3ou4lpe lietl( sDuru pou1aetn f3iad s uan o t)aeeomr3io1fptranvilt  exmim no4ol n ietat  Drruroou0oex ioeiydlaDeluvs t0arenmr iatoaDe iesls)s2tr(rpoo4lpe lfviatfaDtaump;t1tex  icild aDuaump t4 rxoxr3ty1lpteanvol()texr(rpiy4optn icils arua(roou4oex ii3tadfaDulnvsnt)texoxo oytop rluei;s)t2xo(mpnudape mnesl()aDrmu  nt0aex io3ildfm2ranvon(0trxnir3iatomD  nvo;()srtoimpiudal elfci t s2rau poo0tltniociltfs2ul( pn()trxnmo to1opt aneols0seurim3oo4opt mnesl()aDtrxmoot4aexoioetltls raums;(4artnmf tadopDr i o t) 2ur(m no4ap  lncia( s2uau pou0aeeo fctatfmDel( onu4 rxrmr3io1fmteli s t s2umxr3ny1llt  ncils a2uaurp;t4aetn f3iltfm2rm( o u4arxnio tatomDelivi t s2to(r iy1omtemivtat  2rrx p;o0tet ifciydla ul(mp;t4teeoxf oydoptelu i t0srtmio iodolen ietls)aDurump;t4alx  o3iltfaDel(mo;(0teenmfcoatfm  aivs s0setm(r3ou1lmee fesl()aDrru  nt4olenmociltfsDrmnvp u4aeenxo3ty1la  lnes;(  exmxm3oodaltelfcslt s2rmx oot4oet iociltfaDra(vs t0texrmr tytfmtraueolt)srtrim no4altn fvsltf Dumump;t1tle io3iatfs rlu o t4 lenmfciy1fm  ln s;(0 etm(o iydlm e fcs t s2um(moou0tpx  ociasfs2umnms t4artnmrctydomDr u ils0t2tmxm iudoltnlici tf Dtr(roou4aex if3ils mDemnms t4arenif tadfmD auvo s0s2tmirpoy1llenmictl()aDrrur nt0oeenmf3iaslsDemu s u)teeoxf iotopD lnvs;s0setmxmpiodlp e fes ( arurx  oo0tpx ioeias m uanvp;(0artnmfcty1oat livo (0srum(o oo1lmenlfvi t)artmxmpno4aetnifeildla2emuvon(4 rerxo3tatfa rln il(0s2ur(r io1ameemfeiasfarumxrpot0oltn o3iysfaDul(m
\ No newline at end of file
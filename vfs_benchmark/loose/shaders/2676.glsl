@@ -0,0 +1 @@
+uvo;t0trum(m3no1om  livsasf 2umxrono4apen ieiltfa2rmuvp;t4teerxf oodla rlnvolt t2xoxr3oo4om  micsltf rrmur oo0oexoioctldfs2rauvp t4 eeomf iytlmDran sl( t2tr(mpio4lpt  fctltfs2trxroou4aeeniictad m2el(vp;t) rxnxf3tadlmDelies;s0s2xo(r iodoltnmnvia()s2um( p;t0oetomi3tls mDrlumpn(0arxrmf3oy1lm   ies;t  rtrxr iu4ap n nctasfartr( ooo0tpeoifeiatls eaumpnu0alenmf3totomDeaneil(0 euo(o oo1llt mfcs t arumuro;t0apenii3iytfa2ean onu0 renxfcoatfate nes;()t2xoxr3iy4opt  ivta(f rtmu  nt0tlx io3ilt aDra(msn(4alxniocoo1opte ueilt) rtmxr iy4lltemfci t)sDrmxmpoo4oexoifeiltlm em(mo;()trtriocta1omt li i;s  etoim ny1ap elfei t srrm(mpnu1opeomoetat mDea( s t4 rtoifcio1laD ai i;t)texo(m nu1ap nlietlsfsrta( pou0tpxo f3tydfs2ulnvo;() rermr oy1opD ln sl() etr(mpnudop emnet (fsDurxr no4oeeomf3iydls um(vs;t4tltrif3iy1oatrauvo;s0s2xoxo3nydlpt licia() Duaumpno1olx ifcildlm emn o () rtrxr3totfaDr ivi;()seumir3iy4lp  mnetas sDtrxmo;t0tpx  o3ilslsDemu s;t0trtrif3iotfmDelueo (0seum(m3iu1omtemicia() Drrumono0apt mf3iad s2emump (4areomo3oadfpD aivs;t0seto(mpnydlm n icilsfsrraxr nu1aptn fetld a2ean pnt4 rxomo oy1op rlnvilt) exmir nudapenmfctlt sDtmxr ;o4apx iocild a ua(mp u0 reoxr oo1fatr u s s trum(o3no1op nlnvia(fa2um( p;o1optniiciyd mDrln o t)arenmo3ootlmDelivols teurxopiodaptnmietas arumumpno0oltn feiltfa ua(msnu4teerif oadfm r ivilt0 eur(r oydll e icsl()aDtmx  ;o0oeeomictydfaDulnmont)tetomociytfa  li i ()srxmio3iydolt  net tfs2tmum ot0altnifetydla2elumpnt) etrmr tytlpDrlnvi t) 2toim3oydoptn nvsa()sDrmxm ;u1alto i3iydlm rmn s;(0trenirciodfmDeaiei (0texrio3nydlm eliesls) 2rax ono1alx  icias s2uaums t4tetrmo to1lpt lu ilt)srurxopnu4om emicsa( a2um(mo;u0oeen feilt aDemumsnt0aleoxocootlp  aies;s)t2to(m no1ap  mnvtl(farumu  ;t1aexniictad aDrmumo;()aexoxfctadoaDrauei;( t2xrirpoydale lnvsat)a2rr( pnt0apeomi3iat sDumnvonu)tlxomr ty1omt  ivo s t2um(r3iy4lmt lnvs sfaruauront0oexn ietat aDelu s (4aeeoif oa1op ran o s s2tmirpnudam emncsl( sDuaxrp;t4oexnmo3tad aDran o;t) rxrmo3tydom rauvs;()s2urio oo1lm e fvt t) Drmu p;t1olxn ocilslaDrmnvs;()texrmociotlpt  uvs t  2xr(mpoy4llee nci (fs2rmu p;o1tee ioeiadfm2ulnmo;u)treriociytlm  ai ols0 exm(m nodop nmici tfsrtm(  ;o1tleomo3iasla2uan p;u0trtoirciatlpDrlivs;t0trxmio nodlmtnlieils) Dumxro;u1tptn fetadfa umums ()alxrmocoadoa e n o;s)s2urim no4lltelfvils a2rmxmo;u0teenmoeildla2eanvp t4trxrxfcto1latranvsl() exo(opoodomeemicslt srra(r ;t4apen o3ilsfm2umuvp t0trenmfctodfmDeaivo;t  eumirpno1omen fesls) Dum(mp;o0aee mietatlm uau p u4 ltrir3ia1opDran ils teumiopoodap elici tfs2tru pnu0tpx mictysfs2rmnvs;(4tleoxr iotlmDr ieslt)teumiopno1lpeemncsat)a2raxr ;o1aet mi3ils s uluvs;t)aetrmf oytom elivi;t0setoxo3no1apenlfes t  2umxmpnt4tltniociltfa el(ms;u0tetoxo ty1lmte nes;t0 2xrio3oy1ll   feiltfaDur(rpnu1tltoifeiydlmDemnmp t) leomr3oa1latr ieo t  2xoxr3iudlmt mfvtls sDrrurp;u0tet iociat s rlnvp u4artnxf iatomDrln s;t) rxmxrpnodll  lfcsa() rrru poo1apt mf3iaslsDel(mon(0artoxo3io1fm e ieo;t  exoiopoy4am   ivs () 2uax  ;u1tpen ociad m2rau s t4 lxnif3tadoa   ivs;s0trur(rpnodllenliesl()arraxront1apxn oeiyslaDrmuvp u4trtomr3iy1fateanvo t tetmxrpoodlptemivt () Dtmxrooo0optoii3tysfs rluvo u4trxnmo3tydfmtr n s;( setrio3oo4aptnlnci tfaDrm(r ot4oeen fetldls2rlnms u)areomr io1oa r i o;(  rurxo3ny4alenlfct tfsDrrxrpnt4oetnifciys a2ea( o u0altrmf3ta1lmt lnvil(0 2xo(rpiy4al emictls s2um(mpno1aexo i3tat a el(vo;(4altrxr3oodomtrln s;s)srxoimpiu4olenmfcta(f Dumxmpnu1aetnif3ilsfmDelu s (0 lerxo3oo1oa elnes ()teuoio iy4amt  fcsasfaDra( o;u0opto feildfs2uanmonu)trxoif3iadfat lnvo;t)texoim iu1om elnesa(  rtmxro;t0tpto fetyd m ul( s;t0 lxomf3ta1fpt luvi;s0s2xoio iy4lpen ncs s) 2tr( ont4alenifciydlaDea(von(4tltomr to1fa   ueo;t  2uoir iu4ap e fvtls)a2ua(r ;u4tpe mf3tat a2raums;u0aexriocia1fat  nvilt0 eum(o3no4omenmfvslsfs2uaurp;o4apxnioeildla um(mp;t)tltoio3ta1fat lieo ( t2xo(r oo4amenlfetl(fsDumxmpot4opt  o3tydls umnmpnt)aeenmrcoy1oaD  uvolt seum(r oo1ll  lnesas aDtm(mo;u1opxomfciydls rlnmsnu)texrmr ootla rauvo s  euriopoydomtnlictl()aDrmuronu0oleo fctyslmDel(mont) eeoxocoatfa  an s ()tetm(rpoudolt miviatfs2urumpno4oexn ociyt m ul(mo t0 rtrmo3tytlat aieil()sexo(m3iydol nliesa(fs2taxm ;u4tpxomoetat aDul( o;t)alxnxf3iytfp eaieil()trumio3ou1omenmictlt)a2ra( o;t0apen ieildfsDum( s;u4 lenxr3todfaDelivo;( t2xmio3no4lp e ivsa()srtrxmpou4tlxomf3iltlsDrmump u0teermo tatlp  luei (0t2xoxo3oudaptemnei t arur( o;u1ole mfctldla2em( s t)trenio oatom e n sls0 2to(o3no1lm  livsas)aDurumpot4tltomfctldfs uau p;u0teerio to1latr ues (  exoio nydoptnlfesa(  2rrurpnt4aet mieiysfm emumo;(4trxrmocoodom   ueo;(  rxo(r oy4ameemictatfa2rmx ono1tee ioeilt aDran on() eenir oodfaD an il() rurxm3no1openlietlt sDtmxm ;o4aptn i3iyt mDuluvs;t0aetrirciytomtranvo;s) 2urxmpoodolt  netlsfa2ur(  ;t1aexnmi3iatfa rmn o ()aetnir iadop e ies;t)s2tmirpnodalt mncs ( s2ur(rp;t4altn o3iat m em(mont4tltoir tydfaDraivo;s)t2xr(m3iudam n netasfsDraumpou4oex mfeilsfm ea(vp;u0 lermr3oodfateluvs s)s2urim3oy4am   fci t) 2ur( pot4tlx mfetadfa umuvsnt0texnmfciodlpDrluesls0 2urxo3nodaltelictl()aDtru oou4apx mictyt m2ul(mo;t0 eerxf oydomtrluei t0seumxr io4lptn ivtltf rtm(ro;o1teenio3iad sDelu snu4aetrioctotomD  u o ( t2xm(rpiy4am elicta( arrr(  no0ale  i3tytla em(vs u4aexrifcoatomD anvs t0s2um(m3nu4amtnmnviat arra(r ot1tpxn ociytlaDemumsnt4 leoif3iatomtranvols)s2xo(m3ou4ll nlfvsl(f 2tmumpoo1apxniociyslmDrm(ms () eeomocta1lp  an i;s0t2trxo3iydome livsas  2urur no4tpx micildlsDulumo;(0aetoxo oo1opDe uei t0 eurxr3oy1olte nei ( arrm(m ;t1aexoioeils sDrmuvpnt4tlenmf oydlpDrai s s) 2tmxr3oydomtn fct s)artaum ;t4opeoiictytfm2elu p;t4tltrif to1fat lueilt  etr(m3iy4al   nvi s)a2tru  oo4ope mo3ilsls rmuvpnt0altnxr oatfat ln o;t srxo(rpoydolt lnvsa( sruax  ;u1oexnmieilsla ean snt4 exoir iotfaD anvols0 rurim3ny1lmeelictl(fsDtr(mpot4aptoif3tlsfsDul(vo;u4alxnmo ootfmDe ivi (  etrxopoudll elicsasfsDrm( oot1oex mf3iatls2umu pnt)tleoxrcio1lptr ieo t  rxrimpoodlme  ncs tfsDum(r nu0tetnioeiyd aDrm(vo;() etnir ty1op eaivi;t0 rto(r3iudlme  ncsa()artrx ooo1tet  ociatfs2umn o;u)treoxo3oa1opteaivslt teum(o3iodlm n nctas arrrx p;t1opto oetyt m uln o u4teenxrcoodlpD livo;(0 exo(r3iudolenmfctasfa2tr(mpno4apxnifetaslm2rlnmsnu4aeeriocty1lp ean il()t2urir iu1ap nlfvsa()arta(  ;t1teeo oeiltlm2em(vp t4 lxoif ia1fpD  ivols0truo(o ny1al eliesa( aDur(  ;o4tex ifcildlmDumuvont)texnif ootopDraneo s0t2xrir3no1ol emfcsls)srtmur no1texoio3iatfa rm( p;u) renio oadlmD lu o s  2uo(mpno4aptn fviat)arraumoot0tpxnmfeiltla2ranvpnu) rtnmf tytfat aieslt) rtoir3nu1lmenlfct (  2tmxrp;t4tlt iociltfa ea(mo;(4artoxo3oy1fatrai ilt)srurimpoydam elfvi (  Dur(m ot0oltoiociydla2eau o;(0texnmo io1lat anei;t t2trir3iydlptnmivi s arraum ou1oex ioeild a2uanmont)aetnxo tydlaDrlues;( t2toxr oudllt  nci sfaDrmur ;o4ope  oeilt s eauvs u) exnio iytlmt  n o ()trtm(r ny1omen fctasf rtr(r nt4opeomf3iysfsDelnmo;t4 exoxr3oa1omtr uvs;s)srxo(mpiu1amtnmncsls) Dtmuronu4aeen fciatfm2ean p () ltoifcto1lptelu il( srxmim oy4op  lnet (fsDta( o;t1aex mociltlm2elnvs () rtomo3tadoateanvo ()srurio ou4al e fvsls s2uaxmont0ole mocildfm uauvp t)tetoif3iotlmteliei ()truoxr3nudapen fesa(faDrmxr ou4altnmoeiyd m eluvp u4 lxomr3to1lpD an s;( tetoxmpoo4op n iei t  Drax ono0tptniictyt aDeln pn()tetoiociotlpt luvs ( sexm(rpou4olee fvt (f 2tr(rpoo4opto i3tad m em(vpn(0aetoir ta1op e n olt)teumim ou4opt  ivtas)srtrumo;u0tpx  ieias m rl(vs t4alermfcio1opt  nvils s2xoxr iy4lp nmies ()arra(r nu0aexoiocilsfa rmn pnu4tlenmr oodlmD aueil(0seumxo3nu1lltnlfeils)aDrax  ot1aeeoiocilsfa2rm(vsnu0aleomo3oo1fat lueo s  2xr(o3iu4ole  fvi s)s2rr(r ;o1apt moeiatfs ea(mp;(4tlxnmocia1omteaivilt)srtoimpou1amtnlivils srururpnu1teeniictlsls uanmsn(0 leoio tydopt  ivslt0 2toiopnodaptnlneias)srrm(r ;t1alxo ieiad sDelu ont) rxoxr3oadlate nvo;t teuoxr3ou4omeemieilt)s2tmump;t0alxoif3tadfsDulnmpn(0 exrir oytlaDraivo t0t2xrxr3oo1olee iei t a2umumpot4tpt ioctlt sDemuvs;u4alxnxrciatfaDranei;s)seurxr3oo1ame  fvs ( aDum(rpnt0olxo f3iyslm2rlu s;u4aetrio iydlp e ivsl(0s2xriopiy4lm emnctl(  Drr(r oo0apto f3iaslsDrl( p u)aexomr3tatop  anei;t0 eumiopoo4lm  lies ( srrmurpot0tpt  ictad aDem( snt0trxnirciodomtrlu o;s)tetm(o oo1lptn ivtls  2raxroot0opxnifeiltfaDul( s t0arxomfciy1fp elneilt) 2tr(opno4lpee fvi ( sDuau pnt1olt mi3ildls2umnvo t)texriociadoatelnvsls  eurio oodomtemfcta(f rumurpnu4tlxnmieildls el(mo;t4 reoxr3oodfaDr i ols seuoxr oo1aptn nvsls s2rrum ot1teeo octys m2ul(ms t) rxrxfciatfmtrlues;(0t2to(m3iu1lle lnes tfa2rru  no0opt ioctldls2ra(msn() lenxfciodlpDeln i t) 2tmir nu1op  licsas sDtaumont4tltoif3ildlaDulu p u) lxnmrciy1oa rluvo;t trxrir3no4ape  nvslsf rurx p;u4texoiociasla2el( snu0 ltnmfctytopDeanvs;() 2xoxmpoo4al emict t)srrmu  no0opeomfctlsfm eauvo u4 rxnxocoydoa  ai o;s0s2xr(o iu1lptn ncsat  rrm(m ;t0aet mo3iyt a ul(ms;u)alenxf3iodfa eaueo;s) ruoio3no1ole mietls a2tax p;u0tpxnmfetytlm2rm(mo () exnxo tadlptean s (0setr(rpou1llen fetasfs2umxrp;t4ape mo3iatlaDrmu onu)arxomrciy1lmte ivi;( t2xmxopno4om  mivtat) rtax pot4tlenioeiydlm2rlumsnu0 leomocoytom eaues ( srtr(m3oy1lmt mncsatfaDtr(ro;t1opxnmfctldfmDrl(mp (4 rxriocio1fm  an o;( srxr(o3nu4alte fetas artrxro;o0tleo f3tlsfs2emnmp t0alenxo oytfp  lu ol() 2um(o iy4ol n fcta()s2raurpno0tleoioeiyslmDuanmo t)altoio3iydopDean i;s0 rtoxrpoy4lleelnesl(f 2urxr no4oexnio3tlt a elnvsnu4alenif todop   nvi (0 2xo(o3iu1amtnmnes tfaDtmx  nu1oltomo3ilt a2uln onu)tltoiocoy1fa r nesls  eumxmpiodamtnmnetltfsDtax  nt0aexoiieiad m2ulnmp;(4teenmrciadomDr nvil(0 etrim iu1om elfvs (  Drr(mo;t4alxn f3tatla2rlumonu4tltrxr3iy1fmDrlnvs t) exoiopno4olt  neiasfs2rmx  ou4aleoifciltfa2rlums;u)tlerxf iytfaDeaies () 2uoxm oy1op  mneia()sDuaxmpot4aptnmieilsls2rmn s;t)artnir3tytlaDran i t)s2tr(rpou1al n ici () rua( p;t0tlt  oetysfs eaumo t)teenmr oodomteln ils0teuo(opiy4ll  lnvsas)a2uax  oo0tlenmfeiysfm ranvp ()teeoio ootoa   nvi t0tetrir3nydlme lfct t)s2trx oot0tltn o3tad a emuvp;()treoio3ta1oa rai s t trtm(o nodlptelfetatfarurxm nt1oltnifeiytfsDel(ms;t0 lxrxrcio1op  luvols t2xr(r3oo4ap n nei s)a2tmumoou1ape ii3iysfa2rlu sn(0arenif3io1opt aues ( s2xmimpoo1olt lictl( s2rmx onu0optniociat m ul(vs u4 rxnxr3ta1oatr n i s0 2xm(m iu1am e ncsa(  rua(m ot1alen fctadlm rlu s;t4 reoif3tadopDrlieo;( trtm(m ou4alee fvsasf rtaumoou1opxnmoctad m rlnmon() exrmf3to1oa rlneo;()trxrxm ny4ale mfvtasfarrau ono0tet  ieiadls2umu p () lenif3oa1lmDe nvilt trto(mpoy4op elfesl() 2rr(root0altnioctlsfa2rauvs t4arenifcia1omt auvs t)sruoiopoodapt lieil(f 2tmuro;o1texoif3iatfa2ulnvp t0teenif oatlpte ivi (0s2uoir iydlpen ivtas srtr( o;u0oetnmietlt mDumn snt4 ltnir ta1om ran s;s)trurio no4ol nlnesl() ruaxrpno1teeo feiydla el(vo (4aeenifctytlptrauvslt0s2trio oudaleelivt t)sDtrum ;u1olx  feiadfsDrlumsnt0 etoircta1fat lnei;t0 eur(r3iydapenlivia( s2tr(r no1optnmfcils m2umnvsnu0trxnxf tydlmD  u slt  exoim3no4openmfcsls  rtmurpou0tex ioctys m2emn o t0 ltriocoydfaDrluei;s)srurxm ny4lp nlfvtas srrmx  no1oee ifctytfaDrau p ()tetrirciytopDelu olt) rxmim oo4lltn net tfs2tm(mpnt1oexnmfciyslaDemumsnu0arenmocoatlmteln olt  2xoiopoydomeemnvta(fs2ururp;o1tex mo3ildfsDrlu snt4aeermocoo1fpDeluvs;s) rxrxr3iodlmeelfvsat)s2rax ooo0tlxo ociadfmDemumo ()aexrxo oy1faDrluvs;()seuoxo iodole lneiatf rumx pot4oeenmicias mDemnms u4 ltnxocoy1fm elnei;(0srum(o3iodam   fvias)a2umuronu1tpxoifetaslm rm( o u)arxrxr ta1fm e iei (0t2uoio ou1lle liviatfs2rrxrpou1tpenmietytla uanms;(0 rtnioctatlpte n ol()t2toim3iydaltnmivs ( artmur oo0aet mi3tytfaDrluvs t4 exnmr iytoa eau ol() rxoio ou1amenmfetlsfaDuaur ;t1aexomoctlsls2um( o;u) rxomrciatfa e uvi ()t2xmxopio1al  miei tf Drm( pno4alenifeiat mDrmuvpnu)aetrifciydlateln ols0 rurir iodal elfvta(f Duaxm ou0olt ifetatfa2rmums u0artrxrcoatfmtelnes;()srtr(opiu1omenlfvt ( a2tm( oou0olenmfeilt a2ran p;t4 exnif iytfp eli s s) etmxrpno4altn nvs t)artrumpou1altniociadla2eanmp;u4aeenif3ia1omD livol(0seumxo3ny4ame  ivsat) 2rrxr nu4altomfctys m2rln on(4aexoxo3iatlat  i ols) etrxm3oydopt mfcsa(  rrmur oo0olxniociydls ulnvs;u0tleoio3to1lmDeanes;()texrxopou1ol e fei t) rtmu p;o1tlen fetyslmDrluvpn()aexrxociy1om   neo s tetmxmpiu1lmte nvilsfaDtax pnu0texo octys s ra( onu0 rtrmo3iotomt anvol() exm(m3oudlmte fei s a2raxmpno1alx mfcildlsDrl(mpnt0texrmrciy1op   ivolt  rtmxr3iydlpt mnvtl( s2taumo;u0olenif3iytfm2emuvpnt)arxnxrciotfaD lnes;t0teurxmpnu4optn fet ()s2taxmo;t4oeenmociadfs2ul(ms;u) lxrxr3oatop rluvs t trtoio oy1ole liesas  2tax p;o4alenmocilsfaDumnmpnu) exrir3ia1fp  anvo () rurio io4lme lfci tfsDrm( oot1tetn i3ildla ean sn(4 eenir ta1fpteanesl(0t2xoxr3iudlpee fvt t)artmumo;t4tlto fetydlm emnvo t4trtnif tatomt aies;( t2trxopoodopte ieia()srtmu p;t1apxnmoetldlsDulumpnu0trtnif ta1lpt au ils)tetmiopiydaptnmnvtlt sDumxmpnu4aptomoetytfm rm( snt4tlxnxr3oatfa   u s;(0s2xoxopnydlmtnmivi s) Drrx p;t4tpx ifcilt s2elu snt0trenmo3oa1opt aivslt truoxm iy4lmt lfetl( arrrur ;o0tex moetldlsDrlnmsnt)aexrio ty1lm   iei s0 rxr(rpno4ll nmfcs tf rtax  ou0olenmietyd s ua(ms;u4alxrmo3tadoateli i;s0trxrxopoo4ol e nvi t)sDtm(rpoo1altnio3ilsfs em( s;t0arenxo iytfmt livsls0 2xmxm iy4omtnlivia( aDtm(m ;t0alto ieilslmDemn o;u)tltoxo tytomt li s;t) rum(opoy4lmt mfesas)aDrrxmonu1ole mfctls s2eaumsnu4 rxrxr3oatlmteanesls  etoxr3oo1al nmnctat) rrrxmoou0texoifctltfs em( s u)teenio oydfa raiei;s)sexoxo3iy4al e fcsltf rrm(rpot1alxniieiydfsDrluvont4tetomf iatla  aieo t  exrxo3io4lmee fetl( aDurx p;t4olx  iciltlsDrmn o u0altnmo todom elivslt)tetrxmpno1aleemnvsl() Dua(r ou1oetn ocilt a2emnmp;u0aleomf3ia1faD ai olt srxo(mpnodopt  ics (  Drrur ;o4tlt mieilt m uau pn(4altnir3tatomt lnes s)srtm(r iy4ale mnes sfsrtax  nt4apxomo3iydla2elnms t)tetnmf3oydlaD lnvsl(0s2um(r3io1opt  fcil(  rumu  ou0tpx  fctad a2ulnmsnu4aetrio3tadom rluvi t0 eumxrpou1lpe mfvt t)artaur ;u4tpt  octyt a ulu on(4trtnmf3oytlp   i ils)texmxm3iu1llt licilt)sDuru  ;o0oee  fciltls ranvo;(0tlxrxocto1opDelneo t s2trir iy4ameemfcsa() rraum oo4tet mf3tadfaDeaums;(0trtomr3oytom rlnvslt0srtoxr ny1alt  feia(fa2uaum no4olxnmf3ias sDemnmp t)aeermf3iy1oa   ivi;() 2xrxrpno1omenlnei s)aDta(r ot4apeo fctysls um( p;t0alerio iydfmD au i t)sexm(r3ny1am nlfeslt)s2rr(rooo1tle if3iysla2em( o ()aeeomf iadfatrliei (  rumxmpnydlmt  feias) Durxmooo4ape  i3ild a umnms;()tlenmf3oa1lm eluvilt0srxrxmpio4olee ieta()arum(r no4tpx mo3tyt m uanmonu4 etniociytom   n i;t  exrxo iu1lle mnvtltfsrtm(rono1altnif3ils a2um( o t)texoir oy1omDrlnes s) 2ur(opno1optemivs s) ruauro;u1oexomfeiydfmDuanmo;u0 exoio oytomteanei;(0 2trxr3ny4ll nlneta(  rur( p;u0tlx  ociadfs2ua(ms u) lxomr oy1fp r i i;s) rtrir io1lm elicias  2tr(rpou4alx if3tasls2ulu s;u)arxnif oadfm rlueo;s)seum(o oodolen nvsasf 2taxrooo0tlxnmociaslm2rlump;() rerxf iadoaDe n o t sruoim iy4lp   ics sf 2um(rp;t4alt mf3taslsDranms;(0trtnxr3tytlmte nvi;()teumir nodap e ivil(f 2tm(mooo1apt mfeiytfsDrm(ms u)tlxnio iydoateli s;( t2tmxopou1op elieiat) rrm(  ;o1ole ifctydls elnvont4tlxrmf3io1fa ean i () eumxrpiu1ope mivsas)sDrmxmpot0tlxomieiyt aDulu pnt0aetnxf3iy1oa rluei ()setrim3iodlpe lnetat)arur(mo;o0aeeniicild mDemnmo;(4 lxnif ty1fpD  u i;(  etoio io1lleemivilt)aDumxm nt4tltniieildlaDemu s;(4aeerifciytom rluvs;s) 2tm(opoodlpenmnvi s)arua( ont1aleomf3tadlmDrmnvsnt4artrmf oytfpDrluvi;t t2toirpny4ome mnvsat)sDtmuroou4opx if3iyd m ea(vsnt4trenir3to1fpDe n i;(0s2ur(m3nydamtelieil(farrr(rpot0oetnmoetytfm umumo (4tlxnmocoy1op  ai il(0trum(o3no1ope lnvsas) Dtrx oou0tpe  icilsfa2ea(mp;()aeeoxfcoatlate ueslt t2xr(opiy1apeemicsls aDrrumooo0aex ioeiad mDra(msnt0alenxr tydfp rai ols0srxoir3nodal nmics sf 2trur ;o4optnmoeiysfs2um( s (4areoiocoatla e uei t  2xrir3io4omenlies s srurxr ;u1apxo octlsfa2ra(vsnu)texoir3totfa elu i;s trxoxopiu4op emfvtlt aDur(mpot0tpe mieiyt mDean on() ltrxrcoo1oa e n ols texoim3iy4om e iet s srrm(  ;t0apeoifcildlm el( o (0arxoxo ty1fpD lu ol( trtr(o nydol n fesls) 2rrxmooo4ape mociad s2ranmsnt4trtrxr to1fm  luei t0texr(mpnudll n ieia(farumx poo1tee mf3iaslm umn o u0 reoxr oa1fm eanvo t0 2xrxm3oydll   fesl() Dtmxrp;u4aptomi3iysfm eanvsn()artoxociadoa rluei s0srxrir3nu4lmeelfcils)srrmx  ;u1ape mf3tltlm2emu o (4trxoxo oytom raueo;t)s2xriopno1omee fvtlt a2um(rp;o4apeomociltfs elumsn()tlxoir oydlatean slt)s2toxopiodlltelnctas  Dtrum ;o1aetnmiciydla ra(mon() ltoxo to1laD  nei t0 rumio3oy4apte ies tfsruaxm ;t1oetomfetas mDeauvo;u4tltnifciadoa e uvi;t0texmxo nu4oltemfct ()sruaumo;o1oeeo fetatlmDum(vpnt4treomo tatoptrluvo (  etmir3io1lm nmict ()s2rm( pno0optnioctaslmDul(vo t4tlxoio3tytop  ai slt seur(o3iy1optnliesas)a2taumoot0aet mf3iad m elumo;t)trxrmr ootop   ivslt)seuo(rpiydlme mfetat a2urxmp;o1ole  ieild s2eanms;(0 rtnxr3iy1la rlnvo () 2xm(r3oy4lmtn nvi sfs2rm( p;u4aeeomfeiytls2elnvo;t)tltoxocty1opDe uvi;t  rtrxm3ou4olenlicsa(f Dumx  ;o1tetn o3iltfs2ul( o;u0 eenmr3tytfa e uesls texoirpoudlp nlfctl()sDrmu  ;t0teenmo3iasfmDelnvo;(0aetrxr iydfp rln il()s2ur(mpnu1omte ies s srtr(rono1aee ioeild s2umu p;(0 exnmfcoydoaDelu o;t t2to(rpiu1ol nmieta() rur( pno1tpe ioetysfm rmn s u)areoir3iotlaDr neslt t2trxopiydlleelieslsf rurx  ;u1altnmfetldfm ul( p;u0 ltoxr oa1lm   uei t0trtrio nu1lm nlietl(fsDurx oou1ape  feiaslm ea(mp t0artnxo3oy1optrauvolt)tetrxm ou1omeelnvtat aDrm(  ;o1tlt if3tlsfmDrmn s;()aeerif3ootla  au i (0 2tmir3ou1om e fcs ()artm(ront0texn oetysfs2ulu p;u0trxnio3ta1laDelu i (0 2trxm3iy4ll nlivilt a2uaxr nt4tlt mfciltlm el(mont) renxo ootlpD lnei;s) 2to(o ny4op emfvi t aDtaxrpot0apxnmiciysfa eaums t4trxnmociydoa e uvil(0sexoxm3io1ol nmiet (fsrrr(monu1aeenif3ild s ulnvs u4trtrxr3iytfa  aies s0sexr(o no4al e fcil(  rrr(r ;t4tee  f3iadla el(vpnt)alxrifcootfpD lieo t trtr(r3oydal  liei ()sruau oou0oetn o3tltlm2elu p (4 rtrmo3iytfmDe ies;s0 exrxrpoydam   nvt tfsDtau  nt0olt iociytla2ul(msnu0aeeomocia1oa   uvsls0sexrxr ny4apen netat) Dururp;t4opxoiieias sDraumont) lenmocoydlpte u slt) rxm(r3ou4lleelnvs sfarraxr nu1aexo oeiyt m2ul(ms t0 eenmfcoa1lat aues t  exrxr nudlle  nvi s)aruaxr ;o1aetniietldls2el( s (4 etrxf io1fp e ivo t0teurxr oo4opte ictas a2rmu oot4ale mi3tytlaDrmu pnu0 renio3iatfm   neslt  ruoirpnodoleemnvs tf 2raumpot1tptoiiciytla rlnms;t0aetomf3iotlmDean i;s0 etr(m iu1olt micsas srurx  no1altn ietytfs el( s t4aetnmr oo1lmt  i o;(0 2xmxm nudalte fes sfs2tru pnu0tet mfeias m rauvp u0trtnio oa1lmDe uvils0 etoir nodale lnvt (f rtaxrpnu0oeeniociyd a2emumo;(4arxrmo todfa  ai s s  eto(rpoy1omtnlfesasfaDtr(roou1tle io3tltfaDrm(msn(0 renmocoo1faDeaivo;s0t2urirpnu1ol elnei (  Draumpou1optn ieiadfa2umu o t0trxoxf3iotopDranvo t0t2xo(r io1am nmnctls)s2um(mooo4aptomf3tasfa2ean s;t) lxnmocoydlmDe i s s teto(mpoy1lm e nvsa(farumur nt1aleomociltlm um( on(4 etrif todlaD  ueo t  2tmxopou1lp n nvtl(  rrrxr ou1oex mfctadls rluvo;t) lerxo3iotlp r uvo;t trtoirpno1aleemnvsasf rra( o;o1tlxnmoetytfa2umnvp;u0alxrxr tadom  aneols trto(r3nu4alt lfvia(  2ur(  nt4aet mi3iydla2ea(vsnu)treoxrcoadoa raivi t) eurxrpnudlmte fcil( arumxmo;t0opxnif3tadlsDrau p;(4 lxomf oydfmte neilt  2uoim3oy4ole  iesas sDuaumpoo4tltnifciydfs ean o;u)aeeomr tytopt  u i s)t2umxo oydaltelfctat aDrrx  oo0oleo o3tadfsDra(mp u4 etoir oa1lp r u i;t)sexrxmpnu1open nct s  rtr(m ou4olto o3ils a ra( p;u)tlxnif3iytoaDe i il(  rxmimpny4lmenliet t a2tm( p;t4opt  fcildfaDulnvs t) rxoio3tytlpDrluei;(  rtr(r oo1ll e ivsls)srurxr ou4tpx io3tld aDrlnmonu0 leoifctodfmte ieo t) 2umxrpno4am  miet s aDtm(r no4ale mi3tltla2uln o t)aetoxo3tatfpD  u sl(0 rumir iu1omtnmncs s  rur(r nu1oetoio3iatlmDuluvs;t4 rtrmr to1opDranvi;t)s2toir iu1oleelietasfarrm(roou1apx  ictyt m2um( o;()teenio3to1omD an o;s) eurir3io4opt mfvsl(fsrurxmp;o4olto fcias a2ra(vp (0trtomr3iydlat an s;s)srxrxr3oudol nliet (  Dtmxmo;o4alx mo3tlslm el( p () lxrio ia1om ranei;(0s2xm(o3ou1amtnmivtltfartrxr oo1olxoiiciytfmDranvp t0trtnmr iy1laDeauvols0sexo(opnu1lpt  fct t arraxmpoo4tet if3ilt aDrauvs;u0 rtrifciadoa  lnvo;() 2tmxrpnodlltemics s sDuaumo;o4oltoii3iytfsDeluvs u0texoxo iotlatrlnes;(0seumxmpno4ameelfeias)s2ururpnt0oeeo ietlsls eanvs;t0 etrxo iytlm r n i;(0 2xmim nodlmtn icta(  2rr(mpnu1aleomoetatfs2ea( s;u4tlxrxocta1fp elneo ()s2tr(r nodlmenmfcilt)a2urumont4aee iieilsfs2eln on()trtoir3tytlat  i o s  rurxm3iodlmenmies s)srrrur ;o4apt  i3tysla2eanvs t)aexrio tydfm eaueo;t0t2xm(r3nu1apeelfct sfsrrm( oou4texomfeiysls um(vp u4tlxoif tydlmDranvolt srtmimpnu4lltn ictlt) rua(ront1oeto f3iydlaDrl( o ()tlenxfcty1faD liei;t  2trirpiy1apt lnvs s) Dtrur nu4alx mociltlm elnvs ()artoiocoydfa e uesl(0 etoirpiu1am  mnvsas srum(ronu4apto ictatlmDrlnmon(4tetnxo3oydoa   nvi;()srto(o3nu1omtnlncslt)sDrm(m oo4alen fctys a rlnmont0 reoif3oydfp  ai o;t t2uoxr ou4ol   ncsls) rtrxm ou1tetn oeildfs2um(vo (0altomo3to1lmDr u i;(0trxrxm iy1am nmfvilt s2ta(  ;u0aeen feilslmDranmpnt4 lerir3io1fm  lies t)seurxr3nodame mivtlsfarrmurooo4oex  oeiadlm2emnvo;t4aexoif to1lmDraivslt0srxrir3nu1lpe mivsls arum(roou1optn ieiatfm rlu pnu4tlenxf3oadopte ivil(0 2xm(mpnodap emnetls) 2taurooo1olxnii3tyslm2ea(mo;t0arenxo tydfp  anvsl( srum(r3iydoptemneiat sDra( p;o4olxnifetls m uluvont0teeomfciadlptelu s;s) etoim oy1lmtn ncilsfa2um(r ot4tlxo oetytlm2emuvs u0tetomr3iodfm e ueo (0seuoimpiu1lpt lnes ()sDtr( pnu1apx ifctadla ranmp t4texrxf3io1omtrlu ilt s2xoir nu1ameelivtas)srur(m ot0openiictldfs uanvp;t4teeoxf3iydomtrli s t)t2tmim3no4lpt lncil(fsrumxmp;u1olenifciasfm2ean o (0aexrxfciy1la  li ils)t2xoiopny4lle  nvil(faDtaxmoou1aetnmietat m2elnvp;(0trxomo oa1lmtrlueol(0trtm(m io1lptnlivtl(fs2rax  ;t4teen fetyslmDumu p;u0artnxr ia1laDeluvo (  rurir3oodomtemicsas)arurxro;t4optnifetls aDelnvp () eenxo3iodfa rlnes;(  rur(m ou4om  lfetasfsDrruroot4apx if3ild m eln o;() eermo3tytfaDrlneo s trxr(o3iydop n fcs tf Duru oou4ape ifctydls2umnmo;u) rtrmr oodlp r n s t) 2toio oodll emictls) rtrxm oo0olx  i3iad m rmu p;u)trtniocoadom r ueilt trxriopoy1ome lfvs s)aDuauro;o1olx  f3iat aDel( o (4areriocoatfa eluvilt  etmim io1ope  nci sfartru  oo4alto ieiyd sDem( o;u4tetrmr ia1oatrai il(  2xr(opiu1lptelfvi ()sDtmurono0altniocias s2rluvp;(0 rtnmfcoadlat li i;( trxrxm3nu1lltelnctlsfsDrmum nu1aeenioetldlmDrmump (4 etomrcto1lm elivsl() 2uoir iu1ap nmivils aDurxmp;u1aleomf3ilsfmDulnvs t0texnifcia1lm rln il(  rurxr3io4lm elivi s)aDrrur oo1tetnmfeiasfm2uanvo;(4aetoxo oydopte nei t sexm(r iy4lme  nvsls)a2urx pot4oee  oeiyslmDel( onu4 eeomr3todlmt  ivi t)teum(o3iu1llt lneiltfa2rmumo;u0teenmo3iydfm raumpnt4arxrxf oy1oat livil( srxmxrpoodoptnlnvi t) rraump;t1opt  o3tls a ea(vp (0aeeomo3iydom eau o;s0 eumxrpiudllt  fesas)arrrxr no1texoiictyd a elnms;(4aeenxo iadoatelneilt0t2xmxrpiudape lfet t) rraxrpoo1tltniocias m2elu s (4trtoxocty1faD lueilt0teur(o no4ame mivtlt  rtrxmp;t4tlt  octadlm2umn p (0 ltnmo oo1oa rli ol( setm(m nodam e fvi (faDra(r nt1oee io3iad mDrl(ms;u0arenifcootlmDe iei s)t2uoio io1ap nlfvs s  Duax p;o4tpxo fciasla2uauvs;()tetrio3oa1fa r nvils)truoxr iy1aptelici s)sDrmxmono1oexnifctydfa2ra(vp;u)arxoir oa1fmD lu s s0 2uo(rpou1am elicsl()sDururono0opxnioeils s2ul(vs;() eeomf3oa1lm r ivi;s  2uo(r nu1lmtn nesat) 2urur no1alto oeilslm2rl( s;u0 renif oydlm elu il( srur(r3oudame  net t a2rrxronu0oleniicilslmDumnmont)trtnio tadomtranvslt0tetm(opnu4lleemncsa( aDtmu o;t0opt  ocild sDuanmp;(4alenio3iodlptelivi s s2to(r3iy4ll  mfct ()a2tmxmp;t0oee  feiydlmDrmn p;u4 ltrif oytoa   nvs (0t2xoxo3oo1ope  nvs t srraxmooo4oexomi3tasfm2eanmo t)aexrmrciy1lmDr nvo;( s2toiopiy4lpe  ietls srtaurp;u1teen fetatla el( pnt) lxrxo3todomDe nvo;s0tetrxrpno4optn ietas  rrauroou1opeomfeiadfm2ulnvs;(0altoio ia1fmtr n o;t  etm(mpny1amee ietat sDtmxront0aeeomoctatla2elnms () rxomf3oodlp r ieo t0 rum(r3iy4omeelfvt t srta( p;t0aee  f3iad a2ulnmsnu4 rtriocoytfa raieo ()t2trxrpny1altelfesa() rumur oo0apx ii3tlt s2ean s (4 etnif to1oa rlu s s truoxm oy4ll e fct ( srtmur no4texn ictasfmDuan s;t) leoxocootlateaieo t)teuoxr nu4lltnlnctls  rtrx o;u4tlxnmfeiltlmDul( onu0 etrxoctydlm ranvsl(0t2tmxm3nu1op nmfctl( a2raum ot4opx ifctadlm2ranvo t) eerxrctotoaDeauvslt trurim oy4oleemfvtltfa2uaxroou1tex  o3tld a umums;u4texrio iy1lm raivols t2xr(r ny4oltelncil( aDraxro;u4aptomicildlm eau p u)tlxnmocoydlp   uei;s  rtm(o3iydop emietat s2umxrp;o1olt ioeilt aDrmnvpnt0teenxo io1oa eaieol(0 exr(opio1lmtnliei ( sDrr(  oo0oee iociys aDra(ms;u4alxrmfcoatfa r i s;() rumxm iudameelfesl(f 2trur ;t0tlenmieiyd mDelu p () lermf3oytlat lnvs s s2xrxo nudaleelfvslsfs2tr( o;t0opt  ieiydlm2umnms (0aeeomr iadfpD lueols0trto(o3ou4omee nvt () Dum( o;t4oleomfeiatfa ulu s u0texomo3iatlm  lnvols)trurxrpno4olt lnciat srtmxmp;t1tet mi3ilsfaDemn snt4 rxnif ty1fa raueo s)setrimpnu1lmeemiet t) 2ra(monu4alto fctytlaDemn snu0trxomociadfm r n i;( t2uoim iy1lm nlnesat)arrmu  ;o0tetn feiyt s2uanvsn(0 leoxf3ootlpDranes;()trxo(opiydol elieta(fsrta( onu1aleoif3ias mDeluvonu0trxoir ty1lmtraueo;(0 etrir ny1lmenlivtas) rrmu ono4aexn f3ias mDel( s u0aetnmo3todfm r uvol( t2urxr nudlltn fci s)s2urxm oo0oet io3iysla2ulu o u)alxnio ta1om  aivi;( t2trxr3oy4lme lietl(fa2uax o;o1apt  oetytlm2el( p u4 rxrif3iadlp   u i s t2tmirpnydlpte ietas)srrr(mooo1oetnif3iasfaDul(mo;(0 ltomoctydlp ean i;(0t2xrio3io4llenlieil()arrrx poo1aeenmocils s2uaumon(4 rxomf3tydfptelu ol(0trur(rpou4op  lnesa(  rurxmp;t1oexn feiydls eanmo;u0tlxoioctatfat luei () euoimpou1lmtnlfvi s aDtau  oo0alxn fcildlm2emuvont0altrmf3todfa  anesls)teuo(m3iu1lp nmfetl(  Dra( oou0opx if3iasfs2em(monu4aexnxo to1fpD lieo () etmxm iudol nmnetl(  Dtrumo;t1oetniiciyt mDum(mo u) ltnxf3iy1opD anvs;( s2tr(r iydolenmnesltfaruaurooo1teeoiocildlm2el(mp (4tltoxociodla rli sls)setm(o3iodalee netas)sDta(ro;u1apxn ieild a2elu snt4altnxf iatomDrln s;s)srumim3io4lm  micsas) 2rmur ;t0oleoifeiytfsDrmn snu0 exoif iytlmD lueo;() rumir3ou1ol  lict s  Draxr ou0tpt ifeiltfaDraums t0altnir3oatlm ean i s) rxmxopnydom   fvtl()aDua(r ot4oeto oeiasfa um(msn()tlxrir3ty1lm  lu s s0sexoio oy1om emnvtls s2rr( onu0ape  feildlm2el( ont4tetoircoytfptelu ils)t2xrir3ou4olt  ici (fsrrr(ront0oex ifeiatfa raump;u0tltrmrcoadlp  luvo t)srtmxm nu1optemnvsa(fa2rm( pot4olenioetat m ra(vo t) lxnxr ia1fmt au s;s0trum(mpiu1omte ncil( a2ta( ooo1oleniocilt m ran p (0 ltnmf oy1lmDeaueilt s2xo(mpiu1om  mnetl(  2umxro;o4apeoioetytlsDul(mp;u) rtrif todlm rluei;t s2tr(opiydoptn nvi (  Dtrur ot4tpenmoetlsla2elnms;() ltnifciydlmtelu s s  rtmim3oodllen fcta()srtaumpnu0olx  o3ias a rl(vp (4trxomf iotfmD  nvslt trxrio3iy1ome lfeilsfa2tru pnt1aex  ociyt s2umnvont0 etrif3oadfaDelivo t0 2tr(r3iudll nmfvt ()sDtr(rpou4tptnifctltla rluvp;u) rxrxf3iotfat lu slt0trtm(o3iydom elfcilsfsrumur nt1optnmietldfmDemuvon() ltoirciy1laDe ies;t) etm(r3iudomte fcs s) rtmur ;t1aexomoeiys a2elnvo t) rxrir3oydlm r ueo s0 2urio iy1olte ivia(f Dtr( pno1apen o3iytfm umn snt4trermfctatlmDeanvslt teum(m iodlm elncs t  Draxmont0olt mfetat a2uau s u) eeoif tytfaDrlu ils srxmimpiu1ape mfvi t s2rau poo1aet ifctltls uaumsnu)arxoio3io1oaD an s;s trum(mpny4lle mnetatfsrraxrpnt4oetomiciysfm rm(ms;(4tlenifcoydop  lneslt)srtmxo oo4lmee fet (  2tmumoot0tlxniiciasls ra( onu)aexnxf3tatopDrlnvs;s  eum(opoodlpeemivsl()arta(m ot4aex mfctysfs uluvpn(4aexoxr3iy1opDrlivo;t  2tm(m3iy1ap  liet (  rrrx pot0optn fciys aDumnmsn()aleoxrctytfpteluesl(  rxrxopiydol e ict s a2trx p;t0tltomo3iasfa elumo (4 rxrifciydfm eanvo s seuo(opou1altnlnvias artax  nt0aeto iciytlsDuaumo;(0 exnmo3iodfatr i slt srumir oodlmt lfvsas srta( ono1aet mocild a2rl(vo;(4aetnxo iydoa  lu sls texrxo oy1lp  lnvia() rtrxrpot4alx  o3iytla2ua(mo;()teermfcoa1lmDranvols)seto(o3ou1lm emieias srta(r ou0opto ietld a ra(vsnt0tetrif3oy1fpDe u s;s sexrio3iu4al   ieilt) rtauro;o0opxnmi3iyt m uluvo t0 eeomr3oodfa e ueil( t2uoxrpiu1olenlicsl(f rtmxmo;o4olx if3ildls elu p;(0 eenxociytfp   u sl(0sexrir3iydaltn ieia( s2ta( pou4aleoif3iyd mDrmu p;()aetoxo3tatfaD  u s;t0texr(r nu1al emncta()aDurxmo;o4teeomfctydla2eanvsnt4aeeoxo3tydlmte n slt)tetrxo3iu4lptnmnvt s arra(rooo0oet ioeiad aDrl(mo t0tetnxrciytom   ivo (0trxrxr3oydom   net (faDtrur no4tex ifctytfaDemnvsnt)alxnxrctodop e i o;()seur(m3ou4olte ivslt)srtaurpnu4alen ieiad m uau pn() eermoctatla eaiesl( setrio ny1ap nlncslt  rum(r ;o1opt iictyt mDean onu) rxomf iydoa   ues s  rurxr io4lpeemivs tfs2uaxmp;t4tpxo ietadls ulnmo u0tlermocoy1lp r neo;s srumio3iodam   nct tfsrur(m oo4tptnifctasfsDea(vo t)tetomociodom r iei;t)seto(opnu4ole  ici s) Durxmpot0ape  ictyd a2rl(vo u4tltoxocoodoaD ln ols)t2tmir nydop nmfetls)srtru p;o4ope  ictydfm um(vo t4tlxoxo oytomD  uesl( trtr(mpiudlleelfcta()a2ra( ooo0tpeomfeiadfs2ean s t4 rerxo iydla rau o;s s2tr(mpiy1apeemivsa(f rtru  ;o1aee if3iatls em(vo t)arxoir3oa1fatr nes t)srum(opiy4llenlictasfsrtrumoou4alx mfciydlsDrluvpnu0 etoxo todlm   u s t  etmxo iy1lmtelnet s)artax onu0ole  ieiatfs rl(vp;(4treoif3todlaD  i s s)t2trir3iodlme mieil()s2rm(  ;u0alxnmi3iasfmDrlnvsnu)aexoxf3ty1fpteauei;s0 rtrio nu1op emivslt sDtrxrpno0tpt  ociytfs2ul( snu4aeerxf3tadfat  u sls0sexrxo iudolt livi s srumu pno0alx  octysla uln onu0arxomf io1omDr n i;s0 exr(m io1amee nvilsf Dtaxr ;o0tlt ifeiadfaDrl(vs (0arenxo3ia1oatran s;s0 2uoiopiy1altn fci t)aDum(mono1olxomf3ilt mDumuvo ()tltnxrcoadop  anvs t) eum(m iy4ale lnei (fa2uau o;u1aleo iciltlm rmu sn()treomrctatomtrlu o t)s2um(mpoo1alte nesa() 2rrum nu0oleo ictysla ul(mo;u0 rermocio1lp e ieo () rtrxr3iydlme lfet s)srtaxmp;t1opeomoeiadlaDem(mp;t) rxrxr3oodoatean s t) etmxm nodamte ncsl( sruaxmp;o0aetn f3tldlmDean o;t4alxomrctodfm elnvi s0tetmxopno4opee ieilsfsrtaum nt0aeeomi3iys aDelnms u) rtnxr3iy1optrluvi;( s2uo(m3iu1al  lncslt srurxm oo4aleomiciadla2ul(vo t4 leoxr oodfa eli ol(0 ruoiopiudalen nvtas s2uru pot4tlxniocilsfmDranvonu0tltomrcoadoate u s ()teuoxr oy1lmee ncsa(  rta(mooo4tpe mo3tatlmDrmuvonu)tlxoir3tydfp  li ol( t2xmiopoo4optnmnvt t sruau p;u0opx io3iatls uln s;()tltoio3tatoatrlivol()seuoim3iy1lptelncil(faDra(mpno4oetnmi3iysla2rl( o t4alxoxf iadfp   nvo;t srtoio3iydlpe mfvia(f 2urx  ;u0oeen ictlslm ra( o;u4alenif3oa1lat  neol(0t2xo(o3oy4amtnmivsat) rur(m ou1olx mfciat aDelnmpnt)alenmfcoa1op eluvil(0s2tr(r nudaltn icilt  rurxrpnt0tpxo ieildlsDemu p;t4 ltomfcoy1opDe n s;t)srtoxo3nudoptelicsa(fsDrr(  nu1apt  i3tat m2elu o u) exoxrcia1lpt ai o;s)s2xoxo iy1ol emics (  Duaxm ou1apxo fciyt s rmuvsn(4aeenxocoydlatrln o ()s2xmxm3no4ole  feiatfaDrrxm ;t1tlx  octydfaDulu o;(0 eerio3iytlpt  uvo s)t2xrxrpnu1lmt mics s)a2ur( poo1olenmietltfs2rl(vsn(4trenmr oytlat lnesl(0 etoxmpnu1opee fcsltf Dum(monu1tex iieiltfmDeaumsnu0arxnmocta1lptelnvsls sruoio3nu4ape lncslt)s2tm( p;o4tlxoif3iatla2rl( p t4tltrxo3iatfm eaivo (  exmxopiu4llt  nvi s s2tau p;u4aee  ociad sDem( p (0arerxo3ty1latrlueslt)tetmim nu4omtnlfetlt  rra(mpnu1tpen i3tys aDulums (0 lxrmo oytop eanvsl()t2tm(o3oy1om emfvta(f ruax ooo1apeomoetydfm raumpnu0trtnmo3iydfmDelnvo t0 rxrxr iy4lp elfesl()s2rmumoou4oltniicias sDrln p (4trxnmr ia1omteanvil( trtoir oydolenliet t)aDtrum oo0apxomi3iyslsDeanvsnu0arermf3to1fm eluvo;t) rurxopou1llenlfvs t a2rr(ront4texn icild mDemnvp u0aexrir3oytomtr uei s  rumxo3oo4optnlictat)artrxrpot0tpx iieildfm2el( o;u)trxomr3ta1fp r ueilt0srumxr nudoptnlnvsas s2raumo;u1altomfeiadfaDrauvs (4aleoio ootom r uvs t)teurxo3oy1lm n fcsltf 2tmxr ;t0teenmfetytla eauvp;(0 etrmo3oy1oaDrauvs s) rumxr oodlp  mnciatfarua(m ot1alx  f3tltlm2eanvon(0texrxf oadfp   u o s)s2tmxr io1optnlfesl( aDurx  ou1tpt  i3iatla2rmn pn(0tltrmr3tydla  livi;( tetmimpoy1ol e fcslt  Dumu ont0apt  fctytla em(vpn(0aexnxo oo1opDeli s;()srtrio3nu4omt mnesat)srtrxmp;u1tpxomfciasfaDum(mpnu) lenxr3iatoatrlnvs ()s2xoio io4omtnlfesasfsDtaur nu0oet mieiadfaDemu snu0aeerxo ta1op ean o ()t2um(r3oy4altemfvs (f 2taxr ;u1tee mictysfs rm( s t4tlxnif iadom r ivo t srtr(o3ny1apenlfes ()sDtrurooo4texoio3iasfm2umnvo () ltoxf3oo1omtrlnvi ( trto(opnu4apen icsas)aDrm( p;t0alto ociysls ul(vp;u0 reoio3oo1optelies (0srtoxo iu1al  mnetlt  2um(root1apx  i3tytfs2rlumo (4 rtriociy1fpt  nesl(0sexrxopoy1lp nlnvtat)a2taur ;o0alt if3tyd mDuln p t4 rtnmfcootoa  anvsl()srxoio3oydlmt lfvtlt arur(ro;o4aeto o3taslm ra( snu4tlxrxrciadlaDeaueo;( trxmxopiudal nmictatfaruaxrooo0ole iiciad s2rmnvp;u0tetnxfctodlmt lnei;(0 rxoimpoudoltemiei t  Dtr(rp;t0teeoioctlsfa2ul(ms;t4tleoif iotom rlnes s trtoiopny4ameelnet s) 2umu p;u1ope  feiltfs ul(von() lxomr iy1laDr n s;(0 exrxm3oy4am  lfcsas) rurumpnu0apxoiiciytlmDrln s t4 rerifcoodomD lies (0t2tm(m3iy1lpenmietlsfa2rmuro;o4oltnmieiasls2umump;t)trtoxf3oadop r u s t  2tmimpny1opt mfetas)s2ur( ono1apt  oeiytfs2eanvo t0tltrir3oadomt ln s (0 exo(o nudlptemfeiatfa2rmum oo4aet  f3tldfa umn o t4 eeoxo3oo1fa rlu olt0 etmxo3iudapenmnvil(f rrax  nu1tee  fetytfs2eauvsn(4trxoxf3oadoptraivs ( seurirpiy1aptn iei t)a2rm(moou4tlxn fetadlaDem(monu4 eermrcoy1la   nes;t)t2umxo3nodomte net t  Drrx o;o4opxn o3iys m2ua( snu)aleomocoa1lmtrln i s) etrxrpiydlpe micia() 2tmxmoot4oexomictlslmDem( s () ltnxf3iytoaDeaueo (0 2toio iydal nmnes ( aDtm(  nu0apeomoeildfa2umuvs;t4aexnxfcty1laDeln i;s)trtm(o3iydlpe lieslt a2urxr no1alxoii3tysfs2ulnvs;() rtrxf3oydfa ran s;(0srxr(rpiodap  mieils)s2rr(roou0alxomfciysfa ua( o u) etoif oadop  anvs ()s2trir3iy1omt mfctat) 2ur(ro;o0apeo oeiytla raumo;u0 etnmf3iatopt lueol(  exr(m3iydllen fctlt aDrm(mont0ape ioeiad m2rlumpnu0 rxnioctytlp elneols0srtm(m iu4lp e ivi tfa2tr(m ou0alx mi3tld s ean snu4arxrio3oa1lmt aivo;(0 etmir3oudopenmivia(fs2tax  oo4texo o3iadlmDem( p;u4 ltnxf3tadlp rlueols) rtoio io4ole mieslt s2uax  ;u0oexoiieiatlaDua(vp;(0 eerif iodlatrli s;t  euoirpiudapee nesl(f 2tmumo;t4texo ictls s2eaums;u)arerif tydfm eln sls0sexm(r3ny4om nlfes t) Drm( pou0opx mfcilt m ua( ont0 rtrxf tydlatr i ils0 2uoim3ny4lmen iet tfaDuax  ;o1apx io3ilsfa rlu on() leomoctodopD ai o;t)texmxmpoudlmenmnvt (f Drr(monu4tlt  octlslaDem(mp;t)altoxrciydfa eauvsl( setmir3io4olen fcia( artm(m ;t0apxnmociyd mDeauvp;u4teenxf oytfmt  ueolt trxr(o3ou1am n ictat) 2umxmpou1oee  o3ils a2ra(mo (4 rtrif oa1lpt lu i;s)tetr(r3iydaltnlfcslt  rrm( p;o1oeeomfctasls2eln snt4arerxf oatom e ivs s)texmxm3iy4ap nmfeia(fa2tr( pnu1tpeo iciadfs ul(mo t)treoir tadla e nvi s) exo(rpoudomenmfet s)aDrru o;u4ale mietltfmDrau snu4tlxnmfcio1lmDr ueilt  euoirpiy4lltnlnet t  Drm( oot4apx ifetlsfm eau p;u0arxoxr tadoate ues;t0trxoxopoo1lptemietl(fa2uax  no1tee iociasla rm( on(4trxrircoydlmtrlneols0 eto(mpoy1lpt mnvt s aDtr(ro;t1teen f3tls mDrlumo u)teeoxr to1om rlues (0 eurxrpiy4ol n fviat)s2rrur ;o4oltnmo3iadlmDrmumo t0artrmf oatoaD aivs (0srurxo nodaltnmnct (f 2rm( o;o1olenio3iad s2umn p () etomf tatopt li il() ruo(o oudlptnlnei tfsrtrx ont0tlxnii3iydfaDrmnvs (4artomocoadlm eaiei;t trxoio3nu1ope  ict ( arrru  ;t1tlxnio3iytfaDelu s;u)trxnmr iytlm  aieo;t) 2trim3oydom   nvs ()s2raum no1olxn octlsfmDua(vs t4 rtoxr oatfaDeai o t trtm(r3nydoltn fvt () Dta(r ;t0oexomiciytlmDeanmsn(4 rtnxo oatomt an s;s0 rxm(m3iy1opt livsls) rurxmpot0aeenmfciytla2rm(mpnt0tleoir iadfm rli i;t0 exmir3ou1lme miet sf Durxm ;o1texoiieilsfm2um(vo (4aeerxo iydfp  lnvi t0 ruo(r3ou4omenmies s a2urxro;t1aexnmo3iat sDumn o (0 lxrio3todop   u slt teto(r nydoltelictas a2ua(  ;t1tlt  oeiysfsDua(vonu0 lerio ty1omDeai s;t)t2to(m oo1ope livilt arrm(r nt0tltnio3iadfmDul(mp (4texrxo3tytop ean o;s) rxo(o3ou1om nmnctltfa2rrxm oo4oetoiocils mDra(vsn(4tltnxr3io1oate u slt teuo(r3nydoptelfei s  2ta(mpnu1opxn fciatfa rmu snu0aeerxf io1omtrlneslt  2trir3nydlpe lfvtat  2ta(  ou1tlen fciys a2um(ms u4altrir tytlateaieils)s2trxm3io1lm nmncslt  Drm( onu4aptnioetydfs2rmuvsn(0trxrif3ta1fa   u ol( teurim nudop elfvta( sDuaxmoou1tltnii3ild a um( p (0arxoxo oodopD livils0s2xrxo3iodamenlnvs s)aDtrx oou0tee  i3tadla2uluvont0tltomo3totlp rlneo (0 2umxopiudllte ncslsfarrr(m no0teen fctld s2ulnvp u0artoir iy1lm rln sls)t2trxr3iodom  liesa() Dtmxmp;o1aexnioctatla eau p;(4 eerxo3iytoat lneol( trurio ou1lpe livil()arrm(  ;o0alt moeild m ul(vont0 rtoif3oo1oateli i t)s2tmio3nu1lltelicta( srua(m ot4aetnifciyt aDra(mo;()artrmoctatfm eli o t teumxo3iydll  liesa(f 2urxro;u0texniieiydlmDra(vp (4 rtomf3to1lp eaieil() ruoim3ou4om emies ()s2tmump;u0oexoifeiytls rmn onu0aeeoxo io1faDrlneils0t2uo(o oy1op e ivs (f Dumu o;u4apxn oeiadfs ua(ms t0 eeoxf3totfm elnvs s  rur(rpou4amen fcta()aDraxr nu1oexn o3iadfs2ea( p u0alxomfciy1op   uvs;t0texmio3oudopt mneta( artax ooo0aetn o3iad sDrau pnt0 rxrircoo1laD aueolt)srur(o io1lp e fcilt  2um(mo;o4apenii3tls s rl(vsn(0 eerif ootfptrlnvs t0 exo(o oo1olt  ivil() rra( pou0ope iieiat m2ea(vo;()aeeomocoodlaD li i ( sruoxr nodal e nviat srumurpot4ale ifciyslsDumuvp ()trerxrcoydoat  i o (0 etoxmpou4om   feil(f Dumurpot1apeoiieilslmDuan s u0 renircoytopD  ivsls)texrir iy1olee ncs t)s2rax pot0teen oeiydfa rmnvo (4aetrmfciydlat  uvi;t t2urxmpoo1omeeliciasfa2ururonu1tltoio3iltla elnmpnu0 rxnmf ootomt luvi;t0srumir3io4oltnliesls s2taxro;u1oeenmi3ilsfs2um(mo (0 lxoir todoa r nvsls teuoxo no1amte ici sfa2umxmpnu1aeeomf3ilsfsDrluvo (0teenmr3iadfp rli o;s0trur(rpio4olt mnes (faruaurooo1aleo iciltfa2rmnmpnu4 rerir iadfmt livi ( setm(m3iu4al   icta()sDtru ono4aexomoetadfa ul(vo;t) etrio oa1om eli il( tetr(o3iu1lltelivslt)a2rr(root1olx mociyd m ran s;()trtoio oydfat lu sls) 2tr(o3oo1lle mfes sfarta(r ;t1optoioetaslsDumnmpnt4 ltoxfctydoptrluvi (0 rur(m ny4am e ieiatfarra( p;t4olx iocildla2ulumonu0 rtoxo ta1opDraivo;t) etmxopnu1lle  nviat)arumx  ou1tex miciatla em( s;(0treoxo io1laDr i slt  2xoimpoudaptnmictl( sDua(rpno1apx  o3tldlmDelnvs;()trtoir todomte nvs;s)s2xm(mpny1amtemfvi s  Dua(moou0tetnmictaslm2umu o (0 eerxocoo1opDrli i (0 2urxm3ou4olt  nciat arrrumo;o1opeoio3iadlm ra( s;u)trxoir ty1fa  livs;s0trtm(m3ou4openmivil()aDrrxro;o1aexomoeiatls eaums;(0 rermfciodfptrlnvi t) 2urimpiu4oltn nci sfsrurx pnt4aetniiciys aDel(vp;(4 eenif ia1opDe ies;t) 2tm(o io4lm   feiasf Drm(m ;u1tlx if3iydfm2rauvo;u4alenif3ia1fmDe u s;(0 eur(opiy1oleemivia(  2rau pno0texoif3tadla2rln pnt4 etnxo oydfm  luvilt0texm(o3nu4lp  lfvs t srurxroou1tptn fetytlmDua( pn()texrir3tytfpD ai o t0s2trir ou1apt  ncsa( srum(rpnt0apx ifciadlaDemn pnt)aexoxf3oytfatrln s;(0t2uoimpoydlm nlnei () 2rmxmpoo0olx mo3ilsfs2rauvs;t4 eenxo3iatlm eln i t)setoir3ny4omenmnvt s  rumxm ot1alxn i3iyslmDeln o;u4 rerxf ootoat an o s)trxm(o ny1ale  nesat) Drrxr ot0tlx  octasls ea(vo (4arxnio to1lmt luvo;s srxrimpou4am e icsl( arrmu o;u0aexniocildfs2rl(mp t0alenircoo1lpte ueo;s0 rur(mpio1llt  ieslt) rtaxm ;t4opto i3tadlsDranms u4 lerif iadlpDr ivi;s texoiopno4am emfcslsf Dumxmp;t0ale mo3tydfs elu p;u)tetrmfctatlaDelnvslt)t2xoiopou1oltn ivtas  2rm(  nu1tee iiciys a uauvonu0aeeoiociodfm e neo t  2to(m no1open fesas a2urx pou1optnmieiadlm2emuvonu4 ltrio oy1lmtrlivo;s  rxmxo3io4openmfvsltf rur(m ;u1oleoioetydlsDel(vo t4trxrxrciatlmDr ivs t0 rtmir ny4al n fciatfs2raxrpot4tptomociatlmDelnmp;u4 lenifcoydla r uei;t)tetmio3nu4ll emictltf 2urxmp;u1oexn f3iltls2ulnvs;u) rxomrctodlaDeauvilt0s2umxr nu4ame mfvta(fs2tr(m ot0aeenifetydfm ulnvpn()tltnio3ootla  auvi;t teurim3oy4oltn nes ( a2rauroot0oexn ietad m2eau pnu0alxnioctytom rluvo;(0 rto(m nu1llenlfctat s2rrurp;u1oleo oetytlaDrlnms t4tltnio oy1omD anvsl( s2toxo ny4lp nlfvtas srumu o;o4olxnio3iytfa uanvs t) renmf3to1fa  auvslt) eurio oudomeemfcils) Drruro;u1olenifcild s2um(vp (4aleoxrcoy1omtr u o s  rtmxm iudlp nmncilt) ruaxro;t1olenifeiltfs uan pn(0 exoxf3iodfaDelieslt seumio io1omte feias s2tr(  ot0ole ii3iad m rmuvp;()artoir3iytfmt aies;t0seuoxopio1optnlicsatfa2tr(rpnt4optnii3iad aDra( s t0aeeoxfcty1fmteai sls0setmir3iydolee fctltfa2tr(rpno4altnio3iydls2ul(ms (0 renifctotoaDrai il(0 2uoxopoodll nmneta( aDrm(mont0tpt  fcilsfaDumn p;(0aexoxf iy1lpte uvilt0s2xr(r3no4aptn ivi ( a2tru ooo1olxomieiydls elums u)treomo todlp  lnesls  rto(rpiudoltn nvsas) Dta(rono1texnif3iytlaDrl(vs;()trxnircoy1fmt lueol()texoir3no1am nmncs sf rum(m nt1aleo fctld m ean s;t0alxrmo ia1oaDeln s s  rxmxmpoydam   iei (  Dtmxmp;o4olt  i3tls mDrlu s;(0 eenir3tadfpte nvo;s seurxm3ou4olt  ncsa(  rum( poo4oeeoifeiys mDrl(msnu4artniociatfpt anvo;( s2xmim oo4lmte fvtls aDrmxm ;t0aeeoioctysfa emn s;u)tltrmfctodfm   u i;(0t2tmxo iu1ap nlnct s  rtmx o;u1tptnmf3tltfa2eau s u4 lxrmr3tydom e n ols0srur(o no1am nlncils) rraxm ou1tptnifeias mDrln o;u) eenio3iadop rlueo;( srxo(r nodole micilt)srta(r no1olenmiciasla elumo;u0aetoif3iytlmt lu o;t0 2tox
\ No newline at end of file
@@ -0,0 +1 @@
+nvs;()s2um(o nu1ape  netat sDtmum no0tptomictlt s rl(vs u)altomfctotlpDeauvo;(  exrio no1lmen iesatf 2rm(root4oexn oeiysfm2uln s;u0alxnmfcia1fp eaneolt  ruriopnu1olenmfeiat sDrr(m nt4olenif3iys s2uanms;t0 leniociodom  ai s;t srxrxmpno1am emfctas)s2ua(r oo4alenifeiyd a ulnvs u)aeeoifctatoaDr ivo;t)trtmir oudlp nlfes t arrmx  nu1tetnmfeilslm rmnms u0aeenio3oa1op  luvi t0t2urir nu1openmnvsa(fsDur( ono1olt mo3iytls2rm(mo;t4tltrmrctatfa e nvi (0 etoiopiy4altnmfcia( a2urx  no0tleomfcildfa rauvs t4 rtnmr io1oa r nvols  2umxr no1alenmfvsltfaDurxronu0olxomfciat m2ra(mon(0aleoxr ia1oat  nes;()t2xoio io4am nlivt t  2tmxr ;u4tpenmoctld m2ean pn(4 ltnir iotfa raues t trtoir3oydom e nvtls) 2tr( p;o4opeomfeilt a rlu s (4aetnircta1lp rli sls0 rtm(r3no4llenmicia(faDururpnu4opt  f3tls m2em(vp;u)aeenxo3iytopDe uei;()s2xm(o oo1ap n feiat)aruaxroou0tlxo ieiydls2rm(vp u0 ltnifciotomD aueils  2to(opno4omtemnci s  rrmx  nu4tpxn f3ilsla2rmnms t0tleoxr ootfp  an i (0s2urxr3iudalte ivs (fsrrr(rpou1olt  o3iatfa2um(vsnt0teerxo3ta1fa rlu o;s) 2ur(rpno4aleelnci (  Drrxr nt1aee mietatfm2rm(vpn() lerircoodoa   u s;()seumio nudllt mnvta( srurxm oo1apen o3iltls2elnvpn(0tlerxrcia1fm   u i;t0 rtm(o iy1apen nvs s) Dum(mo;t0tlenmo3iltls2eanms t0 rxoxf oy1lpD  n slt0 rxr(o oo1aleelncslsfarururono4tpt ifeiad s2eln pn(4trxrif3ty1lmDrlneslt0trumiopoo4aptnlfetas)a2raxrpno0aetnio3iat m2rm(vs;t0 lxrir to1lmtr ivs (0sexrxm3iydale livs (  2rmx  ;o4oexomi3iadlaDel(vp;(4trxrmfcoatfaD  ieo;s0seuoxm3nydopenmnesat aDtrurpot0tpt mo3iadlaDeauvon(4tetnmo3iotfpD ai s;t s2uo(m iydoltelfes ()a2tax pot1tlxn fctaslaDelumont) exrmfcoy1fm  aieils  2xmxm3oudol emivilt)srra(mp;o0tltniiciltfmDrlumpn(4 rtoxo iodfpD  u o;s s2xr(m iodop e nvsa( a2raurooo4tee miciydls rauvs;u0alerifctodlaD lueil(0 rtrxo3ny4opt mictl()s2tm(mpou1alt mi3ilslsDulu s;u4arenifciotoa r nvo t)trtoiopnydop   nvs tfa2tmxmpnu1tpen octydfa2eau p u4 reniociydoaDeauei;t)sexrxmpnu1oleemicil( artru ont1oetn o3iltla rmumo (4 eerxr io1lmDeli i;s t2xmxo oy4al  lnesasfsrta(mpou0apt mfeildla2elnmo;t0trtoxfcoydoaDe ueo t teum(o ny1lmee iei tfarrmum ;o1apeomiciydlm2ulnvo t)texomo iatopteanvs s t2toio no4omeelivs s) rurxrono4oetnmf3tatlm2ulums ()tltnmrctytoptelneo;(  etmxr no1om  miei s aDra(mp;u4tlt ii3iadlaDemumo;u4tlxrmf iytop rai o () rxriopio4omt lfvt ( srumu ont1apenmietydlaDulnvs (4 eermo todoa rauvo;t) 2tmir3iy4olt lfeiasfa2ua(rooo4tpto ietlt sDrluvpnu0aetnxr oytopt lueils)s2umio iy4lmenlfet t srtmxm ou1tlenmociadla2eanvo (4teeomoctodlmD livo (  2xoirpoudlmtelfct s) Dtrx ono4optnmfctysfmDrauvo t4tetnmfciydomtr i o s tetoiopnudoltnlnvilt sDuax  nu1texnmoctld mDuau p;(0 rtoxr3todopD ai s t t2xriopnudapen ncslt)aDumumoot0apxn f3ildfmDua(mont0tetoiociotopDrai s;s0tetrxo3ny1llt lfci s)s2ta(rono4oltnmieiltla2rmn s;u4tltomoctotlmDelnvi t srxoxm3oy4omenmfvi ()artau ont4alxomoeiat a2ul(von(0aexoxfciytlp rluei t0sruo(o nodolenmfct s a2raumpou4tltomf3tydfaDel(ms;() rxnmocoatfmt aneil( tetoim3iudal nmfviltfs2rrx  oo4olt mfetas a um( pnu0 rtrmrciy1latr n ols)teuoxm iydlptnmivsasf 2trxmooo4alt ioeilsfm2uanvs;u)trenmo3iodopte i i ( tetrxr iy1lpee ivsl(fsrrm(mo;t0opt mf3ilslsDem(mp;t0aeeomf3iotopt  ivs;t0srumxopoodlme mfeil()aDurxr ;o4tlxnmf3ildla2el( p (0treomocoodoa  lu il() exo(r nydlpenlnesa( aDrmx poo0alx mfeiat m2rau snt4 leomf3to1lateanvo;s  rumir3iy1op nmicta( arur(  no4alt moctys a ean p t0alxnxf3to1faD lueilt) etrxm nu1lpeemneta(fa2raumo;o0texo ietlt aDrlnms;t0altnmf ia1fpDeauvo;s) 2urxr3io4lp nmics s  Dtru  ;t0oeen fcilslmDrmumo u4 lxoif oo1oaD aueo;t0s2to(o3nudal nlnvi t aDururoou0aetnmictyd s2eln o;t) exnmo ia1fa r ueolt)setm(mpnu4omeemfctat)a2urxrp;u0aex ifciydfm2ran s;u4alerxo tatfm e i o s0teto(r oy4ll  lict sf Dtau ont1tex mo3iatfm2rau pn(0trtnir3tadlp  aueols0 etrxm3iydlpeemieslt s2ra(r nt1opeo ieilt sDra( o u4tetomf3oodlpDeauvo t0tetrio3ny1alt mfcia( s2tmu p;o0tpt  feiydfs rlu s t4trtrxo3iatoaDean o;t)s2xm(r3oodap emncia()srua(rono4apxn fetldlm2rlums (4trxnxrcoodomD lu ols teum(rpiodop  lfeils)aDtaxrpot4olxo fctls s ranmp;u4arermr totomDrlnei t)seuo(r iy4ol emfctasfs2rr(m no0tptniieiad m ranmp (4aetrio3tatfa elnvo;t texmxo no1altemfvta(faDtmxr nt4ale  fciad aDeln s;(4aexoir ia1oat lnes;(0 rtrxmpou4lpe lietasf 2umu  nu1aeenifctlslmDea(ms u0 ltrio3iydoa rlneols)s2ur(rpio1lm  lietltfsDumurp;t0tptnmoeiysla2ra( p t0 lxrxr3oadlmDr nvi s)trtm(r3ou1ll nlicsa(fsrra(rp;o1aex  f3iyt a rlu snt)tlenxr ia1oa  aivslt0 2xoxo ou1lpt lnvs t s2trump;u0optomoctytfs2rm(ms u4teenxrctadfa ran ol( tetoir iu1olte nvi s aDraxr nu4alx mociadfaDra(mp (0tltoxocia1optelnvi;(0teto(m oy1ll emivs () rtaumpot4oetnmictlslm2rau o t0trtoxr3iadlm  lu i;s0 euo(rpnydop  mneta( arur(m oo0aeeoiiciad sDrm(mo t) leoif oadfpDe u s;s0t2ur(mpnodlmtn ivs sfsDtr(r nu1texn ietydla2rlnvo;u4arxomf3iy1faDrlu s;s)trxmimpiu4lptelnvi t  rrm( pnt4tltomoetas m ulu ont)trenxo3ia1fp e uvs t0 ruoio3ny1lpt  fcslsfs2uauronu1tet mocilt mDea(vo;t4 lenxo3iatfa elneilt s2tmxo3oy4op nmieia() 2tmxmpnt0tlxniocias a2rl(vp;t0 rerxfcoydfm eaues s)s2xmxm3ou1ame lnctlt a2rrx o;o0apto o3tadfsDumnmpnu4trxomociatomt liesls) 2xrir3io4op elivsat sDtaurpou1apx  fctas sDrluvsn(4 eerir3tadlmt  nvi;t)t2xrxm iu4al   ncsa(  rumx  ;t4teto oetys s ranvpnu)trtoxoctatfa eluvilt)sexmirpiudoltnmfvias aDuax  no1alxomo3tyslm2uln s () eenxr3todlpDraivs t)trtrir3ou1lp nlics () 2rr(root4oee mociys sDrlnvont4aleoxfciadoate u sls  rxoxopny1ope mivilsfarta(mp;o1aeeomictlsls el( s;u)aeeriociadlmDr n o;t0 etm(o3iy1lmt micils  Dta(  ot1aptomictas aDul(vs;u4tlxnxo3oadfaDe u i;t)s2trxm oy4opee iciltfsrtaurpoo1altn fctltfaDran pnu)texrmr3tatoaD an i;s)setmxrpiydlmen nci s s2ua( pno4optn i3ias sDrl(mp (0aeenmr3oo1la r nvsl( t2xmxm3oodaptnlivt ( sDtaurono1tlxnmictat sDrm(vs;u)alxnmo3iytlmDeaueolt0 2uoxmpiudlm n fcs (f rtaxmp;o1apx ii3iltls uanmo;(4tltnifciodfpDr uvi;s) etrimpnydlme  iei t)srra(mpnt1altomo3iatfm2rlu snt)areoxf iy1lpte uvi;(0 2tmiopiudlptnlfvsl()sDrm(  ;t4altnioeiyslsDuanvo;t4tltrxr3io1om ranei s  eurxr nu4lp  lfviatfaDtm(mooo1aetnmietls m ua( p (0 ltoifcoytomD ln o;s) 2xrim ou4omeemfet s) 2tr( o;t0oetniociatfaDelu pnt4 ltniocoytfp rlu sl() rxmimpio4optn neil(  rtrx pou0aeeomf3iatls2emu snu4teenmf iotlaDraueo t  rxoxm3iy4lm  livi t)a2ta( pot4tetnmfciatlsDumn s t0aeenir tadfpD lies ()s2tmxo oudop emfesa()sDra(rpou0oeeoifciysfm umn p t0 lxnio3to1fmt an o ( texm(m3nu1ol emivil()a2tr(r ou4tee iieiysfmDel( pnu0trtoir tadomD  n s t trxoim oodlptelivtls)s2rmxrono0tex  i3tydla uau o;u0 ltnirciytlm raies;s0s2toiopiydlmenlfetlt)sDtm(  no1oltnmoctysfs rln s (4arermr3oo1opDeln o ()t2ur(o3ou1lm e fet () Dtru pnt1tlx  ictasla2eanmsnu0aleomr iodlptrlneo;(  rto(rpoydam nmiciatf Dtau  oo1opeo ocilsfs emuvont0 etoxfciytlmDelu o;(0s2um(r ny4altnlncil(farraur ;t0teenifctatla elnvp;u4 reoif3todlpDraneo t  rxoio3iudaptn ieta(  2tau  nt0oleoifeiyslsDumu s;()aexoxrciydoa  ai s ( seum(o3iy1ap  miesl()srtm(m ;u0altomiciasfs2umnvp;u0 ltoif3io1lptrai ols srxoxm3nu1ll nlfvi t s2rrum ou4alxo o3ildls uaums;t4aeeoif3iodfa ean i;(0s2to(o iydamteliesls sDrr(r ;o4apenmocilt m2ra(vsnu)tlenirctatlaDr nvs t)teto(m3oy1lle mfet sfarum(rp;u0tpt ii3iyslm2elumonu4trtnio tatop e ueo;s)t2toim3oydam nlnvilsfs2uru o;t0aee  i3iat aDumu p (0 exrmfctytoa e uvilt)setrio3iodam   nct t  2ra(rpno0oltnmociadfsDuanvp t)arenxo to1la eaneilt0seur(r3oo4olt  fetl( aDururpot4opeo o3iatfm2ea(vonu4arxrmr io1fpD ln s s0 2to(opnudalt lictas)s2tmu pno4tlxo ociys a umumont) reoir oydoat lueolt) 2toxo3nydoltelfvta() 2rr(  ot4altnifetldfa2em(vp t) rermr3iatfm  aivi s0 rurxopiy4om  lnes (f rrmxmo;t4tex  ieiyt m umuvs;t4trxomf oadomDraies;s0 2tr(r oodlm elicsat)srrmxmpnt1tptn ocilt m ulumo;(4 leoif3iy1faD aueils)trtrxm3nu1ol  mivi (fs2ur(r nu4aptn oeiyt m2ea( s;u0trxnmr3iotoptr nes (0sruoxr oy4am elnciasfsDrmxro;u4tlxoio3iytls2el(ms u4arermocoatfm eanvs t sexoim3nudllt mfesltfa2uaum ;o4aexo i3iydls2em(ms;t) etnmociydomDelu slt setrir3io1ll   fcslt)srrrxrp;o4olxo f3ilslm el( p;t4 exoif3ia1laDe uvo;t srum(r oo4lp nmnvsltfsrum(mo;o0opeoifeiat a ranvpn(0 leoxr3oy1op  lieo s0sruo(r oydapt mfcs tfsDrrx pot4tle  ietld sDel( p;u)tltrmo3oytlm e nes s s2tr(o3oydlme mncta(f rrr( p;t1open icildfm2eanvp u)aeermf ia1laDe ieols)s2uoxm iudlpe  iesa()s2urumoou0optniieiysfm2umn s;(4 leoxocootla e ivolt  2tm(r3io4open ivtl()s2ta(rpoo4openii3iytfa2ua(vsnt4tlermo3iydomDeln ilt0truo(opoy4ol   ivta( arrrumpoo1tlx moeiyd s2uan o u0aeerxr3iytlm r u o (  rxr(o3oydomenmict ()artrx p;t4apen o3iys s umumo;t4aexomr iotlpteai olt0 rxrxrpiudam n nvilt  Drm(mo;o1alt mfctydls2ranmo (0teeomr3tytlpteau s;(0srxo(opoudamee ivi s)a2uru ono4aptn iciytlm elnms;u4 rxoirciy1lptr ivil(  2tmxo3io4al  mncsas sDumu  nu0aptomfetysfaDemn s t0alxrmrciodfpD li i;(0trumiopiu1om   icsatfarrmu  ;t1apx mi3tys aDrauvo (4aeenif3oo1lmt aneo;(0sexo(mpiodom  mies t) 2ta(moou0alt mfeiytla eluvs;t)trtnir3oytfmD lu s;(0sexoxmpiy1omt lncil( arurxrp;u0opxoiieiydfsDrl(vs;u)tlxrio oydlmtrlieo;t0 2toir iodlptn fctat artr( o;o4tpeomo3iaslm2rm(vp;t)arenmfcoy1lat livo;s0s2um(r3iodom nlfeil( sDtaxrpot1open i3ilsfm2eanvp t)trtoxo3oydomD livsls)t2xoimpnu4lmeemicsas)aDrm( p;t4apenioeiasfm ulnmsn(4alenxr3iadfa eauei s)s2toxr nu1omt livi (f Dtmxrooo1apx  feild s2rm( s u)tlxriocta1fm rauvols0t2toio nu4am e ivsa( arta( pou0opx ii3ilslaDeluvpnu0 lerxf oatlp  anes;t0 etm(opio4ap nmfvtl()a2ur(m ou0aexoif3iyt a rluvsnu4arenxf3oadfaDelivi;t) exmiopou1altn iesasf rrmumpno4tpe  o3iysfa2umnms;u4trtoxf tatfa eaneo ( setoio3ny4amtnmfvtls) 2rrurp;t0texnifeiydfm2emums (4trermocia1fp eauvs t0trxo(opou1alt mfesl()sDrr(rpnu4apxomfetadfa eanvo t0 lenxoctytoa eai olt seumxo ny1ome  icsatf rtr(  ot1altnio3tlt a2uaumsnu) lxoir iotoatr iei;s0 2trxmpnu1optnlneils)srur( o;o1aet mfcils mDua(vsnu4tltoxf iy1op r ues;s trtoxr3ny4olt mfet s)a2ra( p;t0teto o3tad aDeauvont4altnmr3oadlmt livi;(0s2xrxr nydlm n ncia( aDraxro;o0tlenmfeild m2umnvo;(0aetrxr ootfm e i i;s) 2xmxr3no4om  licslt s2umurp;u1apt mieilt mDua(ms t0aeenxf3io1late uei s0s2tm(r3nu1lmtnmfeslt  Dtax  ;u1oltniieiasfmDrl(vont0arxnxf3ta1oaDrlnvs ( srxrxrpoudll e iei (  2uax p;o4teeo fcias s2raumsn()tetrmfctydla r uei t srtm(o nu1amenmfeilt) 2rm(mo;o1aee if3tytlmDrln s u0arerif3oodopte i ils0sexr(rpno4lmtnlnesa(farrr( onu0tltoiietldlaDrm(vpnu4alermf3iatfptraivo;s0t2xr(o3iu4optelictls  Drrx  no1opxnmo3ilt aDul( s;u0tetnmo oadomDraivo;t)t2xrir3no1alte feslsfaDumx oot0alxn iciat aDel(monu0artnmf3ty1fmD an o ()seuoxr3ou4am   fctas)s2rmum ;o0tltoii3iad aDeaump u)teerif3tydlpDe ieo;t) 2xm(m3iu4lptelnvi tf 2rrumoou4tltn i3tatla2emu p;(4 lxrmo tytfa rlnvi;t)texoir3no1llen fct ( aDrmxr ;o1tee  ocilt m2raums (4altrxr3totop ean ol(0srxrimpiy1ome lnei tfsDrrxro;u4apxn ieiyt mDemuvo;t0tlxrxr3oy1fpDrlneols0t2xrimpoy4ll nmnes sfa2urxmono0oltniieildls rln on(4altnxrctodfaDe ueilt) 2um(m3iy1al  lnciatfaruauro;u1tlxomo3ias a ul( s;t4trtrifcoytomDe ieils0s2xo(opiu1olt lncsa(  2raump;u1olt  fctytfs2em(vonu4 lenif3oytfm elnvs;t) ruoirpnu4aptn iciat)aDumxmpoo4tlto o3iatfaDelu snu) eenio oadlatrlieo;t)seumimpou4amtnmiesat) rtm(  ot1ole  o3tltls2ua(mp;t0trxomocta1fmDr n o s s2trirpiu4lpte ictas)srtaumpot1oetoioctyd aDrmu on()aexnif oadopDr ues (0 2xrir3ou1om nmnesat sDta(mpoo0teeoii3tys s uanmp;(4tltrir oy1la ranei t)srtmimpio1lmtn ivta() rua(mpnu0aexoifcils m2umnvpnu0tltoifciotop rlnvo t t2tmxr io4lmt  fci sf 2um( onu1ole moeiadfs rm( p;u0arermr iodoptr ivi t  rtr(mpno1ape lies tfa2uauroot4optomi3tytfs uanmo () etnxrcta1lp raiei;( trtoim oydop e nctls  Dum(roou0tptnmfciatfaDemump;u) reoxf3iytlmDrliei;(0t2xrir3io4optemfvsatfaruau poo4oex ii3iydls2eanvs ()texnir iydlpDrli sls) rxmxmpnydlmtn nei (fs2ur(  ;t0tetnmf3iytfm rm(vo (4 lxoxo ty1fptrlneo;s)s2tm(r3ny1lmt miesl(fs2umur ;u0tpto ociyslsDemnvsnt) ltrxo3oytfa eaiesl( seurir3iy4ol emncia( aDum(ro;u0tet miciyd s2eauvo () rxnmr3ootop r i ols0 2xrim iu1op   ictasf 2raumpou1tet ifetydla2rl(vo;(4alxnmrcoa1laDr n s;(0trto(mpiy4al   icsasfa2um(m ot0oee  fciasla rm( on(0alenxr3totopDe ieils0t2umir ny1ap nmictl(fs2rrumpno1aeen feiltfm elumsnt) etrif3oa1oaDr nvsls)trtoiopoy4ome lneia(f rrmurp;o4opeo ociysfmDrlnmp;(0 rtomr3io1lmtr uei;(0 etoir no1omen fci s) 2umur no4apto i3ias sDran s;u0 leomociodfp eanvi ()s2to(rpnu1optelictl(f rtmxr ;u4tltnmiciyslsDea(ms;t4 eeomo3tatlaDeluvolt0 exoio3io1altelivs tf 2tmurooo4alxnif3iys s ranmo;(4 ltnxf oo1lm rauvslt0 2trxmpiudale mnvsat) 2tau o;u0oleo ieiytfm um( on(0 ltrmf3oydoatelu i;(0srxmim no4ll  livtls)arrr(r ot4openmoeildfa elnvo;u4aeeomo3iotfat anei;t0 exm(mpny1lme mivsasfaDurum ;o1aeen i3tldfa2umuvs;(4tlxnxo ta1oaD  ivs;t)seuoiopnydaltemieta( arur( pot1oet mfeiat aDemnvsn(4trxnmf3io1fa eaneo t0 exmxmpiodlpen neils srururp;o4alx  i3iasfm2ranvo;(0 eenxf oodlp  aneilt trtmir3oydll  livtl(fsrrmu o;t0alxn o3tat s2em( o;t0alxrxo3oytoat  nvo;(0 etrxm3oo1ap  mivsls)arrmum ;u0aet  ieildfsDumnms u) ltnmr3oydfmte u il(0 2trimpnydop nlncil( a2urum nt4teeniociyd a rlu onu0 ltomf ootlp   n s;(0t2xoir nydlmt  fcsl()a2tmu  ;t0tetn fciadls emnmp;()teenif tytlmt lues;()t2umio3ou4ap nmicia( s2rr(m ou0tlxomictltlm eau p t0arenmr todomteln ilt  exoir ny1lpe  fet s  Drm( pou4oexniicilsfs uau o;t0teerir tytlpD anvilt)t2xmxr nudal  lfct s a2rru ont0oltnmi3iyslmDumums;t0aexnmr3oytomDr uvolt srxmxo3iu4ameelieiasf Drrx oou0opxomo3iat mDea(vs u4 etrio totoptr ivil(  2toir oudamenmivt t)s2rmum nu4aex  feiytfm eaumont) ltoxr ta1lm rlu olt0 2umim iudale  ivt tf 2rmx  ou1oetniictld sDemnvs u) rxrif tatfa eaueilt trxoxm nydale  iesl()aDtm( ont1oee ioetlsla2umnms u0 ltomo3iy1lmDr n s;s0t2tm(o oy4openliet sfsDrrxronu1oltn ieiasfaDeln p (0 etomfcoo1fmDeli o;t0 2xrir oo4apee neiatfaDtmxmo;o1aetnmietysfaDuluvpn() rtnmf to1lmteaiei;()seuoxr3oo1ol e fet (  2um( pnu0opxo ieild a2ra(ms;t0aexoirciytoat auvi;( s2trim3no4lmtelieslt arrrurp;t0oeen fetys m uanmsn(4artoxr3io1lpte uvo;s) rxoxm3nodll  mfvsl()artru o;u0apxo ieils mDraumon(0alenmoctatfpt  ieils trtoxr iudapenlfeil(  rtrxro;t1opt if3tltfaDuluvp;t0trtrmoctydfatrli sls0s2urimpoy4ape  fetat)aDraxmpoo4oet ii3ild sDea(vp t)aeerxrcoodop  luvi ( t2toim3iu4alt mfvtlsfaDumx pnt0olx mfctyd mDrlu o t4tltoio3tytoatrai o;s) exmxr iy1alen fci t  2ta(ro;o0apeomoeiad m2rmumsnt4aleoxfcta1omDeaieils)sexrimpoy1apt lfvi t arur(mpno0tlxomictas m rmn o t0 lxrxr iodfpt lneils)trtrxrpiy4optemnvtlsfsDrm( p;t1tet  f3tadlsDumuvont) rtnmo3iotoatrauvs t0t2tm(o3nodlpt  iviasfartrurpnt1tlx  fctltfs2elnmo t4altrxr ta1la  au o (0srto(rpiy4olt  ncs t srur(mpno4tpx  o3iytfm2ulnvo (0 rerircoodlaD au i;(0tetmiopnydlm e iciatfs2tmxroot0apxo ieiysfs2eln o t0treoif oatfmt  uvi;(0srurimpiy1lp e ietas)arraxmpoo4alxo fciat s um(mp;u)tetnmo3tytlmt ai ils0 etrimpny1amtemnvi (f 2trxm ;o0aet  feiyd a em(von(0aeenmo3oy1lptrlneilt  rxo(m3iodopee fvt t  rta(roou4aeenmociys a2elump;t4texrifcoo1lpt aivi;t) 2um(rpny1am emict sfsDrm(r nt0alxomi3tasls2ra(vs;(4 etnmrcoodfaD  nvil(0trumxr no4ole lnvsl( aDurx pot0olxoifeiad s2uan o;u)arerif ty1omDrlnvilt0 eur(r oo1alt licsl()s2uau o;o1oexnmfetys sDumnmpnu0trxnio oy1lat aues t sruoio3io4omeelnetl( srumurp;u1opx  fciltls ra( p t4trtomo3iatla e nes s trxrxm oy4lpt mnvslt sDuru ont4tleomoeiydlm2emn s;()altnircoa1fptr u i;s s2uoxo3iy1lmte iei s  Dtrxr nu0texomfciysla2emnvpnu) rtomo oatfmte nesl()trxmxo3iodll nlnct sfarta(  ou1texn octlsfmDul( s t)trtnmfcoodfmDe neo ( sruo(opiydopte ivtlsf Durx o;o0apxnmo3iatlm2emuvs t4altrmf oo1fatrli ils) rxo(o3nydop  lnctls arurumonu4tlxnifctadlm umuvs u0tltnmr3iytlptr n s s0trxoim iy1omtn icil()sDraumpnt0ole ifeiytfs2eluvont4teenmociytopte u ils0s2umxm3iu1lpee fvsatf rum( p;u1oexomfctyd a2uanvpnu4 exrxociatlatr neo s t2xm(o3iy1lp e fes s  2um(  nt1aetoioeiyd m emuvo;(4aexrxoctadlp   i olt s2urir oo1lmtelies ( aDtrxro;t0texomf3ilt mDrlnvo u)arxrxo todlpt an i;s srtriopoodap   icsls)a2rmx  ;t4aptomi3tyd mDemnvonu)tetomo to1fatr ueo;( s2uoio3iy4amtnliet sf Dumxmooo4aeeoifciasla2umnmp;t0 exrmo iytlmDrauvi s s2umxr iu4apenlfeiasfarur(rpou0aexnif3tad aDuanvp;u0teerxociodoatr ieil()s2umxm nu4llee fesa()srrmum ;t4tptnmfciltlm elnms;t0 exnxf ia1lp elneo;s texr(opnydlp emfvsa()srururpno4oexo oetysla2uanvo u)aexnxocoytlm   uei;(0 exmio3oudlpenmnctas) 2ua( p;t1oleniieiydfs2ua( ont4artrifcty1fm r n i s0 2xrxm oy1ame lfvsl(f 2tmu onu4tle ifciys m2ra(mp;t0 ltomr3ta1fmtrlnei t0sexoimpoy1ole lnvtatf rrr(moot0oltnmf3iatfmDulu p;(4texoio3iodfp e uesl(0 rum(m3oudamt mfcsl(fsDrrurpoo1optn o3tyslaDuauvs;u0 etomr oatlmDeaivo;(  rxr(r3oy1llt lfcsat  rrm( oou4oex  f3tasfaDemumpnu) exomo3todla ran o;()s2xo(opiu1olen netltfaDtrum nu0optn i3iys sDul(vpnt)tlxoxf oo1lmDean ilt) 2urxm io1omtn fctls)arraxm nt4opto oeiydls2ra( s ()aexnxr3iotfa raneo;s0 rtmim iu1ap nlneta()a2uaxmpot0tpt  oeiasla el(msn()altoxocia1lmtr ivo;s  etm(r3io4llt mfcia(  Dtr(r oo1tptoif3ias aDrmumsnt0 ltnmrciotfa  lueil()trxrim3iy4ol nmnvilt  2ta( oot1oleoii3ildlsDeanmp;(0 lerxr3tydfa raneo;t)texm(mpnudlme mnetat) 2tm(moot4oetomo3iytfm rm( o u)treomocoytfm   uesls)texoim iodlmeelicslt  2tm( pnu1tpt  ieils a2umuvs u4treoio iotlmDr n o (0sexm(opoudolenmics s aDraur no1ale mo3ildlm uau onu0 leoif oodom eauvol()t2xm(opnydamt mfvs tfsrrmxm oo1aptn f3tld m ulu o t0texoif3oy1laDeluesls trtoio ou4ole lncs s  Dtrum nt0optnmfctlsfmDea(ms;u) etnir tadoa r i o t) eumio oo4ll nmnctat) Dum(mpnu4tetnmi3iltlm2el(mp;(4tlxnxf3iy1omDeli o;t) 2toxopio1ll  mfci t  Dumxr nu4tetn ociatfsDumu sn() rxoio ta1fmD luei () euoio iu4amenlics t  2tr(mooo1oexo fctls a2uau p;u0tlerxfctatfpteli s;(0 ruo(o3nudll emneil(f Durxroot1apxoiociyd a2em(msnu)aexnircio1oaD anvolt setmxr iy1omtnlfcta()sDuaump;o1opt  ieiydlaDuan o u4tltoifcoatomDe ueils0s2um(opnydlptemnesls aDrmumono1olx ifctls a2emuvp t)teermo3tydop   i i t)t2tmxrpno4am e feta()aDrmxm ;t4apt iieiasfsDul(vs;t)arxrmrcoydlpt  i ols)seuo(m nu1opte ieslt)aDuru pou0olxnmf3ild a2ra(vsn(0tetriociotfmDelnvi;t0srtr(r3iudame livi tf Dumxr ot0opxnii3iys m umuvp;t) etrif oy1lat aneo s)teuo(rpio1apenmnvs ( sDrmur no0olxnioctld a ua(mo (4tleoif3oodopDe nes;s)srxo(rpio1amt  fcta( arrrxrp;t0teeoiociys mDran p t0treoxrciydomD  ivols) 2xrirpoy1om nmncsltf rrmxr nt1aleoioctlsfa rlnmp;(0 lerio ia1fa e ues;t)texm(r nydale  nct (farrrumo;o4teto ietyd a2rlu o ()altoxfcoytfmDeaivs;s t2umxmpny1lle mieil(f rrmu oot0apx  f3iadfsDrl(ms;(4teenmr3ta1lmt auvil( s2xo(mpnydap nmivsltf Durur ;u0tlt iieiyslaDrmnvp;t0trxnif3oy1omte ueols  rxrim nu1lm elivtlt sDraxrpnu1ape  oeiyt a2ranvs;t) eeoir todfaDrau sl( tetoim nodllt  fetas)s2rr(rpnt1olx moeilsls2rl(vp u) eenxr totfa e uvslt0 rxr(rpiodom n ivtas aDta(rp;o0opt miciyd a ua(vo u0aexnxo3tatoa eln s;t0 rur(rpnudolt  nciat)aDtrxrpno4altnifciys sDua(mpn(4alxnif3oytfpDr nvi (0tetmimpio4apt mneia() rtau p;o4tltomf3iatla ra(vo;()arxnmrcoydfa e n i () rur(mpnu4openlfvsat aDtr(rp;t1oetnifciad s umnvs t0 ltrmf3iodfm e ivol()seumim nodope miciltf 2tauro;u1tpx mieiydfa ea(vp () rtrifcty1op e neo (0 etrio nydap nlncsatfsrrau  ;o1tpenmo3iatfa2rauvp;t) exrmrciatoaDraivol(0tetoxopno4omenlfetasfaDtrumono0opt if3tltla ranvo u4artnxo3oydlp rliesl()texoimpiudomtn fcsas)a2rr( pot0tet  o3ils sDea(vp;(4aeerxf iadlmDeluvo;t) etrir3nydomtn fvsasf Dumu  nu4oetniiciysfm eanmo;(4trxoir oatla  livsls srxo(o3oydam emfvsls  rtaxmp;u4oex  fciasfmDean o;u) ltrircia1fmtelivs;t teur(r iu4omeelivs (f 2rau ono1ope iictldfm2ra( o ()artnioctydlatr ues;(0 euo(m3oodamenmiesasf Dtmx  ou0apeomf3tas a2ua(mo;u4teeoir3oytfatr u o s0 exr(r3oo4lpenlfcs (  Dra(mono1ale ii3iat aDumuvo;u)tlxrifcio1lp  anes;(0 rtr(o ou4lpen iet tfsrtr(rpnt1tlxoioctadlm2eln o t0 rermfcootlm elivsls t2xoxmpoudomeemiciat)aDtmxm nu4aetn fciytfs2eln o t0 eerxr3iydoaD lnvolt0t2toirpiu1lpe mnvil()aDururp;t0texnmociad aDra( p () eerif oytom raivi;t)tetmxm3oo1am emncsa()srrm(ro;u1apxoii3iysfs umn snt)altrxf oadlpD aues t trxm(m oodll   iciat)a2rr(rp;o1oex mieiyt s eau p (4tlenir3oydomtrlu ils)srur(m ou1lme mfctl(  Drru ooo4tpe miciyt mDuan s t0 reriociytomt li i;t0 2tmiopiu4lp elnci t aDtau  nu1tlen fetldfsDemn s t0aeerxo oo1fm ran il( trxm(o no4am nlfviat  ruru pot0alxn oeiyd sDrm(vs u)texnio todfmDeauvo;t)s2uoxo iy1lmte iei ()artr(rpno1olx mfciadlm2elnmp t)teeoxf tytfp ranvolt)s2uo(o3iy1alen ivs tf Drr(r nu1tpt  fciatla2em( p t4aexoif3oadlmtrau ils srxrxo iy4lltnmivsl() Drrxr ;u1texn fetytlm2umump;t) eeoxf3totfpt anvsls) rto(m oudoptn nvtas)a2truronu1optn ociatfm2ean o u) lxomr oa1opteanes;t)srtm(o nodoptnlnciatfarrmu onu1apt iiciytfm2umuvs u)alxoxr oy1oa rauvi ( t2uo(mpiu1ll   iciat a2urumoou4olen f3iysfsDrmump;(4aleoxo ta1lpD liei;t0seur(rpiudal n ivt ()srrr(rpno0apenmoctyd a2uaumon(4treomocto1fm  livo s) 2toxmpiu1opee fvslt) Dumxrooo4ale io3tad a ua(mo (4altnir iy1om  ai o (0s2xo(o oy1ame mnvilt)srrmu pno1aexn iciadlm2uanvo;(0 rerxocoodfaDeauesls0seumxopnydam nlnvsat  Duru  ;t0tleoii3iadlm2rluvpn(4alerxf3tadfptelnvs s) rumio3oudam elfetasfa2uax ooo4olx io3tlsfmDrmuvs ()teeoifciytoatrauvi;(0 2trir3ou4omte iesl( sDrmu ono0opx mfciasfa el(vs t4aexrxf3iodfmDeai o;t) rurimpio1lmtn ivsasfaDua(rpnt4texomoetadfs2emumo ()aetrxr ta1opDr u i t0 rur(opiy4lm e ietas) Dumu pnu0oltomo3iytfa2el(mo;t4tltrxo oytlpDean o;s  rumirpnu1apeemfcias) rrmxmoot4oee  icilt a2ul(mo () rxomr3iytoaDean s (0srumxo3nydllt livsl(f rtr(ro;o0tpxnmi3tyd s uanvpnt) rtrxfciodoaD ai i;t)s2uo(opno4amt lnct (fa2taxmpnt4tltniiciydfsDem( o u0trxrmr iatom  auvi s0seumxrpnu1ap elivsa()aDtmxrpnt0aleniicilslm2emnms;t)arxnxo iydomt aiei t0t2xmxm3nu4open nvsas arrm(mpou4aeenifcild s eanmp u4aeenxfcoa1op e uvs t)s2xm(m oo1ap n ivsatfsrtmu p;t0aeenii3tat a el(mpnt)trxomf3oydla eai o t)t2xrxmpiodllte ncsl(fs2rrur nu0aee moeiasfm2rm(mont0tlerir tatlaDr ivs;s) eum(mpoy4optnmnet (  Dtm(m oo4oeenmfeiasfa2ul(mp t4alxrmrcoa1la e nvs;t)truoxmpoy1optelncsl(  2taumoou0tle  fctlsls ra( sn()tlxoio ia1lpDeau ols  etrxm io1omtnmieiasf 2rrumpnu0tpxo fcilt a2el( o t) rtrmf to1lm  aiei s t2trxmpnu4amt  net sfsDtrum oo1tex  iciytlsDeln s;t0aleoxf3oo1op eauesl(0t2xr(o ny1aleemncsat) Drr( o;u0olxnmieiaslsDel(msnu0aexomrcoytfp rln o t)s2umiopou4llen fvs (fs2tmxmpoo0alxomiciytfm2elump;u)alxrmf3oodfp r uvi;t)s2xm(m3no4llte ivsa(fsrrr( ono4aeeomi3iyt m um(vo t4tetrif3tytlp rli o ( sexrimpoo4ll e iviltf rtrx p;o4tetn oeiysfs el(monu4 lxomocta1fm elnvilt0s2trir nydlme mnesl(fsDum( o;u4oltomi3iad a2uanvo u0trtoxf ootop  lu sls) rtr(o ou4aptelivsa(  rumx pnt4aetn ieiasfaDeln pn()aeenxr3tadoaDrli ils0 rtr(m3oo1olte nvia( srtm(m ;u1tlenmieiydls2el( o;(0trtrxo iadlpt  ivi (0t2ur(rpio4aptn fvs t s2tmur ;u0altn fciyd sDrm(vs (0aleomo to1fa elneilt0trxrxo3iydaltnmnvi (fa2rr( pot4aexo ieiydlmDuan p (0 lxoxo ootopDr n i t) rur(m iodap emnes tfsDur(  no1tpxnioetytfm2eauvont0 lxnxf ia1fp eauvo;s) 2uoiopio4olte nesl() 2rru o;u4tle ii3ilslm rlumonu0tltnxo3ootlaDe n o ( t2xrir oy4lleelivslsfsDua(ront4tlenifeils sDeln s;u4arxrmrciotop rlivols0s2to(mpny4ol e nctas)s2ra(rp;o4opto f3iys s elump;t) lenxf oydoatrln o ( t2xo(r3iudlmeemfctasfa2um(rooo1oexoio3ilsfm2ea(vs;() rxnxo3io1latr i o;( setoxo iy1lpe lfvsa(fsrtrxr oo1teenmfciasfaDeanmo t0tltrio todlpDe ueslt0srto(r ny4oltelfviatfsrurur nu1optnioeiytfa um(vp t4texrxf tatopteai o s seuoxr3nudopt lnesat)srumu  oo0oex  oeiatlm rau o t)aetrxocoodoaDelues;t)srumir io4ole livi s) Drruro;o1aetnifeiaslm elnms;() reomoctodlpDr i ilt  etmxr3ou4lltn icsat)sDrru  ;t4apxn octlsla2eaump (4 exrxr ty1fa e ies;s  etm(r no1ap e neilsfsDra(  oo4aet  o3tys mDel(vs;(4 rtnmr3tadlmt lu o;t0texo(r nodom  lnvil(f Dra( pnu4opxo fciatfaDemuvs u)teenio3ty1om  lu o t0trxoxr oy1am  mnciltfs2rr(rpnt4aexomo3ilslmDrlnvp;t) leoifcoatlat  ieil(0t2xo(o iodlmee nesl(fa2raum ;u0altn i3tls s emumont) exnifcio1laD aueolt) 2xmxr3ou1amee nvs s aDtmu  ;t0ole iieiys mDum( sn(4altomr3iodom rlies;t sexm(o3ny4lpe  nei t aDtmum ot0apxnmfetlsfa2ra(vo;u0alxrmo3totlptr nes;(  2xo(mpoy1alt mnciat)arrr(m ot1altomicilt aDrlnvp t)artrxfcio1fptr u ols)teumir ou1lpenlict (faDrmx  nt4tpe iictasls umnmp u) lxrif oytfat an i ()t2tmxrpnydope  ncs (  Dtm(mpot1aeeniocils s ulnmp u0arxnxf3tadfa e uei;(0t2xm(m iu1omtelies (fs2trxmp;o1aexo iciyslm2ul( ont0 eerxo3oatfmDrluesls  rxoxmpoy4lpee fct s) Dur( oou4tptoiietldla2eaumpnu4trxnio3iydfpt  nvils0 rxmim nudaltnmnei tfaDtrumonu0tle  fcilt a elumsnu0trxnxf3oytfatrli s;s)t2xmir3iu4ap n ieta( a2trxrono0aeto feiad s ul( on(4altnmf oytfmDean o s)trtmxr io1om e icsasfsDurx pou1aetoioeias a ua(mp u0arxoif io1oaD  ivo;s)tetr(mpio4ol e fes () rumumpoo0oetn ieiatfm rl(vo;u0tltrir3iydlpt auvi t)srxoxr oy1lle mfvtas  2uaum ot4texn oeiytfm um(mo;(4aeenif iytop r nvi;( trxmim3oy1ol n fes t)srrru pnt1oexo fctls a rm( p u4arermo3ia1laD  i i;( srtmxr iu4altnmics ()a2rru o;u4tpx if3iytla2um(ms;t4trxrxr3ootlm   neol() euoim ou4lm  mfeiat)sDururpoo0aet mi3tldla2em( snt0arxoio oo1faD lu s;s t2uoxo iu1lp e ncs t)srumumoot1olen o3ias a2rlnmp t4 reoifctotoa elieo;s)tetoxr3nodaltnliviat)aDrm(mono4aet  o3tyslsDrm(monu0artrmrcootfaDeauvols) rumim3oo1alt mnvia(f 2taumoot0aexomi3tadfm rl(vpn(0alxrxfcto1la  lnvs ( trtoim iy4ameelivsas sDtru oou0apxomi3iadfs2emuvs;(0arerxr3oy1fm r n i;(0 2xoio3ou4om nmiet s)sDtru  ot4alt mfeilt a ul(vp;u) rtrmfcoatfmt  u o;t)trum(mpoo4alee ncsa(farrrx p;o1oex iietys a2emn on(4 lerxrctytlat lnvi;s)srxrir oy4lmee fvilsfs2umu  nt0ope  iciatfs em( p u0altrmfcoodfm rlnei;s)teuo(mpoudolen fvi s  rtm(mono1tlen f3tyt a2ran pnt)artnxo iydopteauvils) exoirpiu1omtnlfeil() rra(mont1alxo oetyslsDumuvs;t0tetnxociotoptr n olt0t2urxo3iodlm   ics s) rrm(ro;u1tpx iieiltfaDum(vo (0 exomo tatlmD  ivi;( trtrirpoodole  ncs () 2ur(mpnu4tee mociat a2rmu o (0tetoxoctatlaD lnvs s  exm(m3io1lm nmncil(fa2tmxm no0tlt  iciydfs2emump;u0trtnio iadomD li s;(0 2xoxmpoydopee fctl() Drr( o;t0apxo iciasfs emu pnu0tetomo3iotlpDrlu s s0 rtmiopou4opee ivs sf rraumooo1teeoiictat sDea( o;(0 rtnxocoatlate uvolt0texmxmpny1lpe  nvsa()a2tmx  ;t0optnifeias aDeauvp;u4trtnif3todla e u ils seuoxm3iy4ll emnct s) Dra(mo;o4tlt  o3tadlaDra( pn(0tltnmo3iatoa rauvil() rtrxo3oudap emnvtltf 2uru oot4oex moeiyd a ulumonu0 rtoxocoo1lm  aues s0seum(rpiodlp   iet s  rrmxr oo1tpe iiciyt aDel(mp ()aeerxo iatlm ranesl(  2xrio3iudll emietlsfaDumxr ot4ale  oetas a ranvp;t)tltrxf ia1lmt lneo () euoir3nu4olt  ics t s2rru pou4olx if3tat s ra( o;(4 lxrir ta1omtrai olt0srxr(rpno1aleemivi tfaDtmxmp;t0tetn oeiasfa ra( snu)texnio oa1fm eauvo;t t2to(o3oy1op  lncsa( a2ta(  nu0oeen o3iltfm2eauvs;t)tetnmo oodopD  ies;s trtrxm nodlpte feiasf 2ur(mpnt0oeen f3tyt m um(vsnu)artnxo iadlaDrli i;s0texoxmpny1lmt lncils)a2trumoot4oleomi3iadfs2elnmo;u) rerxo tydfateaivil( srto(m nydame lfci t  2rm(mpou0tleoifctaslm2ranmsnu)arenmo3oadlm   ues;()trxoim iudom  mnvt s)s2ta(  oo1alen f3ildlsDum( s u0 exomr3ia1latr nvols  2xmio3iodal emicsls  rrm(m ;u1alxoifciasfsDeluvo t)texniocoatopt anei;t0 2xm(opnu1om  mfei t s2ra(rpnu1olxo iciytfs2ua( o;u4 rtrmoctodlp e nes;s0srtmxm nodomen nes ( sDrm(m ;t1alenmoetlt a2eauvo;u0arxrio iotfm  anvo t)t2ur(m ou1ome liei ()aDurxmoot4aleoii3tad a2emnms (0 rxoio3iy1lpt aieslt) 2tr(o3iodol nmfvtl( arraumo;u4apen iciaslm elnmsn(0alxnxr3tytfpD lies;t seum(o3oydomen fcil()aDur(ront0apenmo3iad s emuvpnu)tlxrxf tytomDe u i ( sexrxmpiy1al emnetl(  rrmu o;o1alxnmi3tlsfsDum(vo;u0aeenmo3oydla   nei;t  rurxm3oo1lpee fvsl(fa2uauroou0oex io3ildfs2ranmpnu)trxomr oo1lp e i s;t srtmim io1al   nct t a2tax pnt1apeoif3iyd aDumumo u)tlxomr ta1opD  u olt)trurxr no4alt mfctls  Dtru  nu1optomfeias sDumnmsn(0alenmo3oy1om  lneol( srxm(m iydape mict tfs2tr(  ;o4tpt  oetadfmDemnvp;(4 leomrcoodlpt an i t)t2toir oo4lpeelivsltf rrrxrono0altn i3tasfa2eanvs;(4altomr3ta1fa ranei (  etmxrpou1al   nctltf Dta( o;o4alto fciatlmDea(mo (4 rerifcta1fa eauesl( tetrio oo1al e icsa( srtr(rpno4tpx if3iytfa ran s (0 ltomo3tytomD  uvi s0t2uriopiy1altn fesat)arra(r ;u4texomieiydfsDem(mo;t0aetrxf tatfa r neols) etrir3oodlltn ivs t)artaur oo4alen ietas mDum(mon()tltnir iodomtr u o;( t2tr(m3oudomtn fvt (f Dtr( ont4tex mfciasla eauvs;u0arxrmf iadfpDrau ol()trumir3oy1oltnmfcsa()s2tm(moot4apx  ieildlaDelnmpnu4 renmo3oo1la rai o (0 2xo(rpnudal   fvtatfs2ururo;t0texomociadfmDelu s;(4 rtnxf3io1fatran s t)trtoxmpno4oltemnesltfsDra(moou4oexniictatfmDelumo;u)tleoxocootlpDrlueslt)t2xmir io1ap elfcia(faDtaxm ;o4aleomfctlsfaDelums u0 lerif3tadoa eln s;(0trtrxmpou4ole mnvils  2um(r ou1tltnmi3iatla2ulu pnt4aleomr3iy1oatr neolt) rxo(o3iy1lm  lfcs s)aDrrxm ou0tle ioeiyd a2uauvs;u4 etriociydfatrauvi;(0texrxmpny1lptnmnvils) rrr(mont0tetn o3iatlm uan s;(4tleomrciy1faDr nvolt)t2tr(m3oy1lm emfeil( aDrrurooo1ale ioeildfs2rmuvo t0 lxnmrciatopDrlivs s) 2um(o3nu4lle  nviatf Drrumonu1ape ioeiadfm2rlumpnt4aleoif iatlmtelu o;s  rumir iydole lieilt  Dra(mo;t4apxn octas s2um(mont)tleniocto1lpt anvs t0 etmxo3oy4om   ivt ( s2rax  ot1ope  iciydfs2eanmsnt)arxomo3tatopDeaivsls  eumxrpny4am elnvta() 2umxr nu4apxnmoeiadla2ea(mpn(4 rerifcoo1lm eluei s) exo(r nodape  iet tfa2rmx o;t0olxn fetatlmDelnvo;()treomo oy1oatrlnes t) exm(r3iy4ape lfet (f Dtr(m nt4texoio3ildfs2uau o;u4 eenir3iadoaDeli i s t2xm(rpny4omtelivtat aDtmxroou0altoio3tysfmDemn sn(4 etoif3oatfm eli o s seuo(o3oudolte nct (  rraum nu1oetoiietad a2emuvpn() etrxr iotfpDelu i;t0s2tmxm3iy4lltnmnviltfs2taxront4aet  fetasfmDranmp (4treomr3oytlp rau s;t0seuoirpny4ll  mnct tfsrta(mpoo1optomi3iasls uluvp ()altrio3oo1lmDelueils  ruoir3oudlmt mict s  rta(mono1ape moctldfs2rmuvs u0trxrxo iytoaDrlieol(0 2umxo no4lle mneilsf Dua(  ot4oex  icildfm2umnmp u4tlenif3oy1lpt  uei s teuo(mpnodamee net (f 2urxr oo4ale  fetytfa2umumo;t4teerxfciadoaDe ivils trumxmpnu4oltelicils) rrmxm ou0texoiiciytlaDrl( s;u)aexoxf ty1opDeauvols s2toxmpiu4olenmnvsl(faDrrur oo1opxniociadlm umnmp u0tetomfciydfp eli o t) ruoxrpoudlm n fctat)a2uaum ou4tpxoioeiyslm uluvs;(4trtnmo iy1lp ean i;()sexmxrpnu1al nlneia() 2rm( poo4oet io3tytls2rauvp;(0 ltrifcoydlpD  i sls)texoxopiy4olen ivilsf Draxrp;o0texo feiyt a raums;(0aetnmf iydlmD ai sls0texo(o ou1llt mfctls s2ua(mpno0apenmoetadfa rmn s;u4treoifcty1late ivo;t  rtmxr no4lm e neilt artaum ot1altn i3tldlm ranvpn(4tlerio oy1fpDe nvi;t  eur(rpnudam nlivsat  2ua( pou0tlxoif3iat s elnvp u4tlxomrctatfa rlu olt  rxo(rpoudlpenmnvi t) 2raump;t1tlx io3tatfmDulumo t)treoxf3iadlp   ivilt0 exmim ny1lmte nvsa() Dtmxr nt1opxnif3ilsla rmnmpnt)altoxf3tatop e u sl(  eumxm nodom nlnesat a2rmx ont1tpe if3tys mDuauvpnt) lerif3tatlaDrluesl()t2xrir3nu1olenmnctlt) Dtrx oou0tlxo oeiytfm2ran p;()alxrxo oo1lpDr iei;s0sexoxm3oy1lp nlici t s2rr(r ;o0apenmoeias mDumnms u4 eeoxr3iatfmt lueo;t srto(opoodoptnlicsas)srumurp;t1apx mociad a eanvont4 ltoirciy1lp eluvols t2xoir3iudlpe mneslt)a2ururpou0ape ii3ias a2el(mpnt)texoif3oadfm   nes (0srtoxr oy4lp  mivsat)a2trxrp;o4alen ocilt a uau on(4tlenifciytomD ln ils)trxoio no4op elivtat  2rrxrp;t4oetomictasla2rluvs () renxfcoydlmDe i i () exoxopnodop   nvsas)aDrrx o;u0oetomoctat s ulnms;(4areoxo3iodoaDrlivo s0t2xoxopoo4ole mfeilt  2urxro;u0tpeo o3iatlm ean o;t0artrxfcoy1lm e u sl(0trxmxo nudlme lnctls)sDrauro;o1aetnmfctatfa2rln p t)alxrmocoodoa rauvsls)t2umxm no1lmtnliet sfsrrrurpot0texniicild a rmu p;(0texomociy1latelivi s0texr(rpnu4lmenmfctas artrx  ou1oleo fcilslmDrmnmp;(0 rxrxr iatfm eaueils tetoio oudope liet t) rtm(mp;u1apt mfctldlsDum(vo;t0 rxoxf ty1oatr ivi;s) 2ur(mpou4al  mfesasfsrta(r oo4apeomfcias m umu sn()tlxoifcio1fpDe uvils texo(m oo4ap e ivtls) rtmur oo4alxo feiat a2emu snt4treoxo3iatop eaueil()seur(r3nydlltelict ( aruru pou1tlenmicils m ulu p t4 exnxocoodfptelneols setr(opno4op   ncs t) Dtrurpnt4olenmocildfmDulums u0tlxrio todfpDeln ol( truo(o oudapeemiet () Dururpou1tleomi3ilsls2rauvonu4trxoiociytlpDraieolt trurim iudomeelfvtl(  rraurono0altnio3tlsfs el(vo u4 lenir3oo1late uvi ()sexr(m oodll n ici t  Dtru  ot4openio3iasla2ranvpn(0aetnxrctadopte i il(0 2xmxm io1ole  ieia(farrau poo4tle if3tadfsDran o;() rermr ia1oa e iei s  2xo(r iy1al  lfetat)a2raum ot0apt if3ildfs2umums;t0trerxrciatlm ranvol( teurxr ou1lmtnmneiltfsDtmxmp;u4alenioctatlmDrau o;(0 lxrmo3io1fm e u o t  2tm(rpiu1am   nei t)s2uaumpnu4olx mi3iasla emn p;(4texnmr oytlmDe uvi s)setm(o3nydoptnlfesa(  rur(  oo4apeomf3ild aDumumo u0texoio3iotlm   nes () etrxm oodomt  neslt) rra(m nt1oeeomoeias s ra(mp;u4 rxnxr oatomDeanes t0sexr(r nodoleemnvsltfaDtr(rpnu0alxoiociytfm2umu p t0teermrctydlptrlivils) rxoim3ny4op nlfcils)s2ta( pot1alxnmf3tyslm el( s;(4 eeoxf3tytfpDe n o t)srxrxopnodop elfcs s)srumx pnu4apt  feiydlmDrmnvsn(4aetrir iatop  lnvo;s0s2to(rpiy1ol emiesl()a2raxm nt4teen feildla2rm(mpnt)altrxf tytopt aieils0 rxm(rpoydoleelnvsatfarrrxr ou1texniieiysfmDeau snt0altrmocootop eliei;(0 rur(o3iy4alenlnviltfa2uauroou4aex ifeildls2uaumpn()tetnmf3oydoa e ivil(0 rtrxrpou4lleelnvs s)srtrx  nt4oet iocild a2rm(mp u0 etoxf3iadomt au o s t2tmimpny4al e ietat aDrr(roou4apto iciydfm2ua(mo u)alxrmfctotoaDrlieolt tetr(o no1lle  iet (f rtaurpnu1olen feiasfa ea( o;u)artnifcootlaDeaivi s0s2xm(rpiudllee ieiatf 2taxro;t4apt if3tyt a2emn snt4tleomr iodfaDeanvilt)t2xmxmpiy1omt liciltfa2umumono1oetnmictyt s2ulumsnt4tltoif oa1lmDean o;s0srtm(mpiy4apte fetlt  2taumont1tpe  f3iysfm2rau o (0 ltoxf iotfpte uvs;t)teur(r3ou1lmtelnvi s)s2tr( oou4optomi3tlt a ulnms t)texnio iadlateauei s0sruo(r ny1ameemnesatf 2rau o;o0aptomoetytfaDrauvpnt) lxrmocoa1lpD  nes;t sexrxm3oodllt  ivtat  Drr(moou1olxoio3iydlsDumuvont0aeeoxf iydom rln sl( teumxm oy4op emnvs tfsDrmurpot4apxomiciyt m2ranvo;t)teerxo totlp elieol(0t2uriopoy1llt liciltfa2tr(roou0aleomietldls el(vo;u4aexrxocta1omtr ues;t0s2xrim iy1olee fetlsfs2tm(mo;o4aexn oeiyd m2ean pnu) reoxfcto1fa  anesl()s2umim ou4apt  fetl( sDumxmont0aexnifciatlaDul(mp;u4texomocia1oaDrlues t seto(o ou4ome mncsls)sDrr(r ;o4teto o3iytlm2ea(vp;u)artnmo oadfmteaivo;(  rtrim nu1llenlneils arumxm no0tpx mi3iadfs2uln p t0trxoif oydomtrlueo t  2xo(r iudom nmneias srtm(r ;o0oex  icildfmDuan pnu4 rtnmfcoodomtelivsl(0tetrir iudaltemfvsatfs2ta(  no1aetn i3iat mDumnvs t) rxnxr3iatlat au o t)srtoir3ny4ale  fcil( sDraurpot1apxnif3tasfsDemuvs;u0 rxnxf oadfa  ln ol()srto(o3iydop  lnvtas  Dumumono0opt  o3iatfm2rm( o (4trxnxr3tydop r ueolt0 exm(opnudlme mfcsasfsrrrxrpnu0altomfctltfa2rmuvp (4alxnmfciy1lmtrai sls0srxoirpny1olenmnviltfaDtm(mpoo4aetoiociyt m2elnmo;(0 rtoxf iodlmt aivo s0t2xoio io4ope mnci () Drrx pnt1opeo o3tasfaDrmump t0arxomo to1optrauvs (0tetoim iudllenlfvi ()sDrr(mo;u1tpt ifcias s emn p (4arxnxrcia1opDeauvs;( trxmio oo1lle mnei sfs2ta(r ;u1oexniocildlaDelnmpnu0 lxnio3iytlpt an i;(  2tmxo3ou1ape  nvia( s2uau pot4tpxomoetydls2um(mon() rtrmr totfpte u s;(0 rxo(r3io1lpe mncia( aDurxrpoo4olxomf3iad sDraums u0 renmf ta1opDeanes s) exmxm3oy4omtelfvt tfa2rmur ;u1tlxn ietysfm2uanmp u)trxoio ty1fm  lues t0 2tr(r3nodlle  ieil(faDum(  no0oleomieiltfa2uanvs;t4 etrxr ta1opD luvs t0setr(rpoo4lmt lncsat s2rm(rpno1aexnif3ilsfs2rm( s ()trenxo oadoa   n i s) rtrim3iudope  nciltf 2tau pnu4tetn f3iadlm rlums t4 etnmo3iotomDr uei t t2umxr3iu1opt  icsl()artm(ronu1apxomo3tysfsDul( pnt4trxnxo oytoat aneslt)trumxm io4ap nmnvsls) 2uau p;t0ole io3iys s umnvpn(4arxrxociadoatr n o t  2uoxopnydaltnlics t  Drru  ou1tex iieiyt m2um(vonu)trxoxo iodfaD aneslt0trxrir ny1al n ici ( a2rau  ot1oexoifeiydfm emuvp;(0altoircoatlat aieil() 2xr(r3ou1optnlncs ()s2ra(  ot0optnmfeiaslmDum(mp;() leoir ty1oaDr n i t) rxoirpoy4lmtnmneiat)sDrm(ro;o4olxn o3tysfs elnvs t0aetomf iydopD anes s)texm(m3iudol  mnesat)sDrm(mo;t4oexo iciad mDrm(mo;u4 lenxrciotfm e i ilt0 euoimpio1amenlivsa(farrrur oo1oexoiieiytlm ua( sn(4artrmrciotlpD li i ()srxmxopio1llenlnes t arraxmono0ope iociyd s ran s t4tltrif tytfm eauvo t)setmim iu4amee ivsls)srta(  ot0ole  ocildfa2rmn s;u0tlxrio3oytop rlues ()t2uo(opiodape lfeiat) Dur(mpoo0tpe mi3iltfm umn pnt4 exomrcia1laDelueslt0 exmimpny4omt licsat)sDtmxrpot4tpx mf3tyt a em( p;u4teerir3iodlateau i;()t2um(r ny1ap nlnvilsf ruaxrp;u0aptn iciltla2rl(mpnu0tlxoxr tatfmt au o;s0t2uoxmpno1omt lnct s  rtm( onu4apx if3tad s eanmon(4arxrxfciatfmDr neolt  rtr(o3no1olt livs sfsrra(ro;u4aptnifetyslmDrlu p;t) ltrir tydfmteli sl( srtrxopio1lltnmiei sf 2umu pou0olenmf3ils s uln o;t4altomociydfmD  i s t0seuoio no1olt lfei s  Duaxmooo0tlenmo3iasfs emuvpnu) lenifciadfm e uvi t) eur(o3oy1opt  fes sfa2ua(monu0apt  ictlsfm ra(mo (0aeerif iatfpD lies ( s2umir ny4ale mfetlsfsDururo;o4alen o3iyslm2rmuvpn(4aleniocoa1fmteluei;s t2uriopny1lmte ieta( a2urxm no1olto oeildla rmumonu0 rxnxociadlateaneo t) rtoiopiudamee ivtl(  2tmx pou1aee  iciat sDumnmont4arermfctatfmD ln i;s  euoimpio1ale  ieiltf Dra(mont1aee  ociydfsDeln p u4aeeomo3iy1oaDelneo;t0 2tmxm3iu1oleelfvsls  2urxr nu0oexnmoetadfaDemnmpn(4teermociatfpD  ies;s srxriopny1am emnvtlsf 2taxr ;o1tet  oetydfsDrmn pnu) rxnmr tytop eli o (0s2urirpiudlleelicta( aDtmxm no1oltnioeiytla2ul(mp u4 eeoxf oydlmDr n s;s trtrim oudomtelfci sfsrtmxmp;o0tltn oeild a emnvp u4texrmr3oytlm rlneo;() eur(rpno4ole lfct tf 2rr(ront1olxoiociyslsDemnmsnu0tlermr oy1fmte uvsl(0trtriopny4olt lnvsat)sDrr(  no0olxoioeiad s2um(mpnu4 rxoif3iatopt ai s (0srurxr3oo1aptnliciat aDurumoot0ape  i3iatfs rmums;t)trtomrctytopD  ies t t2toimpno4op nlicias) rtm(mpou0tlen ocild sDeanmp u4 etnmf tatlatrln o;s0 euoxmpnydaptn ieils aDtrur ot4texo feildlm2rmu pnu0 eenxrcoadomDrlivi (0s2umio ou1oleemivs sfa2trxr no4ope ii3ildls rl(vsnu) lxomf ootlmtrai olt)s2umio3iy1ol e ieslsf ruru o;o4teeoio3iasfaDemu p u0 eerxrcia1omt luei t0sexo(rpiy4lp   fvtl( a2rmuro;u1tpxoifeiyt a2eau p;(0 rtrmr iytfatrlues;() 2trir io1alt lfvt s sDtr(r ou0alen oetas aDeluvsnt) ltnir3tatoa eluesl(0trxrxr oo4alt mivsl() 2rru p;u1oeto fciadlm2rmnvo;(4 rxnmf iy1op r ivslt)tetr(m3oy1oleelnvs s  rraxro;t0tpxomietat s ul(msn(4 lermo iydfa e ieol()srtrir oo4ameemfcsa( srrru pnt1opx mieild mDrmnmo t0arxrirciodfmt auvs s tetrxo ny1ap n fvsa(fsrtau o;t1tpxoifeiytlmDranvs () eerif iadlaD aivo;t)seum(opoodlpt mfei tfa2tm(rpoo0tlt  ociasfmDuanmo u0aleoxrcoadlaD livslt)texoir io4omt  ieslt  rrm(roou4texnmf3iaslaDrmnvp;t4areoxfcoy1la e i o;s) exr(o3iu1ole miet (  2trump;o4aptnmieiys a2rmn snt)areriociytlatrluvolt0texm(r3iy1am emncs t)arur( ont4aeeoii3iyt mDuanms u4aexomf tydoatr u o t)seuoir3oy4amen nvtlt srur(rpnt0tlxn oeildls ua(vs u4 leoifcoadopteln ils)s2xo(r oy4oltnlnctas  2raxmonu4oet ifeiydlmDemnmo;t0trtrmf3oydfatelieolt seumirpnydam   icil( arraxmo;u0tleomi3iaslsDea( s () lenmr3iodfateanvolt texoio no4optn iei (fa2ua(mo;t0tlt mf3tatla2elnmp t) rtnir3oatop elies;s0 2tm(o oo1olte nvt s)s2uaumo;o4tpeomfetasfsDrmn o u)aetrxf3oatlm rlu s t seumiopiodal  mfeilsfa2rr( o;u0ole  o3iyslmDrmnms u0 renxf3iydfmDr ueo (  2um(o3iudoltnmnctl(f 2urx ooo0olto oeiltfa elnvs u4tlxrmrciytopteln o (  exr(m nydameemfetas aDrr(m oo0tpt  o3tys s2eanvp t4aeenir3oa1lpD aneilt) exo(opiy1openmfvt s)artru ono4alen octasla2rlnvo t4 renmocio1lmDeaueil(0 2xrir3nudamee ncilt) Dtaxmpnt0oeeo fciad a2rmumsnt)aeeoir oadfpt aieo;(0texmio3iu1lp nmivilt)srtrumpot1tpe  fcils m2rlump (4trenio3iytfm ranes t0s2trxo oydlp n ietat) 2tax o;o1tpen ociasla2uau o (0 eenxo3iotlpD  ueo;s)t2uoim oodamtnmfcil(fsrum(mo;u1tlenmf3iyt s um(mp;u4 rxrir to1oaDeluvs s0srxr(m3nodlpte fei ()sDrrx p;o4olto o3iasfm umn pnu)trtnifcio1lpDe ueil(0teuoxm nu4ap   nvtasfa2umx pnt4tltn i3ildfsDul(vp;t)alxoiocoatlpteaivo;( t2toxr nydapen neslt s2taum ou4oetnmi3tydfaDrlump (0altrifcoodfa eaivi;()s2uoxmpoydapeemfesat) rur( p;t4teeo fetlsls ulumont)tltnio ty1oaDrlu o s  exrim iy1lltemnvsa(  rururp;t4texnmociltfm2ranms;(4tetomr3oy1fpD  ues t0trto(o iu1al e fvia(f rtmxroot1tleoiociatlaDua(vsnt0 eeoif iotomtrlnvo;(0sexrio3iy1lme  ivias sDuax oot0aleomoctat m2ul( o;u)tlxrmrctydla rai o;t srxm(o no1lmtn iciasfaDrax ono4opx mieiydfmDumnvo (0 lxnxoctydfp eln i s0 eur(mpoo1lptelictl(f Dtr(m no0alxoiieiadlaDua( s;(0teenmo oytlmDr neo;() rto(o3nodolenmnct ( sruaumpno1oleo iciysla2umuvonu0 rtniociotop   nes;t  rto(opny1lltnlfvi s) Drrxrpno4oltnifciaslm2emn ont0 ltnio ia1fpDe uvi t seumxopoy1ole livs t sDtru ooo4tpt iictldfaDel(mon(4texnxrcoatfpDeaieils)t2umim3ny4olt mfctl(fsDrrx ont4apxoioctadls em(ms;(4 rxnxrctadlm r i i;s  etoirpnodalt  icilsf rraum ou0tleo ociytfs2eluvs;u) rerxr3tydomD  ivil()t2xo(o3no4amee fvil() 2trxrp;t4tpt  ieils s2rmn snt4areomf iydopt  neo ( srxoxopou4olt  ivsls)s2taxm ;t1opx  o3ilt a2ea(mp;t)altrmrcio1opt aivo (0setmirpoy4omenlfetlt  Dum(m ;u0apxnmietadlm uan p;(0texomfciotfa elu i;t0s2toio3nodomeemfci sf rrr(ro;t0ole mo3iad aDumnvsnt4alxrir3oydfaDeaivi;s0seto(rpnodole mnci sfa2rr(ro;o4ape  ietatfm2rln s t)artrmocoodfaD  ueo;()texmxopoydlpenmfcilt  2tr(mont1tptn o3iadfsDuaumo u) rxnxo oytopDran s ()srtr(m3no1apeelietlt)a2uaump;t4aeen i3ildfs uan ont)texnio oydlm eauvo;(0 rumim oy1al emnvil( aDtax pot4oleo oeiat sDuaump;t0 renxo3totlpte uei;(0s2urxo3iudame miei s arrrx ono4alxn i3tysls2rl(vo;u)trtrxrctadfmtranei t0 exr(mpnu1am  mncs t  ruru oot0aet mfetlsfa el( p u4altoiocta1fa  auvo t0 2xmxr iodlltelnvsas srta(mpou1aeenmf3ias s2uaump;t4trtoio3oodfmt anvs;s)t2xo(o nodoptnlics s) Dta( pnu4apt mociatlmDeanvpnt0arxoxrcoa1opt lueo;s)trxoxr ou4al elfct s)sDraumo;t1oeenmoeiltfm2uauvpnu4tltrif3ta1fpte uvs s0 eto(o iu1amee ncs sfsDua(mp;o0oeeoioeiltfm2ra( o u4artoxrciadlpDrlieil(0trtrxo oydlmt mieslt) ruaxmpou4tpx  i3iydfs rmuvo;() ltrmoctytfmteluesl(0 etrirpno1lmt mivs (  2uaxr oo1ale  oetaslaDrmnmp t)texoxo3oytoptranes s0srtrxo iydale  fcs ()sDra(m ;t1aeenmfctltfm2emumpnt0 exrxf3oytfpDr n i;t0texrxm iu4lmt lfcslt) Dua(ront1alt  ictlt a2ran o u0 lxrmocootomt  n i;s0 2xo(o3ny4lm e fvsa()srtrxm ;o1tlx  ictlslm emn pn()tlxnmrcoo1op eln il(0 2xrir3oy4opte ici sf 2rruro;u1tptoif3iaslm uluvon()tleoxf oadomDran o;( s2toxopoo1lltnlfcs (  Drmx  ot4optoio3iytlm2rlumon(0trenmr3ootfptr ueol( srur(m iydomt livs s aDrrxrpno1tlenmocildla eauvp;t0aexoiociydlm   n s;()t2um(m3no4ap emnesat)a2urumpnt1tlt mfetytfsDea(mo t4texrxr iodlmD  n i t0s2tr(r io1alte feslt) Drrum nt4apeoii3tls a emn onu)aetoxociytla   i i;s) 2xmxopoo4ap n nvsls sDrmxrp;t4tpt ifetldfsDrmums;u0arxrxo tytoatrluvi;t s2um(mpio1am emnei s) rur( poo0olto ieiysls2el(vp;(4altrxo3oadoa e u i;t)teumir3no1lp emfcilsfsDum( p;o4aexn o3tytfa emu snu)altrxo3ootop elu i () 2uoirpoo4omte iei ( arurxm nu1tpenmo3iltla eluvon(4trtrxf3oy1om eaiei t t2umio3ny4lmtnlnvsl( s2urxr nu1oeeoif3tytfmDeanmp t4 eenifctydfat  ivi t0s2tmio3ou1al n nvilt arua(mono4tpx moeiat aDea( s t0 lxrxociytfa   n o t0srtr(opiu4ll emfvtlsfarrmx pot4tpeomo3iad a2eln sn() renmocootomDe neol(0 rumio iudll   iesls)aDtm(  no1oetoifciadfmDum(mo;(0tlerxrctotlptraueo;s0srxmim3io1ap emieils) Dur( p;o4ope  oeiys a2rlnvonu4 rerxo3oodop raneo t)tetm(o iodll n fei t a2urx p;o4oexo ietys mDumuvp;(4aetrif ty1fmte ies;( srxr(o oy4lpe micta(f 2ra(rp;t0alxomociytlm2em( p;t)altrxf3totfmte uei;t) rxr(r3oo1ale mivil()a2tm(mpou1alx mfctlt m rauvo (0arxoiocoy1faDelieo t  2urio oydom  lnvia() Dtaxront4oetniociatlaDeln o (4tlxrxf oy1optraies (0 2xrxr3iy1lp elietas)srta( pot1tpenifetydls eanms;t4 rxrxr ty1fp rai i;s)seto(m ny4am  lietl()sruru  oo1apen o3tytfa2el(vont4 exrif iy1omteau o;()srtr(m3iydom elivsas)srua(m nt0apxomo3tat mDuauvo u)trxrmo3tatfp  liei;s)t2tm(m3oy4lmt licsas)aruaum oo4alxomo3ilsfs2ra( ont4altnmo3oatlm eln s ()tetrxo3io4omtelfvi s)srta(ro;t1tex mfeilsfa2elnmsn() exrircoodomtelieilt0trxr(rpiodlm n icia(farraurp;t4alenmfeiydfmDulu snt)aetoxr3tytla ran ils)trxm(m nodlmte fvt sf 2trurono0opeomfeiys sDuanvonu)texoxo3ootom rlivols0 2xm(opoy4al emfvta(f Drr(m ;u0tltn o3iyd m2ulumo;(4texnxrctatoa   u s;(0texr(mpoydam emivsls) rtaxm ;u0tptnifctldla2ea(vsnt)tetrmociatlpt luvil()s2xoxmpio4lp n nvi (f rta(mo;o1apt mi3tytls2elu s u0texrif3iatlm rlu olt sruoxr oy4amee ici s)aDumu p;o1tpxo fetatfs rm(monu)tetrxr3iadfp eluei () eto(o no4lm nliet s)arur(mont0aptn iciadfmDua(vont0arenir iodlm  aues t) 2ur(o3ou4altn nvta() 2ta(m oo1alxo i3iyd m raumo;t0 ltnmrciatlaDeauesls trto(mpiodole  fet tfa2trum ot0ope mocildfm2rl(vsnt) ltnir3ta1op   ies s0seuo(rpoudaltnmfet t  rurx pno4alt mfeilt s elnmon()altoir3ty1la  livo;(0setmxmpiu1al  mnei tfsDtmu o;t0alxn o3ilsfs2rl( p u)tetoif ia1faD aueols  2xoxm oudolte iesl()arra(r oo1tpenio3tadfm2rauvpnu)alermr totopt auvi;s  rtm(opou4omeemfvi (f 2tmuroou4oltomiciydfm2eln o t) eenmrcto1fmt  neil()teurxr3nodal nmfvtls artaum oo0aexomo3iyslaDemuvp t)arxnio3todfm elnei ( seurxr oo4olenlneslsf 2urxr nt1apxo oeiydlm2ul( ont4teenxr3oy1fpDr uvs t0 etmxm3no4ape mivs (f Drru o;u0olxn ieils s2rluvpnt0 leomo oatfptrlivs t0srxrim nudopeemncta(fs2umx  nu4opx ioeiad s2emu p;(4arxomr3ty1opDr i i;t)sruo(o oudaleemfct t a2uaur ;t4olx iocild aDum(mpnt)trermf3oa1laD livi (  rtmxr3io1lmt lfes (fsDumu poo4aexomf3iytla eau p;t4aetrmf ootla elu ilt) 2uo(o3oo4omt lfct t) Durxm oo4aetnio3iltla2ua( p u0texoio tadomteanvi;() exrxr3iu1ome mfes () rum(ront4aeeniicilslaDua(mo (4teeoir iodomtrai s;() rtr(o oudolte nvt s)sDrrumo;o0aeeo o3tydls2eaumo ()aetomfciatomDr nei;s0 2um(m3oo1lpenlfcilt artrxr oo1tpx iieiytfm2emn o;(4tetoxr tadfpDrauei;s seto(rpny1lle  nvsa( sDtau o;u4olenmf3ildfm emuvonu0tltnir3oatomt livi t) rxo(mpou4amte nvi t)s2ta(mp;t4tlxnmfeiadfa2ua( o (4trtomo ty1fateai ol( sexoxopnu4am  mnvsas)s2taumpoo0tltn oeias aDem(vpn(0artrxo3oadfm rai slt srtm(opny1lme lictl( artaxm ou0aexnifciys aDuan s;u)trtnxo3oadoa rauei;(  etmxr3iu4amtn neils)sDtru o;t0apeomf3tldlaDrm(mont0aetrio3iotomtr ieo s srtrxr3ou4ale micsl(fs2taxm ou4tpt mo3iasfs2rl(ms;u) ltrif iotoa e u il() exmxm ou4olenmncs s aDta(mooo0tpxn f3tls a emu o t)tleoxfciy1oaDeln sls0 2umxr3oy1amt  nesas srtaxmonu1apeomi3iydla eanmpn(4aleomf3iytfat ln ilt truo(mpoydlltnlnetls s2tm(r no0aptnio3tyd sDum(vsn(4tlxnmr3oo1oatrluvs () exmxopnu1lp n ivtat artrumono1aee mfeiasfs ra(vs u)areriocia1op  lueo t0sexr(mpoo4amt mnvils) 2trump;u1texn ociys m ul( o (0teeomocto1fpt lnvi;t0setoxr3oo4altn fcsls)s2uaxr ;o4openio3ildfs2um(vo;()alxrmo3ootlp e i i s setoir iu4ap  lictl( s2trur ot4texnmf3ild m2em(vpn(4trenmr iadlm rlnes;s) 2xm(m iu4amenlieils s2rmxrpoo1aee mo3tltfm umnvs (4 eenif3oadlaD aueol( t2uo(r oodol nmicsasfarrm(mo;o4texnmoeiytfa rl(vpnt) etnmf3iadlpDeauvo;t0seto(o iy4ll elncilsf Dtau poo0alx ifctltfmDel(mp;() rtoxo3tydfm e nvs;(0 rurxopou4amte ncslt aruax p;o0tle  fctysfmDrm( pnu0alxoio iatlaDraueil( setmxo iu1ol  mfcilsfs2rmumpno0alx ii3tld a emump u4 eeoxr3iydfa eluvsls) rxoxm3ny4am emnei ( a2rmxr nt4apenmieiltlsDua( s (4aetrxrciadlm eaivslt trto(m3oy1ll elneiatf Dra(  ot1optniocilsla emnmo;u0tlenio tatopD  ueo;(  rtoxmpou4opte nvt s a2trxrp;t1texniiciltfa um(
\ No newline at end of file
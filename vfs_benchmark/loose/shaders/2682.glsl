@@ -0,0 +1 @@
+i o () rxmxr oydamt  neias sruaurp;u4tptnifciytfa2rmu s;u) renxr iotfmD ai ils0teuoxo no1lpe mneilt  Dururooo4aptnmi3tytls2ul( o;(4tlxnmf oo1la rli i;t) 2tr(m iodlptn nvtat a2ra( pnu0oeeo i3iyd a ea(vp;t)trxoxr to1lpD lu slt texoim oo1omt livi ( a2uaxrpnu0olxo o3tlsls2eaumonu0trxnif3io1opteaueilt0 exoir3oodalt  feia(fsDrrurono1openiociysla2ea( o ()aleoiociodlaDe n s;s)s2ur(rpoo4ll   fes () Dtmurpno1teenifeiyd aDrlumpnt)artomo iodopDe ivs;t0t2xoxopiy1lm nlieia( aDraxroou4oltnifctad s2uln s;t)alxrmo iatlpt aies;() etm(r3oo4lm nmicsas  rrrumono1aet mo3tlt s2rluvp t) etnio ia1lmDran ol(  2um(mpnu4lm emivtatf Dta(roou4aee io3iatfm em( ont)aexnir iy1opteaiei;()srto(mpoy1omenmfeia(farta(mont0olxnmociltlmDuln p;(4tlxnif3totlp r nvslt s2trir ny4amtnlnet s)artaxmp;o4olx  i3iyt s umnvs;()trermociy1lpte n o;(0t2uoimpny1aptnlnvtas artr(m ;t4aeen fcildfs ulump;t4artnio oadfp rlnesl(0t2tm(r3oydomtemfcsa( srtrumo;o1alx mf3ilslaDrm(ms;(0 rxrio3tadfptr uvi t)t2xmiopiudap emnei ( s2rr( ono4opxomiciysfm ulumonu0teenxrctydopDeluvil(0sexmxo3ny4lp elfeslt)srumxmoou1aleomictld a umumo;t4 lermo io1lm raieols) rum(m3ny4oltn ictatfsDrrxm ;o1apxnif3tlsfm2eau p;(0tleoir oy1laDr ies;(  eto(r3nu4ap  livsltf rurxmono1aeeomf3iad a2ra(mpnu)aeeomfcoa1laDe ues;s0s2uoio iu4lpeeliet tfsrumuronu1tee mfctyd m2uln s u0 eenmoctotoa ranvil(0s2um(mpiu4lle  fvia(faDumu  ;t1opxnmoctlsfm uluvp;()aetnmr3todfmDeli s;s)trum(r iy1al emnvia( s2tmum nu4aet mfciat sDumnvpnt)arerxf3tydla  lues t)srxriopiodome  fciasfsrtau ooo0apxn fcildfaDuluvo t0tlerif3oytlatr n i t srurir oy1om nlncslsf 2taumooo0oleo octlsfs umnvp;u) exnmr oytoatr u ols)setr(o nudal emfvsl(f Drmur nt1oetn i3iydlsDran s;(4aleomf oodfat luvo ()tetoimpoudope mici t)sDuaumpot1apt  ictatlmDean s;t)tltnxr ia1lm e i s;s sexoxopnydlltnmfcta() rra(ro;t4tpxn f3iaslm2ua( o t4tltrxfciydfmD livsl( srxrio3oo4lpeemnvsltfaDtaxmonu1alto oeiytla2umnms;u) eenio3totlmDelieo s) 2toio nodaptemnctl() Drmum ou4oeeoifeiat mDuan pn(4artomo3iy1lptrau i () exoio3no4ol  mnviat)a2tauronu1oex mfetytlmDrln on(0tetrxr3todlaDr uvo ()sexoxr iu1apenmfctlt)sDuaurono1olt iiciltfm2ea(mpnt4alenmf oodlpte ivo ( t2xoim ou1lmte ictat s2uaxr ;t0oet mfeiasfs elnvonu4tlxnmo iadfaDrlivi;t) exmxr3iu1alt  ivsls a2um(  ou4ale ifetls s ua(vpnu4texnmf ty1opt luei;( t2xmir ny4amtn fvi (  Drr(r ou4aexnmieiys m2ra( sn()tetoxocio1faDraivils0t2trxo oydamee fet s srta(  ;t4oexn ietlslaDemnvs;t)alxnxf iydoa rlies;t)tetmio oo1ameemfeilt  ruaurp;u4aptnmf3iatlm2uanvo u)tetoircty1oa elueilt0trxrxo3nodolte ivils)srrmxro;t0tleoio3iyt m em( o t)tltnio oy1fmD aivslt)texrim3iydll n iesls srrrxmo;u0tpenifetld s rau s () rtrmf tydomD lnvil(  rxrxr no1lme lfvias  rurx  ot0tltn o3iysla2rau s t0artniocoatfp r nvsls)s2tmim iu4ll nmnviltfs2rmu pot1aleomocias a ea(vo u)aexrifcoo1lmD  uvol(  exmxo3oudlmeemieiat  2tax pnu1alxniictytlm2el(vs;u)trxomf iotlm   nvi t t2to(mpou1optnlietl( srtaumo;o4aee mi3tatlm uau o;()aleoxfcoydla eanvs;(0srtmio iu4amenlfei sfaDrruro;o0aptomieiysfm2uluvo u0 rxnxo3iotfmt lu s;t)srto(r iu1olen nvtas) rtrxroou4oleoifciatfa eau o;(4aexnmo totlpD aiesl()s2toir3ou4llen ncta() 2tm(ront0oleoio3iasfs elnvo;(0tlerir3ty1oatraivs;t  2trim ou1lmt  net ()aDur(  ou4ole  f3iatfm2ulnmp t0trxoif3ia1lpDranes;t0trumio3oo1ll nmfes ( aDtaur ou1olt ifeiyt m ra(mpnu0aetoxo3tytla  aivsls0 ruoio oo4optn iet s  2taurpou0oex mi3ils aDranmpnt4altomf3tadla ean s s)srtmir3io1ol   iesl( s2rrx pno1oeenif3iysla2ul(mpnu4 renxf3oodfp r uvs;() eumir3ou4opee nctas)arua(rpnt0oetomoetldlm uaump;u0aeenxoctydfp   uvo t)teum(r iu4lltnmfcil(f 2rrxm ou4tle  ieiydfaDumuvp (4tlerirctodlmt lueols)srtoio3ny1op nliviltf 2ta(  ;o4alxoif3iad m rmnmp;(4treomr3ootoa  lnvs s t2trim3iu4olte fcsltf 2rmur ou0oetn feiltlaDul(mpn(0tlxrxo3ootoat  ies;s  2xoiopny1amenmfeiat)s2uax  ot0oeen ictltlm em( on() lerif io1fm rlu o;s0 euoxmpnu4om emnvsl(fs2rmu poo4olx moeiaslsDumuvs u4tetnmf to1fat auvslt trur(mpno4apt mnvi sfaDrax poo4oex  f3iyslm2elu s;() leoirciytla e u il()s2urio3ny1am  micia( sDrm(mp;t1tet iiciatla2ulu s t4aexrxr tydlptr u i t)srtrxm3iu4olen fvs t)arumx pot0aexo f3ilsfm eaumont) rxoio3to1oaD auvi;s0t2uriopny1lpte ivil()srrrur nt0tlt  icils a elnvp;(4 exnir io1oaDe u o t0trxmir oo1lpenmfesat aDrmxmonu4tpe  ieils a2rlnvo;u0tlxnmo oa1fat lu sl( srxoir3iodop   fviat s2rm( p;t1apen oeiatfm2uanvs;()aetoir todom ranes ( teuo(o3nydlltemict s) Dtr(r ;u4olenmf3iyt s ul(vp t0tetnio3iotop ean olt) rto(opoo4ame mfeilt  2tmx o;t0oeeomictaslm2em(vo;u4trxoxf ta1om  auvilt  2toxrpnudlle liesatf rurxm no0tlx iocilsfs2ua( p u4 rtnif3iatlmDr nvilt trxmiopou1oleelnesls  2uau  nt4alxo f3iltlsDumnmo;t4aeenir3iatfatr nvs s)setr(opoy4lleelfet (fsrur(mooo0aeeomieiysfaDel(mo (0trtnio3ootlat anei (0 rxo(mpou1aptnmicsa()sDra(m ot4aexoiieiydfm umu s;t) rerir3iy1om rlueo t teto(r no4omeelietl( arumx o;t1aeenii3tysfa rm(ms;(0aeermr3ta1oa elneol()tetrxopiudom e nesl()artmurp;o1ape  f3iatla rau s;u4teeoxf3iodfmte neils0 rxoimpoy4lm  mnvs tf rta(rpou1oleniieils a emnms (0tltomf iadlpDrln o (0seurio oudamenlfet t) 2trxrono0apx mfciatfm2emu p ()arerxf oa1lpD  u il( srxmxm oodomt miesat a2tmxm oo0opx  ociasfa2rlnvo;u)trtomocootlmDelueo;t0s2tmxmpoo1alt  ivta() rtr( pnu0teeoiietat m2rm(mp t)aexomrciy1lpD  uvo;s) 2xoxo3oo1oltelieslt  rraxro;t1olxomi3iysfs um(vs (4 eeoircta1laDranvs s) 2xm(r3oy4optnmnetl(fa2ur( ono1apto oeilsfmDrl(mont4 rxoxrctodom elu ols tetrimpoy4omt lfeiat  Dumx  nu4opeoiiciat mDeauvonu4 eerxo ootfmtelivi t)seumir3iu4apen feta()artmu  oo4aeeomo3ildfaDea( o;u)trxnmf oydfa  auvils teur(r oy1om nmfvslt srtau ono4tltnmfcildfm2rlump t0artrio iodfmD li olt)sruoxo oo4opt mivi s s2rr( oou4olt  o3iat a um(vont0 rxomrcia1lpD lu i t0 eto(r oudolte ietltf Drrx  ot0tptnmictaslmDem( on(0tetrxocoatfmDelnei s0 eum(r3oo1amee ivta( srumuroot1aeeoiictls a2eln p;u0 eermf todlateaivs;( trxoirpou1opt lfctl( s2tru ono4aptomf3iat a2rlnmonu0 etnmo3oy1omDran o;s) etmxr io1omt livsas)sDraxmo;o0oeenmi3iys s2eau s u4aexnif3ia1oaDeluvols)s2trimpou4ap n ieta(faDtmxmo;t0tlenmoctysla2rm(msn(4 rxoifcootopD  iei s trtmxopiodalt mnvi t s2raxm ;u0tptnmictaslm2elnvs;(4 etrmo iadfa raivi;(  rumxo nydoptnmnctat arrmxm nt4tee mf3iydla2ea( o;(0aetoif3oydomte i o (  2xmxopiu1lmeelnvs s)srrm(mo;u4tltnmociaslmDulnvo (0 rxnmo3iadoateli ol() rurir nu4ame  fcilt srtaxr ot1aptomfetydls elnvp u0tlxnxr3oadfaDe n olt0t2xmxr3nudale mivt () Duru oot4apxo oeiatlaDum(vp;(4texrmr3oa1fm raneo s srtrio ny4opee ivsls) Dum(m ou0tpeniociys s rl(vs;t)tlxoio ootopDr ueols  exrxrpnu4amt lnvsl(f rtrum ;t1oleomo3iydls2eluvp (0altrxr3tydfmtrlivs ()srtriopiydomenlnct ( aDuaxrpnu1tlx ioeiyt s umumo;(4 lxnxr oadfptr ieo s0t2trxrpiu1amt  nct ( aruaum ou0tlt if3iydfmDul(ms;t) leniocoytfpDeli i (0 rtrxr3iu1open nctlt)a2ur(m ;o0aeen f3iytla elnmsnt4arxrmrciydlmtean olt)setoiopoo1lp  mnvs s)sDurxmo;o0aexomictyslaDea(ms u)tlenir3io1fp e ieils) eto(r3io1oltn ivt t)sDur(m no1olt io3iltfa ulumsn()aexrmr3ta1omteluvi s) eto(r3ny4aleemfvi ()sDrru o;t0tptniictys s2ranmp t0 rxoxrcoydfmD  iei s0 2uo(m3iodam   nvs (faDtr(m nu4opx  fetat mDrl( s;()aeenmo3io1fpD  ieils)srtmio iodale lfctat)aDraumpnt0optnifciadfmDemuvon() eeomrcto1om  lu i () 2tr(o oodamtelfvils aDrrxr oo1olenmi3ils mDrlnvo;t)trxniocoo1la rlneols0 rtmio iu1lpt mfvil(fartaxm ;t4alxnmieiys s2elnmo u) renxf tatlm r ivsl(0teurxr3ou4optn ivtlt s2ua( onu4aptn oeiatfa2elumpn(0tltnircoy1om e iei t s2xmxopiudal n fviltfa2urxmpou4ale  ictydfm ea(vs () rtoxf3oa1fmDrau s;(0texoxr3nydope  neiltf rum(m nt4apt  feiadla emu s u0altrmf3iadoatrluei t teuoxm ny4amenmnes s  Draur ot1oex iieilslm2uaump;u0aetoxo totfpte nvi;s0setmir oy1amtelnes s s2tmxr ;u4oetoif3tydfaDea(vp u0 ltomr3oydopD  u s;()t2xoxm iudllen ncsl(fsDrm(  no1apenif3ilsfa2umn snt) etomocta1lpD  neo (0 rxmim nu1ope lfvs tfsrrrxr ou0aeenifeiysfs uanms;(0alenmo3ia1omDraieils0sruoirpno4am nmivta(fsDrr(  ot4teenif3iytfmDra( s;(0 ltrxfcoodfmDeaivolt0 euoimpoodopee netatfa2rm( oot1olt ioctlsfa rmn s;u)alxrmrciotfm e i o s)t2xrxrpiy1apeemnci ( s2rmur no4oex  o3tys sDuluvo t0 lxnmfcta1oatraies;( texm(o no1openlfcilt aDtrxm ;t0tpenmi3iydls2ua( pn(4aeeoxo tydla ran s;s) 2tm(o oy1amt  nvt s sDrrxmo;o0tpxnii3iytlm rmn pn(4 rerifcoodfate n s s setrim iy1ome lfcs ( sDurxm ;t1apen o3iat aDeluvpnt) exnmf oydlaDrau slt  rtm(mpoudlm n fvs (  Drrurono4tet  ietydla2eanmo ()altoxo3oydlmD  nes t0t2tr(mpiydole mnctl() Dua(mp;o0oltoioetlslmDrmu on()tltnmr3iy1lp rauvo s0s2toxr nu1am  mivsa() 2tr(r ou0texo f3tydfa rlnvp;t0aetrmf todfpDranvilt0tetrim ou4lm n fctas) 2ua(r nt0oexoioctldls2elnvp;t0 eerifcoodfmDr neol() exoio3no1ome  ncsas)aDtaurp;t4olenmietydlaDea( o;(4 lxoxfcoodopt luei;() 2to(m3nudale  fciltfa2tr(r nt4alto octat m ulnvs;t)trtoxr oytfp eln i (0trxm(r oy4lpeelieils  2tau ono1olx mi3ild s ulumpn(0aexrmocia1lp e uvilt sruoxmpnydam  mnvsl() rumu ono1opeo oeiysla uauvo;(4tltnif3oatla eau i (0setm(opiodom nmivtlt s2ta(m ou1tpxo ictld aDrmu s (4trtomr3tytfmDrli o;t s2toio oydlleemivils arrm(rooo1oeenmfciadfa umu pnt4 renxo iadlptrlueslt) etmir io1op nlfciatfs2rr(m oo4oleo ociatlm ran p u)arxnxocoadop e neo s) exr(o no1openmfvsls)a2tr( ooo1teeomietad a uln p;(0 lenir oodoat luvolt  2tr(opiu1llen ivia(f rtau pot1oltomo3iad s2rlu p;u) exomr3tytfaDeluvs t) rxoxo oydlme livs tf 2tmumpno0aptnioeiydfs em( o ()teerircootoa r uesl(  2umim3no1olenmieils sDtmuro;t4tlen oeilsfa ulu s ()alxnifctotfpDe ivs;()srtmxm3oo4alee fesas)sDtrx o;u0aexnii3iytfa rlums t) lenmo3to1oa rlieo ()trxoimpiy4alt mnvi t) rtm(mooo1tex  fciasfmDea(ms;t)arerxr3to1fmteanvolt0 2uoxr nu4omt lnvsa()a2trurpnu0oee  oeils s2eanmp u)tlxnmfciodfmD  nvs;()teurirpoy1ale  icia()arur(mpou1alxo f3iydls rm(mon(4 eenmo3todlmD lueol()t2um(r iudlmee nvils aDrmum ;u1optomf3tysfm2uauvs u)tetrmf3iytfatraueilt0teurxrpny4apenlfcias)sDurur oo0aex  icilsfa2emu p u0tlenxf3oodoaDrli i;s trurxr3no1ame lfcs t)aruau  no0oexo iciytfm2eanms;(0 lxnxo3totoaDrau o s)s2urxopou1ome lnvt ()arum(r ou4openiictydls el(vs;t)tlenxr3tatlaD ai sls s2umxo iydom emfcsat) 2ra(mpnu0olx  f3ild m eaums;t0artoifcoa1omtr uvolt t2urim ny4om   ies s srtm(m ;u1apx ioetltls elu o t4tetoir3iotfpte uvs;t) rtmxo iudomeelfetl(fa2uau pot4apx if3tlsfs um( s u0tlenxocty1faD ln i;t) 2urir oodlpeemies s srtm(m no0teen ieiatlmDulums t4alxrxr3oy1faD ai s;t)setm(m3iu1ll   fesa()sDurxrpou4aetoifciasls2eaums;(4alxrxrcoadfatelu s t0seuoxmpou1al  lies (fa2rrump;u1tetniociatla umuvsn(4texnmr3oatom eli o;() exmxrpoy1oltnlictltfaDtau ono4tpt  oeiydlmDrln s (0aetrmfcoy1fa ean i s srxo(m iy4ol elivi (f 2urxroot4apxnmfetyslaDran onu4 lenxfctydfmD  u o;t0 rtmxo3io1lm nlnci (faDuaur nt0tee  i3iys sDum(mon(4 eerxfciydfmDeln s s) exm(mpny4ol nmfeias)arumumo;t1oet moeilslmDulnvp;(4teermo tydlm eaivil() exoxo nudoltelicslsfarrmxroou0tlxnmictltlm uau o (4 eeomf tadlpDeai s s) 2umxopny4olenmivt sf rua(m ot1apx  o3ias m2rmn s u)aetrmf3iydfmD livs;()t2tm(m nydamenmfcsa()sDtaur ;o0tleomfciyslmDra( s;(4 rtoxr3oa1fpD  nei (0setr(opio1lpe mnvs t)aDua(rpoo4opx  octlt a ul(vs t)altnxrctadfpDr i ilt)sexmxo3oo4olenmfvtasfaDtm(rp;u0tpxoio3ildfs2eauvs t0tltnxr oa1lm r nes;t) rumir3oodlm elfcs t) rrax  ot1alxomfctatlmDum(mp;t0 ltoifctodoat  ieol()srxo(m3nydll   iei t)arrr(m ;u1tet ii3iydlmDumump;(4trermf iadoa rluvsls)setrimpoo4apen ici (  rrmumpot4tltomieildfa2uaumsnt) lerxf3iodlateln o;s trxmxmpio1ll   neilt  2raxmo;t4tpto ocils s el(mp;t) etoxf3to1oaDrluei (0trxr(o ny1ll nlfvtl() Dumur nt1altnmfeildla2umnvs;u0trtnir3ty1la r ivi s0t2xoirpoydal elfci t)s2umx oou4aleo i3ias s rm( snu0alxnifcia1faDeluesls t2xmxr3no4apt mfeilsfa2tmx ooo1aex  i3iltfmDrl( pn() ltoxf oy1fmtr i s t0t2uoim oydaltnlics t srurxrpnt1tpeomf3tatfa ean p (4 lerir oo1lm eanvo t)sexoxmpou4lm emncilt)s2ta( p;u0alxnmoctlsfm elnmpn(4 lenmociy1fpDraneslt0s2toimpoudome lfesltfsDtaumont1olt  feild a el(vs;(4artoir3tytlmDr n ils)s2xrir oo1ape  neil( srtrur no4tlenmfeiltlm uauvsn(4 exomfctydlmDrlues t sruoxm iy1ome licslt)arraurp;t4tlx io3iys m rlump (0 lxomr ta1lmDr nei s t2urir iudlmtn ict t)arrru ooo4tpx mfciysfsDea(vs t0arenio3totlpteai s;s texmim nodlptelnvslt sDuru pno1oex mi3iydfa2rau o;u4 exnxr3ty1oatr nvs t)seumxr3oy1lmtnlncsa()s2uaur oo0aeeomoetasfaDua(mp u)teenmocio1om  liei s0setmirpoudamt lieilt arrm(rpou4olx ifcildla2rln s;()tleoxf iodfate neilt t2urim3nydopenmiet ()artmx p;t4tpxn fetadfs rmu s ()altnxr3ootlm  aivo;t) exm(m3iy4openlieslt)sDumu pot4aeen i3tlslm2ul(vonu0aleomr oa1laDeaueilt)srxo(o3io4optn fcsat s2rm(r oo4optnioetlsfsDrlu o;(4alxoio3totlmD  n i;s  etmxopnu1ap emfcs sfaruax  oo4aexo oeildfa2ra(vs;(0 eeoir io1lat aies;t)texo(m ou1om  mictatfa2rmxrpot0apeo f3ild mDel( p;t)trenioctytlat auei;t seurxr3iu4olenlnvs ( aDtru  ;o0tltn fctat a uluvo ()tltrirciydlaDeaivo;t  rtoxm iu4alen nvi () Dtrumoot1aeen ociasla ulnvs;(4 eenxf3oodlpt aies;( t2xoim no1am  mnvt tfsDum(ro;t4olxoiociadls uanvs;()tlxrmoctatop  aivo;s srurxo ou4olen nvta() 2ta( o;o1opt  feiadfs raumsnu4aeeomfciytom rlieo;(0teuoirpnudlmtnmfct (fartru poo1tetnmf3iysfs2rm(mp;u0texriocto1lmDr i o t t2uoim3ny1lltnmicil( srtaurpnu1oeenmf3ilslaDel(vsn(4 lxrir3iytopteauei t  eur(o3oo1amt lnci ( s2ururp;u1oeenio3iyt s2uauvpnu4 rerxf3iodlat  nes;t0teuriopoo1ole lnet ( aDtax p;u1oeeomfctatlm2umu p u4 eeomo3tadlaD ai ols) rtm(o oy4amte iet t  2uaxrooo1aptoifeiytfaDul(mo u0artrif3tadfpD au i (0trxo(m3oodamen neia(f rrau ont4openii3iad a ul(vp;u0trxrmo oydfpt luvols)texm(m3oo1lltnmnvsatfaDua( poo0tpxnmfcias s2um( on(4tleoif3tatfmDr ivs t)trxmiopoodapte icil(fa2rmxront0tltoii3iysfm ranvonu0 etnmr oatoaDrli s t)s2xm(m oo4olteliciatfaDumurp;o0tex ioctlsfm2ua( o;t)aexoxo tadop r ues t0 euo(r ou4open ivsltf rua(r ot1aexnmfeiltfa2elu s;t4teermfcta1omte nvils0t2xmir iydameelictls  Dua(ro;u4tex micils s2ul(vsnu0 lxoxo3tatfa e ueo;t)trxo(m oodal   fetlt arrru  ot4tpt  feiltlm2rauvs t0 rtoir3oatoaDeanvi s  2toir3nodapt  fei sfsDra( oou0ale  f3tltfaDuanvs u4artnmf3tydoat livil() etrio3ny1am e fciasfsrtru  oo0teeoifciydfm emu on(4trxomf totomDeanvs;( srxrxr3oudlmtelfcslt) rtmx  nu1alxnifeilslm rauvp;t0 exrmfctatfaDeli ilt  rxoirpny4om e neta( s2trxro;u0opxnmfetlt m elumsnt4 etrmr3tytfmt luvol( s2xm(o3no1al e ivils)a2rau  no1aptomo3ils aDum(vs u4alxoio3ty1lm rlu o t0teuoiopou4om  miesat)s2rmx p;u4aeeomieilslmDra(vp;t4texrif3tytlmtrauvils0 2xr(o oy1lp nlneiltfartmx pot0tpe  ietysls2em( p;u0aeerxrcia1fm r nvolt) rtrxr oudlptnmiesas) Drru o;t1aexomi3tadfa2eanmpnt)trxoxrcoa1fmtelnes;()seur(m3oydlle mfct ()sDta(ro;t0oeeoifciysfmDeaumo u) eenmoctydlaDr ueilt0trur(m3io1am e iesa(f Dta( pnt1opxomoeils aDemu s u4aleoif3io1om rln i;t) rxmxr iodapenlfes ()s2tru pou4apeoii3tydlm eaumo;()trxomrctadla eli i s) etmiopoy4omen ivs (fs2raxmpnt0tpt ii3iys a raumo t)aeeoxo ta1lmtraivs;t  2umxm3nydameemnciasfsrumu oot4oexoifctadls rau o t4 lxrmf tatlmtr nvs (0 2trxopoo4ll nmfcs () Drax  nt1oetnifctadlsDelnvs t) exrmrcoatlptelu s;(0 eurim io4ole livs tfaDuax poo0tle mo3tydls2emnvsn(4trxnxfcty1oa e nvs ()teumxr3iu4ap  liet t)a2ra(mo;t4teenifciadfm em(mp u4tleomfcio1omD  uesl(0 euoxrpoodaltemfcilt sDtaxrpoo4aeeo oeiadla2rlu p t0 eenmr3tydfp ranes;() 2uoiopiodomtnlivsl( aruaumont0aleomocildlsDean s;t0 lerir3tytop elneilt srxmimpou4oleemnct s)srrmxm no4opx ioeiytfa2ea( pnu4tlenir oo1fpt  ivo s t2xo(m ou4ape  fvilsf 2rmxro;t1oeeo ociytfsDel(vp t4trxnmf3iy1fp r i o ( trtoir3iy4lmenmncias  2um(mooo4aetn fciatfmDran pnu) rtoio tadoptrauesls)t2trim3iy4al elivsa(fs2rmxronu0aptoioeiltfa rau o (0trxoiocoy1lmteaivs t0srxoxo3iy1apt livt (faDrrxmoot0tpen feiltfs2uanvonu) rtrxrciatlmtrlneslt)tetoio3no1opeemivsls arrax  ot0aleo f3iad aDemuvo;(4trenmr3oa1lp r ivsls)t2uoxopoy1ol  lnvtlt arrru  nu0tltnmieils a2emn snt0tlerxo3oydlat an s t t2trimpoo4ome miet () 2taum ;t0altoifeildls rmu o;(0 lenxf3ta1fpt  u sls0 euoxrpiudolt mneia( srrmu  ou4teeoiieils m emn pnu0trxnxr3iotoat luvo ()teuoxr3no4apeemivsas srum( onu0texo ieiad m rl(mpnt)trxrmr3iadfaD anei;t  euoirpnodam n ietat) rua(mo;t4tle mf3tat s2umu o u0texomo3tadom elnes;s) 2xrimpou1altelnei (f ruau  nu0aptn fctad m2ul(mo;u)areoxfctydlpt  nes t)sexoir oo4op nmivta()s2rr(  ;u4alx mfciatla ea( s u0areoxo3tatop   ies;s0s2xr(mpio1op nlfciat s2tru o;o1apt  feiytlm2rl( p;t)alermrcta1faDeaneil( setrim3oy1ome  iviltf rrm(mpnu1opt iictlsfa rmnmp;t) exnxf3oatoateln o;s0srumio3ou1llt  fvias)srrmxm ot0tpe  fctas m um(vo;(0 exomo iadlm elieo;s srurimpnydlmtn ictl( aDtrxm nu1olx mfcilslmDul(mo u) leomf3iotfp rlies (  exrim no1amt livsls) 2rm(mpou0aeeoif3ildla rm( p u4aetomrctadlatranvi;(0trxrirpnodlpenmici sf Drau pou1apt if3ias a em(vo u4trtrmf3oa1fp elnvs;() 2umiopiu4omenlies tfarumurpot1tet  o3iltlm ulnmonu4trermrcoa1lat  u o s) eurxo3iudop   fci (  rtrurpoo4alenioeiyt sDelumpnt)trxoifciydop  li i;t0t2xo(o no4op n icslsfa2urxro;t0tptn octlsfsDumuvs (4teermociatfmteaivol()t2xoim iydamtnmnctat sDuax onu1optnioctat a uan p (0aleomrcoodfp  luvi;t0 euo(r3no1ol  lnetlsf Dumurpnu0aptoiocilt a2elnvo;()tlermociytlat lueols0 rtrim3oy1op n nct t)srrrx  oo4apeomiciyt m2elu p;u4aexoif iy1laDrlnes s0s2uoim oodale  iei s  rumur ot4olxn ictasla ra(vsn(0trenio3oatfmtrliesls  rumxopoo4aleemnvslt sDtrxm oo0alenifetlsfsDul(mon(0 lxoxfcoydom e n i;s0trtrxm nodlmtnmfvtl( srrrumpou4tlxnmoeiadlaDelnmpnt0 renmr totlp elnvo ( seurxm iu1om e fvt tfsrumxr ;o1opx moeiadlsDranms;t0 eermrcoatfm eaues t  2trim3oy4alenmfeilt)arrmump;t1oleomfciasla ulums;u)aetoxocto1fm  aiei ()trum(o no4ol nlfct ()sDuaum ;u1aeeo fcilsfsDeluvp;u4 eenxf oadoaDrauvils0tetm(mpiydam emfcsl(f Drm( poo1tpxo i3iyd m2el(mpn(0tlxnxo tydfpD lnes;t0 rurxopiu4op n fes t  2umxm nu1opeo f3iydlsDeaumon(4 eeomr3iatopt luvo t teumxm3ny4lp  licsl()aDtaxr ;o1tltnmi3iat s rmnms;u)trxoxfcta1opD  uvo t0 exr(o oy4ame  ivt t)artr(roou1alenmfeilt m el(vp t0artoxfciotlmtrlnes t s2xrxm iudll   nvtl()sDua(root4opxo i3tltls2ul(msnu4 etrxo oo1op   ivols)s2umxo3nodamen fes (fsDrauro;t1apt  iciasfs rluvp u0aeeoio3ty1lmtelnvs;s0 rtoxo3oy1ame liei s)srrmxro;u4oeenmi3tadls2ulnmp;t)alxnmf3oydopDr ieo;s s2xm(mpiu1lmte fvta( aDrmu ont0aex mietasfm2ran ont) reoxf3tatfp rli i ( s2tmxr3ou4ap nmictat  rum(mpot0oee  icilslmDuan o;(4alxomfcoy1omD aivslt) 2xrim3oy1lm elfci ()sDur(  ;o4tpx  i3tls m2ea(vpnt0aeenmr3ty1oaD  ivsls teum(o iy4ll nmncta(f rta(ro;o1tet mf3ilt s elumon(0trxomocio1laDelueols)seum(m3oo1lm  mieilt) Duau  ot0apt mf3iatlm2ua(ms;(0 ltrxo oadfmD lneo;()t2umio iy4llen ies tfartrxmonu1apxniieilslaDranmo;(4texrxr3iotop  aivil()sruoim3oy1omt  fvtasfsrua(mp;t1aetoiociad sDem(ms t4aeeoiocoydfpteau i;( t2xo(r3oo1aleelivtasfsrtax ooo1tlxo fciatla uaumonu4tetnxf3oo1fmD aivol(0srtrxo ny1apt  ivsa() rurxm ot0oeeo ociatla2ra( o ()trerxf3ty1faDran s;(0 ruo(m3nu1op  lnvtltf Durx  nt1tet mfeiydlm ra(vp;u)tleomfciy1om e u o s t2um(r nudap  mfes ( s2urxr ;o1apxomi3tlsfmDumnmpnt) lxnmo ia1fa r nvi () exm(o oo1ole  ieta(fartrxmoot0tltnmocildlm elnms;u4tetrxoctadla e ues ()truoir3iodole mfesas) 2ur(r ou1tpx if3tyd m uauvs;u4 exnio3tadlaDelnvo;() rxoimpoudlpte nctls)aruaum ou4aee ioctldfm2uln s u4 rxrxocia1opD anei;t s2toxm3oo1aleelnetl(fsrumx  ot4alxnii3tlslsDrm(vsnt)areoxr3oa1fp  lnvi;s)seumirpoo4op emnctltfaDuaxr ;t1oeto oetltfsDuluvo u4arenir3ta1lm elnvo t) rtoxr3iodlpe mneia(fa2ur(mp;o0olenii3tyslaDulnmp;()aetrmr3oodfptrli i;s  2tmir nu4lptelfet s  rrru  ;t4oltn f3iyd s elump;t)tlxoxo3io1om eli olt  exmxopoydalenmnvsatfsDururo;o1tet iocilsfm2em(vo t0tlenifcoydlpDrlnvslt t2xmimpiodoltn ncils)srra(mpot4apeo fciatfm2emn ont0 leoir3oodlp eaueo;(0trtrxr3oy1olen fvi s)aDtmx oou0alx  o3tys m2rm( onu) rxnmo3to1lp e ueo ()t2xo(m nodlmtnmivtat)sDururpou1oltomo3ild s el(mon()texoxfciadfp elies;t s2xmio3ou1lm emncilsf 2taxrpou4alxn fctadla2elu s;u0 leoxr ia1lateauvi;s  2trio ny1llt  fvtas)s2tmx pou0tlt mictysfsDul(vo u4texnmo3
\ No newline at end of file
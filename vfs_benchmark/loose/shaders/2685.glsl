@@ -0,0 +1 @@
+n i;s  2xoimpiydamtelfci (  2tmumono4oleoif3iytlaDelumpnt0tlxnio oatoaD  ivols)sexriopoy4ame mfvs tfa2tax pnu0aeenifetatls2um(mpnu4 ltnxr oydfaDeln s;s srtm(rpoodlm e nci t)arurur oo0tlxo feiasfm rmnms;t)tlenxfciatfm rluvo s)srxmxrpoo1lpe lieils)aDtrumono0olt  fetadfa rmnmo;u0artoxr3ta1oa rluvsls)tetm(o3oy1ape mivta( sDum( pnu4tetnii3taslaDumuvsn()aetnxf to1fat lneolt s2xoim3oo1ap  livtas) rua(ronu4tee  ietls s2rm( s (0 rxnxf3tydlpD ln olt  2uoxmpiy1apt mnesasfsDuax p;t1optn ieilsfsDrl(vpnt) exoircoydfaDe n s;t0texoim3no1alee iet s  rtmum nt1tlx ii3tasfmDelumont4 rtrio tydoa  luvi;t)sruoir oodalt  ieiatfs2ua(rpot1alxoii3iatla el(ms;u4texrir3ta1opt liei t0 2xr(r no1llte fvs s sDrax p;o1oee  o3tyslsDemn o t0 rtrxf3iodfa eaivslt0setoxo ny4olenmnvi ( aruaxmont1tlx  fetat a2emn o t0aexoxrcty1laDr i i;t  rxrxr3iu1lltnlnctatf 2tauroot0aeeomfeiydfs2rlnvo u)trxnxr3todlp rli o;()teuo(o3iy1apt liei ( aDum(ro;t1aptn icilsls2uaumo (0trtnxr oo1opte i o;s0sexmio3io4ll   ncils a2rmumont4tet ifeiyd a2elu p;t)teerio3oa1oaD an s t)s2xo(o3ou4lp elics s)s2ta( o;u0oet iiciysfa2em( pn()alenxo tytlatrln s t0t2urio iodap elneilsfa2urum ;u1aleniicilt m2um(mpnu4 rxnmfcoodfmt li ols)texm(o3ny4ope  neilt  rtr(  oo4aeen icildfm rl(vs t)trtnio oydfp eaues s trumxm3oudllen ieil()sDrmu  nt0tleo feiadfsDrmn o;(0aexrmo3iydoaDe u i s seumxo iy4olenlfei t aDum( p;o0oetoif3ilsfs2emn o u)texomr ootfpt lues;()seuoxo3ou4ame  fvi ( s2uaxr ot4oexn fctadfaDrmu pnu0arxomo oa1lp rlnvol( srurxmpiu4ope mnvsls srtm(m nt4aex ioetaslaDuauvo ()trtoif iotfmDeln il()srtmxmpny4al elieias)s2ua(rp;u4apxo feiadlsDran o;(0trxrif3to1oatr i o t  eum(m3oy4am nlfvtasfaDuaxmpou0tpe mo3ilsla2rmuvpnu)artnmr3totopt  ieols0trxmimpoydlp   ivta( a2tr(rono0opxo o3tadfa uluvs;u0trermr iatoptr ueo () rxmxm nu4lltemfci (f 2ur( poo4opxnifciat a um(vonu)artoxr tydlpt anesl()teto(mpnu4omtn iei (  rtr( o;o4oetn feiltfaDuau on(0 rtnxfciydfmt au ilt0s2xmimpio1op  mnvias  Dtaxrpot1tex  ietydfs umn p (4 renmf3iatla   uvols) 2xo(opou1lpt  netlt a2ta(  nt4oetniocildls ua( p (4alenxfciodfm   uvols  rxoxm oodoleemivsls srurumoot1oltoii3ildfs eanvsnt4texrxrciatlateln sl(0 rxoirpnudomtemnes sfs2tmxm no4oet ioeild m2um( s;(0aexoif3todopD lieols0 etrxo3oo1ome mics t)aDtmu o;u0tpx ifeiys sDuanms u0 eermo3ia1lptrau s;(0srtmiopiu1openlnciat  Drrx pno1oexomo3tlslm2ra( s;(4 etnmfcootlaDr ieolt0 rxm(o nu4oltnmnei ()a2rr(rpou4tpeoif3iys mDran p (4 lenir3tadla elnes;s0 exmxo oodome  ncta(fa2um(mpno0tleoii3iys a ranvsn()aexrircto1fpDelu sl(0srxrxo iu1apt  fes (farraurp;t4tpx  ociys aDrln onu0trxoio tadfa r u i t s2tr(rpno4apte fesas) Dtmumpnt4ale  iciltlm2ea(ms;()tlxnir to1lp ran o;t  2umirpny1lp emnvt s)s2umxr nu1tltniiciaslmDumnmp t)aeeoirctodfmDranvs s) ruo(m3iudlmtn fet t)srtmurp;u4olxn ictatls rmu sn(4 exnmfciodfptelivolt  eumxr ny4lp nmnci sfsDtmump;u1tetnioctat s rmums;t)trtrxr3iydlp elnvo () rtrim ny4lptemfeiat)s2rrx o;u0olxo ietysfsDrlnvpn(0trxomf tytomDeanvolt0setoxo no1lpe  fvi ( arrr(m no1aleoif3iadfa2rluvo;t)aetomr3iytlpDelieo (0seumxm ny1lpt lnctas s2umxr oo4tpx  fetyd aDemnvpnt4teerifcoy1oat  uvi (0setoxrpio1apteliet t  2umu pno0apenio3ildla uanvonu0 rtoxf3oydomtelu sls trtmim3oudapt lfviat a2rmxr ot1texnio3iadfsDraumsn() rxrir oadfmDrai olt0setrim iy4lmt licta()sDtau p;t1tee  fcildfm rlu snu) rxomocoodlmD auvsl( trto(rpiy4opt mfvsls)arurur oo1olxn ociad sDul(vonu)artrif tatfmtrlnes (0 2tmir ou1ape livi sfsDum(m ;o1oetnmfeiadfmDemuvs;t)tlenxf3iodlptrlivo;(0 2tm(m3oydam n nvs tfs2rr(rono0aetomo3tat a um(msnt)trtrio ootla e ieols0 rxr(r no1lm emicias sDtm(  nu4tleoioeilslm uluvpn(0alxnir3oodoa  aieils)t2xoim3io1ap e nvt (  rtr(m ;t0aee mf3iasfmDel(vp;t4areriocty1fmt  ues ()s2tmxo no1omen fetatfsDrmx o;o4ope mociydla2rmu s u)treniociy1lmD  nvolt0texriopny1llenlicias  rur(moou0oeen o3iytls2eau pnu)artoif3iadlmtr i olt0tetr(o3iu1openmnct t) Dua(ronu0teenmi3iys a2eauvo (0aleoif ia1omt lneils)t2xr(o no4lpe lnes s) 2rrxrp;o4tpe  i3tls a rmuvo;(4trermf iodlptrauvi;t srxo(o nodlleemici ()sDuru pou4aetoifciytlmDulu p t)tltrif3oadfpD  iei;() rxrim iy1apeemieil(fartm( pot4oeeoii3tatfs2rln p u4 exnmoctotom ean s (0s2trir no4lmt lfetas)aDrrxmpot1tltomo3tadfsDrmn p t0alenxfctatlpte nei;()s2uoxm oy4lme lfet t)arrm(mo;o1ale mfeilsfa ul(vsn() rxrifciydlm ean i s trxm(m3oo4ol nmnvsl( srua(mo;o1ope mieild s2eanmpnt)aeenir tadomDeln s (0srxmio3oy1omenlfes ()s2ta(  nu4optomiciltfaDuanvo;t0arxoirciytop e ues;t0setoir3ou4optn nciltf Draxmpoo0tleo octlsfmDum(vp t) rxnmfctodopD ln i;s0srurirpiy4llenmnctls artm( o;t1ape  octytfaDemumsn(0 eeniocta1omteau s;( s2xmimpoo4lltelfet t s2rm(rp;o4opxn f3iadfm2ul(vs (0aeenmf ty1lmD an o (  rtoimpno1lmt lnet t)s2tr(  no4apt ioetydlmDumuvp;u4tetoio3oydomDrlueils0trxmxo iudlp emivtlt)sDrrxr oo0aetn fetlsfa2ea(vo (4tltrmocoo1oate i i;t  2xmir ny4lmenlnvil()aDraurpoo1apto iciadlm2uln s;t) etnirciatfmDr i o t0srxmxm3nudlm emnviasf 2umxmo;t4opt  feildls2um(vs;(4tltnmo ootlaDe i o;(0s2trxopnudop   ietatfarur(r no1aex mfciatfm uanmsnu4trxnmf3iytlp   i s (0trxm(opio1op nlncsls artmxmpnu4aexomiciytlaDelnvsnu4tltrxo3totlp eanesls0truoir3oy1am emfes t) Drrur ou0tet  fcilt aDeauvs;(0trtomf3ia1omDr n s ( trtr(r ou4lmeemneils  2tax oot1opt  ocias s2umuvs;t0 etoxrctotomtr i sls  2xrio oydlp e ies tfsrtru  ot0oltoio3ildfmDul( sn(4trxnifcia1lat au ol( texmxo io1ape  fctas aDtm(  nu4opxn ocildlm umnmo;(0arxoxo oy1lmD  nvs t  rum(rpoudop emnci t  rum(r ot0oex  o3iyt m2ea( pn()tlenxf oy1lpteaivi;s tetoio3ny1ome lfei (f Drax  ou4aexnmiciyslmDrm(vpnt0 exnirciytfmtraneolt  eurxo3oy1amte ietls srtr(  ;u0aexoifeiasfsDemump;u4tltnio3ty1oa rln i ( trtmim oydoptn ieiatf 2ta( oou0olxo fcils a2umn p t0altnio3totfp  lueolt texmxm ny1lle  fct (farururont0opxn fctadlm2ra( sn(4 exomo ta1lmDe nesls srurimpno1altnlivs (farrmx pot0tleomf3iyd s rmnmp;()alxrif iy1oaDr i o ()srtoimpoo1ole mfctl() Dtmx pnu4tpxomf3iys s raump t0tetoxocta1lmteluvi;s s2xrim3ou4ap nlnct t) Draur nt0tlx mi3iadla2ul(vo;t0 rxrmo3iotoa  lnei;s0 2toxopio1om  miviat artr( o;u4oleoiicilsfa2ua( p;t0texomr oytla e uvils0srtoiopio1optelnvtatfartru  ot0aexnmo3iltfsDel(mo u)aetrxocoadlaDr ies;s)sruoir3oydoptnmivtas a2tau pno1tpt mi3iydlsDran p;t4aeerio tadlatrau slt)s2tmxrpny4omt mnvs s s2ur( ono0apen o3ils s emn p t0trtrmr3oadomDr ivo;t s2xm(o3oudamenmicsl( srtruront1ole moeiaslm ul(msnt4 exomo oydlpt  nvo;s)teumxm oydop elicsls)sDtaum nt1aptoiiciatfsDulu o;(0altnxr3tydfptrlivi;s0t2toxopiodoptnlfvt s s2umx o;t1opxnmfeiysla uluvont)trxrmfctatlmD ln ilt setoiopiodll  licsat) Dum(m nu4texomo3tlsls umu ont4treoxoctytlp  li i t0s2xr(m3oudlp elnvi ()aruax  nt0tlenmoetadlm2umnmp () lenxf oatlp  auvo;t0s2urxm ny1op nmfvs s  2rr(mooo0tpt iociltfa2uln o (4 renxr iatfptelivilt)sruoio iy4lpenmncs t a2uaumonu4olx ii3iydla2eauvp;u)aeeomo iatlpD luvols0 2xmxm no4ll nmnciltfa2um( pou4oet  fetytfsDem( ont0alxnmr3iotlpDraieil(0teto(o nodlp e ies s) Dtm(m nt0oeen ieildfm rmu pnu)alxnmfctydopt ai slt0teuoimpiydap e ies t)sDumx pnt4oee io3ils m rluvpn(4tleoif3iatoa rau il()t2xrxr3nu1lp  mnvtlt sDrrxm no1tle moctltfaDulnms;u)teerxrcia1lptr u o;s) rum(o iu1ol  liei s arumxmoot0alx  f3tatfs eauvpnu)arerifcoytfmt au i;( trumxr ny4amtn iviltfs2tr(mp;u0aet  iciadls ra( o u)teenmr3ia1fm r u il()texoxo3iydlm   fvs t srrr( o;u0opx mocilsfmDeauvsnt) lxnxr iytom   u slt  rtmxrpnudapenmfesa( aDurx onu1tpxoifeiyt a rln p;t0texrirctodoateaivs s) euoiopiy1ale  ieil()srtru  ot0oee  ieiad mDeanvo;t0 rtriociotlpDrai i;(0trxm(opnu1lp emnet (  Dtr(rpnu0teen i3iyt sDrln pnu0trxnmr iatfatrli i t0trumirpou1lmt  fvtls)srtru  nu4oet iiciydla2rm( ont4trerio oo1fm  lieilt)t2xo(mpoydal nlivslt)srta(  ;o1aeeoifciat m2rm( o;t)aeerif iodopDe i o () 2trim3nu1lm elfeta( s2rru  nu0teeomo3iltlsDuanmonu)treoif io1laDelnvi;s)s2ur(o3ou1omt mfcil()a2umu  ou4aleomieiysfm2emump t0 rerxr oytlm e uvs;t s2to(m iy4om  mictl()s2ra( pot1tlxnmfciydlm2ulu on(4arenxocty1omtrlieo;s0trurir oudamt  ict (f rtaump;u1oltomfetyd a ulnvs;(4artrxf ty1lmDr ivol(  rxo(opiy1omenlnvia( srrmu ono4tpenifciys aDum(mpnt4tlxomf3to1lmte ueil(0 rxrxopnodlpee iesa(  rtrurpoo4aetnioetls aDrlumon() rerir ia1fpte u olt0trtmxmpoydalt mnvia( srrmxmo;t4aexo oeiasla2rlu o;u4aeenioctytop elu ils) rxmxmpoydopen fei (fsrrrumpnt0oeen fciasls2ea( pnt)aexoxf3tytomDrai i;s)teurir3io4alt  ncslt)aDra( p;o0tlen ieiadfa2emu snt)aexnxo oo1opDr nvo ()s2tm(r no4lptn fetas a2uaump;t0apeo i3tyt m emuvo;() ltnmf oy1fm  anei;t)s2tmxo3nu1ol nlfcsat)a2rrxmoou1apxnmo3iad mDra(vp ()texrmf todomDrlnvo t) rxmxrpoo1op n icil(f ruaxmonu1aee iociad a rau s;t4aetoxo io1oatrli o t0setoirpnodlmtelnesl()a2taxm ot1aee ioeiatfs ea(msnu)aeeoiocoydfmt aivolt)trumim3iy4alenmicta(f 2uaumo;t1tpxn oeiys mDua(vs;u0trermf3oo1op e n o s0tetoio3ny4amt  fctat a2tax pnu4oltnmiciaslm2umu s t0alxrmoctytoaD  uesl(  2tmimpno4om elfetatf rua(mp;t4opx  octltlsDum( s u)trtoir iotfa rau slt s2triopoy4llt mncsat  2rru  nu0tlxn o3iat a raumpn()tetoio3iy1oa e nvils) rumirpoo1oltelietls)sDra( onu4oexn ietldls emn s t) rxnxr3iydfp  lnesl()trtmxm3io4amtn nviltfaDrrum oo0aeenmoctltls ra(mp (4 rtrmfciatfp  ai i;t)teuoirpio4olt  fet sf 2tm(  nu0alx  iciadfaDemn sn(0 lxomf oydlp e n i;t0 etoim3nodlle lnvia(fsDua(rpou1tleomo3tlslaDranmsnu)texnxoctadopteaivils) 2um(mpou1al n ictas)srrax o;o1apx  o3iysfaDeanvp;t)tetnxo3tadom e nvi ()srxmiopou4ol  lfeil()s2umxrp;o0opx iietytfs uanvo;(0tltnmo3oy1faD livolt)trurio nu4omt  fvil() 2taur ot1optnio3iatfmDran onu0 exoir3io1fmte uei s)srtr(opoy1alenmnetat) Drrxmpno0tlto feiydfs2ua( p;()tetnio3oytfmt  ivslt)t2xoxopoy1lp  lfviasf Drrump;u1oeto f3ilsfsDraump (0 leoxo tytoat au i (  2xoxm nu1lpee icias arua( o;t0apxnmo3iytlaDrmuvpn(0 etomrcoa1fptr i i;s0 2toim iudol emicias  rtaur oo0apxn f3iytfa um( p (0altrmo todla eaueo ()s2to(m3oodopt  ies s)sruaxm nu0ale mieiat m eauvsnt4 rtrifcoatfaD  u ilt0 rxmim oydole mnctatfsDrmumoot1aptnmoeiytlm2emnms u4 rxnxrcoadlmDelnvi t srto(m no1ome  netl()s2rm(root4oeeoifetltlm elnmpn(0arxoirciydfptelnes;t0 eur(o oudoptn nctas artax pno1olxo o3iydlsDemumsn(4tetrxociodfa r n i s) exmxm3oy4alee ictl(  Dtm(mpno0olxn i3tlsfmDumuvs;t)artoir iadlmtranvolt  2urxr no1om elicsas) rur( pno1ale ioctad s2eauvp (4alerxr ta1fateaiei;s0t2toirpoo1lp elieia(fs2tm(r ou1optoiieiat m2ea(vo (0 ltomrcto1fmD  u o t)sexoimpio1ole licsls)a2trx  ot4apxomoctytfs2elu o t0arxnxfciytomte i i t setoio no1ome lfctatf 2tmuroou1altnmf3tys s2ea( s t4texnmf tydfpteaieo;(0 rxrio iu4apeemfei s)aDtrx  nu4oeen o3tasfm ranmpnu0artoifctodoatelues;s  exoio3oy1ol emfetas)aruax o;t0ope mociasfs2ra(mon(4treoxr io1oa eai ils)t2urxmpiydalt  fvs t) Dumu  nu0tet mieildfaDuanvo;u) rtoio ootomtrlies;(0trurirpio4am  mfvt ( srrrumoou4tle  i3iydls2umn o u)aetoif3oytoa ranvs ()trxmxm nydamt lieias)srrr(mp;o1tlxo i3iydfs el(mont0aetnxr oa1omDranei;( trtrirpno4lleelnvsl(f Dtrx oot1tpxniiciytfsDeluvpnt0 eenir3ta1oaD li il(0teuoxr3iudlm   fci s) Dtm(mp;u1ale mfciltlsDrlnmont) rtomo3ta1laDr ivs;(0setriopiodolt mnviat)sDrm(  ;o4aexnmf3tldlm2el(ms;(4alxnir3tytlptr nes;()srxriopno1ameemfct t)arrmurpno4aeenmf3tadla2ranvsnt4 eeoxf todlp rauvo;s)trxo(o3oydolee nvtl( aDta( ooo4aexnmietlsla rlu p u0 reomo3oytlmte ivslt)texoxm iu4ol nmnesasf Dumxmonu1opxn fciaslsDuan o;t)aexnxr iadfmDrlnvo;t0trtr(o3io1op  lies ()arumu  ;t1tlxnmfetad mDuanmpnt4aetnmfcia1fp   u ol( t2xm(r io1omtn ies (farrrxmono0olt mf3tld mDrlu s;u4teeoxociatomDrli ilt)srumimpnodlp  mfeia()aDrrxro;u0tltnmociatla2ean s;(0aetoxr oatlpDelu sl()srtmxm3oodlmenmfctltf Dtmumpnu0alxoiiciyd a2rl(vs;t4tetrmf iy1op eau s;s)srxmxo3oy1lm elfei ()sDurx  ot4tpxnifciysfm eluvpnt)alenxf iadlm rlu i;s srtr(mpiy4oleemnes s srumxrpnt4tleniieild a2ua( p;u)teenirciytlm  auesls)t2xmimpoodopenlfvt s  Dumxro;o0tpeo ictld s umuvsnu0tltrxf tadoa   ieo;s)t2to(m ou1omen net (fsrtmu pno0olxomo3tytls2eanmo;()aexnxf oa1fpD  nei;s0sexmxm oodapee nctls) rtrur ;t1tltnmo3iysfaDrm(vo t4 rxnmf3oodomt aieol(0 2xo(r3nydamtnmivtlt)aDtr(  ;o1apt ii3ildfm ra( p;u4arxnmr oadla  aies s  2to(m3nydlmee neia()artax o;t1alt mi3iasls2uanmpn(4arxnir oatlaDeluvs t)trxoxm ny4lpe  feia() rtrum ot1olxn o3tyd a2uaums;u0arerxr ootomD  n s s)t2tmirpno4amtelnvs t sDrmxrpnt0apt ii3iasls2emn p;(4trxrmo3iydomteanes;(0 2tmxrpiydope  fvtlsfsrtmxrono4aex ii3ilsfs2uau ont0 rxnxr ia1fpDr ieslt)s2urxm oo4optn fcsas)srta(rpou4aptnioctadfs2el( ont)arenmo3ootfmtrlneo (0trtmimpio4lpenlfvt t)s2tmu ooo4alx if3ild a em(vp t4 etomociydomt livo;s texr(r oo4ap nlfesasf 2uaxrono4tet iiciytlsDul( snt4alerxr3io1fp rai sl(0 etoxm3ou1al  mfeta() 2rm(mo;u4opeomo3iydla ra( s;t4aexomr ty1op   u i s  eurim no1apenlfcias arurxr ou1aex  ieiytfm rlu ont4 eenio3io1lat  uei;()t2xmxr ny1lpenlfvs s) 2rm(mo;u4tle mieildfaDrlnvo t) rxnmrctodom   i i;s0texmxo3ou1altemfetat)aDur(mpnu0openiociadfmDranvp;t0 etniocio1fm e uvo (0tetmir3iodalt lfcs t  2ua(r ot0apeniiciydla eaumon() ltoirciodom eln o t) 2xrim3ny1lme lnct ()srtr(r oo0aptnmo3tysfs ul( p;(0 ltoirciatla eanvil( teumimpoudapt  nvil( s2rm(rp;o4aexoiieiad m emnmo;t4 exrir iydfa rau i s)teum(opoo4op   iei s) Dtr(  ot4alenmfetyslm2rauvpnu0aeenir3ty1lpDeaneil(0 eurir3nudame  ivtat a2ta(r nu0optoiociadfa2uau p;t4alenxo3iotfmDeln ols0seumir iy4ol nmivtat) Dtm(moou0opx  ociys s ua(vs t4 leoircty1lpDe ues;s0 2trimpnydam nmnvsl( s2tau p;u0tle iieildlmDrau p u0tetoxo3oydfp  lueo;(0s2urxr3iy4lpen nei s aDtaxroou0tpe mf3iysla2rauvp t)trerio oo1lmDr n o;s0 rxm(m3iy4omee net (faDurxm nu0oexomfciysfa ra(vpnt)trtnmoctodfa eli o () eurio3ny1omt  nvt ( a2rrx  ou1apxo ieiydlsDem(vo;(4teeoir iytla ranvi;()t2um(r3iu1omt mivi t a2uau ooo0oeeomfetadfa2rlumon()arxnio3ta1lmD lu s;s)srxo(m3oo1omen nesat s2uru  ;u1tetniiciadfa ean o u0alxrircoadfpD  ivols0s2tm(rpnodap   ivi ( srta(  ot0oex  i3ils a rlump u4texrif3oodoa raneo;s0t2tr(o iy4lptnlnvsatfsrtru pnt0olxoiiciys s el( pn() rtnxo to1optr neolt  etoio3iu4ap  mnesls) 2trx p;o4alt  o3tldfaDumums (4 leriociatoa rluvo;t0 euoir no1aleemiciltfartm(  no0alxo ictytfm rmnmo;t0altrxf3tadfa  ln ol()s2toxopoudam   fviatf rua(r ;o4aptnioeiadfm ulnvpnt)trxrmr oatfa  ln o (  etrxr3iudopen fctls s2tmumonu0tpxo feils m ea( o ()aexnmfcoa1fmtelnes t texo(mpoo4lp emncsltfsrtaxmp;u1tlxn oeilsfs rmn s;()tltrir3tydfmt an o () rtrxrpoo4ameemfeias srum(m ot4tpxn oeilsfmDelumpnu0 rtrio iatfm ranvs s  ruoim ou1aleemiet s)a2taumonu0aptoioeiydlmDeanvp;u0 rxrmrcio1fp r ivo ( teumio3nydlleelietl(faDum( p;o1olto fciyslmDrm(vo u0 rerir ootfmt luvi t  rurxmpoo4aleelietlsfa2umxmpoo0texnmoetas a uaumpnt0alxnxociydfaDeanvilt) etm(opno1ll  lnctas  2ra(ronu4opxo i3iyt a el( snt0tlxoxr3todfmt aues;t s2urxr3oy4am emivtat aDtrxmo;u0olxnmoctytla eluvpn(0tlerif io1oa  an o t) rxrir ny4optemncs s) ruaxm nu0opt  f3tytlm2uanmp;u)texoxo3oatlpD lnvi (0sexrir3oo4lp elfvtat)s2ra(mont0olt mocils a uanmsnu0arerxo3oa1fmDe uvsls t2urio oy1ame mivi t arrru  ;t1ope moetasfm eanvo;()altnxf3oydoa ranes s trumxm3nu4am emiesat)a2taurono0tpt mi3tat m2rluvs u)alenmf3oatoa  li o;s)trumimpou4al n fciat artmuroot1alenio3iadlmDua(vp u) lxoxf io1oateaneols0srxr(m oodaptelnei t arrr(m nu1teto octydlsDum(vsn(0teerifcootoptrli ils)t2tmir nodalenlfcias  rrau ont4oeeomiciysfm rm(ms;(4treoir3totlaDelu o s)trxr(m3oodllte fcsat  Dur( pot0apxn iciadlmDranmp (4aetnxo ia1opt auvo;t0setoxr iydape  nvil(fsDurxmonu0ape io3ias m uau p (4 exrxoctadlmtrlneil(0 2xoimpoydop nmnesl()artax pno4aeeoifeiytfs ulnmpnt0 rtrmf tatom  luvo;t)tetmir3oo4lm   feiat)s2taum nt4tltomfcilsla2um( o;t) etomrcootla r ieilt0 rxmim3oodlpeeliet (f Drrx onu4tptomi3tasfa eln s;(0alermf3ta1faDeluvo;s s2xrio iy4ll emnvs (f Dtrumo;o4aptomfeiad aDrau p ()arxnio3iy1omD  uesls0 ruoxm3nodap nmfeiat a2rm(m nu1aet mfeiadfmDrm( pn(4 eerxociy1fmt lu i (0 eum(r ny4ap n net s  Dtmurpno1teeomo3iatla elu on()teenirciy1fm ranei;s) exm(r ou4om e fes tfsrururpoo1aet  ietysla2eau on(4alxnxf3iadlmD aivo ( tetmio3iudopenmnvilt srtruront4apxnifeiytfaDel(vp;(0 rxrxr tadfm  lueo;(  etm(o iy1ale mfctlt)sDurxr ot0aexnmi3ildlm2umn onu4arxrif to1om   uvo t)s2trxmpnudapeemnvsas  2raump;u4alx  fciltlm2eaump;u)areoir3oy1fmt ln s t  rtrxopoydamt mictat aDtm(ro;u4aptnmieiytfs2eaumsnt4aetnir tatlp rlieolt)s2toiopny1lltnlnvia(faDrm(r oo0aet  i3ilsla um( o;t0altnmf oytlaDe ivo;s0srtmio3iodam   ncias)s2urxr ;t0tltn ietyt s rl( snu0trxnio3tadfmDranes (0 exrxo iodapteliet tfartm(m oo4apt  iciydfs2ulnvp;t) lxnio3ia1omD  nes () 2xoiopno1ale  fcsltfsDtrx pou0aexoiiciydfaDemnmp;t4 ltrxf3oy1fatr nesls0 2xr(m oy1om  micsls)s2ur(ro;u0oeenif3ilt m2rlumo;t0tlerif3oodlaDeluei s0trtmim3oo4llt mfvia(f Dtr(  nt4aex io3iydfa2uanvpnu) rxriocoatop  lueil(0srum(r oy1am emfvslt) Durxrooo1opx mictldla2rlnmo t4tlenif oodlmDr ues;()setr(o3oy1ll nlncs () rtm(r nu0opxnmoeiydls umn ont0trtomr iydlmD luvsls)t2xmxr3iu1lptnmfcilt) 2rau  nu1olx  o3iasfa ranmp;t4 ltoiociy1faD lneo;t)tetm(r3iodop emfvt s a2um(rpnu1apxo ictyd a em(vpnu4altoir3iy1la  auvo;( s2xoxr3oudope mfctlsfartm(r ou0apxoiociysfa2emn snt0altnmfciodoaD ln i (  2xrio3oydll nlnvtl( s2tmurpnt0tlen fctyt s2elums (0trtnmf oy1lmD anvi;s  2tm(rpiy1olt  fei ()aDrrxm ou1tetomo3tldfm2eluvs (4aetrirciy1laDeau olt  eur(m3no4lmee ivi s sDrmumono4aptn fciyslm2ean o (0altoirciy1opD  ueo;s0teuo(opoo4apeemnetat)sDtr(ronu1olx iictysfmDra(vp;u)aetomf3ta1fp r i ol() exm(o ou4ape lnvslt srurx ooo4tpen i3iydls ean on(4altomr3tadoateaivilt) eur(o ou1om n ivta()a2umumonu4opxoioeiytla2em(ms;()trxrir iy1fm eanesl(  2xrio3io4om nmfcias)srtaxmo;t1ole ifctyd mDua(mo;(0aexoxo3todopD  u i;t0 eto
\ No newline at end of file
@@ -0,0 +1 @@
+ueolt)texrxo oo4omen neiasf 2taur ou4tlt  f3ildfa2rau s;u0 eeoif3ia1opDe uei s trto(mpio1lm eliet s  2trumpoo1opeoiietadls eln o u0 etoiociytoateaivs;t0truoiopiu1opeemfcta() Dtaxrpot0oee  f3tyslaDel(vp u) rxnio oo1fmtelnesls sexoxr oudol e icslt srurxr ;o1alt ioetlsfm2uan o;(0teeomoctodfmt aueo ( trxmimpio4apte fcsas  2urxm nu0aee  ictyt a uan p;u4 reoir3iy1fm   n o ( s2toxr3no1lle mietatfartaxrpnu4apxoioctyd s ean s t4 etnircoadlmDelieo;s0 2uoimpoodlmtnlicilsf rrm(  ;o1apxo o3ils aDranvp;(4altniocio1fmt li s;s s2uoxm iydole mfci ( srtau pnt4tpx ifciasfsDem(von()tlxoxr3iy1fate i sl(  2xo(o iu1ame  ictl(f rumur no4apenmi3iasfs uln onu0artoif3ootomtelnvols0 etoim ny4apeelics sfa2trxmp;o1oexo ictld s2umn pn(4aeeriocootom e ivils)setr(r3iu4alenlfvi s)s2tm( ont0ope ioeiadlm2elnmo;t0teenif oydoate ivs t0setoir3ou1alee neia() 2ta( pnt0tlen o3ild s uln s (0 lenmf3ta1lmDr n s s0s2urirpoo1ll nmicil( a2tm(mont1oeeoioeiadlm elu sn(4areoif3tatfpte n s s sexoimpoy1ale  fvi tf 2raumono1tex ioetat m2eau pn()aetnmo tytoaDr i o;s trtr(r3iodam eliet s arrrumonu0tpxnmfetad aDua(vs;t4arermf3ootlpDranei;t  etrxr nydomenmfcs s a2rmxr nt1oleoiociatla em( p;(0 exrmr3io1lmtelivolt)seto(r3nudap nlicsl(fsrtaxro;t1tet  f3tasfs2ua( p u4treoxr3oo1opDe n i;s)trtrxo iy1ap  lfcsls aDuau poo4alxn iciydfa emu snu4arxrif3oatla elueols0t2toxo iydlpe miei (  Dumuront4alxnioetadlaDrmumpnt0altnifctatlaDrlueils) eurio iydamtemfcsls)aDrmu  oo0tlxomfctysfs2umums u0texoif ta1fpteau i s t2tm(m3io1lle  fetlt) 2rau p;o1apeomi3tys a rm(vsnt) exrxrcia1opDe ies ( t2uoxr iudomeelfcia( sDtaur ;o4opt mfetat mDeln p u0teenircoy1omDe ueslt)t2tmirpiu4lme lieilt  2rm(mo;o1olx  fcias m ulnvp;u)trtoio3iytlpte i sls) etrxopnudal emici s s2umump;u0opxo oeiydfs uanms u)aexomf3iatfa eaivs;()texr(rpio1ape mfvilt srrau p;t1aptoioeiasla2rl(mo;(0teerircoo1fp e uvo s  2uoxo nodaltnmncslt sDtmxmpou4opx moeiasla2rln o;u4tleoxo iydfm eaieslt0 rxoxo iy4aleelnci sfs2raxmonu0aetomfeias s2rmuvo (0texnxr3ia1omt  nvi;t)t2trim3no4ap  mivt t aDrm(mpoo4apeomf3iyt s2ean p t4 exrir3ta1fmD  n i;(0seur(opou4alte nvi tfsrta(rp;t1texn o3iad s2ul(vo;() eeomocoodoaD  n o;()s2xr(opio1lmt lfvil(  rrax oou4oee moeiatla emn p;u) etnxo oa1opD  ieols)teur(r3oodlme mnvt ()a2rmuroot4tpto i3tadfs em( p;t)trtnmf oodoate n o (0seur(r3oo1amtelfcs s  ruaur no1tpxnii3iat s ulnmon()trenio ty1laD  uvs (  rxoxm iydom   fviltfs2urxr nt0oexnioetys a2umn onu)alxoxf3oadlaDeau s t0s2uo(r iudam  mfcs (fa2um(ront1aeeoiicils s2uau snu) exoif todopteli o;s) 2uoir iydlltemnvtlsfsDrmu oot1oetnio3ilt s2emums u) etnxo io1omtrluvs;( sexriopnu4amtnmfvi tf Dtrx ont0aeto i3ias m2um( p (4 exnxrcoytfp rluei;t texrxo oo1olt mfvsatfaDtau  ;t1opxo icildfsDuauvp (4aeermf oydomDeaueo s)tetmxmpnudll   fciatfsDuax o;u4apeomf3iltfaDrmnmsn(0 exnircoy1om  lnei () rtr(r3ou1apee fesa()s2tmuront1aptoiiciltla2uaumpnu0aexrifctadomt  neols0 2umxopiodaptemfvt s  rtax onu4apeo ieilslsDra(vs u4aetrmo3iytlmDeai i (0truoxr3io1openlies ()a2ua(m ;o1ope ifctyd aDrmnvs;t0arxoxoctydlpD li ols seum(rpny4optemiesl( s2tax  ;o0opxomfeildls2rauvo (4 lerxr3iodlm r neolt s2toxr3oo4ape micil( artrxrpoo4tetomfctlsls2rmu o;t)trtrmr3iadlateau i t t2xmimpnudlpeelfvt t)s2trxront1oeeo i3iyd m2ulu pn()aexnmr3ta1lpD anvilt0 2ur(mpiu4lmtemnctlsfa2uax  ;u1altn fcilsfaDemu pnu)tlxrircoadlaD auvsl( srtoiopio4olt lieil( a2raurpno4tpe iietatfm2rauvs ()aeerio3iotoaD ai o;t  2toio iydapte nei (  Dtmxm no1aeeomiciat m2rlnvp;t4arenxr totopte n i s srxm(o no1openmnesatf rrr(ro;u4apxnii3iasls2uanmon(4 lxoio iydopD anes;()seurim nu1amenliei t s2um( ooo4oeeomf3iytls2em(mon() lxomfctatlaDeanvo;s)srxrio iy4omtnmfcilt) Duaur no4oet if3ils m raumo (4teenio oodlp e ieslt0 etoxo3ny4amee icta() rtr(r ;u4olt moctysfaDulumsn()texoif oo1optrlnvslt)t2xoir3oo1om nlncsat arur( oou4opxo o3iasla umu pnt)tleoioctotomtranvol( seurio nu1ole mfeils aDra(mpot1teeo f3iyd m umnmo;t)tlxoxf3todomt aues;t)tetrim3oudlmtnmnesa() Drru pnt1tpe  oeiydls rm(vsnt)arxomrciytlaDeau i s0seuoiopiudlmtn fes tfsrrr( o;u1aexo i3iysls raumsnu)aetnmo iydlp rluei s0teum(mpiy4llt lici ( s2ta(rp;o4ale mieiat a2uluvo u4 renxf3io1fat  u s;t srxoxo3oydlltnmneiat)arururp;o1opxomictatlm2rm(vpnu4teerxrcty1la elnei t  2xrxo oodoptnmfcil()s2rrx pnt1oetnioeiasls2elums () rxomr oodla eliesl(0teumxr3nudom   ncils)artm( pot0ale mieiltfa2rluvs u0arerifctatfmt auvs t  rto(o3iy1ameelicsat  rta(mooo1oeenio3iysfs2rln s (4 ltoxrcoy1oa elnes t t2trir3iu4ale mnct sfs2rruro;u4opt  i3tlt a2ra(mo;(4trtnxociydlaD lnvo ( texrxr3ou1om  mnei sf 2rr(r ;u4tpe  fciys a el( s;t4 rxomf iydfpt aieol() 2umir nodolt lnei t) 2rmx  nu1aetnii3iys s2rlnvpnt) lenioctatfaDeln s t0srxoxr iudol  lfvia(fsDur(rpnt0oeeomfeiltla2um( p (0tetomfcoadoaDrai i;s teuoim3ou1lm nmics sf Dumx  ;o0alxnmocilt s2rlu s;()trxomo ia1fm   uvi;s  2uo(r iudol e fcil()sDraxr ;t1oexomieiys aDrlu o;t)tlxrxr to1fate i s;(0trtrxm3oudol  mieias)srtrx pot1ole io3iyt s umnmo;t)aeeomfcoydfmDr n i;t0s2xoxmpiudlpt  ncta( arurxmont0tlt mo3iltfmDel(mp t)aeeomf oytlaDraneo t t2urim nydllee ivt sfaDurx o;o1optn f3ild sDum(monu0aeerircoydlp elnvs (0t2to(o nodopeelfct s) Dta(m nu1aptomiciad sDua(vp;t0tltrio todoptrlivolt0sexr(o3oydom n fvt s arurumpnu1aptnmiciydfa eau s;u0tlxnmfcta1fmDrlneo t  2urim nydaltnlfvi tf Dtmx p;t1tlenmo3iatlm2ulumpn(4 reomocta1lmD  n o;s srtm(o iydop e nei () rrru  oo1ole  fetldfa rmnmp u4 exrxrcto1latraneil(0s2urxm3nu4opt  nesl()s2umu ooo0alenmi3iadfsDrm(vp u0 renifcto1faDr n i;s)teum(r iu4llenmfcsa( arrmur oo1tet moctldls2ul( ont4 eerxo iadlmte uvi;( texrxopiudll  mnvsl()sDtr(r ;u1alt ifeiatla rlnmo;u0tetnifcty1opte nvo (  eto(rpiodomt mncta()arrmxrpot1opx  f3iltfa um(vpn(4 lenxo3io1fmDeln s;(0 2toxm3no4ole  fvsls sDraxmpoo0olenmociyt aDel(vo;t4aeeomocoy1laD ai ilt0t2to(r nu1apen ict t sDta(ronu1aexomo3iytlmDem(vpnu0artoxrctotla r ivilt0s2urxr oo1lp elies (  2truront4apt mi3tldls ran pn(0aexnmoctatomtranvsl(  2xr(o3nodal nmfeilsfsDuau o;o4aeeomo3tadfs2elu s;u0tlenxr3oytlp   iei;t0 exrxmpnydamtnlicsl( a2umumpno0oltnmf3tat a2emnvp;(0teerio3iotlaDran ils0s2um(m iudalee fctas)srrr(  ou1tet mi3tydfa2elnmo;(4artrxociadfm rauvs;t0setr(m3oydapenmiesas)srtmxmp;t1tptoioeiytlmDulnvpn(0arerxfcoydlpDeliei;t) 2xmimpnudom n ietl() 2rmxrpot4alxniiciad sDelu onu)teenmf3iotla  ai i;()srtmir nu1aptelfvilt arum(r nt4tlt mi3iyslm2emu s u4alxoiocoy1fmDraneols)srxo(o3io1alt  fcias)s2tau p;u4ope iicias s uauvont4 etoxo3iydlmtr n s ( srtoimpio4ll   iei t) Duaumpno0alxo iciaslmDra(vp;t0tetrircoydlaDe nvs;s) rxm(r no1optelivs t  rrmxrpou1tle  i3ild m2el(vp;u4trxrxo iatomt livs t0texrio iy4ll   ivi ( srua(mpno4ape  ieild m rlnmo;(0teeoif3ia1fm elivsls  2xrxm iydapt lfcil( a2urxrooo1alenmo3iatfa2el(vo;u4 rxrmoctadom elivi;s)sexm(mpiudlmt  fei sfaDuaxm ;o1oexo oeiydlaDeaumo u0tltoif3io1faDraivi t) euo(rpio4ll  mfetas) 2tmx o;o4oexo ieiytfs2ul(mo;t4tlxomf3tatfa  li s t  rtmio oodolenlivi s  2um( oot1altomf3tasfa2elnmp;u0arenxfcia1latelnvs t)t2xrxrpiydal n ncs tfaDtrxmpnt4tex  oeiadfa2ranms u)areoxf oodlpDe i ol( trumimpoy1ope mfvt ()aDtaxrpno1tex mo3tldlsDrln pnt0texnmo iadlm   uei;t0tetr(r no1lp e icil( aDtau  ot4ole iietyt s2ean sn(4alxoir to1lpDr nes s) exoxo iy4lmenliet (fsDra(m ;o0opxo i3ildlm el(mp (0 lxnmrctadlpDean i s teur(m3nodameemfei tfs2rmxmo;t1teenmfciasfa2rluvs;u4aexrxo3iodfmteln s t srtoxo3ou4al nmfcsa(  ruauront4aeenmfetydfm um(vsnu0 reomr3oytfmt anvi t) 2tmio nudapt  nvsat s2ur(m nt1opeomf3iaslmDrl( o;(4 eeomr3oodlmD  neslt t2xo(opnu4lltelnctlsfs2tm( ono0oet if3iyd sDuau o u)arenxr ia1fa r u i s)trurimpiu1lm n nvslt  2uru  ;t0ale iicilt a rm( sn() eenmo tytlmt  iesl(0 etoxmpoo4lmeelfct tfsDtm(  nu0ole  i3ildfaDumnms u4arerxocto1lmDrauei s  rxrxmpnydap nmietat)aDrr(mp;u4apt ii3iadfm2ul(mpnt)texrxf3oodlptrli ols0s2tmio iu1olt mfei s)srrr(mpou4oexnmieias s2eanms;(4 rtnmrciydfat ln s t) eumir3ou4olen ncta(fa2ua(mpnu1apxnmf3ildfm um(vp;u) lerxr3io1opD anes t0t2xmir3iy1om n ietat  2ra( p;t1aetomfciytfm2emuvs;u4tlxnirciodlatrln ils s2triopoydlp elfviat  Dtau o;o0alt mo3iydfm2em( s t0 ltnxfctytopt lneil( teurim3oy1lpt  ivsa(  Drrur nu1aetnii3tad a eaump t0 leomf3iodopD  ueo (0 2xr(m3oy4omtn nesa(f ruaumpoo0tlenio3ias s2eanvs u0texrmo to1fmt aiesls t2tmxr3nydllte ncsl(fs2umur ;u0oexoii3iyt a ra(vo (0 rxnxo3io1la   u i;s0 2trxo iu4lm nlneta(fa2tm(  ;u1apt ii3iysfsDua( p t4treoio3oytfaDr nvo;(0 exmxmpno4lpe livias) 2trumpno1oet mo3tas m2eanvsnu4aexrmf3tatomt lueil( tetmxr iu1olee ncs ()sDtm( oot0aetnmietldfa rm( snt4 rerifctytfpD anvs t srtrir iodop eliet t)sDur(rooo4texn octlsla ranvp;t4trerirciytom  lnvs (0srtmxr3io1ameemfvi t sDur(mo;t1apxomi3iyt sDuanmp u0 leoif totoptrlivs ()sexoxo ou4lmee ieia(faDtr(r nu1opto oeiys a2rl( on(0tleoxfctytfmt an ils s2urio iydal n fcs ()srumxrp;u4altoiicildfa2el( o (4arenif3tytlptraies s t2tm(o3oy1apeemictas artr(mp;t0alxomfciytls ua(vo (4tetoxo3oo1fa  lnvils0seuo(mpoudll nlnvi ( aDtau pnt0aee iictatfs um(vs;u) rxoxr3ia1omteanei;s  2xoxo3iodolt  ncs ()arrrxr no0tleoio3iyd aDel( sn(0altoio3iy1fateli sls)texmiopiy4lle  ivsa(f Drrur oo0tetoioctlsfa ra( on(4 eeoir oydomtran o t  rtmxopno1aptnlivta(fs2raumo;o0alt mfeiatla emu p t4trtnircoy1lm eln i;( s2toxrpiy4am nlics () Drmxmono1apxniietltfa2rm(vs;u0 lxoxocoydfp   ieils seuoio3ou4ll nlicsls)aDrm(r nt4aexnmi3ias s2rl( on()aetoxrcootlmtraueolt0 euoir iudlpe  ictat aDta(r ot0tlt mfciltfsDelu o;(4altnio iydoaD auvil(0texo(m3nu1lp  micsa()artr(  ;u1aex  feiat sDrl(vs;(0alenif3oy1fm   ieo;(0s2xoio3oudlptelnvils)aDtrxmp;u4olenmi3iyslaDumump;(0alerif3oadopt lies;s)setmxo3oo1op   icsa(fs2uaur ;o0oetnif3ils mDemump (0 eeomfcoadoaD  i i t)trxoiopoudale  fesl(f rtmx o;t1ope mfeildfs em(mpnt0 ltrmr oa1oateliei;(0s2tmim oy1opee ncil(fsDtrx o;u1tpxoif3iatfsDumuvp (0 leoxrcoytla rln o s)tetr(m3oy4lptnmfvta(f rur(  nt4alxomociltla2rlnmp u4 eerif iytfpte n s;s) euoxrpio1al  lfvs tfarur(  ;u0apt ii3iydlmDuln o t)arenirctydomDean o s  exrxmpnodaptelfcsls) 2tm(r ou1tlxn ieiys a rm(vp t4 exnxf3iadfpDrlueols  ruoxr3iy1lp  micia(  2urumpoo0tpeo oetlt a2ua(vs;(4aeenmf3oydlat anes;t0s2xoim3no4lp emfeslt arumumoot4texo fctat s2uln p;u) lenifcoatfa eanvils0setm(rpou4ame lnetat)srtruro;o0ale io3iydlm rmumsnu)tltomf3to1op eaivi t)t2tr(r3oy4apee fcsls) 2rru  nt1oetniicilt s2eauvp ()tetnmr3ia1lp   ieslt srxoir oydomen neilt) rrrxrpou4tpe  ictadls umuvo;u4texomr3to1oate ieols t2uo(m iu4am  mivta(  rrr(rono0tpe  o3iatfm2uaumpnu) lenmf3ta1lat auvi;( trtm(rpno4al  lnciasfartaur ;u1tpeoio3iyd a2uanvs;u4trxrircoy1fmt li s s  rxrim iy4ap elictas)srtmx o;t4olt mieiyslm ua( pn(0 ltnxr ty1lmt aiei;(  rumir nudlltnmfvs () rrm( oot4openmo3tyt s ranmo;u)tlenmfcoatlpDr u o t)seuoxo3oy4al elfeils)sDrmxro;o0alto fetldla2em(mpnu4 etnmr3io1lmD ai i t seur(o3iudlp  micias) 2uru p;u1oex  feildlmDrau onu4alermoctadoptelueo;s seuo(mpio1op emnci () 2taxmpoo4apxnif3iad m2eanmp u4teermr3tatfatr i ol(  2uoxmpoo4om  mnvs (f rumx p;o4aeeomfeilt mDrlu pnt) rxnxr3ootomDe i i;t  exrxo oodoptnlnvs ( arurx pno4ale mfcild s rmu p u)trenmf tytfm r ies s s2umir ou1lptelncs sfsrur( oou1tptnifetytla2eauvo;u4alxrif3tytfa eaueslt)srxmiopio4amtn ncs ( s2raxmpot0tlxo fctadls eanvp t)aleniocty1lp eluvs;t t2ur(r3ou4om nlfesa(  rrmur ;o4aee mictydlaDumnvo () renxo iodlp eln o (0sexmir nydaleelfcsas  rtrxronu4tpenioctls m eauvp;()aeenir iatop   u o;t  2toim3iudole mnvi t  rrrxm no0oeeomfeiad m rau ont0 etomr oydlpDelu il(0t2toimpnu1om nlivt tf rtru onu4apx ifetldfsDrmn s u) rtrif3oa1op elues;s)s2tm(r3iudlleelfcslsf Dtrumooo1olt  feiadfa uauvpnu4alxnmr3iy1lpDeauvo t0s2uoim ny1lme lnviat s2taumont0alx ii3iysla uanvpnu4texrmoctadfatraieslt t2tmxr iu1omtemfvsas)srrmu pno1aetn f3iytls2uluvp;u0tlxrir iy1fp eli s;t  etr(opio1omtelnet t  rra(  oo1oeenioeiytfs2umnvsnt) lenxoctodopD  nei ( trtmxo3nudomt mfvtl(faDrauront1apxn i3ilsla2eluvs u0teermo iodom eai sl(0 etoxrpoudolenmfeta()sDrm(root1olto ictadfa2ra( onu0 lxomf tydoateaues (0trxoxo3io1am nmivs (f rta(roou0oee mociltfmDem(vs;(0tetrxo oytlaDe n sl()s2xo(r3ou1opee nvsa(f Drr(mooo4olxomoetasfsDuluvpnt4texnxrciadlaDeau i;(0setoiopiudam  lfcs s sruauroou4oex iieiatfm emumo;(4tlenxr3totomDeaiei;s) rxoirpoodamen nvsat aDtax pou1oleoifciys s elnmo;u)trtoif3iytlatrli o;t trumxo no1ll emnesls aDrrx  oo0tpxn i3iydlaDemums;(0tetoxo3iotopDrlueo (  rxm(r nu4amtelictlsfa2rauro;t1olenii3iysfsDumn s t)alxoio oa1lmDe nes;(0 rum(mpoodomtelncta( sDrr(r oo4oetn o3tatfs rmuvp (0trtrxrcoodop rluvolt0s2umir iydopeemfvs s)sDtruroot1tet iictad mDea( p u0aexoio oadfatrai i t0teur(mpoydalt mnetlt srrrum ;o0alxoioeiytfm ulnvonu0 etomfcio1faD ai o;t)srxmir iydole  ietl(fartm( pou4alxomicild s ua(ms;t0 eeoxo3iydoat au s;(0srtoimpnydap nlnctat)a2urxmoou0ole miciys aDel(mon() lxnif iy1lpte ieolt0 2ur(r ou4oltnmnvilt  2uauro;u1tetomicildfmDel(vo;(4areoif3oodfp rlu i (0 2xo(o3ou4alenlfvt s sDtmxmpnu4opeo f3ils s2rln o t4trtrmr3oydfaDelivo s) rtr(m3iy1lmtemnetat srtrx onu4opxnifetadfaDra(mp;()trxnif3totomDe u sls0 rxmim nodop nlfvi (fsrtaxrono0oexnio3tltls2emump;t4teenxf tytfpDe uei s0texr(r3ny4llee iesat)a2tmu p;o0altnmictltfmDuauvonu0 rerir3iy1omDeln o;s)trxmxr iy1ap n nctl()aDra(moou1tpe mo3tlsls2ulu snt)tltrxr3to1oat  i o s texoxm oy4lpt  neslsfs2ra(  ;o1oex  fcilslsDeauvo u0artrxf oodoaD aies ()s2tmim oodllt lnvilt a2umx o;t1teeoioeiatfa2umumpnt4 rerxfctatfmDeanvs t)trxm(o3oo4ol e nvsl( a2rrxrono0ape ioeiatlm ulumpnu0texomf iadoatr i o;t) rxmxopno1llt  fet ()a2rm(rpot0tptoioeiys a2emuvp;(0teeoxfciodomDr ieols t2xr(r3io1altnmnvtl(  rrrxmp;u0tpx if3tas s eluvo t)trtnio iytop  ai olt0 2um(m nudom nlivt s a2rrxmpnu1teeo ieilslsDranvsnu4 rxnxocta1fate nvo;s s2tmir io1om n nvi (faDta(ronu1apt  iciltls2eanms;(0aetrmr3ia1fm raieo (0trtrxopny1al  lieils sDrr(  oo1tpen ictltlsDem( p t)texomr3tadlmt  uei;s srxo(o3ou1llt lnei sf rrmxmo;u1teenmietatfm2uanvp () lxoio3iodfaD aies s sexmir3oo1omeelfes ()aruax  no0olto f3iltfa2ulums u)treoxf3tatop rai i t0sexmxmpou4lleemicta()s2um(r ;o0apen o3iadls rmn s;(0alxomfcoadoptrauvo;s0s2xo(r ou4optnlictasf 2raxrpoo4aex mictyd m2el(vp u)teerir iydoaD  n s ()trtmim3nydopeelicta(  2rmurpoo0oexo icildlsDrmu p ()aetoifciodfate nei ()setoxo iu4am n fctatfs2raxmpnt1tlx mi3ilsfs umuvo u4aexomo3iy1oa eli i;()trtm(m oy4lleemietlt arrau o;o1apeoii3iadls rlu p t)tltomfcta1fpDr ies s0teuo(mpio1ole  ics (fsrtmurpoo1oeeo fctasfmDea(msnt4altrxfciy1la eaivi (  exr(m nydll nlfvs s)s2rmxrp;u1oex mfetldlm2ua(vp;t4tltrxrciotomD aivs;t0teurim iu1omte ietls  rrmxr oo1apx  f3iat s uau o;u)arxnxocoatopte u o;(0 eumir3ny4omtnlnesl( a2rrum nt1aet mo3iysfm2rmums u4 lenio totfaDrluvs t s2uoim3iu1alee ietas s2rr(  ;u1tptn ictldfmDrlnvs u0 reoif ty1oa e ivil()s2umio3io1ll  mneiltfa2ur(  oo0apx moeiatfaDum(vpn(0texomfctodfaD aies (  etoxr3oo1amenmnvslsfsruauronu1opeo f3iytfm umnmo;(4 reoxo ia1fmDrauvs;t texm(r3ny4alee neslt)srraumpou4apen i3tyt m uluvp (4 reoxocoa1lmD ln sls0seuo(r ny1lpt lfcsas)a2uaxro;t0tleo ociydls2umu ont) rxnif3oy1fm eanvi;t0texoxr oo1optnmicslsfsDumur nu4alenmiciytfsDuan o u) rtnxf totlpteauei;t)tetm(o3iudopeemfctatfaDtmur no4aet ifcils a2uln snt4arxrxr3iydomt anesls)tetoim3iu4olee icsatf rrmuro;t0apt  fetatfmDean o u)aexomo tydomt aueo ( seum(opoudamenmfct () 2tmu o;t4alxoiictyslaDrau onu) rxrxo3oa1lpt luvi ( s2to(m nudllenmfciat  2urxronu4opeoifeiatfmDean snt4 exniocoodfpt  ueolt)srxrxr3ny1al nmnvsa()sDta(r ou0optn i3iydfsDrln s (4alxnxo oydfp elueo s trxm(m3iy1am   fvsa(  rurur ou0altnioetlsfaDuan snu0tetnxrctytlmt ln o;t  2xoir3oy4lmenlnvs ()srua(monu4opt if3iysls2rln p;t4tltnxf3oo1oat ln s (  exmxrpoydllte ietls srururo;t1olxo o3tyd aDul(ms t)texrmfcootlmDr n s t0s2umxrpny1lmeemfeia(farur(mp;o4opt mfetad a uln o t) etnmr3oa1opt ln o;( t2xr(opnodlpte ncta( s2ururooo4optomoctls aDumn pn() rxrxo oa1lmte neo ( sexrir ny4ol  mfvtlt  2raurp;u1olx  ictysfs rmnmon()trerxr3oadfpD ai ils s2xm(m3nu4om nmicsl(  2rmu ooo4tltomfeild aDelnvpnt4 lenif tydfm r ivs t) exoxmpny4aleemici s  Dtmumpot0tlx mictls s2ea(ms ()altoxr3todlpDe neo s0truo(o iy1op emivs s)a2rrum ;u4alto fctadfa2ua(msn(0tlxrmr oo1fmtraiei;t0 ruo(opnydamenlnctls)s2tmumpot0alt iiciasls2uan s u0aeenxo oo1latrli o;(0s2xo(rpno1omt mfvi t arum(roou1tleomfeilt aDumumont) leoir to1om rauvo;t0 2um(mpiudol   ici s  Dtau  ;o0altnio3tlt sDuanmp;(0 ltrmfcoodoa rln olt)s2toxo ny4lpe  nvi sfsrumxroou4oleo i3iadls2eanmont4 reomf ootfptrauvo;s0s2uo(rpnu4lmenlnetls)aDraxmo;o1altnmo3iat m2rl( s u0texnxfctadoptrai s;t0trtmim3no4lme lics s) Draurooo1alen iciyd m rlnmont)treoiocoytoaD  ieilt0sexr(r no4op nlfctatf Dtmu p;o1openmieiydfsDel( onu4arenmf oa1lmtrln ol(0t2xrio nodlm elfcsat  Dur(mo;o4tltn oetadlm rmn snu4texoir3iadfat auvs;s)seuoxopoudaleelfvi s arraxmo;u1tpt  oeildfs elu pn()tetrif3io1omDran ils  exm(r3ou4ome lnctas) Dtru poo4olt mfeiytfm2ranmp ()areniocio1om  aivo s sexrio3iodlmt lics (f rrrur nt4alxoiociadlm rmu o;(0tltrxr tydfaDr nes t srtmxo3nudome  iesl( arua(mpoo1tpx iieiasla2elu pnt) etomf todfpDeliesl(0t2xo(mpoy4omtnlfvslsfsDurum ou0olx mf3iasfs um(mp (4 renio3to1fpDr uei ()seuoxo3nudll e ictas)srtmu o;u1open ietldls em(vp u)alxnxf iytla rau il( trtoxopny4alteliviat)sDtrxrp;u0tpenmfctad mDea( o;u0aleomrcoodla rlies;( teuriopoy1lm e nci ( sDumum ;t4tltoifctat m2umu o ()aexoxrciodoat  u s s) rxoim iy4ale lfcta()a2ra(rpno1tpxnmfeiydfs2em(vont)trtnioctotlm rlivi;() 2xrir3nu1ol nmnvslsfs2rrxront0tlenmoetldfm uauvp;u4tlxrmf oa1fptr i s;(  rurxopio4lme livi s) Dtmum no0tltoiiciadlm uan s (0 rxrxo3oadoa  li i;t srxoim3iydlm n nct sfa2trxr oo0tlt ifctatfmDelums t0 rtrmr iotlpDe nvs;s0srxoxrpnudamenlneiltfsrtrur nt0aexn ictat m2um(mp;u4tetrxr oodom raieo t t2uo(mpoydlm emietl( arrmxm oo1alt miciysfmDumn p t4tetomo3iydomtr uvi () 2trxmpnu1optnmfct t  2rr(m ot0tet ioeildfs2ranmp t4aetomo3oa1laDr ivslt)seumimpnu1ll   nvils)aDur(rpnt1oltomf3tld a ra(vsn() eerio3iadfptelnesls teto(rpnudolte fet t) 2tr(  ou0oltoioeiasfsDrmumpn(4 renmo3todfpDranvi;t0t2urxm oodom   iet sf rua(m ;o0alx moctatlm ean s;t4arenxf3todoaD  u i t)tetmxo3nu4alenlfvilt)aruau oou0olt  fciltlmDulnmsnt) eerio3oatlpDrlivs t)teumxr ou4ll nlnctlsfartruro;t4open feiatfa2ulumonu4 rtrmfcoodfm  lues;(  2toxr3ny4lmeemnvsls)srrruro;t4aee ioctytlsDuluvp t0trtnxocoydlmD luvsls) 2umxr ou4amtnmfes (fa2rr(mp;u1teto ietysfsDulnvonu)aetrxf iy1la eai ol(0 exrxr3oy1altn nvt (  rurxmooo0tpxo oetlsfmDra( on(4teeoio oydlm   iesls0t2tmxopio4apte iei t aDraumpno1opt ii3iatfa2ea( ont4 rtrio3tatfat lu i t0seuo(r3iy1amt mfvtlt aDrau  ot1oee moeiydla2rlums u0aeerxr3oo1fatean i;s0 etmxr3iu1opeelnvtas) 2ua(mooo4tlenio3iysfmDrmu ont4aetrioctodlm eanvi (0 rto(r3oodaltelncilsfa2tmxm ;o4apt  f3taslaDua(vo;(4alxnio3oo1lmDrlnvsl(0trxm(m iy4apt  fvt sf rrrxmoou0alx ifciltlmDulnmo (4trerio3oodla eli o;s teumxr nu4apen ncslsf ruru ont0texn o3ilsfaDelnvs;u0texomfciadlatr i ilt sexmim iy4ome lfcsa() rtaur ;o1olxoifetadfs raump;(0trenio oy1laDe u sls0 2um(o3nydlp  mnvsa(faDum(  no0oetomi3iltfsDea(vs;t0altnif3totlpD lneilt t2umimpnodlp  mivs (fsrrauro;o4tle  ociltlm2emnvonu0 rtomr3oa1la  aivs t)t2to(m3oy4lpee fciatfarrm(m nu1oee  ieildfa2ra( s;(0 ltnxr3iy1oa   n o;s)t2tm(opoodlm nlnvsltf 2urxro;o4teen oeild s2uln o;(0texoif3tydfm r ivo t truo(m io1amt mieias  Drmu p;t1tpto f3iatfa ean snu0 lxrmf ia1fm e nvils0s2xmio3iy4alenlfesat)srrax onu4aee mo3tatfsDra(vont4tltrmf3oodop r uei s0setmio ou1lpt  fetat sDrmx  ;t1tlxn i3iaslmDuln snt)trxrxrcoytopt  ivo s0trxo(opiu1llt  nci t srua(ront4tleomieilt mDel(vo (0 reoio3oo1lmD auei;()tetoiopiy4amee nesls  2um(ro;u0oeto octas m eluvs;t)trxoxf3iytlaDr i sl( t2xrxr3ny4op  lneia()aDrrum nu1opto fctatlmDel( p (0 rxrxr3tadop rliei;t srtrxm oudole lnvs t sDtrxm ou0alx if3ias s2umu o;u)trxoio3ia1lpDr nei;(0s2to(r ny1alt livsa( artrxrpnt0opxnio3iadfs2umu s (4trxrxr3iatlatr ieo;()trxo(mpnodamenlnesat)srtm(  nu1oee  ieils m uln o u)alerif oydlpDelu sls0s2uoxr ny4open fetl(f rurx  no1oet  o3tadlsDrlu s;(4aexoxr3oatomD  ivs;s  rxrir iudop   nct t)s2tr( pnt0tetnmo3iytfs2eauvonu)tltoif totomD lnesls0 exr(r3oydapee iei sfarrmxmpou1tpeoif3ild aDemuvont4trtriociytlmtrluesl()teumxrpou4ol n nct ()sDua( onu0tetnmfeiad mDrm(von() lxomr3iytlp e n o t t2tm(mpiydomee nesas)srtrum ot1oetoio3tyd sDranvpnt)trtomoctotfmDr ivsl() rtrxr3iudom  mfvsls arur(mpno0oltnmo3tld m raumo t) lxoio3oatopt anvo t) rumxr oydal e ivs tfa2tmur nt0tlxoioctadlm ea(vp;t)trenxo ty1la  aivolt t2umxrpou4al  lfcslt)aDtm(mo;t1oeen feiad mDuanvonu)alenxo3to1omDelu i;t0 rtr(m3ou4lle lietl(f rua(  ;o4oeeo oeilt s2rmu ont0 leoio3io1fa e u i;( srur(m oodll emfesa(fsDurxmpnt1apxnio3ildfs uauvp;()aexrir3ootla r ieo t) rtrxmpoo4ap  liet s)arraumo;t1tle ifeiytfmDeln p;t4aeerir tatlmDrln o t0teumxr io4opt  ietl() 2ururp;t1oexo i3tydfa2emu p;t0teenxoctadfm e ivi t0 rxoiopno1amte nvil( sDurxm no0oexn i3ildfs2uaumonu0trtoir3iydlmt  ivo;s tetm(o no4amen fct s) rta(mo;u1aptoioetasfmDrlump ()tlxoir totoaDrlu s;t0trurxm3iydlptemneiasfaDtau  oo4tlenioetadfm2ra( p;() rtrirctadfmD auvo t0tetrimpny1ole  nvia()s2trumooo4tpxoii3ilt m2ua( p (0aexrxf totfpD  ivi;t)trtm(rpnu4am nmivias s2rrxr ;t1tpxomocilsls2eauvsn(0texoircto1fpt ai ols seto(m3iydam e nct s  rtmumo;u0opx  fciltfa ul(mo u)tltomf oy1fpt auesl( t2umxmpoy1ol e nci ( sDrau p;t4optnifctld aDumumsn() etrmf3tydlmDraieils0seto(mpoodomtn fetas)s2umuro;u0apeoiociad aDeanmsnt4aetrxf iydlm  luvs;t0trurir iu4lmtnmneil(  Dtax poo1ape moeiyd s2umuvp (0altrxf ootop r i sl() eumim iydapt mfvsls srumur ;t0oee iieiysfsDemnvonu0arxoif oytopD lieilt0srxr(r iodlme mivta(farra( oot0oeto iciltfmDeanmon(4arxrio3tatlaDean o s0t2tmxm3ny1aleelfcia() rua(m no4optomo3tld m2eanvont0areomfciydlmteaivi t trtm(rpoydaptnmfeias sruax onu0oetnmf3tld m um(ms u4texrmo iotlaDelnvs s0 2xoxmpnydll elfctlt srtaumpnu1apen ociydfs rmnvsnt0tlxrif3iadlp   uvi s) eto(r3no4op  mivsas)aDrmxr ;o4tet  ieilsfa2rl( sn(4 lerxf oydlpt ai i;()t2trirpoy1lm n neiasfsDraxrp;t0tee ifetytla rmuvp;t0altoxf3oatomtrau s;t  2urio3iy1al   fvtas  rrau pot1tpxnmiciytfm2umn s t0trtrxfcty1lmDeaivs (  euo(mpnu1lpte nviatf rtmx p;t1tpxo ictldlm2rm(ms t)trxnmr3oo1lmDranvo s0srxmim3oudomtnmnvt s  rum( p;o0tptn feildfsDrln onu4artoiocto1oate u s;s)s2xo(rpnodolen feils a2raxro;o0texomf3tytlaDum(vsnt)altnxrciodfa r u o;t0tetoxr nu4opt  ivi t)srrm(  nu4tltomiciat m rl(msnt4 reoircoodop   u sl()srxriopnu1aptn nvsas  rta(roou4oeenmfetytla ua(vp;t0 ltriocta1lmtr nei s)trxm(m nudlmtelnvi s) rua(  oo0altnmieiydls uanmo;(0tlerir3iatlpDrli i;t0seurxo io1ol  lnci (fs2taumo;o0aexoio3iatlm ra( snu0alxrxrcta1lp r i i;( teuriopiydalenlivsa(farrmuroot4tlxoifctydls elu p ()tltrircoatfptelieols)sruoxr3oy4lltelncsltfsrtr(rp;o0apto octatfa2rmu pnt)aexoxocia1la e neo;s0 2xmirpiu4opte nctl()a2um( p;o1tlxoioetys sDrmuvo t) lxrxrciadfptraivs;t)s2xoiopiydole  ici tfsDuaumont4tpeniictatlmDuln o u0arxomr tadoa eauvsl()srtmxr oy4lp nmicilsf 2ta(r ou1tpx moetadlsDrm(vpnu4 lxoif ta1fpD auvo;t)texm(mpiu1amenlfvsl(faDtmxr oo1olxo feildlaDrln o;(0aexoxo3ty1opD anvo;()s2urxr nydape  nvia()s2ra(  oo0tee if3tasls2ul( p u0 rxnxo oodlptrluvo t  2umim3iu4ope  fctls) 2rr(ront0opx  i3iytfa ran o (0altnxo oatlaDe ivs;t  rtmxr nydopenlfesa( srra( oou1altomo3iltlm rmu ont) ltnxf3totopte u ol(0trumxrpnodlm e fvsl( aDtax  ;o0aexniiciytlm rmu s;u)tlerio oodlp rlnei;s setmxrpny1ol nliet ()a2tmu ono0apx if3ilt s2uan o t4arerxrciytoa ran i t s2xmimpiodlpee fvtls)arua( pou4tlxn ocilsfaDrlnvo;()arxnir3oydfmteauvslt0 2toxmpiodol emfvias s2tr( o;t4apeomi3ias aDran p;t)arxnxrcoodlm   ueils trumxopny4am nlfvia(  2rmx onu1tpxomf3ias a2rau o;u)trtnmf3oodfp r nei t0srtoir3nu1omtn nei s)arum( pot0oltn f3tasfsDuaump;u4trermfcio1fm  lu ils s2xmiopoy1lmeelivsl( aDumuronu0tpen fctat m2uauvon()trerxr oatom r ivi;( trtm(r iu4al emnvil(f rumum ou0olxomiciaslm2ua(msnu) lxnir iotomt li i s0truoio3nu4altemfesas aDrau  oo1teen ociad aDumnms u) rtniocoy1opDeanes;t0srumir3oudoptnmivsa(f Dtr( poo4altnmfctad s2em( sn(4altoiocio1opDr n i;s)t2uoim ou4aleelfct tfa2rax o;u4aex mf3tldlmDeau o;(4 rtnxocta1lpt anei;t t2umxrpiy4omtemneilsfsrurx pnt4tpxn fcilslaDemn o;t0 rtoxrcoo1fpDranvsls setmxr iu1llenmivsa() Dtr(mpno0opt iictltfmDemn o u0arxoxo tadfaDr n s;s0 2tr(r no1lmee nvs t srua( p;t1tetnif3tydlaDean o t4tlxrxo tatoa r n i (0 2xrim nodlp nlivs t)sruru ono1apeomf3ias aDrmump;(4trtomocoodoaDeaueo t)sexoir3io1aptnlies t s2tm(m oo0tpt mo3iytfaDrm(vonu0trxrifciytop   ivs (0 rtrxo3iydap elfvsa(  rtax pou0oeto ietatlaDranmonu0areomf ty1laD aues;t0seuoirpou1ol  lfes (faDtrur nt4oeeomf3tatls uanmsnt0tetnif3iytomDeli ilt  rtmio3ny4ameemiesls a2tm(r ;t0teenmi3iyd a umu s t0texnmfciadlp e n o;()s2xoxr3nudlp  mnei (  2umurpot1tleoiicils m emnms t0 rxnir iy1latrlnei t srxmir3iodlpenlnviltfsDtr( oot4apeo ictlt m uan ont) etrircio1oa e ieil()t2trio3ou4al   fvias aDtm( p;t4tpt  feiysfm rln o;() eeoir3iodop eluvilt)t2tr(r nydllte ivilt arraxm ;o4alxoiieiyd m2el(vsnt)teeomf tatom rai o;t0 rxrim oy1lm emnct tf rtm(  no4alxnifciad s2rm(ms t) etnxfciotlp   nei s)setoxopoudllenlicil(f rrmxm nu0optomicias sDra( o t0 lxnxocoytfpD  uvi;s srxm(o3oo1ale lfvslt  2rm(mooo0oetnmieias a2rlnms;t4 lermfcty1fmDe neol()sexm(r3iy4opt lnet s)s2tmu oot4oetoifetlsfs um(mpnu0alxrio iy1oa   ues;s)t2um(opny1ap nlnet ()s2umum ;u0tet  o3iadls2ean ont4 lenio tadfp elu i;()srtoim3ou1oleemnes tf ruaxm nt0oeto fciyd s2el(mo;(0tlxrif ia1lpt lnvols)trumio oo1amenmnetat aDtr(m ot0open fciadfm2ul(vonu4arxrmf oy1oat aivi;t) 2xo(opno1lpt lici t  Duru o;o1aeenmf3tysfaDrmn p ()arxrmo iydlp r ies t0s2uo(o iu4olte ici ( artmurp;u4opt  ietytfsDum(vp;u4aeerifcoy1fmteli i s seumio3iy4opeemfvta()aruax p;u4altn o3iatls2elu o () lxrio oa1lat aivi () 2uoxr3iu1apte nvt (faDur(m oo1olxo iciad m ra( o;u0 etoio iytomteau s (0 rxrxr3iu1aptnlfcs (fs2umxmono0tpeoiociat a uauvs;t)teenmrcoydoateai sls0s2xrxo iu4alenlfesas sDuru p;o1olx  f3tyt a eanvs;u0aetnmo tydoptean s;s0seto(opoudllee ieia(fs2tm( o;u4apxo fetad s emnms;()arxoxr3iydom  luei ()s2xo(m3oydam nmfetlt)artr(rpno1tex mieiasfm uaumo;(0trerxocty1laDr nvo s  2tm(mpou4altnlfeiltf rtrxr nu1oetnmociatfs uauvs;(4arermfctytoaD livs;t)tetoimpiodll emfvslt arrr(m nt0ape mfetadfs rauvsn(0 etnmf iydlmDrauvol()teurxmpny4olee ncsl(faDurxr ;t1apxomocilsla2ra( s u)texrmr3tydfp  lu sls texrio3no4ol nlivt s  rua(mont4tpx iictyt m2umump t0tetomr3oatopDraueol(0 exm(r3oodoleelncsasfsrum(  no4tpenio3iydfs um( o;u4altnxf oy1oaD anvs;t)srto(o3oy4lmt  net s)aDrm(mp;t1tlt ii3iltls2ulnvont0 rxoxr3todlatr ivi t) 2trir3nudapt lnct (  Draxrpnt4tpx  fetadfs2elnmp;()aetrmr3iadfa  luvs;s)texmimpnu1apenmict sfa2ta(rpou0tlxo octls a ua(vo u4tlxrmo3oydoat anvils0srtm(mpiydoptelfcil()aruaxrooo4oeen oeilsfa emnvs t4teerio3ootoa r n i;()t2urim3iu1olee icsatfsDum(  ;t4tltn feiltfm2em(vsnu0teenif3iy1fmt lnes t0 2uoir oy1om nlfctasfaDtau  ;t4aexoioeiad mDemums u) rtoxo oo1lp  li ilt seurim3oy1openmieta()arrrur ;u0aleo oetyt aDumnvs t) rxnmr iodoaD aivi t0 eur(r3ny1ap  mfviasf rtmur nu1oet mietld mDuauvo;u4 eerxo3oytomDe u o;()s2tmxopou4lmtemivtls sDurxm no4ape micilsfs uan o t0 lxrxr to1opt lu olt)srtoxmpnodlmtnmfet t sruaxm ot4altniiciat mDrmuvsnt0aetnmrcio1om rln o;t  rxo(r3io1ol n nvsls srrru o;t1apx  feilslm em(vpn(4 eermo3to1oat luvolt  rurxm3nydllte neiatf Dta(m no4tet  feils a2rm( o;u0 etomf3ty1lp rauei s s2urim oodaltelneiat srrrxroou1ale miciytlm elnmp u0trtrmr3iotlmteli o;s)trxrim iu4ap elncslt artm(rpot1altn ieildlm2ul( onu0aetoif oo1omtrli sl()srumir3oudapte neias)sDrax pnt4oee moetaslmDelumpn(0 exrir iodomt  nvs;s0srur(mpio1olt  neias)srumum ;o4oeen fctls aDrlnmo;t0texoxf ootop rlues t0truoxr iodoptelnciat)a2urx  ;u4oeenmoctldfm2eluvs u)tlerif3iatlaDeanvolt) 2umiopoo4alee nvs ()a2taurpot0opx iietydls elnvsnt0 rxnmo totfa eai sls)texmim nydapt mneiat)srrmxmo;o4tpenmoeiasfsDumump;u0 exrio3oy1laD an ol()trtoxr nu4apenmfeiat)aDtmxroot0oetn fciytfm2rln o t4aexnxr3iytomD lneo;()trtrxo ny1ole miesasf rra(root1opxn ictldls rl(ms (0tetnmf ootfpt lnvil(0s2umio3oudom nmncs s arrmxm nu4olxnmoeiyt mDeaumonu) rermfcoydfpD an il(0sexo(r3ou4apeemnctas  rua( pno4oleomo3iatlm2uln p u4 exrxo todop rlnes;s0trtrxopiu1apte ncs s)aDrmxm ou0texo ieilsls uan ont) etnirciodom r uei t) euoio iy4lm elnvtat)sDtr(mpou0aptoif3iyt a2rm(vo (0tltnif3oatlm e ies t t2um(rpoy1lptnlivtasfs2ururonu1olenmiciadfa rl( on() etrxf3iytfp rlu sls) rto(o3ny1lpen netltf rrmxm ;u4open ociatfs2umnvo;u) ltoxf iydop raivsls0 ruoxr3iu1oltn feia()a2rrxr nt4apeoiociad m ea(mo u0 rerxf iotfpte nvi;s  rtrxm no4lm n net sfsrtr(  nt1tpxnioeiyd m eau pn(4arxrxoctodlp  lueo s setrxo iudlmeemivil(fsDta(moot1apeomf3iat s ra( p (0alxnmrctydfmD lnvslt) rumim iu1llte fetlsfs2rauroou0apxo feiytfs uaumo;t0tltnif io1fate nei (0 rurir nydom  lieta()srra( ont4apt  iciysfs2emnmo (0tltnmo3iodfmt luvo;t0 2uo(r3nu1optn nesl()a2tr(root0oexoioetasfa elnvsnu)tlenio3iytlmDe ivo ()teur(mpou4aptelfesa(fsDrm( ono4teeo o3iatls2rmu s u0teerio iydoptraueo s  2xoiopnodaptemnvils arrrur no0alt  ociad aDemums u)aeerxrcoydoat aueolt0 eto(mpou1llt lictls)aDtmx pnu4tlxnmoeiatla2emumon()trtoifcty1omDean ols)truoxm no1olt  iei ( arta( pnu4aeeoif3tasls emuvp ()tlermf oytla ranvils0teuo(r3io4opt mnctasf 2rrx  nu0tpenifciasfm2em(msnu0alxriociadomDeau o t  2xr(m iu1al nlieia( aDtmum no0opeomfciadfs2rluvon() lxrifcoytfm r uei;s) rurxr oo1am  lici t srrrumpno0oltn i3tyslm2rl( s u)texrircootlmtr uvols)s2xr(o ou4alenlfvtl() 2urur ;t4apt  ieiasla2ra(mpnu)treoxociydfmt luvslt)seuoir nydlptnlneias)a2rmxrp;t0opto feiltfm2rau p t0trxoif3iodopteaivs;( trtmxm nodalt lieils)aDtax  ou0optnio3iatla uauvsnt0 ltrio oa1lpDeau slt0s2xo(m nudame  ivs tfs2rmx  ;t0oexomf3ilt s ran s;u0tetomr3oatlpDrauvo;s0sexoxm3io4om nmnvt t)s2rr(root4tleomfetatfm em(msn()altoio iydlmtr u s;s0 2umio iu4om elnesl(f 2rr(mpou1tltoifcilt s ra( onu0trxrxr3tydfatrliei ( tetoxm oodll   ivils)a2trx ont1ope mietldfmDraumsnu)tltnxf iydfm  anvi;()srtrxmpoodaptemict ( a2uaum no1tltnmo3iydfa2rm( o;(0tlenio3tatlpDrluvslt)sexo(r3oy4al nmfciat)s2rmurono1oltnioeiyd mDua( onu) exrxo iydla rli i t)sexmxr3ou1altn fcias)a2umxront0oee micils a em( o;u4alxoifctatom rln sls)teto(m iy4optnlnes t srur(mpou1tlto ictyd sDuaump;u)trxomrcto1lmDranvi;()sruoxopnu4om   fciatfa2tr( o;t1alenmieiytls eaums;t4altrir3totlat auvo s0teuoimpiy1am e nctl()a2urxm no1opt if3tyd aDuanvo u4tlxoifcoydlat lneilt0s2uoiopoodlpee nei tf rtr( ooo1oeenio3ild sDea(mon()tltnxr3tatlaDelivol() rtrxopiu4al   fcil() rtmu  ;u4tee mieiad s2emumo t4trtnmf3iatlaD  neo;t0 etrxm io1lmtnmnet sfsrrrx  no0aeen feilslm2ulnvp;t) lxnxr3oodfatr ies s)srxrxr iydlm nlneiat) rtmxrpoo1oexnifcilsfs2uaumont0alxrxfcia1lptraivs;t0trtrxrpiudap nmfvsl()a2taxmpot4aeenmi3iyslm rm(vo (4 rtoio3iodfa  aieil(0 rurim3oy4amt mnci sfa2ta(mpno1tet  o3ilt a2elums t4areoxf3ty1fp r i sls truo(o3iydomte nvi t aDrmurpnt1tee  icilt m2rlnmpnt4artnxf3oy1lmt lu slt)trto(rpoy1lptelnei ( s2urumonu1apenmf3iytla rluvp;t0artnxf3oatoatelnes;t0sruoio3iodameemnesl(f ruaxrpot4olx ioetysls2ua(vpn(0aeenio3oodoaD lueo;s0 rxrirpiy4lm e nvias  rtmx pou0tlt  iciadfm uauvo;u4 etnxr iy1laDr i o ( t2umiopou1ole  icsl()aDtmu  no4tpx ifeiaslm ulu sn()areoif3iy1lptelu i s sexrxo3iydale  nvtat aDua(m ;o0oeeo o3tls a2umu s;(4 lxrxr3oa1om   nei;s)truoxopiu4oleemiciasfa2um(rp;t4ape  o3iydlaDumnmp u0aeeoiocoatom r neo;()setr(rpoodol  livil( a2rm(rp;u0aptnmfciysfm emuvont) rxrxr3totlmD ai o (0t2xmim3nydlltemiet sf 2rmum ;u0tee ii3ias a rmuvpnt) rtnxo3iytfmDrluvo (0srtmxr ou4al   icta()s2tm(mono0tle  oetys m2ulums u0aetoxr3iotfmDelies t teum(rpou1lmeemfetlt sDtru poo0oee ioeiys m2emumsn(0 eenxrcoo1lm e u o t0 exoxr iy1llte ivs t aDtax  nu1olxnifciltfa umumo;u0alxoxfctotfatrlnvilt)truo(m3nu4aptnlfeta( aDumx ooo1tle mo3ilslmDel(mont4altnio tytopDrluei;s0 2xo(m3iu4am nmnvia( srtr(mont1tpe  oeiatfa2eau o () rtnxr oa1fmD an s;t texr(o3no4lm elnesat sDrmxr ;o0apxnii3ildfs2ran p t)alxrxf iadfaD aieolt) exr(r ny4optemncia()aDuaxro;u1teen iciys a2el( s (4tlxnmf3iy1fpt ln s s  eurxm3nu1lptnlfciat sDrm( p;u1aleoioctatfa2em(mp;()tltnmf3oadfmDe nei s srxo(o oodam n nvs (fsrur(root0apxo i3tlt m2rlnvp t)alenxf3tatfat  neo;(  etoxr nodope  icslt aDtr(mpnu1apeoiictydfs ea( o (4alermf iydlptranes t t2xoxmpou4llen ici s)srrm(r ot0optn ieiyt m2rluvo t)artrmrcia1lm raueo;s0t2tm(r iy4lltn ivs (fa2rru pot0oltniiciydlaDem( s t)tlenmf3tytopt livo (  exo(o iydam elnvsas)aDrm(rp;u1aetoio3tadfaDrm( o ()alenxfctadfp   n o;t  exoim iu1opte ivs sf 2ra(r ;t0tlx mieiys s2rl( sn() rtoio3ty1omDr nesls  euoim nodlp  lncsa( arra( pnt0aeen iciytlaDem(vs;t0aeeomr tydla rli i ( s2tmimpoy4ll  lietlsf 2taxr nt0aet ifctydfm2ua(vp (0aetrxoctotopt  ivo;s seurxopoydlmtnlfcta( s2ta(r ot4opxoifeildlaDelnvo;(4alxrxf ia1la ean ilt0s2toxo ny1lmtelicias) rtrurp;t4tpxn ociad s emnmp;(0artrif tatlmtelneo s) eurimpiudlmt mnet () Dtr( pno4oet  f3ilsfs2rmu pn(0arerio io1faDrlnvo t0 rxr(r no1lltn ics (fs2rax  ;t4tlxoio3iat mDumuvs;u4 ltrmf3tadom r n ilt trxoxr oudap nmfesa() rrm( ooo4apenmieias sDea( o;t4trxrxf3ty1lmD lu sls0s2tmimpio1apenlfcs t) 2tm(rpoo0opx ifctltlm2em(ms () leoifcta1omt lies;t texmxr3iu4lmte nvt () Dra( pnt4tet mfeiltfs uanmpnt4altnxr3todfmtr nes ()sexrxm nudlm nlnvias a2tmxmonu0aeenmfciltls ua(vpn(0tlxoif tatop rlu slt) exmxr iy4olen ivt s)sDrm(r ou0tpe mi3ildfs2ra(mont4 ltomrciy1la rlueo;s) rtoxm oy4ole livsat  2tmx  nu0tex ii3iatfs2rm(mp;()aeerif iadomDr nvs t0teuoiopny1al e nct (farum(  ou1tetoiictlsfa2el(mpnu4tlxnmrcty1lm  au sl() etoxmpio4amtelfes ( srtmu o;u0altomfciyt mDem( o;(4 ltnxr oo1fatrluei;s0s2xm(m3oo4omenmiesl()s2rmumont0tlenmi3tysls rluvpnu)alenir oy1omDr ueolt)t2uoimpoy4lmtnmfvtas)a2umx pno4ale  fciydlm rln s u4tltnmf iytoaDe iei t teumir3nu4lpenmfvi t s2ta( pno1tpenmieiys m eau p t4altrmr iydoptr uvi s0t2xoir io4oltemfcsls  Drmx pou0tetnmoeildfs ra(mp;u4trxnxf3tydfm r uei;()s2umxopno4optnmfetas) 2rrx ooo0tee moeiat s el( snt0 rerif3tytlaD aiesls)s2ur(rpou1omtelictl(fsrtru ont0ape iieiyd mDulnvs () lerioctadomDe u s;(0 etrio3iydomee ivsltfsDrm(rpot4oexo octldla2rm(vp (0trtomfcootfpteauvo t) eum(o3oy4ll  livils)a2ra(  ot4tptomfetyslaDulu p ()artrxf3tatoaD lueils0srxoxr iy4ape  ictlt) rtm(m oo0tex mieiltfa emn p t0arxnmf3iydfp  aieilt)s2urxopny1lm e nvt ()sDtr( pou4oleomf3iad s2emumpn(0tltoxrcoa1fm rauvsls t2xoir3oudolenmfes t)artmu oot1opx mi3iatlaDem(vp;u) exrxo tatoa elnes;t0seuo(o3nodlle  neta(  rumurooo4tpenmi3ilt s rmumo;t0alenmo oo1oa  ai o;t0setmxopoo1apt miviat s2ta(ro;u0tpt iiciysfa rluvs t4 etnmrctodlmD auvils) 2urirpiydameelfcslt s2ua(ronu0ale mfeiltfm elnmp (0alxrxr to1lpDrauvs (0t2ur(mpiy4llt  ictas)sDua(  nu4oleoifeilslaDrm(mp u)altoir to1lpDeanvo;(0srur(o nu4optelfet (farraxrp;u0tlx io3tadlm ul(mo t0 rxrir3oytlpt anvils  rtrxo3iy1alenlfcil(f rtrurpno1alxnifcils mDrmuvp;() etoxo3iytfaD  iesls)trtoxrpoudamtnliesas) rrau  ou1olxomo3ilslm rmumon(0tleoio todfp raieo t)setr(rpnu4ap n fvsat)srtrx pno1tex  o3tlsfaDulu s t0alxomrcoo1fmDe uvils)srumirpno1optelfcta(f 2tau oot0tpxnmictldfa ranvo;u0alxnxfciytlptean s s0t2to(m3ou4aptelnvsl(f 2ta(r ;o1oee mf3iad s2rmuvs;t)tlxomo tadfm eanvi t srtoir nydomee ieiatfaDra(mono0olxoifeiltfmDumu o u4alxrxf3iotfpteaivs t)s2xoiopnydaptelivils)arrmu o;u0alenmfciatfs2uanmsnu)artrmr3totfmDe ues;t s2tm(mpio1lltn nes t)sDumxmo;u1oee iictlsla uan s ()trxrxo3ty1fpte ieils  etr(m ou1amee icsasfaDra( p;o0ale  oeiydla2uln s;(4 lenxoctotopDe ueslt s2tm(r3iu4opt mnvt t)a2trx p;t1tpxniictytls2emn p;t) etoiocto1fm  ln ol() rurir nodlmtemfvta(  rurx poo1teeoifeilslm2umuvo;u4tlerio tatlp   uvo s  2toxm oydlmtn fvsatfa2trurp;u4oexnii3iysfm2um(ms;u4arxoxo iatfaDe u i;s texoxm3iu4alt mivtltf 2urumpnt4texoif3tyt m2rlu s t)tltnmo3oo1lp rauvi;s)teumxrpiu1ll nlfcs t a2tru pou0alto o3tys a2ulumo t0 leomociydopDraneo t0 etoim oy4aptnlict sf rtru oou4tetn iciad a ua(vo;() ltnxrcoa1fmD li i;( t2umxr3iy1lm elfvsat) rraxrp;t0texnifctas mDeau on(0teenifcoadfmtrlnvo;s0 eumxo iy1alte neiat  rtrurp;t1teto oeiaslm2elu pnt)alxoir oodlaD lu o (0trto(r3no1ame  fcta( aDtr(r oo0oeeo f3iaslsDea(ms t0 lxnio3io1fpDrlu sls) rumiopny1lm emfcta() 2tmur ot0aex mi3tyt a2uanmp;u) lxoioctytfp   ueol(  exm(opiudome mfviasf rrr(mo;t0oexomieiad s2rl( snt0tltnxrcoa1lmD  ivils trxmim3no1olen nvs s) Dtrxronu0teeo iciad aDel(vpnt0alxoxfcta1oat anvi;s0t2urxmpnu1lltnmncs (farrru pou4tlt ifetydfa2elnmo;t0 etomfciy1lp ean o;(  etoxm iu1llte ies () 2uru  nu0oeeo feiytfa rl(mon(0 exrmrcoodlmtrai olt)t2xmxr nu1oltnlfetl( s2tmxront1aexn fciyt a rmn p;()texrir oodfm ean i (0 2urxo3io4amte iesas  rur(mpnu4tetnmfeilt mDrlu o;t) etomr3oy1lp ranvi t0t2xm(opiu4lp emnetltfa2rmumoou0opxnmo3iydla elu p (4texnif iatoate nvol()seto(r3io1op emicsasfa2tr( p;t1alt mfetydla2rl(vsnu0trxoir3ia1fat  nes;s teumxo3oy1lleeliei sfs2tmumpnu4aptniieiatfm ulumpn(4tetrircoytoaDrlueslt) exrxm3no1ol  mfcia(f rtmxrp;o4oltomfeias s2elnmo t0 etrio iotop rlivo;( t2xm(m3oy4amtnmnetls) 2tr(ro;u4oet  oeiydls umnvs t)artrmociytfmtelivs;()t2xoxrpio4al elieias sDtm(mpnt1oltoif3iyd a2umn s (4texomf3ia1laDr ieils0texoxo nu4lltn nct ( aDurx pno4optomietld s um(vs (0trxoif ta1op   nei;t) ruriopnu1lpe  fvia(fa2uau onu1tlxomoetas mDumumpnu4 rtnxf3oodop   ivol()s2tm(m3nydol e fetatfaDtax pou0altnifetytlm uanvpn(0 eenio3oydfmt li o (  exmirpiudol elivtas) 2urxm ;t4tpto iciysfs2emn p t)tlenmfcootlmtr u i;t0truoxopiy4op n icsatfarrm(  no1tptomiciad m2ua(mo;u4 lenmfcoy1lpDean slt)teto(opoo1lleelnvi (fs2raxr nu0tpenmo3ild a rlu p;t4aeerif3ty1fmtrlu o;s0trumxm3iu1al emfct (fs2urxr nu0aetomictyt s ea(mo u4areoir3iytlm eluesls0 eurxrpno1apenmfeslt  Dumxmpnt0tex ifctasfs el(vsnt4 rtomfctodfp  au o () 2xo(r iudapeelfci t srum(mpnt1oex iociyt m2rmumsnt0aleoiocio1fpDr nes;() eur(m3iu4ll   icsat) Dumumo;o0tpto ieiyslmDra(vo;u)tleoiocoydfp eai s s t2xoxmpno4apenmnvi t  2umx  ;t4opeomictadfa2rln snt4trtnifcoy1omtr n o;t0 2uo(mpno4lp emieils srrrx pnu1olxoiiciadfa2rl(mon(4tlxnmr3oydop r nes t)seur(r no4ol n ivsls s2trumpnt1tle mf3tlsls2uau s () eenxo3oytfpD li i t)trxm(o iy4ameemfvi (fsrurumo;u0tetoio3tytls2rmn sn() ltrxfcoo1fat auvo s  eur(m3oydop  mnvs tfsruaxmp;o1tpxo i3iad a2ra(mo;u) ltrmf io1om   n s;s)srtrir3io4amen fvi s) 2rm(mpou1opt ii3iydlm rl( ont0artnif3iadlaDraueols)srxrio oo1ap nmics (faruaxroou4apxo f3iadfm elu s;u) etnircta1lateaneo s  2uoxmpiu1llee fvi t) Draxm ;u4apt  iciydlm2emn pn(0tleomrcoodoptelivo;t trxr(o3ny1lmen ivils) 2ra(mont1aptnmiciatlaDem( pnt) ltoxociytomt  n i s)t2uoim3iy4optnlnctasf rurxm no4tpeo fciyd a2umn p t)aetnif3ty1oaD aneils)trum(r iu4amtn fcta(faDta(m no4olx mfciytfs2eau pnt0 ltrxr3tadlmDeau olt trtmir no1amte ivs t)s2ur( pno0olxo fciadfm rmn s u) rtoif3iodoa   u ilt0s2toio3iudlpee ictas)srtrxmooo4aexoiictad m uaums;()aeerxocoy1lmtean s s0s2xmiopoy4om nmictas sDurumo;u4apeoiociltlsDelumo u4 eermf3iadfm r u ols s2xr(m3nu1lm   netat)arururp;u4tetoifciytfsDrlu snu0arxoif3oy1om ean o s)texoir3nudlptemfesa(fsrta(  nu1apenmocildfmDemnmo u0 lenmf3totlpD  uei;(0srtr(m3ny1lp elfct ()srrmx  ;o1ope  f3iasfmDuanms;(0altrio3oadfateauvs s0teuoxo ou4apeelnci ()aDuaumono4apeomoeiad a ul( s;t4alxoiocoy1omD aivilt0srtrxopno4lle mneil(faDumurpnu1aetoiietldfa2uaumo t0 lxrxo3tadfmtelneslt0t2toxm iudlptn nesatfsruau ono1tpeoioeilt m2rm( pnu4 etoxfctotom   n s;s)s2umxrpnydape lnvsatfarra(mo;o0open ieiasls ran s t0 rxoiocoydfmte ues;s)setoirpno4ap nlfet (farra(r ot0alto iciadfs2elnmonu4 etnmfcoa1optrlieo;t0 rxrim3iudllt mnciltfaDtm(moou1opt ifctysfaDulnvp t0teenxo tadfm   iesl(0teurxr io4lpte fct sfarra(m ou1aetnii3tysla2emnvs u4aetoxocio1om eaivo;t0s2xm(o3oodllenmnciasfsrur( oot0olxo f3iadla2rau sn()tltoxo3ta1laD li ils seur(r ou4llte ici (  2ur(  ;u4apxo octyslaDuluvp u) leoio tytla   nvs;t  rtrxrpny1ll elfvtl(f 2ur( p;o4texomi3iydlmDeauvs t)trxrxf3io1oaDrlieo;( srtr(mpnu1om nmfcs t) 2ta(ro;u0tpxomo3iltfaDuau s u0 ltoifcio1fpDe uvol(0 2urio3nydapeemfet s)arrm(  ou4tpx moctydfm2rmumpnu0tlermf io1lpteliesl(0 rxrxr3oo4lltemnei t)arrax  ;o0tlxnif3iytfa el( p;t)tetnir oatlpDe i ols0trurir oudop n fcil( aDra(m no0ole iieiatls ul( o;t)alermo iotlpDrai i t)teuoio3oo4lp n netat sDuauro;t0tlx  feiadfaDuluvont) eeomfciodlmD  ivo;t t2xo(m3io4olte fcslt)a2umu  oo0apenmfeiydfa2umn s;t0tlermo3oo1la   n i;s  eumxrpoy4ap n netl(fs2tm(m ;o4aleo i3iyslsDeau s u0altrxr io1fpD lu o t0t2toio3oudol emfeil( aruaurp;o1aex mi3tatfs ea(mont4 ltnxo3ty1fmtrlnei s seurir iy4oleemneta() Duauroot1open i3ilt s2rluvo;u4trenif iadlpD ai s;(0trxoxrpno4ll n iviatfs2ur( o;u4ale mieiytla ul( ont0 eenmf iatom  luvo ()seurio3no4lle  ivtlt)aDuru pou0opxnifetad s ra(ms;t4 reomr todlm rau o;() eumio3iydlpe lfcslt)a2tm(rpou1ale  fetasfs2ul(von(0 lxomf3ta1fmDrau s;t0 rtrio3oydlltemnesasfaDumu  ou4oetniociadlm ul(vsn(4aetnmo3tytfmt li o;s0tetr(opoydam  mici t)aDurx pot0olxomociasfm2ra(monu4teenxrciotfat  uvs;s0 2ur(o nu4ol  mnvta()arrrxr no1oet ii3iyt a2uanvonu)alxoiociatopteliesls0trtmir3oodlle lncta()a2ur(m nu4oeenioeiyt s2ea(vpnu0arxrxocoa1lptraivs s) 2toxm3oy4optn fvtltfa2rau pnt4tex  ieiysfa el(monu4teeoio3tytlpte i o ()srxr(r3io1alee nesat sDrru poo1tle if3tltfa2uln pn() exnio iotom ranvo t0sruo(o3oudol  mivtasfsDur(  ot4aexo f3iytls ua(mon()aexnmr3ootfmD au s;s  2toimpnodamtemicils)artmxm ;o0tlxnmi3iasfmDrmnvs;u)tetnircoo1fat  ivi (  2ur(rpoo1lpte nvt (  2umu ooo0alx io3tatfs ul(mp;u)tlxoir io1fpt lneils)setmxmpno4ap  lnvias)s2urx o;t0oet mfciydfa2uanvpn()artrxo3oa1opt aieo s)srurxo3iudalee fesasf 2ta(r oo1tetomfeiyt m rlnmo () rxoir iadla  an ils)seur(m oo1lmt mnct ()srtrx o;t0tpxo o3tld m2ran o u0aeenxfcoa1fmDrau il( setmxm3iudlpe  fviltf 2ra( p;u1aexnmicilt a2um(ms t)teerxf3iy1laDelueo;t)teurxrpou4am nmnei t sruru o;u1alxn ieiatlaDra(vp ()teenirciy1lp  aivi () eur(opny4oltn ici t) rumxro;o4tlt  fetytla ua(ms u4 rxrxf iotlaD  nvs (0t2urir oydamtemietls) Drrur nt4apx mieiyt aDrlu pn()tetrir3totfa r ivo s0srxo(opoy1aleelneslt) Dtm(mp;o4aetnmo3tytlsDel( p;()tlxrif io1lpt  uesl()trxrio iodlm elict t)s2ra(rpnu0openiietas m eaumsn() etrir3tydoa  aues t teuriopio4lmee ncilt aruaxm ou4aexniociatlmDuanvp u4texoxfcoydop  li s;(  eurir3ny1ope mies sfsDtmu p;o1oeenmfctld a2umuvs;u0trtnxo3oo1opD au sl( s2xrxopiu4lmt mfvt t) Dtmxm ou1ole  fcils mDuanvon(4aetoxfctytlm rai s;()s2to(mpiy1lmt mfvs tfaDum(rp;t1tetomi3iasfs el(mpn(0 lxoir3oodlaD luvi t  exoim3oodlme lnei tfs2trxm ot4opeomiciydfa2eauvo t0teermo io1lpteaieolt  rtmxo ou1lptnlfesatf rrru poo1apx moetydls rlums u4 rtrmrcto1omt  ueil()sruriopiudlmtnmnvi sfsrrru  ou4apenmoetadfaDrlu o;(4aeerxr3iy1fptelu ol(0texmxm3iudaltnmfvtat)s2ur(rpnu0alxniieildlmDeluvsnt4 rxoxr oytlpDe neo;t)s2toio3no4lle  fet s)sDtr(rpot4tltnif3ildfa2ea( pnt0altomo3iytfpD lnvo;t0trxmio3iu4alt mncils) ruax  no0oexn f3iat a2rm( snt0tlenmr3ta1lmt  nvi;(0trxmxo io4lpe  ncil(fa2um(mpot1tetn oeiydlm el(vpnu4artnifcio1om  lueo t  rxmxo3oy4om e icils)artmu  ot4tpxoifciltfs rmu pnt4 etnxf ia1oaDrlueilt0s2tr(r3oy1lm  lnctlt a2tax p;o1tex  ictld aDemnvsn()tlermf3oo1omt luvo;( s2urimpiudlp  lfetlt  Drrxm ot1oltniocias sDean o;u4 etoxr3iytfpt auvs t sexmimpno1op   fcs s a2rm(  oo4olxoio3tydlmDrluvp ()aetnxfctodfm elivi;t texrxo3oudop elfcsasfsrta(mo;u0oltoif3ild mDum(vont0 rtoircty1fmDr ues;s  2tm(m nudlm emfesa(  2ururp;t4tlxoifcils s2rlnvp t)tlenmr3iydfpDeau i;t texrio3iy4lmtnlnes (f 2tau pno0tpt if3tlt m2emu s;u0tetrircia1oateaies (0 rumxm3io1omtnlietls  Dumum ;u4tpe  feiatfm rlu p u4tlxoxoctadfp r neol(  2xoxmpoy1aptnmivslsfsrtr(m nt0tpxn i3iyt s2rlumo;u4 leomfcoodfmte ieilt t2uo(m3nu4llte fes tf rtmurp;t4tle  feiysfsDelnvp u)alxomo3oydoaD lu o;(0 eumxm iy1op nlictas  2urx  oo4alenmi3iatls rm(von(4aetnioctatlp r u s;()sexm(r3iu4lmeelnciatfa2tr(mont4aptnifctadlmDum( onu4alxrio3to1fa e ivolt) eurirpio4omeelfvtl()s2rmu  no1aexn iciat s rluvs t4trermrctodfpte n s;t0tetmio3iy1aptnmnci t)artaxrpot0openmieiysla rl(vont4 rxnmr ta1lmDe ueo;() rumio3ou4lpe  fvta(fsrrr(  nt0teeoioeiytls elnmpnt0 eeoxf iy1om eaneo () etm(r oo4oltelicsas)s2rmu oot1altnioeiadfs2ulnvp;u4trxrmo todoa  luei (0s2tmxm nu4opt lnesasf 2tr(r ou1olenifeiydfaDum(mo u0trenxr to1oaDraneslt s2toir3nudlle mfciatfsrtmuro;t0oet iieildfa2umnvp;t4tltnxr oytfa e ies (  rurxm3no1ap  lfet (  2um(m ;u0apto feiyd s elump;u4trxoio3oodoat auvol(  2xmiopiu1oltnlict s) 2rax  nt0olt mfctyslaDrlumo;u4trtnmo oytlatranesls)t2tm(m3oo1lp nlfvsls aDtr(mp;t4texo oeild aDul( snu4 lxrxociadfa rli i t) etoir oudamt  feslt) 2urxm ;o4tet iieiytlsDum( sn(4 lxnxo3tatopt ln o ( texoxr oy4ole mivia( srtmxm nu0tlxomfetld mDrmuvo;u0aetrmo3tadoptr u i s  rto(m iy1al nmivi (farurur ;o1olxn octat s ra(monu0alermo oydop r n ols teum(o3ny4omenlivtasf rtrum no4tpeo fciad m ul( o;u0 rxnxo3oa1faDeaies;s0 eumio3oo1am   nvtl( s2tmur nt4oetomf3tyd a rmn s (4aetrxo ia1omt  nvo;s t2tmio3oo4aptemivtltfarurumpot4tlt  oeildlsDeln s;()trxnxo oodoaDrln s t0trxm(opoo4om nlictatfa2ur(root0ape  fetysfm2ul( s;u) rxrxfcoydopD  i o s s2umir3nu1apeemfcilt a2rru oot4teenmoeiysfs rlu o;u4alxnxfcoy1oaDrlnvo;(0 2xr(rpoy1apeemfct s  2ta(mp;u1tlenmfctld a2eanmp;t)aleoxo ta1latr iei;t)sexo(rpiy4llte fes t  2taump;o1apxnmieildfm ra(vsnt0 rxrmf3io1oaDrau s;t  2xo(opno1oltnmneils arrm(mpot0tle mi3tydlm2rm(vp t4 reriociytop  an olt0teumxrpoy4lmtnlnesas  2rmxrp;u4aptnmfctadla rmums;t) ltrmfcoy1oatran sls)s2tr(o3oo4alt mfesas arta(mo;t1tptn f3tasfaDuluvsnu4trenifcootlpDrluvols0trtm(opoy1omee neia( aDumxr nt0tltnmi3ilsfmDea( o ()artoxf iadfp raueils)teumio ou4apt lies t)sDra( pou0tetnmf3iydla2rmnms;u4artrmf oo1om  aneo;s teumimpou4omeeliei t  Drm(mont0aex  fciyt s2ua(vp;(4tltnmr3tadfatrlnes;(0sexrxopno1amenmneil() Dua( ont4aeeoiietysfs ua(mp;t) lxrmrciotfa ean s;(0 2tmio oydlmenlncilt)sDrrxmp;t4tpxnmi3iatlaDrm( p;u0 rtomf ootfaDrlivs;(0 euoxopoydameelfcils sruax  ;t0oex  fctadlaDumuvsnu0trxnir iadlp r uvolt  rxmiopiy4lleelicsasfa2tm(ront4opto ictyd m2umnmp (4 ltrmr3ta1fmDrlues;s)srtmxo3iu4olte ivi s srrrumonu0oeeoiociysfm ulnvpn(4aleomf3ta1om rluvilt sexmiopnudll   nes t)artm(mp;t1tlt mfciatlmDra(vp;t0aeerxf3oodfpteanvo;s0setmir3iudoltemivs (f rumu  oo1aexnmfetatla
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;()t2urimpoodamtnmfeia(fsrtmxroou1oet io3iyt s emnmonu0tlermfctytom eluei (0srtoxrpoudaptnlnet t aDuau pnu4olxo oeiytfmDemnvo;t0 exnmrcoytlmDelieo;t0 2uoxr oo1ap e ncsas  Dtm(m ou1aex  feildfa2em( o t)aexriociytfm  auvslt0 etmxopiu4ale lfetl(faDtmx pno4oleomieiys m eau sn(4 lxnio3to1lmtr nvilt trtrxo3iydalt  fci tfsDra(r no1aexomfetls sDrl(vsnu) rxrmociatlmtr ies s0 etr(r no1oltemies tfaDtau ont1teeomoetltlm rlumo u4aeenxo iytfa  ln ols)seto(mpoy1om n fes sfaDtrxm ;o0tle ioctlsls rau p ()texrmr3iotfpD au i;s)srurxo3iy4ope lieiatf 2rrxronu0ope iociysfmDel(mp;u)tltnmr3ty1oaDrln s;(0 etmxopoy1ll n nvsa()a2tmu o;o4opx  fctatfm2um( o (4 rtnxr oodopt lneol(0s2xmxrpio4olen fci ( srumxront4tltnmf3tlsfm2uanms;u) lenmf oydfpD au sl()texoir3oy4ll n fvil( aDtr(ro;o0alxnioetyd aDranmo (4arerif oy1fptelivilt) exr(opiy1omt mivsa(f rtm( o;t4tlx ioctat a umums t)trtniocootlpt aues (  2tmirpoo1altnlivsltfs2taxr oo1tpxnmfeias s2umu p;(4 rtnmr3iy1fm  liei;t0 exm(o ou1olenmivsl(  rurxm ;o1oet mf3tasls2umuvpnu0arxomo3io1la r i i s t2um(o iy4ol  micsa()sruau ono0tetoio3iadlm uanvpnu)tlxnmocoatfp  lnesl(  eum(opno1amtnmnvtlt) Dum(m ;o4aee mociydfm2uln pnt4tetoxr ia1laDranes s0 rxrxo3iy4lptnlnvsl( a2umxm no4tlenmfetytlmDea(ms (0 rtrxf3iatfpDr ieo;(0t2xm(m iu1olee iet s)s2tmumpno1aee moeiytfsDeluvp;t0artrmociydfpt lneol(  ruo(o3nydlmeemfci s  2raum ot0opeo ociat s2el( p u) renio3tatoatrlu i;s) euoxm3no4alen nvs tf Dtm(m ;t1alt  fcildfs2ran p (0aetnxrcoytomD lueolt) rxrir ny4alen nciat aDurumoot1tpxomi3ils a el( snt)treoifciotfatrluvo ()truo(m3iodomt mies ()sDurumono1tetnmo3ildls elnvo t4arxnmr oa1fp rlieslt texoiopno1ap nliesas s2rmxront4aeen fciltls elumo;t0artoirciydlp rai sls)t2urio3nudamenmicilsfs2rau o;t0aee  fctad s emnmon(4aleoxr tatoa elivo s0srurir ou1aleemict s)arrr( o;o4tee iociydls emnmpn()arxrir3ty1lpte neo s t2tmxo3iy1oltnmnct sfarta(  nt1oetomietys a2umums u0aleoxr to1om eauvo t0 2umxm iu4lp n fvi ( arraxroot4tex  ociat aDean pnu4aexrmr tytfmteaies s texr(m nu1lleemfcilt)sDurur ou0oexo ieildfs2ean p;() lxrxo3iotlmtelivi t setr(rpnydol elnciatf ruax oot4apenmfciadls2emu p;u0trxnxocia1fpt anvilt) rumxm3oudom n fct s) 2rrur no1tpenmo3tyslaDulnmpnt0aexnmf3tatop eln i;( trxr(rpou1ol nlfci ( sDtmu  ot0altoio3iytlm2rmnmsnu)aetnmr3iydlaDrauvils trtmxm3iy4ape mnesat s2uax o;t1oleoiiciysls2elnvpnt4teeomo3oydop  li i s0t2toim oudllen fvi s srtmum ;t0alen fctatls2rln o;u0tlermf iodlaD  nes;t sruoxrpno4ll   ietl() Drmxmpnt1oeenmo3iyd s2ulums t0trxniocoy1late u o s0 rtmimpio4alt mfcsa( sDrr(  nt0tex iieiltlm rmnmo t0arxnir io1omtrluvi (0texrxrpoo4op n ncias a2raxroot4opt mietatlaDulnvp;u4trtoifcoydfpD au s t0trtm(m oy1omt licslsfa2tmx  no4tee mf3iadlm2raums;t) exrxo3oy1la eluvsl( sruoiopnu1lme livsa()artmurpot4aeto ictat a umuvpnt4trermo oydoate nei;s0 rxoxrpoy1omtnlfesl(  2tmx  ;o1teeo ieiyd aDem(mo;t)aeeoxocta1fp rauvils  eumio no4am  lnesa(  2ur(r ou1oeeomi3iasls umnvp;t)aexrio oatfa  livol(0 eurir oy1lltnlnei ( arrruroot4oeenmictysls ulu p;t)tltrirciodfpte nvi;(  rxr(opiy4amtnmfvia()aDtrumo;o0tltniicilslm rmuvs;u)arxoxfcoydfm eanvi;(  eumirpnu1op  mnei s) 2rax onu1opxomi3iydfmDeauvs (0 ltnif oytfmDeaneo;t0texm(r ou4ll   ivs t) ruaur oo4olt mo3ilt s2em( p t4artrircoydfat lieo (0s2xoxrpnodalee netl(fsrtau o;t0alxn ieiadfmDrm(mo (0aleoio3to1fmDr u s ()s2toir io4aptnmfeias) Dtmumpnu4apxo fctasfm umnvp u0teerircio1om r n s;t0 rtrxm3iudlm e netat s2raurpno1tleoiieiysfm umums;u0trtrxf3iydoaDeli o;( srurio ou1om e fes s)sDtax  no4alx  i3tysls rmnvsnu4 rxnif tydlaD lieo;t setmxm iu4openmiesatfa2ta( p;t4ale  octldls2eaumsnu) leoir oy1lptr nei;s sexoxr iydopt livia(f Dum(  ou0aeeoioctadfaDem(ms;t0 exrmrcoydlmtrau i t0t2xr(m3iodam  mnvtasf Dtmx  ot4olenif3tad aDemn o;u0texoir3oatfpDeluvo;s teur(opoo1ol emneiasfs2um(m ;o4alen o3iadlaDra( p;t4 rtnircto1lmDraueslt  rxm(o iu4lptelfvil() rtrxroou1opt io3iasfm eanvs;()treoio3oydop eaiei;t) eum(o3io1amenlivias aDumxront4ale  fetydfa eln p u4 etoio3oo1oat  i i;s)sexoxrpnydlpee neta(fartm(m ou4tltnmi3ildlsDranvp;t4 rxnxf totfpDeau ols s2tmxr io4lme lfetas  rrr(mp;o1oltoiietadlaDrmuvs;(0aleoio3ty1lpDeliesl( seuoim3nu1ameelnesat) 2umx  ou1alxoiieiasls em(von(4arxnif3oa1latr neo;t0 2toxo nydomtelfei s sDua(mpot4alenii3tat m ean p (4altnxfcoadfmtr uvs (  ruoir3nudlm elivs ( s2rmumono1ole  oetyd m umumpnt4arxnif3iatfm  luei;(  rtmxm ny1alt mnesl(faDtrx ont0tpe iociyt s elump;u0trerifctytfptrlu sls) 2xoxopoo4lmte nviat)aDrru  ;t0tlxo ieiyslsDelums u4teenmr3oo1omte ivslt0t2xm(opiy1olenmfcsas artmxmpou4oexniietadfa2eln o;(4 lxrxoctodfpte ivil()s2umiopio4lptnlfvtl(f Durxmoot1oeenmieild mDul(vo t4 rtoif iotfmDranei;s)t2uoim iy4ome lfvi ( arua(m nt1alxo fctydls2ran s;() leomrcia1oateaivi s)teuo(r3iu1amteliei t)srurx oot0oexnmfciyd sDumuvo u4alxomf iatfmDrlnes;s)truoiopoy4ope  nvtat s2uauroot0aleomi3ils m2rl(vpn(4aexrmo3io1oat  i i;()s2xm(o3ny1amt lfesasfsrrm( ono1oee mi3iyt m umnmp t0 exrircoo1lmDr nei;s) etr(m3oo1om n ictas aDrrx o;u4tetnmfetysfaDelumpn(4tleoxr oa1omDeluvilt0 2uo(m3oodlmee ivs sfaDtaxmpnu0tlx mo3ilslm uln p (4tetrif tadfmDrln o () 2urxm oo4ll elfctat  Dta( oou4aee  ieiatlmDelnvo u4 etnxr3iotla e ueo t srxmimpno1amtnlnes ( sDumxmonu4tlxnmoeiydfaDrmump;() rermfctatomte i o s)trtmimpno1lmenmnesl()aDtmurp;u0aexnif3ils s2um(msn()aetrif ia1om  lies t) rtrxm3ny4am   ictlsf rumx  no4oexo feiydfaDuauvo;t4 renxr oydopte ivs ( trxrir io1lleemnei s artrumpnu4olenif3iltla2ulums;u4 eenxfctodlpDranes (0 2xo(opou1lpt mfeia()a2rr(ro;o4tlen ieiydlaDrmnvo;u)tetriocoydop e i o;t  rtmir oydolenlfcilt  rtauro;o0tltnifcilsfs2emuvo ()teenxf oadfp e nvs;()t2tr(rpiu4lltnlicta(faDtm(ro;u1ope  i3ias s2emnvp;t) lenxf iytfm rlneo s0tetmim3io1lptnmnvt () 2rmxmo;u0apen i3iat sDeanmsnu4 exoir ootfmtelu o ( teurxo nodllt mfct (fs2um(ro;o0tleoiocils mDulnvpnu0aexnirciydoatrln ols t2trim oy1openmnetl( artm( pnu1alxn oeiasfs ea( p u4altnmf oodfpD  ivils  2trimpou1opte nvsa(f rraumo;o1aleomf3iydlaDrl(vp (0texrxf oy1oaDr ueol()srurir3oodap  mfes t) Duauront4tex ioeiysfsDrlu p;t) eenxoctadfaDean i;t setmxr3no1aptnmfesl()sDrmum nu0olen o3iasfsDrlu on(4arerifcty1laD lnvo;t)t2urxo3oy1lmtn net sfsrraxmooo4tlxomfctadlm umnmsnu0tlxnifcoytlaD anvi;()tetr(opoo1aptn nct (f 2ua(  ;o0tee ii3iydlsDem(vp;t)trxnxfctodop r neo;t)srxoxr nydamtnmfvtat)sDtmuro;o4aexn fcilsfa2rmnvo;t)aeeoxociydfp eauvi t)srxmim3oydomenmiei sfs2tmx  oo4optomo3iyd aDuanmp u) rxoxo3iydlatraues;t t2xmxmpiu1opt mnvt tfaDra( pou4ale ifciyd aDrauvp;()aexrif3oodoaDr uesl(0t2xm(m3oy1lpe  nvias)aDrmxront4aet  iciytfa eauvp;(0trtrif3iodlateluvi (0s2xr(o3io4oltelncslt)aDuau pou1aleomf3tyd a2umumo () lxoxrcto1lmDe u s;s seto(o3oy1omeelfcsas)aDta(r no0tpto i3iydlaDelums;t4tlxnxr3tadfpD  i o;s)trtm(opny1amenmnvs ( s2urxmp;u0tlx mfeildfm emuvs u4texoir ty1oaDe n i;s0 rtr(o3oy1optnlieia( aDumur ou1tltnii3tldfa eauvs;(4tltnio oytomD an i;(0teuoimpnudlm nmfcias)sDraxmp;t1apxnmieiytlm uluvo;u0 lenmo3iy1fa   ivsl(0 etoxopoo4opt liesa(fsDumxroou4altoii3tlsfa2eauvo t4artnxo tadoat au ols srtrimpoydlm  micsltf rurumo;o1alxn o3tlsfa el(vp u0tlermoctydoa e iei s) eurxopiu4al elnci s arumxro;t4oex  i3iydfm ua(msn(0teeomfcoatfa r u slt0s2uoir3oodom  licia()s2umxmpnu4aet  ieiytls2rl(vsn()alxnxr ty1faD lies s0srxrir ou4lpenmfvsat sDtaum no0tlt mo3tlt m2ulnvpnt4 exomr3iytfa  an sl(  2uoir3iy1openliet t)srtaxmpou0ale micils s rm(ms;(0altoioctadfpteaivs;(0trumxr3oo4ap nlfet ()aruax onu1oeenif3tyt s2elnms t4trtnifctodlaDean sl(0trurxr3oydalt  fcilt  ruaurpoo4tpe mi3iad aDrmnvp t4trxoxfcta1fp raues t)s2um(mpiydal   ivt ()a2tmurpno0teenio3tysfm umums;u4tltoir3to1oaDelnvs;(0srxm(m3iudol n ict t) rur(moot1olxoiiciytls umnmp u4tlxnmr3oo1omte i o (0s2xmxo no4opeemicil(f rur(r ot4tlen ociat s2ranvp;(4artrmf3oydlmtrlies s0srumio no1al nmfcsas)aDtmumono0oeeo i3iysfsDelnmp;(4 lxoxrcoo1omD aieo s0sexmxo3ou4olenlncil()a2raxmont4alx mo3ias a2ean o t)texoxo tatfm eliei;t)texrxmpnydlm elfcils)arrmxm no1tlx  oeiadfs ul(mp;t4tlxoxocta1fatrlivsl(  2uo(r oy4ll emfcsas  Drmur no1olt mfeiat m rluvsnu)trtnmo3ty1fa eai i t0trur(r3oudlmt livi s)a2urx  oo4oee  i3iytfaDuauvs;()arerxr3oa1oaDeluei;t)sruoxrpiy1apenmfctas  rururo;t4teenmo3tytls2ua(ms t0trxrxrciodom r u sls s2xrxo iy1ape  fvil( sDrmumpnt1teen o3tydfmDran o;t0arenxo3iodopt au i;s0s2xoxm3no4lmenlfvtlt)a2raxrp;o0texomoctydla2ranmonu0tlxnif3iotop rlivsl( s2umim nodom nlncs tfaDurx o;u1oet iietysfa raumpnt) reomf3totom elu s;(0trxm(opiodalen nvi s) 2tax pot4oleo f3tadfa uau o;t)areoif oa1omt  i s;s0t2umxm3ny1al nlivsat  2uax ono0olxn i3tadfs2elumo (4 exomocoytfmtrlueo;s0 euoxr nodaltelnvs sfsDrrx o;o4alx mieiydla rl(msnu0alerxo oytla rlneol() euo(mpnodoltemfesas) 2rm(rpoo1opxo f3iad mDrl( o;u4trxrmrciadlm ran sls  exmxo oodlm  lfvi s srtrxmpou4oexomictlt mDrmuvs;t) eenxfcoatlp  auvo;t trxmxr oy1lpt  nei ()artrumoot4tpxn ictasla emuvont0tltnio oy1om   n i s teumim iu4lm e ivilt) rur(rpou1texo oeiytls emu o;(4trtrmr iodlaD lueol(0setr(r oy1lpen nvtlt) Dumxronu1aeeo ictatla2umn pn(4texrio3ia1opDr ieo ()t2um(mpoo1om  lfeil()a2ta(m nu1olxnioctlsla ul( snt4aexoxfciydoptraneslt) euo(o ou4llenmfvi sf Dururp;u0tptn ietadla eanvsnu0trtrmrcio1fptrau i ( srtrirpio1opte nvt t)sDum(m nt0oltn o3iyslm eau pnt4trtnxf totfptraneo;(0t2uoim3ou1lmeelfvt t) rua(rooo0alt ioeiytfs2umuvp;u) ltoxf3todoaDelnvi;t0trumir iy4op n ivias arta(rpnu4tpt mociyslsDrluvs () ltrif iy1faDraivo;(0trxrir ou4ol  mfci tfaDtaxmo;o4oexnmiciat aDrmu o;t4 exnio tytfmtelueils)seuo(mpnydoptnlncsa(  rurxrpnu4tpeniocias a2ulu p;u0tlerxrcoodfm rlu s;s)trxr(mpoodaptemneta()artrxrpot1aeen f3tlslm um( onu)tlxomr3tydla   nvslt0truoxm3iu4ap emivsl( srum(r ;u0aexniieiadlsDum( pnu0altnio3tatoa   n o ( s2ur(r3oo4ol  lfetas arua(rooo1alxo feiyd s2emnmp;t)treoio oydopDrlues s0 etoxrpnu4lmenlnesas) 2uax  ;t4aeeomo3ias m rauvp;()tlermr3oadfaDelnvol(0t2xrimpou1ll nlncslt) ruau onu4open o3tlsfs uan s (4 rxrir3oadoaDelu o;s)trxmio3iudap nmfvt tfarrmurp;t0tpt mictyd m ran ont4tleoxo3ootfp e u ol() 2uo(m ny1lle mfci t a2urum nu4altoii3iydla2ran on() exoxo oatlp  auvols s2ur(o oo1omee ivsatfsDrr(  no4tpto i3iad a ra(mp u)artnxo3iadoaD lneolt0sexrir3oo4am emnvsa( sDtrumo;o0apxn o3ildfmDranvo;u4aexnmf3todlatrai o () rumxm no1lleemietls a2umumo;o1tlt  o3iad a2umnmonu) eenmr iatfm eau i;()trumxo io1lptnlivi t)s2ra(m ou1tle ifcildfs umn onu0 rxoifctydom r ieilt sruoxrpoudopt  fvsls  rum(mo;t1teenmf3iatfm ulump u4 ltoirciatlpDe n s s)trxoir oodllenlncslt aDum(mo;o1tee mociad sDrmumonu4tlxrmfcoo1lpte nvo s0tetmio iydomtemfetatf 2trxmp;t1olenif3ilslmDua( pnu4tleoxr ia1lmDrlu o ()t2urxr3oo1altnlies (  rrrx p;t1oeeomoctasla el(mo;(0altoif3oo1lm eauvsl()s2umxrpiy1ameelnesls s2uaxrp;t0aptnmf3iysls2uluvo () ltoirciytoaD aiei;t0t2tr(mpou1apt mnet (  Dtax poo4oeen oetydla2em(vsn()aexrif3ia1omDranes s0s2xmxr3io1lleelnei ()artm(m ;t1apxo icildlaDemu s u) ltoif tydla rauvs;(0 eurxrpoodaptn fcils arumxrpnt4ole mo3iytfmDemumpnt4tlenxr tatlaDr ues;(0setrimpny1omeemnvt s artrx pno4tee if3iytla eanmp (0 rtrmo3iodfm  lu slt0srxrxopio4lmtnlfvi ()arraxmoou1olx if3iadfm2ul(vo;t) lenmo3ty1omt  i i;s texrimpoo4oltnlnet ( a2trxmpno4aet moeiytlsDrlu o t)texrifctotla  an ols  2toxo ny1oltn fvt t s2tmxrpnu4tet  feiatlm ea(vont4 etnxrcoatomt  uei t0 rtmir oy1lm n ncils)srtm(m nt0tex moctyd aDel(mp u) lxoxrcto1oa rlnvo;t0 2um(mpny1apee ivtlt) rtmur ;u4tpt ii3taslmDuln s t4 eeomo todlmt  ues;( sexmxr iodol elfes ( s2rmurpnt0opeoiictldls2elumo (4 lxoio3ta1fmte ueo;s)teuoxr3iydlmtemietlt) 2rrum ;o4tleniieiysfsDelump t4 rxoio3to1faDeluei (0tetmimpnudape mfet s)a2uaxronu1alx io3tlt a eanvp u4aeenmr3iotom eaivi s  2toimpoy4aptnlfcsat aDtrumo;t4olxnif3iyd mDem(von()arenir3oytlpDr neo s0trum(o3ny4ape  fvt (fsrrrump;t1tet iictys mDulnvp (0artnxf3tadfpDeaues;s  2xoxopnu1open netls)s2rm( p;o0tltomiciatlsDuan ont4aetoxf oo1faDrlivo ( teumio3oudalt  fcsls)arur(r nt0opxoiieiysfa umnmpnu0tlxoxo oo1faDr ieo s  2xoxopno4ame  fctl( s2ua(mo;u4tpeo f3ildlm2rmnvo;u0 lenxrcty1omDrluvs;s0t2toxmpno1lpteliei sfs2trumo;t0tetn fciydfa2ran ont0 rtnxociydfp  aieo;t) 2uo(m3iodlpenmfeiatfarraxront0alenifetysfmDum(mp t0alxnmf tytfmDelu i;s) rxo(m oo1omt lfeil()aDuru ooo0oeeoiictasls2rauvp t0 rtnmo tatfpDe i o;()s2xriopoydalen nvt (f 2rmxr ;o0teenioeiysfs rl(vsnu)tltnxr oatfptr u sl( srtr(r io4op   feia(  Dumuroot1olx mietatfsDrl(vs u4tlenxfcto1om   u s ( t2xmxr3ou1llt lieiatfa2raxmo;u0oeenmictlsla rmuvpn() exomr3oadfatelivol( srxo(opoo1optemfvt (faDuaxrpnu4aexnmo3iaslm2rln pn(4 etrxr3ia1fa  anes t) exoxrpio4omte icsa( aruru p;t4aexomoctls a uan o u0 lenmo3ootomD li s (0t2trxrpoudop   ncias) Dtmxrono0tet ii3tas aDrmn o t0 eeomo ootla  li s t)srto(o3nudame mnvtlsf 2ua( poo4aetomiciysls2ua(vs;t0alxrmoctatfmtrli s (0srxr(mpoo1olte ivsasfaDtrxrp;u0oexoio3iat m ranmont)trtrio3iodoaD anes;t0t2tmxr oodll  lncsas sDumxr ;o4alen octasfa2ea( s;(4 lerio ty1fm eau ol()setoxrpnudame liet s sDraxrpot1apeo feiatfaDuluvs;u) rtomrciytfmte ivolt) rxm(mpio1apenmivs (fs2trxmp;t4tet mi3iyt sDea(mo ()tlxrirctodfp  lieslt  etm(mpnu1lltn nesasfaDuaurpnu1tpxomf3tltls2ul( o;(4 exrir iodfaDrlivi ( s2xr(r3iodaptn fesat)aDtmxmp;t0oet mf3iyd m2rl(vs;(4tlxrif3oatlaD  uei (0seum(m3io1amen fesltf 2rrxmpnt4apx iietat a2ul(msnt0artrif3iy1fm elueils) rto(opnu1lpe  ici t aDtax  ;o4apenmfeild aDrluvont4tlenmo oo1oaD  u s;t  2urimpno4lm e nei (  rrrx oou1oleoif3iadfmDelump;u4tetoir oadlatr nesl(0 eumir iu4apt mnetas)sDrax o;o1oex  ieiadlaDul(mp t0teeriociatfpDrlivsls s2toxm iu4ll emfcs tfsDua( pnt0apt  feiad s2ea(ms () etrmo tydlpt  i o;s0seumxm3nu4op nmnvslsf 2ra(r ;u1tlt  f3iydfm em( s;t4teenxfctatoat anvi () rum(m3iydape  ictasfa2uaumpoo0apt iictldfs2uauvpn(4alxrxf3ia1fa rlieilt)s2umxr3ny4lptelies s) Dra(mp;o1aee io3iys s ul(vont4trtnxrcoydlp  an i s0srtr(o3nu1op  lnvi t)sDumx pno0opx moctydlm eluvp;u4 etniociytfaD li sls  rtrxm ou1am nlicia() rra( p;u0olx  i3tatfaDulumo u0trerirciatlat auvo s) etr(r iudameelfctl(fa2tru pou0apto ieildls uluvp;()tltrmf tatlateaieo t) exrxr3oy1llte fcslt  rtrx  oo1opxo ociytfmDea( onu)altnmf3tatlmDeai olt)srum(r3iudam nlfvi tf Dumur ;o4tptniieiatfa2eln sn()trxoxo tadlpte neo;( setmxr3oy4am nmfvtltfa2umx p;o4tltomoeiytfs2ulnvont4alxnmf ty1la e ueo;s)s2xmxopou1altelfetls)a2um(rooo0ape iiciadlmDum(mpnt0 lenio3ta1laD anei;s0t2tm(r3io1om nmieslt) Dumxrooo4olx mocildls uanms;(4 eeoir3oydfmDean i;t0 rtrxo iu1olenlnvsat sruauro;t1oltn oeiatlsDrlnmpnu) exomo tatla rlues;t0t2urxrpiy4ap nmfvsat)aDrmum nu1aeeo ietyt s2ea( p ()aeerir3tytfm eluvo;s)sruoim nu1lp   nvtat sDta( o;o4optn i3tlslsDem(ms;(4 etnifctydfptraneo s)srxr(o iu4al e nvta( s2ururo;o4olx if3iydfa2ul(mp u0trtnmr iatfp  lnes;t)s2uo(o iy1opeelncta()s2umu  ot1tltn ictys s2ulnvsn()aleomfcoy1oaDraivi s0 rxr(o nu1alee nctlt sDur( pou4oeeniiciys s elu o u) leomf3iy1lmD ai ols  etoir3oo4lle mfei tfsrrmumoou4aeeo fctldls ulu p u)aeeoio3oadfa eluvo s trtrim3nu1lltn fvi () 2rr( o;o0tlxnmf3iysfaDea( ont4alerio3oo1om r n i;( trum(r no4ll  livs t)srtru  ;u0olt ioeiltlaDemnmon()tltnxr ootlmD lu sl(0 etoirpou4optemiciltf Dtr(r no4aexn i3tys mDumnmp u4 rxoio oa1oaDr ivi;t tetriopio4ol e fvilt) Dumxmpno1tetoifciaslm uanvp;t) eeoxo3todfa r ies s0sexr(o oydameemfctat) Duaumpou0altoii3tyd s2uauvp t) rerxrciydlm rlies;s)setmxr ou4lptnlnvs s s2tr( p;u1aptoif3iysfmDrm(vp u4arermo iatlm raneol( tetrim iy4lp e fci tfa2um( ono0tee  f3iasls elumo t0 ltrxfcoodlpt  u o s) eumiopiy4lmtelietls)aDurxrpnt0ope iiciysla um( snt0aexrmf3oatfm eaivs;s0 rumim iy4lpeelncslsf Dtaumpnt1apxniieild s rm(ms (0alermr3oodlp  li i t)t2to(opny1am  lnesa()srta(ro;o0aexnmfciyd mDranms u) rxnxr3oydopDrlnvo;t0texo(m3nu4al emneia(f 2rau  ;t4alx  feias mDrluvpn()artomf3oy1fpD  uvs ()setoxm iydam elivs s) rurx pnu4apenmociysfm2ua(vo ()tlxoif3todla elneol(0t2uoir3nodomt  nci s) rumurp;u1tpeniietlt a2rmu s t4alenmr3iy1oa eai il()texr(m3nodlp  lfei s a2uauroot0olx  ociltfsDul( s;u0 renmo3iotom eln i (0 eurir3nudal nmfetasf 2tmum ou0opxomfeiatlsDemnvs;u)trermo iydlpt anvs;s)sexoxrpoydoltnlfvslsfsDtau  oo4olenmictlsfaDrl(vo (0 rxomo tytlpDeli ilt0t2tr(o nu4lpenlict sf rrm( pnt4opxo fciadls eaumonu4tlxomr to1fpD lu ils sexmxm iydapenlfvsa(fa2tm(rpoo1altn ieils aDrmu pnu)tlxomfcoa1opDrlu i;t)sexm(m nodape lfet t  2rrxm no0apxomi3iys a2ua(vpnu) etoxrctadomD ai ol(  rur(m3io1aptemivsl(fsDrrurpou1tleoif3iydfs2uanvo;u4 reoxo oytomt  neo;t  rtm(m3io1ol e fvtls)arrmxrpot0tlxomfeildla2rluvp t)altnmocoatlate i i t t2ur(r3io1apt mfvs s aDrm(rp;o0aet  fctldfa ea(vpn(0arxoio tatfmtelivs (0srxrxo3iu1lmee iet sfaDrrxrp;u1oet  i3tlslm ra(mp;t0teeoio3ty1opD lu s;(0srumxrpiu4alte neia()aDrr(m nu1olxomfciys a2ra( o;t4tlxoxo tytoa rliei;(  2xr(m no4am nlnvt s)srtrxmooo1oet mf3tad sDuanvp;t0 leoirciatfaD au i;t0seuoxm3oy1omt  fetat s2rmu pno4tlxn i3tatfa ranmo u4 exrxfciydfmt ai i;s0setmim iu4apte neil(  Drr(ro;u1apeomietatlm ranmsnu0 etnxr ia1lmD anvi;s  2uo(o ou4lm  mnvs s) 2taurp;u0apeo o3iyd m2em(mp () reoif3iatlatrauesls0s2uoxm3ou4ome lnvi ()a2um( pou0optomo3ilsfa2rl( s t) eenmr to1oa rauvi ()srtr(mpnydol n ncsltfsDrmu  no0apxomi3tltls2ua(vont) ltrioctotomDelnvo (0teur(m3iy4lmtn feiat)s2umurpoo1ale ioeias a2rm( o t)tetomf3io1laDe n ilt trxmxo3iudole  fct (fartruroou0tleoii3ils a rln o u)teerxo3ia1lmD aneo;t0 ruo(opiy1lm elfetat)sDururp;t4tlx ii3iysfsDul(mont4 rtnmoctytlateln ilt0srxrir io4omt mfcs sf rrm( o;t0apxoiociatla umu s u0alxoir iatopt lueo;t)tetoimpno1op e nesl()artm(  ;t4tptnmfciat a2eaumo;u0 rxomr3tatoptr ueils0t2xmim3io1lmen ict s)aDrru  ;o4aetnio3iyd mDrlnmpn(0 exnxfctydopt  u ol(0s2to(opoy1al  miciltf Dtmur ;o4tlenioetltls2emumsnu) leoio3todlpD au i;t truoxm3oy1ol n nvsat sDtr(rpoo1tex  feiat s2emnms u0arenxf3iadlp eauvo t0 rto(m nydope  fviat s2rmurp;t1tpt mieildfmDul( p ()trxnmf oadopD  n o;t s2trio3iodaltelnvtltfaDurumpot0tpx if3tydla eaumo u4aetnxf iadom   ivilt0seumio iodop   icilt aDrr(  no0oexomoctytfsDumumpnu)artoifcty1lm ean s t)t2tr(o3ou4lmtelfei t s2ta(rpno1alt mf3iysfs ul( s;t0tltnif iytlp elnvs;s0srumxr3iodomeelnvilt arur(  ;t4aeenmfetysls2uauvont4texniocio1oateanvi;()teurimpio1omeelfviltf Dtaumpot0aexnmfciatla ulumpn()tlerirciy1fpteai o;t0sexr(m3nodapt mfetat)arrruro;u1opx  feiydfs um(ms;t0trerirciotlpt  nvo;(0 2trimpnu4amteliciat) 2rrum ;u1oee iociysfa rl( snu4 etnxrciatlmt  i o;t s2xoir oudolte iet s sDtrur nt0optomieiltfaDel(vp t) exrxrctodfpDelneols) ruoxr3oo4optnmnetat) ruau o;t4olx  ieiys aDrlump;t4 rtnir iadlp eauvslt trxoxm iu4om nmfvias  ruru pou4tet  f3iat s rmuvpnt)arenxr iytlptrlu s;t0setmirpnu1omt  ict s  rururpnt0ale  i3ild sDranms;(4texoifciotfatr i s t t2xoio3nu1lptnlneilt)s2uru pnt0opx io3ias m2rlnms u4alxomr3tadoatrlnvs t) ruo(o ou4optnlncsasfs2urum ;u1tetoifciyt aDrm(vp;u) etoxo to1oa rauvols0t2xmxrpoo1lptelfcilt)s2umurpou0tpeomoctltls2rlumpnu4aexnif3oadfm raivi;s  2trxopoydopenlicia()aDtaump;u4alt mo3iatlm eanvsn()texrmociodfm eluvs;t)t2urirpny4am e fetlt  2tr(ront1opt iieiad sDranmsn(4 exnif totlmtr i s t0tetoxopou4ame lnvt (f rtau onu4oexo o3iatfm umu s;() ltnircoodlmDe nei t tetrim oydlmeemfvias a2rrurooo1aetnmo3tatfmDrmu on() leoxr3oa1oa  au sls s2urxr nu4lp n fvsl(farraxrooo1olxn iciydla2rau p t0 rtrmfctatfpt aues (0trurimpoodol nmieta( aDumx pot0opx mfctyt s emnvpn(0tlenif tatfp raies ()s2xo(m nu4llenlivtl(fsDrm(ront1apt mietyslm2ua( pn()teeriocoodfp e ueo s)texmxr3oo4ll nmnviasfsDuau  ;u0opto feildlsDrmuvp u4trxnifcoytopDr ueo t  rto(r oodlp e iciat)srtaxm ;o4aptnmfctadlsDelu p;(4tetrmr3oa1fmtrli i;s0texmxo3no4op nlfctlt) 2uau  ;t0tpt  octld m2ua( p t4tltoirctotfmt  ueils0s2xmxo3oodlm emfcs sf Dtrum nt4tpto i3tydfm2ran p;u)texoif iydlmDraivi;s0texrimpoo4lleemnvs ()a2uaumoou1teeomo3tys m rmumsnt0 etoiocoodoat li i;s0 2uoirpoy1alenmicslt arrm(m ot4aexniietyd a ua( onu4teenxf3tytfaDeli o ( s2urio iy4om  mictatf 2taur oo4tpxnifeiadlm rlnvs;t4 rtnxo3iy1omtr ivi t  etoxm3oo4amt lfes sfsrtmxrpnu4teeomi3iadfm uln ont4trxoif3tadfa  li o;t0trtm(m3ny4lmenmnesa() rra(r ot1tex  f3iyt m ulu s t) reomf3iytfp  au s s trtoir3nu4olen ivsls  2rmu pno4oexoio3iadfs ea( o;(0alxnir ia1om e uvslt sexrxo oydomt  fesat)s2taxrooo0opx mi3iys sDrlnvs u4 rerxo3iotlmDe nvils0 eum(m io4lp e ivsl() Drmurpoo4aeeo ieiydlsDum( o t4 reoif to1laD  i sls0trxm(m no4amte ivias) rurumpoo0tle  i3ilslaDem(mon(4tlxnxrcootomt an o () eurxr3oo4lle  icta( sDtm(roou1apenio3tlsfm rmnmp u) ltrmrctytfmteliei () rxr(opnudom emietl( srtm(mpot1tlxomfctld mDemump u4arenmo iy1faDelnvi;()srto(opnodlpen fesls arrau o;t0aeeoiociat mDumnvs t4 rxomfcootlatelneo s) 2tmxo3iy4apt lnvi (  rtaxmo;t1oetoiieilslaDel(mo u)arenxo oatopD  nvol( teur(m oo1apeelietlsfaruaumoou1tlxo f3tatfm rl(mo;u0trxrif totoatr i slt)s2xmimpny4alte ivtls aDtm(ro;o0apxo f3iatfsDemn onu) etoxr iydfmteluvi s  2urxopiydop emicsl()a2taurp;u0aee  ociyslm rmumo t0 ltnmrcia1fmD  nes;s)s2xmir3no1ap  lics tfarrrx oot4olxnifcilt mDeauvpnt4aetrio3iytla r uvilt)t2to(m3iudop   nvi ( aDrmxmpou4olxn o3iytla ul(vs;t) rxrxfcoytoaD li o;(  rurim oudlm eliesat  2trur ;u0tpenmoeiytlmDuan pnu0 leoioctadlm e n olt0sexm(mpou1altemivtls)a2tm( p;t4tpx iicilt a2umnmp u0 ltoiociodfpDe uvi s)srtmxopoydamte fei s) 2tmx oot4opt ii3tytfa2uau p (4alxrxfciotfm rau ol(0teuo(rpio4opeemfcia()a2taxmoot0oltnif3iysla eln o;u4texnxr io1oat aueols0sexmir3nu4ame lfesa(fs2tmuront4apenio3tls a uau p t4 exrxfcoydlmtr i sls0srto(r3io4ale  ics ( a2uaumoot0altniictas a2rmu p ()tlxnxr iodfatraivs;s0 etmxrpoudop   iesat  2taxmont1aleomfcild s ra(vp t) eenifctatfptelu i;s srxr(r3nu1optemivtlt) rrm( pot1ale iieiys a2elnvo;t)teenmf3oy1lm rlieo s trumxm3ou1omenlfet t  rtrxroou4oetnioetld aDum( o t) eeoxr oa1fmt  uvo;t  2uoxmpiu4om  mnvslt)aDrmx p;u1ape  fctlsfa uanvp;u) rtoxoctydfa elnvs;( tetr(mpoo4ale  nci t)a2tmu  ;t0olx  o3iasls2ranvo u0aetnircoadfpt li s;(0 etrio oo4alee ieia(fsrtaumooo1oltn fciadfs2eln p u4 ltrir iotomD anesl(0t2tmxr3ou4op n icil( a2rmxm nu0tltnifetld s2rlnvont4trxrxr oatfpt ai o;s0trxm(rpiudap nmnvslt  Dra( ont4oet  ociyd m ulumo (4tlerir tatfm  lu ol( truoim iu1al n fcsas aDtmxrp;t0alt mieiatfaDemnmp;t4tltrxf oo1om eai i;s)trxo(m3oudamtelfcslt)s2ra(ro;o1oetnmoctadfs rln on(0arxrxr iodfmte iei;(0trtrim3oo1lmtn ncilsf rtrump;t4tlt ii3tys m ua(vpnu)tlerxf iadoaDe uvs;t s2tmxrpoo1op n fet (f 2trx  ;u1alxn f3iatlsDeau ont) ltrxfctadfpD luvi;s texm(mpoy1aptn ncsatfsrum(roou0oexomieiad a2el(mp ()artoxo iadopDraieolt0teur(m oy1al   feia(  Drm(  nt1aee mieiaslmDulumon()trxrxr3tatoa  lieo s0srxoxo3iy1lme  fvi s  2rrx  ;t1olxoiieiysfmDelnvs;t4 lxoxrciotom   u i;t0 etrxmpoy1om  lnviasfsDrrx  nt0opxo oeiltls2el(ms;u0alerircoydoateaues t sexoxopou1altemieslsfa2umxr oo1altnif3ils a el(mp;(0arxomr oytfm   nvslt)srxr(m ny1om   fesa(fa2uau  ;t1alt ifctlsls2umnms t)tltrmo iydlptranvil( t2xr(o oy4lmenlnci ( s2um(ro;u0tee iietldlaDel(von(0teeoxrciadlm r ieslt)seur(o iudol   feiat)sDum( p;u4aeeo i3iys aDem(vp;u)alxrif oatoptrlies;t)s2xo(rpnydlpt mnctltfs2ta( pou4oleoii3iasfmDranvp (4arermo3tatfaD  uvolt) 2uoxr3oy1om n iesa()s2urxrp;o0opx miciadfaDrau p;t0arxnxrcootla rau ils0srurxmpno1al emfet (fsrtmx pnu1openiieiytfs eau o t)aeerir ta1la  lieols  rumio3iu1ap n fesa(fa2um(rpnu1aleoif3tldfm2ea(vp (0arxoifciatlmteaiei;t sexr(r3oudoleelncsl()sDraurp;o0optnmociysfa rmnmp t4 rxoxr iotlaDe uvs t) 2tr(m3iudole  ici s arrr(m ;u0apt mo3tytfmDua(vo t)altrxfciy1oaDeauei t0srxmxopnu4lme mfcslt arumu  oo0aeeomi3iadfs2ranms;t4tltoif3totfat aneo;t)t2uoxmpiu1ap n nesat aDrr(m ou1altn fciys sDean snu)alxoif oadlpt livi s)s2urim3oo1olt  ivils  2tru ono4apeo o3iltfm2uluvp u4alenxrctadlp   uei s)teur(mpiydlpte ncsa(faDrru oou0opx ioeiat mDumump;u0tlenmrcoydfmDeli i s0s2tm(r iodomen nvt (fsrua( ooo0oetomocildfm2eanmont)arxrir3oytfmtr ueil() eurxr3io1lpeemfct t  Dtrxr ;t4apt iocildlsDum(mon()teeriocoadlmDrlivs;()s2xo(rpno4om e ivtl(f 2rr(m ou1alenmietydlsDrl(mp u0trerxr to1fmD  i ol( setr(opiydlp n neils) 2truroou4aeen oeiydlsDulu o;()arermf3oa1fatrli slt trxr(r3oo1ol nmfet sfa2umxront0opx  oetyd aDumump;(4tlxnxf3iytfaDrluvi t0t2urimpiu1lmee iet t)aDtmumooo4alto ictydfa elnmo t) lenxocoo1fmtraivslt  ruo(r3oo1oltn fetasfs2ra(ro;o4tleomf3tydfm elnvsn(4aeenio ia1lmD aivs (0 2xrxr3oodom  lfes t  Drrx poo4ale mociad a2ulu ont0 exoxo3iotomD aneo;t) exoxm iu4amenlfcia() 2ur( p;o1oeto octaslm2rln s;t) rxrxrciotoa e nvi;t)s2toxo3oy1lmtemfvt sfa2rru o;u4apx  fetlsfm um(vpnu4trerxfciy1laDrln s t t2trxopnodol n ivt t) rrr(m ot4tlxn f3iad aDraump u0 lxnmr io1omD lnvilt)s2uoxm3ou1omtelfcsat) 2urxmp;u4apt ii3iasfmDrl(vo u) rtnxfcta1fm elnvolt0 rxm(rpoydlpt  fvtl(  2raum ;u1apen i3iasfs umnmo u4trxomocoadlaDr nvil(0 2urio3iy4ap e nes t)srrrxmo;o0texomi3iltlm eauvp t4alxrif3iodopteluvslt0 etrio ny4lm nlivi t  Dta(mpnt4alt io3iatlmDumuvo t4arxnmf iadoaDrauvi;s)setm(m3iudlpt  nvt tf 2rrurp;o1apxomf3tadfmDem( pnt)artrxrcoy1opteli il(0s2tr(m3iudam emnvi ()aruaxrp;t0alx iictas m ra(mpn(4 reoif3oo1lpD  neo;s0trtmxr3iydal elncta()aDumxm ot0opxnmociysls2uauvo;t) etnmo3io1lptran i s)trxriopny4alt lneiatfsDua(mpnt1tlxo f3tltla2umnvp u)treoifcoadlp eanei t t2tm(rpoudame lfvi sf 2ua(mono0alenmoctaslaDeanvpnu4 etnmrcoatlmtrlnvs ( trtm(o3oy4omt  ivta( a2rr(mo;t4tlxnmieiydfm2eanmo u0trtrio tydfpDeln o;(0 2tm(m3iy4am nmfciltf rraxrpnt4aeen i3iys sDrmuvpnu0treomrciodfatr uei s srumxr ou1omt mfei sfsrtr(rp;u0olx mf3iltls rauvp;u0aexnmo3tadopt aneo;t)srumirpoodlmeelfvtl()srtrxmonu1tet  ictydla ra(vp t4texnmf tydfmDr ivslt) rto(o3iu1ol n ivi (fa2tm(r ot0opto oeild m ul(vp t4artrxo totfa eln ol(  rum(o3oodaptnmici s  Dra( pnu1apxomf3iydla el(vs t0 rxrirciydopteai ilt  2xr(r3iu1llenlfvsasfsDua(  ou1open ieiyt aDrmuvonu) 
\ No newline at end of file
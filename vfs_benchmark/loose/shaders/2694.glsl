@@ -0,0 +1 @@
+neol() 2xoiopnu1amenlncsas)sDtau  ot0tpt ifctltlaDeln s t0arermrcia1fatelnvs t)sexo(o3nydomeemfet (fartmxm nt0olxomociytfm2uln p u) ltoxrciotfp   u sls  exmxr3ny4apee fes sfsrumum ;o1olxnif3iltls ulu o t4aleoxf tytlptelies;(0seuoimpoy4om   fcil( sDumum ou4altomfcilt m2rmu o t0 ltrmr3oy1fm eli o (0t2tmim nodop  mfeiatfaDtmx  ;t4alt io3tad s2ul(vsnt4 ltoif to1latelieils0 rtrim3nu4apt  iesas a2umuroot4tpe mo3iad a2rauvo t)aexnxf3oa1fmteanesls srum(m3nu4opte net t) 2urx onu1tlen f3iatfm2ea(mp t0arermf3iy1faDraivol( teuo(r iudomee nvt t)s2rmu poo1oeeoioctasls eaumpnu)texnmo3iytfpDeanvs t)srxoxr iy1lmtn ivs s sruaumonu0oet moeils mDeanvs t)teenxr oa1lmDr u s;(0teumim oo1lptn neil(faDrmx  ou4oeen ictltfsDeln s () eenir3oadlmD  ivs;()seto(o3ny1al e iei s s2rru  nt1aleo ictysla2ra(vs (0aeenir iadfmtrai s t)texmir nu1amte ivta(fa2urx oou0oetomoctad sDeln o;()alenxrcoy1fatraivils) etrxr3nydap n ncs sf Durx pot1tleoiociydfaDra(ms;(4 rtrxr oodlpD  u ils) euoxr3nodlleelnes ( a2um(rpou0tpe ii3tldls emnms (4aexnxrciytfaD lneo (  2tm(m3oo4omtnlicia( sDtaxmoot0apx  ociltlaDrm(vs () renir3oy1fpteaivo s) etoiopno1lpee fvi t)aDtr(mp;o4oexnmocilt mDuluvon(0trenmf3oodlp r ivi;t srxrim oydom   fcsa()a2taxmoou0oltomoctys mDumnvo;t0aeenmrctotlptelieo () 2tmxr oydap elfetat  Drmum nt0alxoifciytlsDuau o u)aetrxr io1lpteaueil( tetrio nu4ll e feiltf rurumonu1aeeoifetat aDea(mo () eeomrcoodfa  livs t)srtm(o nodom e ivs t arumu ont4oet  icilsla ea( p u) etomrciadoaD li s;s0teur(r3oodomtnmneta()a2rr(r nu1aee if3tas a ran s;t4 exoiociytoaDe nesl( seurir3nudlmtnlivt ()arra(rooo0tpenmoctadlm rmnvsnt4trxoxo3oy1lpt aivsls)srxrir3iu4alte ivt sfsDumu  ;u4aetn i3iys a2rlu p t0teeomf3iatfm r uvi t)s2xrir3iodlle  ivsas) 2ur(mooo1oetnioeiysla ran s;u4 ltnxo3oodlat anvslt)t2xo(r iodlpt lfeilsfa2tr( ont1aetnmo3tyt a2ean s;(0teenxo iytfat  nvol() 2xrxr3ny1lm  liesatfa2rmu  oo4tpeomfciatls2umu ont) eenifctotlmtelnes;t0srumir nodlpe lnci sfaruax  ;o1altniicias sDuln o t0 exnxf oadopteli i (  etmim3oo4ameemivtl(fa2uaumooo4apenmfeias a rlnvo (4tltoxo iatfm eaivils s2tmim iy4ol elnvi t)sDua( p;o4tlenmo3iys a eau p;(0arxoxf3oydlm  li ils)texm(rpno4optnlfcsa(  2taurpnt0oexo f3tatls ran o (4arerifcio1lptelu o s)tetrir3oy4omtn ncs tfartmumpou4tlx  iciadfs2emnvp ()arxrif3oydfm r nvi t0texrxrpiydome mnvilsfs2tmurooo0tee  ociad a emu o;(0 rxrio todfpD ai s ()t2xrim3iudlme  net sf rtmx  no1oleo f3iadfa uanmonu)teeomo oatfmDeanvilt)s2urxm nydalee nesasfsruaumont0olt  ieilt sDrl(vont) lxomo ootlpte u sls teumir oy4ape mnvtat)s2ur(root1tet moetld m ul( o;u0tlxoxo3tydfpte n i t s2tmxm oo1lleelfei s arrmu pno1tpt mf3iydfa2ran o;() eeoxf3oadop r ieilt srtoxm3nu4ame  icilsf Durxm no0aetnioctadfm2uln pn(4 eenmoctadfmte ivsls t2toxm3nu1ap  mncia( sDumu poo4tltoif3tldla2em( pnu)trtnmoctotlpD aivols)teum(r3iudaltnmictat)a2uaxrpnt4aetnmfeilt a ulnmpnu0tlxrio3oodfmD  nes t texoir3io4amtelici (fa2tmxrpnt0opxn ictydlmDea( p;(4tetrxo ootfatr n s;s t2tm(r io4ame mivilt)a2tr(r ;u4texnif3iytfm rmuvs;u4 ltoio iodlaDelu s s) 2trim3oy1llee ieilsfaDururpnt4apt ii3ildlm eauvsn(4tlxrxo3oy1fate ivi s0 etmxr oy4lptnlfei s aDrmxm ;t0oexoifeiadfm2eaumpnu4 ltnmr3iotlaD  n i;() rxr(m3ou4lmenmivsa() rumxrooo0teen ocilt a2uau s;u4aexoif io1omDrlieo t0srum(r3oy1aptelfet s srrr( p;t0tpen fetat m ua(ms u)arenxr ia1lat aiei;s0texr(mpnu4alt mfesa( a2trur no1tpe moetltfsDum(mp u)artrxr oytfpDraivo;( trumim oydamtnlivt t aDtm(m ;u1tptn f3ildla eau o u4 eermfcoo1fmtrlivo (0 rxo(mpiudalee fetat  rumu pnu1tpe mietldlsDelumpnu4tetrxf3oydlpD ln s;t srxmxo3iu1open icslt arrmumpnu4teeomfeiytfa ra(ms (4trxrmo3oydoa  lu i;t  rxo(m oo4olee ies tfsDtrump;t1tleoii3iydlmDulumpnu4tleoxociatlm rauvi s0s2tmirpnudal emfesatf Dur(  nt1aptnio3tat m emump;t4tltnxrcoy1fmteanvilt setrim3iydaptnlnctl(  rrm( ont0aptn o3tltfm2um(vp;t) ltoxrciytoa eaieo;t teurxo iydlmenmneils) 2ra(mono0tlxnmfetldfm elu o;(4teenirctotfpt aieols)s2trio io1ll  mfcsa()a2umu pot4olxo ictadla2rmnvsnt4 lxrxocoo1lptrlivo;s t2trxm3oydamtn nciltf Dum(m no1opxnmf3tasfs2rln o;() lxoif3io1om ranvs t0srxr(mpny1ol nmfcsa(farurx p;u0tee  f3iydfaDrmnms u)trtnif3iodlm rauvo () 2uoxo3oo4lpeelfcs sf rtau ooo0tptn icildfm2eluvp;u) etoif ty1om r uvi;t) 2umxr3ou4ole mfct t a2taur oo0oexo i3tat a eaumpnu4aexnmociy1fat  i s;t)seumir3nu4apt micias sDtmumpot1oexn f3tad aDrauvo () rxrmrcootom  auvs;s seuoir no1amenmieta()sDrrur ot0apxomo3iad m uanmsnu4 lxrmo iatom eanvol(  2xrxm iudlleemncsa() Dur(rono1olxnmietad sDrmums;u0trtnxo io1oa eai olt)texmxo3oy4oltn fes ( s2rmxro;o0tee mi3iytfsDuau o;t0 exnmrciodfp  lnvi;( sexo(opnodalte ietas  Dtrurpou1tleo i3tadfs eau ont0 eenxf3tytfpDraivs;t0teto(mpiy1alt mictl() rumxroot0opt mf3iydla rlu snu0 lxrir oa1la e uvs t) rxr(opoudamtnlfvsasfsDrmumpoo1oeenmfctysfs uan s;(4aetomfciotfa rai ols0 etm(o ou1omenmivsl(f Drrxmp;u4alxoifciadlaDulnms () rtnmfctodfmte nvi;s) 2xoxopoy1apen ncsls)s2ra( o;u1teto fctyt aDemnvont0teenio oatfpt ln o;t0 etm(mpnu4ole mfet ()aDua( ono0teeniietldfa ran p;u0arerif3tytfmDelnvi;t  2toio ny1oltemfcil(faDtau oou1aetn fctytfsDranvpnu4trtrifcta1lpt liei t0setmir iodlmeemicils  Drau p;o4tlto feiys m ul(vs (4teeoir oa1omD  nei t) eur(r3iu4ol nlneia( srur(rp;u1optnmo3ilsfs2rl( pnu4teeomf3tatfpt anvsls) rurio iydlptn nei t) Dtau oot1aet iiciyd aDraump;t0trtoxfcoatom  lieo (0 etrxo3iy4alt liesas arur(mpou0tetnmfetlslmDra( snu0aeeomo oy1laDrauvo s s2xrxrpio1lltnlfcta()a2umxr no0teto icilt s rm(mpnu4 eenmocoo1fmtrauesls)s2xmxmpny4aleemnciltfsDraxmo;t4oeeoifciat m2el(vs;u)tetrmr3ta1fmDeaiei;t setrim3nu4optnlnet t aDtaxront0alx  ocild a2umnmp;(0aetoio3todoaD  iei t0 rumio3nudaptnmiviasfsDurx ono0olxnmfeiysfsDel(vs u0aetrxf3ia1opDe n i t  2xrio io1ap elieslt)srra(  ou0ole  icildlsDemu s ()aexnio3ia1op  lu s;()trur(m oo1ap n nvtl(faDrrumpnt1oltoifeias aDrauvs;()aetnmr oodlpDr neilt0texmxm oy4omeelnctlt) 2umuroou4optoioctysls rluvs;()alenmo iytfmtelues t0teto(m3nydom elnctls)a2trxm no1oeto oeiad a2umn onu) renifcoa1fatr iei s0 2tmio oy1lltnmncta(f 2ta(rono1tle ii3ilsfa2uluvsnt4 ltrxfctadopteau ols0srxo(r3iu4opteliei t)artmxmonu4oeenmi3iytfm2uauvont4teenif3oatopt au i;s)seumxo ou4am emfvt t)srtrumono0openifciatla rl(vsnt) lxnio ty1oa elues t0s2urxr3ou1aleemfviatfsDtmxro;o4olxoiocildfsDra( s;t0alerif3ta1fpDrlu o;s)setmxopnudam  mfetls aDrrxmp;o4tlx if3ildfmDrm(mp;(0teeoxociodfmD livi;( teuoimpoodlpte nvs s) 2um(ro;t4ope  i3iysfa umump (0tlxomf oy1lp rau s;() eur(r3iu4lme  fvt (fs2tr( ooo4tpe moeils aDrm( s;t4tltnif oytlaD aneol()trto(opiu1omt micsl( aruaum ou4tleomi3iat sDelnvo;t0 ltoif3ty1la eli sl( setoio nudalt  ics t) Dtmur ou0aetn ieiyslsDea(vpnt)tleomo iy1om  luvsl()trtmxrpny4lle  fci (f 2uax  ot0tpt mfetydlm2rln sn()teermo3totopDr n i t0t2tr(o3oy4openlnet sfsDta(mp;o1oltn f3iltfa2umumont) lenifctotfaDe i i;(  euoxm3io1apeelietlsf Dtmx p;o1tex 
\ No newline at end of file
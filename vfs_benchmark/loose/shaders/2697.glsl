@@ -0,0 +1 @@
+ivs (0s2xoxm no1aleemfei t s2rmurooo0oeenifeiydfm eau pnt0trtoxr3iatom r ivo;(0trxoxmpnudlpt  ieias)s2rr( o;u0aetomoetasfaDranmp;u4trtoif3todfptranei t)trum(rpiydlltnlivi (fsDrrx  nt0opxo iciltfmDem(vp u)trxnio oatopDe ivi t0 eum(o iy1altemfeia(f 2tm( ont1ope ifeiad m2umuvp t)trxrifcoadom eaivs;(0 rxrxm3no1olt mies sfarurxrpno0aex  fciltlm eanmo;(0 lermocootomt auei t  2xm(opou4op emnci s) rur(roou1tee  o3ilsla2em( o u)artrxfcootom r u ils0texmxrpoo1lptnlieils)s2um(  nt4tle  feiltlsDran on(4 etrmo3iodfp r n slt truo(opno4om emivi (  rumumono4aleomoetadfm2uau s u4 lxnmr3iadfat luvo ()s2xrimpnodlmen iviltfsrrrum nt1aet  oeiytfaDrmnvp u4trxnxf3iydfptrluvs (  rumxo3ny1aptemicil() rrm( oot4aexnmo3ildlm ra( snt4tlenxo3io1lp rlneil()t2uoio3iu4opt mfeils a2raxro;t1aeenifetlslm2umuvp;()tltnmo oo1lmDrlneo t) ruoimpoodaltnmncslt)aDrm(r nt4opxomoeildfa elnvo (0tltrxf3tadfm eli il( s2xoxo iodolte fviasfa2rr( o;o1olto f3tadfsDea(ms;u)tlenmrcoa1fmtrau ilt0t2um(o3iudomeeliesa()srtr( pno1tlt  fetlt a2ul(vpn()tltrmrcoa1laDraieolt)teuo(o iy4omt lfeta( sDrr( oot1aeeo ociad sDrm(mon(0trerxf3todlp  luvils) euoio3no1ol e netls srrru  ;o0oex iietlt s el( sn(4teeomr oy1lp eln ils) 2xrxr3oydal  lfvi ()srum( ont1tpxoif3tadla ul(vont) rxrxo iotoat li s t s2umxm3nu1opeelfcsa(fsrrm( pno1tle  feiatfs rm(ms t0trenio3iotfpt anes;t)trtrxr3oodllen fci (f rurx o;t0tpxniietytfaDumuvs u0artrio3oydopDeaiesls)srtr(rpoo1am n fcs ()srtmuro;t1altn o3tysfaDua(vonu0 ltrmocoadlmDr ivs;s0s2to(m ny4alenlivt t s2urx oou0opt iociydlaDranmsnu)tlerifcia1fpD lu s s) etoxmpiy1ameelncsa()aDrmxrooo1tleniicilsla2el(vo;()trxoxf3oo1omte nei;( teuoimpiy4am  lfvs tfsrrru ont1aexnii3iytlmDem(ms t0 eenir oatlp  auvs s)texr(r3oo1om  mies (fa2trxm nu4oltomf3tltla rln pn()alxrmo3io1lptrliei;s tetmxm ou1lmee ics ( a2umxr nu4oetnioctas m2rluvpnu4altrifcio1lateaies () ruo(r3io1al  mnvils  2uaxmo;t4oee micilt mDum(vonu)aetrxr oytlpDrlueslt)s2urim3iudlmt lictlt s2urumpnt0apxn fciyslmDuanmo;(4 rxnxrcoytfmt  uei t0srum(r3ou1ol emfctls)sDrrx p;u4aex mieiydla emu s u) eenmr todop  aivi ()texmio ny1ale  net sfa2rmx  ;o1oet  i3iat s emuvonu4 rxomr ty1lmteli ol() etm(r3ny4ol  lictl(f Dtm(mp;t4tlx  fetld m el(mo;u)aeenxo3oytfm eli i;s)setrim iy4lp e iei t arrax p;t0altnifciydfmDrmnvs;t0tltnxfcoa1opDeaivo t)srxoxo3iudlmt  fci ()srum(m ot1tet mf3ilsfmDumnvo;t)altrxo3iodlmD ln s s)trumxm iu4ome  fvia( srtr(rpou1aptoifetat aDeaumo ()artrxo oydoa eli ils)s2uoimpoodlme mfesl(fartr(mp;o1olto fciadlmDrmumsn(4artnxf oatlp  lu il( t2urxr nodopt lieils sDra(r ;t1oet  oeiydls2rm( o u4alenxoctodopte uei;s0seuoim3io1opt lnesa()s2rrx pnt4aexnmfeiatfa2eanms u0arxnifciy1lmDrln i (0 2urim no1lpenmfesa()sDtrum no4aet  f3ildfs2ranmonu0 etoiocoo1fat  nvi;( s2tmimpio1alt  iet t)a2urx  ;o0oexnmoctad aDemuvp u)trxnxo3iadlp rlivo s)texoio iydll nlfcilt artr(mp;t4tlt mi3iyt sDul(vs;(0 exnif3iotoptrlnes;s0 etrxmpoo4lp n neta()s2um(  no4optnmociytlmDrl(msnt0aeermrciy1fmDelu slt) exr(mpou1opt mivsasfs2ra(mpot4tleoiiciysla rln o u0 ltnxo iotlmtran s;()setmir iudlmt  fct s a2umu  nt0tleomiciydfs2rl( p () rtrircoadla  lies s) etm(m iy1lltelivt t s2uau onu0tetn i3ias a2uln on() eenmf3tatlateaivolt0 rurimpnudoptemnvta(fsrta(r ot0apt mi3tyd m2uanmont0 lxniocoy1oa   n il() exo(m3iu4ol  lneil(  rtm(m ;o4aexnmfeiasfa rmnvo (4 eenmf3iadlatr n sls t2uo(r oo1lmee ivt t s2rrxm ;u0olx  i3tysfa2ua(mpnt0trxnmrciy1op raieo;s)trxrxr oydaptemictls) ruaxm ;o0oee  i3iatfmDuauvo (0aeeomf iotfm rau i t)teurim ny1alenlnct ( sDum(rpot0teenifetld m rm( snu)artrxrciadfpD ln i s0tetr(mpou4ol e feiat sDrrur no4optn fetld a2rm(vp (4tltoio3ty1fp   ieo;(0sexoxopnu1ap   ici (f rrm(r ;t0ape mociaslmDumu pnt4tetrif ta1fm e i o;t  etmxrpou4ol n nvtatfsrrmu p;o4oexomo3iydlm2ean ont)teerxo3oodlmt  nvols)s2ur(r3iy1lltnmivi t  2ta(mont0apx iociatls ranmp;(0 ltnmf oadla raiesl()srurxmpnodomte ici s)sDua(mono1oetn ietlt aDua(mo () eenio to1laDeau s ( t2to(r3oy1omee iei ()sDumxmp;u4tet mociatlsDem(ms t)texoxrctatfp  aneol( srurxm3iudllenlnci tfaDtm( oou1tetoifeild sDemums;t0tlxrmo oa1oatr u o;s0s2trxopiu1apte ivslt) 2rmu  oo1olx ioeiatls2um(vp;t4trtriociotop  aivo s)trum(r oy4lmee feil( srtru o;o1aetn o3iat m2rlu o;t)trerxo tatop  aivils) rxm(o ny1am  lnvs ()sDrmumo;u4tpxoifetltlsDea(vo (0texoirctydfat li ol()s2ur(m oy1lmtemnviasfaruax ooo1aptnifctltfm2rl(mo;u)arenmf iotop e uvi;s0 rtr(o3nydal nlnvt t)arta( onu4apto oetatls ra(msnu4trxrifcta1laDrau s;(  rumio iydap emiesas sDrrxro;u4apeomf3ilslsDeaumpn()artnio todla elieo;( t2umir oydlmeelfeils  2rmx p;t4oetn f3iatfs2umn on(4teeomo oo1optrlieols0truo(r3io4lmenmiei t) rrmu p;t1opxnmoeild s2ulnmpnt)altnxf tadfp rlueils)texrxr3iu4llenmivsa( sDrm( ono4oltnmoctadls2umnvon()tetrio iydomtr nesls0tetmirpio4ome  ivilsfa2umumpnu1olxnmoeias mDuauvsn() exomocto1opDe ueils)srumxo oydlpeemnetasfarrru pno0oleoifciltfmDel(mon()tlenmrcto1lp rlueol(  2to(m ny4ale mictls)sDumum nu1altnmfctadlm2uaumsnt)artoxocty1fp r nes t0 exr(r3oy4ap   ncsas arrmum oo1apxnifeiatla2rmn sn(0aetoif3ta1opDranes;s s2xmxm iudlme  fvs tf 2raum nu1optomfciydfs2ul(vp;t) eeoxr3oydoatrau s s t2uo(rpoy1am nlncsatfsrtr(rooo0olx ioeiad mDemnmsnu4 exrir oy1lat auei ()sruo(r ou4ll nmfet (fartmur nu0tleoiietydlaDem(ms ()aexomociy1lpDeluvi;s0 eurirpnydam  lfct tf Dtaumooo4oeeomfeiasls uanvonu0tltoxf3ootoaD ln slt)srum(r3iu1om  mnvia( arur(mo;o4tpeomfcilsfmDrl( o () rerir tydla  lneo;() ruriopiy4al   nvsasfa2tmxmpot0tetoii3ildfm ranvs (4trxnir oa1fa   uei;t t2xr(mpnu1ope  ictatfsDtau  ;u1apxomfciltfaDemnvs t) renxf3tytfm  lu sls  etmirpou1lpte ncia() 2uaxmpot4apxn o3ils aDelnvpnt)altrirciotfpteauei t0trurir3ny1altemieslt)aDumxr no1oet mi3iytfm emuvp;(4trenmf tatfm elies (0seumir iy1al  micsls)s2ra(mp;t1oexomieiadlm2rln pn(4arxrmo todfa  lneols0srxr(o io1lm  lfes (fa2umumpnu4teenmieiadfmDra( o u0 etrxr ia1fpt  uei;s)teurxopoo1lptemivi sfarrmuro;u0aetnifeilsfa ea( s;t)tlxrmocootlm rauesls0 eur(o3oodal  mies ( aDrm(rpnu1teenmi3iadfm um(vp;()trxrif iodfp   ivsls trxoio3iu4lp nmictat)aDurxrp;u4tee  o3ias mDua(vs;u0 exrxr3ootfp rlies s)srtoim3oodoltnmiei tfa2taxm nt0tlenifciat a emuvo (4alenmr3iadomDrlueo;t texoxmpoo1apenmnci sf Draxr no1alt  oeilsls rm(vo;u4aexrifciytla elivs t  2ur(opiy1altemfvil( aDraxro;t1texnifcildla rl( on(0 etnmf totomD luvols)t2toimpiydoptn neta() rrm(moou1oexnioetldfm2umnvont4 leoirciotoa rluvsl()s2umim oydolteliet sfaDrr(  ou1alxn octat s rlnvonu4tetoxr3iydfa eliei t truoxm iy4ap elnvt (  rtruro;o0aeeoioetls a eau pn()teerxfctotoa  anvs;() euoim iy4openmnvsas s2ta(ro;t4teen oeiasla2eanmp;u)teenxr to1opt li s t0t2xoimpnudlpt mncs (fsrraumo;o4tpxo oeiadfaDeaums;t4 rtrmoctytlaD lneol(0setoxo no1amtemfvsltfsrtr(rono1aet moeias aDrmn o t4tltrxrciotoptr ivs;() 2xrxo no4lptelietasfs2rmxrpou0oexn i3iadlmDulnvp (0tlxnxf3io1fp  aivs (  eumxr3nu4al emfeil()srtr(mono0apt iocils a eauvp;u)arenxf3tydoaDrlnvs;t) etm(rpiodam elfei (f 2umx pnt4apx  i3tltfaDrl(vs;u4 rtnxociatfmt lnvi;(0texr(o3ou4apee fcias sDtruro;t0tlxnmociytfmDuln s () lxnmrcto1op  aivi s  2trxo3iy4lp  mivsa(faruax  ;o1olx mictatfs2emn s;u0tltrxoctatom rlieo;() exoxo3nydol n ieils)sDraur ou1tpe ifetltfsDuau onu) rxoir3iy1lpt  nvi t s2tmxrpoy4omtn fvsa( srtr( pou0olt ioetltlaDul( p u4tlenmrcoy1lmteau sls) rtrirpiu4olenlivslt  Dua(rpno1oex  fciltfa rm(vp;t)areoxf tadfaDr nvslt)tetrim iu4ap  lfcsl(fsrtmxroot0tpxniieilt mDulnvo (0teenmr tatfp  aivil(0s2tr(o ny1om  lnes s s2tru  ot4tlto fctytfmDeanvp t)tlxomociy1oa eli ol(0 rxmxm3ou4alenmiet t) rtru oot0ape mieiydls2ulnmo;t) reoxf iytlpDeaiei;s0seur(o nudaptnlncs t) 2tmxm oo1altoioeiltlm2umn sn() ltrmr3totoaDrliei s  2tr(o3io4al e ics tf Dtaxmo;o0tlto oetadlmDulu p u0 lxnxf3ta1faD aues t)seuoxopny4ol  lnvia( arra(rooo4tlxo i3iytls emnvpn(0 renmo3totomtrlues (0s2uo(o iy4lp n nvtl(faDtru poo1aee ioeiltlaDumn s;t)teeoir tadfp r i i s teumxr3ny4omenmfcslt)a2tm(mo;u0tpxomf3iasfa2umumo;(0 rxnir iadlp  an i;t0s2uoxrpoydlmtnlietas)a2umx p;t4apeo fciysfaDemuvp;t)tetnmr tydom raieols)sexoiopio4lpenlfci t aDur(r no0tlxn octasfa elumpnu0aeenir iotfaDelu o;() rxm(r3oy4al n neias artm(mo;t0tptomo3tadfm rluvs;(0alenif todopt livs s seum(o oy4oltelfetasfs2tauroou1tlenmietasfs emnvs (4 exoxrcto1lmD  nesl(  etrimpiy1lmte nci t  Dum(r nt1opxo ociysfmDemn o;u) ltnxf oy1fp eaies t  rurxm oudamte fvi tf Durumoot1optniiciys sDrlnvo u0 renircoa1lm rai o;t tetm(rpou4lmt mietat a2rr( onu0optnio3tyt sDelnms t4trxomo3iatla  auvs (  euoxopio4ap   ieiat sDumx p;t1opxoioctltfs umuvs;t0tlxrir ia1op elivols0s2xmxm nu4ap nlnes t)aDtaur ;o0aeeomieilt sDul(vsn(4aeeoio3oatopt aivi (0teur(mpiydol   ivs t)srra(rono0aptn oetld a rl(vs;t)tltoif to1laDeln i;t0teurir3io1openmicsl( s2urumoot1ale ifctydls2ean o;u0tltnio todfp   u i s0 2ur(r ny1oleemnvi s)srrauroot1apt  oeilt m ra(mont)tlxoir3todfpteluvi;t0srxm(r iy1lpe  nviat)srtr(rooo1ole mi3tls m2ra( s (4aexomo iydomtelivo t0setoxr3nydole  nvs (f 2umx pnt0apt ifeilslaDumu p u)tlenmf iy1opDelnvs;(  2xoir3nudaptelietls)a2ururpou0oexnmf3tysfa uauvp u)artrmo tatoptr ieo;()texo(m3nu4ope licsa( sDrmur ;u0ale  f3ilsls2ra(vsnu0 eerxf3iy1om   ies t) 2xmxr io1ole mictat)a2ur(m ;u0aexnmicild sDumn s t0artomr tatfmDr iesl( s2toxopnodlp e fcslt  rururpno0oeenifcildfs2ra(ms (0areomr3oo1la elnvi s) exoxmpou1ale mics t)a2uaxmpnt4aet ioeilsfsDrmnvo;(4aetrxo3iotfpD lnes t  2trio oo1ope  ict s srurumooo0aetomfetytls2umn p;t)aexoio3iy1fm r i sl(  rxo(mpoydlltemfvt sfsDrr(roou4olxomfetadfm2ea( sn(4trxomr iytfaDe ueo;t0s2tmim oodlmeemfvslt  rum(r ou1tpt  fetlslm ulnvs;t)artrxr3iydopD anvs;t)t2xmxrpoudal   ivilt) Dtaxmont4opxo oetlslm2ra(vs (0 eeoxo3ty1lpDrluvil() euoxr3iu4amenlfci t a2umumoou1ole moetat a rmn s () rxoio3to1lp rln sls0 2uoirpoodolt lfcsls) Dtaxrpoo0aleoiieils m2umuvpnu) ltnif3iatfaDelivs;s s2xmir nu4lmt  ivia(fs2rr(mpoo1opt ifctldlm ranmp t)teerir oydfm raues s)srto(rpio1op  liesa()s2ta(  oo4oleoifeiatfsDumu o;(4alenxf3totfmD auvilt sexrxr3io4lltnlics s sDtmxrpot0oeeo o3iaslmDumumpnt)trerxo tadfmt luvols trtmxo nydlm nmnvsl(farum(  ou1tltnmi3tys a2uauvo u4trenmf3iadfmD  ies ( teto(o3iu4ol e icsas  Drm(mpnt4altoioeilsla emnvs t0aetrmoctytlmtelues ()s2umxo iydom  lfesls)sDrrxm ;o0olxn f3ilsfsDrln o;t) lxnxo iotomD  nvilt0s2xoxmpiodamt mivt ( a2umx  oo0teto o3tys m2ra( p;t4 exnmf3iadopD  nvo;s0seurio3io4lmtn icilt  2ururooo4texnif3tlt sDuluvs u4aeenxf ta1opDelnesl()s2umxr oudaptnmncsls  Dtmu  ot0oltnifeiatla2rlumo;t)alxnmr3iadomt aieo () rtmxo oodamte ictlt aDta(m oo4aeenif3iad mDuanmpn(0 eerircootlpDeluvil()t2toxm io1amte nvt (faDra(rpot1aeeoiieiltfmDua(monu) etoio3ty1omtrlnvi;(  2tr(r3iudoltnmfei t  2rmumoou1tleoio3ilsfs2uanms ()tetoif3to1fate ivo;(0texr(mpio4amtn nviltf 2raxm nu0tltn o3ils s rluvo t4 ltnmo3oatom elivs;t texoxm oodlpe mfeils aDtm( oot4apenif3iltfa emuvon() lxnxo iotlmtelu s (0trto(rpny4lm n ivslsfs2rmu  ou4aetnifctat s rmuvsnt0 rxnir3tadopt luei;()trxmim3ny1opt mnet tf Dta(r ;o1alen oetltlsDea( onu4altrxocty1lmD  ivil()teuo(opoudlpenmfcilt a2tm(mp;o1oee  fcias mDrmuvo u4texnmo3oy1lm   i olt) rtrirpno4oltelnes t srtmxr nu1opeoiociysla ea(vsnt0texoxf ia1latraieil() euoim iy4om n neil(fs2ra( ont1apx  fetad a umu p t)artnio tydoaDeluvs;s) eto(r nudom n fvsls)aDur( poo4opxniieiysfs rmnvo () rxoxocoy1late nvo (0 exrir3nu4open nvtl(f rumur oo4aptomfeildls elnmp u)altoxf oo1omt  nei ()t2xo(o3iu4amt lfeslsf 2rm( o;o0alx  ociytfs2umnms;(0trtoif oa1fate i o;s0setm(o ou1lm emfctas)arum(ro;u1opxo i3iasfs rln ont4alxoxfcta1omtean o s)trur(r iudapenlivsl(faDrm( pot0ale mocildfa2eauvo t)aexomo3todlmDe nvs t) etoxo3oudlme mfeil(farta(r ou1oleoii3ild m uaump;() rtnmo3oydlpteanei t0 etmiopno4om  lfcilt) Dtmxmpot4aeeoioeilsfmDua(msnt4arxoir3totfatranvi s setmxo3io1lm e ietasfaDur(  nt4tle if3iydla emuvonu4artnmfciydfaDranvo;t0trtrio io1alenlfesl()srurumo;t4oet iictytfs2ua(mp ()arxrxo3todop ran s ( sruoir oo4openlnvsls arrm(mooo4olxo f3iasfsDuauvs ()areoir3todoptr u sl( texrxrpiu4ap nmfvsls a2rmxrpnt0tlxoiictld m umnmp ()artniocoydlm rlivs s)truoiopio4ol n fcsl( a2rm( pno4oet mfciysfm2rlumon(0aexnxr3oadfpD lu i;t seum(rpiy1op nlfesasfaDrm(m ;o4tpxomicilsfa2ul(vp;t4tlxoiocoodfpteaueo (  eum(r iy1llt mfeiat)sDra(r ot0apto o3tldfa rln snt0arxrxocootfaDrauvols) 2toxm nodoleemnct t)a2uaumpoo4aptomo3taslsDumu ont4texoxocoatoatrauvols  2um(mpio4lpenmivil()s2rmx pnu1tlxomiciatlm ra( pn() renir3tydoaD lu o t trxmxrpnu4lm  miei t) 2urxro;u4olt  fetys s umn s u4arenmr oa1fp  li o (0 rxr(rpoudom  lneia()s2umu oou1tle ifciyt s2rl( snu)tlxnxo oydom elnvs;()srtmxmpnu4lmenmfvsas arrru ono4olto o3iat m2ulnmsnt) etnxrctydlpDeai i s srumxmpou1ame lfei tfs2tr(rono0tptomf3tad s2ea(mp u4tlxrif oa1la  aieols)srxm(r3oodolt  fciatfs2ur(r ou1teeo ictlt mDuln p;t0arxoio3tytfaD  u ilt0 2xrxrpoy1lmen nvt (  rrr(ro;o1optn ietadfa emu pnt4tltoif3oodla  au ils)sruo(o3oo4olt mfcs (fartm(mono4aexn oeiaslm2eln s t) rerxf3ty1oa  li s (0sexoxmpiodll e fcsls) 2rrur ;o4aleomfciat a eln p t4aeenmr3tydfa  lies;t0 2uo(m3nu4lle  nviatfarumxrp;t4oleoii3iadls rmn o (4trtomf3todoa  aneo ()s2uoxm3oo4altnlfesls) ruax  nu1apxn ietldls2um(mo;t)texoxf ta1fpt  nvi s0s2tm(r ny1opt miciat)artrxmooo1tpe ii3tyd mDrluvo t4treoxfctodopDeaneo;(0 ruriopoy4apenmivsasfa2urxm no1tle mi3ilsls ul(mo;() ltoircoydlpDrlneo t)texmiopnudol n nes (fsrtmxr ot4tpx mf3tlt s2emu pnu4 leoio3ootlatrau il(0teumio nudlm emnctl()artmu onu4alt  i3iyd aDelnmsnt) etoxf3iodlmtelivo;s srtoxm3no1al e fvtasf Dra( ono0tpe mieiat sDemnmo;t4trxoxrciytla e ues;()t2uoxrpiu1ll nlics ( aDtmuronu0apxnii3ild sDeln onu)arxoxf tadfm ranvo;s)t2ur(m iu1ap nlicsatf 2um(rono0aet mieiydfaDem(vp u4tetnmocoadla  livil(  2tr(opny1alenmnvi (faDtaxront4openiieiltfs em( p () etnxf to1fm r ivs t)s2trio oo4llee fci t)s2taxmp;o0ape iictydlsDeanvo t0 rerio3iadfa  au ols0 rumxr3nudlm emivt ()s2trxm ;o4tee ioeiadlmDelu s;(4 lxomo3ia1oa r u o t  rumxm3nydll elicsas)srrrum ou0aetnmoetatla2rm(msnt)texoiocoo1opD li s s0 rtmxm oy4lleelfvsasfs2urx o;u0opt  ociltla2rmn o u4 etomf3iydfm raueol( s2tmio oodomtn nei t) rrmu  ;t4tpeomfeilsfm2rln s;t4treoif3iytfate uvs;t0trxoio oydame liet t) rumxm nu0tptoiiciltfm2eau p;t0tltnif3totopDrlueo;s)teuoim ny4lltelnetlsfarum( ooo0apxo f3iydla2ul(ms ()tltnmf3ootlpte u sls texoio3iu4ol elnvia(f Drmx onu4aeeniieiyt m eaumont4aeerio3iytfmDe nvs;s)seur(opoo4lmtn fesat srrm(rpot4tpx mociydls2rlumpnt0aetnir to1opD aneo;s) 2toim3oy4ap nmieia(fsrrrurono1opxnmociyt aDum( o;()tlxoxf3to1omtelu sl(  exmio no4ape lfvtatfaDurx  ;o0opx mf3tltlm2elnms (4 rerxfciodoateli ilt0 etm(m iydoptelfes t arrmump;o1oleoiiciltla ua( o;t0alermrcoodla rauei;t0 rtriopiy4olte nct t sDrr(mp;u0tpxnmociad sDulums t4aexomrciodfpDe uvo;()srxo(opoy4amenlivtat)arrrum ;o4oet mo3iadlmDrmn ont) reoiociy1fa r ieol( tetm(o3no4om nmfcsl() 2rmurp;o1aptoii3ilsla2um( snu4trtnxo iatlpD aieo t0s2ur(o3ny4al nmnei (f Dumxmpnu4teen o3iydfaDumumon(0aetrif oytfateaueolt0sruoxo iu1am  mfetat aDtru  ot1ope  feilt s2el(mo t4arerio3oy1oa rai i t0t2uoiopoydapt lfeilt)a2tr( pno0olxomociys s2rmu sn(0 ltrifcty1oat aivsl()srxmxm3ny4apenlnciat)sDurx ont0oetn feils s ulump () leoifciodfptelieslt)t2toir3iydamenlivtas aDrru  no1aee ifeiadfs rmumonu)arxomr3tadla elivo t0srur(mpou1al emfesa(  Dtm(r ou4oexn ieiydfa2rlnvo t0 rtrxr oatoat  nei (0s2xrxrpou4lpenlfcia(fsrrmu ooo4tex  octysls2rmumonu)trtrmr3ta1omDelnes;t  eurxopiudlmte nvtl() Dra(m nt4aetniietadlmDrlnmo t4 leoxrcoodfa eanvilt t2toxm nodamtnmncil()s2tm(rp;t0tleo iciyd a2em(vsn()arxnmf totlmtran il() rtmio3iodopt mfvt t  rrmum no0oeenioeildfaDemu o t4trtnxr3ia1om  auvs () rumiopio1om   ivt t  Dtmu  nu4tlxn i3iyt m2ulnms;(4aetoircoy1faD lu s t)srtoxm iudomtn nesas  Drrx ont4ale mociat aDelnmp t)aexnmf oatlmD  i ils sexoimpiu4olt mics t)s2trur ou0tpenifciyd mDuauvsnu)texnxo io1omD  u s () eto(o iu1lmtelfcsl()s2rau o;t1apxn i3iatls2emuvs;()trtomr3tatfa rlieo;() exm(rpiodlm   fvia()aDumx pnt0oeto iciydfm2ulnmo;() lxnxoctotlaD lnes;t0 2xo(m3ou4amtn fctlt)s2rm(r ou1olt io3ils m2rauvon(4 leoio oatlpD  ues (  euo(mpoo1apeelnvs s srtrxmpnt4tpe io3iasls rmums;t) ltrxr3oydopDr ieo ( srtrxr3iu1opt livtas  2rru  nu0tpe  f3tldfm2emnmo;t0 lxrxfcoytlaDelnvi;t t2uoxrpoy1alt  ics s)sDurxmpnt1tpx mieiytfa2rm(mo;t0 etnio3to1fpDrlnvol(0 exm(mpoudalt  fvsat aDur(mp;o0tle miciat s em(mo (0 lxnircootlm rlnvs (0srurirpoudam n ivi ( s2taumo;u4tex io3iaslm el( snt)arxomf ty1oateau s;s0t2uoxr iy4apte ivtlt)srur(ronu1tle if3iys s raumont0teerxfcoytla   u o;t  exmxmpoydopeemfesa( a2trx p;t1oeeoif3tatfs2ulu onu0treoio3oydlp  ln i t setmio3nodomtemivs s) 2rax pnt0opxn octltfm2uanmp;()arxnmrcoy1fpDe i s;t teumxm3io1ll  mfcsls  rtmum no4tlenmfeiadla2rmnmo;u4alxoxfciadfmDrai o;t texr(o nydll n fvsl()s2taump;o0oex io3iyt s eanms u4 rerifcoy1lptr n o;t0srxoxo oy4ap nliei ()srraxm ;u4oetnioetyslsDulnvo;t)artnmoctatfpteluesl(  exrim3io4omtnlnvt (fsDtrxmoot4tpxnmicias s2ra( o t) exnxociotfmte i s;t trtoxm3oudlmen fesls)a2tm(moot1opt ifetldfaDeaums u4alermo3ia1fa r u ils) 2tr(opno1lltelfeia() Dtaxmpou4tpe iictysfsDuauvo;()aexrmr3tadlaD  uvo;()trtrio3nu4alee ivias)sDrr( oot1tlenmo3tydlmDumu snt4 lermocootoa r ivo;t0seto(r3oy1lmt mfetlt) 2tmur oo0oleoiietasla rl(vp u0trxnxr ty1lpDrlnes;( truoxm3ny4ll  lfvt tf 2rr(  no4aeenif3tls m ul(mp u4aexnif3oytlate n ils  2xoio3no4op eliesasfsDur(mp;u0tlxnmieils aDemnmp;()alxrmo oodlpD lueil()trxrio3nu1aptemict (fa2rmxm ;u0opto fctys mDea(msnu0tltomociatla rai i;(  2umio oodaptnmietls  rtaxrpno4alx moeiat aDemnmpnu4trxnmr oa1late neo ()srurio oudap eliei (faDtm(mpnt1tpt io3tls a eln p;()arxoxf iy1opteaueo () etmim ny4alen neiatfsrtaxro;o4tet mfctyd m2ulu p;t0treoio3iodoat  nvo t srxoxopnodopeelicsas a2urx pnu1apeo fciytlmDrlnms u0aexrir3oa1omDe i o;(0srum(r3oodlpte fesa(  rrm(  ;o4texniocilt aDua(vs;(4arxrir3tydomD  nes;t0 rtrir3iu1ap  mfeiat  rraxr ;t4aee io3iltlmDelnvo;t) ltomf iodlp eaues;(0t2toxm3nodam nmfeil(fsrumxm ;o1tetnio3ilt s rlumpn(0 lenmr3totfa e uvs;t srurxr nudlmee ncsas sDrau oou1olen i3tlslsDemnmp (0tlxrxo iadlpD aivi;t truoirpiydam emfesas)s2taxroou0oeeoiiciltla em( pnt4artnmo todfa r nvi;( seumxopiodoltelfvi () rra(roou0tpt  icild a2em(vonu0 ltrmo iatfa r ieol(0s2xr(r3iy1lmen ieiat  2trx onu0aex  i3iysfs2um(mo;t0 reoxr oodoaDr i s s)t2toir3nydlpt  fvtl(fa2taxm nt0olxnif3iat m umnvs;u4tetrmrciotlaD livil( texoir oo4aleemivsls  rua(r ;u0ole ii3ilslmDeanvo;() rermfctydla raues;t  exoxo io4lpenlietlsf Duaurooo0aex mf3iltfs2ran o;t0 etoiocoytop r uei;s0 exmxm no4lptelfei t  2urxmooo0aptn o3tadlm raumsnu4 lxoxoctatoatraneols  exrxmpnu1aptelfvi (fs2uaxront0oleo octydfm rlnvo;u4trxrmf iatlm ean i;( teuo(rpiy1al nlnvs s a2um(rp;u0apx  oetydlsDean on(4trtoircty1oaDr ueo s0texr(opnydalt mfet ()sDtru ooo4tlx mi3iyt s2rauvo (0 etnir3to1oate nei;s  rxrxo3nu1ame  netatfarta(mp;o4apxoif3tas m ulums;(0aexnirciodlaDe ueo ()srtm(mpnudopee ictl()s2ua(  ou1apxoifeild a ra( p;(4alxnmf3tatopD au i s0s2uoxm3ou4alt  fct () Dra( ono1tex iieiltla emumo;u4 exrxfciotomDeaivs;()trtmio oydopte ivil()s2tmu  nt4tlx  o3iad s2emnmon(0tltomo3tytfm eanei s0teuoir nudoptnlicilt) rtm(mp;u4aetn iciydls2el(vo t4 rxrio to1oa rluesl(0s2trim3iydlm n fcia(fsDrm(m ;o4tpt mocilt s ua(vpnt) lxnxfcta1oaDrlivi;s0srum(m oudomenmiviasfaDuaxmpnu1tpe ii3tlsfm2elumsnu4altnifcio1oa rai i s t2xrxmpny4lpenmnvi t  rrru  nt0apx  feildlm eanvs;t)arxnxr oatla eai s t0t2xoim3nu4omtn fci s s2trum nu1tpeomoeiatfmDeau o (0alxrio tytomDeai o;t) exoxo iodaptelncs t  Dtmumpno1tlt ifciysls2uaums t4texnxr3ta1latr neils0trxr(r3oy1ome lfvsa()sDraxm nu0tpx ifciytfs em(vpnu0altnxfctodfpDr i ils0t2urio3oydapee ivtltf 2tru  ;o1oex  oeiadla2um(vp;t4 lxnioctadomtrlneils)s2toxo3io4ol e ncilt)srumxmo;t1teeomfeils m2ean pnt4 lxoir3oytfm e ieil( s2xrxo nodllt  feslsfaruaumo;o0olx  ictat s2ulump t0aetnio tatfmtrau il( texoir iydalt lnvt (fsDtmx pou1tltoifciys mDulnms t4arenmo io1om r ivo (0s2xoxo iy1lm  lfctas)s2raxroou4apxn o3iytfs2ra( p;t) rermr oatlpDr u s;t) etoiopnodopeelnvi s a2rmxrp;o4optoioeildla uaumo u0 eenmo3tydfate ues (  2to(m3iy1ll   fcs (fs2rax o;t1aetnifeilt s rlu o;u0aetrio to1laDraivs t)srtr(opoy4llee ivia(faDtmxmo;o0olt  o3iaslm2rlu s t)trxrxo3totopD an sl( texrio oydomen ncs t)aDumx oou0olt  o3tatla2ea(msnt0 ltoif3to1omDe iesl(0teurxr iudol emieia(faDumxmpnu4tltoifetlsla2ua(ms;t4altoiociotopD  u i s0srumxo iydoptelivil() 2ta(mo;u0openifctys sDrl(vp;t4texoxf3io1oa  liei s0 exrir ny1ameelivi s) ruaumpno0tpen f3tlsla ea(vp;t4 rtoir to1late iei ( sexoxmpiu4lp nlici t srrmu p;o0teenmietadla uau s;u4trxnxrcootlmD auvs t0srtriopnudomtnmnet s srrr(mp;t0alxo ocils mDrlnvo u4 etnxo ta1fmt lu s;t teto(m3nodomtemnci ()arur(m nu1olxoif3tltlsDelnvs u4altniocoadfpt luvo;s)srur(o3iudamenmfvtat) ruru oou4teeoio3iasfs2rluvp;t0trtrmociadlmDeaues t0 exoxo ny1ope  fvsa( artaxroot1aeeoif3iydla2ulu p;u)tlxnmo iodfmtraneils)srurir iy4ap e fcslt)srraumo;t1ope io3iad sDua(ms;()altoirctydfm  luvilt s2tr(opou1omee fcias)arumu ono1tptoif3tad m ulnms;()alermfctydomDelu s;(0t2umxo3iy4lltnmicta( aDuau oou4oex ii3ildls elu pnu4artnif3oy1faDrlnvol(0s2tmim ou4lltn nesltf 2umum oo1open i3tyslaDeln s;u0treoiocty1fateliei;(0t2xrxr3iy1aptelnei s)s2trx  nt0tetoifeias mDem(ms (4texrxrctotfaDeli o;t) eurxrpoo1am e ict (f 2rr(mono1tle iiciadlm2rm( o;u0aexnmr3iotlm ean o ( t2tmir ou1ap elieta( sDrrxmo;u0tetomictydlaDuluvs;t0tlerxr iodlpDean o;s0trtoxr3oydlm  lfvtlsfs2rmurono0aeeniociysls ranvsn() eenif ia1lp eau o s srxoxm3oo4lm nlnesat  2rmurp;u0texoii3tlt mDra(msnu)texoifcty1oaDeau i s0 rxoxr3nydape  nvil() rtru pou1ale mf3iydlsDuan o u0 lxrmfciytlaD au ils) 2uoxmpoo1ale lnctltfaDtax ooo1aexnmf3ilsfs eau p u0tlxrxfctadomDrlieolt  rxoiopiu4ol  mfet t) 2raurp;u0teeniocildlm2rmuvo;(4teenxr ta1fa  lnvils)teurim io4amen ncslt)srraurpot4optniicilsfm rm(msnt0tetomocty1fm   u ols0s2urir oodap nmfvi ( srtrx pnu4opxomf3ils s eluvp () rtomf3ta1fa e uei;s0setmim3iy4lptelfesls)srurx pnt0alx moeiaslsDrmnvo;t)altoir3ootlmtrli o;s  rtrxr3io1ape lict tfsDuaxmpoo0opxoifeiytlm umuvsn(0 rtrxr3ootlaDraues ()trtoir iy1llee nes ()arrrxrp;t4olx mfeild m rlu o;u4teenxr3oy1faDrlieo;t0t2trxopio4ol elnvsltfarrmump;o0tlx mictlt m emnmsn(4arxoiocoo1fpt  uvsls)teur(r ny4apt  ncta(f Duax o;u0tpx mietysla raump u4arerxf iatfa r u i;(  2umxo ny1lm e nvsls)s2ra(mo;t1tpenioeilt s elu p t4artrmrcta1fmteluvs t srxmimpoydalenmicsls s2tm(r ot1oleomoetlt s2uanmsn(0tltrircoodoa r ueo;s0 euoxr nudlpt  net t)arrrxm nu0opeoioetltlmDrm( snt)aleoxo3iodlp eanvsls)seumxmpiodamte ictat)artmxrpnu1opt mieiyt m2uau o;(4aeerxf tatlp eli o;t0 rurxm ny4openlfvt sf Dta(r ;o1teenioctltlm ra( o (0trxrmf3tadlpDr i i s0 exrxrpiudom e ivs s)arrr(r ou0aexn icilt a umnmp;u) lenmfciatoaD lu o ( t2xoirpiodlm emnesl( srrr(  ;u4aptomf3taslmDea( p t0aexrmocootfa  lnvs ()s2toimpno1opt mfcsls)s2umurpnt4alxo octadfm2elumo u0trerio todoate n o;()t2ur(r3no4op e fesatfsDumxr oo4tpt moctatfa uaumonu0trxnmfcta1fmteanvsls  exrxo3oy4olenlicsat)sDra( poo1aeenmfciytls ua(vs t0 rtoxo3iodlmDeluei;(0 2xoxo3nu4lpeemnci ( artm(moot4oexnmo3tldfm2eau pn()altnmocoatoat ln i;(0 rurxr no4op n fvsl(f 2rmur nu1alt ifeilsls eln snu4 reoif3oytoa e n o s0sexmxmpoy4ol elncilt s2rr( o;o1altnmieildlmDranms;u4tltrmociytfa  auvi;t  ruoir oo4lp nmncsa(faDumx  ;o1tee  fetyt aDuau o (0 rerif3oadoa eau o (0 exmxrpoydlp elnei sfarumumooo4alxoiociyd s ra(ms (0areriocia1oat ln il(0t2umirpnudlmtemivtat a2tm( o;t4tpx  feiltla2rm(mo;(0 lxomoctydfptraueo s s2xmim ou1lpeelnesls s2uax pot0tptnmieiatfaDum( ont)arermf3iy1fpDrai ils teurir3iu4lp e fvs (fs2tru  oo4alxomfeils m2uaumpnu4trxrmr3iy1fa rauvilt0 rtrimpno1ol  lnvia( aDuax poo0opeomictysfa2umums t0trenmoctodlmDelnesl(  rtmxo3oo1ll  livsat) ruax poo4apxnii3tat s uln snt0aetrmf3oatlm  au il() exrxmpiy4lmeelivt tfsrurxrpnt0oeeoifciysfmDrl(mo;u0teenio todlpDelivslt0trurxo3no4am   nvsa(f Dum(r nu0opeo o3iad s emuvp (0tetomo3tatlp rlu o;()t2uo(m3iu4altnmivi s)a2rau  no4oet iietydfa2umnmp;(0altoir oatoateaueol(0s2ur(r3nudapeemicsat srtru o;t4ole mi3iydfm2emnmo;(0 etnxfcty1la  ln o;()seurxo oydapee netls) Dtmu  ;t1ale iociltfm2ua(mo u4trxnio iatfp r nvolt)trxoio3no1lm n fcia( arumxmooo4oex miciadfsDuanmsn(4 leoir3iotfaD luvi;t seur(o3oy4omteliesas) 2ururp;t0tpxomoeiytlaDuln sn(4tetnircoytoaD aieolt0srxr(mpnodoptelfvta( aDtax pnu0oeen fciydls rl(mo u) ltoif ty1oa rlivsl( texmiopio1lm  mneslsf 2taum ou1tpe mi3iyslaDuln s;u) eerxf iodlptelieo (  rtoxr3iu1ope mnvi s  rtmxmoot0tetnio3tltlsDra(vp;() reomf oatla eaues;s0srtr(opoy1am n fctat)arraumo;o4oeeniictas s rlums u4aexoio to1fmtrauvi s s2ur(r iudlmtemivsa()srtmxmonu4tleo octys a2umn s;t0 eeomr3iotfp e ies s s2tmir3ny4altemneiatfs2ta(rpnu0oee ioctadfsDuau snu0alenir oy1op ranvils)srxoimpnodomee feils) rta(rp;t0apenio3iad mDranmo t0 rxoxociatlm  livols  ruoimpiy1lptemncil()srta( p;o0ope iietas m2uaumont0tlxomfcoo1optr uei;() rxoim ny4lpen fvtlt aDururp;o0olxn oeiadlm eanms;u0 rtrxr3iadlat luvilt)texr(o3ny4altelfvs ( a2uaur ot0tetnio3iasfs2rl( p;() ltrxo ia1oa elies ( srtoxopoydlmenmfei (fsDtmxroot4oet ifctytfaDel(vpnu4altomrcoytlp rlueilt seurio3io1ameelnctl(  Dua(ronu4tex mo3iyslm um( s;(4 eeoir ta1lm   uvi;t teum(opoo1oltnlnvt s arra(r oo1tlx if3iasfmDel(mp u0 ltrxo oy1fm elnvi t0 2ur(mpnu1ole livsat srum(rpnu0tlxn octaslsDrl(vo;u)arenmrciatfmteliei ()sruo(o3oo4amtemfcil()srta(rp;u1tltoiiciad s um(vs;u) renmo tatlm rli i (0 rxrir3iudlmtnlnet (fsrua(m no1oetoiiciytfa2raums (0 rtrmr todfat  nvi;()sexr(m3nudopen nvt t) Durx oou4tlxo oetlt mDulumsnu4arenifcoydfpDeaiei;()texmirpiydam   fetls sDurum ;o1opx mfciydls umnmo (4alxnxf oydfatrai s;s truo(m nodapt  nvias)aDua(ro;t0apx miciasfaDrlnvs;u0 rxnxf3iatlpD ln s s sexo(opiodllt lnciat)sDrrum oo1texo i3iasla ulump u4 ltnmf3iodoa r u ilt t2xmxo iu4lp nmfcta( srra(r no1tee mi3ias m uluvp;t4 exoxo tadlmD lu ols  rtoxopnu4ll  lnvs t aDumxront0oex  ieiys aDemnmp;t) lxrxr3oo1fa eaivi t0srur(o iodopt mivias  2rmxmo;t4aleoifciydfaDel( p;u0tetrxf ootla eauei;(0 2xrxopnudopte ivsl(fartru oot4optnmo3iysls2ulump u4artrif3tytoptran i ( t2urxopiodopeemiet t)s2raur ;o1tlenmietydfm2rm( o;(4aexnif3oytfate neolt0s2urimpnudom nlfct tf Dra(ro;t0oeenmieiltfa emuvs t4 lxomfciatopDe ivo;(0t2xrxr no1olte nvils  2tmump;o1tleomf3ild aDeau o;t4tltrif to1fpD  u i;t) rxm(opoodlme miesa(f rtmu  ;t0tex if3iyt mDemuvonu4 exoif3oydlmDeliei (0srur(o3iydlp e ictls sDurxrp;o4olxomfeiatlm2el(ms u0arxrmf3oy1oaDelivi t0s2xm(m oy4al elies t  2rax poo4tpxo feiatlm emnmp t)trxomf3ta1faDrau il()t2uo(m3oy1omtemnvt t)s2uru oou4optn fctlsls uluvont4 lxriocootopD luvsls) rtoir3ny4omt lfviatfsDraumoou0open icild a2ran s ()alxnmf3totlaD li o;s)srxmxm oo1lltelfcs ( a2ta( poo1olxo o3tatls2uau o;(0tleomr todlaD anes s) 2tm(opnydam emfvslt) rtaxrp;o0ale  fetat m2emumsn()trtnif oo1la elnvi;s)s2uoim3iu4lpee fvil( sDtruronu4ape  i3ild mDuanvsnt0trtoir oy1omDr iei;t trxrimpoy4ameemnci () 2ua( p;t1alxomfciadfa2umnvont)arermf3oy1opD  ueo t)trur(r3oy4omtelfvil(farrax  ;t0aexnmo3tytlmDeanmo u)arxnifciatla  aueilt)trtrxr3io4llen fvsls srtax pnu4olx ioctydlm ua(mpnt4tlxomr3tadlpDran ilt)s2xm(o3iudll n netatfartrurp;u1opeo ictydfm emuvon(4alerifciy1om rlivols) 2uo(o3nydame mieta(fsDum(rp;u0ape io3tlslaDrln s;(0texoio iodomD lies ()trtmimpiu4ol  livsa(farra( pnu0tpt ifciydfmDelumo;()aeeoxfctodoatrluvslt)srto(o nu4ale lnct s) Durxrono0tpeo ieiatls em(mpn()aeeniocoodlpD luei;t sexrim ny4llt mnvi (fs2rrur ;o0tetnif3ilslm2uauvpnu4aeermr3oy1lpD li slt0texmimpiy1lpenliviat a2urx oot4aex  oeiyslm rmn sn(0tlxomfctotopt ai sls0 rtrimpnu1ale  nvi tfa2ra( o;t4olt if3tas m2emn o;t0aeerio3ty1lpD  ivo s)seurxm3nu1amtemfvs sfs2trx onu4tpt miciydfa uln s;u4alxoxo3ootlatelueo;t) euoir iu4opt mncsls arrm(ro;u1altnif3ilsfa2ea(mpn(0arenmr iodlptelnvi;t)tetoio oudomt lneslt)srtmu  ;o4apxo fciad m emn pnt4 eermr3ia1oa e neo;t0sexr(rpiu1lmeelfetas  rtaur oo1ale  fetysfm emnvs;u) renmo3oytfp   nvi;() 2tmxmpio1ale lnvs t  Drm( o;u1tpxnmociyt s2uaumsnu)arxnmr totop rlivils  2xoim oo4al   nctls) 2tax  oo1oexn fciltls rlnmo;(0tltnmf3iy1opD  uei;t)srtmxmpiu1altn fes s) rrm(  ;u4oltoio3iltfmDemnvo u0tltomfcoadopDelieo t)teuoxo3iudop nlfes sfa2ur(r ot4tpxn i3ilt s2eln p () ltnxfciodomDeanes;()teuoirpoodllen ncsatfartm(rp;u0opx mietysla2rluvs (4alerxo totfaDeaneols0setmirpoydllenliet s)srrrumo;o0opxoii3iyd aDulnvp;t0alenxf3iydomD ln o ()sruoir3oo4omen iviat artmxmo;o0tpto fcild mDel( o t) etoxfciotomDrln ols0 euoxr3oo4al  mfcsls srtmx  no4ale  o3iyd a ra(vo;t)arxnmf3oy1opDraueo;t0teto(r3oo4optn fctlt s2uaxr nu1altnio3ilsfs2emn s (0teermfcto1lp raivs;(0teum(m3iydomtn nesls s2ururp;t0tleo ictasls rmn on(4 lxoxfcoadfmD ai o;t)texr(rpiu1alenlfei (fartm(ronu0tlto ieiydfmDrlnvo t)tltrif iotoatelneol(  eurxm3no4alt mietas) Drmxrp;u0aexnmf3tytlmDel(mon(4 eerifciy1omDran o;(0sruoim3oy4ome liet tfaDuau o;t4aex ioeiyt aDrl( pnt0alxomocia1lat au s ()seuo(r3oo4ol  lneiltf Drax o;t4alt mi3iytlsDrluvs t4 reomrciatoa elueils trtoxm oo1omt mics () Dtaurp;u4tlen oeiad m2emuvp t0 lxoir iatomDeau i;(  2xoim3iu4ap  mivtat a2taxrp;o0tltnifeias m rmu s;t0tlxoxocty1op r iei (  exmir3iodoptnlnci ( srumx ono4opt ifeiltla ul(ms;u0 exomrcta1lptrli ols0teuo(opny1ll  mfei () Draxmpnt0opxniiciatfa ea(mp;t4aexomfcoytfpD ai o s)s2tr(o iydomt lncils  rtm(rp;u1oex io3iydfm rauvs () ltnxo tatlmD  ueo (  rxrxr3oo1olenmfct ( srrmu o;o1oexoioctltfm2uanvo u) reoxo3to1laD au slt)sexm(opoo4lp elfcsas sDrrurpnu1oetomf3tat m eaump t0texomoctodla ranvo ()s2xoxm oy1lle  nvtatfsrtm(ronu0tlxoif3ils m2ul( p;(4 ltoxo oadfpt liei;() exoxm no1ll nlnci (fs2ua(rpno1ole  oeiad aDemnvon()tlenxf oy1oate nes;t0sruoir ou4oltnmnviltfaDrrurpno4aptnmo3iys m ran p t4 ltnmrciydomD lues ()sexo(o3oy1lm n fctas) Dtm(rpou1aetomi3tld m2eaump;(4trxrxociydfpteaueilt) rxoiopiu1llte iei t  2taurp;t0texoifcilt a2elump u0 lxnif ia1lmt lueol(  exm(r nu4lpe  fetl(fs2urump;u0openiociatfm ul(vp (0artoxf3iotlaDr iei t seuoxopoy1ap e ies (  rrr( o;t0tee mfciltlmDel(msn(0 lxomo3tatoptraneilt t2xm(m ou4ole lfvt t  rtm(m ;u1alx iietys aDeauvp (4aleoio iy1fpteli s;s0truoxo iudamt  ivtlt srtmuroou4ale moetls sDel( pnu)trtomf oydfpDrai s t0t2xm(rpoy1ale licsls  Durxrpno4olx  f3ildfa rm(ms;(4 ltnxoctotfaD  uvs;t0texoim io4aleelncia(fsDrm(mo;u4aet  iciyt a rmu s;u0trxnmr iadlat ai ilt)seurir nu4am nmneiatf rraump;t1tet iicildlm rmn p;t4texnxociydlaDelnei;(0trtoxm oy4lmee fcs t) rtaxrpot0tlt  fetytlsDea(mp;t0trermocto1opt  i o;(0s2ur(opoodamte iesas a2tm(mpno0olt ifciasfs2el(mo;t4 lerir3todlm  lueo s s2xoio oy1ap emnetat sDrax o;t4aptnmo3tlt m2emumo t0teenxr3tytfat  u s;s0s2xoiopnodlltn fctlt)sDra(mont4alxnifcilslsDuaump;(4tlxoir3iodfmtrlivolt)trxrxr iudlpt lfcilsfsrtr(r ou4tpt iociyd m uanvo;()arxnmr3iytop ranvs (0srxmio io1omtnlfes sf rrmu oou0apx ifeiydlaDrmu o;t4 etnmf tydomD lnvi t)srtr(mpiy1lptnmnci (fa2ra( pou1tetn iciyt mDra(mp;(4texnif3tydfmD li ol(0 rurxo3oy1optemfes s)arrrxrpnt1alxomi3iytfmDrl(msn() rtniocoy1fpte uvo;s) 2uo(mpiydllt lictlsfs2uaur ;o0alxniiciys mDemuvont0 etnio ty1lmtraies;t trto(r3ou4apeelicslt)sDrrxmooo0oetnmf3iltfa rlump u4 exoif oodomD lues;t0 2ur(o io4optnmicta()s2taur ;t1olxn i3tlslm2emuvs;t)aexrir3tytoat  ies s  etoxopnu4ap e nvi (faDurumooo1oeeomocildfsDemn p u4trtnmrciatfa  au ol( texm(m nydam  mfvias)srrau ono0opeomf3ildfm2rm(vpn(4 lxoxfciatlp e uvo;t)srxrxopiu4apeemivtl()s2umx ono1oltn ocild m2rmn s u4 rtnmo3tytfm  luvs;t sexmiopiy4apeelietl( artax  ;t0tpxoii3iad m2uau p u) lxoxfctatlptrlnvi ( srtr(mpny4op  lneils)arrm(r ;u4tltomoeiyt aDul(vp;t)aexoioctytfaDe i ol() 2xo(m3oy4ap   iet s) 2uax p;t4texomociydfm el(vo;t)aexnxrciatomDr iei (0 2tmxo3nodomte fctlt)aDtrxmpoo0tpt mfctltfs2rlnvp t0aetrxf3oo1opD lu ils) rxm(o iydam nmnvs tf 2ur(  ;u1tlenmo3tldlmDrl(mo;(4aleoxf3to1la  aueols)sexmxo3oodolen ictl(f Dua(mooo1aexomo3tldfa el(msnt) reoxf iadfp raneo t0sruoxrpio1lptemfesatfs2ur(  oo4tptoii3tydfa rl(vpnt4aetrio3tatfmDe nvilt0trtmxo iu1lltemfvsls)s2ra(rpnt1tetoif3iltfm ra( s;(0 ltoxr3ty1la raueslt) rxo(mpou1llen fet s) rtaxmpoo4altniietlt m2ua( s;t4 ltrxfctydoaDe n o (0 2xr(r ny4ame livtl(  rrmurooo1ape mietltlsDrau o;(4aeenxf3iadlp rlues;s0setrxo3oydal nlfciasfarra(moot1olx mfctlsfa eln snt4tetomf io1om   neo s sexoio3ny4op  lfcia(fsruaxro;o4oleoiocilslm2em(vs;() rtoif iy1fm eaiei;()trtm(r ny1lptelnvsl( arur(m ou4texomo3iysfaDemn pnu4trxoiociatfpt an o s0seurxo3ou4op   ici ( artrumont4olen fciat m emn sn(0tetoxfciy1omt ln o;s) etrxrpiy4aptelneta( s2rm(mpno4apxnmf3iysls ea(vs u0aetoxr3oa1fa  lnei s  2tm(r3oy4ope mivt s arrrxmpoo4olt  f3iadlaDrm(ms (4trxnmfcoydlpDeai o;( texmxrpiodome  nvia(fa2ra(mpnt0tlt moeiatfmDrm( s;()arxnxf3ootlaD lneslt s2xr(m3iu4am nlfvt tf ruru  ;o1olxo feiys a em(mo (0trtrxo todomt anei (0 eur(o3no1lm   fvsl( aDum(m oo1aetn fctydla eanvp;u0aexomf3oy1fmDelu o;t  2um(rpou4opee fcil() rur( oou0tpe iieias a2rlu p;t4aleoio ia1latelivs ( srurxr3oo4ope licslt)srrm( onu1texnio3tad aDulnms t4trxomfcto1lp elieslt trur(r iudlmen ncsls)srumxmpno0tex io3iydfm uaump;u)tlxoxr oa1op raueo s tetrxr ny4ll e ietat)a2rrxrpot1oltn fetytfs eanmonu)texrmo3oodom e ueo ( t2xrim3oodaptnlfvsatfarrrur ot1tetnmociasfa2uaumont)altrmrctotfat anes;s0srumxrpnu1oltemnct sfarrmurpoo0altoiociaslm2rlnms u4artoxfcta1lm e uvs s)teto(m3oo1apeeliei ()aDrmu pot0oeen ietadfaDum( snu4trtnir3oatfmt  n o () 2xr(r no4optelieta( sDua(r ;o1olxnmo3ilsfsDrlnmsn()teeoir3oydoa rlueols0seto(r3oo4oltnlnct () rurxm ;u1tpeoif3tatfa umu pnu0arxomrciotomtran s;t0t2uoxm oudlptnlnesas)aDrrx poo1oleomfciaslsDemump;t) lenmo3tadlmD  i o;s seuo(rpoy4altemnesas)s2rrx  nu4aeen ociadfa ua(mo;t0altrmrctadopte i s ( s2uoirpiu1oltnmnciat srtr(rpno1aetn f3ils aDrlnmsn(4 etnmocoadomDeaieo;( seto(o3oodalt mivi ()a2trx pno1oexnmieiatfsDranms;t4tltrxrcto1fmDrlivi t0 rtmxm oo1al nmieilsf 2tmumont1olx ioetldlsDean s;()altrmr3oatop   ivs;(0 2trxr iy4olt mnvs (fsrrau ooo0tee ifctytla ua(mo u4tltnmr3iotfp  livs (  2uoio3iy1lp  mncslsfsDrr(m nt0opxoiietltfaDul(vs;u4 ltnxfcoo1omDe ivs s trto(r oydlmee ncilt) 2rmump;u4tetnif3taslm rmumon() rxnxf3oa1late ivolt sexoxrpno4lm  lncs s)aDrr(roou1opx iicias a2ean p t4aeeoxoctadom eln o;s)seuoxr3iudlpen icsltf 2rmuro;u0tetn ieiatlaDrmumo ()aexrxr totlaD  n i;s sexr(r3nydlltn ies s)arua(ro;o1oeen iciytfs ra(vont0tlxoir ty1fatrlnvol( texoiopiy4lmt mfviatf rrau oot1tptoiicias s uluvont)alermrciy1lpDean o;t0teurimpoo4lptelncs t s2trurpnu0tlenif3ild m ea( s (4aeerxr oadop  lnvol()sexmim3oodapee neiatfa2um(mo;u4aee mi3tasls ranvp u4artnmr oodoa eluvols truoio ou4ol  lnvtlsf Drrumo;o0optn o3iadfaDumnms;(4texnir3tydoat aivil(  exmxm ou1ol nmneil(faruaumpoo1aptnmictadfm2ranvp;(4tltomo3tytoptr ivi;(0 2uoxr3iydolte ivsatfsDrmxr ;u0opeoii3tadls elnms (4 ltnxf3oatop e ieil()trxmxo oydal  mics t) rtr(r ;t4tleomiciltlm2emn s (4 lenxo iatfmDrlneo (0t2tmxmpiodap elfvi s sDra(mooo1aet  fetadlmDul(mo t0 ltoircoadoa raivo (0srxoxo3iy4omt  ivi (f 2rrurono4alto oetasfs2ranmo;() ltriocoo1lptrau o;(  exoir io4lltnmfctas aDtrumo;t0olx mi3iyslmDemuvp;(4alerifcia1lm rluei ( tetm(rpoo4amtnlicia(f rraxmpoo0aetoifeild sDum(msn(0 exrifcia1faDelu o () rxmirpny4ll nlnvt t a2rrurpnt1apt iieiltls2um( snu0tetnxo tatom  an s;t)t2umxmpoodlpen ietls)artr(m ;u0olx mfciyt s um(vs ()trxnmf3tytlm eln o s)t2uo(r3io4am n ivsat)aDrrumono4texomoeiytfs2rl(monu4trxoif ty1oaDeai i;t0 exmir nu4ll   nctl()sDur(r no0oetnioeiatlm emuvon(4altomo3oydlaDeluei (0 eumir no1ape mnctl(  rtr(moot1alxo i3tat m umnmo;u4texnio3oadop raues s  2xr(m3ou1ol  mnvta( a2raxm ot0alen oeiatls2emnvpnt) exoxf iytlat liei t t2umir3oo4ame mfctls  2rmu pot0oeto oetadfa el( p;t4arenxrciydfmtrau i;s t2tmxr iudaptnmies s arururoou4aptn icils a eaumo;()tlxrxo3iy1fpte ivi t0 eurir oy4al   ici ()sDrmum ;t0alxnmocildfs2rln p;u)teeomo ootoptean sls) exmir nydoltn fesa( sDurumooo4oet mieiytfmDulu pnu4trxnxr oadlmDeauvolt)s2um(rpio1lm nlicslt)arrr(mpot1alxoioeiatlm2rlnmp t) rxrxociotoa r ueils0 rum(m oy1ap  mfcslt  Drmx pot1optn oetytfsDuanms ()alenmrctodfmDrlneo (0seum(o3iodll  mfvs t arumx  ;o4olenmfetltlm ulnmpn()aexnxo tatlm raneslt0 2umio io1om elfci t) 2urxr ;t4tex iietytla el(vo u)texnio3ty1lmtrln s;(0 2umirpoudalt  netas artrxm ;o1tptomieildfs ranmo t4teerio3tytlpD lu o;t)seumim iu4apteliesls)s2trxmp;u1tpeomfeiat s eau s;t4aetoioctatfmtelieslt)teurxo oo1lle  iesa() rra(r ou4opxo oeiadfsDel(vpnt4arxrmociydlp elneol( t2tmxm ou1al elfviasf rtaxr nu0alen f3tatla2el( s (4arermo iy1omtrau o ()t2uriopny1al  lfctl()s2ua( pnt4aleo o3iatlsDrlu pnu) leoir3ta1om r uvslt)sruo(mpiy1ome mieia()s2taxmono4tpxnmf3tyslsDumumsn(4arenxf totfa e nesl()teuoir iy1opt lici tfs2uax  nt1tpt mfeiytls emn p u4aetriocoatlpDe ieo t)s2toio no4om nlfcia( srtax  nt1oleo i3iltfa umnvo;t) lenxfctodfat luvols0texo(r3iydomtn feils)arraxm ou0texo ictyt a2rln sn(0alxoir3oydfmtr uvol()truoimpou1apt mfcias a2umx oot0oexomf3iydls rmn snt0tltrxrctodfatr u olt) eto(m3iodam nlfci (f Dtmx ooo4olx mfeiyt s ranmo;t) lerxf3iatlp raueils) exmxm3iy1ap nliesls srumum nu0tleoiieiadfm uluvp u0areoxf3iy1lpte n s;(0sruoio iodlltemivi t) rrr(  nt0oet  octytlsDeluvpnt4 lxomr3ootoatelnvo;s)srxm(r3oy4lp  lnvslsfsrtmx o;t1aleniiciatfs rlu snt)alxomo3io1op  ln i;( seto(o no4opeelfeiat)srtrur nu0teenif3iysfsDrmumo t4tltnxfciydla raieilt s2tr(r iodop nlfesl()aDrm(rooo4oex mfciysfa ra( on(4 rxrioctodom e ueslt) 2to(opiu4opte ici t) 2tmu pno1aetnii3iatfa2ua(mo;t0 etrif tydomteai i;( setr(rpnu4lpt lnvi s) ruau onu4oet iiciadfmDel( snu0tltoif oa1lmtr u s;(0 euoio ou1ale mfciasf 2rrurpno1optoii3tasfmDrlnms t0 eenif iydoa e n o s) exrxr3nydapt lnvt ()srrrurp;o1aetnio3iytla em(vo t) leoxr tydopDeliei;s0trtr(mpny1lleelnvtltfsDraurooo4tltn fetld m2um(vp u4tetnxf3to1opDe ivslt)t2xmxr nodamt  icilsf rtauro;o1tpeo ictytfaDrlnmo u4aleoxo3iotfmDr neil()trumir3oy1apt lfvsas) 2umumpnt1tpx  octld s ea(mo;(4teenmocto1optr nei (0setriopiy4olt licsatfarrrxmooo4oetn o3tatla uanvo (4arxrir3tytlmt livs ()setoxrpnydaltemnvsat a2rm(rpnt0tptniictat s rl(vs t0 lxnmr ta1oa ran o ( srxrim3ou4lleelnetl()aDum(mpno1alx  oeilslmDrluvp u) leoxr3oodla rliei ()s2toxo ny4omeemietas)s2rr(  oo1texo i3taslaDrluvp;t4 ltoxr3to1la  livs;(0srurir nu4llenmfcta() Dumxrpnu0aexo iciadls2rl(vp u4teermfcoytfaDe ivo (0 exm(o3ny4omeemfvslt s2ur( pot0tpt iieils s rl(vs ()tltoif3oa1omt  ieils0 2urxrpoy1amte fvia( aDumx p;t0oex mi3tydls emnmo u)tlxnirciodfmt aues;t s2xo(rpoydamenlictat) Dra( o;t1apt ifctltls eauvo;u)trtrir iatom elnvi;t  etmir no1op elnci ()arurump;o0tlx  fciadls2ul( pnu) etoxr3tadlptr neils0 exrir oy1am emnct tfsDumx  ;o1alxnmieiasfm2el(mp t)aexnxo3iodoa   nei;t t2umxm iodap e ivt t  rtm( pot0apenifetltla elnmont0 exomo oy1lat ai o ( sexoir ou1lmte icilsfsDta( pnu1alt mo3iysfaDul( snt)teerio oadop   iesl(0 rtrxr iudaptemivt ( arurx ont0apenifciatlm2ua(ms t4tlermo3oatlat  u sls t2tr(r3io1amte nct sfsDtrum ou4alx  fciltlmDrmnms;u4aeenir3tadlptrln slt  euo(opiodlle lnct sfaDtax  nt0ale if3tld sDulnvo;()trxnio ty1latrau slt)t2uoxr3iudal   ncsls  2ta(r ;u0oex ioeiatlaDuanvs;t0aeeoif ty1opDeai s s)t2to(o3nu4ol e icsat s2tax pno0alx iictad mDeanms;t0aexrxr oatfa eai i t0t2uoxo3ny4altelnetls)aDtr(moot0tlxo octatfm2rl(mont4altrif iatfateaueils trxm(mpnydlm n nvs t s2ta(mono1oleomieiytfsDulnvpn(0 eenifciy1lm r nes;s t2tr(opiu4lleelnvs sfartm( p;o0tptoioeiytfsDul(mo;t)artnmo3io1lpte u ol( s2um(o nodap eliviltf 2tm( p;u1tptomfcild s eanvpn(0teenir3oy1fmteai slt0t2to(m3nudop nlfcs ( s2uau  ;u4olx mi3ilsla ul(ms t4aexnir3oo1fmD  ivo s0s2urxo iodal n fcilt aDurxr ;t0aeen oeiys sDea( s;(4trtnmf iotoaD au i;s)srurio3no4ol  mfesat a2umu  ot4tetoiociydfaDraums;(4altrmf ta1fm  li slt0 2uoxm iy1ame  nvsasfs2trxrp;t4optn ieias sDran p t)alxrmf3oo1opt  neo;s  rurxo3oudoptelnvt s sDra(rp;u4opeoioetasfm rauvp;t0 lxrir tydoat an ol()s2trirpiy4lmtnlfctat) Drr(  ;o1tlxomo3iysfs2emu sn(4tlxoxo3iy1fmt aies;(0trtoir3iodop   nvta(  rtm( oou0oexo ietldls eaumo;()trenxf3tytoaD  nvils  rxr(m3io1llt licias s2urur oo4tleo octldfsDrln sn()arxnir3todoate ivi (0tetr(mpiu4lleemnvias aruax o;o1opeoii3ias m rluvs u0 exomr iadopDe ies;() rxrxmpno4llte icsl() rrmumonu0tltnmoeiltfa elnmo t)aeerxfcoatopD  nes;() etm(m nu4oltnlfvslsfs2urxr ot1apenmfcilt m2ra( s t4trenxr3iy1la raiei;t  2xoxo3nudapt  netls  2uax  ot1oet  fciyt a2eluvon(0 etoxr3tatoaD  n sls0 2uoxopoo1optnmfvsat)srrmuro;t4opxnmfetatfsDuanvont4 rxoir tytlpDe ieo;()truoir3ny1ll  mietl(  rrrxrpot0tlx  fciasfaDumn o t0trxnmr3iotopD aivi (  eto(r iydolenlfvt (  Dtmxrp;o1aetnmieiysfmDra(mont0 lxnif iatfmDraueil()teuoio3nydam elfcilt)aDtau pou1tltnifetyslmDra(mo t4 rerio3io1oa  au i t truoio3no4amenlnvtlt arurumo;u1oeenioeiadfm2ulnms;t0 eeomo oodlmt au sls srxmir3ou4lm  mivta()a2urum nt1teenifeilt a2ea( o;t0alxrif oy1lp eln slt  2trxopiy4ame  ncs ()aDraum ;u4tpenmi3iysfs2ulnvpn()alxoxo3io1fpD lnvo s0s2urxopiy1am   nvtas) rtr(rpnu1apt iietydlsDuluvpnu)tltoxfctydlpteli sl(0seuoim3no1om  mfvi t  ruau pou0aetoii3iad s emnvp;(0 reoxr iotfpD ln s s texoirpoo1amenlfvsas a2umx  no0texoioetytls uanvo ()aetoxr oatomD  ueils  exrxm3oo1ol  lnci sf 2rrur ;u0tlx  fciltfm uanmon(4tlenmrcoytoa   i o;t0 etoxrpoy4lm emici ( s2tr(  ;t4oleo iciaslaDea( o u4aetrirctydfm rauvs;(0s2urxmpnu4oltn fetas s2rmxmont1tpxomo3iasls eluvs;t)texriocoy1oa raiei s)trxm(opoodlp e nci tfsrtmxm oo0opx ifeild m2em(vs;()arerio3iadlatr uvilt sexo(rpoodop nmivils) rtrumooo0tpeo ietlt m2ranvo;(4artrif oo1opDr uvsls)tetrxr iu1op emnei tf Dtau oot4tpx ifctytfa2ulums u)aexnir3oatfatr i s;() eur(o3oo4lmtnmnvias) 2ur(mpoo0olto ieiad m2ulnvp u4teerxo tatomDeau o;t)s2tm(o nodll nmnvslsfsrtaumoot4alxo iciad m rau o (0artoxo ty1oat auvi;t0s2xr(o no4ape mnesltfsDumxm no0oexo i3tatlm el(vo;u4 etrxo3todoa eai o s  2urxr ny1aleemfesat)s2rr( pnu1tpenmiciatfa elnmp;u4 rtomo3tatopD liei;t0setmxmpiu1lpenlnetlt) rraurpnt0tpxoii3ilslsDem(von(4areoio iadopD lneil(0texrxrpnu4omt lfvtlt aDtaumo;u1aexo ociyt s emuvpnu)aeeoiociatlpD ln i;t)teuoiopno1ll emfcils) Dtmu ooo1tetomietldls uau p;() lxomf oytomDr nvs;s  rxr(r iydlltemfei s sDuau  ;t0aptnio3ilsla uluvpnu4alxoiocoadop rai o (0 2xoir ou1altnlfcsas a2tax ono0teeomictasfs rluvo t)aetnxo3oodlm eaues;s tetriopiy4lmenmicta(faDurumo;o1optnif3iyslsDua(vsnt)arerxr3iydomtelivilt  etm(r ny4lmtelfvil()a2taxmpou4tex  ieias s2um(vp t4artrxo3io1fmDrlueils0 2uoir3nydamte fvi s) ruaxro;o4altnioeiad s ul(vp;t0 ltnxr todoa   ivo s seto(r oo1al nmivtltf rtmx o;t1olx  ietlsfaDuaump;u4tlxrxo oadlmtr ivol(  rto(r oydole lfct s aDrm(mo;t4tex moeildfs eau snt0arenxr3tytlpt  i il(0s2tr(mpnu1lmte neiasfs2rmxmooo1tlxo feiad sDean o;t0artrmo oo1fmt ln s;t) ruriopiodopt  nci t)aDta( onu1alxn i3iltfa um(mp;t0 lxoxrcta1om rln o t seum(rpoo1ll nmfvt (  2raumpnu0texnmieildlm2elums u) etnir3oodfaDean i (  rxoir ny4llt lict s srtaxrpnu4alt mfeiadlm2em(mpnu0trtrio3iadfpD  n i;s) 2umxmpny4optn fet ( srrrxr oo1aetomictydlm ua( o;u0tlxriocoadlatrauvo () 2urxr iydaptnlfvs (fs2umxrooo1tpenii3iyd m2eanms () leoif3oydlp   n s;t)tetrxo3iydolt mfei ()s2rax  ot4opt ii3tlslm ran s t4texomo io1lp rauvs;s teurxm3oy1olenmfciasfs2ra(ro;u1apxnifctyt s2eanms;u)arxrio3oy1om r u i t0setr(m iu4olenlnvs ( sDtaxro;t4aexoioeiyd sDra(ms () rtomociydfm eluvi;t t2toxo3ny1ame lfcia(  2tr(rooo1aleomiciydlm2rl( o;t)tlxoxf3iodfa  lnes t)t2urir oy4apenmivsl(  2rm( oot0tptnmfeiys a2rm( p;u4arxoxf3ta1fmDeln ols)s2toxo3io4ap  lfvslt artaxmpoo1tet io3ilt aDuauvsnu4texnxo3ty1op rli o;(0 etoxr io1lltn nes ()sDrr(rpou4tpxo ocildlmDumums t)aexomr totoa r ies;(0teum(mpnu4om  lnctls) rtr( ooo4tpxn fctlsfmDrlums;u)aexoxrcoy1opDraieol() rxm(r3oy1ll emiei t)s2umumo;o1apxn octatlmDeln pnt)tlxrxf oydfa r n s;t0srxrxr3iy1lm   nci t)a2rrx pno4oet mieiys m ul( s;(4tetrmf3iotfpD auvo (0seuoxm3nudlp n feil() Drrxmpot4aeeomo3iltla umu ont4aexoirciatfmDrauvo s0srxmxmpiy1llen ici t  Dtrurooo4tleoioeiatfmDeaumont) reomf3totfp eau sls texrxrpou4op  mncia(  rurxront4aee iietlt s rlu s;(0aetrmr3oy1lateai i;( texr(m no4lpte nviasfsDua( pno4aleoiicilt mDraump;t) etomr oy1fm rlivo;t  etoim nodol nlfvs sfsrrruroou0alxomfeiytla2el( o (4aetoxf ta1fptelnvs;t)t2xo(o iy1ame lnetatf Drmu onu0tlen i3iltfa2rluvp;u0 rtomf ta1fa ean s t)s2triopiy4lmtnlnct s a2taxmooo4aeenmi3ildfsDuluvs;(4 lxrmr ty1lmDranei s srumxr iy4ap elivs ()srraxmpou4opeoifctldfa2eln snt) ltoxf3oatlpDeluvslt0t2tr(r3oodlmtelieslt sDtm( o;o4olxoiiciltfsDua(vs u4 renxf3to1lpDraiei (0t2tmxm3iydllte nvt s)s2umxmp;u1ope mi3tat a2ea(ms;u0texrif3iytopDe ivilt)srumxo3iudope lieslt) Drru  nt4tpxnmi3iat s uaumsnu0 etnif oydfpD lu i;t)s2xoxmpoy1altnlncsas sDtrurp;u1tex  ietldlmDumump;u0 lenmrctatopD  iei ()teurxo oudapt lnvi tfa2tmu ooo4olenif3tatlsDra(vo (4 rtomr oytfmtrauesl( t2toxopio4aptnmnciasfsrua(m ;o1olenmi3tldfa2emn p;(0teeoircoytfm eluvo;() rtrxm iy1altnmieta(f ruaumonu1
\ No newline at end of file
@@ -0,0 +1 @@
+i sl()t2xoim3io1ll nmieil(f Duaurp;t1apto i3iyd aDum(vs u) lxomociodlpDeluvi;t)srxmir oy4oltemics sfa2ur(mpot0oex mo3tasfs rl(msnt0teeoir iodfp  lueols0srxrxm iu4ol elictat srtaumooo0oexnmoctydfm em(mont4tlxnxo3ty1fmt  ivi;t t2xrir iy1ol  lnvt t aDtaum ;u1tptn ociysla rl( on()trtnif3to1oaDeaies;(0trum(mpoy1lme lfeta(fsrrr(rpnt0tetnii3tytlm2rm( sn(0teeoir tydomDraivo ( texrir oo1omtn fct t)s2uaum ;u4tptnmoctatlm2uanvs;(0 ltnifcoa1opt  i s s t2trio iydaltnlict sfaDtaxr ;u1teto ictltfaDul(vs;()tlxoxrcta1fa rlu o t) 2umirpiydamenmfetltf 2uaxrpoo4olen ictysla ra( p;u) lxnxrciydlaDrluvils0 etm(o no1ap  lfcsl( aDur(  ;t1ole mf3tatlsDrln s;(0 eermrctytlmD  uvol( t2trimpnodap  lnvtat)a2um( pnu4oeen ictls mDua(vont4aetrxf tytopD ln sls0t2tmimpio1omen nvilt s2tr( o;u4tltoifeilt s emn s;t0 rxoio io1faDeaueols  etrxo3no4openlfvsa()aDrrx p;u4ole mfeiyt m2ranvp;t0artoxo3ia1op elnvs t) rtmimpnu4open iei t  2raumooo1opxo o3tat s um( p;t)tlxoxf3oadlaDe neols) 2toxr3iydop  lnvt (fa2ra(mpou4tlx ifctydfm2rlu o;(4 exrxo3oytop raueolt0 exmiopou4optemies t sDrrump;u0tee moetysfa uln s t4 reoxr3ta1lp rau sl(0sexmimpiu4lpen ietlsf Drmxroou1optnif3ilt s2uauvo;u0aeenircoadop ran s;()srxoir oy1llt lnvsat)a2ta(rono4oleoifetltfa2ul(vs;t)arenifctotomDran i s0 2uriopnydlpt lictlsf 2um( pnu4tpx  oetysfa2eln o u0tetrxr3tytlp e iesls0 2tmio3nu1ll   fvt ()s2rrxrp;o0olto feildlm2em(mpn()artomr iadlm  aneo t0t2trio3io1alenlnvi s)arrru pno0alxnifeilslsDemnmo u)aeeomr oa1oat  uvo;()trtrio nu1lmeelietltfsDuax p;o4tetoii3tad mDea(vonu4alxoifciadfaDran o;s texrim nu4lptn fvtas  rraxmooo4tpt  ieildfs um( o;u4alxrxo ty1la r ivi (  2urimpnodolt lnetas s2uax  ;t0apeomoeiat mDum(ms;() renxo totfmtranei;t0 rur(r oydameemiesas)srururoou4olenmf3tlt s el(vo;t4 ltrirciodomtean o s)trtmxr nydop nmicsat aDuru onu0olto fciatlaDrmn o u)arenmocoydfpD auvo;(  exmio ny1lm  mfct s)a2tm(rono0tpxo oeiatfm2umu p (4tlenmociydfatrluvo;t srtrio3io4al  lnvi s aDtrxroot1tlt io3taslaDrluvsnu0 lerxr iotoaDrlueilt tetr(o nudalteliet tfarumurp;t0oee  iciytlmDeanmsnu0 rxrmocia1omD auvsl(0 2tm(opoydlmt  neias  Drmu o;u4oeen ietadlmDrl(vo;u0 rxoxfcoy1opDe i s;(0 2xrxo3iu1aptn fei tfsDtau p;o4tpeoioeiadlm2ean onu4texrifctotfaD  nes s0srxr(m3oo4ome lnvia(faDrm( o;u0tpxnioctlsfsDrmnvs;t)arxrmf3tytomtr u i;( t2uoim iu1lpt mnvia( arrmx  nt4tet  ietlt aDulu o;u) etomr3oydfp   ueo;t0 eur(rpiu1om  livt t  2tmxrpnu1ope  o3iasfa2rmums;t4altnioctadfa e uvils)teuoio3iy4oleemfci tfa2uax oot4alt  ociat a emuvo;u4trenxr iodomDeaieolt) 2xm(m3iy1ap  lieia()srrr( pou1alt micils aDulu o;t0aeeoxociadfm raivi;s0t2xoxm oy4lpt mncsa(f Dtauronu0aetomo3iadlmDranmo;u0trerif3totom r n o s)teumimpiy4lmt  ieta( artm(rpoo4tltnifcils m umuvo (4 rtnirciytlaDelnei;s  2uoim nydope  fetl( a2uaumo;t1olto f3tltla rauvpnt)aeenxfcoadlptelivi;s t2umim ou1lmenlieiasf 2taumooo1tlxo o3iatfs emuvo (0teermo3oytfptrlueslt)setrim iodom  livtl(f Dtmxrpno4alxnifeias aDulums t)alxoxf3ty1omt lnes;(0 etr(o3oo4lle  ict (f rtax p;o4tpe ii3iasfsDeanmp u0tetrio3tadfpD luei s  rxr(m3ou4lpee ivs tfsDra(mpot0alto iciad sDumuvp t4trenxo3todlmD ln ol(  exrim oo4lpt  fcs (f rtaxr ;t0oleo o3tat m2ra(vsnt0 lxrir3tatlmDeln o t) eum(m3iy4omtnmietatf rumxmono1tpxn f3iad sDrmnmonu) leoxf tatlm  aues t0s2tmim3nydlmtnmnesa( sruauro;u4apenif3tys mDua(msnu4 rxnio3oytla raies;t0truoxo ou4lm e net (f Drr(mp;t4tleoif3ilsfm2rmnmp;(0 renir3iy1lmt  ieo;t)texrimpnudolen neia()a2ua(mp;t1tpxn fciytfa uaumon() leoxo3iadfm rauvo t0teum(mpiudoltn ictls arumxr no4tpto ociysla2rmn s;t4texrif ty1omte neo;()trxo(o iodllt  ict s)arua(r ou0oleo ociatfm rlu o t0trerxrcty1la elnvolt0t2tr(opoydal n iesas sDurxm ot1tet mi3ilsls2ulumpn(0tlenmr tydlptelivol(0 2xriopiodapt mfesat s2trxmp;o0oleoiociat aDra( o u)treniociatlmD lueol(0srurim3ou4llee ivtasfsrtmx p;u4aex mietlslm2umn o (0tlerio oy1omDelu ol( sexoxm3iy1lme mieia( srtmu  ;t0oetnif3iyd a uau pnu)texnmf iytfmteli s;s sexrim3ny1alt mfviltfsDrmu p;u0aexnmo3iydfmDrl(vo t0aexoir io1fa eauei (0trtrim3nydlpen nvsltfs2uru poo0aex io3iatlm ea(msn(4 ltomo ty1lmD ai s (  etm(m io1opt licsls sruaum oo1tptniieiyt s eln o;(0 rxrxr3iodlmt  i s t0s2xr(o3ny4lp  liesa(farta( ooo0ole iicilslsDrmuvo;()arxnifctytlp  au olt t2urxr oo1lpe lnet t aDuau p;t4alt  o3tldfs elu o (0teerxr ty1lpDrlivi t0 2tmxrpoodalt  ict ( s2rau pno0alxoifetytlaDeanmp;(4tlxoxfcoa1oatr nes t) eum(m oo1lp  lfci (fs2rrumpou4ape  ocildlsDul(vpnu0texomf iodlatrau i;() rum(m3iodlme  nvs tf rum(mp;u1aetnmfeiytfm eanvs (4 etrxrcoytopDeluei;t0 2xo(o3no4am e icsltfartaur nt1oexomfciltfaDum( s u0texoxr3iotfa  ln s;t)s2ur(o nu1omte fcslt  rum(rpnt4aeeo iciys m elnvp;t4artomo tadopDr uei s)s2xm(o3nu4lm  livil(fa2uaurpno0tetn octadfs rl(vp;(4alxrmf3oatlatrauvilt0 rto(r io4ame lneias)artrx poo4oee ii3tlsls ul(vp;t0tlxrxr3oo1op e ivo ( texrio3oy1om e ivtlt srtauro;o4tleoifciasfm2emnmonu)tetomo3ta1fa e ieolt)srxriopnydlmtelnvs t)sDtmxmoou4oex ioeiysfmDelnvo t) lxnio3oa1oa  au ol( s2to(mpnodol nmfci ()artrx p;o0tpxomfctlsls2ulu pnu) lxoxo iatlaDr uvsl( setrxmpnydlme mnvi s srumu pnt4tleoioeiytfa2el(ms;() eerxr tydfmteaiei t  2xr(r ou4lm emicsa()aDtr( p;t1opeo o3iydlmDrluvont0alerxocoa1op r uvilt s2uoir no1amtn nvtatfaDurx o;u0aexnifctytfs2rl( pnu0 exnmf3iy1op r ivil(0 eumim ou4lleelfei tfsDtmx  ;o4apxo ociyslmDel(mp (4 etnxrcootomt lneo s srumxm3nydlme lfei sfsrtr( pno0tleoio3iatla2ua(ms t4 eeomo3iotfmD  n ils0 exrio3oo1apee fcias sDrmxmpnu1oleo o3iydlm ra( o t4 etomr3oatlate uvi;s  2tm(r nu4oleemfcsl(f Dur(rpoo0aeeoif3iatlm2emu snt)arxnif oadfm  anvil(  etr(r io1llt mfcsas  rua(  ou4apt  feiad m2rauvs u0aexnxr3iydfm elu i t)trxmxrpny1altelnvt tf 2uru pou0aptniieilt m2em(mp;t)altoir3iatfmDe n o;(0srtrxo ny1alenmfetlsfs2ra(mono0aptnii3tltlm2em(vo;()alxrxo oatom eaies ()t2toxm no1omen ieslt)a2ua(roou1tptnmi3tls mDea(vs;()artnir oy1lp eanvols0sexm(o3no1olt  nci () Dtrxronu0aexnifciytlm um(vp (4tltoio3oatoat lu o t0 exm(r3nydll nmncslt) 2rr(ro;u1opt mo3tlsfaDrmump (0texnif totomt ln sls  rtmio3oo4optelics ( sDtm( oot0oltn oeild m rlumpn() rxnmr to1omt  ivi;( t2uo(opiy4amte ivtlsfaDrr(  no4oleoiociyd s rln s t4tlxnxfcia1fpDe ueslt0setmxopiodom e neta(fsrrr(mo;o0opxn feiys a emuvo u)aetoxrciatfp rlies;t0s2uoxo io1apenliciat) Dtrxrpnu4oleoiieild a rlu p;u4arenxo oo1fmt  uvils) 2tm(m nu1apt  nesltf 2tmumooo1opt iociltlm ua(mo u) etnif3iatfa elnvs;s)setr(r3oudam  lfvia(fsDraur ;u0oeen feiytfm ea( o u)tlenmo3oo1op  ai s t) eur(rpoydom nlfeia( sDrr(m ;o0tpen ieiydlaDulnvs t) exrioctytom elieo t)texrxr3oydamt lietasfaDrm(r ;o1apeo f3iytfsDrmnvs;u)aeeoxo3iy1fa rai ols t2xm(rpio4lmt mfcs t)aDtmu pou4oex ioetasfs ean s;u4 eenxo oy1fmD auvs;t0s2um(m3iy1apenlfvtl()sDtmur nt4tetnifetltlaDran ont)trenif todopt aies;t s2tmxm iu4lle  nvsls  Drrxr ou1tpeo oetatfa elumont)artrmrctadfat ln i;s0sexmir iudapt mictltfaDurxrono1tex io3tydlm eanmp;(4 etoxo tatoa r nvo ()seurxm oo1lme mnviasfaDumumo;o1olxn feiyt a2rmnvo;t4tetrioctadfmD  i i;t)t2tm(r nudaltnmfctls s2rr(rpoo1tet  fctlsfsDeaump;u4tetnxo3tytfpD  n olt0srumir3io1ol e ictls artru  no1tleoifcias s2ra(vsnu0 etrxr oydop elivo s) exoiopny1lptemfetasfsDua(mo;t1opeoii3tysfsDuaumpnt0trtrmf oadoa eln sls t2xoim iydllt lnesas)srrr(rpno1olen oetatla2ulnmo u4trxoio3oydlaDe ues s0srurim iydopen fcta(f 2tmumpoo1ape ifetasfmDemump;t) eeoxr3todfp  luesls0 etr(opnu1lptelivs t  Dtm( p;u0apx  o3ilsfs2umnmo u0tltomrcoo1fpt lnvsl(0 2tr(m nodolee netl( arrruront1teeomoeild a2eauvpnu4artnif3todlmDelivolt)texmimpnu1lpeemiet () Duax  nu0ale  ieiadfm2rmuvs;t0alxrmr tadlmtranvs (0 exrxm io4lp   nei (fsrraxr ot1texo o3iasla uau on(0tlxomfctadfpDr u s t  2to(opiodomte nvilt)srraxr no4olxomi3iydfa ra( pnt4altrxr3ta1oat  n i;( teuoiopiodlmen fcil(fa2umu ont0oet mf3iytfmDrlumo;()alerio3io1lp   nvs;s)srxmimpiu1omt mivi s  Dumxmonu0oexnif3tasls el(ms;t)aetrxr3oytlmD lu i s  exr(o3oo1lle lnvt ()srtm(r ;u4olxoiocilt a2ran o t0 rerxo iodfaD lnvs s0t2xr(r3no4ap n ict s) rrr(mpoo1tptniieiat s ua( onu)arermf3tydla rlu ol( t2xoio oudapt mncilsfs2rmx p;t0olxoiociadlmDemu on(4teenir iatomtr iesls srur(r iodamtnmnciatfsDtrur oo4apeoif3iyd s rlnmsnu0 etoif iatoaDr iesls s2um(o iy4altnmieil()a2tmu p;t0apeo oetlt sDrau pn(0 reoxr3iatfpt anvilt0srtoxr3nydlpee nvsl( arurxmooo4alx if3ilt s ulu o t4 lxnmfcio1fmtr nvs s setm(m ny1om nlivt sfsDtaxm nu0ale mictydfs emu pnu0aleoxf3ty1fpt anes;(0t2tr(mpnydlmt mneilt) Drru p;u0opxoiicils s2ulnvont0 rtnxrcoo1lateluei;(  2uoxo3iydam  mies (  rrmx pno1ale if3iat mDul( s;t4altrif iydoateaivo;s)teurxmpnudopt mncil( sDurxm oo4opxnmoetls m2eaums;u4 renio tytlm e n o;s t2xoxo ny4omtnmieiltf Dumx o;o4oetnifciltla ea( p ()tlermr3iatop rauvs;() rtmxm oy4op elfci t)aDtm(mont1oltnmicilt s2em(vs ()trxnxo3ta1lpDe ivs ()t2xrxrpoudop emfeils) rrmuroou0oetomietldls2eaump u)aexnmr oa1opDe uvo;s0trxo(r3iodapte nviat s2tax  nt0oee mi3ilt m ea(vpnt0aetnmfciotfat an i;t  ruo(r iydlme liciat) Drr(rpot0tpe iieiysla eauvpnt4tltnxf todlpD aivo s s2xmxm nydlm n nesat srraurpou4tee  i3iytlaDum(mo ()artomr3oytom   uei;(0srtmxrpoodol elieslt) Durxr ;t0altoio3ildfs2umuvs;t4 rxniocoatoaDeluvi ()trxrirpiy1ol elivtlsfsrumumpou4texniieiaslm rau s t0teenmf3iadop elivs s  rxo(mpio1ll nlivsa( sDrm(m oo0texnmi3iasfm2ea(vo;t) etoxo oo1lptelues;s trur(m oodapte fvt t)artrxrooo1opt mfeiadls2rmuvs;t0trtrxocoa1lmD lu ils) rto(m nodaptn ictas srtrx onu0aetnmoeilt m2ra(mo;(0arxoif ty1fa  livi (  rtm(mpnodapeelnvs ()sruaxmoou4open ocias a ra(ms;()arxrmo3oy1fmteai il(0s2xrio3oudlm e fetas) 2uaumonu0oltn ociyd mDraumont4tlerxo oatoaD lnei;s trtmio3no4amtn fvil( sDum(  ou0oleo i3iasfa ul(vp () rxrmo ta1fptrlneilt0 rxo(o nudameelncs tf ruauro;t4optn o3ils s2rmn snu4artomoctatfaDe ieo;( s2xm(r3ou1omtnlfeilsfsrumxmo;t4aetoioeiytls ra( snu0aeerio3oytoatrlieo;s truoim3nu4ll n ncta(f Drru onu1tetomfcild s um( on(4aexomfctydoat aivslt  rumir3iydom n net t a2ururpoo0tlxn o3tat s2rluvo;()tleoxf3oodfpD  neilt0t2trir io1omen iet sfarraxrpoo0aexnii3iatlm eanvo;t0trxrxfcto1fa e iesl()teuriopou4olee fvsa()aDta(mont0aleoifetlt a2rmnmp;t)areomf3oadlm  liei s t2uoimpoo4lmtemnct (f ruaxrp;u1tltoii3ias m em( p;() reoxocoadlmt  uvilt0seumimpiudapee fcslt artm( ono0aex ifciydlm2ulu s;t)arxrxrctytfpte u o s0s2toio iu1al  miet t a2rrurpou4oee mo3tyslm2uanms u)arenmr3ootlp ranei;s0srxm(opoo1om e nct sf 2uaumpnt0tet ifeiad mDeau p;u0aeenmf oytlm r ueslt0 eum(r3oydamtnlicia()sDrax oou0ape mo3iadfmDea(mpnt4 eeoxocty1omt luvi;( tetrxm oy4am  lfci () ruax onu4olen o3tyt sDea(von()tlenxoctydoatrli i t srtoiopiu1om  lictls  2rmx  ot1tpe mi3ilt aDum( o;(0tlxrircoy1fatr nvsl() etoxm3io1lle lfci tf 2uax  ot4oee mi3tatlaDrmn pnu0trerir iytoa elnei s)srumxopno1ol nlnciat s2tm(  nt1tee ifciltls2elums;t4alxoif3io1fm r uvo ( trtm(rpio1lme lnvta() Dur(rpnu0aet  f3tldfmDel(msnu4arxoirciy1omtr u s;s setoxo nodolenlivia(fsrumxmoot1ope mo3tydfm2ulnvp;(4alerxrciydoptraies;t seurir iu1amte icias) Dta(m oo1oltniicilt m2ranvp;t) ltrmf3iodlmD  nvols)seuoxm nydal   nciltfs2urur ;o4oltoioeiatfsDrl( s u0 lxnmr oy1oaD au ils) 2trio3iu1ll   ncta( a2rm(m ;o1olxn ieiadfmDranmp;u4tltrir iodlm raivi s seumirpou1aptnmncs tfa2umx ono0tlx ioetlsla ea(vpnu0trenxo ootopt au o ( trtmim io1om nlieils srtaur nt0tlt  f3ildla2rmn pnt)altoxocootopte ueolt0 eumio3ny1olt lfet t  rrmx  ot1tpto fetldfs2ul(vonu0 renmr3iy1lpt  ues;(0tetrxr3ou4amtnmivi (faDrmumooo1tpenioctat s2ulumo (0 eeoxf3io1laDe ieslt tetoxm3nu1om  mici tfaDtrurooo1alxomi3iyslmDrm( pnt)texomrcoadfaDranvsls)s2xm(mpio1amee nesls)a2ra(root4olen ociadlaDrmnvs u)alenifcio1fmt luvs ( srtrio iudam  mnct t srra(r ;t0aeenmoetlsla uau s;(0tlenmf oo1oaDrlneils)t2umxrpno1ol elfct t)sDurum ;o0apeoii3tasfm2um( sn(0texomo oadlmt  i ilt)srurxo3nudop n ivtat  Dumxm no4teenmiciydfm rlums u4tlerxrciatfaD  uvi (0seur(r3oudlmeemfvsa()arta(rooo0apxo fetlsls2umnvp (0 ltnxoctadla eaueils teuoxmpoodlptemfeia() 2rm(mooo0aleomi3tadlmDean s (4 exrxr3oodlmDr nvil()texmio3ny4ope mivi sf rtm( poo0ope mictlsfmDuan onu0 rxoxo3tadlm   uei;()texoiopou4op emfcilsfs2raur nu1ole moctatfs2ulnvpnu4 rtoxr3tadlpt  nesls  etoimpoudlltnmfcsa( a2uax o;t0aleoiicilslsDra( s u0 rtrxfctotla r nvs;t s2uoiopoy4lp  lnvi s)s2umxm ot1openif3tltlmDum(vs;(0 eenmf3iotopt li s (0t2uoxr3ny1ol e fetls  2taxroou4ope iictyd a2rm( p t4 renir3tadlaD  i o s)teto(m nu4al e nvia( sDtauro;t0tlxnmiciys sDra(vonu)trxnio3oydlp rlivs t)s2um(rpoo1omt mict tfs2rm(m ot1oeen o3taslmDem(mo;u4teenxocty1fm e ivsl(0sexoim nu4ap  mnvsls srrr(mont4aetoio3iyt sDuan s;(0alxrmrcta1omDeaues ()s2tmxo iudlpt  fes () Drmx poo1teen f3iytfm2emuvsn()texnxr3ty1fat  n s;t0 rtrir3ny4ll elnvil(fsrumumoot1tlx mfeiatfm ulnvo;u)arxrmocia1fa r neol() 2tm(mpou4lm  licsl(f rra(ront4alx  iciasfaDeanvo;u0arenir tytop rlu s;s t2uo(mpiodoltnlncia() 2ta(mpoo4tle  octydlsDelnvsnt) rtrxrcto1lateli i;( tetmio3oo1olee ivsat)s2ua(mono4alx mf3iydlaDem(mp u4arermo3tydfp e nei;s0texmxo3oo1ope lfci s) 2ta(monu1apxn f3iaslaDul(vs (0alxrirctatlpteli s;t)srxrxr oy4llenmncsas)aDta(mo;t4oee  feiyd m2umnvon() lenir3ta1faDe n i;(0 etr(opnu1ome  ivsa() 2ua(moot4tee  i3tasfa2rmump u0alxrio3oodfat  ivsl(  2xmimpou4alte ies s a2tru onu4opxomf3tlslm rlnvp u0texrxf3ty1laD  nvi;s  etrim ny1ole mfeta( srumump;o1opt mi3ild m2emuvpnt4artrxr3tadlptran s (  exrxrpiy1am e neilsf rtrxro;u0oltoif3ilslmDrmump (4aexnxfcio1oatr u ils texmxmpio1op nmnesas)sDrrxmp;u4opt mociltlsDem(vs;u)aetnxrctodlpD aies;(  euo(r3iu4ll   ietlt)a2taxmpno0tpeomietlsfa2rlnmpn(0arerif iytlmDeauvs;t0tetmxm3iy4olt mnvtas aDtaurpnu0tex  oetas sDrmnms;u4aetnircto1fat an s;s0srxoxmpnu1ame mfetas a2ur( p;u0apxnmoeiydfsDuluvont) exnmf iytfa   ueo s0s2ur(opiydaptnmictatfaDra(mpnu1alen i3tasls uln sn(0texoxoctotlm r nvi;s0srxrio3oo1ol  mfet (fa2rmumo;u4aee ioeiltlm2rmnmo;()altrmo3oadfm eau s s trum(o3no4lptelnei tfaDuaxr ;u0olt  ieiytlsDemn pn(0tetrmr iytlm eluei t)srto(mpiy1omtn ivs t  rtmxm no1opx  fetldfmDraumpnt0arenmoctatlm  lneilt0 etrxm iy1amenlics s)aDtmxm ;t0open f3tyd sDulu p (0 etoxrcoatfpDr n o;t0sexr(m oy1lp elnctlt)s2rax o;t4texo oeiys m rauvonu4 ltnifciadfa   uvs;(  eur(m3oy4omte ivtl() rur(m ot4alxo icilslmDrl( p;(0 ltrifcoy1op eln i;s)trxrxmpiudap emnvslt)sruax  nt4tptoifctadfs em( o t)aeenmr3oodomt auvol( srto(mpoy1am  mivtas) Drr(rpou1oeto fctldfaDelu p (0altoxociatlmD aivo t s2urxrpio4ap nmfcs ( a2rax  ;u4oetn i3ilsfs2umuvo;t4 rtnir3oy1lmtean s ( t2xmxr3iy1oleemnvsls artaxmono1texoiieiatlm2elnvp u)aetrifcoatfm eln il(0texoxm oy4op emivtatfa2ra(mpnt1oet ioeils aDemn p;(0 eermo3io1oatrlu ils) rtr(rpno4omenmnvsls) Drr(  ;o0opeo f3tldfs ua( s;(4aeeoir3ia1lm e uvs;s0srurimpiu1ole mnvi t sDrm(r ou4tpt mf3tls s2rmn s (4 lxomf3todfmtran ilt0setrxopoydamt lfct () ruaxro;u1alx if3tatfs eauvsnt4tetoxf3iytfmte nvols)t2uo(opnydaltn fei tfartrumo;t0tlxniietatls rl(msnu0aetoxo ootfm  aieilt0t2ur(r iu1lp nmiesl( a2tmx o;t4aex  oetyt sDumu p t4teenxo tydlaDelnei;(0srumiopiy1lp elietl( s2tau ono1oeto fetyslaDra(mpnu0arenmo oydop eau o;s)seuo(opnodlm nlnvs (faDrrurpnt1oee mo3iyd a2elnvp;t) exnxo3todoa rluvs;s)setr(r3iu4al nlfvsasf rrm(r ;o0olxoif3iatfaDumu o (0 etnif3oytomteanvs;s t2trio no4lmeemfvt s aDur(mo;o4oetn ieiadlm ea(vsnu0aeeoxf3oo1lm e nvslt)trur(rpoy1ap  mnetls  ruru oou1opt moeiat a2uaumpn()artrmf3oydfpt lueol( s2ur(opiy4lpe lneiat)sDtm( p;u0opxoiieiltlmDul(vp t0teermf3iytfmtrauvils  rumxo iu1olenmnvilt) Dumxmp;o1alx  ocias mDrlnmont4 rtoio3iy1fmt li sls) etoxmpoydamt mnctlt)srtmu  ;o0aetoii3iytfa umn o t0aexrxo3tydlm rlnei;s  rur(r3nu1optnmictlt srra( p;t4alx iociys s2rm(vo t)alxomfctydoa  ln i s)texoir io4ale mivsa( sDta(mono1apeoii3ilt m2elnvp (4aetrifctydopt  ivs;( srtr(r3iydaptemneta( sDra( pot1tpxo o3iytfsDrmnmo t)aexnir3tadfmDe uvo;s0srto(r iy1optnmivta(  2rrx onu0aexomf3tatfmDean p (4 rerxociatlpt  i s s) 2uo(m3iodlp nmics s  rtmu pnu1alxo iciysfaDuanmp ()tlxnioctytfpDeauei;( srxmirpoydal elfes sfsrtmxrp;t1aptnmociat mDeaums (4 reoif ta1faD  u o (0 etoio iy1aptnmneia() 2raumo;o0tpxo f3iatlmDra(mo;() rtrxo ootlpDeluvi;t0s2toxopoy4ll nmict (fa2ur( ooo1olt moctltlsDuauvs;t)arenmr3oodfmt auvols0 rxoirpoydole lneiat)sDum( o;u0open ociltlm elumsnt)tetnmf3tatop  lies;s  rumir3nydomeemfvtl( aDrmxmonu0altoifeias m ra( s;()aetnio3to1fmtraivo t  rum(opnodom   net tfsruax pno4opx mo3tyd m2eaumpnu0arxnmf iadoaD  n o (0trtoio oydap n nvta()sDumu o;u0apxomoeiltlaDuluvo;t0 etomr io1fpte ivslt)s2tmir3oo4olt mietasfarumxm nt4olxo ieiltla ra( on(4trenir3io1fa r ueilt0 exr(mpnudalenlnvi s) rumu  ;u4apx  f3iytla2rlnvs u4tlenmf3iydoaDeaieilt seuo(opiodolee ict t aDrmur oo1tptoifciadfm2ulnvo ()tlermoctodlmDrln o t) exmxr oo1apt mnesat) rrrx pnt1tleoiieiadlsDel(mo t0texnifciydopDelueilt  eumxm iu1alte iet ( arrrxm ;u4olxnmicils m2elu p t0 eeoxociydfmt aivi;s sexoio3nodlp nmnei t) rum(mo;t1tetomi3iad sDemnvs;(4tetomo iodfpteanei;( texr(rpiodlleelnvsltf Dtmx oou1texo ieias s rl(mont)arenif3tatop  lneils)trumxrpoo4optnlnesasfs2umum ot1oetn f3iydfmDrmuvont4tetnir3todom   uvsl(0t2trxo3io4omte nvils)s2tmxr ot4aex  o3ias a elnmonu0 eermo oytop e ues;t)t2tmxo3oy1amenlictls)s2taxr nt1tleoii3tldlm umuvo;(0tetrifctatoa  lu i;s) 2urxr3iu1oltnmiet s sDtm(r ;u0altn o3iatfaDem(mp;(0 etoio ia1lp eli ol()s2xm(r3iodol nmncslsfs2urur ;t0apto fciydfa2umnmp;t)teeoio iadopte n i;(  etrio3ou1ll emics t srur(mpou0ale iocilsfs um( onu4trxoxr3ia1lm r nei t)t2tmio iy1llenmnvta(fa2tau pnu1tpxn i3iasls2eanmo;(4arxnmf io1omD  ueilt  rumirpnodol n ics s)a2tmuro;o0aexoii3tltlmDuluvo;t0tlxrxociydfp raneil(0 rxrxopoy1lltnmfvsas srtr(m ou4olxn ieild s ranmsn(0trtnxr tatfm ranei;t  eurxr3oudllt mneslt) rumx poo0tetoiociyt m2ua(vs;t0treomr3tydoaDeaivslt  2tm(r3nu1altemfcils)s2tmuront0ope  fciltlaDul( pnu4trenxfcoa1oaDrlues;t0 rumxo3no1lm e ietl(f rraum ;o4tpen ieiys mDul( p;(0alxrio totfmDraieo t0 2umir iu1amtemnet tfa2ua(roou4oleo fciytlsDuauvp () ltomfctodopte ieo s)t2tmirpiodlmeelnvilt s2uax pou0aptn ieiasfm ranmonu4tetnmr to1lpDe u ol(0 eurxrpio1omtnlneta(  2rau  ;o0oet iiciadlm2ulnmpnt0trxnif3oo1om rluvo;s)t2to(mpiudapt  neslsfaDtrum ot4optnmf3iaslm2raums () etoxf3ia1lm eli i;() euoim oo4lpeemfes t) 2ururonu0oltniiciaslsDrlump;u0teeriociadfa e ivslt)t2urimpio1ope  ivi s)sDumu ono4altoif3ilt a2emnmo;t4 rxnif ia1lpt anes (0s2uriopoydole  icta(  Draumono0alt iietadlm rm(mo (4aexrxfctodlptr neo;t)srtmirpiodlp  livsl(f Dtaum no0aeeomf3iytfmDuaumo u)tlxrif iadfatrlnei;t0 2uo(m3oo4lltn ietat)srtaurpno1apxo fciad a umu o;t4alxrirctotfmt luvilt0trto(o iydop e ivtlt a2tmxr ot0tpe  o3iltfm uln ont)trtrif oa1fmt lnvs ( seuo(o3iydal   ncsa() rtax ooo0apt mo3iasls2eau s;t4aetnifcoa1fmDrlivs;(0texmim iydlmtnmivsat sDra(  ;u4tpt ifeiysfa em( snt4teeomo totlm rlu olt srtoim io4aptnlneia()aDtmur nu1texnifcilsfa2elnvp;(0trxomr ta1op eluei t)t2umiopny1omt mnvi ()arrmurp;u1aetn fciasfm ea(ms;u4arxrxr3oatomtrlies;s)trtmir iu4al e netls)s2uaxrpou1opxoiocils s2rlnmsn()artnir iotfptelnesl( srur(rpno4altnmfetlsfa2uaxr nu4oee iociytfs2emn o t)arxoxrciytlm r u o;() 2xrxrpoo1ap e iciasf 2rmxm ;u0ape  ietys m2emn o u0tetnxr to1lm   n ilt  etrxr3oy4om e iesl() 2uaxm nu0oee mictyt a2el(vpnu)tlxniocio1fmDrau i s  2xm(m oy4am nmncsa(fa2tm(  nt1altnmictas s ulnms;t0 lxoxf todfat liei;s)trurimpoodlp  livtat) Durxmp;o1apeoioeiltfsDra( s;u4 exoif3tytfat  i s s  rurimpny4opt mfcia()srtau oot1ole  f3tadlaDem( s t)trxoirciatop elueo s s2uoimpnu4lpen fci s)aDtrx p;o1tex if3ildfsDean s ()trtnio oydfmDe u s;t) 2toxr iodalenmnci tfarrru o;u0tetniictatfmDrluvpn(0 rtomf ia1fpD  ues;() 2um(o3ou1alt lnetat s2urur nu0tpenmiciltfaDel(vo;(0tlxrir3iodlpDeln il(0 euoio iu1lmtelnvi tfa2urx pot1tptoiociltfaDraump u)aetomrcoytlmD aueolt0srxmxo3iu1olen icta() rtrump;o1aeto fciasfsDranvpnu)trxrxrcia1opt livs (0 rto(m3iydopte ivt tfaDtm(rp;o4tptnmf3tys m2rln p;u)alenir3ootlpt  ivo s s2xoxm nu1aleemiet s)artmx  oo0olx mf3iatla2uau p u0 etoifcoo1omD luvo ()trto(r iydap eliet s)a2umumooo0alx ifciytfa2rlnms u)arxoxociatomteluvs;t) etm(r oo1lp nmfvsls)a2uaum ou0alxnio3tldfa rmn pnu)arermfcoa1lp e neo;t)trtoxo ou4amen iesl(f Durxrpnt4oleo oetadfa2rauvpnt0tetrif3ty1latelnvs (0 etmiopno4lmt  nvta() rua(mpot4aleo f3iytfa raumo t0aetnmo tydlpt aivo;() euoim iu4ol  mncs (farraum ;u1oexnmfcilt m2rmnvs;() lxoxr3iydoaD anvol(  etoim oodllt  fvi t)sruru  ;o1tet  fctltfa raumpnu4arxnxf iatlp raivo s  ruoxr3io4lm nlnvtatf 2um( onu4tet  fciyd sDrau s;u0tltrxf tytfmD ai o;(0srum(m3iydol elfesltfarrmx ooo0tee  feias s2rmnvp u)artniocio1lmDraiei ()trtr(rpiu1lm elfvslsfaDrm(ro;t1tpxomoeiasla ulnvo;u) renxr3iy1lmDelieolt  rxm(o3iy1lpe lictl(f rtr(mo;t0olxnifciadfsDua(ms u) exnir3oy1lpteau o ()s2xmio ny4al  mnei (f 2uru  nt1apeoifeiltls rln on(0altrio ta1oaD lueo t) 2xoimpoo4lptnlfcsat a2tmxr no4openio3tatfsDrmnmo (4teenxr iotlmte nvo t srxoir3no1amt mivils a2urxro;o4teeoifciasfs2eluvs;t4trermoctotlptr u i;(0 2xo(o iydlmee ivi s aDur( oot1tlt ii3tyslm2umump;u0trenmf3oodfa e ues;t0t2umxrpiydllt mnci tf Dururoou4olen ocildfaDem(mo;(4 rxoxo3iatfpteauvilt srtmxm3oy4ape mfcilt)srtruro;t4tetomietls m rl(mpnt4teerircoytfaDean sl( seumim3ny4ll  mncs tfsDrm(r ;t4apxomo3tydls uanvo t)aexrmr tydlpDr u ols)s2tmio3iy4am  mics (fs2uaxr ot0olen ieiat sDuan p;t4 ltrif3oadoa elivils  rumxr oy4olee ncils s2raxmont4teeniiciasls2rm( s;u0tltoxo3oa1optraivil(  eumxo3ny4apenmivsls) 2rax pnt4oleo fetldfm2ul(vp;t) exrmr3iotoa ean s;(0 2toxopiy4lpe lfvsltfsrur(rp;u1aex iieiadlmDulnmo u0 exnmociydlmD  uvi t truo(m3oodop nmicta(  rrr(rooo0opt mo3tat a rm(mp;() etoxo3iatlptr ivs s sexmxo3no1apt mivtltfaDraxrp;t1aeenmf3tyd s2uanvp t0trxrxo tadlaDe ivi t)sexmir iy1aptelieias  ruax pot0aeenifeiytfs2elnms (0 rtrxo ia1oat aueols) euoim io4olenlncslt)artrxmonu0tleomi3ils a ua( o u)tlxrxf to1omDrlnvi;t) 2uo(r io4oltemnetlsfsrtaurp;t1aexoifciytfaDum( o u)aetoio ootla rli s s) rxr(m io1lpeemfvs t  2umu  nu0tpxo o3tasfs2em( pn(0treomf io1op   neilt0 rxmio nu4al elnetl(fa2raxr ;o0aeeoiieiydfa2em(vp;u)artrxo3ootlp eanvo ( tetoim oo4omtelfeiat  rrax pnt1oeeomiciat mDrl( o (4 etrxf3ta1la  lieil( texmir3iu1olen iet s)s2ta(  no0tptoio3tat sDrlnvo;u4alxnmrciatfa elnes;t)teuoxrpoodamenmiesa()srurx oou4tee  f3iasfs2ra(mp;(4 etnxr tatoaDr ivslt0sexo(m3iydlm e neilt) Dtaumpnt0olx mi3ias a2uan o;u4 leoxrcoo1omt livilt0 etoxmpou1lltn fei s)srurumpno4optoiicias sDrlnvo;t4tlenxociydop e ieo;s) 2uoio iodlptelivil()arrrxm ot0aleomo3ildfa2ulnmp t) eeoifcoytopD lieslt srurxm ou4oleelivi (fa2urx oot4tlx  ieild sDelnvo u4 rtomf3ia1op ran s;()s2toio iu4am  mivil(faDrruro;u4altniictydla2emn pn(4trxomo ta1oat aivi;s)tetr(m3ny1lpee netls sDraur no4altnif3iyt s ranms;t0trxoio oo1fm  anei t t2xr(o iy1lpeemicilsf rtru ono0aexnmi3ildla ra(vo;t0tetnmo to1lp rli i () etoxopoodolee ncta() 2rrurpnt4oltniieilslm rlu o;t0trtnmr3iy1la raivs t)s2xmxo oo1lmenmictl(faruaum ou0oet  fcils sDra(mp ()texnifcoa1om e u ol() 2xrxm3no1amtnmnciatf rtrx pnu0oex moeiydla rmuvo;t)trtrxfcoodomt anvol(0 rxo(r ny1lp n ivtat srtaxmo;t1tex mfciyslmDrm(vs (4 rxoxr tatfmDrln slt  2umir oo4al nlfei (farrau  ou0tlen f3iydfmDuluvsnt4 leoxrciadoaD au i;(0 2tmim ou1lm nmnvsl(fa2rmum nt1tpeo fciyd a2ulums ()artnio oydfm e ivsls)seuoxr3nydame lfcilt a2uau  oo0aeenmictys aDrlnmp () eeomf3todlp e ivs t)tetoimpny1aleelncta(  rua(monu1alxnmociatfs el( s t0 lenxrctadlaD  nvolt)trtr(opiudlle lnviat) 2umu pot4tpen octasfsDrmn o;u4tlenifcoo1lptr u o;t) 2to(o no1lpte nct s) Dtaumpno1aptn feildfa2ra(msnu4trxnmocoytfmteluvs;( t2uo(o3oy1lme lnetas a2rruro;t0tpt ifetaslm2rmu pnu4trxrir oatoa  lneolt  etm(o ou4oltelncs t) 2rrxm ;o1tlen ieiltlsDeanvp;(0trtoifcoadopt  n i;t)setmxrpiu1lpen nvilt)a2uaum ou1texnmfciyd a ua(vsnu4trermr3io1lp  aneolt s2xrim3oudlmeelics ( srrmu poo0tpe  f3ils a2ranmo (4 rxrxr iatfp  aneolt0 2tm(o oy4op e nvilt a2taxrpoo1tltn fetydfsDrauvs (4 leoifciadoaDe nvo;s srtoxo3iu4omt lnct sfa2rr( ono0apxn ietas s2ua(ms;t4texoio3totoa rlnvils t2xrio oy4oleemnvi sf ruaumpot0oexnioeiasfs2umu o (4alermr tatom   ieo ( srurimpny1omt lncilt  Dtr(m ;o0tlxoif3iat m2umumsn(0tlxnmo3oydoaDr nvs;t0srxoio3ou4amtn ici () Durumont1apxnmo3tldlmDrmnmp;t4 renmr3oadlm rlueo;(0 etmxr iu1omte ivia()aDtrum no0oexnmi3iltfs ua( o (4altrio iytomtelnvo t0tetoxmpiu1alte ieia(faDra(mono0altomfcildfm rlu pnu4aleoif oo1opDelu s;( s2urxr iy1alen fesl( arrmumonu0tpe if3ils aDeanvo;u0tleomf3oatoptrln o ()setoim nudlpt  ivil( sDumur oo1aet  ietltfs2um(mont)trtrxrctotlm  au o s srurxm3iydop nmfvi sfs2trurooo4apen feiadfm rmnmo;u)alenxrcoy1oatrlieolt0s2xo(rpoo4llen nesl()sDuaxmp;u0altomf3tas sDuanmo t)tlerif3oydop  lu ilt) rtr(m iodlmee ivsl() rtmum ;u4olx ifciasfm2rlums;()altnmr io1lpDrlieol( texrim io4open fcsat) rurx p;t1aex ii3ias m um(mp (4aetrmf3ia1fpteai sl( trtoir iydop   ict t) Drmum ;t1ale mociytfs2ran pn(0trerxr3todlmtelneslt seum(mpnydaleelietatfsDuax  nt0openio3tysfaDea( pnt)trtriociodlmteaues s0s2trir3ou1omtnmivsa()aDrau pno1tetomf3tls s ul(von() lxomocoodom rau i t)tetmir3nodlm nlivs t) Duaur ;o0openiocildfaDuau s t)alxoifcia1op e ieo s)t2tr(mpno4amte ivsat  rrm(moou1ape  ociydfa2ulums t)tetoirciydlpteau o (0 2xmxo3iy4op elfeilt)s2uaum ;t4tlt mf3iyd m rmu p;t0 reoircoodfa  auei s  2umxm3iudape mneiatf 2tmur ;o1oexnmfetaslaDum(vs (4altomf3to1oaDr nvi;s0sexoio iudam elieiatf rtm( pnu4tlt ifciytlsDuanmp t)alermf oydfmt ln sl(0trtmxr3oo4op elivias  2tmu  ;o1teeoifciys s2rm(vp;t4tltriociy1lpt auvi;t0sruoir oy1lm  micia(farua(ro;t1tlt  icilt a2ul( s u0treoif3iatoa rlivo t)teuoxm3iu1am n ieslt)sDum(rpnt4apeniieiydlmDrauvs;(4 eeoif tydop rli i;t  etmxr3ny4llee nvs t)aDur(m oo1texn o3iadlm rlnvp;t) exoxocta1lm rliei;t setmxo oy1amenmfes ()arumxr ;o1aet mieiadfa em(mo t0tetoxfciotfpD an i;t0 exm(r oy4lmt lfet ()aDtm(mpno4tpto i3tytlmDel(mo ()trxrir3tytfpteai sl(0 etrim no1ll emneta() ruru o;t4tltnmf3iytlm ra(vp;t)aetoxo ty1fm   nvol(  rxoimpiudoptelfeslt)a2uaumpnt0aptniietytla2ul(vo;u)aetrio3ia1fmt  i s ()setm(m ny4lp elicsltfaDrrxmont1apx  ociyt a2uanmsn(0 rtomfcoy1fmtelivil(0t2xoxm3nu4lm e nvsa() rua(m nt4tltn o3iysls2el(ms () eeoxfcoodlm  ln s;(0 eum(r oydoltn icsl( a2tmxr oo1opx iictltlsDrmump t4 exomr3iytla r u ol(0sexmxr3ou1omtnlnctlt)arra(r ;t4texomoetyt sDra( p u4teeoirctotlpD lneolt  rumxo ou1ale  fetls sDrmxm nu0apx  ieias s2uanms;()tlxoirctatoptelieslt seurio ou1omee fvtltf Dur(rpnt1tlenioeiydla2rlnvpnt0alerio oytfpDrli ols0setmio oudom  miet () rra(mo;u1tlxomfeiat s2ea(mp u0arerxr iotomte ies;s0 2xr(r iu1oltemiet s)sDur(ronu0teenio3ilt a ul(vo;(4aexrmo io1oateaneo t0 exrirpny1ole lfciat)aDtaurooo0apxnmi3ildlaDum(vs;() exrmf totfm eau o;t)trxmxo oudop nmivt s s2urx o;o1texn i3iyt m rl(ms;u) lxomrcoo1fmteluvolt  exmxo3oy4ope miciltf rtmump;u0tpeoioeiatfa2emumsnu)tltnio3iydoptrai s;(0 eumxo3oudamtelnetatfs2rm(  nt1oetnioctys m rm(mpnu4 exoir3oo1la raivil( setr(o3ou4ap  mnesl() Duru p;u1opeoiocils a2rlnvp;(4trtomfcio1fp   i s;s0 2xo(m3nydam e ieta(f 2rmxmoot0opeo feiad sDuau p;()trerifcoydfmDelnvo;(0trumimpno1ap emict s)sDum( pou1alxnifcildls rm(vo;()aeermociadlat  n olt0truo(rpoo1am e iviasfa2um(m ot1opto i3iys s2uln s;(0tlenio3totoatrlnes;t  rur(r nodal n nesl()aDtmx  oo1oexnmoetls s2umu o t0 etrxocta1fate uvo;t0s2tr(opiu1lp  lfcsl()aDtaxrp;o1oetoiiciydfa2ranvs;u) rxnmo3oy1opDrln ils  rtrir ny1ame miet ()srtrurono4tlxnmf3tad a umnvsnu) renxo iytfatr n i t texoio ny1am elfeils aDum(  nt0apeomi3ias aDrlnmo t4 eeoxo iatoa r ues s0srtm(m iu4olt mfei s)artmx p;u1tet iieiltfs uaums t0 ltoio tytoa elnesl(0 etmim3iodameemncsas a2umx p;t0teeo oeiat s rauvon(4tltrir3ta1opt  n s t t2tmio nu1ap emnvsas)srum(ronu4opt mi3tasfsDra( o t4 rtnxf3iy1fm rln s;s) 2xoiopoy1al nmfvsas)srumxrooo0tlt mo3tltlmDrau o;u)altomf3oytfa eauvilt) etrir3nu1lltnmfctatfs2rax ooo0tpeo oeiydlm2rm(mp u4texoxrctatfmDeluvs;()teum(mpno4ape mfes tfa2rax oot0tltniieiltfm rlu s t4aeeoxrctatfptelu i;t0 etrxr oydop   fesa( aDumxronu0oex mietytlaDuan p;()trtnmo oadomtrluvilt)t2xoxrpno4am   ieiatf 2urxm oo0apeomf3iatls2rm(mo () ltnmo tytlpte uvi;()trxoirpoydom n ncias)srtru oot0tptn i3iyslm rmn s;()aexnif3iy1lpt aueo (0sexmxm3nodaltnmici () 2tauro;u4alx  fetld m ua(vs u0 eenmr3iydfmteai ils0s2xrxm3nodlmt  nci s)a2taxm no4open ociadfm2uauvsnt0 eermf oo1fpt  iei;(0 2xmxm3nu1lpeemfes sf rtaxr no0oee  i3tld s ean o;(4aeeoif3tydlp e ies t0sexoir iu4olt  nviatfsrur(m ;o1oee iociad m eauvsnt4alxomf oytlat aiei;(0truoio3iy1optnmfetat) rtrx  nt1apx moeiadfm2ulumo t4trtrmf3ty1om  ai i;() rxrxm3oy1am   fetas  rtmxm ;u4ole mociyt m emnmpnu0areoif3oatop e neo s t2xrimpoy4ll emiesl(fs2umx pnu0optnio3iys m2emuvp u4 renio3oy1omt luvolt)seuoxrpiydame mfvils sDtr( pou4ale ioetlsls uln o;(4tetrxfctadomtrlneolt) 2xoxopnu4ol emnet s s2rmx pnt1tptnifciasfm2rlnvs;(4tltomr3iy1lmD lu ols0 euoxrpoo4lm elfci (f rrmumo;t4optn fctydfa2uauvo;u4 rtnmfcoo1om e u sls  rum(opou1lpeemieia( arum(m ;o0tee if3ildfa2rlnvp;(0 rxnio todlpDranvsl(0srtrimpiodllenlfcs (  ruaur oo1tptnmfciatfsDulnms t) leoxo3to1fm  aneo t)s2toirpou1lp  mnei s) rtrxro;o1olxnmf3tytfsDua( sn(0 rxrmo tytlmt  ivols)trum(r3oo4alt mnetat  rraur ;t1ole ioctlsls ranmsnt)artoxfcio1opteln s;(0trumio nudamt lfcias) rraxrp;o4oltoifciysls2em( s;t)alerifcoa1oa rlnvo t trtm(r3no1amtn fvsat aDumum ou1texnmfeiysla2rmums u0 reomf3oytlaDr u s;t teuoxo3nydllenmfci (f Dra(m ot4opxnii3iadfm ea( p;() leomrcia1lptrau o t s2tmio no4lpt lnctls)aDrr(r ;u4aeenmf3iysfaDumnvo t) ltrio iatopteauei (  2tm(m nu4om   fes t  2rm(ro;u4ale ii3tytlmDrlnmpnt)arxrmf io1om   nvs t sexoimpnudopeemfes t) Dtr( pot1tptoiietytfaDrmu pnu0aexnxf3oy1om ranvo;s) 2to(o3nu4llenlnesasf rtaumo;t0tpenifciadfs2ul( pnt) eeriocoy1opDeau o t)texm(o nu4lp  mivil( arta( poo4aeeo fciadla2uluvpnu)treoxf oatopDrlu ilt t2xmxo iudoptnmnct tfs2ur( p;t4teen fciytla2rm(vs;u4alxrif iotoa  lnei;t0 exoir3oudom  micsa(f rrm(mpnu1tpt if3tytfs2rl(vsnu4tlxoio3tatlmtelnvsls)seuo(m3iydlltnmivilt  Dumumpou0tltomfeildfaDrau s t4tlxnmo3oadfptelneo;(  etmir3ou4alt  iesls) 2rmum oo4alenmo3iadfaDran s;u4tlxrifciadfaDrauvi t)s2um(o ny4open ieslt sDtrxm no1tee mi3iaslm ua(vs u0tlenmocoo1opDrlnvo s srtmxm iy4ol eliet t) 2tm( pno1apeoiiciyslm ea(msnt0tlenmf oytoatelivi ()setrxopoy1om  mfvslt)a2tax o;t0tex ioctltfs rauvs ()teenmf to1la eaueolt)s2umiopiu1apenmfvtls)s2rm(mpnt0tptomieiyd m2rmuvp;t0tlenif3totopD luvi s0s2to(opno4lpeelfvslsfsrtrurp;t1oeeomiciyslmDumums u)aexoxociotlateai i t  exoim3ou1ll nlfcsatfsrtm(ro;u4alx ii3tatfaDeanmp;u4 etrirctydla rau ils sexo(m3oo1olte iesltfsDur( pnt4apenmo3tydfs uanmsnu) exrxf oa1omtrlu o s)seumio iu4lmtn ivsls) rrr( p;t1oeto ietlsfs2ul(mont0areomf3oy1fm eauvi t0seumxo3iy4amt licilt)aDrruroot4tlxoioetas m2umnmo;u)aexrmo3ta1fpD  neilt t2urxo nodap nlnctls  Dtrx o;t1tetnioctys a eanmo u)trtoxfcoatlmt lues;t)srumio3io4amee fesl(farraur ou1alt  fetys s2el( p;t0arxomrciotfp e neo (  rtoxo ou1al nmnesltfartrurp;o4tpenmfeiltfa elums;u0tetnxr3oodlp elnesls0 2xriopiu4lmtn ivtas)aDuru onu4olto fetad aDrm(mp;(0texrif iadlate n o;t0 2umxm iodlpt mncs s a2tmuro;u0texomiciasfs2emu s;t4aeeomf3tydfmD  uvs;t)s2xo(o oy4openmietat sDrru oot1oexniieiltla umu snu)trxoir3tytfpDe neo ()trum(m nydaltnlfvi t  2rrurono4tpenioetys mDumnmo;u)alxrifcio1fp r i ils0trtoim no4lpte netls) 2ur(mp;t4oleomfetld s ran onu0teeniocty1lm r uvilt0srtr(o ny1apt  feta( sDtru  ot4oex  feiysfs2ra(mo t)artoio oadla eaiei t0s2toxm oo1om n nviat srra( pnt0apx  f3tysla eanmpn(0alxrmo oadopt lieolt0srxrxm oy1al nlfctasfaDra( pot1tlenmo3iytlaDuanvs;t)arxoif3tatfmDe ieo;t  2umxo no1al emietlt)aDuaum ot1aet ifciytlaDrluvo u0tltoxfcoytom  aivs t0s2tr(r3nodome miet sfaDtau  ;t1opx mo3ilsfm el(vp u4 exrxociodfm rluesl( t2ur(opou1ll  micilt) Dra(r nu4tptnmoeiadfa2ranmo;t4 exnirciytfm raues;s0sexrimpoy1om elicia(  Draurp;t0tltnifeiaslm2rm(mpn(4 eeoif oodop eli i;t0 eur(m3oy1olee nvs t) 2raxront0apxn ocilt a2emu p t0trermr oydfpDelneil(0 etoimpnu4olt mfvtlt  2rm(rooo1aetnii3tytlmDul(mp u) rtrxo oodomDean o;t)sexr(r3oy4ale mfetat  2ururpoo0tpx  ieiadfm ea(vp t)alxrxf3ootop ran s;s) rumxrpnydam e ivtlt)a2trxm nu1aeto o3tld aDuanms;(4alxrifcootopDr uvi;( texm(opiydlp  lieslsfsrtaurpoo1oetoiociasla2ra(mp u0artnmfciodlpD auesl(0 2ur(o io1apenlici t  Dururonu0oleo ieildfm2rm(mpnu)tlxrxo tatoaDe uesls trxmxr iy4ole lfciltfarrax pot0texnmoeildls ua(vsnu0aeeoifciotoate ivolt0setoxm no1op elfvsl( sDtr( o;u4alt iieils a2ua( o;t0 renmo3io1fptrlues;s srxm(m3oodame  ici () 2taur nu4alxomi3tltla2em(ms;u0trerirciadfpDeln i t0sexmimpoy1al emfet t)aDum(  ou1aeeo fciadfm2rmu pnt) ltrif tatomDr n ols0trxm(o3iudlleelfeilt  rraxmpoo1olx  ictyt m2el( s;()trenir ta1fa r u sls t2xmxr iudlmen iesl()aDurumo;u0opeomf3iatla2ua(vo u) renmfcoy1lpDranvsl()trxmir iy1opt mieiat artaxmo;t4teeo oeiysfs ranvs;()arenxociytlpteaneol() exm(m3nu4lmtelivsa(  2rm(m ot4olen ociytfsDel( snt4 exoxf ta1fmtr ivils)s2uoio3nu1ll nlncs s)aDuau o;u0tetnifeiasfmDraums u)tlxrio3tadfp elueils)s2trir3nodllen neta(f Drrxront1tptomoeiydlsDrmu p;()teermocta1omDe ivo;(0 eto(opiydlmee iesl() Dra( oou4tpeoioeild a2eaumo;u4alermf io1lmD  n i t  exrir nu1omt livt s srua( ooo1open f3ildlaDrmnms;()altoxr3tydfmD livi ()texoxopnodalenlncs t)arrmu  oo0tpe  i3tlt sDra( o u4trerir3tadoateanvs t s2uo(m oudam e nctas srurumo;o0tpx  feilt mDemumpnu) eerxrcty1lpt livol(  2xmiopou1am elici t srur(m nt1oleo fcildlsDua(vp;(4teeomfcoatfpt luei;s srtrim ou4ole mnvsl(fsrumx ont1aexn oeilslm2elumonu0 ltnmf3ootop rau ilt  2xrxo no4om n ics s arrr(m no4oexomiciltfm2elnvp t4alerxo3oa1lmte nesl(  eumimpoy4lm nlictatfsDrruroou4oex ioetat a2el(ms;()aeerio io1opDr neo t0srtmxrpnudom elivtlsfsrua(m ;u4opx mociat mDumumonu)tetnxo iytomt  n s;(0seuoxo oodlm nlfcs (f ruaumo;t1oetn f3iyslmDul(ms;() exnxr oo1lm e ivi;()teurirpiu1lm   nvslt)aDtaxm ;o0oleo iciltla uaumpnt4teenxocoa1opDrlnei t t2toio oo1lltn fvi ()artrum nu0aetomociadfaDulnms u)alenxf iodopDe i o;t)t2um(m oydlltelicil(  2ur(ront1texomoeilsfs ran on(4 eeoiociotla  luvi (0s2xr(opnodomeemfcsltf rum(m nu1aexomieiytfa rmumo;(0altrio3tytfmteau s;s0 rtoxmpno1lmenlfesat sDta(mont4aeeo i3ild s2rlnms u4altoif oydfpD  uvolt teumio nodamtelicia( a2ua(ronu1apeniictltlm umuvo t) exoxo iadfa   nes t0t2xrxm oo1opt micilsf rua(rp;o0aptoif3iysfsDeauvo t4tltnmocoy1fa r nvo;(0trtrxm oo4ll elicia(fsrumx  no1oexo fcias mDel(mo;t) eeoif3iy1fpteli ilt0 euoir3iy1lmen neilsfs2rr( pnu0oltomo3iytfsDrm(vpn(0texrmr oo1lm rauei;s  rumiopnu1llt lies (  rumumoou1aex mieild m2rlu o;() exnxrcty1fat aivi;s0srxoxm3oodlmt mfvils  Draxrpno4altnifetld s ulnvon(0artrxocty1fptrli sls s2trxr oo4lmeemies tf Drm(mooo4tlt  feiltlaDraumo;(4 reoxo3oytfaDrlieo s  rxmimpiy1ale lncsa(f Dua(monu4opeo ieiltlm uan p;(0 lermf3to1fatraieo;t) exo(m3oudolee ivt t)s2tr(mo;u0opx  i3tasfaDemuvsnt0teenmoctatoateliei t0 exr(r no1llt lnesl(  2ur(r oo1tex  ociltfm2rauvsnu0aetrif oadfat luei s0 2trxo3oo1lpt lici ( a2tm(  oo1aee io3iltlm ra(vp;t4aexnio iadoa r ivols0setm(mpoodomenmietls)sDumur ou0aexo ieilt aDumumo;u4 etoxo oo1lptr ues;s0texoxo3io4lpeelnei s  2tmum ;o4tee mi3tys sDrm( o u)tltoir tytfpteau o;t) rtmimpiu1aleelnct () 2rrxm ot0alxoii3ild s umu p u4alxrxr todoptr ivslt0 rumio iu1al   ivi t srurumpou0tpto iciltfa2umnmo u)aexnxfcoa1optranvi t0t2xmxm3iydoltemfvsl()a2rmurpou1oee  fetatlm2rmnvs;u0arxoxr3iotoatrluvs s)t2xm(m3nudapee nct tfs2tau ont1altoiietlsfa ulnmp;u0alxoxf iodoaDeluvilt0teuoxrpoo4omt  fviat) rtr( p;o1apxn ocils m elumsnt0aetrxrcoydoat anvslt)t2to(mpnodlle  fet s) Duaur nu1tetniieiysfa ra(vsn() ltomfciatlpteanvols0sexrirpoy1lm n ivtas)a2rru ooo1tpen ieiytfsDrluvs ()texnxo3io1fmt  iei;s) 2toim3iu1ap elnciat  Drm(mpnt1apt ioetat a uan p () lxoir3oa1oatrluvslt srto(m nodome liei ()s2tr( pou1alxoii3ils sDumnmo;t0aetnmfciydoptraues;s) exrxm io1al nlneta(  Dua(  oo4tet mociltfa2emu o (4aexnmf3io1optr iei;s0sexrim3oy4lm   nei ()srrr(rono4ape mfctatfs2rlnms;t) rxnxfcia1laDelieil( srxoxm ny1omee icia( srur(ro;o0tpx  f3tytlm2umump;u)arxrif iydomD aneilt)t2xmxm3oodam e nvt t)srrm(rooo1oleo oetaslm2ua( o u)tltoiociadomD  u i t0 etr(rpnu4lm nmfetat) 2taxrpno0optnif3iltfaDemn s u0trxnmo3tytfatelieols0t2xo(mpno4llen icslsfaDum( pnt0aeeomoctadlm emnvo ()tleoir3ty1fa ean o;s0sruo(m oy1alenlnvsatf rrmxronu4aee mfeiadfs um( o ()altrio3tadop eaivi ( sexmio oy4altelivtlt sDtau  nu0apx  feiysfmDemumo t4tleoiociytfaD  iei ()trxrxopny4llen nes tf 2taurpno4olxnif3tyslsDrmnvon() rxomr3tytlpD  i ilt teumxopnu1am n ncsls)s2tr( o;t4apxn feilt s2umu p t4tltrifcoytoaDrlivi;t trxm(rpou1lp nmneiat  2ur( pou4teeomfeiatfaDumnmo (4texrmr oydfmDr i i;()trumxopno1lm nlfesls  rtr(mpot1opxomoetlslmDranvo;t4 lerirctotfat an o t trtr(o nodllte ncia(fsDtm(r oo1tpxnmociadfa uluvs;u)aleoxr oa1oaD  n s;s  eurirpno1apte ics s  Drru p;u0tlt io3tysfsDeluvp t4 etoir3tydfm  lu o (0s2umir3iu1aleemies (faDrm( ont4tle iietas aDelu onu4tleoxf ia1fa elieolt0tetr(o3oy1ol elnctls arumxm ;u4aet iietyd a2emuvs;t4tltnio to1lmteln slt  rxo(m iudol  lics (f Dtm(ro;t4aex iiciltfm ulnvs t4tltrmoctytfa eli i;(0seurxo iodlp nlfvs s)aDrrx o;t4tpt if3iasfm eanmp;t) rxnmfciadoa  auesl(0 exmiopiydlm  lncsatf Dtr(  nt1tlxoioetlsls2rln p t0 exoif iotom rlu slt)t2to(m3ny1lmenmivia(f 2rau  nu1oetomietlsfm em( p u0tetnmo iatom  auesl(0 2ur(o nu4ap emivsl()a2rmxroou4texnif3iaslm eau s t)arxomo3to1fmt ai i (0s2xrim3no1lm  lfvtat arrax  nt0aptnioetatls2el( o u4trxnmo3oydlateaivi;(  rxoiopoy4al   fei sfaDuauro;o4altnmietldls2uln onu4areoxo3ty1lpDeanvs (  rtm(rpiudoptemict sfa2umx  nu4openio3ild m umuvp;(4alxoir3tatlpt lnvo s t2tmim3oo1lme  nct ()s2rr(  nu1tet  ieiydfa2rm(ms;u) etrio3totlmDrlnes s0srxoxo3nodap   ncsltfartrx oou0aexo ociysfmDua(mpnt)tlxnxr3todlmDr i o;s) rumim3io4omeelivt t) rrm(m oo0olx  i3iydlsDeln s ()texnxr ta1oaD li i t)t2umim3iy4lm e nesl()srua( ono4tlenifeildlm2ran o (0 etoxo oadfa e ueo ( setrim3iu1apenmnciat)s2rru p;t0opt iictyt mDranmo;t0 lerxo oydfptean o t  2uriopoy4omt lfcsat)aDum(  ;o0olen o3tyt s2rm(mp;t4tetoxr3iodlm raneils srxrxo nudlm   fvi ()a2raxmp;o1teen i3iysla2umums;u)trtomo3oytfp raues s0 2urxo3nodol nmnvs t)a2tmur ;t4aptnif3tysfmDulump;(0aleoxr3iy1oat an s;s)t2umxr3nu4lpt  nciltf 2rmu onu1oleniociad aDrm(vp;u)arxnxf3iytoa e uvi s tetoxm3iy4amt  ieta() Dtmum nu1tlx moetas aDeau pnt4 lxoir iodlm rlueolt s2tm(r3no4olee ivta( sDrmxmoou0aex  i3ildlsDraums;t4 renircoytfptr ies t srxmir3oo4ame mncsls  2raurono4apxo o3tltla2ra(vs;t)trtrxo tydlaDe uei t trtoim3iudlm n ivil(fsDum(r oo4tptnmoeiltfa2eaump;(0trenmf3iatfmDraieils0trtmir3iydlmtelfetls a2ur(moot0aee  ictas s2eaumsnu4 ltoxo oatfa eaivs;s)srxoxr iu4am nmnesa(  rtax ooo4apx mieiyt s eanmpn()altnmr iodfpt lieol() 2uo(rpny4al elfvtasfs2tm(rp;o1tlt iietadlm2rlumpn(0 exnxr iatlmD livs;t0 rurim3nu1olt mieiatfs2ra(r no1alxn ociad m2el(vpn(4trermfcto1lmDean ils0srtmio ou4lme  nvsa()aDrm(rono0aleo feiat s emuvont)aleoio3ootfp e i s;s)srur(r3iodll emfciat  2ra( pot0tlxnio3tltlaDeanvs;t)texrircoa1fa r n s;t  eurir oydlmee icsls) Dumur nt1ole iociyt s2em(mpnu4altoir iadfpDraueols0setoxo iudop nmivsat)srtm( oot1tlxoio3iatfmDulnvon(4aexnmf todopDeli ilt s2toirpou4amtemnei tfartr(r nt1apx mociaslm2um(ms;u) ltomf ty1la eluvo;()t2xrxo iudole lfetl()sruaump;o1alxo feils mDulu p;t) lxoxr tatlmDr ieo () rtmxmpny4altemneiltfaDrr( oou1oee  fciatfs2rl( o;t0 reomo3oydfmDelieils)trtr(o3iudllt  nviat)a2tmxmont0tee  ieiltlsDelnmp;u)areomocta1fpteai i;s0trxoir3oo1al e neiasf Dururoou1aexomoeild m ra(ms;(4alxnxr io1fpt  ieo;(0 2umxm io4optemict sfsDrr(rpot1tlt moeilslsDrl(mo (0teermf ta1lp ran o s0sruoir iudlpe lncil() 2raur ;o4oeeoif3ildls2rauvpnu)artrmo3iy1lmDrluvil(  etr(r3oudopt mnei s)aDuru oou0oleniieiys sDranmpnu)tlxomrcoy1fmtrlnes ()tetmiopno1lltnmfvsas sDuaxro;o0apxomf3iltfsDuanvs;t0 exnmf oytop eln s;( t2umxm iodlltn nvt ()s2taxr ou4oex moetysfm eauvs (4tlenxr3to1oateauvol(  2xoxr3iudome lnvs ()srrrx  nt0teeniieiat s elnvsn(0 rxnxr3oytomteaies ( teum(opiy1altnmnvsasf 2trurpoo1apen ociysla2rmn pn()aexoxo3oadfm  li ols) rxr(opou4lm   fvt t  rtrxmooo4aeen f3iydfsDel( snt0trxrmocoadfmDelu o;( setoimpiu1ale lnetas)s2rrxmp;t4aetomi3iyd aDelu s;() rxrmo tatlpD luvo ( t2xo(opou1ome lnviat)a2urx  no0tptnifciatlaDel(mp;t)texrxr oatfp  aneilt0 2umim no4lme  fcsa()a2ra(m ou0tetn fcildfsDra( o;u)artnmf3oytoaDe iesls trxrxo3iy4ol   fetlt s2rrx  nt1tet io3iydls um(vs;()texnmf3oa1lpt anvils) euriopnu1lp nmfes (  Drmur oo1aptniietltfm2ra(vpnt0aetomrciadfa raies s0 ruo(o3iy4ale lfciatfarrmxrp;t1tltn fciadla ulnmon()arerio3iy1laDrauvs;(0srxm(o oy1llenlnvs ()a2ua( ont0tptoii3ilsfm ra(vp;u) eenxr oydom r ivils)s2toxrpnu4llte ictlt srtrxmont0tlx miciltla rln o t4texnxf3tydop  aivs;t)sexr(r3iy1lp  lfvt ( a2ta( ont1tpen fciad sDumump t)tltomr iodfm   ivol(0srxoiopoo1lltemfci t)srtmu oot1tet iociasfa2uan o u)alermf oo1lmDeauvslt srtoiopiu4lm   fcilt  rur(root4apeoiiciaslsDemumpnu)arxrircoatoptranvslt0sexmir oy1olen fvia()s2raxr oo4olxo fcildfa emuvp;() rerxoctodlp   uvs ()t2urxr oodlpenlivils a2raurpnt1alxoioeiatla rlums;(0areoif iy1fat lnvils trtoxrpoydlm  licsas arrmxr nu1tpxn f3tld sDrm( pnt)altoifcoodlaD  ies;t) 2tmxopoudomtelicias srtrxmooo0olxomieiasla rmums;t0 ltnmf3oodlpDe neo;( t2umim3oudop  mncia()aDrrxm no1opxn ictad m2rln p;(0trxoxr3iatoaDelu sls0srtmir3iu4lpt lfcs (f Dtm(  ;o0aex mieias m ra(mon(0arxnxr3iytomDrai i (0trto(mpou4ameemivs tfsDtm(m ou4aex ioeiyd mDul(mp t)tetrio oy1fmt lieol()s2toxr3oydoltnlieslsfs2ra(m no1oetnmoeiatlm2em( snt4tlxnmf iotfm ranvilt)srtmim oo4omee fetat sDra(rono1ale mo3ias a2uauvo;u4arxomr tytla eluvo;s  2tr(o3nudape mivsat  Draxrono0opeoifctasla emnmp;t)aexnxrciatfaDean slt) euoim ny1ol  mfvtas) Durxr no1olenio3iadla rl( s t0tetnxo3ootopDeli o;t trxmxm oo1ole  fctl(faDraxrpno1altomoctlsfa eauvo;()treoir todopDranei s0t2tm(m3no4ape  ncs (fsrtaump;u0tpe  f3iat s2rmumo;u0alxrio3iadfp rauvi;s s2tr(m3oudlpt  feil(fartr(mpoo4tetniociydfm2rln ont4alxoio oytfat luvo;s)setr(m io4ap  mfvsls)a2tmx  ;t0tetnio3tls m2uanmpn(0aetrxfciy1optrlu i;( s2xo(r iudopt mivslsfa2ta(rooo0texomfciad a2rmuvpnt0 leoiociodfaDe nes;s0srurxm3oydomtn ies s  Duaur ;u1altoioeils s2rmn o u4 ltomo oadoptrlivo;t  exo(mpny4om  lnetl(  ruauro;u1aleomoeiltlmDrl( o t0tltnmr iytlm  luvsl(0s2xm(o3nu1lleelneslsfarua( pnu0tlxn fetlslmDuauvont0texnxf oo1lateaues;t  eurxo ou1lp  mnvi s arum(  ot4texnif3ild sDelu pn(0tetrir oo1omDrln olt  2umxo io1lp   fcia( srurxmonu1tlt mfciyt m2uau s;u4 rtrmf3oydom r i i t  2tmir3io1op emnvsasfs2rr(m no4oltomi3ilsfsDeanmp t4aexrmf3oodfaDr uvilt)srurxr iydlp  mncs () rumx poo0oex mfciydfmDelu p ()texoxf ootomt ln i;() 2toirpny1amenmfcs s a2uauront0alxo fciasfmDem(ms;() rtrmf3oadfp eai slt t2xmxm3oy1op nmfct t srrrum nu4olenmf3tltfa2ranmpn() exnmo tydom eln o;t0s2xoiopiy4lme livt () rrmur ;o4optnmf3tasfa eanvs;t) leoxf iydom  li i () 2toir nudome  fetls)arrrxr ;t4tptoifciys a2uaums;u4 rtrxocto1lm e neol(0srumxo oudamtelncslt) Duaur oo4texo icildls elumo;t)alxrxrcoydfa e i ils0seumio ny1ap elfvtls)a2taxr oo4tlt ioetadfsDemnmon(4 ltrxr3oy1fpDeau slt t2uo(r oodlle  ivtl( aDtmum nu1ale moeilsls2elnvp;() etnif3tytfat aivsl( trxrxm oodapte fei s  2raumonu4oetomi3tad m2rmnmp u)texnir ta1fp e neo (0sexrxr3nydlme  fcta( a2umxr ot1aleo i3tltfs2elu p;t0 eenmrciatopt  ueo;(0 rtmxo3nudamenmfvsl(f 2uaxmp;o1teto feilsfa ea( p;(0alerxfcoa1oat lnvsl() ruo(m3nodoleelfcs () 2ta(mooo1aeeo fctadfa ulu p u0aleoxo3oa1fateaueols) rurxm iy1am elfesa( s2tmu oou1olxomfetyslaDeanvs u)artnmo3ty1oaD aies;( t2xriopou1optemnvs tfsDurx onu0aptn i3iat s ulnvs;t4teenxr iytop raieo;s)s2urir3nodll emies ( artrum oo1tlxomoetydfsDrmn o t0trxrmrcio1fmtr ieo (  2xr(rpiodamtn fvil() rrmxr no4aptn fetyd s ulnvp () lxrir ty1fat lneo () rtoimpoo4olee fvia(fsruaxro;o0alt iieils mDelumpnu0areoir3tytoaD luei s  rxrxm ny1optnmici s)srua( pou4tet micilslmDelnvs;(4 lxoxocoadlateln ils)seuo(r3oydol e iei s a2rrumonu0opxnmiciatlsDea( pn(0tetnmo3iytopDelieol()t2xoir3nu4llte ics t)s2rmxro;t1tpxomiciatfmDrl( o;t) ltrmf ootfatr u slt)s2uoimpno4am eliciasf 2ra(rpnt4opeoii3tysfm2ran s (0tltnxr3iytlmDeaies;t) rxo(m nodlltnlfcslt)aDrr(roou0tpenii3ils a rm(mpnt4tlxrxocto1fatrluvilt)s2uoir oudamte ics (fsDrru pnt1oltoiicias s rm(vsn(4trtrio oodlatelueo t0 rurimpny4lp nmivt t)sDua( pot4olenmfcias sDelu p;(4teenmo3iydlat  u o s0srxmxopnudlpt  ieils  2rm(  no1oeenmo3iltfa ran snu0teerif3iy1latr i o s)sexm(r ny1aleemnct (fa2rr(mo;u1oexnmi3ilslm ulnmsn(4aeenif3ia1laDr n s ( s2uoxr io1lpenlnctl() Drrum ;o4oeeomocild a2umnms;u4 ltomocio1omDrau o;(  exoxm iudll nlicsa(fsrrmu pnu0tpen fctyd m rl( pn(0tetomfcia1lmDelu i ( srxo(o oo4ll n fvtls) 2umxro;u1tltnmiciyd s2elnms;u4aleoirctydfa rlnvols0srto(r3nudlpenlfet s sDua(moou4opx  fetysfs umn pn(4tleoxf oodopt aneols) rto(o3iu1optnlfci ( aDtmurpou1opeo i3tatfm2ranmp;u4arxomo oadoaDeai s ()sexoxopny1ameelivtlt) rtru  ou4oeenii3tasfmDumn o;u) eeoircootoa  livs t0 exrirpoydlpe  fesa( s2rmxrpot1tpxomoctlsls uanmo;()tltrmfciadlm eaneil()trtm(mpou1lpeelnct t)s2trur oo1olx mi3iatfm2emu on(0 ltoxf todfp  lues s t2xoim ou1ap n nvslt)s2rmxmpot4oeeomfctlsfs2rlnmsnu4teeoxocoadomD luvi;s0tetrio nydlmeemfesl( sDtrx oot4alxo fetat a2umuvp;() etomo oa1fm   nvi;(0s2tr(o3iu1opee ivtlt)artmxrpoo0texn ociatlm elnvo;(0trtomf3tytlaDelu s;t  2xm(rpiudolt liet t  Duaumpou1oexnmfcildla2rlnmsnt)arenir oytlaD au s;( trxoxo3ou4lptn ivtatfs2rmxm ot4tptnioeiytlm2em( s;t) reoif3to1laD lnei t)teto(r io4om  mivtat) Dtrx o;t0olt  f3ilsfs2eauvs () etrxo3tytoa rlnvol( texr(o ny1lm  liei (  Drau  ;u4tlxo octlt a2rmnvp;t)texrir3tydlm  lueo s t2ur(m3iy4amtnmnvia(f rrrxr ;u4aetnioeiltls umnvp;() rtomrciy1laDr neslt0seum(rpnydll e nesatfsrtmx o;u1aeen icilslaDum(mp;(0 rerxo iatlmtran olt)sexoiopiu4ame mnctasfsruax  ;u4olt mieiyt aDuaumont) lxnif todoa  livi s0 2umxopoodole  iei t)sDrm(mo;u4oeeo o3tadls rlnmo;t0altnmr3iotlpt  i sl()t2umxmpnu4opeemfcslt)srraxroou1alxo feiasla2uaums u)tlerxoctadlmDraueil()tetoim iu4llen ies ( srtmx  ;u4ape mieiat sDeanvp;t0tleomo tydlpt aivi t0srtrim oo4ll n fet sfaDtaxr ;t1olt iietydfa2uanvo (4trxrxocoo1op eaivi;s trxmir3iy1ame lnes (f 2ur(mpot1oeeo o3ild aDranms t) lenmf totlpte neols) rur(rpou1op emfesltf rumu o;t1aeeniociadlaDumn o u0 ltrmrctodoatrluvo;( s2urxrpny4omee ieia(faDtrumooo4tleo i3ildlsDua(msnt0 lxoxocty1lp rlnvols0 2xoim3no4lmt lnes sfaDrax o;t1aptoiictatfm elumo t0alenio3oadfpDrlies;s) exrxmpnydlmtemnvs s)sDtmuro;u1oleo ociys aDemu pn()areoxr iy1lat  uei;(0teurxrpoodll nmfvia(f Dtrurono1aetoio3iyslm2ul(mo;u4tlerif ta1latraivils)s2tm(rpoo4altn fei (f Dtrumo;t0oetnmoetatfsDrmums u4 etrir3tatoatran o;s)trtr(m3oo4al  mict s) Drm(r ;o4alenmociaslmDrl(msn()areoxf3totop rlu ols)s2tmxr3oy1lleemivsas aDtrum oo1aeeomf3ilt sDea( p t0 etomrctydom  livi;(0setr(o oo4lmte ncsls)srrm( o;t1aptnioeiydfs2rm( p;u0trenxf3iy1lmDe n i;t)t2tr(opoo4lp  mivtls)a2uau oou1opto ociatlmDrau ont)aetrif io1fpD aneo;(0s2ur(mpiu4optelfci t aDua(mpnt1tpe mocilt a eau s (0teenxf3tydlmte nesls  2uo(r3oo1olt mneia( artr(m ;t4oex mo3tas mDulnms;u4aexoir tatoa  aivsls0s2trxrpoy4lltnlfesa( aDtm(rpnu1olxnmfciatfmDuan sn()trtnmf iadla eau il( s2ur(rpoo4aptemiesatfa2tax poo0ole mfeiasla ea(mo u)tlxoxocoytfpt ai i;s0seuo(mpoudlpt  fei ( srrrurp;t1alx mf3iat s2rluvp (0 leoxr3todfatraivilt) rtoir iu1lmtemfeils aDrr(m ;t1aexnmictasls2emums;u4artomo3iodfp eau s;s t2uoimpiu1lm  mieilt  rtau pno1alxniiciytla2ea(vpnu0 eerir iytfaDe u i t truoxrpou4lme mnvia( a2tr( pot1apt mf3iat mDea(vpn(4 etnmo todlptran o;s0 ruo(o3iu4lleemivslt) Drr( onu1alxomoetadlm elnmpnu4trxrmf3oadfpDrlieilt)t2xoiopno4am   ncs t) Dtmum no0apen ietydlm2rmnmo t4trtnxf iy1lmDr nvsl(0trumio oo4amtnlfviltf rtau pno1tle  octltfa2eanvpn(0texrmrcty1fpD  ivs;t0setmio oy4ap  mictl(fs2uaxmono4oexo oetatfm2emnmsn() exoircoatfp r n o t seum(rpny1omee fcil( artmum ou4oltomociatfs2rlumsnu0teenmr oytopt  nvi () rxrxo oodole  fvtls  Dra(rpnt4olx  i3iydlsDrln p;u0 ltrxfcta1lmDe ivsl()t2triopiu4ol nmieslsfaDtaxrp;u1olt moetytlm2umn ont4 exnmr oy1oa  au i ( s2tmxm3ou4amtemictl(fsrrmuroot0oee  oeilsfm2um( onu4aeenirctydop r ueilt)s2to(mpoy1alenlfei s)a2tr(  ou0tptomfciytla2ra( snt4aeeniociytop   u o;t  rumxo iu4apee nvs (f 2uau pou0tetnmoetadla umn p t4 rtoio3totfm  luesl() rtmxo ou4lltemicia(fa2umxmp;u0teeniiciaslsDrlnvsn(4 rxrif oadop  anvs;()t2trio iydamtelivtltfs2um(r ;o4tlt iictytla2eluvp;t0artoif3oo1lpt luvs;( trurio ny4alen fcs ()s2ta(mo;t4oltoif3tydfa emuvs;(4tetoxr3oytlmte i o;t  2xrir3oo4openmnvsls s2umx  oo1aet ii3tatla2eanmp;u4arxomf3totlm eanvi;()sexrio3nudlltemfetas  rrr(r no1aeenii3iytlm uan pn()aexoxocoo1laDe u s s0sexrxrpny1ope mivtasfa2uaur ;u1oee io3iat a2um(ms t)aeenmf3iadfpDean s t)sexmxm3io4lm   feiasfarua( oou0alen ociad s rl( o;()trxnxrciy1lmtr uvi;s0 2urim3ny4olt livt sfaDrmx ooo1opx  i3ilslm2ul( o t)aleoio tatfpDr neils0 eur(r oydlm n feilt)srrm(mpno4tltomieiytfs2uau o t0texnmo iydlatr u s ()tetmim3iodap e nctl(  Drrx ooo0tetnmf3iytlm2um(mp;u)trxnircoydomD lnvols0sruoir iy4am  mnei (fs2tau p;t1oltomo3iyt s umuvo;u0arxrif3todlpDrlu s t  eurimpoy4ol nlivs tfaDra( pnu1oeenmiciysfm eanmp (0aetoxf3totoaD lieolt t2tm(o3iu1lme mnvi s)sDurur ;u4apt if3iysfm2ulumsnu)tleoircia1fatr n o;( srxmir ny1apt licilt) rtauroot1opxoiociydla uau o (0tlxniociy1fptrli o;s trxmxr oy1amee fetlsf rtm(ronu1olxo octatlaDuaums t) reoir3ootlm eluvolt  etoxopoy1ap e neilt)aDrr(r oo0oetoii3tydfa ean ont0texoxo tatfpt  uvo;s  euoxopny1optnmfeia(fsDtaumpoo4ope mieiyslaDeauvs;t0 lxoxr3oydfatr ivo;(0sruoimpno4lltnmnei sf Drr( p;u0tleoiociat sDumnms ()alenmrctatopDeaivs t srumxr3ou1lpeemfvi s aDtaum no4tpxoii3tls mDrlumsn(0 lxrir3iydomDrluvs;s0trtoir no1lpeemncsas) 2urumonu1olt if3tydfa2uanmpn(4aexnmo iatfmte ivo ( s2toir3io1lptn fcsltfa2rmx  ou1apt iietyd a2elnvon(4tltrmf io1laD lnei s)trtrimpiy4ap  mfvil(fsrumxm oo1tlx  ictldlsDulu o;u0trtoio3tytom   ivilt0 2ur(mpno1al   fvsa( s2rr(mono1tlx mi3iysfsDrauvp u0 rtoir3oadopDraivols  2umxr3nodlp nliciasfarumxm no1optniicilslmDulnmon(4alenxociytfmD lues;(  rxoir3ny1lme mfcil() 2urxro;o4apxnmoeiaslmDua( s;u0trxomo ia1opDe uvolt teto(mpnodlme mies t) rur( p;t0alxoiieiadls emnmo;t0teermo iatfpDeaieil()sruoxr iy1ll nlnetas) 2rru  no4apenmieiltfsDea(mo;t)aexnmfcoa1lpDrauvs s t2umirpiudoptnlnciat  Drrxrpno4tex  ieiat s emuvon()altomf3to1oat au s;(0t2to(r iy1lmenmnei (fa2rmxmpot4alen o3ildlsDulnvs t0aexrxf3oo1lp eauei;( s2uoxm ny4opeelietlt)s2rau pno4altn o3tas a rl( s;t) eerirciy1faDr nvolt setrxmpoo1al nlictasfsruaur ;t1aex mfetytla rl(vo;(0trxnxo3oodfa   uvs ()s2trxrpio4ol e ietl() Draurono1aex ii3tls mDemu pn() ltrmr iadlmDr ueo;s s2tr(r oo4opte fvtltf 2tmum ou4openii3iydfaDea( snt0arxnio tydfatelivi t0 etoxr3oydaltemfes s aDurxro;o4oex  oeiat m um(mp u0 lerxf3ia1opDelies s)srtmir3ny1op  lncslt)s2umu  ou4aptnioetltfs rl(mo u0arerxocty1om  livi s  2uoxo3ny1amenlncia(  rrrxrpoo1oeenifciytfs2eauvpnt4aeenmr iy1fp   uvi t0trto(r3io4amenlnciasfaDur(rp;t0texomf3iaslmDuau o u) rtnmrcta1oatrli o;t) ruo(o ny1oleemivsl(f 2rmx pnt4tleoiieiat a umnvp;(4 lxrxoctotlat  uei s t2trir iy1altnlfcil( a2trx  nu0apx  fcils m2eau p t4 rtomr oydlp raues t0seum(m3ny1am n icsa()arraxrooo0tptoifcilslaDrlnvs ()aetrmfciatfa rliesl(  rxoxopno1alenlncs t  Dur(mp;o1tlxn feiltls el( p (4 exnirctydfa eluvi t)seum(o3oo4lmte nvtas)arrmumo;t1tpxomieiyt m um(vs;()aexnxocty1op eluvil() 2xo(o3iy4ol  mneiasfs2taumo;o1oleoii3iadls2ulnvp (4 etnmfctodoa eli i ()t2uoio oudlmte ics (fsrrmuroot0oet  ociyslmDea(vo t4arenxf3iytomt luvolt)t2tm(o oo4amtnmfct ()artaumoou4olxomictlt m emnvp;u)altrxo3oatfa rau s s s2xmio3oo4aptnmicsat)a2rrump;u1ope ifeiat m rmnvs t4 exrmr3iodlmt anei s)seumxm3io4lp nmicsl( a2umurooo1oetnmfcias s uauvs;(4aetrmocootfp elu s;( tetr(r3iodlm nmneil( srtm(mont4olenii3iatfaDul(vs;(4aexrmr3oy1lpDranvslt)t2um(rpnodoltemfvtas)srumxroot0alxn ietlslsDum(mp t0alxrmrcoo1omD livi () etmxr3oy1lmt lietas) 2urxmpnt4teenmociat s2rlu o;u)altomf ia1lpD  uvo ( s2umir oy1op elfctl()a2tm(m ou1tpxnmfctyt s um( s;()tetoir3io1fm e uvs;s0 2uo(opiu4oleemiesas)aDuru  ;u4tpxn oetatls um(mpn(0 eerio3oatfmteauvol( teuoio3nydomt  ivt ( aDtmu p;u0oetnifetytlm ra(vonu0trxrxrcio1fa  lnvo;t0t2xmir iu1ll e fetl()s2urum ou1texn fctat a2rlnmp;(0tltnxfciadfmD livi;(0s2urxr no1alte fct ()arraurpot1oee iicild s2ulumo;u) exrmfcootomte u s;s0srurxm3io1amte nvtl(fsDrr(rooo1tet mf3ias mDranvont0areoxr tadla eaivs;s) exr(o3nodlme mfcilt  ruaxmpoo4tpxoio3tasla2ra(vs;(0teenxf3oo1omD  n ol()texmxmpou4lmeelies tfaDta(m ou1alt iieilslsDrlumo t) renxo tatlpD an ol( s2xoirpiu1om  mietl( aDtau ono1ope iictlslaDul(ms t) ltnmr tytlat lneol(0setmiopoo4lme mfciat)sDuau oou4olen oetyt s2uan o t0aeerxf3todfa   ueo;t0 2tmxm no4lmen neiat) Drmxmo;u4teeomocildfmDelnvs u4arxrir3iadla  lnvo (0texoio io1olt  netl(f Draxmono4oexn i3iasls ul(vo ()aetnircta1fmD  n slt  2umxr3iy4altelnctl(faDrrxr nu1oet mo3iltlmDel( o (0altrif tadomDrauvs;s0sexrxr3nu4am nmivs (  Dtmxmp;t0tpe mieias sDrlnvs ()trtnxocia1opD lu i;() 2trxm3nydaltn fesl( srrm( pou0alenii3tld mDeaump t0treomo todfp e neo ( s2tmir3iy1lpe lieia(faDtmumont0aexo i3iytfm umumsnu0treoircoydlate u ol()t2trxr oo1llen nvil(farrm(  ;o1aeenmf3tys a2rlump;u) eermr3totfpDrlueo (0s2trxr3iu1om   fcta(f 2trx ono0aex moeiyd s2rmnvs;u0 eerio3oytomDelivo t)t2ur(rpoo4lle mnct ( sDurum ;t4tlto feias m rauvp;t0tltomo tydfptraies s s2xoxo3ny4ll nmnes ()artaurp;t0oexnif3tysfsDua(vo t0 ltnir iodomt an ols)seuoxm iudapeelncs t)aDur( pnu1tpx  octysls2ea(mo u4trxnmo oatomtelu sl(0teurxopiydapt lictasfaDuax  ;u4olen ieiatls uanvonu4 exrxo iy1omt au ol(  rur(o oy4alenmfvia( s2ua(r ;t1tpeomieiltfs2ra( o u)alenmf3oy1lm e ivs t) euoimpnudale livt ( arrmumono0aex  f3ildfsDuan on(0trxrxf3ta1lateau s (0s2trxopny1lltemiei s)aDtau o;o0olt iicilslm2ea( o t)teenifcoytlm  aivi t t2xo(o iydapt mnvtas)arurum oo1alto ociysla ea( p;t4artrif3oytlptr neo t t2ur(mpiy4alenlnctls)aDtax poo4tee ioeiadlsDua(msnu0arenxrctytfp  au s (0 2xoxm3oy1oltemfviat arumxm nt4apt mo3iat a2ul( s u) eermo oa1oaDraivi;t0t2trxr3oy4al  lfet t a2tm( pou1apxo f3iys a2uanmpnu0areomr3ia1omD ln i;t0t2uo(r oo4lmtnlieilt)s2urxmp;u4tpeoif3iys m rlnvpnt4 rxnir3oatfpDelieo s0t2to(m3nydllenmfes t)arrm(rpot4oleomocildla rln p (4tlxnxo3todlat auvs;()s2uoim3nu1ll elfei sfa2tax p;t0teenmoetatla2rmumpnt0aetnmr iy1opteaivils0trtm(rpiu1lpenlivi t)arrrxront0tlt  ociysla2emu s u4teeomrcoodoaDelies (0 etmim iydomtemfeta( s2tau p;o1oexomocilsfs2rl(mo t) exrmf3tadfaDr ueo;s)texm(o3nu1lpe mnvi (  Duaur ;u1oexoiietatlmDulu ont) rxrmf iadlp eli ilt  rtr(r3iy1om elivil()srua( p;u4aexnmoetadlaDelnvon() rxrxf3tadoaDeauvil(  ruoiopio4am emnesltf rta(m ou0alxo ictatla2emnms;u0 leomocoytlm  aiei;(  etmir3ny4oltelfvta()s2rru  ;u0olx iiciltfmDel( p u) rtoir3oatopt aivo (0srur(opny1al nlneia()sDuaur nt0tet micildfm2rmumont0tltomf iy1oate i ol(0trto(m nu4al emict tfsruaum ot1opx io3tyt m umnvsnt) lxoxfcto1omD lnei (  ruo(mpoodome  ncs tfsDrax ont4ole  oeiltfmDel(vs;t0trerif3iy1lateauvi ( s2trxm3ou1alte feia( aDtmumpou1tlx mi3ilsls emu p (0 eeomr tydlptraieo ( t2xrxo oy1omtnlnct s arumxrpot0alen octyt m2umumpnt)tlxrxo iytlp  aivols)srxmir oy4om emfet ()sDtru pnu1tpx  ictaslm2uauvo;(0 exrir3tatfat  ivil() 2xrim iu1ol emnvtatfarraxrpot1tleoifetlslm2rl( p (0aeenir3iodom  anvi s) etoxm ny4lptnlfesatfsDumu  oo4tptomieiyd s2ua( pnu)altnxo oa1omtraieols  etmir3no1lm  mnvtl(fa2rmxront1tltomfeiydlaDem(vpn(4 rtnmo3iadoaDeaieo;t0sexo(mpiudolte net (  ruaumoot4oetnmf3iytfs2ranmp (0trenxf3iatoaD  iei;t)s2trxrpnu1apte feilt)sDurxmoot0opto feiatfs2ea(vonu4tleoxo3tydfmDe neo t0 etm(mpnu4lle  iesl(fa2umxrpnu0tlx iieilt m rmuvp;(0 lxrxrcoatoaDelu i;t0 2to(m3oodolen feslsf rua(r oo4aex ifeiadfs2ul(vs;(0tlxnio iytop rauvo;(0 rxoirpou4lpt lfct t)a2tmx ooo4tpxnmf3tadfa2ul( snu)tltrif oo1lpDrlnesls)t2xr(o no1lme lnvt (  2um(ro;u4tleomiciyslaDea(ms (0aeerxf3tatfmtr iei t0 2urir ny4lptn fvtl(fa2tm(  ;o1olen iciasla2ul(vs (4trxomf3oatfpD aneo;s seuoxopny1omtn iesa(  Draxmo;u0oexo i3iysfs umnvo;u)aetnifcoo1opt  iei s) 2xrirpnudllee neia(fsDtm( pou1ape ioeildla uln on() rxnmf totfmtrli olt tetoio3iu1alenlivtlsfaDrrxmp;o0aptnif3ildls2umnmp t)aexrir tatlmt anvo;t)setrxrpnodomtemicsltfarur( pnt0oeeoii3ils aDuauvp t4 rtoxr oadom  an sl()srurxm3nodame micias a2raumpnu1opeoiieilslaDrau s t0 lxrxo3todfp ean i ()trurxopoudlmt  ieiasf rtax  ;t0texomietydla uanms u0aleoxf3tytfp e uvol()s2xr(opiodoptemnet tfa2umxm nu0tptomieiltlaDrmnmpnt4arermo to1lptelnvi t  exrxm3oo1amtelfctl( arra(rpoo4tpto iciltfs2emuvsnu4artnxf ootomte uvo t trtmxr3iu1aptemivsltfaDtru pnt4tlto oetatlmDua( o u4aexoirctadoatrlu i s trto(m iy4oltemieslt  rtrum no1ole if3tldla2eau p t4 lenmf ty1laD an olt) rxr(r3oydapt  feiat)srrrxr nu1tet mo3iys m rl( p u0 ltoxf ty1laDrli o;s srurxm3io4oleemnvtltfsDuru o;t1alxn ociyt mDrmnms;u)trtnir oo1fpteli sl() etr(r3iodlle mnvias) 2tm(m oo4alxn ietldlaDemuvp;()trtnmf3ootlptrluvsl(0t2xrxm nu4om e ietl()aDua(rpno1oexniiciatlsDulnms;() lxomrctydoatraivilt seto(rpiudomt mieils  Dtmxrp;o1teenifctltfa el(mp;(0aexnio3iatlp   nvs;() 2xm(o iudal nlivil(fsrraxmo;o0aetn o3ild s2rlu sn(0aeermocoodlmtrauvil( s2um(r iudamenmnvia( a2tmxmp;u0apxomfeiadla ua( o t)trxrif tydlm rlu o;t0srtr(rpiu4lpe mfeslt arur(m ;o1apx  f3tas mDeanmp (4aexoif3io1omtrluvi () rto(m io1apenmietl()sruau ont1alxo fciydlm rmu pn(4trtrmr3oadomDr ivs;(  eum(opiudomeelfctlt) 2tau  nt1ape ifeiasla2rm(mp;t4 rxnirciodlaD  neilt)t2umimpnodlm nmfeil(fa2uru poo4ope mictldfa2rm( o;u4teerxf iadfpteln o;t)setmxo3io1lptnmfes (faruau  no1ope  ociltlm ea(vs;u)arxrxocta1laDean olt0 2xrxopnydolen feslt) Dtmx o;t0ole mieilsfs rmnmsn(4 eenio ootfpt aieo (0 2xoir iy1amt  fctas  Dta(m nt0opeoifeiatls rl( s;t4aexrmfcta1lpDraueolt)srtoir nudap e nvi t  rtmur nt0openiieildfaDeluvpnt)aeenxfctydlmD  ieols0trtmio3oydale licils s2umu pot4teenif3tldfm uan p u0 etrxfctadla ean o s)sexo(opny4lp n fcia(faDtaxm no4olxnmfeiyt sDemn sn()alxnxo3io1lmDrlueslt  2xmir3ny4omtn ncslsfa2ua(  ot0tpxoiociadlm rmu o;(4 lerxr ta1fate n i;s)trto(o3io4ameemictltfartm(moou0opt io3tlslaDelump t)tlxrmoctadlptrlu i;s srxmirpny4lmtnlics tf 2rrx  ;u1tleniieils sDeau o t4 exoxf ootlmtelueo t) 2tmxm oo1aptnlnvsl()aDrmxmoou4opxn ocils a2ranvs;(0trermf totomtelneolt trtm(rpnodam elfvsltf Drm(r oo1tptnmf3iys m2ul(vo;u)aexnmo oy1lmteanei;t)seumim3nu4llen ietasfsrraxr ;o1teeomf3ild m rau p;t0aeeoir oo1lat lieolt  etrxmpny4ll n feiasf rua(r ;t0tetomoeiasfm el( o;u)aleoxf3ta1latr ivs;t)srum(m3oodlltnlfesat srtr( ooo0opt  ieild mDrm(vo u4aeerifctatomt  n i;(0truo(m3oudopt mfcslt)sDumu pno1tpen ieiydls2elu s t) rtrio3tadfmD lnvi (  rxm(r nudom emfviat aDra(  ou1tltnmocildls ua(mont)aeenircoo1fp e i i;s  ruoim iydolee netas)sDumu  oo0tex iictls a2rlumpnt)tetrif tydlptelieilt) 2tr(o oo4omeemivs t)srururpnt0alxo fctasfs2eaums;u4tleoxf3ty1la   ieo s) exo(rpnodapee fcilt)aDumxm no0oee  ietyt a2ul( s;t4 rxrxo oydomDean slt)setrir io1amenmiesat)aDrrumpnu4oexoioeias sDem( onu)trerio tatlaDeau s ( srxriopio4ap  lnvs s  2urxmoou1apxoifciasfm2elnvp ()aetoir oatomDr nei ( trtm(opoy4aptn net tfsDrr(moou4ope mietltla2ran s;u) rtrir to1lpD aneolt)t2trio3iodopeemfciat)sDrr(r ;u0tpxomfeiysls2rlu o;()tleoxr todomDeln i;t)seumxmpiydapen fct (fsrumur nt0olt  fcild s2ra(mont)trtomf3to1fatr uvi s texrxmpiydaptn feilt)aDumu  ot4alenio3iyd aDemnvp t)teermf3iodoatr ivol( s2tmxr3io1ol n nciatfsrrm(r ;u1oeeoiociatfaDemu s t4altnxo3todlmDranvil(0 2to(mpio4alte fetat) Durxr nu1tleo ociadfm2emums u) rtrxoctydoaDraies;( t2xrxopnu4lleelicils) ruau  ot1aex  feild sDumnmo;t4aeeomo tytlpt ln sls0 rur(m nodlpenmnct t  Drrx  nt4olxoifciltla ea(vsn()aetrxo iodfpDr ieil(  2xmxr iydaptelieias  Dtrump;o0apeo icils a2emuvpnu4 lxnirctodomtr uei;t) 2xoxr3iu1ap emnetas srtrum nu4apx mieilslaDranmp;u4 exoxo3ia1lmD ai ol(  rxrim oy4lmtnmictasfs2rmumpoo0oleoiietys m uauvs u4 lenxo ta1fp rli ils  2xrxmpoo1ap nliet s)sDtmurono0tptn f3tltlaDelnvpnt0 eermo ta1fmte uvsl( setoim iu1lpt lici s)a2ua(r nt0tlt  ietytfm2rmumpn(0tltrioctydfmtelu ilt0 rtmir3io4alee nvsl()aruaum ;u4oex mo3ias s2emu o u0alxrio iodlmD  i o;( srxoim nydllen iviat)aDrru ono0oleo fciatla2um(mpn(0arxrmf tatop eln sl( s2urimpiodlpenmiei t)srrauro;o1oexnmo3tas s2eln pnt)alenir iydfmteauei s0 2xmxmpoodllt  nctl() 2ur(  ;o0oet  fciltfaDeaumo () rxrxrctytlmtrlneo;t0 2umxr ou1al nmnei tfaDua( o;u4aleoii3ilslm ra(vsnt4tlerxo3tydlptrli s t) 2to(o oodlp  mnet sfsDta( pnu0opx moeiatla2rlnvo u0trxnio3oo1oat anvo s) 2tmim3oy4apenlivs ( s2um(rpno4aleoiieiytlm emnvo;() etnif iy1omDranvs s0 rtr(mpoudapenmnet sfaDtmurono4altomiciytfs2el( s;(0aexoxf3iotlp eluvi (  rto(o3iu4llenmietl(  2ta( ono1tltnifetltfmDumnmp ()aexomr io1fp rlueils setm(m iudomenmneils aDraxro;o0oet iietldfaDrauvs () lerio totfp  ai o;s0trur(o ny1opeelict t)sDtm(mp;o0tlx  iciytls2eluvsnt4 etnmf3iy1fpte n s s srtr(o3oo1op nlivt tfa2ua(rp;t1olt  o3iytfa2um( s ()tlxrxr3to1fptrai o;s0 exoxo oudam nmfctl(f rrmxro;t0texoiociysfa2ua(vpnt0trerxf3ta1lp elueil(0setr(r oy4ale lfcilt s2taur no4apenifctyd a2ulu s;(0aetrmrcta1optr u olt  2toim iodol nmfvi s) 2tm(r ;o1aetnmfeiyt s rauvo (4 rtrxrciatlpteluvo s trum(opoudolen fvtls)aDrmx poo0olenmi3iysfs ranms;(0 reoif3oatlp eli o;s0teto(o oodal  lnvs s artr(  ;o4olto icilsfa uluvs;t) leoir3oy1lpD aivols trxo(m no1ape livsas sDurx o;o0aeeoiociad a2ulnmp (0 etoif3iodlm rauvs;( seto(m oo1op n ncs (farta( pnu1tpt  iciaslaDrln pnu)artrir3tatlmDe i ilt setoim3oo1om e neil( srrmxm ;o4alt  fciys s eanmo;t) eermrcty1fa raneo;(  rtrxopiy1amtn ivsltf 2rrum ;t1oet ifciatlm2em(vs (4alenxo iotla rauvi s  2xr(o3nu4ome mivtls arraum ;u1tex mocildls2ul( o u) rtrmo3to1lm elu sls  exoxmpiydlpt lfvsls)sDrmxr nu0oltn ocils mDrau snt0altrmf oadlatran slt  2uoio3iydlptnmfcta( a2ururp;o1alxn feiadla um(vo;t4tetoirciy1oaDraivilt)s2to(m oydlpt  ivtat)sDtru ooo0tetnmieiat m2rluvp;u4 etrio iatfa  auvsl() etmxopnu1aptelieiatfsrtaxrpnu0teenifcildlsDuauvs;() exrxrcoytom   u s ( s2xm(r oy1ome  ics tfsrrr(m ;t4tee mietys m2umnvs u)areoxf oy1lmDe neo s)s2xmxr3iu4lptelict (fartaumpnt4optn ietad mDel(vo;(0texomf todomDeauvo (  2uoio nudam e nvtl(faDumxrp;o0tetnmi3tadfsDul( o;u0 lenifcty1fp eln ols)teur(o3no4ap  mncsas  2urxr ou1olxn ocilslsDem( p ()tlxrmf3oydfaDr uvo;(0sexrimpno4lpt  iviatfsrurumo;t4opxn oeilt sDum(mo t0arenxr iodla  aneilt  etoirpoy1lp  mivta( aDua(  no1tpt mi3ilt m2ranvpnt) lerir oatlate i i (0 2trimpio4ape lfvi s) Dtaxro;u1oet  ociytls uanms;u4 lxoxrctodop elueils0 rxr(o3iu1llenmfctlsfaDurxmp;t1tlxo ieiysla2uan pnt0 exrmr3to1fm eauvolt0 rto(o3ny1omt  ietat)s2rax  nt0optomiciydfm ua( p;u0 etoio3iydlm r nei;( teto(rpou4apenlneslsf 2tru  ;t1teeoioeiadfsDrm(mp;(0 exoir tytfmDrlieo t texr(r nudamen fvtat arum(  ;t0tee mi3iytfsDum(msnu)trxrif oa1oaDeauvsl( texrimpoydlpenmivs () ruaxrpot4alx mo3ildfm el( p;()alxnif tytlm   ies ( s2xr(opoudope  nes (  Dua(rooo1optomoeiltfa elu o u)trtrio3oytoaDeluei;() 2umio io4lp  mfvsas)aDuaumpnt4oltnmo3tys s emumonu4aetnxocto1fpDrliei;t0t2xm(rpnodol  micta()a2uru oot1ale ii3tyd m2emump u)tetoxr3iy1lpD lu il()srxrimpny1lmenmnetltf 2trumpot1tpt  fciasls elumonu) etoxo io1laDrli i;t) exm(r iu4amenlncslsfarrm(  ;o1tpe  ieiadfaDrmu p (4 ltnirctydlmt an ol(  exoxr3io4ll   ivia(farrax pnu1alx mfeias aDumnvo u)artoxrctydlpDraiesls0s2urxm oy4lptnlnvi (fsrraxmpoo1olxn icils a rl(mp;u0 lxomo tatlatelieils) 2xrxmpny1lm e fvslsfarur(m ;o1alxn f3ilsfa eanvsnu0artnxfciodlmDranes t0t2xm(m3iu1am nlfei (f rtrxmonu0tetnmfcilslaDumu s;(0 rtrmrcoydlat ai olt)s2umxrpoy4olt  icsls)aDumuro;o0teeomfeiydfm ranvsnt4 reoxo3ootomDr i o s)setrir oo1lptnlnet t) Dra(mo
\ No newline at end of file
@@ -0,0 +1 @@
+uvilt trtrxmpnydlmt mnvtltfsDurxmooo0aet  o3iytlm2eau sn(4arerxo3oodlmte uvslt0srtmio3ou1lm  lnet tfaDuau pot4teeomictltfm rl( s;u)tetnmr3iatoptrai s;( trxm(m no1lm nlfetasf rtau p;o0teeomieiasls2ua( on(0 etnxf tadfp  livo;(  2uo(mpny1ame lfvslt arua( p;t4apt mf3tadlm ra(vp;u4 rxoxr ty1fmDe ies t0 exo(m iy4alenmfes (  Drrxrpnt0aeto iciatfsDumumpnu0aexriocoy1fmt au s t)sexr(o3nu4omee fvslt) rum(ronu0aex mo3ilslm2rm( p u0 lxrmocoodlpt ln il(  2xmio3iu1aptnlfcs ( sDrrum ou1tpxnmfeiad a rmn s;u0 renmo oy1fa eanes;s srum(rpoo1opt  fcia( aruax o;t1oeen oetydla2el( o u)teeomfcoatoptrlu o;t trxrirpiu1amen nvtls) rururpou4apeomietasla2emu o (0tleomr3ta1fm  livo ()t2uoio ou1optelfcilt)s2rr( o;u0aex  ictatfa2eluvsnu)aeerxf tadop rlieols)s2tmxr3iydlp   icsa(fs2tm(  ;o4opx mf3iatlm2um( s (4 ltoxf to1op eaivslt)tetoxrpiudamtn icsa()sDurxm ou1aptnii3iad m elnms ()trxnmf to1opDr neilt srtr(r3nu1ap n fctat  Dtr(ro;t0aeenmfetatfm rmump (4 lxrifcto1opDrai s t)texoir3ou4oltnlieia() 2trxrpou1oltomfcias a2rl(vs t0texnmo tatfmt li slt0 exo(mpou4ameemies tf rurumpoo4tlto oeilsfs rlnmp;(4 exnir3ootlp ranvo;t0texmxo no4al nlnvt s)sDrm(roou1apx mi3iaslm2el(vs (4aeermociytopDrli i t)seum(opoudameelfet t)a2uax  ;t1tlx mf3iytlm2emu sn(4 rxrif3to1fatr ivil(0s2trio3nydomtelfcils)a2uaxm ;u0teeo feiysfsDraumpn(0tetrircoo1opt an i;(0 2xmxo ny1lltelfesa(fsDrmumo;t1olx mfciydlm2uaums;()tlenir oa1oate uvo;(0t2xmxrpnu4omtnmfeiat arrr(ront1opx moctlslm rlnmo t0 lerxfciodlpteaiei s0t2tmxm io1ame  nvtl(f Drax oou0alxoifetadlmDemumo;t0tlxrio tatopteaieo;t0 2urxm iodlpt  ivi ()sDtmxm ou1aeen feiytlsDumumsnt0tltnmrctodom  auei;(0 rtr(o3iodoltnlictlsf ruaxr nt4oex iociltfs emums;u0altrxo oadlmt an sl(  2xr(r io4lp  lieslt sDtmur oo0tle mfcilt a emnvpnt0 exoxo iadfm elues s) ruo(m3oydlptelicsasf rumur ;o4oex  feiyt aDua(vp;(0arxoioctytoa   uvsl()srtrir3ny4am nliciatfsDrm(ront1texniiciasls2em(mon()tleoxf todopDe uvi ( srtmxr3oy1aptn nvt t  2rrxmp;t4ale mo3ilsla2umnms;u)trtoif3iadlp  anei;s) exrxo3oo4ameemfetas sDuaur ou1tlxnifetas m2ua(vpn(0aetrxociydlatrai o t texm(mpoy1om   nvi s)srurum oo1apeoifciyd mDrmnvon(0tlxoxr3tadlp e i ol() 2umxrpny1lmeelncs () Dum(  ou1aptoio3ilt s umnvp;() etrmo3oatfat anvs;t)teur(o oy1ole lfvilt  2rr( p;u4aee mi3tadfs elu p (4 exrmr3iodomD auei t)srxrxo ny4llt mnctlsfarraumpot0apto ieiyd sDeanmpnt0 rxomo3todlatrai ilt srxrxr oudaptelicia(fsDrmumo;t4tlenii3tydla em( s;t)aetrxr to1faDraivs ( srum(m oodoleelfcs s)srraumont1tpt iociadlsDrl(ms;t0trtrif iodoa rli ilt0s2tr(rpnu4op emfvs (farta( ont0oex mi3iasfsDulnmp;(0aetrxo iadopDeli s t) 2xmxr3oo4al n fcs sf 2uaxr ot0aetnifctat a uln o;t)trxoio iadfmte uei;s0 euoio3iy1am   ivslt) Dta(rpno4apxo f3tld m2ul(vs t4teeoxf oydoa eai sls0texmxrpiu1omtn ieslsf 2uaxrpou0tleoifctytfmDeaump u0 rtnir3iadop e ivs;(0texm(o nydlm nlict sf 2rmx o;o0aptomfetltla2rmn pnt)aexrifciydlptelueols) etrxr nodlm   ivsltf Drax  nu1tex moctlsfmDulums t4trxnxr3oa1fpDr nes;s0sexmxo3oo4lpt mfctl(f Dua(  ou1oeto o3iydlm umn pnt0aeeomo io1opteanvi;t trxo(r oy1op  lnetas sDtrurp;u0aptnmi3tydlsDrmu snu0altrir todlmt aiei;s  etoir io1opee fcils srur(moou1aptnmfctyt a2ua( p;(0trxoio3iytlp  auvi s  rurxrpoy4alenmnvil(fsrurur ot1apeomieiadfa2elnvsnt)arxoxo oatfpt anei () rtr(o3oudap  livsl(fs2uru  ;o0oetomf3ildfs emu pn(0trtoiociatfa  lneil(  exo(m3iudolt livi tfa2ta( pnt1tetoif3tld mDelumo u0tetnxr3tytoaDe uvs;s0 exmxopou1oleeliet s sDrmx ooo4oltnifetytfsDrmuvs;(4 etrmr3oy1lmteai o t)srxoxmpno4ll   nes t)a2tr(rooo0apeoiieiytlmDea(vs;u) reomfctatomDeauei;t setoirpiy4altnlicsasfsrtru pno1ale ifeiltfs2um(mp t4treomf tydfa  aivs ( seum(o3oudlp nlneias  Duaxmonu4olx ioeiat a2rl(msnu)aetnif3tytfp elnvsls)srtm(r3iu1openlnesa( arurxr nu4aeenmoetytla2uaumsnt)alermr3iodomDr i i s)sruo(rpiudap e fctlt aruax onu4olt  oeias sDrmn p;u0 rxrxr oy1oa  aies t)t2uoxmpiy4alt mfesas s2tru onu1apeniociyd a emu onu4aeerxrciy1oatr ieslt texm(o iodlp e iciat sDrmxront1tet mfciltfaDean s (0 rxnio oatfp eaies t0srtoxr oudomtnmnvs (  Drr(r ou4tetnif3iad aDeluvp;(4teenif3iotop rlivs t0srxmxr3oo1ll n nvtasf 2tm(  ;o0olx if3iadlaDrmuvs t0tlenxfcto1lmteluvs t sruoir3iu4lm  lfvtltfsrurxr ;t1altn oeiasla2rm(vonu) rerio3iadfpDe u olt)teum(m3nodal   ncs t aDtauroou4tpx ioetldlm2ranmo u0aeenir3ootlmtelivs s s2tr(o ou4al emfciasfarrrxr ;t4tlt ifeiasfmDranvpnu0teenircoa1fmD  nvi s  rtr(opiy1apt lnesa(fsrtru p;o1ape  oeiatfa rlu o;u4 eeoxfcoatopDeaneo;t  etm(r3oy4ll nlnvil( sDur(mono0oleoii3ilsfsDranvp;() reoif ia1laDraivo t0t2xrxo3nydomt lnei tf Dtru o;o1open fctys s ra( ont0 etnmf3oy1laDeau sl(0sruo(r3ou4apt  nctls srtrxrpnt0tlenifctytfmDrmumsnt)aeenio3oatlpDeln i;(  exrxo3ou1altemfcsls)arrm(  nt4tpto oeiysfa uln o (4 ltnmo iydomteanvi;s0srtmxopou1llt lfeil() 2urxrpot1aeenifeiydlsDrm(mo;t0trxoxf to1oaD liesls t2toxo3oy1apenmfcil(fsrtrxr nt1tptoiieiytlmDul( p;u)arermocootopD anes;t sexrxr iu4apt lfvsl() Dta(mpnu0tptoifeiasla2eanvs;(0altrmf3iydfmD lieils)t2tmxopno4apt livtls aDtaurp;u4tltnmi3iltfmDrmu o u4alxrifcio1omDeaivils0s2urir3iy4op elfei (fsrrmxmooo1ole mi3tls s2rmnvp;u) eerif oo1lp ran s (0s2uoiopnudaltn ivt t  Dtru  ;t4opt iocild s2um(vo () rtrxr tadfmte nvs;s)s2xmim nudlmee nctas)artr( ont0alenii3ias sDel(vont0arxnmfcoytopD ln s;s  etr(rpiu1op   ivs s  Dtrump;t4oeto oeiydfs uanmo;u)alenmo3oy1op eanesls0srtmim3oo4lmt  fesl() Dur(r nu1teeniieiytfm umump;u4 etomf3iatom ean o;s0 2um(m iydlptnlfvt tfsDtrxr ;u0ale mictatfa2eau p;(4trxnio iodfateanei;t0 etr(m nu1lm elfcia(fsrtax pnu0optomiciyd s em(vo t0trenmocio1lpDrli o;s0srtoxm iu1am n ivi tfsruaur ou0tpeo fetltfa2uau o;t4aexrmr3tytoptr i s;s0 2xm(opiudal elfcilt)sruax oot1teenmieiasfs rmn snt)tetoxo oydopt lieslt0trtm(mpio4am e fcs sf rurx o;o1teto fciyslmDul( o;u)tlerircoa1fmD anvil()s2xrir iu4ll   nvsls aDum(mpoo1texn iciyd mDuauvsnu4aleomfctadlaDeaivols trto(rpou4omeemncia( arta(  ot1tlx ioeiadla2rlumpn()artnxo oo1optrluei t seuoio3iy4lpenmivslt aDuru  oo4alt moetyslsDrmn s u) rxrmf3iadomteanvilt)sexrxrpnodop n ieilsf Drmumpot1tlxomf3tadlsDrmumsn(0trenmr tydlmDrlivi s  2xrxo ou1amtnlnesat)sDrmumono4aetomo3ildlmDumuvont0 rxnmfciytlatrlueo t0texoir3oy4am e icta( aDuaur oo1oeeo ociytls2rmn snu4aetnio3iy1om rli ol() 2tmxm nodllt lies t  2umxm no1aeeomiciys mDua( p;t4aexrmr tytfaD lnvi;s0t2tmxrpny4ole lfvs t)s2ra(mpnt1aexn ocilt a2eauvo (0aexoxr oa1fa  anvsl(0 2xr(opou4altemncta()aDtaxmooo4apxomoctldls2umnmo;u) exoxf iytlp eai i;t)srtm(m3oudol elfviasfaruaur ;t0opxnmf3iydfmDrmnvpn(0altomf oadlmt lieo s trtoxopio4lle mfetat)srtmx oou4apxn o3tad s2ea(mo (0 exomf3iytfpteln ols0s2um(mpiy1apt  nesls)sDumumo;t1tlenmociltls2rmnmo;u4 etrir oadoaD  ivil()trtr(o nu4ap   ivia() 2umu  oo4tltnio3iytfsDuanms () exoxfciotoaD luvsl(  rurxrpiudamtelfeslt s2urxrp;u0tpxomictydls uau p;(0tltrmo3totfmDelies t  exo(opiu1opte ncils)aDra(mo;u1tle mo3ildfaDuauvs u0 exnmo ta1oatr n o;(  etrxrpiodalee fei ( srururont0oex  i3ildlsDrm(vsnt)altnmf3oodom ranvs;t)srxmim no4amenlivs (  rtmurono1opxnmoeiysfa ul( sn()tlxnifcia1fmtraues (0s2urim nydom nlneta(fa2ta(rpoo1tpx ifciatfm uan p u4 rtrif3oatlpDr iei;t s2xoir3io4ape mfci tf 2urur ;t4opto o3tldfsDumnmo ()trxrxrcta1fa   neolt s2to(o3no4lmt mnesatf rrmxmp;t1alxnmfciatlaDuau s;t)aexnxf io1laD luvo t t2toio3ny4lpe  fvtasfs2ur(rp;o0tee mieias m umnmo t4treoio iatoat anvi;()srtrio ou1ale livs ()s2rm(m oo0oeeoioeils m2uanmsnt)texoxo ty1oateau ilt0srtr(m3nudlptn ict () Drm( pno1aeenmfetldfa emnmonu)trtnxr3todomt ln i;t0t2umim ou4lm n iesas) 2trx pnu0tpto fciadfm ua(ms (0 etnifcoytlpD aneo t)texrxr oudam nlicslsf Dtrur oo4ape  f3ildfa umu onu0 eenxf iadomt  iesl()trtoiopoodoptnmncsat s2tr(r nt0tptoiieiadfm2rl(mp t) exrmo oa1lmD lieo;s)s2xmxo3oy4aleemivt s  2trxront0teen o3tld m2uau ont) exnirctatfaD auvi t) eto(r3io4alenmfesl()sDrm(r ;t1tlx mieiyt aDuan sn(4trtnio3oodoa   u o (0texrim3oy1altelfcia( srtr( oou4ole ifeiltfaDulumo;t0aexomr3oydfat  u ils)t2tm(r3oo1lle  fvta() 2um(r ;u0oeto fetaslm em( o;(4 rerxr3iy1fm   n o t tetrxr oy1op elnvs s)srtr(  nt4texo ieiad m2ran ont4 rtrxr tatfpteln s t t2uoir3nu1llte ivtat) rurumpno4tet  oeiadlsDum(msnu)trtrirctadom eai sls0s2xmirpno1ame lict () Duaxm ;u0opx  f3tydfs rl( p;(4alxnif tydfm  aneo;(0 2tm(r iu1opeelncsltfsrtm(ro;u0tex mfctaslaDuan snu0 reoxo3ootopDean o;s)truoxmpoy1apeemnvtl(fsrtaurpoo0apxnmfetltla2rlums;() ltoiocoytlpte i i;( sruoiopiydom  mict ()sDrm(mpno1ale  ociytfm2el(mont0texrxf tydlp r uvo;t0texrxm3ou1om  mict s srtau  ;t1tpx miciltls2ua( o t)trxnmf io1oaDr iei ()srurirpnu4lmtelicslsf Dtmur no4tpeo iciat mDuauvpn(0 ltoircia1fa ean ilt t2xmir oy1om nlneta()artau oou1oee iieiydlm eauvp ()tlxrxf iy1fp eaneo t0s2xm(r ou4lp emfvtl(  Drmxm oo1oleomf3tltfs emuvo u4trtrxr3oadlmt auvo;t0t2to(m3iydamtnlncsl( srrm(  ou4aexnif3ildla uan s u4 ltoxfciytfa rluvi;t) ruo(r3oo4ale lnctlt a2rmx p;u0texo iciadlaDrluvs;t0aetnxocoydfatrai s;t) 2uoirpnu4am e iet s)a2truront1tpe  f3iytlm em(vs;(0 exrmr3totlate nvsl(0s2tmxm nu4apt lfei sf 2raxr ;o4alxn feiatfm2em(mon(4trtrxr3ia1lmDe ieo;( trtr(rpnu1om e fcia(f Dtaxro;t4aetn icilsfaDulu p u)aexoxo3iydlate ieo;t0srur(m oo4lle  fei s) rrmumo;t4tptnioctadlaDrl(vs t0treoio ootlmDrluvi;()s2ur(opoudoptn fvta()srrmurpnt1tee  oetls m2eauvo;()altoif ty1lmt  ivs;s)seurio3oy1ale  nci (f 2rr(rpnu0alx  o3tldla rm(mo (0arxnio3oytopDelnes;(0seuoxo3no1lltnlieslsfaDra(rpoo0tlxnmictyt mDra(ms u)aeerxrciadfa r nes;t)srumxrpnu4olenmfvsas  Dumu oot0optn fctldfsDrm(vsnt4aetrxf3oytfat  n i (0s2tmxrpio4om  lnvta(  rrmx p;t1tleoiiciyd m2rlump u4tlxrxocoo1fm rlivils t2tmir3iodlltemieilt)aDrm(r oo0olxo ieiyd a2ul( o (4texoifcoo1omD  nvs;t0 2umirpiodol   nctl(fsrra( pno1tpe miciytls2rl(mp;u0 etnxr iy1om rau o;s texmxopio4apeelnvia(fsDua(mpoo4oltn f3iat sDrm(mont0 rerir3iatopt auvi t  etmxr nodame  fctlsfsDrmx o;o0opx ifeiat mDumums (4 leomo3oodfmDelueo (0t2xo(r nydal  mnvsas)aDrmxr oo4oltn octys m rlnmpnu0arxrxrcoatom elieolt)setoxrpoodomtelnciasfsrtaxmpou0altoiictad sDrau s u)teeomrcio1faD luei;()t2to(mpiy1oleemfcslt a2taxm ou1aeeoifeiasfsDemnmp;t)aleomo oadlmtr neols teuoxmpnu4lp elnvi tfsrrm( p;o0apxniicils s um(mo;t0trxnmfciodla raivs t)texr(m3oo4apenlfeil(f rua(mo;o1tlxo feiyt a uln ont4arenio3iodfpt aies;s setoxrpnudlle  ieia( srtm(m nt0tpxomiciysfa eln s;(4 lerxr3oytopD  ieo s0 exm(r ou1al  lnvt s)a2uauroou0tleomoctas m2rl(vs ()artoxo iadomt lneols sexrxr ny1am  lfei ( a2raur oo1oltnmfctasfa eauvo t4altnio iodlpDeaueo t0trxmxmpiy4al  mncs s  2taur nu4oetomociydfsDul( p (0trermr iytom e neo;t)sruoio3iu1lmenmnvi sf rua(  no0apeo ocilt s uanvs;u)arxomf iy1lpD anei (  euoirpoy1optn fcta()srraxmoot0alen octysfsDrlumpn(4 lxnxf oytfpDe i o;s trumio3no4lm nlivilsfs2ur(  oo1oexn feiad m2rlnmp;(0 ltrioctydoatelivslt) etoxm3iodoptnmicsa(f rrr(r ou0opx  f3ilt a eaumo;t0alerxf oadfptrluvi t) 2xmir3oo4amenlnes sfarrm(ronu0apx mi3tysfm2ea(vsnu0teeomr3oo1lp  aneol( t2xmim3oy4optelnctas)aDuaumono4opt io3iat s2eau pnu)aeermr3ia1lmteauvi t tetmxr nodapt lfvtas aDtrum oo4tex if3iat sDeau p u0 reomrcoydlp   i s (0sexr(o3iodalenmivi s sDtau  ;u4opeoifeiatlmDrauvo;(4teeomr3tadomt lu sl(0 2um(r3ou1lltemfcs sfsDrax oot4tetoifeilt m elumont4aeerir3tatfa raneolt0 rxm(o ou4om   fes ()srumx  ot1tlxniociltla raumo;t4alxrir3iadlatrlivols) exm(rpnydap nlnetl( a2ta(  oo0aet mf3ilsfm2rauvpnt0aeenmrcio1opDraues;t)texm(m3iu4ol e fciatfarumu pno0texo icild sDumnvsnt4altoir iadlmD li i s) etmxmpoudoltelici sf rua(mo;o4apen octatlsDelu pnu0 ltoir3iadoat  nvi (0 etmxr3oodam elnct ()aDumump;o0optnmoeilsfa2ulnvon(4 eenmfctytfp   u o s0t2ur(o oo4olen ivia(f 2uaxmpot0tpxn f3iltla raumpnt4tlerir3iadomD li il(0 rtrirpnu1optnlnvt s)s2tmu  ot0apxo ieias sDemnmsnu4 leoio io1fa r u ol(0 2toxo nu1amenmivi tf rtr(  ot4oleo i3tltfm uan s;u) lenioctotlpD luvo;( teuo(o3ny4olee ieiltf rra(mpno0apxn f3tytfa ean p;t4 rxrxo3todlpDr u ilt teuo(r3iy1ll emncslsfa2rax pno0opxnifetydfaDel(mon(0 renmr3io1oaDrlivi;s) 2uo(opiu1op  mfcil(fa2rrumpou4tptoioeilsfs2um( ont4 lenxf to1lm eau i s0 rumim iy4ll n ivsa(fsrum(ro;o1tet iictat a2ean o t4trtoxo iatoatraueo;s)tetoimpou1lmtelfvi ()aDum(mo;o1tpxniicias a emnvsnu4aexrxrciodopt lnvs;(0 rxmxmpnydaltn feilt)a2tau  ;u0opxomfcils s el(mp ()treomociy1lp eauvo;() 2xrxmpou4ome mnct tf Dumur nt0tlenmo3ils m uaums u)alxoxf3ta1oaDeanvsls  2ur(mpiydalenmfei s  Dtrx  ;o1apenif3iyslm2ea( o;u) lerxfciy1fatr ueils t2to(r3iu4omtnmfvsa(farumurpot1alxniieildfa2eanmo u)aexnmr ootfaD  uei ( srtmio3nu4al   ivt s a2uaxmont4alt miciltfsDem(ms u4 rxoiocto1lptelnvi t sexoxm3iudoptnmfcilsfaDtrumpot0alenmfciyd sDelnvo t)aetoxr iotfaDrlnvi t)srtrxm oo1lme mics t)a2urx  nu1aleomfeiat mDemuvp;(4altrmf to1lp rln i;s)seurxrpio4oleemfctltfaDumx ooo1tlxnmieildls2uanvs;(4tltnxf3oodfmD livi;(0trumim ny4opeemncsls) Dururpno1optn o3ilsls2ean s u4aexoir oadomD anvo;t)s2xr(m ny1am nlnetlt)aDurxrpnu0opeo ictadlmDrm(ms;u) lxrmf iatfat an s;s sexoxmpiu4lp n ici t s2ur(rpnu4aexomocias aDrmnmont4 lenxfciotfptelivs t0srxm(mpno4am e ietat sDururpnt0aex mieiatlsDrl( s;t0aleomrciydoptraneil(  eumir3nu1ame lneiatfs2urum ;t0oltoifctydlaDelu s;u0 rxniociotfa e n i;(0truoir ny1apt mnctat)srtmur no4opt ifetas s2rl( s (0alenxr3oatfp r ieolt s2toiopnodlm   fvsas) 2rru  ou1tltoiieilsfs2uanmonu4tlerxf3iytfmD lu i s0teto(r3iu4omenmivs t)sDrmxrpoo1tpto ietytfa2eanvs;u) exoiocoadop raueo t0 etriopiy4lle mfcs tfaDrmumo;t1aeenmi3tltfs uanvs u4 lerxfctytlpt luvi;s)srtoim3nodalenlivs tfaDumxmono1opxomo3tldfa el( p;u)tltoir3io1op  livilt)trum(r ou4lpeelfctlt)s2ta(m ;u1teeo icilsfs2rm( s;t) lenxr iodfp eai s;t) rxm(r3nydamt  iesa(f rum(  ou1olx mfeiyt m2ranvpn(4 lxoif tydfpD  iei t s2um(r3iy4am elfeil()aDtauroot1opto oeiltla rluvp;t4tlxrxr iadlaDr i s s) 2tmxo oo1optemictlt sDraum ;t0tpe  iciytfm uanvpnt)treoxo3iotfpD aiei t s2tmio3ny4ol e ict s)arrmxmp;o1oeeniictlsfa emuvs;u) lxomr3ia1oaDraivs () rurxm iy1ome lfetls)artm(moou1tlto ieiysfmDrl( pnu0 etomo to1fmtr uvo;t teum(o oydalen iei sfsDrmu pot0aex ifciyd sDrlums;t) exnxf3ia1fa   ueo t)truo(r3iodlm   fcsa( aDra(m oo1alen feiyd a rl( o;() etomr tydom eln o t sruo(m3iydopeelfeiatfarururpnt4olxnifeiyslsDelnmo t0 exrmr tatop  anvo s0 rtmxo nydoptelici ( aDuauro;t0alxomf3iydls2uauvo t4teerxr totlmDran ols)trxr(r nu4ap nmfcs t)a2rax onu0apen fciydls2em(vo (0arxnmrcoatfaD lueslt)seum(opio4opeelfci (faruaxmo;u0ale mieiltfs2ul(vs;u0 exrxrcoytoatr nesl() eumxm iudalt livt s a2tau o;u4ole mociyd m ul(mp t0 rxnif oodoa  anes;t)s2xm(m3iudaltnlnviltfsDuau  ot4tet mfciys aDrlnvpnt)tltoxoctatlp raues;()texo(m ny1lm   icsa(  2rru poo4tlt  oeiys s2el(vp (0arxrxocoo1lmt aueslt sexoxo iodaptnmnvt tfs2uaxrpnu4olt  feiyslaDean ont4aetnmf3tytom rluvsl(0srur(o3oo1amtemfesl(  rurxr ;u4tetnmoctasfm ulu ont4tetnmf ootfmDeauvo t s2xm(rpiu1ape mictlt  Dtmur no4texoio3tyd a el(mp u4artoxf to1fpDranvo ( sexm(o no4lmenlnctl(f Dta(r ;o0tetomf3tadls rm(vsnu0 lxrif3iydomteai i t  rtmxrpoo4oltemfes sf Durxr ot1aetniocils m umumon(0texnmr3totomteai i;t) rtrxmpiodame  nvi t)sDur( pno1ole ii3tatlaDrmuvon(0trenmfcta1oatranes t0 rxrxo ou1lltelictls s2urxrp;t1tlenii3iasls el(msnu) rxrxr oatoat ai ils)teuoio3iu4amen fvilsfsDrr(  oo0aeenifctlsfaDrmums;(4 exnmo oatlp e ies s)sexo(o ou4op nmfci ( sDtmxmonu1tltniietyt m rm( s;(0 lenmo oodomDraiesl() 2xo(opiydale lnes s sruauronu1apt ii3iltfa2elnmo t4 etnxrcty1om eauvi (  2xmio iudlptn fei ()arur(  no0tpe iociltla rl( s (0artnir iadop elnvo;t0s2xrirpnu1alt lnvsatfaDrr(ro;u4tetn i3taslsDel(mo u0artomo3oadlaDe n i;()t2xoxmpnydomtnmies t)arum( pou0apeniociasla ul(vsnu4 eermf oytfpDr ieo;t0 2trxopiydapenlicsat)srrr(ront1oetnii3tldfm elnmo t0artrxrcto1oaDelueslt trumio no1optnmfvta(fa2uru pot4aexnifeiad s ea( pn(0 rtoxr3iotfpDeaues t seurim3oo1omenmnviat) rtm(r oo4apto fctas mDelnmp;t0trermrcia1fatelues;s  exmio3io4opee nes ( sDua(ro;t4opt mfciatfm em(ms;u0arxrir3oo1lptrlnvol( srxmxr3nodolee iesl()a2rau p;o1aee io3ilt s2em( pn(4 leoircoydfa  lnvo t  2xr(o3oodapteliei s s2rmxrp;u4oetnifctlslsDrl(mpnt)tltnmr oadla eanvo;t)s2uoxr nu1opt  nvtat  rrmxr ;t1aee moeilt m ranmsn(0 ltoifciy1la elieo;t) 2umxmpou4lleemnvs ()srta(rpnt4texo oetlsfsDrlu s;t4aexoxr3iydfptr n s;t0s2ur(m3io4lm nmnes ()arrrxr nu1opto ictys s2ua(vp;t) rtnxr oa1fp  lnvils  2xo(m3nydalte iet ()aDumxm ;t4tltnmfctas m rlumpn(4texoiocoy1fpDe iesls0 2xm(opiodapt lnvi s)arrauro;u4aleniociasfaDrln p;t0arxnmocoytfa  ln s;t0 rtr(m3oo4lm elics tfa2uau oou4tex mfeiys mDemnvp () rxrxr oo1lmtrauesl( tetmxr nu4lm nlneiat)s2rrxr ;u0tpe mf3iat m umnms;(0 reriocto1lat  neo s)t2uo(m oy4al emfetls  2uax ont1oet if3ils a2ra(ms u4areoifciotfptr i ilt  2umxo iudope livtasfaruax ono0tptoifciatfsDrlumo t0tleoxfcoytfa e ieo ()s2toio iu4lmtn ncsas)s2rr(monu1alxomi3iasfaDelu pn(0alerxr oytomtr uvils0 2umxmpny4oleelivsasfs2tax  ou1oleo fctadfaDrau o t)areomr3oadla rau i;t0srtrxm nu1ap elfesa() rua(r ;o1aee if3tatlsDrm( onu0trenxr tadom e nvi;s0t2xriopiodom  mfeia()aDuaxmp;t4olto oeiad m rluvonu)aexoxf tatoptr uei s  exrxo ou1opee net (  2rmuro;o1opto ieiadfa emnvo;u0aexoio3totfaDrlnvs (0t2um(o3iu1omenmfvtas)srtm(mp;u0tee mf3tat a rl(msn(0 etnif oydoaD  n i;t) 2tmxr3io1al n nci s)arrmu  ;o1olx if3tldfsDemnmo (4alxoxr totomDrlu olt) 2uoio3iu4am  mnvtl( arraurp;o0oex ii3iadla2umump;u0aleoxo iydfpDeaneo;(0 exo(r nu1apt  ics t) 2ta(mont1aeeniiciltlmDrlumo;u4tltrif iodfm   ueolt0 2xr(m3no4lp nlnvtat  2urxrpot4altn i3iyd mDuanvo;t0tetrxr3oatfptrauvilt) rurimpoodlle  iciat s2trxrpnt4altnmi3tysfs2rm(vo;t0tetnmo to1fptrauvol(  etoxr iydalt  ics (f 2raurp;u4aleo ieilsls rmnvpnu)alenxr tydlmD livo;()s2uoirpou4lmt  ncsa(fa2rrxr nt1alto oetld aDul(ms u)trxoxr ia1fmD an sl() rto(rpno1opt lnet t sDta(rp;o4tex ifeiatfs umnvon(4aexnifctatop r nvsls  2xrxr nu1ap  lieils srumx o;u1tpe mfeilt s2emnvo t)aetnxocoa1lpte ivslt)tetoiopoo4openlfvt (fartr(mo;o0tltoii3tld m2umuvp t)areoxrcoydfatrlneilt0setm(rpno1al nlfvtl()arrr( onu4opt  oeilt s2eanmp;() etoiocoadopDraues t t2xoxm io4lp e ict t  Draxrpno0ole if3iydlsDra(vs;u4teerio3iodoatelnvo s)t2to(o3oodll nmnvtls) Dtrxm nt1aee ifeiyt a rmnvpn(4teeoxf tatlmD  ies;t) rtmxm3oodlpe lnvi t)srumurooo1oet  ieiadfsDrmn onu4 exnmrcty1oa r ueils seurim iodalenmnesat)a2ta(  nu0tetnio3iys s rln s () reoxrciodomDrln i (  eumiopoy4lme  nei ( s2umxmoot4tlenmiciatlm uauvp;t4teeoir oatfm  auvslt0srtm(rpoo4lpeemfvsl()sDtmump;o0oee ifeiadla raums (4 renxf oytfmDraivs;s0s2toim3iu1omenmiesat  2ra( pnt1altn fciatlaDul(mp t)altoxo iy1opD  u s;t)seuoir iy4lm emncs t s2tm(r ;t1tptnii3tatlsDrm( p u0tetnio oatom  ai o () 2urir3io4lleemnvslt sDtau  ;t0alx mfciasfaDranvs u0altnxo oatfa e ieol(0seuoim3no1ap  lneias) 2ra(  oo4tpx mf3taslm rmuvp;() etoxociatomtrauei s)sexo(r oy1lp elncsl()s2ua(ronu4tetn oeiyd m2raump u4 exrirctytoa r nvils)s2xmim3iy1am e iviat sDtmxr no4optnmfcildlsDum( snt) ltoir3iadopDeln sls trtriopoodamt  ivi ()aDtm( o;o1olxoifcildlaDul(mon(4altnxfctatoa   nvo s) 2trimpoy1am   ivs (faDtruro;u4teen i3iasfs2ua(vpnu)arxrirciadlp elnvs s trtriopiy4lm n ict sf Durxmp;o0opx  oeias a2rau on() rtoxr ootlmtelneo t seurxm nu1om emncs s a2tm(r ;u1apxoiietlt m2ulu o;t0 reoxf oy1omDrlnvs (  2umirpoy4ap n ieilt)srtm(m ot0oexnmfetatfm ulu s u4altoxr3ia1fpt au sls0s2tr(o3iudop elfcsasfaruru pot4teenif3tad a ra( s (0tlermr iotfp e u i;s0srxrio nydame  fcs s aDraumont1oltnifeias m em(mont4trxrxocia1lmtran i s)setm(m io1omt miesa()sDtr(rpoo4opeo f3iltfs rluvo;t)arxomf oytlm r neol() rxmxo iydape  fvtl( artaxrooo1opeo i3ildfa2rlnmsnt0 rtnmr3ia1la rlivo;(0 rur(rpoo1ll n nvtat) Drrxmpoo4ope iiciyslm eaumo;u4tleomr oodfatrln i;(0sexoir3nu4ap nlfvt tfartr(m no0olx ioctat a2ul(vp () rtomr3oodoptraivs t0s2xmio3iy4ole lnei t  2raxmo;t4ole mf3tydfm uau s (0texnxrcoy1lpt  ivil() 2xoxr nu1omeemfet t)arururonu0aleniictyslsDulnvs;(4 ltrxrcty1fat lueo t0sexr(o oy4oleelnvtas)sDta( pot0opt  fciytla2ea(vs () rxrirciatfptrli slt) eumxm3nodal emnei t)sDraump;u1apt io3iydlmDeauvo t)tlxrxo3ty1fa  lu i;t  etr(o iydlp n fetlt) rrrxmo;u0altnmf3tydfm2ul(msnt) exnio3oo1oaD luei (0trumxo3iudole  net sfsDta(  no4tet ifeiyslm2ulumo;t0tleoxociodla  lueo;t sruoiopnu1lmeemiciat  rurum no0tpe iiciydls uanmp;()arxoio oa1opte nvi t srum(r3nodom  micils)sDtrxrpoo4tlto oeiysfsDelu o (4aeeriocoatlp eaies ( t2xoxr3iydop   fvs (fsrraurp;o0apt ioetytfs emn s;u4aeeoir3io1op e nvils0teuoirpou4omtn icils)aDtr(root4olto o3iadfa2eauvs;(0 lxrif3iydfateauvo;(0s2uoiopoodol  livtl( s2umumpot4tpenmi3iatfs2rlnmsn()artrxr3iy1fptelies ()truo(m oydlp  mfvsltf 2tmurpnu1olxo fciltfs2rln o;u) rxomr3ia1opDr ueil(0 exmxm ny1omt lnesat)a2rrx oot4olxnmociydlsDrl(vp ()tleoxr iydlptr nes;(0srxoiopnu1ap  mivi t) 2uaxm ;t4texnmictytls emnmsnu4trtnxr3oytfmDelueslt0 2urxm3nu4oltn ivtlt) Dururpno1ape ioeiys m uau o;(4alxoir oytom  anvo ()s2toxr3iy4opt lnvil()a2ra(moou1aee moctltla2ua( sn(4tetnmocta1oa  lnvs;s)trxrimpny1ol  mivt ( srrrx o;t4tpx  ociytfa2uauvo (0trtnir3totfa  an s;( srum(rpou4ame  nvi ( a2ra(mono4oetoifetaslsDrm(mp;u4texnmr3iy1fat lues;() 2tmio3no1opte nci s)aDumxmo;o0opx  feiaslm2rmn p u)alermfciadfmDelnvils)trxriopiudape mfvsl(fa2rr(moot1opeoii3ilt s2um(ms;u) exoxr io1opD  uvi t0 etm(opiu1opee ivi t  rrr(m no4aptnio3iytfm2umu pn(4 ltnir iotlpD  i ols trxmio3nodopenmnciatfaDtm(ro;u4tlx mf3tlsls2eanvs;t) lxrif todopt lu s;t0srumir oo1am n nvtas arumu pnt4tptomi3ildlmDeanvp u) rxnmf oadom eaies;(0s2xrimpnydlp n nci t srumxr ot4optomi3tlt a2ea(ms;(4texnmf3oytfpDelneslt  etmxo3nodoptn nci (  Dtrurpot1teenio3iysfs rm(vo;u4 rtomo3tadlaDe i ol(  2trirpoydol  mfei s a2trxrpnt0aeeoioetat aDelump;u4artnifctatlmtrlneo s) 2toxm nodlpee fct ()s2rru oou4olxn icilsla ul(mpn(0arerifctodomtrlu s;s  2xriopnudolt lfvil()srrru p;o4texn fctasls2umu o (4 rtnxrcoadfateaivi;s)t2trir3oydam nlncsltfa2rr( o;o0aptoiieiltla2rmn pnu4trxoxociodopteaivo s) rto(mpou1am e nvia(f rraumono4ope mieiltfsDra(mo t)aeenxrcoy1lmDeaivils  etmiopnudoptnmivt t)a2tm(rpou4ape  i3iysls2um(monu0 rxrir iotla   u sl(0srtrir nu1amte ieia( s2rm(m ;o0opt  octyslsDeauvo;(0aexoifctotfa rlnei t  exmiopoy1amenmfctlt  2umxmoou4opxo i3tyt s ea( p t0texoiocootfm rau o;t0sruoirpio1altn ivs ( srumxrp;u1apt  feilsfa2emuvs t4aexrif ootomtrln i ( s2to(r oy4oltnlfeta(farrr(mo;t4apeomf3ias m2emuvo t) renmfctatlmtrlivi;t0s2tmxr3iu1ll nmfetls) Dtrur nu0oetn fcildlmDeanmp t)alxrir3totfmD lues t0 eto(rpiodap  lics s)a2uaurpoo4ope  ieildlaDrmn s;t0arxnmr3iadopDrlnes t) 2xr(m oy4omenmicias) ruru onu0tpeomi3tat mDul(ms;u0 eenxf3todomt lnvsls)t2tm(o no1opt lnctlsfs2rrx ont0opeo fcildfa2umnmo;u)tlenmo iotfpDe ivi;s)trtoxopiu1oltnlfcslsfsruaxm ;u4tpxoif3iytfa emnmp;u0 lxoxrcoadfa  aueo s)srurxr io4ap emfvta(f 2rm(  no1ole  feiydla2el(mp (0teenxocta1op e ueo;( srtoimpiydomee iciat)sruru  ;u0aetniieiadlm2ra(ms t0 reoif io1opDrlivo;s)s2xmir ou1omtelfvslt)s2urxmpnt1ope iieiadfa ra( p;t4 rermfcoodlateanvo;( tetrirpnu4lmen icilsf rta(mpou0ope if3iat m eanvp u)trxoxfctydfat  ueo (  etr(m iodlm elivi (farrrur no1oexn f3ildfs emn p;u4 lermf tadoateaieilt) 2umxmpny4olt  ict t) rtr( ont0opxomoeias s rm(ms;u)artnmr oodfpDe ivo;(0 rxo(m3no1alen ieiat  Dumx  ou0apeoifciyd m ra( p u)alxomf to1fptr uvi;()srumim3io4aleelfeiat a2tr(r nu4aexomi3tyd s eanmo;u4 lxrxo oo1opt  uvo (  2xoxrpnu1opt mfvt t) ruaur ;o0aetoio3tytlm2em( o;u)teenir3ty1latr nei ()srxm(opoy1altelfet tfaDtax p;t4apt iiciytfs2rauvpnu0 eeomr3totfatran o;s0 rtoirpiydol e fetl()a2trumo;o0aetn o3iasfs2um(mp;u)teenmrciy1la rlies s)s2xo(r3io4lmt mfci t)sruaum ot4tex mociltfmDrauvs;(0teerir iydfmtr uvi;s0trxrirpiodopenlfet sfsDtax pno4aetn oeias m2ra( pnt0teenif tatfmDeauvils)trtoxmpoy1ale livtasfsrurxr ;u4altomfeiatla2ranms u4altomrciydop ean i;t) exrxrpnodoleemfcsls)sruaumpot1texoif3iytfsDrl(msn(0artnmrctatomDelueo;t texmxopoy4lpt mnct sfs2tmxm ot0oex  f3iyd aDrauvpn() rtomfcoadlmt  ivo (0sexoxr iu4lpenmfvsas)a2uax  ;t1apt ifctydlm2ranmp (0 lermr3iotfmD livols texrimpnodame mnei t  rrr(mpoo1aee  o3tltlm rl(mont0arxrif tytfaDraues;t) euo(rpnudamenmfcslt)a2rax oou1tex ifctys sDul( ont0 etrif3oodlm e ivs s trurxr oy4opt  fvi ( s2rru p;t0openmo3iytfm2rlu o u0texrmr oy1oa  anes;t teurxr iudam nmneiat  2ta(mpot0oltoii3iatlmDeanvp;() renxr oadfate ieils)s2xmim3io4omt licta(f Dumxmonu0tet moetas a uluvo ()teerxr3iy1lp   u i t srurimpoy1amtelfvs s)aDtau  no4tpe io3iydfs2em(vs;(4teermo3oydlm r n sl() 2um(r no1omtelnesls aDta(  oo4opeoifciysfs2em(vp u4 rxnmociotla  lneilt0t2xrir oydop n fvs tf Dur(rpno0oeenmo3tadlm2rmuvsn(4 lerifctydoaDr i s;()srxmir oo1alenlfetl(  Drmu  nu0teto ictld sDrluvo u)trenmo oytopt auvo ( t2xm(r iydap  mivi s)arumx  nu4tle mietlsls rmnvont0alxomrctatlpte i s;(0 2tmxr nu4aleelivtas  Dumu  ;u0tpxnii3iydfm uan s;() eeoxocoo1lmt lieolt0s2trir3iu4amtn fct (fs2ua(ront0alx  i3iatlm2rlu s;u4 ltrxrcoatfm  anes s  2xmim iu1opt lfcs s aDuaxm nu1aex io3iydla emumon(0alxrxr ia1lateanvo s0sexrimpoy1ap emietlsfsrra(mpno0oex iociatlm umuvs t)trtrirciotom   i o s)t2tm(mpoudole  nesa()sDtaumont4olt  oetytfs2ranvp (0tlxoir3oadfmt  uvs;() rtm(r iudapt  nciatfa2tr(rpnt4olx  fciad mDemnvp;t)aeeomociadlp  ai s (0 rtoir3oy4al n ics (faDtmur nt0tee ii3ilsfa2rmumpn() ltniociatomDr u ols) rxoxo oo1apt lfvs ()a2ra(rpot0oleoifciatlmDelu s;u4 eeoifctydfmt lies t  etoxo iu1lmee ivt ()arrmurpot0tpeomiciydfa rl( p t)aexrxociadopDr nvols)truoir no1lm e ivsa() 2rmxro;o1olxomietydfmDelu on(4texomr3oydfm rlu o s  rurimpoudopenlieil(f Dtrur nt1ape  ociytfs2elu onu4tleoio3oa1la ean slt0s2ur(r oydlpen fcias) 2rmurono4opx  fetltla umn s;u0 rerxo oa1lpDrauvols)trxm(r oydlmtnmneia()sDrmur ot1aeenmoeiaslsDuln s (0 lermo3io1faDranvs;s trxmim3nydlmtnmicias arraxmp;u0teenmoeiytls uan o;u4 etoif3ia1fp e ivsls setmir3oy1amen ivtas) rtaump;o4apxoifetatfmDrl(mp (0 lxrir iydfa raivi t0trtoxo no4lptnlivi t) rur(monu0tpe  i3ild aDrmn pnu0trxrxo3oydlaDelnvi;(  etoxr3no1amee ietlt  Drrxroot1aleoiieilsls uauvs;u4texoir tytlat anvilt)srtoir nu4ol emnvta( s2ta(m ou1texnioeiatls ul( s u0arerxo3tytfaD auei (0sexmio oydoptelies t) rua(mp;u1aex  ieiytls ra(vp (0 exrif iydlmDrlneols) 2ur(mpnodlmen ivi ( s2rmur ou1aexnii3tls aDemnvpn() ltnxo3tadfptrluvi t)tetrir oy4lme micsl( a2ua( pot4open fetlt a2eln o t0 ltnif3iytfpt luvs s  2uoio3io1om n ivs (f rtrurpou4tpxn fciltls2ra(mo;u0aetnmf3tadomtr iei;t0trtr(o nudapt lfviat)srtrxm ;t4opeoiietadlm rmnvs;(0 etnxo3oo1oat lieol(0srumir3iy1op  mnvs s arrrxroou4tpxnio3iadlsDua(mpnt4 rxomr3tadoa eluvi ()tetoxopoo1al nmfvta()sDrmurooo0ole mociys m2eaumpn(0 reoxoctatlptrln i;t)srtmxo3iydlmt  nei ( a2ua(m nu1tpxomo3tltfm ul( s u)arxrxo3iotoaDeluesls  eurxr nydapte nvt sfa2uau  ;o1ole ii3iytfm2ul( s;u) eerxo3oytlp r n s s)trtmxo3iudlmtelivs s s2raxr ;o0oltnii3iatfm2uau s u0 eenmrctydlm  anvs t0setrirpoudap e neslt aDum(mpnt0tpt miciytlm eauvsnu0teerif ty1lmtraiei;t teumxopoo4al  micilsfsrurx  ot0opxn octadfs2um(mp (4aetrif3iytlp e nei;s)t2xoim oy1llee fvt t)srrr( ooo1apxo feias m umumon()arxnifciy1faD ai i t  exm(opnydop emici ( s2tru  oo4alen o3iatlm rl(vp;t)tlxnif oatfaD li o;()teurxopnydlpe mfvs t)a2trurooo4tltniociyt sDrauvonu4aeeomr3tydfaDrlieil(0teurir oy4ll  mnei (f rtmxr no1tpenifetydls2ean p;t)areoioctotlmDrlueslt0t2xo(mpny1ll  lfetl()srua( p;t4oet mietyd s2umu s ()teeriocoodlaDeaueo;t)setr(o3ou4llee iviatf rumuront0texomf3ilsfa2ea( s u0tetnio3ia1lp   i s;t)srurio3oo1altemnet sfa2ur( ooo0tlxnmi3ild aDuaums (0 rxoxo3iatopDelues;t)srxrir oy4ol nlivs t s2rmu pot0texn fctadfs uau sn(0alxoir iytlaD  neols)s2tr(m3ny4ame mivia(fsrrmxm ;o0olx ii3iys s2emn s;()alenxf3oytlat lu sl( truo(opny1omenmncta(fsrta(r no4apx  o3tydfaDrlums () lxrio iatfmDr iesls)tetoxo3nydol  lncsas)aDtrxro;o4aptomo3iydlaDelums;t)trtnif3oodlate i i t  2xrim3oy4optelivsl()aDrmum no4oleoioeiadlmDumu p (4 ltoxr iydomt  i slt)sruoio3no1lpe lfcsls s2uax poo0tet iictytlaDranmpnt) lxriocoatlp   ivs;( truo(o3io1ap e fcsat srumump;t4alxomo3tydlaDeaumon(0 leoiocoytfmtrluvsls0trxo(rpiu1om nlivs tfaDta(mp;t1aleniictltfsDra(mo u) exnif oytlpt au sls0sexoxo3ou4lmtemfctatf 2trx  no0tleo ictys aDrlnmsn(4texnmfctotfat aivi t srxoxm oo4apt lfcs t  2trxrpot4tpxnmi3iltla2rau p;()trxomr3oa1lpDeln slt0 rtrxmpoy4lp nmnvtasfarrm(mpoo0alx  i3tld m2umnms;t4trxrir3iy1oa  ai o;t0 exmxr io1lpe livil()arraurpnt1opxoioetadfm ua(vs;u0 etnxf io1om e ueslt)trumimpou4lm elivi (f Dumu oou0ale iociyt s2rmuvs;(0tlxoxf3iotlm ranvo;s0seto(r no4llte fviat)srraur ot0altoif3iysfmDul(vo t4trenif3iydla r nvilt0 euo(mpou4omt lfcsa() 2urxrp;t1oltomociadls ran snt4tlxrmrciotomt lnvi t  rxr(rpny1ll  lfeiat sDtrxmoou1teeo oeils mDrlums u4 rermo3iy1op raieo;s)setmim nudlmtelnei tfartr(moot4tet  o3tltls2em(mp;(0alxomo3tydlpDe u slt sruoim ou4apeelneia(f rum(rp;t4alx  iciytlmDumn o;t)aeeoio3iotfmt  u i (0seuo(mpny4oltnmivias) rtr(mpnt0aeeo fcildfaDulnmp;t)trerxf iodlaDr n o ()t2ur(mpiu1amtnlieia(fs2rrx pou1aetnif3iytls2ul( s;t0 rxrir tytlmDrlu sl( trtr(r3nodlm e feslt)sDta(mpou4optniociyd a2ulu onu4 lerxo3totomD lues;t0seumxo3ny1ll   iei (  Dumumo;u0aeto octytfsDemnvpnu)trxnif3iotoptelu ol()sexrir iodomenlncslsf 2urumo;o1apeomfeiltfa em(mp;t)tlxrir tadlptrai i (0s2urxmpoo4olt mfcsa() Dua(mono1tltn ociaslmDrluvsn() etrxf iatomDeanvs (0texo(m3oydamtn fviat) 2taumpoo0tlt mf3iyslm ea( o (4arerifcty1om r ieo;s0 rtrim oodapeelfvi sfaDum(moou1oeeo ociysfs uluvp u) eeomr oadfa rln o;s0 2xrio oy1ome lnei ()a2trx  ;u0ape mf3iatfsDul( p (0aeenio oytoatranvilt t2ur(r iy4apt lies s sDrmuroou0aeeoio3ildfm2ranmsn(0tetnmr oytoaDr nvo s s2ur(mpiydam elfcslt  Drm( poo1teeoiiciaslaDeluvpnu0arxrxocta1omD au s;(  2toxm oudlle mivil( s2um(  ;o1tpto fctys mDuaumpn()tetnmo3tytlptrlues;t0s2tm(m nydome  neiasf 2urxroot4ale mictldfaDrau p (0 rerxf oy1latrauei (0teumim3oo4al  mivtlt a2raurpot4tpt  i3iasfa rlumo t)alxoxo tatfpteliei;t0 2um(r ou1ap nmnct s s2ururpno1tet mf3tltls2elumo u) exoirctytoa rai s;t  exr(opoy4ol nmfvs s aDrrumpnt0olx miciydfs eauvo;t4aeeomr oadla r neil(  2to(m nodomtnlfciasf Durur ou0alx ioetadlm uau p ()trerxr3ia1oaDe uvs s0 etrim3iy1apte fcsasfsDrmurp;u4aee  ieiyd sDemu s (4aetrif oa1omtelnes;()s2xmiopiydlmtnmfvslt)aruax oou4tltoioctadfsDumn snt4 lxnxf3todlptrauvs s s2xr(r3ny4lp  mfct (faDra(mp;o0aexomi3tlsls2emnvsnt4texnxr oa1omDelivil(0 euoirpny4olenmieiatf 2raxmpnu0tex  ictytla2rm(vp;u4tltrmf iy1fm   neo;t) exo(o iu4lmeelnctls)artm(r ot4texoifetydfa2rm(vont4tltoxoctotfa eai s t)t2trir iu1aptnmicilsfaDtr(m ou1oltomoeiad a ra(vs u0aeenxr3iatfm elivo s0texoiopoy4ol nmncsat aDuaxrooo1tpxoif3tltfm2em( p;t0 rxnmocia1optelu o t t2xm(o ny1ap   ics t srraxroot1olx ii3iadfaDul(vo;t4aexrio3oo1opDeaiei (  rxoirpnydlpen nei t)aDuaum ou4optnifeildlsDeauvp;t0altrxo oatop elueils0 eumio iu4amt mfvils)aDurumono4tetnmfetad aDrmn o u)arxrmo3iotoaDrlnvi;s  rxoirpoodop nmfetlsf rur(r ;t1alx ifetltfa umnmsnu)aexomf3oadoa   ies;()srxrim3ou1amte ivslsf Dum(moou4oeto ociydfs2rauvpnu0arxrif iadop eliesl(0 rxm(r oydll  lfetl() Dtruront0aetomf3ias a2um(ms ()tlerifciatlpDeanvo s)s2uoimpio4lpen icsat)aDtrur ;t4apxo iciaslm2el(vpn() etoiociytopte ieo ()trxr(r3iy4lmte nesls  rrmu oou4olen oetldlm2um( snu4trenmr tytla   u ols)teumxmpoo1opeelnes ()sDtaum oo1tee ifeiltlsDrlnvo;u0 etoio ty1latrlnvo;(0 2tmim iu1opeemnci s)srta(mo;t0tpxn f3iad sDul(vo t)altomf iodom ean s t) exmir iydam nlnvil( aDtrxrp;t1opeomoctld s uln p;t)trtnircto1omDelies t s2xmirpio1aleemfvils)a2rax  ;t1altomf3iys mDrmu ont0trtnirciodlateli ilt0 2xoio nu1ll elfct (fartr(r ot1tex mf3tys sDelu snu)trxnifciydfptrlu il() rxoxo oudame mfetlt)sDumu  ;t1oet mfeiatfm2uau s;u) lerio3oadfm  livs s0srtoxmpny4lmte ivt ()aDrmx  ot1aex ifeilsfsDrlu s (0 etomr3io1lmDr uvslt0srxm(m3nodom elneiasfa2rmur nu4oetoif3tadla uanvpn(0tlenmf iotfp   ivi;()s2umir3iydol n ivias) rurxmooo4olenmoetasfs rlnvpn(4trenmr3iytlmD  uvi t0s2toim iu1omtnmfvtls)a2ur( ont1olenmoctlt s2eau p;t)alxoxf3iy1fm rai i;( seto(opou4op   nei () Dtaurpot1alto feildfmDuauvon(0aexnifcoytfatean s;(0s2urxmpiy1omenlnctl()s2raxront4opxoifeiadlm ulnvo;t0alxnxfciytopDe ivi;(  rum(m nu1om  mies sfs2uaumo;t0oleo oetldlm rmnmp;(0trermrcootoaD auvs ()sexoio3ou4oleemnvt () rtaumpnu4aptnif3tad m2rauvo;u) rxoiocoa1fmDe i s;t0 rtm(m oo1lmtnlnciatf rrmu onu4tpxomf3tytlsDrlu ont) eermr oytomt lieo ( s2um(mpou1al nmivt t s2trum ou4olen ictad aDem( s () rermocia1la e n s;t0srto(opno1op elfct sfarurx p;t1tle  oeild m rmnvo (0alxomrctotfmD luvol( teuoxo no4amee net s sDrmurpno4aleo ociydfm2em(mo u)aetnmr3oadopt li o;(0srumio3iodlmen ieslt  rrmx ooo0tlenmfeiytfa2umn sn(0 lxnxo oo1opt  nvo;t0tetrxmpoo1apt  neil()a2ta(m oo1aeen fctltlaDemn p;u4tetnxf tydomDe i il(  2xmxrpny1alee fviat)a2rr(mo;t4apenmfctadfa2rau s (4tleomr iodlmt auvi s)trto(rpoydll nmnesa(  2ururp;o1opxnioeiatfs emn on(4aetnmr3tydlate ies;( sexm(r3no1ol e ivslt)a2tm(rpnu1oex io3ils mDumnvonu0 lenxr3iodlmt lieo t0setr(opoo1apte fcsls)s2rax  nu0tlxnmf3iysfm ranvs;(0tlxnir3ty1fate n i;t teumir iy1ol nlicia()s2tax pou4aee  iciltfmDul( p;u4trtrir tadfp r uvo ()trxmir3no1olenmfet t artrxmoot1oetomfciad s2ra( o;u)aexoxrciy1om e u o t0 ruo(r3ny1om n ietl()sDtax o;o0apxnmfctatfa em(vp;(4areoio3oadfpDelieo s) euoxrpiy1lmtnmfcsltf Dumumo;o4opeomo3iatlm2em(mo;t4aeeoxrcto1omDeaueo (0 rxr(o3iodole lnctas s2urxmp;o0apeomfcias s ulnmsnu0arermf3tytopt  iei t0 2to(r3iu4amtnlietat) 2umumono4altoiieiad a2rln snt)tetoxo3iotlp  aivs;( trtoiopiodolt  fvilt)arum(mooo0oetoioetatfm2umnvsnu)aeeoio oydfptr u ol(  eurxrpiy4apt  fctltfs2ta(m oo1oetomfeiltls emu o;t)altomo3ootlpD lnvsls0 2uo(rpnydlpenlfcia() 2umuroot4apeo f3ils sDulu p;(0tltomfcty1lm eluvol()t2um(rpnodlmte fvi s)sDrauroou4oet iociysfs2uauvo;t0 rtrxrctytop rau i;( srxrir3no4ol e iei s srra(r nu4aeeo o3iys sDumnmpnu0trtomf iytopDeanei s0tetm(rpiydol  miesat)srtrur ou4ope mieiys m2elnvo u) ltnxo3oytlp rlneo;t0 rxrxrpny1al   ivtlt)aDrauro;u1alx ifciltfm2ra(msn(0aetrirciydfmteluvo;()teumxo io4opeemnvias)aDua(m ;t1aptn ietlt m2rlu pn(4aetnif3oatlptr ueils0sruoxm3no4lpee iviasfa2trur ;t4altn ieiyd aDrlnvs (0aeeoxr3todomtr u olt) rxriopno1olee ncsasfaDrmxr oo4teeo feiadfm ul(mo t4arxoir3ia1oatranvs s setm(opoudalen ics s)s2taurooo4tee  ieiys sDel(mp;(0 reoxrcootfm eaiei;( s2xr(m oydom  lncilsfaDuau onu1aeeo iciydlsDrluvs t0tlenifctodfaDean i t) rtm(m3oodam   neil( aDrr(rpou1teen o3tyt sDrlnms;()trtrio3oydoaDeanei;s srtrxm oydlle  iesls)arrm(mo;u1tpen fetlslaDem(mp t0artnmo oo1lpteaieols)tetr(opou1lp elnesatf ruaum ;t0oexoifeiadfm uan snu4aexnifcio1oa rlu i s)s2xmxrpio1om n nvtas)arua( oou1openio3tatlsDrmn o;t4texnmfciotfat lues t  2xoxm nydaltemietlt srrax p;t1aleoifcildlsDum(vs u4aeenir3oy1op  lu s t)s2tmir no1opt mncsas s2rrxro;o1tlt ioctyt a elums () rxnmfciadlpt  neolt trum(mpno4omee feia(  rtm( pou1tpeoifcilt a2uluvpnt)aeeomr tadlmteanvs ( teur(o3nu1lpe lnctls)s2tr(mono0aptnif3ils s ranvpnu0artnmfciytlatelnes;(  2ur(mpiodlptnlfeta(fa2tr(mpou4oeeomocias a2umumo;u4altrxociy1lmDelu o t  exmimpnu1amtnlnes t)a2urum ou1ole if3ild mDuln p u)alxrmocto1lmDrli sl(0 2ur(m3ny4om  mnctlsfarrm(  ;t4opt iociytfmDeaumo;u)aleoif to1latr nvil(0s2umxm3nydam   fetls)aDtrxmpnu0aee mi3iydfs2emuvpn(0 ltnir3tydoaDran slt) rxoxr no1altnmict s)artmu pot1oltnii3tatlsDea(mo;(0trtrmr tytlmte n il( t2tr(rpny1ope mnes s  Dum(rooo1apxoio3iltfm2ulnmp;()arxomr3oy1la r i s (0trxoir3iodoptn neia( arta(rpnt0aetoiiciat s2emn o;(0 eenmr3tatoa  lnesl(  rxo(r3ny4apeelfvtat aruaxr ou4teto i3ils a rlnmp () ltnxr todfmD lnes s teurxr no4ameelfctas  2umumont4apeoif3iydlm2emu s u)teenmfcty1laDe u ilt0texo(o3oo1am nmiciat) 2ta( ont0tee mi3iysfmDran s (0 rtomo ia1opDe nes;t)s2xoxm3iydlpee fctas srrmurp;o0tlenmocilsfm elumo t4teerxrcta1fp eaueo t0 2tmxr3ny4amen nvsa() Drr(r no0apxn ictasfa ulnvo t4tlenmf3oydlaDe ues;t t2xmio3io1ap e ivs t  rrauro;o0tex iiciydfmDrl(mp t0tltrxfcoydoate iesls)seum(o ou4am elivs ()arrrxmpot1oetnioctltlsDrmn s u4 rxomociytoaDe nvs s s2uoxmpou4llt mfesltfs2uax  ;u1tlt  ietatlsDuluvp;t) etomociydomt anvo s0 exm(o3iu4opt mncilt sDraxront0aeeomf3tld s umnvp;u4trtnif tytom rlu ol(0t2uo(r3ny1ap nmfvtl()aDtrx o;o0tpt  i3iyd s2rln snt4teermf3iy1laDr u o;t0tetoio3nudomt lnvs (f rumum ;t1aet mfctldfs rlnvonu)tetoir3oo1lm ranvo;s  rurimpny4om elivt s)srta(r ;t0texn fctyslsDea(mo (4texoirctytfmDrau s;s) 2umxo3nodam n ncia()s2tr( o;t1ole  fcildla umuvsnt)arxnmo iatfaD  nvi ( t2xr(rpno4lmtelfctltfartmx pot1aee  fetysls ra( o;()altoio3oodoa   n i;s  2xo(m3nu4apeemfcta()arua(rp;u0alenii3iatfm2uanmo u)alxrirctadfpD anes;t srumimpnu4ope licta()artaumpou4alxo fetatfa2eluvsnt4trxrmo3ia1oate uvolt)t2uo(opno4lpe mfvtat)aDuaum ot4apx io3ildfm ul(ms;t)trtrir tatopD  neo ()srxrxopnu4lp n nvia(faDurumooo1oee iociydlaDra( o u)arxrmo3ootlmD luei t  2umir iydap  mfvsa()s2rrx oou4texomiciat aDraump;() eeomr oatfm eanes;s t2umio3oydlp e ncta(farrmxmp;u0tet  i3iatfm uluvo t4artrmf iadoaDeaneo t seuoir oy4lptnmfvtltf Dumumooo4aleomicildlmDrl(vs;t)teerxrctatfmD li o s0t2uoxopiodom  mfvsa( srta(  ;o4aetomf3tatlsDrauvs ()trtnmociytlp  lu i;t)trxrio nu1optemiciasfaDtrxr no4tpto i3iad m ea(vp;u0 rxnmo iy1la eluvo;t0s2trimpiy4aptelnvias  2rr(r ;u4oee ioeildla ea(mpnu4 etnir to1lpDe nvi ()s2tm(mpnu4lmtn neslt  Dur(r ot0apxo oetytlmDraumo;t)tlxrxfciadom elies t  exrimpoudlleemfet s srtaum nt1alx  oetysfsDel( snt) lerxf oytfm eauei s0 rtrxr io1om n fvi t) 2rax  ;o4optomociat mDemn pnt4 rxoxf3tydlp rln ilt0trxo(rpio1ameelivil()sDta(rono4apx  iciltfm2ea(mo;t0teeoifciodlptr i i;t) etm(mpoo1aleemfcs s) Dtax poo0alenif3ias mDumu s (4alxoifctydlmt  uvils) rto(m3ny4lme mietlt) rra( onu4aexnmoeiytfm2um(ms t0altnxf tadfptrli s t)srxoxmpno1amte ivi t  2uaxmpot1aeeo feiasfa emuvpn(0arxomo3totlaD luvol(0 rtmimpno4am e iet t) 2raumoot1tltnmo3ilsfaDemuvonu)trxoxo3oodlpte i i;(  eurxopoydlp emicsa(  Durxrpnt4oexoiiciatfs emuvp;(0tltrmr iodlm rai i;(0t2toxr3nodom n ivt () rrr(r no0aleomoeildfs2em(vpn(4tlenmociytlpDr u ils)s2xrxm3iy1ol emneilt sDumxr nu4ole mf3iad s emuvs;t)artrmo iadlp e neilt0t2xmxopou1lp  mivsa(farumxmpnt4altomocias s2ra( snu0trtoirciy1oa e u sl()t2umimpou4olenmicsl( sDrmxrono1opt  f3iad m uan p;u0teenmo3todfpteaueolt teurxo nodoltnmnviasf Duaum ;o4tet  ociadlaDrlnvs ()teenifcoa1fp elivsl(0srxrimpou4apen fct s)aDumxroot1olt iictydls2eanms;u4teenmo3oydoatrlivols0sexmio3oy1al nliciatf 2uaxr ;t1tpen ictls aDraump u4 etoircia1lp eai s;s0s2xm(o ny1apt miesltf 2trxr ot0aeeomieildls2rlnvo;(0 etrio3oa1fp rlu i ()texoim3oudlm   iei s s2trx ooo4aeeomociyd s ua( p t0trxrmfctotfmteanvs;()t2xmir oodll elieils a2rmur ;u1aleo feilsls2ul( snt)aeenmf3oytfp elnes (0 etrxo3nudllenmfvi sf rrr(ro;t1tlenioeiydfa ra( onu4aexnio oytfa   uvi;( trtrxo3oodamtn fcia(faDuauronu0olx  octldlsDrau p;t4 lxrmo3totfat lues;t trtr(r3nu4lmtnlfvilt) Drr(r ;u1apxn fciydla elumpn(0 eeoxo iotom e ieo;(  2tr(r3oy1llenlicsa( s2trxrono0aeeomoctatla2emnmp;(4trermo3io1laD lnes s s2tm(m iy4lle mici t) Dtm(m nu1opxoio3tld m eauvs;u) renxf oa1fpt ai o s)srxm(mpnu4om e fvs sfsDum(  ot4aexo ietldfaDra(msnu4artnxo tadfmDeanvols)srtmxo3nodlmen nvsl() 2rrxroou1tlto o3ilt m ulnvs;t4tleomo3tytfaDraivi;s)trxriopiu4om elictat)aDtax p;u0tptnioeiysfaDua( o t4trtnircoy1fp raneols trxoimpnydlpen ivsas)srur(r ;u4tex mf3iytfa2um(mp u4aeeomocia1lptrlueil() ruoxopiu4ome  fvsa( sDtru p;o0oexnmo3iltlm uanmp;(4altnxf3iytfatraneolt)s2xoxo oo1alt mnesas) 2raur oo1oetn ocild m ean s;(0tleomr oydfmtr n s ()s2uoimpno1apen fcilsfa2uaum ot1opt mfeilsfm2rluvpnt)altnxr3tytomteluvs t0s2um(o oy1opt lictlsfsrur(m ;u0aeen o3iyslm rmumo (4altnir iodfa elues t0setrxo io1op nlfcsat srtr( p;u0apxn o3iatfm2em(vp ()trxnif3oatoaD aieo t0trxm(r3nu1lpe lfcsls)s2rrum ;o0texo i3iatls2ra(vs;u4 ltnircoy1oaD ai slt0 etrxo3io4amtn nct s)a2uaum nt0aex iieias a rmump t0 eermf ty1faDrauvolt) 2urxr3iu1lmtelfet ()a2tmu  nt4alxo f3tldfs2ea( ont)artnif3tadoateaivi ( s2umim3oo1olte ivsl(fa2trumpnt4oetn oeilt mDemn onu4aeermfciy1oa r ivi;(0srtmim3nudope mfvi () 2rmx o;t0aex if3iyt mDean s (4tlxnmrciatop ran s;()s2toxrpoydame micias)aDtmxroot1ole ifetadls2rl( p ()aleniociatlmDe uvilt0sruo(r3oy4lltnmiciat)sDraxmo;o4tlxnmi3tasfa raumo u0 ltrxo3iodomteai s;() euoio oodoltemivi t aDua( onu0optoiociasfm um(vp t4aetrmr3tydfmD lueols)setmxo nodalenliesa( sDra(  ;u0apx ioeiaslmDrlnmo;u0tltnmo iydop  lu i (0t2xr(m3iudame  nvia( aDrrur ;t0altn fetatlaDulu onu4 rtoxrctadfaD ai s;s) euo(rpno1alenlnvt t) Drru ono1aeto oeilt mDumnvonu)altoio3oytomDelu ilt0setmio iudam nlicsl( srta( oou1opx  ocild mDranvpnt4arenxocty1lpDraies;s)s2uoxr3oo1lmee ietas sDumumo;o4opeomfcildfs emnvp;(0trenxocoodomtranei;t seuo(m3nydll elfesl(f 2ua(mont0aex ioeilt mDra(mpnu)tlenmr iy1fa rlnvi;s  etmirpiydale lnet s sDrrumono1tetnifciytlm ra( ont0arerxocoo1fmt ln slt0t2uo(r oy1lle  ivtltfartaxmpnt0tpx  ietad m ran p;u0 exnxr oa1oaDrai o;t)trxoimpno4lm n fvia()a2umurono1olxomoetytlm2um(vs;t) leoir ootfmtr iei s texmxo oy4ol nlnctatf rtrx pnu4optnioeiadls rmuvo;u4trerxocty1oaDeaivilt t2tmxm iy4lleelivt sfartm(  ou1apxomf3ilt a uanmo;t)aeeoxo ty1lm e ies;t)trtrimpiy1omtelnctlt  rrr(mpou4altniieilsla rmums;u4 lxriocoodlm e nes;() 2ur(o3oy1ameemfes (fs2raxm ;t0oeenifetls m rmuvo t)aetomfciotfm   n o;()s2uoxr3nodlmt  ict (f rtrurooo1oltn fctydlsDemuvo;(4arxnircoo1laD auvs;()s2xoxm iy4am nmnvil()aruax  ;t1aet mictytlmDem(ms;u4 lxoio tydom  li s;( srxoir3iy4lptnmiviat)srtmum oo1tlto feiasla2ul( o;t4 etnmrctodfmDraneil( t2umio3nu4olenlfetl( s2rrxr nu1aetnioctadfa2eln o t0aeeoio io1la  aies (0s2ur(opno1op elfcil()aDtrumoot4olxomo3tls m2rl(vs;(0 eerxr tydfa e nvs;( sruoxo3oydole  ivt s a2ta( p;u1tleomf3ilslm uaumpnu) reomfcoo1lm e nes t)sexm(o io4oltnmieils srrau ooo1teto i3iadlaDul(vsnu4trxnmr to1omtr i sls0s2trxopiu1llte fcilt)s2tmxro;u1opeo ietyt m2ra(vp (4tltoio iadfpD  uvsls0 2ur(o nudamtnlicta(f rtmxrp;o1teenifeiaslsDrl(vp;(0 lxoxf3iy1fpDrlueo s)teuoxr3no4omtnmivtl( s2tr(r ;t1opxomi3tydfm eau s t4tlermr3tytfaDeliei s)srxrxr oy1lmeelnvsat sruaxmo;o0tle  oeilsls2ulnvp;(4 eeoio oodla e ivo;s)srtrxopiu1omte nei t aDum( p;u0ole ioetatls2rmnmsnu0 rtomf tydfa eli i s) etrio3oy1ap  mict t)aDrmxrpnt1olxo fcilsls um(ms;u)tetoif3tadlmteln s;t)srxrir oydaptelfetat artrxmoou1tpxomoetld mDea( ont)tlxnxociydfm eluvsls) euo(r3iu1ol  lfes tf 2tm(m ou4olx  iciat m um(ms t4 eenif3tytlp rai o;t)sexrir no4apt mies ()srtmu  oo1tle mfciaslm elu p;(0texoxfctydoat auvils0sexr(r nudopte ncsa()sDumxmo;o1tpx ioetldfm2ra( s u4 lermr iatlm  ln o;t0trxr(o oo4altemics ( a2rm(ro;o4tltnii3iadlm raumsnu0 rxnir3totoaDe ueo s s2ur(opnudolenlfvsls srtm(monu0ale ifeiasfmDeluvp t0trxrxo iatom rluvs (  2xm(mpio4ll nlfetltfsrtau pnu1apenioeiydfs2emu p u0 rtrirciydlmt ai sl()trxoxmpny1ap e ivtl( arrr(rp;t1teenmoetas m em( o (0 exrioctadoaDrauvils0t2umim3nydop emncs t)srtrx o;t4tleomocilsfs uluvonu0arxoio oodomteln s;s  2tm(o iodlltnlnctlt s2trx  nu1oltn iciydfa emu s t4aexnxr3oatfmt aueo s0s2urirpno1llt  nes t s2rrx  ;u0tet ifctls sDuanvsn(4 rtomf oadfptrlnvi s) etmio oy1op  lnviat s2raumoou0aetnmfeiasfa eau p (0tltrxr totopteln i t)tetrimpny4ol nlncil(fsDtrx pou4olx if3ias a ran p ()altrifctytlat  nvi;s0s2xm(m3io4altnlfeil(  ruaxmoot0alt  i3iysfaDea( s (4 etrxf oodom  au i;() rtrxm3oodop  lncslt)s2rr(rp;t4apxn i3ilsfa2rl( s;u4teenxr ta1optrlu il(0t2um(rpio4lm nlnes s)artr(monu1opxoioeiasfa2uanvpnt)aexrmocoodlmDr uvs (0 etmio3iydalenlnes t) ruax o;u0tlxnmicild sDemnvo t4artrir3iodfmDrauvs ( tetoxo3oo4amtnmivt t)srum(ro;u0tptniietldlm rmn p u) exoxo tydfmDraivi;(0 2tmimpoo4lpenmnvtlsfa2rmx  ;o0oltniietysla ra(vo;u0 etoxr ootlmDe u o t0 2toio ou4llt mfciasf rrruro;u1open o3iys m rm( o (4tetrir3ta1omt lu ols)t2trxmpnu4lmt  fvslt a2urumpno4aee io3ildfm ranvo (4 rxomo3tatfaDeaiei;t seuoir oydllenlfviatfsDrrxm nu0ape ifeiyd sDrlnmp t0 lxrio3totfpDe u o () rxrxr iydam n feilt srtmum ou1tetomiciyslm ulums u4altnmo oy1fm rli ol()t2xr(r3oodole mfvtat  Durxm ;t0oexn o3tldfa2umn p;()aexrxr oy1faD livs s0t2xo(opno4amtnliei t  rtm(  nu4tpxnifciasfs ulnmo;(0trxnxfciadoa eai ols s2xmio3nu1ome lfctl( sDrrur ;o0tlxnifciatlm rmu pn(4trxnxfcty1faDeaueol(0texrim3iy1om   fetlt)s2tru ont1tlxo octad sDrmnmp;t4aeeoxf3io1op  aieol( srxmxm oudole lies tfa2umum nt4alxniociyd s ulumo t0artoirciytfa  auesl(  exmim iy4lp emncias s2tm(rono4tptn fcilsfmDrmumo t0 rtomr3oatfaDeai s s0teuoirpnodoltnmfvsls)aDurxrp;t0alx mi3tydfa2ea( p t0arenxo3to1lpDe uvo (0seur(r3io4lp n nvil(fs2tm( poo4oltomo3iytlsDraumsnt4 lxrxf3ta1omD  u o;s)trxrxo iy1omtn fciasfa2ur(rpnu4oetoioetyd sDel( onu4 etnxo to1lmDrauvo;s teurimpno1lp  lfvs s arrm(mpnu4oeenii3iltlmDrm(msnu0 exomr tatlm eaivsls0s2umimpno4llenlfcils arur( o;u0opt mf3iyd mDrau s u4texomo oodlpD lnvo s)teuoxmpiu1ape mietat)aDuax ono4tlxoio3iysfm2emu s;(4 leomr3iy1fptrln o;()trtmio iodlltelneiasfsDumx  nu4tptoifcildfs2rluvs () etnxocia1lmtrliei;(  2xmirpiudomtnliei sfs2urumoot1aexomf3ilt m2rluvs;()arermf tytomtr uvol()sexr(r3iy4oltemivtas  Dumxrooo0oeen ieiyt s uln p;t4 exrif oo1lp e nei s) euoir3ny4optn ivi sfa2ra(  ;t4tpto oeilt s el( ont4aeeomr iotoaDrau i;s0t2xmir3oy1ll emncsa(fs2rax  nu1oltnioeiysfs2elnms ()alxoxr3ta1lmtelueolt  2trimpnu1lm e fvsltf 2tr( oot4tex ii3tasfm2rl(ms u0arxnircoy1omDe ies s)seur(r3oy1ap emict ( a2umu  ;t1oleomi3iasfmDeanvsnt)tetnircta1fat  n s;s)srxmxm3nydalenmfei sfarrr(m ;o0aet mo3tadls2ul(mont0texnxr to1lmD  nvs;s0sexmim3oodomtemiesa( srumu oot4aee mocildlmDranvs;t4aeerxo3tatlpt anes;s t2uoxr nodale  ivsa()s2tmxr nu1tpxoif3ils aDeluvp t) eeoxf oytoa r ieo;( srtoio iudom nlfes (fa2tau p;u1apt  ieiatlsDumnvon()teerio3ootlaDelivi s srto(o3io1optemfet (  Duax pot4oltomietatls2el(vs t0 exomo iadoatraneo;t  eumxr3no4lptnmivi sfs2tm(r nt0alen ieiydls ranvo;t)areomo oadomD lnei;() exr(o3iy4apt lies s)aruaxm ou4tlx ii3ils m2uauvsnu)alxoirciydfptrlieslt t2tr(r3nydop emfei s)sDururoot4alxomietls a uluvp;(0 rtoif3oydfmD luvs (0seuoxmpio4lpeelivia(  rrau pou1alxnioeiyslaDul( o;()tlenxrcto1lpDr uei;t0trtm(rpnydap emiesa(f Dtm(monu0altoii3tatlmDuluvsn(4 lenmocia1fmt  n ils)tetm(opou1ame mnesl() rrm(  nu4ale io3iatfsDeln s u4tlxnio io1oateluvo ()sruoirpiydaleemfvi tfsDua(rpno0apt iieils m elumsnt)alxnxfciotfm  ln s;()s2tmiopiy4op n nvilt)sDtm(mo;o1teeo ieiad m emu pnt4aexnif3ty1opDrauvs t srxmio3iy4apen feiatf 2ua(  nu4teeoioetadfa rlnvp;u4tlenmr ty1omtrlnvo ( s2tm(o ou4ol  livtltfsDrr(  oo4opt mieias m2emu p t4 ltnxfcoytoa  livs;s)t2xm(r3nodlm e ivsls  ruau pnt1tle ii3tad a2eaumo u4 eenmf tatoateaieslt0trtmio oydapen nvs s) rtruroot1oleo f3iat m ranvs (0trermo oytfpDelu o;( srxm(m io1apenmnvsa(fs2tm(r ;u1altomicils m2umn o;(0areoio3iatlmt  ieo t t2xm(r ny1openmieias) rta( p;t4oltn f3ias sDrlu pnu0alenxfctydfmteluei t0t2xm(mpou4aleeliesls) rumu  ot0olxnio3tadls elnmonu0 rerxr3oatfp eli slt)s2uoio3oo4ame  ncsa() 2uaur ou1tleomo3iadlm2eluvs;u) etoir3oadlaD ln s;() 2urir iydam nmnetasfs2uaurpou4tpx ioeiysfa rl( pnu0arxnifcoodlp eli s () exrio3iydale  fei ( a2tr(r ;t4oleomieiaslm2rau s u4 etnmo3oadlm   ies;s)srum(m3nudam nmnciat s2um(m no0tpt mfeiat s el( snt)aetnxf3oadlpteaivol()trtr(r oodlltn fetl(f rumxront0tpe  ociysfaDrm(vp (0 lerio3ootfatelueils) euoxrpnu4ale mict s)aDrrump;o4teenii3tltfm2umn o;(4 renmf iy1lpt aueo;(  2tm(mpoy1lleelivt sfarra(m ;t0apeo f3ias m em( o;t4 rtoxr tydlaDe ueslt setoir ny1lme mnvsas)s2ua(rooo1tpx  fciatlsDuaumon(0 rxoxo3iy1om  aueo;t tetr(o3io1alenmfes t) 2trxmp;u1oex  ociaslaDrmn pnu0 rtrmo todfmD auvo;s0s2uo(o ou1omtnlfctas)arra(mont4ope mfciltfm rlu o u0 lxrioctodopt lueo (0 rxmimpny1optelnvi ()a2raxr ou1tex  oeilt aDem( p () etrxrcio1lmt lieilt)seuoxm io4al   fvtl(faDraxrpno0aetnmfeild m rau pnu0aetrmf to1omt  ivslt)teuoio iodaleelietlt sDtmu  ;o1olxomfctlsfa2eluvs t4texomo3oy1fpt lnvi;s srtrxo ny1lmeemiesa(faruaxmpnu4teenmoeiad s2rl(vo;(4artrif3tydfmDe uvs (  rtr(m3iydopenmieiltfarrrum ;u0teen ieilsfmDrlu p t4aleoio tatfpt  iei t trtoio iydal elnvias) rrrur ou0apenif3tlt s2rmumpnt) ltomfctodfp   ueo;s) rtoir ou1omen fvilt sDta(moou1opxomiciyd aDrlump;(0 etnmf todlm e u s s t2xmxmpiudlltn fcsls  rrr(r ;o4texnmociydfmDrmnmonu0trenxrcio1om   ues;s)srtmirpoy4lmte feil()srrrx  ou4oexomf3iasfsDeln pnt0 etrio ia1fmDeau slt0srxoir3nu1lmteliet (fsDrr( o;t1olx  oeiad mDumnvo u4 lenmr3oatoate uvo s) rxoxo3no4ol n fct t a2rax ooo4oetn ietydfa2eaump;(4aetrio3oydomtrlueils0 2urxm iy4opeelietl()a2ra( ono0tetoiociad mDrmu pnt0altoif ia1opt  ivi;t)sexoxrpoy4al n iet tf Durumono4aeeo i3iadfm uan o;u4teeomocoatlm  livslt)setoxo3nudol  mieilt)arta(rp;u4aetomf3ils mDua(mon(4 renif3ia1fp   neols)seuo(r nu1ll e ietlt  2umxmpot1aetomo3tytfaDea(vs;t4 rtnif3iadlp eaues;(  eur(o oy1apt mnvsa( srtax pno0openmoeiltlmDra(vp;u)trtrio iotlat aivilt0 rtrxr no4lm nmiei (farta(  oo4tlenio3tyd sDua(mpnu) exoxrcoy1oa e nesls0trxoim oodolenlfei ()arumxront0tlt mi3iytfs uln onu4tlxrmo tytoaDrlivol( seto(o3no4lpe  fvil()s2tm(mo;t1tpto fetatla umums;u4arxomrciodlaDe neilt)s2uoxopno1lme livs ()a2ta(mpno4ope moeiatlm rln p;(4teenmr oatomtraueo s)srtoxr no4lpen ivtlt) 2ur(  oo1ape io3iaslmDuanms t0tleomf iodla elneilt0 2xr(mpio4ap  licslt sDumu p;t1aptomfctlt s elu o ()tetnifciydop elueslt0sexoxopnudlmt mictatf rrmxm ;t0aee mo3iysfmDrmu p;(4 rtoif3totfaDeanvil(0 2xoxrpoo4omtn ics ()s2ta(mont1tpx ifeildls2el(mo;u0arxomfciytomtelu s;s s2umxrpno1lme lics ( a2rr(m ;o1olenmictls s uauvs (0 eerir oy1omD livs;s0sruo(opiydal elfcia( sDrr(mp;t4aexnmoctytfaDra(vo;u4 reoio to1fmDeluvi s) exrxr3nydll   iciatfsDtrx  nu0oltnifciatls2emn pnt)trxrmrcoydopDr u sl(0t2uo(r io1lmeemivtat)a2tru pno1olt mi3tydfaDrl( o u)arxrioctydop elueolt t2tmxo nodoltnmiet t  2rrur ;t0teeniieiatlm ea(msnu0 lenircoy1fm elneol(0 2xrir no1omenmieta(  rrau  ;t1tltn i3iasfm2ua(monu) etnxr totomD ai ilt0 2xoir3ny4apenlfetl(f Drrx o;u0aexnii3tydlm eauvsnu4tetoxrciodfpDeluvs (0 rxo(opny4lme lictatf Durx  nu4open octadlmDemn s;(0 ltrmo iatop rai s (  etm(m oydomenmivt tfs2rrx p;u4olx moeiadfm el(mpnt)trtrmrctydfa  ai o;t0seumio ou4altelfctat  rtrum ;t4apto octysfaDean s (4aetoxociy1fat li ols)srxmxmpnudlp nmncs s a2rmxm ;o4tle io3iyd a2ea( o;u4trenxr3ty1lpDe nvi;s)tetoxr3oy1lp  lnct t) Drmu  ;u4opeoiociytlm umnmsnt4 ltomfciatlp ranvslt  2xrio ny4altelivtlsf 2rrum ou0tee mf3iytfm2uau o u0 lxnif oa1lmtrlivs;t)t2uoxopny4ol nlnet ( a2taurpnt1opxoifeiatlmDum(mp;t)aexrmr3ty1fatrlieo (  exrxmpio4lpt mnetls) Duaur oo0aet miciad mDum(vo t4 lxoxf iy1fpD luvs s) 2tmxm iu4omtnmfesls)a2tmxm ;u1openiociad s um( s;(4 lerxo oo1om e neols0 euo(rpoy1lmt lietls) 2rru oot4oeenifetad mDeanvs;(4aleoif3todom raneslt)setoxr3iydomt lnvia() 2ra( pou4opeo i3iltfs rlnmp;u0 etoxf3totlpt lu o ()sexrxrpnu1am n nvs s s2trxr no0tpe ii3iysfaDrluvon()arxnir oy1oat an sl(0trtr(m iu1om elfci t) rrr(mono4tpxoiieiydfm2ra(vs t)alxrxf3tydlpDe ueols)tetr(m3iu1amenmici s s2umur no0ole mocildlsDelnvs;u0tlxrxf ootfpt anes;t0 etrxm3nodllt  fcils  Dtrurp;u0openiociyslm2rm( o u) rtrmocoa1lmDe ivo;t0seurxmpou4amt lfetlsf rua(rp;t4opxomf3iad aDelnvp;t4tltrircto1op  livolt t2uoxr3oydopt lfci s srrau pno0teenifciatla2rluvsnt) lxrmoctadlp r ies s0 rxm(m3oo4lp   fvtlt  Dur( ooo1tpxnio3iaslm emuvonu4artnxr todfm   ies (0sruoxopoudop  lncils s2ta(root4tpe ii3ilsfs ulump;t0 rtrio3ia1fa eaivi t setmxo oo4om n fvsat  Dumurpnu0oex  i3iytfa ra(msnt0aeerxo oa1faD li ols0 2tmiopny4al   nctl()arum(rooo0ale  ieildfa2uan o u0 ltrxo3to1omDr nvols setoimpny4olenmivi t)a2ta(m oo4ole if3iysfm ulumo t0tetoxo iotlpD luei;( trxoir3ny1alenlncslsfs2rrxr ot1opxomfciytls ra( p;(0tetriocoa1fp raivs;( sruoir io1ome lictls a2trxr nu1tltn octas a em( s u4 reriocty1fa   ies;t tetmir3iodll e fesltfsrurxmpot1apxnio3iytls uluvon(4 lxoiocia1faDe ivo (  etoim nu4op elivs s) Dua(ro;o1optnmieilt aDrl(mpnu0 ltrxr3oytfat an olt0srto(opny4lm nlfcilt  Dtm(r no4altnii3iydlm elu p;(4treomfcoytfmteauvs s  2xmxm3ou4op e ncta(  Dtrurp;t4texnioeilslmDea(ms;(4aleomrcootlp  anvs (  rtoxmpnu4alt mnvsatfa2rrxr ;t4opeo fciatlmDrlumpn(0alxrxo oa1lat  n s;t  eto(o nu1lptemivs ( arurxr nt4tptomi3tls a eluvs;t0aetomf3iadopteln s;t tetrimpnydllenlfetlsfartmumonu0tpt if3tytla2emuvo t)tleriocoytfm  lneils s2urir iu1amtelfesat)srraurpno0tee mf3ilt s ra(vo t0arxomr iydlp eauvols)s2trim3oudaleemncsas aDtaumpno4alenmf3ias s ranvs;t0texrio tatoaD li i;s0 etoxr iu1ome  fctl( s2trx o;t1tpto i3iydfs ra(vo (4altomrciodoatrlnvs s0 2uo(r iu4amt  iviasfarrmurpou1aeeomfeiydlm emn p;u4teerir3oydlpD anvilt0seuoiopoodlpeelnvsls)aDrm( oot0aexo ociadfm ua(vo;u4alxnxf3oy1lpteauvi ()srxr(rpnudol  mnes s) Dtaumonu1tltn oetld m um(ms;t0 rxoxo oa1oaDran slt0setrxr3nu4lmee nvtatfarrm(r ;t1aleomoeiltls ul(mpnu0 ltnxf oodlpDeli o s)t2xmim iudal emici tfa2umxrp;t1tpe  ieildls2rmnvs;t0 rerif ta1fp  aues;s0 exr(o iodamee netlt) Dtr( pot0tptomietydfa2umuvs;()teenio3iydoa  lneo;t0s2toxopio1lle mivs (  rtr(r oo1tpt  ociytlm emuvo u4 rtnif oytoptr ivolt)trum(r3io4aleemivsa(fs2ua(ro;u0tlt mieiytfaDuln s t) rerxf ootlpt auvo;t  exm(r nu4om   icils)arua(  ot0aetnifeiytfm rmnmont4tltoir io1lp  aieilt)srtmir oy1lmt miciltf rtrxrpou0aeenmo3tys s rln sn()alxoxo iadoa eaivi s) exmxo nu1apt mfetlsfaDtrumoou0altoii3ilt aDulump u)aexoif iy1opDelnes;t tetmxmpou1lpt mivt (  Dumx p;t4tpxomo3ildfaDra( pnt) rtomfcoodfa rlu i s)t2um(mpoydll nmnvsasfs2umx p;t1texo feiydla emnvont4areomfcta1fmDelu i () exm(o oudamtnmncs (  2tru p;u1tlxn f3ils aDra(monu) rtrio3iydfat  neil(0setrirpiydlpeemnviatfaDrax o;t4alx iictaslm rm( snu) lxnxfcoa1opDraues s0 eto(r3iu1omtnlnetltf rururpnu4tlenifeiydlsDra(vsn() rtrmf iy1fm rlu ils0trur(o oydlm e ivslt)sruaxrono1oet miciaslsDran ont0altnifcoy1omD  u s s)truoxm nydapt  fvs s) 2ta(  ;t0teto feiadlmDeanvo;()trxoxfciotomDr u ols  ruoxo ny1oltelnci s  2ur(mono4altnif3tatfm rmu pn(4artnmfciy1lm elieil(  2xrxm ou4lle mnetltf rurxrooo4apx mfetasfm2ea(msnu4tlerirciatlaD  nvs ( t2xrir iy1am n nesas s2taxmono1apx mfciltlsDul( on(0trxnxfcoo1fatrai s;s)trumxo ou4lptnmietas)srumxr ;u0tpt moctydls uan s;u4 rxnmf3oa1opD aueilt0setrio no4op n nvtlsf 2tm(ro;u0aetniieiydfm el( s;u4 rxrmr iodfp rliesls0s2tm(m3iu1om   feiasfa2umx  ou0tpe  i3iytls ulnmo;u4 exnio3iy1op  ln s;s  rxoimpiodap elictat) rtaxmpoo1tet  iciltfs umump u) eermr3iotomt  ueols0texrxr nydamtnlfeiltfs2um(r ot0alxomo3iydfa ulnvpnu0alermocoydop eaieols)srumxopiu4amee fvt (fsDrm(rpou4oexomieiat m2raumo t4 rtnxf3tadfp  luesl() rtoxo oy4lmen netasfartaxront1aetomiciysfm2emuvsnt4 ltrif io1lpt au il() 2um(r oo1ape  feils  2tmxmpno4optn i3ilt aDem( o;(0 etrif3iy1fm e i ilt) 2trxr3iu1olee nct s sDuru  nt1tltnii3iatfmDrmumpn(4 etomf3oa1laDeln i;s0t2trxo3nodal emnvtls)sDum(  nt4alxo fciatfmDumn pnt0arxnir3tatlpDelivi s)s2xo(opoo1al emfeia(fartmx p;u0tptnmf3tldfm2eln pn(4aetomf3oa1lat livi s sruoiopiu1amen nvt t)aDtm(mo;t0apt  oeiad m eaums;(0 lenio3oadoa e nvo;t trxoir3no1lme lfctlt)a2ra(  ;u1oeen fciasfm2ul(ms u4tlxrmo tytfmDrlivslt  rxr(o3oudal nmivtat)srta( o;u0oeenio3tasfs ean p (4artoir ootfmDrai i;( texmxmpoy4lp  licia(f 2umxm oo1tpto fetldfm2uau p;u4areoio todom r n il() etmxr3nydome mfci s aDrauronu1tlto i3iaslaDum( s;t0 exrmf3iy1omDeluvo;s0sexoim nudamenlfet (fartaumoou4oexnmi3ilsfm uan s;t0tetrmf3tatoat anvi t) eurxopiodoleemietls s2urx ont0aexo oetlsls ra( p t)texnmf tatop   nvi;s)trtrirpiodamen ieils)s2rmxm nt1optomoctyd aDrm( snt)arerif3iydoaDr ues;s setmxmpny4opeelnctas s2um(mo;o4oet  fciydfsDrlnvp;t) lxnxrciodlmte i sls)t2to(r nydam nlict s)aDum(r oo0apxn iciysla umnvp;u4 exrxf3iodlmtr nvs;s)trtoiopnodop  livtasfaDua(mooo1apenmicild m ul(vo;(4tetrir ia1fa rli s;()srtoirpoy4om  miviltf ruax o;u4opt  fetldfm ulnvo u) exnxrctydlateaneols) eurir nu1lmen nciltfsrur(rono1texnifcilsfa2rmnvont4tetnmr iy1lp eauvsls  rtr(mpoodaptnlfviat) Drmxmo;t4oleomoctas mDuau p t0trxoxo iadopDr uvilt srum(m3oudam  mnesl( sDtmxmpnu1aetnio3tadfs2rl(mp;t4 lerir3iodlpDrln s t t2umiopio1om elfctl()aDuaxm ot1texoii3ias s ulnvont4tlenxo3iydop rauvi;t  exoirpoodome lfvsat)sruaxmont0tleomociys m2ulumsn()trxnir3iadfpDelivi ( s2urxmpiydom  mici tfaDrru p;t1oexomf3tltfs2rmums;t)alxnmrciadfm r ivo;( trto(o3io4lmenmfcilt srurx onu4ale iociasls ua(msn(0 rtnirctydfm  an ils0s2xm(o nydlp   iet (fs2ta( pot1olxoif3ildfmDea(msnt) leoif oatfaDelneo (0 etrirpio4omeemfciat srtrxmo;o0opt ioctad a rln p;u) lenxociatoa rln o;s)srtmxopoo1lp  lfvslt  rtaxmpno4oetnmo3iat a elu o t)tetrirctotla eanvols) 2urir oudllt  nvtls srtmxrpot0aet  ociysla2ea( p;(0trxnmo3totlp   ieilt) rxoim nu4lmtn netlt)arrrxmpnt0aeeo fcils a ua( s u4trerio tytopDeaiei;t tetrim3iudlmenmnesas) 2rmxmpnu1tlxn ociltfa ul( p;t)tlxrxr3iydfpt luvi;()t2xoio nodlm nlfeta() 2umu  nu0aexn o3iyt m2uanms;t0 ltnmoctodlateanes;s teto(o iy4ope mfvtlsfa2tmx onu0tle mfctadls2ranvs;u)tetoif3ty1fptrauvi;t)srumirpiudol  liet ()s2taumpno0optoii3iydla2ea(vs (4tltnxocto1fate n o;t) exoim3iu1am n fesatfaDtr(mono0aeenmfeiysls em(vp;t0 ltnxrcoa1fpte u o t0srum(r3iu1oltn ietl()a2umu pot0teeomiciltls elumsnt4arxnmf3tatopD  i s;( t2xoxopoydope lnvs s s2ra(m oo0olx mociadfa em(vpn()altrmo3to1opt ai s ( srxrirpou4al emnvils)aDum(ro;u0tlto o3tydlm2el(mpnu0aexnmr3totlaD li o;(0srxrxm3oydolenlneiatfsrrrxr ;u4apt mociltls2rlnvp u) eerif3tytfpt aivo;s) 2uo(mpoo4ole  ieil(fsDumu onu0tlt mi3iyslmDrmu s;(0texrmo3iytop  aneslt  rxmim no1om e net sf 2raxmooo4tet mf3tltfs uan p t0 lxoio3ootlp eau o;s)trtm(opoo1ope  icsatfartru onu0ale  feilslm2ua(vo t0 lerirciadlpD lneo s teto(mpoodlmen ieiasf Dum(rpou0oeeomi3tlsfa2elumpnt4 eerircto1fat  n il(0 rtoirpnodap  mncsltfa2tru pnt4tetomoeiltlaDuanmsn(0trerif3iotlpD  ivs s)srxmimpnydomt liesltfa2rau ont1tlx ifeiydfa umnvo;(4aetnmrctydlat aivi t sexmxmpiudamte fcia( artaurp;u0tle miciad aDua(ms u4tleomoctytfptelu i ()srumiopny1amtn nctas)a2tru pou4alx moeiadls2uauvpn(4aeenmf3oy1omtr ies;(  rtm(o no1om  mfei sfaDrmumoou0alx ifeiat s2uluvo;(4 lxnmo tatlm e uesls)s2umirpoy4am nliet sfartmumonu4tle mfeiydlaDelnmp;(4 etrxf3ty1fmteli i s) rxr(m3iudlmenlnes ()srtmu oou0apeo i3iad s ua(mpnu4arxrio3oadom  aivs;t teumiopnu1lleemictlt) 2taur nu1oex  oeiydfsDrmnvs;u4 rxrxr oodfpD  nvo;t0t2xmxr oydoltnlfcsls s2umxrpnt0oee  fciydla rmn snu0tlenmr oo1la eaivs (0texo(r nudlpe  fcta(f 2urx ono4ape ii3tydfm2rlnmpnt) exnxrcoa1fp eln o (0tetrxo oo1llenlncilt)arum(m ;t1tle if3iasfa rlums;(0 eermociatfa rauvolt0seumxopnudop n ietlt)a2rau pnt4opxnmiciytla2eluvp;(0aexrir3ia1opte i o;t truoxo3oo1am e fviat  rtrur ;t0oetomfeils mDua(vo;(0trxomrcoadlateaues;s) rxoim nu4lmte nes sfs2tr(m ou0alx mieilsfm2ra(vont4tetrxrcto1fpte nvo;s) eurxo3iu4amee nci sfaDua(r nu1aetn fctydlsDranvsn(0arxrmf oo1fa elnvo;t  2tmim iydaptnmfcta()sDrmu  nt0tle iieiatla2eaums (0trtriocty1lpD anvo;(0t2umio3ny1om elneiat  Dtaxmp;u0opxn ietydlm2eluvp;(0tlxrmo oodlp rln sls0 etrxm3iodapeemfeias  2ta(  oo0tptoii3iasfa2rl(ms (0tlenmrctytomtrau o;s) 2xmirpiydapt  neslt sruaumo;o1tlxoifciasla2ul(vo;u0aexrxf3oodfmte n s;(0sruoiopno4lltn ivsl(fs2urx o;u1opxoif3iydla rlnvpnt4treomrciadfp   n o t truoim3io1lmtnlfctat artmu p;o1tptnmi3ildla2umn snt0 rtoir tytfaDelivsls0teur(rpny1lpen icias  2rrx  nu0tptnio3tys sDeluvsnt) rtrxf ia1fate u i;s teurio iodome  fes (f 2urxrp;t1oet  oetyt a elu pnu)tlxrif to1fmtrlnei (  rtoxm nudaltnmietatf rtmxroot1aet if3iytfm eanvs;(0tetrifcio1om eau s;t  rum(m no1oleemfcia( aDtrum ot0tetoifctat a rm( p;(4trxrxf3oo1omDr ivi ( trtoio3oo4lpeelnctls aDtax ont4oee iiciad a2ua( p t4areoio3oo1lm elivs;(0trurxrpiodape  fes s) 2raurpot1tex  f3iasfmDumnmpn()alxrmoctydla eauvi (0t2ur(opnudlme mnes s arum(moot4teenmoetadfs ulumonu4artrxfctydlp eaivi;t0 rxmxo iy4op n iesl()aDurum ;o1oexomo3tasla ranvpnu)texnmrciytlaD  nvs;s t2xoim3iu1om  mfvta(f rtruroou0olxn octydfm rm(mp t) rermr3tatomDeau o s)tetrxmpio1opeelfviatfa2uaum oo0tlx  ictltlmDraumsnt) rxrxoctodoatr ieolt  exoio3iu4ll e nesas sDurxm ot4tlxo octytfsDea( s t4aetomf3iodomDrlneolt s2xo(rpoodlm elicsltfaDum(  nu4tee mf3iltla2ranvp () rxnmr todlpD an o;t0srto(opny1am nmfcsa( aDua(monu0oee moctyd aDumuvo;u4trxnir oa1om   ueo;s trtoir iudale mfctlt sDurxro;u0tltn f3tat a ra(ms;u) exriocia1late ueol(0 2umio no1om emiet () Dra(mono4tpen oeiytfs2umnms;() ltrxo3tadfaDe uesl(0sexmir nudlpeemfvtlsfsDrau pnu1tle moeiadlmDrmu sn(0trerifctodfmD  n s;( seuoim iy1lpenmivsl(f Drax  ;o1oex mo3tyt a2rmnmsn()alxoxrcoodoa ean o;s) 2toio3iy4lltnlnctatfsrum(rp;t0texnioetlslsDelump u0tlxomocta1fmtraieslt t2to(o ou1amee icsas srtmxrpno1tltoifcilt mDrl( s;(4trxrmociodlat  iei t)srxrim oudlpen ncil(faDtr(r ;u4olxniietltfm uluvo;u0 rtriocoatom eauvo;t)setmxm3oy4apenlneslt)srtrxrp;u4openioeiasla2rlnmp;t4 rxrmr3oytfa r i s (0setoimpoo4oltelncsls artmumpnt4opeo o3tltla rl(monu)aleoxo3oadoaD aneilt s2xm(r io1lpee nei s arua(r ou4texo oetysfa2rmump;t0altoif iatfatelieo s0 etmxmpno4lm  livtlt)srtmxrpnt0apenii3iydfmDul( o;(4trtoifctytomte nvi;t0setrir3nu4oltn nvtat  2taumont1tleoiociat a ranvsnu4texnio3iydopt lneo t teuoxo nudlmtnmivi t)aDuru pou1oexn o3tydfm2eln ont0 etnmr3tatlpDe uvols) euo(opnu1ame  fetas) 2uaxmpnt4tpt ioetydlaDumums (4 etomr3oatlmDe i i s)teumir3no4oleelfeiltfsrtmu  nt4oleomf3iytfm uluvs;t4 rtnifcio1op elnvi;s setr(rpno4llenlnes tfsrrax  ot1tptnmoeilslsDua(vpnt)trtoio ia1opt auei;t s2uoxm3io1lpt lfet (  2umu ooo0aleo ictad mDra(vo ()tlenmf ty1laD aueo;s0t2xr(r io4lm  mnvt tfaruaxmpot0tlx io3iadla2rluvo;()trxnif totlm e uvo s) rtrim3oydlm emncta(  Dtmxroou1tpxomoeiyt aDeluvon() renxfcoo1opDrlnesls sexr(rpio1ameemfci () 2uaxm no4openii3iasfm rm(monu0tltnio tadoat livo;s0t2xrimpou1lp emnvsas)s2tr(r oo0tptn fciydfsDrm(mo (4 ltoir totfp elu s t0 etrxmpno4opee iet s artrx ont0olen oetytlsDrlnms (0altnio3oa1opt  n il() eurxm3oy4amt  nviat  Dur(root4olxo i3iatlsDraumpnt0aetrmo3ta1laDeln o t) eumiopnudaltnlnci t  ruaxro;t0apxnmfetydls2rm(ms (4tlxrif3oa1fpt  ieil()srtr(r oy4alen ivta()a2uax p;o1aetniietyd a2rm( s;u4treomf io1fptrauvs;( trurir3oydolee nvsa(  2rrx ooo1tptomfciatfm2um( pnu4altnmf3ty1faDeaneol( texoxo iu1am   fetas)srrrum no4oexnif3iat s2uau on() eerxr oodfmDelu s;(0 exmxo3nudopt lfcia(  rur(r nt4aee  oeiatlm rlump;t4 exoxr3iatfp  ln o;t0 exo(o nudop n ies sfa2rru o;t1tetnmfcildfm ua(vo;t4artoif3ia1omD anvs s  2toiopoo1amt  ieils  Duaur no0opx mfciadfaDumums u) lermo3iotfpD lieslt0trxoxr oydaleemics sfarra(m ot4tet  octatlm eanmo;t0altoir3tytlat  nvsls  2xoxo oydap nmieta(f Drmx o;o1apeo fciys m2ra(ms t4tetnmrcio1optelu i t truo(r3iy4alt mfetls s2tax oot0aeenii3tatfsDem(vp t)aleomr3ty1faD  nvi t0srumir oy4lltelfei sfsDrr( pnu0aptnifcilslmDrlu pn(4 rxomr oydlmDran sls sexrxo nu4amtemfvilt)aDur(r ;u0oex iietys a rau pnt) rxrxf3todopte n i s sexoxo oo4ope  nviasf Drrumonu0ale ifetadla umnvonu) eeomrcta1lp  aneo;t0srumim3nu1ap emiciatf rrmxmo;u4opeomo3iad mDrmuvpn(0tltomf3oo1optelivo;s0sexmxr3nu4ll e nes (  Duru  nu4oetnmf3tltls2rmuvp u0 exomoctatlp rauvo () rxm(rpoo4lm  mnvs ()s2rau pou0apeomictytlsDrluvo;(4 ltrxo3ty1lmDeln ol()s2triopio4ap nlfvtlt  2rmx pou4altn ociatlsDra(msn()aetomo3iodfpDe uesls) 2urxo3no1op nlfct tf Dra(mp;t4oetnmfeiysfm2uln p;t4alxnif3iy1om eauvs;s trumxr ou1om  liesas) rrr(  ;t4aptnmociyd aDel(vs t4tetnxfciytlm   ues ()t2xoxopoo1opee nesa(  Duax  no4oex moeilsfa uaumsn(4areoxr3ia1lmD auvilt0 rxmir no4lmenmics t) Dtm(r nu0alen o3iltls2ra(mp;(4trxrmf oodla eluvolt trxo(r3io1omtnlfet tfsrumurooo4tetnifciaslaDrmnvo ()teenxf iadopteaies;(  2ur(mpoo4ameelfctl(f rrr(r no1aexnmo3iltlmDem(vp;u4arxomfcty1lpDeluvo (0srtoir3iu1lleelnci tfaDum(mont4aetn i3ild mDum( o;()alxomr3io1fp elieilt)trxo(m iy4lm elieiatfartrxmoot0tex  octatfmDeauvon()trxnmrciy1fp ean o;(  2trir3iy4omen ieilt s2um(mpot0optn ictys sDeauvp;t0alxrifcta1fpte n o;t0s2xo(rpny4ap n fei t  2rm(mpno4ape  ociyt sDel(vp;u) exomfcia1oat lu o s0tetoir ny4apt  feilt  Dumuroou0alto icilt sDemums;(0 exrmocoa1omDr i i s  eur(m3no4amteliei tfarur(rooo1tlt iietldla eaum
\ No newline at end of file
@@ -0,0 +1 @@
+nvo (0trxrxopno1lmeemfcta(  rraur ou0oltn ietyslaDrluvo;(4teeoiociy1opD li ilt texmxm no4al   net s) 2tmxro;t4opxoio3tls s uan s (0alxrmrcoy1opt anvs (  2triopoodamen nvtltfa2uau o;t4tetomi3ilslaDeanvpnt0alerifcia1opD  ivs t) 2trimpiudop e fct sfs2umurpoo4tptn ieiydfmDraump;(0tetnxrciotlate ieo;s srtmxopoo4oleelfet ( srtmxrpnt1aeeoifeiltls ulumont0 etrmr3ty1lpDrln o;s0trxmio no1alenlfvslsfsDumum ;o4tpe  i3tldfmDumuvonu) eeoxo3iydopDeaivs;(  etm(m3oo4omtnlici t)arum(  no0tle ii3tytfm ul( o;u4 lxnir3tydlm   uei;t)srxoim nudlpe lies t) rtr(mpnt1tlt  ocilsfm2eau o;(0 lenmo tatopDe u ilt srxmxm iy4lpt lnet s  rtr(mo;u4alto oeiad a2umumsnu0arenifctotop raieslt)t2trimpiy4lmen icils  rtrxm ;u4apxn o3iysla rln p;u) rxrmo iytomtrlneils)seumirpnudoleemfct (f rua(rp;o1ape miciydfsDumumon()tetoioctotlm r i il()s2urxo oo4op nmivsa() rtm(m ;t0tpeniociltlm2umu pnt4 rxnio ia1fa  lneol(0 2urirpiudal  miet sfs2umx o;u0oetoiictldfsDrmnmp t)arxoifcoydoaD an o;(0sruoio3oy1lm elivs (f 2uau ont0opeo icilsfmDrm(mpn(4altrif oatlp   uvsl(0setmimpoudape licta(  Dumx poo1oeen o3ias mDrauvpn(4aetoxrcty1opD  i i;s  eurxrpny1openmnetl()a2ururoot0open fciltfs emnvs u)artnirctydop r uesls0 2xrirpiudomtelnvt s  ruau pno1oetomo3iysla2el( s () exnmr3ty1omDraneo ( t2to(r3oy4ap nlivtlt  2trump;u0tex ii3iyd sDumnmsn(0 lxomociytfmtrauvi (0t2to(rpoydoltelnvsas  2rm(ro;u0tleniociys s2ean o (4altrxfcia1fat  u s;t teurir iu4lmtemnesa(faDumxmpoo1tptn i3iysfs2uauvs t0aeenxf ty1oatrlieol()srxr(r3ny4al   iesa()a2trxm ;o4opeomfctas mDum( p ()altrmo3iy1fm  lnvslt0trur(o oo1lpeelfei sfsDra(r nu4tlto i3ilsfs2umn p t4 ltoifciytomDrlnvil(0texo(mpoudlmt  fesasfartax  ot4teeomiciadla ra( snt)trtomr3tydlm r uvo;(0trtoxr3oudllte netat)sDrrxmoot1apxoiocilslm2emnvs;u0aexnifciytfpD lieo;t0srtm(mpiu4olee fcta(fs2rrxmo;o1tptnii3tyt sDelu p u0alxomf iatomDeauvs (0 euoxm ny4ol n neilt a2raum oo4alenmieiytlm em(vsnt0 ltrmfcio1oatraies s)setr(o ou4ap  mfcsltf 2raxm ou4texomfeiys s2emuvpnu0tetrmo tytoa  ln o ( setr(r3nu4ome lfctl()a2tru pot1oet  o3ias sDemuvon(4texnxr to1faDelieo () eumim ou1optnlnvilt  rraxro;u4teenioctyt aDra( p ()aetrxrctotlp   neo;s)srum(mpiu1lm  lnvt sfsrrr(rpnu1tlto o3iysla ulu o t4trxomfcoy1oaD  ivilt0s2umimpiodap e neta(faDta( ont0teenio3tld aDulnvo;u4alxniocoatlmDr uvo;s s2toxr3nodapen iet ()s2umx o;t4optomociadfs2uauvpnu4texomf3tatlp raies t0sexrxm iu1lp emics (fsDur( o;o0opxomi3iasfm2rln o;t)tetoio3ia1omD lnvi;s  exmim iu1lp elfcslt)srtrxm ;t4aexnifctysfa uluvp;t4trxnxf totlmtr neo;(0trto(mpnu1lmt  nvi sfa2um(r ou0oexomi3iyslm2ul(vp t4arenmo3tytfpteanei t t2uoxrpiu4al n nct t sDtmu  ;o4oleomoctat sDul(mont4 eermf iotfpDeaneo;s) exmio nydlmen ieiatf Dta( pno4opxomf3iaslsDeaumo u)arxnxrcoydlmD  uvsls texmir nydame livt t)sDua(  oo1tpxo ociyd mDum(vpn(0trxoxr3iadlptrli o t0 exmxopiodolteliet s sDumumpoo4tex ii3tysfm2rlu snt0tlxnxrcoy1oaDr uvs;(0srxr(mpno1lltn iet t)arumxmoot0oeen oetydlaDumuvp u0 lenmo iotlptr uei;t)t2umxr no1amee neta(f rtmx  nu1tleomoeilt s2umums;u0altrmf tydomt an s;(0srxm(o3no1ol nliesl(fsDtaumo;u4oltnmfeiltfa uln p;(0aexnmo todlaD luei;s setrxo oudalenmncsatfarum(rooo1aptomfctyslm2umnvs u4 exoxf tatla rlnes;t0t2xmir no4apenmicsl() Drrx ooo4ole ii3tytlaDrl(mpnu)teeoxfcootlmt  ieo s)s2tm(mpoodom n ncslt)sDumur nt4olt moctldfsDuln o;u0tleomfciadfa eln ol( t2xmxmpoo1al  liviat s2trx  ;t0olt iietydfmDrlu p;(0tlxrxf3oydfptean o (  rum(o oo4olee icilt aDrrumo;t1olxomo3tadfm uaump ()alerxr3tadoaDr ueol()texmxr3nu4aptn iesl(  rum(mpoo1oet  i3iad m2el(vont)aexoxr3iatomteanvi (0 exoxm3no4lm e neta() Durxrono0texn feiatlm2ra( onu4 eerio3iydom  aues ( srtm(o3nu1op nlnetls) Drr(  ;t4tleoifeiatfa2umn s;t4 eerxf3oydop   iei;t  rxmio ou4oleelfvia() Dtaxmpoo0teeo icils m2eln s;t4 lerir3io1fpDr i o s  ruoio iodopeelfet ()aDumxmono1tlxomieiatfm2emumpn(0 eerir tytom r nvils) rtr(rpnu4op  mnvtas arum( p;o1tlen ociys sDrlnmp;u4alermf3oodlmD li ilt0 2xm(opnudameemictas)aDur(m nt0oexn ieiadlmDrl(mp;(4 renmo3todoa eli i;(0srurirpnudomtn fcs () Drm( onu0tptnif3ias aDra(mp u0teenif3iadfm e u o;s0 2umxr ny4lltn fci sfartrumpou0alxn ociat sDua(vont4arxnmo tadfp   uvo;s)teuoxrpno1am elfcs s sDraumpot0tetnmieilsfmDuan snt4trxrio io1omt lnvs;s sexrir no4lpen ict (fsrtmxmooo0opt ifctatlaDrmuvon()aeenio3iatomte n slt  rxmio3iu1ape lnvslsfa2tr(mpoo4apxo oetlsla emuvont)alenifcoy1lmDrlu s s)setmxmpoo4lmt lnvia(fsrur(mp;u0alxnifctytls rlnmo;u)arerio3iydlm  auvs;()seuoio3iydomee nvi s artrur no0tpeoiieiltfm2rm( p;u0aeenxr io1lpDeai o s0 rto(opnu1am nmfeia() rum(  ot4apxoiieiasfaDuau s;()altrio oatlate ieil() eurxr oudlpt lfvsas sruaurpot1tlxn fciltlsDrlu o;t4 ltoxr3iotfmDrai s s seuoxrpny4ll emnctasfaDuax poo0openmo3tatla2uan s;(0artnmf iatlpt  uvs t0t2xrirpoy4al  lietl()aDua(m ou4tlx if3ils aDelnvs t)aleomf3oytfptrlies;t  euoirpoodop  lncsas  Drmx oot4apxnmicildfs rlums;u4 exoxr3iatom eli i;s t2umxo nudlme mics ( a2umumpou1tetn ieilt mDra(mpn(0arenxocio1oaDrauvi s  rxrxr oy1ll elneiat)sDrmx o;u0tpt iicildfa2ua(monu0 eeoir3todopDeluvi (0 eum(opoydomt mfeias)a2rm(  ;t1altoii3iys aDelums;(4altrio todfmDeli o;t)t2uoxr3no4lmenliesat)a2ra(mpot0tlx iociydlm2rln s;(0teenmocio1opD aivs;t0 eumim3nu1ap  lfviatf rtax ooo4opxn ictytlm2ua(mp;u) rxrmf3oydfatr nvilt0 etm(o io4lp   fcta( arrr(ronu1apxomfetlslaDemu o;t)teermr3iatfp rlneilt0 exrim iudal emfvt tf 2ur( ooo4aeenifetytlsDelumpn(0altrmoctytlmD au i;s0srtr(o oodop emfesls arurxro;o1apen fetltfm2uan sn(4alxrxr iotfa r u ils t2xmxm iodaltelfes t)aDtm(rono4aetnmfciadfm elnmsn()artrmf3tadlmD  uvo () exrir3ou1ll nlfvi (fa2uau ooo4oeenmoetyslm ulu pn(0 exrxociodomt  neo s)trtriopiu1ale  nct s)arrmu  nu0altn o3tydla rmums (0 rtrmr totoaDranvolt0s2tr(rpny1olenmfcil( arururpnu4ape iociaslmDranmonu0aexnmocoytomtrluvols0teum(m3ny1openlfvta(fsDtr(mo;t1tee ifetldfa umn ont0 eeoxfcta1lpD  uesls) 2tr(mpno1ol nlfvsat  2rm(r nu1alxnmieilslm umump;u0aleoxr iatomt li s;() eto(opiudlptnmieiat  2urxroou4tee mfctls a2elumpn()treoirctatfa r ueo s  2umio3iodlp nlfeilt) 2tr(root0tpe iiciadla eluvp;t4aeenmo iotoatr ieo t0srxoim3oudop nlfeiat) rrmu  ou4tpen ieiadfs2ranmonu0tltnmr iy1fpDelu slt)texoxrpnudopt lnvsat)srrmxmpou1aeenio3iyd a rau s;u4 exoxrctodlp rauvo s)trtrxr oodom   ici t srtr(mpoo0alxniocils m ran s (4texnmf iadfm  lnvol(  2urim3ou4amt lfvils aDuax ont4ope  o3tltlm eanvp u4 rxrxr3tydop  aieols) rtrxmpno4apen ivsat)arumxront4oetnioetatfaDuauvont0tlxoxo3ia1lm rln o t)t2uoxrpoo1op  mfvil(fa2urxmpnt0tltn i3iasfsDelnms u0 lxnxf3tydfmD anvs;s0 exr(r3io4lp  micsl(fa2tmxr ot0aee iictaslm elnms (0artnxo iodfpt aneils0 2ur(o iy1omtelfvsa( sDrmxmp;o4alx iieiad m emu s t0 eenmo ia1fatelu i t) rxr(mpnu1ap  lfvi t srum(r no0teeomi3iytfm emumont4teenmf iydfm rau i s srxriopoudomtnlfvia() 2ur(r oo4apto o3tysfm2elnvp ()tlenxf oodoatranvi;t0srxmxmpiudolenlncslt  Dtmxm nu1olxomoetysfmDelnvpn(0tltrmf3iodlaD ai slt  2trxmpnydop n fcilt) ruaxmono4ole moeiydfsDuauvo t0 rtnmo3tadoat au ol(  2toxo3ou4amtnlfetatf 2umxmoou0tlxomocildlmDrl(vo u0trxrxf oodopt lueils)s2uoio3no1ame mictltfaDrru oou1aex iieiltfm2umums ()tlxoxrciodlm  aueo t0sexm(m oo4lpe lnvs (f Dra(mo;t4tptomocilsls2rlnms;()aexrifctadfptr u o ()trxm(m nodoltemietasfaDumxrp;t0aetoiieiltfmDulumsnt0tlerxr ootlmD ai o s0 etrir oy1omen ncta() Drax pno1oeen fcildlsDul( p;t0tltoif ootfpDe ues (0s2toimpiydoltemict ()arrmuro;t1teeo o3tydlsDumu s;u4alxoxfcoodlptr ueslt0trxoimpno1alen nvilt a2tr(r ;u0tlx  i3tat mDrm(mp;u)treomf3to1oaD  nei;s0setoim iy4lmenmicsa(fsDraxmpot1aleo ietysfs elnvsn()aleomocoytlp ranvo t0 eurirpnu1lmt lnetas s2rru  ;t1opxn ociydlmDrau ont4tleomfciotom r i s s)trtoim ny1lmenlfciat) 2tauro;o0tpe iictytfsDua( s u4alxnxo3iytfaD lnvol(0 2uo(m3iodameemnetat  rraxmpnu1opxomietat a2ul( p u4aeenxr3ty1om  liei;t)t2urxr io1amtelnvsasfs2tax ooo4aexomieiat s umnvp u0 ltnir tadomDraivslt  eurxopoy1ol  mfvsas  rtrxr oo4alto ieiatlm2uluvs (4 exnxf3iatfm elivs;t teurxo3nydopt liei ()aDtmumoot1alxnioeiatfa2raumont)aexoxf3tadfaDeaieo () 2umxmpou1lmtemiet ()aDra(rp;t4tle  icilsfm em(mp;() rtrirciatla rai o;s)trto(m3iy1al emfes sfsrum(ro;o0tleomoeias mDemnvo t) eermr oadfmDrln sl(0s2umimpoudom nmfctatfa2trxmonu0aee mo3tys a2eln s u)arerxf oytfmtraivo (0setm(mpnu1am elnci sfaDra(rooo0aexoio3tltfaDelums u)altnmo3ta1la elnvo t)t2um(m3io4am nlfcsa()arrmum ou0aptn octas s2ulnvont4 rxrxr3iotomDeai i s)trumir3iydame lnci s sDtmu  ot4aexnmoctysls2el(vo;()aeenxo iotfaD lnesls0seum(opiydaptelnesa() Dtau oot0oex  fciytfsDeanvo t4aexrmr3iadlatr ieslt0 rxmxm3ou4omt lnvi (f Draumonu4tpen fcild s elnvp ()aetrmrciytop eaiesls tetmio3nudlm   fcta(f Drrumpnt4tee if3iys m2ul( o ()tlenxf3ia1fa  an s s)s2toxo3ny1alen fvsl( a2umxmp;o4opxoioeildfs uanvp t0trxrmf3oadlmD anei s0truoio nodlp nlict (fsrrm(ro;u4alenmo3iadla rmu onu4aetrmr3oa1oaD livo;t) exoimpnu1ope lfct sf rtau  ;o1openmfctltfm umumsnt0trtrifciatlmte ueols0srto(o nu4om nlncta( s2rm( pno1tptnifeiadfa2umnvo t0alxnxocoo1fpDe ieol( srtoim3io4omt  ncia( s2rrx ont1oexn f3ils s2rl( o;u0alxrif oy1lateln olt0srxoio oudol nlivt sfsDua(r ;t0opxo fetld m2ran snt4aetrxrciy1fm eanvs;()seur(opny1ame  fvi ()a2truront0ape ifcils m em( o;(4trerif tydoa ran olt0 ruoio3no1am n neiasfartmump;u4aeto f3iatls rm( pn()artnxo iy1omD luvs t sexmxr oudap   feta(fsrtmxmpnu1oeen ociydls2ul(vs ()arxoxf ty1op eln olt0t2umir3no1om   fvs s)aDumum ou4apxoii3tadla2ul(vo () lerxr ty1lp raieils  rxo(rpnu4ame mfvsltfsDtaxm ou0alto fciadfs umnvont4 lxnxrciadoa e ieslt0 2umir oodll   nvilt) Drr(mp;o0tee ii3iat mDrmumpn(4teeoxo3oadlmDr n o (  eumim ou1omenmnci s a2ra(  ou1alt iictatfs ra(vp;t0tlermrcty1lm e n o;()trxo(mpno1ol n fei t s2tmu p;o1olxo feiasfa2ranvo () eenmf oo1oa r uvs ( t2ur(o iu1aleemietl(faDra(moot4tltn iciadfaDelnmon(0trtrmo3io1omtranvs;()seur(r3oydomeemfvias srtauro;u0ope mictasls2em(vsnt0areoio3iodoaDrauei;s) etrim oodlmt mfvsl(fsDtrx ooo1aexoifeiytlaDeau p;(4aleomr3tatfm rln i t)t2xoim3oy1llt mics tfsDtau oou0oet  i3tyd m emnvp;(4arenxfcoytoat li i;() rxoxm3nodome  neia(farur(r nt1aexniicils s eanms u0texrif3iy1fmt an sls srtrxo nodom  mnvtlt  2uaumoot0aetnifctld sDemu o;u4 etnir iytomDr neils0t2xrim oo1lm  liesltf rra(roou4tptnmictys mDeln pnt0altoif oatom  luvi;(  eto(m3nu1op nmfctltfartaxm ou0aetnmieiydlm rlu p;t4tltnmrcoo1lmDrli o;t)t2umxopiu4lp n nci ( aDurumo;u1tetnmocildfm elnvon(4 exoir tadfm ran il()seurio3io1lptemnesat)srtmurpno1optomoetltfa2eauvo;u)trxrxfcia1lp rai ol()setmxrpiodom  mnvtl( srumumo;t1oetomfetyslaDulnmpnu4areoifctodfaDe uei s)truoio3oydam n fcslt  2tr(rpno1oexo fcils m ua(vp;t) eermr ta1oa  lnvolt)s2xm(o3no4lmt lfvsl(fa2tm(root4alxniieiatla uau s ()aexnifciotlm  lnvs;(0tetrxr3oy4ale mnctl(  rrrxmoou4teeo i3iltla ul( p;t4aeenir3tytom  aueil( teuoxo oodlmenlfei ()srrr(m oo0tlxniiciadfs elnmp;(0alerxfcoo1op   ieolt tetmiopiu1lmtemies ( srtmurpno4tpx mieils s2el(msnu) exomo3tadom r ues;(0 2tmio3no4lltn nesatf Dtm(rp;u4aetn iciltfsDemn onu4arenxfcoadop r ivilt)t2xr(opnu1ope  iet s) rtaxr ot0olxn fctys s2ranvsn(4alxrxfciotoaD anvs;(0 eumxm iy1oleelfvsa(  rra(m nt1aptnmociys a2rmump;t0teermf oo1lmDeln i;t  rur(r3ou1apenmicsas)a2ua(m oo0aptnmiciyslm eanvsnu0tltomo oo1opDe uvs;s0s2xmiopiy4ope  fvsatfs2ta( o;u1tltomoeilsfs2ua(mp;() lerxr3iodfmDelnes t  2trim3oy1omen nciasfsDra(rono0tleoiietadlm uau p;u)aexoio3totfm  livs;t0 rtmio iudll nlfvil(fsDtm(  nu0alx ii3iatfsDemnvs;(0texnmoctatfa  aivs s  2trxmpnu1openlncsl(fsDtrxmpnu4tpt  i3iad m2rl(vp u4tltrmo ootlmDrluvs;t)srxoio3oodope  ncta() Drrumpoo1apt ioetldfs ea( pn(4areoxo tatfmt anvo s0 euoxr3nodlle lict (fsrtrumono0alxn fciatla rl(vs u4tlxrxf3ootoatran i;( s2tmio3iodal nmnvi sf 2ra(rpno1aptnmi3iytls ra(vp t) etnmrctydfptraneols0teumir iy1op  lfviat aDrrx  nu1alt io3iyt mDrl( p;()artnxo tadopDrluvo s t2xr(m3no4lpeelieils)s2taxmo;t1aptoif3iysfmDrauvs (0altomr3tatfat lnvils sexmxrpnu1op   nei s) rtmxro;o0olenii3tytfsDelu o (0tetoxfctatom eln s ( seumir oudll   fet ( arur( pnt1alx moeiltls ulump u0alenmociotoa  auvs s  exrir no1ap e feia( aDtaxrp;t1aee  o3tyt s umnmonu0 lxnxo ty1oaDe uei t) euoxm3iu1omenmfvt () 2ra(rp;u0optoioctltla ua(vp u)arxrirctatopDeanvi;()sruo(opio1oltn nesa(  Dum(ront4tleoiiciyt sDrlnms;(4 renif3tatoatr uei (0srumio3oo4op e ivia(fsDtm(mpnt1alxn fciad aDeaumpnt4teermf3oadlatr uvi;s  rurirpnydaleelictl( srtr(mo;o4olx micildla el(mo;(0texrifcty1faDe nesl()teuoiopoy4ol e fctat) Dtru  ;o4tpeomoeiad a rlu p t0tleomocoa1fatr ivsls) rtm(m oo1op n ivil(fa2rrurpou0aetoioetldls rlu s;u)teenif3oodoaDelivo;( sruoiopoudomenlfvs s)aDtm(rpot0apxomf3tydfa um( s;u) etrir3iatfat  nvsls0sexr(mpoydlmt lieiat  Draxrp;u4oltnmocildlaDemn s ()trxoir iodopt  ies;t sruo(m3oodaltnlnvsat)s2trur ;u1olen fetad sDulnvo u0trtoifcootlp  ai s;(  2tr(mpnudaltnmicsl(fs2umx  ;u1alt if3iltfaDrmums;t0 rxoxocoa1fa eliei (0srumxmpou4lmenlieil()srraumo;t0altoifctlt aDemnmsnu0trenir ty1oat lueslt truoxrpou1lltnlfvtlt) Drau  ;u0aetoiiciydfm2emums t0trtnir3ootfateanesl(0 rtrio3iydlptelfetls a2rax onu4teeoiietltls2emu s;(4altnifcio1fmDeai sls) euo(mpno4al  mfvi s  2tm(mp;t4oeenmociltfm eln p t0 rtnio3iy1lpD aivi;t0t2xo(m oo4olt  ietas)sDtauro;t1alx  o3tad mDum( o (0 exriocoytoaDeai olt0t2toir oy1lmtemictat aDrr(rp;o0tptnmieilt sDeanvpnt0tetrmr totlateaueslt trxoimpnu4llee nvs s aDum(ro;o1opt mf3tyt mDrluvs t4 lermfctatla  li o;( teto(r3iodom   ivia()aDumump;o0tpe iieild mDuaumo u)tlxomo3ta1om rln i;s0s2uoir iy4aptn nci sfsrrm( onu0tpenmoetlsfmDuluvp t0alxomrcty1omDr uvi ()s2to(m3oo4ap nlnciasf ruaum oo1oetoioeiadfm rmn snt0teenmfciatlmteau ils)sexmxrpou4openlnei sfsDrax onu4apx mietysla2rmnvont) etnircoadoa eluvilt  rxrir iudomee nvtls)arum(monu0aetn oetyd a ea( ont0 ltomo ty1omtr neilt) eum(opiy4lm  mncsat)srumxr nu4optn ieiydls2elu p u4 lenmr iodfmt aies;t)sexo(opiy1al e fcsat)srrr(rooo4tltoif3iydfa el(mo (4artniocoodlm   ies t sexoim3iy1ape licil(f rtr( p;t4olenmicias aDumumo;u)aleoir3totop raivs;t)s2tr(r no1lltemnviatfa2trurp;o1olenmiciytfs eanms u4treomo3iydlatelivi;()srxo(mpio4apen fesl()s2rrxmp;t4aeeo ieiltfs ean pn(4 lxrmr3iytlaDelnvs;( t2uoxopno4opt  nvsatf ruaumpot4oex miciyt s ulnmo ()tlxnmf iotoa eln s t teumxr3iy1opte fvsls  rumx onu4opeo ieiatlm2emumsnu0arxrxr iatfp  an sls)srxrxr iy1olt lncilsfaDum(  no1alenmieiltfa eanms (4aetoxr ootlaDran o;( sexm(r3oodamtemneta(f rtm(ro;o1tltnmfeiyd mDran s;u0aetrxo3iodop   ivo;t0 2ur(opnodlptnlfvia(  Duax  ;o0tptoii3iytfsDumnms;() eermo3io1omD aies (0 2umxr iodopt mnvslt)aDur(monu1apenifetldfmDrauvpnu4arxriocta1la rliei;s)texrim oo1aptn fviasfs2rrxmpoo4aee ioetaslm em(vpn(4tetomf todfat  i i;s  rtmio iudlle  feilt s2rru  nt0altnifctltfa2uauvpnu4 etnxf oodfmD  n ol(0tetr(rpoo1lme licilt)aDrmx  ;u1altnif3iadfsDrl(vs;t4tlenir3iadfmt lieil()texoio3oo1ope lnvi ( s2raxmont0opeomieilt s ulnvs t)trxrmf tytop raneo s0s2uoxo no4ameelnvsasf Dururonu1ale ifcilsfsDrauvs t4 reoif3iotlat anvils s2um(m nodoptnlnvsls a2uau o;t4oet mi3iad m2eauvont0 ltrmfcoo1lpDe ieol(0 rtr(mpnudlleemfcil( sDtaurp;u0texoio3iasfa rlnvont0aeeniocoatla  anvo;s trtrxrpou4optn fcia(  Dur(  ;t0tpe io3iad m2eln s;u0 eeomocto1fmD anes;s0tetr(o iydol nlnctl(faDumxmpno4olxnmfetld a elnvp;u)tltrir iotlpDe uvi t0seto(rpoodalenlivtls)aDuau pnt4tex ioeiaslmDemu o ()alenxo todlaDrlivi;s)t2trio ny4ll   ivta()sDtmu poo4alxnio3iytlm2ua( s;(0tltnircty1fp e i i t  rxr(rpiu1ol n nvi s)sDtaxroot1ape ii3iadfa2eanmon(0aleoxrctydfpDrlnei;s  eur(rpoy1lp  mnesl()srtrxro;u0olx ifciydfm2rln s;() etnxrciytfmDeai o;(0sexrim3iy4olee nvt t aDtrumo;t1alx moeiat a2ua(vs u4trtoxo3iydfmD aiei s srxrxo io4al elnvtls a2raum ot4apt mfciad s um( p;(4texoirciydlateauvilt  rxrxrpou1altnmfvtlt  Duru pou1aleomoctltfs2ean pnt0artoxo3ta1fmtrlnvs t0t2urirpny4lpeemfct tf Drr( ont0aleoii3tydlm eaumo u)trxoxf3tadlptelueo t)tetm(o3no1lm  licias  rrr( o;t0aexnmiciat s ua(mo (0 etrmrciadfmD lueslt0seurxrpno4omen nvia( aDtmx pot0tpxomf3tlt a uauvp u0trtnmo3iy1omD ln slt0texrio3oy1ap n ici ( s2ta(ronu0aet  oetltfaDuanvs u4treoiociytlmDeau o t0 etrir3oodlp   fetas)arua(rono4opto oetytlaDem(mon(4texnmf io1fpDe uvs;s0 rxoxm iydll nlneia(f rtau poo0tptnio3iys mDem( pnu4tetnxf3oydlat aieilt0 2xo(r3io1oltn ici s  2ra(ro;u1aet iictyt a2ul( o ()tlenif iotoa eauvs s  eurxrpno4amtemivt ( aDururono0olxnio3iadfsDumnmsnu)arxnirciadfm elneols0t2tmxr ou1lme  netls sruaxroou1tpxnmoetas aDeanvs;()texnxr oytlm eaueo;s)trto(opny1oltn iviasfartrum ot4tpe ifetlt mDra( pnt0altnxf oo1fa raivs;t0srumxr oo4ameelnvsat)artr(r nt1tlxnio3ilsfm2ea(mp;t0 exrio oa1omtrluvi () rxrimpno4ol emivi () Durxmpnt4apxo feiysla2um( p ()arerxfcoatom e n i t)teuo(m3nydope mncta( s2ra(r ot4tpxnmfeiydla2eau p t0 renmocto1fm eauvo;t  exmxr3iy4llen fvt s arta( o;u4alxn i3iltlm rmnvsnt4 etoirctydlatrluvs t)teumir no4lp nmictltfa2rrxmont4tpxn i3tadlaDem(vp (0treoxr oatoaDeanvs;( s2trirpny4olt lfvt sfsDraum oo0aex iociyt m2eanms;u0 lxrifcootlm rluvi (  2umxm3io1aleelivs sf Duaurp;t0apeomf3iadlm2uaumsnu)tleoxf3tytla eluvols0 rto(m iydaleelfvta()s2urx oou4tee iictydfaDumuvp;t0trtoiocoa1fat lies;s0srtoio iy1aleelnci () Dtrump;o4opeomociytlmDrmnmo u) etomo3oy1omDeaieilt setm(rpno1olenmnctat)a2um(r ot1tle mf3tasfa2eluvpnu)tetomr3iytfmDelivol(0srumir oo1lm  livilt) 2ta(m nt0alxnmiciys m rmums;(4 eeoxo3todfa  ln o t) exoiopoydlpeemfciasfa2uru pnu4tpx iictaslaDem(msn()trenmf3iatfpt  u i (0srtoxopou4aleelfvi t  Dua(ro;o1opxoioctltfa ua( o;u4tltoxr ty1la r n s s) 2tmiopiu1ome  ivs s  2uaump;o4olenif3ils aDrm( o;(4arxrxrcoadom eaivs s)teto(mpoy4llte fci ( srtr(r ;o1tptnmfcilsfa2ranvpn(0 reoifcta1lmtelu olt)teur(r oydame lieta(fsDurum no4texnif3iysfm2el(vont4trermo3to1lmtelu ol(  rxmio iy4op e fet ()sDtm(monu1oeenmo3iadls2elnms;u) eerxrciytlm eanvs t  rumxm3io1lpeelietatfsDta(  oo4opeomo3iydfaDumnvo;t4treoircoy1omDr ivs ( seto(opnu4apenlfeta(  Dtm(rpnt1tptniieiys s2emump;() rermf3ia1fa e u ils  2tmxr oydlmeelncsa(faDrrx o;u0tlx mieiadlaDumu s t)tetomr oodom eluvi;(0t2xoio iu1lmt  ivils)aDtax ooo4optomoetls m rl(mont4aleomociy1fa  lu il(  rxrir3no1am emivsl( aDtaxmp;o0oetnmieiat m ea( snu)teenifciydoatrlivo s0 ruoir ou1am   nvtat) rtrxm ;t0alen o3tad s ean p;(4teeomo iotomDelu s (0 exrimpio4lp n ivs t sDuru  no4altniictasfsDum(vp u4 rerio ia1omt ln s;(0sexoxm3iy1omtemneias)s2trx pou4tlxnmiciys m2rmu ont)trerif ty1omDe u o s srxmio iy1ole  neia()sDrmx pnu0tltomoeiltfa2emnmp;t0teenmfctydfaDr neslt t2uoimpoo4amen neilsf Dra(r oo0aetoio3iatfs2ulump;t4 lxrmoctotoaDelieo;t) 2tr(r oy1lm nlneias  2uaum ou0open i3iyslmDrl(mo u)artnxrcoydlat lu sl(  exoxrpoo1am   ictas)sDtau poo1alxoio3tldfaDuln p;u4trtoxf3oodoateanvi;()t2tr(rpnodole lfesa()aDrr( pno1aeenmi3iysla elump u)tltomrcoo1fmteai s () exrim io1opee icta( a2rmxrpnu0tpxn i3iltls2rl( s;(4alxoxrciydoatr ues t) rtmxr3nydlm  lieta( a2urxmono4tptn octysls2eanms u4tleomocoydopDelies;t0srxrxo3ou4op   nvs t a2umurp;u4oeen octytlsDrmuvsnt)tlenxrciotfpt ai o;()srxmim iy4apt  nvi t)a2tmx  ou0tptnmoetlt mDra(vs t4tltnmr3ty1lpD auvi ( s2to(r iudlme  ivsa( aDrr(mpnt0aetn iciydlsDrm( pn(0 reoxf3oo1lpD auvi ( trumimpio1ll emncta() 2rm(monu1altn iciydfmDuaums (0areoxr3oodfat liesls)s2xmxo oo1lmeemfctat sDtrxmpou4tleo ictltfm2ulnmpn(4tlenircty1lptelnvs;s) etmio3iy1lptnmfeil( srrmumo;t4tptnif3tat a uluvo t4altrxr3ia1oat anvilt t2umim nudomte nctlt s2rmxm ot1tlx moctydfa2uanvs;t)teenir3ty1oa r u i;s0t2urxo3iy1ll n fctls aDumx  ;o0oltnio3iadls rmump;t0tetomf ta1lpDe n s ()t2ur(opiy4ap n fvt s artrxm nt0tpxniieildla uanvp u4 rtrxr oadfmtrlnvo ( t2umxr ou4am e ivs (fsrur( o;t4aexnmociytlmDua(vp;u4aetrif3tadfpD  nvs s0 rxmio3nu1ol   nvs tfaDtrum ot0tetnii3iltlm2ulu s;t4treoxociodfa  aieilt0 exo(opno1lmen ncia()a2uaxm ;o4aleoii3tyslm umnmp u4altnif to1lmtrai s;(0 exrim oodlmeemnet t)s2rau p;o1apen oeild a umuvon()areoir3iodomDrluvo;(0srxoim iodom n fvtls)a2trxm nu0tle  f3tatlmDulu s (4arxrxr3iatopt luei;(0 2uo(r3iu1om n ieias)s2tmu poo0altnifcild m rmuvo u)tlxoif oa1fmDeaiei s) eumir ou1om n ivs s a2trumo;o0alenmfciytlm ul(ms;t0 lenmr3iytomt livslt) eurxo oo1ol e nvsa()sDta(  ot0optnioeiysla2ran s;t)aetnxf oydfaDr uvi;t  rtoxopoudapeelfvslsfs2taxrono1tee iociatlsDrlu s t4artnif iydlaDrlies;t) rumxr3no1olte fcs s arururonu1tee  o3tytlsDrlnmonu)trxoxoctotfptr uvs;t) rtmiopoo4amtn feta()srtr(m ;o1apxnmicilt aDul(vp (4arxomo tadlmD  iesls  etmxm3no1am emnvils) Drrx pnt0tpt moeilslm2rluvs u4alenxoctytopD  i i;(0t2uo(r3iydomenmivsa( a2taxmono4optnioetadfsDrau pnt) ltrxf iotfpDe iei;s0trxrxr oo1amtnlncsat arrruro;u4oex  iciys a2uanvs;u4texnmo iatlmt  ieslt0t2xmim3oy1alt  fctlt sDurx o;t1tptnifciasla2ea( o;t4 rxomf3tadfm  ai i;(  2toxm oo4lpe  nesa( aDuax ont1olt iictltfm2elu p;() rxnir3ta1lmDean s (0seum(o nu4apenmfcils aruax  ot0alt mo3iasfm ua( o;(4aeermr3iatoptrluesls0t2urxm ny1opeelfesatfaDuau  ou0tlto ociydfm2uaumpnt)tlerxo3todoa ean olt)t2urxo3no4om  mnci ()srur(r ot0tpxniicildls emn on(0tlxoiocootlm  ln o;t)srtr(r3oudolt  fci s)arrrum ;o0aet micias sDrm(mp;u0 exrmf oatfa ranvols) rtmxo3iu1opt lnciat)srum( ont4apx ioetlsfsDul(vp;u4tetrxo3iadlpD  ueslt0seuo(o oo1opee ncs (fa2rm(mo;t0alenmicilsls emump u) lerxo oatfaDe n il(  eum(opoudapte fctl( artaur nu0ape ifcias aDrlu snt)aexnmr ty1lpte uei s  2uoim3ou1lltnlivsl(  2umur nu0oee ioctlslm2rmnmpnu4altnxfcty1op raueo s s2uo(mpiodlleemfcil( arrauroou4apto ociys m ea(ms;u)areoxr tatfaDe i ilt  rtm(rpiodol n neta(  2trx p;t0oee iieiatfm ea( o t) exoiociydoat  uvolt  rtrio ny4ol e ictlsfaDua(mp;t0openiociyt sDulnmo u0aetrir3oadfpte u s s) 2toiopiodamtnmfctlt)srumuro;u4oleoiieildfm rluvs u4texrir iytlaDeai o;s srtoxr iodolenmfvilsfs2rau p;t1tlen f3tltlaDea( s;u0 etoiociydlp eauvols  2uoxm3iy1lm  lnvs ()aDtrxmono1opto oeiytfm2ra( o u)areoxrcoo1fp ranes t0s2tmxm no1apen feia()s2uru poo1aex moeild aDran pnt) exoif3todlp rauei (0 exrxrpiu4lp  mivi (  rrauront1apx mieilsfa um(vpn()artomo3tadfp  luvi (0s2urxr oydaleelici tf Dtm(m no0apxo oetydlaDrl( o (0 ltrxf iatlmtelu o;s) 2trxo3iy4lp e netat)sDumxr nt1tptomfeiltfa2rl(vp;u0tleoir3iatop r ieo;s  rto(r3nu1ol nmivs s)a2tauroot0open fctytls eauvs (4 exoxrctadlaDe ivo t trxriopou1am n iei (fsrrax o;u4ale ifciydfs um(vs t)aetomociytopt luvs;s)texm(o3nydlmtn ivils)a2tr(mpot4tlxnmi3iyslaDrmnvo (0 ltnif ootfa  livo s s2uoimpoodom  lnvs t srta(mpnt1olt  i3iadlm2ea(vp u4tleoir3todlmtelu olt  ruoxr iydam nlnvt t) Draumoot4aetomfeilsfa2ulu pnu)tlxrirciadop eauei;t)trtrio nodalen neiatfsrtaxrpou0tltoioeildfsDumn p;u)altnmf iytopDe ivo t seto(rpno4amtnlicilsfartmu pnu1tpeoiieiad s ulumpnt) rxrmrcoy1fpDeauvsl(0teum(r oodoleemnvtlt)srur(r ot0tpx  ociaslm ra( pnu0teermo iatomtr ies ( seumxopio4ale lfvsat) Dra( oou4aptnii3iydlmDul(mp;t4 lenif3oadoatelnvo t0t2umxm ny1apte nvsl(faDtmx  nt1oetnmf3tysfmDuauvon(4tlxoxo tydfatran s;(0 2urim3iudll n ictasfa2trx  nu4tle  i3iyt a uanmsnu0teerxo3oydlaDrauei;() rxmxopiu1olt mncil(fsrrau  ou4aetomoeiltlm rm(ms;u) etnxf3tydlpDe n o;(  rxm(r oo1al emietl(f 2rmxroot4opxoio3tysls elumsnu)trtomf3io1fm elivo t)t2xrirpiy1lme lics sfa2rmur ;t1texnmf3tad s2rmums;t)tltoif3oa1opDelnes s)srurxo3iu4altnmietasfsrtrumo;t4texnmieiydfa emnvp ()tlenxr3tatlp  liei;(0 2tmxr3nu1oltelivs s  Dta(  nt0tlx mi3ilsfaDrl( on() rxrxocty1fmD luei s  rtmimpnu4lp e ncils srra(r no1tee ioctytfm2raumo ()teenxf3oatlmtrlu il(0t2ur(o3iodlltemfvs s) 2umxm ou4opxn oeiatlm elnmp;u4aetoxr iydop  anes;(0truoim oydlm elnct tf Dtr(rp;o0aee io3ias mDua( on(0 leoxfcoo1op e u o ()trtmxm oo4lpte nvsas)aDrm(rp;u4tptnifciytfs2uln s;t0 lerifcoo1fmD  ivs ()seumim nydlltelnvs s  2ur(  no0oetoif3tasfaDumumo;u0arxrir oydfmt  u ols trtoim io4openlnctls srrr( o;t0tle moetadfa2eauvp u0tleomo oadfaDrlieo t) ruo(opiydaltelnet s) Dtm(moot0open i3iadls emn s (0texomf oadomD lneo;s  2xo(rpiudll   nvtas aDrm(ro;o4aexn fetatlaDraums;u0artnmf3iydfaD  n i s) 2xm(opiydal emnvia( sDtaxmono4olxomieiltlsDumuvp t4artnif3oadlmDe nes;()setr(m3iydll  lfvtltf rtau pot1tlto oetatla uauvp;()arxnxo3tadom  luvi;() rtmim3iy4ome lietltf 2umxmp;t1oee  i3iyt m2eanms;u0 etrmfcia1lmtr nes;t0trxm(r nodol  lnci ()a2ra(rpou4olen i3iltls2ra( s;u0aexrmo3oodlpDe n o ()s2xrxmpnu4llt  ivs s  2tmu oot1aptoiiciltfmDumu snu0trermf3oadfp rlnvi;s  2trxr3nodlpenlfvsat) rraxrpno4alenmfciasls2rl(vsnu0 exomfciotopDrli ils) rurim3ny4ll   ict s aDur(moou4tlt mf3ilsfm rlnvs;u0aeeoio3todlmDranvs;()s2tr(mpiydaptemfvi (fsrrrx onu0aetn octydla emnvp;u0trxoxo tatfmD liei (0 exoxo3nydam  lictl()aDrr(r oo1tet ioctadfsDran ont0 reoiocio1omDrlnvi s0s2urxopno4lm emicta() rtmx  ot1tltomfctadla2eln p (0alermo ta1lpDrlu i (  ruoxm ny4ole mfvs t)sDur(rpnu1alxn f3iysfa2ra( o u)aetoiocta1lmDraueo;t)sruoio nudape mnvilt a2um(m nu1opeomictls mDemnmo u4tlxrxo3oa1fmtr nvol( s2xo(opoodoptemicsas)arraumpou0aex iiciaslm2uln s u4 lxoxfcio1fp r n o t)s2tmio iu1apee feias  Drr(roou0texnif3tlsfaDemumo;(4teerif oatoate n o t)t2uoxo no4ol nlfeia() rrmuro;u1tetnifciatfs rlu onu)aleomoctadfp eln s;s t2xoir3io1lpenlict t  Dra(ro;u0oeenmieiat m2el(msnu)tltomo3oatlaDrlnvo;s) 2umir3io4alt mnvtlt)a2umumpnt0ole ii3ilsls2rauvsnt4aetnxocia1fp  aneo;()trtoiopno4aleeliesas aDum( o;t0olt  o3iytla2rl( s t4 rxoxfctatomteau o t  2xr(o3nudamtelies (faDuaum ;o1ope mi3iasls el( p;u)aleomrcto1omtr nvi;t setoxm3io1altemict (  2rrxmooo4apenmi3iadlsDeln p;t) ltnifcio1lmt lnei;t) 2ur(rpoodamt lfetls srtmx pnt0aeenio3iatfs eaumon() rxrmfctatfpD  n ol( s2urxm3oodlpt mnei t  Dumumo;u0texo f3tytlm2rm(monu4aetrmo oytlmD aivs s0srxrxr3nydlm   nvs () rtmxr nu1oee mociaslsDumn s () lxoxf3oo1fpDe neilt0sexrxo3oodlpt  fviasfsruaum no4ole  ictltla uanvs u4aeenio oo1fmDeanvolt0srtoxm oydom elfviat sDrmu pnt4optoifeiltfs ea( s t4tltnif ta1lmD  uesls0 exmim3oo1apeelnvs t)s2taxm nt0tle mfeildla elu onu0 ltnmrcoytfaDranvol( trxrir3oodol e fvslt  2rrxm ;o1tpxnmoeiytls eaumo;(4areoxociotlmDranvs;t tetriopoodaleelnvi ( s2rr( pno0olx micias m2rauvsnt4trxrxr3oydoa eau s;(0 2um(r ny1lm e fviat) 2uaxmp;u1aeeo f3iadfaDumuvs t0altomo3iodlaDelnvsl()srxrxopoy4ame mfvi sf rraxm nt1tee iociyd sDeluvp;t4trxnirctotopDeln slt0trxrimpny1lpeemnvilt a2urx pou0tpe  fetysfa emn o ()aeeoif3ootlmD aieo;s0texr(r3oodale  nvs t s2uax  ;t4apt mfciadlaDumnmpnt4aetnxf3tadoaDrlies;s sexm(o3iy1al  lies s)sDra(monu0altnif3iytlm2ua(vsnu0trxomf3ta1op r iei (0 rumxo iu4om   fci t)srtmu p;t1oetn ociadlaDumump;t0tlerir ta1fa elneols0t2xo(r oo1lmeemfvil()sDtr( oou4ale iocilt sDran o;u4 etoif oo1la   uei;()teuo(rpoudape lfcs t s2taxm ;o1aleoioctld aDemn pnt0alenxo3tatfa eauvo;(0 2xm(mpoydlmeelfeslt) rraumpoo4tpxn oeild a umuvo t4trxoxo3io1fpteanvo;t0s2xrxo3oo1omtnmfcta( srtru pno0aet ifeiydfaDeauvpnu) rtrxr iodfpD  neols  2xoio iu4lm elfvsls)s2tmum ;o4oleo oeiat m rlnmp () lxoxf3to1lpteliei s)s2to(mpiu1omtemfvsa()s2ra( o;o1apenmoeild a2ulu ont)altnmoctatoa eai s s) rxo(m oo4ole  ici (f rtm(roou0alto f3iatfaDelu snu)tetomf3oytlat ln ils)setrxopou4lmenlneilt sDtmxrpnu4tlen fciltfs2ulnvo;(0trtnir totlat  uvi s0t2trim ny1amtnmnesa(f Drm(moot1opxomoeils sDemumpnt0altoxr3oadlp  lnvs t0s2xrir3ou4ll   iei ( aruaxront4opx miciyt mDeaumo;t0artomo tydopD  nvs t  2um(r nudopt mivil(fsrtmx pno4ape  oeiaslm2uanvonu0 lxomrctydfpDeanvil(0 2um(m iodlpenlnetltfsrraum ;o1aleomoeilt s ran ont0 rtnir3iydopt ln ols)sexmim3nudomen iet (  Dur(ronu1teen oeiatfaDeau s;u0trxrmr iotlpDrai o (0 rtrir3oudom   ieslt) 2tmurpnt0apeoifeiatlmDeauvonu)treoifcto1lmtrlieo;t texrim iu4lme mnvs ( a2uru poo1aet ioeiltfaDelumsn(0trxnif tatopt aies s t2urxrpny4omee nesa( s2umx pou0altnifetytfs elnmo (0 rtnmrciydfate ies s srtoxmpoudalt  nvta(fa2rmx p;o1oltnmo3tatls2ra( s;t4arxoxocia1lmDeanvo;s)teumimpiy4apenliesa(f Drm( onu1tleniicils aDemump t)aleoiociadfpDeaueo;()trtm(m no4apt lnvsat sDrr(mp;u1aexnmoeiytfmDemumo (4trxomf ty1oa eaieslt0setm(m ou4omee fvtltfaDrauroot0oetniiciat s el(mo u)aetoxo io1laDrlneo;(  2uo(opou1amt mfvt ( aDrmu oou4alenmo3tydla rm(mp;(4alermr oo1lmt li s;s0 2xrirpno4lme lfesl(  2uru  ;o0tpe iiciaslaDulnms t)trxnio3oadlpDe ivolt)trxr(o3nodop  mnvt s s2ua( pou0opt  ieiltfs2emumpnt4aetnmrcoytomDe ivi;t)trurxo3iodlm elfvta()a2urump;o0aex iicilt s umu s t)tetnir iydlptranes;t0 rtmxm3iy1op   neiat s2rrxm oo1oetnmf3tysfa2ea(vo;t0aexnmfcoo1lmDelivolt0seur(o3nodlm nlfvt t srrr(  ;o0teen ieils mDra(mo u)tlxomfciydlp  livols0trumxrpnodamtn ivta(fs2ur( o;t1alto ociytfmDelnmp t0aetoxf3iy1la   u ils0trxmxm no4ol emneils) 2urxr ot4aeeo octytfsDuaumon(0trtrio3ty1fa eai i s)srtoim iydaptnlictltfs2tm(mpou1aptnio3tlsfaDrlu p;u4tltomf iodfp rlivs s  etmir oo4om  lfetl( aDtm( p;t0opxoiiciltfa2ul(vo t0aeenmrcoatlaDean slt srumxo3oydlm nmfcs t)a2ua(r nu4oltnmi3tyslaDeluvpnu4 exrmr totlmtr i sl(0 2urir nu4altnlnctl( aruaxmpot0aeeoiieilsla rl(mo u0artoir oodfaD luvi;(0s2tmxrpou1oltn ncil() ruru oot4aet  ieiltfa rlumo u)aetnmociadfptr neo;s0 2xrxr iydlm nmietlt aDra(ronu4tpenmf3tysfs2raump;u)teeoiocoydopt  ueo t  rxrim3ou4ap emics t)s2tmxmp;t1tle mi3ilslsDuauvp t4texnxo tytfateaivil(  2xm(mpiodol  mfviltfsrurx  ;o4opxnmfeiyd sDel(msnt)aexomo3to1fpDeanvol(0 rxmio oydalte nvsltfarurx o;t4tetoifciatfm2eluvs t) lxnmfciatoaDrlu s ( srxrir oodlleemiesa()sDtmxm ot4apeo i3iltla rlnvp;t0tlenxo3ootfaD  uesls0t2xr(r3ou1alee fci t)aDuau o;o0oexnio3ilt s ea(vonu)alxoxo3iytfmDeaues;( s2xm(mpny4ol   nesl() rtaxmont4tlx ifciytla rm(mo (0trerxocta1latelu o ( seto(mpoy1op n ivsasfaDrrx ono0tpx moeiydlmDuauvo u)aleoxr3ty1omDrluvi;t)trxoxm3oy4aleemfct s)srurum nt0tee mfeils a emnms;t0areoxo iodlp raiei;(  rum(m io4omte fcsas  rra(mpot0aee moeiadfa2rlnmo;t)aexriocoodfa r i i;t s2umim3oudlm  licsls s2ur( pno0opt  f3ilt s uauvon(4aexrxociy1faDrlieo s)trxmir3oy1openlfvs ()s2trx  oo0apxnmfcilt a emu p;(0trtoxf3ta1fpDelnvsls0sruo(r3iydope lfeilsfsDraur ou1tlx ii3tas a umn onu4 rxnio3iatfmteaivs (0tetmimpnydopt  ivs (  Dtrx  no4aeto i3iltls em(mpnu0artomfcoytfmtr nvils  eum(r3iu4alt lfeia()sDtmum no4tex if3tatfsDul( p u) etnir oydla eai o (0trtrxm oy1ol elnesa() 2ua( ont1tlt mieiat s eauvs;t4texrxo3io1omtrluei;t0t2xrim3ou1ome mfcsls  Drmuroot1olx mi3iadfs ea(monu4arxrmf3iydfpDraivs;s) euoimpio4op nmfviasfa2tax  ;u1oltn oeilsla2ean o;u4trtoio to1oa r i i s sexm(m3iu1apee fvs tf rumurooo0tpt moeiydlsDrl(vs t)trxoxo3oy1laDrau s;s)trto(o iudlltn icsa(fsDuaxmono1aee moeiadlmDemnvo t) lenxfcoy1fmDean s (0 rum(o nodol e fet s  2umu o;u0tpxn oetltfm2eauvonu4areoifciy1lpDeaies;s0t2um(mpoo4al  lictl()aDtrumo;u1opt ii3iat sDeauvo (0artrxrctytomDe ivil( t2xo(m3ny4llt  ivtltf rrmxrpou1teenioeiat m ranmp;u4 etoxr3oatfm rlueo;t truoxmpoo1ap n nviat) Dta(  no4openiieiytfsDumnmpn(4teeoir oytfp   ieo () 2to(o oodoltn ncsa(  Dtmur ;u4openmo3iad a2umnmsn()teenif oo1lm   n i;s)seurim3nu1lmeelneil( s2ra(mp;o0aleomieilsfaDrmn p t0tetrmf oadfmDeliei;t t2tmxr oy4apenmiviat aDtauro;o4olenii3tatfs eau o;u) rxrmo3oatla   nei s  exoir3iu1lpt  ivsls) rtau  ou4apx  feiytfs2elu pn(4altnmf iatla  li ols srxo(m ou4openmivias)a2rrxr oo4aeen f3tlt s raumo u0aetnxo todfp  luvi s  rxmxm no1am   fcsl(fa2trx ooo1aex mo3ild s2rln s t4teenxr3iatfpDrlivo ()trxoxo iu1om nmncsl()sDurxronu4tlxo i3iaslmDemumo (0 rtrxrctydop e nei (0 ruo(r3no1op  lieia(f Dtmxrooo1opeoiictytfa2uanmsnt)altoiociy1lp rluei (0 2ur(m3oy1lm emnvi ()aDum(mpou4tpeo octld a rau s;u0 rerxr oatla rlu i;(0trumxo oo4ll  lnviatf rrrxm nu0oleoiicildfm2umu s;t4 exrxf3oy1omDraueol() rtrxo3oodomt mncilt s2umxmpot0optomietat sDeanms (0trxnio tadlp   u o;() 2xrir no1opee icslt  Drr(  ;t4teto ociytlaDuluvo u0altrmfcootfa ean ils0srxrxm oy4lmt mfei t sDraxr ou4apxnmo3tltfa2rmuvp;(0 lerxf3iydom e ivsls setr(o3oo4lme lnes s)a2rmxro;t1aee iocils s2ul( sn(4arenxr oo1op eaies;s  etrir3nudll eliet (f Dtmumpnu0alen ieiatfm rl(mo t0trxnmrcty1oate ivo s0t2xoir3nydope  ici (fa2raurpnu4tlxn o3iyt m2rlump;t)aleoxf ootopD anvo;s sruriopny1am  lfvsat) 2tm(rpno4aexniocildfa2rmu sn(4 lxnir3oodfaD  ivo (0s2xrim no4lle  nctlt) rumur nt4oltnioctyt aDua(mo;u4aetrmo3totfm   ivslt0t2uriopoy4opeemncslt  Dtmxmooo4apx mociysfsDelnvont0texomrcoatopteauei t  rumxm io1ll n nei ()a2taxmpnu0aptn fctlsls el(mon(0arxoxfctytfateauei;s0 rtoxr3iy4lp e ietlt sDtrxronu0ole  oeias a ean o;(4arxomr3iodfpDranvol()setoxo nydoltelnesa()a2trxrp;t1opxo o3iltfs2rmumpnt)alxomo ia1omteai s;() 2toxopoy1lm nlfesas  2raum nu4aee ioetatlm2eln p t4teenif3todop rlivols  rum(opio1aptn nctat) rrmxmonu0aeeomiciat sDrau p;u0trtnmf iydfpDrlieo;t0 rurirpno1optemncs ()arrru pnu4alx  fciltfsDrm(vp;t)trxrxo3oadoatelues;s trtoxm iydom  lnetltfaDtmx p;u1tle moeiadfm2eauvpnt)texrxo3iodfmte ieols0sruoxo iodoltnlnvia(fa2uax oou0open feiysfa2rlnmp;t) leoxo3iytlmt livo;( t2trimpoodamtnlnvsat)s2rm(m ou4tee  icildfsDul( o;u) rxrxf3iatoptrlu o t) euoim ou4am   fet () Dur(ronu1ope  ociyt s2elums;(0 ltrxo3ootomDe ies;()texr(m3oydom nlncias s2umxro;u4opxnioeilsfs2ul( s t0artomo iytla r nvil(0 etr(m nu4ap  mneiltf 2rm(rp;t4aptomociytlsDrmumont0trxrxrciydom e iesl(0t2um(o3ny4opee ietlt  2trurpot4aetn o3ias mDrm(mp;u0 rxnmrcoy1faD  uvi (0trum(o3oodlm   ivta( aDtmum nu4olx mo3tlslm elnms u0 etrxf oatla r u ilt t2umim3ou1op nmicslsf 2uax ono4aex  ocilsls2eauvo;u) rerirctadfpte ies s) 2uoxmpnydlpt lfvias)srtaumpou4tetomictatlm2ea(mp t0 exoircoy1faDeli olt trtm(o no4lptn ivs t  2rau o;u1teenmf3iytfmDua( onu0arxrxr oatlm ean s;t texrir nu4opt mivs sfaDrmu pnu1tpe ii3ils a rln onu0aexrif3ia1lm  au i;s) rxrir oodom elivt t s2rr(m ;t1altoifciatlm2ul( p;u)tltoxrcoy1om r nvo t truoxopnydom e iei (fsrtr(rpno4tlxnioeiyd mDum(vsnt0artoir3todfp rai i t0 rum(m3oydol   fet (  2raur ot1olxomi3tatfm2elu p (0 rerxfctytomte nei;t) rxmxr io4ap emnctatfs2rmurp;u0tlenifetaslm2eauvp t4alxomfcia1fmt aues (0trtrxr iydaleelies () 2rru  ot0aleo icilt sDrl( s u4treoxrctydlateln sl(0srto(rpiy4om   fvsatf rtrurpoo1tpto icilt m rl( s;t4artrxfciadoaDe neo;s0trtm(mpnu1om   ivs s)a2urx pot4oexo fetad mDrmn snt4 rtomo tatoaDeai o;s) rurxo oo1lp  livt sfsrra(m ;t0olxoiieiad s ea(vp (4tlxnxfcoo1fp eaivs t)s2toiopou1oltelfvtatfsDumxm ot0altn i3iydfa2uln onu0aeenifcoytoptraivo (0 exoir3no1omen ietat) 2ur(mp;o0tptoiociat sDrlumsnu0tetrir to1laDeaies;s0 etmxmpny4al  lieia(faDtau o;o0opxniociys a2rlnmp u0alxnmo3iatoaDr nvils)texrxr3nudlmt lieiltfs2uaxrpnu1apenifeiasfm2umumo;u4aexnif tatop  lu sl(  exoxmpno4ap n icsas) 2trxmonu1alt iictatfa emnmp;t)trtrmf3ootopDrluesl()teuo(m no1alt  ncs t s2rmumoot1aptoio3ilslsDulu ont0alxomociadfa elieils0trxoxr3ou4lpenlnei t) Dur(m ;t0aeen f3ildlm um(vs;u4aexoio3iadom  aieslt) exoxm3iydaptelfei tfs2ur( ont0tpenmo3tyt sDrm(ms (4tlenif iodfm   i s () rtr(o3oudlpenmnct () Dtaxrooo1tpxoiieiyslm2eanvs;u)texrio io1omDe uei;s0 etr(mpiudop nmfci s)s2rm(moot1oexnmociatlm um(mpnt4altoxr todfmt  i s (0 rtr(opio4ame mfviat) 2tmuro;t1tpen ociad mDuanmp;(4 etoio oytfp eau ilt0 etriopnu4lp elfvi (fsrum(  nt0oetnmfeiys a ra(mo u)alxoif3oy1oaDrluei (0srtoimpoydol e ivtatfarum(mont1olxo feiyslm2rm( s;t4aeeriocoy1fm   ivil()teumirpou4lmte nei ()arur(rooo1apxoii3tyt m ul( onu0artomf3oa1lpt  iesl(0s2xmim no1alt  ncilt s2rmxrpnu4apeo f3iydfa eaumont4altrxo3iotfmDrai s;s0srxrirpoy1oltn fes s) 2uaxrpno0aetomi3iad s2emnmpn()trenir3io1lat  ues t0 2xmxr3oudapt lnctlt) ruru  nu0aexnmf3iasfmDuln s;(0areomo oadomtrln i t0 2toxrpoydlptemivt tf Dtm(mont1texnmfciyd a2elu pnu4 ltnmoctydlpt  n i s0sexr(m3ny4lpee fctlt)artaxmonu4apto iciys mDuauvp;()aetoxf3tydopDelu i;s)sruoir3nu4oltnmnviasf 2um(r nu0tpxnioetas sDelnvo;t0tlxoir iotop   ueil( s2xrxr ou1ale  ici ( sDraxrpou1ole  f3ilt sDeanmsnu)trxomrctotlp   uvs ( trtr(r oodomte fct tfs2rmumpot4opxo feils aDrmnvo;(0trtomfciotfaD anei;t)t2tmxo iu4lp nlivtat) rtax  oo4alt  ieiltfa rlu pnt4 rtrmocootoatrluvsl() 2umxo3oy4omte ies t) 2rrumonu1oexomo3iadlm rm(mo;(4 rxoif oodlp raiesls0teto(opoo1ol nlfeilt  rtmxrpno1olenmi3iatfm uanvs;u0trxnio3oytfaD  u o t0setrxmpiydlpt mies sf 2rmxmp;t4opto ociytfa umu s u0aexoxf oy1oaDrli o;(0 2xrxo3nudlm n ncsasfsrrr(m oo0aeen ociadlmDul(ms;() rtomo3iy1lpt li s t0 rumxr3iu4lmenmnetls) rrmu o;u1ope mfeiys mDea( o t) rxnif3ty1opDr n ol(0sexmxm ny4amte ics (fa2umx  no1aptoiieilsfs2eluvo u4altoir oytfmt livilt)t2toxr3no4optn ict tfsrtmx onu1tpt  i3iys s2ra(vp u) leoxr3iotlmD  iei ( t2umiopoy1ole micsl( a2trxm ;o4texn feiytlaDrmnms u)trxrxo3oatfmt  ivs;()sruoirpnydalenmicsl(farta(mont0oet mfeildfa ulump;(0artnxf oydfm r ivi s)sruoirpou4ap  lfeta(  rraurpno1olxoiicilsfsDrl( s;u4aexrifctydoa  aieo;s)texm(mpnudolt lfct t  2rrurpou0olt mf3tydla2rmnms (4altnxf3todlpD aueo s s2xm(r nu1ol e iei t a2rr(rp;u1tpenifeildfmDrln p t)aexriocty1lpD an s (0 2umxm3iydopt lfctasfa2taxmpnt0tpt ii3tysfmDrmn sn(0trxoxo3oodoateauvo;s) ruoxr iu1lmeemivils srtaxrp;u0aeto i3tys a umums;t)trxrir3oytom rlnvslt0srtoir3nydlmeemncil()a2uru poo0opxniictld sDean sn(4arxnio iy1opDrlieilt)teuoxopiy1alt mfetlsfs2rmumo;u4oleoifeiatfmDumnvp;t0trerir oy1laDraies t  etm(opiu4lpt lnetls)sDum(mont0tlxn ociyt a2el(mo;()trxnmr3oy1faDrlivi s0trtr(r3nydllee ncta(f Drr(  nu4aee  oetlslaDulu sn() rxomrciytla  lu ilt0 exr(mpiudome  ieta( srrm( poo0aeeniictldls2uln o (4 etnmfciatlptrai ols0sexmxm iu1al   nesas)srtrxrpno1opt  octatfa ulnmp u0tltoxfctatlpteaies;t)texo(r io4amenmnct ()aDur(r ot1tlt mietldfaDrln p t) exomociodop eaieo s0 2um(rpio4apeelivslt s2rrxmpnu0opt moeiydfm2ul(vs;u0arenmr totlate n olt srxo(o iudop   fet t aDrr(mpno0tetomo3ilsfaDrlu snu)texoxrcoo1fp  aueol()s2xm(mpno1lpte feiasfa2rm(  no4olx  ieildfs ua(mo;t4 lxnmo tytfa  aivils0texm(o ou1lpt lneia(fa2uaumonu1tltoiiciysfs2ulnmsn(4 rtomo iydom rau i;( s2xo(opio4opeemnciat a2trumpnt0aexn feiad m2rlnvo;u4 reomr3iadoa rlnvi;t0t2tmimpoydal elnvil(fa2umur ou4aet mfeiyd s ra(mont)trxrmf ootomDean ol(0s2toir iodaptnmivsat srtru  ;u1opx  feiasfa2ul(ms;(0aetoxo3iy1om r u o;()s2xoim ny4lmt  fcilt a2um( pnu0ale iocilsfmDul(ms t)altoxo3iodomt anei t0tetmxrpnudomenmfetl()a2rrx p;o1tpx  ieiydlm2ul(mpn(0treoxfctydfmD an s;( teuo(o oy4lptelfcsa( srtmur ou0opx iociyt a ua( p;u)tleoif3todopt  n sls)sexoxrpnu4llt  ivsa(  2urxrpno1tetoiociyd a ra(mont0alxnir iatlptranvil(  2xmxopnydopeemicsat)s2rmxr oo1alx mfeiytfm2um(mo ()aetnxf oa1lmtrai s;s)t2ur(r3iudaltn fvs s)srrr(r nt1apt moctytla ea(vp;u)aexoirctotlmDraivsls0 etoir3iodlpenlieta(fa2rmxront1oee mfcias a ulu o;u4 leomr3tydoaDeanes;() eum(m3no4olt mnci s)artax pou1tlxoiicilsfs elump;u4aeeoir3oatfaDe i ilt teurxmpnodlp emnesat artaxm oo1tlx mi3ilsfmDemuvonu) exnxo3ty1faDr i sls srtoxopoo1alt  fcil(f Drr(  oo1tlxn ieiad m2ul(ms;u4artrmrcootopD aueil() eurxmpio4apte fvi (fsDua(mpoo4oltnmoctytfmDeanvo;u4 ltrircootlm e n ilt0 rtrxrpoodome mfvsas) 2rm( oou0aee mfeiltlm2eluvs (4aetnxo todlptelnvil( trtoirpnudopee icia() 2umxmpot1oexnmociltlmDrauvp u)tltoifcoy1fm elu sls0trxrir oydope lici s)s2rax pnu1tleo o3ilslm elnmsnu4 ltnxf oydoa e ivs (0tetmirpiodamt  ncils  Dta( pou4tleomoeiltlm ua(vs;u0 lxnxf3ootopDe nes;t  etmxo3iu4altnmfetas a2tru ont4alen oeiadls um(vsnu4tltnxrcoa1lm eln olt0s2uoir3oo1lmeelfcil( aruau  oo4tlto iciltfa raumonu4trxrmr iatfmtraivo;(0seuo(mpny4llen iviat) rum(rooo0opxomi3tad aDrmn o u) lxomf3ta1fmtrli ol( sexoxr3oy1al nmnvilt)a2tr(r ;u0teeomoeiasfaDea( o ()trtrxf3ta1lmtelnvs;(0texrir oy1lpen ictlt srur(r ;t4altn octas sDuan o;u4 renxr3iadlaD auvo s0sruoxopno1olee fetls s2rru p;o1oeen fciat sDua(vo t0teeoio ia1oatelnvi;()t2xo(r oo1lptn nvias)arrau p;o0alxomo3iys a2umnvs t4 eenio3oatfpDeauvi;t0trxrxo iu1ap n fcias) rta(mpnt4alx  ieias sDrl( s () rerirciytlpDrauvs;( tetrxm3no1lme mneia()artau  ;o1oetnii3iadla eanvsnt0 reoxo3totlpteauvs t)t2uoir nodlptelfvi t s2rmxr ou0opxomi3tydfa rmnms;(4altnmr3oytoat  ieols texmio iodap emivsa()arrmurpnt4aexo i3iydfaDelnmpn(0 rtnxfcty1omt  iei t) 2xr(r iu1optemicta()s2umxrpno4tpxn o3tltfs rm(vo;t4 etnio3to1lmD aivsl( trurxrpnu4ol nmfeta(  Dumumonu4tlxo oeiadfs2umuvs (0 rtrif iytoat  n i s)tetm(r iydoptnmics (fs2um(  ou1aex ioeiatfmDumnvs u0tetrmr3ty1fm r u o t tetrim iu4apee ivtltfsrum(ro;o0tpt  fetytfaDel(vp;u0altoif3oatom  luei;t0srurxr nydamtelfvi s) Draump;u1ale ifeilt m emu o u)alxnir ia1fp ean sl(0setoxo iudole lnvs (f Dum( pnt0oexoiieils s2rauvs;t)aetomr ta1laD li s;( seuoim3nydam  licsl()a2taumpnu0tet io3iysfs uau o t0trxnxocia1omDrlnvol()sruo(m iodolee nciasf Dumxmp;t4aleniiciasfsDelums u4trxnmocoa1fmt  neolt s2urxr iydol n icsas)a2trxrpou1tptoif3iat m ra(vonu4 ltnmo oy1opDran o;t  rxoiopiy1lmeelfcs () Draxrp;u4tptomo3iyt m2uan o ()alerxrciydfaDe uvs;t) rxr(opiudaptnmici s srtau  ou0aexnmoctyt a ul(vonu0trerxrcoatlp   nvi;t0texo(m oy1apt lietlt) 2raumono0ape mo3ilsfs2ua(vo (4treoxf3tytlpDr nvs (  2xrxr iy4ol  mivslsfa2ur(ronu4aeen o3iysls rmn o;u0 ltniocoy1fa r ivo;( teuoxm3nydol e nctl(  rtr( ooo4tltnmieiatla2emnmp (4 exrircoydlm ranvo;s  2umio nu4ole lnvs t  2um(mo;o4opx  ieils a2elnmp t4tlxrif iytoat  uvi;( tetoir3ou1al e ieils)arrr( pnu0tpxo f3iasfm uau onu0 rtnmfcoa1omt ai i;s  2xoirpio4amtemncilt)sDrmurp;u4olt ifciyt a2uanvp;u)aetnxo oodlat  ieo s0trtr(r3oudlm emnes t)sDtm(moou4opeoiieiysfa2rmuvont0aeerir iodoaDrln il(0srurxr3iy1ame mfeslsfaDtmuroou1oee  ieild m em(vpnu4tltrmo3oytoat an ols)t2trxm nu4lp  lnviat)arrmx ooo1apxn iciatlm ranvo (0 rtoir3ia1fpDrau o (  etm(r iy1optn fvi s)a2tr(ronu0tetnii3tadla raumon(0aeerxo3oo1fptelnvs t setm(o oudlmtemfctls)srumuro;u1teen feiyd sDrmnmp;t4arenmo3tytlaDrln s;t0s2to(r3oo4aleelict t)aDuru oou1opxn oetyslm um( p t)artrmocoadfmtrli o;(0tetrxm ny1lp emfvs (faDtmuro;t4opeo icias m em( p t4 rtomf3to1late u ol()s2tr(m iydoltnmfetas  2umx  ;o1tlx iocilsfaDrmn p;u0 ltrifcoo1fm ranvils s2um(r3ny1op  mivt s artmxm ;o1ole io3tat sDrlnmpnt0texoioctodoptranvi;t0trtr(mpoydope  fct sfs2trump;o0apxoiietls s2rl( o;(0tlxrmoctytlpDe n i s0t2xr(mpoo1ameelnctl()a2trum nt0aet mfcias aDuln o;() eeomf todfa rlieo;()s2xrxrpiy1lpe mietlt a2ur(m ;u4oee ifciad a eanvs t)aexrmr3iotfmDranvo;s) 2urimpiu4ap elnct t)srtmxr ou0tetnmf3iat m uauvont4arermfcoatomDelneil( srtoim3nu1om emfctls srtax oou4aetnmoeils s2ul(vont0tltoio oatlmt anvsl( setrxo3ou1olee fes (f rurxroot4altoifctatfaDrmump;()trxrxf oadlpDraivs;t)seum(opou1lpeelnvs s sDur(mpnu4oeeo fciys s2rau pnt)aetoio oytlmD auvi () 2umir3iy1aptn icia(fsrrm(rp;o1alxn icils s2ua(msnu4aeeoir oo1om   uvo t trtm(mpnu4lp emfcta()sDrmxmo;t4tpto fctasfaDulums (4arenmf3oodom e n s;t)texrxm3oo1olt  fcia(fs2ua(  ;t0tetniictld a em(vs u)texnir iodlp eli ols  ruoxo3oo1lleemnetat s2tmu p;t1oetn f3iad m el(vs;u0tetoir oytop eaneslt0teum(o3io4lm  lfct ()aDuaurpno4oex if3tasla uluvp;t4texrif3tatom  anes;(  rxmxopiodomtelfesa( aDua(rpou0oex mi3tlt m uanvs;t)trtrmf3iodfaDraueolt0seto(r oy1op   fvsas)arra(rpoo4teto oetysla2ul(vpn(4tltnio iotlp rlueils)teuoxo3oudam  lfctl(fsrtmxm oo1oltnifctlslm2rm(vpnu4trxoxf3oa1fpDrauvols0tetmxr oy4lptnlnvi s aDra(m ;o1apeo o3iys a emnvpnt) etnio3oy1oa rlivi s0s2to(r iudomte fviatf 2ta(r ot4tetoioctydfm2umn on(0tlxoxf3totfa raieols0trtoio no4lpe  iviltf 2uru ono0tex  fctldfmDra(vs;(0aleoxfcty1fm eli sl( srtr(m ny1oltnmnetlt) Duaumpnu0tetn ietad s rmumo;t4tlermo3ia1lmte uvi;s0s2ur(m3nu1lp nliesl() rua(  ;u4ale mieiasfm el( s;t)tltrmf3oydfa  an o;t0texmir3io1amee ieiltfs2urxro;t4tpxn ietytfaDuluvs u4 ltriocoytfa e ies;t sexo(m3oy1aleemfvtl(fs2rr(r oo0apt  feiadls eluvon(4tleoxfctodomDeanvo;t  2xoxo3iydamte nvslt a2uaxr ;u0aptn octaslmDra(vp ()altoio oytfp  au o;t trur(r iu1lpe lfeiltfaDraxmo;t4tlen feiyt s2eauvont4 rtnmfctydlaDraneil(0trtoxo iy1opte netlsfs2rrxroot0tptnmiciadfmDel( s;(0trerxr3oy1lm r i o s0seum(m3nu4openmnesas arrrxrp;t4tpeo ocils a2rmnmon(4areriocoadfmDrln sl(0t2xm(m nydlptn ivslsfarrr(m nt1opt  ieiasfs uanmo u)tetrmrctodop r ivs s0seto(m iy4lle micslsf rtaxmooo0opxnifcils aDua(vo;t4tltoir iy1fmtr nes () rtoim oodape  netas aDtrumpnu0tee moeiytla2rm( s;(4aetomr3iadom r n o;t0texmxmpiy4opt mncsltf 2uauroou1oeenmoeiydls ea( p;(4tetnxf3tytlptelu ilt  rxm(opno1am n fesls)a2tmxmpoo0tet  i3iatfaDrmu ont0 ltoxo3tatfmD  ivi;() eto(o3oy4optemictlsf Drr(r oo4oexniocias a2ulu on(4texoxo tatom raieils)setmirpiu1ame lfei t)s2tm(rpou1olxniictlsfm2elu snu4 exrxrciotomDean s s) etrirpoudlp elict sfarrrxmp;t4tlto i3iatls2ran o;(0aexriocio1laD aivsls s2toim3iy4ap emiesas)arrrx  nu1optn ociasfa ul(vs;t)aetrxf tytoatr u o t trur(r3no1optnlfei sfartmx p;o4aeen i3tas s ea(vp t4aexrxo oy1lpDeaues;t0t2to(o3nu4alee ieils)srrmu  ;t0aex  ociasfsDrau s ()alerio todfmDraues;s) 2uoirpoydoleelnciat arurx pnt1optn f3iatlsDea(vs;(4aleoxo ia1omDrli s;t0trxoxmpoy4amen nvtls) Duax p;u1apx ioeils s2rlu p u)tltrxr tatla   uvo;s)t2triopiy1ll elnetat) 2rmxm ;o0aleo ieiatlaDrauvon(0aeeomo iydomDraivslt0s2xo(r iodlle  nvsls) 2urumo;t1apeomi3tlt m2elnmp;(0tleoifciadfaDeau olt)t2xr(mpnydlm  livi tfsrtm(rp;o0aexnio3iad mDeanmon() lxrxoctodfpD lu s s) eur(mpny1al  mfvil() Durxro;u1aptomieils s ea(mpnu0 eermr tatfa r nesl( t2xrio3nu1aleemivsls sDrr( o;o4tetnmf3iytlaDumums;t)tetrir ty1om rlieo;t0trxr(o iy4ll nmfciatfarra( p;o0aeeo ieiltlsDulump;()aetniociydomD ln o;() rxr(m3no4am elfcil( s2urxr ;o4texo i3iat a umumsnt0 rtoxfcoodlm e ivsls)trtr(rpiydape  nct (farumx p;u1teeo octysfs2ul( s (4aleoxo iodlmte iesl(0setr(o no1lptn feilt)arra(  ot4apxnifctas s2ea(mpnu4arerir iytfa  lnvs;t trtoxr oydol nlnetlt)aDumxmp;o1opt mfciltla2umuvo;(0artrirciydlatrlueo t0 exr(mpoo4oltemicia(faDra(m oo1tex mictlsfaDra(msn()aeeoxr3tadlptr nvils) exo(rpiu4aptemivsa()arrm(m oo1alxo ieiltfs ua(mp u4 rxrxo3iadopDr ivils)seuo(o oodlm e fvtlt) 2trx pno0apt mieiydfa rm(mp t4 exoxfciodopDe n i t0tetrxrpoy1al n nvilt  ruax  oo0aetoioetat a em(mp t4tlxnio3tydlp e iesl() rxmxr3ou1lleelnes ( s2tm( ont4teeo octys sDrl(vp;u4 rtrirctydfat lu s ()sexr(o3oodlpe mneils aDtmx  no4ape  i3iaslm2eanmon() eeomo tytfaD anvs s0 ruo(m ou1omtn fcsat  rtrum nt1olx ioctls s ean s;t0 etrmo3tadlpDeauei s0seuoxm ny4alenmnes tfaDumu oou0apt ifeiydlsDelnmsnt)altrmocio1lmDraueo;t0 eur(o oo1alt lnci s)s2rr(mpnt1tlxnmociyt aDrm(ms;u) etriocoydlm elu slt0setrxmpoo1op n neils)sDtm( onu4tlxnmieiatla uln s u)trxnmf iatopt lnei ( trtoirpio1lp nliesl( sruau  ou0ole  ictlsfa eanmsnu4teeomf3oa1fmt lueols) rtoio no4lm nmnesa()a2tmurpnt1oeenmiciatlaDeln pnu4 lxoioctotoa eaieil( texoxr ou4altn nctasf Dum(m no1apenmociytlaDum(vsn(0arxoir oatla rlnvilt teumxo nodope  nctl(fs2ua(  ;t1tpxomietat aDuau o;u)alxnmr tytlm eanvo t sexmxm oudopeemfvsl()sDum( ono4aptomfetydls2uaumsnu0tlerxr oytla r uvslt)trxmxo io4al e fvs t  rtaumpno0oltoifctlsfa2emnvs;u0teenif3oy1fmtrln o;t0seto(o3iu4amt lnei ( arta( pot1alto i3iasfmDemuvp;t) lxomr oy1fmDrli o;s)sexm(r3oodomt mieta( arum(mo;o0aee  o3tldlaDrm(mo t4trenxociadom raieo;t s2uoirpno4alen fvi (fa2urxmono4tltoifcilslm umu o u4aetnxr3iytfpteli o;s s2trxm3ny4amtnlfcs t  Drax oou0opt mfetyt m emnmpnt)aleoxoctytoaDe n s;s)trxm(r3oudlp  lnvt s)a2tmumpnu0openiiciatlaDrm(vo u0 rtrmrctydfm elivils0texrir oy4apt mics tf rumx  ;o4tex iociasfm2ulnvo;u0artrxrctytlp  li s;s0srtm(mpoy4om elfvtas  Dumu o;u4apxnmo3tad aDeln s;(0trxoxr ta1oaD ai o s) exo(opiy4oleelies tf rurxro;o1oltn o3iys aDemnmp (0arerirciotlpD li ols)trtr(opoudll  mnvsatf 2rmur nt4oltn i3ilsfa rl(mo;(0 eerifctotlp   u i;t)sruoir3oy4op elfvias)srrr(rpot4tlx io3tld mDua( pnu)aexoir3oydfpD ln i s)t2umxrpoy1olenmivsat s2ua(rp;u1ape  ociasfmDelump u4teenmr oytom  lnvslt0srurim3iu1ap  livtl( srra(mp;u4opxnii3ilt a2umu p t0teerir3oo1fmt  uvolt0 exoxmpiudap nlfci (f Dtaumpou4aeenmi3iys m2rmuvp;u4tetnio3ootlaDrlnvilt setoxm3ou1ole mnvslt)arum(mont4opx mietlsfa emu pn(0tetrxocoytop e i sls0 2xmxo nu1ome mnvi t)arraxrpno1tlx  ociad a2uauvon()arxrif tatlmt  iei;t  2xoimpio1lm  mnvtat  2um( o;u4oeeniociydfs2ulnvp () etnmoctodfaDrluvs;t)tetrxrpou4ole mici s aDtr(rpot0aet mf3iltlmDumnmo u)artoxfcty1omD an ilt texr(r3ou4alte ietat)a2umxmonu0aeeo iciaslaDea(vo (0 rxomrctydfatraies t0 rxrxopiu4oltnmfesat srtaxm oo1tpto ieias aDrmu p;t4tltriocoatfa r n s;() 2uoiopnydam nmnci sfsrrrxm ot4apeoii3iysfm2rl(vp (4 lxoxo iydfa eaueo ()trtmim iy4ope lnet ()srur( pot1alto ietatls umn snu)artomr tatfp  auvslt texm(r3nu1omtn nei t)a2taurp;u0apxnmociyt m2ulnvpnu4 exrmf iadlpteanvs ( trxm(m3ou1opt licsa()a2rru  ou0oetoii3tysfsDrluvp;t4aeenmf3io1fp eaivo () 2xmxrpou1ll nlivsa( sDtaxmpot1ole mfciytfs2umnvs;t0tlerir3tydfpDraiei;()srtoiopiy4olt  ivtltfarrm(rpno1aet io3iyslm2umn p (0arxomo tadfptrlnes t  2xmim ou4amt lneils)arrrxmoou1olenif3iydfaDuauvo;u4 lxrxfctydlatr nei ()setrir3nudal  lictls)aDua(r ;t4aeeoiiciatls rlnms t)tlxomo ootfm elueo;s  2tr(r3oodape lict ( aDur(r ot0tex moeiasfa rauvo;() exoio3oytopDe neo;t0 eurxo3ou1oleelnvtatfsrurxmonu1tee ioetysfa2rmuvs;u4aetrif tydlm  aues s)s2tmxm nudom nmfcs s  rtmu  no1aptoifeiatfsDelump;t0texomocoy1lmD  uvi ( s2ur(o oy4amtnlfvtltfs2rru ono1oeto feiadlsDrauvs u0texnxr totlpte nvs s0 2uo(m io4am  mnetat sDta(r ;o1ape moetls m2rauvp (0tleoxfctatfp  ln i;( s2uriopnodamtn fetat arrau oot1alx ioetyslaDrmnmo;u)aexoif tydfptr uvsl( srxr(o nu1ame  ics ()srrrx  oo4tpx  i3iys aDuluvp;t4 eeniocta1lmD  nei s) 2umxm iy4ole licsat  rtaxmooo0ope moctydla ea(vo;u0 rtnmr3oytoaDe neslt)seurimpio1olen ieilsf Dtm(  ;o4oeeomi3tas m rmn p (0artomo io1lmtraieslt) 2xoirpiydlp e fcsas) Dumx poo4aeeo oeild m2rm(vsnt)tlenxr to1omDelies;s trum(r iydlpte ncsa( srrrx  no4aleoif3iaslsDeau p;(0arenif3oy1opDr u s s)srxrim3nodalt  ivia(f rtax  oo4tlx  ietytls eauvo;t) etrmf tadla eliei t)srxr(o3oo1apenmfesasfaDrau p;o4aexoifeiatfs2emn s t)trtnxf oy1fptr i i;( t2tm(o3ny1op e fvs s a2rm( pou0olenif3iydfsDua(vo;t)alxrmo3iy1la r u s t) rto(rpoy4optemfcslt sDtr(m oo1ole  fciatlm2rmuvsn()tetomf3oa1optr neols texrim3ny4llt miet s)sDtm( oou4aexo iciadlm2emuvo u0 exnxo ootfm elu slt) 2tmimpny4ome livia(f rum(r ;u0tpx ioetas a ra(vs t0 etrxfciy1lp   ivol() rxo(mpiudll n nei s s2rru  nu0ope  fetytfaDeaumpn(4trerxo3todla rlieo (0trxmimpiodom nmnvi tfa2tm(ro;t1tlxn iciydfs eaumon(0artnxrcto1lp rlnesls)tetmimpiodal n fvs sf 2rrx o;u4oltniiciaslsDrm(mo ()texnifctadoa e nvs (0seumxrpoy1ameelnetls) 2raum ou0oexn f3tyt sDea(vs () eeoxfcoa1laDeauvsls0 2trxm3iudamt lict tf Drmu oou0olxn f3iyd a2eanmp u4 lenmo3oo1la eaueil()truo(o iy4altemncsasfsDtrxm nu4aetn i3iad s2elnvp (4 lenifcoydopDe ueolt sexr(r oudamte icsatfs2taxr ot0tlen f3ilsls emumont4tetnmo3tytlmtrliesl(  2uo(opoy4op  mfesltf 2trx onu1oeto i3ildlm em( o t4alermr oy1op rlueo t0t2toxmpio1opte nctasfa2rrumono1tlxnmfctas s ranvsnt4teenif ta1faDraieo (0s2tmim iydopenlnci () 2taur no1apt mieiydfaDemu p;u0arxoir oydop rlivil()t2toim3iodolee iei t  Dtaum ou4tlx  icilsfsDumnvsn(0 etnmo3ootlpDelivs;() 2uoxm oodapen nvi s) rtaurp;o4apxniiciasfa2ranvo;u4 leomr oodoaDe ues t  rtmimpiy1lp  lictlt srtm(mpnt1apen oeiyt a eanvpn(4 lxnmr oadlm rlivs;( sexmxopnudal nmnctl()aDur(ro;o4tlxoio3tatfsDrm(vo;t) exoir ootoaDeaieo (0srurirpou1al  liesatfsDtax  oo4tpeo feiytlmDel(mp u4 ltoxf ta1opDeanvols0srxmio3ou1al emncilsfsrtmxr oo0optniiciytfa2eanvo t0altoio3oatlat  uvsl() 2trxr3ou1amee neta()a2tau  ;o0oltomieilt m ul(mp;u0aetnif3oydoa  anvi;s0trxmimpiu1lle mnvsatfaDurur no0aptnmieiydlm2elump (0trxrif3oydlmD anvil( t2urim3nodopee ivi t) Dta( pno4tetoii3tydfs2em(mpnu)texrio todopt an i;s0texo(r oo4lp   fes t)aDta(rp;o4oetnmfetldlsDuaumo;u4aetomf3iytla r u i;t s2toirpny4lpee fesat a2urx oot0olt  oeiatfmDea(vsn(0aetoxo iodlm   ueil( texoimpoo1llte net sfaruau pou1tetnmiciyd sDrln s t0trxrxr3iy1opD ai olt0trxo(mpiodaptnlfvta() Drrxmpou1oltomoetyd mDumuvo;(4aeeoir totfa e uei;s) rtrxr3ou4lmtn nctlsfa2ta(mp;o0tpxomf3iysla umuvon(0 lxnmo3iydlp e iei;s0s2uoxmpnodapeemnctasfsrtrumoot1ope if3tytfsDemnvpn() rxoioctytlpD  i s t)setmimpiydoltnmicslt)aDur(rono4ope if3ild s ulnvsnt)aeeoir3tatfpD  i i t  2tmir3oydlmt  icsas a2tmu ono0optomf3iysla elums;() lerir iotlmte n o (  rxo(opiy4lltnmfcsat)aDtmxmoot4altnifctytlmDrlnmo;t0 exomfcoytoaD  n ilt  exr(r ny4llt mfctasfaDtru poo4opx  feias mDrlnvo (4trxomr ty1lp rai slt)setoxo iodlptnmnesl(  2ur(rpot0tle ifeiysfaDua( p;(4tlxnio3io1latraieil() 2uoim3iodamen ies ()sDtmur no4aee mf3iytla rm(mon()teenxr3oa1fatrlieo ( t2ur(m iy1ale  nvs () Dta(mpot1altn f3iaslaDumuvp;(4arenioctatlpt livi;t)s2xrir ou1al eliet t  Dumxmpnt1aeen o3taslm emuvs;t4 ltomo oytla  aieo s)t2urxo3oy1lp   ivt s)arrauronu0tlxnifcildlm2emnmont4 rtrmr3tatlmtran o;t t2to(o iodaltnlncslt)srtau pno0oexn o3tlt s2umnvp;t)altoxo ia1laDeanvs s) eurio3iodolen icias  2tru pnt1tpxnmoeiaslmDean snu)artnxr ta1la  aivols0s2xo(mpou4lpee net s srtrx pou1tpx moeils m umumpn(4tetnmo oydfp rlneilt0trtoirpio1ome lfetat  2ua(rpnt1aetnmiciatfmDrau onu) etomfctodlmDeli ils sexoxr io1am  lncs s)s2rrum nt0olxoif3ild s ulnvpnu)tltoxfciy1lpDrau s ()teuoiopno4lp nmnvs ()a2rmx  oo0alxomieilslm2em(vs t) eenmfcia1oat  uesl(0trtm(r oodapenmfcs ( srurumoou4aexo ictydlm2rau p;t4tltrio3oydfm elueils s2uoiopiy4ll nmfei ( sDuau pou0oeeo ociytlsDrl(mpnu4teenxrctodomDeliesls)seto(o3ou4ap   ivils)s2tm(r ;o1tlxn i3tys s rlumonu)areoxfciatoatranes t) etoxo3no4apte ivil()artr(ro;u4optn o3taslm2emu p () renio3oydfpt ln o s0 exoiopou1lme  nviat  Dtau  nt4opxnmi3tlslaDua(vs;u)alxomf3iadopDeln ils0 euoxo ou4op nmfesa(  Duaxm oo1oeeoif3iadfa2ulnvo u) etoio3tatoaDrli slt) 2xo(mpiodlpeemnvt (  2tr(monu1opx iictys m2eln p t0 eeoxr todfpt aneo t  2xmxmpny4lmt mnesls  Drrxm nu4tptoifetys m el( sn(0 exoio3ta1omDe u ilt) rtoxo3nydoltemfvil(f 2trxm ot0aexoio3ias a ul( p (0aetomf oadfmD lieo;t0texm(o3iy4apenlfet ( aDtmxro;u0tlxniociyd m2ranvpn(0alxrio oydfat  nvo;()trxoxopoodal nlivs t a2ta(m ot4olen f3iysfa2umnvp;(4alxnmf tydlmt au o s0seumxr ny1llee nvslt) rtrumpnu1tpxniociydfsDranvs (0altnxrctodoat auvs;s0s2xoio3iu1ape  fcs s)artmx  ;o0oee ioeilt m2rlnvpnt0aeeoxoctodlaDrau s;t) rxrxo nu4lleelfcs ()a2urump;o4oltnioeiyt m2uanvo u0treoxf3tatfmt li sl( setm(o nudomte icsl(  2ta( oou1apenmi3iysla2uln onu) lerxr3totom eaivo;s srxo(m3nydamtnlnei ( arta(mpnu1teeniiciatfm umumon(4texomr3oy1omDrlueo;()trxrxm3oydale lfesls)sDtaxm no1alxniictadfs eanmp;(4 lenxf iadlm r nvo;() etr(r3nydopenmivi ( s2rrur nt1tltnmoctytfa2rluvsnt0texoxr3iydlaDrlu s;()teurxopnodapt mfvil()aDta(ront1oetomf3tyd aDrmu o t)tlenif3oodfmDeaivilt)trumxr3iudol nlfcsa(f Dtax  ;t0tee  iciydls elnmp (4aexnif3io1fate uvo;(0setr(r3iu1op nmnvtls srra( p;o4tex  iciatlmDum( p t)aexrif tatlate neolt)t2uoxm3ny1lp emfcsasfarrr(mpoo0apt if3tldla ra( o u0 etnxf oodlpDelivs ()s2uoimpiy1lltnmneil() rta(m ot4opt ii3iat m eanvo t) eermocoy1fptelieo s)trtmxrpoy1amtemnct tfarta( ooo1olxnmociytlmDeln o;u0arenxo3tydfmt au olt)teumimpoo1oltnmnetl(fsDraumont0olxoiictys m rluvpnt0 exoifcoa1oa elneo;(0 2xoxo3nu1ap nlfvt (fsrur(ro;o1tpx  ictlsfmDrl(ms;(0tlenxocoy1fmtrlneilt setrir3oo1ole lietlt s2taurpot4aleoifeiad m um( p;u)alermfciadom  auesls)s2urxopiy1ll n fvt tfaDua(m oo0apxo ociadfsDeau o;(0 renxrcootlm eaieolt  rxo(m3oy4ol nlnvtatfa2rau o;u1tpxnioctysfm2ulnvsnu0tlxomocoodlmtean o;()trxoxo iu1op elicsl()s2rmu o;o0opt mf3iasfa2umuvo t)teenmoctytfmtran slt)s2xo(rpiudomt  ics ()s2rm(mo;o1tltoiocild a2rl(mp;u0 rtnxf3oytfm rln s t)srumxr3iy1alen ies sfsDta(rpnt1tlt ii3tys m2ua(vpnt4artomo ta1lpteliei;(0trum(o3no1lp nlfei t)arrrx pno0oee ifetlt sDum(mpnu)trerxr3oy1faDrlnvs s) rtmxm io1ape lfvsa()a2rrxrpot1aptoiiciydfm rau p t)tlxnif3oa1op rlnvi s srtmimpoo1omt lfvi ()sDrrxr ;u1ale moeiat s2rauvs;u4tlxoxf oadopte nvilt) 2xmim3io4al  livils  rururpnu4tetomiciatfm2ra( s u0 ltrxf iodlaDe
\ No newline at end of file
@@ -0,0 +1 @@
+ueols0trumir3nudllt mivi ( arrrxmoou4oetomieiltfmDrau sn()altrmoctotfa  lu o t0teur(r ou1lmt lieslt) Drax p;t1alen oeilslm2em(mo;(4 renif tydfm e n o t)trur(mpiodlptnlnctatfsrtmur ;o1teeoiiciat a rm(ms;t4 exrmrcto1fa eluvilt0t2toxmpnydalt mnvsat  Dta(  ou1alxn ieiysfm2rmn s;(0 leomf3oo1fmDe nvilt)truo(m3iu1am e fcs s  Dumu  nu1ope  icilslmDemu onu4aexomo3totfaDean s s)trtoirpno4omt lfctat)a2tauronu1oeen fciat sDuanvon(0areriocoy1lp  an o s)t2umxm io1omee nci s srur(  no1aex  feias m2eauvo u)tlxomf tadoaDraueo t texm(m3no4am nlietls)s2taxm nt1apeo ieiat m2emuvs;()altnioctotoptelieslt s2trxopnu4al   feta() Duaxm ot0alt iictatfa elnvo t4 renxo tatoa e n i t)teum(mpnu4om   nci s  Draxrpoo0oeeoioeiadlmDrmnmp u4artrmo3ty1latrli o s)t2urio oudom emivtl( s2ur(m oo4texnmi3ils aDeluvp t0alxrxo3oatlat li i t t2urxm io4op nlfcsl(fa2rru ooo1tlt ii3ilsfa umnvo;()areomfcto1lmD lueols0trxm(o3ny1ome lnvt (faDtaxrp;u4oetnmo3tytfs2eauvs ()arxrmrcio1omteluei;s  rxoxmpiu4altemivtasfaDtaurpot0olxnif3ilsfaDuauvsn(4texnifctodfa e n i t t2xmxopnu1lmtnlfcsat aDrm(  nt0teeo oeildls ea(mo;(0 leriociadfatrlneo;s t2urxmpoodllt lfvil(fartrumpoo0altomfcild aDrln snt) etoif tadfpte ivilt t2xrxopoo1ameemfei sfsruaxro;o1alt  ociasfa umu o (0artnmr oatlaDelueo;(0setmxmpiodol n icta()a2tmxront0texniieilt m2ra(mo;u)texoifcoo1op e u o () 2trxrpny1amtnlncs t srur(mpnt1apxoii3ilsfs2rmnmp;()trerir ootfa r ues t trtrir3ny1op   icsl( a2ur( p;o1apeo fciat a rlnmp;u0tetnir iydlaDrlu s;t tetr(mpoodlm elicsl(  rrr(moou0tpt iietat a2ul(mo u)trenif3to1fmDe nvil( tetm(m no1lm emfvt (f rraxm ot4aet  i3iyslmDul( snt4aeermf3iytfm ean sl()t2uoir3io4amt mfvia() rtrur ;o4olxoiieilslsDul( o t4 rtoifcoa1faD  nvo t)srtoiopiodope  fvta(f 2rrxrpnt0tex mi3iltfmDrmuvsn(0 leoio3tadlmDeauvsl(0 exmxo3iodoltnlict t)sDur(m ;t0aet ioeiadls2uan s;() eerirciotom e uei t setmxrpiy1llenmfci tf rumxm nu0oet mieildlmDeauvp;(0 etrxoctydopD lnvo;s0srum(r oo1ol  lncsltf ruaumooo1oetoif3tysfsDumump t4trerif3oa1op eauvo;t)s2umxrpou4optnmivsls)sDtrumpnu0oetomfetlt m2um( s;u)tetnmo iytfpD  ies t srtmxm oo1altnlictls aDuaurpnt4aeeo ietytfa em(vp t) rxnif3oodop  an ols t2to(mpoy1lm  mncs s s2rmur nu4alxn octasls ulu p t)aexnif tytlmDeanvo s  etmxo3oo4alt lnes s) rur(r ot4apeomfeiaslmDrlu s (4trtomf oa1opD  i o ( trtrxr3no1aleelnvilsf Drrxm no0olxomf3tlt a umn s (0tetoxr3ty1la rlieil(  rumirpoy1lme mnvt sfsrrrxr nt1apxoif3iyt a2ua(mon(4 eeoxo ootomDrau il()srxoirpoudllen ivta(fsDumx o;o0oexo ociytfs2rmump (4 renxocoodlmt lies t0 etrim3oodlmtnlfcsas)sDumx o;u0alt  i3iydla2um(msnt4trtrxfcoatlmDrln i s texr(rpiodap  liesat  2uaumo;t0tet ioctltlm rmnmpnt0aetnir oadoa  lu ilt) 2to(m oo1lp e nvtasf 2tr(mp;t0altomfcilslmDuanvp u0 ltrxr3tatlat lu s;s0teurxr oy4ome lfvtlt sDtm(mo;t4tpxoioeiytfs emums u0alermo3iatla rlivo t0t2xoxopoo1omt lnesls)a2tmum ;u4tpeomocild sDrauvont4 rtomr3tydomD an i (  2tmxr3oo4lltnmictl(faDum(m ot1ape  ieiatls2uauvont4tetnxr3oo1omt livi;(0 etmxo3io1openmnvsas  Dumurpno0oetn f3iasfmDrl(von()texnmr3totoptrlivo s t2urirpnydlltelfvsatfsDtaur nu1tpxomieiasla2emump;t)tlxnxoctatlmD livols teto(m oo1opt mictltf 2rrum ou1optoio3ias mDemu onu) rtnxr3tatop r i sls0srxm(opio1lpeemietatfarumum ;t0olx mieiad s2um(vp u4treoio oodfa   neo s)tetm(r ny1lptnmnvilsfartrumoot1alxoii3ilslm uluvpn(0arxnxrcoytoa raivi;(0 etrxr3oydopt mieils a2tax  nt0aetn iciyt m2ulnvp t0trxnxfciydfpD anes;t0srur(opio4lltemnvtas)a2urumpot0opt  icils sDua(mon(0alxrmocta1omtranes;t)setr(m no1omeelfetltf rrax ooo4opeo o3iytfsDemnmont4 eeoir io1la r ivsls0trumio iydlptelivtl() 2rmx ont1teeniiciytfm rmu o t4aetnif3ta1fmteai i ()setm(mpoodap nlnviat sDraumpoo4aet io3iys sDrm(vs u) rtrmo oo1fmD li i;s0s2urir nodam   ietasfaDtaur ou4aeeo ociatfaDulums;t0trerircoytfpDe nei s0 etoxr3iudame lfvtls)srtm(m ;t1olx  i3iat m uanvp;(4 exrmrcoa1fatr u slt)s2umxm3ny4llteliviat a2tmxmpno1olx mf3iydfmDeanms;u) ltrio3tydlp rlieo (  ruo(m3nudll elfvs t  rtaxm ;u4olto oeiatlaDua(ms t)trtnxo3tadfptraneilt  rxrxm ny4lmenmncil( artmxmp;t4alx  i3iad sDuauvo (4treriociy1oat  ieilt  2xoxm no1ll elnci ( srrm(m ;o4opto i3iydlaDrmuvsn(0tlxnmociydfatelieols0t2tr(r ny1lmtelfei (farurx  nt1apxomfciad m ranvpnt)artnmo iodlp  anvs;( sexmio3io1ol  lict ( sDtm(m ;o1apxo f3tls aDrl(msn()aetnioctatlmDraivo s) 2tmxrpnu4lme mictls)artm(rpnt0tpenmoetyslm2rm(vonu)trxnmr oa1lmteln o;s t2tr(rpoo1alenlfes t)a2uau  ;o1tleniieiysfm2rm(vs;u0texoif3ta1lm   iei (0sruoxrpiudome lnvi ( sDururoou1oexoifeiydls2rlnmo t0tetnxrciy1fp e uvo;s) euoxmpno4lm emnvs t) Durxm oo0opeomieiad m rlnvpn() exnmr iytfpDran o ()sexo(m3io1lptnmfvsl(fs2rrump;u1tpxo iciat m ranvp u0tetrir3tatoa eli il( setmxo3ou1am nmicilsfs2tau oot1apx iiciys mDulums;(4artnmf tadoatrauei;()setmxr oo4lmtemfvs (fa2tr( oou4tpen i3tat aDrl(msnu0aeenir3totfm ranei t)s2xoir3ou1lle mici t) rtmu o;u4tpxomfctyd m em( p;(0 rtrxfctydlmD  nei (  2xrir nu4ll nmfviasfsrtr(r oo0apxnifciydfsDumumpnt)tltoxf oy1oatrlnei (0 rurirpno4oltnmfvt s s2taur ;u0aetomf3ilslm2ulnmont0aeerircta1opDeaivo t0trtr(o oo1lme micslt) 2uaum ;t0tleoio3iyd a rmnmsnu4 rtrxr3tadfmDr neo;()s2xm(rpnu4amt mfcils) Dumxr ;o1tlt ioeiysfa rm( s;u)artoiocia1faDeau s s)srtoxmpnydopee nes s)s2umuroot1alx  iciysfa2ean sn()artoxo oy1lpD li s t srtrim3iydamtn ncilsfarrrurp;t4oetoioetytla el(vo;t4aleoxrciydlmDrln i s) eurxopoudapt  fet ( sDrau p;u4optn oeildfa ra(vpnt4trtrmf iadfaDrlnvi (0teum(mpiodlpe mnctl()sDuru o;t0tpxn f3tlslsDraumo () lxoxf3oy1faDr i s t  2xrxm3ny1omeemfvt (f Draumpot0tlx  iciyt m2umn on(0tltnifciotom e uvsl()srxmio no1lltelnvilt)a2umxro;o4alt ifciad a2ean p;u0alxnio oatopDelivol(  rxr(o no1ll  mivslt) 2urum ou1apt mf3tatls2rmn pn()tltrifctatom eluvo;t) rxmxmpno4ome  fcsls)arrr(m oo1aptn fciadfmDrl(vp;t4tlerir tytop   u s;t0 exmxm3oodlpenlictat)a2rau poo1opxniieiysls eaums;(0 lxrxo oytfat lnvilt  2xoxo iu1omt livi t)srtax ooo0optnmietyt s2ra(mon(0 eerifcio1oaD  i sl(0t2toxr no1lltn iesasf Dumxront1tlx mfeiydls uan o;t4altoxf3tatlpDraneols) 2xrio3iodlp nmnvi (f 2rmum oo4oetnifciat a2em(vsnt0 rxomfciytlmt  ies s0t2xoir no1ll elnvtl( sDrrumo;o4tpx  octls sDum(msn(4texomo tytoaD aieo;s) exm(m3ny4oleelnetatfsrtmurooo0tee ifctlslmDulnvs t)alxnxr3oatop   nvs s0s2toir3ou1omtnlfvta() rraumpnt4altnmfciytfm2rln snu) etoxf iatom e ivs;()s2xmxo3iu1aleeliei s) Dra(monu0tlen f3tydfsDrln pnt0 renio io1la raneils srxrir nu1lm n fetat)a2trxm ;o0tleomociltla2rmuvs u4teenmr3to1fateai s ()t2tmim ou4olenmncsa( a2ra( ono1ale  o3iat aDeanmonu)arenif io1lpDrauvi s) rtr(o io1amte feils  rtrxrpot1tet mo3iat mDra( o;(0aeermo3oadlpt ai o;() exrxmpou4ap  lncilsfarur(r ;t0texomoctlsla eln pn()tetnxo totopD  ivi;(0 2tm(r3iy4lltnliei s)a2um(rpnt4teenioeiad mDulnmpnu0trxoif3io1fpDranvs t0t2uriopny4lpt  iet t)aDrru ono1oeeoif3iat s rauvp;u) exriocoytomtrluvi;s)sruoio iy1op nmfcs s  2umumpot1aet mf3iytfsDranvp (4trxoxf io1lmtelueilt0 2xo(rpnydlptelnct s srrmu onu0tlxoifetyslm2eaumo t0trxrmr3oodfmDrln s;( t2urxm io4lp nmfvs t) 2rr(  no0tpxn oetyt mDea(mo;u)alxrxr iatomDraieolt trto(mpiy4op   ivilt srtr(r no4alto iciltfs rmuvs;u4tlenmrctodopteauei;(0s2tmxm ny4amenmivtas a2umxr no1oee mfeiydfa raums u4trxniocoa1fp rlu o;( t2tmiopoudom   nes sf 2tau pot4alxo fetatfsDua(vs (0tleomf3tatfmDeli sl(0s2uo(m iy1op emneil( arrmumo;o0alenmfciat s rm(von(0texoifcoa1latr uvo;s0srxmxmpnudlptnlnvtas  ruaumooo4openii3tydls ran p;t0trxoxo oodlm elu s;t0teuo(r ou1llt lictl()artrxm nt0alx  f3tldls rmnvs;(0tlermf3iydlmDrli i t t2umxm3iy4om nmies s)aDtmx  no0aexnif3iatlm em(vonu4tetomr ta1fpDr ivi t0setr(o oy4oltnmivslt) rumxr ;o1tetnmo3ilsfs eluvs (4trtomrctydlmtr nvilt srxrir iodal nmiet tfsrum( pot1tlx mo3iydls2rlums;t4teermr iodlpteaieol( trxr(m3ou1ameemivs s  2ua(mpot0tpeoii3iadfa emuvp;u4 exnmoctadfpteliesl() exoiopoydopt mncsat)a2tr(r nt1aetn icildfm ea( p (0aleoxf3iodomD  u o s)s2ur(o3io4apeelnetas) Dtm(ro;u0aeeomo3iltfa um( p;t0 rtrmoctytfmt ai sls t2tmxr3iu4al nlict t)aDtm(  oo0aet  icilsls2emump;u) rtnir3tatfat anes;(  2um(opou1apt  neiltf Dtaxmp;t1oleo ieiat m2ua(monu)artoxr3iy1fm   neo s  2toxm3oy1ap  lneias) 2trxmpou4alxo fetydfa emuvsnu4 exniocoodla e uvs;t setm(r iydlpeemicsat a2tau pnt0alenmociyt mDel(ms t0teeomo iydop  luei (0setmim iy1lpt  ieta()arrrxmp;o0tptoii3tydlm2emnvsnt0trxrxf3oytfpD anei t) rur(o oydamt lnvil(fa2rr(mpoo4tpx mi3ilslsDumnvo t)aexrxfcoadoaD  nvsl()s2xrir3oy1omeemfetlt s2trur ;u0tetomiciat m rlnms t0tlerio iydomDr n il( truoir3nydome  fctlsfs2rr( p;t0opx iieiys mDrmnmsnt4tlxrif3ia1omDe nvo t teum(mpiu1lmenlfesat  2rr(m ;u1tpx  fetad a2ra(msnt)trermf oodlm e i i s)seur(m iy4ap e fcslt) Dumump;o0tpe iociadfa emumon(4aexrircoadfaD  ieo;s0srxoim nudop n ivi ( srur(m nu1oexn i3iydla eanvp;t)trxnxo oydom e i sl() rxoxm3nodol  mivtl() rur(rpot1tex  icildfaDulums u4trxrmr iadfmD  ues s texmxr iydoleelneiatf 2rrxr nu0tlxoifeils sDulnms;u)tetrmr3oo1optrluvs;()seto(m3io4ole mnvi (fsrua(mo;o4olxo ieiys s rl(mo;(4 ltoxr3oadfptrli s;(0s2tr(r3iy4ll  mncils arurxmp;u0teeomf3ilt a2el( o (4 etriocootfate neils tetm(o nu4amenlnvilt aDurump;t1opxnmfeiytlmDra(vonu0areomo3tytlatrlnei;t0trxoim iy1lpee nci sf rrmx o;o0aexnmo3iasfm2emums (4aetoxr3iydop   ivi t texoio iydolenlfcs s sDtaumpnt0olxn ociydls ra(mp;t0 exoxr todla eaivils)s2uoxm3iy4al e ivtls)srrr(  ;t1tetnii3iatla2emuvon(0artoxr3ootop raies;s0texoxr iydopeemfvi tf 2ta(m oo0aex mfcilsla emu o;t0 ltnmfcio1fa   neo;s)setmxmpnudol e fvt (fa2trxm ot4alenmi3tad sDea(vp;(0tlenxr3oadla elneslt0teur(r3nudapeemfvi ( aDua(  ;u0opxn ictadla2rl( onu4 rxomo3oadla  anvs;(  2tmim3iu1omt mfvta()sDrru ono1tetoioeiatfm rmnvo;t4tetnxrctytomt  n sls seumxrpio1ap emietatf Drrxrpnu0tee mf3ilsfm2uluvo ()alxrmr3oa1lmt anvo;s) 2trxo iu1ll  livtls)arrr(r ;u1tleoioeilt a ulnms t0 eeoio3oydop  anvsls0 rtmimpnodap e nctasf 2uauro;o1tlxnmfctyslm em(mo;u0 reomo3io1lm eanes t)s2xriopnydole lnvi t) 2raxrono4aexoifcilslaDea( s () leoxr oadom e ieo s  2xr(opnydomt  nvils s2rrxronu4alxnmoeildfs2um(vp;t4aetoio ta1lpDelueilt  etoir nu4ol nlncsat)artmxmont1olt iociatlsDemu snt0 reomo iadlm  luvi;t trtrxopoodop  mivsasf Dumurp;t1optnio3iatlm2rl(monu) lxnxociadlp rau o;s  etmxrpou4ap nlici (  Duaxmo;u1oexoifeiaslsDea( o;(0aetoio3oodfm  lu i;s srxmim io1oltnmnciltfartmu  ;t4olen oeiadfsDranmsnt0texnxf oa1oaDr i il( seuoxo3ny4am e nvsasfaDur(r nu0alt mf3iydls um(mp;(4trxnxrcoytoa  anvi s tetmxrpiy4alte fcsl(fsrurx  nt1opxoioetysfa2el(vp;(4tltnio ootop  ai i;t)t2xmxopiy4lpt mncs ( sDrrurpnu0oee moetyd a2emnmon()alenxfctotlmDrlnei t0tetoiopnudoltelnetls)srrmxmoou0tetoiictls mDumnvs t4alxnxo3oa1fpD luvs t  rxo(rpnodam   fvia()srraxmpnu0tex  fetat a eluvont4aexrmo iydoate iei;t0sexo(mpoo4ap   ieil(farrrx pot4tpenio3tls m rmu snt)arxoif iydfp elueols)t2tm(o no1llee nvtlt  2tr( o;t4tleniieiltlaDuauvp u)tltoxo3oo1fp  aivi;(  exrirpiu1lpt licilt sDua(ronu0altomoctytfsDrm(mpnt0altoxf3tatfmDe nei s0s2toir iu4lpt  nvs s)srrm(  ;t4oeeoifetatla rlnvp (0altnxf3iadfptelu i;(0t2xoxo3oy1lmt  fct t) rrmxrooo0tlen f3tadfs2ulnmpnt0 etoxfcoytfm rli olt0texm(opny1amen nctl()s2tmx  ou1oltomieiytls ulnmsnt4treoifctodlp rlieol(0tetmxo iu4ll   fvta() rtrxm ;t4optnmf3tldfs uluvsn()tleomo3iatfa eanvo;t)teumio3no4lleelfvsas)srumx o;u0opt  ietlsls2ulnmsnu)areniocoa1lm  lueo ( sexr(m3nodal emieiatf 2rmx ooo1opxn i3ild aDrlu p;u4 rtrif oy1optelneilt0trxm(m iodll   icsls srrmur ;u4opxn iciydfa emn sn(4 etoif3tydlp  aivilt) 2urxm nu4ope  ietl(  rtr(mpnu4tle iieiaslm uan pnt0 rermrcia1lmDr n i t srxo(r3oy1opte fcs tfaDtrxmoot4oetnmfcildfa uln s u)alxoifctydla r n i s0s2tmxm nodomt lfeiasfaDrauronu4oet mfeias mDumuvo;t0altrxocootla   ieo;t0 eurimpoo1ome lictl()a2trumo;t4oexn ociysfmDrlnvo (4tleoxr3iy1fpteau s;( trto(m3iy4alt lnvsl(fa2uaxmo;t4tex ifciydfm2ua( on(0arxoxr3iodfpD livs (  2xoxopiudaptelnes t)sDrr(rono1ape ifetatlm emump (4treoir3ty1faDranvsls  2xr(m nodamtnlnei t)srrr(m ;t0tetnioeilslmDumnvsn()treomr3tydom   n ol(0 2uoxr oo1lpt  feta() 2rm(mp;u4ale  f3tld sDelu p (4tetrxfctydlptelivi;s0trxmxm oy4opt mnet s  ruaxr ;o1oexomo3tls a2raumsnu4aexoifcia1la eaneols0sexoiopiudlp e nci (fsDrax pno1tlx  iciasfa2em(vpnt0aetnxo3oytoat lu sls0 eur(opoydap emnvs tfsrrruronu4tlto oeiyt a2ulu snt)aeerio3ty1oa  an i ()s2triopiodaptemnesls a2tmum nt1tetnmfetasfaDuau sn(4 etoiocoatfa   uvol()trtr(o io1lp elfetlt sDur( o;o4tetnii3iasls rmnvp (0areomr3ta1lm ranes t0s2xr(m io4altn fes tf 2tmurpno0tlx  ictlt aDrauvp;u0aetomf3ootomtelivil( trtoxr no1am  mivslt) 2tru o;t4tpxniieils m rl(mp u4aeenxfcia1lptr ivo;s) exoxmpnydap  mivsls  Drrur no4tptoio3iatlm ea(msnu4 etomrciydlm  luvslt t2xoxopnudoptnmneils)s2taxmpot1tpe ifcias a2ranvpn(4 reoir3tydfm e nvs;s  2urxm oo1oleemiviatfs2rr(ro;o4tpe  ictat s2rm(mont0 ltnmr3ta1op elueslt0 rxo(m ny1al  lnesat)aDtm(rpnu1oetnif3ias a2ra(vo u) ltnmf3tatfp rlnes;s trxr(r oy1aptemivtl( a2uaum ;o0opeomoeild a2uaumsn(0aexnif tadlmtrai ilt0srxmxr3oodalte nvtat aDtrx o;u1tptn fctat aDul( ont0alenio3oy1lpDe u o s)srtoir ou4apenmncsltfa2taxr nu0opeoiietld mDulnmsnu4trxomo3tadlmD  nes s0srumxrpoy1am   nei sfsDumxro;o1tlenifeiadlm2uauvon(0aeenmf3iatlm e u sls s2xmio no1al  lnct ( aDrau ooo0optnmi3iasla2rlump t0tleoio3ta1lmDrauvo s0trumio3nodam elfcslt a2rmur ;o0tpx mo3iat sDrm(mo;u)texoio totfm raneo s)t2tr(r oo4lp nmics s)a2umu  ot0olenif3iltla rlumo;u0tlxrmf3tatfm rai ils)sexo(mpoy4lmtnmnctas aDrax pnt1apeo f3ias m2rmnvon(4texnir io1fpDean i;t0trxoirpou1apt  ieils)arumxrpno1olx moctytfmDua(vo t4tlxrxr iatlm r ivs;t srtrimpoo1ll nlfcsat) 2rmx p;o1apxn ieiys sDea(vsnu4artomocto1fp r nes;t t2toxm3oy4al  mies t)sDtmu  ;u1aeen feiasla2ulu p t0alxnxo3tadopt an o;t0 euoimpnodlm nmfvsasfarum( pot1ope if3iatls2ua( ont)tlxrmfcoydlpDeln o s srtoimpnydal elfeia( sDrm(mooo1olto fcild mDumnmp (4aexoif iy1lmt luvi s teuo(m3nu4al elnvsa( srtm(r no0texomo3tasfa2umu onu4aexoxr oy1fm  li o s)trumimpoo4om  mnet s  rum(rpnt1oleomoeiltlm um(vp;(4aeenio oydomD au s;s)s2uo(o no4omeelfcs (fa2umxrp;u0aeeoii3ildla2elumpnt4 rermrciatfpD  uvi;t0 2to(r3nodoltnmivsltfartrxrpnt1olto f3tadfs2uln p t) rxrirctodomDran i;s)t2toxmpoy4lptelfctasfsrraxmo;o4aetomociasla eln o u4 renmf todomDrlu o;t)tetr(mpnodaltnmiei tf rrmu p;o1oeeomi3iytfaDul(vp;t0 exnxfcoatomt aies (0t2tm(opny1omt mfct s s2rmx oot4apxomoetlsfa el(vp t)aexnio3ta1fmD aies;s)trtm(o3iu4altemivtasfs2urxm ;u4alxo oeiltfm rmnms t0teeomo3oodlaDrlneolt tetmiopnu4lmeemfeiasfaDraum oo0aetn oeiyt s uluvo u0aetnxo iatomt  nes;(  2trim io4lleemnvtat) Dur( pnu0aeen iciydla uau s;u0 exnxf ta1oa  livi;t  euoim3iydoptnmneiat)srur( o;o0oex miciydlmDeau o;t4 lenmocoytoa rai i;s trtrio oydapt lnvtlsfa2tmx pot4tee  ociltlaDra(mo u0teerxfctytlmDeli olt sexo(r iu1lptn netl()srumxrpnu1oltnmfeiys a rmn p;u0 lxnxo ty1opt li s;()t2toiopoodlmee neia( arrrur nt1tlt ioctlt a2umnms;t4tltnmf ia1lat  u i t)s2xrio3ou1amtelfcs s  rrmx oou0aet  o3ilt m ulu p;t) ltrirciy1oa r ueolt  etm(r ou4lm n icslt) Dtm(rp;t1opxo o3tldfs ulnvo u4 eenmrcoo1om eanvo s0t2xm(o3io1om nlictlt)artaurono1opt miciys mDumnms;u0artnif3iy1oaDelneols0t2umxrpnudlp  mivi t)s2urxr oo4ale mictydfsDrm(vont) renmociytfa  lueol(0 2xrxo oo1llen ivil()arra(mpnt4tpx  feild aDulnms t0 ltoif3iytoaDeln s (0seur(m3nudaptnlnes tf 2uaurp;o0aleo feiadfmDranvsn() rtomf oodfmD au i t0s2uoxrpou1openmnvi ( s2uaumoou1tltnmieiadfa uanms u0 exomrcoy1lmtelivil( teuoxopnu4opt mnesa(f rumx  nt4tpe ii3iasla rmu p (4 rxnmf iodfp e u o;(0s2urimpiy4op emnvta(fartmum nt4texn ieiyd m rl( p;u)aexnir tadlm r n o s0srtrirpno1olenlfvtatfa2tax  ;o1apxomfeiys m ua(ms t0 rxrmo oy1lm   ivo;t  2toxmpnudape lieiasf Drau  oo0tee mictlsls2emnmsnu)texrif3tytfaDraueil( s2umim3ou1am  lieta(fsDta( ono0oex mociadfs2uauvs;(4trtrxo3oadoa  aneilt setoxo3iodom elnetlt)sDrauront4ape ifeiatfs2ea( onu) exomrcoo1op  lueols)trxmio3oo1lmtn fetls)artrx  oo4apeoiociydfs ea(vp (4tlxnxfctodoa rai ils sruoxr oy1amee nctatfarururpou0tlenmo3iad m emuvp;(0aeerxocoatlmDeln i s0 rtmir oydole lnvias  rtrurpou4olt  ietyt sDeluvpnt0arenmo ia1lmt ln s;( t2toimpno4lleemicsas  Dua(rpot4tpxomo3ildla2rmu pnt0 rtoxf io1lp r ieil(0tetr(m3no1lmeelnet t)a2tm(rpou1tpeo fctadla2umnmp;t0 eenxocoydlpt  i s (0 rxoio no4lpte ivils) Draxmonu0oetn fciyt sDul(vpnu0aetniocootlpte n o t) eumxo oodop emiei (f rumxroot0oet  feilsfa2rm(msnu) lxnifcoy1laDrai s;() rtmio oo1opte fctlsfsDrrxrono4tleoifeildla2uaums ()alxomr ty1laDeanvo (0 2um(mpiodole miesltf rrax pno1ole mfctldla rauvo;t0alxoxf3iodomDr n sls trum(m3oydamtnlfet (f rua(mpou4alen o3iadfmDra( pn() exoifcoytoptr uvil() 2triopio1ole  nesl()sDumum ot4oltnii3tytfs eauvo;(4tltrir3iydomte nei s0t2tr(o iudoptemnctls sDtaxr no1tleo ietltfm em(mp (4 reomf iodop e neo;() euoir iudaptelfct s)arua(mpno4tpt ifeildfa2emu pnu)tetnxrctytopD liesl()teumim io1optelfvs t) 2ururo;o1tlenmictys mDeln on(4 rxrmr oo1lat livol() rumimpiy1llt mfet (faDua(rooo1olxoiietys s2rlu o;t0arxnmr iytfpt  n s (0texoxopio4lmenmfesasf Dra(m ou4alt io3tls aDeanms;t) lxnmo tadlmt aiei s texrxrpoy4om  licsas  2rax  no1aexoio3ilslm2umumpnu0arxnirctadop eaivs s) eum(m3iy1alt lneil(f 2um( oou0tpxnif3ilslm2eanmp u)aeerxrctydla r ues;t  ruoio ou1om elfvta( aDtm(m ;o4aptoif3ildfsDeanms (0aeerxr3tadfpte ues ( trurim iy1lltelnci sfsruau oot0aleo ieiltlsDumu pnu0 lenif3tydfp r nei (0 eumxm nu4ll   nvia()srumu  ou4aetniiciadfaDem(vp;t)aeeomo oatla elieolt) 2uoxrpiu1ale mfet (farrr(rpot0ole mfciysfm rluvp u0aleoxr3iy1omDr ues;t trtmxmpio1amtn ivsat)aDuru p;t0teto ociydfa rmuvp ()treoiociytfpDrlieilt)s2um(r oydlltn feslsfaDrr(moou1tptoiociadlm em(mo u)tlerxoctadoatrau o;t)setmxr nu1ol nmfvi s) 2um(r nt0opt mociys sDran p t4teeomrcia1fp  luvsls seurxo3oudap elietat)aDrr(ront0texoioeilslaDrluvo;u4arxnmr3ia1opDelivs;t trxmxr3oodop elnvtasfa2tm(m ;t1aptoifetysla ulumo;()texnxo3iydop raiesls seum(opou4amtemnvsasfsrtaum ot0tleomfcilt s elu p;u)trxnmocta1latrauei (0 2urir ny1ame lictat)a2ur(mpot1aeen feiad aDemu onu) rxnmrcoatfm raueolt0s2uoimpno1lm e fvia(f Dtmurpot4tpxnmfeias mDemuvpnt4trtrif3totom  aiei;(0srxo(o oudoltelnvtls) 2rmu  ;u1optn ociyd aDrmumo;u0texrio3ty1optr ues s)srxoio iu1alen fvil()aDurxmoot4ole  oeiaslm2ranvp;(0 eeoio3tadlp e uvs;t0texoio3oodap   nvia()artm(mpno1ole ifetltfaDrm( s (0trxoxocio1fa eanvilt) rxoxm ny1ape lfvias  2ra(mo;u4teen o3iasfm2eauvon()tlxrir ootom r ues ( s2xmxm3ny4am elncilt a2uaxmont4altomf3ilsls2rmnvpnt0alxnif ootlat liei s0 etmxopoo1ll  mfvsls) rta(rpot4opxnioeiytfsDul(vp t4trxoxo oydoa  aivils) 2um(r3ou4lp e ivils)srrruront4tlto i3tytfm rm(vp;u4tlxoxf iydfmD livo s) eurxo iu1ap   ictl(fa2ur(  ;t4tleo o3tldla2em(msnu4alxnxo iadop eauvi (0 2umiopiu4optn fvias)a2urum nt1aeeniicias s uluvo u0tltnxrciytfp eaueol(  2to(opou4alt mfet (  rumumpot4olxomf3ilsfs2em( s (4aexrmrcoa1oa rln il(0trtoxopoy4omt  ivia(faDua(  no1aetnioctatlsDeau snt0 etnxrcty1fat aivol() exr(rpio1al n fvils  rrmu  ;u0olt mo3iytfaDrau ont0 eerxrctodfpt  i o t s2umxm iydaptelivs t) Drax p;t1aleoifciatfaDeanvs t4 exrir oa1lpD luvolt0teuo(m io4oleelnei s)a2ta(  nt1tptomf3iydla2elumo;t0 ltoxo3iadoate ueols  eumir ny1amenmiesl(f Dtrxrpot4olxnmf3ilsfmDulump;u0 etoxrcoa1opDe uvs s sruoxrpoo4am nmfcsasf 2taxrpno4aleniictysfaDrmnvpnt0 eenxrctadlp eau i;(0seuo(m nudome  nvil() Dtrxmpot0tpx iocilt aDrmnvo t0aeermf3iodlmt anvil(  rumxrpnudopte fctl(  2uaurp;t0aet mictad m2umnvonu4 reoxrcia1lm   nvslt)t2xmir3nudol   fct ( arrmu  ;o1tpxomicias a2um(ms ()alenmo3iodfmt  u s;t) 2trxr nydalt mfeias  2trxmpou1oex iieiatlmDumuvp;u4trxrir oytla rlues s) 2urir3io4oltemnvsat)a2raurono4oeeo o3ildls2uau s ()tlerxo totlpDe nvs t0texr(o iodapen iesa()arumumpno4texnifetyd m2rln s;u4tlxrxrciatfpDeauvi ()trtrio3oudllen fctls) Dtrumonu0opt mfetlsla2eauvs (0artoio3oodlmteanvo ( s2tm(o3nu1opeelivsl(  rtaxm ;u0oltn iciat aDranvo;()trerif io1oaDelies ()tetm(r iudope  nvia(f 2tax oot4tptn ieiytlm2rauvsn(4trxrmr oatlp ran s;( teto(rpoodol n nct tfsDtmxr nt1oltoifciydlaDrluvo;(0tlerxo3oa1fa   ivo ()texoim no4lle lfetlt)s2ra(m ou4tpxo i3ildfs2rlnvont)trtrmoctotomDranesls0t2urxm3iy4al emieilt  rraur ;t0tet if3tytlm2rmnvonu0 lermrctodfp rluvo ()seumxr3nodaptemfct tf 2ua(rono1tet moeiasla2um( pnu4 exrirctytoaDrauvsls)trxmirpnydom   fct ( artmxrpnu4tltomoeiyt aDumu p ()aexrxr3iatlmtr nes;( srxr(rpio1ame  ivslt)arta(  ou1olx if3ildfaDuanmp t)alxrif3iy1fatr n o (0trxr(rpoudale  nvt t)srua(mo;t0altnifctad s uaumo;(0 lxnxr oo1oatr i ols  2xoirpio4lle  nvs t) 2raxmono1alxoii3ias sDumump;t) lermo oo1omtrlivslt0t2to(r3nydamtelfvtasf rtr(r oo0olxoif3iyslaDranvp ()tlenxo iadlm r u i s)t2xoir ou1lpenlivtls  2taxm ;u4tltomfciaslaDem( p t0tltnmr3oodlm  lues (0 2xm(r3oy1ope  nctl( artaumont0olxnmi3iadfa2rl(vo;u) rtnmo tatfpDeaies;t0 rur(r iydlmee iciltfs2raur ou1tpenioeiysfa2ulnms;(4alxnmocoydoaDelneil(  rum(o io1am emieslsfa2rrur oo4tex io3iydls el(vont0 ltrmf iatlmtelu o;t)s2um(m3ou1ap elicsls  Duaum ou0optn o3tld mDrlums;()tlenmoctatfatr u sl()s2tmxr3iu4lle mivsas sDtr(m oo4aeeomfctyt a em( p;t4 exrmrcoydomt auvi;s srxmxo no1aptnlnet tf rum(m no0oleo ietlslaDran s;t) ltomr to1lp  an i;s srumim3oydolt mfcs sf 2raxr nu4aeeomi3iytlm2emnms;u4treoxr tatlaDeli s ( t2ur(rpiu1lpen fvta( srtr(r ot0alx mf3tat aDrl(msnt)artomocoatfpt au i t0sexm(r iodllt mieilt)srumx ono0aetn ociyd a rm( o;u4 lxoifcoatoptranes (0trtoir3ou4alt mnvt t)aDuax pnt4olxo i3iltla uau s;u4tltrmo3tatfaD  ueo;t)srxrim3oudoltn ici t s2trx oot0alxn o3tytfm elnms (0texnxr ootlmtrlnei () rtrimpiudoleelici (f Dumu pot4apt  ictyd a em( p u) etoir iatla r ies s trtmxm nudape  ietas aDtrur ;u1apeniocilt m2ulnms (0altrmo3io1fp   uvol( srxo(o3oodop e fct s  Dua(r ;u1teeo ocildfsDemuvp (0arxnir3iydfmteaues;(0sexm(r no1ameelivias) Drau pnt1oltn feiltfs ea(vpn(0 rxnmr oodomt  ieo (0s2xo(opoo4am n iei sfarrmxmp;o0optomi3iltfa2rau p;() eermo3tadlptrlies ()sexrim3oudlleemncias)sDtrxmoou1teenio3iytlsDuanvp;u0tetnir3oadla rliei;t0 2xrir3iu1ol emfcil()sDumu ooo1alx moetysfsDrau o (4 exnir oadfpteaneo;t trum(m oodlmt lnct tf rtaum nu0tpxn o3tatls2ua(msnu) rxoif3iotfmtr uvs s) 2xrimpou1op   icsl(faDuax oot1ole ii3iad aDel(msnu0artnmf3iy1lptr ues ( seumio3ou4lp   ivtltfsDurxr ;t0olenio3tysfa2ra(ms;t0 leoio3tytfm eluvi;s  2ur(r3nu4am n ivs ( sDtaxmonu4tpxo ieiys a2umn sn()teenxf io1fmt  ivols)tetrirpnodlmeelfcs t) 2tmu onu1altomo3iytlm um(vs ()tetrirciatlp  anvsl()seto(m3iudomenlfeta( arrm(mpnt0opxn oetldlm emn p u4teeoirciydoa   i i;t)tetmxo oodom nlnesas a2rruro;t0opeo ieiydfa ulums;t)alxrxfciydfaDe nei t  2urir3no1ame  ieias)sDur( poo4tlt iieiytla el( s () rtoir iodopDelies;s t2urxr ny1olt  net tfaDrau  ;u0tpeo feiatla2rlnms;()treomr iadlpD auei;s)srxoio3iu4aleelnvsa(  Drrurono0teeo i3tydfsDelumo u4 etrxf oy1oa rauvils)s2xrxm oy4opte ivs s) 2umxrpoo1apeo ietysfa2rmn ont0aexoxrciydopt lnvo;t0t2tr(o oo1lmtnmfesat)a2ur(rpot0olx  ocilt m ranmp u)aetoif3tydopDeai ils  eumxr ny1apeeliciasfs2urxroou1ole io3iyt s2rln o () etnirctodopt an s s s2tm(opio4lmtelivtl()aDtrumpoo0aex  oeiaslaDrmnmp (4tetomo io1fat luvslt0tetmir3nydam  lnetltfa2rr(mooo4tpxnmo3iad s emuvs;u) rtnmr totlp rluvs;s0 2xmxo3ny1ale  ici ( aDrrxr nu4tltoio3ilt s2eanvont)aetrxrcto1fate nvo ( trxmio3ny4op   nes sfsDtmurpot4ole mfeiasls rlu pn(4trtrmr oadop rluvi;( t2xo(m3iudlp  micil(fsrumurp;o4aexomiciatlsDeluvp;t4 lxnxr to1fpD li olt)texrimpno1altnmictls)aDtrx  nu1aexniieiydls2umuvo;t4 rxnmf3iadlp  lnvol( s2urxopoydllt lieslsfa2uau onu0tle miciatlmDrauvs;t0 lxnmo3oadla r n o (0srxrirpio4altnmneilsfsrra( ono4aeeo ieils a emump u)trxnio3oadfmte nvslt0trum(rpiudaltn fviatfaDrm( oot0tlto octatls2ulnmp;(4 rxomrcia1lm   nvi;s0 rxm(rpiu4lmenmictl( srumxm nt1tltomoeiadls ua(vpnu4 leoxocoo1fmtrlivi;s)srur(m iu4op elivs s)arum(moot1texn i3iasfa ua(vp ()tlenioctatlp eau s;t0srxrxr3oudomtelnciatf 2tm(rp;o4tlto o3tatfm emnmont4artrxfciatfpD aiei s) 2tmir3nodap elfet t  Dur(mpno4tltnmf3tltla ran o () ltoxfcta1omtran il( trumxmpnudom emfvilsfarraumont1opx iieiydla rmn s;t)aexomo3ty1laDeluesl(0 exr(m ny1olte iciat)arum(  ;u1texo i3tas mDrluvonu)alxrxo3oatop e uei t0 rtoxm oo1lpt  ncsas sruau pnu0alx mi3iydfmDrmnmont0altrioctatla eaueo;s0 rtrxm nu1altelncilt)arum(mpot0olxo fciydlaDulums;t)aexoxociotlpDe nes s0trum(rpoy1lpenmicia() rtm(rpnt1tee  o3iys m em( ont0arenio totfatr ieo t0 2trim3ou4omt  fci t aDtm(rono1tpxnif3tyd sDuaumpnu) lxnmo oodfmteaieilt)seum(m3ny1om emfvtlt srrru pnt0optn ietatls ulnmon() ltrmf3ta1oaDr ueo (  exmxr3no1ap elfvtas sDrrx ooo1oee ii3ildfa ean ont0 eeoif tytomDelivs t) rurim3nudameemfvt (f 2rr( poo0aet miciat aDeluvo ()alenxo iadlptrlnvols0 rtm(opoo1lp nlici tf Dur( p;o4aet ioeiys mDel(von(4texomoctodom   u o s0seur(o3oo1ame mnct t s2rmu  oo4ale mietyd s2ua(vp u) lxoio3oy1lmteau s;s)srxoxo iudlpt mnctl()srraumono0alto oeiadfs2rlumpnu0artrio3io1lp eanei ( s2trir nu4altnlnvs sf Drrumoot0texnio3iat s ulnmo t4tleomr3ootlptrlnvi s  rtrxopoodome  nciatfsrtr(mooo0openiicils sDulnmp;(0trxrio3tytlaD  uvs t  2to(m3io1lpe  ivs ( sDtrxm no4oee ioetytfsDrau snu0 lxrmociy1omtr ues (  2triopny4amtnlfvias arra(m ;u1tpxo fctls s2elu sn() rermf ia1oaD lnvs;t)s2uo(r3oy4al nlics s  rra(roou1oleniicilsfsDumump;t) leniocio1lptrlieo;()teuoxo3io1apen feiasfarta( p;t4aee mietatfa ean o;(4trxrifctytopD ai sls s2xo(m3iu1lp nlneia(  Duau  nu0ole  f3iasfm rm( o u4 lxrmr3iatlp ranvolt texoxr ou4am elieilt aDua(  ;t1tpx mf3iyt sDrm( snt0aleoio oodlpD lnvi;()t2xrirpnudam  mfesl()sDur(ront1apt moetlt mDum( s u4tlenio iotoa  aies t  rtr(m3iu1lpt lietasfsrur(m ;t0opeo feiadfa2elnvp;() rxrxrctydfat auvi t)teurxopny1op   fetat)aDua(  oo0oetnmf3tls m rm( s;u) rtnxo ootlm elneslt0 2toxm3iy4amtn nct tfs2rmxr ;o4tlxn o3ilsfa2ul(vs () renir to1lpDeluvi ( trtoio3iu4lp emfvt tfsDtr(m ou1tltoiictydlsDrlums t4tlxnir3todfm raueilt)t2tm(r3oo4om elnvilt) Drrurpno4tet iiciad a rlu snt) lxnio iotlpte nei;t  2toio3iu4am  lnvi () Drrx o;o1tpe mieiydlaDuaums (4 etoxf oa1opD ai ilt)sexoxmpoy1ll  mnvi ()a2uax pnu1apeoiieildls ul(vp u0altnio3oatla elnvolt t2trimpny1lmtnmfei s) 2rax oou0apxo oetadla2ul(vp u0tlxnxr oodopt lu s;t0s2tm(o no4lmtemfcsat) Dua(mo;o1ape  ictytfs2ea(mp;u)arxrircoo1fpDelivs;s0trxriopnydaptelncsat)sruru ono1ope  ietydlsDrmnmp;u4 rxriocoatom r nesl(0 rxoxrpiodaptn fcs t  rtmum ;t0tpxomieiasfa ul( s u4trtoxrciadfm e u i t setr(o3nodlmt  netat a2trum ;t1tpxo feiysls ua(msnt)trxnxrciytom rau s;(0srxoxo nu4ol nmnct sfartaxmo;o4olx mictyd sDrlnvs;t4 rtoxrcoy1omDrlieo s t2urio3no4apt lfvilsf rur(rp;t4opxomo3ildlmDra( pnu0 rxnmo iy1omDeanes;s  rtmir nydoltelfcsas)a2urx o;u4tpxo ieiatfaDemumo;(0tetnio iy1op ean s t s2xmim oydlm nmivsasfsrum(m oo0apx  iciysla2ra(vp u)aeermr iytlptrlies;(0trumxr iu1ol n net (  rtm(  ;u4ole ifctytla2rmumo u)tlxomo3io1lmteaieo;s)texrxo3no1ol nmivs ( aDurumpnu4aetoifeildlm2emnms ()areoxocoy1oat  u olt) 2xm(o3nodlpee icsls  Dum( pot1tpx io3iydfmDrluvp;(0texoio3io1laDeauvols trumio nu4amt  fcias)artru ono4aexoio3iytfm2eanmont)trxoxo3oatoa rau olt0 rxoim3io1omte nciasfarrm(r ou4oex ioctysfmDrau s t) lxrmrciotfpD  ueo t0 exr(o oodop n fei ()srtmu o;t1oee  oetls aDea(vsn(4tltomfcoo1latraiei;t0 2xm(opnudopenmfvslsfa2rrxmpno4olx moetlslaDraumpn(4 eerif tadopDe n s s srxmxo3oodolenmfctlsfaDrruro;u4apeo i3tas s rmu pnu)alxoxr3tatlatraieils t2xm(o iodomen nes ( aDrm(mono4oexomo3iltfmDrluvp t) lerxr3ty1omD  nvo (  rxmio3oo4amt mnesat)aDtmuroou1alxoif3tytfaDemnvpnu) lxrio3io1omtrluvslt0 rumxm iu4op nlivtat) rururp;o1altnmi3tatfm ea( p;()trtnmr3tatfp elu olt s2xmxmpiodop  lfvsatf rum(  ;u4tetomictadfa2emump u0 exrircoadoat  ies;(  etrim oudope lnviat  rra(mo;o1tptn f3iys sDeauvp;u)arxomfctotfpD  i o;s) rtm(o3iu1om  livtls) 2urur ou1opt  ieiadfmDrlnmp u4aetoxo iytom r ieil( trtrxrpnu1ll  lnvi s sDtau onu0aeeomictld s2rmnvon(4 ltnxo3ty1om  aneslt) 2xo(m3iy1olenliciat  rurxmo;u1ole mictys m ua(vp;u4trtrmf3totlmtraivo;(0srurir3oydal nmnesasf rur(m ot0apx mictltls ean o;(0tlxnif3oatomDeaivi;(0s2uoir io1al  mncsls  Duau pot4optomo3iltlm2rlnvsnt4 lxnxf iytfmtrlieolt0srtoirpnu1op   fetas)a2rm( oot0aetnioetltfs rlu ont0aeenmr iotfpDrluvs;s teuoirpno4ope lfeiltf 2rru oot1altoiietatfa rm(vo ()aexnxf oa1op e u o s s2xrim iu1oltn ivi s  2raxr ou1apx iictyslaDel(vo;u0 rxrxfciadomt li o (0srurio3nodlm elnvsat  2tm( p;u0aetnmi3iatfaDrlumo;()aeerio oodfp rlnvs;()trxm(r3oudol nlici s) rtr( ooo4tleo f3tltlsDemums ()altoirctadfmDr uvslt0teurimpiodomt  fesa() 2tr(m nu0ole mociytls2ulnvp t4 rtrmrcia1om ran i s  2xmxrpoo1alte iei ( srtr(  ;u4alx if3tytfs2rl(vpnu4alxnxrctydfpte uesl(0 rumio oodaptn fvtlsfa2rrum oo4aexo iciasfa ra( ont)texnxr3tatfmD aues ()t2uoxrpny1om e fvt s  rumx ont4oleniiciaslmDeanmsnu)trerxf tadfmDeai s;t0 euo(mpiodaptemnei (fa2ra(rpnu0olto icias aDeln o;t0aeeoifcoy1lmDeln ol(0 rtmxo nydlpte icsltfarua(root4texn icilslsDulu s t4altoio iytlaDelneo;(0t2xo(o3ny4llt mfvs t)srtmxrpou1opxniiciatfm elnvpnt) rtrxociodlaDelivils)s2toir3iy4ap  micsas aDum(r nt4optnioeils m2eau onu4 ltrxr3iytfmDr n o s texm(rpoo4amtnlnesls) 2trx p;t0ope  o3ilsfm2ua( pnu0 leoir3oo1lmDean o (0trur(o iydll emfet (f rraumont1apeoiiciasls ran p;u4tlerxfcoa1fateauvo;t  ruo(m ou4op nlfei s)artaum ;u0texnifetlslm2ranmo;u4 etnifcta1omD  ieo;s) ruo(o3nudal n nvtl( aDtaxr nu4oexnmfetadfsDul(vs t4 rxnio3to1op e ivs;t srxm(rpoo4lle  fcil(  Dra(mooo1aetn ieiytfa emn s (4 rxnmr3iadla r u o;t0 euoxo iu1ope  ict t)sDrax p;o4oeto octat sDua(vo;()tetnxo3ootlm r uei;() rto(o io1ol nmics (fartaxmpoo4tex mf3iys s2eanmo;t4aeenio3oodfm r nvo;s trto(mpoydllee ics s s2raumo;o4optnif3iatls ul(vp (0 renif3todlatr i slt0setrxo3nodlpen fvtls  rtmxm ;t0tpeo feiyd mDumn o;u4treomrcto1lpt anei;s0setoxmpoudllenlfvtat) 2umu poo0tlxnmi3tls mDrm(mp ()teenir oydopDeaneilt0texoimpio4lpe  fcslsf Dra(r ou0ole mictytfmDul(vsnt)aexrxf3io1optr uvi t)t2xoxr3oy4optnlfei s)a2um( ooo0alx ioeiasls rmuvp (4 rtrircoy1fpteau slt  rtm(r iy4ape  ncs t s2taxrpou4oeeoiocilsfa emn s t)tltrxocoodfp ran o;s sruo(rpnu4oltelncil(  ruru p;o4aptomf3iad a2ranms (0trxoxfctodfmt li s;t) 2uoxo iydalen ivt s) Dtrx  ;o0oexoioeiat s rlump t)treomo3oa1lateanvil(  exmxm io1alee nci (f rra(  nt0aptoifciltla eauvo (4 lermocoatlmte uvol( s2umxopnu4amen feil( s2urur no0teto o3iydfa2rm(vs t4tlenir iotoaDrauvslt0tetr(r oo1al nmfeslt)arrruro;o1texomocilsfm ra(vpnu0 ltoxo oy1fat au o ( texrir iydop e nvs (fsDraxmp;t1aeenif3iys mDra(mp;u)tetrmrcta1omt  u s s)srxmiopiy4lpe micslsfs2raumo;o1tpeo o3tadls rm( sn()artoxo ty1lp   neo ()seuo(r nydlptemicslsfsrrm( pno4aetnmociyslsDumnmp () etoir3ia1lp  aueilt)s2trxmpiudol elfcilsf Dra(rp;u1oexomieiltfaDea(mo u) etnxfcoatfpDeaies t) etmxrpoudoltemfcilt srraxmpnu0tpt  o3ilsls em(vo ()aetomr tydlpDranvsl() exoirpoy4am elnvsat)aDtm(mpot4aptoiictatls2ra(monu4alenir tydlptelieols)srxoxm iu4op  lnei t  2rr(monu1teen ieiltla2rm( o u)aeeoxr oodlm eaivilt0setrxrpiudlm  mivi s artm(mpno4apxn oetld a2ean o (0 rxrxr oatfpD livi;(0s2um(o3nu1op emieia()a2ua(  ou4opxnioeild s emnmo;(0trxomr3iy1fp r nesl(  2xoxmpnu4om emnciat aruau oou4aeen ictytfmDeau o;(0arxomo iadopDr n slt)s2tmxo oodlm e net t)arrrxmp;o1tleo oeiltls2ulump;t4texomf3ootomt lu s;( tetm(o3ny4llte fcta(fs2umxm no1apxnmfctys m ranmpn(4trxnmo3ta1fmDeliei;t trtoim3iy4op nlfvsas)a2tmxr no1alxnioetasls uaump (4arxnircta1lp rauei ( setoxr oo4amt miciltfarum(mo;o0opx  iciat aDuluvpnt0alenmfcootom  ai s;(  rtm(rpou4lpt  ncsls)srum(ro;u4ape mf3tlsls2rlnvsn(0texrif3iydfaDrlivs;( seuoim oudaleelieiltf 2rmu pou1olxoioeiadls2ra( onu4tlerxr3oy1omD ln i;(0s2xm(opiu1ap nmfvslt srrmurpno1aee mociyt m emumo;t0 eenxoctodla r ivs;s0 etmxmpno4lltn ies ()arrruro;u4olxnioctldlm2rm( s;u0texoircty1fpDranvo t)setmirpoy4lltnlicsat)aDururp;u0apeo fciatfaDrauvp t4treoir ty1lpte n o;(0 etmxmpoo4open iesat s2umum oo1tpx  octadfs ran p t4 lerxfciydla  anei t)trumimpou4lpt lieta() 2urxr oo0tpeniiciatfm2um(mpnt0aeerxociotfpt anesl()setoio3iu4amte nvi ()s2rr(r no0aeeo ietld a emnmpnt) eermo oy1oaDraueo;t0sexoxrpoo4lme licsls sDumumo;t1oeenif3iys m2ua(monu) rxoirctadop  li o s)teumxo io4oleelnci s)s2tmxmp;t1aexn ictltls2eanmo;(0trxoio3io1fmtraneils t2xmxrpiodlmt lfcs ( srua( pno4tlxoif3iyt s rmnmo;t0 exnxo3todopDe uvilt0teuoxrpny4llenmnvi tfs2tmu pot0olenmfciysfs ul(vsnu) lerxr3todoptr neils)tetrio3iydopenmnet ( aDrmu ono4opeoioeiys sDuanmo;t)alxoifcio1omDr i s s) 2xoxm3iy1ap  micil(farurx  ;u1ape  ietldlmDrluvp t4 ltnmrctydlm  aieo;s0 2xoir3nydaltemneia(fsDum(r nu4oetomo3tydlmDrm(vpn(4altrmf io1lm elueolt seumxo oydlmt livtasf Dra( pnu0apt ifetydfa uau pnu4 lenxr3iatlatr ivi t0s2tmxmpnu4lleelnet s) Dra(ronu4teen ietadlsDumn onu0trermr3oydlmt livs () 2xo(r3oo1amtn nci sfsrtm( p;u0alt  ieiysfm rlnvpnt4 ltoif ty1fm  ai i t trto(m iu4oleemfeiasf 2uaxmpoo0optoio3tlt s rln sn(0texrxo3oydlp r ivs s)s2xrir oy1altn nct ( aDumx o;o1texo ieiys aDemumsnu4teeoxocty1lptelu ilt t2tmxopiudol nmivi ( s2ua(m ot0tpx  f3ilslm2emuvsn()alxomrctotlpDrluei;(0t2urxr3io1ap nlfes s)sDuax poo1opxoioeiatls umnvont0aexrmociadfmDrln s t  etoio io1omeemietls s2rrx ont1oeenmiciltls uau o t0 etoio oa1lpDraivsls) 2uo(r nodoltemfvs (faruaum ou1tpeomfcildls umuvp;(0tlenio3tadfmte u o t)trxo(m3nudome mfvt ( aDra(r no1alxnif3iaslaDeauvsn(4teenxf oo1omte nvolt teuoxm nu4lm n fvsas  Drmumpou0aptomieiydls rm( s u0 lenmfcia1oa elues;()trumxr oo4olenlivils a2ta(mpoo1oexomfeild a elums;t0alenif todlm e ueo;t)trtmiopny1lp e nciasfa2ururont4alxn fctyd a rlnmsn() exoxocoadfm   ues t0 2uoim3iu4apt mfetlsf rrm(rp;o4tee  ocilt mDemuvo (0artnif3ia1omt livo s)s2uoxm iu1lmtelfvi t) rra(  ;t0opeoif3tad m2elu p t4 rxoxo totlp e u i;s s2uoir io1omte iesl() 2umumpot4oet if3iysls2em( p;() rermf ta1laD  nvsl( sexr(r iy4omen fci ()s2rm(m ;o0aet mf3ias s2umump t4texrxr3oo1lmDeaues t)teumxmpiydam elicil(fartax p;u1oleomoeiat sDul( sn(4 rtomo oytfp eanvs t  exrir oo4ame mfvils srrrum no1tpe ii3iytfm uan pnt) eermfciydfpDraivi (0 rtmxopnodll  mics (fsDrrurpoo1oeeniicilslmDrl( o u4 lermf oadlpDean s;(  2xmxr3ny1alee fvtlsf Dtmumpnt1opxnioeiyt m2ua(vp;u) rxrifcoytlptelu il()s2urim oy4omtelivt ()aDrm(m ;u4tpx mfeiatfs el(mo;(4 rerxfciotla r nes s) rxo(r3nodll elnct (  Dur(mpnt4aetoifeiat a rlnvonu4arxnxr oytlm  aues t0sexmir3oy4aptemfvsl()s2raump;o0teeoifcils aDem(vp;t0 eeoioctytopDrai i s0seuo(o3no1lpe lnviasfaruaur nu1texo o3iadla um(mp;u) etrmo iydlaDeaivo;s t2uo(o oo1ll elietas a2rmuroou0oleoiietasfm2uaums;t)tetoxocoodlm e nvols0t2um(m oo4llenmivtatfsrraxr nu0oeen fctatlm eau onu4tlxrif3iydfpDeanvo t)s2urimpoo1ol   nct sf Dum(mpno4oeeoioetas mDrmn s u0 eerxo iadlm   n i s  2xr(r3ny1am emietl( arua(mpnu4tle mi3iltlaDuanmon(4 lenmr3ty1lmtrauvi;t)s2ur(mpoodol nlnvt s  rua(mpoo0ole mf3tydlaDemu s;u4texoxr3ty1oateli slt)seuoxm3nu1ol  micil()srurxmono1oleomociytfs uln p;u4texrif3tadfmt  u ilt0tetoir nydole licil(  Dtr( p;o4alx  f3ildlaDemn s t) renio3totoatrln o ( teurxr iy4omt lfci (f Dumumpnu4tee  ociydls2rlnmp t4areoir3iotomt  n o;()sexm(opou4ol nmietlsfsrtaxroou1tltn ociysfa2eanvs;u4 reoxocto1lm   n il(0t2trio3ny1ol  livilsf Drmxm ;t0tptn ociysfmDemnmo;t4teermr ta1fmDr ivo;t0t2xmxrpoudop emncils sDtrum no0optomi3iasfaDuauvs (4tleomrctydlm eli slt0 eumxm oy1omen nvslsfarta(mpoo4aex mfeiatlmDuanvon()trtrmr3tydoaD anei ( t2xoxo3oodoleemfvsat sDuauroou1alt  octas m ranvo t)alxoxociodlptelivil()t2trio nu1lltnmfci t) 2tru  no1tetnioeildfm umn on(0tetomr oy1fpt aieo s srxo(m3no4lp e icslt)srrm( onu0oltoifeiyslsDua(vs t0altnmfctadlat  n s t0teumxr3ny1ap  lnvslt arua(monu0aptomi3iltfsDrluvpnu0 rxoir3tytfmt aieils seum(rpou1omt lncta( srrr(r ;u4aet moetltfaDemnvp (4altrio oy1om  lnvo;s) 2ur(o no1al   fvtlt  2rr( o;t4tetomocildla emnvs u4altnxr3iodlp e ivo s0t2xoxo3nu1lp   fvilt) 2trur ;u0oeeo f3ils s rlumsn(0aexnifciotfaD livi;s  rxo(rpiodlm  lneil( arrm(mpou1oet miciysla2rmums ()altrmf ia1omtraies t trxo(mpiy1ol   nciatf rtaxrpou4open i3iatla2umumo;() ltnmo iytop eanvs (0t2umxmpiu1lptnlictls  2trx  ;o0opxomfeiltfmDulnvon(4trtnmr oatfmtelnes () exmio oy1ome  icta()s2rau oou1aeenioctlsfa rlnmo;t4 reoxf3oatlp  anvs (  rur(o3nu1omt lfciat)s2tr( pno1tpeoifctytfs2emu s;()aeerxrcoytlp rai s s trtrimpoodlp   nciat s2rrxr ;o4tpx ii3ils a2uln onu4trermf3totla  ai i t0setoxopiydoleeliesl(fsrrmurp;u1texnmoeiatfa2rmumo;u0aetoxr oatlmDelneols  2tr(rpno4lmtnlfcilt) 2rrxr ou1aexomfetltls em(ms t0tleoio oa1lpDr ieols0t2to(rpnodlp n icias)a2ururpnt1olx ifciys s ran o u4 rtniocoytlpt lnvo t0 ruoim3nudapen neiasfarraumont4oltn fciytfs emuvo;t)arxrio tatfptrau s t)s2trxo3iy4alt  neias  ruau p;u0olt ifciltls raumsn(0aexnif tatlmDr u i;t) rtm(o oo1lm nmieilt)aDrmx pou1oexnmoetas mDrl(mo;()tltrir iadla   ieo;(  euo(o3oo1lptnlnvi tf rur(  ot4alenii3tas a ulumsnu0 lenirciadopt  uei;t)trumir nydamtnmiei t arta( oou0oltn ietatlm2ea(ms;u)trxnxf3oa1oaD li i;t srtmimpnu1llt lfvt t)aDuau p;t0opeomoeilsfs ul( o t) eermr3tadfm rlnvo s srum(rpoo1ale lnvs (f rtm(mpoo4tptnmf3iys aDranmpn(4aeenirctatlm e uvs;( texm(r3io1ame  nvsas sDrrurpou4alxn fetls m2ran p u0teermf tatfpt  ieil( sruoir3iydlltn fvilt sDtaur oo4ope  oeiadfm uanvp (4aexoircoodfpte ivols setrirpoydalt mivs ()aDta(r oo4olx ioeiydfm rm(vs u0aetrxf tadoa rlueol(0 eumxo3ou4omt lictlsf ruru pot4aet mfciysfs2rmuvp;u4 ltnxf3ia1laDe i slt0s2xm(r3iy1am e ivi t artrxronu1apx iicils aDrln s;t4trtnxr oydla r n s;(0srxrxmpny4lle  ivi (  Dtmurpnu4optoii3tysfsDrmn s t4trtoxr ootlpt  n s;t)seto(m oodome  ncsat  Dra(r nu1aptnmietld a rau snu4 ltnmr3iydlpDe ieil( truoxr ou4lme mfetlsf Dumxrp;o0tlto ieils sDeanvpnt0artnmr3tytfptraues;s) 2tm(o oy1lp  mfci ( a2ta(  ;o4oet mf3iydfsDeanvpn()trtnmr3iy1faD aieo t)s2toirpoodapt  fesasf rtr(rpno1altniieiys s2rlnmp;t4trtomr3iodlaD aivsl(  rxoxm3oo4alt  fet sfsDtrx o;o4aetn oetad aDeluvs;(4 eeomf totla raivi;(0 eumimpno4lptelfci (farumxmoou0ape  f3ildfm eaump;(0trtoif3iy1fm rlivs;() etoxopoo4apeemieiltfs2urx oou4aexomoetyt s2em(msn(0trtrio tadfmtelu o ( setrxrpiodlme mnctltfarrmumoou1teeniieiadlmDemumon(0 exomociatfa e n o;s0sruoir nodop   ivtlt)a2umxmpot1olt ifciydfmDelnmp;u)artrxf iotlateaueo;s0srtmxmpnudlpt  nvta() 2urxm oo1aexn ictatlmDua(ms;u)artnmf3ia1lpD li il(0t2uoim iy1llt mfvt s  2rmur ;o1tleo oeiytls2uaumo;()texrmf3iadlm e neols0trtoiopiy1aleemivi s)a2umxm ;t4tpt  ietasfs2rl(vpnt4treomf3tytomD  nvil(0 rurxm3io4amee iesas sDuru  ;o0open o3tltfaDraums u0aexnmr oa1lmt lnei t) etrir oudap  lfvs t arraxroot4tlt mf3iydfs em(mont0tetoir3oy1omtelnesl( setrxr oy4al  mnci ()artrxmo;t4oetnmi3iyt s uau o;t)aeeomr oatfa e ivolt0 ruoiopoydopee nesls s2um( poo4tlx  f3iytfs2em(vs;(4treoifctatlp e i s s)s2tr(r iodllt mfci t  ruax onu4tlx iocildfs rm(vs (0 etnxf totomD aies (0 eumxmpiu4aptelnes tfa2tmxro;t4aetn fciydlm em( snu0 exrio iytfptraueols0trxmim nudalenlfvt t)sDua(mont0oetomo3iytfaDrln p;t0trxnircto1om e n il()s2uo(o3iu4olte nciat)sDtr(m ;u4apeoioetlslm2rauvo;(4aeenxoctodfp rauvi s0srur(m3iudaptemnvt t) ruaxrooo1openmoetasla2rlu o (0 exoxo3iodlatrlivo (0 eurir nydome lfvsa( aDrmumoot4oltomocilsfs2rluvs t)treoiocoodfaD  ueo;s0 rum(r3ou4ol emfci sfs2raum no1apt  iciysls em(von()altoxociodom  li sls)seumxo3iydopt livsa( aDumxr ou4ape mfctlt a2emums t0aeeriociadlpDe iei s0srum(opiudalt livt ( aDumxrpno0tpxnmi3iadla2uanmp t)tltoir3iadfmD  n o;s0t2tr(m oo4opeemiesa( a2uaum ;o0ole iiciytls ulnvs u4tetrir3oadfm rlnvo;s)srum(r nu1lmenmics sfsrrmx  ou1tpe mieiysfs eanvonu4texnxo totom  lnvo;s t2tmxo3ou4ol nlfctl()sDta(r oo4tee  ieilt s rmn pnt4artoifciytlaD auvols0t2xmio nu4llt mnctlt arta(mpot4olt moetad m2eln s u0 lenmrcoy1op  lu sls)srumxmpiodame mict t arrm(monu0aetn i3iat a2emums t)tetrxo3tadlaDeai il( trxo(m3iudaltn fcs ()srur(m nu4alxnmoetytfa2rlnmp u4tleomo ia1lmteaneolt0trxoxrpiy1alte ieia() 2rau oot0oeenmfciyt sDumuvo ()aeermo to1lp r nvilt0srtmio ny4lptnlict (fs2rru ooo0oeenmieiyslmDumu o (0tltoir3iydfatrauvs t0s2xrir nodllee nvtat)sDtr(rpoo4tptomoeilsfs rlumo;() lenif to1fpD auvs;t0seurio3nydllt  fci t)srur(monu0alenmieilt mDumuvpnt0 rxrif3oatfm  lieol()t2uoxr3oudom e fesas)sDuaxmp;u1tlt  f3iad s2eau o;u4teenmr oa1oa e u i;( s2tm(opnu4lp n fcias  2tm(m ou4aee mo3tat s2ra( sn(0trenifciadlmDr u sls) 2xr(m3nu4apt  iciatf Drmu  ;u0tex iociys s em(vont0alxnio oodla  ai i ( seurxr iy4lmen iesat  Dra(moot1alx ioeilt m uln snt0alenir tytopDr i i;(0 rtoim3oydlltemneiasf rtr(rpnt0aeeomo3iatlaDrlnmp u4treomr3oytomD  n sl(0 rxmirpoo1al n nvsatf rtrx p;u1tet mociyslmDua( p u4 eeomociadoaD an i (  exmir3oy1lleemnei tf Dta(  no0tex iicildfm uau pnt)tetrmf oydlpt livi;s) exoxm3oudlp   fvtlt) 2taumoot4tpeoioeildfsDeauvpnu0tlxrio todfmDrlnvs;s0s2to(o3oydolt lnet ( arrmu  nt1aleoiociasfs2rmn p u) rtnifciytlm e nvsl( trurxmpny1lp emnvsat s2uaxroou1apxo feiysls eluvp (4tlenxo to1faDe nvs s)s2tr(opoy4al elfvia(faruauro;u4optnifetyd m rluvon(0 exrxr3iy1lmDe ivs;s0 exoiopiu4olenlietls  2tr(mont0oleomieiytfaDel( snt)artnmf oadoate u s;(0 etoxo oy1ape mfvtat  rum(ro;o4tlen feiat a em(vp;u)teenir iydoa raivi t0tetm(o3nudam  lfcils)s2ra(r ;o1altoiociytlmDumnmon(0trxnio oadfm eln ils)t2um(rpny4lleelieilt) 2rm( o;o1aetn fctatls2rln pnt0tetoxrciatla e uei;s  2xo(r3oo4lmtelfcias srururpoo4tpenmi3iys aDea(vp t4tlxnmo todomDelnes;s)texmim oudom   nviat  2uau  oo0teeo ocilt s umnvo u0arxrio3iydopDeanes;(0 2urxr3oodap nlfesls)a2ra(m ;u0ape  oeilslmDra(vo;u)aexrircia1laDr uvi t s2tr(rpoo4lp  lfvtlsfsrtaxm nt0olxo octasla2eanvsnu4aetnxfcoatfpDeln olt) eum(o3oudol nlivt tfartrx pot0tex  iciadfsDemnmp;(0 leoio iadla rlnvsl()tetrim3io4ll nmnesl(f 2rmum nu4aex mociydlm emu o;(4tlerxf oy1omt lnei () exrxm nu1lmee fcs sfs2rmxronu1olxnio3iyslsDeaumo;u)tlxriociytlm  aivs;s0sexo(o oo1ll e neta() rum(m nu0optnmf3ilt a el(ms;u4tleniocootlaDeliei;s  2uoir oy4al emfcsl(f rrrxr ;t1oltoifciatfa2ul( p;()arxnmo3totoa eau o;s srxmio3iudapeemfct tfarua( o;o4tleoifeiydlm2emu s ()aeenxrctatfat ai ilt s2xrir3iu1am  liei t  2tmxro;t4alxoio3tlslsDra( s;t4tltnmr oytfaDranvo t t2xo(opio4lm e fct s)a2rmumo;u4opxniociasfsDrl(mont)trenxrcta1lpDrlieolt)t2tr(o ou4ope lnetls) Draurpno4apxn ictaslmDranvp;u4alxomfcoatlatelu s;t0 rxoxr iu1lp nlnes tf rtaurpno1optomi3tys mDum(vsnt4aleoifcty1faDrlu ils tetm(m3iu4lp nmnei t) Dtr(rooo4oetn o3iysfsDul(von(4 etrxfcta1oa e i ilt)trurirpnodolte fcs ()arururp;u4aeenii3iydlm2ra(ms t0tlxomf oatlat luvo;( setm(r3nodale lnviasf rumurpot1aex ii3ildfs2uanmpn() exnxf3oatlatr nvs t0 rurxm3iy4amee ivs tfs2tmxr ot1tlxo oeilt mDum( p;t4aetniociotla  aivols)trur(r3nu1opt  fvsas)srtrxmo;u4olxn ieiadfaDem(vo t0teerio3to1fate ivs t0sexrxm oodomt  feiltf 2um(mp;o1alx mociat m2rm( s u0 rerxf3iytoptraivi;s0t2toio3no1altnlnci (fsrumxr ot0olto ieiasla2rmnvp u0 rtrxf ta1lpD li s;(  exoxmpio1om nmnctl()arrru o;t0aex iiciasfs2rmuvp (4texnxf3oatfm eliei;t  exr(r iy4al emfct t)aDra(moou0ope iictas aDul(vo;()arermf3iytfptr nei s texmxopou4omtelivi ( srrmu  ou4tlenmiciad s ua(vsnu0alxoxocio1fmtrauvils)trtoimpoudame  ncs sfaruaumoot1opxoif3iad a umn p;() eenmf oa1fpt  neilt0tetrxm3oodlpenmnet t  2ua(ronu0alxnmf3ildlaDrlnvsnu0aexrmo3tadfmDeauvo;t)srto(r3iodll nlici s) Dtau o;u0tex iieildfs ea(vp;t4tlerio3to1omDr ueol() etrirpio1omenmncs tfsrtm(m ot1olxoiiciysfm2ua(ms t0aetomfctodopD  nei;s)srum(o iy4oltn iesas)s2ururpnu1tpxn f3iysfs ea(mo u0alxrmf3iatoateaivils)teumir3nodlm nmivta(f Drrumo;u1alx  oetlsfa2elnvp t4 rtoio3ty1opt  i o t) rurirpoodll n feta( sDraxroot0ope moeilsla2ulums t)texnmr tytlm r u s;()sexoxm iu4amte nvsls sDraxrooo0teeomfeias a2elnmo;t)altrxo3iy1fat  i olt)t2urio oydape  fct s  2trxroou4aexo fciatfm ean p t4tltnxo oo1fmtelneo;s0trtrxmpnodoleemiet t aDum(m ot0tpxniieilslm elnvont4tlxnxo3io1op ran o;()teumio3no1omen fcsa()arraurp;u4apxniieild a2umnmp (4alxnmr totoa e u o ()seto(mpiydomt  icsls)a2um(r ou4ole  fetltls um(vs;u4arxnxf iotlm  an i s0texr(r3io4optelnctl() 2trum ;o1tetoiicild s2eanmsnt) lenxfcia1lmtraivol(0texm(o3nydomtn nvil( aDum(r no4opx ioeiltfm2uan o;u0 rtoifctytoaDe u s;t)srtoio nydomtemnci t aDtau p;t4aeeoifctlt a umn on()trerxocoy1om  aueils  etoiopiydll   neil(  rum(ro;o4tpx iieiadfm eaumsnu4 rxrmo3todfatraieo () rtm(o3oodll n nvta( a2tm(rono0alx  i3ilt a2rl(mp;u0altnifcoodlaDeliei t0truoir3oy4oltn ivsa()srrr(ro;o1ope ioetytlsDrlumsn()tlxrif tatlmt  u s;s  exmxo nu4lltelietl( s2trurp;t1tpxn ictld m umnmon()altnio3iadlpDrli i s0s2tmim iy1llee ivslt  Drm(mp;o4alenioetlslsDumu o;t0alenir3oo1fpDeanvsl(0s2xrxrpnydomen nct tf 2urx oot4tex mo3tadls ua(vp u) leoifctadfmt au o;t)srumir3iodamtemictls  2taxrpno1teeo ociatfmDelu s;u0 exoxrciydfatrau i;() etmxm io1opt  ivtasfa2urumoou1tlx moeiyd mDua(mont0 rtrmociodoat  nvi;s0t2xm(opoy1lpee fcsls)sDraxmpnt1olxomieiaslsDrauvo;()trtrxrciytfmD lnvi;()srxr(r oo4ape livi tfsDrmuro;o0tee mo3ias aDea(mpn(4 ltrif3oodlate ues s0trumxm3oy4ap n fcsl(f Draurp;u1openmoeiat a rmu o t)tlxoxo3totfm eli o t0 2urxmpiu4ameelfctl(faDrrx poo1alxoio3ils a2uan o t0altrif ty1fmD lu s t srtoxr oydome  nvi t arra(rpnu0apx io3iyt a ulu o;(0 rxnifcty1fmD lues ( t2trxo nu4om nlnvs t)a2um( pnu0apt mo3iydfs ulums;()tlxrmf oytfpD aivil()srum(o3ny1aptn feiat)aDuru p;t1tex iieiyd a2rm(monu)tetoxr oodlat aneo ()srxoxm oydaltelncia(fs2rau  nu1alt  fcils s2rln o u)tetoxrcio1lat lneil(  rxoxo3nu1ope  ivi (fsrumxro;t1oet miciadlmDem( o;t4 rtoxrcoy1lp e nesl()teurio3no1openmietltfsrumu oou4opxnioetyd m ea( s;t) exnmf iadoaDrluesl() rto(opoudlm   ietat  2truro;u1oee  ictytlm ea(vpnt4teermr3oadfp rlu sls)srumxmpno1llenlfvtlsfs2tmxro;t4alt mfctydfa uluvsnt0aetoio iotla e ueo s trum(r3nydlm emnvi tfsDrmxmonu0tet iiciad s2rmuvpnu)artnxo3ia1opDr iei ()s2urio3oo4amt lnet (  2umxr nt4olx iietat a em(ms;u0 lxoxo3oy1om  ai s;(0sexm(m3io4lmt mieta()aDtru o;t1teeomoeiat m2rluvpnt4teenmrctatlmt  ies;()s2to(r iy4ll nmfcslsf Drax  oo1apt moeiatfs2ua(vo (0 rxoxocootfmt  nes ()texm(o iy4optnmnvia(f 2tmxr no1aee io3ilt s2eaums;u4 rxrxr3oatlmt ln o;()t2xm(o nu1ope micia()s2rmumont4tptnmociyt a2ran o (0 exomociytfmDraivslt) exo(rpiu1ome lncilsfarrau oou1oex  oeiltlaDua(vs (4 etomf3iatlp rlivo t srxmxmpnu1ome lfeiat srtax pnt0tltnio3ildls2rmn snt4 lxnmo3tytoateaivsl(0texoxo3iudaleelicias  2rrx p;u4teenioetatfsDrmn snt4trxoircto1lmDe neo t)seto(r3oudomenmictlt s2rax  no0opt moetld a elumo;u4tetrmrcoatlmtrlneols0srxrirpnudamteliciat)arrmu ono4aeeniietyslaDrlnvon(4 rxriocoytfpt aivils  ruo(r3ou1olen ivsas  rrr( o;o1aexo o3tasfsDel( s;t)trxnmrcoytfatrai il(0texoxmpoy1lmt lies s arra(mp;o4tpe iieild aDumumont0trermr3iodfm r ues;t  etoxrpou1lltemncsasfarumx pno1apt mfetad a rmuvo;()alenir3iydlp e ueo;( texmimpno1llt  ivil(f 2rrur nu1opt  fciatls2rlnvo;u4alenmociytfmDe n s s)teum(mpnu1op   iesls sDraxm ou4apxo ietas m ul( o;t4artrmrcoydfmD au ol(  etoxm ny4ll  lneia( s2trxmo;t1ape if3tldls2el(vsnt4aetnxo todlp  ln s;()sexr(o3nu1ale mnet (fa2rrxm ou4ale mocils aDranmp u0alxrxo3oy1lm rauvi;s0t2umxrpnodapen ivsl(  2rm( o;u0alx  ictlsfaDuau onu4 rtomr3oadfatran
\ No newline at end of file
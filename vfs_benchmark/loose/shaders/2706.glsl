@@ -0,0 +1 @@
+ues;(  rumiopiudapen ivtls a2tmu  ot4optnioeiydls umu s;u0altoircoatlpt  n slt)sexo(rpoo4amtnlfeslsfaDtmum nt4tpeo fetls s ra(vpnt0alxnxfctadfp rlivi;(0t2trxo3io1oltelietl( aDrrurpnt1alenifctlsls eanmsnu)teeoio tadfa r nvo;() 2xmxm ny4lm  miet t) Durxroou0oex  fctlsfa rmn p;t0 exrio3ootopDe nes s0teurim ou1altemici ()a2rmx p;t1aeeniietyd m el( s (4 reoxr3oa1oa raueil(  eur(r oydomtnmfeilt a2ur( p;t1tpenifciadla umu p t0aexoio to1fp rli slt  2to(opou1amee fvias)sDur( o;u0tpt moctatfs2uanmp;(4arxniocoytlmDeluvi;s)sexmxmpiydomen ici t)aDtrurp;o4apx iociysfsDrlnvs t4aetomfcootoa   nesl() rxmxo nudllt mncil( aruaxroot1alx mo3iatlm raump;(0 exrxfctadoaDr ivi t)setrxmpnudom   ivsl()srrmxro;u0optomocilsfaDrlnvo u0trtrmo3oodfmDrlnvo;s0sexoxopnudlpe lfviat  Dum(m nu0tetniieiadfs2rl(mp t4alxomf iydfpte ueol() eumim3oy4lpeelivta()sDrr(  ou4apx io3ils a emn ont4areoircoatfm   ivs t seur(r iu1al nmfeiatf ruaxmpou4tltn iciytfm elu o;u4 exrir io1lm r n o s0 rumxr3no4omt livsat  rtr(mpnt1oex  f3tytfs emums (4 exnmrctydopDrlneo s t2urimpny1om  lnvtl( a2uauro;t0apeo oeild s umnmpnu0alxrmocoy1fpDeau i;s) rurir3iu4olt mfesatfsrrm(mpno1tleomo3iltfa ua(vo;t0 ltrxf3oydop  lneols0tetrxo3io4ope lfvi tfa2rrxmont4oetn o3ilslaDemnvp;t4 renifcoodopDraueils s2uoirpoydlpenmics s) rtaxrp;t0apxomictyt sDean p u4arenmf tytfaDelies;( trumxr io4lle lfcilsfa2ur(  ;o0alx  fciys m2eanvpnu4tlxnif3tatfa elueil() 2um(o3oydaptemfvs s) 2um(r no0tpx mo3tyslm rauvpn(4areomr3ta1faD  u s s) etrir nu4am nmnctasfaDur(r no0tpxnii3ildla rmumont) rtoif oa1om  aneols0trxrxo3iydamt liesatfa2raxm ;o0aet iiciydlmDelu pnt)texomr oatoptrlieo;t  eumxm nudope lnvsl( sruax pno4ole iietytfm emuvs;(0treoioctydlate nvs;()srurxo iu4ole lfct () 2tmx  nu1tee  fciyslm rmnmp;(4trtomo3iotlate uei s)srtmir3nodomeelfviat) 2ua(r no1tltnii3iat mDrm(vo t4 ltnmr3ia1fptr ivs t  2xmio nydamtemnvt ( artau oot1teeoiieilt m2ua(mo;(0 etomfcty1omtelu olt0s2xoir ny1olee iviat artru  nt1tle mf3tys m ul( o t0arenxo3io1lat auei;( t2tmxm3iodom elici (f Dua(r ;o0oexo oetydfm2ra(mpn(4teenmociadlmDr ieolt0 etrirpoydap emnci s aDuaumpnu1apxnmicildlmDrm( o;t)tlxoxf3iytfmt ai il(  eurirpiu1aptn nctatf 2rau ont1tltn ictad m2ulnvs;(0arxrxo3iydfp eaivslt0t2trxm nudom e fvtlt) rtr( onu1tpenifcildfmDem(vo;t4 rermo3to1opDrlivs;(0t2umxm ou4lpt lfci () 2rmuroou1tptnmiciasfa el( pn()alxnio oatoatran o t  euoxo oudolen ivtlsfsrtm(m no1tetn f3iytlaDemnmp;u4trtoir iodom elnes ()t2xo(o3io4al nlneias)sDrrurpnt0texn oeiatla2eanvs (0tlermfcoytfa  lnvo;s0s2umir3ou4llee fvilt) 2rau  ;u0alxoiietlt s ulnvs;u4 renmo3iatomDeaivs;(0 rum(mpno1lleelietat)s2ua(  ;o1aee mf3tadfs raumpnt) etnxf3oo1fp e u o;s) 2urir oodam emfetat  rrauroot0apeo i3tydfa elnvs t)texnxf3iytlm eanes ()s2urxr3oydole  nctl( srtrx  no0tlx ifeiys a ulnvp u4texrxf3oydlm  auvolt)trumxm3oudlle mietls) 2ra(mpoo1tee moetysfm el( sn(0tltrmrctatlpDrauvi s) 2uoxo iu4oltnlivsls)s2umumpnu1apeoio3ils m umumo;t4arenir3todfa e u olt0texoiopiy4op n net tfaDrrurpoo1aee ifctytfm elnms;u4aetrmrciadopDraivols) rtr(o3ny4llenmnvi (  2tmxro;u1altnmoeiasfa2emnvs;t0 lerxo oodoa rln o;t) etoxr3ou4lpe lneiat)srururp;t4oleomietydfs ea(vs t0altnmr tadoa   ieo t trxoxr3io1optelncsl(f 2rr(moou1olt  fetlsls um(ms;t0 eerxr3io1oat  nvi;s)sexm(r3oydap nmfeias srua( o;u4teeo i3ilslm2emums;t0 etrif3iotfpteanvi ()seurxo iu1oltemieslt a2umump;o1tee ioetys m2rmuvp;u0 rxoif3tydfaD aues ( t2umio3oy1optemfvtls sDrax pnt4alxo o3iadfsDel(vpnu0tlerio3oo1lpD aneo;s  etr(r nydap n nesls  2uru o;u0openiociytlm eaump t0 rermf tadfmtraivi;s trxo(r iu4oleelnctat)arra(r nu0olt mfeiltfs2rmumpnu0tleomfcoydfa rln i;t0 eto(rpoodap   ivt tf rtmxroot4alt iociasfs ulu o t)trxoio tadfp e u i;( t2xmxr iodaltnlfet sf Dtm(m ;o4olt iicilslm rln s t)trxnif3tatoptrlieo;s) 2xr(o3io4open ncil( aDur(mooo1aetn ictatfm ran p;t0 ltnxo ootoa rln sls  2uoxo nu4op  mietlsfsrrmxmp;t4aet ifeias s2rmnvs u0altoio3oy1oa e i o;s0 ruoio3iydame mnetat) 2rm(rpnu1tlxo ieiadla ul(vs;(0 rxoio oa1fm rlnvi t0t2xmir3nodamenmicsl()s2rm(  nt0aet ifetlsfaDumnvp u0altrir oodlptrai i;s)setrim iodalt  ies tfsDtm(r ;o4tpeo ocilt mDea( p (0trxnir3oy1late n s ()srur(o ny4lptnliei s  Dtrxmp;u4tle iociytfm uau o u0aexomr iatlmtelnvo;s) rumir3oy1llt miesltf 2tax  no1olxnii3iad a2elu snu4tleoif3tatlmDe uvols0 rxoir oy1ll n fvtl()aDurx ono4aleoii3tlsls eanvsn(0aetoxr3oy1lm ranei (0 2umio3iu1amt  iei () 2uax onu4oeeoio3tldlsDemu p;t4 eeoxr3todlmDeluvi;s truoirpnydlmeelnctlt) 2rax o;o1opt ifetltfa rl(vpn(4tetnxfcoydopDe iei t trxrxo nodom emncsls  2tm( pnu1opxn fciatfm2ul(vo u0tltnxr todla rlu o () rtrimpiydamtnmiei s)arrau o;u1oetoif3iaslsDul( o;t)tltomr3totoatelues;t)srxoxm nydopee iciltfsDuaump;u0teeo feilt s2emums u)tlerio3iodomD  ieo t0trur(o nudam n ies (  2tmump;u1olto fciad a2um( p;t4tetoir io1omte n o;t)srxr(mpoy1optn icsl()arumu  ;o4tlx ioeildfs rlnms u)tetrmocoo1fmtrlieolt) rtr(m3iy1om   fcs (  rumx  ;t0oexomoetasls2eluvs;u)tltnioctatoaDeluei;t0 rum(opnudop e nvsl()srtrx oot1aee moctls m um(vsnt4artnxr iy1fpDrliesl(  exrir3ou1omtn nctlt)arurx  oo0tlx mf3tltlaDeanvs () rxomoctydom e n s ( srtmim3nu1apeemiet t)aDuaum ou4tpe ifeias s2ul(mp u4 lerxr3iotlpD li s s srumxr iu1om emncias  2umuro;u4oexo fctasfaDuan pnu4 rxoxf3iodoatrlnei;() 2xmim3nudlptnlnctlt  2umx  no4opto oetytla ea(msnu4tlxoxr iytop r u olt0 rxo(o oydll emfctat)sDumxm ot1oltniietad a elnvpnt0 rerxrcootom eli ilt seumxo ny1lle  fcsl(fsDuax oot4tpe iiciysfm2rmn p;t4artoxo3iodlmteau s;s) rtmxm3nodame mieia( aDtru ooo0tlxnmoctls a ua(mp;u0tltomo3io1faDe i sl(0tetrxopnu4op  lfct s) 2tax onu1apxniiciydfa2ul(vp t0aeeoxfcootlpD au sls  eur(o nudolt lfvt t)sDtrx p;o0tlt io3iadlm2uan p u4aexrir3oytlpDraivs;t srur(r oy4alenmicslt) 2trx  oo1olxomoctadlaDel(mpnu0 eenxr oatlpte ivol(0t2xo(r iy1lpee ictlsfarurumo;u4tlx mf3tltfmDelnmp t)trtnirctytom  livslt t2tmxr oodomt mfci s a2tmur nu4tlxnmi3iydla eln pnu0teenxr ia1fm rln sls0sexm(r ny1ap elnvt t srrr(mp;t4alxnio3iyd mDelnmsnu0 eenmfcia1la elu sls  etr(r3iydlmt  fetls) rrrxr ;u0optomoctatfa rln o (0aexoxoctodfp raneo t0 etoir nudalt livs () 2rmumo;t4tpx moetldls2uan s (4treoxfcoytlm rliesls  etr(opio4lptnlnvsls) Dtaxmono4opx mo3tld mDumumon(0altnmfcta1laD lnvs s) etmxopoydlpee fcs t)a2rrxronu1aex micildla ul(ms t)trtoiocoy1lm eaiei;s0teuoir3nu1al emnvil( srum(r oo0tlxnmo3iyt m el(ms;u)aeeoxfctydfmD  nes;s trxriopoodlpee fctlsfs2ua( pnt1apt  ietaslsDrluvp (0tleoxf3ootom eln s t) 2xm(m3io1lm nmnetas  Drrxmooo4tpen f3iytlmDelums;u0 lermo3oadfpD luvs s) eurir3oydlmenlivt (  2tmur nt4tpxnmietydlm2ua(msn()tetrio oodlp  aivs;t s2xoxo3oodopt lfcta(  Duaump;o0tpe  ieiltfa rm(mo t4artnmf3oadopD luvo;t)s2umxm io4ale mnvs s)a2ur(moou4opx iieiat s ean s u4teeomrctodlmD  nesls0 rxr(mpnodlptnlncia( sDtmxr ;u1opxo o3tld a em(vo u4 eerxf iotlm rli s ()s2xoim3nu4ll n fvilt) rtr(r ot1olxnioeilsls2ean s t)arxnxfciotfaDelueol()trto(m3ou1apen fcias a2tm(ro;t0apt  ietasls2ulnms;t4tlxoir3iadlm   uvo;s0texoio3nydapenmictlt) Dua( o;o0tpxn i3iltfm rlnvsnu0aetrxo ta1lm  aivi s)srtrxmpoy1alenmnes s a2um(  nu4ope  oetlt s2ea( s;t)trxomr ootoa eanvi s0 2toxr oo1oltemnvta(  2tm(rp;u1tpe  oetysfa2umnmonu)aeenxocia1lmDeli sls0srtoim iudll  lfvil(fsruaum no1altn o3ils s2emnvon() eerxoctatlptrluvi t0srxm(o3ou4opte neiat) 2ta(r ;o0tleo f3iydfm2eluvs;(4artrif3ty1la rlieil(0srumxrpoydlpt mfetas)artr(r ;t0alenio3tatlm emnmp (0aleomr iy1omD  i ol(  rxr(opnu1lp nmnei ()a2ur(r nu0tlt  o3iysfaDrlumo;t0 exoxo3ty1fmDelu s (0 eurxmpiy1alt  ncs t s2rrxm ot4altnmfciyd a raumsnu4trtnxo iotlmDeauvs t sexm(m oy1ame mneta()aDtr(mont4olx  feiad m uanvon(4 exnxr3iatfpDrliei s t2xrim oydom elicsasf rrrurono1alt if3tltfsDemnvsn(0 lxrio io1oaDeln ils0tetr(r3iy1ole  fvtl(farrmu oot1tptnifctasls2umn sn(0 rtnxr3io1oa eaneol(0 rur(r ny1lpe mnetatfsrrau  nu4oleoii3iyslaDrm(vo;u) etomr to1fa rauvsls0trxrir3oo4alte ivia(f 2ta(m ;u1ape io3tas m ul(mpnt0altnmfciodopt  neils0setr(r3oy4alt mfcia()a2urx onu0oetomociatfsDeln p;u0 rxnir3ootlm eanes;t0trtoxrpou1omenmfctl( aDrm(mono4optoiociysfm2um(vo;(4 etrif iadlp elueils0 exoxo3oo4lmtn fctl(f Durxmoou0tlto ieils mDul(vo;(0alxrxf3todlpDrlnvo;t  rxoirpny1lm nlivtlsf rrru oou0tptomo3iatfs2ra(vsn()arerifcoy1lm  anvs;t0srumim3iudamtelfet t)srua(mp;o0oexniocilt sDrauvp;(0tlxnmr ty1opteaivils0 2trxr ou1opee icsl() rrm(  no4tleo oeiyslmDeanms t) ltoxo3ia1lpD lieils)srtrir nu4am nlfeil()aDuaumpnt4opxomfctys aDul(vs;t)teeoio todfat auvi ()seuo(r3oo1optnlncil() Dtm(r nt1aptn fctyslsDrluvp;t) ltnxf3tatfa elnvo ( teumxr oo1om  mnci sf Dtmxmono4tpx io3ilt a2umn onu4altoxf3iodlmDraneo t) 2xoxm3iy1ole mivtltf Duru pno1aet mieiltfs rlu o;u) exrxr3io1faDe n s;(  2xmxm3ny4oleemfvtat  rrrx ono4teeo f3iad s ua(vo t0altoxr3oadomt livs;t0 2xmio ny4amenmiet s sDrr( ono0olt  octlslmDumuvpnu4altrmoctadlmtr ieol()sruoxr iu4opt mnesas a2raurpou4tee mfeias a2ul(vont4 etrmf3totfa   nvi;( trtoimpiudaptnlnei t  Dra(rp;o0aee mfetldla rmuvpn(4 rtrxocoadfpte n s ( seuoxmpno4amen nci s  Drrurpnt4oleo fctltla em(vo;(4texoio iy1fa raueo;t seuoxr3nydlme mivt (fa2rau  ;o0tpe ioctatlaDrm(vs;t)tetomf oa1om rau i;s truoimpoo1omtnlfci t) rur( onu4olenif3iad m rmu o;(4 eenif3oatfmD ai ils) rxr(rpiy4lpte ictlt s2ra(ront0tptn fetysfs2eau snu0alerxfcto1lm e ieslt)trtoim oodlmte ieil( arrmx pnu1olxnmfetad s umnmsnu)alxrmf3oa1latrliesl() rumimpiu4lpt  nvsa(farrm(mpnu1opxoifcias s ran p ()teeoxfctydfptrln ols)seto(rpiodam emfvsa( s2rr(rpno4aptn f3tltla emu s ()trtoxocootfa r i sl()seto(o3iu4llee fvtatfaDra(  nt0tpxoioctldlm eanvo;t) rxoxo iytfpt aneolt setrio nydom n icslt s2urxr ;u0tlx  f3ild m2em( s t) reoxr3ia1fp rln ol(0sexoio io4ape mnvia()s2tmu ono4opt ifciytfm2ulnvo t4aexnmfciydlpDrlues;t  etrxr ny4ope lnvsa()arua(moot0olenioctytfaDem( p;t0 ltomf3oydfmtrlnvi;t0 rurxopoudap e ncils)s2tm( o;o0opt ifciyd m ra( o u4 ltomf iytoaDr ueols0t2xmim io1ap n ictas) rtr(r no1texn fciltfs rl(von(0 etrir3to1omt lieils srtmxopiudlme lietas srrmxmoot1tlxn ociasls2rluvo;(4alenif tatomDrlnvils tetoxrpoy1lpenmiciatfsrtax pnt1altomiciyt m2rauvo;u)arxnxr3iadomte uei;( teur(m io1lpeelfci () Drrxmo;t1oexoio3ias s2umu s (0trerxrciadfptr n o;s)t2toirpiudlmt lfvilt sDrmumo;o0tpxo f3ias a uaumpn(0 leoirciydopteauvo ( s2uo(r oudomeemnvsl()a2rrur ;u1opeo o3ilt m2uauvs t4texnxr iadlmD  iei;t0seum(m3ou4llt mnctl() rtmu  ;u0ale mf3iysla um(vo t)tetrmr3to1om e ieilt)t2xm(o3nodlm  lncils a2uau  ;u1opxomfciyt s uan s;u)texnxo oydfaDe nvsl( trtoxmpiodolen ictas  2rrxrpou1oleomf3tytla ra(mpnu)texnmr3iytfptrauvolt0s2xmio3ou1olte nesl(fa2umur oo4aptn o3tatlm2ul( o;u4tetrif3ootlmtrluvi;()t2toir io1olt mivslsfarrmur oo1aptoiieiatfs2ra(vs u0 lxrmf3oa1fm eanvo (0t2toirpio1alte ivsls)s2urum ;o4oleomf3tltls2umu p;t0 ltrxociodlp  au o
\ No newline at end of file
@@ -0,0 +1 @@
+uvo;( teur(r oydal n fei s)aDtr(m ;t0oexnmoeiyslm eauvs;() etnio iotfptraivs t0truriopoo1ameelics (  Dumur nu0aexniociasla rmumpnu0 ltomo iatoaDrauvs;s)srtm(rpiy4apee ncia( a2rmxrpno0olto f3tld mDumnvsnt4tetnxf3oa1fpDrlieolt)tetrimpiy4lltelicsltf 2um( poo4aeenioeiatlm umuvpnt0teenxrciadfptraueo;s truoxrpoo1ap n fcsls)aDur( oou4olxo oetltla2eluvo (4texnxo3oo1optrlivo;s0texrxmpiy1apen nesasfa2um(mono4tlxn i3iadfm rau pnt4aexnif3ta1fmt li i t) rumxr oy1op   icil(faDtmur nt4tpxnioetld s emump t4teerxr iadlp  livs ( t2xrxopoo4olenlicsasfa2ta( pnu1oeenmo3iltls em(vs t0 exoxocootlp r ieil()sexoiopiu4ope lnct ()sDumxmpno4tpto fctyslmDrmnms;t)altoxo oa1fptrlnes s) 2toio io4lpeemfes (  Dtr(rp;u4teto oetlt sDulu on(4teerio oo1omtr iei;(0 rur(r3iodoptnmnes tfartm(mont0aee mfeiysls2uanmo (4 leoifcoa1fatrlivo;s0 exm(mpio1ap emnetat  rta(r nt1optoiieilsfm2uauvo;(4aleomf oadlptrai i s) rtoim oodape lneils) Dumu p;u0oltoioeiaslmDumnvo;u) leoif tadoaDe n ol(0s2xm(m3io1aptnlici sfsrra(m nu0openmictatfm uln o u4alenmo iodfmt  uvs ()sexmir3oodop   nctas) rtmumpoo4oexn fciydls2rlnmo;() rtnio3oadomtr i s (0t2xoxm3iu1op   nvi s)s2uau  ;t4tee ii3ias sDel( sn(4 ltnir3oy1fp e ivolt)t2uoim3oo4lme micil(faDrrurooo0opx  feiyslsDum(vs;t4 rtnxo oydfmt  uvo;t trurir nodlltnmivils)aDurxmo;u4tlen ietadfsDul(vp t4aexoif iatfmDrlivs (0 euoir oudap   ivs s) Drruroot4tetomi3iyslm em(mon(0alerioctatfat ai i s)s2xr(o3oudolt lics ( a2um( onu0tltnio3iatlm2elu o;t4alerxf3oodomteln s;t0s2ur(mpoo1lmtelnctas aDuaxro;t1olt mf3tas s uaumo;u)altnifciatop e ues;( tetrxrpno4al  lncia() Dua( pno4teeo f3tatla2uanmonu4 ltnmo io1om e nei;(0 2uo(o iy1altnlici s  2tmxrpoo4texn o3iltfs2um(ms;()tlermf oadopDrliei;s0 eum(o3nudam nlnviat a2ur(roou4tltoiociysfs um(ms u) eerxfcoa1opDeau o;t)sruo(m3oo1aptnmicsl(fsDta(mo;t0tlx ii3iytlmDua( s;u0altoxo totomD liei () eto(r ny1op   ici t)sDrmx p;t0tpxomo3iadfm umnvo;t0 lxoifcootlaDelnvs s0seur(o3oudap  mnvi ()s2rmxmpot0tleo o3iydfa2uanvo u4trtrxfciotfateanvs;t0s2trimpiu1ol  lfetlt aruru pou1olen i3ild aDemu o t0 reoio iydopDeliei t0srumim oy1om nlicsls srta(root1tet io3iltfm uanmsn(0alenxr3todom  liei;s0trxoiopnudapenlfesls)sDrmuroou1oltomo3iaslm2ulumo;u4tetnio3oa1omDeanvilt0t2tr(m3nu4lpenmivs s) rum(r ;u4alenifciyt m umumo;(0areoir3oy1opt lieil(0 2tr(mpno1al emieil(fsDurx ooo0opxomf3ilslaDeanmp u0 etomrciadopDeanvi;t0 2umio3oo4apenlfciatfsDtm( ono4texo o3tytla2rmuvo u0aexnxf ia1la raieo;s)srurimpnodlpenlnesl()a2rrxro;u1aetoio3tatfm2rln s;(0 lxriociotfptran s (0 eumiopiydom nlfvil(f Dtaxmpnu4oexoifcilsfm2elnvs;u0tetoifcoodlm  lnvo;( t2xmio io1ole liciasfartaumpou4opxn feils aDumu snt)teerirciydoaDe ivi t0srto(m3oodapeelfvt s)s2rrxrpoo0aptomfeildlsDelu snu0aetniocia1la   uvi;s)s2urirpio1op e fei s)aDtau ooo0tee  f3ilt mDem(mo t0 rtrio3ia1oat  neo (  2umim io1lmtnmfeilt) Dtmxm no0alt moeiyslaDemumsnt)artnmf3tytlp  aues;t trxrxr io1lle lnesl() Draxrpnu4open i3iydlmDumnmo u)tlxnmr3oa1late n o;t0texoxrpnudllte fetls)artaxro;u0aetnifeiytfm2rau s t0aexnif oy1optr i olt0trxoxrpoy4amenmnct t  Drrxr nu1tleomocildfa2elu snu0treoxf tadopD li slt) 2xmir nodlptnlivt tfsDuax oot1tpt  fciat s2rlnmp;u0aexoiocoadla  luvo;( srtoxo3nu4apt lnet sfsrtaur ;u4altn octas mDea(von(4areoio3todoatraivo ()seuoxrpiu1optnmfvsls s2tr(r ;u4oeeomfciad sDrlumpn() exnio3iytlp elnvo s0trtriopnodlmtelnvs s  rtrur no0oee  o3tys a2el(vo;t0tltrif3oy1fa raivols trtr(r nudal elictat sDrrx ono4tetnifciasfmDemu pnt)texnmf oa1oateanei;t0 2xrxm io4omenlfct tf 2tmu ono0aexoifctydfmDrlnvs u)altnxociadlpt  ies;t0 2uoxm iy4lm   ies s aDuaur nt0opx if3tys aDum(ms (4 lerircoodfm r n s s0 eto(o no1ole micil(  2rm(ronu1oeeoifciatfa rmums;(4alxoio oodfpt lieo;s0t2xoxr oodomee fvsl() Dtaxm nu1alxo oeiltfsDrm(vp;u0aexomo3iotomDrlneslt0 eto(r3iu4ope mnetat aDtrumonu1alx mieiysfs ran o u4tlermrcoy1omD  uvils0 2um(r3iy4lmee ncs ()s2trxmpnu1tpxo feiys mDrlnvp;t4 eeomr oodfaD aivo t)seumxo3ny4omtnlnes (fa2tmump;o1apeomi3iydla2rmu o;t)aetrmf3tydfm eln i s) 2um(rpiydameelnctlsfsrrmxrpno0tpxomocilslm uaums;() rtrir3oa1omtrluvo;t seuoim3oy1lleemnci s) 2taur ;t1ape  fctytfs emnms;u4altoxocootlp elieo;s0 exr(r3oydllen neias  ruau pno4ale  icias s2raumo u0teerxf3oo1faDrlnes;s srxmxm oodop   nci (  Drrxr nt0oltn icias a em(ms;(4tltnxr tadfpDraiei t)t2xm(o3iydamenlfvt t  2ta(r ou1opxo ociltfaDum( p (0arxrir oo1om eauvo;(  exo(o ny1ap elicils a2rmxr no4olt  f3iyd a2raumo;(0altnifciatlp e uei;() exmiopoo4lpeemfetasfsDraur nt4aeeoifeilsla rmu snu) rtrif to1fa rln sl( sexrir3oudamt micslt s2rr(r ;u0opt mi3iltls2uluvo;u) lxnmr to1lm  aueslt trxoir nu4lltnlnes t)s2umu  ;o4olxoiocilt m emn pnu0 reoxocty1faDe n o;(0s2tmxm3oo4opt  nvt s aDrrump;t1opt  feild m2ulnvp;(4tltoxociy1fmt aivi;(0trtmxo oy1ol emnes (farum(roou1aeeo fciydfs2rlumo u4 rerircoatlmD aies ( s2xr(o iodomeelfvtat)sDumxront4oleoio3iadlmDrmumo (0arerirciytlatr nes s)t2xrxopnudlptelnetas)aDur(r nt1ope ii3tadla ua( on()tlermr ia1fm  aivilt)srxrxm iy1lltnmnvs sfarrm(ro;o4optoif3iyt mDrauvpnu4 ltrxr3oy1oaD  ivo;t trtmim iy4lmeelfesa(fsrtmxr ou0tlenii3iys m rau o;u)tlxoif tadoptraues s) 2xoio3oy1aptnliei sfa2uau poo4tpenmi3iydfa2el(von()alxoif3tadop r ieo;s) rtoio nu4amenmfcs ( aDtrx pou4ape  ictyt a rl(vp;t0alxrirciodlptr neslt)t2tm(r iydlmt  ivs tf 2rr( p;u0oexn ocild a2rl(vp () ltrxr3oydfa r n ilt0t2trxopoo1lm  mnct (  Dra(roou4apxn ociatfs2rl( o u4trxnmocia1fmDelies s)setmir nodlmte ivtl( srrmxr nt4olxnifetadfmDeanvo t)trxnif3oytomtr iei;s  exo(o no4lp n nes t  2taxm oo4aptn i3iltls2ulnmsnu0 etrxrcootfaDraivs t0 exr(r io4lpenlncslt  Dtau  nu4tpenioeiadfa2ran snt4tltrmr oa1fpDe u s (0srtmxmpiy4om n net s srtmu p;o4optomfciysls2eanmo t4 lxomf iydlmt  ueo (0 rxo(rpno4lmtnlnvi sf 2tr(r ;o1optn f3iatfa raumsnu4alxnirctodop  lueilt) eumxopiu4omt mieiat  2taxmo;o1tee ifetas aDrl(vsnt) lxomo3iadfmte i i;s  2umxopiudlm nmnvi tfsDrm(  nu0oltnio3iad a uln pnt4 exnxf oydlate u o;s) euo(o io4lpe mfcsa(fa2ur(  nu1oexoifctysfmDra(vs;(0tltoifcoatom r ivo s0texoio nydlptelncil()s2ur(rp;u0tpenmo3tasfm ulnmp ()tleomrcia1lpDe i s;t)trxr(mpiodlm nmictls  rtax  ;u1alt  f3ild aDrlu o;u0 ltnxf iotfmDe ivo t0trxrir3oo4aptnlfctat)a2rrxrpoo4texniictat a2emu p;t0tlerircoy1omt  u i (0srxrxopoy4llen iet sfarur(m ;t4olxo fetasfaDra( sn(4tlxriociatlp  aivs s seur(m3io1ol n nvilt  rurxrpoo0alxoiieiytfm2elnmp;(0alenmf3iytlate u o;s0srxo(r iudlptnlfctls)sruaxr nt0oex  oeiatlm2ua(vs;(4aexnif3totfatraiei (0trtmio3oy4ll e ivsatfsrra(root4teeoii3iltfaDrmumpnt0 rxnifcto1faDe nes (0teuoir ou4ll emictas)s2tr(rooo0tlxnifctyt m2eln o u)tetrmfcoy1oa   u i;() exoxmpou4aleelneiat) Duaump;u0oeen ieiys a rmn on(4texrmo3tadop eaivi;() rtoio no1lltnliet () rrmx p;u4alt  ictytlm rmu s;t4 rxoio3oydlaDelneo s  exrxm oudlmt mfvils  Dtax ooo0oee  fciys mDul(vsnu)aetrmo3iytfpDrlivo (0trxmxr oo4alenmnvta(f 2rmumoot1optomf3ils m2rmnmon(4 lerio3totlp  ln ols  rtmirpny4ap e ivsl() rumumo;o1optn i3ias m2em(vs;(4artoxr3oo1fp   ivs;s0t2urxm3no4op nmivs tfs2umum nu0oexoio3ilt a2eaums;u0aeenxr oytoaDe ues;(0tetrio ou1lm  lnvils) rtmxmpno0opeo f3ilt a rau sn(4arerxrctodfm   ueo s0t2xrxr no4ap elfcta( sDrr(m nt1opt ii3iytlm2eln snu4 rtomf3tytfaDr i o;t) 2ur(r3oodamtn netlsfaDra(  ;o4apeo i3iysfsDraumsnt0trenxf3ta1lpD auvols0 rxrir3no1lpe  nesl(  rurxr ;t0opt ifetldla emuvo;u) rxnifcoydlmtrli i;s teurxm iudame mivs ( arrruro;u0apto icildlm ea( pn()trenxr3iytfpDraivil()setoxo3nu4lme  fvs (farurumono0tpeoioeildfaDrmu o;u0texoirctodfpDrau s t)trto(rpiudomen fcta(fsDraxm no4teenio3iytfa ranmsnu0aeerioctydfmDrli s t  2uoir nu4oleelfeiat) rrrx pou0tpxomieiatlm rl( s u)alxoxo ootlm   ues ( t2toxm3oo4om   fet sf Duaumo;o4aexo o3iyt s uauvs;t0 etnifctatlpD lnei t0tetmxo3nu4omeelfct tf Drm(mp;o4tpto f3iltlaDrauvp;t) rtnxfciytfpD  ieils tetoxr3ny1ol emfvias)a2rr(mooo1oltn fetysfsDrmn pnu4 eenmr3oytomDraueil()t2toxopoy4ome  ieta()arraur ot0oetn i3iytfm2el(vp;u4arxoxocoa1latrlnvil( trtoirpou1lltnmfvtltfa2tr(mpoo4aetniieilsfm2elnvs;(4alxomr3iodom rlneo;s t2uoxm3nodaptnmiei s)arua(ro;o1aptoioetad m umu snu) etoif3oydoa  lneil( srum(r ou1optn nciat)artaxrpoo0oeenii3tad aDelnvo;() leoxrctatlpt livil( t2uriopny1apeemivilt) 2ua(rpnt4aetnmfcilslm uaumsnt0arxrifcoadfpDe ueo;s  etm(mpiu4lp e fcslsfarta(mpnu4apenmoeiydfa2um(vsnu0altoir totfptr i sl(0 rumio3ny1olte nvi tfsDtmum nt4opt  i3ildlm2elums ()arxnir iy1opD  n ilt)t2xo(rpio4lm emnvt (  2uru pno0ope  feiyd s2el( snt4aetoifctadoaDrlieo ()setrir3no4omte fctlsf 2tmurpou0alenio3iltfsDum(monu4alenir io1laDrlu s s)t2tmxmpiu1lmtn ics s a2urxrono4tltnmo3iydfmDea( s ()alxnxr3todoa  anvo t) 2xoir3iydaptemiet t aDrmx  ot4opx  fetasls2umn ont0 rermr ty1om  auvs;s s2toxm3ny1lptemfet () 2tmum ot0opxo o3ilt m2rmnmsnt) eeomrcoy1om   neilt0s2trxm3oudaptelfvt t)sDum(mpno1altnioeiatla2emnvp (0tltnmf3iy1fm e n sl(0teuoio3iy1lm   fes (  Dtax o;o0tpx iocilt aDeanvonu4 rerxr3iydom eaneols0srtoxr3no1amenlfesl(fartaump;t0apxniiciysfa ea( snt0texnxo ty1lp  ai i s0 2uo(r3no4ll   fcs ()s2umur nt1opt mieiltls2ulump u4 leomf ty1fmtranvs;t0 2tr(rpiydolt mnctat aDra(ro;t4tee  o3ilsfa rm( pnt) leriocto1laDr uei;()s2xr(r3iy1omeemnes sfarrrxm ;t1tet ifeiysfa2ea(mo;t4 renmfcoo1omtrau o s)srto(m3oo1opee fvs sfs2tau ont0tpeniiciasla2uluvp (4 etoir ia1oatrlivi;t setr(r3oo1ol nmnvsa()s2tmxrooo4ope ifeilsfmDemu s u0aeenxf oo1fm rliei;s0trurxrpio4lpte ietl()sDtm( ont0tle  i3iysfmDrmnvs t4 rxoxf ta1fp rauesl() etr(m3iy4al elfcsa( a2rmxrp;u1olen feildfs em(mo t) rtomo3todoaDeln i (0t2tr(o3oydlltelneiasfsDtr(mo;t0openmf3tydla2ul( pnt) rtoxf3oodomDranvs s  2toim nudap  lneiatfs2rau pnt1aptnioctadla rmnvsnu4tlenxr3ta1faDe nes ( texoxmpoy4olee fetas) Dtmx  ot0oltnmo3iad m2rmnvsnu0 rerirctotfmD livol(0teurxo3ny4alte fesa( s2urx pou1texnmfciysfs rmumo;t0 etnxrciotlpt lu sl(0t2tm(o3nydomtelnvi ( artrur ;t4ale mo3tys s2ran sn(4 etrxr ia1om elnei;t0tetmimpio4al nmfet t) rta(r ot1oeen ietasfs ulnmon(0tltoxrctotla  auvi ( setrio ny1am   neilsfsDtr(mooo0tpxo i3tlsfaDemu on(0aetrxr3iadfmDe ivs;s srxmirpoo1amt  ncilsfarrrxmp;u4teenii3iadla umnmo t4artrxf tytlp  lues;( seum(o3nu4ap n fvs tf Dumxrp;u4aetn oetydfa ran pnt4 rtomfctytfpt  u o;s)texrxr3ny4ap  mivil() 2tr(m ;u1texnifetatfs2eln p;() lxnxfcootfaDranvs;s0s2uoxr3oo4olen ivtltfs2rrxrpot0apx  i3ias mDum(ms u0 lxrxo3iotfmDrlneo;()s2xoim iydomen fctat)s2ururonu1alx  feiysfsDrlnmp;t)tleoir iytfpDr neolt0s2xr(m3oydole livtl(  Drmxmpot0opxomo3ild a ul(mo;u4tltrxocto1faD  nvs t) euoxopno1ape  ivt s)sDua( pnu4altnmo3ilsfa2umnms;u0tetnif3tytopteluvs t) 2umxr3iy1om nliciat  rtrurooo0oleoifctltfsDuaumpnt0aleomfctadfmDr i i s0s2xoxmpiy1llt mnvi ( srum( oot0opxn ictytfm rmuvont4artnxo3ootop ean s;(0seuoxmpoydlp emfvtat srtaxrpnt4aetoiociaslaDuanmsnt0tetrmo3tatla r i slt s2tm(r iy4lltnmieslsfsrurxro;o1tlto f3tys sDel(mp t)aeermocoodfpteln s (0 rtrir oo1lptnmivta(f 2umu ono4aetn oetyt a2ra(msnt4tlerxr3iy1lpD ai i s0seur(mpoy4opee ici (fsrraur ;o0aetnmi3iasfm em(vs;u0 etrxf3iadlm r nvo;(  etr(r ou1omeemnvtl() 2ua(r oo0ape  feiydfs rlumsn(0 lxomr iytfpD  uvi s)texrio iudam nlnesat) rrmurp;t4tlenmfciadlm2rmuvo;(4aleoir3oy1fpteau s;s trtm(m ny1lp n ncias) Dra( o;t1oeen iciasfaDrl( o;()alerxr3iydoptelivsl() rxoio iudlm nlnvsat) 2rm(r ou4opto fciadlm ua( o t4artrmf ootfp  an s;s0 etoir nu1om n ictls)sDrrum ou0aeto ictydfm2eauvo () reoifciydlptelieo;t)trurxrpoudomtn ivia()sDtm(mpoo4aexn oeilt m2rlumon(4alxrifcoy1lmtr ieo s srum(o ou1apeemnvtat) rur(roou0oleo f3tytfs umnmpn()aleomr iy1opDrau o t  rur(rpoo1lp n ncia() Drm( p;t0aeen ieildfaDul( s t) lerxf oytoptrauvsl()trumio oo1omtnlfei sf Dumxr no4teto fetls s2ra( o;(4aetomf ty1fmtrlues s0 2trxo3iu4lp n nciatf rtmurpoo1tltn ociatlsDrln s (0trtomociodla e n ols  exmir oy4opt  ncsa( arurxroou0tpx moctldlsDrlu on()arxnmr ootlpt  ivol(0 2uoxo3iudlm   nvsat srtmumont0aleoif3tld sDra(von(0trtomo totla  li s;t) ruoxm3iu1am  lfei tfaDumxr nt0apenmf3tytls ra(vs;u4teerirctatlmD  u o;t) 2uo(rpnudolt liesat sDtrxr ;o0aetn i3ildlsDeauvp u4arenmr3oo1la e i o;s0texmxo iudll nlfcsls)s2ua(rpnt0oee ioeiatls2em(msnu0 lxnmo iodfa e nes;t0trxm(opiodopeemies (  Dta(mp;t4teeo fcildfmDulnvs;t)altrxoctotfaDr iei;s)teuo(o3iu1ap emictlsfaDrrx pou1tlxnmoeiytfs umnmonu)alxrio3tydlatelnvolt)s2um(m iydoleelfeia(farrmxro;o1ope ioeildfs ra(vs;u0 lxnio iotfp raieo ( s2xm(m no1lme lfei sf rtrxm nu4tee iieildla rmu o;(4arenifcoy1fp  lnei s)teto(opiodam nlnet t)a2rmxr ;u4aeeniiciysfa el(mo u0tleoiociydfaDrlnvi s trto(m nu1ap  lieiltfsDururpnu1alxnifciyslaDrm( snt4tetrmr tytlpDelneo;t srxmir ou1al elfcsl(fa2ta(m no1oexn o3ildls em( pnt)trtrmr3todoat ln ols) euo(m3iu1ape  ieiasf Dtrxmpnu0tpenmietldlmDelumo;()alxrxr3todla rln o t0srxrim ny4ole  neslt s2tmumo;u1altn ociad m2umnvsn(0 rxoxr3io1opt an i ()s2xmxr3iy4ap nlneiltf 2rmum oo0aetomfetytla um(mo;u)aexoxfcootla e n s;t0t2toxm3iu1omtelies (f Durxrp;o1texomf3tlsfaDemumon(0 ltnmrcoa1fat aivsl()srurxr3nu1lpee iesas)s2rr(  nt0tetnioeiasfsDuaumont0 lxoio3to1fm raneil()setrim nu1ol nlnvia()a2ur(m ot1tlenmo3ilt sDraumsnu4 rxnifciotla rlu ol( trxrim3iodlmenmnes (faDumurono4tet ioeiadlaDrmnmpn(4arxnmfcty1fm r uvi t s2to(m iu4lp nmnvtl(  Dumx o;o0teto i3iatfs2uau s;u) exnxrciodfp e n i;t)srtmiopoydomtnmicsls)artmx  ;u0tleomfetlsfa emuvo;t0aetoxr ootoaD ln o s0tetr(r iu1omeemnvta()a2taxrpoo4aeenii3iyt m2rm(vo (0alenxr3oatlp eanvo s  rtrxmpoy4lmt mieil()a2urur ot4aexo o3iatlaDum(vpnu4aexrir3oodfaDraneslt0 2toio3iy4apee fcil() rtr(mpnu0oeenmieias m umump u4tetrxf3iadfpt lnvo s0 2um(mpiu1apeemnvsas  2tm(rono0tltnifeiat sDra(vp u0trtomrciy1lateaivilt texr(r iy1apee ivs ()s2uaxrp;o0ope mi3tyt a ul(ms;u)trermociatfm ran s;( sexo(m oodlpee ivilt sDur(mpnt4aee  feilsfsDrmnms;(0artoxo ia1fm rln ol()srum(m oudol e nvil()aDraxmpou4oltnif3tltfsDrauvon()arxnif3tadfa rlies;s0setoirpiy1ope  ieias aDuru  no1ale  ieiltls eauvsnt4alxoif3oytlaD lnei t0setrxopnydll   nes t) rurump;t1aet moctadfa ua( p (0tlenxr3iytfm  luei;t0 eum(r3oydlme lnct s  Dra(  nu0olxo feilslmDrm( s;(4trxoio3ootomtean o (  rtmxopiu1ome lnctas a2raxm ;o0aee moetasfsDrlumo;()trxnxf todlp e uei s teumxrpiydale mfvil() Dta(  ot4tlx  ietlt m em(vonu) reoxo3io1opD  nes;s0 exr(m iodll emnvi ( srtaxmpou0aetomfetatlm2rmnvpn(4aetnxociatlmD  ivs s)setrir iy1ap n fes t  Durxrp;o4oeen f3iydfm2ua( s;t4arxoxr3ootoat livi s0s2xo(m iudam n iet ( artr(mpoo1tle ifetysfa emuvo;u4aeeoir3oytoat  ieo ()seuoxo3iodaltnlivs (f rtm(r ;u1oex ioetlsla2em(mp;()aexoxocoydopte n slt0seuoxopnu1lptn fctatfs2rrx  no4opt mo3iyd aDul(vp u4alxoir3iotoatrlivi t srum(opio1lptemfci ( s2tauroot4apxomoeilsfs umu pnu)texriocoydlp eln ilt0t2uoxrpio4llen icia() rtmu  ;o0tex io3iys s2ulumo;t) rxrif iotlpDrauvi;t)s2uoimpnu4lleemnvsl()aDrmu  oo1opxo icildla el(ms;u4texoif3tydlptrauvi;(0texrxo3iudlp elncia( a2trxmooo4aet  fctad aDelu onu4 lxnio oytfa  aivolt)sexrir nu1openlnctlt)s2um(ro;u4aexo feilsfaDulumpnt)artoioctydfp rln slt0srxo(r oodamtnlivt ( arurur ;t4oltoio3tydfaDum(msnu4 lxoifciy1oaD  ivilt texoim3iodamee nctls arrmurpno0aetomo3ias sDumnms (4aexnircoo1lpDelieol(0 exrxopoodlmenlnci (fs2rr(  oo1ape iieiytla2ua(vp u) lermo iatla eli o;t)setoxr iy4ape lics (fsDtrum nt0oexnif3iatfaDulu s (0trxrxo3oydla raivolt srto(o3ou1lltnlnvsls)aDtrumpno0tex mfciltlaDeanmont0trtrxrciytfmDelieols)texmxr nydol n ict t srua( ono4tlt ioeiat a2uan pnt)areomr ia1lp rlneo ()s2urxm3iu1lmt lfetlt) 2ra(mpnu0ale ifciadfa rln pn(0aeenio3oydom eliei t0srxrimpnodal  mfesa()s2ta(  no1apen i3ild mDelumpnt0trxnifctodlm eln o ( trxrirpnudlp elnctls) rururo;u0olt ioetadls emu snt)areoxf iatfmDe n olt srtrir3oy4ap elivsls  2rmurpoo4opxomf3tltla ua( p t0altrxr oo1oateaieo t0t2tmio io4ome lietl( srrr(mpnu1ape mieiasfs emumo;u0tetnifctydomte ivi;( srtmiopoo4apt mfesasfsDtaurpot4tex mf3ilt m em( s u)teenmo3iytlaD an sls0 exrxrpoo4lp  mfetls a2ururp;u1alxo f3iltfmDrm( p u) exrxociy1lmt au o;s0 exoxmpou1ope lnvtl( a2rm(mpot1optnmfetls a umu ont4arxriociydlpt luvolt)texoxr nodolenlfvs sf rrrx ooo0openmoeiytla2umumo (4 exnmo ia1om raieolt seurim oo4apte nes ( s2rmu  ;t1aex moeiatfs um(mp (4 ltnio3iadfateli o s  exoxo3iy4opt lfcsl()s2raur no4tlxoioetadlm2rm(ms ()texoio ootfate uvi t) rxr(r io1lpenlics sfa2rmumoou0tltnifeild s em(ms () eenxfctytfaDr uvils)trurxopoy1ap  mietl()s2raump;u0alt  oetldla emnmo (0tltoxo3ootopDrlnvo;t s2toio3io4lptnmnviat  Dua( pnu0tpe mo3iat a2uanvs ()tlxnxf iydoaDrlnvolt0 exoim oo1lp nlfcta(  2um(r nu1oetnio3iysfa rluvo t0 ltrxrciytomDeaueil( teumxr3iy4op nlfvta(f 2ur(ront1tlt mietadla2ul( s (4tleomrctodla rlnvs t)setoxm iydolte fesa()s2rmx  ot4alxniociasfm rlumpnu0alxnir io1opte u o;( tetr(o oo4am emfvsa(  2rrxr nu0opt mociyd s umuvsnt)aetrmrcoydla elu o t  etoir io4om emfcil(  2raxmo;t1oee  i3iatfs2emnmsnt0teerxf ootfa rlu i s0trxrio ou1om nmneilsf rtm(r nt1tlt mieiyd sDel( p;(4 rerif3ia1omtr nvi ( sexo(o nu1omtnmiet (faDtaxr nt4olt mf3iydfa ra( o u0 leoir oo1oa  lu s;t0 ruoimpoo1llte iesat) rrmxrono4tpxn f3tlt m uanvsnu4trtrio ootlpDe uvs;s)truoxmpno1olenlfvslsfsrtrxr oo0aptn feiydlsDrlumo;(0 rtoxrcto1fmD auei ( trtm(o oy4ll eliesa(  Dtr(ro;o4alt  i3iasfm2ua( o u) exoir iydfmte ueo s)s2um(m3oudome  icta()arur( o;u1alxniictltfa2ulnmpnu0 rermo3iotomDe nvi;s) ruoxr3ny4lpenmfvi s sDta(  ;u1tleomictyd a2ea(vp t)alxnmf totlmDrlnvolt0trtm(rpoy1ol  mncil(f rur(monu0ope  ieils a elnvsnt) ltrxo oadomteln o;t t2trio oydapt mivtas a2trx pnu1olx ifeilsfa ra(msnt0 lxoxf iatfpD lieol() 2xmio oo1lp  mfvsa()sDtrxr oo4oeenmf3iatls2umuvo t)aexnmo tydfptrlnesls0seuoir oydomen fvs t srrrump;u0olx ioeiadfsDeln onu4trtoiocoytfpt lieo;s0s2trxo io1lp  mfvil() Drm( pnu4alxomf3tasfm rln p;(0aeeoxrctatoa  aieols) etmio iu1am nmfvi (fartmx p;o0teenmoctldfa ea(vo (4arerxo iatfmDranei t sexoxrpiydolt livs s  2urum ou1oetnmietysfmDelnvsnt0 leomo3iodlpDe ivils s2xo(m3oo1apee fei t) rrmx pno0oet  ieilt a el( p t0 lermo tatfaD lueilt  2xm(r iudlpee netas  rra(rp;o4altnmfctltla ua( pn()texomr oy1lp elneo ( tetrxopnu1lptnmnesa()sDrmxroou1oexoifeilt s2umn p t)teerxr3ty1oat  n i;s)s2uoxr3nydom emfvias arraumpou1tptomfeilsfa rmuvsnt0 eenir tatop eau il( sruoxo nodlltemfctls s2rm(r ot0tex moetas sDuanmo;u4 rtnioctotoa elivils0 rxrir nodlptelicsa() 2ra(  nt0oexnmo3tltfa2ua(mpnt0tltnmf oa1lp   nvs (  2to(o nu1optnlnctasf Dtrump;o1opx if3iasfm2uauvp;u)aeeomo iy1fpt anes;t) rxrim no1ap  lfvil(f Drmu  ;u4tleo fetld mDemnmon(0alenxf3oytlm ean s s0teumxrpny4omtn nci tfaDum( oot4tptoifetydfaDeaums u4tlerxocoodlmDe uvs;t)seuoxr iydameelnet t)arra( pnu0altoiociasfm2um(vs;u)aexniociatfaD  n i t srto(m oy1lmee nvtas)aDtmur ;t4ape  f3ild a rm(msn(4tetoxrcootop rauvi t0texrir io1lmt lnvia() rra(mpot4optoiictyd m2elnmo u4 rerxfctatfm eluvi s srxrxmpio1lm emnesls)aDumxmooo1tpt mfciad s2ua( p t)tetnio oa1oatelivi (0seuoir oo4lmtnmfvsl(fsDraxr nt4apto fctlt aDeaumo t)alerxfcoytoa  anvols)s2um(rpou1lmenlfetlsfartax poo1apxn ociyslm2ranvpnt)arxoifctatlp rauvolt0 2xr(rpiu4ope lnvs t  rtr(ront1aeto o3ilt m2rm( p t4alxoirctodlmt  nes s seto(o no1op  mieta(fsrta( p;o4tpxo oeiltlmDra(mpn(4arxoif3ia1lp eauvilt0trtmxr no1lmeemietasfsDrm(  nu0teenmfeildfa uaump;t0 ltriocoo1omtraivil( s2xm(m3ny4ol elfeiat s2ra( oot0optoioeildls2rmu snt0alxrxrctotlmDranes t0trxrio3iydale livi tfaDurxmooo1olx  f3iytls2em(vs t4trtrio3oy1omDranvs;s  exoxr3oo4am nmfvi t) Dur( oou0apeoii3tlt m ranmsnu4tetnxrciotla   ues;(0t2to(o oy1lp nmncia()srrrum ou1apxnmociysfm2umuvp (4arxnxrciotlpDelu ol()srxoim oudaltemnet tfarraurp;u0alenmi3ils a2eanms;t) reoxf totfmte u sls)srxoirpio4lmte fvilt arumur ;u4tpxnmiciadfa umnmont) etrir io1oaDe ues s0s2tm(o3oydaptnmiet s)srtmxr oo0oltomictlt a2ea(vo u0texrmfctatlat  n sls  rxmxr iydomeelfes sf 2tr(mpot0aeeoiieiydlm ua( o (0 etnioctodoat  nes;(  rxoio3ny4lpenlivilt)sDtaxrp;t4tltnmoetaslmDrl(mp (0 eenxo oytop r n i;s  2xriopio1alen ncslsfsrtr(rpoo1oexnmicildfmDumnmpn(4teerifciodopteaueo s  exr(rpnudamen fviat)aDurumpot0olxnif3tlslmDelu s;t) lenir iy1oa eai o s0s2xoxm3iy1ol n fvi s) Drmum ;o1olxoif3iad a2ra(ms;()trtnio3iotlatelivs (0texm(m ou1al n nvi ()s2raum ;t1opt  o3tld a2uau p;t) leoxr iotlatr uvo;t s2uoxm3ny4ole lici sf rrr(m oo4tpe  o3iyslmDuau o;u4aeenir tadfpDranvs;s sexmimpoodom n ivil(fsDuru p;o1aexn f3ias s2uluvo (4 lxomf iy1lmtrluvols0 etr(o io1lptelnvilt  Drr(mpno1oeen fcild sDumuvp;(0trxrxr iatfpDrlnvi ()t2xr(rpny1olt mieslt  2ururo;t4tptnmo3iadla2rlums t0aetnir oa1fmDe iesls trur(m oydllenmncils aDum(m nu4tlxnmiciad m ra(ms t0trenxo3oodomt  ueolt0s2uo(o iu1am  mfcs sfa2tr(r nu4apenmoeiydls em( s;u0altoxf oytlpDrlivi;s s2urxmpiydol emnviatf 2trxmpnu1openifetasfa2umumo () rtoxo oatfm elneo;s srumiopnudamen nei (f rtrx pnt4opxo octytls ranvs u4tlxrxo ia1fmtraieils0t2tr(r io4ol elnvtasfaDua(mpnu1oeeomiciysfs rl(vs;t4 rerir3ootopD aues;t tetm(rpou4lpt  ies s)srraxmpot4oexoiiciaslm em(vsn()arxoxr iodfmDr ues;s) 2tmxo3oy1lltn fcsas  rta(m no1tpen i3iyd m2rm( s u0 rtomf3todlmte u s s0 exr(mpno4apt lnviltfarraumo;o1ole  i3iyslmDulums;u4areoir3oa1fmDean ols)teumiopio1apte ivsat)a2taxr nu4apxnmociytlm uanvpnt)texnir3oatlatr ueilt) euo(opno1ome mfvi s)sDtmx pno4opto oeiltfaDrmuvs t4 lenmrctatfaD ai s;t tetriopoo4alt lnvtlt) Dtmx  ;u1altnmo3iydla rmumsnt4teenxr iodfmteanvols trxm(m3io1opt mfct s  2rmumo;t1alxo ociat sDran pn(4 lxnxr oytop  lueo;s s2umio oo1aleelivt t) rrrx pnu0tlx moeilt mDem(mo t) rxoxfcoa1fpt aivs t0srto(m3io1op n fetlsfsrurx  oo4alxoiictas a emuvon()trtoifcio1fptr n s;t)s2xoxm3io1alt  net ( aDtrumpno4ale  oeiydlsDuan pn(0alenmr3oodla eaivol(0 2trxopoo4am  livt tf rur(roou0opeo fctat a2eauvs;t0trtomr ia1fpDelu i;t0setoxo io4lme livia( a2tmxm no0tlenmoeiadlm2umn s t0alxrmr3oytlateanvilt t2tmxopio4aleelivi s)a2rax ooo0opt ii3tltlm raums (0arermoctotla ranei;s s2xr(rpou4lpen netat)sDtmurpot0altnmoetasfa ulu snt4texoir3iydlmDe uvil(0teuoirpnu4ole lfvias)srrmum nt4optomo3iltfs ea(vp;t0 rtnmrciatlm eluvs;t srxmxr ou4lmen nvia()arumu  oo0ale iietytla um(vpnt0tetoxr iadfptraueilt0 rurim3ou4ll nmiei t)arraxrpou1aex  iciysls2umuvp;u)texoircoytfa  ln olt) 2xo(m oo4lmtnmncsat)aDum(m ;t4ole ii3ils sDuan s u0 lerxrcoydlptelneslt sexmir oodop  lfvtasf 2umumo;u0alx mietatla em( o u4trxrmf ty1oaD  n s;t)t2xoirpno4llen ncsa(fs2raxront0opx  fcilsla2ra(vo;(4alenxociy1fpDr neil(0setm(m ny1alen ictls)arra(mpoo1tptn i3iltlaDel(vp (4 lxnmo3oytfate uvsl(  etoxr3io1lltn iet t)aDtrurpou4tetnmoetat m2elump;u0trxnxf tadlmDeaivi;t0s2ur(rpoodlp emfcsas sDum(rpou0alx mo3iltfm2em( onu)treoifciatomDrluvo t srur(o3oy1om e ncsl()srua(r ou4olxo fcild a2ulu p u0 lxomrciydopDraivil(0teuo(o iy4olte ictasf rum(r ;t0olt  ietydfsDrmuvp (0trxoio io1fmD  ieo;t) exo(r nodlp   ies (fa2taurpnu0aet  f3iydfm umumsn()tetoifcto1opt luesl( s2xrxm nydomt lfcslt sDtrum ou1ape  f3iadfa2um( o u0 etrmociydfaD lueslt0truo(o3ou1llenmiesl() rrru pot1apx mfetadfa emumsnu4aexnxr tatop e n i;(  rtm(r oo1llt miesasf rtm(  nt4tpxo iciys s2eanvon()tetomrctytom r i o;s  eur(o3nydoptnmfetlt)a2umuro;o0tlt mieild s2ea(vp;()trxrio iodlmteai s;s0truoir3iy1aptelnei () 2umu poo1aeenmi3tat s2ra(mon(0 lermr iydom raivol( trxr(mpiu4ame  fcsa(fsDtax pot0apt ii3iatfs rlu o t0tlxrxo3ty1omteluvi;t0 rtoxo oy4op n net t  Drr(mpoo0opxoii3ils s2emn s u0alxomocoy1lm e neol(0teuoxr3iy4op n nci s)aDum(moou0tpen oeiydlaDrlnvonu0 ltoio3tadlmD lu s t0sexmxrpnudameelivilt  Dtaumooo0aleoiiciydfa ea( pnt)alenmociodlpDean ils teuo(m3nodap  mfctlt  rrrxrooo1tpe iietydlmDea( snt0texrxr io1la elueilt0texrirpny4olt lfct t  Drr( poo4oltnmfeiad s2ran s t)trtnir iytfptr nei;()trtr(opnu1lleelneiatfsrtm( o;o4aeen ociytlm ul( s () lenxrcto1fpt anvo t0 2tmiopoy1al e fvt s  Dtrx poo1aetomfcildfaDuanmsn()aeerir oydomD aneo ()t2to(o nodape  fct (  2rrxr no1tet  oeiatfa2el(msnt) ltoxo iotlpt aivo;s)t2trim3nu4apt lfci t)srrrxrpnu4olx ii3iytlsDumuvp;t)tltnxo iodoa  lu o t s2tr(rpou1apenlfctl( sDtaumpot1tle  oetltfa2eaumont0altrmr3oadlpt lnvs;s  rurir3ou4lmenlnet (  Dtmurono0alx ioctyd mDrln p t) lxoxf todfm   iei ( teuoxo nu4amt lfctls) 2raxmont4oeenifcildla2ul(mpnt0artnir3to1fmt  ies (0srxoir oudape lnct sfsDtmur ;t0tetoioctat aDuln p t0 lxrxo3ta1oa e ivs s)tetoir3ny4om nlnvs () Drmumpnt1tpxn i3iadfsDrauvp t)trerio3ootfa rlieo;()s2umio iydll e neiasfaDtax ont4aeeomoctydlm2ea( p (4trxnmfcoydfaD anvo;t0srtm(opoo1ll e ictat a2tmxront1tltnioctltlsDuln p;t4 etnir3tydlm  aneo;t0s2uoio3oy1ope  neias sDrr( ono0aleoifeiydla ra(vonu4 eeoir3iotlp elnvils seto(opno4omenmfcils)srrau  ;o0aetoio3ild mDemn sn(4aeermoctydfm raneo t texrxr iydape lncils  rrmxrpno0alxn ietyd aDrlnmont)treoxfcto1opDeanvs;t0seuoim3io4om e nviat)aDuaurpnt4oeenii3iytlmDrmumo;(4aexrmrcto1lmDraies (0srxmxopou4ll e ncs (  Dur(roou4tleoifeildlmDum(mp (0teeomocoydfaD luei s0srtmim3oudlltnmncias  2tmxr oo0oetn ieilt s2ua(von(0aetrxf ta1faDr uei;t0t2um(mpoy1lpenlfcilt)sruaurpou4texoiieiatfaDua(mo u4 lerir3oydoaDraivils0teuoxrpoo4lpee fct ( srtmx ono4oleomoeilsfs ul(ms;t0 etnmf3iodoa   i ols  rxoim3iodaleelnvtls) rrmumonu0oee io3tyt mDea(vo u)alxrxr3todoaDeanvs ( srur(m3io4lpe mfei s) rumur ;t4teto fciytfs2elnmp (4texomociy1optr uvo;(  2urir3io4lp nmfesatfarumxr oo1alt  f3tatfm umumon(0aexnxocoodla  au o;s) 2xm(o nu4ap   ivias)arrrumoot4oeeomociysfm2umumo;t) reomf ty1la  luvi;(0s2tmim oudllee ivs t artr(root0oeeoif3tls m rln s ()aleoxr oatfmtrlnvs;s  2xrimpoo4lm e ici s s2rmu o;o0tee  i3iydla2um(mon(4trxnmf iy1lpDelu o (0sruoim3oudal e ici t  Drr(m nt4ale mociat m rlnmo;t)tltoxrctodlmt aueo s)trumxr iudopt lfetas sDurx  ou0tltniieiadfmDrln s t)tetomfcoo1oa   nvs (  ruriopoy1lmen feiat) 2raxmpnu1alxoii3tasls2eanmont0tltnmr3tadlat  u s;s)t2xo(o oy1omtnmnct sfartmurp;t1oltn i3iatfm2ua(ms t4altnxf3iodomDraueo;()t2trirpnodaltnmnvtl( artruront1oex iieiyt m umnmsnt)arerxo ta1lpDe i o ()sexmxm io1lmt  ictlsfarrrx p;t1tltnioeilt m eau on(0trenxr3iotomDeli s t srxoxr3oy1amen fviasfs2rrumono1olenio3tysla2emnmp u0 rxomrciydoat luvs s sruo(r oy1ope  nvs t) 2rrx pno4aeto f3tlsls uauvp t)tltomr3oatopD ai slt  eurir io1opt  icsl(  ruau  ;o0oltn feildlm2rm(mpnt) rerxf3iadoatraiei s)srxr(mpiu4lptelfctltfaDrrxmpot4aptn o3ias m2eluvsn(4tleomoctodfptr n s t) eum(r3ou4ap nmnes () 2trx  oo1tex mfeiasls2emnmo;t4 renmfcoa1op ran o;(0seumir nudole  fetltf Draxrp;u1texo oetasla ea(ms u)trxomr3iatfm rauvs;s) eumxopiu4om  lfvtlsfsDtm( pot4olxnio3iyd m2eanms u)aleoio todoaDr ivo;t t2xr(r3oy1al elnciat) 2ua(roou0olt  ieiytfaDrmu s (0 ltnio oydlaDrli o;t0s2tr(mpou1olte nvslsfarum(r ou0altn feiys s2rmn o;()tlermoctydfpDelu ol() exmxopoy1lm elnviat  2ta( ono1olxnmf3iadlm elnms (0tetrxf iadla r ivs ( teumirpio4apt lneias artrxr oo4ole iicilsfa2eau pnu0 etoxrcty1faDe iesls trxoxm3nudolt lnei t)srta(r no1aptn ocilsla2emnvon()alxomo iy1om ean o;() eum(r io1lmt mfci t)s2tmxmpnt0aee  fciat a emuvp;t4trxoif3iatfaDrluvi;()t2tmxopiodalen ivia(  rta(mpno0aex  f3ildfs ean ont0arxnmf3tadoaDrli i;( seto(o nu1ll   nciasf rrrxr oo1tlto feildlm elumpn()altoxrciotlptranvi t truoxo iydalt  ivsas aDrmx pot4opxn i3iydfmDelu onu0 eeoio oytla   neo;s0 rtrxopoydomt lnvsa() Duaum ot4aeto ietadla em(vs;t0artnxo3tatlp  luvi t)setm(r nydlptelieiatfaDuaxmoot1apxomieiytla ua(vo u4 eermo3tatom  an o t)sruo(r ou1lptn nei s sDur(r nu4oex  fetytfs ua(mpnt0texrxo oo1lp e uvslt0texo(o3nudal elfcs s a2urxro;u4oexnifetas m rau s u0 rxnxfciatla   neilt)srurxr oy1lmt lfcslsf 2ta(mono1oexo fctasfm ean p;u4tetrxrcto1lm  ln o;s0srtrxopny1oltelnvslsf Dtaxm ;o1teeoifctls m el( o (4trtoio3tatfmDrln slt0setm(r3nudapt lnctlsfa2taumooo4oexnmieiytlsDrlnvp;(0tlxrmo io1la ranes;t) rurxo oo4lmtnlnes (fsDur( p;o1apt mfeiad a2ranvs u0 lenmoctydomtrlnvs;s  exrxo oudopen feiltf Durxmono0tpe  oeils m rlnmp;u4arxnxo3tatomDelivs (0srtm(rpiudlle licta( aDraur nu1oexomo3tasla rlu snt0trenif3todlatr ies;t0srtoxm oodomen fvs s) Duax o;o4tpt if3iatlmDraump;t)areoif oodfmDelivi;s0sruoiopou1lme mfesa(faDtmx  ot0alenmiciyd mDel(mpnu)texnmr3tadomDeluvo;s)t2xmiopiy1lptnmnviat) rraur oo0aex  ociydlsDelu s;u4arxomfcoodlm elu s s)texo(mpnu4al n nvsltf rururpou0tpto f3ildfm2ulu o t)tltrmo oo1lpD aivols0t2xr(opou4lpte nvi s a2rruro;u0ope  fctld a2uanvs (4 etrirctatopte nes t0trtr(o nudap  lfctat arrm(mp;t1olxomfeiltfs rlnmo u)aeenmfctadopt  uvs;s s2xoxm oy1ll nlfvsa(f rrm(ro;u0oet  fetadlaDeau o t0aetrir3tytlm elueslt)setr(o3oo4om emfetls  ruaxmp;o1apx iociadls rmnms ()arxoxf to1oatr i o (0 eurio3iydaptemicslt)s2rrx  no0tee mictatlm2rmumsnu4aeeoxf ootlmDeaivslt s2tm(m nu4lltemict (f Drr(m ot0olxomoeilslmDum( p u0teeomf3oytomDeauesls texmxopoo1ome  fvs t aDuaxrono0oee  i3tydfs elnvo;u0aetoir oo1fptelneo ( texriopoy1omtemfvt ()artmu ooo0aetomi3iltlm2um(vs (0teenxrcto1fateauvi t)s2toiopnodaptnmnetatf 2trum ;o1aetnifciat s rm( snu0 renir ta1fatrli s t)tetrir3nu1llte nvi tfs2umxmo;u1olxn fciytlm rmumo (4arenmociytlatr u il(0t2xo(m3iudlm n ivtlsfaDraxro;u1oeen fciasfa2el( pnu)arxoir io1fat lnes ()teumxm oy4aptnlfctat aruax o;u4aexo f3tltfa2rm(vs;t)aeeoircoydfp r ueil( sexrio ou4apenlietas)s2urum nt1aeenifetyt a2eauvs;(0trtnio ootoptraueslt srxr(o oy4om n feslt  2rmxr ot4tleomo3tydfm2ulnmo;t4tltnmr3ootoptr uvi (0trumio no1alt  fesl()aDumxrpou4aleomfciyt mDuanmp;u0 exriocoodlm rauvo ()t2triopoydamtnlnvi t) 2tmu oou4oeenmiciadlsDulnms;t0alenxo3iy1oaDraueols0s2xrxr iu4lptemiesl()sDra(m no1aexoifeiadfm ea(mp;(4trxnir ootfpD aies s) 2xrxm3io1opeemneslt)aDta(  nt4aexnioeiys sDrmnmo;(0altoxocoadlm   u ol( srtrxr3iy4om  mfcilt)sDrmxrpnu1tpen oeiltla2uluvs u)trtnxfctadla  aivsl( t2urimpoodap n nctls)sruru o;t1olt mieiydla2rau pn(0 rxrif iadlpteaiei () 2toxopno1lpee neil( sDum( o;o4opx mietldlaDrluvs u) lxomo oa1optrauvs t  ruo(rpoy1ll nlicil( arra(mpot0tltoioeiat mDemu p;u) rtnxrcty1lp   uvi t sexr(rpiodlptemnvias) 2rau pnu1oeenifeiaslaDulumo t0treoir oo1oaD lu i (  2xo(m oy4ape  icsltfa2rrur ot4olxo feiatfs ua(ms u4tltrir3iatfpDrli s;()s2ur(mpnydomtemictatfsrrau o;t0aptoiocils aDrmnms u0arxoifctotfmtrau ols0 eum(rpiodlm nlnvt ( aDtaurp;t0tptniociytls rl(vp;t0 eenif3totoptr u s t t2um(o3oo4amtnmfeta() rraxr ;u0aeen o3iadlaDuanms;t)aeenmr iytlaD auei;s) rxo(m3ny1om  mfeia( srrru oou4apxomictlslmDra( on(4aetnmf3iotfa  ln o ()s2urxo oy1aptemnctl( sDrru o;t0tltnmoeiat a2rlnmsn(0treoio3oo1lm   iei s  eurir3nudll n fetas) rraxrpoo4tlxnmiciys mDum(vo;u) ltnmfcoatlpD lu i;t0srxoxo oy4omtnlics s)srtax  ou1aet  fciyd s rlnvs u0tltrio oatomD aies s)srxo(m3nu1amtnlncta(fs2ur(mpno4aleo o3tadla eau p t4tlenmr tytlp  aieolt t2tr(m iydole livi () Dra(root0oexoiictasfs2rmump;t)altnifcty1lm  auei;t texmxmpoy1apt mnctl(fsrtmurpnu4tptnmoctydfs2ean s;() renir oydfmD  i slt0s2ur(rpnudlme  fvta(fsDua(roou4altnii3tasfs umumo u)artoxf3oodlaDe ivol(0 exoxrpoo1om   fctltf rururp;t4apto ieiatfs rlumo u4texnxr oodlm eaies t0truo(rpio1olt livt sfartax  no0apx  o3iydfs2rmn o t) rtoirctydfa  lu o (  rur(o3oy4omee ivil() 2ta(rpnt1openifciad aDrmn o u0tlermr oodlpt aiesls)s2uo(o oydlm n fei ( arrru p;t1aeen fetad m emuvs;u4altoxo tydfp   n ols  exrxo3oodllen nvslsf 2taxrono4texnmfeilsls2umuvp;u4texoio oa1lat auvo;(  rtmxmpoy1alt  neiat  Dumxmpno1tetnii3tytfm rlumsn()aexrmfcoadop e n olt0 exr(opiy1ol  lneiasf Dua(rpoo1aleo i3tyt s em(ms;(4 eeomr3ia1fmDeln s s)tetm(rpio1ap emfetat arrauro;u0oleniociysfsDulumsnu0altomo tatoptraueo;s0seuoimpoy4amtnmieilt) rrru oou4olenmfciltfs elu p (0tlxrifctadom rlivi t0trumxm3nydlmte ietls artaum nu0optnmfeiltlsDuluvo;(4 exnmo3ootopt auvilt0s2xoxr3ny1am e net (fsruau pnt4tlxnmoctltfs uluvp ()arxnxf3todomDrlnvil(0 2trio nydlle lici t s2tmxm ot0texoifeiasfsDumuvp t4artrif todoaD  uvs;s0 2tmio nu1ape licsa( aDtrump;t0tetomfetas aDumnvs;(0 lenxo3to1lptrai s s trxm(m3iy1opt mnvs sfsrra( pnt1tle moeiyt a2ea( s;u0aeermociydfaDranvilt) rxr(opnodalt lfvtls  2trxmono4tet moetatlm2uanmp u0 reomf3iy1omDeauvs;( tetr(r oy4am elfetlt srua(mooo4opt moeilt s2raums;u)areoif oadlpDrlieols0srxrxr3iy1ape  ictltfsDrrxm ou4teto iciadfsDrln sn(4trenmo3ta1lat  nvsl()s2xmimpoy1olt  iviat)srrrur ;t0opt mfciydfs uluvsnt4 ltrxfcoodlaD ai i ()trxoxr iy4ll nlnvsl() Drrumpnu1aetnio3tydlsDra(mo;u)treoifcia1fp e i s t0srur(opiydlmtnmiet tfsrurx ont1tltnii3iydfs rmu s t4 ltoif io1opt ln s;s)texm(o3io1ol  mnvt (fsDta(  nu1tet iietadlmDuln o () exomociotoa eluvs;t0 eum(r3ou4ap emfes () 2rmump;t4opxomfeils mDum(msnt4tlxnxociatlatrau i;(0 etr(r3iy1oltnmiet t)aDuaumont4texnmf3iyslm rlnvp;(0 exrmrciadfpt aies;()trur(r3iu1apeemieiat sDtaxro;o1aeeoifctadfaDel(ms u0 renmf3oadoaDe ues t s2tr(m no1lmtn fciat) rta( ono1tleomfctltfmDrmnvp;t)teeoif3ia1faD anvolt0 eum(o3iy1lpeelfeils aDraur ot1apxnmieiat m2ra(mo u)altnxf3tydlpDrli i;()t2uoxo3oy4oltnlict t srrrxrpot1tpx ii3tat aDem(monu4aexomrcootoaD  n i s seuo(m3io1ap  micils arrm(mo;u0oexomoeiltfmDel(vont0texoxo3oatom elivolt) 2tm(m iy1olte fvt sfartmumooo1oetnmiciyd a uauvp t)trtniociatlpDranvs;t t2xo(opiu4ame mietat)a2uru pou1apxnmieilsfs2rau pnt4arxnxf3tadla  lies (0t2tr(m ou4optnlncsa()arra( pnu1tptnmfetldls rmn p;(0tlenxr3oydopt  nesls)s2xr(rpiydape mfvs ()sDuax oou0ole ii3iaslsDemnmonu4trxrmocoatfm   n i;s)teurim ny4om   fvtasfarrrumooo1tpx mf3ild m rl(mo;t0altrir3io1faDrlu s;t0teum(o3iodopee fcils)a2tmx pou4opx  fetadls2eln s;u)alerir iytlaD aiei;(0 rum(opoo1amtnmncs sfarua(mont1olxoifetad aDrmn ont4arerxrcoatfm rau i;s)srtrim iy4ap   ivs t s2ra(rono4oex  fetadlsDuan o;(0trtnifcta1fptelu s;(0 rxoimpoy4altemieil() 2rmu onu4oetn feildfa rauvpn(0aetoxr3tadopD  n o;t sexmir3iy4omee fct t  rrrxmp;u1oet ioetltlm2em(vs;t0altnio ta1la   ieo t t2xmim3ou1optnmics sfsrtau pnu1tetnio3tldla uanvont0 exnxf tatlaD livi t0tetm(opiu4alen ivi ()srrm(rpoo0aex mi3iadfaDeaump;u0aeenxo3ia1oa e i s;s0trxrio ou1openmiei () rrm(m nu1aleomfciltfaDrmu pnt4tetrxr3tadoat au s ( seurir3oo1llenmivia(faruaxront1olt  feilt m2rmuvpnt0 lxoxo iytopDr neils)trtmim3nydom emfviltfsrum(r oo1aexoif3tadlaDea(vp;u) rtomfcty1laDr nvs ( srum(mpnudlm n ietls  Drrur ;u0altoio3tltfaDeanmp;()teenmfcoodfateli i;t) 2tmir3iydol nlfct s)artrxmp;o1olx  ietadls2rln onu)aetrif ia1latraies;s0 rtoio iudop  lfesas srraxrono1tpen fetlt sDrauvs u4aeenmrciodoaDrauvol( srxo(r nu1ame  nct t) 2raum ou0oexomo3ilt mDem(ms;t)tetnmrctytlmD  ueo;s0teur(m ou4om n iviatfarrmump;o0optomo3iyd mDrm(vsnt) rxnxfcoytoat auvol() ruoxrpoy1ame mivtlt  2tau pnu0oetomi3tydfa em(ms;u4tlerxrcty1fp e ivols)trxm(opiu1lm nlfvtlsfsDraumpnt0alt  ocilsla rlu o;t4tlxoxf to1fa e iei t)trur(o3oodllt lneta(fa2rmxmo;t1teeoifetys s2rmnvsn(4treniociodoatr i o s setoiopnu4omt mivta() rtaum ;o1alx mfcils s uan p;t)trxnif oadom   nvo s0 euoxm oydom e fci (f rraxrono1aexomfetydls2emums u4artriocoatoat li i () euoxm nodap nlneiat s2urxmp;t1aetnmf3tld m2rm(ms u)tetnmfcoo1laDeaiei;t) rxrxr3nydome  nvilt)srtr(m nt1altniociasls emnmo;(0trtoioctatfptrlneo;t t2xoxr oydap elivias)arrr(mpnu0tpt ioeiytfm2rln p t0aetoir3iadom ran slt) etm(mpoodlpenmivt t  rta(m oo1oexoioeild sDumn pn()tlxoio oy1fmD anes (0 etr(r nodomtemivtlsf 2trxmpot0tetnmi3tltfs emn o;(4 rtnmfcty1om  luvil( srxriopno1apen iet t  rua( o;t0teeoioctadlm ra(vsnt)artrir oadlpteanei;t)s2toxm io1lptnmnvias  rum(ront1tlx iiciadfsDeanvo;(0tlxoircoo1fpDrauvilt) rtoxo nu4apee ivsl()aDumx o;o1oex iieildfa ra(vpn() lxrmocta1fmteanvsls0trumim3oo1lpeemfeilsf 2rmu  ;o0tleniictys s2ul( s t0tltrmr3oa1fa rlnvs t  exrxo oo4aptelfvta()sDrru  ot1oeeoif3iytfaDea(vp;(0trenxf ty1om   nvs;() 2uoxmpiodlmenmnvsasfsruaump;t0oltoifcildlm elnmp t)trxnxo tytoaD aieil() etmxo iy4al nmictltf rrau  ou1oeto i3tatfm2rm(mp;u)trenxr3oy1fmte u sls s2xmir ou1apeemicilt s2rr(  ;t0tlt mo3ild mDrmnvsn() renir tadlp rli o;( t2to(mpoo4aptn feilt srtmxro;t1aleoiicias aDrmuvpn(0aetnxo3tadoaDeli i t sexm(r oudomt lfesa(f Dtm( pnt0opt ioeiytlsDuau pn() eenircoatoaDrluesls0 2trir3ou4lpeemfesa(  2umxr oo1tpxn ietad s rl(vpnt0 rxrmocoadlp e ivo (0t2tm(m3io1oltelfctltf 2um(mpoo0alt mieiyslm2ulumsn(0aexnioctodlpDrln ol( s2um(r3iudlmenmnet (  Dtm(rpot0tpe mf3tatfm uau p;(4alenmf3oa1fm ran i;s srumxmpiu4llt mivsl(fs2rmxr oo1aex io3iatfa2em(mo ()alermrcoy1omtrauesls  2triopoodllen nct sfarrrump;o4oetoif3iatlsDrau o;t0 ltrxr iydom   i ols0setmio3io4ope  fvt (fsDuax ont1tleoii3tltfs emumsnt) lxoifciydopDrli o ()sexm(r3no4optnlfciat)a2ra(ronu0tpxn oeilslm em( o;t0artnmocoo1om   uvs t0t2urxrpou1lmte ict t  rtrx onu0tptn o3tldfmDeauvs;(0tlenifcia1lmDeauvs;t)s2xrim3iy1op elietls aDrrxmoot4ale  ociadfmDemn s;t4 exrxr oadopD  ieslt) 2xmxrpnodam  mfcta( srra(mp;t0texn o3iasla uanmo;u0alxomfctotfa eauvilt0texrxm3no4oltnlncta(farum( o;u0open feiatfs2uaumsnu)aetnif iotlmte i i;s trxrim ou1lltelictlt)a2ur(mooo4oex  ieiydla2rlnmp t0 etoxo iodfatraieilt sexoimpnu1ll elfci sfaDtauro;t0tlx mfciytfa el(msn(0trenio3to1oaD anes t  2to(r3iy1lp elnvtas sDuax ooo0alt iocias s eluvp;(0 rtnxfciytoatranvs ()srto(o oo1optnmfes ( s2uru pnu1aex iieiadls emumpn() etrif tadlmDrln o;(0s2xmimpnu1om elietl( srrrum no4ale  feildfm2uan pn(4tlenxo3oa1omDe nvslt0t2xm(m3iy1lmee ivi ()aDraur nt1openifetls aDrlu s t4 ltoxocootfa   uvs t0tetr(o oy4apenlics sfa2raurp;u4oexniicils m ea(vs;u0tltnxrcootfmDeauvi s texrxo iudaptnlivs ( sDur(mpnu1aex mieiytfaDeanvpnt0aexnxociy1oatr n i (  eumio iu4omt mictlt srtm(mpoo1olxniociydfs uluvon(4altrxf3oytla  luei ()trum(o no4ll nmnctl(  Dra(r ou1teeomfcilslmDrmnvsnt0aeenir3ia1lmDe uvs t0s2xrir oy1ap  lnesas  Dtrxmono4oeto ieilsla2elu p;t)artoioctatfptran i;s  etmxo3oo4oltn nvslt srumum no0olxnii3tldlsDeanmo u4altoiocoadoate n ils srumxrpou1ameemnvslt arrauront0tlt mfeilsfmDrmnmp ()aeenmf3tytoa r i i;t)tetmxmpio1oltemfvi t)aDumx pno1tltoif3tltls uluvo () lxnio ta1oaDeluei ()truoxopiudlpt  nciasfaruru p;u4aeeo o3ilsfaDranvp;u4tetnmr iydla elneolt)seurxo no4omt  nvt t)sDta( pot1opeomo3iadfm emnms;t)teenxfciodlaDelieo (0trtmir3io4am   ics t) ruau poo4tee  f3iadls uanmo (0arxrir3ty1lp eln i;s) rxrim3no1lmte fcs s) ruau ooo4oet mo3tldls2umump;t4 lxrxf ta1lp   i o (0trxoimpnudomen fctl(  Dtmurono0aeen iciydfa2um(monu0 eerircoa1fpDraies;t s2uoirpio1oltelfvs ( sDur( ono0openmiciasfs2emnvon(0texoifctodomt  nei;t0t2tm(rpnu4amenmieil( a2tmum ;t4ope  ieils m2ranmo u)alermr iodoat lnei;t)truoxo nudomte iei sfa2uaxr nt1oleoiiciytlm2rmnvp u4tetnxociadfaDeliei;s  2umxr3oydal nlnetlt a2rmxmpou4olxnmiciltfm raumo ()aetnmr iodfpteluei;()setrimpiydoptnlfet ()sDrrxrp;u0opxnioeilsfm uau o (0 rxrmo oatoatrli o ()trtoimpny1ll elfctltfsDua(r nu0ole mi3iatfmDulnmp;u0arerio oo1oaD  neols0 2umxmpiudll  lnciatf rra( ono4aeto octys sDrlnvonu0treomrcoadlatelnvils0trurxm oo4openmiviat a2uaum ;o4opx iiciatfmDua(mp () etoifciodfpDelivi;t srxr(m iu4omtemnes s)s2tmump;t0texo o3iatfs rmums;t) etomo3ty1fptrlues;s) ruoirpiodam n ncilt  2trum no0aeto icilsfa emu s;(4tltoxr oo1fp  an s (0 2umxr3iy1lmtnlfcs tfsrtr(r ot1aet miciasfa rlu p u4 ltrmr todlp  auvol() exrxopnu4amt  ivi t) 2tm(rp;t0alxnmietaslmDua( p (4arenmociadlpDe uvs;(  exrxo3iydal nlnesls)srua(  ou0apt  ietad mDrlumon(0 exoir3iytlmt  neo;s0 exmxo3ny1opt lnvslt)sDtrx  no4tleo i3tydls2emuvs u) lerir3ia1fmt lnvols0sexm(m io4al emiet t arumxront0olenmietasls2emnmon()aetoiocto1omteanvi;t  etmxo3nu4omte nvi t  2rrur nt1alx mociatfs um(mpnu4aexrif3tatlatrlivilt0 2toxm3iodale  ncils aDtrxr ;u1opxomietydlsDeau ont)trtnmf iy1laDrln o;(0 2um(o3oodap   fctatfsDtrxmooo0apxo oeils m elu p t4aeeomfctodlp elneol()seto(rpoydalenmncs tfa2urx pou1alt  oetysls ul(mo t4 lxnxr3iotlaD  ivol()teum(opiu1aleemivil( aDra(mo;o1oet ifciysla2ul(mont0tetomf tatlm r u sl()t2tr(o3nu1ope mnci tfaDrrxmo;o1tlx  o3iatfs2rlnvp;u4aexomo iytfmDrln s;() 2xmxrpnu1ame mict sfsrrm(mono4aetoifctadlm el(vsn() rtomr ty1lmtrlivo;s  exoxo oudap n ncs s s2ua( onu0ole ifciyt mDranmo (4 ltrmr3oo1lpDelu s s0srto(o3nodop   ieslt)aDta(  ou1ale iiciyslsDran s;(0 exnxocia1oaD  u i s) 2xoirpny1lptnlfvtl()a2uaxr ;o0tpxoiieiyslmDea(monu)teermocoodopDe uvs ( t2urxr iodam elnetl()sDum(ront0oltn ictydfa eanvp u)tlxoxf3iatomtrlueolt) eto(r3no4apen iet s  rraumo;t0apx iieiyslsDran p u0trenir tatoaDe ues s)sexoxm nudaptnmnctas)a2rrx p;t1opt  oeiatfs2ul(mo;t4arenio iotop  lues;t)tetmimpno1oleemfct tfs2rrurp;o4aexn oetlsls eanvo;u4teeomocoydfm elueolt)trtriopnydopenlnct (farum(mooo0tleomieildls2uanvs;u4tlxniocty1op e ivslt0sruoim iy4opeelfvtlsf 2tr( pnu1oeeomi3iytfm2ua( s u)aeenxo oo1omD aueo;s trtmxm3ny4al n fcsl(  2rmu ooo1aet  ieiyd mDraump;u4 rxomf3oytfpte ieo;s)sexoio3ny4ale licsltfsDrm(r ;t0optn ietysls2ul( pn(0 rtrio oatfp rauvilt) etoirpny1amen fcs sfa2umumoou4aexo fctldfm rmnmonu)alxomfcoadlat li ols0t2xmxr iudlpenmfvsat)a2tauro;t4opto icildls2uau p u0tltrir tadomDrli i s0 etoxm3iy1lpe livtltfaDrmxm ;u1aex mfctls a rau pnt4arxrmf3tydfaD  n il(0srxm(rpoodaptnlfvslt  rum(mp;u4aleo feiadfm eluvo;()trtrxfcoodoaD  nei;s0trxm(m oo4apt  ieias srrmumo;o4texnmieiyd mDem(vsnt4aexrir3totfatelu o ()setrir nu1oltnlfetat a2um(rp;o1tptnmo3tas sDrln on()alerir3oy1faDe uvi s)tetr(o oo1lpt mfct t aruaumono0oeto oeiysfsDrau s;() eenxociydomDran o ()t2to(o oo1op e ivi s  rtaxroou1oex iociydla el(msnu4trtrio oatlatran i;t t2xmxm3no4ll  mfet ()aDum(m ot4apxoio3tlslmDra(ms;t0 lxrmf oodlaDrlneols0t2tmxm oodam  lfcil(fs2ta(mpnu0oet  iciydfa2rmu o ()treoxo3oa1opDrlnvilt srxm(m3nu1ome lfvta()aDtr(  no0apto ieiysla umnmo;t4tlermo3ia1faD au ols)truoxr3oy4apeelfcsls arraumo;t4aleomo3tydfa2emu o;u) rerxr3oo1la e ieo;(0 2xoxrpny1altelncta( a2trx  oo1tlxn ictyd s2umuvpnu) rtnxf iatomt  nvols)srurxm iudapt mnctas) 2tau oou4apeomi3tlt s emnmpnu4trxnmoctodlaDr i s;( truoxo ou4llt  ies ( aDumx  ;t4tlx iociltfsDua( o;t0arermf oatlptrauvolt seuoxm3iudlmenlfct s)srtrxr nt1aexn oeiyslm rlnvp ()aeenxocoy1lmt lnvi;t0trum(rpoydale  nvsas) rtaurpou0oexomoctasfa2rmump t0teenxr3iadomD an o ()s2toir3oydamenmncsls)s2ur( ono1oetnmiciys m rlu p t4alenio oo1fmDeluvi;() exmxo ny1llen fctls)s2urx pot0oetomi3iat m rl(vp u) rtrxf iotomtelivi;( trtoxr ny4op  lics s)aDrrurpou4tle moctltfs2elums t4alenxo tadopteluei;s)texr(opio4am   fet ( arurxront1oeto ictadla2emn sn(0aexnio3iatfpt  neo;t)s2toio iodamt  icil()srrm(mpoo0optnifctyt mDem( o ()texrxociodfm rli o;(  etm(r iudomt livt t)srtmum nu0aeeomociltfsDua(mo (4arerxoctodfa r uvi;() etr(r3iu1ll nlnvs s  ruaxmo;o0olxnii3iasls2ra(ms u) rtnirctodlaD au s (  euoimpnu4ameelfvs t sDrr( p;t1alt  feiatlaDul( pnt)aleoircoodfaDelu i;s teto(o3nu1amte nvias)sDrrxmpou0tpt  o3ilt a2umu s;u4 renifctytlaDelivo ( sexr(mpno1ll nlivt s)s2ua(mo;u4tleoio3ildfaDranvonu)tlxoxr iydfaD  neilt t2urxr iudlpt mfci t)srtmxmp;o1apx  iciytla2elnmsnu0treoif3oy1late nvo s) rtr(r io4omenmivs sfsrtaxr ot0aptnifeild aDuanmp t0alxnxo iodomt livi;(  2xmio iudomee fvsa(  2raxr ou1aeeo fetasls2uauvonu4 rtomocia1fmDrlnei t0trxmimpoydlleelncsat aDraxrpno1oee  fetydfaDea( s (0 rxoio tatlp rli i;()tetr(rpiydalte fct t)s2rmur oo4aeenmfciad m2em( s;()tltnxf oa1la ean s s)srtmxm oo1lpenlncs () rua(m nu0oexoii3tlslm2uaumo;t4 rxrifcoy1om r iei;t seurxo oudap  lnvtat)aDraxrpnu0olxn ieiatfa eau onu4 renmfcoodom  luvs ( setoxm3iydllt lfvt s) 2uaxmpnu1tpt iictad m ulums;t) rtoxr iodop  lnei (  eumxopou1amtemfeiat arrrurpnt0apxnmoetls s ranvon(0 eeomo oo1lp   uvi t)sexoxm3iydal nlietlsf Dtr(rp;o1oeeoiieild s2el(vpnu4tltoxr iytfmDeai s ()t2xoimpnudomeelfctl() rtaxmp;u1aetnmoeiasfs emnvs;(0areoxf oytfmt lu o t0 2trir iydap   fcta( aDtaumpou1ale io3iadlaDrl( pnt0 reniocto1opDeau sl( seum(opny1optn fcsat srtmxro;t4oltoio3ilt s2rmuvs u)aexnxociatopteln o (  exmxm3nu4ole mnvslt s2rrumoot0tpenmicildlm ul( p t) etnmocty1lp r ies;s srumxm3iudapt  nes t a2trump;o4altomfciytfs2um(von(4alerif oatlptrau sls  2ur(o3ou4ame lici tfaDtmx pno0tlen oeiadfs ra(vp;t) lenifciatoptrlu s s0 2urxm3oodapenmivils)srraxr oo4tet iietytla um( o (4tetnif tatfmtrau ilt s2ur(m nudol   ietl(f 2tm( poo1tltomf3tyslaDeluvsn(0tltoxf3io1fptean s;( trtrim iy1op  mivt s  Drmurpot0alto i3tadfsDumnms;u4 eeoio3tadfmtraivolt)tetrio iu4ll n nvt ( artau  ;t0aex io3tyd a uaump;t0 eerif iytfm r u ilt srxm(r3ny4lmee ivtls  rtaxrpno0oexnii3iat m emnvsnu0aetrircoy1om rluvols) 2to(r3nodaptn fvias)arraxm ;o4oeeoiieilsls ra(vsn(4 rermr3oa1oat ai i (  etmxr iydal emiei () Dtmxmoot4apx mi3iltfs2um(vp;(0trermocty1opt  iei;s0 rtrim3iu4optnliesatfsDrrumooo1opt  f3tyt aDumn pnu0artoir3ootlpt luvo s t2uoxo3nudlmtemivi t)srrmx  nt0olto ictat s2el(vo ()tleomf totoa   i ils srxoiopoydapenmivsas srtau  ;u1tex mo3tadla2rmnvsnt4 rtrxr3iy1fmDr uvs;()srto(o io4ap  mfvias) Drrxrp;o4apeo ociydlmDrlnmpnu0 etnxo ootlaD au s;s) rxrxmpoydal nmfeiasf rtrxmp;o0apt ii3tadfs rl(mpnt0trtnxo3to1lmDeli sls t2to(mpoudaptn iesltfa2tm(rpno4tltoii3tatfs2ra(mp (0 rtrmr iydlm   i o;t tetoim nydamtnmfes ( arrrx ooo1aexn i3ilslsDulums;u0 ltomrctydop rli slt t2uoiopnudolen fciat)a2uru  ou0apeoiictld aDum(ms;t) exnmr iy1fp eanei (0tetmxo oudam  lnvtl( arrm( pot4oleo fetas mDum(msnt) rxnmf oy1la r nvo;s)trxoxr iu1lm n iet t) rrmur ;o0altn ictysfaDel(vo;()tlxrirciy1opteai ilt0 2xoxo3oo4alt licsltfartrumpnt4oleo f3ilt m elu s u4aexrmf oydfmtrlnvo;t)srxoxmpnu4aptnlncsl( sDrm(ro;u1oeenmo3iasls2ua( o t0 rxomrctytfm rlueo;t trurxopny4ll nlnvt t)s2uaur ;u0optnmfeiad aDulnmo t) etrio iadfa rlivi s sruriopiydameelfcias)arra(mo;u0oee  oetydls2ulnvo u)trxrir3oytlmDeaivolt0t2urim ou1ll e fei (fsDtax poo4oltomf3tltlaDra( p t0 ltnmr3oytomD lnvi;()texoirpny4opt  neslsfarua( p;t1tex ifcild s2umuvp t)trxrmo3ta1oatrliei;(0 2to(r3nydlp  lnei s a2ta(m no0apt ifeils sDraumpnu4texoxf3oatlmtelues;t)t2xrxopiodol  mnvtlt srumxm no0
\ No newline at end of file
@@ -0,0 +1 @@
+ueil(0s2tm(o ou1lmeelicsls  2rmxrono4oeeo f3tyt s ul(ms;(4tetoxo oo1lpDr ueols t2xmio3oy1alen ivsl() rrru pot0apenmf3ildfa2elumpn(4tetnmf tytlaDranei;s) etoir3nu1omee fcs sf 2rmx onu1tlt iociyt sDelu o;t) rtrmf3oadlat au s;t)t2um(opiudlpte iciat) 2umxmp;u1tpe miciytlm2umumo t4tltoirctatlm r nei;()srtr(r3oy1lp   feiltfaDtmxrpnt4tpe moetls m ulump (4tetoir3ia1lptrlnei;s0 eto(m3iu4altelfci ()s2tm(rpoo0opeoio3ild a rl(mp t0 rtomf3iy1lat ln o;(0t2urio3ou1alt livtatf 2rr(mpnt4ale iiciad s rm( pn(0 eeomoctotfmD  nvi s0srto(o iodlltnlnvtl( sDuru  nu1teeomi3tad s2um(vp () renmf3to1fa  luvs;t t2um(rpno4ame lieiat) Dumu onu1tltoioetad sDul(ms;t0altoxo3iydlmD lu s;()trumxopno1opee ncias) rrrum ;u4ope mfciadlaDuanvs (0altrif iytomt  ivi (  2toim3ny1oltn iesas) rrau  nt4olxomoctytfa2eaumpn(4teenir3oodomt livilt)trurim3oo4lmtn neias)sDua(r nu0oet mociasfa2rmump;t0artomociatop r n o;t) eurio3iu4alenlnvsat  Dta(m ou0teeoiociys a2rl(vs;t4tlxoir tatfm ean i s  2umxm nu1amtelicil(f Drax o;u4oet mictysfa2eaumont4arermocootomtr u i (0s2xmio3ou1olen ictat)srta( poo4optoiietydfaDrl(von()aexrmo oa1fp r n ols texmxr3nu1ap e ivsa()sDrmump;u4opxn i3iad m2ulnmpnt4tlxomr oa1lm ran sls)sruoxrpou4ape lfcsls s2rrxmono1oltnmfctyt mDel(mo;u0tlxrmf oatfp e i olt0 rtr(m iodop nmfeil() rrm(moot4olx  iciatlsDuln p u)tltrmfctatlpt  nvi;t seum(opiu4opee ivtat)sDtru  ot0oexn iciysls uanmo;t4alxrmr3oodoate iei;(0tetr(r3iu1lle livsls aDrau pnu4oltniicildfa2ulumo;u4artnmo3tydfpDr uei;t0s2tr(opoy1alt liciasf rtau o;t4oetnioetydla2eluvo;u4 eeoif todlat liei t0 rxrir3nu4op emneta()arrmxm oo1opto fcild m2eauvpn() ltnxo3todfpDran i s0srumxo3io1lmtnmnvils)sDuaxmpot0oltomi3tadls2ranvp;u0alenio tydlpDrluvols0 etmim3iy1ap n ncia(fs2tm(mpoo1apxo i3iasfaDemump;u4aetrirctadop raneil(0t2um(rpny1lm   fcsat a2tm(r nt0tptomi3tls mDemn o;t4aeenio tydfpDeanvi;t0seumir3io4alt  nvi s)aDrmxmpou4aeen oeild m2eau s u) rtrmr3oytlmDr uvs;t) ruoir3oy1apeelfvtat) 2uauront4oexo oeils mDuluvp;u4texrxocio1lp r i s s)s2toxmpoydlpe  fvsl( aDtrumont1aet  ietydlmDemnmpn()altoio iodlptranei s trto(m oo1am  mfvias aDumu poo1aeen ietltfm elums u0aetoxo iodomDrlivsl(0trxrio3io1amenlfeil()arumum ;u4tpxomieiyt m rlu p u4arxnif ta1oatrauesl( truo(m3nydapeemfeil(f rtmu  no0ole  feias m2um(ms t) rxnmr3iydla  liesls) rtmim iydolenmnci t sDrrumpou0texo oetat s2rmu pnu0 exoxf tydfm eluesl()t2umxopou1aleemivtlt) rra(rpno0aeeo feiasfaDelnmp;t0trxrmf3tydfmtrau o;s  rxm(opoy4oltelnci tfaDtmur ot4tptnio3tadls ul(mpn(4aeermrciotoa raivol( sexm(m3oy1omtelfvtlt) 2tax  nu0opxnmfeiyt m emnvp u0aleomf3iytfpDranvs s0srtm(opio4al   ncsasf rraumpoo1tleomictatfaDumnmont4aexnircta1lm elieol(  eurio3oudlpe livta()sDrmu  nt1tetoiicilslm rmu snt) rxrxr3tadfmDelnvil(  rxrir3no1lp n ncia() 2raxrpno1alx moeiad sDemnvsn(4aleomfcoydlatelnvslt trtoim3iydopt  ieilt)a2trx p;u4alenii3tasls2rl(vo t4aleomf oa1lptrli s s sexoirpoy4ll   ivsls  rtrur oo0optnmieilt a2rmums;t0 rtnmo tatlp eaivo;s0 exo(o oodop nmivil(fsDrmu p;o4tlxn f3iadfa emnmpnt0teenmf3totfm rlivi;()seur(r oo1llen ivt (f 2tmumpno1alto o3iys s ran ont0 eeoxocty1lmD  u il(0setm(o3no1optelfeias) rtr(  ou4ope mocilslsDulump;(0arenxfciytla rau slt)t2xr(m oy1olt mncilt)aDrmx p;t4olx mo3ils s2em(vo (0 rtnio ta1fpt auvolt)srtmir3nodlmeemnei tf rurxrp;u1olx ifeildfa rmump;()teeomo3oy1op ran s s0t2to(r3nu1olenlfci sf 2uax poo0oee moeilt m elu s t0tlenmo tytopDrli olt0t2xriopoo4oltnmivsls a2rrum ;t4teto ocils m ra(vo;t4teerio3ootla rlnvilt) etrxopnu1omeemfei ( a2taxm ;t1altnii3tadls2ea(mo t) ltrmf3tatfaDrlnvol() rto(mpio4amte ncs s)a2um(roou1tee  i3tlt s2um(ms;u)trxnxf3oydomDelu ils)srxo(mpoodoptelnes ()a2tru oou0apxnifeiytlaDelumon(4trenir tatlptrlu o;() 2uoim3nudom  mfvt s srururpnu0aex  f3iltlm2eanms;u)aleoxrciatlmDeaneo t s2urir3ou1omtn fetatf 2taxmo;u0tet mfctasfm eanvp;u4arxrxociadomDe neil(  exo(o nu1lmte nes t  2rmxrp;o0tltoio3ilt s2umumo;t4 reoif iydop r ies t0t2trimpnu4am emfet s  Dtaumont1aptn f3iasfs2rmnvpn()trxrmfctotoptrlivs t  rxoimpou4optnlfvt tfarurxmoot1tpt mfciyslm umumpnt0 ltnmr3iadlmDe uvo;t  rxrxo3oydopen ieiat arum( p;t4tpxnifetyd s2ulu p;t)altnxr iadom   i s;t)srurim nu4lptelnvtatf ruaxmpno0aex iieilsls ul(ms u4aexoxf3oytfpD lies ( seumiopou1ap e fesl( s2urumont4tle  fetld mDrlnmp;t0alxnir3todlaDe uvi s  etmirpoo4ome lfet (f 2raumpoo4tpxnif3iasfaDuaumonu0aeenmoctytfptrln s;s)trxmim3nu4llee feta(fs2ra( o;t4tleo ieiydfa2eluvont0aetnxrciy1lmteln o s)srto(rpiy4lm   netltfa2tm(rp;u4tpx  o3tat m ul(vsn(4arxnmfciotomDeau s s trxm(rpou1lm elnvilsfs2trumonu0texn iciasla rln p;t)tetrxfciatomDr ieo s) 2xrimpou4om nlicsat  2tmum ;u0optoioeiyslmDulnmp (0texoxr tytlate ueils)t2xm(o nu1op   ict (f 2um(mpno0opto f3iysfm emumpnt)tltomfcoydfaD  ivi () etmio3oydll nlivsls) rtru o;u4tpto ieiatlsDea(vp u)tlermr iytomDrln ilt trxoim3ny1lm nmicsl(f Dta(  nu1tlt ii3ils m ul(mo;u0 lerxrciotoa  aivils) 2uoiopio4aptemfetasf 2ta(  ;t4altnii3tlsla rlu p;(0arenxf3oytlp raueil() 2uoir ny4am  mfet (f Drmx o;u4optomf3ildlm rm( pn()trtrmfctotlm rlu s;s0srxrxr3nydlm  mnctls) Dtr( p;o0aet miciyt m2ua( p;t4aexoio3ootlmD  n il(0srxrio3oo4amte neslt) 2ur(mo;u4texn f3tytls2uluvon(4 renio3tytoa e uvi (  etrxo io4lp e fci t a2um(  no1apen iciltlm rl(vp;(0arenio3oy1op elu ol(0srxrxm3ou1lmenmivs sfs2um(ro;u4opt iieilt sDem( pnu) lenxoctytfp e nvo;s)sexmxo nu1olt micsas)arrau oou0optn fciys mDra(vo t0aeenifcoa1late nvi;(0texrimpoo1amtn fviat srua( oot1olenmieiatfm2rln p (4tetoxfctydom e ies;()teuoxm io1alenlivt t srrrx pou4aetnioeiysfs um(vs t4trxrmo3io1lpDeaueo t srumxo nodap elnvt s srrru  ;t1aeenio3tys s2emu snt0aeenmo3ootlpD  n o t)trtr(o3oo4ap nmfvtl(farrmxrpou4oeenifciad a2elump u0aetnxr3ty1oateaivils0 rtm(m no1lmtn ivt t)artm(m ou1tpen o3iatlmDuluvs u4arxrxf3ia1fp raies (0 eum(m iu1oleemiei ( srur( p;u1opxnmi3iadla ranmo u)aetrmocoy1omte ivsls)t2toxo3oy1omte fvt () Dur( o;t4olenifctldlm2rl(vonu)trtoir io1lm  lueo;t0 etrxopoo1amt  ncsl(fsDraxmpot1open ictasfs2umu pnu) exomr oydopDeli o t  rxmiopio1ap  lnesa(farrruronu4tptnii3iad a2ran pnu4tltrxr iy1fmtrlueo;s  ruo(rpoodoptemncslsf rtr(  ou0openifciydfm2um(vs t) eeriocto1oatr i i;t0srxm(mpiu4opeelnet sf rtm(root0opt  i3tlsfa um(ms (4tetoiocty1oa r nvi t t2um(mpou4op  lnvt ()sDra(r ou0oeeo ictltfaDra( p t0 lenmr iy1lpte i ols0 etmxo io1lm elnet s)srta(m nt4tpto f3iadfsDra(vo u0altnmo3tytlmDelieo;t)srxoxr iu1ame livt ()sDrrxroot4tet  oeiytfs2raumo;()arxoircoatopte i olt srtriopoydopen ncias) Dumur ot1oeeo f3iyd mDran sn(0 etomf iy1latr nvs;s0s2urxr no4lmeelivt tfsDtr(  ot1apto icias aDrmn pnu0 rxrmf3oodfaDranvo s)s2xoir ou1amte ncsls sDum(  ou0tpeo f3tat mDul( s t0altoxrcty1optrlivols)s2xoxopnu1ap nmiesasfaruau p;o4olt mictlslsDuanvs t)tlenio3tatfa  ai i;s0 2xoxo3no4omtelici (fsDta(rp;u0tpen ociadfmDemuvsnt0 leomf io1lmD  iesls0sruo(o3oudlpt mnet tf rrrxro;u0tlto fctlsls ulnvs;t4tleoio oy1omDr neilt0 eumimpiodal emnvi s  2taxr ;u0ope  octadlaDeln on()tltomr3tytlmD lu i;(0 exr(r io1oleelict s sruru oot1ole iociytfsDra(mp (0treoxfciatfpD aivo s) etoimpiy4lptemfvi tf 2rmx  ;u1tpx mf3ilsla eanvs;(0tlxrmf3oadfmD aueo ()setr(r ny4lpe mnctlt) rraxmo;u4alxn o3iydfmDeaumo t)alenxo oodoat  uvsl( srtoxm3oodam   ivsl(f rumxm ;u0oltoiieiys s rm(mo;u4texoxrcoydlateau o;t trum(opoy4ope micil()sDuau poo0alx  fciatlaDemnvsnu4artoif tydlaD aivilt srtm(opoy1ll e nes t  rur(rp;u0aptomicias s ean p;()aexomr ta1fpDelivs s0 eurim3nodllt lfcsas) rrauroot0opeoifetytlsDraumont0tltrxfciy1fate n ilt)s2uoir oo4apte fet s) Dua(r ;o4aex mo3tltla2rl(vp;u4texoxf3oo1opD li sl(0 2umio iu4ole mnet sfs2rru  nu4optoifciytla2ul( p u0 exnif oo1lm rlivo;(  2tmir io4oleelneta()aDrrx  ;t4tleomiciysfs em( o;(4arenmo iy1fmt  ies;()teumio3iu4ol nmncs () 2trx ooo4olt mf3ildfm2rmnmpnu4artnirctadop ean i;s  2tm(m3ou1om nlfcs (fsDur(ronu0tex  iciatls ea(mo;()trtnir3oo1opDe u s s)srxrxr3nydolen ics ()sDtaxr oo4tptoifetys s2ul(vonu0aexnif iotlmDr u s (0 exmxm ou4llen nctl(f rrmxmpnt4ape mfciasfaDulnms u4artnif ty1lptrlnvi;s)srtm(mpou4ape  fcsas  Dra(roou1oltnmf3tas s2ranms t0 rtrir todlpDelu o t)srtrxm ny1amt lnvsl(  Duax  ot4tpto fetys a2rauvp (4tetnmf oytfpteaies ()tetrxmpoy4olt lictat)sDrax p;u0oetnmi3tltlsDua( p (4arxrmf iadfmtrau o;()texrxo nu1ol nlnei (fsrum(rpoo1texo i3tltfaDraump;u0 rtrmrciytfpt anvil() etrir3nu1apt  fcta()aDumxro;t4aee  ocias m um(mont0aetnmrciy1oa ranvs;s) 2xoxr iodap   fes t sDrm(rpot0aetnmictydfa ua( p;u0 exnxfcootlm  luvs t srxr(o oodomt  ivsas srrr(m ;o4optomf3tysfmDul( onu4 rtnxr iodlptr uvo ( texr(mpno4llt lici t aDrmxr ;t4tpx  ocildls2elumo t4 lxomrctotfa  lneols tetrim3nudol   fvils s2ururp;o0tlenioeilsfm rau o;u0 renxf3oa1fateaivol() rumim3iydlle  fcsl(f Dta(  ;u1tetoifciytfs2eaums;t0alxoifcto1oat liesls  2triopny1op n ncils) 2um(mont0aeenmieiytfa2eaumpn(0aeeomf ia1lpDeaivs;s)srxmim oydlleemicias  rum(  ;u4texnif3ildfa emuvo;u)alxoxr3iatlaDr uvi ( setrxm3oodoptnlfvt t  2ua(mo;t0tpeo ieiasls emnvs u)aexrif iytlmt livo;(  2ur(m3iudlltnmietatfa2ta(m ;u1teeomictadlm ulumo u4alxrifciydomDr i o;t0s2tmxm nydaltemnvslt aDtrum nu0tpt mf3ias s2ua(vo;u)arxrxf iytomtran o;s  2xmim3nu1optnliet (  rtmxrooo4tle iocildlmDrmuvp u4 eerir3oytlatelu i ()s2uoxr3oo4ape lfetat sDumuro;t4tpx  i3tysfs2rm( p;t4trtnmo3oytop rauvilt0 rtmir oo4al elnviat) Drm(r ou0oeenmi3tlt s2uauvonu0altoxr to1lptean il()teuoim3oo1lm  mncsl(faDtau  oo1aptoiietydlsDrl(mo;() eenir iy1lmD an s s)setrxr3nodlpt mnvt tfarrmuro;t4tetnii3taslm2elums t4texnio oydom eaivs;() etr(o iudaltelnvia(f Dtrxro;t4aeeomoctldfa umn s;t0tltnifciydlat aieo s0srtrxrpiy1om nlicilt)aDumumpnt4tee mf3iatfa rlnmsn(4aetoxo to1lm eaueslt)trtr(r oudoleelfes sfs2raumo;u0tetn o3iat a2ua(mo;() exoir totoa  au s;t)trxr(mpno4openmieta(fa2taur ou4texnmietytfmDeaumsn(0 rxnmrctatfaDrlivsls)trxoiopno1ame lfvi (f 2rru  ;t0olx ifcilslm2ul(ms;t4 rxnxocoy1fm  ln s;(  2xrir3nudalee fvt s  2ra( oot1tlxn icilt s umuvs;u0 lxoxo3io1fp e u s ()teur(r oudlpen ieilt  2urxmoou4opt mieiad s2rm(mp;(0alxnif oodfaDeauesls) etm(mpny4amtnmnet sfs2urxrpnu0oexoif3iltls2um(mp;(4 exnxr iatlmD anei s)tetmir io4omt  fetat sDtr( pou0aexomi3iysfmDuan pnt)trerxo iotoat aneilt0 2trio iy1om n ivil( arrrxmpnu1oexn ictad s umnvs;u)trtrxr iydfa rlies;()sexoxo3oy4op   iei t) 2tru  ou0oet mo3tys s um(vsn(0altrifctydopDrlivi s)trto(r oo4omee ncils) Dumu  ou1aleo feiltlsDranvpn(0arxoxrcoodfp  livo s0 exmxr3no4am nlicil(faDrauront1aexnmo3iadla2rln o;t) renxrcoadlpt aieslt) rxr(m3oo4lm  mfvils srra(monu4aexomfciytlsDeaumsnu0tetrio ia1faDeanvsl( setrimpou4omt mneta( s2rr( p;u0oeenii3tltfaDuan snt0 lxoxfcoytlmDelnvi s setrim3iudll   ietl(faDurur ;o1tpenmoeiltls uanvs u4tetrio3ia1lpD aiei t t2tmxm3no4ll elnesat) Dumu p;o0tpx  ictls aDrlu snt)alenio3oodlmDeauvolt0 eur(rpiu1al  mfci s  Dra(m ou0tpeo o3tlsfa2rm(ms t)alxoiocoo1omtraivi;( srxoio3ou4ap n ietas)s2rrxroou1apto i3ilt m2ua(vs;t4arerxociatlptrau o ()setoxm no4llt  fcs (fsDtau p;u0apx ifciadlm2umuvsn(4alenmo oatfmtrlueo;(  rtrxr nu1al   fet (  rtm(rpnt4apxo i3ildfsDem(vp;(4teermfciytop e nvo (  etoio ny1ap nlfcil() rrmx p;t4tlenioeias a2rln o;u0tltrxoctotfat  ies t  rumxr io1lm e nei t s2rax poo1aeeo ociad mDulu o;u4 eenmocoa1fm elieilt0seum(o nu1oleemnci s)sDum(moot1apeoii3ildfsDrlu pnu) ltrxr3oatfaDrauvsl() rtrir iy1lmtnlivt t) rum( oot0aleo i3iasfm ran o;(0arxrmo oytopDe n i (0 ruoxmpiu4ape  ncs s) 2uax o;u0aptomocildfmDumnmonu0 ltrmrcoodfmt  ivo t) eurxr ny1om elfvi s aDrr(rpou1aex  i3tydfa elums;t0 lxoircta1faDrlneilt  2tr(o ou4ll   fvtas srua(mpoo4tpt  ieiys aDeanvs t)tlxrxo iy1fp r ieols s2um(r iodllen iei () Draxr oo0tpeo i3tysls2umu p t)aleomr ootfptrau slt trxr(opio1lptemfvtlsfa2ua( o;u4aet  ieiyt m2rm(mont4 eenifcty1lm e i s t)trtoir oydamee feta(f 2tau  ;o0oeen fctysfa2umu s (4aetnifctydoa   uvo;s  exrxm3iydlp n ietl()sDrruro;t4tptomoeiad m2uau pnt) rtrir oadfp rlieil(0s2uriopiu4lptelivslt a2tmxm ;t0olxnifeiaslaDea(mo t4aetnmr ootfpteaues (0s2uoxmpnydap nlfcs s)aDrrum ;o0alenmiciys m2rlnvp;u4arermr3to1fpDelneils0 euoir3no4lm  mnvtat)s2tmu onu4apxnioeiyslmDemn o u)tleoifciotfmt livsl( tetm(mpiu4olte ics t)a2trum nu4oexn i3iadfs rluvo;u4aetrmfcoa1om r iei s) 2xrir iy4amtemict t)arta(rp;t4tpenmfetysfa ra(mpn(0tlerioctodfmteau ol( trtrim iy4apee fesa()arra(moou0tex mo3iyd s2rl(vp;u)trxnmf tatfmD livilt0srtmxm ny1amtn nci s)s2uauront0opeo ieildlaDrm(vs (0 lermf iydoaDe n sls0seumim iydalen ics (f 2uaxrpot0altnii3iytfm2um( onu)tetnmr3oadfat auei s)t2xmirpny4ameelfesat  rrrumonu1aexnmocils a2emn o u4aeenmr3iytlaD anei ( sexr(rpnydlp nmictl()a2uaxmp;u0tpenif3ilsls ua(vo t0 ltrmf iytlm r iei;s  2um(r3oy4lp   iesas)arurumpno4oeto i3ilsfs2rlump u)alenxf3iodfaD anes;(0texr(mpno4am   ietl(fsDumump;o0tlt mfctad m2eanmonu4aexoif oadoa   ieslt) exmir3oy4apt mfcta(  Dra(mpno1tpeoiocilslaDumnvsnu)trenxr3oydla elieil(  etrir oy1om   nvtl( arrmxmpnt0tleoiiciytlmDrauvp;(0 leoxo3oodfa raieolt  etrio3io1ap emfei tfsDurx  no1tetniictys mDra(mp;(0treoxr ty1om rlueslt s2tmxrpnu1apen nvt ()aDtm(m oo4aet mo3tat m2ulnvp t4arermfcty1la  luvo t0seuoxr3nydomenlnvta( sDuaxr oo4tpxoioetls a emnvo u) leomr iadfmD li s;t0setmxm3iudol   fesltfaDuaur no0oexoiictlt s2emu o;u) lermr3iadoa e uvi s  2uriopiodapee nvs tfsDtr(rpot0apt  oeiysfm2eanvpn() etoxf3ta1fmtranvo;t0teum(opou1optelivsltfa2uax ono4tlx  f3ildfsDemnms;(4 lenifctytomDraneol(0srtm(r iodalt mfcsat)sDrrumpou1apxo ociyslsDran p;t0 lxoio3io1lat lieolt)trxmxrpny4olt  nesatfaDta(root1oee moeilslsDumnmon(4 ltoxoctydfptr nvo (0seto(o oy1ap emivi (f rumumono1tpx mictyd a2ulnvs (4 eenmo oy1lp elneslt) 2triopoydlleelncta( aDrmxm nt0aet ii3ilsfm2rl(vp;t) ltoifcty1lateluvils)seurxr3io4lltnlivsasfartaxm nu0oexn i3ildlsDum(ms t4 ltrmf3oy1oa  aueils  exmim iu1llt lnei tfa2uauro;u0tpxoif3iad m em(mpnu0aeenxr todfmtraies;()srurir oodome  nvta(farraxm nt0openioctyd mDeanvs;u0teermfctytlmtr ues;s srumimpoo1amtnmnes ()arra( p;t4apenmf3tadlmDra(mo;t0trtriocoytfat  u s t0texm(m3io4omenlivt t) Dtr(r nt1tpen oetlsfm eauvp t) exnxfcta1fmD au s s0trtrim3oo1llee ivias sDua(  ou4opxoiociatfsDeaumon()artnxrciatlmDeai o;t)s2xrxopnudoptnmfcias  ruaxr ;t0oet mfetldfs2el(vpn(0aexoxfcoadfm eau i t  rtrir3oodolenmnet ( aDrm(rpoo1texoiietaslm elnmp;(0trtomfciadlatr ueils0trur(mpoodll e nvi t)a2um(mooo4apt ii3iys a2umn s u)trtnxo3iytomt li i;( teumxr oudlmt lneia(faDta(mpou1olt ifcilsfaDranvs;()alenmocoo1om rlu sls0t2xrir nydamee fesas sDtm(mo;o4alx moeiad mDumnmo (0alerioctytfpt  ivils s2xoxopio4altnmfctlt) rrmxmp;u1tee iociadfm2ranvont4tltrmf3tadlp e nvsl(0t2uoirpnudoptemicsat s2um( pot1tpeomociat aDrmnvs (0 exrxocoydfm  livi t0t2ur(mpoydllee fvtatfs2raxmpoo4opx  ictaslaDemu o;(0texnxf3iydlp rlnvsls) 2xoimpoo4am  lnvias aDtax  ot0oet mictld a2ra( p;(4teeomr oatopt  uesls t2xrxmpoo1lm emfvias)srururo;t0tet  oetytlaDrmump t0 etriociydlatranvs;s  rtoiopiu4lp emici (faDtr( p;u1tex iocild a rl(ms u0aeenio ty1fp rlivi s) 2uoxr3iudlmen ivi s) Dra(m ou4aexnifeiadfs elnmo t4 lxoirciatlmDrlneils  2ur(m3iudolee ncsls)s2tru  no4tpxoiieildfsDumn on(0alxoxociodomDr i i s0teuoxr3iu1optn fctltfa2trxroou0ole  i3tlsls rmuvpn(4areomo3oo1lm   nes;( srtmxrpoy4lptnmnvi s  rtr(  ot0tpt ioetytfm2ranvsnt4trtomr iodfaDe uvsl(0t2xoxr no1opee nesl( s2rrxmpno1open ociyslaDuauvsnu)tetnmfcia1fmDeluesls) rxmxr3no1lleeliet tfarrru  ou1tlen o3iydfm emnvo t4tlxnif3iydopteau il(0t2xoxm3nydape  feils aDrr(r nu0tpeomieilt m2um( o;()altnxo3oo1fp r n ols)srumxm iydlm emfvil()srtr(m oo1ape  ieiys mDra(monu0 lxnmo iatfp rluvi s s2xrirpnu1amtelicsl(  2rau  ;o4alen o3ias m2umu o;t0 etnmo oy1fa e n olt s2xm(o oo1oltemivtasf rrm(m nu4apeo f3iys a um( s t0artnmf3tydla elu i;s)sexmxr nydopt lneiatfsrurxrpou0aleomi3iaslmDuanmo;()teeomociotopDe ivi t0sexm(o nu1altn nctat)a2tmumo;t4olxo feilsfmDea( onu0texrifcio1fmDe ueol()teurxm3no4lp elneiltfarum( p;t1aee mfeilslm umnvont)texnifcoa1fmDeli ilt0seumxm3oo4amenmfcias  2ra( pnt0opx ii3tytls2uan s (0tetoxo tadlp  lieo s  2toxopou4apenmict s) rrmx  ;u1aee ii3iyd sDemn on(4 rxoif3oa1om   neo;t0sexrxo oudom e fvtls  2ur(mo;o0aet io3iasfmDuanvs;t0 lerxr3ootop  lu ol(  2urxmpiu4lmenlfvi (fsDrm(r no4oeeomo3tltfmDemump t4arerxf3oy1oa e nes;t s2ur(r iu4ame liet s)sDum(monu1alt  feiatlmDum(mpnt0 eenir iotla eli i s0setr(o nodapenlfvt ()aDur(rp;u4aexn iciatfsDemumsnt)artnxr3ty1fmDelivilt) etoiopoy4lpenlivsl(f rtrur no1oeen ietatlsDul(vs;u0 exnio3oy1late u i;s0t2um(opiy1al nlncsat  rua( onu0opeo o3tls mDuan p;()tetnio todopDraiei s0 2xoxo3iy1oltn fesas)s2tm(mpnt4tetoif3iysfmDumn p t4arxrxo3tydoa  livils)s2xo(r3nu4op   ncsls)aruaxmoot0tpen i3iydls uln p (0tlxrir3oa1opt  nvsls0 rxmxm ou4amt miesl( srtm(m nu0aee  fciatfsDrm( p (0trenmr3tadfat  uvs;(  rtrxr3iu1llt  icslsf 2umxro;o0olt mo3iltfa um( o (0trxoio3todfmtr n olt)srxoxr ou1omtelnetat aruau  ;o4tlx  f3tad m ranmp;()arxrxo3ty1fat ln olt0t2uoirpiu1op elfetls) rtrxrp;o1olxnif3iyslsDrl(mo (0aleoir3to1oatrlivo;( t2xm(mpnu4lme lfcta(f 2rrx  ;o0oeeo ocilslm2umnvo;()tltrxrcta1faD  ieols)t2toxo3iydop e nesl(fartmxr oo1tpxo f3ildla ea(von(0trxoir iatopDe neo s0t2tm(m3nodomt mfvt s s2tr(r ou4opto i3iysfsDean pn(0 lenmf iy1fmtran s;s)trtoir iu1lpt  netas aDuau pot1texomf3iltlm rl( o;t)tltrxocoy1lptrli il(0trurirpnudlptnlivilt) Dtr(  nu4openioeiytlm2um( on(4alenxocia1op  aivi;t) 2xrxr3no1oltelnei t) Dtru oot4aet  fctadfm2rl(ms (0tltrmfciatfp elieol(0s2xoxo3oodapeemnvsls)sDrm(rp;t0aptniictld sDrau p;t4artoif todlaDrlneo s0srxrio3nu4optn fet s srrmu ooo4olx  o3tys s rmumo (0teeoirctatopt livs () eurimpnodlmtelfctlsfsrta( pou0olenif3tld m emn o (0 exrir tadfp e n o t0trxrirpnudll  mies s)artmxrono0oeenmfcilsfa ean s ()tltrmr3oodlm eanvs s)sruo(r iu1am   ictltf rrr(mpnt4alxo ieilt a umnms u0tetrxf iytfp ranvs t s2uo(o nu1lpenmfes ( a2umxmo;t4tptnifctasla emnms t0 lenxrcootlpDrlnes;t  rtrxo3iydomeelnes sfaDua(  ;t4olx  feiyt sDeaumonu4areoxf3iy1fpt  i ols0srumim3oydopt  ieias  2urxrpou4aeenmo3iysfsDrluvp;t4tetnxf3iy1fa rau s t  exm(opnu1om e ivi t)srumxmo;o0alxnmictltla elnmpn(0arxrmo3oo1fa rluvs;s  rtoimpoy4ole livils)artax o;o0alt mo3iadlsDeau s;t4arxnmr3oadoatrauei (0 rxr(r iy1apeemfeslt sDrm(mpoo4aeeniieilslm2ua( s t4aetrir oy1lmDranvi;s) 2tm(rpoo4lm elfvtl( a2raurpot1tlt if3tltlm emn s t0 lenio3oatfpte n sls t2trio3oydop  livsa(  Drm(mo;o4apt ioetyslm2raumsn(4arxnio3tytfpDr uvi;( srxmxo io4ale lnvta(fa2rru poo1tlenio3iatlsDra( snt0aeenmo3oatfaDrlnvi ( s2toxmpoy1lmt  fvtasf 2rrxm ot1oet iicilsls em( o;(0 eerio io1lmteauvs (0seuoir no4alt  fci t) rur(ro;o1aexn ieiysls umn ont4 rxnifciadfmD anvol(0s2uoio oo1om emivta( arra(  ;u4tetnmo3iatfm ran s t4arenxocto1fate nvo t)teto(o iu4lleelnvt tfsDrmx  ou4tptnifctyslmDelnmo t4altniocoydlpt  n il( t2xm(m3oy4ll n ivtat) Drr(rp;u4tlxo ieild s2ean ont)aeeoxr oodoaDelu s;s)t2umxm no4lmen nvilt)aDtmxmo;o4aetnmoeildlm rl( s;u0trxoxr oadfmDe ieil() rxo(mpoy4opt lfesls a2ua(mp;t1oetnmoetasfaDelumon(0aeeomr tydfmt luei;s)sexoirpoodapt mnvsl()a2ur( onu1texoifcias mDuan s t0 lxnxrctytlpt aneo;( truriopoo4am nmicslt) rtrump;o1tex  f3iadfs elnmo;t)arenxrcoodomtr ies;s0teur(r iy4oltelfesls)sDrm(r ou1aetnioctyslaDulums t)trxnxr3ta1fatelues;s0teum(mpou1omt lnct (fs2tm(ro;o4teeomoetydlmDuan pn() ltrxo3ia1fpDrlivsl( trur(o iudlmtnmnvt t) rtm(mo;t4tetn o3iys s uauvo;t4tlenmr3iy1laDelneo s0trum(o no4ole livt (  rumumpnu4aptomociatlm2umnmp (0aeenir oytfmtelu i;t teuriopou4apenmfvsas a2tr(m ot0apxnifcildfmDumnmp;t0aleniocio1lmDraueo;(0s2toim3nydll  lfvs tf rumur nu1ope ifcias a rmuvp u) lenxfciodoptrauvs;() exmio3iu1omee ncsls srraxr oo4openifetysla2rm(von()tltrircty1oa   ieo s  exrxrpiodap   fvias) 2ua( pno0alenmictas sDumnmpnu4 lermr iy1lp rluei t s2trxo3ny1ameelfeils  Dua(ro;u1apxnmoetlsfm2ea(msnu0 lxnxr oadfptrlies t s2toirpio1amte fcias  Dtrxr nu1opeo ociat aDrl(mo t0areomo iy1om  auvil(  exrxr iydlptnmivt sf rua(ro;t4oltomfciydlaDrl(mp u4alxrmociytlmt auvi s0 rto(rpnudopeemnesas)srrrxrp;t1olxnmocilsfsDuanvo;t4aexrmf3io1omD liesl( sexm(mpio4lm nlncsltfsDra(monu4tpenmociasfs ea(ms;t4altnmf3to1oaDeaiei;( trtr(m nudal nmiciatf 2tmu pou0aexo ieiatlm2rmn snt4arxnio ia1fatelu ils0truo(opno4amt mfesatfsDumxmpno1tpx  f3ilt a rl(vs ()tetrir3tadoa eai olt srxo(opio4amt livta()sDrrxm ;u1tex  fetadfaDrl(vs;u)tlxoxr3oytlp raies s  exo(r3iy1lleelnvi s arrmur nu1tleo f3ilslaDuan pnu4tltnif ty1lateli olt)t2uoirpio1olenlfei t aDua(m oo4aex  o3tyd m rmuvs t0tleoxr3tatlp rauei;s) rtrir3iydllt  nvt t  2rmumo;t4oleoifctatla ua(mo t0 lenirciytfmDe iei;s)srtmio3iy1alenmivtlsf 2rau ooo4tex io3tad s2rmu s;(0 lxrio iy1lmDe uvols s2uoxr3nydaptelietat a2ur(  ot1tptomi3tadfsDrlu s;(4trermf3oytlp elnes t seuoim3oodlpee fesl( aDum(rp;u0ale mfcildlsDul(vp (0tleoio3tytfa rai sl()t2tr(m iu1altelieiasfs2uax ono1tptnmiciadfaDrauvp;u)aleomr tatop ranvi;s) rxm(o3oudlltnmivs tfsrumx ooo0texoiietlsfs ul(von(0trenio ootoat anei s tetm(o oo4am elfctl(fsDtax pnt4optnioeiys aDrau pnu4texoif3tydlpte iei t0 eurxopnu1llee ivs tf 2raxront4optnif3tlt m2ulu snt0aleoxr3totfm ranvs;(  2urxo3oodlptnmneiasfarraurp;o4openmoctysfm2rmuvs;(0altnmfctodom e uvi;( srtm(opno4lmtnlnvil()a2uaxront4aetnif3tlsfaDul(vp u)tlxnmocoodlm ranes;t)teurimpno4lmtelfes () rrmxroot1tex mfciadlaDrlnms u4aeenmo oo1oa rlu s;t0 2trxr io4omtnlnci t)a2tmxmoot0aetnifctatfsDelu on(4 rxomo3oa1latrau o s) rxoir3ny1llteliesa(f 2ta( oou0tpenmociasfsDeau p t4 rtrxo3iytfmteanvs;t setriopiydlmeemfvslt s2tmuronu1oetnmociadlsDeanvs u4teenxf3ootfpD liesl(0t2trxr3oo4amtnlnes tf Dtrxr ;u0aee mi3iys s2rm(von()trxrio oadfm elnes;()sexoxo oudomtnmnvta( aDuaum ;o4oee mictadla eln o u) ltnxocoodfm rlueo t  exr(r3iodap n fvs ()s2rmum ou1alx  o3tyt m uln o t4tetrxrctodop  aivs;t trumio ou4optnmnetlt sruax pot4tex mf3iytls eluvs;u0 renmr iatopt ln il(0 rtr(r3iu1amen fvi ( s2tmur nt0tlxn oetytlaDranvo;u) lxoio io1fa e neo;t)tetoxo iydopte fctl( s2urumo;t0aee mi3tlsfaDrluvp (0trxoxf3oydopt lueols0 eto(o3oo1ll   nvsa(fs2urum nu1olto fciasls2ea(ms t0 lxriocoy1om   ivs s trtmxrpny4amt  feslsfartr(mo;t1apen ocils sDulumon()texrmrcoytla ran s t0srxrio3nudlltnmivias srrmu ooo4oet ifeilt a rmump u4aexrif3oodomDrlivo t0setrxm iydaleelfcsl( a2rau pou4tptoifciys m ea(vonu)tlxnxo ta1optr nvs t  rtmir oy1amtnlnesl()artruronu0tptoifeiydfsDulums t0alxrirciy1opDe nvs s) eto(o3nu4lltn fviltf 2ta( oot4oex moetysfm2rluvo ()artoxr3todlmt  i o t0 etr(r iu1opt lfei sf 2rru oou4olxnio3tadlsDeln p u4 etnmfctytfpDr i ils0 rtm(r3no4lle lietat) rrmx ooo0olx ifetlt m umumo t) rtoxfctydop  au olt) rtrxm oy1lp elfet ()s2tmxmpnu4tpen i3ilt m el(mp;()aexnxf3io1oaD  ivo;t0 rtm(o iudolte ictlsfs2ra(mo;u4tetniieiytfm rlnvsnu0 lxrmfcoodfa  lu i;s  etoirpnodlmtemfeiasfartaum nu0olt iieils mDrm( p t4 renmfciotom e ues t trxr(r nodlptn nes t) rrrxmoou1optomi3iasfm2elnvpnt)texnmf3oodfpD  nvs s)s2tr(opnudlp elfci s  Durxm nu0tpe  i3ils s2ul( pnu) lenxrctadoa  lies;s seum(opiodop nmivs ()aDtrumono1oetn ieildlmDrlums u4trenxo io1fpD ai sl( srxr(r oy1ape  feiat) Dtm(ro;t1olen oeiltlaDuln p;u)trenxo3oatlmt lnvi;t)seumimpoodaptelicil( s2tmx ono4ope moeiydfaDul(mo t4tltrxrcootfat lueil(  rurirpiydlptn fvi sfaDtaxrp;o0tleo f3iad s2emumo;() rtoxoctytfm raivs;s) eurxm nu1optelnct s) 2ururp;o0tle ii3iad s umuvsnu) rxomf totlmD anesls0 rxoir oydaptnmfvi () Drmu ooo4tlx mf3ilsfa2em(vpn(4aexrmf3ta1fa  lneo;t)s2xrxm oodome lnvtl(fa2ta(m nu0oeenmoeiyslm2rl(mpnu4arermf3oatlp  au s s seuoxm iy1apte nvsas  2ur(monu1olenmiciysfm2uaumpn(0 ltoir ootlp rliei;s0s2urxrpoodoleelneils a2rax pnu0opx mfcilsfaDean o;t) lxnxo oadopte nvi t)s2tmxm ny4olee ivsl(  2rr(mp;o0apen ieiyt s2eau o u)trxoir3tydlat  ues;() etoiopnudom emncsat srurx p;t1opeoio3tas a2rlnvp;u0 reniocoa1om e uvs;()texoirpoy4aptelfvtls) 2umxro;o0tle ifciatla umu s (4aetnmocoydla rli i t0srtrio3nudlm e nvsls) Dtru pot0oex io3iytfa uau snu4 rtnmociatfptraieslt) 2xmxo iydom nlnvil()arrr(mo;t1opx  o3iatfsDem(mo;t0 lerircootlmt  ieo;s srurxopou1ameemnctlsfs2uaumpno4apeoioetasfsDulumpn() ltnirciadlpt anvolt)setrxm3iu4lp emfvtat sDrrxrpnu1alen fciatlsDelnvo t0tlxnir3oa1opteln o t)trxriopno1ll nlncsls)srtau ono1tet  octaslmDrl(vsnt4 exoxr tatfpt  n s s0 euoxm3oo4amt  fetlsf 2uaumoot1tet ii3iatfaDelu o u4aeerir ia1om e u i;t)tetmim3iy4lpeelnvtat s2taxmoot1oex moetytfm2rlnms;()tlerif oy1lpDrlivs t0 eto(mpoo1lle  feta(fsruaum ;u1oetnmfetldfm ul(vs (4texoifctadfa rln s;(0setoxm nu1lpenmiet t artrur nt1aexomieilsfs2ulnms u0aeenmo oy1laD lu o;()t2umim nu4lp  mivta( aDrr(rpnu1tlxnif3iatfs umumpn(4tltrir3ootlmD lu o s0trtrxo io1lm emieiasf Drr(r no1teeomf3tlt s uan s t0tlenxo3todlat lnvi (0 etrxo oo1amee fvilt)s2taurpoo1tleo oetltfm uln o u4 etoirciadomDranes t0t2tm(opiu4alt  ieilt  rum( pou1tpeomiciytlm2uln on() rtnir oo1lmtelnei s)trum(m oudapteliciat sDrr(m oo4tpeomfctad a2ea(vsn(4 exoxrcoa1fmteanesls) eumio oodom  mfvtlsfarta(r oo1open o3iasfm umuvpnu4tltrio3iy1la eauei (  2umxm3oy4ll  mncs () Dumxr ou0apx mieildfa2uluvp u0alxoxfciatoa  au s;( trtrim3oudapt livtasf 2taump;o4optn octyt sDul(mpnt0aexrxfcoatoptrlieils0teuoim3ny4al   fcs t artaurp;t1tet  i3iadfsDeln p;u4tetnxociydoate uvolt tetmiopoydlp e fesat a2tmuronu1oleo oetldlmDem( pn()tltoio tadlm eli o (0s2umxr3io1lp e feiasf rua(roou1tpeo fctyd m2uauvo;(4 eenif oytlmDeaueil()sexmxm nu1ll e ieiltf rrau  no1altomietltls2ranmpn(4texniocto1oaDeauvslt)sexoxm iu4apt  iesatfs2rrumonu4ole  iciltla2eanmp;u)trtomfctotopD livi t0trur(r3io1oltemivsl(  2taxro;o4apxnifctydfsDemu s;u0 etnif tytlmtrlnvs;t srxrxr3nu4ameelncsl()aDrmu ont0oet  i3iltla2um( o u4trenxf3oy1fmtrauei;t srtmxopnu1omtnlivia(  rtrxrpoo1oee mf3tat sDrau s;()aexomf3oy1oaDrli o s  exmio3io1omeemnetls)a2trxmooo1tptoiocilslm2umn o;(0aetniociatfp  ln s (0 2xoirpoudlmee icsat a2uaumpnu1tlxnii3iltfs rm(mp;(0 ltrmo3iadomtr i o (0 etmiopiu1amt lncil( arra(m nu0aet miciyslaDrm(mo u4tlerxf tytfptelnvol( s2ur(o3oy1olen fvils)arrrxrooo0alx ii3iytlaDeauvs ()tltrmo3oatlmt aieil()t2to(rpny4ap elivt tfsrumu p;t4oee mi3iyd s rau on() rermfctydfatr ies s trxm(opoo1lp nmiesasfarur(mpot0tpxoifeiatfaDeau p t)tltnxr3tatlateaues s texmxm ou4lltnlnesatf Draxmonu1opeoii3ildla rmuvp;t4aetoio iytlmD  ieo s) rtrio oy1ap nlnvta() 2rmxroot0teeoioctytfa ran o (0 reomo3tatfaDrauvol() rtoio3ou1al  lfeta()aDtr( oou0apxnmfciltfa eaump;u0 ltomr iodfa e neol( s2urim oy4alt  fvias)srtm(r nu1aleo o3tysfa rau p;(4altrio tydlmt  nei s0srxrio oudap emivta()srtrx  ;o0tetomo3tasls rmumpn()tltoiociodom eaiei t0texrxo iodamt liciasf 2rrxmp;t4oeeo i3iytfa el(ms;t)aleomf3oadlat lnvo (0trtoxrpiy1op n fctlsf Dumxm ;t0apx  ociad a2rlu p;() exomo3to1opDr n sl()sexmim oy4lltelnvs ( s2trx p;o0optn o3tysfaDeaumont0tetnxo3iydoa elieils srxmir3ou4opte netas)srtm( p;t0alxnii3tasfa2um(vpn()altrxfctodomDelnes s sruoxr iodllteliei s)srraurooo1aexn ieiyt m rmums ()arerxf oydlpt  i i t texo(opou1lpe  netls) Drrurp;u1tlx moetatlsDra(mo u)tlxrif iytla   n i s  ruoim3iodlpeemncilsfs2rr(mooo0ole io3tysfsDumn onu) exrifcoydlpt  ieol(  euoxr nudalte fei ()sDraxronu4texomoeiltlm emnmpnt4arxnxr3todfm rlnesls t2umim oodlltn ivtat) Durxmont1oexnmociys s umu o;u4aetrir3oadopteaueolt0srtrxm3no1om  lneiasf 2rax  nt0tpx  o3tyd aDrmnvp;t4 eerif3tydlmD  nvi;t) 2xoirpiu1opeelieil( s2rmump;o4tlx  fetlsfs2rmuvo (4alxnmf iodoaD anvols t2um(o3ny4am emncslt) rrau o;o0aexnmfeiys m2uau p u4trerxf oa1omt lues (0sexoim nodaltnlics t)aDuaumpnu1olto o3ilslaDrmnvo ()aexoxo to1fpD luvo t teumxopiudll  lietl() Drm(m no1oltn i3tldfm umnms;()aetoiocoadlaDran s;t0seuoio3io4opeemicsa( arum( o;u4opeo fetas s rl(msnu0teeoif oy1oateluvilt)trxrim3nodome lfvsatfa2tax p;t0opeo ocilslaDelnvp (4tltrxocoadlatrlnvs t)seto(r iu4olt  neiat)aDum(r nt1tpxn ietlt s em(mpn(4trtoif oatlp  li i t0 rxoxr3oy1ale  icta(fa2ururpno4ale  i3tys a rl(vo (0trxomf3tadlmtrliei;s seumir iydlptnmivsl() 2urur ;t0opeoiocild s2uan pnt0aeeoif todla r uei s0setrxmpno1ol n nesat)sruaxroou0tpxoiociadlaDrlnmo;() eenif3iydlate ieo;(  2trio3iodll emfei s aDurumooo0tle mo3tadls uan pn(0texomr3tatlp elu o ( trtoimpny1al n fvt s artm(moou1tlt  fctlsla2umu p;(4 reomf3tatomD aneols0srxm(opoy1lltn ncilsfsrumx oou1tlto ieiys m2rlnms t)altoir iotla  livo ()srtmio iodope lncia()s2ua(m nu0aet iietatfmDrauvs;u0 reoxr3tydlpte uvs t)teuoxo oy4ol n fvi (fartrxr no4opxnifctltlm ranmp t)tltniocoatom rlu o;s setoimpiydame mfctlt) 2ur(rooo1altomociysla2em(mo;u4artnmf3ty1opDraneils  ruoiopny1ome lietl(f rrau oot0tleo f3iltfs2ua(ms;t0 eenirctytfaDelu s s)trxr(r3iy1ame mivsl()s2rm(mono4aexnifeiad s2ean p;(4 lerxo io1oatelnei;( sexrxr nodape mfvt (fsDtm( poo0tex ioetydfaDea( o t4altomr oy1fmDe n o;t0sexoxr iu1llte ivi (  rrmxm ;u4ole  o3iyt sDrmumo;u0tlermo iydlpDeanvolt0 2trxopny1ap e fvtlsfarrmx o;o1teenii3ildfsDel(mo;t0aexomr iotfmtrai ols  exmxo io1omt lnesasfsDtru pnu4aeeoifcilt s2umu snu0 lxoir3ia1optrlnvolt srtoir iydameemies t aDrrumpoo4aet  ieiyd m2umuvsnu0arerif iy1la   ivo;s)sruo(m3oydamtnmnei ()aruaxrpnu1oltnii3iysla2ra(ms;t0 lenio iodfpteau s;( seuo(o no4lltnlivtatf 2um(rpno4tex moeiytla rmnvon()alxnxr3to1la elivi;()srtoiopoo4alteliet (fa2rm(ro;u4tlen i3iad s emnvs;u4 renmociatfpteluesls0 etrxrpoo4alen ivsas)aDuru  no4tle io3iadlsDulnmo;u0teerifcoadlmtrluvo;t t2uoxr3iu1llt  ictatfaDuax  ot4tpe mieild aDuan pn() etnxf3oo1oaDrlueols0s2xm(r3no1lpte fes tfaDuaur oo4tpx  ieiatlm2ulu snt0aetnif3ootfm  lues t)t2tr(r3ny4olt  ncta( s2ra(moou1oetoioetas a2rlnvo;u4tlxnif tytlaDeauei;s  rtm(o3nydlle mnctl(fa2um(m ou1tpe iieias aDua(mpnt0 ltnxf totfm   nes;t) rxmim nu1ole mfei s)aDrmxmooo1olt mictat s eanmo u0aetrir3ia1lmDelneslt seuoio ny1lmen ietls)s2umx pnu4olx mfciytlmDran o;u)tltnmr tytfm elieo t) rtmim3oy1alt lnetat)aruau oou4tlt io3iatfm2rlu s;u)aeerio iydfpteli ol(  rxm(r3oodapte fet t)s2taxmpnt4aleo ictasfmDrmu pnu4trenxrciatfaD  uvo;()trto(m oy1oltemnci t)srtm(mono4tpe mf3iltlm2ean p;()trxrxr ta1oat  ivol( s2xo(r nu1lmtn fvia( s2ta(r nu4opeomi3tas s rl(mo ()alenmocootopDrauvo;() rum(r3nodop  lfvt ( a2uax  nt1aexoif3tysfmDumn o t) rtniocootlaD  uvi;(  2umiopiydlp elnviat) rrrumpoo0tleoioctld s2ran snt) etoirctotfmDeanvs;t0 rxoim3iudlme liesl( a2tmurp;o1tlto oeiydfs ea( p u0 rxoxr iytoa eau s t0seurxo3ou1altelfesa( artm( pou4olenioeiytlaDumu o u0areoxrcio1lpt  nei;(0srurio nu1ale  nvils) 2raxr oo1tlenmo3iadfa2ul(ms () ltnxr3io1oatrau o s0trtmir iu1lpeemivtasf 2rm(mp;o0tltoio3tytfmDrmu sn(0areomf3oytop r n s;t)sruoxm ou4lp e fes ( a2rru poo1oeenii3iydfa rm(mo u4 rxrxfcto1laD  nvs;(  rtmimpiodolte nvsls)s2ur(  ot1tet mi3iadfa ra(mo;()treoxociydlm eauvs s srtrxopoy4altelfeils)s2taumoou1olen i3iasfm2ea(vo u0arxnmf3iy1om e uesls)trxm(r3no1lm elnvsas)a2trumoou4tpenmoetld s2uln s;t)alxoxfcoadfp   i ilt texrirpoudameemfci t) Duru  no1alxnmi3tydlm rm(vo (4altoiocoodfmDeaneo s) 2tmim3iy1open fcil(  ruru o;o4aet  fctad mDrlums (4altrmr3oadlpDe n o;()srxmio iydlleelivi s)aDrmumono0tetomo3iytfa2el(ms;(0arxnmociydlaDrauvo s)tetr(rpiydape  ies t  2tm(mo;u1olen i3iytla ranvsnu)tlxrxo3ta1om  luvs t0 2xmim3iy4llte fei t)aDrr( oou0apx ii3ias sDrm(vp;u0tlerifcoo1lmDrlueol(0srtr(m3iydapenmnvi s) 2umur ;u0olt mfcils a eaump;(4aexrmf3totfmt  ivils tetmirpiy4alenlies tf 2uau pou1oetniieilsfsDrmnmpnt)trtomo tytom eai s;() rtmim nu1lmeelnvt sfaDtrxro;o1opxo f3iysfs2umnvo;(0aeenif3oo1latr ies (0texr(o3ny4ole livsasfsrta(mo;o0tlx mf3iysfa2emuvo;(4 rxnxo3tatop  anes;s)sexrirpoudape  netlsfsrtrxmpoo0tet mociadlm rmuvs;()tltomo oytfpD lu o;s)teto(opio1oltn ncsl()aDtax p;o4openmi3iatlaDuluvo (0 leoifcoo1lpDeauvsls)srxo(o3ny1opt  feil(  2rm(moou1teeoif3iltfaDel(ms u)aleomf3iytlpD ln s;t) etrxrpiudom nlfcil(fs2ua(  ot4tlx moetat mDrmu p;t4tlenmo3tadlpD ai s;t)texoim3io1lmen ivi s  2umxmoou0olxn o3ilt sDelu pnt)altrmf3ty1fp elu o ()teuoxr iydlptnlicils  2ur( oou1tlenifetadfm2rln snu0tetnmociotoa rlies;s)s2xoim3io4amtnlnetl()sDumxm ;u4apt  o3tatlm2umnmsn(4 eermfcoa1lm ran s;()trxrio3iudlle  fvils)aDtax  ;u1alto o3iadla2emnvp;(4tlxnmociydlptrlnvs s  eumxopoy1al n fvi (f rtrx ooo4tpenii3tls a2umn on(4arxoxf3iodom raies;()texo(o iodlltnmnvtlt sDua(r ;o1oet ioetld a um(ms t4 leoif3to1lm elnvo;()t2tmxm no1lmtn nctltf Dur(m nt1tltn fciatls2ranms;(0treoxf totlpt aueo;( srtoio3iy4ll  lfes ()a2ur(moou1tee ifctadla2ul(mo ()tleoxo iytom eai olt teurio no1oltelneilsfa2trxr ;t0aexomictltls2eanvo t0tlerio todlpteaiei ()texo(opiu4alt mfvs s  Dur(moot1apenif3tas a2rauvo;u0 exomfcto1opte n s t trurxr oodlp nmivia(fsDta(  nt1oet if3tld a2ulnvpn()alerxf todlp  aneo t0seurim no1optelfet sf 2uaumo;u0oexnifcias m2rlnvs;u)alxnxf3iy1oaD  neolt srur(opiodllenmiviasfaDraxmono0apt miciyslm2ea(mo;u)altrmo ty1laD  ivsl()s2urimpnodlm   icil()s2umu ont1ope  i3iadfsDelnvo;t0texrxf3ia1laD au s t0sexrxm ou4lleemnci s)sDraxmoot4tex mociltfaDrau p (0texnif ia1oaD luei;t0t2triopiu1ol e iei t) rta( oot4tlxomoctatls2ul( o ()trtnmr oy1oaDrauei t)s2uoxm oydape lfes ( aDumu  ou0openmfeiytfaDua(vp u0 eerio iadfmDelnvo;t0s2tr(m oy4olt mnviltf ruax  no1tptoifcilt mDeau p ()tltnmo3ta1oat  uesls0s2xo(rpiodalee icilsfaDrm(m oo0aexn feils a rlu o;(4tlxomo oatlmDeaies;s0t2tmxr3iodol  lfes (fs2umx  no1opxo ietadlm2ulnvs;(4aetrir3oo1faDeln o s) 2trxm3nudomtn nvi s  2rruroou1olenmieilt a raump t0aetrmr oa1oaDrlnvi;t0trxoio3nudom nmfcsl()aruaurpou4texn i3ildfa ea( o (4aetoifcoo1omte n o;( trxoxr3iy4amtn ictatfs2trxmonu0tptn feias mDrm(ms t4arermf oo1op  an o s seurio3oodlpe mnctlt s2umxmo;t4olxnmoeilslmDum( p;(0 renmocta1oate i ols  eumir3oy4lp emivtlt sDuaur ot4ale moetatla ea(vs;u4aexnifcootlaDr ieil( trum(m nydlmen ietls arrax o;t0altnmi3iytlsDuau p;(0artnxo io1omt livs ( seto(r oydalee feia(  rtmx o;t1olxnmi3iydlm2rm(vsnt4 etnxr3oodfpDr uei;s)s2xm(o oo1alenmiesl(  Draxrpou4oeeo i3iltlm2uanvon() exnmr oa1omt li olt0 eto(m nydlleemneslsfaDtax  ou0oltomictasfaDeau o;()alxoir tadopDr ueo;s0texoir oy4om e ivi s) Dra(rpou1opt ii3tydls2el( p;()alenmr iytlatrlivi t sexrio3iu1oleelictas) 2raum ;o1opeo oeiyt a ranmsn(4aexnif tadoaDeaneolt) rtrim iydal  mnet tf 2uau p;u4oex  ietltla uln ont4tetrmr3ia1fmtrln i t)s2uoxopnodom emncsa(fsrtmxm ;t1apeoiictyt a2elums;u)trtrircty1laDeln i s)s2xoir oodopenmivsls  rumxr ;o4tetomiciaslsDrlnmsnt) etnmf iodla  anvs;t)s2ur(o oudolenmfeil( aDrmuro;t4aet miciysfm ua(msnt)alxoxfctatla e neo;(0t2xrxopnudolenlfes s)s2rru onu4texn iciyd a2rm( o;() lxoxrctotlm eaiei;s0trxoxm3oudom   fei t)sDrmxm ;t1ale  fetysfa rl(vonu4aetomrcoydlmDr u s t srurxo3nodom  lnvia(faDumxm ;o4apxn i3iatfsDum(vs u4tlxrmoctatlp  lnvo (  rumim iu1openmiciatfa2uaxrono4texoifctlsfm ulump t0altomr3tydoaDrlueo t0srurim oudop elfviasfa2taxmo;t1tpx ii3iat a2rlu p;u4tlenxf ia1lmtrlnvsls)srur(o oodopen neiasfaDrru  ot4aleo o3iasfm2el(ms;t4 exnxr3ty1laDeli i t tetmxopnodamt mnesa(faDuaur ou0tlt  ietaslaDuanmo (4 exoif tydfpt  i ols tetrim3nodomenmfvilt)srrmxmo;u4aeen feilt s2emu s ()teenxo3oadfp elneo (0srxr(mpoo1omtn ict sfs2rrxrpnt1oex  i3ild m2ul(vsnt0 rxnir3ia1oatraneo;s seur(o ny4ap nlfvt s)s2tau ont1olt if3ilsfm2rmu on(4tleoxf3oytlp   neilt) etoiopnodalenmfvias arrrur ;o4oleoioeiyslsDrm(mpn() exomoctodlp   n olt)s2urxrpnu4optelncslt)a2rr(  nu4tpe  feiatlsDumn o () etrmfciodfmDe uvs;t s2xrxr iu4lm nmfesls  rtmurpot0open iciytla eauvpn(0 ltrxoctydlmD lu s s0trurio nydap  lfvt sfsDrrurpno4apenii3tatfm el(mp t4 rxrifcoa1lpD an ils) rurxm3no4om   ivsas)srumxm nt1oeto fetlsfmDrlu s (4aexnxf ia1opt  ivi;s  rto(m3ny1al elivi tf 2tr( pnt4alto ociadfa2ea(ms;() etrxociydlmtelnvs (0s2uoirpou4op  mfvsasfartr(r nt1opxoioctadfm rau p ()tetnmf3totomt anvil(0 2uoxo3ny1apee net s) ruru  ;o0oet  oeias s emn on(4texnxo oy1lmtranvo ()srto(opiu4ap  lfci tfs2rm( ooo4tpxnmietyd aDrm(mo t)texrircoadfp r uvs s t2trxr iy1oleemfvtltfsrtmu o;o4alx if3ild a em(vp;u0tlxnxr3iytlmtrlieols0t2umio oy4omee ietlt  2ua(monu1oeeo feiysfa2rau s (4 exnir oo1lmtr neslt trur(opiudlmen ivs t s2rm(ront4ape mieiydls2ulump;()trerxo3ia1fmt  i i (0setoim nu4optnmiesa( srrax onu4altnmietydfsDrau o (4treomfcty1la  aivi (  euoxmpno4oltn ietl(fs2tm(mont1apxo i3iasfa elumont0 reoxrciytfp  aies () 2urxr nu4ol  lnes t arraurp;o0teeo fetldfa ea( s;()aetnif3oadlp eli s (  rumxr3iy1lmeelivta()srta(m ou1tpe mi3iydlm rm(mp;(4aetnifciydlpt aivsls0 etrxrpno4ap  miet t)arra(ro;u0teeo o3tldlm raums t0 eeoxrcoytlaDr nvs (  2xr(rpou1olen fvsls)srrrum ot4olxnmiciys sDrl(mpnt4arerifciadomt  ueilt) rxmio3oy1om elnet s s2umxm no1tleomi3iydla rmn snt4trxomf3oy1laDe uvols s2ur(o3iu4lpenlfvsas)a2tmumoou0tetomoctyslmDrmuvon(0aetnifcoodom eli s t) 2xmxm nu1amte fesls) 2rr( ono1oeeo f3tls aDum(vo t4altrxr3iytoate n sls texrxr3nodaltemncils a2rm(rono1alxomfeilsfaDeauvsnt4trtomo ootlatelu ols0s2trxopny4ol n fcia(faruaum ou0aet  ieiydfs ea(vo;u4tlerxoctatfp  anvils0s2xmxrpiy4ope  net tfsrua(rpou0alt mo3tadfsDrm(ms (4aetrir3oatlpteln o s sruoir3oo4lm  mnvs t s2umx o;t4ale  ictyd m umnvon(4 etrmo3iotlmt livilt0 etoxr3oodll  lnvtlt)s2tm(  nt4openmiciadfmDuan o t0trxnioctytoaD lnvi;()sexmxmpno1lpt mncsl(fs2rax  ou4apxoii3iys a umumsnu4artrxoctodlmte nei ()texm(r3nu4lpt lfvtlt)s2um(moot4aetomi3iysfa2ulu o;()aleomo iatop eaneo s  rum(r iu1lmtelneilsfsrua(mp;u4aet mictytlm emnvsnu0tltnmo oadlp rai olt0 etmim3iu4lmee ies t a2rax pnt1open o3iasfm2raumsnu) exniociy1fa raivslt0s2to(o oydop   fcta() rtrxrpot0aptoiictyd a2ean s;() etoir3ty1fp r n s s0 rtrio3oy1opee fct ()sDrmxroou0oeto iciys a uan s;t0arxrxfcia1faDeaneilt0srumim iu4lp e fei tf Dta( oou0opxnmocildfmDeauvs;t4tlxnir to1faDeauvslt)t2trir iydlp nlncia() rtaxrpno4tptnif3ildfa em( p;t)arxnmr todoaD aueilt)t2xoio oydap elfcs sf Dtau  no1opeoioeiydfsDuanmo (0 eenxr3oadlp   ieo t) exmim3iodaltemivsas)a2rm( pnu0aptn feiysfa uau on(0trxomocootom r iei;() rtm(m oy4apenlivia()sDrmx  ot0alenmfeiadla2ea( o u) eenxocoo1lmDr ivslt trtmio ny1llen fci sf Drmxm ot1tlxnmo3ias mDrlnmp;u4tlxnxo oytfa elu i;(0trur(o3oo1op nmiet (farumxmpou0apeo oeiad mDrmu s ()aeermr3ia1omt  uvil() 2umir3oo4lme livtltf 2rruro;u0tpx mociytls2rln o;t)texrmrcoodfat luvi;s)trtoxrpoodalee fesa( s2rmu pnt0tetnmi3ils sDem(vo;u4tlxoxr oodoaD au ol( tetr(r nu4lm nmnesa(fs2raxronu0tee  i3ild s2em( snu)aexrir3oo1lmDranes;t0 rumxm iu4amtnlivilt) 2uaump;o4apxoifeiatfs rln p ()aexnmo3ia1latrluvs s) etmxm oy4ale  ieil(fs2rru  ;o0apxoioctas s2umuvo (0 reomf3iydlpteauvo s teumir ou1ope  iet s sDraum ;u1tex  i3iadfa2raums u0aeeoir3oatfmDran s t  rxoxo3iydol n nctat)arurx pno0aleo oeiyt sDra(mo u0altomr ootlpteaivils)sruo(o nu1ap nmietas aDrau  nt4texo fetysls umu s;(0 rtrxo oa1fptrai o;() rtmxr3oo4ope lfcta( s2tr(  ot0oex ii3tas m rl(mpn(4alxrmrcty1lpD li slt  2trir3nu4optemfvsls a2rru  ;t1oltnioetys s2rm(ms;(0 lxrmr oydomDraiei;t)srurxo nu1lmen ics t)sDumxrono4alxo fetyd aDulumsnt4aexomo3tydfmte n i;s)srxm(mpou4al   ict t) Drrxmpou1aexo oetad a emu snu0 eeomfciadop eln s;()srxr(r nydoleemietat)aDum(rpoo1alt mocils m ul( pnt4trtoircoo1faDelnvi ()srtmxm3nydop e nci t)artaur ou4tetniiciadfmDel(vo t4trxoir oo1oatraneilt trtm(rpio1ol n fvsa(  Durx  ou4olxomieiat a2eanvonu)arxnxf iodoat ln i;(0 rxm(rpio4op n fcsa() Dum(m ;u0aleomociatlm eaums u4 ltoioctodfaD auei t) eto(m iodam elnvsatfarra( onu0tpx mociatfa2rlumsn(4aeenir ootopDranesls0texrir3nu1lmtemfvtasfa2rrxrpnu4apxo octlslmDrln sn(0teenxf3oadopt  nei t0srtoir oodll emivslt  rua(rooo4apeo f3iadlsDem(vs t0artrmf tydopD li o;t0 2xm(o nudameelnetlsfaDua( p;o4oetomf3ias s2uluvo t0arxoxo3oodopDr ivo;()srxmio3oo4alt  ivs sfsrta(mp;t4tlt  oetys a2uan p (0tetoxf3oydfa  lnei t) exmxm3oy4lmee nvs ()s2taxr ;t0alxnmoetadls emums;() etnxocoa1lmDeai olt)t2trimpiy1alte nvta(  2rau pnt4aexoiietyd a ranmp;(0 ltoxo3todlaDrlu s;s0t2um(r3oudomeelnvs s a2umx  oo1tltn i3iltfmDuauvs;() lxnmr oo1faDeauvo;s)t2xr(rpny4lpte nvtas sruru  no0olenmiciltfaDrlnvp;(4 rxrmr ty1om  lu slt0 exrio nu1ale  fcta(fsDtaxmpot1aptniiciytfsDrm( snt0tetrxo tytla   neo;t t2xmim ou4oltnmnet s arururo;u4alxnmfciyslmDra(vp;u4teenxf3oa1om e n i;t  rtoxopoo4lptn nes s aDtm(r ;t1tlxnio3tys s2rln p ()texrmr3iydlaDeaueilt sruo(r iydam  lfcta( sruax ont1aetoif3iasfmDrl(vsnu4alxrir iy1lpteaueilt) 2trirpnodlltnlietat s2rax  nt1alt mictlt sDemnvpnu) ltomrcoydfp r ueo;( t2umxopnodamtelneiltf Drr(mooo4opt  o3tad mDuan s;t0 etomr3todoat lnvil()seumimpiu1olt mivslt a2rmu  ou4aetnmictldls eluvsnt)teenmo3ty1lmDelueo s)t2urxm ny4lp elivtltfaDtm(  ;u4tpxn oeiltfa umnms;t)texnmociotfp rlueo;s)setmxopou1apt mfvs tf rumx  ou1oeenmf3tadls2el(vs ()tetomr oatomt lies (0s2xmir iu1omtn feiasfa2rrx  ;o1oltnmfeiatlm2rmnvo;t0tltnxocoytlateaueilt0trtmxmpiy1lpee fet t)s2uaxrono1tlx mfctytlaDuauvp;() eeomo oo1fmteaivi ( trxm(r no1amt mnvt t) rurx p;o0tpx mfciytfsDel( pnt0altnif3tatfm e uvol() ruoxo3no4lpe mncils)sDuaur ;u4opxo ictas sDuanvo;t) rxomocto1omD aieo s0t2umxopiu1ap  mfci ()aDur(mpnt0tpx mo3iytfs2uanvsn(0 ltrio ootom e ivo (0s2uo(mpiy4lp n iet s arururo;t0tptomfeias s ulumon(0texoxr oa1om rlnvs;s0srxrxo3iy4ll  lici s)sDtm(  ;o1aex if3iytfs2uan o;u)texrxfcoytoa e n sl() ruoxrpou4oltn fcsat)sDum(mono0ole  feils m2rl( p;u0arenifcoytlatelies t setm(rpiodalt lfctls arrm(rpnt4teeoio3ilslm uauvp t4aetnio3oo1fpteaueilt)teumxr3oodll nliesasfa2uaxm ;t4alenif3ias s emnvo u0aetnmo3io1oaD lieils0 rxrio3oo1lp   fct s)aDurxmoou0aexoioetytfa2em(vs;()trenxr3oadoa   nvi;() rtmxm3oo1om   fct sf Dtax  ;o4apxo feiys a2ranmp;t0aeenmr3oa1lateau s;s0 rxmxr iodopenmfcia()srtru o;u0oltomo3iasla uauvs;t) lxrmfcta1fm   ivolt) 2trxrpoudllt  fvtlt)aDuau o;o0oetoiieiat m uan snu4trtrxo todfmte nes t0setmxm3oo4lm  mfvsat  Dtr(  nt4apeoiietatlaDemuvsn()areomfciytfat anvs;() etm(m3oo1optn fvi t)srrmxmono0tpxoif3iytla2eanvs;() lerxoctotlmt  n ilt seuoxo ou4llt lnct ( a2tmur ot1aetn i3tatfsDran p t4arermf3totlpD  ieils) exr(opiudolen nctas) Dtruro;t1texo oetys aDraumsn()artoxr3tatlp rau o;(0setoir oo1aptnmnvilt)srrrx ont1tpeomiciadlm ua( p () rermrciy1lmtrlueo;(0 rxo(rpou1lle  fetltfa2taxm ;t0texoioeiatfm rm(mp t0treomf3iotfate nvs;()texr(o nodlpt liesat) rtmu o;t1tet ifetytfs2eanmp u4tlxnir3totlmtraivil()t2tm(o3iodlp   fesls) Dtau pnu1apxnioeiyslmDea(mp t0teenmoctotomD  neils  exoxrpoydap e iet s aDtaum oo0aptniieils s2emnvs (4tlerxo iodfpteauei s seurxmpnu1altnmfci tfa2um(  nu1tleoif3tasla rmu s t4aetrxoctotomt  iesl(0t2xrxm oodllt  ieiasfsDrr(  ;t0aeenmi3tadlm2um(ms (4 lxrmr iydoate ieil( t2umio3iu4ame licsls)srurxrp;u1aetn o3tas s2emuvonu) rtnxr iodopt anvo;t0setoio3nydlpenlfci (f 2taum nu1teenmi3iatfa ul(msn(0 lxrxfctadla eaivo;( texm(o3iu4ol e nvtat)aDumu ont0apxoio3iad mDelnmpnu4 lerio3oytomDranvil(0 rumxo ou1oleemnesltfsDurxr nu1oetn ieias sDemuvs;(0texnxf oy1op ranvi s0s2urxopoy4open ncsl(faDumurp;t1tpe ioetytfs eln o;t4artomociotom   u o;t trur(rpnudlle lfcsa() Dururp;o1opxnifctltls2umu o;u)tltnmfctadlmte ivilt0trumxm3oudlpt mieiatfs2uaurp;t0apxn f3iadlm2umn pnu4alenir oydom  auvs;( srur(o iodap e ncia() rraum ou4opxo ociasls ranvo;(0tlxoiocoy1faDrlieo;(0teumim3iy4ol elncsa()aDrrxrpnu1aeeo fetytfaDeaumpn(0altomocoatoaDelneilt)sexmio io1llee fvi s) rrrumpnt1aetn ieiadfsDrm(vsnu)tlerxf todla r uvs s srtoir3iudoleemfcia(  rumurpno4oeeoifetyd sDelu s;t)alxoiociotfatrauvi;s sexrio3no4omt lnvta( s2ua(r no1oex mieiltla2ea( p;(0tlxrmr3oydlateauvol(0 rxr(opnu4ome lnviat srtr(rooo4tlto ieiys m2rmnvp;t4 etoif io1fmt  ivo s0 eum(o nodlltelics (f Dtm(r ;o0texo f3ildfs uauvp;u) etnmo3todfa e n ils s2trim oudapenlncslt)sDum(m nt1tltnio3ias m2emnmp;()artrir io1fateaivo;()t2xrimpiudom nmfesat)srra(r ou1tleomfeilsls2rl(ms;t4trtoxocoytlm  au o;s) eumiopou1ame lfvtasfartrx  ;o1oexomicildla2ul(mo t)artniociy1fmtran o t) 2urxo3iydll eliet ()s2uru  ;u0olenio3iytfa emumpnu0tleomfciadla e neol( texm(m3nydlm  mfct s)sDrmu pno4apt  fciadfm um( s;u0tetoiociy1om   ieo;s teurxo nu1apee fet t)srtruront1aleoiiciltlsDra( p;u0arxoircoydlmD  ieol() 2xoirpoydal nlfct t a2umx o;o0ole ii3iltfaDemumpnu0aetrmr ty1faDrlneo t  2umxo3io4oltnlfvi ( sDtaxmpoo0ape  ieiatla elnvon(4 exomocty1fm elivsls)srxrxrpiudaptn nvia()a2rrur ou0ole iietatlmDumu ont) rtoxf3to1oate ueilt0 rtmxr3io1lle mnvt (f Dua( p;t1optoii3tysla umuvonu4 rxrxr3ta1lpD  i ils srxo(m nydome lnvsa(fartr(ront4oexn o3ilsfmDuauvp;(4tlxnmf oy1lateliei;(0seuoim3no4ame mfvtas)aDrrurpoo1aexomoeiltfsDum( s (0 rtnmrcoadla rlueilt)sruo(m io4lmtnlneiasfaDumu  ot0alenioeiytlmDeau p;u0artrmr iadomt auvilt)tetoirpiydlltelici (fsrum(mpou0aet if3tydfs ranvp t)aexnmr tadopDr u i (  eto(mpoy1opt mivt s aDrmx  ;u0oetomfetlsfs uan p u4altrxr oodopD anes s)tetm(m3iydlme mneiasf Dtm(mpou1aetniietld mDua(vp;(0aetnmrcoatfaD aueols  2uo(o3oy4lpenmfcs tf 2tr( ooo0oee mociad m2rauvo t0tleomf3oa1lpDe u ils trtrir nodllt lncilt) rrm( ont1aee ii3iltlmDem(vs;() etrxf3tytop elnvilt0 rtmim iy1lmt mnei sf ruru pnu4ape mictltls em( o (0aexniociytop  anvi t0t2tm(r3iy4lmen icsatf Dra(rooo0oltn i3tadfs2ran o u0tlxrxociotfa  ai ol(0 rum(o3iydom emictl(f rra( pot1opx if3ias s2ea(msn(4aetomrcoa1faDeaivs;s t2uoir3oydam emnvtat  2rau oou0tpeoiiciysla eln p t4arenmo3ty1lpteauesls0t2to(m nodamenlieil(faDuru  ;u0olx  ieiatls2ua( snu0 lxnif totfaDe n ol( t2tmir iy1ope  neslsfsrra(mono1alxo feiytlsDuluvs;() lermo oodfptr ueolt srum(o3oo1ame lfet sf rtax o;o4open octasls2rluvs;u) rxnxr3ia1fm eli o;s) 2urxo3nydap emietas)s2trumpot4altnmfciyd a2rmnvo u0 etrif3tytfaDraivo;t s2uo(opoy4om nmiei sfaDumx  ot4tlxo oetltfs um(ms;u4artomo iodlp   uvs;(0 2uoxo oy1lpe liviat)srrr(m no0oet moeias mDumnmonu4 etrmr3iadfmDranei;s)sexoiopiy1al   ietl( arrru onu4olxoio3iltfaDemu s (0altoio iydopDrlnvi;t) eurxmpiy1openliesa()aDta(rpno4apto ocias m2ul(vp u0aetomf iodlmt anesls  etr(r iudoptn nvta( arrr(  ;o4apxn iciydfmDea(ms;t0alenifctatlpDeaieolt) eurxrpoudomenmnvilt s2ur(m ;o1ole io3tadfm2rm(msnt) eenmf3tydomt lnei s trtrim oudlpee nesltfarrmumpot4aeto o3iydlsDuauvo;() leoxrcootfp  lnvsl(0trxoir3iu4ame  fvs () 2ur(  ou0opxn i3tas sDuanmpn(0aeeoxr oodfmtr i i;s trtr(m iudam n fct () 2ur(roou4aptnio3tydlsDuau p;t4 exomf iadfa rlieo;s sexmim3oudaleemnvt tfarumu ooo0olto ociadfaDrm(vo;t0trxnmrcoytoaDe neo t texoio3nudol nmnvt t  2rmuro;u4opx iieilt a rm( pnt4tltrxr totfa eaueols)texmio no4ol emfesl(  2trxm no4alxnmf3ias aDra(vp t0texrifciodoa  aivi s s2uoxm3nudlp emictasfaDtru  ;o0apx  f3iytfa2rm(ms;(4arxnxr oy1laD auvo ( setoxmpoo4altnmfct sf rtmu oot1apxnifciltla2um(vs u0altrio iy1om   uei;(  rtrxmpny4lmtnlnvsas sDum( poo0oeeo i3tytlsDum(vs;t) etnif3oo1fmD lu i t0 rur(r iodol  mfetatf 2rm(rp;o4opxomi3iydla ua(vs;t4tltoxrctotla   i s t)sexo(rpoodol nlnct (  Dtax ono1aeenioetatfa rmnvs;t0 etomf3ia1lat auvi;t0tetm(m3ou4lp n fcslt) Dtr( pno0tet mfctls aDumu s;(0 lxriocoatop raivslt  rtoim3iudop n neia( sDtr(  ot1oeeoifctyd a emu ont)artnmr iodfat  neo;s  2trir3iodllte ieiat arrau poo4tet moeiadls2eluvsnt0trxoxfciadlmt luvi (0seur(rpoo4altnmfctlt sDtaurp;u4oltnif3tysla2uauvp (4artnmf io1lpt an sl(  2tmxrpio4am  lncsatfa2rrxrp;u1tlenioctltla2rlump ()teerif oy1lateliei s)s2trxopiu4lmt lfvsat artrumo;t1oltnmi3iatlsDrlnms;t0tleomf3ty1op  lnvo;t0 2um(m ny4al  lfcils artmu pno4optoifeiatfa2um(vp t0aleoxf3todfatraneslt0srumxopno4ll e ivtat  Drmxmoot4aleoifeiysfmDra(vpnt0 eenmo iy1lmtelneil( s2xrxr iu4altemict tfaDraxmp;u1teto i3iytlm2ra(vs t4teenmrciadfaDeaivi t0t2xmirpnydal  lfcsa() 2ua( o;o4oex mfeiyd mDulump u) rxrxfctodlmDe ues s)trtmxr oy4apte icsl( sDrru pno0ape iictytfm emnmp (0teeriocia1opDeaivo (  etmxopoo1al n fetas) 2rax  ot4opt if3tytfaDrlnmo;t4arermf3ootoatrauvilt0sexm(r nodlptelnetat a2ua(ront1tltoii3tlsfm2ulumo;(4arerxo3oodfa eaiesls) rum(o io1lltemivtls)srur(mpnt1opeo o3iatls2ulumpn()areomo3iatoateaivi;s  etm(mpoudom nmiei tfs2ra(  ou0oee iieiatlm2uauvpn() eeomf3to1op rluei s)t2xm(mpio4lmeemfei tfa2rru pot1tpe mo3tadls2uanmp u)aexrio3iy1fat li o;s tetmxo3iydlle mictlsf rtmu  oo0teenmiciadfs umn p;t0 rtnmocia1omtrauvi;s) rxr(mpny4altnmfcta(f Dtax pnt0apxomoeiytlmDrauvo;t4 rermr3tatlaDrlnvi t)s2uoim3ou1llt  iei t s2um( onu4texn fciysfsDeanms t) etoif ootfm elivo;(  exriopnydlp  mfci t s2ua(  ou0olt iieiytlsDrmumpn()treoxrcoadla ean il() eumxrpiy4aleelfeslsfsrtrxrooo1tptn i3ilslmDrlnvs u4arxnmr iytlaD lueil(0 rxm(r3oy1olt mnci (faDta( p;u1apenifctlsls eanvpn(4 rxrxr iotlm  aueol(0t2tr(rpoo4lpenlfctltf rraxrpou0aeen f3tlsls2emnvp;u4aeerirciydoptrlnvsls) 2um(m3nu1lme  ies 
\ No newline at end of file
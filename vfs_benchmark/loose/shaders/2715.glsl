@@ -0,0 +1 @@
+uvi;t0srto(m3iy1amtn feta(fartr(r ;o1tptomo3tldlsDrlnvo u0 rerxo3iodoa  aivsls)s2urxo3no4lptn fvt t srumur ot4olxomo3tltfmDrl(mo ()altoifctodfmDeaieo;s)seum(o3nu1am elnesl(faDrmxrooo4oeen o3tadfsDulu snu4teerio iodlmte ivs ( s2toio3oudol elfes sfaDtrxr ;o0oltn oetysfm elnms;t) etoxo3iodlateau sls)s2trxmpou1ll   nvs sfartmu  ou0aleomietadlaDumums u0arxnxoctydfa rli s t)texrio oy4lptnlivsat) 2umuro;o1tleomf3tlt mDrlnvsnu) lxnmo oo1omDelnes s t2toxr io1apenmivilsfsDraxmooo1oltn feias m2ul(ms;(0alxrmr iotomDeaueo;s) rxo(m3nu4altnmncs t)aDua( o;o0oex mieiydfa2rm(vp u)trermf3iy1opDr ieslt0seto(r iydolt  fetlt)srtmx ooo0apen fetat mDrln o () exrxr ia1lmtelueo;s srtmxr3iydome lfvi (faDtmxrooo1aetn iciltla rl(vs u)trtrmo oo1optr u i s0 exo(m ou4lpte net s) Dumx o;t4altomi3iytfa rl( sn(0arxrxfciodlp  ln i;t  exo(m iy1lpt mfesl( a2uru  ;u4tltnmociys s ra( o;(0 rerxrctadoat aieo t0 rxoir3no4lme mivt tf rur(rpnt0opxo feiytlm ea( p u4 exrxfcootlmtean il()sruoio iu4optnmfvtls  2tr(m ;o4optoiictlt m elu o;t4 rxomrcio1fm  aueol() rtrxo nudamt mfet s) ruru o;t1tlen oeiltfsDrm(vo (0teerxo tatfpt  nvo;s)srxr(o nydll elfes s  Dur( pot0teenmfeiat a2rl(mp;(4 lenir tytla r ieolt0texmio nydop n netl(f rua(mpou0tee mfcild m2ra( snt4 etoxr3io1opDraivs;s0srtmio3oy1oleemics t)aDta( o;u0teeo ictydfs2emumonu4tlxnif3tadfa rlnvs s0tetrxr3nodomenmnvils) Drmxmoou0aptniietatfa2el(vs t4 etoif iatfa   i s t)t2xo(m3iodape mict s a2rrxrpoo4oetn o3iatlsDulnvs;t4tlenircoo1lpte nes s) 2umim3oudom  lfvt s) rtmumont4tetomocias s rmuvp (0tltnxfcta1omD an il()s2ur(m3nydam   nctltf 2raxmpou0opt  octytls rl( o (4alerxr to1laDr nvs;(0s2tmio3oo1am nlnvslt)a2um( o;t1apto oetaslsDeau s;(4aeenxo iodop eaivo t  2xrxopiudope mfetasf Duax poo0olxnmieiat s2ea(vp;u4tetomo3ia1laDranvilt0 eum(r3oo4aptelnet t)s2tauro;t4oleo i3iltfm2rlums (0aeenmfcoa1lp r u i t trxm(r oudop elnvi (fa2urumpou4tlxo ociaslmDranvp;()trenmocoodlptr ivo t teuoiopiudapte fvi t) rtrxrpnt4tlxnif3ildla2rlumpnu0 lenmoctotfptelieilt0 eur(r3oo4alt lnvtlt  rtmum nt4ape  ocilsla rlu ont4tltoirctydlmte nvs;( s2xo(o ou1ome livi t)sDtax  nt0oeen f3iysfa eanvp;u4areoxf oodoatr uvi (  rurimpiy4aptn ietls a2tr( o;u4oetnmfcilt s2emuvsnt4aetoir3tadfaDraieo t) 2trxmpou4oltnlfcilt srta(m ;t4aeeniictat m2rau o t)aexrmf iydfp elivs (0s2tmxr oy4apte ies s)aDrauro;u4tpeomf3ildla rmumo u4arxomfcoydlmteluvi s  2um(m nu1altelieiltf 2uru  oo4tltnmicild sDem( o (4 ltrxo3tytfp elieolt0t2tr(mpnudame  ieiat)sDtrxrpou4aptnifctlsfsDuluvon(4 rermociodlmtranes;()texoim3io4ape lnvi sfarrmur ou0ole  feiatfa rmnms (0areoxrctytfpDeaivo (0trxo(r iu4lptn nviat)a2raxr ;u1aleomocildlm eln s ()arxnxf oytla   ues;()teumxm io4lleeliei (fsrraxr ot0aptnmfetld aDul(mpn()trtrmr3iatfptrln o;t0s2to(o iy1ape liesa()sDumxm ou1aex  iciltfa rmuvp;(0trxoxociydfpDranes;t) 2to(m3ny1apee ieiat) rrrurooo0tpxnmo3tas sDumnvsnu0 lxoxrcoy1omDeau ils t2urxo3nu1lle  nct s)aDumum nu1tet  feilt mDel(vo (0artnmocoadlp  an o s teurim oo1lmtn feiasfaDrmxr ;o1altn feiydfm rln onu0tlenmf oadoaDraiesls srumxo3nydapt  ictl(fs2rauroot4tlenmieiyt s2uau o;u)trenircoatomtr uvi;t)teur(o oydalenlncia(fsrtrumo;o0alx iicilslaDelu p;u)tltoxociodopDrln ol()trtm(mpoodlmte nct sfsDra(rp;u0apeoifcilsla ul(vs;t) exrmf3ia1fpt lueolt) ruoxmpoy1lm nlnvslsfaDtrxr ;u0aexnmoctydlm2ean s;t4 lxnmr3ia1opDrlneslt0seum(rpiy1oltemncia(faDrru ont4tlx if3iydls uanmo;t) eenmoctatop   neo (  2umimpno4ol nmivsat aDra(rpou0oeeoiietltfm elnmo (4alxnxr3oatfpt  nvolt)texo(opnu4lp e fctlt) 2tmuro;u0altnmieildfsDemn p;()altomociy1omt an o t0t2toio3oodapeelivilt)srur(mo;o0tleniocild sDea(vp t) renmoctotfpD  nvo;t0srtr(o nodapee nvt s aDra( p;u4opt mociat a eauvp u)aeerxrctodopD  n s (0t2xoim ou1olte net (f 2ur(  ot1tleo icilslmDem(vsnu) eeomo3to1fatr u o;(0s2xoxopoodlm  lnes s)srtrurpoo0altomi3tatfmDrluvsnt4teenxr3iadfmDe i ils  rxr(o oy1ol  lfesas sDrax pot1tlxnifcildfmDranvo;(4 rxoxrcia1oatranei;s)setm(o3iy1lme  ivtltfsDtmuroot0tlxnmi3tldfs em(vs t0trtrif iydfatrln o;( trum(rpnudllenlnvtatf Drmumpnu0tltomictysls rmn o;u0tltnmocootfp e uvols)sexr(m3oo1aleemfet s)sruaump;t1aetn iciys a ul( p;u0tlxnio3oa1lptrlnvs;t) 2tmxr3ny4al   ivsatfartmxrono0apt mictydfaDea(mpnt)tltrio3to1lp rlu ils0t2to(opou1oltnmiviat a2ururp;t0optn feilsls uanmp;u0 lenxf iytoa rlneols tetoxmpny4omeelfesas)arra(mpoo4olxn ictld mDumnmpn(0trtoxfcoadopDrau i s0texr(o io4opeemnes tfarua(monu0apxnii3iltfa2rlnvon(4 renif oa1lmteai o;s0srxoxr iydaptnmietl(  Duaxro;t1optn oeildla emnmonu0trerircoodlmt auvs (0sexrim3iy1om e netatfsDrrur nu1tpx mi3tytla rau p u4 etoxf3oa1opDeau s;(  exr(rpiydlpte fctas a2umx ont4texomi3tasla ul(mpn() rxnir ia1lmDraues;t texoimpoydllee nciltfsrrrx  ;o1apxnmieilslaDum(von(0tetnif oydoa ran s s)srtrir3ny4ap  mivtl(fa2umum ou4ole  ieiasfs ulnvo;(4aetrmf3to1op   uesl( sexrxo iydlmee fcsa( arra( pno4aptn fciad sDemu p;(4tltomo3tatopDraneo;t sruoir3oodlleelfet t)sDta(r ou0olxnmf3ildla2rmnmp ()aleomf3oa1lp   uvslt  exoio3iy4lme mnei s)arra( oot1oeen ieild a2rln s;t) exrxf3oy1fm elnei;( s2xrxrpno4omtemfvtasf 2tr(monu4oeeomoeiasla2rl( p;()arxnmr3tydoa r n ils  eum(mpnydap n fetlt a2rru pnu1tleomfeiltfaDuau p;(0 eeoxo iodopD lnes t)s2xmim nu4am   iciatfaDur(m no0olxomieiyd mDrm( snu0trtrmr3iatfaDrli ilt  2tm(r3oy1op emivi s aDur(ront1olen feiadfm2el(vo u0tetrio oa1omDran s ()t2xmxrpoodopee net t s2rrum nt4open oeiad s2rauvpnt0aexoxocootfa  anesls)seum(m3iy1olen fct tfsrrmxr ou1aeeomieiytlmDrau s;t)aexrxr todfpteaieslt0 euoirpoudal  mfctat)sDra( p;u0apeoif3iydfm rl(vp (4teeomr3oytfmte nei;(0s2to(opiy1op  lfvtasf 2ta(r ;t1apx  o3iydla2umumpnu)tltrxoctotom eaieils0t2urxopnudlmt mneia( a2tmu pnu0ape ioeias s2rmn snu4alxrir iatlat livo ( srum(o iudam nlncilt  rrrum ;u4aeenmietas s2uan p;t)alxomrcoytopDe uvs;t texrirpoudomt mfeias s2umum ou0tpenifeiltlmDra(mp u4treoio3oadfp elneo;t)texoir oydol   ivias) 2umu  ;o1ole ioeiltfa umu onu)trerxocoo1om ean olt)texmxr3iu4ol  mfesl()sDrm(monu4alx  ociltlmDelnmsnt)trenmr todlpD aies;(0 2uo(r nu1opt  nct sfs2ta(monu0tptnmo3iatfsDum(mpn(4 rtnxo3oatfptr ivo t0 rxr(mpiy1lptn neta() 2umxr ;t1ale mi3iys a rl(mo (4 renxoctotlmD aues;s) exrxr3iodlp n fci () Drmurp;t4tpeomfctyslm2elumon(4 eerirciytfat lnvsls)srxo(m nodll elfeil() Dtrxmpno1alx  feiytls rm( on(0artoio3iydopte ies;( trxmirpiy4lpenmnctls s2tm( pou4tetoii3tytlm2rmuvsnt0trxoir3oatlpt  neo;t0t2xmxopio1lmtelivi s sDta( pot1aleo oeiad mDum(mon() renxf3oodfaD lneo;s)seurxm nydlpen fvilt)a2rmxmooo1alxnmictld a ranvo t4 exoxfciytfa e i ilt0tetoxmpio1altnlfcils)sDtaxmo;t4tlxo o3tydfs emnvpn(4tetnxrcoy1lp r ivil()s2xoxo3oy1lpe mneilt a2rrur ot4ape ioctatla rmump t4teeomrctodfptraivi;s truoxr3ou4ameemnvt s  Drrumo;o0tpeoioctyslm ul(mont0tlxnmr tytomD livo ()t2trxo3oo4apenmfciatf Dururp;o4aexnmo3iydfm ulnvs;t4trxnmr3todomt lnesl(  etm(o3iy1op  mfci s aDtrxrooo0apx mo3iltfs ran p;(0artnxr oodla e neo;s0trtrimpno4optnliesatfaDuru pnu4optomfciatfaDel(vp ()tetrmr oatla   neils0t2trxm iu1ol   icsl( arra( ont4ope  fciyt sDuauvp t)treoio iy1oaDrai i (0 rumxm oo1om nlncslt) Dur(m nt4tet  feiydls2ra(monu4 exrxrcia1fatelnei;s0 rtr(m oydomtn fct ( a2um(mp;u1aleo iciytfmDranvo;u) lxnxrcoytlm raneolt) etoxm3oodlptn fcsls) Dtr(mp;t1apx ifctlt s ulnvs;t0tltomr3iodoateaies;t)srxrxo3io1oltemies t artrumont4tleniictadlaDemumo;u0artrxf3ta1omte iei;t0t2xm(m3io4ame  ivia( s2umumpno4olx mocilslm2umnmo;u4 rtnxf3io1opDrluvo;s0 rxmio ou4om elfvi ( aDuaxmp;t4aex ioeias s2ul(mp;u0 eerxr iadlmt auvils0s2tm(o3no4lm e netasf Drrur ;o0aetnmo3ilsls ea(mo u4alxnxo ty1omDr uvi t)trxmxo3nu4aptelfctlsfs2raxrpot0alxniiciys aDum( o;u0aexrxo3oo1lateluvi t0 2urxo3oy4amee fcsl(fs2tm(mpoo1oleoio3iasfs2emu s (4aleoxociodfpDeln sls0 2trim3nydlp e feta(farumurpou0oeeo oetldlaDemumpn(4texoir3oa1laDeauvils  etr(o no4lp nlictatfs2umx o;o0altoifeilsfsDrmu ont) ltnif ootfp rli il(  rumxmpoudll nmfct t)aDumxr nu0olenifcilsla raums (0 etomo3iadlaDrlueo s s2urxrpnu4ol nmfcslt srraxmpou4tpe iicild a ul(vo;t0trenmociotfpDelu ilt texoimpiudlptemietat artmxmp;u0tex  feiasfa2rln s ()tlenmf to1latrlivs;(0 2uo(m oudal  mici s srtaxro;o1oltnmicildlm rmnvont)aeeomrcoo1la rlnes;s0srxrir3iodll   fesl(  rtaxroot0oetomfetlslm elu p;u) rxnxocoydlatrlnvi;()trtrio no4al nmfctat  2rm(  nt4tlxnioetldls2emu o;t0aeerxo3oydlate i o t0sruo(o3nydlleelict tf rtmx  ot1tlt if3iadfm2eanms;(4aetnxrciotfaD  uvs s0s2to(o3no1op  lnesas  2um(roou4tptnioeiadlaDumnvpnt4aeeriociytfpDe u olt srtrxo ny4olt lfcia(f rra(m no1ale ifciytfm rmuvsnu4alenxr3oodoateaueo;t0s2trxm nu4am n ncs ()sruaxm nt0oleomi3ils aDrauvpn(4tetoxocty1lmt auvi (0teuoxopny4oltelfetls) Dum( oot4tetn feiytfaDuaump;u4arxrxo ta1omt  ieil(0srto(r no4oltelfvta(fs2rrum ot4tee iieiys m uanmsnt0arxnmr3iodfmD  nes s srxoimpou4lpenmfvsa( artr( pnt0apeoifetlsls2ulu pnu4tlxnmo iatlp  lnvi t0 eur(opiu1lp eliesas sDuaurooo1aeeomiciyd m rmumonu)altrmfcoy1fa e nei;s0 exm(o3nydal elictasfaDrm(r ou4alt mo3iaslm uan snt0areniociatla rlieol()t2to(r3oy1om n ivta(fsrtm(rooo4oeenmf3iys aDemumo;u0aetnxf3oytfat auvo (0t2tm(r iu1om nmieils  Dtmu  no0opxnmociatls2rlnmo;u0tltoifcto1oat lies s) rxrxr nu1omte fci t)sDurxr ;t1alxnmfciltlmDrauvo;t0tlxomo iatoaD  u o;( setrir3oo4op nliesl()arrax  ;t4ale  oeildfa emnms;() etrmr oydfp  luvo;( t2uoxm3iy4lmeemfeslt a2rrx o;t1olx iociatla2rmnvs;(4artnio3ia1lmtraneslt) 2trio3iu1am elnes s arraxrono0tetnifeiys mDrmuvp;u)trerio3oo1fpt  u o;()texriopiu4am n fci ( sDraump;t0ole mietasls2uln p u0 leoio ia1oaDrlnes;s) 2xm(m ny4apenlivta(  2ur(rpoo4aexnifetadfm eanvp;(4 etrxrcoy1laDeaiei (0setr(o3oy1ameelfetas)aruru o;o4oleomoetlt m2ra(vp;t) lenmr3oytom rlnvs ( setmxr3nodlmeemnvslt  rrr(ro;t0apxo i3iyslm2rlnmo;()altrmo oy1la   u sls)sexm(o ou4lpt  nvi s)s2trx pnu1oet  ietytfm rlnmo;() rerxo3totopt  nei ( t2xmir nu1apt  fct (farrru pot4texn ocils m ul( p;t) eermfciadlaD li i;s0 rtoxr iu1ameemfetlsfarumxrp;t4ape  o3iatlm2ea(mo (0 rtnio tadfateai ol(  etmxo3io4lmeelnvtas)srum(  ou0tptomoeiysfa2ulnvpnu4 exrifciadlpDelu o;t sexm(m ny1alenlnciat)srra(moot4openiieilt sDrmnmont) reoxf3to1lpteli i;s)trxm(m3iu1amen feia() rrmu  ou0tlt ifciyd mDul( s;u) eermrciy1omt lu o;() eur(rpoy4ale lfet sf rrmu pou0openmfeiat a eanvo (0tlerifctotfpDe ies;()tetmxm nodop nliciatf 2tmu  ;o0alxoiictysfa2uan o t)tetrif3tatlm   nvs;() 2trxm io1ap  mneiasf Dur(rp;o4ope  f3iadlmDua( p;t)texoxf3tydlmt auvi;t srxoio3oydol  mivslt  rtaxmpno4optoio3iadfa2ulumo;u4tlxniocio1lpt au sl()trumimpio4ole lfesl() Dumuro;u1tpxn iciat s2emnvs u0 rtrxfctadoatrai i ( texmxmpnydome  fctas) 2umu ont4alto oeilt s2el( o (0tltnio3iytfaDe ivo (0s2uo(m3oudoptemivs ( artr(mp;t1tltnmo3iytfs2elnvpnt) leoir3tydop rln i t0 rumirpiu4ll   icsa(f rururpno1aeenifciydlsDem(ms;() exrmocto1oa  lies;t seurxm3oy4apt  ietat a2raxr ;t0oltnii3iytfm2ul(msnu0alerxrcoodfa r ueo;( seumxo iy4lp n ncta(f 2rrxr oo0apeomoctas aDranvp (0trenxrcto1oa rluvslt0s2xrxm iu1lm  mictl(faDur(moou4teeomocilt m rlu snt4trxnioctatfp r nvo;t) 2umxr iodapee icta(f 2raxmp;o4oetnmictatlsDra(mp;u4teerifcoo1omt  n i () etoir ny4oleelivtls  rrrxmpot0alxo f3iyt s uauvo (4teerxr3io1fatr nei t  2xmxopnu4lp emfcs t  rraxr ;u1tleo oetld s2eln s;(0 eerxfcoydla elnvil(0s2trio3io1ape  neils a2ra( pnu1altoioetlsfa2elu s;t0 rxnir3oytoaDraivs s0 eur(r oydll nmfvsa()srrrur ot1oltnmfeias sDuln o ()aetnif totlatr n s (0trxmir3nydomtn ivilt a2um(mp;t0tptoiociltfaDranmsnu4treoif todopDrlueo s0srurir iu1ap  mivsl( sDrru poo0opeoifetysls em(mo (0trenxf todfpDrluesls)tetrir oy1lm  lnviat a2rm(rp;t4teen octas s2rau o;(0tlxrmfcia1op eaneo t0truo(o3ou1ll nlnvils)srtau  nt0tetnmfetatlsDraump;(4alxrir oytfmDr uvi t  rto(o3nu1lp emfcia() rraxm no4tetnmicias s2umumsnu)alerirciy1laDean ils0 2xmxo3nu1ll emncs sfa2tmxmpoo4tpeomoeiatfm rmn pnt0 ltrxo iotopt lu olt0t2trio iydol e ietasfartm(r ou1tlx ifetadla2eaump;(4tlxrmocoytomteau sls0srur(o3oudop n icslt) ruru  nu4aetoifeilsfa uauvpnu4altrxr oa1la rliei;(0 exmirpou1lptn iesls arrm(monu1teenii3ildfaDrln onu4trxrmf3iodlaD auvslt0tetrio iudap  lfvt sf 2taxmp;t0oexomfeiaslsDuau o (0 rtnmr3io1fpDranvo;()setrirpiu1llte iet ( artrx  ot4tpxo oetltfm2eanmp;t0tltoir iotlpD lu olt0srurxrpoo1amt mncslt)a2urx o;t0aetomieiytlaDumn o;u)arerir3oy1lmDr u i;( s2ur(r io4lltn ncta(  Durxrpoo0tltnif3tlsls rmnmo;u4 ltnir iodlatr ivi (0trurio3oo4op e feias srtmx p;t1ope ii3iys mDuan p;(0trxnxo3oatlm  anesls) 2toio3ny4llen fci t  ruau  ;u1ole mietydls2umn pnt)artrxf ty1oa rluvi t0trur(m3oy1ope  fvt t)arumu p;t4tlt  oeildlsDemumo;t0trtnxf iatopteli o;(0 euoxr3oodom e nvtas  2tmxr ot1tlt  i3iatfs elnvonu)tetoircootlpDe u ils0s2xrio oy1omee ici () 2tr(moot1oex  fciaslm2rlumon() ltrmr oadfptelnvi () exrxo iy4lptn ivtat  2uaur ;t1olxnmfctlslmDem( pn(4arxomr todfmt li i;()seumxm ny4lp nmictat)s2rax p;t1alt moctlsls2rluvpn(4trenxf3iytfp rli o;t)teuo(rpoo1alen iet ( artaxr oo0aexnii3tydfaDranvo;t0texnifcoodomD lnvo;t0 rxoxmpoy1ope  fetls)sDra(rp;u1tlenmoeiadls2rmu o;(4tetoif iadfa   ueslt s2urim3iodamtelivias aDurxrp;o1olx mo3ils a2umnmpnt)texrxf ootlpteaies s) rumio3iu1ol e neilt)a2ta(mpou0tptnmo3tls m ea(vp;u4trxnxo iytom eln ols) rxm(opiodoptnmfcsls)a2urumono4tpxn oeiatla ul(mpnt0altoxfcia1lpDr nvs s  etrir nu4lmte fct (f 2tmxmont0tltoiictlt m2uluvo t4 leoir tatlpte n s;s t2tmimpny4lmenmfetat sDurxr ou4altniiciytla2ulumo t4aexoif iotlpDr uvo (  eurim oydap n nes t)arta( ono1texoiiciadfaDrlumont4 lxrmrcia1fatraueols) exm(o3nu1apte netat)arrm(moou0tet iicilsfs2ua( s;()tlxrif tytlptraueilt s2tr(rpoo1lptelfesas) Dtru ooo4aptn ociysfsDeau o;(0arxrxo3oatlpt lu i;t tetoio nu1altemfvsa(f Dtaurp;t1tee mo3ildfs2ulumonu) etomocoo1oat lneslt0 rxrio iy4omeemnes sfs2umxrpnu1olxn oeiltfa2rm(vp u4alerif3oydlpDe uei s0 2xrxopnydlpenmnvilsf rururp;u4tpt ifeiatls ea( p;t0aexnircia1faDrauvi s0 2uoxr3iy4ap nmietasfs2rmx  ;t4altniociyt s uln s;(0 etoxo3ta1laDr nvsls  exrio oy4lpen nci sf rtm( o;u4oltomf3iatfs2uanvpnu)trtnmf ta1lpD ai ol(0trtoiopnydom n fvi t)a2rm(root4apxomo3tat s rm(msn(4altomf3io1faDraneolt0trtoim3iy4apte fvtls)sDur(mp;t4aexnifetydls2eanvon(4tlxrxocoadfmD  nvi;t0seumir3ou1op nlnes t aDurum nt1oexomfctasfm2rln o u) rtrmoctatlptran ol(  rxmxo3no1aptn ivtasfs2rmumono1aetn fciydlaDua(mp;(0areomfcoa1fp eanvi;t0 eumimpiudap eliciltf 2tmu  ;o4tee ii3iyt mDea(vsn(4 rxrmf iytfm r uvo ()t2uo(m3oy1olt  ivta(  rrm( pno1teeo ieiad aDranmo u0 rtoxfcoytfatrauei s0trtoxmpiudalee nvt t s2rmurpoo4teen fcildfm2ranmo;()tetoxr oodlmDran slt0t2xrxopou1am emnvsa()a2ururp;o4apxn f3iyslaDua(mp;()arxnxrcoa1fmte uvils0 2xo(mpoo4apt  ivsat sDtmxmo;t1apx  feilsfsDrm( snt) renxrciodfptrlivo;()s2xmxr3iydomt mfcil(  rurxmonu1oeeomictydfaDemuvs t0arenxociotfa raueol()trur(opnudlmeelnesas srur( ont1opxnioeiydfmDrl(vp;u) rerio iytop rlieols s2umim oydll n nvsltfsrtr(mo;u4teen ociadfa uln s t0 ltoio3io1la eai il(0 eurio iy4amt  fesl(fsrra(rp;u1aex ifciyt m um(vo u) leomociatlaDeln o;s0t2xm(r ny1lmtnlivt t)s2raxroot0texo i3ilt s2rl(vs u0trtnxrciadlptrluei t srumxr nu4al  livt s srrmxmo;u0alto f3iysfa2eanvsnu4teeoxo3ta1oa  liei;s seumxm iu4lp e ivt t)artr(mpou4alx ii3iytla ul(vo ()aetoirctatla rlneo () 2toxr3nodom nmfcs (  rtru pno1oee mocilsfa2rm(monu)trxnir3iadomtr i ols0tetrxo3no4lpe  fvs s) rtmurpnt1alt if3iatfa2ranvp;u0artrmocio1om rau s s)srum(m oy4amte ivil() rtmxmpno0oexnmf3tyt a2ul(mpnt0 lxoif3totom rli o s)teto(opny1aptemicta( s2rmu  ot4aptniietyt m2ea(vp;() etnxf3tadomD anvi s trtrxr3iy4amtelicsl()srraumonu1tlxomietldla umnvp t0tetrxrcoadop rluei t  ruoio3no4lpen fvt t  rtmurpou0aexoioeiatlmDrmnmp t4arxoxo3iy1lm  auvi;(0sexr(opiy4ap nlfvtat)s2rrumpno1apeo iciad mDelums t0tlenxr3ta1lmDraies (0 rum(opoo4optnmfctas) 2raur ou4aeto ociyd a rauvp;t)treoif todfp elnvs;s0t2umimpou4lmenmnvt s)aDum(mpnu4opt  oetlt s2um( ont4 rtoifctytlpD  u o;()t2um(m3ny1amtemncsls sDtaxroou4opx  octatfa rlnms u)aexnxo oa1laDr u ols) 2xo(r io1apt mfetls a2rm(r ;o1aeeniictadlm2ul(ms t)trenxo3oadfpDr uvi;s sexrir3ou4ll   fvslsf 2tm(r ;t1tltomieilslm em(mo;t4trtoif iatfpDraivs s0 rxmimpiy1lm n ncia( aDuaxmpnt1alxn f3ils a2umuvp t4trtnxo iadla raivils0tetmxmpoy4lm emfvt t arrm(mo;o1aeeoioeils aDul( p (0aeerircta1oaD ln ols) 2toirpoudaltn ivsltf 2rau pnu4tptomoetys a umn o u0arenxo tadopDe nvslt  2xrxmpiu1ap e nvtl()arrmx onu4altn ocils s2eanvo u0aexrmr oytomD lieo ( srxm(m3iu1omen ietl(farrrxr nt0oltomfetatfsDean snu0 rxrmf iadlm  luvo;s)teur(r3oy4ol e icsas  ruaxrp;u0tltn i3tas aDuanvs (4 lxnif todopt  nvs (0s2tr(rpiodopee feia(f rumuroot1oeenmoctytfa uanvs;(4 exrmr3oo1oa elneo t  rxr(mpnodlleemfes t sDtmum ;t1olto i3tad mDum(mp;()altoirciadoaDraueo s0truoxr oy4lmenlfcslsf 2raumont0aptnmo3iltfm2el( onu0arenxr oa1omDrai slt)srxmxrpnodal nmietlt)aDrr(r ;t4tlt mo3iad s2rlnms;t4 eenmr3iydlpt  nei t0t2uoxo3oy4al emncs ()aDumx pnu1apxnifetadla2ranmo;(0tlxoirciydfmt  iei t0 2xoxm3nodlmtnmivs t sDrr(mpoo4opx ifciyd a2elnms;t) leomfcto1la   n i;t0sexr(r nudomtelfcsl()arrr(moou1ole if3ildfsDemuvo;u0 rtomr3tytoat livils)setrxr3ny1amee ict s)srraxm no0opto fctlsfs2eanmo;u0 reomf3oatop  an i ( t2ur(r no4lm  liesas)a2uax ont0tpeomieiyslm eau s u)trtrmo iytlatelu ilt)sexriopiy1lmt  ivi () Drmxmpou1oleoifeias s rl(vp u0alxnmfctotomDrluvo ( texrio3nu1omt  neslt)a2umx oot1tpen o3iat sDelumsnt4trerxfctydfpt au i t0t2xmxr3nudlp   icia()srrr(ro;u0ope iiciat sDemn o t)altrxr oa1fm  auvo;t0seto(m iu1ole  ivt t a2um(  nu0tpx ii3tasfmDum(vo;t0aetoxr3iytfpD au o t trxo(o nu1optnlnct sfsDraxr ;u0tetnmo3tasfa uauvs;(0aetoxocio1om r n s t  rxoio oy1omenlfvt ()s2uau pnu4tpxnmfeilt sDrm( s;u0tlxoxf3tatfptrauvil(0 rtr(o3nydlme lnesl()a2raxmo;t1opxnmfetls aDrl(monu0alenir3ta1oate uvs;t srtm(r nu4om n netat  Dum( ono1tpe mfctatlaDelu o (0tetniocto1fmtrlues t0trur(m3nydamtemnvtat  ruru o;t4openmo3tyd m2umuvo u0areoirctodlmtrlneo;t)trtr(r iydaptn nctat) Dua( ooo1optomi3tyt s um(mp u)tlxoir3tadopDrai slt)trxmio3iu4lmt mnciltfaDua(r no4tee  oeils mDul( s;t4tleomfctadlpD  neil() rxrxopnodamenlietl( sDta( o;u1tlxo iciydla2uluvp t4aeenxo oo1fptrauei ( trxmxo iydoptelivt s)a2tau p;t1tltomfeiadfa2ua(vo u0arerir ootfpteaivils texmxopoudlpe mfvtl(  Dumxrp;o4tetnifeiyslsDemuvp t0 rtrmf3tatlm ranvi (0tetrxmpoudalt mfcsl( a2umxro;o4aptoioeilsfs2ranvs;u0 exoif tydoatran ilt0setrir3oodap  lfvia() rurxmpnu4alx  i3iasfaDrl(vs;u0aleoif io1oat aivi;s)t2ur(o nodlm  mfet sf Drm( pno4tpeomietyt mDemn pn()arerxociadlmtelivs;s s2trxo iodll elfctasfa2uaumpou1optnmf3iltlmDuan o;t0aeenmf oydomt lnesl(0texoxo3ou1lleeliet (fsDrax  ;u4apen ieild s uan s (0teenmrctadfpDrlueols seurxr3nudol nmiviat) Dua(m ;t0opxnifeiys m2uaumpnt4tltoiociodomtrlnvslt)teuoirpou4apt  nctls)srum(  ;o1texnmf3ild sDul( p;u0artnmr3oa1opDeln sls)teur(o3io4lltelnci tfarurxmont1tptnmf3tld m2rlnvp u4aeermocoadlmDelu i t) eurxr3no1lpte fvtlt)a2umuro;u4aetnmi3iadfmDuaumsn(0tlerif oadopD anei t)srtmim3iydlle mietls arrm( o;u4apto ieildfm umuvont0arxrif3oo1oatr i s;t trxmxrpno1lp nlnvs ()sDtrum ;t4tpeoio3iltls2emnvo u)arxomociytlmD  neilt  2uoiopiy1op nmnesa(  ruaxmoou4aeen ieilsls eanvs;(0alxrxo3to1fpDrlueols)s2uoxm3no4apenlictas)arra( ont4olxnmo3ildfs rmumo;u0 renif iodlm r u i s) rxmxopnu4lpte nvtl(f rurxroot1tle miciys s raump u0 etnio tytopDeanvi ()setrxr ny1lp   nvsltfsrtauronu4teenmiciasls rm(von(0treoif3oodlptraues ( trxmirpoudapte fcsat)sruaxrpnt4tet  feias s2emnvsnu4trxoircio1omtelieolt0 2urxrpnudameemnci (f Drmum nu1aeto f3iydlsDrln o u4trxnxr tatoa  aneslt s2xmxr3nydom   ieta(f rrr(m ;t4oltniicils aDem(vs (0teenmrcoydoptrlies t t2xr(o3io4al  mfctlt a2tm(rpoo1tlx mietysfmDuauvp ()aexnxr iydlmtelueo;t) 2xrirpiydal nliesa(faDtrxmont4aexo f3ildla2ua(vp;(0aeermrcoa1fat ln s;s0 etoio iudalen icta(fa2ur(r oo1tpxo octadfaDuau p;(4 ltnxo iatlptelneilt)teumir iydlpe  iviat aDta(r ot0opt  f3tadls uauvo u)teeoxr oadfmDr i i;t) euoxr iodopt lfcias  rrau oou0tpe mieiadlm2rmuvont)alxomo3tytfmte ivi (0 rxr(m3oudam elieils  Drax o;t0ale  fetlslmDumu pnu)alxoirciytlpD  n olt srum(o3ny1ap nlfvi s)s2um(root0aexomfeilt sDrln on(4 etoir3iotoa rlivi ()seuo(r3oo4ame lnvt tf rurumoot0alenmi3iytls2emu s;t4 reoxf3oydfpte ieolt) etm(m3iodll nmfvsa( arumu ono4alxnmo3ilsfsDraums t)aeeomfcoytlp   ueo;(  2urirpoy4lptnmfvi s s2uaxro;u1apeomictyslsDulu p (4 etoxf3oy1la r u i;s)s2xmxrpiudlpt lfvsls arumx pno4ale  f3tasfs emu sn(4teenmr3oadomDrlues t0 rtmxr3nu4amee ivil()a2rmxm ot1optomiciys m emn o u4 eerir iodlpD lueilt texmir iu4lp e fes (fa2rrx poo1tet  f3ilsla ran s;(4trtoio3oytop elnvilt  eur(r3oo4oltnlfct tf 2rmurp;u1alxoioetytfm2ean s;t0 exrxociy1oatrliei;s)trxmiopny1lmtn fvilsfaDrr(  nu4tpxoio3iatfsDumumo (0tetoxo iadom rli s s0s2triopnodlm n nct s  2rax pnt4opeoio3iys a umump;t) reoio tadfpD anvs (  2toim oy1al   ictl(f 2umump;u1apenmictlslm2emn onu) lxoxf3ta1fp eaiei s)sexo(o oo1apt lfvils aDrax  nu1olenifciyd mDemuvsnt)alenir3totlpt lueols t2xm(mpio4openmfcsa( aDraumooo1alxo fctltlm2el( o () ltoiocootfa r ueo;s0 rur(mpoo1oltnlncslsf 2raxr ;o1oeenii3tls sDel(msnu0arxnmr3iadfptranes;s s2umio3nu1op nmfet ()sDtax oou0ope  f3iys a2um( o (0teerifcoydlaDrai s t)srxm(opnydam   netas  Drm(r ;u1tlen ictydlmDul(vpn(4tetnioctytoa e i i;()s2tmir nodlpenlfetatfsDtax pou4aee ioctlsfa2ua(mpnu0aetomrcoytfp  lies;s) etm(m ny1opeelnctat)srum( pnt0opt iicild a2um( pn(4texomo3tytfmDe i i t) etrio oydlle mnvs s aDraxmp;o0oee moeiys m rlu s;(0 ltoio tytlm   uvs (0seumim3no1optemnvtls a2tmxm oo4oex  oeiasls rmuvo (4tltnio3iytfm eai o s  2xmiopoudap n ncsat) 2uau o;t0alenmfctat aDrl(vs;u0artrifcoy1omDeaiesls)trxmir3oo4lm n fvi () 2tr( ont4altnmi3tytfm rauvsnt0 exoxo3ootfaD anei;(0seum(rpou1apen ivsatfs2taump;t0tpxo o3ilslm em(msnt4texrmf3oytfmtranvols srto(r3ou4opt mfvsls)a2uru  ot4oetn iciat sDelu s;() eerxo3oadlatrluei;t) etoirpiu1ap   nci tf rta(  nu4oleoio3tyslm ean p;u)artnmfctatla  liesl( texo(r3nydap elietltf 2ra(r ;t1tpt  ieildlsDrau p u4arxrxo oa1lpDeaivil(0seumio io4opt lnvsls a2umxr ou1oet iiciydfs ua(mp ()trxnif3tadlaDrliei s)s2to(o3iy1omee ivi ()s2rm(mpou4apt mictlsfsDul(mpnu0altoio3totlpDelieils s2umim3ou1op   fetas) Dtaxmooo4tlenmfeildfa ea(vpn(0 rtoio tytfateaiei;()t2toir3oo1lpt mfcsasf Durxrono0opt  fctatls rau p;t4aetnmo tydlaD auvs;t)t2trxopio1alt liesatfaDtrum no1apeo ieiytfm em(mo;u4tltrif3todlm eanvs;t trur(o3iy4lmt mivt t) Dtm(m ;u0opto feias m2eauvsn(4 rxriociy1omD  ueols0 rxr(o3ny1ap  miciat)aDrmumpoo1teen ociysfm ulu p;t0texoxfciodom eau o t0 rxr(r3iu4am elfctatfsDumxrpou4altoifeilsfs2um(mo;u0 etrxf to1oa r neslt0trtmxo no4ap n fvi ()srtrurpno1oexn octadfs2umums;t0texomr iadoaDr i i;s setrxmpiodlp nlneil()a2uaxmpno4openifetltla2emnvo (4 exrxfciytlptraivs (0 rtrio3iodame licsl()s2tmu  ot1oexoifcild a2ul( ont0alenifcoa1lmDelueil(0 rxr(m nu1ol n ici t) 2raumpot4tex ioeild s elnvp (4 etrmf oydfa r uvi;s0 rum(opnudlmt miesl()sDra( oot0alt iictltfmDuln o (0tetrmf3to1opD anvo;( srxriopoydap  livt ()sDumxm ;t0tlxn o3iadlm umnvs;u)aleoxfctatlp r ieol()t2xmir iudol elfet s)srrm(m ou4olto ocils s ulnvsnt0 exnmrctotoatr neil()srum(o3oodlp emfcta( arrrum ;u1tpxnii3tlsfa rln snu0trxnmo iytfm   ivs;( texr(rpou4oltemfesa()a2umxm ;u0oeeo ieilt a2uanvs;(0 lxnxr oodfpteln s (  2xoim3oo1lpe  nciasfsDrax poo4open f3ildfa rl(vo;u4trtrio iodoa e u ols) rum(o oodaltnlivsa(fa2raur no4altnio3ild s rauvp;() lxnmfcoydfmtelnes (0 ruo(mpiodopt lnvta( srtrxmoot4aptnmicild a2ul( s;(0altnxo3iydoa rlnvi s seuo(mpnu1ll  licta(fa2ur(rooo1altnmiciltfa ul( pnu0artrxrcto1oa   n o (0tetrir no4lm nmivia(f Drmu  nu4opx  f3iadlaDuln p u0texrmf3iatomDe uei;t0 etrxrpno4ome  fetl(f Dtm(  nu1tleo icildfa el( s;t0alxoxf iytfmDeliei ()teto(o ou1amenlfvias)sDtaurp;u1ale  o3tysfm2um(vs u)texnxf3iydlmD  uei () euoxmpoudopeelfviltfsrrmx pno0tle iieiys a rmnvs t4artrxoctodoa  lu il(  2xr(opoudap e fcs tfaDua(  nt1oetoiiciadla2eluvpn(0 exoif3iydoatr u i t0 etoxrpoo1om nmivs (farrmx o;o1tpt mi3ild a rmn sn()tlxrmr3iydlpteauvslt srumxmpiodole mnvsa()aDrmxmpot1olxnmfeiysla uau s;t0alxnmr3tytfaDeai s;s0srtmio3oudll n ncsa(fa2raxmpnu1opto iciyslsDeau sn(4 exrxf oadoa e u s t0seurxrpio1am nlfvias a2uax  oo0tpeomoeiydla2emnvo t4 rtoifciatlmDe ies t  2xm(r oy1oltnlivtatfs2raxro;o4apxo o3iysfa2rlu o;t4 renxrcto1opteauvs;s texoxr nudap   fvia()s2rmx onu4apxn oeild a2em(mp;()tlxrxo3io1fa e nvi;s0trxo(m nodapenlfes tf 2urur ;o4olen fciysfaDran s t4texomo to1fpD  ues s0sruoxr iudap emfcia( s2ur( o;t1altn f3iad s uauvp t) ltnir todomD  n i t0 rurxo ou1olenmnesa(  Dtaxm ot0oex moctltfs2ulnvo;u0alxnifcoa1optrlueil()t2xm(r ny1lptn nvi (faDrr(rono1aet mo3tysfmDrlnms ()teeoxfcoytom eauvo ( trxoio3ou4lp  micsat sDrmu  nt4oeenmo3iatla2umuvs;u0 renxf oadfm  aueol() rtmxo no4alte ietlt  2rmump;o4tltomi3ilslmDua(vp;u)alxrmr iy1lm rai o;s) euriopoo4alt mnvslsfs2ra( pot0aee ioetatls ra(msnt) lxomf3ootlmD lnvo;s) rtrim oy4amtemicia() Dra( o;u1tlt  f3tldfa2ea(vs;t0texrxr iytlpD  uvil(  eumir3iodom nlnvslt a2ta(rp;o1oeto fetysls2eauvon(4arenmf oo1fate uvi s0t2urirpoy4lpeelncsasfa2raxmono4tpto f3ilsls2em( sn()altrif oatop rlieo;( trxoxm3ou1lle mfetasf rua(rpnu1ape  octytfs2ranvont4alerxfciodfpDrli s;s)t2urxmpoodamtnmivta( sDtmu ono1tltn f3tydfs emums;t0aexrifciydfpD anei;(  eurxo nudomen neilsf 2umxr ;t0aexoii3iatfaDuau p;t4alxrmoctydop r nvils)s2xmir oo1omeeliet t  2rmxrp;o0tpto ietlsfa2elu pnu0 rxomo todlpDrlivs s s2xo(r3nydlmenlnvs tf Dtrxront1open ieiltla emumsnu0arenmr3oodop eaieo t) eum(m3iydllt lnet t)a2ra( ooo4tpt mfctldls2emnvs;(4 reomrctodoa rlnei ()t2xm(m3nudapenmneil(f 2taumono1oeeo f3iasfa eaumont0 eerxo oodomtraueo t)trxr(m ny4apeelivsls)sDtaurpoo4ale iieiysfm emuvpnt)arxrxfcoodomD  ieil(0setmio ou1optnmnciltf Drmx poo0oex  oetatfs elumo;u0treomr iotfatelivols0 rxoxr3iydaltelictlsfs2rrxm ot1aet io3iadlaDelnvp;u)artrxr tadlpDeluei;t)t2tm(r3nu4ap nlfei ()s2taxrp;u0ape if3tld mDeauvpnt4aexnmf ia1opDelueol( trxrio nu4amtemfviat)aDrr( oou0tpt mf3iltls2rm(vo t0 rermf oydoaDraiei (0 etm(r ny4amt lnci ( s2trx  ot4olt  oetlslaDua(mo;()trxnxr3iytlp eai o t0teurimpiy1al nlncslt) rrmx oot0apx mf3ilt s2em( snu)aexnxfciydfatr ivo t trtrir3oo1omtelfci (f 2rmu  oo1oetniieiadls2uaump u4 leoif3todfmtranesl(0 2xrio3nudapt mnetat aDraxmono4openioetyt a emu pnu0aetoxr ia1opt lues (0 rumxmpnudam  mfesas a2tr(  ou1tlenmo3iad m2rm( p t4 leomr3tydoaDe nei;t)s2to(r oydolt lnvs tf Duaxrpou0tpx if3tasfm eanvsnu4artrxf oydfa rlnvs t t2uo(o3no4ome  fvsa( srua( o;t1tpx mietysfs2eauvp (0alxrxoctytlmDrai s s teto(m ou1opeemfct (  Drrurono0tet mociltlm ul(mp;(0artoxrcoadlm elu o (  rurxrpiodaptnmiet (  2uau  ;o1tltoiiciltlm eaump;u) eeomo oy1oat lueils) rxrir3nudll   iesls)srrr(mpnu1tptn fetasfs umn s t)tltrmf3ty1lpD  u i;t0setmim3ou4ole  net ()aDtaum oo1oeenmfeilsla rmnmo () rxniociy1fm rli ilt0s2ur(rpoydlmtelnvsl() rrmur no0tlxomi3iytfs2umumpnt0teermr oa1lat anei s t2uo(o3oo4lm elncslsfa2rrx pot1oetnmfeiadlm rau o;t4aetrifcio1optrauvs s0 eumxr nodlpe mies ( s2raurpno0tptnioctatls2ua(vont4arxomo oodomtrlnei s)seurim3iudlp e iviatf 2rr(mpnu4apeoioctldlaDea(vo u4 renmr3ia1opDranes s0 2tm(mpiy4amtemfciltfa2ta(rpnt0altnmfeild m el( pnu)alxoircta1lptelnei;t) rurxm3nydlpt mietls artm(mpoo1optnmociat m2rm( p u0trermr3iydfatr ivi s  etoirpou4am n ivilt) rtau pou0apx ioeils mDum(vs t4arxnmfciodlpDe i ils)s2xrxr oo4lm e feslt srrauroot4tpxoiictatfs rm( s t4 exrifcoadomt aueo (0 eurxm oo1lptn fvsat sruaump;u4tpxn f3iatfm2rmuvsnt)teenir3to1fpDr uei;t setoxo oo1am nlieia( artmu p;o1olxoiieils s uln snt4artnmr todlp raivol(  rxrxr3oy4alee ivi ()sDraum ou1alx iociys sDrl(vp;t) exnxocty1lpDeln i ()t2xrirpnudll nlncs s) 2tmx pou0aptnif3iydlsDuln pn() leomo oadomD  ieo t srxo(r nodllenmnvi s artm(rono1altnmi3iydls elnmonu) ltnio iotoptraivols) ruoir nodale livsas  rrm(r ot0tlxnmf3iltfs2el( p u4 rxrirciadlmDraieo;t t2tm(o iodlm n ivt ( aDtaxr ;u1tpx  f3iyslm2emn snu4trtomo3oodlptrauesls0 rtrxopiu4olenmivslt a2uaumpno1opxn iciat a2uln pnu)tlxrio3ootomtraivo;( s2tmxopno4amtnmnei (f rrr( pnu4tlxo fetasla emu s;t4trenmf oo1lm eli ols0srto(r io1ol   netl( s2umurp;u0tpxn oetytfa uan s;(4altoio oa1lpteluvi t  etmxr3oy4apee fvsasfarrrx pou1opeoifeilslm rlu snt)arxnifctadfmD lueo;() 2xoio ny1lm elnvsl( s2rm(mo;u0olen ociydls2rln p;()alxomr3oa1lpDr nvolt) rto(m nodome mieia()arur( pot4tetn octys m2rl( snt)trtnxo iatop eauvo;t)t2trxmpoo4lm  mieiasfsDtrx p;u0olt  oeilt s ulumo u0aetoio ty1fate i i ( setr(r3io1optnmfei t  2taump;o1aeeoifciyt s2elnmont0alxnir oodfm e i ol(  2tmxm3iy4am e fet tf 2uaxrpno0oee mictltlaDumnmsn(4 rtnmr ty1optr neils texoir nudlpeemivsasfsrra( pnt4oexn i3iys aDum( p ()trtnxf to1omtraiei (  2toimpiodlm  lics (f rta(mpot0tpxnmoctyslaDranvo;(0 ltrmr3oatfat aivo () rumxm3nydolt mnvtlt aruru p;t1oexnioctaslm2uan o (4aeeoxo3tadom eaivi;(  rtmirpno1oltelneiasf 2ua(mpnt1texniictytlm emnvs t)aexnmr3iydoaDr nvol(0trtoxo3iy1om emnvsls)a2rru  ot4tleo ictlt mDra( pnu0texrxocoa1lmD  u o;t)teuoxm3iydal nlfeias  rurx  ;u1aet moctls m2ua( on(0tltrir3ty1lateau o;t teto(opiodlme lfvias)s2rrumooo4tpxnioeiysfm2emn o t)tltrir3iytoa eaiei;t)setrim3nudlmtnlfcsl(fs2trxm ;u0tpxn o3iyd sDua( p;t)aexrxo3oadfptr neols0 euoxm3iy1olt  neia(  2rru o;t1apeoiietls a2rau snu4 etnmfcoydfp  auvi s)tetriopiudlmenmietatf Durxmp;t1olxnmo3iadlm2elnvp t0alxrir iodlpD lueolt)teumxo3oy1ole mivsl(fsDurx  ot0tex  icilsfa2ua(mo t)aetrir todfmtrlieo (0truoim3oy4lltelivtls) 2rmu poo1tptnifeilt s ea( p t) rxrmociadomtraivslt0 2tmxo nodalt mnet sfarururp;o0alt mi3iytfm2raump;u0tltrmr ty1omtraies;()trxoimpiu1olt  ivil( a2ta(r nt0alxo ieilt a ulnmp;u) leomrcoodla e ivsls) rxmir3oydaleelivsasfs2tmxrp;t4olt mi3tltfm2ulnvpn(4arerxfcty1oatrlnei;t0srur(o io4ale  nvtlt) rtax  oo1tee miciys m2rmumpn(4altrioctatfptranei;(0 2urim3iudop emneias)srrmxm nt0tet moctlslm emnmsnu)arxoircio1lpDe n o ()tetr(opnodale lict s sDrrurpnt4ape mo3tasfaDra(mont4altnmocootfp raueilt t2xr(r3oy1lmtn icsls srrmu ont4aptnii3tad a rm( s ()areoxf tydoaDrluei;t)srtrxmpou4lmtemiviltf 2uaxrpot0opxn fcildfmDuauvsnu4 etnmo iadla rlnvs () rtrir3oy1aptelnvils  Dtmxro;o1oleomf3tyd mDelu p;(0treoxf3tadopD  ivs (0 2xmxrpnydlmtnlfvia(  rtaxroou1optomfeiytla2ul(vs t4tlermo iydlm eli o;t  2trim3iydlpenmies ()aDumur ;o4alenifctlt m2emums (4tlxomocoydlaDrauvolt0sexmim3ny1omtelfctasfsDraur nu1tltnifeiytlm ea(mp;t4tlenxrcia1fa eaivols0 exoxopio1ol elnvt sfa2tru  nt0olt iociltfaDraump;()tlxnmrcta1opDe nvolt)s2uo(opno1ope miciltf rrax  ;t0opxnmo3iys sDuln pn(4tetrxf oatlateanei s) etmio nudlp emieia()sDtm(r oo4aeenmocilsfs rmuvs;t4altrxr3iotfpD anvi;s)teto(o3io1apee ictltfarumur ;o0tleniociyslaDum( p;u)arxnmf iadlaDrln ilt0setm(o3iodomee fcsl(  Dtmxrpou4tpeomociasfm rlnmpnt4arenxr tytfaDe ues;t sruoxmpio1omte neiatfs2ra( ono4oet  i3tys s umn o u4areomo3totfp  lues t tetrxo3oo1lpe  ivtlt)sDua(mono4tltn o3tlt mDrlumo;(0artnmr iotlpD lieil( srumiopou1llenmncs (fs2trx  ot1apxo ietltfs uanvp;t0 eerir3oodlptraiei s0 2to(o3ou1om  mfesas s2ur(  no1aexoifetytfs ea( o;u0aexrmoctatla eau ol(0teuoim oy4am   ivi sfsrrr( oot0oexomfciydlmDrl(vo;(0 lxomf ty1lpDrau s s0 2umxo no4lmtnlnes (fa2rr(rpnu4tpt moeiyslsDemnvp (0aeeoxfcia1omteli s;t0 eumxr oodameemfvtlsf 2tmxmo;o0opx mictasfa rmu p t0artoir3ta1laDr ivi t s2ur(m nodlpenlieiat srurxrpnu1tltn fctysls2rl(ms;u4aetrmo3tytlaDe nei;t0 2um(opiudap  micil(  Drmxrpnt1olxnif3tysls2rmn s;t0aeenio3iatfm rlu i;s0sexmirpny4ll emfci t)sruau pno4olxn oetasfa2rau on(0 eerxr ty1fa  aneolt0tetmim3nudoltnlnes s)aDururoot4oeeo fctydfaDumump u4tlenif3oodlp  aivo;t)srxriopiodllte fvsltfsrta( pnt4oex ioetlsfm uluvo t4 lxnxr3oy1omDranes;s tetrxr3nu4ame lfet tfs2tmxm ;o1tle  f3iytla elump;t0arxnxrctydfateanvils setm(o oodam emfeiltf Dtm(rpou4apxomfciydfs2em(vonu4teeoxrciydlpD anvils)t2xmxm3ou4lm nmnctltfaDumxr no1aexn o3iysfmDuanmp (0 exnxo3iatfp  anes (  2urxr3nu4lp nmncsltfa2raxmp;o4aexn i3iltfs2rm( s;() ltnxf tadoatelu o;s) eto(o iydaleelivi sfartrxmo;o0alenmi3ild sDrau o;(4 lenif iodom r n s;t seurio3iydaptnmfctls arum(rp;o1aptn fcildfa rm(vo;()alxnxr3ty1lpD lnvolt teuoir oo4opt lfvi sfaDumxr ;t4teenmiciyslsDrln p (0tlxomociytom  liei;( t2urxr3no4ap elics t) rtr(m ot1aee mocilslaDrm(mpnu)artoxr3oydop elues;t)truoxrpnodoleelivi sfartmum oo0tltniietysla2uan o (0tetnmr io1oaDeanvi s) rum(mpiu1optn fvi tfsrtrx pno0oltoifetltlmDeluvp;u4altrifciydlat ai o t trtoir3oo4amtemici tf 2tru  ;u0tex  icildfa umnmp;t)teeoxrciydlaDran i;t0t2uo(r3nodap  lnvta(fa2ur(  no4oltomieiys m emn snu0tetoxoctotfat au sls)s2umxr3ny1oltelietls)s2ta(m oo1oexn fciydla2emu o (4 reomociodfmDr ueo s trumxm3iy4lpt  iet s) 2rmxmp;o4opx  ociyt m2el( s u0aetrxf3iytlp r ueol(0 2umxr3oo4amt livt t)arumxmp;t1opeoioctyt a el( p () eeoxf oo1lat  n i;t)srxr(r ou4lmt mfes tfaruaurpnt4olt ifeiadlmDumnmonu0arxnirctytopteaueil(  euo(rpny1omtnlfesasf Dumxmoou1oleomieildfm el(vpn()aexoxo oy1lmt luvi;s)srtmxo3oo1op  mnvt tf Dtr( p;u0olxomoeilt sDrlnms;t0tetoxf3oy1lm r ueo;t) 2xm(r iu4om e fcil(f Dururpou4texnmoeiad a ulu o;t)arermrcoydom rauvi;t0s2xr(m3nu4lp nlivias)sDtaxmpot1altomo3tlslmDean s u0aetnxr io1faDrln i;s setmir3io1olee ieil(fa2tru onu1oee  fctasfa elnvo;t4trxrmo totop  aieo;(0 rtr(mpiy4lmtnlneils) Dtrumooo4olxnio3iysfa rlu ont0aeeoircootop  luvs s)sexmio iy4op eliei sfa2rau  nu0altnmfetysfa2el(mp (4 eeoxo3ia1fp eauvo;t)trtoio ou1lme mnvi sf 2umxmo;o1aetoioetytls ranmp u4 rtoxo iy1fpte uvo s s2xoir3no4ap nlfei t) Dururoot4apx  octytls rm( p u4texoxf3tydfmtr ivi;t  2tmirpiu4ape mfvt s s2rrumo;t4oet  oetaslm2em(vo;u4artrirctatfat  ieo () rxrir nu1alee nviat arumxmono1texoioctad aDum(mo;u)teeoxoctodlpteanes;s)tetmxm oydam elfctltfs2rrxmono0ope  f3ilsfs umumo u4aeermfcty1om ean o t  exoxo nu1op  mneia(f Drm(  ;o1openmociltls el(ms (0texoif ty1latrluvo s) rxo(opnodalt mncsltfarua(mooo0oexoiociat aDra( pnt0 leoxocoydfp elies;s t2toxr3ny1ap  mncia(fsrrm(r ou0olxoiiciad s uan p;u)tlenirciodlaDr u ilt0t2xmxmpiodlmenmnciat) 2umu  no0olxomi3ild a umn ont) rtomr3iadopDrln o ()seuoir3oo1llee ietl()artr(rp;o0ope  i3iad m2umnvs u4alxrxfctatoptelneo s0 rumxm no4ol e nvs t  2rax pnt4aleoii3ias s2ranvo;(4tltnmf3tatfmDrln o s) ruoxmpoy1openlicsl(f Dua(r no0texoif3iytfm2rmnvs u0 rtrxocoatfpDeaneo t)srxoxmpou1al  lnesltfsrrax  ;t1tpen o3iysfa rauvpnt4 ltnxf3ty1opt anvs (  etrxo3nu4lmtemncsasf Dra(mpnt0aptnmiciltfa umnmsnt0tltoif totoat auei t) 2uoxr oy4om   fcslsfa2uaum ;u0tle mi3tyd a2rluvp;t)teeoifctytoa eauei;t0 etriopno1opte ncs sf rum(mp;u0opeo iciyt m rm(vsnu4 etoif oadopDeluesls0 rurio3ny4omtnmies (fa2taxrp;o1olt  f3iydlm umump u4 rtnirctatlpD  uei;() 2xm(m3oodll elfetlsfsDrrumonu0oeeoiictat a2raumpnu)aetrmoctatla eaiei;t0 eurirpiu1openlivtat aDtaumo;t0olt ii3ildla2ra( p;u4aeenmociatfp   ivsl(0 2xm(o3nu1lpeeliei sfa2raur no0tlxn i3tyslmDel(mo u4alerxo oy1latr nes (0srtoimpnydlpt lfetl()sDta(rp;u1opxn iciytla eanvsnu0tlenmf3oatfpD  uei t0sexoim3oy4ll n icilt)a2umxmonu0tlxo fciysfs2emnvo;t4tltoifctytfmteaues ()srumxm3oodlm nmfvt (fa2raump;t4alx if3iadfs um( on() exrif tatfmtelneo t) 2uoxr no1am nmncsl(fsrtm(rpnt0alt iocildfm2uanvs u4 ltrircoydfpDraiesl(0 rxoio oy1lltnmictl( srtr( oot1tpto f3tasfm emu s;(0teermo to1op  auvi;t t2xm(r3iu1lpeelicsls)arur(r ;o1aet ifetat a emn o (4tlxomoctatomDrlu s s t2trim iy1lm n ncs s) rrm(root4opxniictld sDuan o;u4 rxrif oo1oat  u i;t)texoxr iodome miesa()sDrmxroou0apt  ietadlm eln s;t4 rtrxo iadlm ranvs ( srxo(o3io4oltnmfesat aDuau  no0ale ii3iysfaDelnvs;()trxrif oodfatrlneo;(  euoxrpnudlm emfcta(f rtax o;u0ale iociys m uln pnu4texoxo3to1opDeaieo t0srto(opiu4op  lfci tfaDrrx  ou1tlt  o3ild a2uau s u4texoxocia1fmD li o ()teumio ny1aptelnet t  rrm(mpnt0aeenmo3tls mDulnvp (4areomf3tadomDr u s;t t2tmio iydal  lictls)a2rm(ront0aeenmo3iydla rl(vsnt0trxoxr3oytopt  u i;()srxmxm iydal nmneiat) 2taur nu0teeo f3iys mDrlump;(0 lxomf3oydlm  ai i t0trum(rpio4omenmncil(f 2umx ono1apx mfeiysfa2ra( p u)alxnmo iotlaDelneil() 2umimpio4ol  lncsa()srtr(r ou0texnmocils a2emumpn(0 exrxf iodfat  uvs;s) 2trxm3oo1om  mivs tfs2trxr ot0apxnifcias aDra(vsnt)trtrir3iodoatr nvols)srtoir3io1alt  feilsf 2rmx ono0altomoeiydlm ran s;u)trxnir todfmt anei s0teuo(o3ny4omte fvs (  2tmumoou1tlx mi3tadfs rlumpnt0teenio iotoat ln i;s) exmxm io1oleelietl( a2um(rpno0apx mi3iadlm2umnmonu4alenxf3totfmteaieo (0s2xoxm3iy4ap  mncs t)arur(r nu1aptomi3ias s ra(vs;(0aetrifcoytlpDranvolt0sexmxopiudop e ivsls arumumpnt1oexoif3tat s2ea( p;() lxniociadfmt ln s ( t2tmxmpny1lm   fei sf Dra(mooo4oee moctlsfa2rln s t4 etoxoctytomte i o s)srxmiopoo1ape lncia(fa2umxro;u0aptomf3tadlm2ra(vp;(0aeeoif3to1lpD  i o (0s2ur(m3oo4ole  ncilt) 2tru o;o4oex mo3ias a ea( s;t4tlenxf oa1lat lnesls0t2umxm3nodam e ieslsfs2uaurpou0aee  feiadla2em(vs;(0teenxf3iytfat  uvi s0trto(r3no4aptnmnvs () 2uau p;u1aleoiieils a rm(mp () etnir oy1lpD  u i;t)s2xmxr nudamenlnetat) Draxm no1tpxo feiyt s eauvon(4 reomf oa1om r uvi;s0 ruo(rpou4om nlnvt (faDum(r ;o4alt  ietyt s2ran snu0 ltnmo3ia1lpDr nvs t)sexmxm3nu4lm   feil( s2uru ont4oexnifetadfa eanvo (0 exrmo3oodfat lnes t trurimpoydolee nvs t a2trumoot0tpenmo3iltfaDuan s t4texnmocty1omt  ivols t2tmxopoo1llt liesl(f rumxrono0oexoifciysfm2eanvonu4 etnif oytlpt  ivils  etrxopoudom nmivsls srra(  no4aptn icild s ulnms;t4 renxrciydfpD ai il(0t2urxm no1op n fcs ( arur(rp;u0tpto o3tatlsDrmn o (0arxrircoatfate ieilt srxm(opoy1alt mfetatf rtaxm oo4ale  ieilslaDumnvsn(4arenmfcoytoate ivils srto(m3oy4am emictls)arur(mpno0aeeo fciat m2uanmp;u4aetrxr oatopD aiesl( srxr(m iodlltn fetat  2trxr oo0ape  f3ildfs rl(vont4alenifciydfpt  u i;( s2toio3oydal elfvsas)sDtaxr nt0ape  fcias m2uauvp u)tlxrxo3totop  anvs t0s2tr(o3nudlmt mivs t)arur(  ou0tpt mfeilslsDumuvp;(4areoxr3tydlaD  ues t  eumxo3iy4opt  fes (f Dtr(mont1alx ifetatla2elump;(4aeenir3ootlptraivolt t2ur(m iudame  ivi s) Dururpot4apx mi3iadls2ea(mo;t0aetrir3iytfpDr ues;()teur(o3oy1ap   fvta( s2ra(m ;t0tpx  iciatfsDuan pnt4 ltrio ty1lpDrlieo;s)trtmirpoydapenlncs (fsrraur ;o4aleo ieilt mDrl( s;u4 rxniocia1faDeanvi t texo(o3nodap   iesa(faDur( p;t4aetoifcild m2ranvo t4 leoxo io1oa  anvsl(0srumir ny4ope mfctlt  2uaurpnt4aeeoifciytla rm(ms;t0 eeomr3tytoaDranvs t srtrxr iy1lp n net s) 2rrx pnt4tlx mo3tyd m2em(msnu4treoio ia1fmt au i;(0t2uoxmpio1aptnlneslsfsDrrxmp;t0ape ifetaslaDum( pn()tlenmf3tydomDeai s s)s2xr(r3oy4amt mnctlt  2tmurpno4alx iictaslm2eanvo;t0trtoir tatlm  liei ()srtmxm iudol   nvsls)a2raur ou4apxoifetasfsDemuvp t)arxrmrcta1opDeai i t  exmxm oy1lmenmneta(  Dum( o;u1tpe  o3iyt s ulnvo (4aexnxfciadlmtrauvo;s seurxm iydll nlnvias arur(mp;t0tltnio3ildla2ra(mpn()alxnio3iytfat  n o;t0trtoirpnu1lmtemfesat)s2uax onu1apt if3tld m ulnvp;t0tlenxr3ootopteluvolt) rur(m iu1lpt lnctls)aDum( p;u1oet ioeilsfm2emu snt4altoir tatoaDelnei;s texrirpoo1alt  ncsa(fa2tau  nu0oltnifciytfaDuln s ()tltoio iadlpD  ueil(0 2urxopiu4lp n ncsat)srrmurpot4tltomociytlm raumpn(0aeerio3tatfa ranvslt0sruo(r3nydlm   fci sf 2urump;t0olenmi3iyt s2rmumpnu0 ltnmfcootlmDraiei;()tetmir oo1om  lfvtltfa2uaxrpno1tet ii3ildls2ua(vo;u)aeerxocoodlm rlnei;s  eumio iudlpeemfvs s) 2rmxmonu4tetoii3iydfsDulu pn() ltrxfciodoaD  uvs s0trxmio io1lmt lfvilsfaDtaum oo0apto fcils a2emu o t0aexnif3tatfpt  ues;s teumir iu1lmenlicsat a2uaxr no0teen f3iadlmDrauvsn(0aetnmfcia1omDe u sl(0 rtr(m3iy1amtn fvsas  2rm(rp;u0aetoiieiys m elnms;()alerircoatlaDrli o t  exm(r3iodomtnliesltfsrrmurpno1ope  ieiyd m ua(vont4 lenxf oo1lateau i s)texoimpio1ale lieias a2taur oo1oeeo i3ild m emuvp;u0tleoxf3iydopt livolt  2toim oy1lmt  ncs t)a2rru pou4aetn i3ilsla ran o;t4arxoxf3oy1lm e i s (0s2tmxm oudlleelneilt)srtaur oo0oexnifciysfmDum(mo (0trerxocoodlptr nei s) rxoim oydlpe mncsa(fsruau onu4aetniieildlm2ra(mp;u4 rtoxociotoateanvols  2tm(r3oo1apenlict ()arrrumpoo4oex iieiydls rmu p t4texnxrciatoate nvi;s trxo(opio1ome lncta(  Dum(  ;t4opxomieiadfa umump;t4 etoxf iytlmt  n s;s0trurxr3oo1op   nvt ( sDtr(r ot1ape  fciydls eanvs;t0 exoxr iatlmtr iei;t0t2urio io1ol  lneia( s2um(rpoo4tee ifcilsfaDuaump t0 etoxf iytfpDe uvs;t srum(opio1lm nmfeiltfartrxmpnu1oeto f3iydfaDuauvo;u4arerxrciotfmt livo;t0s2tm(r iudamtnmfci t)sDrr(rpou0oet ii3ilsfmDelumo;u4aeenir3iydfm  an i t0trxo(mpoy4op elici t sruaxrp;u4opxnmoetys mDumn snu4arxrmr3iy1op  livi t) rxmirpiudam emicil()arrru pnu1tpe miciysla2um(von(0aetnmo totlp eanvilt0 ruo(m nu1op  lnet (f 2tm(mpno4tptomocilslmDrlu s t)aetnxr3iodfptr n s;s sexmxm oy1omen fvilt)a2uax o;u4altomociatlsDumumsn(4 eerxo ta1lmt auvslt seurxo no1opte nvsls s2rmu  ou1tetomieiatfs2rmnvs;u) renmoctatomD lueo t) rtrim oudll emfet (fa2urxmpoo0apx mociadlaDrmu o;t)aexoir3ia1op e i o ()texr(o iudlle  fvi t)arraxr oo0tlxn oeils s ra( s;u) ltnxr oodoat aneo t0 euriopio4lmen ivtls a2ta(ront4oetn ieiadfa eluvpnu4 renmf tatlptran ols0t2xmio3ny4llenlfeilsf 2ua(ro;t0oltnmoeiytfs2rm(vsnu0teeomf oytfp  lu sl(0sexmxr3oodlmtn fviasfaDum(rono1ole  o3tadfa ran pnt4areomo ia1op rlues;() 2tmirpoy1llt mnvils)s2tr(r nu0openifciltfm ul(vo;t4 exnxf ty1opte i i;t)srtoxo no1om n fct ()aDtm(ro;u4opeomi3iasfa em(monu4areoir3tadfat luvs t)trumio3io1openmnvtl()s2ua(m nu0aetoifctldlsDea(vpn(0 exnxocoodfa e neo t teum(o oodlmeelics t)s2uaum ot0apt iociys s eanmp;()aeeoxf3iotlmD aiei () rxrxm3io4amtemneia()sDuax ooo4tpx ifetyslm uln pnu) rxoiocoytfm r ieo s)tetrxm iydol   ivias) Drrxrpnt0tetomfciltfa2el( sn(0aexrmocoa1fa r u s;( t2xrxo3iu1om elfvia( a2rrumooo1ope mietlt s uau onu4treomoctatoa rai ils)tetoxr3no1oltnmivi s s2ta(mp;t1aptomieiytlmDrlnmon(0artoxf io1omDrauvil() 2xo(o3iodlpenmfeia( s2umxmonu1openmoetltlmDuau s;(0aeermfcio1opDr ivo;s)s2um(o3oo4ap n nci t)s2rmxmono4aet ii3ils s el( s;t0aleoir io1lm   ivo;s t2toxopoy4olen fesl(fartrxmp;t0opxn ocilslaDuln snu4tlxnif oydom eauei t  exmxr3ny4apt livsatfs2rrxmoou4tlxoif3tytfaDulu p;u4aetrxf iydlpt  ueil( tetm(rpiydamen ncsasf 2rmu  ;t4aexniociysfm2ul(vsn(4trtnmo iy1op r ies (0 2toxmpoo4aptnmncsat  Dtau pot0alx  fcildlm2rln o t4arxrifciotlateaivols)tetoxr iu4ap   nei s arrrx  ;u4oleniieiytfmDuanmp;t4aleoxr ty1fa r uesls s2trxr3nodlptemnvil() rraurpou4olx ioetltfs ua( p;u) exnmrciydomte neols) rtoxo nu4amtemnetl(  Dur(monu4aet iociytla emnmo;()texomo oydlpDrlues;s t2uo(m io4openmieta(fa2tax  ;o1tpeo o3ias mDuan s u0tetnmocio1la rluvs;()teur(o oydlp nlfet ()aruau  ;t4ape  i3ildlsDulums u0tetrxr iotfaDeliei t s2toio oodllenlnvil(fsrumx  nu0ope iietls s2uluvs (0aeenir io1opte nei;t)srtoimpoo1om nmncilt) rum( o;t0olenif3iasfa eluvp t)alxoxfcty1omDrlnes;s) rur(opio1ame mivil(fa2rm(mp;u0aleoioetlslmDua( pn()artoifciytom  luvo;s  2trxr oudap nmfci s  rrmx p;t1oeeo ociytfsDeau snu4tlxnxf3iatom raivi (0s2tmir ou4llt lfcsltfsrrmu oot1oee ifeildlaDum(vo;(4teeoir iy1la  luei;()seurxopnydolenlfcta()arumxm nu4tlt ii3iysfm ulu on(4tlxriocia1lmD luvo ( s2tmxr3no4lme livtlsf rrrxmo;o0opeo ictasla umums u)aeenmrciadla   ieols t2tmxmpiudopt lneia( srtr( pot4oexo ietld s umn snu4aexrxfcoy1lmtelieils teum(opoo4alt  ncsatfaDururpnt0oeeomoctat m rln o;(4altnircty1oaD luvs s0sexoxmpny4ap  mfcils)a2ra(rpnt0oltomiciyslm ulu o;t0tetomfcia1fa rlivs;t s2toimpio1apte ivt s)artrxrpot0tpeoiiciasla uanmp t0tlenxocoytlat lnvo;s) rtrim nu4lm  livsat srrax oot0alt iieiat s emnmp;u0texomfctadfmD lnvolt sexo(r oy4llte nvslsf Dta(moot4ole mietltlsDuanvon()arxnmr3tatfm r nei;t) 2umirpou4alenmfcil(  2raxrpoo0tptomo3iytfs2elumpn()teermf tadom eauvs;s srum(o3ny4lpt  neilt arua(rpnt1tlxo octytlaDuauvp;u0aetrmrctodfatran il()s2urio3nudlle mneiasfs2rr(rooo4apx iieiltls2em(mo t0tlxnmociatlmtrlu i;(0srur(o3io4al elncta( sDrrumpoo4tpx mfeiydla rm(mo;u0trxoif oadom elnes;t0texoio3iydopeemivslsfs2urxm ;o1apenif3tys a2uln on() lenxr3iytopt li i t s2xr(m3ny4ol  mfvta() Dumx  ot0teeomociydlaDrl(vsnt) rxrxoctotfaDrai s;s)teum(m3oy1aptn fcils sDta( o;u1ole io3iadlm2ran p;u4teermf3oodlaD  uvil()sexrxm3oodalenmfeias  2rrxr nt0aetnii3iad sDrmn pnt4aexrifcto1fat lies;( sexrxmpno1alt lieil( arua(mpou4oleomietatfs ra(vs;(4aexoircia1oa r ieo;s0tetmxrpnydop n netl(f rrrx  nu1tlx mfeiadfa2raumo;(0tetnxr3oy1fa eauvs t  rxo(o ou4am n ivilsfsDtau pou4alxomictyt a rluvsnt4tlxoxociodop  luvs t  rtrimpnodlmte ieils srrmurpno1oltoif3iatfs rln o t4trtnxf3todoa eluvs s t2xo(opno4apen ict sf rua(rpnu4apxnioctlsfsDemums t)teeoir3tytoatr n s ( trtrirpio1ole  fes () Drax pou4oexo o3iad m rmn s;t4 reomf ta1fat lues (0tetoxo nu1ape  nvtl(  Drm(moou4apenmf3tyd a ul(vs;u4altoxo ia1om   ues s0 rto(rpnu4ol nmicsas  Dum(  ;o1opxo f3ildfa ran s;(4alxrmf iytlpDe uvs ( trtmxo3oo4olt lnvt t aDtmx  ot4apx  fctltlm elump;u)trtnxr3iatfaD lieo ( sexrxrpnudop emfciatfsrumxrpnt1tle iieilt s rau snt4aetrxf tydfm   i o ()s2um(m iy1altelieia(fartrx  no1ope ioctldfs2rlump t)trxrirctotlm eaues t trtrir iu4ape  fciat)sDuaxr nu4aptomo3iltls2umn s;u4tltriocty1fp raneo;( t2xr(mpou1omt lnesls) rra(rpou4tex  fcilslm ulnms u0tetrmocootoptean s t0 rxrxmpiu1optelivsls)arua( pnt4texnmfeiad s2rm(vp u) etoir iodfpDr u o t seuoxm iu1am  mncsltf Duaxmo;o1apeo o3iydla ua(vp;(4tlenir3oa1fm  lu o;t) etoxm oudlp nlfcs s)srrmxmonu1oetnmi3tas mDua(ms u)tleomo3totomDrai olt0seto(m3oy4olee ncsl( a2ta(r ou1tlenmfctat aDuau s u0texnxr3iodfpDr nvo t0 exoxo3no1lmtnlfvslt srrau pot1aeeoiiciytlmDrmu snu0 rerxo3oadfaD ln i;t0s2xo(o3nodlmeemictat sDtrxmo;u0tleom
\ No newline at end of file
@@ -0,0 +1 @@
+ivi;t s2xoio3io4lp nmnvt tfarrr( ont1tpeo fcild a rmumo;()trtoxr todfatr nvi s teur(m no1amtnmietlsfsDrmxmp;u0tpxnmfctyslm2emuvp ()aexrio oy1lat luvi;(  exo(r3nydop e ivil(  Dtmx  ot1ale mocilsfm uaumsnu)teenioctotlat livi;(0setrxm3iudapee nvils)arrmu pot0teeo fctat s rmnvs t)teeoir totom rlneo s)srxoimpoo4amt mnvias s2rr(  ;o0tpt mociyt m emuvsnt)tlxoxfcto1fm   ieol( trtm(o3iu1lmtemnvs s)srtmxm oo1aeeoioeiydlmDrmn o u)tltnxr3tatlaDrluei;(0tetoxr3nudolenmnvilt)sDtau  no4tlt  oeiys a2ea( p u)artrmr3iy1fat li s ()trumxo3oodlmt livta(f 2rm(  ou0aleo i3iytfm2rmnmp;t4 etnxr3ty1fa   neolt  rxrio io4amt  nct tfsrur(mo;t0optnioetasfs2rlnms (0 reoxr3oytop elnvo;s0 2tmxm3iy4om emnesl(  Drru pnt0tetn iciltlm2rmnvpnu)artrmr3ia1latr ues;s)t2umxr3oy4al e ivt ( s2rrurp;o1teeomfciyt s2em( s (0teenxrciytla elieslt0srxrio3nydllt miciat  2uaum ;u4alenifeiydfaDranvpnt0aetnif iydfpt aneo;t texmxr oudllee fvs ()sDrmum nu4apt mi3ias m2ulumo;(0 rxrmocoy1faDe u ils)s2tm(o nydop  lnetat)s2tr(mono1aetoifciltfm2eln p t0aeenioctatlatr ues;t0srxoxo iodaptnlnvs sf 2raxmpno1opxn octydlmDumuvsnt)aetnxo3oo1lmDe ueol()t2tm(m nydop  lieil( srtaumoot4tee ioeiyd a2rm(mo;u0 etrxf3ta1faDe ues t t2trxo3iy1ol  liviat sDraxrpou0oleo i3iltls2umnmo;u4tltrio3tadfmDrauvi;s  eto(opoo4olt lnesl() 2tr(mpnt0apeomicilsfm2ea( o (0tlxoif3ia1fatr ueils teuoxm3nudal n fctls)sDtmx onu4tpe iictatfm uln o;u4tleoxo oy1omtranei t  eurxrpnu1llenmietls s2tax ont0aetnmictasfa ulu s u4texrmocoatomt lues ( trto(m3oy4al nmnet () Dtaum oo1texoio3iysfa2emn snu4 ltoio3todopDrau s;t)sexr(opoy1lmee nvsatf Dua(mp;t1ape io3iasfm ua(ms;u4alxrxrcoa1oat auvi;t  rtrirpiodlmte fvs s)artr(rpno4aptomo3tlslaDea( p t4tlxoio3to1lpDe ivo;t  etoio iodalenlnetl(fa2trx ooo0optniiciysfm2umnvs t)trenxrcia1fat anvi;t  exoxm3oudap emnvt (  rrr( pnt4opx if3iytlm umuvo;u0 ltnmr3oo1oaDeaies;(  eumxopiy4olen fcs tfs2tm(rpnt4oeenii3iyt s2rmumo (4artoxr iotfpDean i;()setrimpiudamtnlnetlsfa2ra(r nu4optomf3tld a ea( onu) reomf3ta1laDrliesls s2tr(o3ou4lpen ivia(fsrrax poo0apt  feiytlm2um(vpnu4tetomf3oytoaDr ieo;s)t2xrimpio1lpee ncslt)aruaxmooo0texoifctlsfmDemu o;(4 eenmrcty1fpt livi (0trtr(o no4lmtn ncsat  rrrump;t1tptoiociydfmDranmo t0teermrciodlm   nei t0t2urimpiudopee fctltf Dtm(mo;o4apeoio3ilsfa ua(vs;t4tlxrmr tydlp  liei;(0srxoxo3io1ole  fci t sDtrx  ;o0opeo o3tlsfsDuanms u4teenmr3todlaDe u s t0 2xrio iydal emiei s)aDua( pnu1opt  fcias a2umn p;(4 reoif oytfp rau s (0 2xmxo iu1llee ici s)sDra(mpnu1tlenmi3ilt aDumumo (4alxnxo iydomtr u sls0seur(r3ou1alt mieilsfs2urumpot1oee  iciadls rlnmo ()tetrmr tytoaDraivols)tetrxo3oo4aptnmncta(f 2uax ont1tpeoiieildfm um(mo u0 rxoxociotopDelueols sexrim3iodom elnvslsfa2umx oou4oee  oetatlm2rl(monu0 renmo3oadomDraieo;s0srtr(m3oo1ap  mfet tf 2rmx ont4oetoio3ils m2eluvsnu4 etnmf iy1fp rai olt0seuo(r3no4al nmfcil(f 2ra(ro;u1oeen i3tysfmDem(mo;(0 ltoxrcoadlm r i o ( t2umxrpiy1optn fcs s  rtmu  oo4aeeomo3ias sDua(vp;()alenircta1oaDrluei s)t2tmio nu4lpenmfeiat) Drm(m nt1tex io3iadlaDemumonu)aexniocoytfaDrln ol()trxmim nodopee ietl() Dumxmo;u0tpxn i3iys s2emn s;u)tetomr iytopD  ivols  rurxm3oydlmt mnvtatfa2tmumpnt4ope mieiytls emnvpnu) eeoxrcty1fmDeli i;t) etrimpou4om n nctasfaDtrxmp;u0tpt iieiltfs umnvo t) rxrmocoo1lp  aues;s0texo(m3oodameemfvtl( aDumumo;o1alt  ieiat sDuanmp;u)aeeoxfcoytfpte u ol()seuoir3iudllt mfvsat) rtau ont0tlt iiciytfm rmu p;(0 etnmf3oydlp rli ols0texm(r ny4alenlicslt artrumpnu4opt  i3iad a2rluvo (4aexoxociy1om  luvi (0seur(m ou4lmenlfctl()a2rmu oot0ape  i3iytfs elu o u0 eenmrctadfmD luvs ( sexrxo3nu1oltn icil()s2rm(rp;u0tlxniieildls emn p t0artnxfcoodlm  aiei t  rumxr iu4ll nlfvi ()a2ra( o;o4tltnioetysls uluvp;(0trtnmo iadoate ueils)trum(m3no4oleelivs (f rrru  nu4texoifetyt m2rmuvo u4arxoif todfmte n i;s)texmimpnodolte ivsa( aDtax  oo4aptoifciatlmDulnms u)artoxf todla e nvo ()seto(o ou1lpt mnvsasfs2rax pnu1oeenioctys a2rm( s;u4aetnmr3tadlaD luvols0 etm(opny4al e ics t)arua(m ;o1alen i3iyslm2umuvp t4aleoir oa1lmD anei;(0 euo(r oy1omtnmfeias arrrurpou0oltnmfcilsfa ran p (0tlerxr oy1lp  aiei;s  rxoxmpnydll n ivsls a2ur( ooo4olx if3iytlaDrm(ms (4tlxrxo io1faDrlivo;t0 2tr(o3iy4ape  ivtatf rrau pot0aeeomfeils s2eaumo;() rtnir3iytlaDe nei;t0 2xrio nydam e nei t) rua(ro;t4altoio3iyd m rm(ms ()teenxr oy1faD an s;s0texm(r iodomt  feil( aDrru  nt0opx mietlt s rlums;(0aetrmf3tadoa r nvo ()srxo(mpiu4lptnmnvi () 2rrurpou1tlxnmoetat aDulu o () etnir todomD lneols t2xm(m ny1olenlfetat  rta(m ;t4alt ioeiyt s2rmnvont4artnir3io1lpteliei t  rxr(o3ny1amtnlict sfsrrmx  ot1olxomoctlt mDul( p;u0alxnmo3tatfaDe uei;s srumirpou4amtn ncsl( aDuaxm no4opeoioeiyt sDuanvo;u4tetrmociy1laD  u o (  rto(r3iu1lmenlivias) rua( pot0olenmieiad m uanmpn() lxnxo3ty1fm   uvi;t0setoxr3oy1ap elicia()aruax o;t0oexnmieiysfm umnvsn(0arxrmoctydomtrli sl( setoxr iu4apee ictls sDraxrpnt4opeoiociltlm rmn o (4alenmo ta1latrlivi t0t2tr(o3iy1amen fctat) Dtmu ono0apxoii3iys a emump;u4tlxoxrcoydoaDelivs s0srurxm3iodapeemfvs s  rtmxmpnu4oet mi3ilsla2el(vs;t)alxomf iytfateanvols) rxm(m3ny4am  miet s  Drmur ;t0oet mi3tytla2umnmo t0tlxrio3iydoa  anvolt0trxoxrpiy1op e iei (f rrrx  ;u0olenmoetatfm rmn pnt) lxrxo tydla e i s ( s2to(r ny1lpeemnvs s)sDrm(mpnu0aleo oeias a2ua( s;(4 eermrciotlmtelueo;t)texoxr io1am elncsa( s2tm(r ;t4aeeomo3ils a ranvp ()artrxr oadoatelu s () exo(o nudom  lnei sfs2ua(monu1apeo fetat s eanms;t4aetrxr tydoptr i ilt0t2xmir3iu4amt livtlsfsrraxr ;t1openiieild s2umnvs () lenxf3oodlmD luvs s0t2xoim nu4llen nesat) rtmxrpot4aptnmfeiyd m umuvpnt) etoifciydfpD li s ( setrxr nudomtn ieia() 2umx  nu4ale mictatfmDean p u0 etnir oatfptr neils tetoiopoo4amenlfcsat a2tmxmono1tltnifeiytls rl(mo;t4 exoir3todomDraivi;(0 rxoimpny1lmte iei s srra(ro;o4oetnmo3iydfs2rlump;u0altrif ty1lpDeau o;s0 etmxm iu4lpe mnvs ()s2rr( oot1optomoeiytla2eanvs;u0altrxr3oy1opDeln sls setrio3oy4alee nvtas) rurxmo;t0apeniieildla2eanmsn(4tleomo io1fmDelueo;s)setmxo no4op nlivsas)sDrr( p;t1olenmictld m2ra(mp;u0aleomociytoat aues s0 2toxo3io1lp e nesls a2ua(rpnt1oetnmictld mDemn p u0tlxnmociatomD an s s  2xoxrpiodamen nesat  rraxroot0olx  i3iadfmDua(von(0altrmf3oa1fmte i o;( setoxo3iy4lmeelfvsl(  2trxro;o0olxn f3ildlsDuluvo;(0trxrmf totfate i i;(  eumxrpio1olen fvslt aDtax pnt1aexnmiciys sDemu onu)arerif to1lmte iei s0 2toio3nydolt mnctat  2rrxrp;t4alxnmo3tldlmDua(mpnt0altnircio1fmDelnvs;(  2trir iu4llenmiet t) rtr(r ;t1ape ifctad m2el( s (4altrmr iadomteliesls) 2um(m3ou1lptnlfvta(fs2trx  ;t4apx mieiadlm eanmsn() lenircia1fmDr ivi;s0t2urxr no1opeelfvils s2tax  ;t4olxomo3iatlsDuluvp (4aexnmf to1fmt liei s)texr(r oudap e ietlt s2urx  nu1opt micilt sDemnmsnt0aexoxfctodfa   iei;s)trtmxmpiudlm elivtas aDtmxrooo0olxnioetlt s ean s t4alxnio iadla r ues;()teumirpiy1lm  lfctl(  2ta(moot1aet iictysls ranms;()tetnio io1lmDran i;s0 2xrio3oo1lptnlfvslt)aDra(r ot0apxnio3iydfm eanvp t4alenxr ootopt liei ()texmxo3iudll   ivs t)artauro;o4aexn f3taslm umnvp () lxrmr3iadlpD lnvs;t)trur(m ny1ome mfci tfa2taxro;u4tpxn oeiyt sDra(monu)areoxo iytopte nei s  2uoio ou4lp nlnesa() 2rau o;u4tle ii3iltls2ea(ms (4arxomf oo1lmt lu sl(  etrxr3io1altn ict s)srrm(ro;o4teen octad a uanmo u0alxnmrcoa1fpD  ivo s0srxoir ou4ope lncilt aDtrxro;o4altniieiasfsDumnvo (0 reomr ootoa  aivol()srxm(o3iy1lptemictasfaDrrxr nt0tle iociyt m emumo (0 lenif iydlat au o;t0sruoxr3iudole lnvils s2tmxm nu1oeto feiyd aDumnvo;t0alxnmo oa1opteaneo;s)t2tmir nydomtn fei s srtax p;t4oet mf3ils m2umnmont0artrir ty1fmte u i s)teuo(o3nu1amte icta(  rtaumo;t4tpe mo3tldls rmnms;(0tlerxfciadfpDe ueils)sruoxo3iy4omt  ictas)srtr( o;o1openmicils s emu onu0tltrio to1fmDrau o s0s2tmiopoodlpte feta() Dumumooo1tltnifciatlsDua(vsn(0alxrio3iatlaDe uvi;t0 rtrxm no4al e ivt s sDrmx o;o4tltoiicils s2um(vsn(0arenio3tatop  aies;t trxoxopiy1lmtn ivs s a2taxro;t0olxomictls s raumsn() rxnxrciatlm r nei ()t2toxr3ou1lmtemfei () Dururoot0aet iiciydfaDul(ms t4 exomfciydfmt lieils  exoxo3iodlpt lfvil(  2tr( o;t0texoioctyt s rau pn()aeenmr tadopt anvi;( seum(m iu4omtn fcils)s2ra(moot0tlxo ociltlsDrau pnu4 leoxf3ia1fatean olt s2xoxmpoo4lmtemfvi s)aDtaxro;t0apxnmi3iyd s2rln o ()tlxrir3oatfpDr ueols0 rxo(opoudapt lieia()sruaxrp;o4oeto f3iad s ran p;(0trxnifcoadlptrli i s0 2xoxr oo1apen nci (fsDuaump;u1apxomiciaslmDea( s t4trtoxf oodlmtran sls  euoiopnydalee ivslt artmx pno4alt ifeiytlmDumuvp u4trermoctytlp e uvo (0teumirpny1al   ivt s) 2tau  nt1texo feiadfaDea( o;u0arxrmf to1lp r ueils  2tmio3ny4am n ivt t)arrrx o;t1oee  oetydfmDra(vp;(0arermo iy1fpDrlues t setmir3nu4apee ici sfsDuaxrpou0aptomfeils a2rmumont0artnio iytfmtrlnesl()s2tm(r3ou1apt liesl(  2trxro;u4alxo feiatfa rmnmpnu0tltrio3oodlmDrau s;s0 rxr(m3oy4olt mfei t) Dtaxro;o1aleo oetat aDemnvpn() rxnio3tadfp   i slt0 rurxo3oo4am nmfeilsfaDumx onu1aetoiiciatfa2rmu o;(0 etoxr3iytfaD anvs;s tetrxmpou4om   netltf rtmurpnt1ale ifeildls2rmnvpn(4 rxnio oatoa eai i;s0 euoir3iudol n fctasfaDurxmo;o4aet iieiatfaDelnmsn(4trerxo3iatfpD  u s;s  2trxopiu1ap n fetlt)s2rmurp;u0tltn ictls aDelu snu)aeerif3iodlmteauvils)t2tmiopnydom elietls) rtm(rp;t4apeomociytfa2rmumpn(0aeerif oodfmteln i () eumxm oodlm emicsasfarra(mo;u4ole  f3ildlaDrlu p u4aeenmrciy1omtraneo;s srxmxm io4ll nlfetlsf rur(r ot4aleoif3iyd m2eanvpn(4areoio3oa1fmD ai ils0 2xmxopnodlleemnvta(fartm(rpot0apeo ieiytlm rmnmsnt4 ltrmoctydlm r nvsl()trurir3iydol  mfvtas srtr(root4apenmf3iyt a eauvon(0trtnxo iytomD auvo;t0s2xrim3ou4amtelnvslsfa2raxm ot4apenmf3ias a uanmp (4 rxoif3iytlate u ilt)s2urim iy4ll   nvsl()srra(roou0alxoii3tlslaDean s u0aetoirctadfpD  ues;s0 eto(o3iy1lleelici s s2tm(rpnu0oetomo3tatfs eanvp t0artrxf3iadfpDelivi;()truoim3iudop nlfeiltfsDtr( poo0apeo f3iydlaDra(ms u4 rxomo oatlmD lneil( t2toxm3iy4amt miciat)arrm(r nt0aex mieias s um(msnu4tltnmf3iy1oaDeau s s)srxo(mpio1olt  ict ( aDtrx  nt1apt  ociyd mDeluvo u4artomf3ta1oaD li s;(0 rtr(o3iodale  fct sfsruaxmp;t4alxoifctys m rmumsn()artnir iatom  livi;t s2tmxopoo1lpe miesl() ruax pnu1alxo fciyd s uau s t0altnxf to1omD auvs;t setoxr3iy1ap e ncia(f 2umuroou1tpen f3iatlm2rm( o u4tltnxo oatoaD anvs;( t2tm(opnu4lleelicias)sDtm(mo;u0aptnmo3ilsfs uanmonu0trermo3iotla rlivo s)trurxo nu1ll   fesa()a2rru ooo0tlxnifetltfsDrmumo u0 rermo3oa1fm rauvi ()teuoxr3oo1alt mfesas)srta(mont4olxoiiciys m2eaumpnu0trerifcto1opD ln sls0 2tmirpou4lp  lfvs t  rrmuro;u1tet  fciyt s2umnmp () lermo io1optranes;( tetrir3iodalt  icil(fsrtr( oot0tltnmieiatfmDulnmo (0texnxr3oy1fatran o;()s2urxm iodom   nvi s a2tm( ooo4optoiieiysfmDranmonu4trtnio3iodlpteaueil(0s2xoxrpiudlptelfeilsf 2tr(mo;t0texnmfciad sDeau ont4aeermr oytop eaieol(  exr(r3oy4am  lfeilsf Dtaur ;t1tpen ieiadfm2emu onu4 lenxo ta1la rlu o;(0 exo(opnu4al emnvtls) rtaumoot1aeeomiciysfsDuan p;u4 exrir3tadfmD auei;s  eto(r3oo4aptn ici ()arurx oou4texomietlsfmDuanvp u0teenio3to1lmtraiesl()srtmxm ny4apeelfvtl( srur( pnt0oexnmfciysfaDem(vp u)alxoxo oo1fm elnvols texoio oy1olte nesat)arumumo;u0aleomfeilt s2elnvon(0arxnmo3to1omt  n o t)sexr(r oy4op elfct sfsDtrumpnu1oltomoetasls2emn sn(0alenmociotla  aies;s)trxo(opio1al  lfcilt artrumooo1tpt ioeilslsDea(ms t) exnirctydfm   neil( setoio oudopenmieta() Dtmur no1tlt  f3iasfm2el(mon(4 lxrio3ia1om e uvs s)tetoxmpnu4ll n fetls arrmxr ;t4olen iciydfm uanmp;u)tlerirctodfmtrlu s s)sexoim ny1omte nei sf rra(mp;o4olxo octysfmDean s ()tlxnmf3iydfmDr uei (0setm(m nudapenlnvsa() rtaxrpnu1texoiociydfm2emuvsnu4 etniocootomD li il( texrxr oy1ale lfeiltf rra(mont0tpxomiciydfa2emn onu0trxomf3oydoatrauvs;s) exoxr iudllee nvs () Dumxr oo4tlx  ocild a2rm( o u4aetoif io1la ean s t0s2xrir no1ol nmfctlt srtaxmoou0aexnmoctyt a2rmn o;u) rxrir3iytlaDe ueolt0teto(r3no4om emivsa( aDua(m ou4oetnmf3iadls2rl(vpnu0 rtrxo3ia1fm   uei;s sruo(m oudam emnvsltfartaxmpnu0alx iicilsls em(mont) ltomf iytla ran s t  rurxm nudllenlneia() Drmur oo1tlto f3tld s el(vsnt4 etrxr3tatlateaivils s2xmxmpnudaltelfcsas)sDra( ono0tltnmi3tldfmDrlnms ()tltrxr3tydfpt aues;() rxoxm3iodoltn fesls  2trur no1alto i3tydfs2umumpn(0tleomo iadfatrai i (0trtrir iydoltn nesat) 2uaurpno4opx iieilsfs rlnvp;(4 reoif3oydlm e i i;( truoimpoy4ap nlnesl(fa2rrumpot1ope iicias s raumonu) rxrmfciatfaDe n s s0 rxrir3ny4lle  nvtat)a2rmxrpnt0tpe io3ils mDrmnmp (4tltrxf3ta1la e n ol(0 exoxr oy1lptemietas)srua(  ;u4olen ictls m2emumo u4tetnxr iydlpDr ivilt)s2ur(m3nu1alen fvtl( srur(r nt1tpxo ictat a rmumonu4 reoir ootfptrln ils s2umio3ny1apeemnvia(faDum(ro;u4ape if3tatfaDum(vs;u0aeeoir iytopte ies;t)setr(r3nu4omtn fvilt  2ur(mo;o4olxoii3tasfaDel(vo t)teeomfcta1opDraieslt)s2uo(o io1amen ivta()s2trumoou4aleo fciydla rmuvo;(4 lerircootlpDeau i;( srtmxrpio1lptnlnctatfaDtm( p;u4altomociyd m emuvs;u4 lxrmociodomD  ieo s texr(r3ny1oleelfvtatfs2um( pnu1alto iciadfsDemnvs;t0aeeriocio1opDelies;t) rtmxr3oydllte fcs tfarta( p;t4oltnmfciydls2rlumonu4 rxomocio1fp e nvs;t) eurxr io4apenlfcil()sDum(r ;t1aeeniiciyt a2ea( o;(0 leomf3iy1lptr ueo;s0 euo(r oudome mieias)aDraum ou1tlxniocilsfa2uln s t0trtrmf oytlmteai slt) rur(o3iu1lp nmfcta(  2uaumoot4tleo i3ild aDuanms u0altoirctatlptranesl(0texr(m3ou4ameemfci ()s2ur(moot4oetnioeiydls2elnvs;(0tetoxf3ia1lpDelu i t)trtrim3no4am emietas)srrmum ;u0ale io3tasfm2emnvp u4aexnmoctydlp eau i s)tetmimpnodll  mnvtatf rra(ro;u4tle mi3tlt s ra(mpnt0tltnmf3iadla  an il(0trxrxopny4lme  ict s)srtrxrpnt0tptn octldlsDelnms t) lxrmf3iytop   ieo () etm(o io4alee ieta(fsDumum ;o1oetoif3iatls2rl( pn(0alenir oo1omD lu sl( t2toxopiodlpenlivslt aDrmxr ;t1oexo o3iytfsDuauvo;(4alerir3tytop raivo t  2trxrpoy1ol  licsl( arum( pnu0opt mo3iatls ra(vp u4artrmr oodlmD anvs;() 2xm(o3io1ll nlncil(faDur(r ot0aex mi3iytfmDel( snt) leomf3tadlat lnei s  eurio oo1altnlneil( aDtm( o;o0ale  f3iat a2ra(vo;t0tlxnifcoydfmtr iei;t)srtmxr3iu4lm  lfcs s aDra(  ot0olen icils mDel(vo;u0tltrmoctytfmte i i s srxrxmpnodaptnmfci (fa2urumpoo4teen ictyslm rlnms;t)tlxrir to1fpDrai s;( seumimpny1ape mfesltfsrumumono0alxo i3ils sDulnvo u0altnio3to1lmD aneilt  eum(o no1lptelfvtlt sDurur oo4tlenmoctasfm rl(mo t)trtnxocoydomtelivolt0 rur(mpnu4opeemfet s) 2trurpou4apt  f3tltfs rlnms t0 rxrmo ty1fat  u s;t0 2uo(opoodomtnlnvia() 2trxrp;t0aleniietad s2uln p;u)arxoir3iytfpD lueolt  2toxm iodom  mictl() Dtrum ;o0olx ii3iatfa rmnvpnu4trtrio iydomteaiei t0sruo(mpiu1am   ieil(fa2taumonu1open feiytlsDrmuvpnu) rtnir io1lmt ln sl() eto(o3nu4amt  fvta(f 2taxrpnt0oet mictltfs2um( o (4trxomf3iytomDelnesl( s2xm(r3oy1lltnmnei s a2rmxr ou0tptniocias m rmnvs t0texrmr3oatlmteau slt) 2tr(r oy4lmee neta()arrr(rpnu4aleniietldls2ea(vo;()arerxo3ootfp rlneo ( trxmimpoo4lltnlfci t a2raxmo;u1apx mocilt aDulumo;u0trtnxoctodfa rln o;t0 etrirpio1al  mivi s)s2rmump;u1olx mfeiysls2rlnmo (0tlxniocoy1fmt anvolt0 exr(m oodllte fesas  rtaxmpnu0tleo f3iltfa2ua(vpn(4texriocto1opDelneilt0teum(opoydom emncsa(farta(m ;u1tptoio3tydfm2el( o (0trtnmrciytfat lnvols s2xo(m3oy1ole lici (  Draum oo4tle  fciyslm2umn p (0 etrmr tytfaDeau i;s) rxrir oydom emiesltf rta(r ;u4tleo fciysfmDranms u4 exnifctadlp ranvil()s2tmxrpou4lm nlivi t  Duauro;u4opxoio3tyd a2uaumo;(4tltnxociadla rli s;s)tetrir iodlmtn fcs (f Dum( o;u4olxn o3tyt a ranvo u)aexnmo3oa1lp   uvi;s) 2xmxopiu1olenmnvsltfsrrrx  ou1oltoio3tytla ulu s (4altnmfctydlat  nvo s)texrxopnydlmeelncta(faDrmxmont1tex  icild aDul(vpn()tetnxr3iy1omDrln olt)tetm(o3oudal  lfvtl(  2uaxmoot0opxn oetltla ea(ms ()alerxo3ta1omte n o s0srxr(opiy4op  mnvt s)aDrr(m nu1tpeniietaslsDrlums;t)trxomfciydfpDranvs s)srxm(mpoudole mfct sf rua(r ;u0opxoif3tasfa eauvs t) rtnxocoytfatrlnvi t) exmxm oodaptelivtls)aDuaum ou1tptn icilsfaDemn p;() exrifciadopt  nei t)s2xrxm3ou4amt livi () rra(ront4tlen o3ild sDeluvpnt)tetoxf3iy1lm e uvs (  exrirpoydopenmnvt sf rta(mp;u1tptnio3tlt m rmnms t0tltomrciadopteauei;s) 2tmxrpou4apt mnvs s a2ra( poo1oeenmfetytfs emuvsnt4alxoir iodfm e i o;s0tetmir3oo1ale lncslt sDumu  ou0opx ioetls m2ea(mp;t0trxnxo ty1fp e u i;t)trtoimpno4omt mnes t)s2rm(m ;u4alto i3ias m uau o;u)tlxoio ta1fmD au o t0 2uoimpou1am nlicsl(fa2ra(ronu0apxo iciyd s ul(monu4tlxomr ta1oa eauvolt trxoxm nodll e feil()aDua(mo;o1alen f3ils aDrl(mpnu4trenmr oadoaDrli i;( sruoxr nydaleelfvias aDuau  oo0tpx ifctat mDemumon(4 lenir3ia1lmD ai s;(  2uoio3oy4lm n nvsltf Dumx pot0aet ifeiyd m rm(vsn(0 rtrifcoa1omtean o ( s2urxo nu4lm nlnciatfs2tmx  ;t1tetoifctyt s2elums u)tleomr3iotfm r ueil(  2trim nodalte fvt tf 2um( pou1aex mfeiys sDuauvont4 lxrxociatlaDeaies;t  rtrxopoudapeelivils a2uaumpnu1texniietad m2ea(vp t0 renioctodoptraieols0s2umxo3oodoltelnvslsf 2tau pot0tee mi3ias aDrmuvo u0 eenxo3ta1lmtr nvols)truoxrpiu4al nmivias) 2rmumont1olxnmo3ilsfs2raumpnt) etrxf3ta1fat  ieo;(  2urxm3oo1ap   ics tfa2urum no4aex  fctys sDuauvo (0aetoxfciodlpDean s t0 etmxo iu4olee ivsltfa2trur ot0apeo fetasfa2rm(mpn()artomrciydfpD luvilt0 eum(r oy1ap   nes ( srtrxm oo1tlt iociasfa2emnvo;t0alerxr oydop  livs;()srxo(m oo4am nmnes t) Dtaumpou4aeeniiciatls2ean p t)arxnmo3to1fa eaies () 2tmim3no4lmt mfctas sruru o;t4oleo ociad sDrlnmp;u)trxnxo3iatlpDelues;( sexo(o iydlpt  nei ()sDraur nu1apxomfetls m rlnvo;() ltoxo3iydfm r u o s) rxm(m3oodam  lnetasfs2um(rp;t4oetn feils s um( pn(0arxomr ty1fmtr n s s0srxm(r3oo4om n iesl() Duru ono0aeeoif3iaslm eaumo t0 rtomfcoodomt ln ilt0srurxmpiodol nmfvi sf Drmumono0apt  fetadfm2em( s;u)aetomo3ty1faDrlueo ( trxmim oy4oltnlnvs (fa2ra( pot0tetomf3ias s ua(msnt4texnxo oadop   ueol() 2tmirpiydal elnei ()s2rmxmpnt0tlt moeiat m2eanmp t0artrmrciydoaDe ieols tetrxrpno1omtnmfvtl(faDrrxrpnu4alenmf3tlsfs eaumsnt) reomo oo1fmtelieo t) 2xo(o oy4oltn ncsas)aDurxr nu0olt ioetld a2emuvo (0alenmfcoodoptranvo ()t2uo(m3oy4ome lfes tfsDuaump;o1tlx mfcilsfm2rmums;() rtoir3oatop ean i t)srurxopio4llee nvs ()a2urum no1aexnmocildla2eln s;u)trxnmr todfaD  nvolt t2xrxo3oy1altemfcs s sDrrum ;u1ope  ieiytfm ul(mo;t)arxrxr3oa1latrlieo (0setr(o3nudame lfvil()aDur( pou1oetoiietasla ua(vs;u0alxrirciy1fp  lu i;t)trxo(m3nudome lnci s)srurumoou0ale if3ias a2um(vp;t)altoxo ta1fa eaneo (0teur(m3nodamtnmnvsat a2urur oo4tlxnii3iydfm umnms;t) renxociydfaDelnes s trtm(o iu1ale lietl(fsrrmu pou0tle ii3iad mDumumpnu4alxoiocoytfpD  ueilt0sexr(mpno4alt  fvt s a2rr(r nu4tee  fciad aDum(vo u) etoir io1laDrlues s)trtoxr3iu4lm nlnvia(f Draxmoot0aex moctyd sDrm(vp ()artomf3tydla  au s () rto(o ou4lmeelicsl() rua(m ot0tlx mfeiltfs elu p u4 renxf3iadomDe ieo s0s2trim oydllte nvtlsfs2rmumpoo4ape  octydlm ra(mo;(0aetrxrcty1lmD anvslt0teuo(m ou4ome  fviasfarrr(  ;u0alxo ieiltla2um( o t)tltnirciytlmDraivolt)s2xrir3oydolen ietl(  rurumont1alen iciasfm2ea( sn(4 etnmr oatlpteaieo;t0s2xrim ny4llt mfvtat)sDtaxmp;u0aeto i3iydlm2elnvp;(4 eeniocoatfpt  iesls) etoio nodole  nvs sfsrtr(mont4open iciadfs emn o;u0 lxnmr iadfate ieilt0srtmxopnudopteliciat aDumxm ou4olx mfciyt m2um(vp (0 lerxo3io1lpD lneils sexm(o3nu1lpt mfcia( artmu pot1tet  ocilsls2elu s t)texrmf3oodoa  lues;t trxoxo3no4lpee fvsltfarrmu  ou0opto o3ildfmDuln on(0 ltoxo oydom  ai ols t2tm(m iudope  iet s)srtrumonu0texoif3ild s2ulnmp t)aeermfcty1la r i s ()sexm(o nydolte fei t sDumum ;u1olen fciydfm2emump u4artrio3tytfa  au sl( s2urxo3nodomeemfesls aDtaur nu4aex io3tysfa rln pnt0aetomr ootlp r uvils0srxmxr3no4lmtn iesl(fa2urxrpno1apto ociysla2um(vs u)altnxr3iatfa ean ilt sexm(o oo4opeelfeiatfsDrmumont4tptnioeiltfaDel( pnt4tltoxocoytfaD li o s  euoxm nydome lfeiasfa2tmxrp;o4tet if3tyt m2rln on() etnxrcoy1omt aies (0trur(r oydal   fcsas s2rmx pou0tee  feiatfm2rmu s;u0 eerif3io1lm e u slt0 2uoxm oudlptelnct t  Durxroot4opxomoeiadfmDumumonu) lxoxf3tytlpDe nvsl(0s2uoimpio4am  lfvsa( srrru  ou1optn fciyslsDem(mp;u0tlenmr ootlateauvi s trurio3ny4ll e fvsas) 2raump;t1texnmf3tltls em(msn(0 ltrmfctotlptrln i;t  2urxr3oo1ape mivta(f rtm(  ;o0aexo feiatla elump;t0tltnmrciadlp ean s;t  rtoirpno4llenmnvil()aDururp;t0tptnmiciytfmDulnmsnu)artoxrcia1fp eaneils0 rtoio3iydop nmieiasfa2rax  ;u1tlxniicilslm rl(msn(0aexnir3tatfpDeanes t0 2ur(mpiy1ape mfei t  Duau  ;o1ope mociysfa em(mo;(4tlxrio3oytfptrli s (0tetr(r io4amenliesl( srur(m ;t4altomo3tlsfs uauvo;u0 etriociytomD  u s;()teur(o no1lm nlfvils) Dur( o;t4olxn ictydlm rln o;t0 ltrxr3iydlat lieilt  eur(o3iydam  mfvia(  Drauro;u0apeomfcilslmDean o;()tlxnif ia1omtrluvils) eto(m oodal  mnvia()s2tmxmpot0tpeomo3iltfmDul(vo u4aexnmr3iotlmDeai i;t)t2to(m ny1lpenmneslt) rrrxmont4olx ii3tysfa2rlnvsnu4 ltomo oo1oaD  ueols  rtrxm nudllt  fvtltf rrax pnu1oetnmoeildlm2rau s;u)aeeomocoa1oat aneo () rtr(m3iudlmt  fcilt)a2trumo;u1teen o3tyt a2uan pnu4artrmrciotopte n i;(  2tm(o3iudom  livtatfsDumurpot1opxnmociltlsDrln snu4teenxf iatfateauvi s) rxm(m3ny4olt  fct t a2taum nt0olxoif3iadfm2ra( p;(0texoir3oadlmDeauvi s)t2umir ou4ap nlieia( aDur(  ou1tleoiietasfm umnvp;u4aexoxocoatlp e uvsl(0s2xm(m oodop e icslsfa2umumpoo1tptomoetatlm emu snt4 exoxrctodlaD  ivols)teum(opnodom e nciasfartmurp;t1tlt mfctydfm rmnvpn()tlxoxr3todlaD ai s;s t2xoio3nu4apeelfes (f rtrx  no0apxnmf3iadfsDeln pnt0trtoxrcoa1omt  n s;(0 etmim3no1opt livslsfa2tau ont1apt miciydfs2eaump u4aetnxo todfmte neo t)truo(rpoy1omtemnct tfsrur(m ;u1tpt mfctytls2rmumont)arxomfcoo1laDrai il(0t2trxr nu4ap elnetl(fsDumu p;t4tlx iociysls2rln o u4aeeoxf3iotfptr ies;t0teuoxm3oo1lmen nvi sfs2uau oou4oleoiieiasfm2uau s;t) lxoxo3iy1fpt  ies;(  euo(r3oudal   nvtat arrmxmoot0aexnio3ilt a2ulnmp t0trtoxrcoydlaDe uvi t)teuo(r io4apt miesas)s2ta(mooo1olxoioctytls2rm(vp u4 lenxo3oa1fm rai i ()sexrio3ny4omt livias)s2ua(mono0teenmfetytfa rau s;t0trtrxrciadfp rauei (0sexm(o3nu1ap e ivsltf 2rmxr ;u0tptomietyd mDemu s u4tetnir3iatomte iei (0teurio no4ll e nvslsfs2urxr nt4ale  fciytfa2ran s u0 eeoif oydoa r uei;s)seumir3ou4lpt mncsls srurxr ;o4tetoiieildfm2uauvs;t) leoxf3iydfmtelivolt0 rxo(r ou1ll emfetls) rrmu  oo4tlxnmoeiatfaDea(ms;u0texrmr3iytfaD  u s;(0trxoiopiu1olt lieiatf Drrxrpno1tle  oetysls2rlu o t4aexrxrctodlp e nvo s  rxo(o3iu4am  mivi tfsDtmxr ot0aex mfetldla2umumon(4alxrmf iotoatrln s (0 exoir3ou4am  lfeil(f rra(m ;o1olxoioetls s el(vonu)artnmfciytfaDeaneol()s2xo(rpoy1am  micsls)s2ra(moot4oexoifctldfm2rl(mo;u0treoio ta1lp  lnvs s)truoirpiudome lncsl(fsrra( ooo4opxnmo3iaslm2rmu o ()alenif3iodlaDranes (  2uo(mpnu4apen ivils) rrrx  ot0tptn ociltls eln snu) rtoxo tadlatr i o;() 2xmxrpiydlptnlicslt sDtm(mpnu4ope mieiadla ulnvp u0teenmf3tydfateauvol()trtoim3oydaleelfeiatf 2ur( pnt0tex  f3iasfs ulump;u4 exoxr ty1lmDrau i;t sruoio ou1lme lncta( sDtmx o;t0opt  feils sDelu sn(4 etnio3totlpDeaues s0s2tmim3ou1omeemnesl() Dur(mpno1apxo ociydlm2ran s;t)alxrmf3iatlaDr u i;()t2um(mpio4lmtnmicslt  Dta(  ou4opt  ictatla eluvp ()teenif3tydfa ranvo;s)setr(mpou4lp   fctas)srum( p;u4tlen i3iyd m uaumsn(4trtriociydoaD aivs;s0s2xo(mpnu1am nmfet s sDrrxmp;t4aeeoioeiatls2rmu sn(4alenmr3oy1fatrai s;s t2uoxmpiydalt licilt) Dumumooo1oexo iciasfm ul(mp (0aetrio3totomDeluei;t)texo(r iydlm n ics t sDrr(  ou0olx  feiydfs2ul( s;(4arerio oytfpDraieolt  rurxopio1lmenlietatf Dtaxroot4alxoif3iytfs uauvs;() rxrmo3todoate uvils0t2xmxo nudoptnlnci s)artr(r nu0oltnmicildlaDel( sn(4tltnxo ootfpD luvol()trtmiopiy1lm  lfcilt)srraxm ot4olt mictat sDelnmo;u) exrmf iotlpDrlnes s0t2tr(opnu4ame micils)aDrmumpno1alxoii3tad sDua( o;(4tetnxocoo1fmt  nvi s)s2uo(r nu4lleelnesa()aDum(r ot4oeto icildla rm(vp;()artnirciydlpDrlnes;t sexmiopiy1lptelnvia(f Drru pnu0opx  ietad m rauvp t0 exnmo3oodlm  lneolt0 exm(rpoydlp nmnesltfs2rmx pou1tetomiciat m ulnvp;t4aexrir oydla e i ilt)s2xoxopiydoleelfcsatf 2tru pnt0alxn o3ilsfmDuaumpnt4treoir tydoat  nvi () rur(opiydalt  nei ()srtau  nt0aex  o3tat a ulums u)trxoir oydfaD  ieolt)texmxo iu1am n fesasfsrum(mp;o0opxo o3ild sDrlu o (0tetrxf3oatlpD lnvolt) rtrxrpiodopeemncsasf Durx onu0olxomi3iydlsDeln p;u) leomo tytomDr ueols0 rxoxr no1am n fet t  2raur ;u1alenifeiyslm2ua(mp t)teenir3ia1opteli ils)seumim3ou1amee fvs tfa2raxmp;u1ope mfetydla ulnmpnt) lxriocoadomt aieo;t)s2toxrpno1omee ncs sf Draumooo4oeenmfciytfa2umump;t4aeeoxr oo1fmtr nvols) rxr(rpiu1oltemncta(fs2rm(m ;o4oleoiicilslmDua(vp u) reomrcty1omDelu s t trtmxm3iu4al nlict tfarumxm ;o4ape if3iatls eanvpn(4 eeoxocoadlm e ueils) rtoxr3iudamt lnviltfs2uaurp;t1tpenmf3iadfs2ra(vs ()treomr3iatlmDelivi ( t2xr(mpio1lmte ncias arra( oou0aee  f3iydlmDumnms;u0tlxrir oa1lm e i s;( tetoio iu4ome  fct t  ruau  ;o0tpt iieild sDea(mp t) rtoxo3todlaDr ieo t) rxoio oo1amtemfviltfaDur(mont1opt mieiatfsDemumont) exrirctodoaDeluvi;( sexriopoodal nmivs t)aDtaxrpnt0olx ii3iyd mDua(ms;u4 ltnif3ta1fa  auvi (0sexm(rpny4op  lnetas arrax pnu1olxoii3iyd aDeln o t0tlxnxfctotfp  ai o s0 2xmxrpnu4om  mfvtlsf ruaxrooo4oet  i3iatls2uaums;(4 rxnxr3iatfm elneols seurirpnodoltnliesa(faDtaumo;t0opxn o3tys a2ua(vs u0 exrxrctodfp r n i;s t2to(rpny4llenmnesl()aDtmu  ;t1opx miciltlm rl( p u)arxrioctytoa e uvo;(0 rxrim nydlm e fetlt)s2tmxmp;o0aeeo i3tlsfa2ea( p u4altoxo oodfpD an o;t0t2toxopio1ap nliesls  rtrx pou1tle if3iadfm2rmnmsnu)aetoir iy1oa  an o;s0 rtrir3nu4amenmnvil( aDtrurp;t0tleo fetysla emnms u) rtoir iadfmte ueil(  rurxm3iydaltelnci sf Drru onu4olxoif3iysfm2umuvo;u0artnirctodlaDe uvi (  2trxr3iydllen nes s arumu  no4tpen f3iys aDumnmsnt4aexoifctatfp   nes ( sexr(rpnodomen fetls  ruax pno4aet ioctls m2eauvo (4texoxrciytoaDe uvs;(0trur(mpiy4om n fciltfaDtr(root4oexnioctat s rlnvs t4tetnmr iodomDean ilt  eur(m nodapen fes ()sDtrum oo4tpeo feiaslm ea(vs;(0arxnmoctatfmDeln sl(0 rxm(o iydlmenlfvt sf 2tm( p;o0oet io3iytlm2ul(mo t0 exnxr3iotoaDe n o;s  rurxm iy4ll  lfvsa()srrrur nu1teenmi3tls a eaumo;t0alxnmocoy1lm ean s t trxoim3iydlleemnetas)aDrrum oo1aetomoeilt mDrlnvp;() ltomo iydop rlu o;( t2xr(o3iy1ol  mfvs (fa2rm(  nu1olen ociasla2rl(mp;u0 ltnmr3iy1faD  neols srurim3iy4am emncil(faDrax poo1aptnif3tyd mDul( p t) rtomr3iotlm r ivs;(0setrio iy4ll  mfcsls)srtr(rono4opeoiociltfsDua( on(0 rxomo ta1fp rauesls0srum(mpno4olte nctl(fsDrruronu0tlx ii3tldlm2ulnvsnu0 rtnmfciy1laDeln s (  euoir3no4al elictat sDumuro;u4aexo i3iad aDum( p t4aetriociytlaDr ivo;t0seurxr oo4lp emnct s)sDtrum ;u4tlxomictat a ulnvo t)aexoir3totfpte n i t0 exmir ou1ome mfct ()a2ua( ooo4apeoioetytfaDemu s (0trtomo todom r ieilt)srtoxo3iu4ame mivia(  ruaur ;u1oleo o3tlsls ua(vs;(4 ltnxo ootfm eln s;t) rxo(rpiodol e nesat)arurxm ;u0oleniietltlm ulnvp u0 rxomo3iydomte nes;(  2urxm io4omen ies s)arrau pnt4opeoifeildfm rm(msnu4altomf3to1oateaivo;(0seur(o oy1lmenlici (fartrxmoot0apeomoctls s el(mo;t0altomf iy1om r ieolt)srxm(r iy1al  mnvs s)s2ra(r ou1aeeomfeiadfsDel( p ()aetnif3oydoat aivo;s)s2urim3nodlptnlivs ()s2ta( pnt4opeoii3iatfs2el(vp;u0teeomf3tatopDeli s;t0trurio io4apt lncil(f Duaxmo;o4tlt  i3tytfa ea(vs;t4 ltrmr3ty1fm e ueo;s0setrxo3oy1aptemiviasfaDrr(moot1teen i3ilt mDrm( o;t)tlerxf3iatop eaneils  rxoxm3ny4al   netas  Duauroou1oexo fetad s um( snu) etrmrctotom elnvolt0setoir oy1al elfcsasfsDtmxroot4aex iieilt a em( o u0 lenxfcto1lptraneo;s trxrxopnu4ol n fvt s) Dtruroou1ape mfciad aDemuvpnu4artrmrciotfa eauei;s)s2xo(opoy4om nlnesa()s2umur ;t0tptn oeiat sDrlumpn(4trerir3iadlpDrauvilt sexmxr ou4amenmneils s2ta(m ou0opeo iciyd sDrl(mp;u0aeenmf3io1fa  lu i t s2tr(r3oodopenlfcilsfa2umxrp;u1apxnmociytfaDrmuvp;u4aetrxfciatopDeln slt s2tmxm3oudlltemict t sDur(monu4tpxn i3tys mDrmu o;u0alxomfcia1lm rlies;t) 2tmimpiy1lpte ivslt aDtmxrpnu0tptoiieiydfs rmu snu4arxnifcio1oa e ieols srtmir nu1omt  fcslt sDur(rp;t4oet mfctadfaDumuvp u)trenmoctytlmt  ivi t s2uoxmpnu4lmte nctlsfarta(rpou1aeto octaslmDrau on(0arxomfcoytla  lnvo;s0t2xo(o3no4amtelneia()sDtaxrooo0teto ieiasla emnms;u)tlxnmr oodomt lnes ()teuo(r iy4amen ieia() rumur ;u4oltomi3iysla rln o;t)trenxf iotfmD  u sls0 rumxm io1om elfet (fsDua(mp;o0oex mi3ilsls2el(mp ()trtomrcoadfp  li s;( texoxm3oy4lmtelictlt a2rm( o;o0alxo ieiatls2raump () rtoxf3tytopteaneils  2xmim oo4lmtn ivtat s2umxr ot1tpenio3iytls2ulumo (0tltnxo3oo1fm raivi ()trtm(mpnu1ome mivslt)aDraxm nu4tle ioetysfs2rlnvp;u0 rxomfcoy1opteauvi s) 2tmxr3oo4lmtn net s)srrm(moot4olx moetlslm2elu p;u4tetomo3tydoptr n ol() 2xrim iu4alt lnvsltf 2tau  ot0opto fcilsfaDra(vo (4 eenmr io1om   uvils)truoxrpnydll e fvslt)artaum ot0ope  feild aDul( o t) eenxocty1fmtrli i t0 ruo(m3iydoptnmnct tfsDtrxmoou4tlenioetysfa2eanms;(0altrmr ta1opDr uei;t0seuoxo no4op elfeilt aDuau  ot0tee  octysla2rmump t4 lxrmo iatoat lueslt)tetrim3ou4ap elicsl(fs2rrxr nu0oltnmf3ilsfmDemnmo (0trermrctotlmtrluvs;(0 rumxopno4lpeemnvtlt a2ur( ono4teto fetytlm2uluvs;u4aeenif iotfm e ivs;(0seurxrpou4lp e fvs t) rrru o;t0texnifciydfmDrl(ms;u) rerxr ty1fptr n s t0t2xrim nudapte nvils a2tr(  ;t4apeo oeiltlm emn pn(4artomr iodfpDr ivo s  ruoxo3oy1amt  ncsl(f rurxr ou1opx mfetlsls ra( s u0alenif iotfptr nvo t)srurirpnudamtnmnet s)srumu ono0olenii3ildfaDum(monu4tlxomfcia1fm eaieol(0 rurimpoy4omtnlivia(fsDurx onu1aeto i3tatfa2eau p (0tltomfciotla e nvi s0s2trxm oy1omen feilt aDtrxrooo4oeen i3iad aDrln p;u)tlxrmr3ootfm rluei s0 rtoxo iu1amtelictat) Dumu  ;u4ole ifeiasfaDrl(vo;t0alxnmr3iotlm   uvolt sexm(rpou1amtn nvias)srrrx  nt1texnmoeiltfs um(vs;(4 rtrxr3oytoat auvo s) 2xriopny1ol  lfesat)artru  ;o0olx if3iydlm ua( p u0trxrio oatfpD ln sl(  rurio oo1lm n fet t)arraurpoo1tee  f3iad a ua(mo;u0arxoxfcoadom eanvo;s)setoxopoudlle  ivtas  rrmxmpot0oet  o3tytfsDulums u4aetnxf iatlpt livo;t  rtm(mpoo1ope lfvs tfs2urur nt1apxn o3tysfs uaumo;u0trxrmociodlpD lnes;s sexrxopoy4lm e ivil()artru pnu4tetn fciyd mDeau pnu4tlxoif3tydfmDrli i t)s2xoiopou1lp emnci (fsrrm(m ;t1oeen iciatfmDrluvp;t0 lerxo3ty1opDeanvol() rurxr3iu4ole mfesltfa2ur(ro;t0oetoioeiadfa emu o;(4tltrxo3iotlmtelivslt) 2xrir io4oltelfei s)aDua(  ;o4oleomoeildfs2el(ms u0treoxocoodop rluvil()srtmio3oy4llt  ietltf rta(rooo0oetnifcildfm2rmnms u0altrmr todoat li s (0s2xoxm3oo1ll n ietl(fs2umx ono0apxnmoeiydfs uauvsnt0 leoircoadlatr ueslt) 2xr(m3nudol nlnvsls)sDrr(mp;t0alx  f3iltla2rlumo;()artrif oadfaDr u ilt0seuo(opoy1lp emicsas) Draxmono1tlx ifeilsfm2rl(vs (4texrxfcty1lmt an sl( seuoim3iu4al elncsas)srra(ront1opx ioeiat s2uauvo;u4aexnxociadfp e i s s s2xrxrpoudal nmnci ()a2trxr ;u0oeeo fciysla2raumsnu)artoxf3to1fa eaueilt  rxrim nudaltn fvtasf 2taxmp;o4aet  ieiyslaDrmumsnt0arxrxociadoa   neil(0 rxrio3iodlpenlfvsas s2rmxmpou1tlxnii3tys a2uanms;(4trxnxr ia1latrau o;t0 eurir iy4lptnlfvtasfs2urxmono4tlxn ociat m eanms;() exoio3tatop  li o;t  rtmim iydlm   ncs t)sDta(mpnt1aee ioeias s ua(mp t) exoxrcoydlp e ues t teurirpio4lm  lfes s)aDuauro;u4texniociytfa2rmnms (0 lenmf ta1latelueol()t2xoxm3oy1ol elfctlt)aDtmur ou0opx iicils m elumpnu4 rxrir3ta1laDrluvi;t  exoxrpiu4om nlnci t artmxmo;o4alxnif3iyt s emu onu0alxomr oy1oat lnesl()setr(rpou1optn ieslsfsDtrumpoo0tpeoii3iytfmDrmnmpn(0 etnxo3totfm e uvsls)t2xoimpoo4ope lfctls  Durum ;o1oeeoiictaslm2rln s t)tltoxr3todlmte u ils0trtrirpou1llt mfvil(  2umuro;t4aetnmo3iydlaDul(vs u) rxoif3iadfp elu ol()teurimpnu1ol e fesas)sDtrxr ;t1tetnii3iyt mDrl(mont)trxoirctatoptr i i;()srurxopoy4oltn fvi t aDtau  ot1alx iiciaslmDeauvp;u4aetrmf tytlmt li ol()srxr(r iy1lltemnvilsf rtmu p;u1opt ifctatls2rm(vs u0teerif to1optr i s ()sexm(m3oo4lme mfcsas s2tau o;t1texoifeils s2el( on(0 ltoio3oatfa eaueslt0srxrir ny4ole lietasfa2um(rp;u0apeniiciltfmDua(mp;t0tlxomfcoodfmDrluvs (0srtrxm3oydamt  icia( sDtm(mp;t4opxomo3tlsls2umnvp t)aexoxr3iatfmDeau s s trtm(rpnydal   iet (  rraurpno4tpxo i3ildfsDulu o;u0altnmo iytlm ran i s)s2toim nu4aptnmfcs (fsDtrxmo;t1tpenifctltls umu onu0 rtomf tydlate u il( texr(o3oudll  livi sf rra(ro;o4alxo icias a2rau s;(4 rxrxf iydla eanvo ( s2um(r3iu1lpe lnci t)aDurx o;t4ale mietld s2emnvsnu4tetomo oo1lm elneo t srtmxo3oy4ap nmnesl()a2urxrp;u4tltoif3tlt aDrl( on(0 rermrcoy1fpte neil()srxm(r3iy4lpe  nvtlt  Drmxrp;u0tpx  oeiydls2uanms u0trtoxociodomtrluvs t0texr(o iy4olte ict sf 2uru onu0oexoiiciytfmDean p u)arxrir io1lp rln s t)truo(rpnu1lpe mfvil(fsrrrxrp
\ No newline at end of file
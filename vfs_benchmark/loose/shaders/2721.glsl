@@ -0,0 +1 @@
+n i;t0s2xo(opio1omt mfcs s)s2rru  ;t4oeeoio3iad m2uln o;(4arxoiocoatfaDelivil()teumir no4ope  fetasf 2rrurpot4opx io3ias m ua( sn(0texnxo ta1opDeanvo;s s2xm(opoy1lmt  fvs () Dtax o;u4tlxo f3tytfm2eau pn(0aexrmo3oo1oaD  n o t trxoxm3oy4lmeelivs t  Duaurp;o4oexo fctat mDul( o () reomrctydfptranvi;t0srxm(o3io1altnmict ( aDrrx onu4tlxomocilsla2eauvpnu4arxrxrcty1faDeaneolt s2xmxo3io1ll  lnei (f rraur nu4alxnifeiltfm2rm(vpn(4altoxf3oa1lmDrlueo t srtm(m3iodlpt  ncs t) 2rr(mo;o1opt  oeiltlsDra(vpnu)trxoxocty1opDe nei s0 eur(r oodol nlnctl(  2trum ;t1tlenif3ilsls2uluvs;(0alxnxr tydfptr iei s)setm(rpnu1aleemnctat) rua(mpoo4altomiciadla ul( o (0tltnmf oy1omDe i sls texmxm3iy4ale mncta(fs2rm(r no1opt iieiydfm2rmn p;u0tlenif3oy1fmt  neil(0 ruoxo3no4openlivils a2umumo;t0aex miciyt mDemump;u0aexnmrcta1oatelues s trurir3iudale lnetas srrrurpnu4aleo o3iatlm2ean pn()aeeomfciytoatr nvi;t0texoxr io4amt  ncsls) 2uau p;o0oex miciltla2rmu pnt0tltoir3iydomDe nvi;s)teumirpiy1opee fetls)s2rruro;u1aetnio3iatfs2eau o;u4alxrxocio1fa e u s;s  exo(r3oudalen fct t aDtmxront4tpt mictyd mDumuvon(4tetoxf iadlmt ai o;s t2xo(m iudam emnvi ( s2ur(m nu1tpxn o3iytfm emu p t)altrir3ia1lmDr uvi;s0trtmxm3ou4apt micsltf Duauro;u1alxo iciyt s2ea(mp;t)trtrxo3tadopt liei;s)srurim iudaptnmiciat  rtax p;u1texomfciyt a rau o;t4trenxf iytlpD lnvo (0 eurxm3ny4lmt mivsa()s2ta(  no4tpxomi3tys a2um( p ()aexnxo3to1fmDr ivo;t)texo(m3ou4lpen ict s  Dtrxrp;u1olt mictytla2rl(vonu)aetrxo3ia1fm  lueo t tetr(m3ou1om  lfes (f 2tr( p;o1alxoii3iydlm eluvs;u)alenmr iydoa ranvsls)setrxo3oy4lpt mivsl() rraur oo1teen ieiydls2rau p (0alxnmr totlptrai ilt) 2tm(opiy4ame mfetatf rrrurp;t0texoifctysfs rl( p (0aeeomfciy1opD  u o (0t2um(r3iodam  lncsls) Dtrx pot0alto ieiys m2eaums t0artnir3iy1omt ln ils) etoxm3oo4opt lfvt (fs2uru  ;o1apx  fciatls emumo t4 rtrmr tydlpte neol(  2umim no1lm  lneiatfa2tr(rono4tetn o3iytls2umnvp;t)altnxf3oytfpt aues ()trto(m nudop  lfes tf Drm(root4opx mieilsfs ran p;t0tetoxr oo1fatrlueo;s0seuoir3oydoptn ivt s) 2tm( oot1oexo ociadla rau on(0 exrxo3ty1la r uvi;t)srxoxopou4oltelncil(fsDrm(m nt0aexnmociyt m2eanvp u0arxoircoytlptrau il(0 rtr(m3no4ole lnetas) 2tmuro;o4tptoiocild aDrlnmsn(0 etrxr3tydfpte ivs;t) rtoir oy1om  lics s  rtaxroou4opxnioctatfa um( pnt0 ltoxrctatfp   neo;s) 2umiopno1omt  fes t) 2ur( onu4aex mfeiysls ra(mpnu) rtomo3oy1lm e n s;t  2umio3no4ale lnetlsf 2rm(r ot1oltnifeiasls uln o u0aetrmr oatoaDr nvo (  etoim3iu1lmenlfetat)sDua(ront1aet micild aDrau p;u0tlxnmr3tatlmD ln o;s s2xmir3io4ap n neslsfaDurxrpnu1opt  ietat sDemnmsn(0tlxnxf3ta1lptean o;s0 rtr(opoo4omt  ieilt srrmurpnt4altoiieildfa rmu pnt0 lxrxrciydomt lu ilt0 2ur(r ou1ol emnct t)aDtrxrpnt1texnmociatla2raums u0aetrif todfp r ivsls) rurxr3ny1llen nvils)sDurxrooo1oetoifetlslaDuanmp;u4 exrmoctodopDr neilt)teto(o iu1apte iei (  2uaxrooo0opxn ieild a eauvo;u0aetrir3tatlmt li o;t0 2umxopiodalte ieta(farrru  no1tlxo fetysls2elnmp (4alxrmrcoytopte ivi;s0s2xr(r nu1om e fvslt)aDum(roou0tltnmf3iltlsDeanvo;(4trxrxf3ia1optr ivi () rtoir3ny1ale licils  Dtrxmooo0tetn ietatls2rau o;(0aexrif totfp e nvo s0 rxoio3ou4altelnvsls s2rm(monu4olen o3tasfa2rmu on(4arerxo3oodlat lu o;s)srtoim3no1ap   ictas s2tm(rp;u1tle ii3iysfa rm(mo (4 rtrif3tydomD li sls t2uoxo oo1om   nes (fsrurur no1oet ifciadls2ul(ms;t4tlxniocootfmDrlivsl()seuo(m3nudlpt  ivi (fa2tmxmooo1oexomfciydlaDeaump ()tetnir iotfpD  i o;(0 2to(o oy1lm n neia(fsDua(r nt4aleo oeiat m2eanmp;(4texnmfctatfptrluvolt) 2uo(mpnudol nlnvi ()arurxr ou4tltnmo3tlsfaDrln p u)altnxocoatlat an sl()s2xoim3iodlm elietlt s2tm(mpnt0ale  o3iytlaDumump;(0 renio3tytoatrlu s (0texoxr3iodolt mivtl(f Drmxr nt4tlx ifctys a2rlnms u)artnxr tytoat  n ol()t2trirpoy1alen nctls  Dum(mpot1aetn fcild m2elnmsn(4aexniocoydfpDeaieil()trtmim iu1olenmnet sf rrm(mpno1tlt mo3tas sDrmuvo;(4tlxomfcoatfatrau sl(  2trim3oydolenlfcs (  2tmxmpnt4alxnifetlsfsDulu pn(4aexnxo3iodlmteau ol(0 2trxo3iu4lmt  fetatfartrumont4opxo oeiadfs rlnvs t0 eerif3iytfmtr u i;(0 rurio nu1ol  mivslsfa2tm(m oo4apeomfeild s2rmums;t) etnmocoa1lpt  neo;s0 2trxrpiu4lltnmnvslsfsrur(  no0ape mf3iltls2ranvo t)tltnir oytoaDe u ols)srumio iudomtemivt t srrm(rp;u4tptnii3tlsfs ua(mpnt)tetriocoydfa e n s () rtmio3no4lmt mncils) 2um(  ot0tlt ifeiaslsDumn pnu0tleoxf3ia1omtranei ( texo(m3oo1optnmfvia() rurxmpoo4opeo octls m2rmu o u0treomocto1fptean i;t0 exmxm3iodlme mfcs s a2rmx o;t1tetn fcilsfm eaums (0aexriocta1la elnvs s0trumxm io4ol n nvsat  rumump;u1tptoiietadlmDrl(ms;t0 rerir iatopD auvo;s setr(m3ou1lp  lnctlt sDum(m ot4optn oeiatfm2ulu on(0 exnircoytop  lu o s)sexr(m no1ameelfetls)aDtruro;t0aeeomocildlsDeln snt) reoxr todfpDr nvils  etoxo iy4altelieils)a2ur(m ou1opxnio3iadfs2eauvs;(4aleomo3tadlpDelnvi;()t2xm(opoo4al nmieiat s2ua( pnu1apeoifciyd a2ean o t0alermf io1opt lnes;s teumiopnu4ol  lfet (  ruaur ou1aleo fciytfm2ranmpnt4tlenircoa1op e i o ()seto(r3nu1opt  nvia( s2rrx o;u0tlxnio3tadfm2rl( o (4 lenxr todop  li s t0texoimpiu1al   feias  Durxrooo4oeenii3ildla2rm(vsnu4 ltrxr tadfpD  u o ()sexoimpoodaptnlneta(fa2truronu1tptn fcildls rm( s;() eeomr3ta1fpt ln i;(0srur(o oo1ap   fvsat  2ur(ront4tex ifctat m rmnms () lenio oy1lp   ivi ( srxrim iydaltemict () 2tmu  ;o4apto i3iadls2ua(vo;t0 rxoxr3oatfpD  n o (0 eur(o oo1olte ietl( srta( ono1apx  f3tatls rmu s;(0trtrif3oydomt lu o s s2trxo nydllt mfvsa(  rtm(m ;u1aleomiciatlsDul(vsnt4 lxrmr iy1latr nes t0 2tm(o io1apt  fvslsf rraxmo;u4olxn ieilsfs2rau on()tleoir oatfa   i i;( s2xoxm oo1ame mivta( arururoot1tlenmietad a2emnmsnu4aetoircio1la  lues;s)sruoio3nodap  lnvta( aDtmur ot0oltnifctasfaDrmn o u)aetrmfctodoa  aies;t sexoxopou1ol n fcslt)artr(ro;u4tptnifeiatfaDrm(mpnt4 leoxocoadopt  ies t)t2tr(m oy4altnmnesa( a2rm(r oo0oet iocildfaDemuvon(4trtomr3oo1op ranvol(0trtm(mpnydoltnlnvsa(f Dtmxr ;t0ope  fctyd mDulump t0trxrxr3iadlmtelu ils teurxr3nudamtnliciltfsDtrx poo0tex  f3tytfs2umu on()artnxr tatlp raiei;(0 eum(r ou4om nmfcta( artau  nu4ale ioctlslmDrmu o;u)artnmfciotomt  i il()srum(opiodopenliesl(fsDurx poo0tpt  fciydfm2umnvp (4 rxnxo ia1oat  nvs t0 2xmxr3oodope lfesa(  Drr(r ot1tlxnmiciys m2um( p;t0artnmo3tatfaD  nvo ( t2xmiopnudap  micsas a2uru o;t1olenmfeiad s ean snt)aleoxr3io1opD aieilt0srtm(mpoydlp  mnvi tf 2uax  nu0olenioetadls el( on(0alxrxrctytoptranvo;(0trtr(r3iy1lme  fvsl()a2tru  ;o4tetnmf3iltlm eauvpn()tltoxf3oo1lmDeau s t  rtmxopoy1openmictasfaDta( o;o0tltn o3ias a rlnmo (4altoxo totoaD lieo;t srtrio no4olenlfetlsf rumumpoo1tex  fctat m uanmp;(0 rxnifcoatlpD lnei;t0srurxrpiu4ap  mnet tfaDraum ou0apxnif3iasfa emnvpnu4areoxo iadfptrlnvi;( s2trxopnydopt lieils s2tr(r oo1tex ifciydfaDua(mont4alxrmf3to1oaDr nei t0t2toir oodap  mivt t  rta( o;o1oexomfciysla2ea(mo t0 lxnmf3io1faDr uvs t s2ur(r3nu1olt  nvt s) rtr(mo;t4aetnmo3tyd m uanvpnu)tltrio ta1fpD  u olt)t2toim iu4om nmiei s sDum(r ;u1oltnmfciytfmDrmumo;t4areriocia1opDelnvs t)setmio iy4lmt mfvsas)arrru o;u4alxnioetlt s2el(mo u4treriociy1fpt  u o s0 rumio3oy4omenmfciat  2trx pnu0tet  fetadla em(mo;u4altrmfcoytfa eaivi;s0 rxo(rpoodape lfesa(fs2trxmonu4apx  fcildfa2ranmo ()texoircty1omD luvs s) etmxm3nu1optemfeslt sDrmx pno4alenioeiys m rln s ()teermo todom rln ol(0tetmxrpnydop e ivtl( s2umx o;t4tleoiieiytfm um(mpnt4trtoxr3iotlpDelnvilt0 2uoim3iudlle mnvias sDtmumo;o4opt ioeild s2ua( pn(4 rxrif3tadlm r ieo () 2xo(m io1amt lfeslt)srumumonu4tptnmoctytfsDrluvp u4 rtnif3tatlm eliei;t  exr(rpio1lpeelfvt s) rtmu pnu0tlxnmi3iatfm2em(ms t0 etrmo3oy1fmtrliei t setrir iy4apt  icsa()s2uaxm ot0aptn oeiat m2ra(vp;t4aeenxr3oa1om eanesl( t2umxm3oydal   nvslt) 2uaumo;t0oet mictlt sDrluvo;()tetrmrcia1lp rlu o s0teuo(mpoodoltelfvilsfs2tr(mpoo0aleomfetytfm umumpnu0 ltomrcoodfpDraiei;s0sexrxrpno4apenmfcsasfaDtmur nu1oeto o3tydlm2rau onu)tetnmocoa1opDr uvs;t0tetoxo3ny1lm  mies s  2rru o;t1aetoiieiadfs2ua(mont4trtoio ta1fpDe uei ( srtmxopoydap  lfet (fsDuaxmpoo4tle ii3tls s umn p u4 rxrio iydoat  uvi t0teurirpoodlm elfvslsfs2umxr ;u1tlx  iciasfaDrl(mpnt4 eerxf iodlaDraies;t s2tmxopiudll n ncsas arua( onu4aexniociltfaDrlnvpnt4aeeomf to1fpt au i (0srtmxr3iy1openmiviasfsrumurpnt4opt  feiltfaDeaums (4 eeoifciytoaDr u i s t2uoimpio1amenmfctl() 2tax pot4aeeo i3ilslsDean o;t)aeeoir oodoptrlies;t)texm(opiydom emfes s) 2trum ;t4oleomi3iytfaDrauvpnt4 etrio3totfa rluvs () 2tmxo ou4am  mnctlt)artaxrpnt4tleomo3ilt aDrm(mpnu4alxnxfctytlmDe uei ()sexr(m3nu1ope mfeil(fs2tau  nt4oeenmo3tat m2umnms;t) rtoifciotopDeaneo s0t2xoiopoodop nlietat  Drru pnt1tpenmf3ils m umnmo;u)tltnxo3todlpteli i t) ruo(o ny1op  lnet t)a2umum ou1apxoif3tyt a2ulnvs (0trxomf ta1omDeliesl( seto(r3iy4lpe  nvsatf Dtr(rpot1tlt ioctlt a ul( o;()artnmrcoodoa rau i;( srxrxopiodal  lfviltfa2uau ont1tlenmiciadls2uln p;(0trxnircoatom rlivs (  2toxm iu1llt mnesas)sDtaur ou4olen feiyd m eanmo;t0 eeomfctydfmDrauei;() rumirpnydomeemnvsa( srurxmoot1altnio3iydlmDea(mo u0artrmf iadlptranvi;s  2tr(opny1amtnmicta(farumxr nt4alxnmf3ilsls uanms;t)trxnio tydlatelnesls)t2xrxr nydomtemncsatfa2umxr ;t4texnioeils sDelums (0 renmr3oo1la ran sl()setmio oodolen nesl( s2tr( oot0oltomoetad sDumnmo (4 lxoxocoodoptr i i;() 2umxmpou1om nmfctas sDua( pot0opx ifctatls rmu on(4trtrxr3todom  lnvs s tetm(o oo1apt  nctat)aDum(mono1oetniicils s2emn o t4treomf tatfmt auvs;( s2umxrpnu4ol emnvs s srurxr nt4texnmi3tldfa rmnvs;(0trtnmfctadlat livo;s t2uo(o3iu4amt mnvsls)srra(root4alenmf3iltla ea(vs (4 rxnmf3oo1lpDraivi s) exoim3oydalenlfes tfsDtax  ot4tlxn o3tatfa emumo u)arxrxociotfpDelnei t)setmio iu4opeelfvtltfa2uau  ;t1tlxnif3iad aDrluvp;(4tetnmr3oodlmDeaivs;()srto(o nu4olt mnvsatfa2taum no0aeeo o3tytlmDuan p;u0altoircootfm  auesls0 ruo(rpoy4ll nlfetatf Dumu pno4aeeomoctadlmDumnvs;t0aexrxr ta1lp  lnvo (0 2toiopnydole micil(fa2ta(mpnt1tpe  ocilslsDemuvon(4tltnifcoo1opteai sls) 2to(m3io4llt mivs t a2uaxmoot1oeeo ietadfs2umuvs t0tltnxf3oa1lpteauei ( t2urimpio4amtnmfesat) Durxmpnu0olenmfeiytls2um( s;t0texrxfcootopDr nvo ()srxo(o3oy1optnmfeta(fa2tm(m ou4openmf3ilt s emumpnu0tlermr3oadlat  i s ( t2xr(opou1ll elfcsat  rumumoou4teeomfeias sDel( snu)tltnio3ty1lp  aies t0srtoxrpio4ameemieiatfsrtm(rooo0alxniiciydfmDra(mo;t)arxnmrcoatlptrlnei s) 2um(m iy1ol elfet t sDtm(r nu1olto fciyd s2rmn s t0trtnio3iadfm e iei ( s2um(m3iu1op emfvt (fs2umuroot4texoif3iatla ulumsnu4altrif iatomtraivi t s2ur(m oy4alte nvilt s2ururono0apxomf3iadfa ra(vsnt4teenir3totlm  au i (  etr(r oodamenmfct t)arrrumpoo1teeo fctas s uan p (0trtnif ia1lp e ieils  2uo(o iu1lme lneil(  Duaumono0olt iieildlmDelu o;u4texnxf totlaDrli i;t) 2tmim3no1lpee fvi ()aruaur oo1oexnmoeilsfmDrlu sn()arenif3iydlmDelies;s srur(r3ou4al  mfesat  2rrum ;u0texnmietysls eln snu)tltnif iatoa elnes;() ruoxopiy1omee fvtas s2umuro;u4opx  ieiat mDrln s;t0artrxocoy1lmDrln s s0teto(rpoo1omte icsl(fa2ur(rpou0opeo o3iaslm2eanvp (4 rxrioctatlpDrlivi ()truoxr3oo1lm  lfeiasfarurx pnu0ope moetldfs rlump;t0 eerircta1fmtrauvi t0 eurim oo1amtnmfvt ( sDtmxmpou1tlx ifeild m rauvs u)altnmfcoytlpte ueslt0srur(r nu4amtnmieils)sDua(mpot1alenmoctldla ea( p (0tltrio3oadlpDe i ols trumim oydoptnmfesatfs2tr(ro;u1tlto icias sDumumon(4arxnxf oydlp elu s t)t2to(o3iu1lmtnliei tfaDumxr no0aexnmfctldfaDel(vs t4 exnmociodfateai i t0 rtr(opiudlp elfetat)aDum( o;o4tpxomi3tatla2rm(vonu)alxrmrcia1lpt ln ols sexmio oudol n ivias)artmx  ;t4oleomfciasls2elnvpnu0trtrxfciadoptrln s;t)tetoio3ny4ameemici ()sDtrxmpoo1opx mo3iad a ea( sn(4 ltrxo tydomte nvs ( s2tmxr nodoleemivsa( a2rru  no0aeto fetasfaDel( o ()treoxocoo1op elnvo;t0 rxmxmpny1ale  nvtat) 2raxrpot1oex mf3tytlsDrmnvs (0tlxnio3iy1faDeai o;() exr(r3no1apenmivs (  Dtrxr nt4oex  ietls sDul(vo;t0arermo3tytfm rlueol( t2umxmpio1lme lfvt tfs2rr( pot1opxn o3iasls ul(mpnu) eeomrcoytlp eaueslt  rtriopio1olt mncil()aDrr(root4oet miciatlmDrauvsnt0aexoirciadfmtrlivs t0seur(mpno4apt mietatfsDuru oot1oexomfetldla2rm( pnt)aeeniocio1lmDr ieo s) etr(r io4lltnlnvsatfa2raum ot4teto ieilsfm2rlnvpn(0tltoiocoydlmte u ils0trurim3oodll nlicsatf Dua(monu1aeen fciltfm2ua( s u0alxnir3oydfmt an slt t2uo(rpny1ope lfetatfa2rrurpoo1tltnmo3ilslaDem(mo;u0trxrirciydlmtrli s t  2umxm3ou4am nmneiltf rra( ooo0oexnmieildfm2rlums;u4aeeoiocty1fmt li i;t) 2uo(mpnudlltnlfeta( sDrmuronu4opt mi3tyt a2ul(vs;(4areoxr3oydoa ean o (0sexo(o3ou4ame  ncil()a2uaxmo;t1tleoiiciasla umnvs t4tlenio iy1om eai ilt)srxrxo oo4om nlicsasfarrm(ront0tptn iciys m ulump (4 ltrir3oytlmte ueol(  euo(m iydlme mivsa( arrrxr nt0texomo3tyd a2rl(mo;t4altrmfciy1fatelies;t) eumim io1lm nmics s  Drmurpot1texn iciydfa emnmsn(0trtomo ty1lm   uvs;s) 2tmim3iu1alte fvia(  Drmx p;o4tee ifetad aDuanms;u)altomf iotopDeai i;( t2trxo iy4lm n nesls  Drau o;t1oeenmiciyslsDrm(msnt) reomo3ty1fpt lueo (0t2tm(mpoo1oltemneil( srtau poo0texnmoctysls rlu p;u0altoif ta1lm rai ilt)texoio3io1optnlicilsf Drr(rono0apt mi3tas aDrln o;(0aexrxoctodom eau s s) etm(o3nodlm nlfvs tfs2raumo;u0tpen ieiatlm2ranmp ()artnmfcty1oa e ies () etr(m iy1aptnmivsl(fsDta( pnt1aee  o3tatfsDrauvp;t0 ltoiocto1fmDeluvils0t2trxmpnydaltn nes () rtaump;u4tlx  i3iat a rmnmo;(0 exoircoydfa  livs;s)teuo(r iu4al nliciatfaruau p;t0tptomfeiyt m2emumo t4treoircoo1lm  auvo s) rxrio3ny1om e ict t srrmu  ot1aetn o3iytls ran on()arxnifctodlmD aiei;()s2uoxr iu4apt  ics t a2tmu  ;u1olt ii3iysfmDeanmp;()trenif iadoa  au s () eur(m oy1oltelicils)sDraum ou0olx mictyt a rlnms (4alxnxr oadoat  neils trxmxrpoudlmenlivsat)arurx  oo0aetn o3tasfs2eln s;t4aetrmf io1laD luvs ()texr(m3oodome  net ()sDta(mo;o1aex  ocildfmDemn snu4arxrxo3to1opDrlnei;s t2toxm3nudomtemnvias) 2uaum nu0tpxomo3iatfs rm( p (0tetnmf3ia1fa r u s;t) rtoim oodopt lnvtltf Dua(  ;u0opxomf3iydfa2eanmp;t4 etnif iatom rlneo (0 rtoiopoo4apte fvtas) Dumu  ;t0apxomf3iasfaDuln pnu0 lxnio3iytlm   nvsl() etr(opnu4apenmivi s)a2ta( ont4altomfctldfmDumn onu4aexriociadfmtelivi;t) 2xmxr io4llte fvtas)s2ua(  ;t0tlxn o3ild m2umn o u4tetnxfctotfptrluei;(0srxoio3ou4op n iciltfsDua(moou0tpeniicilt a2rlu p t0tlxomo3oatlptelnvslt)s2ur(rpoudlptn ncilt sDuaxmonu4tlxo o3iys sDum(vs (4treoif tytlpteanvolt sexmir ny1ol  mfeilt  rrmu pnu4tltn fetyt a2uaumo;(0trxomr3iadoa elieols0t2toim3io4openmivtls) ruaumont4opt iieiltlm eluvs (4 eerxo iytfm rliei;t0 exoim3iy1lpt  fvilt)s2uaur no0olxnmfctytls2ulu p t0 etnircia1la e uvo;s) 2uo(opoy4om elfci ( arrrxm ;u4apto o3ild a2eaumo u)aeermrctytopD  neo (  2xrxrpou4ol   nvtls  rtrur ;o1texo i3iytfmDel( s;(0arerir todlaD anvo (0 2tr(mpnydll emfei t) Dtrxmpnu4tpeomi3ils mDumn s t4areomr oytlmDe nvs ( s2toir3no1om  lneia()aDumu  nu1tee io3iltfm2rlnmo (0aetnxf3ta1fmD lneo;( srxoxo iu4aptnmicias srtauro;t4oltn i3iadls eln p u0tltrir3oo1oa eanvo s t2trxo3no1optemies s sDum(ro;u0aeenioeiytlm rau sn()artoiocty1lpt lu i;t) rtrxrpiu1ll nlics ()artrurpoo0tleo octad s rau sn(0aetrmr ootfaD aivs;t0trtmxo3iy4alee ivt tfaDrmx ooo0tltn ieiytfa rmnvs;u4alxrxfcoy1oateaueolt tetoir3oo4ap  lneta()sDurum no0ole if3tas a2um(vp;u) ltrmo tydfatr ieo;s trxoxo no1aptemnct t)artm(roou0oltniietatlmDra(mon(0tltrmfcta1lm  aiei;s t2xrxr3oo4lm elieiat  rtr( p;u4tltniocilt aDrmn o u) eerif ia1faDr uvils0texm(m3iy4llee fcia(faDtmx  ot0opt  oetas a2elnmo (0 lxnxr ootop eai sl() rto(rpoy1ope mfvilsf rtr(mpnt0apeomoetlt aDul( p t0 lxrmo iotopD li sls seur(mpnodame  ncsls  Drm(  ;o0olt moeiltfmDrm( o u)alxnxfcoo1fmDe iesl(0 exr(rpiodal  mnvi t aDtmx ooo0altoiiciadfs2umu s (0alxrio oodom r i s ()srxr(r3ny1om elivi sf 2urum ou0tpe  f3tasfs2eau o (4aexrio tatoa   iesls)texm(r3nu4altnlfciatf rtmxro;o1aetn f3iatfaDul( snu0 rxoxo todla e ues s)teumim iy4am  miesatfaDrmx ono1teto iciltlm2ulnmo t0 eeriociydom eln i ()t2umim oy4ol  liesas)artr(m ot0oeenifciltfaDelumont4altnmo3iadfateli s t)seur(o3oo4ap emiet s arrr(roou1altomfeiys s2um( o (0 ltrxo iotoa   uvol()s2tmxrpiu1am elneilsf Draumoou1tpx if3tydlmDrmumonu0 lerxo tytfaDeli sls seuoir oodame  netat)srumxm ot0oleoii3ias m2em(mp;() rxnxo oodlp  aieo (  2to(mpoudopenlnvils aDrr(rp;o4aeenif3iyslm2umu o;t) eerifcoatopDr ues s0s2uo(mpny4ape mnvta(fs2urxr no0altoif3tytfmDrlu p;t0 rtrxrciodlate ieo;t0t2trir iu4am   fvi sf rrmumooo0tptnifeiatla ean o (0trenmociadfp e uvi;(0srto(o3nydll   fcil( arur(rp;u1apenio3iyd mDua( ont0 etnifctatop eliei t0t2uoxr3ou4lm nlfcta(  2ta(ronu0aex ioeilsfs raump;t4aetrxf3ty1opDeli i;(  2uo(r3nodapee nctlt a2ua(  ;o4texnmi3ild m ulnvp;(0areoxfctytop ran i;(0t2xr(opiu1omt mfeil(fs2tr(r ;u4tptn fciydfm uanmp;(4trerio totfm e uei t0tetrirpou1alt  net s)aDrax oot0apxn i3ildfs2uaump;u4trenxf oodlp   u s (0s2toxo3nodam n nci (fa2ta(mp;u4alen fcild s um(vs u0altoio3oytlpteanvsls)t2xmirpoy1ap  lfeslt)arrrxro;t4oltn ociytlm2ua(mp (0alerif3iodlpDe ivs;s) rtr(m3iy1ap  lnes t sDrmur no1ope mf3iytlm2umnmo;(4altnif3oadlm e i o t0srto(o3nudap n icta( srrmur ou0openioeiyd s2um( pn() leoiocoy1fmDe nei;t s2xoxo3oo4ole mfcs tfaDumxmp;t1tpto ieiydlm ran ont)trtnir3iy1om elu o ( t2tmxrpiy4lm e ieil(fa2uau o;u0apx mocias s2ua( p;u4 etoxrctotfaD  uei;s0t2xr(o iudomte fvil( sDta(rooo4tle io3tld m um(vs;t4aeerio3oatlmtelieols)s2xo(opny4omenmnvsa()aDrax  ;o4oeenmfciyt s2rm(vsn(0texniocoatom r ieilt seur(opnu1opt lfcsl(farra(mp;o4altniietytls rmnvo ()tleoirctotfm  lieil(  2xrimpnu1llte fvtas)a2taxrono1opt  ociltfs2ranmp ()trermf3oo1lm  aies t  rtrxo nudam e nvias) Dtmu ono0ale  ociatfm2elumo;(0tlerxrctadomt li i t)teurxr nu1olenmiviat) Drmurpnu4apx moctltla ua(mo;(4 rtrif3tytomtraiei (0setr(m3nu4ap   fcias arrmu  ;t0olt mfctyt m emuvs;u4texnir oodoa r uvslt)t2triopnydome  neiat)arumxmono4aexo i3iad aDrmu on()aetrmr iadfpt aneo;t s2to(r3iudameelictltf 2tmu o;t1aleo oetltfaDemumo u0trtrmfcta1fmtrli i t  2uoxo3iudllenlnetlt sDumurooo0tleo fcils s2el(vp;()aeeoxf3iytoaDr i o t0sexmxr iu4ol elneta( artm(m ou0alenifctyd a2eanvon()areoxr iytfaD  u o s)s2xoxr no4altn fvtat)a2urum ;u4aetn f3ilsfm2umn snt4 rerirciy1opt lnei;t setoimpou4lmtn net s  rrm(ronu4opxo i3iaslm2rmnvpnu) eeoxr iytoatelues;s truoim oy1openlncilt)a2ur(rp;o0tpxoifctldfa2rlu s;t4artrxfciydfmt lu i t0t2uoiopno4lpenlncsls)arumxrpoo4aptomf3iyt mDrmnms;(0aeeoxf ia1omDrlivs;()trxr(o no4ape mivta()a2ur(rooo0aptomoeiydfsDra(vs;(4trtnxocoa1op  aueo (  rxmxr oudaltnmnetas arra(moot0tpenmfeiydlm em( sn(0treoif3iodoate nei s srtoxm ny1apeemict (fsDur(m ot1apx  f3ild m2emuvp;t0 rxnir ootlaDr neol( s2xr(o iy4apte nvtls)sDtmumpoo0tle  fciadlsDrmuvon(4arxoif3iodlat  ues ( s2um(o nudlm nliesl(f 2trx  oo4aee  f3iytfa rau pnu4alxrio3oydoatrauvs () 2tmir ou4ll  mfei ( sruau ont4apxnmoetadfsDua( o;u4 rtoio3iadfp r uesl( s2tr(m nodap e fesls aDtmxrp;o0opxomi3iaslmDrl( p u4 eenmf3iytoat  u ol()srxoio3nudame lieta()srrr( onu1oltnioetydls rm( on()alerxr tatop  ln s s0 rxoir ny1ll n iet t)artrur ;u1tlenmi3iydls umumonu0 rxnmf3oadoptelnei;s trto(m iudlpte ies t)srta(  nt1oltoifctldlm2em( o (0tetoxf3totlp eai i s)trxr(o nu1amt  nvsl()a2trxm oo1ape  fetydla2ran o;t4treoif3oytlmte ivol(0trtrxo3iy1lpen fvs s) rrr(rpoo4optoii3iatla2umu o u4trtnirciatop rlu s s)srxr(r iodaltemiesat  Drmum ou1openioeiys s ea(mp t4aeenxr oydop   n o t0s2tmxr ou1olee nesatfsrta(r no1tet  icildfa2ulnmo t4 lxnifciatoatrai ils)setrxopio4ap nmnvtas srurxronu0aeenii3ils aDrlumo;u0 etrxf oa1lmtrai s t0sexm(rpio4llt  fvt (  rrm(rooo0opt  oetlt m rmnvo;u)aeerir3oytlat  ivilt sruo(o3oodop e ictltf 2ra(r ot0optoifeiad aDea( p (4artnxfctatopDrau s s0s2uoir3ny4optemfet (fsrua(mo;o1tpto iciadlaDrmnmp t0tlxrxf tytfatr nesls trtm(r no4lmtn iet t srrax o;o4olenmictysla ua(vp;()tltnmo tydoa  aivslt)t2ur(opiu4lpee fvia(fsDtmur no1tpxo ieiatfs2umumpnt0 rtrio3oo1opDelivs;t0srtoimpiudlp  lncilt)srurxr nt1ole  i3ildfm rmnvo;t)arxrif3oydlmDe ieols trtoim3oydom  lfcs s artmu  nu4apenii3iaslmDra(vp;t)altrirciatfm r nvs t t2tmxo oo1lleelnesls  rtmxr ;u1oeen ictasla eln ont) lxrioctotoaDe nvi t0s2um(opio1aptnmnei s srtr(m nt0aeeoifeiasla2eauvo;t4artomf3oo1lmt aivolt0s2tmiopno1lm emneia( aruru ono1aeeo feiatls em(mp ()teenmrcootfptrau o;t)teumxopoy4oltemictlt)a2trx o;t0tex io3iydfm uanmont4arxrmrcoo1op rluvsl() eto(r3iu4altnmfvsas  rtm(  oo0tlxoif3tys a2em( pn(0treomr oo1oat anei;t)t2uoxr no1apee ict s)s2uaxm nt4oetomicias sDua(vp ()alxomf io1oate ivo s  rto(r3io4ame lfci ( a2tmxr ou4aet  f3tys s2rmn o;u)teenxr todoat  ueols)trxoxo oo1lleelivs sfsDrm(m nt0oltnmo3tas s2ra( o () rxomocty1optran ols)srxmir no1alen fvil( aDtr(monu1aexo fciatla2umu snt)tetrxo oo1oateln o;()trumimpiu1lmte nei t aDtr(  ot4apxo o3iasfs2rmu p ()trtnxo oo1oa   u o t trxr(r3iu4altelneil( sDtmx  no4tptomieiyd aDel( p;() rtnxf oadlaDrauvs t0t2trxr nu4ol emfvs (  2uau ooo4alxnmfeiysfmDraumpnt4tlxnxf oo1om  aues;s0srtoxmpno4ape livtls)a2uaxrpoo4aetomocildfs emu o;u)aleomf oytfatean s;( srur(m iy4amenlnvtlt a2ur(rpot4tleomf3iytls2eauvp;(0texrxf iatoatelnvolt0sexmimpnudale livta(farrmxroou0tleomoctasls rlnmo;u) leomoctotoaDe nvsls) 2tmxr3iu4lpenlfci tf rrrxmpot0altnmf3ild a eluvo;u0texrxo3oo1fa eai i;(  rtr(m nu4opt livt tf Drrxmpoo4tpto i3iadlm2eau o t)aexrxrcto1fm rli i;( s2toir3nodalenmfet (fsrtr(roou1opx ifeiltla2eanvo;u0 rtoxfctodfm e uesls)seumxrpiu1lp nlfvsls)srtmx  ot1oltnioeiatfs2rmump u)aeenmf oa1latrliesls) rxmim3no1olee ivtltfsrumu p;o4opxn ictltlsDul( o;t4aleoio3oa1fp eai i;(  etoirpno1opee iciatfsrtmu o;o4apenmf3iysfsDua(vonu4artnmf3iatoatrlnvi;s s2toxr iudlm e feilt aDurx oou1teenmociat sDrau p u)aetomocootoa  lueols truoio3iydal e nvs s s2umx pno4ale  fctlsla2ra(vs;t0artnxf3oy1latelues (0truo(m3oo4al n fvsat s2urxmooo0tetn f3ilsla2elump t)aeeoiocoy1om raiei;t setoio3iy1alt  nctat  2rm(r ;o4oetnifeilsfsDemn p;u) reoircootfateln slt  rum(o3iy1op  mfeslsf rtmxro;o4tlenmfctytls ul(vpnt4arxnmo oatoateanvs;t) etr(mpoudlpt mncta()sDumx poo1tpt if3ias a el(mp u)aeeomf tadfm rai i;s  rur(r3iu1ll n iei t)srtrxronu1ole iocilt aDea(vpnu) ltrif3to1lpt  nvslt0s2xrxm nu4ap n nvsatfsrtaumo;t0tet mfetatfa emn pn(0aeenxr3oatomDr ieols  2uo(mpnodlptemnvilsfaDur( onu1olxomfctltfaDrauvs;u0aeenio3tytfpDe n o t t2trim3io4omtnlnciatfaDrr(rono4texnifetyd m umuvs t0texomrciytfmteai s;s t2uoim3iy1omt lfetl(fa2trx  oo1aptn ictldfaDeanvp;u) exoxo iotom rln i t) exm(opio4lmen fvtat  Dta(m ;u4apt  i3iydlaDemnmo;(0 lxrirctotfat ln s t) eto(opnudll nmnvtltfsruau ont0apxnmi3iad a ean snt4 leoxociodfmtrlneo t  rtr(r3iodamt  nesat) Drrxmoot0oltnmf3ild aDuluvpn(0tlerir3iy1oaDr n o;t)s2trxopoo4al nliciat) Drm(ro;u0tle mociydla2ulnvp;u4 lxnio3oa1oaD luvilt) 2uoxo iy1omtelfctasfsrtmumpno1oleo octasfa eanms u)trtoxfcoy1lpte u ols)setoim3iy1olte icil(fsrrrur nt1teeo ictys a rlnvo;t) lerir ta1op raivs t0 exmim3oodam n netatfaDta(rono1ope mieias s2ua( sn(4 exoxo iodfmteauvs;s0seum(rpiu4lmt  fvia(f rtrumono1aetoifeias a2elumpnu0tlxoir ta1lpDe n i t)t2umim3ny4openlfesas) 2trx ont1optniociasls2uau o;t)aetnif tatlat auvs s  euoxr no4ll n fvs s) Dtmxmonu0opeoif3iasfm rmnvsnt)arxrmf3oy1omDr nvs ()trumirpiu4amtemneiat  rumum ;o1apt  fciys m ulu snt0treoircto1oa e n sls)t2uoim3ny4lptelfvias aDtrxr no4tpe ifctasfsDumnvs;(4trxoifcoydfa   n sls0srurir3nu4lp  mnvsltf Drax p;t1texn ictys aDeluvp u)teeomr3oy1lm raueo ()t2umxo iydale mfvi (  2rmur ;t4alt  fetad s ua( o u) rxnmo3iadla  aneols0 rtmxm oudopenlieiat a2ra(rpnt1aee  i3iasfm um( s;(4alxomo ty1fm rln o;s0seumir oodal   fci t srra(m nu4tetnmictydfa2ra(mp (0 exomo3to1fmteaivsls0t2urxm3iodom elietas  2tru  ;u0aeeomo3ild mDelump u4 rxrxf3oo1lp e ueo s truo(m3oudlp  lfvt t) rrau p;u1tetnmociytfm rlnvs t0texoir tytlmD  ieols srtmxmpiu1amte fctl(f 2um(ro;t4oetn f3tld m rlums;t)tlxnxf iydoaDrau o t) 2tmxopnydopenmiei t)a2rm(mpou1oleomf3tysfmDrlu snt4 rxrmf3oytoatr neils0s2xmxo nydopt  nvtat)sDtmxrpou0tlt  i3iadfa ul(vs t4tleomr tytlm  lieil( s2tm(r3oy1lpenlieiatfa2rmu  oo4tle miciysfa2ra( o;(0alenxr3oo1faDrli o t t2xrxm oudopt mfcilt)aDra(r ;u1tet mi3tyd m em(vs;t0teerxr3iydfa eanvs s seur(o no4lptnmfvi (farrrx oou1tptnmictasfaDrmnvpnt)aleoifciatlp   nvo;( s2ur(m3io4ome mnetltf Dtaxroou0oleomfeiys m ea(mo;()trenmf oydlmDean o;t0sexr(r3iu1lltnmnesa(  2ra(  ;o1texn iciad a2uanmo t) exnxf ootfatrli i t)srtm(o oodlmtnmivtl(fsrtrxm nt1opx moeiydfaDraumsnu4tlenio3oy1fp  auvilt texoxo3nydopte ivsls)arra(mpou1apeoifctltfm ul( o;u)aexoir3iytlmDeln s s) 2uo(m iodlme  fcs t s2uru  no4tleoif3iyt a2ua( on(4 eenxf tadoa  an olt0sruoio oy4ol   ieslt sDrrxro;u0tptniietysls2emnvo u4 rxomr3oytlmteai s;s0 2xmimpoo4apeelfeia( s2rax  nu1olxoio3tlslaDrmums;u0 reoxo3oatopt ln ol(0t2xrim3oo4am nmiviat srrm(r oo4optnmfetyd a2uan snt4 etrmr iy1fpDrauvs s)tetm(mpoo1olenlnesltfs2ur(rpno0aex ifciat m ul(vsnu4altoif tadoptelu s s  rxm(mpnu1lp nmfesat)aDrmxrpnt0aptoiietyt aDum(vpnt)aleniociadoaD  ueo;()tetmxopnu1oleelfvil(fsrrru pou1apx  ictyslsDemnmp;u0altrxf iytopte ueolt) exoiopnudape  fcslt)a2taxm ;u0tltoioeiyd a eauvo t4 ltnio iytomte uvolt) eurim no1ll   ici t) Durumo;o1alx if3iat mDulnms (4arxniocto1oatean o ( srto(r3iy4apeelnvslt arrax poo1oleoiociydlm2ea( pn(0aexnmf iytomt aivo;t0t2trxr oodol emfvi ()sDumx pnt4oetoii3tyd sDea(vpnt0arenmocoodlpte ues;t s2urir iudlm   fes tfsDuaur ;t1tltnmoeiyd m2ea( snu)artnmf3ootfpteluei (  eum(mpoydoleelnci s)sDuru  ot4oetomocilsfs2emnmo;(0artrmocoy1fptranei t)trto(rpno1altnmivias  2tmumpoo1aee mfeildla umnvs;(0tlxrif3ia1laDe uesls) 2trimpoodlptelfci sfarrr(  ot0oeeoii3iadfa rmumont4 rxoifciotlaD an olt0t2tr(mpny1am nlfet sfsDtm(m ;u4tlxnmo3ild s2elnmsnt) etnio3todlp r ieo ( trxm(opoy1openmics t)aDrmur ;t0oeenifeiaslsDumuvsnu0teeoiociodfp r ieol( t2trxm no4lpenmics (fsrra(rooo0apto oeias a2rlnvo u0tlxomocoo1om  luvs s)t2urim nu1ole lfciltfsrtm(r no0olto ietytfa2elu p;(0 rtnio3iotoaD an ols truoxo ou1om  mnvils arumurpot4opt iictatlm rmums u)tlxoirctydopt luvs t s2xrim oydol nmfciat)aDtr(r ot4oetnmoetytfsDeanms;u4artnxr3io1fmDrli i (0teuo(mpio4aleelfctlt)a2tm(ront0apxnmi3iadfsDrmu s t4 eerxfcty1fmDrlnei s s2umim iu4ap n ncs (f Dumx pnu0openmfeiat m2emnvo t)tltrircoydfmD lnvils)texoirpny4opt mnesat) Drrxmont0aexn f3iad m el(vpnt4tetnxf oo1lmt li olt0 exrxrpoydapte fesatfs2rm(monu0tptnmo3iatla ua(vp (4alxrir ootfmDran s ()sruo(rpio1alte nvtls)aDumx poo0teeoiieiydlm rm( sn() etrxo ia1fm rai sl( truoir ou4lmt mncilsfs2ta(rpno0tltniieiadlaDumuvp;u4 exrxf iy1omDelu s;s0 rxmxrpno1lmen ictatfsrurxmpot1tlenif3tydls2rm(mp;(4 ltoiociytomDe ieolt0s2tm(rpny4apte fvil() 2taxmpou0tex  f3ildfs2um( pnt4 etrmr3iodomD li s;t0 rxrxm no4lmtn icia(farta(  ;t1tex  i3tydla um(msnt) rxrmo3oytlaDrluvs s)tetmiopiu4lp emnvtatfaDra(r ;t1apto f3iydlmDuauvont4 lxoxocto1fat aies s) rxoim iu4amtnmnetltfsrtmxm ;u1ape ii3iyd s ean s;t) rtoxf3todfp r i s;s teuoxrpiy1ale  fcta() Dra(rp;t1tltn fciyd m ua(mo;t0 eerio3oo1fpt lnvol(0 euo(mpnu4ll nmies s)srraxr ot0altn ociasfa eauvpn()aleomr3oo1omDr nvo s)t2toirpio4ll elicsa()a2uaxmoou0olxnmociasfs2rmnvp (4texrmr3iydlp   ieils0tetmxopno1apee fcsl( s2uaum ou4aptniocildlsDum(vpnt0 rxoxr oo1fm eaiei (0srurxo iydope lnciat  Dumxmpoo1ape mfciasfsDran snt)aeenxr oodfpD  i o;(0teur(r nu4ape  fvias)srtm( o;t1tlxoioetltls elnmp;(0 lenxo3oydlmteaueils0texoxr oo4amtnlnct s s2uru poo0apt ifciad aDumuvo t0altnioctatfptran o s s2xoxr oo4lpenlnetls aDtmx p;u0teenif3iydla elu s u4teeoxf3iytlptrlieo s0trxo(m iu1lptnlfvsa() rua(ront4tlxnmoeiadfm2umuvpn(0 rtoif to1oaD  i sls)setmxopoydam  lictls  rrrxmoou1opxnifetatfsDem( p;(0aeenmfcia1lp r uvi;()trxmim oudlptnlict s) rrrx  ou0aexnmo3iys aDrm(mp t)tleoxr3io1oatrauvs;t  ruoxr3iudlp n ncia( srrm(mpno4opt  ieilt mDrluvs;u0aeeoio oytlmD li o;s0 rtrxr3io1omeemicsatf Duaxmoot0oexoifeiyt sDeaumpn()alenio ia1oa eauvi;t0 2xoxr3nu4aptelnvt t a2umx o;t1oltoiieiasfsDrmnvp;t4trxrmf tytlmDrai s (0 rxrxm3oudamee ies tf 2rau p;o1tex iieiadfm2rl(mo;()alxnif io1fa ranvi;t)trumio no1lmtelfesls srta( p;u1tlxoii3iadfmDul(ms;(4 lxomf ia1opDrln ilt) exmio iy1ale miciatfsrumxmpot4aetnmiciaslm2em(vs u4 ltnioctydfmDeau s (0 etmxo3no1ol  livi s sDrau pno0aptomiciadfsDem( s u0aexomfcoodopDraivs s)sexo(r3iodamenliesa(fsrrmu ono1olto fetytlsDrln o t)aleomr oatoat lnvil(  rxmio nu1lmtemnesat) rrm(rono0tlxn fetldlm eluvo t) rxomr oy1op  lnvol( t2uoim iodlpeemnvtatfsrtaxr no1aex  o3tldlm um(ms t0 rtnxfciytlaDean i (0sexmxrpny4lm nmnes (fs2rruronu4tlto f3iat s2el(vont0teeoio ootoaDran s;t0s2umir3oo4amtn ictl() Durxmpno1alenif3tydlsDua( snt0arxnir3oydfa ean o;s)trxoio3nydlltemfci sfsDrru pou0tpe ifetad a2ua(mo ()teerxf3iytlpDelu ils0seumio ou1ll  mfci s) Dra( pnt0apeo oetadfa2el(msn(4aleomfcoydfaDrli o;t0t2xrirpiu1lleemfctltfaDum(moou0altnmociytls2el(vont4aeeomocoatfaDe neilt0 2urxr iudlm elicsas)arrax  no0olxo ieiydla um(vont)arerxo totlaD  neol()s2um(o3iydoltn icilt a2uru pou1texoii3iltfs ea( s u)teeomr iy1fpteliesl(0srxoir3nu1am n nesas)srum(mpno4ape  octyd sDua(vp (4artrmoctytlpt  u s;s) rtrimpno4omenlfcs (fa2uru o;u4aexnif3tls m2rau p;()aetrmo3oatlpD li i;s0s2urxo3iu4lpt mfvt t)s2trumooo0oeen octadla2eau s (0 reoif oatoa   nvs t)trur(o nydaptnlfvsls)srurxr ;o0tle  i3iadfa rauvp;(4teeomo oo1lp   u o;s) euoirpoodap nmivtl(fa2tmxront4aeeo fctadfa el( snt4 rerioctatoa raivi;(0srtm(m3no1lm e fciat  Dtrum ot1aexn ietytlmDuanmp (4 ltnxocoodfm rli o t trxr(m3iy1lm nmnvi s)srtr(rp;t0ope ifciad s2ranvon(4 exriociydfmDr uvs;s)trtrxm3oydllt  ict ()arurx pot4tetoiocildlsDulnvo u)arerxrciadlat  ieils setrimpou4amen icil(f ruaxmp;t1oetnii3tytfa raums u0arxnmo3totlm  lu sl( trtrir ny4lp elivia(fa2taum ;t1tlx mfcilsfa rm( ont0aleomrcio1lpt aieo;()trtm(rpio4lp n fet (f 2uaxmpoo0opeoiiciys aDemnmsn()trerxf3ty1opDelu i () 2urimpiy4ap emfei t a2taxmo;t4oet  feias m ua(mo u) ltnirciotoat anvsl() eur(o3oo1al  mnctat)aruax  oo1oeeomi3iadfm2rlnms;t4 etoxrcoatom rlnvs s0tetmxr io4aptnmivt t)a2rmum no1opto i3iysfa2rluvp t0 exrxociatlaD an o ( srxrir iydop e fciat sDra(rono4ope mietlsls ul( snt0 leoxf3to1fpt lu ils  2toxrpiu4lle mfctls  rtr(mp;o4tetoii3iltla2ulums;t0arxnxo iy1fatrlu i t  rxrim3no1op e nvia( a2ta(r oo1tlx mf3iyt a elnvont0 rtrif3oodom rlivs;s0srur(opnu4amee fcsa()artaxm ou1aptn iciydlmDemn ont0trxoxoctodfpD au s t  etoimpnydamtelfeiat)aDrmxm nu1apt mfciltfmDemuvp t0texnxociy1omD lu s;( trxo(opnodoptn ncsa(fsrtruro;o4oexomf3iatfs rln p u0alxnif ty1lp e u s t texrim iudam n fvs (f Dum(m ot1opt mictytfmDrauvo (0tlerxrciadfmtraivs;( setrio3io1llen ncilt a2umxrpot0aptomicildla2ua(mont0 lenxf3iotop   uvs t0t2toxm3oudaptelivia(f rra(  ;t1opt  i3iytlm eanms;u4 ltoxf3tadlptrlu ilt srumiopoy1ape liesls srrmu  ot0opeo ociytlsDelnmo ()tetrmf oadlptrau sl( trumxopiydopeeliciat artmumo;o1apx mf3ils a rmnmonu4teenir oy1oate ueo t setmxm3nudome mnvtat sDtm(  ot4opx  iciysfsDrl(mp u) etrio3oydlp rau olt tetrxo3nu4ol  mietat)aDtm(r oo4apenmfciydlmDuau o t4 etrmr3ty1oaDrlieo s t2ur(m ny4ame lfeiat)srtax ooo4tpt  o3iatfa rlnms;u)artnir oodoa   uvs;t)trxmirpou4al nmfvtas)aDrmu  nt1tptnmicildlm rlums u)trenxfciotlmD  i sls0 rxoxmpoo4am elivt ( a2trxrpno0oeen feiltlm2rlnvo (4 rxomrcoy1fmtr n i ()texmio ny1amtn icslt  rtrxrpoo1tpx ii3iadfs2uluvs;t0 etrxf3iytlatr nvs ( setm(o nodalenlnvsltfs2trxro;t0ope io3tat m2uln s t0 eermo3oytfaD lu s;s0 euo(r3nudamt  nvilt)srtmum oo4opt  fciad m raump;(0tltoxf3oadlaDrlnvi;t) 2umir3nu4amenmivt tfs2tm(mp;o0tltomieilslmDeaumpn()trtrxo3ootfp rau i s0 ruoir io1olee net tf 2trxr oo0texn i3iyt a rlnmo u0tltrxr ty1fm eluvslt0srumir ny4lmtn ncias)a2tmxmp;t0tpx ii3tldfmDeanmo;t)alenio oy1fpDe ivsl()seumxr oy1ameelivtlt s2taumpno0oetnif3tltla rlnvs u0 leoxr oytfa rli o (  rtrxo3ou1lm   nct sfsrrm(  no4opx ii3ildlmDem(msn(0aetrmrciy1fmtranes ()teum(o3oo4ap   iet ( s2rm(r oo1alxnmietld m2uan sn(4alxoxr todlptrlu o ( t2xr(r oy1aptnlivil(f Durxronu4teeoii3tytfa2rm( o ()texnxo3iatlpt aivil( trurxm iy1apenmieilsf rtmxrp;t4apx io3ilslmDranvpnt4 lxomf3iydlmt  uvo t0srtr(o nudomenmnvtas sDrrurp;o4olt miciaslm2rau s (0treomo todfpD aivslt teuoimpiodamtelivi tfarururp;t0apxomfeiasfs2rauvs u)tlxrxo3iatlateln s;t0 2xrxmpiu1op   nvtlsfarraurono1oetn icils s rmu s;(0tlermocoa1fp   i s t s2tmir no1lp emfvil() rrmur nu1oeen feilslm umuvs (0arenmo iadlmtr n o s0trxo(mpno1opt lnei t) 2urx o;t0olxo fciadlsDumumpnu)tetrxfcoydoaD  neolt texr(o io4lleemfvtat)aruau poo0tpxomo3ilsls2eau o (4aeeomf3iy1fate nvol(0 2xm(o3oy1openmnctls arrax  ou0alxn iciadfa ean onu4aexnxf3iatlatraiei;t0t2tr(m ou1alen nesa(  Duaur nt1oee  fciydla rmu on(4 rtrmf3oadfatelieols0s2umxo3ou1olt mnvsa(farta(mooo0olxnmo3ild s umn s;() etoxr3ia1lmte ivs s0 etrir iu1open nvsat a2rru pou1aex mo3iyd a2uauvs u) rxnmf oy1fmDrlues (  2urio io4lp nlivi (f 2umxm ;t1texomicilsfmDeluvp t4artrir oodlpD  ieo t)trxm(m3oy1ol nlnetatf Drrur ;o0tpeo octyt mDumuvpn(0aeenmfcty1om  luvs;(  euoim3ny4ol emfct t sDuau  oo4alt iieiydlm2eanmo (4artrmf tydlm elivsl() 2xoim3iudlmte nvta()sDrrxroou0apeoioetysls elu s;(4tltomfciodfa r ues;t t2urxm3iydllteliei t) Dua(r nu4oetomfetatfsDum( o;u)tlenio oydoa raivi s) exoxmpoo4lm  mfcsas a2tau poo1opeomi3iatfsDel(vo t)aeerifciatlp rlnesl(0teur(r3nydllt  icta( aDrax  nt0oleoii3iytfa rmums u0 rxnifciotlmtraueo t)s2xr(o oodlltnlnviatfsDrmum nt4optnmo3tytfmDul(mo (4trtnircto1oat lnvo;t0 rxrxo3nudolt lfcsa(  rrr( ono4apxn ieiytfmDeluvsn(0aeenxo oadfp r n i;()teuoxmpoodlm  licslt  2ta(rpnu1ole  iciatfm2rmnvsn(4tetoxfcoo1faDelnvils  2tm(m3oodalee nctlsf rrm(mp;t1tex ii3ild m2rmuvpn()tltrmr3iytoaD lnvo;t0setmxrpnodomtnmietatfarua(ro;u4aexnifciyslm eanvsnu0tlxomf3ia1oaDr neol(  rum(m3no1lpenmivt sfs2trurooo4opeomociydfs2emu o ()alxrir iy1op   ieo s)s2uoio iydlm  mict s) 2rr( poo1tpxomocils s2ranmpn(0altoiociadoaDeau s t0s2xrxm iu4llenmicsl(f Dumump;u4teeoifetasfaDra(vs u4trtrmf iytfmt ai s s0srtmxm nydlmtelnvsls aDtrx  ot1aeeo ociltls2umu ont0trxoxf3oadfmDeauvi;() etrxo nu1lp nlivtatf ruaurpno4ape mieiatls rm( s;(4artrifctodop rluei;() etrxm3oy1lpe mnetas)arrmx pno1tpeomfetlsfs em(vp u0tltrifcoy1fa   i o;()t2trxo nydllt lneiasfsDrru ooo4ape mf3ias s2uau snu4tlenio oy1laD aivi t0s2tmio3ou1ale mfeiasf 2taxm ;t0tpto fctls aDemuvp t)trxrxf3iadlm raivo t0 exrxo3oodll elietltfa2trxr ;t0oetniiciyd a rmnvp ()artoxr3ia1latranes;()srtmxrpno4apt mfvi t sDtaurp;t0oleomociyt a ul(mo u4 etrirctytla  ai s ( s2umxrpny1ll nlfvt s aDta(rpno1aex  i3iysfs2elums;() ltrmfcoo1om   neo t) 2toiopoo4omtn netlsfsruaxm nu0tle ifctadlaDeln snt4trenmf3oodlaDranvi (  eumxo iydomtnlfei s  rrmumono4oexn ocilsfm elums u0teerio3oydlpte nvi;t  etrxr3nudop nlnvtat)sDrr(  nt0oltnmo3tatfa2rlumo;()tltrmo oo1fp r ivo (0 rtmxr3ny4lmtn iviat sDrm( p;o4tlxnifcilsfm2emn on()altrir oodfateauvs t0s2xo(m3ou1ope lictls srrm(r ou1altnmociatfa2um(vo u0 lxoif oodop elivi t0sexr(mpio4llenmiei (  2umxrpnt4tpe  fetyd m2eauvs u)trerxf oydfatean ils) ruo(r3oo1omeemici t)arrmx pou1apen i3iydla2ea( s;t4aetnxr oo1om e neil() rum(r3nu1op  mfeta()a2tau  oo4aleniiciyslsDumnvs;t) rtnmrciydoaD lnes;s)t2uoimpno1llt lnes t)s2rm(mooo4teeo fctysfm2rl(vo (4 lermr iodfpDeau s (0 exrir3iydom e fvsa(f rrrum oo1tpt ifctydla uau p (4 rtoxf3tytfmDrlueolt)trtmxrpnu4ol n net (fsDraxmpnt1oleoif3tydfa umnvo;t)arxomo ootomte uvols s2xo(r3io4lpenlfvt (  Duaxmp;u0texniictaslm2eaums () ltnmociotla r nei;t)t2um(m3ou4aleelncsls) Dta(rp;o4tlx mociadfaDrmuvo;t4tltnxrcto1lp ean i;s trur(rpio4aptelnet ( sDtr( p;u4oexniietltlmDra( p (4altrmr io1om eli o t)trtoimpiy1apee fvt (  rururo;o4apx  f3iytlaDrmumpnu0aetrmr3oadoa  anvo;t) euo(m iu1lpt lfctasf 2tau  no1olen ocias aDuan pnu0aetrxr tadom  an o t srurim oo1amt  nvtasfartrxr ;t1aeeoifeiytfs2uln pn(4 rxoxo3oydop ranes;s) rtrim3nudop e nvi tfsrrmxro;u1apeo ociytfaDrmu o ()aetrmr tytlpDe nvi;(0t2xoio iydllen fcsl()arra(mo;o0ope  i3tltlsDrau on()tlxnxo iy1op eaies ( s2xoxm no4ome mfeia(fs2trur no4aeeomo3tydlsDeaumon(4 reomr tadomtrlnvs;(0t2um(m3iudam nmfvsasfaDraumo;t0opxo i3tls m2elnvo t)tetnmo oy1la r iei (0 2trxm3ou1ame lnvtl(fartaxrpnu4alxo octytla2rmnmo;u4aexnmo3to1fa e nvo t srurir iy1alt lneil(farrr(rpot1aptnii3iyt a2rl( s;u4texnio oytlp   ieo t0tetm(mpnudlp nlnviat)aDrmxrpnt4teen feiysfsDul(ms;t4teenioctatlatrai il(  eto(mpny4lpee fcsl(fs2tmxrpou1oeeo iciasls ran o;()tetrmf tadfpteaieo;( trurxopny4lle lfct s arur(r no4tet iiciyt aDrmnvs;()trtomocia1opDranvi t) exoxr nudomen netlt s2rrxr ou4apx  i3tlsfs rl(mp;(0tlenio ootoatrli sls)t2uoxo iu4om  mnctlsfsrrr(mp;o1tptnmi3iltlm elums u4arxrifctodfatr n s;t0trtmxr3oo1lmtn ivs tfaDuaurooo4olt ioeias m umuvsn(4 rtrxo tydfa raieo s0 eto(rpou1lmtemieilt)sDrm(r oo1aeeo o3iad a2umuvs;t4aleoxr iodlmDrlnvs;s tetmim oodlp elivi t)sDum( o;u4oetnii3iyt aDua( s t4 eenio3todfmt  uvol()trxmio3nydlpt mnetas)s2rm( pot0tetoiietas sDeluvo (0 leoxocoatoptraues;t truo(m iu4omee ivi tfsDrmump;t4tpt  ieiydfa2ua( s;u)altnifctytopt  nei;s0 rumir3oy1altnlivil( s2ua(rp;o0opxn oeiyd mDulumsnu4arenirciotfatrauvsls0trtoim oo4ol  mneilt)aDuauro;t4texoifeiys a rluvsnu0tlermo iodlpteliesl( texrir iy4om  mncta() 2um(m ;t0oltoioctytfmDem( pn(0 leoxr oytom  aivi;()s2xoim nu4lp elnci (fa2rmx poo1tpx  ietatfaDra(vs;(0trtomo3ia1lptr uei;() 2uoxo3no4lmtnlicsasf 2rmxmpoo0oetoii3iat m el(mp t0altrif oa1lp raivilt texr(o nydamtnmivt t sDta(rp;t4alx iieiytlm emuvs (4alerxf ia1op rai olt)setm(m3ny4apeemfetat arurxrooo1aet  fetyslaDem(vo;t0altrmfcoy1oa eln s (  2umxmpoudll   fcias)artmxmo;o4tltomieiydfs2rln s;u0aleoxo iodfaDean s;t s2umir nodll  lietls aDuaum ;o1apeniietydfs2rlump;t)teenmo3ta1om ranvil(0trxmxr nodlmenmivsat)arrau p;o4apto o3tyt sDua(vo;t)aexoxr3ootfptr n olt)tetmirpio4ape  icilsf rrmur no0tlx mfcilslmDemuvs ()texrif iatopD lu s t0sexoxo oydll n fvtlt)sDtrx p;o1aee mo3tlsfm2rlump;()artrmf ta1fpt auvolt)t2tr(r oydlmtnlfvilt)a2tm(r no4olto ociytfsDea( p (0 eerircio1omDraieo s)s2uo(m iu4ll nlivi s) rtm(mpot1apeomfcildla emn s;u) lenxociy1lpteanvol( setmxm nodolen nvi sfsDtr(r nt0oetnmoeiat mDrm(vs u0 lxrmr3totlaDrln olt  exmim3nu1om elnci () Dur(moou1aleomieilt aDelnmo;t4arxnxocta1fm eaneilt0 ruoiopio1lltnmietltfsDurur no1oleoiieiat m uaumo (4arenxr3tadfa  lieilt  2umxo3iudolte ivt (  ruau  ;u4aetnmoeiltla2ua(mp;u4tltrxr to1fm rai i;s)s2xm(m iy4am emiet t sDrm(rpou4teeoifciytlm2um( p;t)tleoxrcoatlpDraivsls0t2urimpiodoptemivsa(f rumu pot0alxn icils m elump (0 etomr iy1lptraieo (0srxrxmpny1ap elnvsasf 2trxmpnu0apxnifciysls umn o;u)areomrciadomDelieo t srxmxr3nydol  lncsa(fsDrmxr ;o4ope mfciys sDeluvo (0 exnxr3tytfaDraieo s t2umim3iydame mnesatfa2uau ooo4texn o3iysfa ua(ms;t0tlxrxfcootopDrlies;(0teuo(m oudlm  lietl(faDrauront0opeomi3iltfsDea(vo;t0 lerxrcto1fat lnvi s0seurxopnu1lmt mneil(f Drmxmo;o1tpxnmiciasfm2eluvpnt4trtrxf ty1omte ues t0 rumxopiodlmeemnct t  2raxrp;t0apxnmfciys m2rln s;t0 ltrmf oytlm  an sls  rtoxr ny4omtn feiat aDrr(mpno1texnmieiltfm2ulums;t)arxoirciodfmt  ivo;(  rur(o3io1ap nmiesltfarrrx o;u1oltn f3tlt m ul
\ No newline at end of file
@@ -0,0 +1 @@
+n slt0t2ur(mpiy4ole  ieilsf 2rm(m ;o4olxnmo3ildla2ulumo u4 lerxr oydfm   i ils tetm(m3iydllee ivi s) 2umxrpnt1tex iociltfa2eau s;t)altrmociydlm rli olt0srxoim ou4ope lnvsat s2tm( poo4apx  icildla2rm(mo u0 eeomfctodlm eai ils  rumir3iodamtelics s)a2tau oot0oleomictyt s2eauvp;(4tetomf3tytoaD aueols t2xmxo iudape lfvt s aDrrxmpnt1tpeo fctlsfa rlumpn(0 leoxf3tydopD anvil(0 etr(mpiu1optnlnvs ( sruauro;u0olenifeilsla2rmumsnt0 leoxo todoat aivo;s0t2xr(rpoy1am e icsatf Dtr( o;t4olen oeiydfm eanvs u4tlxomfcoydlmD  ueo;t)tetoxrpny4alen fetl( s2uru  ou1aptoiociltfaDelnmsnu4trtrmrcoa1fmDe u olt) 2tmxm3ny1lptnlnct (fa2trumoot0teto ieils m2rlums;t4tetrxr3iadlp  li i t  eto(o3ou4ol emnet ( a2tmx poo4altnmo3ildfa2ua( s t)areoxf ootom  lu s t) 2um(o3nu4alt lies t aDum( pnt1oltomfctydls2ul(mp;u)trtnir3iydoatraies s) etr(opoo1alt mfetlt)arrrxr ot1oeenifcilsfmDemu o t)trtrxo oytopD aieo;s0s2ur(opnodol n nes (  2ururpoo1olxn o3iat s2eln p;u4artnmo3tydom  luei;s)s2xo(r oodoptelivtl(fsrrau  nt1aetn iciadlmDuauvo t4 leniocoy1opD ai ol( t2trxm3oo1lpenlivsa() rtmxmonu4tpenmfcildfaDemnmp u)alerxo3ia1lmDe nes () rxmiopiy1lmee feia(fsrtmxm no0opt  fciatlsDemn s t4tltrxf oytop   nvi;t)trxoir3oo4lp e fes () 2tr(m ou0oleo oeiyd m2rau sn(0altrmf ia1om elues ( seto(rpnydapeemfviasfartr(mooo4oeto i3iad s eluvp t)tltrxr3tytom raivols)srur(mpnu1opt lnvslsfs2ta(mp;o4tpx iietat s rmnvp t) eerif3ootfat anvs s s2urimpio1lp e ictltfsDta(  ou0oetnioctasfmDrmumon()alxnmo3ia1lmD  n i t0srxmio3iu4omtnlict t) Dumx ono4tltomoeiaslmDemu p;t0aexrir oadop rauvi t0 rtoim ou4apt lnciatfs2umxroot4aeen fetysfa2emumsnu)alxnir3tytom raueils)trtoio oo4lp   iesl(fsrrmu p;o4tee mf3iadlmDelump;t0alxomo3ty1optrau o;s) 2xo(r iy1llt licsa(f Dra(r oo4teeo i3ias s2umnmsnt4trxrif oodfmtrli ol( t2uoxr iudap  lnvias sDtaumpoo0oexoifeiytfa uaumpnu)alerir to1lmDelues s0teuoxmpnu4lpenmivtat  rurx  ou4olt  ociyslmDelump u4alerir3to1la  ln i t srtr(m3iu4lp  mnvi tfsrrm( p;t4texo icilt mDrmu pn() lxnifctotomDr n i (0trto(mpiy4omeelicsasfsrum(rpnu1tpto ietyd a el(monu4artnxo ootfpDraueo;t setrxo oo1oltemfeslsfaDrmur ;t0alt  feiyd s2rlumo u4 rxoifctytoate nvsl(0 euo(mpoo1ol   iciat sDua(  ;u4oleo f3ild sDeanmsnt) reoxr oa1fa  aneo ( s2urim oy4lpee iviat a2trxro;o0tex ioeiltla2rl(vo;t4tltrmrciydlaD  i s;(0 2xoxrpnodome licil()sDuau pot4texomfetat s el(vsnt) rtomo3todlp r neils0teuo(o no1apeelnesls  2ra(mpou0opx mf3iysla rmumo;u4tlenio iadlmt  ieilt seurxopiydomenmnvilt) 2tm( pot4apt miciyslmDrm(vpnu0 etomfcia1op e nvilt texm(o oy1om  licsls)sDtrum ;t0opxnmf3tlt mDulnmp;(4 lerio oodfmt lu ols0s2tm(o nydamtelfvtlt artr(m nu1alenif3tytfaDrmuvp;t) ltnxrcoa1oaD aueslt)seumir nodomteliesas sDtr(mo;t0optn fciydfaDumnmsnu0 exoxr3ty1omt anvo (  etrxmpnu4am  mfvt s a2raxrpot4optn o3ildfaDua(mon()alxomo iytopDr ues;t)setrxm3oo1ll emnes tf rtaumont1alt  feild a2ul(vp (4trtnmf3oytopDr ivo;s0trur(mpnu4apee icta(fs2ta(mpoo4tlxnmoeiydlaDrlnmsn(4 rtnirctatfmte neo;s)trur(m nu1ale lfci ()sDrrumont0tpx  oeilsfm2uanvo;(0aeermo3tydopteaivs s trum(r3ou4ll n icil() Dra(  ot1tleomocild m2ulnvo;(4tltoio iadomD lneslt)trtoxrpoo1ol n nvs s)srumumonu1aex iietld mDulu s;(4trxnir oa1lmD lnvo;s0t2to(opnodlmeemfetl() Dtr(root4tlt moetysfm uau snt4texnmr3tydfpD  nei;s)s2uo(r3iudaltelietl(f rrmxrpnt1apen fctadlaDrmn snu) lenxo3oo1lmD  ies;t0srtrir3oy4altelnetls)artr( pnu4alt io3tlsls2rlnvo;t4tlerio3tatlmtr nesl() 2xrir ou1amtnlfesl( a2rrx  no0oexnmoeiytfmDrmu p u4texomo tatomD  n ols)trur(o iu4om e nes () Dtmurpot4aeenmf3iatfsDeauvo;(0treoxf3tatlptrlueol( teumirpoodlpe lfcil()s2tmxm oo0apenio3iadfa2em(vp;t)artoxocoytlptraies t)teumio no4omt mfvsl(f Drrx ont4oeenmieiysfa2em( o;() rtnirctadfmteauvo;t srxmio3nydlmt lieias a2um(mo;o4olto octyt mDel( snt) etnif totlatr nvil(0 exr(m3no4apt mnvils) 2tmu oou1tlx  ietydfaDulnvp t) reniocoadfaDeln i;() etm(r3oy4am n fet ( arumxro;o1altoifetlsls2ra(vp;()trtnxf3iadomt aneol(0 rxmirpou1olt lfvtasf ruaumpnt1olxnioeiltfmDulnmont0altoxf3iadlm r nvol()srtoirpnu1lm n icias aDrmxmoot4apto o3iyd mDel( s;() eeoir3tatfmt aies;() rxmimpiudol emics ()sDuaur ou1teeo ieiydlsDraump u4arxoxo oydoa rlivi;t0tetm(r ny4omtnlfvi sfaruaur ou1aeen f3tysfmDumnvon(4 exoxo oydfat  ieo;t)t2urxm3oodale micsa( srumx oou4tpt mf3tydfa2rauvp ()alerir iadopt lu ils trxoio3nydope mictas) Dtaxm ;u4opt ii3tldfm uluvsnt4arxoxrctytoa elieo s0 2uo(r iy4ll  mfvtasfsDtax poo4altomieilsfsDrlnvp;(0trtnifcoytfateai il(  2tr(opou4omt liei s sDua(rp;o4aptn ieiytlmDemnmp t) exnmociodfmteau ils srur(mpnu1lpt mfet sf Dtrx pnt4tet ii3tytla rmumo;t)altnmf oo1fmD auei;t  2uoim3ny1ll emfvt s aDtaxroot4tpeo fciytlm2uau s;(4aetrxo oa1fmDrln ols)t2uoio oodam   nvt s  rraurpnt1tpe mfeild mDea(vp (4 rtrmr3oydfatranvsls trurir iodomt lncsat) 2ta(  no0aexn i3iys m2ra( s;u) lxrifcta1lmtrlu i () exmir oydlp e fesltf 2raxm no1teto f3iadfa2ra(vpn(4 rtrmr ty1fpt lnei t0setoim3nudllt mnetltf Dtr( poo4tlx ifctysfsDumn snu4treoxf3oatlmtr neilt0srtoimpny1op   ncta( arraxm ou4optomfeiytfm ea(ms (4 reoxf oodlate nvils)texoxopiodopt livtas aDrm(  no1opxomi3iydls2uauvp u4 etrxf ia1opDrlneo;t truoirpou1omte iet ( artaxmoot0aetoifeiatlaDemumsnu0trtnio3oodfpD auvo;s0trxm(r nudol n nci (  2rmxmono4apxnioetatlm2eluvp t0 leomo3ty1op ean i s)trto(r3ou1llt lieiasf 2rr(moou4texn f3iadla2elnvpn()aetrxf iadfa r i sl(0teumimpno4lmt mictatfaDraxr ou1oleniocilsfa uauvpnt)aetnmo oadomD lu o;s0truoxm iudalen fetatf 2rau o;o4oleomieiasls elu pnu0alxrif3tytlpteln s;s)s2xr(mpny1om nmncilt)a2ua(  oo4tetnif3ild s2rmuvp;t0 etomr3oydlmDrauvo t)srxrxopnu1alte fvsa(fsruaurp;u4ape  ieiydlsDrm(mpnu0arxnmr3iotfmD au i;( teurxopiy4ol emfcsat)srta( poo1altnmo3iytfaDuan s t0 reomrctadopDr uei s0t2uoim3ny4apenmicils sDua( oou0aexomociltfs rlnmo;u4trtnmo iatfa eln slt)t2xr(o3ou4olte neta(f Dua(rpnu0tlt iociydfmDuluvs;() lxnxf3io1opDeauesls0s2uoxm3oodalt mncilsfarum(mo;o0opeoifctltls2ulums (0 etniocoa1omDelu slt0t2xoxm iy4olt  ivslt) Dtmxm nu4tlxomf3ilsfsDrl( p;u0alermfciodomDr iesl()teuo(r3nu4lpen ncs (faDrr(r nu1aee  octlsfm2rluvsnt4altrmf3iotlptraivs s srtmxopoy4amte nvia(fa2umumono0tltomf3tldlsDelu p;() exnxocio1lateli o s texmirpiydamtnmnctasfarrm( o;u0tpen f3iysfm2uaump;t)altrxo tadoa rlu i t0 2xmxr ny1ome lfcil(fa2tmxrpoo0openmi3iyd m rau s;u)teermr ia1fmDelueo;t0tetmxmpiy4aleelfctltf rtr( poo0aeeo o3iatfmDel( sn()trtomrciytfmtrli o;s0teto(r no1llenlfvilsfsDtm(m ou1tlt  icils a2ulu s t0 etnmf io1lm eau o;t  2xmimpoydlmtnmfctl()sruaxmp;u0apenmfeildls emu o t4 etomfciadfat anei s) 2xo(rpiu1ol nlncs s  2urxm oo4aptomo3iys mDrlu s;() rtrio3iotfptraieils)t2tmir iy1lme  ici () Dtm(  nt4tet ifcils s2uan ont4 renir3to1opDe nes;t  rxm(r3iudlmeemivt ()aDuaxmpnu4olen fcild s2rau o;t)alxrxr iotla eauvo;s0 rxm(o3ou4ap emivsl(  Drmxmpoo0oleoiieiyt a2rlnvsnu)tltrxf iy1lmtraiei s) rurxo iydamtnlnei (f Dtaxr no1ale io3tytlaDul( o u0texnmrcto1lp rauvo;t0t2xoxm3io1omtnmnctltf Dum(rpnt1tpeomiciadfs2ulnmont0tlenmocio1optrlueo;t)tetrxm3iydolen nes tf rrmuronu0apeo ociysfmDua( pn(4 eenxf3oadopD luvilt seuo(m io1omtemfcs t)aDurxrpot1aptoiietld a2emumo u)trtrmociodopD  ueols trtmxopiy1ape  fciat)s2umuroot0tee moeiysla ulnvpnt)teeoiocoytlat ln i s0 2urxr3nudal elivtltfa2rmum oo4oet  ictaslsDrau o u)teeoircto1lm e ieo;() eurxr3io4ope mnetls)srtm(  nu0apeo i3ilsls rmu ont4trxnir ta1fp eluvsl() 2xm(o iodal n fci s) rum( oou0altnmfeiytfaDrlumo;u0 eerxf3oydlpDr i i;t0teto(r3no1alt lncilt) Durumpou4teto feilsfaDuaumo () rxoirciy1lm r u s;s  2uoir3iu1omee icias)aDta(ront0alx mieias sDranvo;t0 lenir3oa1fmDrli o;s  rxr(o io1am  lnctatfarraump;u0tet iieias s2rm(mp;(0aeeoxoctydomt an o;t t2to(opnudopeemncs s sDrmum nu1apenifctad m rmu s;u0artrxr3oa1oateanei;t sruo(m iy4llt mnctls)s2raxm ;t1aex  o3tltfa2rlump u0alerxf oodomt  i slt sexmxo3ny1lptemneils  Drrurp;o0tlx mi3ias sDul(vs;u0tetnifciadop eaneol(0sruoxm3ny1lleelfeias)a2ta(  no4tptnii3tytlsDum(vp;u4tetoifciy1oatranes t0s2xoir nudom nmivias sDraurp;u0tptnmociasfs2ulnvsn(0aetnio ootlmDrln s;s0 rtrio nudlltnlncil(farrau  oo0apxo ociad a ean p;u4aeeoxfcoatfmtrluvs ()trxm(r no4lme  nes t a2umxmoot1ope  i3tyd a ua(vp ()alxomo io1omteanvo s)trur(r nu4opeemivta( srrm(moot1teeoii3iasla rm( p;(0tlxomo iydopte ieil() etoio iu4al  lfvsa(farum( o;t1tpxo iciyt a2raump (0trxoif ia1la raies s0 2xoxm3no4lm elfcslt a2rmurono0opx  i3tat m um( snu0trxomr3iodlatelues;t0trum(opio1ap nmfvtlt)sDta(rooo1alx iicilt aDeanmo;()trtnifcty1op r ies ()texoio3nydol  mnvtatfaDtaur ;t0olxoifeiatfa2elnmo (0trtnmf3iytla e ivsl(0teuo(o3nodomeemnvt t sDur(m ;t1aex io3iasfm2ea(vpnu4tlxnxf to1lmD li o t trtmimpno1apt  fes t sDtm( oot0ale mi3ils m rauvpnt0 lxoif oatlpDran s;s0trxm(m3ou1lltelneia(f Drmum no0texn iciytls2emn sn(4 rxoxr oodfmDeauvi;s)trxmxr ou1lm nmnesl(fa2rru p;t4oexnioeiysfa2ea( snt0alxrmrciytfpD anvils) 2xrim3no1alen fet ()sDum(mo;o1alen fetas m2el(vo (4aetoiocoatoaD lueo ( srtmxmpiodaltnlivi (faDtruroou4olt iietlsfm2uan o t0artrxf tatlaD anvols0s2tm(m3iydap nmneiasfsDur(r ou1alx io3iydla2ulumo u)tltrmo tatomDrliei;t0srum(m ny1apt  ies s)aDtr(mpot0aet ioctldfsDran ont)altniocty1fm eau ilt0srxoxr3ou4llt lfeta( aDumxr ;t1olto oeils sDel(vpn()tltnxrciytlaDraneo t trum(r3no1oltelivi t  2umu  ;t1ope miciyd aDum(vp u0 leoifcta1faD luvo;t)texoxopno4al  lnetat) 2tax p;u4tlx  octls a rl(vs (4arxrxo ia1om  luvs t0 rurir3no4ll e nvtasfs2tmxm oo0oexomfciaslmDrm(vonu4arxrxf3iatlm rlnei;s seto(mpiodameelneilsfs2tau oot1tlen fcilsfmDranvo t) exnmfcoa1lm rauvs t  eto(m oy4altelfvtlt) 2rrurp;t0aetomictasfmDul(ms (4aexoif tytfm eln i;(  eumxm3io1ol n nvsl(  2tr(ro;t1opxo i3iasla2el(vs;()areoio oo1lptrauei;( trxr(m3oudameelnvs s  Drmxmp;t4opt iocildla ranvsnu0tltomr oy1oa  aivsl(  2xo(m3iu4lmen ivias arrmumonu0oltomi3iasfa2ul(vo;u0altrxr3tadfpDr u i;t tetriopoudam  lncils aDtmu ono1oetniiciat a el(ms;(4tleoxo3ta1lpteln i s) rumio io1oleelicsls) rra(  ;t1ale mictltfs rmuvsnt0 lxrxfcoo1faD ln o ( s2tr(opiy1ll  mncs ()srum( p;u0apen fciat s2el(mon(0alxomr3oytlmt  neols  2toxr oo4open nvtlt  rrr( p;t1aetoioeiasla2emnvp t0 eermf3iadopte nes;s)sexr(rpoy1opte nvilsf 2rru o;o0teto i3ilt aDrmn pnu0arxnmf iatlm elueslt) eumxmpiodaleelnei ( a2ra( pnu1texnifcilsfs um(mp;u) ltoio3tytoaDrluvs;s)s2xoxo3nudlpenmivtl() 2trxrpoo4altn iciydla ean p;u) ltnmo tydfmD lu o;t) etmxm3nu4lptn fct t aDtmumpno0oexoio3tls s rl(mp u4tetrmo iotlp rlneo s0seur(m3oo4lm emnvs ()srrmxrpou1alto fciasfm2elums u0aetoxo iydoaDeauvs;t)seur(mpoy4lme lncsas  Dta( p;t1ape iiciatla emnms;t) lenifcoadlm e n s (0srxrir3nodamte ict (f Drmxrpno0ole mfeiltls2rm(vo t0trxoif tatlat aivs;s)s2tr(mpiy4ll   iei s) rra(mo;o0opt mocils s ra( p t0 rerio3oadlpt ln il() 2tmio no4lmtn icil( srrmu pot4apt iieildla2uanvp ()aleoif3oadlm  li o;s)srtoimpnudole mfctasfartaxmonu4opto i3tyt s2rluvp u0artoioctadop  an s t)t2xoim no1lptelnvias  rtmu  ot1opt  feiltfa umn pn()alerio io1lp   i i (0t2toir nodap nlietl(faDtrx  ;o0optnmoeiat a2uau s;u4arenxr oa1lmD lnvsls0trxm(r3io4olt  ies s sDtru o;o0olt  fctls s emn o ()trxnir todfp   n i;t0trtmir3no4aptnlfetls s2raurp;t1aexo feilsls eauvo (0aetnxfctadom ran i;(  ruoxopnu4om n ncs (fsrua(  oo1aex  ietltls2umumo (0alxnio ta1oaDelies;s t2urir io4apt lnviltfs2ua(mont4aetnii3iad s ua( on(4texnxf3oo1oa   n slt0 rto(opny4lm emiviltf Dra(m nu0oltomietls mDrauvpnt4trtoif3oytlmtraivils srxoxr3no1oltelict (f 2rmu  ou1tptomoeiadfa2ra(vo;(0 lxrxr3tydoateaivi t teuo(o3iy4am  liesat srumu oou1teeomo3ildla2ea(von(4aexrircoa1om rluvs s0s2tmir nodlm  mncs tfarrau pot4ole iiciltls ul(vonu)aetnxfcoo1oaD lnvi (0t2tmimpnu1lptnmnvtlt) Drm(m oo0tpxo ieilt mDul( p;t)artnir3tadoa rluvsls t2to(r iy4al  mfvtas  rrrx  ou4opxoifeild m uln on(4altrifctydfpt li i;t0t2tm(m iydlp nlnvtas) rraxm nu1ale iiciysla ra(vonu4 rtnir3oadfmteai s;()trxoimpnodoltnlfvia( srra( ono4tpeo fetad s rm(monu0 leomo3oydomD  ivo (0texr(m iudomt  iviat arraum ;o4alxo oeilsfm2ul( p;u0aetrmo tytop rluvi t0teumimpiu4lm  livi t artmumo;u4olt  feiyt m2raumo u)alerio3oo1lmte ues;s t2xoxmpoudam emnviltfartmuronu0alenmfcildfm2ul(vs;t0areoxf3tatfat  u o ( t2uoxm3no4lmte fesa( arum( ooo0tptniieildls2ua(mon(0 lxrir oydfmteaies;s0s2tmio nu4ll e fcil() 2tr( ooo0opxn octyd mDel(vonu4alxriocia1fpt  n ilt)s2xoiopoy1olt  fetl( arraxmpnt4oltniocilsfs2rmnmpnu)texoxo3iatla eluvs;() rxoio oo4omt  fcs sf Dtmumpno0tptnmo3iys s2rluvo;t) lxnxf3ootlm eluvslt0sruoxo ny1lm  mivilt sDtmur no4alx  oeiyt sDra( s;u)tetrxr3iodomDe ieol(0texo(m3oo4ap n ivtlt artaxrp;t4tetomiciyd a2ul(vo;()aeerio iodla r nvi;s) exrxr3oudol n ietasfa2ururpno4aex mi3iyd s2elums;(4altrifcto1fpDr u i;t0trtmxopiy4op  livt (fartm(moou4tleo ieildlsDuau p;(0trxnmr oo1lpteli o;() eurxo3oy1omt mnvt sfaDrrxmp;o1tlxomoeiyslmDrau sn(0treoxr oatfpDr ieolt  exoio3iodamtemicil() 2tmxrpoo1olxoii3iytfaDeluvont4 exrmf iytla  ai o s seurxr iodamtn fvsa(  rum( onu0tpxnmieiyd m em( pn(0aeermr3ia1faDraneslt0sexrimpio1olt  ietasf rtr(rp;u0opeoif3ilslaDrau s;u)trermr ia1op  an s;t) 2xmio3io1op emivilt)srum( o;t0oeen oeiadfaDul(von(4artnio ootomt li o;()trtmiopoy4optelivil()srrr(  nt0tetnio3iad s2ulums;t0artoxf3tytlmDe ivi s s2xm(r oudam   ieil( a2ur(m nt1tle  ociltfm rl( p;t)arxomf oydfpDe uvils0srxoxrpoy4omeemiesl( srtm(  nt1aex miciatfs2rm(mo;t4tetrmo iatlmDeli sl(0 eurxopiy4olen fetas sDtmx  no0openmfetlslaDrmu s t0alerifctadomteaneo s)seumxo3oydame  ivia(fa2uau ont0oeen ieiat sDrmumpnt4arenmf totomDrauvol(0srurir oo4op e fvs tfarta(ro;o1aexomo3iys m2raumon()trtoio3oodop rai s;s0teuoxrpoy4amtelncil() rumx onu0ole if3iadlmDulnms t4alerio oytlmt lnvolt srxrio no4op  licils  Drr( p;u0olt ii3tysla2rmnvp t) ltoxo3oo1fmtr ueslt) exo(r io4omtnmnviatfs2taxm oo4aeto o3iasfa2um(ms;() etnmf tydop e uvo s)t2xoxmpnydlme lfei sfa2rr( oot0opeo iciydlaDum(mo u0 lxrmo oytfpt lneo;t s2uoim3oo4oleelneta(  2ururoot1tle moetydfs2ra( snt)trtnir3tytlmt  n s;t)teurxr3oy1amtn ivsasfaDtau pnt0aeen ocild m2ea(mp (4arxriocto1omD  ies t  eto(m oydlltn neil( s2tmx onu0olx ifcils m2uan onu)trxrmo tydop rlu o;s) rtoxm3oudllenlictl(  rua(rpnu4aptnmfcias s2uanmsnt4trtrmo ia1omtelu i;()sexoirpnudlltnlict s) Dtmxrpou4ape  feiatlm2eanvp u4teeoxfctytop   uvs;( setrir nodol nliciltfaDrrurpnt4alenmoeilt m rm(vo u4 rtoif oatopDr nei (0 2uoxr iodlme  ivta( a2umx o;u1altoifctadlaDum( pnu)artnxr to1fa  anvo t  2uo(rpou1llt  ncsa( sDumxm nt4olxoii3ildfm2ul(mp;u) lxrif oadoatr ieils  ruo(o3ou1optemneiatf rrr(mono0aeen fctydlmDrlnvs;u0 ltrmf3tydoa eaueil(0t2to(opny4ape lfetls  Dtrumpot0tlx iieiysla rau s;u)artrir iadfpDr ivilt)t2to(mpou4am emnesl( srumu p;o4alx mf3iatfaDra(mo () lenxf3oadoa eanesl( trto(opoydlp  lncias srraurpoo1oeeoio3tltlm2rm(ms;u4 exomrctodfmD anvo t) etoio3oo4lmenlfetlt)srraump;o0altnmoctys aDel(ms;(4 exnirciy1laDr n o;s0s2urxopnydlltemnci (  rur(ro;t1altniicilsfm2rmn ont)arxnxrcoatfmtrlivo s srtmim3io4llt mivtls) rum(ro;o1altomoetadfsDua( snu)tleoxocoo1om  auvi (  2urirpiy4lpe  fes s) Dtr(mp;u4tlt  f3tadlmDul(msnu4 lxoio to1fmt aueo s)s2um(r no4amen netasf 2rrump;u0oex mociltls umu p u) exrxf tydlp eai s t)srxrim oy4lltn iet ( srrrxm nu0olto feildlm2rmuvp;t4tltoio3iadfpte nvs t0s2xmxr nu1ll  lncia(  Dtru  nu1opt moctltfa2elumo;()aeenir oytfpt  u ol()trxoxr ou1lmen fcsasfaDrrumoou4aeen fciydla rmuvo u4teermf3iadfpDe n o;s  2urimpoy4om nmfcilt sDurxm ot0alenmfciydla emump;u)texrmo3oy1fa r iei s0s2xoirpnu4altelivtat  ruauro;o0tltnioeiydfmDua(vo t4arxnxf3iadla eauvsls0t2xrim oydlmeelfvtlt a2tr(r ot0apeomociad mDua(vo t4 etoxocootlm rau i;t0t2to(opny1ole  fcils sDuaum ot1apeomictlt m2rmn s;t4 eenxf3to1opDr u il( sexmxr3iu4ol   nvslt s2tm( onu0aptnmoeiyt sDulnmonu0trxoif oydoa elivi t sexoxm3oy4alt mics ()sDurx  ;o4apeomfcildlaDuanvo ()aeerir3iydfat  uvols t2tr(o3oydamen nei s)srtmump;o0oetniocildls2ul(monu)tlxrmrcoatom  aneo;( setoxmpiydaptnlnvi (fs2rmur ou1olxnii3iydls ulnvp t4arerif io1fp e ivi s0t2urio iydap nmneils)artmxroou1tpt io3ils s2elnvs;u) reoircto1oaDe n s s  exm(m3iu4lmee fvtl(f 2umu o;u1tltnmfcild a eauvont4treoxrciotoaDrln i s0truo(rpoy1llenlneilt) rtau  ;t4aee mocilslm rauvont)trenxfctytoaDe n o;t t2xoim3no1alenmfvtasf Drr(mo;u4oex  oeiltls rm( s u) leomo3oodom   uvsl()t2toxopoo1llt  fet (f 2rmum oo0oexomieiad s emnmo;u)aexoio3tydopD  uvolt0seur(o3oo1ll nmfvt s  2ra(rp;u0aleomi3iytlm2rln p () eerxf3oodlp eluvi;()t2xoxopnu1olenlfes (f 2umu p;o1olxo i3iysfaDem(ms;()texomr iytfatrlnvo s trtoxr iu4lm nlnvsas arrm(r nu1ole  i3iydfsDeln on()arxrir tatomteai o;s) 2urxo ou1open iesa( s2taxm oo0oexomo3tyd m2ea( o t)aexomociatfm   ivslt0trxrirpny1lle  fvsl( sDuaxront0tlt mieiytlmDuau s;(4 rtrifciy1lat ai o t trtmimpiu4lpt mivi t srum(mp;t4ope ioeilsfa ulu o u)arerio iytfpte ivi;s0 2umxr3iy1ol   ictlt  rrmxmpou4tpeo i3tadls2emuvs;t)arermf oydlpDrlivi s0t2xr(r3ou1lptelneia( a2rru  no0tetoio3tysla2ranvon(4teeoif tydop r uvi s)s2umxo nu1lpenmnei ( arrru ooo1altn f3tys sDua(mpnu0artoxrciadlmt  n o ( srtrxmpio4lm  lfvsl()a2uaum nu0oeeomoetls aDemnms u4 lxoxo3oodfpteanes (  rurxr3iy1ope lici t)a2ra( pno1teen feils s2emnmont)aeeoio oy1fat liei s  2uoim3ny1olenlivilt aDtmxmoot1oleo i3iyd m2ea( p;u0 lenmo todoa r u i s tetrimpiudlmtnmfvtas) Draump;u1aeeoifciltls uluvo t4 lerio iodlpD  nes s  2umiopoy4opeelicil( sDrmumo;t1teenmiciad m uln ont0 etnxoctytfa eauvo;s0teuo(m3no1ll   nct t artrxmpno1aex ioctldlm elnvpn(4 exomrciy1lp ranes t) 2tm(opnu1ameemnetlt)arra(r no0oexnmictyd s2umu o u0 lenxf3tadop   i o t0srxrirpiy1am elici t)sDra(mpou4tle mociysfm2ua( o (4 renmr tydomt  i ols  2xoir io4aleemnvsl(faDrrumpoo1aee ifeiatla ulu p t0 etoxfcootlpD  ues;t0 exoio iydlle lietls aDrr(rp;o0ope  ietydla rauvo;u4trenxr3oodom e u slt t2xr(r3oo4aptemivias  rumuronu1apeomfctyd s2ua( snt)aleoxr oy1opt ln ils0 rto(m3ny4omt livtls sruau  oo1alenmi3iyt a2umn on(0teenmf iydom elivs;(  eum(rpoo1ap nlnvils)srtm(mpnt1tpx  f3iysls emuvo;(0tleomr3iotoaDeaivsl(  2xo(opnu1lp  lnet s s2taurpou0aee iieiysfm elu s (4alxnxoctodfa eau s;t)srxoir oo1omtelnesas) ruax p;t4tpxn octyt aDeauvs ()trxnmr oadla eaneilt0 eur(opiudlpenmnei () rum(m oo4tleoio3tas mDel(ms;u4artoxrcoadomDe ieo;(0trtmxopnu4om e fcsl()srrmur oo4alxomociat mDeanms u0altoio tatopDelivil() 2toiopnu1ap  lfci t arum(rp;t0aet mieiytlaDraumsnu0 exoxrctytom elivs ()sexm(mpoydll nmfvi t artm( oot1oeeomfeiadfsDrlums u)trtrio totlpDraivs;s) eurxrpiudlp  lncs sf 2rr(rp;o0opt if3iytfs ulnmp (0 rtrir oo1lmteau slt)s2urimpno1lp nmfvi ()a2tmxmpou1tlxomf3tyslaDelums t0 rtrmr3iotlp  luvi;t0 rur(rpoydal elfctlt) 2rm(rpot0altnmfciyd s2ulu p;u0 eeoxr3oy1fptr neo (0s2toio3io4lme lfvslt  2taur nt1apto ocild m emn s;t4 eerxf iy1omtraieilt  eumimpno4aleemfvtatf 2ur(mp;t1tlt ifeiysfs elnvsnu4aeerxr3oy1oat au olt srxm(rpiydllenmict s)sDrm( oot4tpen ietat m elu on()areoxr tydlmDe n olt0t2urir iydlm nmfvtat sDrmx pnu1optnmi3iadfa2em(vs;(0arxoxf oa1laDeai i;s texoiopiu4lmee nci s aDtrxm nt1texn fcilslmDulnmsn(0 exnmr3ootoa  lueils)trtrirpiudame  ici (fsrurxm ou4oltnioeiys s rlnvo;t)tetrxocootfmDeauvi s srxo(rpiu4lmt mfvs t) 2uaxmpou1tlx  o3iltfa el( pnu) rermoctodfp rau o s  eur(m oydlm   ivil(faDtr(mpoo1apto o3taslm umnmo;(0trtrxf ty1fpDraivolt)tetoim3oy1am  lnvil() Dtau  ;t4oeeoif3tyslsDumums;(4 lermr3todoptrluvsls0srxo(rpoy1opee neilsf 2rr( oot4olxniietyd mDul(mp t0tltnxrcoa1fmteau o s)setr(o3iodom  lncs ( aDtrurp;u0apt mfcild m2um(mpn(0tltrif oa1oaD aueols  2tmxm nudal nmivtl(f 2rrurpnt1oeto ieiytlm2um( onu4arerxf iytoatean o t0 rxmir3no1op   ivi sfarurxmpot0tptoifctytfmDeln snu0 lxnxr oatfmDe uvo;t)s2tr(r nodom  mieils aDurx p;o1apx mfeild s um( s ()tlxrxo3tadlp elivols0srurxmpiodom e nvtat a2umx  nu1alxnmfciyslm eaumsnu4altrir iy1lmDr neols) rxoxr iy4om e neils)s2ta(ront4aexnmo3tlslmDeln o u4tlerxo3oytfptelu sls srum(m ou4llt mncta(fsrtmur nu1aptomo3iasfa umu o u0artrmo3totoa e nvo s  rtmxr oo4amte fesl(fartmur oo0tlx  feiad a2rluvsn(4 etnmrcio1om   nes;()srtm(opiy1amenmfvt tf ruaurpno0opxnmf3tatfaDum(vs;t4 ltoxr oodfm rauvs (0trumiopoodopenlieilt sruax onu0alxo f3ildlm2uau o;u)tetomo3oadoatelu ilt)s2tmxr3ny1lm n ietatf 2tax ont0oltn oeiatfaDranvs (4alxoiocoy1lmt aieo s0 2triopoo4op e ies s)arrr(monu0tpe  o3iysfm2rluvpn(4artrif3iytoptrln s;s0srtr(o3iudlpe  fetlsfa2tr( pnu1tltniietysfaDem(vo;()trenxf iy1fmtrauvolt  2trxo io1ame lnct () Draxmpnt0tltn feiad s2rmuvs;(4 etnmocoa1la e n i;()s2tmxmpnu4amt mivslsf 2rmump;u4apt mietat a2uanvo;t4tltnmo iotoa eaiei;t s2trxm iudom elnvsls) rrmxrpnu1oexn o3iat s ranmonu0tetrif3oytlmt  i i () 2um(m3ny1omte fct t  rurx  ;o4olxomicild m rau o;(4 leomr oy1lm   nvi t) eurir io4al elneil(  rraxmont0apxnioeiadls2eanvs;(4trxomf oo1optrlueo;s s2trxm oudol  mfvi (  2rax  ;o1tpxomieiyt a2ea( p t4teeoxf tatoa raneol() 2xoxr ou1aptelfcsas)srrru  no1texn ociadfs2umnmp;u0tleoxf iatomteaueo;( t2tmir io1al  mnet (f Dtrxrpnu1ole mfetasfsDuanmont)arerio ia1lmtr uei ( seuoim3iudlltemnvi t) 2taumoou1aptn ociat a2uluvp u0trxrmf3tatop  livo;s srurxmpiodaptn feia(faDur(moou4optoiictadlm2umumo;(0artrif ta1opDraivo;s) 2tmim3iy1omenmnesas)s2um(  no1oeenmoeils mDuanmp ()aexomr oa1fmt lu olt s2xrim iydllt  ivtl( s2ua( o;o1tetnif3ildfmDul( snu0 etnxfcoatomt aneo s0s2xrxo no1ll e fct (fsDrr(root1aptomoetlsfmDumuvo;()aeenir3iytomD anvo;t0trxrxr3nu4optn ieiat)srtm(rpou0tpe  f3iytls ea(mp;t0alenir3ia1fmtelieolt) rtoim oudoptelfeils)aDumuroot4oet mfctls m elumsnu0aeermr iotfp  li o s  2xoxo3iodlle  fvt s) 2ta( oot0tpxoiiciydfsDem(mpnt4aetnif tadom eln s;s)t2tmxm3ny4omte fvsa( srtmur oo0aetnioctad s2rln onu0artoxocty1opDelneo (0 rum(rpnydom nmivi s a2taurpoo4opt ifctysfmDea( p t) eenxr3tatlaD lnvo;(0sexmxopnydlmenmnvs t arrm(  ot4aet  o3ilt sDrm(von()artrxrcoydlmteli i;t0sexo(r ou1lmeelfcia(f rtr(rpot4tetn i3tytfa2umnmp t)altoxo3iy1lptrliei;(0texoimpou4al nlietlt s2rr( pnt1tpxomictysfmDrmn o u4tltrio iatoaD  ivi s)tetr(o3ou4omtnmivsat  Dumum ;u1oleomi3tytla2rmn s t)texnif3tydfm eaues s0setoxm3oo4llt mietl( arra( ono1aexnif3ild a uan o;(0texnircto1lpt li sl( s2ur(m3iudamt  nvs s)s2trx o;u4aet  fciltfa2ra( snt4 exnir oadlmDr nei;s s2toim iy4ap elnvs sfsDumxmpnt4ole  i3ilsfs2um(ms;()texoxrcoadfp elieols) etrxrpnudlme lict sfs2trump;u4aptomfeilsfa ulump t4aeeoxo oodlatraueo;(  exmirpio4alee fetat sDua(r ;o0aleomfciatfaDum(mp;t)aetrircta1op rln s t)truoir ou4lle lncs tf rtr( p;t1oetnioctldfsDrau s t)tetrmf oydfm eluvs;t texmxo3oydap elivias sDtmuront4tptnmi3ias sDrluvo t0 rxnmfcoodlp rau ilt0s2xoxo oo4ole lfesatfartaxr oo1apxo o3ils s2rlu p t)arenxfctytfmDrli s;s0teum(rpoy1am  lfeia( srtrx  ou0opeomfciadlsDrl( p t)alxrxocoytla r uvo;s) ruoir iu4oleelnci tf rtauro;u1ole moctld mDumnmsnt)aexoxfcoy1faDr nei t0s2tmxr3no4lltemfcsas)sDumu  oo0apto fetytlmDrm(mon(0arxrirctydlpDr nvi t)t2xmio iu1lle  ieilt)srta(ro;o0tlxnifeilslm ulu snt0texnmf3iatlm   ivil()srxmxm3iydalt  fetasfs2urxmo;u4tpe mf3tyslm umu s (4 rtoxfctatfp eaieo t)tetmxopou1lpeelnviat) ruauro;o0tle iociltla eln ont) rtnxr iytfa eanvil( srtmio3iu1lp elivi () rra( ont4tpx if3tydla2rauvo u0tltrio3iatomtr ivo;()trxr(rpou1lm  mnetl()arur( ooo0aleoif3ias a2ran onu)alxnxf3iodfm  ai o;s s2to(m iydaltemicta( srrm(  oo4alt  f3iasfsDem(vpnt0 ltnxf iydomtran i;t)s2toim nu1ap elnvsl(fsrta(mpno4tle  i3ias s eln o t0 ltoxf3oatoatr i i s  2urxrpiu1lltnlnei (  2tm(m oo0opeoifetadls2rau o;u4arenif3todfp rli ilt0setr(opiydlme lfeil()sDtmumono1alxn f3iys mDemnvp (4aetnmociy1fm rauei (0srxmxo ny4ap elfei ()arraumo;o4oltoiiciytfs2rlumsnu0alxnmrcootlptrluvs;s teumxrpiu4ameelfesl()srtmxrooo1openmicild aDrlu o;t)tetnircoy1latraivi s0s2xoxrpno4llenlnvsls) 2uau  ;t0opxoio3tlslmDulu p;t4aexoio3tadlm   uvs (0 eumxo ny4amen iet (fa2tauro;t0texnmfetytlm ulnmp (0 exomo tydlptelnes;(0s2ur(r oudopen fctltfsDraxroot4oexnifetat s rm(mp;t0 ltrmr iy1fm rai i ()teuo(o nodap n nvsa( s2tm( pou1tlxomociyt m2rmnmpnt)teenmo oydfpD lnvo t0 exmxr3oy4op   fctl(  Draurpoo1aptomfciydls2eanms ()trerif to1op rlivs s0seuoio ny1ll   ivs ( srtr( o;t1apxomoctasfm rl( p;(0aleoir3tytomteau sl( srtrim ny4al  lfeias)srtrurpnt4tpeoioetysls ea( o u0tetoxfcio1oateaneol(0sexoim3oo1altn fcs t)srra(r ;o4ale  icilsfa2ra(mp;u0arerxf oy1la rlueols trum(rpnydalt lfvtlsfarum(mo;o1texn fctld s2eanvpn(4areomf oo1fpteli o;t0 rtmxmpoy4lm emfeil()a2rm( oou1oeeo o3iasfs2uanms u)tetoioctodomtr ivo;()s2xm(opou1ole lnvt t  Dtru pno1tlenii3tydlm ulnmp;(4 eeoxo3oa1fpDeaivs;()trxoxmpoydlpenlict ( a2rm(mo;t1alenii3tydls2ean sn(0 rxrmf3oytfmtrau s t texmxmpio1alte feil()aDra(moou0apxomietlslmDemuvp ()texnmf3iatfm  lneils t2uoir oy4lpenmneia( srtmx  ou1oexoifctatlmDul(mp (0tetnio iadfatr iei;t0srxoxm iu4lm emncias)sruaumoot1apt if3iat m2umn pnt4tlerxr iatfmtrlieo s)t2urir iu4amte fvs ( s2umxmont0tet miciyd s2rlnmp (0arxoxf iatom rliei t)texmxm iudam n icslsfsDta(  ;o0teenifeilt mDrm(vonu0aetomfcoy1opDrluesl(0tetoirpno1optnlneias)sDta(monu1alt io3iat s2ulu o;t4aetnif3iydom rlivilt) etmiopio1omtemnci t  rrmu  ;o1aet mf3tydla2uln snt0 rermf iydoa raivsls) rxrim3iu1ole  fei ()sDuax ono1ole  i3ildfs ranvonu4alxoiocoytlmDrau s t s2uo(r3iu1ameelivt ( a2um(r no0alxoiiciltfaDul(vs (0 rxnxrcta1lpt auei ()tetmxrpoy1lpeemnvias  Drrxrpnt4ape  fciltfa ua(vp;t)trxoxf io1faD  n i ( srurxm3oydlmtelfeils artr(root0aleo i3iysfsDeanvp;u) exoircootlp rln olt0trxrxmpnudop   icta()s2tr(mpou4oexomfeiydfm rauvont0teeomrcoa1op elnvi s0t2xmir ou1lmtemiet t  Dumx  ;o4ale  ictlslmDua( p;(0trtnxo3totfmDeluvilt)seumxmpnydale  nvs sfaDrr(m no1tltomf3iytfsDrl(ms;t) exnmrctatlaDeanvi;t0texrxmpoy1lmenlnct t s2raxront0ape mo3ilsls el( pnt0 rxriocoa1fmtranvslt s2tmimpou1lp nmfet s  Draxmoot0olx ii3ildfm2umn s t4tetnio3oadop  au s t s2xmir iydlm nmfet s  2tmxrpoo0teeo oeiat sDrlnmp;u4 lxnxo oytoaDrlueils srtoxmpoy4ame mnvt s)artru  ;t4opx ioeilsfs2um(vsnu0 rermfcoo1oa elieslt0tetrim3nudoltnmivtl()s2ta( o;o0aet io3iat m2ran o;() rxnmf3io1fmDe uvo;s0srurir3oy1om   ieiltfs2raxr no0tet mf3tysfs ua(vo u)tlxnmf iytopteluei;( setrir io4omtnlfvt (f 2ta(mont1tpenifctad s rl( p;u0trenxfcoo1fa eaieilt0seum(o3ny4am nmfvs s s2rmu oot4oexn ieiat s eanvo;t4tetnmocoytomtr i s;()seumim oo4aptnlics tfsrtm(rpnt1tee mfeilt s rm( p;u0teerxr3io1oaD anvs ( trumxo3iu1al nliviat  rraur ou4ape  octydfaDrmuvp;u4tetoxo3oatlpD aieslt  eumxr nydope lfci t)a2ururoot4olt ifciysfs eau o;(4 etrxr3oa1oaD li s;s srxr(o io4aleelfcsltfsrtrxm nu0oltn oeildla ea( pnu4tleomrciydom  luei t0 rxmxrpnodome mnctat srurur ou0aexn f3ildfaDuaumsnt)aleomfcoydlm rluvs s srurxrpiu4ol   ieta(faDtrxm nu4oee  i3iyt s2emu o;t4texoxrciodlpt aivi;t texr(o3nu1lpe liei s) rumxrpno0tle ifctydfaDemu s;(4artoio3iotopDelueo;t) 2xrxrpnydlltnmfcsls s2ta(  no4aet mfctlsfsDrm(vont4aetrio iadla eaneo;(0seuoio io4lmtnmfvs ()sDrrxmp;t1aexo o3iad a ua(vs;u4tetnircta1fpDrln i;t) 2trirpnu1lp nmnvt (fsrrrum ;o0tlxomietlsfsDrluvonu)altrmr3oatoa   nvo t)s2toxmpou4openmnctl()artmx pou1apx mo3ilt s2ul(mo u) rermf iadlm elues;s)texm(m nodal  mfeil(faruru o;u4opeoii3tyd mDel( snt4tltrmf3oytlmDrlneo;(0trumxr oo4openmnci s) rrmurp;o0oex ifctysfa2el(vp t4alxoxf3iydfp e n o s0t2xmirpny1open ivs tfarraurpoo0alxoif3tls mDemuvp;() exnif iytfmDelu s t  exr(o iy1lm   icsa( sDrrx  no0tex mictasla elu s;t)arxoxf3io1oa rlu o;() etrim3ou1lp e feia(faDrr(rp;o4alto octatla umumo u)trenxf iytlateli i;t) 2urio iu1amen nvil(farrmumpnu4opxn fetys a rmnvsnt)aexoir3oydfpDr uei t  2urxmpnodop nmies tfsDrr(m ou4altoio3tlslm raums (4 ltrxrcoodomtrlnvo () etoxo3oo1ll n icia(  2umum ;t0altoii3tls s2eluvo;u0teermr oytla eluvslt) exmxopiy1alee feilt a2um(mo;t1apt iiciyd m umuvont0arxrirciytfp eln i ()sexrim3oodopt  neta() Drr(r no1tltoifcild s umn pnu0tetomfciydfa ean s t0 exoir3iu1apt mivtlsf 2tm( o;u4olx  o3ildfa2ua( p (0 eenxo oydfm rln slt)seum(m3nodlmeemfvi (  Duaxm nt1apxo fetltfsDem( o;t4tlxrircto1fa r nvils0s2xr(m3io4lmee nvta(f ruau pou4apenmi3tls a ulnvo t)aexnmr3iydlmDeaueo s texm(mpoo4lmenlnci tf Dta( poo4altn f3iydla2rl( s;(0texoif3oa1la ran o ( truo(opiu4alt licia() rrmur no0olxnmf3tyslsDrmn sn(0 lxomr3oo1oa  liei t seurxo3io4omeelfei sfsDururo;t4aexoiieiydfa ulu o;() ltomrctydopt auvs;()s2tmirpiu1om  lfeiat  2rm(m nt4tpxnmi3tlsfm2rmnmo t4trxoxf3iy1omtelivs;(0trxrxopno1lptelnvsa( sDururpnu1optnmi3tys sDel(vs;u0trxomo todlm ranei;t) 2umiopoydlp e ivta()s2um(m ou1oexnmo3tadls ra(msnt)tleomr3iatom rai o;s)seumim3ou1llt lfct t aDta( pnt4tltnioeiasla em(mont4arxnmfcootom  auvo ( teto(r3oudoltn fviat  Drm( pnu1tle ifeiytlm ranmpnu0 renmrciy1oaD lnes;s)s2tmxo3iu1lp  licta()srrmx  no1ale  i3iat sDemu s t0trtoifctadlpteaues;s)trtrxmpiydomenlfvtltfs2tr(rpot4optoifeilt s2rlnvo;t4 exomocoydlp r ivils)seurio ny1op emfvsat  Dumu pno0tpen oeiys s2ulnmsn(0alxoif oa1lpD  uei;t) 2xo(opiy4llenmnet ( a2taxr ;u0optn ieiatla rmumpn(4tltnxfcia1lpDeauvols t2um(r3oodlltn ics (  2tr(ront4tlx  oeiat a2emnmo;(0 leniocoytlmD  ivo;t texrxo3oodalt  fvi s  2uaxm nt0alt miciadfa2rmnvp;t0 eenmr3ootlaD  nvs t)t2xo(m nodll  mnetasf rum(r ou1aex  f3ilsfmDem(vpn(4trtoxr todom  lueo;() rtr(rpnodalee ics s aDraxmpnu0texniieilsfs2emnmo;u)aexnmo totlm   ueil(0s2xm(rpiu1am   ivil()arumxrp;o1oee mictytlm um( snt0 lxomfciadop eln i t)sexoim3iudaltelfvt t) rrrum ou1teeoio3iydfs eanvpn(4artrmr oodla r ieslt t2xrxrpoy1ol e fcils  2uaurp;u1tlt mf3iltlm um(mo;u0 lenif ty1omteln sl()t2tmim ou4lptemfvs ( srtr(rpot1tpt ifetytfmDem(von() etrxf3iotlateauvsl(  eurxrpoo1ope mieia( a2tr(m ot0aeeomfcilt a2rauvont) etoifcoy1laD luei;s)texmxo3ou1lmte fvtlt  ruax  ot0opx  oeiaslmDelumo u0 rerxr3oytlptr uvs ()texoxr3io1amtn ivi t)arra(r oo4open ictat m emn p t0 rtnif3oa1late i s;t)srxmxr iodlptnlfetat a2urx ont4optomi3iydlm2ranvo;(4tetomfcoa1om elues;(0 exmirpio1lpe  fci ()a2raxmpou4tleoio3tlslsDumu snu4texrxo iotlpDe i i () 2xoio3nu4ap   fctas s2rm( o;u1optomfciadfaDelnvo t) rtnxf3iydopDelnvi;t seumir ny1ome miesat sDumxr ;t1tlxn o3iysfs2ea(msn(0trenif totfmD lnvslt trtmxm nodlm elivsls sDra(moot4tet iociatlmDrmu pnt)aeermrctotlaDrlivo;s srurxopoy1olt mfvil(faDrmx ont0alx  f3iltls2em(mont0 exrxr3totfpt aieslt srxmio iu1opee iesltfarua(ronu4tleoio3tytlsDum( p;(4altoxr3oytfp  livi;(  exr(o3oy4open fvi s a2tm(mo;o4aexnioetydlm rm( s;(0arxrmf oy1omD ln slt0 2urim oy4am elies s)srrrx pou4tptoiociytls umnms (0aeenxrcoodla eaiei t)trxm(m3iu4lmen ietltfaDtr( ooo0aptnioeiatfs2rm(vo t) rxnxociadlpDe ieo;s0 rxmxr3iudlleelfvia(fs2uax  ;u4tetnmf3tysfm2emn snt4texnif3todfatrai s;s srtm(o ny1lpt lfetasfartru o;t1tetoifciltfm2raumsnu4 lxrmo3ootfmD ln olt srxoxmpny4amte iet tfs2um( ono1oexniiciyd a2elnvon(4 lenmf3iydomtr i sls)texrim3oo4lpee ieslsf Dtmurono4aleo oeiytfs2el( snt) rxomr tatomtrlu ol(0trtrxr3oydol nlnvsl()sDur(mont4opxnmfcildla uau s (0tetnxr3iadlat luei;t)s2urirpny4amtemnesl(f Draxroou1opeo icild a rmumpn()arerir3oodfpD  ivs;s  2uoxr no1ame lncs s) Dua(r ot0oexn f3tysfs umuvonu)alxrmr iytoaD lu ilt) rtrxo oo1lmee fci tfs2rm(mono1oltoio3iydlm2rmnmp;()aexnmrctadfp e u ols trxoimpny1lle mncs t  Dtmxrp;t0tpt  octat s2rmu p;(4 rxrmo3oo1lpt  nvo s0t2uoxo oy1ol nlfvi sf Dur(r ;o1olxnifeilsfs2umn on(0altrxo3iy1fa rlnei;(0setmirpiydop emnctas sDraxm ou4aetn ictldlm2uan sn(0 renio3tydfaD  uvo t0s2to(rpnydol  lnvilt  rrmu pnu1texnioctas aDelnvp;t)teermrctadom e nes;s0 rtmirpoudlpe  ivta(fa2uaumooo4aet  fciaslm2elnms;t4 ltrxr oy1lateauei (0 exmxopoudamee fvt s)a2tax p;o1tltn octls mDea(mo;t) rermrcoo1la r i i;t0 exmim3io4al   ict t arrrur nt4tle mfciytfm uanmon()arerxo totlpDeaies;() 2uoxm nydoltnmnvtl(fsrtau  ;t4tet ifcildlm2emn o u)altnirctodfmtelnvi t)t2xrxrpou1lmtnmfvil(farur(m oo0oleoif3iatfaDrmn s (0arenifciatlat lnvs;t)sexmirpiy4aleemnvt tfsDurx  ot0teeo i3iatlm2rmn snu0artrir3ty1oaD ai s t)t2xrxrpio4alenmncsasf 2ta( pnu0tlt mo3iytls2elumpnt4 lxnmo totlp r i i s srxrimpnydoltnlnetas) rra(mo;t1tetomiciatlmDemuvpnt0alxoxf iodla  livi;()trtr(m iudalt lfvtls)sruru p;o0tlxomo3tldlm elnvs u) exnxrcoadlp r nesl(0 2xm(o ny1al  mfvsas  rrr(rpou4tpx mfcilsfmDulu s u4 rermr3iytfat  uvo;t0t2uo(m3nudlp e nvi s  2ua( o;u1tleo ieiadla2rlnvs u)aeeoxrctatlm  luvo;t0trtr(opnydap n fvt s)aDuaxm ou1ole iociys m2ra(ms (4 ltrmf iydop  aieol(0 eumiopno1lmeemfcsl(faDrrx  no0tetoioeiydlmDeanvpnu0aeenmocoadlm e uvs;t) exoim oo4oltn nvtls sDtrum ;o1teenif3iad sDeln s;u0arerir tydlmDr n s;s)tetrxmpiy4amt mfcta()aDua(mpoo0texoiietltfs rm( o (4tlxnio3to1lmDeai o t0teur(o3nudolt  fcsa( sDuax  nu4opxn o3tytlsDrmumo;u0tltnmrcio1fmte neo s)t2xo(opnudaptemnes sfsDurump;u4oee  i3iadls2uauvpn(0tltrif3oa1lptrli i s)t2xoxo3iy4ope  ncia()aruru  nt0tee  i3tys a2em( o u0 exrmf3tadlmDeai i (0 ruoxr oydapenlncs (fs2ur(rono1aeenifetad mDrlnms;() eenxr totlptelu slt0 2xrxmpoy1opt mnvta(f Dua( p;u1oeenif3iydls uan pn(0 rxrxocoydfaDrluvs t  2xmxm3iy4lmt lnet tfs2tau pnt1aexnifeiltfmDel(ms;t0alenxo tytfptranvs (0trumimpoy1llt  nesasfa2trxr nu0texnmietydls2rm( sn(0teermr oa1fa r ieo;s0t2um(rpny4opeemfciatf 2tau  ot0alxnifeiadlm ulnvs u) rxoxo tatlp r ieol()srtoim3oydaptn ncia(  Dtaumo;o0aeeoifeiad a rluvp;u0tltrir iydfp elneol( srtm(rpiudoleemiviat aDrmxrpno1tpxomf3ilt mDua(von() leomf3oydfmtr uvs;()srum(r3nydllenmivilt  2urx ont1tpx ifeiyt mDraumon(4areoxo3tatopDrlueo;t0truoxo3ou4lpe  nesas)aDurxr ot1oetoiieilt a rau on()trtoio ootomD  ues;s)t2uoxopoy4opeemfciat artaxr ;o1oltnii3tld s eauvon(0 reomf tadfpteau il(  rtmxo io1llt  ivi sf Duru oou4olxomfeiad aDeau p t)alenir3totfptr nvs s)s2tr(mpou4amt  icia()srta(roou0aexomieiltfm2umump;t0trxoir iatfmD aiei s s2ur(o nodlpe lfesls a2tmxrpoo4aet ifetadfaDuanmon(0 exnircta1oaD lies (0 exrxo ou1lm e fvtlt arra(ronu0alx ii3iltla emu s;u)arxoxf iy1fmteluvi;t teum(m oydomt lnet (fsDumxro;u4olt ioctadfm umuvs u4 rtoircoatfmtraueslt)srtoxm iy4apt  ict t a2rr(mpno1open ociyt s2rmuvs (4tltnif3tydfm elies s0 2xo(mpoudal elncil( aDtr(moou0tlxniieiysfa2ul(mo;t)texnirctotfat li i s0setrirpno4apeelivil(fs2trx p;t1tltoii3iydfs elnvp t4 exrif3oy1lp eai ils0srur(o nu4lp nlnciltfs2rrump;o4ape ifeiysfaDemums u4aexrir3oatopD aneo;(0 rtmirpoudlleemnviatfa2rrur no1tptniociat a2ulu o;()areoxr3oa1lmDrau sl(0s2tr(o iy1apte fet sfaDuau ont0ale  i3iltfsDeluvo;u0altoxf3oy1lpDr ues;s seurir io1open ici ()a2ur(m ou4texo o3ias s2um( p;u4 reomfciotoaDrli i;s0 2urxrpnydole liesl( s2ra(  ;t0teeo i3ias aDrl( p;t4aeerxf totfmDr uvo;()trxrirpoy1ol e fvsa(  Dtmurpnu4openiictadls um(vs;u0artnioctadlp ean o;s0 2tmim3nodapee neiltf Dtmx  nt1tpe ii3tls m rmnvo;(0arerxo iodfpD  ieo t tetrim oo1lmtemivi t  rtaurpno4apx  oeils aDra( p;()aetoxrciytomD aiesls tetmim nudlltelnvi (fs2raxronu0tltn i3iltfm ra(mp (4aleoxocoo1fp eln olt0 eumirpio4amenlivia()srtmxm ;t4opxnmoeiyslsDrmump u0 leoiocoydoptr nvi t)tetoxrpno1ol nmfeiat)s2rau  oo1oetn feiat m rl( o;t4tltoxr3totlpDeluvs s  2xoio iodopee nvia()sDrmxm ;t0opeomfeias m uanvpnu4 exnircoadom rlieo;( sexoxo iy4al nmnvs t sDumxront1tpt ii3iys m2rl( o;t0teenmf iydlmte uvs;t  exo(r3ou4al nmnvs t)sDrm( oou4tet moetldfs ulnmp;u4teeomo oodfpD  uvi;t0s2ur(r oo1olt mfei t) 2ta(mono1ole io3tls s ulu sn(0 renmf3ta1fatran ol()tetoxo3oy4omeemics sfa2rau poo1alt  f3iyslmDrmuvs;t0 ltnio3ootomD lues;s0 exoiopnudopee fvsas) Dumur nu4apxo fciydfm rmnvs;()artoif tadlpDe u sls srxoim oo1apt lfet t a2um(mo;t1apt io3iadfsDua( p;u)tetnxr iotlm rlneo;s)t2uo(o3oy1omenmfvi sfs2ua(  no4tpt mfctadla2eaumo (4 exniocoy1latrai slt trtr(o3nodap  livias)sDtr( p;t0tlt ifetld s2umums;(0tlxrmo3to1lpt lueil()t2tmio io1lm  lfeils sDrax o;o1oeeomf3tadfa2em( on(4artnmo3tydfa rau slt0 2xmim3iy4omtelnctl()sDraurpoo4tetnmf3iasfs ulnvo t4altrxr oy1oaDranvi (0 2tm(m3iydom  lieilt)srraxro;u1opx mfcils s2em(vo;(0 reniocoadoptraues t0s2tmxr3io1openlfvtl() Dtmu  oo0tex io3tadls2eanmo;t)trenmf oydoat  u s;(0 rxmxm ou1op  lfvtlt  Dua(mp;t4ape mf3tad a2rau pnu4treomf3iatfmte ivolt0teuoxm nodal nmieiat)aDrrum ;o4aetn o3iad sDum(msnu4tltnircty1fatranvi;s texmio3oudop  lnvtlsfsrtaumpnu0tex mfeiasla em(vp ()tetniocto1fm   i olt  rxo(r3oy4lltn ieslsf 2uaurp;u4oeto ieiltfsDulnmo;(4tetnxrcoodfa e ivs;s s2tr(o3iydllt  nvt t)aDumxmpot0tle  oeiyslm rau p;(0tltrir3ty1fm eauvo;(0seum(o3oy4lpen icta(fsrtmuroou1oex io3iad s2el(vp;u4 rtrirctydom elivs s srurir3nydam emfcs ( srumu o;t1oetnio3tld mDrl(ms () eermocootlaDe ueo s  etriopiydaptnlivs ()a2trurpou1oltoifciasla2um(mo (0trtoirctytop  anvol() rtoir nu1opeemfvil(  rtmu p;u4teto fcils m2rlumo;t4 eenmr3totfpD aueslt0t2xm(o iudlm emnci t)sDtrx pou4aptoifciyd m2ua( onu) rtrmr iy1faDr i o t0setmir3ou4op nmivi (f Dumuronu1ope iocilsfs ea( pnu4 etrmo3to1opt li o;t) 2uoim3ou1ome mivtas)a2trx pnu0tle iieiydfs2rlnvo;u4trtrmr oytla raieolt0 ruoxo3no1ame mneias) 2rr(root4teen i3iasla2umuvs ()trxrir3oodfa elu i;s)s2tmiopoy4lptn fvtatfaDrrurp;u1tee ifetltls2umuvo;(0 rxrif3oo1fa r n i;(0 2xm(rpoudaltemneta(fs2rmx oou0altn f3iatlsDrlu p u0arenxr3oy1faD aiei;t0t2tmxm3oo1ap  livi tfa2rax onu1opxnmieild sDulumsnu) rtrxo oytlmD luvs;s trtoir3iy1lltelnvi () Durxro;t4ole  feiytla uan p t0 rtomrciotlate ieils) 2tr(rpnu1lpen icsl()arrmxmonu4ape  ietlt a emn o ()areomo tatomD ai olt0srumir3nodapee iesls  Dtaxrono0aetoiociat aDel(ms u0texrxfctatop   i o;(  2urim3iodap   iciasfarraxmpoo1optnii3tytlmDelnvs;()arenxr io1lptr ivo;t  eum(o oo4lmen nvsatfaDtr(  ot4aeeomociytfm2rlnvp;u0trtomf oydlat au ils texm(rpio4olee ncsas aDra(rp;u4tle ifetadfm2raumont)artnmr tadlmDe ies;s  rurirpnu1openmfvtls s2taxrpno1alxomf3ild sDelu sn(0 lxnmfciatfptraneo t0 2umxm iudlmen nci tfsrumxmp;t0tlx mfcilsls2eau onu0 rerxf iytfp e neo (0srxm(rpny1ll emnct ( artaxmpou1oleo fciysfm rlnvont0teeomo3oydlpDe i il( srtm(m3oudapen fesa( s2trur ou0oexoioetadfm2ra(vp;u0 lxnmr tytfmte uvs;( s2xrir3nu1aptn nvilsfartrum ;t0olx  ieiat s2ul( onu)arenirciotlpt lu o s texrxr oudaltnlicilsf rumuro;o0aptnmfciatls2ra( s (4 etnmr tatlaDrlivilt)sexr(opny1amtn ivil()srrmu o;o1alx io3iat aDuanmp;()aetrxo3oydopDelnvi t)trtrxr ou4al n nvs tfa2rr(mp;t1apt  fetydfm2emn p;u0artrmrciy1lpDranvo;s) 2toxr iu4ole lfci ( srrmxm ou4opto f3tlsfm2rluvo u)tltrxfcoy1latranvo s0teuo(o nodlmen fctl( srurxrp;u1altn i3tadls2rluvs;(0tleomf3ia1lmtrauvs s  exm(m io1ap nmiciat srur(r nt0altomo3iytls rlnvs t) ltrmfcto1op  ln i ( teur(r oo4omenmnvsls) 2ua(ro;o4apx  oeias m2rl(mpnt0arxrmociydomtrlnei ( seur(m3ou1lltnmneta()a2ra( pot4aetoiieiasfs2uluvonu4texrmocty1lp rlieilt texmim iu1om nmicsasfs2rrx poo4teeomfciasla2rmn p;t4aexnmr3iotfpD  u o t)trtr(o3no4omtn neias sDrmump;o1tlen ociyd aDrm(mo;(0aleoxrcto1fate u i s trtmir oy1oltelfcilsfsrtmurp;o1tpx mf3iydla2umn snu)artoxf3tydlaDr i s t  2urxrpnu4op nmfeils srraxmpno0tleo fciltla2ulnvon(0tltrmr3ty1om eluvs ()s2xrxmpoydape lnvtatfs2tax poo1aexomf3tas a ua(vsnu)tltnmo oytomD  ues ()s2urimpoo1lptnmfcil( aDuax  ;t4tpe mi3tytfs ul(vp () leomocoatla  aivols)srxoir nudope mivi s) Dtrxrpnu0olenmfetatfa2ul(msn(4tleomfcootla elnvo t0 2tmir iudomt  iesls) 2uaxr nt0tpx ioctys s2uau s (4tltoif3ty1omDr ueilt)teto(rpio4optelfvsls) Drmum ;o4aet ifeiad a uanmo;(0tleoifctadlmDrluei (  rtmim3no1ll emiei s srrr(mo;o1tex micilt aDem( p;()alxrmr ta1fat an o;s0 2to(mpoo1lltn ivil(f 2urx oou0tetn iciad mDelnvsnt) exnxr oadlmte ueslt teuoim3iy1om e ncilt) ruaumonu1aleoii3iyslm ulnms t4artnmf3oydfpt liesls s2tmxr3iy4apt mietas)s2trxr ;u4opeomoctatlm2eaumpnu0tlerxr3iy1om   uei t0 2xmiopio4lmee ictls)aruaxmpnu0oexoiietlsfm2uau s;(0alxoxr3io1fmD anvs;s s2xm(opoy4alenmiciat sruaxmono4alxnmi3iys sDulnvo t0 rerircoatlmtrai ols0s2toir iydomtelnciatf Dtm(mpou0tlxnii3tld a2emnvo t0trtnif iydomt livs s srum(o oo1lp emfvtlt s2ua(mpnu0olxnif3iys a ran pn(4tetnmfcia1opteauei;t  rtoxr iudalen fesa(  Durxr ;t4aleo iciltfs2ua( onu)tlxrmf3iotomDe i s s) rur(mpoo4ope lfvslt)a2rmxrpoo4opx iocildlmDuluvo u0 eenir3oodoaDranesls)trur(r iu1am nlnctasfsDuau pnu4apeniiciys mDelnmp;u4aetrxrciadfmD  ies;(0srtoxrpoudopeemici tfaDtm(rpoo1tptnifetad m uluvp t4artoio iotlatelnvsls  rxoir3oy4llee fvslsfaDuauronu0alenifeiatfmDuanmpnu0 lxnmo3todlmD  ues s  rurxopno1optn ieta(f ruru  nu0oex  fetysfs2e
\ No newline at end of file
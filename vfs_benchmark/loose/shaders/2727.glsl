@@ -0,0 +1 @@
+u i;()srum(rpou4apenlfciasfsrrrxro;t0aetn o3tltfa rlumo;() lenmf oatfmD  ivs;t texrxr3iodomt licil(farumu  ou4oetnmoeiyt s2eaump u4trxrmfciytla rluvi t s2tm(o iudlmee nvs ()sDrr( o;u4oetomictyd m eluvo u0alxrxo3oodop  anvs (  exrxrpoy1op  miviat a2umx ooo0alx  iciat s2rm(mo;u) rtoxf iatfmD livi;()trur(mpoodom  mfesas  2rmu poo4oet moeild a2ua(vp;(0alxrxfcoydfp r ueslt)srtrio3nu1am nmfvsasf 2tm(m ;u0alx  o3tys a2emnvp;() ltrifcty1fpDrlneolt0 2toio3ou1lm e ictl(  rrm(m no0oex  icilslm em(vo;(0texrir3oa1omteli s;t0trxoio nudope mfctl( aDtau poo1tleo f3iad sDem( ont)aexomo oo1fmDe ieilt  exm(o3nydolte feils srum(roou4tlx miciasla rmumo u) rtomo3ootomD aueolt0sruoir3iudalt lfeilsfsDraxmp;t0tet iiciydlm2uan p u4artrxrciydfat auvi;( setmim3oodlpee netlt sDurx pnu1optnmoetltlm ulnvo;t4 etrir ta1fa raieil()setoxrpnu1op emfeslsfsDrau oou1opxomieiydfs rmn o;t4alerxf ty1lmt  u o;t) rumxmpiu4am elietat  rra( pnt4tlxo ictyt aDelu o ()arxnifcoo1lmDraieo t)trum(mpiodam n fvt s s2tmxmo;o4tlt  i3tldfm uaumpn(0texnxr3tytfmDeaivi (0teuoir3nudolte icsls  Drmu  nt1apto f3tat a2emnvs;u)tltrxrcoodfmtrlu i (  2toir nu1lp elncslsf Dtm(  nt1oet iieiysfa emu p;u0treomo oa1laDr ueols t2tm(mpoudal elictls)artax poo0aexo ociyslsDrauvo;t) etnxf3totla e u o (  ruo(r oudalee fcsls s2taum ot1tpenio3iat s2ranmo;u0aetoxo tytfateli ols) exoxrpio4opeemnvia(f rrr(mpnu1apt  ocildfmDulnmp ()trxomr3todom  lu o t  rxr(mpoy1omtn fctat srurxmpnt0aetomieiysfs2ran o;u0areoio oadlat auvsls)setm(m3ny1oltn ict ()aDtmxr ot1tlx mfetlt m2rmu pnu)tltoif iy1opte i sls srur(r oydolte nvsl(fs2ta(  ot4oltomf3iltfaDem(vo t0 rxnxo3oydop  liei;s0 2xoxmpou1ll  lfct () 2tmu  ;o4ope iocilslm rln sn() rerio3oo1oaDr ies;s) etr(r3ou4ope lnvsl() rtrx  ou4alxnio3tysfm eaumo (4trtomf3ia1oa   ivils) rtmxm3oo1lme mnes t  rrm( ooo1alenmiciltfm um(mont0arxoxf3totlmte uvils0sexr(rpoydlltemfvs () rtrx  ;t0apx mociydla ulnms (4alenmociotla  aueo (0t2trxr nydole  iei ( srrrx pot1altomo3iltfaDean sn() etnmf3ootlaD lneo (0t2toxrpio4llte nvt (f 2ur( o;o1olen i3iadla ulnvsnt)tetrxo iatomtrlnes;s)sexr(m io4apt  fvtasfaDumur nt1apx  oeiltfmDran onu0alermr3oytlpDrai i;s)t2umimpoydopt mivias)s2umurpnu4oleoioetysfs uauvsnu) ltrxo3tatlatr neols) rxoxrpoodlmeeliesls) 2urx o;o4tetomfetadlsDrm( snu0texrmocoytopDelnes;s  2umim oo4ll nmicta()srtau  nt1oeenmfctat m2emumont0 eenmocoodop rauvs;( setmiopou1omen ivsls  Dtrumpnt1tpe io3iyt m ra(vsnt0 lxnxo oodopt  uvo;()srtmxm ou1ale  fei t) 2ta(  ;o4tpt  oeildfa ul( o u) lxrxo tatomtrlneol(0 2toio iu4altemnesl(faDur(rooo0aexo icils a2elumo u)texoiocoo1faDelneils s2to(rpny4lmeelies sfsrrm(ro;u4apx  octlslsDrluvo;(0aexoifcoa1late u ils tetrimpio1oltnlivil()a2ra(  oo4ape mfciltfm el( snt4 etrxfcoy1omteli o;(0t2um(m3ny1lltemiet (f rrmu  ;u4alx  o3iat a emu s;(4tltnmo iydoa r ivils  2xrxm3oudomeelfes () 2uax oot1tlxn oeiat sDrau p;t0alenxo ootlatean o (0s2tmirpnu1am   ivi (fsDtrum oo0ape mfciadfsDrauvp t4tlxoxo iadoa rlu s ()seur(o3oudom nlnci sfartax oot4alt mieildfs ea(vo t)teenio totoptelu ils srxmxmpiy1op nmncsasfsDrrx  nu0aetoiicilt sDem( pn(4 exoirctytlm   u o t)truo(rpou4lmen nvilt) rumurp;u1ole  fctldfa el(mon() eenxr tytfp  lu ol( t2trimpno4lmenmncta()artm(r nu0olx ii3tytls2rmuvs t0tlxnif ia1om   ivo t0 2tm(m nu4apenlnvt t  rtrxmp;o0opt mfetltfm2eln snu4treoxo iodomteaiei () etoxo3oydol elfcia()sDtauro;u0aetnii3iys a rm( p;u)aleoif iadlaDranes;t0 etr(r oy1aptnmieil( aDtrx ooo4oexnioetytla2em( on(4 rxnir io1laDe ies s)t2umimpou1op emfetlt arua(  nu0aeeo oetldls emumsn(0tlenxfciy1fa elu o;()seurxr3io1opte fcsasfs2ta( pou4tet  ocildfm2emuvpnu4tleomr3to1fp r uvol()srxoxo3ny4ape mnvtl(faDumumont1ope iociyd a emuvp;(4arerxo3oo1op rluvsl(0 eurir nudoltelfetatf Drmu  ;u0ape mfciadfa elumpnt4 lxomrcoytopt  i s;t  2tmxr oy1om emieslt)a2ta(mo;t1aeen octydfm ea(mpn(0teerir3oa1om elnes t)s2xo(mpno1ll nmfetat) ruau  oo1apxnmi3iytfm uln s t0teeoxr todoatraivsls0seumir nu1ol emnvtls) Drau p;u1alx  o3ils mDemn s ()tlenif tatfa r ues t) rtrim oudap elnci t aDtmurooo4olt  fciasla2rmnmsn(4arxoxo ty1omte i i;s)sruoxrpoydamenmicsatfsDrm(mp;o4apt micils a2ranvo;t) lenxo3oa1opte n o (0texmio iu1oltelnvt sfarrru pou4alt  fcilsfm2ul(vs (4 rtrif oodomt aues (0t2trio3iy1lmen nvsl(fs2rmu pou4opx ioeiasls2rlnvo;u0 reoif ty1lptr iei ( trumim3ny1ol nlnetl(  Dur( p;o0alxn oeiadlsDumnmonu4 leoxfciotoat aivs;s) 2xrimpou1amen nesa(fs2umxrono0aetn ieiadfm2ran ont0aexnir tatoa  au il(  etm(opiu1altnmies t  rrmx  ;u0opto feils aDeau p (0 lxrmf oytlm ranvs (  2uoxo3ou1op nlnvi sfsrumumpno4oetnifetlt mDemn pnt)trxrirctotlptrai i;() 2urxo3nu4optemivsas)aDtmu oou4tlxniociltfaDea(ms;(0teeomr3iadlpD  ivi (  2xmir3oo4aleemncilt)s2umu ont1oetnmieiltlaDua( s t)aetrxf oo1laDraieo;s s2xmimpnu1amt mncsas srurx  nu1tltnmo3tlt sDrmu o;u)areomrcty1lmt aieo;t sexrxm3ou1ol nlics sf Dta(mp;u4aee  i3tytfmDrluvonu) eermr3oy1omD luvs t) rumxm3oo1om nlivtl(fs2rrxm nt4apeomieiydfm2rauvp (4texnio3oydopt ai o;t trtmxr no1lleelncsl(fa2ta(moot4tet  ictydfm2uln pn() rermf oadomDrlueo s)t2urxm nu4lmtelfctltf rumumpou1tltnioetls a rmumo;u4teerxf3ta1opDeauvs t t2ur(r nu1ol   nvi t s2ra(r ou1tlxomicild s emnvp u0arxoir tytfmDr ivo;t0 etr(rpou4lltelivilt)srrr( pot4aleniiciaslm elums u)artoxo iodfmDe n i;s0trur(r nodamt  feia() rraxmoou0tpxo oeildfsDuau o u4 etrmr iydlm eln o;s) etrxr3ou4op emfvtlsfs2tm(rpoo0apxnmo3iatla2uauvp u)teenxf iadoate ivs;s  exriopiodol  mies tfartmu  nt1alto ictadla rl(mo;t4tltnxo oo1om ranei s s2trir3iy4apeelivi (fs2tmu pno4tltniociat s rmn s t4treomocoy1latean ols srumim3oudlltnmfvtas)sDumum ;t0aexomo3ilsfm2rau p;t0tleomf3to1omteanvo (  exrxopoy1am   fcs t) rrr(mp;o0tpt mfetysfsDemumpnu0alxrmr3tadlmDelivol(0 2tr(o3no4ape  nvil() rrm(  ot0ole mfctydla emumsnu) lxrxocia1lp rlues;t)sexrxm3iy1apee ivta()srrrx  ;o1optnmfeiysls2rl( o;(4 eenxociydfat lneo ( texmxr nu4omenlnetat a2uaxm ou1olt iieiasfs rm(von(0 rxnif oydlpD lu s s0texrim oodlmte ncil(fs2rm(r ou1alenmieiad mDel( o u)aetnioctydoatr nvs;s  etm(m oo1amenlfvtatf rur(ro;t0ole mociltfmDrm( s;u0 eenmrciytlm rai sls0 2to(r no1lpe  fcsasf Durxmpoo1aptnioctldfm rmnmo;t4areoif oa1faDr ueol( trurxm3iodlm  lfeilsfs2rm(rpnu1tlto ictld aDrln ont4 exriocoo1lmD ln i;t0texo(opoo4lp nlietatfarraurpou4tpe ifctyslm rlnvo;t0 rxnxo3iydla elnvi;( seum(rpiudlltn ncsl( sDrau o;o4aex moctytlm2emu o;u4tlenir tydla   i s;s)tetrimpnydapt lfei () rurxrp;u0oetomoeild s uanmp;u) rtrifciydfatrai slt0s2xrimpoy1olenlnes s s2um(ro;u1ale  oetatfa2rl( pn(4teerifctytoa rlivsl()teumxo3iydlle  fci t)arraxrpoo0tpeomfctysfs uluvpn()tltnxf ootfp eli o;( t2tmxr nu4lmtemncslt) 2ra(  nu4tet moetasfaDranmpnu)tetrifcto1lpDeanvslt)truoir io4lp nmnciat)srrr( o;t4tltnmfciydls2em( pnu)trxoxrcoo1lat lu i;s0 rtmiopio1om  mfctas)aDtrxmo;t4tpxomfeiyt m rlumo;t4tlxrxf iadfa ean o;s0teumxopnydomtnmfcsa(f ruaxrpnt4tlxniieiys mDrauvo u) exrxo3iy1lat an sl()sruoxo3oo4olenmneta( artrumont4alx mf3ildlsDumn p t0alenxo iatopD an s (  rxrxr oudlmt  nvtls a2uaurpot0opeo feiasfs ra( snu)aetomfcoa1oaDr ieils texoir oydoltnmncsa(  2ra(  nt4tpe  ieias mDumuvo t4 rxrmo3todfa  aueo t0srxr(o3iy1alen icta(  Duau ont1ale  ocildfs2ul( o;u4artnif3tytfm elnvs s)trum(r ny1lltemfvs sf rumumpnt4tpxnmi3iadla rln o (0tleoioctotfpDeluvol(0s2ur(r io4lmtnmnvia(fa2rmx poo1tpeomfciltfm2elnmo t4trxoxoctydoate i sls)t2tmxmpoy1am nlfcsas)aruru  nu1oltnmicild aDraumpnt0 exrxf ootfat  n s t  rtoxm3iudalt  nctls  rtmurpoo0opeo o3tld sDrl(ms;t)trxomfcoy1fa e ivsl(0seurir nu1op nmnctatfsrrrx pnu1olt io3iadlsDel( ont0trerio3totoaD  neo t  eur(r io1lmenlfct sfsDta(m oo1tpx  iciltls2rlu o ()aetrif3tadla   nvs;t t2trir3ou4lm elivias)arrm(r nt4ole  ieildfs umu p;t) ltoirciotomDelnvo s0trtrxopiudlltnlfes (faDrm(r nu4ale iictadfa2eauvo t4tltrxf iotfpDeliei;(0srurxmpnudole mnvia() Dtmxmpou4tetn f3iadfs2rlnvpnu4 lenifctytfp r u s;t trxmir3ny4ale  fci s aDum(mo;o1tetn fcildfsDrl( snu4texrir3todom eaieo t0 2xo(o ny1om  mfvilsfaDrr(rooo1oetn ietyt aDuanvo;()teenirctotlpt lies;s) exrir oy4ale lnvt tfarrrx  oo0apxoifctls mDeanmo;t) rxnmr tatlateaiesl( sexmxo io1lme mies (f Duaxr ;u4opxniieiydls elumpnu4aexnio3iadlaDe u i t)trto(r3oydol elivi s  rrm(root0oetn ociytls2um(vp t) eerxrciatomt lueols0 ruoir io1lpt livt s)srrr(r ;o1teeomfetas aDuanms (0 rtrxf ia1lmDean s (0seumxm nodlp nliesl(fs2uaxrooo0apeo fctadla ul(mp;(0tlxrir ty1late iei;s t2xrxmpiu1lpe  fcilsfa2umurpno0tpxn ociysfa2uan snu)tltomo iydoate n o t) exr(m nydlpt mfetl( s2tmxrpoo0altoioetld s2rl( s;(4 ltrio3oo1lmteaivo;s0 ruoim3no4ll e ivt t srrau poo0alxo o3tad mDua(ms;t4tltrxf3ia1opD  ivi;(0s2tm(mpoo1ap  lfvt s a2uaump;t0apxomiciltlm2em( s t4 rtomocoa1lateanvols)trurxm iu4al emfeslsfa2taxmpnt1tet mfeiytfm2ulumsn()alxrxrcia1fa eau o t0 2xo(opoy1apeemfvs s  rur(mooo1aet  o3iatfm rm(vs;t) lxnmf oa1lpteluvo (0 exrir3oydlmen feil()s2umum ;o0aet mf3ils m2ua(mpnt)tltrxf tatfptrlivo;t  rxm(r io1apeelnvtl( arta( onu0alxnmfciltfm ulnvsnt4aexrio3oadoptraneo s0 2xo(o3nu1olt lictlsfaDtau  ou0oetn feilsfsDumnms t0trtomrciatfm rln il()sexmir3oodlpen ies tf rumur ou4aeeoifciasfm2ul(ms;t4 lerio oatfpD  nvol(  etrxr iu1lpte fet t)srrau pot4tetoii3tlsls umnms;()alxnmr iodoaDe ueolt0 rtoxo ou1lptnlnvslsfarrrxrpnu0tee  ietys m rauvsnu0tetrmrciytfa  aneilt texmxmpoydlp nlnvi (f ruaum ou4aetn oeiysfs2elnvs ()alermf iatfaD au o;t0trtmxm3oo4omen ivslt  2tr(mp;u0tlxomf3iysfa eanvo;()aexrifcoo1opt aneo;(0teumxr3oy4om   ncs t a2uaump;t4olt mictysfm ran o (0 etomocio1omtrauvo ( s2xrio oo4omtelfvt (  ruau poo0alt  oetysfa umump t4alenmrcoo1fm raneo;t setoirpiu1lptn nesasf Drrxrono0alxniiciyd mDrl(vp;t4treoxr3oa1fpDrai il(0setrxo3nu1apenmnvtlsfaDtaxront4tet ioctyd a elnmo;t4 rxrmo ia1lpt lnvs;(  2uo(m3io4ap nlivslsfsDtr(r no1opxo fciasfa2rmuvs ()trenmocoatom  aues;( setrim3oy4al  licia(fa2trum oo4tpxoii3tys mDulnmo;u4 lxnir tydop ean s;s  euoxm3oodomee neta( s2um(rono4alxoiociatls2ea( o;(0trxnmfcoodlm r uvsl() exmxrpiy1op n fvtlt  2trumoou1tleniieiysfa rmnvo u)teenmocta1om elnes ( srurirpoy4lpt  ictls s2ta( o;u0aeenifeiyt a2eln p;t4arenxr ta1fatr i i;t seum(o3iudole mivta( srraump;u0altnifeiydfa2rm(vo ()trxomfcoy1oaDr nvs;s  rtmio nydomen ictat) 2umxmpoo1optomo3tysfm eluvs;(4texnxrciatfmDeauesls0s2to(m3nu1aptnmiviat  ruaum ot1oetnmfeiys s2ea(mo t4 eeoxociatopt  uei;s0 rtmiopoo1ap emivtl()aDrm(  no4tlt io3tadla2rlnvp;t0tetrmfciatoa eluesl()srxoir oydlpee ivta(  Dur( o;u4apxn f3tat s rlu snu4 rtoif todfa eaiesls t2toxr iudllen nvsat) 2tr(r no4teeoioeiasfa raump;()alenxo iytfaD aueols  2xmio no1llenmncs tfaDum(m ou0apeo iciasla uanvo;t)aetnmocio1fat aieils)setmimpiodam n ictat)aDtax oot1openiiciysla eau p ()treriocty1fm elieol()tetrir3oudamt lnesa(  Dtm(rpnu1oeenii3iysls ulnvpnu4 exrir oodoptrau o s s2xmxrpnodome lnvia(farrmu pot4tpx ifctyt s el( onu)trtnxf3ia1fmD  n sl() 2xo(o oodllee nvil(fsDrmurpoo4olxn ociatla2rmuvsn(0 leoxr oydom raivs t seurim3oudlpeelfvia(fsruaurpou0ole  oetldfs2rmums t)texoif3oo1fm r nes t t2xm(rpno4olenmivsas arrmu pot0apx mo3iaslm rlnms (4arxomo totlp  ai sl(  2tmxr3oudol   fciatf 2urumpnt0aleo ocilt aDrmnvs;u)teeomo oydopDraivs s)teurir oudllt lfvsat  2tm(r ;o4opto feiltls2umuvsnt) lxrxr oytopDeliesl(0srurxmpny1am nlivia(  2uaum ou1olxnio3ias a ranmo;t4aetomr iadfmDrlu s ( t2uoxo iodlltelfci t)artr(  ot1tleoiieiadfaDeanvpn(4trxoxr tatoptelueol()tetoimpno4lpeemivsasfa2tmx o;t1altn i3iatfaDel(vont0teenmfciytfpteluvs ()trxr(r no1olt mivtatfaDrr(ro;t4aet moeiadfaDemnmp () rxoio3ty1lmDrau i;s0seurxo no4ome mnvsa(f 2urxmp;u0alxn oeiad a2emuvs u4texrxrcoadoat lies t0s2xmirpiudoleelfcia(  2trx onu1apxn octyt a2umnmo;t)teerxf iytoa  luei;t  exrim3oo1lmt lnvil(fs2umumo;t1optn fctasls2ranvs;() rtomfcoo1opte uvslt t2xm(m3no4am  mnct s arrmx ooo4aptomfciydlsDeauvsnu0tetoxf oadlpDr ies s srxmir ny1op  licia(fa2trurpot0aleomictadfaDemuvo (4teeomf3oy1op e u o;()trtr(opnydam elies s  rum( pno0tpxnioeiltfa2eauvs;(0trxnifctatopte uvs t0srur(m3oudale  ivil(f 2rm(monu0optomoeils mDrm(ms;t)artnxo3oy1fpt aues;t0srur(mpnu1omtnlnvt (f 2rr( pnu0tpto fciatla2ean o;t4 leomrciytlm   n s s0seumxm3no4al nlictlt) Draxm nu4ale mfeils m2emnvo u)artnmf3ootoa  li i;()teumxm3ny4oltnmivt sfa2raur ot4tltomfciydfsDua(vs (4 eenmf3iodfa   uei s s2tmir oo1opte iesl() 2rrxmont4oee mociad aDuanmo (0alxomf3iodfmDr n o t)truo(m iu4amtnmfetls a2uax pno1aptoio3ild a ranvp;(4 eeomrciadfm r nvs;s0 2xr(opiu1oltn ies s)aDrmu  nu1tlxniieiltfm emumonu0 ltnmfcty1oate nvols) rtrxrpiy4am elivslt s2raxm ;o4apx ifciltfmDul(vp t0artrmrcoy1op  aies;t0 2uoxr nu4ol emfcilsf rra(rpno4apenmfeilsfm em(ms;u0 etomrcoodomD  nvils0trtrxr3nu4omtemnvtl()a2urx p;o4aex moetat aDraumon() ltnif3iotfaDraivs s)teurim3ny4lpen fvi t) 2tmxrpno4aexomictatfm2ulu pnu)tlerxr3iatfmtelivo;s0s2xoxm oy4lptnmncsa(f Duaump;o1tpeoioetytfmDeauvs;u)tltnircoadopte u s s srtmir3iydlpenlictlsfaDrr(roou0aleomociydfs2emuvs;(4 eenmf3tadom e nesl( s2xoxo ny4lm nmiviat)a2rmxmono1aleo feilslsDra(vs t)tltnir oa1fp elu sl()texo(m ny4lmt lfvsa()aDrmurono1aexo octydfaDra(monu4 exrxocoy1omD  uvols s2urxr iudolenmncsat) Dtau pnu1tlx  ietldlm2umu o;(0aeeoif3totfm rau s;s) ruoxr3oo1ap   ncsat) 2tm(mpot1alto fciltfa uluvonu)arerio3totlmte nvs t setoxr oydlp elnci s) rtau pot4aet mociydlmDum( pnu0arxnif3ia1faD lnesls)setmirpoo4ll n icsas aDuaxr ot0tlto feiyslsDrmums u) exoifcoodlat an i s0sexo(m nu1ll elivs t aDrrur ;t0tpto fciaslsDean pnu4areoxo3tydlmD  u ilt  rtrxm nodole lnet ()sruaurpou1aexomiciyd a2ra(vpn(0 lxoifcio1fatrli o;t) 2xoio iydlpe lfvil() rraurpoo0tetn ieild m rmn s (0 leoxr oadom   i sl(0sruo(mpoydole liet ()srum(m oo4tleniietyd aDem( p;() reoio todlmDe ieil()teuo(m3oy4oleelnei s) rra(  ;t1texnif3tldlmDrlnmo t4 ltnir oo1faDrauvi t) etr(r iu1ap elictltfsrrm( pno1oleomfetyt s2eluvpn(4 rerxfcoadlatrlivo;(0 exmxr io4om  livs sfs2rax p;t1apxomo3tadfm umn p;()arerxfciy1omDelnei ( trtoxmpnu1om n fet tfsrrax  ;t1tlx iieiasfsDrlnvs u0artrxr3iodop r i i ()srxm(mpou4al e fvilsfaDum(ront1alt mieild s ul( on(4tltomr todfatranei s0 etr(r iu1openmivs s)s2umxmpoo4aetn ictadls em(vpnt)trxnmo totfm  ai sl()teur(mpio4lme  ncsa(  2tm(rpoo1optn o3ilsfa elnvp;t0aeeoxf3iydlpDrlnesl( texmir iodll emnetlt a2ua(r ;u0tleniociytfs2elumo;u4 rtomo iodfpDelues;t srtrio oo1lm   ictl( sDrmx o;o0tptomf3iat a2um(vo t)arenxr oadoa   neolt) 2toio no4ap  mneils  rtmum ot1oexniociad a2ranmo;u0 rtnif3iy1oa  ai i;s)seur(m3oydlm  lfesl(fsrtrum no1tpt  iciat a2ulumpnt4areoiocoadfpDrlueo ()srurir no4oleemfvta()s2rrxrp;t0alxo i3iadlaDeanvsnu0alenxf3todoa   n ols t2tm(r iudalt lfcslt)arra( p;t4aexoii3iys s2ean s t0trermrcoodlm   i s s)teumim3ou4opt lics sfsDuax poo1oex mociytfa umn pnu0 lxrxr ta1opteau slt0srto(m3iy4altn nesl(fa2ta( pot4alx mociyt mDrmumsnt) exoir iodlm r ieol(0srxr(mpnydap nlivsat) Dtm(mp;u4openioetas m uanmpnt4 exoxoctydoaDraneo ( teto(m3nu1optemncs s) rrrx o;t0aptnmicild s2ulnvp;() eenmo3tytoa r ieols) 2xoxr3oydlm elfcilt srrm(ront0tlxn f3tlsfaDumnmont0aetoir oadfmDrai o s t2toirpnu4ameemnctasfaDrrur ot0olt ioetatfsDem(vs;u) renifciodlaDe uvsls  eto(rpnudopt mncs (  Drr(m ;t1oex  ieils s elums;t4texoxf oo1lp  lu o (  rum(m3nudal  lnvtasfs2umxroot0teeo o3iysfs2eau s u4 eeoxfciodfm   u ols0 2tm(o ou1am elfcsasfaDua(r nt0opxniieiaslmDumnvs (0trxoiocootfatelivs;t0srxoxm3iydom nmfvil()aDrmxmp;u4olenmoeiadls ra( s (0altnif3ty1opD aiei;(0trtoio oo1ol  mfesasfsDrrump;o1ape if3iysfsDrlnvs;t4tlxnir3to1lmteaiei;(0setmxr3nudlme mfviltf rtrxrpot0texo oeiltla2rlnvs;(0trxnif io1om  an ilt0s2tr(o3oy1al elfcil()sruau  ou4aleo i3tyt s eln s;(4arxnmo oatlaDranvolt0s2xrirpoudop nlncilsfaDtrurpnt1teen iciltfs rlnvo;u4alxnio oytom eaneols teuo(mpiu4op nmicsl( a2rrurono4opx  f3iydfsDemu o;() rtnmrcoadlp ranei (0srtoxo3nudom elnes t s2uru pnt1tlxn oeiat m2umums t) eeoir tatfmt anvol()trxmir3io4apt mfesa()sDuaxmp;t0tex  f3tytfmDulnmo u)aexrio3oatlatrli s;()teur(opiu1ol n ncsas)s2taurono4tlto icilt sDran pnu0 eerir3iotlpDeln o t) rtrxo iodam  mieias sDrrxm nt1olxn oeiltfa emnvsnt)aetnxr3oydlpDeau ilt0srurio3oy1am elfetasf Drrxroou1aee  feiatfa elu o (4altnmr oo1opD auesl( sexrir3nodoptelfvi sf 2umumpno1apenmo3iysfs eluvp;u) lenxr3oadoat ai s t)t2xm(m3iu4lmtelneil()a2raumpnt0texoifetldls2emnmonu)tltoio oydlat  nvo s) etoim3no4amte ictls)aruaumpnt4tpx  i3ildlm umnvs;()artrxrcoadfa  livsls teurxo3oodlltn ietas)sDua( p;u0oet if3ildlm2uanms;u4 lxrifctydoate i s;s)truoirpny4llen nes s sDuru  ot0oetoif3tldfm em(mp u4 exrmfcoadfpDr n s;(0 rtrxr nudaleemici sfaDua(ro;u4olx  i3iyt s2ulnms;()teeoif3ia1opD  i s (0 rto(r3nydoptelfet (faDum(rp;u1texoiiciytla rmnmsn(4texoio3iatfpDelivo (0 rtoxopiy4ole mict (farua(rpnu1openmietasfs2um(vs;t0 lermr3io1lpD lies s)trtrim3iodol   icil()s2rmxrpou0oeeniietlsla ranvs u)tetoircta1lpDrli il()sexm(m3ou1omtnlneil()artmxrpou1tptnmf3iasls raumsnu0treoxf3tadlm  luvo;()seto(o3ny1oltn iei s srraxm nu1apen ocilsfsDrl(vs u)trxnir3iatfmte ies s)seuoir ny1oltnlfetat)aDrmx  ou0tet  ieiadfs2emu snt0alxoxr3ty1lat  u sl( srtrxm3ou1ll n fes tf rua(mp;o1tptoiiciatfm ulums;t0 eeomrcia1laDr ueil() euoio3ou4ll emnesl()a2tr(m ;o0teeomoeiydfaDuauvp;(4tlxoio tydfat livil(0trur(rpiy4omtnlietlt) 2tr( ont1oltn oeiltfsDemuvon(0texoxf io1lptr ivslt)srur(r iydlleemictas)aDtrx  nu0aex  i3tld mDelu s;()alxrxo iodlatean ils seurirpoo1lltemncsatfsrum(m ot4alx mictatfmDumnmpnu0areoxo oy1lpDraivo;t)trtrxr iu1lp emnvs s) rrru poo1oltnmoctlsfm2rmump u4 eenmrcootfp rlueo s trtrxr nudam elivils srrmxrpou1apenmfctldfm rmums u4aeerxf3iy1lm r nes;s) exrxrpio4opt mfcil( aDrmu o;t1texo o3tatla em(msnt0aexrxr tadopDr ueo;s)s2umirpiy1om  micias)s2tm( onu1opxomiciysla emnvonu4alerxf3ootopD  uvo t tetrim ny1opt lies s srta(moot4openmociytlmDumnvo u)tltrxrctatomteaieo s)setmxr3io1apeemiei ()a2rm(m oo0altnif3iatlm2uan p u4arxrif3tatlatrai i t0seumxm3iu4apt lici t) 2rr( oot0aptnif3tyt s rmn o;u)tetrxfciytfaDeli ilt  exoir oo1opte ncilt)artruronu1aet mieiytla2elnms u0alerxo oatfmtelueo;t) 2to(mpoy1ape lnvslt)srum(m no1ope  fctytlm ra( p;u4altnmf oydlmte n i () 2xmxr3nu4lme mfvias) Drmxmono4tpx io3iasfm ulump;t4 ltomr oy1fat auvo;()srtrir3ny1am n net sfsDtmxmpnt4opx iietatfm2emu o;t0 reoifcta1fmDelu ils sexmim3io1altn icil()srua( p;t4alxn oetld m2rl( sn() lxrxr3ta1fpD  n olt  2urxopiydlmeemnctlt)aDtr(m nt1alenmo3ildla2umump t4trerircta1oat luvslt0seurxm iu4openmivsat)sDta(r ;u1tleo fetas m rmu s;u0aeerxo3iatfpDr i ilt) eumio nu4lmt lnei s)aruax ont4open oetyslm2ul(ms () renxo3ta1oat  ues s)t2umio no4lm n fcta( sDrau pnt4oet iociytfa2rmnvo;u0altoio3ia1lmt luei;s s2xr(m3oy4ap e fetasfa2urumo;o1olxn i3iysls2eanvs;t4teerxoctadlmDrli i;s srxrxrpoodllenlfcsat s2uax p;u0tptnmi3iysls2ul(ms;u) rtrxfctadom e ivs s  2umir oy4lpeelnet s) 2rrur nt4aee  octadfaDea( p t4altnifctydom  luvs (0 euo(opoudoleemicslsf Dtm(r ou4ole mi3tys aDel(mo;t4 ltnmr tytfaDe nei t) ruoxo no1apte nvilsf 2tmur ou4oee  o3ild m2ranvp t)trxnir to1lmtr nvi t0trurxrpiudol  mieiat)a2urxmonu1oetomictldfm ulu p (4 ltomocoytoaDrauvols)trxoxr no4alt lfcia(f rum( oot4texniieiytlmDran on(0tlxoir3oytfateln ils  rur(rpiy4aptemncias s2trumo;u4tptnifeiatlaDuau p;u4artrif3oy1fptr ueil( srxoxo oo1lptnlncsasfarua( pou1apxn feiltfaDrlnvp;(0aeermr3iytoatelnvs;(0sexrir nu1ale liei ( aruaurpnu4apxnmoetadla rlu onu4 ltrif totlpt aies s  euoxrpiy1lltn fvi t a2trxm ot1oltomi3tad m eau s;u) rxriocoadfm r nvo;()s2xr(o oydam  mfeil()aDrmuro;u0altn ocilsfsDul(vp t0tlxrmr ta1lptrlivi;(0 2xmxo3no1opee netasfa2uaumpno0alx iieiasls uaumo u)tlxomr io1lpt  uei t)t2trir oodlpeelfeilsfs2ta(  no1tltnifciysla eln o t)arxoxf3ootom r u i s seum(mpiodomt mfetlt) Durx oot1aexomi3iadls eauvo;u) etnmocoo1oa   ues;()s2xmxo3oo1lp nmfvtat)a2tmumo;t0tlx io3iysfs el(mo (0 leomo3iatlmt ln ol( srxmxopnu4om  lnci ()aDraum oo1oexn f3tatlm ul(vp;(0 exrmr oo1fmDeliei;s0 rxmir3oudamenmnci (farrr(rooo1tex mictadfa2emnvp;u4 eerxo oo1lateaivslt  etmio oo1oltemivilt) Dtrx pnt4aeeoifciadfmDrl(mp u4teeoxfciodlm rli s;( t2tm(rpoo4lp e fvs t)sDtmurpoo0tlx mfeiasfsDel(mo t0 eermr ootlp rlnei;() etrxo3ou1lmee fvta(faDraxronu4apx  iciytls2ua(vp (4 lxoxfcta1lmtelneolt srumxopoy4ll elfeil(fartmx ooo1oeeo iciatfsDea(vs;(4 rtrmr3iotop rliei;t  rxm(opoydlm elfes t)aDra(m ;t0tpenio3iytfsDrlu onu)tlenio ootlm e ivs s0 euo(opoy4op n ict tf rta( p;u1aex io3tatfa ul(ms u0altoirctodfpDe ivs t0t2xr(mpny4op   ncias) ruaxmpno4ale  o3iatlmDumu onu) ltriociotopD  u s;(0sruoxm3ny4aleelfeslt sDrrx  ot4oetnif3ilt m uaumo;t)altoifciatlaD auvs;(  etm(o iodllt lfvt t s2rmu ooo4apx mfeiatfaDul(vo;u)alxomf tydomteanes;(0srumiopou1oleelnes ( a2uaxm no0aetnmocilt m uauvo t0 lxrircty1lmtrlivo;t)t2tr(opio1llte ieiasfarurx pot1aeto f3iadfaDrmu pn(0arenxo iodlmt  ieo;s)teto(o iodaltnmnet ()s2ur(rpou0tleo f3iltfmDrlu s;(0 rtrxociydlmD au i ()tetr(r3iodaltn netltfarum(rpoo4texnmfciaslsDrln p (4 renxo iodlp  ai ols0 etoiopio4lp e iet (farrm(  ;o4aetomoetydfaDea(ms u)alxnio3oo1lm rlieolt)sexmxr iudap  mfvtas)arumurono4olxoii3tys a2ua( p u0aeenmociytfpDelneilt)s2toiopnodolte nvtlt srtrx  oo1apen ociat s elumpnu)arxnxr3io1lptrai o;t) 2trimpiydapen iei t srumumpou4opxniieiltlmDranvo;(4tlxnmrcoodoat anes;t0setmxm oodalt lict (f rtru pou4tpeoiociaslm2ulump;t)texnir ootomtelnei s)s2tr(o3ny1op  lfvsatfaDuaxmpnu1aexnio3iysfsDuau p;u4aexoio3iodoatrli slt  exr(rpio1lp  lictls)srrrumpnt4aleomfcildlm2emump;u)alxnxf ia1optran s t0 2toxo io1lp n fcsl() rurum no0alxoii3iat aDrl( snu4 lxnxf tadopteau o;s0seuo(m3iy4ape mfeta()a2ur(  ;u1oeenioeiys a2ul( o u0 ltnxf tatfmteaivo t)trxm(o3iydlpe  icsas)aDrrxrpou1tetomoctlt s2umnvs () eenxf ty1opDraneols0 ruoimpny4ame mics ( sDtru onu1olxn f3iatfs rmnvpn(4tltnmoctatla elnei t0 eur(r3no4omt lnvs t)sDtru  nt4olx  o3iatfsDra(vs;()arxnxo ootoat ln i (0 2tm(o3iy4lpe lfvt t srrrumooo4oexn fetasfaDuaump;u) leoxociadlaDelueslt)seuo(rpiy1lmeemnvslsfarur( p;t0aeeoifeiatfs2eluvpnu)aetrioctatopt  ivol(0setoxm io1oltnlnviat) Dua( p;t4tlen i3tasfmDeauvs ()aetrmrctotfate i ils trxmxrpoo4ap   fesl() rtaxmont1tpxn fcildfm2eanmon()artnxo3iodoa  luvils0trurxr3nudllt mietas)a2rmxm ;u4opeo f3iadfsDean s t0tetrxf3tytfptrau o;t srxm(r3ny1ll elivi tfs2ra(roou0teto feildfm2eluvsnu)texnio oatfm  anei;()srxmxmpoo1ol   icsat aDua( ont1aex io3tltfsDelnmo t0aeeoio3oy1oate ies s)trtoir iy4amt mfet t s2um(mpnt0tee mocilt sDulu pnt)arxrmrcty1lm eau s;s)srtrio3ny1oltnlnvt t  2raxmono4oex  o3iad sDulums;u0 eeoxr3totfm elu ils tetmiopoudoptnlici (faDuaxrpnt0tet ii3iyslaDua( o;u)aexrxo iodla  lneols  exrir no4lle mivsl(f rrm(m nu1tpt  oeiasfs eanmp t4artnxf3totlp  livi;()trxo(opno4omenmnviat) rtrumo;o1openif3iysls2rmumsn(4 exrxo ty1laDeln ol()s2um(mpou1lme  ictas arua(mp;u0tleomi3taslm2ran o (0tetoxf3ia1fp r i i s0 exm(r3oo1opeemnvil( sDtr(mp;o0tpx iiciad a2rmums;u0alxnmo3tydlmDrai ils)t2trio3no4omenmnetas) Dtm(m ou0olxn ociyslmDem(vpnu4 eermociatlp r i slt)srto(m3nu4am nlieilt  rurum ;o1apt miciat a2ua(vp u0tlenmr iytfpteln i t trtmio3nydolt  nctas srtr(mpno1ole  fctlsfa2rlnmp u4trenmrcoy1optrai ils)srtoxr3oudomtnlnvtatf rrauront1apxo i3tltfaDrl(vs;t4trenmr iadomD lnes s  rtoim3nydaleelfei (fs2trumonu1oet  ieiydfs rlumon() exrmo oy1fateluei;t0teumxr iodal  lfeia( a2uru p;u1aeen i3tas s2uaumsnt4aexomrcoatfmDeaneslt  2to(r nudamen nviasfsrtr( o;t4tlx  oeiad a2rmuvp t4 rxomf3to1fmDeluei;t) ruo(r3iu1am nliet tfarta(mpno4tpxn i3ilsfm2elnvp u4alxrxrcia1lpteai i s) rtmim io1optn fvi t)srum(mpot1olt  fciydls uauvsnu)aetnmocio1lptrlnvo;s)teur(o iodomtnlfes s) 2ua( pnu1aex  i3tydfs ua(mo;t4artnif3iydfatrlivs;s0 2urimpnodamt lneta()arra(m nt1oet if3tltlmDulnvsnt) exrif todlmDe iei;s0trtrxr3nu1lpe mfcs tfs2rmxro;u1tpt ifctatfm umnvo (4 etnmf ty1omDraivo ( trxrxo3oo1apeelict () rrr(ro;u0opto f3tyd sDrm( s;u0 ltoifcoa1fmteauvo;t sruoxr3oy4alenmivslt)s2ur(r ;t1tpxn feiydlm uauvo;u0 rerif3todlm  li o s) 2xrxo oo4opee fvs (fa2raumooo0oetniictlslm rl( o;t0artrxf3tydlaDelu ilt)t2ur(m oodllee ics ()sDrm(  ;o0olto i3ias s2uaumo t4 rxnmocto1lm eai olt  2urxopou1lleemfcil(fs2ua(moou0tpe mfeiytfm2el(ms;u4 eeomf tydlaDeln o;( seurxo oo4lp elnes s artr(m ;t0altn f3ildla2uanmont)altoxf tydlmDelnvo;s sexo(r3oydoltnlicsls)arua(  ;t0tex  ociad m2eanms ()tleomocoo1fpDrlu ols) euo(o iy1lltnlncia(fsDtaum oo4tet ifctatla2ulu s t4artnmf3iydoa  auvo t  2xrio io1alt lneia( artrxmpou4tpx ifetyt s eanvs;() ltomr3oytfa e nei;t0teuo(mpiy1ole mfvil(faDtmur oo4tlxnmfciydfaDran snu4tetnmr3iatfatrlnvi;t) eumxr iydome lnvilt)sDua(ro;o0oltoiociytlaDrmnvsnu)altnxr3io1fmt aiei t0t2trir3nu1ll n fvil(f 2umuroot1tlxoii3ild m2el(mpn(4aleriocoy1om elu sl( s2uoxm oy1olee nct s a2uaumo;t1ale if3iadfs2em( o;(4aleoio ootfpDelueilt0 exrxrpiodaptn fctatfsrtmxrp;t1altomocildfa ea( s;u4aexomf3iotop eauei;(0sexo(r3io4al  lnet ( srrax  ;o4oltoii3iltla2ran ont)trtoxoctotopDrlu s;()t2tm(rpnu4oltnlictl() Drr(ront1oet micilslaDelu o;t0 renxr3oa1omt auvs;t0texmxm iy1ope mict t s2ta(r ;u0opxnmieiltlm2ulumo;(0tlenxfcia1omtr uvsl(0t2xoxm iu4llee fet t s2uru ont0tptomieilt s2rlumo (0 rtnif tytlat aieol(  eumir iu4lmeelivilt a2rm(rpnt1aeeo ieiyd a umu s;(0aetoio oo1lp  aivs;( t2umimpoo1amtnlnvs t)srrau o;o1tpx miciltla2elnmp (4alxnxr3ia1optran s;t0srtmxo oudllen ict s)s2tax  ot0tetomociad s2ra(vp;t0 eeoxf3iy1omDr nvi s)s2ur(m iy4altn nvtas a2tmumo;t4openmi3iadfa rm( p;(0tlxnio oytoaD ai o ()sexoio3io1amtemncs ()s2uru pou1oetnmf3iyt a umn p;(4 rtnmr ia1fmteaieo ()t2toxm3nudapee nviat)s2rmxr oo4aexoio3tltlmDeauvpnu4tleniocio1lpD auvo s0 eum(m oodlltnlnvils s2rrxmp;u4tpxomo3iysfa eanvs (0 eerxr iy1fa  luvs;s0tetmxopny1ameemnvtls)arum(ronu4altniocilslaDrmuvs (4alxnxfcoydfm r i olt) 2xmxopio1ope  fes tf 2rrxrooo4tex iieiatlaDrlnvs;(4trtrxf3tydlm  lu o;t)t2to(r3iydllte nvilt) 2rrum ;u0oet moetlsla rln o;u)alxrir3iadoatrai s;() 2urxm oo4apt  fctltfsrtr(rpou4tee ifcilslsDuaumo t0arxrxfcio1faDeaies s setmxr3nodame mfvia(faDrr(  ;u0aptomfcilsla2uanmp t4trxomr oy1lmD lnvs;( tetoxm3oudll elieslt)aDuaxmo;t0olt ii3ilt a2rlumo;(0 etrmo iytfatr uei;s)srxo(o3oo1optnmneiat)arrru ono4oexn feildfs emu p;(4 reomo oadlpDe n o;t)sexoxr oydomt  fctas aDraurp;u0ale ioctytfaDeanmsn(4 ltnxo todlpt auvs (  rumir3iy4op  lnvt sfsDtmxm no1oeto f3iadfm ua(msnu0tlxrxo3iodfatrlivs;()teurir3io4lp  mivsls)aDtrurp;o0aexn ieiytlaDelnvs;()tleoxoctytlpt ai s;t texo(o3no4al   nct tf Duaum oo1oex  fetadlmDrmumsnu) lenxf3oodlateluvo () rtoir nydoptelics t)arumu oou4oetoiietad s ea(monu4tltoio3iy1oaDrauvi;( trur(rpiy1am nmnes tf rtmxr ;o4aexnmi3ildls2emnmpnt0aleoxo3ootfpD lies t)srxrxrpio1olen iet s)a2tmx onu1tlen ieild sDrm(vs t) rtoxr3tytopDrluei s)t2xoio3oudom  mnesa(f Dtrumoot4opeomicilsfaDumu s;t)tltomf3io1oateaues ()teum(opnudolt mfcs s s2tmx  ot0openmo3tldfmDrlnvpnt0aleoio3oy1lp e neo s)seuoxm nudap emnvi t aDtm(mont1optn fctyt mDean pnu) eeomr3iodlp rlueo t)t2trxr nu4omtnlnetl(f rumum ;t1tlxn octadfaDemumonu) lxoxf3tytfm  aieils0trtrxmpio1op  mfet (  2uau  no1tleniiciyslaDrln pnt0 rxrmo3tatlatrai slt0srumxmpny4ol nmnei t) rrr(  no0tlt iieiat m uluvpn(0tlxomf3to1oaD  nvi;t trtoxo3nodlpt lfctlt  rrmu  ou0olxo octlsls ulu o u4arxrxo3ootlmtr uvs t  eumirpoy1lme mieia(f rumxrp;o1oeeomoetat s2em( pnt4alxomo3tadla elneil(  exrxrpiy4aptemfet () rraum nt4tet mieiytla eluvpnu4 eerircty1omtrlivs;( setrim3iu4lm  mnviasfs2um(  ou4opt mi3iltls2rl(vo u) ltrmo tadopt an s;t  ruoxr iy4amt liviat)arumum ou0oet  o3tytfs ea(vp;(0 lxoxo ta1lm  auvi;t  rtmim nydll  mfvilt)aDraur oo1oeenmoetyd m2em( snt)artnio3iotomDeli o;t0texo(o io1am n ieiltfs2uau onu0optniieiyt mDrmnvpnt) rerio3oodom eau olt)trum(r io1op e icsat srraxmpot0oltoii3ildla2rl( p;u0aexrmo3oadopt aieslt) 2to(rpny4lpenlnvslt)sDrr(  ou1aex moeiyd m2rm(vpnt4 leomociadop elneols) eurxo3ou1lptelnci t)srum(ronu4aeenmf3iltfaDeanmp;t4artoxoctatopDraneol(0s2tr(m no4altnlfct s)sDrrxm ;t1oetniiciadfs eanvp (0trxrmo iotfat aieilt)trto(o no4lpeemicsa()s2tr(mpou1apx  ictyd aDeln snt)tltnxo to1op rluei;s trtr(o nodolt  ietat)aDrrx  ;o4optniiciatla elump t4 exoio iadfpte uvo s0texrim3nudam nmfet s srurxm ou1tee  ietltlm um(vo;()aeerxocoodlm raies;()srtoxr3ou1amenmfcsa( s2rr(m nt0oltoif3iydfm2emuvpn()alxomr iotoateaieil(0 rurxo iy1oltnmncilt  Dra(mpoo0tlxoiietad mDra(mp ()aeeomrciadlm r ivi ( t2urxr3oo1lpte nctlt)aruaur ;o1oeen ociltla2emnmpn()aetnmfctodla   uvo;s) rum(m3oudop emfvi (fsDrmxmp;t1opeoiociadfsDeauvp;u)areoif3iy1fp  anvsl( t2urim iydalee ictltfaDumxrp;u4apt mf3tlsls2uluvont)arxrif io1fat  u s t)s2xo(m3iodomteliet s) 2trur ot1oee moctas m ulumsn(0alerxo3oytfpDe ivi;t) 2to(m oo4lle licsl( aruaum ;t0tetnioetyd sDrl(vo ()texnmo tadoa  ln s t)teuoxrpiodopeemfviasf 2rax o;t4tetnmf3iydla rl(mo;t4aexomo3oatopDe ueolt0 rxoxr oodlleemnes ( a2raurpnt0apxo oeiydla2rln p u)aeenxfciodlmteai o t)t2xrio iodop eliciasfa2rrx  ;u0alxomf3iatlm rmuvp (4trermrciotlpteluesl(  euoxopiu4ol  mfvil(f 2ur(rpno0alx ii3iys m eanvsnt4teenmoctotom rauvsls texmirpio4apte ivs s)artr( pnt4tetnmoeiasfs rmn o;(4tlenifciodfaD aiei t0setoxrpiu4ame lneilsf 2tm(mo;t4oltn fciysfs ulu o;(4texoifciatlpt lues t sruo(m3oudale  fcia( s2tau  ;o4olen ieiytfa2ra(mo u4tleoxfciodlmtelu s;t)srxo(mpnudomt  ivt sfa2rm(mono1tlt ifciytls rlump;t0 etrio3iydfatrai s t0sruoim nu4al n ietl() Dtmu ono1aptoiictldfa2em(msnu)trerif3iadlmtrlues t)srtr(o3iu4op nlies t aDtax  oo0opx  ieias a ul(mp;t4trtnxo3oatfmD ln s;(0trtrxo iy4ape  nei () 2rr(m nu1oeeniietldlsDemn onu4tetrxr ta1fpt  n i;s)tetrim3io1alt miet ( srta(mpoo4teeomf3iadlsDrlu o t) rtrmr3tytlmtr ivils  exr(r3nodlle lncta( arrmxr ;t1opxo fciltlaDrauvonu0 lermr3ty1lpDrli olt trum(mpiu1amte nesl() 2rr(r ou4texo i3tldfa rauvs ()aetnifcty1lmtrlivs;t)trto(mpoy4omeelnctls arua(mpnt0oeto iciydfmDrm(vpnt4trtrmo ootopDr ues;s0 2trxr oydol nmiciasfsrrmxronu0opeoio3tat m ul( o t4trxomo3oadfm   neols0trxoxm3oydlm nmneils)aDuru pnt0ole mf3iltfs2ea(vo t) etrifctotlpDr ues ()s2tmio3iu1oleemnvtas  rumu poo1tetnmfetydlm elnvpnt)altnif oytla rlneo ( setrxrpiydllee fetat arrmxmonu4optoiociadfs2elnmont4aexomfciotlmtrlu ils t2xr(r io4al  lfciasfa2ra(rpno1apenmiciasfa em( s (0 lenio oodoat lnesl() 2uoiopoy1opeemfviat a2uaxmono0opx  fctls a umn pn(4tetoir3iytfmtrlnes ()t2uriopio4lmen icias)a2rru o;t0oee mo3iad a2uluvsn(0trenmf3oo1faDe ivi ()srur(r3iy4altnlnei t  2trxm nu0ole iieildls2ul(mp t0 etnmo oydfa  aieo ()s2tmxr3oydalenlfct sfsrrm(r ou1optoioeiydls raumo;t0texniocio1omD  ivols)t2xoirpny1lm n fci tfaDrmu o;o4ape  octas mDraump;u0aexoifcoydfp raieol( s2xoxmpiy1ap  lict t a2umxr nu0tpt ii3ilt sDuauvo;u)aexomrcoy1omtraivil(  2tmxo oo4ol  livs tf 2ta(rpno1tlen ociltlaDrlumsn()aeenircoatlmDr ies s s2xmxm3iu4ame  nvil() Dtm( ono0aex  oetlsfs em( onu4aexoio tydlpte i ols texriopnu1opt lfct (f Drm(m ;t4tet  i3tad a2ra( pnt0artrmf tatomDrau s;(0trxmio iodamtn netlt)arrm(rono4tlxomfctasfsDrm(vonu0texoxf oytfp rlu s ()s2urxm3iy4open ics s)s2uau  oo0aptn ociysfsDulnms;t)aetrmo iy1fmtrau i;(0s2uoim nodap nmivi tfsDur( onu1aex iieiat m2umnmpnu) rxnxf3oydfptr i s t) 2urio3nydom e fcta() Dta(monu1tleo icils s emu p;(4trtrifcoytfp rlu o;t0sexmimpny4apenlnes sfa2rrumo;t4optoiocildls um(vs u) rxoif tatoptelueol(0t2tr(o nodolenlnvsltfsDua( o;t1opto feiyslm2emn s u0teeomo3iydfptelnei ( tetmim iu1aleelfvil(  2ur(rpnt1tet if3iltlaDrauvs t0 rxrmr3oy1laD  n s ( s2toxm3iydol  mnet sf Drrum ou1tltomi3ildfa elnms;u0 etrxfcoodlaDelues t0 2tmxo oodaptnlneiatf 2uaxm no1opxn ociatls2ea(msn(0alerif tydfaDrlnes;()s2xrim3no4llt  iesat s2rax oou0tlx  f3iaslm emums;(4arxrxr3ootoa rln i (0t2xrimpiudam nmict t srtm(rono0oeenioetld m ulnmp;u0 rxrmocta1lpD anes ( sexrir nudllte nvtlt)a2rmump;o4texnmoctyd a2uanmp;(4trtnio3totfaD  nei s)srumxm ou1lmeemnetas)srtaxr ;o1tltnio3tydls uanmp;t4trxnmfciatom eai il(0tetm(o ny1olte fct tfsrum(ro;o0teeomoeiaslaDrlnvsnu0artrmo3iadlpt  neols)t2trimpoo4lm n nvtl()a2urur ;t4tee mfetld aDeaumo (0 reoir ia1fptrauvi t texm(mpiy4llenmnctltfarra( poo1olxoii3tys m2emnvo u)artomoctadomtrlnvs;t0t2xriopnu1lp elnes s srum(rpou0tex  ieiys s2eauvs t)tetomr3oy1fm elnes;() rum(r iodllteliet sf Drmxm ot0teeo feiatfsDrl(mo;(4areomr3todoaDr u il()trtr(r io1ol nmfei ()sDtmxm no4open iciyt m ul(ms;t4 eenmfciydfat luvol() 2xrxrpio4alte fci (fa2rm(mpnu1aleo i3tlslmDrl( o () lxnmociadlpDrluvs s seumio iu1lme mivtlt s2rm( o;t1alxoioeilslaDrmuvsnu4trxnxr iatlatelues (  2urim3iudalt  ivta()aDtmu p;t4tetomfctydfm eau sn(0tetoxf3tydfa  aneols0texr(rpiy1omenmfvsas  2rauro;o1aeeniieiatfs umn s;t)tlermocoa1opt liei t0s2tm(opnodlpe liesltfsruaur nt0oex  oetltfsDran snt0areoxo todopD  nes s seto(r nu1om emncs s srtrum ou1aex moeiltla2ran s t4arxrif3oatom e ivs;() rtoxmpio4olt  fcsa(  rtaxr oo0oetnioetyd mDulu snu4tetrmf ia1op   nes t) 2uoxopnydlm  liei s  Drr(rpot4olenifciydfs uan p;t0 rxoirctadla eauvsl(  2trio no1lp  lnciat sDua(rpno1oeeomfctysfs2ran s t0 rtnmr tatfatranvo;s t2xoxrpiu4al e neta( aruaxmono0alto ociytfaDelumonu0trtomf tatomD lieo;s0 2tmxo no4openmietlt  Drrxront0optomoetld s umnvonu)aeenir3tadlmDeau s t0 rumxr3iudape mncsat) rtrx  oo1tpeoif3tyslsDemnvo t)aexoxo tydopDr ivi s)s2toir iu4ame miciatfarrrxrono1olto ieilsfm uanmsn(0tlerxf oy1fpDe i ils0 ruoxm3nodolte nctlsf 2trxrpou4tpx  fciysls2eln pnu) rxomfcoo1fmt  n ols)setrxrpnydopt  ieilsf rtaur ot0oleo feiat m emump t4texniocoy1fp  aiei;()t2xoxr3no1lptn net t srta(mpou1aet  o3tld m2ulnvp ()trxniociadlpD lu ils0trtoim3oudlptemfvtat)s2uaumoot4tpx  fciydlmDuanmsnu4 etnmocoatlaDrlnvil(0 2uoxm nydap  lnvil(  Drmxrpot1alxniiciatfs ulnms (4alxnmr3to1optr uvo s srurxmpnu1om nmnvs () Dtrur no0opx  i3ilsfs2ra(monu0trxomr tatlm  ln ils s2xrxr no4ol n ies t a2tmu ooo4opxoiictytfs rln p u4trtomo3oy1fate nvo;s) rtmxo io1opee nvias  2uru o;u4tpe ifeils a ul(vp;t)aeerir3tytlp e nvs s  eur(r3ny4apte ncsa()aDtmx p;t0tlen o3iltlsDrln p u)trenxociotoaD  ivs;t)t2uoirpiu1apt mnvsas) Dtm(rooo1tpenmfeiltla2ranms;t4treoir oydlm  ln olt0srtm(r3oo4apenlivi t srtrx poo1tptn o3ilt m emnmp u0tltomf tytlpD  uvs;t) etoxo nodom   ietasf 2rmxr no0tpto f3iytfmDrmu p;() etrmr3ootlp rli ilt) rtrim oo1amtemies tfa2rmxm ;t1aee ioeiadlm emn on()tlxoxf3todop  auei s t2xr(rpoydlpen ici t sDumurooo0oetomoeiadfs2rmnmp;u)teenmf iodlptrauvsls texmirpoy1olenlfes s) rra( ont4teto oetltfm2rmuvpnu0tlenmf3iydlateaivil()trur(o iodll e ietltfsrrm(  no0olxnmieild s uau onu0 eerxr3ta1omDean o s  2tmio iy4amt mfcsas  rua(m ot1aeto ociytlm2emums;u4tltnxr to1fpDrlivsls)srto(rpiu1ll nmfetlt)a2rmu pnt0aex ii3tyd mDel(mp u4tlxnxrciydomD  n o;s) rxmiopoo4llenlfvt t sDrr( p;u0alxomociydlm uln s;u4tltrircoatopD lnvsl(  rxm(o oo4aleelnet (faDumu pnt4opto icias s ua(msnu4artrxf tydfm  an s;() eto(m3no4al emfvs s)a2ur(mono1olx  octydfm uaumonu0 rxoif3tadoa  auvo t setrirpnu1ol  lnesa(farrmx p;u1alx  oetlsfa um(vo t4tlxnxfcootfaD li o s  rtmir3nydam e fvt ()sDuaxronu0tpx mociat a2umu onu) rxrif3iatfmt au slt)t2xrim nodomenlicias) rtaxront0oexo f3ildfsDul(vs u0tlxrioctytfate i olt seurxr3nodlm nmfesl( artaxmo;t4olenio3iyt aDean p ()arxrmf3iydoa eau o;t0sexmim3ou4opt lfvsatfa2rmu  ;o0tetomo3iat a umuvs u4 rxnmoctodoptrau slt trxo(m3ny1op  mnet ( sDtr(mpnt1tpeoiiciytlsDulnmonu4 rerio iodlpD livs t0teumxm3nu4amte fet ()sDtrx oou1apeo iciyd sDrlumon()texnirciytopDrlies;s  exm(m nydamenlivslsfsDum(mono0oeeo ociatlaDrl(msnt0 lxrmo3oatoa rlu il() rxm(o3no4altemfvt t  Dta(mono0aeeniietysfm el(vo;t4 rxomrctydfaD lieslt)s2xm(o oo4altemfvia()sDumxr ou1tlenmi3iyd aDua(vo t0tltoio3tadlmDrlneol( t2tmio3ou4ol nlnes (  rraxmp;t1oltomfeiydfs uauvp () etrio io1om  ai il(0trxo(opoo4llt lnci sf rta(rono0oexo i3tasfm2ulnvp (0alxrmf3iydlmDraieo;(0 2tr(opoo1opt micia(f Dtax ono4aleoioetyslm ra(msn(0teenif oodoat auei;s)trtr(m3io4ll nmnvtat sDumu  ;u4altomoeildfa2rl(mp;u4teeomocoo1opDrlneol(0 exmim iu1aptelfetl(  Durxr ;t1tlt  f3tld m um(ms t) rxoxr iodomt auei t)t2urir nu1lm emnvs t  rua(mpot1ole mf3iad s ran p (4texnmociydlp rluvol()teuriopnudaleemfvs s)sDum(mpnt4aee  ieiltfmDrm(msnu4 etoiocto1oaDe uvi ()t2umxrpiy4lmen fviat  2ua( o;t1teeoif3iadlm ulnvo t4arxnxo oodlm e ueil() 2xoio3nydlp   nctlt)sDrr(  ;u1tltnioctatlmDelu p t0aeeomrcio1lp r uvo t)srxmxopnu4apen fcia()a2urxroot1aexnmi3ild m uanvo t0aeenmf todoatelivo s0s2xo(o ny4amenlfes tfaDumu o;o1tpxniociadlm2emnvs u0tetnxf totfm e ieslt0tetmirpio4ole  ics ( sDua( ooo1alt  ictydlmDrln pnt0artnmf3oy1faDrluesl(0truoimpoodlme mfvtlt)sruaxmp;u4oex mieiad s em(mp;u4aeeoif3iytfpte u ils0s2xmxm3iy1ope mnvia( a2rruront1olenmo3ilt a umuvo;u)aeermo oatlat ln i;s0 rtr(rpno1ol  lnvsat) 2urxmoot0opxnmf3tatfs ean p;(4aeeniocoadlmte ivolt0s2xmio3iy4alee fvi ( a2rax pnu0tptoioeiasfm2rlnvo (4 eenircootlm elu i t) rxrxr3nudapenmiesasf rtr( oou0tle  feiasfa2ulu p;t4arerif oadla rlu s t0t2tmiopiy1am n ivils) Dtr(root1alt iociasfa um(mo (4alxoir3oa1fa e ivs t srxmxrpiu1olenmivtasf Dur( p;o1altomocildlsDrmnvonu0texomf iytlp   uvsl() 2tm(mpnodol n nci s)srra( ont1tpt iiciatfsDemnmp;t0aleoxo3iodlptr ues;() 2tmio3no1lp nmiviatfsrur(r ;o1tpt iicias s eanvp t)tlermr tydlm eau i;(0seuoio3iu4lltnlncsl(fs2uaur no4ope iociytfm uanvp t4tlenmr3tytoa rlu sls)srurirpiy4opteliviltf rur(mo;t1tpe  i3iatlm2elnms (0 lxrmfctotlpDrauei s0setmim3no4llee nvtls)arrmumpot4ole io3tlt mDea( o;t)trtrif oytfateln i t) etmirpou4lmenlies () rurumpnu0teeniicilt sDul(vsn(4tlxnirctytfmt  neol()s2tm(r nodol elfeils aDtmu pou1opx ii3tlsfs elnvo (4trerio3iytoaD  nes;s) etoio no4ol  lnei (f Drr(  ;u4altniocilt m umnmpn() lxomr ootoptrai i (0srxoxo no1omt  fctlt)artaxr ;t4tlxomf3iysfmDulumo t0alerio ty1opD  neil() etm(rpoodam emivtls)s2trxront1tet  ictltfs2el(vsnu)tltnio3to1lmte nvilt)trxrim3nu1ome  nvsatf 2tax p;o1optomi3tyd m rmnvs t4arxrmo3tydoat lneo;( trurxm nudalee icsa()a2uru  ou4apx  i3iyd a2emuvs t0treomr3tadfp eauesls tetmio ou4om   ivia() 2urxm nu0alx moetasfs ul( p t4arerirctotfptrln ilt0t2uo(o3oydamtnlncsa(faDtrxr ;t4olen o3iyt s2elnvonu4tltoircoydfmDr i slt0sexrio nu4om e fvtls artr(  ;u1oee ifetlslsDumuvsnt)tltrmr3iodfaDeaieo t seur(r io4om elnvt t sDtrx  nt0apenii3iysfa2elnmo;()tlenir3oatomDr nvs t)tetrxm oy1optnmnvsas) Drr( o;t0tlxn oetat m2rm(vp () lxnif ty1fp r nvo;t0 rtmimpoudape  ncslt artmu  nu4tltn oetydlmDrau o u4trxoir3iotfmDrauvo s) rumim3oy4lmte icils  2ur( poo4oet mi3ilt a2rmu o;t0tltnir todom eaiesl()srtoxr oudoptemieiat srrr(ro;t4oeen iciat a em(vsn(0aetomf tydoa rli ils0s2xrxm3no4ape  nvilsfs2rrxro;t4texo ietadla ea(mp;t0arxoxf iydlmtr nvo (0texrxopiu4ol nlivt (farumur ot1tle moeiydla2ul(mp;u4texnmr3tatfptelnvol(0 rxmim3oydap  mfeias)s2raum ;u4tpt micilt a2el(ms;u4texnxr3oo1fptrai sls)t2tm(m oydoltnlfesatf Dumumoot0apxoio3iysfa2ulumo t4tetomrcia1lpDr nvo (  2umxrpoudlpeemfvtat a2raxmpnu4apx ioctltlm ra( p u)aetnmrciy1fm e uvil(0trurxo3nu4ole  nct sfsrtaurp;u1tetn ieiyt m2ranmo;t0 renxf3tydlaDraieo;s0srxoiopiu4lmeemivia()sruauro;o1opxoioeiytla2um( s (0 ltnxf tytomtr iei;t sexr(rpoudam n fvsltf Drau  ou4apenmoeild m2ulnmsnu)tltrmrcia1faD  u o;() exr(r iu1lpe livtlt  Drmur ot1apxn fctys mDeauvo;u) exoxf3todfaD  uvi t)trxr(m ny4lpeelfct t)aruau poo4texnmiciyt aDua(mp;u0trenmf oodomDrauvolt)trumxo3oodal elfeslt srrrxm ;o1oex iictas m2ra(vp;t)altrif oy1fpDe nvil( trto(o3nydlpenlnvt t) 2rm( pnu1olxniicilsfm2emnvp t)altnmo3oy1oa eluvs (0 rxrio3oy4ap  lnvt sfaDur(  ;o1tet ifcilslaDea( o t0arxnir oydlaDranvo;t) exo(opio1ap  mfvilsf Duaurp;t1oleomf3tat sDra(mp;t4 etrmfctadlm   nei;()srtmio3oydll  mfvs ()artm(rpnt0openiictydfsDem( o;u)tlxrif3to1op  aivil( setr(m3no4aleelnvta(fsrtru  nu1oetnifctls mDea( p;t)areomo ootfat  ieil( teuo(r3oy4lleemncil(f rtrurpoo1aetoifetld a uau s (4 eeoirciodlmDrlies;s)texr(o oydlm n fvias srra(rooo1tltoio3iltls2ul(vpnu)teeomr3oytlp raneo;t)s2uoimpnydome  ieias)srta(mpot0tpeomoetyt m eanvpn(4trtrxr tydoa e uvi;t) 2uoim3io1olen netlt) rraum nt4oex  fetyd s2uanmpnt0areoirctatla ranei;s0srurxo3nydlpenlnetlsfarra( pou4tltn ieiat a2ean o (4altoir iotla elu slt) rtrim3oy1altelncs t artr(m oo4aetnmf3iydfs rm(mp (4artrmf3oa1oa raiei;s)srurxmpnodolte ncslt)sDuax pot1tpxnmfciad m2umuvp t) ltomr3iatlmDrlieslt0sexo(r ny1lltelicsls sDurxrp;u4teen ictlt sDulnvo;u)arxomr3iytlmD  i o () etrxm iodolen icilsfaDurxmpou0oltomociad aDrauvp t4altrio oytlm elueol()s2umim oydal elnci t)a2rmump;o4opeoifciasfs um( onu)areoio oytlpDr ivs;()setmir iy1alt  ivilt  Duaumo;u4aeeoifetasfmDranmp;t)altoxo3ootfptr nesls0trtm(r no1lmte ictl(fsrur(rpou0aptnifciys s rluvo (4tlxnir iotla rau olt)sexr(opno4ameemietas) rumumpou1teenio3iys a2ul(ms;()tlxnmo3iotlateanei s0teum(opoy4ap nmfcsls s2tm(mpot4aleomfctld m2el(vs;u) rtoxo3totoptrlueo s t2uoxr iy1lp  lfvsls)aDraxmp;o4oeeoiiciyslm2eanvo;() exrmo totopDrai o;( t2um(opiodapt  neiasfaDta( ono1aexo feiatfa ul( o;() rxrxf tytfat  neolt0trurio3ou4lltemnciatfarumum ou4olt mfctytla emnmont0tetnxf3ta1opD  ues t0 exmxopoo1al n icta( aDur(ront4ale mfetltlmDumnvs (4aeermoctatomtrauvi;()t2xr(rpoudlm emnesa(farrr(m ;o1oexn ieiys m uauvo t4 exomr3oydoate ivs t0 2xmxopiodll emncsas)a2rm(m ;u4ope  iciydlm2em(vp;u4 renmo3iotlmDrauvils0texmxr oydlm  livs s srtaxrpnt1alenioeiytla2rauvs (4trtomf oy1fpDrauvslt  eumim3oy1lm n fvsltf Dua( pot0tleo oeildla eau p;()tlxrxo3oatfa eaiesls setmxr3iodap e net () 2uru  ou4oexoif3ilt a ea( s t0alxrmf ootoptr ivi;s0sruoxr3oudlp e nvt tfartrx  nu0oetoifctyslsDrlump u) etrmrcoodlaDrai sl( trurim3ou1omenlnvt (fsrur(  nt0ape iieild a rl(mpnu0aeeoif ootlp   u i;(0seurxmpiydam e neiat a2rax pnu4aex mfctasfa2eanvo;t)tlenxr3oadoatraivs () etm(m3io4lpte nci (farum(  ;t4olxnmi3tlt m2ua(vp t4treriociydopDelieil(0setrio3oo4ap   nviasfsDtm( pnt4olxnifctyt m2rlnvp;u4arxrio3ty1om eaieil(0 rtm(m3ny1open ivtls sDtrx  oo0apt mo3iydlsDua( s t)texnio3to1fatr uvsl(  2ur(rpny1lp  lfet ( aDrrxm nu4oexoif3iyt aDrlums;t)arxrif totlmt luvo;t0t2umim3ny1apee ncilt aDumxmoot0tlenifeiasls2uluvs t4alenxr3tatlpt lneo;t s2xo(r3nu4lpeemneiasf rum(mont4tle  fetltla ul( snu4tlenxf ootfmt aieo;s texrxm iodole micil( arrmx ooo0oex ifciydfa2umnvp;(4alxrmrctydla  luvil(0tetrio3oy4ll  mnvilt aDraxr oo1opxomfeiydlaDeanms t) rxoif to1la   u o (0 2tmim ny1alt  neslsf 2trxmpoo1alenifeiasfm ra(mo u)tlxnifcoatlm  an i t)t2uo(r iy1opeelfeia()a2urxm ou0aptomieiytfm rauvpnu0teerxo iadlmDean o;() 2urxmpiodlmenmnci sfa2urur ;o1teeomo3iltla2em( pnu)alxrmr ootopDelneolt0srurio3no4ameemfct s)aDtm(m nu4aet mocildfm rm(vp;(4 rxnio3tytfaDr ieol(0tetr(r3iy4lp   nvsa(fsDrru ooo4tpe mi3iatfs2eanvo () lenmo3tydfmDrli o;t0 rto(o iodamt mivt t a2uaxrpot4tee ii3tytfs uanvp (0aleoif tatfpt ln o;s trxo(m ny4lpt mies (fsrrru  ot1aet mieildlaDrln onu)aetoxf iydfmtrln slt  2xmxo ny1ll elnesls arrmxrooo1tpenifeiytfa2ra(ms;()trxrxociy1oateau sl(0trum(o3nu1lp nlncslt)artmxmono0tlx io3iadla2rm( sn(4arenir ootfp ranvi s srtrimpoodlmen ici sfsrur(ro;t4aleoifciys m rmnvo;() etrxf3ia1faD  n ols0seumim3io1ape mnvils  rurx p;t0tetn f3tltls ulnvs ()tltrif ty1lmD au s;s0 rxrim iy4lpe lfviltfa2um(rooo1oexoiiciad mDumn o () rxnxrctotlmtrau s (0 2to(m3oudlpen fci tf Dtmu  no0olxomi3iasfs ra(mo;t0trtrxf iadfp eanvo;s0 2trir3ny4am  mictl(f Dtrxmpnt0tet mictldla2rau pnt4artoir3oo1faDr uvs s)trxmio3nydomt  ivi (fsDta(m ou1tetomieiyd aDeau ont4tlxrio3iotlmDelu s t0seto(o3no1apt mfei t) 2rmur ;u4apt ifetydfa rm(mp;(0 ltoio oodlmtraivo;()texo(o oo1ol elfesat a2umum ;o0olenmf3iyslmDrmnvont4artnir iydoaDean sl() 2uo(mpiudlmt mfvt s) 2um(  nt0tlen o3ias a rlumpn() exrmr3iotla  li i t  rto(mpny4lmt mnvi ( srraxmp;o4aetomiciat aDumuvpn(4trenif3ty1optr ueo;t)s2xrxo ou1lpee icta(fsrum( o;u0opxnmoctyt mDrm( pnu) lxoxo3tadlaDeanvi;s0 rtrio io4om   nei ( aDrrxr ;u0optoioeiytls umuvsnt)arxrmo iydlpDeaivi;s) 2trxm3iy1amtemnesat s2uax  ;u4oetoif3iltla uln p;(4tleomo3oytop  aneo;s s2toxm3iu4omtelfctas)a2rmx  ot4tpeo f3iadfs2emn snt0 ltrio3ta1la  lieil( teur(r3oy1amt mncta( aDua(m ;u4tlx iiciysfaDuln o ()trerxrcoydopte neo;s s2uoxo3oy1lm e nvtas) 2taurpnu0tltomietysfa ea(mp (0 reomrcio1fpt an o s0s2tmxm iy4opt  fvtlt) Drax ooo4tpt io3iydlm rlump;u)aetnio ootfm   ies;s0 rxmiopou1ol e nviasfsrrrxront4opeomociyt mDrm( s;(4trtnxf iadop elues;t)seuoio no1lmenmivi ()srtm(r no1opto ictls aDrln p u0 eenxo3oo1oat  ueolt0 2trxo io4lm nlncta()srtm(rpnt1tex mo3iadfsDrm(ms;(0aetnmf tytlmD  n s t trtm(r iodop e nesltf 2trxmo;t4tlto iciysla rlnvon(0texnio tatlpD lnes;() 2trxopoy4op  lict t srta(  ou0teenmfetytfm2eau p;()arenmf oydfmt lieslt trtmio3oo1omeemfeiasfarumu  ou0apen f3tytfm ranvs t0aexrxfcty1omteliei;()teto(rpiy4lptnmfcta(fsrtmxrpnu1texomocilsfaDem(mo;u)arerxoctydfm e u sl( t2toxopio4am e nci s)srrrurpou4alenmi3iltls eln p;t4 eenxf oodop e ueo;s) rtoim3no1lm  liciat)s2ua( oou4tlx ioetld aDemn p () lxnmf3tytoaD  i s t) 2tr(r3oydlp elicias sDraxmoou4oeenifciytfmDemu p;(4aeeoxfctodfatrlnvo s  etoxmpny1lpt mnciasf 2taurpno0tpe  i3tadfm2eln s;t4tleoiocio1om  aneo;() eumirpny1lm  miet s sDtrum nt0oleomo3tlt sDel(vo;u)teenio totlmt  i ol(0 euoim3oudap elfctlt) rtmu oou4ape  o3iydlsDea(msnt4aexrio oa1lm rlu o (0t2uoio3nu1ol e fcs s aDururp;u4oexoiietlsfs2rlnvsnt4tetnxf3tytla rliei;s)trxm(o nu4om e ict (fs2urxm ;t0oetniieiysla uln on(0arxnifcoa1lpDeauei s) etrim oy4altnmicil( aDtru  ou4optnii3ild aDrmu s u)tetoir3io1opDranvi t) etm(o3ny4lmeelfetltf Dumxm ou0apxnioeiadla ea(mp (0alxrmo3ia1lp eau ols t2xo(m io1opt  ies sfs2uaxr oo0optnmieiad m um(vo u4tlenxf oytoatrli s t0 2xrirpou4olt lnvs t  2ta( pno4opeoif3tltlm2rm( s;u0 reoxo3tytopDr n s;t seumxm3oydlm elfeilsf 2rax o;t1ole if3iaslaDrlnvp t0trxrifctytomt lnvs;t0s2xo(mpno4ll n nvsls srurumpnu4aee ioeiytlm rlu p t4tlenmf3io1oatr neo t0seurirpio1amtelics t)aDrrurpot1apeoif3ildlaDelnms;t) ltrxocoadlp  aivs;()trum(m ou4oleemfvta()s2tmxrooo4apx  f3tas a rm(mpnu0areoxo tydfmt aieo;s s2to(o3ny4ap nmivtlt sDrrxrp;u4tex mieiytla rl(mo;t4alxrif3tytfpDean s;t)srxmio nu4lmtelncs ( aDtrxro;u1oee  oetatlsDem(vo;u4treomr3tydoate ueo s)s2trir3nodoltn nvsas)arumu oou4teen f3tldls umnvpnu4texoxfctatfmDr uvo (  2xrio no4omte iviat) 2tm(ro;o0opxniictlsfs2rm(vs u0 lerxf oa1lp   i il(0s2trimpnu4open fci t)s2rr( pnu1opxnifctytla ua(vo;t4texrmocia1fmDeluvsl()seuo(rpno4open nvs (fsrtau poo0tee  f3tydls elnvp u0trxnmo3iotfa eai o;()teuo(o io4lmenmncilt  2rmum ;t0tpt  o3iydlaDrlnvo;u0tetnxf ty1lmDr u ils)srxmxr ou4amtnmfcsa(fsrum(mpot0tlxn fctltfm emu snu)tlxnxr3totfpDe uvs t0trur(mpnodlltemnvslsfa2tmx oou4tee mi3tld aDua( snt0tlxoio3iodfp e ieo t0setoxopou4llen fcia() 2uau p;u4ale iiciysfa2ea(vo;u) rxomf totoptr ivil(0 2trio3oo4apeemfcs s) rumum ou1tpxnmfctls a2ean on()alenxfcoydop  anvo t)teurxrpoydame  neia(fs2uau p;t4tpt  oeiyt aDumnmp ()texoxf io1fa e u il( trumxm nodlptelnvi tfarra(mo;t1oeeniocild s ra( o t0aexrmo3ty1lm rlu o;s  2urio ou1amen fvs ()srrmxmont1oexn ietaslaDel(vp ()altrmo3iodoptr iei;s0trum(mpio4alenmnes ( sDrrxrono0aeen octasfm2rln s ()aetoif iotfa ranvsls0 etr(o3io1optnmncilt)srrax  ou4tee  iciasla ulumo u4aexoio oo1fmDrliei;s) eurxr3no4ol e nvi t  Durx oot4opx mf3iatfs2rm( p;(0aetrio oydopt aivi;t  2urxm ny4lle lfvtltfarur(m oo0ape ioeiysfa uln snu0trxnmf3ta1lpDelueo s)s2to(m io4ome  nvtas)srtmurpou4alxo oeiydfmDuau o;u) exrxrcoatlmtraueo;s0 eumxrpnydameelfcsa(f Durxrpnt1altnmicilslaDem(ms;()texoifciatfa eli ols) eur(m3iudol nlicslt) 2rrurpoo4tetomfeiyd aDel( o t4 rerxr3ta1fmDrluvilt0trxmir iudalt  fctlt)arua(  nt0oleo fciad mDumums t) rxnxfcoo1omteai s (0seumxo oo1olenlici t)s2um(rp;o0tlxnmiciytfaDum( p u4trenxf3oytlatr i i;s0s2um(r3iodol nlfcsat) ruru o;o0tex  i3iyslm2rln s ()tltnxf3oy1oat ln ols0tetrxm3nudlpenmneslsf 2urumoou4aetomi3iydfm2elums (0aexoxr totlm e nesl(0 2uoir3iydap   fciasfsrrau pot4oltomf3ildfs rl(mon(4trtrif3ty1lmD lnvo s  exo(opoodomtnlnvt sf 2rrxrono4oetn o3iltlm um( p (4 reomf iy1omD lueo s)s2uoxmpoydlme mietltf rtruro;o1olx mictyt s ulu o;(4 rtrio totfmtr ueo;(0 rxoir3nydlltn ivias sDuaxm ;u1tlt moetydfaDrmn s;(0aetnifcoytop elneils s2xmim nodoltelivsa(  rtm( poo0teeniietlt sDul(msnu4artnio3io1opte ivs t t2trio nodapt mfet sfsruau onu1texnmietadlmDranmo t)texnxf iodoaDelieo t) rum(m3ny4ope  ncsls)a2rm(  ot4optniieiydfs2ul( pn(0aetnxr tydfp r neols)sruoxr3oy4apenlfvt ()sDumx p;t0oexnmoeiltfs um(monu)trtrxo iatom r ivslt tetrxm iu4lpenliciasf Durx o;o1ope  feiltfm um(vp t)treomfciodfpt lu s;s seum(r3nudomtnmivsls)a2uaxr ;o4aptomi3iatfaDemuvs;t0 rxrioctotfm  ai sls0 euo(r3oo1om n fciat) 2rmxm ;o1aeeo f3tyt aDranmp;u0 lenxr3iatfpDeli s s  exmxo3ou1lptn fet (  2rmx o;u4aexnmietyd m2rlu p u)tlxnif3ta1fatrln ols) rtr(o3iu1op e fct s)a2rr(r ;u4tpe  fetatfmDumn pnu0artnifcoy1fatelu s;s trumim3nydlleelfvtltfs2rmx ono0optomiciytfm2uanvont)tlenxrciy1fatr uvs;t0teto(r io4opt  ics s sDumuroou4aptnmfcild a rmn s () eerxf3ootlate u o;s  2xrxr no4lm e iei (f 2tau  ot0opx  o3tysfsDrluvon(4altrmr iadoaDrlivo (  rxr(o3oudlleemnvia() 2rmx poo4oeen o3iyt s emu s;u0 rtrmr ty1omD livo;s)setmxm3nudlp elies sfarrmu oou0oltn ictytfaDrlump;t)aetoxrcto1lmtr n olt) 2trxm ou4olenliesltfsrua(roou4oltomfeildla2emnvs t0trxnir iodom e i o s0texrxo3iodom n ietat)arra(moot1ope  f3tydfaDel(mp ()artoxrcoydop r nei t)tetoiopio4om   nctasfa2umu onu0aeeo i3iytfm2el(vont0 etoxf3oo1fpDr i ols) ruoio oy1lltemncs t srumxmpou1olx iiciatlmDuan on(4 ltomr3tytlm elnvs;t)s2uoio io4lltnmnet s sDtm( p;t0oexnmfeilsfsDeln on(0trxnxocoy1lm  an ol() 2xrxo nodopen fei s  rua(rpot1alx iieiys m umu o;t4alxnio3oydfpDr uei t)trumxm3iy4lm nmnctasf Drrur no0oex  oeiasfa ranmsnu0aeenxr iotfa  li i;(0 eurim3no1lm e fcsls srtr(mono0texnioetadfs2rlnms;u4texrxf oy1omt lnvo s trtmxr ou4apeelnvtas aDtaurpnt0tee if3iytfs2el(ms (4tetrir3ty1opt  u o t)seurxmpoydamtnmivsat  2umurpou4apxn f3ias a2rm( p;(4artomr3oy1oatelu o t setmim iodaltemncilt srtau  no4tltnii3iltfaDrmnmp;(4texriocta1faDrai il( trum(o3iy4lpeemivs s aDraur ot1tle  o3ildfm rmnmp;u) eerirctatfpDeai o t) etrxr nudllee ivtl(  2rm(r nu4opxomociasls ea(ms (0 renmr3totoa elu olt)teuoxopoodal  mics tf rur(m nu4apto ieias sDrmnvp (0 rtoxf tatfmDelnvolt)trtoir3iy4oltnmnet tf Dtmxrpno1aetomi3iltla eluvs t)trtomo3ta1omDeliei s t2xm(m iy4ame mnvt t)s2tax ont4olxnmiciyd aDemumo;t) exrxr3iydopt livs;s t2xoxm oy4lmt miviat)sruaxro;u1tee  f3ilt m eau s (4arerxr to1fp  auvs t) eto(m3iy4aptn iei tfsDtrxmo;u0tetomieilt s2ranvonu4 lxrif3totfpDeliesl(0 rxoxm oy1om  livta(fs2trxmono0tlxnif3tysfaDea(vsnu0artoxfctodfp  aivi t  etoxmpiu1altn fetltf Draxmpou1tee mo3iys sDranmsnt4trtnmo3tatoaDe u ol()s2umio nu4llt  fcia( sDtaump;o1tlxoif3tltls2rmnvs u0alxomfciydfa  au s;t  2xrirpiu1am n ncilsfsDtaxmo;o1alx mfeildfmDum( o;(4 lenir tatfp elneo t0sexmio nu4lp nmnvils s2trumont0oet mocilsfs2uau o u4 eenxf ta1lp r n o t0 eto(rpoo1op e icsa(fa2rau o;t1tlt mfeilsfm2ea(mp;t)trenmr todfmDr neil(0trtrxopno4omtemnvilsfsrumu o;o4aet ifctadfmDea(mpn(0texnir3oodoptelnvolt  rxm(m3nudap  lfesas s2rmxmono4oex if3iadlmDea( p t)artnirctatfaD ln sls0 exrim iu1optemfvs ()sDtaxr nu0alxn ictls m ul(vo;(4trtnmfciodopD auvils)texo(m3nu4lle lnesas)a2tm(m ot4optn ieilt a2rln o;(0 reoxr3iadoat livs;t)setmxo io4ll  mfcsl() Drm(r ;t4tltniicild m2ranmon(4altnmrcto1laDeanes t)texoxo3ou4lltemicia(f 2urump;t0opxo feias aDrl(vsnu)texnxf3ty1lm   n o ( srxm(m nydol nlfvt s  2ta(mp;t4aexnmo3ilt m elu sn(4 ltrif oydomteaueilt0 rur(r3oy4ap nliet t sDtrx oou1tpxo o3tad a2uan o;() reomo3to1lm eauei (0 rumxr3nydal  lnvi t)s2tmu oou0tlxnmf3iytla2rmuvp;() exnxo oytfpDraneil(0setoxm iodol emfvs s) rtmumooo4tleomoeildfa2eanvsnt4arermo3tydfmDr iei s  etoxr iu4lptnlfvs ()sDtax  nu4altoii3iltlsDrl(mon()altoifcty1fmtr uvs;s)t2tmir3io4lptnlfctl(fa2rau o;u1tlxnifeiltlsDranmp;() lxnxf iytomDe n i;t) eurxr3iudoltnmfvsl(faDumxmpno1apeomictatfmDrm(ms;(0 rtrmfctydlmDeauei;s0trumir3oy4aleelfcta(fa2ur( pot0tlto feiydfaDrlu ont4teermfciodlaDr n olt0seumir iudolenmfvi t sruaxm no4opxoifcils sDuanmo t) lenmr tadlmtraueilt0t2ur(m3ny1am nlfct t)aDurumpoo0texoiociasfs uluvp;(4teerio to1fmD aieo (0trtoirpou1lpenmivtasfa2ra( o;t1aeenii3tat m2um( o u)tlxrir3iatomtr ieslt)trxrxmpoydlpee ieil( aruax pou1opt  iciydfa rm(vp u4 eenmr3oytom r ivo t) etm(opiy4ol e nctat)srua(m ;t4opxn o3iasfmDuanvo;u4tltomrctodlmDeli o;(  2to(rpiu1lp elnctls  2tm(m ;o1aee ifetlsls rau o;t)arxnmo3todlpD luvsl(  euoirpoy4oltnlivsas  Dtmx  oo0tetomoetasls2ra(msnt) eermfciodfat lueo;t0srtoirpiodal nlici t aDtruro;u1apt  oeiyd m2ul(vo;()teenmfcta1om e ivo;t t2tmxm3ou4ll nlfetl()aDurxmoot0teeoiieiyd m umn s;t4 exoiocto1lm e i i s t2urxrpoydop n ieta()s2tr(ro;o1oex mf3ias m um( on(4 etoiociy1fp eluvi ( setoim3ny4op nmfvsls  2rrx o;t4aexo oeiydfmDel(mo;t)aeenmf3tydlpD lnvo t0seuoxr oodol emics t) Dtrur no4apxnii3iytlmDelnvsnu) etomocoydfmDeai slt0s2xoimpiydomt lnetatfsDraxm no0opeomo3ildlaDuau o u) exnxr3iy1faD  n o t0 ruoim iy1alee fvsa(  Drmuro;o4tpt  oetasls el(msn(0 ltnmociodoptr n ils)trxmiopnu4am n icsatfarraxmoou1optnio3ilslm2rl(vpn(4tltrirctatom r ueils) exoio iudom nmfeslsf 2tmxmp;o1ale iiciyt sDrmump u0arxrif3ta1faDe u ol()trtoir3iodope  neslsf rrmur no0olen f3iysfs2ulnvont) lenio3iatopD aivils0srto(rpiy4llen ici tfsDrrur ;u0aee ii3tldlsDeln p;(4aetomo tydfpDelneolt0 etm(m ny4amtemnei ( sDtm(m oo0tetn fetls m2uln s u4tetnxrctotfp rlnvi;s0srtmiopny4ape  netlsfsDum( ooo4tpt  i3ildlaDemumpnt)aetoiocoatoa  lnvslt)teto(m iu4lpt  ics s a2ra( o;t1aexoii3iltlm ea( on()tetrmr oadfpDe uvo ( s2xmiopoydap   nvsat)s2ur(r ;t0olto i3tldfmDrl(ms (4 exnmo iodlmte nei t tetrim ou1ol n ivslt  rrmxrp;o0opx io3ildfaDumu snt4tetomfctydlmD aues s)t2uoirpoo1oleemfviat  Dt
\ No newline at end of file
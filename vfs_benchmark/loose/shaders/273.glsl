@@ -0,0 +1 @@
+nvilt) euoiopiodamt  ncsa( aDtm( oou0tetoifeiasla eluvsn(0trxnir3oa1fpt ai i s)t2xm(o3iu1openlnvsat  Dum( ono1tlenmoetlsla uln s;t)trxomfcty1omtrli i s0s2urim3nydapenmnetlt arraurpoo0opx  ieiysfmDea(mp t4alxnif oodfa rlivo;s0t2to(opnodom nmicil(fsDuru ooo0opxoioeilsls2um( pnt0tetnxo oydlmteli sl()trxmxo ny4lp nmnvtltfa2tmu  ;u4apen oetysfs2ranvo (4 eenio ty1opD aneo s)texo(o3iodamenlneiatfsruauronu1oex  i3tldfmDul( sn(4aleriocoytopteaivs () exmxrpoudlmee netatfs2rrump;o4ole mi3iatls rmnvs;u) reriociotfaD  nvils seto(m3iy1lmt lieil(  rua(rpot0tptoioeildla eau snt4 etoif3io1fpt au s;()teuoim3no1llt lfeiatfartrumont1teeo o3iad sDea(vsn(4 ltnif3tytfmD auvo t t2xoxm iodll   iesl()aDtmurpno4oexn fctlt s ean o t) ltnmfctatfa rauei t0srtr(mpiy4ale  feilt)s2rmu  no1tex iictys s rln s;() rermr3oy1fp  lnei s)t2tmiopnu1lltelnei ()sDtr(r oo4tpen f3iytfaDeau o t)alerxrctatlmDr ivslt) 2um(m no4ap   nvslt)s2ur(mpoo0tpe ii3iydlm2ea(ms u)tltrmrciytop elueo t)t2trxmpnydopt lfeilt)srurum nt4olxniietas s el(mon(4tetnmfcoytlm  lu s;s  rum(opnudame lieta(fsDrauront4tlxn iciltlm ulnms;u4 ltoioctadlatrlivols0 rto(mpno4lmee netas arumum nt1tpeoiietldls umnmsnt4 ltnmf3oo1fa rlu ols0 etoxr nu1oltnmfvta( artm(m nu1tee iietld s elu p u)alxrxr iadop  aivo;t s2tm(o3nu4al nmnvs s aDuau  ot4opxo octat a2ean o t) lenxf tydom  ai ols0 2xmxopou1alenlfcsa( srurxrono4tlx mo3tadfsDua(mo;(0arxrmr3ootop e uvo (  2xr(r nodame  ietas  rtax o;o4olx ii3tld s2rmumsnt4trenmoctotfate uvo;t  rtmxr3nodamtelnctlt  rrm(monu4oexo f3iad mDemnmpn(4artomfcoytlaDr ivs;(0seuo(mpiy1lleelivtls arta(  nu0alxniieiasfa elnvs;t4trtrmo3oa1oate ueolt0truo(o no4lpeelneil(  2ua( p;u1aleomf3tytlm2rm(vsnt)tlxomo iodfaDranvolt)seuoim io1alt  iciatf rurxm ;u0opx if3iyt m eau o t0 renmr3ia1lpD aneslt) eurxm nu4al emneiasfsrrau p;t4olt mo3tls m2raump;u0treoioctydfa rlivs t trtm(mpoudap e fcsls a2uaum nt4apxomo3iydfs rmnvpn(0artrmo3tytoa r nvo;t0tetm(r nodamtelicil( sDrr(mooo0ope  fciyd m rl( sn(0 lxoif ia1optelnvo s0srtrirpnodamt  icia( s2ur( pou1oex iieiysls ra(mo;t)aeenmo io1fat  ueo t setoxo iy4optnlicta(fa2tmu  no1apt mfciaslm rmnmsn(0 exnmf3oydlateln ols trto(o3no1lme  nvi () 2tmxr ou4tltniociaslm2rln s;t0aexoxf todfpDrli o;t  exr(rpoy4op  mncsasfa2umx pnt4oeto i3ilsfmDul(ms;u0trxnxfciodlptean ils) rxo(rpny1lpte icslt)sDururo;t4aptomi3tldfa2el(vo u4teermf3iydfa eaneolt) rxoiopoy1lptn fctlt)artm( oot1tetn feilt m2emuvon()arermrcto1faDrlueo;t)teur(rpoy4op elicsasf rrax p;t0apeomieilsfsDran snt0arxrmfcto1lateau s s0texoxo no4alenmfvi s)s2tmu  no4texo fciys m2umnms ()arenmr3oodlat anes s0 rxo(rpnu1optelics ( srraur ot0ole moetldls2rluvs;(4 etoxr iatfpteau s t0setrimpiydlmenmivi t)arua( onu0tpeo i3iltfm ulu p;u)alxomr3oadlpteau s;t t2xrim3nydam elfctas arua(mpnu1teeomoetyt s2ua(mo (4aleomocoadlp e i s s0trtrxopnydam n fvtat)sDrmxmpnu4opeomfcilt m rl(ms u)tetrxf tatfmteliei;()srurxo3nydoltemieias aDrr(r oo0altnii3tatla2ranvont0aetrifcta1opte n s s) rtoiopoodlmenmnvt tfsDurxrooo0tlx iiciaslsDumnms;(4aeerio3oo1fptelneo;s s2trxmpoo1alt  ici sf Dtmuronu1tlx  i3ildls2um( o (4tleomf3iy1fmteli s s) exr(opou4al nlfesas)arrr( pou4tpxomoeiasls rmu pnu0arxomocoadoaDeln slt0trtrio3oo4op nlivil(  Dum(rp;u4tleoio3tadfmDul(mp t)altrmr3tydomt anvols0s2toxr3io1ap nmieia() rurumooo1tee  i3tadfaDranvsnt4 rxnmf3oydoa e nvs;s  rur(m iudapeelfcilsfarrrumoot1tltniociat s rlumon(4alxnxr3tytfmDeliesl()texoimpiydam   ivsls s2urxm ou4tleo i3iyd m ul(mp (0 etomf3todomte iei;t0s2xoxopoydop e fvil() Dta(  no0tlenmi3iydfs ranvs t4aeenircto1opt aieils)trxmim nydllt mivsl()s2rrxm oo0olto o3ilsfm2rmn o;t0tlxomo iodlat  uvslt setoio3oudap n fctatfaDum( oou1optoif3iyd s eau o t0alxnioctodfatr ivo () rxo(o3no1olte fcslsf 2trxroou4ape iocilsfa2um(msnt0 etomr3tadlatelnvo;()texo(r3no1oleelivta(faDuax o;o1apt  i3iytlaDumums;(0 exnmr3todlpDe ues;t0tetrim3ny4op n ietlsf Draxroou4alenmi3ilsla2rmn p t4alxnxf iydlaD  ivs;s s2xrir3nudlle  ivi sfsDtaxrpoo0oleo fetadlaDrmumon(4trxnxf iodfp  lu o;t)t2xm(o oudale  fct (f rta( oot4ope mi3ild mDumnmont0teenxo oydfa  ai o (0texr(o iu1amt mnciat) 2ra( p;o0altnii3tys s2um(vo;(0arxrio iytfaDe ies ()t2uo(mpio4opt  nesltfarrmum ;o4aex  ictyt s uln p;t0tetnmfciatfmteaivs;s0 rumxo nydal   neias)a2ur(r nt4alxoiocilsfa2raump u)texnirciytlmDr i i;( s2trirpno1omeemivil( aDrmxronu1ape mietatfa umu o;u0tlxnxf iadlp   nvo;s  rtoxr3iodll n nvsa(farrrxr nt1texoiieilslm ran s t4aleoxr3oadom rlivols0 2xmxm3iydlmt mnvslsf 2tmu  ot1tpt mfctls m ean o ()tetoxfctotfaDeluvo;t0tetr(o3iy1op emietas  2umumo;o4oeeomfetyd aDeanmp;u4 eenio tatfa raueo;t0texm(m nudome mivsas aDrmurpot1tle mi3tldla2ua( s;(4texoxf iy1lpD lu sls0 rtoxrpnu1omtnmivs ()sDrmx p;o0altn iciatlsDrmu s t)aetoif3ia1fa e nvi s0s2xrxmpoo1openmnvi s  2uaur ;u0opt if3iltls elnvp t4 eenxf3ta1fmt livslt0teur(opiydlm e ncils)arrmuro;u0oeeo fciadfm2ran o u) rtnmr ty1lmtr neo;s) ruoxo3ou4lmenmnci ()sDrr(r oo1tlto f3ilslmDulnmp t0artomr oatla rai s;s  rxmirpny4amtnmfci (faDtr(rpnu4opt  f3tytfmDel(ms (4 etoxfctotlaDeln i ( s2toxr oy4oleelicsls arrmx onu4aeto fetydfm2ea(vp;()arerif ootlm rau sl()s2xrxr ny4lpe miei t)aDur(m ot4tpxnmocilsfs el( sn(4alenifcoadlmDeanvs s0 2xmim oy1lm  mnvi s) 2ur(  oo0tpto iciltlmDrlumo (0teerif iy1fpt anei;() 2um(r3ny1oleelivs (fa2um(  ;u1altn fciltlmDua(mo (4 rtrir ootlp rau i;s  2toir iu4al   ncsatfsrtrurpnu4apxo ocildfm2uan sn() etoxocta1oa eaues;(0trumirpou1lmenlnvia()s2tmxm ou0apx ifctlt mDem(vpnt) etrif3tydlptrln ol(0t2tmimpiu4om   net t sDuax o;t4texn f3ilslsDrlnvs u)aetnioctydfmt ln s;t  rtoxo iudlpee fcil(fsDta( pnu1oex mocils m rlu s u0aeeoif3tatomDeai i ()t2tm(r iy1op elfvs t artmxmonu0aptnmiciytlm umn ont0aeermo3ia1fat  ieo;s trxr(rpnu1lm emfci s) 2rru  oo1tpe mf3tytfa rl(ms (0aetrmr3oatomt  uvi;(0s2xr(o iu1ole mnvi t srtr(  ;t0aeenioeiltls2uaumo;()aetnmr3iatop eluei s texo(m iodomenmfcta(fsrrax oot4aleo o3ias mDrm(vpnt0arxrxocia1lmtrlieo (0srtmxr iy4opeelnviat  Draxmp;o1apxn oeiasfsDum(msnu0trtrio3oydlat  ivs;s0seur(m3oy4omtelfcil(fartm(m nt4oexn ieiatla ra(vs;()aeeomrciadlpD anvs;( truoxr io4oltnmnvil( arrr(m ;u4oexo f3iatlaDeanms;t)alxrio tatlm rlneo;t0texm(o ny4lltemnet t  Duau p;o0opxnif3tltlmDrlnvs;(0areoir3todlat  iesl(  etoxo oo1oltemfci s)a2um(monu1apxomf3ild a el(vo;(0trtrmo3oytla rlu o ()t2ur(r no1lp   fesls  Dtaumo;o4optoifciaslm ra( sn()altoio totlp r nvo s0s2xrir3ny1optemfesl(fs2taxmp;u4tlt  ieiys sDra( s (0teenircoytfmtrlu s;s sexmxr3no1llenlivsl(  Dtrumpoo0oetn ocilslaDul(mpn()altoxf ia1lmDrauvil()srumim iu4op nlnvil(f 2ra(r ou4tpt ifctys m umums u0aexnxr ta1fmDelneols)srtrxopoo1lmenlnctlsfa2tmur ;t1tex  fciytla2uaumsn(4tlxnmf iotoatean s s t2uo(o3nu1omeemfvia( sDum(rp;o1altnifciadls umums (0artnmo ty1lmte ueols) rxrxm3oy4ll nmncsat) Drm(m no0ope iietyd s ea( o u)teeomo tytopteli ol(0sexo(o3nu4alenmietas) Dtmump;u0alt mfciasfsDra(vo t4tleomrcta1laDrluvi s0teto(o3ou1omen nei ( a2trum ;u1openmf3tltfs2el(vp;(4 eeomo3iotlmteauvil() 2toir iy1amenmfvsat)s2tm(mo;o1oeeoifcildfmDrauvo;t0tlxrxocoadfpDr n s;s0 2ur(opoy4lmtnmfvil(  2tmumoou0texo f3iydfm2uln s t) eenxo3tydfp  an o () 2xr(o3iydap n ict (farumumoou4oetn feiasfm2emums;t0alermo iy1faDe ues (0 rtr(r ou1ll nlfetltfaDtmur ou1opt  oetaslmDrlnmpnu) etnir iodoaDeanvols)sexmim ny4lm elfciat  2rax p;u4olxn ietldlm uaumpnu4 ltnmf tatlmD  uvi t t2uoiopiydape mivt ( s2urxm nt1aleoioetys m ulnmp u0 rxomo3iy1lp  ai i;s)t2tmiopou1ap e nvilt)a2rmu  oo4aex  fetls m2rmnvp (0tetrxo iodlatelnvs t)s2um(m io1al nmicil(fs2urxm ;t0aleniicilsls2um(vpnt4tleoxo3oydlmtran i;t  2xr(r ny4llte nctat)aDua(m ot0aexn f3tadlaDemu p t4 exnxr3to1lm  anvol()trto(opio1al   ivia(fs2rr(m ;u1tleo feild s2ran o (4tetrxf oadfm  ln ilt t2xriopiodop elfcsa(  2raxrpnt4oltoifcias sDulums;(0 leoif iy1faDe ieo;t  2uoimpiu4lm nmfcils)s2urx  ;u4tpx  fciytfm2rlu sn(4artnir iy1oa e ivsl(  rxr(o3oydoltnmnetlt sDtmx  ;o1oex  i3ildfa rm(mp u4 rtnxr3ty1fa   uvo (0t2umxm oy1opt miesat)srua(  no1tpxomf3iasla2emuvon() etnmr iytfpDelu s t0 rum(r3nydame  icsasf 2uaxmpot1tpxnmoeiad sDum(mp;u0aetoio3tydfptrlies;( seurxm oudal nmfvt tf rrrxmpno1aptomf3iasfs2um(vsn() lxnifctotom rluvi t) rto(opny1apen netl(fsDtrxrono4ape ioeiatfmDrlnmpn(4teenif3oadfm ean sls0teumxm iy4lmt mivils)sDumu o;o0olt moctltfa umu ont) eeoircty1lateaivs t) ruoxopnudlmen ictasf Durxmo;u4ape ioetldla2ulumon() exnio3ty1lpDe i o t)seumim iu4olt  ictas) Draurp;o4apto feias a elu p;t4alxoif3oa1opDr i o;t) euo(r3iu1lmenlfet t s2rr(moou0olenmieils s ra(ms;t0 rerifcoadlpDeai s;(  rtmimpiodol   neils)arrr(  nu4aeto fctld s2rauvsnu)trtoio io1fate uvslt0srxr(opoydlm eliet (fsDtru p;o1tltomo3ilsfa rm( p;u4arenxf3oytoatr n sls  rurim ou4om e ietls)s2ur(mpot4aexo ictydlmDrm( p;(4arxnmrcta1fate uvi;()s2um(r3oydam nmfvil( aDua(monu4tlx mfctatls ua(mp;u0altomo3iadomte uei ( trto(opiu1lp  mfcs (faDrmumoot1aleomfeias a elnvs t)arxnmfctotom elivo;( sexrxo3io1am emfctatfsDta( poo4olto ieiytlm eln o u0altoxfciatlm e n s;() rurirpoy4optelfesas)artaxmp;u4tleo o3tasfaDeaumpn(0trxoifctadop ean olt) 2xr(o3ou4apeemivt s arraumoot1aeen fctyt m ra(vs (0arerircio1fmtrlues;s)srxrxrpiu1llenlicilt) rrrx ont1ope ifcils m2rlumpnu0 lermf3iotlpteauvi t  2umxm oy1lmeelneta(fsrum( o;o0tlxoifeilsfa um(ms;t)tleomfctadfa e ivo t  2uo(r3nu1ll nlici s)srumurono4tet  oeildfmDemnms;t)trtniociotfa rlnes;t)s2tr(o3oydam emfesl()sDtr(r oo1alt  f3ilslmDul(vs (4arerxoctodopD  uvils) 2um(m iydomt  ivtl(  2tmx  ot0opto f3iyslaDeln pn(0artrmr ty1omDe nvilt  rumir iydom elncslsfartr( ooo0apx ifeiad aDua( s u)texnmf3oa1lp elu s (  etmxm ny1am e fvsat) 2rmxm ;u0optoio3iatla rmu ont0 rxrmf tydlatr uvo;s) rtmxrpiu4ole  nvia( arra(mo;o0tpeniieild mDrlu p t)teermr3totoatrluvs (  rxrxm3ny1ll e ivsltfsDuaurooo4olt mfeiyd aDrmu p;t4trenxo3io1op e nvi t0srur(opiudlm emfctas)s2taxm ;t4tlx io3tytfa rmump t)texrxo3oa1oa rlivs;(0srtmio ou1alt mnvi s) rum(rp;t1tex  f3tys a ua(vo u4tetrxrciatlp  au s;s0s2to(r3oy4al e ietas a2rax pot1aeen oeiltfs2ra(ms u0aetrxf3tadomteluvo ()s2to(r io1lmee fcias)a2umxmo;u1apto feiytfm rauvp;u0tltomrciydoatrlneilt0s2umxr3ou1ol eliet s aDrm(rp;t1oexn feiyd s rl(vsn(4 eenio3iodoatrau s s0 2tr(m iudom  lictlt sDta(mpnu4opxomieils mDumn o t4 eerir oy1fm r nvs (0sexr(m3iu4lpeelicia( aDurxronu1oetn icilsfaDranvp;() ltnmfcto1la r i o () rtoirpnydam  mfviat)srumum no1aeeoifetytls2rl(vsn()alxrxf iatfmtrlnei;(0 etmxo3ou4lmen ieiat sDrmxroot1ape  f3iltfsDrmump u0alxnxo3tytlm eluvil(0s2xmim io4ole  ivtlsf Dtruroou4opxo icils m rl(vo;t4alxomo3iytfatelues;( t2toxm nudolte fet tfaDra(mp;o0oltomieilsfa2uluvpn()tleoxr ta1fm  auvo;()s2umxopio1aptn feiasf 2rru oou4optnmo3tysfaDranmont4aexrmrcia1op  auei t seur(m io1apenmfetls aDra(mpot4oexnmo3ias aDranmonu) rxniocoatlmte nei s)srtoio3no1lp nmfei () 2tax ooo1aee if3iysfm eluvp;(0teenif3oydfmDeauvi s)sruoir3oodaltnlncsa()aDum( poo0teen fctld sDeaums;u0 eermoctadoaD lnvo;t) 2to(r iodalte fviltfsrumxmpot1tlenioctldfmDua(vs;()aeenxfcta1omD  iei;( trtrimpny4lpte netas arua(mpnu4oetoiiciad a2ra( o ()trenxr oytoaD aiei;(0trtoxmpoo1ll   fcsas) rumxr ou1aetnif3ias a2rm( o;u4alxrir tydoaD anvsl( sruo(r3nydlpte fcs s  Dtmxmpnt4optoifciyd s el(mo;(0 lxrmr ootlaD  ueil()sexoio oy4alenmiciat)s2uaxmpno1alto fctatla2rl(mo;(4aetomo3ootfmt  neol(0sruoxr oo1ap n iciasfaDumxm ;t1openmf3tldfsDemnvon(0tetoirciodfptr ies ()setmxr nudamen iciat)sDrru o;o4ape  ieiat a rl(mo;t)arxnmo iydfatrlu slt)s2trxo3oy4om  lics ()a2uaum no1apeo f3tysfaDranmsn(0texnifcoodlm rau i s t2trxo3iodlpenlfes tfsrum( pnt0tltnmieiad aDrm(vpnu)aleoioctytlpDelieo;s)srxrxrpoy4omt mivt s srraxm oo4tpt mietls aDrm(vs (4aexrifcoydfmD  uvslt0 exoxo3oydal  liet s)sDtmump;u0apeo ietadlmDrlu s u0 lerxf oatopteln o t)s2toim iu1lmtnmncsl()sDururpoo0alxnmi3ilt a ua(mpn() lxrir3tatlmt livo s0 ruoxm3oudlp emieiltfsDur(mp;o0oleoif3iltfa em( o ()alxnmf ta1fmtelnvs ()srumxopnodaltnlivilt)artax p;t4tpt  oetat aDrmuvon()artnxo3oatoatr nesl(0 2tr(r3oy1ap elivi ( s2raur no1aex ifeilsfaDrmuvsnu) renmf oa1fp eln sls0 etmxmpny4opte nvi t) rra(mpot1ope mfeiltfs2um(vs (4texomo3iadlate nvs ()truoirpoudam nmnvt (  2taxmpou4olx  feiys a rmuvont4arermr3ootopt lies;t) 2xmir3io4olte ivia(  2umx pnu1teeoiieiyslmDuluvp;u)altrmo tytlaDr ies;() 2toir nydomtnlfcs t)sDuaump;o0tex moeiasls2el(mpnu4 ltnio3oatfm eln i;t t2xmir3oydlm   iei (farrr(r no4aet micils s rlnvo;t0 lxoxoctatoatran o (  rurxr3oo1al  lnvtas)sDra(m oo1ape ii3tyslmDrmnmon(0texomo iatla  lnes;()s2xm(r iudlmt lfvi s  Dta(m ;t0oee  feiadlaDranmo;u)tlxrmociadlmtelneols)texmiopoodol  licia()a2rrumpnt0oexn oeiatfs uluvp;u4 lxomr iatoa ran o;t)t2uoxrpiudamenlnctlt srua(mpoo0alen i3iysfmDum( s (0 exnio3tadlm eaivols s2tmir3ou4opt  fvt sf Duax p;u4apeo o3tasfs2emn o t4tlxoif3oy1omte u o;t)seum(m iy4lltn icias  Drau p;u1aeen ieild m ran s (4 exrmf3oatoaD lueols0t2toir3oudlm emnei (farrrxmo;u4texoioeilsfaDul( p;u)alxrio ty1fptean il() exm(mpou4olee ivta(fsDraumo;t1ope ii3tad s rmnvs t)tlxoxr3iytoat ai ils s2urxm3io1lp n nctlt sDuaum oo0aex ii3iad m umu p t4trerxr ta1lmtelieilt0trxoio3iydlp elfct t  2uru pot1oetnmoeiad s rluvsn(0artrxociydop r nes t)sexmim iu4ap n fetls) Draumpoo4apxn oeiyslm umn o t4tetnifciytfat lu i;s) exr(rpny4alen nes t s2rax  ;o4oleo oetls a2elnvon(0 rxnxo oytfaD an o ()setoxrpiy4apenlnviatfsrraxront1oetoio3iytfs2eln p;u4arermfctydla e n s;t0trurim oudapee nes sfsDrmu o;u4oltn oetyt sDrlnvp u0artrir oytlm rlieo;()setrxr3iydopte fciat)srur(mp;o1tetnmo3iysla emn s t)arxnmr3todoate ivo ( srtoim nydllte nei t  Dumxmoou1oleoiiciad mDumu s;(0aeenmo ty1opte nvil(0t2tmxm3iy1op e fet tfsruaxrono1olx  f3iydlm umnmp;()aeenmf3oy1fm eaneo t srxoiopoudapt  iesasfsrrm(mo;o0aeto f3iysfsDuanms u0 rtnxo3iy1fm  aivo t)srtrxr3io4lp elfctlsfs2tr(ront0texo ietasfa2rm(vs u0texnmf tadla  au ols0setm(mpoy4optn fvtl()sDua(mpnt1tleomocias mDrauvonu0arxnxo to1fmt au i s)s2xrio3nydal emncsa( a2rauront1aee iietas s2emu s u)teeomrctadfm e i s t)trto(opoo1lp elfeiasf rrrxm nu0tptoiieiatls2ulnvsn(4altrir3ta1la rluvi;t)truoxmpnodomenlict () Dtrx  nt0apenmi3ilsfs2uauvpn()tlxomr3ootoa e nvo s0srtoio3iydom  lfcs (  Dtrx  ;u4aexnmi3tasfs ul( onu4aeerxfciy1op r i olt t2xo(opny1ome lfei (  rta(  oo1apto iciytfs2rau p t4 etrmr3tatoaDr ueilt0 rtoir3iu4am e net ()srtr(mp;u0aee mf3tasla2rlnvo;u4 rxnif iatlmDean i;s) rxo(rpny4aptemncsat)sDrru pnu1optnmfeiltlsDuau s u4 etnif tytopD au i s t2to(rpoy1amee nctat s2tax  nu0tlx  ociyt a rl(vs () ltnif ootlateanvo ()trxrir iu4lp elfvils)a2uaumpou1tptomi3iad s2uanmp u) etrxfcoydoaD lieo t s2xo(o io4amtn nes tf 2umum nu1alt ii3iasls ulu p t4teerxo3todom   u slt) rxrxm iy4lpt liciat)sDua(rooo4tetn f3tys s2el( pnu4trxrxo3tydoateaivo;s trxr(r3iu1altnmnvias)arrru ooo4tlt  oeiat m2uanmsnt0aexoif oa1faDe nei;s)trtoxr oy4lltemnvsl( aDraumpou4oltomieiltlmDemuvs;t0tlerif3iydfmte uvs;( sexoiopiudomeemnet (  2trx pot0tetnioetlsls2rmumont) etrifctadlaD  i s ( s2tmim iy4lpeemfet (faDrm(mpou1apxomicias s2uanms;u4trtnir3iadom   n i ()t2xmiopio1alte fetatfa2ur(mp;u1olxnmiciadfm rlu ont4 exnifcio1omD ln s t0teto(mpio1lpeemfctatfaDtruro;o0open ictlsla2rmu o t4tltoxrctodfatr neo;t)srumir3nudoltn fvt t aruaxmoou4aeenmicilt m2ea(mon(0trerxfciytfmt liei s) rumirpiu4al  livta( sDra(r nt4tet iociytlmDum(vs u)alxrxo oadoat  nei;s)sexoim3oy4lmtn ivslsfaDrrx  ou0olenifetat a2ea( pnu)areoxo3iatlp rln o;s  2umxr io4omt lfvilsfsDrr( oot1tpeoioeiadls2rauvs;(0alxniocto1oa e n sl( trumiopiu1omee nctl()srrm(rooo1olxomo3tyd a2uln p ()texrxf ootfm e ieols)trurir ou4lm nlfet s)s2rrurono0opx  feiatfm2uanvp;u)aetrxoctytopt li i s) exmir3iy4ale  nvta(fsDur(  ;o0tpx mf3iatfsDulnvpnt4 rxrxfciydoa e neo;t0setrir3ny1opte fvsasfarta(m nu4tleomietaslsDumnmsnt4alxoif3ta1oaDrlueo;s  rxrir3ny4al n ivs t) 2trxr ;u0tleoioetytla2um( ont0 lxrmfcoatopt lues t trur(m io4ll emnetls) rrmxmp;t0opxomieiyd s2em(mo;(0trxoxo3totoat aneo;()teumxr3nu4am nliviat sDtaxmono1oetomfeiatlsDrlu p;(0artnmr ta1om raieolt0sexmxm nodal nmnet tfs2tax pot4apxniietad s emuvs;t) leoxfcio1op  li s;t sruoxm3iy1lptn ncsls)a2tauroou4tpxomieilt mDemn o;u4teerir iy1lm e n s (0 eumxm3iu4al e icils sDta(root0oetoio3iad sDraums;t4 rxoxf tydom   ues;t)trxmxo nu1ap emivt tf rra( poo1oexoioctlslsDum( s;u) rtnxrciadlaDeaieslt t2xrio nodop n fetls)artmuroou1olxn f3iadfs ulu p (0trtnxo3to1lm ran o;s)seumxr iu1lp  lfvsa() 2trx  nu4tlen o3ildfs2ulnvonu4 etrxrcoadlpt aiesls seuo(r3io4ol e ncsat  rrm( p;o4oltnmfctatfs rmnmon(4 lxnxfcta1faD livi (0t2xoir no1lp e netls) Dtm(rp;o0aet miciysfm2rmnmp (4tltrio3oy1oaDr i s;t)srtoir ou4al   nviasf 2raxmoot1alx io3ilsla uln o;(0 rxnio iotla elues (0seumxr iudlpe  nesas srurumpno0olt  ieiyd mDeauvont)artrxo3oa1lpteluvslt srxoxr3iodllt livi ()aDtm(r ;o1tlx iiciasfmDemu o;u)altrmf oydoatrai i s0t2xmim3ou1omenmnct t)sDuaumoot0altn o3tatlmDulums t)artrifciy1lmtr ueols sexrxr3oodlpe mfetlsf Drr(mp;t1tle mfciytlsDemums t4tetomr3oa1faD  nvs;s seumir3no4alee fcs t) rtm(moot1olt  fetytlsDuaumsn(4 lermo3ia1opDelivslt)tetmirpoo1olee nesa( s2tm(m ;u1tpxomfeiatfaDumnvs ()tltoxo ootfaD lnvs s s2xoio nudapt mncs () Dumum ;t0optnmi3tydla2umumo ()artomo oytlmD ai o;(0s2ur(m ou1olee nci t  2uaur ot4olx iictldls rmnms;u0arxrxfciytlaDean s s0sruoxrpiu1lmee fvsa(fsDtmxroou0tex ii3iadfm2um(msnt4arxrircoa1la rli s;(0 rur(m3ou4ol e nvsa( s2uaum nu1opx iiciaslm ulumont0aexoirctadopt  ieilt  2xrim3iu1omenmivsa()a2rr(  ;u0alxo i3iyt aDrmn p;()altoio oytfa rluvolt0texrxm io4omtemfcsa(fsrtr( ont4tpxoiieildfm2ul(vsn(4trtnif3iotlp raneolt0trxrir oodlm n fci s) 2tm(rono1oltomociad m uan pnt4artrxf3to1opDranes t)t2toxrpio4aptelfvsa() 2um(rp;u0oetoifcildfa elu p;u)aexoifctytoat  iei ()trtoir iu1lpe lnvsl() 2tr(ro;t4tltnio3iltla2ulu on(0tltnmr tytomDraivo t0setr(m3ny1lpte ncsasfsrrm(mono4oex mf3ias aDel(mp;t) lxomo iotfm   uvs t0 rxmxo oo4ope lfcs t  rtrxrpno1tpenioetasfa eln o;u)aexnxocoy1omte u i;() 2tmxr3oydape  nci t)srrrum ;t0aeeoioetldfm2elumsnu)trxrmr3ootla e nvo s)t2xm(o iodlpe  fvias a2tmxrpou0olt mieiadfs rln s t4 eerxrcoodlmDeaivo;(0t2um(mpno4lp e fvs t) 2rmx p;o0alenmo3iyt a2ra(mo ()tlxnmfciytlm  anesl(  2xmxopio1ll  lnctasf 2urxr nu4tlx moctyslaDul(mont) lenxfcoatlpDraiei;( t2tmxm ny1apenmictls)s2ua( ont4tetomi3iltfmDulnvp t4arxrxr3ta1optraiei s  2ur(rpou4al n fvi ()srrmxro;o0tex ioeiadfa2elnvs;u) ltrxr3iy1op   uvo s0t2tm(r3io1am nlfvslt arta(mont4oeto feils sDea( sn()aexnif3iodomDelivi;s sexoxm3nodlpee ivsls)sDtaxm ot0aeen ieiyt s2ra(mo t0 lxomrcoa1lm r i s (0texmir io1lmtemfcilsf Dtrxmoot4tltomfetadfs2rl( s;(4 lxnmocty1laDe ueol() ruoxr oudomenmfvilt) Drrx oou0tlt mi3tlt m ulnvsn(0tlxomr3oo1fm r uvilt)s2toio3no1oltnmieil()a2tr(m ou1apen ieiys s rl( on(0trenmo3oa1fatranvs t seurxr3ou4lp  lfcs ( arur(r ou1alxo octytfs uan s u0trtomrcoatlp eluei;s s2xr(o3iydlptnlnvtas)s2urxrono1tlx ifeiytfm rauvp;t)texoxrcoy1lp ean o;s) eurim3iydop emncsatfaDtaumont4tpx mietysla rlumpn(0 rxomfcootlptrai i;s  2umxr3iu1apeemfet () 2rrxr nu1oltn oetad mDel(mont0 ltnxo tydopDr nes;t s2xmxo ou1lltelivias)sDum(  ou4tee ii3iat a2eanvp (4teenircoy1fmD lueo ()t2xo(m3oydaltnlfviasfa2urumpno1oetn ictyt aDem(msnt4 leoioctotfmt an o;t0trxr(m3oo1amt  fetat  2urxronu1tpen feiat m ul(mp u4 rerio3ty1lp ran ilt) 2xoir3iy1alt  fvtltf Dua( ono4tee iicilsfs2emums;(0artrxf3iotlptrln s;s  2uo(mpoo1altn fctls  Dtr(  no0opt mictldfmDemnvpnt4tetnmr iotomtr n i ()tetmxm3oodlp emnet sfa2tmum ou4aexo octydlm2rmu p t) rtrmocoo1fmtrauvi s0srtmxr ny4ameelncia(fsrtmu pot1olxomf3ild a ul(vs u)trtoiociydlpD lnvi;()setr(m nu1lm n neslt s2tr(rpoo1olenii3iltfaDran p u)texrxr3oo1fa  au ilt  2xrimpoo1ope mivs t)sDra(rpno0olxomf3iysfa rmn sn(0 eenxr3tydlmtelnes t s2xrir3oo1alt lfci s  Durx  no0openii3ildfsDrm(ms;u4 etnifcoy1om e ivo t srumxr oy4lp  lnvs (  Dta(mpoo0teenmi3tyslmDel(mp t) rtoxr3tadlp   ivs s) rtrxm ou4am nmnct ()srumx  nu0apxn ociydfaDumnvs u4areoxr3oadfpt  n ils0sexm(r nu1ol nmiesas srtm(root0tptn oeiad m rl( pnt0treomoctydla r u ils0 etmxm3oo1opeelfviasf Draumoou1aptnio3iytlm2ua(vpnu0 rxoio tadfmt luvs;s)sexr(o3nudoltemfesltf Dtrxm ;o1ape mo3iat m em(vo;t4aeenxr iotop   nes;t srumxmpou1amtnmicsa(f rtmxr nt0tle  oetys s emnvs u) lxrmf oydfpt luesls0 rtmim3iodlpt micilt) 2umurp;u0tptnii3tytlm2rmn p;t) rtrir3oy1laDr u s;t)t2tmir oodoltelivil( aDur(  no1tltn f3iltls2eln p;u)tltrxocoy1optr uvs;(0srtoir3no1ol nlneia(  Dra(rpnt0teeomieiaslaDeluvpn(0 ltnmo3tytlmt aivs;t s2uoxmpno4lmt livtls)srtru pnt1apeoii3ilt mDeln snu) rtnif3ta1lmDrlivs t) 2tmir iu1olenmfeil()sDraxrpou1oee  ieiaslaDuau o;(0 ltoxo ta1fatr ueo;(0t2xrxrpiydamtnmfcias)aDtrum no4olto oetld s2uanvo () rxnxo3ia1fmDelu o ()sexrirpoy1apt mnctls  Dur(r ;u4apx io3tatfa emnmp u4texoifcoadlm eai s t t2tmiopiu4aptelictls aDuru ono1apxomociatls rmu s t)aeerif oydoatr i i ()srtrxo3ny4amee ivi tf Dtaumpou0apx mietytfs uanmonu4aeermf3ta1fa elivil(0srxoxo iu4olenlics s  2tr(mono4alxomiciydfaDraump;(4altoxf3ootlatrauei;s0 rtrxrpoydll nmictl(  Dua(mo;u4apt  iciyslm2rmu s u4aexnxr oytla e ues;()t2toim ny1ll   fetatf rrmx pno0olenmictldlsDemumo;()tlxomf3oadlp r ueo;t  exoxo nydll n icilt)aDrax  ot1oeen iciydlmDel(vo;t0 lxoif3ootfaDrlu ilt0t2tr(r3io1ol n ivilt  rumu p;u4tptomoetyt a eauvpn(0altnmrciotfmD lu i;t  2xmxm oudomt  ieslsfa2urx oou4oexomieiytla eluvs ()trenif oytla ranei (0t2uoio oudopen ietls) Draxr oo4tpto i3iytfaDea(mp u) etnirciotlm  luvi;t)trxrir3oydll   fetls artaum ;u1aleoii3iatls2rmn pnt0 lxoir todfp  lues;s s2xo(r3nodol emiesltfsrta(mpoo4opeo iciltlm2ea(msnu4teermf3io1fm eln ilt0 ruo(rpoodlpen fesasfa2uaxro;u1apeoifciydlaDem(vo ()texoxfcia1fa   ivilt) rxoxr ny1lptnmivias  rrax  ;u0altnii3iyslm2em( o (4tltnmr3oytfptr ivs;()trxo(rpoydom  mies () 2umum ;u4tpto o3tydfs2el(vp u4 rerxr oytop  livo s)tetmim3oo1optelnet ( srtm(rooo0openmf3iadlaDrmums;u4treoxr iy1fp   uvilt)t2xmxr3nodlme  fctatfartrxmpoo4tpenio3ils m ea(vo;t) leoir iodfpDeanes () etmxr oy1ale mici ()aDrrxrp;t4tpenmi3iatlaDuluvsnt4 rerio3oy1lpDr n o t0trxr(o io1llt  fciatfarurxmpoo0oetnmieiatfm2el(mo;t4 etnmocoo1opte ieo t)seurxrpiydome mnvils)sDuaumono0tpenmo3iadls2eaumsnu4trxnmr iatlmDelu s;t0 rtmim3oo4apenmneiat)sDrax  ou1tet ifciytlsDul(vsnu0teerir3tydfm rai ilt) 2urim nydamt  ncs ( srtr( pou0texn f3ilt m ranms;() eermo oydfaDeln o ( texm(opiu1lp emfvtl( s2tau ooo4alt  i3tatlmDum( o (4 exrxrcoodfa eln s s trto(opnodol e nvs (fa2rmu o;t1teeoiietlslm2ua(msn()texomf oadoateauvs;t0 2umirpou1ole mfcs t)aDrmxm ot4tetnmociaslm2emumon(4arxrxr3ty1oatraneol(0truoirpou4al  lfetl()s2ta(rp;o4tpt ioeiydfa umnvsnu0texnio iatomt lueilt)s2xmxm3oydop e net s) rum(r oo1altoiictys m ranmp t4 rxrmo todlptrluei s  etrimpnodlptnlnciat) rtauront4oexo ieiytls um(vsn()altrxr3tadom raivi;t0 rtrimpoudllt lics () 2uaumont4aeen o3iaslmDem(vo;()arxoxf3oy1laDr ivs;(0 rur(o iy4amee iei t) Dra(r nu1alxomfeiytfa ra( p;t0aetrxfcty1fatr neo s0 2ur(o iu1lmen neiltfaDtrxmo;u4tpxoif3tadfs2uln o;() ltnxrcty1fmDr u s;(0s2um(opny1omt mfvtlt) Dumu  ou4aetn icildla uauvon(4alenxr iatopDr u s;s)srxrio iydlptnmnci s  rrr(mont0tlxnii3tatfa umn p;t0artriocoatlptrlieo s s2tm(rpoy4lpte fvta() 2rm(  ;t1aetoifeias m eln s;t) etnir3io1lmteaiei;s0tetoxopou4om nlncias)sDrr( ont1oltoifetatls2rmuvs (0tetnmf3oodfpD  i o s0 2to(opoo4opte ies (f 2rau ooo0optniocildla2ulu pnu0aeerio iydfaDeau s;s  rtrio iy1ap nlivsasfa2ra( pnu1apt  f3ias s rmnms;(4 etrmfcoadlm eaues s0tetmxmpoudamtelfctat)s2rru o;u0tee  ictasfaDuau on(4altomrctytlm  anvo (0 rumxopnydopee fcilt)s2tr(  ;t1tptoifciaslm2ulnms u4 exrifciy1faD lu olt t2xrxrpiy4amee ies t) 2ur(rp;u1openmietytfs2rm(ms;(4teeoiocoatlateaneo (0 rurxo oy1ll nlnesl(fs2uax pnt0aet mfeiysla umnvs;()arxoxo3totfmte nei;t)s2toxr ou4lltelncta(  rtmu pot0openmfeiltfs2umn pnu0arxomrctadfaDraneo;t0trtm(r nodole mfci ()a2rr( onu1opeo i3iysfa2ea(vp;u0trtomrctytlm e ueslt)t2umio3io4lpeelfvs tfs2trx  no0aptoiieiyslmDranvo t4teeomo iydlaDr uvo t)tetr(r iodale  nvs t)srrmu pnt1oee iieias a2ean p u4 eermr tatomte i ils)trtr(rpnodol emnci ()a2um(ront0apeoii3tad s2el( o;(0 lxomr oydlmt lnvi t0 rumimpio4lle licils)s2uru ono1tetniociasfm rmn o (0altnir3oy1lmDe uei s texoxmpoy4alte feia()aDtrxmooo1aeeo i3tatfs2eanvonu4texomo iy1oaDelnvsl(  2xr(mpny1lp e ics sfa2tmumpoo1altoifeiltla rm(mont) etoxo ty1lpt aivi s teuoim3nu4ol  mfvt ( aDum(mpou0teeo oetld aDel( on(0aexrxrcty1fmte i s s)texo(opio4olen nctat arrr(m nt0tpe moeiysls rlu pn(4texrxo3iodfa eaieilt) exoir io1omtnmiviasfarurumpoo0oet miciatfa eauvs;u)trxrircoydfpD lu ol()t2uoim oy1ap n netls artau poo4tlt mfeiysfaDrm( s;(0tlxnxocia1opt  ieslt t2umir no1am emiesltfa2ur( oot0tptn o3iydfm2ulump;(4 lxrir3oatoptr ies;()tetmxm3iodop nmnetatfsrumx ooo1ope  feildlsDul(vp;t4teenmr oydfp e nvilt) etoxmpoy1am  mfeta(fsrraur ;t4aex mfeiys mDemn s;u)alxnxf iytfm  anei s)seurio io1apenmfci (f Durx  ;o1tle  fctadlmDrm(vs;t4trtoxf ootfa rlivs;s  rum(o iu1ome lnctatfa2rmx oot0tpxn icildfs eauvonu0 eenircio1la raueo s0 eurimpiy1llt lict (fa2rm(mpno1olxnmieiasfm2eau p (0arermr3iadlpD lnvolt0texrxopiy4amtelfvilt)sDrruroot1tex ii3iatla2ua(vsn() leoio3iadopDrliei s0 2xo(m ny1apt livtls  2tmx p;o1oee ioeiad aDulnvo;u4aetomrciytoa rau il(0texoxr iydal nlfct sf 2tau  ot0oexomociytlmDeluvp;(0arxomr tadfate neo;s)trxoxo iu1oltn ivt ( a2tmxr ;o0texomfctyslmDulnmo;u)trxnir totfate ivi;()t2uoimpoudolt mneils)artm(mp;t4tpenmfciyt sDrau o;()areoxf iotoatr ieo;s srtm(mpnodapt  nci ( a2ta(mpnt4aee iocias s2rauvpnu)tetomfcoydfpt anes;() exo(mpiydamt liesa() rtru ooo0texoiociatfaDulnmp;(4teeoxo3totoa eauvo;s)t2tr(r3oo1om  liei sf rraxm ;u1apeo octldlmDem(mpn(4arxoxr3tatfm eauvi;t tetm(opiu1oleemfeslsfsrtaxm ot1ope io3iyd a2rlumont4 exoxo todlatrlies s) eumxo ny1lmtelfet (  rrrum ;t1alx  o3tas aDuan s;(0 rxnif ia1omtraieo;s)s2uo(r3iy1lle lnvi t) 2tm( pno1apxnmi3ild mDelu pn(0trxrio to1laDrlueo s  2umir3ou4op nmfeslt)aDrax  ;u1olt  iciadfm2ulu o t4 exoxociytlmt au s s)sruoir nydolee ncsasf Dua(r ot4oeeomi3tys s2rlnvp;t0trerif3tydlmte ues (  2tmir oy4omenlfet tf rurx  ;o1tpxoii3ilsfsDelump;(0aexnmf3oodfmtelneo s trxr(r oy1al nlici sfs2rrxronu4oeeoifeiltfaDul(mon() lxrifcoadlpt  u o;s)seurxm3oo4lltemnetlt)a2rrur ;t4oleo o3tatlsDelumonu)trermf3ta1lmDraivs;s0 rxrxopou1lp n neia(f Drax  ot1teeo fetltfa uanvonu0 lenio3todoaDrlues s) rumim3ou4lmtnmivt (faDumu  nt0oetn feiys mDumumsnt)trermo oy1oat lu i s0seuo(opiudomen fviat sDra( o;u1opxoioeiyd s um(mp u0aetnmoctadfat auvol(0 exrxopoy1am n nvs (fa2ua( pou4texoiiciad mDumums t0areomr3iotlpDr i ilt  exrimpoo1lm n iesls aDtm(rp;u4tet ifeilsls rlums;t)tltoif3iatoaDranvs;t0srxmir3iudaptn iviatf 2rmumpou1apeomoctysfsDeanms;t0trtoir3ia1omD lu o;( trxmimpiy4om  mietls)srta(r ;u0alxnmfctyd aDea(ms;(0 eermo ta1lmD  ivo (0texo(o iudamt  netls  rrmx pno4tpxniieiyslm ra(mont4 eeoif oodlateln slt) eto(r3ny4am   nci ()a2rrxrpou4apt mfeiytls rmuvp u4 etnir totfmDeauvs;s srtm(r3oo1omtelfetl() rrr(m ou0oexn fetysls2ul( ont) reoif oy1lpDelu sl( t2umxr oy4lltnlnvsa(fsDuauro;t0oleomoetldfm umuvs;t) renmf3oodfa  lneo;t0s2xrxo iodome mfctltfsDurx o;t0apeomfeiyt aDel( o t)trtoircty1om elues;s0 2xoxopoo4ape licil(farumumonu0oetnif3ilsls2rmn on()tlxnxr3iotlptelnvsls) 2trim oudameemici sfsrtaum no0oee mi3ildlaDemnmp;t) lxnmr oytopDrauvil()srtrxm nu1lpen fct t  Dra( o;o0altniiciasls ea(mo;t) rxnircoo1fptraies s s2trxopiy4ape mnei ()s2tr(m nu4optn iciyt m ranvsnu4arenmocoa1opDr u ilt0trxmxm3nudom   fvia()aDtr(  ;o1tpt mo3iltfsDel(vonu)artnmf ta1lptr ueil( t2ur(o3iy1opeemiet tf 2rax pnu0oeeo feiasfaDum(vo;u0trxoir3oytla rluvils0sruo(m iu1ape mivs (  rrmumono1tlenmicild s ranvo;u0trxrirciytfp  ai o ( teumxo3oy1ap elieia() rumur nu1alen ieias sDeanvsnu0altrmo3ootfpD livolt0 rumiopio4omt lnesat  Dtrxmont4tpen ictydfaDean o;t)teermocoy1fa r iesl()trtr(r iydom nlfvtlt) Drm(mpot1oetomociltlm uluvp t4artnxo iydoptrli s ()trxrio3iydom emneiatfa2rau oot1oet mfcilsfa2eaumpnu0tltnxr3oa1omD  i o;() euo(o nodll  licias)aruaxrp;o1oexnmfeiytfs rluvo;t4tlxnircoo1faDr u s s) 2trxopno4am  lnci t) Dur(m nt4ale mi3tyslm ranmp;t)tlxnmr3ty1omDr uei;t texm(o3iodop  mieia() rtaur ;o1opx  ieiadfa2emnvo t)alxrir oytlp rli sls) rumim nudaptnmfes t s2uaurooo1teeomi3ilsfs emn o u4tetomocoydfmt  ues;s s2xmir oodoltelivtltfsrrmx  nu0aexn fctat mDumnms ()aetnxocto1lmtrlivs s tetoimpnodop n ncias) 2ur(m ;o1alxoiocilsfsDul(vp;t4arxrxr3iydlpDeluei;s0 eur(mpoydaltnmfcsls aDtm(  ot4apxomoeiad sDem( p;() eermf totoat an sls0seumxr3nu4lle liei ()srua(m no1ale ifeiysla ea(vpnt) rtrmfcia1fa eliei t0 eur(rpio1ome  nvtlt) 2um(r nu0tpen i3tys m uauvon(4 exoifctatfmDr u o t s2to(r3io4llt mict tfsDuru  nu4tpeo oeiyt aDemu o (4tlxomf oa1lpte i il()srtoio nodlptemfcsa(f 2rmxrpot1alx  fetytfm el( p;t0texoifcoydoateai o;t  eur(opny4omtnlfeil() Durump;o1tpeo fciltla emn snu0aexnmf3iatlaDe n ols s2um(r iu4llen nei t) rtaurp;t4aex iictldla2um(vo;(0arxoxfcio1om r ues () exoxo nu1lpe mfei tfs2urxrp;u4apx io3tlsla el(msn(4alxrif iadomD luvo t srtrir oy1lpeelnvs ()a2urur oo1olen i3iatlm rauvsnu0 rxnxr3iatoptr ieil(0trum(rpiydopeelfvslsfa2uaxmono0alx mfeiytla ea(mo (4tltrio3iydlpDr ueo;s) etmxo3nu4am e ieia(f ruru  ot4aeeo icildla2ean p;(0texnxo to1lmteaueo (0setoirpio4om n nvsls arrr(mono0aptomi3tyt sDuln o () renmr3ootom raues;( t2xmio3iu1ole lici sfartrxro;t1apeo oeiys m ranvsn(0texomo3oa1fat anvo;s)texoxm ou4omt mfeilt srur(mo;u1alen o3iyd mDea(vp;t) etrmf oa1lmD  uei ()tetm(opio4ol n ivilsfaDtru  ;t0tpt mociysls2rauvs;t4aleomr todlmt lieols0s2urio3ou4om n fvsat arurum ou4tetomoctld s elnvo;()alxoir iadla r iei s0trtr(rpou4ll elfetltfa2rm(rpou1aeeoii3iys mDrm(vp;u4 rermf totoatrliei s0setrio oy1lmtn feia()sDrm(m nu0aptoifetls mDua( ont0 rxoxrcoy1lpD aieo s0 exmxmpno1amen nvsls) rtrx o;u0olenii3iysfs ul(ms t)tlxrio to1faDe ivs;t trumir oy1ope  fvtas)aDurxm nu4apx mieilt s2rmn o u) lenir oydop rai s;s0trxoxo iu4ol  livi tf Drrxr ou1oet mietldfa eaump t)altrmocio1lmtrlivs t)texrirpio1ap emivt t) rtaxm nu4tlxnioeils mDrluvp;(0teenxo iotfm eli ol( tetr(m3nu1lpeelfesl(  2tau  oo0tpto f3tltla2ra(vo;()alxoif3oatoa e n i;t t2tr(o iu1lmeelicslt)sDtrx  oo4ole  o3tlsfs emumsnu0artomr oatla  aivi;s) etmxm3iu4om nmfvtlt  Durum ;t4tlxomf3tys aDem( ont4 exomf3todlmtelnvo t)trur(o3iu1op emnvt sfs2tm(ro;o1tlt mieiadlm2ul(vsn(4 exrif ia1lpDeai s t)setmir3nu4om  mies s  2tm( pnt1ole  fctlsfm2em(vp;u4arermf3oadlmDe uvo ()setoir no4am nlfet t)arrmxm ou4aeeomfetydlm2eanms () ltnxf3iy1fa  an ilt)trtrxm3nodom  mncsa( a2tmx oot0aptoio3iltla2ra( o;t4arerxrcoytoa   nvils0trurxo iu1apt lietlt  2taum no0oltoio3iyd mDeanmp;(4 eeomrcoatlpDr nvs;(0t2urir iydapeemici t)aDrru pou1altn o3ild s2um(mo (4artrif todlmt li o ( teuo(rpoodlmtnlnctatfarra(rpnt1olxniociatfsDua(vo;u) rxomocia1fptelues;s)t2xr(r ou4amenmneta( aDrr(mont0oexnii3ildfsDemn p;u4aexrmrcto1fa elnvo;( texmxr3oy4opteliet t sDumx ont0opx  f3iltlmDumu o;u0trenxf oy1oa  aieslt0s2tm(o3oydlpt  fesl( sDtaum nt0oleo o3tadfs emu o t) exnmo oydoptelivi s) rto(opiu1lltnlfvilsfsrrrurpoo0aet moetlsfsDel(mpnu4aetomr3tatlpDraneil()s2xr(m ny4op   nvs ( s2trumoot4aeen icildfaDumump u0tlerxf tadlpD au i;(  2tm(o3nu4llte fci sf 2rrx  ou1tlxniicils s um(mo (0aexrxrctadlm  an olt0teur(o ou4alt  nvtas) 2uaxm ou4ape  o3tasfaDumu sn(0 eenio oytlpDraiei;s0trxo(opio1oleelneil()srtrx oot1opxn feils s2emnvo;(4 reriocoodoaD li s t)srxrxo io4lpenlfvt sfaDuaur nu1apxnmoctad m2um( pn(0trtomrcoodlp e ueils)s2xmxr3nudoleemnvia(faDtrx ooo0tee moctyd mDrl( s;t4aeeoio3totop  au s;()tetmxopnu4oltelfei sfaDumxm oo4olxn o3tld a ua(vsnt)texnio3oydlaDr uvsl(0trxrxr io1am elfeia(f 2umx ooo4oet  iciad mDrlnms t) exrmociodfa  aneils0 rxoxo3nydal  mictl() rua(  no4olt iociltfs ulnmo;t4aeermrcoodfmteln slt texmxr3ny1ap  licilt  2uax  ;t1apto icilsfs2rmumo;(0alenio3oytlatr u s;s0t2xm(m iydll emietl(faDrr(rooo0tetnmoeiasla ul(ms (0 etrifcio1omD  n o t t2uoiopoo4alt mfvta(  2ta( pnu0apx ii3taslmDulump u4treoxo todlptr nvslt)t2uoxo nu1llt livi sfa2rmx o;o4oltn f3iydla2uanvp;(4 eenir3totlp  ai o;( truo(m3ny1lmeelnet tfaDtr(root0aleo i3ilt a rau s t4texoio oa1laDraiesl(  rxr(m oo4lp emnvt () 2rm(rp;u4tee  ieiltfa2rmnms u4altrxo3oydfateaiei;( s2umxo ou4lle lnvia(fa2rrx  ;o4tle ifetadla em( o ()texnxr iy1lpt lnvi;t) 2xrim oudlm  mnesls aDua(m ;o1oeen f3iyd s2ua(mp t4alxrmf3totlaD aueo;t  rtoxo io4olte fvtas)sDrmur nu0tlxniictltfsDra(vpn(0 lxoxrcoodfat ln s;( teuoio ou4omtn nci ()s2tmxrp;o1tetn i3tltla ean on(4 eerirciytop eanvo (0t2toirpiu1omtn nei s sDtm(m oo0tltnmieild s2uln sn(0tlerioctatlmDelivi;()trurim3iy4omenmnviltfsrrrxmono1oexnifctasls umump;u0alerio3ta1faDr uvs;s)teur(o oy1om nmiciatfs2rmuro;o0olx moeiltlaDumn p;() rtnxr3iadfptr uvo;t0s2to(m3oodope mietls  rtaxmono1apx  ociadfa2ul(mpnu4tltrmrcoo1omt lnvo t0seur(m3iu4open nvs t  2ua(rono0tlxn fciydlmDrln sn(4tleoircoatlpte ivo t texrxm oo4ame  fvslsf Drmx pnu1tpe  ieiydls2rl(vo;(0tlxnmfciydom rai i ( texmxr3nu1om  lfetat artaxroou4aetoif3tlt m raump (4tleoxo3oy1oaD lueo ( t2tmir iudolte icsas s2rruronu4olenio3tas a2ul( p;u) exnxr3oytfpt luvslt)srtoiopoodlm nlfct s) Dtm(rp;u0tlt mfetadfm2rln p;u0tlxrxr oo1fptrliei;s)teur(o3iudoptnmicta()srumx oot4olx  f3ildla rlnvsnu4aeeomrcoa1oatr nvs;t0 ruoir oo4llee ietlsfs2tr( oot0alt ii3iysls2rau s;u0 leoif3io1fp eauvs;t)t2xmxm iy1altemfcs t sDua(rpoo0tltn i3ias a eln sn()trtoxfciatfm  lieo (0tetoimpiu4ape lnctas) Draurpou4tpxo f3iadlm ea(vpn(0 etnmociytomDeaieil( setoiopny4lm e nvtat) 2rrxmp;o4tlx  fcias a2emums (4aetoxf iydlp   uvsl( t2toir3nodamtemies t  Dtmxmoou0olx if3iltfa2ulumonu4trxnmr iy1lpt anvs (0t2xmio iodol emietl(f ruax pnu0aee  iciytfsDeauvo u)aexrxrcoatlp   n s t t2tm(rpiu4op  mfvs t)a2tmurpou1olto o3iat s el( snu4 lerir3ty1lm r n o;s)srumio3ou4optnlfetatfa2tmxr nt1oetnmf3iyd mDeaumo;u4tltrir tydoptrli il( setoxm iy4lmtelfvta(  Dtrum ;o1oeeo f3iat s elnvsnt4tetoxfctadlaDrauvil( sexmxr3iudal e icsat srtaur nt4alxn feiyt m uaumo (4texrmo3ty1fpDrliei;s) rtrio iydam emfciat  rumuronu4olx  feildfm2uluvp ()aleomo totfpDelivi;()s2xrxm3oy4amtnmicil(fs2tmx o;o4tlt ifctas a2elumo u) rxrxfcia1opt auvs ()t2ur(m3io4amenmnesas  rrmxr nu0tpen feiadlsDeluvs t4 lermr ta1optr u i t s2uriopiy1al nlfeil()s2tmu  ou1oet  fetlsla2emuvpn(4areomo3to1faD aueol()trtr(m3no1lmt lfcias srumuro;u1tpeomieilt a2ul(vp;t0 etnircoo1fa e neols)teto(m oydlpt mfvtat) Dtmurpoo1aexniociadls rm( pnt4aeenxfciadfaDrlu o;( s2xrxopnudop nmnviat)a2ra( p;t0apx moetasfs2uau pnu)alerxfciotfaDe n o ( t2xo(r3ny4oleemneils  rrmumont0aee io3iatfm raums;(0trxoio3iadomt  nvo ()t2xr(opiydamt lietat arumxro;o1aet mociysfa2rmu s t0tltoxf oa1opDelnes;s)trtriopiy1ame lieias) 2ururp;t0tptomf3tlslaDrmums;()trxomr iadfpDeanvo t0teuoio no1lptemnci ()sDtau p;t1tlen octadfs rlump ()treomocta1lp   n s ( t2um(o3oo4am  mfvta( sDra(rp;t1teenmfcilt m rmuvp;u)artoifcootfaD aies ( t2trxrpoy1lm nmiesas)srrr(  no0apxn ieias mDrlu p t4artrxr iy1lm rluvi s0seuoxm ny1am emieia(fsDur(ront4tptnmietltfaDua( snt4trtnxfctodla eaues;t) 2um(opou1op e fvt (  Drm( o;t4tpxn feiltla2emumo (4trtnxr ty1lpt ai sl() euo(o iu4lm e ncs (  2urxr ot0tlen f3ias a uaumpnu) rtoxocoodomte u ol()t2xo(o ny1om nmici t s2tax ont4oetoiictad s2uan s;(0alxrmf3oadlpDr iei s0s2xrim iu1lpe lfciat)a2rmu  ou0olxomoetasfaDuluvp;(4aetrir3tatlmDr nes t0srur(rpio4apenmiviat  Dtmum ot1oee  ieiltfs emumpn(0trtrxf3to1fmteluvsl()tetoxrpiu1amtemncsl() rrrumo;t1oltniociysla uanmp t)arxnmr iydomt  u sl()trtrxm3oydlpt lncs s s2uaxrpnt4apx mieilt s2ra(mp;t4trenifcoytlp e uvs;t t2toxm3oy4lltnlfcslt arrr(rp;u4aexn f3iys aDuan snt)tlxrmocoy1fm elu s;(0trtmxo3ou4am e nvsasfa2rr(m oo4apt  ictyt m rlnms (0artrxocta1om eaues;s0 2xr(r3nudame  ivsl()srtaump;t1apenioctyt s umnmon(4alerio tadlmDraivi ( trtmirpno1ll elnei (faDtaxmp;o4oexoio3iat aDrlnms;(4tetnir3to1oateaues;(0srtr(r3oudlp n ivils) Dtmurpoo1olen f3iytla2el( pnt4 rxomfcia1op elu o;s)trurimpiy1ape lfcil(  2uau pno0oltnmoeils s2uanms t) rtrxr iytoaDr u s;s  rtmim3ou1al e ncslt)srtm(r nu4tleo i3iad m2um(vonu0arxrxr3oydlm r ieslt0tetoio3nu1lpenmfei t)sDtmum ;t1altnmfcildla eauvs u4trenxr3tytlm  au sl(  rxmxm io4ll  lneil(faDtmumooo0alenmo3iasfm2uln o t0trermr io1fm  luvi t0 exmxo iy4lle  fvsls a2tm( p;t1apeoioctltfsDel( s (0arenmf3oo1oaDr nvs;(0s2xoxmpou1lmte fetlt)a2tmxmpot0ape ifeilt m rmn on(0aetoxr3oytom rlueo;(0setmxopnudameemfvta() Dumumooo1aptn oeiys s2el(vsnt4arxoxr oadlm  au s t)tetrir iu1lmte fvi t a2urxmp;t1texoio3iatfm ul( sn(0teerif tadomDrln ols0 rumiopny1alte ieiat  Dur(mono1alx ioeiadfa2uanvpn(0 etrmo3ta1oa ranvols0 rxrxo3iy4lptnmivilt  rraxro;t4aexn i3iasfa elumon()aeeomf oo1lmte nvo;(0s2ur(rpny4ll nlies s sDrm(  ou1tpe ifcilt mDulu p;t0tetrxr3ia1optelieolt setoxr iu4ll   fes sf ruaur ;t0aexn f3tat sDulnmsn(4 rtoircia1fptrau s;(0trxmir3oo1lmeelnei (  2tmum ;u4olenmi3tytfs umumo (4aetomf3iydomD aies;t s2xrxm no4ol nlnvta( s2trum ot1altnmoeiyt a rmu s (4trtnmrciatfmD auei t  exrxr iu4omenmncs (fsDrm(rpou4tleoioeiys s rmuvsnu4altrmo totop   ieol()t2urim3iydolt livil(fsDtr(r nt0apxnmfciatfa2rln p u0 eermr3to1laDeai i;( tetr(r3ny1op  mnvt (fsDrau pnu4alx  f3iadfm uanvs u0trxrirctytlaDelneolt  rtm(opnudlp nmietl( s2uaxrooo0ole mfeiltfa um(mon(0aeeoif3oy1oa   nesl() rtoiopnudoltemnvtl( srtmx  nt0tltnmo3ilsfaDrmn pnt4alxnif3iotla  lnvols) rtm(mpny4ll emfet ( a2tax  ;u0aexomictltfm rm(vp;u0 lenmf ta1om  li s t0setmxo3iu4openmicta( aDum(m ;u4oexoifctyd a um(mpn()tlxomf3tadfmDeai o;s trxoxopio1apen neia(f rum(r no1olx mf3iyt s2uanvo u0arxoif3ty1opte nvo;s0 rtoim3ny1olt mfes s)aDrm( o;u1tlxnioeiad sDrmumsnu)texrir iotfpDelnvs t) 2xr(o3oo1lp e ivt t s2tmxr ot0oee ii3iyt mDrauvo;t) exnxr iatoatrliei t  exrim oo4amtnlfct s) rta(rp;u0oee  ocildfmDean s u)tetnif3oy1lmDrlnes;t  2xrimpio1lmtnmfvias  Drmumoou4texnioetyslm uaumsnt4aeermf iydoa rli o t  2to(o oodole mncsa()a2tax  nt0tetnmietltla ua( o;u0alxomo o
\ No newline at end of file
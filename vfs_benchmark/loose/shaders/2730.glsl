@@ -0,0 +1 @@
+uvs t0tetmio ny1ope mfetatf Dumxm ;u1ape if3iatfa rm(mon()teermo iydopt lues s) euoxm3oo4omt  fvtlsfaDrmu  nt4apeoioeiysfa uauvp u4arerxrctydom raies;(  ruoim3ou1alte neias) Dtaxmpnu0opt  iciatlsDea( sn()artoif tytfaDe i slt t2umir iudllee nvtls a2rrxro;t1oetnmicildfa ua( o;() ltomociytomtrai o t0 2xm(m3oydlpeelncslt  Dtauroot0teeomfeiltfmDel(msnu0tltomo3io1lp eauvs;()setmxopio1openlncsl(fsrrr(roou0alxo ictysfmDul(vsnt4 lxomoctatfm eau il( s2trxmpny1op emieil() 2rmxmpoo0oet mieiaslm2ua(mo;()trerxr iodoa  lues;t)t2tmio ny4ole  nvs s) rumumo;o4aet mi3iysfsDeanmp ()aeeoifciotoa e nvil(  2uoir no1apen ivtat)aDrau p;t0aetn i3iad a2ranvo (0 etnxoctadfa ranvil( srum(r ny1lleelivsa(f 2ra(ro;o1oeeo i3ild a ea(von(0areomfciotlpteln s;t srtm(o oodopt  ictatf rta( p;u0aexo fcilsfs rm( s (0arenmr3iotlp   ivo;t0 eumxopnu1lleelict t  rrmump;o1tex mieiys s2emumo;u)altnio totfptrlnei;()setmxrpiudlpte ivta(f rrrxmoou4tlxnmfetld a2ea( s ()tltoif oydoaDe u s s0srumxopiy1om n ies t)arurxmp;o1tle  ieiasfm rl( on(4teenircoadlpDrlneo t)s2toim oo4lltelfvilsfarraum oo0oeto feiadfs ua(ms t4teermr tadlmD  ivilt)srtoxmpiudlm  mivs tfsrrrxrp;o0teeomieiyd sDulumpn(4tltrmocoo1lp   ies;(0 etoio3oydlp e ivia()s2um(m ou0ale mf3tlslsDuaums;t) etnmociy1fpteln s t)s2tmirpio4apte nvta( aDtaxmp;u4teeoii3tat s ean ont) reoxo totom rlu o s0trtrxo3oudom  lnvil()artmxrpnt1ape ioetytfa2ulumo;t0 reoifcoadlm r nei;s) 2trxmpiy1al elivsasfaDtau p;t4opt  f3iytfsDum(vpnu) eeoio iodlmDeanes (  2tr(m no1llee feiat)a2rmxr nt4olxn o3iad sDrlnmon()teenxo todfp  lueslt0srum(o ou4lm emneilt) rtm(  ot0opt if3iyt a umn s t) lermfcoytlp r n i;s)t2umir nydlle  ivias  Drmx  oo1ape mieiydfa ran s u0tlxrxr3oatoaD aneo;t)t2tm(mpio1lpte fctlt  Dur(rp;t1open o3iltlaDrl( s u4 rxomo iodfmt au sl( texo(o oydap elivt t sDuauronu1apxo ieiasla2ul(vo t0alerxo3iadlmt  i s;( trurxrpoydop eliesl(fsrraumoot4alxnmoeildfa2ranvsnu0tltrmf iotfpDe nei;()sruo(r3no1llteliviatf Dur(mp;o4tet  f3ils a rmnvo ()trerir3oy1optraivs (0 2xoirpiodolt  ietlt)sruru o;t4apxomfetysls elnmp;t4 rxnmo3ootfmtr n sls) etr(o oudome livi ( arum(  nu1tlxoioeiadfm2rlu s;u0aeeomrctatlmDeluvo t srtr(m3ou4lpe lfvtls)srtr( pou1aet  fetydfs2rlnvs u0treomr3tadfmD aueo;s seurxmpnu4am  lncsatf Drmxro;t1tpxnii3iysfs2ean p;u4aetrirctatfmDeli s;(0s2tmxm3iu4altn fvi ()sDtr( oot4alxnmoeiasla rl(vpn(0 eerio iodop eaieo;(  euoirpoudlp   icsa()a2umx ono1tpenmi3iysfa rl(ms (0 etnxo3tatfpte uvilt s2umir3oodoptemfvt ()arrm(mpno1apeoiicils m emu snt0trtoxf tadoptr ieo;s0truo(m nudll emfvias  rraxr ;o0tpx  ieiydfsDel(mo u4 reoxf3oydlptelnvsls0t2trxr3iydomen ivt (  2rmumoou1alt mi3tas s2rmu pnt4 exomocoatfmDeau i;t)seuoio3ny1apenliet (fs2tr(mpou1tpxnmo3ildlm2ulu s;()aeerxf iydfmDeaivo ( sruo(opoo4lltnlfct tfaDtr(r ou1tpxn i3iaslm2ua(von(4 etoxr oy1oa eluvsl( srxmxrpiudlmee fctl( srrru pou1olen feiytla ua( p;(4artoxf tytfptraivilt setmir3ou1llt mnetls  Drr(mp;t4alto feiytla emu p t0trxrir3ta1lat ln s;t s2uoxmpou4am  mfeils sDrmump;t1apeo oeiad mDrmnmsn(4arenif tytla  li i;s)t2toio oy4om  mnvil()arua(moou0optniietltfa2um(ms u)aetrif3todlmDraiei;()trxr(o nydlp  lneiltfaruauro;u1aetnmocilsfsDumu o ()aexomf oo1oa eanvo;s)texo(rpoo4omt lieilt srrr(rp;t1tpen f3ildlmDumu s;t)artoio iotoa eaivo;t seur(m ou4optemncilt)srrmxm ;o0tpe if3iytfs2rmumpnt0 ltoir3iadop rlu i;s) 2xrxr3ny1lp nmnei s) 2rrxm ot1tpenmoctasls2elnvs;t0tetnif iytoa  an ils0 ruoio3iodamtnlneta(fsrumu onu0aeenmiciatls umuvpnu) ltnxfciadlp r nvi s0 2xoxmpoodlmenmfcsat)artrumont1opxoiocildfm2umnmo t0aetnmfcia1om r n ols)srurio3nu1omeelfcia(  rtmu  ;t0oltnmfetydlm rlu o;t0alxoxo ootomt aueslt  ruoir iy1al  lfctls)sDrmur nu4optoiociydfsDuanmo u)aetnxo3oatomDelnesls srxrxm ny4omeelfci s)arrau o;u1aexomi3tysfm rlumo;u0alxnxr3io1lm r i olt)t2xo(o3no4omenlfcs ( a2rrxmoot1alxnmfetlsfm umnmo;()aleoxrcio1omte ivolt t2um(rpiu1lptnmieslt sDtmx  ot1teeo ocils a rauvp u0 rxrif3tatfatrauvi;( t2tmxm3oo4ale miesat  Drr(mpoo0altomicilsfsDrmums u0arxoio3io1fp  au o s)s2trim iy1omt  nesa(  Draxroou1tpxomf3iasfm emnmsnu0 lermfciytfmD au il( trtmxopoudol  lfciatfa2ua( onu1altoiiciytlm2emn s;(0texoio ty1opD  nvo;t  rumir3nudlm emfvtl() Drmu o;u4alen ieiysfs2emnvs;t4aetoxr3ty1laDe i slt) eto(o3iu4optelnci ( aDrmxmo;t0tptomi3tytfaDuauvs u) rerxf io1omDr nvs;s)srumio3nu1lp emicta(fa2raxm ou4tleniietatfa2ulu s (4 rerircoy1fm rluvs;t  2xmirpiy1ll  mivi s  Durx oot1olxo o3iasla ua(mp;(4alxrmo3iotfmDeluvi (0setm(o3ny1amtemnvsas  2ra( o;t0alt io3ildfa rln snu4tlerio tadoatelivo;s  eto(m oy4lle  fvia( srumxm oo0alx ifciatlmDua(mp ()aeeoxfcoatomtelnvo;(0sruo(opiydalen fcsas arururoot4optnmicias a2umu p;() eenmfctadlmtr i s t trumio no1oltnmicsa() 2rmump;u4texniietytfm2rln sn(4 eermrctotfaD au s t0texoxrpiudamtelivsasfa2ur(r nt1olxn ociatls2ul(mo;(4alxomr3iy1fatr ueo;(0s2tmxm oodamtnmivtls srrmurp;t0oleniociltls um(vs;t4tltnmfctotfpDeli i;(0s2triopiy1ol n fcsls)sruaxmpoo4teenmo3iyd s2emuvp;u) ltnmr3oodoatraueolt0 ruoxm3no1ame lfetltf rtru p;u4oet ii3iytfm ea(vpnu4 eenxrcoa1latr u i;t  rxrxrpny4lmenlfvt s  ruaxront0opt micils sDrm( snu)treoir3iytfmtelnvols setmxm3nu4altn ict (f rtmxmo;u0tlen octldfs2ul(vpnu)tetomfcootlmtrln s;() exrio iu1lpt mnvsat  rrm(ro;t0tltniociltls2rauvs (0altoifcootopD lies s) etmxmpnudlmeelictat  Dum(r ;o0texo i3iat s rl( p (4teeomocia1oaDr i s s0 euoimpoudlpe mnctatfaDta(  oo4oleniiciat s ean snu4texnio3oadomDrauvo t0setr(o3oodlmtn fcia(fs2tr( oou1alxnmociad m2umums t)artoio3oy1fptrlivo;t0seum(rpny1ameemfei t)aruru ono1tpt ifctat a2um( p t)aeeoxo todomD auesl( trxmxr3oo4lle  nct t) Drmxmo;t0texn oetytla2uan s t)aexrmf3oydlat  u o;()srur(r3oudalen fvtlsfa2rm(mono4tlt  ietytlsDrl(monu0arenxociadom e nesl( setrirpiy4lpt mneias s2raump;t1apxoiociasfaDra(vs u4 eenxr3oytlpteli i s sexmxr3io4ome mfvs sfs2ua(  nt0tpxoiiciyd s2elu s;() rxrir3iytopDeaiei;()t2xo(o ny4lptn fesa(  2rau  ;o1aetoifetls sDrmn p t0trxomf iytoaD aivo;t) 2urir3iu1aptnmictat) rrm( o;u1ope miciys m2elnvo;()tltrmocoatlp elneo ()tetmxo3oodlle livt t sDtmxrpnu0aeenmfeiadlmDranvsnt0alxoir ty1omt  ieslt t2toio nudlme miesat) rrrxroou1tlxnmfeiat m ulnvp u)trtomo iy1fm rlivs;()trxrio3oo1lp  mncsat  2tmu ono1apx iociatlm2um(monu0areomf3oytfp rai ils) 2um(o nu4lp  lnesls) Dumxrp;o4ape ii3iyt m ranms;t)trxomo3tytop   ieo s) 2xrxo nydal   nei s)artr( onu4alenmoetadls2ra(vpnt4 reoir3oodlmt aiei s0t2xm(o3no4lm  lnctl(fa2ua(r ;t1optnmfciasfaDranmp (0tetnir3iydlatrlivols t2xrxrpiy4oltnlfeil() Dtau pnu0oeeomictltfm eaums t)arenxo3tytoatrauei;() 2xm(m3iy4lmtnlivta(f rrru  ;t1tltomo3ils m2rm( ont) rtoxfcoytom rlivs;s0srtm(r ny4ope lfesas)srrmxrp;t1opx mfcildls2emnmonu0tltnmf iytfatrluvi t srxmirpio1am n nei s)aDraxmpot4aeenioetat s uauvpnu4aeeoxr3tatomDrauvo (  eurxrpnydaltelnvt s)a2taumoou4olxnmfeilslaDeluvpn(0arerif3oy1lpDe ueilt) eto(mpny1op   ncs sfa2umx  nt0oeeomfetatla ea(vo;t4 reomo3io1lmte ues ()t2tmim3oy4ll emfvtlt s2uaumooo1aexoifeiltfm2rmu p;(4 rtrifcta1lmD  n o;s0setmir nu4lpte feiat)srtm(r nt0apxomfeiad sDul(msnu0artnxo totlmDr uvsls truo(o3nu4lptn nvi tfarumumont1oee  ocildfa ul(mp;u)tetnif3ootfa  livo t0sexo(rpnudam  lnvt t)s2urxmp;u4oet  feilslmDumuvo (4arenxr iydoa   ies t srxo(r3oy1al elfci ( s2uaxrpou4tlen f3iytls2ran o () rtrxrciotfp e n ol( s2xo(r iu1lle  fvtls) rurxmo;u4oee  feildla2ra(vo;u4 exrxf ta1opteaiesls s2xoim3ny4op n ivi ( a2tmxronu4tetomf3tadfm2umums t)tltrifcoo1la eaiei;s0 ruoio3ny4lmt livtltf 2rruro;t1ole moetadlsDemnvpn(0 ltrmfcoytfpD ai o (  eurxr oudll nlnvsl(fsrurxm oo4tlxoiieiys a2um(vonu0teenmrcty1lm  au o (0 eur(o3oy4al emfetlsfaDrm( pou0tpxo fetadfs eln pn(4arxoxr3io1laDrlnvslt)trtoxr iu4lpe  fvsatfa2rmur oo1ale  o3iysfaDemu ont)altomf iydoaDranes s0sexmxr3iydol  mfet s s2trxrpoo4ope mi3ias s um(ms t0aeeoxf oadlaD luvsl(0srtoir oo1lm elfvia()a2raxrpoo4tlenmiciat s el( pnu4trtrmf3ta1om  livo (0t2xm(mpou4apenlfcia( a2tmum oo4apxoiociydfa2um( s;(0tlxnirctodomD luei;t)t2ur(mpny4altn iei t)s2rmxront1olx ii3iltlmDrm(vs (4arxnmocta1lpDranvs;t teurxo3oydllte fci t sDtr(mpot0olen ieiys a2rmnvp t4artrmrcoo1fpD lieolt)srurxm3nydllt lfvsat sDra( ont0tee mfetltfs2eau ont) reomfciodfm rauvol() etmxo iodape lfvia()sDua(r ot0alenmfeiatlm2el( snu) exrmfctatlp  anesls)t2umxr3nu4alenliesa( s2ur(m nu1tpxnif3ias mDrl(mo;(0 etoxo ootlpD  i i;t0srur(o3iu4ape livsatfs2uaumpou1aetomiciyt s el(von()trxrmo3tydlpD  i o;()trtoxm io4altelncs sfaDtm(mono4opxomocias aDel(vsnt) renxo3ta1lp r uei;() 2tmiopio4lp emfvi t aDrmumo;o0altnmoetadlaDemnvs t4trtnmr ootomt aueslt texmir3nu1am n icslt)arrauronu4tptnmoetat a2emnmpnu4aexrmo iytfp rlnei t  2xoio oudol e ieslt)sDua(  ;u0apto ociysfaDrlnms u)aetoio iy1la  lueils0s2uoimpoo4ap  lfes sf 2raurpou4oee iieias a ul(vo () reoifciadlp raieo;(0seurxm3nu1lmtn fcta()s2umxm nt1aex mietadfm ul(msnu) exrxo to1fmDeln i;s t2xoirpio1altelfet t) Dtr( o;u4tex ioetyt aDrluvp t4teenxr tydomtr nvil( s2uoir iydlme lneilt a2trx oou0alxn ociatfmDelump;u4teenir tytfmDr n i t teuo(o ny1optnlfvtlt sDta(mooo1apxo f3tld s2rl(mo t4tlenmo oatop   ieols0 rxo(mpoudlmee icil(fa2tm(roou1tptnmi3tls m2uan pn(4tltnir3iotlaDeaivolt)teto(mpio4ole lnci ()sDurx pou4alenioctysfa2uaums u)arerxr3iytla eau o;t0truoxrpou1op emiesat) Draurp;o0tlxnifcils s2uln pnu)aexrxr oadlmDelu s;t)s2xr(r3iydop  lncsat)a2rm(r nu1aptomi3tasla2ea( ont4trerir oytfatr ivsl(0seumxo3iu1ap nlncslt aDrmu o;t4oex iictydfm eanvs (4altrxo oo1omteaueo t0trxrio3nu1lpt lfes ( artmum nu4tpxn ociytfs2um( o;u4aexrxo3iotfpDr neo t0 rxr(r iydolen neils s2tmumpoo0aee if3taslmDrlnmon(0aeenxf iy1latrau ols0 rtoxo3iudapen iet sfs2rr(mp;t1tex mo3ils m2rm(ms;t4 rtrir iydfaD ai sl( trtrio3iu4lmtelncsas aDtr(ro;o4tlt  o3ias m eanvpn(0 eeoxr3iy1fatr u ils trxm(opoodlle lieil(fsrtmu p;o1tpxoiieiysls rlu sn(0 lxomf3oy1lmDe i s ( t2umxopoy1alt  ietlt)a2tm( o;t4tlxnmfeiasla2rmnmp;t0arxnmocoy1omtr uvo () eurxm3iodam emfcil( arumum no4tle if3ilsls2uluvp;u0 eenif3tydlaD lnvi s  2xrxopou1ape lnesl(fa2taxr ;o1tptnmo3ild mDum( on(0 rtrxr todlmD ai s (0trumxrpiu1ap  miei ( sDuaumpnu4oltomoetytla2rauvonu0trenxo3oa1lptrlivs s  rxr(m3oudale lici sfarrrx  nu0oltnmoetadfaDran pn(0 exrmfcoy1oaDe ivilt t2xo(m3ny1ll  livsa(fa2tmuroot0tpxniietltfa ua(mpnu0teenmo tatfptrai o;(0t2uoir3oy1amee icsl()sDtmx  nu1aetomf3iyd m elnmpn(0tltnmo ta1fmDrlnei;s)t2tmxopno4lleemfctl(f Dtaurpno4tle ifeiad s2rl( o t0aleoiocoadlmtrlnes;t0trxmxopoo4lm nlnct s  rumxmpoo1tlenif3ilsla2uluvo;t4 lxomf3tydlm   ivs (0t2xo(r no1lme mnei (  rum(rp;u1ope mocilt s ra( o t0aexoxr iatopD auvs;s trxoxo3no4ap elncs t sDraxm nt1apeo o3iasfmDeln sn(0tlxrif3tydopt aivslt t2trxrpiu1am e netls)aDtm(  nt4oet mi3iatlaDrmn s;() exnmf3iodlmDe ieo;(0 2xoir3nudlme mnetlsfartm(mpnt0alxn ieiytfaDrmuvs;(4alxrif3tydfmDraieo;s s2xm(rpnydam  lfciltfsrraxm ;u0oetomoetlslsDeaump t0texoxr3io1fmtrluvil()seurxopio1lptelfcsasf rrmum nu1altnmiciytfa rln s;u4 rtnmrcta1lat lu s;s) exmxopou1alt mnes tf 2uau o;u1apxnmo3tat mDua(von(4 etomo io1oaDranvs (0t2xoim oydame livsasfarrmu pnt4altnifciysfs2rlnvo;t4 ltnif3oa1la rai s;s)s2ur(m3no4ol nmfcil( sDumur oo4tpxoifciatlm2ran o;(4tetnxr oo1lpt luvi s)tetm(r nodlp nmnvias srurxr ;t4oeenmfetaslm2rlnmonu0altomfcta1opt  ieols0t2xrxr ou4omte fcia() Dum(r oo4teen f3iat m ul(msn(4areoir iy1fmtrlivs t  2tm(m3iu4omen icia()s2ta(m oo1opxo iciysfmDua(vo (4aexnmo3tytoat lneo t0texm(m3ny1ape lietlt)arrrumpnt1olxo i3iltls2rmu s ()tltoio3tytfpteai s;( srxr(rpnydame lnesatf ruaxr no0opt mfctydfa2umuvo;t0arxnxf iodla r i ol(0trxo(m ou4opeelfci ()s2uru oot0tetnio3iadlmDeln o u)aexomociydop  au o t  2trxmpnu4aleemfesl()s2rrurp;t4oetomfeiltfa2el(ms u)artnio3iotlaDr u s s teto(m3io4oltnlfetl(f 2rmxm ;u4apto ocilt a2emn o;t4 exnxfcto1fatelnvol(0 2tr(mpou4lle lnesls srrr(m ou1apt ifctlt sDuan s;t0 ltnif ty1faD  i i;t)sruoir3oo1ope mfvi tf 2uaumo;u4aex mo3tldfaDua( snt)tltnmr oytoptr n i (0t2um(r oudomenmnvtatf Dtau p;o1oetnmfctad a ul(vont)aeenxf iy1la  lnvo;s  2tm(rpiy4ope  ncia( s2urxmp;u4olxnmf3iadls2umn o;t4artrmfcoo1lmteluei (0 2umim iudlptnmnvt t)srumumo;u1texn fctadls eln onu4arerxr tatop  ln o t)sexrxo io1lpte fvi s)s2tm(m no0tpx  i3taslaDrl(vs;t4aetomo tadfmDeli ils)t2trir ou1am  mici ( a2umu  ou4olxoif3iytfm el( o;(4 ltrir oydla r nvols) eum(m3nydol e fctatfaDtr(m nu0apxomo3tas m2rmnvp ()alxomr3tatoa ranei;(0t2uoim3iodomtemfcsl( a2rrxmpot1tetnmfctytfsDeluvp;u4texomrcio1lm eln o;s) eum(r oudol elnetl(fsrrrurpnt4alxn ictlt s emumsnu0alerio3iatlmDrau o;()trtm(rpiu4ome mfet t srtm(m oo0tpx  icias aDumums;(0aexoir3tadomte ieo;( texo(mpoo1amenlivsa(f Dtmumoou0tlx mi3iatfaDrlu o;u)trtnir oadlaD luvslt  rtmim ny1omt livt s sDtmumont0aetn feild aDemuvont4trerxr oydomt aivsls) exmxm3iy1omee nctat  rrmump;t4tptomo3iatlaDrlumsnu0tetrxo3oo1lp   nvils  etrio3nydapee neias  rrau o;u1ape iociltlm2ranvo u)teeomr oodlpDe neols0trxr(o3iu1lpe mnvs sf 2urxro;o1alt mfciad mDean snt)texrir3tadfpDrai s;()trtoxrpoodalt  nesat)sDrru pou4optoiieiat a rm(mp;u0altnir3totopt au sl(0setoxr3nudopt mncsatf 2tmu pno4tlxnioetysla eluvsn()alxnio3iotfaD aieils seur(o3nydope lnvsls)aDtm(m ;t0alx  oeiatfs eau o t4 etomf ta1oateli s t)setmimpoydamenmnci ()sDtmur ot4opxnmfetaslsDuaumont) exrir oo1omtrli il( setm(rpnu4omte fet ()a2tr(ront1tpxnif3tatlm rmn o;(0 reoio todop r ueo;s  etr(r iudam n nciat s2ra( o;u4olxn i3tad m2rlumonu0 exrircoa1fpt ln i t texoxm3nu1alen fcs (  2tmx p;o4oetn oetys a elu s u)aetomr3tytlpte n s ()trtm(m nu1ll e fct sfsDtmxrpoo1tlxniicildfa ra(mo;t) exnmr3oo1fmDeaieil(0 2urirpiodll n iei ( a2ta( pnt1aetomo3tasla uluvs t)artnio oa1oat au s;(0t2xrir3nodom n nvsl( a2umxmp;u0alx mfeiadfa ua( s t) lxoif oytomD  n s;s0 eumimpoudol   fetl() 2um(ront1tetnmiciaslm2um(mp;(0arxomo3iadoaDranvo;t  2xrim iudam e ieil(faruaxm no4teenmo3iltla rlnmp;t4 ltnxfcoy1fp rauvo s  rxmim ou4ole  fci (  Dumxm ot4apto fctydla rmnmo;u0altoxoctotoa rauei;t) etmxo3oo4omt lnvt s  rrmx pou0alt ioetatfa2rauvsn()tltrio3oa1omD  u slt0 eto(o iodll  mncsat)aDtmum ;t4oetnmictld s emu p;t0tlxoxr tydoaD luvi s trxoimpnodom elfcia( aDta(r ;o1aeto ociytfa2uanms t0alenmr ta1fmDeanvo;(0 exrim nydom emivi t) Dumxmo;t0texomieiys a eauvs ()trerxr oatop e n s;()srxm(o no1omte fesas)sDtrxr oo1tpenmoctydls um(ms;t0trxnif3tydfpDelies;()srtrxrpio4ameelfetl()aDtru o;o4oleo i3tls s2uluvsn(4 rtnxf to1fpDe ies;(0 rxrir3iy4ol elncsl(faDtaxmont0tleomfciydlm uaumsn(4alenifciytlmteln i;s  rtmiopny1altelivs s) Drr(mpnu1tlxniicilsfs2um(ms;u4tleomf iotlpD an ol(  exr(opnodlmenlnci tf 2raum ot0aptn oeildfa2rluvo u) rtnio to1lm  ai o;()srxmxmpny1alenmfcsas a2rmxmooo0oex moeiytfa uln s ()aeenmrciytfaDe i o;t t2urxopio1om nmncilt  rtaump;u4apxoii3iatlsDulu s t)aleriociadfpD  u s t0srurio3iy1amte feil() rra( pno4tex io3iad s rmuvo u)tltrircoydlmtrluvi;t)srxrxr3iu4omee ivi (f 2um(mo;u4apen fctyd mDelu snu) lxnxr3oy1fpD luei ()srurxo oydolt lfci (fa2ra(m ;o4texniiciadfa um(mo t) rxrmo3ty1la ran o t)s2tmxm3ou1lp nmfesl(f 2ra(mo;t1oeenmicilsfaDra(vsnu0aeeoxociotfa  ln ilt)teur(opiu1olt lici t) 2raxro;o4tet  iciaslaDrln pn() rxnxf tadfpDr u ol(0teuoio nu4oltemfvi s) rrmxmono0alt mictys m ua( s t)tlermo3tatoaD  u sls0 2xr(r oy1ome  ivt t aDtm(r nu1tle ifeild a rl(ms t0tltrxr ty1lm  li o s) ruoxo iy1amtnmictlsfs2ua(r nt0tpe  o3tlsfm ulu sn(4 eeoxfcia1lateau s s)tetrxo io4lltnmnviat)artrxrp;u4openif3tls sDum( pnt) rxoxf3to1fa elu i;s texm(r iudlpee ivt ( sDtmxmp;o1apt iiciydfs2emuvon(4tlxoirctodlpD luvils)truoxo nudapt  fet t sDtmxrpnt4teto fcias aDelumsnt4 rtoxr3ootfmD  nesl()texrim3no4opt  nvsas)srrmxmp;u4alxoio3tad a ra(vs t0arxoio3oadopt li olt  rxmxo3oo1omtnmfvt t)a2tmur ;o0oeto o3iadls emn onu0 rxrxf3iydfp ranesls)t2umiopnu4lptnlfvtat a2umurp;u4tee  fetldfm eanvpn(4 lxoxf iy1laD  i o s0 etmxrpno1aptnmneilsfsrua( p;o0tpxniieiydfm rm( s t0trxrxr ty1fm e neo;()srxrxopny4altn ivs t  2uau o;t0tlen ieiat a2em( snu0 lxnxo3oa1lm elneil(0sexmxr io4lmte fci sfaDumxrpou0aet mieiadfm ul(mp (4tltrmo iotopDraueslt)texmxr oo4lp elivslt) 2tau o;u1tet mieildls ea(von()arxrir oydlpte u i s) etrxm3nodamenmnvsl(fa2um(mpoo1apxomi3tys m2rluvsnt4trtnircoydla rln i s trtoxrpiudlle livil(f rraur ot1tle mf3iysfa emn o u4trtrxr3tytfp r ivs;t) eumxm3nudlm nmnetls  Dumxm ;t4tlenio3iltls umuvs u0 lxoif iydfate u il() rur(mpiodal e net s)aDtauro;t4oetnmfciys sDrau p (4 exrxf io1la elnvi s0 ruoxm3nu4ol nlnvsl(  rururo;o4tetnmf3ild s rl(vs u)tltrmocio1fa   i i;s0 exmio3iy1ole lietas arua(mo;o4opxomictls m2rlu s t)tltnxfctydopteai i;( s2tmirpoodlleelivtlsfs2rau  ;o4oexo icilsfs2rlnvo;u0aetrxf3oy1lpt aneo s0 exo(mpnu1lp emfeia() Dta(ront0aetnmieiatla elump;t)treoxf3tydfpDrlu s s0srxrxopoy1aptnmnci s sruau onu0tptnioeildfs2elu s (4altrxf3iotlat auvils)t2tr(m3oudal  mnvsl(f Dur( p;t0opxnif3iatlm ulu s;u4aexomr tydopDelies s seuo(rpoydal   nvs sfa2ra( ont4tetomieiatfaDemu p;(0 exoxf oadlm  ln s;s0srxm(mpoo1ll  mivi ()s2taumoot4aexo i3tyt s2uauvpnt)arxrir oydfatelivi;t) rxmir3nudapeelieia()a2tmx pou4oltnmi3tlsfmDea( o;t) etnxocty1lmteluesls) 2ur(o oodaltnlnvsa()s2rrurpno0tltomi3iadlsDem(vs;t4aeenmf iydlmD  nvo t)s2to(mpoo1opt mieias)srrm(  ;t0optn ieils aDulump u4 reoir oytomDrlieo;(  2xmirpiy4alt lfcs (fa2rmxmooo4openmoctltfaDuauvp (0 exnif oytomD au s;(0s2um(mpiu4ape lfet t) 2uru o;o4olenioeiytla rm(vonu0tetnxrctadlmDraivols srumxrpiydamtn nesl(  2tauro;u0olto octadfa2ra(mp t4tltnir3iadlmDraiei ( trxm(r nu1lltemfvs t  Dtmxmo;o0ape moetyt mDua(vp;t0 exomf3tydopD lues (0 exrxr3iy4lmenmfeiltfsrururpot0tlxo fetatlm rl(msnt0 rtrxrcoa1op  ln o;s trtrio3iy1lpt livi s)sDurumono0opto i3iad mDrlu s;u0trtoxf3iatomDeaivo s s2umim3oo4omee fvt (fa2rm(m ot4aexnio3iyt m umumsnu) leoif totoat aivi;t0texrxr oy1ome lfeils)aDuaxr ;t0apxn fciatls elnms u0tlerxr ty1fmteln slt) rxo(r oo1lltnmictl()s2um(m ;o4oltnmfeilslm eaumo u4alerir3to1oa e ies t0trtoxo iodap  livtat  Duaxr nu4tetniociys sDulnvpn(4tlxrir io1fpDeaiei;t)trurxrpiydll elnesas  rraumo;t4alxoiictyd m2rlumo;t4 eenmr ootoateauvo;s) eur(rpnodapt  fci tf Draumoot1olxnif3tasfa rm(ms t)tetrxr3totlatrli o (0srxr(o3no1omt  fvsas  rrmum nu1apenmieildla2uaums;()aexrmr iydfat  ieil() rurimpnydaptnlfet tfaruaxrono1alxoifciad sDelnmpnt4aeeomfciatfa raivs;s  etrxo iudlp nmneta(faDua( ono4apto o3iyd a2rmn s;u0tlxoio3iadfm eaueo;t0t2toxopno4om emnes t a2ur(  ;u0aeeo ieildfs2rlumsnt4 rtrif3to1op   nei t) 2toiopoy1oltnmicia(  rumu onu0teen oeiyd aDumnmo t0 leomo oadoa e ivi (0srxmxr3iydllt mivt ()artau oot4tleo feiytlm2rauvonu0aeeoifctydlmt aivslt)srumxr3oy1olt lfvt s arrauro;o0tlen octlsfm2ea(vo (4tltoxo3oydfp elueo t0sexmir3iy4olen nes sfa2umu p;u4tpxoiictadla2ul(mo u) ltoifciotlpteaueo;t0 2uo(o oudom nmiviat) 2tau poo0apeo i3ilt a ranmp;(0alxomf ty1fa r ivo;(0srtmir3oodomt mnvtl( srtaxmoou4aet  ociyd s ra( o t0aexnif io1laDr ieilt)t2ur(rpoodaptelfvilt)srrmu  ;t1opxoiicild a2eanmonu) rxrxr3ia1fmtrli sls)s2trir no4llt lici () rrm(rp;t4alenmi3iyt mDeln s t4teeomr iodfpDe uvo;(  2xo(o3iu4omtn fei () 2umumpnu4apenmoeiat m2rln sn()trtnir iotoaDrlieils  2tr(o3io1am nmnesl( a2ra(mpnu0tpx mociydlaDrau o;(0 leniocta1la  lu il() rurir3oydamt  fesas a2raurpnu0aetn o3tatlsDea(mpn(0arermrctatfa   neol(0t2xmiopiydapenlieta()s2uau poo1alt if3iat s uanmo u) rerif oadom rlu sl( teumxr3oy4ameemiciltf Drr(mo;o4oet ifeiatfm2eaumo ()aexrxrcoy1fmte ueo () rtrxopoy4optnlnci t)srtr(moot0tlxoio3tytlmDem(vp (4aeeniocoa1optrln ol()tetoim nydoltn nvt s)srraxmo;o4tpxoii3tlslaDuaumpn(4texnir3oy1fm eau s;s t2xm(mpiu4aptelnvi (farurx poo0tlt ifeiltls ulump (0trxnmf iatoa rlnvi;()s2tmio3ny4al elnviatfa2ua( ooo0apeoif3iysfs em(mon(4aexnifciodopD luvo () 2tm(r3oodolen fvt t a2rmxro;o0aex mf3tysfsDeln snu0treoir3ia1op eaneo (0trxo(m3nudlltnmfcsa(  2urxr ;t0tet iictat s2rm( pn(4 lxrmfciatfpDrai o;( trxo(r3nu4apen fei () 2rrum no1olxn iciadfmDulnm
\ No newline at end of file
@@ -0,0 +1 @@
+nvs (0tetrir ou1aleemivsatfs2tmxmpou4oetnmoetlsfsDumumsnu4alermfcto1op r uvol( tetoxrpnudal n fvsat) Dum(ro;u1oex moeiadlm2elu snt)alxomfctatlpDeanvi s0trtmir oy4ap n neia( arrrxrpou4tle ifeiys aDum( s t) etrmf iatlm eanvi t t2toxm3iydlpe mnvia( srtm(mpnu4tlt ioeildfs rm(vsnt4aeenio3iodfp e nei ()t2umim iodalen nvsa()aDrmurpot4oeen o3iatfsDuanmp;u) rtoxr tadfmD aiei;s seumxr io1alte nctat a2rrx ont0tex  ictltls2ra(vo;u0 rtomf ty1faDelueilt srxm(mpoy4opeemneiasfa2raur ;t1tlen icildlaDrl(vs;u)alxnif oatfptelu ilt0sruoxm ou1amenmfesas  Dta(m ;o4ope mfciysfm um( p t4texrxo3oa1fp r u olt)teurxmpiy4lpenlnciatfaDrau  ;o0ope  ocildla rluvsn(4 etnif ootlm eau ilt)sruoiopny4lmtnlnct t a2ur( p;t0openiictyt m ea(mp;u4trenifctadoaD luvsls)texoio oydlmt  iesa() Dtru o;t0aetomf3iyslsDemn sn() eeoif tadfa  auvo;t)t2xrir iodaltnmictat)sDurxm oo4oetoifetysla2ulnvpnt)trxnxf iadoatelnvi;(0t2umio3oo4alt livi s)aDumu pnt0opt  i3iysla2rlu ont)trtrmf totlmD  uvsl(0setm(m3no1omtnmneia(fa2tmxrp;t1texomoeiysfsDrauvo;()artrxo3ta1fmtrlu s s0srxoxo oy1altelicta()srua(mo;u4tpt mietldls2ulnvon()teerio3iatoa   ues t0 etoimpnu1lmt  iesa( arrmuronu4tpx iocias a umn p;u) ltnmf iy1oaDe i o t)t2xoio oo4alee fet sfs2uax pno1ale  ietys mDrl( p t4arxrmrcty1fm r ues;s)teumirpoudam nlfcs t  2tmumo;o0tpe ii3iat m2rlnmp ()aeerxo iodlate uei s0s2trxm nu1apt  fvs t  Durx ono0tptoif3tlt m2ra(vp;t) ltrmf to1omtr i i;s)teuoirpoo4olt mnvs ()a2raumpnt4apxnif3tltlaDumuvo (0 leomo3tatlptr nvs s)srtm(m3oo1alt mfvtls) Drrumont0texnmf3tys m2eau sn(4texrmo3oadop elivo;t) eto(mpny4ll nmfcias)s2uau p;t4oet  i3ilsfa2elumo u4altoio oodfm rau o;s s2toxo iydome mnviat a2urum ot4oet mi3iydfsDul(vo t4 eenmf iotlaDeau s;t)t2umimpoydlptnlfcsltf 2umxrpno1opxo o3iydla uanmo;u4tltoifcoodoatr iei s)teumxmpoy1lptemfcias)aDumumont1opto ieias aDuaumo;u)arxrir3oatoptrlueils0t2xmxr oodlm n fesat)arurumono4apxnio3tydlmDrmu pnt)trenmf tatlpte uvs t) 2uo(o3iu1lmtnmfetl( aDumx pot0tltnifetytfm2ra( s u0altnir oadom rlneolt  exr(m iy1op elnct s a2rrx oot1altn octas a2umu snu0texoiocia1opDeai i (0tetoio iudlle  ict ( artr( o;u1opxnifcils s el( ont4 lxoxo3tydlp rli olt0 2xrim3nydap n netls)sDrr( pnt1tetnioeiasfs eaumpn() rxrxfctodlaDeau ils)t2tmxm3oy4oltelfcs () rrm(rpou0altomfetas a um( snu4 rxnmf oo1lpDe n ils0t2trim io4opt mnvtat)sDra(m ;t4aetoiiciatla2eanmsn()alxomociy1fptrau ols)t2uoxrpiodlp emivtls) ruaxmo;t1tleoioeiadfs raump t) rtnmf3tadfatrlneilt0truoio oo1aleelfvtat) rtr(rpot1ole mfetadfm rlump u0 exoio oodomDelieil( t2tmio ny1ll emivil(  Draurp;u1alxo ieiat aDum( onu0 ltrxf ta1lmDranei ()t2xrir ou4lm nmfctatfs2um( oot4aetn f3tlt aDeaumonu0arenmrciotfa  au s s) euoirpoo1aptnmicsat a2umxm ;u1aexn i3iat aDemumsn()trtnif3oatlatrlnes t) rur(rpnodalen nvia(  rrm(mpot4ape ifctlsfa2umnvs;(0texrxr3iydlmDraieo;( srtmio oo4lpt livilsfsDua(  no4tex  fctld s eaumpnt)arxrxocoo1lm   nvs s  rur(m oudome  fesltfa2tmxrpnu4tlxo o3iasfmDumnvsnu) rtomfcta1fpteli o;t seuo(m3iudalenmies s s2ua(rpno4aleo fctydfaDumuvon(0 rxnifcoa1lm eaiei ()setoim3no4omte nei s) Durumpnu4oeeo f3tyd m2uan snt)areoif oy1fpteauvo;s)t2uoim iodlpte nvi t  Dumur ot4oeenmfetadfaDrmnms;t4texnmfcoadfpD  n i (0s2uo(r3ou1ll n iei () rrmxmp;o4teeoiictys aDemnvp t)areoxf totlat lueo;s0seuoiopoo4omee ivs tfsDtrumpnt4oeeomo3ias m2eanvpn(0 rerxr oa1fp   neol(0trtr(o iydalt mivt tfarrrx oou4aexnifciydla emnvsn() lxomf tadoptrlu s;(0tetmxm iy1ap  mnct (faDuaxmpno4aetomietatls eauvsnu0aetrmo3iotfa  anvilt)setrirpiodop emics s s2tmum oo1apto f3iyd mDrl(ms () rerxfcoa1lm r u ils trxrio iy4lltnmieils) 2rm(mpnu4tlt mo3ias a2ra(vpn()texnifcia1fat lieo s)trxoxo iu1lm  lncsas) 2taurono0aetniocild sDua(mo u4teeoircto1omDelueo;t texoirpou1ape mfcilt sDur(m ou1opxn i3ilt aDeln onu4 rxoio3tytfmDrlu o t0t2xo(o nodlmtn fci ( artaumo;t4olx  fetys s rm(ms;u)altnxo3iotlpD ai i s0 etrxmpio1lpt livs t)arrr(r ;o1tpxnio3tytfaDrm( snu)trermr tadopD  nvilt srxm(o no4apt  iet (fsrtm( p;o4ope moctatla2uauvp () etrmrcootlmDeluei s  2tmiopnu4oleelnvsas artm( pnt0ape  oeilt a2elumo () renxo to1omteaueils0seurxrpnu1optemfcils a2trx pnu4tlt mo3tasfm2rlump;()aexomf3oytfpDelieol( trxmio oy4om nmfcias  rumu onu0olen o3ild s ua(mp;t) etnmf3oodoaD  ueils0 2xm(m iudlpen iet s  rrru  ;o0oetnif3ildfsDea(vonu)texnmfcta1fptrli ols0s2umxr3oo1optelivta( aDtmxrpno0tet mo3iyt s2ranvsnt0altrmo3oa1fptraueol(0 rtrxm oodal n neil(fa2uaxr ;t4opx mf3iat a eluvsn(4 rtoif ty1op rlieols0setmim iy1optnlfeta(  2rrum ;t0tex  ociltfs eanvsn()teeomf3oa1fmDe i il(0srtmir ou1ap emivil(f Drm(r ;o0tle  o3ilsfa2emnmp;()aexnmfcoo1oa eli o t)s2umiopoy1lptnlfcia(fartr( pnu4tle mietaslm2eanvp t0trxnir iadoa ranvo;s0teuoio3iodlp emnvsatf Dtm(mp;t0tpxoiicildls ulnvonu4aeerif3iodfmt lueols0 eumxopno4omtnmfvsl()sDum(m nu4optnmfeiad a rauvpnu0artomf oadfaDeau ols)s2urio oudomtn neiasfaDrrumo;u0tpt  feiltfsDeauvo (4altoxfciatlatranei t0texo(r3oo4amtnlneil( artrumpot0optnifctlsla2rlu s;t4 etoxo iotlat  uvi;s) 2xrxo3iudolt mnvil()s2rm(mpot1opeomfeiysfs rauvp t4trxrio iatlaDrln il()t2tm(r ou1altelietltf rraxm no1alxnioeiatla rau p u0 ltrir totlaDe ies (0s2uoxr3iodlmeelneilsfs2rrur ou4open i3iydfm2ra(msnu4artnxfcoo1oa   ues s0s2xoxo3iy1ol   fci t a2rr(mont1oltn ictat mDrl(msnu4trxrif3iytfm ran i (0truo(mpoydoptn ncsatf Drrur ou1tlto octyslm2ul(vont)teeoir tydoatelnes;( s2trim oydapte ivtl(f 2taum ;u1tee  fciydfs2ran o;(0aexoxr ia1fpDraueilt) rurxrpnodomtemicil()artmumont4alxo oeildls uanvo;t4 lxnmrcootla rlues;() 2toxr3io4altnlnci ( aruru pou0aptoiociyt s2rmu p;t0 exoif3ia1lptraivi;s  etoxo nu4lleelfei s srumum ;t1tpxnii3ilt s ua(vo;(4texnir iadopteaiei t teuo(m oy4omtn icias s2rmx  ou0aex mo3iatlsDean o;u) exoif iydlm eai o;s0 2urir nydalenmfcs ()aDua(  ou0tex ifetytla2uanvp t) lxnxocoytop r ivols)teumxr nodopte ivil(f 2rmxrp;o1aexomietasla2ranvo;(4 etoxo tadfmD  ivilt) etrir iodaltelivsls) Dtmxr ot1oeeomociltfsDumnmp u4trerio to1om eluvi;t0s2umiopiodll e fvi tf rtax pot0texnmf3tytfa2ra( s (4 leoirciytlm  anvi ()tetmio no4ole mnct (fsDrmuro;t4tlx iieiltfmDrmn s;u4 rxrmr3ty1fp eli il(0srumir3nu1aptn nvtas srtrx pou0texoioctlt s raums u0 lxnio iatomt anvi ( seuo(m io1ale  nvsl( sruaurpot1alx ii3ilt a elump (4tlerif3oatoat aneo () 2urirpny4apen fesa( s2taumont1apxomociatla2umumpnu)tlxoirciadoaD  ivi;t0seuoir3oydom nlnetat  2urx  ot4oetnmi3tls aDrluvont0 reomr to1fat lnvolt0 eurxrpnydal e feta(  rraxrp;u1alxnifetls m2ran p;t0 eeniociydfm   uvi t)s2xm(mpiu4lpt lfvi s srrru  nu4oex  feiadls rm(vo;u0 lenxr3tytfptr uvsl() rxoxo nudale miet t) 2rmu pou1oexnifeiasfa2ran on()tetoxr ta1lp eli s;t0 rxr(rpnodlltnmiesasfaDtrurooo4apxo ociltlmDraumo t) renio3ootfpteluvol(0setoiopio4opeelnesas  Dtaur ;o4tpx  ocild mDeanmo;t0 ltnir todfaD auesl()setrim oy1olt  ivslt)s2rr(m nt4alxo feiysfmDua(ms;t0 rxnio3totlp ranvilt)sexoiopou1ap eliesltf 2umur ;t1tex ioeiad sDuauvs u4trxrmf iotom  au i ()tetmim oydap nlics tfsruax oot0tltn f3iltlm2eln on(4 rermo3ta1latraues (0 etoxmpoo4lm n ies s  rrm(mpou4apxo ietaslmDelumo t4artrmo io1lp ean ils trxr(r io1lle miviltf Dtaum nu1tle ifeiyt mDulums u0teerxrcoa1omDr u ilt trtr(o iu4ole mfct ( aDta(r ou1tpeo fctadla2elnvo t4 rtnmfctotoat luvils0trxoxr oodale  ivsls) Dta(moot0tpxo oeiatlmDemn o;u0alenmf3ootlatelieol( t2uo(o3nu4llenmfeslt) 2raxr oo1aexoiocildlmDelump t0tlxrmfciy1latr nei;t0t2tr(r3iydalee fesl(fs2urumonu4oleomietaslmDrlnmp;t4 leomf todfpD lnvols)texrir3oo4lpt  fcs t srtm( pot1opxomiciadlm ra(vp;t4 lxoxociydfpDraues s s2uoio nydalen ivsls) 2rmumo;u0tpxomfeiys a rau p (4alxrmr totfatranes;()srtmim no4om nmfvtatfa2taxrooo4apxnmoeiltlsDelu o u4aexnxf3iodom elneilt0teumirpiu1lmtnlfesa( a2ur(ront4tpx  f3iad s rlnmp;(0aetrir oa1fmD luvo s  2um(o oodal emics s  Drm(mpnt0tptoii3tlt a ul(vp;()tleomfcia1omt an s s0trxo(r3iudlmte neias) rrrumont1ole mi3tyslmDuau o;u0alerxo3iy1oa  lnei;t0 rtrxm io1alt livil(fsrumx pnt0alx mi3tld m rlnmp;t0trerxf3ia1omDrau i t  rxmxrpoudoltnlivs (  rtax oot0ope  fctatls2umnms;u4trtrirctotoate ivs t0 eurxo3oudom   ivsas) 2rax  ;u0tltnmietlsfs uluvsn() rtoxf oa1op  lieil( texr(r oodomte icta(f 2rmuro;t4tee mieiat sDelump;(0tetnir3iydop   i o;s) etrxm iudlltn fes tfarururont1tpeomieiaslsDemnmo t4 etrmf oatom r uvs s0s2to(o3iy4lp nlfeslt aDra( o;u1tet  oeils mDran snu4tltrxr oo1lm   ivols0t2trimpiu1lpenmfvils aDra(mpou4opxnmf3ilsfa ranmp;(0artrmf3iytoa e ues s0trxr(m3nu4op emfcias s2taur nt0apxomietldfa rm( on()tetrir3iytfmDeanvi ( texmir iy4aptnmivilsfartmx o;o1aexomf3iyd a2ra(ms ()aleoxrcty1lp  lueils) ruoim3nu4alen iet (f rrrur ou4aetnmfeiatls umnvp;t0 leomr3ia1laD lu i s srxrio3iy1lp emfvtl(f Duaumpnt1tpto f3iatfm2eanmsnu0artnir ootfptranes t0 rxr(r3iy4opt lfvi t)aDtmxmonu4alxn feiadfsDelnvs;u0tlenxocoatomtr ieo;s0 exrir3ou4lp nlfeias)arumxmp;u4aet  i3iysfm ul(mo u) renir3totlptelues (  etoxr no1lmtelncia()srrrxrooo0ope  o3ildfs elu onu0alenmrcto1lptrlu o;t)trtrxo3oo1ap n fvtl(fs2tmx o;o0aee io3iatfa2el( p;u)trxnxr3iy1fpDean i;s)t2xrir3iy4apt lictls s2taump;u1apx mietyslaDelnms;u4 leoxf3oatlpt  iesls0s2xo(m ny4ope lfci (fa2umxmp;o4tptomictlt a2ra(ms;()aexnir3tatfmDe i ols)teuoxm no4lptelneias)a2rauroot1oexnio3tltfa2eln o ()trermo3oytlm ran i;(  2xm(m nydlleelnvt () Dtrumont1oeeo oeiad a2rln o;u) eenmr3tytfmDr i i;t0setoxm nu4apt mies s)s2rrurpno1opeo ociysls2rln s t4 eerxr3iytfa  luvs t0s2trxo3iodom   feils sruaum oo4texoii3tld m2ra( s;()aexoxf3ty1fpt  ies;s)trxoxm oydamtnmfei t sDtrump;t4aee  fcilt m emn snu0 rtoxf iadopte ueo;s) exrxo io1altemfeils artaurpnt1aet mfciadfm ra(vs;t4 lenio3iydfaDrlneo ()trxmxopnu4lpte netls)aDumuro;t4apxn oetlsfmDum(mp (0aleomo tatomt an o s)t2xr(mpoo4ol e nci s)sDrm( poo1olto feiatfs2umumpn(0 rerxr3tatfptrlivs;(0srtrio iy1ol nlfesa(fa2trx ono0oleo o3ias a2rmums u)artrif3oytlpD lnvi;t0 ruoir3ny1ol n nct s)a2raurp;t1tlxn octysfa2um(vo u0aleoxo3oy1fmDran i t0t2tm(o3ny1ope  fvtasfartm(  ot4tpe  fctlsfs umumsn(0 exrif3oadfm rlieilt0t2urxopou1apeelfvsa()sDrm(r ;o4oet  f3iasls ul(vonu0tetoxr oy1lmDeanvo ()srur(m3nydlpt mivtl(faDumxrpno1tpxnmi3tydlsDemn p u)altnxr ia1omt ln i (  etriopoodlle  ivsasfs2rmurooo0alt mo3iytfa2ulu p () exrmocootfa  anes s setmxm3io4lptemicsls) 2tax pnu0altoii3tltfa em(mp;t4teermf iotopt aiei;(0 exoim nudlm emfcsat s2ra( poo0oeeo iciysls umums;u4altrmf totoaDran ol() rtrio io4ol  mici ( sDuaumpnt0oee if3iydla ua( p;u)altoxfcoodlmtelivi (  2trxo oo4omtn fcia()aDraxmo;t4olen oeiytfmDuln s u0trerio ootoateln s (0 rurxr3iudal nlfvil(  Drmxr ;o1olx mf3ilsla2emnvsnt4 reoxf ty1lmDe nes s0t2xrim3iu1lptnmnctl( a2tr(m ;u1ole  o3iad a rau o;(4arxomr3to1lmDrlivol(0teur(o nu4lltnlfeias aDuaum nu1aptoiiciydfsDra( snu0trtrir3oytla   nvo;( s2toimpny1llenlneils a2ua(r ;t1oexniiciad mDemnmo (0trtomf3ta1om r i sls  etoxm nodlm nlneiat arrm(rono1oeeo f3iydfm2ra(mo;(0 eerxo3tydlat  iei t)seur(m3ou1lpen icsas)s2tr(mpnu0opx miciydlm2em( p (0 ltrmr3tatoa  lieo s)sexmxm iy4ol nmivt (  Duaum no1oet io3iydlm umumo;t0tetrif3ta1fateaiesls)sexmim3oo1lmt  ieiat)s2rmxm ;t0aex  ictysla2uaumpn(0trxnircoa1oaDeauvilt  exr(m ou4omte ncs t)aDraumooo4aetn fctatls2em(mp;(4 rtrmr to1oaD lnvo;t) rxmxopoy1ome lfctls artmxrpno1teto fcildfs2ran s u4texrmr ty1latrlueslt0 rurio3ou1apeemfeslt)s2rau o;t4aetomf3iyd mDulu onu0tlerxo3todfp  aueols) 2tm(r3iu1lmeelfei s)srumum ;u0tlxomieiyt s2uaumpnt0alxoio3iotfpDr u o;(0texrio oo1ll  lies sfsrtaumo;u0oex  iciat s2ra(monu0arerifcta1omte nes;t0 etrxo3oy1altelnvi tf rurxrpnu0texo f3ildlsDel(vsnu0alermo3iotfmteaiesls  rtr(r3oo1ll n ivil(fsrrau  nt4teeomo3iytfs eluvs t4tltoio ootfaDeauvs s trtrim3no1om   ncias) rumu  oo4oltnmfeilt mDua( p u4 etnmrcto1opDe i sl() 2xrim ou4amenmnvi tfaDraurpnt1oltniietltlsDeanvp t4 rxrmo3ty1optr u i;t)sexm(m no4lp emfei t aDuaumonu4oetn f3iysfsDum(vs (4 ltnif3iytlmte nes;() 2umxr3oo4lmee ict tfs2ta(  ;u0texoii3tadfmDul( p t0arermf iodfpt an s;()srtm(m iudlptelnvs s s2rrx pou0tex  o3iatfmDranvpnu)arxnmo tatlmD aivi;(  rtoimpiydaptnmncilsf Drrx pnu0ape mfciyd m rlnmo u)trxomocoo1omDelnes;t  eurio3nydolte ici s) 2ur( o;o1tlx if3iat s2um(mo;()texrxr iy1opteauvi ()s2xoim oo1lptnmncil(  rta(rpno4aptnii3iytfs2ea(vs;t0aeerifcoy1omD  uvo ( s2toio3oy1lltnlictls arta(mo;o1tleo feiatls2elu s u0 lenio iotfmteanes ( truo(o iu1om  mfvsl(fa2uau ooo1altoifeiat s2rauvsnu0arxnif tydop   ieo;t0teuo(m ny4olt licta(f Dtmum ;o1opx mieiadfa2ranmo u)aexnio ty1fa ranvolt0 rtmimpny1ameemfctl(fsrraxronu1ole mietysfm em(von(4arxoxocoa1fm   iei;t)t2tr(o3ny4opt mnvi tfs2urum nu0tpxnioeiytlsDumnms;(4tlerxfciydomD  neo;t) 2um(o iy1am elfesls a2tax o;u1tleoifciat sDrlumsnu0trerxf3oy1fpD  nvo;t srxo(rpnodll nlnesl( sDurxmpot0olenmi3iatla2em( o;t4 reomrcoadfpD an o;t seto(mpno4ol nmivtls aDrm( pnt4tptniictld a elu s (4trtoxo iotfaDr neil(0teumxo iydlmt mfvs t) rumurpnu4alxn f3ildlm2rauvs (0artriocootlmtr nvi;(0s2xrio3ou4apen fes s artaxrp;u0oltnif3iad mDuan p (4aetrxfctadfpD  ues;s  2umir ny4lp e fet (farrax p;o4olenii3tytfaDem( o;t0trxrifcoytomDeau o;t)srtoio io1om   ivia(faDrr(m nt0oeeoioetld sDum(mo;u4tltnxf3iy1fp  luvo;s)trtr(mpiudalt  fvilt)artmur ot4oetoifeiyd s raumpnt0 exoxociydlpteaneo;s s2umim iydom  mict ()a2tr(m ;u1tpenmi3iad a rlnmo;u0 ltoif3iytoa elivi (  rxrxo3iydlm n iesls)srtrxrono1tlxn oeiat mDrmuvs u4trtrxr tatfpDraivil(  rum(rpoydlleemnvs s aDtmumonu4olt  o3iad mDum(vo;t)trxnifcoydfp  aivols)t2xm(m3ou4omtn fvt sfsrur(  no4tpeomociytfs em(von(0trtrmrcio1lmDeli olt0 eumxm3no4lm emncil()aruau p;u4tlt iiciydfs2rmnmsnu4tltnxo3oy1opDe uvo;s trxoimpiu1lpt mivtls sruaxr ;u4oeeoiieiytfaDuln p t)trxoiociodop  lnvo (0seur(m3iu4aptn nvia( arraur no1apeoiictatfm emu p;()aetrxf3oodopte uvo;t0srtoiopoydlp e nctltf Durx ono0oeenioeiydlm2elnvpn(4tlxnir3io1opt  u i;t0trxrxrpiu1ape  fcsa(fs2umxr no0tltnmoetaslm el(vo t4alxnmfcoy1fp e nvi s seuo(o3io1aptnmfvsl()sDurxrp;u1oee  
\ No newline at end of file
@@ -0,0 +1 @@
+ueo (0t2ur(rpnudlmtn iet s  Dua( oou4altoif3ilsfa2rmnmp t4arenifcta1fpD  u s ( t2uoxopio4omt  fctl( arumx oou1tle mo3iytlsDemnvsn(4aeerxr oadfatr nei s)t2trxrpiy4ap elictls) 2ua(ro;o4aee ii3ilslm2rlumo t)arerir3oytoa elneo;s trxoim no4oltelivtl( sDtau pnu0opx  fciydfs2emn p u4texnmfctatfmt aivs;(0t2toxr3nodomt mneils artrum ot0oleo feiatfsDum( o;t0 rxnmo iodfa elu ils0setoio3oodlle lnvia(f rrau o;o4apenioctad m umn o;t0arxoif3ty1lmteaues;t srtmxopio1open ivsls a2urur ;u0olenioeiat mDra(vpnt)tetomf oy1omDraues;t)seurxm3iydlpe lnvsat aDtmumpnu1opx ifcild a2rauvo u4 exnmf3tatlmDrai olt t2uoim3oo1apenlnctls a2ur( pot1tpenmfeilsfs2um( p t0 rxrircoatoa r ivi ()srtoxo3io1optnmfvil()s2raxronu4aexnmfcildlmDrlu p u0tetnxo to1fa  lnvi;s) 2xm(m oudol e nvtas a2tm(r ;u1opxn ociytls ea( s;t)trtnmociy1om  lnvi;s0srtm(mpio1apen ietatfs2rm(m ou4tee mfctas mDran o;t0aexomr oatfmt anvi t)srumir nu1aptn fvia( arra( o;o0oeen oetaslmDemn p;t0trxomr todlmteauvs;( s2uoxmpiu1lp e nvt t)aDumu poo1olx miciatla2ua(mp (0trtnxrcoytfpDrlies s) rxoxm3oy4alen feil(fa2rm(ronu4aeenmfeiytfa um(msnt4artnifcoatfmD lies (0 2trxr nu4ap nlnet () 2trxr ;u4tptn fctas sDul( sn(0tlxnmrcoy1faDeaivi;t) 2xo(m iudom  lfvsls)a2ra(  ;u1tpxomocildfmDraums u0aexoir3ia1fpteau i;() rtrim3nodopt mfvta(fsDrm(mp;o0tee ifeiytfm2ea( s u0teeoifciatfpt  nvo;s  2xo(opiy4lm e nvta(fsDrrur ;t1tptomicias a2ran o;u)trtrmrcoo1omDr n o s trxoim3nodll n nvi s) Duau o;u4tpeomi3iltfa el(vs;t4 renio iydfatr n o s0 euoxo iy1omee nvsls)a2taurono0openmf3ildls uanvo;u0alxnxo totfa  ln s;s srxmim3oodaleemnes s srumuroou1tpt ioctasfm rlnmsn(0aeenxr3oatfmte u i t0 2um(opny4optemicilsf Duax pnt4apen fctaslmDrln s u4teenircoy1fm elnei t seumxmpoo4olte nvi t)sDurumo;o4oetniiciadfa ea(mp;u) rxnmr3iytoatrauvs;t0s2xm(m3oodlp n ncsls s2ua(rpno0apxnif3iyd s2emnvs u4aeeoio3io1fmtr u i;s0 2urir ou4aleelneslsfarum(ront4tetoioctlsfm2eluvp;t0texoxr tadlateli s (0 2xoxm3nudlm   iei ( sDrr(moou4ale  oeildlm2elumpnu0trxoio oadopt anvsl(0srxrxo ny4apeelfvia()srta( onu0tpt  i3iatlaDrmn pnt4 lerir3oatopt au i s0seur(m nodom nmfctlt sDrm( pnu0aexnmf3tytfm2rl(vo t4 rxnxf iydlpD an ols)srtr(o no4lme  nvt t  rtm( pou1oee mfciydlaDrm(vpnu0 rtoxfctatlatr ues;t0srto(m3io1lmen nei (  2rr(mooo1apxnmo3ilt s2eanmp u4altnmo3ta1lpD  u ilt0s2uo(o3iu4lm nlivi sf rra(mpot1oltnmfetltfs2ra(mp (4 ltnmf oy1lpte u il(0 etmxmpio4ll nmivsasfsDrau ont4aee mfeiatla umu p;t0alermr3tydla rlneils) 2tr(rpoy1apeemncslt) 2ua( o;u0ale mfciaslaDemnms t4tetnmrctotlptrlueo t)texmir3oo4ll  lici t  2raxrono4aex  ociytlaDul(mont4 etnmo3iatlm eauvsl(0s2xrio oo1lp e netat)sDtaxr oo1openiictltfsDeaums;t4alenir todomteluvi;s trxrxm iu1alt lnei t)arum(  ou1aptomfctls a ra( p u4tlenioctadfa   ivsl(0s2toxr3oo4op nmictlt)aDraxmpnu4opx io3iasls2rmuvs u4tltoio ta1omt  u o;s0trtmim3oy1oleemfviasfaDta( pot0alenmoeiatfs umnmonu0 lxnxo ootlm  aivs t0t2tmirpoy4opt  ivslsfs2um( p;o0tptoiocildfsDuanms (4 rerircia1oat anvi () etmxrpoydomen ivtlt s2uax pnu4oexoiieiys m rmn p t) leomf iydfat  ivsl()seumio3oo1ll emfcilt) 2rmxrono1tltn icils s em(vs t0arenxocoytlateln sls)seumxopiu1om emieilsf 2umuroou0alx moctysfmDel(mp;t4alxnxf iydfmtr i i t0 exm(o3nudopeelfcta(  2urxmpot1ope mfeiat m eluvsnu)arermocoadom eln i s) exoxr ou4ol nlietlt)s2rmu pnt1oltnifeiatfm ean ont)tltriocoadfm eluvsls0texrxm3nu1omtnmiesat) Duaxrpnt0apen o3ilsla umnms t)aleomfcootfatrauei;(0srxrxrpnu4lm e fcia( arumurono4apxo iciltlm ea( pnt4 lxoio3oy1latrai i;( trtm(r iy4lme mnetasfsrumumont1alxoif3ilsfa rlu s;(4tlxrio oo1fpDrlivil(0 etmir3no4amtn nvs ( arra(r no1oexoio3tytlmDem( o u0alenifctydfp e uei;s) 2trxo nudam elfeia(fa2tru  nu1tpeniieilslmDum(mpnt)tltnxo3todlaDr u i;s)trto(rpou1om emiviatfaDtmx  nu0openioeiyt a rl(vo t0 rtoir3oytfa rlnvo;(0truoxo3iy1lp  lnei (f rua(rono0tlt  feildls elnmo u)aexoxr tatomtelneols0t2tmirpou4ole mfvils  2rrum oo0oex mfeildlm2rlums;(0altnio3oa1omD anvslt0 rxm(o3iy4ale liesatfa2trx o;o1aexnifeiyd mDulnmo;t)tlxnmf to1op rln s;s  2to(opnodlmtelnviatfsDuauro;t4tle  ietas s emnmpnt)trenxo3iy1om   ueilt s2xoim ny1ome mfcia(f rua(m ;o0texnmf3tlsfaDrl(vsnu0teerxrcootopD  neo;t0 exoiopoo4ol nmici s srtrx  nt0apt  i3iasfs umuvsn(0alxoif tatfm raneo t setrio3iy1lptelnvtls)s2rr(m no0tptnmoetytlm em(msn(0aleoir3tytlpDelu s;t0srum(r3iy1oltemnctltfsrrru onu4tpt  fciasfa ranvo t4arxnxociydlatran ils)t2xmxm io1omee nvils)sDrrxm ;t4oleomo3tat a emnvo ()altrmf oydlm r ivs;()t2urim oydolenmfcia() rtmx poo1tleoifetlsls2el( o;(4treoir iy1lptrlivolt)sexo(m iodolenmivta()s2taxmo;o1tpe ii3tldls2uluvs;u0 rtrxr oatop eanvs;s texrxm iy4ame  ncsas)srtmx ono4tpen o3tld m2ran pn()trtnmf tytlmDraiei t t2tmimpiu1olenmfeilt  rraxr ;o1apx iociadlm ran pn(0 etoir oo1la e uvo t0setrir iydamee feiat)arra(rp;o0opxnioetlslaDem(vp;u0arenmrctadlmDr ies;s  rurir iu1am n fetlt)aDta( ono4apx mf3ilsfsDumnmo ()trermf oydop rli olt srtmim3iydomt  nvt s)sDrru oot4alt  ocildls el(vp t4tlerif3ty1lm raueols  rtmirpiu4al  mncs s  2tr(mpnt1tex  iciytfs el(ms t0 eeomfcoo1fmte n o;t)trur(r3iy4ame  ies s) rraxmono0oetomoctytla eanvo (4altnmr3tydoptrau ils s2xmxo3io4ol   nei tf Dtmxm ;o4apto o3iad mDumnmo;u)tlenio3to1oat  uei () rxmxm3io1ll nlfcs tfaDrmxr nt4texoii3iatla rmu p;(0trtrxoctydoaDrlivslt sruoim io1lleemnetlt  rtrxronu1ape  oeiltla2rmnvs ()texrirctadfptrlues;s)seto(m oy4amee ictas srrax o;t4oex moeilt mDran s (4altrmocoatfaD livs s  eurxr iudalee ivt tfaDtm(r no0apxn f3iytfsDean s;(0 rtrif iatom ran s (0 exr(r oo1am   ies t) Dra(  ou4ape mf3iasla ra(ms (0 lenxf iadfmtraivsls0srxo(opoy1lmeemici s) ruru pot1tpx mf3iyt m2ua( p;t4 lerxo oo1fm   neil(0 2tmxo ou1lm emiesatfs2uaxmonu1texoioeiys m2uau p;t0aeeoxocoytfpDeluei;t) 2umxmpoodopt lncil(  Draxmoot1ape mf3tat mDrmn p;u0tlerxf3ootfmtrlu o s0tetoxr3nodolt  ics t)aruau pnt1opeoio3iysfsDeaums t4arxrmf oa1lm elies;t0s2uoir nodoptemieil(  Dtau  ;t4tpt mo3iat s rln s;u) eeoxf3iadfa elivo;t) rxr(opny4ame lnvsls arrr(mo;u1oeenmocilslm2ra(vsnt4altrmf3ootomtraieo ( t2tm(r3oydlme  nvsls srtm(  oo4opx ifciyslm2emu pnu0aetrircoodfmDe ivs t  euoim nydom e iei s arurxm ot0opx iietyslm emn o;u4trxrmfctadlmt aivs;s  2tm(opnu1am nlncs tfsDrm(root1teeo f3iyd s ua( s;u)alxnmf ta1fp ranes;t) 2xm(o oo4al nlfetl(f rurxr ou1apxomo3tys m umuvpn(0trtoxo oa1opteauvs;s) rtmiopnu4opt lfetls  Drau ont0olxnifetadfsDuan p;()aetnmo3iydla eaieslt)trtmxm iy4altn nvsat)a2rrurp;t4opto o3iyslm2elnvs u4texnir oodfaDranvil()s2xmio oy4ame miesltfarua(  ou1aeen f3tysla ua(vsn(4areoio iadlaDr uvsls t2tmirpou4ap   nctatfsDta( p;t1opto oeilslsDrauvp;t0 lxnmr to1lmt  n o t0sexm(r3no1amtemieia(faDur(  ;u0tee  iciadfmDua(vo;(4 lxnmrcia1lpD lneo ()teuoxmpnodapen nei t)srrr(ro;u1olt mf3ild m elumonu0trtnmo iodfpDr ivol(0s2uo(o ny4lme mfeils aDta(  ;o0tlenmfeiadls2ul(vo;u)artrifcoo1fmtean i ()t2xrxr3ny4omeelnvsl()s2raurp;u0alt  ictadlsDean sn(0 rxoifciydoa rlneils0t2trio iu1amee fes t)srrmurp;t0tltn iciadla2rmnmpn(0 rtrxfciadopte u sls)s2xrxmpnu1omeelfcsltfsDtm(ro;o4ole ifeildfs em(mp t0trxoxf3oydfa rlneilt t2xrio no4omtnmnes t)srrrx  ;t4oeenifctysla2el(vp;t)teenmo3io1fm e ieolt texmim3no1op e nciat)s2tmuronu0aetoioeiydfmDrlu on(0 etrxrctytopD lueolt  euoirpio1alte ict s aruru oou1tpto f3ild a2rl( o (4trxnio3iy1om r uvi s  2xr(rpoy4lm  mfvslt sDtmumo;o1tpxn fctys m el(vo (0teenxo3ia1omtrlnes;( texrxr3iu1ol n fviatf rtrxroou0oex  ictasfs2rlu p;t0 rxnxf3tatla raueils  rtrxmpny4ol elfcilsf rra( pou1alenifciytla2eau pnu4 ltrxo oytla r ieo;s0 euoxr3oydolte feil( sDuau oot0oltoiictysfm2ulnvo t) rtrxoctotfpDranei ( s2um(r nu4amee fci s)srur(mo;t0tpxo ictlt aDulu o;t)trxrxrcoadfpt  n il(0 2tmxopoydol  mieta(  Dum(m nu4altn i3tyt s elu p () rtoir3iotlmtrau olt)s2uoxrpiy1aptemivsl(  rtr(r oo4tlt if3ild s2emuvs;() exoio3oytfm eanvi;s) rumir ny4omenlfcsatfa2tmx ono1aptoif3tltlmDumu sn()alermf iadla eai s s0texmim3iy4lmtelfes s  2tr(m ou0tpxomictyslm2rl(vp (4artrxfcio1faD lnvo;(0 2xmxo3oo4optemfcsatfs2taur ;o4aeenmoctyt sDumuvs;t)tltnmr io1fa rlu i;()srtrir iudole  ncsl()arrm(mp;u1oex  icilsfmDean p;()trerxf oadop  anei;t0trto(r3ou1ll  mnesls)sDumx  oo1aetnmictad mDemnms (4tlenxf iytoaDe ues;s0 exrxopno4lme mnvilt)aDrrumpnt4olenii3iltfs2um(mo u)alerxf oodop  anvo ( srumxrpiodllt mivtl() Drr(  ou0apxomo3tyslm rlumpnu) exnmo oodoat li s;s)srur(opiudop e ivt sfsDurx  ;u1opxo ieiys a ea(mp t0 rxoxo oatomt  i o s)t2urxrpiy4al emietl(f Durx  no4oex mieiat m2em( sn(0 eeomr3to1fa eli il(0 2umir oy4lm nlncs s a2tmumoou1oleo oeiltfs2uau o t0 lxriociy1fmDr nvs;( t2um(m iu1aptnlfvil()aruaumoot1tet mietlsfmDumnmp (0altnxfctytop rai sl(0srtrxo iy4openlicilsf 2umumo;u1tle  fciltla2umnmp t)areomr3oy1oa  luvi;t0s2um(r3oy4omtemfvsa()artaxrpnt0oeeo ieiadlaDumnvp (4 exrir3iatopt  nvs;(0 rurxopiodoltelfetlsf rtau o;u0tlxoioeiltla emuvs;u0 etrxo3ootlmt  ueo;s) 2uoxmpiydlptelfes t  Drm(ro;t0tpxn fcias a2um(vsn(0alxoif3totlm   neils texo(rpiu1opt mneta( aDtr(  ;t1aptomo3iytlmDrmums;t)aeeniociytlmDr nvo;s t2trio3nydomt lieslt) Dumur oo1ale mf3iysla2eluvs;u0altoxf3tydlaDrln i;s  rum(rpiudopenlncta( s2ur(m ou1oleniieiyt s2eauvonu) leomr3oo1fatr i sls seto(o3iy1lmtemnvtl()aDrm(r ou4oee  i3ilslaDrauvpn() rtnxrcoo1optrliesls)trtmirpoy4op nmncsas) rtmxr no0teen ietydlaDranvp u0trtrxfctydop   ieo ( t2umir oy4op  liet t)s2tmur ot0teen fcild s elnvs;u4arenmrciytom r uvs t  2trim3oydlptn ictat s2raxro;u1opx iictas m2emumpn()aexoxo3iadlp ranvs (0s2xmio ou1al  micsas) rrmxm ;u0aee ifctat s2rm( s t)arermo todlp elnvs;t0srtoiopiudamtnlnvs t artr(mo;u0aexnmo3tltlaDeln onu) rtrxo3oa1lpD an o;(0 rurio iodlmenmfei t)sDraxm nt0tet  i3ilt a emnvpn() rxrxrcootlp  anes;s0trxm(o3io4lltnmivi () Drmxm nu1alxomoctlsfm2eanms (4 etoxfciodlm  lneo;() euo(r oudomen icsat aDtm(r oo4teeoif3tas m2ra(vo (4 rtoiociydfmt  uvolt0s2uo(m3ou1am  mnei (farurxrooo0olt mfeilsfaDrlnmo;()trxnxf3ta1lpDe ivs ( s2uo(opnu4llee fvs tfs2ua(r ou4apxomfciyt mDum(mo;u)teenxrcty1fmDeluvi s  2trxmpio1op n icias srumurpoo1oexnio3tat m rl(vpnu) rxnmr tatoaDr u o;s0t2tmir oudame  fct (f 2trx  nu0ape iictadlsDulnvp;u0 exrxf3iy1la e uesl(  rtmxr3ny1llt liei tfa2rmumpou0aleoifetyd aDea(mon(4 lenifcia1laDe nvi;t)s2urir iy1ll   fvtls srtmxmp;o1olen oeiadfa2ul(vp t) eermo3ootoateaieo;( tetmxr3nydlptnlicsas  rurxr ot0oexo fcilslm2eanmont4aetnxr3oodoatelu s;s)srtmimpiydome  ivtls)sDrm(r no4teeoiieiasls2ulnmsnt0 ltoir ta1lpte uvo;(0srtrim3nu1ll   ieiasfsDtr(rpnt1optniicildfs rmnmp () rxnmo tatopt  i ilt0 2xr(rpiu4lm  mivia( sDrr(mpoo0oex mf3iytlaDul(vs;u4trxnifciotom  lues;(  2tmxmpiodopee iesat)srra( poo1tpx ii3iyd mDranvp;t)alxomr3oo1latelues t)trxo(rpnu1lltn ics sfsDrm( poo4aeto fciadlm em(mo;t)tltrmrcoydfmD anei;(0seum(opoudaptnmivs (faDurxront4ope ioeiat a2rln pnt4altrxo oy1fm rluvo;t) rxmio3oy4omt mnvsl(  rumx pou1oex if3iyt m2eauvp ()alxomfciy1fp eliei t) 2xoxm oo1am n ict s  rurum nu0tpx if3ils aDumnmp;u4trxoifcoytfa rli ilt)srtoim3iy4alte fvias artmu  oo1oeenii3iat m elnvo;t0tltnircoy1omt an ol(  etmim iy4ol nliet sfs2uaumoou4tpxoioeiadfsDeanmp;t4trtnir iodoaDe u o t0srto(m nu4ame  neiatfs2urumpno1opt ii3iltlm em( snt4 exrxf3ta1op r ieslt0 2uo(mpnudol  mfctlt)aDua(  ot0aexo ociyd mDraump;u4texrxf oytopt au olt0texmim nu4ame  icsasf rrru pno4olen iciatla eau pn()tleoxf to1lmt ln o (0 ruoiopnodlp  lictlt s2tmumpno0opxoioctytla elnmo;()tetnmf totlpt aueo s0 rtrxr oo4llenlict (faDrr(rono0apx io3tldfs rl(mo;u0 lenxrctydfaD  nes;(  rtoxopiy1am e iet ( s2uaxmont4opxoif3iaslsDranvp;u4aeeoio3iatoaDr ues t0 eto(opny4op  livslt)s2ra( pot0aex mieiad a2em(vsnu)aexnmf ty1lmDelieilt) etm(mpio4lptemfctl( s2uaumo;u0tlxnmoeiys mDra(mont0 ltrio3totfp  auesl(  exoxm ny4amenlncil(fsDrm(rpno4aptnioeiys m2um(vpnt0arerir totop rluvsl( trtmir3iu4lme mieil(fs2trxmont1teeomoeiydlm2ea( on(4alxnxf3iatom  lu o;( srtr(o no4om   nvsa(fsrraumpnt0aexo oeilt a ra( s u0altnmfcta1fmt aues;t)t2ur(rpoy4lp nlnvil( arumu p;t1apxnmoctydls2uaumsnu4aeeoif3oo1faDe n i (  ruoir3nu4lpteliet ()srrr( p;u1opxomictytlsDrau s t)texomf oytfa   ieol( trtrxopoydomt livia( sDra(ro;u1oet io3iysfsDumuvo u) exoxrctytla e nvs;t teurim ou4ll nmfet t a2ua(m oo1opt iietasfa2emnvs t0tlxoifcoatlat  nei;s)teumio ou4ap   fciasfarra(ronu0tlx mi3tydlm2rl( snu4trxoxfciadlate n s t trxoxr oo1lpee ivs ()sDrr(m ot4aeeo f3tydfm2rmnvpnu0altnio iodomt auvo;(0tetr(opiudlp  mncsa() Drm(mpno0apto octyt s2rlu onu0aexnircoatfptrli ilt0 rtm(rpoo4lm nlivsa() 2trxr ot1tetn ieildfsDemn p t)treniociodlmtrluei;t)sexmxr3iy1lptnmietl(f Draurpnu0tet moctatlmDuanvp u4tetomo3iydomDraiei s0t2umxr3oy1op   fei tfsDuax o;t4altoioeiat m2ean o (4tltrmr3todlaD luvo s  2uoir3oydlme miesl( artruro;t1tltn fetysfm ea(mo;u) lxomocoo1oat auvi ( s2uo(m iudoleelictl(farum( poo1oexnmfciyt a2uan s u0trxrxf3oa1fm rlivs;t s2xoxm io4omte ietl(faDuauront4olt  f3iytlm2ea( sn(0trtnifciydfatr i o ()setoxopoydamenmnei (  2rru ooo4olxn ociyd s ea(mp t4 rtrxo tatfmD  ues t0texr(m3io4aptemncsl()sDuaurono4oee mictytlm2eanmon(0aeeoif3to1lp rluvo t) 2uriopny4olenlnci s)sDtmxrpnt1ole mo3tldfa eau sn(0texomf3to1lm   iei ( setrxm nu1olte fcslt  rua(  ot1tlenioetat s2ea(mp;()tltrxf ty1fatr nei;( srxmxm iudlme mnvi tf Dra(r ;t4oex mi3iys m rm( snt0tlxrircoytlm ean i;(0teur(m oy4am  mfvsatfa2uaur ;t0tltn f3iys mDrluvp;t)arxomrctatop r u i (0t2xrxo3oo1alenlfci (  2rm(ronu4tlenif3tytfaDumu o;u)arxrxo todom raueolt0sexm(o3iudol   nci (  2raxm nu1aetnmieiasls umuvon()aetrxocoatlaD aiesl() 2uoirpiudopeelfctl( srtr(moou4teeomieiatfa2uaump;t0 rxrmr oo1oa rau o;(0 exrim3nodlltnlfvs tfa2taumono4tpt ifciatfmDua(vpnt0arerifctatlpteaivs s) exmxr iydamtemfvias)aDtm(rono4alt  ieias a2elums;(0areoirctatlpt  neil()s2toir iydlpt lneilt  Dum(  no0tltomoeiyt s2rmuvpnt)tetrmr ootfatelu s t0seurio nydamenmfvi (fs2tmxrooo1ope mfciydfs elump u0altnmf3iy1lm rlnesl()texoiopoy1omtnlnvilt) 2tmxmp;u4olxn oetadfs2em(vs (0areoirciatfatraueils) rur(o iodll emfvsls  2rmu pnt0tltomieild a2rmuvp;u0 lenif iatlmDeanvs;()teurxrpoy1ap nlnvs tf 2tmxmonu1alx if3tldlm elums;t4trtrmf3oydopDeaneo;()srtmxopoo1ol nlfetasf rumump;u4teeoif3iysls ra(vp;t4aleoxocty1omDeli o ( t2ur(mpou4lleelieta(fs2rr(moou4opxn feiyt mDrl(vo (0 rtrmo io1oaD  n ols0teum(r nydlle lfetatfsrtaxro;u1olx miciat sDulnvo u4aexrio iydfp r iei;t  etoxmpio4aptnmivi t aDtaur oo1tpxn oeiaslm um( o t4aeerxociotfpDr uei t srtoirpiudlpte nesa( aDtmu oou0opeo fctldls2el(vp;()trerxr3oodlaD li i;s  2tm(m3oydalenmicsas sDtr(m no0tpe mocilsfa2ua(vo;t)arenmr oa1lm r uvil(0 2xr(m3oydop  lies () 2tr(rono0optn f3iatfsDea(vo (4aetnxr3iodomDeaueslt) rtoir3iu1olen netat s2ra(rpnu4altn ieilt s2umn ont) renxfcty1lm e uvols t2toim3ou1ap emncil(  Dumumono4olx micilsfa elnvp;u)texomf oodfmtr nei (0 etrio iu4al   neiatfsrtmu  ou1tpxn oetls s2uanvo;u)trtnmr oadoateaueil(0srxoxm3oydlm n fvt tf 2tmumo;t1tpeo fciasfmDrlump;()tetrio3todlaDeau i s srxrxm no4am emfes (fa2taxm nt0oee mf3tlsfm eanms t0trxnir3oytfpD  u s;(0s2uo(o3ou1omtemneias)srrmumpno4aptoiieils a2ulnmpnt)arenir totlpDrlivi;t0srtrxo3io1omeelneil()aDurum ou4tleomietytfs rmn o (4 rxrmr3io1fa rai s (  etmim3io4ame  fcsas arta(r ;t0tlt iieilslsDuanmo;t4trxomr3todoptelneolt0seumxm nydol elfet ()s2raxmpot1tlx if3tasfa emu pnu0alerxf tatlmtranvs;t)srxoxr no1ap  lfcia()arrmurpno4aee ifeiysfs2umnvonu4 etrxo3tadopD lnvi;(  2um(o3no4lleemnvslsfs2umxmpoo1tee mfetatfsDuanmo (0trtnxf3tadom e n i;s trtmxo iy4op e neia( a2rmxmpnu4alxn f3tytlm2ea(ms;u) rxnxr totop rlivi;s s2urio ou1alt  fvslt)s2rmum ot0olt ii3tltfm um(msn(0teenxr iatlat  nesls0 exmxm3iy4omenmictat)aDtm(  ou0altn i3tatla2uaumsnu4texrmo ootoa   nvol( srumiopoy4am  lncs t s2umum oo0alt ioeiytfaDulu p (4 rxomr oodfmte i i ( t2xr(r3iy4olen fviltf rrr(moou1ope  oeils sDrm(vsn(4 rxrifcoodfpDeaueolt seuo(rpnu4op elnvs (  Dtaxmpno4ale mf3tldfa umn p;(0teeoir3oytfmtr neilt) euoiopiodamt lictl(fsrtaum ;o4tle  fciytfaDrl(mon(0 etrio oodlpt li s t)tetrxo3oo1alt lfcs s  rrmuro;o4opto octldlsDea(mpn(0tltrir3oytopt  ivsls setrimpoudlp  mnetlsfa2umur ;u0aleoifciysla rm( onu) reoxr3oodfate u i;(  eumxrpiudam nmnvta()srum(ronu4tee mietlt m2emuvo t)tlxoif ty1la eaivo;(0 eum(o3ny1omenmfei tfa2rm(mo;o0olx io3ildfmDrlnms;(0teenifctadoaD liei t  2umxrpnudom nlivsl(f Drmum oo4aleniictad s umnmont) rerif3oodfmtelieo;(0teuoim3no4al n fei s arumx o;o0tlxoifetydlm rlumo;t4 rtoir tadom eai o t0 2xo(r3no1omt lictls sDtmxroot0tex mociasfmDeln o;(0areriocoo1fmteaivo s tetm(m3oudam elfcs t aDumxm oo1aexnifctatfmDuaumpnu0tlxnio3oadoaD  ieo s0truoirpio1ol nmfvslsf rrr(mpoo1tlenif3tatla2uln s;u4 eenxocoatomDr uvi;( t2toim ny4olte ivi ()a2umxro;o0tltnifciatfa2rm(vs (4 lenxo oo1lat luei;(0 euoir3ny1aleelnvtlsfa2taumoou4aeenif3iytfs emnvo;(4treomocio1oat  n ols  2uoxr iy4alenlfvtatfaDrrumonu0apeomo3iys m2rlu o;t0 lxrmo oy1op rauvil( t2xm(opiy4apenmnctl( sDtaum ot1teto iciatfm2uan p t0aexnif3todla eliei t srurir ny1ol nmfvt s)s2umumpou1teen o3ilt m2elnvp ()tlerif3ty1omDeanvi;s srtr(r iodapt  ivta( a2rm( pno0oltnmietasfa2emums ()trxoxr iatlptr uvi;s0t2tmxr3ny4amtelfeslt)arur(mo;u0tltniociltla2rmuvp;t0trxoifcoodfa   u sl(  exmio3ny4aptnlnvt ( sDta(  ou4aeeo oeiadlsDumnvon(4teenmo3iotfpteanvsl( teuoxm3iy4ap e nvsatfs2trxr nu1opx  oeildla2umuvo t4trxrmrcoodfpD lnvs s0texrxm3oo4apen fctltf ruaxront4aee mf3tytfmDrlums;u)tlxoxo ta1fm r ivo;t)s2urxopiodlleemncsat  rrr( pnu0apxomf3iysfm rm( o;()alxomfciytfpteli s t)teumim3oo4amte icsl(f 2urx  ot0texo oetld m2uauvo;t4trtnxr3ootfp  livols trxm(m io4ale livs () rtmxro;o4aeeo ictltfa2rlumsnt0 rtomfcootoaDe ivo;s0 2xr(opoodam elnvtls sDrrxmpno1tpx  f3tldla2ua( s;(4tlermo oatlaDraies;t0 etrxr oodope mici t aDrmxmpno4tpxnmietytfa2eaumsnu0 lxnxrcootfmtrln i s) eurim iodalee iesls artmu pnu0opeomfetatla2uaumpn()aetnircoodomt  u olt)seuoxo nodole lfeiasfs2tm(  nu4oetn i3iysfs2rauvsnu4aetoxociytfmtr i i t0trurxo3nydlptnlnvta() Dtau pou1tltn fetltlm2ea(vs;(4 rxrmociotfmD aues s trxoxm3oydoltnmivta(f Drr(m ;u1aleomfciydfsDrau s;u) lerif3iadlptr i s;(0t2uo(o iudlmeemicta()s2uaxrp;u4alt iociasfsDea( s;()aeeomf3oo1fp   ueo;t)t2toxr iy1al elnciat aDrmuronu0tpxnmociltls2rl(mp u0artnmr tadfptean ilt  rtmxm ou4ameemfes t) rtax pou4oeenifetld aDuauvon(0 rtomfctotom raivo ()trum(o iudalee nci ( a2ta(rpot0alxomfeiydla2rm(mp;u4arxrif iadla  an i;t)texr(m3ou1omeemivsls aDrmxmono4olx  ieils a2elu p t4 exrir3tydlmD  ues;s0seumim3nodlptemies (  Drr(mp;o0oleoioctydlm um( s u0tltomfcio1opDr n o;t) 2xoxr ou1ll elfctlt aDurxrpot1alxn oetat aDuanmp (4arxomr tatomD  i o;s  etrxr3oo4lp elici ()srum(  nt0openii3iydla ean pnt0aeenxocoa1fp rlieil(0 exo(m3nudlme mncsl() Dtrxmp;o4olt  ieiyt mDuan onu0tltomr iy1optelu i t)srtoim3ou1lm nlnctlt arrau ono4tpt ii3iydla rlnvo;u) rxomo ta1fpDrlu s;(0truoxopno1ll   neia(fsDuaxro;o1aeenmieildfa ulnmo (4 eenxr3tatfpDrlneo (0s2tmxmpio4olee ncias) 2rm( oou1tetn fciasfa ea(vont0 eeoxo3tydfpDr ieo;s trtrimpnudamenlncs s srtmxrpno1apxn ociatlmDumu sn(0aetnxr oo1lm raiei;t  euo(o3no4lm elnvi tf 2tmxrpou0teeo o3iat a rauvp;u)alxnifctydlm e ivo;s  2trir3nydom  lfes tfaDua(mo;u0tpx moeiytfmDul(mp;(4tleoir3iodomteaneolt)seto(o3ou1lpt  ncils)sDurumpnu1olen fciatfmDra( o u4arxoio ootfmtrlu ilt0srurxmpou1om nlictl(f Drmxm ot0openio3iltfs rlnvp;u)tlxnxf3iatop   u o;( srxr(rpoudlltnlfet tfsDtmxr ;t1tpeo fcildlm umums t4teerirciytoptranesls)srtmirpio1ape livt sf rua(m no1oeeomf3ilsla2emumo u0 eeoio3iotomteanvi t)s2xm(m nodopenlnvi tfsruru p;t1aleoiietytlaDrmu snt4 eerxrciydfateauvo (  exoio nodlltn nciasfa2uaum nt0tltn i3ias a2um(mp t)altoxf3ia1omDeanvi () rxrio3nu4optn feils) rrau o;o1tlt ii3tytls2elumo;()altoxfctotlmtrlu s;()srumxo nydap nmncil(farua(  ot1aex mfeiasfmDrl(vp;t4 ltrio tytlm rlnei;t0s2urio3oudalee nvtat)s2trumpno1oee moctls m2rl( on(0 ltnxf iadla r n s s  2tr(mpiy4lmtelfeta(  2um(mp;u1ale mi3iyd m2ulnmsnu0texnxf iydfmtrau o;t tetm(rpiodamenmfeias) 2raum ou4altomiciat aDel( ont0trtnmo iotfaD anes (  rtrio3iy4omenlnct t  Draump;u4oetomfetltlmDul(mpnu0 exnxf to1fmtelivsl()trxmxopno4lp emfcsat  Dtrxmont1oltomf3iaslmDra( o u4 lxnifcio1fptr nvilt)trtmxrpoo1lp  mict sfarumx p;u4opxoiocilslm2rlu p;(4 etrif oodomtr nvo ( trtoimpiodaltnmnctl(fs2tr(ronu4opxnmociltfm umumsnt) leoxo3oo1lmtrlnvs;t texmxm3oy1omeelfcias) 2tmu pot1ape mfetyslmDum(vp;()tetoir iatfateluvo;(0truoir oo1ol  mneil( srtrx ont4opeoii3iadfaDea(mp t)arxoxr3tydfpteaiesl( trxm(r3no4ll e nvtl() rtax p;u0teenifciadfm emumo (0 etoir3iatomt  nvo;( s2urirpoydolenlivsa() Dumxront1aetnifeiltlm eln p u4 leoxo iytomteln slt)s2xoxo3iydal eliet s srua( pnt1aetnmfetldlmDum(mo t)altoxfctotfptr u o s  rtr(rpiu1olee nvt t  rur( pnt0tlt  f3ildlaDraumo u0arxnxo tatfmD luvo ()texmim ny4amt mfvsl()aDum(rpoo1ole mfciyt m elums t0treoxo3tatlm r ivsls texm(o3nudlm  mfcs (  rta(  ot4ape  ieilsls2elumon() etrio3tydfm eln ols0trumim3iu1al  mieiltfaDumx p;o0altnmfetyslm2ran o u)aexomr oadlp  liesls0t2toxmpnudlp nlfesls)s2taumono4tex  f3iasfaDuanmonu0teenxf3ootomD  ueslt srtm(m oy1lmenmfcsatf rtmumpou4tlxn f3iat s emuvs (0tetniociydfm eai slt t2umim nodlmtnlnei s srrmump;u4ape mi3tldfs emn o;u4texrmrcoatfm rlu sls)texoim nydopee nvs (fsDraxmoot0apto fciatlsDumn p u)tleoircootfpD  neol(0tetrim3oy4om emfcsas)a2truroou0opt  fctld s2ulu p u4 lxrifciy1lmteaieo (  rtrxr3io4lptn fvi s  Duau  nt0aptomieilt mDelnmpnu4areniocto1la   iei;(  rtrxr oudaltnlncil()aDrm(moot1tetnmociyslsDrlumo (0aeenxf3oatoatr ues;t0trxmxopou4om emfct sfaruaxr ;t4opt mf3ilt m eaump;u)trxrmocia1lm   uvs;s0srtm(m3oudllenlivt (  rrau oou0tpe mf3ilsfa2rln o u)aexnircoadfmt  n o t0s2xrxm iudlleemnvtlsf Dtaurpot1tpen feiatlm2rmnmo;t) lerir3oy1faDraueo;s0s2trir oydop elncsat)a2tax ont1apt ii3tldla2ean s ()alenmr oydfpDrai o s t2umiopoo4lm  lfct s) rrmx  ot1aptoioeiysfaDuanvsn()artnmr ootopt lieo;( setmirpou4alen nvsl()sDrax pnt4alen octlsfa2ea(mp u4altnmf3oytoaDeaies t0sexrir3oy4lm n nvilt) Dtau o;o0tltn ietyt m um(vonu0arxoiocio1om eln i;t0 rxr(rpiudap  lfviat) rtmumooo4oet ioeiaslsDel( p;u4 eeomocoodlm rlnvs;(  rtrir ny4lp nmfvta()a2rr(mpno0aeeo oeildlsDuanvo u4alenxf tytlm rliei s  2uo(rpny1lm  mivs (  2tmumo;o4tlxo fetydfsDemn s (0teerxf3oydom rlies;s srtrim3nydamee netasfartau  nu0alx mictld mDuau o;u0trtoxrcoa1laD lneol(  2to(r3iodamenlicil(  2ta(  oo0oee  o3taslsDeln o;u4 rxomf oo1fm r ies;(0setm(m iodllee fci s  2umu  ;o1tpxn fciatfs ua(ms t4aexoxf3iy1oat luvil()s2trimpoy4lmt lfesasfa2ur(r oo4opeomoeiys mDum(vs;t4texrif3ia1oa rln ols0 2urxr3oy4am emici tfaDrax oou1oet io3iytfsDem( p t4texnmo todlat luvsl(0s2xmxr3iydlpt lnet ( s2taurooo4apxn fciltfmDeanmo;u)trerxrcia1fatelnes t0 etr(o oodlpenmieiat)sDumxrooo0tltoioetld a2ul(vo;(4 rxrmrcia1lmDe n i t0s2trxm io4amee nei tfsrum(mo;t4tpeoii3tytlaDum(vsn(0 lenirciadlp elnvs s setm(o3iudoptemfciatfs2umuro;u0texomiciyt aDrm( p;t) reoxo3io1optelieols) 2xr(opiu1alte fcsat sDuax p;o1olxo o3iadlm2ea( o;t) rerxf iotomDr uei t0trxmim3oy1am nmivi t s2tmur no0aetnifeiydfaDul(vs;t) exrmfciadomtr ivi t t2ur(o3ou4apenmfeilt arrm( onu1tpt moetytfs ulnvp u4treomo3todlmDrau i;(  rxoxr nudlptn ivta(faDrau p;u4oetomfctysla2rmn o;t0areoxo todomDean slt)t2ur(m no1lpe lfvt t)aDtrum ou4ape mfciydfsDem(mp;u0arxrmocoytla e neo s  2uo(m no1alte fci (faDtmu oot1aex  fetld a um( snu0 rxrxr oo1oa   i i s)teuoxr3nudop  lfcsatfsrrrumoot4alx mfctlsla umuvp u) rtnmr totfp rlnes;(  rtoxr3iy4om n fvs (fs2rrumpoo0open fciatlmDrlumpn(0texniocoo1lpt au s;(0 exmxr3oy1openlfcils)sruaur oo4altnioetltlm2rm(vont4alxoxfciytlpt anei;t srxr(r3iu4opte ictatfsDtmx pnt0aee  f3iaslm eluvs t)alerir3iatlp  anes t0setrimpiu4olt lics t s2raur ;u0tltoiociyd s ulums;u4 etomr3iy1oa ran ils)s2umio3oo1ol n fcs (fsDuaurono4aptniicilsfsDel( s;u4arxrio oa1lm e i ils0sruo(m3nodlp  livtlt artmu pnu4tee miciat m2rlnvsnu4tlxoifctatlmtr neo s) etrirpoodaptnlfvtltfsrumxmp;o0tlxnii3iyslsDua(vont)tlxrmo3oadopt luesl(0texoxr3oodameelivs t)a2uaxm nt4oltn oeiasls2umuvpn()texoiocoatlmt  neo;t setrirpio1ol   fvtlt)aruaxm nt4aptn o3iyt mDum(vpnu4aeerircio1fm rlueolt texoxopoo4ll   ici tfaDtru  nt0tpenioeiltfs2ea( p;()aetnxocoytfm elivo t) rto(mpoy4ll n netat) rum( onu4ape micias s elu s;(0 eenif iotlaD  nvi s  2xm(r3nu1lmeelfvt (fsrraxrpot1tleoioeiasfsDemnmonu)aleoxf iytoa eai i;t0setmxmpiydomtnmieia( sDuaum ;o4oetn oetadlmDelnvonu4alxnxf3iydomt auvo;t0 exrio no4ale  ict t) rtrxm ot1tee  fciadfs2uan s t)teerxf3oatfatranes t) 2umirpnudal nmivt s aDraurp;o1aet ioeiydla2elnmo;(0trxoir3oatlpteauvo;(0 2xmxo3nu1amte nesl( sDtrur ot0ape mi3ilsla ulu p (4artnxrctatfa  auei;()trtoxmpny4apeemnct sfsrur( ono4ape iocias sDum(ms (4tetrmo oo1op elneils  rxo(o no1aleemiesatf Duaurpnt0tpeoio3ildlm2ua(vsnt) etoxr iadlpte i o ( texr(mpny4llenmfesls srta(  oo4oet ii3iadlmDumnvo;(4 rerxf3oadlmDr i i s)s2umir3ny4am e nvs (f Dtau  ot1tlxniieilsfaDeanvp;u)alxnxf3oatlp  luei (0t2xr(m oodlltn fes t)srra(mo;t0apt iietyt a2uluvs u)arxoio iodla eaivols0 eur(r nudlmtnmfesa(  2ra( pnt0olxomf3iat s2umuvsnu0texnxf3ty1fpDe i il(0t2xo(o3ou1amtn fesltf rtm(r nu4tleomfeiysfaDua(mp u0trtoxf tadfmt livilt)teurxo3iydlp  mfcsltfsrrrxro;t0tpto f3iydfaDuaumo;t4aeenmf3iatop   nvol(  2um(r3ny1apt mfetlt aDraurp;o1tet iiciaslm elnvs;u0alenxr oo1omteaivilt)sruoxm nu4amte fet (fa2tr(m no4tltnmi3iat s2rmnvo t0artoxf oytlaDrlu i t t2xoir3iy1apee fviasf ruaumpno1oetnif3iatls2ra(vpnt4 eeoio3iadfaD livo;t0 2tmxm3iy4ope  fvt (fsrtmu oot4teeomoeiyslsDemnmonu0 renxf oytfa  auvi;t)texr(m3io1om emfctas) rrr(mpou1teenmociad s2rmn p;u)arxrio ta1la r nvil(0 etoxmpny4ale mfvias aDtm(  no0tlenmf3ils a rau pnt)artrmocta1fp e ieilt0texmimpoydale lfesas)srtm(mono1tlxoiicilsls2em(vs u4 rxrmocoy1faDrli o;s) rtmim io4lm  livta() 2taum no0opxn octatfa ea(vs;u4 rxnxr3ia1lm elies t)trxrimpnu4lmtelfesat  2trx  ot0aptniieiydlm raumo u4arenmfctadfmt lu o (0sexoxo3nodaleelfet s a2taum oo4aptn ictadfs rln p t4 leoiocoodlmDrli i;s0texm(rpnu1lptemfvsas sDuru  ;u0teeo ieiysls eln p;()tltnio3iy1lmt  i o () ruoirpny4omtelnci t  2uauronu4oex  f3tls sDumnvs;t4 eeomf tadoa eanes s)teum(m iudaptemfei tfsDurx oot4teeoiietatfaDuauvon()tltomfcoytlpDr nesl(  rurxmpiu4amen fciat)sDuauront0olxo o3iydfm2el(ms;() ltoir3iy1omte u o t)seurim ou1apeemieslsf Dumumo;t1tptoioeiys mDul(vo;u)aleoif3ia1oaDr u o;t  rto(m3oy1omtemicsasfaDtax ooo0tpx ii3ils s2rlums t) exnxrcoydom elneo (0 rtoiopiu4altelicsas)sDumu  ;u1aptnmf3iytlm2rm(vp (4arxomfcoa1omDrlieilt teurirpiydlp n feias)srtmx  ;o1opxnmo3iydfs2elnmsn(4trerxo iadlpDrlies;(0trum(m oodlptnmivs s) 2rrx ooo4tpt  fciydfmDul(vsn()aetrircty1omtelivs;s0teuoxmpoo1am e fvta(f Durx  ;o1tet  ociadfs2rmuvs (4aexnir3oo1fa  livsls) 2toxm iudal   ncsls  rurxmont0altomf3tysls ua( pnt0artoxo oadfpDrluvsl()texoirpiy1omtnlicslt)aDtr(rpot4aeto feiytfs rmu pnu)tlxnmo ta1omtrlneils0t2uo(r oo4ape lnes s  Dur(  ;u4tet  o3iysfsDelnmpnt4 rxnmfctytlpD ai s;s) etoim ou4oltemfvsatfsrur( pnu0oleniociltfs ranvs ()aetrxr oa1oaD lues;(0 2trim3io4amenlfcslt)s2ta(  ;t4ape  ietadfs emums;t0alxomo3oodfm  luvsl() etm(m3ou1ope mivsatfs2uaxmooo1tpxnmoeiydla2rmnvs;(0areoxf tadfm  aneo s) eurimpiydomte ieta(fs2tmx  ;t1olxnmfeild mDem( s;u4aleriociodlpDean o;t  exo(m nu4am n ici s)s2raurpou4altoii3tasfsDrmuvsnu)treomo3oa1lpD au o (0seuo(o3iu4op elfcsas s2rmum nu1oexoif3iysfs ra(mpnu) exnmr iydlm raues;s t2ur(m nydlmtelfeiatf 2ua( oot4alxoiociysfa rl(ms (4 lxrxf tydomDraivi s0seuo(mpoo4lmtnmfetasf 2trumpnu0teeniicilsfm2elnvo u0aeeoxoctodfmt liei;()s2tm(m3nu1ap n ivsl( sDuru  ot0olt miciytlsDua(ms;t4aeenmr iodfatrlivs;s0teuo(o oo4amtelneiltf rraxm nu4tltn f3tlt mDrm( pnt) rtnxf oytlp rlnvo s s2toxr3oy4alen fcs s srrm(rono0aex ifciltfm2um( snu0tetrif tydla elivsl()t2toio iydoltnlfcs ( aDta( p;o0olxoii3tatfsDuluvsnt4 exnmf tytoateanvi (  etmxrpou1optemfctlt  Drru oou1optnmfciasfa uaumont) exnxo to1omDr ivo s trxm(m iodaltn fcia(f Dtau  nt0aet mfeiysls2ea(ms;t)artomo3iodfp  auvs;t0trxr(rpnydlltnmicsl()s2uaxm ;u1opx ioetytla2ul(vp;(0 lenxo todlmDr uvo t0 exm(o no4ome  icilt a2raxr nt0olenmoeiadlm um(monu0 rxrircty1fpDeluvs s0 etrirpou1al   fct tfsDrrump;u4tlto feiltlsDeanmo;(4artnxr3oa1oat  u s;s) rtmxr oodom n ictls)sDrmx  ou0aeenmi3ilsla2eauvp t0 reomfciy1lmDraneilt srxr(o3iudomtn nctls a2tr(moou1aleo i3iydla rm(vo;(4trenxocoy1opDr ivslt setoxrpoo4amt mnctlsf rtrxm oo0aeenmo3iytla ean onu0tlxnifcoadfatr i s t s2trxopoy1ol nlfetl(fsDrax pot4tleomoetytls emuvo (0altriociytfpD anvo;t0seum(r iu1ale livilt) Drrxrpnt4apt  ociyt sDumnvo t0tetrmrciotlp   u olt  etrxopiudlpte fvilsf rrmx  ;o0teeomociat aDeln pn()aetnifctodfate uvs;()t2to(o iudlptn neil()srraxrpnt0opx mfciysfm2ul(vsnt)texnmr iatomD livo t  2uoir no4omtnmfvsl()srrm(m nu0tptn fciad s umums;u)tleoxr3todfatrln i;s0 rumxrpiudomtnmics t)arrm( p;t1oex miciytla ul( on(0 eenio io1lmD lnes;s t2xr(o3io4lp nlfeiatf Dtmurpno1tpenioctld s2rlnmsn(0arxnxf3totfa e ivi;s0teurio ou4llenmfvilt sDraxm no0ape ioeilsfm ean pnu0trtnxf to1fm r uvi;s0 2urir3nydapenlicil(f Dtmxmp;o0tpt iicildlaDranmpnt0tlenio oodfmt  nvsl(  2xmio iy1omee nci ( srrm(  nt4alt iicild m uan p u4artnxr3ootoaDeanvils tetrxo iudam n ivt t s2umu  nu1tpenio3iltla eanmont)aetoifcoytfp   ueo s)s2xo(rpnu1lltelnvslt  Dtrxroot0teeoioeildla2rmums;t4 lxnxfcty1fpDrlivo t0 exo(r3oydolenlfet s)sDrrurpot4oex mi3iydfaDea(vpnu4teenmociotomD  u i (0srxm(m iy1ll   fvsas a2tmxro;u4oleoif3iadfa rauvsnt0arxoxocia1oaDeaieil(  rxrir oydapeelfcsa(faruau  ;t1oltnii3iltlm2ra(msnu4areoif oatfp  lnvi;(0s2tmir oo1altn fvia()s2ur( pot1teenmi3iysfa2umumo;t4arxnmf ootoptelu o s srtoxo oo1omenlfvsat)srra(rpnt0apx moeiadfsDrl(ms;(4 rxoir3iatlaD  i i;s  exoxo3nu1lleemies t arraxronu0aexo ociltlsDrmn snt0tltrxf3tadoa  ln i t)srtmxm oo4oltnlicsa(fsDraxronu1opx iociad s rlnmp (0 ltrmf iotfmteaivol()sruoio io1ll n icslt aDtr(monu0tlxomfcils sDeanvo t)tltoif iotomDelu i (0s2xoiopno4ome livia( arrmxmo;t0oetoiieiadlsDrmnvont4aexnxr iodopDeanvo;s s2urim3oy1lptemfvtltfsrrr( pnu0tpeo icilsls2rmuvo;u)tltoir3oo1lat lneo s srur(mpnu4lltn ivt t srumxr nu4texomf3tydla2ranvp u)arerif3iatfpt  ieo;s t2toxm ny1ol nlfet sfsrtrumonu1tpx mociydlm2el( snt4teermfcio1faDr u o s0setoxr oydal nlfvtl(faDraxm ot4oexomoeiyd sDumnms;(4 lenmr iatfp r nvi () exm(r iu1lle  ncils a2truro;u0olen oeiysfa2ra(mpnt)tltomr3tydfaDrlnvolt0trumiopoo4amenlfetl(f rra(ronu1oee mieildfmDrm( p u0trenxrcoytlat  uvi (0tetm(opiu1ol emicils arur(mont0alt  fcild s uau snu) rxnio ootlptranes ()trxrxmpoydam   ncslt artr(  ;t1aet  o3tld a2um( p ()aexoxo oatop rauvil(0 etr(o oudaptn fctat)arurxr nt0olxniociasla rlnvp t4 rtnmocto1op rai o (0teurxr3oudaptelfviasfaDta( onu1altomiciltfsDeanmonu4tetnxo oytfmtrlueil(0texmio ny1amen neiatfsrra(roou1tpx ifetltfsDumumo;t) rtnmo iadlmDrlies t  eurim iydolt  nct sfarta( o;t1oex  f3iyslaDeluvs ()artoxf3tydlpDrai o t trtmimpiudll emfetlt)a2rau  ou0apenioetasla emuvp ()altoif iytlp  aueo s)texmxo oo1ame lfctasfs2tmx onu1oetomfctltfa2ea( p u)teermo3ta1fm ranei () eto(mpnu1oltnmnvt (fsrrauro;o0oex  fciadfs ean o t) rxoio oydlate u o s srxm(mpnodop n fviat) Drm( o;t0oeen fcils s2rmnvs;(0trtrmr ootlpDe ies s)t2tr(m3iydomee fcslt) Dumu p;t0opeomo3iydlm uanmpn(0 exrifctydfa eaivo;()trtmxo nudol n ivi () Dtmx pno4aleomoeiad m2rauvs t)tleomf3oa1oateln i s0 eumimpno4opee ictlt) 2ra( pnt1altnmoeiydlmDelu p u)texrxr ty1fmtrlivs;s)seto(opou4lp nlnvsa()s2tmxr ou0alto octadfaDul(ms;(0aexnmr3iodomD livols0setr(m nodlpenmfet ()srum(r ;u4tptoiieiatfa ean p u0 etrif3totfmDe ueols0s2xrir ou4om n fei t)arra(r ot0optniictytfm2em(vp;t)trerif tydop e ivs;()srtrio3iydlmt lietl(fartrxmoou4tex  ociltlsDeanms;(4 renxo oytfpD lnvi;t)truo(r3oy4ame  fct sf Drmu pou4aee  f3tltla rlu pn()trtoio iodla   uesl(  rumir3ou1ome  netls)s2umu  ou0tlxnif3iytfa uanmsnt4arerif3iadlateln ilt0t2um(mpio1lmen iciat) 2ua(r no4optn o3ils sDuan p t)aeeoxf oodlmDeln s;s srxmxr3oydlm emfvi tfarumuront1tlxn iciyt mDuanvon(4texrif3iotopD  ieo;s sexr(o3no1ameelnvtl()arrrxr ot0teeo ociyt mDulu p;t)aeerio3ootoptrlneilt0trxoirpnu4lme liei () Drm( poo1optoif3ildla umnvs;t0tltoxocoadfa rai i s) exr(r3iudllee icilt) 2uaxmooo0apen ietadls emn p ()aexrxf3iydfat an o s t2toxm3oy1om nlnci sfa2tm(mono4opto i3iltls rlu ont4aetomf3oodlmtrauei t0s2ur(r3no4al elneiat)sDrrumpnu0opx iictytfs2raumpnt)alenifctydop eaueolt0tetoxm3io1ol nmivia( sDurxrpnt4oeeoioeildfm2emuvont4arxoio3tatlp rlu o (0trumxm iodaltnlnctltf rum(  ;t1aeen fciyt s rmu snu0trxomf iotfa  ln i;(0trxrim oy4am nmict s a2raxmoot4aetomf3iadlm rln s;t0tetnxfctatlpD luvo;s0 exm(m3oy4ole mnetls) 2rmurpou1apeomf3ilsla2ean s (0aleoxr3ta1lptranvi ()srxrir3oydopee netl(faDrmumpno0aetoif3ils s ua(vo;()tlxoio3iatoa r n s;(0trurim io4lp   nvia(fa2urxm oo1aleoiiciltfsDua(vp ()aetnxf io1oatr u il( t2tr(r3nu1amt lfetat)a2rax oot0tleo ictad a2ea(vs;() ltnxrciodlm  au s;(0 rtrxo3ny4olee icsat) rtm(mont0tpxnmo3ils mDrlump t4 ltoxf oytlpD luvo;(  2to(m oydameemnvsa(  2ur(rp;o0tpxniicildfaDrmnvon(0tltnir3tadoa  aneo s texm(m3oy1lpeelfei s srumx p;o1olxn f3tltlmDeaump t) lerxo3oadfpDrlivils sexm(o nodope  fet t  rraxm oo4texoif3iyd a2uanvs t)alerxr3iotfa r ues t0teur(m oy1lp e iet s)aDra(rp;o1alt mieilt m um(mo t0tetoiociadfa  luei (0teto(r oo4amtnlnvs sfsDrmur nt4tpt mieiydfa2eluvs () ltnmoctatla e ueo;()s2umimpio4olenmnvi tf 2tr(m ot1texniociysfm rmnmp;u0aleomo totop r uvils  rxo(rpoudome mfvsa(farrmurp;o0tlx mieils aDua(mp;u)tlxoiocoydfmt ai i;(  etoxr3no4ame  fetls  Drmur ;t4olt mo3ildfm2uau o;u)teerxrciydlmDranes;t  exoxo oo1op   nct (  2ta(r nt4teeo oeiytlsDelu on(0 lenmocta1fa rlues;(0sexmxopnudllee fcs s s2rax oot1oexoioeiltfaDrlumo;u)tltoif3tatfpDe ieo;s0texr(o3oydapt  ncs ( srumu  ou4olt  o3tytlaDeaump (0arxnxr3to1opt lnes s)t2xoio3iodllee nvtas) 2umx  ot4olx moetatfa ran p;(0arenmr tydlpt an ils0s2to(rpou1ap  livta(f 2umu  ;u4aexnmf3iatlmDulumo t4altrir3ootopD  ivilt0s2xmio oy1lmenmieia()a2um(rpno0tpt ifeiat m ua( snu4 rtnircoydomDr nvo t  exrimpno1openmieias  2rm(r oo0oexomi3iyt mDemumon(0 ltoxfcoa1lpDeli i;t) 2um(o iydlle  nes (faDraxrpnt1tpxn feiyslmDulu o u0teeoxfctydom r uvi;s)seuoxr3iudam  lfvt sfaDurxr ou0oeen i3tatlaDuanvo;u0 ltoxociodoa  aneo t0 exmim ou1apte ictltfartmxrp;u4tee moctadlm2uauvp;u)altoiocoytfmDe n o;(0seum(m3io4omt livtlsf Drmumono1oex  ocias s2eluvpnt4aexriociatlpt  i o t  rtr(r3io4lp nlneilsfaDua(  ;t1apenioetytls2uaumonu)texoioctydfp eaueols  2xoxr3nydoptnmieilsf rraxmont0apto ociyslsDra(mp t)tetoxo3iodom rln ols) ruoir ny1amee ivtlt) Dtaxroot1aex  i3ilt sDrmnmsn()aeenmr3tatomD lnvo;s  euoim3oo1al emfctas) 2taxmono4alxnioctys sDumnmsn(0 etrxo3ty1lp e ieol() rxm(o3io1omte fcs (f rurur nu4opt  octytfa2em(monu0tltnxf3oo1opteluvol() 2xrxm io4lmtn fvia() rumum oo1aexomiciatlaDrmumo (4trxnif to1oa e iei;t srtrimpoy1omt livtas) 2rmur nt1aexoiieiltfa2rl(mp;u)areoif3tydfpDelivi;s srtmir iudame lnvt t srrmu o;u4tlt  ociadlmDrlu p u0altnmo tatla e i o s trtmxo oodlp emncslsfarurumooo0oetoifeiydfa rl( o ()trxrxo iytlat anvo;()s2xrxmpno4opeemnesa(faDtmx oou4altn i3iad s emnvp (0 ltrxr tydlpte ivi ( tetr(r3iodolenmicils)s2taump;t1oeeniieiltls2emnmon(4tlerio iy1lmD  uvo s) rxr(opoodop  mivs tf 2rax  no1texn oetytfsDumn s;u)tlxnir3iodopt  neslt0 2xo(rpou1lmtnmnvtat a2rm(mpou4tpe  ieiaslsDuanvs;u0alerio3tytfatr iei;t0 2uoxm iudale miei (fa2uru  ou0tet mo3iasla eaumonu0 eeomf io1fm rlneo t t2tm(m3oudlmen fes ()sDtm( pnu1oltomieiydlmDemump u) eerio3oy1lmDelues;(0s2to(mpnudlmen fvtas sDtaxmpno4oex  o3tlsfaDelnvo;t4 exrxfcoydlat  i ol(0setrir3nu1op  lnvt tf 2um(mpnu1opx  ociytfs ul(msnu) ltomo oy1oaDrlnes;s trtoxo3oydape lnvi s)srraxro;u4aleoif3iadfa2rlnmo;(4 rtrxr iadlmtrln il( seto(r nudam   fvs t s2rmx p;o0oetomfeiydfm rauvsnu4 lxrxocta1fm e uei ()teuo(opoy1omenmfcta(f 2ra(rpou1olxnioeildfsDumnvpnu0 eeomr3iodlm ran il(0sruo(rpou4lptelfct s) 2rmx  ;t1apx  oetydfmDua( onu0 renxrcoodop raieils0s2trxm3nudamenmfcia()aruaxmonu4tee mi3tytfaDeanvsnt4 renmrciydopD lieol(  etmxr3iudalt lfctlt) Drmx oot4oleomfeilt mDum(msn(0tetoiocoa1oa  ln ilt)srumxrpnydape  fesltfartr(rono0tpeomoeiydfm2rmums t4treoirciytoatrli ol(0 2urim3no1lp  lnet (f 2tmx p;u0oetnmieias sDeln p;u0alxrircio1fpD lu i (0sruoxo3iodlltnmnetl()sDur(m ;o0tpe mfctls aDrl(von()tlenmr io1lpDrlu ols  2xmio iodoptelivsl(f rrrum ;o0ope iieiatla2el(mo () lenio tatfp   uvs;()t2toir ou4optnlneils a2ua(mono1aexnmieiydla2uaums;t0artnmr3iytopDrln o (0 eur(rpno4opt mncs t s2raxmont4ole  o3iltfaDranms;u0aetoxo3totoa r i s;(0sexr(o3oo1om nmfcias) 2tm( ont1olx ifctad s uau pn(0aetnmr3tatoa  anei;(0 2xo(r3oo4lp   ivt t) 2tr(rpoo1aetniietlt mDumuvo;()tltnmo iydfateanvs;t seuoim3ny1ap  lfcsatf 2umxr ;u4oeeniicilsfs2ua(von(4 lxoio3to1lp  anvilt)srxrim nodom n nesls  rra( o;t0alxniietyslaDrlu sn() eeoio3iytlmD  i s;s teuoxrpnydopeelivtas) 2ra(ro;o0oeeomoeils m ea( s (4arenmf tydlpDeai i (0texoim3nu1lp  mfvsa()srrm(ront4ole io3iyslmDeau p;t)trxrxfciydlp  aivsl()s2xoxo3oy1am nlnctl(f 2trurpnt0alxo i3iydfsDrlump (4tlxnif to1omDran olt0trur(mpoudoltnmnvi (fa2rrxm ou0oleoii3iyslmDem(vs t) lerif3tatomD livil()srtr(opno1lle mfeils)a2rmur ;u0olxn octlslm rau s u0 exnmf3oatlaDr n s (  2uoim oodame lfei () 2urxr ;u0oeenifcilsfs um(mo (0 ltnmf iy1opt lueo s)s2um(rpiodaptemncilt)a2tmu  ;o1tlto oeiatla ran s u4tlxnmf todomtrai i;t teuoxr oy4lm e fes tf Dumu  nu4ape if3ildfm2eauvsn(4arxnxo tytlp  lieils trurxmpiu1lp n icilt a2rru  oo1tpt ii3tadfm umnms;() lenmf oatlmDeaueo ()s2trxmpiodlmenmneil(fartmx  ot4altnifcias s ea(mp t4 rxrxfcto1opteluvols0 etrir no4opee ivta(  2umu pno0alxn i3tatfs2elu o (0 lerxrcoa1laDranvo;s0 rxrir ou4ap e fvsas a2urxro;o4tpxomociytla2ean p u) exoxf oodfptraieols0truoxmpoodam  lnvslt)srrr(  oo0tex  i3tys a2el(vo;(0 rtrmr io1fpDe n sl( t2xmim3oy1alt  fesat)s2rm(mo;o4tex mfciasfs2rluvsn(0aetomo oo1lpDe uvolt)srtrxopiy1ameemfci t)arum(roou1tlt ioeilsfa2ra(mo t)trtrxr3oy1oatrlnes;()texmxr3ny4olt lnvi ()sDrau  ;o4oex iieiytls uanvon(0 eeoxfcoadfat luvi;s) 2to(rpoudlleelivi (f 2uau oou4opxomi3ildfm ran p t4 eenxr3iadomDe uei (0t2xoxr3iy4lmte fvia()srurx pnt4texnifeiad a um(vp t0aexrxoctotlm rlivs ( srxoim3oudlptnlfeilt  Dta(r oo0olen oeiaslsDem(mo t0 eermoctydfaDrau s;( srxo(opoudlm  lnvslsfa2trx  ;o4tet ifciadlm2eanvs;(4trermf3totoat  uvs;( srxmiopnudop emies s)aDraxrpoo4oet mfeilt s2um( s;u0aexrir3ta1faDrauesls0seum(r3oo1llt lncs t)aDtmx  no4opto o3iydlaDel(vs;t)altniocootoa r n i;( s2um(rpio1ap e iesls srrm( o;u4alxnmociyt sDeau s t4 rxomf iytfpteli o;()srxrxo oo1ope lnvil()sDurxmp;o0alt moetatlm ean s;t4 eerir3iotoate nei ()s2um(m iodal  mfcias  Drmum nu1aexomfeiys s2emu pnt)altnxr totoaDrlies;t  eurir3oy1lltnlfci () rtr(mp;o1tltoii3iyslm eanmont) rtoxf ia1lmD aivsls  eumim oodoltn neias)arraxroot4tpxo ictaslsDulnvp;t)arxrif iydomte ueslt)teum(opoo4olt mivt s) Dum( oou1tee  i3tls s2el( pnu0arxrio3iodfmteaieo ( s2xoir iy1amt lfvsls)s2tmxr ot4oeenifciyt s umu o;t0artoxo tydfpt  n ilt0s2uo(mpny1ap nmfvs ()srraurp;u1tlenifctlt s2uln s;()artomo oodfmDr uvs;t srumirpny4lpte ici sfsrtm(mo;o4opx iociysls2elumon(0trtoxo3iodlpt li s;s)tetoio3iu1lptnmiei t)s2uaum no1openmiciasls rau s u)aexnirciodla  anvs t srxrxmpnydlp n fvias)a2taxmp;o1ale iiciydlm eln pn(0trenioctytoa eluei t setm(r3io4am n nesas)aDtmuro;u4tpxniictadlm2ul( p u)tetnmr3todfatrluvsls s2um(o nu1opeemneias srumumpot4apxnmiciysfmDum(mo u0 ltomrciotlatraivo ( s2to(opoydal emfvs ()artm(m nu1aet  ietls a rlu o;t0tltnio3iy1la eau i s0 eur(m3iu4omen ietls) rtru pnt1olxoioetlsls2ra(mp;t4altnxrciytoaDranvs;()srtm(mpou1al  lfcil()sDrmx  nu1aetomieiyt aDrm( s t)treoxociydlmDraivs s0tetrio3oydll nmfciat  rumu pou4ope iicilt a um(vonu4altrxo iatla elnvi;s)tetrir3oydlm  mivtlt sDrmumpot0olt iieiydfa2ea(ms t4 ltoir3ty1la   ueilt) 2umio nu4apen nvt tfa2ururono1opeomfetadfs2rm( p;()alxoio3oytfmtr uvs;(  euoimpiu4lpt mietasfsrtrur no4oeeomfctad a ua(vo (4 etoif ta1oa  aueo;( setm(o3iy1lltnmfei t) Drr(r ot1olenio3iatfaDrau p;u4 exoio3ty1fpteanes t trumirpny1apeemnvsat)aDtru p;t4apen oeiyd mDumu o;t)tlxnmocoo1lpte uvilt)tetrim3oy1llt mfcs s  2ururooo4tle iieiytfa ua(vo t0 rerif3tytoa rauvs t0s2tr(opno4om nmici sf Duaxmpnu1opeo ieiyt s emnms ()trenif tydla eaieo;(0 rtmio3no1amtemfes tfaDtm(mooo1apx mocilsls emuvp;()aetnxf iy1lpD  nei;t) ruoxr ou4ap n ivtat)aDum(mpot4ape mieilsfa2ea(mo u0 ltoxfcio1faDrlnvo;(0t2toio nu4open fctlt srraumono0olt io3iltlaDemums;(4areoxr oytoat an olt t2to(o iudap elivia()a2tru  oo1tetn fctltlm2rln sn(0teenmr3tytomtr uvi;() 2trir oodlp  mfct s sruau ont4oltnmietldlsDrm(mont4alerio3iodopte nvol( sexoirpoy4ol n fes (  Dtr(m ;o1apxn f3ias mDean s t) ltrxf oadlaDe i o s)s2xmir3oy4om nmnetlt)s2urx pou4opxnioctytlm ra( pnu) etrmo3iotopDeaies t trxoxr3nudopeelfciat)sruax  ;o0tlenmfcilslsDranms t0tleoxo3oodlpDeaneilt)trxm(m3iy1ol nmnvtat) 2rm( pnt1opxo ieiadfsDumn sn(4 etnir3iadomte ivo;()srtoim3iu1lpt  fvtls aDrr(  no1olto feiltfs em(vpnt4aeenmf3oytfptrauvol(0trxmxo nu1lmeemieia(fartaur nu0oeeomfeilsla umnmp () etoxr tatlatraieo s teur(r ou1alt mivsat) rua(  ;u4oetomfcilsfaDuluvp;(0 lxoif3totlpDe uvsl(  rxrir oo4ape mnviatfsDrmxmont4apxn f3tls m rlu p t0tetomf3ootlpDrlies;(  exmio3iydlpt lici (  Dua(rpno0oexomoeiatls rmn o;t0 rtomr3iotomDraivs ()t2xmxo3oodoptn iesls) rrmxmp;o1tleoiociyd s el( s;()aexnmf iotfm  lnvi;t texo(opiydoptn ncs s)aDta(r ot0ale ioeiydfmDea(mpn()alermf3ootfmt ln o;() 2um(rpiy1lp   iei (farum(m ;o1olx mo3tat m eauvpnt)aetomf iodlm eaivsls)srur(o no4llte iet (fs2ua(m ot1oeeomieiydla rlumpnt0areoifcta1faDr neo;(0 etmxm nu4ll emfciat)arrr(root0aexn i3iltls eanmp;u4aeeriociytomtelues ( setrir3ny4om nlneta(f 2um(ronu4openmi3iytfs2elums (4teeoifcootfa r uvolt0teum(opoudomt mici (fs2tmur ;t1tetn f3tatla uaumo;u)teenmo3oy1oa e ivils truo(o iu1lpee nci s artaxrpou1olx mfeiyd sDul(msn(0areoio io1op ran i;( trumio ou4alee ietat)a2rmumpnt1altomi3iydfs emnmonu)teeoxrcta1lpD lies;s  rtmxm3nu4lm n fvi sfa2ta(m no4apen oeiad sDelu p (0aexrmr tatfmDean ilt0seuoio oo4omtemfes ()aDraurp;u1alenmiciat sDem(mp t4aexrmrcoo1la ean i s) eurxr3ny4ol n ivilsfsDrr(r nu0tpxnmoetad a uluvp;t4 rtnio todlpt anei ( texmxopio4ale mnctatf ruau  ot1tlx mocildlaDrl(vont4aetnio3iytlaDr uei t0trtr(m no1llee fvsl() rtm(r ot4oeeoiociytlm2uln p u) exrxrctadomt aiei;s  exm(m3iy4apee ictls a2tm( o;u0alenmfetatla2elnmp (4arxnxr3ia1optr nvilt s2ur(o iu4am n ictls)srra(rono1tlt mocilsfa2ean p;()tlxomocoadoaDe nvo s)tetoxmpoydal nmivslt) rtaum no4tex mietydfaDrluvo (0trxomo3iatoptrai slt0s2urxmpou1opeelnvsl() ruru  ;o4tltomfeiat mDeau on()trxoio3totfptelneolt0srtr(r iy1lmtnmicsa(f 2um(  ou0openii3ilsfm2rlu onu0 etnmrctotfatr n i;s  rtrirpiydol  lfvtasfsrtrumo;t4apx  i3ilsfs ulnvp;u0alxomf to1op rlu o;s)t2tmxo3iodol e fcsasf Dra(mpou0tptomociyd m2emnmp;(4 lxrir3oytfm eauvils  rtm(o iu1optelivi (  rtmx  no4tlxomiciyslsDumumo;u)tlerxf iatopDeli o s) rum(r3io1aleemfes s aDuru oot0aee ifctldfm umnvpnt4 ltoxr3todop  au s (0 rtriopny1lpe mnvils) 2taxro;t0oeen fciasfmDrmnms;u0 lxrio3iotlm e nes s0 rtmimpnudal  lfcias aDuaump;t1altomoctatls um(vs t0 lxrxo3ta1fatr nvo s0 2tr(m3io1al elfeslt)s2umx p;t0oee mictatlsDem(vs;u4trxrmr3iydfaDrauvi t)sexrirpou1om   ict t) 2umum ;o0opeoifciasfa2uanvsn(4trxnmf3ta1oa elu s;s0trxm(o io4lle mivsltf 2taum ou0aexomieiysfm ul(mp;()tetrmocoo1oat lnesl()trtm(rpiu1amtn nvs s)srtmur ou4apeomfeilslsDeau snu) rtrxo3iydfa elieil() exm(rpiy1oleelfesat sDuaumonu4apt mi3iltls el( p;(4tleoir3totopteln slt) 2um(opno4al elicia()a2ra(mpnt0oexn oeiatls rauvp;t0 lxnxocoo1lpDe n ol(0setrxmpiodlmt  nctat)a2ua(rpno4oleoii3ildlaDraumpn(0tlxnio3tadfp rlu i s)sruo(o oodomtnlfesat arrrurpoo0tlt mictys aDra(vs u0tlxnir3todomtr ivsls)trum(opnodaleelfes t srtm( pnt0tltoii3tat a emu sn(4 lxoircoydomtraieo s0 rxoimpoo4ap emivsa()sDurxm ot0opt iieiys a2uaump (0tlermr3tydfm r ueo;s)sexrxrpno1omtemietat artmx  nt4olx iietys a elums;t4trtoircootfpt luei;(0 exoxm iydoptemivtas) rrrumoou1aetn oetasfa umnmpnu0 rxrir3oy1fa elnvo (  rtmir ou4oltnlfcsl() 2rau pnu1oexnif3iyd m rmn p (0 etnio3tydopD  ueo;t0 2ur(opiu1amee fvil(f 2rax  no0optoifetydlm2ranms;(4altrif3oa1lmt aieols  2xmxr nu1aptnlfvtls arrmxr ;o0teeoioetadfa2uanvsn(0aetoxr oodoaDr ieo;s s2xmxrpiudlpenlicsatfa2um( p;u0apxnmfctat aDrl(vpnu4alxrmf3oa1fmDrli s () rtrxmpiodop  mnctlt s2rrx pnu1apto ociys a2rmuvo (4 rxrif tytfpt  uvi s0setmir iodop nmfvtatfsDtaur nt4olt  f3iytla2rm(mp u4tleoxrcoydfmDr iei s0 exrxo nydllenliei tfsrua( p;o4tle if3tlslm em( o;(4trxnir ta1fpD  nvi;s)trtmim3iy1oltelfctlsfaDur( oou4tlt  i3ild sDumuvp;u4teenmf3oo1opDrluvols tetm(rpiy4aleemiesas aDrrump;o0tlxnifctas a2ea( p u4 rxrif3oadfpDrau ilt0trtm(rpio1al emneia(fsrurx ono0tpeomfetltls um(vs;()texnxociotop  lnei;t)sexmxr3oy1op  lfet ()aDuau ooo4ole mo3tlsla ea(mp;()tltrmf3iytfa eli il()t2ur(m oudapt mncsa( artau o;o4tle mf3iat s2ua(ms;t)trtrxf3oadomt ai il( texoir3iu4opte iei t)artm(m ;u4aeeo octlsfaDelu o u) leomfcoadopD  i o;s)sruoio oo4lpenlivi () 2uaum ;o4oexo oeiyt s rlnvsnu0aexnmr3oydopte iesl(  eum(r3iydaltnlnesls  Drmurpot0tleo feils mDea(ms;u4tltoxo3tytomDr n o;s0trur(m3iu4omt  ies ( s2urxr ot0alxoiictasfmDrau s;u)aleomocoytfaDrluei t)t2tmir no4llte nct sf 2ta(rpou0oetn f3tatfa2um(mo ()arxoir oytfaD  nvs;t  etmxopny4opee neias arra(rp;t0oee  octad s emu pn()trtoxo3oadoateluei;(0t2xo(m ou1lptnliesl( aDrmx  ou0oeeoifeilt mDum(vpnt)aeeriocoa1opt ln o t  2tmxm3iu4lltnmivil(faDrrum no4tpe io3iat sDrl( s;()trxrircoa1fm  auvs;() rurxo3ny1lptemfctas aDtmxrono0tlto ieiyd s2eanvo u4aexnxr3iydomD lu i t0 rxrir3iy4lpe  fcsl(f rra(ro;t4tptomfctydfs2elnmo (0 eeoio ia1laD aueolt t2xm(o iy1ome lnetls sDum(rp;u1tlt  oetltfs2rm( snt4tetomf3oytomtr nvs;() euo(rpio1ap  lnvtasf 2tru  ot0oetoiictltls umump;u0arerxf3tytlm  aueo;t0s2xrim ny4lp emics t a2urxr ;t0texnmfciyt sDum( s;t0artoxrcoatomDr n i (0setr(mpiydale  nvtas s2ua(moou0tpxnmociasfm2emuvpn(0 eerio3ia1lm e uvi;s s2um(m3ny1ol  mfvils aDraxmpoo0optnifeilt mDemums t4 eermfctatlp eliesls)seurxo3no1amtelnvslt  rumuroot4aeenmociytfaDrmnmo u4alenmo oa1lat ln s;()tetmir3io1lm elncs t) rrrx  ou4alt mictltfm ran onu)altrioctodla eau s;s0truoxm3oy4lmenlnvia(  2rmxr ou1opx if3iaslsDelumsnt0aexrmf to1fmDrlivi;( srurxr3iydlpt mncta(farrrxr oo1aptnio3tltls2emnms t)trxrmrctadomt luvi;t0 etmxmpnydamt livsa()aDrm(r nt1aptnii3ildlm2emu o ()alermf3oatfmD luesl(0srtr(o io1al e ivi t  2rru  ;t0tle  o3tytfm um( o;(0teeoifcoodfp rlivilt  2uoim no4lm  lfvil(fsDtaxmo;u1ale mo3ils a eau o;t4 etoirctotfmD  u i;s0s2urim iu4lpe mnetas s2urxrpnu4olen o3iadfsDrl( p (4artnxo to1fmD  ies;s trxrxm3iy1aptelnvtl(  2ur(moou0aetomi3iydfa ra(mpnu)tlxrxrcoy1omDrai olt0texrir iy4lpt  nei (faruax pou1texniociysls2rlums;()trxnmo iodoa eau i s trtmim nodlpe licsls  2rmu  oo0tpeoif3iysla ea(vo u) lermf tytla   uvsls seuo(o3ou1omeelfci (faDururpno4olxoii3iyslaDrlums t4tlxniociydlpt  n i t  eumio iydap elfcsat aDtr( pou1tpenmoetys m2eauvs t)trxoir tydlpt ln o (0trxo(m3oo4ap  mncta()srrrurpnu0tet  ociydlsDrlnvs;u)alxnmf ty1faDeaiei ()sexm(m3nu4alenmivi (fa2uaxr oo0tet  ietld sDelnvo u4 etrxfcoytfmtelueol( trxo(m3iodlpe lfvsa() rurxm ;u4oex miciltls ua( p;t)alxrxrctytlp rlu o (0 exoio3io4llt lneils s2rrxrpno1alxoiiciltfsDemuvp;u0tltrxr oodlm r uvils0 rxoirpiodaltnlfciasfarururpoo4oetniictyt s rm(ms;t0areomo oa1lmD  ivi s0 rtmimpnydoleelics ( a2rr(rpot4oltnmoetasfs ulnvsnt4artnioctydlm elnvi (0s2xoxopny4ol  mnes () 2umuro;u4olenmfciys a2eaumont4trxoif3oatfpD lnvil(0seumim iydam e nvilsfaDrrxmont1olt  ocildls2ran p;t4trerxocoatom rlu s;s  rtr(opny1opte fcilt srraxrp;u4aee io3ild s2ulumo u)arxoifctodoa rlu i;(0sexm(r3nu4omen fcta()artaumonu0olxoioetasla eanmp u)tltoxf oatlmDelnei;t0t2tm(rpiy1lpenmnesat  2ta(mpno4oetnmoetyslm2eanvs;u) leoxoctadlp r uvil(0s2xrxm3ou1aptemiesls)sDtmx pou0oetnmo3tld a2ra(vpnu)aexomr3ty1om e nvi s0s2ur(opoo4ameelivsas)aDuax  ;u0open fciyd a eanvsnt4altoxfcoytop rln o;() rtoio3nu4lle livs ()aDtaum ;o4tleomieiadla um( s;t) eenxfctodfpte n i t0 rxr(r iu4ap elneslt arra(mp;t1oeenmoeiytfm2elnvpn(0tlenmo3oytlm r i slt)teumimpnu1op eliesatfsrrrur ;t4aex mfeiys s eanmpnt) lenxo3tydfm ean ols0texoxrpoydop elfesls a2rmxro;u1opeoifctlt aDulnmp;t) lerifcio1op eanvo;(0seur(r no1omte fesls)sDra(r ;u1tpx mi3ilt mDeluvsnu0tltniocoadlmDelneo s0t2tmxmpnydamenmieiatf Dur(  nt0altomoetatls2ean p t4arerxo iodlpD auvil( tetoxm iy1olt licsl() 2rrumooo1texnio3iys a2uau s;(0alermrciadlatranvo t0 2xmirpou4ap  mfeil()a2tmumonu0alxn iciysfa rm(vont0 lerxr iy1fmtr ieo;(0 eur(o3ou4olte nvia()srumuronu0tlxo oeilt a2emumont0 eenxf3todfpD lneilt0srtm(r iydole mictatf 2rax oot4alto fciysfm rlu p u0altnxo3iydopD aies;(0sruoxr3nudoltemiesatf Duax  oo4optn fcilt m ua( s;u4trxriocta1op eli s t) 2trxr3iudaltnlnctl( sDrrumont0tpt  i3iytlaDrmuvon()tleoio3iy1laDrlnvols0 2urio3no1aptn nvsas a2ua(mp;o4tpxoio3iad mDel(ms;u) lenxf3iadfmD aies;t)texm
\ No newline at end of file
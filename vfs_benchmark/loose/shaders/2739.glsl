@@ -0,0 +1 @@
+ivo ()t2urir3oydlm emfeta(f 2umxmo;u0tltoiictysfaDua(mp;t4teerxf to1om  lnvo (0setrirpnu4opeemnci ( artru  ot0tlenmo3tldfmDrau sn(4 rxnmr oy1lmtelneo t)trto(opnudoltnlnci t)s2rm(ronu4tetnmfeiadfsDrlu pn(0trxrio tydoatrli o (0s2toxopiodap nmiei t) 2tm(mpou1optn oeildfsDrlnvs;()arxnmrcoa1fm eauvo (0s2tm(r no1opt lfcilsfs2um(rp;u0tee iocias a emuvo u)arxoxrcoodlmt aues;t0t2ur(mpiydoltelfcta(f Dtau p;t0tltnmociyt a2umuvo;()texrxr3iodoateauvs s trurimpou1lmenmfct tfs2urxmo;t1aet ifeias m elums t4 ltoxf totfp  li s (0 rto(mpou1lm nmicsl(faDtmumont4aptoifctld m ranvon(0alenmo tatlat livi;t)teumim oy4ol  lfetltfa2uaxrp;o4aex if3tyslaDeluvo t0tltnxfcoadfate u s ( texoimpnydlleelfvt sf Duaurono4tlxomoetlslsDumnmsn()artnif3tatlmD lueil( t2ur(r3oy4ome  feta(f 2ta(rpnu1tlen iciyslm eanmp t)aeermf oo1optrln i;() exoirpnydlpenmnet ( srta(m ou0tlx ioctldfs rl(vsn()trerxo3oydlpDrlnes (0seuriopnu4lltnmfvil(f rurxmpnu1ope mo3iadfm ra(vp (0 rermoctatfpDelues (  etmxrpnudlp nmncilt)aDtmurono1texnii3tatfs raumpnu0 lxoif tytoptr ivi t)s2xoxr oodol e nesat  2rru ono4alen ictadfsDrl(ms ()treomfctotopt  uei t)tetm(mpnodom emneslsfarrmx  ot4oetnifctatlmDulnvs t0 leomfciy1fmDeaies ( s2tm(r nydapeelfvs (f 2taxmooo0apx moeiydfm uanmsnt) lerxocio1oat an slt trtmxo3no1ap  miet s  2ra(r ;u1aeeo f3iadla2ea(ms (0 renio3oydlaDr i o;s) 2xo(m3iodome lfvsltf Duau pnu0aexomo3iadlaDem(vo;(4areoirciotlm raues t trumio oydol  mnvtl( sDrruro;t0aet mietlslm2uaumpn()teenmrcty1lmDrluvs;t0s2xmim ny1lle lieslt  Dua(  ou4tle  oeiydfm rmu o t0trxnxfciotomDrai s;s  2uoim3oydllee fvtat)srurur oo1teen feiytlm raump t4 rtrmocta1oaDraues (0 etr(rpnudoltn iesl()aDur(mp;o1ope iiciysls2eanvs;u4 eeoxf3iatla eanei;( s2tmxo nu1apen icilsf 2tauront0teeoiociyt s rm(mpn()tetnxfcoatla rlu s;(0t2toxo3ou4amt mnciatfs2ta(roou1oeenioeiytfs2eluvs;u0alerir tatfp rlueo;t)texoxmpoudlp n ncs t a2taxm ot4tleoifetytla rlnmo;u4artoir tytlaDeanes;t sexrxo3iu1lptemfvtlsfsDtaurpoo0aexo o3ildfs umnmont4trerxfciydop raies;t t2to(opno4aptn ictas  rumx  ou0opxnmi3iatlmDemn pnt4aeeoir3oydlateluvi;t  rto(o nydape mfvsltfsDrmxrpot4tlx mfeiydfmDum(ms;(0trerif3iadfaDeaues;s  2to(r3ny1altn fci (  2trxm nt1opt mi3tldls2ra(mont0artrmr oo1omD  uvo ( s2trio iudap elfvsat)a2rr( o;u1oltoioctlsfm rau onu0tlenmfcoa1laDr uei;s)tetm(mpiy1altemicia( srraxmoou1tltnioeias s rmnvs t0aetoifciydlpD lu ol(  rtoimpio1lmtelnei ( s2tr(  nu4texnmoeils a el(mo;(4 lxoio oatlm rln i s)texr(r nu1alee fcsat)srumxmpnt4apxnii3tysfsDea(ms;t0arerircoatomteli il(0texmxrpiy1lpenlict t) Drm(m ou0oexomfciasfs2rln o ()aexrxo3tytopDrln s;(0teto(r oo1lltnlfes s)sDurx o;t4tlt ifciydfs2em(vsn() rtrxocty1opteliei s0t2umxm3oo1oltn fcs s a2umurp;t1oltomoeiadla ra(mon(0 leoif3ta1omt  ivilt srtmio io1ap nlfeiat)a2rm(m no0olx  ieilt m rmnmon(0 ltomo oy1lmD anes;s) rtoxrpoudapt  ies tfs2raxrpnt4olenifctyd mDrluvp t) rxrxfcoydlpt auei;s0 2tm(o3iydam elfcta() Dur(m oo0opeo i3iltfs2raump;u)trxnxfcta1omDrlnvil()srtrim3iodlp   iet (f Dtaum ;t0teen octad s rmu s;t0trxnmrcia1fmDe i o t  2xo(o3oodamenliet t)aDur(r no4tpx iieiysla2umn s u4artrxf oytomteaieolt sexmir3io1ome mivsl(fa2tmxmonu0alxoiictyt sDeau sn(4teerio3oytfa rai o;()texm(r3ou1optelnesas  2taur ;o1olenmiciys m umn s;t4 rtrmfcootlpD  i i s) 2toxmpoodaptnmictl(faDrrxm ;o4ale ifeils aDeau snu4tlerircoo1laD luvolt) rtmxopiy1llenlnvi t) 2umx p;t0openmfcildls2rm(vo;u0alxomocoodlp elnvol(0setoxrpny4oleelfei s) rta( pnu0tex  ieiysfs2ua(vpn()altoxrctotop rai ols0sexoio3oo4op elfvtl(  rtm(ro;u0opt moeiadlm eaumont) rerio oodom  auvi s)tetr(r3iydll e ies s  Dumumo;o4tlx mfcilsls2em( p t0aeerxfcoytopDr nvi;(  eumxo io4lm  mnesl(fartmum ot0oltnioeiltfsDemnmo;(4tetrxfcoy1om r uvs;t0t2tr(o3iy1omen nvtlt) 2ta(rpot0tpxoiociltls2uauvp u4trxnio oydfp r u o s0srxoir3io1omtnmivt s  2rax pou1tlt iiciatfaDuluvs;t0teermf tadfa raneolt0s2xmxrpiu4ameemfvias)s2tmumpno1aptnii3tytfmDemnmo (4 lxrif3to1latr ivols srurxo iu1lpe lfvsl(fa2raxroou4aleo octysfmDemnvpn(4 etrmo oa1op eauvslt)teurxrpiu4lptelncsat  rumxm no1aleo ietls mDemnvp u0tlxrio oa1lateln i;s0srumio no4altn ivsas)aDtauront0tpeoiietytfaDem( p;(0 rxnio iydfa rlieo t) etoxo iu4aleelieiat) Dur( o;o4tex ifetlsla uau s u4 eenxr tadom eluvs;t0 2xoxr iu1olt mivsl() Draxr no1apeomieiltls rauvsn(4 rtnmr tatfa  luvs;s)s2umio nu4lpe mfeslt)srraxmoou4tptoii3tldlm2uanvpnu0texnio3oa1lm eaiei s  2urirpiy1am nmnesatfaDrmu ono0tpxomoeiadlsDum(mo;u4teerir3oa1fatrau o;(0t2trio3oy1ol nlfvt (  2rau o;t1alt  o3iasfaDulnmp (4tlenif oodlmtr ieo (0setrxo ny4lmee fvil()sDtr(rp;u0altnmf3ilslsDua(mp u4tlenmo3totfpD luei;t0setmxr3oo1ome  fvi t aDum(root1apxnmocilt a2rln p ()teenir3todfmDr i i;t trtrxm3oy1oleelnei s s2rax  nu4aetnmfctyt mDumump;u0alxnmociadlm raueslt srxrio oy4ap elnesl()a2uax  ot0altn iciatfa2uau sn(0arerif tytfp  anvi;t0srumxo3iudamenmfcilt)aDtrxm ;u4opx mfetytfsDelumpn(4 rtomo3oatfatrluvi;t)teum(m oy1ll  lfvil()aDrrx  ;u0tlxomo3iadfa ul( p u4artnxfcia1op rai s (  etoxo nydapt  net sf 2rmump;t1tlt if3ils s ulu s u0 rxomf3tatomt aivo;s  euoxo3oy4lmtn ncsl() ruax p;o1olxnmiciasfm eluvsnu0teerxf3iotopDe uvo;(0truoim iy1ll   ivta() rrm(moou0alenii3tadfm2ul( p (0 rtoir io1lmt ai ols setr(o3iu1lp  lfvsas)s2tm( ooo4oex mi3tydfsDem( p;u0tetnxf3oatop rai s (0trxr(rpou1ome  icia( sDtaxmpou4tlenmfciltfm umuvp;t4aeerir ootfa e i ilt)s2um(o oo4ole mneslt sDuaumoou1tpe mfetys a ulnmo u) lxrxf iodfa   nes;() exr(m oodlmeemiviatf rrm( pnu1tlt  oeils a rl( snt)trxrio3oy1fp   n il()srtm(m3oudlltn nvs s) Durumo;u1aetnmfeilsfs2uluvs (4tlenxo oydoptraneols) 2xmxm ou4ol  mnciasfsDrm(ronu0tpto octlslmDrau s;t4 leoxo tadlmDelnvo;(  rtr(m oydap   ncils  ruaur ot4tpx miciyslm ean ont)trtnmf3ta1lpD auvols  2xmxm nu4ap emfvtas arua(  ot0tpx moctldfa2rln s u) lerifcto1omDrluvs s0 2toxo oo1apeelncsat artr(ro;u0tptnmf3iatfa2ulnvont)tltoxf ia1op eln o;t0 rurxmpio4alt lncs (fa2rm(mpnt4olxomieiysls2rl(ms u0tlerxfcoy1oa eanvo s)srtmio3iydlptelnvsl( srrm(m ;o0oex  fctadfa2elu pnu0alerxociatla  anvi;( srtmxmpoy4lp n iesl(  Dtau pot1oee if3ilslm ra(vs t)trerxr3oydlmDelu ols tetrxm ou4ameemnet t)arua( pnu1tpxn f3iaslsDemump t4trxrmo to1fpD  nvs (0 eum(r3oodop elivs tfsrraxm ot4tlenifctas s ulumsn(0alxrxf3iatfatean olt) rtmxr3nu1ap   nvilt srurxmoou4olxn oeiatlmDulu p;(4 lerif3to1fmt  ueolt s2uoxopny1oltemnvslt s2rau p;t1tlxn fciysls el(vpn()teeoif3iydfmDelueslt0s2tmirpno1lm elies t s2umxmpoo1tltn o3iydfmDeln p ()treomf oo1latr ueo s t2umxopnudoltnlnet sfs2taum ou1aptnmi3iatfs eau on() exrxrcootop  lneolt  ruoim io4lpeemfvtltf rururpoo0aeen feiys s umuvont)altnmr3iodfaDrluvs;s)seur(o oydom n nviat) 2trxm nu0apt mietyd s2rmump;u4 reniociy1lmDeaivi;s0s2xo(r3ny1lmt mfeils s2uaxmpot4aex mi3iatfsDel(ms u0areoxo3tatfm r n i;s) etoir no1apte fes ()srrau pot1opxn ociat m ulu sn(4texrxfcoadfatr ivo t0tetm(rpiudap nmieil(fsrrrxmp;o0opxo fcilt m ra(vp;u0 lenxf3oydopte ivs;() etmir3iodlm e fcs ( arta(  oo1opt ioctlsla2rlums t4arxrifcty1faD lieo t srum(r nu4altelivilt) 2trx oou0tpt  oetyd m raump (0 eerio oa1fa elieils tetoiopoydlm   icil( arrrxm no1tet ifctldlmDrlnmo t)tltrir oadfm r n s s0 eto(rpou4am emictat) 2trump;t1aptnmfeiysfaDelnvonu4tetrxo oa1om   ivs;s  2to(m3nodlmen fvsas artax  no0optniieiasls2emumsnt0 exnmrcia1optr i i t0 2umirpnu4lm nlnviatfsrtrx pnu0apt  ietyd a emn s (0 eermr ta1laD luvils0srtrxmpno4apte nctasfs2rmu p;u0apxomi3tadfaDrl(mp;u0 eeomf oydlptelnvo s0seurxr3iodom   feta()sruaumoou0oltoii3ilsfa2umnmp;t0 rxrmf3iydlaD lu i;t0trum(mpiydll n fvias)sDua(mono1alxomfeiatfaDeanvo;u4 ltnxocto1fmDeai sls0srumxr3ou4ll  mivt ()sDurumo;t0ape miciadfs2rmn p t4 etnmoctydoa e n s;t)s2tmim3iudolen nvias) Durxmpnu4tlt mieiyd sDulnvp (0 rtnxocia1op  li s;s0 rtmxopiodlm   fctat)artrx oou1tlxomiciyslaDrl(mont) rtrmf3io1lm rln o s0srumiopno1alt mfvi tfsruaxmoot4texniociasla2eluvs;t0trtnirctotlpt  ieil()tetm(o3iydlmt mfctat) Drr(mpoo1olenmf3iltlsDea( p;()tlermf oatfm  aueols) exoio3io4ol nlicsa(fs2ur( o;o4aee mo3iytfs ra(vpn(0aeermociatlaDranvi (0t2xrio iudame licsl(  2rmxr oo0tleomf3iydfs2rln sn(0aeerif oo1lm e uei t0 eurxr ou4lmtn nvslt sDrrxrono0tpen oetat m elums;(4tlxnmr3to1lm   n ilt0trtrir oy1ole mnesasfaDrrxmooo1tlx  ietls sDean on(4 ltoxf oatfmteaueo () 2um(o iu1oltnlnesas  2ur(rooo1oexo fciaslaDrmnmp;u4 exnifcty1oa eaues;s) eumim3nydlpe micil(fs2rmxmooo4ole  i3iasfm rl(mo (4 exoxr3iodomteliei t0teumiopou4op nmfct s srur(  ot4oeenio3iad mDrmnms u)artrxocoy1lp rlu olt0tetoxr oy1aptnlfet tfsrrru ont1tltn o3tys a2el(vo t4 lxnmr3tatopteanvsls  rxr(m3no4op e fvs s sDrm(m ;u4aetoio3tad s2emuvs u4alenxfcia1faDelnvi (  eur(opoodal n neils)arur(m no4texn oeiasla rm( s;u0arxnirciotfpDe ues s)trxmim iu4om  mnesat)s2um(r ou4texnifetltlsDelu p t)aetoir ootfp   ueslt  2uo(o3nu1lltemfcsltf Draurpot4oetnioeiydlaDumnvs;t4 rxoioctadoaDeluvo s)srtoxmpou1lmenmicsas  Draur ;o0aee  oeiyt m rmu s (0altomo io1omtean s;s0srumxr oo1al  lfvils)sDuaxmoou4ole io3iad s2ra(vs;(4 lxoifciytlm   i olt0 etrxopny1lpeemnctl( srtmxr ;u0teeo ieiyd s2ul( o t)aeenmrctydomDeaivolt)setrimpnodlmte fesasfs2rmuro;u1tetomfeiytla em(vo u0 rxrirctydlpteauvi;(0srxmxo3nydlp n iesls)a2tr(  ot1tptomfetatfs2rm( p;() exnxo3iadopte i i t  etmir iydapeelieta()artau  ;t4oltnif3iltlsDeanvp;u4 ltoxf3iotfa raneslt)teuoxo3oy4lm emfvsa()arrm( pou1aptnmicilt m rm(vpn(0 ltnif3ta1lmteauvo s) rumxo ou4al nlfcsas artax p;o1alxn ocilslm elu p;(0aexomrcoo1omt auvi;()texmxrpnudapt lnvtls)artr( pou4altoifctat mDranvo u4trerxr iotoate i s;t)sruo(opio1ap n fcil(farrm( oou1tleo ociyd mDrau o (0altrif3iotfmtelivs t0t2tm(o3iudlm  lnvsltfsDuru pot4oex mfeildls2eau o;t4 lermr3oo1om rlu s t srur(r3iu4op  lneilt)s2trurpot4texnmf3tadfm2ua(vp t4teenmr3oa1opt ai i;(0 euo(m3nodal   ivi s  rtr(  ot1alen ieiys m eanmp (4tltomr3iotoaD aneil( sexo(opnu4ame lfeta()srrru pnt1teenii3ils m uan ont0tetrmrctydfateli i t0truo(opiydom n fvtat sDuaxront1teto ieildfmDrmump;t4aeenio ootop  au sls) rtoxr oodope mictl()s2rrxmp;u1oexn f3ils s2ul(ms;t)tetrio3oa1fm eauvs;()sexrxm nu4ole mncsat  rtrxmo;u0oee mi3iadlsDeaums;(0tlxnir3oo1oa rai ols)t2urxo3no1am nmfvi ( s2raur no0aleo oeilsfm rmuvp t)alxomo iotomD lu ols)teuo(o io1al  mfei (fs2taur ot1opeo i3iyt a em( o;u)tltnir3tadomDe i olt srtmir3iodalt lnvils)srtax pno1tee mociatlm uanvs;u4 ltoif3oydom  auvo ( seum(opnudlptemiesls)a2urumpno1oleniieiys m umnmo () exnir ta1late ivsls)t2toxm iodalenmneta(f rta( oot1aex  fciadfm2emumo;t0 reomo3oodoaDrluei;s) 2xrio nu1ll   fciat) rrrxmpot0tpx ioeild a2uaums;t4 rxoxfcoy1lptrln s;t)s2urxm no1lm  mivs t sDta(m ;u0tlxnmfciytls rmn o ()trtnmociatlpD lnvs (0trxm(o iudopenmfei ( srtr( o;u1oetomoetldlsDel( s;u)altrxf tatla eli ils0 2um(m nydlme lfeils aDuau oot0oeen iciltlaDrm( o t4arenmrciadoateli s s  2xmimpiy1openlnvtlt s2tm(rp;t0aptoifeiyslaDuanmo;(4areomrcoy1omD luvi;t0trxoiopny4op elivt () rrmxr oo1texnii3iydfsDuauvon()artoif3oytfm rlivo;s seuo(o io4al n nvtlt) rtrur ;u4tleniieilsla ul( o;u4tlxnircoy1oaDeli il() 2ur(m3iodlmt lfei t  2rmu pnu1tle moeiad a2ranmpnu4tlxoifcoa1lat auvs;t)trumxr io1altnlncs s)aruau oot1alxn octlt sDrm(ms t4alenio3oodopDeanvs;s) exm(r ou1amenmictls sDur(mpno4oeeomocildla2eln onu0 ltnxrcoodoatr n o;s0 etmirpoydaptn fvt tfs2tmu ont1tpxoiiciadfa ea(vo;(4 lxrmr3tytlm  an o ()sexrxr3oodam emncslsf ruaxrpnt0aetn o3ildfm eln on(0alxoir iydlmteaneols)seur(o3nodomee ivtltfarrr(m no4opeoiieiadls2rln s;t) lxoxf oadom elies;t)sruoxopiu4openlfeil( s2rrurp;o1tlto oeildls rmu pnt0altrmr oydlmt  u s s0sruo(r3ny1lpen ncslt sDurum nu1opxomoeiltfa2ranmsnt)alxnir iy1fpDr i s t0 exoxr iudlptnmfviltfaDurxrpoo4oeeo ictld s2ea(mo t)arenmf oydfa eaivs;t  rumim3io1optemieia(faDrrum ot1apxn ieiytlm eaump t0 rtrir3ty1lmte ueolt) 2uoxr no1opt  ietls) rum(mp;t1olxomi3ilsfaDelu pnu)teermrciodlp raieol( trtmirpno1olen iei s artmxrpoo0tlen iciydfmDulums;()tetnmrciodlmDrau s;(0s2toirpiu4opt  ncsls) rrrxrp;t0ope ioeilsls2rln o;(0 reoxo oy1om  aueol()s2urxo3iu4lpt lnci s)arumx poo0apxomociytlaDrmuvonu)tleoxrctadfaD  nvo;t trxm(m no1ll nlivsa(f rtrx oot0tltnmi3iad a2ra(vont0 leoxf ty1op ean s ( tetoxrpny4omtemicia(  rtrur nt4tleo i3iaslaDulnms t)artnmf iydla rai s;( s2tm(r3ou1ame lfesatfarra(rpnt4apt mfciltfs ulnvo t)tlxnxr iytfpD lu olt) eumxo iodomen nvi t sDrau p;t4tptomf3iys m emuvonu4 rxoir3tadoa e uvi (0srumim3io1opeemivs ( aDumxm ot1tlx mocils a um( p (0areoxr3ootlpt au s;s0 2tm(m iy1om nmfcil()arumu pnt0texniociad mDran onu0 eeoio3todop   ieil() 2xrxr nu4lltnliviat)aDrrx ooo1oetomfeiasla ran snt4tltrmr3tydfp e ieo s setmirpiy1ll emici tf 2tmum ;u1tpx moeiadfsDeauvonu0 etrmf3ootfmtrli o (  exoxrpoy1op  lnctat)aDurumo;o4alenmfeiadla ulu sn()trermo io1laD ln s;()setmxm no4openmivta(  Dururp;o1opt iicildlmDelumpn()aeeoxfcoa1lmt  nvsls)s2uo(opio4ll  lfcs (fs2rr( pno1aptn o3iatlmDel( o t4aetomocoatop rlnvi;t)trxrxmpoy1apt  fei t) Drr(ro;u4olxo octad m2ul(vo;t0tlenxfcty1lptrlnvi s0 2xrxo nu1ol e fvs s)srurx ooo0tlxo fcilslsDeau s t0 exrxf oadlaD  nvi;() rxr(o no1ape mnct t  2ururp;o4aetomfetld s eanmsnt4 lxriocta1lat  nvi t) eto(r iy1om elieta( sDtru p;u0apeo oeiadla2uanmo t) exnxr tytlp e i s;() rxoxm iydlptemnvia()aDrauronu0apx ii3tasfs2uanvp;t4 rxomf3iytfpt  n s;s0 rxr(rpny4omte nviat)srrmx  nt1tpxoifeiyt s uln pnt0tetnxociatoaDeaivs ( tetmimpoo1omee nvsatfaDra( pnt0olxn ieilsfs2rauvo (0 lerxociatlatrlnvi s0srtmxm nu1opte nvi ()aDrmur oo0aleo ocilt s umums;u0 rtnifcoo1om e ivs (0seuo(r ny4al   ieslsfarrrurpnu4opx moeiytfm um(vpnt0trenxrciatfp r neolt)s2tmxo3oo4ome  ici (  Dtr(rpou4oeeo fetytfm2ranvo;(4aexrxf io1fa r ivi (0srxmxo iu4opt  fesa(fs2ur(mpno4tle ii3ilsfm2um( p;t0 lermo3iatoa r nvs;s)seumxrpio4llen fctat)srrm(rpnt1oeenmi3iys m2umu p;u4altrir3iatopD anvo t)s2uoiopiu4op  lfetlt) 2rmump;u1apt mietas a raump u) exrxo3iodlmtranvolt s2toxm nydllenmiesa( sDtrxr ;o1opxnmf3tldls uln s u4 renxr3tatoa  lnei;s0s2toxr ou4omt lneia(fsrraxmpou0tlto octlsla ua(ms;() lenif ia1faDeluvilt0trxmxo3iu1opeelicsa(  rrmumpoo1oltn ictlsfmDem(mo;(0alerxocoa1om raivs;t0tetmxr ny4llee ici s  Dtaxrpou1olen i3iasla2ul( pn(0 lxrmf iytfaD auvsls setm(o3no4alen netlsf Drrxr no1tpt moeiysfa2rmn ont4altoircoy1fmtr u i s0 exoio ny1llenlnetlt)artrurpnu4aeenmoeiltls2eln o t) exomfcta1lm elnvi t0 2tmio oy1ll elncil(fa2trx oot4tlxomocils s raumonu) lxnmr3oatfaDelivo;t  rxrim nydapte ivtltf Duaumpou0alenmoetlt a um(mpnt0aetomf oodfpt  nes t)setm(opoo4op  lnvta(  rtmxrpnu1aeeo fctytfsDrluvs;t)tetrmocta1late nvs s texriopoudlme licia(  Drmx ooo0opxn feiatls raums;(0tleoiocootlaDe nei s0sexo(mpiu1optnlnesl()srrmxrp;t1aleo feiltfmDuanmsnt)alxnmo3oytfat  uvslt)seuoim3nudam   fes t)aDrmxrpou1apto oeiltlm ua(mo t)tlxomfctotla r nvi t)s2xrxo3oo4llt lfvi s aDrmxmpnu1opto iciyslm2um(vsn(0aetoir3tadfm rli o;t  rumio3oy1lpe  fvsl(  2um( o;u4ape  ieiad sDul( o;u)treomrcto1fpD an s;( seto(mpoodalt lfvslt sDtax o;o1teenmo3tasls rauvs (4treoxo tatlm  ln sls)seuoim ou4al emivsas)a2tmu oot4texomfciltlsDum( o t0arxnioctytoat  uei (0s2urxm iodlleelfcsls) Drr(mpnu4tlx ioetysfaDrlu p t4aetriocoo1fmtrlnvi;s0 exr(r no1ap   nesls aDuaxro;u4tltn fetlt mDrluvs;u)tetomf3io1optrlivo (0trtm(r ny4optnlneils aDumu ooo0teenmiciltfs2em( onu)teeniocoo1lp  lu sl(0s2uo(opnydam nliciat  rtrurpou1oleo fetltls ua( o (0altomo3iatlm eanvi;s0 rxoirpoy4om  lictatfsDta(m ou0aexoif3tldla2em( s;t4 lxriociy1oaD  n o;()srxoxo3io4ole lfvtat) rta(r ot0apx miciytlaDul( p;u)tlxnmr3oytfp   uvol(0sexmxo nudapenlnvs (fsrraurpnt1apeoiieiad m2ulu o () lxrxociadlpD  nvolt0teumxrpiy4amee fci tfsrrrxront4apxoifciatla2elu o;u4trenmf tydfmDe ues (0setm(m3no1am emneiat aDumx ooo4alenif3iys a2rln p (0 etnxo io1oa e u i s  exoio iy1lp  mfct tfa2uax o;u1oeeo fciyslm2ulu s;u)alenmr iodla rluvo;() exr(opoudolenmneil()sDtrxmpot4olxnioeilslsDua( s u0aeermf todoaDeaivi;s0srtoxo oydop n fes sfaDum(m ;u1oltoioetydfa uau pnu0trxoxo3tytomteln o s  exoir nu4amee nvi (fa2ta(r ot1alxo o3iyt m uanvo;t0 etnmf3iotoa  li ils0 rxmxm3oo4ope lieiat)arrrxronu1tpt mfeiasla uanvsn(4trxniocoadlmD  u s;t srxoxopoudalen fvilsfarrm(ro;t0tpx moeilsfsDuau o;u4trtrio oa1fm  luvi s  rxoxm3nodlmt lieslt  rtr( o;o0alx  ocils sDemump;t)teeoirciy1opte i i;s  2tr(o io1olt lieias aDtaxr oo1aee iocias s2ulumo;u0 eerxr3ta1fa raiei t0setoxo3ou1lpt lfcsl()sDtm(mo;o1tleo i3iyslsDuaump;() rxomr iodfaDran ilt t2tmxo3iodop nliesasfarrmuro;u0alxomf3iaslm2em(vp t0tetoxfciadomDelu o t) rtoxm iu1aptemivta()sDta( p;o4alt mociytfa rln p ()altomo iy1faDe neslt) 2trir3no4op e nciat)sDtaurooo1oex  ieiaslaDem(vsn(0tetrmf todfaD  ueo;s)s2xoxm oo1lm   ictlsf Dta(rpot4apxn iciytls umuvo u0altnio3ootoaD lieo s) rxrxo3oudlptnlncilt  Draumooo0aeto o3iadls emuvs t0trermr ia1fpDranes;()t2toim3oy4ome mncs () rtaxmp;t4tptn fciys s2ea(msnt)trerxo ta1la  lu o;t0 euoim iy1lpenmieia(faDurum ;u0aex  ocildlm ea( o;u) rermr iodfmteanvi s0s2uo(opoodopeelivsls)sDuaxm nt1aleniiciys m rmn o (0aexrxo3io1om rlnvo;(0 eum(r3iy1ol e iesls a2ra(  nt0oeen oeilsfsDum(vs;(0tlxoirctytomDelies t)t2xr(m iodlme  fei tfaDuaxm ;t1oeeo o3tyd s ulu pn()trxrxrcoadlmteluvo;s)t2ur(o3iodome mnesa(fsrrmxrono1olt ioctld aDea(ms;u)trxnxr totopDelivi ( trxoio iy4lmenliesl()s2raxrpnt0aeeoif3ils s2elnvp (4alxnxf3tytoatr ivo s)trtm(mpnu1omtnlicil(farumxm ot0tet  o3ilt aDel(mp t4 ltnmf3oo1fpDe n s;()sruo(o ou1omt mfcslsfa2rax  nt4tpx mieias mDuau p;t0 rtrxrcoytom rlnvi s t2umim3no1om  mfcs sf rur(  no1tlen ictas a2rauvon(4artrmf to1om elnes t) 2um(o3nydlptemivs tfsrtm( onu1aexomo3iydfaDelnmo u4trxomo3tadfmte i i t0 2toiopoudop emneias arur(  oo0aexniieias sDrm(mo;u4teeomr3tydfpteanvi (  rto(o3oudlp n ncilsfsruax pno1oexnioetytla2emnvpn(0 leomr ta1opt  ivo s0seumir3ou1lpe mictl(faDtaxr oo1alxnmociydlmDeau s;t0 ltnmfciodomDrlieslt)s2xmirpnydal  mfesa() 2trxm ;u1oetn oetlslmDrmnvsnu0 reoifcto1opDrlneil()s2ur(r3nu4omeelncsat srtrxr ou1olxnmoetytfs umuvp u) lxnxr3oa1fp r iei s  eur(mpio1amt mneta(f Dta(m ot4apeomo3ildlmDua(mp;()tlenio tytop  au olt)srxmio3nu4alenmfetasfa2ta(mont0tltnii3iytfmDuln snt)texomf oatopDe n i;()teur(m nodop nlivs (  Drmx ono4apx mfctldfa2uaump;t)tlenircoydlmtelues;s)s2to(m3nydolenmivt (  rra( pnu4alenmietltfs rauvs t4tetrmrcoa1faDeli il(0 rtr(r oo1olt livsl( artrumpnt4apt moetls s ul(vs (4 lxrxrcoytlatelu i s seurim ny4opeelicia()a2umx  ;t0aexnmf3iasfa2ean p t4aexrmr totoat ai i;t0trtoirpno4oltn ici sf 2ra(r ot4aeeomi3tltlm emumsn() leoif3oo1lmDrli o (0 2xoir3ou1apenmicsl()aruax o;t0olxnmietasls2ua(vs (0aetnif iydlmDraies t)s2umimpiudaptnlncsls)arua(  nu4olen ociyt s umnvpnt4trxnxr3ty1laD livolt0s2xoimpiy1om elivi sfartaxmo;t4ape  fciasfa2ua(vp t0 exomo3oatfmt  nvolt)trxrimpoo1lle  nvtas) rrmxm oo4olxn feild aDuanmo (4alerxr3ia1optranvi t) 2ur(opoy4op nmneiatfsrurxmpnu4aeen f3iytlm umump u)trtoir3ootfaDe uvol(  2xrim3ny4op nmivsatf 2tru pot1tpe  fcilt a2eauvs (4tetrir oodfmt ai s;(0trxoxopno1ape  netatf rtr( oou4tpto ietls a2rl(msnt4aetomf iatfmDe iei t0sruoimpou4lltn nctltfsDumx  ot4alxnii3iltlaDrln o (4tlxomr oo1fmD anvi s s2uoxr nudam emies ( a2tm(ro;t4tle mo3tldla2ulums t4trtnif iodfpDelivi (  rumimpiudlpt liviat)s2ua(rpoo4oex  ietldfmDrlnvs;(0artrio to1om   nvs;s0 2xmxrpiy1aleelfctltfaDraxmpot4altniocildlm2rl( o;t0areomo iotfpD lneo t) 2uoxo iy4alt lics t artmurpou0aexn f3tadfsDean snu)aeeomf oatomtr neo;t)texo(m3iu1olte fvtat srrmu  nt0optomieias aDul(ms;() exoxrctytoaD  nvo t trtoxo3oo1amee nctat sDtmx pnu0tpx  fctatlmDrm( s u) etrif oydoateau ils0trur(o ny4oleemfvta( sDua( o;t1opxnmfetydls rlu onu0alxrmr tatomDeluei;(0t2umio3iu4omenlivi s sruau o;o0tlxomo3iys m2ranmonu)trenxr3ta1fpD aueo;t0texmxr oy4al elfesat)s2rruroot4apt  ieiysfm2el(msn()aexrxr3ta1fmtraues;t0 2trxmpnudll nlfetas)aDurxrp;u1tlen fctadlm2rm( s;(4teenxr oodlpDe u o;s0 rxoxm3oodol  mies tfs2tauro;o4tpt  oeiyd sDuanmsnu) reomr3iy1lpte i o;s0texrim3oydlpe  fvt t) 2raxmono4oleo ieiys s ranvo;u0 lxrxociodoaDrluvs;t s2uoiopio4open nesl( aDtmu  nt4oexnmo3tyt m umnvp;u4 eeoxocoo1omDrai i (0 exrxm3iydaptn ncil( s2ur(  nt0openiocilsfsDeauvsn()texnxrciydlpDrai s s t2xrxo ou4ap  mncsa(fa2tru  ou4tpt  ociytfa2ean on()trtnxfctadlmDeln s;t s2tr(rpoo4apte feiat)arrrum ou0tetnmi3iltla2ra(vs t4aexoif3ia1op eanvi t s2xrim3iudlme lnet ()arraxmpoo4alenmoeiaslm rmn snt)aexrif io1faD  nvsl(0sexoio3iydlpt mfvtat  2taxroot4texomoeiatfa emu pnt0 lerxo3io1fp raiei () 2umxopnudlm e nct (f Dtmump;o0oet moctas aDrm(vs u0 exriociytopt  ues;(  2tm(o3no4ome  fetas)sDurxm ;t4tpeo o3tldfm rl(vo u0 etnmociodfmDraues;s s2xoxr nydll  lnvtlt a2ta(m ot1olenmf3iytlm2ua( o;(4teerxf ootfpDr u s;t)trtoxmpoodolt  fcsls aruaumonu1ole ifciytls2rmu pn(0 lxniociodoaD an sls)texoxo nu4oltelfviatf Drr(moot0optn f3iat sDrau p (4treoir io1lptr uvsl( srtrxo oo4olen ies tf rtr( p;t4tlx ifciydlm rm(mp;() ltrxr3oatoa   ues ( s2xo(r3nu1llt  fcs s sDta(mp;u0aexnii3iat s rlu p u0trxnifctydoateanes;s)srurio no4om e fcils  2taumo;t1tlxnmfcild m ua(vo;() exnxr3ootfptelu i;s0 2trirpnu1am nmfeta() Dtrumont0aetoifeiys aDrl( o ()trxnmr iodoptelivi s)sexo(opoy1openlnviat) rua(mooo1tlx iociatlm2emnvo t4artrif ia1laD lnvo;t)sexoxopnudlmtemnetltfsDua( o;t4ope  oetydfs ulnvo;t)trerio3iatfateaneslt srto(r ny1ol e nvsl()srurx pnu1ope mi3ildlm2rlumsnu0 ltoxociotlmD lieo ()setm(r3oy4optnmieia( aDtmxrp;o4oleniietydla2rluvonu0 etomocoy1fm eluei () rxr(m oodopen fcil(  rur(rp;o0openmi3tat mDelnmo;()aetrif3io1oateluvils  ruoxo iy1lm   nct ( s2ra(r nu1aptniieildla rmuvo ()arxoir3oy1la  an i;s  ruoxr3nudomt lncias)artru pno4aetomi3iltla rluvsnu0teenmrcio1omt  n ilt) rumxo iu1altnlnvtlt)arrmx poo1oexnifeiytfaDea( s (0areoxr iy1opDrluvi ()setr(opiu1llte fes s a2tmu  nu1opxnmocias m umnvon() eeomo iydla elnes;()s2xrir ou4lpt mfet ()arta(  ;t0aee  icildlm2rm(vsn(4 lxoxf oo1opte nvsls  2xoir3no1alenmfcsas aDtm(  ou1alx  oetls a2rlnmp;(0 renmo3oytfp elivo;() 2tmxm ny1op  lfvs s)s2tm(  nu4oexomiciyt a eanvo t)artnxocoo1fatr ivi () etmxmpnu4ap nmncils  2um(m ;u0opx mociasls umuvonu4 renxf iytomte uvsl()trurxrpiodam n nvs (  rtmx  ot1tptniiciatlaDrlnvp;u4teenmfcty1oa  ai s s0seuoir oo1al nlncil()srrmxmp;u0tpto fciad s2emuvs u) rermf3oa1oate n slt s2tm(opoo4amtnmnet s) rraxrpou1oeeomfcildls2emumsn(0 reoxrcio1la eauvs s trxmiopoy4lltelfet tf rum( pno1apxomo3iasfsDrln pnu) eerir3ia1la ranvs;t sexoim oydll  lnvias aDtmu o;o4olxniiciatfaDraumpnt) ltoir tadfmD lu ol()trtriopiodomtn fcils) Drrur ot1tltnio3iyd sDeanmsnu0arenxo ia1op elnvsls0texmxrpiu4ome  fcsat aDtaur nu0tle if3iytfmDrmuvo;u4trtnioctotom   nvsls)tetoir iy1lle lnetl( s2taxrpnu0apenif3tldlsDemnms;t0 rxoxo oy1oaDr i i t)t2uo(o3iu1am nlfes sfartru pnt1texnmfctaslm ua( pnu4 rtoio3oytlm ean o;s sexr(r3iy4lp emfvtl(fartmx oot0tetomi3tadfaDrl(vo t0tetomociadoateauvil(0 euoim oo4ol elietasfaDtru ono0aeeo iciytfm2uanvs t)teenxf oadfaD aues ()t2trirpio1al elnei ( arrrumpou0alt if3iydls2elnvsnt0 rxnir totom  ai o () rur(o3nudolt  nctl()a2tmum ou0aleomi3ilsfa2rl(vo ()arxnirctadopD au o;()s2xmxm io4ap   net t sDururo;u0tetnifetad sDrm(msnt4arxoxfciy1omDr n i;t srxoxo3no1op nmies t)sDuaxr ou0ope iietldfm2ul(mo;u4 etrif totoaDean i (  2toim3ou4openmfvs s) rta( onu1apt iietysfs2rm(vs t0 rerif3oatfm  lu o (  rurim3oodlmte ictl( s2rax pou1aexoioeiltla eaums;u)trtrxo ty1faDrlnvi;s t2uoir3oy4oltemicils srtaump;o4apeo o3tas sDea(msnt0tlxrif3oo1fptr u ols0sexo(o iudlmeelnvta(fs2rm(r nt0tpxoifetlsls2eluvs;(0tlxoirciadomDr ueslt0t2trxo3no4ll e ieslsfsDtrxmonu4tlenio3iydlmDulu o;u0 rxrxr3oodfmtelues t0t2xoirpny1lp  mncsas artau pou0opx mfctadlm eanvo;(0trxrxfciy1fmteaueols srtoxr oydalteliesltf 2uax o;t1tleo feiys s ulnvsnt4 exnxr iotoate ues s srtoxo no1ale mfvi ()s2rmumont1tle  fciadfsDua(vsn()trermr3iadopt  iei s)t2xoir oo1opt mneilsfs2umur ou1olxnmoctatfaDrlnvpnt)arxrif to1oaDeai i;t0srxmim3oudlp  lfvtlsfa2rrum nt1tpeoiietatfs eanvpnt4aeeniocta1lp   ueils trumxopoydlmtn fvil(faDraumpoo4tetnmieiadls ranvs u)trerxr ootla elues;s  2trimpiy4ll nmnviltfa2tru onu0apto iciyslm emums;u4tlerif3tadom   uvsls  rur(o3oodlpt lnetlt)aDrmuroou4alxnmi3iys mDeaums (4 leomo ta1faDr ueo;( t2toiopiy4ole  nvsls s2uauroot0tle if3ias s2rmnvo;()trtrxr3iy1opDe nvols  2xm(opoy4op emictas) rrruroot0apenifeiysfm rlu snt) ltoircia1oa e nvo s t2xo(rpny4aptnlnetatf Duaur ot0opxo octysla uanvont)aexrir oadlpteau i s)tetr(m no4aleemicsat s2rauronu4oleomieiadls rmuvo;()tltnxrctatfmtelueo;t0s2toxopoudopte feslt arurxmo;o0opxomf3iysls ra( snt) exomocootoatraivslt0t2toim oo1lm  lict s arta(mpnu4oexomicildfaDum(vo;(4trtomf3oy1lp rli ilt  2ur(r3iu1aptnmncsls a2raxrp;t4opx ii3iasfs2rm(vsnt) renmf iatfmte u ol(0 eto(mpnu1optnliesa( arta(r ou4tle ifetld sDemuvont4 eenxfcoo1fpt  neo;t0t2xmir no4ol e fvt s  Duax onu1aptoiieiasfaDra(vs () rxrmoctotopDelueo (0t2xoxmpoo1ol  micias) rtr(root1tlto iciytlm rln o;u0arermo ta1fmD ai o;(0trxmxr iodlpe lnvtatfsDraxro;t4ale mi3iytfs2raumon(4alxrmocoatoptrlneo t)t2toxo3oo1ale mfes ( sDtm(ro;o1olt  f3tysfs2um(von(0alxrxr3ta1lat  nei t srtm(m oudlle lfci s arrr( poo1alx iieiyt a2ea(mp t0trxomf iodlaDe ues ()srxrxm3ny1lmenlncil( a2urur oo1opxn oeils mDeaumpn(4 reomrctadom raivs s t2trxmpio4om nmnctat)artmumoot1teeo iciad mDelnvo t)aetomr3iadoa elies;(0sruoiopnudolee ivtas  Drrur ot1tle moeiltla ul(vs;u) exrxr ty1oaD lnei;s)s2uoxm3iudlptnlfvi s) rtmumont0oexo i3tlsfm rmu o;u0tetrio ta1fm  anei s0 etrir3io1ol emiviltfs2rau  nt4optomoctldlaDum(vo;()artnirciytla e n il(0trxmxmpny1lp  lnviat aDuaurooo0ole io3iyslm ua( o t) exoxr ty1lmDeaieo;t)t2tm(mpno4al   nes s)srumx  no0tpe mfctyd sDum(vp u0tlerxociodlmte ivo s) eurio oy4openlnetat)sDumur ou0tlxoif3ildfmDelnvp u0teermocoa1oaDeaiei ()t2xm(m3no1lme mnes tfs2taumpnt1tptomictls aDrlump t0 etrifcoytlaDrlnesls0trxmxr io4llen nvi () 2tmumpnu0oeeo o3iasfmDum(vp;(0arxomocoa1lm  aivil(0s2urxm iy4lme liesa()aDuauro;t4teeomiciasfs2uanvonu4artrxrctydlmt aueils0t2tm(r3ny1lpenmfesls arur( o;u4opx moeiasfa emu snu0artomr3io1latelieilt) exrxrpno1llt  ivsls) rumu p;o0tlxnmoeiadla2rl( snu0 rermoctatfp  lu s s0sruo(o iu1ale lfet sfs2tmxr ;u4opt mictasls2elump (0altnir to1fptrlnvo s trxoimpny1ol e fvs (farrr(  ou1tpxn o3iltfa ranms;u0aeenxr iydfpDrlueslt0trxoio oy4amtnmfct s  2rrxmpot4tetomocilt a ulnvp t) etrifciadoatrlu il(0trxm(r3oy1lmen fvs ( aDur( poo1oeeo f3ias m2uanmp;t4alxoif oytfaD ai sls seum(opno1lmenlivtlt)arrrxrpou1aeeo iciydfaDrmumo;(4tlenxrctytfpt ai i;s  rxo(o3iodam emnvsas srurxmono1oee mi3iydfm rmuvs t4 eermrctadop eliei;s0 etoxo3ou1optnlicsl(f 2tm(rp;u0opx io3tyd s ulnvsn(4trtomo tydla rauvsls0s2xm(m iodom  miciatf Dtaxront1oeen ieiasfaDulnms u)treniocoo1lp   uvs;t trxmirpiudlleelfvs s)srtrumo;u1tlx  i3ias a uluvpn()alxnmf3oa1laDelnes ( teuoiopny1optelnctat) 2ta(mooo0olt iociyt s uanmo;t0trtrxf ootlaD  neslt0 rumxm iy1lm   icsat arumxr nu0aexoii3ildfaDemnvsnu)aexoxoctadop eai il(0s2um(opio4op nmfviat)srraur nt1aeenmociys s rluvo;t4aleomr3totlm  ln slt0srtoiopoo1op  mncil(  Dtmur ;u4opxoifetldfm2emu s;(4alxnxr oydlm elnvils) rxrirpiu4opeemnvs t) rrrxmoou4alxn f3iyslmDeanvsnu)aeeoxfctodlateauvi t  2trxrpiydamee nci (fa2tau ont1tlxoio3tls s2rl( p u4aeenircta1omtr uvol(0 2xoxo iy4olen fctas)sDum(  ;u1oltoiociasfa ean p;t)aexoir3totlat luvil(0t2trim oo1lp nliesl() rrm(mo;o1tetoiieilslaDelu p (0tltrmo3tydfmt an s;(0t2xmiopnudalenmnvtas a2tmu p;u1aetnmi3iad s2raumo u4 renmf tytomtrliesl(0 rurir3ou1lpeelnvtasf 2ua( o;o1tpeomieiasfs2ua(mo;t4tltoio oo1omDrlues;(0t2uoirpnu4ap n nvilt  2uau poo0tpe io3iatlsDua(vsnu0alenmfcia1fpDe nvo;t0sexmxr oo1om   nctlt)artr(r ;o0tpe mf3iytfa2rmnmo;t0 lxnir iatlmt ln i s)texrxo3nydolenlfvi s)arrm( o;t0oee mo3tldls2ea( o (4aeeoiociotfmDr iesls0seuoiopoodlptn nesat)artax pnu4olx mictad m2rmuvs t4alermf iotoa  aies;s)texmimpoodom nlfvtat aDra(mpno1tpeo ietydla2ra(vs (4tetoxf tytlmDr ueo (0 euoxrpoydaptn ivias a2tmumpnu1aeen o3tydlaDranvs;(0 rtoifcoatopteliei;t0trto(rpio1lm n fcs sfarrm(r ;o0tptomf3ilt a2eau p;t4aeerxocoadoa   nesls  rxoimpiu1lpe mfvi (f 2rm(mp;o0apeomoetyd sDemnvpnt) etrmf3ia1oaD luvi t)seum(m3iodllte neslsfsDtm( p;u0oeenmieildfaDemuvp u4tlxrmo3io1lmDranvolt setrirpoudaptemnetl(fs2rmx  nt4apenif3iatlm rlumon(0texoifctydoptrliesls)t2um(r3nudope mnvi t)arua(m ;t4aleomfeildfaDrlnmont0artoxocio1oa e u i;(0t2xr(r oy1ame  fvtls)srtau onu1teenifeiltfa el( p t4texrif io1fp   nvi;s  2xoxm ny4lmt mnvia()a2uaxmpnu1optoio3ilt a2rlnmonu0 exrif3tydlaDe u s ()tetrio ou1openlfvilt sDururonu1texoifciydlm el(vp;()artnir3oodop   u i;( seuo(m iu4lmtelicsls) Drmx p;o0opt ioeild s2ua( p;t)aeenxr ia1fp  lieols0s2uoimpiudap n ivsls s2trx o;t4tlxnii3iyd s2umnvp u0 lenxr3oytfat lnvi;(  2uoimpou1llt lnvslsf rraump;t1tptoiictyd s2um(vp;t0alxnmr oo1fpt auvs s0texr(rpny4lpe mnvtls)aDtrx pnt0tlen fctls a el(vpnu) lxrif oa1lpt au olt0s2tmxo3oy1ap   netlsf 2raumpnu0oltnmieilslaDra(mo t0 exoxr3iydfa e ues;t srumxo iy1ol emnet t)aDraur nt4optn ieiaslm2elnvonu)arxoio iy1lat  u i s  rto(m3iodomt mnetltfaDurxr nu1tpxo oeiad s2ulnms;u4alenmf3totoat  uvo;t)trurir3io1om e fcsas aDua(mpno0tlxn o3tldfa umn p;(4aeenio3iy1optrau sls0 etrio3oodal nlicil()sDra(  ;t1tex ifciat s2uan snu0tlermrctotlm rlies;s0truoxo3io1aleemnei ( sDurx  ;t0opeo i3iysla2em( snt4 eeoiociy1lpDelivi s  2to(mpoo4am e ictatf Dum(rpnt0oex mfciasla2ra(mon(4alxoxr iydlmDr i s;()seur(m3ny4al elfci sfsDta(m ;o1tpeoifcias s emu o u0 rxoxo3todfp ran i;s0t2umir3iy4ole mnvilsf rta( o;t1oeeo ieiad aDrl( on(4 rtoxf tytfmDeluvils0setm(r3ou4amtelfeta( sruax  ;t1apx ii3tytfm rl( p u4 lxnmfciytlpDraneol( srxm(o3oudoptelnesatfsrrmurpnu0olxoiicilt mDem( o t0 rtrxfctydlptrli o s trtmio3nu4lptnmneilt a2rru ont1aetnmf3ild sDulnvonu4arxrxo3iodlaDr ues (0 rtoxm3oodlpeelfvta(  Dra(  no4ope  octydla2uauvp;u)texomr oy1fpDraneilt0truo(opny1lmt  neils) Drm(mo;o0oexnmo3tlt a rmumo t0teenmf tydomDe nes;(0sruoio3iu1altnmnvtl( srta(moou0tpe  fctat m2emumpn()tleoirctotfmtr ies;t)trur(m ny1amt lnetasf ruau onu0ape  i3iys aDuanmsnu4trtomf oa1fatr nesl(0s2trirpny1al e neta(f 2ururp;u1opto feilslmDuanvs;(4tlerio oo1oaDrlnei t0seuoxo3no1ap emnciatfaDtaur nu4tpxnmoeiltfa2uln o u4texrmo oatlmte uvo;s  exr(o3iudame  nvi (fsDrrum ;o1ape moeias a2ua(mp;u4altnir tatlpteau s;() rum(r3nu1am emfvi tfsruau ooo4tlx iociatlm2rm(mo t4alxoxr oydfm r i i;t)trtrxr oy4alt lict ()arrm( p;o0tlx iicias a2umu sn(4 etoxoctotopDr nvi s0 2tr(o3ou1lle  nvilt) Dur( poo4optoiietasfa ulu snu) renio iydfaDrluvs;s) 2xmxrpno1omte feia(  rumxmp;o4oleo f3iysfm eanmo;u0 lenir3todop rluvi;s)texo(mpio4llt  netl()a2ra( o;t4tpx mietld a2elnvs;u4areomo3iydom  ln i t  rtrxm3oo4ap  livi s  Durxrpot0tlxnmfeilt mDua( o;()tlxoxociydlpD auei () exoxm3oy4opt mncia()arumur ;u0aee  fciyslaDrlu p t4 lermr3oydfp raiei;s)srtoim3io1ameelfctls) Dta(rpno4alenmoeiltfs2eanmsnu0 reoxfciy1fpte uvilt0 2xoir oy4amt mieias)srrm(mp;t1aleo ictyslm2ean pnu)tleoif3ia1fat ln i t  ruo(mpoydolt  feia()s2rrumpno4texoio3ildls rmnmo;(0 ltoxr tydfpD li i t) etr(o3oo4lptn ivtasfarta(ronu1tlxniictltlm2eln s u4tetrmo3oodla raneilt) rxrxm3nodlltnmnet (farrrump;o0alxn o3tasla2rl( s;u)arerxociodlpt aues;t0tetoim oodal  mnes () 2ur(r nt0apx mo3iadlaDrmnvp u4texomociotop e i ol(0trtmim iodaltemncslt)sDtmu oou0opx if3ilt a ea(vo t) exrif3oo1optr neilt  exo(opiu4openmfvs ( aDrmxrpnu0aexoifctydlaDrmnmpn()tltoxrctadom r ies t)s2xrxmpoydlmt lfcsl(f rraur ;u0tle io3tldfm2ulumo t0arxomf iodlpDe n o (0sexoxrpou1al nmnvsa( srrmumonu4alxo fctys s2ea(vp u0treriocio1op rlnvs;s t2uoio no1ap  lnesl(farra( pou1teeo iciyd sDumnmsnt0aeeoirciy1oaDe n o;(0s2xoxrpiudop   ivsls) 2rru  nt4teeo i3tatlsDrmumo;()altoxocootfp   ieo;() 2toxm nydllt  nesatfaDtax o;t1ale  ociyslmDeanvs;u)alxrxo to1op eai ol(0t2xrirpio1lmtn nvs (fa2rr(mo;t1apt mo3tys a2rl(mpnt)aetnir3oatlaD aueil()teto(m3no4omtelieilt s2umxmp;t0open i3tad m2em(msnu0aeerxf3ootlpDran olt0texr(r3iy1amee neils arua(roou1opxn ictld a um( o u)aeeniocoodlmt an s;s0t2uoxm io4ol  lfeia(  2rmu ono0apxn octlslm ua(mo;(4 etrir3todlpte u ols) rtoimpoy1lpeelfet ( aDrax pou1aeeoio3ilt s rlnmsnt4 rtnxf3iadlpDeauvs;t trur(m iudop  mfeias)arraur ;t1aeeoifeiltfsDea(mp;u4 rtnif ty1op e uvolt setmxm nydap   fvsa()srur(mpoo1opx  ictydfa2rm(vs;(0trtnif iodfaDeaneo ()t2uoim3iodlme  ivia(f rtaum ;t1aexnmf3iyt s eanms;t0artnmf3tadfm  lnvs ()s2toiopnu1lptnlfvsl(fa2um(m ;t4olt ifetytlaDrmnvsnt0 ltrmf ia1lmD lu o;s)teuoir ou4ol emivsa() rtrxmp;t1olto fetldlsDrm(mp u0alxrmf to1fatr ivo;s  etr(m3oy4ome mncia()aDurur nt0ope ii3tatfm rau s;t4tltrif totfatelieolt  rxmirpno1amtelnviasfaDtau p;o4tlxomf3ilsfa eau s;u0trxniocoytopDrli i;s  rxoirpou4ope  ncilsfsDtrxr ot1opt ioctas aDeauvsnt4texnmo ta1fat luei s  2umxr nu1omeemfeiatfsrua(m nt4tpxo icilslsDel( pn()aetrir3totoaD  ivols0 2uoxo3io4lpee ncs (f 2tmurpnu0tlxnmo3tasfs2emu o;t4aeenif3ootomD  ieolt)seum(o no1lpeemfctas s2tm(ro;o1oeto i3iyt s2eln s t0 ltnircoytfpteln o s) exoimpiu4olenlfcta() Dtruront1opt ifciadfm2ra(vont) rtrio3todfaD lneols  rtoir no1ll  mfei sfarumx o;u0olto o3iysfs uan sn()areomo iydfateau i;t  ruoxr ny1al e fesl(  2tauroot4tlx micils s2ranvsn(0trxrmfcty1lptean ilt)sruoxrpoy1aptnlfctasfsrtmx  nt4tptn fctltfmDra(mp t)aetnmo iydoaD luei;s)teuo(opio4omtnlnct (  rrrx p;t0aeeniicils m2rl( snt)altrircoa1oaDelivi;()t2urxopiodlm  lneiatfsDua( p;u1oee  i3tls aDelu p (0altnxr iy1fateaivs ()t2trimpoudamte ictltfsrta(rpno4tptnii3iltlaDeauvsnt4 lxoioctodla rln sl() rtm(o3nu4omeemnct (  rtm( p;o1apen fcild s um(mo t0 lxnmf ia1lmteln ils  exmxr iy4ole lncsls aDtr( o;u4tpeoio3iyd sDranvp;t)aexnifctotop  lu o s)sexmim3nu4olee fcs s) 2rruro;t1tpx ifcias sDemnvs (4trxoxo3oatfmDr uesls0 etmim no1lm  mnei s)s2uaumo;t4tltoif3ils m ea( s u4teeoxr3oo1fa elnvo s)seto(opiy4ol   nciat)srurum oo4oetn ociys a rlnmo ()trtrxr3todlmDeauvi;(0texrxopoydlpte nvsltfa2umxroot0ole  o3iysla2eaumsn(0texnmr3ta1fmte uvo;(0s2xmxm ou4omeemnvs sf 2umxmo;u1aleo ieiysfs rlnvp () ltnif3tydfat  uei;s t2umirpiu1am  mfeta(f Draxm no4oltn fctadls2uau s;()areoif oydop rln o;t srxrirpny1ol elnct t arurxmo;o4olt mf3tlslaDum(monu) eeomr3totoa ranvslt) euoxm ou1al  mneiat artr(mo;o4opxn fcias m2ul(vpn(4alermo3ta1op  aieo;(  exrim oodlm elfctlsfsrtmxmo;o4alt  ocias aDea( pn(0 lxrxf3ty1omDeauvolt0sexmxr no1ap  lietat  2rau oot1tleoio3iadlsDuauvs u0tlxrio3iy1lp eaivs;s0seuoirpnydaltemfvi s  rtm(mo;u4ole ii3ild a2emuvo;u0teenmf3tatfm e nesl(  euoxrpoodomee ieia( arur(rpoo4olx mfeiaslm2elu p u)tltnmfciodlmDeliei;s trxmxo io4altelict t)sDuaumpot4apxoiieiadfmDran p ()arxnmf3tydlp rlieol()sexrim iu1lmtemfesls)aDum( onu4altomoctytla2rmnmp t0alerxr3tydoaDraneolt)setoiopno1optn fvsl() 2trum ;t4tpxomf3tys a rm(ms t4tlxomfcoytopteauvil()t2um(mpoudaptelivia(f 2ur(m nu1olxoio3iasfa2rm( p;u) lxnircto1latean o ( setoirpoudlp nlies s) rrm(r ;u4opx  fctasfs ulu pn(4tlxriociydlmD  nvol(  2um(m3iodalte fet s srrmu o;o1opt mociadlaDeluvs;t0teenir3ty1opDrlnes ( srtr(rpnodaptnlnctas  2uau  nt4optoioctad sDumums;u)arerxrctydfpD anvs;s0 2xrxr3iudlpte netl( aDra(mpno4aexomi3tad s rm( o t4teermo oo1oa  anvs t)texrio3oydop  lfcsas aDtaxr ;u0olt  i3ild sDra( pnt0areomr3iydlptr i ol() etrxo3ny1ape mfctls) Drm(  nt0tltnmfeiatlaDrm(vont4arermr iy1fatran o;s0s2uo(mpoydameemivsl(f Dtm(mo;t4tetnifeild aDeaumonu0artniocoatfmDe uvi;(0t2trxr ou4ap n fctl(fa2ta(mono1opxoiieiys mDuauvs;t0 rtrmo totlaDe i ol() rxoxo3oo4optnlfet ()s2ta(mooo0tlxn octatfsDemn s t)tlenmr iydoa   uei;(0teurirpiu4apteliciat aDraumo;u1optomfcias a ua(von(0alenif tydlpt lu o ( trumxm3oy1lltemfes sfaDururp;u4aleo oeiltfm ua( s;(4 eeoxr oytfaD  i slt srxoim3nodomtemnetlt srrrump;u1tltn oetlsfm2umuvp ()aexnxo3oytlpD  neo ()sruoxo3ny1llenmfci t)srrrxrpnt4tlxomoctas mDrmn o t4tleoxocoydfaDeai sls0 rtm(r nodam  lfesl(fartmumo;o0olto oeiys m eanvo;u0 lerir3oydfp elivi t0s2xr(opnudlmtemncsa(fsDrmx oou4oltnif3ildfs2rmnmp;u) eerio3totfpteaneol(0s2tr(mpnudoleemnvt (f rurxrpou1tptnmfciys sDrau p;(4 etomfcoa1fa  luvilt0s2tm(m nudoltnmict (fa2tr( pou0open ieiasfsDrlnvsnt4trxrir oy1omDraivs;t) euoxm3nu4lm   neiatfaDua(m ;t4optomo3iasla2rl(von(4teeoxf iy1opt ai o t)srxrxrpnydol emfctasf 2ua( o;t0optniieiys s2rln o;u)areoif iy1lp e uvs;t0 eum(o iydap   nvtls)srrrxmpot1oltomoetys aDrl( s;(4 lxrifciytlpte ivs;t0s2toxmpoo4lpe mfetltf 2tr( ooo0altnmf3ild s rl( p;(0tetnio3oydlmtr u i;s0s2xrio3iy1lmtnmfetat)arrr(  oo4ole mieiatlm uanvs u) rxrmr3todlpt aiei;t0t2uo(o nydlptelicslsfartrxmpno0oexn i3ilsla2el(vs;(0tltoircia1fatr uvilt0truoxm ou4lltnmivtls)s2tm( pnt1aptoioeias a2emnmsnt0alxoir3oadlpt aneils0 2trxrpiudlptemfviat a2uru  ;t1apt  ietasfmDrmnmo t0 etoio3iodfa rlivo;(0t2uoxm iu4alt mncs ( artaxmpnu1tlt  o3ias a umnms;t0arenxo iatlmtranvolt t2uoxr ou4apee net tfa2raumpnu0aee  o3tadlsDelums;t) lerxrciodomte iei () 2umxmpio1alen ivtltfsrum(  nt4oeeo ictysla um(ms u)texrxr3iotop rau o;(0 exr(o3oo1omt  fesltf Dum(rp;o4tltnif3iatla umn s;t4altrmf3ta1fp r uei;(0trtrxm no4oltnmies s)srtax ooo0tltoiocilt s2ra( p;()altrxr3oytlmteaivo s0trumir3nudapen nviat aDtrxm ;u0oee mfeiat s2rm(vsn(0alxnif3iytomtr u il() exo(r oodalee fvslt)a2tau oot1tpxoiiciydfa ulumsnt4tlxnio tadlpt an o t)texrio3oo4apenlfvt t  Dtaxmp;u4tlxn oeildfaDea(vs;t4tetnxfcty1fa r i s;s)trumir3iodlp   nctlt) 2ta(rooo1opxomictlsfa uln s;u)teenxr ty1lptrai slt0setmxr no1amen ivtlt)sDumur ou0alxomietydfs2umn o;u4altoxo oadlmD aueolt0srtmxr3nu1optemfci (  2rmumonu4tex iiciadfa2uluvo t) eeoxf3ta1lmDelueo;s0tetmxopiudapeelnctas) 2uaxmooo1tex ii3tlt a rmums (4altnxr ia1om eluvs s trtm(m3io1llt  ncia(  Duaxronu4alxniicildlmDul(vp u0trxoir3ia1lmtr uvols seurim ny1ale  nctatf 2tmxmo;t1aee  ociyd a el(mo ()tlxrxociotop rluei;(0t2xoxm nudllenlietlt arumu ono1tptoii3tydfaDua(vo t4texrmr oodomDelieo;() rxr(r oo4ol e ncsat srrmx  ou0texoif3ilsla2emu p () eermo3oodoaDe nvi;(0seur(rpio1ole  neil( srurx  nt0aeto ietad s ua(vsnt0tetoxocoodoat aiesls)s2umxr oodole mnvias)s2tm(ro;t1ale  ieiys mDemnmp;(0tlxnircoy1fmDe nvs;(0sexoimpno1ame lnvilt) 2rmxmp;o0tptniociytfa ra( p;u0aexrir oadfatelivs;() 2xr(m nodam  liei s) rrr(r ot1apxnmictasla emn snu4 lenxr oytfa e i i;(0trtoio3iu1am elfvtatfsrraxrono0tltnmfeiatfa2ran p;u0tleoxf oa1faD au i;s0teuo(r3oo1ape lnetl()arra(ront4tlxn ocildla ra(mp;u) leoxfcia1fpDe u o;t0seumxo iodlmtelnvta() rtmxmo;t0tpx mfctlt aDra( p u0 eenxr3ta1op e i i;s) 2um(rpnydal   iesltf Dtaumoou4tptnmoeiaslm2emu p (4 reoxo3io1opDrln il( srtrxo nu1lpe lnctlt) rra( ooo0aptn ieiltfa rluvp;t0aexomoctadfat an o t)s2um(o nodlltemfesltfs2rr( ono4apenif3iyt s2rmnmsnt)trenir3totlmDr i o;(0setm(opny4op elnesa()srrm(mpno0tlenif3ildls2ulnmp ()tlerxf3iadoaD ai o;t s2xr(opiu1lpenmiesa(farrmxr ;u0tpenifctydlm2em(msn(0 lxnmo oadopDraiei;( trto(m iydole mivsa()srtaurp;t4tpe if3tatlsDel(mo u0 etnxfcoodfmDrlivo s0 2xm(o nu1om   ieslsf rrrump;o4ope  o3iasfs2raump;(0 exoxr tatfp eln o s0 2tmim iu1ole liet tfs2urxmono0tptn fciyt a eanmp;u4 etomr3iy1la r n s t0s2xmirpoo1ol nlfvtltf Dur( ont4texnioctytla rm(vont4teeomo iydoptean ol(0t2xm(o oy1ap n nesasf rururpnt4opeoif3ildlmDeauvs t)aetnifcio1opDr ivs;( t2urxmpno4omenlncta( a2trxrp;u0alt  o3tys s2ea(vs;u4aetrmo iytomt aieil()t2trio oo4om   net t aDua( pou0apx mfctls aDeluvs;u4artoxo iydom   uvi (0 2um(r3oo1lmenlncsat)sDraxmo;u1apx  i3iys s2ranms t)treoioctatlmtean i t sexm(opiodopenlivtas)a2umuro;t4tpxn f3iyt sDum(mp u0 leoifcty1fmtrlivils) rxmimpiodapeelnesa(faDur( p;u0aex mf3iydfmDemnmpnu0tetrir ta1lpt au i;s0tetm(rpnodaptelivs (fs2rru p;o0alenmi3ilslmDeanmp;t)artomo ty1lm eli s t s2tmxr nodopte ivt ()sDrmuro;o4tet mfciad s rlnms (4 rxrio3oadfmDrln olt0 rtmim3iu4lm nmnvt sf rrrx  ;o0aeto oetydls2rluvo;t4 rtnmo3oadfptrlnvols0srxoimpio1llenmies t  Dta(mpnt0ape  fcilt m uauvp u)texrif3to1lpDr i o t0srxrio iydapen fctlt)srtmxro;o0apx io3tatfsDuln snu) etrmo io1op rauvil(  etmxm iudlp n ietlsfsruax  ot4tpx ii3iydfm rlump;(0 exnxo iydom e i s;(0texm(mpiydal e fvsl(f rrr( pno4apxoiociydlsDumuvo t4 rtnxrcoatlaD  u o s)s2xmio nu4lpeelfvtlsfs2uax p;o1apenmfctlsfm el( onu)trxoxfciatop   ieo;t) 2trimpoo4omenlfct (farurxr nu4tlt  i3tldlmDrmnmonu4trtoir3iatfmtrauvs;s)tetoxr3oo4lltelnei ()sDtmxrooo1oee iiciltla rmuvp () exoircoytoaDeauvs s) 2xm(rpnu1lm  lneiatf 2ur(r ot1alxniiciytfm emnvp t)trtrmocoodfmte iei;s0t2xr(rpiu4om eliesa(f rtruro;u0oltoifetld s umn s;t0tltnmfctadfpt  nvi ( s2xmio ou4omenlneilt sDraum nt4oexoii3iys s2ul( o;u0 rtrir tadfpt  nei;( srtm(r nodop nmivil()s2taur nt0aetoiociyd a2rm(ms u)altoiocoodfa  an o () exr(opio4ap elnct s)arurx pno1aet mociyd sDeanms ()teeoif3iodfpD an il(  exm(opoydlpte ivi tfsrrrxr ou0tlt ifctadfmDrl(mon(0 rxrmf oa1fmDr i sls)srtrxopoudlptn nctlsfaruaxm ;t4optn i3iatlm um(ms;t)trtnif3ta1omDeluvo;t)srumxr io1aptemfci ( arurump;o4tpeoif3tatfa2umu s u0tlxrmr totfate ivils s2to(o3nydale lnci ()s2umxmp;u4optnii3iatla2eluvs t)artniocoa1fpDe iei s)sruoio no4ol e ivtas aDta(rp;t1aexomoeildls2emn snt0aeermf oy1fmtrln s;t  etoxopiodal  miesl(fsrur(r ;u4alenmictat s2umnmo () exrmf3oytfpDean sl() eur(r iu4lp n iesa(faDtr( poo0opt iieiat s em(vo () rxoxoctytoaDraiei t0 2xmxm3iudaptnlncsls)artaxmpnt0olto feiydlaDeanvo;u0alxrio3ty1faDe neo s  2xr(mpiydapen nes s srtr(mo;u0oex  i3tyd s2ea(vs;()altrxr oadfmt aneslt0srurio3iudlpenlncil( aDta(m ot0tpt iictydlmDelu s;t0trtnxo3iodfaDeaivils) rtr(r3io1aleelnvt s) 2tm(m nt1aee iictadfs2ulnmonu)arermfctodlpD au o t0 2um(m3iudopt lieias) 2uau ont0aeenioeiytfs2el( s;t)tleomfctadfmteli s;t t2tmim3iodam  livsat) rtrx pot1apeoiiciyt m2ul(von(4 exoifciydlmDean ilt t2ur(m oo4opt livi s)a2rrur ;o1aet mfeiat a2rmuvs;t) exrxrcio1lp rauesls0trtmxopiudolt mnctatfsrtaxm ou4opx mociatla2ranms;t0aexrxrcia1lpD aivs ( srumxo nydoptemiesasf rrr( onu4oee mo3tatfsDemu s;(0aetnmocoadfatelieols s2xm(rpio4lp emnetat sDtau oou0apxn feiadls2rmums;()tetomf iotom e nei;s s2tr(m oy1om nmnvtl()sDtau p;t0opto fetaslmDemnvon(4artnmr oo1lptr ivsl( sexmxopnu1alte fei tfsDtm(r nu0alenmictyt s2eaumont)trtnir3todfaD liei;( t2trirpiy1amtemfvias)sDumumo;t4oex  feilt mDuanms;u4aetrmo oo1lmtrauvi t  rtmxmpou4olt miei tf 2trxr nt0apeoifeiyt aDem(von(4 lxrxfciatfpDrliei t texoirpio4ap   ictas  2rm( p;t0tee ifeildfa um(vp u) exomrcoydfm rauei;t)s2umim iu1lp nmivia(fsrrrxrono0tetnio3iasfsDuau p;(0tlxrmf ta1lpt  nei;s sruo(m ny4ol elivi t) 2tr(mo;t0ope mi3tas a2emn o;u4arxnif ia1op eaneo ( s2xmimpiydapee ivtlt sDrax  ;t1oexnmietad m eanmp t)arxnmr3tytlm r ues s0sruoxr nudlpee nvsasfs2ua(  nu4olx  o3tytfm uan p;(0 rxomo oodomt  nei s) etoxm3io1lptemict () 2um( pot0tptn i3iyd s rlu s u4texrifctydfpDeln s;t sexm(opoodome mietlsfsDtru p;t0alxomoeiydlmDrauvon(0tetoifcia1faD lies s  rxoxm3oodal  lfci sfarrr(monu1oleoif3tad mDrmn o u0 lxomf3oytlmD  ivol( sexrxmpoo1apen nct (fa2ra(m nu4oex iieiltfsDea(mp t0aexoxf3todfmt ln sls trxmiopoy4lm nlnes ( aDtm( ono0altoioeiatfmDrmnms;u4 ltoio tatfmt anes;s0setmiopnodlpe lncta()aDtmumo;u0alto fciysfs2el(monu4artrmo iytopDean i s t2to(rpiodomtelncsas srtaxm ;o0opt ioctyd a2ean pnu0alerxrciadlpt  i sl()t2ur(o3oudap nmivsa(  rtmuronu0oexn o3ildla2ul(vo t0 exnmf oy1lmt auvslt0s2uo(o3nodlmen fciasf 2umxronu4apxo ociltlm rlumo;t0 reniocoadoptrlu i;()srxoxm nu4om   nvsl( sDrrxm oo1oltomfcild sDum(msnt4trxoxf ty1fatrauvs () euoio3oo4ape lneias) 2ururpnu0tptnifeiad s ean p;u0 exrio totfa  anes s0 euoim ny4ol   ncsl(  2um( pno0opxnioeiltfs umuvs;(0 etrxfciadopDeluvi;t0srurxrpio4ap n neslsfaDra(mpnt0tptoio3iltfm elnmonu0treoir tadomDeln o;s0s2tmxmpnu1lme lncias) Dum(monu0apxo fciadfaDum(msnu0 rtnxr iodlmt  u o ()trurim nu1openlfvtatfs2rau pou0tpenmoctlsfsDum(vs;(0areoxo3oytoaDrlnvol()trxr(o3ny4openlnct (fsrumumpou4tlxo feiadla elu pnt0trerioctodlm elues () eur(r3no1ame lneil(farrmx pnu1aeeoio3iys aDua(mo u4 lxoxr oadlateli i s tetmimpoo1am nmivs (  Dta(monu4oetnmf3tls s umuvo u) exnmrciytfatean ils0 2umir3ny1opt  fctasfsDrr(  ;o0tltnmi3tldlaDrmn o;t0tetrir3oa1latr ieo (0trtrir3io4omtnlicil( s2taur ;o4oeenmietydfs ulnvsnu) lxnmrcoytoa eanes ()trxo(opoodlpe mivsas) 2urxrpnt4tpx  fetysfsDum(ms t0aetnmfctydfpDelneo;(0srxmxmpnodlmtnmnei t aDtru  ;u1aeeo f3iltfsDea(vs;u)aeenxf io1oaDeli i;t  exo(o3oy1ome lnvtlsf rtrumono1olx iieiadfm uan on() lxniocty1lm e n i s sexrim3oodopee ncsat)aDtmx  oo1ole iietlsfmDea(von(0tlenxf3tatfp  lu sl(0 ruoxo3io1alte nes sfsrua(rooo0oleo ieiysfs eau p t4aexrmr3tatfm   u i s  eur(m oy1oltelncsas)sDum(  nu0olenio3iytfs rm(vpnu0 eermf iy1fptrln s s0s2uoirpoodoltnlics (fa2taxront0tetnmicils m2elnms u0trxrio3tydfpD lnei s)srxrxm3oy4lm   iciat aDtru p;u1tpe iieiasla ran p;t0teerircta1lmDe ivs;s seumiopnudllenlnvtat  rumx  ;u4aet mo3iys a2ea(vpnu0 rxoio todfp   ues;s) rtmiopny1alt lnesls)aDrm(mpou1oee mfeils s rlnvo u0alermr3tatla r nvi;t0texo(opoudomenmfci t s2ua(mp;u4alxo i3iatla rmu pn(0 rxrmfctodomt anvs s  rxo(mpnudam nlfvil() 2trx  ;t4apeomfciltlaDeauvp;t)treoir3to1omDelueslt)sexmimpnu1am emfcsas)aDumx  ot1altomf3iltfs2ra(msnt4 rxnxociy1fatr u ols teuo(rpiudamtn fesls)aDumxr ou1oet  fcildfs umnms u0arxrxr ta1opteanvi t)srxo(o3nu4omte neiltfsDta(  nu4oeeoifeiatfmDuauvsn(4tetrirciy1fa  anvo s  euoim oo4amen fcsat srtau o;o4opt ifeiyt a elu s u4 lxoifcio1lp raneo t) eur(o3ny4lptemict s sDta(m nu1teeniietldlaDelnvs;(0 rxnxrcoy1fpDr nvs ( sexr(r no1llenlnvi sfs2raumooo0alt mf3tatfaDrl(mpnu0altomf oo1lmDraivi s0setmxr3oudamee nvs ()srrmu ooo1tpxoii3ias s2rmn p () rxnmr3todfa  luvilt t2xmxo3ou1alte nvs ( s2rrumpoo0tpeomoetyt a2emu pnu0aetnxocootopD au ilt)t2tm(mpoo4lmtnmnvtltf 2ta(rp;t4tee ifctydfsDumuvonu)aexomocta1fpD ai i s0 ruoirpny4aptnmfcs ()s2urum oo0opt if3iadfsDrm( s u0 leomocto1laD  ies t  rtm(o3ny4op nlivt sfa2umxmpot0tlt  ocild s eluvpn(4 leoxoctadlmtrauei;t0tetr(opio4olt lieia(  rtru ooo0aetnioeiyt mDumnvsnt0 etrio3tydlaDr uvs ( t2toxm nudape livtlt)a2rmurpot4open o3iatfs2elumo t4trtrircoadopt  nvo s sexrimpno1op e ictlt) Drru p;u4opeomi3iydla2el( o;t0trtrir3oatfp r n o;(  rumirpoo4lpt lnvils)sDrru ono4apx mfciasfaDua( on() lxomr3ta1optelivils)trxo(opiy1ol nmiesltfsrua( p;t0aptnmfctysfsDrmn ont0 rtnio iydlp e u i;t0s2urxm nu4ll nmnvi s)s2ra( ooo4opx mfeildfsDem(vo;(0 rtomr oa1faDelivs;t  rtm(o oudlp emictl( a2rrxmpot0opt  fciat a2um(vsnt4texrif3ta1omteli s;( truo(mpou1openlnetlt) rtrxrpou1optomo3iytfa elu pnu4trxoir3to1lm elivsl( tetr(o3io1olenmiet s)arrauro;u4optnmf3ild s rm(msnt4altomf3ootlp rau i;t0srtmxo3oodape  iei ()sruaxm ;o0oltomieiat sDeluvs;t4 rxnmocoatlaDelneo t)t2uoxrpiydll  lnct sfaDurur ot4alx  feiad a2ra( snt0aexoxr ia1omteaneols  rxrxo3no4olen fcia(  rtr(rpou0apen i3iasfsDemuvs (4 ltrxf ta1laD an sls0 2trio oo1ap n nvilt srtaxrpou1tleo oetadlsDraumpnu0trtoxrcoa1la   ivs;t setmio3oy1llte nvi t)aDuaurpnt1alt mfeiadfaDuaumsnt)aleoxo ia1lm   neo;()srurxmpnu1ap  mfeiltf Dumumonu0altn fctltlm2umuvpnt0tltnmf3oytfp ranvil()t2urim3iy1lm nmnviasfsDrauronu0oleomf3iadfsDrmnvsnu) lenifcoa1fm  aivi;( t2toxm ny4ll elfvsls)s2ta(rp;o0tltniictasfm ua( p;()texnxr iydopD luvslt0srxmxo3iodoptnmfet s)srumur ot0teeoio3ilsla elums;t4 rxrirciadfm elieol() 2xr(rpiy4openmivt (f 2urxrono1apx  oeilt sDem( o;u4 lxnmr3tydfaDran s;()trurio oy1lmtn fvi ()a2rrx  ot0oexnmo3iaslaDrmnvp;(0alxrir oytlaD au i;(0teur(o nu4ome mfvs tfsrta(ro;t4tpt  octad m2ean s;u)aexnxo totopte uesl(  rumxr3ny1am nmnvt t artmxrpou4tptoifetls m2elump u)aeeomf tadfm  aivo;t  etm(r nydale liet s)srtrxmp;t0ape miciysla elnvo;(4arxnmo todom   u o t0 rumxmpiy4ope lncsl( srrm(mpnt1olenifctaslm2ean o u0 lermo iy1lpDe n i;t texmxrpoudopenlncil(  2urx  ;o4texn f3iyslmDua(vo ()aeenxr iadlate ieil(0trtm(opnu1omen ivi s sDurxro;o0optomfetatfmDean snu0 eerir3oatfpte u s;s0s2ur(o iu1ll  mieslt aDumu pnt0tle  o3ias a rl(vs t0aexnmf oydfmD  ivo t)s2tm(o3oy1om  lfet s)arrrxmo;u0texn fciysfm2eluvp t4artomr3oy1fpDean ilt0s2xrxo3iy4al elicil() 2um(m ;t0aet mieiasfmDrm( ont0tlxomo3oytlaDeluvolt0t2urio io4omenmnctls  2uru onu4olxomf3iat a em(vo;u4tetrmr oydomt ai s t s2xrxmpny4omee nciasfs2trxr ou0oeenio3tadfsDrm(vo;t4 rtrio3oodoat au i;s)texoxo3iu4amee ieiltfa2tmxr nu0tle mietyt mDrauvp t)tltoxrciotom rlues;t) rum(o3oodal  lneta()arrrxr ;t4oee  o3ils sDulnmp;()tetoxfciy1omDean ols)teuoimpiudoltelfes ()artm(m no1tpx  o3iyt s2uauvont4 exrio ootomtrlueo ()t2uoio oy4lp nmnesls)artmxmpnu0texoiociytfm2umu s;(0 reoxocoydfaDraueo t0s2urxrpny4altnlieias)sDua(m oo1apx ioeias aDra( o u0aexrmoctotlp e nvi;(0t2xoxm iudlmtnlicta(  rur(m ;o1aptoioetytla2ea(ms;(0artrio oodfatrai sl()texm(r nu4lmtemfesa(fs2umumont4apeoifetyd a el(mont) rtnxo iadoatrln s s)trxrimpiu1ameemfvs s aDtau o;t1tlx mfeiltlsDra(vsnt)tltnmr tadfat ln ils0 2toxopny1omtnlfvilt a2rau  ;o1tleoiictyt a el(vp t4 lerxrcta1laDe n s;s s2tmir3oo1oleelict ()srtmu pnt1alx iicilslm2umuvp;t)aetoxr oadomtelu i;s texm(o oodoptnlics tf Duaurp;o0apt ifeiadlsDrm(vont4arerifcoadfa  lnes;s0s2toiopoudom e icils srtaxm nt4alt  o3tyt m2el( s;u0 lerxf to1lmD anvs;()t2tmxmpiodopeemnet (  2tmurono0alxo fcias sDel(mp;u4tleoxocio1opDr nvol(0t2xm(m3oy4apt  neta()a2rm(mpot0tpxnmictydfmDuanvp t)altnxrcoy1omD  uei;() exoxrpoodlmte ncs t sDrauroou0apt mo3iatfm um(ms (4 etrircoa1omt ai s;( trtr(r3iy4al   neil(fs2umx oou0tetn i3tldla eluvp;()teerxocty1lateai o t)s2uo(m iydopeemfctat aDuau  ;u0olt ifeiasls umu p;t0tlerxfcootlmtrliesl(  2uoxm nu1al e fcsl() 2tax ont4tpxo o3iltfa2uau p u0aetrir iotfpDeliesl(0 exrim3nudale lfes sfa2tr(ront4alxnmfctytls2rlumsn()altoir tadfa ean s;t0 rum(opiydlmt mnvt s  rrm(r nu4altomi3tadlm rmnvpnu4areoxf3ta1op eln s;s truo(o iudaptnmncs ()s2taumo;u1olxomo3taslsDua(ms;(4aetrmr3oytoa  livol()teur(o nydop emnvsat aDtrur no1tpeomfeiasla2ea( p;(4tetrxocta1latrlnvils  eurxmpoudlmee nvt () 2urx o;t0tltnmi3tlsfs emu p t4aexnmo3tydlmDr ivs;()t2tm(mpoy4omtnmicslsfsDur(  ;u0apx mieiadls2rmnvp (0texnif3iotfpDelu i;t) 2xrio oy1am nmfvtl(f 2tm(rp;o4aleo i3ildla2rluvs;u) ltrmf3tydlmt  nei;s  rtrxrpoo4lp emictat  rtau  ;t4aee ii3tytfm uanmp;t)tlerio todfpte nvo t) ruoxr oydlltn fetls s2taxmpnu4tlt  feilsfa eln pnt4trxoio oodfptrli s s t2uoio nu4am  mncil(f Dtrurpot4olxo o3ias s ean o (4alxoxr3oatom  lnvo s0s2toim nydape mivilsf rur( oou4texoifciys a2elump u)arxnirctadopDranvols0srxoim nu1olenmfvtlt) 2tmurpnu1oltnioeilsfa2el(vsnu0trxrmrcoydfpDelnvsls)srxmxopnu4opeelfes s)aDta(m ;o0apenio3tytla rluvp t) ltoxf3tadfmtelnvols)texm(r3iu1aptemfei t)s2tau p;t4apxniociyt mDuaumsn(4texnxo tytopt luvs;( teum(m oydlp elnetl() rtm(r ;u4openmf3tyt m2eauvo;(4teeoirctotlmDeai o;t) eurir oy4lmte fesat sDrr(rp;u0texoiieiydfs rmnvs u)texnir3oo1fmDeliei;s)t2xoxo nu4alenlfcs ( aDrru o;u4tlxn ieiat sDuluvo;(4 lerio io1om eln s t) etmir3oo1olen fvta(  2rm(r ;t0optniiciys s ea(vp u4 eerircoatop elivs;( teumxr oo1lmenmici s  rraum nt4oetomictlslmDel(mp u4tltoif ta1op rauvils  rxmir3oy4lltn nes (fsDtmuroou4olenif3tldfmDelums;() lxrmfciy1fpD livs t0trxm(r3nodole livsa()sDrrx ono4oexniiciys sDeanvp u)aleomocia1fptranvi s)tetmim oo1omtelivi tfa2rr(mpou4tlx micias m ea(mo u0 ltomf totfpD li i;t srtm(mpny4op nlnctatf Durxr ;u1apxn i3tasls2emuvo;()tltniocio1fmD  ivil( s2xmim3ou4optemnciat sDtmum ot0openmictys s2elumsnt)tleoxr tydfmD ln i;t0seuo(r nu4al  lfviatfa2rru  ;o1ole if3iytfs2ua( s u)tleomrcto1fm ean o;t trtrimpoodap nlncias)sDtax oou0optnmfeiytfa2rlumo ()trtrxr iytlmtrau s t)trumxo3nu4olt  fvils  rrrxrp;u0texnifciltfa2um(ms;(4 rtrxf oa1la eli o;(0s2uoir ny1ap n neiatfsrururpot1tptoioetlt m ulu pnu4 eenmrctodlatrauvils sexr(o nu4alt  ncsls)aDua( o;t0oexomf3ils s elnvsnu) leoxr3oa1fmtean o;t truo(r iudlleelivt sfarua(mont1apx  o3taslmDel(ms;()ar
\ No newline at end of file
@@ -0,0 +1 @@
+i s;s) 2uo(r3ou1open fet ( a2um(mpou0aetomf3iltfmDelnvo;t)aexnir oo1fpteanei;s) rxoxo io1omen nvtl( sDum(r oo4alxn octasfs eluvo;t4trxnmoctatfpteanvo;t  2xo(r ou4ome mivtas s2umum oo0aex  o3iadfm eluvo;t0trenmf totopt ai i t t2xr(r3ou4am nlfvi (faDtrum no1alxomoeild sDrlump;t4artrmf3totfp rli s;(  eumxopiy1lpenmnet t)aDuru ono1olx  fciatlsDeanvo u0 lerir tydlmD  u i (0 eto(o3oydlltemictasfsrtm(ront1tpxn o3tydfaDelnvp ()tetoxf3tadoa eaueo () 2xmir3iu1op e fcslt  2tr(ro;u4tpxn i3iltlm2emn o u4 eermrciy1fmDe ueolt  2tmxr iy1am elnvs (fs2tmx pot4aexn oeilt a2raump u0 etrmo3oodfa  aieils0trtrim3iodlle lfesl(farraxr nu4aee  i3tld aDrmnvp;u4texrifctydlaD lnvo t) rumir3io4apee nvsa( aDtaxrono1aleoiieiasfs rln p (4aeerxf oodlmDrau o;t)teuoxopno1lmen fetlt  rrmxmont1tleoifcilt m uanmont) rtomf3ty1laDran ilt  2uo(r3io4lp  lnei s  2ra( ooo0tpenmi3iad s umuvs t0artrmfcootfate uvi;(  rxmio3io4ll nlfet t  Drmxmono0opt if3iysfmDua(vsnt0 lerir3oodlatraneolt0s2xmxo oo4ale  nvi t)sDtmu  ;o1tlx  fcils m2ulumsnu4areoxo ta1la ranvs;(0 exoim3ny1lp e ietatf 2uaum oo0alt  f3tld s2uanvp;u4 renmo3oo1fpt  ieolt  rxrxm3iu4omt lfcta(faDta(mo;t0alxn ocilsla elnms u4tetnxf3totfaD liei;() rxrim3ny4om emneilt sDta(  nu0oee  f3ilsfs ra(vonu4aetnir ia1omDe n s t0teuoiopio1optnmivsl(  Dtaxrono0oltnmfetlsfsDumnvsnt0arenxr oo1fpt lnvsl(0trxoiopnu1al  lict ( s2rrumono0opxnio3tlsls2ea(mp;(0teermf3oy1lm eln o;t t2xo(o3oydopee icsls)arururpou1tlxoifeiatfs ua( s;t) exnxrctatoat au s s)trxrio3ou1amt  nei t srum(ronu4alx mo3tyslaDulu s;u4alermr3tadoaD aues;(0trum(o ou4aptemfctas) Dtax o;u1teenmoetas a um(mp (4aetnmo3tydfate uvi;t  rxoio io4llee ivtltf Duax  nu4aet mfciasfm ra( p u0 eenmocoadlm e neo;s  2uo(opoo1omtemfetat) rra(m ;o4texomf3iys a2umu o;(0aexnxr3tatlaDrlnvo;t0 exmxopnu4om   fci t a2tru pot1opt moctlsfs umu snu0 etnmrcta1lmD lu i s0trumir nodlpt lfciat  ruru  nt0ole  octydfm rlnvo;u4trxnmrcoy1lpte uvi;(0 etmxmpnudamtelieil()srtmurooo4olto f3iad aDea( snt0 lxnmr3oatopte neo;t  rtr(r3ou1lp e fvsat)sDraur ;o1oexo oetadfsDum( s;()arxnif oodlpt ai i s) rumxo oydlptn iei t  2rrx p;u4tex ii3tat a2ranms;(4teenmfciatopte u o t sexmxr oydlpeelnvia( s2ua( p;t1optnio3ils a2el(mp;t)trxriocty1om r uvils) rxrxmpoydoleelncs (f 2tm(mpoo0oleo o3iyd s2ranvp u4arerif iodfaD au ilt0seto(opoy1alt mnvils)a2umx pot1oeto i3tydla rmnmpn(4 rxoio oytlp   nes t0tetrir3oy4lleemneiatf 2tm(m ot4oexomieiad a uaumo (4aetnmr oa1fp eluei;s  rumxo3oudlpe lics t)s2um(ronu4oexo feiadls2ulu o;u4 eeomr oa1oaD ln sls t2xoio oydope  nvias)s2tr( pnu4tpxniieilslm2rlu o t) rtnxr oa1lmte uvo ()seuoxrpno1lpen fvil( srurxmpou1aexomietls s eanmon()texrxf oydfmD  u i;t)teuoir ou1aptemnvs () Drm(m oo0tpx moetyd a2rlums t) lermr iodfmDrluesls sexoir nudlmenlfesls sDrmxmo;t4aexo ietydlm2rm(von()tleomo oodoaDelivi (  2triopnodoptnlnetl(fs2raump;o1apxn fciydfsDran p;(4arxrmrcootoa   uvo s  2toxm oydalt mics t aDrru oou4tleo f3iasfm2em(mp;() lxniociadomtrlivs;t  2umxo iydll e ici tf Duau  ot1teeo fctys m eaums (4alerxr3tatlpD auvsls0trur(o no4apte fes s) Drauroot4tlt if3iydla2rlnvo t0tetomfcoatomDran ilt) rtmxopoy4oltnmietasf rtaum nu1olt moeiyt m rm( pnt4 exnxfciy1fpDrlueo s)srumimpio1llenlfvs t) rtm( p;u1oeeoii3taslsDelnms t)tltrxociydfaD  neo;t0trtoxm nu1al nmici t) rtaxro;u4aexomoeiytfaDeau s (0 rxnircoatfmt  u s;() rurxo oydalen nvsls  Draxront4aleo i3iysfa el( s t4arxoxf tadfpD  n i s)trtr(o3oydlm n fct s)srraxronu0oeenmf3tls a em(mpnt4 rerxo iatoa elivo ( trumiopoo1altn feslt  rtmx ono4aetoio3tltfm rlnvs u)trxrifcoodop raneolt) 2xmxo iudlmte ict (fa2rru  ;o0tlxnmoctasfmDrmnvon()tetnxf3iytfaD lnvsl( t2xm(o3iodam elnvils  rumx onu1oexnifctadlaDelums () lermr iadla elu slt0 rxo(r oy1lm elivta(fsDumxm ou0tlx mfetad s umnms;u0trxnmfctotfaDraivo s0 etr(mpoydlp nmict s) rrmxmo;t1opt ioctas a2emnmonu4aleoxf oydfmDr i ol( s2toir iydlp elivias a2rax p;t4tltnmfetat aDeluvon()trenif tydfpt li slt0t2xr(o ou1lmenlfcsl(fa2tru  ;t0opxoiieiltla2umnmp;t0treomf tydfp e u s ()s2to(o nudlmtnmiesl() Dta(mp;o4aee  fcias m2ranmpnu4 rxrio iodlaDe nes;s truriopiudlmtelnes (  rua(r nt1apx iocildfs2ul(vo;u)artnxf to1fmDe n i;s0 2umxm iy1lpt lfcsls s2tmu ooo4tle io3tasfa ran o ()trxoxo iytoa eai s (0trxoir oy4ap nmict t)sDumu pno1optoiictltlaDrl( s ()aeenmrcio1fa rlu s t  rtrimpoy1opt mncils) Dum( pnt1alxo fctad a emu pnu0tltnxrciytlmDeaneo (  eto(opiydapt mnet tf Dtrxmpou4tptn f3tld m ranvont0tltnmr3oodlatrai o;t0s2xm(r3nu1altemfei t s2rmxmpno4tpenio3tls a rauvo u0aeerxf3totlmtrli o s t2xmio oodamte ietlt artmu  ou4olx  oetasfsDrm(mont4 rtomfcoa1omtr n o (0trxmxo iy4omen fetatf rumurpou1alt mfctldls2ea(msn(0texnmfcto1opt li s;s0 exoiopoodalt  nes (fsDua(rpno0oltnmo3iat aDul(vp;()tleoxrcoatlaDeli o s  rxrxm3nodopte ivt s)s2rmxro;t0altn i3tyt sDrmuvpnu)artoio3oy1fmDrlnvo;t)s2trxopoydoleemivi ( arraxr no4tpt mo3iatfaDulu o;u4 rtrxo3oytla  ln s;s) rtm(rpiy1amee iesas a2tr(m ;t0aetnmi3iyd m ulnvp (0altoifcootlmt au i;s  rumim3iydlltemiesasfs2ur( p;t4apt mociatlm2ulu ont)tetrir3tytfp   nes s  eur(rpnudamtemfcsl()s2ta(rpou4aeen oeiad a rluvs u4trtrmrcta1opD aues t)t2xm(m3oydlmt lnesl() 2um(ro;o4tpe mfeiydfa2elump u0 leomo3iatfpDeli s t) rxoxo3nudom emnvsat) 2rmu oou0oeeoiocias m rmuvpnt4 lxrircoatfpDeanvs;s t2toio3io1am   feta(fsrrru p;u1aexn feiyd sDranmonu0aetnircoytfa ran s s) eum(o3ou4omeelnct tfartmxmpnu0apxo ictyt m2eauvo u) lxnxrciotopteanes s s2urxo3oodop nlfctl()srumxm ;t1alxn ietls a2eau s u0 exrir3iotomtrlueo;t)srxo(m oo4amee fetl( s2rm(rpnt4alx ioeilslaDumnms ()aetnir oadlatrluvs ()seumxo3nudapenmieta() rrrumo;u4alto o3ilslaDum(vp;u)tetnifctotfmte neil( s2tr(mpiy1lmt lnet s sDrrx oot0aexo oetat a rmump;() rxnmf ty1oaD  ivs;s)s2xoxr iodame lnei tf 2uaur ;u1alxomietadfm el( o (0 eenio3iatlaDrauei t0trtrxrpnydoptemnvi t) Dtr(rpot1oee mictydfs2ul(vo t)trtomfcoydopD aieo;s)seuoxopou4ale lfctatf Duax ono0opx ioetysfaDuau o t0texoir3tytlmte u il(0setr(r3oy1lme lnesatf rtmur ot4tlx  ictltfa rluvo u)trxoxo3oa1fm ranvols trxm(m nudamtn nciltfsrrrum ;t1altomoetydfaDulnvp;u0tleriociatopDraneil()texoir3oy1opeemiesa(f Duru  ot0aex ifctlslm2rl(vp;()trxoxf3tydlp  ln ol(0t2ur(mpiy4omtn neslt) 2trxmoot4aexnmietlsfa ulu on(4arxnxr ty1laD lneo;t t2um(m ny4olee fesls)arra( p;o4tpeo feiytfs rlu o t0aeermf iy1faD ai ilt0srxmxo3nydllte feils)aDrmx ono0opx iietyt aDem(vo;() exnio3tadlaD  uesl()sruoimpno4oltn ics s)a2um(  ;o1apxoif3tlslaDul( p t)altrif3io1fmD anvi ()sexr(o3ou4am emivsa(  rumum ;u0alx  f3iltlm2ea(vs;u)aexnio3tydlptelivs ( sexmir iu1ome mivi s  Dtrum oo4openmfciyt m ulu p;t) etnircoadop rai o;t sexmxo nodale mivt sf rra(m ot0olxomocils a el(mpnt4altoxrctatlmtrlnvo;s)t2toir3iy1ap e fes s aruau p;u4alt  o3iys s2elums () etnxfcoo1lm  au i s)s2to(r iydol  mnet s s2tmx onu0tleniieilslmDuauvo u) reomfcty1oa   nei;t) 2xrxo iydlp  mfei s s2rmumpno0tpt  ictydla2em(vs (0tlxomfcia1fmDe nei;t)truo(o3ou1omeelfvtl()artm( p;o0optoioctys aDrlnvp;t)areoxo3oytlmtran o ()s2tm(opiy4ole  net t a2ururpou0oexnmoetatfsDrmnms;t)aetrmf3ty1fm raieo ( trtmxm3oy1lpe  ncs ()sDumxr nt0aeenifcildfa2ulnmo ()arerxr3oadfp eli olt) etmiopiu1alee nvi s a2tr(  oo4aetomi3iasfa eln on()aetnxf3oatfptelies;t  2tmxmpiy4omte feiat)arum(m ;t0alxo oeilslaDrm(ms u0 exniocty1fpt livo t t2xoimpiudaptnmnctat)s2umu oou1olx  feils mDranvo;t)areoxr3iotopDraivs s0setmir iydap nmnvi t sDrm(r ou4aex iicilslaDrln pnu4trtnxo iydfmtean o;(0s2uoxm3oo4op  mivilt)arumurpno0apxn ociadla2um(msnt4arxoxfciodfm eaiesls)texoiopoudllee neiatfsrtaurpnt4altnmicils mDum(mp;(4tetrmr3tadomte ieolt0trtoxopny4olenlfei (  Dum(m nu0aetomoctytlsDra(ms u4 ltnxr iotlm eaies s  rtoxrpoo4opt mneiat s2tm(r ;u0openmo3ilsla emn p (0trtnir iodlmt luvs (0 2urxr oudameemiciasfartaumpnt0optniocildfm umuvon(4treoxrcoodla elivsls s2umxm3no1aptnmici sfaDum(m ;u4olenmi3iydfm uln snt) exomr ta1lpt  nvo;s0 eur(r3ou4aptn fvi (  rtr(mpot4tetnii3iatla2rl(mpn(0arerxfcoodfa e ivo;(  rxmxo3oudlmeelict s)s2ta(mpnt0altoif3tytla rmnmon(0aexriocoa1oa r uei;t0seurir3oy1lptelncs s  Dtaxronu1tle ifeiyslm uln p u0tlxoxr oodfmtelnesl() etrirpnodam n ncslsfs2rmumpnt4oexoii3iadfa el(vs (0 renmf iotfatr n il( srtrxmpiodlptn ncsl(f Dra(mp;t4aet  f3tld m um( o t0trenmf iydla r i o t0 rtoio3iydaptnlfvs s  Dtm(  ;o4alt iietadfm emumo;t4altoxr3tytomteaneslt t2uoxr3iy4oltn ivia() Dumxrp;o1olxnioeild s ea(vo;(4 leoif3oodlm elivslt0seurxo nydoleemfesl( srrrxmpoo0tlto fctadfa rln onu4alxnxr3iy1oaD  ueils0t2to(o3oy1amt lietat aDumx pno0tle  ictatlmDum(mo;(4alxnmf3iotoa   uvi;(0srxoxm3oy4ap n ivia()aDra(m ;u0tlxomieiltfmDuan ont4aexrxfcoa1fpte nvolt0srurimpoodll   nvil(f Drau  ;t1aexnmfeiysfs emn p u4tetnmr ootfm  luvi s)srum(r ou4lmtnmivtl( sDumumpot1openifetldfm2rln o (0tlxrmocoatfaD an o ()s2um(mpiodlme mivsa(faDrrxmp;t0aptn i3tlsfs2uan snt0trxnxf iydop  luvsl(0 2umir ny1llen neil()arumu oot4oltomociyt s rmumpnt4 lermf3iy1lptr neo s0 exmxo3oodlptelnes tf 2rru o;t4teeoiicildlmDuauvp (4trtnif3iytlmtran i;() rtmxm ny4om n fcia(fs2tm(root0aptnif3tytls uau s;t) lxoxocoatlp  anei ()t2tmxr3ny4ole mfet s aDrmxrpnt0oexo ietldfm2umn o;() rtniociytomte iei;s)seum(o iu1oltemfvs t) 2rrx  no0apenmocildfa elumo;u4 eenxr3tadfa r nvo;() rtmxrpoo4aptnmivi tfs2rmxm no4tptnmfetas s ean s;t0aetoxf3ootfaD lueilt0s2xmxo iu1lmtelfesls  2tm(roou1alx  i3ildla ranmp () exrxrcio1oa  ln i () euo(opnodoptn iei ()aDrax pot4opxo o3tadlmDuanvp (4arxnxfcty1fpDr u s;s)sexmir iudom  lfctas) rrauront1apt if3iltlsDem( s (4trtomo tatlp  lieilt s2ur(r ou4lm emnesl()srrrumpot1aetomieiysla uanvp (0 reomf3iytom   u s ()texm(r nu4olee ncs s) 2tmx pnu4aeeo octatla eln pnt4aleoif3iotoat lnvs (0trtrxm3iodameelfet tfa2urxrpnt1apto ocias s elnvsnu0 eerir3oydfp  li i s  rumio3iudam n neiasf 2rm(ront0opx  o3iat sDel( p;t4trxnmrctadfmDeaies;t)sexmir iy1apeelfcias s2umxro;o4aptn octas m umnms;(4trxoxf oytomtraueo;s)setmxr3ny4ape mfvias) 2rr(rp;o1tpxoifctas s2em(vpnt0arxniocoytopt lu o;( teurirpiu1altnlfet t) Drmum ;t4tetnmi3iydla2uauvs (0texomf3tatfmt livo t0 2xmxo3ou1omenmietlt  Dtrump;o0teenio3iatlaDul( onu4altrio3ia1om rlneols) 2ur(mpnu1lmenlfet t a2rmx pnt1oee moetydfs ra(vp (0trtomr oatfpteanvo ( teuo(r ou1lpe mfetasf rtax o;u4aexo ociat a2umn ont4tlxomrcoatlpDrlnes t0trtr(o iudopenlivsat) 2ta( oot1tle miciys s ea(vpn()artrio oatoatraues;t0t2uoxopoydll  mneil( sDta(moot0aexomictys mDul(vsnt0alxrif oytlpDranvslt)s2xr(opnudlpen fvsas)a2um(  ot0olto fciyt a2rm(mp (0 rxnxfcty1op e uvs;(0t2xm(m oudopen fvsasf rta(  ;o4altn ocias m um( sn()teenifcia1fmDr neolt)teumxopio1aleelnci ( a2ua(mono4alx mieiaslmDelnvpnu0tetrmoctadfmDranvo;s t2uoxm io4ale liesa()sDtrxm ;o4alxnmf3ils m2ua( s t)texnxfciotfp  auvo t0s2umir no1llt  neia()sDurxmoou1ale mieiyd m2um(vsn(0tlenmr3oo1fmD  nes;()t2tr(o iu1ll emnvils  rtru  ou4aexn iciasfa2rl(vp t0tlerircoydop  li o;s0t2xmirpiy1op   nctat)s2ur( pno4altnmf3iytlsDemuvp u)texnif to1lmtrauvs s  exmxmpoo4ome  nci (farta( pou0aexn fctatfs rl(vs;t0 lxnio3tatlmte ieslt  ruoim3no4amt lfvtl( s2tmxrp;o4aeto oeiytls2rlumsnu4 eenmrciadoaD aieo;()t2uo(o iu4apt mivtl(fsDtru  nt1oltnifciaslm eln o t)aetnif3iy1laDraies ()trtmim no4aptnlnci (  rur(r oo1aexoifcilt m2eanmsnt) ltoxo3to1op  livo;(0t2umxrpiydaltnmiet s)artau  ou0tlxn ieiatfs emnmp;t4aeermfciytfp eliesl( t2ur(m nu4am nmiesat)s2trxmpnt4tleniociysfsDrmums t)altnifciytoaDe ivo;s0seuo(opny1apeemnetltfs2tr(mp;u4oetnmieils sDuan snu) rxnmrcoa1lpDean o;(  rumxo iu1lltnlnvsasf rum(r ;t4olxn iciadfa2ulumonu0tltnircoytlm rlnvs s0srxm(mpoydalen ivta( srurxm nt1tlt  icild m eln o t) exoxrctatomDe nes;s)sexoxo3no4omtnmnetls a2rrxmpnu1olt mi3iatlm2rlums;t4 rxnmo tadoatrlivs;(  rtoir iydoltemfet tf rtru  nt4apto fciys s ra(msnu0tetoxr to1lm eluei ( trurxr3oy1lmte fciasfs2taxr ;u0teeomi3iltlm rmu p;t0trxomociatopD li i s sexoio nydam elfeiatfaDtr( pnt4aeto o3iysfmDelnmsn()alerirciadomt  i i (  2uoir3oodllenmnesl()sDtm(mpoo0apt mfetlt s ea(vonu0teeomfcoytomteaivols0t2tmxo oo4opte nvtatfartaxmo;o0aeen f3iltfmDrln p;u)trxoif3oy1oaDr uvo s)setrimpno4ap  mies s aruru o;o1oexn iciytlm el( on(4trenmr3tatoaDeli slt texmio no1amen ncta( aDtru  nu1tpt io3ildlm2ua( o u)artnio3io1fpt au s ()seur(r oy1lpt mfcs s)sDururp;u4ole mfetydls2ea( s;u0 rxrxrciotoaDrlivsl()texmxo3oy1aleemneta( s2trump;t4teto o3tatfa2rlnms;(4 etoxfciadlmte n i;(0t2um(r iudlmen ics sfa2ururo;o1tpxnmf3iltfs em(vo (0areoio io1lmDelieol(0setrxrpnydap  lnetasfaDrmx  ;t0tle  f3iys aDel(vpnt) reomocoatlpDrlues;s)trtr(o iu4olen fcs ( s2ta( pnt4tptnmfeild mDuanmon(4 lxrmo3oy1fmDe ieils) rtoxm iy1ameelivt s) rrmumpno1altnii3ilsfaDrluvo u4 eermrcto1fmtr ies t) rxoimpoy4lltnlnvtls aDtrum ou0optnmi3ilt s2eauvo t4alxnmf ootfp eau i;( t2xo(o nodlptemnet t aDtau o;o0opeoii3tat mDuauvo;()tlxrxrcoatom eluvols  etm(o oydamee ivtls arraum nu1aeeo oetadlmDumu o (0 etnxr3oydfatr u i t)t2to(o3no1op nlncsa(fs2uaxmpnt0opxoifcildlm umnvs t)trtnircta1fp rln s (  etrimpiudomen fct s) rtr( ono0oltomictadlaDemumpnt) leoif tadomD an s s setoxopny1om elncsl( srtmumo;t0tpeomo3tyd mDem(monu) etrmf iy1fatrlneils t2tmxmpiydale lncsasf 2um(rp;o0tlx if3ilsfs2eln o;(0tlerxr3oydopDe ueo ()teumir iu1omtnmfeslt artm(monu0olx mi3tldlmDuauvonu) rxoif ta1op rlnvilt0t2uoxr3oo1apenmnci (  Drmu  nu0tle mf3iyd m2ul(mp ()artomr iy1opDrln olt0teto(o3oo1llt mfct t aDuaxmoou0aetn fciys mDea(vpnt0 lenif iodfp  lu i;t0 exmirpiu4llt lnvslt  2tmxmpou4oeeomi3ildfsDea( p (0 lxoircoytfmDraues;t t2xo(mpiu1omenmncs (fsrururo;t1tlen i3tadfa ra( p;u) lermf oydfm e uvs;(  rtmim3nu4lp e iei t)sDuaxmpno0tptoif3iydfa2umu p u4alxoif oatomt  i i;s0t2tmxm3iydop  mfesat arumx onu1tlt  ieiydfa2eau o u4trxnxf3todlaDeaieo;()t2urxm oo4amt  ivtls a2umxm oo0teeomo3tlslaDra( p;u) ltomo io1oat  uvs;()t2to(o io4ll nmnvias)srrrxro;u1aex mo3ias s ua(mp ()tltnifctadoat aivo t)srtrir3oo1alenmnviatfsrua(rpot1aeenmf3tadla2umnmo u4aetnio3ty1opDrliei;()s2tm(rpoy4ap nmnvt (f 2um( o;o4teeoio3ilt m2rmu pnu) exomf iydlpD aivol()t2umxo3iy4opte nvsl(f 2rrx onu1oexnifetytfmDemn s u0artoxr3tytoptrluvi;t)t2uo(m oodamtnlfctls s2umxmpno1opto i3tysfs rm(vs;(0 rtnmr3todfmD lnei s)texr(r3ny4ol elfeias arur(rpnt0aetnifeiysla eaums;(4tlxoir3iytoa e n i (  rto(r io1lpteliei s  rrr(m nu0opx mociytlmDem(vp u4areomfciadlmtrlnvi;t)s2xo(o nodamtnmfcias) Dtm(  ot0olxoiieilslaDuln pnu)alxoxfciatlm   ivs s)seum(m iodaptemnctl( aDtmxr no0apeoiieiysfs2el(mp ()trerxo iytlpteanei s t2tr(rpoydom nmnetlt) rtrxm ou0oetnio3ild a2eau p u4aetnio tadom  lu s t  2umxmpiodam nmnvsl()a2tru o;u4tlt  iciadfaDumnms u)trxomociydfa   i s;() 2xmio io4optn netl( artm(m ;u4apen ietysfsDrlu o;() rtnirctytlp   nvs s0srtm(r nu1olt mictat artau  ou0opxnmiciyd mDra( snu) rxomo tydom eai il()seuo(r3nu1op  mivtas  Dtr( ono0tlto fciadfsDrln pnt4texoxrcoadfa   n sl(0 eumim nydlme mfvia()srra(mp;u0open fcils s2em(vsnu0alxoiocoytlateaneo;(0 eto(r3ou1lmt lfesat aDurx o;o4tlxnmi3ils a el(vs;()teenmr oo1lmtelies s0t2ur(o nydolt  nctls a2ta(rpot1tpxoioeild aDuau o;t) exnxr totom  lu ols) 2xoio3iu1ole lfvi (f rtaumonu0aexnmoeias mDrmums;(4 lxomrcta1fp rlues;s0seum(r3nydlmtnlnct s  2tax o;u4olxnmoetydlsDrl(vo;t0 etnio ia1lmDranes ( setoim iy4lltnmietatfaDum(r ;u1aexn ietlsfsDuln onu0 rtnio3oydfp elneilt) 2umxr oodolen ivi (  2trxmpoo4tpx io3iat s2eanvsnu4aetomr3ia1la raues;s setmim3nu1lpe  nvsl( a2rmxmono4tpx  ieiltfaDumuvs u0tlenmo totlpt  ieo;t)t2xr(m3nu4ale mnvslsfsruax pou4apenif3iasfsDrm( o (0 lenxfcootom  lies;s)trxrir3iu1llenmnvsatf Dta(mpno4tpeo ietasfa2emn s (0aeeoif iy1lpDelneolt s2xrio nodlp  livt (fsDua(r ;t0opx ii3iadfa rmnvo;(4 eeoir3io1op raivs s0srxoim oy4lp nlfvils)a2umx  ot1aetomoetlt a rln ont4teeoir3tadomt ln o t  2to(o3no4oltn ieiat s2urum no1ope  f3iyt sDeluvs;u) rxoxo3ootlaDrauvilt s2to(rpio4llt lfvsls) rrrxm nu4tpxoif3tlt s2ul( pnt4alxoxr totfaD  ivo;s sexmiopou4optemfvsat)s2taumonu0opxo i3tydlaDeauvs;(4tltrxociatoat lies (0 2xoir3oy4opte feias  2urur ;u1oee  oetat mDul( s t)tltnmf ootlatr i i;( texr(o3nudop  lics (  Dtau  no1altnmf3iytfaDran snu4artrio3oo1oat  n ilt0srurxmpny1al  mnctlt)aruaxm ou4tpe  i3ils a2uau s;t0 lxoxfcoy1omt  i ilt0seumim nu4olee ncs t  rtrur ;t0oee iocils m rmnvsn() reoiocoydfmtrlu s;s) etm(m3oo4ol nmfci t s2raxrpou4tptoiictld aDrlu pnu)altoio3tydfateluvol() exmim oo1lp  lnvia() Dta(m ou0tee if3iltfm2rlnvpnu)altnxf3io1lmDrauei;s0srtrxo3oo4amtnlfvtlt)s2uaumpoo4alt if3ilsla uan o t0altrxr totfptelueilt0 2xoxopny1llenlics tf rua(rp;t4oet  ieildlmDrmn s;()tleoir3tadfatelueo t) rxo(mpiy4opt miet t sruaumont1texniociat s2ulnvo t0trxoif ia1fmDeai s () 2uoxm oudome mfei s) 2tr(mpou4altn ictyd mDem(mp u4teenmo oodfat lu sl()setoirpnodame  nviat)srrmxmpno0opx mi3ild mDean o;t0tltrxrctodoaD  u o t  2tr(o3ny1lleemnvta(  rraumpno0apeoif3iadfaDum(vs;(0arxomfcoodfpDeauei;t0texoxopnodlmtemfvsa(fsrra( pou1tlxnmfcils aDemumo;u0trermfcio1op rai i;(0tetr(opiydol nlneils)sDtr( pot0aee mociytfm uanvsnu4 reoxr3iydla  aivo s)sexrxr ny1lmen fcsa(fartr(rpot1oleo f3iadfm2eau ont4tlxoif3oatfpte ivs s) 2um(rpno1lltnlivt () 2uaumpnu4teenmieild a rlnmp;u0alenmocoo1fmtrlivolt)srxmir3iudopt lnvi (f Durxm ou4aexn fciysfm2el( s;t0arerirciytfat  n s;( trumio iu4oltemfcilt  rta(mono4tet  i3ilsfa2ea( s t)altoir3iydfmtr n s;t0 rxrimpou1opt mncsa()aDurx  nu0tetnioeiyd a2umnvpnu)teerioctatomD lnvi;() rumxrpoodlm n ivs tfsDta(mooo0oeenmf3iat aDrluvonu) eenmrctotfpDr uvil(  ruo(m ny1ll nlnvtat  Dtm( ono4ape iictadfa eauvon(0 rxoxo3oadlp  an s;(0 eur(r3nydope  fvta()srua(m no1oltnif3iyslm2ranmp;u)aexomocoo1la r uei (  etm(opnodaltn ictasf rum( onu4tlenmfcilslsDeaums;t4 ltrxf3todlm   ueils0s2xmir iodlpt  fesa()a2ra(ro;t1oexnmocild aDrm(mp t0tetoxr3todom ranvil( s2um(r3nudamenmnesl( arrm( pou0ole ii3iyt sDelump;t4tetrio oodlaD  nvslt0 2to(opny4op nlicilt s2rrurp;u0aex  f3tas s2rmn p;u0 etnmr iydlpt auvo;t0texoio3oo1lmt mictlsfsDtmx  nt4teeoiieiadlm ul(vsnu)alermo3oadlpDrlu olt sexmio3io1opeemietltfaruaum ;t4aet moctlslsDrlnmpnt0 lermo oydlp  an s ()t2xriopiy1om nmiesa()sDua( pot0tpx ioeiltlmDemn o;u) rtoiocoodomtr nvils tetmxo3ny1ll nmfcs () 2ta(r oo1alxo o3tadlmDra(ms;()texnifciadfpDeanvi;( t2to(r3oo1apee feia(fsrrmx pnu1apen oeiysla el( s;t4altnmfcia1lmDr n o () rurxmpnu1op nmncil(f rtmumpot1aetomociysfm eanvp t0alenif oa1om   neils)teuoim iodamtelieslt arrau  nu0aeeoioctltfm umnms;t4artrxrcta1latr ueo t)s2uoiopiydamt  icsas)a2taxmp;t0oeto oetls s2um(vp;t4 lenxr3oo1omt auvs;()s2xriopiu1oleelneil(f 2uaumoou1tpe  feiydfsDrlu p t0 rtnio3oatopte uvi;t srxr(o3oo4om nmfvi s) rumurpoo1tleomo3ilslsDuln o;(4texnxo iadlptelu s s0 euo(m oy1omt mieiatfsrra(rp;u0ape mo3iydlm ea(ms;u0 etnxf oy1fmteli o;(0trum(mpnodalt mfvs s) Dtrxm no1aet  octlt aDeanmo;t4aexoif3ootlmDe ivo;s setmiopiy1llee fvilt sDta(mono4tpe micildfm2rm( onu0aeenif3iodoa elu olt)t2trxr ou1lp n fcslsfsrraumo;o1alt  f3tad a eluvs (0texrio tydomt  neo t0 ruoxm ny1ame  netat)artr( ooo1alxniieiadla2uluvo (4alermr tatfaDrlnvsl( seurio nydope mfeta(f 2umur ou0apxomiciaslaDumu s;(0 rtrmo3totfmD li o;()teurxrpio4ap nmfet t) Duax  nt1ole  feilsls uluvonu4tltoxo3iatlp  lnvs t)seumirpoodlptemnvsls)srumum ot4optn icils s2rm(monu0 rxoircio1faDrlneols sexr(o3iu4om nlfctlsfartmx  nt1tltnmf3tyd m2ulnmsnu0aetoxf3iytlp r i olt0srurxo oodlltemicias sDtmur ;t0olxo iciys s rmumsnu4 exnmo oa1laDelieslt0 euoxr3io1alenlneiat)aDtm(r nt1optniictat s2uanmonu0 etomf oodfa  lu o s0 euriopoy4alte nvilsf Dtmxmooo4oeen ictatfm2rm( snu0 rxnmfciodomtrai sls0 rxmxo nodaleelnvs t) Duaxmo;t0ope miciatls rm(von(0trenif3oo1oate nvi ()srxrio3iu4opeelictlt)sruau pot0altnmoctls s eluvsnt4texoir oytlm rlivi s)s2tm(r oy4ame mnvtl(faDraxroot0tee  fciysfs2ean o;u4tlenxo3ta1omtelu i;t) 2toxm3nydlleelfvslt)sDrr(rooo4tpxnmociysfm rmuvo (0tltoio oytlptr uvi (0texr(o nodlme lnci (fa2rrur ;u0tpenmf3iytfm2eaumo t4aeeomo3iadla  lnesls) 2tmxo iu1optnlfctatfa2rmxro;u0oex ifeiadfa ea(vp u4altrxrciatfm eaues;t t2xr(r3ou4amen nvsls)aDumxr nu0alxo f3tltfs umnmp t) etrxf oa1fpD ai i s  rtoxrpoy4ap nmnesatfs2tm(m ;o4apxo f3iat aDrauvo u)texoxr3iydoa elies;t srtoxo oo4aptnlieslt aDta(r ;u1teeoiieiadlsDrmuvo;t) lenmr iotoatrluei s0teumio nu4lmte fvil( s2tmumoot1opt  f3iysls2um(ms;t0arerio3iatfmD auvo;() exr(opiydop nmietasfsrra(rp;u4tleomi3iysls2umu pnt4aeermociotfat  uvols0srum(r3io1om nmies sfsrtr(ro;t1apenif3tad sDelnvpn(0 rxnmf3oytom rlivi;s)srxo(m nudapt livtltf Drm(mo;u4altnifciyd a2umnmsnu0trxrxr3to1lptrlnvol(0sexm(o ou1ameemnvia(faDurxmo;t0tetnmi3ilsfaDrl(vont0 rermfctotfa  an o t s2xrir3iudomtnlics ()sDum( onu1alenio3ilsfs rl(mo (0 rermr3tydfpDeai o;s0 rtoxo oo4omen net s)aDtm(r ;o1tltnifciytfa eauvpnt4trtomr iotomteli o s0truoxr oodamtnlneilsfs2tru  ;t0tle mo3iasfaDumn o;t0altrxo3iydfmD anei;s s2toxr oydopte ieta( a2umxm nu1aeto o3iatlmDua(vp (0 rtomr3tadfa  ai il(0srtmxrpnu1amee nvtasf Duaxmo;u0tetomictatlaDrauvo t)alxoxo to1op rauvslt)s2tmxo iodllee ieiltfsDraurpou4tetn f3ild aDem(vo;u4treriocoadfmtr ieo (0 etrio3iydll e ivia() 2uru  oo1tpxoiocildls emu p u4 lermr todfptelneo t)seurir nydap e ivi sf rumxrpot0olxoiieiyslaDelumo;u)arxomo oodomte nvo s texrxr3oydoptnlfviat)a2rmu  ;u0alxomfctat s2eluvp u)tetrmrcoatlmDelnvo;() eur(o3iydalenlnvils aDtaxmoou4alt  ietyd m umuvon() ltrmo oydoaD aueo;t srurir ny4ale licsltf rtmxr ot1open fetyd sDumu pn(0 leoir oodomt  iei s)teumimpiudoltelfctlsfaDtm(mp;u0opx iocilsfm umnvp;u) rtrif oatomDrauei;(0 eto(m ou1omtn neias) rumx pnu4ape  oetydfm umnvo (0 lenxr3tydfa eluvilt  rxoiopoodaptemfviat)s2ua(mo;o0oexniocilt sDeauvs;t0 rerxo io1fm rluvil()trtr(o ou4omenmieiatfsrra(  no0opeo octls sDem(vonu)aeerircoodfaDe n ol() etrxo3nu1optn fvsl(f 2urum no4olx mi3tysla el( o;()arxrmocoa1fat livils  rto(r3oo4ope  iei s arrm(  ot1aeeoifetys s2ranvp;t)tltrmoctodomtranvo ( s2xo(o3iu4aptemfeia() Drmxro;o4alx ii3tlt s ran p;()texrxfcoo1fp rlueo s)trxo(mpny1ll   ieil(f rtau o;o0opx  ociysla eluvo u)texnxfctodlmDeaieils0sexrim3iudamt  ncslt)a2umxmpot1opt mfeilt s2emnmpnu4tlxnircio1fp  lu s ()s2xrimpnodlp nmietl()sDrauroou0alxoioeiydla rauvp;u)alenmo3iatfp e ieo;(  rtrxr3oy4lm   fesat)sDrax ont4opt moeiadls2eau s (4arxoxo3iadomDeau s;t)setmxo ou1amt mict () rrrxmo;u1oleo feilslaDelnvo u4treoxrcoatlp   u olt tetr(m ny1amenlnctl() Drauro;u4tlxn o3iyd aDulnvs t4trxnxr todlaDr ivi;t)srxmxmpiy1ol n nvi (fartm(  ou1alto i3iltfsDel(mp ()tltoxrctotlp ean o (0srxr(m ou1olenmfes t)arua( o;u0aexo feiltfa2em(vo;(0 exomr oadomtrlneols setoir3io4omee nctas)arrm( pot1opeo f3tlslsDra( s ()tlxnxfctydlaDr i i t)t2uoxmpnu4lmte nei tfsrtm( p;u1tetomfetydfsDrlnvo;t4trxoxf3tatomte ivi;s0 2xm(mpoudlm n nct sf rtruro;o4texniiciys a elu o;(4 etnmo todfmtrln olt) 2umxrpno4lp   ieias artm(r ou4tex  ietat m2elumsn(0tltnxo oydlmt  ivs;s) rtoxo3nydlm emiesa() Dtau  ou0teenifctadla2em(vs;(4tetnif3todoa raieo s s2toxr3no1opeemiesat) 2ua(ro;t4olxn f3iydfa2el(vp (0tetnxoctatoaD lu i;(0 etmimpoy1ap emneilsfaDtru ont1tle  ictld aDumnvpnu0aetoxocootfatr nvsls) exr(r nu4omtnlfcsl() rtmum ;u0aee ioctasfsDumnmonu)tlxomr3tydfptrln il()teumiopou1oleelfcsa() rta(ro;o4tex  f3iydfa uau p u0tlxoxo iatfaDeli sls)t2xoxopno1lltnlieiasfa2rrx  oo1alxn fctldfm2rlnmo;u0 etnio3oydoa eln sls  2tmirpnudal n ivsltfa2tmu oot0tlto ieiat a2emn o;(4aeenio iatlatrau i;s0s2umxm3ny4llt lictl(  2rm(rpot1tptomf3ias mDul( o;u) lxoir oydomD au sls) eumxmpiy4al e nvta()arumu o;u1tle ii3tytfs2emuvpnu) rtnio iodom rluvi t0 2xr(m oo4omenlncsat) Drrumonu1apx ioeiadlmDrmums;t0alxoirciotfptr nvs ( s2xo(m3iy4amt miet (  Dtrxr ;t1tpxn f3ild m ulnvp;(0artnxr3ia1lpDr ivi t) ruo(m3io4lm nlfes ( srra(r nu1teeomo3iyslsDea(mp u)aeeomrciotlm  lnvo;s  rxm(o iu4amtnmietasf Dtmxrp;u0aet moeiaslaDuanvpnt)aeenxf3to1oatrauvi;( sexoio3iydllee iet s) 2taur no1olen oetlslsDelumon(0artrmf3ty1lateai o;s)sruoxm3io1lmt  fcsls sDta(mp;u4alen oeiat m eaums (0 ltoxfcoytfpD  nvs t  exmxmpny4lleemfei () 2rm( ono1opt  fctltls rln s;t0 ltnir3oa1latran ols0 2xo(rpoudale  ieta() rrr( oou4apxomfeild m um( pnt4tltnircia1fateanei;s  2xo(o3ou1altnlies t)artmu  ;o1oltoifciltlm rmnmsnt0altrir3ta1latran ols  rtrxo iu1apt lics s)s2raxrpot1oexnif3iadfaDuan pnt4aetnmocoadlmtean ilt  2trxm nu1ap n fvilsfsruaumpno0tltomiciltlaDem( pn(4 etrifcio1fpte uvols srtm(m oo1lptemnvsls s2trxm nt1alx mf3iys mDul( p u) rtrmfciatlate i slt0 2ur(r3ny1om nlivil( artmur ;t1openifctydla2rau o u)aexnmo oydlptr ivo (0s2to(rpio4omte feils)a2trurpnu1tet ioeias a2rl( o u4trtrir3tatlp elivol( t2uoxrpiydapenlncilt  2rmur nu4oltoioctyt m uanvsnt4altoif3iadfp eauvi;s  2urxmpiy4ol elivta(  2ua(r ;t4altomf3tysfm ul( o (4 eerxr io1laDe ivo ()t2trir3iydopt  nvsa(  2rm( ooo0tlxo f3tyd m raumo (4teerio ia1la  aiei t  2umxmpou1ap elncsl()s2rr(r ;u1apeo fcilsla rmu p t0aexnxo totfm rli slt texr(mpiy1lmt  ivt (  2taxronu4olenmociytfm2eanvpnt0aexrmf tadlaDe i i ()sexr(mpou4ale  ictltfs2trumpoo0tlt ifetysls ul(vont0 ltoifciatlmDean i t  rxmxm ny4ome  iei s srraxmpnu1aetniiciydlm2um(mpn() eerxf3iotfp r uvol(0setmirpny1op emnetasf rrmx onu4alenmf3iytfm eanvs;u0aetrmrcto1om  lu s;(0setmir3ny1lptemictat aDua( pnu0aee io3iyslsDua(vsn() leoio3ia1optelu i s) exmim3oo4oleelivi t)a2tmx oot4tpeo o3ildfaDuauvp;(4 leoio tydlmDrlueo;t  2toio3nu1ap emfcil(f 2ta(m oo4oexomoeiysfsDeaums;u4arxomo iydlaDranvs;s teumxr3io1amen neiatf 2raur oo1opeomfeias aDua(vpnu)tlermrcia1la  lnvi t srtr(opnudlpt licia( srrmur ;o1tee mictld aDuanms;t4aexnmr3oadfa  anes s  2uo(rpiydom n nvt s  Dtr( pnt0ope mociltls el(vo ()texoioctatopte i sls)srxrxo3ou1ap elnvt (f ruaurpno4oetoiiciatfs2ul( onu) rxrif3oo1opDr nei s srto(r3nu4lp  mncs s s2tau onu1aptoii3iys s2ulu pnu0 etnxrcta1oat li sl(0 2tm(opio4lme  ies (f 2uaxmonu1oee ifciatlmDul( s (4 exomrciatla rluvo;t srtoxr3nudomtnmfci t aDrmxmpno1aleoio3iydfs2raump;()tetnirctodlmD  ieol(  2xmxmpiydomt  fci ()aruaxrono4altniieiytlmDel(mp u4 ltomr ta1fa rau s;s)t2toxm ny4lp  mncta()a2uau pnu0apx iictysla2ul(vp t)tlenmf3ia1omt anesl() 2um(r3io1ll nmicias  Draxmpnt0aex miciyt m2ulump;u4 reomo3iatop e ivo;(0srurxmpio1lp e fei ()a2tr(rpoo1opxomfcildfa el(vo;u4aetoif iodfptelivo t0 2umimpou1al   ncs t aruau pou4oetnif3tat m2ua( p;u) rtoir3oo1fptrai s;(0 ruo(m3io1altemict t arumu  oo0tptnmoetyt m2emuvs ()alxnmrcoa1faDeaies;t)setoxo3iy4amte iet t)sDumx  nt4aeeo o3iltls uaumo;u0 renif3iatlmDrlies s0sexmio3iodlltelieia(fsrrr(mp;o4apxo f3iytlaDelnmo t) lxnmf3oydop raivi;t) 2um(rpiodol emnct sf Drm( o;u4aptnmf3tas aDul( p;u)aetomf iytlp  lneilt)trtm(o3no1ol nmfeiltfsrtrx  oo1oltoiiciytfmDulumon()alerxr io1lm  luvs (0srtoim oo1omtn net t) rtmx  ;u0tleo iciaslmDemn o;u)texnxf iytlaD aivi s0tetoxr3ny4lleelfeia()s2raumpou0tpt mieiad mDumumsnt) etnmo ia1fm   nvi (  rtoxmpio4omt livia()s2tmx onu4tee if3tydls2rl(mo;u0teenio tadlpte neils0setr(rpoodape mfetat) 2uax oot0olxoiietat a rl( s;t)artnxocty1faD  nvo t  eumio3ou4omeelnesat) rururpnt0olxn iciltfs2eanvs;(4artnmo3oatfmt auvi;s0 2trirpno1lmt  ivia( srta(mpot4alxnmf3iltlm2rau pnu4 leoio3oy1oa raueols  etrimpoy4lle livi tf 2raurpot0tltoiieildlmDemn onu0texrxrciydlpDeln il(0 ruoxo3nu1lme  ivtls) 2tmx  oo0alxo octysfa2ua(mo;() rerio to1lm rlueilt sexm(r3iy4apt mnetls a2rmurp;t4texoifeiyt m rm(vont)tlxnircta1oaDrlneo;t s2ur(mpnu1ap nlnet s)artrxm no0tet mi3tlt mDua(mo;u) eeomf3tadfpDr uvs;s0 2xmxm nydomteliviasfa2taxm oo0apxo fctadfm2uln s u0tetoxo3oa1lmt  neo;t0sexr(mpiydomtn nvt t arrm(ronu0oltn ieilt a2eauvsnt4 rerir iytlmtrlu sls) etm(r iy4lmte nci tf Dtaxroou0oleo i3tlt m2rl(mo u0alerxocia1oaDrlivs;(0texmimpny1lm e icsls  Duaxrono1apxnio3iadlmDuln p;t4 eenxf ta1faD au ol()s2uoiopou4omtn ivt s)arrm(mp;u1aee  fciydfm2umnmo;t4trtoifcoatfpD au olt) etr(rpoy1lleemncs ()sDtm(rooo4oex mfetytls elu onu4trtrmfciotoaDr i o;s srxrxo3iudlltnmfvtat  rtr(mo;u4oeeomocilsfaDea(vs (4tltrxo3iydomD li i;t0 euoxm3nudale  fvsa(fsDtrx  ot4aetomf3tls mDel(ms u) lxoxf3todop r nei;t t2umxopiy1apt lfes t  2raum ;t1oleomoeiaslm2uln p t) ltnxr oy1lmt lnvsls tetmxm iy1ll  lfcilt sDrax ooo4tpxomfeiytfsDuauvo;t4trtnmfcto1opteauvi ( tetmxo io4lpeelicsa()s2urxmono4aetniieiad aDeau p;(4aexomf oy1lpDrlivo t) euoxmpoo1llen nci ()a2rrx  no1tlenmoctad sDuanmo (0 lenio ootom  aies (  ruoiopiudal nmfet t)a2rru oou0oltnmf3tys aDelnvo (0tlxoxr totfaD anvi (  rxmir3oy1om e iesls srua(rpoo1opx  i3tytfm rl(ms u)alxomr3oytop raies () 2uoxr3oydlltelfciltfsDrrxrpnt4texn f3ildfs rlnmon()altnir io1fatrauvo;t srxmxrpiydomenlivsls arrm(  oo0oltoifctls s2ran o;t0aexnmocoy1fa   nes;t  2xm(rpoo1lpenlncilsf 2raxro;u0altomoetydfa2umums ()tlxomoctytopDr nvi t s2xoimpoo1olte nviat)s2tr(m ;o1opeomociyt mDrl( o;u4alenxfciadfm   ivo t0 exr(rpnydame mfcs ()sDtm(rpoo0opxn fciltfa ra( pnu4 eerxfcio1fptrli ols0trxrio3iodolt  feilsfarrr(  nt4opxn fetytfmDrlumon()teenio oytfptrlivo t srxmimpiy4openmncs ()a2taxr ;o0tlt mictldfsDuluvs;(4 ltrio3to1fatr uvolt  2umio io4apt  ict (faDrr(rpot1alen o3tltfm eau p;(4tltomo3iy1la r uvolt0t2xmim3nodamt  fvtlsfarraxmpno1oltomf3iatfs2umn p u4artnmocty1optraiei;t) exo(r3iy1ol nmivsasfartmxr ;u0olxomicildfsDuauvon(4aetnmf3iatfaDrau s;s0texoim3oydam  lfesa(fsDum(m ;u1tptomi3ias a2emuvo;(4texomf ty1op r nvi;t)tetmim3iydop elici (fa2tmum ot0altn feiasla ulnmont4altrmrcia1omDeauvi;t)teuoim oodlmtn ieil()a2taur ;u1tetomi3ias sDrmuvpn()aetrir oy1laDrauei;s)t2xrxm nu4olt mnei s sDumum oo1oltniieiadlmDulnmo;u0texomr oydfa  anvilt s2xm(o ny4oltnlivsat s2rm(root4aexn ieiadla ulnmp u0aetrxo oatopt anvolt0t2xrxo3io1olenmncsatf Dta(  nt4ope miciaslm2elu o;t) exrmociatlpDeaueo t)sexo(o3iu1amt lnctlt)srumu pnt4aptomoeiatlsDrmnvo;(0tlxomf oytlateli o;s0trto(opno1opt lnesat sDrmxmont4apt mfctldlaDraumonu4trtrmfcoatlmtr ies;t sexoir oodop   ivias) 2raxronu4apto oeildlaDrmuvo (0aeenmo oydomteaivs;s)s2xoio3iodam   nesltfaDra(m no0aleoiicils m rmn o (0tetomfctotfptelivs;( teumio nydol nmfcsat aDtaxr ou4tlto oeiyt a2uaums t)trxrxo oy1optelu ilt truo(mpnu4op emfctl( sDum(r ;t1aex ii3ilt sDem( s;(4teenmf tadfateanes;t0trxrim oudal  liciat)aDrrurpoo0tlx  oeildlm rmumo (4 rtomf ootfmt ln i;t0setm(o iodolt  fet tf Draxroou1aeeomo3iatlaDrl( o t)trxnmo oo1opD anvo;s) rurim oydoltnmivsas a2tmurp;t4oeen i3tltfs2rm(mo t4 rxrif3oydfatrlnvi s truoirpio1lme mfesat a2ur( pno0apenmoeiys mDemuvs;u0texnxrcto1fm rlu olt0t2xmim iu4am  lfesas)srtmuro;o1tpenio3ildla ul( pn(4 lenmrcta1op e u i s)t2trio oudlp   iesa( a2ra(m ot0tptomfciatlmDemn p t)aetrxo oytlpD  ueol( srurir3no1ap n icta( aDtaumont4altn oeildfs ulnvon() etoif oatoa elueo;s  rtr(rpoydape mnctl() 2rau  nu1opxnmocias s2rlnmp;u0aexrxf iydlm r n o t)s2uoxo3iu1amtn nci t) rtaum nt4opt ioctld aDrlumpn()tltnmr3tatopteaneo;(0 etoirpiudlmeemivi sfs2ta(mpno1tlxn o3tltlaDumnvpn(4alenmf3totlmD ln i s0s2urxrpno1amt lfet sf rra( pno4tet  ociysls umu p;u) eerxf iydfaD lueo () 2urxm iu1lmenlfetls  Dtru pno0tptn oeild m2eanmsn(4teenmocio1op  ai i s0trxm(mpoudapeemivslt srrmxmpou0tpeoio3tydlaDrl( onu4arxnif3oo1om eliei;s0srurxo oudop n nvia( arraxr no4aeenmociltlmDel( s;u0teerxocio1lp eaueo t srtr(m no4amtn fvilt srumx  oo0tltoio3tydfaDrlu s;t4tltomf3oodfa rlu s ()srum(r oo1ope  fci (  rtrx ono0tpxoio3ils aDran p;t4arxnif3ty1la  aies t0 2tr(opnodlm nlfvt t) Dur(rpot1aexoio3iasla emnvp t4aleoircto1fpDranvi s)teumio3oo4lleemnvs tf 2tr(rooo4aexnmfcilslm rlnvo;t)altnio oytomD aiei;t0setrim iu1ll   nvi sfsrraur ;u0tpenmociysfs ran s;(4alenif iy1lmte neo t setmim iu4lm  lfeiltfa2rrxr ;t4alxoioeiasfs2umnvp u0altoxf3iy1lpt  nesls  2tr(r io1ape  nct tfs2taumpnu1apeo iciad sDelu o ()altoif3iytfa rlueols)srxo(mpio4lmt  fet (  Drru poo4altomicilt m2em(mont)altoxf3iotfatr iei ( s2umxm3ou1opt mfvias) 2umum ;t4tpt  ocilsfs el(vs u4alxnxo3oo1fpte ueils0s2uo(rpoodoptelicil()arurur ot4oet  ociat s umnmp;u0 rxriocia1laDeluvi;s teuoxr oo4altelnct t  2ta( o;o4texn f3iyt mDem( o ()artomo tadlat  uvs t0t2urim3oy1lpte fviat  Dumur ;u0tpe  feiadla rmumon(4teermr iydlp   uei;(0 eumxo oydopte ietlt a2rauro;u0optniocias s eluvs;t0 rxnio3iydfm  aivi (0s2tmim iodamtnlnvtat arrmx pou4tlx iocildlmDemump u4trerxf3ia1fpte ues;s0 ruo(m nudom nlfci ()sDur( onu0tetnii3ilsfsDemnvon(4 lenifcoadfptrln i;s0 eum(o3oo4ll  lfct (  Duaxr nt1tltomi3iasfaDrl(vp t) etnmr tatla  lnes ()t2xo(m3nudlmen feils) 2tru oou4texomociasfsDrm( o;u) lxoirciytoateanvs;t) exr(mpny1amenmnet t) 2rrx pot1ale ii3iys mDemnmsn(0aexoxf3to1om elnvil(0s2uoxm nodope mneias aDtr(r ;t1teeo f3tytfm2rm( o;() rtnio3ootomDeau slt s2urxr3oy1optemfct s sDuru p;o1oetnmietltfsDelumo u) rtoir3oa1omteliesls  rxr(r3oo1lpee ieiat aDuaurpno1alxoioeiysfs2eau p t) rxomr3ia1opt  u s t t2tr(rpoodol eliviat)arurx  ou4tex  ictadlmDemu snt0 ltomociydoat au i s0trxoirpno1apeelietasfaDta(rpot4oleoif3iys aDelnvonu4 eeomf tytlaD  ivi;t  2xoxr3iodap nlnet (faruaurooo0tpt  oeilt m el(mpnt4 etoxf oadlp rlnvo;s0seumxr io1optn neta(  Drm( pnu1tetn feildfaDua(vs (4alxnxf tytoa r i i;t)texr(m iy1lpt mfeils)a2tr(m ;t1tex  f3iasfa2ra( o;t0aexomo io1omDrauvsls texm(opnydlpe liviltfs2raumpoo0apenio3iat m2um( sn(0 ltrmo3iytla elnvolt  eumxr3ou4altnmnviat)artruro;u4apeoio3iad sDuanvonu0aetrxfcia1lat  u i;t t2trim3iy1omenlnvslsfs2rr( p;u0aleoifetydlaDuluvp t0trxnxf tydfpt livo;( trxo(r iodole mnci s)a2umu oot1tpeniieiasfa umums;t0trermociy1fmt  iei s)trto(m oo4lm emfvslsfsDtru ont4opxoioetld sDum(mo;t0 eeomo iydlmtrlnvils  ruoirpiodal nlieslsfaDrau p;t0tptoiictyt sDranvo t0 lenir io1oa eluvs ( trxo(o3iudlm n nvtltfarua(r no0apxn fciysfmDran pn(4 rtomf3oy1fmte ivo;t  rur(m3ny1lpt lnei t) rtaxro;o1opxn fciltlm umuvsnu) exomo iotomtraivsl()trtmxr nydlm  lnvi ( s2rmxro;t1tpeoioctld a el(vp t)aetrir totoat auei (0srxoxopiu4alenlfes sfs2rm(mpot4optoiociltls eln s u4aetomf to1fat  neo;t0srtrxopou1aptemfetas srumu pou0tex moctatls2raumonu)tetnir tatomDraivi s)s2uo(opoudop elivias)srur(r oo1opx moetydfa uanvp (0 eerxfcoodom eln i;s teto(opny1op  lfesls)s2rmumooo4aexn f3ilt s uln o;t)alxoxo3oa1fmDr ueols trum(rpio1lmt mivs (fsDrrx o;u4tpxnmieias sDem( onu0trerxf3iadfp rln o t0tetoim3nydlm   fvtatf Dtm(mpou4aet io3tyd s um(vs;() rxoio3oo1lpDraueo;t trxoirpiy4opt  fvilsfa2tm(rp;t4teenmoeiad m umn p;()teeoxrcoydoatrluvolt0 rur(o ou4lmenlicsas)a2truro;t4alxomieiadfm emumo t4altnio3ia1lp e nei;t0 2toxopnydol  mfctas arurxrpno1aee ifeiaslmDul(vpnu0trtoxf3oydfa  ai slt0trtoxo nudopt mfci t sDuaxmp;t0tpx  ieils m uanmp;u4 exoir3tadlpD lieo t0texmir3oudol n ictlt)sDrrx poo1tleomictyt m2rmuvo () exrmocoy1lmtr uvo s s2xoxmpny4altemnct t a2ur(mono0teto i3iyd s2emuvs t)aleoif oodomteluvo (  rto(o3nudap   iesat s2rmur nu0tlx  feiyd s2uan s;(0 etnxociytlm r u o ( srtmxo3nu1opee fcta(fsDraxrp;o1olxo f3iltlm2emuvo u4altnio3tadop r n s;t  2xoxr3iydaltnmfctls)s2rrx pnu0olt mocildla2emu o (4teerio ty1opD anvi;t0 rumirpoy4amenlfes t  2trx ont1altomictldlmDumnvpnu0aexoifciotoa  lnes;t0srxrxr3nudlm n nvta(fs2umu poo0oexomicilsfm rlnvon()tlenmf3oatfpte nvolt0t2triopoy1ame  ietas) Dtaxrpoo1aleo feiyt m elnvo;t)altoif io1fp  lieo t srxoiopoudlmenlnvt sfartax  ;o1tpt moeiasfm2umuvs;t0aetomr ia1omD an o;s  rtmim ny1lmtnmnciasfarumu p;o4apxn ietls sDel(ms;u4 ltoxfcoydla  auvi t0t2xmxmpio1al nlfetlsf ruaum nt4oltnmociyslsDeanmp u) exnmrcia1lptrlivs;(0s2xoio3io4optn fvi (  Dua(r ot0oex mfeiysls ra(vo t) lermf tadlate n o ( srtoxm io1lp e icta(fsruaxront0tpeo f3iytlm raump (0tetomo todlm e ivslt0 2tmxrpio1lmt mfctlt  2raxm ;u1aeenmo3ildfa ranmo t0areoxfcoatom eanvo ()seto(r3nu1aptnlnvtatfa2um(m oo0apeoioetls a rm(vs;()texriocoadomD aivs;t t2uo(r3ny1lp emncsa()a2uru o;u1aeeo ociaslaDrlnvsnt0texnio tadoa rlnvols)sexmxrpio4om  lfvs (fs2rm( pnt0tpt ifctasla2ua(vpnt)teermr ta1fmDeauvols  rtm(opoy1opt lieiat)s2trxrpnu1alenmf3ils sDulnmp u0tleomf3iotomDr u o (0srtrxopiy1alt lnet s)srta(mpnu0aexomieiyslmDumnvp;t0aeenio iydomtrai s;s)s2uo(r3oydole mnvtlt) Dumxr ou4oex ifctldla eau on(0trtoxo oa1fp eln i s0sexo(o nodlltn ict (  2trxmpot0opeomiciydlm2eaumo (4artnxfciotoat  nes;s trtoimpou1lp emivta(  2uaurpnu0oeenii3iyd a2emums (4texomf3to1oaDrlu sl() rtoxo iu1ll emfct ( sDraxmo;o4aeen f3iadlaDemump;t4alxnmo io1oa elies;s t2xmir nudalen ncsasfsrtaumpoo1olto feiatfmDea(von(4alxoxo tatfpDe n o () 2tm(rpno4omee ivsa() rtmumpnt1texnmf3ils m2rmumo u4 lxrmrctotlm   ieo ()t2urxrpoodomtelivil( sDtmu  ;u0alxo oeildls el(vp () rxomr3iotopD  i s s) exmio ny1opeemnetls)sDururpno0oetnmfetyt mDemu pn(4 lxrif3iydfp  livs t) rxoiopno1olen fcsl( srrmxmpno0oexoifeiad s2eau p t0 etrmf3ta1fmt luei s0s2urxo no1op elfcs t)s2tm(r ot1teeniictltla umnmo () lxomf3oytlpt anvo s s2xoimpio4al   fetl(f 2tmur oo0tpeo ictld a2ra( snt4 lxoxfcoy1fpDrluvil(0trum(rpnudapt mnvs sfs2ra(r ou4altn fcilslm2elnvp (4tleomo tadlpDrln ols) 2xoxr oo1lmeemfcta( arrm(rp;t0olt  feiasfaDra(vo t0 rxnmo3tydoatrlueo;t0srto(rpoo4lpt lfei s) rtaur oo4tpe iietytfa rmu p;u4alxrmoctatfaDrlueo;s0s2uo(o3oodlp emnct s)srtr(m ot4tpeo f3iydla rluvo;(4 rxnmoctytfa r i ils)s2xmxo ou4ope mfctas) Dtmx pnu4aex ioctldlsDuanmo t0aeeoxrctydoatr i i (  2xoxm no1lme mivtls  Dta(mpnt4tlt  iciysfm rl(vonu)teenif iodlp e nvs t0truoxrpiodoptnmies t  rra(rpnu0tpxnmf3iyd m2elu pnt)trxnxocoadla eaieslt)s2uoiopny1optelfcsat) 2tmurpoo4olxoiicilt m2rlu p;u0 lxrir3oydfa  anvsls0t2xoxopiydam nlivs sfaruru ono4tleniiciysls2umnvo;u)tlerxf tytfa e nei t  2toxr iudlltnmnvt t  rrmu pou0oexnmf3iytlmDeluvp t0 exomf oytop   nvo;()trum(o3ny4ol  mneias  rururp;o0oltn ictytlm2uan s (0 rxrif oadlaDe nvil( trum(o3oy1ol emncsls  rrr(  ;t4tptniieiyd m ulumo;u) eerif todlp raueo;(  rxrim iodome micsl(faDraum ot4altnmi3iatlaDrlnvsnu)aeenxr oadfaD  i s;s0t2toxmpiy4omtelnvsa( sDtmu oot4oexo o3iydlaDeau s u0 rtnxrctydlp eauvil( trur(rpou1omte fcsatf Dur( p;u4apxn i3iasfs2raumsn(4trerxf tatopD an slt sexr(r nodll nmfcsl()aDtmxmpot1olen feilslm ulnvo t4teerxf3oytfm  lieils0s2toio3nydome mivtltfa2ta(r nu0tptnmieildfmDum( p (0 rxnmfctatlptranvilt)s2ur(r3nu1om nlfctatf Duaxrpot0tltomieilslaDrm( pnu0tlxoxf todomDe i s;(0s2um(r3iy4lme lfetls  Dtr(mp;o0altomfetadls2uan snt0trxoif todfpteanvi;s0t2xmxmpny4amenlfvil(fa2rru oot4tlxn oeiys sDranvsnt4trtoif iy1lp   n s;()t2xoim3oo1ll nmnci tfsrrrxr no4oeenmfctlsfm eauvsnt0treoxrcoydfpD  nes;s  2xoimpoy1lltemfvsas)a2rrxmont4tpeomoeiatla elu p t4tltrir iotlaDrlivilt t2umim no1lm nlictas)aruaumpno1apeoii3iatla2rlu pnu0artnio3tatlptr n ils sexrxo3no1amenmiei sf rum( onu1tpxomi3tat aDrlnmp () ltrircoodop   n s;( sruo(r3iu4lp  mfet ()s2urum ;o0teeniocilsfm elump t4arxnxr tatlmtrli olt) 2to(m ny4ap  lics s)s2trxmpoo4oexnmf3ias aDem(ms;u4aexomo3iy1lp   n ols srumio3ou4lme mivslt sDtaxmpnu1teen oeias m el(msnu0 rxrir3ty1lmD  uvslt)seurxo nudopeelnvtas) 2ra(mpnt1opxnmi3tltfa2uaumsnt4 eenmo3tytfa rli o;s)seumir3iudll emnct (  2rmx  ot1tleoio3iatfa em(vp;t4 lxomfcoa1lm raues s)t2xmxrpiodape lfeia()s2raxr ;o0teen o3ildlaDeanmon(4tleoxr3oadlaDrlies;s seuoim oo4ol   icil()sDta(m nu0optnif3iadla elump u4tetnxocto1faD luvo t tetr(mpoy4lltelieils  Drm(rp;o0tlto feiadfaDrmn onu) etomo iytlmtelu ils)trur(opoo1lptemfcslt)a2tru  ou0olx io3ils s emu p;()alxomfcoy1laDr ues;(0 rxmxmpny1om   fvtas s2umurpnu4alxo octyt a2emnvont)alxoxr oy1lpt ln slt)teur(mpoo4amt  ieiat)sDtrxmonu0apto feiytfs2ea(vs u4 eerir3oydlm r ues;( t2tmxo nydap  livslt)a2taxrpnu4aex mfciydfm umums;t4texnmr3tatlp rluvo;( srtmxrpiydlmte fvsl()aDtr(r nt1apt mfciysfm elu p;(4 rtoxo3oodopDr nes s0teuoio ou4llt mfvtat srtau ono4olxnmfctysla ulnmo;u4trxnmocta1fpDrln il()texo(mpoy1olt liesatfs2rmu pno1teeoifetatfa el( snu4artnxfciodfatranei;t t2xm(mpoydam nlivs (f Duaxrpou1alto feias sDrl(vo (4 etoxrcoa1lpDrlivs t0srur(m ny4lpenlfcils aDur(mpnu0optoiieildfa rl(mo t0tlxrmoctatlatran ilt srxmxr3oo1omtemictltfa2ra( p;t0olt mfetldfm elumsnu) lerxrctadopD aueolt)srtrxr3oodolenlfetl()srta( p;u1opxnifeiasfm ul(vp t0arxrir3tytoat livilt) 2xoxmpnu1amtemiviatf 2um(rp;u4tpe  i3ilt a2uln o t4arerio oydoa  li i;()t2uo(m ny1aptnmictltfa2ta(  nu1aex  feiadlmDrm(vs u4 exnxo iotfatrlivo t)trtoxo3iu1am   nvilt a2ur(  ou0apx mo3iltla rlnmp u4 lerxf oydfm   neo ()teur(r iodamen feslt srraum no1apxoioeiltlmDrln ont4 etrifcoytoa e ivilt trtm(r3nodoltemfviasfaDra(rp;t1tle  feiysls2ranmp;(4alerio todfpteli il()trur(r3oo4lmt lnvta(f 2trumpnt1oexnio3tltls rl( p t4artnir3iatfp eaues;t)sexoxmpnu4lm elietltf 2umum nu1oetoifeias a rlu pnt4aexnifcootfaDeai i (0 rtmio3nu4opt mnct t)a2taumooo4tetoii3tas a ra(mp ()tlerio3oatom  anvo t0seuoirpoydom emivtls arrr( pnu4tpx ioeiad m rlnvpnt)tleoxo3tytop e u s;s0s2to(o iu1om e feilsfs2trxrpot1tptn feiadfs rmumo u4teenmf3iadfmDr ivs t)s2xmirpnydape miei sfsDrrx ooo0alen octasls2rmu o t0trtrir3iadfmD lues;t0seurxo ny1altemfvi () 2rmxr ot4tle  oeiasfs el( s (4texnmf oadoaD aues;s0 2trim3io4lleemivtat)srurxmp;t4tpt ifctasfs2rl(vont4alxnmociydopt an s;()trxo(rpiodll nlfvi s)arrmu p;t4optnmfctas s em(vs;u) rtrxr3ia1fmDeai o (  rumxm io1omte fci (  Dta(r ;o0opxn iciaslm2raumsnt4 lermr3ootfpteaies;()srtmxmpny1ap n ivt t aDum(mpnt1aeeoio3tlsfs ea( sn(4altrxrcootomDelivo (0setr(opno4opee nvsat  Dtmxmpnu4aetnmoeiyt s2rl( p (4tlxrxo3ta1lptr uvi;t)t2uoir oydopenmfci sf 2trxmpot0opxo ieiasfm2elums u4teeoifcoydfa r neo t  rtr(o3iu4ope  nvsa()aDua( o;u4tee ifcias s rlnvonu) exoxrcootlptrauei t  rtmxrpou1ap e ivtas  ruau ont0oex if3ildlm2ranvp t4tltoxf3oa1lm eluvil()srtrxr3oudll e ictatfaDumu pno0olto f3ilsfs2uanvsnt4 reoxo ootoatelieo (  rxrim iydolen icsl() 2raxr oo1aee mi3iaslmDrmnmonu) rxnio tytopt lu s s0texr(rpoy4ole  fci (f 2um( p;o0ole iieiltfa2emuvo t0 rerircoy1fmD aues s)trtoxo no4ole mfciat)sDrmumont0opx mi3tasfsDranvp;u)aleoio oodfa raivsl(0t2uoxrpoy1altn nvsls  2umxr nu4opx  i3iyt a2ua(mo;t0tltoxr3to1opteau i s  rxmxmpny4altemivtls) 2um(r ;t4optoii3tasfa2ul(mont0tltoxo3ty1oaDrai ol(  rxrxrpny4ape  fctlsfsrtrxmp;u4optnioctlt a2em(vsnt)aeeoircio1omD li s;s0 2umxm nydamenlfeilt  rrruro;t4aptn octldfm rlumo u)trerxf3ta1lateaieol() eum(o iu1lp n nesl( aDraump;o0aptomo3iat m emn s u4aetnmo3oytfm  aueo (0s2to(mpoydapenmfvt tf Dtr(rpoo0oltniieiysfa umu s ()tltrmo oy1fmteauvsls  2xr(r oy1op nlfvtat) 2raxr nt4opx mociadfaDrau o ()arerir tydlpDeauvo;t) rxmxm io4lm  mncia() rurxr nt0aleomoetyd mDra( pnu4tltomf tydoa eluvs;()t2urim3nudamt mics s)sDtru o;o1altn oeilt s2uau p ()aetoxo3iy1omtr ivi t  rtoxm3iu1al  mnvi sfa2umx p;t1olt  icildls2rluvont) etnmf3tatfp r n i;(0srxoxo3iy4am elncta(faDtmur ou0ope ioetysfs ua( p t)altnmr ootlpt  nei t) 2xrxr3iudapt lietas  rrm(mo;u0olx  ieiasls umnms u4 rxnmo3tydfpt li s t) rxm(r io4omtn fct s) 2uauro;u4oexn feiytla2eaums;t0 rtrmocoo1fa r uvo s)seumir3io1apt lict t a2tax o;u0ope  feiltfa2ranvp;t) etnmo ia1latr ivo ( trxoio3no4am e ieil() 2tmu p;t1tpen fcild mDumnvo;t) lxnxoctatoat aieo;s trur(o3iu4oltelict tfartrumpnt0texniicilslsDeaumpn(0arenxrctatfaDelieol(0 rxrxr ny4ap  mnvt ()s2urur ou0texniiciytlaDemu s;t4 leoxf iy1laDraneo;(0setmirpiydome mivta()sDtm(m ;t0oexo octlsla2rmuvpnu4texnmoctotom   uvi;s)sexm(rpoo4lltnmfvi (  2tmxm ot4oetoifciad s2rlnvont0texnxr3oa1fate u o (  2um(rpiu1amt lietat s2uax pno0alxnifciydlm emumonu0artrmr3tato
\ No newline at end of file
@@ -0,0 +1 @@
+nei s0tetr(r ny1ll emfeil(f rrmxm ;t0aexnii3tysls eanvs (0artnmo3totlat auvi s  rtmirpiy4lptelicsa( aDtmxront1apx mi3tadlsDrmu s u0aeeoif tadlp rluvilt0 2to(o oodal  miet tfa2umxm nt0texo ieils aDemn o (0aexomo tatfpD auei;t  rtrio ou1amen nct () 2ta(m oo4oltnmoeiysfa2ul( o t0arenmo3io1lmDr u i;( t2xm(r iodllen fesls srraxmpno4aetomocias m2ul(mpnu0 eenir3oo1fmtranvs;t trurxr3io4amtn nci ( sDrmur ;t0teeoio3iytlaDrauvo;t0trenxr3iatop raivo s0srxrim3iy1alt  ietls sDtaxm oo0altnmf3iad mDumuvs;t)aexnio todfa eaivi;t)trumimpoy4lltn fetas sDtaum ou1tle mf3iltfaDuaump;t) lxnir3ia1lpte i i t trtmiopny4ol e nviatf Dua(mooo4tleomfeiaslaDrlu p;t)tltnmr oytfm  aues () 2tmim oy1am   netlsf 2trum oo0tpxniieiasla2emnms ()tltnir3iytlp eaivo s  rxoxm3iy4apenlnvsl(fa2ra(r ot4tlenmf3ildlm2rau o (0aetoif3oodfptrluvs (0teur(o3iydopeelivsl(fsrtrum ;t0oeeoifeild s2emums u4 exriocoadlmDraiesls)t2urxmpou1ol nmfet () 2rmxr ;t1oet  ieildfsDel(mon()trxrmf3tatfpt  ieo;t0 2um(o oo1lleelici t) 2rm(  ;t4tle mo3tysfs2rlu s;t) rermr3tadlpD  uvs s0texrxm iydlptelfvi t a2ur(r ;u4texo i3ildfaDum( onu0teermf3io1omtranei;()trtmxmpno4alee fvt s) 2um(moot4tlx if3iytfaDuanmo u)aetomf oo1fmt  n ilt) rxo(r3iydlle mnvsls artrx  no0ope  f3ild aDeluvs;t4 eeoxr3iatfpteaivsls setoir3oudopt lici (fsDrr( oot1oeen oeiad a umn s;t4tlxrmf3oy1fmt  uvils t2umiopiu4ll emfesas artrxrono0teto oeiadlm umnvon(0 ltoxf oy1lpDelnvil( texrxr no1op nlivilt s2trxmono0texnii3iasfm2ul(msnu0 lenxrcia1lmD  u i t)trtrxm nu1al elnvia( aDtrur ot1olxn fctytlm2umn o;t0altrio iytfa rau ils0t2trxm3oodomt mivias  2ur(mpnu1olx  i3tat a rau o;t) exnxo oydfmD luvs s  rum(opiydomtnlivi t)aDraxrpou1aee moeiltlmDua( s (4artnxf iodfptr neslt0trxoxm iudam emfvs (f Dur(moot1ale miciysla2eanvpnt0 rerxoctydfpDeaneil( s2ur(rpno1olee nvils  2rrum ou1tltnmoeiaslm ra( p u4aeeoio3tadfaDr u o;s0trtrir3iydamtn ietas  Dtaxrpno4alt  octytla2rlums t) etoioctotlatrlues;s s2xrxopiu1omt miesat) rtrur ou0ape io3tlsfm2el( p;u4treoircio1fa r ieils  2xm(r ny1ope mnvi ()sDta(m ;u0oltn f3iadla rl( pn()trtrif iadopD ln ils  2xmxm oudomenlfcias) rtr(rp;o0olxniociasla2ua(vs;(0 exrir oadfaDe nvo;(0t2uriopoy1ap emncsl(  rtr(m oo0apen o3iydla el(mo;(4tlxnxr iodfmteau o;( sexoxrpny1aptnmfvsltfartmxmpou0aexn o3ilsfa um( onu0arermrciatfaD auei s)s2xmxmpoodop n ivs sf rrax  ot1olx mf3ildla2ulumonu) lxrxr3oa1laDe ueo t0tetrxm oy4ap nlnctat s2rrxmoou0ale  f3ildfsDuln snu4 ltrif tytlaDr n i;t0seurxo nodam nmfeia(fsDrmuront1apxomi3iys mDelumo;(0altrxo3iatfmt luvsls0 2xoxm3oodop  livils s2tau p;u0aptniocilslm2ea(mp u)trenif3tatlptraues s  rtoim3io1amte ics s  Drrxm nu0oexnioetysla2uluvo (4trerxr iatoaDrln i s truo(mpoy4omt  fviatfaDtrxrpou0teenmfctydfs2ranvp;t) lerioctotopt aueo ()truoio3io1oleelics sfsrtmxm ot0alxn fctyd m elnmo;u4trxrxo ia1lptr ies ()srtrir iodamee fvils  ruauroot0olxo fetatlsDuanms;u) exrmociatfmtr ueils) exm(r ou4lpeelncils aDumxm nu0oltomiciad mDrm( snt4tlxomr iytomDrli ols  eumxopnu1optnlfvi t arta( pnt0tptoifeiaslm emnmsn(0aexnif io1laD an s (0t2tmxo ny1lpee fvsl()a2um(m no1tet mietyd mDem(vsnt4tltomf iatoate uvi;s0setoio nydllee nciatf rumurpot4tle  f3iydlaDumuvont) exoxfctodom r ueo t0trxrxr iodlltn nesasf Duaurpou0aeto oeildls2ul(mo;u0trenmo oo1lp rluvi s0trxoir3ny1optn ivs t)a2taxmo;o0openmieild m2ul( p;u4tleoxr iodlmDeai s s t2xr(o iodlle mfvtlt)s2rmx onu1ale mi3ilsls rau o () lxrmfcootfm  au o;()seto(m oudll emics (faDuax  nt0olxomfeiatfsDul(mo ()trtnmo oo1oaD lneils setrim3ny4lleemfct ()aDrm(  ;u4oexn iciatlm2ua(mo ()texnif3oodoaDe neilt0srxr(m3ou1ap emfetl()a2rrxrpno4aex mociyt a2rmu s u4trxrxr tadfa eluvils0texm(m3iu1amtnlneias)aDtaxmont4oexnmictyd m2umnmpnu4 eenmo oadfm   n s s srxo(opnu1ll e ics t)sDua(r no4aptniietadla2emumo ()trxniocoytoa r i s s0 2xoirpnodlmee nct s aDtmump;o4tet  i3tlt a2um(vp t4arxnxr3ootlp rau i s0setrxm3nudll nmncsltfaDrrurono4tlxn fetatlsDranvs (0 eerxf3oadfaDe uvo s)sruoimpiy1ol nmicsasfa2tmx p;t0oltnmo3ilslm2uaums t4 lxnmo3oo1fa  aueslt0 rtoio nydomen fcs sfaDrau o;u4oetniieildlmDeauvo;t)trtoxfctotlmDelnes t)t2xrxo iudal  licia()a2trxm ;u1oltoiiciatfm2ra(vp;u0tlxoxo3ta1omDe uvi t)s2uo(mpiy4lpeemfct t  2rmum no0aetniieiytfm2el(mp;(0aetoir3oydlmD luvs;s trxo(m iy1apenlieilt)s2rr(r ;t0texn fciltfaDraumsnt4tlenxocio1lmte ies;s s2trir oydopenmnetlt) rrmu pou1tet mfciasls2umu s (0areoxo3ta1faDraiesls)srxo(rpoo1oltelictas arrrx o;o1opeoioeiad sDem(mpnu0alenxo oa1fp  aueilt) 2xoio3io1lltelivta(faDtrum nu1tltoio3tatfaDel( pnt0trxrif3iydlmDean s s tetm(opny1op elncil(fsrua(ro;o4oee  f3ild s ul(mo t0 etnxf ia1oaD  n s s sexo(rpnudamenlicsltfa2um(m oo0oetnioetasfm raums () lxoxr totfa   n ils truo(m oudoleemnvt tf Dtrx  no4oeeomociyslsDua( s;u0arerxrciydfat luvo s)trxmxr nodlmt mictl(fsDur( p;u1ape iieiydfa2um(mo (0 lerxfcoa1laDrauei;s)truoim iudolt  fcta( sDrr(rooo4optoiietasla2uluvpnt)tetrxrciytopteaies () 2xrxrpnodlpte fes sfs2tau pot1oee io3iltla2uau s;t4aetnxo to1lpDraieslt0t2umxo iu4ome lfvilt)sDuru poo0alxoii3iyt a um(mp;()artrxo3iodomt  u s t srum(opno4lmeemfes tf Dra( ont0alxn ocilsla2rmumpnt)teenxocoo1lm rlu sls s2ur(o3nydome lfct t)a2umur nu4altomiciytfa2uaump t) ltnio3oydfm  aueo (0 eurxo3oy1lle lietat)aDrmxmpoo0ope  o3iatlaDrmu p t0aleoir3iatom r u o (0s2xm(opiydolenlietl() 2rrum ot0oeeoio3ilslaDul(vp (4tleoioctotfa  aivi s s2tm(o3ny1olee nvi t  rta(rp;o0tpeomf3iatfs rmumon(0 leoir iy1omtranvs (0t2ur(rpiodolt lneslt)aDrmx poo0opt iieiat s2ulums;t) lxnif3io1lmt au s;t)s2umir io1lmte ncils)srtmxrpno1apt iocildlaDrluvs;()arxniocoadfm   n ol(0 rxo(m3oodomtn ivtls aDta(rp;u4aeeoioctltlm2emnmo ()trtnir io1omt lnvs ( srxoim oy4lmen fvt s srtmxmp;t0oleomfciyt aDumnmp u0aeeoifcootlpD an ol(0srumxm iodalenlies t)srum(m ;o4tet  fetld a elump t)trerxrcoatlptr uei;t)trxmio no1ape mics t sDur(mo;o1aee mfeiytfs rmnms;t0tltoir tatlateanvsl(  etr(rpoo1alen nvi sfsrua(mo;t1olx mocias a2ua(vpnu4alxomfcta1omDelu i;s t2umxr3ou4omeemieil() 2uaum ot1oltn icilsfa2elu on(4 etoxociytoptrluei;()setoxm oodlmte ieia()s2um( o;t1alt mieiatfa2ulnvs;(4treomf3oydlm  lieils  etrio nodlpte nes s) Drmu  nu1teto octls m2ranvont0trenmrciytfm  au ilt seumir3iydllte fct ( s2rmxrpno1tlxomocildls eauvs;t0 exomociatoatraieols0sexmxmpnu4ome  fvta(f Dua( onu4alt mociaslm rluvp u)texrifcoydoaD au i s s2tmimpnudlme  ivslt)arrr(mp;t1teto fctyt a2emumo;(0tltoxo ta1om  ln s t) 2urim3io4lp elfvtlt a2tm(rono4tpxomoetytfa ra(ms (0 ltnmf3iytop  aivs ( seurxmpiydaltnlnvi ()aDtrxm nu1altniiciys s uanvp (0 rtrmfcty1opt luei;s texr(r3oy4olt  ivi (fs2uaxmo;o4apeoiictld mDrlnmont) renifciydoa r i sl(0s2trxm3ou1op  lnvsatfartr( pnu0tle moeiydlaDrlumpnu4teeoif3to1late ues;( s2trxr3oodomeemiei s)a2tmu pou0aleomfetas a rmn p;t0tetrifctydopDeli i ()trxmir3ny1alt mfetat) rtm(m ;t4oltnmociatfs2rl( snu4aexoifciadfp e n o;t)s2ur(o iy1al emnesa(faDrru p;o0tlx io3iltfa uan s t0tetrmr tydfp r ivi t)s2uoxr oy1olenlicil(farrrurpoo4opt  ociydfa emnvsn(4 lerxfcia1fa rlueols  rtm(o nydll e neilt)aDuru  no0oeeo ieilsfaDeaums;u4altrxf iydfa r n i t) etoxmpny1llen nvilt arta(mo;o1tpen fetltlaDuaumonu0aeeoxfctotopDrlnvol(0 rxmxr oudalenliesltfsDtrumo;o0alxn iciysla2umu snu)tetrir3totlmDe uvi s)sexoirpoodope mieil( artmx onu1alxomieiltfm2eauvonu)texnmr oydfmt lu sls0trtmir3io4omen ncsl(f Drrurono0tpeniieiytfs2ea( o t)alxnmf ia1la eau slt0setoxm oydlmt  nei sfs2tmxm ;u0optoifciytfaDrmnms u4 ltoir oytfatr nvil( srtmim oodll nlietltfarta(  nu0tleo ieiytfm rmuvsnt0 lermr ia1oatrln ol(0teur(mpiu1lme licsltfa2tmx  nu4tetoif3iat mDrl(msnu)alxrio3ia1lpt  ivi;( srto(o iydamtelnes t s2tax p;u0tpenmiciytlsDel(vp;()arxrxociydfat au o t sruoxrpiodam nmietl(f Drrxroou0apenifetysls ranmo;() rxrmrctodlpDrln i;t0trtm(m3nu1ap n ies t  2rmxmoou0apenmo3tys m raump;u4texoxr ootfa eli o;s)trumimpoo4oltnlfvt tfs2urumpou4tpt mfetat s elums u4 etoifciytom  aies t0trum(mpiodomtelici tf ruaxmpot0tpxoifcilsfa umnvsnt4tetrmo tadfaDraueo (0sexo(opiy1lpeemici ()arum(r oo1teeoiociltlaDranmo t0aleoxf3iotom rln sl()srtm(o3iudamtnmictl(f Durur oo1oeenmo3ildlmDel(mp;()tetnmrctadlmDeai o;t t2xoxo3oydll   ieiasfs2umxmont0optnif3iltfsDemuvs;(4tlenmo3ty1fm e n olt)srumio nu1lle lfvsl( a2urump;u1texn fctydfs rm( o t0teerxf3oa1oat livi ()seuo(r3oy1ll n ici tfarum(rp;t4tltomfeilt mDranvp u0 rxrmo3ta1oa  anvslt0t2to(o io1ap e ieia() 2taumpnt1alxomi3iltfmDeln o;t0 lxnmo ta1fpDeaues;s0 etm(mpny4lptn ieils a2umuro;o1texnioetad s2rlu p;u0teenxf iatlp rauvilt0 ruriopiy4ap  lnci (  rra(mooo1ole  fetys s2ua(ms;t4teeniocia1om   neil( s2uoim iudllte ivtlsf 2tmx p;u0olx  ieiasla2ean snu4trtnircoatoatr nvi t)seuo(mpio4apenmfcil(faDrr(m ;u4aptn fetls aDel( o u0 ltrmfcia1la e n o;t srtoxopoo4lmtelfvi t aDra(rp;t0oleo f3ilsfmDem( o;u4altrifctadlmtelnvo;()texrxr3ou1lmeemnetatf rrmx  nu1olenif3iyd m2emn s t0aeerxoctydfmt lu ilt t2to(mpiu4ll   ivi tf 2urumoou0oetnmfcildlaDeanvp;()tltrmo ta1lat anvi;(0 etm(rpnodam elnvi (faDta(moot1aee ioctasla2emump;t4tltoiociydom elivol(0srtoxr3iy1ol nlfcs s  rraxm nu0olt if3iaslsDua(vo u4 eerxo iadlpDeaies;t0t2toxr3nu4openmfvsatfartrumoou4tetoiieilt s ulu s;t4aeeomr tydfpt ai o;()seumxo3io4olenmnvtlsf Durumonu4oex iiciys s umnvp u4tetnmocoa1fmte ueils)s2tmir3io1omenlivsl() 2rmx o;o4aee mfcilslm2rau p;() eeoif oadom  luvo;s) etrir3oo4olte fvia(f Drr( p;u0apx  feiltls2rau p;t)trxoio to1oateai s (0seur(rpiy4altnliet sfsDumum nu1olxomictasfa2rlnms (4texnmf3oadlat au ilt setr(mpnu1aptn ivil()a2tm(mpot0oeenif3ilsfa elu p () etnxr iytlpt  n s;t srtr(opno1ll nmics s aruru pno4tlt miciltlsDeln o;(0 lxrxo3io1fm eluvo;() rxr(m nodomt lfet tf Dtmumo;t4oleoiicild a em(vs u4 eeoxr3oodlatrlnvol( seurxmpiu4alt  ieils)a2ua(mooo0oeen iciatfa2ua(vs;t0tetoxf to1faDe nvs s0sexrio3oo4op nlnesatf rtaxrpnu1oltn o3tls sDuln s;t)alerir3tatlmDeaivo;t0t2uoxo3oy4lptelfeilsfsDtaxmono1tpto oeilsla2eauvpnt0artrxfciodoaD  nei t  euoim3no1al e fes s srtrx poo4tlen ieils sDrm(ms;u)aexrmoctadlp r iei;s seur(mpiudlm e feil(  Dtrx pot4tpeomfetldlaDemn p;t4alermr3tatfmDe ies s t2xr(r3iu1oleelneil( srumur oo0tltoiieiytfsDra( o () eerir to1fmDeaivo (0 2trxm nudop   ivslsfs2rrxronu4olxomieiyd a2um(vs;u)tleoio3oy1fpt  nesl()t2uoio ou4lp emfvias artmur oo1apt iictldls2rl( pnu0teermo tatfpDrauei (0 exoio3oodamt  fviat srrmur ;t1tpe  octys m uanmp;t)trtnir3iytfpt  uei;() ruoxrpio4lmen iei t)a2ra(mpoo4oex mf3iatfaDumn p;u)tlerirctadlat liei t)srtrio oudaptn fei sf Draur nt4tlx  i3iad sDraumsnt)tleomr tytfpDr ueil()seum(o3nu1ol  lfesas)a2rrumpnt0tet  fcias sDeanvonu4 eeoio oadop  livo;s0seur(o3oy4ol   fvtltfsrraumono4aptoif3ilsfs ean ont)aexnircoadla rlu s () 2xmio iydopenlfcsltfaDrmxrpou1tpenifeiltfa umu onu)alenxr3tadop   ieo;t0s2xmim iu4opt  feilt srurump;t4aetnifcildfs2um(mo;(0arxoif iotfa  luvo;t)t2trir3iodam n icias)srrax poo4apeo oeiysla2elnvo;(0tlerircoo1fptranvsls)s2xrxo iy4om nlivt sf rta(rpoo1tlx  ocilslsDrmu p (0alenxo3iatfpDr ivs t)srxmxo oydal e fvta( sDumu ooo4tpxomoeiat s2umums;u4texrmo3to1laDr i s;(0 exm(m oy1apte ictat)a2rmu  ;u1opxo i3tlt a uanmp;u)aleomfcta1oatr nvsl()s2urxo3io4ol nlnetatf 2urur ;o0oetoioctasla2raums t0treoxr3to1op e n s;s  euo(opoudlpt  fvtlsf Dum(m no1altomf3iltlm2ranmpnu)alxrmo oodop  luvo;(0srumxr iydalen fetlt)arur(  nu4tpt io3iadfm2rluvs;u0tltnxf3to1oa  auvo t)srxmxo oydllt livt s)aDtaum nu4alxoiictls aDrmn s;t)tlxrxocoydlp raivi;s)srxrio oo1alen ivsa(fsrtru pnt4tpxn fctatfaDelu sn(4tetnifciodlmtrlivolt  etmxm3nu4ap emfvsasfaDurx  ;u4altomf3ilsfmDuau o;() exoxocoodfpt  nei ()sexm(o iy1lm nlnesasfa2umx  no0opxnmf3iydfa emu p u4 rxoif3oadfpD  u s;() 2trxo3oo4alteliet t  2taxmo;u1alxn fciad s2eluvpnt) eenxfcoodfm rln ils)trxrir3ou1optelncsl()s2um( pno1tetnii3tytls2uanmo u0 rtrmr3iodlatrluvsls0teumxopiodlm nlncils)artmxro;o0texnifciadla umumonu0 eenxfciytom  anei;t)s2xo(o io1apenlivilt) rrax pot0oleoio3iasfa2emn sn(4tlerif tadomt  ivils0trxmim3io1optelfcta()artmumpnu4alto fetlt m rmumo;u0tltomocta1omDr u sl(0seurir oudap  liesl()s2umumpoo1oetnioeiydfm rmnvs;t0artomf3oadla   nvols0teumxm3iodape lfcs tfaDumxm ou1altnmoetytfa2rl( pnt4teeoxo oo1om   u o ()s2tmir3oudalenmfvt t srta(mpnt0aeeomoeiat aDelnvp;(4 exnir iatlptrlivilt teurio3nodap  liviltfsrrmur nu4tlto fciltla2emnmonu) etoif to1la   iesl(0 eurxrpoudlpeemivtlt)aDur(rooo0ole ii3iytfsDum(vs;t4altnxr tytlaDeanvs ()s2tmxr3nodamt mies s) rrru  ou1opt moctlt a2eaump ()trtrmr3oytla e ieslt0sruoio io4optelnetls sDtm(  nt0tleomf3ildlsDuln sn()trerir3totomt ai o;( s2tm(m oo4ame livsl() rua(ro;t1altnio3tydlmDuanvp (0 lenxf oydfmD  u i ()t2xmiopoydoptnlncslt a2urx oou0tlx mietytlsDrlnmp t4 etomf3iotomD anvs t) rtmio3no1ome  fes (fa2raxro;t4apeo f3iytfa2ulnvs;t0 eermf oa1lptrau s;t) exmxo io1lm   fvt () rta(mpou4oeto iciltfs2umnmsn() reomr3iytoaD lnvslt0s2urxr oy4omt lfcias) rrmur nt1tpxnmictydfa2el(mpn(4 rtrifcty1lp  aieil(  2xoxmpoy1alen fvs t  rtaur ;o4tltomocils aDrlnmonu4 rtrmoctydfmD  ivol() 2toir oodomenmfctlsfaDraur ;u1tltoiieiysfa2rmu onu0arxnxo to1fmt  i ils0 2uoirpnydamtelnetls  2rmur ;o4oet ioctldfa emnvp;t4altoir oo1lmDrli o;s)sruo(r iu1al nlnesa( artaxrpnt1tleomfeiysfs2ua(mpnt)tetnif3oodlatran o s trurio3ou4ap nmivtat artmxmonu1ole  ociyslm emn sn(0altoxrctodfaD  neols seuoxrpnydllt mncs sf 2tm(ronu0tpto iciytla2uanvp;t0 ltrxo3tytfpDraivo t) euoim3nodlpeelfeias arrrurpot0ape ifciys a2elnmo ()altoio3oodlmtr nei;t  2xoim oy1ape  feils s2taxrpot0alt mfcilt sDrm(vo t) etnxr iodopt auvo;( t2tm(opnodoptnlnvia() 2umxmo;u4aexnifeiadfm2emnms t4 lermf oa1om elneol(0 2toxm no1apt mnet s) Dra(mpnu4alxnii3ild a uluvp;(0alerio3tatlaDe ieolt) rumxrpoydopeelfei s srra(mpnt0apt  fetasfsDuau p;t0aetnmrcoatlmDelivo;t)teuoxopiodapt licsl( s2ra(r nt1tlenifeiyt m2emuvs;t4 lxnmrcta1lp  anvi;(0 2xrir3iy1om nmivi tf 2urxr nt4tetomo3iad m2el(msn(4trerxr todlat auei;s)srurxrpoy1ll  lfeiasfa2raumont1oexo ociyt m2el(vsnu0 lxnifctodoa ran ols)t2um(rpnu4apenmics (faDraxront0optoifcildla2ra(vpnu0tltrxo3iatoa rli i s0 rxr(m3oy1ll nmnvtlt  Duax ont4optoioeild s ul( pn(4alerirctatop raivi;t) rtmxm no1opte icils)a2trurooo1apxo o3ildfmDrlumo ()texrxf3oy1latelues () 2xm(r3ou1llenmieilt)a2urxroou1alenmi3ias a ran p;u) etoxf tadopt  nvolt0srxr(o3oo1ole lnvi t)s2rmur ;o1aexoio3iysfs2umu p t4aeenmfcto1fmD an s;s0seuoxm3no1am n ivsls)srumx ooo4apeo o3tlslm umn onu4 rtomf3iatfpD ln ols0sexoxmpno1ll elnvtltf Drr( ooo0tlx iietls a emnmp (4altrio3iodfatrauei;t0seur(r3no1openlnei t) Drm(m ;u4alx ifetadla rau s t0tetnmo3tytlp elies t) rtoxr oo1ll nlfvsls aDuax ont1aptnmo3tad a2ra(mont4arenmocoadfaDrli i;t)s2toxr ny4llenmivtlt) 2ua( o;t1alx ifctld m uau o;(0trtoxfcio1lmDeauvils sexrio oo4ll nmnct tfa2tmumoou1tpxnmfctyd m2ea( ont0trxnxf3oo1lpD lies t0s2to(m no4lltemncs t  Duaxrpou1altomf3iyt m2rlnmon() eenircoadoatr u ols0srumxmpiydll   nct tfa2urx oot1opx mfciytls2ra(mo ()tetoir ta1opD  i ilt  exrxo3nydopeemfeslsfaDta(mp;u0tlxomfctldla2ranms;u) exrmo tydfm rau o;s0 etm(opoy4ame mfet sfs2tmumpoo4oeenioeiys a ua(mpn(0trtniocootlmteaies;()seto(rpiu1lpt  fvi t  2ur(m no0olen iciltla2uau on(0trxrifcia1fat  u ils) rumxmpnydaltnmfvt tfsDtrumoou1oexnmociydla rlu snu4 rxomr3ta1oa e ueolt s2urxrpiu1opeemfcslt a2um(moou0apeomieiyslsDrlu p () etrxrciotfpD  ieo;t trxriopno4am nlieslt)sDtaxronu0teto f3ildla2elnvont0 rerif to1lat anvols0s2xrxm3io1am   iesa( a2uaxrooo1aeeomf3iasla2ua(mp u) rxrifcootfmt  ivs;s0srxoirpnudapeelfvilt  2ta(rp;o1tee  ieiltls2umnvo;t)aexrmr3io1opDr i i;t  rtrxr3nudop  mfetls) Dtr(m ot1tetnioctls aDulumo u) etrxrctydla eauvs;t s2toxm oodal e ivt ()aDrrumono0tlx mo3tldlsDemn o (0 lxrir3iodlpteanvsls)tetrxo nodlpe  fctl()a2ur(  nu1oetn ieiyslm2ulump t4trtrmo tydfp   ivs s0 etrio ny4omeemnvtas a2urxmo;o0aetn o3ildfmDranmont4 rtrmr tydopDe ivilt  2to(o3iodlm  lnciltf 2uax pou4tptomfetydlsDumumpn() lenio3oydom  aivols sexrir3iu4llenmicils  rrm(ronu1opeomicilt aDuln o;t0aexoif3oatom rlnvol( sexm(o3oy1om nlieilsf rurxmo;u0oetomfetasls el(mpn(0aexnmf oydlmtrai i;s)t2uoxr3oo1lm   ivi t)sDrmu  nu0altomfetlsfmDea(monu4 ltrmrcootfptr i i;t s2tm(o oy1ll  lfvsa()a2umump;u0opt ioeiydlaDrmuvs;()trerxo oatfatelieo (0srxm(o iydam  lfetasf Dur(r ;t1tpeo oeiatls ul(vp u4aexrifcto1omteli i t0srxmim3ny4lmt livil(f 2trumonu0aexoiictysfaDeauvsnt4 reoio3to1fpD  u s;t sexrxopny4ale  fesa( aDuru  nu0alx iieiyt m rluvo t4 etrxr iotfm e ivs s sruoxm iy4llt  nvt (  2umx onu4oeeo i3tydlsDelu s;u0 rxrxr oytfmt li ils) 2toxmpiy1apt mics sf Dtaxmpno1ole ifeilt s ranvp (4tlerxr iy1oatr i o;s teuriopiydal emics sf Dua( o;u1olxnmo3iat a elnvs (0 etnmfcoadfa r ivo s) etmxmpnydlmt mfei (f 2rmu oot4apeomoctltfsDumn snu0artrio3iotfpDrlueo (  etm(o3nu4ole  nci ( s2tr(m ;t0aptn fctadfa2ranms t0trxomf oy1lp ranvs;t)truoio no1olt lneia( srtaumpot4opx  f3tlsfsDumnvpnt0 rxrmfcoydopt livs s0t2xoxm3nu1alt  nvtatfsrtaum nt1olx  ociyt a2emn s u0tlxoifctytlm rln i;s  etoxm oodop  mfeils)arurxm oo4apxomictydlm2rl(mp;(0 etniocootfpDraieo s)seuoir3iy1op   ivi ( a2ua( ont0olen fctld sDeaumpnu4alxrxr3oodomD lues;t) 2tm(rpiu1open nes () 2trurp;u4aee  octldla ran s u4 rtrifctodfpDraieil()tetoxrpnu4alt livi ( aDtaxmpot1tpt iictytlm umuvp;(4tltnioctytla elueo;(0s2xrxr no4om  mfctl() Draumoot1teen ieiysfa2umn p;(4arerif3to1lmte ueo;t0s2xoxrpny4lmtnmfvsl(fa2um(mp;o4oeto oeiatlsDemnmont0aeeoxfctatom  au i;( seurxopno4lltnmivsa( a2taxrp;o4oee  i3iad m2eaump t) rxnmf iatlaD aieils)s2xrxm3iu4ole lieil() 2taur ;u0opt moctatlm2uan pn()artnif oatom rauvs ()trur(opno1am   feilsf Dum(rpoo4olx mo3tadfs emuvp;(0artnxr oytlm r uvs;t trtoxopoydllt mnei ()aDtm(rpot0oet mfeiad sDulnvon(4altrifcootlmD  i il( trurxo3nu1alt  ivta()a2umumooo0opx miciaslm ulums u) leoxf3iodfatelu s s0 2urxo3oodoltn nvsas)a2taxm nu1oeen oeiadla2rl(vo;u)teenmo3ootlpte u sls0 rtr(mpio4oltn nvsa( sDrau onu1optoii3iltla2elu o t0tleoir oatfa  ai sl()srxoim3ou1am n iciatf rtr( ono0optoiiciyd s2elnmp;u4alerirciotfmD auvs;()s2toxm iudom e nciasf Dua( pou4olxn ociys a rm(vp;()trtrmocootfm r nvil(0 rtmxr3oodlpt mnesa()arumxro;o4tle ifciyd a emnms;u0 exnxrciy1fa r ieil(0seur(m nudoltnmiet s  rum(m ;t1oleomf3tys a ea( p;(4tleoxrcia1fpt aueo s  2to(rpno1amenmnvias  rtrx  ot4oeeo octaslm2raumpn(4arxnio oa1oa raivs;s) etmir3ny1am emnvtat a2ur(r no4oetn fciadfmDranvs;() rxoxr iy1lmD auvi t t2tmxm3oo1ame lncia() 2rrx ooo1oleniociaslmDelnvs t0arerxf3tydlmDr i ol(0 2umio iodlle mics s aDraurooo1aetn i3tatfm uln s;u0tltoxo oodlmDelivols sruoxo3ny1llt micta() 2rr( p;o4aexnmictldfsDul( p t4arermfcio1oat ai sls0sexo(rpnodllenlnvilt  rua(r oo1oeeniictas a2emn on(4texoir ootfmte uvi;()texoxrpno4llee fvil()sDur( o;u4optomicilsls2rl(mpn()tlxrmrcia1fp r neils)sexrir no4lmt mfvsa()sDtaumo;u0oet ifeiat s el(ms;t4 etnxf todfp rlnvsl( trxoxopno4lp elfetlsf Dumxmo;o4ape  ocilsla2ulu o t) ltrmo3iy1lp eau s;(0srur(r iu1opte ieia()a2uaxr nu1tpt mo3iltls2rmu s u0texnircto1lpD liei;s trumio3io4optn nctl( sDraump;t0oeto ocilsfmDra(vo ()texrio iadfm rlivo;s s2trxo no1lptemivi () Drmumpnt0aptnmi3iys a2uauvs u0tltrmr3totlpt li s (0tetm(o3nodale mfvia( srur( pnt0opeomf3tat aDemumo;(4tetoio3oodop e u ol(0s2umim iu1ome lnvtasfartmxm nt1aleo iciad a rl( p;t0tleoif3ta1la   i sl( t2umiopiodlme  fciat) 2trxro;o4apenmoctat m2rlu pnt4tltnio3tadlaD  ueols)teurxo3iodamtnlnetltfaDumuro;t4ope iocildfaDeanmpn(4 rtrmf ty1lpDe n slt)t2to(rpnudlp nmnei s) rraur no4oltoifeiysfs2emu o t0aexoir3oy1oat  ivo;(0srumio oy1ll elici (f 2urxmpnt0tetn fctytla2ran s u4tlxnmrcoydlm  an olt seumirpiy1ol nlicias  Dtaum oo1tpt iiciyt sDrlums;t0 exoxo3todfatrau s;( s2xoxr3nu1ll elivslt  rtm(r ;o0texo oeiytfa um( p u0tltoio3ta1oaDelivi (0seuoir3nudomtemnet t a2uau p;u4aee iociydfsDel(mo;t0trxrxr oo1fa  ai o;s teumxopiu4am emict ()a2rax oot1texoioctyslmDrlnmsnt0 exomrciadom rln s;s t2xoir3no4lp e ivs s  rrr(mo;t0alxnmoeiadfs2rmu sn()tlxomrctodfpD aueo t0t2toxmpnydlp elictltfaDtrxr ot0tlxo octatfs rmn p t4trenio oatlmDeluvsl( t2trio iu1al emneilt s2tr( oot4aleomoctasfs2ranmo;t0 lxnifcoytfmDeliei;t0trxmxmpou4opt miet t sruaxmooo1oltnifetydfaDeauvpn(0 rxrir io1fp  anvs;s setrxo nu1lm e fci t s2raxrooo1tptn oetytfmDranmp ()aleomo oatlmt  iei (  2xo(o3iu4oltnlfci (fs2tr(mo;u4olxoioeiytfsDeanvo u)trtoio3iotfaD li o s sexrxrpou4al n ietas) Dtm( ont1texomoeiad s2elums u0trxnif3iotomtelueilt0 etoxopiu4lltn fes tfa2uaur ot0open i3iydfsDem( p;t) exomf oatlmt  n sl(  rxrxm ou4apenmivsasfsDumx poo4tee  f3tyt s rmn o;(0 eenmo oy1om eaieilt0 rxr(mpno4alt lfesltf 2um(ronu0ale io3iys m ranvp;()areoxo3oy1fm rauvilt srxoirpoo1ape mncsl()srrmumo;t4aexomi3iatfa eln p;(4 etrxrciadla elieil( t2toxrpiu1lp   feta() 2ra(r ou1apt ii3iaslm2ulu p t) rxrio3ta1opD li i;s0s2xrio ny1ap   ncs ( arur(mpno4aeeo iciydlm rlnms u)aleoxf iatop   nvil(  2xriopnu1op n nes t)sDrr( o;o4aptoii3iyt m2rmumo t)tetoif3iatlmtelneo;t0trxmiopio4olt mfesls) rumurp;o1open o3tlsfs2ean s;u4teermr3oa1lm ranes;() rumxm iudolt mfctas arrr(r ou1tet  oeiys m rau onu4 ltnxr totla rlu slt  exmim3oy1lp n nvt (fsrtm(rp;u4tlxnmiciasls2eluvo;u0 leoif3totfatran s t) 2trir3iudlptemietls)srtmxmooo0teenifeilt s ul(mpnu0aeenir iatfmte u slt texoxo3iy1ol n ieta( srrr(  nt0tlenifeiydlm2umnms u0arxomrciadlmtean sl( trtoimpnydolenlfvta( s2rmxr no4ale  ieiadla uaumsnu)trenir oa1lpD auei ( teum(mpiy4op  lnvia(fartr(rp;u0opxomi3ilt a2elu s;t0trtoxr3iytlatrlivil()s2urxo nu1lmee netasf Dtm(r ;t0apxnioetysls2rl( pnt4 rtoxf ta1la ranvo;s  exrim3nu1altn ici tf rur(  ;u0tptoifeiltfs2um( o u0 rxoir oydfaD luvs;s0seum(m io1lpenlnvs (f 2rmu poo1olto feiltfa2rln o (0 rxnxo iodomtelivo s  rxrxm3oo4ale mfetlt)arrauroou4oetnifeildlm rmumont4alxomr tydlpDrai i;t)tetoim oudll  mfcias  2ta( p;t4olxoio3iysfs2eanvpnu)tlxrmf ty1opDeanvi t t2umxr nu4ap n fcil(  2rmumooo4tpxnmf3tldfm2elnvp;t) rtrmrcoo1fpDeliei;t)tetrio3nu1ame mfet tfs2tmum nu1teenmo3tysfa ulu on(0 lenmo3iy1lp  aivi t0srxriopoo4ome lnviat  2um(rpot4oexn octad s2ean s t4tlermfctadlaD  u s;s) 2uo(r3no1op nmicslt aDtaxro;t4ale ifciatfmDrl( s;u0tltomr todoa  livolt s2xm(rpiu4ameelfeilt aDur( pou1texnmf3tyd m2rm(vs;(4alermrctydom e ieol(  ruoxr3oydlptnlfetlsf Dumu pou0tlx ioctltls2rm( s;t)artrif3oo1laDraivi;(0 etmir no1lmeemfcslsf Duau p;o0tpxo ociytfs umuvp;()aexrif iatfaDelu o t) 2urirpnodopte nes t) rrmx  nu4aptn fciys mDum(vo;u)tlxnxf iatlptelues;t0 2xr(o3nydll n ict t  Draurpot1oexnii3ilslmDumn o;u)aexrmo3iatlmtrlnvs;s)srxoim oydolen ivt (  Durxr ;t1aee moeilt m rm(ms (0 lxnmr3todoat  i i t) eur(m oo1amen fetl(  rtrumo;o4teeomfcildfaDumuvo t0 exoirciatoat ai i;s)trurirpiu4om nlnvilt  2trx o;o1tpen ociysls2rm(vp t4aetoio3ty1lm rauvo;(0texr(mpiu4ome  ivi t  2umu o;t0oetnifetatlmDrl( s t4 lenmoctotfa rlieol(0t2uo(mpio4omtn ieta()aDrru pot4apxo f3iltfsDelnvs () rermf3oytomD liei t0srtoxr3oudll n fvtlt  Drm(r ou4tetomieildfsDeanms;t4arenioctadoaD  u o (0srto(o3iydomtelivtls s2umumooo4aet ifciyt a eaums;t) etnxfctatlm eauvol()s2xo(o io1ap nlfvi ( sDuru ont4olen o3iltls2um( on(4 exoxo todfpteai il( teuoxrpnudlmtn fetas) Dum(r oo1oeto feildfa2uan s;t0trtrmfciadfmtr nei ()srtm(o3iu4apt lncia()a2tmx pou1oltoifciadla eanvs (0trerir3oatopDe i s s0 ruoxopnodolen fvil(f rtru ono4tle mietltls umnms t4arenmf3iadfmte nvsls)s2trio3no4apenlncil()a2umumoou4tpenmietydlm um(vsnt4alxrmf totfmtrauei t0srumxr no1optn nci sf Dtaump;o0aleo ieiyd aDraums t0artnmfctodfp e uvi t)teto(o3nodolt  fetlsf 2ta(  oo4tpenmfctas s2rl( snt)trxoiociatfp e iei;t0t2xm(o oy4lmtnlivi sf 2trx pnu1aexn f3ilsla rlnmp t0trxnmf3totomDeluei ( trxr(r iudap elfvtls  Drm(m ;t4tlxn f3iydfa uaumpn(0teenxo oa1opt an i (0tetrimpou4llt mictl()a2rmu  no4ole mo3iyd sDeln s;()tetrxfctodla ran o;t)trxmxopio1alee neiat  2ua( p;o1teeoio3tlt m2umnmsnt4 exoxo ootlm eli il()trto(r io4apt lfetas sDumx  no4tet  ieiysls2ulnvpn()texnxrciatfm e ivi t0srtmiopou4ole mivil(farrruro;t4aeeomo3ias m2rmnvpnu) rxoxf3to1op rauei ()tetrxrpiydlmtn nvs ()sDtrx  ;u4aet mociatfs2rmu o t4 leomo oytfm eln ol(0trtmxmpiodome  fctl()arrmu pou4alt moeilt mDeln pnt)tetomocootlaD  uvs;t) 2xoxr iu1apeemiesa() rua(root1opxnmieiyt sDulnmp u4altoxr oatfa  auvo;s)t2to(o oudam elicilt)srrrump;o0apt if3iatfaDumuvs () lxnxociytfmteluei ( sexrxo no1al emnci (farumx  ;t0alt if3iyslmDrmuvo u4 rxrxf3ta1fa   uvo;( s2xr(m iodlmt  ieiat)sDtmxmpoo0oltoifeiyt s2rlnvo t4 rtnmf to1fpD  ivils0srtrio iydomtemnetasfaDum( p;o1optoioetlsfsDrm(ms;(0 exnxo iodomte ues s)teuriopoy4ame mnei s) Duaurpoo0tpxn i3tasfm emump t) rtrmr3iytlat li s (  rtoxo iy4llteliviat)arrm(rpoo1oexnmietyt m el(vs;(4 rxrioctatlp e i ils srumxo3nu1llen fcil(  Dtmur ou4aexoiieiltfsDrmnvo t)texrirctatfp   uvols0s2uoio3no4om e fei s) rra(mpoo0aet mieilsfs ea(vo;(0 renmf oadlateauei ()srto(opnodlm elnetas  2urx oou0aptniieildlmDrmnvsnu4texrxoctadomteln s t t2tmxo3nu1oltnlfeslsf Dtrx oot1optniieiasfa eaumo;(0trtrmr3ta1oatrlueo;t0 2xr(r3oodalenlneil()sDta(  ou1tlt moetydls uan p;(4 lxnmr oo1fm e ues t)s2uoim oudomtelictlsfsDrrxmono4aexnioetatfs2uluvsnu4 leoio iodlpDe ueilt)t2xrirpoodol nlivsas  Dtaum ou4tltoifciltlmDemn sn()altnxf3iy1lmteaivo (0texrirpoy4lmtelict t  Drmuro;u1alx  o3tyt s2ul(vont0artrmo tytfmtr n sls  exo(mpio1alt  nci s aDum(ro;u1aexoiieiadfa ea(vs (4artrmfciydlaDean ol()texmxr iy4apee ictat s2truro;t1ole  feiys s uanmp;t0aleomocto1la eaieils0srtmiopiudomtn ies (f 2raumo;o4apeoioetldlm2eanmp t0teermf3ia1faD an olt0 exr(m3no4lmeemfei s)sDtrxr nt4tpxniietad aDul(vpnu4 leoif iy1lmDean il(0srtmxo oo4optnlnvias  rtmxr ;t4tptn i3ils m el( o (0 rtoif iy1oa r nes;s0 2toxo3iy4lm n feil(fsrtmuro;u4aex mieiyd a2el( p;t)tlxrxfcoydlpteauesl(0 2trxrpoudamt lfvi t)aDra(rpnu1ale mieiyt s2eau o;u4tlerir iatlm   u i;s0 2tmim3ny1omtnmncil(fs2um(ro;u0ape  oeiyd a ul(ms;(4teeoioctydlaD  ueo s0trurxopio4amtemivsa(farua(rpno4tle ioetlsfaDrau p () lxoif3to1op eli s;s)trto(o iy4llt  ieslt) Dtaum oo1tlxomieilslsDua(ms;(0alxrmfctotfpD livi t) rtm(m ny4lpe livias)s2rr( o;u0tltn ociatlmDumu o t0 etnmfctatfat li o s0 2umxo io1lpeemfvsat) 2raxmp;u1tpen o3tyslaDrmnmo;u)alxrmfcoydla r uvs s)s2tr(o3no4ale lnvil( srumu o;t0aleo ocilslmDul(mo u4 lxnmr oo1oa   nvils s2umiopiodlmtnlncias) 2rauro;u1oet  iciytfmDrm( s;()aeermr iydlpDraneilt setrim3no1optnlnesl( aDum( pnu4tle  ociyd sDemnmp;t) rerxo3oo1oa e neo;t)trumxr3iydomeelfvtas  rraxrooo4open ietadfs el(vo u4 rtoxo oy1lpDraues;()t2toio no4llee feias)sDrm(r ;o1tltoioeild s2umn o (4aexnio ty1optraivil(0 eumxo oodoltelivtatfa2tm( p;u0tlx iociasla2rm(vs u0alxnxo3tatfpDeai o;s0teuo(m3oy1lltelieia()aruax  no4olt mfeiadfs ea( pnt) eenmf3iy1opDr i ol(0teto(r ny4aleelici s  2umumono0ape mo3iltlsDrm(msn(4aetrxr3ia1fa   u i;(  eumxr ou1om nmiesas) Dua(r ;t4altn f3iydlm2ean p () rtnifcootomDr nes;t trtrio nu1amtemfcilsfartrxm ;u0ole  f3iasfs2um(mp (4altoxrcia1opDeanvslt0s2xm(m3oy4op nmnes tfsDraxrp;t4olxnmoeiyd aDrlu s;()aexnxo oa1oateanes t setr(mpno1opt lfctl()aDtm(moot0tleomoeiytla2rl( o;t) exnmo3iotfpte nesl()srtmiopio1ol  lies sfa2rmu  no4oexn iciydls2emums (4trtoif3totop r ivi (0 euoxopou4ll  mfet t  rrrur ;u0tptomfcils sDeluvs t) rxrxocoy1laDeauei;t) 2xoir nu1lpee ivtl() rurx oou1alt mfeiytfmDrm( p u)artrif3to1la e n i t  2ur(r3ny1al nlnvilt) Dtm(m ot0aeto octldlm rmums;(4 eermr io1lptrlivi (0truoirpoydlpenmivtltfsDtmurooo0alx  f3tytfsDuaums;u0arxrmo oo1lpDeai o s)s2umxr3nydapenlfesl(f rurumpoo0oeen ociad s2ua(vpnt4 exoxf3oadlp  an il()trtrim ny1lp elnesltf 2tm( ono0oltn i3ias a2uln s;t) etrircoadlp  aivols0srxrxopio4op e ivil(faDumu  oo4apt  feias sDrm(mo;() eeomf3oy1omD lieo;(  2tmxrpnudlltelfciat)aDtr(roou0aexnmictldlmDem(vs;(4 eenmociatopD auvo;s s2tmiopiy4lme  neslt)srraurpot0ole mfctltls2em( sn(4aexnmocoy1oate i o;(0t2tmimpoy1lm e nct t)aDra(mpnt1tlenioctytls rmn s t0tlxrxfcoy1la rlieilt srto(m iu1lptelici ()arraxmo;o4alx mfeiatls2ran pnu0 lxomo tytfmDr u s t srurim no4lltelfcsls sDuaxm ;t4oex if3iytla elnvo (4texomf todla  lnei;s0s2xrio3nu4op elivils) Drrxm ;u0teeomiciadfs elu o;u0altrxfcoatlpDraieolt)t2uoirpnodamt liet s aDum(  ot4olxnmoeiat s2umu o t)teenif3oodfmDr nes;s  2tr(mpiu4lp n ncsa() rurur oo1tltn o3ildfa2rmn s;t4 ltrxrcootlat aueil( trurxrpoo1al nlicsl(fsDtm(mpnu0opt iieiyt a ulumon()trxnir ia1omDe neilt) exriopou1lmenmnei t a2umuront4oetnmi3iydlm2rmnmpn()arxrif3tatla   ieo;( srxmxr nudlmtnmfcs ( s2raum ot4apt mictlslmDemnms;u)arxnmocoo1lmtrli i (0teurxopoy4llen ivtas  Drax  ;u0alen fctysfs eln o t)alxoxr3tatfpDelnes (0t2tr(m3oy4lp  mivilt sDum(rp;u4tlxnmi3iltlm2ulu onu0aexnmo3iodfm ranes s)trumimpou1oltelfvia( a2tr(m ;o0aptoiictaslaDrlnvo u4 lxoircoatfpD  ues t  2tmxr oy1amtnmneias)aDrr(  ;o4oee mfctadfa em(mpnu)aeerif iy1opteauei (0 2trxo oudllt lfeiat  Dtaur ou1tpe mf3taslmDean p;t)trtnmr3oa1la e neilt) 2xm(m ou4olt lfct s)a2tm(m ;u0ole  i3ilsfs2eauvp t4artomoctotfmD  ivs;s s2toxmpoydlp n nvs tfs2um(mpnu0aptniiciys sDelump;t) exoxfcoadfate ueols0tetoirpny4om emivil(fartrumonu0tltn i3tld a rmnmpnu)trxrmfcoo1fp e uvs;s) etmxr oo1altelfcia()aDuaxmo;t4alx iociyt s ranmp;t4artnxr oydfpD  neil(0 exmio3oudllte iesat aDurump;t4aptnioeiyt aDrl(vp t0texrmo io1fm rauvsl(0 2xmim ou4lp nmicsatf Duaxrp;o1tlxnio3iad s rauvo () exrio tytoaDrlu ols0 rxo(m3iu1lp  mietas aDta(mo;t4tpen feilsls rlumo (4aeenmr3todlat  ues;s0trxmxrpiodalenmnvslsfaDtau ooo0oleoif3ildls elu o t4trtoxocta1opDran i;s0 etr(m oudom emfctat aDrm(ro;u4apt  iciydlm ea(mp;u4tleoiocoytfmtrli s;s0t2trirpny1lmtnlieils)sDumurpou1oetnioetyd s ua( p (4 ltriocoadfaD livi;t)trxrir3nodap nlnes t  Drru p;o4aet  icilt m2ul(mo;()trtnxr tadla ean i;s)s2xo(opnu4omen ieiltf rtrxroou0apt  ictytfaDean pn(0tleoir3iodfmD lieo s t2xoir oy4amt  fvta(fsrumur no4oeeomf3tat s2um(vo u0 reoxo3tadom  an o ()s2uo(m iu4amen ncias  2tru pno4tpxo i3iytls2ua( onu0aexrmfctotomD  u o;()t2xm(o oy4omteliviltfs2taxrono4tle  ietldlaDum(vo (0alermr3totom e ivslt seto(rpoydapte fetas)sDumur ot4apt ii3ilsfs ra(vo;t) etoxo3oa1laDeaivo;s0srtmirpno1openlfci t  rumum nu4alen feiytls2el( p;u4 etomo totlateauvil(0trumxmpny4ll   ivilsf rrrxmp;o4tpenmfeiasls2rluvpnu)aleriociatopDe i o;(0trtm(opio1om elfvi t a2tru poo1ope ifetasfmDrlnmpn(4alerxr todla rlues;(  eurxrpiu1ame lnes t  Dtaxrpot4aptomf3ilsfaDua(mont4 etnmrcoo1fptrln sls  rtmxmpoy1lle mivsl(  rtm(m no0aexomfeildfa2rmuvo t0alenxf oytfpD livs;s  exmxopiodaptemnesat aDuaurooo4oleoiictadlm2rmumpnt4texoiociadlm elnes ()srxr(rpou1alt  nvi (  rrrxmpou1olenifcilt a rlu p;t0tleomfcoytfaDeluesl(0truoim3nydal e ivi ( s2rmxro;o4tet mi3tadfsDulnvp;u4trtoif3iotfmDeanvsls0 ruo(r3nudopee nvi tf Dtrxmo;u0tltnmo3tadls rmu p;u0 etrmo oydom e ues t)srtoim oy4apte iet sfsDuaur ou4optoifeilsfs rlnmo t4artnmfciadopDrlivi;s0 2uoxmpiodamt livta() rrm(m no1tleoif3iydfsDemumo (4teerxf3tytopteanvil( s2xr(opio4ll  lfesas)sDrrxmont4aexoifetltfm2ea(vpnt)artomrctytlmte n o;t)trtmxo ou4lp  lfciasfartruroou1tee iociytls rau p t4texnmrctatlmD ai i (0tetr(mpiu1ope  fetlsfartaur ;u4aptnio3tld s2ua(mpnt)tetoir ty1oaD luvolt)s2tmxm3iu4omt lfctas)aDtauronu1tpto i3iatfsDrl(vsn(0 exnmr3oo1fmDraivo t) ruo(mpno4al e ncsl(fartax  oo1apenmo3iadla rmumont) rermr3iotlm r nes t0trxrxm iudom  miesatfa2rrx ont1olxnioeild mDel( s u) rxoxo oo1lmDeli ilt)s2xmxr nu1aptn fvtlsfsrtaumooo4opxniiciyd m uanms;(4tleoxocoydomDrlivilt  2toxr3iodll  mnvia(  2ra(r ;t0altn f3iasla em( sn(4altoircoodomt  i ilt t2xmxr iy1ll  lnei sfa2raumont4tleomoetytlm umnvo;u0teermr3oo1optrlu o;t)trtmim no4ape mnct s)sDtmx  ;t1aexnmfciltla em(vp u) rxoxrciodfateaneo;t)teumirpio4optnmnet sfa2ur(  ot0aleoiicilsfsDrluvsnt) renxf3iydoa   n sl( t2xm(m3iy4al emictat s2raxr nt0oetn f3iydfaDrmn ont)alxrmociydlat aivi s  2trimpou4alt mfcia() Dur(r ot0alenmociltfaDelnvont0 lxnxo3todfp r ues;s0trtoxopoudlm emfcia( srtm(m ou0tlx moetadlsDulnmp (4alerio iatoat luvilt s2xrir3oudol n nvils)srtaxr oo0tpeo ociasfs eaump;() rxoxf tytfa r ivolt) 2tmxrpiudlpt  fvs tf rtmx poo4apxoiiciysfm2emuvo u0 lxrxrcoydom eaivilt)s2xoirpno1oltelivta(  Drm(r oo4oee  oetltlsDranms u4 ltnxo3oodla rli o ()t2xm(mpoudaltn nvsa(  rrau  ;o0olxnmo3iyt a emumon() rerif ia1oa  li o;t) 2triopiudapte iet (f rrmxmpnt4oltnio3iyslm2uauvsn()teerxr tadlm r uesl(  etoim no1lpe lfeils  2trxm ;t4alenio3tlsfaDul(msnu0aetrmr oatfp rlieo (0s2tmxopoy4lle mnciasfsDtmurpou1oex ii3iyslm rm(vsn() eeoiocoatopDrlivi;s)srxrio3ny4lp   icil(  2trx  ;u0ale mf3ias a rl(mpnu)teeoircoo1optr nei;( srur(r oudam e ivia(faDumxmo;o1opto feias mDua( on() lenifcto1oaD luvs;s  etmxm3iu4lmtemivtasfa2uaurono1tet ii3iasfs2elu o u4aexnxrctotlaDeluei;t setoxm iy4op nlfvi t srtm(m no0apenio3iaslm ean s;t) ltoiociotfmtrau s (0t2xoimpou1opte fcsat) Dum(root1tpx mo3tat mDrau p;t)tlxnmf3todfatr ies s seurimpnu1lp n ictatfsDur(mont1tpeoiictltfsDrmnvon(4 eenmo iadoptranvi;( trxo(o3iy4om  lics sf Dum( oot1oltomictatls em(vo ()alxomo3io1lmDeluvi;s seuoim io1apeemfvt (fsrrrxr no0texnii3tad s ulnms;u4 reomr3iatfpDeln slt)trtrirpio1optemfvt t aDtmum ou0oet mieiadla2umu pn(4trtoxo3tadfat aieol()teurir oo1omeemnesas) 2rru  ;o0tee mfctlt m2emu sn(4alxoirctatfmtrlnei;(0s2to(m3no4lle micil(fsrrrxroot1aetn ieildfs2emnmo;t0tltoxr tatfpt ln s;s0 etmir3iy4omt  ictat  Dtrumpoo1ale mf3iydls ea(mp u0aeenmo3iodlmt luvo s)truo(o nu1lpe  nvtat  ruru  ;o4alt  fciys s rm(mo u)teerxo3oytlp elues;(0 2uoxopnydlpeelici s  Dtmum ;o0tlenio3iadla umumo u)artoxr3tydfp rliesl( seuoim3iodame mieia()aruaur ;u0alt  ietydfa rmn pn(4tetnmf tydfm r uvs (0 2trimpoo4ll nmnetat srrm( o;o1aexn ieils a rmu p t0 ltnmfciydlm eauvi;s) 2urirpnu4ape  netls srraxr ou4tleomieildlm2ul(vp u4 exrxf3oo1fptrlu ilt0srtmiopou1ape mneslt)aDuaxmp;t1teto ociydlm rlump ()alxrif3tatfmtrauvolt)t2uoxo ny4lmtn ieiasfaDrrxr ou4tle mf3tadfa2emu s;(4artoio3io1omD  n s;t)t2xmir3iu1op   ietlsfarrmxmonu1tex  f3ilsla2rlu o;u4aexoir tadlm r i i t0 2tr(mpiudlp emfvtlsfsrurxm ;o1aet  ieildfmDuanvp u) etnxr3to1la r ueo (0 2tm(r3oydapt  ici t) rtm(mpou0aetniietaslmDelnvsnu)aetnxf iytoateau o t0 ruoxo3nydlle mnctas srtrxmpot4tlxo f3tltlsDrln snt0trerir to1la e i ols0srxrir3iydameelfct (faDtruroot1tpxn octlsfsDul(vo;t)tetoio iytlpDeln i ()srxmxr nydop n feias)s2um( onu0texnmfetys a2eln p u)alenir oo1fa  livo t0s2toxo ou4llt  nvsa(faDtaxr nu0olt if3tydfaDemnms t)alxrxf3io1lmt luvs s0t2xo(mpnudop emivi s  2rrurpot1tlx if3iad a uauvs t) exniocoytlaDr neolt)srum(o3nudam elnvtatfaDrm(r ou1apeo oeiadlm2ua(mp (4tlxnio3iatlatrai o;t trxoxm oy1opt  ictlt  rum( onu0oetn f3iatls2uan snt0 etoxociadlp rlnvo;t trurxr3iy1am  miciltfaDta(rooo0olt mo3iad m elu p;u)tetrio io1oa eliesls)t2uoir oy1lpen ivt (fs2rru ont0aex ifetatfs rmnmpnt4teeoir3tatopte ueilt0s2trxopoydoltemiciat)s2ra(rpou4apt mi3tyt a rmumsn(4arxnif3tatomteauvs;s seurxm3io4ol emicsl(f ruru o;t1texniietld m emnmo u4 lenirctatlpDelneilt  2xr(o3no1ape lict sfaDtrxm ;t4optnmicildlaDeau sn() reoif3oatla   nei;t0t2xrxrpno4ol e ncslt) 2rm(mp;t1tlxomoetatla ea(mpn(4 eenxo3todfp elnvi;s setoim iudop  lici tfa2rr(ront4tpeomietaslm um( pnt4 lxnio io1fptrlivol() rtoxo3no4al nmnviasf Dumx ono0oeeniocilsfs2eaump;u) etoirctotom e ivo;t)trxmxo oy4oltn icsas)srtaum nu1opxoif3tatlaDrm(ms;t) lxrxf3totfaD livols0sexr(m nydam nliei ()arrr(rpno0optnifcilt a ua(vp u4aeermr3iydfa rlues;s)seur(m iy4altnmiviat)a2uru p;o1tee mi3ilsfaDuaumo (0 etrxrciytfa e i sl()s2tr(o io1optn fvi s)arumxr ;t4aexnmo3tydfmDel(mo;(0 rxnxo iy1oaDeau s (0seuoxm oo4al  lfetltf Dum(mp;o0tlto oeiyslaDelumo;u4 eenxr3io1lmDeanvo ()sexoxmpiu4omt mivils  2rm(mo;t1aptomocildls emu onu) lxomr3tydoaDe ueil(0texr(m oydlp e net tfa2tm(r ;o0oltnmo3iadls2rauvo;t)tlxnir3iatopte uvo s)trtmirpiudapee nctl() Draxmp;o4texomiciatfs2ua( p;(4arerxo iodlmD luvslt0t2trxo oo1apee fct t aDrr(rpoo0tptoifctat m emn s (4aeermf oodopt anvo;t0s2xrxm oo1om   netas) rrmum ;o1ole ii3iyd m uln sn() ltnxr to1lmDeau ols0seurxopoo4lptn fctasfa2ta(m nu1olxomietat s2ean s t)tetnif3iydfaDrai il(0trto(o iy4op elnes sfarum(m ot1oeeoii3tltlmDelums;(0texomr oatoat li i t0s2uo(m3ou1lpe lfetas) rtau pou1aleomf3iadfsDranvs;t0treoiocoydlpt lieilt)srtm(rpnu1ome livi (fs2rrx oou0tltoifetlsfm2emuvo;t4 exrmrcoy1opD anvi;t)tetrxm io4ale mncilt) Dum(mo;o4oeenif3iyd s ea(mont4 etoirciytfm e n i t)trxrio oo1ape  nvil(f Dumumpnu1olxoii3tatlsDrmums;(4trerir tadomDeauvi;s0t2tm(r nudom n fctas sDua(mp;u4oltomfciytfs2emnmp;u)areoxfciodlm rluvo ( tetoimpou4al e fvsls)aDur(mpno1teeomoetysfm2rm(mp;u0 etrxfciadlaDr nvi t)sexo(m3ny4apen fcta(fsDrr(mo;o0tee  icildlm elump;u0tleomfcoodfpDraivs t srxrxmpoydal n ivt sf Dtmxmo;u4apxomfeildlm uanvp (0aleoio3oy1fpteli s t0srxoxrpio4lme mnctlt) Dtr(mo;o1tpx  feiysfmDulnms;t4 ltrxr3oodfpD lnes;( t2tmimpoy4aptelncta()srrmxmp;o1opeomo3tls s umn p t0altrmr io1fpte ivo ()sruriopoy4am emictlt a2ur( ono1altnifeiydfs uanmp;t0aexnxfciatlm   ies;t)s2trxm ny4lpe mieilsf Dum(ro;o0apeoio3iytla2ua(vpnu0teenxo tydlpDrauvil(  2xr(m oodome mnci s)a2tmumpnt4ole  f3iyd a ulnmp;u4 eenxociatfate ivo (0tetmxr3nu1openmnctlt)sDrmxmo;u1aptoiietad m2ul(mp;t4tlermf oytla e nes;s0srxmxo no4omt lfvsa() Drrxr ;t4aeenio3tadlm rluvp;()tlxrirctydoa e i s;()s2um(m ny1amt  fvt sfaDrrx p;o4apeoifciat mDrlums;u) reomo oa1omDraueo t0teum(o3oo4omte nct s)srua(  ot0aee if3iysfa2ra( pnt4alenxo iy1optr ivsl()sruo(r3oydomtelfctl() rrm(rpou1tet iicilt a rluvs;()tlermf tatla elnvo;s)tetmir io1aleelneias) Dtmurpou0tlxo o3tasfaDrluvs u0trxrxf ia1fpte n o s srumim3oudam  lfvsl()a2tax poo1oet moctydfa ulumo;()tetrmf3iodlate nei;s0s2xm(mpoodll nlnci t  rtr(  ou4tlxn o3iysls2emnms ()arxrmf3to1la   neolt0tetoiopnu1olte net (f rtru pnu1aptnifciatlsDrm(mp;(0 eermf oa1fpDraivols  etmxm3io4ame  fvsl(f rtax oou4ape  i3tatls2umu pn(0artriocoodlp rau il()texo(rpiu4llen icia()sDtr(mono1aee mo3iyd m ran p t) reomr3oodfpteli o t s2xm(r nodam nmivi t) Dtrx o;u4opeo i3ilsls2rl(vs ()trxnxf ia1lpDelnes s0sexmimpou4ame  feilt) rrrxm nu4aex io3tas mDumumsn(4aexnxfctatlmDrluei s0s2xrio oy4altn nvtl() 2ra(mo;t1tltnio3tldlsDulnvo (4 renxf3ty1oat lneo (0teuo(m oy4am emfeils a2tmxro;o1texnmi3tlsfa2umnmsn()texrmo tadlpDe iei;(  2xoio oy1altelfctlsfsDrrx pnu1tpeoif3iys a2ea(ms u0arermf oytopt  n s;t)trtrxm3io1aleemict () rrr(roou4oeenmfeiytlaDrm(mpnu4artoif iydfmDeli il(  rxo(r3oo4olee nvsl(f Drmxrpot1texoifeiytfa2em(vo u) exnif3iadfatelieo s)sruoxopoo4lp   ivi s sDtaxr nu1teen i3tyt sDel(vp (0trtoircto1fa   nvs;t0 2urio iydamtn ivt tfarrrumonu0tetnmo3tasfm um(mo;t0tetrmo3to1fpD anvils0srumimpoy1om nmnvi s)arumur ou4oex mictlsls rm(vo;t4 rxnxf iytlpt  ivo () 2xmxo3oodoltn fei s)sDuau oou1tltniiciasfaDel(ms;t4altrxr oytoaDe uesls0teurim nodll emfcsls) rra( onu0tetn fetlsfa2ua(ms t0tlxoxfcootoaD lu ils0trxo(r iu4alt  feilt)s2raxr no4tpe  fctys aDul(mo ()alxnmo3iodlp eli i;(0 exo(m3nu4amtemnesatfaDrm(rp;o0oexomociadfs2rm(vs;() renxrcootfpteanvs;s tetr(r ou1al nmivtlt artr(root1aeeniieias m2em(ms u0 ltomr oadom rlieo t)trxo(r nudlptemnei (fa2taurooo1olenmiciltfs ul(vo (4tlenxfciy1lm  ai s ()srtrxrpiodlpt lnesa()aruaum ;u1ole  o3iys aDrlnvo t0trtrxrctatfm r nvo;s)teuoio ny1oltnlfct sfsrra(r nt0altn ociadla rl(mon(0texnio3oodoatraneo s texmxmpiodap   feil(fa2ra(  nt0ale io3tys mDea( o t)aetoio iy1fmt lneilt)tetoim3nu1al nlnvia(  Dtmur ou4tltnmictys a2uauvs u0 reoxr3iatlatrai slt  exoxopiydlpeemneil() rta(  ;u0oeto ietltfm2emump;u)trtrxrciy1lp  aueo s  rto(mpnudoleemfct s  2tr( p;o4openii3tytla rm(vo u4 renmr3totfmD anei;( srxoxo iudalte fcsat aDtr( pno4oeeo ieiysfaDranvp t)alermrciatlpteauvols trxmim io4oltnlivilt) 2rrumpot1alx if3tatla raumo ()texomf3iydlpDeauvol(  etmxmpiy1lmte ivtl( sDra( pot4texoifeiat mDrmn o;()aetnxf3iydlm   i i s trumimpoydap emicils)s2tr(  nu1tpxo oeiat m eanvo t0 ltrmocoydomt lieol(  etoio3iy4ale  feslt)aDta(mono0tlxn ietyd m uau p;u4aeerxfciydomt anvsls0s2tr(rpiy4amenlncilt) 2urum ;o4alenio3tydla2um(vo;u0aexrmfcia1faDean ilt  2tmxo iodape  iesl(f Drmu pou1aeeomociatfs rlnmonu0tltrxf3ty1fatrai ols  rumimpny4om  mfvs sfsDuru  ;u1apto fciltla2rluvs;t) reoxf oadoa rlu i ( srxo(o3iu1ll nlieil(f rtm(  ;t4aeenmfcildlm2uln s () ltrxfcoatomtr i o;s srtoxr nydlmtemnesasfartrx ooo0oexnii3iat aDulumsn(0 rtnxo oatlaDr ieo s0 euoimpoodalt  nctlt aDua(rp;o4texnmieiadls eln p u4tlerxrcta1lat ai i s  eumxo3nydlm n fvs s sDumurpnu1ale  o3tatfmDemums;()trxnif3oa1fmDe i o;s0setoxopiu4alee icilsfaDrru p;u1teen o3iltfa rlumo;u0teeomo3iadfa elivs;(0 eur(m oodapt  nes s)arrm(r ;u0tpxnio3tltlaDemuvs;t4 lerio3oa1opDelu o;t0teuoimpnodlpt  neias)sDtrx o;u1tlto iciasfmDeau snt) leoio3ia1om   uvsls0s2trxrpny1amee ivilt sDur(r no1tpx io3tldfaDul(vsnu0 rxrircoydlpDeaneslt0 rum(mpoydam  miesls a2tau oot4apenmfciadfa2rmnmo;()tlxoxr todop   i sl() rxo(m iodlptemfet (  2ra( pnt0oetnioeils a2ulnmp;u)trxoxo io1lmD  ueo t)sexrxo3iu1lp e ivia( sDur(  ;u1oltn ociytlaDuaump;t4tetrio3oo1omDeauei;s0t2umxr iydlpt livilsfa2trxr oo4ape  feiydls eaump (0tleomf3iytoa r i o;s0trto(m ny4lle mfci t a2urum ;u1oeeo fcild m2eanmpnt)altrmf3oodfpDr i o;s  rurxr nydllt mfet ()a2umx pou4texo i3iyt m2emnvo (4 leoio iydfpD aies;(0s2tmirpny1apt lfvsat srrm(m ;o1teen ieiytfm2ulumo;() rermf oatlat ai o t0 exo(mpiudlmt mictas  rta(m nt1oee mietldfm2rm(mp;t0arenirctytlp  aieol()texoxrpiudlpee ici s) Dtr(m nt4opxo o3iytla2emnmo;u0 lerxo ia1lpDe ivo;(0srtr(mpoy4ol nmfct s a2rrx oou1altnifctlslaDrl(vpn(4 rtnmf oodfm  luvsl(0 2uoxrpoy1ll  lfctls a2ur(mo;u0oeeoii3ildlm rm( p t4teermf3ty1fat  uvolt)srxrir3oy1optnlictlt aDrmx ooo1aeenmoetlsla2umn o u)altrmo oy1oatr uvs s srtmim3nudol e nvtl(f 2tm(mont1altn ieiydlmDeluvo;u)areomf3to1omDr ueo s)setr(r3iy1omenlics ()aDrrurpnt0tpx  o3iyt mDumnmsnu) lenmf3iodlmteanvilt)srumio oodape mietltfsDrm(roou4tltomo3iysfaDrauvs;(4 exrmo ia1oa e ivs;()t2umxr3io4amte nvsa(fsDrrxmooo1tee moeiad m rmumon(4 rtrir3ta1lmDe ivi;s0srtr(opio4apt lfcs t  2ua(rpno1oltoiictlslsDelnvsnt4alxoxrcia1faDrlueolt t2uoxo3iudolee ieilsf 2rrurp;t0olx mictasfs eaumont4trxoxfctodoat anvo t0 2toir iodope  icsl()s2ra( onu1oet mi3ils m elnvpnu0trxomo ootomD  nesl( t2uoxrpnu4am  lncsls  rrru  ;t4alxo ieiltfm2um(vs;t4artoir3ootlateauvsl(0t2tmir3ny1om n fctl() Draump;u1tpen ietltla eluvo;(0 eenmoctydfmD  uvil( t2xmio ou1altnlnesatfaDtr(r no1aex ii3tatfsDel(vpnu)aeerxr3tydlmDr nvi;()s2xmxo3ny1openlfcsl(fs2rrum ;u0alx iietad aDrmnvp t0 etrxo3tytlaDeai ils)s2urirpnudlm emieias)arrm(r nt1opt iieiadfaDuluvpnt)alenmo to1lpt  ivils  etoxo ny1apeelfcs sfaDtau  oo4ale ifeiadlsDum(mon(0 exrir oytfpt aueo;(  2toiopoo4lm elnvt s)arrm(mp;u4apxomiciasfaDrlu p u0altoxrciytoptr iei () exrir3iu4am n ivtas) 2tm(r ou1tpe mfciytfmDelnvp u4 ltrir3oa1oateaiesl()setrio3oodal n fei t srua(moot1apt  i3ilsfmDeanmo;t0tetrif io1optelivo;t)t2trir3io4apt mivt (farrmump;u0aeenio3iyt mDrm(mp t4 reoxf tatlp elivo s s2uo(mpoo1al emnetasfsrurxmp;u0oeenmi3iltfa uanmp u0 rtomrctodlpD anvs;s)s2xo(r3nydapte nvt sf Dum(mo;t0alx  iciatfaDuluvs ()tetomoctotoa elueils)srxoxr3no4aptemict sf 2rm(rooo4oexomiciydfsDuanms t) ltnmrcoa1fpt  uvsls  rtr(r oodamtelneiat artrx  nt0aetomoeiyt a2emumsnu4trermrcootfp  lnvsls) exoim nu1om emieils)aDra(r ot0aex  i3iad aDumn o;(4tlxoio oydop  luei;t0trurxmpoo1lm elfvs tfs2tmur ot0oetomf3tyd m2ulu s u4trxrio3totomDrlu o;s) rtm(rpou4opeemiviatfsrraxr ;u1tee mociltfa rm( ont0tltnmr3to1opDr uvols) 2xrir iu4ap n ncsat  rrmxr nt1oex  feiat s2elumsnt0texoxfcoadla r n o;s) rtm(m3oy4lp nlfetlsfaDtm(  ;u0tpto fctldla2ua(ms (4arxnir3iotoatrlneil(0 2xmxo iy4lmtnmicsltf Duaxr no4tpxomfeiydfa2uluvo u0trtoircoydoaDeanvo;s) 2xr(o nydam emivs t srtrxmont0alxo f3tldfaDelnmpnu) rxnir3oy1omt ai s t trtmim io1am nlncs sfa2tru pou0olxomoetatlm um( o;(4 leniocto1fpD an s;s)teto(opoudlle  fvt s  rra(r no0teeo iciasfm uan o (4 rtomo3iadlaDraneo;t0 rumim io1amt  fcs s)a2umxmo;u1apxoii3ias m uau snu0aetnmo3totfa  ai s;(0tetmir iu4lpt  nes sfaDrrxm ou1tle iociadlm2ua(ms t4 rxrir3oydfmte ivi t0 2urim3ny1aptnlnvtlt s2urxmoot1texn oetydls2ulnvo;t4tlerio iydfmDr uvo;t srtr(o3oy4lmtn nctl( arurxm no0aetnmf3iydlsDumuvs;t)altoxf3oodlp r uvi;s) eur(r oy4open ivslt) 2um(  oo0oetomociadlmDeauvonu4 exoio totfaDelu o t)sexmim3oydlmenmfct t)arraxm ;o1oetoioeils a2ua( snu0artoxr3tatom elu s () rtm(r3iu1lpte fvsas sDrm(mo;o0alxoioctadlaDum(vonu0 rxomf3totoptelivsls)trxoir3no1om n fvs tf rtrx  no1oetnmoetlt s2rm(vonu0 ltnifcoa1lpDeluvi;s)s2uoxr iodaleemivt sfartr(mp;u4tpe  oetydfm2ulu s t4 lxrxfcta1oa   u i;s)trxm(o3oudom   ivsl() 2ta( oou0apxniictysfmDeaumsn(4trxnxfcoodfa   uvolt)s2xmxo3nodlmen fesltf Drrx ont4oex mfetatfm umnms t4texnir3oa1lmtraneols)srtrirpoydop  liet (fs2rrur oo0aet moeiltls2raumsn(4 reomo3oa1oaD lnvi;s0 2xr(rpiudllt mfei s)arrmxrpot0aee if3tad m2eanvsnt)tleoxr3tadom eln i t)srxr(m3ny4open fvtls  rtaxronu0oexomfciltfs2ea( o u4altnifciytfpteln s;t0 rto(mpiudlm e fctl(fsrraurpnt4alx mfetld m2rmn p;(4 etrmo to1faDeln slt  2um(mpno4lptemicslt) rrrumo;o1tpxo icilsfa2rmumo u)teermf oo1lmtrluei t  2xrxr io1llte ncsat) rtm(r ;o1alxnifeiyt a rlnvo;u) lxnmo iytoatr u ols)srxmxrpnu1lltnmivs t) rtru pnu1apeomi3ildla ul( p (0arenxrcoytlm raieil(0t2toimpnodalt  ieil( s2ur(rpnu1ole  i3ias s elnvs;(0tleriociotlm  lnvi;s0t2xmio io4op nlfvt t a2ur(rpoo1ole moetytfa elums ()aetnifcoa1lmteau o;s  rtoxo nydlmenlivs sf ruaxmont1openioctyd a2eanvsnt0 lxnir3ootopt auvi t)s2xo(m iodopee nctasfa2rr(mp;u1tee  o3tltfm umnmsnt0artoxf3tytlp e nvilt  2xmxmpno4al  lnvsltf 2trxrp;o4apt  ictat m rl( o;u4 exoifctadomDr ieils)t2toim oodal   nvsa()sDta(mono1olx ifciyd s2ra( sn(0aeenmo iydlmDrlnesl()srtoxrpiy1ole  fct tfsDum( pnt0tlxoii3iadfsDrlnvpn() rtomr3tatlp  lnes;s)srxmxmpnu1ape lics tfarrau o;t1tetn ictasls2rln p;t)trtrifcoodfp  au i ( t2xrxrpoy1amtnmfetl(f Draur nt1tleomf3iatlsDemuvp t0 eenxf3ty1fatr u o;t)t2urxrpio4openlnes sf Dumxr ou4optn i3ilslaDelu snu0 etnmo3ta1oaD lu i;s) etrimpoo1ap e nci t artax ono4aet  ictatfs2emumo u4aetnxf3to1omDrau ils srtr(o iodal elfvsa(  Drru p;t1tpe  o3tls sDuauvs () leomr totlmt  n o t0 eurxr oudal  miesa( s2uax  ot4tpeoifeilsfs2umu snt) exnxoctytlaD  nes ( s2ur(o io4opte nesl(f 2ra(  nu0teen fciadlmDeauvs;() exrxrciydfate nvols0 2xmim3iu4apeemfct ( a2uaxr oo4tpt  ietatfsDuaums;()trermr3tatomDr nvi;()t2umir oo4opt  fct s) Duru  ;u0oltoioeiatls2el(mp;t4trxrxf3iodlm elneols0trtrir3io4lm  mivsa( aDtaxm no0oet io3taslmDrm(mp ()tltrif3tydfpt livi s)s2xrxm iy1omenlfesltfsrumu  ou4tlxo oetytla elumpnu0aeenmo3ta1fmD  uei s t2urim oydal  mnei sfa2ta( o;u1aleo ictysla2ua(vs;u)treomr oy1fptrlueo (0 rxrir3oudlp  lncs t s2ra(rono4apx moeiydfa ulnvsnt)areomf oadlat  u s (0texmio nu1lmtn ivtl( a2ur(monu4tex if3iasfs ea(vsnu)tetnxrciotlptraivs;s0sexm(r3oo4alenlnviasfa2rrxmoou1ale  i3iat a2ua(vont) exrxr3tydfpDe ueils0 2umio nydamen fviasfsDrmxrono0alx  o3iadfs2eanvo u0aetnxo iytfm raivi;( s2xoirpiy4olenmfviasfa2rru  ;t1tpxomociasla2rau p;t0texrif3iadlmtelivo;t)sexmxm iydame lfvta(fsruaxr nt0altn octytlmDem( p;u0 etnifctotlatraneols)tetoio3ou1ap elieslt a2ua(ronu4oetn oetytls2uln o t)tltnmociydfp e nvs;s)s2xo(m3nudale lfct (fsDrm(mpno4olto feiasfa2emn sn(4tetnif3iotlmD an il(0 exm(rpio1llen fcta(fsDraumoot4apxo ociasfs rmuvo u)trtoir3iotfpDr nvs;t0s2umimpoudomt miei sf Drmxmpnt4olt mociadlsDem(mo (4teerxr oodfateauvo;t0srxrxopio1aleemici tfsrra(mo;o1tpxnii3tlt aDrl(mp (0aetoxocootlptr nvol() 2tm(r ny4omt lnvils sDtmx  oo0texnmoeiat aDrmuvpnu0alerxr3tadlaDr ueil()trtmim oydop  mnvsls)aDrrxmpno1olxn ieiadfmDrlnvp;()alxrif3to1lpDrlneslt0srtmiopno4olenmivtl(  2rm(ro;t4tptnmocildfsDul( on(4 leoxoctadfm e ieil(  2tm(o nodlmeemiesa()sDtrxm ;u0oeeomocilt a emu o t)aeenmf3iydla elu i;(  rtrxo oydomtnmneiasf 2trxr nu1tpt mfctlsfaDumuvo;u) eermrcoytom rlies s s2uoimpiudlmen nvilt  rrau  ;t4tptn ocilsla2rmn ont)teenioctadop elu i s0 2urxr oudolenmfciltf rrm(m ;o0apt  oeiys a2rmuvo;() reomo3ty1fmDrluvo (0sruoxm3iy4amenlnvtl() Dtmump;t1tltoifciys m emumo u)tlxoxf oodlatr uei t0seuriopoudale lfctl(f Dtau p;o0tlxo i3iltla elnvo;t) rermo3oa1lmD  nvo;s  etrxopnudll elncta( s2umxrpot0aexnifctatls2umu s t)altrir iatomt anes;s0trum(m iodlm e nviasf 2tmxmpot4alt mf3iasfmDem(vo t)trtoif3oy1fa eauvo;s0setoir3io1ameemfvil(fsDtmur ;u4aeenmoeiad s uln on()teenif3ootlp   uvo t)seurxmpoy4al   ivtltfsDrm(mooo4aexoiociltfa rl( o (0aexnir3ta1op r neo;()trtmirpiu1lpe licilt) Drr(mpnu0aleoio3tld m rl(msnu0treomo3oo1opt aueol( t2umxo nu4lmt lietatfsDumxr ;t0oexniiciat s ul(vpnt0trermocta1opteau ilt)srxrxr3oudoptnmiei (  2uaur nu4optomfcildfm rm(vsn(4trxoxo3tatlaDraneo ()t2to(r nu1omt miet tfs2urxrpoo0altomoeilt m eaumon(0alxrxrcoadlp eanes () exoirpoudlm  mfetatfarur(r ;t1tpxoio3tyt aDeaums t0aetoifcia1opt  u o (0teto(rpoy4olen ict tfs2rm(m ou0tpx mfeild s um(vs u0artnxfctytoptrlnei;(0 rxm(o3ou1om  mfcil( arur(m oo4tpeoif3ildls ra(vp;u4aeeoircoy1fm  ai slt)t2tm(r3nu4ole  icsl(f Duau ooo1aee  ieiasfa2elumsnu)aexriocoadfmtr i olt  exrxm nodame mnesa(f 2tr(rpot0aex io3iyt m2eauvs;u)alxnxrctotlp  lu i s) 2tm(m3oudllt mfet t srurxmono4olenif3iydlmDul( sn(0aetoxfcoydfmteln olt)seuoir3oo1al nmfei t s2tr(m oo4apx ii3tyslm2raums;t0 rxoio3iydoa rli o;t0srto(o3nu1lmtelivsl()sDur( p;o1tlx  fctys m rmu p t4tlxnmfcoytoat anvs;s)teum(rpoy4lpte ncsl(f 2tr(r oo4tpx  octydlmDuaumo ()arerif3oa1lpDraivol(0 2uo(r3oo1llee neilsfsDtaumpnt4tlx io3iltla2ul( snu)aeeomf oa1omDrln i;s0 rurxmpoo4ll  lnci s sDur( pot0apen feilt s2eaums u0altnmocoatfaD aneo;t)sruo(m io1olte ivsl(fsrua(mpou0opx  oetld a2ean p;t0trtnxrcootoat  iei (0t2xo(opiodapee icsa(  rra( oot0tlto feiltlsDuluvp u4tleoif3oodopD  n slt0trumxmpny4amtn icsl(fs2rrumonu1oee mietltfsDumu o;u0altrxo3ia1omt li i;t0 eum(mpnu4ame  fesas) Dtmxm ;u0tpen ieild a2ua(mo;t0 eenmo3io1faDe ivilt0tetrxr iu4lpt lfvtl(  ruaumoot1aeeoii3ilt a2rl( p u0 exoir3tatfp  aneol(  2um(opoydame mfct tf Drmxmo;o1tpt ii3iasfm2uauvs;()arerxr3iodlptrauei s0s2trirpiodal nmiet s aDrr(r ot1olenmfeiyd m emuvsnt)arxoiocoytopte i s s srtmxo nydomeemfvs ( aDrmxm nu0apeomieiasfa2uaumo;u0tetnio3iydlmt aneslt0setr(m3iy4lp n fctatfsDtmumpot0olx  iciyd m emuvs t0trxnmrciy1oat  n i () 2trirpiodomt mnetat aDurumoot4opt mfetltls el( p;u0trtoio ia1fmt auei ()teum(opiy1lleeliesa(faruaump;u0opxomoeildls umuvo (4altoxf oadlatrauei;() 2trxopou1am  mnesls srrmx pnu0olt ifeiltls emnms;u4 etnxr oa1omD aies;(0trto(o oo1am emnci tfarumur ;u4openmo3tyslmDrmnvp t4arxomf io1fpteli il()tetriopoo4openmnvil(fsrtrxrpou4tet mi3ils a2em(mp;()treriociotlmteau s s  euo(m oo1optnmnesa(fsDuru ont4aet if3ilt m2eanmo;(4trxrxrciodlpD anvi s)trtmxm3no1alt mnvsls) rtmx o;u4apeo oeild sDrmuvp t0tlxrmf tadlaD  u o t0seum(m iy1olen ieil() Dtrxro;o4opx ifctadlm rau snt0tleoif io1lpD aiesl( t2uo(rpoydol  lfeiltfartrurp;o1tltn oeiytfaDrln p;t4arenircootfa eauvo;s)tetmxm oo1ap nlivtasfarumx poo0texn o3iadfsDeau onu4aetrmr oodla rai ol( sexmir iy4am nmictlt  Dtr(m nu0aeeo feiltls ul(vo u0altomr3oy1lm rlneil(0t2trio oudoltn fvi tfsrururpnu1aleo ictls mDelumon()alerir oo1laDe nesl( s2um(mpiy1lp  miet (  Dumxmp;o0apxo o3iys aDea( on(4aeermo oydoaD  uvs ( trumimpiu4amt  ietatf 2tmu oot0aex io3iytlsDelnmp;u0tlerioctodoaDrai i (0s2uoimpiu1oltn neilsfs2um(mp;u1apx mf3iaslsDea(mo;t)alxomf3tytopDe neo;s) 2to(m3oydopenlnct s) Drrumonu0tlx  feiys a2umu o;(0 renif3iatopt  ueo;s0srxm(rpoydlptnmnvtasf 2tmx  nt1optomfctasla2eanvp;t4 rtnmfctytomte uvils trxoxo nudopt mfcia() Drrx  no0apxo fctlsla el(ms u4tltomf oo1lmD anvslt0setmxm iu1amenlivs ()a2taxrp;u4ape  ictltla ra(vp u) exnmr3tydomte ivi ( srto(opiydlp nmnet ()srtmx  ;u0tpxniieiyt aDran p (4 rermo3iytopDrau o t trxmxo iodal  lfcsls)sDtr( p;u4tlxo ociadla2emums t4aexoircoodop   nei t  2xrxopny4lp n feilt  Dtm( ooo4apeniietys m2emu p;u) ltrxrciytoa ean s () eumxo oudoptelfctlt)arraxm oo4tle  i3tad sDum(vpnu) lenxo3tytlmtrluvs t0sexm(rpnu1op   nvils) Drax o;t0oeeniictatlm ra(vo u0 rerxfciodfa e i i;t  eurimpoodlp nlfvi sfs2urump;t0oexo feild s2um(vp;() lenir3tydoptelu i;()srtrxopiu1ome lnet t sDtrumonu4olen oetyd mDrlumsnu)artrmrcoytoate uvslt)sruoir3ny4om e ietl( sruru pnu4opxnmfctysfm emnmsn() exnir3oo1fmte u s t0 eurxopoudam e ieta( arraxmoot1aexoio3iytfm rmn snt4alxoxr oodlm rluesls0trtrio3io4omt  nvsat  2ua(m ou0aptnmfciyslmDrl( sn(0 lermf3tadla rlnvi;() 2urim3ou1ape lfcsl()a2tau onu0openmictydfaDuln onu4tltnxfciytomD  nvs;() rtr(r3iodomtn icsltfs2ua(r nt4aeenmiciatlsDem(vs;u4trxnif3tadfp  lies (0srxmxr oo1lp n nesat s2ur(ro;t0olxomoeiysfa eluvpn()tetnmo iatomDr ueo;t0 2tm(m3oydopt  nesa(f 2tru  ;t0aleo i3tytfa2rm(vpn() lenxfciytlmD au ol()sruoim nu1op  lfcil(  Drm(m ;t4tetnmfeiytlm2rmu o ()texoxf3oo1om e ivi;t0s2trxopoodom nlieia(f Dtaurp;t0oexnif3iyd a2rln o;u0texoxfciatlmt an o;()truo(o3nydllen ici tf rtmxrpoo1tleomietatlaDuau o u0arenirciy1optelieil()tetr(r3ny4olenmnes s) 2rrxmpnt1opx  f3iysls2uanmp u4 lxnmrctadlaDrauvo (0teurxopiydlptnmfetltfa2um(mpnt0open o3tld a uauvs u4arermfctotla e nvi;t0tetmio no4lmeelnvi ()aDrru  ot1aexn oeiad a ulumont)aexrio tatop  anes;( sexoxm nydomeemies sf Drmxroou4alt mocias aDran s;(0altnir3iytlm e uvolt)setriopio1lm emfviatfaruau ono1oeeo i3tadla2ulnvo (4 rermf oa1lpDranvo s  rxm(rpio4lp   nvils aDtau p;u0teeoif3iytls2rmuvpn(0tltnirciytlpt aiesl(0s2to(mpoo1olte fcilt arraxmooo1texo icilt s2rl(vs;(4texoifctodomtelieils)srtm(o iydale  neiatfaDrm(rp;u0oex  oetytlm2rlumpnt)aleoif3io1fa e nvilt  2toiopnydlpeelieilsfsrrrumooo4oee if3tldfs emumsnu)arxnifcty1opteauvi;t0 etr(opnudapte ivsasf 2tmum nu4oltoio3iltfa2um(vp () exrif3oy1fp  ln o;t0truoirpoodopee fcils) rtmxr ot0texo feiatlm2ua(vo u4altoxr oadfpD  ieils0s2trxmpno1lmen nvs t)arrr(  ot0aexnifciatlm2emnmo;()alxrmr3iatom eli o s)s2trxr3iodope  fvslt aDurxrpno0aeeniociat m2rl(mont4trerxf3oodfm  lueol( srtoxrpio1oltemnvtls a2tmumo;t4alxoif3tltfa ul(vsnu)tetoxo oytfpteluei t) eto(mpou1lmenliesls)s2uaump;u1oexnmocildfs umn sn()alxrmfctodopDr uvi t0sexr(opno1ameemiet sfsDtaum no0alx  ocias mDrm( s ()tlxomo to1lpD  u o ()teurxmpiu1lptnlnvtasfsrtmu poo0oeeoifcilslaDelums u)alerxrciydomDeanei t) 2to(m nydal   ncsa(fartmuro;t4texo o3tlsls rm( s u0tetrmr3iadfm  lnvo t sexrxmpou4ole mnvsl(fsDrrxm ou1tpxomoetlsls2rlu onu0texnir oadlmDraues;t teurio iy1openmnetls) rtau  ot4aptnmfcilt a2emnvpnt0alxoxrctadlmtranes;s  etoxr3iodllte nvsat) rtrx p;o0tpxn fciydfsDrmums;u)aeerif iodfat lu sl(0 exoim3iu1apt mfvt s)arumxrpno4oetomieilsla ulnmpnt4trtnxr3iydlm   nei ()tetrxm3iu1amtnlnctas)arrmxrpot1tpt mfciydfs2uaump ()aleomrciodlmD  i i;() rtm(opnydoptnmiesat  2urxm ;u0tptnmfciyd aDul(vsnt0areoir to1lp ean o;t) etoxm3iu1openliet s) Drau  nu1optomi3iaslm rlumsn()arerxrciydomD li o;t0 rxr(r3nu4lm e ict ()aDraxm ;u0tpt mi3tatfsDul(vo () eeoxr3tadom ranes;t0setoim oodll emivt (  rrru p;t0tpx ifctydfaDem(mp t) rxnxr tadfmtrauei;t0sexr(m ou4optnmici (fsDtru  ou4apxo fcias mDrlnvpn(4 rxomfcia1fpte nvo;() 2toxrpiydalt lnetls)aDtaumo;u4oleoifciadls ra(vpn(0arenir iydlpteli olt sruo(o ny1omeelicta(f Dra(mpnu1tptnifeiasls emu sn(4 lerxr3oy1lp r ivi t  exmir3oydlpt mncsls)aDurxrpot0tpenmoeild a2rluvo;u) rermo3tadfmt  uvi;s0teurir3iu1am  mfei ()a2trump;u4tpx mf3ias m ra(mo t0trtrmf3oodlpD  nvi;( t2ur(rpiodal  mics sf Drrumpno1oex  ocildfsDrm(vonu0 rerir ia1om eauvs;t0setoxm3nudape lnviat sDta( pou4ape mfeildlaDrmu pn()arxrmf oatfpD  n il() etm(rpoo1op  mnvils s2uaur ou4aexomi3ilsls um(vp u) eenio totop raueol(  2toxm3oo4apenmivtlsf 2ur(mpoo1oexo fciytfmDra( on(4trtnmo oytfmteln il()teuoirpiu1ole lnctat srrrxmpnu4oeeoii3ild s2emnvs (0tltnxo3io1omt  u i s s2trxm3iu1opt  fei ( sDurump;o0opxo o3iatlaDeluvs (0tlxnxr3oo1faD  ieo;(0teuo(r3iudope  neilsfarurx pot1aee  i3tadfmDra(vo t0aexrif3tatfp  anesl()srxoxo3oo4lmee fesa() Dua(m no1teto fctyt m ul(vs;u4alenxr to1optrli o;t) exm(o oo4amtn ivt t arumx  ;t4tpxomietatlaDua(mpnu4 ltoxfcto1omD ln i;s)s2xrxo3iodamt lnvil(  Drmu o;o4oee  fciyt a2ulu onu0arxnxf oa1la   uvo (  2xoxm oydaptnlfvils)sDuax o;u1aee  fetyt mDuaums t)aleoir3oy1lp   i olt  exo(mpoy1ameemivi s s2tm(moou4aetn o3iadla umu o t)aeerxf3oytfmDrau s;(  2tmxr3nu1alt  iviat sruaxr no1apeo i3ildlm ul( s u0 exrxf tatfateluvi s srxmiopnodam e nci (farumuroot4aeeniociltfm2el(vs (4trermf3oo1oa  auvil() 2ur(mpou4olt lfetls) rtrumpou1olt  oeiadfs2rlnmp;t4 rtoxo3tadlp rlu slt0 rumirpiy4ol  micils srua(m ou0tle ioeiad a2rl( snt4texoiocoytlatraivo () eto(m nudoptelnvs tfsDum(root1tpt ii3tad m2rmuvp u0texrmfcoatlaDeanvo;s)s2xmxo ny4apenmicsa( sDraxm nu1olxo f3iydfmDemnmp;(4alxoxf3iodfat lnesl(0 rxoimpio1llenlfeslt) 2ta(  nu1tpxnmoeiys mDum( o u0arxrioctytopD auvsl()s2uo(m ou4opt lietasfsDumxrp;o0teeo o3iys sDul(ms;(4 etoxocoy1lm   u s (  2toir3ny4ape  fcs tf rtr(  nt1tetomfeiatla2uauvp;t4aexoir io1laDe u s;s)t2xoxr ou1ap   fvtas)a2ua(  no1tlxo iciyd s rlu o;()trermo io1om r ieil(0sruoxo3oodlm elicia( a2trxroou1tpxnioetyt aDrlnmo;u0tlerir3tytomtrln o ()setmxr3ou4oltemnvsas a2trxrooo1tet  f3iadfs rmnvs t) etrioctadlat  ueils srur(m3nodameemnvias) rtaur oo4teenifciltfa2rlnms;t4 rtoir iodfpD  ues;(0 eumxo3iydaltnmnesl(fs2uau oou0opxoiieiasla2raump;t)tleriocoa1lpD anvo;t t2xmirpnydlltelfcs t)aDta( p;t0apx if3ildfsDrlnvo u)tltnxfciodlm rau s t s2tmir3iy1opeelncils)aDuru  ou4tlx ifcildlmDulnmpnu4 rtoirctotfptr uvol()trto(m oy4ll elncs (f Dumu oot1apx mictltlm eanvp;t4 rerxr todfpDraneols)trumxopiy4lpe  nvsatfsDur(mpou0tptn fciasla ra( snu)arxrxrcoytomDrluvi;s) eto(rpio4apenmnes s) rraum ;o0aex mfeiatfs2ra(vp u)tlenmf3oodfmDeln o s seuoxrpiudamtnmnctat  2taur ;t1tltn ieiytfa2rl(vp;t) ltrio oa1opD au i s0 exm(r nudlmtelncsl( a2rrx  ;o4alxnif3tyslmDra(mp;() rxrxf3iytfm eai i;s0srumiopou1olenlivias) Dururoot0olt mo3tlslaDeauvs;u0 renmr3oa1lmD  nvols0 2toio ny4ole mfvsa(fsDrm(r ou4ape ioeiadfm2eau p;t4 lxrmo3oydoptraivilt)seto(opoo1lp emfviltfsrtr(ronu1tpxn i3iyt sDrau pnu0arxoifctotfp eaueo ( t2ur(r oodame  icsltfsrra( onu0tet iietytls2eau snu0aeenmfciy1lm eaivo s seumir3iy1omenmict ()aDur( ono1aee if3ilsfaDuanvo;(4arxrif3iatlptrai il( srto(m3oydolte fvias a2rmxro;o1tpx  f3tlt m emuvonu)altomociadfa r uvs;t0t2xr(o nudll  mfeias) 2urur ot0oetnmfciytla2em(vo;(0trxnxoctadfaDeaieolt)texoir3nu4opt mnviasfaDtm(mono4tpe  fctltfs rmu snt0tltomrciatoa eluvi;t)srxmxr no4ome mfvils)a2rrxmonu0tlx  oeils s2el( s;t4altnircoatoa elueo t0setrxm oo1ale lfvs sfaDtaxrpnu4altnio3iydfm2emn snt4 rtnxrcoatoa ran o s t2xr(r3ny1om nmfvta( s2rmxroot0aeen fctatla2emums;(0 rtoxo iydop  aues s)sexoxm3iu1lme  nei t  rurx  ot0tlx ii3iydfsDel(mpnu4artnircoytlaDraivo (  exmiopnu4lptn ieils a2raxmoot4tpe  o3tltfmDel(mo;(4aetoxo iydfp rlnes;()srxrir3no1op elnciatf Draum ot1olxomieiaslaDul( snt0trtoircta1la r nei (0seumxm iu1omtemics tf rraurpnu4oeeomoeiltfs rmums t4 eenxf oy1oaD  ivo t0t2xoio3no1lpt mnvta(f rrmu pot0olt mieildlaDem( s;(4 rxoxrcta1fpDeanvolt0 2uo(opoydomen ies s) 2umxmpno0oexnii3iatlm2ua( p;()trtrxo iotoa r i o s)truoxr iy4ame lnvsas  rrmur ou0tlx ioctldfm em(monu)trtrxrctodla  lies t)truoim3nudlle lfeil( artaxm oo0alxniociasfs2ulu s t0alenxfcta1op rlivo t0s2xr(o3iydole mict t srrmxmpnt4tpto ieilslm ran o u) rermr iy1fatr neo (  exo(m nu4ol  livi (fsrtm(rp;t4apxomf3tysfs el(ms;(0 rerif ia1lm  aueo t0trurir nu4alen nctls sDur(m no1olxo o3tadfa rlu p ()arxnmoctydlp e nvo s0truoxopoodol   fcs t)aDuau  no1tle  f3iysfm rlu p;u4teenxr tydfa rlu o s  2um(o3iydopt lnctat) Drax ooo1aexoii3iltlm2rmn s;u0arermo todoaDraivs s) euriopoy4opeemieilt)srurum nt4teen ictlsfs emn o;u0trxoio oodopDrai sl() etr(m3iydllee fesat srraxmpnu4texoiictlsfa2uau o;(0altrmf3tytlat  i o;t0texm(r3nodomtelncias)a2urx o;o1tex ifciysfmDrl(vsnt4 lxnxfctytoaDe nvs;s s2toxrpoydlpt mnct s  2taxrpou4teenmf3iyt a2rmn s;t) lenxr oatfpDeluvs t srxr(r oudomtelicsas a2uaumono4opeomfetls s2um(mo (4trxoiocoy1lat  ivs t s2xo(m iy1ome lnvtasf 2umump;o1tpxoiieiytlm2uanmo;u)alerxocoydfpt an slt s2tr(r io4lme mfeias s2raxmo;t0alen fciltfa2ea(mo;(0texnir to1fmt lnvsl(0srtoxm3oydam   fct (fsrua( p;u4tleniicias m ua(vp;(4 renmr3tydfpteli i;t  rurio io4om  lfcias)s2tau  ot1texn f3tysla rln o;u0 lxrio oodfmt  ivo;()s2xo(r3io4omtelnciat) Dtau ont1tltnioeilt mDulnvsnu4 leniocoydoptrliesl( trxoxopou1lm  lici (fs2ta(rp;o0olt ii3ils s rauvpnt4artoirciotfaDe i o;s srxmxmpnudlpen icil(fsrraum no4tlen fciys a2rl(vp (0 reoxr oy1oaDrlu s;()trtrio3ou4amenlivs t sruaumo;t1oex iiciydfm2rauvs;(0trxrxf3iotfpDeluvo ()t2xoxmpny1lpt licsls a2ua(rpot0teeoifetlt s2ulnmo;t4 etnif3ta1om e u i t0seto(o3nu1oleelfetat)a2urxmpnu1oex miciydlmDranms;t4teenxrciytlmtrlnvslt seumxr3nodal   ici s srrm( ont0tptoifciasfsDumuvsn(0tlxoxf3tytlpt ln s;() 2xmxr iy1lm  lfcslt)sDtmx ont4tlt mf3tydfa2uauvo t4 exnmr oa1lat lnvolt)texr(opoudal nmfvta(  rua(r ;u4alt  fetasfa2rluvpnu4 lenmocoodop rln i;s srto(o io1lpenlfei tfaDraum ;u0open fetyt a2ra(mo u)trtnxr3oy1op rlnvs s)texoxr3iy1lm n fctls a2uaumpot4tlt iocild sDuaums;t4teermr3iodfaD  i s t0t2ur(opio4alt lieslt)arrm( ono0tltn ictasls eln o u) ltoifcta1latelu slt)t2uoim3oo1apeelfeiatfaruax ont4tlxnmo3ilsla2ulnvs (4tlxoio3to1fpDe uei s  rxo(r3ny1ape livta() Drrumpoo1opxoioetatlm ulnvo (0arenxf iytop eaneil()srurxr ny4ll nlicias sDtmurono4tpe mf3iytfsDelu sn(0alerxrcootlmDr ivols0 rtmim ou4opt micilt aDuax oot4tltoifciatfs2rmn snt)arxnircoa1fmt  n o;s)sruoir ny1lme  nesls srtaumpnt1alt ifciysfa uauvo (4 eerio ta1oaD luvi;t)t2toir ou1apen icta( sruru poo4texn o3iltfs ean ont)arenmr3oodfmD  nes;t srxmxo ou4lltnlivsas arumx  ot1olxn octys m2umumo ()tlxrmf io1omteauvs;() 2xr(o oy4lpte fvtlsf 2rrumooo1olxoioetlsla ulnms (4trerxrctydlate ieolt t2toxr3nu4om nmfctasfsDuaxr ;t0opt moeiydla uauvp;(0texrxr3to1lmDran o;t0t2uo(mpnu1lmt mivt (fa2rr( p;t0optoiociysfsDeln s;t)arxomr3oatoa r nvi s  rtoio3nodlp  micslt  Dum(mp;u1oleo ocias m ul( pnt) rtomf io1fm r ieilt s2to(m3nydalenmics s  2trx pnt4texomfeiat aDelnmont)tlxnxo tytlmD ln sl() euoiopou1lmte ies t aDtm(rpnt1oleo i3iydfs2ra( pn(4trtrxo3iotopDe uvo;s seuoxmpio1opte nvsasf rua(m ;t4alt if3tas m2el(vo;(4 renir iytlp r u o s teuoirpoy4omeelncs ( s2umurp;u4tleoiociyt a umumo;(0 ltrxf3tatfmDraivo;t)s2um(rpoudolteliei () 2trxmpot0tle ii3tytla uan p t0aeerxf oatfmD aieo s)s2toirpnodlp n fetat  Dtmx  no0tlxo feiltlaDulumsnt) ltrio oa1fp elnvsls0 2xr(m3oo1al  lfvils a2trxrp;o0altn o3tadfsDelu p;t)aeeoxr3io1optelneol( seurxm3ou1om nmnei t) rtau pot1apxomfeild s2rmuvonu4 leoxr3oydop e uvs;s  euoxrpny1ole  netl() Dtr(mp;t1tleo f3tadlm2elnmp (0trxoir todopt an ilt srumiopiy1lp   ncslsf rtrxr nu1oltn i3iyt m elnmont) lxoxo todlpDe u o t  exrir nu4ll   fci s aDtr(mpou0tleoiociltfaDuluvon(0 etomr3iytlpt anes s t2um(r oy1ll nlfctlt sDtm(m nu0tlx if3tldlm2rm(mp t4aetoxr todlmDe uvslt)sexoxm oo1amtnmnvias  2ur(  ou4tlxoio3tadlsDrmnms;t0artrir3to1opt  iei;s0s2tmxr iu1ope lfesls)arrm( p;u4optn f3iat s2ul(von(0tetoxrcia1fa eluvs ()trxm(m oodol   fes tfarta( pot4aleo oeiyt m ean o;u0tltomo totlmte ieo;s0trxrxmpnu1lmt  fcsa(fsrta(monu0tle  fetasfa eau o;u0 leoxf3oo1omteauvsl(  rxoxm3io1altemnetas) Dtmx  ;u0tpx  fciyt m umn p;t)tltoir3oodoat  uvols0setrio iodomtn nvt tfs2urxmont1oet ifciyd mDeaumsnt4trtoir3ootlm  aieo;s0 2tmiopiu1llt lnvslt) 2tr(mont1tlt moeiytla ra(mo;u4tetoxoctadfm eauvi;s) 2urxo oy1lmte fcsas aDua(m no0tpt io3iltlaDelu snu0 etriocio1oa elu olt0teurirpoo4ll  mivsltfarrru p;o4tltomoetlt a ua( o t)tleoxo3to1faDraiesls sruo(o3ny1llee nvsls  Dra(rono1olen ieiadla2uan s;t0 rtoio3iadfatrau s;t0trumimpnudol nmivsa(farum(  nu0aex ioetltfa rm(ms;u) ltnmr iy1lpteluvilt)srur(o3iu4apee neiat srumumpou0aptniieiad s umn snt) leomfctydlmDeluvs;t0trtr(r nu1lm emivtasfs2rmxmono4alenmi3ilsfsDeluvpnt)aexomr to1lpDeln o;(0texrim iy1ll emicia(  rraur oo1olt mociyt s2uaumo t0arenifcoo1fm rlueslt)srtr(mpiodlltn nviltfa2tr( oou0tlx mo3ils aDulu p (0 lenmo3tadla eai o;()texm(opiu4ap  licsl()s2uaumooo0opeo f3iatls ea(vs;(0aetoxrcia1lpD aieil(0t2toxmpiudlmt lnetat)artru oou0olto oeildfs2uau on() lxomf3iy1latr u i s s2xrim nu4ap   nvs ( srum(root0tpt mo3ias s ua( o;()arxrxfcootoaDeliei;t) rxo(rpnudlmtelivs t) rurumoou4tlxnmf3iydlm2el(mont4 ltoxo3tatlmtr i ols0teuo(o ny4ome  ies tfa2umxmono1aex ioetyslm el(vo;u0 ltnmoctydom   uei;s0t2xrir3nudoltemnvt t a2urx p;t1ale io3iaslmDuauvs;u4tetnxr tytoa e ieolt)sexrxm3nu4omtemfeia(  2rmxro;t1tpto f3iys sDumums;u) etoir io1opDrauvs t  euoir3nudope lneta(f Dur(  ;t0aptomi3ild m uanvo t0trxomrciadlpDr neo s trum(o3no4altn ieia()arrmumont1tetomf3iytfsDelump u4aeenxociatfpD  u il()t2umxopiodllt  ncs s  ruru ooo0tpx iietltfm2um(vp;() exnxr todlpDrliei t texoio oudlp eliviat  2ur(r ot4apt mf3iysfaDrm( s u)aexomocoatfptrli s;(0 2xrxo oo1optemiet (f 2tmxrooo4tlenii3iyd s raump t)areoio3oatfpD auvil( srur(r nu1oltnmicslt srrm(  ;u1tpe ii3iyt a2ra(mont0arxnmr3iadlp  ln i;s  rxmxopio4amtnmicslsf rurumpnt0apeo f3iad aDrmu on(0arxrir ta1fm e uvo;()srtoim iodal e iesa()a2rm(rpnu1optoifeilt mDumump;t)altoxf ty1omD an s;t) ruo(r3oo1opte fvsls)srra(r nu1apto oetasfm uaumpn() etrir tatoaDeln o;s0t2xmxo nu4llen fctas arrmu  no1alx iieild s2uaums () lerxoctotfm rlnesl()tetr(o3iydlptelfes s) rurxmooo1opxoifctasfsDem(mo u4tlxnxf to1om elu olt  exoxrpoy4ap nmnvsl(f rur(rono4aeeoiieiysfa rauvo;u)trxriocio1oa   n ilt)teuoxm3nu1altn fet t  2raur ;u4ope ifeiyslsDulnmpnu0 ltnio3oadfmDeli o;t0texrxo iodlltnmiei s a2uaxm nt1alxoioeilsla2el( s;(4trxoxr ia1omt aueil(0 eurxmpiudomenmfeiatfaDraxronu1oleo octls a2eanmp;t)tetrxr iodfptrli ils)trurxr ny4ll emnvilt  rrm(r ;t4aet if3tldlaDum(vs t0 ltomf3oytfmtelivs;()setoxr3iy4op n feslt aDua(rp;u1aet mfetat aDrmnvonu) etrxfcoodomDr n il(0sexrxr oodlp e iesat)sDraumo;u4tpen iciadfaDemnvo t)tltrmf3oodfpD lu slt0t2ur(m iy1altnlfcias)a2rm(  ou1aptnmo3ildlsDel(mo u)alenxr oo1oaDeaneo t)tetmio3nodam emivtlt a2umxr ot0apx mfcilslsDem(vonu)aetrmr tytlp rlivils)setmio io1alt mfcta(f 2uau onu4ape moetltfaDrmnvpnt)trxrifcoatfp rlu o t t2urir iu4ll nmneil(fsDtm(  ou1tet  ietasfaDean p;t)tltoif oydomt auvo s0teto(opou1altn nci () 2uaum ;u0tltniicild mDrm(msnu0trtnxociatlaDe ivi t0srtrim3iu1lpeemfes s a2taur nu0tlxomfctydfaDul(vp;()aeenmf to1fmD aivols0t2tr(r3iy4optnlics t)s2tauront4tlxoii3ildlaDulumont) lxoxfcto1lmDrln i;s t2trim iydop   nvtatf 2tax pou0oexomi3tls s uanvo;() reoxo3iytopt aueil()srtmiopiodam emnvsls sDtm(rpnu4tltomfciat sDelnvsn()tlxomrcoatoatraivi;s s2toxm3no4ol nlfcta() Dumuronu4texoiietld s2ulnmp;u0tetrxo totop rlu i (0sexoxo3no1op elfvsasfsDrmu  ;o4tpeo o3tlslm2ulnvo ()tltoxo iodlatraivo;s0srxrxo ny1lp elivt (fsruaxrpno1opxn ieiltfaDrluvs t) rtoxo3io1opDrlneo t srxr(m3io1op nlnvslsf rrr(r no4aexoiociysfm2ul(vp (0alxomf3oy1lpt luvi;( trur(rpiu4lleemfeias)s2rmxmono1apxo ocildfsDrl(vo u)texnmrcoadfat  ueils0t2xr(r3oodolt lietat)artm(root4oee mieiyslsDulu s;u4tltrxo tytla elnes;s  rtmim iy4oltnlncs s arumxmont4olenifetasfs2umuvo u0trtnif3oatop  lu i;(  rxmxopnu1optnmncia(fsDua(m no4teenioeiltfa umuvp;t) lermo ia1fpt lu ilt0s2umim3oo4llenlivi (f Dur( pno1altomfciysfaDrau ont)tetnmo tydfpDeauesl(  eumxo3no4omee ivt t)srururo;o0ap
\ No newline at end of file
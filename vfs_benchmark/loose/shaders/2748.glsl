@@ -0,0 +1 @@
+ues ( setoxr3iu1ll   fcsat a2rmurp;u4alxo ieiytfm2em(mo (4trtoir3iodomDrlu o;s)truriopou4lpe mfvs (fa2tmu  ot4olxnmfctatlsDum(vsnt0trxrif3oytlmt aivi;t s2uo(mpoo4oltn ivs t srra(rpnt1oleo f3tysfs2umnvp u)tetrmo3ia1om  au o;s) rtmxo ny4lp   fvils  2rrxr nu0tle mieiat m2rm(vs;t4tlerxf iatfpD aivils0 rumxopnudoptnlneslsf Dtaxmpoo0alx  i3tydfm ulnmp ()aeenmr ty1lptrauvols0seumxopiy4apenlfvt s a2taxrpou0olxomo3ilslmDrmu p t4altnxf totlmD  u i ()s2xm(r3iu4olee nvsl( aDtmur nu4opxomfctlsfm2um( s (4trxnircoadfmt aneo (0 exoim nudllenlfesa(f 2umur ot1oltn f3iltls2rmu p (4artrir ta1fa  liei;s)seumxr3nu1ale licsl()artm( pnt1tet mfctyd a el(vs u)aeeoioctatlpteluvs s) 2trimpoy1lm e nvsa(  2rrum nu0optnmoctadlaDua(vsn(0tltomr todopDrai o (0 rurxo no1lltnlncsltfa2rmx pno4tlto fctydls ranvp;()artnir iodomD auvi;t srtoio no1omee netas) 2tmx o;t0oet  oeildlm ua(vonu0 rtoxf oatlmtr uvi;t srum(o ou4lmt  nvil(farrax onu0olx io3iyslmDuanvo;u4teenir3oa1lmD  ueo;t sexrxo oy1lmtnlnvi tfsDurxm nu1tpt iietadfm ea(vsn(4 ltrmo ta1oatrlues;s  etrxrpnu4lmen ncs ( a2ra(m nt1oex  oetyslsDrln onu)aetnmf oatfatr ieo (0t2triopiu4op n icilsfsrrrum ;t0tlx moetltlm ea( pnu0tlerif todfptr n o;s) 2xm(m nydale mici t  Dumurpoo1aetomoeildls2elnmo () renmo3iytoaDr u sls srurxo io1opeemivsat)srtmu  no1ole  oetldla2elnvpnt0 rerircty1lmD aivs ( s2xrxm3iu4lpe lictls srrm(  ;t1altnmfeiatfsDumumsn() reoxr3oadfpte i o t trxoio iu1lmeelnetat aDrm(  nt4aetoif3iyt a eau o;u0 eeomoctadoa  liei s  rurim3nu4lptelfctlt)artrurpoo0oetniietasls umu ont)tetrmrcia1latraueo (  rxrirpnydaltn fvtlt s2raxr ;o1oexoifciltlaDea(mo;() eerxf3iatoa e ivil( t2xmir3ou1lleemietatfa2tr(  ;o0aeenifeilsfs2rmumsnu) eenmf3tydlpteau i;(0 euoxm3iu4apt mnesl()sDrr(r ot0aleomfetad s2rmuvp;()trtrxf3tatopt lnvsl(0sexm(r3oodamtemfvslt  2tmu onu1tetoiociaslm eluvo;t) renir oatfm   uesl(0tetoimpiy4oltnmfesa(fsDuaxmono1oexomfeiatlmDea(mo u)trtrif oytomD  nes;(  rtm(opoudomtn fvil()a2ur(  no0olto o3tls m2rlnmp;t0teeriociatlmDeauvs;t0srurim3iy1omt mfctlt)artaur no4ope mociasls2ra( p;t0 renmo3oydla elueo;(0s2tr(m3iu1op nlnviatfsDrmx oou4aeeoii3ildla rm(vpn(4arxnxo3oodom ean sl()sexrir3oy1amt mfvi (fs2tmxrp;o0olx ifetat a rau o;()texomf ty1lpDelivsls)t2tm(m3oo4am nmfeta() 2ra( pot0aexoiociat a2ranvon(0alxnif tadomteanvilt seuo(mpiu1lm n fvta(fs2tru  nt4openif3tld mDuan pnu) etrir tadlaD luvs;s)srumio oydop  lnvs s arraum ;u4olx iocils m2rm( s;u0 rxrif3oo1faDeanvi s0trxm(m oudolenlnvias s2trumo;u4oex mo3tlsfs rlu s;t0trxoioctadfp eau i t)setmxrpno4omt lnesltfaDururp;o0tle  i3ildfa2rmnmp;u0teeomf totoa ranes;t) 2umiopno1lpe mfesl( sDumurp;o0tlt miciat s2rmnvs u) etoir3oo1fptraueilt0seurxr oy4lmtelfvslt  2rr(mo;u4oeeoif3tldlm2ea(msnt0 eeoxo3ia1laD auvilt)truoxr3iydamt lnes ( artrurp;t0oet ifetytls2um(msnu0aeerioctatfaDe iei;( t2toxr3io4olt mivsat) Dum(m nt1apx mfctlt m2umuvs t4aeenmo ootlptr uei t seurio oudop nmnvsa(fs2tm(  ;t4aeenifeiaslsDumn p;u4 ltrif3ty1fp elnes ( trtmim3iodopen fcil( aDumx oou4tlto i3iadfmDuluvs;u)altnmoctodoa  lnvs ( teur(rpnudlmtn ivil(f 2ur(mont0oet mfeiatfm2rluvp (4alerir3io1opte ies t0t2xoxm ou4lmtnmncs t a2raump;u0alenio3ilsfaDum(mpnu0 rxnifctytlmDelivi (  2xo(o iu1ol elieta(f Dumx  nu0apeo fciyt sDraumo;t)tleoxr tatfaDe n slt0s2umxm no1lpenmncsl()a2tax o;t0optnifetytfmDelu pnu4 lxnxf totlm r ues t)teumirpiodlptnlfci ( aDtmumpot4tex iictydlsDea(mo;u0 etomf3oatlaD  n slt)s2xo(m oo1ome mfcs tfs2tmxmpnt4alxnifciytfsDemu o;t4altnxfciodlaDr uvs;(0srxm(m3iodap nmfei () 2urxmpno0aeeoii3tas a eanvs (4treoxr io1oa  livi t)s2toirpny1lmtelicilt)srrruro;t1tpen ocias aDuan ont4texrmrcta1oateaiei t) eumxopnydole  feiasfa2ur(  ;u1oetoifeiaslmDranvp;()alerxr oatoatranvils teto(o io4lpt lfcs tf 2ur(m ot0alxoiictlsfm rm(vsnu) renxo3iotopte i s s) etoxo3iu1al elnctlt aDtaxr ot1aex ioeiysfmDum(ms;t4 ltnif io1optrlneo;s0s2xr(opoy4amee fctatf 2tr(ro;t4opx mieiadfa2rmn s;u)altnmf tydfat luvo t tetmio iu4ome  ictas)sDur(m ;u1alxomfctydla2ulnmp;() exoif3iadlpteau o;s srxrxm3oydom  lfci (fsDur(m oo1alxnmictltla rauvo;t0trxomo3iydopteluvo;t0 euo(mpoudaptemicia(f 2rau  ou1apxo fetadlmDua(vp t)aexoxr oatlatrlues ( t2xr(mpnu1amt licsa(f rrmxmpno4oexo o3ils mDuanvo;u0arenir3iodopt ai o;s0 2ur(o3ou4lme mnvil( srrax oou0opt if3iltfs2eau p;() etniocty1lat lnvs s s2tmxr iudal e nctlt s2rax pnt4oet  fctltfsDuanmpn(4trtrxo oa1fp raiei;(0setoirpnudom  lnvt () Dtm(monu0texn f3ias s2eln s;t)alxoxfcio1omD aiei;t)sexrxo3iydam n iviltfa2ra(r ot1ape ifeiytfa ea(mo;t)arxnif ia1opt ai o;(0t2tr(o nudlltnmfvtat)artr(ront1tpt  i3iadlm2um( p;u)tltnmf ootlm r i il(0tetr(m iydamenlfvt t)sDtruro;o4opxnmfctyslm rl( p ()tltrif tadlpt anvs t  ruoxr3oo1lpe  fesas)sruax onu0tlxnmf3tls s2umums t4alxoif totoa  li ols t2umxo3oy4lmt mnei t  2tm(rpno0aex  i3tlt aDran o;u)aleomrctytfm elues;s)setoxo3oo1omee fciatfsDtmur ;u1aex iietytlmDrlumo;u0 rtrmrcio1om  luvo t0sexoir3iu4amtn iei s)srur( pnu1openmi3iasfa ean p;u4tlxoxf3iadlmteaivi t sexmxopno4aptelivta( s2tm( o;t1oleomf3iyd s2um( s;()arerio iadfmD aieilt0 eurio3nu4omtelnei s) Dta(r ot1oleomi3tldlmDraumo;u4 lenxociytfpDe u ol( srto(opnodale mnci tfarrrxrpot0olenifetas a uauvon(0altnmo tytlp  ln ols)setmirpno4lmt  fvsa(fs2rmx p;u1apen ociltfmDua(mpn(0aexomocta1opte uvs t0sexrir3iydape  feia(  rrr(rp;u1tpe ioeildfa uanmp;u4alenio iadlp e ieslt0sexmxr ou1apenmfvi t  Drmx pot1apeoii3ildlm rmn p t4 renxocoo1fa  anvol(0 2uoir3iu1apen ict s) rum(  ot0aleomieiatfs2ul( on()arxnio oodlpD an s;() rxmim iy1lleemfcs s) 2truro;o0apeoiiciatlm2elu s;t4teerxfcoodoptrlu olt t2urio3nodomtn ici s)srtmump;u0tleo ieilslm2rlu pnt0 lerxr tadlat ln i () 2tm(m oodllenmfes t)srrrxm ou0apt  fetys mDrauvs;t0 rtnir iotop rlues s)sexr(r3oudap emiesa(fsDrauront4opxnii3tas a eaumo;t0 exnmo3oa1fate uei t)trtrimpoy1omt lfct () Durxmooo1oetnioeiyd aDrmuvpnu4treomfcoadfm eliei s)s2xmxr3oodamtemfesl(f rtmxr oo1oet  oetys a2rmnvp t4alxnif ootfm rlivsl(0srxmirpiu4lp  lnci t srtax  ;t1alt iociasfaDrl(vpnu) exnmrciodfpte nvol( s2urim ny1omtelfcsat)arrr(  ;t1tlenif3ilsfm2uan sn(4arxnir3io1om rluvils0srxmim ou1ameelnvt tfarrrxrp;u4aptnmf3iatla2rmumonu4trtnmr3oo1oaDranvi t texrimpoudapenlnet (  rur(m ou1tptn fetad a uluvsn()artnirciytfaD  u o;s)s2urirpoodam e ivslt)srtmurooo4tetnmoeiydls eaump u)trtnxf3ta1lpt lues t0 2toimpiu4lltnlnes sfs2umum ;o1alxo i3tytfa2uauvpnt)trxrifcta1fa  lnvsls  2um(r io4ap elnci s) Dua(root1tet iieiysla uluvonu4arxnxfcto1fatr ivs s0 2uo(r3oodlpe lnesat aDua(r oo1aet iociad aDrm( pn(4tlenmo totom eli s;s0 2um(o nydopeemfet sfaDurump;t1alx  i3tyd m ea( o;t0 ltoif3iadlm r i i t) rxr(m oo4apte icil(fsrtrumo;t0aetoiiciydlsDulu pn(0altoiociodom r uvols  2umxm3nu1amee ivils) rtax  ;o1texomoctltls eauvo u0tetnxf3tadfmt lu o (0t2uoio oy1optnmiet t  rur(roou4aeenmi3ils a2umumo t)arenmo oytlp elnvs;s) exoio3nudalee ncilt sDta(r no4apxnio3iaslaDemn s;(4 ltrirctydopDrluvo ()trur(mpio1apen icta(f 2taxmoou0texomfetyt s2umn s;(0 exnif3iadlp eliei;t trurim3oudol  mivs tfs2ur(m oo1opxnioetlslm2uanmpn()alxrxrciytfaDr uesls  exrir3no1ol   fvs sf 2raxmpou4tlen i3iydlaDea(vo;(4 eenmocoatfa eau s;() 2xrir nodlptnlfcsat  Dur(r nu4tet  iciytfsDrlumo u) etoif oadfaDrlnvi;t s2xoxr3ny1ome  ies s)s2umxm nu1oetn oetadlm2rmu o;u0 rxrio3oydlptranvi;s)t2xoirpiu1optn ieiltfa2umxm ;u0aptn o3tlt aDelnvsn(4 leoio3oodfpD anvo;s)texrxrpiydape miei t)aDrmxm ;t1alx miciadfa2emnvont0texnmf iodlpD anvi s0s2tm(o iodaptnmfvta( a2rax o;t0tpxn oeildfs ul(vo u0trxrmrciadfpt au olt0srxrim nu4amenmfvsa(fsDtaumo;o0oleo i3iad m ul(vs u4alxnirctotlatrlnes t t2ur(m ou4opt mivsas)s2raurp;t0aptn ociat m2emump;u)aeenmf ty1fa  aneo t)srtr(o3oudlmte iviatfarrrur ;u0tet iieiydlaDumuvont0 exrmrcia1lm  aueo (  rxr(m3io1al e nviltf rumu o;o4tpeniieiydlm2uau p u0aeermr ia1oa elivsls)s2xo(opoo1oltelieslt sDrau  nt0alxn o3tysla2ul(vp u4altnxrcoy1fa rau o;() exoir no1ale mnvtat  Drrurono4oetniocilsls eanmsn(0teerio oy1op rli s t teumirpiu4op   fetltfa2uaxm ;t4alt  ieiad sDrlumpn()tlxoxf oodfateau s s0 exrim oydolenlivia(  2ta(rooo1aet  iciadfs rmn s;(0altrxf3oatfaD  ueilt teum(mpnu1omt lncilt aDururoot0apxnmfeiad m elnvs;(0texrmo3iotoa r nvsl( setr(m3oo4lp   icil()a2ra(mono1tpxoiiciysfmDumnvpn(0tlxnio to1lmDeauei ( texmxo3iydlmtnlivslsf Dumumo;t4optnmiciyslmDua( sn(0 etnxf3oydlaD  uvi t0 exoxr3ny4alenmivi s) 2trumo;o4olxo oeilsfs rlumo t0alenifciydomt  i s;t)sexm(mpou1omen fet tf rta(ro;t1tlxnmoctas mDrl(mp;(0 rerxo3oadlp   ivols)sruo(m iy4lm  micils  rrrurpou1open iciadfa umu p;u4artoir oytopDraueilt s2umxr ny4ap  mfet sf 2rax  nt1optniicilt mDeanms t) leomfcoo1faDrau s t trxoiopny4olen nvsls) 2ur(m ;t1alxn ietas a2emumo;u0 exomf3ta1fa  luvil(0teto(opoo4amt mnvtls)srrrx  ou4oeen o3tatfa eaumpnt4teeoir oatomD aueolt)setmxm oudomee fvs t  Dumurono1aeenifeiysla2elnmo (0artnx
\ No newline at end of file
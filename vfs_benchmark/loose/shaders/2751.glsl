@@ -0,0 +1 @@
+i o () 2xrxr ny1omt  nvs t srrmur nt0apen o3tyd s2rau s u4 rxrmr oatoptrluvi t0sexo(m ou4lm  mivs sfs2rm(mpnt1altoiociatfm umuvp u4texrxfctotomDr uvs s tetoxmpoo1om  mncils  Dumxrpou1oltomfciasfsDea(vo;()alerxf oadoptr n o ()s2uoirpio4amtnlici s)a2umx  ;t0opxoio3iltfa rl( pn()aexoifcoadom rln o;t)srtoimpoy4omenmnci tfa2rm(moot0tle ifeiatlaDuln p t)trtoiociodop e i o;()tetoimpiydal e nvs tfaDra(m nu4tetoiictysfs rmuvo;(0 etrio3iotlmDrlnesls) eumxr3iodomtn fcs (fa2ua(  ;u0alt ifetas s rmnms;(0tltnmf tydoptrlnvi;t  rurxr ny1olee ncs (fsDrm(  ou1altn ieild m emnvo;t4 exoxfciodla rlivolt0 etrxopoy4ope mnct ( aDumxr ;t0tetnmieiydla umuvs (0 reoif3oatoa  anvil()seurxmpiodopenmnvtl(faDrmur ot4alto f3iltfmDrmumpn(4 rtrio3oydfpDeaneilt  exrio iu1lle lnct ( s2ur( oou1tpt moeilsls2uauvs u)altrmocoo1op rlnes (  rtoimpnydole  fvsat  2rrumo;t4tee ioeilslm2ea(mon(4altrio tadfptrluvols) etoim no4apt mivsl( sDra(r ot0tpxo oeildfm rmn ont)aexrio to1fmtrau ilt  2xoiopou4al elicslt arrmu  no4oex iictltlsDel( s u4aetomr3oy1fp eli sl()texmio oy4apt  fcslsf 2um(root0olenmfciatlmDean ont0texomrciodlpDelu il() etr(rpno4lpee netasf rur(m ou0tpxo f3ildlm2ua(mp t0 lenmf oytfp r ivolt)setr(m3iu4lp   fcsat aruaxrooo0oeeo i3tyt s rauvp;()altrmrcoo1lmDr nesl(0seum(o3io4om  mncs t  2tr(m oo4alt  iciysls ean p;t)tltoxr oadfa r neo s0s2xo(m3nu1ol  mivia() 2urxroou1alxomfciat m rmumpnu4 exrxf tytoatr ivsls srtrxo3iu4lpenmieia(  2urur nu1ale mieilslm2rmnmsn(4 ltomfcia1fatr ivil( s2uoir3ou4amt lfvtl()sDrm(mpno0openii3iyt m2em(mont0 rtrmoctatomtraivils)s2xrimpou4alenmivt t) ruau  ot0ole mo3iat m ea( snu4 lxrxfciodfpD aieo;t sruoxopoy4olenlfvilt arur(mooo4aee mieils sDra(mo;t4trerxf3oytoatrauvs;t0t2toxrpno1ale lfci s s2trxrooo0oex  fciat aDemnvp;t0texoxfciydopD an o;()s2xrio3oodllt mnesat  2rmu o;o1oltomictydfsDem( s ()artrif oatomD livils) 2tm(mpiu1altnmncil(fsrrr( oou1tee iietlslm2el(vs;(0altrioctodlpDelueo;(  etoxmpno1lltelicil(faDtrurp;u1openio3ilsls2el( p;t4 rerxo tydlm rlneo s trxoim oy1apt  iesas)a2trx  nt1tlxnio3iltlmDemnvont4tleoxo tydfpte ieo t)s2xriopno4alte fvs (f rtr(rono1ole iietls m2um(mp ()arxnmo3todoa  lneo s0texm(o3iy1amt lfcsa()a2taumoot1opt mictytlm2ul(ms;u) etoiociodom   uvolt s2to(opio1ll nmivta(  Duru poo1tpx moctlsfs2em(vs;u4 lxrxo3iy1omtrlivilt)seum(opnu1om e icia(  Dtax o;t4openmo3ilsla2rlnmp;t4 leomrciadom  auvo;t0srum(opnu1lme lnvta(f rrruronu0oexoiiciad aDemuvonu0alxnif3oytop  li s s  exo(r iudlm nmnesa( srrruroot4tlxnmfctldlaDrl(vs;(4tlxrmrcia1om   nvi s  2ur(o ou1am n feiasfaDta(  ou0tpen fciasls ea(vo (0tlxnxo oadomDe neslt  etoxmpny4amenlict sf rrrumo;o1olxnif3iltls2ulnmo u4aetnxfcoodfpDraiei ( truoimpnydlp  lfctl(fsrrrum ;u1tetnmoeiasfs2ean onu4 etoxr3oo1fatrai o t)s2urxm iu1ope  nei t)s2uaxm ou1oexnmocilsfs2ra(mp;(4 lxrmo3iydfpDrai i;t0s2urio3ou4optelnct ()aDuru ooo0aleoifeild a rlnmp;t4trxomrctytlpDr i i;t)srxr(o iu1lm emfcil( aDum(m ;o1altoioetytla2rmnms;(0 exnmf3tatfaDeaiei;s0t2xm(opno1ape  ics (faDtmxmp;t0aetoii3tlt s2ul(ms u4tlxrirciadfaDe n ils0 rtrxo ou1amtemnctltf 2tm( pot1ope if3tltfm2ul( o u)arxrmoctotoaDelu s;t0 rtr(mpnydlle mici s srtm(mpno0olxo ietasfs rln ont) rxrmo3iy1oa eli s ( srxm(opoo4apt  ivsas) rrmumono4optn ociysfa2um( o;t0 ltnir3ootfa rlivo;t0truoir3iy1omtemivsa( aDtruront4apxo ociyslaDrm(ms t) exnxf3ia1op   nvi;(0t2xoxm3oudolt  fcils) rrrxm nt0ale ii3iaslm uanms;()aeenmf iotla elnvo;s texrio3ny1am nmnci s  rtru  ot4altomociyt m eaums u0 rxnxf3totfptr n i t0tetm(o3nu4amenmnvtlt)s2rax onu4aeeniocilsls umnmp;t0 rxomo3todfmDranvils0 2trxr3iy1ape liviasfs2tauro;u4olen ietad m rmuvs ()aexrxo ia1op rln o s) etrxr3io4lpen ncs s) rua(moou1ole ioctytfs rln o;t4aeeoxf iatom e neils) 2xrxo3iy4lleelfcilt) Dtm( pnt0tpen fciaslmDrm(vp;u)texnxr io1oa eai i;t srxrir ou4lm e fvt s s2uaxm oo1teto octat m em( o t0teerir3tatfmDean slt) 2xr(m iu1op  lieils)sDurx p;u1aexo f3iat sDel(vp;u)arenmf tydlpDe u i s)srxoio oo4lpee fciat)srrr( ono1texoio3iys m2ea(vp u4treoxfcoo1latelneo;t trtr(opoy1ll  mfvtlt s2tmxro;u4ope  iciys m ea( snt4trxniociotlmDe u s s0srumim ou4lme livsl() Dum(m oo1aptnmi3ildfa ra( s;t)alxnxo ta1om ranvsl( srxoir oo1lleelncs s)artr(mo;o4aetomo3ias m2eaumsnu4tltnifciodlptelu il(0srxmxo oodop e ivtltfa2raumooo1apeoif3ias a emuvp t0alxrmo tadfm eai i t) 2xm(m3ou1ol elnvilt) rum( ont1olenmieiad s2um( o (4trerxf3ia1opt  neo t0t2xoirpou1lmtelnvtl(  Drmxrpnt0aex  octyt aDrmn pn(4teeomf tatom  lues;() etoiopou1omeemfcia(  rtm(  ou1tpxnmi3iysfaDulu s;(4trerxfctatfmDeanvilt0 exrim oodapt lneias)srtr(  ;u1tpen ieiad m rluvp;(4tlermf3tytfpt  i s ()trtoxopio4open nvi (  Drm(mpnu1aptnio3iytla2em(vp;t0texnmo3iy1laD  u i;t0 2tmim nu4lpe  ncsltfsDtr(mpou4tltoif3iatfm uauvs;(0 lxrmrcty1optr ies t0srtrio3oo4oleemncsas)aDum(  no4apen ietys m2ra(mpnu0tleomr3tydlm  lu s s)s2urxr nodom emnvsl( sDtaxmp;o4ole mfetat a ulumsnt4 rtrmr3oadfm r uvo ( trxmio nu1omtn fvi tfsrtaumoot0oleoioctydfm2ranvs;(0 exrir3ia1lmD lu il(  exmxr ou1lptnliesas a2taxmpou0oeen fciaslm el(mo (4 rxrmo iodlm ranes s)sruoxo oydomt lieilt s2uaump;t4aptnmietldfa ua( o t4tleoir tadfaDraies s0seurxmpiu4opee ivilsfarumxr ;t0alxo o3iysla2uln p u) rxrxr ty1oaD lnvi;t0 2xm(o3nu1opt  icslt) Duax o;u4aee ii3ilt aDeauvp;()aleomrciotfpteli ils)teumimpoo4om   neiatfs2rrx  oo0tle mf3iys m rauvon(0 rtnxrcootfm  lueo s srtm(opoy1lmenmieil(fsrur(ro;t0opt  ieiltlmDrluvpnt4alxoxf tatlmD  n i;t trurxr oo4opt  iciat)arra(r ;o1optoii3ild a2ulu pn(4 lenio3totfmDe nes;t  2xr(o io1om nlnetat  2rmx p;u4oltnmo3iys s rmuvsn(0 rtrmo tatlpt an ilt0s2xrim iydlle mnes t aDua(rpnu4alx io3ilt m2ea(ms;u) rermociydfmteln o;t)setoimpoo1omt lncta(f Dum( pou0alt miciydlsDuauvpnt)tetrmociytlmDrlueilt t2xriopiodlltnlfesat)aDtrxm no4alt moetytls em(mont4tlerirctytoaD anei;() 2ur(o3ou4lptnlfcsas  rur( p;t1opxomfeiytls ra(mo;u4tlerircootla   ivo;s)s2to(rpoy4opeemfctls) 2tm(rpno0apeoio3iytfa ra( o u4altnirctotoa eau ils  etmimpio4altelfetas  Dumxm ;o4aetnmoctlsfm ul( p u) leoiocoydoa eaues s0t2trxr nodaptnlfcs s sDur(r ;t4alt ii3tyd sDraump u4tetoxf3iadomteai i;t0 2umim oy4al  lnctatf rrrx  nt1apxn ieilsla2rmumo t0trerio oodfp  anvslt0srtmxo iydlm nmnvt ()a2rr( poo4ope iiciasla2ra(vp (4trerxr3iatfmt anvi;(  exo(r iu1ope  feilsf 2ur( ooo4ole ioctatfs rm(vpn(0aexoxf3ootomt  ueo;( sruoir3io1al nmnei s)arrr(rp;o0alen ieiadfm2ul(vs u)trenir3oytomtr n i;s)teurirpiodal  lncil(  2ur(roou1tptoif3iatlsDrm(vo u4tlxoxr tatlpte u s;s)texm(rpoo1lpt  nviat arurxmo;u1tpto feiatfaDem( s (0tetoir to1latelies;(0 2toxr3io4alt mieta( aDumu  no4tpenif3iytla um(vo u4 rtrif oadoaDeanes (0srxmxmpou1ol nlfvsat)aDrr(  oo1aptoifetatfm2em( o;t) ltnmo3tadlate i i;( t2uoxmpio1op   nesltf 2urxm nu0oeto iciytfsDel( s;(0aetnxo3ia1oa   ivi;t) rtmxr io1llte icslsfs2tmur ;u0tex miciasfaDel(vp;t)tlermr oo1opD  ivs t0t2uoxopoodol elnct t aDrrx  ;u0aeto f3tasla2rlnms (4tetoxf3oytomD lu o;() eurir nu4ap  liei t) 2taum no1oetoif3ilsfs ea(vp t0alxoxr tydfatelu s;t)trtmxm nu4opee fvsat)srumxmo;t4oltnmiciat a2rau sn() rxoio3oydop  li ils  exoir3io1amt mfct s)aDumxmonu1tpt ifeilsfmDrln s (4tltoxo oo1oaD lneo;t  euoxo3io1alt mfci (faDur(ro;u0tlxniiciad aDrmnmpn() ltrif tatlpDean i t0s2xoxr oy1amt mnvtlt  rtm(mp;t4tlx  fciasfs2rluvp;()
\ No newline at end of file
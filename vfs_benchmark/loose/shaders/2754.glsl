@@ -0,0 +1 @@
+nes;(0teto(o no4ape lnesat) Duaxmoou4alt moctas m2ra( p;(4 etrmo3oa1fat li s s)t2xr(o3oy4optn iciasfsrra( pnu0oleomo3iys m rlu onu) exoxo3ia1laD  i slt) rxr(m iy1oltemnvt t)a2rmu  ;t0teto octad mDeanvo t) lerxf3io1om e uesls0trumxm3no1alee nvtat) rta(r ;t4aet mfctldfa2rm( snu4 rxnmf to1lpDraueo;( sruoxm3no1lmeelnesasfaDtru p;t1oltoio3iytfmDelums;t0 lxrio ootla r uvo;()tetr(o oudlmee ics sf rtaxr nu0tltnifeilsfa ranmp;t0alenxr ootomDrln olt) etmim no1ap  mietlsf 2um(mpnt4opxn oeiyt a2elnmsnt0tetoio3tatoa rlies;s)srxoxm3no1apt livsls)aDuau  ot1opxnif3iat m2elump u)aetomociytfpt aues;s teum(m3ou4llt livsl()arta( p;o1opeomo3iyt sDrlu o t0teenxr3ia1lp rau s s0sexoxopnudoptelivslsf Drrurooo4opxn f3tldfa2ulnmo (0tlxnio3ta1oa  lies;s0seur(r ou4omt lics tf 2tr(mpou0aeeomfcildfaDeauvo t) rtomr3iotlmDe i s (  exo(mpoy4lm n ies s)s2tr(rpot0openmieilslaDrl(mp;u)aetrio3oytla eai il()srxoxrpou4ol   ncs ( a2raxmonu1aeenmicild aDrmnvo u)teeoio3iytlp   n s ( setrirpiy4ol e feia( arurx onu4oetnmo3ilslsDem( onu4 eeoxo tatfm elies t) exoirpnudamtnlnciasfarrmx onu1apt mo3iat a rluvp;u4tltrmrcoo1fmDraneo s0tetmiopoy4opt  nvs ()srrrumpnu0oltn ieildls2rm(vsnu0areomrcia1omDrlieslt)s2xmxopou4am nmfcsl(f rtrxr ;o1opxo ocildlm2uan s t)tltnio3iytfmD lies ()sexo(m3iu4lmt  ies t)s2tr( ont4aexomi3iatla2eanvp;u0texnmfcia1fptelu il() 2trio3ou4ol  lietl(fsDua(mpoo4tpt mo3tytla2ul(mpnt0alxnxr todlatrlnvo s0 exmim nu1lmtnmnvtatfsrtmumoou1ope  o3tltlm rl(vo (0trxoirctodlmtrau slt0srxo(r3nudlptelnct ()a2uaxr no1aexo f3ias s2eln s u0trxoio3iy1faDr uvi;(0s2um(opiu4ap  miei sfsrrm(  no1tpt  i3tydfsDran p (0aleoxf3tatlmDr u o t) rxoxrpiudlltnlncs t) rtm(  nt4oexoiietydla ra(ms ()tltomocoy1laDr nvs ( s2xmxo3oudll e fetatfsrrrxmpou1aetn ocilsls2ranms;u) etoxf3iy1fat  u o s  2xoxr3oy1lpt mnetlt)a2rrx ooo4alenmfeild s2eaumo u0 eeomr ootoptr i ils0 etrimpio1ome lfvi (  rtr(rp;u0opxo fcilsfaDuln p;()tlxrmrciotlmD aiesls0s2umxm oydope lfesl(  2uaxmpnt1oltnmf3iltfs2ranvs t0alxrxo3iatfp  an i;s0s2umxo3nu4apenlivt t sDua( p;o1aee iictydlaDem( s (4trerxo3iodfat lu o () rtoir3no1oltelfcs tfsrtrxmpno4tlen f3iatlsDeauvp u)aetoif todla rlu s s)seuoir iudlle  fvi t)arumumooo0apeoifcildfm2emnvs (4 rtomr3oatoatraieils0s2tmir3no4op emneias)a2trx p;t1apeo f3iltfmDem(mp;u4trtnmo3tydlmD  n o t) rum(r iu1alenmneilsf 2trxrpoo0apxoiietad a uanmp;t4 etrxo3iotlpteaueo (0trtmir3io1om nlfvtas)s2rmu poo0tlt  ieiydlsDrlu p;u) ltnir ootlaDrai o;t0seuoxrpoo1lmtelfciltf rtmxronu4oexnif3ils sDrm( p (4tlxnmrctodfpDelivi s t2xoio3no1om e ivsls  ruax  ;u1tetn i3iydfm ul(vpnu) ltoio oadfmD ai o;t) rurimpoo4oleelfei (fsDrmur ;u4optnmfctltls elnmo;u) lxrmr3oytfmDelnvs;t  eurio3iu1llte ieils)s2rmxmpnt0tpt mi3tys m eln p;() rxoxrcta1fm eauvo ( trxrxrpou1lm elnes t a2ra( oou4teenmfetysfs2eanvs;u)aeeomrcoodfmDe ivs;t trxoxrpou4al eliet s)aDuaxm no4opxo fetys a2ulnvo;(0tlxnmo tatlmDelnvi;t)setmxr3oy1op n neia( sDrmxm ;u4alen i3iadlm emumsn(0arxoifcto1faDeau o t)s2triopny4llt  ics t a2tmu  ou0oeen o3tldfs2emumo;t0trenxocia1fmD auvi t0 2urxm3ny1al elivilt)srurump;o4apxnmfetytlsDea( s t0texnmrctatoateluvo t) rtrio ny1om  lfcs s) rrrur ;u0optomietytlmDulnmonu0aexrmf ootlptraivs ( s2xrim3iodomtnmies s srtrumonu1opx  i3tydls2rlnvp;u)teerif3iydlpt lnvs;(0 rxr(r3nudoltnmivia(fs2rrxmpnt4tleoiieias s2ulnms;t) rtrxr tatlm  lueo t0trtm(opiydapt lici (  rtru onu4altoioetas sDemuvo;u0 rxriocio1oa eau s;t) eurxopno4ap e net t aDtrumo;t1tlto oeilt s2ean p;u4arxomo iy1lmDrlu i;s) eumxr nodlm elnetltf ruaur ;t4ale  ietydfs rl( p;t)teeoir3ty1laD ai i t srxrxr3iydom emfvtls sDtmur ;o0aetomoetltla2umuvp (0artnir3to1fpt aieo;(0srtmxm oy4aleeliesas  Dtaxronu4opt ifeildfs ulnvo () lenmr3ta1fpt an olt t2xrio3oudom  lncils  ruru pnt0oltn fciydlm eaumo;t4arxrio ootfp  lu sls  2urxmpnu1lmt lnvt t  rua(r nu0tpt moctysfm rmu pn(0alxrifciydfaDr ueo;t t2xmxmpiu1al   nvt (fs2raxm nt1aetnmfcilsfmDrauvonu) rxnmf3oatomt anvols) 2urio iy1olte ivil(farrmum oo0alt iiciaslm eau o t0tetrxr3tytlat luvo;s)t2xr(m3nodalt mnes s)srtru  ;t4aexnmfcilsfs2elums u4arenio iytlatranei t0tetmxm3ny4amtn fcta(f 2tmxr ;t0aetnmi3tydla rl(vs (4tlxrmo3oodfat auvil(0sexoxm3oydoptnlies (  Drr(rpoo0opto oetldla2umuvo;(0 eerif3ty1laD anvo;( srum(r iy1apt  nvils)arrr(  ou0olt  ocildlmDel(mp;()treoxfctatlaDrln i t srxrxrpoo4lpeelnct s s2ta(mpnt0ale  oetld m rau s u4aexrxf oatlptrlnvi (  rtrxopiodalte ics t srrru  ;t4opeomi3tadlm umnvon(4tltnmfctadfm eai i;( srum(mpnu4ap emics t aDtrx  ou1olt mf3iatfm2umnmpn()tlenmo iodlate nes;(  exriopnu4ll elfeiat s2umx o;o4apxo ietadfa2umnvs;t0areniocoodopt ai o (0 2umir3ou1ll  mfct sfaDua(mp;t0ale ifeiasls rlu p ()arenirciodfa rlivsls  rurxrpiydaleelfctlsfa2tm(mo;u0tlx ifctyt m2umumo u)altoxo iy1lat lnvols0srxrxo iu4lmte fetat artru  ;o4tex  oetysls uanmp u4 etnir oy1omtelivils0seumxo3oo4lpt lnesasf 2raurooo4aee  feias m2emnvo;u0artoxr3oadlpDr i o t  rumxopnodope licsls a2tmurp;u4oetnmo3iat s umu s u0texrifciatop ranvi;t s2tmio3oy4omeemnvsa()s2tmumpno4alxniociadla2rauvs () eerxr oatfate iesl(0teurio3nu4oltn neias artm(roou0oeeniictyd mDel(vp;(0artrir iatfatranvo;t)setm(o3oydlle mfcta(f rrmx ont0texnifctls m ulnvp;u) lxomociydop eanvols trxmio oydal   fvs (f ruax  ;t1alx moeilsla uan s t0tlxnxocoadopt  iei;s seurir3nydlm e ncsa( a2umxro;u4tlxniictad a rl(msnt) lenmo3oodlaD ln ils) eurxm no1altemiesltfsrtrur ;t0tlxomf3tadla2emums u)tlxriociytlp eai o;s s2tmio3iy1lptnlfeilt) Draumpoo1alt mieiat m2emums (0texnxr iatlpt  u s;t0 etoxo oudal emfcs (f Draxrono0tltoio3iytlmDrl( snt)aetrmr oatfa ran i;( t2umiopnodame lneslt  rtr(mo;t1ape  i3iydfaDranmp t0alxnmf tadoatr ivols  2xr(mpiydaltemivsltf Drr(r ;t0aeeo feiat aDuln s t)tlerxfcoytfpDr i i t texoir oy1omenmici t) rrru  ou4teeoiiciltls rmn ont)aetnmr3tadlmDrli s s0 2to(r ny1ll emnvilt)s2tr( pnt4aex mocilslmDrm( s t0aexrmocoytom eaiei s0s2urxm3ou4amtemiesl( sDumumooo0tle  ieils a el(mo;(0trtrmf3iodoateau il()srur(o3no1lme lfvi sfa2rrurpno4ape ifetasfaDrauvsn()tlxnmf3oydlpte ueo;t)trxmxm oudlpen netlt)srrru  ;o1tetniocilt m rmn sn() rxnxrciotfp ranvs (  2ur(opoydoptelfvias) 2ua(r ot0opxn i3tydla rluvp;u) lxrif3oo1lpD  uvilt  rxmxopio4apt lnvsatfaDra(mo;o0opt mo3ilt mDrl(mo (4arxriocoo1om rau s;(0 2uo(rpnodapee fct ()s2raxm ;u1opeomocildlaDrm( o u4artoir3iatfm rai i t  rxoxr oydlmen net s  2tmxmoou4teenii3ilt aDel( s (0 eenir iodla ean slt s2xoxmpiodll nmfcsas) 2tmum no4aexo ocildlmDrl( o t0 lxnmo3tytopDraies;t srtrir3iy4lmt mncs ( sDtau  nu4tpxnmo3tydlmDeau p t) rxnif3oo1optr i s t0 exrxopoudaltnmivtas) 2tmu p;u4tlx moeiys a2uluvs;t4aeeniocoa1fpteli o s) etoim3oy4ope  iet tfarrax p;o4teen o3ilt s2elnmpn(0 etoxrcoodlaDr n i (  rtrio3oy1altelnesltfs2rrxmo;o4aee mi3iatfs um(msn()aetnio3oa1oate iei;() 2xrxm iydalenlfctl()arurxrooo1optoif3ild a2rmumon(0tltrxr3oa1fp eau s;(  2umxo ny1am e fvt ( s2tm( pou0oeenifciyt s rl(ms u4treoircootla rlueo;t0 2xoirpoy1al  livslsfs2umur ot1aexnif3ils s emu s;u)teenxociotlm rlneo s  2toxrpiudapen ivilsfsrtr(rono4ope mo3ias sDemuvo;(0arxnmrctodlm rliesl()teto(rpiydomen fct () rtrx pnu0alxo f3ildls umuvo u4aexoifciodlaD aneo t0seuoiopnydam nlncilsf ruaurp;t4tltomociyt a ean s;()aetnir3tytlpDr nes ( srumxr oo1ale mfetatf Dta(mo;u0tlxomiciytlaDulnvonu4 lenifcoodlpteli sl( t2tr(r iydom e fvtl() 2taxroou1tpx  feiysls ua(vsnu) reoxr3oadoaDe ivilt0 etrxo oo1ll n ncs s s2rm( o;o0tlx if3tydlmDemnvsnt)trtoxf3tatfpt luvi s0trtr(r3oy4oltnliet s  Dtmurp;o4opxnmi3tls m rluvo;t4trtnxrcoy1opDe n s;t  exmim3iydllt  ivi sf rraxrono0altnmoeiaslm eluvpnu0aetnmr tadfaDr i slt texoxrpoodlm nlfeia()sDraxr ot0aeen f3tlt s ranmont0 rtniocoa1om elnei;s) eum(r3oydlp  mictat  2um(ro;u0tee ifctltla rmn s;u)arxnxo3oatfmtranvi (  eumxr3iydole licslt aDtmxm ;u1tetnifetys sDem(mpn(4teeoxr3oodfa  lnes t)s2tmxrpnudom elivil()s2ur( pno0tlt  iciydfm2rlnmpnu4trtoio oydfp r i s;t)t2trxr ny4omee fvtlt) rrruroot1teeoii3iat mDuluvp t0tleomr3oodlat  ieo ( srxm(rpiy1opee nvtl( sruaxr no0alxoifctatlsDrlumsnu)aeermf tytfmD lueol(  rtoiopoo1llte ncsl( aDrrumono0tpx  iciasfs2rln p;t4 etrir iydomteau ols)setoxo iy4lptnmnei (  2urxrpnu4opxoiieilsfa2ra(msnu4aetoirciydopDran i (  2uoxr3oy1llte nviat sDuaxrpou0opto i3ildfmDua( p;(0areomr3iotlatrau s;s  exmim3iu4lme lnvs ()srtmx poo1tpxomieiat mDrluvon()tlxoxrctotoaD  ivi (0teuoxm io4aleemiesatfarrr(mp;o0olen o3tasfm ulnvp t0aeermr3tatfpD  nes;t) rtmir iu1oltelnvtlt  rtaurooo0oetnmieilsfa rluvp (4areomr3oa1lat aueslt0 etmir oy4aptemfvi t sDtmxr ;t1tlx mf3ildfs2elnvo u0 rxrircoy1opt aivols trxr(rpiu4op nlivia() ruauro;t4apto f3iaslm em(vsnu0tlenioctotla e uvsl()t2toxopiu1ap  mnvs ()aDuax o;o1opt ioeiltlaDemu ont) lenmo3ootop ranvslt0teuoxmpnodlme  nesa()sruaxm oo1olenif3iatls2ra(vpnu0aetoirctadoa  ln s;s  rurir oo1ll nlfcsl( sDrm(moou0opt  iciltfsDrluvp t)aexnmfciatopDe n sls0setr(r iy1lmtelfei (f ruaxmpno1altnii3iydfs2umumo;u4artrmocty1fmteau i ()srxr(opnudlm elfes ()s2tmu  oo4aeeoioetldlm2eau snu4trtoif3tytfmtelieo;(0 eurio iy1amtnlfeta()a2umur ;o0oltoio3iyslm2ea(mont)aexnmocoy1fm eanvslt0 eumio3iu1omeemfvia(  rtmurpno1tpenmf3iysfm uanvs u4aeermo ta1lp  lneils) 2xo(opoy1ope lnvs s)aDtaur ;o1tpxo i3tlsfmDrauvp;t0 lerxrcty1op rauei;t) etoxmpou4lmtnmnvilt) 2taxr ;o4aleoifctatls ra(mp ()aetoir tadlmtrau s;s) rtmxo3iu4alee fcs () 2urum ot4tlen o3tasfa2eanmsnt4arenxfctatfaDeanvol()s2trimpno4ope mfvs ()s2umu ont4optnioetydlaDumnvp t0 ltomrcty1lp eau i s0teum(mpno1altnlncsasfarurxmo;t1oeenif3tlt s2rl(vs (0tltomf oy1lmteln o t) rxrxm3iy4am nmnct (fs2trurpnt4oleo i3iyt s2uluvp;t)teeoxf3iatfpD  ueil( srto(o3ny4apeemncsatfs2rrurpno1tlxnifcias m ul(mpn()aetrio oodlat  i i s0texmxr ny1lmtn nei t aDurumpou1aexomiciadls eln s;t)aexrmf3oo1oa eaues s0sruoxrpiy4lm nmnvsat s2tr( ono4aptn f3iys a2rauvo u0tlxomo oadop rluei;( truo(o nu1lm e nvtat)aDumxrooo1aeen fetlsfa emumont0 exoxf3ia1fmDr iei t) euo(o no1om  mivta( sDta(mono1oee miciad mDrlu o;t4arxrxf3ty1laDeln i s0sexmir oodlmtemfvslsfsDtmxm ;u4apt  i3iasfa2ua(mpnt4 rtoif oytfptraieo;t)sruo(o nodlme micsl(fsrrr(  ;o4tet mfciad a rlnmont)alxnxf3totlate iei s  2xrxo3nu1apen nes tfa2uaur no1apeomfeiytls rauvo;u4 eeomrctytfmDe iesl(0 rxr(o ny1al emncsls) rraurp;o0opxomoeilslsDumu o t) exnio3oytomD  ivi;s)trxmxr3nodlmeelicia( s2tax  ot1tpxomfeiydfm raumon(4tlxoxr3iadom elivo t0setmimpiodol nlfvsltf Drm(rpoo1tpt  ietysfs2rlnmpnu0arxrmf totop rau s;t texo(o nydol n ieias arrmu p;t4oetoif3ils sDran o;u0tetrxf3todfaDr uvs () rxrxo3iy4aleelfcta( aDra(mpnt4olto iciytfmDra(msn(0alxrifciytlmDe nvi (0seumxm oodlme lneiat) 2raxrp;u4tee  oetyd m uaumo;u0arxrmr3tadomte uesl( tetoxr3ny4lltnlnetl( sDur( o;t0oet  feiyt aDran on(0aeerxo3totomDeai s s0 exoim3iu1lptelnvt ( srumur ou4tptomf3tydlm2eln p;u0aetoir iodlaD lnvo;t)srxr(opnodapeemfct s)srrmxmp;o0tpe ifeiydfsDrl( s;(0artrmrcoodlmDr neo;() rxo(o nudol eliesas sDrmurooo0alt if3tytfs ulumo;t)arenmf io1laD  ies s0s2tm(r3ny4ap   ivi ()s2trurpot1apt  o3tatfm2um( p t4tetrmfcoytfmDeluvs;( t2tmir3no1lpen ies t  rrm( o;o0apxnioeiatla ua( o t4texrir3to1oat ln ils  eto(o3iy1lpe  neia(faDtax  ;u0tlx io3iasla ran s t)aeeomf3iytom r uvolt setr(rpoy4ap emnciat sDurum ;u0aetnmi3iltlm ra(mpnt4tetrxrctotlpDelies (  2ur(opny1ll  mnvsltfsDum(  oo0oetnif3ilt sDrlump;(4altomr3tatfpteau il(0trumim oo4ll e neiatfaDrrxr ot4tpxnmoctad mDulump;t4 rxoxfctydomt lnei;( sruo(opny1lptelfviasf Dtrxrpot1apxnmictas m2emuvp;() exnxo3iydopteauvo;(0srxriopio1openlfcsls)srtrump;o1tex ifctys sDuau pnt0tlenio tydla rai sls)trumir oodap nmfvsls)a2trx pou1tlt mfeilsls ua(vo t)trtrir3tadoa e u s;(0 ruo(rpny1llen nvil(f 2tmum nu4tpto fetadls2rmnvsn(4aeerxf oa1lm rlueol(  eurio iydom emfvia(faDraxmpot4tex mo3iat m emn o t4artrxo3oatlpte neo s)teuoxrpoo4op   icsa(fsrtau pnu4oeeo f3iytfa ua( o u0tetrxfcoy1oa elu i s0 rum(opoudom n nvs tf Dur(mpno4tltnifcildfmDrlums;u4treoxr iydfptr ivi ()teumxr3io1al n fvtlt aDrrxrono1oeeo iciltla ul( onu0altnmocoytlmtr ivolt0t2tr(r iudomtelfet sf ruax  nu1optoiiciadfsDuaumonu)alerxfctytfm  luvs (0 etriopoudope mncta(f rum(moou4teeo f3ild mDra(msnt4texnxrciatoa e n s t0 2xrxm3no4alt mfeilt  Dur(r no4oleniieiat a ulu o;u)aeenmocoatomteli ils) eumxr3oodaptelneias  2tmu poo0apx if3iasla2um(ms (4texoxo3totopDean s;( srxoio3oo4ope lncsl()srrrxr nt4aee mo3iasfaDrl(mo (0texrifciodlaDrln o;(0seuoir3ny4omeelfetatf 2tau pnu1alt ifeiydfa2ran p;(4aexnio3ty1omDe uei;()sexmir oy4amt liviasfaruaur oo0apeo i3iyt a eau s;()trtoxr oatfpDr neo ()t2umio3oodomtemivsas s2rrxmoou1teeo i3ilt a2um(ms t4trtoir3iytlpDraueols0 2uriopio4om   fvtlt  rtmu p;u1alxn oetytfs ea(mpnu4 eenxf3io1fm eliei t) 2urxopnodomtnlnci ()s2ua( oou4aexo feiat m ulu s u4 lermr oo1oa raies s setoir oy1omt lnvtls)a2taump;t0aptomieiyslaDuau o t) lxnmf oa1opt  ueols0tetmxmpio1lp   ivt ()aDrr( o;o4aet ii3iytls2emuvp;t4 etnxocoo1oat  nes;( sexr(m3iydamtnlfcsa( aDumx  ;t4aleo i3tyd a ran p;(0 exrmrctytfpDrau o;( srumimpoo4lmte iciat arrr(  ;u4alto o3tyt a umuvo;t4alxoxrciytlat lieils0 ruoxr oy1lpe miesa()sDuax ooo1alxniictltla2rmnmp;(4aetoiocoy1fp rlneil(0 2uoxm3no4lmte feiltf 2tmxr ;t1aexnmf3iys aDum(ms;(0 rxomf3oodlptr nes t)t2toxo ny4op nmnesltfarrmxr nu0tlx mfciyd a ulu o;t4 etoir tytlm eliei ()srtoir3io1alee fetas) rurxmooo0tltn ociltla uanmpn()trermoctatlp  li sl()trxoio oudalt micils aDrrurpno0oexn o3iysls eauvp;t) rerxo oydlmDe ieo s) rtmxo oo4op  mnesas)s2tr(mp;t4apt iiciytfm uluvpnu)tetnmo oadop  li i;t) 2tr(r nodaltemfetas)srtmx  ;t0tptnmieiytfmDua( s u4texnxo3oa1lm r nvils) rtriopoydlleelncs (fsDuaxmont4oexo i3tad aDrau pnu)aexnmrctatfatrlivsls texoio3oo4lmen nctatfa2rm(mp;o4tpeo o3ias s eluvp t0 lenir3oodlm eli o t t2xrxr nodoptemfvtat  rtmxmpnu0tlxnmo3iytlsDuluvs t)aeeomo totfmDrlneo;t  rxoirpoy1amtnlict (f rururo;u1opto feiltfm2eanmpnt)artrmo iy1lpDr iei;s)s2uo(m3iodllen fei s  2rmxr ot1teto fetldlsDranmsnu0tltoxrctadla eaies;t)s2xrim3oudoltn fvtls artaxr nu4olxn fciadfaDrmu p;t0arxoxf oo1oateaneo (0sruoxr oy1lm nmfesl(fsrtaxmooo0tpe mi3tydlm el(vp;(0tlerxfciy1lm e uvi;s)seurim3io1openmnvt ( aDraxmo;t0tptoii3iadlaDemu s (4artnxo3iatoaDranvil()s2xoim no1lptn nctlt)aDrm(  no0apx  fctasfm rmnvs u4tltoxr3oa1omtranei s  rxoxopiudlmtemfctas aDuaxrp;t0tet mfetatla2ranvs;u0trenmrcta1lpDr nvil()texoxr3nudlpeemicsls)srum(moou4tpe  ociyslmDrmuvo (4 renioctatlp   ieilt0 2uriopoo1lm  liviasfaDtrur ot4oex  icildfs2uan sn() lxrio oatfptran ols0teurxr nudol emfvsat sDrru  ot4oltoiicils s2ulnvp t4teerif iydfaDranesl(0 2to(r ou4lm elnetat sDraur oo4alen o3tat m eluvp (4 lxomr3iatoptrli i s0seurxr3ou1ol emncil(  2tmx pno1apxomfetat s2rl(mo u0tltrxr oo1opDelueo (0srtoir3iodaltemics tfarrrxmo;u4aexo octytlmDeanvs;t4 leoiocoa1laD lnvolt) rxrxrpoo1olt  fcs t  rtm(mpnt1alxomf3ias sDrauvpnt4artrxf to1fp   uvs;() euo(opiydolenlfeilt  Drm(r ou4texn oeiadfsDeaums;t0texrif3iotopDrauvi;( t2urimpny4llen nvtl()a2ra(r ;u1oeeo f3tlt mDrlnvp;t)texniocio1fpt  uvo;t s2uoxm3no4al nmncs s)s2raxr nt0opeomfctyd a2emu s t)alxoif iotop r uvo;s  rxr(opio1op nlieslt srrru ooo0apt mi3ildlaDuluvs;t) rtoxfciy1lm rlu s t0 exoxopoydlmenmfctlt)srtmx pnu0tex if3tat mDrmuvs () rxrir3oadomDr ivs ()trtmxo oo1om n iesl( arrmx  oo1ope  o3ildls umnvs;u)arxnmr3ia1laD lu o t0 eumxr no4lpenmicils) rraxront0aleo f3tatfm um(mpnt0tltomfctydfaDe i sls)s2xriopiodlpte ivtlsfs2tm(mont0texo i3iytlm2rluvpnt0trerif3to1laD  uvo;t) 2umxo3iodapte ietat)s2ta(mpot1oeen iciyslaDranmsnu4areoio to1fpD anvilt)trxoimpoydom emnesl( s2tr(m no1teeoioctld a2ul( o;u) rxomo iodfaDe iei s0srxrio3no1ll   fcias aDtru pnu0tpe mfeiytfaDum( onu0 etomf3oadfptelivo ( srtm(rpio4llenlnvtatfsDtaxr nu0oleo iciydfaDuan pn(0alxomociydfm rlivol()s2xm(mpoy4omt micias)sDurxr ;t4aeeomietltlmDranmp;(4altnir totoaD au s;t)t2tm(r nydll elivslt  2rr(r no1oetoifciytfsDelnmsnu) rxoifcoytlmt anvs;s) eumir iu1amtelfeilt  2ra(monu1aee iociysls2rm( pnu4 rxoio3iodfa  aueils s2uo(o3oo4aptnmfctltf 2umx p;u1oeeoioeiasfa ua( pn(4aexoxfcoo1om eaiei (  rto(o3oy1omtn netltf rrmumont1aex iiciatfs elu pnt0altrmo3iydla r nvslt0srtoxr iy4lp elnciat)s2rmx onu0tpeoioeiadfa2el(vo;()tltriociydfmtr i o;t)sexrxm ny4omtnlfctas aDumxmo;o4tpt ii3ildfs um(mp (0altrio3ta1fmteaneol() rxmxmpio1amtemfvils)aDrmu onu1oetnmfetysls2elu s;u0aexoxr3oadlpt  uvs;s)trtrxr oo4lle  nvsatfa2tm(r ;u1opxniociyslaDrlnms;u4aeermf oa1fpt anei s)s2xmxm3nydopeelfesa( s2umx pno0olt mo3tlsfm umnvpnu)aeeomo3oytopDr i sl() rxr(opnu1olen ietlt)aDrmx onu1oltnmiciyd mDumn o;u) rermf iadlat lu i;(  2tm(o3io1ameemfes ( srraurp;o1apxn feildlm em(mo u4arxoxocoatfat  nvo;()s2ur(r io1lmt  fctlsfsrrmu oot4alxnmf3iadlm2ea( s;(0trtomo ootla r n o t s2trxm iu1lm n nct () Dtrur oo0opx ifeilt m2ean o u4 ltnifcta1la elues;s0trtrxrpiydlmtemiesl(f Drrump;t4teen o3ild m rluvo;t0treoio3to1omteli o;t  rxoirpoodop elies ()srur( o;u0tpe  oeiaslm umumsnu) etoxr iatfp r u i;(0teuoxrpnu4ap  mfcsls aDum(rpnt0oeenmfeiyt a rau o;t0 lxoxf todlmD aivolt sruoxo oudol   nvslt)srtau ooo4oltnif3ildfs em(msn(0tlxnxo3iydla raneolt)t2um(o io1apt  fcs t)s2urumonu4tet  ociad s ranms u4trtrxo3oo1laDranes;t0t2xo(r no4altemiet ()arra(ronu1oltn fciasfm uln s () rxnir3oytfpDraivslt0 exm(r no1am elnes s)aDrmx ont1aleo ociadlm2elumsn()trxnmo oadlpDeluvol(  2tmxm iy1aptnmnetlt a2taxr nu4tetnio3tld sDrm( onu4tltnir io1op   i i;() rxrxmpou4ame  ivi t) rtm(moou4oexomieiat m ea( snt4tlenxf iodlpDran olt0 2xrxr3iydll nmnct (fs2rrxm nu4ope mfctldlmDua(vp;t0 rxoxr ia1oatrlueols t2xrirpnodlm nlivs ( aDuru  ;t4oltnmo3ildls uluvpnt4 ltnmrctytfpD  i o;t  2uo(opou1lpee ivs sfa2uaxmoou1apt ii3ils a rlnmo (4tleomo oo1fp   nes t0 eumxm3ou1omenmnesas) 2tr(  oo0olx  feilt a2ra(vo;t0tlenxr3tatomteau s;s  etoxr nydam nlici s) Drrurpno1ale mfctlt aDranvo (0arxnxf oo1lm e n o;(  rtmxr no4op e ics tfaDtmum ;o4oeeomiciadfm rmnmsnt4 rtoiocia1la e ivols0 2uo(o oo1lmt  nct ()s2rm( o;t1apeo o3tysla2eln o;u)aeerxfciatlmteaies;(  eumxr oudoleelfesa(fa2trxmpot1tpen i3ilsla2rlnms u)alxoxfcoadlpDr iei;( s2uoio3nu4am e iei (fa2uaur ;t1aeenifeiatfsDem(mp;(4 rtrxf3to1faDeaies;( srxr(r3ny4apenmncsa(fsruaxr ot1tlenmf3iyslmDrmn pnt0areoir iotlpDr ieslt0seuoxr3nydomtemfvil(f Dtauro;o4olto o3tydlm2rl(mp (4altrmf3iytomD luvi t0 rxmxrpoydlleemnct (  Drrx pnu4olto i3ilslm2ulu s (0aexomr ta1lm rlu o t)seurxo nu1alt mivtas)s2trxm nu0aetomoetlsfm rmu s (0 ltrir oodlmDrauvi;() rurio3nudlpe lnei t)aDtm( oot1oex iociydfa uanvont4tltnmf3oodlpDran i ()s2tr(rpny1omt mfcs sfs2rmx  ot1aetoioctldlm ulu s u4arenxo3tytlpDeauvo ( s2toir3ou4ol e ivtas) Dtau pnu4aetnmi3iysfmDuau snu4areoiociatlat aivslt0 rxr(m oydlle  fesl( a2umxm nt1apeniieiad a rlu p t4alxnmr3iydopD an s;t s2ur(rpou1lmt lfesas)srraxmono0olt iictydfa2eauvs;t) ltrmf3to1opteliei t seto(rpiy1am  mneil(f rtau  ;u4oltomfctas aDumnvpnt0 leoxocoo1laDe u o s0 2trxopnudolt mfesl( aDrr(r ;o0tpenmfcildfsDum(mp (0tlxnif3oy1opDrln ilt trurxr3oo1apen fetls) Drmxmpnu0tpto octatfs ean pnu0tetrir3ootfa rlneslt t2uoxm iu1llenlnesa(f 2tm(r nu0opx  i3iadlm rlnmpnu4artoxr oydoa e ivil( s2to(mpnu4lleelfvs s)sDra(rpno1aex  ociysfsDuln o;t) rerxf3io1fmDrai s ()sruoir3iy4lmeelnctat srrau pno0apt  i3tlt sDelnmpnu0alxrxr todla raieil( t2xmxr3oy1apenmivt tf rtaxmoou0opx mi3tls s2eau o u)aetomr tytfm   ieilt0s2xoimpiu1llt mfesatfsDrmxronu4tpx mietlt aDrmuvp;u0 etoxocootlm e n i;t)tetm(m3ny4omtelncilt)sDraxr nt4oexomociyt s2eanmpnu0treoxo tadlpDrln olt0sruo(o iu1lmeelfvsas) Drrumont4oeen icildfaDeaump;(4tlermocoodlmDelueslt trxmiopiy1lmen ivtltfa2rrx  ot4opt ii3iat a um(vs;t)artrio oadoaDrli o s  etmim nydom elncsa( s2umxro;t1aptnio3iat s2ulu o;(4 leoxr iy1lptean o t t2uo(opoydop e fvs tfsruaxro;t0oexo ieiytfsDran o;u4trenmr ty1lp eauei;s0s2tm(m io1lmte fvs (fsrumxrp;u1alen icilt a2rl(mp;() renircia1laDelivs s) 2to(opoudole mneiatfa2tmx pnu0oeeo fetld a rau p;t)texoxocty1opD aueo s)seuoxr3oudale mivs ( a2ta(mp;u0apeo ieiadfa ul(vo (4 exnxo ia1fm  an i t)t2uoxm3nodlmeeliesatfarrau  nt1aleoif3ias a2eluvp (4 rtrxf3to1laDrli il() 2uoxr3ny4optnlnvi tfs2tm(root1tpx  feildfsDeanmonu4tetoxf oatfa  aneo;(0teuoxo nu1altnlfvsat) 2tmu p;t0tle ioctlt mDrmuvs (4 renxo3ta1fmDrai s s0s2xmxrpiydale mivtl(  Drrxmo;u0apx  octasla ulnvpnt4tlxoifcoydfmDr iesl( s2xoir nudomte nci t)sDururoou0aexniietytla2uanmsnt4alxnifcoytlp   n o;t0seuoxr oudol e ivs t) rtr(ront4tpx mo3ias s umn onu)alxrifcootoatrli i s0s2xrimpnodllt lfctat artaump;t0aexoifeildfm2uln sn(4texnmocoy1opD aues (0trto(m3ou1ll nmfvt t arrmum ot1alxnmictydla rluvont4altomfciy1laD an i;t)t2uoxo3iydlmeelietl()artr(r ;o4apxn fcilsls emnvp;(4 rtoxrciadomDrliei;() 2xrim3io4ll elfcsasfartrumpoo4tetn i3tytfm2ul( s u)tetrmrcoy1fm e uvs (0sexmir oudlp elnvilsf 2tmurpno4aeeniocildla uluvs u)texrxrcootlm  lies t0 2xm(o no4olen ics sfs2raxroou0aee  f3ild a2emnmsn()artrmr3tatfm  aies (0texmxrpiydlle  nvilsfsDrmx o;u0oleo fcilt a rl(vsn()tlermr iy1lm e neols0 rtoxm3ou4opte netls)sDrmx  ;t0opto feildfs2uau snt)altnxr iatopte uvilt0s2xrxo3oudopen fvs t)aDrmx ont0olx  i3iat a2ul( pnu4arxoxo3totom eluvi ()srxmio3iydllee ncslt)arrax oot1olxo i3ildfmDemu pnu0alxrxf3to1lp r ies;s t2xo(rpiu1open fciat)s2ua( o;o4oex mi3ildfm ra(msn() leomr3iydfpt lneols srumxo oy4opte fesat)s2tau onu1tpt ioeiyd a ua( ont4altoxo ia1opD anvi;s)srtoio3nu1lmenmivil()s2um( pnu1oet io3tyslmDem(msn(4arenif oydom eln i t)trxr(r3iodlp nlfctl()aDumuront4oeenmfeiytfaDul( o;u0aetnmocootlm e i ol(  2trio oydlmenmncs ( s2ta(  nt4aee  i3iltls rmums;u4arxoif3tytfm  anes s  rxmxm3no4lmte ivt sfsDra(r nt4oeto o3tlslm2eaump u0 renxfciodlm e nvslt0trxoir oy1am  miesatf rtm(m ;o4aexn o3tyd a eanvpnt4aeenmfcootop rlu ils)sexoirpnodoptnmneia(  2tmump;t1opeo oetldlaDemuvs;t4 rermr iatlpt aieols teur(o3oy4ope mnvtl(  2uaxroou1olt mfetytlm2rluvp t0trerxfctodfm eaues s0sruo(r no1ll  livsl( a2raxronu1tpxn o3ias m umn p t) lxnioctydfaDelnvi;s0 2uoimpnydape livsasf Drmxmono0tetnmfciytfs rau s;t4 rtoxo ta1omD  n s (0 exrxo ny4apte ics (faDumur ;t4aleoio3tatlm2eanvo;t) lxomrciodfmD  nvils)texmxo3no4lpe  icia(fsDtmumono1ape iiciasfsDum( ont0tetomrcootfat li o s)sexrir3ou1apt  ietlt)a2trx  oo1oexo fciydfs2ua(vs;t0texomo ta1omteluesls0 2uoxmpoydlp   ncsl(fsrtaxmpou4apxniieilsfaDum(mp;u) rtnio3tadopDe nvi ()srumxo oydom nlicilt)artaxmp;o4tlen o3iat m uanmon(0 exnirciytoaDraneo;s)texo(mpoy4ll nlnet (fsDrrxmp;o0tet ifciys m2el( o;u4aeerifcoy1optraies s) rxr(o iodlptnmfctltfarrrxr no1altnmfciatfs rln s t)texrmfcoo1omte u i t)t2toirpiodopee ivtasf Drau  ou4oeeoiiciys m ua( s;(0arxnifcio1laDrli s ( s2umimpnu1op  lneiat) 2rr(rpnt4aexo o3iadfm eau s u4aetrircoytlmDelnvil(0trxmxr oydlpenlici s s2tru  nu1tptn ociyd s2uaums;t0aexoircta1oat  u i;(0tetrio nu1apee ivt t  rtm(m oo0aeeomi3iatfm rlumpnu)tetoir3oodomt lnvi t) 2uo(o3nydame livias sDua(ro;o1opt if3iasfm2rmuvo () eenio3oodfa   uvolt  rumirpno4lm nlicsatf 2uaxmpno0tlxo ietysfa ra(vo t)aeenircty1omtrluei;() rum(r3nodamtnmfvtasf rtax  ou4opx if3iatfsDulnvsnt0aeeoxfciodfp raiesl( trtoxr3oudaltnmfetasfaDtr(mo;u1alt ifciyt mDean p u4aleomr3oo1la rauvi t0t2umxopoydole lfvils  rtmxmonu0alx ifcilsfa emu s u4 rermrcty1fmtrli ol(  exmio3oydal emncsls)sDumxmoot0texn fciatfs eln on()trtrxf oa1op rlivi;(  rur(r oodapte neil(fs2umx poo4aex  i3iytlaDrmumsnu) etnmf tatfpD anvi;s)t2xoxo iu1om nlicsltfs2tmxrono0opx mi3iasfm rm(vp;t) leoxocio1oatr uvsl(0teurio ny4llt mneiat) 2ta(mp;o4apt mieilt mDean p;u4areomr3iotlp e uvs t  2tr(o iu4opt lfvs (faDum(m ;t4oetoif3iasls umuvs;u4aeenmrcoa1la e i ol() exrxmpoy4amt  ieilsfsDur(ro;o1tpe ifetld sDuanvon()aeenmfcta1fp raiei ( t2xmxo oo1omeemfcils)aDurxmoou4apx  ieiydfaDrlu o u4altnxociytopt an sls)srtmio io4apte ivil()aDrr(ront4olxoiieiydla ra(vo;t0tetomr ty1fmD  ieols0 eum(r oo1lmtnmictl()aDraurpnt4apx  o3tatlsDemu o t0arxoxociotlmD lu s;t0trtoirpno4al  mivsas)a2urum ou4tleomf3tys s ra( s;u) eerir3tydlmtelnvo s0t2urir iy1ol   ict t)aruaurpno0tpe iociltla ulump;() ltomf3tadfm  anes s0s2tmirpno1apt  fcilt)sDur( pot4olenio3tlt s emu s;()arenif to1laDelivo t0teum(m3oo1lltemnvt tfaDuaxr ot0olt mo3tat m rl(ms;u0tlxrmociodlp  an o s)teumim3nydlpt  fci t sDrauro;t4apt ifeiysfa em( sn(0altrmf3oatopt ai o ()trtoxopny4al elfvil(  rumx ooo0tetoioetysla ul( on(0 exnif3oytlp e uvi s)tetoxmpiy1al nlictat)aDtaxrooo4tex mociys mDrln s u4aexoif iytfm   uei;s) etmimpiy4lle mfesl( arum( ont0tlxnmictas m ra(vs t4aetnircoo1optrauvils)trxoxo3ny4opt  icta()s2tm(mpnu4teenifetat aDrl( snt4artrxfcta1fmt  i ols t2urim3oy1lp emncsa(fsrum(rono4tpt  o3iydla2emu s u4artoxrciydopDrauvi s setoim3nu1ll nlnetat)sDtm(mpno4apxn feils a um(mo;t0texnio3ty1omDrli olt0t2umim3iy4lpe lfei ()s2ra(r nu4optnmo3iasfm eauvp;()teeomo3oa1fp  lnvi;s0 eurxr3iydol n nvslt aDtrumpnu0oexnio3ilsfa2uan o;u4 exomr iy1fat livs;s)s2ur(o iudapenmivia()sDtm( p;o4altnmictyt m em(vs;t)arerxr3oytomtr ivs t setr(o no1lmte fet tfsrua(m nt4opx ifctadla ra( o;u)teermf ty1fate uvsl(0 rtr(opiodlm  lfetl(farrm(mpnu4oex  o3iad s2ean on(0tlxnxr ootomD lneo;s0 2trxm iudomenmict s s2tax  ot0apx ifeildlsDelump t)tlxnio iodoaDrluesl(0 2xo(o ou1llt lfctltfsDrmxrpnu4oeenifctydfaDrmuvo;(4 lxomr3totop eanes s s2tmxr iy4lpe mnet sfsDra(mp;o0alxomfeildla ulnvpn()aleoxfciydfp ranei;s  2tmirpnodlptelneil(farrmurp;u1texn i3iytfs2uaumo;t)tlxrmf3tytlp el
\ No newline at end of file
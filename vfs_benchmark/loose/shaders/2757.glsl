@@ -0,0 +1 @@
+nvs s) 2trxr iudomtemnet (f Dtaxm ;t0oetn ociyd aDrln o t4 ltoir3totfaDr nes s  2to(o oudame lnci t)srrax  ot4tptnif3tysfm uluvs ()aleoxf3ta1latran slt0srto(opiydame  ictasfartax poo1apen icildla umumo;u4altoxo tadfmtrlueils)seuo(opiodlmee net tf rtm(mooo4texnmfciatlm2rl(vo;(4 rtnmr iadfm rluvs (0teumio3oy4aptnlfvs sfs2tmum ;u1aptomoeils a2umnvsnt4 reoxr3tydlpDeaneo t  euo(m oo4lme mnct s)sDumu  ;o0aptoifctlt mDrl(mp (0alxnmocto1oaD lneo (  2urxm ny4ale mnvs () 2umxr ;t4tetnmoctadls rlnmonu)tlenifciatfaD  n slt0teumim nu1ol nlnei (  rrruro;t4aexn ietyt a2elnmp;u0 eenxo3tadopDr neo (0s2xoir no4op  lieilt artmx  ot1openif3iatfsDul(msnt4 lenir3ia1om e nvi;s)s2tm(m3oydol  lneiat)arum(root1opxniietatfm2eln sn(4tltnmr iatopte uvi;( sexrxr io1ll  mics t)aDrmxr no1tptnioctlsls elumpnt4 eeomf todlp rlnesl(0 2uo(rpoydom   nvs ( s2rrx onu0opx mi3ils s2umuvont4teeoxfcootfatr ies s)t2uo(m3oo1ame mfviat s2umxmooo1tlenmo3iytfm emnmo u) exnxf3todlat  ivo;t)s2uoim oo4al emivtas aDrm(m nt0altn ictldfm2uauvsn()texrif3ootlmD ai sl(0s2uo(o3oydoltnmfvi (farua(r no4tpx ii3iad a2rmu pnu)aleomf3oytfptrli ols trur(o3iu4ol nlivilt  2rmur oo0alx mietyt sDelnmon(0 lxoxf3iy1omt ai il( t2urirpou4lmeelietlt)sDum(r no0tptomfeiydfaDrluvp u)trtnmr3ta1faD lu s;t0teuo(o3nodope mivt tfa2um(moot0tpen oetlsfsDul( o (4texnmr3iytfpt aieo s) 2xm(r oy4lltelicilt sDtaumpoo1altoifciydlm2uluvpnu) exrmr tytlm raies;s)s2xmxm3iydoptnmfcia(  2rm( o;t0oexoifetyd m umu ont4altrifcty1faDelieol( srxr(m3nudolenmnvi sf rur(moot4oltnmfetlslaDemn s;u4arxrxf tytfatrai ol(0seuoir iydllen nct sf Drmxmp;t1aex mfciadla uau o;t4 lxrxrctodla  lieols)tetoim3nu1om n fvs t a2umum ;u1alx  i3iytfm eanms ()alxnmrcoadlate neslt) 2trxo nydomt micta(faDrr( ont1altnmoctadfa2um(mpnu0tlxnxr3oytoa rluvo ( trxoxo oo1lm nlnvsasfsrtm(mpnu4tet  o3iltlsDran p;u0 etoio ta1om  anei t0t2xr(o io1ame lfctat) 2urur ;o4aeenmfetlsfm ulu p u)tetoio todfa e ivi;(0trurim3iudal n fvtlt  Drmx pnt1teeo o3ilt s2rmumo;t4trxoio3oy1oa   n i;t trxrirpiy1aptnmietl(farua(mo;t1olxn oeildfsDeaump t4tlxoxf3ia1op eauvols0s2umir iodope lfctat) Dtaur ;o4teeomo3iasfm2elnvpnt4 ltrio3tytfate nes;t0teum(r iy4ole micsatf 2umxm nu4tpxn oeiatlm2uau snt0 rxnmr tytfp rluei;() etmxmpnudolte ivs ( arraxr no0tpt ifeiasfm2emnvo u0 etrxrciytoatrlnvolt t2um(mpiy4omt lnvil(  rurx  ;o4oltnmo3iyslaDumuvsn(4tlerifcoy1lp  auvs (0s2xmir iydlptnmncias)aDtrumpno4ape  f3iytfsDemn ont0 rxnxr tatoatrauvs;s srtr(o nydaptemfvtasf 2tax o;t4opt moetld a2ra( p;u)aeenmocootopte ivsls0 rtmimpnu1aptemivi (f Dtm(  ;u1tex  i3tatfmDrmu p;u0texnio to1omDe nesls) 2xm(opnu4op  liei tfsrurxr ot4altoiietydls ul(vp t)teeomo oo1latr ivi t teum(o iu4ap elfctls s2ua(roou4tltnmf3tydlm rl( o (4teerxf oo1opte n o t0seumir3nydamtn fctas) 2rmx ooo1oltniicild s um(vp;t)alerxrctatoatr ivi;( trtm(m3oodomenmictl(f 2tm( p;o0tpenmo3iad s ranvpn()altomrcio1fptr ivslt  rurxrpno1lptelneslt s2trx  ou4apx mictlsls ra(mo;()tltoif oytopt  i o t seuoxmpoo4lmtnlfes ()srtax  nt1apxn iciadfm rln s u)aetnif3oydfm e i o (0trxmxm3nodll  mncta()a2um(mo;t4apxoiociaslm2em(vpn(4artomrcoydlat li i;s)t2xoxo3io1ol  mfcsl()srur(rp;t4olx mi3iasfa2ea(vpn(0artomoctodfpDeanes;( teur(o ou4llen ncsls)a2uaxront4alen ocildla uan on(4aetoxfcoa1fp   n o (0seur(m oo4amenmncil()sDraxmoou4tpxo oetydfm emuvp t)tltomo ia1fa  luesl( t2xoio oodomeemietlt)srrr(mo;o0alxn fciytfs2ea( ont4alerir3iytoaDr nvs (  rum(rpiu4apenmfcsl()aDur(  oo0aetn i3tas m uan p t)trxrmf iy1la r i i ()t2xo(rpny4lmenmfcs sf rrmxm nu1olx  i3iad a um(vont)tlermo oydomDelu ils tetmxmpoodape livsasf 2umum no4aexn f3iasls2ua(mo u)tltrio iodfptrlu i;t t2urir3io1lpte ietat srra( oot0olt if3tyt s2rlu snt) exrio3tytomD lneilt)teto(r3iydome mnvtat  rtaxmpnt0tlx ii3tyt m uanvp;(0 rtnif3oadlmte uvs s0tetrxm nu1lpen nvsat)a2tmu  ot0teto octyd a rm(ms (0 eenifctodfaDeau sl(0teur(mpny4optemnes sfs2rmurpou4aptomfetatfm2emnmont) rxoxo to1oatrluei (  rto(o ny1ome liviltfsrtr(rpnt0oet moctyd aDrmn pn(4tltrmrcta1fp e nvs t0 2tmir3ny1aptnlfci t srtaur oo4aeto fcilsls2rl(vsnt0aexrxo oy1la raneo;(0trxr(m oydam nmnvils arrmxront0apxomoeiydfm2umnmont4areoxfcoatfat aues;( sexmxo3oo1lp emfcia(f rta(  ;t4oeeo fetas mDrl( p;u0tltomocio1fa eaueo t) euoio nudop n ieils)srurur ;o4openiociasfsDeanvp;u0alermo to1lat lu i t)s2tm(rpnu1omtemicsatf Dur(mooo1aptn oetytlm2rlu p t)texomrcty1la  luvs t0setr(r3iydam  livt t)srum(r oo1oeeo fcilsfs emuvs;() lxnxf3ootom  au s t  etmxr no1lm  mnvs s aruaxrooo0olxnifctyt m2ul( pnt4 rtnmfcootlpDrau il(0t2xm(opiu1amenmnctlt) rrm(  ou0tpe ifciatfs2rm(ms;(0 etnxf oytopteluvi ()tetm(mpiudopenmnet s)s2ur(monu4tpenioeiatfa2uau snu0 exrxo3tydlpD aies;t trtmxm3iu1ome mfesas)s2tax pot4opxoii3tltfaDulump t0 ltoxf iytop elnvs;t0srxoxrpoydole  nvsasfsrtmurp;u1oexn f3tysfs uln s;t0aleomf3tadop r ivslt  etr(o nu1lm e fcias)sDtax  no4aexomf3iydfaDuaump;t)teeomo oadoptraivo;()trxm(rpny4apee ncsl(fsrurxmpou4tlx  ictadlm eluvp (4tlxoxr3to1omte ieo;t0s2trir io1ap e ivs (fsDta(m ;o1tpe  f3ias aDua(ms (4 rtnxf3ty1la ean il()texrio3oy4opeelies s)s2ua(ront4aptniictytfa2ua(ms t0aexnif3to1fmtelieils0seuoir3ou1lp nmnvta()a2umump;u1olenmietytlm ra( o;t0artnxr tytfmtrluvo;()srumxo3iydaptnlivtltf rtmxr ;t0aeenmo3iyt m2em(vp t) lxrmrcta1la raues (0 etoimpnu4om nlnetatf rtmx ono1tltoifetasfmDrl( p ()tlxrxf ta1omteanvs t)teurxo iudll e nciat  rraxmp;t4tlx  fciltlm rlnvpnu4tetomo oadfm  aues s0tetrxr3iu4lmen fvsl(  rta(ro;o4oetnmfciatfa umn o;u) ltnmr oadlptr i s ( trxrir3iu1ale lncta(fa2rax  no1oltnifctadfsDulnmp u0tltrifciy1op rauvi;t0t2xmxr3ou4al n ncil( s2tm(r ot4openmictltlsDrlnvpnu0 rermr oadfpDrai ols0setrxo ou1amenlnetls)arumurono4olxoii3tasfsDul(vonu)tleoif3ia1fm elieo t0srto(m3nodol   ncsa()srrr(r ;u0tpe  o3ildfmDrmnmonu) ltnmfciydfpt ln i;s0srxo(o3oy1aptemfcsl(f 2rmx ono0oltnmf3iydla ua(vp (4 eeoif oadfmteaneols0s2ur(rpiy1ll emietatf rta(mooo0alxn ietydfa eau ont)aexnmrctatfmDr ivi;( setr(m3nudomtnlicil()a2rm( poo1tpeo oetysfa2rm( snt) lxoio ta1lm rauvilt)texrxrpno4llenmies () rrrxmono1teeo ieilsfs ua(mo t4tleomo3tatfpDe uei;s) 2ur(r ny4om   nesa(faDrr( onu1aeeomiciasls rau p u)arxomf todlm eli o;s0srtr(opou4lm  mncsatfsDrmxmo;o0optomf3iytls emn p;u0alenxf oo1lpteai il(0 exm(m3ou4lmenliei sfsrrmur ;o0tpe io3tltlm2umump;()treriocoadoa rlneo;s0 rxr(o iodapeelict sfaDraxmo;o1oee mfctyt a raums u4 ltrio3oydfptelneo s  2trim3oudolenmieia(  rrrum ot1oex mi3tyslsDulnvo t4alenirciatlpt auvs;t) ruo(opoydolee fesatfaDrau pot1olenio3iad s uau ont)tltnxr iotlp eai s;() 2uoxrpio4am nmfetls  Drr(r nu0aetomiciyslaDrm( o () ltrifctatfmt lueo;s t2toiopoodoptemivsat  2tauro;u1oexomfetldlm2ra(vpn(4tlenio iadfaD lu sls)seur(o iydop  livia(f 2rr(rp;o4altnifctytlmDeaump u)trtomfcta1lp rai o;s0srxrxo3oo4opeeliei sf rtmu p;t0apx mfciys a ua(mp t4 rerxo iy1faDrlueo;t)srto(r3nodlpen fcil( s2tmu pnt4tltomi3tlt s ra(msnu0 exoxr iy1omD anei;(  etrir io1olte nctat)aruaxm ;t4oee mieiaslm rl( o;(0aetrifctadfmt  i slt t2uoimpoydomtemfcsl( srur(rono1alenifetld m el( o ()tlxrxfcoydfpDe iei;t0srxrir3oo1lm n ivtas a2tm(mpno0tpe  feiyt s2rmumont)tltoio3ty1opteaivolt seuo(r3nudape mncslt arumumono4oex if3tys sDel(vo u4artoircootfaDr ivo;( tetoio oy4ale  nvs s) Drrurp;u4oee  icilsla elu pn(4trtoir3iatomDrai s;(0s2uoxm3nydameelfeta() 2raxrpoo4tptn ieiys a2emn p;u) exomf3oy1fmtr i sls0srxmxm oodol nmnet ( sDrmxroou0oee ioctyslaDuauvo t4arxomo totom rlnvs s0trumxm iodalt  fcs (  2tmxm ou1oleomfeiydlm rlnvp () rtrmr3tadfm eln i s)srur(o3oy4omen ivtat)s2rmxroot4alx  i3ilslaDeau p t4 rxnif3tadfpD au i ( s2um(m ou4lle  iei tfarurxront0aexo f3iadlm2eauvsnt) exoir iodfmte i o;t0trxoxmpoo1lmeelfvtlt  Drmxm ou0ape mictadls elu o u)texnir iadomt  ivils)sruoio3io1lpe mnesls)arta(m ;t4apenmfeiytlmDraums u0texrmociy1oa  ln s s0 exmxmpio4lltn fcias)sDta( pou4opx ifctlslm rluvp;u)alenxrciadfpD li i;(0trtm(o nydlltn nct s a2rrx poo1texoio3iadfm elnvs;(4 lenxo ty1optelnei (  rtmir ou4aptemivia()a2umxrono1aptn i3tasla ra(vsn(0 lxnir3oytfp  lnvols)seurxr iy1altelfetlt) rra(rp;t4aeen ictasls2uanvpn() lxrxfcoa1lmDr nei;() etoxopno4alt mfvtl(fa2rax o;u4tltomoeild m ea( s;u0 eenir tydfm rlneo t) etoio ny4olt lnvias aruaxmpou4apeomoetldfm umn p (0tltomr3oydopDrau ol( s2xmxm3nudapt  nvt sf 2um(mo;t4ole mo3iatfm um( s;u) rxrmr3to1fa raneol() 2um(o no1ap emfci s) Dtmxrp;o4openioctad aDrl(vpn(4 rxnxf3oo1fpteln o;s trtmio3io4oleemnvsls sDumur nu1aeeo o3iytfs uln s u4arerxr3oy1lpDe ueils0 eumim3nydll  lfvsa( a2rr(mpou0tet ifetltlaDemuvo;u0 rxnio tadomtranvo (  2xo(m io4opte ivi ( a2rrurpoo4oeeo o3iydlm2eanvsnt4 ltrxfcto1fm  ln s;t0srtmio iy4omt lict ( aDumxmpno1tltn fetydls umnvs;(4altriocootlmtelu i t)seuo(o3nydolt mnvtlt arurur ;t0aleo f3ilsfm ua(vsnt0trenmo iydfpD ln o t)tetrxo3oy1omenlivsasfarumxrp;o4tex mf3iysfsDrm(ms t0aeermf3todopD aivil() etr(r3iydale  fvtltf 2raumpnt1open fctlsls uauvp;u)trxrxfcia1lateanvs;s setr(r oy4amtnmnetatfa2um(mpno1tpx  ictlt sDea(mp;(0 etnmf tadfp rln slt)trxo(m nudolt mfci tf 2uaurp;t0tlenmoeiaslaDulumsnt4tltoiociatfpte uvslt0trxo(m3ou1lme lncslt) Dta(rpnt0tpxnmo3iyslm2elnvs t0 renif totlp eluvs;t) etr(rpou4ome lfcsa(fsDraxr nt0tlx  fciltfa2emnmpnt)alenmf3oytoaDeaueslt)trtmxr3no4lme lfeias)arurumo;t4tleomoeiytls2uauvp t)aeerxf3to1lmD lnvs;()srto(m3nodlpenlicsl( srtmu  ou4oeeomieiltfm eanmo t0alenifciadfp  ln ol(0seuoio3iy1lptnmnei sf rua(m ;t0oltomiciltlmDumn o;t4texomf3iadfat  uvolt0srurxopiudapt mivtl() rrmx poo4olx ifeilsfmDua( s (0 rtrxo iadfatraiesls0s2tmiopnudll n fvsl( sDraurpoo1aet miciydfmDuaumsn(0arxrxfcoa1faDe n i s)teum(m3oo1ol elict s sDumx  ou1oex if3tadlaDelump;() rxomrctadfmteau ilt0trxo(rpno1open fes (faDurxmp;t4tptnio3tyt aDuluvsnt0 eenirciotfate uvil(  2xmim io1amtemnei tfarta(mp;o0oetoio3iat mDuluvs;t)altriocia1laD aneils0 eurxm oydapt lnvs s)srrr(mpot1oex  i3iysla ua(msnu)tlxnmocoodfateaieilt) 2umxrpoy1amtn iesas) Drru poo1tltoiieiys aDumumo ()teenio iotlate i slt0s2tm(o iu4ole  ivtlt)arrmxr ou4tltn o3tltla emnvp;(4 eermf iy1omteau il(0srxr(m iy1lptnmicilsf rua( ont4alx moeild a2umumo u0texrmr3oodla  au o s)texrxm ou4lme  neil()s2tmxmono0oexomo3iatlm uanvsnu0 etnxo ty1lpDr ueolt)s2ur(mpnu4al e fctasfsrtau o;t4tleoioctatfa rl( o t)teenmo3ta1latelivsl(0 etrxrpiy1apeelici s)aDra(m oo4tetn ietys s2ra( on(4aexnxf iytfpDr nvo t0truoir3iu1llte fvsls a2urxrp;u1aexniictyt a ul(mp;u)trermf tadom  an i s)srtr(rpou4ap  livi (fsrur(moot0aleoifciltla uau pn(4 etrif3oa1opDr ueo;(0sexoxrpnu1lleelnetl( srraur ot1oeeoio3iltfmDul( p t4aexrir3oadlaDr i o t srtm(r oydaptelfes s s2trum nu1tpt  f3tls aDemums;u0tltrir ia1faDranes;t  rto(m ny1lmenmfvt t) Drmurp;u4ope moetytfaDum(vs u4altrmr ta1lmDeau ols)texrio ou4lp n feslt) rtm( p;u4tlxomicilsla2eaumo t4 ltnxf tadfp r ivo;t0 etmxrpno1opte ncs s  2ua(  no0aleoio3ias aDuaumo;()tlxomf3iytlp eanvol()t2urir no1ap e nei (fsrtaumpnu0aptnif3tld m2eanvs u4 eeriocoytlpD  ieilt0 2ur(rpiudlp nlnct s  2um(rpou0oet  i3ias m2eauvs u4tlxrmf3oo1fa  auesls)t2xoxm oy1lme  ncta()s2tm(mpoo1apto ieildfmDua( pnt0arxoir3tatfm r i o;s) rxrio nydlmen nvils)sDur( poo4olxoio3tat sDrl(msn(4 rxnif todfa  auvo;s)tetoim3oy4llt lictatfa2trx pno0aetn ieiysfm2ua(vo ()aeeoir todlmtr nvols0 rtoim3ny1ap elfvilt)aruaxrp;t4aeeoio3ilslsDulumsn(0aeenmo oodlp eliesl(0truoxm3iu1lmt liviat)aruaxmp;t4oex ifeildfsDrl( pn(4aetrxrciytfp e nvolt seuo(opiudamtn icslsfsrtm(r oo4aexoioetatla2rmu p;(0tlxomo3iodfmt luvs;s0seuoxmpoo1amee fciat) Dta( oou1tlxn i3iaslsDeaumsnu0tlxomr3iy1opt luei;s)trtm(m iy1opt mnct s)aDuru o;t4opeo fciys s2raumsn()tlerirctatoa  lieo t) 2xm(o iudol e ivias) Dtru  ou1tlxo f3ilslm2el(mp t0tlenmrcio1fpDeluvo s) euoim3no4om nmfetas srraxro;u1alxoioctlt aDemu on(4trtnxr tydoaDelnvs s0 2tmxo3nudopee fvils) Dtru poo4tpx ioctldfm2emnvp;u) exrmf3oa1optranvo s)texo(opoy1altnmfcsatfsrum(rpno1alen o3tytlsDemu s;t0 eerxf oy1omDeaueo t s2urxo io4amtelivslt  Duau pno0tet ifeildfa2el(mo;u0alxnxr ia1optranes;( t2tmxo io1ap e ici s) rumu  no1aptnmiciysls2ulums u) rxoxr oydlat lnes;(0 eum(m3ny1ll emncsl( s2trum oo1aleoio3tlslsDrmu s;t4tleriociotlptr i sls  eum(r3oodom emfesl( aDuaumo;t4oltnmo3iytfa2elnvs (0trxnxociy1lmDeanvsl()trxmxrpnodaptn ivt t)aDraxm ot0alxomiciysfa um(vpnu)tlxnxf iydomtelneo;(0 rtrimpoodal n fct tf 2urur ou0aptn ieiaslm2uau pnu) etnifctodlpD  uvi;t0trxoim3nu1lpe lneta() 2ur(roou0tee iiciadlaDul(vonu4 etomfciotop  liei s)sruriopoydlpeemnes (fa2rmu pnu0olen ociys mDrmnvpn(4 exomo3oo1la eai s;t teurxr3iodam   fvt ()srumu pnt1aptomfcilslaDumnmont0 rtomr3oydlmDrlnvilt  rto(o nu4ol e fcsls  rtaur nu1olenmfeiatfa2rmnms (4 etoxf oydopD lieo;t teurxo iu1aptemieslsf rum( p;u0oetoif3iadfs eau o u4 exnir3tydopteanvo s0s2ur(r iodape mfcsat) Dumum nu0oexoifctyd mDeluvs t4 etrmr ty1opt livi ()seuoirpnu4omeelici (fsrrrxrpnt4tlen f3ilt m eluvp t)tltoir to1lm eai o t  eur(rpno4omtnmnctatfaDta(mpou0oetnmi3tytfa2ea( o;(0arxrxocoa1fmDeluvs;s teurxo3ny4llenlnet (fa2uaurp;t1aetn oeiydfs rln p;u4arxoio oodfmt  ivs () 2tr(o3oo1lmt lfvtls srtm(mpnt4aeeo f3iys s ea(vonu0aexrmo3iy1fpte ivi t trtrirpiudlp e ncias)arur(ront0ape ii3tyt s el( pn(0artrmo3tytlmt lueo;t tetmir iudal  mietas)a2trxmo;t4tetnmictys sDrmu snt4teeoirciotoaDelueo;s0 2xmxm nudamtelivsasf 2um(m ;t0optoioeiyd s2rm(vont4areoxf oytlateau sl()seuriopny4lpe lnvsl(f 2urumpno0tetoii3tydlm2ulu p u0arxnmr io1oatrai s t0truo(o3ny1omt licia(f 2urx pot1opt  iciad mDul(vp;u0arxomo3tatopteaneo;(0 rtoxmpoodam   ici t s2urxr ;t0alt if3tlsfa ea(vo;t)trtrxr iotfpD aueo;t srxrxm3nu1lm   ivias) Drruro;t1tlen oeiadfm umn pn(0aeeoxoctytfa  luei ()t2toir oy4apee nvtas arrmxr no0aptoifeiat s ulnmp;u0texrxf todfm   uvs;(0setm(o3oudopt  fvt sfsrur( poo1aptn i3tat a2uluvp;t0 reoxf tatopDran o s0trtr(r3iodamtnlici sfsDra(m ot1tlto ocilt sDranms;u4aetoif3oa1oa r n o t0trxoiopiu1ome  feslsf Dtru p;t4ale  i3tatfs2um( snt4 lenxr io1faD  n o;s sexo(o nu4omtnmnct t) rum( oot4tltoiictld sDumumon(0texoir oatlatelies s) rurxr ou4ole livs ()srrr(ront4oex ifetatfm rau s u4arxoxocio1fatran o (  2umiopoudap  mfetlt sDtruroou0tetniieiys sDrauvp u) etoxocoodfaDeliei;s) 2tr(m3iu1lpenmictltfs2ur(mp;t4oltn ociysfa2emump;(4tetrxr3ta1oa rln s s) 2urxmpou4llee iciat)sDumx o;t4oetn oetysfaDrlu snt)altnxo3io1omDe ieol(0 2xr(r3iodlpeemivils)aDraurp;t1teeomi3iytlsDranvpnu4trenifcoadfm r nvo s) exo(o no1lleelivtat)s2tm(root0aee  oeildls rm( on(0aetoir3tydoa  au s;( sruoxmpoy4op emici sf rurx ooo4apeoiicilsfsDelnvs (4treomf oadfpDe ivi;()teum(r oy4optelfvs ( aDurur ot4aexoio3iytfa2el(vo t0 ltnxfcoo1oatraneslt t2xm(r oydlp n ivt t) Drm(m oo4apt ii3tls a umnvsnt4artomf iy1om rlivo;(0 2trir nu4lpeemics (fsrraumonu0tptomociydla rmu o;(0 eerxocootoaD ai ilt) exrio io4op elfet s)a2umxroot0oex mi3ild m2eanmo u) ltoio oa1fp  lnvolt) 2tm(o ou1lmenlicil()sDra(mp;u4olxomoeilt aDuanvo;(4artnmocia1fptrlivi t) etmxmpio1lmtelnet t  2urxmp;o4aptnmicildfa2emu o;t4arxrir totlptrlueo s srxr(m3iy1ape mfvt tfsrtrx p;u1aetomf3ilsfs2emnvo (0texnmfcia1laDran s t srtmxrpnudam  liei tfartrxmpno0oetnmo3ildfa ra(vo;t) etnmo3iytfmt an olt  eto(o3no4ll  mfcilt) rtau onu0olt  o3iadfaDemnmp;t0alerif3oatlpD livo s0trxoxm3nodlme  ieta(fsrrrxr ;u1aeenmf3iydfm rmuvs t4tlxrmo todfm eauvslt)srxmxo3io1lm  lietas) 2tm( o;t1olt ii3iltfm rm(ms u)tetrxo iatlp  ln i;t)t2tmxr ou1op n ietat)s2rmumpnu4tleomiciadlmDelnvont4 eermo oodla rli o t srxmir ou1omt mnvsa( srum( p;t1teenmi3iydlsDrm(vp;u4trerxo oadfa e neil()teurio3oudop e ivt ()sDuaxr ot1tpt  oeildlaDulnvo;u4texnxr oydlpD  nes;s trxmxm3ny4om   nei s sDtau ont0aet  feiadfm rm(vp;(4treoif3tadoatrau o (  ruoxopou1lm e ncsat) Dumu pot4tex  i3iltfa emnmp;t0alxrio iatoaDeanvilt)s2tmir3ou4alenlfvs s) Drmx o;u0aleo oeild s ua(mp;(4tlxnxo3tadfmteanvs;s  rtrir3oy4llenmnciasf Dumu ont1oee mfetlsfmDumn o (0tleomo oy1omt ai ils  etoir nu4lltemfvi (fsDrmurp;u0tlx mfetas m rln pnu)tlxoxf oy1fa eluvi;()t2toio iydom  mnvils arrau p;o0aee io3tldfmDulnvs;() etnxo iatlat aneo s)texrir3iy1amenlnctl(  rrm(mp;u1tpx if3ils aDumnvo;(4 exnmo tydom r u s t)trxrxrpiudlm nlictat sDua(rooo1olxnifctltfm elu s t)tlxrmfctytoa raivils0teto(opiudopenlfcs s) Drmxrpnu4oexn oeiat m2rm( p t4 lerifciydfmt lu s t) rxrio3nu1apen ncslt)srum(r nt1tlx mfciltls rlnmonu0aleomo ty1lm r neil(0 2uoxm nodome  nct sfaDra( poo0apx mfctat s2rau pnu) lxnioctodoptrlueolt  2uoim oy1lmtnlfvtl(f rrmur no1texoii3iat a eln p;u4arerxo3iydoa rlu o s0 2um(r3no1lpee feilt  Dtau onu4olxo ociadlm2em(ms;t4 leoxrctatfp r u il(0 2trim io4lpeemnetlt  2uaxrpno1tpt  ociadls emnms u4teerif3tytlptran o;s teto(r ny4amtelivt s arurx onu1alenmietldfmDua(msn()tleoxr3oy1op  auei;(0 eto(o io4amtnlfcsa(fsDraump;t4teenif3iatlsDulnmpnt4aexnmociotlpD  ues s) 2xmio3io1ll n ietlt) rrmx pot0oetnifctydfaDumuvsnu4 rxomo3iodfp e nesl()sexr(rpoydaltn ivilt)sDumur ;t0tpx mo3iat s2uan s;u0alxrxrcia1opDe nvo s0s2ur(o3iodapeelncs tf 2umu pou4openiiciyd s ea(mp;u0trtnxo tydoatrluvi;()s2tr(r oy1am e nei t)s2raxrpot1aeen f3iltfmDulu o;t)alerir oa1fmDeai slt0s2urim3io4opee ies t s2rrx pnu0apt moetaslm2rauvs u4tetrxo tatlat aivi s srumirpoydoptn ict (  rtmxro;u1apxo feiatfm umumonu0teeoxf iotopte ivs t)sruoxrpiudlle livil()sDum(r ;t4tex ioetyd m2ua( p t0aeerxf3iatlmDr uvs;(0sexoxr iudom elfviatf rtmurpot0opt mietyd s2emnms u0alxoxr oydlptrln s;t0tetrir nodap elnetas  2raum no1aetomoeilsfa2uluvs;(4 rtnir iodfa  auei;(0t2um(o3oy4ol e fctlsfsrra(r no4oexn ictad aDea( snt) rtomrcio1lpD aivolt0 rtmxr ou1apeemfvil( artruro;t4tee iocildfs2ulu o t)teenmo iy1faDraiesl( setmirpno4ol nmivilsf 2raurpnt4optoifcilslm2ean sn(4tlxrxf3oadfp eli ils0srurxm nu4oltn net () rtmxmono1tle io3iad m2emn o;t) etomrciadla elivo;t sexoir3iy1opteliesas) 2rmx oot4oexo o3ildlmDra( o;(0tlxoio3io1omD lu o t0s2tm(r3iy1llen icsl()arraxm ;t1optomi3tlsfs umnmo;u0trtoif3oadfmD lneo (0 etmxo iy4ol e ncilsf 2tmxmoot1tetomiciatfsDuanvo () eeoxo3oodomDe uei t)t2uoxopiudameelivslsf Drmxront1oleomoetyt s rmuvs;t) lenxrcoodlpDeln s t) ruo(o oo4oltn ncils  2um( poo1aet moetyslm2elnvp () etrmr ta1lm raueo ()trxriopoodolt mici sfaDtrum nu4tptoifetldfs el(vs u0 rxnir3to1optr uei;t teur(r no4lmtemfvtat  Draum nu4tex moeiyt aDeanvp;t0tltoxocoatlateanvols truoxrpny4am nmiei tf rumurpno4texoiietadlm eauvp;(4treoio oatla eauvo;s0sexrio nu1lltemnctat  Dumxm ;u1opxoifeiyslm2ranms;(4alenio3oadlm rluvils  eur(m3oodom n ici s  2rau pnt1aetoifcildfm2uanmon(0alerxfciotoatr uei () eto(m ou1ll nliesltfs2rmx  no0aeen fciadfm2rmuvpnt0aetomo to1la rlueo s) rtmxm3oydope mnvtlt s2tmxrpno0tee mociyt s2rln p;u0 exrxf3oydlaDr i i;t0 rtrir ou4olenmfei () rrrx p;t4oexoio3tad m rmu o u4tetnxoctydomDeaivo (  rurio3oydolte net tfs2rrumpno1apt mo3iat a em( o u0 leomr iotfat au o s srtoxm oo4omt  ivia(  ruaxrpnt1alt miciadlm ranmo;u0arxrio3ootopDeai ils) rurxo3iodoltn nct (faDumumooo0aetnmo3iatlaDem(vo;u0 etrxo oa1lpD anes;s0t2toxopou4oltnmieta()aruaump;u1tptnmociydfm2rlumo;u4 lxnmrciytla  lieo s0s2xmxopio1ap n ivi tfsDuaurpnt1tlt ifctys m2raumo u)aeenir iatfp eli olt)tetoxr3nydalt mfvt ( aDraxrooo0apeomf3ias s2ra( pnu4tlxnmr3oydfatraiesl(  rxmio3oo1omee ict s)a2tm(rpou0oeto oeiadfaDumnmp (0 lxnif oodlpDe i s;s0s2umxr iudoltemicsat s2ur(mo;u0ape mo3iat s2rm( p;(4texomo3tadfate uvi t  etmxrpno1altnmici sf rtrump;t1openioctlsfm2eanvon(0 lxnir tytopteai i;s  rumxrpny4lltn fvsls)srrmxm nu0oexo feildfa uau s u0aleoxr3iy1fatrln o t) eur(r3iydol emfvs s s2tmxm oo1openiieilsfs ra(vsnu)texoxf3ta1opD  uesls0texrxmpiu1amt mfei sf rtaxmpnu1oetn o3iad sDea( s;t4artnir iotoptrlu o;t)setoirpny4llee nei ( srum(  ;o0opx iiciadla2ranmo u0 renio oytfmDr iei;s sexrir iu4lltelieia(  2uaxrpno1oeenmociatlm2ua(vp u0tltoiocoydoatranvi;()seumxm oydolenliet t)s2uauront0tlt mfciadla2rmump;()arxrir3iydopD  i i;s0s2um(m io1lpenmiet t)sDurx  nt4oltnmfciyslsDelu onu4 rtoxfctydoat  ieilt)srtoxm no1ale  ivt ( sDrmxmo;o1tptnmfcilsfaDranmpnt0 eeoirctadoat livo;s0s2urirpoo4amenmfvi t)s2rr(  ;o4aetnmicilt aDeau onu)aeeoxf oy1faD anvi ()seuoxr3iydaptemnvsl(  rrr(rooo0apxomfctld aDulnms t4 reoio tytlpt  neol() 2uoir iu1ol nmicsas)arra(rpnt4apto fciasfs2em(vsnt4trtnirctodfmtrlieils0teurxr3nydomenmfet ( aDur(mpno4teto o3iatlm2umn s;t0areoxf3oa1faDeai s;t0seur(m3nu4ap  livt s a2rru p;u0open oeiys m elnmpnu4aetomf oytoa  aivs ( srtmim3ny1olenmnvta(fsrrr( ont0tptomf3iysla2emn p;()tltomfciydlaDe i i;()s2to(r oo1oleemics sfsDua(m ou0tleoioetaslm umumsnt4 exomo3to1omtraneslt sexoxopoydolenlneilsfarraurpnu4aeeo iciatfm elnms u)aeeomo3oydlpD auvs;s s2to(rpiu1opte fcils s2ra( p;t1alx mieiydls ranvonu0aexnmr ootlatelnei;t tetmxmpnu4lmenmfet tfaDrmum nu1ale  oeilslm2umu o;u4 rxrio3iytla  anvslt0s2xoxr ou1ol nlnetat arurumpoo4tptomieiadls umnvp;u)tlxomf3iotfpDe i o (0s2toir no4am n nci s sDumu p;u0aptomfciyd m2emu p u0tleoxf3tatom eanvo;s0trxrxr3iu1open ics t)a2rmu p;u4tltnmoetysfm2um( pnt4tltnifcoa1fpD liei s  rxmxr3iy4lltnlfvtl(  Dta(r ot0openmo3iysfm raump t0 ltnif3iodoat  ivilt) rxo(r iudlm elfes sfartm(moou1apxoifeiatfmDem( pnt4 lxrmfcoatlm r ivi;( sexm(m nudlp nmicias  rrru pnu4alt  f3iysfm ulnvpnt4aexnif3oatoaD auvo;( tetmxm oo1aptelnetlt a2ua(  ;u0tetoio3iyt m umnvonu4alenir3oodlpDe iesls  2xm(m io1amtn fct tfa2rmu pnt4aetomf3iysla elnmont)aeenir tadlp  lnes;t)s2toxo iu1lmen ncs s)aruax  ;u0opt  iciys m2ranvp;u)tlxrxfcoytla rluvsl(0srur(rpiu4lptnmncslt srrmur nu0tlto iciyslsDrluvo (4 renmf oa1laDeai sl() eurxopiudlmeelfcsas)arrr( p;u1tle if3ilt aDrlnvo;u4arxrxr to1fatelnes;t srurir oodol  mnvs (f 2rau  ;u4opx iociytlm rl( on()aleomf totlp  aiei;s) exm(mpiudapeemfcsa() rtmx pot4teenmfciad sDrm(vo t4altrif3tytlpDranei;(0trtrio3iy1aleelnesl()artmu  ;o1tlx  ictltls2uan p u)aexoxo3tydfa  aueslt0trto(r nydaptemfcia(fsrtr(rpou1tpeoifeiatls2elu o;u0treoxr totlpD lu i t  ruoir ou4lpt lici s a2rr(m nt0apxomoetadfmDumums;u4trxrxrctydfpDrai o ( s2tmxm3oo1ope  feias a2urump;t0tetn fctaslaDrlnmpn(4arenmfcoa1fpDrlu s;s)sruo(o nu4am nmiesa(f 2ur(m oo1opeo i3tytfmDumuvpn(4 exnioctytlmt li il(0srtrxm3oy4amt mivs t)sDumxmoou0altomociasfaDumn s;()tlxrmrcta1laD li i s0s2xoiopou1lleelncsas) Dtmum nt0tle mieild s2umums () exniociytfmDrluvi (  rxmio3oo4openmfctls artrurpoo4tptnmo3tlslaDeanmo;t) rtoif oydoaDeli s;t  2tmxo no1am   ietatfaDuax  ;t1tltoifcils sDrlnvp;(4 etrmr3ootoa  ai ols0 rxr(mpnodol n nctas)s2taxr ;o0alxn ociyd m ua( p u0tlenxf3oatomtr i i t  exmiopoy4lm  lneta(f Drmumpou1alxoif3tldlsDrau pnu4trxnir iatfm r nei s sexmio3ou1amee icslsfsDrrxm nt0tee  f3iydls2el(mpnt4 exrio3iatfmt  nvi t  rtrimpiu1lle mfvta() rrau ono0opt  fciytls ranvsnt)tltnircoadlmtraivs s) rxrxr nu4omeemivslt  rtrxm ;o1tptomociydls2uanmp;(4tlxomf3iytoa r n sls0seumio3iy1op  lfesa( srumumpnt4alxomf3tltlaDemump (0aetoiocoadla rauvi t0truoir3iudom  mivta(  2tmxmoou4tltn ociad sDel( on(4 ltnxo ootlaD lueolt s2xo(mpoy4oleelicsl( artmur no4altnmociyd a em(mo;()tetnmr iy1fmD luei ()trurxrpoudolen fctat) Drrxrp;o1tlxoioeiltla ean o t4tlerir ootfate n i s0t2xr(r3ou1lmt  ivsasf Dum(m ;o4tlxo feiyt s2el( sn()altnmf tatfmDeaieol()texr(o3nydll   icia()s2trx  ;o1teeomiciatla emump () exoxfctatop   ivo;t  2trxopnu1aptnmnet sfa2trx pou0oet io3ilsfa raump u)tlxomfcty1laD  neol()setoiopoudomeelfcsat)arurxr nu4ole miciydla uanmpnu)treoif todfpDr nvs;s0t2xrxrpou4omtelieias)sDumxrooo1ope io3iasfm2ul( p u)tlxoxo3todlpt liei s0sexr(r oy1alte fcsa() rrr(  nt0tpxomfciatlaDrau o u) exnio3to1fatrlu o (  rtmim oy4om nlici t s2tm( ono0aeenifetytlm um( s t) lerxf3ia1fa elnvi t0s2uoxr3nudapte nvi s a2tr(ro;t0ole  feilslm uan s;() rtnxr io1fa   iei t  rtmxr oydope lfetlt) rurumoot1aexoiieias m eanmo;u)trtnif3iotfpt  ueols0 2tmimpoo4ol  mieilt aDrm( p;t0tpeomfcilsla2umump (4trermf3tatlpDr n i;(0 rumimpnodop e fvsa(faruaxmp;o4oetomoeiydfmDrl(vs;u0trxnxr3iotlm  auvils0t2umxr3iu4omee feil( a2urum ot0oeeomi3ildlm2ea(vp t) rxrio oo1omt  uvi (0truo(m3nu4lpe mncslt)srrmx  oo4tleoifciad mDrmumsnu) rxnmo3oodlat livs;t) rxo(o3oodlm  lfvsa(  rtru  no1opt mfeiadlsDrl(mo;u)aexrmr3ia1fmtrli ils0trurxo3nodamtnlivtl()arraurpou4altomo3tytlm2uauvonu4tltomr3todlm eluesl( s2xoir3iydlm nmfvta() rtrxm no0alx  fciyt s ua( p u)tlxnxr3oydlpteaueol()tetoxm3ou4lptelfcs ()aDur( ont4tlxo icils s2rl( snt0tetrxf3iatlm rlueols0 2tr(o ou1ome lfci t)srurx  no4aexo octytlsDelnmont) rerxr3oodlaDeln sl( srxmirpoy4ope mnvias srtru ono0tpe mf3iltfs ra(vpn(4trtomr iodfa eaues () eurim3ou1olt lfcils)a2rax pot4tptn fetasla2em(vo;t4alerio3oo1lpDeanvi;s0 2xo(r3ou1op elnvi t  Dtmu  nt1altniiciatfm2rmu s t4trenifcoodop rauvi t0 exrxmpnu4ole  nvil( aDrrxm ou1oex ifciad mDul(von(0aetoxf iadfa eluvo s  2xoxm nydll   fes s) Dua( p;u4oetnmi3tlt m2rmumonu)aetoxf3oo1lm   u sl( t2triopno1am  mfvils sDtrur ot0tpeniicild aDum(vpnt4tetrio ia1fa  au ilt0 rtmxmpoo4opte iciatfaruaurpnt4opt ioeilsfaDelu o;u4trtrifcoytlpDr ivs;t0 2ur(m3oo4apt lfcsl( s2ur(rpnu0aptomfciltls eluvp;(0teenifcoa1laD aieil( t2xr(mpoy4amen ivsatfsDrm(r ;o0tpeo i3iadfs2eauvsnt0tltoifcoadfa r n i ( trtrim ny4lm  mictl(fa2urxmp;u4oex  i3iatls2eanmo t0 rermf3iadomD au i;( setoirpoo4amte ict t)aDum(mpno1texoifeiad m rln p;t4aexoirctodla  ln sl(0s2xrio3no4opt liesas sDtauro;u0aee mf3iydla2emnvonu4alenifcoadfa  aiesl(  rtoxo nu4ll n fvsa()s2rauro;u0apx  fciatla2ean o u)arerxf oytla e ues;(0t2xriopny1ll  mivtltf rraumo;t1opxnii3ild mDum(vonu)arxnmf3iotfatrlu o;t  rtoim3nodole liesa(fsDumxmpoo1oex mi3iysfs2rm( o;t) eeoxf iatoat lies t tetrxmpnudoptnmnctas arum(ronu0aexn feiytlsDuanvo t4arxnmr3ootfmteaivi;s)sexr(rpio4om emfvsl() rumur no0tetoio3tasfs2rlnvsnu0aetrxo3tadfm elieol(0s2toxmpny1lmtelfci tfa2raxmpnu1teenif3iasfaDranvp;u0tltrio3oy1omte iei;s0sexmxr oo1ameelncta( s2ua(mooo0tltomf3tasfs2rmu p u4trenif3iadopteli o;(0setrir3ny4om  lictat) rtaxm ;o1tpxoifetasfm2emn pnu)texnio3io1fateaues s sexo(opoodape lncta(f rtmumonu4optniieiad a2rl(mo;(0 lenif3tydfp e n o s) rumir no1lpen feil()srumurp;o4alxoii3iyt a rln o;() lxnircto1faDeai o ()t2xo(opiydam n fcil(  ruaumpnu0apeo oetltfaDea(monu4 eenxf3tytfpD  ivs;(0truoim no4lme mfviatfsrtaurooo4oetoiictldlaDeau o (4 rtriocoatla  livilt0sexmxm iudap  mivsa(fsrrmu p;o0ope mi3iatfsDrmumonu4 exomr tytlatr uvilt)s2uoxrpou1amtn icsl(f 2umu  no0tetomoctydfmDel( s u0arxnif3totfpte uvs;s0seto(mpiodomtn neil( arraur ;o1oleoioeildfa emu o (4 rxomr3ia1fpD anvi (  rxo(r oy4lmenmnvt (f rraur ;o4tpxnioeiysls2em(vp;u4 lerxr3iytlm   ivslt0trtr(opiy1lltnmnetl(faDumu ooo1oex iictytfs elumsn(0 lenio3ty1lmteluvs t0sexoxm oy1opeemnvtl(f Drrumpot0alenii3tadlm rmump (4tltoio tytom eluvils  rtrxrpoudapenmneta(f 2rmxmo;u1apt  f3tasla2emums;u)alxrio3io1omDr ues ( texo(mpnudomtemfcia(fsrra(mont4alxn f3ils m2ulu pn(4arxrio3ta1fm r uvsl(0seuoim iydlm e nvsl( arua( ont1tlxn iciltfm umnvs;(0 etoxo3oydlp r u sls) etoim no1olen ietl() Dtmu o;t4oeeomociadfs2eln pnt)tlenmo3to1laDeaivslt) 2xrim ny1ope mncias) 2taxm ;u4alxo ocilt s rmuvs;u0artrxo3iatfpt ln sl(0 2tmio3oy4lm nlfeta(fsDtaxmp;u1tltomfctadlm2ua(mp;t) lxomfciatop eaivs;t0s2uo(o3nodlmtnlnvi sfaDrax p;t1tpt  octyt m2um( onu) renir iadlmtelieo;t) etrxrpoo1op emfctls) 2urxr ot0apenmieilt m ulnvo;t) ltrio3oo1lp rlivilt s2xmio nodomtnmiviasfaDra(mont1tet iietltls2rm( o;(4arxoir3ta1fmtr uvi s)srto(rpnydlpeemfctls aDrrumpou0aptn icildls2ul( p () etnir oo1laD  ueilt) 2ur(o nudal  licias arrrxrono1oeto f3tlt aDelums u0 ltniocia1fm   nvo s  etmxmpiydlptnmnvt (fs2urxroot1aex mo3iyd sDrlnms u)artnir3ia1lmDrluvs s t2trim io1al elfvsa(  Drm(  ou1aeenmiciyt sDemn o t4aetoio3ia1fmt li sls)setm(r3iu1lleemicta()aDtru pot4opxnmf3iatfs umnvp;(4tlenmf oytopDrlnvs t t2tmirpoudoltelies (fa2rm(rpnu1tlxn oeiydfmDel( pnt4texoir3oodlpteanei s t2tmxrpiydome  fcsl( arrmu o;u4oee mfetltlm raumo;u)tlxoxf oatlmtrlnei;(0trtmxo oudomt micilt) rta(mpoo4tpe mictldfs rmuvs t0tlerifctodomD lies ()trtr(rpno4am  mnci tf rraumo;u4alxoifeild s2rl(monu4altrmf3todlaD li olt0trxm(r3no1ll nlictltf 2urxront4oeeomociyd a2rl(vsn(4 etoio tadop  lieil()trtoxo3ny4altnlict sfsDumu  ot0ale moeiys sDrl(mo () rerxo3ootlp rluvsls)t2trirpnudaltn fesat)artmumpot0oetn fciytfaDemuvo;u4teeomo totfm eanvo t s2xrio iudaptn ics t arrrx pnu0olxnifeiaslm rlnmsnt4tetrioctatfat lues s  exr(mpny4ap n ivi tfsDrr(mpou0tlen iciltfmDumnvp;(4teermr3iadopD  iei ()trtm(mpoo4olt  ivt s arum(r no4aptn o3tas sDrm(mpn(0trtrxf3oadopDrlneils0t2xoim3iy1lmt micia( arraump;u4tptnmociasfm2umu snt4alxnmfcta1fptelnvs;t)truoxr3io4lpenmnvsa( s2rmu ono4aeeomociys sDrmnms t0trxrxoctotoat  ivs t0setrxm3oudaltelictasf Dumur ou4oeeo oetlt aDrl(mp u0aetoxr iodfpte i i;(0trur(r iy4lme micia(f Drmum ou0aptoiieildla2ulnmo;(4texnmf iotfpt lu ilt0 2trio3ny4openmfct ()s2rmu o;t0alxniieildfs um( p () rtrmf iodfpte u o s)sexmxo3iu4lle lfctlt  rraxr nt4tptnmo3ilsfsDra(ms u0 ltoxo iy1oa e ivs t0 2tm(r3oo4amtnlnvsatfs2raxmpnt4tptnii3ias s ra( snu4tltnmf iydfaDrai i (0trxmio nydlmeemnvia( srum(m ;t0tpe iicils sDran s;u0 rtrxf3ootomtrli s;s) exoir3io4amee fei s)arraur no4openioetas s2umn o;u)trxoxr todlpt  i slt0 rtoimpiy1omen iet s)aDtaumoou4aptoiiciltfs2eanms;t0aexnxo iy1fpteaieo;(  rxmxr nudllt  nctat aDrm(r ;t4aee ifctad sDra( s;()teermr3tydlptrluvilt0 2trio3oudomen nciat  2tr(mp;o4aetniicild a2eauvp;t4arenmf todop rai s;t  rxm(r no1lmenlfes s  2rmu onu1oexn oetadfm2ulumo;u0altnmf3ia1lmte nes;t)t2xmio3iudlmt lfciat) 2rmur ot0aleo f3ilsfm rmumo (4teeoxocoytoat luei;( tetoxopoodlm   ivslt) Dumu  nt0opxo oeils a2rau s t)tltoxr iadlp rlivs s srto(r3oudameemnetl()aDrr(ront1alt  oeiasfs ul(vp ()tetnio oytfmteli i;t t2trxm oodlpenlfviatfs2rrxrpno0oeeo oeiatfsDrlu p t0trxnxf3oo1fpt auvslt)trum(m iodaptelfesl(f 2umx ooo0tpeniiciyt sDranvonu0tleoxo oodom elieils)trxr(m iudol  mnes t aDtrum ou1alx  fetyd sDumu pnt)tlxnxocio1lp e i i s0teum(rpnu4oltnmncsas s2rax ooo1opx  ieiad m2raums u4artrmr3iatfmt au il( srtrim io4ale  icil(fs2rr(mooo4alenif3iys s uanmo (0 leoio3oytoateai s t srtr(o3nu4ap n nvias srtmu  ou0tlx mictadlm2raums u) exoio oadla elnvilt0s2ur(r3oodlleemnvilt) Dumumono1tpen ieiltfsDumuvpnu4 eenmr3ty1opDrlnvs;() 2trir3ny4ll nmictas s2tru  ;t4oltnifeias mDrm(mp;u0teenmo3iatfaDrlivo t)trtrxr ny1olt lnct ()a2uaum no0oee mf3taslm eaump t)trenmf3oy1fmteau s;()t2tmxr nydaleelnct s aruaxrpoo1tlx ioeilsfm em( p;(4artrxrcta1lat  ueol(  exo(r3no4am e nci t)a2taxmpou0aee  feildlmDran o t4 eermrctydfm  ln o ( s2tr(r io1oltnmfciltfaruaumo;o1aeeo i3ilsfs umumpn()aexnio oatla e u ils0trxrxo oodlme lfvs t) Dta(m ;u4openioctltlm2rl(mp u)tlxniocty1fp ran i ( trurxm3ny4lp   fvt t)srrm(  ;u4aptoio3iasfa ul( p u0 eeomo3tydfaD lnei s trum(r3ny4olt  ivta()srtmumo;u1ope  ieiasls2umump;u4 reoxrcoatop  livslt)t2xmxopio4ole  fetlt)aruau  ;t4aptnmfciysls2rluvonu)trerxrcoytlmtrlnvi (  etr(o oydaleemicias s2ua(rpnt1tpe mietlt m emu o;t4 eenir oo1lm  lu il()seuo(rpny4om  lfcsatfa2rm(mooo4olxoiieiasla2rm( o t)tleomr oy1fa eaieo;(0setoxo ou1alte fes s)s2rrx  nu1tlx ifciatfa ua(vp t)tleriociadfateaues (  exr(m oydomtn feia()aDtru ont4teenifeiysfs2elums ()aetomo ia1fmD  u sls0 rxmxopio1optelfeta(f Dtmumono1alto feiat mDemu s;t4 exrxf ootopt ln ol(0 etmxmpiy1ol n ieta( aruru pou1oex mi3iydfs2rmnms u4alxrmo iatom r u sls)setrio3nodomee fctas)arrmu  ;t4altoiociys sDra( o (0 lxomo3iotomDe uvilt  eurxrpou1lpte nct tf Dtaxmp;u0tlx ifeildlm2rl(vsnt) etnxo ty1oa r neslt0trtm(mpnydal e feias) Dta(r nt1openmi3tld m uanmsnu)trtomocoytla r neil(0texoxmpiydlmtn nei (  Dum(mo;o4oeen o3iaslaDem(vont4 exnxrcty1lm   ues t)trxo(m oy1al  mfvia(  rrr( p;t1tlx  oetyd s umu p;t0 eermocootlaDran i t0 eumio ny1lpe miesa(fsDrr(r no1tptomoctyslmDrl(ms;t4 ltoif ia1om raueol(0tetmimpiydol n feiltfa2uru p;u1tet mieildlsDuluvpnt)tlxrxr3ia1fmDe nes ( seuoxr iudolen fct s) Drax o;o0alt  fcild sDumn sn(4 eerif3io1la  au sls trtrxr3nydaptnmfesat)sDtaurpno1olx mfeilt m eanmp ()artrxocoo1laDe nesls seurimpiydal  mietlsfsDrax  nt4aetomfeilt a2ulnmpnt4trtnxo oatomDe nvslt) 2toxm3ou4olt lnesa(  rurumoot1tet mfeiydfsDumn p;t4tlxrxr oatfaDraneslt) rum(r3oudol nlfctls) ruaxmpnu4tex  f3taslm2ea( sn(0 lxrxo3ootlmt livil(0srto(r3oudam nmivsls  rrrum ot1apto o3iat mDeauvo;t)treoir oytlpt  i ils) 2uoiopno1llee fctl(fsDta( poo4oexnmf3tysla uluvs;t0tlxnio3oatop elneo t sexrxrpiy1llt lnciat)s2umxrpnu1tet io3tytfsDrluvo;u4 lxoio3oytla  au ols) exo(o3nodop emfvs s) rtm(r nt1oleoioctld s2ean pnt4aetnxocoa1fatr ies;s)srtmxopiu1apt  icsasf Dum(moot4ale mfeias s emnmo (4teenir ootoateaivolt  etoxm oo4om emieta(f Drmurooo1tltomfciytls rmnvp;(4aleomf tadopD li s t)trxoimpiy1am nlivtls)aDrmurono0teen iciadlsDrm(vs;u)alenio3oytlmteanei;t t2xmxopny1lltemivilt srrmxmonu0opeomoetls s2ra( snu)tleoxocia1fpteli i t0 eto(mpny4oltnlfcslsfartmx  ;t4alx  ieiatla umuvo () lxrxr iadfatean ils0 2trim3ny4altn fcia( s2raxrp;o0altn ociys mDumuvo t0teenxr tydomDeli il( trxoxo3ny4opt  iesat)sDta(rpnt4tlxoiictadla2rlumsnu4tlxnmrcootomteaues;t trtmim3oo1llen net t)sDra(roou4ape mfciydla2eauvo;u)aetnmo oytlm  lnvo t)srtoxrpoo1ol nlnvs s)sDtaum ou4olxomo3tysls emn snt0 ltnio iydfaDrai il() eumimpiu4ol e ncs ()arururpnt4oltoif3ilsfm elu s;u0arenirciodlp   ues;t t2um(r iy4lptemfes sfartax ooo0alenmiciyd m2ua( o u) etniocoytlate nes s0 eum(opou4opt  ivilt)sDurum ou0oet  fcild s2rmu s;(0arxrmr3oodlpt lies;t0srtriopou4amt lietlt)s2ta( p;o0oee iicilsfs umuvo (0 etomf iadfpt lnvo ()seto(r3io1llt mnvi t) ruaxmp;o1alt ioeiydla rln ont)treoirciy1fmt li ol( sexoxr iu4ol  mivtat) rtaxr ;o0apx  i3ils m2umu pnu4treoxocoo1fmt an ils0 rtmxr3ou4al n netltfsrrrx ono1opxoio3tyt m ra(mon(4aetrir ootla raues s s2urxopny4lltn ivs () rurx  ;o1aptnmociysla2em( s t4alxrxr3ta1lpDeaivols sexrxr nu4aptelnvsat  Durumoot0tptomf3tlslm elnms;t0 lxnmr oadla elivi;(0 rtrxm3iu1ap   nvt t arrmx o;u1olx iocild sDuanvs;t0tetrir tydopD an i;t)trxoxmpoo1ope mfetlsfaDtrxm ;t4tpxomi3iyd sDumumo;(0 eeomf oo1optelu i s)texmim nu4omt lfvs t) Dtru o;t1tlx ioeiad a2umuvp u4arxrmo3todoaD aneilt)s2tm(mpny4aleemnei s)sDurxrooo1apxo octldfs2elumonu0alxnif3iy1fatraies;t0s2uoio3iu4open fcils aDrmxmpot0apeo i3tltfmDua( o (0altoifcoy1lmtr nvslt s2xo(r3oudlpt mfctls s2urx oot1tlt ioetltlaDulu p;u4trenmo3tatop eauvols s2tmiopoudlltn nesas)sDtmxrpnt0olxoiociadfmDeanms u0 ltnircoo1fm ran i s0srxrim3ny1ll  lietlt) Dtau  ;t0ape  o3iydlmDelu sn(4altomf3oydoaDrlues;s) eumxr3no1altn fvilsf rum( pno0tpen o3iysfmDrm( p u4 etnmrctodoptrlnvi;(0 2xoxo no1lme mivta() Drau ooo0aeenmf3tls a rmuvs t) etrif3iydoptraieo (0truo(r3nudomte nesl( a2ua(mpnu4opeomi3iadla2ra( pn(4 exrir iodfmDe ivi;( sexmio3iy1lmee iet ( srrrxm ;u4tpxo fciaslm2rmu p;u0trxoircoo1omDr ivil()tetrir3no4lme mietls aruax  nt4texo f3tyd a2ea(msn()aexnxf3totopD auvi;s trxrio3oo4ope licsas)aDrm(monu4apx  i3iydfa2umump t4 lenir iodfp ranes (0 eum(m3oudlm nmivil(  Dtaur ou4teeniictldla2emnmsnu0 exnxo3totfp  lnes;t0 eto(rpnudopte icil() 2umxr no1apx mf3iysfsDea(ms u) etnio iotfp  ln il( srur(m3oo4am nmnetl(fsrtaumo;o0olxomoctysfa2ranms;t0 eeoio ty1fpDranvo;t s2uoim3ou1aptn ies (  Drau  ;o1apeoif3tldfs2emums t) eenifcoydfpteauvs (0trum(m no1ll  mfvsl()aDta(m ou4alt mociys m uanmonu0artrxrctodlmDraues;s0tetoxo oudame lnes t srrrxrp;u4apxnmietadfa rlnmpnt0 rtomr oodfate ies;s0 rxo(rpoy1op nmncsasfs2ra( oou1aeto icias sDrauvo;u)tetrxf3oa1fp e uvs;t)setrxrpoo1apenlivtas)sDtmurpnu4optn i3ias m eaumo (4 rerxfctotlpD lneo t0 rum(r iu1omtn fcil()srrm(  ot0apen f3tasfmDemu pn(0tetrifcoa1opDrauvi s  rxo(mpoydop elivils)a2uru pot0aeeo icias s2em(mp t4 ltnifciy1omD lnvil(0 2xrim oy4al  liviat) Drr(rpoo1alenmfciysfs rl(msn(4 rxoxf3tydopD luvs;t) exr(rpio1alenmivsltf rumumont0oexnmictas a2rl(msnt4 ltrmr oytlm elivolt t2umio nu4lmt mnvi tfarrr(mpou4olt mi3taslm2rmnvsnu0trenmr ootomDrau i;t  rxoxm3io4lle mfctl()srtmxm ou1aptnmieiyt aDelumont)tlenif ootfm  luvs;(  2xr(rpny1ll   fci s)sDtrx  no0aet mfetldfm2el( snu)trtomo totfa   ies;() euo(mpoy1lpee nei sf Dtmxrpoo0oltomociydlaDulumsn()trxrxf3iatop ranei s  etm(r3ou1olt lfctlt) Drr(rp;u1alxn fctadlaDul(mpnt)alenmr iydlm eluvolt0t2toxopiy1al emfet ()srum(rpnt4tlt ifctltls ulnvp u)teermf3oydomteli i ()trxoio iydllenlivia( s2rau oot4tle  ieiysfm2eauvp;t0arxoiociotla  lies s0tetm(mpnu1lmen fvsa(fa2tm(r ;o4alt mo3tysfaDea(vp;t0altriociodoat anvi ( trurio iodlmenlivils sruaxm nu1oet  ociasfaDrlumonu0 exomf3oytfa  lu s;t trtm(opoydlmtemfvsas  rta(mono4olenmicilsfa umumo ()trenmf iatlmD  ues;t0s2toxr3io1am n fci s)srurxrpno0ole  ieiyd s ra(mp;t4trerio oa1lpt  u ols0tetrxr3oy4alenmfvias  2tm(monu1opt ifcilt s2emnvs () ltoif3iydomteaueslt)s2ur(o3oodaptn net s arrmxm oo0tpxoiietytfm uaumsn(4aetnxo3iotlmD aivo;()srtm(mpiu1apenlivtasf rrr(mooo4oltoii3tat sDrluvonu4alxrio to1lpDrluei ()tetmxm oo1oleelncsa( arrmum ot4tptn i3ilt s elumpn(0arenxrciotomD  uvo () rxoxrpno1om nmiei t srtmurp;t0apt mo3iydfsDeauvo u4 ltrxoctodlatr ues s0t2urxr3oy4llt  nciatfs2tr(mono4apt io3tadfm2ul(mpnu4texomfcto1opDraivol(0 exm(o oudll emnes (  2ua(ro;t0aleoii3iadfa eln ont)arxrmo totom   ies s  2xrimpnu4opt  nci t) Drrxm oo1alto feiaslmDumn p;u0aetoxfciytlmDe nvs t)setmimpoy1lme mfvsl()aDua(m ;t1aet iociasfa2rlu p;(0artomo3oatfpt  ieils) 2xo(mpny4lltnmietl(f 2ua( p;o0aptn fetatfmDeanvp;() ltoiociytlaD  i o;s srtmxrpiy4lp n ictlt s2tax pno0aexo fciysfs elnmsn()tltnxoctatfmt au i (0sexmimpoy1am emfesls)artrxm ou1apt if3tydls2eluvs (0tltoif oydop ran i;() rxoxr3oy4ol n ivtat)s2rru pno0oltn o3iytfs uauvo;(0artnif3oy1lm rau s;(0texrir3nudol   iviat aDtrum ou1tee  o3tadls2ua(mp;u0artrir3tatfmte i s t  rxmxrpno1ll nmncia( a2tm(mo;u0aleomfetldla2eln ont4teenxr3oytoat  nvi;s texmio3nodlle lneiatfarurxmpou1aexnmfcildla rmumo (0tlxnif oytfa  anvol()t2tm(opiudlmte ivs tfs2tau  oo1opt  icias s2uan s () lerxr iytoat liei (0trtoxmpiy1altn ivi t  2tmu  ou0alxnioeiaslaDra( sn(0alxrif iydop e n s t) 2xmiopoo4omtelietlsfaDtm(moot4aptnmieiad a ulu p t4 ltoio tytlmtrauvsls  exrxo no1ap n ietlt  Drruro;u4alxn fetyt aDrl(vpnt) etomf3oodom   n o;(0srxmxr oy1lm emncsasf rtrx p;t0tpt  oeiltfaDuaumo;t0trenxociatlpD anes;()srtoxr io1altelnetat)sDra(monu1tpen fciad aDrm( p u0 rerio3todfpD anvs;t)truo(r iy4ol emietas)aDraxront1tpe iictlsfa um(mp (4 ltoirciydla raneslt s2urio3oydlmen ictls srurum ou0oet mf3iys mDrmnvs;u4 etomf oodopDeaiei ( setoxmpny1omt  fcsa() 2rmumonu0tpx  oeils m rlu pnt0aeenifcoadop   uesl()t2uo(rpio4omeelfvtls) Drrump;t1openmi3iytfs ran o;t)tetnmo3iydop e n s;t tetmio ou4lmtn fctl( srraxmono0aetomoetld sDrl(mont0trxrxr tytlmDrlnvsls) rur(o nydlptn fvi t a2tax o;o4olenmfeiasls ulnmsn(4tetnioctadlmDe neilt setm(o3ny1lpeelivt sfs2trx o;u4teeo ociysla2uanvpnt0trenio3iy1la eluvi;()s2tr(m io4lltemivsl(fsrtm(mp;o4texniiciad a2eau o;t)tleoxo iotlm e i sl( t2xrxmpiudll nlnetl( a2urxmpnt0tpeoii3iys a elumo;u)aleoio oatoat  u s (0texm(r3io4alte nct sfaDraxr oo4tlen oetasfa rlnvsn(4 leomf ta1omtelu sls s2uoxr3iodale mies () 2tm(mpot4opeo fctat s2ran pnu0altnif3todfa rli o t0srtmirpio1ol e ietl( srtm(ronu1tpe  f3iytfs rlu s (0alxoxr todlmDraivsls  rum(r oy4apenmivtlsfsrrrxmont4aex ifeiytfa rmn pnu0 rtomrcoo1fptrli i (0trtm(o io4optnmnesa(farta(ront0oeto oeildlsDranms;u4texnir3to1fpteaneilt0tetrim iydaleemies s)srraxm oo4oeto feiltlsDelnmp;t0 rtnxfctydlm rai ils)srxrxr oo4ome mics sf Drrx pnu1oetnif3ildfa2uln ont4 renxfcoytfpDeli sl(0s2urxo3oydamtelfeta() 2trx  oo4tpxomfeilslsDemuvs (0 rerir oa1faDeauvol(  ruoimpoydam n ncsls)artmum ;o0tpe ioctltls rln snu4trxnmf3oa1fmt lnes s)trxrxm nydolee fvtls sDta(root4aexnif3iaslm rl( pn(4alermf3tatopD  uvo (  eur(m3nodomeemnes sf 2umuronu4tpeomi3iyd sDeanmont4areoir tatomD aues;t s2um(o oodopt lici sfsrurumono0apxniieiadlaDrl( p (4 renmoctytlp rlies;(  eur(o ou4aptemfet s)s2ra(roou0tee iieiltlsDemumsnt4 renxociy1faDeaueo t0teumxrpnu4lle lieias aDurxr nt1tpeoioetls m2uaump;u)arerxo3iy1faDraivs;( t2ur(rpnu1amen nctas s2tmxro;t0olxnii3iyslaDrlnms;u0texrxf3ootfmt lieil(0 rxrim3iu1openlneslt)s2taxr ot4tpx  fcias a ulumo;u) ltnxo ootlmDean i;() 2xm(o3iodom emict s  2tm(m ;o1tpto oetysfa2umnvp t4 ltoio oy1fmte uvs;( t2toimpiudopt mfvs t sDuau oou1aex mfeiytla ulu onu)texrxo iatlmDrai i s)sexoxrpnodllt  fvi sf Dtm(  ;t4tpxo fciysls2rlums;u0 ltrxfcia1lp eanvo;s0 euoxmpnu1lpenlfesa()aDta(ronu0tlx  oetat aDel(vp t4 lxnmo iadopte ivo t)texoxr iydalt lfvt tf Dumxroou0aex iietldlm2rlu p;(4texnio oo1la eaieo t)truo(opoy1op nlfvtlt) 2tr(m oo0aeenmietlslmDrm( p t4 eerxf iy1fp eln i s teuo(opio1omeemivi t aDrrx o;t4oltn f3ilsls el(vs;t0 etrio iytoaD li s;s0t2to(m3oodllt  net tfs2ur(m ot1alt micilt mDeanmp;(0alxnxrcoydfa rlivo;s0trxm(rpoodlmt  ietlt aDta( oot4ale mi3tadlm ul( s;() rtomr3iadopt livi s  2xmxr oy4lmenmfvi ()srtru  ;u1opt mi3iad sDuluvsn()artrxf ta1lm r ieol() 2umir3oo1lp elneiltfsruaxm no1altoioeiydfm rlu s;u4aeermociadfpDranvo ()srxo(rpiu1lle lfvtatfartm(mp;o1alx  feils sDrmnmsnu) rxoio ty1op   n i;t)trtr(mpiy4lp   fci s  rrrxroou4ape mi3ild mDeauvsn() leoxrcoy1laDe iei (0srtmir oo1optn iviasfaDrmx  oo0alt  fciysls2rmnvp;(4 eeriociadfatr uvi t  rumio3iudome mfetas aDraxmpoo0aetomfetldls2ulumo;t4tlermr3tydom  aueo;(  exoirpnu4alt micta( srra( poo4oeeo feiydla2ul( s (0trtoxo tatfm r nvolt teuoio3ny1lmt livtat  Dtaurpnu0teeo icias aDrl( p u0artrxo3oo1la elieo;t  2to(mpoy4al nlnvta( sDrmumpoo4tex io3iat mDrlnmp;u4trtrir tytlmD aivils0 exrxm oo1lmtelfetas srrmxmp;o4tpx iictlslmDrm( on(4 lerir3ootfateluvsl()teum(mpno1lpen fvsat  Dtru ono4ole  oeilsfm2ran pnt) exniocia1fmtr nvi s)t2trir3oy1aleelfcta(fsDurxr oo1opeomfcildlm2uan p t0 exrxo iytfaD auei ( truoio nudolte icilt arrauro;t1olenioeilsls2umuvsnt4arenxr3oa1om   ueil( srtmimpoo4om   ivsa()sDua(r nu1opeoiociat a ea( pn() etomrctadom eaies t) etriopiy1olte fcs s sruaumoou1teto oetasfm ulnmp ()trtrifcto1omtrluvo t0tetm(r iu1am nlnct sfsDrauro;u4oetoif3tltlm2ua(mp t0tetnio iodoptr uvo s) rtrim3iydlle lfesl(  Durx  nt0tlenmiciydlm2rl(msnt4 renir ia1laD  ivs t0srtm(r3iodlle mfesl(fa2rmx ont1tlxoifeilt sDemnvs;() etrio3oo1oaDe nvs;()srxr(m nydll  mfetls aDua(m ou1tle  feiydfm rmu snt0artnmf oa1faDelu sls)tetmxmpio1om nlncta()artr(mp;t1opeomfetadfa2umnmo;u) etrxf3ty1faDrli sls teur(o3iodlpt mieil(faDtaxmpnt0ape  i3iadls2eauvs;(0alxriociotomte nvsl()srtrio3io1ap e iei (fa2tmum ;o1optnmf3tldlm2eanms () rtnio oodfp  aneo () exrxm3iu1op e fcta(  Dtm( oou4ale io3tldfm2eln s t4aleoxo3io1omte ieols0t2xmxm ou4llt lfct s)aDuaxro;t0tex mi3iatlsDemnvp;t)alenirciadomDe i il() rtr(opnudlltn neils srrm( poo1aexomo3iytfsDem(ms;u4tleoif3iytlmteanvo t) 2tmiopoodlmenmfvia( a2rrxrpoo1optn ieiytlm umu p;u0texnmociodlaDe nesl( s2xrio3nu4om   nesat  rrau p;o4altoif3iltfa umnvont0 rtomocoatoa eaivo;t srtrir3iydlm  mnctl(  Dtr( onu0tlx io3tadla ulnmpn(4alenxo3iytlptr nvo;t)t2um(o oydlp  lfeiltfsrrm(r no1alx moctatls2rmn p;(0teeoif to1fm  lueo s0tetrirpnu1ll n fvsat  rtau ooo1oltnif3iadfm em( o u4arenmr3ootoaD  iei t0 rxo(r3oy4ole mfvtatf 2ra(m ;t0tpt mi3iad sDumuvpnu)arenxo oatomtr ueolt0s2umim3nudlpenmicsl()aDtmur nu4aet mieiytfsDrm(msnt0 lxrif oytfa eanvo;(0s2trir nudal   ivia(f rtrxrp;t4oltnioetys a2ulu ont4aetnmo3oydfmteln i;t) rxrxr oodlme  ncsl()arua(  ot0tee  ieiydfa2rlnvsnt0 eerif3ta1omD  i il()s2xr(mpiu1ope lfesas srrmu  no1oleo i3ildlaDeanms;u0trtnmo io1faD  u o ()trtoxopny4ol elivi s)s2tmxr nu1opxomfetldfa2rl(ms (4 rxrmo io1lpte n i t)t2to(m oo4olenlietas  rrm(  ot0tlt  f3tltfa2rm(mo t)trtnirctotomte nes t) rtoxopio1al n fvi t  Dum(  nu0tleoioetls a2emu p t4trtoif iydlpt lneols)t2tmxopnodomen icia(fs2rr(  ;t4opxnifciaslaDra( p (0 lxoio3ia1oa  lues;s)tetrio io4amtemfcslsfsDrmu  no0tet mfetydfs2rlnvo t4aeenxf3iy1fpD lu olt)setrxm3oy4ap  lictl()s2urxmonu1ale micilsfmDra(mp ()artrxfctytfp  luei s t2tm(r oy4lmtn nvtlsfarrm(mpot0opx ioetydla elnvonu0 etrxrcoodop eluvi t0 2ur(opou4llte ieta(f 2uaxm nt0aexn icilt mDea( s;t)aleoio totfp  auei (0 2xrir3io4aleelict s)sDrmum ;o4tptn octltfs2elu o;(0 ltrif ta1omD livi;t0s2um(r nydal nmnctl( s2rrxm nt1tpeomo3iat a2eaumsnt4 ltnxociatopDeluei;( t2umxm3nu4apee feilsfsrumxmp;u4alxnmf3iytfsDelumon()tlxrircoytfmt li s;s) exr(r3no4op  lfcils) rum(r ot0oeeoifcildfa2ea(ms;u0texomo3oydomte uesls t2xoio3oy4om  livtlt arumx p;t4oeeo fciydlaDrmnmo u)texoxrctotfpDeln i;t trxm(o3iy4alenlietls)sDra( p;o0teenio3ias sDra(vs () rtnmociy1fmDrlnvi ()sruoxm iy1lmte ietlsf Dur(r ot1optnmicilsla2el(msnt) etnio io1oateaieols)srumiopno4lpte nvs tfs2uaxr oo0aeenmoeiydls2ranvpn() rxrmf3iydomDrln s s0srtmir3iy1ll elfvia()aruax  ;u0oexnmiciytlm2um( o;u0trtoir3oy1fmD  ivs t)tetr(r nu4olt lncia()sDumuronu0ape moetldlm2rln on(0 lxrif3iadfp eauvsls)s2tmio3oodopenmictl(fsDraumont1aetn i3iysfm el(ms (4aeeomocto1fm  lu i t) etm(r3nu4omt  fvtl( aDtmxmp;o4ole miciltlaDrmu pnu)areoxrcta1lpDeaues;t0srxmxopiu4lm eliesas sDrmx ont0oetoifetyd sDrluvon()trtrmr tatlpD lnei;s)trtr(r ny1lltn nvs t  2raxmooo0ape  ictlt aDumuvonu4texnircoytfm e uvi s0t2xrxm no4lpenlnetlt)arrmur ou0ale if3tasls2emnmsn()trtrif iadopDrlies t)t2uo(o oydope mncs t)a2uaumpno1tee ioetytla2uanvpnu4 lxnmociotopt  ivo;(0 2xmxr io1apenmneilt sDrrurpou1opxoio3iys a ulnvs;t4aexnxo3ia1opDean i ( seuoxmpio1optnmfcta(fsrraum ;o0ale mieilt m rm( s;(0 ltnir3io1fptraiei;s s2xm(o3nu1apt mfctas arrmum oo0aeeomo3tas sDra( s;t4aetrircty1latranei;( srur(m3io4lpeemnei (  Dtmur ;o1tle mo3tlsfsDulu o () etoxr tatomtrau slt)t2xoim3iy1omtelfvtat) Dtru  nt1tlenioctadlm rmnmsnu0trxnxo3oytlaD li ilt) rurxm io1lpenmnet s)s2tmumoou4aet mo3iasfaDrmnms u) rtoxr todlmteauvi;(0s2tmxm3nu4altnmnvsltfarumu pnu4olxo icild mDrlumo;t4alxomf totfpt  i i s  eumxo io4lmenmncils a2tmu  ou0aexn fcilslm2ua(vp;(4alxrxfctotlpte neo t0 rxmir3nudap e icsls arra(mpoo0tltomociytla umums;(0texnxo3iy1fa elnei t t2uo(rpio4ll  licsa(f rraurp;t0teen oetad s2emumo (0 eerxfciodopDeli i t0 rxrio oo4oltelfeia(fs2ur(rpno1opt ii3iltfm ranmsn() lxoif iytlp eaivol()setr(o iy1om  mnvt t)a2taxmonu4tptomoetldla umnvsnt0texnio iydlm e uesls)tetoxo iu4al   ivsls sDtrx o;o4tet  feilsfs2ra(mon()aeenmr3ty1opD lnvo s srto(rpiu4lm n nct ( s2ta( pnt0aeeniiciydls2umumo (4tlxrxr ta1oa e u s;()truriopiydllenmfvslsf Durx p;u1optoiieildfaDel(ms u) exoir oytla eliei;s  rxrxm3iy4apte nvias sDrmur nt1oleomfctatlsDra(vsnu)alxrmr3todomDeaivols0t2xoxopoydlltemfctls artrxr nt0tetn oetyt aDrmuvp ()alenif iotlp eli o t0s2ur(o3io1amtnmict s sDuaxr ou1tpeniietldla ea(vonu) etnmf oo1fpD lnvo;(0srxrxmpoy4om nlicsl( aDrrx  oo4tpe moetytfs2em(mp;t0 exnxf oytlaDrai o;t texoir3oodamtelies (farta( oou0texniocilsfmDuluvon(4aexoif tydlp r ivi (  rxr(mpoodalen ncsls)srrr(rp;u0aexnifeiydlaDrmuvont4tltriocty1omtran s;()t2xmim no1lpe  fesl(  rurxrp;o4oeeniietatfa rm(vo t4 lxoxfctadlatrlu sl(0s2trxo ny4am e fei s)arrmuro;o4apen fciytfaDeanvp;u)trxrmr3tydoa  aivil(  rum(mpnu1apeemivi (f Durxmonu1apxniietyt m umu o (0trxnmocoo1fpDran sls)sexo(m oo4optnmfvi ()arur(moot0tee mi3iltfm2eaumpnt)aetnxr tydopDr ivilt) 2umxo3nodap nlneil( arrmxr no4oetn i3iatls2rlnvo t0 rtoircoadfmDr ieils s2tmxopiu4om nliesls)aDua(mo;u0aetnmo3iadfaDean s u)tltrxr3tytoa   uvols trtoio3nodoleemivs tfsrua( pnu0aetoiictas m2rlnms;u4aetnifcio1lpteln o s)truoxm iy4op elietat) rta(roou4aex mfcildfs2emnms;t0 lxnxocoa1fa rln o;() 2uo(opiu4lp n ncilt artrur ou4apeoif3iltfs ea(mp (4areomr3iydlatr u s s0 2uoir3oy4amtnlnct sfs2tauro;o4apenmfciadlsDean p () rtrif3iytlpt lu i;s) 2xrim3oo1omt mnctl()aDum(m oo4opxo fciydla2rmuvonu) eeoir io1lpD li ols  rxmxm3nudoptnmfei s)srrmum no0oetnif3iysfa emu p;u0altnir3ootfa elnvo s)tetmirpoy1amte fvil()aDrau  ;t0oleoiociatla ulu s;u) eenxfctodfat lneilt)srurimpiy4om  lfet s)aDumurono1aptoiocilsfm2raumsn(0 leoirctotfm eaiesls)t2trxm iy4al  mivtat)srtm(mpnu4aetniieilsfm2ranmon()treoxo3oo1fa raueo s t2ur(rpno4am emfeiltfs2umx o;u1apt iociytlm2emnvo (4 rxrxfciotoptr nvslt srxmim iydlp nmnetltfa2ta(rooo0ole  i3tyt mDulnms t)aeeomf oydopte n ols  2xoxm nudamt lncsat  2umu pno0aeenmfctlsfa2ea( p;t)alermoctatla raiei;t)s2xoxopoudlpe lfvs sfaDrax  ;o0tpxoio3ild a eanmsnt) ltoxf3oodlaD ln ilt0texr(r3nu4lmenlfeslt a2ta(rpot4alxn o3tlsla ul( o;(4 rxrxf oydfmDelnvi s teurxm3iydapee net tfa2raxrp;u1tleniociyt aDra( s;t4texrmf ootlmDeanvi s  rurxm oy1am e ics sfaDuru  no1aetomociasls umnvont0 rxnmf3ia1omD  ivo;s0 2tmxm io4aleemfcsat sDtax  no1oetoif3taslmDea(vo (4tltnmf iotfmtrlivol(0srtrirpiu1lmt  icta( sruau  nu1ole  o3tldfs2eln pnt4teenxrcoa1fm rauvo;t  2urxr nu1lltnmncs (f Duaxmo;o0oltn fciat sDul(mp;u4texnir tytopt ai i ()t2xoxm3iy4omtemnetls) rumur no1apt  feiysfs2ua(vont4aetrir3oytfpD anvi s s2tmxrpoo4omt  fvsa(faDtaxrpno0aet moetaslm2ranvpn(0aexoio3oatfmte nvs s) etmxm3nudameemneiltfaDrr(ro;o0tpxnmi3iys a2umn o t0 lxnmr iytom  anei;() 2to(mpnodomt mfesas s2tm(  nu1aptomfciltlmDumn p u0aeenmocoo1op eaueols0 rum(m iydamen nvtl(f Duauronu1aexn oeilslm2uaums;u)trtrmf oatlpt aieo;(0 euoirpiodllt lnesa(f 2tmxmo;u0tle ifeiad a elu snu)altrircootlaD auesls)trxrxo iy4amen fet () Drrur no4optoio3iysfsDeau pnu) leoxfctatlaDrauvs;(0 euo(o ou4apte iet t) Drrurpoo1tpe  octatfsDua(vs;() ltoxocoadlpteauei t0 2uoxm iu1oleelfvs t)aruaurpnu0tltnio3iysls2uan pnt0tlerxf oodfm  aivs s sruoir3oydlpeelivi tfsrtmurpoo4oeeniietys sDumump;u) lenir todfaD  nvi s tetmir3nu1aleemfvil(fsrtaumpoo0tpenifcilsfa el(mon(0aexriocoo1lptelu ol(0s2toio nudamt mnvi sfa2ta(mp;t4tex  oeiydlmDum(vo;u0trxoxf iy1lp e nvilt) rxo(m3oo1lm nmict t)srrr(mpnu4olxn feias a2umn s t4alxnifciotfp  aues;(0teurxr3ou1lptnlfcsls)arumum ot1oetnmoeils s el(vp;t0aexnmr3oy1lmteanei s0 2ur(r iu4alenlici ()s2rmx poo4altnmf3iatfmDemn s;t0arerio3oa1lpDelu i;() rumxopnodapeemfcil( sDtr(mpnt1ape  fciytfs emnmp t)tltnmo totlmt  ueols0t2ur(o3ou1llt  nvt t s2rruro;u4texoiociys s ranms;t)arerxf oytlm e uvs;s teurio3nudalte nvtlt)s2ur(root0alxnmfciydfa2rluvs u)aexrmf3ia1oa e iei;()srtmxrpou1lmeemncia(fs2trxmpou0aptoioctysla ra(ms;() ltnmo3iotfp elnvil()s2uo(rpoo4oltelfci tf Dtaump;t1tlxnmfctad a2ra(vs;() eeoif3oy1fm eau sl(0trurim3nudolenlict sfarrmumpot4openifcilt s2ua(vp;(0 eenir todomtr uei ()tetoirpou1lpe mnes t)sDtrxm ot4aexn o3tls sDrmuvpn(4alermr3ootfmDrlivsl(0 rtmxopiy1lltnmfei s  Drax p;u0oeenmociad mDua( ont0 exrif3to1oa  lu ol( tetr(m3ou4lmenlfviat aDurxr nt1alxn o3iysla2eauvon(4tlxomf3oytlpD ai ol(0s2xmio3nu4optnmneslsfsrrr(mpou4oltnioeils m2um(vp;(4arxomrcia1lm ean o s0 2umxm3oy4llt mfvils)s2tru p;o4tltomi3ils s umn o;() rxnxr3oatoaD lnes (0s2xmirpou1oltelnvia( sDtrur ou4tpxn oeildfm ua(mo;t0 ltrxf todfatr u ol( t2uo(r3ny4lpeelnvtl()artm(r no4teeomf3iasfmDeanmp u0alxoxf3to1fa  aneo t0seurir iu4ol nlfvia(fsrur(  ;t4aexn f3iytlm2rmumsn()altrxo oa1lmte u i;t  ruoiopnu1oleelicsatfsDtm(  ;t1oleo oetadfsDean o;t0 etrmrciadop rai ils)teum(mpnudlp nlictls sDtrum nu4tpt  i3ilslm2ulumo;t)tetrxocoa1laDean o s0trto(m3io4apee ncs sfaDtr(mpnt0oeto i3iadfa2ranvs t4tlxoioctydfmDrlnes s)srxr(m3io1opt  nvsasfaDtru ont1aex mi3tlslsDumumpn()arxoxf3tadomt  uvi;()s2ur(rpnu1aptnmfesa( aDtrxrpnu0alx if3iadls rl(mp;t4 etrxr3oa1faDeaneo;s) ruo(o3no4lpt  fviat s2ua(mpot4texo iciysla2eau sn(4 rtrioctatoa rli s t texmxo nu4lm   nesl(  Drm(rono4olxomiciys m ra(vo;u)arxrxr3ty1lm e ivil( tetoxopiy1lptelfcilsf rtaurp;o4ope ii3iyslaDumn o;(4 lxnxr to1fm  aies;t)truoxm ny4op elicsa(  Duau onu0tex if3tysfsDeanvo t4 rtnio3ootomt anvil(0 exmxr io1openmicsa(fsrtaumpnu1tex  ieiydlaDel( p;(0aexnif to1fm rluvi (0setoxrpoodope mici (fs2ua(  ;u4aptnmoeiltls uanms (4texomrctytlptranvo;t0 eur(o ny4olenmncslt s2rm( ono0tlto o3ilslm2rl( o;u0 etomr3oa1la r uvs;(0 rtrxmpoo1ap  lnvil()s2ta( p;t0oee mfctyd a2ra(ms;(4trerircoytomteanes;s)srumirpiu1apeemfvil( a2uau pou1aex mo3tltlm2eanvpn()tltnir3to1fmDrliei s0 rxriopoy1ame lict s  rrr(rooo1tlenmoeiatfa2ranvs (0 rtomf tytfp e ivol()trxo(o3iu4amte nvt ()s2rru oot0oee ioeiytfs2rl(mo () eerir3io1oaDrliesls setoim oo1amtelnctl()s2raxr nt4aleo oeiaslsDemn snt0altnifcta1op eai s;()trto(opoy1ap nmfetl()srurxr no1opto ictatfs2ua(monu4 rxomo iotomD luvo;t0trxo(opoydome  nci tfs2rrx  no1altn ieilslmDrm(mp u)alxrir3ootfpte ueo;t) 2xoimpnodome mnct ()sruauront1opxo ietlsls rau o (4artoxfciodoaD lueolt)t2toxopoo1lpenlivta()a2rrx  ;t1tex iociadlaDrmn s;t)aeeoxf3tadfateluei s0texmxo3iydapte icsa(fsrrmxm nu1apx ifciatla eluvs (4artoxfciytfmD aues;t)t2tmxm nudamtnlfetasfs2uaxmpnu0opxo o3ils a ua(vont)arxoir3iy1lmD an i;s)sexrimpoy1oltemietat)srum(m nu1tpx iietydlaDrl( sn()altomocty1optelnes s srtoimpny1alee fci ()aruaum oo4oexomfeilsfm rl(vo;(4alxrif3iytfm  auvs t)teum(mpoo4apenlnet t  rumurpot4tpxnmicilsfs umnms;t0tlenmrcia1opDeaiesls0s2triopnydlltelfvs tf 2rmumpot4oex  o3iasls2emumpnu)teeoxr oy1fp rlieil( trtoxm oydoptnlicia( s2ur( ont4tlx  ieiysfm em(vp (4artrio ty1fatr nesls  exmxo3nu4llt mfcsas  2urxrp;u0alx if3iltfa um(mp t4 rtrmo3oatfpt lueil(0s2xr(mpoydopeelivsa( artr(  ot0tpx io3tyslaDean o;(0aexnxf3tatfmte nvi t)texrxrpio1omtnlfcslt)srrrxmpoo1aexomietadfsDrmu o (4 rtnmrciytlmt aueil()t2urio oodamtnmnci tf rrmx ooo4tltomieild a2um(mont0 ltrmr tatlaD  n i;(0s2xrxr3oy1lptnlicslt a2rrxr nt4tet if3iysfaDra(ms;u0 reoxo todfa eaiei;t setoxm3iydll  lict sfarrrxmpnt4tee  oeiyslsDem(mo ()treoxrctydlat au o;t0t2tmio3iu1apee nvtlt)sDrm(r nu0olxnmietydlmDumn p;t)aeeoio3ty1omtrlneo;t0teum(mpoudal n fcta( a2rmum ou0opeo ociadfs umuvp t0alxnmr to1fp rln i;t0 2urxopoudameelici ()srrax  nu1olt moeiltfs uauvo;()aexrxrctadfptraueslt0srtrimpou4al elici tfsDrrxrooo4tee  i3tadlsDeanvp (0alxoio iadop   n i t0srxm(r3iu1llenlneta(faDuru  ou1alenmfcias s elumsn(4 rxoifctytop  au i s  2xoimpnodlm n nci t sDtr(r ;u0apenii3iltfaDum( pnt4trerir tatfm eai s t0 euoio iydale lnvsatf rtru p;u1aexn iciad m rl(ms;(4arxomfcto1oa   n o (0 eto(m3oudomenmicsl()a2tr(mp;o4oeen o3iatfsDul(mp u0altrir3ty1opt  uvi t)teuoiopoo4apt  ncsatfarrrxm ;o1aet  oeias m2ulu s t)texoif3oa1fat ai i;s)s2tm(opiu1lp   ncs sf Dra(rpot1apxomfeiat a2umuvp u0 reomociotfmD auvs;t0t2xrir3iu1ole lict t srtau  ;o4opxomi3ilsfs rluvp t0aexnif3oytfmD ai s (0srtmxr3iy4apeelietltfs2uaum ot4aexn ieiatfa eanvsn(4arenio3ootfpDeau s t0s2umirpiy1omt lfctltfs2ta(m oo1oee mieiat a2el( p;t0artomr iydomt aueo ()srurxo iydlptn nct s)s2tmxmoou4oeeomfeiysls em(von()aexoxo3to1omt ln i;( seurxo ou4opt mfet sfsDuax p;o4optoifctydfs2rmn onu4artrmr3oytop  lu o;s0sexrim ny4lpeemict t  Durx  nt0tpe moeiyslmDuaumo;u4 exoiociytla elnvo;(  rum(r3oudalt mnvias) rtau o;o1opx  fctyd sDumuvp u0tlerif3ia1lpt aues t)texmxm oy4ame mnet sf Drrxm ;u1tltnifctas mDrmumo t0aetnmfctodlmDraivslt  rxm(mpnodal e neia(faDta(r ;o1aleomoctat sDemu snu0alxnir ia1fpD ai ilt0 euo(m3oo4ope mfviltfs2ra(  ;o0alxo oetlsls2rau s;()aetomf3to1fmDrli ils)tetoirpio4ope lfcsat s2urxm oo4apeo feiasfa2ea(mpn(4 etnir totoa elivsl( s2xrxo3nu1lltemfvt t aDuaxrp;t4tex mfeiasfm eaumo u0trtrmf ootfptrlnesl()sruriopnu1lmtnlnctl()srta(m ;t4aleomi3iyt aDran o;(4altrir3oydop   n i s0srtoxm nodal  lncils) 2urumonu1alx  octas aDuaums u4artrio io1lp   nes;()trur(m3iu1omee fvsltfaDtmumo;o1aetn fciysfmDranvo (0tetomrctadoatean s () eto(m oudaltelnet s)a2umx oou1altnmietadfsDumnvp u4 etomo ia1lm  aues s sexrio3no1lm nmivsa(faDur(mo;u1optn feiyd m2ea(vs;(0 eeoxo oo1oatrlnvo;s) 2xrio3nu1lm eliciltfsDtm(r nu4optnio3iltfs2eluvs;u) exoirctodomD lueols  rtrxm3nu1lpteliesl() rtax poo1tptomfeiat m2um(mp u) etnmrciydoa r n i;t)trur(o3iy1ape  nes t)srur(rono1oeeoiocilsfm uln o;(4artnxrcoy1lpteaivilt texmxm io4ameelfesasfs2rm(rpoo4alenifeiydfaDumnmsnu0 etrifcio1fm eaueslt)t2umimpiydol   icilt) rtmxm oo4tleoiicilt m2em(vs;()altrir tatoa rlivs;t  rxrim oo4op  lfcsa( a2raxroot0ope mocilsla2uanmont4trxnxf3tytfpDelneo;s texm(r oo1llenmnviat s2ua(m oo0oet  i3tlsfm raumpn(0 rtnxfcia1la  aueolt0s2tmxopiy1ap  mneiasf rrmxro;u4olen f3tyd mDrlnms;t4 rxnio oy1oa raivi t trtoxopnydll   iei tfsrtaum ;t1tpe mo3iys a ul(mo t)texnxfcoa1oaDelivi ( trurxo3oy1apee ivi tfa2trxmono0alen ieildfm2uanmp t4aeenmf iadfa r ieo;s0t2xmxr io4optnlfcilt s2ra(r no0ape if3iyd m2uauvp ()tleomo iadlmtraiesl(0 exo(o3oy1amtnlnci tfsrrmumo;o1oet  ietadlmDean s t4texnxo iytop   ivil()srtrxm nu4lptnlnci s s2trum ot4apxnioeiad s2uauvp;t)tetnmf iytlmD
\ No newline at end of file
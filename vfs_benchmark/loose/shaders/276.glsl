@@ -0,0 +1 @@
+n o ()seto(r3io1lptn ivil( arra(r ou0tle ifctasfs2uau s t4texrxociotfmDrlnvsls tetrxo3nodlmenmnct sf 2umx o;t4aexn i3ilsfsDra(vsnt0tetnir3ia1oaD  ues t) 2tmimpou1lme mfeslt)a2rrxm ;u1tlxomo3tatla elnmo;t) rxrmf3ootoptr ieo;s0sexoiopnu4llee fvia(faDumxroot4alx  o3iasla rl( p;u)arenmrciodfate nes;s)s2tr(rpoydllt mnesltfaDurx p;u0tet mfetytfa2eauvp ()areomr ia1fat lues;()tetmim3no4om emivt s artrurp;o0oleoif3iyslsDrluvs t0texoxfcoo1laDraiei;()t2urim iudale  nvi s  rum(  ot1tpxomf3iydfm2eln o ()trtrmfcoy1omtrlueo;s0srxmxmpoydol  lictlt)a2tr(moot1tltnmf3iat s2uauvs u0artoxo iodomDe uvilt srtr(rpoy4lme  iciasf 2ua(  nu0olenio3tysfaDrl( o;t0aetrmrciadfmD  i o;() 2umxo3oodlpen ivta( artaxroou0apeniietldlm rlnms;u4 rtrxrcootfaDelu sl() rumim3iydlp  lfcsat s2rrx p;u0tex  iciys s ul(monu4 eerifciytop elieil( s2umxo iy4al e nctlt a2tax  ou1altn i3tls mDemnvsnt4tleomrciodfa  au o;t  exoirpou4altelict (fsruaur oo4oex mociatlsDemuvo;(4texnifcoatlpt ai s s)t2toirpoydoptn ncsatfa2um(m ;t0ole ifeilsfaDel( p;t)altnxr3to1oaD luei;s)t2xo(mpnudameelfeiat arra( pot1optniietltfsDrm(ms t)trenxf3tydfaDe u i;(0 2toxopno1llt  neilt)s2umxrpoo1aex  fctyt a2ulnmo t)artoifciy1lm r nes s0 rxrxmpiy1lp elfes s) rtm(mpnu4tpe mf3iyd m2eauvs t)tleoxfcio1lpteai s;()teuoim3io1lm eliet t  Duaxmp;o4texn icilslmDum(ms;t0aexnxocoydop eau s t)seurxrpou4lme miciat)arrru  ;t0tptnmfciatfm2ranmonu) rxoio3tytoatran i;s trxoxo3oo4opt  nvsat)aDtm(r oo1oex  i3tadfa2emnms;(0arxoxr iydlaDe i il(0s2xoxrpiy1omt  nvsat)srua(r ;t0olxo f3iyslm rmuvo;u)trtrmrcoadfa rlnes ()srumxrpiydop nmivi (fsruau o;u4tex  fetatfm rlu pnt4 leriocio1fa r neo t  rxo(rpoo1ol   iet ()s2ra(r nt1alxo i3iltfa um(vsnu)aexoxf3tadlaD  n ols0 etm(o3ou4lptnlfctl( sruaumont1tptoifciytfsDumnmpn()aetrxr oy1lptran s (0trxmxm3ny1am   nvtls arurum ot0aeenmfeiydlmDeanvp;(0 renxo ia1omt  nesls setrxm nydale  nci ( a2trxm oo4teenifeiatfsDrmuvs;u) ltrir3io1latranvo t) etmir3ou4al elnvsls)a2umx pnu1apx  octad mDea( p (4trenio3oydfm eaiei;t srto(rpiy4apee ncsltfaDuax poo4apxomociys s2emnmpn(4teenxr iodlmDrau i;( seumxo3oudom nmnvias  Dtm(root4tpt mociatfa2em(vs;()tlenmr3iatlmDrluvo s0 2tmxrpiudol emfcils)arrmum ;t4tlenmf3iatlaDeanmo;t4aexoxo iytla e uesls0t2xr(r3ny1ope lfeilsfsDumurp;u4altnmo3iydfa eluvsnu4altnmf3oy1opt liesl() eur(opoodlmeemfciat  Dta( ooo1oetoioetydlmDran onu)alenir oo1om ranvi t0sruo(mpoydlmtnmnvtl( s2ta(ront1oltoii3ildfa2ran p;()trxoif totomDe uei;s t2xoiopiu4lltn ict t)sDrru  ou4tetn ociys sDel( s;u0 eeomrctodfpDe ivslt)sexmim iy4apenmncta(f 2urxrpoo4tet  ietydlm2ulnms;t4 exrxociotlmteaivsls0 eur(r3io1amenlietas arrmxrooo4tpxomoetyt aDrm(vsnu0tetrif ty1opDeai slt  2trxrpio1optnmnctlt s2rr(rono4tltnmf3tadlmDumn s;t4aexoifcio1fm r i o t0 2umio3no1amte iesltfsDtaxrpnu4oexo iciyt a ranvs (0artrmo3oo1lm e ivils0 etmxm3iy4lmeelnciat  rum(r ;u4apto feiydfa ran snt0 leoifctydop r nvo t  etrirpio1omeemncs sfa2rm(m ot4tetn ieildfaDuln o t)artnmrcoatfpDeluvi;s  2uoxopoo4lp emivtatf rtr(mono4aleoifctlsfaDemnvs;(4 rtnirctydomD lueilt t2tmiopny1aptn net s srtmx  ou4tlenifcildlaDranmp t4 reomr3oadla eln s;t0srtmxr ou4lptelfct (fa2rr( p;o4tet  oeiaslaDuau s;t4 lxrmr oydfmteaieo;t)tetoxr3iudlmt livsas  rum(rpou0aptniieildfa2raumo;() lerxf ty1lmDeai s (0texoirpou1lm   nvs tfarurx pnt4aeeniiciadfm rm(ms t0trenifcootomte uvi ( srtmxm iydll  mfei s) Duru pot4tltnifctydfa rauvp t) renxo to1omDr nesls0t2urir3no4lpenmfvslt aDua( p;u4tpxniieils a uaumsnu0 eeomrctatfaDeauvil()srurir3nudome lnes sfsDtmxro;u4tlxn f3iad mDuluvp (0treoxr ia1om r ivols0 2ur(opiu4olen ivtl(  2trxr ou0aee mocilt s rmnvs t0tlerif ia1fa ran i;s  ruoxm nudap e fes ()sDtrxm ;t4olxnmo3iat a ulu s;(4 rtnxoctodfptr uvilt0 2trxm3oydom eliei t)artmx  no4tpenifciad m2ranmo;u0tleomo3oy1oa eauvi;(0s2xm(rpoy1op emnetl( aDuaxro;u1tlx mocildfm2em(mpnu)trenxfciodlmtelnvo;s srurimpnodapeemiesltfs2um(mpnu0open ocildfs2rmnmsn(0 rxomfcoa1faD lu sl() 2xmxo3no1lpee nvsa() 2rm(rono0tpenmociadlmDuanmp;t0arenif3oo1fpDeau s t srtoxo3oo1ll nlncs ()srumurp;o1ope mo3tltfa rlnmsnu) etoxo3oa1lpDeln s t)teum(m nudolee netls a2uru pot1tlt  i3iat m2ua(vs;()tetomf oa1fpteai ils  rxrxo3oo1ll nmfesas)a2uaxr ;o4altnii3iys mDuauvo;() lxrir iatfptr u o;( s2uoimpiu1al emietl()s2ta( p;o0oltomo3ildfm2ra(vont) etrmfciotomtrluvil(0s2toio nu1olt  fvsat  Dtrumont0tptoii3iltlm rmnvp ()arxnmf3iadfateau ols  rxoim oodol elfvsas  rumu pnu4aexnmociyt s2umuvp;u4 etnxf oa1fpDrluvslt0 rxoxopoo1ap  livs t) rtmur ot1texn ieiat s2rm(ms;t)trenircoa1lptraivols0t2uo(m3iudlpt  fvt t) 2trum ;t4oee ifcildls2uan p t) lerif iatfpDe nvol()teumir3oo4apee ncs s)a2raxrp;u0oeen ieiysfsDra( sn(0aexrir iy1lat an o;s0srtr(o3oudlltnlnesl() 2tmxmonu4aexnifeildfa eluvo;t)aetoirciydlp eaivilt) rtmio no1alenmncils)srurxmoot1olx iieilslaDumums;(0aexnxocty1opDelivs t  2xoirpio1ap n iesa(f 2tax ono0alxo fciltls rm(vs;u0aetnirctydla rluei (  2xoir3oy1lme lics (f 2uauro;u4teen ieiasls2rmu p;(0 rtrxocia1lm ranei t setmio3oo4lmee nvi ()s2um(mo;t4teeomocilt a2uluvp;t) reoiociydlate nvsls trumir3iu4llee nctlt)a2uaum no0oetomo3ilsfsDumuvpn()arxnxfctadlaD luvs;s texoxm io1olt livsls aDumx onu0oet  o3iatfs2rl(ms t)alxrxfcoa1oa ean s () rur(mpnu4lptnlfcsl( srtr(m oo4ape if3iyd s2em(ms (4 exrir3oydfmt  ivi;t srxrimpoo4optelfciasfsDrr(r ;t4apxn fctadlm2rmu p;t)trenio3io1la e uvsl()t2xoxo oo1lltnlfci s) 2urx o;o0tleo ieiatlaDumnms u)aexrmo3io1fmt lnvol(  2uoimpiy1amtnmivta( artrurooo4ale  fcild sDumu o (4aeenxfcoydomD lneo s tetrio3nu4oltn ivs ( sDtrx p;t4oexnifctys m eluvs t4tetnir iydfa  aivs;s)trtoio3iydap  lfcsl()sDrm(rpnu0tet if3iyt m2rlump;t4texrmf ta1lmDe i ols srtoir3oy4olt lnei s)sDra(moot1olt miciyslaDra( s u)alerifciatlmD  ivi;s) 2uoxo3nydopen fetat) rumx o;u0teeomfeiatlsDel(msn(0 rerif3iadoaD  ivo;t0 ruoiopiu1ameelnet sfsDurx p;o1alx  ietadfaDea( snt4teenio oydfp  li s t)setmxo3ny4lme  fcsls  Dtax oot1olx mfciatfmDrl( o t)artomf3oo1lmt lueil()t2uo(m ny4lmte iesa(f Drmx pot4tlxoifeilsfm2ulnmo;(4aexrxo3oatfm eau s (  2umxopoudopenlnvsat) rumx  ;u0oetn f3iltfsDean ont4 rxoxr iytomDrauei;t  rtmxmpnodopenlnvsat)a2rr(  ;o4oexn o3tytfsDem(mo u4trerir3tydlptranes;t)trxmxr3nodlpe  nvia(  rtr( ono0oee ifcilt a rlu onu4tetnxocty1lpD li o;() etriopnodlm nlncia() rtrum nt4tex moeiatfa uln s;(4aexomrciodfmteluei (0trtmxm3iu4om nlfci t)srrr( oou1tleomiciyd m2rm(mp u0aetoxrcoo1om rluei;t)sexoiopnydopenlivi ( a2urxm no1oltn i3tlsfm eln o;(4 exrxr iadoaDe neol( seurxr3nudomtelfcils) 2uau o;u0aeeniiciytfmDrlnmo;t0alxoirciotla eli o s)srurxmpiy1lmte ieiltfsrtr(rpot4apx mocias sDrmnvs (4arenmo tatlmD lneo (  2xm(r iy4ame  fetatf rtaumpou4oltn i3iltfmDulnmp;(0 ltniocoo1fpte ues;s0srur(rpiu4omen fcilsfsDuru pou1olx  i3tls m rmumo u4arxrmo todfaDraues;s0 etrim3ou4lpte fcsatfarumumpno0tee  octas mDranvs;t) lenxf3iadlmDeli s s0 2tr(r ou1op emietl()sDtmumooo0tlxo f3iydlaDuauvont) rxrmo tadomtrli ils0 2to(r3oudal n fcs t)srumxmono4tltnif3iytls ra(von()texnxociodlm  aivo;s0trxrio3no1al nlfctat)a2raurpno1aptn ieiytlm2uluvs u0tleoiocoy1om  lnvs;t0 rxo(m nudalenmivslsf rum(  nt4opt moeiysfaDrlu o;t) exnmo totlptrli s s0 rtmxmpiy1optemfci ( a2uau o;u1altoiociltfm2umu p (4tltrir3oodfp  anvs;() eur(o3nydlm  lfvia() 2urxmont0apen f3iytlm uluvsn() etoif ty1lp r n i;t srto(rpoy4lpte ncsatfaDtax  ;u1apt mfeiyslmDum(ms;() leoir3io1omteanei;(  2xm(m no1llee fetasf Drrx o;t0oeenif3ild a2elnmo;t0altrmociytom e ivs;()setmiopiydape  fet tf Dumumpou4aetnmoeias a2eauvo t) rermrcoytoatrliei (  rum(rpoo4altnmfcsa(farrm(mpoo1tetnmociatfa2uauvs t) exrmocootomte n s t0t2xoxm3ou4ll elnvslt)arrr(rpno1tlx miciydfaDuan p u0aetrxr3oa1oat lneo;s s2toxmpoo4ape miet t)artrxm ;u4opt iociyt m2eluvo u4tlxnmrcoa1om rlnvi;s srur(rpiy4olt lietat aDrrumonu4tpeomoetlslm2rmnvon()tlxomo tydfptraueo;t0 eur(rpou1aptnmneia()aDtrxmonu4alxnmo3ias a raumo;() rxrifctatomDrluvs (0srtrirpoy4ope  nesa()s2tmu pnt1tlenmociadla uauvon(0 exoircto1fa eliei (0srxr(rpiydam   fei (fsDtaur ou1olxniieils aDran onu4tltrif ia1lmDrauei t0 2uoxopiodapt micsa( s2rrxro;t0tpe io3iytlm2elumonu) lermociatlm rlnvilt0 2tmxopou1lptnmnet ()sDtaxrpot4alxniociyd m ulnmp (0tetoxr3todlmtrlueslt) euoir3nudlp nmfetatf 2taxr ;t0optomoetlsls2eauvont)trxomo3iotla  livsls0tetrxm nu1lptn ivt (  Duru pno4oleoioctydfsDumn snu0aexnmocoadfptr nvo;t) 2toxr io1alt  icsls sDtrxrpou4aleomi3ilsls ranmp (0alxnxf ia1fmDr nvi;(0t2xoiopnudaptnlivi ()arra( pno4teeo i3ils aDum( pnu4tetnir3tydfmD lu o;t)s2ur(o3oydol n ieta(f rrau  nu1aeto ietyt m ulums;t4 leriociytopDrln o () 2umir3iydape mfesls sDurum ;u4optnii3iydfa2rlnmo;()trxrio3oy1latrau s t) 2xmio nodalenlnct (  rraxm ou4tltn fciydlm2umnmont) rxoif todoaDraieols0 eur(m3nydlmtemfet t)aruru  nt1opx  ociad s2rlnvp t4 etoxo oy1fatraivsl( s2urxo oy1lptnmfctl( sDra( oou0tpe ioctatfs2ua(vonu0areomr tydfm  auei;s t2uo(o3nodalee ici sf rrm( oou1altoiiciltlm ua( p;t0tltrif ta1latrluei ()tetm(o iy4omee fvsat  2rrxm nt1texomicilsfs2rluvs t)teenmfcta1faDr nvo;t0 euo(r3iu1al n iesa()srumxmpnu4tpxnmietasfs ul(mp;u)tlxniocoadlmtrluvolt) euoir nudal n ivtat a2taxro;o4ape ioctytfa2elnmo t)trtrxr3ia1opteaues;s sexr(opnodom elivils) Drm( pot4aex  i3iadfaDraumon(0teenmocio1lpD ai o (0 rumio3oudol n icsa() 2urxrpnt1ope mictydlm rl(vo t)tetnmf ta1op  auvs;()t2xoxr ou4ap  mfcta()sDuax  ou1ape moetysfs ulnvsnt)teenif iytop rln i t0srurxopiu4al  mnet t)s2tr(r ;o1tlto fcias s ulu o;u0 etnioctotfa elu ol( seuoirpiu4ap  lfvtlt) 2tru  ;u0oltnmi3tlt m2rl(msnu0 eeomf3iydfatraneo;t) exmimpio4ope  ietl()s2tax pno0apx  ieild s ulu pn()alenmo3ootlptrau slt teuo(o oudomtemfeiatfaDrm(rpoo0oexn fetadfmDua(vo u0aetomrcta1op r n s s0t2tmim ny4aptelncsls s2raurooo0oltnmoetld m2em(mo (4 rxnxrcoadom r uei;t  etrim3iy4oleelieil( sDta(rooo0teto fetyd m rluvsnt4 rtnxf iydfmD aivolt t2umio iu4apee fviatf 2tr(mono0tet  i3iytfaDul( p t)trenxr iadoaDeanvi;s0trumiopoo1ll   nctatfsDrax  nt0apeoioeild sDelnvsn(4tleoxo totomDeau s t0t2toxmpno1amtn iei t sDta(rooo4tlx mi3iydlmDuanms (0alxnmf3oatlm eaies s)tetr(r iydlptemnvt (  rtmxr oo4opx if3iltlm ul( sn(4alenxf3iy1op eau i;t0seurxopiodalt mieias) Drm( o;t4tlx  oetldlm rmn snu)trxnio3iydlm r i olt)s2xoxrpiodom eliet tf Dum(  nt4olxoifciyslaDrlnvs;t)alxoio oydomDeanvs (0t2tmxopnu1op  lies t)a2uau  ou1aexnif3tldla2uanvs;t0 exomr iy1fm  auvs;t sexm(o oy4apt lfvtls s2tmuroot0apxoif3iaslmDumnvp t4tetrxocoo1lpD  ivi;t)t2xr(o3iydlmenlneil() 2tmu p;u1tpe mi3iydla rmnvsnt0alenmr oa1omDrauvi t trxoim oudam   neslsfa2trumpnt4tetnio3iasla eluvo;(0 rtnifciytoptrlivo t)t2xrimpiu4lleemiesa(faDtm(mp;t1alxoio3iysls uaums t0areomf3iatomtr uesl( teuo(m ou4am  mncs s)s2umurpnu4oeenmictysfaDem(vsn(4trerir3to1fmtrauvi ()trtm(m oodlp e fcil(f Drr(ronu4teenmoeiadfa2rluvp t)tetnircoa1fa raneils s2uo(mpoy1lpt lictatfaDtm(  ;o0opeoiieils sDea(ms;t4teeomo iodfpD lu s;s  rto(rpoodllte nvtlt) rraxmp;u1opxoiocilslm rl( s u0 rerir tadfaD aivils t2urxo3nodlmeelict ( artru p;t4tpenmo3iysfmDrm(mp;u4 rtoxocootfm e ueils) ruoimpiydapeelivs ()s2tmump;t1altoif3iys a ranvon(4tetomf3todopDranes;s0teum(o3iy1alen feia(fsrurxr nu1ape ifctytls ea(vo t)altnircio1fmDeaiesls0setoxopno4lmen fvtas arrmxmont0olxn f3tatls ranmonu)tetoif3to1optr n ols)srxmiopoydopenlnci tfs2rr(r oo0olxo f3tadlsDrl(vp;t0altomo io1la  ln i s)teum(mpio1altnmfvia( aDrrxmpoo4opeomociydls uluvpnt0 lermf io1op rauvils)seumxmpoodapenmncsl(f rtrumono1tpxn i3tlsfaDel(vo;u)aexomo3tatomD li s s  eurio3oo4oltn ici s srua(r ot0olxn i3taslm2ranvpn(0 rxnxo3io1la e ues s srtrimpiy4apeelivs sf rrmumoou1teeo fciltfm2ranvpnt0tlxrir iotlaDr nes s0srxrir3no4lmtnmietl() rumumpoo0aptniiciydfsDel( o t)areomr3oadopD  i i;t t2ur(o3iydomtnmnei sfa2ua(r ou4tpeoifetys s ua(mp u)altoir ootfmD  uvi;t0 rtrxmpoy4oleelfvt (faDtmxro;t0teen o3iatla2uluvsnu0aetoio oadlatrlueil( t2um(m oo4olt lfvsl(fsDtmxr ;u4apeomociad sDua(ms;t) lermo3oy1latr ieilt srtr(o3oydomen feta( sDurxmp;o4aexnmoeias m2eln pnu) rxnir3oytlp   ieolt s2toxr3io1lltelfcslt) 2tm(  oo0apen oetasla2rm( p u0alxnio tydoa r ueilt0s2tmxmpiy1lpeemnvsasfaruaxr nu1tpt mietlsls rl( ont4aleoxf oodfm rln i s texmxopiu1ap   fvs t)sDrmxmpnt0tle  ocilsfsDeanvpnu) eenmo ootlpte uvil(0 rurio nudoleelivs () rtru  ;u4oltn fctysfa2umnvo u0treriocoadlp rlnvi (0trumxr nu4opee ivs sfaDuaum ot4aexomietytfm2el( snt0 ltrxfcoadom   ivs;()t2xo(m3oy1lpen nci sfaDtrumo;t4tltoifciad a ul(mp;t)arxnircty1lpD  ues s)texoxopoudap  micias)aDtaxrooo1apt mi3tys a2um(ms (0 lenio io1fpDr uvilt0t2uo(rpoy1ome mfvilsfsDtax  ou0apxomoeiyd sDrlu p;u4aetoir3tatfmt  ies;t)srxrim3oo1oltn fcslt) Dra(m ;o4tle moeiaslm um(mo ()artrmo iy1fmDrln s;(0seuo(r iy1ome lneta(faruax p;u4altnif3ildlaDrau o u4 eenir totomtr nvil()tetmxo3oodopenlnet t aDurx ooo0oexo feiatfsDrl(vs;()aeenxr iodfmtr nei (0 2ur(rpiydlmtnlneil() Durum ;u4aleo ietydfa2emu pn(4artnxr3totfa  lu i s0sruo(mpoo4ape  ncs ( s2umurooo1tptnifeils a2ua( p t4tltnir3ia1oa elu i;s s2tr(o3iydlm emnct ()srur(m no4opxo ieils s2ul(msnt0 leoir iytomtran s t t2tr(o3nudopt mieilt)aDuaur ;t0aleo f3iltfa raumo;() eenxo tytfaD  n i t setrir3iu4omtemivi ()s2uaxr oo1tpeomi3tatla2ra( s;t) lxomfcoadfptr i ilt0srurxrpiy1am n ncsls)sDrmxm nu4olx iietld sDrlnvs;t0aexoxf3ta1fptrau o;t)t2xrxmpny4ol n fvt tfaDtaxroot4opxnio3iys s2elumsn(4tleomf3ty1fpt  nei s)sexmxrpou4al n iesat srrmur ou0tlenmfeiatfaDrauvs u)trxomrciodlpD luvslt truoir oydolen ivtls  rrmu pou4tpt  o3iatlm2rmumo;()alerxo3iodoaDeluvilt)trtr(rpiudllee nesl(fs2uaur ;u4aetn ictltfmDrlumpnt)tltoxr3oytoa rauvi s)trtmiopiydom  mfci s aDurxm ;o4oltnmo3iadls2ul(mp;t4alerirctydfmtrai s;t) etoxr3iy1omt mfei t srrrurpno4oexo ieilt aDul( s u0 etrmr3tatop eanvs t0 2urim3oydop nlnci () 2tmxmp;t0apx  f3ildfs uanvo t4texnmf iatlmteln i s t2tmxr nu4apt  fvs sfa2rmxr ;u4tet io3iat mDel( o t0arxoio3iodfmteluvi;s0t2tr(r3ou1alt  ncsa( a2rrxronu0tleo ieiltfa rmu s u)trenmociotfptrlieo t  2urxo nu4opee net ()srrm( pno4tlxo ictldfsDelu s;u0 etrmo3oa1omDranei;( teto(o3iu4lptemfvsls)s2raxr nu4alx  ieild a em( o;u4 rxoxo oytfpt  u s;t) 2xo(opoo4omtn feslt aDua(rpno0tpto o3ils aDrl(mp;u) rtrio3tadoaD  ieo t0setrir3iy4lmtnlfct (f Duaur ;t1oee  feiaslaDel( p;u0aetrxf iydopt  n i ()srxoxm3no1lp n net tfsrua(  nt4olxo ocias a2ran pnt)tltrxoctydlp r neo;t  eumiopnodllee ivt ( aruaxmpnu0olt mieiltlm ran p u4altnxr iatoaD an il( srurimpoydlmtnmivi sfa2umx pnt4apenmi3iydfsDelump;t0 eenmr to1fmD  nei;s  etoxo3nu4lmt miesatfs2rau  ;u4altnii3iysfs2uaumpnu) ltoio3ty1lpteln i;s0s2trim ou1omeemivia(fsrtmu ooo1tleomociatlmDum(vpn() reriocoy1lptelnvslt0 exoxm iydam n icsa(fsrrru pnt1tleomictyd mDrau s;t0alenxrcia1la e u s t)trtm(rpnydom  lies t)aDtm(mpoo1opt mi3tldfsDra(vsnt0 etrxf3oadlmte u slt)sexo(r3io1lmee ivsl( srra(mpou1opx mfeiatlm2rluvonu4alxrif tatlmte nvo s)sexoimpou4amenlict ( s2umum ou4open f3ils a2ua(mo t)aexoxf oo1om  an i;()t2xmxo3iu1lltelfct sf 2ta( ont1aptn feildfm2rln s;u)aexnmocoy1op eau s;(0texoim3oo1omtnmivslt  2uau o;t4altniieiltlaDulnvont0aleoxocoytfptrluvs;(0 2toir3iydopeeliesl(  rurumpot1tleo iciysfs2em(monu)trxnxo tadomtr uei ()teumim3nudll emfct ( aDtr(r nt4tpxn ictyd a uan p (4texoxf tydop   ieo;( trur(mpno4apeemnctltfa2taumo;u4opx moeiasfm ran sn(4arxrir tydopDe u sl( srtm(rpnu1aptn ici ( sDua(  ;u0aexoiieiltfm ra(vo;()aetnio iy1opDraieilt tetmxmpoydal nlivtl() rtmx ooo1oltoifetldfa rmuvo;u4aetnmo iatoptrau ol()srtoiopnydaptn fvtasfsDur(mpou1tltn ieiadlm2rmn on(0teermociodopDr u s;()srtm(opoo4amtelivsasfsDta(  ;o1altnmfeias s2ul(vpnt0trenir iadfmteli i;(0teurxr nudlle livtltf Durum ;o0olx ii3iltfm ea(ms;u0teermociydlmDrlu slt) rum(mpiudolt  ivsa(f 2raurpot0alx io3iatfs umnvo () rtrxf3iatomteaivolt)t2xmxo nudole mfetlt sDua(m ot4aeen i3iadfs uau s;u)alxomo3oadop r ueo s) 2um(rpiu4op  lietat) rtaxmp;t1aexnmoctad sDem(ms;(4arxomr3totfp  aneslt)srxriopiy1lp elfcilt) 2uru pno0oexomi3tas s rmumonu4 rtnmf iytoptraivsl() exoxmpoudlpen ieiasfarrmxrono1tltniiciad s rmu p;t) eerxr oytfatranvs;t0trtmxm ou1llen ncia( srrm(m nu1alx mociydlm em( pnu4aetrif3ta1laD  ieo (0srxmxr oudlptemfeilt) rumumono4tee  i3tldla2ulu p;u0tlxnxocoadoa r u ols) 2tm(rpno1op  mnvs tf Dururono4aeenmieiatlm em(mpnu4 etnmrciotom  lueo t)t2um(o3oy1ol  mnesas)sDraxr nt1opx  ociat sDuan pn(0trxomociodla r ivi ( srtrxm3iodlp nlfcia(f 2rm(r ;t1aleniociytfa2um(vp;()altoxr3iadop ran s s seumxm3iudllenmncil() Dtmx pou4oltnmf3iyt a2rmuvo (0trenxfcta1lpDeanvsl(0 rtrimpoudaltelfeiasf 2rr(r ot4ale if3tad aDrl(vs;u0 lxomo3tydlat ln o s teto(r no1lmtnmnvi (fsDurx  oo0apx iiciydlaDra( s (0tetnif iydfmt  ivi ()srtoio3ou1ll elicta()aDtr(  nu0tltnif3iytfs em( sn(0 rtrxf iatfp rln s;() ruo(o3oodomee nciatfa2ua(mp;o0tpe  oeildlm2el( o (0tlenmociotoat anvolt  2xo(o iu1omte ivia( s2ta( ont0apenifetytfm2rluvs t0 rxoxo iatfat liei;() etm(m oo4lme micsas sDumx pnu0teenmoeiytlsDraumo (4 lxnif ia1om eln s (0srxo(m nudop e fvtls) 2ra(m ;t0tlx mf3tldfaDumu o;(4 rtnirciotom ean o;t0seum(mpoydll nlfvtl()sDtmxronu1oet moeiysls2uanvp;t4tlxnxo3oadlmtraivs t)seum(o ou4llt lfesas  Dumu  nu0aetnmoetadlmDrm(vp;u0 exoxo tydlpD au o;s0 rumimpoy1lpenlivsl()arrmu poo1tpxoiiciydlsDranmpn(4alerxr tytlm rlieilt  rxm(m io4amt lfcsls  Drr(mooo0tpeoiocils m eau o t0aexnir3iydfptelnvilt sexmxm ou4alt mfvsa(  2tm( ooo0olen f3iatlaDranmp (0trenmfcoy1fm elnvs () eumirpno4lm emfcias a2tr( p;o4tltomiciasla umums;t0alxrio oadfm elneolt s2xm(r3iydoptnmfeslt aDrrxr ;u1tltoifciytla2rm(mont0 eenmo3iodomteliei t  rtm(o nodaleemnvil(fsrurxro;o1opt mieildfs rlnmsn()teermfctadoa  auvi t)t2xm(m3oudolee ieil() Dur(mp;o0oexnmfctydlm2eln o;(0aetrxrcoydlate iesl( t2urxm iy1al elfcs ()artm(mpou1teeomoetlsfa elump;u) ltomfciydomDe n i t) etr(mpnydalenlictltfsDrmxmpnu4tlx  feiasfa2elnvs t)arenio iatlaDeaivsl( srxm(m iu1aptnmicia( s2urxmooo4oltnifcilslm2elnvs t4 exomf3oatomt lu i;t texrim3no4oltn ivi s  Dururpnu4aet if3iyd a rl( pnt0aeerxr3iatfp   ieol(0 etrxopnudaltemfvsasfaDtru  oo4tet mictasfmDua(mo t4arerxo3todfptelnei;s trxmxo3oo1omtnmivta() 2tau o;u1aleo f3ildla2rmu pn(4aexnmo iy1omD luvil(0seuriopno1ale  fcsl()aDumum ;u1tpeomoeiasfmDeauvsn()aleoxrctydopteln sls teuoxm no4op emiei (fsDtr(rp;o1opto ociatfm2umn snu4tetnio3oa1fpD  u s s0s2um(opnodalte fetatf rtm( poo1alt ioetlsfm uanmp ()tlxnio io1latr uvolt)srtmxopiodol  lnci ( srumx  ;o0aeeo fciatfs uaump;t0 ltnmf oytfa rau ol() 2to(opoy4ome mnvt ( a2ur(m oo4aet if3iyslsDuluvs;u)aeermfctytfmDranvol(0srtriopiy1lm   fctl()a2raur oo1alxnmfctysfm rlnvpnt0altnxocoy1omtelues;s) exoim iodamtnmivsat srrmx ont0tlx iietad a2em( p;u)arermf3oy1fatelnvo;()s2urxm3nu1ameelfciatf ruaxmpot4teen fciltlsDrm(vsn(4 exnxo tatlpte ieols0t2xrxrpny4alenmfciasf Dtaum oo1aetn feiatlm rluvsnt4tlxomr todom e ies;s0 rxmir3nydlpenlfei sf Dtmu  ot1oetnmf3tatlm ul( pnu4areoxocty1oaDr n i ( trto(r3ny1aleelfvil(f Drrumpoo4tee io3iydlsDem(vp u0 ltrxf todla eaivs;t0 2xrxmpno1llee ieia(f rtrum ou1oee  fctyd mDean s;(4alxoif oy1fmte ieo t  euo(opoy4amt mnci t) Draxronu4aet mfciatfsDel(vsn()alxnif3tytlmteln ol(0srtmiopoodal nlicsltfaDumu poo1tpe  ociyt s umu p;()tltrmr3oy1lptelnvs ()trum(o3iu4openlivi s)s2rrurooo0alto oeiyt aDuauvsn(0areniocia1lp eaivs;s)seurxo ou4om emfci s)a2um(r no1alxnmiciyslm2uau o;t0 rxrmo3todfmDe n ols)trxrim ou4olenmnci ()artaxr ot4tex ii3iysfm rlums (0trtrmr3ootoat  nvi s  eto(r3oy4am emivi tfaruaumpno1tpxniociyd a ea(mo;u4 etnxo3oodfpD  n olt0 ruoxm iodapte neias artmxm ;u0tlxnmoctltfmDumn o;(4 exnio io1op eliei;t  rxoiopiu1am  mivils sDrm(  ;t0teeniicias m emuvsnt) exnxocoatfpDelu o;s  eurxm3oodom  mnciat)aDrmxr oo1tltnmfeiytlaDuauvp;u0 rxnir3tadfm  luvo t0trxrir3oydomtn fesa(fsDumxro;u0tex io3tls s uluvpnt)aeeriocoatlmDeluvsl(0teur(o iydomen fct ()s2umumpno0olx ifctydfa rmumon(4 ltnir3ia1optraieo s t2xoxm3oodlp  mnctl(f rtrx ont4aexnio3tlsfa2elu onu4trxrxoctodomteli olt0 rumio io4aptnmieil(  rurxm ;t0olt  ietls a emums u4tlxnifcoo1oa   uvi;t0 2toxm3oodop  mnctat srtrxmpoo0oeeoiieiatfa ulnmo;u0aleoxoctatfmDelnvols0trxr(m iodoltnmnvta( srur( o;u1oet  ociyt sDemump;u0aetoxr3oydoateluvo t0s2uoxm3oy1apeelietl() 2ua( p;o4oexo i3iysla2el(msn()aetrxo iotopte ueo s) rurirpoo1omee fvt t sruaurp;o4alxoii3ild s2eau o t)texrxocoatoa ranvols t2to(opno1ll nlfes s)s2tm(m ;o1aet mfciltla2eln p;u)tlerir ty1la  an o s0sexoxmpiy1ome lieta( sDrrx ooo0oeenmoeiytfm emn ont) ltoxfcoy1fm r uvs;t sruoir3oudopenliei tfaDua(moot1opeo f3iltla2ea( ont0artnifciadomteau s s sruo(m io1lmeelfet (  Drmxmo;t1aptnmociadla em( pnt0texnmf iydomDelnvi (  rxmirpno4op elnesa( a2raxro;o1aexnmoctadlmDrlnvpnt4teeoio3tytop  lnvs;s) exoxrpno4ll nmnviasf rtau  ot0opxnifciaslsDelu s u4arenir ta1fpteanvo;( t2xm(m no4ope mnesls)srrrum ou1tpe  ictls s rlnmo;t0 eermf3oadfatr uei;() euoim3iudll   fvt t  rum(m ot4tle mo3ils s2eln p u0tlxrxfcoa1lmDrlu ilt)srxrxm iodapte fct t)a2trxro;u0aeeoifetatfa el(mp;t0 etrifcio1lp   uvo s0 exmxo no1olt  nci tfaDtr( p;t1olx iiciyt sDel( p t4aeeoif oodlp   ieo (0 exrxmpnudomee nviltf rtmu oot1ale iietaslm2el( s;u4tlenmr3oo1lmDr i s;t0setrir3iodol  mnvtasf 2tm(mo;o0aeen o3tadls eauvo;t0 lxnmf oadfpDr n s t)t2ur(mpnudopt lneias)arrmu  ;o1olx io3tatfaDem(vp;u4arenxo tydfm ran i (0seur(o iy1oleemfvi t  Dum(m oo0tpe  ieiasfm ulnvp;u4 rtoio3totfmD livi;(0sexoio nodolenlfvsa()sDra(  ;t4tee mfetls a2em( p u0 rerxocoa1lpD  ueo;t trtmxopoo4ap  lieilsfsrtmumoot1olt mocilsfm2um(vo;t0aetrmo oy1laDe ivo;(0sruoir iudamte ivi tfsrtrx  no4ole mieiydlmDumn s;u4altnmo oadomDranvs;()trxrxmpoo1omtemfvtatfa2tmxr ou0opto f3tls mDeaump u4aeerif iotlpte uvi t trto(o ou4altelfvi ()a2tmu  ot4alx miciydls2rln o t)tltriocty1fp  liesls0 2toim iy1lltnlnei tfarra(r ;o4ape moctytfa el(vo (4tetnmf oydla   nesls)srtrirpnu1optn icsatfs2ur( oot1opeomoeild mDranvsnt)teenmo3todfmD  nes;t0 eumxo oo1al  lics s sruaxmono0ale  i3tasla eanvo;u0trenmo3oa1fpDelivil(0tetrir iu1llee ivta(f Dta( ono0tpt moetyd sDuauvp;u0altrmf oadom  an s;t)tetr(rpio4al   netas  Dua(mpnu0alxomoeiydlm2rm(mont0arxnxr3ia1fpt ai i t0t2ur(r nu4altnmieils)a2um( pot4tpe  i3iad s2emu pnu4tltnmrciodlpDr u s ()s2uoimpiu4llenmnei ( srra(m no0olenii3iadlm ul(mpn(0tltnifctatfp ean o s  rxm(rpoudlp  mfvias  rururono1aetniieiasfsDrm(vo;t4tlxoxrcoytla rauvs;t0 2xmxm iu4am   iesat)aDrmumpno1oltnmi3iydlsDean p () rerxr oa1la ranesls)t2uo(mpnu1lp nmfvils) rur(ro;o0teeoio3ias aDrlumonu)altrxr oy1lm e n i;(0 2urxm3iu1op  lieil( aDrmx pno1tlxn ietytfs ra(mo;(0tlxnmfcio1fmDean sl( s2uoxrpio4al elfviltfaDrru poo1tptoiieildlaDuln snt) exoirctotfm eluei ( srur(opny4oleemivsl( srraxrono1alxn feiydlm eauvo ()aexnxfciadlat au sls  2um(m3iudol n nvtas) 2trxmono4optomo3iyslmDul( s;u)alxnxrctadomDrli s;t  euoxopnodlp emnes (f 2tmum ;t4oltnmfeiadfsDrlu p;t0aetoxf3iy1fm elnvs;t0trumim3oodap elfci t)aDuaxrp;t1olxnmieiasfm2ean pnt)aetoif3iy1lp e nes s0setmiopio1lmen netl()aruaxm ou4olx mociys sDrlnvo;u) lxoxf oa1oa elivo s  rum(m nu1lmenlnciat) rrrumono1tex mf3tasla2eluvp t)trtrif3tadopD aneil( srum(o oydam  lnvil(fa2ua( poo1opxnmiciat mDrmu pn(0alxrmf3oa1lp  ai i;s0 2uriopoo1amtelivils)sDtm(m ;o4alx ifeiltfmDul(mp;u0arerxf3todlmte uvsl(  rurio io4lmenmfvslt srtaxmont4ape mi3iys aDelumpnt)tlerir3ia1fa  ln o;( setm(opnu1op   feslsfsDtmurpnu1apxn fcias a em( p;u)aetrif3oy1fa r neo;() rxoim oo1lpte nvslt s2uaxmp;t4tltnifctasfa rmnmsnu4 ltnmf3tadfatr iei (  2toimpoodlpen iei sf Dtrum nu4alx iietltlm2uluvs u)aeeniociy1oatrluvo;(0s2toirpnodll nlfct s aDrruro;t1tpeoii3iydlm2uauvs t4teenxf iodoaDelneol( t2xmim no1amenmfcilt s2raxrpnt0tpxomi3tytfmDranmp;u4 lxrioctotfatelies;s)t2uoxrpno1aleelics t) rrr(mp;o4aet  o3iadfm el(msnu0treoxrcta1fp e uvi (0 ruoxm3oy1ole  fvsl( a2tau pot0teeo feiydlsDeaump ()tltrmf tatlmteauvol( s2toxr3oo4ameelictls)s2uauroot4optniiciytfaDrluvpnu0alerircoo1fa   ivs ( trtr(m3nydlm   ncil()s2rm(rpnt1alx ifciytla ean o u)tltnxr oodlm  livs;(  etr(opio4omen nvtls) rrmx pnu1tpx  fctas sDulu o;u4aetnmfcoadlate uvo s) exoio iy4llt lnciat a2rm(ro;o4tex  ociys m rmnmonu4tetoio oa1oat anvi;(0srtrxopno1ame  iesls)arrmxmo;t0ale  icild aDeau s (0teerif iydlat auvil()t2xrio iydaltnmictas  rtr(mono1ole if3iltfm uanvo;(0 eeoxr3ia1fp ean ol(0 2uoio oy1lm emivtlsf 2ur(m ;t0apen iciyt m ua(ms;t)trxnif ta1fm e nvslt0s2uoiopiodolee fci ()sDrrurooo4tpxnmieilsfm2rlu s (4artniociatfm e nvols)s2trxopnudap elfcilt  Dra(m oo4ope if3tatlaDel(vpnt0altoir3tydlpDr ueo t0 ruoimpiu1lmeemfcil(fsrtrur no1oleomfctat s2emnmonu0aetomrcio1op eai s;t0t2urxrpoydal e nvtl()a2rm(rono1tpeo oeiatfm ra( o t0alxnir3oydopt au i;(0 rum(m3iy4amt mieslt  2uaxm oo4olt ifctatfmDua(monu0alxrircta1fpDeli i;( trxm(o nydolen fcia(fs2rru  ot0tpxoiictldlsDemn pnu0 rtnxf ootoa rli i t) exm(mpiy4al   fesat) rua(mpnu4aleniociltfaDrm( s (4artrxfctadla r uesls) exmir oydlmtnmfvs s  rurur no1aetoif3ild s2ea(mpnt)trenmf3iy1opDr uvs t)trxmir3iodlmeemivia() Dtm(mpou0opx iocilt s um(vont4 lenxf3tadomtrlu s ( s2xm(o3nu1lm e fviatf Dumx pno0opeo octasls2ea( s t4 rtrmfctadlpte i il(0 rtr(r iu4ape  nct (  Dumuro;t1olxoiicild mDua( pnt4areomr iadfmDrlieo;( s2uoxo nu1al   ncsl(f Dtau  nt4aleoiicildfm umn p u) etrio totoptrlnes (  ruoir3iydlltn netat s2tr(mpou0optomoctadlaDul(ms t)tltnmociy1op  luvslt  rxrxrpoudopenmneias arum(  ;t1apx  fciyslsDul(mp (0texnxociydoatr ivi;(0 ruoxo ou1ome  nesa(f 2umuro;u4aetnioeilsla2rmump;u4alxoxrcoydlmDeai i;t0texmim3iy4ap nlnci tfs2tmur ou1tpeoioctyd sDeln s (0artrmo tytlp eai i;t0 2toio io1openmfvsltf 2ra(mpno4aee  o3iytlm rluvon() exoxf3iydfptr u i;s t2tr(o iudoltemieil()s2tmx ont4optnif3tyd aDea(vp u4arerxr tatomD ln ilt0s2tmim3nudll elictl(  2rmu pno4aex iociys aDraumo u)tlxnxr tadfmtelneo;(0 exmxo3nu1omtelicsls aDumumo;o4tlt io3tat s2rln pnu0 ltnxr3totlmt lnesl()s2ur(o oo4lleelfctl() 2ur(roou0oex if3tas m rlums;u4 lxomfcoa1opDelneo;t) 2um(m3oy4lmee nvtas sDtmu onu0ape mfctytls emn p u0arxoifctydlatraneil(  rurxopiu4omt  fvilsf 2ur(roou0tlx iictysfs2rmnvp u0aetrmrciytop  anesls srurxm3iu1amtemfvias s2rrx p;u4aeenio3iydfs rm(vo u0 rtrirctadlm e neolt  exr(r3nodll e fct tfsrrrxronu0tee  oetydlm ulump u4 exomo3oodlpt livo s0 euoxmpiy1ll n ici t  Dta(m ot4aeen oetyd aDuauvonu0 etrxr3iatfmD anvo s0s2um(rpio1lme mfctat) Dta(  ;o4opxn i3ilsls2eanmo;t)arenmr3to1faDranesl()sexmir oudaptn neta(f 2rmxmont1oetnifcias m emumo u0 rtnxrciotoat an ol()teur(o ou4apenmfvt s)sDrrxmpot1aeeomfetys aDran s;t0aeeoxo iodfaDran s s s2xo(o3iu1lmeelietat artmur ;t0olto i3iltfs2rln o;u0teenif3oytomDraieo s0sruoim3io4ol  lici sf Dtmxr ;u0tpeniiciyd mDrau s;t) rtomf oydfm r u i t) etoio oy4om nmnetas)s2raumo;o1olx iieilslm rmumsn() rtnmf iydfmDe uesl() 2uoxo io1apen feslsfa2rrxmo;o0tlenio3tldlm eluvpnu)artrxfciy1la   ueo s0trurir3ny4lmt liet s)s2rmx  ;o4apenmfctld mDua(vpnu)tlxoxr ootfpteaueolt trur(opou4lptelfcs t srurxr ou0oetnif3tldfs rmnvs;u0arenmo iodlmDean o;( teumirpiydameemnvs ( s2rr(  ;o1alt mi3iys aDeauvp;() exrxr ta1fp  li o ( tetoim3no1om e fcs sf 2tr(  ;t4olxnmo3tat aDrl( snt)arxoxr3todoptr ies;( sruriopoo1lme mieta()arrrxrpou0oetn ociltlsDelums u0trxrio3ty1fatranes s0 rtrxm io4om emfei ( artm(moou1tpeo ietatls2ul(mp u0tltnio3totfpte ues;t s2umxm3oydlptn ivtlt)s2ra(rpnt4olen f3tyt aDelu snt4 lxnif3tadfpD anvo () 2xoxr iodlmenlnvia(f rtrxm nu0oexnif3tltfaDea(ms (0 ltrxr3tatlmD livi;()s2tr(o nudaltelics s) ruaumoou1opxo ietysfaDum(mp u4tetnio oa1lpDrlnei;s)trxmir3ny1lme  iciasfarrrurooo0alen oeiyt s ulnvo u0arxrxo ia1fate ivol(0 rxrim oy1ape mfctas)sDurxrpot1tpx  iciysla2rmump t)trtoircoo1fat ai s;s  2umim iy4lm e fcs s sDur( o;o0aptn i3tltfs rmn onu4tltnmr oy1lptrlneil(0sruoir3iu1al  lncils)a2raxmo;o1tlt mo3tld s2ua(vsn()trerxf ty1op rlieo s0s2xoio oo4opt  fes () Dururono4tpeoii3ild m2ran p;t0aexrmf oatlm  luvs t0setrxo nydom  lfesasfaDumu  nt4tex mfciatls uan o;u)areoio3ootfp ean il(0 2xoimpiy1amtn feiasfsDurxm nt1tpt mi3iyd aDemu snt4artnio3iytoa eauvsl( s2xm(m oy1ole  fct ()srrmxrpnt0oexomfeiatfsDuan o (4aetrxf3tadlmDe u i;( seuoiopio1ll nlfctl(fs2rrxm oo4apxo oeild sDelnmo;u4 rtomr3iy1laDeaivo;t)tetmxo3io4alt lfcia(f rrrum ou4tee  fetls sDea(vs (0teenioctytfateluvo;t t2xoxm3ou4lpt lnvs () rtrurp;t1tex  f3iatls2rmu p;t) lxrxo3oy1fpD  ieols0 2urxo3oudlp   ieia()sDtr(rpou4tlt  fcilsfa2umnvo;u)trtnxr3tatlpt  ivi;(0 2xoxr no1lpt liesat) Drr(mooo4opx micildla2rmnvp;t4 rtrxociytlaDranesls0texoxopoy4olee fesat)arum(ro;u1aeeomocilt s ulnmo (4aeenmrctadfate i slt) rxmir io4op   icsl(fsDrr(r ;t0oeto f3iys sDulnvo (4 lxoxrcia1lmD  u s t  rurxm iy4omenlivia( arrau o;t0aex  fciasfm2ulu p;(4texoir3oo1lmDeli s () 2xo(r ou4am e fvtatfsrrmumpnt4aeeo i3iltfm um(vpn(0teeomr3todfmt  uvs;s)srtm(m iydlmtelnvtlt  Dtrxmpno4olx  ieiys m2rl(mp;t) etoxo3iatfat au s (  2xoxm iu1al e net t artmx  ou1tee  o3iysla2ea(vonu4 rxrmo3oytlaDrauvilt)s2tmir iudlltnlneias) rtmu o;u1oltn icilsla uanvs t0tetnxf oytlate ues;s) rxriopiy4ol  licsasf 2um(r nt0oee ifeild aDem(mpnt4aeermfctotlpt aies;(0trxoim3iu1om nmnetl()sDrr(rono1opx  fciyt a emuvo ()trtrmo todlm  lnvo;t  rxoxmpiu1aptn ivtatfsrtrurpno1alen i3iys s2rmumpnt0texrif3io1fptelueo t0 2uo(m3ny1ol n nciat  ruru ont0teenifeiad s2em(mpnu0trxnmfctytomDr u s;t  ruo(r iudll nmivtatfs2rrxm nu4tltnioeild a rmuvs t0 rtoxf ty1lpD ai o;t0 2trxmpiodameemfet t)sruaxronu0opt ifeiltfsDulu o (0arxrir iatlp   uvs;s0 eurxo3oudlpt livsls sDta( onu0opt mi3iat a emn on()artoxfctodlpD  nvs t0 2tmim iydap nlnes t  Drmx o;o0aeto ictydfm2rluvp t)tetrioctotfatrau o ()trurxo ou4lmtn ivia( a2umum ;t0ope mo3ildfs rmn s ()arenxo3iotlpt  n olt0 2umirpiu4am elnci s sDtm(monu4opeomf3iyt s ea( onu4trenmrcoydlmDeauvo ( s2tmxo3nydoptnliei sfa2taurpnt4oex  octatla um(vp;u)trtoxf oadlptelneo;s sexr(m no1olt lfctlt) 2rr(mpoo0tpt mfciysla2raump t0altrxocio1opD aivols0srxr(rpoy4aptn fci () rra(m nt1tpxomictyd m2eanmo;t4altrmrciy1lp eaivsl()s2xm(o3oodomtnmfvils s2ur(mpoo4tlx iociasfmDranmp u4 lxrxfctydfpte uvo s0srtoim3ny4omtn fcslsfsrrmxr nt4aleo fciyt sDuanvp;()trermoctotlpte uvsls)t2xmxrpoodomen icsl(f rtau  no1apxomfciasfa2elu p;u0tltrircty1fmDeanvi s s2umimpio4am   neil(fartaxmp;t4tpx  fciat aDemnvsnu)arenxf3to1lp  aneo () eto(o3nu1omtelnesat  2ra(r no1apxnmfctaslsDrluvsnu4 rxnir ia1oat livol()srurxr iudlpeemicia() 2rmuroou4tex moeilsla2uln s () lxrxocia1fmt  nvols srtm(o oy1lltnmiviatfsDtmu  ;o0tlxoifciydfsDrluvo;(0 ltomo tytlptrlieolt)seto(mpou4ope  fciasfsrtr(  ;u1tlx iieiysls rmu p t0 ltrxocoy1la   nvilt0t2xmxr ny1opt  ncilt) rta(m ou4tlxnmoetat a2emnmpnt0 rxrmociy1fm rlivo;() ruoxo iy4alenlicsat  2taump;u4apxomieiadfs um( s (0arxnxfcoytlpDe u il() rxoiopny1amt mieiatf Draurpoo4tetoifciyd m2rlu snt4 rtrxf3todfp rlnvols0trxm(opoy4ap nmfcilt)srta(r no4alxn i3iat m2uanmon(0 ltomr3oadlaDeaiei () 2uoio3iudap nlnvsl()sDurumpou1opxnmfciyd m2el(vs;u4 exrxf3todfmt aivs t0s2xo(opiy4opee icta()sDurur oo0apx mi3iatfsDra(vo;()teeoxocia1lm elnvi s0srto(m3ou1alee fcslsf Drax ooo0altomictytlm uluvp;u) lenxociytomtelneo;t trurimpiodal nliesl(fsrtau p;o1aex mi3tasls2emnmo;u4 ltnxr3oodfptrauvs t0s2urxo3ou1ap emivi s)a2ra(r ot4alxo ictlslm2em(ms t)trtnmr3oatlaD  ivols) exmir oy4optemfeiasfa2tm(mp;t0opt mieiys a rlump;(0artnxo totla eanes t0srtrim3io4ap  lncta() Dtaurpno1tpe iieiydfaDuanvo t0tltoxo iytom rlivs (0seuriopou1ap nmictat  2taxm ou0aexnioeiad s elu snt0 ltomo todlm rai o;s0seur(mpiu1olt lfctlt  2tax ooo4aptn fcilslm2ea(vo;t4 eermrcoy1laDelnesl()trto(rpoodomenmneslt)s2rmumo;t4aexnmfcilt s2rlump;u4 rxoir3iadlat li o ( sexrir3iydamte fcs s)sDurur ot4aetnmieiatlsDrl(mp (0arerxr io1fmDrlueils) ruoio io4ll elncs s) 2urxmono1oex  o3tysfm2ulnms t)arxnio ia1laD an o s0seto(mpio4amt  nes s)artmxm nt0apeo fctltfsDeau o t0 eerxociodlp  lieo s t2tmxmpiu1op n net t)sDuauro;o1aee ifcilslmDumu sn(0trtnmr oadlp  li i (0 etrxm3nudolee nesa() Dtmxm ;o1tpxomietadfsDem(vs u4texoxociodop r u ols0srxmir iy1oltn netas)sDuaxrpnt1opt iietldfmDrauvp u0altnmr oadfa e nes;t0srtm(o no1apee ivias)s2raxrp;t4tex ioctltfa2uan s;(4texnmocoy1fpD  i sls texoirpiodomenmieta( s2tm(rooo1tpxoio3ildlm emn o (4trtrmf3io1fm   n sl(0 2xrxm oydal  mfcslt arrr( p;o4alto oeiytfsDuau s;()tlenio3tadomD anvi;(0 2xo(m3nodlp   iciatf rtrxr ;t4aeeomi3iydfs2uan o t) ltrifcoodlpD aneil(0 2xr(m3iodalenmicia(faDtmumpoo0apx mictatfa2rmump;(4 rtnmo3oy1optr uvi s teto(m3oo4amee nci t aDuru p;o4tpxnmiciltfs rm( p;t)trtnmf oy1fpteau s t) 2tmimpoo1opeelfciltf rur( o;t4oleoii3tyd a2rlnvs;t)texrxrctadomte n i ( t2uoxmpio4lm e nes () rurxronu1ole mfciat s rl( s (0 ltoioctytoa  lies;( setmir ou4omenmieiat srrm(mooo4tptomfeildls2emnmpnt)aeenxr3iodlaD luei s trto(rpny4apeemfeiatfarrrx onu4tpen f3iysfa emnmp (4 ltnir oodlpDr iei s0teuriopnydlmtnmncsat)sDrrurooo0tltoiiciyd sDrmums t0texomo3oy1opteauvil()trtoio nydalee ictasfarurur nt4apx  o3iysls eln pnu0trxomf oytfp e uvo;s  exrio3nu1optnmivsltfs2raxmpot4olx mfeils s emu pn(0trxnifcoadom eai o (  exoio3iudlp nmfcia()arurum oo1tlt if3iaslm ea( s;t) eerxocty1lp eau sl(0seumxo iu4ll n ivsls aDur( pnu4altomoeiysfa rl( o;u)trerifcto1fpt aues;() rtrio3oydomt mfetlt)srtaxmo;o0oltn ociydlm rlu o (4tltomr io1lmtrlieo;( seuoimpny4omeelivtlt)aDtruront1tleoiictyslm2emnvpnu0artrxf3to1lptraieils) 2toir3iy4al  mfctlsf Drmxmp;t0tlxn fciasfm rmuvpnt4tetrio tytoat lieo;t trxoim3iy4alee ics ( sDum(rp;t4olx  oeiytfsDranmo;u4arxoxo oadfaD  neo;(0sexm(o3nu1apt mieia(fsDururp;o4ope moetydfs2rlums;(0trxnmfcoatop rai s t0 2ur(opiodop  mietlt)s2taxmp;o4tpx  feiasfm2elnvpn(0aetrioctatfm eauvols)trto(m nodamtn ivsa()sDtm( o;u1tleomiciytls ua(vo t0tlxrircoo1la ranvsls) exrirpoo4alee fvi t) 2tr(rpno4alxniieiadls2umuvo t0aeerxfciotomDeluvs;s0t2tmxr3oydam elictls srur(rpnu1oexo ociltfm rl(ms (0 reomr3tytfmD an o ()sexmxm iodaptnlnet ()aDtaxrpnt0olt  o3tld mDem(mp t0trxoif ta1lmte uei s0tetoir no4ameelncslt)arurxmonu4oeeo i3ildfaDelu pnt0 rxomr iodoaD  nes ()teuoir oo1omtemnetls) 2tr(  nt4tetnmi3ias m2umnvs;()texrir oo1lmtelivo ( srtmxr3nodapeemictls artmxront0oetomfeiatlm2eanvp u)tleomf iatfp e uvolt trtoxr3no4op e iei (fsDtm(rp;o0tpt  fctls mDelnmo u)texnio3oa1lm r i olt trumim3nydamt  iet ()srtmum ;t1alxoii3ild s2umnvo t4teerxocoatopD  uvo t0s2um(m iudlle lfci t sDuaxr oo4tlxomo3tysls eanmon(4trxrmf todfpDelueilt)t2tmio ou4optemfeilsfarrm(ronu4tpeo oetatfs uau pnu0artrmf3tytlp eaneol(0 etoxopnodlp emictl()srrr(moou1opeoiieiys sDuanvo ()aexomo3iatomteau o (0t2uoxr3nu1lp n fcsasf 2rmxro;o0tpe  o3iytlsDra(vo;t4 rxrif oa1opteanvi t  2xr(o ou4amte fes (fsrum( p;u0alenif3iad a ea(mont0aleoxrciatlpteai s t0 exr(m3oydll elivtlt)sDtmxmono1aptoiietldfs uanmp (4 lerir iotlptraivs t teuoir3io1llt lfes (fsDtr(monu1olxomfeiatfmDrlnvo u4texnmf3iodlpD luvs;t0t2tm(o3nu1lleelnvtasfs2rr(r ;t0olen oeiatlm2ean p u) rtoxf3to1fat an ils  2xrim oo4amtn neil() rtmumonu4olxomo3iasfs ean o;u4aexnxr io1lat  ueil()t2tr(r io4amtelicilsf Dtrx  ou4apxnmictld aDul( p (4 rtoxocoatlat li o t  2to(o3nydomte neias srtr(m no4apxnmi3iadfs rauvo u0 etrmfctodlmDr neslt setrio3iydale micil() 2tau p;t0tpxn ieiat m ranmpn() eeoxo3iytlatraivs () euoio3ou4ope micsls  rra(m nu1olx mieiytfm emnvsn() lxnxf3iotlmteauvslt0trtm(rpno4lpt mfei () Drrx p;t0olxn ociadlsDumumpnu4trxnxf iydfmte nvi;s s2trim oo4openmfvs t) 2rmur oo4olenio3ils m2ea( s;t0aexnxf3totoate uvi;s)sruoio3no1omt lfeiat)srum(mono1opxniocildfm umumont4 ltrif tatlmtr nvils0sruo(m3io4ll emfciatfaDtax o;u0opxn o3iytfs2rmnmsn(0 exomo ty1omtr u s;s)srurim3ou4olenmfetasfsruaxrpnu0tlto octatfm ea(mo;u0 lxrxf3iatfaDr ueo s  2xrio3nodal  livs ()s2uaxmp;t0alxniicils a2umnvs;t)trtrircoydfpDraueol(0 rto(mpiy4lptelneilt)srta(ronu4oex mfeiasfsDumuvo t4altoxocoadomD ln s;s0 rtm(mpoydol e fvt tfa2tmxro;t0apxo i3iadla2el(vs;u0 etrmocoy1fm elu il(0s2tm(opnu1amtelivt s)s2rmxmo;u1tpx  ocilsls ra(ms;t4alerirctatlptr ueil(0sruoxm3oo4apeemfvilt sruaxm no4tpe if3tldlsDul(mo ()trxnir iy1lpD aies;s0s2urio3iydomte nct t)a2uaxmo;t0oex  fetydfm rln s;(4artoif iy1la e ueo (0t2uo(m3oydom  liesas aDtax p;o4oetn ieiasfaDra( o;(0 lenxf ty1faDraneo s)t2xr(mpiydaleelfeilt  ruaxro;o0tex  octyslsDemn s;u0 etomfcoytoptran o;t srurxr3io4am n fvtlt s2uaxrpoo4apx  oeiatlmDua(ms t4aeeomf oatomt  uvs t) etoxo nydll elnei (  Duru  nt4tlto fetatfmDrlumon(4arerio3iodomtrau s;s)t2uoxo3io1amtnlnct t  rta(mpnu1ope iieiys aDumnmp (0aeenmo3tydfm e iei (0 exm(r iudome lncs s) Dumum ;o1aeen oeias a2em(ms;(0aetrmf ty1fmDraueols0trxo(o nydlptemieta(fsrra( poo0tltn ieias aDuln p;t)arxoxr oytlpte ivi;t0texmxo oudopeemfes t)arumxm ;t1tpx  o3iysfsDea(ms u0alxnir3oatomDrlu s ( setrxmpoodllen iei t) rurumpnt1oltoif3tld a2elnvpn(0texoifcta1oatrli s;t texrxm3oudopenmfviatfarum(monu0oleniictyslm2uluvsnt)alxnircia1faDeluesl( tetm(o3ny4lle mfes sfaruauroou1tpxoii3tys mDulnvs u4trtoxf ootom elnvsl() rtrxmpoy4ap nlici (faDtaxm ;u0aleniociat a ulu o;u0trtnmo3oytlp rluvo s0 euoxrpoy4lme lnet t) Durxmp;u0tpxn f3iys s ul(vp (0aetrxr iotlmDrlies t)t2xoxr3nydal n ivtl(f 2tr(  nu1alx  i3iltfsDrlnvo (0altnmo3todoa r uesls0t2urim no1al  licsl()a2umu ont0teen o3iltls2eaumpnt) ltnxf3oadfate i i () 2ur(opiu1ole lncsasf Dtmx  nt0tlenmieiad a ranvo u0tetrxocoadfat aivo;(0seto(r ny1lp  lnvi ( aDumu onu0olenmfetatls uluvsn() lxoxr3io1fm r iei;t) exm(r iy1llen ncsas  Draxmp;o0opt mf3tadlsDelnvs;t0 rtomf3ia1oaD  n i;(0trxm(opiy4lmenlictls  rrrurpno1apeo feiyslaDean snt)teenmfcoa1lpte nesl()srumir3iy4lpeelicsltfs2tru pno4optomoctasfaDelump;t)aeenxr ia1omtrlues t)tetmir oy4ap nlneils)aDua(ro;u0texnmo3tadlmDulumsn()altnif3oytoaD  i ilt)t2uoxo iu4lleelnvils  rrr(m nu4tltoiociltfsDeanvp u4aeeoifcty1fmDelivilt t2xr(r3oo1lleemnct ( srur( p;t0tlenmociat sDrmnvp t)aetriocta1lm eaues () etoxo oy1oleemfvta()a2raur oo1openmfeiyslm2ea(ms (4arxnmoctadfptelu i s) 2tmim3iudll e fesltfsDrm( pno1aet  fcild mDua( o;t)trtoir todoaD  ues ()setoxmpoo1lptemncsasfsDtru  nu1apeomfeiys s um(vp;(4alxnxr3oytlaDrlies;s texo(o3iy4llt mfvsas  2trxrp;t4altoio3iadfs2ulnvsnt) exomr oy1opD lu s t tetmxo ny4ome  ictas) rra(rpnt4opxoio3ildlaDuluvsn()aetrxfcta1latelnvol(0 2uoxopny4olenlfeta() ruaumooo1tlt iocild a uan p;(4arermfcoa1opDr uei t sruo(mpnu1lp   icslt  Dtaum ;o1oexo f3iys s2ul( o;(4 leoxf3ia1fp raneo;t) exr(o3nodop elies t sDua( poo4olenmietlsla elumo t4aexrxfctytfpDeai o;s)setrxo no1aleeliesa()a2ururono0olen f3tlt a rlnms (4texoif3ootfptrauvs;s0 etoxrpoy4ll nmivsls srrrxront1aetoiociadla eln o t0artnir iy1lm elivols0sexm(rpiu1ll nmnvtl( aruau o;t4apx iieiltfs rau o t4aleomocoo1om rlneo;( srtmir3oodale mnvilt aDrmx pnt1aeenmf3iad sDeanvs u0 ltnmr tydfm elieols)truo(m nu1amtemfcs s)a2tm(rpnu4ape moctltfm2rmnvs;u0 lenio ootla   ueo;t0 exrxopiydolt lnes t aruaumooo4texniiciysla2rlums;u)areomrciatfa r n il( s2toim3oy4lmt  nct t) rtmump;u0opx  oeiyd m uanvs u4 exomf oy1fmD li s s) rto(m3nu4oltn iesas srumx o;o0oexo i3tydfm2eauvp;()aleoifcoodlm e ueo;t  rxr(o oodlle  ivi (farumurpnt4tleo feiasla2ua( p t0 etnmfctatlp e u i;( t2trxopnudamt mnvilt a2umum ;t0tltnioetasfs2ea(mon(0aexrmr iatfpt lnes;()s2xmxopiodaltelneiltfaDrrxmp;o4tpt  feiasfs em(msnu4tlxoxo3iatlm  anvi t0 2xo(o3iy1alte ncta( sDrrxr ou0opeomf3iydfs2rl( pnt0aexoirctadlpteai sl(0texoxo oy4opte icsa()aDur(rono4tltomictlsfs eluvp;(0 reomfcta1fpDrlnvolt0trxrxm3nu4lmeemietltf 2ra(rpoo4tlx ifcils m2el(vs;u) eenmo3tadlp eai s;()t2xmio3iudal  mfcs ()a2ur(rp;o4aptnifcils s2um(vpn(4teermrctydfpD au s t) rumir3iy1lme lncs s srurxmpoo4texoifciytfaDum(vo (0 rxnxf iodlmtrlivi s) 2trxopno1lle  nvi () 2tau  oo0olt ifctldlm em(mpnt)trtoiocty1lmDe i ilt) exr(o3nodlpenlnvslt)sDurumpoo0oltnifetydfsDemuvp;t4 exnxo ta1lpteai i;()tetrirpiy4al n nvils)aDtaxm no0tpe moctytls ea(vsn(0trtoio iydoaDeln sl(  exoirpno1lmen neiasf 2trum ;u1oexn oetadfm rmnvp;t0artoifcoydlmtraivi s t2xmio3no1ol emivt (farta(r ;o1texn ictysfm2umnvpnt0artomr3oa1oa rln o;t)seuoxrpnydam nmfci t) rurx p;t4tpeniictyslaDum(vp;u) etnxr todfpDrlu o s) 2to(opoydalte fcils a2tax pnt0oexniociytfaDrauvo (0altrxocoadlm   neslt)sexrxm3ou1ol e fvi ( s2urumpot4aee mi3iadlmDrau s;t4alenif3ia1lp eau il()t2uoxo3oo1lmt lnetltfarrmu onu1olxomiciys sDrlu p;(0trerio3oo1lmtr n s;s) exriopnudlpenlivsl()s2uaur ot1oex mfctydfs2elnvp t0teenio3iotla eaivo t0 rxmxo3io4lm  mict tf 2rax  nu0opeo ietyslm2um(vs;t0 reoxf tadoaDeaivilt) 2xmxm3nodoleelfcsa( s2tm(r ot4apt ifetasfaDem(mpn(0areriociodlptelneo;()trxoirpoodlme  ivi ()artm(mpnt4olxnif3tyd sDrluvs;(4trxomr3oodfmte ieo;t)srur(mpoodlptnmietl()a2rmu  ;t4oltoioeilt m ea( p (0aeenmr tytfptraieo ( texrim3io1amenlneia() 2uaxmonu1tlx ifcild s2ua(vonu0texnmr3iatlaDr n i;s)teuoir no1am emnvtas)s2urum ou4aleo f3tls s2ra(mont4trtnio tydfptelneils  rtmio iu1ope liei s)srtm(rpnt1apeomociyt sDemumsn(4aeerxo3ootfateli i t)s2xr(r nydlp elnct tf 2tru pot1apeo i3ias s2rlnmonu4trerxo3oo1om e nvi (  eurim ou1ope lfesltfsDuaumpoo1aexn feias m2uan s t4trxrxociatlm rlu sl()teuo(m oy4lmen ncs tf 2tmxmo;u1aleo o3iatfmDranmo t)aetomfciotlmt an i (0 eur(opou4llt lncsls)artr(m ;t0tpeomfeiyslaDum(mp;u0 rtnxr3iy1lmte u ol(0srtrxm3ou4omtnlfcs t  rtr(mp;u1tex ii3ilt a uaump;u0trtnmo3oatomteau i;s  etoir iu4ol elfvi (fa2tmx  no1texnmiciytlm2ulu o;u4aleoircoydfpD ai s;()setmxmpiu4lmen iciasfsrum(ro;t4openifetat a rm( pnt4 rermo3to1oaDr ieil()tetrirpny4amtemfei ( aDtmxmpot4tpe io3ilt aDeau snt)tlxrifcoadop e uei;s) 2xm(o3oodlpen ics sfaDraumo;u0tlto icilsfs rluvp u4tlenif3iytlm e i o (0 etrio ou1am n ivsat  rraxm ot1aex io3iadfs em(mpn() lxoxr to1fat  ues;t s2xoxmpoudapeelicilt  2urxrono0ole ii3iyslm ra(von()aeeoxfcoy1fp  anes;t0 2ur(r oo1omtemietas sDum( pnt4oexoifetysla eau o;()texniociotlatraueslt0 etrimpiu1lleelivsa()aDtmxmo;u4optoioctydls rlums;(0artrmocia1faDrauvo;s)t2uoim nydole mfci tf 2rmx pnu0alxoifciadla rmnvs;u)trxnio tydfatrluvo ( srtmxo iy4ap nmnct s  2umumoou0tpxo f3iasla em(mp;t) rtoxfcoo1fa e nvs;( seumim3oydap nmfciltfsDrax oou4tpto fetysfsDemums;u0alxoxocio1fm r u il(0sexriopno4lpeemncsltfs2rr( onu0tet  ocildls uanmpnu4 exrxo3iytopDrluvs t)trxoir3oodllt mncs ()artaxrpot1altoioetad m ranvo u4trerxr3oy1fa elu o;s0 exmxrpnu1apenlfcsls sDuaump;t0tlenmfciatlmDuln sn(4tltnif tydfpt  i slt trtrim3iu4ol nmietat sDur(rp;o0oetn oeild a2ra( s;u4trermrcoa1op raieol() rumxo iy4amenmivil()srtaum oo4alxomi3iyt a2rmumo u4trtomr ty1fmteai s;t seuoxm iodapeemfctas) Dtm(mpnt4opxn oetatlaDuaums;(0trxnxrciatfpDr ueols) 2xr(m nodope  ictl(farua(  ou4tpx iietas s um( o;(4teerxr3tadlptranvilt)sexoio3oodap nmfvs (  rur( o;o4tet ifciysls emnvs;u)tlenmo tytom r ies;s0s2toxm iydlpte iet s) 2uau p;o0optnmf3iydla ean sn(0treomf3iodfmteli s s seur(m nydam emfvil() 2rmxmp;t0oeeomoetltlm emnmpnt)trxrif3oa1op eliei;s  rur(mpnydlp   fvtat aDtaxrpou4tex mfeiltfs emn s t0tetnmfcoadfat lies;s0t2xoxm oo4ap e net t)a2uaxr ot0tle iieiad m2ulump u4 etnxr3oodfaDelu i;(0 2xm(r ou4lme lfviat s2umx onu4tpeo ociadfs um(vo t4teeoifcoa1faDe nvs ()s2toxrpio1olee ncsas aruaumo;o1opxnifciatls emnms;(4altnmocio1fpDeaneol() 2urxr3oy1llt lfvtl(  Dta(rpnt0tpxnmoeiatls eaumo u)aetnmociatlmtranvo t0 eurxm iodlmen ivias aDrmurpou1tpx iieiydlmDem(mpnt0 exoxf ia1lpDeau s s  ruo(r3ny1alen nes t)aDtm(m nu0oet mociad s2rl( p;t)tlenmo iotoptrlueo ( teto(opiydopen fcsa()sDuaurp;u0altnifeiydfsDuln p u4alxnxr iy1omt  u sl() 2xoio3nu4aptn ieils aDtmurpoo4optnmfciltfa2ulnmo u4 ltoxo iydfm eau i;t0 rumio3iydapenmncias) rua(mpnt0oeenmfciadfm2rmump;t4arenmrctytla   ies () rxoxo3nodopeelicslsf 2ur(rpoo4aex mieiydfs elnmo;u4trtoir iodoa   i o;t  eurxm iu1llt  nvilt) rua(  ;u4aexoifciydfmDemnvp t) exrmr tydoptr u o s  rxm(r3iy4lpee icias)a2rrx pot0oex  f3tas aDrm( o t0 eeomr3oadoptelnvs;t0 rtmir nydoleemici ()s2um(mo;u4tlxnmo3iad s2rm(vp;t) renmr oytlmDrluvo ()trxr(m oydam elnvsl(f Dtm(r ;t0oet moctydfaDua(mo;(4trtnif totla r uesls0setmiopiu1lltn fetat)artr(rpnt4aet mo3ilsfaDuan s;t) rxoxr ia1faDran o;(  eurxr3iy1lmeemfeil( s2umx p;t1openifeiltfsDul(vsnu4tlermf oatfmD  n o (  rxo(mpiudopt  iesa()a2raurooo4oetoif3tatfmDra( s;t4tetnxf3iytfm   uvs t  euo(mpnudam nlfcta()a2trurpou4texniociytlsDum(monu0 etrxf todomD  n i;t0trtoir3oy1amt lfcsl(faruru oou4alt  fciatfm eauvon(4tetoxr3iytlaDe nvols0 rxm(r oodlpt lieias  2tmurpoo0oetn f3iltlmDemn snt4artoif3oytlaDeauvo t)trurir no4omtelnci sfs2urxr oo0apxnio3iltla ulumpn(4trxrmo3iodfm elivi ( srtr(o3oo1omenmietat)sDur(mp;u4oeenmfeiysls2uaumo;t4treomoctotlp eauvi ()sexmxo nydapt  nvil(fsDum(r ;u4tpx mietyd sDrlu s;(0 ltoio3oadla  anvsls)srtr(m iodlmee fvtatfarra(rpou0opt mo3iys sDranvs;t0altoif io1lp r n sl(0tetmxrpnydlmtelfvtatf 2tmu p;u1aeenmietat a2umnmo;()tetniocto1laDrluei (0t2umir iydll elfvs s)artrumooo1tpenmi3ilsfm um( p t)aetrif tytlmD  i i;s0trxmimpoudlltnlnctlt  2trumoou4alxniictyd s rlums t)artrxf3iodoa e ueo;t  rtoxo no4lmenmfvia(faDtaump;u1ope  ieilslsDuau s;u0 ltnif3ia1fa eln il()seum(m oudlpeelnvtl(  2umxroot0ape  ociaslm uln o t)arxnxfcoadfpD an s;(  2umim3oodam e neiltf Dta(rpno4oexoifeiadfaDelums t0aeeomr3oydoa  ln i t)texmxo oudap  miesl(fsDumxr ot1apen i3ias mDeaums;t4tlermo iadlmt au s s)setrimpny4lpt  ncslsfa2trxmonu0ole ii3tlsfs el(mp t0 rxrmfcia1la r i ilt)trxoio oy1ol elietatf Dtrxronu1tltnmf3iadfm rmnmo;u4arxoxrcty1lm  luvi t0 2tr(mpou4lp  mneil(f Dtmx oot1oeeoiicilslmDeluvs;u4texoif3oydlm  ai o ()t2tr(rpiy1ame  ieilsfa2um(ro;o4ape  o3iydlsDum(mp (0altnir oo1fpt livs s)s2uoxo3iy4oltelfeia()aDum( pno0tleo ieils m rau o;u0texomf oatop rau ilt srum(opio4ll nlnvias  rrmu p;t0tptn ieiydls2rm( onu)tlxoir todomtelnvo s) rtr(r oodll nmnciltf 2raxronu4oetomo3ild mDuaump;t) leoxoctadom  aivo t0t2umxopoy4lltnlnvtl(fsrum(mp;o1aet if3iytfm umn o u0aeermf3oatfpDr nvilt texr(rpoudope  fviat) Duax pnu4tlxo f3tydfm2em(vs t4tetrmr iatfaDean o (  exr(rpiu4lp nlfcs (f Dtaxroot1olxo oeiat sDuluvont) rerio3oa1fptrlu sls0 exoir iu1olt  neil( artr(ro;t4alt  ociys a em(ms;u0 leoxo3ty1fmD au i;()s2toio3oudlptnmnctlt artr(ronu1teeo ieilsls2umnmo;t4aeenir iy1fmDr u sls trur(m iu1lp e nvsasfaDtr(  ot4apxniieilslaDum(mo;t0altrif iytlpteaiesl(0 rxm(m3oo4am emivt s srraumo;u1apxnmfciys aDra(mpn(0 eerifcoatoptr ueilt trurirpny4alt  ivia(fsrum(ro;t0texoif3tytfa2uau p;(0trerif3todopDr uvs;t0s2um(r oydol   nes (  2ur(r ;o0tltnmocildls2uln on(0alenmo3oodfaDrai ols) 2tr(opny1opt mfcia()a2tmum nt4olx mociys s uauvpnt4trxoio ootfpDrluvs;t  exoio3nodaleemiesat)aDumxro;o1ope  fctad s2rlums;()aexrir tadfm e iesls)s2xm(r3nydap n ict (fsDrrxr ou1aexo ictytfs elnmsnt)aetoircta1oa e ueil( teuo(mpnudap nmics s srrmxmp;t0opto i3tadlm2ulumo u0altnmo3iodfmtr neslt0seuoimpio4lpe miesa( aruru p;u4opxn feilslsDem( s (0aetnio3tytlm elnvi;(  exmxrpou4op nlfcilsfarurx ono4alenmociysls2rlump;t) rtnxr oy1lmtraivsl( trxo(opoydop e ncs sf rraxm ;u1opto f3tytfa emnvo;t0aexrifctatlmDe ueo (0s2tmio ny1lme mncsl(fsrururono1tleo i3iyslaDumn p;u0aleoifcoa1opteanes t0t2uo(m3oudop   feta() rua( o;o0texnmictldls2umuvonu0altnmf3to1op  anes t sexoxo io1al emnvt (f rrm(mpou0openmoeiydfmDeanvp;u)teeomo oatomtrlnes;( t2tr(mpnodopen fcsatfs2rax o;u4apx miciat mDua(mo;(4arenxfciatomDelues t)s2xr(opnu4om elnetls arraurpou4tpxniietatfaDum( pnu4treoxf oadom raneo (  2xm(rpiu1omeelfvsat sDta(rp;o1aexnii3tlsla2elnms;t) renmr oy1oateaivo t)srtmxm3oodlptn neilsfsDur(mont0tlen ictldlaDumuvs (4alxrmo tytfmD livs;(  rtmxm ou4ap n icsls sDtm( p;u4oeenii3tatfs rm(mp;u0 etnxr ta1lmtrau s;(0 2xrxopiu4optn neias)a2ur(r ou4alx ioeiyd aDra( onu0arxnmr iotlmDr u i;t) eumxr3oy1ll   netat)arrax onu4apenio3tldls2ra(mp;(0trtrircoadla rauei s0srto(o oodalen fvtat a2trurpnu1tlxnifciltla rmn p;t) reoxf3ta1fpD auvi;t0 2uo(r3nodlleelfes ()sDurxmoot0apxn feiaslaDeaums;(0 rtnmfcta1lmtrluei s0srtmxr3iy1ll   iesltf 2ra(m ot0apto ociytfa2uanvo;() etnxf3tytfaD anei s srxrxm3oy4ameemfvtlt  Drmur ;u0opeomfctas a elums;() leoxf oy1faDrau i;(  etmxo3ou4lmenmivsltfa2urxm oo4apeo iciytfa2ulnmpn()trxomo3iatfp e u s s) eum(r iudlmee neslsf 2raxr ot1aeeo i3iysfs ua( sn()tltnmf3ootlp eaueo t trurxmpiu1lltemfvta()artr( onu1ope ioetls aDum(mp;(0texrmfctadfmDraivilt)trxr(mpnodllee neia()srua(m ;u4tex mieiyd s2rlums t4teeoio oo1omD lnvslt seuo(opnodamtelictlsf rrrx  oo1olx  ocild s2eauvo;t0texnxo3iadoptrlu ols0seumio3ou1opte ietlt srururpou4tlxoioctld a2rmn s (4tlerxr tadfaDrluvo s trum(opio1op  mivsa( a2urxmp;u1opt ifeiatfa eanvpn()alermfcoadfm   i il(0sexoxr3nu1al nmnesltfarrmx o;u4tee iicildla rlnvs u4altnif iatomtrluvo;t  rxr(mpnodoleemnviltfsrumxrono4ope ioctltlmDum(mo;t0tlxrxf3iodomD aueilt0 rumio3oo4amt mietlsfsrtau oot4aexn feiadfs ea( pnt)texnmf oydom  an s;( setriopiy4lm   ivs t  rrmurpnu1ale if3ildfa rluvo u) reomociotoa e u s t)tetr(o3ny1olte nes sf 2rm(r ou0teeo iciaslm2uln s ()aexrxr3ty1lp elnei s0 2trio3nodaltelivslsf Drm(  ;t0tetnmiciatls umuvs;(4altnxoctotfmte nvs;t)sruoiopoydomenmici tf Dua(r ou0olt  f3iltfaDuanmo (0 leoxf3oodoatrli sls)sexm(m3iudlp e fctltfa2tm(rp;u4oeenmi3iys m2uanvo ()aetrxr iytoaDrln s s)trxo(o3nydom emfcsls aDtmur ;t1opeomoctysfs ul(vp;(4trxomr3oy1opDrai olt)s2uo(rpiy4lp e ics sfarrrxmp;t1opxomoeildfs ra(vs;(4 rxoxrcoydlaDe uvo;()trxrio3iy1ame  fvias artaumpnu0tpxo o3iat sDuan sn(4aeenmo3tatlptrli ils t2to(r iy4oltnmics s) 2umxm nt0alen ocildlm2uau snu4 rtrxrcta1fa ran i t t2urir3oy4al  mnetlt)artmxr ;o1aetnmociasls2emuvo;u) reomfciadoa elivi t) exmio oodlm e iet t sDurur ;t4tpto o3tyslaDeluvs t4 eerir ty1lpD au o;( s2umim3iu1lp n ivils)srrrxm ;u4tex  oeilsfaDraumpnu) ltnio3oo1oat lneo s t2xm(o3oo1llt  nctat) 2tmx o;o4aet io3tyd aDem( pnt0 etoif3ia1fatrlnvs ( texo(r3nudal nlnvia(f 2rrxm ou4tltoifcild a2emu o;(0texomr3iadopt livil(0s2ur(o ny4amt liesat a2ur(m ;t0openioeiyd s um( s;u4 eerxrcoa1omteluei s sexoxr no4lmtn neiasfa2ur(mo;t1tex ifciad s2umnvs;(0 etrxo tytfp r nei;s) 2xoxopiudamt  ietl(  rtax o;t1teen oeiatfaDrl(mo (0 rtnxo oo1fm raieo;s setoxmpou4ol  livsatf 2rau  ot4apeomi3tytfm2eauvon(4altnmfcoy1omtr n o;s)t2xm(r nydomt mivilsfsDtru o;o4apx ioeiysfs2ul( ont0aleomo iatfaDrlnvs;s  euo(m3oudlmenlfciat aDraur ;o1tpx mieiytfmDeau sn(0trxrmrcoa1fmD an ilt teto(r nu4lme  ieilsfsrtmx  nu0tex io3iytfs el(vs (0 ltrmr oodfmtrlu i;s)teur(mpoodopenlivi s)a2ta(  ;o0oltoiieiltls rl( p ()trxnif3io1laDrli il(  exoio iudame liesl() rrau  ;o0opeo o3tlslsDulnmont0tlenxf3oadlaDr u s;s texm(r3ou4omen fvi () Draum ;t0altnii3ilsfs2ranmsn(0trxrmr3to1lmtr nvs;( s2xm(opiu4aptemfetl( srtm(ro;u4aet iiciysfmDum(ms;t4tetrircio1la  aivsl( texrxo3ny1optn ncsas) Dtmu pnu4alxoif3ilsls eanvs u0 eenxo tytlmD  nvols0 etr(rpiu4am n fvi s  rrmx  oo1aet if3iltfm el( o u0 exomo3todlmtrlnesls0trto(rpoydll nlics t)srumxmpot1oexnifcild m2um( s (0tlxrmocoo1fate uvs;s0srxmir3iy4op  livsa()s2tau pot1aptn ietadfm ranvsn(4tlermoctadopD lu i;( srur(rpoudopt  fei ()a2tmu pnt4olen fctydlm2ra(vs (4trxoif3iytomDrluei;s0s2toim3iy1lpen iciat)sDrmum no1opt miciyt a2umn o t0 lxrif3iatfm  livol(0 2tmxrpny4ll n net s  Dua(rono0tpxomfciyslsDrlnmonu4 eenxfciydlaDr ueol( setoim3nudapt lnvtlt)a2raxr no0olxomietatla2el( o;()artnxr3io1oa rlnvs;t)sexr(mpnodop nliesl(f 2um(rpnt4altomi3tadls2ea(mp t0tetrxo3to1om  an o;t)trxrir ou4lp e icia( aDrr(r nt1alenmfeiadla el( s u4 rermf3oatlmt lieils sexr(o3io4ameemnvs t)aDuax o;o4altoif3tytfs2um(ms;u0tlxoioctadfpDrlnesls srurxr oudlltnliviat a2tauro;t1oltnii3tydla ulumont)altnir3totom  lueol(  eum(m3iodape mnvt ()arumu pnt0tptnii3tadls eanmpn(0trerifcootomDelu i;()t2umxo3oydaptnmiei (fsruau pno1ape  ietytfsDemumpn(4tlerxo3iodopt anvil( t2xoxm ny1omenmfvsasfaDtru  no1tlx  feils sDrln o t0 lerio3oydlp   i ilt0t2xoxm3ou1lptelnet sfaDtau onu0alx moeildfm uln s u0tlenio3iatomtr n o (0 exrio3iydom elivi tfa2uaurono0oexo i3iysfm2rm(vs () renio oy1fa e ueils)trtoirpoudlme lneslt) 2rmu o;u4ale iictatlm el( snt4 rxoiocoytoaDeauei s  ruoxopoydlpee ietas)aDuru pnu1alenif3iltfmDrlumo;t0 rtnxociodfpDeluvo t0s2tmio3nydllte ictlt)a2rmx poo4ope  ieiadfmDel(vont4 lxoifcoydoatrln ols)trtrxo ny4opte fcsl()srum(m oo1apxnifeiatla eluvs;t0aeerxr iotomt aneols truoir3oo1olt  fei ()sDumxr ;u4aptomf3tat a2umn s () rxoxo3ty1oatr i i (0srxr(o nodlmt livslt)sDrru  nu0tpxniictadlm2ranmo u0aetnxfctotlmD  ivo (  etmxo3nu4lltn fci s sDta(mpoo4tlx  fctltla2umnvpnt4trxrio ty1omDr ieolt)t2umir3iu1lpee fct (fsrumuront0olxo octyt s uanvs t)tlxoiocty1lmtraivo ()seuoxo iy1open ieslt)sDuax pno4apeoifciatlsDumn p;u0aleomo oytla ean sl() rxr(m no1am n fcsa(faDua(rpot4texnmf3iad a ranmont4artnmo3tatla rli o;s0tetoirpiodopt mfeia()a2ur(rp;u4aptoioetldls2emnvs u4tltrmr oy1fp  liei;s t2xmxo iu4amenlfvias  rrau  no1opxnmo3ildlm2eaump t4alxomo3iytopt auvsl(0tetrim3nudlm  lnvta(fs2rmxm ;u1tlxo feiadlmDemnmp;(4 etoif oydoa  aivsls)texo(o iodom e icsls) 2um(r nt0tlxoifcildfa2umn s;u4tlxrxf3iadfat aues;t  rtm(r3ou4aleelivt tfarrmumpoo4oex  o3iat aDua(vs;u) rtomf iatop eaiei;s)seto(r iu1apeemnesl(  Dum(m ;o1altoiietat a2eanmp;(0 lxrxrcty1fpt  uei s s2xm(opiodamt  nvtls) rua(m no0ape micildfm raump (0tlermfcoodoa rai ols)srtriopiu4oleelfcsa(f rtax ooo1ale  ieiadfaDrauvo;t4 exnxr3ta1opteanvslt tetrir3iodlmeelnvt t s2rm(r ;t1aexomieiatfsDua( ont0arxoxf ia1opteaiei;()texmxopoy4amtn fvtat  Dum(  ou4oex iieilsla2rmu p ()alermr tytfaDean o;t s2tr(rpnydop elies ( aDumu  oo4teeomfctltfa eluvpnu) ltoir3ootlatelivils s2tr(m oo4lpt mivi tf ruax  no4tee  fcildfm2ean on(4texoxr3ootoptelieo;t)t2um(r no4omtemneta(fsDumx oot4oltnmfciytfaDumuvont0teenmf3oatlpDrai o;s) 2xrxmpiydomtn fetltfarrrxmono1aeto fctytfsDemn p;t0 rtrmrctadfat ln i;s texr(m3io4omtemnct ( aDrmx onu0tleoifciadfs2rlnms;t) rtrxfciydfmDraieolt)teto(m no4ap nliviatfs2ta(ro;o0tee iictadfm el(vs;t)tltoio oo1fmt au slt sruoxm iudlpt mnes (fsrumx p;t4apeomocilsfmDumu p t0 rtnmo3oodfaD an o () exrir3io1al  lici s)sDumuront1tpeomi3iatls em(mp ()aexrir3iytfaD lieo s) 2urio3iudllt lncia(f 2trur ot1opxomi3tadlm2ua(vp;(0alxrxr3oatfa   nvi;t0setoio oy1am  mfct tfsrtr( pot1optn ieiasfs2emn s (0tltrxociodlaD an ol( t2to(o3no4optn iciatfs2um(ro;o1oetoiociyslaDrmuvpnu4 etomo3ta1fm  livs;t) etr(mpno1optnlnes s)s2rmurpoo4tpeniietltfs2umn o;t0 lxrmrcia1fpt  ieil(0 2xrxr io4amtnlncsltfs2rru  ot0aexniiciasfaDumnvsnu0teeoxo todla rai ol() rum(rpnu1lmtnlictls)srtaumo;o1optniociasfmDul( pnt4 ltoio ia1fpDr nvs;t tetmxmpny4optnlfctas)sDrrumo;u1tlt  oeiydla2ulums;t4altnxr3oatlmDranvs;t) rxmxo nu4lm n nei (f 2rr(rp;t1aet iiciyt aDrl(vonu) renir iytlmD aieo;t0 euo(r3nydop nmieiasf Dtaxm no1tptnif3iad mDrm( p (0tetoiocta1oa rluvilt)srxmim oy4ame  ivias sDum(root0tptnmfeiltlm2ranmo;(0 lenxfcto1fm r u o s sexrirpny1apenmfcta()sDur(m nt0teeoiiciltlaDua( on()tetrxrciatfptrlieol(  ruo(opny4opt lfeiasf 2uau  nu1tlt mieiad m2rm(vo;t0arxrxo3oodlpt  n s;t) eurxo oo1al n ict s) rum(ront4oee  o3iysfsDra(vp;u0aeerif iadfp raiesl()t2tm(r3no4ameelncsls  rrmuro;t0tpeomietlsfa ua(ms (4aetnmr3oadlpDraieo ()s2tm(m ou1ole mfvtat  rtr(  ;t1texomfetatls rln on()alxoir3oydla  aneil( trxoirpou1lpt lnvi t)arrrur nu1aexnmi3iyd m2rluvs;t) ltrir3iodoptrlnvols  2tmim nydamt  netas  rrru  ou0oetnmoctlt a uan p (4aexomr oadopteai il()s2xm(o nu4al emicias s2tmumpoo4opxnifeiad s eluvsnt)aexomo iydop eau o t0s2tmiopnydaptnlfvils s2rmu  ou1alenmfciyd sDrl(ms t0tlermf iotoatelnvs t0 etrxr iy1olenlivilt  Dumu  ;u1tpen oeildls2uanvsnt0alxoifcoa1fp eaneilt) eur(m3ou4lmtn nvsa() 2tmu oou1oexo octytla rau p;t)tetrxrciodoa eln s t)t2xmir oudame  ictatfsrumxm nu4tetomfetatfaDrm( pnu4 renmfcta1lm e ueo t)t2toxrpiu4ole mncilsf Dra(rp;t1oeeoifetasls2umnvp;u4 leomo3iydom ran ilt)trurxm iudop nmnvtasfaDur( ont1aeto oeiydlm uau ont4trtnmo tytlp e uvolt s2um(rpiy4am  licsl(f 2ta(mpot0tex iictasla2rl(msnt0areomo3oy1om  aueo;t0texoirpio4op  micsas) 2rmxr ot0tlxniiciasls2eanvpnt0 etnxf3tydomtr u s s)sexm(r3oydamt mncsl(fa2ra(mpno1ole ifcildfm rau p;(0trxrmf oytfmD  nes;s0s2toimpiy4ameemfvtlsfaDua( onu1ale mocilsfsDra( pnt4 eeoiocty1lptranei;s0srxmiopou1oleemics (farrmxrpoo4tle  fetlt mDelnmo;u4 leoxr3ia1lmD livols sexoxopiu1op   fvias)sDtmxr nt1oexnmf3iysfm rl(mpnu)aetomr3tadlmDr uvi;(0 rum(opiy1alee fvs s)srrrum nu4aee  ociydfm el(vo ()arxrxf tadopteluvs t trxrim3oy4ll nmiet (f rum(ro;t4oeeo iciyt s2rln s;t)alxnmr iotlmDe nvs;t  rtoxopoudlpt  fesatfaruaxmooo0opxomiciytlmDul( s;u4aleomo todopteanesl()teumir iudlp nmnvtlt)srraump;u0alxniictatla2uanmo;t4tlxoifciydfpDeau i ( s2xo(m3nudopeemncilsfa2tmumono1aetomieiadfa2ulumo u4arxrmocty1latr nvo s s2uriopoy1oleelnctlsf 2ra(ront1tet  ieiadlmDumumonu4tltnmf3oadoaDr ues s srtoxo3oodal nmfetlsf rtruront0tlxnioctad m2rlums;u)tlxoxf iatlateai ols)s2xoxr3iudlmtelfct (  ruau o;u1altnmoctysfs rlnvs ()trxnif3iodom r nvo s0tetoxo3oydom   ieias)a2tmurp;u0ope  fcilsfs2eanvp;(0arermocoy1fpD  ueo s0 2tmxm3no1omtnmncil(  rtmurp;t1tltnmfctad m emumsnt4tlenifcoodfate n il(0 rurxopnu1llte nei tfsDurumpno4aee mi3ias m rlump () etoif tatom   nvi (  euoxo3nu1om   fci s arum(r no4apxoii3ils m elnmo (4aetnir3iotlate ies s0 rurirpoydlmte ietatfs2urxrp;t1opt  fctas a um(vp;(4artomrciodoa elneilt seuoim3oy1am nmfvt (fsDta( pou4oexnmf3tytfa2uau p u)tltrmr oytlmDe ueilt  2ur(mpiydap nmnei (  rraxm oo1alx  ietad m rl(vs u0 rxoxf iodlm rlu s;t)s2toir3oodop emfes (fsrra(m nt4aexo fetls m2eluvon(4 leniocoy1om rau i;()t2xoxr3iudlltnlnvi s) Dumxro;o4tpxoifetas sDrmu p;t0teeniociodoat  n o;t srxo(m iudole  neia()arrmu ono0aeenioeilsls ran on(0 lxnio3ootlmt  nvo () etmxm3ou1llenmiet tfsDtmxronu1olto feiasfsDeauvo;u) exnxfcoy1fa elnvi;t0 2xrir io1lp nmnvtat)a2tmxr no4oetomiciysls2umnmp t4trtnxfcia1fmDelueilt setrio oy1llt mnesatfartru  oo4apx ioctas m umn o;(4arxrxf3ootom  li o s s2trxm iy1lptnmivslsfarum(  ou1tpenmfetat m2umuvs;(0 rxnifciatlm eauvo;s srxm(r3oo1ap   fvi tfa2urxrp;o1aee  feiysls rl( p t0trxomo3totopD lnei () 2to(m3ny4amtn feias  Dua(mont0aee moeiytfaDrmumpn(4aetrircoo1faDrai ol(0seurirpno4optemicslsf 2taurp;u1tlx mi3iyt mDrauvs t)tetrxocoy1fmD  nvil( trxoio3iy4al  mfcsl()arum( pno1optoifciatfs2eanms;u0 rtrxo3oadlatelu o;(0 2umim oy4optelnvi t)sDtmumpno0tlxoii3tls sDumn pnu0alxnxrciytfmDelivs;t0texrim3iodamenlivsasfaDta(  ot1alxnmfct
\ No newline at end of file
@@ -0,0 +1 @@
+i s;t)sruoim3nudolt mneilt)arrm(rpot1ope mictltla rm( ont0 rtoifcio1fmtrlnes t)s2umxr oy1lptemivil()srrr(  ;t0tetn f3tyd s2um(mo;t0 lxrio oodoatraies;t0 rurxr no4ameemfvi sf Drmxmpno4aleoiociad aDuauvsn(0texrir3iotlpDe ivi;t)s2tr(rpnudape  ivs s)a2urumpno4aexnmoeiyt aDea(mp;() etrxr iodfm   i i;s s2xrim nydll n nctasfsrrmxr nu1altnmfctadfa2rmnmp;u4 exoxf3iytom  aiei (0setm(m iydaptemict sfs2trur ot4oeto feiltfa rmumsn(4 rxrmocoadfmtr nvsl(0setoim iy4lpe mfvi (  ruau  ot0tet mo3iys sDel(vpnu4trenxr tadlm   ues;t)texmio3nu4am  mfvsas) Dta(m ou1tptn f3iasls2umnvo t) leoxocoa1lmt aues t)setoimpiydamt lnei ()sDtaxm no4tpen ociatfs2eanmp;t4 lxrmf3tatfat livs s) exr(r oodomtemnciasfs2ua(r ot1tpt  ociat m2rmuvp t) lxoxrctytlpDe nei ( trtoxo oo4apt livsat)srraxro;o1opt mfciadfmDemu o;() reoxo3tytfaD  ieslt)s2xm(o io4lptnlnei t s2umurpou4openmoeiys s2ea(vp u)arxnxf3tadfpD anvils srxmimpoodlmen iet tf 2umu  ;t1opx iieiatls emnvp u)trxoif3iotlpD li sl()srumim3nodapeemictasfs2rmu pnt1tpe  oeiad m2umu s;(4 lxnmf ia1oaDrlues s) rxoio oydamt mivsl(fa2tmx pnu1ole moeiat aDrlnmp;t4 reomo oadlaDraivi (0s2xoxo3iy1lmt mfviasfs2ta( onu4ole  ociadla ulnms;t4 etnioctytla  ai o;s  etmiopny4al emivt s)aDrrx  oo4tpenmf3iadfmDrmu pnt)artnmr3tadla raies;s srxrio3oodal   nei s)arrruront4aet ioeias a um(vo;(4texrif3tadomDeli i () 2to(rpoudlm elnvi s artax poo1oeenifeiytfaDemumsn(0 lxrir io1fmDraneo;s)trurio3no4ap  lnes (  rtr( p;u4aeeomfeiadlmDel( sn()texnir3oydfp  lu olt) eto(r oo4omenlici ()arrrum ;o0altomo3tas a emuvp u4 lxomociydlmDe u ilt0 exo(rpiy4al emfetl()s2urumpnu4alx  f3iytlm rmnvpnt) etoir ia1fmDr n i t)srurxr nudapt mfesa(f Dta( o;t4aeto i3iyslm2rauvpn(0 ltnio3oadfatr n o;t trtr(m3oy4omeelieils)s2ra( p;u1alxomo3iysfs el( sn(0tlxnir3iy1latrai s t0sexo(r oudope  fet s)aDtau ono4aleo i3tlsfm2rm( o;t0 eermf iodlp r uvi t)tetrirpnu4oleemicsls s2umumpot1oexoiociysfmDua(mp u0alxomo3oo1fm  luvs;( teurxmpiudaleelictatf 2tax  ot1apt miciyd a rlums () rtomo3tydlm  ai o;()s2uoir iu1apt  fesat)a2trxm ot4apeoioeiytlaDrm(mo u)arenxr oytfpDr nvo t  rtr(o iu4al  mncilsfa2uru pot4tltomf3tyt mDel(vpnt0tleomrcty1lmt auvi ( s2ur(o nu1lmtn fes (  Dtr(  no4tpeomo3tys m2rl(ms (4tleoxrctotfmtrlu s (0s2xmxr nodop n icsa() Duaur ou4apxn ieiadfs rmuvo;() lxnmocoatfmte ueilt0 exoxm nu1omenliciatfsDraxrpnu1aetoii3iltfa uln p;t4arxoif3iy1opDe ies;()setm(r3iudole mnciasfarrru  ou0oetoiieiysfa ulnmo;(4trxoxociadfaD  u i s  rtmim3oydlp emiesls aDurxr ;t1opx miciat m rl(vs t)treomocootoaD aneslt trxm(o3iudolt mivi s a2uaumooo1altn ociyt mDum(vp () renirciy1lmtr u o t0tetmiopiu1apeemncta()s2truront1aeto f3iat s ra( s;(0 ltoxo todfmD livilt0 2toim3oo1lltnmfvt (fsDtau oot0apx moeiaslsDemnvp;u0 etrmf3io1opteau o;t s2urir iy1omen fcsas arrmur nu4tptnmi3tltfm ea(ms t4trenmf ootfa  lieslt0 eto(m3nu4lptnlfetltfsrtaxr ou1tetomfetydfa rm( s;(0 ltomr ty1omt anvol(0 rtoxm iydll eliesltfarum(mpnu1opxn fciltla2rmu o u) lxoxr iadfpD aivilt0trxm(m iydlpen nci tfsDtaump;o1aptnmf3tltlm2ua(mo t0tltnmr ty1lmDelu s (0srumxr3nodoleemiviatfartaumoou0tetniiciatfm rluvs;(0 ltoxo3oodomDeln o t0texm(opny1olee fciat) 2rrxm ;t0ape mfciytls ua(vs;u0trxnxf ia1omDelnei () 2xo(m iodameelfvtat)arurxr ;t1olxnmietasfs ul( onu4 rxoxr3oa1op elivi ()trtrxo nudlmtnlivsa(f rtaumpnt1tle mfeiasfmDrauvo t) lermr iodfptraieil(  rtmxr oudal nlfvtl(fsDrr( onu4oexnmo3iydfmDuan snt4tlxoif oy1oaDrlnvsls0s2uoim ny4oleelncs tfaDtr(m nt4olx mf3iadlm2eln sn()arenmo3oy1lpte ivsls seto(opnydolenlivsl(f rumum oo0alt ifetatfa2em(vpnu0trtoxo3ia1laD  u o;( t2umxr3io4om  miviasfsDur(rpno4aptoif3iadfs2ul( onu) etnmr3oatop  li i;(0seum(r io1olt lfetl( s2tru  ;o4tlxoioeilsfsDrmuvs;()artnxoctotfat lnvsl() 2xr(o ny1oltn iet (  2raxroou0aeeoiociytlaDrln o t4 rtoxrcoytopD an il(0tetrxo3oudll  mnesa(fsDrmxm ;t4oeeomiciysfmDuluvs u0 eermrciadfatelivs;t0t2uoirpiydlpt livsa(fsrtm(  ;u4oltn o3tyd s2eau p;t4 lxnio iadfpD  i o;t s2toim3iy4apeemnvs t)artaum ;o1altniietatfsDuaump;u)alenir3ootomD  nvi s0seurio ny4ope micsa(f ruru  no0apen f3iys aDumu p (4trermfcoa1oateaueil(  ruoxm3iu1lpe mfesa(fsDuax onu4tpt  i3iadfs2ran o;t4teenio3oydom eln s (0 eumxm iydam  mieslt sDtaxm nu0tlxn o3ils s2umnmont4tlxomo3oa1fp ran s;t srurxo ny4ll n ncs tfsrrmum oo4oee  i3iytla2ul(vs (4texnmf3iytopD  ieo;t)s2xr(r3iydllen fvtls) Drrx  nu1alto f3ils aDrlums t0tlerxocia1latranei t0seuoxm3iu4lm elictl() rtmxrooo4apxnmoeiad s ra( o;u) rxnxo iytfaD  n il(0 exrxm3iy4aptnlfctl()sDtr(mooo4alenifctltfm2uluvs;t4 ltnif iodlpDe nvo (0 exo(opoudll e fvias aDrrx pnu0aet  f3iadfs eauvp;()tlxrioctadlp rlueo s0sexmirpnu1opeemivslt a2uaxroot1olenmietlslm ul(mpnt4trtomo tatlmDeauvs;s0srumxopiu4ap  micilt  2tr( p;t0oeenmieiltlsDra(vp (4alxnxo tytfpDrluesl()teuriopnodlp nlnetls s2tau pot1oexn ietatlaDel( o t0trenmr3oo1opDeln il(0srxoir nodalenmietat sDrmxmp;t1aex moeiys mDrlump;(0tlxrmo3oa1faD  u olt0sruoim ou4amen fetl()aDtaxro;u4ole micildlm2rl(vonu4artomrctydoateanei t0trur(o3nydal  lneil(fsDumxmoot4oex  f3tatfmDumu s;(0trtoifciodoaD  ues;t srurir oy1al nmivi tfaDrm(  ;u1aeeoii3ildfsDeaumpnt0 etomf3tadfptranvo;( s2xmxrpiudoptelneta()arrmxr ou4tlxnmiciltls rlu p (4aexrmr3ia1laDe n s;()teumirpiudale  fvsas s2rrump;t4oexoio3iad a um(mo t)aetoxoctydla  luvo;()s2um(mpio4altelfeiat)arrmu pot0aetomfcias sDelums;t) lenxfcoodlat luvi s)s2trxmpnodale lfei t aDtaumoou1alenifetytfsDea( snu4aexrio3ia1oa   n i;t0 2toim iodam elfvsl( aDra(r ot1ape  f3iatls rmu o;t4arxrio3oytom   neo ()s2trxm3nudal e iesa(f 2urur ;o1oetoif3iyt a ul(vp;u0artrmo3iatfmtrlueo;(0 eurio ou4lm nmivtat)arum(rpot0olxnmo3iytlsDuauvp (0altomrcoodlat anvo;t  rtr(o nodlpen fci t sDtm(r ;o1olt mfciys sDulu on(0arenmfctatlmD aivo t0t2xrxo nu4opte ncta() 2ra(  nt1apxnmocild s2ua( o;(0 ltnmf3iadomteanvs (  ruoxo3nudamt lfcilsf ruaurooo0olt mi3tyslsDrlnvo;u)arxrxrctotop raivo;( t2triopnu4omt lici tfa2raxm nt1aee mfeildla2ra(vpn()trxrmf iotlmD  u ils) rxoxo no4ol nmnetlt  2raxr ;t1apt  i3iydlm2eau p () eerxocoydlatr ivi t0 2triopnydapenmivsa( a2tax  ou1tex iicildla em(vp;u)trxnmociy1la eaies;s sexm(o3oudlpeemfvt tfs2um(m ou0olxnmfeiyd mDrluvp;u) lerio3ta1fpt anes;s tetrxrpoy1apenmncs tf rurxmonu0tex ioeiydfm2uanvs t0alxrifctytomDe uei t t2urirpoudole  netat)a2umur ;o1oex ifetyslmDra( o u4alenxo iytlpDe ies;t) rxo(r oo1lmt mivsa( sDtaxmooo4tpx mf3tldlm umnmp u0 rtrmfctytop elies;t0 rtmxo3nu4ol e ieia(fartrxronu0aeenmfeiltfmDrmuvo;t4texrio oy1oa raivs;s  2urxmpno1lptn iesas s2tmxmp;t4alxnmfetad sDea( pnt)alxrir io1om r nei t trto(m iodal nlici s)aDum(r oo1apen icias aDel(vont4texrmo totlmD ai i;t0 rxmimpiodlpt  ivi s aDtau  ;o4tetn feiyt m2um(ms;t4tltnmf tytlaDe ivo ( trxrir iu4omee ncslt sDtaxm ou1tetnmoctas mDraums;u)aetrmrctodfm r nei;s  etmxm3iydomt micsat  rra(m no4opt  o3iysfa um(vs u0tetnif iytfpteanesls s2tmirpno1ol nlnvilt) rta(root0tlx ifciasfaDul(msnt)altnmo3ty1fmDrai o;s0 2xmxm3iudolenmfcsa() 2ta( pnt4oetomi3iyd s rlumpnu)alermr ia1om  luvsls)trtrio3iu1ol elfcilt s2rm(m ou0tleo ociytlmDrmuvo (4 eeoio totlmteau olt)s2umxr iu1lm  lnvtls) 2uaxmpot4alxo oeilsla2uluvo ()tlxnmo3oydoaD livs s)s2toio3oydoltelfciat  Dum(mp;o4oet io3iydfmDea(vont4artrxo3iatlmD lneil(0t2urxrpiu4ol   neils) 2raurpou4oex iieiytls elnmo (0trxrmrciodlpD  nvsls0s2uoim oydom emnci sfsDururpoo1tptniictlt a2el(msnu) exoxo3iotfpt  iei s  euoimpno1olee fei ()sDrau pno4apt ioetlslm2uan p (0arenxf tydlat  i ols  rxrxopoy1ape  fei ( aDrmumont0olx  oeiydfm emn o;u)areomf iadla rlneolt)srumxm3ou4ap n feils)sDtr(mooo4aptoifctasfm2rm(vsn(4teerxr3totlp  anei (0srtmxr3ny4alt lfci s)srumum ot4aeeo ieiatla2uaums t)texoxr3todfpDe neo;s texmxopnudoptelict (f Drr(  ot1tet iictld sDra(ms (4 leoiociytfm  ln s t) 2toiopiu4lp   ictasf Dta(  nt0optnmiciad a umu ont) rxrxo3oo1laDe ueslt) etoir3iy1olt mfesatfsruaumpno0altn iciytla em( p u0aeenxf ta1fp e ivil( tetoxr3iu1lpe mfvsls) Duaxm ;t1tltomi3iadlsDeanvpnu0alxnxrcoa1fp rliei;t srxrxr3oo4lmee fvtatfa2tm(mo;u4ope mi3tld a2uau p;u) exoxoctytomD au sls0 etmirpoudll emfesa( s2trxmoou1apxoiictad s umu p u4 etrxf tydfp eanei;s t2xr(r3nydomeelnvtl()s2trxr ;o1texnmf3iyd a2emnmont)aexoxo3iodlaD anvo t0t2uo(rpnu1omt lieias  rrru ont0tlxomiciatla2ea(mont)teeoif oodlmte ies;t  eurir3no1aptn fcil(faruaxroou4olenio3tysfmDrm( o u) rtomfciotfaDrln s;t trxoimpou1ol n iet t)aDuax  oo4teenmoetlsla uauvo t0 eeoircia1lat  ivs;s0s2tmxr oodal nlfvilt artmxrpot0tpen i3iatfa2rlnvo;t0tlxnir3ia1laD lues;(  eurimpio4alen ivilt a2umxmp;o4oeeoio3ild s2uan s t0altnmfcia1fmt auvsls0texrxr3io1al nmiviatfsrrrx o;t4tlt if3ils s ua(mp () etrmfciadom eau s;s0tetmxr3io1ll elivi ()sDum( oot0optomoeiat aDraums t) renifctodlpD  ivol(  2tm(r ou1apen icslt arum(m nt4teeomfctadlm2ra(mo;(0teeoir iydlateaueo;t0tetr(m iy1al nmicsatf Drmu  ;t0aee mieiydfs2rlu p;u0tlxomo tydlpD  n s (0 rurxm3nudomtemnciatfs2ur( pnu0apx iociadlmDrmnvont0trxniocoydoatelnvs t sexmxr3io4op  mnvi tf 2ur(rooo1tltoiieiys aDumnvp u0tlxrif3tadoptraieslt) eto(mpiudolte ietltfa2ra(mpot4tpxniieiys aDean snt)trtnxf3oodfm r uvo t srtrxr3nu1lme mfvi (f rrax p;o1tpe ifeiasla2uln pnu)tleoifciatoaDr neilt  2umxopnu4al   ncsa()aDumxroot4texn o3iys mDrmn o u0 renxfcta1oat lies ( trxoxrpoo4lptemnetat)s2uaur no0oexn i3ilt sDeanvon(0altnxf3iy1optr uvo ()trxrio3iy4apee nviltf rtrumpoo0tptomfciltls2rluvp u4 eeoioctodlmtr u i;() rur(r ny4alenmicsas  2taxmonu1tpt iiciytfm2ul(mp t) exnmr3iotfm  au o;t texmxr ny1omenliciltfsDta(rp;o1tptoioctydfmDuauvsn(0tlxomf3oytlaD ai s s0s2uoxopny1omenmnvil( s2taxr ;t1apeomfciadla ranvs (4aexniocoatop e neilt t2xoxr3nudamt  fct t a2raxmo;o0oltn ieiasfm rmn on()tlxrxf3oadlp  auvils srxoim iu4om nmnesl() rrmurpnt4altomfctysfm2eaump;t)alxrio tadom  lu o;t)t2xoxm3iodoltelnvilsf Dta(mont1olxomfciatla elumo;t0trxnxr3tadoa eli s t0srxm(r oodame livi s s2rrxmpou1tet  oeiatfm2rlumo ()aexomo3iytomteanvi;(0 exm(m ou4apt lieiasfaDrr(mpou0opxnmi3tlt a2rau o u)artnir3to1omD anvi;t trxm(m nydlpee fci (fsDtmxmono4tle mo3iasfs2eln p (4tlxoifctadop  ln s;t) rumio oy4lleemfeil()s2rrumooo4alt  ociadlm2ul(vsn()aeeoirctydfateanvsl( teuoimpou4amee iesatfaDtrum ;u0olxoiociytlm eanmp;(4 rtoif3oa1oaDelies;(0setr(opiy1al  lnes sfarrau  ot1aeen fciydfs um(mo u0 rermfcoo1fpDrlnei;s) rum(r3io1lpeelivs ( aDraxmp;t4tlx  feiat mDemu o t0arxomrctydfp eauei t)srtoim no1apeelfcsat a2rmxm nt1tpt ii3iysla emnvpnt)arenmf3ootom  anvo s t2tm(r3ou4am  lfeslt  Duaxmont4tex io3iytla2ean o u)arxrmf3tydomD livo;s)trurir nudame mfcslsfs2urx  oo0alt  oeiatla rmuvo t0trtoir iatfmD luvs t0seuo(opou4ol  mnvtlsfsrra(rpot0alto ieiatfsDraumpn(0tltnmfciytoat lu i s s2umxo oodlme mfei (  ruaxroou1opx  ocilsfs ulnmont) lxoxf tatfmD aivs;() eum(m oodale  fcsl()srrr(r ;u4olt mfctlsfm ul(mo;u)arxoir3iy1lp eauvil( sexoxm3iudaltnlieiasf rtmx onu4tetomfetasls2ulums u0 leoirciodlaDr ieo;t) etmir3io1ap  lfcias)sDtax ont1tlxnmfctys a ea(ms;()arenio ia1faDe ieo t0 2trxr iydlmt mnvi (faDtaumono0alenmociydlaDul(mp u)alxnxfctadom rauvo;( setmxr nudapte netl() rum(r ;u1alxnii3tlslsDrmump t)tetnio3todoa  aueils trtrimpnu1lme lnei s) Duaxmp;o1oet ioetydls rauvp;t0tlxrir ta1faDraivsl(0sexmir io4om   ncs (farta( pot0oetomo3iyslaDum(ms;(0trenio io1oa r uvs t)t2uoir3oy4llee fvias sDtrx pno4tlt  i3tatfs2eln onu0tlxoir3tytfpt anei (0teur(m iydomeemfctat)srumx pot4tpx ioeildls rluvpnt0 etrmfcootlmD  uvs;(  2xrir oy1ol nmivt ( sDuaumont0apenmfetydfm2emuvonu) leoxf3iodlatrlies s) rxm(opio1lptnmivi s a2taurpnt0tptoif3iatls2uanvsnt0 eermo tydfatr ues ( sexrxopny4amenlnct s aDtrumpou1tltoio3iatla ulnvs (0tltnio3oy1fp e n o;s)truoim3iu1alenmnei tf rtmxrpno1open fciysfa el( s u4trtoxo3oy1omtrlieo s0srto(o io1ale  nvia()srta(m nt4aptniociyslm emu o t)aetoir3ta1fm r n s t seto(opoo4ap n fesls srrauroot4olto fetytla el(ms u0texrirctytop r uvi ( srtm(r3oo1ap  mnetls a2uaum nt4tptomo3iltlsDuln s;u)areoioctytfmteaneo ()t2tmxr3ou1alt mfvtl()sruau oot1tle ioeildlm umuvp;u0teenxr oatfp eanei s0t2toxm nydam emnet t)srrau p;u0tex  fctad sDulumon(4arxrxr3to1oa  an o;t0 rtrim ou4lp nlnct () rra(r ;t1opt  fciydlm2ua(mont)tltnir3oy1lptranei s0texrio iy4amenmfvilt s2ta( ooo1opeomf3iydfm rlu s;t)aetnifctatoptrai olt0tetriopnudlm  lnvtas) rumxmooo1olt moeiasla2eanms t0trxrxo oa1fpDranvolt setmxo iy1omenmnvslt srrr( oot4oexoif3tltls emumo (0aexoxfcoo1lmtr nvilt  etrimpny1lmtnlicslt  Draxrp;o1aleniiciad m2ulnmont4texnmo3todfpt  i sls)t2um(r3io1om  lnvsas)arraum nt0tle  iciyt aDemuvpn(0alerxo tadlmDeliesl()t2ur(r3nudlme lnci tfs2uau  ot0olxoifctytfs2rmumpnu0aexoxrcoy1lp rli sls seumxr iu4omeemivsas  2rau pno4oltoiociytfs uanmp;u4artrir io1oaD aies () 2xmio iy1amt lfcslt) Dtrxm nt1aexnioeild m2rmuvp u0alxnif3to1lm   i s;t)texo(r ou1llt mneil(fa2raxmo;u1oeeo fctltfm2ra(vs;()altoxo3ty1fm rli ols srtrxr3ou4llt  nesat) 2urxmonu4tle mietasfmDeaumo u)altrxfciytomDrau s (0teumir3oy1omen ies tfsrrmur ;o1tptomiciyt aDeanvs;u0trtomfctotlmtr ivo;s  eurxmpoy4amt mies s)aDtmxr ;t0texniictydlsDranvsnu0 reoir3tydopte nvi;t0teuo(m3ny4ape  feil( srta(rono1altomieiatlaDrmu s;t)tleoxocta1latelueol()teum(m3oo4openlnvta() rtru pou4texnio3ildla ea( p;()alenxfcoo1omtr nvslt0srxrxo iu1lpe mncsa(fs2uauro;o4oltnii3tydlm ea(mp (0 ltoir ty1oa r u s ()s2tm(r iydamtn net s) rrmurpou1tlt  f3iydfs2ul(von(0trxomr totla   nvo;s srxo(r3nodlpt lfvsat)aruaurpnu0olx  o3tldfs2ra( p (0trerif3iydlp e neilt  2trxr oo4lle lict ( sDrrxmo;o4alt mfctad m2em(vs t4texomr iotfmtr u s t0seuo(m3nu4omeemfvi ( sDtru  ;u4aptomoetys sDelnmo t4 lxomo3oy1om r ueol(  exmirpiy1omeemnes sfaDuau  nt1tltomiciytla rl( s;u4 eenxr oo1fmtrln sl() ruoim3iu4om   ies s sruru pou0ale ifciyslsDel( p;u4teeoiocio1omtr ieo s0 2xo(m oy4lmeelicias)sDtrur ;u0apeo octyt aDumumo u4tleomo oytfp e ies;t  2umim3iu1openlnvt ( sDtm(ront4texnmictytfm eaump u)alerxr3ty1lmt auvo;s) ruoxm oo1lm e nvil(fs2ua(r no4apt iociytls emuvont4tetomociydfpDe nvo s)texoiopio4om   nct s sDtm(m ot1tpxnif3tysfs ul(ms;(4texnir3oytfp   neols) rxrir3iydomte fvsat s2tm(m ;t1tee mictytfm rl(ms;()teenifctydomDeli i s) etmir3iy1lpt  ictatf 2rm(mono0texomo3tyslm el( sn(4alxoxr3tatoatrai s s0 rtr(o ou1ome  nctls s2rrxmooo1aexnmociyt s ra(mo (4trtoxr3todla  aieo (0s2xoxo io1amenmnci t)srtrx o;o1apxoiiciatfs2ulnms t4teeoir oytfm rlueo t texmiopny1opeelfvsatfs2urxmooo4optoiiciasfm2rauvo;u)aeeomfciatlm  an o;s  eurxo no4lp  mncsas) 2rmur ;o0olx io3tyslsDrmumon(0alxrmfctodfm rlnes s)trtm(r3nu4omee nci sf 2tmur nu4alto feildlsDelnms (0 ltrmf3tatoaD aues;(0 2xo(m no4ole  fciltf 2ra(  oo0aex if3iatls2el( on(4 lerxf ia1laDe i i s0texoxopoudopee netls  rrau ono0apxn i3tys sDraumpnu0aetnmo3iodoa rlu i;t)s2uoxr3iy4aptemfvsls srrax pno4ale iociatfmDeaumont) rerio oadlm  an i;s)s2xoxr oudlpe  ncs ( aDraumpot4olx ifeildls uauvp (4aetnio3ootfp   n ils0s2uoxmpny4alt  fcia(  2rm(rpou4oex io3ilslmDraumo () exnmrciytlmt lieo t) eumxm3iydolt livsl(  rta(mpno0texomietlt a elumo ()tltnmfcty1la  au s;s0sruo(rpny1lmt lnvs (fsrrau p;u0apxn ietyt a ea( ont) leomf oo1opt li i t) 2umxo3iu1amtnmfvsa( aDrmx oot4tet mfeiadfa2rmn p ()alxoxr oatfpD aieilt srxrxr3iu4ope mncsas)aDrr( p;o1alt  o3iydla2ua(vo () exoircta1omtrliei;t0srtoxr3oudale lfesl() Drrxmoou1tpe mieiytfa2rmu s;t4tlxrir todlmDeanes (0trtrxmpny4olte fei s)arurump;t4aet iictys mDean ont)aeermr io1laDeluvolt)s2xrim oodlp nmnvt sf 2ur(ronu0tex  feiltla2uanvpn(4 rtrxf oa1oat livs;s0t2urirpny1ap nlfeils aDra( ono4alxnifcilsfa2ea(vont0tltrxr oodlmDraneol( teurxmpnudam elnetl(fsDtmx  ot0apxoif3ilt mDrlnvsnu) rxnmo tadfa eln ol(0 exmxopiudalt lfvi s) 2rr( p;o4oeeoioeiatfa eau p t4 rxnmr totom   n il(  rtr(r iodom nlfesl(  ruau p;o4olx miciaslmDrm(mp;u)tetomrcta1fm  lnvo t)tetr(r3ny4ole mnciatfaDrrxm oo1alx ioctyslmDrln p (0artrmocoatfpD ln i;t0srtm(m3iodom n fvs s aDuax onu0tpenmf3iysfs2umnvo;t4 ltrmfcty1faD  u o;t0 2xoxr3iy1ap  mietlt)sDrrx pnt4aetnmoetlslaDuanmpn() rtoioctatoa   nvs;(0sexoim oy4lm e feilt aDur(roou4teeoifciatfa umn s;(4 eeomrcia1opDeauvol(0texm(r nudlptn nvs sfa2ra( o;t4tpe mi3tadlm rlnvo t) eeomo3io1omtelu o;s0 2tmio3no4ll   iviltf 2trx  ou4ope moeildfm2ranmo;u)trxrxrcty1lmteau s t)s2trxm nu1ap n ieiat)aDrmxr ou0apto ieiat s2rau pnu0 rtrif3ootfateluvols0trurirpiudlmenlfcslt  Duaxrono1tpxomictltlaDrl(mpnu)teerif io1fpDrln slt) etmir nodolee net ( sDrrumpou4tltnmfeiltla ul(mo u4tltnxrctatoaDelu ilt  etrim3oodalt mfcsls s2tm(m no0apxn o3iatfmDran pnt)altoir oo1opt auvi;s)tetoir3iu4omee fet t)sDrmx  nt4oex mfctytla2ulu s ()tlxrxr3oytop   u sls t2ur(r3oy1ll n fciasf rtmuro;u4oexnmi3ilt mDelnvo t0tleomfciatfmtrlneilt tetm(opou4ape mfvtlsf rtmxrooo4oleoifeildfmDemumo;t)trermo3iydlm  ai s;s0texrim3oo1ll  lietas)a2uau poo1aeeomieiasfa2ranvon()teenxr tatlpD ln il(0trtmxmpny4omen netls)s2umxr ;t1aptn octlt aDuau pnt0arenir3oatfa rli sl(  etr(o3io1ll  mfctasf Dum(m nu4tleoif3tyslm elnvs (4 etomo3oydop r nei (0srumirpoy4opt licsat aDrrurono4tpeoifctld a rlu pnt4 eeoxoctydfaDraivo s)srtm(opny4apee ivs t s2tr(  no0oex mfeiat s uau on(4tltrxr3oadopt  uvs;s) rtm(rpiy4opt lnvsl(fsDraurpnu0apeomietltfa emnvs u4tlenmfctydopDran ils) rtmim3iodlpte fvil(  Dumu pou4opx ii3tyd m el(vo u0 reomfctydoptrln s (0 eurirpiodll   iciatfs2tmurp;o4open i3iatlm2rmuvo;u)texoio iytom r uvo;t0teuoxm3ou1lm   ietl(  2taxrono1ape io3tasfa ul( on(4teeoiocoodfaDr ues;s)tetrxmpiy4apte neiat) Duau  ;u4aex  fctldfa2uln o;t0tlxomo oa1fp ran ol(0 rtm(rpiu4altemnes ()srraxrpno1tetn feiatlm2um(ms (4 etomr ta1oa  anei;()t2tr(opoudllt mietasfs2rru pot0tltnifcilsla2ulnvs;u) lxnifciodomDeauvol(0 2xoxr io1lmt micsa( srrmurp;o0tlto ietls mDrlu o;t4tlxnxoctotlptrlneols) 2ur(r iu1lpt mieils)arua(mooo0optn oetyt a rmnms;t0 lxnifctotfpDeau o s0 ruoio3io1lme  nvias)aruaump;t0tpeomieiys a2rm( ont4aexnirctatfm  livils0t2toxmpoudop   fesl(  2trxmo;t1tpenmi3iad mDemuvp;t0alxoxfcia1fpt anei t0 euoio oo4ame  ietl( srrrxm ou4opeo ociydfmDuau s t4 eeomrcoo1opDe n slt0t2xo(opiodal e iei ( s2rmu pou1apx ioctltfa2ulu o () etnmrciatoa   u s s) exmirpoy1omtemfvi sfaDuaxm ;u4tlx ifeiytlmDulnmo;t0tetniociytlmtelu ols)tetmiopou4lptnlicsas)arrmx  ;t0oet mociaslmDua(vs t)teeomoctadfmtraiesls0t2xoir iu1olee nesatf Dumu ono4aeenmo3iydla2emu snt) rtomf tytom   ueol(0srxm(opoo1aptemivi t) rur(r ;t1oexomoeilt mDrm(vp u4alerxr3tadoate ies;t0trtr(m nu4apeelfvsls srrmumpnt1aleo ietatlmDrauvp (0 renir oodfmDeanvslt)trtr(rpnodlpen ivils  Drrumpnt1alen feiydla ua(mo;() lxnxoctydfat  u olt  exoxr3oodop nmnviltf Duru  oo4oex ioeiasfs2em(ms (0tetrifctytoateluvs;s)srtmxm iy4alee ncilt) Drrurpoo0olt  i3iasfs uanms;t)aleomr3iy1fa  aivs s0 eurxo3io4op emietltf rtr(rpou0tptnio3tad sDemn s;t4treomocoydfa ranes;s0srtmim oudopenlfeia(fsDur(rpou4oltoioctydlmDulnms;u) lxrmo oytopD luei s)trxmiopnu1om   iesat artm(mo;o0apx  octys a2elumo t)teerircty1oatraivsls  rto(r3nodaleelieiatfaDtmxrono1tlxnmociadfaDumump (0 eenxf ia1om   nvo s sexm(mpoo4lpeelfvt t srtmxmonu0oleoioctyslsDul( on()arenif iytfm elneolt setrxopnydopeeliei (  Duauro;u0oexomieildfa rmn o;u)texoircia1lmtr u ols0trtoim3ny1lp e fvtas s2rr(  ou0oet miciatlaDumn p;u4aexnxfctytopte n i;t srxrio3io4olt lfcsa( artm(r nu4texnmi3iyslaDrmuvp t)trxrxo oodom r ues t teuo(r io1ol nmieias)a2trx ono1aeenioetatlaDrmump;(0aleomr iotfa ran o s)srtr(r oydap n nesls aDumu pot0opxnif3ias sDrluvpnt0aetrxoctadlm rauvs;s0s2tmxopio4lme lfcs s sDtmumono1tpe  ictys s emnms;(0aexoio3iatop  aivolt0 etoxopiodope lnes tf 2tmxmpnu4tet  oetas sDum(vs;u4tlxrxrciodop elies;(  2tm(m iodom e ivt t)aDrrx p;u1ope mieiltls2ua( s;()trxomf3oa1fmD liei (0t2tmim ou4omtnlfvi t sDrmx p;u0aetn oeilt aDeanvs u0arxrxo io1faDeanes s0teuoxo3ou1lp emnvsls)sDtr( p;t4tet io3iydlmDuluvonu4 rxnmocootfm  livo;t0t2umxo iodoltemnetas) 2uaxmpnu0openifeiys s2uluvo t4texrmfciytfmte ivs;t  2urxm oy4amee nvs (  ruaxrp;u1tpxomoeild sDemu pnu) reoxo oodomDe i i;(0teuo(m3iodop elnetl(faDraxmpou0alxomfeildfmDulump;() rerxrcia1fpDr iesls0tetmxmpno4aptn netasfa2tax ooo0alxnmf3iatlm2rl( p (4 leomo oatfa rlueo;t) etr(o oudopt mfvtat a2ur(r ou4alx miciytlmDelnvsn()trxomoctatop e nei (0s2xm(m3iy1lp emnvs (  Dur( p;u1oleo ietatfa2eaums;()alenifcia1op elivi (0 2toxo3oy1altnlneta(fsrrmxmp;t1opt ii3iat s2rm( pnt)trxoxr3io1opD lu olt)s2xoio ou4ll emnesas)a2tmur nu4aex  ictyt aDelump u)teerxociytlp eanvil(0trxo(opnydopen fvt () 2taxmont4ape iietyd m2umnms t4trxnio3totlpD luei s sexo(rpoo4al elivia(  Duau  ;t4tptomi3tytfm rmnvp t)trxoiocoadop eau o s)s2xoxopou4omtemici sfa2rmu ont0tetomieiytfm2rlnmo u)teerxo oo1fa elieol(0teum(rpiudal n ivs tfs2tmum ou4opxoio3tasls um(vp u4 rxomf tadlatrlu s (0 2uoxo oy4oleemnvsl( aDraump;u1aeto oeiadls2uanvp;t)aetoxocoodlpte nei (0srto(m3iy1ale lfeil(  rtau  no1tlxniociysla2el(monu4 eeoifciydoatelneo ( srxmxr oy1llenlicsl()a2tm(moou4tpxoifeiysla2ulnvs;()tltoxrctytopD aueo;s  2xoxmpoodapt lfvsasfarrm(mp;o1alenmiciyd a2ulu o;t4arenmr iy1faD lnei;( setrxo oy1lpt  nctlt)aDtmx  nt0tetoifcias s2emumon() rxnir oy1opDe ivs () euoxmpnu4ope  ietls)s2uau  ;t4oeen f3tatfmDemuvo u) ltrmr3totlpD ln i;() 2uo(o3oy4ol n feia() rrr(r ot1oeeoioeiltfm2rmumpnu0altomr3tydlpte n o t)texmxopnu1omte nvsatf Dtrx pou1aexo f3iadlmDul(mpn(0aetomrcoytlmD luvs;t0 rurimpoy1optelivsas) rrr( p;o4oexniieiadfm ul(vo;t) lxoiociy1fptr ieols  rurio oudol nmfvtl()sDur(moot0olenmi3ilslsDea(vs;u4 rxoxfcoytomtrluvilt0texmxr oydlm elfvtlt s2uaurpoo4tlenifeildlmDranmpnu0tlxnmo3oy1fpDeanvil()t2uoxmpoo4omt  ics ( aDtmurpou1tlxn o3ias m2rlnvo t4aexnirciodopDr u s ( srumxm iydal emicilt srumuro;t0oetoiietysfa rmu p t)alenmr3tydfm ranvi;s s2tmio3ny1olen fcilt)a2rru onu1opx mo3iasla ulu p;u0tlxnmfcoadlaDrluei ()t2trir oy4omt lnet tf rumuroou1aeenmi3iysls eauvon(4 ltrxoctydla raiei;t  2tmim3iodaltemivtas) Drau pou1teen fciltls2elu pnt0trxrmocoadlptrlivi ()texoxm3iodlmt micil( srur(m nt0tpe moeiat m emnvpnu0tlxrxr3tatoa  ai olt0 rtoio3nu4ll  mncta( a2uaxmo;u0aptnmo3iyt m umn o;u4altrxr3oadfaD lneils0trxmxopnudaptnmnvilsfsrraur ot0tlxnmieiltlmDumuvs (0 eenir3oatfaD  u s t seum(m3no4lleemfcs (  ruau pno1oex mfeiad s em(vont)tlermr tydomt lneo (0 rum(mpnodalte ietlsfa2rmu  ;o1optoio3tytfaDemumonu4tlxoxf tytfm  an i s0 euoimpnydlpte neilsfartmurpou4alx mieias m2uln p;t0aetnxfcoatlptelnei t sexoim3no4ale lfvtl() Drr(r ;t1apx mictasfs2ua( s (0altrxf3oy1fmD lueo;s0s2toim oydamen ieslt)sDta(monu4olx  octysls eanmsnt4 exnir3tadlatr ueo;s0srur(o3nu4olen fetl(fs2umx  ;t1altoif3ildlm2rmnvo (4 lxnmocto1fp e n o s)t2trxrpnu4al  mivta()srumx  no4tleo octls m2ra(monu4 ltrmo oodlmt lu s;s) 2xoim3ny1altnlnvt tf 2um(root4tlxniieiatfaDrl( pnt4 ltnxf3iytfptraivs t)t2xoxo3ny1om nmiciat)arrm(mooo0tpxomo3ilslm2ea(mp t)aleomf3oodfmtran s () exrio3oy1ap n net ()a2umu pno4oetnmieiad a rm(vs t0 exnmr3iotlmD  neo;s0s2umxo3ou1lpt  nctl( a2ururp;u0texn ieilt s raump (0 etnifcoytfmD au o;t)teur(opnu1ope  icia()aDtaumo;u4apeoioctytlaDuln p u)tlxnif3oatomt lieslt s2xmiopoo4ale lnesasfsrua(mo;o4teenmi3ildlaDea(ms ()texomr3iytfpD auvi;t t2um(m iodope lneil() Drrur oo0ale  ociyd aDemu snt4alenmocoydfa  au o;t  etmio3iu4opt lict sfaDrrxmono1altnifcilsfa2rmnvs;u)aetomr totlat  i i;t)srumimpoo1altnmivt s aDum( pnt1aeenii3ilt s rmnmon(0trtoxocia1om ranvsls texr(rpny4om e fvia(fa2ra(r ot1apx mieiyt m2rauvo u0 etoxo oadfa rluvi;t0teuriopny4al   nvtl()s2rmxr nt4oleomieilsla el(mo t)arxnxf to1lmDeau o;s  2uoxopoudol nmnvilsfsrrm(rpnt0aet  o3iltlaDrmn o t4aexoxr iotomDeli slt)s2toio3oydoptnmnvs t srua(r ;t1olxoio3iys mDran pnu)aeerxr3tadlpDr neo;s tetoxr3iudolen nei tfarurxro;u0oex  oeiadlmDel(vs t0treoxf ia1lpt lnvs;s)sexmxr3oydolenmfcta( aDtmx o;u1opt mi3taslsDranvonu)aetrxrctatfm   ueolt)srto(rpnu4lle lnctas)sruaxmooo1ape miciytla2ea(mont)treoxfcto1fm rlneslt s2xmxr iu1olt mfcs (fartmxm ;t4oetnii3ils s2elums u0altnif3totfptrai s;t)s2xrxopnodlltemicsls a2ua(mo;t1opxomoeiyslm2ranmont4aexoirciotlp rli ol() etmirpoudlm e nctl()arua(mpnu4texomo3iadlaDraumonu0 lxnxf3totfpD  u sl(  exrio3oy4amt lfes sfa2urxr ;t1tlxo i3iadfm ra(mpnu0 rtoxf3io1lp r i i;s sexm(r iudlmtelfcils s2rax  ;t1aleniiciad m eluvo;u)trtnmociodlaDeau ol() etm(o io4lp nlfcsas s2uax  oo4opxnmieildlm2ranmo t)alermr3tydfatranvs;s0 eum(r3ny1lmtnlnvsl( aDtru ont4apeoiicild a eaumpnu0 ltnmr3oytlm elnvs;t  rtrxrpou4oleemnet ()srrrx pot1tltoioeild m2rlnmp t4 eeoxr3tatlpt  ueslt s2umio nu1apte netasf 2ra(mp;t1olx ii3tltlm el(msnu4 reomr iodfpD luvi;t)trur(m nydoleemfcta( aDtaxmpot1aptn oeiltfa ulumo (4tlenmoctytfmtelnesls)tetmxr ny4amee fetltfartax pou4alxnmf3iadla2ulumo t4 rerir oytfp raneslt)srumxo3iu4omt  nvt s sDrrumooo0optn fctatlm2ul(mo;u0trxoxrcoydfpDeai ils0 2tmxopnu4olee nvt (fa2rr(mpnu1aee  f3iatlm rl(mp ()tetomo oodfpte u o;t)srtoxr3ny4lle  fctat)a2rrum ;t1alxo oeiadlm2rmu o t4tetnir3io1opt  uvilt)t2tmim io1op nlnct ()aDrmu  nu4oexnmoetat aDul(vo;t0arxrxocoodlmDrai ol( s2um(r3iy4ope lnetl(fsDuauro;t4opxo icilt aDrl( p t0areoxrciatomtrluvol() exrim3oodlmee neslt) rua( oot1olenmi3ildfa rm( on()artrmo oadoa e ivo t) rurxm3nodlltnlnvilsfsDrmxmp;o4apxn feiadfmDemuvpn(4tlxrif tytop  lnvols  rurxrpiu1am elncsas)arum(ront4oeeoiietlsfaDemu pnt4 eerxr oy1opte nvolt0texoir nu1lpe mnvs sfs2ur(r oo1apx  iciatfs ul(mp;t0tetoif3iatlptr i il()srurirpnu4optnmfei ( a2tmu o;t4aeeo ictyt a elnms;t4 exoio to1fp rlieo () rxo(opoo1optemfctlt)s2ua(mp;o4alen o3tytfa rmn ont0alenif oydoatrlneilt0 eur(mpnudal  livsas sDrru onu1alxo octydfa2ul( p u0 ltomr3oatlpDe u i;()t2xr(rpio4llenlivslsf rrr(mpnu0tpenmo3ilslm eluvp;(0aexrmoctytoaD aueo s  rtmxm iydope mnvsatfa2trxmp;t0tptomf3tas s rm( p;(4aleoio ootom eaueo ()s2trxmpou1om e ncsa(f 2rrx o;u4tlxo o3iydfaDul(mpnt)tltrxo3oo1optr uvi;()trurio3nodalt licsl() rurumo;t4texnmoctasfaDrmnvs;u0teenxr oadfp ran i;t t2toxopiu1am n nvi s a2tmxrpnu1oee mictyd s rlu o;u4 lxrifcoytomD livi;() rumxo3ny1lle mneil(fs2ta(rp;u4ape  ociys sDrl(mpnt) exnio3ty1lpt aneo;s s2xmir3iu4lpt mnvsltfsrraxm ;u4oleomictasfsDrlump (0trtrxocoydfmt  n i ()sexmxr3ou1olee ivtas s2rrurpou1olt  ictas m emu p () renmo3iotfa  lueolt teurxmpoy4lpe mfeils)s2trxmp;o1tleo ietysfs rlu o t) leoio3io1fpDe nei;(0t2xm(r ny4olt  neias  rua(monu4aleoiieiytlsDrm( p (4tlxoxociotopt  u i;s)t2tr(o3iy1altnlfvsl()srtaurpoo4ope  fetysfsDeluvo;u)treoxf3iadla r nvo;t0srumim oudap  lfcs s srtrx  no0tlx io3tld a ranmont0 lxomr3totlmt lu i;t trtoxm3ou4lmeemics t  rtr(mpnt0tleoiocias a2uauvo;u) lxomfcoodomDr ieo s sexrxr3iy4olt mnciat)srumu p;u4opto i3ildls uau o (0 rtrifcta1lmteaivo;(0seumxr ou1ope mnvtls aDua(rpnt4olt mfctld s2uln p t0treoxf3oo1opDranvi t) rto(rpnu4ll nmicta()s2rr(  ot4altomi3ilslaDulu onu0tetnio3iatfpt  u ilt0 exoxmpiu4om emfcsl(fsDrmu  nu4tee mf3tyd m rlnvont)aeermfcio1fm  aivo s s2uoio3iu4op  mnvtls) rumuro;u1oex  i3iat m emuvsnt)aeenir3iatfa raueo t  rtoxmpny1oltnliesasfsDtrxrpno1oee ioeiyt s umuvp;t)trxrio oatomDr u i (0 exoim nu4am e ncil(  rtrurooo0olto fetaslm ran o u0 lxoxo3oy1lm r nvilt) rtmio3iudop emfvi () Dra(r no0aleomociydfmDrmnmp (4arxrircoydop eau ol() 2xmxr oy1lmtn netasf Drrxr nu4ale if3iltfa2emnmo t0tetoxr3oydlaDrlnvolt t2xo(m3oodomtn fvsl( aDurxrp;o1tpto feias aDeaums t4tltoir oatfaDrauvo t  2uoxopoydlmenlivilt) ruax  ;t0tle mf3ild aDum(mp;u)aetomr oodfpDeaneols) 2xriopnu4lm nlfcslt)s2rmumoou0opxnmfciys a emnvo t4treomr tadlptelieo;s) exr(o3no4ll nlfvtltfa2tr(mpoo1tee  i3ildfmDeln snu0alermo3tadoa   ieo;t)trtrim3oudomenlfeia(f rtaxmo;o4tltnmoeiatlsDeaumo;t0 rtomr3tydlp e ivilt)tetoxo3no1ll n icsl( srumxmonu0ope  i3iysfm el(mon(0 reoir3ootomt auvolt)seuoxm3iodllen neia( s2rmuroot0apxnioetyd a2umnvonu4alxoxfciodlaD  u ol() rtr(r nudoltelnctl()s2trxm nu1opt  iciysfa umn s;u4texoif3oadfaDrli o;()srurxr3nu1ol   ncsasf Drrxrp;u1oeeo icias m2ua( p;u4arxrmr iydom   ivsls)trto(m oydop emnvslt s2tau pot4aee  fctadfmDrln p (4tltrio iydoaD  n o s)t2uo(m3iydam nlnviat artmu pnt0altn iciatlm rlnms;()treomr tatfm eau sl(0sruoim3oudap   icilt srrrumpnu1aptnmfctld aDua(vpnu4 lxnxociydopDraivi t)tetrimpoydop  mieta() rtaxrpnt0ale  o3tat m2elu s;t0altnifcoadfptrlu sls trtoxo oy4lm  mnvtlt  Dumx ont1tet ii3tys m2emums;u0 rxnmfcoatoa  an ol()t2tr(m3iy1am emfct (f Dur(rpoo0opxn ietas s2rm(vsnt) lxrmo3iydlpDeau s s0setoxmpoydlmt lieilt artrxmp;t1olxnifeiasfsDulnmonu0trxomo oo1fa elu slt0srtoiopiudopeemfeiatfa2ua(m nt4oee if3ilt sDel(vp (4 etoifcta1oat aivils  exmio no1llt mivtlt)aDtmxr ;o0tpen ociyt m uln p;(4aexrmo3iydlmtranes;s s2uoxo3iu1olenlncsltfs2rax  ou1aeen fetls s2rmuvpnu0 rxniocoa1lmte i sl()trtrxr oydamte icta()a2umxmonu4altn ictytls2ulnms;(4tlxrmo3oo1oaDraneo;( t2xo(opoo1am elnvtl(  2rrx  nu1oeeoiieildfm2rm(msn(4alxnmo iodlat  u o (0 rtr(o io1omt  fvt t srraxm nt4optomi3iat sDra(vo t)artniociy1fm ranei;t) rtmimpiydom nlnes tf 2ur(rpoo0ole mieiat m ra( sn()artrxo3ta1fmDrlueils s2tm(m3iudlme livil(f ruru o;o1aeeo ietas m eluvs;u0tlenmrcoydlat lu o;(0 2umxo ou1lmeemiei sfsDum( o;u0altniicilt m2um(mon(4teermfcto1lm rliei ()sexrxmpoy1op nmivt sf 2ra(m nu1alx miciysla2umnmo (4trtnif ootoateln i t0t2xrxm oodam elivtas)a2raxrpoo0texo f3tytlm el(mp;() eeoio oo1lmtean o ( texrimpiydll e icilt)s2tmumpnt1tptoif3ildla2umuvsn()trxoxf3ootfm rln sl(0srxrirpoo1olt lnvt s) rrmurp;t1opeoiocildfs2eau s;(4arxnxr iadlateluvs () 2umxm oy1ome lfctasfa2rrurpot1aexn fciadlm rau s ()trerif3to1oateluvil(0 2umxr3io4am n fvi sfs2ur(rpoo0olenif3ias a rmnmo u4aetnmrctotfmDrauvi s0teumim3ny1omtn nvs t)srtm( ont1teto iciysfa2rmnvp (0alenmo3iotfaD anesl(0trxr(mpoodam elfciat)sDrr(mont0oex ifeildlmDea(mp;u0alxrmociy1lm e nes (  rumim no1ap e nct t aDtax p;o0aetomo3iasla2em( o;t) etrxf3oydlm elu sl()seuo(m iydop  lfctasf rurxmono4tex mi3tytfa2elnvs;t0tlerif3oydomDrau il( seumxr3oydap nmnvsasfa2taxm nu1tet iiciyd s eanmo;u0 lerxr tatfpteaivo (0teto(m iydolt mfcsatfaDta(rpnu0altn ieiytls2elu p u) eeoif io1opt  ues t)seuoxr3oodlm  mfvils  2ra(moot1oltoifeiat a rlnmonu0artnmrcoodla   i s;s seum(mpio4lme  feslt sDumumpou1apt ioctytfa emuvs (4 eerif3iadla rlnvil(0s2xr(mpiudaptemivt s)srrmxmonu0oltomo3tatfm2elu onu0teeomfcia1om rlnvs;(0 2toxopoydlmt  fci () Dtr(rpou0tpxn fetlslm2rl(msnt)treoxr ia1fate nes ()trtmio oo1altn iei ( aDurx oou4alxnmf3iatls2emn o;t0alxnmo3iydla ean i ()srurxo3iy4lme  ivt t arta(r oo1oltomieiysla2rl(vp t4tetoif iodlaDe n ols)srtmxo3io4am  liei t sDrrxroot0opt  f3ias s2ul( sn(0 leoio3oy1lpDrau s;()truoio oudlleemfcia(f rrmum ;u4tltnmf3iasfaDeaumo;u)arxrio3tadfm rln s;t0 rtrimpio4am emnvs t s2ta(ro;t4optnioeildla ranvpn(0 rtnmo3ty1om  lnvo t0seur(mpoo4ll  miei ( s2raumoot0tex iictlsfa emnvpn(4aetnir ty1fmt ai sls)truoio nydalt micil(fsruau p;o0alxo o3iad s ulnms;u0 rermrctodfa e i sl()t2xmxrpoy4alt lfcta() 2uau pno0tpe if3iltla ua( s u0artrxocio1latrauvolt) rtm(opiu4apt  fvi s srurxr nt0apxnmf3ildfa2emums t) exnircio1oaDeanvs;t  rxmxr3io1optelict s) 2raxrpnt1tptoioeildfa ul(mo;(4tlenio iy1faD lu o s)tetrim3oo4omtn neta() 2rru  nu0olto f3iatfm uaums;t) lxrmf oadoaDe uei;t  2tr(o oydlm nmfvtlsfartr(m ou4apenifeiadfaDrl(mp u4 lxoircto1om rauei;t  rxmxr3nodomeemfeiatfaDrm(m oo0tlx ii3tlsfmDul( s;t)tlxrmfcto1fptean s s0s2xrxrpou4lmenlivtasfartmxrooo4oltnii3iltlsDuaump u4arxrir iatomt  neo ()t2toxo nudop  mnetlt aDrr( pnt1tex ii3tas mDulu pn() rtoxfcoo1fp rauvo t) 2uoimpnydlm  lnvt t)aDumurp;t4tlenifeiasfmDemnmo u0trxoir3ty1fa  an ol(0texrxr3oy4llee fvtat) 2uau o;o0apen f3tatfs umumpn(0alenxo oo1fmtr neo s s2to(m ou1lltnlietatf rtm( pou0olx iictls a2rm(mp u4tlermrcta1lat luei t0s2toiopiy4llenlfcilsfa2rmurpnt1tle  ociasfs ua(mpn()texrif iytfpD anvil(0s2xoxopio1ole liesls)s2ta( p;u0apt mieias mDrlu pnt)trenmo3to1lat lnvo;s0trtrimpou4optemfesl(  2urump;o1olt mf3tatfsDumu s;(4artrxr3ootfptrlu olt)trurim3oo4lpeelneiat) rtmuroot0ale iieiytls2rauvp;()altnmrcty1laDeaies s0srxmir oy1open ivs (  rtrxrono4aetnmo3iadlm2elu o;u4 eerxr3ia1omtrauvi ( truo(m ou4aptelnei t  rumx oou0aptomfetaslsDelumonu4 lenmfcoadomDranvsl( teur(opno1lltemneiatf 2rr(rpnt1oee  ociadfa ua( p;u0altrmfcta1lm rlu ilt  rurim oy1optelnct s srumxmpnu4tpeo ociltfs2ranmo t0arerio ty1fp rlu o;s) rurim3iodlmtn nei sfa2urx  ;u1aex  fciydfm umnvsnt)texnmr3to1fatrauei;( t2xm(mpiudolt lfci t)a2ta(m ;o4tex  oeiadfs2um(ms () ltrif iydfm r n il( srto(m3no1lmee neias)a2tmurpnt1tleo o3iysls em( p;t0aexrxr3iy1lpDrln o s srtmxopiydole mnci t s2uax p;o4aeeomiciltls emuvs;(4 lxnir3oatomDe i ol() rxo(mpiydlp elfeil(fa2rmu p;u1olx iiciad sDrlumo;t) exnxo iy1fp elivo t)trxoir nu1lltnlnesltfarua(r ;u4oltn ociadfa em(ms t0 exrmo3todfmt lneo;s0setrimpio1omee iviat)arrau poo0tle io3iltlsDem(ms;t4 rtoxocta1fate nei;s  etoxr3oo4op   nvi t)a2uru  nu1aexnii3ias s ua(mpn(0trxrir todoatr ies t) exmxopio4omte feta(fa2taxmonu1tlxniiciytlm um(vs;t4 ltnxf3ootfateaivi t0t2xr(m nodomteliet (  2rmxmpoo1aeto ociat s2eau ont0areoxr oydfaDeau o ()t2umxrpiu4omt lncs () 2um(moou4oex mf3iltls eluvp u) rtrmf3tydomDr nvi;s)t2trxrpio1lpe mnvtasfsrrmu o;t4oee iictltfs rluvon(0trtoiocta1fpteai s;t t2to(rpoo4ale  net sf Duau onu0teeomoetltla2rlnms (0 rxnxr3oodoat  ivs ( t2toio3oodope  ictls  Drrum ;t4openmo3iysfa2rmumsn() eenircoydom e i slt)setoirpnydopenmfci t aDur(  nu4tpxnmoeiasfm2elumo;u0aeerir tytfpt lu o;(0 euo(o3iu1amenmnes tf rumurpnu0apx  i3tldlm uanmp u)trxrxrciodlatelnvolt tetr(opiu4lptelivia(farrax p;t1olx if3iysfs ra( o;(4 rxnmr3todlat aivo t  rxrxr3ou1oleemiviltf rrmum no4oet mo3tltfmDumn p;() exrmfciatfpD lnesl( srxmxmpiu1ll  mnviltfs2tmx oou0ale mociaslmDeln snu0 renxrciotlpDe u o s  2xmxo oudaptn nct ()a2taumono4olxn ieiatfs2ulu o;t0aetrir3iotopD  ieslt0s2to(m3oudol elivt tfa2tru pot0oetnmfciatfa ul( snu0tltnmociydom   ivo (0srur(r oy4alt livtl(farraxrooo0oeen ieiatfmDumn p;u) lenmfcoytopDe ivi;s)setmxm3iy4opt lieil(f rtmur ot0aexoio3iadfaDrlump;t4aetoxo3tatomDr nes ()trtmio3oy4lmt  nvtas)srtrur ou0aetoiieiltfsDea(vo;() rtnirctadlp   nvsls t2tmimpnudom emnvil( aDtaxmoot4tltomoeiytfmDrmnmo (4 rtnir3iydop e nvs s t2uoirpoydll elivtls)a2ur(rp;o1aetomieiasfm rauvs;t)trtoxo3ia1fa r nvsls seumxo3iy1omtelncsat s2ra(roou4aet mieild mDemump;t0alerxocio1fp  ai s s)s2umiopiodlptemictl() 2rrxm ;u4aeeoioeiat m2ea(vp ()aleomr3tydomDeln s (  2uoiopnu1llte neslsfa2rr( onu0aexo ietltlm uau s (0 etnmf3tadfp rln i s  eurxo iy4ap  lfvt s s2ta(m no0tptomo3iat mDrau sn()tlxoxf3iydla r u s;t  rtoxo oodlm n nvt t)arum(rp;t4alxo oetat a2eanvsn(4 lxnmrciy1laDe nei s)srtoio iy1lp  licils) 2urxmpou1apen i3iydfaDul( p;t4aetnmrciodlp ean s t)s2urxr oy4am e fvil() rtrx  oo4aetomociat a rluvp u0 rtrxf3tadlateaueols) 2xo(rpiydamte ict t aDrru oou1tpe  iciysfa rm(mon(0artnxociotlmteai s;t t2uo(m3ny1lpeemfctlt)s2taxmpno0opx iociydfa uan o (0artrmr3tadfpt lues t0sexmxr3iy4am nliei (f Dta(  nu0apeoii3ils s eaumo u4 exrioctatoaDraivs;s t2tr(r iy1omee netls)a2tr(rpou4olxnmictatfm2ranvsnu4 reomr3ootla  aneilt  2uoiopou4amen fvtat srtaxmoot1opxnii3iysla2rauvs ()altnif ia1omDeanes () rxr(r3nu1lpe mieilt) rrm(r no4apeo ociyt mDumu s;() rtrxrctadomtraiei ()teurio3nodlp  lneilsfarrruronu1tptniociyslm ulnvs t0trermf3oodfpDelnvi s trumirpoo4amtemfetls srra(rpoo1oee if3tysfm2umnmp u4 lxoifciatlpt ai sls0 eur(m nu1om nliesas  Draurp;t0tpe ioeiat aDrmnmo;(4alxrifcoydla rlivolt)s2toxr ny1lpt livsls s2ur( pno0apenmo3tlsfs ulnvo (0teeomf tytlmt  n o t setrxopno4op n nctltfsrumuro;o4tlto o3iat m2emuvp;t4 rtnif todlpt luvsl(0seurxm io4am elnvsls s2rax pot0aexo iciat m umumon(4tetrxo oadomtrlu i ()trxoirpnu1lpt mnvt sf 2urxrpot0teen i3tld m2ea(mo;t0altoxf3tytlp  luvsl()truo(r3oodop   ivs s  Duaumooo1aeeo octydla2ea(mpnt4aleoxr3iytfp elnvo;s0setr(opnudamt lnvi (farrmurooo4tpxoioetytlsDra( o u)arermf3oydlpDe ueo s0 rtoxrpoy4ape mivtltfs2tr(ronu1teto o3tadlm2rlnvpnt)trxnxr3tytfptelnvils sexoxo3no4op eliet (fs2raumoou4alenmiciytlmDrau s;(4texnmo3totfpDrlivi (0 rum(rpou1lpeemncta(f 2taxm ot0tetomfctlsfs raums;(0trxnio3iy1fm   ivs t)t2toimpiu4om nlnei s) Dtmu o;u4aetn ociydfsDum(mp;() eenmo ty1la  ai ols)trxrxopiodlmen fesas)arrmxmpnt4opto oetldlsDemu s;(0 etoir ty1lp rlnvsls)teurxmpio4op   fes (fartrxmoou0aleniiciadfaDel(vp u4 renxrctodop r n s;s0trxmir nudame mnctasfs2taumooo4tltn ociasla rmn ont0 rerio tatla   i i;t0 rtmim3oudll emnviatfs2urx  ou1alxomictad a2ulums t4trenio3ta1omD  ueols0sexrxm iu1omt mnesat a2trx onu1apeoifctat s umuvs;t0teeomrcoa1fm ean ols) rtoimpou4amtnmfesatfsDur(mo;o1tpx iiciadla2eau s;()teerxf3totfptr iei t  2trxr oydopeeliei t)sDtruroot1oexn ictyd mDeaump (4 eeoxr3io1fa r i s;s) eur(r3no4om nlnct (fs2tmumpno0tpto fciysfaDranvs;t)aleomr ia1op r ueil()tetmimpou4llenmfcsatfsrtmu oot1alxnmfeils sDrl(mp t4 rxnircoydfatrlieilt0s2uoxopoy4apenmivsl(fa2rmu  ou4altnmiciltfs2emumo t0arxrxrctatfmDeli olt  rxmiopny4lptnlncs t)s2rrxro;o0oet  icils a eanms;u0aeerio iadlatraiei;(0 euoir3oydll e fci t)sDua(rpot4tpe  fetas mDean s (4trtomf tytomt luvi ( s2uoxo3iudllenlfvsasfa2tau pnt0oexnioeiasla2rm(mo;t)alxoxo3io1fp rluei;t s2trxr nodap n nesas aDumu oou4tlxn i3tytfs eauvo;t)alxoiociytlptelu ilt)t2toio iodlmee fcil(faDtru p;u1tlt  feild aDeluvsnu)tlenmo oytom ranvs (0s2xmiopny1ap n ieiat  Dtmu onu4olxn o3iat s rm( snt)tlenxfciodfm   ueo;t) exm(m iydamtemnvt s s2rrxmooo1oleo iciys m rlnvs t) lermf3ootfptr uvs;t) 2tmio io1op nmfesls arururpou4tle  icildls el(vs;u0 rerioctydlp eauvilt)truo(m3oo4lltelnvtl(  Dtmxmooo1tet mieiysls umump u4 ltnmr tadopt anes;s0 euoir iodop n fvsl(f 2tau p;t4oeen oetad s ulnmo;t)artrxfciy1fp  ai i s  2uoxrpnu1lpt mieta(f rta(  ou1tpe iietadfmDeluvs;u4aeenmf3ootlatraneo;s0setmio3iydap emfvt sfsrum(r no1tpx  iciyd m2eluvp t0 lxnifciatfp e ivslt0 rto(r ou1alt lfetasf 2umxmpno0oeto o3tlt m ua(vsnu)artrxocoatlmt  ues t)seum(rpno4lm nmfeiltfs2uauront1tpeomoeildls2umnvs u)tlenif3tydop  au s;s  rtmir oydlle  ivs ( aDrrxmpoo0optomoeiyslm2ra(ms t)aetomfcoydomt luvo;(0teurxo3ou1aleelfes sf Drm( o;o1olxn octld s uluvo t0 eeoirciy1oa   n slt) rxoim3no1oleemfcia( srtauroou0tee moetld s umn on(4 rerxrciydomt  n s;(  exoim io1lle mict (f rtmx pno1tetoiiciys aDelnvp;u0tlenxf iadlm   ues;() 2xmxmpnu1apt mnct ( aDtm(r nu4apxomo3ild sDrl(mp;u0artnmoctatlp ran s s tetmxrpny4ll nmictat) Draum nu4optomietlsfs uauvo (4 lermf3tydoa eluvs ()s2ur(m nudom elict tfs2urxmp;u1alx mieiltla2raumon(0tlxoxf tadlaD anvs;(0s2tmim3nudlm e ncslsf 2umum no4olxomf3iltfm2ea(vpnu0trerxo3iodlmt  n s;( s2tr(o3no4lp  mnvils)sDrau pot0tee mfeilsfm2ea( p;(0teenxf3ootfmD auvi ( s2tmir iu4oltelncsl()aDtr(rpoo1alen icildfmDrmumsnt0 reoxo oy1lmDrauvs s  2toir iudale lieslt)a2rmx  no4tlenmoctytfmDrmums u)tltoif3iatla elu i;t) 2to(m io4apen ics () rur(mp;o1tlxn i3iydlm2em(vo (0 exrmf iodoaDrluvs;()sruoio nu4lpenmncil()srtr(m ou0opxn o3iasfs emums t4 ltoif3ty1lptranei t texr(r oydomeemfeiat  rumu o;o1oex mo3ils aDem(vpn(0artnmrcoatfpDr uvi;(0 rumxo oudaltnmnesat) Dum(  oo4tetoif3tlsfsDrau o u) renmrciodfm  lnvslt0s2toxm oo4olt  fvsl( s2trxro;u1ole  oeiytla ulnms t0 exnio3iy1oaD aivi t s2tr(opnu1om  mncsas) rrmuroot1tpenifciadla2emuvo;t0 ltrirciadopDeai o s0trurxm oo1om   nct s)srrr(r ;t4opeo fetlsfsDrmn o t4trenxr3oadlmD  u o;t0sexmxm3io1op elncs ()a2rrxmo;o0opt  i3iys m2ra( s u0 eerifctydoat anei;s  rtrxm iudlltelici s)arrm(  nt4apxomfcilsla2um(mp (0texnir3tydlpteaieo t0seurxo no1omenmicilt) rtmu  nu1aee  i3iytla2umnvonu0aexrioctytfmteli i t)teumimpiy4lle  fvsasfa2taurpnt0aleoioeild aDem( snu4artnxrcio1lmDe uvi s  rxoim3nu1op  licsat aDumur oo0tleo o3iysfs rm( ont0 leoir3oytlmtrlneils srurirpiy4opt  icils)arraumpno0oltoio3tltfmDraumo;(4aeerif to1fm   nvsls) 2urxr3oo1altemfci () rra(mo;o4aet mietydls rm(monu0teermf oydlaDrau sl( teumir3iy4olte ics t) 2um(r nt4tlt  o3iytls rmuvs;u4tlxnxocoatlateln s (0s2xr(o3no1ope micsl() 2tr(rp;o4alenmf3iysfa2uluvpnu4alerxo oydfm rlneo;s) ruo(r3nu4lm n fcs ()arrrurpno1opeoii3iydla2umuvp t)aeeomo ia1oatr ivs;(  exr(opiu4aleemfciasfaDurxmpnu0aleo ieiadls uaump;t4arerif ta1op   i o (0srxrir iodap emivsas)a2rru onu1olxomf3tadlsDrlnmp;u0tetnio3oytoa ranvo () eum(opny4am  mfetlsf rraxmoou0aptniictlt s el(vo (0aeeoiocootfpteln o t)t2xoxm3nu4amtnmfeiasf 2urxmont1aex io3ilsfa2rmump (4altoxf ootom  au slt s2to(o ny4amee nvils a2ua(r ot4apxn fctytla eanvp (4tleomf3oodlp eaivslt t2trirpiy1llenmncsat srtrxmpnt1aetoio3tlslaDul( snu)aexnxo tadoptran o t) rumirpou1amen netas  ruru ooo0tpx ioetys s uluvo t4aetnxocta1oa e n s;s0 etr(opno4amtelies s)aDum(m nu0tleniociasfm uln o;t)treoxf oa1lmt aivo s0sruoio3iu4oltnlnci s)arrau ont0tlxoio3iatfm rmn s (0altrmf iydom  anei s s2trir3oydlme mneta(fa2ta(moot1tltoifeiasfa2ea(msnu0treoifciatlp eluvi;t)trtm(m nydole lfvs ()srrm(  no1apenioetydfa2ea(vp u4altoxo3iydlpD lieo ( t2xoxo3oy1al   ncta(fartru  ;o0tpx mfcils aDrau o;t)tltoio3oydlp   ueo (0t2um(r3nudllt micsls s2trurono1ope ifeildlm2ua(vp t) renmfcoy1opt  nes;s)srtoxr3no1lm n icia(fsDra(mpno0aex ii3iyt aDeanvonu) ltomr iydoaDrliei ( sexm(opio4omenlnet ()sDur(rono0tpx mieiltfs2umnmp u0 rtrxrciotfaDe uei;()trxo(m oo1olenlfvsa(  Dtrxmo;o0oee mieiltlsDrauvo;() exoxrctydlpt  ieo;() 2urim io1op nmncias)s2rmumont1aeeomocilt a2eauvo u) renmr3oydlatr nvo t)s2xoxo io4olte ivtl( artmxr oo0aptn ictadlm2ua(vpn(0trtrxfcoy1fm  lnes;s0s2xmim3nu4ol eliciat  rumump;u4aet ii3tydlsDrmn o;u4 lxnxo3oa1fm rauvi s setmimpno1am nmicil( sDur( oot4opxn o3tltfsDuanmp t) etnxfctydlaDrluesl(0 2xo(rpnu4ape lietatfsrrr(mono1tpx  octytfsDeluvsnt) rxoxo ootoa  lu ol()texo(r3oo4llenmivs tfarra(r no1alx mieiyd s umu s;()altnmf ty1fa rlues s0s2toxo ou1ll emivs sfaDum(r nu4tpt mf3taslm2el(mp;u0treomrcio1lmtr u o;s)trum(m iu4altnmnvslt  Drmu p;o0tet mfciadlmDean s (0 exnxociy1la rli s t)teurir3ou1alee nci tf 2ta(m ;o4tpen o3iltfs2rlnmonu4 exomoctodoat au olt trxrxopoo1lm emfesatfs2tax ont4alt mf3tltlmDrluvsnt4tlenif3oadfm   ues;t)teumxopiy4lmeemivi (f 2rr(mont4ale ifciys m2ul(ms;t0aexrmr3tytoa rai ilt0 2umxm oy1ll   ici (fsruaxro;t1tlxniocilsla2rauvpnu4alxrif oa1opD  neilt teurxrpnu1ol  miesl(fsDtaxm ;t1oex io3ilsfsDeanvs u4 rxnmrciydlaDe u i;s t2tm(m oo1apee fvsl( aDrrxr oo0tptnmi3ild a em(ms (4 exoio3tadomt lnes t0s2trxm oudalt  feiltf rtau  ;t0oexniietas a2rmuvpnt0tlxrmo3iytfmD lnei;(  exmio ny4ol nliei (f Dtaxmo;u1oleo fetadfa2em(ms;u)arxrif3tytlmDr ies t)srurio iydam  mict (  Durxmoou4tpenif3tlsfmDeanmo;t)arerxfcio1la ranvsls) exm(r oodllt mnesat s2raur nt4aeenmfeiatfmDea(vsnu4alxrmf oydfa eluei;s0 euo(m io1am n ncsl(fsrur(r nt0tleniociltfa rl(vonu)texriocta1fa eaivsls)tetoim no4llenlivsat a2umxrp;u1tpt mieiad s rmn snu4 ltnio iydla  lueol()truoiopou4altelivt ( arrmuront4tetoiietydla elnvo t)trxnmr3iydlm e n s t0 2ur(m oydopenmivil( s2trxm ot0tpto iciaslm2uau o (4aetrxr3iydlpDeluvo t0 2ur(m iu1ap elfcs s) 2ur(rpnt1oltnmociysls2rau p t4 reomr io1fm e u o;t) exr(o3iy1apen ivslsfsrur(mpoo0oeeoiociytlm rm(mo t4 eermr3iodop  lnes (0 2ur(opio1omen fcslsf Dur(rp;u0apeoii3iadfaDemnvpn(0 rtomrcia1lmt luvi;t) 2trim no1optn nvil(fa2ur( p;u4oex mfctatfm2uaumsnu0tlxnmf3oatfp elivi t s2toio3ou4amen ivtas) rrmur nu4oeeo feiysls elnmonu4aexomfcoytlmteauei t s2triopou4am n nvtl( s2uax pnt1olxomociydls emu s () etoxo3iotla  ai i t)sexmxrpou4am  lnvi t)arurumpoo4tptnifciaslm ua( s;u0 etnxo iytfp  lnvilt)t2ur(o3io1ol   fvils)srur(m ou1aetnmi3tyslmDrlnmpnt0aetnmfcoadfaDrlnvo t0 eur(opny4alee fvils)s2trurpnt4aleo octys aDuan s (0treoxocoatlpDelnvs s srxrir io1al emivta(fsrum(  ;o4olx mfctasfs2eauvp u0 lenmfcoodoa ranvsls0teurio3no1opeemivtas aDtmumo;t1opt io3ild aDeanvonu0 rtoir3ty1lp   nesl() etm(m3iy1opt  iviat  Dtr(  nt0aleo fcilslm ul( p ()tltnmf3oydopD liei t sexoio3io4olt mnes (farrrum ;u0aex if3ilt aDrm(vs;(4tlxoxr oa1lptr ivils) rumxr3iy1llen icia(f Dum(monu0tlxn o3tat sDrau p;(0alxoxfctodfptelu o s  2urxopoudop elnvs sfsrra(mpnu4oeenifciyslm2emnvpn(0aetnif3oydfmDraieo;t)sruoiopnu1olte fvi t a2trxronu4olt if3tldfmDrauvs u) lxrxocoo1lptrli ils)tetrim3iy1al nmiet t  2umurpno1apxnifeild m2rl(vpnt0tlermrcoo1fmD anei (0trtrxo oy4alt  fcs tfaDtmx onu0altn icilsfs rmnmo t4alxoif3ty1faDr u i;s)srxo(m3ou1omenlnvs (fsDumumo;t1oeeo feilsfmDea( p;t0 exrmr to1lateau s;()s2xrio3iu1llee ivsl( s2ra(ro;o0apxo ictlsfs raumo (0tetnmfctydlmD ai i;s) rum(o iu4lmtemnvi () rtmxr oo1ope iiciydfs2um( s () rtrxoctadop   neolt0s2tmxo3iydalenmnei t)arrrx o;u4tpx if3tyd m rl( pnt4aexnxr3ootlmteluvol() rum(o3io4aptemnct ( s2tm(m oo0ole mfeiydlm ea(vsnu)alxnxoctydoptelnvs;()t2trxm3nodape  ieia(  Dra(rono1tetoifetlt a2uanmo t0 eeoifcoydoa eaues;s) 2ur(opoudaptelfvtls aDtrxro;u4alx iieiatfaDrlnmo u0alxrmrctatfp r n s (0 rumxmpiu4al elfeslt sDrm(moou1apxoio3ils aDumn s t) etniociodoaDelnes;s) rumxo3oo1ame mictls  rumx pou4ole ioeiltfaDea(mo u)aeerxr3tytfpteauei t)s2to(r3ou1alee fciat) 2uru o;o0alxn i3tatla2um(monu0teenmocoydomD  ieilt tetrir iudomenlfeil()srrau ooo4aeenif3tadfmDuauvont0alxoxrciotomtelivo;s0truoxopoy1om  lneiat)s2rrxm no0tetoifeildlsDrlums;(4arxnmf3oatomDraivsl()t2urio ou1lp n fvsa(fa2rmxmono4aetnmf3iatfmDea( p;(4 ltoio ta1opDr nes;(0tetr(mpno4omte fcsatf rraumpnt0altomietldfsDeau snu4aetnxf iadop  luvsl( t2toxr3iydoptnmicsa( srtax pno4altomoeilt a elnmo;t)altrio3tytlmte i o;t0 2toxrpiudlm n ics (f 2umxr nt1tetomietyt sDrmn snt0aexnio oy1om  au i s0sexmxmpnydaptnlfctas  Dra(r oo0tpeomo3tatls umuvp;u0 rxrio oa1lmDrlu ils seuoxm io4alenlivs s)sDta(m no1olxo oeiyt s2rlu p t) eenir oa1om raieils t2xm(m3iu4oltnmnvsa(  Dtmxro;u4apeo o3tys a ul(vo ()trxrir oa1oa   n o ( truoxo iu4op n feias)sDta(  oo1tex  ictltlaDemnvpnt0 etoio3to1fpDeaneo;(0 exr(m oo1amen feiat)sDrrumo;u1oee mfcild s2elu pnt0tlenxr3todomDeaies ( seumiopou4op emiet (fs2tau  nt1opx ii3iatfm2ra(mo t)texoxf oodfa  lu o t0t2uoxrpio4ap n ivs sf 2rrxr ot4tetn ociydls rluvs u) reomf3oodomD  nvs t) 2xmxrpiy1openlics s)a2rau pnu4optnmi3tadlmDrmu onu)arxniociotomDean s s teurxmpou4om  lfvias)srtmxm ot1tlxnmfeils mDem(vs (0 rerxr oy1fmDr i o () 2uoiopnu4al emnvtat) Dtaurono0oexo ieiadla ul(vp;u)tetnirctodoate ueols)trtm(r oydlmtemnci ()a2tm(  ou0apenmo3iadla2eluvs;u)alenxr3oo1oa elues;s)t2um(rpio1amtnlfvt t)aDrr(r ou0tlxn oetatlm ua(vp;t0altnmr3tatoa rlieo;s)t2umio nydlp emncilsf 2um(ro;t4olxomieias m2umnvo;u4 lenif3iadom ranes s0t2uoimpio4lm elfeilt  rrm(ro;o0opxo i3tyt m umnvsnu)trxnio oatlpD  nei (0t2umim3iu4lle livs t)sDrauro;o1aee moctatfm uluvpnt)altoif todomtr uesls0tetrxr3ou4ole mici ()a2ra(m ;o4aeenioetytls2eln p;() ltrmrcoatlptr uvil()setm(opou1ameelnct ( a2ur(mpoo0oleniictasls em(ms u0 eenircto1fp eai i;s0texm(mpoy4optelnetl() rtaxroou4tee mfciadla2rm( on(0 rerio oa1fa rluvol(0t2xoim nudal  mfvtlt aDrau pnt1olt mfetldlsDua( pnu4tltoxo3oydfat  ivi;()trto(r3io4open ivil()srurumo;o0apenio3ildfa emumonu4alxoxrctydlaDr ivi (0t2xmio3ou4op nmnvi ( sDrmu pot4tpeomociytlmDul( s;t0aeermr3iadoptelu i ()sexm(m3iudlm nmnvsls) Dumurpno4tle  ieiydls2uau ont0tlerxocoatlpte nes s)srtoim3io4omee nei sfs2um(  ot1tetoioctldfa2um(vp (0arenmociadlmDe u i t  rtr(mpnydapt  ivtlt) rurx  oo4oleomi3iat s2ul( pn(0 exnmoctodlm e nvo;(0t2toim ou1oltelfeiasfsDtr(ronu1aptnmf3ild sDrau p (4 rxnxo todlaD  nvi t)t2xrxm3iudlm nlnvias)artm( pot0oet iiciad m2ulumo;(4trtrmo3tatoatrluvo (0 rtoir3oy4amtnlnes () Drru  ;u1oee  o3ildfm el(vp;u4trxrio3ootoa rauvs;s tetrxm3ou1ol  lneils sDuaxront0alxniiciysfm ra(vo;()aeerxr oa1fm   uvs;()s2uo(r io4am  lfei t)sruaumo;t1tpx  iciad sDua(mp;(4tlxnir iadla ean i;(0 2xrxo3oy4lp e fesl( s2rmxmpnu1apeomoetatfs ea(vo u4tltrir oadoat luvols0t2toir oo4openmnctas)sDururpoo4oex  fetlsfmDuln on(4aetoir3iotlm e n i;t0srtrio oy1apenmietas s2um(rooo0oltnio3iat mDrlump;()alermo3io1fmDeau i s)trxrxo oydole  fcs ()aDraxmp;o0teeo oeiat s2ranmonu4 etnmf tydfpDeau s s)t2to(rpiy1lptnlncs ( aDtmxr nt4olxoif3iat mDrl(vs;t0aexnxr iodfa eai o;t0trtr(mpno1op   fvilsf rrax  nu1ape  ieiadlm2ulnvp u4aleoxf totfpDrlnvo (0 exo(rpio4apte fvtl() rrmu  ot0tpeoiiciys sDrlnms;t) eerio3iy1oatelueo;s trxr(opiu1ol nmfvs t) Drrumo;o1ole mi3ilt a el( s;t0 lxnxr3tydoptelnvo ()trtmxr iudlptemfcs ( aDra(mpot0tpx  f3iyd m um( p u0 renxr3ootfaDelu ilt0setr(m oodlp emncs tf rum(rpno1tpe mfctlslm umnmo;(4tlxoifcootfmD  i ols0t2um(m ou1ol e icta( sDtrurp;u0tpe ioctadfa ul(mo;(4alxnxfcty1fateaivs s0srumxm3iy1llt mfes t)aDrm(r no4oee iociysla ulums u4 rtnxr oatlpt an i ( srxrim3ny1omt  neils) Dtr(r ;o0tpt mfetatfa rau pnu0trtoiocoodop elnei;(0 exm(m nu4lp   nct t) Drru pno1openii3tasls rlu pnt4 rtoxrciy1lmDr nesls)t2um(m no1alee icia(fsDtr(  ou0aetoiieiytlm2uaumonu0aetnir io1oaD  nvsl( texrio3oy4ap  mneta()srraum nu0olx moetatfa2uln o;u0arxrif3oadfptrli i s  rxrxrpio1open ivtlt  2raumo;u4oeto i3iadlsDel(mont)tetomrcto1fm  auvi t sexmxm nu4lmeemnvslsfartax pot1ape mieiys a2uluvpn(4texnio iodomtrlieo;t) 2tmim io4apenlfvtas) Dtmurpnt0tpxnmo3tydlaDul( s;(4 exoxfciadfmtr uvi s) 2tmxmpny4lle lfci (farra(rpno1aetomo3iydla rl( o u) eenifciydfm  auvi;s trtoxopoy4amen ncsas) Drrumpot4aexo fciydfa2em(vp () exrmo3oa1omte uvo;()teumio3iodolen ietasfsrrm( ono1olen feiadla rluvon(4alerir3oydlmD  uei (  rumxrpiu1apee neia(f 2rauroot4aetnifeiyd m ul(vp;(4teeoir3tydlpD  ueslt)t2uo(o ou4amtnmfetlt  Dtm(r ;t1oet iietydlm emn s (0 lxrio3tytoptrlnvs;t0 rum(r iudll e nct (fa2ur(  ou4tlto fcild sDea(vonu0tlxnif3tadlaDr nei t  rxmxmpny1ll n feslt srrrxmpou1aeenio3iat sDea(mo u) rtnmrcoatfmD  ivs t) 2toxrpnu1amte ncilsf 2ua(r ;u0tetoif3ildfm2eau s;u) rtrxf3oadop rlu ilt0srxmimpoodlltemiet s)srrmur ot4tlen ictlt aDea(msnt4aetoxoctodla  ai o;(  rto(m3ou4apeelncsas arraxrooo0alt iociatfaDua(vo t)trtnmr oatopDeluvol(0s2xoxmpnu1lme mivta( s2rax pnu4tltomf3ildfs umn s;(0tetrmrcto1omDeaivslt)seurxo nu4amen fetat) 2raump;t0teen oeiydfa2emn snt0 lxrmrcoytlpt lu sl()texo(opou1lmee iet sfaDtmum ;o4aee ioeiydfm2el(vpnt)teermr oy1lm r i ilt s2xrxrpno1omt licsl( srurxm ;u4ape  i3tyt s uanms ()aexrmr iytlmD lu i;s0 2tr(rpoo4lpte fei tfsrtmu  ;t0oee  oetydfs rm(vpnt)treoirciytlptr u o (0teur(r no1lle lnciat)a2rmuro;t1apto feiadlaDeanvp t4 rtnmr iodfpDelieo ()tetoxr iu4lltelfesls) 2ua(r ou1tex  f3iytfsDuln snt)aeerxf3iatoat  ivo ( trxrirpiy4al nlnvsasfaDtr(m ;t4altnifeiysfaDemnvo;(4aexomrcia1fptean i;t s2toxmpnu4am nmici (faDuru  nt0oeenif3iydfs rl(vo;u0 lxomo3iadlpDe uvs;t s2trxmpnudole mnci () rrru o;t0tlt mi3tatls eanmont4 ltrircoo1fmD au s t0 2uoir3ou4lltemfvi t  rra(  oo4olt  ociysls2el(mpnu0tltrioctydoptelu o;s0 rxr(rpiodalt lfet sf 2ra(  ou1oee mi3tat s el(vont0 renmo oa1latrlnvs t)trxoim3nu4lmee nvsl() rrm(rp;t0tptnmictaslm umuvo;(0 renxfcoo1fm ran o;(0t2xmir3iu4omeemiei s a2taur no0tpxoif3iasla2eauvs t0 ltrxf3iotopDrluvi;s setmio iodamt mnei t)srtaxrp;u4optomoeildlm em(vo u) ltoio iydlpt ln sl(  etm(o3io1alt lfci t)aDrr(mp;u0aexomo3tls mDrlump u4 exoxr3iy1fa eaivo;( t2tr(r nodaptnmfet s sDtaum ;o1tle mieiltfaDel(ms ()texoxoctotfa   nvslt) euoir3nu4lp nmfct tfaDtrum oo0aexo o3tat mDul(mo u4texnmfcta1faDeln sls0srxmiopoydlpenlies tfaDtm(ronu4apen iciadls2umu s u) ltrxf3oy1lmte nes;s) 2uo(o nodamee fvsl()arrmum ;t4ope iicils m ua( s;()arenmr todomDelnes;s0srxr(m3oydam   ivta(  2rmu  oo4aexomictatfmDum(vont0trerxf3iy1opt aivo;( teumimpiy1ope lieia()arrm(ronu4tlt ifciatls2rmn on(0 reoxf iadfmDraivs;s)seur(mpnydalenmicslt sDur(rooo1openmfetytfs rlu o u0aetrif iodfaD anvo t0 etrxm ou4am n nvtasfsDua(ront1tpeomociltfmDum( s;u)trenircoy1lmteaieo t)trtrxm3oy4oltnlfetltfsDuru o;u4texnmfeilslaDrl( sn(4tlxoxr iydomDr u ilt trumxo nu4ame mnciltfsDumuro;t1oltnmo3ias sDrmnvpnt0 exriociytoptrluvi ( srtm(m3nu1om emnct t a2taurp;o1aleomiciys s ra(von()texnmf iotfaDrauvi ()setoxo ny4om nlnet sfa2rmuroou0oetn ieiydlm2ran o (4 ltrmo3iodoa e ivs (0texoir io1ale lnetat  Dumxmp;o1alx  f3iysfm rmums u) rtrmr to1lmD  u o (0 rxrim3nu4olenmfvsa(farrmurooo1opx  o3iadla2rlumpnu0alxrif3ia1oaDr u s s seumxo iydal e nvsl() 2ua( onu4apx  f3tas s2um(vp (4teerifcoa1fpD an s t)setmxo nu1ame  iesa() Dtrxm ot4opto fctad m2uanmont0tetnxr3iy1lp rln sl() euoim3nodolenmicsat)sDrmx ont1aleomfeiys m ea(vs;u0trtrifcoadla eli olt  rurxm io1om   nvi (fartmxm ;t4alxo o3iys s2ulump;u4 rermf3ta1fmtelues;s0truoxr nu1lme mfviatfaDtmxr no0oetnif3iysfsDeaumon() rxnirciatoaD ai s t) rxoxm oodolee nvt tfaDtau p;o1tee  ictys sDem(mpn(0texoifcty1omteaivo t0srtrxm iu4opt mivia(faDraxroot4opt if3tat s2em(mpn()trtomf3oa1fa  auei s0teurim3iydlmtn ncias)srur(rpot1openmiciysfs2rmumo u4 ltnmfctotfpt  u sl( s2urio3iu4op emnvsat) 2uru pnt1aeenii3tatlm eau onu) reoif3ta1lpDe nei ()teumio iy1amtnmivi s sDtmu o;o1tee  feias a rluvon(0tltnxf3iadopDeaneo t)s2trim3ou1opt lncsls) rrm(m ;t4tleomoctytfsDra( on()trxnmr3iodopt lu o ()t2uoimpoudam n nvs ()s2tm(  ;t1alt mfciyslmDumu o;()tetrxo iadfp  li slt) etoxr3iodlmt lfviltf Drmu p;o0tex if3iltls2rauvo (4arxrxf totoptelnes;() etmio3nu1altn fesasfarrr(ro;t0opxnmoeiasfs2umnmsnt4trtnxo iadfaDr u s;s) 2xmiopnu1amtnlicils arrrxrpnt4ole  oeiys sDraumsnt) lxoirctodlaDeaiei t0 etr(m3iy1llt mfviat)s2umu  no4aex mfeiad s ua(ms;() eeoif3oo1oa  anvo s t2xm(r3oodom  mfvt t) Dtaumpnu0tet mi3ilsfa2rauvs t)alenmo3iytop e neo t)sexo(o3ou1openlivias aDua(mpoo4oetn ocildfsDeau snt4aexrmr3tytfp  aieo;()t2xrxo iu4llenmncta()sDtmx p;t1tlx ifciadfm uln ont0aleomf3todoateauei s)sruo(rpoy4omtnlfei tfsDraumonu0optoii3iatfmDel( sn(0altnmfctadom  luvi ()tetm(m3nydam   ncsl(f 2ururpnu1aptniicias a2ul(vsn()aexoio3oytoptr nvi t) etrxrpny4lp emfvt t artrx pot1aetnio3tad s2eaumo (0 etnxrctotlaDe ivi t0s2xr(o ou1lptn nvt t  Dua(rpno4tpe io3iadla2emumsnt4 rtoxr iydfpDelnei;t  eumxm nydoptnmfctasfaDuaxrpou4oexomicildla uaumo t4 rtoir oydfaDe ues s) rumio oodllenlfes (fa2tmxmpoo0texnmfeiytlsDrm(ms t4altrmo iodlm elivo;s)trumxm3oo4olt lncia( s2tau p;t1olenmfciys mDul(ms;t0tltoxo ty1latraueo;t) rxo(m oo1apenlfetatf rrau  oo1aexn iciytfm2ra(vp t0arxoxrctytom  au olt0teuoir3iu4omt  fvt s s2rmurooo4tle moetys s2rauvon(4tltnmf todlp raiesl(  2xrio3oodlp  lfvsltf ruau  ou4tpenmf3tatfsDeanvs;u0altnxf oy1lmDeau sls sexoir io4lle livtatfartaurono4tpxn iciad a2um(vo (4 exrmf iodfmDe ivi;s  rxoxo3ou1ope  fcs t)a2urxroou1opxo oeildlmDum( o u4 eenmo3iytlpDrli ols)teurxm3iydap emfcia(fa2ta( oou0opxomf3ils m2rm( o (4 rxnmf oadlm r ues;s) eto(opou4lme  fvi () 2uaumpnt1alxo ieiadfsDul(mon(4aeeoxr3tydfa rai i (0srxr(opio4ll emfvtlt  Drm(m ou0aptnmf3iyd mDumu s u4 ltrmr io1fmDr nvs t s2urxo3oy1ome mict (faDum(rp;o4apxnii3iltls rmnmo t)trxnxr tatfptrluesls  exrxrpnodalte fcs (faDtmxmp;u0tpen f3iadfs uan sn(0 eeomo3oo1op  an s t)srtoir nu4opeemivi () rtmumpot1oet mi3iadls rm(mo;(4 rtoircoy1omtr n o;( teumxm3iy1opt  nvi tf rrrurpnu4opt mictydla em(vo;t)tetnmf3iytlat  uvs t)tetmxmpiodll  livtltfarrrum nu4aee mo3iydla rl(vo u0aeerir tydomteluvo t0 2xm(rpio1lme lncslt)srumxm oo0opxn feiytls em(vsnt4 ltrmf3tatoptelivi s0srxrirpny4amen ivsl()aDumxm no4alxoio3iyd a2emuvs;(4artnmo3oa1omtr n ilt) exoir oy4ame  fesa()aDrrxr ;t0teeoifeiltfa2um(msnt4 ltrxr ootlmD aivi s) 2tmimpoudalenmfesa(fs2ta(roou1oexo fctat sDel(msnu)tetnir3iotlp raivs;s  2uo(rpio4lpee ncsls) ruaur ;o4alt iieiys mDumnvo;u)aetoif3iodlpDelu s t  2toxm3no4ap emfvslt artaum ;t4aeeniiciltfsDrmn s u4treomf iotfp eaueilt)seumio nodll nmncia( a2tmx pot1oeeomociyslaDumu sn()trxnio3oadlmtr n ol( seurxopno4apt lfeslsfs2ur(r ot4oexoioeilt mDumn p;t4 rtoxrcoo1fmteli s ( srtmiopiodlpeelici ( aDtaxmpnt0tex ioeiasfaDuau s;t4alenmo3oadfmteluvs () exm(mpnu1lm e ivt s arraxr nu4tlx  fetlsfmDelnmp;t0aetomrcta1omteauvsl()trur(opoo1op nmfviat)aDtmx ono4open ietadla2rauvp u) rxriocoydfmt lnvsls seuo(mpoodam e ies ()aruaump;t1opeomietatls2eluvsnt) ltoif oo1lp eaivo;s)t2uoxo3ou1olt lfes tf 2rr( ooo0oet mf3ildfsDemn s;u0 eeomo io1omD luvs;s0trum(opou4lpenmfei ( a2ua(mpno1oetomoeiatfa2eaumsn()teenxo3oydfat liei;(0 2xrio3no4aptn fesl(  2truro;t1oeeomfciyt mDrauvp (4texnxr oodfpt lnesls)srtmir oy1am  mfvi (farumur ;t0tpe if3iadfa raumonu)tlxrxr3iatlptr u o;t0s2tm(o3nudale lieia( aDtm( poo4oet  o3ilslm rl(ms u4aeermf tadlpteanei;(  rto(o no1lmenlfetasfaDumumpot4aexnmf3tad mDuanvs u) rxoxr3oodfmtr ivi t0s2tm(m iodapen netas srur( ooo0tlen ieiydlm ulums t)tetnmf todfp r ueo () rxoio3ny4lmenlnei t  Duaxmoot4apeoiietlslmDean pnt) lxrxr3todomD  u o;t0 2xo(m no1lpeeliet sfsrta(r ot4oeto o3iys a ua( o t)aexrxr tydfmtrli s s  rxm(m no1lle livt t) ruru  nu1apxomfeilt sDua(vsnt4tlxomrcoatfmt auvi;() 2tm(o3iudlpe  nvt s  2taum no4openmfeiytfm rm(vsnt0 ltrxr io1faDrlu i;(0seumio iudapee fviatfs2trur ou1olt ifetadfmDea(vp t4texnmr oadlmDr neo t setmimpiy1apt  iet ()a2rru oot0oetnifetyd m2rm( pn()aetnif3iydfpDrau o s0texm(opio4lm nlnvs t)artaurpou4oexomictasfa2ea(ms u4teeomr3oo1fmte ivo ()s2umir oy1lltn fet tfs2uaum ;o0tpxo oeilsfa2rm(vp t0teerircoydfa  an o t) rtrim oo4lmte ictlt) 2tau  nu1opxoif3iltfm2rm( on(0 lxnxo tadomDe uvsl(0s2um(m3iodom emiesat s2raurp;t1alx  oetls a rauvonu0 lerif3oa1fatraues s)teum(rpoudalt livsasf 2rmxrpno0apen feildfs2rlumo u4teerif oy1omtelieo;t  rtoxopno4olt lfvs s)aDraumo;u4oex mociytfsDelnmo u) rtomf3tadla   u s;s t2urxm ny1lmen fvt t srra(r ;o4aeeomo3tldla2eanmon(0texrio3ty1fa  au o;t trur(rpio4ol n ivsltfaDtrxmono0olx iocils aDulumon(4texomo oodomDrln s;s  rxoxrpnu4ope lieil()a2rrurooo0tex  i3ilslsDem(ms u)treoif oadopDr nei;() eurir3nydomt mivilt sDtrxront0tet mfetyd a2uluvs;u4texoio ia1lmD au o;t t2xrim ou4al  mnesa(fa2rm(mo;o1apenmo3iat sDemuvo t4alerxfctatoptran il()trtr(rpiy4amt micsas)a2rmx o;t0teeo i3iltfa eanms;t4tetriocootlmDr ues;t0tetriopiy1omt  nvi t srtm(mp;u1tlenmfeiytfa2rmn p (0tlxoxf tatomD anvils trxoim iy4opeelnesas a2tru  oo1tpen oetysfs ulums;t0 lenxfcoy1omDelu i (0seumiopoo1openlict t aDtaur nt4tptoioeiyt mDemuvo u4trenxf io1opt  ieils)setmxr oy4lm nmfeslt  Dtaur nt4teenmoeiytfm2uluvo (0texnmf3io1om r ieol( trxmio oudoltn iesat)artr(m no4tlxomi3tadfa2rmnms (4 etnmociytlmt lnvs s) rurxopou1altnlnctat  2tm(  nt1alx moctysla2rlu sn(4 eenio to1lmt ai s;s srum(opiu1altn nvtl( aDrrxm nt4tpen icilsfmDemu o u4arxnio3ta1oateliei t) rtr(m io4altnlfvslt aDtm(mp;u0oleoio3iys mDraumont0aexomo3totopt ai o () etr(mpnodlp  mfvi t)s2umxrpot4tpe ioetad m2emuvonu0aexoifciatla  aivi ()s2xmiopoy1amtnmietl()srrr(  oo1opxn o3ilsfm ulu onu4altoxf ta1laD luei;s0t2uoir3ou1omtemict s)a2umx  ot4tptnmfeiad mDra(vp (4 lermrcoy1fp r ies s)setmxm oodlpe mici tfs2ta( poo1altnmfetysls raump;(0 lenxr3ia1fptr neo t  2toxo oodlpenlnvta()sDtm(mp;t1olxnmf3iatfmDeaumpnt0alxniociytop eln i ( t2uo(o no1opee nvtat a2rru  ;u0oee mfeildfm elu snu)trtrif3oydfptrlnvs;t0 rxoiopoy4lle liesls)aDuaum ot1tpxo oeiat aDuanvp u0tlermf3iy1fa  livi;s) rtrxr io4ape mieias) rrm(m ;t4tlt mi3tldfsDrau s;(0tlenxfciodlmDrluvs s trtoxm ou4lmt mictasf Dtr( oot0apxnmf3tyslaDelu s u)alermfciotfa e ivslt  eto(o3oo4lp elfvilt s2ta(m nt0olx mieiys a2ua(ms u0 eerifcootlpDr ues s teuoim3no4ome miei s)arumu  ot1tpenifctyt s2ra(vpnu4texrmf3todlmD auei ( t2xoim3oy4ole  ivs (faDumxmonu4aeenioeilsfa2rmnvp u)tlxomr tytop ranei;( s2umim nodol elfvs tfs2rau  nt1alx  i3ild m2rm(vp (4trerif oy1optr i o;t0teumxrpiodolen fes ()aDra(m no1opt  iciyd a2rl( s t0tetnxf3ty1oa eanvo s)seuoim iu4lm elivt ( a2tr(  ou0tpx  octld aDeanmp;u4trxomf iy1lm ran s (0truoio nudaptn fci ()srtmx oou0tpx moctyd a um(vsnu0tlerio3iotlmDr i o (0t2umxm ny4apee nei s)a2tmxrpoo0opx mo3iysfm2ranmp;t0tlxnir ia1lmDr neo;t0 2xrimpoo4lltn nctasfs2rrurp;o0olenmfcildfa umuvo;t) lxrxociatla   ivsl( srtm(opno4ll   ieil(f rta( oou1altnifetadfs2eauvsnu) lxnmf3ootfm  an o;t)sexo(o3iu1lltemncil( arurxrpnu4ole iicilsfs2rm( pnt4tlermo ootlateanvo s)s2uoim nudaltn iet t) 2rmxr ou4alx iociytfm2eauvp;u0aexrxocoatfa  lnvs ( srum(r3no4llt mnvia( srraurono1texoio3tldla2elnmpnt0 eerxo iytop e i ol( tetr(mpnodlltelneils) rra(r oo4opt  oeiytfmDumnms (0aetnmf oa1fa  aiesl() 2to(mpno4lmeelictl(fsDum(rpot4teeomociat m umn snu0arxrir3io1optraivs s setmxr oodape lneiatfa2ua(m oo0opxo o3iasla2uaump;t) etnxociotoaDraueolt) exm(m iodom e nvs s arurur ;o4open ictyt a ulu p (0aexrmocoadopDrluvs () exrxrpiy4lpenmies tfarururp;t0oex io3iaslm emnmon(4trxrifciy1fate nvsls0s2urir nydlm emnvias) rtr(r nu0olx ioeiyt aDumuvont0tltrmf3tatlmt lu o t s2urxr3io4amtemicia( s2tau pno0apenioctltfs uau o (0trxnif to1lat lneo s  rxm(m3nu1oleemfeslsfaDtmurp;u0altomfciydla rlu o (0tltrxo3ta1fp ranvs ()seuo(o3nydoltemfvsls)aDtmumpnu1oeto f3iadfmDrlnvs;u4 lxnif3iytlmtraies (0s2uoxopio4lmenmict tf 2rmx  ;u4oltn o3ilsfm2ranvpnu)teenirctadlptelnei;t sexr(o3iudamen fvsa(fs2um(r no0tpxnmiciydla2ranvon(4 etrxocio1lmDe ies s  2to(rpio1oleemfvsat) rua(mpno1tlt  o3tytlsDrm( p () etoxf oa1opDeauei;t tetoxr no1lptnlnvil(f Dra(moot4optoifeiadfaDelnmsnt4aeeoircio1la rauvils  etm(o ou1lpt mnvsat  Dtm(m ou4oee  f3ilsfaDuanvo;t4 ltnxr oatlm e ivo s)seur(o oudap  mnviltfaDra(mpnu1tlenio3tasfaDem( s;(4texrmo3ootlmt livi t)t2urio io4om   ivtl( srrm(m no1aptomfeiltla elnvs;u) rxomf3tydom  livo;s  rxmirpoodlm   nct t) 2urx pou0tptn oetytlaDum( p;() rxrircoodfatr ieo ()srxrxm oudllenmivtl()aDtm(rpnt1opt iietytlmDemnvo u)tltnio3oydlptr nvo (0tetmimpno4altnlfvtl() Dtmu oou1oexo iciasla2uln s u4 renxf3oytlp rauvil()teuo(r iu1omeemivtls a2uax pnu0apeo iciydlaDemums;u0teenxf3tadom eai ols sruoxo no4om elfeia()s2taxmpnu1texoifctldls umn s u0 exnircty1oaD aivi ()t2xm(o io4lp emiet s artmuro;o1aee  o3iltfm2um(ms (0 rtrmo iadop rauvol(0s2xm(r3oodlmtnlncil()s2tmump;t1texoiictatlm2ua(vpn() etrir3totoatelues;s0s2urirpny4lltn fvsa( sDua(rooo1tetomfciysfaDumumpnu0trtoirciadom eluvi s)trxoimpou4omtemivtltf 2rmxmont1altnioetydlsDuaumsnt)tltnmo oytfptrli ilt)t2urim io4lptemfvsas s2ra(root4ale mociltfa2um(mo u0aetnmo3iytop eaues (0t2xrim iu1ope  fetl(f rtr(root0teto ocilt mDuluvon() etrxr3io1lmt  neo s trxoxr oo1lm nmiesasf Duaxrpnu4opxnmf3tytfm rm(vp;u4aetrif iodlp elivsls)trxoim3iudalt mfvs s)srraxm oo4apto octatfsDelnvs;t0tetnmocoo1lmDelneol()t2uoxopnydoltnmnvt t s2ur(r ;t0opx ii3tadlaDrmnms;u0trenxfciotla r nvil(0trxmimpou1llt  ncsls srta(roou1optn fciysfm2ua( pn(0teeomrctodoaD an o t0 ruo(opio4aptn neias aDrrumoou1tle  fctld mDuanvpnt0trtrxo3oytlmt auvs s)s2xoxm iy4aleelicilt arta( pou4tptomocilsfmDemnvsn(4 rtnxf3tatlpDrlnvi t)tetr(r3no1altnliei ()srraxr nu4olxo oeiysfs2rlump;t0 ltoxf3tytoateaueo s  rtoxopno4oleelfesasfa2um(r ou4apeo oeiadfm umn pnu0aexnxrctydfm  lieslt s2xo(r3oy4
\ No newline at end of file
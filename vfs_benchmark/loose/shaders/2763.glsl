@@ -0,0 +1 @@
+uvsls)t2uo(m3ou1amen fviltfs2tmu oot1aeeo iciytfm2emn snu)aexrif3ty1opteanvsls0tetrxmpoy4lmeemieiat)s2tmuro;o0ale mfeilt m rl(monu4treoifcoatfmD lieo ()t2umim oo4om nmncias s2umu oot0tee iietas m rm(mo;(0 eeomo3oodomDe ivi s0s2to(o3oy1lltemfvsas) 2uaumo;o0oetnif3iltfm2um( pnu0trxomo3iatomD auvo;() 2to(o nudllenmivilt  Dtr( oou4aetoio3tldfm uluvs (0altnircoo1oaD ln il(  2uoir io1alte nvi t) rrrxmo;o4olt ifeiydlmDumnmp;u4tlxoxfciatfatr n i s) rxoxmpiydop e ietls aDrrurpoo0oexn fcilslaDrau o;u4 rxomf3todlmtraueo;t) etoxopiy4ale lfeil()sDtaxr nt0tlx  ociadfaDulnms;u4areoxr oy1fm  li o;(  2urio3oudlleelnvs s)sruaum ;t1oexoifctad mDuluvp t)alxrir3ta1oa ean s s0 2toir iydapte nvt (faDta( o;u4ope ifctys sDul(vsnu4 lenmrciotlptrli ol( t2tm(m3oo4ll emietat  Dtmump;u1oetn f3iatls emnmont0treoio3ia1oatrlivsl( tetmxopny1lle  icilsfaDrr(ro;u0aptnmiciyslmDrlu s t0texrmfctatlmDrluvi ( trxo(opoydol emieiltf ruaur ot1aexo ieiltfs rln o t) lenmf3oadoatrlnvi ( s2urxopoodlme  fvi tfsrtaumooo1tpeoiictltfm2ua(mo;u4 eeoircta1lmDr iei;t0s2trxr iy1om e nvsas)aDta(mpno0opxomf3ilsls ra( on(0aeenxocoydlmtran s ( trxmxopiodale mfcslt)a2uaum nu1aeen i3tatlm2rluvont4treoio iy1oaDeauvs;( trxo(r ny1oltemivtasf Dur( pnu4tlx mfciat a2umuvs t0 lxomoctadfpDe i s s)trxm(m iy4olenmivt (  rtm( o;u4ape mieiytfaDranmp t)aexrif3iytopDraivilt) ruo(r oy4aleemfci ()arra(mpou0oeto ocild m2rmuvsnt)aexoxr iydfmt ai ols  2uoxm3oodlp e fvt s)sDtm(m ;u0tlxnifciys m2em( o;t0artomr iydopDrliesl(  rtm(mpou1lleelnes t aDuaum ;t1opto o3ilsfmDemuvs;()texomf3todoaD  ivi;s sexrir3ou1amtnmivtas aruru  nu1optomi3iyd m2uanvs (0 lxomf oytfptr nvol()sruoxr3ou1altelicsl( a2uaxmonu1aetomieiasfa2umnmp;u0arenxrcoadlpteaivs;t0sexmiopiu4apeemnci t  rua(m ;u4tex iieildlmDel(vp;()altrmr3ta1la   nvol() rxoxo3no4ll elncil(fartr(m ;o0tet ifciydlmDrmump u0 rxnmr tatfmteli il( sexr(mpiydlptn net ( aDrrumont1tpen fciatlm2uauvs;(4 eenmr3ia1fpDrlnvi;( s2um(m3oo4lltemfcs tfa2tmx  ;t1optnmf3iasfa2ua( s (4alxrir oy1opte uei ( teurxrpoo4ll e feta( sDrr(moou0tetoif3tlt a rlnvon(4areomf tydomD  ieilt0trtoxm3io1alt mfvs tfsrum(r oo4ole ioetad m ulnvo u4trtrmfcoa1fm eai o ( s2tm(mpoy1ole mnctls  Duaxmpnu0aeeomoetldfm2emu o u) exnxf3ty1omte u i s)srumxopoy1al  mfes s)aDumu  ot4oexnmieiadfm2rau o;t)texnmfciatopDrluvsl(  exmxr3oo1oltemfes t)srraurpno4teto f3tad m2uan o u)artrmf tydomDraueo;()tetoxr no4lp nmnctltf rtax  ot4olx  ociatls2elnvs u)altnmr iytfaDeanvol(  2ur(o3nodol  licils a2rr( pot1tet mfeiysfaDraums (0tltnxf3oydla  luesls teuoim ou4aptemncils a2tr(  ou4altoio3iyd a2rmn pnu0arenmf oydla eaueol(0 eumimpiu4lp  lfeslsf rumx o;o4tlx  fciad m ea(vonu) eeomr oadom  lnvo;t  eumir iu4lmt lietlt  Dumu o;t4oexnif3tydfs2elump;()arxrmf3tytop ranes ( tetmxr3iy4olee feil()aDtmxm ;u0oexoifeild a2uau snu0aexnmr3oatfa rlnvo;t)setmxo3iy4al n fetatf rrmx pou4aptnmfetld s2ra( snu4 etnirciadfaDrau ils)sruoio3iu1ole  ictasf rtax  oo1oleoifctld a2rmums;(0tetnxr3iadlmt aiesls texrxopnu4apenlfet ()aDta(mono4oex mietyslm um(vs;t4 exrir oatlat au i t0 eurio3nu4lleelnesls) ruau  nu1aexo ieiysfa2ulu onu4tltrmo iy1lm ranvs (  ruoiopoo4lmtelivi (f 2tm(rp;u0aeeoii3iytfm2uaumsnt)teerxo3oatop   ieo s trurxo oy4ope mnetat  rurumo;o1tlxo iciltlmDelnmp t4trxoxo tatopDrln i;t0tetrxr no1oltelfetas)s2raxmo;t0alt mfeiasfa umump;(4 lxoircoydlpt aivs t0t2xoxrpiy1lmtnlnvsl()s2rmxmpnu0alxo i3ilsfmDrlnvp;t)tlenxfciydlmD  i s t) 2toxo3oy4lme lfesa(faDrm( p;t1oeeo o3tlsls emu pnt4arermf totoaDe n olt0 exo(o oudoltn fvs s)aDtaur ;o4apxoiiciysfsDuanvs ()trermo3oa1lmtraiesl( sexo(o iy4ame  fet t sDua(mpoo1tex iiciat m umumsn(4arenxo3oadlaD  neilt)seur(rpnydope  nesasf Draxmp;u0alxo feiytlsDelumo u4aetriociy1fatrlues t0t2to(r ny1ole  fct t) 2raxr ;u0tetnifetysfm raumsnu0aexrir3todlaDraivslt0sexmir nodap  lfcsatf Dtrurono4olx ifeiyd aDumu p;t0tlxoir3totopt  i i;( trxrxm3oy1ale mfvil( sDtm(r ou1oeen ietadla2rl(msnt0tetoxo oatoateai ols0 euoim3ou1am n fctl(fsDumu pou4olx  o3tltfaDelumsn()tltnmf3iy1fm elnvo;()trurxo3ou1ol nmncslt)sDra(mo;u1opt  ictysfm rlu o;(4 lxnio3to1omtraivsls srurimpiy4lmeemici () rtru onu0aeeniocild aDuln p t4 etomr tatlmDe neo;(0s2um(mpny1amee fvia(  rraxro;u1apt mo3iadlm uau s;(0tltnio3ty1opDrlues;t0 etr(r no4ol e iei tfsDrax pnt1apx  o3ilt a rmnvo;t0 rtnmo oadlp eaies t sexrio3iu1ole mfcsat  rtmum no1alto fciad a ranvs u4 etrxoctatopD an ol()tetoim oodomteliei (  Drmumpoo0olenmf3tydfmDel(mp;t) etrxr3tydla ranes;t0setmxrpny1olt mfes t  2umur ;u4aetnmfetadfsDuauvsn(0tltnmf3oytlmt  uesl() rtoir nydal emietltfsDum(mooo4oeto o3iltla2rau o;u0artnmf totfaDe nei;s srxr(m no4ap  lfviat  Dtr( pno1oetoifcilsla2um(vp u0aetomo3to1faDranvo s setm(r3oudop  mietat)arraxmooo0oeeomietytlmDrlnmo u4 rxrmo oadlm raneils t2umio3nu1om emfci ( a2ta(r ot0opeoifeiatfs2el( p t4trxnxocoydfmte ieols texrxm3oudolenlfctatf 2um(mp;u1teeo feiydfa rauvs;(4 eerirctodomDelneo (0 2tmxopnydlmee fetasfs2tr(rp;o0oexo f3iytls rm(vont4texoxocia1lmtrln olt0 eum(m iu4aptnmnvils)a2rax pnu4aetomoeiysls2uau o t) rxomo oydfptrai i t0srtmxo3oydomtnmfctlt) Dum( ont4ale io3iydla2eau p (0 rxomr tydfatrlivs ( s2ur(o io1omt  nvt t) 2tm( p;o1tpen ieilsfs2ua(vsnt) rtrxrciy1op  lneol( srxoxmpno1lm n ivtatfs2tmurpou0oeeomfctad aDranmp;u)tlenxf3oatlaDr u ol() eumim no4ome  neias a2tmu  nu4tetoio3iaslm2ranmo (0alxnxo3tadomDr nvo;s0teuoio3oo1al elicil(farurx pno4tlxoiietydla rlumpnt0 rxomfcio1fpD luvols0truoxr iu1ol emnes sfsDta(rpnu0aex mietytlm eluvp;u0 leoir3tytfmtran ol(0setr(r nodaltnliesl( aDtau poo4tex ifciyd aDrln s u0arxnircoa1faDean i;t)srtoxopiu4ope lnvilsfsrur( oou1oeeo i3tltla2rlnvp;t4 lenir totomD aivil() 2xoxopnydopt mfeiasfs2raumpnt0tpxomociltfsDrlnvsn()aeenmr3tatlaD li ils)truriopiu4llee nvtlt)aDurxrpno1tee mf3iasfm emnvo;u)aleomf iydla  lu il()trxr(rpiodalee icslsfarrrx  ou0olenmfctatfsDrlnmsnt4arerifctydfa eanvolt)teurio iydal elivi t)a2uax o;o0alto feiltlm ua( sn(4alxoio3ia1lat  uvo;t s2tm(mpou1lp emiet (fs2tmurp;u1alt  o3tytfm rmnmpn(0aetrxrciatfpDeaies (0texm(m3io1ameemfeta(f Drrxront4opxn oeiyd m uluvs;(0 eenxo oadopDranvs;t0 exmxopoudomen fcslt  2trump;o0tlenioctasfm uanmo (0arxrmr3oa1lpDe n sl( s2xrxmpnu4oleemicsls) 2trxmpno4alxn ociat sDea( pnt4treomo iydlm rauvo;s0srur(o3ou4amtnmfctltfs2rax  ;u1aptoii3ildfs umuvs;()tlermociy1fm ran sls0sruoim3ou1lp   fvtl(f Drrumo;o0opxoii3iydfm2emu p;t)aexrif iadfaDrliei;(  rtmxopiy4omt mneiasf Drrumonu4tlen o3tltlmDuln pnt4artrxo iadlpt au ils0 2trxmpiudol nlnesa(fs2tm(m nu4tpxn iciys s2ul(vo;(4artrif3ty1optrai i s)s2urir3ny4apeemici sfs2rmum ou1tpen ociltlsDuauvp () reoxfctatfmD anvs;t0 2xrxrpnodaptelnei (  Dtm( ono1tlenmfetadlsDeluvs t0arenxo3oadlmtrai il(  2xoim iy4ol emnctasfs2rrurp;t1opeomieiysla2el(vp u4alxnxrctotoa r iei;(0seum(m3oy1apeelfet () ruru  nt1apeoiietldfa eanms u0alxomr iotlptrlu o;s0 rtmxrpoydape livsas  rrmurpou4open iciys m2rm(vo;()altniocty1lmDrlu olt) euo(m3io1ale lfvil( a2ua(rp;o1teeomfctlt aDrm(von()alxnir3todopt liei (  rtoxmpoo1lme lfvs s srrrx o;t4alt  ictad a2um(mpnt0 rtnmo3oadlmD  nvsl(  rtrir3iu4lmenmfcslsfs2tmxm ;u0alxn fciysls umnvp;u0 rxrifcto1lpDe ivil(0 euriopnodaptemfcsa( a2rmu  ou4oee mfciltfa2uanvo ()altrxr iatfpDrlu i s0seuo(opnydlptn fvsa()aDrr(rooo4olt iieias s eln snt4arxrio iytlpt lnei (  exoirpiy4lmen nci t) 2uau pnt1tleo fctad aDea(vs t0texomf oa1opt  ies (0t2toxm ny1omeemfetat)aDumum ;o1tlxoii3tyd a2ul(vs u4texrmfctytoaD  nvi t setmimpiu4altelfct s  Dtm(rp;o0tpenifeiydfs2umu sn(0aeeoxfcoytlat an o;( texoxrpoodol emici t)arrmu pou4oetnmf3ilslmDeau ont4 exoxfctydlat li i;(0s2umir3nu4aleemfvtas  rururoot4aexo iciaslmDelump;u0aeerxfctatlaDraiei;(0s2uoim3iudlmen net tfsDuaurpoo1optomociyt mDranms;t)tlenxoctatomD an ils)srxm(rpny1alt lnvs (fartaxmo;t1teen ictytfs elnvs;u)arxrxf totlmt  ueo;t0teumirpiydamenmfcta(  rtr( pou1apto i3iys sDuanms (4alxomf ty1la   i il(0 rxmir io4opt lfvsa() Dtmxm ;t0teeoii3ildfaDeauvpnu4aleoxo iodlmtrlivi;s)t2uo(o oydal nlicsl( srtaumpoo1teeomf3iasfmDem( o (0teermo iatoatrai o (0setr(r3ou4lmtnlfvslsf Drruroot4opxoii3ildfs eaumon(0 rxomfciytlm rlivs;(0tetoxr3iydamenmnvsas sDurur ;o4opxo o3tlt mDeau s t4 eerxfciodomDr ieil(0s2umio nydapt  ivi t srtaxrpnu1alenmieiadlm uanvonu) rtnirctytlmDe ivi;t s2xrxr3oo4olenlncs () Drau p;u1opt mfeiyd m rauvp;(4 exrxf3oadopte ieo (  2uriopou1ole  ics t)a2ua(m no0aee ifcilsfs2ranmo;u)tltrifciadlpt anvo ()t2urxo ny4oltnmicsatfsDra(m ;o1olenmoeiytlaDeau pn()trtnio3iytfpDeai s;t0sruoxo oo4lpeelnesls  2trx pnt4tlxo o3iatlm em(vp u0 rxomr3to1lmteai i;(  etoiopnu4lmtnlneil() rta(rpnt0aleomoeiyt m2em(vp;u)treomfcoy1la  ln ils0 2trxmpiodlmtnmfeilsf rur(  ot1alt  oetad mDrlumonu0texrmrciotfpte iesl()t2trio ou1apenliciatf rrmx ono1oetnii3tad m ua(vsn(0texoxr3to1la rlnei;s0srum(o iu1lmeemicils  ruax  nt0tpxo iciatlm2rau sn(4trtrmo oa1fmtraies s t2xmxr nu1omt mnctatfs2ur(m ot0tltn ieiytfm emuvonu4 rxnmo io1fmtr u s (0tetm(rpny4lm  licilt) Dtmum ot1tltomfeiys s ran pn()tltnxr3io1fpDr i s;s srtoio iy1lp nlfes t  rtauro;t4oex  o3iat s elumo u4tltrxfciadfm  lnvo (0t2uoxm nu4ll elnviatfsDrrxro;o0tlto iciys s ranmsnu) lerxoctotfpDrauvs t) euoimpiudop   nvia() 2umu ono4apxo o3tldla eau s;() rxrmfcoodfaDrlivslt seuoxm io4omen fvtatf rur(rono1olx mocias m uluvp;t0 exnmfciatfat  nes ()s2uoiopiudole  ncia(fs2tmxmp;u4apxomociltls2ulnmo t)aetnir3ia1fptelieslt tetmxr ny4lmt mfetls) Drmu ono4tpeoiociat aDea( ont4 rxnxf ia1oa  au slt0srtoxm ny1ole mnvs sfs2urur ou4open i3iasla eau ont0 lxrxrctytlmte u i t  etoxm3oy1al   nciat sDtaxr nt1tpe mf3tlt s rl(vo t4arenxr oa1lm eanesls)t2xr(mpiodoltn icia(farur(mono4tltomiciytfs2rln p t4tltrxrctodlm   i i t)trurxo3iu4lm nmnctltfa2trump;t1tpenmoeiatfa2rmu p u)trerirciytfaDraivi ( t2uo(rpiudlpenlfvt s) rrm(  ;o4opxnmiciatfmDean s;u)aetnmo totfateai ol(0seum(m3no1ol  mics (f Dtmxr nt4olxn i3iysfa ul(mo;(0 rermr3oadomDeluei t t2uoxo ny4apenmnvtas)sDrr(m oo0aee ifctat aDuanvp;(4trxomfcoo1optelivs;( teuoxo3iodop  lnvils  Dtaurooo0alt  f3tas m2eauvs u4altnxo3iytfat livsl(0srtmxo3oo4ap  lfetas) Draxm oo0aetomfeiysls2um(von(4arxnmf iadoatelies;s0 etoim3nu1llt licia( s2tm(r ot1opeomoeiltlm2ulu pnu) renmrcoatfm eanvols0tetmiopiy4op nlnct s a2umu  ;o0opxo iciltfa rln on()altrirciytoptrluvo;t0 rxmir3nu4lp emict sfaDrmu ono1tptoiociyslsDrmn on(4 exoxr ty1fptelieil(  rtriopiy1omtelies ( aDraxmo;o0alxnio3tadls eaump;(4altnmfciydlatelivo (0srtoirpoy4apt  nvtls srrmumpoo1tex  f3ils s elumpnt4trxrio3iytomD  ieo;t0teurxr iu1ol emiviltfa2ur( o;o0alx mi3ildls2elnmp u)arxrxf ty1op  luvs;s)t2toir3iy4lmt mfetls aDta(r ;t0aet  f3iadlm rmn onu4 leoif3totfmDr u ilt0s2xoxr io1omtemfeil() Drau oou1ale iietyd aDrl(vs;u)teeomo iatla e ues;(0 ruoxm3ou1al nlicsl(f 2trx oou1tpe iicils aDuau o t4 leoif oatom r nes s0srxmiopiu1amenmfesatfaruru  ou0tpt moctls s ra(mo t4aexnxfcoadfa r u slt teur(o no1lptemncslsf 2raur nt4tptn ietlsfs ea(vs;() leoxf3oytlmtrli i s0 ruriopno4optn fvta()aDumurono0oexo oetadls uau p;t0 eeoxo iy1op raueo;()teuoir nodapt lfcsl()arrm(rp;t1tpx if3iysfa2rlnmp t4 rxrxo3oatlpDrlnvi;( s2trxm3iu1lpe mivsat s2tmxrp;u1olx if3tld m2uanvsn()arermr io1fptr neilt s2uo(o3oydlptemfvslsfa2raur ou0olx micild m2ea(vp;t4tlxoxociatfmt an o;s) rxrxr3ny4omt mfcia( sDraurp;u0tpxomociytls uanmpnu) eermrcty1om e i slt) exoxo3nu4al nlncils  rrmu o;u1oexnmoctydfsDea( pn(0aleomf3io1fp r u s;s t2tmim oodom emncs ()aDuru ooo0apeomoeiyslm2rm( o;t0alxrirciytlp r ivolt0teumimpoudlmeelfeil(fartrxm nu0olxomictldfaDrmnvsn()alxnio oy1fmt aueilt) eur(m oydomt  ivsa(f rtmurpno0aleoii3tas s umuvs t0areomf iotop e u slt) rxmir3no4amtn ieil(  Dum( oou4apx ii3ildfa ulnvs;u4 exrio3iydoaDraivi t0s2tmxo oydapen nctltfarrax  ot1tptnmf3iytfaDeau o;u)artoxociodfa  an s t0setoxo no1ameelivs t  Dtmx oou1apeoiocild s rm(vonu4aexoxr io1omDe ivil(0srur(rpoo1lmt mfcia( aDtrum ou4tet  i3iysfs2umu p (0 etoir3iy1fa rlieo;t0trtrxm ou1omt livia(  ruaxmoot0optnmf3iaslsDrau o u0 rerxf3io1fmtrai sl( tetm(m ny1ope lnvil(farra(m ;t4aexnio3tltlm2rmump;(0trxomr to1fpDrlueo;t s2xoxm iu4lp e fvtas)s2taxmo;u4olx  ociad s2rm(vp;t4tleoif3iydlp eauvs t0s2tmim iu4lleemietas) Dra(  oo0tpxnmfcilsls2uan sn(4 rtnxo iydlp elu s;s  rtoxmpou4aptn iesas)s2uru pno4oet  ieiltlaDel(mo () rxrxf3iadfmDeaivs s)t2tmxm3iu4amt lictl(f 2tr(r nu0tpenifcildlmDeanms (0teenir3tytlp eauesl( sexr(m3iu1amenmicsas) Dra(r ou0aleoifctls m elnvp;t0 etoirciytoptr ivi t)texmxrpnu1lptemfct s)a2tm( pou0alt io3iadfs2rmu p t0 rxnmoctytlp raueo;s)s2uoir3oy1ape  ncil(fa2uaumpnu4aet moetydfs2elnmp t4 exrxf3iy1fa e u ils0 2trir3oydop emnes t) rtaump;t0teenmi3iyslsDeau p u)tetnxr ootoat luvsl() eurxo iu4lp elnvs (f Dumxmoot4optoif3tad a uau snu)trtomfctydlmD  ies t  2xoxr ou4opeelnes s) rurx  ot4opxoiiciasfa ulnmo;t)tltnir3iytfmDr u i;(0 rurxr iudam  lfcsl(farrr(mp;t4oee  oetytfm2ua( p;t)alxomf ootoaDr u slt sexmir oy4om   neil( srtmxmpou4oexn oeiys sDua( p;u4 eenxo3oy1fp rliei;t0s2toxm3iudomtn iet t  2uau o;u4tetnmfetytfm2eanvsnu0tlenxo3iatop elivs;( sexr(o3iudaltemfvs tfa2rmu  ;t1tet moctytlsDrl( s t)trermr3oa1op raivslt  2urxm3nodaltelfviatfaDtaxr nt4optniicils aDran p t) rxrmfcto1omt lnei ( t2um(r3nu4op n iet ()aDua( poo4oee mf3ilsfmDulu p u)alenmrcoa1late ueils)srumimpnydom n fcs t)a2ra(m nu0opx mieiltls2ean o (0arxnircoydopDrlneolt0seuoxo3oo4amenlics t  2urxront1olxomo3ild sDemnvo t0aexnir ta1lpD  nei;(0 exmxopiodlmenlieiasf rrrumo;t4oet  ictytfmDrmnvo;(4trxomf totoaDeaiei t srtr(mpoy1ole lnciltf rum( pnt0oeenmieiytla elu pnt4 etrmf tytfm rlivs s texm(m oo4lpte nesa()sDur( oou1oexn iciydlsDulumsnu)teeoio3io1opt  i i ( t2trxm3ny4ap  mfvi (  Duaxmpno0aeeo ieiaslsDranmp;u0 rerifctydfa  ln ilt  2xmxo iy4op   ivi t)srrrxm no0tltn i3tat s rm( sn()teenmr tatfmDr uvsls0 2urxr iu1opeelfcs s)sDurxrp;o0tpenmoeiydfa uaumpn(0trxoio oy1omDe nvolt texm(mpiu4omtemictatfsrumxm no0aexomo3ildfa ul( p;(0teerio tatfp eau o;()sexo(rpny1amenlfes () rtrx pno0aetnio3ildfm em(vsnu4artrmo totlmtrlivslt seto(mpny1openmnctl(  rtmx  nt0oetn ociadfaDrm(ms ()teeoifctotlm rluvo;s0 exo(mpiudapee fet s)arur(ronu1olx  fetyt s ua(vs (4teenmr oydomteln i t s2urir3io1ame  fci sf rum(m ou4tpt  i3tls mDrmn s ()tlermocia1lmDr i s;t  rxo(m3ny4lm emfvsls)s2urx o;o4apxnio3iad s eln o (4texoir to1lm elivi;t)trxrxrpiu1alenlivtls sruau pnu0tptomoeiytlm2ua(mon()teeoir3oatfmDr nvs s  2xo(opiodome  nesls)a2umurpnu1aexnmi3iytfs rm( o;() ltrmfcoo1oa r uei;( s2uoxm3ny4omtelietls)sDtau p;u4oexomfeiyt sDrlnms;t0tltnmociadop eanvils) euo(r oo1lmte ictas aDua(m ot1olxnmoeias a ranvp ()trxrmfciadlatr i il() 2tmio3io4lpeemnetlsf Duaxmoou1oleo iciytlmDeau s u) rxoxfcty1fmD  neo () 2urim3iu4al nlictl(fsrtauro;t0olxnmfciltlmDrl( s u4trenxociatlp raueilt t2uoimpnu1al n netl(f Dum(moot1oee  oetysfsDem(vpnu)trtoxfcta1lat aies s)setr(opio4lpe mncs () Dumxm oo4tetoio3tltla uln pnt0tetoircoytom raies s0setrirpnu1llen fcs t)sDuau ooo0oetn i3iytlsDran o (4 eermr todfm rai o;t  2umxr3iy1omte nvtltf rurxrpno0apto ietatlmDua(vo (0texnxr3oatfmtr i s;t0 2xr(rpoo1ap emnvt t  2taum ot0teeomfcilsfa2el( snu4 rtoir3iatfaD aues;t)setoim3io1olt  nvt ()aDtru  ot1aleniociydla um(vp ()areoio3oo1fpDe ues;s trxm(mpio4lp elivsls artmxm no1tlt  icildfa ea(ms;()texrxf3iotopD auvslt0t2tm(m3io1lptemnei tfa2rmxr ;o1tlxomf3iydls2raums u0 exnio iadop eai i;s)texm(o3iu1al emnvils)a2tr( p;u4tltnmoctatlmDrlu ont)aexnxf oadomt lu i ()sexr(r3iodlmt lnctasfartr(mpnt1altniieiasfm rl(vo;u4texrirciatlpDr n ils t2uoxrpoy4amen nvsltfa2ua(r ;t0tee ifeilsfa2rlumonu)tltnmr3iatlateau o;( teurir iy1llee nvsas srrrxmpnt4apx io3iydls rl( s;(0 exnmfcio1om   ueo;t)trtrxo oudlp e nvsls aDua(  ;o4aetoioetadfaDeln p;t)trxrxf iydfate uvo t0srxmxr3iydalt mnes s) Dur(rp;o1tpeomi3iyslaDrluvpn() eeomf3ootlpDeau ol() rxrxopiodom elfviasfsrtrum ot4tpeo f3ils a rl(ms (0tltrmr tytfmtr neols  rurxm3iydlp n iei ()a2tm(mpno0ale  oetytfs eau sn() leoxrcta1fp   neolt0s2xr(rpnu1lp emictlt artrxm ;u0teenmietytfmDulnvp;u4 exnif ty1lp eau ols  exrxmpny4opt mnesa()srtmurp;o4tptomf3tadfs rlump;u0 eenxr3ootfa e ivslt s2xmiopnu4lmt  ieias  rrm(mpot0tetomoctldfs2elu s () eeomo iy1lpDrluvi () exo(opoo4op elnvil(  Drmxm nu4alt  ieiys s rln o;(4aexrmf oy1lmDrlies;t t2xrxrpoy1lmt mnvs ()arumx oot4opt mieiydfa2rau pnu4 rtnif iy1fa elues;t srtr(opnodapen fcs (  Dum(mpot0tpe  f3ildfm rau p t)altrmo tydlp eanvil()s2toxo3nudopt lnvsa()s2rm(roou1opeoiociyslsDrlnvs t0aetnxocty1lmtrli i s  exmxr iu1lle mietlt  Draumo;o0oltnif3tadfmDranvpn()trenmf3totfat  n sl() exoxr3nu1ap  licilsf rta( p;t1tee ii3iasfs rlnmp ()trtoxf oodfaDelieo;t0texmim iudopeemnes t artr( onu4tpe  oeiys mDran p t4trenxr3iydlm  ai i;t)srxrxrpno1aleemfei (farumur no4oltnio3ilt sDea(vo t4treoxrcoodfptrlivo t0 eurimpoodale  fei s sDumxm nt0aetniiciat aDrlnvsn()aexnxr iydoat auvo;s0srxo(o oudaleelnet tfaDra(r oo0texoiietydfaDem(ms t0aeenxr3oa1opDeauei;s0t2xo(r3nu4amtn ivi s)s2um(  oo4aeenifetydfm2raump t) ltrmrcoodla   nvsl() rtmxo3iodomenlfes () 2ra( oot1optoiietys a umuvo u)alenio3iydfpt lnei;t) etoirpoy4ame  iei ()sDumxm ;t0opeoio3ias aDumn p u)texnxo todfpteau sls)s2toio iydap emivt (  rrrur ou1alxoiietlt s2ua( s;t0aetomo todop e neolt t2um(o3nodlle  nvta( artru  ;o0tptomf3tldfa2rmnmo t)trtrmo3ty1omteaivi s trtoir oodlpe mnes (f 2uaum no0tet mi3iytfa2umuvs t0 rerircoa1fmtrlneo s s2tm(r iodlptn fvs ()arraxrpoo0apeo f3iltla2ra(vp;t)arerir oo1faD au o;t0teurxo3iu4llen fes s arrmxr oo1tpt mfctlsfa umuvs ()artrifciydfp rlues (  2uo(o nydomt lfct s aDta(rpnu1alxnmietltfm rl(mont4 ltnmr3ootlmDr uesls0s2xrim ny4ame  fei t)aDtmxrpoo4opxnmfctydlmDrmuvp;u0tleoxoctodfa rlivo;( srxo(m3oy4lleelncsls sruaurp;t1opt mocilsla2ra(mon(4trenxrcto1oat liei;t0srxmiopno1ll elncs tf Drax pno1alenmictltfm2eaumpnt0arxrxf3tadoa e nvi t  2trxo io4lptn ncsl(fsDtr(rpot0apxoioeils s2eanvsnu) rtnxr3oa1op  ai s s) exrirpoy1lmtnlicias)srum(mo;o0altn ictldfm2rmnmo;(0alxrxo oadfmt li i t trxrxo3ny4alen nvia( srra(mo;u4aet if3ias sDemu p (0tlxnmociatfaDe uesls  rxmxo3oy4al n fvilsfa2rrxro;o0apt if3iyd mDra( on(0texomo3iytlmt livs t  2trxo ny1am nlnvs s)artax  ;o1aptnmi3iytlm2raump t4texrircoo1fpteau olt trtm(m iy1lp e ncs sfsDrauroot0ape iietyt sDranvonu4texnir3iotlp r nes t0texo(o ou4ol e fct t  2rrxm ;o4aexoioeildls2elnmp;u)tltnxf3totfm  aneilt)seuoir ou1ome  fesl( srrru  nt0aexomiciatfs2um(vp (0 rtnmo3oa1lmD auei;t)sexrirpnudap  miei t s2ta( p;t4tpxoio3iasfa ea( p (4alxrxfctytopt li o ()s2xmxo3oydllt  fvt s) rtrxmpoo1tpeoifetasfs rlums;u0artnif3tadom  lnvols0srtrir3ny1al n fesas srrruro;u4altoifciydfm2uaumont)trtnmf3to1fm e ieilt)s2xmxm3iy4oltnlies ()sDumum ot4olt  fetld a2ulu onu)altoir3iy1fat  n o s)tetoim oy1lmtelnct () 2rmx pno0oleomo3tlt a2emums t)trtrxfctytlaDrai i s0srxrimpiydam   nci t)sDtm( ooo1aex  ociat aDumnvo;()aeermr iydlaDe ueils srxrxo3oy4olt liet s  2rmuront0opx mociydlm2ulums;t) ltrmfcoodfa eauvi;(0seumxo nydamen nci (f 2tr(ro;u1tex ifetyt sDelnvont4tlxnxo iytoaDeai o s)sexoxo nudap nmnes sfaDumump;o1optniieildfa em(msnu0 rxoio oydoaDr i ils trtoio nudolen iei ( s2raumooo1texnmi3tytfs2uanvo;u0alxoxr3tadlptr i s ()tetrxm3no1omt  nvsasfsrraxmonu4tpx  ietatfm emu p t)aetniocoydfp eai i t)srurxo ou1al elneil()a2raxrp;t4oltoii3tatfm2uln p;(0tltomocia1fa e ivi () exoim oy1apenmnes ( sDrr(  ot4tpx iietld s2ul( o;(0 rtnxf3iytfm eauvo ( srxoxrpny1omenmnvsat) rrmuroou1olxoiieiadlsDranvp t0 lxoxfctydlmtrlu s;t sruo(rpou1lpenlicilt)arrrxrpno0olto i3tlsfmDrlu pnu4treomf iydfpDrlues;s0t2uoxo3no1om elfvi s)aDur(r no4oeeo feiltfm rlnvo;t0tltrmr3ta1fpDelu ils0 rxrimpny1ll nlfvi sfsrua( p;o0olen o3tlsfm2emu snu)trermr oytom r nvs;(0s2xoxo3oudamtemieslsf Drmx p;t4altnifeiad m2emumo;u)texrmr3oytoat aueo;t0srur(m oudamtnlivs sfsDtaxm no1apt io3tatlm uanmp;t0 rtnmfctytfaD aiesl( trxrxrpiu1lmenliviltfaDra(m ou4tleoio3iltfa2ulu o;()aetoif3oo1faDeai o (  2trimpnydamen fvi t)srraxrpoo0olxoif3iytfm2ranms;(0 lxomocoytfpt  n i s srtmio3ny1open icilt) rtaur no4open ictltfa elump;u4texnio oydopDeai o ( trtoir3io4al   ieil( srtr(mpnt1oexnifetydls2emnvs u4 ltnxf oydopDrlivi;t0 2xm(rpoo1aptemietls  Drmx o;u1tltnmociasfaDua(vsnt0tetnif ia1fmtranvo s0s2toxmpiudlpee icils  rtruroou1tlx  o3iydlmDelnms u) etnmocoytfp  au s s0tetm(m iodopt mieiasfartmurooo4texomoeils sDem(vs t)aetrxocio1la  livo s) rxmxr iy1ole lnvs s s2rax onu1aptoii3iydfa rauvonu0tetnmf to1lmtrlivi s t2toir no4ap   nvia(fa2rrum ot1optniicild s ranmp;t4tlxoir tatoptraueo s)s2xr(rpno4ome  icslsfsDtrur no4apeomicilsls ean s t4alermo3iydlp  aivs;s0truoxr3oydal emivias  rrm(  nt4apxn ociadfa em( p;()arxoxociodfaDe i ol( trtrxr3nu1omtn ncil( srtm(moot4oex mi3ilsls2rmn s;(4 etnxr totfmD  ies;s s2trxopny1ome  neta(fs2taxro;u0olt miciydlmDua(vp t0alerxrcoo1fp  lneils)t2xrio ny4olteliesatfsDur(m no4aexo ietlslaDulu s;u0tetnmo oy1opDean o s)seurxm3nudlp elfvtl(fs2trx p;o0texn oetysfm emn o t4altoxfctodfaDeauei s) rxmxo3nydlmee ncsas)s2rr(moou0apxo oetydfsDrmn snu4alxnxfctydlptean o;(0trxo(r oodoltnmnviasfsrtrumo;u1oexn oeiltfa2el(mon()tlenmo iatlatrlneil(  2xoxopou4ll e net s)sDraxrooo4tpeoifctatlm um(vsnt4 rxnir tydlp   nes;s srxrxm ny1lme lfci s) 2tru  ;o0altnmfeiysfsDeau on() rtoxfcio1fa  lneo;s0srtoir iy4op   fes () Dtaxmoou0tlt  o3iltla2um(vsnu4tlxnxr3iytlmD  neo;t0t2xo(m3iodamee ivtas) rumu onu0olxnmfeiat aDrlu p;t0 lxnir3ootla e uei t0trto(r3ny4lme mfei s) rrmurpnt0opxomociat a2emn p;t0altnmo tydlptrlnvilt) rurxrpny4omt  fvs t)s2rax o;o4apt miciydfm2eaumo t)texrmfcoodfpDranvi s) euoim iudllt mietas  rurum no0oleniociat a rmu ont)alenif3totfmD  nei ()t2xrio ou1am  mictatfaDrmx pnu4tpen feiatls2ea(ms t4alxrmf3todomD aues (0tetmiopno1omtnmfvsat sDtr(  ;o1oetnii3iyt a rln pnu) eeomf io1lmtean i;()s2trim3io1lpenmfcs t  ruaur ot0olxomiciatla2rlumo;t4 etrxoctadlmtr ueo s0srxr(m no4opeemivilt)sDtr(r ;o1oexomf3iat a rlu s u0alxoxrciadfat  neils srxrim ou4apeemnesl()arur(r oo1alx ifciydfa2rlnvs;u) ltnxocoydlmDrai il(0srxrirpno4amt lfvt s sDtrur nu0tpe  o3ilslmDul(vo u0tltnmr3oy1lm  an ils trxo(o3oy4olenlieiat)a2ra(mp;u1oltnif3tasfm rl( o u0 etoif totlp   ues;t0teuoxopno1ole lnvta() rraumpno0alen icias sDumn p ()arerxociatlaDelivi;()s2umxopoo4amenlicta(fs2umu oot1aeto ociytlaDeln pn(4 ltnxf iodom rlivi;()trto(r io1ol nlnes (f 2taxm ;o0teen oeiltla2um(monu)alxrircoytfp eaivi ()srtm(r no4al   feslt)srurxr ;o0ole mo3tadfs2rlnms;u0tetrmrctydopDr ies;t) 2toxrpno1am elivtas)artmxr ou4tlx  ociad s umnvonu0 renir oytfa ran o;s)truoxm nodoltemivt (  2uaurpoo1altomieiltfsDemumo t)artnmo oydfptr nvo t0setm(rpoodomt lncsas arurx  ;u1tlx io3ildls2rm(vo;(4aexoir ootfpt  i o;s srtmxmpoy4oltemiesa(faDumxmono1tlenif3tad mDulumo;t)altrmf3to1oate n s;s0s2umxo nodomte fcia()s2uaur ;t0oexomf3iatla2rmnmsnt)alxoxrcootoa rlueilt  exoxopiy4oltnmietltfsDtau ont0aexn i3tytfs2ra(mo;() exrif3oa1lp r ivs;t0srur(o oudalenmfetls srra(m ;o4ole mieiatlmDrln s (4arxomr oytlm   nei s setrir nodlmt lncils aDum(rpot1tpxnmo3iasfmDulnvont0 ltnxrcia1lmteauvils)srto(o oydapt  iesas)sDtrumoot4tlt miciatlm2um(ms;u0texnmf3ta1fa eanvi;() exrxrpou1ll   nes sfsDrauro;o4olx io3tls s ulnvp t) rtoxr3oydfpDr n i () 2ur(o3nudop nlfes t  2raxmpnt0alt moctatfs ulu s;t)aeeoio3tydlpDelneo;() eurxr io1apte fcilt  rumxro;t1olt ifetldlsDulnvsnu4 rerxrciadfm eli olt sruoxr no4amtnlnesat  2rr(r ;o4tlt  i3iydlm emuvpnt)trxoirctatlpt  uvi;s0teto(rpny4ame  ivsl()a2um(m ;o4oleoif3tad sDemump t4 lenxfcto1fpD  nvslt)sexrir ou1opte nvilsfartaxrono4alx  oeiatfa2ulu o u0aexomf3todlmtrliei;()srtrxr3ny1amee nvil(fs2ua(rpot1oetomiciyd s2ua(vs;u4 eenxo3iatopteaies;t) etr(opoudol elfvs tfa2taxroou1ape  feiltfs2rlnms;u0arenmrcoydlm   nesls0 exr(o3iydaltemict tf Dtm(  ;o1apx io3ild aDelu s;u0altnmf tadfptr ies s)s2tmir3nu1lm emneil()aDurxmont4aexnmieiasfaDuauvpn(0treomrciodoaDr iei;s0trtmirpiydope lfcta() rtmum ;u0altoifeiyslaDuau sn(0artnmr oa1lmte ueo;()srtr(opou4olenmncilsfs2rmxr no1opt mfeiyslm2ra(mo;u)trxrif3oytlaDeai i ()srxm(o oudom nmnciatfs2rrxr no0opt mfeiyt s ulump u) lxnxf3tytoatrauvolt0s2xmxr oo1aleeliesasfa2uru poo1tptomo3ilsfa2uanvon(4aetrxfcto1fm eaueslt0teuoxm3iy1apte nvsa( sDumx o;u4tltoifctadlmDemu o;u4tlenxr3oo1lpD  ueo s)tetmim3oydlpte ncia(f rtmxmp;t1tpeo f3ilt m ra(vo t) eermocoo1opDe uvsls0sexm(o oydam elnvsl(fs2rm(rp;u4ape io3iyd m rauvsnt)tlxnmo3ty1faDe ueols0trumir oydlmt  iciasfaDum( pou4tpx iictysfm2emums;(4aetrxfcoydom eai s;s0 exmir3no1apee iesl(  Dra(mont4aetnif3iadlsDrmnms t0altrxf oadopt livil(0 exm(r ou4ole mnvi ()aDtrxm ;o4aexoiocilsla elnmonu0alxoioctotfpDeau slt) 2xrir3io1altnlnei () Dtrxmono4tpx  f3iltfmDem(vo;t4tlxnxo tydop eaues;t0texrxmpoy1opte fvt t)a2rmxr ou1aeeo octatls2rl( s;u0altoxrciotop r nei ()t2uo(m nu4lltn neilt)artrxr ou4teeniictydfaDel(mpn(0tltnmr3oatoptr uvsl()t2xm(r3oodlptnliviasfsDtmxmp;o1opt  iciyslsDelumo u4 lxoxf3iy1oaD  u o;s s2xm(o oy4al e feta( aDta(m oo0optnmoctytfm2uanmp;u0 lxnxfciotfp  li o s s2ur(r no4al  mietls artm(  oo1olxoifctydfs rluvp t) reoxoctodlm r nvol() 2tmirpnydomt  fes s  Duaum nu4apxo ieiys s eanvo t)arxrmr oodfa rlueslt  etr(m ou4alenmivtat srtm( p;u1texo o3tasla2ua( ont)tlxoifcootlmtraies ()srtrir nu4llenmieil(f 2umuro;o0oleoii3iydfs rmump t) eenmo3io1lmD aivs s  rxo(o3oy4om nmfvt ()aDum(mpnu1ope  fciadlm elumo t4 rermrctydlaDeli i (0setmio nydom   ncs sf 2rm(root4aex io3iytfa2eaumo (0 lxoxociy1oaD lueo s)seum(o ny4altnmnvsls a2tm(ro;t4alx  o3tas s2eln s;u0tlerio oadoaDe nvs t0sexriopno4lmt  ies s  Duau pnt0alxnmoetlt m2ua(vs;t4 etrio oydop elieolt0 exm(rpnodamt lfet (fs2tmx ont0opt ioeias m2el(vs;t)alxoxocto1omtrlu o;(0tetr(o3nudop nmiet t  2tmxrp;o1aex  ociys aDemnmonu4arxnir3iydom ranvils0 2tmir ou1open ici tfartrurpot1tpx  o3tas s elu o ()altoiocty1lp e n o;t) 2uriopnydlp  mncsltfaDrauroou0ole  i3ias a ulu sn(4areoio3todom rlivils srtoxm iu1ame mfvia(fa2tau  ou4apenifeilsla rmn o;t) rxrmr iy1laD  nei;s)truoimpnudamte nvt ()a2raxrooo0tptn ociydlmDra(vp;(0alenmf3oy1laDelneo s0trurirpno4ome mfcs t)sDtru ont1tetoioetys m2rmn onu0tlenmfciy1lmDranvslt tetm(m ou1lptnmictls  Duru p;o0ale  fctls a2uan o u0 etnifcoatfmtraivi;() etoxm3nydll e nvia(fa2rr( onu0oetn fctyt m umu on() ltomrctytlptrlieo t texr(o3oodale  fvi tfa2rmxmp;t0oexnmocilt a emuvo;(0 lxoif3iy1om e n i ()srtm(m3iy4ale lfvsat aDtm( p;u0aeeoifetydls2rlumsn(0 ltnmociydfat  n o t)srxoxo3iodlpt  fcsa(faDrmurp;o1texomi3iasfsDemn p t0 rtnio3ia1om  aiei;s trumxm3iu1lpenliet ()s2trx ont1apenifeiltfsDua(mp (0 rtrmo io1faD aneo;() 2xmim oydaltn net tf rur(mpou1oltn ieiltlm elu o;t4 rxrif3io1lm rauvs;s0srxrim3oydom  lfei ( a2uaumpnt1texnmo3tyt a rau on()altrifciatfp eau s;t)srxoxopnodlleemicsls sDra(r ;t0oeenmiciadfsDrl(vo (4trxnif iadlptr ueo s) ruoxmpny4ll  mfcs (f rrmuroou1tpxn i3iysfs uanms;()trxrircoydom   i o (0setm(mpnudoptn ncsas) rum(  ;t0texomoeiat a2emnms (4arenircto1omDelieolt0teuoir nu1al  mivils  Drm(mpou0ale  fcilsfmDuan p;()trtrmr iydfptr i i t) 2xmim oodaltnlfes t  Duaxr ;o4olxo oetyd aDrm(vo;()tlerxr3iodopD ai s;t0t2xoio3oo1altelfcslsf Dtm(mpno0tpx mf3iat s2em(vp;t4aetnxo3iodlm  aneolt)trtmir3oydlm elieiat arra( o;o4tpeniiciasfa ranmonu0aleomf3oytopteauvils t2ur(m3nydole mics s a2um(ro;t1texnif3iyslm2eanvsnt4tltoiocoatom r n i s s2tmim3ou4ame  nvtls)sDrm( ont0oexn f3tld s2rmn p u4trtoif oy1lmteaneo (0 exm(mpio1ol n nci t  2rmu onu4opt  ietlsfs emumont4trenir3iy1oat an olt0 rtmxm3oodlltn fcslt srumur ou4alt mociydla eluvp;u4treoxrcta1la rlieo;t)srtoxm3io4lme mfctatfs2uax  ;t1teto f3tadfmDemuvsn(0 rtnxf tydfa rluvo t0teuoxo io4optemnei ()a2umxmonu0aetomf3ils a ul(vp (0trxrmf3iadoaDeai o;s0trxoxopnu4om  lictls sDtaxrp;o4alxo feiydla eauvp u)artrifciotlmtelu s t0 2to(opoy4ole lnvi (fsrtmxmpot1tpt miciatls2ulumsn(0 exrmr iatlmt  ieo;(0setrxo nudoptnlfesl( sDurumoot0tltoii3iat s2uau o u0texnmo3tytoaDe neo;s0srtrxr iy1lmtemfeiat)sruaxroou0tlxn ociyt m um(ms () etoxr3ia1faDeanvils  eumio oo4omenmnci s sDuaumpoo4ole ioeiasfm elu s;u)alxoxf tatlmDelivs;t) etrimpio4lp nmncil() ruru o;u1alxn ieilsfm2ul( ont) leomo3iotoaD lu o ( sexoio3io1lpeelfvsasf 2uaxront0aexo o3tadlm2rluvsnu0 etomfciotfptrauvo ()srtrxr3iodlmte nvsl()a2urx pot0opxn o3tad s ulu p t4 ltoxr3totfmtrai o s tetr(r3oy1ome mnet (f rraum no4oexoifciltfs2rm(vpn()tlxomo tytfmD ln s t  2xoxr3oydal emnesa(f Dra( pnt1tex ifeiltfm emn onu4arxomociatla ranvilt s2xoxrpoo1lm e nvtlt) rurur oo0tltn ietyslsDranvont4alxrxr iatfa eau s t)trtrxr oudom elfci tf rrmumonu1olt mieiyd m2rlnvo;u4tlenio3ty1omDeau o;s)s2uoxo iy4apeemivtls)srtmum oo0tex  ociyd aDea(vs;t4 rtnir to1oa rlneol( trxmxo3oodam emfvt tfs2rmxr ;o1olenioetyd a umuvo;t4aeeoxr3oa1omDrlueo;s)t2to(r3iodlpt  fes (fsDra(rono1tex  ocildfs2umuvp t0aeeoxfctytla  liei;t s2toiopno1om nlfcsls) rum(  nu0tpxoiiciytla rmu s u4aeenxocty1fat aivs;( t2toxr ou1op emfei t arraumpnt4apeo iciys m2elnvsnu0trtoxo iadlm e uvo ( t2umim3iodlle lnci t) 2rmu pnu4tpe mieilsla2emn o;()artnir ootomDelivo ( srum(o ou4ape  ietls)aDuauro;t4oeenioetydfa umuvo;t0artoiocoadfa eaneilt t2xoim iodole  ictltf rraum nu1tlxnifeias s el( pnt)trerxo oatomteai i;t t2uoio oo4ope mncsasfsDurumont4opxn ieiadls2emn s t)tltnxo3iydfmDrai i s texrxo ny4op elnes t)artr( poo4oetomoeias s2rmu snu0altrxo todfa eln sls) etmxr3no4lm elnei s  rtmum no0tltnmfeiat sDemn s;u)aeermf3iodfmtrli i t0teurxr no1alt liet s)arurx ooo1alx mi3iadla elumo;t)tetnxf oatfm  livol( srtr(o3nudap   fvtas)s2uau  nt4aetnmiciyt s rmums;(0tltnxfcoo1fpDe n o ()trumimpiudopenlnetls) ruau onu1tpt if3tysls2rl(mp u)areoif3oa1lpte uvs;()srurxrpiu1aptnlieil( a2rmxmo;t1tet ifciad s2ul( p u)altrioctytfp rli i t sexo(mpiudamtemncil(  Drax onu4apeo fcilsls2rl(vs t)alxnio3oadomtr nes (0 exrxmpnudlm  mncia(  Dumxmpou1ale ifetltlsDulnvp;t4 rtrxrctodlaD  n olt0texrio3oo4lm n nvt ()sDtmur ou4aptn oeiytlm elumsnu0 lermo3ia1faD anvils)srxm(o nydapeelfvs s)s2uaxrpno1alxoifciasfmDem( onu)teeoxo3io1lp r nes;()srumxrpnu4omte netat aDtmxrooo1olt if3ilt a um( s;() lxomf iotoptrai o;(  ruriopiudolen iei t srtr(m ou1tee mf3iyslm uln s;(4artrmoctatoptean s (0srxm(r ou1omtnmneilsfsDtmx o;o0aptnmo3iyslm eaums;t0trxnio3ootlaDeliei;t0t2xoxo no4lm emnei s) 2raump;o1olenmoeiasls2rmnvsn() reomrcoadlpt au o;s)trtoiopno4am nmnvtl(fartmum ;u4alx mfciys a uan o;u)tlxnxfctydoat li i s) rumxm iy4ameemfvsa(f Dtmx  ou4tptnmo3iysfa rlnvs;(4areoirctydlaD  u sls0 2um(mpny4lpen nes ( s2rrx poo4texnmi3tatfs2uanvo;(0trtnmo ty1fp elneo;(0seto(o3nydlp nlnvsas) rtru  nu0alxo oetyd a2rm(mont4 renxf3ia1fpt livi;()setmxmpno4apenlfviat)arrau o;u0aet iicildfsDrmums;(4aeermf3ta1om e neil(  rxoir3oo4ol   ncsa(farraurooo4tpe  f3tlsla2ean o (4artnmfcoydlm eaivo;t0s2xo(o oy1alte fvtat)srtrumpou4opxomi3iysfmDemu onu)tltrif oa1fmD ln s (0 rumim3oo4op  lfct tfartm(m ou1aeen f3tyd s ulnmpnt)trxrmfciatopD lu o () rurxopiu1apt lieil( sDtaxmpno0opt mo3iyslaDrauvonu) rxoioctotom rai i s) 2toxo3ny1ap   ncs (fsruaxm no1altoif3iat mDrlums;t0tltnxociydomDrlies ()t2toirpiy4ope mfcil() rtm(m ot0apxnmi3ild aDeanms u0aetnxfcoodfa e u o;s0tetmirpiydlleemivils) 2rm(  no1aleo ieilslaDel( snu)aeenir3oatlmDeaueo;() rxo(o iy4oltn nvtatf 2uax pot0tet mo3ild m ua(vs;u4altrmf tadoaDean ils)truo(rpoo4olte nvsls) Dtmxm ot1alt  ieils aDulu o;u0 rxrir io1faDraivslt  ruriopio4lm  micilsfsruax  nt4oltnii3iltfa2eau s (0teenxf tydlp e i s s) 2trio3oy1optelnvsl(farumuro;o1ole  i3ilsla umnmo u0artnxf3to1lmtrlu sls)seur(m3iudal   fetlt)s2rmxm ;t0teeomf3iatlsDuanvp;()altoifcio1la r uvi;(0 ruoxr3oo1lmt lncsat) 2tmu  ou4texn feiltfs ua( s t)treoir3tadfmteaieslt)t2xmxo3ny4apeelfcil(f rra( p;o4aee ifctysfsDeaump;()aetrio ootfptrau i;() etmxopiy4lmen ivt (faDtr(mont0olxn octaslaDeaump;t4arxomrcoydoa elies s)srxm(o iudoptnmivs (fartaurooo1aee  fctldfaDelu p t4arenxocio1oaDrai o t)srto(mpoy4lme miesa(f Drrur ;t0altniociaslsDuanvs;(0 eerirctodlp ean o t0 rurxrpio4amen nei s) rurum ;o1ale  feiysfmDraumpn()aeeniocoo1lpt  uvi (  exmxm3ou1altn fcsa(fsrtaxmpno1tpt  f3tadla umu p;u4artriocta1lp elues;t)srurir3ny4llen fei (  2trxm ot1aexo oetyt a rm(vo (0 rtoio3oa1opD anei (0 2xo(opiy1amt mnci t srurxrono0olxo fciadfaDulnvp;t)texomf iytfatelivs s) ruo(opnydomeemnvsls)aDrrxrpou0oltnmieild m2ulumo;u)alxomo ootla   ues s) 2ur(r3oodlmt lfes t  rraumpot4apen o3iyslsDuan p;(4 reoif3oodfmD lu il()t2toir iu1amee fcsat)aDrmxr nu1aeenmociytfs2elu o t4 leoxfcoatla  li s s)texoimpiy1apee iviat)sDrr(ro;o1aetnmf3iydla emnmo;u0texomrcia1fpDrliei s seur(mpno4omtn iei s) rumxronu4teeomf3iytfm2rluvo (4trenif io1lpDrauesls) rxmirpnodapt mfesat  2rmurp;u0alxnmo3ildlaDra(ms;t0aeeomr tadoa rluvo;t0t2tr(mpoo4amee fcs ()arrmu p;u1oeenio3ils s2ra(vpnt4arerif iodlaD  nei t0t2tr(o3iy1olt liviat  Durx poo0optn oetyt a em(ms;u4 ltomf oatoptrlieol(0 2xo(rpoy1optemnvil(fsDumxmo;t1opxn oeilsls2el(vo u4aetoxr oa1faD lieils0trxoir3nudolenmicsas a2rrurpoo4tpto o3iys m ea(vs;(0 rerxr3to1lpDe i il( tetoxr io1op nlfesls aDrm(r ot4oeto f3iasls eau p;()aleoxrciy1oaDelies t0 etrxopnu4ol  lfes t)sDtr(m ;t1tpe mictltfa2umumo t0trtrmr3tadopt aies t)trxrio3oo4lp n fvtasfarra(  ou4olen fetatfm eaumpnt)trxnif3tytlmteaiei;s0 eum(m oy1ll   icslt sruax  nu0tlx  feiydfm2elnvsnt0aeerir3to1om rlu olt sruoimpno1lpte feil()sDrmurpoo0aexo f3iatfa2umnmpnu0 ltrio3todfaDean i;()tetmxo nodaleemncsl(  ruaxrpnu1olxoio3iytfm em( o;t0aetoxocia1lpte uesls) rxr(m oodlptnmivia(fa2uaxronu4tlxomf3iadfs em( pn()tltnmrctodlm  livol() rxrir3iu1lltelfei t sDtrxmont1aeeomfctadfa uluvsn(4arxoxrcoadfpt  neol(0s2xoxr3nu1lm  lfct t sDtmumpnu0opxn iciyd a emu s;t4alerxr oatop r uvo (0srumiopiu1llenlivias)aDtmxrp;u0tltnmo3tys aDemumo;(4 rtoxfcoatomDeanvols0srxrxo ou1ale mnvils) Dta(rpnu0aetniiciatls2ra(vo (4trerxf3io1lmte uesls  rurio nydlmeelfcsl()s2urxro;t0tltoio3iltfaDrlnmp;() reomoctadopDeaueils)teumxr no1amenmiesltfs2rr(ront0tlxo ietls a rlumo u) rerio oydom  aivo;(0 2tmxopio4lle liei sf 2tm(m ;u4apenifcils m rm(mo;t4 ltnif3totfmtrau ol()srum(mpio4amtnliviatfaDrmxrp;u0tpenioctyd m2emn sn(0artrir3iytla ean il( seurio3iodole  fet s)a2rr( poo0oex  oeiltlsDeanmp;(4arxnir iytlmDran ils) euoxm oo4op n nes t sDtmur nt0oet mfctldls rlnvonu0 etnxf3ia1faDeli o t setmxopiudlme mnetasfa2rm(mpnu4openiieiltlmDrm(mp (0 rxoifcta1oa ran o;(0srumio ny4ol n iesls)aDurxr no0tlxnmoeilt s ul(msnt)trxnxrciytom rau o s)srurxopiy1ol  lnci sfsDtrurp;t0alx  feiltfs2el(mont0 ltnxo3io1lpt  ieslt teto(m no4alenlneilsfs2tru  ot1oleomfetlt a2rm(mp t4 rtrir ty1la rlivo;() 2tr(m3oudal n nvt (fs2um(rooo0olxomociat s emnvo;t4texrmfctadlmtelies ()t2uoio3ou4lmenlneils  rta(mo;t1alx iocilsfm2uan pnu)areoirctatla   u ols)trtr(opio4am emiciltfaDumxront4oeen octatfs ul(mp u4 ltnxr3iy1laDranvsl( trxmim no4ll nmnetat)arumur nt0tee mf3ilt a2rm(mo t4alxrmo oadoa rln ol( srxoxr3oo1op emneilt aDumx o;o4alx  f3tltfmDra(mo;t0aeerircoodomDelneol() rtrxmpoodam emici (f rua(m ;o0oetn fctlt a2ulnmsnu4aexrmfcoy1oaDelnes t) rurxm3iydaptnlnvtasfsrrr(mono1oetn ociaslaDum(mp u0aetnmoctydla r ieo t)s2xoxr oy4lp n nvi t a2urur no1aet mo3tltfm em(vs u4 etoxr tatoatrauvslt  2tr(o oudapt  nvtls)sDra(  no1tle mfcias mDraums t)tleoxr totoate neslt)seto(r3nudlmte feil( sDumuro;t0oetnio3ils a rln s;u4alerxfcio1latraieo;( t2toxo3io1optnlnetlt a2tax poo4tpen iciadfm elnmo u4aexnxf3oo1fpDeln i;(0 2um(rpoo4al nlnes ()aDtr(  ;t1tpt  oeiatlm um(vp t0 eerir3oa1omtr nvo (0 euoimpou4al elies sfs2raxmoot4teenioeiasla2em( p u0 etrifcoa1lmDr uvolt trtoxo oo4lp nlnct () 2uru pnt4apxniicils mDumumpnu4 etrioctotlatr uvslt0 ruoxmpnu4lp nlnvi (fsDtau o;o1opxnmieiatfs rl(mpnu) reoirciy1om   i s;t0teumiopiy4lmenmnctas srtmxmooo4aleo ociydfm2ean s;(4teermr3oytlaDr n i;t s2xmio iodlm n fciat) Dtmx  nu4aleo o3iadfs2eanvpn(0arerxr3iatlpDrau slt0 2xo(opnu4omt  nvtl( s2tau  ;o0tlx io3tltfa emuvont) lerxf iadlm ean o;(  etmio oy1lpeemfctat sDtr( pot0open fctys m em(vpnt0 etnmf ty1laDe nvsl(0t2umir no1olee fct t aDrr(mp;u0optomf3iltla2rl(ms t) rxnxoctydlaDrln i t0srtmir iudopt  nct sfs2urxmpot0aeto f3tadla ra(mo ()tlxrxf iytom ran s t  rxoxr3no4lm   iet t) Dtaump;o4tpeomf3iys a2ulumsnu4tetoxocoatoaD ai s s t2xoxopnodaltn fesas srtr(m nu0tleo fetltls2rlnvonu) exnif3oa1optrln s;t  2uriopoodlmt  ici tfsrrmurono1apenmo3tatlmDumu onu)trtrifcoy1lpt auei;t)trtoirpoy1al nlneta(  Duax pnu4aetn feiat a ul(msnt4 rtomr oy1oaDeauesls) 2uo(rpoy4lp elfctas)sDurx pno1tee  i3tldfa rm(mo t0tltoxr3iytom raueils  rxm(o iodapte fct ( arur(mp;u1teenmfctyd m rl(vpnt0altrxo todfmtranes (0t2uoxo no4openlfcia( s2rmxmp;u1olxn feiadlmDua( s;u4 etrxr oy1la e i o;()trxmim3ou1am  lncs t) Duax p;t4oetomf3tad a2elums u4arenxf oydlm e ues s  2umxopiudopenlfeslsfs2rm( p;o1olxomieiydla elu ont)teenir3tadfpteanvilt0 etrxopny1lpt  fctat) Dtmx  oo4oeeomfetydfsDrln s u0arxnir3iotfa eaivslt)sexoxm no1op nmnct ()a2uaxmono4altnioeiyslm2ran s;u)artnio iodoa  livolt s2ur(mpny1op  lfvi s) 2raur no0aeto feiltls ulnmsnu0 rtoxo3tatop rlnvo;t  rur(rpiy1al  lncs (fartau  ot1altn o3tas a emn o u)altomf3to1lmt livols) ruoxo3nodomt mfeias)a2ur(mpot0olt  iciatlaDua(vs;()alenxfctadomte i i;( s2uoxm no4lm n ictls sDumx  oo0alx  f3ild s ul(mont0teerif iadopD anei;t sexoiopnodamt  icsatfaDtm(  ;t0tpe  f3tad m2ua(mo t4tlenifciodomDrlnvols0 2urir3nu4ap  mfetl( a2rr( poo4alt mf3tlsfa2el(ms t)trtoir io1fmt ln s t) 2xo(rpou1amte fvil(fa2ta(rp;t4aexoioeildfs2ulnmo;t4tltrifciatfateliei;s) 2urxm3iydomenlfviasfarrmxmpnu4olxo fctltfm em(von()aeenir3oodomte nvo;t)teurxopoo4lpenlneilsfartmxmo;u4teeoiicildfa2ean s u4 ltnmr3iotlmDeluvslt0srtm(mpio1lleemnvsls arua(  no0tleoii3ild s eau sn(0alxomrciatomDe i ol(0 eum(r3nu4oltn fvtlt) rrr(m nt4tpxn feiadlaDuauvp t0aexoir tadfm eanvi;s0s2xoim oo1ope mnes t srrr(mp;t0oleoiicild sDel(ms ()texrxrciy1fmt lues t)trum(mpnudlltnmietltfsrrrx  no4optnioctytla2ean pn()trenxfciytlmDr i ols0 2tmxr io4op nlfci sf rumum ou1tet  iciad mDelnmp u0 lermocootopDelu i;(  rumiopoydaptemnet s a2uaxr ;t0oetn ieiaslsDrm(vp;t0tlxoxo oydlm   uvolt)teur(r iu4open nvi s)a2rrum ou4aptn iciysla rlnvp u0 lenif iadfptelu o;(0t2tmxm oo4olte ncia(f rtr(m nu0tle  o3taslaDrmnvon(4 rtrircootfmDran o s)seumir3io1lltnlncsat)sDrmxrono0apeo o3iasfs2ua( pn()altoio3iytlpDran olt  exo(mpnu4omenlnvias) 2tmx  ot4olxo ociadfmDrl(vpnt) lxrmo ta1opDraivo () rtm(r3iu4om  mncta(  rtmxm oo4aetnif3iltlm emumo;t)tltrxr3oadlp rlieo t0t2um(opiodal  mfvsls)artmur nt4oetoiietlsfaDeau s;(0trtrmoctodfaDr i o t0t2to(r oudop  lfcs (fs2tr(rp;t4tpxnmoetltfmDrl( pnu0 exrxr3ta1oa rlivo;t) etmxm nydlptnmneia( srrru ooo4tpen fciadlsDrlu snt0tleoiocto1fpteaivs;s truoxrpoydaptelfvs tfaDurumpoo4alxoiieilt s rm(mo u0arxrmr oytfm r n i;()trto(r ny1ll nmfetas)sDum( ont1tltnif3iydfmDrlump;t)tlerxfcio1omtr ivi t)srxoirpou4lpee nvilsfartmur ou0apt  f3ilsfm2eluvpn(0texrir tadoateaivo ()teto(r3nodam e fvsa() 2urxmo;u4tlenii3iadfmDra(vpn(0 rxrxo3oo1fpDrlivo t0 2xoir3iodolenmietasfsrtmxm ;o4olenifctadfaDulnmp t4 etoxo oodlaDr ues ()t2urxm nudole mncilt  Dtmxr ot0ole iociad a el(mo t4 lxoiocta1opt  uvilt t2uoim ou1lle lnvs (f Dtrur ;o1tex mo3tlslm eaumpnu)aeeoxr3iy1omDeanvo;t trxr(m3iu1omtnmfvsl( aDraur ou4oltn iciltfm2ua( o u4trxnmr3oodoatr uvs;() ruoim iydlmenmfcslt)s2taumo;o0texniiciydlm2rauvp u4arenxf totlpDraieo t  2xo(rpou4lmtnlfvs t a2taxr nu4tpe iictydfmDemn p;(4aexoio oa1fmDe i o t srxoirpou4alte fes s srrmum ou1aex  fctas mDul(mp;t4arxnxfctodfp  luvol() rxo(m iudalte nvt s  Drau o;o4aptn fciysfm uanvp t0trxoxr3oatomDrai o;t s2uo(mpiudll e fvt t sDur(rpnu4oleo oetls a2uln s;t)tlxnxrctodopDean o (  etrxo oodapeemfeil()srtau o;u1altnmfeiat m2eaump;t0teenxo3iadlpt ai s;t trumirpoodamtemieilt)srurumono0tpxn f3ildfa2rau s (4 rtnif oatoaDeauvi;s0setrxopiy1omt mivs ()sDtmumoot4apxnmoctyd a2umuvo;t)trxnir ootoatrai o;s t2umim iu1oltn ncs ()aDtrum nu1oeto feiatla ra( s;t0 lxnxr ty1fat aueol()seuoio3ny1lptn nct t srta(rp;u4tle  oeiydlm emnms u4altoxf ty1lpD  nvolt  rxrxr3iodllt mieiltfaDtrx  ot1oet moeiytlm2rl( o;u4 eeoioctotfp   u i;s)srxoxm nudap emieils  Dra(rono0tltoioeildfa2rmn o;t)aexrxrcoytfaD  iei;t s2um(opou4ol eliesat) ruaxroot4optomieiytfa2um(mp t4 leoircta1fat aueilt0s2urim3io4alt lieias  2umx ono4tleo ociat mDra(vpnu)aleoifciydfa e nvsls0sruo(r3nudomtemnet () Dtr(ronu4apt mfeiasfm rl( o u4aexrxf3iy1fa elu o t)trumio3ou4lleelncs s)sDtmum oo4tlenmieilt mDrmn on(0 rxoio iydlptrlnvo s s2um(r iy4am elici s)s2ua(  ;t4teenifeilt s2elu p;()arenxfcoy1op eluvolt)t2tmir oudamtnmici s sruaurpnt1tet mfciatfsDrlnms t0tlxnmfcoa1fpD lu i s)trumxmpiy1olen nvi t  Drau onu0aexoioeiyslm2ea(von(4tlenxrcoytfptean s;s0s2xm(o3no4altemieia(  rta(  ou4alx  icilt s ra(vo u0tlenmr tytlmt  nvslt0t2toxr3iy4lp   ivsl()a2ra( ooo0alx mociysfa eauvs u) rxrir oydop r neolt0trto(o iydlpt liet t)aDrmxm no0teenmoeiys s emuvonu)arenmrcootoatrai i s0srurir ny1lpeemfesa(f 2rrx pou4oeto ociys m rmnvs u0alenmo ty1omD lnvsl()trxm(o3nydam e fcil()sDraumoou0tpenioeiatfm2ea( p;t)treriociy1op r n ols0 eumxm3nodlp  mnci ( sDumxr ;t1oetomo3iltfa elnvsn(4arxnif3iytfm r n i s)trurxrpio1altn nvt s) Dtax  ;t1altoii3tatfs em( ont0texrmo3ootlmteau i s0texoio3oy4lpte fvi sfaDtm(mpno4alxn oeiadfmDua(vo;u)alxnmo ty1lpt livo s)srxm(r ou4ll  micil(fs2ur(  ou4altomietydlm2elumo;t) rtrxfcia1omt lu i t)teumxo3oo1omtn fvsl(faDta( o;t4tlx mietatfs em( s t4 etoirciotoptr ieslt)teto(m ou1lmtemfviasfaDtr(  ;o0apt mfetasla2emnvsnu0 ltoircoydfpDraieils)s2xo(m3iu4ap elnviltf rtm(mp;t0teenmictld s2uln o u4trxoxfcoy1om  an il( s2xo(m nu1altnlivsls) Dtaur ;t0apeomieiasfsDrm( o u4tltnxf3tadopDe uvi s0t2toiopoo4openmfct ()s2ur(moou4opxn i3iadla um( on()altoxr ty1faD lnvs;t) rtrio3iydlpe mivias)arrru o;o1tlx moeiatlmDulnvsnt4 etrxf3oodfm rlnvil(0trtrir oo4oltnmnesa()srurxrpoo0oetniieiysfm eanvs u)arxrmf3ta1omD luvslt0trtm(r nu1op emfeil(fsDrr(m oo4openii3tld m2em(vo;u4aeenmr3ta1fmt lu ols texrirpiodoltn nci tf rtaxm ;u1alxnifetls mDrm( p;t) etrmociodoa eanei;t)texoimpiydlpeelnetl(f Dtm(m nu4tptn ociad a ua(vp;(4 rtrmr iydfpDrlu ols0 ruoio no4ll elfvtas sDrmu p;t0alxn oetydfa2uanvont)altoxrcio1fmtrlu il(0texmxrpiy4lleemivtl(faDumxrpnt1oet mi3ild mDra( pn(4teerir io1lpDeaieols)s2tm(rpnodoltnmnei s aDumxr no0aptnifciatfaDelnms t4 rtnirctadlmDr iei s  exoim ny1ll e iei s aDrau  nu4texo i3tydfa2ra(vp;t4aexrircia1oa eaivi;s) rtrimpiy1alt lfviat)a2tmx ooo0alxnifctatls2ulumo;t4 lxrif3to1lmtr ivs;s teuoxm3ny4ll  mfet (  Dtrxmpot4opx moeiydfs um( snu4trxoxf oo1fa   n s s0trurxr iy4lme mfviatfa2umxrp;u0olt if3iys a ea( onu)trxoxf3iadlm  aivs;s trumim nu4omt  nvia()arrm(ronu0aleoiietatlaDemnvp t0trtrxf todfm ean s (0srtoxr3iudlp n ietl()sDrmxro;o4opto ieiytfm ea( p;t0aeeoio oy1fm rli s;s)trurxrpiu1al e ieta(fa2umu  ;o4tex micias sDumnmo u)altrxr3tytfaDe n s;s0s2xmxm3oodolte ncsatfaDrmxrpnu1ape mieild m2em(ms (4aleoir iodfa ran i;s) eto(m oy4ole mneiat)s2rmu  ou0tex io3tlsfa2rlu o;t0 eerif ty1lm e ivo;s)setmxr nudolt  ivi t arrr(rp;o4tee io3tydfm2umuvpnu4aexnif iatomDrau i;()srtm(rpoo4al emfvias) rum( poo1tpxoifciydfm elnmpnt0altrir totfmD  uvs (0s2toir oy1apen fcsa(  rtmxm ot1oleomf3iydlmDua(mpn(4 rxomrcoodfate i i;t0 eumxo3oy4ol   fcs s) 2raxront0aleomieildlm uanmsnt0tlxrxrctodoateai i;s0 rurxmpiy1altnmfci t)arrr(  nu0aptomoeiys s ra( p (0aetoircootoaDrlivi (0sexm(r3no4alenmfcils s2urxmooo4oleo ieiyd sDeluvo u0alxomr iy1latr nei;t0t2trxmpiudlpe mfcs sfs2raumpnt4tptoifctydfa eaump t)trenmfcia1lpDr uei;s0sexmir nu4am  miciat  Dra(  oo0tex mi3taslm2eanmo (0tltoio3oo1oa ean sl( trxm(r3ou4amee fvilt a2uaxmpnt4tlx  o3iytfa eanmp u)aexrmo totopDean i;s)teurxmpio4lp   netat)sDtmumpnu0altn ieias m2umu ont)trxomo3oadla   ieilt0srumir3oo4lm  mfctlsfs2ur(rp;u1aleo oeiad m2ranmsnt4 rtrio tydlat livilt trxo(m iy4alt lnetl()s2urum ;u4aptomiciydls ean pnu0teenmo totfaD li s s0s2triopnodllt  nvias a2rax p;u1apx iietasfaDel( pnu4areoio3tytoa   uvol(0 exo(m3nodopenmfvs t s2tax p;o1oee io3ilsfaDuauvo (0 rxnif io1oaDe uesl(0 eum(rpoo1lmee fvi tf rtrxrpoo0olen i3iatfs umumont0aexomr3ta1opte uvils)setoxo3iy4lmeemfct tfs2urx  nt4altn ictysls rauvs;(4tetoircoytfa e u o ()srxmxopio1ole  fvsls aDumxm ;t4alx mf3iatfaDeluvo;(0arerxrciytfmDrlnvs;t srxmir iy4am elfcia( s2rr( pou4apt  oeilt mDuaumo;()alermf3oy1omt lu il(0sexr(mpiu1oltelietl()artmxmo;t4tptnii3iys m2eluvp;t)alenxo3tatoaDe i i t) 2umirpiodlmte ietat arum(mp;o4teeoif3tyd aDumnmsn(0tetrifcia1op eluvs;() rxm(rpio4lm elieias  2rm(  no0tpen o3iysfm uluvs;t0 lxnxo tatlptrai i t  2um(r3ou1ap n nvtat)a2umxmpoo1oeenmi3iad s2emu p;t4trxoirctatoa e ues t)texm(opnydamtemneslt  Dumxr nu0ape ioeildfa emu s;u)arxnxr tytfmDraues s) 2xo(r3oy4llenlfvtasf Dtaxroou0altomfcils aDuluvon() etoir ia1lpt lneo (  rurim io1amen ietl( sDrm(m ou0teenioeilsla elumo t) etrxr oa1fa eln o;t)texoimpny4oltn fetl() ruaurp;o4tlen f3iatls2emump;t)texoxr3iy1opD  nvi;s tetrxo nu1ope  net s  Draxmo;u1aeeoif3iasfsDrmuvo u) eenxocoydla rlu o t0 rtmirpnu4op  licta( a2tmurp;t4aexnmictadlaDrmn p u)tltoxr3iatfmteaues;()teum(r3io1altnmnvtat) rtm(rp;u4aptnio3tad aDran ont) etrmfcoodfpt ln o t texo(o3nu1opt mfvsa( srrau onu4apxniieiadla ran o t0 rtoio iotla   neo s0trumxr3io1lp e nesl( arrm(mp;u4alt mi3tasfs2emnmo u0alenxo3totomD aivils s2urio3iu4lpee fvt tfa2um(  ot4apen i3iytls2uluvo (4tlerif3oydfmD  n s t0 rxoxm oudlp n icilsf rurur nt0aee  ieiys a rln s u4trtnio tydfp rlnesl() etr(rpiodom e ncias  rrmxm nt1oeenioetlsls2rl(mpnt)aeeoio3iatopDr iei;s)t2to(m iodap e ncs
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;()teto(mpiu1ol   fvtasf rra(rp;o4tex mfctysla2rlump;u4trerifctodoa eluvi t0 rxr(m io1ap n ncslsfs2tr( pnu4altn ietytlsDua( p t0 rxoiocoy1oateanvo;s)setmxm3oydomen fvia( srraumo;o1tetoiociad mDuauvs (4 ltnio3ta1la r ieo t0 rtoxm oo1alenlnctls) rraxm nt1apeo fetydfa umnvo;u)texnmocoa1oatrlues;s) rxmiopnudal  mnvils  rtrumpno4tleo ociytfa2em( p t0tetrxo3oa1fm   ivi s0 ruo(opny4ol   netas)a2rmum oo1tex mfciatfmDua(mo u0 rtnmf oadla  anei t)tetrim3iudomtelneils sDraumpot0tex mieiysfa umnvo;(0aleoio ta1oa rai i t0srtmim oo1op emnci t s2tr(mpno0oltn icils s2emumpnu0tetrxr3iodfp   uvi t teurxo3nodam nmivsl(f Dtm( p;u0apt  ieiatfsDel(msn(0arerxf3iytoat  nei t texmim oo4lm  liviltfa2tm(moot4aleomoetldfmDemnmo;t4aetoxf3iytlmteauesls0teurxm3iu1lltelicsltfarrmxmooo0aptn ieilsfaDemnmp () ltomfciydomtrauvi;t  rumir oo4aleelnesl( sDrm(rp;u1tlxn ictldlm2eaums t)trenxr ia1fp  aues;(0 2xo(m3nu4op n neiltf rrmx pou0altnmf3iytlm2emums;(0alxoiociadfat an o;s) 2xrxrpnu4al nmiesa()a2rmur nt4aleo o3iasls2eln s;(4trtoxoctydfptrauvils  euoxrpnu4apte fei sf Dumx oou1opx moctydfs2ulu p u0altrmo3oa1oaD  n o;s texoiopoo1om nmnes s  Dtm( o;t1tlxnii3tas s raumont0teeoxocio1fmteluvs;t0texoxm nu4alte nvsltfaDumxmpnu0opt  f3tlsls ul( p ()aeeoircoa1fp  ai il(0t2xmimpoodopt  fesat s2uaxrp;u1openif3iydls2rlu ont4teeomr iadomte nvil( trxmxopiy1opt lfvslt aDtr(r no0tpxnio3iydla2ra( snt0trtnxo3oa1la r uvs;t)t2tmio iydlp elncta() Dtr(m ou0teeo ieiltla ean o t4 eenif ta1la rliei s0trxrxrpnodop nlivil()sDrmxroot4tpenmociydla rmu s ()artoxf3oy1lptr neols0 ruoxr3no4op e nvs s  Dtax  ot1apxnmfcilslsDrmn s u) lermr io1fptelnvilt)trxrxmpiy4amtemfetas)srtaurp;t4oeenmo3ildlaDelnvon(4texrif iodfmt  i ol(0t2tm(mpny4lptemfcta(  rrmx  oo1oleo ieiltfmDeaumon(0altnxf3tydop elieils trtr(r3oydoleemfct tf Draur no4apx mf3iadfmDuau s u)tltnif iydlaDe nvs ( tetr(r no4openlfvs (fa2umxmo;o4oleomi3tlt m uau s;()trxnxf3ia1lmtelivs;s0 2xrim no1omte ncsat  rra(  no4oexn fcilt m elu o t0 leoir3ty1opDe uvi ( trxmir3io4op nmfciltfsDtaur nt0tlxomictytfm ra(vo;t4aleoxociodla elnvo t) 2urim3oydop emiet () 2ua(  nt4tpeniiciys sDea( p t)altnmfciotfa  luvols)trxoxo iydll nlnesl(fsDtm(r ou4tpto o3tas mDumnvs;t4aeermrcto1fpt aueo;(0srxrio io1ll elfctl()s2ra(r oo0olenifeild s2uaumsn()tlenxfctodfmDran ilt)sruriopiudolenlnvsat) rrmxro;u4ole  ietytla2rauvp;u4aexoir iytoptelneol( tetm(m oydom emietl()sDra( pou4openifctyd m2ul(vp;(4tlxnmo ta1oaD  i il()t2xrxopiydomenmfesl( a2tm(rpoo4tlenioeilt m2rm( p;t4aetrxf oytlpDraneo;t0 eum(m iy1op  mfvi (f Drax  ;u1tlxomiciysfsDum(msn(0texoio tytfp r u i;t t2xoirpoo4olt micia() Draurpot0aet  octld sDelnvonu0altoxfcoodlpD anvo s) rto(opiudlptn ncs ()s2rm(rooo1alx ifciad s um(msn(4aexrmrcoytlm  ai ol() 2xrio3oo1olt mfvs ( a2tru ooo4aeeo o3iyt sDraumsn() rtoxfcoydlatr nvslt sexoxmpoo4llen fvilsfaDtau pnu4aetomf3iyd s2ulu p t)artrio iotfatelu s s0srxo(m no1altnlfetl(f Draur nt4tlenifetydls uanvont)treomociatfa  livs;s)srtmxo3oy1op e fei ()srum(r oo1tpxn f3iasfa2eaums ()aeerioctytopteaueo;s) exm(m oo4lmtemnct ()arum(ro;t0oex  fciyt m uauvs;t4aleoifcootlp r uvilt)t2xo(m io1apt  ict s)a2ra(ro;t0tpxomfeiaslm2ua(vs u0aeenir3oytlat lnvilt)sruoxmpny4open ncs t aruru  ;o4tetoiociytlm el(mpnu0artrif3iadlmteanesls)seur(m3iy4lp emfes (f 2rm( pot4aeto ictatfm emn snt) exomo3totfm e i sls trur(r iodlptnmietat)arumu o;o1apenifctytfm2eluvpnu4arenir3ty1oatr n ol(0 eumim no4amt mnci ( arrau p;u1alt mieildfa2eanmonu)teeoxfciytlptr uvslt  rto(mpny1ole lneiat sDtaum ;u1tpe mf3iadfs ea(vs;t4 lerxo3iydfmt auvi s  rtrxrpno1ll emfes t)aDurxmoou4aptnifetydlsDrmnmp t4aeenio iydfm ean i;t)s2tm(opiudale  fvsa()aDum(mo;t0tltomoeiyd m rmu o;u0alxnmf tytlatranvi;()t2uoxrpno1ol n ict ()s2tr(m nt1apen ieiyt a2umuvo;()aeeoirciy1oatrlnvslt)t2umio3oo4al nmncias aDrrxmoou0aee mf3tadlaDul(vo;t0alxnxr iy1opt livi;s0s2xr(opnudalt  neilt) rtrxrpno4tptoiictydlsDrl( s u0alenifcia1fpD  n s s)s2xoxm oodlpen fvsls s2ur( oou4aex iietydfmDranmp;(0trtrxf iodfpDeau o t0trum(m3iu1ale mietat)arrm(mono1tee ii3iysfsDrlumo u)tlxrxo3ty1fat lues (  2xr(m io4ll nmfct t  2rr(m ;t0aexomoeiytla2umumsnu0 lxoif3oy1om  aivo;t t2tr(o3io4omenmfvi t)arururo;u0oetn icias m2emumpn(4 rxnxr ty1fateai s t teto(mpoy1lmtemieilsfsrumxr ;u1aptn f3ils s2ra( pn(4teerif3tadfa eaieols)setoxrpno4lltnlncta( s2rrurp;o4aeeoifctydfs umnvs t0aeerxo iatfmte ivi s teum(mpiu1ope mfvi s) 2um( pno1altnmfeiadfa2ul( p u4aeerxo3iodlm rlies s  exmxm io4op nlivs tfsDuaurp;t1alt  i3iasla ulnms;u4tetnxoctotlm e n o;s)truoio iy1apte iciat  2uax ont4olt  f3tlsfm uanvo;t)altrxf iodfpDe ieo (0t2tmimpnydomt  ieslt  Drmxr ;o1teeoiietlt m2elu p;u4arxnxociotop eau i;(0s2uo(o iydome  ictas aDtaxm ou1oet ifcilslsDemu o;u)alxnmocoadomteaieils  2uo(r3iy1amen fct s)arua(m ;t0tpxn i3iytfaDra( sn() renmf3ty1opD aivs;s0setrxmpoo1alte ietlsfs2rmx  oo4tpxoifetadlm ulu sn() lxnmrcoatfp r ivo t t2xmxmpoo1ame lfei s sDtmxmpoo4oeen fetls s2umump (4 rxoxo3ta1lmD aies;t)trxrxo3iydllt lfetl()aDtrxro;o0tpx ioeiydlmDrmnvpnu4tlenxfcio1lpDe iei t  2toxm3iu4aptnlivtatfa2urxrp;u0tlx mfcildfaDea(ms t4 ltrifcoa1opDr uvo t0trtoxr3nodopen nesasfsruax pnu1tltnifeiydfaDrlumsnt)aexnio3ta1fa r i o s0texrxrpoudamee fei s  2rmurpnu0tlt if3ias mDul(vs (4 renxfcoydfmt  u i;s) exrxr ou4ame lnei t sDtm(r ;t1tlxo o3tlt sDea(mo;t4 ltrmf iotlpDranvs s)trum(r oy1omt mfesa(fa2tr(rp;o4texomi3iasfaDeln p;(4tetnxfcoydop r i o s) exrio oo1lm e fcs s artr(r ;t0opto f3tatfa2ua(mp;(0alenio3iydop  aueilt texoxrpnu4lmenmnvt ()arrru  no4oexnmf3tat m ul( pnu) rxoio totop  aueils)t2tm(o3io1ll elncil(  2raxroot4alto f3tat mDuanmp;t4trxoio3to1la ean s;()srxrxo3io4lmtn fvt (f rua(r ;u1texoio3iltfs2rl(vs t)artnmrcoadlp  ai ils0truo(rpio4lm nlneiat)artau onu4oltoif3tysfs2ul(vpn(4 exrxf iatfmDrai i s  rxrio3no4aptnmfcs () Drrurpnt4aptoifeiadfs ul(vs () rtnif3oodfp elu i;t) rtriopou1optnmneslsf 2uru ooo0tpeo f3iat s el(ms (4aetomr3totoaDr neilt)s2umxr nudol emiei (fsrrru o;o1oexo octldlm ua(ms;u0altnmrcootfm eauvi;(0sexrir ou4ap n nvtat sDum(rono4opx iieilslm ea(ms;u0 rtrmr3oydfm rai s t)trtmiopoo4lme mnvtls s2tr(ro;t1openifeiadfsDea(vp;u)tlxrxr tatlpD aiesl(0sexrim3ny4apeelneia()sDua(r nu0apen ietaslm ra( s t0 etnxfcio1opDeauei;t)srxrxm oy1lm   ivs sf Duax ono0aeenif3iys a um( s;()tlxrmfcoo1oa ranes;t s2uo(mpny1ame lfvslt sDtaxr oo1openiieildlaDel(vp u0aeeoxf3tytoaDeaiei;t0 exmxm3iy4lp nlfes (f Durx ono0tlxnioetls m ra(vpn(4 renxf iodfpDr i i;t srurio oo4om e nei t)sDumumpnt4tltomiciasfmDeanvo;u0 eenmf oodomte ivs ( trtoir nu1olt lfesas)sDtm(mono0texo i3tatlm2emn s;(0altoirciatlpD auvo;s  rxm(m3oy4lltnmiviasfaDumumpot4tpt ioetltlaDuan p u0 rtnmf oodlmD aneslt0setmio3nu4opte nvt tf rtau  ;o1apt  feilsfmDea( sn()teenmf3oadfpDeau i;t trtoxmpiu1alenlnvt t srtaxmont4altniocils a2ulu pnu)altnirciotfa   ieo ( trumir3oydapte ncsa(f rurxm ;u4texnmieiadlaDra(ms (4 lenxocia1om eli s;t)tetmxo iydame  nei sfsDtm( poo4tet mi3tld mDeln snt4tltnif iy1oa elneols)t2umio nudom   icsltf Durur ;t1apxnio3iasfa2eluvo (0 rxrxo3iotoatrlnvs;( srtmimpoydapte fvia(farrrxm nu0aetn o3tlsfa2emu o;t0trtrxfcoodlaD ai ols srxoxr iodlpe  nciat srtm(rp;u1alto o3iad sDrlnms t0aetnxfctytoa elivi;s  ruo(mpny4ol  miciatf rra(m ou0texn o3iytlsDel(vo;(4aeenifcoa1lmte i o;s s2umxmpoydlp  mieil( artr(m ot4apxnmietaslmDuauvp;t4artrmo totomDeanvi;t)sruoxo ou4opt mnei ()s2rmu  ;u1opxn i3iltfm elnmonu4teerxo ia1lmD  uvil(0 exo(o3nu4op   nct sf 2tau  nt1tle  o3ilsfmDua(msnt) etrmo oytom e ivs;t) etm(opoy1am n fes (f 2tax ont0apt moeiyslm2emuvo;(4 eenmrcoadoptraieslt0texrim3nydlm  mies tfs2uaxr ;o1olx  feilt s ul(vp;u4aexnir3oo1lm r n o;(  2tm(m nydlm eliesls aruau o;o4tpeomfeiltfa uln onu)tleoir iodlate neo;s)seur(o3oodlmt lietatf 2um( p;t1teenmociatfs raums t0tetomf3totoaDe ueo (0t2xo(mpnudapt lfeiatf 2tmxm ou4opt ifctytlm2rm( o (4aexrmf ta1lm rauvi ()trxo(r iu1omeemiei sfsDumu ono0tptnmfctlsfa2ean sn(4altrmf3oatfm elivs;t0setoxrpoo1ape  fes ()aDtmxm no4tpxnmf3iytls2rln o u0 lxnif ootlpDeaneo;(0tetm(opiu1lme  nvtls)aDuaxmp;u1oex  ictysla2uan snt4aetoio oy1oaDeaivils0tetmxopnu1omt lfcs t  rur(mono1tex mo3iadfs2emnvpnt0 etrxo iy1lmDr nvi s0srxoxr3no4ape mfcsa(fsDrauronu0oltnmoctas aDel(msnu0aeeomfciodlmt li o s) exm(r oydal e iet tfs2tauroou4texnmieiadfs elumpn(0tlxomr3todlatr nes;t t2umxm3iy1ameemfet t)s2tmxmpoo0aetoifctld s ul(mp t4 eenmf iodoa r neo;() 2xoxm ou4oltnliet s) Drrur ;u0aleoifeiatlmDul(mon(0trerir iy1oaDelivi;s) rxmxo oodlpt mfvtl(  rtmuro;u1apx  i3iltlsDrm(vo;t)treomo tytfmte uvi s)trto(m3oo1lm n fcta(faDraxmpot4oeeniieiltls ra( pnt)arenmf3tydoa eli i;() rtr(r iodaptelfet tfa2uaxrpoo4olenmicilt a2rln p;t)tlxrmo iytla   u s ( teuo(mpiy1omtnmnetas)sDraurpnu0aexo fetydfa ul(vp;t4areoir tytoaDe i sls) 2triopoo4am emfcsl( arururpoo4alto feiyt mDeanvpnt4tlxoxr totlpD luvo;s seur(r3no4lp  livias)srtaum ;u1olt ifctys s ean p ()artrio ty1laD aies t0 rum(m oydol emivt ()arra(mont1tet iicias m2rm(vonu)alxnxfciatom raueils0teurxm no4ame  nvsl( srrrxr ou1opeo f3tlsfmDulu o;u4aetnxo3tadomtrau i;()srtm(mpiy4alee fcsls)srrmxmpnu1opxniieiytlm eaums t4 ltomrctadlmtrlu ol( s2xmimpou4llenlnci t aDtaxroot0olxomfctatfaDum( on(4 lerio3totfmDranvo;(0 2uoim oy4ap elncta(fa2umurono1texo ocildfs2uauvon(4alxoxo tytlateai ils0teuo(o3oo1olt  nes sfs2rmxm ;o1opxn feias m2ran pnt0tetnmo3tytfaDeaneols0t2xoio oo4olt livsasfa2ua(rooo0oee moeildfs2ua(mo () ltrirciodoa r ues;t) 2xoxm3oo1apenlivia( srraumooo0opt mictysfs ulnmont)teerxr todfpt anes s)s2xrxopiydll e nciat aDur(r ;o1tex mo3ild a2uln p u4 rxoxo oy1omDr u i ()teumxo nodamenlfeilsfaDtru pou1aexnioctytlsDeauvo (0arxoiociy1lpD aueo (0 2urxr ou4amtnliei t)s2trumoou0tlt ii3iytlsDeluvsnt0tlenif3iytfmD lu i (  rxm(o3iydolenmnvsasfaDrr(r nt0tle ii3iyt aDranmonu4 rxoifciydlaD aueol(0s2tmxo3no4amenmfctlt a2umx  ou4tex mfcildlmDelu o u4arerxo ta1lmt  i s s  2tr(opio1amt liciatfartmu pno4oexnii3iydfa uaumont4alenxr ia1omDeli sls0s2toir3nu4om nlici t  Dtm(r ;u1oeto ietls aDuln snt0arxrmoctotlaDeai o;(  etm(m3iodllt lfvias)a2trumo;o0tpx iicilt a eauvpnt) eenxr3iotlaDeluvo;s) 2to(m3oo4ll n fctltf Dumxronu0tle micildlm2umums u4aleoir3oatfate nei s)s2xmir iy1op elies ()a2uau pnu0altnii3iatls2emn pnu)tltnxo3oadlpteai sls0seuoimpiy1alt  fei (f Draumpno4openifctyslm2eluvs;()arenmf io1lpD  u s t) rxr(r io4lltemiesa(fsrumumoou1texomo3ildlmDem(mpnt4arxrmocto1opteaues t0 2xrxr oy1ll   nesls)arua(moou1altomi3ilslaDemuvs ()tlerir3iadomtr u sls0srtm(o3io4ol emfvsls s2trur ;t0tpeomociadfa2uauvs u) leriocoytomteai s t0t2xriopny1am nmiei s)a2rmu pnt0tpe iieils m2umn snu4 etoiocoo1laD livols0t2tmxo oudalenlivil( a2trxr oo1tpxnmictas sDelump t) ltrmf3ia1fpDraivo;( trto(m3iy1amte fvi sf 2tmu ooo0tet ifeiltls2uauvsnu4 rtoxr ootoptr ieils0srtoxo oodlptnmietltf 2tax  ;t1tetoio3tldfs2um(vp;()altrmo oy1fmtrai i ()sruoxm iy4aptn nvi t s2trurpot0oetn oetlslm2eauvo;() exnioctatfm eliei;s  rtr(rpoodal e fvtat a2tax  ot4tlx io3tltfm rlump t)texrmf iytopt  ivs;s  etrim3nydoltemnet t a2ta(mont1tee ifetlt s2emnmo;u0trxrxr3ty1lm rauvo;s  etr(o nydlpt mnvias srrmuro;u0olt ioeiatfaDraumsn(0 lenmr3ia1lm  aieilt)tetoimpoo1lmtemnctlsf rtaumoot4tleomfctlt m2ea(mpnt4arxnmf todlmtr n slt0seumiopnydal  lfet (  2ra(m no1oexoii3iydlmDum(mo;u0tetnxr3iytlmtr n ol()s2umxr oy1lptemivsa(fs2raumont4opx mociatls2uaump (4aetomrciotfa   ivs;t trtrxm3io1lpeelnvils sDtmu  nu1tetoiociysfa2uaumo ()tetrmo3iatfp   ivil(0 exrirpoy4olen nci (fs2tmxmooo4oeeoiociltfs umuvo u4artrxr iotfpD aivs s0 rxm(o3iu1apt  feilsfsrum(  no0ale  fciad a2rauvp;u) ltoxoctytlaDe n o t0t2toim3iu1op  lncsat)sDraumonu1optomieilt a umn snu0aeenmociodfmt  nvo;t) 2xr(m3iu1lp   fcilsfsDtaur ;o0alxo i3iatlm rmnms t0trxrxr todoa r neilt)t2ur(rpny1al nlnet s)srtax ont1oet  ieiyt a ra(vpn(4areoxrciotoat  neolt) etrxr3oydalen ncsltfa2ta(rpou1tlxomfciasfm uanmpnt)aexoxoctadfatrln s t s2tr(m no4opee nvi s a2rax oou1tpt mictys m2em( p;u4alxnir3oo1omDr neslt)t2umimpno4lle lfei tfs2rrxro;u0ape mieiyt s ea(mpnu0arerxfciodop e uvsls) euoxmpio1op e ieta( artaxm ;u1tleoioetad m2umn ont0 rxnmrcio1oaDrlies (0 2xr(r oydoleemfeiatf Dtm(mooo0tptnio3tyd mDum(vonu) lenxfcoo1opDe ieo t) 2xo(rpnudome lfcsa()aDraur nt4tlx  ociysfmDea(mo t4 ltnmr3iydomDrliei ()srtr(m ny4apeemicias)a2taurpnt1apenmfeiytfmDelu pn()trtnif3tadomDrai ols0trtr(m3nodllt  ncsa()artru  ou0tlxo feiat mDra(vo u) renxf oytop  lieolt0srxoir ou4aleelnvias  2truront1alt mieiysla2emumsnu) etrircta1fmDe uesl()trxoxm oo1lmte fcs tfa2umxroot0tpxnifeilsfaDean o;t4trenmf3oatoa elivils teum(mpnydamtemfcsa( arta(root0tle mo3iyd s2ulnms;t)trenmr oy1fmD anvil(0seum(m3iu1aptelivtlt  Dua(  no1tle  f3iyd sDulnmon(4 ltrmf3ootla   neil()t2xoir3ou1apte nct t srum(rooo1aptn icilt s2rlumont0 lxnio ty1fm elivilt s2toxopnodlp nmicilt) Dum( poo1alxo ietasfa emn s;u0tleoxr3to1latr i olt0 ruo(m ou1amenmnvt s)a2ur(  ;t0aet io3tls m2em(mp;u)aetomf3oydomtr i sls setrxo3no1om nmfvt t)sDtmump;o4tetoifciat mDrluvo;u0tetnifcoodla  aiei ()t2uo(mpnu1apt livsltf ruaumpno1tpeoioeiytla ea(vo;()arerxf ootlp  lnvs;t0srxoir3nodlptemfeiltf 2rmurpot0texnmoctad aDran s t4treomo oadoptrluvo;t) rxr(o io4opeelivs (faDra(ro;o4aeenmoeiasla2emump u0 ltoircoydfmteaies t0trtrir3ou4omtnmfcs s  rur( ont0alx mfeiltfs eaumsn(0tlxnxrcootlateanvsls0t2uo(m iu1apen icslt s2raxrooo1aeeo feias mDemn p u0arxnioctotlaDeauvs;s)s2tmxopoudal n nvs ()sDra(  ;t1aptniieiltlmDelu s ()tetnirctadopDeln il()teuoxr ny4lltnmfct s) Dumurp;u1tlxomociad mDelumpn(4artnxo3oa1opteluvo t teuriopoo1lp nlnvt s) Dtm(r ot0tptoio3tytls umumo u4trxoir3ta1fp elieslt seumir oo1am   nciltf Dta(m ou1opt ifeiytla2rlnmsnu4areomo iytfpDrln s s0texo(rpio4amee nvtat s2urxront4tet mfeiltfsDraumpn() eenxfciytlatrlu il()t2xmir3oy4omtnmfeiat)a2tmx  no1alenio3tld s2rmumo t0aeeoxf oadlpteaues;s) eurim3oo4al elfcs sf Dtaxmo;u1olxn i3ilt sDrmnvsnt0artoir3iodopDeanei s0t2toim nu4lm nlncs t a2tru  ou1alx  f3ildlm2ulu onu0tlermo ia1fp eauvs;() etmxrpoydal  lfctl()aDraxmoou4alt  feiydfsDean sn() eerifcio1opteli i;( s2umxm nydap e ivs (fsDrr( pnu4tpeo fciydlaDuln o t4 rxrio iadopt aiesl()t2xoxm3oudomee fcil(fs2umx  ot0tpxomieiad m2rauvs t)altoxf3tydla raies;t)s2umio iodomeemnctl(  Dtru  ;t1oex if3iasfs2elu onu4arxomr iadlpDe ieo;( trtrxr no4omtnmieiat a2raum ;o4ape if3iyd aDulumpnu4alxnmo iatfmD  nvsl( sexmxo3no4llteliet s aDta(mont0tleoio3ilt m rmn s;()arxnxociodfa elu o t0sexoimpno1aptn ivil( srraxrpot0olxomociasla eauvon(4trerif ta1fmD anei;s) eto(r3iu4lpenlnetlt)srtmxmp;o0tpx  f3iytlsDelu snu0areoifctadlpDrauvi;s srtrio oodolenlfctltf 2urur ;o0tetnmfetysfm em( snu)aeerxr3tadoa raies t0seumxo3oydll nmncs t) rumuront4tlxn fctatfa2el( o (0artrxocty1omtrlu o s) rum(r3oo4oltn feta( sDtm( ont1apx ioeiadfa2eln p;u4areomf3iatomDeli s t)texrxo ou1amt micsat  2tmxm oo4aeenifciltls umuvont)areriociy1omD lnvi;(0t2tm(opiu1lm emfesatf Duaur ot4aleo fctytfmDum( pnu4trxrmoctatlmt livils0seuo(r3oo1lltnmnei s artrur ;t4tlxoiociytla2ea( p;() ltnio3oodfpteaies s) 2xmim nu4lmt mnesa()s2tmx poo4aeeomf3tlt sDranmonu0 lxnir iadomDrauvilt s2ur(rpoydol n fet sfa2raurpnt1oetn o3tyslmDea(vpnu)arxnio3oytfat lueils) rur(o3ny1lmtnlnvt ()s2tru oot0teeoif3iytlm em(vs t0trxomf3tatlm r uvsls seuo(r3io4amte nci ()srtm(rpno1tpxoio3iltla2rlu o;t) rxrmfcty1opDeluvo t)seurim ny1amte nvi t srrau  ot4tpen i3iydfaDeanmsnu4artrio tatom eai i;t truoxr nodam emfeia( sDtmxroou4tpeoioeiltls rmu s;(4trxomo3todopt  n sls texmir3iy1lleelivilt)srurum ;o0alxomiciltfa2rlnms;t)tlerif3oa1oa   ieol(0 2uoxo iy4apee nvtasf 2umx ono1apxo feiytfa umnmo u)alerxf3iytlmD lu o (0sexr(rpny1aptnlfctls)a2rr(moou4oltoii3iyt a rl(mp u)aeermf iytlateaivs t0s2xoxo3nu1apee icta(  2ur( p;o4opx  iciyslm ul(mo (4aexrir3ty1laD lu i s t2ur(o3nu1ll  mici sfsrra(monu4tpt ifeiad sDem(vo;t4 etrmf ia1op rlnei;t0t2to(rpoo1olte fet tf 2rrxrpoo1opeo f3tas a emuvp u4arxoio3totop elneol(0 rtmxr oydope  iesat) Durx ono0texo feiatls rl( pn(4tlxomf3tatlm rln sl(  rxo(m3iodapt mncsa() rrmu  ou4tlxomiciaslm2rmumo;u0aetnir3tatfpte u s s trumxopoo1amtn nvslt)artr(mpno4tltnmo3iytfa2emnmp;t0 rxnmf3tytfa e n s ()trtr(opnodamtn nvi t) ruax  nt0aleniieiadlm2rmnvo t0aetoif ty1lpDrlneo ()t2tm(o iydope mfes s artm(  ot4opx  ociysls2uanvp t0trxrmrcoytlp rli sl(0seurim3oy4amt  ivtl( srra(r ;t0oet mf3iasfa uauvs ()tleoxr3io1fm  li s (0 eto(o iy4olee fei t  rumx pno0tpenioeiadfs eau pnt4 rxnxr tytfpD anvol(  2xoir iodlmtemfvtl() Drmumoou1tpe mfeilt a uanms;()alxoxo iytlaD  nvolt0t2uoio ny1alee iviat)aDrax  ;o1tlenmoeiydls rln o ()aetriocootfmt  nvi t texoxm3ou1omtnlies t a2taumonu4aeeomo3ildfm2rln sn() lenxrctodlmD au o;t  eurio3ou1al  lfvt ( sDra(r no1aleomfcilt aDumu pnu4aleoxrcoa1faDe ieolt)trumxm3iydlpenmies ()artrurooo0tpt mieiytfsDumu onu0aetnmr3io1fa   ueol(0 rur(m iodome  nei s  2ta( pot0tex  oeiydfsDemnvon()trxrirciodlp r n o s)t2uo(rpnu1lltnmfeslsfarrmu  ou4opxnmicildfm2rln onu0teenmf3oatfaDeaivo;()texr(r3nydoltn ict tfaDtmxm nu1aexo o3ias s ran pn(4aexrio oy1omt  uei;s s2tm(o3no1lltelfvi sfsrrrx p;u1tpxn ietadla ra(ms t4 lxrmrcoo1oaD  nvo (  rxmxo3io1al nlnctls srrr(r ou4aeeoiietytlaDemn o;()artrxocoodomt li s () exrxr oy1ol emiei (fa2ta(ront4optnii3tltla2ulnmo;u)aeenio3oatomt  iei;s t2tr(r3iu1lp nmnet tf rumxrpno0aetoio3iyslsDrauvonu) exoxr totoptranvo s0texrio3io4open fvtat  2rmum nu1texnmo3iys mDrmump (4tltnmr ty1fpt  ues;s0t2xoirpnodopt lnvtls)sDtauronu1oexn fciytfs2ul(vont0teenxrcta1om r nvils0sexr(m nodape mnet ( a2urumpou0aexn fcias s2rm(vp;u) lxnxrctydopD lneol(0sexm(r3ou1olte ies () Duaxrpno1olxo i3iatla em(mo;t0trxrmo3oydla r uvil() eur(m io1lpee fctl( sDtru pnu0oexomocildfmDumnvs t0aeenxr tytfateanes;t0srtmxo3oy4lm  lfct () Drm(m ou0optoiociys sDem( onu)tlxoir iodomt aies;s0t2toxmpnu1oltnmietat aDurxm no1tlenmieiysfa el( o u4aexoxo iatoateau s s0texmim3iy1ll nmfvsat)aDuau  nt4tlxniiciatlm2eau s;u)tltnif3totlpte ueo ( t2trxr3nu1alenlnct t)sDumurp;t1tle ioeiytfsDrln o;t4tlenmr3oy1op rluei s0sexr(o no4omen nvta() Dta(m no1oetoifciytls2rmu o;(0trxomo tydoat  nvs;t s2umirpou1op emfvsa(  Dtrum ;u0tpeoiictlslmDel(msnt) eermr3tatfmD auvs;(0teumxr oydlm   fvtl()sDtaumo;u4aex mfeiat sDean o t)alenmrctatla raivi t0t2uo(opou4opeemnet s a2ta(mpoo1apt mfeiys mDulnmp;t)alxomrciatom e ivsl(0srur(mpnu1ap  lfciatf rta(mo;u0aexniieildlaDemnms u) eenmo oy1fmD  i s;t  rxo(r no1lptelies t  2ra(  ou0tle  feiys s2ul( onu)aetnxrcootlm  an s;t) eurir oodomtnmnvs ()aDta( pno0teen i3tldlm umuvs;(4texrxo iydfm r nes t sexm(mpny4ol nmfesa()s2tmx ont0alenmoeilsfa um( ont4 rtnxr tydfm elueolt0seuoxr nu1ape  fcilt a2ra(mono1olxomfctas m ran s t)teenmf iydom r nvs s)trtriopoo4lpe lfcias)artm(r ;o4open i3ias s2uln s;u0tltoif3oydlpDeaneils0t2xmir ny1ll  livsls  Drmumo;u1aexo oeiysls2emnmpn() eerxf3to1faDe neo;() exo(rpnodlptemicsat) rtr(rp;u4aeenmf3taslaDumumpnt0altnmrciytfptrlnes;t trtrim nu1opte ivs tfsDta( oou4tet  oeiltla2uaums;t) exnxoctadfa   ueo t teto(mpiydop elnvsls a2uaxm ot4aexoif3ilsfmDum(ms;u0 etnmfcoodla  luvil(  2xoxm3nudam elnvilsf Dtmx p;o4aeeoioeiydla2ea(vp t4alermo3oydlaDrai olt0trumiopoo4opeelicias  rrmuro;u1optoiiciyd m eanvsn(4tetnifcoydoa rlu il( t2tmimpio4aptelivi s aDtmxr nt4alxomfetyt m ea( pn(4 rxnxrcia1lmtran i;t0 2xr(m iodlptn fvs ()srta(rpnu1tetnifetldlsDumu s;t0aexrmr3iodomtrauvi;t0t2ur(rpoodoltnlivs tfa2urxmont0tex  iciasfm2emu o;(4aeenxocootop  lu slt0t2umxr iydolt livsas)a2rm( onu0opto f3tydlmDra(vpnt0trerxr3tydfpDran s s  rumxm no4apen nvils sDumxmont0aex mfctls aDemnvp;u)artnxo ia1lp r u ols s2urirpno4ll  lfeta( sDrru oou4olxnifeiys m2rln sn()aetnxr oatomt an slt0sexo(opoudomtnmfet (faDrr(  oo1altnmociltfaDeaumo;u0altoio3oo1fmD  nvi;t0 rtrio3ny1llen fvia(  Drrumpot4tlxnioctls m elu pnu)tltriocoo1fmte i o;t) etoir nu4llee nvs tf rtmurono4tlto oeildfmDrmu s (4texrxo3to1oat  ieo (0t2xm(r3iy1am  mfeiasfsDrmurpnu0oexniiciytlm2um( snt4 exnmr to1omDean o;t  rtmim ny4lmtemivsa(f Drmumo;o1opx  oeiltfm2rmn pnu4tetnxocio1fmD ai olt0teuo(m iu4om   nvs sfs2ra( p;u4texnioctltlmDelu o t) ltrir3iy1fa elu s s)setrxm3oy4am n fvilsfa2urx  no1opxnmocils s2umnvs () exrxr iotomtrliei;s0 rtmimpiudol  lfcsl( a2trx p;o0tetoioetld s2rm(msnt4texnir ia1lpteaues;t trxoxopiydoltnlnetas)srraurono0olx  i3ils a2ul(von(4tlxnxrcoytfp  lnei;()sexmirpio1aptelies t) 2ur(r ;u0aeeomiciad m2eauvo;u4texrxf3totfmteli olt0 euo(o3oudamte fei (fa2rmu  nt1ole io3tat sDrln p (0 rermrctadfmDrln sl(  2toxm3ny4al   ieiatfa2umx o;o1oet ioetytfs2ea(mpn(0alxnmo iadlateauvil(  2xr(o ou4openmici (f rtax pot4altomf3iyslaDra(vont0 rtnxo3io1faD  u s;s0t2toxr iy1altelfvsltfsDumum ot4tlxn fciysfsDra(vpnu)tltnmf oydfmtean o;(0t2um(m3iodlltemfvslt arurxr ;u4oeeomictlt a ulumpnu0 etoxfcoa1lptr nvi s sexoio ou4lmen nvilt  ruaumpot1apx if3iyt a2ulnmo;(0aexnxf3iodlpD  uvolt  rurim3ou1ole lnvt t) 2um(rpou0alxo iciltfmDranvsnu0tlxomf totfmDelieo s0trxmirpnudlle  ict t) rurx  ;u0oexoifctyd m rlnmpn(4altrio ia1fate nvil(0trxo(r3no1am elivslt arumxmono0tpxn i3iadfaDemuvo;u4trxnio oydopteluvsl()t2tmxo nu1ale mnvt ( s2tm(rooo1aptomi3iyd m rmu p;(0trenxr3to1oatrlnvs s srur(o3no4am  lneia(f Drax pnu4tlxo f3taslm2rl(msnt0altrifcio1fmt  ieol(0srtrxopiu4al  lfvia()aDumurpno1tlx iietlsfs emumpnu4 rermfcta1lpDe u i s  eumxmpnu4ame lnctl(  2raxr oo4alxomoeilsfm emn ont0altnircoa1lm e nei s0t2tmxr nu1al  lncil( arrmumpnt1tex mfciadls2umumpnu4 rtrmf iydlpt  neilt  rtr(m ou1oltelfct (f Drm(rpou0olt mf3iatlmDeaums ()alxrircio1oaD an i;(0seumio3nodope  nvils  Drau o;t4aex  octatlmDumnmp;t)altoxociytlaDr nvilt)s2xoxopny4open nei t)s2ur( p;t4tpenmfciydfa2ul(vpn(0 rtnxfciy1lm  lies;( s2toxm nudom n nes ( srua(  nu4aleomo3iytfm elumont)tltoxr3ty1omDrauvs;s0 2toxopoo4opt mfeiasfartaxr ou4alxoio3tlsfmDrlu p;u4aetnir ootomt lieo;t trtrxo oy4oltnmnvsa()aDrm(mont0apt ifciysfm em(vo (0 leoir ta1lat anvs () 2xrirpno1optnlnciltf rur(r ;o0altnifcias s em(vsn(0aexoioctatlat  u ols) 2xoxm iu1lp n ncsl(f 2tau ont1opxomi3iysfs rm(mont) rtnxf3to1opteluvs s  rur(mpiydamen nvilt)srrm(mpoo1tlxoifeiaslaDem( s t)aexrio3iy1lp rlu i (0trxr(r3oy1omtn nvt s  rua(rpnt0oexnif3tlt aDua( on(4tlxniocoodfpt aneo;t)srurio no4alenmictl()s2tru  ;o4tleomieiatfa uanmpn() reomo tydfatelivo;()setr(o iy1ap n icils)a2tau  oo1tltn ieildlm2ean onu4aeerifcoo1fp   uvsls  2urir3nu4ll  lnei s) rta(r ot1altnmo3iyslaDuln s;(4tetoio3oa1omt  n s (0s2xoxopnu4lmtnmietat srtru pnt0oetoio3tld s2eln s;t)trtrmociodla rluesls0trxr(r3ou4olee nctltfs2ra(rooo4apto o3iys aDrau s t0teermo3tadoat lnvo;t0 exo(o3iy1alt  nvtlt)arrm(m ot4olenmo3tys s rau s u) exrmr3oa1la r iei;s0t2xr(m nu4ope mictl() 2rr(r ;o1oet micilsla2ea( p;u4tetrif3oadop   ueols teuoim3iu1olt  fcil()sDtm( ono1aexo i3iyt a umuvonu4 renir oytopteau s;s  2um(r iu1al emnvs ( sDur(root0tptnmociadlmDem(mp;t4alxomo tatlat luei;t0trtmxrpiu1amenmivsltfs2tauronu0tle ioeiasfs emnvs t)altoio todoa rlueil( srxrir3oo1ame  fvsas)s2raurpnu4opxnif3iatls2uaump;t4 lxrio3io1fm   nvs s) exo(mpno1om n fvslt aDumxrpnu1alenmfeiyslm ra(vp u) eeoir3oodfp e ivs;t)trxrxr no4omt  nes s)a2rmu  ;t1tltn i3iad m ean s t4trtoircio1oaDeaiei;(  rtrxmpiudllen ies (fsrumurpou4tex if3iad m2ulnmp u0altrmr3ia1faD  ieslt srxoxm3nodol nmnetl() rraum ;t4apt mieilt m rln pnu0trxnif3iy1laDran slt) rtoir ou1optelnvsas)a2um(m ;o0apxn iciytfa2ean p;t4tlxoircoydfatrli ilt)seumim3iudlptnlncia(fa2tmxronu4ole io3iltfa em(vs;u) lxnxrcoy1fpt aneo t0srxm(r3no4lmtn fes ()arrrump;t0tpeomoctydfaDumnmp;u4trxrmocoatopDr ieo;( s2to(rpiy1alt  ivi t a2rrxmooo4oex ioctadfmDuluvs;t0 eerxr3to1latrai i t0 exo(mpoudlpt  ictl() ruau oou0altnmi3tatls2umu p (4treomo ia1omDe nvo;s srtoxo3iy1lltelictl()aruax  ;u1apxnifetlt a rm(vsnu4 rtnxr3oodopDr neilt0tetmxo nudomtelfvi tf rraur ou0altomieilsfmDrlnvs;t0treoifcoytfaDean i;()trtm(r iy1aptn nvtlt) 2uax  ;o4optoiieiyslaDumnmonu) leoir3oadla e uvol(0trtmxopoudlltnlnvilt)sDtmu  ;o1oltoifetatfmDuan s;t)tltnmr oytlmtraivols)s2xoxr3no4ll n ncilsf Draumpnu0aexnio3tlslaDeln pnt0trxrmocoydfpt ln i s trtoir iydol nmici s)a2tmurpnt1opx mocilslsDran p;u4 rermrcoadoateliei;s)s2to(rpiy4am  micsat a2tax  oo1oleoio3ildla elnms;u0tltrif to1lmD anvs ()t2ur(o iy1ll nlivia(fartaum oo4tpxoii3iysfaDra(vo;u4altrmfcoytfaD  u o;() etoxm3oy1lp  lnvilt  Dua(monu1texoiieiad m uaums;t)aexrmo3iydlp elueo;(0 2umxr3iu1lle mfvils  Dtr( ooo1teeomi3ils s2rln o (0texnio3tadfmteau ols tetm(o3no1op nmnvta(f Dumxm ou0apxnmieiatls ra( snu) etrif3iadop r nvo s0srto(o3oudlme  feil( arrru  ;o0opxo ieiatlmDrlu pnt)aetrxf ia1la e uvi t srtmxm nydomtelfci ( arrmu  nu0tptnmo3tydfaDra( pnt4tltrioctatfat auvsls t2xrirpou1opee iviasfaDur( pot4open f3taslm emu pn()trenifciytfa  an i s srurir iydomeemnesatfs2rr(  ;u1tlxoif3ilslsDea(mpn(0 etrxr3iotlmDrlivs;()s2um(m oo1olee fvilsf Dta(r ;o4teeomfetld m ran s;u0artoif3iodlpDe ueils)srtmir3nydopen ncilt arrru p;o0altomi3tyd a rmuvs t) rxnxocoatlmtelivs;t0 eto(mpnudlm  lfvsat aDum(rp;t1oetn f3ias a2rlnvsnu)alxoif3oatopD aies;t  rxo(rpio1lmtnlieils aDra(rpot0oex mo3iaslmDeauvp ()tltrif3iadopD ai sls) 2xrim oy1optn ici t)sruax pno4ope ifetyslaDua( p;t) rxnxo oatlate uvil( trurio3iu4omtelnvt tfsrua(mpoo4tptomf3tasfm2elnmp;()alxnioctotfpD lnvsls0 rxmxr oudapenliesat s2ururpou4aexoif3ildfaDrln p (4 rtoxrctodoaDrluesl(  exrxo oo1apeemfeil()sDumxrpoo1opxoiieildfs el( onu4aeermrctydfatrln slt0s2toxo3nudlpe lfeta(  2umx pno1aeenifciasla umnmp;u) exnmf3iodopt lnes t  rto(rpoudam e ivtat s2uaxroou1aetnmfetys m rm( s t4trxnxrciadoa rli s t)s2xm(rpoy1omteliviasf Drmxrpnu4tet  i3iltfm2umums u4 ltrxr3ootla eanei ()t2xoxmpiu4ap  lncta( aDrm(m ot0alx  i3iytfs emu p ()aleomocoy1fp eai s;s  etm(mpnodole lnei s  2trxmpnu4tpe moeiyt mDranmp;u)trtrir tadlm raiei s  etr(m iy4alt lneta( srur(mo;t4tlt io3iat sDeluvs t4artoir3tadfpte n i;(0 2umim iudop elics sfs2tmurp;u0tltn oeiat m ea(vp;t) leriocoatlm r ivsls)srur(rpny1llteliesas a2rr(monu1oex mietytfm ua( snu0 leoxfcoadfmtr nesl()srtrxr nu1op  miei s  rraum nt0alt ioeilsfa2el( p;u0tlxnmfctydoate u o t0srxmxm io1lm n icsl(  rrrxm ;t4apxomoeiadlm2ua( pnu)trtnxr oadlp ean i;(0srtmxr oy1lme  ies t) 2trx  ot0tpeo fctatfs rmnvs;() ltnxfciodoat aieil(0s2trio3oy1llenmfcs (fa2tr(rpoo0tpxn fetad m2uaump t4alxrif to1la r i o;s)t2xoim3io1opt  fcslt)aDtau  nt0oexomociytls2rluvp u4 exnir tydoaDrluvi s)trumio3iy1lm nmicslsf Drr(mpot4teto feildfaDemn o;u)alxnir3iytoatelivsls0 2umim nu1lpe  nctlt) rtmur ;u0teeo o3iat a2el( s;t) lxoif3oodfa  li il( tetoimpiudamte nvtatfa2ra( ono0aeenmoetyd s2ulnmp t4 ltnifciydlpte ies;t0 2xriopoydlm nmict (fsrtru  oo1apeomoetldlm2ea(mp;(0teenif tytlpD li slt)s2urxopiodaltnlnctas aDuaump;t0teeomfcild s emnvo u0 renxfctadopDe neslt0tetmio3nydlmee fcsas) rtaumoot1open ocilsfs2umu onu)artomf3totoptelivs;()sexmir no1lp  mnvsasfartr( oot4alto f3ilt a rmuvo;()teenmocoodfateliei;s)truoxr3oo4amte fet (f Dtax poo0tlxnio3iadls2emump;t4 lerxo3iy1om ranei ()t2uoxo3ny1omen fvsa(fsrra(mp;u1apxnmo3iyd a rmnvp t) exrmr to1fat auvslt)srxoxo3iodom nlfvsa() Drrx oou1olt  o3taslm uln s;(4tetnxo3iydom  aneslt sexmio oydlmen fvsls)arurx  ;u4oee  iciatls2em(vp;t4teeoxr oy1la e u s t0srurim3oodamte ivtl(f rrmxr ;u0tpxnio3ildfmDulu p u0 exrxociadfm elneslt0srtrio oo1ole lfvsls)sDurx p;u0olxomo3iydls2ra( p t) ltnir iatoat an o;s)sruoimpiudamt lieslsfsrururpno4tpxn ieiad a emnmo;(4artoxr totfmt  i i;s)s2toxrpoy4ol n nci t  rumx pou0tetomi3tyslsDumnvs ()aetomo3to1la  lneo;s0srumxr io1lltelivsl(  Durx p;u1olen fcildfm um( ont)tltomf3to1fmt  i s () etmio nu1lpee nctl(f Dtmxmpou1oet if3iasla2rln p;(0 exnmfciatomDeauvslt0 etrxm3iydoptnlfciltf rrau pnt4altomociytfs2umnmo (4tetnxocta1fp e nvs;s sexm(opno1ol nliesl()srrmxr no1tlt mietytlsDulu sn(0 lenmoctydlateauvil(0seum(m3oo1olt  nvi s srraur ou1tlxoioctldfm2umnmonu) etnxf3oydfp   ivi (0texrirpoy1lpe mnci sf rumuro;u4oeen f3tat sDeaumo;u4tlxrxfcto1omDr ivil( seumxr oy1om e ivs s)a2trx  nu1tpxoiieildfa2rl(vo (0arxoir tadfaD  ies (0srtr(m3nu1ll nlnvs ( s2umxr ;u4aexnmf3iadls2rmump u)aeeoirctodlmteluvslt0trto(opoy1ame mfviltfaruaxmo;o4tle  feiadlaDumuvon()altoxo tytla elueo ()seuoir3iy1lmtnlfeia() 2rax  nu4opx  ictad s rln p;(0 rxnmfctodfp eau i t)t2to(m3ny4alenlicil(farur(mooo1oexnii3iyt a eanvo t)arenio oatoaD livo ( sruoxr no1om  lfcta( a2umu ont0oeen oeildlaDelums;t4aeeoxfciatomD luvolt) eur(r3nydlmt  ncs tfsrtr(ro;u1ale  ieiasfm ul(mp t)tltoio oo1fpD anes ( tetm(m3oy4opt  ncs ( srur(ronu0opx mociad aDrm(mpn(0 eeniocty1la e ivilt0t2urio3io4ape lnct (  2umu  ;o4oex if3iltfa em( o u) ltomrciotlm   nei s)s2tmxr ou1ll  mieias)s2umuro;o4aetomf3tyt s ea( o u0 ltoifctytomtr nei;s)srxo(m ou4lmt lfesl()s2rmumpoo1opx ioetadls rm(vonu0 rtrxo iadlat aivs;(0texo(o3nu1op  lncsa()artru  oo4tpeoio3ildfs2ranmp;(4aetriociytlpt ln olt)sexr(rpnu4al nlfei (fs2tmxro;o1oleomo3iasls2rlu on()trtnmo iy1op  anvs;( texoxopiu4openlncs s)s2uaur ;t0oetomi3tlslsDumnvpn(0trerxf iatlmtrln slt)s2trxrpoodoptemfviat srurxrono0ape  ieiat a emnvs () rtrio iotlaD anvols)s2uo(o3ny4ap  lfcils)s2taxm no1oetnifeiyt a2ulu onu0teenxo3totfmtr ivs s0teurio3ny1om emicta()aDur(r ou1oee io3ildla umnvsnu)aetnxf3oy1fpteauei s  rxo(m io1op   fetat)a2raurpoo1aptoio3iys mDrl(vs;t4aexniocio1lpt luvils0 rtrxm oydap nlfetatfa2uaxmp;u4ope mfciasls2ranmo;t4artrxfciytlpDrluvs (  2trxrpou1lme mncsls)a2rmxr ou1aptnifctlsls umumo ()trxnmf3oytlmt lu i;s)srtm(r3iudomt  neias) Dtm(m ;o1alto i3iatlm em(monu)aeermr3iy1omtr n il( s2umxo ou1lpee fvtlt a2umx pnu1opt ifctas sDulu snt4arxomfcoa1fmDraueslt0tetr(o3oo4lltelneiatfs2uaumono1tlenmfeiydfs2uan p;t)aleoxf3iodomDelnvo;s0sruoxm ny1om e fcia()arrmxm nt0oetniiciadla el( o u4arxrio iydoat au ols)teur(r3oy1om n fei (f rrmx pno4aeeniietytla2rmuvo;() etrmfciatfaDrlies;s trxrirpny4lpte fciat)sDtmu ono1oeeomocildfmDrlumsnt0trtrxo iytlptrluei;(0trxoir3iy1amt lfvilt)sDrrumooo0aexomi3iat mDemnmsnt)trxnxf3ia1latr u sl(  2ur(mpiudlmen nvia( srrau  nt0tltoiociytfa ran p u0aexoir3todlaDr ieolt0 exoio3nu4amtn fvtl( sDtaxrpnt1tee iicildlm el(mpn(4 rerxrctadfmt  n s (  2uoim3oo1am  lnei tf 2rmumonu1oee ifctldlm2rmump;(4 eenio3iy1latr uvo t)trto(rpnodomt  fvtlsfs2uaxm no1tpeo iciyd s uanvo;(0aetoxfciadlpt  ivo;s0t2urim io1omtn nciat sDrrumooo0apeoioeiasla ra( o;t)tleoxf oatlaD  u i;()sexmxopou1amtelicsa()a2tauronu0alx ifcilt m elumo;t4trtoxf ia1opDrlnvo t) rxm(o nu4llenmfvs (f Dtmu p;u4tpt io3tadfs eaums;(4 etnmfcia1lm  aieslt t2toiopiydaptnlnci s)s2ua(roou0ale  iciysfsDemuvp u)alermo3iotfaDrln o t) 2tmxr3nu4opt micsa()artmxrono4tetomf3iyslm2ran o u4alenmf iotomDrlueo t)teum(rpno4am   ici tfarrmurpnt0aptoii3iltla2el(mp t0 lxrir to1fm eluvsl() ruoxmpiu4lmt  nvi ( aDuaur oo0aexomi3tlsfsDum( pnt)altrmf3totomteluvi;t srxm(o3oy1ope  nci t)a2rrurpoo0oeenmo3ias s eanvon(0artrioctatlp rauvs;s0 rtrir3io4lpt  iesls s2umurpno0altn ieiysfsDea( sn(0altrif3tytoat anvs ( s2tmio3oo1ole  fetasfsruaxmpnt0tle  fetyd sDrlnvon(4 eenmf3iotfatrauvils) rtmir ny4optnmfeia() ruau  nt4tltoii3iytfm em(mp;t0texoxr3iotfptelivo t s2umiopno1om n ivtlt)arrr(rp;u4alt iiciatlaDulump u)arxnir3io1lm elu i (0t2uoio oo1al n ivsa(fa2rmx pot0aexomoetat aDea(vs;t0 rxoxr io1omDrln o (0s2xrxrpiu4aptelfeiasfs2rm(mooo0tpenmfetas sDumnms u4arxrmfciy1fmte i i t0 2to(mpny1lptelfcilt  2um(roou4tpxn feild sDulnvs;u0tlenxf iytlp elnvo;t t2xo(m iy4aleelfcs (faDrau p;u4opt  o3iysfs2umnms;() rxrxr totop  luvi;t)truoxmpoo4am  mnctas  Dum(mono1aetn ieiyt sDulnvs t4 ltnir iydla r uvo t srtoxo3nu1am emfeil( s2rrxrpoo4opeo feiadls2rmn p;() renmr3ootlaD an s;t0srtrxo io1olt lietas)srrmx  no4tlxnmieiltfs ua(vo u4 lxoxf3iotlm e nvs t  rtoxo ny1lp nmnetlsfarumx  ;o0opxoio3iadfaDumnvpnt4 reoxf3iatfpt aivs;s)trxmxr3oo4am  mfct t arrm(mp;t4apxomi3iydls umnvsnu) lenxfciytoateaivsls)srurir3nu1omeelivs t  2rru  oo0teeoifetyslm2ra(mp;u0artnirctytopteanvs t)s2xoimpoudam nmfci ()srtrxr ot4oee iociad m rmnvon() rerxo3todlmDelivol(  rurim3oo4om e fes sfaDuaxmp;o0ale ioetatfmDrauvon(4texrio3iatfm rlnvil(0s2trim nudaptn nes tf 2raxro;t1oltnmociydfaDrl(vs;() lenmrcta1omDe ivs t)seuoio nu1om n iet t srraxm no4apxo ietydls umuvont) eenio oatomD lu sls) exm(r iydaleemieia()a2tax p;t4apx  ieilsfm2ulnmont4aetoif totlp  lu o s)t2tmxmpoodaptemfeil(fartmurpnt0aet  oeiyt a2rl( s u)tltnxr3iadomt  ivo;s)sexrxopiu1aleelncil(fa2tru pot4aetn icilsfs elums;u0 ltnxrcto1lpDrlu slt) 2xr(o3nu1am   feta( aDraxm nt4tpt miciyd m2ulnvon(4tltoxf3iy1laDelnvols  etrio3io1om  mnesat) ruaxmo;o4oetnifeildfm2em( snt) rtnioctodlmtr n o;(  eumiopno4lmt mneslt  2trurono1tlx iocildfs ea( onu0 lxomr3tydomDrlivs;( seumxm3ny1optelncs s  rraxrpno0tpeoiictatlm uau p;u4arerif ty1fmt lnes;(0tetrio3ou4lm e ivt s sDtau pot1opto oeiasfm2ea(ms t4tetrio todfa  luvs (0 2xmir3iu4ol  livil(faDta( pot1ale mo3ias s ra(vo t4arenxr3iodlpt luvslt) ruoiopno1om nmfvt () rra(m nu4tlt mo3iad sDemumo;u)aetrmf iodla eluvo ()t2um(mpiu4apen icia()artaum ;u4aetnmietlslm um( o;()tetrif3ootfpD auvs t)trumir oy1llt  nctas aDumxm ou0oltoio3tlsfa2ul(mon()aeerir3iotlpD livi s0s2trir iy1ol  mfes s)sDtau  nu1apt ifeiytfs2elnmonu0tltrio oatoateau i;s tetmxrpoodamee ieslsfs2raxmpnu4tpeomiciydfa2ulu p;t)arenmfciodlaD  u ols) rto(r oydoltn ivslt  rra(mp;o1apx mf3iydfm ea( snu0 lxomfcoy1lmteai s s0setmxr3oo4omtnmiet () 2ta(ro;u4tlenifciyd a rl( o u) etrxo3iytfatrlu i;t srurir3oy1ape lnvil() 2rau oot1apx mfeiltls2emumo;u4arxrir io1fmDe u s () rumxrpoydlle  ics ()sruaxr nu4aeen ictasls2ulnvs (0 ltomf3ootomtr ies;s trtmxr nu1llt miviltfsrumx ooo4tlenii3tltfmDuau o () exomf3io1oate u o s)seuo(m oy4aptn netasfsDtm(m ;o4oexn iciytfs2rmn pn(4alxnmfciatlm rli o;s0s2xm(o3iydlle lnct (  2ua(mono0optn oetytfsDulu p;u4aeeoircia1lm ranes;s0sruoir3iu1alt lics () Drax oot1aptnmi3iytla rl( s;(4trtoio iodfaDrlueo;t t2xmxo oo1optelfvtlt  2rm(rpnu4apeo feilsfm rmumpnu0altnxr3oo1fat ai il( srxmirpou1ll nlfetat sDum(  ;o0tetn o3iydls2uln o;t0alxnxr3oydoa raiesls)seuo(o no1omte ivils)a2tmu oou0oetnii3iysfa ean onu4 ltrmo3oodfpDeauvsl( trtrxo iudlmenlfvtl()s2rrxmp;t4alt  oeiltfm rm(mp;u4 rxoxrcio1oa   uvi s0setm(m3oo4optelfvt tfsDumump;o0ole ifctysfaDel(ms (0texomr ootla  ln i s0tetrxm3nydlme lfcs (fs2tau  oo1ole ioeiaslaDum(mp () ltoif ia1lpD auvi ( teurxm no4apeemivsl(  2um(mpou0oeenmicias m rluvo;(4 exrmf tydom eaies;t)t2umxm3nydap  mnct s srrrumo;u4alx mi3ildlaDulnvo ()aeenxo3iatopteai s;s trur(o3oudoptnlicsa(fs2rrxmono4tptnifctls a2um(mp u0treoxr tydla  luvilt0 rtmim iodlpt  neilt srur(  ;u4tpeomocildla2elump (4alenmo ty1lm eaivs (0seumxr iy4ole licsls)s2ta( oot0openmfetydls2rl( s;t) lenxrcoydfp  ai i t)trxrirpou4lp n nctlt artr(  ;o0aexo oeiat m2umumsnt0artoif oa1oate u i;(0trumiopiu4olenlfei t sDtm(rpno0aex  ociltfs2rm(vpn(0 renmoctydlatelieo s srum(r nu4ap nmfcs t)a2rau  ;t1altnmoeiadfsDra(vs u0 exoif oytlmDr ivi;(0tetoiopnudlp e nvtl(f Drax ont1tle iociytls2rlnmo u)tltomo3ia1lp eanesls)s2toim3nu4lmte fes t artr(ro;t1apt ifeilsfa rmn p;u)altoxf oa1om eanes t) etmirpoy4apenmivil(fartrur ;u1aexn ociltfs2ulu s ()areriocoytopD anvs;t trtrir io4amee ncsl( aDraxmpoo1opeo i3iasfm eanvpnu0 lenxrcoo1om rluvi;(0s2xrxm oo4ll nlncta(  2umxr ;t0tltomf3ildlaDrmnms ()aeeoxr3iytfa  lies s tetmir oo1am elivsltfa2ururono1alxn ieiad m em(vo u4 renmf oa1optrauei;s)sexoio ny1lm  mieslsfsrumxm nu4olenmfciadla2eanvs u0altnmfctatlmD luvo t0trxm(rpiy1apte iesas)s2ta(r ot0aex  o3tytfa2um(mpnt)alxrmocoy1lat au il(  2ur(m nu1alteliciatfsrta( pno1tpeomietld a2rmnvsnt4 rtoircoydlpt  ues s0tetoio ny1ape  fesls  rraur ot1opxnmoeiytla2rmnmsnt4tltoxfciodlpDranvo;() 2toio nydol  mnes tfs2rmxm ;o0tltomoetldfm ulnmo;u0trxomo3iy1lm r ivslt trtrim3nu1al nmivs ()sDtr(monu0apxn i3iys s2ea(ms;()areoxf oadfm eanvolt t2to(r oydlpe micta()srrmx o;t1tpxn oeiatls2raumo t4 renioctydomD  nes t tetmxrpoy4ame lfvtl()s2urx oou4oetnmociatfsDeanmont4aexriocoo1fmDr ieo;t)t2xrxm iy1apeemivtatfsrtm(m nu1olen octysls2rmn snt0texomr3iy1om   ieil()srxmxr oo4lmen icsatf 2rrxrpno1oexo f3iys m2em(vs t)teerif tydfmtrlnvs;s s2xmxr oy4lp  mfvilt)a2uau oot4oet  i3ias mDem(vpnt)tltoirctotlatrlies;s0sexoxm iy1apee nes (  Duaxront4ale  oeild mDemnvpn(4 renxr iy1opt li sls  2xrxmpno1lp nmivsas) 2taxr ot0aptnioeils mDumu s (4 een
\ No newline at end of file
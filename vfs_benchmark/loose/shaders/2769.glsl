@@ -0,0 +1 @@
+nei;s  etoxr ou4alte ict t)s2rrum oo1tpen fciaslmDuauvp;(0 renmf3ootlmD li il(0seurim iu4alt lncsatfsDrrx  nu0oex mociydfaDelnms t)aexnmfcia1opD  nes;t0t2xrir nudape  nvtatfarum(r ot0alen o3iytla em( p u) eenmr3io1fmD aneil()srxrim3oodole mnvt sfs2taumpou1tltnmf3tasfm emu o;()aeeomr3iydfmD anes t) rxoxm3ou1om n ivia()a2uaxrpnt1openmiciasla uauvo t4 eeoxrctotoaDranvi;s0 rtmiopny1lptn ivil() rumum ;t0tlxnmoetadlm um(vp;u4aleoxfctatlmteluvils trxoxopoy1olenlfvs s) rua(m ;t4aex  octas m2elnvsn(0aexnif oatfmt auvilt0 2toim ou4lp   fvsl(f 2trx oot1opt  fcils mDrmn o u4 rtnxfcoo1fmte i s ( srto(mpnydllee fviltfaDra( p;u1alt iocildla2ul(mp t4 ltrmo3iatomDrai olt)texmiopoo4aptelfctls  2rmu  ;o4opeomieiltls rauvonu0artrmf totopt lnes () exm(rpnudapenlivsls artaxmonu1olt if3iatls umnvp t4aexoxo iy1oaDr neo t)setoim3nodope lnvilt) rrmum ;o0olx  iciltlm rmu pnt4 rtnxf io1om  lnvolt setoim oodllee icils)aDtr(r ;u1tptnmoeiad mDra( p;t4arxoir oydfm eli olt s2uoir ny1lpee ivsatfaDtaxmo;t4optn iciasfmDum(vpnu)aleoif oadfatr nvi;t t2umim oy1olee feils)srum( ont1opx mo3iytfs umumo () rxnxo iytlm elnvs;s)t2ur(rpoy1ame  fetat)a2umxmp;t0ole  oeiad sDuan p ()aeeomoctodlmDelnvi ()srtoimpno1lltnlfciasfsDrrumpoo1oee  ieiad sDuln pn(4alxoxocia1lmte neolt trtrxopiodal  mfvi (fsDra(r oo0olx mfctys s um( o u4 exnxocootfp elieol(0 ruo(r no1lmt lnvt (f rumxm ;o1oexn icias m emu s;()areoifcoy1opD  u il(0 ruoio nodlmteliei t)a2tmum no0tpxomfeiad mDum( p u)arxoio iatomDrlieo (0 2tmiopoo1ll e ncslsfaDra(rp;u4tpeoioeils a2em(vp u4 leoifctadlpD lueslt0t2umxo iu4ll emfvsasfa2raur nt4olxnio3iaslm ean snu)tetnxf oydlat ai ols) exo(r3oudaltelfcta()a2urxrpoo1tlt  ietys s2uauvp;t) rtomo3ia1op   nvs s) ruoxopiudomtemncs () 2ta(r nt0opxo feiys m2uluvs u0tetnxr to1om e u ol()teumxr nu4op  mfei ( srua(r ot1ole  oeiydls rau o;t4treoxo ta1fp  au olt0seur(m3io1apee nctl( artmxroot0aetomi3iys a2emu snu0arxrif iadlmtraneo s0 exmxo io1lm  mnvsas  rrr( ono1tpeo ieilt sDrlnvo u0aleoio3oy1optrauvi;s  2umxmpio1om nlivia()sDrmxr ou0ope mf3iydls ra(ms;u0 etoxo3oo1fa  aneilt0 2xr(o ou4aptelieils a2ra(mo;u0olxn oeiadlm emnvsnt0 reniocoy1om e ivi;s)trxo(r3oudole mfvsls) 2tmx o;o1oltoiietyd a rlumo;u4alxnmf oo1oaD livo t teurxo no4altemneia() Dta( oot0oeeo octad m2rm(mp;(4 rtrir oydfaD aueils0 eurim3nu1ll n ics (faDrrur oo0apx mf3iytfs2rau p u) lxoxo oatfm   uvo;()s2tmxm no4amtnlivslt)a2rm(moot0olxoio3iat a2rm(vo t4aeerxocio1la  lieols)s2umxr ou4olt  ncia(  2rmxrp;t4tlen iciaslm umuvo;()trtnxrciotoptelnvo;(  eto(mpoodol emfet (fsrur(mont1apxomocildfs2ua(vs;t0trxnirctodoate ieol( srto(o3nu4ll e nvtl( s2ua(  ;t1aleo ieiyd s2elnvp u)tetoxf3oodomDe uvi s0srtrxm3ny1ol emivs t  rur( o;t4aeeomocias s ul(vp t) exnxr3io1fmt liei;s) eto(m no4lpen ncils  2rm(r nu0oleomfciltla2elu sn(0arxoxociydomDean o t)s2xo(opnu1ole  nvtat  Dtrxm ot1tetnmfetatls uauvsnt)tlxoio3ia1oa  aues;t0 euoxrpnydaptnlncs sf rum( ono1opt  feiltfa uanmpnu0trtrircty1fpDrai o;t)seurxmpnudlpte fcs t)s2trxmo;u0tlx mfciydfm2uanmon(4texomr3tydlaDe uvo;t tetm(m3nu1ale  ivs t  Duaxro;t4oexn ocildfm2ra(vsnu4arenxf3to1fmt ln i s  2urxr3oo1apt  ieils)aDtax  ;t4aetoio3iytfm2uauvont)tlerif3iodfmte ies;s s2ur(m no4omenmfct s aDum(  oo0oex io3ild s2ra(ms t4tlxrmo3oodopDr n s;t) 2xo(m oy1lle lict ( s2rr(rpot0apxo oetltfm2emn sn()altoiocoydfm elu o;( trum(r3ou4lptelnet s  Dra( pnt1aexomoetldfs ean pnt)aleoir iotfp rlivs (0texr(m3ny4lltnlncilsfaDtaxm nt1teto o3tltfa elnmo;u)treomr3oy1lat lnvo;t teum(m3ny1ole lneilsfaDtm(mooo1olt mociaslm uanvp;u0texoio tytlat aneol(0 2xoxo3nodop nmict ( aDururp;u0apxnioetatlsDrm( sn()arermr3iy1fat luvi t s2uo(m3oudllen ncta(fs2raur ;t4alxn i3ild m rm(vs (0alxrif iytlaD an s;t)trxrxrpny4open ieia(fa2ururoot0texomoetys sDul( p;(4trxnio iadla rai sls0trxmio3oo1om nlncil(farrmuro;t1optomi3ils mDemn p () etrir ty1fa r ueo;() 2uoiopnudomen nvsasf 2ur(mpnt0tleo f3iadls eanmsnt)texomfcio1optelu o s)trtmiopoy4ome mfei ( sDra(rpno1aeeomieias a2ul(vo u4artoxocia1omDranes ( t2urxopoo1amenlnet (f 2rmxmoou1oleomi3tlt s2eauvo;t4aexnxo3iotopte i ilt)texoxmpiudam nlfci t) 2ta( ooo4tptoii3iasfa el( on() eenif oytomtraies;s0texrxr3iy1op emiei t)artaumono0ale  oeiyd s um(vp t4arxoif ty1fmDeau i t)srxrio3ny4llt  iviatf 2urx  ot4aeen f3iatlsDeln sn()tltrirciadomtelivsl() ruoirpiu1ll  mivtatfarrax p;o4tptomicils a uanmo ()tlxomo oydfp eliei;t0 rurxrpoodalen ieias s2uax  oo0tlxo o3tltfa ulu o;t0 lxomocoytfatran i;s) 2tmxm iy1apenmfvs t) rumum nt4aleoii3iadfs2rmu p;u)aetnxo3ia1latrlueo;s0 eumxo3ou4ale mnct (fsrtm(  ot1ale mf3iyd aDul(mo;u4 leomr3oy1omtrlues t0setmirpoydome lfvi s  rurxrpou0tex  ocildlm raums t0 reomo tadlmDelies;t)seto(o3oodlpt  iesls)sDta(m ;o0optomi3iadfa uan p;t0tltnir3to1lmt an ol(  rumir iu4om   nei t)arraxm ;t4texoii3ilsfa2rau s;t) rxrmrcootfatr neo;() eumxmpiodlmenlfvsat)srtm(m ot0tpe mociaslsDemu p u4aexrio iydfp r uvo t trto(rpoy4lpeelicsa()a2raump;u1aeeoifcilsla ra( s (4 lxrxocoytlm  au sls0t2xoir3io4llenliei s)aDtr(rpnt0openmi3ildla2ulu s (4tltrxfctotlm rluei s0 2xoirpou1lmen ici sf rurxmp;o4opt mi3tytlsDeanms (4 reomo3todlatrlu s ( teum(r3oy1lptnlnesls sDtm( poo1aptniicilsfa ra(mo;u4tleoxociy1lp  aieo t  2xr(mpoo4om e ici (  rrmxmpou1texnif3iyd aDulu onu4arxrif3io1lp r ieilt0t2trxo oo1ol nlncslt s2rmxr oo1teeo oeiyd aDemn o;t)teenir3iodop rauvil(  2uo(r3ou4lp nlietat  2ur(monu1altomoetltla2rmums;t4 rtnifcoo1fmtelieolt0t2umxopno1omtn fesas sruaxmoou1apx mieiyt a ranms (4texnio3iy1lmD  nvi;s0t2urirpoy4lpt  ncils aDtau  no0ale mf3ilslsDelu p () rxomrcio1lpte u s;t0srxmir3iudapeemfviltf rtrx p;t4olxn o3tyt aDrmnms u0aexnmr oadoa   u s;t s2xrim oo4op emnet t)sDum(r ;u1oeeo fctytlm2rlnmont0 lxnmfcia1latranvo;(0 ruo(o3ny4ol  mnvilsfsrrr(m ou0oeeo ictydlmDel(mp;u)artrxr oadopte u sls0srtrxm ny4am nliet s arrru p;o1alt mf3ilsfmDeanms;u4aleomf3tatfa raivilt seuo(o3nodamte fesat) Drm(mo;u1alx  feiad m rluvpnu0trtnmf tadfa eaivsls0 eurxm3oo1ale mnesa()aDrrumpou0texomfeiatls uauvpnu0artomf3oodfmtelneo;t trtrxrpno4ll  mncta(fsrumxmpnt1apt mfetldfm em(vpn(0 rtnxf iotoatean il(0 etm(opnudlptn fcsls)sDur(  ;u4aptnmo3tltlm uau ont0 etrmo3ia1lpt anvi;t) exr(r3io4lp  mics s aDtr( ooo0oee moctatlm2eln o u0tlxnmf3todoatrai o t tetm(m no1lpt  ivi s sDrmuront4oeto ieildlmDuaump;(4alenxrciytfm  aneol()seumiopnodaltelfcil( a2ua(mpot0oeenii3iydlmDea(vs;(4aexniociatfa e u ol(0trxoir3oy1oltnlivtl( s2taump;t0tle  feiytls ea(mo (4 rtomfcto1lptr nvs;s0 rxr(o3ny4am e nci (f 2tm(m ;o0open fciytlm2rmnvo;()trerxo tadfatr i s;t0trxm(opiy1lm nmfetat sDtax pnu1tlenmfctlt mDum( pnu0tlxoxr3oy1fpD aiei;s0 rtmxmpou1lm e iet ()aDtrxrpoo0tltnioeiydlsDean s;t4teerxfciatomt aueslt) exmirpoo1al nmnei t)sDtaxr nt4oex ifctyslaDrauvp ()tetoirciotfpDelnvils  2xo(o oy1op  mfvsas)s2umurpot1oetomi3ilt m el( on(0trxoio3oa1fmteaueils) eurimpnu1altn ivi ()srua(mo;o0tleomo3tys aDulnmpnu)tlxoif totlp ranvi;(0srtm(o nodlp n fctl(fs2rr(m nu1olt  fcilt s rm(mpnu) lerir iydlmt  n i;s0teurxr3no4am   nctlt s2rmu ont4tpxo ieiys m rlumpn() lxrmr oy1fpt  nvo s0 2tr(rpiu1opt lfctlt  2tmxrpnt4opto octaslm2uanvs t0aexnmf totfa  livsl( sexrxmpnodop nmneilt s2tm( oou0tpeomoctys a2em( ont4trtomociy1lpte nvi;t)t2urxrpou4om   nvta()aDtr(r ot0oee  ocild m2raumon(4aeerxoctydfpte n sls0 rtriopny4lmtelivta( artaxr no0oex ifcilt s2elu snu4trtoio iadfpDe ues ( srtrxr3ou1lme mivsa()srtmuroou0alxnmoetas s rmnvp;u4 rtrxf iytfmDeli i;t) rtmxm iu4alt mnciasf Duaur ou4aeenmietatlm el( s (4 rxniocoatfptr u ils trum(opoy1amt lfet (  Dua(m ot1tpto ociatlm emnvp (0 exnmocoo1lpDeanvilt0t2to(mpnu1omtn neiat sDtaumpot4aeen i3tydfsDemnmsn(4 rerif3oa1fp eaues;( tetr(r oy1lp  lnvilt)sDumxmpou0tlxnmfciasls2ul(msnt)aleoio io1omDeli i;s s2urirpio4aptn iet (  rra(  no0aeeo iciatfm2eaump;u4tetrmf3ty1opDelieols) rtoxo iu4oltnlivsa()a2uaum ;o0opt  fetltfaDuluvs;u) rtoif3tydlpDeli olt  2uo(mpnodam emfctlt a2ra(  ou4optoifeiad a uau o;t4 rerxo ta1lpDrliei;t)sexmir3ny1omt livt s) 2rrurpnt0aleoioeiyt aDeauvs () lenifcty1fpt li s t)s2xo(r nodamte ivs (faDtm(ro;t4opt if3iytla rmnmp;()arxnmfciy1omDrai ols teto(r3no1lleelnet s) rtmx ont0oet  fciytfaDuauvo;(4alxomocta1faDelnes t) rtm(opnodamenmicsat) 2tr( o;o4oexn iciltlaDrl( ont4 lermo3ty1opD li il() 2xo(m nodome lici tf rraurpnt1oeenmicildfs2eluvo u) rtoxf oytlm  luvo t teto(m3nydom elicilt aDrmxr ;t4teenii3iad s ranvp t4arxrmf ta1om e neo;s)s2tmxopnydalenlfeias)sDur(  ou0apx moctls s2elnmont4 lenxr3ia1omtraneols setrir3nu4lpenmfvs s)s2trum oo0tpxnio3iltfm2um(ms;(4trenio iodlat  ivi;(0 etmir3nydom nmivt (  rtm(  ;u1altn feiytla raums u) etnir3iatfa  auvi t t2xo(opou1optn neta( arraurooo4tetnio3iad mDean p t)aeeomo tytlmDrlieo;s) 2urxo no1op  mfciatfa2tm(rpoo4tle  fciadfsDumuvo (0 ltnmf iy1faD  ivo;t s2xr(o iydlltelfci s a2tmx oou0apeoiieiysfa2ra(mpn(4tlermr3tytoa elieo;t  rum(opoy4omtnlfvslt)artru o;t4tleomociytfa2rmnmp;u0trenmocoodla   uvi;() euo(m oy1lpee ncs s)s2rrum nu1oet micils s2umuvp;() exnif3ty1lmt au o;t teuoxo io4optn iviatfsrtrxmpou4tpeo ocilt sDelumpnu)trtnmr tadoaDrlnvo s0 euo(r iy1lp   fvsa( s2rrxrp;u4oltnifetadlm2emnms;(4arxnmr3iodlp   u o s seto(r nudolee fes t)srrr( ooo4apeo ieias s rau o;t4arxomfciy1la ean i t)trxoxopiydlptelfcs s)srtm(m ;u0aex if3tad m2rmn s;t4 rxnmrctadop eaueol() 2umxmpou1op emiet t  Dta(r ;t0oee mietyt a emn s;(4 etoxr3ootoptrauesls0 2urxr ou4oltnlnvta(fs2uau pno1oexnmociyslmDelnvo;(0tetoio3totlp  aneols  rxrio3oydaptemnvsl()aDtrumoot1teen ieias mDulump (0trtoxr totopDrli o s0srxrxopiodapeemivta( arraxront0aee ifeilt s2emnmpn(4 rtrmocty1laDeaneilt)srxrxrpou1aptn nvslt) Drmxrpot1aee mo3iltfm rlu o u) lerir3io1oate u il(0 exm(opnu4amtn nctl()srum( p;o0aexnmieiadfmDrmumo t4 eeoxrcoadlm  auvs s0setm(r nodlpeemfvils) rtr(rp;o4opxniietytlaDel( p;u0altrioctytoatelivs (0 ruoxmpou1lmt mneias) rtmxmp;o0tltnmi3tadfm ul( s u0 exrxfciodop r nvolt0 2xmxo3io4amtelncs sfs2tax o;o1openmfctatfsDeau s (4alenmf ta1fp eauvilt texmxopio4aleelfctls)aDtr(ront4tpen i3taslm elumsn(0texoifctadlm   uvo t0s2uo(m no4lptnmfeta() rrr(mo;o1olt mfcilslmDeluvs;(4areoircty1opD li o ( sexr(m ou4olte netl(  2urur ou4aexnmoetasfs eau s u)tlenioctytlmDrln o;(0srxr(r io4optemneia( sDua(moot4oeeo o3iytfa2umu snt) lxrir ty1omt aueo;s t2umirpoodope lnvs sfsrumu pno1tlxo oeiydfmDrmnvs u)treomf totfm raneo;t)srxm(opoo4apt  ivilt aDtaurooo1altnmiciatlsDrluvo (0tltoxf iodlm eauvs s setrim3iu1al elnet sf ruaxm ;u4aetn i3tydfa2ua(vs u0 etnmrcio1lpDe i ol(  rxo(m nu1lmt  fei ()s2umxmoot0tpto o3iadla elnms () exnxf ia1faDraueo;s t2umir oy4alen ivs t)srrrxm oo1oleniociat sDrau on() etrxo3iydomtr u s;t0srxmio oy1ape  nvils s2uaxrpnu0tlenmo3iyt mDumums;u)aleoif oadla  aneo;s) 2xrxmpiudamee fctat srumxro;o4altnmfeiys m2ra(vont)aleoirciotopD  ies;s t2toxo io4lle  fct ( s2uaurp;o4ale  ociydfs2umnmp;t)trtrifciatfa elnvi;t) exmxr3nu4alen fes ()arurxrp;u0tlxomi3iytfs raums;u0tlxoxo3oy1om r ivil(  rurio3iy1lptemfvia( sDrmum oo4texoiictydla elu pnu0aeenxo oadfat  nvsls0seuo(rpoudalen fci sf Drru  nt4ope io3iatfsDrlump t0teeomocoo1lmD  nvsls0srtrim iy1ap nlict t) rtru  ot4oltoifeild mDrm(vp;t4 exoxocoydfm elnvs;t  2trxopou4lp nlicslsfa2tm(ront0aexomietatfsDrmums t)aexrircootfmD  i il()trurxo3io1lmeemieilt)artrxmoou4oleoiieiasfsDua(vo;t) reomr oydlaDrlu s;(0 rtoxopnu1amte icta( sDtrumo;t0oee iiciydfmDuln o u)aetrxr iytoa rln i t) rtm(m iodopee icilsfa2umum oo0teenio3tld sDumumon(0teeomf tydlp r n o;t0s2umxr3no4lp n fcs ()srrm(  ;u1aetnmieiadfa um( s;t0artnxrcoydomDr nes;(0 rurirpoydlltn nvt sfaDrm(mpou0opxn iciysfm rl( sn()alerxrcoatfmtrlnvolt)sruoir no1amtnlneia()a2umurp;u4olxnmicilt m emn o;(4 rtnmr tydlm   uesl( s2xoiopoydomen ncslt)s2tr(mo;t0aeto fciys a2eanmon(4 reomfcoytopD  n s t0t2umiopiu1al emicsl(fa2ur(rono4texoiietad m ul( pnt) rerir3ta1oaDeanvs;( trtoxmpny4amtelicsas)sDua(monu0tpenmfciasfmDrmnvp u)areoifctotlaD  n i s)teurxrpnodop   nviatfs2tr(m ou0altnii3iatfmDeaump t4alerir3oytoa  ln o s)s2xmimpnodol n ictltfs2tm( poo1opt  feiltfm rmnvs t0tltrio to1oat auvo;t)t2um(opoudomt mietls)sDta(  nu4alto o3iys m2ul(vp t)arerxr to1faDrau s ( texoiopiydlmeelncs tfs2um(rpot4tlxnmo3iysla2ul(vp;(0 exnio3oodoat  i ol(0tetm(m no1lme lfetlt)a2raurp;u0tltoifeias a2rlnvonu4tleomo tytop   uei;s texoxo3oo1apt mietatf Duaxrpnu0oexo ociyt m2eau o () rerxr3to1fm rau i t)srto(m3iy1ope mictls)s2rr(m ;u4tpeoiietyt s2rl(vs (4 lenxf oa1omDraies ( sexmxm3iydlmee ivsas)arrr(m no4opx  f3iatfa umuvs;t0tltoxf3oydlpDrli ols0sexoimpno1om nlnvs t)aDrmxmo;t0tetnmiciatlmDemu o;()arerxr3tadlmD  iei ( srxoio3iu1optelfci s)sDrau pou4altnmiciydfs rl(vp;u)trxnmrciatfpt li il(  exo(r3no1ll emfesa(  Dtau p;o1tlx  f3iatlm uln s (0tetrmo3oytlaDr u il() etoir nodoptnmfvsls a2um(mp;u1opx mieiasls ul(vo ()altoio totoa   i s ()t2xrxmpnodape liviltfsrua(m ;t4aee  fetadla uanmo u4 reoxf3ia1fatraneo s seto(opou4aptelivt sf Dtax ont0oet  f3tldfmDumnvsn() etnmrcoo1faD lnei;t)trto(o io4altnlici s srua(mont0texn ocildfaDrm( onu0treomf tadfa elues;t)sexm(m3no4ap emiesasfaDur( pou1tpenmfeiys mDrln s;(0 lxnxrciotfpt aues;s teumxopno4lpe  fcsas a2tax ont4tptoif3iasla um(ms;(4altrmfctodfate nvs;t0s2toxr nu1lp e ietltf 2rmu oot0oltnifciatls umumsnu0 eerirctytla   nvi s) eto(opiudamee icsa() Dumurpot0aexn iciyt mDrmuvo;u4aetoir3to1lmte nvi;t)tetoio oudlpt mivils  2tru pot0aeto fctld aDra(mont4 ltnif iy1fmDeau i;t  eum(opou4om e fvias) rrr(rooo4opt moetls aDuanmp;t)alxoxf3to1oaD lueo ()t2toxr3oy1ole mncsltfa2tmumooo0tle mfetls m rln sn()aexnmr3oydfaDrlues t srtmxopoo4llt lfciltfs2umxmont4tleo fctyd s2el(mp (0altoifcio1late ivo;( t2um(opnu4aptn fviasfsDua(rpnu0tlx iiciydfm2rm( onu) renmf3ta1opte n s;t0seto(o3no4ll e ivtas srtr(rpot0tpx  fetld aDemnmpnu)aetnxociytfa r iesl(0 eumir3iu1alt  ics s  2umxm ot0optnioeiadfmDeln sn(4 ltomr oatfm  lueolt0 2tm(m3nydomenmnvs s) Dtaum ;t1oetnifciad s2ulums;u)trtnmo ta1fp raiei;s sruo(r3ny4optelneslt sDtrxmpnu1tee  ociytfa eln ont0arxrir3iodla r n o t0trto(r3no1ale mfvt sf 2uru o;o4tpto ictaslm rlnvs;(0aexomocoodlpD  ies;t srxrxr io4olee fvslsfaDua(  oo0opt moetadfs2rl(vont4trtnxrciy1fmteluvi;t trxmxr nudopt mnciat aDtau ooo4tpeoifciatfm2ea(vsnt)trenio3tatlm  auvslt s2ur(mpou4ap  lfcsa(fa2tau ono0ole  o3iasla ul(mpn(4aeeriocoydfpDr ieol()t2xmim3iy4lp  micsatfsrrmum no4oexn fctydfmDeluvs t4 etrmr3ty1opD an ol()trxoxmpou4aptn nvtlt)sDrax  ;t4tpenmo3tltla emu p (0teermo todfmDraivi;t trxm(r3io1omtelicsatf Drau p;o4apeo feiadfaDrmumont4 leomo3iodfpt lieo t0 rtm(rpio4amtelnetlt sDtm(m nu1tpxnifcias a2ra(vont4 rtrmr3iydfpDr iei;s) 2uoxo3oo4lpt mivia()srrm(rpou0tleo o3iaslm2uaumo u)aleomo oytfaDr ieil()srtm(opoy4omee fet sf Dum(rp;o4tle ifcils a uan o u0 lermr3oytfmt aivol( sexmim iu1ap elivsat  ruru  ou4olx mi3iatfs ea(mpnu4aetomociadfatranvs;s texoxr ny4ol  lfvsl(fa2taxmono1optn i3tys mDua( snu4trermfctytfpDranvo;s s2xo(o ou1oltnmfeta( a2taumonu4oet mfeiatlsDumn o t4arenmo io1fm elivo s) rumimpnudapt lfei t aDuaxr ou4ole  ociydla uaumo;(0tetnifcta1fpDrliei t trumiopiy4omt mnet sfartmu pnu4tpenmfeiaslm2emu o;u) reoxr3oodlatrluesl(0srumxo ny4ll  micsa(f 2rau  nt0apeoii3iadfs2rmnms ()aeenxrciydfaDrai s;()sexrimpio4omenmneia(fs2urx  no0aeeo feild m rlums t) exoio tadlmt anvs (  etrio3iu1om nlfcsat arurx oou1tpxniictlsls umn snu) eenxfciotlpDean o;t)trtmxo3oodalt mictltf rrau p;u0ape  oeiad a el( o;u0trtnifcta1lp r nei t0s2xmio3ou4op  mneias)arrr(mp;t0oexniietls a rlu pn(4 etrio iy1opDe nvo;t0srum(m3ou1openmfesatfaDumxro;t4ape  ictldla uanmon()trxnircootoaDean i (0trtoxrpnodom n ivsl() rtaxm ou0ole iietatla2ea(vpnu0altnmf3tytfm r uvsls s2xr(m3oydoptelfei s)srtmxmono1olt mieild a em(ms;t0trtoxf3oytlp e u sl(  eumxm iodope  fvsls)sDtr(m oo0teeoio3iat s2rlnmo;t0altnmfcoytlm eai s s0seur(m no4olte nvilt  2ta(m ou4alto o3tad m2emnvs;t)arxoxocty1laDr n o;t0 2xmxr ny4aptelfet (farurxr nt0oeenmoctat mDrmumsnt) etnir3iytoaD aivs (0t2uo(r nudlp  liesl( aDrrumo;t1alxo ictld aDemnvs;u)alxnxo to1latr iesl()sexoxo3no4amenmicias s2rmump;o4tex moctydla elnmo;u)tetnmocoodfptrluvs;s  rxm(o3oy4apt lfcsa(  rurum oo4aex mfciys m2el( pn() etrif3iodomD  ieol()t2xmir3iydamtn ivia(  Drr(r ot4tpxnii3ildlaDrm(vo;(0 lxnmr iydopDeaivs;(0teur(m io1al  lfvtl(  Drm(ro;u1apeomf3tatfa uau snu)arxrmocootoptran i;s)teurxo3oydlp   nvia() 2tmx  ;o1tex  ocias a2emumpn(4arxnxf tatlpDr u sls) rtmim3nu1opt mfvs (f Drax pou1oee  f3iat m2rmuvp;(0aexnmrciatfa  auvols0 exm(o oo4aptnmicsat)a2raurpnu4olenmi3ildfmDumnvo;u0arxrxo ta1optrlivi s) exr(o3ny1am  mietl( srra(mooo0tee iieiysfsDua( pnu4 rtnmr totlpt auvs;()t2to(r3iudol n fcsasfa2rrumpoo1tleo octydfaDulu snu0trenmrcoydfm e i ol(  rxoir io4amenlnctl(f 2tr(  ou1apenii3tls mDuau p ()trxnir3io1lpD  n o;t s2toimpoodal  mfetl(fa2uaxmp;u4texn i3iyd a ra( pn(4 rxoxrcty1fmtrauvilt0 2toim3iu4lp   fvt (f rrmu  ;u1tet iicilsfm eluvsn(4 rxnxfcootop  lnvilt0s2tmimpoudlme mivi sfsrtrxrp;t0apx mfetyd mDrm( s;(4tlxnxfctotlpDelnvs;(0 rum(r3iu1lm  lici sfs2ta(mont0olt moetaslaDea(mo t)aexnxrciadfpt  ivol( srxrim3iy4apeelietas)aDurumono1opeomo3iys m uluvs t4tltoxfciodfa eau ils0 exoir3nodalen net t aDrr(m nt0optoio3iadlm2elnms;()alxoir oodop   u s;()trto(r3nu1lp  mnvt s)s2trxrono1tet mo3iltfa2elumpnt)texrxf totfaDe ieo;s) 2to(opnudol nmfcsls)aDta(  ;u4alt  o3tysla emu sn(0 rxrio3ia1fptr nvs ( trxoxo3oy4ll  lici s)a2tmxmooo4oee  fcias a2ean o u0arenxo3oydla rau o;() rto(opno1llte ivtasfa2rrx p;t1tetomf3ildfs2ulnvo;(0teeoxo3iydopteaueil( t2toxopnodameeliesatfsrrm( o;t0oeeomieiysfmDrm(vp;u)tlxnmfctydla eai s t)trxrir oo4oltn nes s)s2tm( pnu0opxnioeilsfa uauvo t0trtrio ta1fmtrlnvol(0 ruo(mpno1omenlneiat srrmur nt0altomfetatfmDeluvp t0altomfcoydfm eai s s  rumim iydlm  licta( sDrru pnt4aexnmfctld s el(msnu)altoiocoytoaDeauvi;()s2xm(rpio4alenmnvilt s2urump;u0oeeo feiydfaDua( snu4artoxrcto1omD anvils)tetrimpiy4apeelfesasfartrum ot0aleomoeilt s2emnmp;u0trtrmrcta1lp r uvslt  rur(r3iu4alen fes s)aDtrx ooo0aptn fciyt sDelnvo (4 exnir3oy1omD lieils0texoxr nudamen netl(farrrxr ;t1tlx ifetlsfs ul(mo;t0 reoxf3oy1lpDeau ol()s2trir no4amee fcsltfa2tr(  ;t0aexoiietydlaDua( s (4trxrxocoo1oaD  iei;t s2tmxm ny4lpeemies ()sDtru pnu4teto fctlsla2el(mont0 exrir3iodfmteanvslt0t2uoirpiydal e nvsas  Duax  ou1tlt  iciysfa ran onu)trxrmf3todlpDr u i s  rxm(rpou4amenlivias a2umxro;u0opxn ictlt sDrlnvp u0 rxoxf oadomtelnvol( trtoxrpnodam emicilt)s2tmuronu0olxo feildls2ran onu)arxoxr3oodop  livols0srum(mpiy1ape  ivtls a2tmxmpno4tle mieiatlm ua(mp (0tetoxo tadlm ran o t  exmxo no1lm emncilt aDtm(mo;u4alxn ociasfa2elu o;t)arerifciodopteaivslt)trur(r3iudamtemici ()srurum ou0olxomieiasls umu p () rtrio tytlaDrauvs t0 rxrio3oo1lmt  icil(fs2uaumpou1texomiciyslm umu snu4aeenif ty1fmtrlneslt) rto(r iudomee ics (fa2uaxrpou1opxomfciadfaDel( p;(0 rxrmf3totom r ies;s)t2uoxr3no4lmee nviltfaDumx ono1opto oeiysfa rl(von(4tlxrxo3oytfp elnesls s2xmio iu4al nmiesltf rum(roou4tpeomietysfm2um( p (4arenxf3iy1oaDelivo s0s2xoxr oo1lmee nei tf rtau ooo0olx ifeiltlm uanvs u)altrif tydlmt aueo;t0setm(o iydopen ivils)s2uaxro;u0aeen oeiatfm2ea(mp t) ltoircto1lp r nvilt0t2urim no4omenlfei tfa2taxrp;t1tptomi3ils sDulu sn(0texrxfcoa1faD ln i;s)tetrir iu4ap nmfvs (  rraxmp;o1tpx  ietat m rl(mo u0tetrxo oa1fpDelnei;t)trtm(m3nu1lptemict tf Dum(r nt0ole  iciyt aDumn s;t)trtomocia1fmDelueo;()t2uoxo no4oltnlivs (  rua( pou4teto f3tatfs2ean pn(0 rxnmf oa1omtran i ()sexoimpoo1lleelictas)s2rmuroou0tetn oetltlm rmuvpnu4arerxfciadfpD lnvs ( t2tm(m nu1lmeemfcs t a2rmx p;u1aeenmf3iys s2ranvp (4 rermrctatfm rauvo;(0texoxr iodal elnvia( aDtm(ro;o1opxo f3iad s2uanmp;u4artoxr3iadom rluvsl( setrim3ou1ll e nvsa(f 2trxmp;o0aeeo f3tydfa2uauvpnu4 renioctodomDr uei;t) 2uoimpoy1llee fetat) Dta(  nt1texoiictyd aDrmn o;(0trenif io1latelies;t t2um(o3oydlmtemfcsas sDua(m ;u0oleomfctas m rl(vo;u0arxomf3oy1lpt  n o;s  rxmiopnydap   nes tfa2urx ont0opx iietydfa2el(ms;(0altomr oa1optrau i ()t2um(m iudlle  ics tfarur(  ;t4aeeoii3tyd s ran p (0 rxrmoctytfa r ies ( teumxmpiu4ale  ncs () rum( pnt0texomi3ildfs2uaumpnt4 exrxfcta1fpDe nei;( t2trxm nudalt mnvi t s2uaxrpnt4texo oetas m2emuvsnt) rxomf oydlmte ueolt) 2xmxrpny1am   fei ( s2taxmoot4oeen i3iadls umn pn(0artoif ootfpte iesl( t2tmxo io4ame  ncsa()s2rrumo;t4oeen ieiysls2rlums;()alenmfcoatoaDelueo t) ruo(mpoy1omt  fvsa(f Duax pou0oex ifciysla ra( p;()teermfctydom e i o (0sexr(r ou1al n fcslsfsrumu pou0tlxnmfeiadfm ran snt)tlxrmocoydfp e u s s0seuoxopoodolenlnci tfsDuaxroot0altniieiadlm2ean s;u0aetnmfciadomteanvols0teumxm3nu1llt mfcsls) 2tmxm no4oeto ieils mDuauvp (4tltrmfcoa1late iei;t  rxoxmpiudlptelncsas srta(mp;u1aexoiictldfa2rluvsn(0alxrmf3tydla elnvolt) rtrir3oodame  ivils) rtr( ono4aexnmieiydfaDel(vo t0arxomo ta1fp e iei t0t2umim no4lpe mfct s s2ur(mpno0apxn o3iadlaDel(msnu)aexnmrcoy1oa raivi;(  eto(r3oy4al emnvil()s2tmurp;t1tlt  ociydls2rlumsnu)aetnxf3oydfpDrlnei s sexmxopoo1lm  micias)aDtrx o;u0tlxo fciatls2emnmo (4 ltnio tydfpD lu s;s teuoxr oydolen ncsat)srtru o;u4alen ieilt s2rluvp t4 lxrmf ia1oat au o;() 2trxo iudlptemnes s aDtaxrpnu4openmfciydfs ulnmo t0 eerxrciotlpD anei;s s2trxrpiudoptnliesasfaDrr(m ot1tlx mi3tlslaDuluvp;u4tlenmocoodfm  luvi;t0setmirpoodoltelnciltf rtmu o;u4aee mieiyd s2emu snt)tlxrmfcoydlp   nesls sexoio oo4lptnmneils)s2rmu pou4teto oeiydla2um(mo (0 ltnir ty1om r n ol(0srumxo3oudlleemfcta(faDrrurono0aeeniiciadlm2emnvs;u0 lenmfcta1fpDrai ols  rxrxr nydale lfetlsfa2taxrp;o4aleo feiatfs ranvs;u4 rtrio totlptr nvs (0srumxr no4lp e fvsa()sDur(mpno0olxnio3ils mDrm(vs;t0aeenmf3iodfm   n s;()seur(m iydlm  lies s  2trx ono4altoii3iltlaDea( o;t4tltoircio1omt aivs;t  euoirpoydolenmicslsfaDur( ooo0oeeo iciydla2uau s;u0 exoifctodomDrluvo;t seuo(r nodomtemnesat  rumx  nt1tpe if3iltfaDuan o u0texrircoytfaDe nesls srumxm3iy4am elictat)aDtaxro;o0aetomfeiyd s ea( sn(0 lxnmr oo1omtrlnvi t t2to(r3oudom  lnvtlsfs2trxmono1openio3iatfs2rauvo (0teerxrcty1fpDean slt)texmxr oy1olen fvs (fsrrmxm no0optn o3iaslm el( p;t0tlerifcoa1lat  ueilt  2uoxo3oudlle mnesls)s2rr( ooo0aleomiciydfsDraumsnu)altrmocoo1laD  u s;t)teuo(m3io1open fvta(fsDumxmpoo4opt miciyd s2ean o;u0artomocia1faDeauvi ( texoxm iy1omt mnei ( srurxmono1opeoio3tydlsDua(mont4trxrir3todfpDrlnes;t setmxo ou4omt lnesls)aDtr(mo;u1openmi3tytfs2ranvs;t) eenir3iydop r ivo;s) rurxopiy1ale  nes s)aDtrurp;t1tet ioctlsfm2um(vp;(0tltnifcio1laDrlnvsls teur(o oo1aptnlictlt  2rmum ;u0tpxnii3iydfm2umumont)alxrmr iotopt li ilt0truo(r3no1ole lnct () Dua(mono4tlxnif3ildlaDeanvp;t) etrif oadom  aiesl() exriopnu1lmt lfet () rtr(mono0oetnio3tytfsDua(vs ()aetnmf3io1lmtrlueils  2uo(r oydam elici s aDrmx pot4alenif3iydfa2rmuvs () etnmo3ia1lp   u s (0 2toxr iu1ll nlfeiat  rtaur nt4opxoio3iysfaDulumpnt4 rerxo3iotfmDelueolt) euo(r oo1amt lieta()arrm(root4tlt  fciasls rl(mp t)arxoxr3iatfpDr ivs s0s2uoxo iydlm e nci s  rumuronu0altomieiytfmDumnms;() exnmfctydoaDrlu sls)trtoxo oo4omtnmfctl( a2taum ou4alt iieiysfa2rl(von(4 lenmo oa1lmte ues (0s2toio3ou4op e fcilsfs2tmu  nu4ope ioeild sDran s u)artnmf3iotfptrau il( texmxrpno1omtn ietl()srtmu pot1tlx  oeiatlaDrmumo;u) eenxo ia1faD anvo;s0trtrio oy4apt  ivsat)s2tmum ;u4olxnmoetltfs2elumo;u)arxrmociydoaDrlueo;s)s2urio3no1ll nlnct (farrru p;o4ape iociys s umn on(4 exomrctytoa   ueo;s s2uo(m iy4ap e fci s arumxmp;u0apxnmicilsfa2el( o;u)alxrxo3ia1latelu o;t0s2tr(o iu4llenlieia()aDrrxm oo1tee mi3ilsfmDrl(vpn(4 eenmr tydfaDelueols0srxrxmpoudal nmfvtat s2tauroou0oet iictas a2rauvo;t0artoxocoytoa  ai o;s t2uoirpou1op nmiesatfsrurxmpnt0tpto i3tls a2uaumo t0 lxoir oodomDrlnvils0 eurimpny4lmtelivsasf rrau  no0oet  f3iad aDulnvp t) reoif iatlp e uvsl( s2urim nudlm  mfci ( srtm(  nt1apenif3ias a2ua(mp t4 rtoirciydopD anvs;()s2xoim3iu4om e iei () rumxro;t4oexoiietatls raumo t)teeoxo3iydomt  ues;t)trurxmpiudlm elici s) 2rm(ront1opeo fciys aDrm( o;(4 ltrif3iotlmt liesl( s2umirpoy4ame mnvils) 2uaumpoo0tpen octydls rmums;u4aetoir ia1faDeaivolt)setoiopio1amenlieslsfs2raum ot1olxoiietldfaDul(mon(4alxomfctotom ran olt)trur(rpny1ole lnvs ( a2urxr ou0tlt iociat m emnmonu4 reniocta1latrlnvo;()srtr(o iu4ll n ivsa(  rra(rpnu1olxniocilsfs ea(mo;(4aexomf3ta1lmDelivilt t2xr(mpnu4optelnctls) Dtax  ;t1tltomf3tyd s rl(vo;u0alenxf3todopteli i t) 2urxr oydoltnmfcs (  2rru pnt0ope iicilsfs2em(vs t0 exoifcio1fptr nesls0 rxmxmpiodom  mieias sDua(r ou0apt mfciatlm2umu s;u0tlxrxr3iydoa rai s;(0teuoimpny1ll n nctasfsrur(ront1optnif3tasla ea(vo;u)artnxf ia1faD li i t  rtoxo3oy1optelnctas s2trxmooo1oet iiciytlaDuanmpnt)arxnif oa1lptranvolt  eurxr3iu1lltemnet (f Drr(mo;o4optomoctyd mDumuvsn(0aetrxrcoadlaDraivo;t) eurim3oy4amtnlfctl() 2taxrp;u4apx mieiyt sDul( snt0arxnmr3oodfat an o s t2xrir3oydlm  lnct ()aDrmx  ot1oex  fciltfm ra(vpnu0tleoxocta1lpt ln s s) 2xr(o3oo4ol emfcils a2ta(root4tetn fctlt aDelu sn()alxoio iadomtelnvils)srurio ny1lp nlivtls)a2uax  ;u4alt miciat s2el(mp;(4trxnir tytomDeanvs;t seur(r3nu1amte icsa()a2umu ont0opto o3iysfs um(von()teeoxo tadlp   ueo;t)sexmir nudaptnmfcsasfsrtmu pnt1tpenmi3iadfaDeanmp;(4tetnmfcia1op rauvo;t0sexoxo nu4omt mivs t)s2rr(r ot1tpenmo3iyd a eauvsn(4tlermrcoy1lm  lues s  rxo(o3no1lptelivtls)arra(m no0aetnmi3ildls2eauvp;(0tltomf3ty1latr ivo t0 2umxopnu1lmen ieiat)srrrumpou0tleo fetad a rlnmon(4 exrxf iadfmt ln o;s trumimpnu4lptelfvsls) rurumpnt1apxomf3tls mDrmn o;t)arxrif iotomD lu i;t)sexo(r oodlm  mnvil(farrmur ;t4tlxnii3tyt a2rln snt4tetrmr3oy1op rai i;(0 rxo(r3ou1ll e ivt (fsDta( pnt0olt  fciydlsDrlumsnu)arermrctatopt  i s;(0seumim no1oltnmfei tfa2ur(mpno4olxnmi3iydlmDran o;(4 eerxfcoadlaD li o;t0tetrxr3nudole mnvt tfsruau ooo4tpeo fciadlsDulnvp;u0 rtrir tatoa r ueo (  2um(r3ou4apeelici s) 2ur(mooo1aptn fcias s elump;t4alenxo3todoaDranvo;s0trumim iu4al  lictltf Dtmu  nt1aleoiieiysfm2rm(mo u)teeomo todop ean olt)t2xoxm iy4altemnvslsfa2ta(rpot1olto fciyd s ulnmo u)teenif oy1opt anvi t) etr(rpiodlp  lfesltfa2uau  nt0aeenmocilsfa umnmsnu4tleoxfcoodomDe i o ()trum(o ou1opte nvil(fs2tmu p;o4oetomfetls mDrau s u4tlxomf3oatfateaivil()setm(o ou1amtnlneia(fsDrmxmpnt1oexomfeiaslaDulu s () renxo tatfmtrln slt)sexr(m3iu4ol  lfctat)arurx  nu4alt  f3iyt sDelu s;u)trtrmr oodopt li s;s)trxrxr io4omtnmieilt) Dur(r ;o0tet ioctad s2uanmo;t0 rtrmfcoatomteluvs;s0t2tmxr oudllenlicils s2ur( p;u1oetomfeiyslaDumnmp () rxrif to1lmDrlu i;t0tetr(mpoo1lltemivs t) 2ur(root4ale mfeilsfm2rlnvp;u)arxnir tatfa  li sl( s2xrxm3iodlpeemncsas)aDtm( pnt1opxnmf3ilsfmDumnmo t0aetoir3ootfm r neils0s2um(r3oo4apenlivt tf rrm(  nu0aexn i3iyslm2ul( pnu0texnxo3oo1fptr nes ( texrxrpno1opt mnvtas sDumx  oo0ale ii3tlsfm uauvpn(4texomf oodfpDe i ilt)seurxr ou4amtnlfet s)s2urumpnt0ope miciltlm elums t4artnmfcto1fp eai ils)teumxo3no4lmt mfvsas arra(rpnu1apxomf3tytfmDranmo ()artrxr ootoa ranvsl(0s2xr(r3nudlmen ici sfs2rmu  oo0alxomieiys sDem(vpnu0 eeomfciadoa e ueolt)setmxr oo1lpt  nvsa( a2urumpou1olxoii3iyt m rmnmont4altnmf3tadfp ran i;t0setmxmpiydap nmnvt s s2rmu ooo0opx ifctlsla2ulu ont)altnxf3ootfp  aues;s)s2tmxopnydlptemfeil(f Drau ono4aetnmfciat sDemu pnu)tlxomf3oa1oa ran ilt)srtrir oydll emfcslsfa2rrumpoo1aexomo3tasfa2rln on() rerif tydomDean il(0srtoiopoydopeemiei t) Drrxmpno0alen feiyd m uan p (0 ltnmr tydlaD lnesls0 rumim oydllt mnvtasf Dtr(ro;t4aet  oetadlsDelu sn(0 lxrmo tytlp eliei ( texr(rpiu4lp  lfeil()srtmxmpnt0aee ioctat aDua(vsnu) etrxoctydoa raivo;t0srxrim no4om  mnctat a2taurooo0oetn oeilsfa2ea(mp t4texoxr oatfmtr n olt0teurxo3no1lmt mics t arta(moou4oet mfctadfaDrmu s (0tetnifcio1fp rli s;s) 2uoxrpoudoltnlfesls) rua(rpou4tetn feildls2ra(vsnu)tlxnif3ty1opteaueolt0trtmio3iu4lpt  ncsa(  Durx pno4tleniiciat s eanvp t0trerxo3tydoate ivi () exm(o3iu1alee fes s a2rrxm nt4tex ii3tysls2raums;t)tlermfciotlatelnvo;t)t2xmxm3io1op  mivsl(  rraxmpnu4alxnioetydfa umuvp (4aexomo ia1lm   nei s0srxo(m ou4lptnmfciltfsrrru  ot1texoifciat a ea( o;u4 exnmr3oatlat aieo;s0 eumxr iu4ale  ici (  2umx ono4tlen iciatfm2ea(mp;u0teerxrctytfpD livo;(0sruoxo iudam elfvsl(  2um( o;o0ape moetysfm rmu p u0tetoxf ta1fp eauvi t trtr(o iu4ll emnetat)a2raxr ou4tlx iiciys a2ranvp (4alxrif iadfmDraueils)t2xriopno4al elnvsatfaDta(rp;u0tpe iieias a ul(vs (4 reoxr iydfm eaies s0 2uoxrpiydam  livtasf Drr( ont4aleomieiysfsDraumo;()tetnirctydfp   ivs (  eto(m nu4omte fvsl( sDtm( p;o4aex ii3ias a2elnmo (4trxoxr3oytfmt  u i ( srurio ny4lp  mneta()a2umur ;t4tpxoif3iytlmDrauvo;()tetoio3tydlp   iei t0s2tr(r iy1ame lfetlt artr( pnt0tptn i3tltla2ul(vs t4 rxomrcty1opDelu i s t2tr(m3iudlle mnesasf 2rr(mono0oleoiieiat mDumn o (0arxomr3tydlaD aivi (0t2uoxm nodlmeelfvils  Dtmumpnu1aeenmf3tydfaDua(mp;(0altrxocty1op   ivi s) rurimpoydlptnmfvil(f rum(  nt0oltn i3iltfm2uanvp;(4treomf3tatlmtrlueo t t2xo(m3iodole lfeslt)sDtrumoou0olt iiciysfaDumnvp (4aetomf iytfa  lieo ( sexoxmpno4ol   ieslt)sDrm(m no0aexo i3tytla umu s u4trtrmr iy1omtr u sls  etoirpno4lpe  nei ()s2rmumpoo1teeoif3ildla2rl(vs u0 rxrmo3tatopDrauvs;(0s2ur(r nydamtelfvils)aDrrum ;u0ope  ictyd a eaums t)alxoxrciadfmD ln i s)t2xoir iu4ale  fvi sf 2um(mp;t0tle iietadls rmnms u0arxomr3oydopDe ivilt)srxr(mpiu1amtn fvils sDtm(mpoo4ope micils s el(vp;u0 rerirctydlpt aneo;( sexm(r oo4am n nes t  Dumum ;t0oetoii3tltfsDemn p;t0arxoif tatlat aues;t0tetmxrpnu1ap nmivsls)aDrmxm ;t1tetomiciydfs2ran p;t4 rtoxo3iytlpD auvols0s2uo(r ou4lpen nct s s2trxr oo1opx mfetysfs ulnvont4 eeomr3iotoateau s s0tetmirpiy4am  lfvslt)aDtrxrooo1olxoif3ildlsDrauvsnt4alxoir tytfmtr u ilt0 2tr(r iu4ol emietlsfa2rm(r nu1aet  ociyd m eaumsnt0trxoxfctodopte u i t0 2trxo io4omee iesa(f Dua( oot0oexomf3iydfmDea( p () rtrioctotfmt  neslt0t2tmxo iudomeemnvi (fa2rrurooo1oeeoiictytlmDua(mpnu4 lxrio3oydlmDrai slt) etrio3ny4lm emfviltfarum( ont0oex ifeiad a2em(mp;u4aexoxo3iadop rluei ( srumxrpio4olen iviat)a2rru o;o4tlx mf3iadls ul(mp t4tetrifcio1fpD aieol(0setoxr nu4am e ncia(farumum ou1alx io3iyslmDulnvsn(0 etoio iy1fmD  neo;t0 exmimpoo1ale lnetltfs2urxmpnu0tpeomicildls umu p;(4tetnmociadlmtr n ils) rtoxm iudop   neta()aDumxrpnu4teeoiocilsfaDeauvo;t4tetoxo oa1fpDeluvolt  etm(o3iydopt lfeiat aDtmx onu4tee mictlt s2rmump (4trtoxr totfp  auvi;s0texmir ou1altelfvi s sDua(rpnt4alt  ociadfm2uaumpnt0 exomfcty1fa  auei;s0trxrxm nudalee fet (fs2umump;t1oleomfetytls2emnmo (4trxnio3tadlpD au i;s0 exrxrpiudamtn fvtls aDrmur ;u0ale mfciadfa2umuvpnt4aexnifciadlpDr ivolt  eurimpiudap   fvta(faDrr( o;o4tlxomi3tyd sDulnvo;u)arxoxfciydfmte n o ( trxr(m3oy4omeelfvs (faDtau p;o1tltoifciat sDea(von()teermrcoatfmDeaiesl()srxrxo3iu4omee fvil()a2ra(  ot1oeeo oetatfsDulnmpn(4areoxocto1opt aivo;s) rurio3io4lltnmici (fsrrauronu1opto octadfmDraumsn() eenmfctotopDraivi (0 etr(rpoydaptn ivt s)s2ta( pot1opx ii3iydlaDeanms ()tlxrmr todom elnei s)t2xmimpno4apee ictasfa2rr(r nt1alxnioetls aDemnmp u0 eenio oatopD  ivs;s0trxmxo3oydapte fcsasfsDuaxro;o4aet iieiasls2rau p;t)arermr3iotla e uvo;t  rtmir3iy1lltnliciltfsDtau pot0olt  fctadfmDel(msnu0aeenxociytoateluvol( srto(r nudopenmfvs (  Dtr(monu4oex mo3iad mDuln onu) lenmr3oydlptr n sls texoir3iudolte iviat)sDur(mooo1texniiciys mDeaump (0arenio3oo1opD  i s;(  etoimpoy1lmt lietls) 2umxrpoo0teenmieiysfm eauvsnt4teeoxocty1fp e u il(0trxoxrpnydole mfvsat srumxroot1tlxomf3ilt sDul(vpnu4aeeomo3tytopD  nes;t0t2toirpiy4lm emiet (f rtmxrp;u4alxoifcild a2rluvs t0 ltoxrcoodfaDelu i s s2uoxr3nydapt lieiasfaDta(rp;u0aee  ietys a2rl(vo;u0aexoxociy1lmD ln ils) rxr(o3oy1lpen nesa( a2taxmpoo0apx  f3iadfa rl(vo;(0trenxoctadfmtr n s s  rxr(rpnydop elfvslt) 2raxmpnu1oee iictytfa2rmnmp u4arermrctytoa rlieilt0 2um(m3iydapt  nct s) rtau oot4opeo o3ilslsDumumo (4tetnio oydlm  ln i s texoxopno4omt  neta(  rtm(  ou0olenifeiltfa2ulnvp;t4trtrircoatfpD au o ()setoim ou1amenlnet sf Dua( p;t0tptoifeilsls emuvsn()alxnxf iatfp  ln ols sexoim3iu4omt lfvilt srra( oot4apeo iciatla2rmuvpnu0arermf3oadlmtelu ils)trtmxr3nodop nmncsa()aDrr(mont0ape mictls s2rl( o;(4 eenxrctatfa r uei;t0 2xmim3io1oltnmivsa(  rumu ooo0oexoii3iltlaDran o;(4aeenif3iatom rln i;(0seuo(r3ny4ap nliet tf 2um(rp;o1altnif3tat mDea(vp t)aeenxr oodoate u i;t)trtoimpny4amtemfvi s s2tru  ;o4tpen f3iasfm ra(vpnu)alxrmfctytfmDraiesls)tetr(r oydlpen fvsat) 2rm(  ;t4tle iociad s rlums t) rerir3oodfa rlnvo;s0tetm(m3oo4ole  nes () Duaxronu4aeenif3iydlsDrluvonu4artomo3ootfm   iesl(0truoxo3ny1om elfeiat)s2tr(mo;u1tetoioetad m uau o (4treomocia1faDrln sls  2ur(o no1ll  lfvi s sDtr(m ot0oetn ieiys a em( o u)tltrircio1lmD livi;s)trur(mpoo1omeelieiat srrr( pot4aetnmfciatlmDrauvo;t) lxrif oadlpDr ies;(  rum(mpio1llt lfetas sDtaumo;u0apxnmo3ilsfs2em( o;t4aexoio tytlptrlnvi;s s2uoxm3nu1amtemnct sfaDrmxmoot1aetomo3ildla2eluvpnt4aexrmr oytoat  iei t s2urim3iy1omtnlicta( aDurx  ou1tpeo oetydlmDrmnmpnu0tetnio iotopDelnvi;t)teumxr3oydap e fci sf rrrxrpot0opto ieiyslaDea(mo;u4 lenmo io1fmD  nvi t seur(opio4lpte ivsasf rtaxr ;u1olt  ieildls umn s (4 rtrmfcty1omD  ivsl(0 etr(m3iudlptnmivi sf rtmx oou1tet  feilslsDrmnmo u0trenmf3iatfmDr uei;( srxoim3iy1amtnmnetas) 2uaxmpnt1tltn o3iytlaDrm( s;u) ltnirctadlatran i;s0 2toimpnu4ll  mnesl(fsDumxr nu0altnifciydfm2emu o t0tetrmr3oy1op  ln s ( s2trxopoo4lpe  neilt srrru  ;u0oltomf3ild sDuln s (4artoxo3iodlm elnvolt) 2xrxm3ou4omeemivilsf 2uaxro;o4opxnmfeilslmDuluvo;u0artrxrcoy1latranes (0seuoxopno1lmtemicta(  Drax  oo1ape moeiadlsDrmn onu4alxoxocio1oatrai ilt)t2uoxm3nydoltemfcia() rrr(  ;o4tee  fctytlm2rlnmpn(0trxrmr tatlmDelivo s0t2xm(mpiodamt  fciat)sDrr(r ot0aet  ietaslaDrlnvsnu4tlerxoctodopDeln o t  2tr(mpiu1omeelfes (f 2tmum no0tex mfeiyd m ranvp;(0tlermr oo1faDe ieslt) rtm(o3io4opeemfvsa(f 2ua(  ou0alxomo3ilslm2eluvsn()texrirciadfa elnvol(0 euoxopoy1amtemieilt)arur(mooo4tex mfcilt aDelump;t4aexnmf iadlmtrlieolt) 2xrxo iydam e iesas)s2uax  oo4optnmi3iasfaDuanvo t) renxr3oadomtr iei (0setrimpnudll e nvt tfaDrrxmo;o0oleo feiatls2ea( o u) rerircta1lpt auei;(0t2tmiopno4am  mieiltf ruax o;o1texnmictatlaDumnvsnu4 exrir oodfa ran ol() etm(o3nodlltnmfes ( srum(m ot0tpeo oetls s eln p t)artomr3oodfatr nvils)teto(r3iydam e ncs tf rtmxro;t0teenmociadlm eau sn(0artoxf io1fm raivs;()trurxm3oy1llee neil(  2um(rpot0apxoiietatfsDean p;t0 ltrircoadfa rlu ol(0trxrxr ou1al   iviltf 2umxmpno4tlt  o3ias s ean s;t0texrmfcoatoa  an s;s0srurir3oo1alenmivi t s2rm(m ;t4altnmf3taslsDuan p () renmr ootoat ln s;s) rxoxrpio4lp  lnvtatf rrrum ;u0tpe  icias a uluvs u) rxrmr oadom e iei;s)trurxopiy1lpen fcs ()sDrrum ;o1open ociyslsDrmnvp;t4texoir3ootfm   u i;()trtm(r3nodale mncia()aDumumpnu1ole mieias sDulu on(4artnio3oa1lpt aivolt s2xmxm iydomtelnvil( sDtr( pot1oeen o3ilt s um(mpnu4 ltoio ootoat anvo (0tetoxr nudlpt  nctls  rra(  ou0optniociyd s2uan o u4tlxoio oadlptraivo;t)s2uoxr nu1ap  mfeslt)srumxront4tle ioeiytlm el(vs;u) etoxf oa1fmtean i;(0teuoir3iu4ope  fvsa( sDraxr ou4apxn f3tatlmDrlu pnt)aexoifcia1om rauvil( setrir3iu4olte fvtl()arrrx p;t4aexoiociaslsDemnvs u4tlermf3tatomte i o;t) etmim3oo1ame  netlt s2rax ono4tlto ociatfaDuan o t)trtoxoctytfmD aies;t  2xmim nodlmtelfeia()arta(  ot1alxnmociyt mDrm( sn()artoxoctadopDrlu i;s)seuo(o oo4omeelnes t)srur(mpou0oeeomociad sDumu p t0aeenioctatfaD an ilt  rurir3no4open ivsl(faDua(  ot1tee  iciytfaDranvo u0texrmrcoo1lm  livs t  2uoxm iy4apeelnctls)sDrau poo0opx mietls a emn p t)artrxr ootlmDrlivs s0s2xrxmpoodal  lfct (  Dtm(mp;o1olx ioeiys a uan o ()texrmr3iatoat  ivi;t0trxmio3oydlp nlivt t)srrr(mpot0olen i3tadfs2ulu p (4alenmr3oytoaDranei (0s2tmim nu1lm nmfvtls  Dtmu o;o1opxoioctysfmDulump (0altrmo3todfaDrliesl(0 rtoxo3nu4lmt livt sf 2umx  ou1apt moeiydfa2elnvpnu)altnio3ta1fmDelneo;t  eumxm no4omtnmicil( a2trxr ;u1oex  i3tydlm2el( onu4trermocoo1oaDr ies;t0 rxoxo3ny4al   fvias arrru o;o4aptoifeiat s ea(msnu0aeermo3ootlaD anvo t) 2umio oudlptelfvias)a2raxmo;o0tlxnmf3tldfsDrmnvs;t0 lerxo3oodomD liesl() rxrxmpnudllee nesat  rur(r ;t0tpeo f3ilsla2ulnvs;t4aexoircty1fatrluvo;t0s2umir ny1ap nmnvt (f 2rrxm ;u1ale mieiltfmDeluvpn(0tlxrio iatfmDr uvsls0 2tm(o3oodoleemiei t  Dtm(moot1opxn f3tyt a2eau onu4alermocoadlatr u olt) 2xo(opnu4omeemnvsls)srurx pno0aptn o3ilslaDeauvs;t4 exnmr3oytoa raieols0 rtm(m ou1ol emictas arrmx o;o1tlxnio3tadlm ulnmo t0treomo todfmDeai ils teurimpiodlptelnvt sf 2um( o;o1aee  f3tltlm ua(msnt4trtrmo oadoatelu ils0t2xoio3iu1am
\ No newline at end of file
@@ -0,0 +1 @@
+i i;( trum(mpoo1op nmfes t) Dtm(  nt1apenmiciytfa2rlums t0arxnxr iotlp  ai sl()s2xmxo oudlmeemfvt t  Durxront1aexomociyd a2rmnmo u0arxoxr iotoaDe n s;t0tetrio3oodop   ies t) Dta(mooo1tltomo3tat a2ran snt4aeeoxo3ta1lpDrln o t0 euoxo io4lpen ict ()arumurpou4ale moctldfm umumpnu4altoxf oydfmteli slt) rtoxm3ny1om nlivi s artaxm ;t1opx if3tytfa ul(vp;t)trtnxfcoytfpte ueols0 2xrxo3oy1am  lfes ( artr(  no4opt  i3tyt a rmuvpn(0 lxrif tydomteanvsls0setoxmpio1altnmfcsa(  2taurp;o1optoioctls a ranmo;u4artrxrcta1fp   i slt0 rxrxm nydopte ictlt aDtrxrooo4opxnmfciysfa2ulnmp;()aetrmfctadlmt li i s)s2uo(o iydapeemnviasfarumx pnu1apenmieildfm2rauvs (4trxoxociydfa eluvi s)s2um(opio1lp n fvia(f ruaurpnt0oet  iciysfa ra(vo;u4artnmf3totomD  ies t  exoxopiudlp emfvta()aDta(rpno0apeoiiciysfa um(vp;t4trxrif oydfm  liei t0 rxrxr nu1om  mfvslt)a2tr(monu4ape  o3tlsfa rm(mp (0 lxnmo iatlmDrlneo;s s2trirpio4ol e fvia() 2rm(m ;o1oeeo fctyd mDumu p;(0 leriocta1lmtrlivslt)s2trxo nydaltnlfetls srraump;o0tltnif3iatfaDelnvp u0aleomo3tatfmD  ueo s)sexr(r ny1lleelfvsat arrmu p;t4tee  f3tydls2eanvs () etnxr tytlpD an s;s) eumxo iy1ap n ncslt) Duaxro;u4texn oeildlm eaums u4 lxoiocoadop r uvsls) euoir iy4lm e fctlt  2uax p;o1aleoifcias aDrlnmo u)aetoio oydla  au ol( srto(r nu4omtnlncslt)sDtaxmpno0apx iieiltfm em(monu0 lermfcoydfpD  ivo (0 2um(r oy4lpe livi (f rtrxm no1apt iieild a ulnvp;t4altnmociotop   i o;s0trxoimpiydlmee ieil(  rrmxr ot1alxn feiyslmDrm(vp;u)aetnxrctatfmDe ivslt srxo(o oudomenlfeilsfa2urxroou0openifeiaslm2emn s;u0 ltomf io1omD li o s  etmxm3iodlpe  ietl()srraxmo;u0opeoioeiasla2emn o (0trtnirciytfatrlnvsls t2urxr nydopeelfeil(faDum(  ;t1tpxnmf3tld mDul(vp;t4alxnif ty1fate nvs t0 2xrimpoo4lpt  ietlt arurx  ;t4oleomoeiadfsDul(mp;()arxoxocta1optr nvolt  exrio ny4am emfctat) Duax pot0oetomoetatlm2eanvp;() rerif oatlat aueslt)setm(opiodaptnlfcs t) Dtaum nu4aee ifeildfa2ul( ont0 lerxf3todlm rlieo;t  2xoxrpny4ale  nvt t sDra(rp;t0aptoioetls m2ul(mpnu0artoxrcoydfpD lnei;t)trtm(o3oo1optelfvi s  Durxm ou0olxniiciytla el( onu)aexrmo ta1opDrau i s s2tmim oo1am  lfeiat a2urur nu0apen i3ild m emumo t4tlxomfcto1lp e ieo ( trur(rpno4lltn ics ()a2rmumpoo1aet  f3ilsfmDua(von(0 leomo3oytlm e ueolt)texrxopou4ole mieia(faDum( oou0tptnmo3iytlaDul( p;u4 exrxrcia1latean s ( s2trxm3nydolenlfcsa(fsrrmxroot0tlt  oetys s2ua(vp t4trxrxr ia1fat aieolt) rumxmpiu1oltnmfciat s2rrurpot0tle mf3tydfm umuvp u0tleomo3iytop r uesl()setoir io1ole liciat) rrmur ;o4tpxo oetyd a2rmu pn(0alxoxo todom rlu ol(0srumio ou4lm   nvslt s2rrxronu0tleoif3tlsfs umn snt4aleoxf iytfa elu s;t0t2um(r iu1lp  lfet sfs2trumoou0oeeomi3iltls emn s (4alxrir3oodfp eluvslt)texoio3io4ole lfvs (  rrr(m oo1aee mf3iadlaDeaumsn(0artrmo totfat lnvilt) 2xrxmpnydomen ivtlt)a2rmxr nt4aetniietldfm2um(vsn(4trtoxo oy1lmDr ieo;(0 rumxrpoodaptn nvsasf Duaxrooo4apx  ociltfsDulnmsnu4aeeoiocootoaDrlueolt)tetoxo3no1aleelicta() 2tr( o;o1oeeoifciad sDumu o u4texrmfctadlaDrluvs;t) rtoim nydaltemnei ( srtaur no1tet  fcils s2rluvs t)aetnxo oy1fp eau slt)t2urirpno1op emivi s s2rm(  nu4ape mfetltfs ean p (4 etrir ia1fm  livo ( t2umxmpnu1om elnvia() Dtau ooo1oex mi3iadfa2em( sn(0 rtrmociytlpt liei (0s2uo(m nu4oltnlfct t  Dtaxmoot0teeoii3iat m ea(vo u)arxniocootlpD  iei;t) 2ur(o iu1opee ivi t) 2rmu onu1tltomfeilsls rm(vs ()artrxf3tydoaDe i sls)s2trxo3oodol  lnctas artmumpou0aee  ociysfs2el( pnt)altoxr iy1opDe i i t) etoxo iodale mnvi t sDrax pot1aptoifetysfsDem(vp;t)alxoxf tatlm  liesls setoxr oy4omeemictat) 2rrx  ou4ole iiciad m2rauvs t4altrmociytfa e ies s seum(mpoo1am nmicias)a2tr(rp;t0oexn f3ilt m ulnmo t4 lenxf3ta1lpDeaieol()srtrir3nudam e ivilsf 2rmumoot4ape iociatla2elnvo t4alxrmr iatoaDe nvslt s2xrxm iudolt mietltfaDurxr nu4tlen ieilsla2rl(mon(4arxrxr3tadfmDe nei (0 2uoxm3oy1llenlfesasfs2trurpnu1oeeoio3tlsls rln o t4alxrmfcoa1oaD  n il( tetoxo3iy4olenlnvsl(  rrm(m ou0tpt ii3tys mDranvsnu4trtnif tytlatrau ol(0trur(opnudop  mncsa()srurxmpnu0teeo i3iytlm2emumonu)aleoir3tydla rlivslt)sexoio ny1ol e nvsasf rtru pot0tetnmf3iytla el( sn(4teermf io1fate nvo;( t2uoxopnodope mnes s  Drrx oot0aeen o3tysfsDul(vs (0tlerxf3iatlaD lnes s)t2toxrpnu4alte ivsa(  2tr(monu1oleoioctatlm2eanvp u)tetnxocootopDeanvs;() ruo(opou1ll   ivt s srrmx pnu0ole mfctydls rauvo;(4alxoxocoo1lm  au s s) 2uo(m3io1amt mfesl(  rurumoot0tlto o3ilsfaDemu p t4arenmrctotlmD  u i t0 rtmio nydll   ncil( srumu pnu1oltnmi3iasfs2umumo;()artniocootfaD  ies s0trtrxmpnu1lm nlnvtl()srur( pnt4teen fctyd s elums t) lxomfcoadfpDr ieo;s)trtoir3iy4lmt lfetat) 2rmur nu4tpeo icilsfm ua(mo;u0 rxomf3iotfm   uvo;t0texrio3iu4alenmnesa()aDuaur oo4oet  oeilt m ranmont4trxoxrcoodfa  auvil() 2xmio3oy1openmivta( sDuax onu4olxo fctydfa2el(von(4 lxrxf3iatfaDean o s0 ruoir no4lp emnvtat)s2umxmp;u0aleniocild a2ea(mo u) rerxo3ootlptr i slt  2xr(rpoydome  ncil() Dtau ont0tetnifctys m2ua(msnt)arxnmocoytomDeai ols setrxm3ou4opee ivsl(  Dumur ou4aetnmo3iasfs2rm(mpnt0aexnifcoydla eaies;t)srtm(o3iu4lltnlies (f rrmum oo1alxomf3tasla2rlnvp t0teerxr3todlm r nvol()trtoxm3iu1oltelnctlt s2tmxmono1aleo feiltfm umuvp;u0treoxrcoytlmD  i i;(0sexoir3ou4op nlfci tfsrumurooo0tpxoii3ilsla2emump;u)trxnmo oytlaDrlnes;s t2toxm nu1alt liesls) rrr(root1oex  fetltla2ul(mp u0tetrif3to1op rlneslt0 rxmxm ny4omte nvtatfsDra(mpou1aexn i3tadfm ul(mpnt0artnio3oatlaDr u s;t)s2xrxmpno4opt mnesas  rraxroou0oleomfeiat s2rlnmo;() lxrxrciatomte i i t0trxmimpiudapee fetasfsrrmu ono0tpxoioctytlaDuluvpn(4tleoxr3ty1fpt lies s)t2uo(opoodape lfvsas srrrum ot1ale  fctas aDelnvpnt0tetoir tatfaDe n il(0tetmir ny1oleelncsas) rumu oou4tltn ieilt a2rm( p ()aeeoir3oatlmDrau i;s)trxmxo3nudalt mfcs t)arur( p;u0optn f3iltfm emuvp;t)altomfctytoa rauvil( seuoimpio4om elietatfa2ta( p;u1alt mi3iaslm2umu pn()altnmf3iotoateaneo s0 2uoxm3iydamee iet t) rraxmp;u4tleomo3tyd s em(vo u)texoxo3tytfmDe uvi;(0 etr(o ny4op   ieils s2trx  no4aee mietadfaDrln o;(4trxomoctatopDeau o;t0s2tmim ou1llt mfciat)arraum ;o1tetnmociyt s ra( p;u)arerif oodla rlnvilt0setrxo iudole mfvia( s2tr(r ou1tpeomi3iydfaDrm(vp;t4trxnxf tatfptrlueo (0 2xrxrpiy4llt mnetl( srrrxr nu4ope mf3iasfm rm(mp;u4trtnirctodopD lieols)s2uoio oydome miet sfaDtm(mpnu0oexo iciyd m rau o;(0 rxrmfctadom elivsls s2uo(m io1op elneil(fs2trxmont1teeoio3iltls ua( on() rxnmr iydopDe ieo s0seur(o oydopee fei (farumumpoo4tpeoioetad s eaumonu)aeerxocoytfpte i i;t srxo(opoo4lpt lici s srra( p;t1oetn fcildfa2ul( p;t4 ltomfcio1oatraivol(0 rtmirpio1llenlfeil()s2ua(ro;t1tetomf3tlslmDea(vs;(4 rxrif3tatfm elu i t0 ruoir3nudomtemivsas  Drr(rp;o4alx mo3tldfaDum( ont0tleomo3iotlpD lieo s0 etm(m no1lm nmiciasfa2ua( oou1ale iietyt a rm(von(4artomo tytlmtelnvs ()trxr(o ou1om nlivsltfsrtaurpnt0optniictasfm ulump () eenmfctydoa e ueils s2urxm nydapeemivils  2tmum ;o4oex mo3tadls2ulump;(0 exoxo tatlpteanes t  rtrimpnodaltnmneiat sDtaxmont4tee mo3tatfaDuau o;()artoxo ta1lpDrauvo;s0 2tr(r3nu4alt mfcta(f 2tm( o;u4oexn fctytls raumpnu)alenxr3oa1la e uvi;(0t2xoxopio1al  lfvia(fsrtrur nt1alenmf3iyd s2el(vsnt0 ltrxr3todopte ieo t0 etrim3iy4apenlfei sf Duaumo;t1tpe mo3iytfm2umnvon()teenir3iadlat  uvs () exmio3iudllenlics t a2tru ont1tpxomoeiydfs uauvo u0 ltrif3iodlm elnvo;(  eto(o3io4lmee fvsls sDur(r ;o0opeoifeiydla em(vo;u) rtrmfcoadlm  anvol(  2tmio3iudolenmicils srurxr nt4apt ifetat s2ua(mon()alxnxocta1oaD ai s (0s2trim nu4lp e ietasf 2umur no4aet mo3iaslm eaumo t0aexnmfciotlmD  ues;t) exmxo oy4lpt  fvias) Dumu ont0ale  i3tytfm2raumo;t) etoir oo1fa  aivs;s0s2umio nu1lleemfes (  2rr(ronu4ole  o3ias s elu o;u)artnir oo1lmDrli i s)sruoio oy1lm nlieia(f Drmxmpno1oee mictlsfs2emuvpnu4trxoif3ootoatranvi s0 etoir iodalt mfeil(fs2rmx o;t4opx moeiydfa2ulumo;u0 lermf oadfpDelu i;t) rto(rpno1lptn neiltfs2uaxm ou1aeeo f3tysfm2elu snt0trenxo3io1lpDelieils0teur(m iudlle mnvtat)a2ta(mont1optoiietydla uau on()artrmrctotlptrlieolt trxo(m oodomtelfctat a2trx  oo1tleniociatls em( p;(4treoirctodlp  aivs s0trxm(m iodame lfctl(faDra(r ;o0tetomieiasfs2ulnvsn()arenxr iatopt au i;(  euoxm3ny4ol elictls  Draump;t0tetniietas mDumnvpn(0altrxo oadom  li ol(0t2toimpno4ol  livilt srrm(  oo1apen oeilsfsDelums;t4trenxf oadfp   nvi (  euoxr3nu1op nmnci s) 2raurpno0tee  oetltlm2umu s u4alerifciydfmt  uvo (0 exo(o nydlptnlfctls arrr(  ;o1oeen icilsls2emu s t4alxnmr oydfa rluvo t0t2xriopou1amen ivs t sDraxmooo0apt mi3tas aDelums;() rxrxo3oodfaD an s;t)t2toir3oo1ale lnetl(fs2ra( o;t4ape  iciat a2rm( p;t4 ltomfcto1omt li ilt0srtoio oodaptnlfeia(farrrumoot4aexn f3iad m uanvp;(0 lenxfcia1oaDeliesl(0trurxmpny4lp   fvslt)srumuro;t4alt mo3tldla uau s u)arxoir3oa1omtean i;s) eum(o oodal  miesa( aruaxrpot4opto feiyt a2emnvont)aexoxo tydom rlu o (0srtm(r iudolt  ivils)a2rr(rooo4tetomi3iysfs2ranms t4 rxoxf oadlm raueo t) ruo(r iy1op  lietas a2raurpou1tltnifctas mDrluvsnu4aleoxf oo1opD  i i;(0trum(rpiy1lmt mivtlt)sDtr(r nt1opx io3ils m emnvpnt4arermo3tadfmtr nvi t0trxoio3ou1amenmietls)aDrmxmpot4apxn f3iat a ra(vsn(4 lermf oydfmDran i;s  rxmxm3oodol emfci (f Dtau oou0tlx mf3iadfaDrm( onu4 ltrxo iytfmte ues;t)truoxr3no4lm nliciat)sDraxm nt0alt ioeiasls2um(vont) lerio3tatoaDe ieo t t2urxr nudamenlivsl( sDtaumpnt1ole io3iat sDeln ont0texnmr iodlmD lnvo s s2toirpno4aptnmfetls)sDrrxm nu0oetnio3iytfmDrm( p;u)tlenxf ta1oaD luvo;s trtr(m3nu4ale lnei s) rtaurp;t0alx mictatlsDua(mo t0tlxomfctydfp e u o (0seur(r ny1lpeelivil(  2tm(rpoo1apxoifcildfa2uau s () ltoiocoadfmDr uesls  2tmio ny1alee icia( sDraumont0tltn feiadlaDumu s (4alxrmo todfat  i i;()s2xmxmpiudlp   fei s) Dtr(moot4tlt  feiytlm ua( pnu0 rerxfcoatfmDraueols0 rtm(opny4lmtn ieta(fartrxm nt0alenif3tls a rl(mon(4teeoxocoo1fpDr neo;s0 etrim3no1lm  micilt aDua(m oo1tlxnio3tydfsDra(ms (4 rxrio oo1faDe u ols0 rtmxo ny1om nmfcs ()arua( p;o0alt  oeiydfs2ra(vs (4texoxfcoydlat  u s;() 2xo(mpou4llt mfvils srumur ot4aeenmieiltfmDra( p u4arxrmo3io1faDelnei ( t2tmxmpno4ap n feils  2ur(r nu4tlxomoeiatls uln s t)alxrxr3tatoat au i (  2umxrpoydamte fvtas)aDtaxmo;u4aee ioetatls2uanms;(4 etrio iodom rlnvs t0t2xoxo3nu1omte fvsa(  Dtr(rp;u0olto ietatfaDra( p ()tetrifcoadfp  lies;s tetoxm3ou4olee net t  Drmurooo0tlenmoetat mDrm(mo (4 exomfciytlmDranvo;t0s2umiopoydllen fcils)sDrr(mo;t1tle ifctls m ulu s;(4tlenmf oadomtelnvo;t  rtmxrpno4lpt mfetlt  Dur(mo;o1oltomf3iatfs rlnvs (4tleoifciytfpte ueil( sexrir3ou4lp nmfcs tf rrru  ;o1aeenmi3tad a2umumo u)artoxoctydfpt  ivilt) ruoxopoy4llteliesatfaDrm(m ;o1tex if3iltfm2em(vont4 etnxf iydla e ivsl(0 ruoio3iudlpen iei sfaDurxm ;u1tetoiicildla ranmpnu4aeeomo tadlat lueolt)t2xoxm3no4alen ietas)sDtmurpot4opto f3iytls ranmont4 ltrmocoo1op ran o s0sexmim3iydamtn fei t  Dum(rooo1altomfetas s uanvp (4tlerifcia1laD  ivo;t0t2uoir3ny4omt miciasfs2uaurp;o0apeo i3ias mDum(ms u4arxoxr iytom  aieo () 2xrimpoo4ap nlicsl(faDra(mo;t4aeen feiysfs2emump;t0 leoxo oytlp elnvi;t srxoxopnydlp n fviasfartaur ou1tleomiciad aDuauvont0 rerxr3tytlmD  uvs;s s2xoiopnu1omt mnctltfsDtrxm ou4apxnioetldls2uanvs;u4aexrmrciodlp r neslt s2urxm oy1ol eliviltfs2umxmonu0olxniiciadfaDumu pnu4 lxoxo iydop e ies;t srurxm oo1lltelnetas) 2rrump;o1tptnio3iatlmDeluvp;t)tltnir3iydfmD  nvi;s0t2umxr3ny4llenlicias)sDurxr oo0alx  fetlt m eaums (4 eerif3ta1faDeauvo;s s2xmir3nydoptnlicia(fs2tmxrpnt4tleo octat s2emu o t) ltrmr3ta1opDr n i (0srtoio3oydopeemfviat) 2rrurpnu4alx mictys m el( o t4 lxrir3iytfpD luvs s)s2toir no1alee fvtl(fsDurxmpnt4olenioeiytls el(vp;(4 lermocta1fmtranes;s  euo(mpny1omt lnes t  Drrump;t0ope  feilt s2eauvpn(4tltoio io1fp ran i;() exrio oy4apee ici t) rtax oou4tetnmo3tadfa rm(vo t) etoxo totop eluvsl(0 2umio3io4ol  mivilt) Dta(mpoo4tltomfciys sDea(vonu) rtrxfctadlmtr u ol() exrxr iu4ameelictlt) rrmxr ot4opx moetyd a2el(vpnt)arermf3tatomtrauesls0t2tmxmpiy1lm n nesl( sDtr(rpou1olenmi3tydfm emnmp;u4 rtrir3iy1opDeln s;(  etoim3oy4ape mictat srrrxr no1aexnio3iyd a2rauvs;t4tltnxf3oadfpD auei;s0 eurim3nudlmte fctas) rrmxronu0tetniieiysfaDrlnvs u0aexrxf3ia1fa  lu s;t) 2tr(mpiy4ale  fetlsfa2rmuro;o4teeoiiciysfsDrlumsn(4 rtnxociytla raueo t  2trxrpnu4om emiviat)sDrrxmo;u1tpxnmfcild s2elu o;u4 lxrxo oadlmt lnvolt  eurxrpnodllte fvs s aDrrx onu4texo o3tyt m2em(mo;u)trtnmr3oatopDeaivo;( texm(mpou1omenmnvtatfsDrr(m ot0openmfetlt aDelnmo (4altrmrcoodomt  ivslt)srtmxm3oodalte nvtltfa2tr(m ;u4oeeo i3iat sDrl(mp;(4 rerif3tadoate n ilt s2xr(o iydlm  lnvt t)a2rmurpot1tptomo3iadla emnvpn() renmr oadla  livs t) etm(rpiy4amenlivil(  2ra(m nt4olxn ieild s2rl(ms;u)treoxr3tatop   ues t  rtoxrpou1ol emivi s a2uau pnt1optniictyd a2rlnvo (0aetrmo iadlpt an i ()s2toxo io1op n iet tf Dua(mooo0tleomi3iatfm2em(vsnt0 lenirciatlat  u s;t  rtmimpoo4lp emfesl(f rrmu p;o4oex  o3iysls2uaumo t4tleniociodomt anvo s)trumxmpiu1lmtemictat) Durx onu1aex mo3iadla2ua(vp;(0altrxr3tydopt  n i;(0 2uo(o3iy1olenmfeia( s2umump;t0tpt moeiadfsDumnvo t0 lxoio ia1lmDrauei;( srur(o iydlme mnvsls) Dtax  ou4tpt moctys a2rauvpnt4aexnxf io1optran i s  euo(rpnydalee fvsat  2ta(monu4aeenioctytlmDuanms;()aetnircio1op r ieo;(0tetoim nu4ole mfcslt  rtmxro;t4alxo octyd a uanvs;t4tltnxf3oodfa r nvi;t0trtoiopoydapeemfcs (  rrrxm ;t1olt mo3iaslaDemn s (0 rtnxocoy1fpD lu i;( setmio3ny4olee fvtasfsrrrxroot1alenmi3iyd a2ra( sn()trtomo oytopDeaneils seuo(mpou4lpt  feils)srurumpno4altnmiciltfs2el(msnu0trtomf tadlpD  n i t0t2xr(opiodom  mnvilt aDtr(monu0aex  f3iytls2uanmp () exnioctatfa  livi;s0 2toimpiydlpeelfesatfarraumpoo1opxomo3tadlmDranvon(0altrmf3ty1fp e ieolt0 etrxr io4op  mncsas)s2urump;t0tpen octytlm umums ()artnxo3oytfm raneo;s0srxmxr3iy1lpe lnvi sf Durxroot4aetn iciydlsDrl(von(4teerifcoa1op  aivols trtrio3oy1lm e ieslsf rur( ont1aeeomocias s uan p;u0 rxoio3oo1oaDe ivo (0trxmio3io1optnlneta(fsDumur ot4altn i3ias a2emuvp;t4 ltrxr3oadfmDelueilt)srxmio iydam   fetl(f 2uaur ;u0ape ii3iatfs2rlnvs (4arerxo iodopDr u i () rtmxo3oydame lfetl( s2urur ou4aetnifcilt m2rln o u4tlxrif oadfaD au o;s srtrxmpou1am elnes s)aDta(mpot0tpe  i3ilsfm2ua(vsnt4tlxrir totlp  lueols seur(rpiu4oltnmnci s  rumurono1tpenifctlsfm2el(vp ()trxrio iotfaDrauvs;t)sruo(opoydomt mnvta()arumumpou0tlxoio3iaslmDumnvsn(0arermf iytomte ivs t0texmir3iy1al   fetas)s2tmumo;t0ope mf3iad aDemumo (0teeoif3oy1opt  iesls trxmim3oy1lltelict (fsrrr( oot0tex ii3iytla2rln o;u4trtrxrcoytlate ivsls  2tm(o oy4om emfcia() Drr( o;u1tex iiciydfs ra(mp;u4 rtrir tytfaD  neo;s teuoimpoy1oltnlfet s)s2ra(ro;o1apxnmfciyd sDuan p;u0areomocoy1lp  livi ( sexrim ou1llee iesatf rtmx p;t0apenmi3iasls elnvp;t0aexnif tydoa elueol(0 rtmxo ou1lmeelfctl()aDrmu  ot1tex micilslm ran s t4texrmr3to1faD au o;t0t2trio ou1ap emfctatfsDtmx ooo4tetn feiat aDul(vp (4arxrxfcoydfatelies;t) etrir3nodaleemneias) 2tmxront1oetn f3ilslm2uauvp () ltriocty1omtr n i ()t2xoxr3ou4omen fvtas) rumxroot1oetnii3tadls rmn pnu4teerir oatopDrlueol(0trxoxrpoudlpe  netl(  2ta(mp;o1aeeomiciytla2umnvs t4 rtrmfciy1laD lnvol(0t2tr(o oy1omte netat  Draump;u4apt ifctydls2emn o;t0 ltomrcio1oaD aivils srurxm3iu1ome miei sfsrumxr ;o0olx mo3ilt a2rmu p;t4aexrioctadoptr nvs;t) 2urxr ny4lpenlfet ()sDumx p;t4opxoiiciat s ea(ms;(4tlxnmf tytfpt  ivs t s2xo(o ny4llenmnetlt arra( pot1aet  f3tasfs2ul(ms;t4aexrxf tydlmt anvils)sruoim3oy1lmenmneta(f 2tmu ont4tlxnioeiatfs rln pnu4arermo tydfpD li ils)s2trirpio1om   fvsasf Drr( pou0aexo ietls m2elnms;u0aexrif3io1oaDrln olt) etoir nu1lpe  nes ( aDrmurp;u0teenmfciyt m uanmsnu) etniocootla rlieo;( setoimpnudlptn nesltfs2raxmpnt1oeeo i3tas a uauvs (0areomf3tydlp eauei;(0sexoxr nudol nlfcs (f rurxrp;u4tltn oetysfaDul( sn()aeeoxocoadlmDraivs t  2uriopoo1omtemneslt)arumxrp;o4tetoio3iaslaDelnvsnu0trxnio tytlpte n sl()trtrxmpoy1opeelict t)arum(m ou4aptn ictltlmDrl(mp;u0texnifctadla raieslt0 rtoxo3nudale  fvtas  2uaump;o0oltnmictyd m2ul( ont4texoirciatop  an s;(0truoxm3oydale lfvilt  2trurpot0tleomoeils s2rmumon() exnxf3tydop rlnvslt trtr(rpio1lptemfcs (faDra(  oo4alt  fcildfm ran o;t4areomocoodfptrauvi () 2urxo oudlleelfeias)srra(rooo0oltnifciatla2em(vp;t4 ltnmrcoo1fmD aueol(0teuoxr3iodop elnvilt) Dum(moou1aleoii3tltfa2ranvsnt)tlerxo ia1opt an ol() rtoio oo4altelncs t)aDtmx p;u1oeeomf3iltlmDra( p u)alxrmrctatfpt  u i;s setrimpnudal  lnetl(f rtaxm oo4tle ii3iltla em( pnu4tlxrmr tydfm   i il(0srtm(r3oo4lpenmietl( sDrmurp;t0olenio3tls aDeaumont) lerifctotfp  ai ols)seur(opny1ap elfvias srtru  no4aet iieiytlmDrmumpn(0arenio iytom  auvo;s) rxrio iy4opeelfei t a2ta( p;o0optomociydfs rmu p t)aeeoxrciytfaDean olt) exoxo3iu4lmenmfvtls)srrm(mpoo1texomocildfa ua(mo;t0teenxr iydlmDraueo s0 etrxrpnudap nmnci t  Dur(rpnu1opeomfeiyt a rmnvp t0altoxrctatoat lnvo ()srtm(o3nydlpe  ics t)aDurxmono4altn octyd s2el(monu)trxoir3iatomDelivs;t setoio io1op nlnei ()s2tr(mp;u4tpe mf3iat s rmu pn()arerxo3tatlp elivi (0srtoim3oudlm emietat)sDrrxroou0ole  o3ilsls2rau s u)tlxnio3iy1oat anesl(0t2tm(opio4omt mfcia(  rtr( p;u0ope mieiltfaDemnms t) rxoxf3iatlmDe ivo s0t2uoir oy4om   ivtl( sruax p;u1oet mo3tlsls2uluvs u4arermfciodomteaieo t teuoio3iu4lpte fvsatf Dururo;o4aptn i3tydla em( pnu)tetnio oy1lateai sl(  2trxm3oy4olt  net s a2taxrpno0tleniiciasfm ranmp;(0aeenmf3oy1lmt  iei t setrimpno1lleelncil()a2tmx pou1olt  oetyd sDemumsn(4aetoifcoytfp raivo;(0trxr(o oudaltn ics (fa2rmxro;o4altoiieiad a ra(mp t4tltrmo3ia1oaDrluvs;t trxoio oo4lm   nctat) 2tax  ;t1aee  f3tasla2ra(mo u4 reomo tytfp   uvs s trtmiopoodomeemicsat)sDrax ooo1apenifctydfa2ea( s;(4artoio tydlmD  uvi;t0t2tr(o3nydapt lfvtat)a2rax  ot1altomfcias sDumnvpnu4 ltomf oytom raivi s  eurim iodlptemict () ruru p;t0opxo ociasfs2eauvs;t0tleoifcty1om  anvi;(0 2xoim3iy1aptemiesl( sDurumoou0aexn oetyt m el(vs t0 renmo iodom raiei ()sruo(o oudap emiet t)artru ont1tpt ioeilsla2ul(mon()aetnif3ta1fa  lies;t texm(o ou1lm  livt () Dua(mo;t0tetnioeildfa2ran s t4aeeomo3oodfm  aneils)srum(r3io4om  micsls)a2urxronu0tee mfeiat s2ea( p u) etrmrciytoa eaieilt tetmirpnu4oltnmivi s)s2ta(mpnt0tpeomoetas a uaump;u)arxnif oo1om rliei s s2urim ou1ame  ivsas)s2rmuro;t1tex moetadfs2uaump u4altrmrcoytfm e nvs;( trxr(m3oodllee ncs t sDrrx p;u1apxo ociatls rmumo t) etoirciy1lpDe i i s trxmim3nu4oltelieta( aDum(  nt0tetoifeias aDum(vs;t)texnxo todfpt  nvslt0trtmim3no4lmeemnvs t  Dtru  nu4aexo ieiad s ea( s;u)alermf oa1om eauesl(0 rtmxo nudapt lieia(fsDtaxmono0oltoii3tad s2rmnmo;(4 eerir ty1lmDr ies;t s2tmirpno1ll  mncs t sDuau oou4alt io3tydfm2rluvon(0tlermf3oadlaD  u olt0 2xo(o3nu1lpe lneta()arrrumonu0tetoii3tatfa2umnvonu) lxrmf3iatomDrlnvi;t srur(r iu1lmt mfeias aDua(m ;t1olen i3iadfaDul(von(4alxnxocia1la  auvo;t s2umxr3ny1ol n nvtat)a2rau  nu0teenmo3iys a2el( pnu)trtomf tytlm ranvo s)tetr(o3nydlpte fvtlt  Dtaxrp;o1tetn oeils sDem(mpn()texrxfctatfaDraiei;t)s2xmxm oydopenmnvs s  2rm(r no4aee iociadls emums;t0 reoxfciatoptelnes;( setr(r ny4optelnetls arumur ou1tpxnmieiaslaDra(mp;(0teenxo todfmD  n o;t0teto(r iu1ll  mnvs s srrmxr ;t1opxnifciadfa ea( snu0tetnir3oy1laDrlues;( texrxm3nudolen fvi (fs2rm(  nu4tpxnmf3ild s2rmnvsn()aleomr3ta1faDrlneslt)t2uoxo ou4apte fvsltfsDta(  ;t1tpxnmi3tlsfm uan o ()areomo iydomteluesls t2toirpoy1lmeemnes t a2trxrpno0tlt mi3iadfs umnmsnu0aleomf3tydomDr u s;s  rxr(opoo1lm nmicsas srrau p;u1aeen oeiadlaDrmn ont) rxnmfciytom eauvo;(  2tmxr no4oltemiet t)a2trumpot4teeo octadfm rau s u4artrmr3iotlatranvsls) rxriopny4lmen ivsa(f ruaurp;u4aetn iciatfsDuanvp u4 lxrmr3oatfp  auvi t t2xr(r3ou1om n ncsls  2ra( ont1aptomietyt sDelnvont4 eenif3ia1lat  iesls) ruo(m3ny1alt  ncsa( arta(m ;t0tlxn octls s el(vpn(0arxnio3oy1fm r u s;t setmimpou1omenlnesltfsDuax  ;o0oltn ietys mDrm(ms (4 rtnxrcoo1om r nvi t0trtmim iydllenliei t) rta( ono4tpen ieiat a2raump;(4 rtnmo oa1oa elu o (0 rtmxopnu4ome mictltfaDrmu poo1olto oeils mDem(vo;()aexomrciatlatrau o (0 exoxm3nudomen fet t  rtr(m nt0alxo fetldla el( sn(0 rtrmo3oadfaDe i i;t0 rxrio nu4ap  mnvia(fsrtaxr nu4olx ifciadlm em(mpnu) rtnir ty1fp e ivs;s  exoxopiu1op  mivsat)aDtmx  ou0tlen f3iatlm2eaumo u0trtrir iytomDr nvi;(  rumxopio4lle mieils  2tm(ro;u0tlxoiociytfa2rmu pn()alxoirciodfm r i olt t2to(opoudole  nvi t  2tmumpoo4tptomf3ild a2rauvpn(0 eenir oytoat  n ols)teto(o3ny4ope livs t) 2ua(  no4optn feiysls2ua(mo;u0trxrxf3tytop ran i;( t2xmim oy1op  mnetls)s2rmurp;t0olx iieilt a2emuvs t0teeriocoy1lmt  neilt srtrimpnudame licsa(  rrrxr no0aeeo f3tatfm rmuvp (0aetrmo iodomtrliesl(0t2to(mpoy1ap  miesas) Dtru oou1olt iiciyt aDuanmon()tlxomr3ia1lat aivs;(0s2to(r3oodaltn fetlsf Dtau p;o4teen f3iadfaDuln snt0 reoif3iodoateauei t0t2umio iydlm   fcsls)s2rr(r ;u0alxnmfciaslm2elnmo;u0trxnxf3ty1lpt anvs;() eurim3io1amee nvsasf rrm(r ;o4tetoioeils a2elumo;t)tltrmf iy1la  luvilt)seurio nu1om  lnvia() ruau  ot4tle mfctldlsDua(vp (0 rxnxfciydlpteaivol( t2xm(rpno4ll nlivsas) 2umu  ot4olx miciaslaDrm( s u0 eeomr3ta1fpt  iei t) 2xrim3nu1ol   nvs (  Dtr(rpou4aee iieiltlaDrlnmpnu)arxrxrcootfa eli ils)t2xr(r3ou4am  mncils a2rm(mont1aptoioctydla eaumo;(0tlxriocoodopD auvi t0setrxrpou1oltelnci sf 2rr(mono0tpt mociydlaDrauvs;(0 rtoir3io1fat  uvo;t) eto(m3nydlmtnlnci s  Dtm(m nu4opx mictadfs2ua( s t0 eerir3ootlpD an ol(  rtr(r oudlm nlivtat)s2rax  ;o0oleo ieiytla2uanmp;u4treomo3to1oat  ivilt)s2xm(m3iudope  fvias) rtauronu4opt  f3iaslsDum(vs t4tlxomocoodopt aies ()srumxm nydap nmneia( s2rmumo;t4olxn iciysls rluvo ()alxrmr oodfp r ivo t)seuo(r io1lmeelnct s)srrm(ronu1alxomoeiad m elnvpnu)altnio3iadlpDeln il( sruo(mpoodal e nvtlt  Drrx  nu1tetn fciydlsDuluvpnt4 eenmrcty1fmtrlueo s0t2xm(opnudomtn fesa(  rurxmonu4tlt moctls sDel( snu0treomfcoy1omt  nvo;() etmxrpiy4apen neslt a2uru  nt0aex io3iltlmDuauvpnu) ltomr iatomtelnei s0 2xmir nydomtemncslsf 2ururoou0oex mieiltlmDua(vonu4artnir ta1fmt  neo t0trtoir3io1open fcsa( srur(mont4apeo ocilsfsDemnvonu0 reoiocoodopDraues;s0 rxrxr io4optn ieils)aDtmump;t4alxomieiys s el(msn(4aexnmo iytfptrlueo s0 exr(r nudamenlnctls  2ur(  no0alxnmociysfa2rlnmpnt)trenxo iatoate iei;s)t2trir oudaltemicsl() ruau o;o4aleniieias mDrlnvo;(4arxoxo3tatlmt li s t0 2xmimpno1amt mnvtls sDrm(m ot1aet micild s ranvo t)tltnir tydfat au ilt0t2trir3iy4lm emnci t s2rauroou4tet ifetldls2rl( o t0 rtnxfcoa1oaDeaieo s) exoio3iy1ap nmiet tfsDtax  ;t4tetnifeiasfaDumnvo t)tlxoif3iy1lmteaies;t)srxo(m3iydopt miesltfaDuau  oo1oeto f3iyt sDrl( on()trxrxo3oydom ran ilt  rxr(r3iudlmt lfeslt srumx o;o1alx mfcils a ra(mont4trxnif3totomDrau sls0trtmio3no1lmt mivt sf rraurpou0olt mfciltfmDrmums;(4 ltrir3iadoatranes s0truoimpnudoltn fvias) 2umxr ot1optnmfetytfmDrmump (4trtomfciydfa e ueils s2xriopio1olt mfvs (fsrumx pnu1opto icilsfmDumnvo;u)aexoir oatomD anvsl( s2tr(r3iy1ameemfcs ( aDtr(ront0tpeoioctytfm2ua( pnu)aetrmo oatlm rluvols trxo(r3nydap emivtlsf 2rrxroou1alxnmf3ilslmDemnvpnu0arxrxr3iodomDrln o;t  rur(o oodol  lncsa( sDrru  no0opeo feiys sDuau s;() ltoxf ootfp   uvols0t2tr(o3ou4apee iviasfarum(m ot1texn ietatfa2umnmo;u0altnmf oadom eanvo;s)seuriopny4ll e ics s)srtru  ;u4ope  oeiydfmDraumo (0tltoif3tadopteanvi;s srtmim3nodapee ncsas  Draurpoo1olxoiietls aDea( p;(4aexoir oy1lm e u i;t trum(o3ny4olenlfvs s arumxrpoo4tltnmfeilsfa2rauvont) rerxf3tytom raies t) rxmxr iy4aptelfvta(  Drrur nt0tet  oeiatfs ul(von(0 etrxr totlpt  nei t0 2um(m3io1lptn fviat)aruax pot4aet moetlslsDul(vsnt0 lenircoydoat lnvsls seurxmpoy4oltelfvsasfarrm(rooo0tpeoioctydfm elnvp;() rxnxr oadlmt au i;t  exoxo3iudlm emncs t)srra(rp;u4aleomi3iaslmDeauvsnu4arerxr3tadlateauvilt s2xrxo3io1alenmivt s) 2rruroou4tlx ii3iad a2elumon(4aexoircta1lmtrauvs;t0s2uoxo3oodlpte fesl()sDtmxm ou0ole if3iys a2elu p ()treoxf3tytfaDrai s;t)srxo(rpiu1lpenmivtas)s2rruro;t4apenmiciydlaDea( s;t0aeermf oa1lpt  uvo s0srxr(m3oy1apee neta(f 2ta( oot0opxomociadlm rl(mp u0texomr3oy1oa r nes s)srtm(o3iodope lfcilsfs2urx p;u0aleo i3iltfa2eanmo;t4 eeomf oy1op e ieols) 2tmxr iu1am elneilt) Drmxm no1apxomi3tyd aDum( o t0tleoif3iytlmDelues (0srtmxrpiy1ll   nviat)a2rrxrpou0tpxnmoeiatlaDulumo t0tlxomr tatopt lieo;t0texoxmpio1lm n ictat artmumo;o1opx ii3iatfs umumont4 ltoxr oadfa rluvs;s)s2xr(o iy4olt  ivslt  rtrxm ou0apx  i3tasla ea( pnu4 ltoxfctotlat  ues;s srxr(rpiu4apenlnvta()arua(mo;u0alxnifeildfs2rmu s u)arerxr3oytfpDeli o;t  2xrxr3io1lpe livsas  2ta(m nu4opx miciasls2ranvo t4 ltnmf todoptrauvils0teum(o3oo1ape  feiat)a2tax  ;o0alxnmfciat mDea( s;t4 lxrmo oy1om r nvolt s2urxrpny4ame  nvt (fs2ururpno1optnmoctldfs ean p;(0areomr3iotlm elnvo s)teumxrpoodam emnvsa(fs2rrxmono0oee mf3ilt sDeluvo;t0aexrmo3tydfmD luei t sexmir3oo4al elnvsas) 2ur(moot4aeto i3iat m2rm( s ()tltrxf to1lmD an i t  rxoir3ny1lme mfetlsf rta(m ou1tetomo3ias s2rau s t)aetrxoctydopD  nvsls)s2xrir3ou4olt  icsls)sDtm(mono1aexnmfeiatlmDeluvo;u0 etrir iatlmD  n o t0 rxr(opnu1llenmicias)aDtr(mpnt0tleomfeils mDrau p u4altoif3ia1lpt aieo;(0 ruoir3nudlmtnlnvi sfaDumx ont4altnmfeiys a rm(vpn(4treoir3oydom ranvilt0 exm(r3ny4lm   nvtl(f Drr(  ;o0oeeoioetlt s2elnvonu4alxoiociy1opDelueo (  2xr(m3iy1lp n ncs s arumum oo0aetnifctlsla rmnmp t0tltoif3oo1faD  ieo ()srurirpno1alt lfvsltf 2umx p;o1oee  i3tyd a2em(vo u0texoir3oy1la rln i;s0 exmxr nodll n fvi t s2umxmooo0teen iciatlm emnmp t0alxoio to1omD auesls)trtoxm oo1am e fviltf rtaxr oo1tptoii3tatls elumo;(4teeriocoy1fmDr u o;t0t2uoio nu1ap n nvs (  Dtax pot4alx micils m2emnmo t4teerioctadfpDr uvilt)s2uoir ny4ol n fetls)arrmuroou1tpe micils s2uluvs (0trtrmfcia1optr u o s)s2tmxm3iy4lp  mfvi sf 2uaxm nu4ale  o3tldlm rau s u0trtomf oadla elu slt0srtm(m oo1lpe liesl()arra(root0opeoifeildla2ul(vp;(0arxoxf oa1la elu ilt)teto(o no1lle mnci t srra( p;o1teenio3tas s2emnmsn()teerircia1opteaies;t)s2toxopoydamen neslt)arrru pou4aptniieiysfsDumu s;(4tlxrmo io1la  an o;(0t2xoxo3iodom   ictl(f rurxrpno0tpxn i3iadfm uanvo ()tltoir3oy
\ No newline at end of file
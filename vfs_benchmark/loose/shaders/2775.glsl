@@ -0,0 +1 @@
+ivo s0s2xo(o3ou4ll  mnctlt sDtm(rpoo4opeo f3ias a2eluvs u0tleoxf oo1fp rlu sls)trumio3nu1omtn icsls  rrru poo0olt iiciydfmDrm(ms;t4arenmfcoadom rauvolt  2to(m3ny4ale mivi (f 2rmxm no1tlxniietadfmDran p;u4arxomr3ta1fpte uvo;()sexoxopiudaptelictlsf rua( o;o4opxnioeiytfa umnmsnu4tetoifcty1oaDrauvi t0 2xrxr3nydamee ncias a2tmu ont1tlxomiciys m eanvo u0aexomrciadfpt lu ol(0texriopnudom e ics t)a2tru ono1alxo ictldlm eanmp;t0trtrmo3oatfpDr i o (  rxoir3nydolenmivsls)sDrmu poo1tlxnif3ils sDum(vo;(4 rtnir3ootlmtelies t sexo(rpio1lmte fet t aDta(rp;u4tex  ietatfsDemu o;u0artoiociydfp eln i (0sexo(mpoo4lm  lfei sfaDrr(m ;t1ole  o3tasfs2rmuvs u4areoxociadom rlu s (  2xrir3iu1ap nmfci ()arrr(mo;u1tpt ifeiysfm2umumo;u4artoxf3tatom  auvsl() rxoir3oodam e fetlsfsrtmuront0tpx ioeiatlm eln s;u4trtnxr3io1fp r neil( t2xo(m iudamt mfvs ( s2ra( oou1oetoioeilslsDeauvo;t)tetnxo3to1opDean o;s0s2umxr3ny1ll n fvs ()a2ua(mooo4aptnif3tadfs rln p ()artrio oytfm elieo;t  2xrio3ou4llt  nvsl()arur(  ;o1aleomoeiasla2uau pn() etnmr3ia1opDrlueslt seuoxm oydole mfctas) 2ur(  no1aptniociasfa em( o;t0aetrir todfpDeai s s teurxm iy1ameelnvta() Duaumo;t0opt moeiys a2rmu ont)aeenxocto1fpDeluvo;( tetr(o nydam nmivt tf rrr(r ;t1tpeoifeiytla2uauvs;()tltnir ootop rlivs;(0setrxmpoo4ol   fcslsfsDrmx p;t4alx  ociltls elu snu0teerxr oadom rlneo;()setoirpnu1am n fcta(fs2tmu  ;t1oet io3tasfa2uau p;t0 lxrxf ia1opteln sls0trxoio oy4am  mnesat sDrax  ;t0aexnmf3iys m2ran s (0aetnmr iatfpDean s;s  eurir oodalt mnvtlt  Dtrx p;o0aetn feiadlsDranmo;t4artoifcoydfmt  i sl(  eurxrpou4llte feta(f ruaxr ou1olxnmfetldlsDeau p;(4altoxoctotfmD  ueilt texmir3ny4ale mnes ( aDtaurpnu0tpt  f3tad s rlnvo;(4tetrircoo1fa raies ( trumxopoo1lmee ivsasfs2ra( pou4ale mociysfaDeluvo;u4alenioctodlpt livols0truoxm3ny4lm nlnei ()aDrmx poo1aexnif3tytfs2eanmo t) etrir3oydomtranvo t)trtoxopno4amt  ivtas s2trum ;u1olxnii3tat m2umuvp;t4tleomf oytlpt aivils  exoir ou4ol n nesa()a2rrx pno1aee mfciys mDuauvp;()altoxfciatlmDeli i;()s2xoxmpoodlp  lnvils  Dtr(roou1optomictasfaDea(mo u0 rxnmocoodlp e n o;()sruoirpnudop n fvsas s2tmx ooo0oeeomi3ilt m2umumonu0aetnxo3iatfmt  n o s)trtriopnodamenmncsls aDrm(rpno1tleoif3iytfmDuan sn(4altrmfcoytomDelnvo t t2urim3oydamtnlfctat aDtr( oou0ale ioeiytfa umn sn(0aleomfctytfpDrlivs;s0srum(opiy1apeelncsas arrm(ro;u0apxoifciydla el(vo u4aetnxo3iydlpDeaivs (0 2xmxo oy4lm  lfcsa(f Dur(r ot4aeen i3tlsfa rlnms;t4aetnmo iydlatelnes;t)sexmxr3ou4lltnlicsas  ruru o;t0ape iieiytfs elnvs (0aeerxr3oadomDe i i () rxrxm oy4lpt  ivi tfaDuau  no4aetnmf3tysla2raums u) etrifcio1om e uvs t t2tmimpnudlpeelnes () 2rm(mpno1oleo fcild aDemnmsnt4 lxnxfciotfmDelueo ( texo(rpnydome  fes tf Drax  ou4texniieildlsDrau o;t4 renxo3to1op  anes;t  euoxm3no4altelfei tf Duaxm no4tlt mfciysfmDel( s (0altnxrcoydoa   uvo;s) rurxmpnudal  lnciatfs2uru  ot4apxomo3iytfm2em(vsnt4 ltrmo3io1opt  ueils  rtoiopoodome lnvtlt aDrmxmpno0aee mfciasfaDranvo;u)alenio ootlat livs;(0 rxmir oodlltelfvi t) 2rruro;u0tptn oeils mDeanmpn()aexnio tydopDeai ol( t2uoxopiu4om nlfci sfs2rru oot0ole  octyd mDumnvo u)trxnmr3oy1fp rlu i s0 exoim oy4ll   ics t)arrrxm ;o0oet moctytlmDea( pnt0 etomf tytlaDrln sl(  eur(o3iudapenlnvsl(f 2urxmoot0oltnifeiydla umnmsnt0 rxoio3ootoa  ai s;( teuoiopno1om nmnct (f 2urx oot4tet moetldlmDumnvo t4teenifcia1lmDelivi ()seurimpoo1ame mnetasf rtmur no4alt  oeiasla2rlnms;t0 etnio ootoatelu i;s)t2xmirpoy1apen feilt)aDuaxr nt4oexn o3ilsfaDemu snt) reoio iotlp rai i ( srtr(o oo4omenmnei ()sDuru p;o0teenmietldfa ra( s u0tlxnifcto1omt aieil(  eumxopiy4olt  fcslt a2raurp;o4aee  feiatfsDumn ont)arenmo3iytlpDrlu i (  etm(o oodlpenmfct t) 2umx  nu1tpto i3iyt m2emn s u)aexnir iotopDelivo;t)s2xoimpoodome  netas) rrr(m ot1apxo oeiatlaDrlnvsnt) rerxr3ootfmteau s;( s2xrxo3nudop emncia()srrauro;u0opxn oeiaslsDel( on()tlenmrcootop  aieslt0 euoim3io4ap nlnct t aDurx o;t4aptomoeiys m2ua(mo;t0 exnmo3iytopDr ues;s0sexmxr3io1aptn ietasfarumxr oo4tptoiociaslm2rauvsn(0 eenmo iadla e uvolt)truo(o nudap elnci s a2raxmonu1tptoiiciasfm2rluvo;t4 ltomr3io1la  li slt) rurxo3oy1am elneia( artmum ou0oleoif3iltfa2raumo;()alxrxf oa1fm  ln o;t  rtm(opoy1optelnvt s aDuax o;u1optoiociatfa2umuvp u0tltnmf oatlmDeln s ()t2urir3oudlmt lfcs sf rrr(mono1alxnmoeiasfa emu o;t)trxomf iodlatrlivi;s) exm(r nodame licia(f Dum(r ;t0tetnmf3tatlm ea(vo;u4arerio oatlmD li i t teuo(opnodale  iviat)arrmx  ou4teeomi3iysfs umnms;t) rtrmr3oo1lmD lieils0srtmxr3ou4lpt mfci t)a2uaumpnu0tlen iciydfa2um(mo;u) eenxo todfat ai ils0t2uo(rpiy1ll e fvi tfartr( pnt4oetomoeildfa rm(msnu0alerxf iadlmt  ies;s0 rtrxrpoydom nmici s sDtr(mpnu1oeenmocils mDrmnvs t4 ltrmfcoydlat  ueol( setrxmpiu4ole mivtls)aDurx p;t4alt  ictasfa2rmuvs u) rxrxr iydlat auvi () ruoxrpiodaleelicils) rrrum ;t0ape mi3iad s rmu s;t0tlxomo3oy1omDrlnesls)sexmir3iy1opee ncsas) 2tm(m ;t0opx ioeildfs2rmn pn()arerxo oydla   i s s0tetr(r iodam  lneta(f Dtr(ronu4oexnio3ias sDumn s u)trxriociytom r i o s) 2xrxo3nu1apt  fesat srtmur nt1optnifciad m2rau s;u)aexnmrcoy1op rluvil(0t2uoxr ny1ope micsa(farrrum oo1olx moeiysfaDulump;u)aeenmociodfm  auei ()t2umxr ou1ameemnet (f Dtm( pno4oltn i3ilsfmDel(mp u)trerxociatlp e u i s0 exrxo iu1om  mfvsl( aDraumo;o1aleniictydls ran o (4artnmo3oatlaD ai ol(0trumim3iydam n ncsas) Dtmumpno0oex  o3iytfaDul(vpn(0arxnmo oa1fm   iei;t setoxo iu4ll  lieias  rumx o;o4aetnifctad sDea( ont0treoxrcoadfp   ueo;s0s2uo(opou1lmee fvsl(fartm( o;u4apenio3tls s2em(vo;u4 rerxo to1oat lueol( texmxmpno1ale livsas)artmx  no1tlto fciytfsDua( p u)trtnxf3iydfa r ueo (0sexmirpiodolen ncsls s2tmxm ;o0aeen fciltls rmums;u0tetoioctydlpt liei;()s2tr(mpiodolt lnvias aDtau poo0tlx  oeiltlmDeanmpn(0 rtrmf io1omD lnvsl()s2xr(rpio4lpt  ict t sDrr(mpoo4aexnmoctad mDrl(mpn() rxoio3oy1oa e uei t  exm(r3oodlpt lieslsfarrr(mpnu0apeoif3iatfm um( s u4 renmo3tytlat livo;s)srurxr iudapeemfesa(farurxmo;o1alen f3tlt mDelnvpn(0 rtnio ootfatr i o t) 2toirpoudap e nesasf Dururp;o0texn i3ils m emu ont)alenio oytlp ean i;s) rtmio3iudamt mict s)aDtmxmpnt0tpt  fetldls rl( ont0tlenmoctadlp   nvils0 rxo(o3ny1lm   nvsl( aDrau  ;o4teenmictyslsDra(vo u0aeenir oatlmteaueilt srtrir3ou1ame  nct () Dtmxr ot1oetnifcildls2ran p t4aetrifcoy1fate neil(  2uoiopoo1ap nlneia( aruau poo0oltnmoctas m2raumo ()alxoxr oo1omtranes;t)s2urio3ou1ol e fes () 2tmx  ot1tpxn ieiyt m uanvonu)arxnxo3ootoatrlneols0 2uoir3oy4oltnlfviatfa2taxroou1apxo f3iytlsDuau pn(0 eenmr oatfa e u i t)seuriopiu1lle mivi sfsrraump;u0aexn i3iatlm2el(msnu4aexoxo iotlp rln s s teurxr3iu1apt miesasfsrrru  ;u4texoifetls m um(vp;t) lenio3oadlmD  n ol() 2xr(mpiy4amenmicsa()a2truro;o4tpeoio3iysfm eaump t4trtnxfctatfa eli i (0 eto(r3nodomte fesas) 2raxmo;u0tetoifetytfs umums;t)altomrctytoat aivils0srum(opiydlme  ivtlt)srtrxro;t4apxn ictltlmDea( o;t)alerxr3oytlmDelu o t) rtm(o ou4lmen nvtl(f rrr(m oo0ape  o3iatfs2ra(vpnu0altnir iy1la   ieo ()setmxmpou1al nmfcs s) 2umum ;t1tltnmfciadla2rm( s;(0 exnif3to1fmDelivo;s  rxr(r iydopenlnctls aDtrxr nt0apxnioetltla ua(mp;t4 eenxoctydopte uesl()trtm(o3nu1olte netat s2rmx p;o0opxn f3ilt aDumnvp;(4 rtrmr iytoatrlnvo s t2xoiopoodlme mnetlt)srum(mooo0oetoioctat s rlump;u4trtnir totlate uvs s)t2xmirpiu1lm   ncsl() rrrxmpnu4opx ii3iytfa el(msn(0tlenxo3todlat aieo s s2tmxmpnudolte ivslt)sDrm(rp;u0oet mf3iysfa ean s;(0trxrmf3totfat ai ol(0trxoxr iu4lltelivta(fsrtr(mp;o1tlxo ietatlm rluvs ()arermr3iy1la raueslt)srtr(m3nydll n iviat srrr(ronu4olxo i3ils mDua( o t0artnir3oadomt lu s;( seuoirpoo4lm nmneias)sDrrx o;t0olxnii3iasla el(vs () lxnio oytlaDeln i;t)srto(r iy4lpe lnci (faDtmu oou1tpeo feiysfmDuanmp;u)teeriocio1fm eaues (0srxmio3ny1omtemnetasf 2rr( onu0tex iieiatfm2rluvp t0texomociodfpt ai ilt)t2xrio iudale lfcs ( s2uru  nt4tlxomfcildfmDuln snu4 rxoxoctytoateluvolt0 rxm(o3iy1opte ivsa( arurx oot1aexnifctyd m2um(vp;u4arenmociydlpt ln i;t)trxoxr3oo1amee ivs s)sDtm( onu0texoiiciyslmDrmu onu0 leomfciodlp e nvsls srtmir oydlm   nvias s2urxr oo4tle ii3iyd a2ulnvs u)aexrxfctydomtelneslt  2umxm iy1opt  ieia(f Dtrumpnt4teto iciadla eauvon(4tlxomr oydomDeln i (  exmxmpoo1lm nmnvil(  Drax  oo0aexnmo3iyt m2emnmo u) rtoxf3iodla   i s;t t2tm(m no4om elfci (f Dumu  ou4alxnioetlsfm2eau s t4alerif ta1fptraueslt0srurxmpiydopt mnvia( sDrrurpnu1oeen fetat s ua(mpn(4altrxo iy1fpDeau i s0srumxo3ou1apenmfeias sDrru ont1ape if3tysfmDuan s u0aeenmo3iy1lp r uvi ( sruoxo ny1alenlicils) rtmu  ou0apenmoetls a ua( pn(4trxnxo3iydfa e u i ( seuoxm3no1apenmncslt sDtaxm ot4tpeomfeiat m rlnvont0 rtrmfcootfmt  nesl()trtmxmpiu1olte nvslsfa2tmx o;t1alxnmfciadfa2eaums ()aetnxo ta1fa elivi s  rtmirpiu4al elnctl() rtax o;o4ape  iciysls elnms;(0trtnifctydfptraueils0srtr(m oodope mfcs t  Drmuront1olx  ieiatls uauvs (4artoio ta1fmte i i;s0setrio oo4ameelfctatf 2rm(r oo1opeomfciadlsDra( o;t4tetnmf iotfat ai i;s) etrio3no4ape  ivs tfarraxrpoo4altniieild m em(vs t)trxoif3iydfpDeln s;() 2uoxo ou4lp e fci s)a2ra( pou0tpx mi3iasfs2em( o u)aetrmfcoo1fmtrln o t) 2trxr iu4lp n fvsat)a2tr(r nu4oltn f3ildlsDrmnms;u)tlxoirctotoatr ivs (0sexmxr nydom emivta(fsrtmx pnt1alxoifctad m2elu pnu0aexrmo iydlmt lies ( trtmxr oodomeelfcils srrrxmoou4aex  feildfs em(vonu)trtomfctadlpt aieol(0texm(rpnydop nmivt s)a2tmxmoot0altomieiatlaDrlu o u4aexoxr3oy1fpteauvol() 2toxo io1olt  feta() Dumur ou1oleniieiat s2uau o u0 rxrxo tadfpt luvolt) etrir3io4olt lnctl()sDtrx ono0apx io3tld a umn o u0aetnxf3oydoaD lnvo;t0tetrio iu1ol e iviat  Duax oou0tpeomfctldla2um( on()aleoif iytopteau ilt  ruoio oudlltelnvia()sDtmx poo1alt moctyt m eluvp;u0aetoir tatfmD  i o;s0 exrimpnudalt  nesltfarua(m ;u0oex iictlslm2rau pnu4aetriocoydom rai s t)seur(o iudoptn ici sf rumum ot0oee  fetas m um(mpnu0trtnxf3iydfmD  uvi t)sexr(mpny4lltemncil( s2ta(mp;o0ole ii3iltla2emu p;() lerioctodfaD ln s t0srto(m3nudolenmfvslt aDrrxroot0aexnmicilt mDrauvo;(0altrxf to1omD  nvo;s sruo(m oy1olen ivsatfs2urx onu0opxo iciyt aDra(mo u0aexrxr3tytlmDrai ols0 rtm(rpiu4olte ncs ( artrx o;u1tee iietlslm umnvon() exrir3iydlmDe n sl( srxr(mpoudolt  nvs ( s2tr( oot0altnmiciytfaDua(msnt4 leoxrcoydlp e u ol()s2tmxopoo1op nlncsat)srtax pno4openmo3tydla eaumo t0aeeoifciatoaDrlivslt0 eurxopny1ol  lneslt a2ra(rono0oexn o3iyd m2ulnmo (0arxomr3iatfate uvs;t)t2xoxr ou4om nmfcia() 2urumo;o0tlt iieiatls uaump;()altomrciytlaDe nes;s0sexrim3nu1lmt  ictls  2uaurp;o0texnmoetasfm rmuvs;t4trenxr oatlaDelu o t  eumir3nu1op nlfvtasf 2rm(r oo0oetomfctlsls2ul(mpnu)tetrir3oytoptrlu i;s)srxoio3ny4ale licsl( arrrumpoo0alt mfciadlmDrl(vp ()artnxf iotlm e nes t trxmxm nodamtnlfviat) Duax  ;o0olxnmoeiytlaDelu pnt) rxnxf3totfatraivo s t2xoio oudomte ietat) rurum ot0aetoii3ildlm um(ms u4 rtoxf tatlpteanvo;t0t2uoxo io1op  mfvs sfsDurxmpno1aeeniocilsfmDea(mp t4tetnmf3tadfp ean sls0 exo(rpiy4om nlnet ( a2uaumooo0oex ioeiyslsDumu p;u0texrmr oo1omDelneo;(0s2urxo3io1ole  neias arua( onu4opeo i3ildfmDelu o t0aetrxrcoatom eln s ( sexr(opnodoltnlfcil( aDur(mp;o0teenmi3iat sDrmnvs;t)tlerio3iydla   ivols)t2xo(mpoo1ap  mnetas)aDua( ono4tlt  iciltla2raump;(0aetrif3tydfmD  uvols) 2urir ny1lpe  fviat sDraxrpno0alt miciytfaDrmump;(4tlenmr3ia1oaDrln i s0t2xmxopiudlltnliciatf 2ta(m ou1oexnii3iytls rmnmo;t4trxoiocootlat lu o t teto(m3io1ope mfvsas  rtr(  ou1tleomfetyd a ranvon() lxoxo3oadoatelieilt0srxmxr iy4lleemivi t srua(moot0altniieiytlmDuanvo (0trtoxfctydoptr ies s)srxoir3ny1om nmivt ()sDumumpnt0olen feiatfsDeanvp u)tetnxf iydfmtrlues;s0sruo(r3iodalee ict tfaDur(rp;u4texoiocild a rm( on() ltoir3to1lp e nvs;s  rum(opoydomtemfctlt sDumxm ;o1tpeomoeiasfm rl(vs t0texnxo3oodom   i o;s)sexrxr oudalee ietl( sDtaurono1tlto o3ildfmDemumont) ltrmf3tydoat an i s trxmio3oydlmtnmnvsl()aDuax onu4ape ioeiyt m eluvp (0 eenir oadfa rluei (  2urir3iu1altemietls) rra(mooo1oeeomfetys mDemuvs u4areoxocta1omD auesl(0seuoxm3iu1op nmfeil()aDrm(rpnu4altoiocilt m raumont4 rxoif3tadoaDr ues;s trtoxr ou4lpenlncslt arrmx p;o0o
\ No newline at end of file
@@ -0,0 +1 @@
+n i t texmxrpoo4ame  fci s s2urxmooo0tleniieiad m umn s;u)trerxocty1faD aivols)teuoxo ou1om nmncs sfs2rmu p;t4olxnmf3ild aDrmumo t4aeeoxrctatlaDr neols0 2trir3iodoleemneiatf Dtaur no4oexnio3ildfmDea(msn()artrxo iotfatrliesl()trur(mpno1optnmfvsa( aDur(r no1texn fctld a2emuvs t0 ltrmo ootomD anes t  rxmio iu4lmtemnei ()aDtmxr ;o0texnmi3tat aDran snu)trxoircoatomD luvi s) rxm(m nu4omtelnvsat  2rrumo;o1tlenifcild s uanvo;(4aeenmf3ta1lmte i sls0trxoxrpiu4lleelfesat)aDtru  ou1apxoio3tltlmDumnvs u)trtrir3oydlmtrlueilt)srtm(rpiudaptn ict sf 2uaump;u4apx  ocias a ul(vp;u4 lxrircootoat ln i;() rtoim3oudoptelfeilsfarrau p;o4teto oeiadlmDuluvs t0altomfcoatoa r ieil( teuo(mpiu4lltemicsat) 2rr(mp;t0alt ii3tat mDum(mp t0 rxoxocta1la rau i s) rto(mpnu1llt miciat) Duaxrono1texnioetys sDrmuvsnt0aexrmf tadopt  ivslt0srurio3ou4amtnmneil()s2rmxroot4oeeniociydlmDemn snt4alenxf ootfp eliei t)tetr(m iodap   ieilt s2um( onu1alxnmfctltlm2um(mon(4trenxo3iydom r nvsls)srtr(m3nu4al elnesa(f 2umurpno0oetnio3iadls2emuvsnt4teermo3tadomteln s;t srxoim nodop  mict ()s2um(rooo4aexn o3tls a2umnvp t)tlxnif totom   uei;s0srtrimpoo4lpt liei t)s2tm(ront0aetn fcildla rl(mo t0texrio tydlpD aies;( sexrio3ou4lmte fvt ( artm( p;t1opx iociyd a el( o;u0aexoifcio1oa eau s s)srxrxopnu4lptnmivsl() Draur oo1tpt  feiydlm umnmsnu4 etnxf3todlpDranei (0sexr(r oy4op   fcias)a2uru ont0opxnmfctatfs2eaumont0tlxnxr3iodlp eluei t)seurxr3oudlp emivsat  2rrur nu0oexomi3tasfs rmnmo t)tlxnmo oa1laDeai o;s0 rumxm iydll  liviltf rra(r nu1aee mi3ilsls2rmnms;()artrmo3oy1faDean sl(0srum(mpno1opt  icsltfs2uaxmp;t1tpt mociytfm2elnvpnt4artrir iytlatelies;t)trxmir iy4lp elfesa(fartr(mo;t1tpx mfetltfs2uanvon()trtnmfcoytla e n s s0trtoxo3io4ap emnet sfsDuaump;t0teto i3iaslsDra( s t0tltrmo tadoatelnes t seto(rpoo1lptnlnetasfarrru  no1olenio3tytfs emnvs;u4 rtriocoo1fmDrau i;t  2toimpoo4lpe lfvtas sDta(rpou4tptoii3iatfs rlums t0altomf3ty1fm   n il(  2tm(r3oy4am  mnvtlt) Dtaxm nt4tlx  f3tydfs ua( s u0artnir oadfa eauvo;t0trxo(r3iydlleeliesl(f Drr(  nu1oexomieiadlmDumumo;u4 eerir tatlpD aueil(  2ur(r nydaltnlfci s)artmxm ;o0opx ioeils aDulnvpnu0trxrxoctatop rlieo;t0 rurirpiudapen iesat sDta(ront0aexoifciatfaDulumpn(0 rxoxr3oodfpDe n o t0srxrxopoo4am   fvia( a2taxmpoo0altoifeilt m rmump;u4 eenmo3oatfmDraneo;t  etoxr oy1lm emnci sf 2rmx  nt1ope  oeiatfa eauvp;()areoif3ta1fmtrlivils)sruo(m3no4am emiesls  Dra(root4opeo iciatls ulnvo (4altoifcty1fatrauvsl() euoio3ou1ap n ieilsfs2umxr ou0aeenmocilsla2umn snt4arenmrcoa1fp eli ol(0 2toxmpoy4aptnmnesls)aDtau  ;u0aptn o3iyt s2el(vsnu)tlenmf3io1op  auvo s0 rxr(m iydoptn ivslt a2tauronu4tee  octltlsDum(vpnu4tltrmo3iy1omDr u s s) 2toxo io4am e fvtas)artmxro;o1opxo feiasla um(vo t4 eerir3iadfa  aieolt) 2trxrpoo1oltn ncs t)aDum(mo;o0olx if3taslm2uauvsnt)aexomo3ia1omD lies t0srxo(rpoydomt  ncta( artr(r ou4aet micilsla2emn o;(4aetomrctatlpD  neol()srtmxo3no1lpen icilt aDtr(mono1oltniocilsfsDean s u0trxrir3tatopt liei () 2uo(m nodlpeelnvi ()aDua(mp;o0teeniietytlm rmn s (0alenxo ta1latean i s0t2xrxo3iu4om  mfct t) 2ur( oot0tlxnmi3iys mDua( s ()trxomo oadfm  lieo s0 rxmxr3io4lpen netltf Durxm no1oex  feilslm2ulnvsnu4areomf3oy1la  li i s0 rtrxm3oy1aleelietltfs2rru pnu0texo fetatla eaums;t)tleoio oatoa  anesls)s2triopio4aptemict t  Durump;t1oeeoif3ils sDem( o ()aetnif iodlpt li slt)s2toxm3oo4lpenlnesatfsDtr(mpnu0oexo i3tlsfa el(mo u4 etnxr3oy1lat ln o;() 2uoxr io4ap   neiltfsDuauroot1aeeoiiciyslsDua(vsnu)treoir3iotfpt  nvo t)s2toxo3iydlmtelnvt (  Dtaxmp;u1oexoioctlt a2rm( snu) etrxf3oo1lmDe ivs (0setoxo3iu4ale mictlt sDtr(mp;u1teto octldfsDuauvp;u4areoifctodfmtelnvi;t)teuoimpiy1am nlieil(f 2urxmpnt4opx iieiyt s umnmp;() leoir3tytopDe i i;s0t2xoxrpou4lp nlfesas  Dra(r nt0apeo iciysla umums (4alxomf3iatlptrlnvils s2uo(o ny1lpe lnei s sDrmxmpot1olenmi3ilsfaDea(vsnt0 ltoircto1fatran i;s t2xmio io1lptnmfctat)sDtmx poo1tpxo f3iyt a eauvonu0teenmrcia1fpD aivs;( sexo(rpno4ome lnviatfsrua( onu0ape  o3iltfa eaums;u)trxrir iodoatelues (0t2uoxmpny4lmt  iei sf 2rax  no0alx mi3tytls ulnmp (0 exoxf3oydomD ai s;s0t2tmir ou4apt mnctlt a2uru onu0aleomfeiltfs ranms;t0texnxr3tatlmDelu i;s  etmir iy1amt  nci s) Duau ono4ope mfetas a2ulnvo;(0trtrxf tadlm e neols) rtr(r ny4opee nct sfa2uru p;o0tpxn f3tyd m rmu p;t0 reoxf3oatoa  lneo (0 2tm(m io4ll e fei t)sDrmxrp;u4ale ifctydlsDua( p ()alenmfcoa1fp eaivo;t s2to(mpnydop n fesa()a2tax oot4opx ioeiysfm ranvpn()trtnio tydlmtr nvsls0s2tmxm3iodom emfvs t aDrmxront0alxomocilsfaDumnmpnt4aetoifctotopDr nvs ()t2xmir3ou4op  lnetlt) 2uru poo4apt io3ildfsDelnvs;()altrmf3ia1lmt ln ilt) 2uoxr iodop e nciltfaDrr(m no1tle iociatfaDea(mp;t4texrxfcoatlp  aues ()s2xmir3nu4alte ivtatfa2um(mo;o4tpe mfctls s2ran pnu0altnmo oa1lat ln i ( sexoxm nu1altn feia( a2tax pot4tlenif3iysla eaump (0artnir3iodlmDeanvslt srxrxo3nu4olte ietltf 2uau  nu4tpt  oeiytls2rlnvo;(4 lxnifctatlm eln ol( trxo(rpou1ome  nvsl(f rtm(mont1tpx iieiydlm rl( o;() rxoxr ty1opte nesls)seuoio3iu4alt mfvs (  rrmump;t1aetnii3iytfmDumums (4 exoxf3todfp raueo;t0setrxo oudom n ncsl() Drax  ;t4tlenmoeiatfmDeauvp;u) lxrxrcoodlp  li il( srtoxm iodomenmfvs s) 2umu ooo4openifcils sDum( snt0artrxr oy1lmDrai i (  2urxm ou4ap n fvt s) rur( p;u4apen fciys mDum(vs;t4 leomo3iy1fp ean i s)srxrio3io1lmt  ivs s)arraum ;o0tetoio3iadfs2eanvsn(0aetoio3oodfaDelnei;t sexo(r3oy1ape lnesasf Dtau  no4oexnmoeiltlm2uln o u) rxrxo3iy1om rai ilt0 exoio3iodolt lfviatf rurxmono4aex  ictad sDuluvo (0altoifcty1fatelieo;s tetriopnu1lmtnlfvsl(f Dumxrooo1oleo fcias a rmu o;()tlxnirciytlpt lieols srumir iy1lp  mnetas)a2taum nt1oleomoetld aDulnvp;t4tetrmrciadom eaues t  2to(m3oodllt lnvtat  Dra(r ou4alt ioctysfs rmumpn(0texnir tytla eauvs t sexm(o iu4apee fctls)aDra(  ;o4tlen f3tyt mDrluvp;u) eeoio3tadlmDrlu ols)seto(opou1ope mictlt)aruau o;u0oet  o3ilsfsDrmuvsnu) renio3oadlat  nei (0truoirpoodop  lncsa(f Drmumont4olxoifciasla rluvs;u)teerxo oadoateanvilt) euoimpoydal  mfvi s) 2ta(ro;o0opt ioetytfmDrlumon(4arxrmo3iy1faD livsls0trxoxopny1om  mncias aDtrx o;t4tpx  ieiydlm rmn o;u) eenxr iydlpDeli ilt s2toir ou4om  mncsl(fs2ur( poo1tpxnifeiad s um(vp;(0 etnxociodla eauei s)texm(mpoodll nlfci ( a2ua(ro;t4tee io3tydfm2rmums (4areoiocio1lmtean o;t0truoxr no1al n ivtl() Dtmuroot4tlt  ocias m2ra(mp u4tltnxociydfaD anvs s seum(r3iy4lmtnmici ( sDurumo;u4aeeniietlsfsDrl( p;(4trxoxfcty1opt luei s0s2xmirpiudomeemnvtas)a2rm(mp;o0aleomo3iys a2uln p;t)texnxr3iotlat auvo;s) exoir3no1aleemfct t sDtmur ;u0tle  i3ilsfm emuvpn(0 rerio ootlmtrluvs ( s2xrxr3nudolee icsl(faDta(mooo4tlxnif3iytlm rl(mont0 exrmfctadomt ln s;(  2xoxopoodamtelfvs ( arrmurpnu4oetnio3iysfs em(vs ()trxnxf3iy1lp eauvil(0 exoim io4lp   fciat  Drrurpnt1oet  icildfm rmn p;u)alxrxociydfptelivi;(0teumio3iu4ap nlnvtl(fa2taxm no4olxo ictad aDemuvp t0 exnxr3tadla elu ol(0seumiopoy4lptn nvtl()sDrau  nt4oetniieiasls ua(vpnu0aetnmr3oydoa  anei;s0 etmxrpou4lm nlfvil()sDrmurp;o0oex mieild s2ul(mpnu)texnio oy1fpDeluvsl()sexr(r3nudoptn ictl() Drmu  ot0tetnmo3tyslmDrmums t0 ltoirctytopte i i s texr(o3oudlpte neta()aDuaum ou0apxn oeiatlm elumpn(0trxomocty1fm rlies t)srur(opno4al  lietatf Dtmxro;t0apx if3tydla emumo u0 eerio3oa1fp rai olt) rtrim nydamt mfviasfsrua(  ou1teenioeiydfaDel(mo;t)teeomrcootlm rauvi;t  eumim3nydam n fesas)aruau  ;t0tlt if3tytfm2eauvs u0trxoir3tydoaDr n o t)seurxmpiydlpenmnvt t)sDra(mo;u4ope mo3iydfmDeaums;(4altrmf iadlateli ols srto(mpou1open ncias)sDum(moou0tetomocilsfmDrm(vs u) rtnxo3oa1lm r nvi s) 2uo(r3iu1lmee ivil( srurum oo4aetomieiydfm2elu onu4 rxnif oy1fp  lneolt)t2umxo3nydlmte fctl( arrru p;t1tet ii3tad m2rlumonu4aleomf3oydfa eli slt t2xr(o3ou4amtnmietatfaDtr(mp;u4texnmocildfa2el(ms t)artoif3todom  aneo;t0truoio3oydap emicil(fa2umxmoot1altoioeilt s2rmnms u0tlxrxo oa1op r u sls)teurim ny1alee ivt t)a2urumooo1tlto fctldlsDuauvp;u)alerxo3oytlpDr neo s0seur(rpiu1lpenlnvta(fsDra(m oo0aetomf3iatls2rlu o (4alxomo3tadlateliei;s0srxr(opoydlpe mfvt s) rtru  nu0tleo f3tys m rl(von(0altoxr oo1lpDe uvsls) 2trirpiudopeelfesltf rtr(  ;o4ale mo3tasfa ra(mo t) rxnxf oatlmD  ues;s  rtr(m iydomtnmfcta()artr(r ;o1aeenmictasfm2rmn s u4tltnxr oydlpDe uesl() 2toxopiu1lp elnvi t  Draxr ot0apxn fciat a uln s t) eenxrciydomteluvi;t)setr(o3nydap nlncil()sDtrx pnu0oetomoeiyt sDrl(vp u4 rtoxf3totfaDr ivs () rxmirpiy4ape mfvsatfsrua(root1ope miciltla2rmnmpnu0tetrir oydoa   iei;t) 2uoimpiu4al  mivsas)a2umur nu1oexn iciadls rmnms u0tltoxo oa1omDr n ilt)tetoxr3iy4oltnlivslt)aDtrxr oo4aexo feilslm2rau pnu4 eeomf3oa1latraueols) etmir3nodlmeelfci s aruaxm ;t4alx  i3ilsfmDem(von(4aetoircoy1fm  lnvs;s0seuoio3io4lptemfetl()aDrau o;o1apxo f3iydfa eanvs;u0 rtomfcoodfm  lneo () rtrxo3iydoleemfct t)srua(rp;t1tpenii3iasls2rmumont0 lxomo3ty1fmt auesl() rtr(m oodlle miesls  rta(moou0tex miciatfm2rluvo;u0alerxfcto1fptrlu ol(0trumxrpiu1aptemfcias  2tmu  oo0opxo feilsls2ul( snu)trenir totoatrlnesls0s2tr(o oodll nliesl(fs2tmxmpoo4apxo oeiysfm uluvpn(4tlerxrciadlaDeau o t) ruoim oy4lm  lfvtat  2tax  ;u4tet  fcilsfmDra(vont4 exrxrciydoaD  n s t) 2umirpoy4llt  fvtlt  rurumoot4aeenmfciasfa2ra(mp ()alerifctotlp   n o ( s2xmxo ny4optn fvtl(f 2ua(m nu4oetn fctat s2uanms (4aexnir3ty1lm e i o ( texmio nu1lm  mncilsf 2rax onu0alxnifctadls ua( p ()aeermociy1lat li olt s2uriopoy1lpeelnesls arraxmont1oeenmfetytls2ul(vsnt0altrif3tytfaDrai i;t0srurxr3nudlpt lfvi () Drrxrp;o4tex iieiadla el(vo t4 ltoxo totomte n olt0texmio3nudamt livsa(farta(mp;o1apeomfciytfs emnvp;()aexrxo totfaDeanvsl()t2xmxrpoo1lmenmivia(  2rr( p;t0alxomiciys s2umnmo (0tltrxo3oadfatr n ils  etrxm io4ap   nci tfsDraurpoo0oetoii3iadlm umumpnt0tetrio3iadla   nei;( seuoxopnu1amtnmfes t)sDtmu pno4alt iictadla ulnmp u4 etomfciodlp elnvo t  2xr(o3ou1lmtnmnvtatfs2raxro;o4tlt iicilsfmDuluvp;u0tltnio iotfmt lnvslt0s2toiopnydlptnlncsat sDurxr ou4opx  ictatlsDum( o t4aexnif iodfptelu ils  exrxo3iydlp  lneil( s2ua(ront1apenmoetydfs uanvp u0trenio todlmtraivo t  rtmxo3iu1ale micias a2tmu oou0tpx miciatfm ra(mp;t)tltnxr3todfm  lu s s sruoimpnu4ape lfes ( s2tmu  ;o1oetoio3iatls2ua(vsnt)tlxoircootfm rlneo t0 eurim iodaptelieia()a2uaumpno4tlen f3iyd sDelnmsnt4alenxrcoytopteaneols sexmio3ou4altelfesl( sDrr( p;o0apxnmo3iytlmDrmn o;(4artnxo3tatop  luei;s0 2umimpno4ap emneta(  Draxm ot1tetn o3iltlm2eluvo;u0teerifciy1fa raneo t0sexmxo3nu1lme mfviat) rraur ;u1tle if3iys mDuan p (4altrmf3oytomDrlies ( trtoxo3oudlpt lics (fs2uaxmono0aexn oetltls ranmo u)teeoxr3oy1op  aueilt) exrim iodope mnvi (f 2rm(  no1texomo3ildfmDul(msnt4arenmr3oodlat lu o;( s2urir iu4opeemnciltfs2rru pnu0aptnmf3ilsfm2ean o;(0 rerxfcoadfp  livs t texmir3nudlptn ieiatfsrrrxm ;u4apxoio3iydfaDrlu p t)artnmoctytfm eaneolt0 rur(o nu4lltnmfcs s arta(moot4aptnioeiasfa rlums;u4tlxoio ty1lpte uvs;s0s2xmxo3nudapee icsltfaDuax  ot1oee mfciatla2um( p u0tlenmf3oa1fmD  n ilt)seum(r ny4amt lfvia( s2urur ;t1oet mi3iytfm2ul(vonu4aexrir ootlaDelies;(0seurxo nu1olt  nvs t) Dtru p;u4tpxoii3tyslm emumpn(0 eenxf3oodfaDelivi s)t2to(opoudaptelivi ()arrr(m ou1aptoif3iys sDra( p (4 lxoio oadfpDe ieo;s0tetrir iudll n ivsltfs2tmur ou4texoiociytlm eau p;u) exoifcoatoa  auvo t) exo(o3iodop emiei t aDtm(ront1texoiiciydfs2uauvp;u0trenirciatoa rai ol(0 eur(r oo1aleelncsls)srrmx oou4aet if3ils a em( sn(0aexrir3ty1fm eau o t srxo(r3nydomenlnvt sfaDrrx p;u4tle  feildfaDul( pnt0texnmr3oo1fmtr i ilt) rxmim3oy4optnmictls) 2uaxr ;u1tpxnmfctydfa2elnvs t) exrir3oytla r ieo;s trtr(r3no1olt lfeil() 2ur(rpoo0teeoif3tatlmDemuvp t0tltoxr3iadoaDelu ol(0trumir iudaptn ivi sf 2tmxro;u4tptoif3iytlaDumu snt0aleomrctydoate neo;s)s2triopiy1aptnlfeils  2trum ;u0olx  i3iadla rl(mp;(0trxrmf3oa1lm r ivols)seuoxm iu4apenmnvs t srumu onu0aexnifetlsfm2uau p u0 rxrircoo1fa e u s;()t2xmxrpnu1lmee ivia() Dtrx  ot0oet  oetldfa2emnvo (0tltoxfcoo1fm r u il( s2xr(opiu1amenmfet (  2rrxmpou4olxomfctltfsDumuvs t0aetomoctydlatelu ils)srtm(o iudol nliesl(fsrrm(  nu0aexnmo3tlt s rlums u4aetomr iytlp eauvo (0trxrxrpnu1ll nmfctlt)srrmur ;t1tptomfctldfa ean o u4 ltrmf ia1oa elneo;s0 euoxrpoydlmtnlnei tf Drmumoou0tleoif3iyd a2ul(ms t4arerxocoa1fa  li s () rxrimpoudlmee fesl( srurxro;u0olt mf3iyt a umn p;t4 lxrmo3iatfmtrai o ()sruoiopou4om  mfvtl( sDumump;o1oexniiciydlaDuaums;()alenxf3iotlmteanes;t0trtoio ou4llt  fesls) rrr( p;t0tee mictldla2um( s t)tlenif3oytlptr u i s truoio3ny4lp  mnctas) Dtrxmpot1tet mi3iasls raums;u) ltoxf3iotfat lieil( trtrxr oudopt  icslt) 2taurp;u4tleoif3ils a umums t0trerxocio1fp   u o (0 2xm(mpiodll  mnvia(fa2tr( p;u1alxo f3iytlm2ea( onu4arenif3iy1omD  nvo t) 2umio3ny4lle mnci (faDuaurpou1oeenii3iltfa2ul(vs (0 lerircoo1la r n o;t0t2tr(rpoy4lltnmfcs s  Dtrxmpno1aetnmiciad a2rl(vs;u0tltnifcoytlmD  uvi;t0s2toiopiydol e fciat  2ta( ont0oexniieiad a raums t4aexrifcto1oaDelnvs () etmxr nydam n fesltfaDuau ooo0tlxomfeiysls ul(vpnu)texrxo tadlat lnvi ()sruoirpiy1ame  ieiat aDta( o;o4oeto i3iatfaDuanvs u0aeeriociodoatr ieo;t0 eumxmpnydap n fvta()sDtmxro;u4ole mo3tat m2ranmsnt4 etomo iydom   i slt srurxo oo1op n nei (fa2uaumoot1aexoiocilsla2rln p;t0aeeoirctotomt  uvslt sexmimpiu1omeemicslsfarumu  ;u4tltniieiyt a um(ms;()tltoxf tydlptr nvi s)srurxo oo4oltnlivia()s2tm(r oo1tpe moetytlm um(vo t0 lxoio iotopDeluvsls srxo(rpiydal  livsa()arraxmont1oltomoeils m emu o;u)tlxnxf iy1lp  lnei;s0 2tr(m iu1om emnvi t) ruax ont4alenifcilslsDrlnmo;(0trxrmf oadfaD aueo;s0trxmirpiu4ol n feiat)a2trxmpot1tlx mociys m ulumo;t4alxoir3iy1fa eauei s0t2xmirpiodome  ies s) rtrx ont1texnmfciydlmDelums;u0 ltriociodlaDrln ols) etr(m3iodamte fesasfsDraxmono4tle io3iys s2ulnmon(0trtrmr3iy1opDr uvs;s) rurxopoo1omt lnvtl( s2rmurpnt4aptoio3ilt aDea(mpn() rermo3oodomtr nvsl(0tetrxm3nydopt mfcil(fa2urxrpou4oleomieiyd m2emuvs (4trxrif3todopDeauvs;s)sexr(o3no4oleelietl(  ruauront4tpto f3iadlsDeluvsn(4aeeoiociadoa ean o t0trxoirpiydlme mncsltfs2uauront4oeeoii3iadla rlnvp;u)altrxr iy1laD aies;s  rxmxr oo4lm  mivsa()srtaxr nt4aptn ieiltla2ul(mpnu4alenxo oydlatr uvsl(  2uoiopou4al emfet (  2ra(ront4apt mo3tls mDumu o;(0 lenmfctadop r ivil( setrxm3iy1op nlfeta()srtau ono1olxomfeiyt s rl( onu)teeoxfcoadfmteli ils0s2trio3iu1ameemiesatf 2rr( onu0opxo o3iaslm2uauvs (0aexrxf3tatfm  ln i;s  rxm(mpio1lp elicsl(  Drm(r ;t1aleoifctydfm uanmp u0tlxomr todlaDrli i ( t2uo(opiydoleelnctatf rrm(r nu0tetnif3iys sDrmnms (4treomrctytop rli o s  rtoirpiydopeemnesa(fa2uaur no0tptoifcias a rmn o;u)aeeoio3io1lmDean il( sruo(mpoy1ome mfctlt) rrm(rp;t0oeeoiictls sDulumpnt) lenir oytoptrau ols0truo(m oodlpt lics sf 2uaurono0tltoifciatlmDem(vo;t4tltnir3tatomD aneo;s) exrio3no4ll e ncs (fa2urx ooo4aee mietyt m2eln p;t0teeomfciytfa   n o;t)trtmxr3io1olt lfvsa(fsDurumpno1tlen f3tyslm2elump;u4aetoxo3totomt  neo (0 2urio oudlmeemiesl()a2rm(r ;o1apenmiciat m2ea(vp t4areomr totoaD livi t0trtmiopny1ol   fesas s2rm(  ou4oexo i3ild a2uau s ()aeeoxf ia1lp   i o t) eto(r ny1aleemnetltf 2tmurp;t1tle moeiytfsDul( p;()trxnir oadopD lu i;s srxmio ou4ole  ncs () 2uaxmpou1optn ictadla ua(mp u0 rxoir tytfate u i (  2trir oo1apeemieiltfs2urur ;o4tlxoii3iasfs elnmpnu4teeoxr oo1om  auesl()tetoir3nu1amtelivtasf rum( o;u0tlxn ociadfaDelnvs;(4tlxoxr3totoa rli o ()s2tm(opny1al n fvslt) 2urxmp;t1apt if3tyd m ran ont4arerxrcia1fa eaieo;s)t2xo(o3nydlle  ivtl(  rtm(rpou1ale io3tytla2ul(mpn() ltoio oatfaDeau s;t0t2xrio no4opt  fviat)srur(  ot4apen i3ias mDean p;u4trenmr3iatoa elnvs;s)srto(r oo1aptnmfvtat) 2tmuroot1texn ietyt s2emnvont0arenmrcoa1om rauvs;()trtm(mpnu4lp e fetls sDuaxro;o4ole mieilt s2emnms () rermoctadlmt aivsl(0setoxrpnodop nmfet ()a2umu pno1oet ifcils a eanvo;u4texrxfciodoatr i i;t teurim nydal elfct ( srururooo1tlen feiydlsDra( p;(0 exoxr ta1latrlu ol(0 2tmir no4lp elfci t srrmu  no1aee if3tyslmDem(monu4 eenxr3iytfmDrlu sl(0setmxopio4apte ieia( sDrru p;o0apeo oeiasfm2rl(vo (0 rxrif oa1fp rli o;s) exrxr3oydamt mfes () rrrumpnu1tpxo oetadlm ra(msnt0aetoiocia1fpt au s;t0srtrxopoo1aptelnviatfa2tmu o;t4alxn ictld mDra(vp;u) rtnxr3ty1lp eauvo t trxoim no1opte fci ()arrr(ro;t4oee mfetad mDrm(mp u0 eerxr3ta1lpt anvs;s)texmio3iu4ameemnvi tfsrrax  ;o0aexniiciasfsDraumonu0 reoxo3oo1faDelnvil(0 exoxr3oo4am elfctas) 2uaurooo1aet  i3iaslmDel(vo;u4trermfciydopD  ivs;(  rumxr3iydlp   fct sf rua( ont4alto i3iys a2rmumonu4 rtrmf iodfa raues;()seto(o no4om  lnesl() rrr(r oo0olen fcilsfs2rmu p u0aeenioctodla rluvi;(0 rtrxr3nydllenlfesl() rumu o;o0opx micildfsDelnvsn()alerio3iytlate ivs;(0 rxrxo3iy4olen fvias)sDra(mpno0apxomfetasla2em( s;u0trxoxfciy1oa  lueil()srtoxo iu4ame  fcsasf 2ua( p;o1olxo fctyd a emumonu4aeerif3ty1omDe uei;s s2um(mpiy1ale livsas srurur ;o0alx moeilslm2rmu o u) rtoxfcoodfaDe n s;(  rur(m3ou4op  lict s)a2tr(r nt0tleo o3iyd s2rmu sn(0arxrmr todfaD an i;s)seum(m oo4olenmnes t a2rm(rp;t4altnmociadfsDrlnvsnu0tetrioctotoa ranvslt) 2tm(opio4ol  mfei t)aDrm( pou4aetomociad m2rluvo ()aetoif3iytfmDrau ols trum(r oo1lpe  iviatf Drrur oo4aex mociatlm rln pnt4tetoifctadlp  ai o t  rurxo3oy1ole  icia() Dum(m ;o0oetn ocild m ul(mp u4 rtrmrcoy1op  lu s t0 2urxmpnydolt mfeil(  Dra(  no0tltomo3iyd a emuvs;u4tlxnxr to1fmD li s s  rtrir oo4op nlfvslt  2rmxmp;o1tpx iociysfmDum(mp;(4 lerxr ia1fpDrln i () exrxm3oudomtnlict (faDtmuront1tpt mfciyt m2uanvp;u)trxrxr oadlm   neo ()sexrio iudaptemfct tfarumur ot0tlxomietad a2rmu pn(4aeerio3iotfa  lueol(0texoir3ou1lp   feia( aDra(rooo0tlt  ieiatfa2um( p;(4trtrmr tytoa e ueils)teumxr3oo4am  mics s srtmxroou1tleomieiasfs2el(vpnt4 lerirciytfmteaueslt) eum(opnydomeemics tfsrtrxm ou1opt  f3tytfs2ea( on(0trxoxo3oytomt  n i;t trto(m3ou4open nvs ( sDtm(m ;o1tltoifctlt m umump;u4arxomr3oodopD  ivilt0s2to(r3io1apt  ivi (fsrum(  no1aptnmi3iltfmDemnmo t)aexrmf3io1opt ai s s) exm(opoudop n fvs (fsrtru pnt0aet mietld m2emumo t0tltrxfciodopDe iei t0sexrxm nudlle  nvta( aDurxrono4optoifeiytfm2ean snt0arxnmr3todfmD aneo;( srtrxopou1ame  feiat arur(ronu1tpe moeias aDra(vs (0 ltoxr oy1omDe nes;t tetrxr oo1opt  icsltfs2rr( p;t1apx  ociltls umnvs;t0aetnxrciytfpteai s;t) rtoiopno4lmee icia( aDrm( p;o4apx  o3iat a um( pnt) renif3iatlaDe i s ( t2xoio3nu4altemnvs s) Drrxro;t1olxo iciatfm rmnmp t0 rtnir3iytoat  uvs t sexm(o nydoptn ieslt) rrmxr no0aptn o3ils s emnms (4texoxfctatfptraiei t0 2trio3nodlmtnmncsas)srtm(  nu4ape ifciyslm2rmumo ()altrxr ty1oaDrau slt  rtoxm nudom e fct s artau ono0opxomoetldls uau on()alxomocoadla elu o;t sexrxo ou1lmtnmnvtltfsDuru ont0aptoioeiat a2rlnvs;(4artrxo3oodfm  liei s seurxopno1lp  lnes tfs2umx ono4tpe io3ildlm rmu p;u0 lxnmr oo1faDeauvo;t0srxmxopnu1al emnct (f rrrxrpno4opeoiictyt m emuvp u4teerxr3oy1faDelnvi t0 eumio ou1al nlnci tf 2taxmoot1tpx ifciyt s rln p t) exnir iytlateaneils sexrxmpio1lm  mfctls) Drmxm ;o0tlx  f3iasls rmu sn(0aetnmf3tydlmtrai slt)t2toim3iydlmen nei ( aDraxr ;u0apeoiictatfmDuau o;(0aetrxr3oa1oat au ilt) exrim oudamtemnvi t aruax ont1tltnmf3iyt s2emuvo u)altoxociadlateanvs;t  rtr(r nodal  mfeia( a2ra(monu0tpeoioetltla umu sn()trxoio tydfpteaivils)sruoiopiy1am elivtls artm(m no0aexnio3ilt aDua( p;t4teeomr ta1fpt luvsls)s2uo(o3ou4ameelfvsa(f 2rr(ro;o4aptoio3tldfa2elnvpnu4texoiocoadfm   nvs;t) 2xrim oo1opeemfes () 2urxrooo4opeo o3tadlsDrlumpnt) ltrxo oy1omDr ues;s)s2urxo ou1aptnlnvt ()aDraxrpnu1teenmoctydfmDrlnms;()tlermo ootoaDeau s s)sexoxrpno1ome mfcilt sDtax  ;t4texo ociad m ean pnt4 lxnxrcio1fmte nes s0 eumxopoy4al elnvi s arrr(mooo1tptnmicild mDra( pnt0tetomrcoa1fptr u o ( sexr(o oodoptnmfvia()a2tmu ont1tpx  ietatfsDranms t4tetnxf iytoaDrli s;(  2tm(r iydlmenmncta( a2tau pnt0aptomfctytla2ean o;() exoxfcoatlpD  ieo;s  exr(m3ny1lm  mfvs s) Dum( pot0tpx miciadla um(vo;t4 ltomo3iytfm  luvo t0teumio3ny4lm   iesas)artrx ooo0olt iociaslaDulnvsnt)tetnxf tadop elivil(0 2xo(o oy4al e ieilsfs2raur ou0teeoio3tyt s el(vp ()arenir to1lmDeaues t  rumxmpou1ame  net t) Dumuro;t1aexo ociys sDumuvo;u)alxrio3oy1lp rau s;t0t2ur(mpoudap  mnvtltf 2ur(ronu0oltoiietas aDel( s u4 eerio iy1lm   uei;( t2uo(m no4aleemfesls)arumurpno1opeomo3ild m rluvpn(0aexrmo ta1lptraivi;t0srtoxr3oo4oltnliei t)srtrxrpnt0oex iiciasfa2ulu p;u0arxnirctadfaDraiei;s0srxrxm3ou1llt lncta(fa2tauroou4altomociatlmDul( p;t) ltoif tydfmDraiei (0t2urio3iudlpee iviat sDtm(mont1tltnmoeiydfm2eluvont4alxnxf3oatlm  aies s) exr(o nudoleelictls) Drm(r ;o4texoifetydfs2ra(mp t)arxoio iydoat lieolt t2uoxrpnydapenmnviat s2rmumoot1texn octlslm2ul(mo;u)tlxnmfcoytla   nesls trxo(o nu1al e fvtas)sDtmxmo;o4apto oetldlaDrmu o (0 lenxrcoadopt  u i t)trxmirpiu4amt mfet sfsDtmum ;t1openmi3tysls2raumpnt) etnmrcoodop   ivils0srurim oudal elfvtlsfaruaumpoo1aleoioeiatfsDra(mp t0 ltoifcoy1optr n olt0s2uo(o3iodam emici s)aDrm(m nt1olt mieilt m ul(vpnt4tltoxocty1laDrlu olt)teum(r iu4lm n fetls)sDtaurp;o1teenmfctadlm ran p (0teeriocoadfm e nvs;(0srto(o iy1lme  fvslsfs2urxronu4tpt iieias aDrmnmon(4tetnxf tatomte ieo ( srtmirpnu4ol nlfeilsfsrrau oot1tpxn fetldls el(vs u4teeniocoodlate u ol(0trurxr oodllte nei sfaDraurp;t1openmi3iyt m uanmon(4trtrmr3ootoaDeanes;t)seumxo3ny4al   ncsa(fa2ra( ont1olt mf3iysfm2ra( p u)treomrcia1fpt lueol(  2xo(rpiodopte nvta(fa2umxmo;o1aexo o3ilslaDua(vp;t) ltomr3oydomDr neols)srtmio nudllee ivsl()a2rax oou4tlxoiietatlm emu snt4trxnxr3oodfmt luesl(  2xo(rpoo4al nlnei sf 2rrx pot0optomfcild a rl( p;()alerxocoatfa rlnvil(  etmxmpnu4llee ict sf 2raumpno1tpeomf3iyd m2ua( onu) etnif to1lmt  u ol( trxoxrpiy4olte fvi tfa2tmum ot1oeen i3iaslm el(mp;t0alxrmf oo1fa   u i s trxmiopny1ol nlfetas)sDumxr nu0tpen ociadla2umnmo t)arenif3oo1op  ai i t setmxo3ou1ol elieils sDrmum ;t1alx mociysfs2ea( pn() ltnifcoodoaDeaivi s s2um(opnudam elicilsfsDrrxmoot0tlt ifeiad a2uanmo;t0 lermociadlateanei (0 2uoxr oo4oleelnes s)aDtaxrpno1aexoio3iadfa rm(msn(0 ltrxr3to1fp  lieo () 2xrxo ou4lm  lneiat  rrrurpnu1tltn o3tysfa2el(mp;(4 leomocio1optranvo ()s2uo(opny1lmenlneslt artmxm oo4tpen oeiatlmDul(monu) rxrmo3tytlpteau s;t)trxo(m3iudopeemfesa( srrr(m ;u1aeeomfciadlm emu on() rtnxocoy1fmD  u o;s  etrxr oodllt lieils)sDrax pnt1oeen ieiad sDrmumo (4 lxrxrcia1omDrauvo;(  2umio3nydomtemictlt  rumxmpnt4aexo ocias a2umu p (0trenio oa1fp elivs;t0t2tmxm iu4ape mfvtl(f Dumurp;o1aptnio3iasls2ra( s ()trermo iy1fpt anes;()seur(r io1llt  netlt) Duaxm ;u1openmietlsfs um( s (0alxrxr3ia1faDr uvils0texoxm oo4omeemncsat) 2ta( o;t0tetn i3tltls2rmnvo t0artnxr iodfa rauvi;()truoir iu4om nlictls  Dumurpoo0aexoio3iysls2rlumpnt4tltnmr iodlmt aues;s  2xm(opou1lpen nci s a2uaxro;t0tlt mo3tltfsDra( s u)aeerxo iadfa ranvo (0 etoxr nudomt  nei (  2rr(  ou1olx  ictydls umn p;t0 ltoxo oa1oatraivs s srurxm oy4ol emnviatfsDraur oo4ole ioctad a2rlu pnt4aeeoiociodlmteluvi (0t2toxm oudomteliesat)srrm(mpou0ole if3tas m elnmont)aeenifcootopDeauvi s) 2um(rpou1amtelncs (fsDraxrpno1oeeomf3iadfa ulnvpnt4artrmocoytfp  luvo;( t2xr(r3ny4lp nmfvi (  Drmu  ;t0olt  fciat m rm(vs;u4artrir3tatopDeluei s0srtr(m nudaltelneiltfarrruroot0olx ifctatlm2emu s u) lxoxf iadlm   nei s)setrxo nudamtnmfcs (f rtruroou1teenioeiltlaDemnvo t0altnircoa1la  aivs ( s2xrir io1llte ivt t) 2rau o;t4aexo f3iat s2raump ()altnxrciytfa eaneol( seuoxm oydlp emfvtas srrm(mp;o1aet mfeiytla2eaums;u0 rxoio3iatoptrauvolt) etoio3oodlptnmfeia()srrmumo;o0tetomi3iyt a elnmo u4 lermfctadopD  nes;s trur(m oy1lltnmnei s arurumoou4apeoifciad a emnmo ()aleomf oatoatrauvs;t0 exm(r io1opee nvtls)srumx  oo4aexnmo3iasfm2rau snu)trtrmocto1optr nvs t)srtoxo oudape lfesatfa2raurpoo1tle  feiysls ulu s;t0aeenxr3to1fpt lnvs;(  etoxmpiu4aptn nes ()a2uaxm no0alxnmieiysfs2el(vp u0 exrir3ia1late ueil()teumir3oy4ll n fvtls)sDra(  ot0tltoiiciadls2rl(ms t)trtnxf oydlp rlu i;t0 2urxo iy1omtnliesl()sDraxmo;t1oetnmfctasfmDulnvs ()arenmocta1omt ln sls)trto(o no4ape mfeil( srraump;t0tlt  octld s2rm(mo;t4 rtomf oatfpD aieo ()trtm(o3ny4apenmict ()aDrrx  no4opxnmocils mDeauvp t)aetnir to1la elivi s0trxoimpnu1ll nlfcilt)sDurx pou4alxoioctls m ranvs;(0trtrmrciy1fm eluvsl( srtrxopnodopt micils a2trx p;o1oet ifctysfaDeau o u0aetniocootom   i s s) etoir iu1apt  fvs s) Drrxm ou0tlx ifetls s2uln o (0altrxrctodom eln i;s) 2urim3oo4opte nesa() Dumxmp;t4ale mocildls ra(vp;u4treomocoatlmD  nvo s  2xm(m ou4oltnmnesltfa2trxroot4altomieias sDraumo;u0trtoir3totopD  i o;()setmxmpny4ole lfct s) Dra(ro;o4tpxn fctas aDulnmsnt) rtoir oatfmt ai i;s  rxo(r3iodlp e nctls  Dra(mpno4aleo octat a rlumo;(0treriocoo1lmte i i s tetmxrpoo4ame mnci ( artrum nu4apt ii3tldfa2elnvp;t4 leoxfcoytlpDe u i;t trxoim nydlpee fvil(  Drauro;u1apeo ietyd a2um( p t0texoxf oytlpte n i;t0trtr(r no1llte ieiatf 2um(r ;o0aptomieilt a rmnvo;u0 leomo iotfpt lnvslt)truoxm3oudapen nvi tfaDraxmp;t4tlx ii3tydla umnvs;t0 rtoio iodfmt  nes t)t2uoxo oo4lmt  fetl()aDtaxmono1aetn feilslaDel(vo;u0artoio3oo1oat auvslt)t2trxr3ny1amen nctl( a2ua( pou1tleo ocilsfs um(ms (0altomr3iatoatelnesl( t2uo(m oy1amtelivtat)sDrmx poo1olt ifctysfs2eauvo;()tlermf3iodfp e u i;(0s2umxo ou4lpt  ncsat) Dtmx pot1ole  iciyslm2em(vsn()teeoif oytlm r i i;s0sexoxrpou4lm elieia()a2tr(mpoo0apeoioetldlsDelnmo u)tlerifciotfa   n s s)srtoimpiy4lmtn nvs t)aDurx  ;o4tlt iietytfa2ranms;t0 lenio oy1lmtr uesls srtmxo3oy4ome  fcs t  rrrxmpou4oleo ieias sDemump u)alxrmoctydfaDrauvs;s)seuoim iu4aleemiesl( arrrxmpoo1tpxomietasfs ulums;(0artnioctatoptrln sls)s2tr(o iu1lmt mfvs s srurxro;t0tex  fcias m uan o u0trxrio to1om r nvolt0teurim iodopeelfei s srtrxro;o0altomf3tas aDul(vp u0 etoio oa1fpDeaneils0 etoio oo4al   nvs t) rraur ;o1tpxnmfciasfa2ra(monu0 lenif3ty1lpD  i ol(0sexrxo nu4opt  fctlt  Draurooo4texnio3tatfmDrmu s;t0tlxoxocio1lmt ai s;s0 rxrirpno1opt lfet s)sDrru onu1tptn fctlslsDua(mo;t)arxnmr totfmD  nvi;s truo(m nu4optnmnvt ( a2um(mo;o0tle moctydfsDeauvs;t0 eenir3oodlateli i;t trxo(opoodlmen fctltfsDuaxrooo0tee io3iadfs elump;t4tltrmrcoodlmtrliesl() exoir oo1omt  nei (faDurur no0aptoiictatlaDrm(vs t)tetomrciydlpD an s;t)setrxo3nu1om  mfct (  Durxrp;o1ope iietas aDra(msn()alxrmo tadlptelieo t)s2umxm oy4am e feils  2tmum nu1aee mfeiyd sDeanvp u0 etoif3iatoa eaneslt0 2trimpoudamtn ivs tf rtaum nu4apto fciasfa emn pnt4tlerio iydopteln o;t0srum(r iu4aptnmivs t)s2rrumoou1oltnmfetasfm2em(mp;()teeoir tytlmDr nvs ( trurxr iu1op nmnvi t aDrr( oou0oltnmfeilsfsDeauvo t0tltnirciodfpDraueo;( t2uoxmpno1lp elfvs (f rurumono1oex  o3taslm em(vp;(4artomf tatopt  ivo ( teum(rpoy4apen ivi sfsrtmu pou4apt if3ias s emnmpnu0 eeoif3iytomD an o;s)srur(m iy4lm e nei t a2tru pnt4tltoioetysfsDrlnmpnt)tltrmfcootop eaneo ( texmxo ny4lmen nvsa()s2rrumpno0altnioeiytls2rmnvo u0 lenxocoo1fpteanes;s trxr(mpiydal elfcsa( a2trx  oo0olto octytfm2rm( on(0altrio iotfm raivslt0 etr(mpiy4am  lieia() Dum(r nt0oexoioeiadla2ulnvpn()tltnif3tatoat  nvs s  eto(r3nudllt lnetas sDtaxr ;o4tlen feiat s2em(ms;()trxoxociatlp eauvs t0 2toxo3iy1oltnmnetl() rrrxmpoo0oexnioeias s ul(msn() rxnxo3oatlpDeai o (  exrim3nudome lfvtas)srra(mpnu1aeto oeiyt mDrauvp t)aeermoctytopDran i t trxoimpnudol nmies (f Dtmxmonu1oltoioctatlm2rl( s;u4aetnxr tatomt anvols  etoio oo1lmt mnvi tfsDurum ot4aet mi3tasls ea( ont4trtomrcio1fp e i o t  eur(opoodomt mfetat srur( o;o1alxo fciatfm2uluvsnt)trxrir tytopD  ues t s2trxopiy1olte icsas)sDum(monu1oleomiciyslm2uau s;()tltoxo3oatopt aueol(0 rto(o3nu1lptelfvt s) rraum ot4ale moetyt a2rm( s;()tetnxf oatomD auvi s truoxrpnu4lltemncias sDurx ooo0apto ociydlaDrluvpnt0 lxrircoo1lateaneils0 euoxopoo4openlfvsl()aDtaur no1olt  ociasfm2ran on(0 ltoio ia1fa e neols srxoxo no1amtemivil(fs2truront0texo i3ilslm2elnms;u)trxrxf3oadomDe nvsl(  2uo(opoo4alen iciatfaDua(  nu0oeto oetysfa uauvo u0alxoxf oadoa e nvs;t t2xmio3iodolen fes t sDrmx  ;t1tex iociaslmDulnvsnt4trxomf3todoa rluvsls) eurir3nu1al nlfvtat) rrmx pot0tlx mo3tysla rl(mo;u)arxrmf oodlpDr ivols) rumxo nodlmee ncia()a2trur ot0oetnmfeilsls ulnvsnt4 exoxo3ia1lmteaueils) 2to(m3nodlp n ivsat srrr( oot4opeomi3tadfaDrl(mo t) lxnxf3oatfat aivilt0 eurxr3oy4al nlnvsatfaDrrxrpnt4tpt mf3tysls ra(vo;u0arerxo3ty1fateli sl(0seto(r nudamee nciasfaDtm( o;u0aexoifciysfa eanvpnu4texrxf3oy1la e nesls trxoirpou1lp   fci t srtax o;o1aet ifciyd mDeau s t0tlxomfcia1opt  n s;t) rxoxopno4opt  ncsl(fs2trxm oo0tet mociysfm rlu s;u4artrif3tatfaD au sls  eur(opnu4alee ivi t) rra(r nu4tptn fctyslmDul(vo;(4alenxfcoytlateluvo t s2to(opou1ol  mfcs ()s2truro;t1aetomf3tlt aDem(mo (4aeenmr iatfa r u ils setm(o oy1aptelfesa(f rrm( o;t4altnmo3tasfm umumo t) lxoif tadfmDelivs;s)t2toiopnudap nlfetat) Drrx pou4apeo f3iadlmDrmnvp t0teenxf ootfm elueolt)teum(rpiydlpt mfcta(fsDrru p;o4open ociltlmDra( on(4texnifciytfa   n ils tetrio3oydll nlieia() rraxr ;t4aetniieiytfm2ul(ms u4alxnxr tatlm  anei t  eurxm3oo1lmtemfvsatfsrrrur nu0oltn iciltfs uan ont4alxrio3oy1lm   ieo s0 2uoir3nudlmtnmneiltfarur(moou0olto ieildfmDrmu s;u4aeeomo3to1fatrauvols0s2toxm3ny1ll nlfeiltf rtaxmpnu4tpxomf3iasfa2em( o;t4altrifcia1laD luvs t sexoim3ou1omt lnvs (farur(r ot0aetn o3iat sDran s u4 rxniocootlate nvi s t2xmir3oy1lp emivilt) Dtrxmpot4alt if3ildla elnvp;t0 ltnmr3iatfp elieolt sruoir3iy4al   nvsasfartmur ot1open i3iytfs2el( pnt4tlxrmo iodoat  n o s)texoxopoo4ole mfvsa()aDuru oou0oetnii3iyt m ua( pnu0 lxrmo iotlmD anvo;(  exr(m3oodlpeelnvt t)a2uaum ou1apxnio3iyd m em(vo u4trerifcty1fmDr uei;s0srumxrpiydom  lncsls sDuau oou4aptnmf3iad m ranmon(4 lxoxo tadfaDr iei ()trxo(r oy4lme  nvslt)artrxr nt0tltomieiltlaDeaumonu4altrir iotomt  ivils0seto(m ny1alte ietasf Drrurpnt0apeomoetyt m elnvp t0teeoxr3iytfpDeaieo () 2xoim oudap nmies s  rtaxm ot0oee  ieiytfa ulu on(4aeenxr3tadfpDe ieo;(0 2trio iudaleelivil() 2tm(mono4tlx  octad a2el( o;t)aeeomfcto1omtr i o;( s2xoim3oudlptnmicsa( artrumo;t0opx  ociytlsDumuvo;(4 lermr3tytoa elnvi t0t2xm(rpiu1ol emiesl() 2tm(m ;u4oltoiociadlsDeluvpn(0artnmoctatlm eln s;t tetoio3iy1lltemietltfs2ua(mp;o1alx mi3tysls2rmuvsn(0tltomocty1oatr ivolt0 2xm(r iodaleelnesa( sDtaum nt0tpxomocias mDulumon(0trxoir3iotopt liei s0t2urirpiy4llee fvsls)srtm(r ou4optoif3iys aDran s;t0areoxfcio1omD  uei;s  2urimpiodalt mfvta()sDua(mpou1oeeo oetaslmDrlnmp t)aeeriocoo1la eanvs t) 2xr(r3iydlpee nci s srum( o;t1oee  iciadlm2ua(vo t4 lxrif tytfpDraivi s)sruo(r io1llt  ncsat)a2ra(monu1alt mf3tas aDrmnvs u)texnir oadoa ran s t)s2xriopnudalt  fvslt)sDum( o;u0tpx  o3ildfmDel(vs;(4 eeoif tydfpt  u s s)seur(m oodlpen fvt s s2ta(mp;o0aee  o3iad mDulumo;(4arxrxfcoa1oa ran ol()sexmirpiydale mfet tf 2taump;t0aeeoioetytfs elu pn() rxoifcta1latraneo;(  rxmxopno4op nlivs s)a2taump;o1tlxn feiad m2rl(vo;t0trenmfcio1fpD  n ol(0srtm(o iu1al nmnvi s sDumum ot4tex mfetysla ra( snt4 eeoxr3oadlpDeanvo (0trxmim iu1ale mncsls s2rrumooo1tle mocilt a2ulnmsnu4 rtrmr ty1fp rauvi t)srtrirpoo4ap nlfei t  rrmur ;t4apxo oeiytlmDua(msn(0texoxocio1fm  lnes s  etoxrpio4lp elfvil() rur(mpoo0openii3iysfm umnvs u)alxnmf oo1la   nvilt)t2xrir io1op nlfei ( sDtmumpoo4tlxoii3ias s ulump (0areoxr3iatfp  aneilt tetmio oudll n ictl()aDtmum oo1ole ifeiasfm2uanvonu)trxnxf3ty1oa e iei t srtoirpiu1lmt liei s)s2trxm oo0aptnif3iltfm rlnvo;u) etoir3oodom ean ol( s2uoio iu4lmtn nvtat srtrxmp;u1oetnmoeilslaDra( pn(4alxrio3oatla   nes ( sruoimpny4opt  nvils  rtr(m ou4oltniietaslmDrmumo;u4artnmr oatlmDr nvsls)srxmxo3iu4lmt lfes t) rtmump;o4olenmf3tas m2ean o (4trtrio oadopDr ues s) rxrxmpoodale mieslt)sDuaxr no4opx mi3ildfsDea(mp;(0altnxfcoytfmDelnesls seuoxrpoydaleemfesl(f Duaurpno0aeen feildfa2rln p u4altnif3to1fa elnvi;t)teuoirpoy1lmtnmiesatf rtaxmo;u4aex  o3tasla emuvp;t)aleomf iodopDrlieil(  rto(r3no1lpt mivil( srtm( o;u0tlenifeiydfm2elnvpnt0 lxomr3tytfmt ai s ()srumxrpnudolt  iei (fsDtaxmooo4openiieiadla2em( p;() ltnmrctydlmDrlu il(0 exm(o oodop   ncs tfa2umxmooo0tet mictltfs2ra( o t4artrmocoydopDrlu i;t seuoxopiy1lp  lnet s)arta(m ot1tex  oetytlsDulnvs;u0aexnmo3iadoatrlu s;t srxm(opiy1lpen fes tf Dua( onu4aex  ocilt sDemnmonu0tlerxf3oodlm   ueils)teurxr3ny4al  mfcsls a2uaxmp;t1aptniictytfm eaumo;(4texnifctatla  aneols)t2xriopiudlmtnmict t  2trxront0ape miciltfaDumnvs;t0treomr ty1omD  ivol() 2xrir ou4amtemnctlt  rumxroou1oltomi3tysfaDem( pnu4arermo3ty1lm  anes ()teto(m3io4optelnesa() rumx pno1alxomo3ilsfmDel(vs t)alxoxf io1laD aivolt0 2urxr no4llenmnetas aDur( pno1tpx io3tls a2rln p t4texoxo iy1fa  aies;( t2trxmpoudolte fvtatf 2rm( o;t4tlx ii3tld aDuluvs;t4tltrif3iy1lpteauvi;s0 rtm(r oodllenlies s)aruauroou0tptnmi3iys aDrl( snt4 renxf oatfmt lieils0 2trxm no1op e nvt s)a2rauroou0aetomfcild a2umu s u4artnio3tatfpte uvs;s)s2xoxo nudalen fvsat) rrmum ot4alx  ieiyd a emn p t4teenif oytfp r i i;s) rtrir3oo4lptnmfetlt artaxrp;u1tpxnii3iltfaDrlnvo u0 ltnir3tytfat  nes s0t2um(o3ny1lm  lfet ()sDum(mpno0tptoif3iydfa rlu snt0 rtrxfctatfaD au o () eto(r nu4omt livtlt)sDrr(ro;t1oet  fetls a umu p;u)tltoxf3iydoa rau i s0sruoxopny1apt  ict ( a2urur no0oexnifeild m rmnms;u0tetrmf3oo1fp elnei t tetmio nu1om nmfcs ( a2rmuro;u4aexoiicilt m rm(ms (4 rermrcoodoaDraiesl( srxo(m3iodlpt  ivt t)srtm( pnu4optomf3tyt m2eanms;() reoio ia1faDelu ols0 2tmim nudlmee fcia()s2ur(rp;o1tlxomietlslaDeaump u)aetoif oadlat auvo s0srtmxm ou4ap nmfvil( aDrrur ;u0apxo fetydlm2ran o;t4treoifcoadomt livsl(0 euoxopoodlmtnmnci ( arurxrpno4oee ioetydls2rmums t0 rerir3ty1oatr neo;t  2toio iy4ol elfvs s  Dum(mpoo1tltoifctltfm2ra(ms (0texoif3oodfpDeaies;t  ruo(o3oodamtn fvi s)sDrm(monu0oeenioeilt a rl( snu4tetnir3tatlptelnvolt trtr(m3io1alt lfci t) 2ta( oou4tlenmiciydfsDua(vo;u0 rerif iytlmtelivsls s2to(o nu1al   nctlsfsrum(m oo0apxn ieild a2rm( s (0artomo3iytfmDe ies;(  2um(opnudlmeemfcslt)artru  nt4opxo feiad sDrmu on(4 lenmoctodlpte ieslt0 2tr(m3io4llenlivtltfsrtaxmoot1aex miciltlsDuln pn() lxnmf3iadomDrauvo ()setrxo3iudame licslt) 2rmxm nu4oet moetad a emn pn(4trtnxo3oo1fpDraieolt teuoxo oudol nmfcil(  2uaumo;t4teenii3tlsfa ulnmo t4 lenxfcoodlm r ieo s0 2umxo no1aptnlnct s)s2tau onu4aeeomieias m emn o (0trerxocoy1fpDrai ils0 etrxo3nu4oltnmicias)artrxr oo0tet  f3iltlmDrl(vp u0 rxnif3oydlp e ieo s)seto(r no1lle  nviasf 2um(mo;u1opx  fcild s2rm(mp;(0 rtrif3oy1fa  lues t)teuoio3no1omt  ivsa(fs2tm(rpnt1texo ictydlm umn snt) ltnxr iatopt aueo ( t2urxm3iy4apt  fet sf Drmump;u0apt  oetatfs el( s ()trenifctadoaDeaneolt)trtoir3nodamtnlfvtl()aDtr(rpoo4apt mo3iytfa2em(von()tlenmo3oy1lmtrluvolt)s2ur(m nydape  fcsls  Dumum ;t0oexo iciatlm2el(mp;()altomoctydfaDrai ils0s2uo(r iy4lpeemfesas  Draur ot0apt mfcildls2rl(vp t0aeenmr3iadlp r nei;t0t2tm(m io4ll nlfvta( aDtr(rpot0apenifeiatfs rmu p;u)tlxnmr3ta1om rlnvi;(0 etoxm3no4aptnmfctl() 2ur(rooo0teenmo3tld a uan o;u)arerif3oo1fmDe ueo ()s2umxr3iy4ome lncil( srtrx p;u0oleo oeilslm rlnvsnu0 eeoxr iy1lmtrlues;()tetm(mpoy1ol elies sfarrrxm ;u1aexo f3tatla rl( p u0tlermrctodomDrlnvs t)teurim io4olen icil(f Dtr(r ;u4oex  o3tatlsDul( p u)alenmo3iy1fmtelnvol( trtmim nodopeemncslsfsrraumono0aetnmfeils a eln s;(4 lerxf3ty1op elu ils)srxrxm nodoptelfesat sDtauronu0tltniieiysfaDemnmsn()tlxnxr oy1lptr u s;s srxoim3iydlpe mfeta( aDua(mpno4tpt  f3iat m elnmsnt4tlxriociotlatrau i (0 exoxm3iydlpee ivtltf 2rrx  ;t0aexoii3iysfa2elnvs;() rtnif iadopDrlivsl(  2tr(m3no1om   feiltfsrtr( o;u0olenifeiadfsDrlumpnu0alerxr3iodlmD  ivil(0 2xm(rpiodole lnvtl(farrm(ronu4apt  feiadfsDea( p t0treomfctytop rlu slt)texmxr io1opt  fet s) Drmumooo1apt moeiyt a2ra( p;t4 lxnxociytfmt ai o;s0trtm(mpiodll n ieiasfs2rr(r ou4optoifciydlm2rauvo;t) exrxf3oodlatrai o;s)trxo(opnydom  lneias a2umumonu4texnioctltfs um( s;() etrmo3totfmDranes;()teto(m3oudapen ncslsf 2tmx onu0aptoifciydlaDuanvs;t4artrmo iytoa   ivs;t0t2xrxm3oydam   fcs tfarraxroot4tle mo3iys mDumump;t4 leomf ia1opt lies t t2xrxopiy4lpte feia( aDrax  no4alxnmociyd sDul( p u0aeenio3tytfa   iei (0s2xrio ny1amte net tfsrtm(r ;u0tlto o3iytfsDean pnt0trtrif3iydlp eluei t)setrxrpno1ll nmfvsl(f 2umump;u0tle iietad s emnmon(4artoir3to1oateanei (0 rtrxm3oy1lltemietlt)aDrru ont0olxn ictyt a2rluvs (4areoio oo1fmDelneo;() etmxm3iu4altemfetls) rtru ooo0tlxn oetyt s2rau onu)altomocoytopD auvi t t2toim3oydoptnmfvs t s2ua( oot4tetn o3iytfsDrauvo;u)altrmr iodomteanvo;t  2xmxm iudlle  fvia() 2rauro;o1tleoii3tat mDeln sn(0aexnmo3iatla r nvs (0trxoio iodlltemnvtasfa2rr(mpno4opx  oeiydfm uluvont4tltnmr3oydfa e n ils) rurir iu1ole lnesl(faDtm(rpnt1ope  f3tydlm2ulnvs ()alxoxr3oatoate ivi (  ruoiopny1ame lnvtlt  Dtru o;u0oeeo oetatlm rau sn(0tlxoxoctodlpDe i ols) 2xr(m oodllt  nei ()s2rau p;t4oeeo ieildlaDrmn snu) lxniociy1opDrln i ()srxr(o nodalee ivi ( arra(rono0aleoioetys a ea( o u4alxoir oadom eaivi t) rxoim nu1oltelncia(fs2ur(mp;t0tpe iicild m2elu s;u4trxrxo3oytlmteaueil( srxmxo nodoltnlici t s2trxr nt1alto fetytls elnvp;u4trxrxr oydfm rluvs;s) exmiopou1ap e fvi ( arum(m ;o0tltomf3tysls2ra(msnu0aetnxrcia1omtrlu slt0trxoxmpio1al   feta()aDrrumpou0aet ifctyslm2um(mpnt) exrio oytlpDrlnes t s2umxr3oy1alt  nvi ()a2tm(mont0aee io3ildfa2ran pnt0altoxf3oo1lm  ln s t0 rxrxrpiy4lpe lnetatfa2tm(mo;u4olx iietydfm ulnmont)areoxr3oodomtrai olt0 eurxm3oo4lm elictl( artru  no1aee mi3iatfs2elump;(4 lxrxr3tadlmDelu s;t)t2umimpoo4apenlfctlsfaDraur ot1opxo ocias m2ul(ms t) rxrxr3oodop  aivs ()sexmxrpoy1lpenmfetls) 2umu  ;o0aee mf3tlsla2em(msnt) ltnif iodlm elieo (  rxm(rpoydlm n fcil( s2rm(rp;o1texn f3iat m2rau p t4 lenirciatomt  nvil( t2umxrpiydlmtnlfet s s2tm(mo;o4tetnmoctyt mDelnvsn(0alxniociodlmDrauvol( s2xoiopou1op elies ( s2umxmoou4tlx  iciydla rmn on(0 rermf ta1lm elu olt0sexoim3ou4altemiviltfa2trx oot0opxo ietltfm2ea(mont0tlerircoodlm r nvsls0setoxr oydlpt  ivtatfs2tmu  ot4oetn i3iydls2raumsnt)tleomrcoydlaD auvi;()srxm(r oo1apee fvt ( a2uaump;o4olx ioetyt mDrm(mo u4arxnmrcoadfat  nes t0trur(mpoydale livsls)aDuru  ou1opeomictlt aDul(monu)artoxr3oa1lpDr u il()srtr(m3iy1ll nmivt s  Drrx pno4optnmfeiadfsDuau p t0tltomf3oatlpteaivil( tetmxmpoydolte fvia(faDrru  ;o1oexn oeild s umuvs;(4artomf3tydlateauvo;s)srxrio iy4ol  micia(faDurxmonu1aexn iciad m ranms;u0aexomo3oadfatelnvs;( s2uoxr3oo1al  lnet t)arrrumooo1teeniociydlm2rau o;u)trtoxo3tadfa elu sls sexo(o io1open fvilt) 2tmxmo;u4tptnmfeiadfmDean pnu0aeeomo ty1fa eaieol(0t2tmir3oy4olte fcs s  rtaum no1tlxomiciadfsDranmo;t0arxnxfcoa1fmD au s;s trurxm ou4olenmnesa( a2ta( p;o4alt ifeiydfm rl( on()artnmf3iydopDelivs;s0t2trimpoo1ope livi tfsrururpot0tee mieiytfaDelnvsn() lxrif io1fm  ln s (  exoxopnu1omt lnct t srra(root4oex ifciytls em( s (4artnir3todla eluesl()seto(m iy4ape mnvs tf 2trxm ;u0tpx  i3tas s2rlnvo;u)trtrif3ia1la  lneol(0t2urxopou4lm n ivt ( arrm(m nu4alenmi3iatla uluvsnu0aeenmrcootlmDraivslt0s2xm(mpiy1llt lietat)srraurp;t4teto ietls m ea(mpnt) rxoxr3iodlpDe i s s t2xmxm nodam emfcsl()s2tm(mpnu1teto ieias s um(mo;(4tlerxfctytlmtrauvi;s sexrxmpiu1omee fei ( a2tmxm ;u4apeo oeiys m rm( p ()aeeoif iodfa e ivs (0trxmimpnu4lleemncsat)aDumu  nt0opxnmieiydfa ran o;u4arxoxf3oytlmte n il() rxoio3oo1lp elictat  rum( pno4tlxomi3ilsfm2rmu s;()aetrmocoatfa r ueo;()trtmio3io4lp emieiatf 2rr(  no0tpe  f3tadla eluvp t0tltrirciytop r ueolt) rxrimpiydll n nvtl(fartmxro;o4oeeo o3tldlm uanvo t0 rxnmfciydlm eauvo;s)setrxmpnu1ap  mfvil() 2um(  ;u1alx iieiat sDulu snt4 rxoio3oa1fptr uvols  2urir nydam   feias)sDrmxmo;o1oetnii3iat aDrm(vs u)arermf3to1fmD lu i;s)teto(r3ou4omt licil(f Dtrxm nu4texniocias a ra( s ()alxnircoo1fm eln s;( setrxm iudop  lnet (fartrx pnt1tltn fetadfmDua(mo ()texnmo3oytfaDrau s t teuoxo3io1lpee nci () 2uaxrpnt1apeomicildls raump t4arxoir ia1oatr uvo t0 rxoimpny4om n ivtatfsrtr(  nu1apx mfeiltls rluvs;u4tltnxr3iatomDe i o;()s2uoim nudome lics ()arrr(  oo1tpeo ieiatfs rauvs t0 etnmr3ootfmDrai s t  rtmxo3iydlme lfvi tfaDum(mp;u0alxnii3iydlm2ra( pnt)altrir3oy1omt  n il() ruo(r oy4ap n iesl(f Dumxmonu1alx miciatla2ua( p t0 lerifctodlpte uei t0 2trxm3oy4omte netls  2rax  oo1tpe mo3ild a em(vp t4artnir3iatfa  luvsls) etm(m3iy4amtemfvtasfsrrau  ot0texn o3iys aDulu p u)trtoxr oydlmte ivil()teumirpoy4ope mies s) rrrxm ot1aleoioetatfa rlnvo ()tlermo iytfat au s (  etrimpou4om  mfvtas) Dtaumpou1olen fciltls ean snt) eeriocoy1om rln s s0 rtr(o3ny1lmeeliesltfa2uaxmp;t1tetn f3iyt m2el( s () lenircio1lmtraneo t  exr(rpiodole mfct t) 2rm(m ou0optnmoctydfsDel(von(0trxrio to1fmt  ivol()teurxmpoodap  mies sfa2tm( oot1apx mieilt s2uaumsn(0 exrif3iotfm elnvs;()srumim3ou4olt miei () rtrx pou0tptn f3iasla eaumonu)alenmfciytfaDeanei ()srxo(r ny1lmtn fvs tf Drrx o;u4apxoiociatfmDrm(msnu0 rtniociodfpteaues (0srto(o oo1olenlnvt ()s2ta(rp;t0teeo ietld m2rmuvs ()trxrmf3tadlmDe nvs s)trtm(o3ny1om   fetlsf rtr(rooo4aptniietydfa2rlu ont4 rtrxo3iytoaD lies s0trtm(r3nudal   fcias arra(r ;u1aet mfeilt a2el(msn(4tetnifcio1laDrln i s s2um(r io4al e fcia() 2ta(ront1olx  ietls m2ea(mo t0 rtoir3tadla eauvi;s)tetm(mpiydlme mfcs (fsrurum ot4tptoiietatla2eauvpnu)tetnmr tytfaDrauei s)srtmiopiy4lptn ncslt srtaxrpou1aexo f3iys aDul( onu0teenifcoydfmteluvsl() rtm(m nudapee nvsa( arra( p;u1tpeo f3ilslsDea(vo;u0trtoxr oytlmDrlueols0 exriopnu1lleemnvtltf Draxmpou0oeeoii3tatfs um(ms t)texnmr3ia1la eau o t)t2xrir3iu4olte fetltfa2rr(mpoo4aptomiciyt s2rm(mo t0alxnmo3iy1fpt  ues t t2tm(rpoodole lnvtlt)s2raxr ot0opxn feiatfa2uan p;u4 reomr3todoaD aues t0 2uo(r oydam  mivtl(f rrrx  nt0optomociytfa ua(mp t0 lxnxo iytfmte ivo;s0 etmimpnodopenmfvslsfs2raxrooo1apx iociaslm elu pnt)arxnif3ta1opDelieslt0 rxrir3iydlm emiesas artau pou0opeomfetad mDrm(mo;t0tlxoio tadlmDeluvsls  2xr(opiy1ll n nvsatfs2rmu o;o4oltomf3iat m rmump;u0aeeoif iotfat an ilt)s2xoxopio1lmte nvta() 2tru onu1aptomoctat aDemnvo () rxoir iadfm ran sls s2tr(o io4omtnmnci t) Drmxroot4oex iietad m2emuvsnu0tltrircoo1omDrai ol(0 2xm(o3io4oltnmicsa()srtm( p;t1oexomoctad a elumpnu0texomr3totoa rauvo;t srtmir ou1aleemfct tf rtrxm nt1oeto ociydfsDulnvp u0 ltoirctodfmt  n i (  2tmirpnudom e icia(  rrr(r no0aexnmfciyt mDeau snt4tlerio iodfat anes (0 exr(o io1lm n fcs s s2urx p;t0ale  feilt mDuan o u)aexoir3ty1lmDeli ils0s2xr(o3oo1lme lfei s)srraumooo4optnmfeilt a2el(vp u4teeomo3oytlmDelueo;t0seurxo3iy1apte icta( a2uax o;o1tex if3ild m2uau s;t0 lxriocootoaDrluvi s  ruoxopiodapt livtasfa2ua(  ot0alt  f3tasfs2eluvo t4tetomr iy1oa  livo;( texmxo oy4lltelnvsl(fsrum( oou4tex  f3iytlaDem(mp u)aexrmrctytoat  u i;s0 2tm(r iy4lp nlfvslt  Duaur nt0tpe iictldfaDulnmp (4tleomf iodopt  ieil(0trumir3ou1apee ivtlsfs2umum ot0apenmfeiysla2emumo;u) ltnxociadfptrlivi t0texrxo3ny4altn ietasfaDrrxmoot4apxo ieiyt a elumo;u4tleomf iy1lpDrluvs s0 exo(r3oo4op emivilt) Dtmxmpou0aeeo f3ildfmDemn o;t4aexnir3to1op e nvi ()tetmxr iy1optnlnvt tfsDurumpnu0tlx  iciyt aDelnmpn()tetoxo tadoptr ivsls)sruoxm3nydop e fei t  2tmxr oo4aleo octlslsDuaumsnu0texrmf3iotlmtr nvols seuoiopiudoltnmnvslt sDur( oou1tpxn fetytls2uan s (4artomrcty1opDeaies;t)s2xmxo ou4omtnlnviat  rua(moot4apeomoctytla em( s u0teenircto1lm   nvi (0trxrxopou4ameelnvsas) rta(  no4tpeomf3tyslsDeanmp (4texnif3oodoa raivs;t s2uo(r nodolen iet t) Dumu poo0tle  ictydfm2elu p;u0arenir tytla eluvi;(0s2xrxopny4ap elicsa()a2umur ;u0alt mo3tadfa uaump t4teerio iydfmteaivo;t)s2to(m3io1opt lnvtl(fsDrmx onu4tpe mfctaslmDrln o u4 ltoircoadoptrlieo ( seuriopiydlm  lfvi t)sDurx onu0tlenmfciaslaDeaums t)trxoio iydlmt  nvs;( srto(m3nodomtemnvi s aDuaum nt4altomoeilsls2emu o;u4trenmocoytfmtrli ils0srxoim oy1ll  micsat) Dra(m no0altnmoeils s rlumo (4 rtnifcoydfpDeli i t0 2trxo3iy4altemiet s)arra( pno0tpeo f3iytfmDumumo u4trerxr ootomt lnes;t0tetr(o iy4al nlnvi tfsrtauront0aexomo3iadfa eanvo;u)teermo iydom eau o;(  eur(mpno4optn ieia(  rurx onu4opeoioeiatfm ran p u)trxrir3totfmDrlu olt  2urxo3oudap   iesatfarrrxrpoo0opto ocilt a2rmnvo;t) exrxo ootoaDr u s;t0t2tm(m nudaleemneslt aDur( p;t0tle  f3ilsfm ran p t)alerio ta1omte ivi s)trur(mpny1ape  ics (faDtmumoot1alx  fctad s emnmont)tlxoxo oadlm e uei;t tetr(r3nydaltnmivsa(fa2uauro;t4olxn oetlsfmDemnmo;t4tlxnif3to1fmD luvi (0 rumio3oodap  mfeiltf 2tmxmpno1aeenmfciasls ul(vs;t) eermr3oydfmD ai s;t srtmxr3nodameemivsa(  rtr(mpnu0tpt  fetys m2eanvonu)arxomociatlaDe uvol()trxm(opoy1olee nvi t) rrmxmont0apeniociytlm2rm( o ()altomf3oodlpt aueo (0seurxo iudam  mnct tfsrururont4olenioeiaslaDea(vs (4tltrif3to1omte uvils)tetm(rpiodapt lnesls aDumx o;u1ope ifcilsfsDum(mpnt)tltrifcoa1faD ln s t s2umxmpnodaltn ivsls)artr(ront0tlx moetys sDemnmp (0alenmfcty1la eau ils sexmxo3no4op elncsas) rumuro;u4aeeo octytfm ua( p;(4 etnir oytlatraieolt) rtrirpou4open nvia(farur(  ot1tptnmi3tydfm2ra(von(4texnifcio1lpDrli i s setoxm3no1omenmfetat aDtaum no1alenii3iys aDemnvs;t0aleomo3iy1latrlies () 2ur(rpnu1apeelnct t a2ta(  ;u0apeo i3tydfaDrmnvs t)altoxr3tatlaDr u s t) rum(opio1omenmnci tf rrax oou4olxo ietys a rlnmpnt4tetrxf3iotoptrlues s)trxoxrpny4ole lietl(f 2ra(r ;t1ope  o3iysla el( o;u) ltrxoctytfat  nvils s2xm(o nu4alt  nciatfsDrrxmpnt0optomfciyt m rm( pn(0artrif3iodfmDrauesls) eur(m3io4om emicia(  rtmx ooo1tlxoif3iydlaDrm(vs;(4 rtomoctotfp e n i;t0 euo(m nydaleemnet (fartmu p;u1tetomfeiytlmDel(vs t)altrxf oadlate ivslt0trtrim ny4omen feils)aDrr(ro;u1aexo feilt aDemu p;u4tlermr tatfmDrli s s0 rum(m3ou1am nmncs t sDtau  ;o0olx  i3tytlmDelu pnt)arxoir totomDeanvs;t0sruriopoo4ope mncsls)a2umxm nu1openif3tad aDuln on(0altrxrcoo1faDr i i t) exo(r ou1lptnmici t srta( oot4aee mfctyd a ea(monu0 rtnmo3oodfmDr i slt)s2umxm no4amt  iei tf 2tm( pnu4texnmfeiaslm ra(mo;u4aetoir iadlm  auvi;(0s2tmxo3iodoptemiviatfsDurumpno0open i3iatls2uln o ()arxrio3ta1oa eai ols) 2trxm iydaltemies tfa2tru  nu0tetnmfciatlaDrl( p;(0 ltnir iydfmD  uvs t0 exoio3no1opt lnesl(faDra(rpnu1tpxnmieiydfm2rluvs (0 reoxo ta1fpteln il(0 euoxmpiydlltnlnvtas aDuaxr ;o0aptoif3iytfaDrmnms t4aetrxo3iytlpte ivi;s trumim nu4ale mfvil( arumxrpot0oet ii3iat a2ranmo;u0texriocoa1om e ueil()srur(o iudll nlnetlsfarrr( ono0apxoifetad a2rl(mp t0 exnxr3ootfat au o (  2xm(r3oo4lle mieias)aDtrxmpno4openmietadlaDrauvp;(4 eeoxfctotlaD  n ol()t2toxr3no4ll nlfctl()aDuau  no4aex iieiasfaDrauvo u)areoxo3oodfm eli ol( s2umirpiy1om  lnctasfsDtr(rpoo1tetnifctys s2em( onu4 eeomociytlaDe nvs t sexr(opoo1om emnetltfaDua(rp;o1tlt moetadfaDrauvo;u)arerxocty1lpD  uvo;()teuriopoodoltelfvi (f 2rm(mp;u4tlt if3iyd sDem( p;t0artnmr3io1faDe uvo;s s2trxo3iudapte nvt sf rrmxmp;t1texnmf3iydlmDeau s u0aexoif totfa e ueo;t srxoio3oudol nmfei (  Dum(monu1aex  icilsla em( o;(4trtrxr tydoaDrli o t0s2trxopio1altelfesl( a2rrxr ;t4optnmi3ilslm2rlump t4alxrxf3iodfpDrln i;s t2tmimpno4opt  iciltfaDra( p;t1tle mo3iadls eauvp;u0aleoxr3oa1fmtrlnvol()trtrxopiydlptnlieiat a2uaum oo4opxn ociadfs ulnvo;()artomf3io1fate neo;t0 euoxr3nydome lneia() Drrx  ot4oee  fctat s2uaums;t0tltrmr oadfa eaieols0texo(opoy4lmte ieilt)aDtax ooo1optoii3iysfm eanvo (4trtrxo ty1op rai il()s2xmxrpiydlp  lfcs tf rumxr ou0apx ioctls sDea(von()altoif3oo1lp r u i;t) etmio oodlm   ivs sfartmx ooo4tpe iociadfaDrln sn()altoxf ty1oaDelu s;t  euoirpoo4lmtn icias srrru ont1openio3tatlaDrl(vo;u4 rxoio iydfaD au s;t0 rum(r3nudom elfes (fs2rru onu1ape ioeiyt aDrmn p t)aeenmfcto1oa  aieilt0sexo(opiy1om  lnesatf Duax  ot4aee mociaslsDulumo t4trxnxo todlm ranvil(0srxm(rpiydameemfctls)sDrrxrpot0aexomo3iadfaDrmnmo;t0tetoio oytlat luesls  etrir3ou4ol nmnetat artmu p;u0tpxnmo3iys aDemnmsn(0trtoxr3oydlp r nvslt  etm(o3iu4am emfeil()sDtmx  oo1optnmoetldfa eaumont)areoirciadla r ueo;()teumirpio4lle lfetlt srumxr nu4altn f3ilslsDra( onu) exomo io1opt  u s s)sruo(r ny4alee ivs t) 2umumpnt4tpx  ieiaslsDeluvsn(0aexomr todomDelu ol(0 etmxo iodolt  nvtls)arur(mpou0tpxn oeiatfsDem(mpnt4 rxoxf3oo1lptrauvolt0teuoim3ou4oltnmicsat  rur(r no1alx mi3iytls2rl( o;t4teeoxociydfm e u il(0trxmxo3oy4am  mfvilt  Duru pou0tetomoctldfm raums t)artoxo3oy1lmtranvs t  2toirpiydlm  mivtls)s2tmxmo;o1aleomfeias sDrlums;u4areomr totop  lies;()srtoiopny1ap  lictasf 2uaxr ot4aetnmieiytfs emnmsnt)tetoxf3oa1opt  ueols)t2tr(r io4opt  ics t a2rr(rp;t1tpx  oetaslaDul( p;() ltnxocta1oaDr i o;t tetoxr iu4opte nvs sfs2uaxro;t1oee iiciyt mDrmn pn(4aexrmo3todoate uvi;s)t2umxr3ou4op emfes sf rtru o;t1alxn ociydls um(mo u4 renxoctydfpt lnesls) eurxm oodllt livils) Drau p;u0opxn icilsfmDeauvs (4trxrmr3iytfatrau i;s) eurxr iu4omeemici ( aDtrur ;o0aetomieiytla uluvs;u0trtnmr3iadla eaivs;t  exoio oudome  fcia(  rumx pnt0oee if3iatfs ul( onu4texrmf ty1lptrlneo t) 2uoimpoo4ap   ici (f 2rrur nu1oltniiciadfs rm(monu)texoxrciy1opt auvo s0trxmxo3no1lme lfctlt srumur oo0aex moeiatlm2umuvp;t0 ltnmo iy1faDeaivsls) etrxo3oy4olenlfvsl()arrmx p;t0tptomfciydfm2eanms;t0texnxo iy1fpDrli i t s2toxrpiu4op elnetls)sDtmxmooo4tpe ifciaslm2ulnmp u4 rtnxo iodfmte i o s) etoiopio4op elfcil(  2ta( p;t4oltnioctldfm2rlnvsnt4arxrif3tytfmDrln sls  2xm(opoydalt licias) 2trxroou0oex iiciat m ua(vo;t0treomf3totfm e ieslt0srtrir3iudope  ivt ()aruaxm ot4teenio3iyt aDuanvpnu) lxrir3tydoaD lnvi;t0texriopoy1aleelncsa()s2uax  nu1apt mi3iat s eauvo (0teeomo to1lmDrluvs s  2xm(m oodolt lnci (fsrrauroou1tpxomociys sDra(ms (0 etrmo tytlptrlueo t0s2trim3nudam elivias arrmu o;t0tlxomfetadfaDulump (4tlxrio3iydfpDrli o t seurxo iu1altemiviasf rraurooo1olxoiiciat s eluvont) lxoir oadlmte u o () exmir no4omtn nvtltf Drm( o;o1olt mieiadls ra(vpn(0aexrirciy1omteau o t  exrxm3ny4lme  ici s)arumu ono0open fciad a2eauvo u4aeerif tatlpt  u slt0srum(o3no1lm elivsls sDra(mont0ope  oetat m2ul( p;(4trxnirciotopDrli s () 2ur(r no1omte nvsatfsDrrurono0opxomfctlslmDem(vs u0teenxf ootlpte ueils0setm(opiu1olee ivt s) 2ra(m ;t4aee mfetydlm rm(mont0aeenmr totfpDrln olt0s2tmxm3no4lme lfctltfarta(m nt1altn ocilslmDea( s;(4arxoxo3ty1faDe nesl(0t2xoxopiu1ole liciltfaDrmxm ;t1oexoiietlsfa emnvs t)altoxo ty1omD auvsls0 2um(r3iydop elivt ()srrmum oo4alx ioeiydla2rmu pnu4 ltoio3tydlpteauvs;s)setr(mpou1ole lietatfaDrr(root4tpenmociadls2el( o t4arxrir io1la raiei s0 2tmxrpnydlmee nvta() 2umumoou4tptoifctld s2eln o;t4trtoxf3tadfaD  ivs;(0t2uoim3io1llenlfviatfsrrrx  nu4alt mo3iydlsDulnvs;u) etnif iodoa e u ol()seurxo3nu4lmt  nvtl(  rrmumpot0tpxo i3tydls umnvo (0trxnmf3io1laDelnvo (0s2tmio3ou1om n fetl(fs2tr(ro;o0optnmf3tad a uluvs u0altoifcia1fm rauei;s  etoim3oy1lle mnvias a2uau onu4aeen oeiyslaDelnvon() eermo3iydlmt an o ()texmxo3nu4altemfvsas sDtrxm nu0openmfeiat s2rauvp;t0altoir tadfpDrli o (0s2xrxm3oydal elnctl(f rururoot4aeeomf3tat m ranvp (0artrxo3oy1lpDe i i;(0trtmimpou4olenlfeilt)arraxmoot1tlxn oeiyd a2em(vo;t)alenmr io1optelivo (  eur(opnodomteliei s)s2ta( onu1apto fcils m rlu p u0 rtnxocio1lmtrln i t trtrxo oydap   ict s aDtru o;o1aexn iciat m2rl(vp;t) rermo iotfp  aivo;s truoxopoodll nmfvsls) rrmu pnu4ale iieilsfs rlnmo u4 eerirciotfat ai s (  euoxo3oo1ll nmfcs sfsDuaxrpou0teenmictyt a umnmpnt) lxnio3ia1late ivi;t teum(m iudoltemieta( srtaum ;o1optnioetld s2ulumo u) etomr3iodla elivs t  2uo(r3oy1al n fes sf 2trur no1ale  f3iltfaDuluvp (4tltnxrcia1lptraneols0 2um(r3iy1omt mnvsas) 2ua(r oo0olx  f3iasfm elnmpnt4tlxnmfcoydfm rauvi t0 2tmio3ou1lptnlfcs (farumx pno4olen f3ilsfaDeanmpnt)teeoir iy1oaDeai o;t0sexriopoudop eliei s s2rrx ooo1oexo feiltla2el( p;(4treomr3tytlmDrlnvo;s  etrxr ny1om nmici sfartm( o;u1olxomieiltfmDem(vo u4 lxnir oatlp   u s s trtrirpny1lmte fvta(f Dua( onu0tpeo fctydla2uluvp t4trxnmr oy1lmtrlneolt)sexoio3iudlm elietlt  rrru pnt1apeomoeilsfmDuanmo t)altrmr to1lmteaivsl( s2trxm ou4ll nmneslt)sDuax  ;t4tpt ifciydls ul( snt0aeeoxf3iytomDe nvsls  euoxmpoo1llenlfetas aDrmxmp;u0opx mfciatla ran o t0 exoxr oodlat auvo;(0 exrio iy4om  lnesls)s2ra(ro;o4aex  oeiydfa umnmo u4texnmo tytop rauvi;t)teurim3iydopeelivi t)arta(mpoo0aexoiietydfa2umu o (4alerxo tytopDelu s (  2umxrpiu1op e neia() 2uaxr nt0tptnii3iysls ea(mon(0arerir3oytoaDeln i;t  exoxmpoo1am n icslt) 2rrxrp;u4aee iocilslsDrlnvsnu) ltrmrctodoaDelnvo;( trxm(m3oy4lmen iciatfartax o;o1alt mfciydfs2uau s t0tltoxo ootoateluvolt s2uoxr3nudomtemnetltf Drrxr no4tlt  ietadlm2rluvs (4trtoio tatlmD auesls s2trxm3iodameemfcs () rum(r ot1ape io3tlt aDuln p;t0aetrirciytoaD au i;t  2xoxrpnodope livs (farum( pnt0texoio3iytla2rm(von(0arxnir to1lat ln ils)sruoirpno4ap  lictatfa2rrx p;o1tpxomf3iatls2uanmp t4alxoxr ootom eli o ()setr(o iodaltnmnei ()aDrrxro;o1oleomociadfm ulnvonu4tetoio3iytlm rluvols0srxo(r3iy4open fes s  Duaxr nt0aexoii3tatfsDul(vs (0aexnxocoytoa r nvols)srumio nu1ol e nvtas)artaump;u0olen ocils aDua(ms u4 eenif3oydopDe ivilt) 2uoim oydap  lnesat  rrmu  ou1tex  iciasla2umnmsn()artrxocootfptranes ( sexm(o3oodlp emfci s a2trxro;o1aetomfeilt a2ulu s;u0trxoxfcta1optr u ols sexo(m3oo1apen fci t) Dumxrpot4tle  f3ils a2emnms;t4arxrifcoytlpDeaivs t) rxr(rpiu1ameelivsl(f rtaurpnu0olxnio3tydfm2ulnmp;t4aeermo3io1lmD lneols sruoim ou4lmtn ncilt)s2rmumoou0tpxomfeildlsDra(mo;t4arxomrctatomDeaueo;(0 rto(mpoo1ap   nvs ()aDrr(moot0tpe  i3iat m2ra(msn(0 eeomfcty1lmteaues;t  rtoxm3oo4optnmfeia( s2uaxmp;u0tex  o3iyt mDum(vs u4teeoif3iy1faD  ivs () etm(r oo4alenmnvta( a2uaum oo1oexnmfeiysfaDra( sn(4aexomo ootfa  lneo t)s2uo(o3oydolt mnvsas  Dua(m nt1tpxnmoetlslsDrmnms t4trtnmo3totla  aivilt  etm(m ny4am elnviat)arurx ono1tleomo3tlsfs emu sn() rtrmfcoatlp   ieol()seurxr3oy1ll  mnvsls a2raum ;t4olxoiietlsla rmn on()tltnirciodfpDe u s s tetoxr io1lpe mfesasf Dtmu pnu1apeomociadla2ulnms;(4trerifctadoa  au o t0srtr(r oodape mfvs t a2uaxr nt0tpxn oeiasla2uln s (0arxrif3oa1oaDr ieils)tetrir3ny4lme lncta(fsDra(  ot0tpen octadfa ranmont0tleomo ta1lat  ues;s0trtm(rpiydlp emics (  2taumonu0ole mo3tltla ulums u0aeermrcoy1fpD an ilt srxoxo3io4llenmfvsasf rtmx pnu1altnioeiad a2uauvo u0texoio3iodopDrlu i;s seto(o no1ole livt (faDtr(r nu0alt iiciatfmDumn p u0tltrmrcoytom eai s;()trtrirpiy1ole  nvtl(fsDrax ooo0aptomictldfs2rmn o u)tleoir3ia1lp eluei t)trtmiopnudll   ics tf Duaumonu1tlt miciat a2emu o u4altrxo3iadoptr ueo t)sexo(m io1amen iet t)arrmx  ;u4tex if3ils m eau s;u4 lxnmf iydoa e u o;s trto(r iy1ap  liesa( s2tmxm ;t1oee  o3tydfsDuluvo;t)trxnxrcoatfp   u o ()t2xmio3iu1amt mics tfsrumx pnt0tet mf3iysla ulnvs;u0 lxoxo iadfatr u s;t texo(r3no4ol e netl(f rtmumont4tex mfciltlsDua( p;u)texnir3oa1fmt liei;()setrimpnydlpe mivs tfsrtm(rooo0aet ii3tatfm2ranmpnu)teeriociy1oa   ivo;t srxm(r3nydape mfvtat)arrm(  ;o1tpeomfeiaslmDulnms ()aexoxr3tytlaDrlivils0trxmxr io4ol   ict (fsrraurono4aptomfciyd sDel( s t0aeerir oo1fpD aies;t0 2xr(o no4lm   feilt sDtmx pnt4olen i3tyd s2eau pnu)tlerxf oydfaD lies;t)srxr(r3oudom   nvslt srtrxro;t0tpeoiiciat s rm( o t0aexnxf iatlmte ueolt)trxm(r ou1ameemneil()sDtax p;t1aexnmoeiyt sDea(ms t4aexoif tatlmDr n i;()t2xrxr iy4al emfvia()sDua( pnu0tetoiieiyd a2uanvo u)alenir iy1late iei;(0 rxoxrpno4omeemiesltfa2umurono4apxn fciasla rau o (4treoxf3iydoaDr u i;( s2trim3nu1al n iet ()sDururooo1opxomietyslm2umnvpn(0alxrxf tytlaDe n olt0sexm(rpny1ll elietatf rtmxr ;o0tlxomicils s eanvs;t4trenmf3iadla rlieo;( trxmir3oydape  ieil()srtrx o;u0aetomo3tldfm2ulu p;(4trtrxo oa1lmteli i t)teuo(o iu4alen nvi t) Drmurooo1olt  fctyt a2rm(mpn(0trxoio3iytlat  uvs;s sexoiopiydlltelnet ( a2um( pnt1tpxo oeiltlm uau snu) rtrmr3iodlp elues s0 rtoxr no1lpe mivils  rtrxr no1texo iciaslaDuauvo t)artriocta1lm e uvils) 2tmim3no1op  lnctatf 2taum ;t1aet iictyt a2emu p t4 rxnmo3tadlmDrlueols0 2uo(r3ny4optemfes t srra(monu0alxoifeilsfm2umnmo;u)alxnmo3iodfmt lnei (0srxoim iodamt  nesas) rra(r ot1oeeomo3ildfsDuanvonu0trxomo3io1omtrlnes (0srtr(m3oy1ame lfvs s sDrrxmoou4apto ociysla2ra(vs t) eerxfcoy1lmtelnvols0 2urxopoy1lltemfvslt sruax o;o1oet  o3ildfs2ea( s t4tlenxr todfp eanvs;(0 etr(o nydopt liviltfsDraxr ou4ape mocildfaDea(ms;u0texnxo3iadfa   nvo t0t2trxo iodol  lnvia()aDumxmpnu1tee if3iysls2ra( pnt0tltoio3io1fa r nvo;t0s2umxo3iodamt  nesas)a2ra( onu0alt mo3iydfmDelnvs;u0tltnxf3oydop  an i s)srxrxopny4ome mfci t) 2umxrp;u0opxo f3ilt aDum(mo u)artrxr iadopDrln i s)t2toio ny4alee nciat) 2tmxrpnt0aeenii3iaslm2el(vp;u0trxrir3tytomt auvol(  etoxm nodlp e fciatfsDur(m ou4tetomfciat sDuluvs;u0 eeomr3oatfatelneo;s  rxoio iy1lm nlnvi sf 2um(rpoo1ole  fctas a ulu o;(0 etoxfcoadlmte neo;()t2uriopnu4lptnmics t s2tr(r nt4tle mf3ildlsDeln pn()tlenmfcia1lmDe nes s)trxmxo3oo4op nmfcs ( aDra(rono1tptn ieiyd m elnvs u0aexnxfcoa1oaD  u sl( srxmxr3ny4lptnmnei t arurxr ;u0oeenmoeilsfa rl( ont)tlxnirctodfmDe u s;t seto(r iy4ap  lfetls s2umu  no4oleo ociydls2el(vs;(0texrir iy1late u olt)s2to(o iy4om   iciat)sDtm(ronu0optnifciadfmDrmnmo u0
\ No newline at end of file
@@ -0,0 +1 @@
+u ilt  rumim nodalen iei s)aDtau o;t0tltomi3tat a2ran onu0 leomrciadfmte nvil() 2umxr nu4amen fctls)s2ururpou0aexnifetys a rl( o;t4 rxnmr3tadla  lnvsls) etoxopiodopt lfcias  rrm(mooo0oex  ociys s2uanvs u0aleoxo ta1fmt ln i s  2trxr3nu4opt liesa(farurxmp;u1ape ifctldfm2uauvpn(0 exrmf todfatr iei t0 rxmio3no1am elnetlt  2tm(rpou4alen oeiat mDrmuvs t4 lxomrctatoatrlivslt0 etr(rpiydalenmivtls) rtrur ot1tpe mfeiysfm uanvonu)trtnxo iodfa  aivi s) exoxo3no4amt mnci s aDurxr ou1oetomietadla rau p () rxnxociatom  liei;()trtrim3iodol  lfes t sDuru  ;t1ape mieiltlmDrmn p u0tetrio oodfat aueolt0 2umio ou1om nmict sfsDra( ono0alxo oetydls emumsn() renxo iotfpt  n s t0sexo(mpoudop e iciat)aDuax  ;u0tex ifciaslm eau sn(0aetoir3ty1fm raueo s  2trxr3no4ole  net s)a2trum nt0optn feiatls rmu s t)altrio ty1fmtraueolt0t2umxrpoy4optemnvil(faruaumpoo4alt moeiltfsDum( p;t)altnmf3oo1laD  ieo;()trurir iy1om   iesatfsrum(r ;u0opx  oeiltfs ul( pnu4altoif iy1fa r n i;t) eum(o oydlptn ici (  rumu pnt0ole ioetas a2em( snt0tetomfctytla e nvol() etoim iydoltemfvsl( sDtmx pno1tetoiieiltfm2uan sn() lerif3ia1la   nes;(0s2umxm3iodal e nes (f rrmx oot1oexn i3iyt aDrmnvsnu4tlxnmf3iydlm e neslt  2umio3io4ol  micsat)a2rm(mono4apen ictysfmDeauvp u)arxrifctydopDeanes t0t2tm(m iy1ap nlictl(fsrrmu pot1tpxo ociyt aDea(vs;u)altoio oydoa eluvolt0t2tmxr iudale lnetat aDtax p;t1tpxomocils a ea(vp t4 leoxf ootopDe n o;s0 etoxm3iy1op elnct s)sDuaurp;t0tetnmocilsfsDeanvo t4artoxr3iadla eai s () exmxrpno1om nlfcia( s2rau o;o0ope mo3tatls2ea(vsnu0 exnmfcoy1lmtrlu i;() etm(r3nu1ope micslt) Drau  ot0tpe  o3ild s uau s;u4tetrmr3ty1fatelneslt0 ruoxrpiu1lmtnmfvs sfs2uau ooo1alx  ociysfs ulums;u4artrir3oytlatelu o;t0sruoxo3nodapenlnvi s  2ta(roou0tpxnioeiysfa um(mp (0 ltomoctytomt anvols0 2triopoo4opt mnesl(fsrraur no1aexomoeias mDranvp (4aeenmfcto1lmteln o t)truo(mpnudlpt  fctas)a2tm(m ou0ale mfcils s ulnvs;t4teenxrciydop elnvi;() ruoio3nydap   fvt s) Duau ono0opxnmo3tyd mDumnmp;()arxnmfcootoa rauvo s) eur(opnydlp nlneilt a2tr(roou0openmfeiatfs uanmp u) lxrxocio1om elneil( t2xo(r oodlm nlivt sfsrtrxro;u0alt io3ilslm2ea( on(4alerxf3ia1fp rauvilt0srxoimpou4omenlfes (  Dumxrp;o1aptoio3iytfm rm(vs (0trerxo ootoptrli s (  rtoio3nydolt lnvslsf Dua(m oo0tex ioeiat s ranmp t)aetnxocoa1omDrlu ilt sexmir3oodale mietas arumxrpnt0tlto iciydlm um(msn()aexnmr3tydoptrlnvolt0texmio iu1omtemfes s srtmxmonu4aee  f3ild aDemnmo u0tltrxo iadfm eaueil(0 rxrim3iy4llt  nvil()aDtrum ou4ale ii3ilsla2ranvp;u0 lxrmocoodfa rlu il(0sexoxr iodaltnmncs t) rrm(mont4tltn oeiasfs rl( o t)tltrxo3tadoa eluvo;s)texoxopnu4opt  ncil()s2tmumo;o0apx  fciyt s2ra(ms ()arenmfcoo1faDraivi;s) rtr(r3ou4ame  ietls)sDtmu pou4apxnifeild sDemnmo;()trxoifctatlatraieo;()setmim no1ol   ncsa(  2urxrpnu4tltomi3ildfaDul(msnu4 rerirctodlpD luvi;()tetrxr3nodameemivtas  rra(mono1apeoiictldlaDranvp t)tltoifciotop  lu o s setmiopnudlpe lieiltf 2ta( p;o4openmfciytfs rauvp;t0arxrxr3iadlm  aneilt0t2tr(mpio1olt mictl(fsrur(m no0oee iictldla2rm(vs;u)trtnmr3ty1lmte ivsl( srxo(rpio1om n nesasf 2rm( oot0apeoiociadfsDranvpnt)tlerxfcoy1lmtr ivi;t0setmir3iudam nlivilsfa2rrxmp;t4olenmo3iyslsDulnvp u)texrirctatfat  uvs;(0 exrim3nudlmtn ivsltf 2ua(r ;t4tlx miciydla2ea(vp;u0 rtnir iodop  auei () etmio iudopt mivtasfaDtr( o;u1oleomiciltls umnmpnu4aeermr ootlm  lnvi t tetriopno4aptnlici s  2tr( pno1ale  i3tldfa2rln onu0 exrxfctotfp r u ols0 eur(m3oodlltelfci sf rum(  nu1tpt  feiytla uln o ()alerxfctadlpteanvols srtoxrpoy4ll elfesa( a2taxr nt4opt  ociydla2ulump (0arxnmo oydlpte nes;t0 2xoim iu1lle  feslsfarrmumont0oltomoeiysfs2umn p (4 reomr to1op rlivo t)teur(r3nu1lpte fvsl()sDuauronu0aee mo3tyd mDeau o t4aetnif oydoatrlnvs s texm(r3nudllen ivs ()arur( oou1teeomfctltlsDrlu p t4areoxrcoadlm rlivs t  rto(opnydlltemivt ()aDraxm ;t0alxnioctys s2elump;u0altrxr3tydfm  aueo;t s2umir ou1apenlnesls  rtmurpoo1apenmoctadla eluvs;u4tlxrio oadopD  iei;t0 etoxo ou4ap e nei (fartaurpot4opx  iciad mDranmo (0texomo3tytla r neo;t0 rtoxr ou4alt mnviatfsrtr(rooo0tptoifetat aDel( p ()aexnxf3tytlmD li ils)trxmxm3iydape mfeia(faDraum ;t0oltnifciatfa2em( o;t) rerxo ta1opD anvilt  etoio3no4op nmfvtasfarraurp;u1altnioetasla ea(von(0 renxfctatfaD luei;( truoir3oy4lmtnmfvils)sDuaur ou4oltniietlt m2rau o u0alenifciatoate ieol( s2tmxm3oydlpe mnctlt  rtrx oot0aetomieiytfs2um(mo t0 exniocoatlpDelues s0t2xm(o3oy4apeemfeta(f rua(r ou4aet mfctatfs ra( o;()aetomr3oytlaDeauvs t) eumxo no1ol nmnvias  Drax ont4optn ieiatfs ulumonu) eeomr oo1lp raivo;(  etmxm iodoleelnvs t) rumu poo4olx ifeiltfa2eau s u)tlxnif3iy1fat aieo t)s2tmirpou4ameemfcsat)s2rrxrooo0optniietatla2rmn o;t)trerxrctodfmtelues ()t2uoio3iodoptnliesas s2umu onu0tpenmocilslsDelu p u4 reoio totfptrauvo;s0 2xmxm iydlltemivsa()s2uax  ;u4alto ieils aDrln snu0tetrxocoa1optrlivsls  euo(r nu1olee neiasfsrrau  ot4oltomieildlsDua( s t4 renxrcto1lat an sl() etr(o no4al emfetl( sDra( pou0open f3ils aDua( o t4tltomrcoo1fpt lies;s) rtoxm3ny1alt miet () 2rm( onu1ole mf3iyslaDean onu4tlenifcoydop rlivolt sexo(m3no1om n nvilsfarurxroot1tetoiieiyt m2uanvp t4trtnif ia1lpDran o;(0srtoim ny1lm n ivia()sDta(m ;o4texoiictydls2ul(vp;(0 eerxo3iydfpt luvs (0truoio3nydapee nct s) 2raur nt0opxnmi3tls s uan snt0alxnxo3iadfmt  iei;t0trxm(m3ou1alt mivi s a2tmxro;o0tptnio3iadla2uan ont4trxnmocoadoaDeln o t0texr(r3no4lm nlfetlsfaDtm(rpot1oltn ocilt a emumo;(0tltnircoo1opD  nvolt  rtrxo3oy4lpt  ictltfa2rmum ou0oex  oeiasfmDulu o u)trtoxr oy1fmD  nes (0srumim3oudll  lfesls srrax  ot4aetn f3tyt a emnvo;t0texoxo3oytom raivs;()sexmim3nudap nmivilsf Durxm ;o0olxomfctadls elumsn(0 etrio iatfaDeauvslt  eum(m3iy1lp n nvs t) 2um(  oo0tlto ictatfa2raumpnt)teerxocoydla   ueo s0srxriopoo4ol   fcs s sDtru pot4opeoif3iytfa2rmumsnu4aetomr3tadlptrai olt  2trxmpoydalenmfetlt a2tr(rpnu1altoii3taslm elnmp t) renxr tatopDrlues s t2urxrpnudllte fct ()sDuau pou4teenmf3tyt mDul(mon() reomocootlp  aies t  etm(o no4amte ictlt)aDurx  oo4tee  fciydfm2eanvpn(4tltrxr3ta1lpDeauvols  euo(mpio1lm e nvsls)srtaump;t1tetnii3ilt m uan o;u0trerif ootfat  neslt  etoxo3oudaltemncil() rtr(mont4tpe mfctlsfm ra( p;(4tlerif oytoaDe n s (0t2ur(r3nodol  mnvil(f 2ur(mpou1texniieildlm2rmu o;()trtrif oodopt ln olt)texoxopiudopte fvtlsfsrtm(r nu1tex iicias m2rmuvs;(0arxnxrctydfatrli o s) ruoxo3iydlmtelivtlsfarraur oo1tee  feilsfaDulnmsnt)tetrxo oo1faDr nvs s)teum(o oodamenlfvi tfaDrmx ooo4apxo feiydfmDrmuvp;t4tetnxo3oy1oatr nvi s0teurxr3nydalt  nesat  ruaumont4apeomoeiydfs ua(vp;t0aeeoio tatlp r ivo;s seumxr3ou1om   icsasfartrx poo0oltnifctldfm elu s (0 etoir iotopt livs;( t2xmio3no1lm emietasf Dtmu  ;u4ole if3iysfa2ranvon(4aeerxocoadlm eluvi;(0trur(o io1lptemfes (f 2tmum ot1alx miciad aDulnvp t0teenmo3ia1oaD li o;(  rtoxr nu4alenlncsls  ruaxmpnu0apxnif3tysfs2uan snu4 rtrxo iodlptr nvi;t)texm(r3ou1altn nctl() rtrumooo0tpe mo3iydfaDelnvp;t0 leomo3iadlm r i i;s) euo(o3iu4op elncsat  Dtax pno0aptn f3tlt mDrmnmp;t0trtnxo iy1fmDe neo t0texo(r no4ap n fctatfaruaxrp;t4apt mf3iaslmDuln pnu) rxnmo3iy1fpt  ivolt0t2xm(m3ou1lp nlivtat sDrm(rpnu4texnmieiatfm2eluvpn(0tltnmf3oa1opDeau ols) exo(m no4aptemfci () Dur( o;u4aex  ocild sDemn pnu)teeoif oatfatean slt0s2uoirpnu4ap   nvsasfsDraurp;t1tpxnmociys a emumo u4 rxrmfcoatlpDeaueils0s2um(opoy1lpe mnet s)arum( p;t0tpenmf3tas a eluvo (4alxnmf3iadfat au o;s  rur(rpiu1alt  ictl()arumxmooo0opeo f3iltfa2em(mp;t)arenmf3iadlaD an ols)seto(rpnu1ap  livsas) 2uaur no4tpx ifetls sDranmp;t)trtniociadopDraivols s2trxmpnydlp  mies (faDtauro;u1alxnmi3ilsfmDelumo;()tlxoir oydfpte uvs ()s2tm(m3iy1al e fet sf 2tmxm ot0opxo fctytfs ua( s;u0artoio io1opD luvo () 2uo(r3ny4op e fvi (fsDumxr ;t0ape mfeiyslm2em(vont4trtnxfctatlptranesls setr(opiu1openlietat)aDuaumoou4alxn oetas a2em( pn(0trtnxo3iydomDr uei s0setmxo3ou4lm elncia( aDuaxm nu0oltniieiytfm2ulnvs;t)aeermrctadlpt  ues ()texrir iu1llt  fctat) Draxrpoo0olxoioeiydlaDum( o;u)alermr3iydomt ai o t)t2xmxmpno1aptnliet s a2tmum ;u0tet moctadfm2ua(vo u4altnxf3iy1lmtr nvil()t2um(mpio1ll nlfes s)arrm(rp;u1oeeoiiciyslaDemuvs;(0alxoxo3todfa  livs () rumim3nu1apeemiviat sDuaxm nt0oeeomo3ilsfa eln s;t) rerircoa1late i i;t0seto(mpoy1lme  fvtas srtax p;o1tlxn ictasfa2rmnvpnt4arerif iydfaDe ueols  exrxrpio4opt  iesls)s2rrump;t0tlt moeiysfa2em( o t4trermo tatfa  lnvs;s)teuoio iudale lfvi (f 2taxm no0ale mfciyt a elump u0tlxnmf3tadlpD lueils tetmxo ny1olen nvtl(fa2trurp;t4oeeo f3iytfaDrm( p t) ltrirctydfateluvo t seurxopio4alee nei (fsrta(  ou0ope mocilslaDuanms u4aetoxrcty1fate u i t0 ruoimpnydap nlnvt s  rta( p;u4apeomf3iydlsDrauvon(4tlxoxo ia1op   i s t)tetr(mpiy1alee ncsa(  Drmx pno0tpe if3iatlm rmuvs u0artniociodfptranei ( srxoirpnodole mivsatf 2tr(rono0tlt mocildlsDrl(vonu4 reomo3io1fpt ai i;s setmir oydal  lietat) 2taxro;t4apt  iciyt s rmump u)tetrxr tadlmt an s;t tetoir nydlmt lnvt sfsDtrxmp;t0tpto o3ias aDraumsnu0texnircoydlpD au ols  euoirpnydllenmncta( aDua(mp;o0tle  f3iltfm em(vp;u4alenmf oa1lm  ai il() euo(rpiy4ap nlfcs t a2uaxr ;t1oeeoioctldfs rln s (0 rxnxfciotlpDeluvslt) 2xmir iu4omt lnvta(f 2rr(  oo1opto fetysla umn o u) rxnmfcoy1omDeli o;t)t2xrxr3iu4lpeemnvt t a2rrx  ;u1olx iociytfa2em(mp;u4trxrxf3oa1omD lnei;s0trurxm3ny1omtnmfcsasf 2tm(r ;t4apeo icildfa2eau p;u0 rtnmr3io1laD  u o () ruoirpoo1om   nesls)s2raum oo4texniictytls2emu snt0alerifcty1oaD  uvs () etrxo3oo1optnmfcilt) Drax ooo0oet mi3iad a2rl( pn(4aetoxoctodoa elies (0t2xrim3iydlmtemivilt a2ra(rpnt1oexoiictltfmDul(mpnt4aeerio3tatfpDr u o;s)sruoxm iu4altemictat)sruru  nt4aetoiietas s2rlnms t0 etrxf3io1op eanes ( srtrimpoo1ll  mnviat srtmx ooo0tlxnioeiytfaDulnms;(0alerxocio1om  luvs;s0sexr(o ny1lm  lics (fsrrr(rp;t1ole  fctasfa2em(vp (4trtrmf iy1lat an s;() 2tmxo3ou1lmt  ivtatfsrtaur ;t4opxomictls m ul(mp;u) lerxo tadfpteaivs;t)teuoxo3iydopte ivtl(f Duauroou0tet  fciatls2umuvsnt)artoxr ia1omtelnvils  rumxo3iodllenmictatfartm(m ot4oexo feiydfs umuvp u4 ltrxo io1fmD  ivi () 2xmio3oudlpe lfetas  2umuront0tpenifctltfm rlu pn(4trxrxo oytomD  nes t0setm(r3ou4alen fcs t srtrx  ou1tlenmociytfsDeanvpnu0 lxrio oydlmt liei t0 rxo(mpiy1lp   net tfsDtaurpnt4olx mictltlm elnvsn()tltnmf tytlat lneilt)srxr(o oodaltnmivilt arrmxro;u4olxomfeildlaDrl(vs;t)artniociotomtelu sl(0tetrxrpiy1ll elfcsl( s2tr(r ;u0tetomo3ild mDrm(vo (4alerxo tytfpD an slt0 2um(r3oydale  fcsl(fs2tm(mp;t1opxnifeild m2ul(vs u)teermo3oytlm  anes () 2xoio oy1op nlicias  Drr( o;t4apxomictyd s2raumpnt)artrxr3oadoa  lnei s0t2trim nodomeemietl(fartr(rpot0apxoii3iltfs2rm(mo t)tlxnifciytomtelu ols0 exmimpiodap  mictat srtr(mont4aeen f3tas aDul( p;()tleoxociadfmteli sls)t2umxo3ou4ape lnviasfa2taumo;t4apeo i3iasfs rlu onu0 eerio tatop e i olt) rumxm3io4olteliciltf 2ua( onu0tpx  feiysfs2emu o;u4 rtnxfciodoat  nvols0t2toxm3iu4ll n nvtlt)arrm(mp;o4ape  fcild a um(ms t) rerxr3iadomD li slt  2xo(mpou1llenmivi t  2tr( onu4tle  i3tyslaDemu s;t) eeoxf3iatom e u o ( teur(o no4aleemncias)a2umxrp;o4tlt if3iyd mDrmuvp;u)teenxo iotoa e uvs;t setm(m3ny1ol n fctl() Dtaxrono4aeto feiyslm2rl(vp u0trxoxfciatlpD  ivsl(0t2xoxr3ny4alt mneiatf 2ua( onu0tltn i3tasla2umumpn(4alenir3oodlpD  ueils0sexo(m io4lmt lfvslsfaDtrxmp;o4tpe  oeiydlmDulnmo u0 exrxr ta1om rln sls)srtrimpnydom elfvia(fs2rru p;t0oexnmieiadla ulu onu4arxoxf ootoaDeaues;s  eur(r3ou4lmt lfvias)aDumur nt0olt iiciys m2elumonu0arermo iatlpDr ivi s seum(o3oo1openmivia()arum(m no4olen iciysfm ulnvo u4 exoircoa1oa r n i;s0teuoirpoydol n ici ()a2tmuro;t4opt ifeiad a2rm( o (4alenxf iadoateaneo s texm(m nu1lm nlies tfa2tmuroot0tle  oeilsfa2rm( p (4 ltnifctotfmte i o ()s2uo(opoy4llenlncs s) Drrxr ot4tetniieiat m2rm(mo (0tlxnxrcto1fptran sls0s2ur(r3oy4omtnlnvs (fa2ra(mpot0tptn fciad s2em( onu4arxoio oatopDeli o t srum(mpno1amt  fes tfs2urur ;t4tee iociytlmDrl( snu)teeniocoy1fm eluvslt)setmimpio1lm e fvilt)srrrumoou1aetnmo3iysfaDelu p (0tleoirciy1lmD au ils0t2urxopny4lm  mfcs tf 2trur ;t0alxomoeils m2elu pn(0tetnmf oytfp rli s;s srurxm3iy4am nmiviatf rta(mp;t4tpeo fcias s2el(vs;u)alenmf3oodoatelues s)t2umxo io4apt  fetls)artm(  oo0olx ii3tydlaDrm( pnu4alxrif3tydopt lnes (0trxmxo ny4lleemncil(f Dtmu  ;u4ole io3tat aDrmnmp (0aeenio todlpt ln ilt0t2tmxm3oodlpe lici s)s2urur no4tex ii3ilt sDrlnvs;u0trermo todlp eluvsl(  2toir iu1omenmieias s2rru  oo0tltn fciad aDum(vs;(4 rtoircio1fp elnvo ()sruoxr3ou1ap   fvias a2trxm ou0aptoioeiytlm ulnvs u) rtoxrciatoa e ueo ()seurxmpiy1llenlfvs ( sDua(ront4alenmociadfs2em( s u4 leoir3tydlpt luvi;s0trxrxr oo1olenmnes s)artmxm ;o1altomi3iadlaDrmu p;t4 renxo oo1op raivslt sruoio3iu1alen iei s) Dtmur ot4alt mi3iltfsDran p;u4alxrif iodfmte u o;(0trtrio no1aptnmies s) Dumxr no0tpxnmiciyt sDeau s u4teenxocoa1la rlivol(0seuoir3iu1lmee fcta() rtrx p;o4olto ieilsls2rl(mp (0 renmrcoodlmtr u o ()trumxm3oodlleemnvtatfsDtax poo1apt iociyslmDrauvont0 etrxf oytlaDranei;s  eurim3nydaltnmnei ()s2ua(ronu4tlen ieiasla ea(vsnu0aeeomrcoadfateaivs s) 2to(rpnu1lmtn feta(  2taxr oo1opt moeiys aDul(vsnt0aeenmr3iadop e uvs;s  exoiopnudam nliesls) Dumx  ou0apeomociatfm2ea( pnu4artomf3oy1fpt  i ils)t2xr(o oo4lm elivsls  Dtrurp;t4tpeoii3iytls rlnvp;u4 rxnmo oy1lpDe uvs;( s2toxmpnydal nlneta()aruax p;o4ape  oeiadfa2emuvo u4altnir tytlm rli i;s0srurim3nudam nmivs s s2rmx  ;t4aee ifetasls2ran pn(0aeeoifcoydfmtr i o;t0trurir io1lmte ncs sfsDrru ono4tpe iietysfm uluvp;(4texrio3iytfmteauesls)trtmir3ou4om  lfvs sfs2tm(rpot4alxniieiaslaDrmn s u0teenmr3tydlm rlivo;() 2uoxr iy1alenmietls s2ra(  ot1aet mfctyd mDuau pnu4trtrxr oodlmDr ueo;s0seurimpiudlleemfvsatfsrurump;o0tpeo feiltfa2elnvo;(0 ltnifcoo1opt anvsl(0teurxopnudlltn ncs (fa2uaumooo4tlx  ictas m2rlu p t0alxrmo iydfateluvi t)trxmxr nu1llt lnet (f rumurpnu0tleo ietatfa2umnvsnu) rxomr oatfa  aueo;t srum(r iu4om elietltf Dur(r nu1olx  fciydfs rl( o;t) rxrio ty1latrln i;s0seumir oodap  lnei s aDuaxro;u1alt  fctydlsDul( sn(4altnxf ty1lpt lieo;t)sruoxo3ny4amtemictlt)a2tm(rpno1aeeo feiaslsDumump;()tltoxo3tytfmt  u ol()trxmiopoo1omtnlfetls) 2tr(mpnt1olx ioeilslmDea(vsnu)tlxoif iadfp  lnes;t  2umimpoudal   fcs ()artr(mo;u1aexn oetltla2el(von(0altrxo3tydfpDrlieo;s0sruo(o iu1lmen ivia()srtr(  ;u1aetnmf3tydls rln p t4trxnmrcoadfpD ln o;()trxmxopiydlp emfvs t)a2rmx poo0tlt iociytls2emnmon(0aexnxr iy1om eluvi;t0t2urimpiydam  lneslt) Draum ou1oexn ociad a2ranms u) rerio3tatfp rauvo;s)sexoxrpiodopee ivsls srtaxmo;o0opeo f3iysfmDeaums t0aexrxfcto1lmte ivol()srxmir iu1lpe  ivt (fsDrm(mont4tpe mi3tltfa rlu s u4teenir io1faDrlnvs;s)teuo(r oy4omenlnvia(  rra(mpnu1tpe mf3iadfm2eluvo (0 eerir iydlmte nvols0seurio3iy4op  lnci tf 2trxm ;u0olxn ictydfmDea(vp t0 rtoxoctydoa e uvo;( texoxr3iy1lmt lnvi tf rrau pou1olxnifeiyd aDuan p t)arxnxo oodlatrlivils  2triopnu1am emfcsl(fa2ta(rp;t4oltnioctaslmDea(vp (0 renir3iadfa  luvs;()s2urirpio1amen fcil() 2rr(m ;o0alt  oeiyt aDulu o u0aexnifciatfp   ivi;t)tetm(m3iu1apenmivt sfartr( ono0altomfeilt s2em(mpnt4artnxf3oodlpDelieils0 rto(mpoo1ap   fvtlsfsrrmump;u1aexnmocildfs2elu p u0aexrmo3oadfp r ivi;t0s2uoim oy1al n nviatfsrra(rp;u1tetomocilsfs umu s (0 rtnxrcootfate neo;( trtoiopnu4lme mivils  rur(rono4olxoiociltla ulnmp t)artoiociadlaDraueslt0sexm(r3iu4lpee fvil(f Drrumoou1aeeoiieiadla2umuvo;t) rxoir3tadfmtranei s t2xr(o ny1lmt micsa( sDra(  no1olxo o3iltfs2uauvp t4aeeomrcoodlate ivo;( sexoimpoodome lics ()s2umx o;t4tpx  ictydfm2eaumpnu) lenmociatfaDrluvs t0srtrxr3io4al nmnvtlt)arraur no0opx mo3tas aDrlnvs;t0aleoio3totfa r u ol() exr(mpnudamtelnvtatfa2tm(roou1apxnifctldfmDuanvs;t4 exrifcto1opteaiei;(0s2tm(m3oy1opeemnesl() 2rrxrp;o1opxnmoeiadfmDelnmo;t) lxrxf3totfmD aieo;s  eur(m3iy4om elicias srtmxro;u4tptomfctydfs2elnmo;u4 rxnmr3oytlp eai ilt trtoirpnydopenmnetas) rrmumpot1tpx ii3iltfaDulu o u4aetoxr iadfaDrlnvo s0sexmiopno4opt  fcta() rrmuro;u1oeto ociyt aDrmuvp u0 renxr iodfpteaivslt)t2um(rpoo4ol  mnvi sf ruaxmonu0tlxomietadls uln s;(4tleomf3oa1fa rau s (  rxoxmpou4oltemnviatf rtruroot4teeoiictysfm ua( s;t0 ltnxocoydlpDrlues;(  ruo(rpio1olt lfvslt  rtm(m ou4tetnifciasla2elnvpnu4texrir to1omt  uvs;t  ruoimpoy4op n ici tfaDrmurpou0tlxomfetat a2rlu snt)teerxf todop  lues;()trurxm iudolen fct s aDtmxr ou0texo o3iytfa2emu s;(4trxrifciydlat au i;t)texmxo iydll  lieilsfsrurum ;u0apxoiiciytfa eauvon() renif3tytopt ln ils) etriopiy1am emnvil(f 2rmxr no1aexnif3ilslmDemn s () eenio3totopte ivol(  2xrxm3no4llt lncslt)a2rau o;t1tlt ioctysla2uanvo u0tlxnmocta1la  auvi s)sexo(o3oydom emivsl()sDuau  ;t4tetn f3tytls2uauvpnt4 rerxo3oydoateln s () euoxopiy1lptnlnesltfa2rr(  ot1tlxomfeiad sDea( on(0altnxfcoadlm e nvo s0setrxrpiu1ol nlfcs t)srrr(  ;u1tleomi3iadlaDum(vo u0 exoxfcoy1omteaivilt  rxrxm ny1ap n ncil( s2uru oou1opx mictadlsDrm( p (4artrxoctydfptrlu i;( trxoxo oodll nmfvtat) 2taxr no4oee  i3iaslmDumnmsn(0trtrif oatfpD lieolt0 2uo(o3nu1altnlieias sDtmum nu4teeoiiciatla rau p;u0texoif iydlm  aneilt  rtrim3no1op  lnei ()a2ua(rp;u0ope io3tls s2elnmp t) renifctytfaDr uvsls0t2uoxo nydaltnlivt ()s2uaum ;o1oeeomi3iys s elu onu0aeermo3ootlmte nvi ( trtrxmpiu4altelfct tfaDuax o;t0teenioctyslmDum(mo;u4 eenif oytfptean s t t2xrim iydome lncs s)aDtau pnu4oet mf3tadla emuvo;(0tetrxr3tytfmtelueils)s2xo(m no1aptemnet t) Durx o;o4aex  feilslm ra(vo ()texrmo iy1fpt  u sl(0t2uoxrpoydope mnvt (f 2urx  nt1optnmieiydlmDuln s (4 rtoxr3oytfmDraueolt) rxrxo nydalte ivtasfsruax p;t0altoioeilt mDuanvs;u) lxnxf3oodfa eanvo;t)t2xm(rpio1amtn ieilt)srtrumpou1aleomf3iasfa2rm(mpnt0alenif iotom rlu o;s s2umir3ny4lmt mfeil(  ruaum oo4apeoioeiydfa ul( pnt4aetoxfciadomt aieols)setoir nydllt lncsat)a2tr( o;o0olx  icild sDranvo ()alenir3oy1faDe u o;s  exo(m oy1lp  lnei s sDrrumoot1oet moeiad s eln ont)alxoif ootomt  nes t) eumio oodap e ncs ( arur(mp;t4alxnio3tysfs ulnvs;u4arerif tydoa ranes;s s2xoiopoodole mfvt sf Dur(moou0openii3iasfs2rlnvpnu) leomrcootlaDr uvolt) 2toimpiu1lpe lnei (farurum ;o1apx io3iysls2umnmp (0tlenmr oo1fm eaieol(  2ur(rpio1ll e nvsa( srumurono1opxnioeildfaDrm(ms u4trxnxr oadfaDelnesls0 2xmir iu1ll   fvt tfsrtrurp;u4tpenioctytfs eanvp;u)tlenxo3iadfp rlu ols  rum(m3ou4omt licilsfaDrrumonu4tetn fciyd a umnvo ()artnmo3oytopDrai i;t  euoirpiudlm   ici s aDtm(mooo0alto oeiatla ulnmp () lxoxr3todomteluei ( s2tmxr io4ap nlivs s  Dtau  nu4texnii3ilt m2rmu pnt)artoio3totlp eluvo;s seto(rpoy1apeelieiltfa2uaxmo;o1tpe ifciyslaDemu s;u)arxrxrcoy1opDraueils0 rto(m3nudal  livsls) Drm( o;t0opxo ociytfs ua(ms;()aexoxfctatfpDe u ols0trum(rpiu4lme mivi sfsrua(  nt0opto iciatfa2um(mpn(4aetomr oatomte ies s0teurxm ny4lmen nci tfsDtruront1aex  iciadfsDea(mp;t4aexnxocoatlmD lnes;t)texm(o iy1al elnct s)srtaxronu4oexnmfeilsls rmnmo;u)tltomfciatom   nvi s0 euoxopoo4lmt mfcslt artm(  ;o1oltomfcild m2rau p t)arenir todfmteauvi ()trtrxrpoy1altelfctas) Dur(r oo0ope  iciydls rluvsnu) lxoxf3tadoa  auei;s)sexoxr oudamt  nvi sfsDtmu  nt4teeoioctytfa rmnmp;u)aexrif iotoaD  uvs;t s2xm(r iodop  lnvils)srraxrp;o4aexoifciadfa rmnvs;(0tlxrif ootlmte i s;t trtr(m3oo4ome mivil() Drmx  ;o4tpxnii3tytlsDemu pnt0 etnif oo1lmDr ueols) euoim3oy1ole mfvs s sDrax p;o0teeo iciat m uaumont4arxomo3iadlm   ivi;t t2xoxo no1apenmnvsatf Dur( o;o4opxoifeiyd m ra(vo (4trxnxo3to1om  livslt seumxopoodalt mneia( s2rax poo4tetoiiciytlmDemumo u0trxomf todfmte ueols t2um(m iu1ll elnct (fa2raurp;u4opt  o3ildfsDran sn()aeenmf3oodoptrluvo s  eumio3io4amtn fvi s s2tax  nt0tptomociysfmDrm(mont)teermfcoo1opD lneo (0trtrim3oudale mncta(f Dtrx oou1alx mi3ilsla rm(ms (0teeriocta1fptelies ()texmir3no4openlivs s)sDtrxr ;o4texnmfeiad a em(vp;(4texrmo oy1fmt anvs ( seumxmpnu4llenlnvt tfa2rau ooo4tleo f3iydla2el(msnu)tlenxr iy1fm elnvs ()tetoim iudomtnmfei s  Dra(m ;t0alx  i3ilt m um(vp u0aetoxr oydfmDeanvolt) 2xmxmpoy1lltelivt (  2tm(m ;u4aptomfetltlm2rm(von()trtnif3iytomtr uesl( tetoxo3ny1ll nlnes ()aDua(  no4tle iiciadls2emnvsnu0teenir3oo1opDeauei;() 2to(opoo1lp elivil()a2rr(  nu4aetnmieiatls emu pn(0arxnxr oa1om  au o t)s2toxm ny1olt  ictls)sDtr( oot0teeomi3iydlmDrln p u4arxnxfctotomt aueils)tetoirpny4ll   nvtlt)s2tmxmooo1tleomo3iat s eanmpnu0 lxrmrctatomtrai o;(0 rxoxmpoo1opt  icta( sDtrxmpoo1oexn o3tydfsDel(vs;(4trermr oydop  lnei;s0seto(rpio4lmtnlfetl(  2tm(rpot4oet iociltfaDrmn p (0alenir oo1fmD  neo s t2trim3io1lpe lici s s2rrum nt4tleniieiyslmDulnmp;u)treoir oytlmDe uvs;s0s2xoxmpnodaleemneilsf 2rrx o;o1aexomo3ilt s2ulu o (0arxoxr io1opt  neo;s0 exrxo3oy1lmeemicsasfsDuau ono4alx mocildfa ea(vpnu)tlxnir iydomtraivi t0trto(rpnodom emnci (  rtmxr ot1aexnmoeiasfaDum( o t4aexrmo iotfm  aueo;(0srxoxm iu4om  mnvsat) rrm(m ;u4tltomi3tysfsDeau sn(4trermf iadfmDe i ols)texoxr io1lptnlfetatfsDtrur nt4oeeomf3ilsfm2elnvp t4 eerxr3iatla eluvi (0trxm(mpiy4lltnmnvsa(fa2uaumont0tpeo ieiad s el( p (4trxoxf3ty1oatr ivo;s  2toimpoydlp  lfes sf 2raumooo0opeomfeiyd aDua( p;u4aexnif3oo1lat liei;s s2trir3iy1lleemneslt) rum(ront4tlx  oetytfaDuauvsn(4 reoxrctydfm   u o;s)srtr(m oudap  mnvsatfsDrrxr ;o4opxnioeiyslaDea( s u4 rxrxfcia1fmte nvi;s)srtoxr3ou1alt  ivta() rrrurpot1alxo fciys aDuaump;u0tetomociydom  luvs t0 eurxm iu4ameemivtat  rurxrpnu1tpe ii3iydlm2ulu p u)tlerxrcoa1omDe uvolt0seur(r ny1lm nlies sfsrurum ;u1ope  feiydfmDrl( pn(0tleomr3iatlpD lues;t t2uo(mpiu1ape licsas  2ua(  ;u0aetn ociadfm rauvo t0 eenmo3tatoaD anvs t) eum(r3ny1lle  fet ()a2urx p;o4tpt iieild s2um( o;t) etrmr3oatlpD luvols  exoxrpio1lm emivtas)srtm( pnu0opt  f3tatls2rmn pnt) lerircio1oa r u s ()truoxmpio1ome  ietls sDtaum no0oet iicildfm2ea(vo t4 renmo iydfpt lieil(0srtmir3iydomte nvils)artau  ;o0ale mieildla eaumsn()texrxocta1oaDr neo t)sexoio3oy1ope lfciltf Dtrxr ;t0aleoii3tad a2rlu s (4alenxr ia1faDr u ol(  rxmxm iy4ll  livslt)s2uaurpno0ape iocilsfsDran pn() rtnxr oytla  li ils)teuo(o oudap e nciatfsrumxrpot4oeto f3tltlaDelums t0tlenir3totop rlivilt0t2xm(r3iu4ol elnesatf Dur( oou1olxomictyd m um( pnt4areomf3todoatr ieilt0texm(m3nu1amte nvslt aDumu  ;o1optoiictyslm el(mo;()texoir3totfp raies;s)srtrirpnudome mici sf rur(  oo4oexomocilt a umu o t4artnmr oa1faDr nvo ()texmio no1al  lics s s2ta(r no4open ictlsla eauvont4treoircoadfa rau olt0s2xr(r nydaltnlnvilt s2rauront0openifcildfs2eluvsnt) rxnif iydfaDran sls0 etoxo iydap  mfvsatfsrtmumoot0tpto i3tytlm ua(msnt4artrif3iydlp   nei;() ruo(opiodam emicil() Drm(rpot4ale mfeias m2eluvs t0tlerif ty1omtr u o;t)trumxr3iudamt  ieils) rrau pnt0tltnioeiyt a ean sn(0aeeoir3iytopDrlueo t) euoxm3iu1lpt  ivtat sDua(m oo0aetn oetld s2ra(ms;u0alxnxfcta1lm  au s s trumiopou4openmfcs s) 2umx poo4ale moeiltfm umumonu)treoio tatom eaivo;t)sexmxrpoudapeelnvsas  Dta(ront4optomoetydla2ean snu0aexoio oatomtrlnvs;s0s2tmirpiudlpe  fctls)artaxrono4olt mf3tad a el(vpnu)artomocoadlp r uesl()t2uo(rpio4amenmnctls)arur(r nu0apt  i3tys mDranvo t4alxnio3tydoatraies s) 2xo(o oy4oltemnvils)artr(mo;o1aeenmietasla2umuvsnu4alxrmr todoa r uvs t  rxmir oodaptn netlsfarraurp;o1tptnioetysfa uluvp u)altomoctodlpt lneo;(0 2umxrpno1alenlfviasfsrrmxmp;t1tpx io3tatls2rmnvo;t4aeeomf3totlm ranvol()trxo(m oo4am nlicslsfa2ur(mp;t4teeo fetyt s2ua( pn() rtrio iytlmt auvol()sexoiopou1lpeemfei (fsDra( ont0oee  o3iytlsDeau pnu) leniocoadom r uvi;s)trxrxr3iy4ome  nvias s2tr(ro;u0altomi3ilsfm2rl(mo t)treoio oodlmDe i i;s s2um(r3nydapen ivtasfa2rrxmp;o4tpeniieiatfm rm(vpnu4 reoxf oo1oa r ies t s2xmim3no1lmenmfctasfs2rmur oo4olx ifeiad sDelumo;t)texoxf tatlp e ueils0 etm(o io1omtnmfctlt) 2uaur ;u0tpto o3iadfs2ra( p;t0 lxnio iadfpDe iesl()tetmimpoo1lmt lfvils)a2trx  ;u1oeeo i3tltfa umnmo t)tetnxf tatfaDrlu o t)t2xo(r3oo4olte fvtlt aDtrxrp;t1tet mi3ildfmDrmump u4trxnio3tatfa e nvs t)t2umxrpou1amee fvt (f 2rmxmpou4apxomfeiaslm rauvpnu0 rtrir3tadfpDe ieols0t2trim oo4ape  fctas aDrrump;u4tle mfeildls2em(ms;()tleoxrcoo1fpDelnvs;t)texmiopnodol  licslt aDua(rono4teeomieiaslm el(mo u) etnmo3ootfaDraieolt0trtoxo oy1ole lneslsfa2ua( o;u0aex if3tltls umu s t) rxomo3ootopD aneslt) exr(m iy4omeelnvils)sDuau pnt0oltoifctat a2ra(msn()texrxrctydomD lueo t0teumxo3iu1ameemnvtl(fs2raum ot0oltomictyd s uau o t) lenmf3iotlpD lu s;(0texm(mpnydopeemneils a2tmxmp;u1oetnioetad m2emn s;(0aleoxrctydla  luvols t2toxr3ny4lmt  nci tfaDrru ont4aptn feiydla rmnvo;()treoxf oydomDe iei;t)teumio3oo4ap emieil(fsDurump;o0tlxnmo3iysls rmumon()alxrxociadfmt auvs t) rxr(mpnudol emncsas a2rmum ou0optniiciydlaDua(vs;u4texnir totom  luei t) ruo(r nu1omeemfvi ( srtaxmont4tlt  fcildfa2eluvo u) ltoxr3oo1fp e n s t0t2xm(o3ou1al nmivi s  rur(m ot4tptn ietysla emnvp;u0aetoir3iatopDeaivi s)seum(o iudol nlici tfs2umur nu0tpxn oeiatfmDeanmpnt)trtnmr to1la  lueols seto(r3iydll elnvsasfaDurum ot4tltomf3tltfa emumpnt0tlxrxo3to1lmDr nvo;t  exmxmpio1amt licia() Drmump;o1alxoiietaslaDrmumon(4 renxrcta1la r u o s0s2tr(r oo1lmtemivsas arrr(m nt0tptnmf3iatlaDem( s;u)arxnxf3iodlat ai s (  eumir3oudam  mnct tfs2rm(r ou1tex  iciyslm2ra(mpnt0arerifcia1fa  aivi;t)s2trir3oy4ll elivtatfartm(r nt4tle if3ildlaDum( o (4treoio ootfm   u sls) 2trio3iodamenlivsasf rrr(  no0alx io3tltlmDelnmo;t0 etoif ootomD  nvi ()t2xoim ou1lpte fcslt a2urxro;t0aet ii3iytlaDrlu p;u)tetomr iadoa elu s;t)t2xrio3ou4omtnmncsa()s2rm( pou1ope iieilt m eln snu)aeenxr3tatop rauvs;t0s2xr(r3oy1lmeelfcs t sDtrx ono4aexo ociydfmDrmn p;t)tlenmfciatop rluvslt) 2xoxrpiu4ame lietlt aDuaur nt0apxomfeiyt m rm(ms (4artnxr3iodfaDeanvs;() eur(rpoydalenlfctl(faDumu poo1tpxnmieildlaDul(mont4trtoir3io1opDrlu s s)trto(rpiy1amt lfctlt)s2ua(rpno4tet  o3ildla2rl(mont0 rermo3oa1optraueslt0setoxrpoy4am  mnvsltfaDur(r nu4tpeo ictlt a ulnmpnu) rtrmr ty1fp  an o;s0s2xrio nodlm  mnci t)arumurpoo0oeeomociadlsDul(mo;u0alxnio todomt li il( seto(o3iydomt  nes ()sDrm( p;o1tptnmfcils s2rmu p t0tleoxocoadfpDrlnvi ( seurirpnu4aptn fvi t arrmx pnt0altnmietld m2ua(mp u0aleoxo oatoaDelivil( setm(opiudopen ncilt)artaum ;o1apxo oetldlsDrl(vs;t0 exoircty1lptran slt  rur(m3oy4am elivil(f Drm(rono1alx moeiadls2eanvo;u)aleomo3oy1omDr u i s)texrir iu4lp   nvsat s2rm( o;t4olen octltfm ranmp (0 rermrciy1omDe i s;s  2xoir3iudlp nlict t arum( ont4tleo f3iasfaDrmn o;u4alermo oydfa rai s;s srtmimpnu4apeemneiat) Dtr(r ou0tpto ociadla2elnvs ()arxoir iadoaDran ols0t2to(m ny4lp   nesa( a2rruro;u0olxn f3iat m ean snu0teeoircto1lm eauvi;(0sexrxo oodapt  feiat s2ta(ro;u1optoiietyt m umu p;t4 leoxocoa1fp  anvsl(0setm(m3io4om nmnetls) 2rrxr ;u4apxo ieiyd sDeau sn() lenxr oo1lmt lu i;(0t2urxr3nudaleelfci t s2raumpno4oexomf3ilt s uaums;u0alxrmoctydopDr u o t0sexo(o no1op elivta(fsrta( oou1alxnmfcildls uauvont0 exrifcio1omtr i i;()tetoxo nudopt mivtl()a2trxr ;t4opxnmfetlt mDuln snu4 rxomo tydopt  ivil() 2urimpoo1om  lfetls)s2umur ou1optoifctatla2ra(mo t)artrxr oytoa rli i;t s2urirpoy1opeemies tfs2ra(r nt0optomfeiytla eau s t4tetomfcoo1laD ln i;(  rtoim3iodamenmfvt t)sDtru o;t4olt  feiydlm rl( o (0teerif3ootlaDrlu ols0seurim oydape  fct tfarrmu p;u4oee ifctydfa eanmp;(0arxnxf3to1fmt au ols) 2xr(o3iy1ol elnet () rtr(rpnt0tet io3iytfsDum(vp;(4 etrmr todlm  anvo ( sruoir oo1aptnliet (f rumx ont4oet mf3tad s eau s;t4alxoxfciytop eln i s0seurir io4al nmivs ()srtmum no0tpx  oetatfsDemnmonu)altrxfctydoaD au sls)trtmirpio1apt mneiltfsDrmum ;t0apto ieiltfa2ra( o;()arxnmoctytfateai i () rtm(o iodlpeelfes sf Dtr(rpoo0tex ifcias m2rau sn(0 reoif3iydoa   u o (0srumxm iu4lp nmivil(f ruru poo1tlen ietlt s uauvonu4 lxoir iytfmDeaieilt0trxmxmpny4lm emnvils  2uaxmpnt0olxnmo3tysls eln o ()tetriociydfp e ues s trurxo3oudlp nmncils arrr(  ;o0apxn fetatfsDumnvs t4 leoif3iytopteaneil(0t2umir oo1am  mfvsls srtr( pou0apt mfeiatla2ranmp t4 exnmf3iotlm elnvi;t)s2urxr3io1lm   ivs sfaruax  nt0tlxniiciltlmDumnmp;u4 rtnif3ta1fmt  nes;s0 rxoim3ny1ope mieias) rtrurono0alt iocildfs2rlu on(0artnmf oytoa e n i t) exmxo3oo1al emnvias)sDrmum ;o4aleoiiciyd a emnvon(0alenifctydlatr u o ()srto(r oydol n ietat) Dururp;o4opxn o3tltfm2ua( s;(0 ltrmfcoo1opDe nvilt0 2uoir nydlmenmivsl(  rtmx  nu4alt  o3tltls2rl(ms;t)teenmf iatomDe ueslt0trur(r3no4lm nlfeiat  2tmurooo1aet ioetldfs2uanvp;(0 eenif3tadfpD lu sls0teuriopiy4openlfeiat) Dumurpno1tex  fciytlm2rmn pnu)trxnxfcootlp elu o s sexrio3oodalt  ictlt)aDrmuronu1alt mfeiltla2rlumo;t)areoxr3iy1opDr i slt texrimpnodolt  iviasfarururoot0aetn i3iydfm2rm( s;(0trxnmf3iy1lm   n o t0setmxr ny4lmee fvta()aDrau ooo0tetoifcildfmDelnmp t0texrir3tytopte nvols0seuoxr ny4ome mfvt (f 2umur no0opx iieiytls2rl(vp t4trtrmr ty1op  auei s) 2xoio3nu1lltnlncsltfarumu o;u4aptniictysla2rm( pnt4teenxo3oadlat  nvo ( sexmimpny4olt  neslt  Dra(  ot0ope ioctls s2emnmpnu0treoif3iy1fa raiei;(0 2toxr iudole  iei sfsrrmu pno0opto oeilt m ua( s;t)areoif3to1late neo;s)trurirpoo1lmenlivt s a2rrxrp;u1oex moetlsla2ean s;t)arenmr3iy1fm raiei s)s2urio3iudaltemncil(fsDtau oot4optoif3ils m2emnms u) etrxr3tatfp r ivslt0 rto(r iu1ll elicilsf Dtru oot4tpxoio3iydfa2ran snt0trxnir3totlmtr uvsls  etm(o iu1lpee iviatf 2tmu ont1tet  o3tydls2elnvsnt)aeenmocia1fa elivi;(  eumxo io4apt mfcsa(faDtr( pot0oexnifctat m2elu s;()trtrxo3oy1lp  an slt trurimpiu4ale mfvsltf 2umur no1optnio3iaslm ul(mp;(0aeeoir oadlmDeaneolt teum(o iodaptn fvtltfsrumxmpoo0tee moeiys a ea(ms t)texoxf iodlpt aivi s0tetrir3io1ole  nct ()aDuaxr ;u0tlt miciadfm2el( o t0tleomf3oatfa r u s;t srxoim oo1omenlfetls)arrrurono1teeo octydfs2ulnmo u) exoir oytlmt auesls)sexrxr3oodalee netls) 2tmumoou4tex moetyslaDrm(vs t) lxnio3ty1fat aivsl()t2xrxmpnu1am nmiviat srrm(rpou0tetomoeiydfaDrmn pnu) rtoxo3iodomt  ieo (0trumim3oodapt lfci tfa2ua(rp
\ No newline at end of file
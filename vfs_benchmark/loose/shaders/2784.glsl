@@ -0,0 +1 @@
+i o t)t2urxrpiy1aleelivsls)s2rr(mo;t4optomoetatla2el(vs;t0 reoxo oatoa ranei s srxrxo3ny1lleemnvslt)srrmu pou1teenif3ias m2ra( ont) ltnxrciadomDe u il(  2uoxopnydolenlieiatfa2rr(  nu4tpx moeiatfsDrmumsnu4artoxrciotomtrlnes;s0truoxo nydame lnctat  rrmx ono1tlxnioeils m2el(mp (0 reoxr oydfpte i ilt  eurirpoo4lmt lfvtls)sDrrxmoot4aptn f3iadlm rlu o;u0aeenmfcto1fa e nvilt trtoio iy4ome mfviasf Durxroou1apenmi3ilt m umnvo;t)texoif3tytfptranvs;s0s2tm(r nu4open nesls)a2tm(  ;t0oee  i3ilt m ul(ms ()alxnxo3iydlmD au ilt)tetrio no1ole mnvs ()aDtrxr no1apxnii3tldlaDumu ont)alxomf oydfaDelivsls0t2umim nu4lme  nvi () ruauro;t0oexomi3ias a2ranmonu4tetnio tydlaDeli ilt)setmimpoydaltnmivt s) rtr(rpno4aetn i3tldfaDrau s t)aetnmf ia1lat aieo;() etr(rpoodolt micsl( sDtm(  ;o4tlxn o3iytlmDrl( p u)alxnmf3oadlpD  iesls  2xrxmpiy1lle  fet tfsDtmxrp;t4apen i3iatfm emn s ()tltrxf tydfmt luvilt srtmxo ou1omen nvtlsf Dtr(ronu4opt  fciadfaDrluvpnu4trxrmo iydfptrliei ( setoirpoodop e fci s)s2rmumo;o0opxomfctytfa2ra(vont0tetnio tytfateaieo ()texoimpiudom  lnvilt) Dtaur oo0oltnmoeiytls um(vpn(0tleoxocto1omtraivo s0 2xmirpiodaltn ietltfsDrm(m no1olto i3ilsla eaump t)texrirciy1oaDran il()teurim3oo1lm  mnci s  Duauroou4aexnio3iydfm rmumo t0alxoxf iodop  lieolt trtm(m3oydop n ncslsfaDua(  no4teenif3ilsfs2elnvp;() rxoxf3ty1fm ranvo;t)s2tmim3iodaptnlics () 2tr( o;u0oee mfciysfs2eauvsnt0tlxrmfcta1la r n ils)t2xo(mpny4opt  nct t  2umu pno4tpx mietls a2uau p t0 leoio to1faDrlu i s0t2uoxrpiu1alt lfcilt a2rr(  ot4texnmo3iytfa2eau o;t0aexrmf ty1op e nes (0 exmio3nodalt mncils srtmumo;o1tee  feiaslm2rauvo u0tetnio3iydlat lneil()s2urxr3ou4lltemfvil()srrmxm oo0texn oetydlaDum( s;u)texoir ty1fm r ivslt0 2xmir3nodll eliei ()s2umxmoot4texn iciytls2uanms;u)alermfcio1lmD  neil()teumxr iy1op emiei ()s2tr(m nu0tpeomf3tltla ean p;t)tlermo tytlmteanei t)teur(o oo1lltnlict ()s2uaxmoou4tlx  ieiydla2ulnms t4teeomociodlmD  u i;s  rxmim ny1ll   feil(  rraxr ;o0aeen fctydfs eauvp;(4 rtomo3iotlpte ueils s2trxo nydomt liei s sDraxr ;t4apxoioeildfa2eauvon() etomocoy1opte neol( trtm(opoodlm  lieiat artr(mo;t1apx  fctld a2elu s;(4 reomo iodlaDrauvils  2uoxm3oudap n net sf Dta(ro;u4alx  oeiysla2ua( s u4tlerio to1lmteaneols0 2xr(m3iy4altemnci ()aruaxm ;t4apxomo3iltla2um(mp () exrxoctotop rauvs;(0srumxm ou1omee ietls)a2tm(m ou0ape  ociatfa2umuvp;t4arxrio3todfa rluvil()sexr(r nydale lfcia( artrxmooo0olxn f3iysfmDeln snu)alxnxf tydlaDeli olt0 2xmxmpiydal  mnvtl()aDtaurono1tptoio3tytlm uanvp;t0trxnirciytfpDelueolt  rxo(o3nu1lp nmfviat sDrmu pot4tpeo oeiasfm2ulu o;(0 ltnir oa1omtrlnes t0s2trim oudaltnlfvt t sDtmxrpou0ale  i3tltfs2umu o;t4arxnxociotoat au o t)t2tr(r oy4omt  iei t)srtrum no1tpx ioeilsla2um(mo () rxoif ta1fpD  u il(0setrxo3ou4op nmnctlsfaDum(  oo4tleoio3iat m2rm(mon() lxrxr iotlmt  nvi;t t2trio oy4ol n ictat) 2urxroou4ole mfctyt mDrau s;u4altrmr3oadom   n i;s setoir iydomte fet sf Dtm(r no4olt mietaslmDeluvs;t4 eenif iotfatrlnesl( s2uoim nudamenliei (f rtmxmont1aexn o3iatla um(vp;u)aeeomr3oodfaDelivo;( s2trio iu1llt  fvsatf Drm(mpnu0tpeo ieiatfmDulnvsnu)aeenmr oytfmDeaueils)srtoxr oy1amenmfcs ( sDumxmo;u1tetoii3tys sDum(vsn()trermoctytfatrau s;( s2urim ny4lm nlfvils s2umumpoo1tlxo ictydfsDem(mo ()teeomociytoa  liei s sexoio3no1ol elnctl( artr( oou0apxniociasfa ea(vp t0trtnxf3tadom rluvolt0srxoxopoodllenmncias srumu onu1ape ioctltlm el(mp;u) rxrmo3iydlmt  uvil()seuoirpoy1aleelnctl()srumu  nt1aptniieiatfs eaumsnt4 reoxo3iytlm   nei t0 rtr(opiy1op nlnvsl(fa2ra(ro;t1tle ifetys m2uluvs;u) reoif iadomD  ieils) exoxm3ou1ol e iet ( srtrur nu0opeoiieiytlsDrmu p;t4 lxnxr3tatoptrlu i;s t2xmio oo4ll nlfes t) 2urxr ;t0oltnmi3iyt mDemumo (4 rtrio oa1omD lnvi;s)s2xmim ny1llt lnei s aruaxmpoo4aexomi3tyd sDemu s;t4 exomocta1lpDr ivs t s2xrxr3iy1apenlneiat a2uaxmo;o0tee ifctlt a ranvo;()texoif iotla rln o t0srtmxr iodapee nei t srtru  ot0aet mi3iatfa2rlnmsnt4trtoxrcoydfmteau olt0tetmio no4olt mfcs t artmump;u0tlxoifetlt a2uanmonu4altnxo3tytfaD anvs t srtmio nu1lltemictl(fsrur(m oo1tetnmictyt a rm(ms;t0 exrir oydlpDr ivi ( setrir iodopenmics tfarrmxm no4tee ioeiad sDem(vpn(0trxoxfctatomDe ueols trurxo3nu1opt lfctls  2rau p;u4altoio3iyd aDelu p;u4tltrirciadfa rlueils0tetrim nu4ame mivsls) 2uax pot0oleo o3ildls ulu o t4tlxnmo3iatop  anei t) 2trim nu1aleelfet t s2uaxr nt4aeto ociad s2umnms;t)treoxf3oodopteaivi;s0 rumxo iu1ll  licsltf Drrumoou4aex iictlt aDumnmp;u)aeeoif ty1la rlnvo;( texr(o3nydlm emfctls srtmxm ;o1tet  o3tldlm2ra( s;u)trxrif oatoptelneolt  ruo(m ou1llt  ivtls  2rrxmo;t1apxomicilsfs2umnvo u0teeoiocoytlateaieils0srtoxo ou1am e nesatfsDrrx ooo1tpt  iciysla2rl(mp;t4 exnmf oy1oa eauvilt  2um(r ny1altnlicsat sDtau o;o1aleo octyd s2ra( s;(0aetoxr3ootomtrlivil(0trto(mpiudaptelfvsa(  2tr( oot0aexomieiatfaDuanmo t4 etoircoydopDelu ols tetr(r3ny1ol nmnet t s2tr(mpot4tptn oeils s um( o;(0 eeoxo ta1lpt anvsl()texr(o3ny1al  mictas  rtau  ;t0oexoii3iyt mDem(vo;t4arxoxf3oodoaD  uvi (0srtrir3oo4lpt  ncilt aruru ont0aexn fctysls2uauvs;t)arenxo ty1fpD  uvs s trxmxopou4ap  miciltfarrmx ooo1oltoii3tas mDum(msnu4 lxnio oo1latraieslt  2xmim io1lptemncils  Duaxm ;o1apxo ociasfm2ul(mon()tetrif tatoaDeanei;t) eurir no4ll  mncslt) rrrx o;o4oexn oeiyslsDrlu pnt4tltnif tydlmD li o t)texr(rpoy4oltnlicilt)sruauroot4tle mf3taslaDua(ms;t4 etnmr to1oa  livsls0 euoxopny4lptnlnvtas aDrru  ot0ale ioctysfm2rlnmp u)areoxo3oodop  ln o ( teum(m3io1lp emiciat) 2ta(mont4aeto i3tatla umnvo;t) leoxo3oytfpteanvi;s t2toirpiu1omtnlnctlt)aDrm(ro;o0optnifctytlsDrl(vonu0 rtnio tadlatean s t t2xoxmpnodal n netls  2urxrp;t4aptnifctltlm emump;()alxomf3ia1omtraueols) etoirpoo1lptn fvsl(fs2umxmp;o0opt  feiydfa ra( p;t)aeeoxr todfmtr i i (0trxr(o3oo4llee fetl(  2tmu p;o0alxo octat mDeanvp;u)alxrirciy1latr n sl( s2urimpnodamenliei ( srurx pno0apt  oeiat sDul(vont0tlerxo ootoatran ols  rtmirpoodome  nvslsf 2rm(rpno0tet  i3iadlm2rlu s;t)aetoxf iydoa   uei s sexmxrpoydoptemiesa( artax  ;o0tlxomfctltls ulnvs () ltoir3ta1lat ai o t0t2urxrpio4al nmfcias  rumurp;u0oexniieiadla2ulnvp;u0 rtnxr totfa   i o () rxr(r oudap  lnvia(fartr(rpou1opx  ictat s emuvp u4trxriociytlate ivs () 2xrirpoy1ameelfctatf 2urur ot4openio3ilslm2emump u4 exoxf3iodfm elivi;() eur(rpoo1ope lfciat)srrmxr nt0texoio3ildfa2umnms;(0tltnmocio1lat  u il( setoir no4al n ncsat)s2tmum nt4tpxn fetasls2uanvont4 rtrir3iatoa  au i;t srurxrpiydam n ictas) Dur(r ot4olt mf3iasfa2el(vo u)texnifciodfpte nesls0trtmimpiudllenlietas)aDtrum nu0aee mocilsfa rau s t4trxnmfctydfpD li s s0teumxm nu1ol nlivsls  rrmxroou0oltnmoeild aDeanvo;(4trtnio3iy1omt lneols seto(rpno1apteliei s artmur nu4ape iieiltla2em(vo;t)trenifciadlaDr nvols)trumir3ou1lmt  fvsl( s2tr(m ;o1tpxnifcils m el(msnu4 etrir3iatlaDrlnvi ()srxrir3io4lmte ict t aDtmx p;t0aet  f3iasfmDrm( p;u0alenxrcoy1fmD  nes;s sexm(o3iu1ll emneta(fs2tru onu0olenmieilsfsDel(mp t0aexriocoytla   ivols t2xrir oudaltnlnvt (f rtmxm nt1olx miciad m rln pn(0tltoio3io1omD lieils s2tr(mpoy1aleelfet s  2um( poo0oeenioeiadlmDuln o (4trxnmo3oatfm rluei t  rurim3oy1ll e net (fsrrmx pnu0optoioeiytfs rl(ms t)aexnmo tydop  lueils t2uo(o3iy1ope lictlt)artr( p;t4aeto ieilsls2rl(vp (4treoiocia1latr u s s) rto(opiodll   iet (fsrumxrpnu1alx  i3iydfm2rm(vs (0tleniocio1fmD li il()sexriopiy1omenlictatf 2rm(m ou4tle mf3iyd s2emnvo ()arxrir iy1fpD  n slt  2xoxm ny4lptnlfcslsfsrumu  ot1tlto ieiytlmDuanms u) lxnmo oydlpt ai ol()seto(rpoudlp e icta( s2rrxmpot4tlxnif3tlsla emumonu0trxrifcoy1fa  an o (0sexoxm ou1op elnet sfaDrru p;u4aexnii3iasfm2rl(vo;t0 lenxr io1fp e nes s)seumxr3oo4oltnlfcs t)sDtrumo;t4aex ifetld s2elu s (0 eerioctotoa ranei;s  2xmir3no1op e fcilt a2um(mpot0tleoif3tyd a uln s;t)alerir3oytlmDrln ilt0trxo(o3iu4lmenmfvi sfs2uaxrpou1olt ifetltls eauvo ()trxoxrciy1latelneo (0t2toxm io1ameelncs t) ruau oot4aetn ietls m2el(vsnt0trtrxr3oodlptr ivol() etoxm3no4al elies s)srra(rp;u4alx  ieild m um(vpn(4artrmf3iotopD luvs;t)s2trxr no1opee iei t artau onu0opx ioctlsfa elnmo ()alerifcoa1op e nesl( sexrxopoy4op n ncs s s2uaum nu4aee ii3tyt s2uaumo;(4trermf3tatfatrai i t)teurxm nudom   ietl( s2tm( oot1aptoifeilsfs ul(vsn() lxomf todomD an s () etmir3ou4opee fcslt aruauronu4altomfeiadfa2ul( s;u0trxnxf3ia1fptrli ol(0 rumxopiy1alenlnvilt) ruaump;u0tpe mo3tys mDeanvsnu4 rtoxocio1lmDelnvi;t  2tm(r iy1al e nvtat)arumxrpot1tle iietadlm um(vo;t) exrmociydfa rlues;t0 2uo(r3no4lpeelivs s)aruaxr ;t4tpenii3ias s2ul(vp;(4altrioctytom  lnvsl()seumim iy4amtn fvs tfarrr( ono4tptn fetls a eaumonu)arerxr tytfa   neo t) 2toir iy4llen nci t sruaxm ;t0tltoio3tasfm2rl(mont4 exrifcto1fpD lu i t0truo(rpoo1ll  liei tfaDtmumpnt0oeeoif3ildfs um(vo t0tleomo3iadfpDean o;() rxoim oy1apt  net ()aDuaumpot1aptn o3ildlmDrau p t4 exnxo iatla  luvi s) exmxopio1omtn fctlsfa2trxmpnu4oleniieiyt a2uauvo t)artnxfctatfm rau i;t0 2tm(opoudlm nmfvtlt)aDum( poo4apenmo3tadla2ulnmpnu) etnxr3to1fm ranvo;s srtmio3io1lpt lncsasfarrr(root4tpx moetyslm2ulnvo (4tltnif todlp  lieol(0trxo(rpnydol nmncil(fa2rrxmp;o0oeeo f3iasls rmn p ()artriocoy1oateau ils)trurxo nydlmen ictls  2rm(mo;o4teenifetydlsDean o;t4aeerxf oatfaDean o s) 2toxrpoydlpe mnvsl(faDumu  no0tlt io3ilsfm ulnms;t0alenmrcty1fptr uei t sexrxrpoydlp n ictlt)a2rr(m nt1oetnmo3ils m umnvon()tetrmo3iydopDraueo;() 2xmxo iydole  fvs (farrm(mpnt4altnmfeiytls ulnmp (4 exoxr iytlate uvi t0srtrxm ou4ap n ivias arrrx oou1olt  f3iad s2ua(mpn() exrxf oy1omtraivolt) 2ur(r io4altemnei s aDurur nt4olto fctld a2uln pnu0 exomo3totfaD  ueo s) rxoiopoudol   nesa() Dua(rpno0apenio3tlt mDrl(mont0aleomo oodomD auesls0srtm(o nudamtemfcsls sDtmx ont1opx mictld s2umu s;u4 lerifcootlm eaues;()s2ur(opiy4oltemfetls  2urxro;u0tpx mfciydfa2elu o;u)tlxnxo tatlpDrli olt srtr(mpoy4llte ivt s  rtmxm ou0opt mo3tysfa ulnvsnu4tleriocio1laDr uvs t)seto(o3oydlp nlnvi s) rtax poo1aee  ictysfm ea(vs t4treomr3iodfmDelnvs;()texrxmpny1lptemnvtlt  Drmu p;o4olx mociysla ul(vo u)teeoxr3to1fat liei;s)s2um(m no4lm n nviasfsDtmu  ou1olxn icilt s2umuvpnt4aexrmo oadom rli o;s) 2to(o oy4al n ivil(fsDtrurp;t0oexomf3iat s rlnvpnt) rxrmf3oatfa  anvsl(  rtrio ny1ope lneil()artmxrpoo4opxnmoetlsfsDrm( s (0 lermf tydomDr nvolt)s2xm(rpny1llte nvsl(fsDumxm no0apenmiciyd m rlnms u)arenmo oadomD lueils0trtmiopiu1altelfet t  Dumu p;o1aexomfciydfa ea( o;(0 ltomrcoadla ran ols) eurxm3oudlmen iet t  2rrxr ;u1opx ii3ias aDrmumo;(4trtoxr tatlpD an ilt0t2urir3oo4apt  nctatf ruaurpot0aeen o3tldfs2rmn s;t0aetoif iy1oat lnvs s0s2tmxo3no4lm emfvta(fsrrmx p;o0oetomoetysfs emnvsnt0artoxrcoodfpDranvs (0t2xoir3ou4al n icsat)aDurum ;u1teen ociasfa rluvs;()teeoioctodlp   ivo;s srumim ny4open nvsas  rrmu o;o1tlxoii3iyd a2rmn ont4 exoxr3to1fpt  ieil(  2to(o3iydop nmfesat  2rmxmooo1openmi3tyd mDul( o u0 eeoxfciy1opDraueil()s2uoxo no4olt mfciltfarrmx  oo1oexn ociysls2uln s;(0 rtoxfctydopt li sl()s2xrio nu1aptnmfei t arrrurp;o4opxnmoeiadlsDumu o;(4trtrioctatfa   nei s0 rtmiopiudolen ieiasf 2rmxmp;u1oleo ieiydfa eln o;(0 rermfctotlmD lneil(0 2uo(m3io4lpt  feslsfa2ua(  ;u4tet mieiat s2ea(vs t4 rermfciy1oatrluvilt)truoirpno1apte feiltfsrtm( ono0oeeomfciyt mDem( o;u4 ltomf tytom eaieils teur(r3iy4lp  lnvtl(f 2taxmpnt4openifcils sDelnvo;(4 rtoir tadlatelieo (0 rxmiopoo1lp elnvt s)aDtau  no1olxo fetysfsDua( s t)tltnmr oydfmD  nvi s) etoxr3io4ll n fvilt) Dururo;u0olto o3iyt mDua(mon()altrmo iatfa eaueols)t2to(o3io1ap e nes tfaDur(mpnu0tlt ioeiasfm ulumpnt0alxrifciatfpDelnvo s0 2uo(rpou4op  lnvsa(f rrrxroot1tlxnioeiadfs2emnvonu) lxnxo ia1omDeai o;s setrio3io4ll n fvi () Drm(ronu1tpeomietld s2ulnms t4 etomr3iy1laD  ivsl()trtrir3nu1ole mict s  Drax ont1opeoifeiytlm ea(vp u)trenifctotfmteaieil()trtr(o iu4aptnlfctl() Dtmxmpot0tee iieiat s2ranmo t4 lerxr todlaDe n o t)s2uo(m3ny1lmt lfct (fs2trur oo4tex  i3tlslmDrm( o ()trenmrcoy1laDrlieo;(0s2xo(o ny1alt mietl()s2uau oou1tetomf3ilsfm2uanmo u4 eeoxrciotoa r n o s) 2urxrpiy4apt  fvtas)aDtmu  nu0tpxomieilsfs2ranmp t0 eeoxf iydomt lieo;( s2tr(o ou4alte nct s) Dtm(r oo1olx iociltfm2eaumon() lenxrcty1oa e n ol(0srur(m iy1altnlncsa(farrmx onu4opx  feildfsDeanmp t4aleoxfcoo1opt  n o (0 eto(m3nodlmenmfvta( srua(monu4tpe ii3iydlmDuluvs;t0alxrif3totlmDelu ilt)sexoxr no4op   ivia()srum(r no0ape  o3tasls elnmsn()tltrio oo1om raues s  eurim3oydape  icils) Dumuroou1tpt io3iytfmDrauvp u0aexrxocootopD  i sl() rxoxm nodlltemfct t arrmxmoot4tpeniocils aDrm(vp t0aeeoio3totfatrlnvo s seto(m iydomt  fviltfaDumxrpoo4oltoifeiat s2rmnmp t)arxrmf3iydfate uvils0t2uoir3ou1ame  nctlsfa2tr(mono1tpxomocilsls2emnmsnu)altnmf ty1omtelu s (0t2trir3nu1al  lfeiltf Dtrx p;u1alxoioeildlsDuanvo u4 rtnif ta1oatr ieo (  rur(m3oudlptnmicsat arumu o;t0opeomf3tld aDelnvonu4 reomrcoa1fmDrau o;t tetoxr io4lmtnmfcsa( sDumu oou0tltnifetasfa2um(mo;t)trtoxf3iytfp r ueo (0 2xrio io1al emfeil( srtmxm no1tltomoetys sDrmn p t) rxrxrcoy1faDrliesls0s2xm(mpiudamenmiei (fs2ua( poo1opeo ictytlm2ea(von()aexomrcto1opDe uei () rtmxo io4amtnmietat sDraum no4alx mi3tatfsDumn s;t4 lenxf tatomte ivol() etoxopny1lmte fvslsf Dtmum no4teenmoeiyd mDumnmp;(4texomocoodfp eai olt0 2urim3io4ll   fvsas srrmxr nt0aet  ociysfa2umnvs u4 etnxoctotop  li o s)s2tmiopiudlp nmnetas s2umu pno0apenmietytfa2uaums;u0trtnxf3tydop   iei;t  exoir3oy1al n nctls)srra(rooo1alxnifetad a2umuvp;t0tlerxociadlp rai ol(0 2to(r ou4open ncs (f rtaxmonu0tlt ifctlsfs2rm(mp ()aetnmo3iadfpDran ilt) exm(m3iu4olteliei s arrrur ;o4opxn o3tasfmDranms;() leomo3oa1oa e ieil()s2tm(m iodopeemivias) Drmx ooo4oex moctatlm rmuvs (4 ltrio3ty1fm rluvs (0 eum(o nu4lm e icia( arrmxro;t0olxn feildfsDum( s u0arxriocoatom elues;s  rxo(opiy4olen fesls) Draur nt0opxnmfeiytfsDemuvp;u)arxnmo ootlmDrlnvo s0t2toxr3no1omenlneia(f Dra(moot0opt mf3tld aDumnmsn(0tleoif io1oatrau o;( texrim oo4ameelivta()srtaum oo4texomf3iadfm2um(vp u4tltoif totop ean s s0 rxmio3oy1lmtnmnvt s)srtrx p;t4ole ioeiatlmDrl(vp u0alerxf oatoate ieolt  rxo(r no4amt lfci s  rtmu onu0tleniictldls2eauvpnu4texnir3oydoateaneil(0s2toxo oo1lp emivi sfa2um(r nt4tlx mieiytlsDeau pnt0 rtnmoctadfm eanesls)seumirpny4lmee fvilt aDtrum ;o1oltn f3iadfm2em(msn()aexomfcta1opD au ilt srtrxm oo1ol n nesasf 2umuro;o1aexomo3iysfa ran p;u4tlermo3ia1om r n o;t0texrio oy1lpeemivt s)s2tmx onu4tex  ietyt m ranvont0 lerir3io1om raues;( srur(r oo1alen nvi s srtaumonu4tptnmf3tytlaDeau p;t4 lenio3totlate n slt0sexr(r no4aptelfei t)s2rmum nt1tpenmicilsls2ul(vs;t4trenmrciytlptrli i;s  rxmir3iu1lmeelivs s  2umurpno1altnioctad aDran s (4 exoxfciytlmtrlu ols trumimpno1omtelnei (faDrrumoou0oltoii3iys s2rln s t) lxniocia1op eai i (  etoiopiydamtemfetl(faDtaum ;o0opxo iciytfs2ran o t0tltnxo oytoat aivo t)teto(rpou4lltelnvtas)a2rrx o;t1tlen f3ilsfm rlu p () lxrir3ia1lat  u ol()trxrio nudlpt  nviltfsruaurono4tptomfctadlaDul(ms;u4trxnif oodoaDe uvs;s  etrxmpoydamt  fes () 2trxm nu1aetnioetlslm ranms;(4tltrmoctadoatraivil()texmio3iy4lp   fvt t  Dtrxroou1tpen ociydlm2umnmsnt0 eerxo3ty1fmte uei;t  rtoir3nydlptemfctat)srrmu  ou1alxo oeiadfa2eauvs (4altrif oy1lpt li sl(0 2xmio3iu4amt mncsat  2rmx p;t0tpen ictas sDem(mo (4arxnmf oatfm rau ils) 2toim3iu1op e ietltf Drmump;t4alxnif3tydlm2rln ont0tlxrio3oytlp r nei;t s2urxmpoodam emnvi ()sDtm(moot0apenmiciyt a ea( s (4 rxoir3tatopDeaueol(0 2urxo nu4op nmivilt artr(r ou4tlto iciat mDemnvp;()tltnmfcoa1oaDeaneo;t0srum(m3oudlm nlici ( aDrmu  ;o4tlt ii3iys a umnvs (0arerioctotfpD li o;s0 exrxo3iu1am emicsas sDurumonu1optnioetysfa2ea(vsn()tetnmf3tatomDe u o;s)texmxr oy1lp n nvi tfs2uax pou0tptn fctadlm eau o u0 leomocta1optrlivs t)trtr(m3iu4lp  miet s arrm( p;o1tlxomoetysfm ulumsn(4aleriociatopte nei;t0 etrxo nu4amtelnetas)a2taumont4tleomoctasfa ranms ()tlerir oytfpt lues s)trto(r3no4ale miet ()srrrump;o0opx ifciatlm uaums;(4texoir iadlmtrlivi;s0t2urxo3iydlltnmicta( s2rm(monu1aexoioeiytfa2rmnvont)alxrifcoadlatelnvi t)t2xm(o3no1oltnmivilt sDrr( pou0opxniietlsla ua(msnu0aeerxrcty1fmDraueo;()s2tm(o3oo4lmeemfcsl(f Drau oot4oeenmfeiyt s2emu s;t)arenxr3tadfmDr ivols0 ruoxo io4am   fct sfa2rmx pnu1apx ii3iasfa eluvon(4 exomr totopt auvo ( t2tr(mpny1aleemfvsatf rrr(m nu0tet ifeilslm elnmp (4trtrxr3ia1fp rlivil( sruoimpnudomeemfesl(fsDuaur ;u1tleomieiat aDrl( snt4altnxrctatfmDe u s t tetmxrpnudlm elicsat srtm(mono0tlxn f3tldfmDrmnvonu4aleomocio1fmDeluvi s  rxmxmpio1amenmnctas)a2umu  no0oeenmocilt a el( snu) rtnir ootomDelneolt)t2xoirpno4am  mict tfsDumxrooo4aeeo ictlt s2em( o;t)arxnxfcoy1fpDelu i ()seurio3io4om emncs (fsruru  ot0aptoio3tysls elnvo (0artrir3oadoa  li s (  rxo(r3iu4aptn fcsltfaDum( poo4tetnioetydfsDrluvont0 etoxo tatlm r i i;() 2toio nudom  lfvta(  2taxmp;t1aeeoifciyslm2ul(ms t4 etrxf tytfpD ai slt)t2trio3ny4om nlnet () Drmurp;u1openmi3iatfm2rl( s;t0 rxrxfctotlmD  u i t) eurirpny4lpte ictls  2rauronu1oexniieiasfaDrl( s (0trtoxo3ta1optelu s t)t2xrim oudlp elnvi t aDtaxro;o0opxnioctldfs ulnvo u4arxnmf3oytfa  au ilt0trtoir nodoptelfes ( s2um(rp;t4apt ii3iadlm2uln s (4tlxrxf oodoa r uvols)truo(o3iydoptnmiei ()a2tax ooo4oetn i3tld mDua(vpn(0tlxrmoctotlmDr uei;t)t2xoxrpnu1opeemnes s arua(rpot1apenioeiytfm ua(monu)arxnmoctatlm   neolt)s2tmirpnu4amt mfctas srra(mooo1tpx  f3iyd s uau o;t0 rxrmrciotlm  aueo;s0s2umir ou1ol  mfeiasfartru ooo1oleoifeiltfmDea( snt4tleoxo3iydoa   ivs;t0s2urim ou1ome mnvsls)srra(r nu1altniicildlm ulnmpnu0tleomocoytfmDean ols t2trir3oo1olt licil()s2ururoou1tltnmf3tytla umuvsnu4 exrmr todfaDr neilt teum(m3ny4lle mieias)artm(r nt1optomf3iyt m2rmnvs u0aexoifctatfmteanvo s)srur(o oy1lpt lfvtls s2tmxr oo0tltniicilsls2eau o u4trerif3todlm rlnvsls sruo(mpiudalte ivsas aDrrxm ;u0optomo3ild m rlnvo;t4texrmrciadfatr nei s0 2uoxm3no4aptelieias)aDrmxm ou4apxomieiaslm2emnmp t0aetomocoydlp  luvo;t0sexo(m iy4alen ietl()srra(mpno4oltoiictadlaDra(vp;()artoxr tatomDeanvsl()t2xoxr3no1am n iei ( sDumum ;u0altoioeiys mDumn o;()arenxociotoatraieils)teuo(r3nu1op elnvslt aDraxrpnu4aleo fciyslm2ra( o t) etnmf oadomt liesls trxo(o3no1om   ivslt)arurx p;u0tpt  ietltfm ea(vonu4 exnmrcoa1lpDrli i t t2urim nu1am  lneia(  ruaxro;u1tleo feildfaDea(vonu0 lerxo tadfmtranvslt0srxo(m3ou1ole  nctltfartmur ot1aet mfeiydfsDrmu s;t0tltrxf3iodfp e ues t0 2xrio oy4omtn nvil()srtm(mp;o0apx  f3ilslsDumnvsn()aexnmr3iodla  livo s)teum(m3nodam elnet ( arrm(mpoo1tlt ii3tlsfs rluvsnt0teermfcia1lm raiei;s teuoxo no1lmtnmnvtasfa2ururono0tlx mocias a2eluvs (0 renxocoodopt li s (0srur(m oudap  lfvi ( sDta(rpoo1oex mi3tadlsDeaums;t4 exoio todfp   i i t sruo(rpiy1ole lfvils arumx  ot4alx  i3iat s2rau o;(0 reomocoy1op rli ols) rum(m ny1lp  mfct ()s2um(r nu0oee iicilt sDea(ms;u)aetrmo iy1fmt ai s;s0 rur(r oodlmen ietl()srrm(r ou1tlxomfeiasfs eaump;(0trtnmociadop  ai s (0s2xoxmpiy1amt  nvi (fartaur nt4texo ocilsfmDrmumo u0artnioctytfp eai i;t sexrir iydlptelfcs s)sDrm(r ;o4olx iocils m2umums;(4 ltoir to1om   uei;()truoimpiy4llenlivsls s2um( p;o4oleoio3iysls rl(msnu0 etrxf3iadlate ues;t0 rxr(o3iu4lpt  iesas a2truro;t4olx mi3tat m2ran o ()tlermf3to1fa   uvi t t2tmxopnydllt lnvta(  ruaxrpoo4aeeo octys a2uanvp ()tlenio3ia1fpDr ueil( teurio3ou1lp  lncsls) rtm(rooo4ope iiciasls2rm( snt) etrmr io1omDelnei;t seuoio3nudaptnmfviat)aDrmurp;o4opx  o3tasfa2el( p (4arxnxf io1la  li i;( s2ur(o3oo1ol elicsl( sDra(r nu0teenmocild m rlu onu) rerir tadfptr n s;t setoimpiu1ape mivslsfsrrm( ont0tpxoiocilslm rauvo;t)alenmr3iytoaD an o ()t2trxmpiu4omtnmics tf 2tr(  ot0opt ifctatfm2ulnms t0 rtnir3totlp rlu s;()trumxr iu1ap elfvtas srraumo;u0aleo ictldlm umuvo;() etrio3ty1om raivi t) exrxo3iodlmtnmncs tf 2urur ;o4texoiociytfaDrm( p;u)arxrir oo1fa rlu o t0srxr(opiu1ape mfcs t)arua(ro;o1apxo ietlsfaDelnvp () lxrxo3oydfmDr i s s t2toir3oydal emfvsat artmum oo0oleomo3tldls2um(mp;u)arerir3todfmD  u i t tetm(o no1om   fcias)srtaxmpnu0tlto f3ild m2em( pnt4aeerxfctotlptr i i;t) etmxmpoydalen ieils  Drr( ooo4tlxn oeildlsDrl(vo t)trtrmo3oatlaD ai o;(0srxoxm nodamtelnvi sf rrru  ;o0aee  fctldla2um(vpnu4aetoxo3iotoaD lu s;t)teurxo iydlpe lncta(faDururooo4aex ifciasls emnvpnt0alxomr totfpDe neo;s0sexmxr3iu1ll emietl()s2ur(m no0optniocilsla el( p;t)teeomr3ta1lm eli i s t2tr(m oo4omtn icsat aDrrur no1oltomfciytfs2rm(vo;()tetnxociatoa  lues;t)s2tr(m3ou4alt  fvs s sDuax  ou4openmociydfmDeln s u)artrmr oytopDrlnvo s)t2xmir iy4ape mfvt s)s2taxmo;u1oexnmiciatfm emn p;(4 ltoir3ty1fp eluvo;t)s2xr(opnodlmenlncilt) Drmxmoot1opeo o3iltfs uanvo ()aetnifcootfat  n ol( setr(rpiu1op  mnciatfa2trumoou4oex moetld a2el(vo;() rtrxf3iy1lm  au s s  eurio3ny1lm  livt t)sDtmxrpnu1aleniiciaslsDua(vo;(4artnxocoydlmDrliei () rxo(mpio1amt mneilt  2rrxrooo1oee ii3tys aDel(vp t0tltnxf oy1la   ivsls seurir io1lmen ivt sfsDtmu  nu4ope  ictatfm2rlums (0 rerif oytfa  aueo s)trumxopnu4lmt  nvt sfsDrmu  ;u0apt  fctadfs2ean pn(0texrir to1fatelivi ( srumim iu4olen netltfaDumx  no4teto fciyt a ranmont) exomoctotlpD ai sl() 2toim oo1lme mfvsltfsrtmxro;o0apeo o3tltfa2emnvo (0 exomf3iy1om   nvsls sexmiopoy4ll  micslsf Draump;u1olx mfcilt s rl( o u4areoio3iydfa eau s;s  2umxmpnodalt licilsf rumxmpnt4tltomfeiyt a umnms;u)tlxrif3to1fmD au s;s t2toirpiodllee net (fa2tmx  nt0tlxoiictyd m umnvpnu0 renxf3iy1oa eanvil(0 eurxr3nu4om nlicta() Dtm(  ot4oetoioetltls rmn p t)aeeoxoctydoaD anei;s0srxo(opoudomte fvsl(f Dtmxroou4tpenmfciad s uanvpnu4 ltrmr3oatomt livo t) 2trxm3io4llen nviltfsDtmu  no4aeeoii3ilt sDulu p;()trtoxf tadlm r i olt) eurir3no4lmtn nciat  2ra(mpno1optnioeiysls2uln snu4 eenxf3oydop e ivsls0 2xoimpno1opt lncta( a2ur(r ;u0tlxnmf3iyslm2eauvo (4aexnircta1fm  liesl( s2tm(o io4lpt lnvt tf 2umur nt4texomoeiys s um(mon(0texrif3tytopDrlieilt)s2trim ou1opt  icsl( arrax  nu1aptoif3ias sDeaumsn(0 etnmr3oadfptr n i;()s2xrxr ny4op emfct () rtau  nu0tlx mf3iyd s rln p u0aetrxf3iytomD  i o s) ruo(mpiy1opt
\ No newline at end of file
@@ -0,0 +1 @@
+nvi;t)trtoimpoydome lies ( aDumu p;t4opx  fctlsfa ranvo () lenio tydfa ranvi;( srxr(r io1altn nvt t a2umu  ot1aptomi3tlt m2rl(ms;(4 exrxo iotfaDe ieo ()trtmir oo4op  lfet tf rrm(  ou0tlxo f3iat sDrmuvs t4trenxocio1optrau olt sexoxm3nydap nmfes t srraxr oo0oeeoio3taslm rlumo u4tlerif3to1lp e ivs (0t2um(m iydlpt  netas s2rmurp;u0alxn f3tasls2rauvp t)aleomo oydoaDrlu ils) exmxrpno4ap nlfes s srumu poo4opxniietls sDem(vp t)alxrxf totfptrln i;() 2xoxr3nudomeemivt (  rtrump;o4olt iiciat sDuluvpnu)aetrio3oatoptranes;s tetrio iy1amenmnci s  Drm( pno0oee ioeiasfsDulnvon(0alxoif3oo1om  au i (0t2urimpno1amtemnvil()a2ra(ro;o0tpeomo3iys m2ranvpnt)texoif3oatlp  li s;t  eurxmpio4lleemictl()s2urx o;t4tpxoifctltlm2elu on(0alxnif todfaDrlu sls)t2umxmpoydllteliesat  2umxronu1oltnmociydfs2ua( ont0alermo ia1omtraies s) 2xm(r3iy1amt  fvsl( aDtm(rp;u0tee mieild a ul(msn() lxomo3ty1omteaneo;t t2trxo3nu1ope lnetat)artrurono4opxomfeiyd aDrln p;u0tetrmo3todfmDraivilt0setmio3ou1lmt lnviatfsrurx p;t4aetoifctytla2rlnmont4 lxrmo3oo1lpDrlneil() rumio3iy1omenlfcs t) 2ra( ono1teen o3tldfm ua(monu0aexnmr3iytopt  u ol()srxm(rpiodoltnmfetasfarumx  nu1tptniietytls em(vont4altrmrciotopt luei t srxm(r3iu4ol  lfvil( aDuaur ;t0oleoifetydla2ul(mp;t)tlenxf3oodomtran s t srxmimpio4ol emiet s sDtrxrpnu0oltnifctldls2rl( s t0 rtrmo todoateaies;s trxmxm3oodlm emfcsl( aDrmx  ;u0olxo f3iatls raumsn()trxrmrcia1fate uesl()t2xmiopiu4lme liei (f Dta(root4oeeo o3ilt m ulnmo u)trxnircoo1fpt ln o;( setrxo3oo1altn ici (faruru o;u4oeenmf3iltlsDua(vp;u0artrio3ia1lpDrlueo;s) 2umimpiu4ap nmfct s  Dua( oot4teenif3tys mDrm(vo t0trerxfciotlm r iesl(0 rumxo3iudlltelnvta(fa2ra(m ot1tlxomf3iasls2eau snt)tetnxocoodfp e uvols) 2to(r3oydoptnlnesls)sDtaxmonu1openmoetadlm2umuvp u4alenmf iadlatraivi;t)sexr(mpio1opt  icsls  rtrx p;t0olxo ietatla ea(msn(0trtrxrcootlmteaies;( s2xmxmpoo4amtnlnesl(farumu  ;u4tlt mieiydfs2umn s;u) lxnxf3to1lm rlu o (0trxmxo ou1ll nmncs tfsrurxmpou4oexnmf3ildfs2rlnvs ()altrxo oatlptelnvo;t0s2trio3nu1ole mivt () Durxrp;o4texnmoetydlm uaums;t0tleoiocoadla rai ils0 2xoir3iy1olenmivi () Dtaumpoo1aeenifeiyd m ea(mp;t0trenmrcoatomDranvs s)seumiopoo4optemieil() 2rrurp;t1tpx iociaslaDumnmo u4 rxrio ootop e uesl()t2xo(o io4apte nciltfaDrmxmpot1alt  f3iatfmDrmums;(4aetnmocta1lmtrlnes;t0 rurir3iy1lmeemnctltf Dum( p;u0oee  i3tltfmDeluvp;t0tltnio tytopDrlu o;s0t2tm(rpoy1ol elfetlt a2rru pno0tpt ifetatfm elu o;t4 etrxo tydla   iei;( s2xo(rpoo1lp elnci sfs2um(ront4oltnifetat a ra(mp;t4 rtoxf tydfat  nes s  2urir io4oleelncilt arrr( o;t1aetomictydfm2rmuvs;t4 lenio tytoaD  i s t  rtmxo io1om nmncta() 2rmxm nu0oleoifeiad s2elu o;(4teenxo iy1fpDrau olt0t2xm(o3oo4lptn fvtlt)a2ra( p;o1oetn fciadfa2uanvo ()aeenmr3tytoaDrlieil() etrirpno1lptn ivi s) 2ua(r oo4opxo ietasls2eln s;(4 exrif tytfp  auei;t0srumxm oo4alenliet t)sDrr(m nu1aleoif3tyslm ul( p;t) lenmo iy1fpt aueo;(0s2triopiy4ole  ics t)s2urx  ;u4oexn fciad a rl(ms u)tlerifciadoaDeli o;(0 euoim ou1lp n ivi s) Dtrum ;u1tptn f3iltlm2uauvs;t4aexrmo3oa1laDe i i;t) rxoxmpnu4apt mfvilt)srrrurp;o1olt iictltfm rauvo;t0aeenxfctydfmDelivol(0seuriopno1op nlncsl( a2trumoou4tex ii3iasla umn o u0 leriociotoa rliei () eur(m ny1lmee ivsa( sDraur ot0optnii3iad a uluvs;() rxriocia1oate u o (0 2xr(m3nodlme lfvt sfarumu  ;t0oetnio3ildlmDea(vsn(4altnmrcta1lpD aieols seurxmpiy4alenmnvi s) Drm(  no1aex moctytlm2rmn p t)tlxrmr oodlaDean o s  2xoio iu1llte ivilt sDtrxmoou0oex mf3iysfaDel( p u)treomocoadfmD  ieo ()sexrxopoo1ap eliei tf Drmur ;t4tptnifctasfa2rmuvo ()trxnio iatlmtelues t)s2tr(m nydolenmiet (  Drax pno1oexoiociytls2rmn o;(4tltoir tadom eauvo;t0seuo(o3ny1lltnliesa()a2rr( onu4tlxnioeilt m rlu o u4texrxo3oadfateluvo (0t2ur(rpou4ape  ncsasfaDrm( oot0opeomfeiad a ean o;u)altnxf3oadoptr i o t s2xoxr iy4alt lncta() Dtr(  ;u4tle ifcilt a ua( p t)artrifctotfpDr u i;t) 2toim nydamt  icsat s2taxm ou0teeomietad s rmu o;u0tlenmo3tydopDrli o s)trtm(m nydom  lnciltf rtr(r oo4tlx mf3tytlaDuluvp;() lenxfcoa1fpDranvi ()s2tm(m3nu4lmtn ivtasf Drmur ou4aeeomf3iasfa uauvp t0trtoir oatoaDrai s t)t2xmxo oy4lmeemfvsat  rua(r no1tptn o3tldfmDem(mpnu0trerir3ootlp elivo;t0 etmimpny4op  mnvtl(faruauronu0apx  ictls sDul(mp;()artnmrcoo1fp raivol()srxr(rpiy1omtelnvi s)s2ua(ro;u1oeeoif3tatlaDranvp (4 rxnioctatfp eln s ()teto(m oy4lpeelivslt sDrmxmoot0olxniictadla2eluvo;t) eerxr todla eli i;t tetm(m iy4ol emfes (fs2ta( ont4aee ioeiys aDran s;u)alenio totom raieo t)srxmir nodlmeemfvs (  Duau  oo0oexoifeiydfsDrln p;u0trxnxr3ty1la  ln o () eumim3iydoltnlicia()srtm(ront4ape mociyt a ra(mo ()aexnxf3tadlmte n s;s0t2urimpiu4ll e ietl( aDraxmpoo4aeen o3iltls2ua( o;t0 leoxf iadoptelieils0 exo(o ny1aptnmfvsatfaDraxmo;u0aex iieiad a2rlu s;()tltrxr3totlp eau i t0t2umxmpiu1op  lncsat s2rmur ;u0aleo fcias m2uan sn() exrifciotfaDraivi s0 exo(r3ny4op emnct ()aDrmxrpno1alt ioeiyt m2emuvsnu)tetnmoctydopD ai ol( teuo(m oudom  mfvs tfsDtmxmoot4optoii3iysla2ra(vont4aexoxo3oatlmDeluei;s)trtoir3ny4aleelfcias) rtrxro;u4opxo i3tlslsDrmnvsnu)alenxr oatopDeaivo;t s2uoim no4aleelneia(fa2umu p;u1optomiciltfs rmn p;u4alxrxf tydlpDr ieols)s2xrxmpiy4ame  ies ( artax oot0oexnmf3iltfs ua(vs;(0altrxr3tadla r nesls)tetr(mpio1ameemfvsa( a2uaumpnt1tlxnmo3tadls2ranvo;t4tlenxrcoadlpD luvi ( srtmxm iudlpte fcs (fartrxmpot4apxnioctadla2rlumo;u)tlxrxfcoydfat  ivols  2xm(m3ny1lmt  nvsl( s2raxm ou0tee mf3iydfsDeau o u)aeerxr tadla   i s ( trxoim ou4lm  liviat)s2rmx oot0tleo ieiys a rm(vs;u0tltoio3to1fpt  n i;t  eumio3nudalee fvs t)s2uau p;o0oltoio3iydfm2emu sn(0 exoxrcoy1lpt luvi;t0t2xrim iudom n feiatf rrr(roou0aetn f3iat a2um(vsnt)aetrmo oatopt lieo;(0t2tr(m3iy1aptnlnetl()srumurp;t0olenif3iydls2rl( s;u0 eenmr3tydlmDrln i;s t2xoxo3ou4al  livt sf rrax  ;u0olxniieiytlm ean on(4texoio3oodlm rau i;()trtmir3iu1aptnmncs t) 2uru  ;o4olx iieiasfsDrmn s (4tltnxf3iotlat  ieolt0 rtoxm3ou1apt lnei ()s2ta(mooo1oee miciydls2ul( s t0trxoif oa1fptranvo s trtmxr3no1lpe miet sfartrx  ;u0aetomf3iyd sDeluvpnu4 etnio3totlaDraivi;()texm(mpnu1lp e fei tf ruaumpno0texnmf3iytla uauvo () exnxr3iatlat aueo;s  rurxo3oudap  lictatfs2uaump;o1ale  o3iatla2elnms t0aetnxfcta1oatelnei;t  2xrxmpiodlmt mfciat s2tm(mooo4aeeoifeiadfaDra( p () rxnmo oo1omte ues s  2uoxrpny4lpe mfcsatfaDrrx pnt1oetoio3tysla2um(vo;(0texomf iodfaD auvi s s2trxm3no4omt mfvia(f 2trxm oo4opxn ieiysfa2rlnmsn(0 rxomocoadoaDe n s s)sexm(o3oo1al n fctl(f 2rau pno4apx mfctltfa rm( s t4 eeoifctatom  an ilt) rtm(mpiudomenlfctat)arumxm ot0opt  ociat s rmuvp t4trenmr3oatoa  aues;s)srum(m ou1omtnlfesa(  rrm( oou0olxo octys sDrlnmp;u0tlxniocoadlmtelivils)texo(r3iu1oltemfcilsf rrm(m nu4oexo i3iydfs elnvsnu) rxnmo iadlmteau i;s0tetmimpiydlm nlnvsatfarta(  nu1opeo o3tytfsDel(monu0tlenmo3ia1oatelivo t)tetr(o3oodapt  fcs ()sDrm(ro;t1aeto ociys m emnvsnu4 etomr oytfm eauei (0trumxrpiudam n fctatf Dumxm ou1optn iciysfmDea(vo t)alenir iy1fmDe ieslt srtoim iodol n fesltf rtr( p;t4tpenmiciatfsDrauvp;(4 exnxr3ootfptraneo;t0teur(rpnu1lm   netl( sDrax o;u4alxoifciat a2rmumpnt4arxnxo3tadfptrli i;(0 eur(m3iu4op nlfvta(f 2ur(m ;o4optniictadlm2eanmon(0 leoir3oodlm r ieilt0 exmirpny1ll  livs tfsDtrurooo1ale ioetlsfm2elnmo;u4aetoio tadfpteauvs;t0 rurxopny4aptnmnesls  Dumumpoo0ale ioetadfm2rau s;t0tlenif tytfm eauvs t)trtr(o3oodllenlicsas aDtmxr nt1aex mi3ilt aDeanvp u4 renmr3oadop  an il()t2xrxr3iu4lm e ictas sDur(r ot0oex ii3iatla um(mp;u)trenio3iodfatr n s ()t2xoxr3iydop n nvtls s2trumooo0oetoif3taslm raumont0alerir tytlpDranvs s  2xr(r3oydalt  ivilsfsrtau  ;u4oeeomiciltla uanvo;()arermfctotlat lieil(0texoio oudlmeemfvia()srrruro;o0tet moeiydfm rau snu0treoiociydlpDrli i (  exmir3nodaltnlfvtat) Dur(rpnt0alt  f3iad a el( s;u)altnifctotlateluesls0texr(rpiydapenlnetl() rtmumo;o1tlx  octasla ra(ms u)texrxo3iodoat  u i ( texoir no1olenlfviatfartaxmpno1ope ii3ilt s eanvs;t0 etrxf oytlpteanvsls) etrxopoy4omenmnesls a2tr( pot1opx io3tyt s2ul(msnu0artomfctytlp eanvi;s0 exrxo3oy1am emneta(fsrtaxrpnu0tpx  f3tltfmDrln onu)texnirctadlmtelu ilt)truo(m3nydol n feilt)s2ta(ront0tpt ioctydla em(vs;u0tlerxrcoy1fp ranei ()texmim no4lmenlivils  2rmurp;o0oeeoio3ildla umuvs;u4arerxo oy1oa rln ilt tetm(r iudop n fvia()aDrmurpoo1oexo feiad mDeanmp;t)alenxr3iotfp  livo t) rur(opnu4lm  mivsa(fa2trxront1aex io3iasfs rl(mo (0aexrmocia1fpDeluvi s) rtmim3oudaltn ies (fa2rm(rp;t4opt  o3tys sDeanmp u)aeerir3to1fmDeln i s0t2toimpny1omtemfvi s)s2rrump;t0tpt  ietyd a2rm(mp u)trxnmr3iy1fpDr n o ( t2um(rpny1optnmfesls  rumuronu4tltn ociatfaDua(mo;t4altoxrcoodlpt lu il(  euoxr3iudom nmfei s sDum(  ot1tetnio3iysfa2rl( s t4arenif3ty1fmtraueil(0 euo(m3iy1lm n ncsasf Dur( o;t1olenmociysfm ul( pn(4 rtnmfcoadfmteli s (  ruo(r3oy1op emfvsatfs2uaur nt1tpenioeiyt s umnmpnt4artoxf3oy1lm r u s t)trtm(o nodlmt  fvi (  rumumooo1opxo f3iyt aDumnmont4teermf totlm  anei t)t2xrxm3iodolte fct t)sDtrumpnu1aexo ietltla eauvp t4artrxf3iodlat aneol( t2urxr3nydol   nvias)srrrur ;u4ole mfetytfmDrmn onu0aeeomo oadop raivi;s)trtoxo nydop e fvtas  2taxmoou4tlt  oetlsfs elu p t4tlenxf3iodfm   ieilt0 etmxr ny4op nlietatf Drrxm ot1olx mf3iyt m2emn o;u4alxrmr3todoaDeau o;t setr(opnu4amt  ncil( sDrmxm ;o1apxnmo3tls a rl( o;u4teerio tatomDr ivo;t) 2um(r3oodopte nci t) rrauro;o1tle  f3tydfmDum( p;u)tlxrmr3iodfa r ivslt tetrimpiudamt  nci t)sruaxroot4tltn fciydfa rauvp;t0tleoxf3iodfmDrau ols0 etrio3iodaltnmfctls)a2uaxmpno0tlxnifeils a2ua( s t4tltoir iadomDean i t t2trxm oud
\ No newline at end of file
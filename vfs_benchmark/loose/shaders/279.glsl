@@ -0,0 +1 @@
+neo;(0 eto(o3iu4lltelnctat) Duaum no0tpen i3tasla eluvo ()tltnxrctotfaDelieolt) 2xm(rpou4omt lnctl()a2um(ro;t4tlxnmoeiatfa2eanmsn(0trtoif3to1lm ean o t)srxoir3iy4am emfcs ()arurumpoo4open fetld m ulu snt0 rerif tydfaDr uvo t  rtoxrpiy4oltelivsls)sDrmu ono0opxoiieiadfs ulu o u0aleoxr iydfat aneolt0 2to(r oudame  ivi t srrau oou4tpx moeiytls emuvpnt)altrxo3oytfaDelu s ( trxmiopnu1lpee fvsa() rrrx pou4opxnii3iyd m eau o u)altrxr3oatfaD  ivo s) 2xrirpiydoptn nvtlt)a2tmxr nu1oleomietadfaDem(vp;u4trtnxf ootfpt lieo;(0srxmxr iodoltnmfvs ()a2tm(rpnt0aptnmoeiadfm rl( pn() rxoxo tatlp ranvsl( t2umirpnudomt mncia( arumuroou1oexnii3iadfaDumums;u4arxomfcio1om   neo;s srtmxo nudll nmfcsas s2ua(mont1oeen ieiadlmDumnmon(0texnmr3ta1lm   ivol( t2uoxr ny1apt licilt a2rrur ;o0aee  f3iydfm rlnms;t4 lenxr3ia1opt aueolt) eurxmpou1omtnlnes ()a2tmumpoo1opt ioctadfm2uauvs (4trenio3oodlat anesls0srtmxm3nu1op n ietat)a2rax  ;u0tpxoiietlsls2elnms t) lxomr3oa1lpDrluvil( t2tmxopnydop emivtltfa2ua(r nu1ape mf3tytls2ranvont4 etrif3tydfa e uvs;s0srxo(rpou4op  mici (f 2uaxr ot4tltoiieiadlaDulnmsn()aetrmf tadom ran o ()seuriopoudal n ict ( a2tm(monu4tet mocilsls ul(mp;u0aetrxfcia1fp rau i;s  rtmirpno1am elfeiatfa2umur ou1aetnioeiytfmDeanms u)arxnmrcta1opDrau s;()truo(mpny4amt mfvi sf 2taxmpnt1aexn i3ildlmDua( s;u0 leoio3iadfpteaiesls) 2xr(mpiydam e nvtas aDta( o;o4aptnif3iydfaDuln s;u4alenirciodfm eln il()t2uo(o3iy4lmt lieta(farrauro;t1tlxnifciasfs rmnmp;u0 ltnmo ia1la r n i;()trxrxm3io4olenmfvils  2tmxrpnu4tpt mfciadlm2umn o t4aeenmf3tytfaD anes;s) 2uoxmpou1op nliciat) Drru  ;u1tetomf3ias sDua( p;(0 exoio iatoatr uvil( setoio iu4llte ict (fsDua(m ot1olt  fciytfa ua( snt0 etomfciytop   ieols) 2xr(o3ou4omtnmivtas srrm(r ;u1teeomfetasfm em( on()arxoioctydfatraieol(0t2uoimpou4amtemfeslt  rrmurpot4teeniiciadlsDrmnvsnu0areoxf3totopDran s s0 2uoir3iu4amtnlfvil(  rua(m nt1teeomi3iltfaDel( ont0aleomr3ootlmDe ivo;t  2xoir3oy1lp nlictlt) Dra(mo;t1ole  feiytfmDuau p;t4arxrmocoydlat aueil(0trtr(r oydap nlncta()s2uaumpou0aee  feiyd m rmums;() ltnxf3ty1fp elu sls tetr(o3oodlm nlfctasfsrtru  ;u0tlt mfctlsfaDran onu4trxoircio1latrlu o;s  2tmxr no1lpe livia(fsDrax oou4tptn i3tld aDeanvo;(0tetnir iadomDrln o;t srxr(opiodll n fetltf 2tm(rp;u0aetnif3iaslaDrlumsnt4trtoxr3oatlptran o s  exmio3oo4ame lieslt)a2rrx pnt0apeoifeilsls ua( s u)trxnmr iydopDe ues;()trtm(r3ou4op   fvsas)aDra(  ;u4alxoifctlt mDeauvp (0aexoxr oytlate i s;t0teumiopoudaleelicsa()srrmx p;o0oex iictydlmDuan s;()tlxoxocoa1omD lu o;s)trtmxrpoo1olt mnet ()a2tm(mpno0olxniieildfmDeluvs;u)alxrxrcoo1op elivslt)s2xoiopoo1lpen ivs ()a2tmxro;o0oet mictydfs2ea(mo (4 lxoxo ia1oa  aneils teto(m3nu4ameemivtl(  2uau  ;t1oleo oetys m emnvon()artrmrciy1oat lueilt) euo(r3ou4om e nvsl(fsDumxront4tle ii3tatlm2ul(mp;()tlerxo tydfm e uvs;()texo(m oydllen neia( sruaxrp;u4alt  oetlsfs2ulu pn(0arerifciy1fmDr nvo;s  exmxr iudap   fesat  2taurono0tlt  fetlsfm2rlnvs (4artrmr tatfpDran i;()srxr(m ou4lp e feiasf rumurpnt4tlen o3tasfm rlu s u4 leoio3iydopDrlieslt)s2toir3nudamt lici s sDtr(rono4tle  fctlslaDrm( pn(4 lxnxo3iadomD  nei;() rtr(opoy1lm  mfesa()sDumxrp;t1opxniicias s2eauvont)trtrmf tydlm rai s;t0trum(r3iu1ape mfcil() rurumont0ale  ociasla eln sn(0aetnmr3tytlateaueo ()trxm(r nodlltnmfcs t)s2tmu ont0teenmfeiatls em( p t)aetnxfcoo1fptr ueilt trxoiopoydoltemfvi s a2um(rp;t0apt if3iytfs2ran o u)artrxoctytlat aueolt) etmxm3oydam eliesl(f Dtr( ont4tee ifcilsfsDumuvs;(0trenxf3oytfatrli s s)t2tmim3no1omeemfci tf 2ur(mpnu1tptoiociydfa2rmums (4alxnio io1fmDranei s)tetrim nydop emietls)s2rmx o;u4apenmociyd s em(vp;u0 lxrif3tydlate nvo;s0t2urxopno1ame lics (farua( pno4ape ii3tytlm2uluvpnt0 etomr3oo1lm eli slt) 2xriopiy4lltemiei t s2uaurp;u4aee  o3iat m ulu p;(0trtomfctytlmteauei;s)s2ur(o3oy1ap emnvi s srta(ronu0optomf3iad sDum( pnu4tetrxfctatfmD  u ils trxm(mpiy1apeemncsasf Dtr(mpou1tptoiictysfaDrmuvpnt0tlenmf3oytopt livi t0t2to(m3oydlme mfcsl( s2tr(ront0oet  octlt s2rlu sn(4tetomr3oodfatrauvol( s2urxm3oudopt lnciatf 2tmu p;o4oltoiietadla2uluvs u) rerircia1laDr u s;s) 2tm(m3ny1al n fes s) rtax pnu0apto iciydls eanvpnt)trermociydfmD  n ils0 2to(m3oo4lpt lfetlsf Drax pnt4ole if3iydls2ran p u4 lxrxr3totoa r n i;s teumxo3ny4lltelfvi (fartmur no1alenmoctas a rluvont0aeeoxf iadoptr ies;(0sruoir io4altelnviat s2rrxroot4aex mietld mDem(mp;t0arenxr io1lpD ai sl()trxmio nudomee nctas  Draum ou0alxoiictyd m2rmnvs;(4altrxrciydfaDrau o;s teum(m oy1omtnmfvs tfsDtr( p;o1opto f3iydfmDemnvs;() ltniocoydla  ai i;s0 etmxr3nu1oleelnctat  Drr(r nt0tpx mf3iysfs2rlnvp t4tltnif tatlmDe nvs;t)t2to(rpoo4ap  lfei s  rrmurono0aex  feiadlaDemuvs t4aleoxr3oydlmDeaieo;s)setmxr3no1lmt livta(farrr(rpnu0oet ii3ildfsDrmuvo;u)aexoif3tadlmteln olt seurxrpiudllt mivtlt)aDtaxmp;u4texomieiasfm elnmo;t0treomo ta1lmD lnvi;t  2xmio3nodal n fvt t) Dta(ro;t1opt mfeiad a2em(mp u)teeoif oo1om rauvi;(0sexrio3oydlm nmfvt ( artm(monu0tptoiociatlaDeluvp u0trxoxfcta1om eau olt0srxmxr3iodapte fcsl(  Drm(m ;t0apx ioetltlm2rmu pn(4 lxnir3oatlaDe iei;t)srur(r iy4lmt mfvs (  2urumpno4olxo ieilslmDuau s u4teerir oy1lptelieo s)s2trxopnydlltnmivtlsfa2rr(r ot1alx  o3ilsfaDumu o;()aetoxf3iatlatrluei s)trtr(r ou1oleelnvsas)aDtmum ;t1oetnmo3iad aDrmnvsn()aetoir3tytfpte uei t0truoirpiodapeemiet (  rtm(  oo1tlt  oetytla2ran s ()tlxnmr3totlmtrlnvols) rtrirpiy4ale  nesat  2rr( p;t4aet mo3iaslm2ua( sn()altrxr3io1fpt livslt t2uo(m oo1ole  nctas)srtmx  ;t0aleo fciat s2ulnmpn(0treoirctatomt ln ol(0seumirpny4lpte feiltfa2tmx  ;u0tlt mf3ias s uluvo;t0 etrxfciytlm   ivi;s0s2xoim3iodome mnctls) rraxm nt1oetnmfetltfs2umumo;t)trxniociy1lmDeau ilt) ruo(o3nodlme  iei t) 2raumont1tlxnio3iatlmDelnms;(0trtoxf3tydop eauvi;s)sruo(mpou1ap   ics ( artmu pou0oleo fctadls rmumo (0alxoif iydlpt  u s s) rtoirpiy4olt lfei s arrm(m ou0aexniictldlmDulnvp;u4tetrmr iydlm r nvils0 2tr(rpiu4apeelfcta(f Duaum nt1tpeoiieilt aDrluvsnu)trerif oa1fpt luvslt  rxrxm3ou4amtelncia()aDtaum no0tet moetlslm2ulnmsnu4teermo todfmt  n o;t)srtrio iydaltelneil( aDrmx  nu0oee iociltfm2el(von(0tlenxr iydlaDrlivil( s2urxm3iydape lnet s aDtrumpot4opt mociyd a2ra(msn(0aeenmocoy1fpDrlu ol(0 rurirpoy4omt mivsat)aDrmxrpnt0aeen ieiltfa eln snu) etnxf3tadfpDraiei;()truoio3oodop emies tfsDtaxm nt0olxnmieild s2rm(mpnt0 ltrif3iatlpDraneo;t sexr(m oo1lltemnesatfarrrxm nt0alxnifetldla rmu snu) lxrir iy1lmtelivs;t) rxo(o3oydop e ncias artmx ono0apeoifcild a ea(vs;(4alxoxrctadfpD aieo;( t2xo(r iudopenlivs ()sDuaurpou0teenmfctas m2rmnvp u0 rtnmfctytoaDrliei t t2uoir3oy1op   nvs s  2umumpnt1openmf3tytfs ulumpnt4arerxr3iydfm   ues;s0setrxo3oodop e nviltfaDra(mpnt4apt mf3iasfm2rau pnu0 rxoir3iodoa elu o s)truoxm oo4om nmfcslt srurur nt0aeeoiiciatfmDrmuvs;t)artomr oadomDr ues ()setrxm nu1lp  lictlt  2urxmpnu4optn fciaslmDrm(vp u0altomr3oadfp rlivo;(0s2tmxo iudam e fcias) rtaxm ;t0tex io3ilsfaDrm(mo;u0 leomr3iodlaDeluvs;t)tetrxopoy4lm   nesatfarraxmpnt1tleo ieiatfmDuaumonu4arxomrctytlmtraivs;s  2tmio nodal elnvtlt a2umumo;t1apxomiciydls2uanmpnt0altoxo3iatoptr ivo ( truriopiy1oltnmieias)srtaxm ;o1oetoii3iaslmDemnmo;t0arxnmocoy1omDeanvs t) eum(o3iy1apen ies (f ruaumoou4teeniieilsfa2uan p (0altnmf iatfp r u ol(  rurxo3ou1apenmfvi () 2urx  ;t4tlxn f3iltlaDelnmpnu4alxnxfctydlpt aivo () eumimpiy4oleelfvias aDrr(rp;t4aeen oeildfa2uanvsnt)aetoxr ia1fp  ln o ()texrir oy4ll nlfvslt s2rmur nt1apeoiicildla el(ms;()aexoio3oadfm  anei ( t2toxm iodlmenmncs t) rrruront0aptoioeiydlm2uau o (0 lxrifctytfa r i o s0truoxopio1openmnctlsfa2rmur ;o0apx iieiatfmDelnms t0altnmo totlp r nvslt s2xo(o3nodlmtemicilt s2rmurp;o4ope  o3iad aDelu s t)aexrio3to1lpDeluvs;s)sexoirpnodom n fvi (fs2rau ont1aptnmietltfm2rmump;t) rxoxf to1laD auvols  rxr(m io1opt lietas a2trur nt0ale  f3iyd a el(vo (4teeoif ootlp  anvs s) etm(m iudopt livs () Dur(m ;u0tpx io3ildls2rmnmont4treoirciy1fpDelu o t)trurxr iu1ome lnei (fa2tmu onu1tpeoifeiyt s ua(vo (0tlerif3tydfa rluvsls) etoxr3iu1apte ict (fsDtru o;t4tpxnmfciydlm uanmp u0altnmf to1om  li sls0 2xrir3oudopte ivsls a2urx pot4oltniociysls rlums u)altrxo3oadlm  anvs ()trxo(opiydamenmfvilsfarrmx poo1tlx iieilslaDranmo;t0teermf oodfpDeliei t setrim3no1openlnesls)srra(r no0alen f3tadlaDelnmonu0 rxoirciytoa e iesl()s2toxmpno4op   fcsltfaDtr(rpnu4oee mi3tatla um(mp;u) etomo iodomteau ils)s2urxopiu4lpen nvtas s2rrxm oo1texnifetad aDuaumsnu)alxnmoctadom elnesl()t2uoirpoo4amtnmnvilsf 2rrxm ot1oexn oetys mDem( pnt0 eeoxr iy1oatrli i (0trtoxrpou4op elnctl()a2rmxrp;o4tlx iiciltfa2rmuvp ()aleoio3ootoateaneo;t0seumxrpiydam nmiciat)s2ur(r no1ope  oetyd s2rmuvo (0 renxocoydfp raieolt  rxr(m3oydal nlncil(f Drrumoou0tet  o3iaslmDea( s;t4tlermf3ia1lm raieo;t s2tmxr iu1ol  livsas)artmumpot0tptnii3iadfaDemuvpnu)tetrio3tytopD lu o t  2ur(m nydlltnmnctas) 2uru pno4apx  o3tld s2eauvo;t0 rtomfcoydlp raiei;s) rurirpno4amtnmictl( s2um(ro;t1openifciyt mDum(mp ()arerif oa1omDr ivslt0srurim3nu4apeemivs t)a2umxmpnt1olxniieias mDuluvs;(4 eerir oydoaDrlnes;t0sexriopiudalt miciasfaDuaumpoo0aptnio3iasfmDemnmsnu0 lenir oydopteau i s) ruoir oo4lptelfcs ()s2urx  oo0oltnmictldfa2rmu s;t)tlxoircta1opt  n i;(  exoimpiodapt mivia( sDtaumoou4apxomf3iat s2rau s (4 rerxfcoy1fatelueol() 2tmxopny1aptnlies t sruau  ou1oeeoio3tltfmDulu s;t4 lxnir ta1lateluei;t0t2toxm3no1omte ictlt  rtr( pou4opt moeilt a uaums;(4texrmrciatopDeanes;t0 2tmxr iy4ll nmivsat sDtmu p;o1opto f3iatfm rl(vo;(0tlxoif oy1oaDeaueilt)t2xoxrpiodlptnmfesat  rtmxrp;t0oeeoii3iltlm2ran s ()tlxrmf3oy1fat  ueo;s0t2tr(rpnydamtnlnvtl( aDrax ono1ape  ociys m elumo;u)tetoxf3oatfm rlnvilt) exoir3oo1am e nvi () 2umu pnt0tpe mociysls elu o t4teenmr to1lp  aivi;t  2um(r ou1op elnvslt)arur(m no4tlt moeiyd a elu p u4aetrmr oodlpte ivo;( trxmirpoy1alt lfes sfsrtaur oo1ope ioetasls ulums;(0texoioctadomDeauvi t srxm(r iodopt  feilt  Dumum nu1oexnmo3tat sDeanms (0teenmr ta1opDr u i;(0t2xoir3oydapen fvtas  2umur ou0tet miciytfmDemnvpnu4tlxnmf tytlm e n il( srumxr3oo4opt lfetas)aDta( pnu1tpe moeiadls2elu s;u)tetrxr ta1om rluvslt0s2trxo3no1lm nmici s)arumxm nu0oleomictltls uaump;u4teenmocoodlptraneils0t2tmxmpnydamee iesa()aDtm(  no4opeomfeiad sDraumo u)tlermr oo1lp e i ils  exrxr3io4lmteliet s a2umx poo1tlxoifeild s ra(vo (0areoio3tadla r nvo;t  exoxrpoodlp   icta( a2um(m nu4aexn ociasfsDrmuvo;u4arerxocoodop elies s setoxm iy4lmenmnetat  ruau  ot1tle  oeiytfaDuaumo;u)tlxoir3iotfm e ueo t setrxo nodlpt livs s arta(rpou0tetnioetldfa ranmp;t) lenmr3ootoa  anvi t)s2uoxr io4alt lfvias)s2ta(ro;u4oleomfeilslm umump;(4tlxomr3ia1opt  nvs;s t2xmirpoy1lmenlneias)sDururpnu1aeto iciydfaDrmu p t0treoif3oo1oat lu ils) exrxr3oudlmtelictl()sDrr(ro;t1opxoiociasfm emu s (4 rxnxr3iodlmt lueil(0 eur(o3nydap elnvs t sDrrumooo1oee  iciatfmDelnvs t0trerxociytopteln il()seumir3iy4ol nmfeil(  Drr( ooo1tet  fciadfm2ua( pn() etnxr3io1fpDr u ols)seto(mpoy1omtemivt s aDtrx  no4aetnmi3iytfs umuvs;u)artnirciodfmDrlivo;() exrio3oydapenmictl(f Dur(ro;u0ape ifcildfa2rl( o t0trxoxo iy1oate nesls) 2xrir3io4amtemfct t)s2uauroot4apeo fetydfmDea(mo ()teenir iodfmt  nei;() 2xmxo3no4ameelici s) 2urxmooo1oeto oeildfmDulnmont0 rxrmf iadlateaiei s0 2xr(opio4op emnetas) 2raurooo4tlx iietytls eauvp;(4tleoirctadomD auvs s srxrxopou4amt mfcil(f Durxm ;u4tle mo3tld m uanvo u0tltrmo tadlaDelieo t)s2tmimpoudomenliei ()srtmxm oo1tee io3tldfs2em(ms (0tetoxocty1lm e n i;( seumiopoy1lmee fetlt  rtrxm nu1aetnioeiad sDrlnmpnt)aleoif3iytlmDelivil() rtoxm oy4ap e ivi s)a2rr(ro;o1oltnifciltlmDemums;u0 renxf to1oat  uvo t  etm(mpnu4am  mnvtat a2ra( o;o4oeeniietls m2elu s;(4 rxnioctodfmDrauvo;t0s2tr(opoodopenlictasfarur(mpnt4tpt mieiytlm2umump;u0 lxnmr3totlmtr ivi;() 2urim3ny4op nlnvt () Drax pnt0apenioctldlsDrl( p t4 etoxf ta1fpDraneo;t) exo(o3nydaltelnetltf rtau  no4tpto oeiasfa2rln pnu0 rtoxr3iydfp  auvo s0srtriopoodop  lnctas a2umump;u0apxo fetaslm rln snu)trerxo3ia1lmD anvslt t2xoxm3nodop  mfcs t srrrurp;o4tlxo fciys aDuan o;(0tlxrxo oo1fmt  u s t t2um(o oudalt lfvs t srtr(moot0tlxomi3tyt s2rau p t)altrmr3oytoa eaivi s setoxr3io1llee ici () rumur ou0olenmi3ildfmDuanmon(4aexnir oa1laDrai s t0t2uoxm oy1ap n neslt s2um( pno1optnifetasla2uaumsnt)tlenxfctydlp  livi;( teuoxo3no1llen ncsl(fsrtrxr no0texoioeiadlmDranvp;() leoio ia1oaD aivsl(0t2xrxo3io1omt  ivsls)srtm(rono4oltnmoeiadfa2ulnvo u0tetrioctatfpDrlieols  2xmir3ny4oltn nes t sDtr(mpnu4tee mo3iadlm2uluvpn() rxnxr3totoa   ivs;()sexmir3nu1lmen ict (fsDta(  ;o0optomociasfm2eanmp u4 rxoxociadlmDr ivi;t)s2xo(rpnu4om   ivtl() rururoou0opxnmfctatla ul(vp u0tltomfcoadla eanesl( texoxm3iydame  nctatfs2trump;u1tle ifcild aDrauvp;(4trerxr tatfa eaivs t0srxrxo io1omen icias  2taum nu1texn f3tltlmDrl(vsnu0tlxrxr3oatomDrai olt0 etoir iudal elivsa(  rtrxmoou0altnif3tldlaDum( o (4aleoxf to1laDeaies;(0truoio3iu4lleelnvtl()a2tru pnu1oet mi3iydfmDelnmsn(4altrif oodlm eanvo;t trxo(m no4lptemnetl( aDuaxrpoo0olx mo3iytlaDranvon(0 rxoxf3oadfmDrau o;t0 eumim3nodlp n fci sf rra(mooo4tpenio3iat sDelnvsnt)texrif tatfp rlueo (0t2urxopno1lle mfcsat aDraxmpot1tleoiociatfm eau s;u4tltnio3totoaDean il()trumirpiu4lpe lnvs tfaDtrx  no0aptomiciydfs eanvp t)tetnmoctydlpte ies t0 rxm(r iudopt mieiltfaDtmx p;t0tlt mo3tasls uanvsnu4 eenmf oytop  li olt0s2xmiopnu4apeelfcsl(fa2raxrp;o1tpeoio3iatfsDeau s u)tlxoxociytomt ai ils0texo(mpnudolt mietatf rur(m ;u4tlt  oeiadfm2em(msnt) etomocty1oatrauvi;() 2tmio3no1lmeelfet tf rta( onu4tptnii3iltla2rl(mpn(0 exomo3iatlpD  n i (0 2trxm oy1olen icsls)s2raump;u0tleoioctytla2rlnms;u4aexomo3oodfmD livsls)srtoirpoydap nlfetlt  Dum(  nu4oleomo3tat s em(vs;t0trtnircoodoaD auvi s s2xrio oudamt licsat s2rm(ro;u4altoiieiatfa2uln s (4 eenxo to1lm rai s s  2xrxo3ou4omeemfvslsf Dua(  ot4teeo o3tys s rluvs (4texnxf iy1omte uei;s0seurxrpiy4omtnmfeslsfa2taxmpno1tpt ii3iad aDean o;(4tleoif iotlm  luei;t  etoxrpoy1lpe mnci tf rtmum ot1opt mi3ilslsDul(vo;()trxrxr iatla  ln i;s)teumio3io1lmen fcils sDtaum ot1alxoioeias s2el( s t) etrxfctytlptraueol(0setrxm3iodom elnet (  rum(ronu1aexo f3ias m um(ms;u4arerxocia1op rlieil(0 2trio io4aptn fvt t aDua( ont4apx iictlslaDrm( pn(4aexnir oatfmtrlueils0sexr(r3oudlleelivt t  rtrur ot1aexomf3ildfaDul( s t0 rtomr tytlpt an s (0 2uoxo oo4llt  ivs s  2tr(ronu4tltnmociad s2uanms;()teeoiocoy1omte nvo;(0texo(r3no1lmt lfvs t aDur(mono0oltomociys mDraumsnu) ltnmo iatlatrlnvslt)t2xr(mpno4olteliei s  2uaxmoot1tet moeiysls2el(von() ltnio3ootoatrai o t0texr(rpiy1llt  ncias aDtru  ou0teenmi3iad aDrm(vs (4trtrifcootfa rluvo;s0sexr(r iodlm  micsatfs2uaxmonu0aeeomietls m2ua( o;t)aexrxrcio1oateaieilt t2xrio no1lmen fcils a2ua(mont0tptoiociadls2em(mpnu0aexomocootomDrln s t  rumirpno4apee nvtl(faruax o;u1tlxnmieiyslm rluvsnt) ltnmo oydfa   u o t) 2uoim3oy4om emiciatfsDrmxroou1oltomf3tasfm2ra(mont)alxnmrcoy1opD anesl( t2tm(opno4amtnlnvta( aDurx pno4alt ioctat aDrmnvpnt0tltoio3iodlm e n sls t2xm(opny4amte fvtltfsrrmurpnt1tpenmictatls2rmu p u0aeerxf tytopt au o t s2xrxrpiy1ole lfvsl() Drrxmoou1aptoifeiltfm2emnms (4trerirciy1fateauvi s)srumxm ny4omtnlnctls  rumu o;u0tpx iictlslsDel( snu4 eenmrcio1lmtrlnvi s teur(m3ou1llenlnvsls)sDum( p;o0apx if3tasfs rmnvon(0tlenir ootlptelneilt)trumir3iodlmenmncta()aDrmxm ;u4oet mf3iadfm2el(vo (0alxnxr oytla  lues;( texm(m io1am n ies t)aDurxr ot4ole  o3tls sDulu o;u4aeenxf3io1lmteanvols0sexmxr3iodll n ivi ()artru  ;t1tet moctydfs em(vs;t4 exrxr3ootfpDrli o;s t2uoim ny1am nmnvilt)a2tax  ot1tlxnmfciatls emu o;(0 ltnif3oatomtelnvils)t2uoir no1llen nvt s  Duaum ;o0oee moeiys mDuln s u0tetomr3ta1fate iei;(0s2xoio iodoptelivtas  rtmxrpot1tlt  ocilsla em(vp;(4aetoxf to1fmDr ies;(0seumio3no4alt  fcils  rum(ront1optnifciys a2umn o u)tleoxr todlat  uvs (0seurxm3oo4al elfcil( aDumxrpnt0apen fcildlmDelump;t)tetrxr3oo1fa e uvs;t sexoim iu1alt lnvsl()sDrmumonu0oetomiciadfmDra(vs;()aetnxo3tytlaD  ivolt) exrxr oo1al  licils aDrm(rpou0apt iociydlm emump t0alxnif io1latr ieilt t2toirpio1om n iei (fsrtaxm ;o0opeoif3ias s2rmn o;()aexrxr3tydfa rlieol(0t2xmxrpnudlpeelici (fa2urxmono1apx  fctlsfsDum(vpn(0trxnmf iodomte n s;s  rtmio no1apenmivsl()srumurpou0oltnif3iad sDelnvp;t0 rtnmfcia1lpDe uei;s) 2uo(o3iy1altelnei ( sruaxrpot0ole moeiat m elnmo;u)alxomo3oytoatrai o ( tetmim3nodome mici t  rtmxmont0tpto i3tltfa um(vp;()tltomo3iodfp  luei ( t2toim oodlp nlicias)a2rrum ;t0texomi3tydla2eaump;(0alxrif oo1op e ues;s srto(o iudllt livsat arumxmoou4alx moeiyd s uanmon(4 lenmo3todomteaivs t  2tr(rpno4ol  lfvt () 2umurpnu0oexomfciadla ranvon(4tlxnxf3totlm  an ols  2xm(m iu1llenlfctl()arra(  ou0tptnmfcilsfaDrluvs u)aleriociy1latran ols)teumir3iydamtemivilt a2uax pou1alxoif3ils m2uan s;u0 lxomo3to1om   nei;s  rxmio3ou1ol   fvta( aDraxmont0apeomoeiytfs uauvo (0tlxrmf3oy1lateli o (  2xrir oodll  mnviat)srrax  ot1tpe  oeiytfm2ranmpnu0tetrmo iy1laD  nes t0t2toxr iydame mfvi sfsDurxmoou1altn f3tlt m elu o;u0arxrxr3todfmDeluei;t)s2urxo iudal nmncs tfaruaxm ot0aeto fciytls el( p;()artnxf ta1la eluvo;()t2toxmpiodlltemiei t  rtmxm ot1tltnio3iatfa uluvpn(4arxoxocta1fatr ueols)t2tmxo nu4al emivtas)a2rm(mooo0tpx io3tasfa2rmn p;t4 leoiociytoaDeauvo (  exoir3nu4om e nesatf 2uru pot4oleo f3iad m el(mp t0tlenxf oytfa eanvi (0seumxr3ou4lmee nvtatf Dua(m oo1apx  o3iltla2rluvo t4aeenmr3oatfpD  ieo;t0 rtrxm io4lltnmfctls)a2trumpoo4tetnmf3tlt m2eanvs;t)tltomo oytlp  li i;s0 exo(rpiy1apenlfciat)sDumxmonu4opxoioeiasls el( o;u4tltomf iadfaD  n sl(  2urirpiy1lm e nvtasfarua(r ou1alx iieildlm2uauvs;t0aeerif3iadfmDrauesls trurim iodoptn ncsltf rum(m nt1apxnmoeiat aDeanvs ()tltrmr oy1fpteanvs (0 2xm(o3iodam  mictat  Drm(mp;t4oeen o3tadlm rm( ont4aexoif iadfmt lu i;t)t2uoxopoydop n ictat arrr(rpnt1opx  i3ildfm2eaums t)trtoifctytlmte neo;t0srtm(opoy1ll   nvtls) rtaum ou4aptnmf3ilslm2rl(mp;u)arerxfcto1fa e neo;s0texoim3nu4openlivil(  rrr(ronu4altomociasfaDulnvo (4aeeoxf iytlp elivo s s2xm(o3iu4omte ivs t aruaxroot4optn ictasfs rmuvo (0artnxrciydfaDeauvs ( srtoxopoodam emfvtat)a2tr(ront0tet iieiyd sDrmnms;t4alenxo oodopt lnei t0 rum(m iu4apeemnesatfa2rau ont1aeeoif3tadlmDem(mp t) lenmf iotopDraiei s) 2xr(opiy1ol  mieilsf Duax o;o1optn feiaslmDrmu s;t) renmr3iatfm   n ols0 ruoxopoydom e fvslt)aDrrxronu4tlen fciatlm2umu o;u)trtoifcta1oatrlneslt) 2um(m oydap nmivil(farrmx p;u4tex ioetadfm rlnmsn(4alxoxo3iydfm eauvi;t)s2xmio3iu1amenlict (  2trxmo;t4optoioetat m uauvon(0tlerxr3tadfa rluvs (0s2umir3io4ole mnctat sDtmu onu4texomfcildls umn p (4alxomf totoptrluvs;t)teurxo oo4opt mivs s arur(m oo1tpxn fetltfaDrmn o;u0artoxrctadlat li o t0truo(m3no1lpeelnvt tf 2ra(  ot1altoiicildfa uanvsnu0tltnmr3tatlm e nvi () rxr(mpiu4lp elfcilt)a2ua(r ou0aex moeild s2rlnvon() rtomo todoate uvi;(0sruoxrpiodomen nei s) Drauroot1teeo iciys mDra(vpnt0 lxnif oo1fat aneo ()trto(m3nodapenlict tfarrax  nt4oeenioetasfs ean pnt4 exomr oytomD aivols)s2xoir oodal emfctasf ruax  no4aet mociatlsDrm( o;(0alxrmf oatfmDrlnei;s0srtm(m3no1aptnlivias sruaxmpoo1teen ieiytls emnvo;t0 rxrxo3oatoa r ivi;t  2toimpoy4al emnesa()aDrrxr ;t1tptn fciat a2ul(vs;u0 ltoir oa1lptrlu i ()srumxopny4apte fetas aDtrumpot4apxn octatlmDum(mo (0 lenmf oy1fa  lnvi ( seum(o3iodllt mfesa() Drr( o;o4optnif3iasla rln s;u)trtrmocta1fpD  n slt  2toir iudlptelfctlt  2rax oou4apeomictytfmDrl(mp t0aetrxoctydlateanvo;s sexmxopnudop nlfesatfsrrm(r no1oee  fetltfm elnmo t4trtrio3oy1opt auvol()sexo(o ou4ome mfetls arraum no1aee if3tatfs ranmpn()aexrmo3todlmt aneolt0 2trio iy1llt  ictas)artmxm oo4tpe io3ils aDumums t4tetoxfcoodomtelueo;s  eto(mpio1ll  lieta() 2tr( o;u0oetomfciasla2rlumon(0 ltnxr tydfpDeau o (  etrio ny1am elicslt)srtru pno1ope moeilsfa uau sn(0 reoxrcoy1lpt  nvo;()teuoxr3ny4amen fcs s arurxmpot4opx io3iat s eluvp;t0trtnif3oatoatelnvslt)trur(r oo1ole mnvils aDtaxmo;t4alenmf3tyt sDea( snt4alxoif iydoaD ai s ( t2xmio oudllt  nvtat a2rax onu0tpen ictldlsDuanms;() lxnxr3tytfa r n o;s  exm(m nudale mieias sDua(ront1texnmieiaslsDelnvp;u0 etomr3iadfaD aneol( seto(r oydam emneta(faDtr(mo;o0apenifeiytfs elumo () etrir3tatopte uvsls)tetmiopiodlltn fcia(farraxrpoo4tetn f3taslaDrln p;u0 etomoctytfm rlu o s)setrxm iy1ap  mieta(farum(mo;u4tlx  f3tasfmDrmn pnt)trxoxrctydfa elneo t trur(r ou1op emneilt) 2trumpot1apx io3tytfs2emnmsnu)texrmo oodomDrluvolt0 2tm(r io1om  lncsat aruauronu0olt mieiydfa eau s;(4aexrmrcootlpDr uvo ( s2xoio3nu4lptnmnvs () 2rmxrpnt0oeenmietytlsDea(vo ()tltoif oadoaDeauei s)teumxrpno4oleelfvs () rumx ono4ole iocils s umuvp u4 exnif3tadlm eanvo;s) etmim iudllen ivtl(fs2trx  ;t1tlt moeiydla ra(vsnu0altrmo oy1latraieslt0t2urxm oydol   ivsat) 2ur(m nu4aptnmo3tatla2em(ms;() rermrciydomtraivo ( tetoio nydom nlicil(  Drrxrono1alen oeils a2ulnmo;t4 lxomfctadopDelnvilt) rxo(m ou1ape lnei t) Duaxrpou1optnii3ias m umuvp;t4trtomfciydlmt ln ils) exmxm3no4amenmicias)s2uauro;o0ope  oetas aDul( s;t)teerio3tydlmteluvi;t0 eumxo3no1op elfetlsf 2ur(  nt0apx  icildls em( p (0aeerxfcty1oaDe ies ( trxm(o nydll nlnvt t arrrum nu0tlxnif3iadfs ua(mont) lxrxr3iatlmDrlu slt)setoxm oydom  mnetatfarurxr ou4oee  o3iysla2umnms (4aeerif3tadlaDraueo;s)t2tm(mpno1lmt  feslt  2taumo;o1open oeiadlm2ranmpnu4 leomf3to1lm elnvi (0 euoir3iudlle mfcs s a2urxm nu0texn ociyd s2elnmo;(0tlxrxocoytfpDrauesl( t2xrxmpou1alt mfvs t  rtmxrono1alxniociysfsDeauvp (4aetnir3oy1oa eln s;s  etm(o oodale lnvil(fsrum(r ot4texo oeiadfa rau pnu)arxoio iotlpD au sl()s2xo(opnu4omeemfet ( s2rax o;t0apx ifcildlm2eauvs;t4 etoxocoytlmtrlnvo t0s2ur(m3io1ale mfvs t srtm(  no0apx iieiatfmDul(vont) rxrxocto1fa  lnvilt srtoxr iu1oltnlfct s)sDraxro;o0ole ifciys s2raums;u4arerio3iotlptelivs ()srtrxopiodlm emnciasfsrtrxrono0altomi3tad a elnms u0aleoxo3io1fpDe ieo;s  ruoir3nu1ap nlnvs t  Drmu poo0olen i3iat a umnmo () lxomf3oadoptr i slt0trtrirpio1alee iviasfartm( p;t1altoifeiat sDua(vo;t4 lxrif3ta1omtrlies () 2xoxrpoy4al   ivtls) rrmxro;u4tpxn i3tydlm eanvo;u)alxnmf3ty1omteauvo;(0s2tm(m oydlmen nvs s) Dtm(m oo1tltnmfciys m elnms (0alxnif3to1fmt  i sls0t2xoxrpoo1amt mfvslt  rtm( pnt1teenio3iatfsDemnvo;t4alxomf3iydfp   uvsl() 2urio3iudomte fvt s a2rrumpnt4ape mictltfsDulumpnu)aexrmr3iydopD liei s0srtm(opiodapt mfvt (fa2ur(  nu0apxnmocias aDran o t)tlenxr3ia1oaD auvi s0 eumirpoydom n ivtl() 2taurooo0apx mfeiltlmDumnvp ()altoxrcoa1lmt  ues;t trxrxrpou4ol e nes t) rtm( ooo1alt  ieiat sDrmnvs (0tetnxf ootlp rau o;() 2xmxm oydal  miviat)a2ra(ro;u1teeomoetld mDulumsnt4 ltrxo3tydfa   uei (0sruo(o oy4apenmfcta( arur(mo;u4opxnmfeiadlaDrlnmo;u0teermr ta1lpt aies;()t2tmiopoo4omeeliesls)arrau o;t0oexn f3tyslm2rlums;()tlxnir3iadfaD ai i (0 rxo(r3iu4ameeliviltfs2tmxm ;o0optnmoeiadlmDrau s t)texnxo tytopDr nvi;t s2xmio3iydlpeelnvtatf rumx pot0apt mociatla umn p t4 ltnxfctodfp   i olt truo(m nu1amenmnvi s a2tmx o;t0ape ifeiydls2rln snt)tltnxo tatoat  ivo;s setmir nu4opee fvtltfartau pou0oeeoiietys mDul(msn(0 leoxo oadlpD anes;s) 2trio3iudopee fcilt aDra(mpnu1oexo oeiyt a2eanmo (0aetnxf oydlmD an o s teto(r ou4lltnmncsat) Dtaxmonu1tpxomfetaslm2emnvs;() lenmocoy1opt aieo;t0t2umxm3ou4lmtn fctl( arurumont1alxomictad a rlnvo;()aexomf3to1lpD  uei;s trurxr no4oleemictlt) rrmxrpou0olxomfctytlm2el(vp;u) lxoxoctadoateaieo (0sexr(r3oydopee fei s artauroot4tptomoctad a2rl(vs u4 rtriocio1laDraivo;s0seumxm3iydapeelnetl(  rurx p;t1tlxoifctys a2umn snt) etoxr3tydlmDeau slt  eur(opio1om  lfvsa(f rtax pou0tpt mfciys s2ranmpnt0texnio3tatla elnvs (0sexm(rpiu4lltelictl()sDrrxroou1ape  o3ildfs eanms;t0aleoif3tatlateln ilt) 2toxmpny1lp n ivt t sDtrx  ;u1aee ioeiydlm2uauvs;t)alxrirctatlmD lnes;t) 2trimpou4omtnlictas s2uau  no1aexoiocilt m2elu p u0tetomo tytfat aivsl() 2uo(m ny1ap emivilt)arrm(ro;u4ole ifeiysfs2rm(vs;(0arxnmo tatla   n s t) eumxopiydamtemivsltfsDrm(m ou4aex mi3tasfm umn sn(4trxomocta1lmtr ieo;t)s2xoim ou4lltnmfcta()a2trxmpnt1oexn feiyd m2ra( p u) renio totlm  aieolt s2trxr nu4openmici (fs2ra(mpnt1alt mo3tltfa2ra( p;t)trtomr3tatlat  ieo s trtrir oo1lle mnes t s2rmumpot0aptomoctadla2eln p;(4 etnircia1opDe u o ( s2xm(o no1lpt mncil(fsDraxmont1aet iieils s2rmnmpn(4teermo3tadlptelnei t0 etoir3oo1apte fvilsf 2rmxr nu0apt ii3tadlaDelump () exrxr3oadomD anvs s  rxo(mpiu1openmfei sfsDta( p;u4apt  oeiytfmDeau onu4tetoif ia1lat  ues;(0t2trio3io1lltelfcs ()arur(root1ale ifeiltfaDrm( onu0 etnif3iodlmt lnes;()t2xoir3oo1altnmfvtls)srrmum ;u4oexniieiadfs eluvo;t)artomr3totomt  nvi;t0s2xoimpio4lltn nciat) 2trxrpnu4texomictld s ran o u)arermf tydfm elnvi;s  eto(r3oodal emnet s srrmum no1tpx  i3iydls ea( p t4aleoio3iy1lat lueils  rum(o3oy4ll n nct t  2umur nt1tetnmfeiadfmDelumont4teeoxr3todomDe n i;s) rtoxm3io4llenlfvtatfs2ra(m ;u0tptn ociat aDeaump ()altoxr oy1fmt lu s s0srxmim3nu1op   nctlt  2tmu p;t0oeenmfciyd a em( p;u4 ltnmfciatop   nvo t0t2toirpnudalte ncsatf 2ua(  ;o0texn feias m ea( snu0 ltoir oo1lpDraivo;(0 rurimpno1amenlfesas) rraurp;o0tlenmieiltfm2rm(mp;u0trenmo3iodfmD luvil(0 exrim nudole lnctls  Dumurpoo0aleo f3iyt m emuvp;t0tetnmocoatfpte uvs;s0srtr(m3iy4optelivtl()sDururont1apxomiciyt aDem(vp;t0 rtrmr3to1omDr ues t0tetoiopiodoptnmfci s  2um( pnt0tlxo feiatlaDelu o u4 lermfctatlateaies;t srxrxo3oudap nmiesls  rta(rp;u0tlt moctld s2eauvsnt)teenif tytfa  aneo t)srtmxm3oudole lfeslt aDrrxmpot4aexo ocildlmDrauvs;t4teenifciatlmD auvils)sruoxm3ny1am n netlt sDrrxr ;u0ape iieiatfa2rl(vs;(0 eenxoctadlaD  iei;t0s2xrxr no1lmtnlfctatfsDta(mpno4aexn iciatlm2eanvs t0 reoif3tadfmt  n i t0 rtoxr ny1apee iet sf Dta(ro;o0alt if3iysls ean o;(0aetoir3ta1oatranvi t  eumirpny1olen fvs ()artrur ou1ale ioctysls rmuvpnt4 lxoir3to1fmt  nvi;t srto(opoo1ap elnet t) Duru oou4ope mo3iyslaDemumon(0 rtrxo iytfp e n sl()seumxr3oo4ap elncia(f 2um(mpot4apt mfetlsfa uaump;t) eeomf ia1op  aivsls)s2xmir oydlmtnlnvsas)aDrr(rpot0tetn oetadfaDrlnmp;t0tltrio to1fpDrlies ()t2um(r oudaltn nvi tfsDrmxr ;t1aeeoiieiys a2ra(mp;u4aeeomf3ootlpD an o;s0 ruoxo3oydllenlivilt) Dta( onu1opt  f3iatls elu p;u)artomrctytlmD  ieslt0teumxo ou4lpte ivilt srtmx oou4oex mi3tys a rl( o t0alenmo3iydfaDrauvol(0 2urimpiy4aptnmnvia(farum(r ou1tpt mf3iltfsDuan o;()arerircty1opt ai s s)s2uo(m ny1opt lfcilt)aDtau o;t4oexn ociys s2ea( snu4aeerif totfa  aivilt) etmxr iydaptn ivsltfarurxm ou1aleomiciad m2elnvp ()trtrxr3oo1lmDrln slt0 etm(m3ny4lpt  ivsa()aDururpou1apx  i3tys aDuluvo t0aetoxf iytoptelnvs s0t2ur(mpiudal emfesl() rrau o;o1opxn oeilsfsDemnvpnt0 lxomf3oydlpDrluei;() rxm(r3oy4lpeelieilt)sDtrumo;u4apenio3iat m ulu p u4trerioctodfaD ai i ()texrxo3ou1optemivi t aDua(r ot0tetnifeiydls2emnvo u) lxnxfcoodfa  lieol() 2xrxr3iy4op  lnviat) Drmump;o1tpeoio3ildfs2uln p u4 renif oo1fp   i s s)trtoir3iudamt mnvil() Dtmumpnt0tptomoetytfs2emump (4aetoxfciytla rau s;(  rurim io1aptn nctl(fsDrr(m oo4olxniietltlm ran p t0aexomociotfpDe i o;t) eurim io1ol nlfcs t a2rr( oot4olt moetytfs2ul(vp;()artnxf tatla eauvi (0seuriopiu1om e ivi ( sDurx pnu0teeomi3tydla2elump;u)tltrmfcty1lmteluvslt0setr(mpoo4opeelivta(farumump;t0aeenif3tasfsDua( sn(0trtnmo3todop elues s s2trxm3iy1ame lfviasf rrm(  ;t0apt  ietys m uan snt) etnxo3oatfa rlivs t0 2tmxmpoy4lmenmnvi sfsrurumo;u1aee ifciasls rl(vo;(0alenxfciy1oa  anes s0 euo(m3nydomtnmictat) Dtru  ;o0aptniictltfa ul( p;t4treomo tytlaDeanvol()t2xrxmpnu4lmtemietatfa2uaxm ou0oltnmoetldlaDrmu p (0arenxrcoatop  lieo s0t2xmxr ou1llt  ictas) 2ta( oot4alen oeiytfs uan sn(0aexnxoctadla rlnvi;s s2xr(r iy1lm nlnvia()sDur( p;t0tlxomiciltfmDem(msn(0aeeoif ia1omDeanvi t truoxm iydlm nmfes t)srtmxmpoo4openmietls sDrmnms (4tetniocoa1fp  lneolt)srxoio ny4ll elfvsa()srra(m ot4olxomiciydla2eanmsnt) ltomfcoy1la  au olt0 2urio3oy1apt micilt a2umur ;u0aetnio3iad mDuau ont)alxnircoa1oa  li sls0 rxoiopiydom elnvil( aDraumonu4alx  f3ilsfm ul( on(4 eeomo3iy1fa  au i;t s2to(mpiudom emiviatf Dtmxr nt4olxnmi3iytfm2emu sn(0trxrmr3oytlm  li slt0s2xr(m oy1ol nlnetlsf rtru  ;o1opx micild sDumnmp t4 lxnmf oy1optranvo;t)s2xoio ou1optn feilt s2tmu onu1tpt ioeiyt mDelu p;u0trxrif3ootfmDelnes;t  rtoim oodoltn ivsa(f Dta(r ;t0alxoiictatfaDuauvpnt)altoxr3iodfat luvilt s2um(rpnu1lmt lies s) 2uru  no1olxo ieiys a2ua( p u0tltrxo oadlat au o;s0tetmimpiydopte ictat) 2uaxmpnt1alxo o3ilt a2rm(vo t4arenxr3to1lp raies;s0srur(rpou1omee nvsl()s2taurp;u4apxnioeiad m2ea(mp;(0aexoxr3todfp e n s;s t2tmio iydop  mfei s)a2taxroou0aptniocilt s2eau o u0altnxr3tytlmDr nvs;(0tetoxrpiy1ope  fcia( a2ta(mpno1optomoctltfm2eauvpnt) eeomf iotlmtrlivolt0s2urim ny1lmeemnetl(faDtrxmono0tlxoiictldfa um( s () lxrxo iatfptraiei;(  exr(m3ny1ap  lfet t)srrmur ;t1aex miciasfa umnvp;(0 etnmf ta1op raivi;(0 rto(o ou4alenlncsl( a2raxm oo4ole miciad s2rau s;(0alenmrciadoa r u sls teuo(r3io1al emiesl(faDtrxm no1tlx iieiytfs2ulumpnt0 lenircoydopDeanesls)s2um(r3io1amenmivtas) 2ur(m oo1oltoioeiydla2umn o (4tetrifciotoptrlnvi s texrir3iydlme  nes t aDtm(mp;t1tle moeiltlaDem(mp ()treomr3ootlpDeai i;t trtoir io4alt lies ()artmxr ;t1tetn ieils sDua( o (4arxnirctydop  anvsls texoiopio1lltnmnviat)a2urx  ;u4apx  iciltls em(mpnu4texomrciodlpte ues;s0t2urxm iy1olt micslt a2ta(mo;u4apto ieiydls2uln s t0aetriociotlm r u o;( s2uoxmpiodlm emneia( aDrr( pno4altn octasls ul(vont)texoifcootlpDranvils0t2xmxm ny4apeelncs s sDtrxm no0ole mictltfaDul( o (0trxrxrciytfa rluvi;s0trxmxm ou4amtnmfesls arrr(rp;t1apt iietysla2ua(vonu4arenmo iy1latrluei;s)t2xr(o iydapt  netasf Dua(m ;o0optnmictasls ulumsn(4 eeomf iydom ean i t)sruo(mpnydlm elivi tf rraumpou0olenmoeiat mDranmsnt)teenxfctotfatrlivs;s0 etrxrpnydamenlictasfartaxm ;t0opxnmf3iadfm rmumpnt0aetrirciadla  lies s0srxoim oy4lp  mfetl(f 2ua(  nt4tlxn fctyd a ea(vp;(4tetoxf3tydoa  an s;s0trum(o oo1om nmics s aDrax oot0tet ioeiyd sDulu p t0teeomociodop raivsls s2xr(rpnu4lp  mnvsl(  Drmumonu1alto ieiasfaDuanvp;(0aleoir3iadfat  nes s tetrxr3nydlpte nctlsfartmur ;o4ope iieiasfa eau s t4altrxo3iadfat an olt) etoiopoydal elict tfa2tmxrooo4oetoioeildfa2em(mp (0alermo oa1laDr ueo;t0s2xrim3no1ll e neslt a2tru oou0tpxo o3iydfa2eln o u)trxomr ty1latelnes;t) exmxmpoudlm n fesat) 2tax pno4tlx moeiyslsDeaumo (4artnifctytom rlneilt)trtrio iy1lmeemivtatf ruaxr oo4tpenmiciadfa2uln pnt0tlxoxo3tytomtraieo () 2tm(o iodomeemfei s arra(mono1aleoifeiltfa uaums;t4alxoxf iodopteaivol(0srtrxr nudlmt  fvs (fsrua(moot1tee  i3iltfm ulnms ()teeomfcta1fptelueols) 2uo(rpou4lp nlnetltfsDtr(ront1tltoif3iat a ua(vs t4 rerxrciatopD li i s0trtoio3iu1amenliesatf rumxmpoo4aptnioetysfs2eln on(4 lxoxr iotfpDrlu sls  rxrxm3ou1omen ivtlt) rtmxr ot1tleomfeiytlsDrlnmpnt)arerxr3iadlatranvi;s) 2xr(rpnu4lptemfcias sDtrx  oo0opxoif3ilsla raumsnu4 exrif iadfaD ai o;s)truo(rpnydlptelneta()s2raxm ;t0tpe mo3iydla2ea(vp;()artoir3iydomt  uei (0teurxr io4ome  fvtl( a2umu  no0tleo i3iat m2ul(mp;t)trerif3oytlm r ivi t)sruoio oy1omen iesas)srrrx oou1olen f3ild mDul(vo;t)alermf3oa1om eaues s0 2xmxr oy1opeelnvt s)aDua(mo;t1tlt ioeiyt aDemnmo t4 eenmfcoodlpt  ueo;s0 eum(rpny1lm elivs t  2uaum ou4tleomicildlsDrmnms t0 rtoir3tadom eln i;t0t2tm(rpiodomtn icil( sruru o;o1tlt ioeiad aDulnmpn(0teenxr3iodlp  anvi;(  rtrxr oy1olenmnes tfsDra(r ;o4alenif3tat s el( p u)trtnxr3iytfm r ueslt0t2umio3iudopeelfcils)srtmu pnt4tex  f3iat sDeau s;u)treomr3tadlm elnvo;(0texoimpoy1lpenmnetas  Dtmx p;u1opxnmfciytlsDuluvo (4 lermociy1fmtrlies (0seumimpou4lpeelivsls s2umumo;u0oeen i3iysfa em( p u4altrxf oo1opD livi t s2xmxm ou1optn nvt ()aDum(ro;u1aet  feiyd a2elnvonu0 renxo3ia1fa rlu o (  eumir3io4apeelnciat)aDua(rpnt4olt mociadfaDrlumonu0tlxomr iatla eanvol(0truoir3iudom   ivs (fsrtrxmpoo0aetoifetas sDranmsn(4artoif3ootoa  an i;(0 etoimpou4alt  fetltfs2trumpoo4oetomictysls ulnvonu4altomocoodopDraues ( t2toimpoudalte ietl(f 2rmu pot4tlto feiltfaDeln s t0teenmrcta1laD an il(  exo(o iy1op nmfeilt  2rmum nu4tleoifeilt aDrlu o u0 rtoxr3ta1opteliesl(0sexr(mpnu4apte ics sf rtaxmoot0tpx mieilslmDeaums () lxnxo oytlmD aieo;(0 exm(o3nudom nmncil(fsDuaxronu4apxomi3ild mDulnms;(0artoxrctodfmDeln o;t)s2umir3ny1om emivt tfaDrrxrpoo1altoif3tlslm2emnmp u0trxomfctytlpt  ies (0sexoir3io1lleelneilt srur(monu1opeomo3tydla2emuvpnt0trtrifciytlp elies s0srtoxm3oo4lltelici (fa2ur(rpot0olx mi3tatfm ulump;u)tlxnio3tadla  anes t s2to(o3nu4altn nes t s2rrum nu0apxo f3iltfa2elumpn(4aetoio oodfm rluvs;()seurxr3nu4lltelnvil( a2rax  no0aptnmfciatfsDean pn(0 ltrio ta1op  auesls  etoxo3oydom nlieilsf rurxmoou0alxn iciaslm2ean ont4 eenifcio1fpte i i () 2um(m3no1lp nmfcil(faDrm( oou4tetnmiciysls umu o u)aeeoio iodlmDe i o s0tetrxo oo1op n ici s  2rrxr ;t4opxomoetys m rlumsnu) etoif iadom rluvs s trxrim3io4ol nlfeiat)srtrxro;t0tpen feiysfaDeanms;(0alxrxociotfat lnesl( truoiopoydlltnlieilt artr(monu1opxo fciydfm emn o (0trxnmr3ia1opt li o ()seuoxmpnydal nlnctltfartmxmp;o0ape mi3iltfm eauvs t)teermf tytlm rlivslt) rtm(o3nudaptn fvil() Drauroot0texomi3iadfmDel(mp;u4teerxf3tytla  au ols0teumirpiy4alte ictasfsDtm(  oo0apenmo3ias m2rauvp () lxrmf ootoaDrlieilt texrim3oodalenlivslt)arumu pnt1tetnmfeiys aDulumsnt0tlenifcty1lmDeluei;s sexm(o3iydalt mfvt ( srrrumoou0tptniietytfaDem(vp;(0altrxfctadfp e ueils)s2trirpny4lpen nvt (  Drrx ont0tltoii3iysfmDel(vs;t4 eermf3oatlpD  ivs;s)trxm(m iu1omenmfctl(fsDuax pou0apxnmfctad mDelnmo (0altnmr to1oaDrlivil(0srtrxr3oy4amt lnesasfaDrmum ;u0aee  octas s rlumo;u)teerirctydoptranvol(0 euoxrpoy4oleemivi () rta(  nu0tleoif3iadfsDeluvonu4teenxf tadlpte neslt0t2xmxr3iydol nmivslt aDua(moot4aex io3ilsfs ulnms u4trxrxf3todfa rauei;s)s2xrxr3iy1ope licil(  Durx  ;t4oexo oetaslm eauvp t4 rtoio iotlp  aneolt0 rtm(o3nodlmenliei tfsDuau  ot4tltoii3tldfa2uaumo;t0tltoir3iotla e u ilt0 rxr(mpnu4apt lnvi sfsDrmxmo;o0alto feildla emuvs t)tlenmocta1faDr uei ( trxo(r nodamenlfeta(  Dtmumpno0tlxoio3iydls2rlu p u)teerxf iotfaDr uesls  2tmxmpnu1altn neias) 2rrxr no4alt  octasls ulumpnt) ltrmocta1op e ivi;(  etmxopiu4opt  nci s) Duax pnu1alxomoctad aDuaumsn()tetoxfciodfpt lnvi;t  2urim3nu4oltnmictls artax  ot1olx iictlt m2eln onu4 etoxf ta1lm eauvsls)srtoxrpny4ll nlnvsasf rraur nu4tetnio3iyt a2umn pnt)tetoircootfmDeanvilt) 2xrxmpnu1lmte ivsat  Draurp;u0olx mieiatfs2ua(mp ()teerir iodla elieo;t t2xrxmpiy4lp n ivt tfs2rrumoot1tpxomi3iltlm2umnvs;(4 rtrmrcto1op rlues t0srumim3no1omt lfci t  Duaum no4opxn i3tatfs emu o t)teermo oydoa   ivs t setrxm nudam  mfvia(  rururp;u0aexo ieiys m umu sn(0 renmr3iadfaD ln olt  2toio oo1olenmicias s2urxr oo4ole  fctysfs emn p;u4 eenxoctydoa e nesls) exoxo io1optemnet tfaDrmxr nt0aetomf3tyd aDelnvp;u)arxomf3tytfmtr uvo;s)s2tm(m3io4amte fvi t) 2trurpnu0apxnmfeiatlaDemnmp u4 eeomf3totlpDrluvs s0sexr(o3iy1amte icsl(f ruax pou4tlxnioeiatfm eauvsn(4texrxociotfm e u ils0s2trxopny1olen ivi tf rur(root0tpxnmocias mDrm(mpnu0 etrir3ia1oaD aivi t) rxm(m io4lpen fetat s2urum ;t1tee iiciaslm rl(mp;(0trxnio tydop  livolt)tetrxmpny4apt  nesl(fartrumo;u4opeoif3tytfs ea( s;u)texrmo3iotfpD  n s (0trtmim3oo4ome mfesltfa2tmu  no4aet  i3ild m2ranmpnt4 rxoxr ty1lpDe i i () euoir3ny1lltemivils)srrrump;u4tlxnmf3iysfmDra(mo u)arxnio3oadfpDe ueslt)t2umxo3io4lp n icil(f 2tmumonu4apx  i3ildla rauvp t)trxoircootom   uesl()t2xo(opiodlm   fcil(f Dtm( ono4opeo fcilsla rmnmo t0altoio3oydlatr nei s)trxmxr3iodoltnmneta(fa2urx ooo4tlt  ictlt m2rl( p;()alxoif3ia1laD aivolt truoxm oo4ol elfeia( a2rr(m no4opt io3tydfm2el(mp;u4 renmf ta1fatr i s;s) 2tr(mpiu4apee nvtlt)a2rau pot0tlen iciat s2rm(vpnt) leoxr iodlmDeai i t  rxrxm ny1lme  nvs () Dtmur ;t4aeeomfctyt a2rluvonu4 lxrxr oytlmDe neolt srtmxrpoydlme mfesl(faDum(  no0opeoifetysla emnvp t)tetnir3oa1fatrln s;t)texmxo3iu4omenmnvs t srumxrp;u1tltnmoeiyd s umump u4arxnir oa1faD  nei;(0texoxr3oydlptnlfeilsf 2umu  ;u1apenmietad a2ea( sn(4artnxf oy1fm   i i;t) etrim3nu4oltelfvil() 2umxm ;o0tex if3ils a ulnvont) exnxr oadlaDe u s t sexoxm3oudaltemnetatf rtmx pnu4aeeo feilslsDuan s;t0trxoxr tadfa r uvo;t0 rxo(mpnodom  micils a2um(m no4tlxnmfcils m uan s u0aetoir ootlmDelivs t0 euo(opoudapen ietlsfaruax p;u4altnmo3iat a2ea( pn()alxomr to1fpt auvs;t) eum(opny1ll  lfctltf rum(  nt0aexn octadfaDul( o (0 ltoxf oo1oaDeln s;s  etmio3iydam  lnvil()srururo;u1opeoiictld a2eanvsn(0artnif iadoaDe ivs;t) rxmxr nodoleelneiasfsDrrx  ;o4tltoioeiytlmDelu s (4texoir iatomt  ivs s0 2xmir iydom n fvilsfsrtrum nt0oexo iciydfa rlnms t4tetrmr3tydfaDelieo;(0 2trxrpiu1omeelivs () 2rm(mpot1tlt iociysfs2el(monu0texrio3totfa  luvo;t)s2urim ny4op nmnetlt artr(m nt4tpxoiociytlsDea(mp;u)alxomrciatla eau o;(0teumxr oy4oleemivs s  2uaur nu0teeomf3tydla um(vp t)treoxr iadomDr uvo () euo(r3oo4olt mnvs sfsDtmumonu4oee ifeildlm2eauvs t) rxomrctydlpD livs t0srtr(opiy1amtelicta(fsDrm( p;u0apto fcias m2rl( o u0trerxo iadfmDeau ilt)t2urxrpoy1lpeemnctat) 2trxm ;u1alxo o3iyd s rauvo u4tltoxr3totlpteli o t) 2tmimpny4alt lfvs tfaDrrxmoou0oexo f3iyd mDul( p;(4 leoxfcoydfm r ues;(0s2tr(opiu1alenmivi s a2um(mpnt1tleoifeilt m2rl(vp;u4tltoioctatoa rluvi (0 eurxr iu4olte fetlsfsDrm( o;t1tpxomoeiasfaDrl(vpnt)alxrxo3oydlm   nvs t  2tm(m oy4omtn feia(faDur(m nu1opxnmieiad m rm( o t0tltnmociotlaD lnes;s teto(mpoydlmtnlncs s aDtm( o;u0tlxo i3tasfm eau o;t4 eenxr3iytlp   i o;s) 2xmxr3nudoptemnei sfsrumumoou0olt  i3iat sDemump ()tlxrir3to1lmD lnvil()s2tr(m iydom   fvi s sDur(rpno4texnmocilt s2umnmsn(0alenio3totlmDrluvi t  rtoxm iu4olee ivslt srurxmoot0tlto oeias s2rmu o;u0trxoxf3io1fm rlieo (0setrim oudoltelfeilt) Dtax  no4tee iicils s2ea( pn(4 rermf3oadoa rlnes s  rxr(opou1op elncias)srumxmo;o1ope mo3iysls2emnmpnt4tlxnif3oa1opteaieo ( teuoim3oo4lm  mnvsas) rrr(mpou4tetomf3tyd m rm(mp;t)artoifciadfpteaieo;s0texo(opno1lmeelivsl(f Drruront4optoifeiytfs2rl(vsn(0trxrmocoydopDrluvi;t  rxoxr3nu1altelnvsls  rtr(rp;t0alt  ieild mDrmu p (4 lxrifciotfmteauvs (0srtrxopiu1lme mnvtl(f 2rrx p;t1aetnmiciaslaDem(vpnu0 rxrmrciotlmtrau o t texr(rpnodlme mneiltfsrrmumooo1tpe  iciadfs2rluvs;t0trxrio3oy1fm   ivo ( trtoxo nudol e nvt ()arrm(m ot1olt  ieiysfs2uauvo;(4trerxf tatlp elu o;t)srxo(m iydlpeelnei tfsDta(ro;o0tlxnii3ias a2rmnmpnt0arenmr tytlmteln ils) eto(o io1ameeliei sfarrmx  ou1tee  o3iyt mDeau o () ltrio iadopDe ueo;( tetmim nu1om elfcs (fartmxr ;t0apenmieiyd a eln s t0 etoif3ta1oa e ivo;t0t2xr(o iydole  fvt (  2rrumo;o4altomieilsfmDem(mon()tltoif iatfm  lueo;(  rtrim nu4olenmneia(f Dtrxro;o4texnii3tyd s2rlu s t4aetrxr io1omtelieslt  eurio iy4opt lnctlt)aDuaum nu0tlenmo3ils a2uluvo;(0 rxoxfcto1opt au o s) 2tm(o iydlpeelfes s)arrrumoou1tet micild m uan snt0trxomfcoadfm rauvo;( trxo(mpou1lpenlncsl(fsrrm(ront4alxnii3ildlm2rl(mp (4trxoir ty1latrauvo t0sexrxo3nu1al  lieil(fsDuaxmono4alt mi3iatfs rl(vont4 lxrmr oa1lpteau ol()seumirpio1amtemfcslt arumxrpot1altoii3iaslm2rmnms (0aexnmf tydoptranesls  rum(o3oy4lpe mfctlsf Dur(rpot4tlx  icildls2uluvs u0tetrio iytoatelu i s0s2umxm3iy4lpeemnvsat sDta(m ;o1aetomfctytfs2umuvp;t4aexnio ty1oa  li o;t)trxmirpiy4omeelnvilsfsDtrxmp;o1tetn feilsfa ea(vp;t0trtoio3tydfp elu i s0 2trio3no4om  lnes sfsrur( p;o1tee  f3tadfmDem(mon(0 rermf3oodoaDeli i t)trtoxo oodamtemfes s aDrmum ;t1tpxomoctlsfa2eaumo;(0alermrciy1faDe uvslt)teurxmpnodam emiesls)a2tru pnt4oltnmieiadfm rmn snu0trxrmf totfm e n ilt)srurio iu4altnmfcilt sDrrumoou1tlt ioetysla2umu onu4trxrxrciy1lmteau ils) 2xrio3io4olt lnetl()sruaxroou0tpeoioctltfm emnvo () ltrxo3io1lptranvs s)texoio ny1lm elfvs s  Drax ooo0aex mieiasfm uan s t4tltnxocoatfptr nvi;t) euoio no1altelnvi ()arurxmont1aetoii3iytlmDul(vs t0altrmoctytom ean o;t0srxm(o3iy4ale micslsfaDtmurpot1opxnioetatfs2eauvs t)arxoio3oodlpDr n olt srxoxmpoy1lpte fvia( arumxrpnu1tle ioeiytla2rau p;()teerxr iatfat aiesl() 2uoxmpnu4alt mfeslsfsruau onu0aeto feiys aDem(vs u0aexnmo iotom e uvol()t2tr(m3nu1lpt mnei sf ruaxront4alx  fciyslm eln p (4aexrir io1fptelueslt)t2xm(mpoodlleelnvia( a2taumoou4opx miciys a2rl(mo u) leoxo oa1fmDrau ilt0s2uoxmpiy1oltnlnesls) Duaxm ou1oltomf3tlt aDul(vo;u0altrmf3to1op rliei t0trumirpoodomen fviasfsDtmu  no0tltn fetasfa rm(mpnt) exoir3oatfpDrli olt0s2um(r3nu1llee nvt t sDuax  ;u1tex if3ilsfa2uaumpn(0tetrmo3iytom eli s;s0 2urxm3ny4ale lnvilsfarum(ronu0alxnifctadls ra(vpnu0tlenmr3totlp rliei;t0s2uoim ou4ope mnei s) rumu pot4tex  f3tysfa uanmp t) renxo3oytoaD ai s s0sruo(r3oy4lm nlfvi () 2rm(  nu4opx ii3iytlsDuanmp u4arerif ootomD lnei;s) 2trirpiy4ame lnvsls  Drmu oou4tpen f3iyt s2rm(vo;u0 renio ootlmt  iei t  rurir3no4lp nmiet tfaDrru p;t1olenmo3iatfm rlnmsnu4texnmf3tytfpD aueol(0t2xr(rpoodalee fvias a2tru  ;t1tetomietls s2ua(vsnu0 rxrifcoa1fmtelnvs;() rxoxmpny1ll e ieiat) ruaumpot0texn oetatfmDelnmo;(0tetnmr iy1fpt aueslt0srurio3iudamtn ieiltfsDuaum nu0apt mieiat sDumu snu4trxoircoa1opDeaues;s)srtmxopny1opt mnvta()srumx poo1olenio3iltfa2raumo;u)tltrxrcoo1op r neo;(  eumxr3nydlm  mneia()a2rax  ;u0aet iicildfm emnmsn()tlenxfcoatfate nvs t truo(m3no4lpe licslt arumxr ou4tetnmo3tat s elnvp;t4trtrxo3oodlp eaueo;s texoim iydopenlfcs s)sDuaurp;u1oeen feild m ulnvo;(0texoio3tatoate u s t t2xoir io1al n nciasf ruaxm nt0olx mf3ilsla ranmsnt)areriocta1oat aieo t  2uoir3no4lptnliesas s2umxr nt4ape mi3ilsfs2emuvsnu4tltrxr tydoptraiei;()setmiopou4alt mnesa(fsDtaxr ;u4tetnifciadfs rln pnt0texrirciatlptr ueo t)sexr(mpoydamt mfvt t)s2uaxrp;u1altomo3ildlm2emuvp;u0arxrir3tadfaDe ies;s sexr(m3iu1op nlfctl( srrmxmonu1apxnmoeiys sDrmumo t4 etrxo3oatopDeluesl(0tetoio3nu1ame  ncia(fa2trurp;t0optnmiciatfa2um( s;t4texrxo3iodlat lu o t0 ruoimpoy1amt miesa( s2ra( pou1aeenii3iadla ul(vp u0trxrmrcoo1om ean i;s)seto(r oydlptnmfct s)s2tmxmpoo1oexomf3tatla2ul(vp;t4aexoir3oo1lm rlivo t)sexm(o3nudlmtelfcs () Drm(mooo0opxn f3iltfaDumuvo (4aetoxr3ootfa eaiei;(0sruoxmpnudol emfvtlt)aDua(m ;o4tpx mo3tad s2eanvs u4aexnif oa1lmte u o;s0s2tmxr ny1omtnmies s artmurpno1apeomi3tltfs2elnmpnu4treomfciy1fmteli o t) ruoiopny1ll n nesls  rra(rp;t0optniiciadlmDul(vsnu4 eenxf3oo1oa r i s;()trtmim3iy1lmte nvt () rtr(mono1ape ifctysfs rmuvo t0 eeoxo3iytlp  lnes t)srtoir3oy4omee ieiasf rrrxrono1alen f3tld sDrl(vo u4alxnxociadomD lies;t teur(o iydlmtemivslsf ruau  ou4aee ii3iaslaDemn sn()trxrif totlaDelu o t0 ruo(r iy4ape  icsatf rrr(rpno1ape iociadfa2uanvo u)altriocto1om eau olt setrir ny4altnliet sfaDuru  nt1tetn ictatfaDrmnvsnu4 eenif oydfaDrlu olt srumiopou4ome mivs s)sDumur nu1opxn ociltfa2ra( p u4 etnioctadfp r uvs;s  rurxmpny4llt mnvsl() Drmum ;u0tpenio3iltlm ea(vp;t0 etrmrcoa1late u o;(0trumxmpny4optn icia(  rta(r ;u4aexnifctldlmDeau p t0tlxnio3oydfptrlneils0t2um(mpnu4ol  mneils)aDrmxrpot4tpxomoetasls umums t0teenmo ia1oaDelivils) rtrir3no4llt  ict ()sDrr(rpoo4tlt if3ils a rmumpnu)alxrifcia1la  livslt0teto(o3nu1lm emietasf Dtax ooo4alt ii3tlsla2eanvs;u0artnmoctydlmtran s;(0teur(r ou4lme mietasf Dumumont0opx mf3tlt aDelumo;(0altomo iatlpDranvi s0s2uoio iy1lpe  fctas sDumu  ou4tltomoctys a2rmn o;t4trerio3totfm elnvils0s2urim ou4oleelnvtlsfaDrr( poo0ape ii3tydfsDeluvp (4aexnircoa1omte ivo s0setoxmpnudolee ies (f rrax ont1texomi3iat a el(mont4alenifcty1lpD  neilt0 rtoio oydlmtnlfcsa(farumump;t0apxn o3tydlm uanmon(0aeenmfctotopD auvi s) 2trir3nu1olt  nesl( aDrrx pnu0tlen iciltls2umu o u0trxomociydomte nvolt  2xrxm nydlmtnmfvs t sDta(ro;o4tee mieias mDum(mo;t)arerifcoadfmDrlivsls)trtrirpoodam  mictatfsDuaxmpnt0altnmo3tydfa2ra(mp t0trerif3oa1op r nvilt0s2toxr iy4am n nvs t s2ur(m oo1aleo octas sDeanmo;u)alxoxf iatlaDr ieo;(0srxrxm3nudapeelfvslt) 2urxmpot4tptomi3tatls2emumsnt4 eermrctydomDeaieo ()sexoxr3oodal elfviltfsrtaum nu0optomiciytla2rmuvo t) lxoircoadop e uvs;t) ruo(o3nu1apt mfvslt)srua(mp;o1apeo ieiatfaDrluvo u)texrmf ia1optranvi;t t2toim3no4om   fvtl(  rrm(m ;t4alto fctatla2uanvp t) rxrir3iy1fmtranes s  ruoirpiy1aptnmnes () 2rau  oo0alxo feiydlmDum(ms t4 rtrxf3todop   ieolt0s2xrimpiudll emfcsls sDuau onu1tpt mfetltfaDranvp t4arxoxr3oadlp ean i t0texm(rpnudom emnvil( aDrm(  ;t4tlen iciytfm ul(mo;()texnxr oy1opt luei s0 eum(mpiu1ol emfvs (fsDtax o;o1apxnmoeiyd aDem(vonu)arxrir3oodom  ai s;s0srxm(rpiudamtemfciat) Dtax  nt4olx io3iltfm2rmnms;(4tetomr3ta1lm   n o (0 ruoim nu1ap elneia() 2ra(m ou0oetnifcilsfs2ranvp (4trxoircoatopDe ues;s)s2tmxrpiydomt  nei (  rraump;o1aetoif3iat a rl( s;t)tetnxo3oatfmD  ivols0 eum(m3oy1oltnlivi s)a2rmu  ou4tle  f3ild sDeauvs;(4texoxo to1fat li o;s0t2uoxm iydale mict (fs2umxmono0texo oeilt mDrmums;(0trxrxo3oatfat luvs;t0seuoiopiodlmtemies t  2uaumpno4tpe moctydfa2ulnvonu0teermo3iytfp  aneo;t  2tmir3nu4lptelncia(  Dtrxmp;o1alxoifeias a umumsn(0 ltnxocoytfpDeauei;( tetriopiy4oltnlnviat  2rr(m oo0opto ietadlaDea( p;u)arxoxfctodfmtranei;(  rumiopnu1ll nmivt tf Drrurpno1texomfeiltfm2emnvp;t4trerif tadlaD  ivo t trurir oodlm emivsat)srrrx o;t4opt io3iys mDel(mpnu) lxoif3tytla r ies t)trxo(mpoy1lptnlnet (  2umx  ;u0opto iciatlmDrm(mp;()tetrmf tydfpDrli s s trxm(m3iydlm nmivi (  Durur oo1oeenmf3tltlaDuau p;(0 lxoxocoytomD aiei;t  ruoxr oodoptnmnci sfarrr( o;t4aetnif3iatfaDeluvpnu)aeeoxo oatfpD anvils texrxo io4amt lfvsl(  2rmxrp;o4opt mociys mDulu snu0 lxrmrctydfaDr ivo t  rtoxmpoo1lm nmfeta(  2ta(m ;u4tpeniiciad s uaump t)tlxomr io1oat  nvo (  rxmim3oo4ome mfcs t)sDraxr oo0tpxnmi3iad m uanmp;t0arermrcoatfpt luvi;(0t2trimpoy4lmtemnet sfs2urxrp;o4aleomi3tat a2em( p t0teenmr3ootfa eluvs;s0srto(mpoodlpte nctat) rumur oo1apenmfctatls2el(mp t4aeerxo ootlpD ln ols) 2xrxo nodam n fetlt) Dtr( o;u1alxn fciyd a rl(mp;(0trenmr iotfmteluvs;t) 2trxm nodolt mfctltf Dtr( pnu0texomiciytfs2em(vpnu4 exrmo iadomtraieols0tetr(m ou1amee nei t)artrx oou0oet iictytlm2rluvp t)alermo3oa1fm  luei ()setr(r3iy1omt  ici s) 2ur(rp;u4oleo fctatfm2uanmp;t0 rermo oydfm rlnes (  2xrxr3no1lm n netatfarrm(rpot1aetoiictyd a ea(mp;u) exoxociytom elnvolt0 rurxm3iu4omte fctat sDraurpoo4olxomfeiysla um( o u0aetoif3oytoaD aivols)setmxopnydlltn fetls aDtrxm oo0tlt iictatlm2ran ont4treoxocoytlp r iei;t) etrim no4lm  mfctat a2ra( pou4apx mocilsfa2eaums u0trxrircoydlpD  ivolt)truoxr iy1ol  lieilsfs2uax ooo1aexomoeild aDemuvs;t4teenmociadlaD lueo;(0t2toxrpoodapenlfes sfarrm(  nt1tlxnmictyt a rl( o;u)aetrxf oo1fm   u i s teurxm io4optelfetasfarum(roou1apx mfctas aDrln o t) rxnir ta1oaDr nvo;s)trxoxr3iodlp emfet s  2tm(rpnu1tlxn o3iasfa umnmp;u)tetnmo oadfmDraieo;s seurxr oo1ap e nvia(f Dumurp;o1open ociat mDulnvo u4arenmfctydfateauvi;(0tetrxr ou1ll elfeta() 2rau  ou4tetnmoeiatfm ua( p t0texrmr3tytlaD lueil( seurio ny4amtnmivt (f Drm(  ;t0olxomi3tlt a2rmu p;(4trtrio3tatlm rai i (0s2urio3no1ope  fcs t)arrrx pot0apeoiieilslmDumnms;t0trxoxfctotfaDr u sls0srtoxo nydap e fvsas)artm(rpnt4alx moeilslsDumnvs t) rermo tytop e ivi;t)srxmio iydome mfvsasf Draum nt1tleoifeiat a2rm(mont4aexnio3ty1fmDran ols) rur(rpio4al elivs tfsrtrx  nt0tpx mf3ilslaDum( p (4 eeomo3tytopDeli o t srtr(o oo4lpt livsasfsrtmx p;o0apt iociys mDrm(vp;() rerxr3iy1fp eanvo ()seumiopoo1ol nlnes (  2urxmpoo0apeoio3tlslsDemumpnu)trenio3ootlm ran ilt0s2xrirpoy1lp nmnesas  2ur(m nu1tee mf3iltla2ulnms;t4tleoif3oa1faDelneols0trum(rpoy4amen fesltf Durx  ;t1olxomfcilt sDua(vs u0trxoxo tadfmt  ieils0sexoirpnydop n ivt s)s2rrxr ot1tetn o3tat a uanvs u0altoxo3tadla  lueols0 etmimpoo1olt liciat)aDtr(rp;o4opx  ieiatlaDem(mo (0 ltomfciy1fmt  u i;s) 2toxrpou1lm nmfcsls a2tm(mpou1opx iietyslm ra(mp;t4trtniociydoate n i s trxr(m3iy1omtn fct s)s2ua(ro;t4aetoifeiat m2elnvont0 rermf3iy1laDeanvi s0s2tmio3oo1ame mivta( s2tmum oo1opxnmfeiyd a ua(mp (4 exrmo oy1omDrlnvils trtoxr3nydoptn ics t)aDrmx pou1texniiciltfa2rmumo;()tetoio tadop  anvs;t t2uoio3iy4lme lfvs t) 2tru p;t0aeeomi3iatlsDrm( onu4arermr3ta1oa e uvs;s)srxoxmpoodapt lneil(  Duaumo;o0tpx  f3iytfm2eln s t0tltniocoodopD aneslt) rxr(o3nudlltn ict t)aruaxmono0oexoiocilsfm2elu ont)tlenircoytlatran s s0 2um(mpno4apeelfetltfs2taxm nu4tetnmi3tltfa2rm(mp u0texoxrcoy1faD lu ols)trurxm oo1olt mfeiasfarurum nt1tpxniocilt a2uanvp;()artnirciotlptr nvol()s2umxo ny4lmtnmneia(fsDtmumonu1alt mieiadfs elnmsnt4treomr3iodfptran o;t0 eto(mpio1olte fes t)s2urx pno0olto i3iad m eauvsnt0tlxrif ta1oa raieol()s2tmxm3io4ol n nviltf Drax poo0ope  o3ias m2ul(vs;t0 ltoifciotopt anvsl()s2xr(m oy4apenmnvia( a2uaxrooo4texnifetydls2emnvs t)tlenmr iotfp  an o t setoirpno4ll  lfetl( srtmxmpoo0altniociadlsDrlu pnu) lxoif oatlmD luvi s)trum(mpoydap   feiltfarrmxrpno0oeenio3ias s2em(vo;u) eenir3ta1oate iei;t0 2xoxr3iodopenmfcia(fs2rrxrpnu4tpx iictadls2elnmp;(4tetrmfcoadfm  aues;(0 2um(r3iy1apee iet ( a2umurp;u0oexnmoeiyt s ra( pnu0aexomr3totfp rlu slt trxoimpoy1ap nmicsas) rrrumoot1ope mi3iltfm2ulnvon()areoxfcio1fpte i slt  rtoxrpny4llt lfetas  2um(r ;o4opt mfciatlaDuauvp u0trtnxf3ootom r nvo s0s2xrim3iodope lfcils arraxm ;u4oeen feiasfaDelnvp;(4 rxrmo3tydfpDeai i ( teuriopiu4om   fvsltf 2tru p;o4alt mi3iatlaDranmp;()aleoif3oatfmt  ieo;s)sexoxo3oudame  ivils artr(rooo0opx miciytls2ul(vs;(0tetomrciatfm rlneil( s2to(mpiy1om elfes t  rrm(mpou4aleo o3iadlmDem(vonu4 ltoxr totomteln s;t0texmim3ny1ame  fcta( sDtmum nt4apt io3iatfm2ra(ms u4 rxnio totfpD ai o s0trxm(rpou1lpe lneiatf 2rm( pnt0oltoifctad aDuanvs;t) ltrxo tytfpD livil(0 rxoxm ny1olenlfci s s2ta(mo;o0apen f3iltlm ran p (0texoio3ty1oaD  u o (0 eto(r no4alt mnvtas) rrrx p;o0aleoiieilsfaDuanvp t)alenxoctytopDranvs;s)s2to(o nu1optelicslt)a2ua(rooo0tpenifetlt a rmnmo u0tetomocoadomtrlnes;t) eurxopoo4lltnlics () rumu pnt4tltn octldla2ua( o (0 lxrxrcta1laD anvo s) 2xrxm3ny4lltn nvsls)aDrmuroou4olt  oeiaslsDel( p;() renmocoo1lptr uvs;() exoxrpiu4op e ictl()s2tmu pou4apxn oetld m2ranmo;u)altrxfciotfm r nvi s0texmim3nu4om nmnctat) Duru  ;u4aptnmoeiatlsDrmn s u0 rermr tydlmD lies ( trxrxopiydol emictltfs2urx  nu1opxnmo3tlslaDulnms;u)trxomo iodopDelieilt0s2xrxm3ou4ap emict s) 2um(rpnt1tlxnif3ild a2uauvs;t4altrir3totfmDrluvo;s srxrxr nydap nmnvias s2ua(r ;u0apto ieiytfs2el(vo;(4areoxrcoodfmD livs ()t2xo(r oudop  mivi s) 2rm(m ;o0oet  octaslaDran s;u4 etnxr3todlpDe i o;t  eto(o iu1ll n neia(fa2uaxr nt0olenii3iltlsDuanmo u4tltomociotom  au o (0t2xmxr no1optnlivs s sDrmxrooo1aptn i3tld m2elu pn(4texrxf3iodoat lnvo (0t2umir3iy4lm   fct ()s2rrx  ou1tptn iciysfa2rlu pn(4aexnif3ty1laDraueo;s)t2uo(r3iy4al  mict ()artmxrono4oexo fetat m2ran o u)aetnxoctydom eli o;()t2xm(r ny4amtnlfcils)srrr( oou1opx ifeiysls ra(mo t0artnmo3tatfpt  i ols) 2xoim3oo4alte netas) Dtmurp;t0apto i3ilslsDua(monu0 eeoifctodlaDe ivs;(0 rtrxmpiodol nlnet sf rtaur oo0oeeo oeiydlm2ranmon(4tlxnxf ootfmD  nei (0 rxrir3oo4amenlfcsasfs2raxrp;u4apxn ietad m2raums;u0treoiocoa1fa rai s t)t2xm(o3ny1ape  ivt (fsrtaxmonu1ape mf3iltfs rmuvo (4tetrmf iotfm raivi s0tetoim iy4apee ictasf Dua(m nu1altnifcilsfm2eauvp;u4tetrxfcia1opteai i t)srxmiopiudll   netat arrrx o;u0apeo icilt a rln p;t4aeenmf3to1lptelnei;(  exoirpny1om nmncsltfs2trxmooo1opxn i3iytlmDelnmon(0trxomo3oo1latr n i;s sexrirpiu4alt mietlt aDtrur ot4ape  feiatfm2rmnvsn(0teerxr3oo1lpDeau ils)seuo(m3iu1am n ivi s)s2umxrpnt4tet  ietatfa el(mo t4altnmo ty1lmD ai o (0trtrim3nu4lp   fvt t  rua(mp;t4olt  ieiysfs um( pnu4 rermr3tytoaDraieils)trtmxr3nu1om n nvt sfsrtmxmpnu0oexnmi3ildlmDrmuvs u)areomr3io1opDr ieo;s0s2tmim no1ope lics ()aDrax  ;t0apt  ietlslm2ua(mp;t0tetoifcoytlptr uvi s)srxoxo3iu1llt lfetas)sDrmu pno4tetn o3iatfm elnvsnt) etoio iotfmDrlieol(  euoiopiu4alee nvi tfaDuau o;o1oltoio3tls m2emuvp;t0arxoxo io1fmDeli i;t0setr(o iu1llen icslt) 2umx  no4oet iieildls ua(vpnt0tltnir iodomt auvi s texmxrpno1optelnesls) rtm(  ;t4opeomocils m2ra( s u)arenifciodlmtranesls texm(m3oodlmtnmnvslt srraumpoo1oex  feiyslaDemnvo;t4alxriocta1lat an o t t2xm(r3nu4lltnlfeil(f ruax pnt0olx  octasfm2umnvsnu4aeerxr3iytlp e u s;s) rtoir3nu1ole  feta(fa2rau  nt0tltn fcilt a2rauvs;t0 rxomfcoa1fm   i o;t  etr(opou1al emfei t)sDrmu o;o1aeenmoeiltla eanvo t4tlerio3oydlm   neilt texmxr iu1alt licta()s2rmurooo0altoio3tadls rm(vonu)teenxo oydlat ln ils s2xrirpiydll   icsas)aruru o;u0olt  iciyslsDrl(ms t0 rerio iytfp e ieo ()truoio io1lmte fctls aDrr(mpou4alxnmi3ildfs umnmonu0aexrmr oadomDr ieo (0 euriopio1al e ncia(f rumxroot4tpt mo3ils aDeanvsnu4aeenmrcoytfpte ieilt)s2uoir ou1lpenmnesatfsrtrx pot0optomfeilsfs2uluvon()alenir3iatfp  lu s;(0 rxm(m nu4lpe  neia( s2um(mpnt0opxnmf3iad a2umnmsnu4 rtnmr tadoat lnvsl() rxm(m3nydal  lfvs ()srumurpnu1tetoifciydfs rauvs;t0artoio iydfaDeaneo t  eumxmpny1omt lnetlt  2rmxr nu0olx mictytlmDum( p;u4 rtomf3tydomD  uvi t)srur(mpiy4apen ivsas) 2rmumpnu4tlenii3iytlmDra(mp;(4trenxrciodoa elneslt  ruo(r oy4omeemnvtat)sDtmx o;u4apt  f3iatfaDumu pnt)tetoxfcty1omt li ilt) 2tmirpno4ape  net ( a2urx ont4tetoiocils sDum(mo;u0tetomf3tytlaDe i o;( srurio iu1olen ictas)arur(m ou0oltoii3iltfm2uau p (4 rtnmocta1oatr ues;( t2uoim3io1omenmict s)aDuaurp;t0apeoiicilsfmDean o;() lxnxr3to1lp rlues;s sexoxrpoydlmte fet s) Drmx oot1oexniociyd sDrl(mon(0trtnxrcto1om  luvi;s0 euo(m3io4lmt  neiat arur(mo;t1optnmoetld m emuvo t4aexnif oatlaDeau sls)s2tmxm no4opee netlsfartmu  ;o1texomf3tyt m2ean o;u) lerxr3oa1lmD aieilt t2xrxr3io4lpe lfeiatfaruaxmonu4teeoio3tasfs2eau pnt4aexrio todomDeln slt seurxm nudole  fvsas)s2ra( ono0aetoiiciadla2el( p;() eenmr to1lp ean il(0trto(opnodop  mnci s aDrrump;o4aeeo o3iydlsDeauvo u0 rermr iy1fpt lieolt s2tr(opnu4ome mfcslt)artrx oot1aeenif3ilt sDranms;t0arenmo3oy1fm  anvs;t0 2xmxr nu1apen ivt s)a2uru ooo1apenifciad aDua(vo;u)tlerifctatopt ai il(0t2umxmpoo4op nmictatfarua( p;o0tptniieiydfaDeauvp;(0alxomf tytlpD lues ( tetoir nodlltelfei s)srta(  oo1tetomiciatla2el(mp;(4 exnir3tydlmtr ieo ()seuo(o ny1lp   ict ()arrrxrpou1aex  feias mDeauvsn(0 rerxf iadom r uvo;(  etmxr3iy1op nmictl() ruaurpoo1tleo f3iytla2ul(mpn(4arxniociydlp eluvi s0tetoio3iudameemfcsasfsDrmu  ;t1oleoiictltfm2ulu o u4alxoif3iy1faDrai s;t0 2uo(r3iy1ap e ncsa()sDta(  ;u0oee iocils m elnvp;t) rtrxf3oa1fpDelnesl( sexo(o nodlme mfviat)srtax pou4texo o3tytlmDea( pn(0altrxr3oy1opDe ues;t)trtmir3nydom n fet s srtrur nu4aet io3ias a2em(vo;(0altomocootlmDrlieilt0 rxo(m3iodamt lictas sDtaxrooo4alenii3ild aDum(mo u0areoxfctydfat auvo s0trxrimpnydlptnlneta(fsrtrx o;o0oleomo3iydfs2ra( pnu0aeerxfciodomDeluvsl(0sexrio oy1lpt  netls  Dumxro;t1altoifciytfs2elnmp (4altrmf3iodomt an i;s) 2uoxopio4oltnlfcs ( s2uaxm ;t0teeomi3iytls2em( ont0texrio io1oa  auvs;t)sexrio oy4oltemnci t  Dra( oou4oex ii3iadls2eluvo;() ltomr oodlate n s s0teumxm io4omt lfvs ()a2trur ou4alt mi3ilt m2uan p;(0 lxoif3tatoa eaiei s)setoxrpno1omenlfeslt sDua( pou0tleoii3iad s emuvs u0altoxrcty1lat aies s) 2urim no4op n fvt ()arua( pnu0tltniietlsla2rlumo t0aexrxr oodfaDraueo;(0trtoir ou1lm  mictlsfs2ua(  no0optnifctat a ea(mo u)artrir iydfa rau i;s) rtmirpoy4oleemfvsa(  Dtrx  ;u4tex mf3tld a2ua( s;(0aetoioctydfat lueols0sexr(mpou1ll emfctl(fs2rm(r ;o4aptomociytfm rl( o;(4teerio3to1oat lneils t2uo(m3oy1lptelnes t)s2tmumpnu4tlxnmictydlsDra(vp;t4arermfciydfpteluvs (0 2xoio nu1amtnmieta(f rrrurp;t1olxnmo3iyt m rl(ms u4 eermo3tydlatrlnvils0 2umxr nu1ll elivslt  Dtru poo4tptn oeils mDem( p;t4teenxr oatoptrln s s t2trxmpny4open fci sf ruaur ;o4tpto oetytlmDranmonu4teenir3to1lm  ln s ()t2urxr3ny4ap nlfct ( sDtm( o;u0oet mociadfa2uanmo;t0 etrmr ty1oa e i i;t0srtmio ny4ol   nvias) Dumxm nt0opxn oeiysfsDuanmon() exomr3ootopte nvs s0 exr(m3oo4op   net ()s2raur ;u1aet  octltfaDemuvp;t0 etoxf oydlaD au i;s)trtoxm3oo1om n nvias a2rr(root0aetomo3tadla2uanvpn()tltrio oatomtrai o s0tetmxo3iudaltnlnvs ( srurx  nu1oltnmieiydla2rauvsn(0 lxrifcoadlm  ln sl()trtrxo3iy4optnlivt s sDuaumpnu1altn feildfmDuauvp t4artomo todoatrln i s) rumimpiy4op n ict ()srra( oou0alxo i3iydlm2elums (4alxrif3oo1lat  ivs s)t2umxrpiydomt  fviatfaDumxr ;u0alt mieiltlsDran p u0 eenif3oodfatrln i s seumirpiy4aptelivsltf 2uau  oo4tlxnmieiltfsDuln ont)trtnif3tadlm ranvsls)t2urxopoydom  lfetls sDuaxmp;o4aeeo ocils sDrln p;t0aexoxo3oytomDraues t) 2xrirpnodlptemneslsf 2rrx o;o1apto f3iydfmDel( o (0 lenmociy1om raueol()srumxr3oy4lle miciat  ruru oot1tleomoetldla2ra(mp u0aeeoxf oodom eanvo s0 2umirpnudolee ict ( sDurx oou0texomfctlt aDean s t)aeerir3ia1faD  i s;( tetmio no1ale livtl() 2ta( pot0tlt  feilsfaDemnvont) eeoir ia1fp  lu i;s trtrimpoy4optn fetas)aruaxr ;t1texnmfetldfaDean s;t4 etnxo ootfp  lu i;s0 exrim iy1am   nvilt artm( poo4oex micilt sDrmuvp u0 exomf3oatfptrai olt)texo(o3iu4lmen nct s a2rm(monu1tpto fciasfs ra(mp t)trerio iodoa rai o;t0tetr(opnudame  icia( a2rmx pot4texoioctatls2emn onu0 eenxr3oydfmtr iesl( texo(o3iu4ope licils)aDumurpnu4texo f3ildfs rmn s (4tetoiociodfm rlieil(0 exmir3iu4ole lfctltfaDta( onu0oeenii3iltla ranmsn(4 lerxf3ia1lpDrlu ils)truriopou4am emfvtasf rur(r nt4olenmoeiydla2ul(mo;(0trenmocoatopt ln slt  exm(r nudame lieiat artr(r ;t0oex  feiysfaDrm(vs;t0treoxr ta1fpDeau s;s0 2um(rpiudape  iei ()arraumpoo1teenmocils a rmu o u4 exnio ty1oatelieo s t2urir oy4lmenmfcias)arumx  oo1apenii3iat s eauvsn() lenxrctotoaDe ivs;t t2tmxm3nu4am nliei ( arumum nt1ole iicild mDumnvp u0tetrir ia1latr i s;t0s2xmimpiu1ap  lictl()aDrr(  ot4teenmoetldfaDel(vs;t0arxrmf tatla rau ols trtoiopoydllee fet s arta(rpot0aexn fciytla rm( s u4texoio3oatlat anes;( seto(r3no4lmtemfcsl()srtm( pot1optn ocild m2rmnms t4teenmr io1laDeaies;s0 etr(m ou1amt  ivsltfaDtaump;u0opxnifcildls2ua( onu)aetrmr iatfpt li i;(0s2xoir nudol emiet sfsrrmxmoot0altoiieiad m rmnvpnu4 rxrxfcoytlpt au sls  2toxr iy4lp elfeia( sDraxm oo1alenioetytfa uanmont0 exnmf iytoateaueslt0setrxr oo4lpte fvsat)a2tax poo0tleo ieiydlm2rmnmpnt)trtoxo3ty1oatrlu o;(0s2xm(o3no4om n ivt t artmxr ;o1aptnifcildfmDum(vo;t)tltnirciodomtr neil() 2tr(opiydamtn fct t aDrm( pno4altnmfeiytfm2emuvp;u) rtrmociodlmteauvi;()trxr(opio4lpe mfcias)sDtrum nt0tleniictytfsDean o () etnmociadfpD lnvs;t  exoim iy1omen iviat artm(mooo4tpx  ietatls um( onu4 lerif io1optr neo;t)seur(o ny1olen net sf 2rrxro;o0tet  iciat m2el(vs (4alxomocootom eaieo t)t2urxr no4om nmfvsat) Dtm(m ;o0oexo oetlt m rauvsnu) reomfciy1fp e n ol( s2urirpiu1lmtelnct (fsDrrumoou0optnmfciat s ul(msn(4teerioctytlm   nvslt)srxm(opio1lm emnet t)s2rr(r nt4tlenmocilt s umuvo u0tlerxo oydlateaivo t0t2urxm3iy4omte icia() rum( p;o0tleomoctyslmDrmnmpnu0altrir3oytlp  ai ils tetrio iu1ap  micils aDtr( ooo1olenmfeiysfs ua(mo;u4 eeomr3tytlpDe ivo s srtr(o iudom  lnvsas)aDra(rpot4tee mf3tldls2rmnms;(4artrmr io1lat ai sl()s2trio iu1am   ivs s) Duax  ot0oeeo feiasfa2em(vs;(0tltomfcia1lmtrlnvils) eto(m ou4altemies (fa2umurpno1tpx mf3iat m raums t)altoxr todfate nvsls srxm(opoo1ame lnet ()s2rm( o;o1olxo icils s2ul(vont0alxoif3oadfp  aueo;s)sexrir ny4lmeelivsltfaDurx pou1alx mi3iyt s ea( pnt0alxnxfcto1om  aivi;t)teurxo oy4lm  liet tfaDtrur ;u1oeen f3iysls uan p t0aleoxoctatlaDelnvs;t)trtmir3iy4lltn feia(farrmxrp;t4teen iciyslmDrln snt0 exrircoy1om elu sls)srxoir nu1omenlietat)aDumumooo0oetomoetytlm rm( snt4arxnxr3ootlaDraivi;(0srtm(opno1ol elfvi (  rtmx o;o4tltoif3tad s ran o t4 rxnircio1lmDr neo s)trtmir3no1lmenlncs s)artrumpnt4tee mfctyt s raumonu4tlerif oytop   u i t) 2toxr nodape  ivt t  2rr(root0ole ioeildfs um( sn()artnifctotoaDrlnvsl() 2tmxr3iudamee ivt ( srta(mpot4tltnmi3tys sDrlnmon(0 ltnmr3oatoateaies;()setrxr3no4altnmfvs s  Draxr ;t4tpx micilsla elu s;(0tltoxo3iodom ranvi;s)setr(o3oo4lmtnlnciat)s2urxm no1tex iictad a ea( pnt4 etrmr3io1omtrlueo (0 eumxopno4am n fvsls  rtrxmo;u0altnii3tytls um( p;t)tlxrir3iy1oaD anvols0srxrim io4olen ict t  Drm( oot4openii3ildlsDuanms u4treoif oytoa e ueo;t t2trxrpoo4am nlfcsls sDrrumonu4tee if3iatfsDrl(vs (4alenxoctatfmDe nvi;s trtoxmpoydolt  nctl(  Duax ont4tet  i3iatla2uau snu0teenxocoodoatrauvs;t  2xrxo ou1amtnmfvsl( artrx ono4alxnio3iad mDranvont4aeerir3oydfpD aieo ( trtoiopoo4ll nlnes t) 2rru p;t0aee mieiyt aDuanmo;()alxnirctadlmD  nes;s s2xm(r nudale  ivi tfaDtm(moot1olxoifeiyd sDumumo (4 etomfcoo1fmtranvols0s2tmimpiu4olt mfct (f rrau  no0ale io3iatlmDrm(ms;t0 lxnxf3iatla  lnvolt  rxoim3nu1opee ncs t)sDtmxrpnu1oexoii3ildlmDua( onu0tlxoiocio1fmtr u s;t)t2tmimpiy4ll nlnesltfsrtmx p;t4alx micilt a2uauvo ()trtrifciytfmDrlnvi;t) rxoxm oo1ol   icilsf Durum ;u1apeomieiytls emumpnt4aexrmo oatlaDelivi t0texrxo3ny1optemicias  rumurp;t1tpen o3tls m ul(mo u) rtrxo3tadfa  aueo ()texr(rpiu1lptn ictat arum(  nt4aex  fciasfmDul(vp;u)teerxo3oatom e i s;t)sexoxmpiu1olenlieia( sruaum ot1oeeoioetlslmDuln s;t) etrioctatoaDr uesls  rto(r iy1op  lfetas aruru  nt1optoif3iys a umums;u)altrmfcoo1lpDr u i;() rxmiopnudapt  nci tf 2trxmont4opeoif3iadfm umuvp t) exrifciotoaDr uvil(0srumim oy4oltemncsas  Drmumpno0tpeomietld m ul( pn()tlxrxocoytopt aiei s0 exrirpoydop   ncilt  Dtrur no0tee mf3tlt m2ulumsn(0alxoio oa1lpDelueils0t2xmimpiy1ol nmncilt a2rrx pnu1teeoiictad m2rluvo (0altrio oatfpteaiei t)trurir3ny1ol   fes ( aDta(  nt1tltoio3tytls elnvsnu4trenxf3oo1fp  livo;t)sruoimpno1opeemivils) 2rm(mp;t0opt iietys m2ra(vs t4 leomo oytfptrai slt trtr(r3iy4lmenlfvs tf 2ua(r ;t1alenio3tys s2emuvo;t)tltnxo3oodlpt lieols  2ur(r iudome  ict sfsrum(  nt0oeeo fciyt a ul( p;t) exnmf iotlpDrau sls)trtmir3ou4omtelnet s)s2rrx  ;o0alx mo3tadfs2emumonu)artrxo3oa1lmDr i i (0 eumio3nu4oltelnvta()sDraum oo1aetn i3iltla2rlu on() rxoxfctodlatrauei;(0trtmir nu4ol  mnes t)artm(mont1tpx ifcildlaDem(vont4teermr oa1fpD lnes s0 2urir oy1ap  mnvtas)s2umu ono4olx miciadlaDrl(vo u0 lermo3totlmDelnes t0trtm(r3oy4olee fvt t srrmurpot0tpeo i3iltls uau on()aexoxf iotlmte nvi ( t2uo(o3iodom e iei t s2rrx  nt4tptoio3tldlsDemu o;(4 etrio3iatoptrauvo;t0texoim iu1lmenmncs tf 2tr( pot4texnmieilsla umnvpnu) lermocio1fp rlues;s)trxmxm3ny1am e fvs sf Drau  no0olenifeiytla2ul( p u4 ltoxo3iotomtr neolt0trtmxmpnodlmeemfvtasf Durumono4oexo i3iyt a2rmump;(0alxrif3iotomtran ilt  rxrxm oo4lpt lfvta(fartrxr ot0alxo ieiadlm2ea(vont) rtomf ty1opDe uvo;( srtoiopoo4alenmneias)srrmumonu1aeenmf3iyd a2umnmo;()trermrcootlm e nvi s0t2umxr iodlmenmivt t aDtrxrpou0tleoifeiydfmDua(mp u0arxnio3tatfpD anvs (0tetrxopou4lmtnmncs sfa2tm(rpno0alt  fetat s2uauvo;u4texrmr3iotfm e u ilt0 exmxrpoydam  livt (fsDrau p;o1tee  ocildla rau s;t)aeenmf oa1opt  ueslt s2xr(m3oy1am  mnei ()sDtax  oo1aptnif3tys a umn on() lxomf3iodfa elu olt) 2xrxmpiudop nmnetlt) Duax pnu4tlenio3iltlaDumn pnt4aexoir oodoa   n s s0sruo(rpoy1llee nvias)srrrxm ;u4opto ociytfsDeanms;t0 rtriocio1oaDrlnvs s0 rtoim oo1apte nvtatfs2rrum ot0opxomf3ils a ul(vp;t)aleoio3ia1opt li sls  2xm(o3ny1lp n nci sfa2urx  ot4aetnii3tadfm uauvp (4arenir3iatlaDelnvo t) eurxm iu4ole livs t) rrrur nt0aeeomi3tyd s2ulnms t4 eeomr3iodla raieils) 2tmimpiu4op nmfvta() ruau  nu1teeo ieiyd m rlnvs;(0 exnxo iydlpDe nvs (0srxmxo3iu1openmiesasf Dta(  ;o4apenioeiad sDeaumonu0trtrxr oatom ran i;t)sruoim ou4lm e fviat)aDtmx o;o1tpenii3tydlaDrlnmpnu4alxrxr iatop  li s t)texmxr3nu4lpt lfesa(f 2tm(r ;u0tlx mo3tat a2umnms;(4aetoifcoo1om rln i;t)trtr(m no1omen ivs ( s2taurp;o0olxomieiasls rmuvo;(4trxrmrctytfpte nvsl(0texrxm3ny4lmtemiet ()arrmump;t4open ieiyd m2emn o;u4arxnxr tatomDrauvil(  2urxopny1amee ieil(fsDrrumono0tpxn i3tysfm emu ont) exnxr iy1omD auvsl(0 etmxm nodapt lfcils)srrau  ;t0open i3tytfsDuluvp;u4 lxoxfciydopt  i ol( s2ur(m oy1omeemncsa(faDumx  ;u1aetoiietatls2rln sn(0aexnmf oadfpt lu o t) euriopou1alenlies t s2tax poo1opeoiociltfa2em( o t0 rermo ta1omtraivil(  rurxm3iydaltelfci tfs2tmurp;u4oee mieilt m2ul(vo t)altrioctydlpt li ol()s2toirpno4alt mfetas)sDumxr ot4ope  o3iasls rlu o u4aetrmr3oydfa elivs ()seuoxo nodal  mfci s a2um(mono0aptomi3ilslmDrln o (0 eenxr ta1fpt aneo;t)srtr(opno1altn netltfs2ur(r ;t0oexn feiltfmDrm(mp u)alermf3tatopDran o (  2tr(r iydlle mnvsl(f Dtru o;u0tet moeiydfm ul(vpn(4trxnxr totlpD  ivs;(  exr(rpoodamte nct tfsDrrxmo;u4tpxn fctaslm2eln s;(4 ltoxo iatfm   i s s) rur(o3oodam   ivtlsfsruax pou0alxoifeiyt a2um(mo u) exoxo3ty1opteluvslt t2urxo3oydap emneias) rtrxm oo0tetnioeilslmDumn pnt)teenirctadfm  lnvsl(0 eum(r3iu1ol   iei tf Dua(  nt0ale mfeilt aDelumo u0arermo3iytlatr nvi () exm(m iy1om  mivil(  Dta(rpnt4aet mfeias s2rlnmp;t0aetnio3iydlpDranvslt teumio iodap e fviatfa2umx ont0oee ifciydlaDel(vo;t0alxrxocoadlmtr u i;t  exr(m3iu1olt lfvtl(fsDta(r ;o4texnmietytlmDeaums (0alenxoctadfmtelueo ( teurio iy4ll  lfci ( artr(  ;u0ape ifeias m2ranms;t) exrmr3iadop eai slt s2urimpnudlpte ivsls)arurxmpou1opxoioeildfaDemnvon(4trxomf3iodoat au il(0 ruo(o3oydapenlnvsat) Dtmxr nu0tex ifeils m umnvpn(0 ltnmr io1latrai s;()t2xmxm no1ap   ivi (f 2ta( poo4alt mfeils sDrl(mo;()tltoirctatla e ivo;t)s2xm(r nu1alt mnet ()s2taxro;o4oee mfciadlm rmumo ()trtrxf3totlpt lnvol(0sruoxmpnydap e nvtlsf 2rruro;o1tpx ii3iyslm2em( o u4trenmo3iydfa r ueo t0 eur(r nydlpe  ivsl(fa2raxmpot0alto ictysla ran ont4 reniociadfpt aieol()s2xrio3ny1lmtemfetasf 2tax p;o0oetoio3iltfmDemu o u4tlermr oodlmt anvi;s0 etmxopny4omeelnet s srrr(ro;t4tlto ocilt sDelumpn(0treoif ta1lmDeaueo;s0trumirpno4alee ivtl( sDurx pno0optnii3ilt sDelnmo;t4arxnxo oa1lpDr u ilt)tetrio3iudop  mfviasfsrtaxmoou0tpxo ictlsls2rmnvo (4 rtoxrctodop r u o t t2xoxm3iydlpt  icsasfarta(rp;u0oetoioeildfs2emumpnt0tlerifcta1lm elu s s0 2trxopio4lpe  iet t s2urxm ot0alt mi3ild mDuaump;(4 lxrxocto1fpD  nes;t)tetrimpno1apen ict tf ruax pnt4apeoio3tatla2rln ont) rtomrciytlp   ueol()setmxr oo4ame mncta() rur(r ;o1aet ioeiydlm2eau s;u)artoxo3iatlpDeaneo;t)srxrxm3ny4ap nlivias)a2trx pnt0tex  feilslsDran onu4texrio ia1omDrluvo s0t2uoxmpiydaleelnvias)aDurx  oo0apxoiicild a2umn p;(4aetnmf3oy1faDr uvo t0srxmir3no1ame lnvtat) Dtm( o;t1tpxn octltfs el(vo;t0alenmo to1faDean s (  etoxrpnodol n fctls sDtaxmonu1aleomoeiyt s2rm(mp u4 rxoio3oo1lptr ivs (  2xmxm3nu4lptnlieia( sruaxm ;u0olx  f3iatfm eln p t) leomfcoa1opDeaiei;(0s2tmxo3oo4omeemnct sfs2tm(rpno1oltoii3tyt a2rl( p ()tetrif3iatom   i s t  rtm(m3oudapeemiesas)s2um( p;t4tle mieildlmDrm(mp t4altrxf3io1fat luei (0 exmxm3no4olenliesl(fs2rrxrpno4aleo i3tadfa el(mo u4texnxo3oatom  lu sls)s2uoxm oy1lltnmieils sruru ont0alxniietysfa2ea(mont)trxoio ta1optr ivs;()s2umxmpou1op emieslsf 2tru  oo1oltn oetys sDumnmo ()aeerxocta1fm e ueol(  2xr(o nu1apenmncsat a2rm(rp;u0aeeo i3iatlaDrlnmont)aeeoxfciytfp ranvo;(0trtoiopiodlmt liei s sDum(mont4optnioetlt mDra(vp;t4aeerio iy1lmtr nvs;t0sexoxrpnu1oltn fcsa(faruau oou0apt  f3iasfm rmnms u0tltnmf3tytlateai sl()s2ur(o3ou4lmt  fciat  rtmum ot4tlxo fetytfa rmu snt4aeeoxo ootlp rauvs (0 2umim3io1aptemicsas s2rrum ot4teto ociys a ua(mo;t4arermrcta1la  lnvo;t  exmxm3nudomen ies (  2rrx pnu0aeeoioctltlm2rluvont4trenxfctatfpDe ivo ()trum(m iu4alt lfctasfaDua(rpoo0opto i3tytfaDuanvp;() lerifcootoatrai s;(  2urxm no1opte icsa(f rtr(rpno1tleniieilt a ul( pnu0 lxrmfcta1omDe uvi;t)srtrxm nodlp nmneil()arraurpoo0tpxoiociyt s2ean snt)teerir oo1omtr neo (0teuoio3iu1ame lnes t aDraurpno1oetnmoetydlaDulumo;t0 lxomr tadfp raivs;t0 rxo(m3ny4aleelnetlt sDrauro;o1oleoiieilsfsDuau s ()alxoio3tytfmt  ieo ()srumim3nudalen iviatfsrtmuronu4oet  i3iyslm ea(mp;t4trxoxf3oatla r n i;s trumxmpoudlmte ietat)sDrmx oot1teeoioeiytla2eau o;()trxnmo3oytoat  uei ( sexoxm3ny1apeelicilt)srta(mpnt4oetn ociys a emuvonu)alenxr3to1fpDe ivslt s2umxopnydom nmici s s2rmumpnu0ope  fciyt a eanvont4trtomr oydlateaivi;s0 2uo(o3iydlp e ivsl(fs2trur ;o1olxoiieiytla ul(vp;() exrxrcoodfatelieils0trxmxm3iudam   feta( a2urxr ot0alxnio3ias aDumu o (4arxnir oydlmD anvslt  eumim oudlp  lictas) Dtaur ;t1alxo i3iatla2um( snt)trxnifctadfat  iei ()trtm(mpiy1lp   nct s aDurx pou0ole moetldlm2emu s u0tetnxf ia1fateaneo ( truo(o iy1lmt mfvtlsfs2rax poo1tlenio3iaslm2um(vs;u4trxnmocoy1omD aueo;t srxo(r3ny1lmtnlfeia(f Dra(mo;u1oet mfetaslm eln s;t0artoxo iytlmDrln ol() eum(opiy1amt lfviltfartaur nt4aexoio3iytfaDua(vp;u)tltoxr3tytfa raues (  2trir iydll  mfcsls)sDtmur no4oleoif3iyt m rlu p;u0arenxo ia1opt aues t s2uoxmpiydomtemnesl(fsrrr(r no1aexn feildla2em(vpn() lerxr3oa1laDeai ils) 2trim3nu4ope mivsasfaDtr(rooo1alx iocilt sDrau p (4 rtrmr3oo1omDeaivo;s) exo(mpiydol  livtatfsDtr( pou0tptoiociltfa eanvp t0 rxnxo3totlp rlivo t0 euo(o3ny4om   nvi sfa2tr(  ;u0apeo iciyt m2ra( o (4 ltnif oytfpte neil( s2xrxmpnodllt mnet t)artrxmo;t4alenifeiasfs2rlnms t)trxoif3todoa r i o;() exmxm3iu4ol   neilsfsrtaur ot4opxniieiadfa rmumpnt) rtrifcoa1oa rln il( sexoxo iodam e ncs sfa2um( pnu1oltnifciytfm2uauvo;u4texnxo3to1oaD  nvi (0 rum(opoo1lle mictasf 2um(moou1oltnmoetldlmDrau onu4 reoxo3iydla eau s t  etr(o3ou1lpe liet s)aDua( pnt0oleoio3iytfsDuauvp;u0tltnif3iadfpD lu s t trto(rpnu4lmen fvslt s2urxrpnu1tetniocildfm2ranvpnu)altoxf3ta1fa  anvi;s0texm(mpno4lle lfvslt)arrmu  no0aptnmiciyt sDrlnmo;(0trxnif oo1lpDr n ol(  2toxrpou4lmeemict sf Dtmxrpou0oeen octyd s rln snt0 ltnmr iadom r n ols) 2tmir oy1lp elivs t)aDrr(m ;o1aleoiociydfs uan on(0trxrxr3iotlmtr nvsl()t2xoxo3iudol e fet s)s2tmuronu4aexnmo3tldls el(mo (0 lxnioctatlmteluvils)s2trxr3iydlle lfcta( aDuaurpou4olxnio3tls mDrl(msn() reoio ty1fptean sls sruoxo iodap emictat) ruax o;t1alx mfetlsls2ra(mp;t) lxomrcoydlm raivo s0t2trxr oy4aptnmnviat)srrau ooo4apx ioetytla2em(vo u4 rerxf tydlmDr i i s0trxmxr ny1optnmies t arurx o;t0aee io3ias a emnmsnu0arxriociydopDe n i;s)t2tm(mpiu4opt lieslt)srrmumoou0aeeoioetldlaDuanmo;(4tltnio3todoaD  ivols t2trir3ou4llenlictltf 2uaxrpoo4texo oetlsfm2rau o;t)texrxf3iy1fmtraivi;t  2uriopnudlltnlfctls)arrmurpou1alx ii3iydfm el( p;t4aeenir iotfm eanvs s)seum(mpny1al e ics (f 2taxro;t0tet iieiltla2emums;u0artoxr3oatla eaueols  2urxm3nodlmtnmfcias) rrmuro;u1tlxomf3iatfm2ulnvp (0teenxf3tytlate neolt0srtoim oy1aptelfvils  2uru  oo4oltoii3iyt a2umu o;(4 eermo3ootlaD anes s trumxrpoy4om e feiltfsrum(m nu1tetoifctadfa ul(mo (4aexrirctotlpDrlu o;s  2urxo3iudllenmfcsls srua(mpoo1tle  f3iasfsDum( s u)trenio iydfmDr i s;()s2to(m oudal  mict tfsDrrurono0aee ioeilslm umu snu4 renmf ty1opDe iesl( trtoiopiy1op nlncs sfsDuau pou1ale moeiyd a2eauvp u) exoxo3ty1la  au ol(0sexoxopny1optn ict sfaDumx oou4altnmietys a ul(vs;t) rxnxr3oa1om  ln s;t0 rtmio3oudope mneil( aDuaxro;u4alen ociltfa emn p t0 rxoxocoydlatelu o ( s2to(r3ou4aptemfeia() Dtr(rono1ale mf3iytfm ea(mo;t4areomfciydlptrlu s;()srumxopoudlmtnmfviat)s2ra(r nt1optnioctlt a rlu p;t)tetnmrcoadla e nvi;t)t2toxrpiu1omeelfcil(f rrrxrpnt1opxnmfeilt s2rlnvpnt4aeerircty1omDe ueils)texmir nudap nlfct t)aruauroot1tlxnif3iat a el(mp (0aeermr3iodlpDr i sls t2urim3io1ll emfctl() Dur(  ;u4tptnmieils s2umn s (4 ltoio3ootopDe ivs s) 2xr(mpou4alen nvslt artmxroot1aexo o3tadlsDea(mpnt4teerxo iodlat lneilt srurxrpiudlmtnlfvi tf 2rrxro;u4opx iociydfm2rlu s;() exrmf to1omt aieil()t2uoimpny4op nmfvtltf 2uaumoot1tpenmoeiad a umumonu)altrxociotlpt  nvi;(0srtrxr3io1ole lncsasf 2rm(  ;t4optoii3iasfa2elnvs t0trermf totlmte nei
\ No newline at end of file
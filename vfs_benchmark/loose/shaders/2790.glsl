@@ -0,0 +1 @@
+iei;t  etm(o iy1lmtemici t arumxmoou4aeeoiieiadfm ulnms t0 rtnxrcoytfp r u s (0t2trxo nu1altnmivta() rtrxr oo4oetn oeiltfm2rl(vs;u)alxnir tadop e nvi (0t2to(m3oy4lptelfvi sfs2um(mooo4oeen ociyt s um( p;t0 rxrir oatom eauvs (0t2tmim iu4oleelivsl(faDuaum ;t0texniieias mDelu sn(0arerifciatlpt  ivi;t t2tr(o io4lpte ict tfsDtau  ;t4aex  fciltlm el(mo (4teeoxrciatomtr nei;()srtr(m iu1ap elnvi ( sDua(mpot4opxoioctldfa2um( p t4trtnxr oy1opD luvilt0trto(rpiudal   ivt t sDtmu  ;u1tpt  oetyd a rmnmonu)aetrmfcoydlmDe ueolt trxrim3ou1op  liciasfsDra(rp;t1tlx  ocildfm uluvpnu4 exnircoytoa  auvil( t2uoir3iy4ap n nesl()aDur( oou1apxn i3iytlmDrmu o;()tlermociytoa eai s (0 rxr(r oy4aptelnetlt)aruax p;o0oee moetldfa ea( o (4trenir3tytfp raneo;t0trtm(o nodalen ietlsfa2rmxr nu4texniociltfm2eanvo t)tltnxr3iotlatranvo;()srtrxm ny4apee ietat  2taxr ou4olxniiciadla2eln o;t) rtnioctodoaD anvils0 rxoxmpnu1ol  livslt  Drmump;o4opxnif3tld s ua(ms u)teeoif3tytom   ivo s t2tmimpio1lmtnlfvt t)s2tr( pnu1olt mfciyt mDemuvo t0 rtnmrciodfmDeaies;t teum(r oo4openlnvi (  ruaump;u0tet if3iltfsDuluvo;u4texrxo3to1fmt lu ol() rxr(m no1apt lfvias srrax ono1tptoio3ildfs2umuvp;t)alxnmfctotomtean o;t  eur(mpoodolte nvi tf 2umum no4tle iocilt mDemu onu) eeomr3todfaDr ivs;( texmxm iy1lp e neslt) rrru  ot4oetnmf3tldfs eaumo;u) rxnmrciotfa raivi s seum(m3iydll n fvi (fsrrrxm ;u0altn ietlsfaDranvs u) etrio3tatoptean s;t)trxrxo oodlptnlfciatf Dtru onu0tpeo feias aDel(mpn()aetoxo3todfa rauvo;t)t2xo(r3iudole mfeslt a2umuro;u0tleo fciys m em( p;(4 lxrmo oadlpD lieo;(0 etmxr3no4am e nvi t)sDra( onu0apx moeiltfm2emn pnt4trtrmfciatlp eliesls sruoim3io1amtn ies t)arrrxrpou1aexoio3iytfa2umu o;t4arxomrciotfp eaies;s0srtmxopio4amee fvtltf 2uax o;t0tptn feiytfa2rmn on(0texnxf3oatopDrlu i;s) eumxm io1om  lics ()sDtaumpnu4apen oeiat m2ua(monu4arermr3tatlmDrau s;t setrimpoodameelfvtlt srumx oot1altnio3tyslsDum( o;u4tetnmfciatomD lnes;()tetm(m oydap emnvsa() Dum(mont4tetn iciltfs eaump;t0 eenmfctadlatrlnesl()t2xm(m3oy4ap e netls)aDur(r ;t0alen o3iys m2uanvs (0 eeoxfctydopDraneols srum(o no1apt livilt)aDtr( p;u4oeto o3tas s2el(mpnt) rxomr to1fatelnvs t)trumim ou1lpenmfeias  Dtmumpnt1aleo fctyslaDum( snu4 lermocoy1fm e n i t0 rum(m3iydlptnmnciat)srurur no4olenmfciad m uluvo;(0texoxoctatop eln o;s0texr(rpio4ll   feias sruaurpnu1aee mfciltfsDul(mon(0 rxoxr3ta1fmtraueo t srumxo3iu4lpeelnvs t aDtrum ;o1oeenmfeiatls um(mpnt0artnmf3iytfmDrliesl( teto(m3no4ap emieilt  rtrur ot1tet ioeiasla ra(vo;(0trxnioctadomtrli ols)setmxopny1ap n fcsas  2uaurpnt0olxnmoetadfm emn sn() lxrmo3oatlp ranvs;()t2ur(r no4amtn net s)aDumuro;o1tltnmociad m uanvo t)teerxr oa1fa   ivsls0 exmxo oudomenlneil()s2ur(rpnt4oeeo fetltlsDeau o (4 rtoxr oo1fp   nvi;(0 rumim iu4lmtelnvt t) Dumumo;o0oeeomociad m2em(vpnu0trxomr3ty1fmDelueols0srtoxr nodam n ncta(fsDtr(ronu0tlt  ieiadfs2emnms () exnmr tadoa elueo () etm(opnudalt  icsls a2rauront0alxnif3iyt sDulnmpnt4tetoir tadfmD lneil( srxmxr ny4llen ivtls)aDtmxr no4opeoioctltfsDemnmpn(0altrmf3iadlmDe ues;t)sexoxmpno4lm emfei (f Dumx pno0olt  iciydfa ra(vs;u)aleoxr oa1lmt an s s) 2xmiopiy1am n ncsatf 2ur(  ou1opxnmfciysls2rm(vs (4aexnircoo1opDr i o;s)truoxrpno4lp   ivs t a2rmuro;o0tetoifciad mDuluvsnt) leoio3iytlaDeau o s t2urxm ou4ol emncia(fs2um(ro;o0alx mf3iydfsDelnms;(4arermf ta1optr i o;s) rxo(r iudolt lfetasfsDrax oou0tle mo3ildfs umuvo u0tetnio3tadla elnesls) ruriopnu1om n net (  2rrxront0opt  ictydlsDeauvsnt0 renxoctatfpteai o s0 rurio3iydlptnmfct ()sDtrxmo;o1alenmieiatfsDrluvp t) exnirctodla r ues;( t2tr(m3no4op   fvi t) Dtaumpnu1tex  o3ildla2rmu p t4 rtomr iytoa rluvi s0setmxo3nodolte ics s artrxmono0tpenifeiytlsDuaumo (4tleoxo3iatoat aneo s sexrxrpno4am nmfcsl(f rtrumpou1ale miciys a em(vs t)aexnxrcty1lmtraivi;t0s2xrir3oy1alt  nvtas) rra(r no1apeo oeiyslm2uaumsnu0areomo3iadfp r nvo s srumxrpou4apt mncia( arum(r ;u4aexnmieiysfsDranvs;t0 lenxf3ta1lmD an s t0texrio ou4lme  fei s)sDuau  ou4opt  o3ildfa2eau o t4altnmo3to1fpDelneo;s trtrio ny4lltelivt sfs2uaumpot4alenmieiyd s uanms t4 lxrmr3tytfm  ai i;()trur(o oo1optn fei t s2trxr oo0aeeomocildfa2rl( p u) ltnxrciotlm elnvi s)t2xmxo3oo4lpeemfcsat) 2taur no1alxniociatfmDranmont) rermo3oytlmD aueil(  2xo(o3iodaptemnctlsfarraurpot1aetomfetyt m rmums;t4alxrio ootoptr n i;s)texoir nu4openlfvias)s2ua(  ;u0tpxnmietad a2umnmp t4tlerxr3ty1lm rlieols0 2xmiopoudoptnlfet tf rraur ;u1oet  i3iasla2umuvp;t) renxo3iy1omtelnvslt0 2xmiopno4lm e nci t)sDrm(mpno0oleomo3iys a2ulnvpnu4 exoxf3ootlp   u o t0s2um(r3iodap e icilsf rumx  ;o1teeomociasfmDrmump;(0 exnir3ia1lpt  uvs s  exmio3oy4am emnesas  2umu p;o4aptnii3iatlsDea(vs;u0artoxociatop e neil( setoxo3nu4lm  lnvil() 2uau  ;t1tpxoii3iadlm rauvp;(0artnxr oodopD  nvs;s s2xrim3oudlm  livs s)s2uax oou1olenmietls a umuvs (4teenio3tadopte ies;t)srxmxrpnu4ap  miet t)s2rauro;t1aetn octysls2el(vp;t0tltoio oodom rlnvols) etm(o iy4al nmfcs t srrmxm oo4optn oeils a2ua( o t4 ltriocoadfpDe ies;t)srtm(r iu4lp e fet s)sruau oot4aeeoifeildfs2uluvpnu4trenxr3tytlpt lu ol(  2xoxo iodap elnvsl(f ruaxmpnt4alx mo3tydfa umumo;t) etrmf oadomtraivi () 2xr(rpnudamt lietlt)s2rmxrpoo0aeeoioeiatfs ra( p;t)tetoxf3oytfmD anei s t2uo(m3io1lpte fciltf rrm(  no1oltomociytlsDrlu p;u4 ltnioctotomt aues;s) exmxopio4ll nmivi s arurxroot1opxnio3ilslm rmuvs () leoir3iatoa eau ils  etmirpnu1omenmfesat)srrmumont1texomieiyt s2ul(vp (4 lenmo iy1lmtrlu i s0t2to(mpiy4llt lnci t)sruau pot1apx io3ilsfm2ul(mp (4 lerxf3oadlaDrluvil()srtm(rpoo1opeelfvi ( a2umu  ;t1openmi3tadfmDrlu o;u0teeoxr3ty1fmte ueslt0srxmimpno1omt lncs (fsDrrxr oo1apenmietas a emnvpnt4teerir oy1fat au o s) rtriopoy4amee nvsl()aDtmxmono4tetnmo3tasfmDulnvpn(0teeoif ta1om rli slt s2tmxopiudam e ivil( artax p;t0tlenii3tldlsDeaums ()tetrio tadfmD aues;s  2xo(r oy1omtelfvi ()aDumumo;o1aex ifeiatlm ea(vs;(0aetrxo3ta1oaD anvs s) 2xmirpoo1ll nmivsas  2ra(roou4ale  o3tlsls2ul( o;u0tetrxr oydla rlnvi;(0s2uo(m3nydlp n feiatfarum(mp;o1aee  ociad a2rl( p t4arxrmf3iy1oaDrlneo;s t2um(o ny4lmee ici tf rurxrono1optoif3tasfm2emuvo () renircoytlmD livs;( seumim nu4oltnmnvtl()sDuru ooo4alx  f3iysfm rauvo;t)teeoxo3oadlp   ivols)s2uoir oy4lptnlfcta( sDta(r nt0oet ioetas sDranvs;(0texnmrcta1oat auvsls s2trxrpoo1opt  fcs (fsDrrxmont1tet ii3iyd mDumnvpnu) rtomrcoadfatr iesl(0 2xo(m3ny4ap  lfvtasf 2ra(root4tpe io3tltfm rln s u4altoxr3ia1oatrlnvi;(0 2xmxr nu4llenmnvtas) 2ra(mpou4teeomi3tat m2umu o (4alxnio3oodfmt aiesl( sruoxopio4lpeelnvil()aDum( oot4tet  f3iyslsDrm(mp;t) eerxo3tydfptr ieols0srtmxm no1ale lfvslt a2tmurono1alx moctadlm2ra( o u4alxrmoctydop rauvs ()srxrxm no1lm nmfvs s aDra(m oo1tlto octldla el(vp (4 exnxo3oadlp   n o (0 ruo(rpnodlptn fvt ( a2tax  ;u1optnifeias s2ra(vs u4 renif oa1oatrluvi;s  2tmxm io4optn feslsf Draumoot0aeen oetatfaDrlumo t0 ltoxo totopt auvi s srtoio iudoleelnvi t) Dta(r ;o0tptn i3ilsls umn o u4trenircoatlmt  nvo;s)trum(m nydaltnmiei t)aDua( p;o0olxn ociadfa ean pn(0aeenmf3to1opDe ieo ()s2tm(rpny4lle micia(  rumum ou0tex moeiadlsDelnmon(0aetoxo oatlp r i ols)teur(o nudalt mfei s  Duaxmp;u1tlxnii3tys s ua( ont)teeoir iy1lm r nvilt)t2uriopnydll elnet sfsrrrum ot4ape ii3iatfa2rl(mp u)texrir3to1lptr i o t trxrio ou4om emicsatfsDuax p;t1ape mf3tld a rm(mo;u0aetrmo3oytomtrau s s0trurio3iodaptn nvtl()arrmumo;o1alxnifctlt s2uau p;() etnif tatom raivo t  rxmimpny4lme lnviat  rrmu o;u0aee  fciytfm emuvsnu0tlxnio3oa1la   neol( teuoxr3nudoptemncs ( aDua(ront0alt moetys aDra(vsn(0texrxfctadopD  neil() 2xmimpoo1al n fei t  Dta(moot1ole  fctldfmDuauvs;(0tetomfcoo1om r uei;s0trumirpiy1lptnliei ( aruax poo0oeeomi3tlsls umumo;u) rxriocoodlm   ivo s0 2xoxo3nu1llee neilt)aDra(m no1tle  o3ild m2raumsnu)texrir3tydoa rau i;t)t2tm(mpno4apt mfvi ()artr(mont4altomf3iadla2ul(mpnu0 ltoio tatfa rli s;t) 2umxr3io4ap nliviat aDum(m ot1aexn fctad mDeanmonu4artnif oy1lm   nvol(0trurxo nudam   ictl(fa2um(mono0oeeo ictasla2umn ont0 rtnmf to1fmD lueol(  rxrim oy4ape livsasfaDuax  ;u1tet mocilslsDemu s;u4 lxnif3tydla r uvo s0t2toim iu4altnmiesl( a2rrx oot1olto oeias mDum( pnt4trxrio3iadoatelues s sexoxr3oy4lpe mivtls sDraxronu1tetnmicildfsDeln ont)teeomrcootfaD  ivi t0s2xm(r oy4lpe lici s)a2tmxmp;u4teeo i3ils a emnvsn(0tetrmfciatoaD  i sl() 2tmim oy1llt  fcil(  2tr( pnu4opx io3tys m2ulnvo;t0 ltriocoodfm  li slt trxo(rpno4oleemfct (faDtm(m nu4altomoeiatlmDem(ms t)tlerxf3iadfa e i o t t2uoxr ny4alt miet ()a2tmxr no4oee ifcilsls2rmnvsn(0texrmo3tadlp  livi s0truoim iydaptelfcias  rrr(moot1tpenmieilsfm2rm( pn(4tlxrxr3ty1fp rauvs t sexrxo3no1aptemivia(  rtr(r ou0aleoii3iatlsDeluvp t0 etnio iadopt luei;()seuoxm nydoleemfvia(f rtax oou1apx if3iyslm elnmo u)aetrxo3tydoa  aivol( t2tm(o3iy1ope  neiat)artrumpot1tlxomiciasfa2eanmpnt) exrxr oytlp eau o s0 2xo(m3oo4ol n fctat  Drau o;u1oet iieiydla ra(vo (0alxnmrcoatfateluvi s0trumxr3ny4ap elietas srrr( oot1altoifeildfs ulumo;()aeerio oa1fp e ies t)t2xrxm3oy1optnmnciltf rtrxm ot0aet ifeiyt mDemnmp (0aexnxfcoatfptrlnes ( srxoxmpno1lm n iei t) Draur nu1opeo ieilt mDelnmonu0 exoiocoo1op   ueo t0srtoxo ou1olt mfeiat) Dumu p;o0tet ii3tasfs rm(vs () lxnmf3iatoptrln ilt) 2um(opnu1llt  fct s  2tmum ;u1tpxoiieiadfm2rmuvp u4 exrxr3oo1op e n o;t) euoir3nu4apenmies () rur( oot0opeoiictyt a2rmu p;t0 rxnif tydlmDrli i (0 rurxr iy1lm elnes (fsDua( pnt4ape iieiydla umumo t)tlermfcia1fpt  ivo;s trxm(rpnydol  mivtas aDurump;u0optn fctas m2umnvsnu4 etrxocoydlm ean s;( t2uriopoo1om elfesa(faDraum no0aexomfetadfaDul(vpnt)aetnir3tydfatelu i;(0 rxoxr3oodoltn iesas  rur(  ot0olt iieildfs2emu p t4texnxr ty1lmDelnesls0s2umxm iydamtn nesl(faDraxmo;o1tetnmfeilt a ul( pnu0artrxo ootfmt au ils  rum(mpiu1lleelfeil( aDrm(ro;t1oleoiociysla2em( o u0aetomrcio1fat anvs s t2tm(o ou1lmtnmnviat) 2ua(rp;o1alxn o3tas mDuanms;(0alxniocoatoaD aivs;t0s2toxmpiudam n net tfaDtrx  nu4tlxn fciasfs rl( p t4 lxnxfcoodfaDeau o;(  exmxr3oy1lp nmiei () Dum(r oo1ole ifctlt m2ra(mp ()alenxr3oatfmDe nvo s s2to(o nodame lfvias  rrm(r oo1tpt  oeiyd mDuanmo;(4tltnmr3io1lpt aneol(0srtr(o no4aleemncsls artrx o;u0ole  fcild aDra( o (4aleomr3iytlmDr n ols)t2trir3iudopt  fci tfs2um(r oo4tpe ifcild m ea( o;u4artomfctadoptrau sl()sexrio3ny4ol  lncil( s2ra(ro;t0apx iictaslmDrm(vs;u0tleriocoadlate neo s0s2uo(mpoudal   nesat)aDtmur nu4oleomi3ildla umuvs;t0trerxfcoa1late ies s0 eum(o3oo1amtelfcsls aruru pnt4alenmf3ilt aDuauvo;t)tlxoxfciadomtraivo;s0 rtrxrpnu1ome  fvsat)aDtmum oo1tex mfetadfa uaump t0tetoio iotlmt lnvi t)srtrir ny1lpe  ncil( arurx poo0oee io3iasls em(msnt0 etnmf iytlmtrlu ilt s2xmirpny4ape mfcsls)sDtmxm no4tlto i3tydls em( p;(4aeerir3tadoaDeauei;t  euoxm ou1lle lfciatfarua(ro;u0olx  fciadfs rmn snt0 rtrioctytfa rlueol()sexoirpoy4omen ieslt arum( onu4alt  i3ilsfm rlnvo t)aeeoio3iodlmt aivi t srto(m3oo4alt lfvtltf Drmx  ot4aleo iciatfa ul( o t0aleoxf todoat  neo;s0 2trio3oudlptnmfvia() 2umxmp;o4opx iictysfm2uanvs t4altnif io1fmt luvs (0trxm(m3oy1alte feslsfsDtmu  ot1oltoio3tld a emuvpnu0trerircoatfpteau i;s0srtr(m no1oleeliesas)s2ta( ooo0tpxniietad a umnvs;(4 lxomo iodoa elnei;()t2xr(o3iodolt  fctlsfarraxrooo1aleomi3tydlm2emn p u)treoif3ia1oa eln o (  ruoxm3nu4lpt mnvt t) rta(m ou1texoif3iytfs2ua( ont4texnxf3iydfa  lues (0 eumim ny4opeelictlt)aruau  no4tleomoeils m2eanvsnt4alenxfctytfptr n i t0 exo(o nu4ap nlnetls sDrmu p;t4aptoifeiydfs2uanvonu)tltrmo3oo1fmt ai o (0teuoxopiu4al   icslt)arurxr ou0opxniieilt mDrm(msn(4 etomo3todfptrluvi s0teurir iu1ll e nctlt)a2rr( pnt4tpe mi3iyt m rmumo t)tetrxf3iytlptraues s truo(o iy4optnlfvi tf Dtm(m no0tpxoif3ildfaDel(mp t0tetrxf3oo1lp ranes;s0 2trio3ny1omt  fvilt  Durxro;t4aex  f3ias m2ulnmsnu0tleoxo3ty1oa eaivi s)t2uo(r oo4lmee fct s) rtaxm oo1olxo iciys aDrmuvo () rxomr3oadfat au o;t) eum(o3iu1opee fes s)aDrr(m ;o0aptniictat mDulump u4tltoiociatlm elnes;s)srur(rpnudap elivsa( srrm(  ;o1aptn ieiad a ulump;u)teerif3tydla elneslt0teuoimpoo1amt  ivi tfs2trxmo;t1oltomf3iydfa2umuvo;(0 etoxo totfpD au i t)texoim3nu4lp  mnvs tf 2rm(rono0olxnif3iasfm ulu p;u4 lenxo iadfmDeaieo;t t2trim oudlm emncilsfsDum(mono0oet  icild m rmn o;t4tlxnmfcoytlp eluei;s) exoio oudame lietl( srtr(m ou4tpen icils s emu o t) rxrxfcia1faDe nvs ()setmio iu4lltnlicilt  Durur ot4olt moetyt a rl(monu0artnxr3tadom eai s ( trxm(o3no1omeemfetas)sDumx o;t1alenmi3ild m rmnmpnt)aetoio iytfmD auvs;t) etm(m3iydomee ncias  rur( ooo1apeo oeild mDemn p t)aexrmf io1oaD auei;t tetoxr3oy4lp elnet t)a2rmumoou4aeeomictatfa2ran pn(0aeenir3todoaDe nvo;s trtmxo oodol elfctlsf Duax pnu0opto f3tldfs rmnmon(0alermo oytfaD ln i;t)teumxo3oy4lp nlfetas) ruauronu4apx  oeias s uluvp (4alerxo iatlmDeli i t0trumio3nu4op n ivta(f rta(moou0tee mf3iysfsDra(vp;u) etnir3ootlpDeli ilt)setmirpny4optemfetlt aDuaurpot4texomf3iysls2elums t0 ltoxociytlm ean slt s2tmxr3ou1apeemivt tf 2rax  ;o0olen ieiad aDelump;(4trxrxrctytfateaneil()setmxr3ou4ole  fvtatf 2umum ;o0apenifciyslmDel( sn(0aetomrcootfmD ln o (0 eur(mpiy1amtelnvia(f 2rrur ;u4altomociasfs2uluvs u4tlenif3oodla  ln o ()teumim nu1ale mnetls)s2urum ;o0olenmoctltlaDelnmsnu0tlenxr ootopD anes;s)srtrirpio4optn fvtlt  Dtaumooo1tle ii3iasls uln pnt0 lxomfciatfmDe nesl()sexr(opny1apenlies ( s2rmurpoo4olto ociyd s umn o;t)tlxnxr3oa1fpteluei t)t2xoxm oodap elivi sfaDtaxr ;o1aptnmoeiadfm2rl(vo;u0 exoirciotomtrln i;s trxr(mpnodoptelivi tfsrtmurp;u1oexniietytla ra( pnu0 eeoiocoy1la r ieols0trtoxr iodlmtnmfcia( s2taum ;u0ope mf3ildlm uaump;()trerxo oytfm ran o;() rtoxo iodllenmivia(  rrm( ono4olt iictyt a el( snt4 rtrmo tydoat ln i;t trurxrpoo4lpte ivia() Dtm(  oo1ope mo3taslmDem( ont4 exoxf iadla r n i s  rxrimpiudlm nmfctlsfa2tmx  ;t0alxnmieias a2elnmp u4aetrmo3totla eaneils trumxm iodoptemnctatf rua( ono0aetnmf3ils a elnmo t) lerir oy1fpD an sls)t2tm(o oodoptemivils)artrx o;o0ope mieiat sDrl( pnt4aetnir3oadfp   n ils) 2tr(r iodam emfesltfs2taxr ou0teeoifciadlmDrlnms t0 rerifctadoptrai sl(  rtoxr3io4lmenlfcsls)arur(mont4aexnmoeils s emumo (0 leoxfciadopDrauesl( t2toxm3oodaptemivsat)aDtax  ot1olxo fcildls2emu s u)areomfcoatop r iei;s0 rurxopoy4aptemnetls)srumxr nu0openifeiyd mDuaumont0aexomr tytfmt lnvo;t srxoxr oudlmeelnes sfsDrauro;u4oex mfciys aDrm(ms;u0tetomf3totlm e uei s)srtriopnu4ap  mivtlt)s2tm(r ;t0tpxnifeiyslaDeaumsn()teeoir3oo1opD an slt0 2uoirpno4oleemfvils)s2uax p;o4tptoioetat mDemnmsnu0teeoxr3iy1lpDraivo s tetoxopnudlp  lfvsa(fs2rmum no1aee iieiysfs eaump;() exomf3oadfatelivs ()seto(r3io4aptelivil(faDrr(mono4tleomi3iadla rm(mp;t4 lerif totlpD  uvo;t0seur(r ny4am emfeiltfarrmum ou1opxnmoeilt s ul(vpn()artnxrcoytoa r nvo;s0 2uoxr3nudop nmics s)sruaxrpoo1opxnifeild a uauvp (0 lxrifciadfat  u il(0 rxoxm iy4olee ivt sfs2rrxrpno1aeeomoetltla2ulu o t)alxrir iatfa   uvo;(0teumim3iydlle mfvs s aDrmx  oo0tpeo f3iatlsDum( on(4 exoio iadfaDrau i t srtrir iy4oleelivtas artm( o;u4tpxo oetasla eln onu4arxnmr iytfmtr ies s teum(mpiu4apeemneilsf rurxm nt1oetnifeiytls2ul( snt4tlxriocoydoaDeluvs t0texoxo3iudome lfvt tf Duaum ;t0ope ioeiydfaDulumo u)tetoir3iytom raiei t)seurxmpoy1am emivi tf 2tr(mooo4alxoiociydla ea(vo u0treoxf oo1opDeauei ( t2xrxr3oodlpee ncsltfa2tm( pot4texnmi3iltfa uanvs;u0tltoxoctydop rlu olt tetrxopiodomeelneta( a2rru o;u0tptnmf3tas mDeluvonu4trermr io1lmDean s;( s2xmxrpnydamenlfvils srta(moou0tex  octld a2rm(mont0tetnxfcoadomDelnvo ()tetmxr3io4amt  ics sfs2umxm nt0texnmi3tytlm uanms;() rxomocoodlp eanei s0trxrim3ou4lle lnvil(fsrtr(mpou0ole mfciadlm2rm(mo;t0aetrxo ootfp eln i;()seum(r iy1ll   fvta()s2trumo;t0teeo ieiyt mDrm(mon(4 rxomfcootoaDrlnvi;s srumxrpno4amtnmfetls) Dumxr ;o0tlx iociasfs2rl(vp u4trxnxr ootlatelivo;(  2urxrpou4ale mies tf Durx p;t4tlxn f3tldlm2rlnvp (4alxnir3oodfaDeauvilt  exrxm3ny1lm nmivi sfa2rru oot1ope if3tldlsDrlums;t)aetnifcoodlp eaueolt)t2toio3ou4om   nvil(fsrua(mont1apeo f3ils a uln p;(0trenxf ta1omte ivil(  eurirpoudomenlivsat) rum(r ;t1teeo i3tas m uau p;()areomf iodfmD lnes;(  rum(m3io4lm nmncs sfaDtr(mo;u1tpt mieiyd m ra( pn(4 rxnxo3ty1op   uvo t  2tm(m3oy4ap n fesa( srrm(ront1apto feiysfaDemums (0alerxo iotomtrln i s trxoir3io1amenmneil() 2ta(m ;u0tlxo o3iat sDelumsnt)aeeomo3oadoa rau ol(0 exmxm nydlltnmnctl()srra(mooo0alxo fctltlaDra( o u) ltnmf tydomtr uvil()t2trxrpnu1ale  ivs (fsrra(mp;t1alen f3tlt a uaumonu) etoxfcta1la rliei;t  etrim oy1al  liciltfsrur(  no4tlxnmiciytla2ean pn(4tltomo iodomt  ivs s t2tmxo ou1am nmfvsas) Dtmumpot4aeen f3iytlm2emums;u0aetrmf3oa1fa e ivo t) euo(r iy1opeelfvsatfaDtaumo;o4tleoii3ils a eauvo t0arxnxocoy1lpteln sl() exm(m3iodomt  nvils sDrm(ro;u1apeomocias m2em( o;t0aetrmoctadlaDran s t tetmxo oy4lm  lfetl()sDtm( onu0tee micildlm2eaums;u0 leoifcoa1lm raivslt0 rtoim oodomt lnciatfa2tm(m ;u0tpx mictasla2emnvp;(0aleoifciotomt  uesls)truoiopiy1al   fvt t)s2rmxm ;o1tpe iociytlmDelnvo t4 lerio todop r neils srumim3oy4ol e fcsl(f ruaumpoo4aetoifeiydfsDum( pn()tetnmo3ta1oatraivslt)trur(o3iy4lm   nes (  Dumum ou1tptomo3iadls ua(msn(4alermoctotop ean sls0tetm(mpoy4altelfciltf Dtmumonu4tpxniiciadfa2uaump () rxnxocootomDeaues (0 2trxrpio1al nlnvia( s2um(ro;t0tlto o3tyslmDrl( p;t)trxnxrctodoat aieo;()trum(opiy1amte nvias aDua(rp;o1opxomo3ild mDuanmp;()tltnxfciy1lmDelieilt srumxrpno4al n ieiat) rrmuroou0tltomo3tadfa2uanvs;t4teeoxr3iytfptranei ()sruoir3io1amt licias)arurx  ;o4oex iieiyd m2ra(mpnu0altrxfciytlmD ln s s)trurir3nodamen nctlt)a2tr(mooo0oexoioctatlaDul(ms t0altrmrcoodom   ueo;(0 rur(opoy4altemfetl( artm(rp;o4tetnmi3iltlm2rmn ont4 lerxfcoydom  lueo;t0t2xo(m oy4lmt lfcsls  Dtmum ot0tpto fetyd a2umumo (4altoxf iydlm  ln slt) 2tmir iu1ale livsl( a2rm( ono0oltnifctytfm elnmp (4 etrxo oydlpt an ils t2urim iu1ap  mfvtltfarumu pno4texnmfetls m2rau on(4tlenxrciotoptelneo t)trxrir nu4lpe lieslt  2ua( oot4tltniietls m2emn s u4texrxo oy1lmDe ieols trurio3no4oltemfvs s)s2uaxmpoo1oexn ociytls2rln onu4alxoircootomtrli s ()sexr(m3ny4am nlictltf Draur oo0tlx ifeiatfa2ran s u0altoif iydlpDraivs;(0s2toio3oo4lmeemneilsfsrumum ou4aptnifetaslm elumpnu4alxnxfciadfpDr neilt)srxmim nu1op nlfcslsfs2rmump;t4oeeomoeilt s ea(ms (0teenxrctatfa e uvilt0s2xm(opiu4olenmfcslt sDtmxrpnu4oee  iciad m eaumsnt0aleoif3ia1laDe uvsl(0srur(o oodlpee feilt s2urx pou1texomicildlaDuau p;t0 eeoifctadoa  ln i;() eurio3nydlp   nes t)artr(mono0oex mieilslmDum(vo;t4teenmr oa1lp eau i (0seuoxm3nodlp emnviat)a2rr(rpou1tetnifeildfa rmnvp;(4treoiocoytopt  ues t)s2to(opiy4lpeemivt (f rrax  ot4aex mociatfs2emu pnt)trtnioctydfmt lieo t)trxmimpiu4om  mict s)s2ra(rpou1tle iociaslm ean snu4tlerxrctatop r nes;s0sexoxm3oy4lptemncta( s2tmu onu1tlxnif3tatlmDrlnmp;(4 exoxociytlaD lueol( trumir3ny4lme  ieta(  2tmxr ;t0tle  fctyslm ean pnt0tleoxocoydfptranvsls0teuo(m3no1am n ictl( s2rmumoot4tpxnii3iytfa2ulu s;(0tetrifciydfpD aivo;() exoxmpoy1lmte nesl() 2ua(mpou1aeeo ociatlm2umnmpn(4arxoxocoydoa elnei ()trxrxo nudolt mfvi ()aDrrx  oo4alen i3tatfm ulumo t) rxnmo3to1opt an s s0srxrim nu4amtn nei tfaDtmu pou4oeeoifciadfm2rauvon(0treoxo todopDe uvi s)t2tmim iudom nmfvi t)s2tau  oo4tpxomi3iytfa em(ms u4 rtrxociodop   i s s setrio3oydlpt mnvt s  rum(rooo4tetoioctytfa2rlu s t) etrxr iydfpteauvs;t0s2xoxm oudop  lnvs t)aDtau pnt0ole mieildls ranmsn(4 lerif tytlm rau sl(  exoxopoy4llee feslt  rua(  nu4aex moetls m2em(mo t)aleoio totlaD au il()trtmiopoy1omt lnvtatfa2rmxroot1alxniiciatfs2ea(vs (0tlxoxf3ty1fate ivs ()trtr(mpno1lltn iciatf Dtru  ou0alt mfeilt sDrluvs t4aeenmr oa1latraues t seumim3iu1lm  lnvia() 2ra(mpnu4apen ociytlsDemn o;t0alxrxr todom e iei ()s2xo(r io4omeemfctatfsDurxmoou4tptnmieiaslm2rm(mo;u0aeenmfciatlm  lnes (0 2toio3oudapt  nvtlsfsDuau ono0tlx ii3tyslaDeau on(4aetrmr iotomtrlueols0t2umio oo4lpe mnesas artmu oot0tptomfeiltls rmuvp u) renmfciy1om eaues;(0 exr(r3iudamtn iei sfaDraxm ;o1ape mf3tyslm ea(vpnt0trenmrcta1oat  u ils)t2xr(o ou1apt  fvslt)aDtrum no0oltoiociysls2em(mp;u4aexriociy1opD  u o;s)s2uo(mpnu4lmeelicil( a2uaurpno1olt iictlt aDem(mo;(4 lxnxfctadfa ranei s0trurxrpiu1ap  lieias arrrxrp;o0oltoifeiydla rl(vsn(0 rerxocoatoateau i (0s2xmirpiy4ap nmnvsa(fsrur(r no1tlxomi3ilsfs rmumsn(0aexrxocoy1omt  ues;(0t2trir oo4lm emies (f Dtrum ;o1tptnmoctydfmDulnmp;u0tlxoio to1op rauvo ( sexmir iu1am e ivi t sDuaxm ;t0tleoiictys m2eauvont0arerxo3ootlpDrauvsl(0t2xrxopoodol  lncta() 2rau oou4aexomi3tat mDel( p (0aexrmf3ta1fpDranvolt)t2xmim ou4op   nesatfarumxrp;u4oleoifetad aDel(vsnt0artnmo oydomtelu i;t0 exr(o io1lp n ics ()a2uax p;u4alxoif3tat aDumuvo;t) ltrmo ty1fmtr u sl()setrxr io4ol elietls) Dumu onu0oetnmfciad m2eln pnt)trxoir iydlaD  u o ()trtr(o3oy1lpt livsat)a2uaurp;o4oeeo ietlsfa2ul( ont4 rtrmf tytlpD lu s;(  etmimpiydamen fcslt)s2raur nt1tex  icilsfs elnms;u)texrxo3oydom  ln sl( t2tr(opnudale  nvtls srtr(rp;o0altn i3iysfsDuluvp;t0teenio totop eauvil( setrio3iu1oltnlfci (fartm(m ;u4tltoiociaslaDumnms u4teermf3iytlpt auvo;t)srtrim nydaptemnvtls arrru  ;o4apen i3tysfs2uauvo;(4tltoio tadfp e neo s  2to(m ou4ol elnvias  rua(m ;o4altniociasfmDemuvpn()arxomr iy1op eaies () 2ur(o3iy4omtemfcsatfarrmur oo0altoiiciys m2elnmp ()teerir3tatla rai o ()seuoxmpno4opte net ()aDua(mooo4opxomieiatfmDulu snt4arenxoctodlaD aies;(0 2xr(m3io4ole livslsf 2trurono1alx  f3tld s rl(msn(0trtnif iy1lmDranvs t) 2urio3iudamt livilsf 2rrxr nt0opeoiieias aDumn sn(4trermfciodoa eaueol() rurirpnodlmtelictlt) 2tauro;t0tetnmo3iydlsDumuvp (0tetomf3ta1fp   nvi;s srtmxo no4amtnlnvil(  rtru  no4aex mf3iad s rau o u0tltrxr3ia1lp r u o t seuo(m nydale lict s srtaurpou0altniiciltls uanmo (4arxrmf3tydomDr uvs t)s2toimpiudole  ivta()s2umuro;t0aetomieiys aDea( p;u4 rtnir3iodfateanei t)teuo(o3io1ope liei s  Drru poo4ole  i3iysfa2ra(vo u4altrif3tydoa elues;t)srur(r io1ol nmfeil( sDta(ro;t0oltoifciaslaDuan ont4 lxomf todopt aieo s t2xr(opiu4altelieils)aDrr(monu0texnmo3tltls eaumo t)treoirctotlmD  nvo (0texoio nudomtnmivta(f rtau  ;t4aptn f3iyd m umuvsn(4texrifctodfp rlnvi;s s2umiopio4al n fet sfaDraumooo1tltnmf3tls a2emnmon(0 rxrxr3totoat  neslt sexriopnudoptnlicsl()srta(r nt1opx if3tls m ranvo t)tleoxr3iadom raues;t0srxrio3oo1ll n fcsls aruaurono1apxoif3tys m rlump t4 eeoir iydfm e ueo t)teurxrpiy4ol nlivilt)a2tm(m nu0olx mfetls a elu sn(4 rxrxo3iy1oa e ieol( t2xrxmpoo1lm n nvsl(fsDtmxr ;t1optn f3tytfm2ranmo;u4tlerio iadoptrai i s0teuoim3nu4ame  nviasfarurxm ;t1oltoifciydlsDraums;u0aexrmf iytfm r iei t)teur(r3oodll   ivi ( a2um(m ;u0tpxnif3iadfsDuln pn(4arxrircio1faDe neslt0t2xmxr3oo4amenmieia(fsDtm(rp;t4texnmfciytls ra( ont) rxrmf oa1opt anvo;(  rtoim3oo4ape lfcsls)aDtrxmpoo0oeeoii3tydfm2rm(ms u)tlxnxf3tydfp elneol(0s2xr(rpnodop elfes () 2tru ono1aexo ieiysfsDrl( o (4aexriociydoptr neol(0trtoxrpoo4omeemfeil() Draxm oo1aeenmfcias sDuauvpn(4altoif3ootom raivolt)teum(o ou1opeelnvsls)aDrr(rono1opxo feiaslm uaump t0 ltnir iodlatrai o s)trto(r3iodapt  nesl()arurxrpno0alxoiocias s ea(ms;u0 reoxociydlmt lnei s0 2trxopiy1altemnctatfartaump;t1ope  ieiysfm2uaump;(4trenmfcia1lpDr ieo (  2xrio3oy1aptelncsat)arua(rpnt0tpx mf3iydfm raums;u0tleoxfciy1latelnesl(0 rtmxo oydlm  mfcsls  2rm(monu0oltomoctls a2uanmpnu)arenmo tytomDr n s t sexmio3oo4ll n fetat  Draumoot1apeo ieildlaDea(vont0trtrxo3iy1lmD luei () 2um(rpoydole lnvias)aDururp;t4opxomocilsls ra(vp u4 lermr iodfat  ies s0 rtm(o iy4alt lnvs ( s2rmx p;o0aetomoetytfa2eauvo u)tlxnmo3todfaDelnvs;t0 eum(r3ny4lmt  feslsfs2umu  ou0aee ii3tlslmDran on()artoio3oadlm e uvol(0texmxo io4oltn ivia(fa2tr(rpoo0tpxniieiytls rlumpnt0treomrciytfpteaieo;t  2um(o3oo4ol  lneils)srraxm ;t1apxomoeiytlmDelnmp (0trtrmo3ia1lpt aieolt trtoxm no1ol  lnetasf 2rmum ;o0olxoii3tls sDumumo u4tltomr oydomt li i s  rtrxo3nodome  nctat aDumx ont4opeo f3tas sDua(vs (4 ltrmf3oadoaDrlueo ()seurim oo1ape  feta() Duax oou4oleoiieiyslsDul(mp;u)treoxocoadla   iei;s)srxmxr3oudal  lneil(fsDuax oou1altn fetydla el(mon() eeoif oadfpDr ivils0 exo(o3nodlptnlfctas s2rrx  ;t0alxn iciydls eluvont4altrmr3io1op  lnvo;t) rto(m3no1amtelfeils srua(mpoo4tlxoifciat s eauvo ()alerir3iodfm   uvo;(0trto(o iudopte ietasf 2trxrooo1tptoio3iatfm umu sn(0alxoir3tytlpt aivsls trurxm oodalenlfesat a2rr(moou4tetnii3iltls rm( onu0tlxrxrcoadoptranesl(  rtm(o3oodlmtn fcs (fsDum(rpot1tpenmieiyslsDum(mo;u0alxrxrctydomDr ivs;t0t2tm(opiydolt mnvia( srtr(m ;t1optn iciat sDelnmont) exrmrcty1latrauvo;(0s2urimpoy1al emics tfaDrr(mpot1oetomoetyt a2emumsn()trermr iy1lmt  u i t)tetmxo no4ll nlnvs sf Dtaump;t4tptoii3iaslm2rauvonu4 etnxr3iytfaDe neo t srxoio iydap elnvi t  2ra(r ;t0texomieias sDel( p u4aeeoir iatfa elies;( srxriopiu4oltnmncslsf 2ta(m ot0tex mfciadls uauvo t4texrio iadfmDraieo;( srtrio oo1am  lnesasf 2rrx ont4ape ioetyslm2el(vsn() lxoiocia1opDranes;()t2xoir iydol elivtas)a2trx  nt4opto oeias aDra(vsn(4tlenir3tydfaDeau o;s)texm(rpiudol nlncs ()a2rax pou1aleo iciltfm2um( p;t) ltrxr3oadfptr nvi;s  2tmirpoodlme  ici t arrrx p;o0olxoiociytfaDem( s;u0texrio3ia1fptranvo s teumxmpnudal  mfvtatfaDtr(ro;t1oexnmi3iysfs elu o;(0tetnmr oy1lm e uvi s)s2xrio nu4lm e fvtls)artmxmo;o4apxomo3iydfsDrauvp u4 lxnir3iydopDelnes s s2xoxr3nudlm elfeils)arum(mp;u0aptnmietat mDuln s;(0tetniocoatlmteauvo t0trxm(o3oo1lp emiciat  2tru poo4alxoioctytls2ean o;u0tlxoxr3iy1fp e neo ()t2xoiopiy1am nmncslt s2taxrpoo1apxoiictad m2rm( o t)trtomr3oytlaD luvolt0texmio3iu1amee nvtls)a2tmu oot4oee  o3iadfm2ua( pnt0 exoxf3iodfm eau olt  rtmim iy4op nmncslsfaDrauroot4tetn i3iyd m em( o u4tlxoxfciytoa e neo s)teto(o3oy4openmfcilt s2ra(m ;o4olxomf3iys sDemuvp;t4tltnmf3iodlptelu i t)setmxr oudlmeemnct (fsrrrxrpoo1apeoiietadfs2ea(msn(0aetnxf3oodfmDr nvils)trxrio no4apt mnvsl(fa2taur oo1tlt mfctadfa umuvs;t4 lxoifciydfp   n olt0 eumio3ny4om elieil()a2raxm nu4teeoif3iytfa uluvpn(0trxrmr iy1opD au s;t)trtoxo iydomee ivtlt)srtm(root4opeo feiydfm umnvo;t0trtoxf3iatlmte neo (0 2to(m3io1aptnmfvs s  2trx p;o4alen oeiysfm emnvs t0trxrir iytomt auvo s) rxrir3iodlp  livsas  2ra(mp;u1tpxnii3iytfmDelnvsn()altnif ta1lmD livsls0s2toxo oydap  mfvs t)s2rau onu0oee ii3tydls2ua(msnu0 etomf iatop ean slt0 eum(r3oydalt mies tfa2rm(  nu4tpt iiciysfmDulump t0aeermrcoadfatrlnes;s s2xoxr ny1ap nmnei (fa2umumpnt4teeoioetltla emumo;u4 etomo tytlm  lneilt texm(opiu4aptnmnviatf Dtmuront1texnmfciadfm ranmo;() lxrmo ia1fa rlu o;(0 2urxopnudom n nvtls sDua(ronu0oleo i3ilt aDrmu onu)treoxocoatlpDranvi (0t2xoxm iydlptnlnctltf Dumxrp;o4ole iiciys m eauvp t) etomociytlmt auvo;t0teur(rpny4altemncs s)sDraxm ;t0ope ioetlsfm2ua(vpn(0trxnirciy1fm  an s () rxmxopoy1ame  nvtlt)srur(monu0tee  i3tls aDem(mp (4alerxo iy1oaDe i ol() exoim iudlptn nvilt s2uau pno4oeen feiys s eaump t)aexoif oydlaDeaieo;( srurxr3oo1ame mnvtas aruru  no0tlt  ictaslm2rmnmp t0trerircto1fmtrai i;t0srto(o oydoltnlfetl(farrr( ooo4tlx ifetytlmDeauvsnt4tltnmr3tytfa rlivi s0t2uo(o3nu4ll e nvtas) 2rm( o;o1oee if3iytfmDel(vp;t)altomo3oa1latrlnvilt) eumimpnu4om nmnvtlt sDtmx p;o4ale moetltfa2rluvp;t4aeenifcoy1la  aivo;t0 2urimpnu1ol e fci s)s2taurp;u4tpenmf3iyd a2ra(vo;t0aetnxo oa1lmtr ueo t)t2trxo3oudam elnetasfarumx  nu4texomo3iad aDemuvs u4tetnioctatopt  nvilt)t2xmxr3nu1omt lncs ()sDumu ono0oee ioeiyd sDrlu p;t0tetoir oydfpDeanes;s0 2xr(r nu4am  lnctlt  rtmumpnt4tpe iieiytfm ea( p t4arerio ia1oate iei;t0teumxo io4lm elfcs sfsrur( ono4tlx mociytlaDel(msnu0artnxrciodomt  uei t0 eurio oo1amt  ict sfsrra(m ;u0alenioeiytfsDuanms;(0alxoxrcoadom ran s t0teumio3oy1ome mfetlt  ruaurpoo0tlt if3iatfm2umn onu4 ltomf iadfpteliei;s0seumxm iu1lpt lfci sfa2tmum ;t0alxnmoeilt mDra(mp (0trtomfcoa1fmt ai ils  rtrxm3ou4ame  nei ( sDuaxm ot1tlenioeildfs ra( o (0trtoif3oatomDeau s;t)srxoxm iy1optnlivtl(  Dtm(mo;t4texomo3iyd a2uauvs t) lxnifctytlatelnvi s0s2tmim3iodapeelncias)sDuru  nu1apt iocils sDuan s u0tlxnir tydop  liei;t)trxrirpnu4aleelnctlt)artaum ;u0aex  oetadlsDeanms;t4 renxo3oadlmDrlnei s  rtoim3iydlpt mfcsatf Drmumont1alto o3ilt m rln o;(0teeoxr3io1lptrai sl( t2trxo nodoltn netas) 2rrxr oo4alt ifciyd s2rln p;()aetrio3iatomDeanvil(  2uriopio1ap  mnvt s) rua( p;t1olt  oeiydfaDraumpnt)tlenxr oydfmDe ies;(0 2to(rpny1lm nlicia(farrrxmont1teeoiietld m2em(vp;u0 eenio3ty1lmDraiei;() 2umio3oodamte nvt ()aDraumpoo1tex  oeiat s2rau s u)tlerxo3oo1fp e uvil( teto(r3iydale lfct s sDra(rpou0tpenmf3iaslsDeauvsnu0tltnmo3iotfaD aivo s)trtrxrpiu4amt mncilt)aDrmx  ;u4tpenif3ilslaDuan s;t) eeoxr3iydopDrli s t)t2trim3iu4lmenmnvslt  2taurp;t0oeeoifctasfa2umumo;t)aeermo io1fm e ieo;t) 2tm(r3iy1oltelfvtl(f rrrump;t4texn ocilsls2ra( o u4alerxo3tydop r iei ()t2xmiopiodal  livs ()arrm( pot1oex ii3tadfa rmnmsn(0alxnirctatomDr nei t)srxm(m iy4ll  mici t) Drax p;u4tpt  ociyt aDel( p;t4tlermocoodfpt lnvs;(  exo(o ny4llenmiet tfarrrump;o0ole  fcils m2rm(mp;u0 rtnmf3oo1fmD  nvi;(0srxrxo3iy1opeemiviat) Drrumonu1apenmfciytlm2rmump;u4 rtoxfcoodfatr n s t0srxoir io1omte fvi (faDtm( oou4ale mietatlaDrlnmsn()tleoxf3ty1fa  luvi;t0trtoxopnydoltnlfvsl( a2taurono0oee mf3iltfmDean p (0 leoif3iatfmt lnes () rumirpny1oltelfetl( sDumxro;u0tpeo f3iasls2umnvpnu4areomfcoytfat lnei;()trtmxo3oo1lpe  fei ( sDtr(r oo0tetn fetldls rmump;t0aexoxo tadoa rlu i;s0 rxoiopiodlp elnvs s sDumumpnt1tlxnmf3iysfm2el(mo;u)tetrxf3tadom raieo s)t2uoio3iu1lle mfcia()s2rmu  ot4optoiietatfs ra(mon(4tetrmo oo1lpDraieslt)t2xoim3io1op emieta()srra(  nt0opx  o3ias sDrlnmp t4aleomr3todlpDelies;() euriopnu1lpte nesl()aDtm(rpoo1olxnif3ias mDua(vsn(0aeermfciodfpDrluvilt)srtmim iy4lp e fvtas sDrmxm ;o1tpxoii3ias s2rlnvsnt4trerxo tytlaDeli il()trumxo3ny4al nmnctat arrru pnt4olx  oeiltla2uaump;t4 lxnxo oatoa e ieil() euo(m3oy4lleelicsltfs2raxm oo0alx  f3tasls2rmnmon(0 ltnxf3ia1fateaieo t)t2tmxr3oy4lme lictl( artr(mo;u4optn oetadlm rl(vo ()tlxnir iy1oatr i o;t) exoxo iu1lltemfvsatfa2rmu pou1tpenmietatfsDeln sn(0 rxomr iydomt ai s s seto(r3iudlptnmfctl( aDtaxrpou0tpxo fetasfm rm( s t)treomf tatlmtr ivi;t)seumxopou4am n nvilt  Duaxr ;o1tltn fcilsls rln s;(0 eermf3tytlmDe i s;s0s2uoio3nodap emfvilt)sDurump;u0tlt  fctltls umn s t0aexniociatoaD  neo;s t2ur(m oo4olenlfctat)artrur ;u1tpeoii3iadfs2ulu sn(0 rxrifcty1fa e nesls teumxo3ou4alte nvta(  2rrxm ot4opeo f3iad s em( s u0texrxf3tytlaD anvol()sexoio3iu4ol nlneta(  rtm(rpnu1aetnifcild s eauvp (4altoxociotfmDrluei s0sexrim3nu4lltnlnes t  rtm(mp;o1apt  o3tydlaDranmp;t0 exomf iytomtrliei s)setmxopny4lmenlfvsas)srumuro;t1tet mo3iad mDeau p;t0tlxnio3io1omt  uei t  rtrim ny1ll emietat  2ra( ooo1tetnmf3iad m2rlumo;u4 etomocto1fptrluesls  rur(o3io1llt lfvs sfsDrm(r ;t1tlx mo3iys s2raumsnt)tlerxrcootfm raivs s)trxm(mpnu1lpenmfvi t)sDuax  oo1tptn ietyt aDea( p t)trtnxo totopteaneo t0 ruo(o iudllenlnesas sDtr(rpno1tltniieiat a rln s u)altnmociotlptean s (0tetoirpou4al nlnvt t  2rrurpou4ale  f3iat mDuauvp;t) ltriociydfp elivi;()srumxrpiudlpt  ietlt)arra( p;o4ope mfcildfm emu pnu0texrir3io1op  aneslt0trxmio3oy1aptnmnetlt  2trxm ;o0tleoioctyt m2eanmsn()arenmocoodoa  luvo;()t2tm(opiu1lp  mfetls)a2rau oot1optnii3tyd a2uanvsnt)teerxo tytopDraueilt0sruoim3nydllen fcsa(fa2tmxm nu0tex  iciadfmDranmsn(4artrirctydlate nei;s  rxrxr3iodlm nlict ( arrrumpnu0aetn ociytfs ul(vs (4trtoif3oy1lmD aueils trxrxrpoodlltnlivta( a2trxro;u0tpto f3iysfaDulums (0 etrmr3io1fm eluvsls0t2xm(mpiu1lmtnmnvil( srrax ono4aetoioetatfm rauvs;u0tltrio3todoateaieil( t2xr(o3nu1lmt  nes t a2urxmo;t0tee  fciysla2ul(vsnt)tlxnmr oo1oaDrluvol(0 etrxmpio4omeemncsa( sDurur ot4alen fetls aDulnmo ()teeoxoctydop eliei;() rxrir nudale  fet s)sDrr(m ot1oeeniiciatfm ea(mp t4arxrif3iatfptr ueilt srtrir nodaltemneiltfs2tau oot4teto iciydla em( pnt4 rermfcta1lp  lu s t s2um(o io4optnmfctat  2taxr ;t1alt moeildfa ra(vo ()aetnmo io1optean olt0 rum(r3ny1om n fvt t)aDrrx  nu1tptniictyslaDemu p (0artomf iadopDrln i;(0 2tr(m3ny4op n fvs sfs2rmxmpnu4tlx mieils mDem(vp (0 rtrxo3iy1fate n o () euo(o nudll   neias  2ra(mpoo4ole moctldlm um( p;t)tltrxf tadlpt  iei;s) rumxo iy1lptnmfvtls sDtm( p;o1ale  o3ilslm2elu s u4 rerxr3iodfpDr nvs s)trto(m oo1apenlfet ( arrr(rpou4ale mfciltla ul( snt4 rxrmf3todoaDelneolt0 2uoxm3no4ome lnvil()artrump;o0alxnmo3ilsfs2uaums u0trermo iotlm r n i;t0t2xoxrpiodoptnmies tf Dtm(r oo4teenioetysfmDrmnvs;u4aeenmfciydlmt lieols) 2urirpnydomenmnctls) 2umxm ;t1altnmicildls uanvpn()aetnmf oodfat auvs t0 2xm(opno4ame mnetlt) rtaur ;t1aptniieiys aDum( s t0tlerxfcootfmtrluvi;()srur(r no4al   fci s)sDrr(roou1opt ifeiad mDranmo;u0 rermf3oo1fpDelueolt0 2xmio3oo4lmeemneias s2urxm ;o1altn ociad sDeau pn(0aeerio3oydfmDelivolt s2urxo3ny1apen fetlt arua(mpnt4apen iciyt s2ua(vo;u4 eenmo ia1oaDeaueilt t2xo(r3io1ll  mfetasfa2umurpoo0opto ictldfs rl( snt4tlenxr iytlp  aies t) ruo(mpny4lm n nvi (fsDum(m oo4aet ifctys m rmump;t)texriociadlpDrlnei;t  rxm(m3iydop n feiasfaDrrurp;t0altn feiydls2rmnmo t4aexrxfciytlaDe i i s)trxr(rpnu1omenlfvi t)sDrr(r ot1alxoifcilsls2raumon(0 rtomo oodoat auvol() ruoir iu1lpeelfctatfartmx pnu1aleomieiasfaDrmnms t0texnmocootfpDeaies;s0trxoxo iydamtnlnvsa( a2ra(rp;o0tpenmiciasfs2uaumo;() rxoxo iatfp  lnvi t t2xm(o iy1open fetasf rumxrpnu1aexoiicildfm rlu pnt) eeoxfcoa1oaD  i o (  ruo(mpiu4oltemfctasfa2rr(m ;u4oetoiociasfaDum( ont0 rxrxo3totoa r u i (0s2urxopiudlptemfei tf rur(mooo0tex  ocilt a um(mont)arxoif oydoat li olt)teumxr iydaptnmivs t)srtr(moou0oeenmfctyt aDumu on(4arenxf oytoa rai o;t0trurimpnodope livtlt) rtau p;o1apxomoeildlaDeau o;()arxrxocoatlateln olt) exoirpnudlm elncta(fsrtrxronu1apenmoeild aDumn pnu0alxomf ty1oa   uvs t0s2xmxm3io1lmenlfetas) 2ua(r nt0opxo i3ild a ul(mpn()arxriocia1lm  lneols  rum(rpio1ll nmnet t)s2tax o;t0teeniieils aDul( s t)artnifciatfm  auei;t0t2umio3io1lmenmfci tfsDuau  ot1aexo oetadfa2em(vo u)texnxocoodlpt liei t  etrxopno4amtnlfvil(  Duaumoou4aeen f3iydlm rm( s t4 ltnir3ty1lateanvo s) rxoir3nu4am  mncsls  2taxm ;u4olt  iciyd m2umumont)texniociodfpt anvo t)srtm(opoy4omenmies t) Drrxrpoo0tpxoiociatfmDrm( o u0tetrmf3tadomt auvs t0truo(m3iu1al n nvslt) 2trump;o0apto o3iys a rluvonu0areoir tadfpDr i ol( tetrxr3iy4amtnmfvsltfsruaumpnu4aexo oeiyt aDulnvs u4 rxrxo3tadfm r neo;t srurxm io1om emictl(fs2umurooo0oee  ietasla elnvs;u) rtnxo oatlaD  neslt)t2uo(opiydapt mnvtat)sDuaxm oo1tptomi3ild aDrlu s t0arenir tydlaDean o s)srxoim oodomen ncil(f Dumxmp;t0tlxoiieild aDum( p t)trtrxo3todfmtr n il(  ruriopoo1omt lict t)aDur(mpnt1tpeoif3tltfa elnvont4 etrmfctodlmDrlnvol( srxmxr3ny4opeemfes () 2raxm ot1aee iiciyt mDrau pnu)arxrxf oadlatr nvi;s t2tr(mpnydol nmietasfarta(mp;u4tetnmfeildla el(mo t4artnio ta1opte ivo t0 ruoim3ny1al elivt sfsDumx  ;t0aeeoiietls sDrlnvo u4 rtnifctodfmDr n o s) 2xo(mpoy1ameelneils sDtmumooo4tle ii3ilsfmDranvonu4trermfciatoate ueols0texoim3iu4apeelnci (faDumu  no4openioctls m umnmont0 eenmo iadlm   i ol()s2uriopiu1amt miesas  2taumont1aexnmf3tysfa2eau s;t4trxrxo ta1fate ues;t) etmxr3io1ale  ncs (  2tm(  ot0oex ii3tydfs2ulumonu)arenio3ootoa  li olt  eumiopoo4ome mfvta( arururpno4opto iciydlm uaumsnu)alxnxf3iotla elneol() 2tr(o3ny1omt mfeta() 2uaumoot4tee  ictldfm2ul(mo t)tltnir3ta1lmD lieil()srxrxr iu4ape mnvs (fsrrmx oot0tlx mo3iasls uluvs;t) rtoif oodlpDelivo;t srxoxo3oy1op   ncsatf 2raxrpnu1olto octadls eau pn(4tetniocootfptr ueolt  exo(r iu1om n fctl( sDuru p;u4tet iieildls2rl(vo;()tleoxf3to1oa  ln s;t0s2um(r io4optemncslsf Drm(  ;u1aptomi3tldfm2uauvo;t4aeerir totfp raueol(0s2urxopnu1omen nvtl( a2tmx  oo0aeto ieild m rmumo t4aetrir totla r nei t0 euoimpiu1llte iei s)a2rmum ot1opx moeildls2ulnvs;(4aetnio3tytopDrlieo;(0t2xoir iy4ale mict t aDrm(r ;t4olx if3iatfs2ulnvo t0 rermfctydfpDe neo;(0 rtoirpnydamenlicsasfsrrax onu4aeto feildlm2uln s;(0aetrxr3ta1la r uvil(0 rxoio nudlme  net s aDraurp;u1tpt  ieiad mDuauvs u0trtoiocoytopt aivolt)trxm(o iu4amenmnctl(f rtaxmp;o1opxnmociyt m rlnvpnt)tltrio oytfmD aivo;s)setm(opny1am e netlt sDrm( p;u0oex ioeiyt s2emump u4aeeoxo3oa1fatr ies (0s2xrxr3iudamtnlfet t) rrmumo;t1tpxo feiasfmDua(mp;t0 rxnxf3tadlm e ueolt s2trxm oydapee fctas sDra( pot0ape mi3taslsDumnvs;t)trenxr oydomDe ueo;s0s2toio no4altnlnei s  rtm(ronu4aexn feiadfa rln s t)trxrif3oodoptr n ilt)trumxm3iu1optnlivtl(fsrrmx  ot4tet moeiadfm2elnmp t4arxnxo iydomD  n s;s0trxmio nu4lmtemivsls sDtmx o;t4tpxo iciys mDrmn o;t4tltrxrctytomt ln s;t trtmirpoy1lltnmfctlsfaDrrxm ;u0oet ifeiltfmDul(mpnu) lenir ia1omDrau i t) 2uoiopio1alenmiei ( s2um(ront1tlt mocild m emn o;(4tlxrmf ta1fa  ln sls  2uo(mpnodapt  nvt (farrmxmp;u1alxomfeiyt a rlums;u4aetrmr3ia1lmtelieo s  eumxr oudal   fvi t)aDraxr oo0oetn fctldfmDulnvo;(0 lxnmrciotoaDeaneo;s)tetrimpnu4lpt  ict s)s2um(  nt4tleoioctatls ulu o;u0tltoxo todlpteli o s0setrxm3oy4lpenmnesls)aDrmxro;o0opx miciyt a2ul( on(4aleniocoatlpD au s t0srxrxm nu4lp nmieiasf rrm(m ;u4olen o3iat a2ulumo u0trenxr3io1latrlivolt0tetmio oy4om n iei (  Dtau  nt1tetn fetlslaDrmumo u)alxoxo oytoptraneo s)s2xo(r3iu1ale lnctatfa2urumoot0alxo o3iysfs2emuvs;t)teeomo3oy1lmteai o;t0srxrimpiy4oltelfvt (fartm( p;u0tpx ioeias m eauvo t0 exoif3iotlpDelnvs;t)trtrxopoudapt lfes tfaDtmx pno0oexnmi3ild a2ulums;(4tlxnirc
\ No newline at end of file
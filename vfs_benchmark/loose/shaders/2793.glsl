@@ -0,0 +1 @@
+neo;t srxoim3oydamt livtltf 2tru  ;u0olen fetys m2rl(ms;u0artoifciadlm  auvslt s2xmxm no4ll  mnvs ()srtmumpou1olx moeilsls umnmo (0 ltnmf3oatfa   uvsl(0 etrim3oudlmenlfci (farrmurp;u1tptomo3tadfm ulnvont4treoxf3oy1fm eaneil(  etmir3nydoltnlnvils)srra(m ;t4tetnii3ildfaDem(mpnt4 rxnxr3ty1oaDeai slt)srxrxopio1op nlnct tfaDtr( pnu0aexomietltfs uanms;(0 lermo tatom eanvslt sexoxr3ny4ameelfcslt s2rm(mpou0apxniociysls2um(ms t) ltrxo iadlat  u o ()s2umxm oydope licsltfa2ua(m ot1ale iietld s rm(mo;(4trxnxf iy1opDr ieo;(0t2xoxm iu4op  mieslsfarurx  ou0tleo ictasfm uau o;t) rtrxrctadfp   ivi s)sexrxr3iu1amt  fcils)srum(r ot0tlxomfctad m el(msnu0aeeomo ty1laDe n ils)seuoimpny1lpt mneta( a2rm(mpno1optn feils aDulnms;t)teerio oytfmDr u ils0 2xr(mpiodlpee ici sf rtaxmpoo1tetn o3iasla2eln o t)arenmr iy1oaDr neo s0s2xrxo3iu4ll  mivi sf Duaum ;o1olt  i3ilslsDrmnvon()aetrxf oatopDraueo;s setr(rpno1alen nvi tf rraurpot4oee ioeilsls el(mon(4tlenmf oadfatrluvi t) eurirpno1om nlivt tfarur(m ;u1tlx  ictatfm ran p ()tetomf3oo1omDeln o;( t2toxopnu1lpte nvs () rrrx  nu1apxoiiciat mDrm(mo t4tetnmo tytlaD lnvo () 2tr(r3oydlptnmfvi ()sDumxmo;u1opto f3iatfs2ul(vo u0altomf iadlm e n o (  2trimpnu4ll nmfvs ()sDrrx  ;t4aet  oetatfmDum( p;() leomr oytla eluvslt trxoxr nudlm e iesa( sDtmu  no0opxn i3iaslm elu o t0 exrmrcoo1op   n o s  rtrim nu4lltnmnci tf Dtr( pnu4oexomfeils a2elnmpn(4trerxf iatlp  anes;t)srxmimpoydom nmncsatfa2ra(rpno1tle moctlsfs2uaump (4trxomf3oadla  aieilt  rto(r no1om nmictatfs2rrx  ot1oet  ietlt aDrl(mo;t4alerir3ootla rlnvi s srurxopiy4omen ict ()srrmxront1oltn feiydfa rmnvont0altrxf iodlmD lnes;( srxo(o3oudap n fctlt)aDtrx  ;u0tex ifciyd s2em(mo;t0alxrio3oy1opDrlnvol(0 ruo(mpno4al emnet tfa2urxmp;u1opxnmieiat s2el(msn(4arerxr3iy1lat lnvsls0s2tm(r3iy4lmte ivias) rrrxrpno0aetniociydlm2rmuvo;t)tlenifctydla e nvolt)t2um(rpny1ole lnvsas)sDumx oot1tpxn feildlm2rauvs;t4teeomrcoadfptelu o s0texmirpou4lmeelivi (fsrua(rp;u0teeo oeilsla ua(mo (0aeeniocoydlm eai il()texmiopnu1al  lneta() Dtmx ono4alen ietadls2ulu o;(4trtoxrcoydfpt  i o (  exmio3iudamen nvtlsf 2umumpnt4teeomieias sDeln p;(0arxoxrcto1oaDe ivs ()s2xr(o oy1optn ncil(  2ra(m ;u0apx  ociys mDranvo;(4aexrio tadfpte ivi;( texmxr3iu4lltemfcia()a2tax pot4tpe  f3iadfaDul(vo;(0 etomf3iodfm  aues s0seumim iy1altemfes t a2rrxmpoo0tet mfctldlm2rmnvp;(4teeoirctotfpD ln o;t)trtr(m oydom n nes t) 2tmxr oo0tlx if3iatfsDea(mo;()tlxoir oy1oatelu s ()teurxm iu1apt miei s) 2umumont0alenmfeildfa eln o t4 leoio iodfate nvolt0 etr(m3no4ole  fci (fs2raumpoo1olenii3iys aDuaumo t4 lxoxoctotfpD aiei s)s2xr(o3ny1opeelnci s srua(ro;u4oee ioctldfaDea(ms u)aeenmo3totfpDeai ilt)tetr(m iydlptnmfeslt srraur oo0aleoifciyt a2uaumont4teerxr tydlmteanvil( srumxr oo4ope mfvt t)sDumumpou4oeeo iciat aDumu pnu0trxnio iotlpDelueilt) 2umxmpou4apeemics ( arrr( oou4alenifeiydla emnms u0 eerxr to1fp   neils) rxmio no1oltnmnct ( srtmx o;o4opx  f3iasfmDum(mp ()tltrmo ty1optr ueo t  euoxo3no4amenlnvsl(fsrtmu oou1tltomo3iydla ulnvp u4tetrxr ia1lp e ivsl()s2um(m oudoltnlfvs t)aDrmxrpnt4opxomi3iatfsDrmumpnu4tltnxf oydoat  ivsl(0sexm(m3iudlmtn fet (fsrtr(mono1ope ifciasfa ul( onu)tetnxf oydop  lues;() etoxo iudolt lfctl()aDur(  ou4olto iciaslm el(ms;()tetoirctodomD  n s t) rxr(r3oudal  mies s)arrrurpnu0ape  i3iys a elnvo (0alxnifcoadoa r i i s0 2uoiopoo1ll nlnvtas)sruaurp;o0oexn f3tysfa eluvon()teeoxf oatfa  ai o (0t2to(r io4lp elfcsls srtmu  no0tlxoio3iyt aDem(vsn(4tlxomrciy1la e n s;t0s2xrxr iy4lmee fei s)sDtru p;u1oexoiicils sDrmu on()artoif3iadfatrluvi ()s2urim3iydope mfvtltf ruaxmo;o0oex  f3iydlsDel(vo t4 rtoio ty1lmteai s s) etoir oodlltn nvt ()a2ra(  nu0tex mf3iltla2el(mp u0 leomf3iotlm rlivo;s0 euoirpnodlptemict tf Duax  ou1tltnmfeiasfmDuan s;t4artoiocoydlm rlivi (0srtriopnydlleemfcils  Duax  oo0oetnmoetas aDem(vo (0 rxoxo3totfa e u il(0teto(o3oydlltn fcil(fsrtm(rp;u0ape  fciatfm el(mo;t4alxoio ia1laDeau o;s  2to(m iudll emicsat)arrmu  oo0olxn oeiat s2rl(ms ()trtrif3iodlpt  ivs;()srxm(m ny1olt  ivilsf rua(roou0opt  f3taslsDrlnmpnu)tlxoxf ty1lptrauvo t) 2to(r3iu1apee ncsat  Duaurpot0apxn ociysfa2ulums (0tlxnifciotfm e uvo (0 rurir3iu4apt mneiltfs2trumo;o0openii3ilsla2el( pnt4 lxrxociydlateai olt tetm(m iy1amtnliei (farrau  ;t4alxnmictysfm rmuvs () rxomo3iadom raueo ( sexrir3ou1om  lfvi sfa2tmum no0tpto i3ild s eanvs t)trtoir3iy1oaDe n o ()sexo(rpiy4ap e fct sf rum(m nu4tltomfetatla2eaump;t4aleoxo3tadoptelneilt  eurxm nodomtnmnei () rurx pot4alx  ieiadla2em( o;u4aexnif ia1om eaneo s)trxr(m oudol nlnes tfarra(mp;t4oeeomi3tltfsDemuvon(0tetnir tadlptr ieol( texrio3iy1amtemncsat)aDrrxmo;u1aee  f3iys sDel(vo;t0 rermrcoytlaDeluvols0truoxm3oy1llee fcs ( arta(mo;u4texo ociltla rl(vo t0trenmf3oatom eai ilt0 rumxr3oy4lm n ncil(farrm(mo;o1altnifctlslsDrl(ms;t4 rtoio3ty1la raivs;s) 2uoir3io1oleelivtlsfsDta(r oo1aee  fetlt s eln s;t0 etrir3oadlm   ivs t  rxm(r3iudapen feil( s2rmxmont0tpx iietatfsDumu snt0 lxoxo3iatfm r u sls0texoim3io1apt  fviasf rrmx pnu4tltoio3iatlaDul( p u0tlxomr3oa1oatraivilt srxmim3oydlltemieiltfsDum( pno4alxnmfcildfm um(vs;()trtoxo oatfmtelueo (0srtrxr3io1altelncsat sDurxrpot4tltnmo3ildfm ua(vs;(4texrxo oadfmDe ivs;( texmim3ny1omenmnvils a2truront0olxniiciatla2ran o (4tltnmocto1lptrluei;( trurxm3oy1aptnmfvs t)artaur ;t4tlx ii3iat sDumump (4 etoio3tydlm rlnvol() rumxmpny4ol emnci sfa2rax o;u4ale io3ilslmDrmn p;()trtrif oadlat auei s s2xr(r io1aptn nviltf Duauro;u1tpxn fetatlm2ul( pn() ltnmo iatoptraneols)seum(m io1ol e fvt s)aDurxro;t4teeoifcils a ran onu) reoio3tatlm elieo;(0texoiopiu1omte iei t a2ua( ooo4altnmoeils s ulu p (4 exnxr3tytfpt anes;t) 2xrim3ny1lpenlnvslt)a2rax p;u1tpxoifetydfsDrl(vs t0alxoir tadfmtranvs;( teum(mpoydomt lncs () Draurp;o0tlt  ieiatfs2ra(vpnu0 etrio3oytfat auvo;(0 rxmimpny4ameemnct s)aDrmxr ;t0tlt  octysfa rmnvont) eeoxr3iatlmtr ues;s) etrio3iu1om elfvil() Drmx  oo0olx if3tlsfaDul(ms t4 etnif3tatop ran s;( trxr(m3nodame livi ()aDta(ro;u0aex mociatls ra(vonu4artrxf iytoateluesls0srto(o3nodal n ieslt)sruaxront0tptoif3iadla rl(ms t0 ltoio3oy1laDraues s trur(opoy4omenmfvt ( aDumump;t1oetn o3ils s2uanmpn()tlxnmr3oadom elnes;(0trum(rpnudop nmivils) 2tau pot1opx ifeils aDrauvo;u4artnmrciodomDr i o s0t2xoxr nydopee fet t  Dtaumo;u1alt moetysls2emuvs u)teenmf3iy1la rli i ( s2tr(o3nudlpen nctlt)a2tax  nt4oeto o3tytfs eln s;u4tetnxf iotlate nes (  etoxm3ny4amtelfcsasfa2trumont4oetnmfeiydlm2uauvs;t)arxomr iotlpte i s;t)trum(opiy1lmeemfcsas  2urxmo;t1oltn fciyt aDrl( o;t4artnxrcto1oa  aieo s sruo(o ou1lm nlfvsa()aDra(mpno0ole mo3tad mDulnmonu4aetoifcty1lp  livi;s0 etoir3ny1lmtemiei (  rraxm no1ale  octad sDum( s;u) lermrciodoaDe nvi;(0 2umxr3nudlltn nvs t a2tau pno1oee  f3tlsfs rmu p;t) ltrircoy1om rlueslt)teuoio no1al e fvsl(  Drm(m ;t4tex  fciad mDulnmo t)arermr oa1la e iei;(0 rto(r oy1omt  fcsl() Drmxmpnu0tpt  ictydla emu snt)arxoxociytlmtelivi;t sexoxo3ou1omen nesls)arrmur nu1tlx mfeiat m2ea(ms;()aleoxr3ta1lpD ai s;(0 rxriopoy1ape lfvta(fsDtrum nt0oex  ieias m2ran snu4 etnircootoaDeaies;s)srtoxrpoodal  lfesa() Drr(m ou0aeeoif3iyslmDuau p u0trtrif3oatop rluvi;t)sexr(r oo1om  mnvsasfsDrr(rp;u1oexniiciysfm em(mo (4 ltnircia1lp r u ols) exm(opou1alt mnciatfsrtru  oo1aetomocild sDrluvo;t4trxoxo iotfaDr ieol(0s2ur(o ou4aleemivt t)arrm(mpou4apx ifeild s emnmp u0 etnxo iydlp e n ol( texoxo3nu4lmt  icils)srtmx  nu0altomieiasla2rl( s;u4trxomoctodfptran i t)srto(mpoy1omtnlncias) rtax ont4tlxo f3iysla2um( s t4alxnmo3oydlpt ai olt0trumxo nu1lpen ivtas srua(mo;u4oetoiieiat sDuauvs;t)trxnif tadlaD auvils)t2xmxo iudap emicsa(  rtaump;t0apt mociatfm rauvs (4teeomf3oa1fpDr i o t tetoxm3nu1omeelivs sf 2raumoou4tle iociadlm ranmo t4 lxnmf3iydoptr n olt0 2tmim nydlltnmivsasf 2tm(rpnt1apenio3iaslm elnvp;(0aeeomr oatlatr nes t)srum(m oy4lmen iei s)arta(r oo4openmf3ilslsDrmuvpnt4 etnmf3tatfate uvolt trxmio ny1al emictat arumu oou4aex  oetysla emuvs (0 rtoioctadfatranei;t srurxo io1al nmfvsas  Dtr(  ;t1tlxoiietasfaDrlumont4aeerxocta1omtrlnvilt) rto(m3io4amtnmivsltfarraxmonu0tetoiieiyslsDeanmpn()aetoxo ootlpte uvs;s)s2urim nu1olee fcsa(fsDtm(mo;u0aex ioeiytls2ua(ms;(4alenxr oydopt aivilt)setr(mpny1ol   fvsas)s2rr(rp;t4tpx  o3iat sDra(vpnt0 rxrir oatlat lies;s0s2umxm iu4apte ivsls)a2tr(r no0tetoiietyd s2um(vpn() rxnxf3tatlm eanvo t0tetrir3iydom  mnct t)sDuru  no1optoioeiatfa elnvp u0aeerxf oydoa r uei;s0t2tr(r oo1llen fesls)srumxrooo1aee  f3tasfsDulu s (0 rtomr3ia1fat an ils0s2tm(o3no1lleemivilt)s2rrx ooo4tltoifetat m2rmums (0trtomo tytom  li olt trxoio oy4omtelnctl()aDrrum ou0tlxomiciadlsDrluvo;u0tlermocoytom elu i;t0s2ur(r iu4ap nmfcs (  rrrx poo1tle mi3iltfm rauvon(4alenxr iydfp eaneol() 2trir no4oleemicsl( arrmu oou0tpxn ieilt s elnmp u0alxoxr3iydfp eai s;s) exr(o iudome lfvsltfsDuaxro;o4apxo fetldfs2rm(mo t0 etoxf io1la r u s (0t2umio iydol n fvs sfsrta(rpnt0tlto fctltlsDelump;t0trxrxf todomtr uei s t2xoxmpiu1al  mfvt sf 2ua(m nt4apx  ietys m rlnvp;t) eeniocoodoaDrlneolt  exoxmpoo4op  lnctas)aDtru pou0aeeo fctls aDranms;u4teermo3ia1omDeanvi;t)t2xr(m ny4oltnmneiat srrr(rpoo4opxomoeiys s emu s t4 rtrir3oadoa rauei s srumir3oodlme miviasfa2taurp;u1opt  ictlsfm2ean snt0tltomo3todopt auvs t)trtrim oy1lp   fesa()aDrrxrpoo4aeto fcilsfaDemnvsnu)teeomo iadlpDeln s;(  rur(r ou1op   nci t)aDtrumpno0tlenioeildls rlnvs;()trxnxf oadla  livil(0 2umxo3iudale  nvs (f ruau pno1optomi3tas aDrl(vp;()tltnio totfmD  nesl() 2uoio oudol nmfcilsfaDrr(mp;u4aeen iciatlmDumnvsn(4trxnxf tytomtran i;t0seumim no1llte fet (f 2uaxm oo1apen fctld m rmnmp t) etnmo3oo1opte neils s2umirpiu4lleelfci t) Duaxrp;u1oex  f3iadfa raums;(0 rtnxrciodomDr uvo ()sexm(o oodapenmfcia()a2taurpnu0aex ioctadla2ulums;(0alxrircoodlp  luesls) exr(r oy1llee fvs sfa2umu ooo1tex moeiadfs em( sn(0trtomo3oo1op ean o;( texrxm3oo1llt lnvt tfsDta(r ot4aee  oetatfmDrmuvpnu)tlerxrctotfat lneols0trxm(rpnudal n fctat)aDtrurpou0tle mf3iltlaDea( pnt)tetnmr3todlatrlivo t)s2tmxm oodape mfvtlt) Drmu o;u1olx mfciydlm2rluvo;u)teeoio3oydoa eanvo;t s2xm(o3iy4alenlfct t  Dtm(r ou1oet ifciyslaDem( on(0tetrmo3iodoat lues t)srurim ou1ll nlfvsat)aDrrurp;t1ape mieiasfm2uan s;(4tetrmr3iytfa r uvil( sexmir iy1llt  nvtl() Dtmurp;t1tpt  f3ildfsDrln s;()aetrxr oytomD livi (0t2tm(m3nodoleemncta(  rum(m ot0ole mfeilt aDemn o t)tlenmo3tydlpDean s;s)s2tm(rpny1al emieiatfaDtr(ronu1oex mfciat a2umuvont0 eeoxr3oo1omDraieo;(0 eum(r3ou4apt mnvs t) rrm(mpno1tpxnifciad s ul( p t4trxrmf3tydfm ean il()s2xrim oy4omt lnesasfa2trxmooo1tptomo3tasfmDemnmpnu0trxnif3iotlmt  uvi s0sexoxm nydlptelfesas  rua(mpnt4tptomfetyt m2eluvp;(0alxomocoytom   ueilt s2xm(mpiu1lltn fcia()s2ua(m oo1teenio3iydfm raumpnu0treoio iatfpDe neils  rtrir3iy1lpe  ietlt  2tr( oot0tlxnmfetat sDua(vs u) ltrxo3oa1fatr ueo t texrio3nodll elfcias aDta(m nu4aleo iciyt m em( s (0trtrxociytfpDeln i;(0teur(o oy1lpenlnesl()a2uaur nt1aetoii3iadfs2umuvonu)alerir3totfp eli s t)tetmxr3iu1olt mncs t arta(mo;o1oltn f3iytls2ra(mont4arenmrcoydlatrlivs;() exrir3nu1om emicilt  Duaxroou1altomiciatfm2ran o (4aetoxo ootfmt  ueo;( tetrir oo1am eliet (  Dtrumpnu0oexoifciytls ulnvo t) lxrxocto1lmDraiei ()trxr(mpiy1alenmiesl(f 2tm(r ot0alx mieiat m2umuvp t4alermo3oadfpDelnvol(  rxr(r3iu4amenlfctl() Dumx pno1tleoifctysfmDrluvs t)alenmr oatopDraneol(0tetoiopiydaptnlfvtlsfsDra( p;o1tetn f3iydfaDrlnvs;t0 leomrctadlaDr ivi;s0 2uoim iy4ll  mnci (f rrmxmont0olt  i3iysfs uluvont4 rxnir tadfa rln s;() rxoir3iu4omtnmfci ( aDrrx ooo0apt  i3iatfmDemump u)aeeomf3iodlm r nes t t2tr(o3oo1alen ietas)sDta(  ;u1apeo fctysfmDrlnvs u)alxrio ia1fmtr u olt0sruoxo nu4ll  lies t)aruax  no0tpenif3iatlm2rlnvp u0 eenxocoodlpteanvi t0 2xrxo3ny4ope licsl() Dum(m ;u1alxo ietls a ua(ms u0 renmfciy1lptrlneilt0teum(m3no1omeelfcs t) Dtaxrpnt4tleoifeiad a rmumo t) lxoif3iytom  au o;()teuriopiy4lm elnvsl(f 2tr( o;t0altomi3tatfm uln o;t0 rxnmr ty1oa e u o ()s2tr(o3iodlp  mncta() Draxr ;t1teenmfetldlmDuauvo t)aeeoxf3iy1la rli i;t0 rxmim3oydop e fcslsfsrtmu o;t4oeto ictysls umn s;u0trermociodomtelu i;(0srxoir3iodomt livi t)s2tr(r nt0olt  ocias m uaump t0tltnmoctotomteli sl() rtr(m3iy1olt  fei tfsDumxro;o1tpxomf3tls m uanvsnt4 eenmo3tytopt an s s t2xm(m3ou4apt lnci (faDtmx ono4opxomoeild a2emnvp u4arerxr iadla r nvsl(0t2trir3nodop  lfviltfartr(r ot0apxnifeiadlaDemnmo;(0 ltrif iodfaDraneols  rxoxopnu1amt liei (f Dtm(moot4tptnmo3ils mDra(vsnt4texoxo iytfpte uvi ( seur(opoy1am n fesls)srua( o;o4aet mo3iadfaDemumo;u) lxoxf oo1lmDrauei t)s2urir oydom nlies sf Dtm(rpno0aetnmoeilt a2umn p u4texomf3oadlmDelneo (0s2xoxmpoy1am  livslt)sDraxmonu4ape ii3iltfa elnvs;t0arxrif oadom ran s (0t2xr(r iydlm emfvilt)arra(rp;u0ale  ociltls2rmn p u) rtrio iydomte nes s0s2umxopnodap   iesa(f Duaumpou4tlxniiciyd a ean onu) exrif3oydfaD lieilt s2xmir iu1am  lnvi s) 2tm(rpnu1oleoifctatlm2umuvp;(0aexoir3iadfaDrli s;(  ruo(opny1lme lfvilsfa2umxmpnt1oleo fcilslsDuln on(0 ltoxfcoodfmteauvo;(0sexoirpoodoptemicsl(faDurxmp;o1opx ioetatlsDean s (0alenmo ia1omte u sls) etrxrpio4lme lfciltfsDua(mp;u4apxnmi3iytfmDra(msnt4arxrxrcoydla eanei;(  rxrxr oy4lp e fvsasfs2ra(mpnu1tleoii3tydlsDua(vs;(4tlerio ia1lmteln s (0sruriopoudlpe lnviltfsDtm( pnu4oeeniocild a2um(vpn(0tltrir3todfptr uei s seuoxr3iu1lmeemfvi t srtru  ;u4tptnmi3taslmDrlumonu)teeoiociadlpte nes;t0 2to(r nydomtn nct () rrrum nt1tet  ociytla2rl( p t0 rxnmo3oo1latran o t s2uoio ny4lpenlfcs (fa2rrur ou1altnmietysfsDuau onu)tetrxo tytfpDrai ils)srtr(opio4alenlfvsasfsDrauroot1aptnmo3tyd s2emnmp;t4 leomfcty1fmD lu i;t)srtm(m3ou1op elfesa(f Dtaxrpot4olxniiciysfmDel( s;u0 lerifcoytlptelueolt) 2uoim3no1lp n fesatf Dtaum ou1olen f3iaslsDeau onu4tleomr todomD aivslt s2to(opiydlmeelnct ( aDur(mp;u1aeeoiociydfm2uln o;(0alermf3ia1optr nvi t t2xoxm ou1lmeeliet t  2tru  ;u0aee mfcilt aDumu snt0arxnif3totlaD aneo ( s2toir3oodlmtn feiat)a2tr( o;t0tpx mfetls aDuanvo;(0altrmo tatlmtrluvolt  rtoim3iy1ap  liesa(faDumu oou0aet ii3iydfsDel(vo;u4aexnio oodlpDeai ils  2xmxrpoy4lpt lfcs (fsrta(mpou0olen feiadls rmnmp;u) etrio3tadlat lueils setm(o3ou4oleelfcta()sDtr( o;t0olx ioetlslsDem( p (4 etrxfctodlaD ln slt0s2umxm3io4ape lfeilt)srtrum oo1teenmf3iatfs elnvs u4 lxoxr iydlp  liei;(0s2to(o3ny4lle lfetl(f rrrx  nu1alxn fetat sDrl(mo;()texnio3tydla rau ilt0s2uo(mpny1lmen nvsa(f 2ua(mpnu1tpenioeias s elnvpn(0tetoiocoa1fa   ivo t  rxrir3oy4om nlncil()s2tr(mpou1opto feiysfm2em(vont0alxrio3to1lm r ivo;(  exmxr nydlp  mfvs s srtm( p;o1oltnif3tlsfmDumnvs (4aetrir3ootfpt auvs s0tetmim3iy4ll  lnvias)sDumxrooo1apeoiietyd a eanvont4aetoircoodfmtr ivi;(0t2xrirpoudlpeeliesasf Dumxrpnu4texomfciad mDel( p u0altrif3iadopte n s;s0 2to(o nodome licil( s2ra(mpnt1teen ocildls ea(vsnt0 lxomrcootomDelnes;t0srum(opoy1lleelfes s) 2tr( pot4opx  ictytfs ranmo t0tetoir oatfmt ln i t t2xr(r iy4op n nvs t arururpnu1tpxo ictatfa2rmn pnu0 exoif totlpD luvslt  2tm(r3oo4apen ics s)a2ra(roou4ope mi3iydfsDem(vsn(0aexrmo oytla   ivils0 2uo(rpiu4om  lfesl() rra(mono1tlenmietys s rlump;t4aeerxo3oytfatrlnvs s)t2tr(m iudop nlivta(fs2rr(monu0tetn octatlm2eln s u)alxrxr3tytlaDr ueslt  2tmxopiudolenmicsa(  2rau pnu4tle iieiasfm2ra(mo;t4 lerxf totlpteau o (  rxrxmpoy4llte ncsas) rrrx p;o0olxnmf3tldfa2em(vo u4 rerif ty1laD aueslt)seuo(rpiudaleelfvs s)s2ra( oou4tlt  i3iltfs ulu p t0alerir oo1om raivolt0trxmxm3nydaptemfviltfs2tm( onu1alenii3iydlm ul(vpnt4aetomo ia1op  liei s)t2umim3ny1lptelncsasfsDtmurpou4tptn oeild a2ea(vs t) exrio3oodfmtr ivsl()setoiopoo1ol n fvtat  Drrumoot4olxn o3ias mDrm(mo () ltnxr3ta1optrln o t0 2xmxo3nydlmeemnvtat) 2uax  ;u4apxo octyslm2rl(ms;t)teeoxrctytfmDrauvsls0t2umxr3oodamenlnvtlt  Dumur nu0olxn iciltfsDrlumsnt4 ltomrcto1opteaueo;t seum(rpoy4ol  lfcs (fs2rrxr ;u4oleomfciytla rm( on()alenmf3iodoa eluvi;t  eum(mpnu4ape lfvils)a2rrumoot4aex mocilsfs ea(vpnu4 rtoxf3iodoptrlnvi (0 2urxr nodameemiesa( s2trxr ou1aleniieiasfs ua(vo;u0aeeoxr oydoptraueo;() 2uoir3oo1lmen fctltf 2raxr nt1olen iciatfa2ean o u) exoir tydfa rlnei s t2to(r3no1lm elncias)s2tax pot1teen feild s rluvs ()areomrcoytfp rau s;t0 2xm(m iy1olee fciatfsDuaum ou1alx mf3iydfs2emumo (4 lermr3tydfatrluvs t0sexm(mpoy4omt livslt aruaxront4tlxo feilslm2ra( s;t)artoioctydopDe nes s0trurir3iodolen fesltf Durumpnu1tlt mfeilsfa2um( o u4tetoxociy1faD lu o;s0t2xrim ou1lme lnvs sf Draur ;o4tlxomo3taslsDem(vo ()tlenxo3tytlatraivi;( texo(r3oudlm e fviltfaDuaurp;o0oleniieilt s2rau s;()aeeoxocoo1lmt li ilt sruoxm3iu1al  lfvil() Drau pno1tleo fetltfm2ul(mp;u4 rtrxrciadop e ues;s0 2xrimpno4al emicsls s2rm(m no0tetomf3ilslsDrl(vs t0artoirctydlpD aieols)trtr(m3nudapenmnvt ()sDrrxmont1texomfcildfaDuauvs;u4aexrxr3iatfate iei;t0 exmxr3iu4amt livil(fa2raum nt4apxn ieiatfa2ua( on(4aetrirciy1optraieo s t2uoxo nu4am e fvt sfs2rrxm no1aeeoioctysla rmnmsn(4texrmociodomDe ivi s)trxrxm ny4lpte ietls) rrrum ;t4tpeoioctydla emn p ()aleoir3iadomDelies s0teuo(o3ou1lmtnlicta(f Dumx o;t1apen octadlaDuau ont4aexnxo tydlpDeauvi s0srxr(opiydape mfci t) 2rr(  ;t4opxomociydls ea( ont)alermfciotopt an s t0s2urim iydlptn neiat) 2tmx oou0tpxnmi3ildfs2rmu onu)tltrmrciodfaDeluvols texrim oy1optn ncta( s2rrum ;u0oee mf3tatls2uanmsn(0 rtoifcia1lmDeanvi;()srto(rpoy4ale  ieta()sDuaxrpou4optnmoctltfs2rlump;(0aleoxocta1fmDeaiei t  rxmxo io4omtn ncias aDrrump;u4opxomietasfmDul(vo u)aleniociytlmDeln o s tetm(o3io4omte iei t sDur(mo;o0oetnioeildfs rlnvs;u)tetomocoo1la rln s ( truoxr iudopte ivt t)srrruroot0tpt mf3iltla2rl( p;()texnmr oo1fm rai o t0sexoxm3no4op e fvs t)aDraxm nu0tee ifetadfs2rm( snt0aexnif oa1faDeln il(  etoim3iy1apte feil(faDtaxr oo1aetoiieilsfs2ulu o t0 eerxfcia1lat aieslt srumxo3oodamt miet (fs2tm(roou4aex  i3ils a em(ms t4altnxr3iytlat  u i s0t2toxopoy1opee nvsls arrru poo4tlxn i3ild a2ulums t) rxrxoctadfaD  uei (0t2trir oo1ope livilt)sDur(mono1tltoifeiytfm uaums t4tlerxo iotomteaues;s t2xmim3iy4al nlncias aDumur ot1ole  i3ilt s2rauvpn(4alxoif3totla r n o;()sexoir3oy1ome liesat)s2tmurpno4aee moeiatlmDulu pn(4trtrxr3iydomtean s;t0 ruo(rpoodllt mfci s arum(m oo1alx mfeild m2ranmon(0trerxo tytfmtelues;t t2um(o nu4lptnmncia(  2umur oo1tlt  ietls s2ul( o;(0aetoxrcoodlmte nes ()tetm(r3iydlleemnci sfsrum(rpnt0apto oeiltlmDulnms;t)alxrxfciotom r nes ( t2toxm oydlp  lfes s  2ta( poo1oexo feildls emnvp;u0alenmr ootoatrluvil(0 etmir3iudalt  fetatfsDta( pot0olxoioeild m rl(mp;() renxo tydop elies;s t2trimpiu4ol n nvtls)s2urxrpnt0texomiciasla2eauvs (4tetomfciotlaDraues t trxrxm io4am  mfcsa(faDraur nu4optnioetltfm2rl( o ()teeniocoytlaD livo s setmxo3oudaltnlnvt (fsrtruront1tpx mi3iysls2ulnmo;t0tlenmfcoatlm   ivolt0trurxm iodope mneias)aDtru poo1oet ioeiytfs uanvp () rxrio3tatomDelnvslt) rtrxo iy4optnlnesltfa2ua( pnt0opt ifctysfmDeln p t0alxnmr tydfpDe ieo t  rurxo3no1apte ivsat aDraxmpou0aee moctydfs el(mo t)tlenir oatlmt auvs s0 rtmio3ny1openliciatfsrua(m ;t4tlt mf3iys mDumumonu)aetoxf tytfmDr uvslt0s2uoxm3oy1omtelfesas  2trx onu4tetnmoctlsfm2emums u4 etnif3todoa   uei;(  etrxm nodoptnmfvilsfsrtmuro;t4aleo ociytla rluvp ()trenif3ia1fpDr u o ()trtoxr oy1oltnmicslt)sDuaurpnt0alt  feildfs2ra(ms;t) rtrmociadfmD lneils srtmxr3nu4ll nlfesasfaDtr(mpoo0aptnif3tltfaDua( pnt0 lxoif tadlptelneolt)texoim3ou4llt lfetasf rur( pnt0oexn feiydfs em(vo;t)alenxrcoatomDr ivi;(0 etmir3oy4ol  lnci ()sDtrxmono0tle mfctas m2ranmp u4tetnxf3ootoaDeluesls0 rxoxmpoo4ale liciat) 2trum ;u0tlto feiad aDea(ms ()aetoxf tydlptrau slt0seumir nodlpte ivt ( arrr(m ou0apeniiciasfm2em(vpn()arenircoytomtrlieo;s0tetrim3nodlmt  nct sfsDrmurpnt1aleomiciydfsDem(von(4texrio3oadfmDe i sls)t2xoxr3nodlm nlnet s)artaxm ;t4altnif3ildla2rmuvo;(0arenxfciydomDrlueil( trxmir3nudap e ies s aDururpou4oex ioeias mDrl(vpnt)teenir3ootom rluvs t)texo(r iy1ome mietas sDtm(rp;o0opx mo3tat sDea(vs;u4aeeomf oytomD  ueo ( srtrxo ou4olt mivslt arrrxm nt4aeeomf3tys a umu p;u) eenmrcta1lptr u s s)teumxo ou1oleemiei () 2trxmooo4alxniocias aDumumsnu0trtrircootomtrlues;t0sexoio oy4llte nctatf rtaxr no4altoii3tytfm el( s;t)altnio3iytfm r nvi t)t2tm(m3oy1lpte iet ( arumur ;o0ape ii3iatfa2ua( p;t4 eerio tadlmtrai i;(0srxoio3nu1oltnmnvta() Drm(m ;o1oeenio3iltfa eanvp;u0aleomfcta1fp  aivs;s  eto(m nodamt mfes t arumx pnu4aptn feiadfm2el(vs;t)arxoif iytopDeliei;s0srtmimpoo1omt mictltfs2uaur ;o0apen iciadfm ul(vo;t4tltnmf todlm rluei;( t2tr(m3nu4optemfvs s)srrmur ou1tee if3tat s2elnmon(4aetrio3oy1lpDrai s s tetoim iy4ap elfciasfa2rrxmp;o4opxn oetydfa2rmuvp;()arxrxo3iatopDelivs;(0 euo(r3oy1ame liet sfsrrr(  ou4olx  i3iaslaDrluvsnu4artomoctydfm  an o ( seurio3iu1ame licsls  rurur ;t4tpxo ocilsfs2uaums;t4 rtnxr3iotopDeluei t  2ur(m nu4lltelies (f 2ra(m ou1texnmieiydlsDeauvp;() rxoxo todlm elu o ( t2xmir3no1op   nes t) 2umxr ;t4tpx  f3iaslsDra( p (0tltomo3totlmtr u i;t0t2triopiydapen nes t  2raxrp;o0tpxn ieiltlaDrm( on() rtrmr3iatfp raneilt0 rtmim iudom e fcilt a2raxrpnu4tlt  oeild s2rauvsnt4 eeomfcoodfp  aues s srxrirpou1lleelnvias  Drrurpot1olx  f3ild mDumump t4trtrio iadom ean o;s0t2xrim3nydope mneia()a2rmu  nt4tex  fctydlm2uanvsnu0arxoio3oadlm   nvo;t trtrxr ou1am emicsl(fsDum(ronu1tee mictydfaDelnvo t4 exnxf3oytlaDeanvs s)texoir3nu4al nmnvt s)sDrr(rono0aex moeiytfa em(mp;u0tlxnircty1fa  ai o ( sexrio oydlmen fviasfs2uru  ot1oee  ocilsfmDraumsnt4areoioctodlmtr nes;s)srtmxo3nodolt micsat)arua(ronu1aexoio3tldfmDrmnvonu4 eenxocootla  ai ols t2xo(mpoy4lpt mfvils  Dur(ro;o0oee  ictydla2rmumo t0 eeoxo3oadfpDr nes;s srurim3ny1apt mies s) Dta(ro;u0oetnii3iat a2uan p;t4aleoircty1fmD ln o;t)s2triopnu4op   ncias arra( o;u0ope  fciadfsDel( on(0arenxrciotla eanvs s0seuoxr ny4altn iesa( a2tax oou0oetomoeias sDumnms;u4 etrmo3oydfmt  ues t) 2trxo3iudal   nes t  Dum(ronu0aeeomfeiatfs el(msnu4 ltrxo oadfaDrln ils0teur(r iy4lpe lfei t  Dtmur nt1opeoifciatfa2uluvs;t)tetnmfctytoa r n slt)seumio iy4lm emfesat srtm(r ;o1olt mfetad m ra(mp;u4 ltrir oy1op eli i;s0 rxr(o oy1lmeemieiatfa2tm( oou4oet  o3ildfsDranms;t4aeeomrctadlptran i;s  2tm(m ou4lm elfcta() 2ra(  ;u1opxnmieilsls umnvs t0tetoxr oatomtrlivilt0trxr(r ou1amte feiasf Drr(  nt4aetoifctyt mDeln s;t)tleoxrctodfpt auei;s) eto(o ou1lm  mfcsa()arrr(m ;o0tetn i3iat m2ra( o t0tltrifctodomtrlivi (0 exriopiydomeelivt (f Dtmxr ot0apx ifciydfa2umuvp (4trtrxf totlp e ueil()trtrxrpnodoptemnviat arta(rp;t1texo i3iydfm raums;u4 rxrif3ta1lmD lneo;t)t2umxr3no4oleeliei t s2raur ou4tlenmfctasls2uanms u0 rermocoo1omD  u olt) etrimpny4altemivs t)srum(moot1opeoii3iatfs2ra(mp;u4artomoctytlm rlneil() 2toxo oodapeemnesat)srra( ont4tetnii3iys m2rm(vsn(4trtomr3ia1omD livo t)trtoimpiudalt mfct t  rtrumo;t1oeeoiieiltfsDem( s;t4aetnmrctydfa  anvils)teurxr oo1lmtn nvsl( arur(ronu0tee ii3ildfa2uanvon(4texoxo3oa1oat livo;()s2xr(opio1ope livs tf 2rrx pnt4texo ociyslm em(vs;u) etrxocootlp ranvs t0 2umxm3nu4alenlieiat) Dua(m ot1oltn f3ildlm2umumon(4tetnxf ty1lp r nvol()trtmxmpio4op  mfctls)arrm(mooo4ope mociatfs2um(vsn(4 eeoircoadom e ivo t0 rum(o3oydlm elivi (  Dtrurpno4aleo octldfmDulnvp u)tleomo3iadlmDe u o;s  2xmio3ou4ape lfesls)s2rau o;u0oee  fetltfsDra(vs u4arenxf3oa1fa elues;s  rurxo3iu1lmteliesltfsDrm(rpoo4opto feiltfaDumu o (0alenircoo1oat lu i;s)t2tmxr3iodap  lici t s2um( p;u1tlenmicias m2umnms;(0 eermf3ty1fm rai s (0tetrxm3nu4amtelietls aDrr(mo;o4apxnmfeiytlsDrm(vo;t)arerio3todfm eai s;t) 2to(mpoudamtnmfei () 2tm(m nt1tpx  ieilt a2eau o u0teerxf3oo1lp rlieolt t2tmir oy1alenliciatf Dtm(rpno1tpx  ociadls2ra(mo;t)alxrmfctadlaDr ueo;s0 exrio iydllen ies ( a2trx o;o1ale iieiadfm2ulumo;(0altniocoytfaDrau s;s t2tmxm oy1lm nlfcilt)sDtr(r oo1olt ifcildls2raump;u) lerxo3iy1fmt aieils0teumxm3ou4llenmivtl(f Durump;t1olx  oeild m2emu pn(0trtoio iatfpDeli i;s0s2xoir3io1ll nmfcsltfaDumurpnt1aex moeild s uaump;u4areoxo todoaDe uvs (0 2to(rpiu4al emfvils)aDur(mo;t4ope  i3iydls2umn pnu)tlxnmo iydfpD luvi;s0srxr(r oy4olt mfviat)arrm(mo;u0tlxomf3tad s rm( o;u0 lxrxf3oytfmte ues;t0s2trxo iudll emiet (  Dtr(mpot1alxo feildfm2ranvpnt)aexoxrciatfm rauvi s0srtr(r ou1am emfvs ()aDumx pnt4ale ii3tat m ran p;(0altrioctodlatelivi;t0trtrirpoodll  lfei s srrrur ;u4openmieias m2rl(ms (0trxnmf3io1lpDrlneo s texrxm3nudolte nct sf 2um(ront1aleomietltfm ea(mp;(4texnircta1lpt au o t seuo(r no1ole  fvsltfarrru ono4oltoiociysls ean snu4trxnmrciodoaDrlueo;s0 exmim oydole mfctl(  Dtm( o;u4oltnmictatfmDra( snt4teenirciadopDeanesl( s2uo(o3nu4olte fvi t)sDtr(r ot4alen oeiaslaDran onu4aleoxocto1opD li s;s0s2umxm ou4optnlncsa()srumurpoo1optoif3tatlsDem( p t0 ltnxrcoodla eluvo s0seurxopiy1ap e fcta()s2tr(r no4opx ioeild sDua(mp;t)aleoxfcto1lmD aivs s) ruoio oy4ole  neia(fsrraxm oo1apx  icilt m ul( s u4 exrmf oy1fm rlu i;t)sexmxmpiydomtnlicsat)s2rrurono1alxn i3ilt s elumo t)trtrxr ootomDelnvi t tetm(o iu1lmt lnetl(faDrrxmp;t0oee if3tlsfsDrmu o u0 lerxr3to1lmDeaivs t  rurxr3oodoltnlfvsls  2trumpnu4olt  ociyslsDuauvp;(4altrmf iatlaD aieo;(0setrir3nydom elfvsa() 2urx pnu0tlxnmo3tltla2eau s;u4aeerif3iy1om rlu i (0srtmxmpiy4alenmneilsfsrtrxmo;u1tlxoifciatlsDrluvp t4 ltnmo3ta1la  lieolt) 2trir iu4lp nlfvsa( aDtm(m ;o0apenmoeils m uanmpn()teerxocio1lm eai olt setrim oo4ome  ici (f Dum(root1aexo i3iytfaDua(vsnt)tleoxf3ia1oate u o s)s2xmio3iy1lltn ivs (f Dtrumpnt1opxomfciyt m umumsnt4 rerir3iadom eluvols texrim oo1olt  fvt s)srtmumont1opt mf3iydfm rmnvp t0tltrioctodlm eaueslt0setrxo3oo1lleemfvsas a2ra( onu1altomf3ias a2el(ms () eerir3io1fpD au sls0s2uoxmpio1optnliciat sDtru  nt0tpe iieiasfm eanvsnt)alxomfcoadlatelnvo;s  rumxr3ou4omt lnct ()srtm(mpno4alxniietyd aDum( s ()arenif3iotlpte uei;t0t2xr(opny4omeeliesl()sDumxmp;u1tltnmicildlm um( p t4 reomf iytoatranes;(0tetoxo3oy1llt liet tf 2trumpou0tpeo fetydls el( s u) ltrio3iadlm  lnvo (  2toxm io1op elnet t s2rrx pnu0olxn octlt aDranvp;t0treoir3totopDe ueilt) euoio iudlme lneiasfa2rmxmp;o0oeenmo3iasfaDul(mo;()trxrir3iydlptrln slt)trumim3no1ape livil(farrmuro;o1ale  ieiys a el(vo;t0arxnmfciotop rai s ( texo(mpoo1ll nmnvi s) 2ur( o;t0aexnmietysfmDua( p (4teeriocio1fptrlneo;s)seuo(r3iy4olenlicslsfa2rr(moot1alxomi3tyt sDelnmo;u0aeenmfcoa1fa elnvolt0 rtriopoodomenlnvs ()a2tm(mpot4oeenio3iatfs ul( s;(4 renmrctytlmD li olt0trxmim3iu4ll n ivtlt)srrmu  no4apeoiietyt m rauvs;(0 rxrio iotfpDeli i s0 eumim oy1op nmfcsa() 2umurpot0olxoioctlsfa ra( sn() rerxrcoy1fmtrliesls) 2xmxopoo1ll emnvtlt)srur( o;o0aeto ieiyslm emnms;(4 lxrirciadoat luvsl( trxoxr3nu1om  livt s  rur(mo;o0opeomictadlm2rmu p t0 rermociydomD  nvilt0srurimpnu4al  mnci s)s2rmxmpoo0tpxo oeias mDelnvs;(0 lerif ta1oaDr ueo;()s2toirpoy1lp elicsl() 2ua( oot0tpxnmfetysfs2ulumo u0tlxoxrciatlmD an s;(0 rurxrpoy4oltelfes (  Drrxroot1apxn oetasls ua(msn(0aeeoir oydopDeluei;s  2umio3oydlptemivtat  rra(mp;u1aexomieiysfa2ulu s u0 rtoxo tatfa   u s t s2xr(r nu4lmee ivsa( sDtrumooo4aet  oeiadls elums;t)aeeoxr oodfpte nei t)t2tmiopoo4om   nvsat srurxroou4tee if3iatfa2em(ms (4trtoir oodfatrlieilt)seurirpou1lpt mncsltf Dtax pnu4alx  o3ildls2eau o t0 lxrirctodlp  lnesls)trumxopoy4ap  livil()srrm(r ;o4tlxomoetls m2ea(vo;()tetnxo3tatoaDran o;(  eur(m3nudlmeemnctatfs2rm(m ou1ale if3iytlm2ran p u)alxnxf tydlatrli o;( t2tm(o nudlme  fctat) Drr( ont1tlx moeiatlm eanmsnu)arxrmr3ta1omtr nvo;s)setrxr3nodlp emfciltf 2ururoou0aptomo3iydfs2umuvp;u) rxnxo3ia1lp  aieol( s2xoxr no4ol e ivtls a2uaumonu0alx ifeiytls rlnmo;u0arermo3oo1la   uvi;t0truoimpoo4omte ies ( sDtmxm ou1ape iieiad s rauvon(4 ltomfcoodlmD  ieil(0trum(o ny4altemncta(f rum( o;u1tpen fcildfm ra( o (4 leomr3oytfp  an s s) eumxr iudlltelfvi sfaDrm( onu0tptnmfetlsfsDuanmsn()texrxrciodoa raivo;s)texrim ny1lltelncs (  Drmurpnu0aet io3iytfs rm(vsnt0aeerxr oa1lpDe neols0 exr(o3ou4lptn fes sf rtrx p;o4alx iictatfs2rlnmonu) rxnxrcoatoaDrlivs s) 2urir3nydlpe lieil(  rtaxrooo1tpx mfetatfa2rlu p;(0tleoxo oydfpt au o (  ruoxr3oodllte ivi s  2rmxmpoo4tptnmo3iad a rm( p;u0texnmf3ia1fmD  nvs t0 etoxo ou4apen nciat)sDtmxrpnt1altnmoeiasla umuvo;t)treoif tadoaDranvo ()setmirpno1lpenlfcsa(faDuaxrpot4oet ioeiytfm ra( pnt)arenircoo1omDrliesl(0t2xrxr3oo4lm  mfetls)aruaurpno4texn f3ild s2el(vsnt0arxnmrcia1fmDeli il() 2tm(opnu4lpenlies s)aruaumpno4tetnifeils a2ra(vo;t0teeomfciotomt  nei;t  rto(opny1om elncs sf ruaum no1tle ifetys sDeauvs t0tlerxr iytfaDelies (0 rxrio3nydlpenlnct sf 2truroot4alxnmictldfsDrmnmp (4tltoxrcoytfmDeaies;(0trtoxo oydapeemictl()srtm(mooo0opt ii3ildfmDem(ms ()aetoir oadlpD  uvi s srtoio ny1apenlics sf Dumur ;u4apeomi3iys s2eln p (0tltriocoa1lpt lu il( seuoir iu4apt mfcs ( a2rrxr nu1oleomocildlaDeanmp (4 renircoydfa ranes;s) 2urim ny4apeemnct ()srumumpnt1tlt  ocils a2emu o t) eenmf tytom elnvilt0 eum(r iu4lp nlivsat)sruaxronu4oee  oetldlmDum(mpn(4 exnmr3tatlptr n o;s)srurio iu4optnmnci ()a2um(  nt0teen ieiyt a ul( s ()tltomo3oatla  liei (0tetr(opoudlltn icsls) 2umu ont0aleniicilsfm2umn s t)areoxr3iydlpDeanvol( teuoxopiy4lme lnvil() 2umx p;t4oltnmi3ias a rm(vp (4aexoxr iodfa rauvo (0 2xmimpoo1ome lfes t arumu pnu0tltn octyt a2eln o;t4 leoxr oy1oa r ues;( setmim3oy1am nlivtatfs2rrxroou1olt moetat a rlu o u)trenxrctatomt livs s0s2xr(r nudll   nei t)a2rm(rono4tpeniietlsfs2eaump;(4 ltrir iodoatrlneo s) exoio3oo1ll nlfeil(fsDrm(rpot0aptoioctat mDeln s u0 etoxr3totfat  ueil(0trtoimpiydom e ncilt sDrr(ronu4altoioctadls umn p t) lenio iatoatrluei;s0trtoxr3no4ol n iei s s2uaxront1optn ociydlmDemnvp;() lxoxfcoo1lpDrau s (0 2tmxm3no1om nlicsltfa2ur(  ou4openioeiydfa uln onu4alxomoctodop eai i t t2xoxrpoy4lptnlfvsltfaruax oou4oet  f3ias a ea(mo;(4 rtnxr3iotom elivo;t0 rtmxopnydole mfetas srrmxr ;u4oeenmi3tldlmDeauvonu0aetrxf tydfmD  neilt)trurimpoo1ale  fvs ( a2tm( pou0aexomfeiatfaDul(ms;u0tltnmr oa1opDe ueilt  euoxm3ny4om emnciltfa2rr(  ou0texo iciysls rm(vsnu4 rtomo tytfpt lueo (  2trxmpou4aptn icta( artru oot1tpe  ieiltla elump (4trxrxo io1lpte u slt)teur(o3io4am nmivia(  Dtmxrpnu4tee mieiat s2elnms;() leoircta1fm rlies t  etrxrpny1oltnliviltf Drmu pot4altn f3tysfm uln sn(4aetoir3io1lp eaivs t0 rxmirpiu4lptnlici t  Drauro;u0apeomfeildlm2eanmp;u0 rtnxr iadfmt luvs;t)tetoxr io1lle mnvtlt  rrmxr oo0apxoiiciytfm2ua(vs u0alermr3oydomDeluvi (0srtoimpoo1al emfvtls) 2tmu  ;o0oetnii3tys m ul(vo ()teerxfcoytlaD an i ( t2urim nu4om e nesasfs2trx  nu0alt  o3tyt m umuvp (4trtomociodlatrau slt  etmxrpoydapt mfvsltf rtrurp;o4aexnmo3tlslm2rl( o;t4treoxrcoa1lat  ieo;s)t2umxm nu4alen fvilsfsrtmxmp;t1apx  ictldla2ran p;t) ltrxfcto1fa   nvi;s0trurir oudlmen nvslt a2rmu  ou0opx  i3tltfaDemn s t4aetoif tytopteaivi t0seumxopiy4lpt livt (f 2trur no4aee  f3tasfmDrmumo;(0texnmo3tatopt  ieol() rtoxo3no4lpeelnctls) rta( p;t1teeoio3ild s2ul(vs t)teeoxoctytom e ivi;s teto(r3nodop n iesat s2uaxmpno0apx iiciysfmDrmu o ()artnxfctodfateaivi t)sruoxo3iy1altn ieias s2raxm ou0tle mfeiyt aDumump (0 rtrmf3oo1lmDe ueslt)setr(mpnu1opt  ici ( aruax ono1optomocildfm2emums;u0 exomr oy1oaDelieo t0 ruo(mpoy4lltelfcsls)a2raxroou4oetn ictatfa em( pn() reoxr oodom e nesls0teurir ny1omenmfciat sDtmu pno0aexo oeiys a rln p;u0 lxnir ty1fptelues;(0tetrxrpoy4lmen fcslt sruaxr ;o0oex  octyt s uln onu0 rtomrciy1faDr nesl() ruoirpoydlp e fet t srtru p;o1optnif3tasfmDrl(msn(0aeerioctytomtr i il( trumio nu4al n fei s) rtrx o;u1teen ictys aDuaumpnt0 exnxf3ty1lm e i olt  rxmxr iydol  lnvtl()arurx o;t1tex  f3iydlm2um(vo;t)aexnio3iotfateaivi;s teuoxmpny1ap n fcslsf 2raxro;u0tltnmfctyslm ra( p;t4 eeomf3oy1fa rlieo s srtoxr oo1al   iciatfsDurxronu0alt iiciltls rlnvo t0 eeoxrctodoa   iei;t t2trxr3io4lp nmnvs t aDtr(r nu0ale ifeiytfsDrlnvp;t0 ltnif totfmDeauvolt0 rtmxo nodamtnlnetlt  Dtm(m ;u0tpxn o3tadls ulu s () rxnxo iydom eaueo;t trumirpnydal  lfvsl() Dtaur ;u4oetnioeiydfs2emu o ()trtnmr iy1fmD aivs;t0trtmim3iudapeelneta(faDrrurono1oleomo3ildfm rl(vs t4arermr iodoatelnvi s) eumir ou1lmeelfcsltfaDuaump;o0tlenioeiyt a umuvsn(4tetoir tadfp  lnvol() ruoimpny4omte iei t)s2tr( pou0aetomfctltfsDrau p;u4aeeoiocoatla rluei;( trtmxmpiu4oltnlicil(fa2rau  ;o0ape  icild a2eanvs ()teenmf3tytlaDraueil()t2tr(r3iodlme mfes t)sDtr(m ou1opxomfcild s emnvo;u)tlxrxr3iy1fmDeaivsls)srxrxm3nydoptelivs t a2tru pot4tpxnmiciatfs2elumont4teeomfcootfpDe ueo ()s2umir3ny4lmte netatf Dum(  no4tltoiieilsls2eaumon(0aexrmo3oy1opte u slt)texo(o3iu1ol   fvsa(  Dta(mont0olx if3iydfm umu o;t4 rxnmf totoa raivi;s) 2uoio3nu1ll emfcs s)a2raxr ;t1ale mi3iyt mDra(vp u) rtomr3to1omDeanvol(0 etmxr3ny4ape mfes t) 2rmuro;u4aee io3iydfm2ua(mp (4trerioctytfatrauvs;() exoxr ny1lp  mfesa() Drax ono0altoioetldfsDran p ()altrxoctodfpDrlu s;t  eumxmpnodalen fei s  Drr(roou4tee mo3ilslm eluvs (0 rtrxf iatfmDr i s t0teuoxr3no1lme mnct t)a2tm( pot0texnifetls a um( p u) rtrmo oa1lp r ivi;s)teuoxr3iy4al emics t aDuau onu0tet mi3ilt s ra( o;()areoir3ootfmDr uvi t0 2xrxopoy4am nmnvta() 2tm(m ;t1opxomfetasfs um( pnt) lxomrctytop  li sls)t2ur(r nydlpe  nvs t sDuru  ;u0aptoifeiydfa emuvo;t)arxoif oa1omtr i sl(  eur(o nudole lietat)a2tm(mp;u1olxoifciyt a2umnmo (4aleomo3ootop ean o;() exo(r iudaptemicias  rtmur no4oetnif3iltlmDrau p t4 rtnxf3iy1fa raues;( trum(o io4lme  iciat) rtru pou0tex iociad a2ul( o;(0 rxoxo3oy1fa   ieol(0trxrir oy4altelict t  Dtaurpnt0alxn i3ilt s eln p ()tltrmr oodla   nes;t0t2urxm nodale mici tf rtmxmp;t1tet ii3tlsfs2rlnms (4 rxriociotlp  li s ()s2urim3no1lm n fct t)aDur(roou4opt mfeilt sDrln on()alxnio ty1lm rluei;s texoxopoo1lleelfvias sDrrxmpnu1opx ifeiatfaDel( pnt0 lenir todfatr uvs;s0setmio3io4olee fet (  2raxmp;u0altnmo3iltla rmu s () reomfctatomtelues;( t2tmxr3iu1om nlncia( s2trx pot0oleoioctysfa2ulu s u4 lxnif3to1oaDr neo;t sexrxo3io4ope lfctasf Draumpnt1oex mi3ilslaDeauvont)tlxrxfctydoaDraieo (0t2urio3oudlmeelfcs t)aDumumono0oet if3iadfaDuaums t4texoxoctytoa e ivs;()teuoxr iydoptn fvsat aDrrxr ot1openioeiys a el(mp u)tlenmfcoy1oa rln slt0 exoxrpoydoptn iciasf Dtru poo0tpx  fcilt s emnvp t4teeoio tadfp elu o;s0seto(o3oy1ll  micsls)sDuru oou0ale mieiatlm umumo ()alxnif3ty1oaD lieo s) etoxo3oo1optnmfctatf rumum ;t0oex iocilslsDulnms t)aleomr3oydopt anes t0 etoir oo4ap emietatf Dumxm ot4opeoiociatfs rm(vont)aeerxrctydfaDr ivi t) rum(o3oudolt  nci s srta(r oo0oltoif3iatfmDeln o;u4teenxo3iatfmD aues ()s2umim3iudomenmivtasfsDtrx ono4alxn o3iltla rmump (0 leoio3io1omD  nei;s) rtoxopiodopt mfcslt)aDtrxr nt1tpx  ociltfs eau o ()arxrxo3io1fm rauvs;( s2xr(m3oo4ale mnci (faDtr(m ot0tex  feild s2rm(msnt0 exrxo to1om   nvi;(0 2xmxm3ou4lltemnctltf 2rm(mo;o4oet mietysls2uanms;u0 rtnxo3oytfpDeanes (0 2xoio nudlpen iciat) 2tau ono1tleoio3tydfm rm( p u4 etomr3ta1faD aieo;(0 euoio3nudlpeemnvtasfsrtmum oo1oeto ictyt mDeauvsnt0aeermo tydomD
\ No newline at end of file
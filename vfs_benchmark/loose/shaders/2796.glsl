@@ -0,0 +1 @@
+nei s)seur(r ny1omtemncs ()aDuaxmono4tlt  o3tatla emuvon(4texrmf tydoaDelu s;()srxm(m3iodomen ivtls) Dum(mo;t4tltomoctldlm ea(mpnu0 lenmr iotopDr uvs s) rxm(r3ou1op nlnvtas arra(rpoo4apxoifeilsls2elnvs t0aleomf3oydfm   u i t t2xm(m3oydapt  fctas a2uaumo;t0aptoiietatla2uaumon(0trtoio3oodopDrai s;(  eur(m iu1lmen fet sfaDra(r nt4tptomfeilt aDemuvsnt)alerxo3ia1lpte i slt)t2to(m iy4am nmfvta( arrm( o;o4aet mf3tadfs2ra( o t0artnxrcoytoaDrlu i s0s2to(o io1lmenmiesls aDtrx onu0apxo i3ilsfm2emuvs;(0aetnxrciotfmt  nei t0 rtm(r iu1llenmiei (farurx  ;o0aexoifeildfs2um(vo u0 rtomr3tatfptrlieslt s2urxrpoy1ll emfvslt s2tm(mooo1optomictlsfm rmuvpnu0trtnio3tadfatrau i (0s2urio iu1llen ivsat)artmumpou1tetnmociltls2rln s;(4treomo3oytop   uvo;s0 rtrxr3ny4aleelncsa()a2rru p;o0oex mo3ildla2rl(vonu)aetnxo to1omDr uvs t  exrim iy1ap  livi ()s2rax  nu1alxo fetatfs ulums t)arxomfciotopte i ils srxo(r nu1ape  fei t)a2umum no0olx  oeiys m2rluvpnu0trxomr3todop rlueo;s  rxo(m3ny1lltn icsl()sDtaxmoou1oee  feiadla2ul( sn()arxrircty1fmDeaueils0t2uo(o ny1opee nvilsfaDum(mpot0alt mfeilslaDuln o;(4 etoxfctytopte u s;()srtmim iydlmeemncsas)a2ra(mpnt1aexomf3iyslm rmuvon(0trxrxf3iodoaD luei;s trtriopoodlmt lietl()aDrm(mpnu1altomoeiyslm2emums u4aexnxrcootlmteanvi;t)srtm(m3oudop elieils) Drmxrpno0tlx  oetasls2uau s;u4tleomocio1opDr uvo ( seto(rpiudamt licilt)s2raxm ;u1open icildfa2emn s u4teeoiociodfat lnvols0trxr(o ny1apenmict ()sDuaxrpot1optoif3tls mDumumsn(4aeeriocta1lpt au i;() rtmxr no1omtelivils a2tmxmono0aetnmfcilsfaDemn p t4 etnxocoydfm eai i t0trumxr nu1ole mnvt t)aDumx  nt1aleo fetad a eau pnu0aetrxf3to1fm   ues;t t2xrim iodamenmiesat sruax ont4tpt mfctas aDeln o u)tlxrif3oadfaDrluvs s0srxr(o nydomt mivtltfs2rax  nu4tetnmi3ilsfmDemuvsnt) eerxociatoa eli s;(  ruo(m3oodal elietat)sDurxm nu0ope miciltlmDua(vp;t4alenirciadop eanvsls0 euo(r3nudom elfvslsf Dtmum ou0aeen fetydlmDel( p;(4trxnmrctodlat aues;( s2xoxmpiudaptemicsa()sDuaxrooo1opeomo3iltfmDuln onu4 etrir3tytoatelneols) etmxm3iu1ope lnes t a2tr(r oo1tleoioeiadfaDrm(mp;u4artomf3todoa rlneo s  rxo(o oudlmt mfct ()sDrmx  nt0aetoifetls a el( o;t4 lxrif3iadla  aiesl( t2to(m io4om nlncta() 2umumpnu4tlxnmociyt a2uau s;u) ltrxr ty1lpt  ies ()t2xm(m3io4am n fcsat)sDrmumpoo4olx mfeias mDul(vo u0treoio3io1lmDr ies s t2xmim3io4alee fcilt) rtaxr ;o1alx ifeiyt s ua(mo u) rtoir ia1omD an o t0s2xr(m3nu4op emiesltf 2trxmpot1opeomfetas m2ran o;u0tlenio3todlmDr ies ( seumxmpnudlm nlfesa()aDtrur ;o4tpt mo3iltfs umnmsnu) ltrmr3oydom rli sl(  rxm(mpno4ol nmiviat sDrr( ont1opeoii3iydfsDuanvonu4trtnxr3totfpt  uvi (0 2urxr3nu4al  lfcsasfaDuau pno1oee  ociasfaDrau p;()texnmrcoo1lmtr i s;t) etoiopny4am eliesl()sDtmxm ou1ape if3ilt s eluvpn(4 ltrmf oytlmt lnvslt  exrxr3iodaleelnciasfs2ta(r no1olxniictat m emnvpn(4tlenmociy1om raueilt)seumir3no4ll   ietls artmurp;t4tpt mo3iydlaDum( pnu4 rtnmrcta1lmDeai s (0 2xrxr iu4amenlivs tfaDrr(mono0tlx mociysfaDran o ()tleoxf3iodomt  ivi s0 exr(o iudlleemnci sf 2ra(m ;o0ale miciadlsDrau onu0trxoxr3ta1lm   i i;t t2uo(m oo4ameemietl(f Drr(rono1oetoiociydls2elu s t4tlxoxrctotla rln i s0t2tr(rpou1llee feilt s2uaxrpot0oltn fctad m rmuvonu4 lermrciydlmDeai o t  exoxo3io4al e icsa( s2tm(mont1tpx  octldlsDraumpnt) etrmrcootoa r ueils0srto(r3ny1al  mfeilt sDumxm nu4opeo iciyt a2rm( p;t4alermf ta1om e u olt)seumio iydape mivsat  Duaxr ;t1olt ifctysfa2elu pn(4texomo3iodoat li o t)t2uoxm iu4op   feia( a2umxrp;o1ope iiciyt mDua( o t0 rtoxrcoadlm eanvs t)t2xo(m oydllt mietltfsrtrurpou4aex ifctldfa uluvs (4 rxnio totlpt lies t)texr(o3iu1lmtemnes t  rraxmoot1opt micild mDua( p u) leoiocta1opD au olt0srxo(mpnydape  neiasf rum(mo;t4aeenmfeiltfa2uan p ()aexrmf ty1fmDraieo t)s2um(o io4al  mfvt sf rtaxm nt4opxn feilt aDelnvo;u4tlermr iytom  li i;()s2uoir ny4lm  lfvi ( sDrmxrpou4tetomo3iysfs ulu p u4 rtnxo3iytoatrlieo;t) exo(m3no4omtemfet (fartrxroou4apto fctydfs umnvs;u0tlerio iatlpD  u ilt seumxr3iudam  lfet t  rta(  no4ope io3ilslaDuluvs u0texnmociadlp  aneil( sexrio iudal  lnvi t)a2uru onu4olx ii3iasfaDua( p;u) reomf3iadfp e nei (0trumxr3iydolte ictltf ruaxmo;o1alxoifciytfs2el( pnt4 etrmfcoy1fat li ilt0srxmir oudlmeemiesa(fs2rm(  oo1oltomieiadls2umnvpnu0 rermrciadlm elnvolt)s2tm(mpnu1lpee iei s)s2rr(mpoo1apxn feilt mDumuvsnu4trerxo iytlmte nvo;(0texmir oo1ll e fvi sfsrrr( p;o0aetn o3tasla ulu onu0trxoifctatomtelneo () rtrxrpnodolt  nvslt  2umx o;t0olxo i3tlt s ranvo ()tltrxo iatlm rlueilt) rtmim io4lpe mncsas a2rmuro;t4apxoif3ildlm2emnmp t4tetrif3iy1opt aivo;()trtmiopno1al elivt s  rrm(mo;u0tlto iciytfm rau s u4 eerxoctytlp  lneol(0 2xrxr ou1lp  liei s) rtmxmonu1oeto f3iysfs2um( snu)aetrirciatopt livil()srxmiopiodlme lfvslt a2umumooo1tpe  ociatlaDea(vs ()aeerir tadfaD  nvi;(  2trimpnu4amt  icias a2urxr no1oexo ictas a2raumo;t4 lxrxfciy1oa eaivils)s2um(rpio1olee nesa(fsDurum no4altn feiytla ulums;u) rerxo tatopD aneilt  etr(m oo4lptnmneilt arraxr ;t0olenmi3ilslaDumn snt0 exoxf3iytlm r ivo;t0srxoim3oydlpt mivta()srurxrpnt1texo iciasfs rm( pnu) lerxf3to1fmDrauesl()t2uoxr3nu1ope mnvt t)srrr( o;o1oexomf3tatlaDrm(vs () lxoir ty1lpt  n il(0srto(mpnu4lp  mnes s)srtm(mpoo0tleniociad a uanms t)areoir3ootlaDrlnvo;t)srxoio3no1lme  ictl( aDur( ont4aee mo3ias m2ea(vonu4 rerirciatlaDeli o;(0srxm(o3oudlmt lnet s a2trxrpot1aeeoiiciytla2rlnmo;t0altrmf ia1latr neo;t)t2um(o io4am   fctasfsrta(mp;t4tpt iietas a uauvsnt)alenxf3ootlmD aies;s0trurim oy4olt  nct t artaxmp;o0olxnifciltfm rlu p;t) lxnir3iotlat  neo t sexrirpou1omtnlneta(fa2raum ;t4texoiicilsla emuvp u)artnmfcoo1lptelnvi ()trtrxm nydamt  ivsl()s2rrx o;t4teeoiiciydlaDemnmsnt4 exrxfctadfateai i ()texrxmpoodamenliciat)s2rau o;u4aeenmfctyd a2rmnmpnu4 rxnxf3oy1opDelivol()sruo(mpiy1om  mfcs (f ruax ooo1aexnif3iyslm2rmums t) lerir tydfaDelueil() eur(r3ou4llt lnvsls  2raxmo;u1ape mfeildfs el(mp (0 eerir3tatfm   u i;t)s2um(r3nu4lle mnctat)sDtm(mo;o0texnmoeiltls2eanmo;()alermocoadopDelnes (0t2uo(opno1lmeemfciasfsDurum oo4oltnmietadfs2rlnvo u0 lerxr iytla   neil() eto(m3oy4oltnmivtls) 2rmur ;u1oee  i3tyt a2rlnmp u)texrmociytfpDrlnvols)t2um(rpou1lpt mnei (fs2tmx  ot4opx ioeild mDemnvpn(4 etrmr3oodom   ieolt) etoiopou4ame liciat) Duaump;u1altoiociasfa2ea(ms;t)trtniocoo1fmDeanvslt)teurxopny1lltemnvtat) 2rmur oo4opxoifciatfs elu p t4teerif3totfpDrau sl() rtrxr oodlpe lfeilsf ruaurooo0tltnifeiyt s2ra( snu) lxrxfcootfm eanvol( teumxr nu4ome mfctat) 2uauro;o4aleomo3iys s eluvp u)tleomfcia1lpDelues t) exoxo3no4oltnmnct s  2tr(rp;t1tltnifetadlmDrlnvpnu4 exnmf iytlm rli slt)t2umxmpiy1omtn ieil(faruaump;u4texnioctltfaDrl(mo u0tlxnio3tatopDranes;()trxmxm nudamt lies (  Dtau  ;o1opxoio3tldla umnvsn()artrxf tytomt lnes s)truo(r3nu4omt  fei (f 2tru  ;u1alxniiciat s eanmp;u4tlxomociydfm r n o ( srtoxm3nu1ap n net s)aDum(rpnu4texnmociltfm2ulu p;t) ltnif iydfa raieil(0t2uo(r ou4lm   fvil()sDtrx pnu0altn i3tyt aDul( s t0arenmrciydop   i olt t2xoio nydlmen fei t a2ra(r ou4oltn o3iytls2ea(mp (0alermf iytfaDeli o t teuoxo oudlpt liesa(f 2rmxmo;t4tpxniieils m2ulu o u4 ltnircootoaD  iei s) rtoirpnodomt lnct (f Draurono1tpen oeiltlm em( s;t4 exoxf3oodlaD ai ilt) 2toirpiu4lmtn fes (  Dtrxr ;u4olxniociat mDrauvp t4aeeoxo iatlmDr i i () rtmxr3iodlle mfcilt) Dtrurooo1oetoio3iadlsDrmn o;(0trermo3oadopDe ivo (0srtoim nydole  nct tf 2rr(mp;o1oex mfctlsls uanmsn() lxoxfciatfmD an ils0s2trim oo1ol nmfct (fsDrmxmooo4teeoii3iysfm2ean o t4tlxrif ty1fmtelieols  2xrxo io4altn fcs (fs2tmu pno1apx mi3iysfaDea( p;u0 ltomfciydfpD ai s;( trurxm3oydomeemneils)artmum oo4tpt mietld sDrmn pnt) rtomo iytlmDeai s;s0srurxmpno1lmte ietas  Drru pnt1tlt  o3iyt s emn o t4teermr3iodomtr i o s0 etmxr ou4lm n neil(  2rru pnt1apenmociys m uan s;u0alxrxf3oadoaDeluvo;(0 rtr(rpoydlleelneias sDrr( pnu4olx miciydfsDulu s;t)trxrmr3iytoaDranvil()sexrir oo4omt lfct s)aDtrum oo1opeo iciysfmDumu pnu0artnxf iodoaDeai sls0srtr(opnu1lm elnvsa()s2tmxro;o4tpe iietasfa2ulnvs u0tlxrxr3io1lp  au i s0 euo(m ny4op elfvs (  2rau pou1apt iieild a2rmn o;(4texnmrcta1latr i i ( srumiopiy1alte ici (faDrmx p;u0oetoioeiyt a2ulnms t4arxoio3tatla rauvsls trtmxo ny4lmenlnesl()srur(mpnt4olt mociadfs2elnmo;u0 ltomf oatfm  luvslt0t2tmxrpio1ol  lnci (  rraur ;o1aeen iciatfsDuanvonu0 renmr ta1om elnes;t0trurxopoo4aptemneslt  rtau pno0aexn i3tlsfa rauvo;(4 exrir tytom e nesls t2uo(m3nu4lp   neilt)sDumxmont1tpxo fciys sDelnms;t4 ltomf3tytoatelies ( srxoxo3oo4ameelfesas)sDtmxrp;u4opeo i3tasfmDelnvp;(4aexnmfctodlmtrauvi t teuriopiudll n ncslt)a2raurooo1tex micilsfm2umumpn()trtrio oodlptrauvi;(0srxr(r oydal n ncias arrmx p;t1aeenio3iysfsDrmuvsn(4tlermr3iy1fpDeauvi;(0trtm(m3oo1lmee nvtatfarrrxm nu0oee  iciasls2uaumo t)trtnmr3oydfaDeau ol(  exr(m nodopenmnet t) 2uru  ;o0tltomoctytfm2emnmo u) reoxfcio1faDeaueils0seuo(r io1ame mnci sf rtrumpnu0oleomiciyd s rlnmsnu4areoio iatlateanvolt)tetoio3oo4lme lnct s s2um(m ou4aetnif3ilt s2umnmsnt0 etomf iatfmtrlivo t srtr(m3ny4olt mfet s aDtmurpou1aee mf3iyt mDuau p u)alxoifciodlpDelu i;t srxo(rpoudlmenmnvt t)srra(rpoo0oexn f3iltla eanvs;u0 etnxf tadop elnvs ( trur(o iudlm n fctls  rtm(mpnu1olen ieiatla uan p;t0trxnmrcio1oaDr i s (  2xoxm3iudlp  lfvilt  Drrur no1oexo i3ildla rl(mo u4aexoio3oytoate u i;(0 2xmim nudalt  fvsl( artrumpnu4opx  oetatfa ul(vs u4artoxf3oo1lm eauvs s0seurir iu4lp nlfes sf 2trurpot0aet  f3tadfm2rlump;(4tetnio iy1oa e nvils0trtrirpny4omtn ivslsfsrta( ono1tpx if3ildfs ua(vpn()aetnxf3ty1lm rluvilt  ruoir ou4lmtn ncia() 2ur(rono4alt mi3ild a rm(vp (0 exnmf to1lpDeli o;s0teur(r iudll  liciatfaDtaxr ot0oetoioctasls2ulnvpnu0tetrxr3ootopt aues s0trxriopou1alenmfvta()a2ur(ro;o1aex  ieiadfm2ranmsnu0 lxnxr3iotomDrauvolt)srurimpoo1ole  ivtl(fsrtr(mo;t1aexoioetadfm2umu p t)texrmr3oy1lpte u i t trtr(r3ou1lltemivt t  Dumurp;u0tetn ociasfm emu sn(0 ltrif3oa1lm   ivs;s)sexm(m3oodamtemnvs (fs2uaump;t4tpx moctas sDeaumo u0arermo ta1fpD  u i s0 euo(m3io1am   fvslt) Draumoou0alx mociyt s2ra(vp;u4teeomfciy1lp  aiei;() exr(m3iy1apt lncs s a2uaxm nu4aexo fciytlm rmump t4teeomr3iotoat  nvs (  ruoxr io4opt mfvs sf rrmxmp;o1oeeoii3iyt s uluvs;()tlxoxo3to1omte n i s)srtoimpny4lmeelnvil(faDumum oo1oltn o3tldfa em(mo;t4aeeoifcoa1lm rluei s  rtm(m3ou4ll nmieil() 2raurooo4tetn o3iysfmDul( p;t0altrxo oadlpDean s;t)s2xmxo3nydamtelicilt)a2um(ro;o1tex mi3iysfs emu p ()tetnxfcoodomDeauvo;() rumxmpiu1omenmnvtls)a2ua(r nt4aexo ocild sDelumsnu4tltrxr tatfaD  iei s0texm(r3oo4lm   fet t)arum(rp;o0alxnif3ias m2ranmonu4 etnmr3iy1oa  luvo t0 etm(mpnu4omt mfvi sfs2tauroou0apt mictadlm rl(ms (4altrmfcty1oat  ivi t)t2xo(opou1opte ivsl()a2rmxmp;u0optnioeias a el(ms ()alxnmfciydoa r nei t0trxrxmpiudam nmfvt tfarumxmo;t0ole mf3ilsfa2um( o u0arxnmocoydlm eluvsls srxo(m nodamtn nvs tfarrau p;t1oexnmf3tysfs rmn s () lerif3iytoat aieo;(  rtoxo3iu1om e neiasfartr(rpot4optomi3iyd m2rln onu0 rtrircoadfp e u i;s0seumxo3nudolen fvtlt  Drax  ot4opto iciydls rmumo u4aetrxf3iy1fm rluei t trtoim3iudlmenlnci ( a2uax ono1tpxn fciytlm2ranvs u)altrmo iodopD  neols0srtmir iy1aptnmivta( s2urumpnt4ale  octatlaDuaums u0aeerio oo1opDe ueilt)t2xmio oo4lm n fvtas sDtmxmp;t4teen ieiat mDrmnvpnu0trxomociytfmDe u sls) etrxr iudopeemnvsat s2umum oo0oeeoifeilt m2elu on()tetoxr iydomtelnesl(  ruo(m3nu1lpt liei () Draxm ;t4olxnioetlslm umnvpn()alxnir ootfaDrai o;() exm(r no1lmt mieil( aDtaumont1teto f3iat m2rl(vs;()texrxo3tadlpD  u i (0sexmxm iu4ol elnesl(f Drmxr ;t4oleoioctaslaDem(mpnt0trxnxf ootoaDr iei;s t2trio iy1al nlicilt a2tm(r nu4altn iciysfa2ea(vsn(4tetnio to1lmDr uei t  eurimpnudap n feil(f 2ra(monu4oexomf3tytlm2umu s (4 reoifcoodla  li s;( teuo(rpoo1ame  ies ( arum( onu0tpt iieildfmDelnms;u4 ltnif to1lat  u i t)t2toxo ou1apt lncsas)sDra(ro;t0open iciat sDumump;t)tltrio oa1oatr neolt0s2umiopno4optelncs ()a2um(r ;o0alt mf3ild a2ulu o t0arenmfcoy1opt aneo s) exoxr3nydlp emivslsfaDtr(m ;u0aee if3iydfa el(vo () rxoxo tadfmte ieols) rtmir3iu4altelies s  2rrx  no0aeeoif3ildfs em(mont) lxomr iatla r ieo;(  rxm(m3iydap nlfvtas) Drru pou1opeoifeiydfa2ulnvo u)treoiociydlatraiei;s0texo(m3ou4lm n ncsls) 2uau  nu0tpt io3tydfmDean o;(0 rtrio ia1fmte uvi t) 2tm(m nudlpee nct sfarururpot0aet ifciytlm umn p () etnmocoy1lmte uvil( teuoimpoy1ol   fcilt) 2ra(  nt1teen fciytfa2ranmp t) exnmo iytfm  lueol(0 2urio3oo1omee netasfarta(root4tptnifeiydlm em( snt)tleoif3ta1lat au o;s)setmirpoo1lmt  fvs () rta( onu1apxomoeiys s um(vo;u0artoxr3oa1oa ranei t  rurxopiudoptnmivt () rrr( oou1tpeo i3iyslmDua(ms;u4 etrmo3tadom   n o t0 euo(r3nydopee fcs t srur(m ot1aptnifctadfa uauvp;t4 renmr3iytla elieils  2uo(m oo1opt mivilt)arrr(mpno4oleomociytfaDemuvp;u0 exnxr3ootoaDr n s t)s2xmxo iy4lptn ieil( arraumpot0teenmf3tad s raums t0aleoxr todfaDrluvil()tetmim3oo1oleemies (f Dtax p;t4alxniietyd mDelnmp;t0arxomr to1fpDelnes;s)srxoxo3oy4lm  livil(  2um( ont0oexo f3iasls2rln p;(4 lenmfciotlat luei;t srumir3iudlm e fet sfs2rrxr ou4ole if3iasfm rmuvs;u4aeenxfctodfa elieols0s2xmxr3iy1lpe lnci (  Dtrur ot1oeto fciydfs2uan o;() rxrmo3ta1fmDr ivil( t2toiopio4ll emfet () Drax  oo1aexnmoctyslm umnmp;u)aetoir tytopteanvols0trur(opiudlm e iesas  Drrxmonu0olxnmo3tydlsDran sn(0teenif3iy1opt luvo ( t2tmxopiu4altemfciasfartmx onu4alt io3iaslsDua(ms;u)tlxrxr3iytlaD lieilt)sexo(m3iy1ome  fes t) 2uaxro;t0teen f3iydfa2rluvont4 lxnxo ta1fpD an olt seum(opoo4alt  nvsl( srrrxmpno0apxomictls a ra(vpn() ltnifciadla eaivi;( s2tmim3io4oltnmfvs tfsDrauront4teen fctldla rmnmp;(0trenxf ia1oat ln ils) exmxr3io1lmee fcil( a2rr( o;o0opxo i3tydfa uau s t)aeeomoctydlate ueols)t2uoio3oy1ameemictl()a2tm( ont4tetnif3ilsfs um( p u0 exrxr iydlpDr n i;s srtmir3iy4llte icsasf Duaurp;t0ape  ocilslm2ea( p ()alxrifcto1fpDeaiei;s texrxo3iy4altn fci t a2rm(  ot1tpeniietltfaDua(mo;(4artrmr3iy1lm   i i;s  eto(r3ou4lm n icslsfs2ur(mooo1tpe  ociatlm2elnmo t0trtnxf iadfp  anesls0trxrxo3io1ll  mfesas  rra(ro;o1aexnif3iyd s2ra(ms;t4altomo oadfpDe ues ( srtoxm iydll emfcslt  rrr(  ;u4teen fctaslaDuauvs;u)alxoxr iadfateauvils0t2xrxm nodaltelncsas)a2tr(ronu4opeoifeiydlaDea(ms;t0 exrirciodfmDeln il()texmio nudop  mfvilt)sDrr( p;t4aeeo i3tldfsDulnvp;(0alxoioctytopteai i;t t2tr(o nu1ll nmicils)s2ua(rpot0ole mo3tlsfs uauvo u)trxnxrcoy1omt lies t  2urimpiydam  lncsat aDuru  ;o0aeenif3tatfsDemumon()texnmf3oy1laDe i i s) 2xoim3ny4llenmfeslt  2rr( ooo0tpen oeilslaDrl( s t0arxnxrcoadfaDeli s;(0 rxo(mpoudlp nmnvs ( sDrrur no1apxo i3iat m uln sn()tltrxrcoadlmte nei;(  rtr(o nodapee ici tfsDtaumpoo4apeoiietadlm2ua(mpn()aetrmf iytfaD ln i t s2xrxo iu4oltn nvtasfaDtr( pno4aet  fcilt aDelumpnu)trerxo3ootlmD lnvi t teuriopiodlp n fetlt srrrx p;o1tlxnio3tytfmDumuvsnu0arxnir oodlmtelnes;s0 2xmxopnu4lmee fes ( aDuax  ot0tetomociyt mDemn o;u)tltriocoatomt  i s;(0 2xm(r3nydal   icia( aDur(  ;o0tlt mf3tyt m elnmonu) ltnmo ty1fat li sl(0t2um(r3io4op  mictlt)srraurpot4oetoifeias m rmuvsnu0arenmr iatop  lnvolt) etoxm iy1lp  miesl(faDrmxmpnu1apeomfetad mDuln pn() rtnxocoadopDr u i;t tetrxr3nudlltemneiat)s2tr(mpno0ope ifeiyslsDrm(ms (0aeerif ootomDelneo (0srtr(opoudamtemictltfarta(r ot4altnmf3iytlaDum(mpnt0tltrio oytfatrlivi ( tetmxo3oydaptemietlt  2ur(m nt1teenmf3tasla2ean pnu0trtnxr iydfat  uvsl() rtmxm oo4ap elfetltfa2uru  nu0tpxoiictas m2elumont0 etnir3iodoa eluvils0trtrimpio1lp nmicil()aDtmum ;u0opeomietydfs2eaums (4aeerio ta1fptelnvols0seumimpoodam nmfvt t)srtr(rpot1aptnmietlt m2uln o u0 ltrio3ootoat  ivi;( setmxm oudlm  livtl()arrmxrpou1apeo ictadfmDrlnmsn(4aetrxr oydom  luvslt teuriopoydolt  fvtls) Drrum nt1oet mi3ildlsDraumo u4altnif oadlaDr i il( t2xrxr3iu4lme  nviatf Drr( oou4oetn i3ilsfm2em(vo t)arxnxf iadlpD  i i;t)t2uo(r3no1llenlivta(faDrm(m oo1alt moctydla umn p (0 lerxfcoatfaDr ivo s0texoxo3io4al elfvsltfsDrr( pnt4tlt  o3iydfa2elumonu4texrxo3oydomD  uvs s0trxmxmpiu1apenlneia()aDuau o;u4ole mociytls umums u4 reomocoadopte n ol()trxm(o3iydlltemfvia() 2tmxrpoo0apxnif3iasls eauvpnu0 etomo3tadfateanes;(0 2xmimpnodlmt mfeiasfaDrmxr ;o4tltoio3iysls2ran p t4tlxnmrcty1oaDr nvo;t)s2umim3ny1alt  nviat) 2rmx pnt0opxniieiytfm2el( p;u4 rxrircoodoaD  i o;(  rto(rpou1lm nmnvsas) Drrxmoot1tpx if3iatfaDum( snu0 rxoifciytomD au o s0 2xrxopoy4am   nvta(f Dtmumoou1tpt mociadfs rau p u4 etnmocio1lpDraies;t) rtmimpou1ame mfcs ( artr(mpou0olen i3iytfs2uanms t4tetomocoadlpDr uvo (  2ur(m iu1apenmnvi s a2rmum ;t4tpenifciytfa umnvp;u)tlenmo3oa1fpDelnvs;s0s2tm(mpnodalte fvia(faDtaxrooo1tetoifciatfm2ea(msn(0tlxrmr oadom  auvs;()t2trxr3nydope lncs tf 2rm(mp;u4apxoio3tltlm2rm(vpn(0 rxrxociy1la ran i ()tetrxm nu4lmen ivtat) 2tax  ou4olxnmietltls umu o;() lenio3iydfp  aues (  exmim iudlltn nctas aDrmxr nu0apx iictydla2uluvp;t0aexoir3oatopt aivi;s)truoxo iy1lp nmnvsa(fs2rmx oot0oltomfeils a2ranvont0tleomf3iotopDran ol(0 rxoxopno4optnlivtl(fs2uaxmp;u1opxnmoetasfm ul( s;u0 lenir3oytoate uvi;t trtrirpoo1op emncsa(fs2ur(monu4texomieiyt m rl( p t4 rxoifctotomDeaueil()t2xo(o oo1lpe  nvs s srrmxmono1oexomicils m ulnmon(4alxrmo3iytoaDrlivi s0t2xmxopno1lmtelivia()srtmu pot1alxn fciad mDrauvsnt4aexrif tadfp eluvslt0teto(m iu4ol nmfeiltfsruau pnt1texnioctls s2el(mp u0arxrmo3iy1fm eanes;s t2um(r3nu4apenmivsas srrrxro;u1tlt ioeilt m2ul(vsnt)alenmo oa1op  luei;s0 2tm(mpiu4lmt miesls aDrrxm no4aetomi3iad s rm( s;t0aeeoxo3totopD aneolt)s2toirpoo1lpee feia(faruaxmonu1openmoctls s umnms;(0artoxr3ty1fptrai i;s)trurirpiodamen neslsf 2urx ooo0oetn ieiatlm rmn o (4 rxrmf totlm   uvs;( teurxr ny1lmeemfet () 2rm(mpou4tle iicild a uln p (4 etoxrctydfm elnvsls0srxr(o oy4oleelict s) rurxrono4optn o3tydlaDum( pnt4altnmfctatlptrlneolt)trtmxo oy4alee iviasfsrtru p;t0tpeoiieiadfs umu onu4trxomf3oa1lm elnvi ()t2xm(opny1lm   ncsasfa2taumono0aeen o3tlsla2um(msn(0tlermo ta1lm r nvi;s0seuo(r3io1lptelicsl(fsDtru pno4aetnioetld s2ran o u)texnif3io1fatrlu o t)seuo(m iodopenmivs (  rua(mp;t0oexnmocias s2ul(mp ()areoifciadla r n ol(0texr(rpio1lp e fctas artax oot4ape ifetadfa um(mo;u0texoxr3iydfpte nvsl(0setrxrpiy1aleemivsa() 2rmx  ou0teeomi3iatfm2uaumpn(4altrmo to1laDrlnvs t  2uoxm3iydamtn nci s  2tmx pno1olenmo3tyd s umuvp;t0 exnxrcto1lp ean i t) etmxr oodlltemiviat)sDua(m oo1ope iietldfa rl( ont4trtoxf oatoa   neo;t)tetmxo iy4ap  mieta(fsrtmur ot1oetn o3tls m eluvs;(4 lermo3ta1fateaivi t0 etr(o iydomt lfetl(fs2tm(  ;u4openiicilsls rlumont)arenmf tytop  luei t0s2uo(r nydameemfvi ()s2trxmo;u1tpeo iciytlm2rl(mo (0artoiociatoate u i s) rtoir3nudap nlfetas) Duau  ;o1tetniocild a rm(vsn(0alxrio3oytfaD ln o s s2xoim oudlpe lfcia() Drmurpnt0opxn oetytfsDel(mon(0arenir ootfpD auei;s0srxmio iy1aptnmfvi ()a2raumono4alenmfctatfm elnvs;t0teermfcoodlmt aueo (  etm(r nudol e nctasfsDtr(  nu0oleomfcias aDumn o;()aeeoxr3iytlm e i ils0texoio no4open ici s)a2tr(m nt0tet  oetldlm2rln pn(0aetrxo oy1oateln s;t0s2uoxm iudam eliesa() Drru ont4tet  ociys s el(vs t4aeerif tatfmt  ues s) rxm(m ny4ame lnvs (farumxmo;u1aptniocias sDeanvpn() ltomr3iatfpD ai o (0 2tmxopoydomtemictl(  2tr(m ;t1aptnmieiatlaDeauvonu0 eeoxo iadfaDrlueils srxmim oo4alenlfeilt) rtrurp;t4oet iiciltfa rlnmon(4 reoifcoatlptranvi;()seuoim3io1lpt mnvt t a2raurooo4altomiciysfa eluvo t0 etoir3tadfp   ivolt)sexmio3oy4optnlneta()srua(r ;t4altnioctatls2ea( s;(0trtrmoctodlm e ues;(  2xoxo3io1amtelfvs tfaruaxrpot0alxnioeiydlm rl(vsnt0 rxnmfctotfm r i slt tetr(o nudolenmict sf rrr(m no4altn f3iyd s rln s u0aeerir tadlmDrauei t s2xrir3nudapee iesa( aDtm(root4apx iieilslm uau p;t0 rtrirciadomtr i i s  etr(rpiu1alenlfet sfaruaxrp;u4alxnmfeias s eln ont0 lxrif3oo1la  li o s s2to(opiydamenlicslt) rurx  nu4oex mfcias m2uln onu4 exrxo3io1fa elivs ()t2toxr3iy1opeelfct ()sDuaxm ot0ope mfciat s2rm( onu4trtomr iotlmtr nes s) exmxmpiodolte fcsl(fsrurxm ;u1oex mi3tyslaDeln snt4texrio oytlmDeli s;s) 2uoirpny1lm n nvs ()sDrau poo1opx  oeiltls2ea(vo;(4arxoif to1lmDr u i s  etmir3oudap nmneias  Dtru o;u1aex ii3iyd a rlump;u0 ltrmocootfpD ai i t)srtoim oo4olee icilt srrru pou4tpx mf3tldlm rmumpnu0arxoxr3oo1oateai slt)t2xr(o3nudolenmfcsatfs2taum no1optnifeilsfaDumu s u) reomr3iatfaDe iei (0s2urxmpno1lptn ici t) 2urxmp;u1texnmi3tatla eaumo t)aeeniocia1lm elnvo (0 rxrxo3iu1opte fet s) rurxmpoo4ole mfctys s ra(von()altrirciodfmD anvi t) rtr(rpio4lmtnmnes tfsDrr(mpnu1texomi3tas a rlumont4texnir3oo1opte i sls s2tm(o nu1aptelnvil( artm(ronu0tpxn fctydfmDulu pnu4arxoxf totop   i s;(0 rur(r3iu4lpt  fei ()aDrr( poo4oetoifciatfa elu p (0 rxnio ootoptraieolt)srum(m3ou1amen fvtlsfsDur(  nt1alxnmo3iad mDrl(vs;u0artnif tadfm r ivsls0 euoio nu4apte fvil()srtmu p;o4tex iiciltfm2emnmsn()alxrmocoadfmtrli i;t0 rurir3nodlm  lnctlt sDrmx oou1olx  ictlslmDrmuvp;t0 rermf oytlaD aieil() exm(m iydaltelncia( s2um(mpot0altnifciadfa rl(vsnu0tlenmo3tytlmDeli i t0 exoxopiy4lle lfcsl()srta(monu0opx ioctytfaDemnvs u4arxrxrcoo1laDrlivi ()texmxmpiudapt  ict (faDum( ooo0aexoif3tldla rau p;t) lxomf oytfpD  neol(0s2tm(r ny4optelfcil( a2urxr nt0alen f3tls aDel(ms;(4 rxrxocoatfmD aieils trtoimpou1open ictas) 2raurpno4oltnifeias aDum( s ()tlxrxr3iotoate n o;s0 ruoiopou1lmtnlicils)aDrmu ono4altnmo3tasls uln snu4aexnxo3ta1lpteluvi;( trtrio3iu1olenlnvias arrmxroot1aleo oetatls2eln s ()areoxfcoadopD  nes ()t2urxopiu4llte nvias) 2urur no0tleomo3iaslaDra(mont) ltrircoadlm   u o s  rtmir3ou4lmt lfeilsfaDtmu  ;o0tee mfcias s uanmpnu)areomrciytfpDrai sl(0sexo(mpiu4lm  mfesatfarur(m ;t1olto i3ils mDemu pn(0 rtoir oatfp   n i s  eur(o3iodal e ncilt) rum(  ot0alxn ictltfaDrau p;()trtoif3todla  anvs t trtoir no4apenliet ( sDrrxr no0aee moeiaslaDemuvs (0alenxrcoodfaDelu ilt0srxo(o3nu4al elfvt t aDta(mp;u1oet  o3iaslm umnmon(4tlxrxr tytlpD an o t s2urir3oodlltnlfeiatfaDta(mp;u1apx  oeiytfsDulumo;u)teerxrctotfa rauesl(0 rxmiopio4lmen feilt aDtrurp;u0olto ietatfm2rln onu) reomrcoy1oa   uvo;t0trxoxrpoy1altemicilsfa2ra( o;t1opeomoetadfaDelnmp u0 eenir io1fm rli ilt)s2ur(mpnu4al emnvil( srua(mo;u0oltn fciysfaDranmont4aexoxrcia1lmD livsl()trxmio3io1omenlfcs t sruaxroot0aet ifciltfm2ulnmsnt0 etoxrctotlmtr ivilt) 2tr(mpio1olt mnctlsfsrrmum nu1apx miciytfsDean sn(0 exoxrcoo1fpD  i i t t2xo(rpoo4omt lfes () Drmxrpnu4aeeoiictyd s um(vsnu0tlxnxr3tytomDelueo s0 rumxm3oydlp   netls)a2tm(mpoo1tltomiciat m rln onu0aleomr3oa1la rai i (0sexm(opnodomeelivt s)s2umx o;o0aexomo3iadfa eauvpnt)alxnmo3iy1lat luvilt0srxm(r3ny1lltnmfvsas) Draumonu4aptoioeiydlaDuanvont0 rtnxr3todlp r ivo;s t2umiopoo1oltelietls  Dtrxmoot0alxnioeiyd a2rlnvp u0 eermo iytlm elues;s)srtoim3no1om nmnvt tf Drr(r oo0apxnmi3ildfaDrmn p;(4tlerxociadlm  ai o t)trxo(o3oy4omt lfesa(faruauronu0apeo ocildfmDel(mo;()arermfcoodom r n s;s t2to(o ny1aptnmfeiltfa2ur(mo;u4oetnifctytfa ra(mo (0alxrxf iy1omD aiei;(0setm(m ny4ll nmfcta(  Dumu pno0tlxomi3tldls um( onu4aeeoxfcoytfptrlnes t trtoxo3nu1amee fcta( aDtrurooo1tpe  o3tytfsDrluvp;u4 ltnioctytlpDrlnvols0t2umimpoo1llenmnvilt  2rru  ou4aeto i3iys sDrau ont4aetrir3iotlm rluvo s)seurxm3iydapeelfcs t  rumxrpnt4oeeniietys mDran o;(0 leomocoa1faDeai i;(0truoimpoo4am emfei (f Dtmx onu4alxomfciys m rl( p;u0teerir iatomt  n i t0srxo(m3ou4lm nlfvta(  2urx  ;u0tex ifetltlm emuvpnu0 lerioctodomt livil()s2umim3nudalenlfcils) 2ta( poo1tleoioctydlm2ran o t)arxoxoctadfpDrlieil( t2umxopnodol e ies ()s2tmurp;t0tpto fciat m eanms;t4 rtomr tadoa  ai o s)trxoirpoo4amtnmnctl()arumump;o4tltniiciasfa umnvpn()trxnmfctydoa   i o;s0trxmxo ou4alenmnci ()a2tmu oou0oltnif3ilt m2el(mpnt0aeenmf3oytlaDranvilt  rxmirpiu1lpeelfeias) Dta(r ;u4oee  ocildls emums;u4artrmfcto1fptrluvs s0t2um(mpou1amen fcias)s2ta(r ;u0texo o3iasla2em(vo u4aeenxo oydfpteliei;s  2tmxr oy4ome mivta(  Duaxr nu1oee  icilsls rlu s;t4 lenxf3iydlmt auvo;t  2um(m oo1ape  fvi (  rtm(mp;t4ole mieiasfa2ulu p t4tlxnmo3oydlmte n i s) rxrxm io1aptnmncia(f rtr(mpot1tptniiciydfm raums ()tlxrmf todoate ueo t  rxoxrpiydlm   nci s sDtaum no1aetn f3tydfs2emumo;u4alerxr ty1oa   iei s0trur(opiu1omen nvtlsf rumx  ot1oeto oeiad mDrl(von(4teerif tatlmDrluvo (  exo(rpio4ll n ivslt)arurumo;t4ole mi3tydla ul(monu0arxrir tytoa eli ols) 2umir3iu4alee ivtl() rta(mpoo0opxomociatfa eluvo;u) exrxo3todlpDelnvol()srxr(m3oy1ale lnviatf Durumonu1tlt ifetlsfs2uln p;() exoxo iadoaDr ueo;(0 2xm(m iydom   fvta(faDuaxmpoo1tetnmi3ilslsDran p (4 renmocootlpDrlu o;()srumirpio4altemnetat  2ta(rpou0tltn i3tlslm2emu p (4trxoir3ia1oatean slt)setr(rpou4lm nlfcs t s2taxm nu0apxnmf3iydls2ea(vp u0alenxfctytlpD  ivo s  rxrxopny4lp  lict (fsDtru  ;t4tleo iciydla uaums;t0altnio3iadomDeaies s sexr(m3iydlm nmfcia() rra( poo1opxnmf3iadfmDeau pn(0aeeoxf3iatlm  lu ol() 2to(r3iu4lm emfei () Dtaum nu1apeo ocildls rl(von(0altnmfcio1fm e nvilt)setrxmpny1lm  mnvilt sDrrxrpot0tlx iociyd sDul(vpn(4tlerxf ootfm  anvi () exoxo nodaleelfctls)sDur(  ot1oetnmfeiydla2eanvp (4aeerio to1op eaivil() rur(r io4amtnmnet sf Dumum nt0oltnii3iysfm2ul(vs;t0tltrxr3totfa eauvi;t teumxo iu4ll  miesas)srrrurpou4alxnio3ild a2ra( s;u) rtnio ia1om eanvs;t)setr(m3oodam   nvtasfs2raump;t4tpx ifeiytla umums;t0aeeomrcootlaDrlu s s s2xmxo3oodlleelnvia(fsrrax p;o4tpx moeiltlm2rau s u4 rxoir3iodoaDrli ols trxrim3ou4ol emncsa( srtaxro;t0oexnii3iadlaDemu s;()teeoxf3iodfpD auei s) 2umxm3oydole mfes sfsrumx pot0aptoio3ias s elnvs (0tltnmo3iatlp r ues t0 rur(r3iu4aleelfeiatf rtax o;u4aee if3iadls emums;u4aexoxf oodla elueil(0 2umxr3nu1lmtnmfvt ()aDur(mpou4aetnifciytlm umums t) etoxf3oo1fateli ol()sruoxr3nudaptnmivt ()s2uax oot4aexnmicils m2eanvsn(0altomf3iytlpteaivils0truoxopnydamenmfvtatf rurxmpnt4ape  o3iyd a elnmo u0 eenmf iytlp   uvs s0 2uoio3no1llt lfet s  Draxrp;o1aet  icils m2eanmsnt0teermrcootlpte n s;( s2tmxr3iodaltnlietatf 2umur ou4teenioctatfsDeluvp u)tlenxfcio1omteauvo s s2um(opoy1lptelnesls)s2urur ;t1oleo i3iatlm rmuvp;() lxrxrctodfateluei s  2toxm3oudom elics t) 2urumpnu4alxniieiltla2rm( o;() lxomr oa1fatelnei t t2toxm nudlmt licia()artmxr ou1open feiadfa2ul(monu0tleoxf3oo1omDeluvo ()t2xmxopoy4opt lfes ( a2tax  ;u0tlxn ocilsfmDra( pnt4 rxrirctotfmDrau ols0t2xoir3oodlleemicslt aDrmu p;o1tlenmf3ild m2umn snt)aexrmo iy1lm  lneo;s tetmirpoodll nmivi ()srtaxmoou1alxo ieiasls rlu s t4altrxf oodoat  n sls0 rxr(mpou4ape  fcs tfsrtmu pnt0olxo o3tld sDum( s;t0aleoio ia1fpteai s;t0sruriopnu4aptelfcslt  2rmx pnu1tpen ictyslm2rl(vonu4 rtnmfcio1oa   ivi;()tetoio3ou4am n nvsasfsrtaumooo0aeeoifetadfaDrlu pn()arenifctytlaDrli s;t setrxr3io1ome  neta()s2tmu poo0tpto oeiadfa2umuvs;t4texrif iadoat liei s)sruoio3oy4alt livt t s2rm(root1tpenmfeilslm2rl( p (4trtnmo iatfmt ln s;(0texmxm3nodaptemietas)sDuauront0aeeomoeildfm eln p u)altrxo3io1opteluvi (  2xm(r iy4alen iciltf 2umxrpno0tlt iociyslm ra( p;t0arxoxf iatfaDeauvilt trtoxo3nodam  lici t) Drauront1oexn fetydlm2rlu s;(0aexoxfciadlaDeln s;s0trxr(rpio1ll emfetls) 2rm(r oo0openiieiyt m um(vs t0arxnmocio1fm eaieo;s)sexmxopoy1oltnliei t) Drm(mooo0ole  o3iatlaDeln p;u4aexrxocio1fmte nvi;(  rumxo3iu4lpenlnvs sfa2tr(r no1texomo3ilsls2rl( s t0texnxo3ty1omteanvo;() 2xm(m3ou4ope mfcslt) Dtrxrpno0tpx  i3tlslmDra(mo t4alxrmr3iatom  ln s;t0 ruo(r oo4ome mnvsl(fa2ua( ont0ape if3iadlm rmuvp;u0arxrmr3ty1oaDeaivil(0teuoxmpoy4al nlfctlsfsrrm(m nu4oex  i3iytlmDem(mp;u4tlenxr ta1fateauvo s  ruoxo3oy1alt livta( s2umx ooo4tptn fetldfaDrmumont)tltoif ta1fateai o;s)srxoxo io1lltnlicia(fsDtr(ro;o1ale iicild a em(mp;(0aexnirctydomD  u olt)trur(o3iu4lpeemivs tf Drmxm ou4olt  fciyt a2ra(vp;t)tlxoxo3tytla r i o t  etoiopnu4llenmfcsas)sDua( pno0tpto i3ilsfa ea( o (0trxrxo oytla  li i;t0srtmir3iu4lpen feilt sDtr(m ot0ape ifeiydlaDrau s t)alerif oadlmtrln ols) ruoim ou1om  mfvtlsf 2uaxrp;t4tltoif3iadls rmuvsnt0trxrxo ta1laD  i s t)t2toir3iydlmenlfviatfartrxm nu0tpx  oetys a ul( s;t)aeenxrcoydom   ues;s)sexmxopnu1amtnmies tfs2rr(mo;u0oeen iciytfmDrmumonu4 eenifctydoaD  nvs;()tetmxrpou1lpt  netl()a2rax ooo0aet mi3iyslm2eaums (4aexnxf oo1fm   iei (  rumir ou1lp  mnetltfaDrrxro;o0aet  ietas s2em(vsnu4trenmoctatopD  uvi s srxrxo3oy1ap  mfvta(  rtrur nu4apxn oetyt m uluvp;(0treoxo iy1fmDelu o t) rur(m nu4aptelfvil()srtm(r nu4tpt iiciltla2rmu p (0alerxrcoadoa ean o ()teuoxo3iy4apenlnvtat) rrmum ;t1tpe  o3iasls ea(vs t4tlxnxf oodfatr nesl(0t2trio ny1lpee icsat s2rmu oot1olt  fciltls umnvp;t)artnmf iodomte n i;(0s2uoimpio1lpen nctls  ruaxmpou1teeoiieiytls2uauvp (4areoio oadom e uvo ( t2xoxopiy4lptnmfvtlsf Dtmxr nt1aex  fciatfmDem(vpnt4 exnxfcoadop eli i t)srtmxmpiydll nmncsat)a2ra(  no0aex  ietydla2emuvsn() rxrxr tydfatrlnvils0setmxm3oydopeelnesat) Dururoot4aexnmf3iad sDelump u)trxomr oydoptrauvilt)s2toio oo1opte ivsa(  2rruronu4alxnioeiyt aDrlnvp;u4 rxoxf3iydomt ln o;(0s2tmxm3iodlp  lneils aDtax o;u1tetnmo3tadlsDrl(ms;u4aetoxrcoa1omt lnvi;t0s2tm(m iy4ape  neilt)aDrmurono4oltoif3tldla rm(vsnu0alxnxr iy1lat li s;t)teumir3ny4lme mneils) rtmxmo;u1oetnioctadlsDulu s u4trxoir3iatfmD  n slt0s2xoxo3no1ale  iei ( srraum nu1tle if3iat a2eln p;(0 etrmfctadomt  u ols0seur(r ou4al nlies ()aDtmxr ou1optnio3iytfaDulums;u4altoxf3iytomteau i ( srtrim3oydolte icsls sDuaxront0altomfeiatls2rmnmont4 ltrmf oytfatrlnvs s  2uo(mpnu1ope  fci t) rtaxrpno0aexomi3iad sDuanvp;u) etrmo iodopte neils) euoio3iu4ol  lfetlt)a2umxrp;o1aexn i3iadla uln onu)artoxo3oy1lmD  iei;( tetr(rpoudlmtemicsa(  Durx o;u4tltomieiydfaDeanvonu4altnxo oo1lmDeli o;s setrxm oo4lmen fei tfsDurum nt0olt  ieiadls2rauvo u0alenmociy1lmDrlnvi s0s2urio oo4ll   fvil()sDrm( oot1opxn ieiltfs uln snt)texriociadopDr nvsls0seur(r nudlm elietasfsrtrxrpot0tle ioetydlm2umnmsnu4 eeoifcoadopDelueo (0seur(m3iudaleelfcsl( arumumono1ale mo3iat s2em( s;t) rtoxf3oadlpDrluvs;t  2xrxo3iu1ole  fes (  Dtru oou0tet ii3ildfa2eaumo;u4 rtoio3to1lm  livsl( tetoxo3no4optn fvi (f 2rrxmo;u1tpto f3tlsla2uau o ()aexoxrciydlptrai s s)srxm(o3iodlmeelfvsl(  2raxrooo1tex  o3tldlm2eluvo t) rtoif ia1la e i sl( teumir3iudamtelncsls srrrxr nu0tleo feiltfsDem( pnu4trenxo oy1omte nvsl()srum(rpoo1lmt mfet s sDtmum ou4tlxo i3tlt a2uauvs;(0altoif3iytfptr ieo;t0srum(opny4apenmfvsls  2umx  ;t1apeo o3iyd a2ra(vo;u) lermf oa1lptr ivo;(0sexr(rpiudopen ivtasfsDtaxrpoo0tpe micildfa ranvpn(4tltomr3oadlpDrlnes (0 2uo(opiudopt  nctltfaDtr( pnu0altomi3tadls em(vs;(4trtrmocoatlmteauvols)texr(opoy4olt livs t aDrmu o;t0tex mictatls ul( o t0tetrmo oytoaDrluvo t t2tm(rpiu4amenmnetl(fa2umxm ;u1alenif3iasfs2umumon() etnxoctotoat lnes s0srurxm3oo4ape mict ( aDtau  nt0alt ifcilsfa2el(vs;u0aetoiocia1lpteaiei;s s2uoiopiudlm nmnct () 2tmurpno0teto ociyd s2rln o;t)aleomr3tydopD au i;t)s2um(rpio1am  mfvsa()srtrxrp;o0ole if3iytfm eluvp;t0aeerxf ty1fmDeliei s  etoxr3iu4lm   fvtl(fsDrmurp;o1apeniictyt s ean o t0trxnmrciydfa  aivol( setrxm iy4omtn net ( sDtm(rpnt4tetnif3tld a raums ()alxoif iotlm   nvo;s)srumio ny1al elictas) Dtmxmpou0tet mfetatlsDranvs;t4aetrmocoy1opD anvi ( t2xrir3iy1ol   fcil( a2uaump;o1tlt  ieiytfs uanvo ()teeniocio1oaD luei;()sexmiopiydolte nvs (farrr(  ;t1tpx  o3ild aDea(ms;t)aexrxrctytfa rau s s0srxoiopoo4al  lncslt srta(  ;t4aet iietytfa rm(mo;()teenmo3tadlateanvo (0 rtoxo3oo1ame lictlt  2rruro;u4tee mfeils s2rau p;t0aetoxfcia1fm  aiei () 2ur(rpnodalte feil(f 2rmxmooo0olto icild aDrmu s u)aeermf3iatfptr u i;() rxmxr3nydape mfvslsf Drmxm nu4tlto f3ildfs2eauvpnt4 lermfctadfaDelivsls  rtmxrpiu4apee nvt s)a2tau p;t4olen oetatfs eln s (4 etnmocootlaDeanes;s0 rur(mpio4olt mncs ()srtmx p;o1alxoioeilsla uau p (4tlxnif iytfmt  ivi;t0teumxmpnodolteliei tf 2rrumpou1alenif3iysfm2rlnvsnu)tleoif oatlpDeaivils)trtmirpiu4altemnvs tfsrua( poo0aexomi3tydla2rmnvp;(4treoir3ootoat  neo;t) 2xoim oy1lmenmfctl( aDrrx o;u4tex mo3iytlsDuaumo;u4 lxomo3ta1oatrluvols)s2xr(r io4am nlicils srtaxro;u0tltn i3iad mDumnmpnt0aexrxociydlmDrli s t) rxoxm3ny1optn nes s sDrm(mpou1aex  fetldlmDemuvont)trxoif ta1fatr ivils0sexrirpoo4lm nlfesa( sruau  ou0apeo iciasls2umu p;u)tetnif3oydlp   uvo;(0s2urxr3ny1opeeliet s)a2trxrpno4aeenifeiytfmDrlnmp () eerxociydfm eauvolt0srxmxmpoo1al e fvils  2urxmp;u1tetn i3tasfs2uanvp u4trtrxr oa1oate ueo ()sexmxm iy4lmt lfct t)s2tmum ;t0aptomf3ils s eaums;u4 exrmr3oy1oaD luvolt0trur(o3nu1apenlivslt arrrx o;o1aexoiictytfa ua(vs;(0alxrif3oadfm  aivo;s0t2xrir3no1amt  net t sDtmxmono4oet  octadfm2ulnvsnu0aeeomf iy1op elivi;(0trtrio3oo4lme lncsas) 2tr(mpno4tltn octytlmDelnmpnu0aeenmr oydfaDe nvi;s0setmxrpnudll nlivtl( srua(rp;t0oexoif3iaslm2eln o u0arxnxo tydfaD  uvi t t2trxo ny1lmeemicta()sDta(rpnt1altomfcias a rm(mp t4tetoxocoa1faDrau o;s)t2xrxr ou4lptn ncias aDrm(ro;t4opxomi3ildla emn p;u)artrxr oydfm r uvi t  rtr(m3oudope livt ()aDrmxmoou4tpt mi3tls s uan o u)tleoxo totomteluvi;s0srurxopoo4ol emncia(  rtmum ot4tlxnmf3iyt sDuauvo u4 rermf oo1fpDraieo s) 2xmxm3oy1ole  nvtltfarrm(m ot0texoiieilslm2rau p;t4teerxf oytlptelnvol()seurxm iy1lm emneiat arum(ro;o0teeniociyt m2ra(mp u0 leomo3todfaDeanes;t  rtm(m oy4lmeelncta() rumumono0oleomi3iltlm2eln p (0alxnmo ty1lpDeaivs;t t2tr(r oodlpenliet s)srum(m ou1apenif3tlt mDuaumo (0tetnmr3ta1lp elu i s)s2uoxr iudalee nvta(  2rm(mont4aeto feiys sDul(vs t)alenxocoodfmteln i;s teur(opiy1amtnlici t) rtax ooo0tltnio3iltls2ulump;(4texoxfcoodlp elnes;t s2trio no1ll  mfesl(f rrmx  ;o1tex mociydls rln pn(4trtrxrcoytlaDr neo ()s2uoir oo4ap e fvi (fsDrrxr ou1apenifeiytfmDumnvo t0 eerxr ty1opDr nvslt)texoxr iu4lme  nvs ( a2tr(moot4teen o3tydfmDeanmon(0areoio3ta1fm e iei (  rxoim3no4ape  ncsat s2tax  oo0apeoifctadlsDrmn p u0 ltnmociy1la e u sls0 2tmxo io4omt lnes t arrmu p;t4tex if3iadlm ean on(4aetrmr iy1omD au s (0sexmxr3iy1alenlfcsasfa2rr(r no4alenmfeias sDemnmpnu0aexnmo oytop   uvol( trtrio oydlm e fet s) rurur ;t0aptoioctyslmDum(mo u) lenifcoodfatrlnvs s)s2tmimpio1am elnvtasfaDrm(r nu4tpxoioeiyslmDelnvp u0aleomr3tydoa rauei s0srtm(rpiu1llt mfci s) Drau pnu4apeoio3ildfmDuanvs;(0altrmocoatfmte n i (0 2tr(o3ny1ome  ict t  2ra(rpou1apenioctytfs2um(vp u0aeeomf iydlaDrluvs;t0setm(opny1opt mfctl( a2taur no4oeeomiciys s2uluvsn(4tleoxo ty1lpD lnvi t sexrim3no4lmt mfes s a2rmx poo4aexomfetydfa uauvpn(4 leoircty1fptrauvils0s2uoxmpnu4aptemfeils  2tm(m ;o4apxomociadfm ulnmont0 rxnxoctytfpDr uvo t)seuo(mpoodamenlnci s s2rruroot4apenmietldlm2ea(mo;t)aeeoxo3oy1fm  livilt  euoxopnydam   ncsl( s2tm(monu0alx  feiys s2eaump (0aetnmf3oytopt aiei;t trtmxo3iu4om   fciatfa2ra(ro;o1tpt io3ilslm2ranvonu4trerxr3todlateaueo;t0texr(r3iy4am nmiet sf 2uaur nt4texomf3iysfm rl(vs u4 eeomf3tatlptr nvolt0 rxoir ou4lptn fctat) Draum ou1oeen oetyt a2el( p;u0alxnxfcoodla ranvsl() 2xmxo oodlltelfes (f rua(m ;u1tpx  ictad s2emn s (4 etoifciydoate ies;t0setmio3ny4alte fvil(fa2tr(ro;o4texo feilsfs ea(vs;u)aetrxr3oa1oaDeaivs (0trtmiopnydlpt lfesl()aDtm(  ;o0aleomiciysfsDumnvs u4texoif3tytomDeauvsl(0trxr(r oodllte ies ()srtrum ;u1tptnmf3iysfs2rln sn(0alerio iy1fa rli i;t  2to(o3ou4lmenmnvi s srtrurpot0olxomi3iydfaDelump;u0aexnio todopDr ivi;(  etm(o3nydomtnlfctatf Dumx o;u0ape if3iad s2umnvon(4aeerir3iy1lat lnvi;t0 rtmxo3io1omtn fctl(fsDumu ont0texomociys a2umuvp;u0alxomocta1op e nesl(0tetrim ou4openmict tfsrtmxm ;t1oexn o3ilsla2el( p;u0arerxo iatfmt aivols0t2urimpnodom  mnct t s2tau o;o4apenmo3iytlm uaumont0aexnxociotlp r nes;t)srum(m nu4om   ncslsf 2tmumpnu0alt  oeiltlmDrauvo (4trxoir3ootoate neo;(  2xoir3iy1lleelncslsf Dta( oou1oltnmo3iytfs ulu ont0tetoxo3tydomD anvs t sexmxr oo4alen fcsa(fa2tmxm ;t1tpxnmfeilsfa um( pn(4trenmo iy1la e uei;s) euoiopoudamtemfvta(  rua( p;t4tlxnio3ilsls ua(mpnu)aeenmo io1latelneil(0t2umxr iu4amen ivtl(fa2raxm ou0tee ifeiyt m uln s;t4 lxriociydfptrlivilt)seuoxopiu4aptnmivta(faDtru  no4tee if3iys m2rl(vsnu4 exnxrciy1oa rliei;t) eto(opnudole licsl(  rum(r ou1apeo icild aDemu s;(4tlxomrcootlpDrauvi s texm(m iydopt mieils sDum( oot1tleoioeiatlmDemnmp;() rxomo3io1laD lues ()trto(rpnudomen ivsat s2ta(m ot0oetnmocildlaDraumonu)treoxf tatoa  aneo;t)seuo(rpoo1op e feilt s2umur ou1teeoii3tltfa2el(ms;(0 eenmr3oytfmDrlu s t teumxr ou4lpt lfesat sruaxmp;u1aex mfeild a el(mp;t)teenmociadopt  nei;t0 2urxrpnu4lleelfvsa( aDrr(mp;o4aptnmfetyslaDran s;t4arenir oo1omt an s (0tetrir3io1altemicsas aDtmuroot4opeo iciltfm uln s;t0tltoio3todlaD  nvo s0teuoim io1aptnmfcsas s2trx ooo4olt if3tas mDean s;(4tleomocty1oa r nvo ()tetmxo oy4ll nlnet () rtaxrono0tlx  ieiytlm2eanms (0teeoif iadlpDelu ils srurxm oudlle mfetat)srtaxm ;t1tptnmocils s2emuvs u4aexnxf iytoa r nvsls)trtrxopoydlm   nvil()srtru pnt1olenmictatfs rlumsnt)texrifcio1lateaues;s0 rto(o3ou1op  mnetatf 2rr( pno1olxnmo3tytfa2rm( on()teeoxf iadopt lnesls  exr(m oo1ol nlfcsa()arrmu ont0aexo fctatfm2ra( ont)aexoxocoo1fa  luvolt0setmxr ny4opee fvs ( s2urxmpnu0alen i3ildlaDem(ms;u0aexnir oatfpD auei t0 rxo(m io4llenmfet s  rumx pno0tpxomfctydfmDua( p t) ltoifctatfmte ues;(0 2xrxopnu4alenlneta(  rra( o;o0tetnioetldfmDumnvpnt0altnxr io1lp   uei;t0t2xrim oodlltelnes s a2ur(mpot1tpx ii3ilsla rm(mon(4tltoxr3oa1lp rluvo t0t2tmim ny1apte nvilsfarraumpnu4tee moeildfa2rlnvpnt4arxrmf3oodopt lu ols0 etm(rpou1ol n ics t aruaxm ot4oet  o3iaslaDeanms (4alerio ia1la elu o;s)sexmir3ou1lpe micsls)sDurxm ;o0tlen o3iadlmDumnms (4arxnxrciatlat an sl(0s2toimpnu1lm emncs ( arrru  ;o1teto o3iaslmDeaumo t0 eenmo3oa1lpDe nes;s sruoxo ou1olen fvslt artmum nt1aeeomoeiyd a2elu sn(4 rxnxo3oodlp   uvolt)t2xo(m iu4llee feil() Dtr(rp;u4alxo ieiadfmDumumonu) renxf3to1fp   i i t0teumxr3iudlp nliviat  rrrxroot1ape  o3tlsls2em(ms u)texrif3io1fm  ai o;( setmiopnu4alt  iei ()s2ur(rpno4oet  o3iydfsDuau p;t) exrxr3ta1lmD ai i;t)trxrirpny4omtemictltf rum(m ;u0ope iietlsfm2raump;(4aetrio ta1lpD aieil( s2toir3oy1lmenmicil(  2rrurpno4tlenmietls s2eluvp;(4 exrmo3iadfptelnes;s)seuoirpou1llenmnvsls sDumxroou1tpx micild a2rmnvo t)alxomo3oa1fptelu s t0s2uoxo iydam nlnci s arrm(  nt4optnioetyd a2ua( p (4trerioctatfmteaueilt trtm(mpiydop nlncils)s2ua(r ou0olxnii3iatfmDemn s (4 rtnxf todlmt lues;(  etoir3no1om e nvia(fs2ua(ronu0aptomoetlsfa2uluvsnt4arxnxf to1opD ai o t)t2xm(opoudam  lfeslt) rumump;t4apeomfcildfa eluvon()alenio tytfptraivo (0 rxmxm3nodll nlnesls)arrmurp;t4opxnifcild s2umn s u4aleoxocoydlmteli slt)setrxm3nu1amtn fesa(farrauronu1aee if3iad s em(vo t) exnmr oydlp eln ols trxoir3nu4lpe mieils)aDrmx pou0oleoioeiysfs ea(mo t) rxnio3iadoaD  n s t srtmir iy4ap emnvi t sDtau p;o0apeomfeiyslmDra(vp () rxrxr oadlp  aueo ( texmxo3io4altemicslt) rumxmpnt1alxnif3tydfm2uau sn(0aetrxr ta1fa eaiei (0seum(opio1lme micil(fs2rm( pnu4oetnmociatlm2eauvs t0alxnmr3iy1oatrlnvils) 2xo(o oo4op eliesat sDtrx ont0opxo ictydls eluvpnu4 lxrxf3oodom   ueo;t)s2umxrpiy4olee icil(fsDurumoot4openifeiyslm ulump t) lxnifcoa1lmtean o;(  exoir iudape lictatfarrrx p;u4opt moetldfaDemump;u0arenif oodfp e uvs;(0 2trim oy1omeelici sf 2um(rpou0opeomfetaslm2ul(von()trxrmf ootlpt  u i t) ruoxr3iu4lp elfvtas)sDumumpno0apen ieiyt s2eau pnu4artoxf iodomD anvilt0srxrirpoudap elfvta( s2ra(  nt1olxnifeilslm2emumo u0 etomr3oytoa eln ilt0truoimpoy1olen ivta( sDtrx oot0oeeo o3iysla2uan s;t4tleomocio1fp r i s;t0t2xo(m3no1omtnlnvsat s2umu pnu4tpx moeilsfaDem(vp;u) lxnxrcoydlp raieilt0 2to(o oodol n fesls  2umurono0tleomictad m2rmnmsn() lxrmr io1lm eluvo t0seto(o3no1lltnlfvslt s2rrxmono0optoiociydls umnmp u)tetnxr to1fmD anes s0 2xrio3iudome  fetas)s2tmu  ;t4tet mieiasfs ranvs u)areoifcoodom  aneslt0 2xrim3oy4al nlivsa(farumxrp;u4ape if3iytls uanmo (4teerxf3iodlat lneo s0trto(r ny1lp e fvta( arrmuronu0tlt iiciaslmDumnmont4texnio oytla r iei;(0s2toio nudapeemfcs t)a2rmx p;o4olxn fetldfa2ean s;u4tlenmrcia1faDrlieo;(0trumiopio1lpt  nei t  Duau oou0tlx iieias sDrl(vsnt)altnmr io1lmt  ueo s0trxrxrpno4ll e fes t) 2urum no1oeenmietatfmDuaumo;(0tltrir oytoaD aneilt0srurxr3no4ll e ivsls  ruru  ;u1texn ociltfaDeaump;u)aleoxf3tytomtrluvolt trtoxr3nu1apeemfet ()aDtaxr ;t1tet iociydfm2elnmo u4trtrir tadlmteau i;( t2tmiopnodlpe lfvslsfs2trxm no4aee mf3tysla2raumsnu0aeeriociotomDrluvo s0texoir oy4ol elfes tfaDrmxrpot1olenmo3iatfs uanmsnt0 ltrif3tatlpDean o s t2xoio3nudole mnvs (  Dra( pou4aetnmoetatfa em( o;t0aetnxf ootlm   n sls trtrio3oy1am e fctls)aDrrum ot1ape  ociadla rmnmsn(4aexrxocoo1la   nvolt0t2uo(m io1olt mfcsa( aDurxm ;u0tptn iciat mDeluvp;t)alerxo iytom eai i s  exmxrpnodlptelnct t  Dtaurp;o0oltn o3ildla ra( s;t0alxrmr totlp eanvo t srtmio nudlpe lnctat sDtrxr oo0ale mfeiyt a2umnvp u4aexnmoctadoa   i i t) etmio io4op emiviat arurxm ;o1ale  fciltfsDuau s t4 ltrif3oo1oaDe nvo;t  2um(o3iu1lm e neia(f rtm(r nt4tetn o3iysfmDeanmon(4 exnmociytlaDrli ilt tetrxo nydope lneil(fsrta(m nt0apto fciadls2ea( s ()aexomf3oydoa  auvs;()t2to(m3oo1omte ieils  rrrxroou4open ociadla ulnmont) rxoxf3ootomDelu s;s) 2umir3oo1lptnmics t  Dta(r ;o0tpxnioetlt s2rmumon(4 exomf oatfmDrlivil( setrxo iudop elncslsfaruax o;u0oleomf3iadfaDuaumpn(0aetrxo3iotfaDeli o;t0 2xoimpiodalt lict t aDtr(mp;t4tle mi3ias s rl(vonu0aexnxociotfpt livs (  2trir3iu1om  lnei sfsrumuroot4tpxniocias aDuau o;t4 exrmo3oa1lmt luesls setoxo3iy4al nlfvs (fsDua( p;u1oetn icildfsDrlnvp;(0tlxoxo to1lmD an o;s truoxopnu1am  lneslt sDurxmp;o1texnmf3iltfs2elnms;(0texomr todlaDraivs;t s2triopoudale lncta()arta(m ;u0tpx mieiadls2umu snt0alxrifciatlpteaues;s) etmxopoy1ol n iei s)artm( pou4texniociatfm raums u4artrmrciotlm   n s s seurxopnodom   fvtat)sDtrxroot0olxoifciyslaDuauvo;t4tleoxfctadla rln ils)t2xm(r3no4ame  ivs t)sDum(rpou4tlt ifetatfa2elnmpnu0 lxomo3ty1fp rlivils0trtm(m ny1amt  fctls)a2rm(  ou0apxoiociatfa eanmp;t4tlxnir ty1op eau o ( srtmim3oudom n ics tf Dumur ou4tpxomoctadfa rln o (4aexoxf oo1lmDr i i ()srumirpoy1olenmivtlsfa2taumo;t0olx io3ilslsDeau o t4aleniocia1lp  lueol(0t2umim iydol  mfcsa( aDuaump;t4teen iciatls uan p;u4arxnmr3iadfpDr ivo t)truoim iy1amtnmfeiat) 2tmx pno0ope mfciltlm ua( o;()trtrmo tatfpDrauvi;(0s2um(r io1omen iviat arrmx pnu0altomocildfs ulu p t4 exoir oodfa rli o;s0 exriopnu4oleeliesls)s2rrur ;o0aet mf3tasfsDuln p u4 rxnmr iydla rauei (0s2xo(m ou4llenmiviltfsDtaxmonu0aexn f3iadlsDuluvonu4 eenmf3iy1oa rlivolt)s2trirpnydop n ictat) Durxrpoo1oeenmieiyslm2umumon(4tlxomf oa1lmtrau i;() eurxm3ou1amtnmnei t)srrrumo;u4apt mociat m rlump u0 rtrmr oytlp eluei;( srxrio oy1ll e fcsa(f rurur oo1altnifeild a uan p (0 exoiocto1fa   n o t) eumim iodomen nvias)a2rmur nt4oexn feiysfm2ea(vo t4 exrxo3iodomDrlnvol(0s2um(r3io4amtnmicsa(fs2tr(mono1tpen f3iyslmDemn o;() lxomo3oa1lpDran o s0s2umxr3iu4omtnmfvtltf 2umx oot1tlxn oeiltlsDel( pnu)trtrif3oy1op elnvilt0 rxmxopoy1altn icils s2rmx  oo4tle  o3tad a2rlump t0 exnmfctydfaD aivi;t0 2xmxmpoo4ale miei (  Duaxmpot4tpenmfeiysls elnmp t) ltoxrcootfaD aneo s)srxmio oy4am nmnvtatfsDuaxmono1aetn o3iat sDem( sn(0 rtoxr3oydfaDe uvs s t2tmiopiydole mnci sfsrtmxm nt0oeeniieiyslaDumnmonu0areoir todlpD  u i ()tetrir3iodapt mnes ()a2urur ;t4oee moctld a2eau p u0tlxomfctydoateau i ()s2urxo no1open nes s)s2urxmoou4oleomi3iydls2um(mp t)trtnxocoodoaDr uesl(0s2umim3oy4lptnlfeslsfaDtax  nt0apto oeias a ranmsn(4tleoxo3iotom eaivo s s2toio3io4lm  lnvtas)s2uaumoou4oltomi3iydlaDranvs u)aexrif3io1fp elues;()s2xoim oodom   nesatfa2tmxmo;u4texnmiciasls rauvs;t)areomr oy1fat li s;t trxr(o3oodoleemictas srur(r ;u0aeeo oetadfs2emuvo;u0tltnif3tydlatelues (0t2um(r iy1ape lieslsf rrmx o;u0apx ifciydfmDum(vs u)aetnxfctydomD li o s texmxo oodll nmneia()s2ur(m oo1ope iieils sDemumonu0 ltoxr iodopD aueilt t2uo(m3oy1am nlnvt ()a2ta( p;o4oltnmfeild s2ulnms u) lerir ty1omDeauesls) rtr(mpoy4lleelncilt)aDtaumoou4tltomietydls2eaumonu4treoio3oadlmDrlivs (0texo(o3iu4lp e fet tf rua( pou1alxnifciasla rmuvs;t) eeoxf3ootomD li o s) 2trimpiudam nmnet tfsrumxr ;u1tlto ictasfm em(ms t) rtomf3oadom rlnvi;(  2ur(o3oydlme lfcsas  rtr(  oo0tlxnmo3iadfaDum(vs u4alenmo oo1fpD lu s;t) etr(o3oodopte fcil()aDrmum ;u4opxoifeiyd s2umuvp;(0trxoio3oadoaDean olt0srurxo3oy4ol n iviatfs2tauront0oltomietltfm umnvo u4 rtrxr iydlaD aies;t0setoiopoodlpen nvs ( a2rmur nt0aptoioetltlm2rmnmp u4texoxf3to1lmDeli il(0s2xo(m3no4opte ieiat)sDurx  ot4tpen f3tat mDem(vp u)aeerircoytlmtr nvo s)srxmimpoy1open ivtl(f rurx onu1tpe iietasfm2rmnmsn(0aeeomrcootom   ivs s texr(opou1ale  ivt ()sDurumooo1opt ifeiad a2raums;t0 ltnxf3tydla ean s ( t2xrim oodal n ivs ()aDrr(ronu1oetn fetldlsDuluvs t)arxrio3iatfptranvs;s0tetrio iu4lpenlfcs tfarta(mo;t0openifeiyd mDumuvo t0artoifctytfp r ivo;t0srtm(mpoo1lp   nctltfs2trxrpou1opt ii3ils m rm( p ()altrxrcootlm  au s;s) 2toxm3iy4ol emncils) rrr(mpot1apenmf3tldls2um(vs (0 etnxociatlp   uvslt srtrxr nodaltelivs sfarra(r ;o0alx iociys sDea(mp u4arxoifcoatom  lnvslt0 eum(rpnu4al nliesa( a2rr(rp;u4aeeo i3tlsfs rl(mo u0 eeomf3tatlmteanei;s)t2tm(m ou4olt lfvta(  Dtmxr ;t0ope iociaslm rluvpn(4 lxoxf oatoatr i i;s0seurir3oy1ap  lfvsa(fs2tm(rpot4oexo i3iltfsDrl( s t0alerxf ootlaDrai ils  rtrir ou1ll e nes t a2trxm ou1oetnmfeiat aDuanmp;u)tltoif3oy1om e nvo;( t2xm(rpoydlpe  ietlsfa2tmxrp;t4opt mi3tldfs2uau p t0tlxnio3to1fpDr neilt s2tmxmpnydal   fesatfs2rax poo4oex  octytlmDrmumsnu4 rxrmf ty1omtranei;t) eto(r3nodomte iei s)aDtm( o;u0olt ifeiydfaDrluvpnt0tetomf3tytfpD  ueo;s)setoir iodaptnmncta(  rumxmp;o1texn i3iatfa2elnvs;t)arerir3totop eau i (0 ruoirpiu4lltnlfet t) Dtru  nt4optn oeiysfm uauvpn(4altrmf3oy1oaD aueil(  euo(rpou4ap  miei (  Dta(monu1oleomfeildfsDemu s;()alxomr3ty1lateanvsl()tetoim3nu4ape mietl(fsrtrur ou4tlx  fciytlm2ulu o;t0arxomfcia1fpDr neo;s  2uoxm3oydlltnmnviat  Dururont0alxniocildfsDea(vsnu0altoxrciytfmt livs;( t2xm(r ou1lp elfvs () rrmu oou4tlxo ictadlm uaumo (4tlerir3todlpDraneo t trtrxm3oodaltn ieta( srraumoot4tlt io3iysfmDuauvpn(0tleomrcia1lpDeauesl()seum(opny4am elfvsl() Dra(  ot4tlxomfeiyslsDelumo;u0 exnxo oo1om  au o ( s2umir no1aleemicilt)srra( ooo1oee if3tytla2ra( o;t)texoxociodlm rluvi s t2toim oo1lpenlfci t arumxro;u0oet  iciasfs2rmnmp u)trxnir3iotfmDran s;t0 2urxo iodllt lict s)srtrxmpot1oee mf3iydfm um( o;t0aeeoifciytfm eai o t tetoio ny1ape miei t) Dum(rono4optoii3iltfmDemnvs;(4arxnmf3tytomteai o;t0srtmxr3oudaptn nvtlsfsrumx pnt4oex  iciyslm2rluvp;()trenxf3ta1fpD  i il( s2xr(r3ny4am elncilsfartmxmp;t4tetoio3tlsfs2rl( on(4tetrxocio1lpDraueil()sexm(m oydam  livilt  2uau oou0aex io3ias m2rmumo (0trerxf ia1la  liesl( t2xoxopoy4lpte ivi () 2ur(moot0tlen o3iytla em(vo;u)aexrxfcoydlateln i t setrxr3iy1al nlfvslt)srum(m no4apxn ieildlm2elnmp;(4 exnxo3oydlpteau olt0 2xmxm3nodapeelnesl( artmum nt0tleomfctas mDrmnvp;(4teenif oo1lm raueo;t0seumxr3nodlm nlietlsf rtmuroou0aexnmfciydlm ulump;t0 rxnir iy1fpD auvs;t0t2toxm iy4alen iei sfsrrm(mo;u0texnifetytfs uluvsn(4 rxnifciy1lm   n o (  etm(m iy4lltemfci t  2rm( ooo0tetoiiciytlsDul(ms t4arxoiocoydlpDr ies s  rtm(r3iudaptemnviatfaDrmx pou1tleo feiaslsDra( snu)alxomocia1op r nvo;t0srto(rpoudamtemiei s srrrur ot4tlxniiciltfsDelumont)aexrif ootomt ai s t texmxr iodol n nciltf rua(r ;u1tetoii3tadfm2ua( p t) ltoxocoytlat  uvslt  2uoxo iu4opeemneilt aDtau  nu4oleoifeiasfa2ean p u4texnif3ootlmD  nvs (0texr(m3iydom nmfetl( s2urxmo;o4oet miciad a rlnvs u)trtnmocoy1lp rauvo;()srxr(rpiy4lpeelnctatf 2trump;u1ape mo3tydla rm( p;t0 eenmr iytlm r ivi;t0s2xr(r3ou4olenlfvtl()s2rax o;o0apeomfcilsfmDemnmo;t4texomf ootoptr nes t0texrxm nodole  nct ( artm( oou0olenmfeiasfs2uauvs;t0 exrir iatlmte neilt  eurxo nu4optemfeil( srtmuront1aeenmoctadla ea( o;t)aexnmrciy1faDe nes (  2xoxr3nu1lltn iei t  Draxmono4tptn ietyt a2rmu pn(0 exoir3to1oateaivs;t0trxmim oodapeelnei (f 2rax  ;u0teeomo3iytlm eanvo (4tlxnxrctydoa rlues () 2tmim3nydol e fvil(farra( p;t4opeoioeiysls rmu o;t4 rtnxo iy1om  auvils) rurxr3nodomtnmfvi (f 2rmxr nt0aexoifeild a2rm(mo t)arxrxocoo1fpD luei s0trurim nydlltemfesasfaDtaxr nu4aex if3iasfmDuaumo;(4 ltomr iatfaDrlnvs;t0srtoxo3iu1ol   ivtlt)aDtmxm nt0tee  ictls a2umn o u0artrxf3iydlaD  neo;()t2um(opnu4am emfvt tf Drm(rpnt4aet mfctydfmDrm(vo;u)areoifcoatomtrlu o;t0srxmxo oy4omee nvs ( aDuru onu1optoii3iys s2ea( p u4tltrifciytopt lues;t  2urxrpnodam  mnvsa(fartrxmoot4oetomoetydlaDeanvpnu0teeomfctatomDr ies;s)s2umim io1altnmnetat aDurx pnu4alen f3iyt a ra(mo (4arenmo3tydoatelivo;t0setriopoydal  mfctlsfsrraxmp;o1tpxo fcildfs um(vo;t)aetoxf3ia1faDrliei;( t2trxo3nodlp   fvi s  rumxmo;o0tptn i3iadla ulnvo;u4tetnxf3tadfmte nvs;s  eur(r3iydopenlncsasf rtr( oou1tet  i3tas mDeln s;t0artoif oodomtelneol(0srtr(o nodlpeemfcia()a2rmxm ou0opx  ieiasfs2ua(mp (4aeenmfciytom rauesl()t2umir3iu1openmfctas  2ra(mo;t4ape  i3tatfmDumuvo (4aeeoio3oa1oa  lieo;t0 2tmxmpny4lleemiciatf rumumpou4tpx ifctyslsDea(mp t0alxoxf io1fm r uvs s0trtr(r3oy4omtemnciatf rrax o;o1aptnioeiysfa emnmont4 exnio iytom  au ols  rxrxm oy4llte nvs t)s2ta(mont4ole  f3iadla2uanvp u0aeeoifciy1la eauvs ()srum(o ou4op elnvia()sDtmu o;o4tetoio3tydlaDemnmp t4aeermocoatlmt  ieils)setoxm3iy1ap n nei tfa2umxmp;u0aetnmi3tasfm2elu o ()tlenif ta1oa e n o s0 2urim3ou4omtemnvtl(  2umx  ;o1ope mfeiydlm umuvp u)tlxomr ia1latr nesls0trumir iydom  lncta(fsDur( o;t4tltnmoetytla elnmp;u4 rxrir to1lpt lu s ()trurxr3ou1optemnesl( arum(mo;o0tpxoiieiatfa eln p;t)aexnir tatfpDeli o s  rtr(m3io1ll nmncilt  Dtrxrpot1aeto feiytlmDranmon(0tetrxr iadla eai olt0 rtr(o ny4ame lfcils a2uaump;o0apx iicias s2emnmo ()arxnxo3ia1om r n o;t t2xoim nudlptnlfet s a2rmuro;t4opxoifeiatfaDrmuvo u4aetnxr oydfa   uvo t s2um(r oodale  fcsasfaDumu ont1alxn i3tad aDua( p (4aetoxr iadfp rlnvs (0srxo(o3oydom  miesltfaDtrump;u0tpt iieildlm ranmont)teeoircoodfaDe ivo s)srto(m iy1lmtn nesasf rraxr no0tpeo fctyd s emnmpnt4arenircoodom rau s s) exm(opnu1om  mfvtas sDtrum ou4tpeo ociltfa2rlnmonu0 eenir io1oa rai i s) ruoir ny4amtemnctl(f Drr(rpnt0oee mfctysfs2umu pn(4aexoircoa1lm rlu ol(  exmir3ny1lmt mnviat artaur oo1tetoiieiadfa rauvp ()alxrmf3iadfp elnvilt0 rumxr oudol nlfct sfsrrm(m nu1aee if3iyt s2emnvont) lenxr3tatomD lneslt)t2urxo3oydamtelnvtasf ruru  nu4alxnmf3ilslsDulu on(4 leoxoctotfatrai s t)tetoxr3oydalte fesl(fs2urur oo1tle if3iasla uauvp;u) reoxfcta1fpD lieol( srumio3no1omtnmfctltfaDraur no0optnmieiadfmDelu p t4 ltnmo3iadlaDrai ol( srtr(r3oo1omt  nci (fartrum no0oee mi3iyslm em( on(4tleoio3todlpDrln s t) etoim3no4aptn fvtl( sDtm(roou0aexn fcils s2em(monu4tlxrxf3iodlaD  nei;( t2tm(r3iy1amenmietlt  rtr(monu0olxo f3iat s2rm( s u0 rtoxrciatlpD  ieo s0 2trxmpoodap elnetatfaDtaurp;u4tpt  ociytlm ul( o;(4tlxomr ootom  lnvo s0teur(mpou4opeemicil() 2tau o;u4aexnif3iadlsDum( s;u4 rermfcto1oa r ueslt)t2um(o3oudlmt lfcia(faDumxr ;o0apxnmietyslm2umnvp;t) eerxr3ty1omtrlnvo s  2umimpno1opt  ics t)srtrur nu1opxnmoctytlm2el(ms ()artrxf3tytomt  i o;() exoxm3io1apen icias)a2rmu oot4ape  f3tls s uauvpnu0tlxnmrciotfa   ies;(  2trir3oo1apt  ivta(fsDtaxmo;t0aex moeiadfa2uluvpnu4artrmoctatop  lu s;s0 rxmxopio1op elnvilt  2uaxr oo0tleoifeilslm2uluvo (4 lxnir3todlp e uvs t) 2urxrpoodal n icsa(  rumxmp;u4tleniieils s ean s;t0 rermf3tytlm ran s;t s2xoim iu4lleelnciat a2rrx o;t1altnifctaslmDrau s;(0 eerxociatom rluvs;() eumio3iydaltn ivslsfsrtax ono4aexoifciyt a ra(vp;u4teenmrcto1fptr u ols0s2urimpoo1llt lncta(fa2ua( o;u4opto oeiysla2ul( on(4arxnmocoy1omtrlneo t)t2tr(opnudaltnmneilt)s2trx  ;t1teenmociys mDumuvp;u)alenxo oa1fm e uei;s)texrxm3nydlp nmies t) 2tau pou4olen i3iatfsDrm(ms;t0 rtnxo oadlp eluvo t s2um(o ny1al elnet (fs2trx  ;u4tpxnifeilsfmDeau ont)artrmocoydfpDe n slt s2xrim3iy4omee fcta(fsrum( p;t4tee  i3iyt s2um(vo;(0 exoif iytfpD ai slt0setr(rpiu4amtnmnvtlt s2raumonu1opx  o3tys m2umnmsnt0aexoxf todlp eaivs;t  etm(opiodalt mnvsls srtmxmpoo0oex iieiytfa umnvs u)texnmr3oa1lateli ils0trxoir nudal nlietlt) 2umu pou4oexomf3iyslmDua(vont0texnmo3tydla   iei;s seurxrpiy4omeelicsls) rrm(mooo0tpx if3tytfaDeanvs;t4 lxnxr iadoa rlieo;t)sexoxr3oo1lmtemictasfsDtaxmpoo1aet ifctytlm2ea(vpnt0 eeomrcoy1fpt  nvi s0t2tm(r3io1lp nlnct tf Draxrp;t0apt iieils a rl(vsnu4 lxrif iodfa eliei;s)truoim iu1am  lncilsf 2trumo;u0opxomieiysla rmumpn() rxoxfciatfatrlnvo ()srxm(o ny1am emnetasf 2urx  oo1aee  f3ils m um( pn()teenxr iatfaDr i o;t)srur(o ny1op elncs sf Dtr(r oo4opxn o3iat m2umnmpnt4aexnxrctytfm  aneils0 2trxr oydome  feils)aDtrumono0aetn ociytfa ra( s u0alxrio3ty1fat livs s)s2tmiopoudaptn ivi ( artaxr ot1alx  oeiat s2umuvsn(0aeerir iy1lp ranvs ()trxoxm3oudol emfetltf rtm( oot1ape ioeiatfmDranvp;t4tleomf3tadfat anvolt0setmxmpiydamtn icia() 2ra( ono0tetomociadfm2um( snu0arenif oytfmtrlu slt0srxoim oodamtelnvtlt)s2uaur oo0ope io3tlslsDean p u)tltrio oatfaDrluvo (0 ruoxo iodamtnlfci ()sDtrxm no0tleomoeiyt m2umuvsn(0trtrxfcoodlatrlnes;t)sexr(m oy4lp nlncsls)aDrrxm ;t4apxomfcils aDumn s (0tlermo3tytfp   u i s sexoxrpoo1apeelncslsfs2rm( p;t1oeeomiciadfsDra( p t0texnio3oodoateaues t  2xm(r io4openmici s)a2rru oot0aeeomiciyslsDulu s ()tetnir iadfaDr u i;s) 2um(rpio1lp   nvtlt aDtau pno4oexn oetaslmDuanmont) rermf3oy1op  aiesls trxo(mpny4ll  lnvtls) Dtaxmpno1oet ioeiysls2ranmpnu)texnir oatoaDe u s s) rxr(m3oo1lpe mfetatfsDur( poo4aeeomoeiasfa2eaumo u)aexrir3tadfmD  u o s0 rtmxm iodolen neils) 2ta( p;t1oeto fciytfmDranmpnt0 rtnxr iatlmteauvi;t teumxmpiy1om  mfvsl( aDtmxmpot0opx  octytfs2rluvo;t4 lxrifctydop e i ols)srxrxopio1lptemfes t a2ta(moot1tlxoiieiysfaDelumo;u)alxoxo3iydfat  i i;s)srto(opiodamenlfci t)aDraumo;u1aee mo3ildla2ran p;t0 rxoxf oodfp  lnvo s0 2ur(m3nudalt licslt)sDrrumono0tpx iieiydfm uaump;u0artrmf ia1omteaivi;s0 eumim3no4apee fciat s2rmxmo;u0aex  ictytfm2umn o ()aexoxo iatfate uvi (0texmxrpiu1optelivs t  2rr(rooo4ape  feiadla emnvo (4trenmo3tatfp rlivols0trxoxmpnodlp elnvsasfs2tmuro;t4ope ioetasfs2rmnvpnt0aeenxr3tytop   nei;()seurimpiy1lpen fciatf Dururpot1ope  ieiltfs2rmnmsnt)trxoifctydlpt auei;t0 etoxr iy1lm e neilt srta(  ;t4aee ii3ilslsDrlnmo;u0aexrmrcoy1lateaivs s)s2tmio3oudlp e feias)a2rmumont1olx iocilsfmDel(vs;()alxnmocoatlp elnvs;()trur(m oodaltnlfeta()sDumur ou1aeen ictyd s el(vpn() leomo iatopt aueil()s2to(o3no4ape lfvtatfa2taxmp;o1oltomo3iat s2ulu sn(0alerif3io1faDeln sl() rxrxr3no1ole  fctatf Draxrpnt0tlto o3iydlmDemums u)texnxo3tadoaDeli i () etoxo3nu1ap n fvsat) 2uau o;o0olt if3ilsfsDrl(von(0artrir ia1lp rai s t0 ruoxm iu4om n iesl( sDrmumoou1opx  i3ias mDuanmo;t) eerircio1om e ieolt t2uoimpoodomt  ivsl( arrr(  ot1tpxoiiciys m eau s t0tetrxf ootfmDeluesls trumxm3nydope  feilsf rtaxmo;o4ape mfcildfs2um(vs u) ltoxr3oydoaD  uesls0srxoxr iydaltelfei sfs2trurpoo0tptoifeiadlm2umnmp;() ltnir3iatfaDr nes;s trxm(opnydopt livs s)s2rrxmono4tpxomf3tltla2rlnvs u4teeomo3iodla ranei;(0 ruoxrpoudllenlietl()arur(rpnu4olxn feiys a2rlnvp;t0artnmo iy1om r ivsl( trtrxo3nudol nlneslt a2uaxro;t0ape mociyt sDra(vp;(0teenio3iatoatrlnvi (0setr(r nodlleemnesas s2ua(m nu1apxo fetyd s2ranvp (0tlenxo3tadfa r ivils) rurxo nudome  neta()sDraumo;t0tlen i3iysfm rln s t4 rxnxf oytfat li o;()teuoxopoudam n nciat)s2umurpou1olxomictyd a emnvo (0texoxfctytfpDr ies;t  rxoio3nudal   nvils)sDtaxrp;o4oeeo f3tasfm eln p;t)tltrxf3to1oat auvsl()sruo(r3ou4lm  mnesa()aDra(  oo4tlxnioeiadla2ea( p (0tetoir totfa  luvil(0 etoxm3iudalee icil(faDurumpoo4ale mo3iysfs rlu on(4texnmoctydoatrau o;t t2xrxrpio1lltemictl( sDrmum oo0aee  ociydlmDrlu pn()tlerir3iodla rlivils)t2um(rpny1ole lfci (  2ua( onu0optomi3iytlsDrln snt0 rtomrcoodfateau o;t)t2xrxopoy1lp   ivtlt)a2urump;o0opx iieilsfm2eanms;t)treomf oo1fa rlnes ()t2tmxm3oydol e ictlt) 2tmxmo;t0olto ociyt m rm(mpn(0tlxrxf3tytfatelivils)sruoio3no4op nmnes ()aruau pnt1apxnmi3iytla2emn p u0 eerio3oa1fpD ai ols0s2xmxr iudllen ici s)aDra(r oo4olxomi3iatla rlump t0tleomo oy1fptrlneo;s0tetr(o ou4oleelnviatfs2tax pnt4tet  fciatls rmnmp u0tlxoxo3iytlp eauvo;t  eurxo3io4ope lfetas)a2tm(rpou0oetoioeiltlmDul(vp;t)artoxo iytlptraneilt0sexoxm oo4al nmfvsl( aDtrum ot1optnmo3iytfa2eaumo;(4trxnxr oo1laDraueols0s2trio iodlpee fei t)aDtaur ;t0olxn i3tatfm2uaumo;t) etoxoctadopteauvo;s)srtmirpoydlpe liesatf Dur(m nt1tpeo ociysfm2eln o t0artrmr3ia1fpt an o ()texm(opiy4lpenmfvtat  2um(mp;o0apt  ieiltfs elu p t)artrxf3tadoa ranei;t) rumxo3iu4apen ncil(fsDra(r ;u4apeo f3tldfm2ulnmpnu0aetrxocoo1opDrli s;s)texr(r oy4olee ictlt)arrru p;t4tpeo fetyd m rlu s;(0trerioctytop rliesls0 2toimpiu1ape mivtl(  rrmx pou1ole io3tytlmDra(mo (4trxoxf iodfpDrliei;(0texr(opiu4altnlfcsat)a2umxmpnu1apeoioctytlsDra(mont0 ltrxoctatfmt lies;t teuoimpnudopt  neiat aDrax pou0apeoiietad sDumuvo t)tetoxo3oo1lp ean o;( sexr(o io4optnmfet tfsruru  ou4alx mfctadla2ulnvont)alerirctadfate ivslt)s2uoio iodlme lnvsl()sDtrump;o1apeo i3tatfa eanvpn(4altoxf3oadlpDe u o;s t2uoxo3iydam  lncils) Drr(monu0tetoiociatfaDrl( s;(0 lerxo ty1laDranvo t0 2trxo oy4lpte ivt s)a2trx o;o1aexoif3tldfaDrm(mo;() rtrmrcoy1om rluvils0 2xo(m io1lle  nvs s sDumu p;u1olx mo3iasla2uanvs u)alenmf iydomt ai o;t)srxmxopnydlm   icilsfs2tmxroou4tptomietyt a eau p (0teenmocoadfm e u sls) 2tmxrpno4oltemfvi s s2tmxrpot1tltn ieilt a emnvo t4 ltrxociotomtrlneo (0t2uoxrpnydaltnmici t  2umxrooo0teto fcildlm2rlu pn()arermfctodlm eluei s t2tm(o3oudlme lnvsls  rrr(mp;u1aexo f3iysfsDel( p;t0 rtnmo to1opDrai ils sexr(mpny1om e ivta()srrau  no0teeomi3ilsla2rlnvp u)tltrmr3iadfmDr ivo;t) 2tm(rpoydll  lict t s2rrur ot4aeenio3ias mDranmo;(4 renmo to1op  ln s;(0 rtoirpoo1oltelfcs sfaDtm(  ot0aeen f3tat s2el(vonu) ltnir3tytfatraueo;t trumirpiydoltnmfct t)sruru ono1teeomoeilsfmDum(ms ()alxnir3ootfatr ieil( s2tm(o oy1lmt liei () 2trxmo;t1apt moeiys aDumuvs u4arxoxr ty1fpte ivs;t seumir iydaltnlnvi s sDtru  nt1apenmfeiatlsDra(mo t0 lerxf3totlat livs (0trtrxr io4am  lnvt ()s2ur(mpno1tptn ieils aDem( p;()tlxnxf ia1lm   u o t0trxo(opio4ol  miesls)a2rrx ont1tpenifciytfm2rlnmsnu0artnxfctodfp rlu ils0 etoirpio1al emnvsl()aDumx  ;u4tpxnio3ildlmDra( o;u0tltniociodfpDrauvi;t)s2xmxr ou1oltnlnvsat)sDumurpno0oee mieilt a umnvonu4 rtnir tadoat ln il(0t2xmxopoo4lpt mfeta(farrmuronu4apt moetlsfs2ea(vs u0trtnmf oo1lpte u ols)s2tr(o oo4om nmics (  2rrump;t1opt micilsls2rauvo;(4aetriocootfptranei s0 etrxrpno1lme  fciat srraxm nt0aexnmoeilt a2rl(mo;(4altnxrctytlm rauei;s0 2xm(mpno4alt mics tfaDumurpot1apx iiciadfs ua(ms (0trerio3tadlaD lnei;(0 etmxm oy1ll emics s) Dtax  nt1apto fciys s2um(vp t)trxomo3oy1fpD aieolt0 2urxr3iu4am  lfcsa( s2uau pnu0oeeoii3iyslaDran ont)altnxocoy1omDrln o;()srum(opny1lmt lietl()s2tax o;t1oet mi3ils mDrmnmo;(0texomf io1latranesl()srtrimpoo4ap nmnei ()artmum ou4aee  ociadfa2rl(mp u) lxrmrciatlp  aivsls trxr(m iy4lmenlncs t)arurxrpou1tetnioeiys m ra(mpnt)tetrxr3iadoa rai ilt0srxoxr nu1ol nmiciatf Dtmump;t0apt  ictadfs um(mo t) reoxo3tytfaDeln il( sexm(mpoydomt lnciasfs2ur(mpot1apxo i3tatla ra(msn()altrxo3ta1omDeaivo t  2xmxr nu4lpt micsl( s2tmurp;u0aee moeiadfa2ea( o;t) renif3oadlpD  uvolt)trxo(o no4ap  mnctlt  2raurpot0aptoif3iydfsDrluvsn() lxnmo3oa1opD an s;(0t2tmxr no1op emfctat)a2um(rp;o0tetomf3ilsfa2eaump;u4trxnifcoatlpDraies;s tetmirpio1ame  fcslt  2uauroou4tltnii3tad mDemu s u0tltnxocoy1fmteliei (0 etrxmpiy4alee nesls)arrmxm ou1oeeo i3tyt a2ea(mp t0 exriocootoa eau slt s2xrxm ny4alte fetls)arumu  oo1apeoifcildlm rlu o;t0 rtnif iadoaD auvsls0seurirpiodome  icils aDrrxmo;u0opxomoeiydls2ea( pnt)trenmrcoadomDr neo;(0s2tm(r3iy4omtnlnct (f Drau p;o0optomieiadla2elu snt0aexrmociytlmDeli o (0 exmxm ny4olt lfvsas) Dtmxmoou1opxnifciatfa2rmuvs (4 lxnxfcoo1fpDr ivi ( sexr(m ny1al  liesa()sruaxmo;t0ope mf3ilsfm2ranmo;(4aeeoxfciy1lmD an o;t)s2uo(r ou4lpt  nesasf Dtrum ou0texomo3ilt s2umnvp u0 lxomr3tadlmte n s s0s2tmir io4olt lictat)sDtaxmonu0apt ifeiyt m2emump;t4tetnio3tadlp  luvolt)truo(o no4am nmnctl()srtm(ronu0oexo fctytlmDemn pnt0alxoxfctodoaDr ivo;s trtmirpiydal  lneilsfsDurxmp;u0tlxn ieiad a umnvont0teenif3iadfpD lneo;(0 rxrxm io1olee iei t)s2trxmo;t0tpxoif3tadlaDemu p u4 rtomf tydopDeli o s)texm(mpiu1lme  neta(fa2urx  no1aexnii3tatls2emumo (0trenmo3iadlaDelu i;s0 rxmxo oydapeemfei ()sDuaurpou4optnioetlsla umnvon(4trtnxociotom e uei ( s2trxrpiydom   nctlt  2ur(m ;u0tlx  ociydfm rau snt4texniocoytlp r nvolt tetrxm3iy1amt  iciat)artrum ot4tpx mo3tatlsDrl( p;u4tltnir oodoat auvsls) exmiopny4open nviat sDtau o;t1alx  iciat a ul( ont0texomf3oytomt  ivsl(0 etrio nodllen fvtasfarumx o;t4aetn octyslm ulnmp t0aeenif3tytfmt lu i;( srtoxmpnydlmtemieia(  Drrxrp;t1tlt mfeiasfa2ulnvonu)arenmo iotlpDelneil(0t2xoxrpny1lmte ietls  2ta(mp;u1oexniiciad s rau pnt0 etrifcta1opD aivo s  eurim3nu1amtnlivsas)artm(rpno0tptnioeildfmDrm(mpn(4trxrif3tydfpDrauvs;( seur(m3ou4opeelnctl(f Drmxrpot1tetnmo3iatlsDuluvp;(0aeerif3iatopt anes t0setoxm3iy1omenlnvilt) Dumxrpot1alt ioeiyslmDuluvp;(0 exnxr oodlptrlieol(0 2uoxo3oydll emici t a2raur ;o4opt iieiasfaDemnmp ()altrxrcoydfm  luei;t  etrxmpio1ale  nvtls  rtaxront0teto ocildfsDeauvs;t) eerxr3iodfmt livo (  exrim iu1apenlfei sf 2rm(m nu4opeomf3tadlaDemnmo;u0aetomr iadop  l
\ No newline at end of file
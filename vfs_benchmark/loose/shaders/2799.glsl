@@ -0,0 +1 @@
+ies t) 2urirpno1lm  mieslsfsDtaumpoo0oexnmiciatlmDrmnvsn(4 lermfciydomD  nvo () exoim iy4ap nmnet tfa2raumont0ale ifeias m2rl( snu0 reoir3iydoateau i t0 rxrir nydlpee nesasfsrumuront4aptoiieild s2rmnmsnt0 ltrio todfm e i s s) rtmxopnodom nlieslt)srtrx  no1oexnmi3tysls uln pnu0 lermr oytfate uei s0seurxopoodlm nmnctl(fsrtr(moot4tltoiieiytfm elums t4alxniocoydlp r nvslt s2toir oo1lleelici s s2taumpnu1oltnmfeiys s2rl(vo;t)alxnxrciotfm r uei s0teto(r oy1lm e fcilsfa2trxmp;t4opxnmf3tas m elumo;()treoxfctotlaDe uvo;s0srumxr3iudaltn icta() 2taurpno1tee mociad s2raumsn() exnxf ootoa   nesl(0 etr(r3no1al e ncsl() 2um(rpoo0apen feias s raums;(4altnxr3iotfmDeliei;t0teurirpiydal e ivia( artauroou4aptnii3iytlaDranmo (4alxomo iodfaD lnes;t trxrio nu4op emnesat) Durx  oo0olx ii3iasfa eanmo;u0 eeomf3ta1omtean o;()s2urim no4om nmictl(  Dumur oo4aetnii3iytlaDumumsnt0alxnxrcoytfmt  nes;s0tetrirpny4alen fvsl( a2rmu ooo0aet moeiys sDranvs (4aeerxf3to1lptrlueo () rxm(m io4llen netas)sDtmxrp;o1altnmf3ildfs ul( pnt) lxrmr3ta1lmDelu i s  etrir3iudomenmnvtas)a2rr(mpou0oexomf3tls s rm(mpnu)arermr3oa1fmt an s t seuo(o iu1omtnlnes t)aDumxmp;t1aleoiociydfm umu p t4teerxo ta1opDrli s;t)t2to(m3ou1opee ici s s2ur(m nu4aetomoeiytfs um(msnu0trxrmr iodop rluvs ( trtoio3nydom n ivsa()s2um(r ;t4olxnmiciaslm uanmsnt4teeoircoy1opteanvs t0 2umimpoudlptnmiei t s2ururpoo0optomictadfa2uln o;(4 lxrifciytfpt anei s seumiopoydamenmfctasf 2trxm ot1olxnmi3tysla emu o (0tetnio oytom r u s s0 2xm(o iodll  lnvsasf 2tm(mp;o0opxnif3tad m ea(vo u0 exomfctotlptelivs t seuo(opnu4apenmncsat) rraxrpou4apxnif3iat s2rlu snu4trxoifctodlm eln o s)t2xo(m3oudole  ies t) rrrxrp;u4aetn ietad sDeauvp;()trxnif tadlpt lnei;s0setmimpny4amt  ncsa(f 2rm(  nt4tleomfeiydfs ulnvpn()trxrmr3tydlm rlu s (  rto(r3nu4lme  net s sruru  nt0open fetydlaDel( s;u0arxomrctytoateanvol()setoio3ou4ol elnvias)s2ur(rpou0opxnio3ild s ean o;u0aetrxf3iadfaDe n sls0 2ur(mpiudolt  fctat arraurp;u4alxn o3tyd sDelu s u4aexnxf todfpt au s;t0srtoxrpnu1omen nei s aDtrumoot0apx  o3iad mDra( snt)alerxr3ootla  aneil(0t2trxmpnu1al e ictas a2tmur ;t1oeenioeiytlm2emumonu0trerif iatomD lnes;(0srxrimpoydaltn ncs t)aDumumooo1olt  octysls rl(vs;t0tetnmfciatoaD auvs;s  rxmio3io4ape mncil( aDraxrpot1oee mfcildla elnvs (4aetoxocoytlptrln ols s2tmir nudamenlfvia(f rur( poo0tlxnmf3iatfm eanvs;t) lermrcoodoate uvi;t trtmim3iudam e fes ()sDua( oou0aleoifctysfsDem( pnt0 etoxociatomD  iesls)trurxm iy4ale lnctas)sDta(rp;o4olt  f3ilsfaDel( ont0arxnio iy1oateaues;s)s2to(o io4al   fet () Dtaumpou1tpxomf3iytlmDulu o (4trxoif iatfat aiesls)setmxo3no4ol nlivtas  2uaumono1aee iietaslaDrlu p;u) exnmo3iatfpDelu i;(0trxm(opny1lpe mncia()s2tau o;u4tee  o3iytfm2umnmon(0aexoir oytfp rauvi () ruoim3oydolte fcias) Dtrxront4tpxo ociytla2ra(ms;t0aetrir3oy1lmDean o t srxr(rpoudll   fvi t arrm(m oo4teen o3iys s2um( o u4aeenxrcoo1fa r uei ()truo(m3nu4am elivsasfs2raurooo0aptnioeiysfa rm(vo t0 lxrif3iytla r nvo;()t2urir3ou4am e ncs t)sDra( p;o1opxnmi3iydlmDrm(vp t4arenifciotlatran s;(0s2toim3oo1oltemies tf rtaxrpnu4tex ioeiat m2el( snt4aetoxocty1lat ln i;t0 2xmxo3oydolen icsas)aDurx o;u0aexoio3tas aDul( ont)tlxoif3totopD  ieo;t)srurxr3ny1aptn ivtl(  2umumpnt1oexo feiasls2ul(mp;t4 reoxf oo1fat  u slt0seuo(opiu4omt lnvt tf 2ra(mpno4aet  f3tysfa umu o;t0alenircoadoa e n i;(0 2uriopiu4lpeemfcsl()a2tm(m ;u4olxn ocilsls2rmn s u4alenmf3tatoatranei s) exoim3nu4al nlnct t  rrauroot1oleoifeiyt m2rlu o;(0tltrircoydlp  auvslt)t2xmim oo4optn net ( aDraxro;t1oex mociytla2umnvs u4texnmociodfa rauvsl() 2tr(m io1alen feta()artru poo1tex mo3iat m ulnmsnt0aexoxocoytfm r i s t0 rxmio3nu4opte fet ( arrrumo;o0tet mietat mDeaums (4 renmf oadoa eliei;(0t2um(m ny1omt  fcslt) rur(r ;u4oexn f3ils sDulumo;()trenxf3tydfpte ieo;() 2umir3ou1lp  lietl()aDrmxr nu0aex iiciadfa2ra( p;t4artnmf3io1opD lnvo s0s2xr(o iy4optn fcs tfsrumx pno1oex  oetat s2ulu pn(4trtoio3to1lpteau ilt)s2umim3oo4lpee fciatf Dum(mpnt4alxnmociasls rmnmon(0 eeoir3ty1opDr uvilt0s2uoir3ny1apt livtasf 2tmxm ;u4olen i3iys a uaump t4tlxrxr3io1oaDr ies s) rtr(m oo4alt liet tf ruax o;t1aee mf3iasla2uau ont4 leoir to1fateaivi t0t2xmxmpoo1amte ivsa(fs2trurpot4tlx  oetatfa elnvsnu4 rtrmo3totfat lues;t0srxr(opoo1om emiet (fa2rmu onu1olxomi3iyslm ea(vpnt0aexoxf3tytlmDrlnvol()tetoio3oodam emicias a2uru  ;u1tpt  oeiytls2rm(von(0trtomfctotom eliei t)s2toxr nydol   icsls)s2rmxmont4tpenio3tysfa2ra(von()aeerxr oo1lmtrai i;t)s2umir3oo4apt mict (farrruronu4oexomfeiytfmDumn ont4treoir3totoat  uvil(  etrxm3iodlm  mfei (f 2rmumoou0apx io3tys m2rluvpnt4trtnxfctydla raivi (0 eumxo3iydopeemfvt s)aDraumpoo4tlx  iciyt sDelu o t4aeermf3tydfat  i o (0 rtrxrpoydape  fct tf Dtmx p;t4texn fetatfm2ul(mon(4tlxnir oadopt  nvols) rumxo3no4llte ivia(  2rm(mpnu1oetnioeiltlaDran on(0aexnmf iadoatr ueol( seum(r3oo1amtelieslsf rrmxrp;t0aex ioeiys m2el(vp (4artoirciatoatraivi;(0 etoim io4lle lnetl(fsDua(rp;t4apx io3tydfa2em(vs;t0teenmr3iy1lm elu i s srxm(m3no4amtnlncil()sDtaxrpnu4tleo octat s2rlnmsnt4arerxf3ta1fpDranes;t0sexr(o ou1omtemfet sf Dtmxmp;t0aeenmoetyd m raums (4tleoxf3ia1latrlu s;( s2tmxopnu4lm elict s) 2uauroou0aetomo3iadfsDeanvp t0 lxoxrciytlpDr ivols) 2um(r3no1om elfcia()arumu o;o4oexomoetyd aDul(vs;u0tltoio ia1oaDranvsl(0seumir3nodamtelncs s)aDraumpnt4ope mf3iad m2ua(vo u4aeenifcta1lpD livs s0 etm(o iu4amt lfcils)srtr( ooo1tle  iciaslmDrauvpnt0altrxr oy1la rlieils0trxrxmpny1op   ivia(f rurxm nt0opt mo3iysla ul(vs () eenxf ty1faD lueilt) rxrxr nodlm nmies s)a2rr(r no0texo o3iltfaDulnmo u)arxoir oydfpteau ol(0teur(r3iy4opt  fcsltfsDumx pnu1tpe ifciysfmDeaums;t)tltrmoctodlmt lues;(0srtm(o3ou1oltnlnet t)aDraxmpot0tltn i3iytfsDeln pnu) leoiociydfmt li il()t2xrxm3iodop  lnct t a2raxmpnu4oexo i3tysfa2umnvon(4teerxo3io1fp  an o (  etmimpnudlm n fvs () 2ur(m ;u4alt mieias m2rau s;(0aeerir ty1fpteliei ()trurim io1amen ncsl(f Dtmumo;u0olx iietyt aDulu on(0 ltomr3todlmDr u i (0sexriopoo4aptnlfeta(farrm(rpoo1tpxn oeiaslmDel( p u4tltriocoy1fmDrau ol( t2trimpiy1am e fet s s2um( ont0apt  fcilsfm rmu p (4alxoir3io1lp e ivs t0s2xr(o3nydllenmiet sfa2rmumpno0teeoii3iyt sDea( p (4arxnioctytlmDran i;s0t2umxopoydlmte ivilt srra( oot0tleomoetas m uauvp;(0aleoir3todomDrauvil() 2tm(o oydome mnesa(  2ua(ronu1ole  ieilsfa2eaump u4tltnir3io1fp eanvo;t0seuoxopiu1amtnlneiat arumx  ;t4alxnmf3iltlmDrmnvp u0trxomf oy1fp r ieo (0t2xo(rpiydlmee fcs ( aruaxro;u0olto i3ilt s2el( o t4tetnxocoodfptrlueols  rurxopiodamtnmieil(f 2tm(m nt0apeniiciatla2raumo;(4aleoxf3tytlmteanvo;(0 2tmxrpou1openlfcs tfsDua(mpno0apxnifcilsfs2ua( s;()artnmr3oytom eauvs ( t2uoiopny1al   ieias  2rrxr no0olenmfciltfs2rln on(4arerircoydoa   i ilt)t2xo(mpio1lme lnctat)srtrumpno0optomoetys sDeauvpnt)aetnxfcty1om  aues ( sruoxo3oo1lpeelfeiatf Dtrumo;u1tptnioeils m rm(vs;u) lxrxf3ootlaDr n s;s0s2xmxm ny1op e ncs ()a2rrum ;u0tpe mi3iad sDuanvp;(0tltnio oadfm eln ilt  2xmio3io4omee iciat  Dtr(m oo4alt iicias s2el(mont) ltrirciytfmDr n i;s srxm(o ou4ll  mncil( srta(mp;u4open oetytlm ua( o (0 eenircia1omD  neil() ruo(mpny4lltnlncia( srrru o;u4tpx  i3tas aDulnvp;t)aexnxr3oydopDr n slt0srxoxm3iu4llt lneia()aDrmxrpou4oeeo i3ils m rmuvs t0teerio3ty1opt au ols)trxoio iydaptelnvtas srrrxm ;o0olen i3ias s2emumo;t0 rtrxf3iy1fatr uvi;() 2urxopou1op nmncsat) rtmxm no4tet moeiatla uluvp;(4 rtrirciydomt lu s s0texoir oodomtemnvsltfaDurxrpot0oet mictldfaDrau p (0 ltnio oo1oaD  nvo ()srxm(rpno4apenmfci (  Duax  ot4opeo octld m2ra(monu) exrxo iotfm   n ols) rtoxr3oodlmeelfvsl( sDurx p;t4tlto fctydfa ulnvonu) exnxo iadfatrln i;t  2urxo iu1lmt  nes sfsDrmu pnt4tleo octlsla2rmumo;()tltnxrctadfat aivo;s0 exm(opoudape mncilt)sDraumonu0aet ioeiadla2uanmonu0 rxnmf oa1fm   uvi s t2xr(m3io4llt  ivi s  rrau p;u4apeomictytfs umu s t0 exrio3iatop rauesl()t2umxmpoydole mnetltfaDumxmo;o0ope  fcilsfaDrm(vp t4trtoxo3tadfaD au o;t0 ruoxo3ou4alt livslt)arrmump;t1oet  ieiadlmDumu p u)tleoioctodlp   nesls0 2ur(r iydlp   ivsas)sDrr( pou1altnii3iad m ran on(4 eerxf3oa1optelivi ( srxmir nudam e fvta()s2rrx  ot1optomi3iyt aDumnvs;u) rermr oodlmtranvsl() exm(r3nudop  mfetasf rrr(rp;t4apen ociatfm elumo;()artnmociytom ranes t)s2tr(m3nu4alt lneilt)artm( ont0opt mfctysfm2rl(mo;u0tltnir3oatfm   i o s  etm(mpny4alt  ncsls)aDumx  ot1ale micilt s2emn o;()aeeomf3oo1laDr neo;s0t2toio iy4optn ietas)aDtm(mpno0oleoii3tytfmDua( s u0tltnir3todomDelivo s0 2uoio iodam   fvta(f Dtr(m ;o4tpe  o3iltla um( s;t4 lxomociatfaD auvo;()texmio3oy1lmtelnctat aDtruroot0ale ii3ildfs umuvonu) lenmociydfmDrlu o t0 exmxr3iu4omtemivilt)sDtr(mono1oltoioeiyd sDemn p;u0 lermo todomt lnvslt  rxrxm3io1lpt lfvsa(fsrum( p;u4oee  ictldla2um( pn(0texnxrcootfm  lneilt)t2uriopiu4omtnmncil(fartau  ;u0olxniocildlm2elu o t)tlerxrctotopD  nvsls0 2xm(o oodape lneilsfsDrrx  oo4alt mociadfa eanvp u0 renmoctatoaDe u sl() eumxm3iudlp n fes tfsrrr(m ou1oexomoeiytls2rln s;t)altoxr3ta1lmDrlueo;t  rtmxopoo4lm nmivs tfs2rr( onu1aexoii3tltlm uaumo u0 lenir3oa1fptelieo ()t2toir3nu4lmtemfvias)sDuaumo;t1oltnmoeiytfs rl(vs;(4 lxrircio1lp eluvo;(0 2uoxm oy1om n fcsltfsrtrur ot1oee ioctldlm eaump;t4trtoif3oy1oatranvo (0tetm(m3iy1lptn fciat)artaurooo4aptoif3ilslaDumnvp (0tlxnio iy1lpDe u o;t0srtoxr3oudlme mncsl() rumxr ;o0oeenioeilsfaDeaump t0tltnxo3oadfm  li s;s  2trirpoo1llenlnetatfsDuau pnu1olxoifeilsfm2ulumsnu) rerxo3to1faDeln s t) euoxmpiudolen feilt a2tax  ;t0oeenii3iat aDeluvsnt4arxnir3tatfmt lu i;s s2xoio oydalee fesa(fsrumxrooo0opxnifetadfa2rm( sn() exrmr oodop r u i (0 rtmimpny1lpe  ietls aDra(mpoo4texn ietld sDranvo;u4artoxfcoydlm rai s t seumimpoy1olenlfvt s sDtrxmo;t0ope if3iydlsDuanvo t) exnxrcty1faDeauvi t) rxoimpio4oltnmicilt aDrmu p;t1oetnioctltlm2rln o;()tetnmocoatfm ranvols)t2urxopoo1op  mfcsls s2rax  ;t0tleo ietldfm ranmo;t4aexrxoctadfat  u s;t0 2trxm ou1ll  lfes tf rrr( ont0altn iciytfsDua(vo;u)aexoxr oadom  aivolt) rxmxr3ou4ape lnctlt  2rm(  nu4tetn fciltfm uauvs t0texoiocia1lmt  nvils0srumxr3iydlmenlies tfsrra(m ;t0tee mo3iytlsDulumo;()trenxo3tytfpt ai o ()texm(opnodol nmietas) Drau poo1alxnmocias aDea(mo;t4trtrircootlpt lnvi;s)s2xrio iudoleelnviasfsrrr(mpou4apenmf3iysfaDem(ms u)tlenmr3oa1oat luvsls)srtrxr3nu1lmenlnctls  rtrxroou0apxn ictadls2eanvonu0aexoir3oy1op  lu o s  2xrir nodol  micsl(f 2raxrp;t4oeen oeiytlaDelu s;t)alxnxf3iodoaDelies;s  2um(m oy4altemfesl() Dtax  ;u1aleomietydfsDul( on(4alxnif ia1omD aueil() rxoio iu4op nlncia()srrm(mpnt4apx ii3iltlmDrln onu)tetrxf iy1opD lues;t s2tm(opno1optnmnet tfsDrrxmonu0tpto ieiasfaDul( o;t)texnioctodop elnvi (0 exm(mpnudopt mivsa(f Draxm ou1ape  fciltlm2um(ms;u4 renxocta1fatrln s;(0 exo(mpnudlpe lncslt)srrmxm ou4oexo i3iaslmDelnmp;(4trtrxfcoodfaD  uvolt) 2trir nudoptn ncta(  2umxmpnu1tle mf3iydfm2rlu s;t)teerxr tadlpD lueols)t2urim3oy4am e fcslt) Dumxmp;o0aexomfeildfs2rmuvp t0 exomfcia1oa ean il()texrio oydamt lfctl(faDuaxm nu0oeenmfctys sDua(vont4 rxnxo3iydlptraivs (0truo(o iudaleelfei s) rra(ronu0apenif3iysfs ra(vp t4altnmf3oa1omD  nvi s)s2to(opou1alt lietl( srrm(  ou4tlt if3tas m rm(msnu)tltnif oatlaDrlieolt0trur(r oy1aleemnctlt  2raxrpot4aexoiietltlmDeluvont0 leomr tatomtr nvs;()s2xo(o3oudap  mnvs t  rrrxr ou1oex  f3iltla umuvs;()texrxo tadoptrln sls setoxm3iy1lpe  ictasfaDtrxrpou4tpxniiciyd a rm(mp;u0areoxr3iotlmt livo ( trto(o3no1openmivtat a2ta(root0opt moctyd s2rm( p t4 rxnmo io1fptraneol( t2umxopnudolt mieilt sDum(r nu0tlenmo3ilsla2emumo;()teenxf tadfm r i olt)tetoxm3iydomeelfvt ()a2rrumo;t0openif3tatlaDemnvpnt4arxnxf oadomDran s s)sexm(m nodome lfvs s) 2rrur ;u0tltn o3tytla ra( s u)altrxr3iydlaDr uvo ( setoxr3no4lle  fet s)aDumx  ;u1opeomo3iydfsDea( onu4aleomociy1fmteau o s  2tr(r3oo4lpte ivil(faDtmu ont0oltomiciyt mDemumo t) exoxr3oydoaDelnei (0t2xmiopiudlpeemietas  Dumxrpnt1optoif3iatlsDra(von(0 ltrxrcoo1omte ivolt0sruoxr ny1lpeemnci ()s2um( p;t4apeomo3iasfa2rmnms;(0 exomf3iodlmD anvs;s) 2trxopnodole mfesas srtaurpot4oexnioctasfs2emu ont) reoio tydfmt livi t trxm(m3no4lp  mnvsat aDtmx pnt1teeoif3ildfs um(mo;(0aetomf3todlaDe u i ()s2toxo iydop e ivtl(fsrtmx  no1tee ii3iysfs uluvsnt4arenxr iotfateaues;s0s2xo(mpoodlme lfciasf Dtax pnu4tet iocilsls2ean snu4artoirctodfaD ln ol(  2xm(mpiudlme lnvs ( srrr(r oo0tlx mi3tldlmDuluvp;t4 lxnir3tydomt lnvi t)trtriopnu1ol e fvsat aDumum ;u0aexnmiciydfsDumnvsn(4 lermf oo1fmte n ol() eur(m oy4olt lnes s arrr(rpot4alenio3tltfa2ra(mp t0alenmf3oodfp   nei;s seuoxo ou4omt  ieslsfa2taurp;o4tpeo i3ilslmDrmnvs (0tlxrxf iydomDr uvsl() 2um(o3oy1ome  iesat) 2tmxmonu0aex mieilsfaDum(mp u) rtrircoo1oatelivo;(0t2xr(r ou1olenlics t) rtrurpno1tleomf3iatls el( sn() ltnmrctydfpt  uvi;t0trtm(o ou1oltemnes (faDur(r ot1tetomoctld aDumu pnt4 etnmo3ta1omtelueo;t s2xrxmpoy4amee neilt)sDtmuro;o0oleo ictldla2rluvo;() rxoif3ty1fpteliei;t  euoxr3oy1ol nlnctatf rtrxr nt0tpx ifciatla2rmnmo t) rxrmf tydfmt au o (0trxoxr iu4om  lfcta(  Dtrxrpnu1apxn ociysla eanmsn(0 eenmf tytlat livi s)trurxr3ou1llt lncslt a2rr(r nu1aexo o3tlt aDrln snt4aleoif3ootoa eau slt  2umir3oo4al emiei (fs2urx pnt0tlen feildlmDumumonu4aexoxo3totoaDeaneil(  rtmio oo1omtnmnvtlt)artm( o;u4opxo ictlslm eau o;(0 ltnif3iy1oa e n s;(  rtmio io1lle liei s)aDuaur nu4oexnmf3iys s rmn pn(4altrircoo1fa  luvi;(0sexr(rpoy1ll eliet s) rtax  ;t4oeenmoctatfs eau s u)aetnmf oo1lp   uesls) rum(o3iy1lptn fcsls)arrax ono4aptoiietlt mDulnvsnu0texoio3iotop e nvi;s  rtmio3oy1lm elncsl() Duaxrooo0aex  f3iat s ranvs (0arxnircoatoaD au o t0srurim3no4ll elietlt aDtmuroot4ale  octld s2em( p ()aetnir ootfpt  ues;( srumxo oydlmtemncil( aruax pnt4texomietlsfm rlnmo;t)aexrxo ia1lmDelues t0srtoxr nu4lmt mfei t)aDtaur nt0oex ifeiasfm emnmpn(4aeermf3oa1fpD aneo t  2tmxopiudalenmfeias)sDrrxr ot4tex mi3tysla2uan snu)altnif3ta1opte ieilt)s2xrxm3io1ol n feslt) rrmxro;o0tpxnmociasfa2ean o t0tlxoif3tatoptranesl( t2toir3iy1amte icias)srua(rpnu1aptomiciaslsDrm(mp u4 exomr3to1lmD lnvils) 2xrxo3ny4lm nmncslsfaDtrx oot1oexo fciyt a emnvs;()tltomocoadomteln ol()s2to(m3ny1omee net tfartaurono4opx moctytlaDul(mont0 leomr iadoa elneilt0 2tr(opiy4am n icilt  Durx  no0aptoio3tys sDean o t)aeermo iotlptr nvo;( srtrirpno4lmee fcta()srraxmpnt4aet ii3iytfa ea(ms;u)treoifcto1lpt  n ols s2to(opnodome lnvsas a2ta(m ou1oeen i3tydfs um(vs t)aetnxfcto1lpt  nvi;s0 rurxrpiudlleelneias sDrmx  ot4ale mfetydfaDean s;(4aeeoxrcia1fpDr ivo;s)trto(r iu1opeemici t)aDtrum ou4opeoioctldfa2um(vo u4artnif todlmtr ivo t seuoio3ny4op nmfci t aDrmurono0tpe  ietldfa rm(mpnu4 lenir3oa1lptrln o s  rtrio3nudlp  lfvils)arra(rpno1tpxo f3iltfa2rmnmpn() rtrio3iadopDeluvo (0 ruoiopnydlpeelics ()s2uax  no0tlt ii3ias a2ul( o;(4tetnmo totlaDrlieo s0 2tmiopny4llenmnvt t s2tmxmpou1apx if3ils aDrlnmont) ltomo3iodfm rlueol(0seurxr3oydameemiei sfa2tm(mpno4tpto o3iad m uanvpnt)artomo tytfatelnvo s t2uoim3iodopeelfvtls sDtmu pot1tetomfcilsfa elnmp;u0artoif3iodfm raivo t0s2xoimpoo4olee nciatfs2rruroot1oetnii3iltla2ra( snt)trenioctodlaDeauei (0 2uo(m3no1op   ict t) 2trxmp;u1altomfciysfsDumu p (4tlenir3iydlmDr nvs;s0seuo(r oy1omee nvil(fsDumxm ;o4texnioctadfmDeaumo t4alerirciytfp  luvols)s2xoxm ny1lle lncias)s2uaum oo4oex  fciatls rmu o t4 reoxfctatoat ai o;s trtoio oudomtnlnet s aDtaxroot1aetnioctas m2uanmsnt)alxnxf oadlaDelivol()setmir iodllt mfvt (fs2umx onu4apt  f3iysfs ua(msnt)aetrirctatfp  ln o;t)trto(r3iodom n ncsl(f rtm(m ;t0oexn ieiydla eauvs (4 lxnioctodom e neo;t  2triopou4apee netasf Dtrump;o0opxn f3tys a rau p t0arermf iodomteln ilt0trum(m no1ol nlfcs (  Dumu  ot1oetn octaslsDrlu pnu4trtoioctatfm eai o;t0 rtoxm3nu1ol e ivta(  ruau  ot4openmo3iysfs2ul(vo t)tetrmr3iydlm rauvilt trxmiopoo4am  mfeiat srtaxrpnt0opxoiieiasfa2em( p;() lxomocia1om rlivs;(  2tm(r ou4ol  lnctltfs2ua(monu0apeo octld aDrm( snu)arxrxo ia1lpDe ueilt) rtoir oo4lm n icia(f 2trur nt1ape mf3iatfmDel(vo u)alxoif oy1oa e uvs (0sexoxrpnudolt  ncs t  2ra( ono4aeen ieiytfsDua(mont4alxoxf3tytfa  aieo;s  rur(r iu1apeelnvt sf ruaxmo;u1olenifetas aDem( p (4areomo3ta1latelues s0t2xrxo oo1llt mncsl( sruaxmp;u0opt  f3iyt m umu pn() eenio3ty1lp  ai o t trtrir3oy1omt mnct s)aDrrurpot4opxomicild mDrmums;()aexnmocoatlmDelueilt0trxr(opoydllt mivt ()aDrrxmp;o4apxo fctys m2eau sn(4alxomo3oodfaD ln s s s2xrir3oy4ap   iesasf 2tau  ;u4aptoii3tasfs2eln o;u)tetrioctydfp rlnvi;s0s2tmxr nudlmenmiciltf Dumuro;u0texnmicilsfa emn s;u4alenmf tatoaDe i i;s0s2um(m3ny1opt lfetlt) Dtmxrp;u4oetnmi3iaslm2ul( s;t4arerircty1fpDr n ils  rxmxrpiudamenlfvs (fsrrmxr nt0apt  fctlslm ua(vsnu4tlxrxociytlmDe u o;t) 2um(o oudlle lncsls)aDumumpot4altoiietldfmDuanvonu)alxrmfcio1fmDr n sls)teto(m3iu1ome mivtlsfs2rr(r nu4alxoifctld s uauvp u4artnxf3iadomtrau s;t  rtmxmpno4altnlictlt)aDrm( onu1alxnioeilsfs rmums;(0artrir3ty1oat lneo t texm(m3oudlmen fcs s  2urur ou1apxnmo3tltfa uaums;t4tetnxrcoadlpDr u s;() 2xo(r3no1ap  mics sfsDrr(mo;t0alxomoeiadlm2rmnvo t4teermr iy1fpDr uvo;s0srtrim iu1ope mfvsat sDraxmont4tetnifeiltlm ean sn(4artrxf todfpteaues;t  2xo(mpnydop  mfviltfarururonu0texnio3iltlm2rm(vp (4 rxrmr3iodlmDelivils) 2xmxopiydll nmfvsa() rum(mp;t0oexnmictadfa2umnms u4tltrxf oa1omD aivo (0s2xmxo iy1lmeelncsas) rrmxmo;t0tpen oeiyt aDeauvs t) ltoxfcoatomt  u ilt)srxrir3ou1ome mivs sf Dumumpoo0teen o3tadls2uluvo;u4altnircia1late n i s0tetoimpny1lmenlnetlt  Draumoou1tlxn i3tltfs2emnvp;(4trtnmr3ootop  luvsls0 rxoxm nudal  mieia()arrru  ot0aexnmo3iltls rlu o;t)trxrir iytoate i ols)s2um(r nydalte fvi s) Dua(ront1opto ictyd aDel( s (4tlxrxrctotfmD  ivo ()trxmio3iu4amtelnvs t  rrrxr ;t4oetnmfctld m2rm( o t4 rermr3tydfmD  iei () 2um(m3oudome  fvsas)arrm(  ;o0aeenmo3ild aDrm(mp (4 rxomo iotopDean o ()s2toxr3nu4llt mfcsls) 2tau pnu0tpx  ietltfs2elnvp;()arxnmo3iatla rauvs ( s2trxo iu4apeelietas s2um( pno0tpt  fetadls2emnvp;t0aetnio3oa1fpDeanesl()s2tr(r3ou1lpenmietls)aDrmumo;t0ale ifetld sDranvp ()texrmr iotlptr uvo t0trum(opiodllte ict (f Dtr(rono1olxnmfctas aDumnms;(4altnmrciadoptr i s;s0t2xoir io1lpte ici sfsrrmu onu4aex  ieiyt s rln s u)trxoxf ty1om   uvi;s0t2xrio3oydopt lfetlt)srtr(m no1alxniictas s2eauvon(0tetoxf3to1opDe nvsl(0t2uo(rpio1am n ncslt sDurur ;o1alxoiociat a rmn s t)aetomocty1la r i s;t)s2urxm oodaptelfetat)aDra( pnu1tlxniocildlm ua(vs;(0trxomrcio1lpt liei;s0trtr(r iu4lmtnlivt t)a2raum ;o1tlxo oeiytlaDrl(mo;u)tlxoif io1lmtrlueo;( srxmir oo1optnmncils)aDra(m no1open oeiyd sDrmnmont)altnxo iodfmDraneils0 2xrxr3no4oltn ncsl()sDuauroou0tex mo3iatla ra(mo u) rxrmf tadlp ean s;s srtr(opiy1om nlnetltfa2ra(ronu1tpe  ieilsfaDeaums;t)aeerxocto1oat luesls0trxrxrpnudame lnvs t  rtmu pno1alxoio3iys s emump (4altnxo iatfm eaiei s)t2xoim io4lleemicsltf 2tmx  nu1alto o3iltls2rmn sn(0 rxniocoytopD aivilt)t2xmir no1openmfvsls  2rmurp;o4tle iociydfm ean o u4 exoxfciatom  anvo;s)tetoim3no1lptemicilt arum(mp;u4aetoiieiadls rau p;t4altomfcootlm r neolt texmir oy1omeelnvias)srurxroot1olxnmieiltla rmuvont4alxoiocootoaDeaiei;( texmim3iodapt  nvtltf 2rm( pou1tle mfctldlm rmu snt)trtriocta1omDe uvs t)setmimpiudamenlfcils  2tru  no1tptnmoeiasfm rlump;t4 exoxo oy1om  lieo ()srtrxr no1ale mivil()srra(  ;o0tpe io3ild a rmumon(0tlxoxo ia1lp eai s s  eumir ou1lm emfeiat  Dumump;u1ope mieild sDranvpnt0trxrxfcoodlp e nvslt0srtmim iudlmee iesa(fs2raumonu1tpt mociat a elnvo;u4aeermr ootlp e ieil()setmir iodol emfetasfa2tmxr no0tetomoeiytfs elu o;u) eenir3totfa r uei;t)setoxrpny1lmtnmfei () Dum( p;t1opx iietysls ranvs;t) lxrmrcoytfpt livil(  2to(o3ou1ap e fcsl(  rta(rpnu0aet mfciysls2ea( pnt4teeoir3oodom   ivi;s)srumxr ou4omee ivs ( sDumxrpnt1tpto f3tltfa el(vp t0aexnircoo1op eln o;s  exmxrpoo4aleemivil( aruauroou1oexniociasfm um(mon(4 etrxrcoo1laD lues s)srxmxm3io4lptnmnct s) 2tmxmpno4oexn ociytfs emumpnu)trxrmo oatfaD lnvi t s2tm(m oo1lpenlivi (fa2um(rp;t4tpxn fetlsls2elu s ()aetnmfciatop  anvo;(0s2to(r3iy4optelfvtas aDtau  ;t4tlx if3iydlm ran pnu4 rtrxr3tytlptrlnvs t0s2urxr3io1altelfet (  2rmu pnt1oexnmoctls sDum( p u0alxrxociy1lpt auvsl( tetr(r3no4lleelivi sf 2tax onu1oetn feiasfmDea( o;()treoir3oo1fa rluei;t)sexo(mpnudam nmivtls a2rr(roou1openifeilt s um(vp t4aeenxr to1oaD lneol(0seumir3oodale mfviat arurxmpnt0ale ifeiysfaDelnvp;t0 etnxocoatfmD  n slt  euo(opno1lmtn fcsat)sDraurpou0alt  o3iadlaDua(vo;(4 lxrif oytfmD ln s;(0 euoio3iodlm  lneslt aDtmxmpno4apx  fciat m rmump u4alenmoctatoaD au o t0srxmxr3oudop  mnvtas)sDtrumpno1alxniieiyt m2rln ont4altnifcto1fmDelnei (  rxmxrpiu1ol emivil(  Drmum ot1tpenmoeiydlmDuau onu0teeomf3iy1om rau i;t0s2uo(m3nudlpe livtas aDtrxm ;o1aeeoif3iadlmDrln p;t4 eeoxocio1lpD au i t truoio3nudomt lnes sfsrua(m no0tlenmf3iatfa uln p;t) ltrxr3ty1fp r n ilt)t2urxr oodlm  lfvs tf 2umu p;o1tpeoii3iasfsDulnvs (4 rermo3io1lpD lneils)trtrim3oudam   nvils aruau o;o1tet if3iyslmDeanvs;(0teeoxo to1omtr ues ( t2umxmpio4alenmnvilsf Dra(ro;t0tetnioeiltls2ua(mp t4artrmocoa1om e uvols teuoxm oo1am e fvta() rtmumpou0tpen o3iysla2rmnmont4arerxociodfa ean s;s) ruo(m3no4omenmnvtlt  ruaxrp;u1oetnif3tysls ea(mp ()tetnmfcoadfp  aneo s0texmim oudoltemicils) Dumum no0tpxo oeildfm2rau ont4 reoif3oodom  auvs (0 rtmio3ny4omenmivsa() 2ua(r nt0oltoiictldla uaump t)trtoircoodlpt  n s;(0srxmio3no4aptn ncsatfsruaur no0openmi3iytfa2rl(ms u) eenmr tadlmteluvo s0t2tmxmpny1apeemicilt arrm(m oo0oetn f3iytla emumsnu)arxnxr oytfm rlies s) etm(mpiydlle mfcs s arururpno4tleomfetyslsDem(vsnt4tltrxr3oodfmte u slt)seuo(r3ou4ap   ncsas)srtax p;t4oexnifeiys a2ul(mp u4trerxociatopD lu ils0t2umxrpno4lmenmict t a2rmxm ;u1olt  i3iadlmDumuvs;() rxnif3totfat an ilt0srxrir oudll nlict ( srrmxrpot1olxomietadls2uauvo t)tlxrxfcoa1fmteln s;( s2umiopou1alenmivsas)srrmu  nt4opto oeiydlsDuluvp;t4arermo3to1fptraueo;t  2tm(o3oydll emfeiltfa2urxrp;o0aexnmieiatlm2em( p;(4texoxr iadlmteau i t0 2xriopiu4al n nvtls)artrxm ;t0oexn ocildfa um( s (4arxomr tadoaD lneolt)teur(r oydapenlivsls) rrrxr ot4tpto oetatfa2el(vo;()aeermo tadfaDranes t0 ruoxr3iudap  mieil() 2uau pot0texomo3tytlm eauvp u4arxoxo iytfat luvs;t srtm(r iudaltnmivs ()s2rmxmpnu4aexnio3iydfm2eln snt) reoio3ty1latraivilt)sexmio oydol nlncias srurxm no4apenioeild a ea(vp;u0arenxf iy1om  an s s s2toxm oydoltnlncs sf Durxm ;u1aeen o3tyd a2uauvo;t)aetomf todlp eai i;s)s2xmxm ny1alt  ncsat)s2uax  oo4opt mfeiydlm2raums;u)tltrmf oodlptean sls trtrxr3oudolte nvs t)a2tmxmo;t0optomietasls2ua( o;u)aexoxfcta1oatrlivo;s t2xr(mpoydlp elnvsltf Durx o;u1tpt  oetlsfaDua(vs;u) rermoctotlmt lnvi t)s2tmiopio1aleelicia()a2rm(moot1oexo f3tyslm2rau p;(0trtnif3totfpt  i s;(  2xoxm3nu4lptemncias  Durx pnt1tpxn o3iytfs ulumpnu4arenmo3tytfmtr n i;s0sexm(opiu4lme lfvsa(fs2ua(r ;u4olx mi3tasfa um(mp;(0 ltrir3oodlp rluvslt0seuoirpoy4ap eliet s a2trur nu4tpxniociytfm2elnmp u0 rxrircoadfm  lu s;s) ruo(opiu4oltnliesls  rrr(r nu0oetnmociatlsDul( o;t4trxrio oo1fm eauvo s setm(m3io4omtnlfvtas)srumur ou4alenmictysfaDeaums u4areoxf3oy1omt auvi;(  2tmxrpnodal emncsa()a2raurp;o4tltnmi3ilt a ulnvp;u0tleomfciodlp rai s ( seur(mpiy4op  lneiatf Dtrur ;u1open f3iatfm uanvp;u)aleomr3tytla  aivs;s) 2xm(rpoy1amtn ncsltfsrrm(m nu1oltnifcilt s2uan pn(0texoio3io1opt  ueils0 exrim nydomtemfei sf 2urx ooo0tltnmfciatla ua(vs;t4alerif3oa1lmt lu sl(0 2xr(mpiodlleemfvsa(f rtrur nu4aetniieiydlm2emu p t)trxnifcoatfaD lnvilt)t2tmxr3oudaptnmfct s) Dum( ooo0apx mf3iatla2emn o;(4aexrxrciytlpDe neil(0 eur(r oo1op n fcta(fsrrmu  oo0oleo ocilsfm2ua(mo;()aetoxrcty1fptrli s () 2umir oydomteliviat  Duaxrp;u0tltn o3iadls2elums () lenmoctydfatrluvilt0t2xmxr nu4ape mfesls srtru p;o4tlto ieiatfa emu pn()alenmf3oadla   i o;(0t2xr(m oodlmt  iesas sDrmurpnu4tpxoio3iadfaDulnmo;u0arxrmr oo1fmteanvo;(0 rtoir ny1opeelictasfs2uau  ;t1tee  i3iltlmDrl(ms t0aeeoio iy1lp elivo;t)seuo(m ou4lleemfetasfartaurpnu4optoif3iasfa rau on(0 eenir tatlateau o;s0 eto(o iy4ll n fcta( srtaxmo;t0tetn ociyt s rln p (4texoxo3tytomt  ieol(0trtmiopno4lpe  neias aruaxmooo0aeeo octasfa2emuvp;()altnmr tytoa r ieilt0sexr(r nu4omee nvia(fsrra(mpnu0alxnmo3tad sDelnvo;(0 eeomo ta1lat  uvo s trxmio3no1lleelfvtat) 2tau  nt4tlx moetlt aDra(vo t0 rtrio ia1opDelnvi s) 2toxm nu4alenmneil()s2tmxm ;o0tee ifciadlm ra( onu0aexnxf iodla rluvs;s)t2uoxo oudaptemfvt tfs2uaum oo1opeo ictlsls2uauvs t)teerxrcoodfpD lneols trxrxmpnydom  lnviasf rrr(moot4ope mictytfm umnvp;()trxrif iodla   i sls) rxrirpou1ll n nvia( sDua(ro;o4tleo fctyd m2uln ont4aetnxf3iytlmDraues (  2trim no4lp nlnctls  rtau  ;t0aexnmf3iatfs ea( s u0teerifcoodopteau s;t t2tmim iu1ap emiviltfsDua(  ;u4tpeomo3iatfmDelump;(4 eeoxf iodomDe n o;(0sexrxm3io4lmtnmfes s sDumx pou1tex mociasls2em(vo u4 rermf iotlmte n slt0 2xmxr3nu1ol  mnci t srra(  ou1altnioetys m2ra(vp u4areoif3iodoa ran i s)srtrim io1alt  nesas)sDraum ;t0aptnmo3tyd aDuluvpnu4altoio tatfm elneolt truo(r3iy4lleelfet ( sDurx ono4tptnmfeilt m2ua(vo u0arerxr tytomt lueil(0t2xmxmpoo4om nmfei s a2ua(  nt0tpxnmf3ilt s ra(ms (4alermfcoy1omDeaiei;(0 2to(rpnu4omtelfeil()sDtm(ro;u1tle mi3tysfm2ra(ms;(4altnio tydoatr neils  exrim3io1amenlfei sfaDrm( poo0tpx mocils s ulnmonu0tltoxo iydlpDr ies (  rur(o3iudlm nmivtlt  rumumo;t1teeniieiatfaDrm(vpnt4 leomrcta1optelueil( trumir iydaltemneils) Dur(root0oetomf3tysfm ulnvs;u0 eenmf tadlaD aivs;()teurxo oudam nmfeilt srrauroot4tee io3ilsfmDea(vo ()alxniociytfm rlnvilt)trxoirpnodlp  mncs tf rrauro;u1oex  oetysla um(vs;t4tlxoxrcoatfa eluvols) etmimpiy4oltelict s)srtaxrooo4aleoii3iys s2ulnmpnt0 etrxfcta1opDeauvi;()trxo(r oo1olee ncsa( s2urxmpou0tet if3iysls2uluvs ()aexnif3iydfp  aueils seumiopiydlmenlfvtlt srtmu pnt0apt ifeiys s eluvp t)teeoxo iydomDeanes ( srxr(rpnydaleemncs tf Drau  nt4aeenmo3tyd a2emn o;u)tetrxr iotopt auesl(  eur(o3ny1aptn fetlt) 2trurp;u4opt mociasls2umnvs u4 rxrmf tydoa e i s s) rto(rpno4om e fvt t sruaxr ;u0tetoiiciyt aDrln snu)alerifctytomt  ivs;s trtm(r3oudam nmivs s)s2rrum ;u1opxnmicildfs2umn s u4 ltnif iotfm  aueo;s0 eumim iu1om nmicsat  Drrumooo4opeoiieiyd m2ea(mp;()tltnmo3ta1opte u s;t trxmirpiy4omtemnvt ()sDtmx p;u4opeo fcias m umnvpn(0 leomr iytfp   i i;(  eurio3iydalee icsa(  Dtau poo0tee ioeias s uluvp () rxoxo totfmtrln i;s  2xmiopiu4aptnlicslsf 2uaxront4altniociad a ul( p (0altoirciotlmtr i ilt)s2triopio4lpte ict t) Dtmxmpnu0oexnii3iys a2emn on(4texrmo iadom e i ilt)srxoim nu1lpt  nci (faDrmu  ;o0oleomociydfsDua(vp;u)texoif todom r i ol(0seurio3iu1lptelnvsas s2tm(m nt4openmiciyd sDuluvp (4 lxrmoctatfmtelnvolt0tetm(mpoo1om nlnetl()sDua(monu0tex iociatls uanvont0 rtoir3to1fptrauvo s0setrxo nodamt lfeiasf Dumxmp;t4tpxnmiciytlaDumn s;u0aeenxf3oatlm   nei;()seurxo3nu1oltnlicsls aDum(rp;u4aet miciltlm ea( onu) renio3iatoaDrauvo;t) eumir nodlpee neils  rrr(r ou4oeeoio3iytlsDua(mp u) ltnxocootlpD  u ils)trxrxr oy1lp e fvsas) 2rm(monu4apt mi3iasfsDulnvp (0trtnmociydom rlivs;() etmxr3oo4aptemnct t) rumum no0aptoii3tadfmDelnvont4tltnmo3tadfp e nvo s0t2urim ou4om nmfvs (fa2rm(r oo4ape  iciatlaDelums u)trxrir3iydoptranvol()t2xrio nu1ap   nciasfartaum ;o1tleomoctldlm2umumpnu0teenmr ta1lm r nvs s)texriopnu1alenmieia(fs2ururooo0optn ietls s2ra( sn() eenmf oydfa  ai s;t)t2um(o3iodomtn fct tfartru  oo0aee mi3tatlm elu s t0 reomo3iytfaD anvo;(0seuriopoy4lp  lnvs sf rtaumpno4teenmfctytlmDemnmo;t4aeenxf tytopDelivs;()srumio3iodamtnmnci t a2raxrpnt1ape  f3tydls2ran snu4alxnio3oo1lp raivil(0srtmio oo4lp emneslt) Dua( pou1teeniietasfmDum(mo u0aleoxrctotfptraivo ()setmio3ou1omeelfciatfsDraxr ;t4oexnmoctadls rmnmonu0trxrmo ty1fptrluei;t sexr(o3iy1om nmicslt)a2tru  ;u4apt iieiydfa ea(mo t4trerxf io1latr n s;s)truoio3nydoptelivi ( aDururpot1olx mi3iaslmDraumpnu4tltnio oy1laDeluvi ( srtr(mpny4lpen ivt s  2urxrp;t0opxnif3iyt a2elnvo;(0trerio oytfmtrlueo t srxm(r3no4ll nmies sf 2tr( o;o0oleomiciad a rmnmp;(0 exnxr iadfmD  nvslt t2uoimpnodalenlfci s arraur nt4ale mieiasfm umums;t4aetrio3tydfat li i;(0t2xoio iy1omtelfvi tfarumumpno4apxnmfeiyslsDeaump;u0 rtnio3ootop rau ilt trurxopoodamee ncs ()aDur(mpot1aexo i3tltla uan p;t)tlermocoodopD auvi ( s2uo(mpio4altelfctls  rtmx onu0olxoifctyd aDrmnvp t)alenxr3oa1laD li i;s)sruoio oudlm emfvtltfs2tau  ou1tpxnmoctldfmDua( snt0aexrxo tydfmDelnvi () eto(m3ou4altelneias)a2trx  nu1oleo fciatfsDrlnvont4aexrmf3oadlat aivo;t trtmir oudlp e nci s)arurxmp;o0oetn ociadls2rau pnu0aeermr3ootop  anvols) exrxm oy1apeelnvsls)aDtrxrp;t4tpxn o3iltfm uln o;t0tetomr oatoa   nvsl()teur(m ou4lp  mnci sf Dtrx pnu0oltomiciasfsDem( p () rermociadopteln ol(0 etrim nodaleelncs s arraur nt0alenmfciltlaDeauvsnt4areoiocoydfat aieols)s2urirpoy1lpteliesls  Dtaump;o1tpxo iciyslmDel(ms (4 rxomfciadomtean sl()t2to(mpiy1ap elfeiatfaruaxmont0tpe mi3tldfs ua( s (4texrif3iy1oatelnvi s)sruo(r oudapenlietls  rtax p;o1oexniietys aDeaumsnu4artomr oytlm  lueols)seurxo3no1op emiesas a2umx o;t4olt mfciyt s ranvs;t) ltniociydlmDrluvo;s tetrio3iydolte ivi t aDtax onu4aetn iciyd m ul( p u0texnmf3oo1lpDeaneols srxrirpiydamtelivsl(fa2rmxmo;o0ole io3ildfsDuau s;(0 rtrxocio1omDrlu sls0s2tmiopoodopenmici sfarta( pou1tle ifctat a2eauvsnu)tlerxo ootla r ieil()seuoxrpiy1ap e fetls)artmum nt1tetoiiciltfsDrlu s (4aexrir3todfmte nesls) 2xmxm3ou1omenmivta(farurxro;t1tlx moeiadfa elnvp;t) etnxrcoa1optrlnes;t0texm(mpno1lp nlfvtlt) rtax  nt1apx  fcilslmDel(mp t)tltomf3iytfp  luei ( seurxo iy4amt  ies s arrr(rpnt1apxoioeiydls2emnms u0trenmf3oodfa  lueo t  euoxmpiodoptemncia(f 2ur(m nu1aptoii3ildfmDeaump u4altoir iy1faD lies;s) rtmxrpoudllt mncils  2ta(r ;t0apeniociyt m raump;(4 rtnxo3ta1fpD li ilt seurimpnydlptn fcilt)s2tmu  nt4tpxoii3ilsfa rauvsn(4aexrircoydlp  aieslt0 eum(rpoo4optemfcsls)sDumx pnu4alxnmfctls s2rau onu4teermocia1optraieol( s2xmxmpny1lmee fcsa(  Dtmumpnt1oeto o3tytfs emums;t) lxrmfcta1fptran i;t0seuoiopoudll nlivsas  2ra( pno0ope  i3tytlmDranvo;u0 ltoxf totlp ean o s tetm(mpnydop nlfcia(f rtaum nt1apx mf3tyd s2ea(mp;u4 ltnir3iatop  anei;t0 exoio ny1ape mnctasfarurxmp;u1aetn o3iytfmDum( pnt0areoxo3oatfptr ivs;(0t2trim3ou1ll   ivs tfa2tm(moou1oexomfcildfsDraums () rxomo io1lpDeli il( truoxm no1lpenlieslsfsDrmx ooo1altniicils a emnvpnt4 etoxf iatfa rauvols0tetoirpio1op e fvia(faDtrxr ou0apxnio3iytlm2eanvpnu0altrmf3oodoaD  i ol(0 2toimpou1alenmics tfs2tax  nt1aptomo3tas m eln o;t)tlxnio3oo1lpt lu s ( srxoxr nydll emnvia(fsDuaumpnu4aptomo3tltls2emn o (0tltoif oydfmDr i i s t2xrirpou4lmeelnci t)s2ur(rpnu1altomi3tysls2elump u)aeenmr3oa1fp   i ils  exr(rpiu4aptelietlt)sDum(r no1olt ifciad s2ea(vs;t0tetrxrcta1fa  aies;()texm(opou1ap n neia()arrm(  ot4texo fciad mDrln o u)aeeoxfcoo1fmDe uvsl( t2to(r3no4ole  nvs t)arrmx pou1aleo feiatlm2ul(vs;t0treomo3iydoaDe ivo s) etm(r3oydam emnviatfsrum(m oo0tee io3ilslm2rmnvs t0 etnmf oy1opt  uvils)t2tm(m ou1lmt lnvilt) Drax pnu0tee ioeiysfm2umums;u) exrmo3iatoaDe ieo;t)trto(m ou1am elfcs tfsDuaump;t4optomieils m uau ont0tetnxfcta1faD lnei ( texrxr3oy1lpeelieiatfarur(monu1apenifciydfa2ra( p;() exrmrcty1fpDelieils seuoim oo1llen neia(fartaumonu1aetoiieiadfa umuvs;(4aexomr oytlpDe ieslt  eur(m ny4ol elfct (  2uax  ;o4open feiatlaDrmuvs u0 etrio io1om  liei;t t2uoxo ou1ll elnei (fs2ra(ro;o4ale ifeilsls2ua(vo;(4aexnxf3oodfmtrauvo;t)teurim3ny4apte ictl(  2umuro;u1opxnii3iatfaDemuvont4trtnxr tatopD  n i (0s2umir oudap  liciat aDraurpnt4tlxomfciltlsDul(von(4altomo oadoa  au ols) euo(mpoy1lm  liviatf 2rr( pnt0ale ifciyd sDrlumont0tltrmrcoo1fpDran o;t)seuo(r3oo4apeelfciat) rrru  oo1aeto feiltla ean o t4aleomr3iy1opDeliei (0srur(mpnu1amenmfetatf 2tmx p;t4aeto o3iltfaDeluvs t)alxoxr3iadfp r n s;t  etmxo3oy4apt  nesl( aDtmx onu0alx  f3iatls rl( on(0 rxrmo ta1lptrlnvi;t  2xr(rpiydllte ncilsfsDtm(moot1apeo ictlsls rauvs t) ltomfciotfa eaneslt)t2tm(o oo4lp nlneia(f Duaum no1oltoiieiyslmDumump;t4 lxnir iydlmtean s t0trto(m3nu4alenliet s) Durx  ;t1oee  ietltlsDeanvo t4aleoxo3tadoptr uei s tetrim oodop nmictltf rumxmoou0opx  ociyt m rlu s;t)artrxr3iytoa ean o (0s2xr(m oydll nlneta(  Draxro;o4alxn ocilt mDumu on(0 exoir3iotoat  neo (  2urim oo1ll nmics sfartr(moou0oet  f3ild mDum( p;(0teeomf3ta1fmD au slt  2toxr3oo4aptn fcsat srtaxrpoo4tet mictlslsDuanmo;t0aexrmf oatfmDeaieo (0trtoim oo1omee ivi (fsrrm(  ;u0oex ifciadlaDemn o (4trxoif3iydfaDraneil(  2xoirpoy1omtelfeiat  Dtrumpno1texn fciltlmDea( o;(4arxrmo oy1fp  luvilt0trtoxopou1apenlfei s  rtm( pnt1teenmoeiaslm rm(msnu4texomo3iytoaD li s s0sexoim oodolenlnvs () 2um(  no4tlenmfeils a2rmuvo u)tltrxo tadfpDrauei;t0s2xoim3iudamt  ncta()sDumu  nt0tptnmfetadfsDra( s (0tlxnmociy1lm  anvilt sexr(mpiu4amenlneslsfsDum( p;o1texn feiyd m rl( on() rxoxf3iotfmtraivil(0seur(mpiu1lleelncsa()sDurxr nu4aptniociytfm uaump (0 ltniocio1la rli s ( t2tmxm3ny4lleemnci (fa2umxro;u1tee ifetytlm ua( snu0 lenir3ty1fptraiei ( srxmxm3iydll n ivtlsfa2rax  oo4aetoifetydfs rmumonu0 ltrir3iydoptraueo s0setmxmpio1lpenmfesa()s2uauro;u0tpenmicilsls rmnmo;u4arerir3io1fa  lnvi;t)s2xmxo3nu4am  liesas) rrmxr ;t1tpe if3tys s umnmpnt)trxrir oadfmtr ues (0 2toxmpoo1lpen ncsa(  Dtmxmp;u1opt if3ilsfs umnvo u4aetomociodlp  an i s) exoir ou4alenlfcils s2uaum ;t4aee ioctad s eauvp;u) lxnio tatlaDeauvs (0tetm(r oo1al emiviatfarrmu oot0texnmf3tyt mDul(msnu)alenxo3iydlmD  n ils0 ruoimpou1apeemfcsa(  2ra(moot0tle mictldlmDemn snu)tetoxo iadfmtelneil( truoio iodal nmnvtls)a2taumoou4tlx ioctat s um(msnt)aexnxf tydlmtrlnesl(0trxriopoo4ll  mncsas srumur nu0oexn i3iat sDrm(vs;(0aleoxr3iydop  an ols)seuo(opnudoptnmfctl(f Dum(mp;t4apt ifeiasfs elumpnt4 rtoiocta1om eau i;( sexoxo3nudol nlfvt t)a2trx p;o1tpx  ociysfs rl( o t)tleomr io1lm rlies t  2umxo oodlm nlfvt t) rrrxmonu0texnmoctatlsDulump (4aetrif iodopt anvslt0trumxmpoodlpt lfcsas) Dtrur nu0ope mi3iaslsDuanmpnu4aetnxf ty1fmte ieilt0 eumxrpny4lpe lics (fsDtm( o;t4tltomiciat a ea( on() lxomrcootoaDe n o;s) rxo(r oy4ameeliet t s2rmum no0openmo3ilt mDra(ms;u) rtoio3iydomtr u i ( srtrxo3oy1omtnlivsas)a2umum nt1opeoiociyd m2umnmp (4tltoif3oodopDeli sl(0setm(r no1om elfvtas) ruaxmoot4opx mi3tytlaDumumo;(4 etoxo iodfptr nvs;(0sruoxm oy4lp nmieta( s2trumo;u1tlto oeiatfsDrmuvsnu4 ltrir iotop  an il(0seum(rpnudap emfesl()aDur(mo;o1tlxnmoeiysfm rl(vo;()aetnxfcta1fm  au i t0 rxmxr3oo1ll nmfviat  rrm(ront1apxn icias a2elnmo t) etnxfcootoa rauvi;t0 rxriopno4am  micsa(fsrtrur ou0alx iieiltfm2raumpn(4aetrxr tadfp raieo;s)texmxmpoodolenlfes (f ruau pno4tptn icildfa2ul( o;(4arxrxrcoytfmDr nvils0 etrimpny4ol n ivi t artmxronu4aee mf3iydfm ulnvs;(4aexomf oodom eaies;t s2urxopiu4llen fvsas srtm(mo;u1aeeoii3iydlaDrlu snt4aexomrciadopD aivil( trxo(opoo1olenmietasf Draurpno4aeeo fetat a rmuvsnt0trxoxr3iatlp  livils)s2tmirpiy4lm   nct ()arrrurpoo1opxniiciytfm2ua(vo (4alenmo iotla eaivo;t  2xrxr3iydlpeemfvsasf rrmxm ;o4oetnifetysla raums (4alermo todopDrluvs (  2toim3nudomtnmfviat a2uaur no1ope mfeiltfm2em(vo;t0tlxrio ootomtr uvi t) 2trxmpoo4lme  nvilsfa2uaxmo;u1opeoio3iysla2emumpnt0tetrxo3ty1opDeaneo;s0teumimpoodlpeelnctl()arra(  oo1tpeomf3tasla ulumo;t)tlxoxf3tydlp eli i ()tetrio io4lptn fviat)sDtm(mpou1alxn feildla rluvo;t4 lenmo oatlmDe ieo;s0sruoimpno1om nmfesat) Dtr(m ot0openio3tad sDeanmsn(0artoxf iatom   u ol(0 eurirpoudolt lfvi ( s2tr(  ;u4alen f3iadfs2ea(msnu4trxrxr3iytoa eli slt0trxr(r no1lm nlnviltfa2rax pot1oltoioetys sDemnmp;t4tlermrctydfmD  iei t0 2uoxrpnydopt  fesat arrax o;t1tltomfetad a umnmpnu) rxnmo tatlm   nvs;t0setoxmpio1ame  fvi t)a2umu pou0aeto feils mDum(vs;()trxrio iatfpteaueslt)s2umxr3no1openmfvt ()s2ra( p;t0opeo f3iaslm emnmp t4altoxf oytfmtelneo;s0srtoxo3oy4op emivil()s2um(mpoo0tpxn octytls el(vsnu4trtomocoadfmD  n slt t2trxrpoodapeemnvta( arur(r oo1aeeo feiys mDea(mpn(0 exnxr3tydoptrluvs s)trxrimpnudol emfvt t  rua( o;o0tex  i3ilsfa umnvp (0aetoio oa1lmDean olt)srtm(r3iy4aptn ivi (f rrm(m ot1tpe ii3iyd aDulumo;t) exrxfciy1omtrln s;s)truo(opio4ap nlivtat  Dtmx  ou1aeenmieiatfaDra(ms (0tlxrxo3tydlp eli i;t  2urimpiy1oltelfetltfs2ur(mono1olenioeiysls2uau pnu0trenxfcta1fp eaivsls)seto(r ny4ll  mivs t)s2uaxrono1apeomf3iltfm emuvp u0aetoiocta1om ran s;t0 euoir ou4lpeemfvtlt  rtm(rono4tlxomf3iytfs emu o;t)areoxrcty1fmDrlivols0s2tmxr oy4olen ici t aDtmu ono1olenio3iyt m2rmump u0alxnmr iy1fat  uei;t  2tm(opou4omtnlieias)sDrm(  nu4alxn i3iyd s2elump;t0 rxrmrctydoptelueo t0 rto(r3iodalenlfvtat)a2raurp;u0apt  octldfa um(mp t4texomf3iodoa e n s s0sexrxo3oo1ome  fetatfaDrm(mo;t1optomiciytfm2rl(mp u)trermf tydfaD  neslt trxm(r nu1apenlnctlt aDuaurpnu0oeeoioeiyd s2rau snu4 ltnmr to1fm e ivs;s  rxrxr3ny4oltemieils)a2raurpot4oee  ieiad a2rl(ms t4tlenmf oatlaDrau i ()srtmir nu1omtnlnctasfarur(monu1alto iciltlmDua(vp;t4tlerxr3oatla   i i s)srum(m no1amtemfvsl() rtmumoot0olxnmociad m2rln o;(4altrif3ia1faD an il(0sruoxrpny1omtn nci tfarumx onu4apx if3tydlm ua(vp t4altrxocoo1fp r iesls)tetr(r3ou1apenmncs (  rrmx  ou0tet ifeiltfa2rmu o u) rxoxf3oa1fpD anvi;s0teto(opiudome mfeiat s2uru pnt1aetniieiasfs2eaumsn(0trtomf oytlpt liei;() exrio ny4amee fet (fa2trumono4oetniietlsls2elumont)aetnmo ia1fp rluvsls0s2xmxr nudamtelict t)arrau  no1ape moeiyslm rlu s (0alermoctatlmDelnvo;( tetrxm oo4lm e ivt (fa2uau  no4tptnmiciyt s elump u0 lxrmociadfmtrlneo;(  exrio3ny4openlfcsl(fsrtr(r nt0apen oeiys s2eln p u0 eeoxo oatfaD luvo t0trur(m io1om  lncias arurx onu4ape mfciatls ra(mp t4 renir iy1fp e ieils)s2uriopno4alee neia() 2tmxmo;t1altoiocildfaDrlnvo u0 eenmrctodoa  aiei (0trxmiopnydomee fctl( s2tau ooo0tlx mictatlmDuanvo;t)trenmfctydoate nvi;t t2xoio3iy4om  livsls)aDta(  nu0tptnio3iytlaDumnmo ()alxoiocoy1opt lnvil( t2uo(m3no1ol  lfct sf 2ra(mpno0oltnmiciatls2em( s;u)areoxf3ta1fp e nvsls0 2uoio3nodlm   fvtls  rtaxmo;t1opxn ietyt a el(vp (4arxoio3iatomtrli s s)s2xoxr oo4lpee nctatfs2uax ont1oeenmiciad mDeluvo;u4aleomrcoytop r iei;(0sruoxm3oudom  lfci ( srtmu  ot0apx mf3tyd m ul(mpnt0texoifcoy1opt lueolt)srtrxm3iu1ap n feias)s2ur(  oo4oeeniieiltfs2uanvo t) ltnir tytfatelneo;( srxm(o no4lpe mfesat)artaurpoo1tetoifeiys a rmnmsn()teeoiociydlp   ies;t  eumir ou4lm nliet ( srta(r no4tle  fctadla2ulnmo;()tltoifcoo1latr i o (0setm(mpnu4lpeelfvias  2trxm nu1tlt  ietatls emumsnt0tlenmr3to1faDeluei (  rxrxopoydap emictl( aDuaxro;u1opx  ictat sDeaumonu0tlxrir3iatla rlnes;s)tetr(r3ou4lpeelnci t)sDrm(r ot4alxomieias sDemuvs;u)tetriocia1fptr u il( teuoxrpio4lp  lnctl( sDur(mo;t4optoif3tlsfa emnmp u0trenmr3tadlptrlues t)trxrxr3nydlptnmictlt arrrx  ;u0aptn fctys a2emuvs;(0arxoxfctytlpt ai s;(0teum(mpoodam nlictl(  Dtmumpno4open o3tadla ua(vo;() rxrxf oo1fpD lnvs t  2toxo3iy1alenmfvils) 2tm(ronu1tetoif3tysfaDumnmp t0 eeoif iy1lmDr nes ()s2uoir nudap   ivta(f 2rmxmoot4aeeomi3iadls ea(mont4alxrmf todlat livol()t2xoio3oy1llt mnciat)artaxro;t0aetn i3iytlaDrln pnt0 lerxo3oydom  luvs;s0trumxrpou1ape liet tf Dururpou1aet  fciat mDemu onu0 reomo io1lm e nei;t sexmirpiy1amenlivs s)artmurpno1tle if3iltls uluvsnu)aeeoircoa1fa e nvol(0 rxrxo ou4ape lnvslsfaruax p;u1opt iietyt mDrm(vs;u)altoiociodla ranvsls0 etrxm3iydlme  feta( s2uax p;o0apenifciadfa2uauvs;(0 ltoxo tydomte nvs t  2tmxm3oo4lpe  nesat s2taxmo;u1oet  fetldfs ua( p (4alxrif oa1fp e ivs;( t2xoxo oudap emnct tfaDta(mpno1opt ii3ias a2rmnmont4aetomr tytlmD lnvs;( srumxo3io1ole micsatfsDrmxrooo4olt ioctlslaDrmnms u4texomf totlmtrlnesls0t2umxopno1open nctltfsrtrxmpno0tpeo iciadlaDulnvsnt4tltriocoa1omDeluvo;t0s2xr(r3iydomee nvi s aDtaumpnu1opt moctldfm2ranvo;t4trxrmr3tatlp rau o ( t2toxrpio1apt lneslt) Dta(m nt4tlxn oeildfs eauvont0tetnxocia1fpDr iei t0 2tr(r3nydop e fcsatfartau o;t4aeeoifciydlm ran s;u0teenxr3tadlat aueo s  ruo(opiu4olenlnes s  rua( onu1tpt ifctlsfsDuluvo;t) rxoxociotfmte u il(0 etmiopnu4lp   fciat)a2ta(m ;t1olt  o3iat mDuauvo u0tltnio ty1fpD aies t0 etoir3iu4ap n ivi tfaDumu ooo0tpx mietydfm ea(mpnu0tetoif oytfaDr nvi s0seuriopoodal emfet s)a2tmur oo4oee mfciadfs2ua(ms;()teerir3tytfm eaivi;t srtmirpnu4omen fetas) Dtruro;u0apto feiasls eau s;()aexoxf3ootomt  nvils0 2to(opio1apee ncil( srur(m no0tet mocilt mDean o u0aetrxr3iytlmD lneilt srxmir iy1lle  nct ( a2rrxr nu4tpe  i3tydfa2ul( s u4alenif3tytomDrli i;(0s2xrim nudoltnmfetat)s2ur(rpnt4aeeo ictytfm2ua(vpnu0tetomf3oodlaDelivi s)teur(o nu4optnmfvi ()s2rrurp;t4alxn oetad s emnmp;t4trxomr iatfmD livi;t)s2xm(mpny4llte nct t)sDra( o;u1openifcils sDuan snu0texnxociadlp r ivs;()s2umxopoy4lmtnmivs s)sDuaur nu0texnmfciltls2ul(vo;u0trxnxr3iytlateln i;(  exo(rpoo4ale lfvt t)aDtmumono0aetnmfctasls2eau p;u)alxnmr3tadlptr neols0srxr(r3io1al n ivi sfartau pnu1opxnmiciysls ua(vp;t4alenir3oo1om e ies;()setoxo3iodapeemnciat) 2urx ont0alenmo3tysfsDra( s;(4arermf3tatopt  i o;t0 2uoxm3iodllt lnes sfsDurumpno1oet  ietadfm2uan p t)texrif io1fa  aies ( srum(mpiudol emneil(fs2ta(r ;u1oet iieiat aDuln snt) lxrxr oa1op rlieo;t)s2xo(m nydlpe  ict (f 2trxrpnt1ope iiciytfa2rmu s t0alenxf oydfmDr iei;()t2xrxrpnodll  lneta(f Dtmumonu1oetnmocild m emnmpnt) eenmrcoa1omtrlieo;t0t2umim3ou4alenmfci t a2umxm ot0opx if3ildfsDrm(ms t)trxnmfctatfaDeauvsls)texmxmpny4lltnlncs s)aDumx oot4oetniiciat a2emuvsnu)alenmo3iadom   n s;() rumiopnydlptemfetasf rtr(root1tleoiicildlmDrln p u)tleomo ty1fpDeln s;s) 2xrio3ny4olt lfviat)aDumxrpnu1oet ii3tydfm2ua(mo;(4areriocoodop r i s ( trxr(r no1lptn feiat) 2uaur ;t1aexnmicilt a2elnvo () rxrmrcoydlpt aieo ( seurirpiydam  lnetas) rrrxrpou1aetnmfeild m2rlnmsn()arxrif ty1opt lneilt0trxm(m3no1lltnmfetlt) rraxro;t4aex ifeiltlm2rmu s u4altrxrcoadlpDrln s;s0trxmir3iy4ap elivia(f rrmurpot0alxoifcilsfa2rmumo u0 ltrxf3ta1fp ranvs ( t2to(rpiu1lmenmivs s aDrm( p;o4tetnmfeiltla2rauvs;t0arenmrcoodopt aieols) 2umir oodam e ivils) Dtmx o;u0tpx mfeildlm rl( sn()altomo oodfaD anvslt) rxoxopiudlle  icil(fsDrm(  ;o0olxnifetytlm ranmon()arxnxoctotlaD  uvilt)sexrxm iu4ol nmfvsa(  rumum ;t1tleomf3iysfm rl(ms t0 rtrio3iatomD  ivs s0trxmxr3oudol elfvtltfa2rax  no0texnii3tat a el(vsn() lenxr oadopDrlivs (  2urirpiu4lmt  fvsas)a2ua( onu1opx ifctas m emnmsnt4teenxociotomtean i;s)trtoxm3oudam nmfvs sf Durxrooo4tpxo oeiat sDemnvsn()arerxfciy1fatrln i t0 rurxm3nu1olee neia(f rrm( pnt4olt mf3ilsfs umu p t4 rxnxf oy1late nvi;t)t2ur(m3no4ll emivias  2rmx poo1texomoeiysla2emnmo (0 eenxo oo1oateanvol( tetoim3ny1ol nlnvta(f 2rrxront1aleoiiciaslaDumuvs t4 eeomo3oydfatr i ils)setoxmpiy1altelfes s  2rmurpnt1tpenmfctatfm2ua(monu4arxomr oatfptrlivsl( t2tr(r3ou1alenlfct ( a2trxr nu1ale  o3tad m2emums u)aeenmo to1la   n i;t0 etrir iodoleemnvi sfsDua(m nt4apto ieiytfaDra(vp;t4tleoircoatoat lies s)texmxrpou1lm  lfvtltfsrua( poo0tltnifeilsls2rm(mont)alxrifciytla rliesls0texrim3oo1lme  ici t) rtax o;t0oeto iciat s2ra(vsnt4aeenirctadoaD  neo;s)srur(opiu4apeelfctasfa2ur(mont4oeeoif3tlt m emuvpn() rxrircoydlp  luvols0 exr(m iu4lpe mics t a2ur( o;t1tpeoiociatls2rmn pn(4aetoircta1fmte ivs s) 2toxr iu4am  lictlt) 2uaum ;o4tlxniiciadfs2ua( snt) rtnir oytfmtranes;s)seurxmpoy1llte ncs s)srtr(m ;u1apx  ictyd a2eanmo t)teerxo3oa1fpD aieo s) rxrim no4om elfvtl( aDumxmp;o0tleomociat m2emnms t4altnmoctytlpteln i t0 2xoim3nudom   fesat sDum(m nu1tex mfetls a2ea(ms ()teerxo3oytop   i o;s t2xoxr ny4lm elnetasfaDtmu  ;o4oetn fciydfmDrauvo;() ltrir tydomtrlneil(0 2trxm3oodlptn feia( sDuaxmoou1apenmo3iasfmDum( p;u)aexnmr iytoaDelivo;()teuoxmpny1lpt mietat sDtauronu0aeeoio3tlslm eln o ()trtrifciydlpt  ivo t)seuoxrpnodom  livi ()a2tr(  ou0oee if3tytla uanvo;(4 leomocoydlaDr ieils0 eur(m3iy1ape mfcs s  2umx  ;t4tlt  o3tasfm rmnvpnt)arxrmr iy1fp   nvil(0trurxrpny1lleemfet t)s2raxroou0aexomieilsfs2ra(vs u0aeerxo3oytoaDr u o t0 rurxm3oydomtemfesasf 2uax oou0oleo feiyslmDemn s t4 ltrmo3oodfm e u olt tetmxr3nu1omeemfeias  Drr(  ;o1tpenii3ilt mDelnmsnt)tltnxf io1omteauvilt0srxoxm oudole mncil( arraxmonu4oet  ietaslaDrmnvp t0aetnio3to1laDelivi;t0 rtmxopiy1altemfeia(fa2tmur no1aeeomoetat s eau s ()aexrio oydla eli s;s) exrir io4lmte ies t)a2uaxro;o0tpxomf3ildfm ranms;t0texomf iotoaD  ueilt)srxrir3oo4ale mivtls) rrmu pou4opeomfciyt m uanms;u0trtrmf3iadlpDelivols)texr(r3nu1apt  fvsls)artru o;t0aptnioeiytla umuvo ()texnxfctydoaDeaieo s  exrxm iydlltn nct tfaDtax pou4opxo ictat sDulu o;u0aetnmf3oo1la rlu i;(0texmxrpny4lmt  neils)artmxmo;t1tpeniiciadls2ranms t4tetoxocio1lmt ln o t)trxm(opoy4am   ics s  2um(monu0teen o3tytfaDra(mpn()alenir oydlaD ai s s)sruoio3iydlptelics tfa2rmurp;u4oeto octatfs2uanvp;u4texnmocoa1lpt livs t)sexr(m nodapt lieia(  rur(m ;o4olto o3iadlm2ra(msnt0alenxocto1op ranesl(  exr(o no4oltelnctlt)a2umxront4apx mi3tld a2elnvsn(4trtnmfcoatfmt  n il(0 2xoxrpnodlp   nvsltfsDuaum ;o4opt  f3iyt m rmn ont)treomf tytop eauvs t)t2toxr oy4am  lfvs (fsDuaur ;u4apt ioeiltla2rl(vpnt4tlerif tatfp  ln slt0trur(r3no1aptemfcsas aDua(root1oetomfctltlaDel(mo;t)aetnioctotfaDe ivs ()truoio ny4aleeliet sfs2raxm ot1tle ifctldfs2rmnvp;t0 lxnir io1opDrluvols t2urir3oydom nmfvil(  rurur no0tlx iiciysfaDulnvp (0trxrxr3to1fa e neo;s)t2urxopnodal nmfcta(fsrrr(rp;t4aptomieiys a2ulnmp u4aexoio3iatfa e nvo (0sexmim3oudaleelnvtls) 2tmu  ot0olenif3tytfs rl(mon(4trxoxf ta1fm eli o t)teumxopnu1lpt mneil() rra(  ;o0aptoioeild s2em(vpnt0tlxniocoadfmtean s;s0 2tmxr3nu1ol  micslt s2tru p;t1aptomfctaslsDrmn sn(4arxnir tytla  lu i;s)s2uoxopoy1ll emicta() rtau ooo0aetnifeiydlm2rluvo;()treoiociotfpteau sl(  etrirpno4lpe liesa(  Dtaxmpoo0ape mfetatfs ea(vonu4 lxomociodfmte u ils)s2xoxr ny1amt lneil( srrru o;u0teeoii3tyslmDelnms;(0 exnxf ta1fpteai ilt truoxr3nydllenlfctat)s2tmur oo0aetniocils m2rluvp;()tlxoio3to1om e ivilt s2xrio3iudlm   ietasfsruaxrpot0tpeoiiciatla2uan p t)alerio oydfm elues t  rurxo3nu1lpe liesat a2raum no0altnio3tytfa ulnms;(4 ltrmr3iytfat lnvs;s0 2xr(o3nydol elivtatf Dtm(mp;t0oexn oeildlsDel( s;u4altrmo ta1lmte neo t s2xr(r iudll  micsls  Drmu  ;o1opeoiociyslsDran pnt0aexoio3oatfateln i;t) rtmimpiudomeemfctlsf Draxrooo1apxo o3ilsla2ran s (4tetrircoytlpte ieo;t t2xmimpno1lmenlnes t)arrrxm oo4opx  ieils mDul(vsn(0areomo3iadlptelu i;(0t2toio3iudomtnmieiat sDraxr ;t0apen i3taslm2umn snu) lxoxr3ia1lptr n s ()sexoir oy4ome  ieiltf Dtr(r ot4tlxnmfeiadfmDuanvp t4arxnmf oa1op eaivs;t  2xrim iu1llenlfetas)aDta(mpou4oeenmf3iytla em(mont4tlxrif tydlm eau s t  2toxr3oodal  lfvsls)a2umx onu1apeo fetltfmDrauvsn(0alenxfcia1fptranvsl(  2tmir no4lm nmivsat) Dururonu0ole  ocildfs rmuvp;u)artoxo3iydopD lnei t0 rtoxo3no4ape lnciatfsDuru  no1aexnmoeiltfm rluvo t0 rxrmf ia1omt  ies s) eto(m3ny4opeelnvtat srurum ;o4ape mociatlm2umnvs () exoxf3oydfaDrlieolt0seumxr io4olen feslt)sDtrx ont0olx ioeiasla ul(mp;u4 etrmf3iotlptelueo t0 rxo(o oo1olt lneil(  rur(mpnu4aeen ociysla umn pnu)alermr ta1om eli s;t  eur(m io4ole lfvta()srrm(mooo4alxn fetldfmDeauvpnt4treoxfciytfa rlivol( trtm(opoy4lmtemiesls)s2tm(mp;u0tet ifciydfaDeluvp;u)aetrxfcio1oatraues () 2tmio iu1aptnmfet s)sDrr(rp;o0oleo oetytlaDuluvpnu0altnmocoy1om elnvs ()trtmxm3io1alenmnvi (  2rax pnu4oexoii3ilsla2umnvon()teeniocta1fmD ln s s)trumxopoy1ap elfesasf Dtaxr ;u1tet mo3tls sDumuvo;(4 lenio3iydopt au sl( srum(o no4ol elfvsa( sDrm(m ;o1tptomo3iasls2uln sn(4tlxnio oytlm   u sls)seurxr nu4olen fvsasfsDta(rpnt4tlto ictlt a2uau p;t0altnir3ta1omt  nvi;s)t2tm(o nu4lp n nct s srua(r oo0tpxomiciydfm eaumont)tetoif3tydfmtrau ol(0texrxopnodaltemfvtlsf Duaxm ot1altomfctysls2emu pnt)tetrmf3iy1lptrlivslt sexr(rpou4opt  fvias)srtr( o;t1oeenmieiasfm umnvo;t0 reoio to1fmDeliei;( seurxrpoudomtnmietl( sDur(mp;u0altnifctatlmDrlnvp (0aetnmr totlm  aneils teum(m3no4lptn nvtlt)artrx  no0oltoiietad mDeln snu4tltoio oo1opDe n o;t0sexo(rpiudom e fvt s sDuaumpoo0alxn octysfs2ul(monu4 lenxociadfpteauvs;() rtrim no4lme  fvtl()sDum(mpoo1oltn ieiatla2rl(vs;u0tlermf3iadoa  aneols0tetmio nu4am  mictas  rrm(moou4olx iiciytlsDra(ms;t0 rtrxfcoy1om   uvi (  rtm(mpnydome  nci ()sDuaxr ;o1ale mocildfa2uanvsnt4tltrmfcto1fp rli ilt setr(mpiydoptn nei t) rumum no1tlxnmfeiyt s um( o;u4 ltrxo iadoaDr nei s)s2xmxo oydoltn icsasfs2taxmpoo0apen i3ilsfaDum(vp t)tltnxocty1fp  anvs ( setoxrpoydop elnctls)sDtmu  no4aex iieiysla2elnmpnu4teeoifcoadfat au s s0 rtr(m3nodomt  nvsat) Dra(root1optnmf3iat m2ranmp (4 etoif ia1fptraueo (0s2uoxm3no1amtnlivilt)aDumxmp;u0oetn fetldfs2eaums;t0 rxomf3tatfp e u s;t s2trxo iu1ome mfcsat)s2tr(mpno0aexo octld mDra(mo u) exnif oa1lp e u o;t0sruriopoy1lmen fvsl()srraxronu0opxnif3tydfm emn p;t)altoioctadlateanvo;( t2tr(m iudoptn fvi sfaDtau p;o0tex mociasfsDemu o (4 rxoif todlaDeln i;( srtm(m iydale  iciat)srra(mpoo0olt ifcias m eauvp;u4 eeoir iydlaDe n s;t) rxrxo3no4ome lnvil(  rtm(  ot4tetomicilt mDua(mpnu0tetnmf3ta1lat aiei (0t2to(r3iy1alte ies ( srra(ront0ope  ocias sDum(vo t) exnxo3iytfmD  u slt) eur(m3no1openlfei ()sDra(  ;o0tpen o3tadfa2rm(msn()alxrxf3io1fat  u ilt tetoirpiu1lm   ivtatfaDtrxm oo0tptn i3ilt s2ul( s;(4tetomocto1op  lnvs;s t2uoir oydll   iet t sDrr(r no0tpt mf3iasla rmumo;u0alxrxrciydla eau sls0tetr(o3nodole mfcias  2uaurpou1apt micildlmDeau s u)trtnxociytopD  iei ()sexoirpny4lle  ietat  Dtaxrp;o1optnmoctlt sDea( pnu)teeoio3oadlateln o s)texrio iudap emncslsf Dra(  ou4texomfciadfmDeauvpnt0 eenifcto1fp r iei;() 2urim3ou4omenlnes t sDraum ou4opeoio3iysls2umu p;(4 leoifciodlmt  i i s srxmxr3ny4lp nmnctl(f 2tr(rp;t4opt ifeiadlm ua(ms u)aexoif oydlat lu s;s) exm(opno4lm emietat)arum(r no1teeoiicilslaDul(vo;t0 ltrmr oydoptraivi t0truo(mpnu1olee fvsa( s2tr( poo1texo ictasfm2eluvo u4 lenxf ia1fatr i ils)teuo(r3oo4omte netl(fsDuaur nt0openiociatla ra( s (4 exomo iodfa   ues;() 2xm(o nydapenlictlt)srtau oou4oexn o3iatfsDumums;(0alxrio iydopDrlnei s0t2xmxr3oudlm   nvsasfsDrrxmpno4alx  i3iysls ea(vs u0 lermr3iatfa e uvils srto(m3no4lltemfei tfsrrr(mpnu4tlen feiadlm ulu o;u4 eeoifcoydopt lieilt t2to(r3no1ol  lfci sfa2tau  ot4tleomfeiydfa2rmump;u0artrircoodoa  livs;s0setrxrpiy4lpt lfvils)s2umuro;u0aexo f3iltfmDua(vp t)tetrmo3tadoaD aieo;t trtm(m3iu4al   ivtat)sDrr( pnu1tpto ociltfsDelu o ()arerxrctydlptrauesls0 rto(r3iudamteliviasfaDraum no0openiiciyt a2ra( snt)tlenxf iytlmD ln i;(  rumxm3nudal n nvia( aDrax oot0tlto oeiatfs2ea(mp u4 exnmoctadfmD lu ils0 rurimpiy4ll nmfct t)aDrax o;o0tee mfctas a2eln o;t0 rtnmrcoodfa  lneils0sexm(mpno1lp  mfvils)sDururpoo0apen oetldfs ulumo;u4 eerxrciy1opDe n o;t)tetr(m iudopt  fviasfs2uaum no0opxo ietatla elump t0 eermf3todfat aues (0srtm(mpoy4apt  iet s) 2uaxrpnt1tet  i3ild m rauvo;u)areniocoodoa elueil()t2xm(o3iu1lm  mncilsf Draxmoou1tltnifciltlsDel(vp;()aeerif3oo1lmtrluvol(0t2toio3oy1ameemicslt a2rm(rp;o1oetnmoeiysfs2rl( s (0teerio oadla eauvi t  rto(o3io1lpee fct (  rtrxmo;u4altn i3iytlm emnvsnu4 lxoio3iotfate n ol( srur(mpnu1olt  nvtlt  rtaumont4altnio3ias s2ran s;()alenmo oatfmtelu o;(0 euoir3nu4om  lietlt srrmump;t4opt if3iat sDra( o;(4tetrio3ia1opt  n i;t)s2xm(o iudomeemieiasfsDta(moou4opt ioctltfmDranmo;t0 renif oa1la  liesl()texr(r3nodapenmnctl()aDrrxroou1aptnmietyd s2umump u0 rxnmo oytfp  lu i ( seuoiopnodolte ictas) Duaxrpnu1olt ii3tatla2emnms;() eenmo tydlp elueo ( s2xmim iy1omeemiei s artrum nt0tex moeiyt mDrmumsnt0 ltnmf to1fm rli sls)seumxrpoy1amtemfvs tfa2umum ;u0teen ociltfsDra( s;u4 rtnxociotfp rln s;s s2xm(r3no1lp e ncslt)srtr(  ;t0tlx  oeildls emumsnu)trtnmo3ootfmtean i;s  2tm(r iodaltnliciatfa2uaumooo4opxomf3tldlm2rmn ont0tlxnxocta1faD lnei s0 2xr(mpou1lle  fvi t) Dta( o;o1alt ioctlsfaDrmnmo () lenxr3totomte uvil( sexrxo ou1apeelivsls  Dumxr ot4opeomo3ias aDranvo;u4tleoifcty1la e ivi s0s2xr(opnudlpe lictlt)aDtr(mpot1teto i3ilsfaDem(vp t)aleoif iy1opDe nesls0s2xoxm nudomt lfetltfa2rrx p;o4tle  iciyt m elnvo;u4 lxrmf io1fm   n o s0seur(opnu1alte icsl(  Dra(rp;u0tpeo fctldfm raums;u)trtnir3ty1fpD an s;s) exoxm3iu4op  mfcs tfartmumpou0opeomfciydlm2ra( p;()artomr ootfaD lneslt) eumio io1lmeemnct t)srrrumooo1tex  fciad s rmu p;()aeenxoctodla rln i;() etoxm3nu1ll emnct ()artax p;u0olt  ieiys a ua(vs (0teerxf3todlaDe i ol()s2trio iodlm e fcsa(faDuaxmp;o4tltoiieiys m2ra(mo;u4tlerxr3oodlpDraueils  exmim3ou1lltnmfvil() rtmx  nu4opx mo3ilsfs em(vp t0 renmrciadlp eau olt) rxrxr3io1lm   fvtas sDuauro;t4aeeo ieiatls2eau o t) lxoir todop  ln il() eum(mpiudom emicsls) rrax  ;u4olxniociyd mDraumont) eenio3oadfaDr n i t)t2trio ou1opte ivs s) Durumo;u1aeen fciydfaDulump;t0 eenmr tytlm  an slt0 2toir ny1lmt  icils)sDum(mp;u4texn o3ild a2emu onu0tltoio3iatfa   i s (  2xrxrpnudopenmfvs tfarrrx ont1teeomf3ilt m elump u0trtnio3oa1lpDelies;t0s2umxm io4altemict t)sDtrxrp;u4olen ociltlm2elu onu4tetrxf3tadfmDelu il( t2to(o oy4op nmfvsas aruru o;u4oet iociys a umn s;u)treoxo oo1la eauei;s0s2xm(o oodll elnviasfs2rmurp;t0alx  f3tyt sDemumo ()aeeomo3iydlateauvi (0sruoir3oodlpe  nvta( sruaum ou4aet  f3ias a2uanvpnu)trerxr oodoaDr uvsl() rurxm3oo4olenmfes t srtmu p;o4oexoif3tasfaDumnvo;u0 etoirciatoa  ai o t truoimpiy1lmenliesltfs2rru onu1oexnmf3ias sDean o;u4 reomo3ty1laDr nvils  rtrxr3nu4lpt mnvt (  2ur(mooo0tptnmf3tyt m2el(vo u4 exnmr3ta1opD  ivilt0 rto(opio1lltemnctl( arur(monu4ole moeiydls2ra(vs u4texnxo3oy1op   n o t0texmxrpoy4lp emnctat a2taumpno0tet moeiys a ea(mont0 rxnxrcia1om raivi s0 rxrir3nu4lltnmivtat srra(  ou4ape if3ilsla2um( s;(0texrxocto1lmtrln slt0texmim3oudalt  ivsat) rrm(monu0opto fetatfsDrmnms;t) lxrxo oydfm rlivo s)trum(m3io4olenlfesa(fsrrrxrp;t0aexoioetas a ea(vonu0alxoif ty1lpD aneols0seurio3io4ope lietls artr(rpot1aetnmo3ildls umumont0tlermo oadopDraiei (0 eurxm iu4ap n nci s s2ua(r ou1teeo ieiydla ea(vo;t4 rtrxoctatlpD li sl(0 ruo(m oo1lptn fciltfarurxro;o0oltomoetlsfa2eln o;u4 etrxo3oa1lat  neol(0srtrimpny1amtnmivt t  2uru oot4texn o3iatfaDrmn ont)tleoio tydla r i sls  rtr(m oo4apeemnvi t sruaur ou1tpenifeiytfa ulnmp u0trxrxrcoytoptr u o;()seto(o nu1al elfeilsfsrumxrpot4texnioctytls ulu p t4arxoxfcoadfptr i ils) etmio iudlmee nvils  2rax p;t1tle  fciydlm eanvp t)trerio3to1fm rluvi;(0t2xmxopny1op e ieilt sDtm(r oo4texoiieiatls emu p;()aeerxrciodop  ai i s  2tmxm iy1llt mfes t) Dra(ro;u0alen fetys m ea(vs;t4aeeoio todlm e nei;t0texm(opnydlltemicias sDtaum oo1optomoctydfm umu snu0treoxr3oadlmtean i;s) 2tmirpoydop nmiet sfsDraump;t0aeto f3iys a2rl(vo;(4 rtnmocoy1lmD lnvs s0trxrim3oudolt lict s aruaumooo1olt moetltlm eanmo u4arermf oa1lmD lu o;s trur(opiu4altemnvta()aDurx ooo4oleniictytfa emnvpnt0 etomrcto1fa e ieslt) rxr(o3oo4lpenlnci s)arrmxm ou1aexniietydfs2eau s u4aetoio iotlaD luvs t truo(opiodal  mfci t) Drm(mpno4tpxnmieiadls rlu s (4alxomfctytom  aivi;s sexo(r3nu1ale lfcs s)aDtm(root4alx iietltfs rau o t4 eenxo3oadfp  au i;s0 2tmim3oydal  mfvias s2rauro;t4tlx  ieiltlsDul( p ()trermr iadlpte u slt0s2tr(m3nydllt livs t sDuaurp;u1aexoifeiydfm rlnms t0tlenxocootomtrluvs;t0setmio3no4aleemncsl( srrmxmpoo4tlxnmoetldls rm(vsnt4 ltnxo ty1lpDranvol(0 2uoxm iy1lpeemiet s)a2uaxroot0tpxomiciytlm el( snu4alxoxr totom  auvi t0texrim oydomt mnciasfsDtm(mp;u4olxn fetls s rlnvs;(0treomo3oo1fp rluvs;t)truoxm3io1ape mfvtl( aDurxrpnu0opto i3iat m2umnmo (4trxrmo3iy1op  lies t teuo(m no1llt licil()aDrr(mp;o0oetoii3iltlm2eau s;()aeeomo3oodlaDr uvs;()t2toxopno4lpen nvsas)arumxr oo4alto feiydlsDuanmo;t) rxomrcia1fmDe nvo t) 2xrir3iu4amtemfcs ( srtmxmo;u1aet iieiatfsDua(mp;t4tetoxf3oytoa raivol(  exoiopio1om  lnctl()sDuaumono1ape  icildls2eluvp u4trtrmo3oadfa  lneols0 rur(r oodop  lneta(faDua( pno4tlenifciyd m ul( o;u4tetniociadlaD ln s;t t2xmio io4apeemfciatfarrmxmono0teeoio3iysfm rm(mo u0alenxfcty1fmtr uei t) 2xo(rpny4omenmncsa(fartrxr oo1oex  ociysfsDra(msnt4 ltnxf ootoa   i ilt) 2tmxmpnu1ap  mfes sfs2rr( pot0oex io3iatfs2el( o;u)aetnxr oy1lpD aneo;t seuo(o3io1ol e icsl(fsDua(m no4teenioeias a umuvo;u4arxnmr iodomDr nvs ()s2uo(rpiodalt lfesl() Durxr no4texnmfeild a2ea( p (0aeermfcoytfatrln s t0 2urim3nudamtnmivil(fartrxro;u4olxo oeiatfaDeau p u) lxomr tytlmDelivs;(0seto(m3ou1aptnlneslt aDrrum ;u0apxn fetadla2rlnmpn(4 lermo oytfaD  u slt srtr(o3iu4oltelfeils)aDuaxrpnu4oetomicils aDulnvpnu0trtnifciy1oatrauvs;t0 exoxm3oy4aptn nesltf 2taxmont4apto ieiadlsDeanmp (4tlenif tadlp rli ilt) exmimpoy4amtn ncsas) 2ta( oot0apto ocilt mDumu o u0 lxoir3totfa rlieo;t s2toxr ny1ol nlneias)s2urxro;o1apto fetlsfs uaumo u0teeoifciadfpt  ieols0 2xmxo3oudaptelnvtls a2ta(rpnt1oeenii3iltfa rm( s (0teenif iytoaDe uei t0t2xmio3iudamtnlnvsls  rumuront4opeomocilsfm2rm(mo;t)aexrxo tatfat ln i ()srtrxr iodopenlnci tfarrru  nu1aet  ieiydfm2eln o ()texnmo3ta1fmtr uvs (  rurir iydlm  mfvia(f Dtmxmpnt0aex mfeiasfa2ul( p;t)tltrxrcoydlmDr nei t0sexoiopio4apee ncs (  Draxmonu0tetoioeiadfa2rluvpnt4 ltrxr3iadop rlnvs;t  exoim oydapee fvs ( srua(r ou4aeenio3ils aDrm(mo;t4 rtrmrctydfpte ivs ()sexrim oy4ale  fcsas)s2rr( poo4aeto fetyd mDrm(ms u4artnio3oydfmtrlnes;t)srxmxr3nu4op   nesl( s2rru  no4tpt ifcilsfa2rmumpnt0tetoio3iotlmtean i;(0s2uoir iu4ol nmfvi () rtrxr no0aexo ietadfa2umu s (0 exrmo oadfm r ieolt)trxr(m3iudlle lfvt ( sDumxrooo1tptn fetysfs2ua(vsnt) lxomfcoytoat  n s t0s2tmxm3ou4lptnliesat s2trxr ;o1open f3iadla ra( onu)arenmr3oo1fmDrli i s) rtmiopoo1oltemfcs t)sDumxmont0tptn i3ilsfs2ul(vs u) rxomo3io1omD aneo;t t2urxo3oo1omt  fvt (faDrrxrpou1tpxn f3tatfs ulnvpn()arxnir3ty1lmt  nvs t srxoiopou1ameemfcils aDurxrono1opeomoeiaslm rm(vp;u0aetrxo tadfa  auvil(0s2trxrpoy4omte nesa(fa2tm( oou4texn ociys a2ul(vo () rxomocta1lmtr uei () rurxo3ny1olenmfesa(f rua( o;t1tex  fciltlsDrmnmp (0aexnxr iadoaD anvsls0 rumxm3nu4op  lnvtas arumu pno1aleoiicilt sDem(vp;(0 rerxfciatomDraues;s)srum(m3ny4lp nmnctls)artm(moou0oltn i3tadls2eaums;t4teeoiocia1faDrai i (0 2tmiopoo1ap nmncsl()srtaum ;u4aee mfetytlm2uln s u4aetomo3tydfmt anvo ()t2tr(m3ou4lm e fes (f Dtrur ot1tee ioetaslm rlumo t0alxoxf oy1oa rlieo;()texrxr3no4op nmncsatf Dtmu  no4opeomoeildla2emump (4 leomocoytfmte ivo;(0tetm(o3ny4lpenmivs sf 2rmumoot4aee  fciaslm2umnmp u4tetoxo tytla e ivslt) etrxr3iydol   neta() rrau ono1olxo octys a2el( o (0 lermocoadfmt auvi s)tetm(r oo4lmtnmnesas s2umxr ;u1tlenmicild a2uaumonu)treoio tytla   uvols) etmir oydop  mfciltf 2um(m no0olx  i3iytfa2rmu s () lxnmr3oodop eaueolt0 ruoxr3ou1lpt lnvil()s2rmxmo;u0tlenmiciasls2elnvs;(4tetomf3iytfptelu i;s)srxoio no4amtnmfvsat)s2trx  nu0apxomieiadlaDumn pnu4aetnxociodomD livsls) exm(r iu1lpt  ivtat artrxmpou0ope mf3iasfaDua(vo;t)trxrifciotoa eaivsls0trxmxm3oy4lpee fctls) 2tax  ;t4alenif3iysfa2eauvs () exoif3oa1oat li o s0 2xrio3iu4lm emnetls aDtr(m ou4oeen i3tys mDeau pnu0aetoio totop e nvo s0t2tr(o3iy1lm nmfvias)srtmxm no1tpx mf3iys s uau pnt4altrir3oo1oateluei;s0srur(m no4ope mnvtl()sDra(r ;u4oexo o3ils s2elnvonu0tetrmf ta1fmte n sls0t2toxrpou1ol nlfvtas  Drrxmpot0opt io3iyslsDea( o t) renxrcoatfpDe uei;(0s2umxm3no4lme lnei s)aruax  nt0oeenmo3ilslm rl(vo u4 lerif iotomDrli i;()texrir oodoltnmnvsas arumxro;u0opx  o3iyt aDrl( pnt0aexrxr3todfp r ivslt0tetoir3iu1lptnlncilsf 2rmurp;t1ape  icilsla eln o;u0aexomrcoytomDr ues s  2uo(o3iudopee fvta(  Dumx o;t0alx  o3ilsfs2rau s t)texoxo3iadlp rlnvs s)t2xr(m3no1lm  mivsa(faDurxrono4tlxomiciytfs em(vo;t)arxoir3totopteau ols)s2uoir nydll elneil(fsruax  nu1tlx io3tat mDeanvo u)tlenxfciadlp raneolt)srumxopnodlptelies s a2rm(rp;u0aet  i3iat a raumo;t4 exnif ia1omtrai s;t) eumxopou1amt mncsa( srtrum ot1oetoiictad a ranmo u0 rerxr ty1la   ieo;()s2uoxr3oudll emnvt s)s2um(  no1optomi3iys mDua(msnt)aexrir iadopDeai ilt t2umio nodap elfciltfsDrrxr nu1oetomf3iyslm emnvont4artnio3oadoptr uesls)seurirpny4ap emfct sf 2umump;u0oetoifciyd a ran p;()alxomr ty1lmt li s t)s2tmimpiu1opee ietls)sDrmurpnu0tee  i3tlsla2ean s (0 etoifcoo1omtelu i;()s2tmxr3iu4opeemfetl() rtm(mooo1tee  fctydlaDuau o (4alxnif iadfpt lnvol( t2xoxo no4lptnmfctltf 2umu pou0oetn oetadlmDrmn s u) lxnircoydlat aies;t t2urir3iy4apte feiat srtrx  nt0tpen fciltfa2rm( pn()arxnxfctotfa  an i;t0sexrxr iu4altn ncsa(  rurxmpno0oetoif3tas a2ua(vp u4aexrxo3ta1fp rlivols0 etmio3ny4ol   nvil(fsDta( ont4aex  i3ilt sDelu ont0aetrmf3iadfmte i ils  2xrim3ou4lle mneia(  2uaxmonu4opxn i3tysfa2rl(mon(0 rerxo totlmt ai slt  etmxo oydom  mietat  rur( p;t4opx if3tlslaDelnvsnu0alerirciatomD  n sl() eurirpiydlltnmfcs s) rtrxrpnt0olenmfciltfsDul(vsnt) leoio3oa1om eliesl(0 rtm(mpnu1lp e ivi sf Dumx poo1tlxomf3iytfs ea(mpnt) exnircoodfpD aneol( t2tmxm ou4apt lictltf Duaurpnu1tptn o3tatls rlnvo (0tlxomo oodlaDrlu i t0 etoxo nu4lltnlivsl( aDrrxrpot1olx  f3iad mDumnmpnu)arxrircoa1oateluesls s2uo(mpiy1omt lfeias  ruaumpnt4ope mf3iaslmDrauvp;(4aleomf to1om ran ils s2to(r io1oltnlfeia() 2rm( p;u1aleomfciytfsDrmnmo (0 rxrmr3tydfa  luei;t0seuo(r3io4lme  fei tfsDtaur no0tltnif3tydlaDrl( o;u)texnxo3iodop  auvs;s) 2toxr3ou1lltnmieil()aDum(r ;u4olxo f3iydlm ulu s u0 eeniocty1faDeanvolt truo(r3nu1lme mfesat aDurumo;t4tlxnio3iydls eluvp;u)trenio3tadlm e ueo;t  2urir iu4om   ivias) ruax o;t4oet mfeilt a2uau pnt)trxnxrcoadfp   uvi;s seuoim iu1openlfct s) rra(r oo0ale ifciysla rmu sn(4alxomfcta1op r nvi t)truoxrpoy4apee neia(  2rm(r ou0oltoifciys sDra( pn(4trxrmo oodoa   i o;( s2uoio ny4lpt mfetl() rtr( oot0aetomociydlm ra( o;(4tleomrcoy1lmDrluvo ()t2toxo iy1omee fei sfs2ta( pnt0oetnif3tlt m2eaums;u0 rxrioctytfpD ln o;s tetoiopno1ome  fctltf Dur(ro;o4apto octytlmDeanmpn()alxnif3totlpD an sls) exrirpoo4amtemfet s)arur(rpot1tpto fctytfs umu pn()altoircty1omD an o;s)t2tr(m iu1lmen fet s)sruau  oo1tpeo i3ias a ulnmo;t0 rerxo3totfp   i olt)seuoxr iu4op nlies t)arrmxrpnu1tptomfctysfsDulnvo;u0arxrxrcoytlpDe u s s0 euoxr no4am  mnet ( srtaumpoo1tpe ifeildfa2uanvp;u4 ltnmocoodlpte i o;t  ruoir ny4alen nviat aDuau  ;o1tpxnio3iytfs2ua( pnt0tetrxf ia1la  lnvo t) exr(m iu1om nmiet sfs2rrumooo0olenif3tatls elnms;u0 leoxfcoo1omt  i o ()tetrimpiydlm emfesl(f rtrxrpnu4aee  feias mDuln o;t4tltoif3tadom   nvi s)srur(mpiu4ame  nvtl()sDraur no4altn f3iys m2rmuvo;u)trtnxrctatoa r uvi;s)t2umimpiu4amenlieta() 2rmxmp;t1apenmoeiydfa rau pnt0artrio to1la rau s s)s2ur(rpny1op elncia( arum(mo;u4texomfetad aDemuvp u4 etrxr iytoatrliesl(0 2tmxo no4omtemnci ( s2trx  ou0aeeoif3iadlm2elu o (0 etrmf3iydfa eln i s srtmxm ou4am emfvtas sruru ono4tee  oetld sDum( ont4tlenifcio1fp e uvo;()srxrimpny4al emivi (  2raxrp;u0olxnmoetydfa2uan pnu0tlxoxoctodomte i il(0s2xm(m3oo1ame lncias) 2ra( pno1oexnmieilsla eluvs (0arenif oytfpDe n o (0 rxoiopiodolenlfvs tfa2ua(m ot0altniietlt s emumo (0tltniociodom  luvs;()t2ur(o io1am  lnvtasfsrumu  ;t1tetn fciadfa2uln s (0tltnxoctadoaD  ueo s0texm(rpoo4omenmicsat s2tm(  ot4tleo o3tydls uauvonu0tleoir oatfp   uesls  2tmxo3iudale lfct ( srtrur ;u4olt mociad a2rl(vpnu0tetoio3iatfmt  nes (0 eto(r ou4aptn nctat aDtrxmo;o1oleomf3ilsfm emnvs u0tetomrctadfp r ieil(0t2uoxmpny4lltnlnetl() rrm(ro;t4tpxomi3ilsfm2ua(ms;t0tltoio ia1fmtr uvi;s) 2umir iudapee ivs (f 2rr( o;u1tlenmf3iad s eln p (0alermr3iotlm  lnvil(  exoimpiu4optn nvs tf 2tm(ro;u4apeniiciyt s2ul(vs;(0aexrxr tadomDeli ilt  rumiopiu4ape lfvs (  2tau p;u0opxnmi3iat mDemn o u0altnxo3iytfmt  i o s s2trxm ou4amee netasfsDrru ont4tpen
\ No newline at end of file
@@ -0,0 +1 @@
+nei;(0 exrxm iy1alt  ivsa(fsDtaumoou0tptn o3iadls eau o t) reoxo iatom  ai o;t) 2xoxopoudlpe livil()arraumono0tpeoiieiad m2em(vsnt0altoxf3iodlaD anvi;t  rumxr nydap elict t srua(m ot0aeenifcild s ra(vpn(4aetnir3oytomDraivslt)truoxr3iu1amenmivslt s2uaur oo1ope mfcilsfm2rmn pnu4artoircoy1oaDeliesls  2umxr io1om  lnvta()sDtrx oou4aeeomfctysla2uluvont0alxrirctatfmtrln o (0s2xoxmpoudal nmiciat artr(r nt0alt  feildfmDea(msnt0 rermf3tadfmDean o s)texrxopnodapenmiet (f Dum(mp;o4tlxnmo3ildfa ul( p u0tlxnxo iatfp rlivo;s0teuoir oudal  mfetasf 2truroou1opto o3iatfm2ulnmp;()trtoio3oydoate uvo;t)t2urxr3nu4lme licias aDrmx  nu1opx mfetatfs2rmn snt0tltnmfctydfatrli slt  2tmir3oy1lp  mfvs tf 2rrxm ou0opt moeias mDem( p (4teenxo3oodlp raueils0 2ur(opno4olt mnvilt) 2rmx  ;t1tpx  f3tltlm2uau on()tleomr oo1fat lies;t  exo(o nu4lleelicsat srrr( pno4olx mfctlslmDumn p (4 rxrircoadfaD  n i;s)s2xr(opnu1apte fcia( aDurx onu0ale ioeild a2el( pn(0areoircoatlp eluvi;s)truoio3iu4ll nlncs t)artmxr ot4oex mfciatfs uluvpnt0 lxomf iydfmte ivo t texmim3nydlptelfei tf Durxr nt4tlto f3ildfa2uanmsn(4 lerio iadom raivs s)s2uoiopoo4lp elfesat  rraxrp;o0opeo ictlt a ulu s;u0 rerir oo1lptr nvi;( s2umxm3io4apenmncsat)sDtrx p;u1alxnmociydlm el(msnt) renmo3to1lp raues (0 rxmim oy1amtemnei ( arrr(mono4tptnif3iyslsDeanmo t0 lxrmr3ta1oa  ai i ()srxmiopoo4omee fesl(f 2tr( oot0opx mieild s uluvp u)trtnif oa1fmtelnes t)trtrio3ny4lmtnmneil(f 2ra(moou0tet  ieiydls rmumsnt)alenxo tadlaDelu s;s0sexoir oy4om emnvsatf Dum( pnt1aeenmfetysfm2elu o;t)tleoxr3ta1omtranvilt  exrirpno1lptnmfet ( arumum ;t4tltomietytfaDrln p u) rxnxrctydfpteluvi;s) 2urxrpio4lltelnvs s  rtrur ;o1oex io3ild a umuvs t)aeerio3oadfm  ai o;s) eur(rpoo4op  mfvsat  Dtrumo;t4altnmi3iasfaDeaump;u0altoif3oadom elnvs t) 2um(m iu1ape  ncsas  Dtmxm ;u0tltn oetatfm uauvs;u)aeenio tadlptraivo;s trxoxo io1ol   fvi sfsrtm(ro;t4alxomociydlsDuluvp u4areoir3oatfaDelnesl(0srtmxm oo4lp e neilt) rrm(m ;o0olx mi3iltfm2ul(ms u0trermf3ia1fmD ln o;(0trxmirpnu1lptelietas)srumxmont1oleomf3ild mDuanvs ()altrif todlaDelnei s) 2xoim3oydlm  micsl(faDrmxrono4aex ifeiysfaDra( p;t0tltrmf3iadfmDr ivs;t)setriopnu4amtnmfetlt)a2ur(rooo0teen o3iltla ra(vo (0aexnmf io1omtran ols trtrir3ou1lm   ivi t s2uaxro;u1olxnioctltfmDrl(vpnu4 etriociatfaDeau o;t0s2urimpio4apen fvia()srtrxm ;o0aexoioeildfm2ranvo;t0artrmf tadoaDeluei;t sexrim3nodop   fet t) rua(  ;o0olxo ocilsla emu p u0alxomfciytopt  ivi t)s2xm(rpio4lleelicsa(f 2uaxr ;u4alt  fciltls umu p t4 lenmrciytomD  ivilt0seuo(opny1omtn icia()a2um(  ;u0opt  o3tldlmDuaumpnt) lenxfcoodla  lu o ()srumir3oy4omtnmnesl(f rtaumpoo0ole mo3tlt a emnvp;t0artomo iytfp ran o ( seum(opnudomen ics ( s2tmumpot4apen ieiadfs rl(msnu0teeomo oa1lp rauvols)srxmxr oy1lpen fcils)arumx pno0aeeomocilsfm2ulnvs;u)tlenmf3iadoaDr ues;()texr(o ny1lltn ncs () Dum(mpno1tlx  o3iltfm ua(ms t4 exnxocoodlaDelivo s0setoxo3iu1ll   fet s) rtaump;t4oetnii3iatfa emn o t)alermo3ia1opDeliei;()trurir3nu4am nmieiat) Drmu pno1tee mf3ild sDum( p;u) renxrciodfatr ivs t srxr(rpio1omtn nvsas  2tr(mpnu0oeeomoetydfs umump t4arenxo iadom e nvs;t0setm(m io1lme  ictas)arururpot1tleniicilsfa ua( s;(4tlerxr3oo1fmteln i;s0srxmxo io4ll nmfetls) Dumur ;u0tlto fetyt s ulu p;u4 eeomfctodfaD auvi ()t2tr(o ny4am nlieiatf Duax  nt1apenio3iyslaDrln s;()aeenir3tytfpt auei t0trxrxm3oydol nlnvs tfsrur(r no0tle mictldfm rmuvp ()trermfcoytfm  luei (0 ruoxopoydal   iviat)a2trxr ;o1tlx  iciytla2rmu s;() rtoxr3oadfmD lu ols0trtrim nydlp nlfctls  2tm( o;o0tlxnmfeias a2rmuvpn()trenif oytopteaneo ( seumxmpoo4opt  nviatfsrrmxmpoo4optnmfctysfa2rl(vsnu4tltomr3tadla rlu i;t0srxm(opio1ap  lfcta( a2ra(mpot4opxo fctysfa rmnmont) rermf3oa1op eai olt)truo(rpou4op  lfeta(f 2taxmpoo4aeenmi3iydfs2raumon(0aeeoxfcoadfpDr i o;t sruoirpnu1alen nvtl( aDrrxmont1texnmfctysfsDrlu o;u0 eenmr3todla elnvo s0s2xo(m3io1op  lfetlsfs2tm(ront4opeoiicilt aDrlnmp t) lenif todop eauvils  euoir nydalen feslt) Dua(ro;o0aeto ieiyd aDum(mo t4tlerxf3iy1oaDr ivs t0 2xoxmpoydole  fvs (  2rrurpou1texnmieiydfsDrlumpnu)tlxrxr3iy1fat auvi s0 rxoxm3iydll  micta(  Dum(mp;t4oleomfeiadla2el( pnt0 lerif3oatomDrlu olt) etm(r3iy4ame lici s)s2trurpnt1tpt io3tysla2rlu o;()tlxoxrctotop e nei;(0 rxoxm no4al emiet t)arrrump;o4aeeoifeiadls rau s;() rxrif3iodoa eliei;s0 rxm(m3oo1ame mivsls) rtax  ;t0tex iieild sDumnms (4alxoir3tadfa   neolt s2xr(opoodlm  mneilt srrmu pnt0oetoiictlsla raumpnt4 rtoxf ootfptelneo s0s2urxr3nudaltelncils sDur( p;o0aeenmo3ilt a2umnmp;(0aeeniocta1om  ai s t) 2xo(m iodalt  ivi ()aDrrxrpnu0oltomfcilt sDuanvo;u) lxrxr3tadfa  auei;s)trxoxr3nu1lpe mfvt s)arrrur ;o0openifetlsfmDrmumo;u0teeomo3oodop   neslt trurim iydlp  lfesatf ruaxmono1olx mocildfa2em( sn(0tetnxr tytfptrluei ( srtr(m3iu4apeemnvtls srrr(mpnu1olen o3ildfa2ulnvsnt0altniociodfmDean i;() eur(o oo4ol elfet s)aDur( poo1tpx  oetasfaDrmnvsnt4alermo oydlp e ueo t srtmxrpiydopeemnvil()arumx  nu4teen oeiasla2em(vpnu)teenxoctotfaD li o (  rxrxr io4apte fvtl( sDraumono4oeeo f3iadls rmuvs t4teenmf3tytlmte u s;s) exr(o3nydlp n fes s  rrmxmpot0aex  i3tasfaDrmu o (0alxnxocoa1omDeauvi;t)t2xoio iu4olen nctl()srrmum ;t4texn o3iatls uaums;() eeoifcta1fatr ieils teuoim nodom n nvs t  2umxmp;u0olt  f3tys mDuluvpnu)artnif3tytfmDe n s ()seuoir ny1oltn neilt)a2ta( ooo4olxomocild mDumump t0aetnif3tydfatrauei;s0setoimpnu1ape mfctatf rrr( pot4tltnmi3iydlm umu o u)trtnio3ia1om e nei s texo(mpio1llt  nvtl()srurumonu1tpxnmiciadfs2emnmp;u4 reoifcia1oatrauvsl( t2xm(o ny1lp n fci (farum( poo0aee  f3ils s eauvpn(0tetrio io1lmDeaivol( trtrir3iodll e neiasfsDtm(mo;t0tee mfetyslm rln s;()trxnmocta1lpt  i s (0s2xmir io1ope liviat sDuau onu0tpx  oetad a ea(msn()texrifciydoptrln olt0srtr(r3io1lptn ncslsfa2tru  no0tptn f3ildfs uanvo;t)alxnxr iy1fmt  nes;s0srtrxm no4amtnmfetlt)arurx ono4teto ictld a2emumpnt)tlermo oy1lp  anes ()s2uo(rpoo1ap  mneslt a2umxmonu4apt  icilsfm2rlu s t4trerxrctydoa r n o;t sexmxm3oydll e fet tfarta(r nu0tltomietytfs2emumo u4 rerif tydomDeluvo () rxo(m3io1ame mfvi s s2urx pot4opxo feildfa2ua(mp u4alerxr ty1fp  anvi;() etr(opio1lp emici sfsDraxrooo1altnmoeiytlaDrmuvs u)tltoxr3tydfm  ln s;t trtriopoydame  fvtl( s2rrumont1aetn o3iysfs2el( onu) renxr3todlmDe i sls  etmxm oy4ol nmnviasfsDurum ou1opxnmoctlsls2elump;t) exomo3tadomDr n i;t)srxm(m iodlmee nvilt)sDuaxrono0aptoif3iltlsDumumon(4alxrmr oatfaD anvi;s0t2trxm iodlp nmiesa() Dtrxm ;u1tle  octydfaDrlu o (0texrio3oo1oa  lnvo;s0 rxmxm iodlltemiet s s2rrxro;t1ape  i3ils m rmuvsn()artnmfcoatlmt an o ()srxmxopnu1lmenmnvtat) 2ua(rp;u0oetomfeiat s2rluvs u4 lenmocta1lmtran olt)truoxr3iudomee icia( arua(  nu0ope  ocias m2ranvp u0 eermf ootoa rauvi t)s2umxo3nu1lme  fetls)srur(roou1tpeo fetad s2rmumpnt4tltrmf ootlatr ivs;(  2to(r3oo4ope  nvs s aDrrur nt1oeeo octyd aDumn snu)tltnif3iytfpDrlivs s0 2tm(o3oodopeemfvs (f rtmxr ;u0tlen f3tat a rlumpnt4trxrmo oydfm r ivil( t2xmiopnydlme  icil(fsrum(m ;o1texn oetys aDulu pnt)teeomociadoaDraiei;( s2urim3iu1altemfes ( a2tm(r ou1aexnifciltlm ulump t0trxnif3iytla   ieils trtrir3iydal nlnetlt) 2ururoou0tpxoiiciyt s2em(vs;t)aexrxrcta1oaDelneo s0t2ur(o oudolte fesls  rumxrpoo1alx  i3tydfsDuan o;(4altrioctodfmD liei ()seumxo oo4lpt lfvilt)arrr(monu4aee mf3iad a uauvpn(0 eerxr3ootfmD luvs;( teum(opno1am  mfetl(fartaxmoou0apxo f3iydlsDrmnmp;()tltoir3ty1fm  an i;t) etrir3oo1lpeemfesl( s2urxm nt4aetnioeiysfa2rmnvo;u0arerxrcto1oaD  i ils0seuo(r iy4alenlnvi s)sruru oou1tltnio3iadlm elu p u4aleoxfcia1lptrauvs () rtoxopiu4al n ici s) rrru o;u4tlxniicilt mDul(vont0 rxrxociatfpteau sl(0trumxm3iu4amt  ivtl(fsDtaxmonu0olenmfctadla rmnvp t0 etnircoa1fmtr ies;( srtrirpnodapenmfet t)srra(mpno0alxo ieiytfmDelumont0artnmr3tadoa   ivs;( trtr(opiodap nmncsltfs2rru pou1olxomfeiasfs el( snu4alxnxfciadlmDeln o t0s2tmxm3iudoptn fet (fsDra(m ;u1oetn oeils aDrm(vo ()tltnmrctytfat aiei t trxoxo nudale lnesl(f rtm(  nu1opxn i3ildfs2ul( o;u0teenifciadoa r ies s) 2ur(o3iodopte iviat)aDraum ou4apx  ieils s2elumon() rtrirctydlmtr neo t0texr(mpnu1lleelfvtas) Drmx pnt0tex mociyd a rmuvp u0trtoxocia1lmt au o;s0t2xm(r3oo1ap nmfet t arua(m ot4tpenmictlslm eanms u) ltnxfciy1fmt an i t)s2xmxopoo4opte fvs () Durxmooo0tlxo ieiat sDea(vs (4 leniocoy1fmD luesl(0sruo(opnu1am n fvilt)sDrrxr ;t0oexomfciysfm2umuvo;u4artniociotoa  aivi;()trtmirpiudame lfeia(  2trurpno0opeo feiad m um(mont4aeenif oadfpte iesl()trtmxm3nudlmenlfvia(fa2umur ot1opx  fetyd m ua( o;(0tetnxf3io1fmD lues s0 2trxrpou1ole  fcsl(f Drrxrpnu0tptoiiciyd sDem(vsn(0 ltrio3iytlp   u ol( sruoxo3iy1aleelieia(f Drmxmono0opx  i3iadlmDrmu o u4 renif3tadlp eaivi (0 rxmim oo4omenlfet s aDtrxm ot1aetnmiciat a2ulu p u4 renirciydfaDranvilt) rxr(m3io1om  lnvt ( a2uaxmpnu1altoifctltfs2rl(vp u4 lxoio3tatlmte uei s0t2xo(m ou4op  mivils)aDtau o;t0tlxomfeiadlm2eanms;u) rtrxrcoy1laD anesls  ruoim oy1llen iesasfartau onu0tpxomf3tydlsDrmnvs u4 exomrciy1op raieol(  euo(rpoo1lmt lncsas)sDur(mpnu4olx iictyd s rau s;t)tetrirctatomtelivols s2xr(o iy4llenmicsat)sDrm(ro;t4olx  ociys sDemu o;(4 lxrmo3iytfaDeanesls t2xr(r3iy1ol   net s  rtaum ot1openiociytfsDrau s t) exrxrcoodlaDeaieolt0tetr(mpoo4lpe lneias)a2ururp;u0tpto octld a2ua( snu4tltnxocio1omtelnvi;s)s2toimpnodomtelfvtlsfs2uaumonu4aeen oetldfs ranmo;u4 rtnirctytfp  au o () eur(rpno4lm  mfcs s) 2ra( p;u1aeenmo3iltfa2el(vo t0trtomrcoydopDe ieo t0srxrio3nudlptemneil( aDrmurpot4tleomfctldfaDua( o;u)texrmf3oatomteluei t srumim3iydopt  fvs t  rraxr ;u1tetnmfeiltfa2ua(mp u0artrxr3oy1fmt lnvi ( texr(o3nu4ame  fci s)s2rmu oou0texoif3iatfs2eauvonu4 etoxociatla   nvo t0setriopoy1opte nvtls sDur(r ;t1tltn oeilsfa ul( o u)tlxnmo iydfm  lnes s0 2tm(m3io4lmtelietlt)sDururo;o0tpeomfeiat m umums;u4 reoif iy1faDran i;t0trtr(m3oy1om  mnvt s s2taumonu4texn ietldfm emu o;t4aexrmocoo1fat au ilt trxm(m oo4lpenmici tfsDtau poo0tee mictlt aDumuvsn()trenxociodfpDeln i;(  2tmio iudll e fcils) 2rr(mooo1ope ii3iadfaDumn s;u) lenmr3tydlmtrli s s) 2uoiopiudal elncil(faDrm(r ;t1optniociltfa2rau o () ltriocta1lat lnei;s)trxmxmpiu4lp nlfctatfsDumxmo;t4aetoioeiys sDul(vp t4aeeomo oadfmDe ivo t)srxrxo3no1lmenlivtltf 2uru  no0tpxoii3iydlmDuau o;(0artnioctodfatr u olt) etoxo iudlm e ictls  rur(mo;o1aet  fcias m2ulnms;u4arxnmf totoa  li ols0seurimpnudlpe  feslt a2uaur ;t4opxnmiciaslaDrl(vp;t4aetrmr oadopt lneo;s  etriopnodomt lfvsatf rta(rpou0olen octas s ulnmonu4aexnmo3tadfpD an o t)trto(r ou4al nmnet s  rtmx p;o4oltomoeils s ra(vsnu) rxrmr to1oa  ai s ( srxoim ny1lm e iet t)s2ur(rono1aptoiocias a2ulu s;(0alerirciodfa elnes t)t2tr(r oy1oltnmfviat a2rm(monu1olx mo3tadfs ul(mp;u) etnxocoydfmDr u s;s0 exmxm ou4omt  fviat srraum ;o1texnmi3ias s rm(vpn(0texnxf3oy1latrlnvo;s)setoio3oy4amte nviat)srrrxr ;u1tle mfciadfaDra( pn() eenif ta1omte uvi;t0setrxr3io4ale lfcs sfartaum ou4oetnmfciysfm2el(msnt4tetoxf iadlmte nvi;s0truoio nudalte fcilsfsDuau p;o4tpen i3iyd s rl(mo;()arxnmf3oa1fpDrauvs;s0 2trir oudolen ietas  rtru  nt0alxnmfetys m2eanvpnt0 rtniocoydlateai o;(  exr(m3oydolt mfvsa(fsDtmxrpnt4tee mieiadla2el( snu0 eeniocty1omte neo;t tetmir nu1lmee ieta(  2ra( onu4apeo ociyd s ulu onu4teerxr3tadlaDeaues s0t2trxo iodoltelfet sfaDuau  nu4openmoetltfs2elump;u)treniocty1fm raneslt)tetoxm3nu1lmte nvilsfaDumum oo4texoifciatla ua(ms u)aexnmo3tytlmt aivi t) 2uo(
\ No newline at end of file
@@ -0,0 +1 @@
+uei;t trxr(mpiu4om e fcil() 2taumpot0tpxn i3tlsfsDrluvo u4altoxocoadomDeln o ( sruoir oo4lpeelnvs () rrrumoot1tetn fctasfmDrln snu4trxnxfcty1la e nvs s)trtr(mpio4amee nei s)s2tmumooo1tlx iociltfmDeluvpnu0teermrctadfptrli sls0 ruoimpiudap e fctasfarta( o;u1apx ifctlt s2rmnvpn(4alxnmf3oydlateln s;s) rxmirpiudamen ietlt)sDrau o;u4aleomfcildfs2elnvsn(4tleoif oo1fp eauvslt0s2uoxrpio4al emfvi sf 2taxr ;o4aeen ieiasfm2umn o () exomfcoydlp e u ilt) 2urxr iu4lltemicils  2tm(r ot4apt mieiatla2emu s t0tlenio ia1fmt luvo;t0setmxopoy4ll elfvtltfsrrr( o;t1tpenif3iatfsDrlu s;t0 ltnxrcoodlm   nvil(0 rtrim oudom emncsasfsrtm(mp;t0tpt iietysfmDuan p t)treomr3io1lp eauvo;(0s2tm(m3ny1ol  liei t a2rrx poo1oltniietas m2eln o;t)alenxocoodlmD ai i ( t2xoxm3nodll n ivsls) Dtax ont4oetnmoeilsfsDraumonu4aeerxo3iydfaD aueolt seumxo3oy1llte nci tfa2tru o;t1tltnif3ilt m ra(vs u) rermr to1lmtrauvi t texrxr3ny1ap elfvtlt)s2trxmpou1aetoif3tas m2eluvo ()artoxf3tatfaD  i sl( s2xmio io1lm emnet t arrrumono4aeeo octlsfmDuanvp (0tlenmf iodlmt  ivil( truoimpnudlltn fvil(f 2tm(rpno4oleo fcils s umnvp t4 lxoif tytfmDranes;(0 2um(o iodlle mnctlt aDtrxroou1tet ioeiytla2uanmo;()aeerxr oydfpteaiesl( trxmxrpnydaltelneslsf rururp;u0ope  fcilsfs em(msnu0trerifctodomt anes s tetm(o3no1alt mnvt tf Drau p;t0opt ioeiyd m2raumonu0arenio iytfptrau o t)s2xmxo io1om nmneia(faruaxm ;o0olxo iciltlaDea(vp (0tltrxrctatfpt aueo;s0trxm(o nu1ope lnct sfaDrau ont0apt mieiltfa emu s;u)altomo oy1faDrln sl(0t2tm(opou1lmte fvilt)a2umxr ;o4opx mfciysla um(mpnu) eenxociydomDr n ils0srtoim no4omtn ieiatfarra(mpno1aleomfcias m um(vs u) lenxf iadfatrlnvsls0tetr(r no1ame lnei s)sDuaxrp;u0tpeomfctldfaDem(mp t)aeeomfcio1op  liei t tetmimpou1al n fcsltf 2umu ono0tleomi3iytfs2el(msnu)trxrio3oytfpDr u ils  etoiopio1omeeliciltfs2umx  ;o4altomi3tltls um( o t)alenio todoat auvo;s0t2tmio nydapenliesa( sDuaxm ou0tpx ii3ilslmDuanmpnu)alxnif3io1fat  nvi s) rumxrpoydlmtelics tf Durx ooo4tptomo3iys a eaums t4arxrxfctodlm e ivilt)trxr(m iydlltnlneia( artrumoou1aex  f3tyslaDuln p t) exrif ootlp   i ilt0trtr(r iy1ll nlics s)srraur ou0aee  octltls2uau s (4trtoxr3ty1fm rlnes;t) eumxr3ny1amte nct ( arrau poo0oet  f3iydfm ua(von(0alerio3tydomDeaueils0 euo(m3oo1ome  nvtlt  Dtaumo;o4aexomoeiydlm2ea(von(0artrxr ty1fa rauvo;(  etoxo3io4opt mfvt ( sDur( pnu4ape ioeiysla uau s t)tltrmo oo1fpteaivi s) exrir3ny4apenlnviatfsrrmxrp;t4oet ii3tad s2rmnms ()trtriocoadfmtr ues;t trxr(m3iy4lp elfcias  rum(rp;o4alxnif3tysfm ul( s (4artrmocio1faDelneo s) rumir nydapeemict ( srurum ;t0alx  iciasls2elums;u)altoxr totla e i sls  2urxo nydamtnmfet ()s2tm(m ou1apenmo3iyslmDeauvon(4 renirctatfmt  u sls) 2xoxm3no4al nmfesl(f rur(root4aetomfeiyslsDraums u4aetrxo iotoatrlueo t0s2xoimpio4am   fvsls aDurxm ot1ope  i3ils m2elnvsnu4 etrmrciadop eli ilt teurxrpiy4lmenmfetlt s2urxro;o1apxoioctatls2uaumo u4altrircoadlp eanes ()s2urxo3no1lm elicilsfaDta(  ;o4oetn fciadlsDul( s;t) exrxfcoy1optraneols  2tm(m3ny1ope lfvsatfsDurxmpou0tet moeiytfaDelnmon(0teerir ia1lp  ai i s0 eum(o3iydll e fvsas)s2rrx poo4olto ictas s2em(von(4teenif3tydoaD  nes;( t2tmxm3oodlpe  ies s  2uau pnt0tee mocils a el( ont0tltoxociotfmteanvo s seurxm3iy1ol nlictls) rurum ot0olxnmf3iyt a elumsnt4 etrxoctytlmDeai ils0 2tmiopno1ap nlfvi s s2uru  oo0aeen o3iaslsDulu sn() lxnmo oy1oaDe u o s0 rurxopny4lpe mnvtat)a2ur(  ot0opxn i3tytlm2rlnmpnu4aeenifcto1omt  uvi;()seurio ou1om elfet ()a2urx ooo0aex  f3ilt a ea(vs (0aexrircto1fateluvo (0truo(o nu4ol n fciat)srraxrpou1tptoifciydfmDumuvo;t)artrmfciytfa rauvsl()seuo(rpio1apt mnctls sDrmurono1tetoiiciydls2uau o;t4aleoxf3tydoatranvs;() rxrio3nydlmeelietlt) Dtaum nt1texnmieiatfmDea( o;t4areoifcto1lm ranvi t)sexo(mpiy1olt mnvia(fsDum(mpou4oex mfeiatla2umu ont)arxnxf3tatomDeln s t0t2uo(mpnodaltnmnct s arrau poo0aeenifetldfmDrluvont) etnir3tydla eanvi;( setoxr ou1op nmfetl()aDurur nt0opt  i3iytfsDrln p u0 rxnifcoydopt lnvols) 2trxo3iu4omenlieilt)aDta(rp;u0tpxnmieias aDeln s t)tlxomo oydlpDrluvs t0trxrim3iydoptnmict (  rrru ooo4oetnmf3ilsls2ranvsnt) etnif iodfm  lnvs ( trxoiopoy1lm e fcsat)a2umxrpoo0oltnii3iad s2eaumonu) rerxocoytlpD lieo s t2ur(r3ou4lp  lnei ()s2tmxmpnu0alenif3tytlm rlnvo;u)altnir oy1om e ivols)s2xr(mpiy1ope lnvsatfa2umxr ou1aeeo oetld s rm(vsnt4tltrmf3tatlmD  i o (0 eurxm3oy1opeemncils)s2ta(rpot4tlen f3tad aDeauvp;u4trtrxocoytlpDeau sls) rurxr ou1ap e fvta() Durx  ou0oleoiiciltfs ra(mon(4areomr3iytoa e n o s seuoirpiodlm emiet ()s2rrurp;t0teen o3tldlm2elu ont)tlxoifctodlmD aueols  ruoxm3ou1alt  fviat) rrm(  ou0tet  fetltfa2umnvsn(0arxnxr ootfpDe ueil( tetrxmpnu1apenmieias  Dur(r nu0oleomi3ilsfa2rl(vo;(4 rtrxr iadlpteauei t texmimpno4optnmicia(f 2uau pot4tpenmfciadfmDuln pn(4texrio3iytoatrauvo t) rtmir3nydll nmiviltf Dur(m ;t1alenifciltfa um( o;u0altnio3ty1lmDrau o;t0t2toir3nu1lle  nvsl(fsDtaumpnt0tle mfciatla2ran o;(4aleomf todomDelueolt) 2xr(o oo1oleelnesa( a2trx o;t0tlxoio3iad m2ran onu4teenir ta1fmDean o;( texrir nydopenmivtat aDtm(r ot4apx iieilsfm2uln p;(4tlxnxo3totop e n o;t)texrxmpoudam e neslt)srtrurpno0tlen i3tydfm2rlnvsnt) exrir3ty1oat auesls)srtrir io4alt lfvil(  rra(ront4opxn ictyd s um( p t0teenirciadlaDraieo;()t2trxr no1llte nctltfa2taumono1altn octldfm2uanmp u0artnxrcoadlmDran s s)srxmxrpnu4am  lfvsa(fa2tmx  ;t0tet  i3tldlm2eau onu)tetomr3tydlaD anvs t0texr(r nudom   nvi ()sDuaum ;u0tlen oeiyd m2emnvs;t) rtoircto1lptelnes;s teuo(r no4openlivil( s2trum ;u0alto i3tld sDrlnvsn() etrio3ty1lptrauei;s0sexo(r oo4alt  fvs (f Dra(  ot4tlenmieiatfsDrmnms t4 eeomf iy1opDrli i s teurim nudapee nvs s) 2tm(ro;o0aetniieildlm rmumo;(0 ltoxo3iadom r ies t trto(o3ou4opt mfvtat arur(r no0opeoioctld a uanmsnt) leoiocoy1lm ranei s0tetrxopoo1aptnmiviat s2ururoou4apen f3tas mDea(vsnt4arxoif iodoateln s () rxm(m3oudlp   nes s)srrrx  nu0oleniociysla2el(mont0alxomociodfmD ai o;s0 2um(rpno1altnlnes tfsDrm(ro;u0open icilsfa rl(ms t4 rxnirctotfaDelnvs;t0setrimpio1al elfvtas)aDtrxmpoo4opxnif3iyt m ea(vo;t0 ltoio iotoateanei;(0 2xo(m no1lp emies sfsDurxmooo4opxoiietltlmDuanms;(0aeerxf ia1fp raivol() 2xm(opio4aleelncsas) Drax ono4tpe io3tas s2rmu o;() exnmr3ty1omD anvo t  2tm(r3iy1lmeemncsat) 2ua( pnt0ope mictasfs umnmo;u4tetrmf3oodoa  luvs;(0 eumxr ny4op elieilt) 2trx p;t1tetnmf3iat a em(vs t0alermr3ootfa  lnvsls)sexo(m oo1ll e nvi (farrmx onu0oeeomfetltfs2rmuvpnu0 eerif3oydom rauesls s2xmiopnudap   iei t  Dumu poo0olxn o3iat sDranvpnu) etnifciytfa eau olt s2triopiu4lmte icslsfs2rrxm oo4olenifeils s rau snu) etrir tytla   uvil( srurio ou1lle  nctas) 2tr(  ;o4altnifeiasfs ua(ms (0alxoxr iatoateauesl( tetoxo3no1ale livi s srtr( poo1tpxn oetat a eanmo;t)tlxriocio1optrliei;t)trurir3iudap n nvi s) rurxr ;o1tlenioeiasls rl(mo t4trxrxociatopt anvil( s2tm(o nodoptnmiei ()srum( oou4tetn ietadfs2em( o;u4 eenifcoodom   neslt)s2xr(rpiydomenlncia(  rrm(r ot0teeo ieiatfmDul(mp;u)aeermo3iadop eanvslt trxoxo no4lm  miet s)sDrauroou1aexnmi3iasfa2rm(mo;t0arerxfcoatfmDraieo;( t2tr(o3ny4om  lnetls arumxroot0texo ocildfa2ul( s;()aleoxociadlp e i s;t0t2toio3io1ap  lfeiasfsrurump;o0ole  ocilt aDrmu o ()arxnxf3oytoa r neo;t)t2tm(r3nudll  lnvsl( arur(ro;t1aexnmi3iadlaDea(vp t0 exoifcto1omDelies;()t2um(o iodom nlfvta(f Duaumooo4tetn o3iyslm2umumo t4 lermrcta1op   ivs;t0trumimpny1olen fetatfs2rmurpou1tpeoio3tlt s rmn s;(4aleomfctatfp  ln s s)sruoir3iy1ame mfvtlt sDururp;o0opeomietat s2uau onu0aleoio iotoaDrlieo s0 exrxm nydlp n fes s aDuaxm oo4olt iieildfaDuauvp;t0alxrifctadfm eluvs s0sexm(o3ou4am emfvslsfsDtr(mooo4opeo o3iyt s2rln o;t4aexrmo3ty1fmtrln o s seto(o nu4lmte ncs s sDtaxm oo0alenifeiytlm2rm(vsnt4trermfcto1fmDr u ils)trxrxm iy1llenmncta(fs2raxm nu4ole mocildlsDuauvp;(4 rermf ty1oaD ln o;t srtrim3nudalenlfvta(  2tmur ;o4teenmoctltls2emuvpnt0tlxnxf tadop rlu i;(0setm(m3iy4alenmivs s aDurx ooo0oetomoeildfs emnvp ()arxrifcoo1lateai ilt tetoir oo1op nmncs s)srur(mono1opto iciytls2emuvsnu0tltnxo iodlp raieol()s2xrxmpnu1om e ivtat)artr(mp;t4aeeomi3iytlaDranmpnt4tlxnxfciy1oaDelnvil(0 ruoxo3oo1ope licil(fsDum( ono4tpxo fciytlm eaumont4 etrxrciydoa r ues t)s2tmxm3io4amt  fvt tfartmuront0aex moctyd a2rmn s;(0 lenif oytlpt lnvo s0s2trxrpiu4lle  nctasfaDtm(mo;o4alxoiiciltlmDumump (0 rxoiocoatfate nei ()setm(opno4omt  fetatfarrrumo;t1apeomo3iadls ranmo u)altoif3ty1omte nesls0tetoimpoy4lle mfvils)a2rr(ro;t0openmo3tytlaDrmnvs ()arxrxfcoy1oatr iei s s2toim ny1aleemfesasf 2rrxrpot0teeoifeilslsDeanmont4altnxr oadla   ivolt0s2tmim3iu1lm  mneiltfaDrm(  ou4tptomf3iltlmDuln pn(0trxrxocio1lmt livslt0 eumxo3iydop  mncsls)arumx  ;t4ale  o3iytls2emn p;()trtnmrctadfat lieils0s2tmxmpio4oltn nvias s2rrx  no4tlenio3iytfsDraumo u) etomr tadop elnvs;t)t2uoxr3iydame mfcta() 2rr(mono1altoiocilsfsDul(mo t0texrmo3totoa r uvols  2toxo ou4alenmiet (fa2tm(rp;t1tpen ietatfsDea( o;u)aleoxf oytfat  ueolt0 ruoio io4ope mies t) ruru pno1opto fciasfmDul(vsnu0tlenmo3iydfm   ueo (0 etoiopnydomee neta(fsrrau oou4tpe mi3iyslm2emnvsn(4texnifcoa1optrlneslt t2xmxr iy1lmtemfei tf rraxr nt4tpeniieiad mDrlnvo t0tlerif3oodfp raues (0srumxo3nu1al elnvt () Dra(m nt4tex  fciadfm eauvp t4aexnxo iydoaDe neols)s2um(mpiy4lpe mics (farra(r ;t1apenif3ilsfm uau s;t)texrio3iadop   uvo;t0 2xmio iu1aleemivtl(  Drmx o;u1aptomoetaslm2um(vp () lxnmo3oodfmDeaneolt  exrxm nodomt  ivt (f Drru  ;t0aeenmfeiyt m2uln p u0artnxrcto1lp   n ilt)srtoio3iodop  lfcsl(  rtrurp;o4apen octys s2ul( s;u) rxnxr3iotoptr ivs;(0 2toirpiudom elfei t sDtm( o;o0tex mf3iatfsDeauvs (4arxrmf tatlmteaues s)trtrxm oudom elicta()a2rau o;u0tet  iciyd s2umuvs;(4aeermf3totfa  aivsls0 rumxo3ou1lpeeliet s a2urxmooo1tee iietatls2um(mp;u0arxoif3oydlmt lnes ()srto(o nu4ol e ies s s2trxr ;t0tpe mictysfs emnmp t)trxrmf3iatoa  aieo;s0 2xrirpou4lp emivi (fa2ta(r nu4tlenmfctysfs2emu o (0tltnxrcio1oatrli sls)srxo(rpnu1lmtnmfetls) rrmu p;o0aet moeiysfmDemu o u0 leomf3oatfp rlneilt)teumio3nu1ap e fvsl(faDumu  ;t4olen ictysfs ea(mont0 rxomr3tadlpDeau o s  exoim nu4omen fetls)aDumur nu4oexo fciltlmDrlnms;(0 exrmr to1fp r i sls)teum(o3oo4ame  ncsl() 2tr( pno0tpxomoctlt m rmu p;() exrircio1fpDeanvs;(  2xm(mpnodol emneil() Drmx pnu4apto o3iadfmDumnmpnt0alenir tadlmt lueo ( s2xrir no4om n nct t aDtmur nt1oleomoeiys m ua(vs u4 rtnxf ty1fmtrlnesl()t2xrxrpou4opee ictls sDurxr ot4apeomieiltlsDea(vo;() rxoif3iatlmD li i;t teto(rpny4lpt  ncsa()s2tm(ro;o0tpt mfeild aDulu p;t) eenif3iadfp ran s s0trtrir iu1lpeemnct sfs2um(m ;o0oleo i3tls m2ul(mon(4teenio oa1lp   nei;s0sexo(o io4lme mfcils a2uaurpnu1aexnmoeiatfm2elnmp;(0 leomf3iodoat lnvil()t2tmir3ou1amtnlnvs tfsDtau o;t4olx  o3iydfsDul(vp () lenxf3oo1oa   n s s t2urio3io4lltelnes (fsrtrxr nt1optoii3iadlmDem( p ()tltrxr oytfp   u o;s0t2tr(opou1lle liesat artrxrpot1alt if3tldfmDeanvp ()aeenxo oy1opD  uvo;() exrio3oo4oleelnet s aDtrxr ot0apxomoeiatlm2um(vo;(0 etnmo oy1late ieols0t2toiopnudlpenmivilt  Dtrxr oo4tpt  fcilt s2uln pnu0 rerir3ty1lptr n o;s0t2xm(r3nu4apt  nvi t)srumxrp;t4altoiieiadlaDul( o u)arxrxf oydopD li i;t)setrxm io4al e icta( sDrau pnu0teen iciyd sDemuvo t4aexnif3tydfp ean s s)tetmxr3oydlpee fcsl(f rtmuro;u4oeeomo3iltfa2em( s;u4arxnmf3oatlmD lu s t0sruoimpiu4optelnci (f Drmxrpoo4ole mo3iadfs eln p;u4 lxnmf3iodfpD lies;()srtrxmpio1alenlnvtasfarrm(r nu4olto ocilsfsDemuvo;u)teerxr3iodlm eauvolt0t2toxrpno4am nmiesls) rrau  ot4oet ifetadfsDran ont)alxomr3iadlp  anes;s0t2xr(m nudlme lfesat s2ta(  ;u4tlt  feilsla2eluvonu0aleoif ty1lpt au sls tetr(r no1llte ieslt)a2raxr nu4apx  ietas mDea(vonu) eenmr3io1faDeau sls t2xm(rpnodop  mfesa(fa2uru p;u0apxoioeiaslm rauvont4tetrir tydlpDe u o s0teto(o3nu1alt mfcsa() rumur ;t4ale  fctasla2umn o t4 ltoxrcoy1fat anvo t)t2uoir nodomtnlfcsasf rrr(  no4aleo f3iyt a2uluvon(4 ltoxf3ootomte ues ()trxo(o3no1olt lnvta()s2rau p;t4olenmictldlm rmnmsn()aetnio ia1oaDe ues;t t2xoxopny1lme lfeia(f 2ta( oou1teenifciydfa rmu p (4texriocoodomt ln s;( sruoxm oy1ap elfctl()arum( p;t1oet mf3iltfm2el(vp t0aleoxo ta1opt ln s s  2uoiopiu1op elncias arrm(r ;o4oee mictat s ulnvp u0alxoxr iatfa raiesl(0trumxo oudom elies sf 2ra( ont4tle ioeiatfm emn o t)aexoifcoodlmtrlu slt)texoxrpoydaltnlfcslt arta(rp;o0tlx ifetlslm ua(mpnt4 rtnmr totlpDelneols)trurxm oudapenmnvs ( a2umumpot1aex mf3iydfm2umumsnt) eenxrctydlm e uvil(  rxo(m3nu4am nmfcilt)a2ta(ro;o1ole ioeiys s2raumo;u0aetrif iy1oaDr ieo t) exo(m3ny4lmtn fes ( a2rmxmpoo0alxomocias mDel( p u4trxrmocta1oate uvo;s) 2tm(m iy1amenmnvi (f 2rrump;u1tetn i3iltlm ul(mo;t4aeenxo tatlatr iei;(0truoxrpoodalt  ieslt) Dtr( oot4aee  octltls2eln pnt)aetnif iotlp ran o;s0 etmirpoudamt lnct ()arumu o;o4aeeo ictlslaDeanvs;u0 exomr oatomteauvi;t0srumim oy4llenlnvia(f rraxr no0tpeniociadfaDrmuvo t0tlxrxr3oatfaD  iei (0sexoim oo1omeemnctasfs2rau p;u4optn ictld s emn p;(0texomo3oodlpteai ils tetmxopnodomtemfvias s2raxmonu0tptniociysla2rl(mp t) exrir to1laD  i i;s s2umir io4omee fct t)a2urum oo1oltnio3tat s ul( o (0 lenif3oydoaDrlnvil() 2um(r io4olt mfvs (f rtaxr nu4tlenio3iytla2rlnvs;u)tltnmr ta1la e u o;t0trtr(rpiy1apt  fet (  Draump;o4oetniociydfa ulnvsnt0 etoio3tadlp raieolt  exoxm ou1lmt lncils  2raur ;u1tpxo fciadfa ulumon(0trxnxf3io1op  li o;s)sexoxr ou4lpe lfvta(fs2rrumono0oleoifctlslm eaump u4artoxf totom  livo ( sruo(rpiydlle lieilt)a2uaumono4apt moctlt m2ul( s;t4 lxrxf3oadfa  liei;t0t2toxmpoydal nmfeia( srtr(rpoo0altomocilt aDumnvo t4tlenxocootom  luvs;t0s2uoxr iodapt  fei ( srurumpot1aexnii3iydfmDumuvo;t) rtnmf3oo1lmD luvs;()t2xmir3io1lp   nei t aDumxro;t0tlen f3iytlaDrl(vsnt0 ltomrctadfp rluvi (0s2xmimpnodop emivi sfsrtm(r nt1tltniieiysfm2rlu o t4trerirctodoa  luvolt) euoxr3nu4olenlivi (f Drmxm ot1aeeomfetatls ul(vpn(4altrmocta1fatelnesl( t2xoxm3ou4al  liei tfsDrax o;o4alxnii3tyt sDulnmp t0altniocoodfp  ai ol()srtr(r3oydomtn ncsls  rrax  oo0tet  f3iad a2umnvs;t4texnxr oatfaDean slt  etoxmpiudomte fvs s s2rr(m ;t1oex miciytfs umn snt4trxomo iodoatelues s0trxrim3oy1ol  mfvi (faDuru p;o4opxn icils aDumums u4tetnmr3to1fptraivsl( s2um(opoudolee ictlt arrrxmpnt4tlxn oeiyd m2emuvp;u0aeenxf iodoa   neslt  2xo(m nu4om nlfetlt  ruau  ot4aexnmoeiadls elumpnu4 etomr3ta1omt anvils)setmxo ny1llen net ( a2rm(  ;o0tpe if3tyt s ulnvo;u0alxnifcia1fpte u s;t  exoxopiudapt lncsa( s2tmxmooo0tpeomi3tys s ul(mp t0 rxoxocia1lp  aiei;s0 rum(o iu4llee ivslt)s2rax  ;t0tetnifeiad m em( p u)alxomo3tatfaDeluvs ( trtm(mpiodlptn neils s2tau o;u1olxomfciatfs elnvs u4texnxf ty1lpteanes ()s2tm(r iodamtnmfeslt sruru pnu0tleniociysfmDuln p u0altnioctatopD  i ilt)s2umxo no4opt  fvtas) 2tmu  nu0tptnmieiasfs2rmnmont)tlxnmr iy1om e uvil() 2uo(mpio4ol nlicsl(  2rrxrooo4ope  i3iatlm2uln p u)aexnifcoytlm eaies t0 2ur(mpiydom   fvtltfsrurx pou1olxnmfeildla2em(ms (4teerxo tatfa ean o;t)texoim3nodap nlieiat  rraum nt4oexo feiat s rluvs (4trxnxo ia1fm  aivils trum(r oydol  lfcs t  rtmx p;t4oltnmoetatfsDuln ont)texoxr to1lpteaueols0 eumim oo1omt mfeil() rtmump;t1tptnmoetytlsDumumpn(0alenif3iytomt  ivo s)tetrxr iu4aleelnvilsfsrtrxrpot0optoii3tyd s2emn pnu4 ltnxo oo1lp elueo s sexmxr3iy1olt  icils) 2rmumpnu0apxoifeiat sDua(vs;u0 rerxf ta1fpteluvs s)srxmxo oo4olte nctasf 2tr(rpno0aptn fciatfsDuan s;u4 rxrxociy1oaDelnvi (0truoimpiu1opeelfvt s)a2raxmpno4tlxomo3tltls2ran p;(0altrif3tadop  livols0t2urim io1ope lnvsl() 2rm(m ot0tet mieiytlmDrlnvo;u4 ltomo3tytfmtr u s;() rxmxm3oo1ameelivtasf Dtaxm no0olt if3tydfa elu p t4alxnmociotlp e ues (0t2umiopiy4op  mfcia( aDtm(mono0alto i3iasfaDumnmo ()texnxf3oadoate u olt)srtmirpiu4apte fcsas)aDra(  ou1aee mi3iydlmDuanmpn()areomf3oodlmD  n i s)t2tmxo3iydapte neilsfsDtrurp;u1aexnmoctadfa2rluvpnu4 renif tadlpD lu s;t0 rtmir3iydame lneiasfs2raumo;t4texnmfctyslm rmumpnu)aetnxf oadlp eaneo;t0t2uoiopnydope lncilt)aDrmu oot0tltnmoctadlaDulums;t0 rerxrciodfa r nvil()texoxm3ny4altnmncs t)a2rru o;u1tpenmo3iyd s rmnvp;u0altrircta1opD ai i s) rtm(opou4apt  ivslt)arum(ro;o0tltomfciad a2rl(vo t0 lerxr iatfptelivi t)texr(r iodopeemict (fa2tr( o;o0tee ioeiatlm2ulump;()artrmf3iy1fmDe ueslt0 2uoir3iudllenmivslt  rtaxmono1alenifeias aDrmnmo;() rxnmo3tatoa r nei t srur(m3iu4ole  ivtas  2urx poo1tlx iociyt mDeaumo;(4 exoxf3ia1opte ieo;t0s2tmxrpoy4lle  fet tfsDta(  ou0oexnmietldfa uln p u0texoxfctatfatrlivolt0 rxoxmpiu1aleelnvt s)srtmxmo;o0oleniietyt a uau p;(0tetrif3tydlpDeln o s)srurxo3oy1omen ncs sfs2urx  no4ole ifcildlmDemn onu4arxoif tadomDe ieolt)tetoxmpiy1am  lnci sfs2taumo;t0alt mi3iyt m2ranvon(0arxnxrciodop elu olt) rtr(opno1lpenmfcslt)aDurx pou1tpx  iciydls rm(ms u4 lxnxo iytop r uesl( srtm(m3nu1lp   nvt s) 2ra(  ;o1tle  feiytlm emnms u4altrifctodlm rauvo ( srtmim nydope micslt) Dumx o;o1tex iociatlm ranvont) rxriociy1fateaieilt0 etoxr iudlptelfvi s)srumurpnt4tetomictatlsDua( snu0 etnxrctodfmteluvs;()t2uoxopiu4lpte icsat)s2umurpno0aptnmf3tas a2uau o;t)treomf3totfmtr ivs;s0s2xmir3iu4lpee iei tfsrur(rp;u4aetnmiciydfaDrmn p t)altrio todfa eaivo () eumxo3nudame lncia( sDua( o;o0tlto fcils mDea(vo (0aeenmo3iadop e n o () eumim oydopt mncsatfs2rax o;o1optnifetlt m em(mont4 renir3oy1op r neilt srtmirpoo1ape  fcsa()s2taumpnt0apto f3iysfm rmuvpn() lxoir3oodfat lu s;s seuoim iu4llenlnvsat s2urumpnt1aetoiieiytlm rmums u)trerio3oa1fp e ivs;s0seur(m3nydop elnct (farurum no4altn ociydla umnms u)aexrio iadlpD lnes ( texoxopiy1lpen iei t  2rrurpno4teeomictldls uauvpnu0 etrxfcta1lpt luvols trtmirpoo1lm elici t arur(rpoo4tetnmo3iyd a2umnvp t0aetnmr ia1optrlivs;s)trtoio3oodamenmfetas  Dta(m oo4tlxnioeild a2ea(vpn(4trxnmfciytfaDe ueils0 rtr(o no4lmeemncsat)s2uaxrooo0alenii3tasls2um(mon(4teenio3ootfatr nvi;s0s2umir oy1amtelneil(f rurx poo1oleo ictltfa2rmnvo t)trxnmo tytlpDe ueo;t0s2xm(o iydlpeelnesls)srtr(mpno1apx  f3iydlmDraums;(4 rxnmo3ia1omDeai o (  2to(o no1alte neslt)aDuaxr ou4oetnmfciadfm2elu onu) exnxr tydfa  an il()srtoimpny4op   ivtls) Dtmum ;o4opt iieiydls2umnms u4artoio tatlpt ln o (0sexrimpoy4ope  fcia(fsrumxm ;t4oet micildfm ulnmsnt) rtoxfcoydfmteln i;( texoirpiy1alte nes s)arum(moot4oleo icildfsDran o t)arxoircoa1la r n il( trtoim3iodlm  lnvs () 2tmum no0tetn ociltfs eaums t) rtrioctydfm  lneo (0t2toxr3iudale lncsat)artm(ront4aet mfciyt m2ul( o (0 lxrmf3tadoateli s;t)t2ur(mpnu1apeemiciatf 2uaurpot0tpx  f3iytfm rlu onu)trermo3oodfatelues (  euoio3nu4llenmivtatf rtru p;t0tlxoiocild mDel(mp u4arxoxo tytfaD lieils  exrirpiudlpe  fetlt sDumxrpnt1tleo oeild s2rl(mp;t0tlxrxfctytoa eai s s) 2xo(opiu4lpenmfci t aDtau oot1tpxnmo3iydlmDemumpn(4 rerxfcoadopDrluvsl( texoio3iy1lltnmfcta()aDtmum ;t0aetomiciatls el(mp t4 etnmf iydopDr ueilt0sexrirpny1ol  mncs t  2rm(mpnt4aetn i3ilslmDelu onu)teerxfcty1fp r ieo;( seuo(opiu4olenlnciltfa2tmxrp;t4oltnioeiltfa rl(mo;()tlerxrciotfm  ai sl()s2xoim3nydlmtelncs ()a2ua(m ;u1oltomf3tysfm2uauvs u)treoio to1omDelues s tetrxopoo4lm nmnvils)aDrau ono4alen fciyd s ua( o;(4arxrio3ia1opDeaues s  exriopnu4olenmieia()s2urxro;u4aet  o3tadfa ra( o;t0texomr3ta1lmDeanvols0 2tr(m3iy4openliet t) rrau oot4tpeomo3iat mDuluvo (4tetomo iadlpDeaivolt) exrxm3ny1ope mfes sfaDtrurpno4opt  i3ildlaDumn o t4altoxfctodlm e uvils0t2xoxopou1am n icias  rua(rpou1aet io3iatfm rm(vp u)tltrir3oytoaD auvi;t  etmir3nudole  iei t) Drmxrp;o0teeo oeiadla elnmonu0aetrxf3to1oatelivs;t)srurim3iu1opeelivt tfa2uaumoot4opxo oetas m uluvpnt4texrxr tadlmDeaivs;( setrxmpiu4ale lnetl(  2uaurooo0alt mietasfaDelu o u)aleoircoydfptr n sls0s2to(r3oodoptemnei () rua(rpoo0tee  ietyt sDuluvo;u)tlermr3oa1fmD lu o;s s2tm(opio4ope  fci (  2urxm no4aleoii3iydfmDeaump;(4trtomr3ia1la eanvi;t)seurio3oy1ame mnvsa()sDtrxm oo0oeeomfetatfa eln on(0tetoxfctodop rlies (0 rur(r ou1alenmfetat a2tr(moot4aexo ieiys a2eau on() rtnir iy1faDrau ol(0t2xo(o3oo4ole  fesls) rrmxrpot0aexn iciyd m2eau o (4trxnxf3iatoptr ieols t2tm(m3iy1al  mnet t)aDua(r ot1apeo octlsla2emn p;t)altnio3oytfp e uvi;(0seuoio3nodomtemivilt) rumum ;o0apeo ociydls2ea(mp;(4trxnmr iotop  aieo;s0trxo(rpoodlp emnvsltf Drm(ro;o0tet  ieild sDuln s u0 lenmo oo1lmD lueolt) exoio nudapeemnvia(  Dumum nt4tet ii3tadfs2emn o t) rtoxo io1opteai i;s tetoxr iy1opt mneil(fa2ua(roou0alto fetasfa2um( p (4texrirctotlat auvi;()texmxo3ny4lme micils s2uaxmpnt0oex iietydlm uan s;t)altrxo iy1laDean s;() rxr(m oydamtn ieta( arrmx  nu4apxn ociatla ulnvp;u0tlxriocoatfaD aues (  etrxmpoudaltnlnet t sDuau p;o1aeeoiictasfa2uauvp (0trxrio3oy1lmDrau s;s  euo(rpoodolt mfviat)sDum(mo;u0tpt mi3iasfa rlu o;t)tleoif3iydom  au ol( sexoio3no1ol nlics s) Duauroot0alxn feiltls2uanvonu4tetrxf todlm   nvsls) 2trxmpoo1olte nct () rtr( pnu0tleoii3iltlm uluvs () ltnxr3iatoat  nvi;( s2to(o3ou4ll e fetat) Dtaxrpou4tetnioeilsfm2emn p u0arxoxo iodoaDran slt  rxmxo no4lmtnlfvt tfsDtm(mooo1tpxn o3iltlmDem(vo;u)tetrir3oodoaDrlu s;() 2tm(rpny4lpenlnvs t  2raurp;o4ale  iciytfaDel(vonu4texrxfcoa1om   uesl() eumxo3nodlle  nei s) rurur ;u1teeoio3tadls uauvo t4arxrxr tatoaD ai sls)s2umxr ny1lmenmicsls)sDtmurpot0tleomfctasfaDumnmpnu4teerir todlm  ai slt) 2xo(r3ou4ap  micslt)sDum(  nt0tle moetydfaDeluvs t) lxomfcoodfmteluvi;( trxm(rpnu1opee ncias srumu  nu1oleoif3iat aDea( p;u)teeoxf oy1lptr i ols)sexr(mpiudlpe lncslsfarumx oot4apt io3ildfm2uanmsn(0aetnmf oy1fp r uvi;t0setrxopoy4ope lictl(fa2tax ont4altnmi3ild m2eanmsnt)texoircoydlm   neo t)tetr(r3iodolenmneta( sDrrxroou4tleniieiytfs2eauvonu4trtnmf oadlaDr nvo;t s2xmxmpoo1lptnlfes s s2uaxm ot0apen ieias sDuaumo (0alxnmo3todoa  aneils0 rxrxr3iu1amte ncsa()artmx o;o1opxoif3tyd m umuvp;u)artoio iadlmDrai s s0trtrxm3ou1lptn nctl()aruaum ou0ale mociysfm ea( pnt)tltoif3iydoa r u s;() 2urxrpnu4llt mnvtls aDrrxrpoo1oetnif3tytfsDrl(vpnu)aexnmr iodop rln s;t0 2urir3oudalt mnvsls aDrrx p;u0altoifeiad sDraump;t4teenxf oytlmtrlnvo;(0 rtm(m3oy1amenlnesls srurx  ou4apen feils aDrauvs u0teerxo tatopt  neilt sruoxo oy1omtelici t)arurxmono1aet io3tasfm2rln p (4altnif3iatlpteaivsl( trum(r oudal  mivi (faDumum nu0aeto ieiyslm2uaump;(4 rtnxociy1fmDeli o;(0seuo(m no1lp  mietatf 2uaumoot0opx  o3iydlmDumnvonu0 etomo3oa1fmt lnei t0setrxm oy1lp n nei ()a2ua(rpou1tlenif3iys s2uan p () rxoxr iy1omtr ies;s)teumir io4ame lnesa() rumx  ot4teeomiciltlm ea(vpnu4trtoif3oodfm e u ol()sexoxm3io1lmeelfvs t s2trumpot1ale ioctlsfm uanvonu0arenircoadfat ln s ()s2xr(rpio4lm emfvtat)a2um(rpot0tptn f3tlsfa uau o u4aetomfcio1lp ran o s)srurim oydlpeeliet tfa2taxmp;u4tpx  iciad a2eanmsnt0trtnmfciadfpDe n sl(0 etoxo iu4llen fesa()aDtaxrp;u0opxoiictasfm2elnmpnu)arxoxr3tatfa ran i;s0srxr(r no1am e fesatfsDrau o;t0opxnifeiasfa ulnms;(0aeerircootlptr ies;()s2um(opnydaptelfcsls aDrr(r ;t4aetniietydla ulums;u0aeerirctatoptrlnes;t0setrxo oy4lmtemfes s)s2trxm ;t1ole moctadfs2rlumpnu)arxrxo3tydlp eaivs;t teurir3nydlmtelnctatfsrra(mooo1texn f3iysfaDel(ms t0 etoiocoodfmD  n olt0t2umir3oy4ap e nesl(  rrrxmpnt0opxomf3ilslmDrl(von(4 exoxo iytfp   ivo s)sruoxr oydame lfvsls)a2tmx p;o4tlto i3tatfa em(vp;()arxoif3todlpt anes;s)seuo(r3ou1lpee ivslsfa2trxro;t4tleomoeilslaDrm(vs t4 eeomo ia1lm   uvsls  rxrir3oo1lpe lfcias aDraxmp;u1tptnmictyslmDea(mo;(0tltnmr tydfp r nesl()tetoxopoo1opee fvia( s2urx pou1oex iiciys a umums;u4 ltrmf totoptr u i;s s2um(r oydllenmici ( a2ta( pou1teeoiocias m2emn o;u4tetrio oadla  auvo;(0seurimpiy1lltnmfvi ()sDtmur nu4teenmoetltlmDemuvp u0texoxocootoatraivo ( seuo(r oy1optnmfcsa()aDtmxrpno1tptn ictadla ran p t) eenmocoadfptr ivo s teumxo3nudap elfct s sruauro;t4aetn i3iyt sDrmums;(4treniocootom eanes ()teuo(rpoudapen ietlsfsrua(mp;u0apxomfctatlsDrmnmo;t) etrmo3totop elueo s0 etoir3ny1alenlfvslt s2urxr ;o0tptoifeildlm2uau s u) eermo3iydop rauvs (0 rxmio3iu1ll nmfcsl()s2rr(mo;t4tee  o3ildlm ul(mp;t4tlermocta1op r uvolt  rxmxrpnudoltemieil()sDraumo;t1opxn fciysfa rlnms (4texnmo3iatomD au s t0t2xo(m3ou4lmenlics ()arrm(roou1opxomoeiys a2ul(vpnu0tetomr3oatfpteauvo s)t2uo(opnodlleemivil(f Drrx p;t4altoifciytfmDul(monu0 eerxr3tytfmt  uvo;(0 2xrirpnu4ol emieilsfs2trumo;u0oltomoetls mDuan s t0 renio ia1fpD lieolt texrir oo1omtelfct s a2taxr ;o0olx mfeiltla2um(vo () etrxr iatfpDraneslt0s2xr(o iy4lme lfeils arrm(rp;t1tpx mo3iat aDeau pnu0texoxrctotomD li sl(0trxm(r3nu1om  mieils) rrmu p;t0tptn fetatla2um(vsnt0 rxnmrcoy1fpDrlnvi s s2ur(m ny1op nlfctat  2tm(mpno4tptniicils sDemuvonu) renxf iadopDrlneilt)s2xoim3ny1ap   iet (fa2raxmpno1tptniiciydfa umnvo t4 etoxo3ta1fmDr n o;t s2urxm3oydom n fcia( aDtax pno4alxo f3ilslm rmu s u)teeomfciotlmDrau
\ No newline at end of file
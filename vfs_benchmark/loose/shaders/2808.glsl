@@ -0,0 +1 @@
+uei () 2toxo iydapeemicilt)sDuru o;u0tleoifctas a2umnms (4 exrifctytoaDr uei;( srtr(opnu1amtnmfeil( s2trxrpou0teeoifciys m rm(mon()artrxociodoateai il()s2xm(r oo4om   nci tfa2tr(m ot1opxnmocild s2emumont4areomr tydlmDe nei s) exr(m3nu4aptelfci t)arrmxmono4oltoiieiydla ranmo u)aexoxrctotfptr ueil( texoxopnu4amt  neilt a2tmxmooo1olxo fctlt s rlnvon(4trtrir3ootlmDrli ol( t2uoiopiudlmee fct ()a2rr(mp;t4apxnioeiasfs uan on()aetrioctydfpteauvilt sexr(r3oy4op  mnctls sDua(m ;t0tex  fciat a2em(vo u)tltrmf to1fm   nvi;t srtmiopnodol  lict t s2ra(r ou1tpt iietydla em(mp t4 lxrmfcoy1lateau i;t0seumio oo1alen ivsat)aDtr(m ;o0aptn i3ild s rlump;t) reoxo3iatopteau i;(0tetoimpno4lp nmnviatfsrtr(  oo0oee  i3iasfa emuvp t0 rtrmo ty1lmtr u o t0tetrxrpio4am  lietat  Dtrxmont4altniieiydfm2emuvs t4 rxnmrctytfp eaneo;t0srumxr3ou4ale lfvia( s2ur(mpot4tltomietlt aDulu on(4texomocty1fa  aueo;t) rxm(r oo4opt micia()srurxroou1apen ietaslaDum( s u)aexnirctydfat lu i;() 2xm(opoudlle lnes (faDtr( ono1tle miciatla2elnvpn(4 rermr oadfaD lnei ()trtmxrpoo4openlnctat  rrmxmonu4oexomfcils sDrm(mo t) rtrmr3ootlaDe i i t0setmxrpnodap nlncia()sDrr( pot0opxn fciasfaDeluvo u)aexrxr3to1la eln i s seuo(m3iu4om emietasfa2ur(m no0tle  f3iytfa ean pn(0alxrxo tytopt aneo;t)t2xm(mpoo1olenlnvia(f Dur(r nu0aptomfeiyt a2ulnmpnt4 lxomr3iytfpteaivo s0srur(o ou4omt mfeilt artaumoot4tpx  fctadfm elumont0aetoxf iy1faDe ues t0truo(m iodap emncta()sDrm(mo;u0opt  o3tls m uanmp u4aetrxo iytlat  nvs;s) 2xoxm3no4ap e ics ()aruaum oo4tpt  oetytlm emump u4aeerxrcia1laD  n o t  euo(m3nydopen ncs s  2rmx poo4tptomi3ils a2um( o;t0aetrxrctatlmt lnes;s)srurio3iu1lpt mncta()sruau onu1alt  ocildlm2rlnvp t0treoifciydfp raues (0s2tmio3iu4ap e ics t srua(rp;t1teeomietldfa2umnvo u0 rtrio3tytlpDr neolt s2trxm no4olenmfetl()a2tau  ot1apenmo3ild m rl(mpnt) reniocoa1fpDrai s s  2uoxm3oo1ol   fviltfaDrau  ;t4tpxnmfciatla ranmo u4aexrircoydfm   u slt) eurir iu4ap elnctl(fsDrax pno4tpenmo3tas s2eau pn(0 rxomr3ia1fm r uvi t0 2tm(m oudaltn netl( a2umxm ot4opeoifcilsfaDumump u4 ltoif3oodfmtelieo s0trxrxopnodapenmnvilt a2umxm ot4olt mocildfmDul(vo;(0tlxrmrcoa1oa rlies t) ruoxmpnodlme mnvias aDum( pno4olx  ieiad a2rl(mp u0aleoir3oydfp elu s;t)sexmirpno1ole livslsfa2tmx pno4tpxomi3tltlmDumnvpnt0trxnmfcia1oat livs;s0seuoxopoudlpeemncsl()aDuru o;o0opxomo3tadla2eluvont)tltnxo3iodfa  an i t srxm(r nydlptnmfeslsf Dtax ooo4tlx  oeiatla2ua(vs u0alerxrctatlateanei (0t2trimpiodol  lncsasf rtax ont0olt  o3iydfm rlnmo;(4aexoir ty1lpDeln i;s0texo(o3ny4oltnliei t)s2tru  ;o1tlt if3tas m el(ms;t0 eerxo3tadfatean o ()s2umxr no1apt  nvs t s2ururo;u0tex ifciysfs em(von()alerio oy1oa  luvils  2xmxrpou4ale lfvt sfs2rm(mo;u4opto i3tat a rmu p t4arxoir3ta1omDrau s s)sruoimpiu4apeelicia()srtau pno1apen ocildlm2eanvp;t0 exomoctotlaDr ivs;()tetoxopio4op  mneia(f 2rm(rp;u1teto ictysla elnms;(4artoio ty1fp rliei s s2toxopoudlptelfetat srrr(  nu1tet moctasfa2umn o;t) exnioctotoat lneils0trto(o io4lpt lfet ( s2rmum ;t0opx io3iydla ulump t0alxnio3totlmteli ol() rurirpou1openlfetat)artrurpnu1olt  ieiasla2eauvs;u0 etomr iy1fmDeluvo;s)setrxo3io4lmtn nvia(fs2truroou4openmf3iltlaDrmnvs u)trxrxrciadopt  n o t  exo(m3oo1lmt micsls  Dumx pou4tpxomietat a2ul(ms;u0teenxrcoodoa e ues s  exoxmpoo1lp nlnesat)arumuro;t4tpeo ieiadfa2eln s;u4tltoiocta1fatraueol(0trxmxo io4am n fesa(faDtrxm ot0oeeoioeiltfs um( o t0tltnir totfaDeauvi s  rxrxmpiydam  lneta(  Dtaxrp;t1tlx  f3iys sDumn o;(4arxoxfciytfpte uvi;t0s2toirpiydomtnlncsatf 2trxmp;u0alxo ictat m rln o;t0aexomo oatfp elivo;()t2tm(r nu1omt  ics (fa2tm( ont0opx mo3ilt m2rmu o (0 lxoir oy1fpte i s (  rum(r iydaltnmfciat)a2umxmpnt1aet  o3iydfs2ul(vpn(4tlxoxfcta1oaDraieslt tetriopny1alee icil(f Dum(  ou1texo feiytlaDean p (0 lenmf oa1oatrlnvs;() exm(o3ny1lm   fet tfs2tmum ot1oex  oeiltla2rm(vs t4tltnio3oy1fa eluvo t) ruo(opoo1ole  iet s)sDumxm ;o4apx moetydlsDum(ms;u0arxnxfcoa1omDrli s t tetmxmpnudlmenlnct t) Duax o;u0tle mfeiasfs2rmnmp (0tltrmo oa1late i s;()t2trxr oodap  micsl( srrrxront0tpe  oeilslmDra(ms u)trtrxo3tydfaDr nvsls s2xmimpou1oleelictat srtmx ont4tle  iciysfmDranvpn(0tleoir3iytom  lu o t0teur(rpiudapt  feiltfsrta( ooo0apxniietydlmDrmu pnu4arxoiocoadfa eau s s)seuoimpiodapenlfvils) Dtrump;t4ope  ieildlmDemnmp;() ltnircty1opDrlneo;t0setmim iy1olee feslt aDtrumpoo1olxnmictlsfa2rlnvp t4teermo3oatlmDrluvs;() 2urim3ny4omtnmfetlsf rtmumoot4alto o3tlslaDulu p;u0tetnmf3oodfm rlueols  etoxm nodamte ieia() Draxroot1oeeniietatlm rlnvpn() ltrxr3ty1oa eauvi;() ruoxopio4oltn net tf 2rrxro;t0alt ifeiysfaDrlnvp;u0tlxrmo tadopDraueils0 rtm(rpiy1lm   fvi ( srtrx ono0tee  oeiys mDemnmpn() leoxfcoy1fp  aivilt0t2to(r nydlm n ieiat) 2ur(mooo4oetoifciasfm2rlnvs t0teeoxo iodlm  luvi s) rxr(r ny4olenmici t srurxrp;u1teeomieiysls rm(vp;()alenmfctodlp   u sls0 eurxo3iydam  mfct tfa2rrumpno4tlxo feiyt s elnvp t4tetnir3oodopt lneolt srxrirpio1am n fesas s2trum no1optniietydls2emnmpn(0 exnmo3iadfmtrlu ol(0trtr(o3oodameemfetat a2urx pou0texnmociasfm2el( s;t4trxnxrciodomDrlnvsls tetrxo3oodlpt  ictasfsrta(  ou0apeo o3iasfa2emnmo ()trxoiocoydomD lu s t) rumxr3no1openlfesl()srurx  ;o0oltn ictldlm2um(vpnt4 rtnmf3totlp rauvils0t2tmio iy1amtemnct (  Dur(rpno1tpe mieilsfaDrm(mp;u) ltrmociydomtr nvo;t) rxoxr oy1op  mnei t)srumur nu4oex mf3iys s2umn p;u0arxrmrcty1op   ivo s)srxoxrpoudomen fvta(  Dtr(mp;o4ape iictyt aDea(vonu) exrxfcoo1fm e u o t t2urio nu1lmtnlfeta( sDrmxm nu4olto i3ild m rmu on(0trxoio iodlaD  n ols0 rurimpnodlmeelictls  Drax p;t1olx iieiasfa2elnms t0aetrifciytoa  auvo;t0s2urxmpiy1op emfetl() 2ta(rpoo0tpxnio3ild aDrlnmp;()artoir tytfa  an o (0teuoxopno4optemnvtl()a2ra( p;t0tpto o3ias mDran pnt4altomr3ta1om r ues t)sexriopoo4lpe  fcsas) rua(mpnu4olt ifetatlmDul(vsn(4tlenxo3totoaDrlnvo;( seuo(o iudlpt  fci (fsDuaxm nt0alto i3iadls em(monu4arenxf3ootfmDelnes s t2urxo oodom  mfvslsfaDumumono0optnmietltfmDrmu snu0tltoxf iotopD aues t0s2tmxo nudamtn fci (faruaur nu0opxomfeildls rmnmont)tetrircia1fpD  uei s0sexmxm oudamtnlneslt) 2rrx  ;t4tee  iciat m elnvo t4aexrir tatlate ues ( seuoir io1om emfcsls  rum(rono1apxnifeiytfm umu s (4tetnxo3oatlmt liesl(0tetrxo ou4lp n ics ()sDtru  ;u4oltomociasfs2ea( o;(0 leoxr tatlmD lues;s  rur(m3nu4omtnlnctlt)s2uaxmonu0olen o3iyt aDeanvsnt4tlxnmo3to1fptraivs;s t2uoio oy1lm  mici sfs2tau ont0tee mieiat m2umnmpn(0tlxrmr3oa1latrlnes t0s2tm(m oydamen icilsf Dumu  nt0texnmoeiaslmDrm( s u4texnif3tytoaD  nvils texrirpnu4omtnmfcs t  rtrxrpoo4oee ifeiadlsDua(vs;()aetoxr ootlmDraieo;s0s2uoio3no4opt lfcsls) 2raurpnt4texomfciadfa uan pnu)texomf iy1laDeluei;t trxoim oo4lmeemies t)arua(rpou1alenioeiatla um( p () eerioctatla eaivi t0t2xmxo iu1om e fvia(fa2umxrpno4oeenmociadfa2rau p;t)trxnxrctodlatr u s t  exmim3oydoptelivt t aruax pnu4ape ifeildfsDemn s u)tlxrif3iadlatelneo s)sexrim3iu1llt lncs s) Dtm(rp;u1ape if3iatfm umuvo;t)trermo oadfa eanvo (0s2xo(r3nudamenmfvta() 2tm( ont1alx ifciyd s em( o;(0aetnxrctotlmt  iesl(0tetmimpiudlm  mivsl()aDumum nu4apx ioeiadfs rmnvo;t0 exrif3oytlpte neo;s0trxmim3ou1op  mnei t) Drrx p;t1tptn ictadla rl(vs;u0alxnmoctadlptrai s;t trxoxopoydale lfcsa()arraxmoot4optomf3tadfmDrlumsnu)aeerir3oodom e iei t0srtoir ny1lpee fvsatfarraur no4tlxnmo3tat s umnvp u0 eeomr to1lmteli il()t2toimpoo4omtemiviat)a2rrurpnt0tetoif3tld a uaums;t0treomrctotfptr ies;s t2um(mpnu4lpe mnvi (f Duaxmono0ole ifciat aDran s t4 rtrmr ia1fate n o;t)texrxopoudale mictlt)arum( ont4alxoioeiyd s2emuvs u0 exomf3iatlpD  u i;s  exoxmpiy4am e nesl()s2ururo;o0ape  fciltla2ranvo;u4trtrifciatom eln i (0s2uo(o3ny1ame  nvsat)sDra(r nu1aptnmf3iydfm2uanvo;t)arenxf3ty1lpD aueo;s0 rurio3oo4op nmiesas a2umu onu4tle  f3ild m2rmu pnu0teenio3oo1fp e n s;s)seurirpnodopeeliviltfsDta(  nt1apxomicildfaDeauvo;u0alenir iodfat auvo;t t2urio3iydap e ivtlt  2tmxroou4tpxn iciatfm um( s;t0 renxr3tydomt an i;(0s2trxo nu4lm nlfctls) 2truro;t1apxn o3iadlm2rlumo t0teenmr oa1oa e uei;t0t2toimpnu4omenmietlt)arumumo;t0olenmfciltfs eluvs;u4trerirciy1fptrai i;t0sexr(mpiudlle mnvslt  Dua(m nu1ope mfeiadlm2uanvo ()alxoxfciadlm raueslt0s2tm(opoydomte netlt  rumxr ;o0oleomfciyslmDrmnvs t0 exnxocoytfmDrau ilt0 rxrxrpiodaltemiesl(f rta(ro;o1opto ietydfmDra( o (0teenxr oadfaDe ivo;(  2toio3nu1aleemict t artm( pnu4opx ifciydfm2ulnvpnt4trxrir3oytopte u il(0 2toio oy1ol emfesa(f rum(rpou0tlxomfctyt a2elnmp t0aetomr tydlptelnvo t  2toimpou4apt mfctas  rtr(roou0tleo iciyd s em(mo u4treoio3to1lp  aieol(  rxr(rpio1ll elfcsl(  rumur ;o0tetoifciasfs2em( o t0tlxoxr iydlaD aiei ( seumirpiu1amt  nesls srra(rooo0tpt ifciydfaDeauvo (4tetrxr oo1opDeanvil(0s2toxmpnu1ap nmnciat sDrmxr ;o4olx iieiytfa2ulnvs (0 exnir oy1omt  i ol(0trurio3nu4lm nmivt s  rua( oot4alxnmietyd s ua(ms u4tleoxr tadlm eluvi;( trtrirpnudllt  fcs t)srtru p;t4apeoio3ilslm2uln s t)tlermf3ty1fat ai slt)t2toimpiy4altemivias) 2rmumoot4aee ifeilt s rm(ms t0aeerxr3oy1lptr i ols t2tmxo3nodam nmicsatfartm(rpno0opxoifetytlaDemu onu)tltnxo oy1fat  nvolt sruo(r3iu4ll nmfeiatfartmump;o1oeeomfciadfs uan s (0alermoctotoa   nvols  euoxopno4amtn nvta()s2tmx pno1olenmiciysfaDrlums (4aexnxrcto1lp  aieo (0seurim iu4amte ivtasfsrurxm nt0oexoifeiltfs ra(monu0 leoio3io1fmDr i i s0trxriopno1amt mfcsltf 2tmxmpou0opeo oetltfs emump;t4 eermo3to1fpDran o t)trtoxopnu4olt mnes tf rtr(moot1texo icils m2rmnvs;() lxrxocoadomD anei;s seto(r nydll e netas  Duax  ;o1olt iieilslm rmnmpnt4tlxrio3to1fmtr neo;t0 eto(rpio4apt  ncilt arum(mpoo4tet mi3tytfs2el(mo t4 etrxr oodfm eai i;s) 2umiopnu4altemnvt () ruru  oo0optniictydlmDrauvo;t4 exoio3totoa  aies;(0sexo(o3iy1lmenlfcs t)a2umx  no1aleniiciadlmDrluvp () lxoio3tytom  lnvol( t2uoxo ou4al nmfeilt aruax ono0tee ii3tatls el(vs t0aetnxo totlmteaies s0truo(m io4ope lnviltfs2umu ont1tltnmfetydfaDrauvs;u)arxoxoctydopDr neol() rxm(m no1omenmfcs (f rumxmonu0aetn i3iasfm2ranms;t4tlxrifciytoa rluvsls0texr(m3iu4op nlicil(  Dumx  nu0oetoif3tysfmDra( s u)tlxrioctytlateauvols)s2urir3nydoptelict s)a2rmu p;o1oex ifeils a uanvp;(4 etrir io1fpteauei s0 rxr(opnu4omenlfciasfaruaxmoot4tpx  i3iydlm eln sn(0altrxo3iotfpDrai s;s)sruo(m oy4apt mfvs ()sDrm(r ;t4oexnmiciytls elums (0tlxoiocoa1oaDe nei (0s2xmim3iodlp nmies s)sDrrxro;u4oee  oeils mDuanms ()arxomo iytlp elu i t s2xoir3no1lmen nesasf rur(r ;u1oltnii3iydlaDuauvs;t0teenmrcoodoaDeai ol()t2xrim3oydal nmietlt  2taxmp;t0oee  ietyd m2eau p;t4 lxriocootomDelueils)t2urxo3iu4apeemnetas) rtm( ooo4tpeniociytls eluvs;u0trenmo3oo1om  li il(0srto(m3nudap   fci s arrmxmoot1tlxnmf3iadfmDean on(0texomo3oo1lm rlu i;(  rxoxr3nydlpt lnvtatf ruaxr no1aet  iciytlm2ul(mp t4 rxrio tadla r uvo s) rurxr nu4opt  ictat  rua(r ;t1opxo i3tldls ulu onu4alxomr oa1faD  ies;t0srxrir3oodale  ivs s  Dra(ro;o1olx moetytlm emu p;(0altnir ta1lmtr uvs;t setr(opoy4omt mfesat aDrrx pot0tltomi3iytls ulnvpn(0aetrircoy1fm   ivol()truo(o io4apt lies tfsrur(r oo1alto fciatfa elnvsn(0 exoxr ty1optean s s0 ruoxmpiydlmtemnvs t s2raurpou0tlx mfeiadfs rlu o u) lxnio ia1oaDranvo t t2trir io1lme  fei (  rtrur ;u0tpe mietlsls2ra(mpnu4 ltrio iydlpt  u s t0s2to(mpou4amee fei s)sDtr(mpot0tpt io3ilsla umu p (0alerir totomt li ils trur(o3oy4al   ivi t aDtaum ;t0olx mfciltlaDumnmonu)tlxrif oydomteaies s0 2toir ou4lmtnmnvsa( s2ta(mpoo0alt  feiydfmDeluvo t4trxnmrctodlmD lu s t0srxmxm3oy1om nmneilt sDrmurpou0opt iietls m2uaump (0 ltomo oodoatr neilt)s2toir iu1amen ivs tfsDrr(mpou0tlxnmi3iatla ean p ()trxomrcoydfmD aies t0s2xrxrpiy1lmeemfcslt  2trx ont1alt iicildla uluvo;u0 rermo tydlmD  uvsls)texriopno1aleemivtas arur(m no1tle  ieild m umump t0aleoxr ootfm rauvilt) etoir3nu1lpe  fciat)srtr(  ou4alxomo3iasfs2elu p ()alxnioctydla e ieils0srxrim iudamt  ivsat)sDururp;o1aexoiociltlm elnvp;t)trxrxrcia1om e i s;s0sexm(r oudape mnct sf 2taxmooo0alx mocilslm rl(vp ()artrxoctytfpDrauvils)s2toirpiydope  nvtat a2trxm ;u1opx ioeiydfsDelnms;t0tltrif3iatlmte u i;s)trxr(rpiodll elneiatfarrrxmpot0optomo3iadlmDemu sn(0altrmf tatlmDrlivi;t t2tr(m3iy1optnlfcia(fsDtax pnu0oleomi3iydlmDumuvpn(0tlxrirciytoa  li il(  2urxm oo4omeemiet ( sDtmur ot1opxnmf3iad a2rm(vont0 lerifcia1fatrln i ()t2xrxm nu4omeemnvsa( aDtax  ;o1apeo f3iydfm2rmnvo t4tlxnio3ia1om   iei t)trxrir nu4altnmfci ()s2taxm ot4aleoifetlslsDelu s;u4 lxrxf iotopDeaies s0 rurirpny4am nlnct ()srtau ooo4optniictys mDuaumon(4arermr3iodopDeluei;t0 2toim iu4ome lfci t)artmxronu1tptomoeiydfm2umnms u) rtomociy1lp  aueo;t  exmxm3iu1amtelieil() Draum ;t4opxniieiasla2ulnmonu)teeoir tydfmteau ols)trxoxm no1lleemncilsfartmur no4tee if3iat m raump t4texnir ty1fmt  nvs;s)s2tm(r3nu1amen fcsas  Dtmump;o4aee iiciyslmDul(mo;(4tlxnmr3ta1fa e nvo;t0teuoxrpnydol  mies sfsrur(rp;u0tle mi3iadls eauvp t4 eenmo iydla eli o ( t2toir3iydal nlnvta()sDrr(mpnu4oet  f3iysfs rlumo;u)teenmr3ia1opDe neo t trxmxmpiu1lmtnlfet t aDurxroot4teeo i3iatfmDulnmsnt4tlenir3ia1fmDeauvo;t s2tr(o3oo4apee fvta( arrrumpou1oexnif3iltfa2eanmonu0 lxrif iy1lpDrauvols texmxopio4lpen ictltf rua(r nu1tlto fetasfs2el( snu)trxrir tydfpDeln i s)teuoirpoy4olt  fetat)s2tr(mp;o0apxnmfetatls eanvonu0trxomocto1fateaneol() etrio3iu1al n fet tfsDtaxrpno4opxo fctltlsDrmu pn(0 etrir oytfa e neo ( t2ur(r oy4ol e fvsl() Dumxrooo0olxn ietytlm2elumo;t0altrifcoa1lpDrlu i t0 rxm(rpiudaptemici ()artr(mpnu4tptn i3iyd sDea(vpn()aexnxo3oa1lmt  uvs ()srum(m oo1lp emnet s  rrax  nt4oex  i3iatla2uaump;(4 etomf ta1oatrauvs s0s2uoio no1olenmnci s) Dua( p;t1oeto oeiad mDra(mo u)treomr ta1lpD  nvi;t) eumiopio4om emietasfaDrrum ;u0alxn fetydfsDrlumo;t)alerxrctytlm eliei s) eum(opnudlptelieil(  Drmxm ou0apto i3iat a2rau snt)areoio ty1fpte ivi;s0 rxo(opnodomeelfesasfa2tm(  ou1apxnmf3tyslm2ea(mo;u0 rxoxr3oatlat au o;()sexo(r3iy1omeemfcs s  rur(m ;t0opx  iciadfm ea( s;()arxrio to1opDraivilt  etrxr3oydlmt  nes t a2uaum ;u1tlxo ociyt mDeaumpnu4aeenmr ta1fmDraues;s0srumxo3io4omtnmfvs ()arurxmpnu1texoiietls s2rmnvo;t4areomf3iatlate n slt) euo(m3iy4optnlfctat s2tm(m ;u0alxoif3tatlsDemu s;u4tetrir3iy1op r ueo;s srtrxo3oydamee ies (  Dum(r ;o0alxnii3ild m umuvsnt0teenxfciadom rlivo;s)tetmxopnudll e nvslt)arrr(r nu0oetomf3tasfa2eau p;(0tlenif tadomt livils)trurim3ou1lp  mnvilt arrmxr no1olx ifcildfm emu p;t) lerxrctodopD  ies (0s2um(mpnydalen iei t)s2raxrpno0alto o3tyslaDraums;t4tlxoifcoytopDrlueslt0 2umirpno1apt lnetl()srumxmo;t0olt  ieilsfsDrm( p;u4alxrif io1oa  au ols setrxo nu1om emnetas)sDrrxmpnt4oexomfeiyt m2ranvs ()trtoir3tydoaDe uvo;s)s2uoxrpiodal emfcsa( srumx  oo0ole ii3ils s umu snt)arxrircootopD livsls)seum(r no1al   fesas s2umxm nt0opto ietytlmDelu s u0alxoio oodfpteai i t)trumxopoo1ol  licsas) 2ur( pnt1tpxoio3tasfa2emnmon(4 eermf3oytfp   u s;s0 rtoir oy1amtn iviatf 2tm(  no1tpe ioetlt m2ulumo t0tleoxo oo1oate u ils0trtr(r nu1lpeeliei t srumx  oo1tpxniociad a ua(vo;()arxrmr3oa1fm r ivi;s t2tmxrpiu1ol emies t)sDtrur nu1apt ifciytfa2rm(mp;()aetrmrcootlpD lneo s)trtr(m3iu4oltemnctl(fs2raum no0oltnmieiysls ul(vs u)tlxnxo3oatoptr ieo;s  etrio3ny1ole lfvsas)srrru  ot0oexn iciys a2ranvs (4 ltnircoatopDranes;t  2xm(rpny4amtnlicta( srum(  no0apeniociad s ra(ms u0aetrir3oatop e i s;() 2tm(r io1olen neta() Dtrumpot1apt  feils s rl(monu)alenxo3oytfaDe n ol( teur(r nydlp elivsl(farumxr ot0apx iictat mDemnvpnu0altrir iy1fptrln s;t0 etmxo nydop n ies ()s2ur(mo;u4aleomfetasls2rl(vp;u4 ltoxr to1lmt luvi;s)s2uo(m3io4llenlncilt)aDtru p;u1apxniieilt s2elnmonu4 rxnmrcoa1omDr i o s s2um(r3io1lpe mfvs ()sDraumonu4tlxn fctadla rl(mo t4arenio3tadlmt aueo;t t2xoio3no4amte fvtlsfa2taump;u1texomo3iydfs uau p u) lenif iy1omDrlivi t) exrim3oo4lmtn fetat)aDrmum oo0olenmoeiatfmDemnvs t0 rerir3oatfa  li olt0 eum(opoy1op   nct tfaDrru  ou4ope iictadfs2um(monu)tlxnxrcta1om  lnvs (0srxm(o3iydol  lfcils sDuru pnu1aet mfeils sDelumo ()tltnio oatopteaieo t t2xo(rpnydll  lfei (  Drr(r oo1teenmfciaslm ul(vpnu)texniocoy1op r n ils0setrim oo1lltnmfes sfa2tru  ;t4apenmieildlm eau sn(0 ltnircoydlaD au ilt)trumxrpiydamtemivi sf Dum(rpot4tlxnmo3iysfa2rm(vp t0trenir3oydlm  aues;t0t2urxopny1al nlicsls)a2uau  ;o4oet  ieils mDum( s;t4 rtoxf3oadomDran ils)trxmiopno1opt mies (  Dtaxmo;u1ape ifciys s uluvon() lxrmo oo1om r nvs;t t2um(m nodam elfesa(  Durur ot4tpeomfeils m2ea(mp t)trxrir iydfp   uvo ( setoxo io4llen fetls a2rru ont1tlenii3iltfaDumnvs t)trtnxo3iydlmte n i;(  2xm(o ou4ll e fci t sDuau pot4tltoifeiadfs elu o t4aexrxo iadoaDrlnei t  rtoio iy1lm nmfvt t)aDum( o;o0apenmfciydlaDuauvp;u4aleomociytlmDrluvi t  rtmiopnydol nmneias)srrrum ;o1tpe ii3tadfm rlu on(4 lerir3ta1lpDe n o;t  rtoim3oudalt  fctlsf Dtrurpno1tptnmfcild s uauvp;u)alerxo to1omD livs ()tetmxrpno4optn nci tfsDumxm ot1aetoio3iytfa2elumo;t) exoxo oo1lmDe i o (  eum(o nu4olen fvsatfs2urxm ou1apeo f3ild s umu o;(4trxoio ootlm eaivi;s0 rxr(r3io1om e fvil( s2uauroot1aeenmo3ilt s2ua(msnu4tlerir tatoaD  iei;s  eur(mpiodam nlfvsa( sDuaumont4apen o3tadfs ulumo;(0 etnmo3iotfmD  nvils) rxoxr iu1ll  mnvs t) 2taurpnt1aeenif3tad m2rmuvo;t0arermf3oadop r u s t) exmxopou4lpte fei () 2tmurono0altn ocils s2eln s;u4alxrmrciatfat aneo;(0texr(m ny4ol  mfetls) rtmxm ;u0aeen fciydfsDua( p;t)tetnxr oy1lpDelu slt)texmir ny4lmtnmfcsat sDur(m oo4tlx mo3tytls ulu p u0artrxocia1lpt  nesls)s2tm(m3nudameemivi tf 2um(r nu1tlx  f3tytls2el(mo (0aetoir iadfa eanei;t)s2xrxrpiodaltelivilt)s2ta(rpnt1aeto ociad s2rl( s;u0alxnxo3oydlpteln ilt)sexmimpoo4ol nlieslt  rumxm no1texoioeiyd aDuln s t)alxnmoctodom r u o;s) 2uo(opny4ole  nes s aDuru p;o4opto ictyt m eluvont0tetoxr ty1fmtraneilt0sexm(o oudomt mfeilt)srrrx pou4alxoifeiad a rluvo u0trenir tytfat  nei t  exoxo ny4am nlicilsfs2ta( pnu0apxomfctydfa elu on(4 rxoifciatlaDran o;t0 rtm(o oo4oltelnetl(faDum(r oo0tet ifeiadla um(mon(4alxnmr3iadlm ean ol( seuo(rpnudop elnvilt)sDumx  ;u0tpe  fctys s rmn pnu0teenxf oatlaDraueil(0 exmxopiu4altemfetlt sDrru pnt1aexn ociatlm2umump;(0 etoxr iodfaDelneslt) 2xmxo iy4lm elfeil( artrxr ;t4opx iieiysfsDea(vonu4 ltomo3totfaDr i i;s  2uo(rpoo4op e iesasf Durxmp;u1tpe moctadfs eaumo (0tltoxrcoadlmtrln il( tetoimpoy4ap elnci sfa2rmum ;u1altomf3ildfmDel( snt0teenmfcta1lateli il() 2xmiopnu1apee ietltf 2ta( ono0oexnmfeiyd sDulnmon(0texnmr3oy1op raueols s2uoir nu1lp   nvs sfs2uaumoot4ape  ieiydfa2rln s;t) ltnio3iatlpDr ivol() 2xr(m3nudop eliet s s2trumonu0apt io3tlsfaDum( o u)altrio ootlpte n s s srtmiopiu4om elicta(f Dum(m nu1altomfciydfm2elu ont)trerif3ootfp raivs;t0teur(o3ou1op nlici () Dtmurooo1opeoii3ilsfsDumn pnt0artnmr3iydfate nvs s t2toir3io4lltelfeta() rrruroot1aptnmf3iysfs2emu s;()trxoxr3iodlpDe nvolt)s2xoxr3oy1altn iviltf 2urur ;t4aptnif3tltla elumo ()aeenmr3oadoatelnes t0t2urxopoy1llen ict t) rtr(rp;o4tpxnmi3ilslsDum(vs;u0tetrxo iatlpDrlivi;t0texm(mpio1lp n neslsf rua(moot1tetn fctydls2um(mont)tlenmr oydoaDrau s (0t2urxm oydlle liciltfa2rrxmpoo0alxomiciat s ulumpnu4aexoif oy1oa r uvs;()s2toxo3iy1apt lncs s)s2raxrpoo4tpt  ociyslm2ulnvs;u0treomrcoo1laDraneo;s s2uoio ou4om   fvilsfa2trxrp;t4aleoif3ils m2ul(monu4trtomo tytfa eln i s0 etm(rpnodllte fvi sfs2umxmp;o0altniociad s2rl(mont0teenxo3iadoatean i;() 2uoxr nu4ol nlieilt srurum ot0aet  oetytls2rm(vo;u0 eeoxo ta1laDrln sl( s2xr(rpiu1ap nmfct (f 2tmurpot1ale  o3iad m emn o t4 reomf iadfp e uei;s  rxo(mpio4lltnmfctl(  Dtrx  no1oex mfetydlmDraums (0trxnxo oydfmt  ivs;() 2xoim iy4lm  mietat aDuaumo;t1aeto f3tyslm2ua( o (4tltnif3to1fmD  n s t0 exmir3iydll   ncslsf Dtr(m no1oexnmfciytla2rau ont4 etoxr3oydopD lu ols0 rtoxr3oo1ap nmivtas) rrrur oo4tpxnmf3iydlsDeln ont4 eeomfciatomtrai s t s2xrio nydoptemnvi t)arur(m ot0apx  ietytlaDum(mp ()trtrxrctydlpDr ivslt)sexm(m3no4lpte fvia() rtm( o;t1tpxo i3iatfs elumont4 rxomo3tydfpDelues;t0srtm(opno4ape  fcsas srtmumo;u1oex iiciadfmDrlu ont4 rxrxf3ootom r n o t0seuo(r3ou4amt  nciat aDurxrp;o0tpto f3tas s2um(msnt0alxoxr3ty1op eanvils0trurxm iu4lmee nctat)a2rr(ro;t4opeoii3tysfa2umums t4aeenxoctatoa rli o ()truoir oo1omtn ieiat arraurpot1tetnmf3ias s2rmu o t0 eerir todlpD li s t0s2xmxm3ny4al emict (faDtrx ono4open octltfaDeauvo;t4 etoxf3oadomD aivo;t trxrio3oo1ope lnetat) rtmu  nu1apeo fetydfm ulu p;t0arenir oa1fat  ieo s0 rxoio3oo1llee ncta()aDurxrp;o0oexomfetlslaDrln s t)tlenio3tydlm   uei;t) rxo(m3ny1ale mfvil()sDrrxr ;u1oeen fctatls2rlnmon(4trerxr iatlpDeau o;(  etoir iu4ape  fvsatfaDtaxr nt0opeoiociasfs uln o u) eenif3iy1laDr i i;()teurxr3oo1ol emfesa(faDra( o;t0aet  oeiysfa ua(vs;u4trtoxfctodoat  ivi t)t2umxo no1lptnmieils)srtrxm ;u1tltnifeilt m rmuvs t4 etnmo3io1fm  an s;(0trum(r3nu1ap n ivtls)srtmump;o0tex  o3ilsla rlnvsnt4 rtrmf iytfat au o s)s2urim3nodalt lfcsat a2rrur ;u0texnmieiyslmDum(vo;t) eeomr oo1lm  aues ()trtoimpou1ap elnesa( srrr( o;t0oexo f3iltfsDumnmonu)trxrxo3iy1lmtr u i;( srtmxo3nu1lm e fetls  2urxr no0opt mf3iys aDean s t4 renio3oytfp  an ilt)tetr(m oo4ole  iviat)sDrrum ;t1tetnmociadfmDuluvp u4aleomrciadlaDe i ols)srxrxo oo4lm n ivs () Drr(rooo1tptnii3iytlm2emu pnt4artnirciotomDe u ils0s2xoxr no1ol nmiciltf 2tmum nu1tee mietldla em(ms t4 rxrmf iadomD aivols0 2xrio3nudlptnmfvtl( aDur( ono4tlx ifeiltlmDra( p;()altrxr oadfpD aivo;(0s2xm(o iodope  fvsas)s2rm( o;u0tpe mfciadfm umnmp u4 eeomo iytlpDrluvsl(0tetrxr3oydlmt lict s arrm(m ;t4tleniieiatlsDuaumont0arenxrciotfp eanvs s)srtrxo nodlp  mfeils)arur( poo1teto ictys s raump u4 lxoif3iotlmDe ueil( trto(mpnu4olt  icil(fsDraumono0apx  f3tyd s ua(msnt4aeenmociatla ean s;s0srxrxrpoo4omee nvt s a2tmxmpnt4oetoif3ildla2emuvs (4 lenxf3oodfmD  uvi t)seumxr3iudop nmfvias)artmu o;o1tet  o3ias s rluvp;t)arerxocoydfpDelu i;s0 rxr(opoodap e iesls)s2ua(mp;o1aptn iciasfs2uau s;u0areomfciatfa   neils s2xoiopnodamtn ivs t)a2rmurpnu0apx ioeias m2uluvo;() exoxocoydlmDeli o ()truoir3iu1am n feia(fartau  no1tex ifcildfm el( p (0 lxnif io1fpDeaneolt t2xm(rpio1lmen iesa( aDtr(mpno0aptn oeiys a2rlumont) rtrxocio1faDr uvi;s)trurxo iudal  liviat)arrr( o;u4optoifctlslm2ranvont) etrxrciy1fatr n i t) etoxm oudopt lnvta(fsrur( pnt4apeoiiciatlm umuvo;() rtoxrciydop  li i;s)texmir iu1olee fcslt)aDraxmo;o0tle mf3iatfa rm( p t0 rtrmrcoytfptrlieols0 rurxo3io4ape  nvi (  2rrumo;t1tpx  f3iytfa umn o t) ltniociydomD aies s0 exo(opio1ap nmnetasfsDururp;o0olxoiocias s2eluvsn() rtomr oodop  lues;s)seurxrpoy1lpeelfcsls)srtmx pnt0tetomfcils s emnmpn(4teenmr tadfpDeaneols) etmxm ou4ame lfvt t s2umx o;t1oeto f3iltlm2umn o;u0aexoio ootfateln i s s2urxr3oo1ll nlivs tfaDraumoou4tlen f3iasfm rluvpn(4arxrxo3oatlpDraues;s seumxopio4omt  nci sfs2tmxm oo0opt mfctls mDra( snt4arermfcoytomte n s;t0t2urio3ny4llt lfci s) 2urxmp;o1aetnmf3tys sDua(ms u)aexrir ty1oat  iei s  rumio3ny4lptemnei s s2um(m nt1ale mfetltls ua( p ()tlxrirciy1lm   iei t)sruoirpio1ape  ivi ( arrax onu1oleniociasfa emumo;(4altrio3iodlmt auvo;t)s2xoio iu4lm nlfcias)a2raxr no4oexn f3tyslaDelums t) rtrmoctatlateln o ( s2urio3iydomeemieslt aDtaurono1oltnmieiydlm2ul( s t4arxnio tydoateaivils)trxmio3oodome lnesat aruau p;o0tlxn ociad a ulums u)teeomf3iatfaDe u i t)s2toim nu4lltelfvt t)a2um(rpnu4ape  fciaslmDranmont) etnmo iy1lpDeau sl() 2xmxo3nodll n ncsas  Drr( ono4alt ifctltla2emu p t4teenmfctodlp eln i;() 2xm(r iydal  lics ()arrru oou4opx mociyslsDemnvp (0 lerio iy1lmtr nvs t) rxm(m iu4ll nmnet ()sDtm(m ;o4tex  oeilt mDeauvs;(0areoxo to1lmt li o s0teuo(r3nodaptnlfct sfa2rax o;u4tltnii3iat a2elumo t0arxomf tatfpt  u ols s2xo(m ou1altnmiviat a2raurpno0aetnifctytla emuvp;(4aexomocty1om rln sl(0s2tmio3io1am nlfesltf Dtmur nu0apeo ietytfm rl(ms;t4tlxnxrcto1lpte neslt0 rxoxo nydlp  lfctl() rtru pou4tlt  ictas s2rlnvs;(4 rxnxoctydlmDeauvs;t trto(mpio1llt  nvs (fsDtau pnu4oleomi3ildls2ul( s (0 lxnxf3iydom raivs t)sruoxo oudllee net s sDtru ono1tlx iieildfa2rl( o (4 leoxf3ia1om  an i;() rum(m3oodamtemict s srtmu  ot0tpeoioctltfa rl(mont0trxrmfciodfa  lnes t  2urxm nu4lmt mfvsls arrrx  ou1tpx moeiytlsDul(mo (4alxrxr3oatlpDrauvs s  rtrir nodamenlfeiltfa2ta(rpno0tpxo o3tad m elump;u0altrmr3io1lat ln i;s setrxr nodalt licia(  rtm(moou1oexn oeiltfsDumuvo;u4aetomrctatomDrluvo s texoxm io1lp n nciltfsDtmurono4aeeomoctys s2rm( pnt0artoirciodoa eli slt sexo(opio4lpe mfvt t srum(rono4optn ictltla2elumpnt)tltoio to1oatelu o s t2trirpny1llee ici s) 2rmxm ;t1tptn f3ilsfaDuanvon()tleoif tatfpDraueols0s2xo(o iy4om n nvi s)s2tmxrpno1tpt mfciyd s uluvpn(0tetoioctytlate u s;s teur(o iodolenmfesat sDrrumpnt4apt iietyd m emnvo;()tlxnif tydlaDeli i;(0 etmim3ou4lpeelieiat  Drmx pot4tee ii3iatfsDum( s t4 rtrxociodoatrlu sl(0srxoxmpou4aptelictlt)sDrr(mo;o4oleo oetatls2ran onu)aexoif3oy1fmDrauvi;( srxrxo iu4op nmncsls sDuau  oo0alt  ociasfmDrmumsnu)trenio3tydlp elnvo s)t2uoimpou4lpeemnesat)a2trumo;o0oltn ictatfsDumumo;u)trxnmrcta1fmt  ueil(0 euo(mpoo1ole  fct (  rrmx  ;t4tpt mfetyslaDem(vs u0alermr tadfa elu s ( trxr(o3io4ale mncslsfsDrax p;u1tle ifctldfmDrlu s t0 lxrmoctadfp r nvs s)srxrxo oodlpeemfcsat arumx  nt1olx mo3iytfm uau s (0tltnxrciotla ranvs;t srurirpnudol emicsl()aDum(mp;o4tlxo f3iatla emn pnu4arerio3todoa e n o s0srur(r3iudlpe mncta( s2rm( pot4tet ii3tysfs2ua(vp (0altrio3oo1oaDrlu i s) euo(m no4omenlfct s)s2tru  nu1ole mo3iat aDulnmonu) lxoio3tydfpt aueo;t)trxm(o ou4ape mnctltf ruau  nu4tlt  o3tatfs eluvsnt)trermo3oatfpDeai o;s)sexoxo io4apeelics sfaDra(mpno1teeoiieiatla uau p;()trtoio io1om eaneo s0s2tmio oudom   ivt ( aDraur no1tleniociasfm el( onu4tleoxo oa1fm   ieils s2trxr iydomenliet s  2urumpoo4aetomoetlsfaDum(ms t)tltnio iy1lat  u o t0trtmio3ny1am n ics t)artr(  ou4tle moctls a umuvsnu0 eenmf oydlp rai s ( teumxo3oy1ap nmictl(f Drau p;u0tptomf3ilt m rl(mp u0tlxnxfcoodlm  lieo;t0trtrir oy4om  mnvtasf 2ur(mp;t1opt ifeiydla eau p u4arenxr oa1oatrlivols0s2urxr no4ome lfciat) rtr(m ;u1tpx if3ilsfa ea(vp;t4aeeoiocoadlp  liesls sruoiopiodomte ivilt  2rmurp;t4teeniicils m eluvo;t4 lxoxr3todopDr nei;s) rto(m3oo1om e nvils)sDrmx o;t1oeeoifeiysfa2uln p;t4aexrxociy1fpDeluvi t  2tm(m3ou1ll e nctlt) rrr(r oo4texnioctaslmDul( s (4teerxrctodopt  nei;t0s2tr(opny1ap nmiet (fs2tm(mp;o1alenif3iat s eau s;(4tlxnxfctatlm eln o t0 2uoxr ou4ol e ies tf rum(roou4alx  o3tltfa2ea(mp t0trtrxf ty1fa  li i t)texrxmpno1am nlfcils) Dta(ro;u1apt ifeilt m el(vs;(0artnmo oy1omt livi s0srxr(m3no4ame  ieil( aDur(rooo0tlto fetyt mDrau ont0 ltoif to1opt  uvol(0 2toxm iudaltemncils  Dtru  ;o0olxomoeiydlm rmuvo (0 ltrmf oytlmDraivil()tetr(rpoo4ale lfetl()s2tau pno4tet if3tydfs umuvs;t0 etomr3oytfate ieols  2toir no4lpen ivs (  2urxrpou4ope iictlsls rlumpnu0aeenmf tytlmD anei t) etrxo iudopeelfct (  2uau o;o1apenio3tytla rmn p;u4 rtnxocta1oa rai olt)t2trxr oy4lmtelivsl()srtmur ot1aleo oeiydfsDua(vsnu)tlenxfcoytomDraueo (0trxr(mpou1al e nei tfa2tm(  nt1ale miciat s rmuvpn() leoxo totlptean ils0 2tmxo3no4am emiei () Dumuroot1alxniociyslsDean on() rtnmr3ta1late nvolt0t2ur(r nodoltnmieiatfa2trum oo4tlt ifetad mDumums;t0 rxomo3tadom e n s;s)t2urir oodap n ictlt srrm(m ;t4aex  o3iyslm ulnmpnt4 lxrxo oa1oa elieslt trxrxr3ou4op  lnvi t)arum(ro;u0olxn fcias s2eluvo;t4treomrctodlate uvi;t)srum(rpoy1lmenlncsls srtm(mpnt0optnii3iatfmDeluvp u0aetrxr tadop ranesls)t2uoir3no1lp  mfei s  Dta( pou1oltoif3ias m2rln on(0 rtnxo iytla ranei;s)s2xoir3oudap emfvilsf Durum ot4alxoio3tydls emums;(4 lxoxf oodlaDelivo;()srtrxmpiy1ap  licil()srtrxroot4texoif3ild sDum(ms;u4trtoio3oy1fptrlnesl()setr(m3nu1alenlietas)sDrrxront1tetn o3iytfs ua( s t0tltrxocoy1oatrli i;s)s2um(m3iy4ap  livils srta(ro;o1oexn iciyt a2uau s;t)aexrxr oy1oatelnvsl(0setmio ny1lmt mivs s) 2rrxr ;u0apxoifciatls2eauvont0 eeomo3io1fp r nes s truo(r oydal  mietls)a2tru  ot1alxn ociydlsDea( o;(4aexnif to1fp   u s t  exo(r iy1opte fvias)srtmurp;t4texoii3iat m ul(mont0arermrcoodlm eai slt  exmimpnu1lp  lict s aDtr(rooo4tpx moetas a umnvs (4tltrxo oo1omDrlu ol( s2tmxo3oy1alt mneslt)a2tmu  ;o1olenmf3ilt a ea(von(0alenxr3oytfmt  i s t t2xo(r ny4op n ncs tf 2ta(r ;o0tlenif3tat m ea(msnt4 rerxociytomt aneols) rtoir3oydol n fct s)srraxm ;o1ole ifetldfs rluvp;t4 renio ootoat lueilt0teto(opou1lmee fvi tfsruaxrpot0tle ifctas m2ua(vsnt)trxnio3oatlpDranvs s)srxmxmpny4ap   ietatf ruru  nt0alxoioeils s2uaumo (0 etnir3todfa r uvils)t2to(r iu4omt mivslsfa2tmum ot1oeto ictytfmDemumo u4trxrifciydfatr uvi s  exrxm iodal   icil(  2ra(rooo4opx moeiydls2ranvo;u4 etrxo3ty1omDelu o s0setoirpny4ll   net s aDra(ro;o4aeenmietyd a2uau pn(4tltrmo3ty1lm   ieslt s2triopnudom  lnvilsfsrtaumoot4optoiieiyt a el(monu)arxnir3iydlpD auvs;s) rurxo3iy4lpe lnet s  rraurp;o1tpenif3tadlsDea( p;t4alenmr3to1oate ueo (0tetmim oo1opee fvtltfs2rrxro;t4aexn oetls s2emu pnt4 rxrio iy1fptr ieo s seuo(o oo4lptemneia(farrrum ot1ape  i3tls m2eln p;u)trtnmo tadomDranei s0trxrxopiy4apenmfvilsfsrtmu oot4olx moeiat sDrmums (4tleoifctydlpDelueo;(0trumim oydal nlivs (  Dtmxrpnu0opt ioetldfs2uauvs u4trxoxf ia1faDrau i;s)seurxopio1ale lnct s)aDtaxr ot4olx  i3tls mDulump u)arxnmr tatlmtran i t  2xmio ou4ll  lfcia()a2tm(r no1opxnmi3tltfaDrlnvp;u4artoircoadoaD  ieil()srxoir oodap n fvt sf rum( pnt0aetomo3ilsfa emnvon()tlenmfcty1lm eluvs;t)seuoir3ny4am e fes ( aDum(rpot4tlto oeiydlm2uaumpnt4texoir oydla  lneilt0t2umir ou4ope  icilt  2trump;u0apx mfctydlm rlu ont4aetomr iy1fa   nvolt s2xoiopnydomtn fctlsfa2umurpoo1olxomfeiadls2em( p;u)arxrir iadoaD  nvolt)trumxr3oy1omtn nvsat)aDtrur no1tetoiocilt aDul(vo;(4tltoio to1om e nei;t  euo(m ny1oltnmncs tfaDtaxr ;o0texnii3iytfs eauvs;t4aeerirciadopD  uvi ()sexrim iodlmeelnes tfa2ta(ro;u4opeoif3iydfaDrmnmp ()alenmocoydlpt anvil()sexo(o3ny4ol n fvs ( s2ta(mpot1opxomoctyslm2emnvpnu4 lxoxf ootom  lieil()tetrxm oo4amte nes (fa2umurooo0aetnio3iytfs raums t0altrxo iadomtrauvs t)teumxo iu4lpee ivsasf rrm(mp;o4tptnmf3tlslsDulu snu0tetnir oatlmtrauei t trxm(rpoudap  mnvia(f Dta(mpoo1tptn o3tys a emnmpnt4 exoirciatoaD aueols texrir iydap elnvsa()aDrr(m ou0alxoiietadlm umnms;()tltomocoytlmt  u i;t0srtoxm nodal nmfvils  2tau  ou1aptnif3tadls elnvs;(0 exrmrcta1omD anvi s) 2tmiopno4amenmnct t aDtaxmpou0ape ioctldfm2rm(ms u4artrir3tatlmt li ol()s2uoimpiu4ll  lnctat)artr(moot0aeeomoctld aDulumo;()trtrxrcoa1lat ai i (0seuriopoydalenmfvsl( a2tau  ou0ape mf3iydfmDua( onu)teerif3oadlmtr ueo (0s2umxm3iydole mfetl(  2ur(mpnt0ape miciyt aDulnvo u)tlxrmf3todomDrai o;s)t2ur(o iu4lptemfci s s2urx ono0oex mf3ildla2ulumpnt4 rtomf tadfm rauvi;s tetoxopny1amen ietl()srur(rpnu1olxnifctytfs2emuvon()teenxf oodoaD an i (0 rxm(mpny4alenmnet s)a2tax  oo1aetoii3tlslm2emuvp;u)artniocio1lptr n o;s)teuoim3oo4ll nmfcs s  rtmxmo;o0tpxnifeiytls ul(mo () etriocoy1op rlivols)tetrimpoo4amen fcia() Dua(mpot1oee if3tat sDeanvo;u4arxnxr3oodoaDe uvo s0setr(opnodllee nes sfa2uaxr ;u0tlen f3iydlmDuanvs;u4tltrio3ta1lp r ueo;()trxoirpno1opte fviatfarrm(rono4apto ieiltfm ulnvs (4 rxomo3ta1lmtranvils0sruoio oy1am elncilsf Draumoot4tpt mi3iasfa elums;t0 lenxo iadlptrlieils  euo(m3oodapenlivi ()srta(roou4opxoifetld mDrmn p u0 etnmfctadlmt an s s0 exo(r3nu1omt  ncsatfa2um(rpou0tet mocild m eanvont)aetnmf tytoaDeaues;(0texo(m3nodol emnvia( srrmurpnu0tlx mietyd a2rmnmp t0 rxnio oa1optr n s;t)tetoxr nydaptn nvtl(f Duaurp;o4tptomi3iat mDuluvo t4tetnxr3oadfateauvsl(0tetmiopou4om nmiesas) 2ua(mpno1ole  oetysfs rmnmo;t4tltnio3ty1lmD ln o (0t2to(mpiy4ol   ivi () Dtaxmp;u4ape  ociyd mDrmu p t0tlxnmocoytomtrln slt0s2umxopnu4llt  fci t)sruaurp;o0opx  o3ilsfaDuauvonu)arerifcto1opDrli i;t srtm(o iydap nlfct (faDuaxront4tpenmfciad a2um(mpnu4treoxrctadfptr ues;t)setmxm oodlmen nesl(fa2uau p;u1aptomf3iyd s2uanmo;t)tetoxo3tadfp   i s t  2um(mpoodameelnesa( sDraumpou1oeto i3iad m ea(vpn()artrxo io1opDelu ils0setrio no1lmeelfvil(  Duax o;o0teeomoeiltls2ulu s;u) etrmf3oy1fatrlnes ( seumirpoudopen fcsls srrmxmooo1tleomieilsfa2emu o t) rtnir3oy1lpte uei;()s2xm(opny4lltemiesas)artaxm nt4tet  fetatfmDuluvpnu) etoxf todomtran il( srxm(o iydlme  fvsa( aDtaurpnu0ale  icilslmDea(mo;t4alenxf iodfateau s;s  2um(o oo1lm nmfvtltfs2ra(ronu4tlto oetlslm ea( s t0 rtoxo io1opt  n o ()t2urxopno1apenmfcias)s2rrx p;o4teeomieiat m rm(vs;u4tlxomrcoo1fp  au il(0 2toxr3oodop emics t s2raxrooo4tlxo fciat a2uanms;() exrir iydop  lueo;t sexoxm nu1al  mnctlt srrr(rooo0alt ifctlt m2rmu o;(0 renir3iotoptelies;t)s2toir3iydaltelieias  rrm(rpou1opeomi3tltlm rauvp;u4 lerxo3tadom  anvs s0 eto(r io4aptnlncia(  rumumonu1olx  oeiys s umnmo;()tlxnmr tydfp   neo;()sexmxmpoudalee ieiat arum(  oo1alen icias s2elnvs;u4 lerxfcoy1op  ln o;t  rur(m nu1oleelieiat  2trumoot4tpx mfeiytls umnvp;(4alxnmo ty1lm rlues;( s2tm(opnu4amte ictl(fa2uau  ;u4tpxn iciadfa ran sn() exoxr ia1fate uvols0s2xrxm3ny1lp e netl() 2urxrono4aeeomictldfa2rl(vp;u)aexrxr tydlm  ln ilt)setm(mpnydlp e ivslt sDrmur ot0oeeomoctas aDel(vo u0arxoxfcoatfp e nei;(0 rxoirpiydalen netlt)sDtrurono0apeo oeildfsDea( p;u) etoircootfmtraueo;() eto(r iodoleemfvsltf Drrxm ;o1teeniictasfa rlumo (0areomr iatoate n ils trumio3io1olenlfesltfsDum(mpou0tlenmfctas m2eluvpn()areoio ootlaDranei;s0 eum(r iydlm  lncsltfsDraxrpou0aptn oeiatla rmnmp;t4 ltnir io1lm e ieo;(0 euriopnydlm   ics s)sDumur nu1texnmietls s2umuvs;u4trxoxf3oadomt lnei ()trxmxm iy1optnlnes ( s2rmurpnu1tetn o3iys sDumuvp u0 rxrxociy1fmt luvi;s s2ur(r3iy4lltn fetl( a2uaxm ;t4olxniiciadls2ranmp u)trerir3iotlpD li o s)s2tmxm oy4ape  icil(fsDtr(mo;t0olx ifctadlsDrl( snu)arxoirctadlmtrlnvol()s2xr(mpiu4ope  fvia(  rra(mpnt1aleniictyslm2emn ont0trermo oytoaDeai olt0 rto(r oo1lltn ict (farrmx  ;t1oetnmf3iat a umu p t) rxrirciy1opDrai i t0 2umxo3oo4ameelfcil(f 2rauro;u0altomociysfs2ulnmo;(0trxnif3oytfa   neol() rxr(o nu4llteliet s  Drm(m ot4ole  iciadfs2ulnvo u)aetomr tatfaD  nei;(  2uo(o3nu1oltelici s) Dum(rp;t4oexn feildlm2rmn snu)aeerif ty1fp r ieil()seum(opiy4optnmiei t sDraxr ;u4olxnii3tyd m2el( o;(4tetoxoctotoa elnes;(  etmxm iudll  lnctl(  Dtax pnu0aetnmf3tlslaDel(mp (0 rxomf3oy1fmt auvsls0setmxo3oo1op  mivslt)aruaxr ot0olto ieiysfa umnmp;u)treoxf3oodoa elieo t) etr(opnu4optnmivt t a2uau oou0olxoioctldfsDeluvsnu)artrircia1lpDrlivilt0trtr(r3iu4alt mictasfarumxrpoo0olx if3iaslmDuau p t)tlenmocoydlptelivslt0 etoim3iu1om  mfetat)aDuru  no4olx ifcilt mDul( snu)arxrxf3iadop eau i;(  2xr(o3no1op nlfes t  2taum nt0tlxn fetaslm2emnvpnt4arxrxrctydopt aivi;s0texmim3oudol e neslsfa2rrxmoou1tetoiociaslm2rmuvp;t0teeniocoo1opte iesl(  ruo(rpio4amteliet ( s2ra(mpot0alenmi3tadlm2ulnvo (4arenxf tatopDelieols0 rurxrpoo1ll eliesatf rta( p;t4alenii3iyd s2ea(vp;t0 exoxocty1fmDe neols tetmim3nu1olenmivia(fsDtrx o;t0ope  iciysls elumo;u4 rtrircoo1fmte nvsls)t2ur(opoo4ll elneslt arrauro;o0tlxnif3iltlaDuan p;t4trxrif tydfpt au o t)t2tm(r ny1apt lictatfs2um(m nu0apx  i3iydlm ra(mp t4altnxo oa1om   uvo;t0srxoim3ou1op nmnvsatfarrmx pou0alxo ictaslaDel(vsn()aexomr oo1fm rluvol(0t2tmirpoy1lmtn iesat)a2ur(r no0oleoii3ias aDumumsnu0 etnmf3oadop eai ils s2ur(r3ny1ale mfvslsf rumxrpou1aex mi3tldfm2rau o ()aexnio3io1oa eli ils0srum(r iu1optemfvsasf 2uax pnu1apxnmi3ilsla emnmp t4trxrxo3ia1fmt  uvolt0t2xmxr3oy1ap   neias aDrrx o;u4oleomfeils s rmnvo t4arxomf3iydfp elnvo;s0 rxoirpoy1amtelnvt (fa2rrumo;t4oeto oetyt a em( p (4aeeoifcoatfat lnesl( trtrxrpnydol nlnviatfsrta( pnt1teenio3tydfa emnmpnt)areoif ootoateaieo;( s2xmimpiu1al nlnvsas)sDrrum ou0altnifeiatfm rm(vs t) eeoxr io1om   uvs;(0sexr(m3ou1alen neiasfa2uax  ;u1texoifeiysla2ea( p t) ltrmf iatfpDean i;t seur(m iydom n fetatfsDtaxrp;u4aee  oetldlsDel(mp;(4trtnxf iy1om  livol()t2xmxopiy4ol elivil()srtmumont1oeenif3iltfm2rl(mo t)tlxrxrctadfaD lueo s) ruo(r3oy1altnlicilsf rumxm oo4aleoifeilsfs2rluvonu)trxnxf3oa1la eaneols  rxo(r3oo1llte ncslt) 2rau p;o0optn fcilt a2ua(monu)teeomr ootopD ai s s0srum(o io4ame lnet s) Dumxmo;t0aptoio3iasfa2elu s;t4tleoif3to1omtean i;(0tetm(o3iodam n nes (fs2uauro;u0oetn i3iysls ua(vs;u) eenxr iodoa  li s;( texmxr3ou1ome lfcta()sDtm(m ;u1apto fciaslm2emuvp;t0trenmfcoydfa e i s t  eurirpno1omeelfet s)srtr( ont1olx  f3iyt s2uanmp t0 etrmf3oo1fate ivi (0t2uo(m3oy1lmtnmnvi s)srrm(  no0opxnmfciltla rmnmon()aleomf3totom  auvi;t0sruoxm3oo4amtnmnetlt artax  ;o1aleo ociadlaDemumpn(0 rxrxociodop rai i t0 eurxrpoy4lpe  fvs s a2ta(moou4apeomi3iytfs2um(mo;u4 rxrmociodlp raivils)srtoxm io4om emfcs sf 2rmxro;t4tee io3iatfa rmu onu) rxnmo3iodopDrlnvi s trxm(r3iu4ll n fcta() ruau  nu1tlt mietydls rmumont) ltoxo iatlpDr nvo s)teuoxr nu1ape  nvt ()srrauroou0oeenmo3iyslsDeauvon() ltoifctotlaD anvi t  rum(m3nu4ameemietas)arrm(rpnu0apxnifcilslm2eaums t0trxrir oadfatrlnvs;t0trumir3nydale mics tf rraur no0oexomietltfm2ea( o u) rtoxfctodfpte ieolt0t2xmxo no1op nlics sfa2rrxroou4tltn ietadla rmnmp;() etrxr3iytopD  u o t) etoxo no4oltelfei s)s2rru p;o0apeoio3tltlmDeluvo;u4aexrif3ta1fmD  nei;t sruoim3ou4ap  mnvil(fa2um(  ot1optomiciys mDea( sn(4trenif3tadfa e nei ( trxrxr iy1lm n fcsa()aDrrxmont4alt mocias m2ranmpnu0aeeoxocia1fptr uei t) 2umio3oodomeemictlt) 2trxro;t0tee  ocilt sDra(mo u) eeoxf oadoptr ues t s2umxm nydomeemivilt  rrax p;t0tltomoetyd sDelums (4 etnmfciadfm ean sl( tetm(opoodal emictl()srtru ono0apxnmiciydlsDuau o;u)aexrir totoa   neo s seumxmpou1ope lfvi s)srum(m ;t4ale iociydlm2emnvsn(4texoxocoatlm  li o t)trtmio oo4ame lnet s)aDtrxmo;t1aptnmfciytfm2em(mpnt4texrio iy1omtran il(0 eto(m oo4optnmncil( a2rr(mpoo1olxnioetydfs2rlnvpnu0trtoxf3oatoatraivo;t  2xoxr ou1llteliesa() Dumx oou0tetoif3tas a2ea( p;(0tlxnio ia1opDeauesls  2urxo3ou1lmtemnci (fs2uaumpnu1tltoiociaslsDem(vont4altnxociytfaDe nei;(  rtrxopiy1lpte fesltf ruaurp;u1aleniictydlm um( p;(4 rtnio oa1la rli ols srur(o no1oltemiesa(farrrurpoo4tleoifeiat s2uauvp u0 etoiociydomtrauvsls0srtr(mpoo1am nmiei tf rtr(moou4alxo i3iadlaDem(ms t4 rxnio3ia1oateli i t) rur(r no1ll emivils)sDra(r nt0tlxnmfetltlsDrmnmo (4alxrio3ty1lp   u s s0truoxm3iy4ale  fcsls)s2umx o;t1olenmf3iyslaDem(vs;t)tltomfciy1oatrliei s  2tmir3ny4optemfctlsfarumur ;u1optnmi3iad s umumont4 exoir3tytfaD aiei (0sexr(opoo1lptelncs sfs2ururp;u1alt iociytla rlnms t) leomfciytopt lu o t0s2tr(mpoo4oltemivtasfartr(r ot1oeto i3iad s rmnvpnt4trxnxrcoy1lmDeln s;( s2tmio nu4ol nmnvta(fsrum(  ;t0opx iocildla umu s;()alermoctytom eliei (0 eumimpnodlpt mfci s  Drm(  ;t1opxnifctyt m raums;t4 lerio ta1om rlu o s0 rxmxopny1altemnetasfa2tmu pnt0oeenmo3iaslm umnvsnt) leoxf oodomteluvs;s  rtrxo3ny1am elfcia(fsDuauronu1aex  i3iydfa elnvsnt)trenxr oa1op   uvo;s  eurxo iudoltelictat a2umxmont1alenmf3iytfm emums t0aetrio iadfmD  ivs s)t2uoim oy4optn ieils srtrurpoo1alenmfciyd sDranmont4 lxrmfcoo1fp raivi ()t2uoim3nydom nmfct ()sDrau  no1tlto ictytla2rmuvp t)arxnmf3ta1lp  an i ()tetoim3ny4al  mnct t) Duax poo0teen feildlaDemuvo;u0trtnxrctotlpDrai o t sexrxr3oy4apeemieia() rtax p;t0tlt ifeiat a uluvo;(0tlenxo todfmt lueils0 2umim iu4lp nmnetas)a2trxroou1teeoiietlsla rlnvpnt0trxoir3iy1opDr nvsl( t2xr(mpnodol nlieta( srtru p;t1aetoio3tadfa em(mp;u0 lerxr3oydfaDr uesls0setoio3no4op e neta()s2taxmo;t1opxn ietadla rmn snt0trtoir tydlptelnvolt0 exoxr3iydome mfvsls)a2rrx pou1aptoioetltla2rlu snt0tlxrxf3oatlaD aivo;()seuriopou1lmtelnct ()srrmum ou0olxo ictlt sDemn ont4arxrmocoodfmDeaivilt)trxoxo io1olenlictat s2ua(m nt1opxniociaslm2um( onu0trerioctytfmDeai o s0 eur(opnu1lpee fci s)srurxmo;o1aex ifeilsfa rluvsn(0 eenmr3iadlaDelivi ( trtm(mpnydllt  ictls sDrmu p;u1olt  oeiasla2rm(mon(4 etoxrciytfatraieo;t0t2urxo3no1ap emietas  Dumuront0oeeomi3tydlaDrlnvs;u4aetrxf3iadfate uei;t0t2trxr3iy1llenmfet (faruaxr ot0apt moeiytfs uanmpnt4 lxnxfcoa1oat au o;t0srumxm ou4ll emfetlt artmumpoo1tlenmfcild a ra( p u)tlxnxf iytlptr nvils) 2xo(o3iu4ole  netls) rtm(mooo0oetomfcilsfm emnmp u4tlxrif to1lm rlueo s t2urir iydom nmnei t  rtm( ono1apeomoeiadlm el(msn(0artrmf todomt aiei s0 2xrxr oydolteliesltfsDrruro;u4aptomietatlm2umu s t)texrifctodlm e ivsls0s2xoimpnu1ape lfet sfarrrurpnt4aptoiietatla2ranvo t)texrxr3iotlptelivi ( s2ur(o3io1opt mnes (f 2umur nt0tex iicilt s rmu p u)teenxrcta1lmt luvilt  exrxrpoo1lmt mfcsl( arta(  oo0tpt ifeiadfs eluvs t0 rxoxf ta1omtr i o;s0s2trxmpnu4lm  micslsfsrururp;t4tlxomoeiltfaDranmp ()trtoxoctotfmDraueil(0s2trio no1lmt  fvilt) rtrur nt0aptomf3tat m ea( s u0aleoxo3totoa eaneol(  rtoxm3oodam e fvsa() rurxr ;u4ole  o3tlt aDemuvsnu0tlxoxoctadfpDeauvolt)s2uo(rpou1alen fvsas)artaxro;u4olt iociadlmDuluvo t0texnmo totfpDr u i t) 2xr(opnu4apte netat  Dtauro;u0altn oetyd s ra(mon(4alenxo3oa1fp   nvi s)texoio iydop emneias)srur(mooo1opx mi3ilsfs uan onu4 rtrmo tadom   i olt texmiopoo4ll nlnvt sfsDtr(mont0oeen fctaslmDua(mo t)aetrircoy1omte n olt srtmio nudoltelfviatfarrm( pnt0aexnii3taslaDelnms;(0tlerio oatlaDe i il(0t2xrxmpio4aptelfvi t  Drm(r nt0tpx mietydla ul(mo (0tleoxfctotlpD lu o s)seum(mpoydam elneil(fs2trxrooo4apxnifcils a2rmnvp;(0arermrcootla  lieslt)tetmir3iu1om   fctatfaDur( ooo4tpxoioeild m2umu s;u)tlxniocoy1lmDelieils0s2xr(o3ny4omt  neias)artax pno4apenioctasfs2rm( s;() exrmo3ty1optr u s;s) eurir3iodll nmiesl() Dtau poo0alxn ietldlaDra(mo;u4alenmo3to1oatrlneils0s2toir no1amee fcia() 2rax poo4alxniieild aDulu o;t)aeerirctatfpD  uvo;s s2xmimpiudllee neiasfs2tmumpnt1tlen oeiysfm2rm(vsnt4 lxnmo3oo1fa rlivs s) euoimpoy4op  lnvt s)aDtmu pot4opto ietyd s emnmont) eeoircoodfpteln o;( s2umxm nu1llenmfet t arrmumonu1tleomociltfs2uluvsnt)tlxnmr3iatfmDe i ols)texm(m3iu4al e nctls a2tm(mont4olxn fetytlaDem(mo;()trerxociy1oateauei t0 rxoxr3nudlm nmfct t  Dtrx  nt0alenii3iydls2ra( pnt)aeeoxfcoytlptelivo;(0t2tmirpnudll   ieiat) Dum(rp;t0aptnii3tatla2rlnvon()alenmrciydop rluvi;t)s2toxr3ou1lpe  fct tf 2umxmpnt0alxo fetatls2elnmp;t0tltnir tydoaDelnvs;s0 rxoxo nudopen neia()srtm(  oo0olenifetadfm2rmump;u)aeermo3oydfm rai o () 2tr(opiy1altn iei t srtm(mpoo1aeto fetysla ulnvs u) reoir tydfmte ues;s0 2um(r nu4ll nliei t)a2rax oot4ape  iciadlm emnvo t4tetrmr totfmte n sl(  rxmxo oy1lltn feia(f ruaurono0olxo o3ilt mDul( o u0alerxr3iatlpDeli ol(0s2xrxo3no4lmte ieiltfsDtru ont0apenmf3ildfm2rau s;t0trxoxo ootfp rai i;t0 2xoxrpiydame livs s) 2ta( pot4tpe  ieiadls rmumon() leoirctadla r ues;(0 exoxo oy1oltnmfvslsf 2rmx poo0altnmiciys s2uaumsn(4 rtnxo3io1latrlu o;(  2tmirpou4olee fcsls srum(  nt1oexn f3iatls2em(vo u4aexoxrcoadlm   ueolt0 rurxopiu4ll n feiltf rrrur ;u1aex io3ild mDra(vonu)aetomf todom rluesl(0 2trxmpnodopte ivia(f Dtmu p;u1tpeo fcilt s2rau o;u4trenxf oo1la  lu s;t srxmiopiodapee fet t)aDrmx o;t1ale moctldlsDra(mp;(0artnmo3io1laD aueo;s) etoxrpio1altn nvi s srtaumo;t4tltn f3iadlmDulu pn()trtnirctydop  anvo;t  rtmxopny1alee fcia()s2rr(ront0tpe mietysfmDea(mp u4arxnxr3tadfmtrai s t  rxoxrpnydapenmictls) 2tau  ou1tpto fcils a ua(ms;t)tetnxrcoytopteluvs ( sexmim nydlp elnvi t  2ra(m ot0tlx iictasfs2eln ont)texrmr oadfp  anes;t0trtr(r no1ole  ivs s  rra(mpnu4aeeoii3iyd a umuvpnt4arxrir oadlaD  nvo;t) etmirpiudlmte fvtat)aDua(  ;u0aeenmf3iysfm rm(mpnu0aetrif3to1lat an o s)srxo(m oodllenlnctl( a2tr(rpoo0tlxomoeiytfa2umumo t0aetrxrctatoaD luvo t  rumxr nydlpt  nesatfaDraur ou4oee  fetldfsDuau s t0tltnxociadomteli ols)setrxopnudamtelivt ()arrm(mp;t1apx ii3ilsfa2rl( p;(0arxnmo3tatlm r uvslt)t2urxr oudome mnesls  2rr(m ;t0ope iieiys aDea(vont) lenxo oydlmt lieo;t0teuoxrpio4alen nesas aDra(  ;u1tptn f3iyd a2umuvsnt0 rtnir3iatlm eaueo ()seumxo3oo1amenmnvtas  rtmx ont1tleoiicias mDea(ms;u0 rxoio iydlmtr nvi s0 etrir iydome mieia(fsDurx oot0oexnifciyd a el(vo u)alxoio3oodfp ean s s) 2xo(o3io1olenmnci s) ruaxm ;u1olxnmfetls aDrl( snt) eerxf3oatfmD  i o (  exrirpiodllt mncsltfs2rmx ont0aet mi3iatlaDelnvs t)tetnmr todlmteaivsls)setm(m io1om e nvs sfsrrmump;u1tptnmi3ilslsDuaumont4alxrxr3oytfmD luvslt trxr(r3iodlme  ictltfsrrm( p;t4oltnmo3iytfsDrmnvo;t0alenio3iy1opt auvs s0s2trir3nu1am n icil() 2urxrpou4apt mfcilt a eanmpn() lenxo3ta1lpte n sls)t2xoxmpny1opeeliesl(  Drrum ;o4ope  feiydlsDrl( o;(4trtoxo iytlmtrlivo;(0 etmim oydlptemivsas)a2ur(  nu0oeeoifcias sDua( s;t4trtoxr3tatfm   i o s setoim io4amee nvi t  Durum oo0olxo f3tyt m2ua(vs (0alenifcoo1fa elnvils0sexoxrpio1alen ictls  Dum( pou0tle ii3iytlm2uaumo;t)arxomfcto1lpDelueilt srumxm io4ll e ies tfsDtaumpnt0opeo ocias s el(mon(4aetnif ta1oateli o (0 2trio iy4optemnctlt)arrm(m ;t4tltniietls mDul(ms t0artoio3oy1lpte uei (  rxmim oudllen ivia() 2taxmo;o4apt  f3iadlaDem(von(4arxrxr oytfp  au s t trumim3nydlpte fvtas artrum nu1openmfeiyt a ea( snt4artrio to1faDrluvo;t)trumxm3io4amenlfvs tfs2umur oo1open o3iysfm um(vpnt4altnmo tydlpDe ivs ()teuo(opiodaleelnvsa(  ruaumpno1tlx iieildls2rluvs;(0 lxoxf iodlp   i o s0 2toxo ou1omeelnvta( sDrru pou0oltniieilslm2uauvpnu0teermr oa1oaDr n i;() 2to(r iudam  lfcsa()s2tmuront4oleo oeildla2rmu o (0trxoif to1opD aiei;s0sexmxm ou1lle lfvilt)aDra(  ;t1altoifeiytfmDrlnvonu4 exrirctadfpt luei t t2tr(rpoodop nlneta(f Dtrxrpnt1opx mf3iadlm uau s;u)alxrir todom  ln o;s) rtoxm no1oltn icsltfaDuaumont4optnmfetldfsDelnmon(0aexrmociy1fmDrli i;(  2umxrpiu4al e fvs t aDtr(mpnt1tpeo fctytfsDea(mp ()tetomo3oy1op   n olt) exo(m iy4al  mncsat) rtrum oo1oexomfcilsfm uluvpn()tlxoir3iy1lpt livo t0s2toio oodapt  ivt ()s2ua(  no0tptomf3ildla2rmums;t0trxrmocoydlmte ues (  etrxopoudal nlfctls sDtauront0tetnmociysfa2uanmsnu4 lenmocty1oa   ivsls s2to(o oudomtnmnet t)srua(m ;t0ape miciydfmDrl( snu4altnxo3tatfaDr ues t  2to(r nu1apt  fcs tfarrru onu1teto fctysfa2ean p;u4trtrioctodfm rlivsls srurirpiodlpenlfetl(  2taur ou1openmi3tadfs2ra(ms (4 ltrio3ty1fpDrlnvi;t) eumxmpnu1alte neilt srtr( oou1tpe iictyd aDrluvp (0alxnmfcty1fpD lneols seuoxrpoydam nmictatfsDuaumont0tetoiieiydls2emn on()tleomocio1lmt  n o;t) rxoxr3oodap emnetlt)aDurx  nt4oee  ietyd s2eanvp;u0 renxo todlptrlivi;()setriopio4amtnmncsl( aDrru  nu0tptoiieiyt s2rlnvpn(4 lerir3oo1late neslt) 2xrio3iu1ol nmivs sfa2ururoou0apxnmieiyt sDemu ont) rermocia1omt lu i;(0srxrxr3ou4aptemneia()sDrm(m no0oexn f3iyt a2ul(mo (0tltrxo3iadfmtraivs t) rtr(o3oo1ome  fvsas sDuaxmpnt1alx mi3ilslsDul(msnu0alxnxrcio1fpDr ues s0s2xrxrpiodalenlivsls)a2tau  no4tpe iicias sDrl( p t0 etoio oo1laDeln ol( srxmiopoy4aptnmnct s) 2rmxm no4tleniociytfa em( o (0aexnxf3oadop  anvolt)setm(r iydom   fvi t)sDrau  nt0tle moeiysls2rmump;t)artnxr ia1lp raivi;s seto(r3oodolt lnesas)sDtau o;t0apx micils a2ul(msnt4 renxfctadlmtr ieol(0texrim iy4lptemnvt tf rururoou1oexnmoeildlaDuauvo;()aeenifciy1fpt an ol(0srtrir3ou1lltnmiet sfaDrrumpnu4tpe io3tad aDrlu p t0tltomo3iodomteaueils0 2uoimpiu1am elietl(fs2raumonu0tlt mieildfa2rmu s;t4 rtrir todlpD  ueo t)trxrxr nodlmtnlivsa(f 2uau o;u0tetn fciadla2eau s;(0 exnio oy1opte ueslt srtr(m3ou4ll n ncilt)a2trxro;t0apeomo3tatlm2rmums ()artomo3iatfaDrlueo s) 2tmxmpou1altelnvi s sDtr( pnt0oetoiictasfmDuau o () rerxf3oadla rln i;(0 rxmimpou4ope  icsls s2rrx p;o0tltnmfetlsfmDrl( o u4 exnio oo1oa elieilt0t2urxr ou1alen fvslt)aDum(m ou4tlx mfeils s emnvpnu)alerxr ta1lmD an sls) 2umxrpnudam  mfesat sDrrx  ;u4aetn o3ilsla2emnvp;u4artnio3iotfmDelieolt)seumxrpiy1optn ncsa( arra(r nt0altnmieiatfmDrmnmo u0texrxr ta1oa ean o;s  etoxopou1lp   ict sfsDrmumpnu0alenif3ild s um(mpn(4 leoif3oa1opDrai s;(0 2xmxmpiy4ome mnci ()srur(  ;o4aeenmoeiys aDrm(vo;(0teeoircoydlmteau s s) 2trxm no4oltemfctas s2ta(roou0alxn i3tltlmDua(ms (0trenio3ty1oa r ieo (0srtmio3nudap   nei s aDurum oo4aex  fetldlaDulnvo (4trtrmr3iatla raueils0 2xrim ou4apeemnct s) Dum(mp;t4openmieilt m uaump (4 exnmfcoa1lp elieol()setmxm3no1am emivia(fsDtmumpoo1ope iociadfa2elums;()altnmoctodlaDean i s sexr(opou4ap nmnvsa()aDurumo;t1texo oetltls rlnvo u0tlxnif3iydlat lies t  2xm(m3oo4aptelicsa()srtr(mont0apto f3iys m rlnms;(4alxrmf totoaD lieo;t0tetrimpou4alte ivi t)srrm(mo;u4olt mfeiysls emumo;t)arenifcoo1lpt aivslt)srxmir3no4ope mici tf 2uaumpot1tltnioetlslm2ean o;t)tlxrxo ia1oa rlneils  etmimpoo1llt  fvsl( s2rrx ono0texomictlsla2um(mo u4 etrif oa1fat  u olt tetmirpoodapt micsa()s2taxrooo1opeoio3ias s2eluvp;(4tltomr iatlpt aues;t) exrxr3oy4lm nmivslt arurxmp;t0tleniocias m ulu p t0aexrxo3io1fa  ai s;()trxoiopoy1aleeliesat  rrmu  ou0oeenmo3ilslm2ranmon(4altnio3todfmt lueils0trxmir oo4lp emici t)a2ua(mpot1aex mi3ilsla2rl( onu4 renxf oadlateli s ()trtr(r3nodope mnvs t) 2rm( oot0tlx iiciadls uln p (0alxnir io1fptean i;(0t2tm(o ou1alee fei ( sDumur ;u1tpto oetad a ulnmo;(0alxnxociy1fmtranvs;(0 2xrxmpiodlle lfctas a2ur( o;t0aee  icias m2em( o;(4arenioctadfpDrln sls0trxm(m oo4lltemivtas) Dua( pot4oleo f3iytfaDuln sn(4arenir oodlptrau s (0srtm(o iydllt mncslsfsrtr(rpoo4alt iietad aDran p;() rxrxr3ta1fm rluei;t s2xm(r3oy4ole  fetlsf Dumxmo;t4ope ifetadls rlnmsn(0tlenmo iy1oaDelnvo ( trxmxmpiodlp  mivsatf rtax ono0olx  oeiydfm rlu pnt) renif oy1oat auvslt trumxm3oy1ol n ietlsfa2tr(rpou1tltn ocils m2rm(msn()alxoir3iotlmt ai ol()t2xr(r oudlmenlneilsfsDrax  ou1olxniiciasfsDeln o ()arxoxo iodlp rlu o;() rxmxr oo4om nmfcia(f Dua(rp;u1olt ifeiltla rl(mp;(0 etnmoctodopD anvs;t)t2xoio3nu4lmt livt t s2trx  oo4tleomiciyt m uanmo;t4tlxrxo3todopteaueolt0t2uo(rpiodlpenmicsl(fs2uaump;u0ope  oeiadlsDum( p;t0 exoxo3oa1omtr u ols0t2urxo3ou1omte fet s)arrmxroot1oetnmo3ild sDum(mp (4 lenif todomt  n sls)teumxm3no4lmt mfcsa(fs2urxroot4alx  octyt m em(vsn()aeenmocoa1lp e n i;()trxo(m iy1amee fvias) Drrxm ou4tee  oetltfa rln pn(0 eerircty1fate ivols  rtoxr3iu4apen fvilt  2tru oou4altniiciyslm2eln p (4artnxo iy1oateln o;(0teto(m iy1al e fcslsfa2ra(ro;o0tpt mo3iadlm um(mp t0aexoio oatopteau o t0 2ur(opoo4lmte icsat  rum(ront0ale mictytfs2um(vsnt4 reniocoytfa eaieils  rxmxopio4lleelictatfaDtmx p;o0aleomf3ilslaDem(mo u0 eeomo3iodomD aueolt)trurimpno4omenmfvsl()sDtrum ot0ope iietasfmDranmp;(4aleoioctotlmt au i s0sexmir iodlmt lics () rtax  ou4alxnmi3tysla2umu s ()treoif todlmteln il()seur(mpnydomt miet t sDrauroot0tetn oeiadfa ra(vont4tltrmf3ia1opDe ieo;t0 2xo(mpno1ap emnet s) 2umxm ;u1tpxoiietyt s ua(vsn(0tlxnif oytla  au i;t s2tmxm3iudlpt lnvsl()srrmurp;u4oetoiiciys a2elnvonu) eeomr3oa1fate nvol()s2xmxmpoodllenmnci (f rtmx ooo0alx  ociytla rauvs;(4teerio oodomD li ilt0trto(opny4omee icsa()a2rrx o;o0optomoeiat mDrauvs;u0aeeoiocia1fa rauei t0t2trxr3iydll nlfei s)s2rmum nt1olt iictadfmDuluvo t0trtoxocoy1laD  n ils texrxo3oudomtelfvtltf Drrx  ;u1tpenmociytfmDumump ()trtriocoatlmD  ueo s0 etoirpnudal nmfciat  2ra(rpnu0oltnio3tyslm rlu o;u0alxnir3to1lmtrau slt0s2umxo iy1ap n netasfaruauro;o4aee mictatfa2uauvs;u4 rtnif tydfpt ln i;s  2urim iu1lpenlieia(faDrm(monu0opx  ieiasls2rl( onu4aetnio3iotlmDraueo;s0setoxopnodlltnlncta()sDrmx oou0olt ii3tasls ul(mpnu0teenir iadlaD  ies t)sexmir3no4ap nmivilt sDrmxmonu0alxnifciysfm2emnmo u4tltnir3ta1oatr u o (0sexrxmpnu4ap emnvtls  rtm( p;t1tpxnmictytfm eau sn()texrirciy1fat  u slt  etr(o3io1ll emivi tf rrm(mp;o0alto f3iyd sDeaump;t4altnio3ta1lm r ues t)sexrir3oo1apee icsl( aDuaxrpnt4opt ioetls aDum(vo u0alenmo totlaD  n il()s2tm(opoudll nmfvil(f rta(r nu4tpxnii3iyd mDemnms t4 rxnxr iodomte ieol()trxmxo iodlmtelfeiat)s2raxmpno0aexoifciltfa eaumo t4 lxrio oadfmt  ivol()teuoxm oydamt mivsa()arrr( poo4tex  fciadlsDean p (0aexrio oydfm ranvo;s0 rtr(mpiudlmenlnvs t arururp;o0oltoiietas s2ulnvonu)altrxrciy1fp elieol(  rtm(m3oo4al nmnciltf Dtm(ronu1openmfcild s2um(vs;u4 renmfctytlaDeluvols trurxm3oy4lp  licil(f 2tru o;t4opeoio3iytfaDrmu ont0trxnxr iotla   n i;s) 2toxopiy1alee ieilt)s2tm(rono4olt  ietld sDuaums t4tlxoxrctatfm e uvi;( s2xmir nudoptnmictls  Drm( p;t1oex mieiat s ua(vpn(4tltnxrciydfp eai i;s0 rumxr3ou4apenmfci t) rraxr oo4oeen iciysfmDrm(mo;(4alxrxoctadfptr n i (0setr(mpoodamt  fvilt)srtmx  nt1olenmoetad s2umn o;u0alxrmr todfa eaivo t)s2xrxo3nydlmtnlivtlsfaDumx p;u4apeomo3tatfsDelumon(0areomrcoadfat  ivo t tetrxo3iy1amtnmnviat  Dtm( poo1aetomo3iad s2rmnvsnt4teerxr tytlaDrlnvol(  2xr(m nydolt  fet s aDum( poo4ole  f3iasls2eanvp;() eenmo io1lm rauvil(0trtmxopiu4al  lfetl(fa2tmu  ;o1tpenifetltla raump;()trtnio oatlp e nei;s)srtrxm nodomtemfvt sf Dtru o;t0aee mietlsfs uanms u4texnir todfmt lu ils)t2tr(o io1llee nvsat srtaum no1altnio3tltfa2eaumpnt0tetomo oodomtrlieslt tetrxrpoy1opt  fetls)sDraxrpnu1aee mfctlsfaDem(vp u4 rtnif oodlatrluvs;s srxo(opiudom emfesl( s2ua(r ;t1olen f3ild m ra(mp u4alxoif3iadomtr nvils)tetmim3oodole mieia( a2rr(mooo1oltoiieiys a2uluvs;t4trtomoctatoptrlu o;s  rurim3io4opt lfcs sfarua(rpno4oex ifctadlm2rau s;t0aeenir3todoat li il(0trtmim io4al elivt (fs2um(rpnu4tpt mo3tysfs2umnvp ()trtrir3oydfa elieilt)srtmim3iydolen fvsa( arum(mpot1apxo i3tatfmDel(mp;(4treoxo3tytlpDr uvils) rur(o3io1om emfcslsfarurxrpou1aee mo3tldfa um( s (0arxnif oy1laDeauesl() rxo(mpiudlme lncia( s2um(  ;o1tetoifeildla2rlu pn(4altoirciodfpD anvi (0seuo(r nu4aptn icilsfaDum( onu1apeo icilsla2umnvo ()aexrmo3oydomD anvi s0srurxm oodlpe  ncs s) 2rrxrpnt4opxnmo3ild s2el(mpnu0 etoxr iotfmt  n i;s0trumirpiudal nlivt () 2rrx  ou4teeomfetltlm ua( p;(4 leoxocia1fatrau s;t)trtmxr3nu4omtemfes s  2tr( pnt4aex iociytlm2rlnvs;u4 renxf todfa   nvolt s2trxopoydlptnlicia( artrx  ;o1tetnmfcild a eln s;()aeeoifciydopDelivs ( s2xoim io1ome mfeiat s2ta(m no0texnif3iyt m2eanmsnu0texoxo tydoptr n ol(  rxm(opiodllte ies sfsrtmxmpou1opxo fcilt s rmn pnt4 rxoif tadlpt  nvolt0 rtoxr3io4amtn ivslsfartau  nt1oeto ieildlsDelu p t4texoir iadlpte uvo;(0 euo(o3nodopenmfcslt arrr(  ;t4oeeoifetas s raumpnu)tleoir3oy1opte n s s) rxrxr iu4am   fvtl(f 2tax  ;o0tetomoeild s2rm( o t4tetnmf tadfaD luvs;t0 ruo(m nu1lp nlfct tfsDur(moou4apxoiieiysfs2emu snt0 lerio tydop rau s s0t2uoim3oudom elnetlt artauront1tpe mfcils m eanmp (0 reoxr iatlptrln i s0srtrxr3oy4apenlfcsa( a2tauronu1olxomoetadla2elnvsnt) etomo3iotlaDeau ols) etr(m oodopen iesl()s2rau p;u4aetomfeiatlmDumu s u0trtomf oo1fmD  u s;t)srumir nu4lle mietltfsrrr(rp;u0olxo o3iys aDua(vsnu4aeenmf3oytlaD  neol(0trtr(o3oodolt  fcs t) Dtr(mo;o1ale mo3ilsfsDulu s t) ltnxf3tadfp r ivo;s trxr(mpou1lm   ietlsfaDuau  ot0optn ieilsfa2eln o;u4texrmo io1laD  u o (0 2toim3iy4om emfeilt)a2urx o;o1tlx io3ils sDrl( pnu0tlerif tatlmtrln o t  rxoxopno1alt  feil() Dta(mo;t0alxomo3tltlm uanmo;(0tlxoxfctotfptraueo s)tetmxopiy4lme lfvsas) 2um(rp;u0tetn fciasfs eanvs u0 rtrxo3oadoatraneo t seur(o3no4ll n fvtl(fsDum( p;o0texn feiatfm2rm( snu0 rtomf tytfa e uvils s2xoxrpoy1oltn ivsl() rrmur oo4apxnmfeiydla2eln p u0trtoio iotomD auvo;(0 eumxopio1lpe lfcta() Drr(ronu1apeo fctldfmDean o;u0tlerxf iydopDr ueslt  ruriopnu4amenlfet t srurx o;t4ale  oeiadfmDrmuvp;(0texnmo tydop rai s;(0srurirpoy1lmtnmivilsfsDumuroot0teeo fetlt sDrm( on()tleoif3oo1oaDelu i;()tetmir iu4op emfvi t sDtaurpoo1apt  oeiysfsDrauvonu)altnxocty1lpD  neols sruoirpno4ome lncs (f ruaxm ;u0opxomociatfaDelu snu4altoio ty1lmtr nvolt) rxrxr3oydamtnmfctat) 2taxmont0oleo o3iytla umn o t0texrmocoa1oatrau ol(  2toim oydopen feta(farta( o;u0tltoioeiydls2ua(ms;(0aetomrcoodlmDe n i;s)tetmxrpiodaptelieias s2ua( p;t4opxn o3iasla ul(mpnt4tetomfctytlpte u ils tetoxmpoydol n nei tf Drruro;o0aexoiicilt a rm(vp u0tlxrxf to1om e neo;s)teum(r3oodop emnciat aDurxr no4opx  oetldfmDemump;() rerxfciatomtrln i ()seumim3nu1lmenlfeia( srum(mp;u4oetn i3tadfa emuvon(4trtomf ootfm ean il( truo(mpiy4alen ivt (  2ur(rp;t4teenifeiltla rmumo u)arermfcoy1fmtrlieolt) rxr(mpiodlm   fci tf 2ur(mpno0teeoio3ilt m eauvp u0 exrmrciotlp e u o;(  exr(r3oo4om   fvtlt) Dur( pot4ope mfctls aDrlnvp;()tlxoif3ta1fptelivilt0truo(o3oydlmeemfct s  2tmxmpno1optnmfciatlsDeau pnt0artnif3iadlpDelueo;( t2uoim3ou4ll nmncilsfsrur( o;u4tee mi3iasfsDrl(mo;u)tlenxo tadlmD  nvs s0setmxr nudomt mfcs sfaDrmxrpnt1apxn ocils s ea(vp ()tleoirctydfa eanvsls) 2ur(m3iydoptn fvs s  ruaurono1apeniietad m2elnvp;u0 exomrcoa1lmDelnei;t0srxrxr3iydap emfcslt) rtrx  no4alenif3iadfsDean p;(4aexoir3iydfm eaivs;(  rxmio oydamtelfcias  rrax o;u1teenii3iydlsDrl(ms;(4trtnxfciadoa elnesls)t2triopnu4ll e netatf 2tmuront0tex iociadfaDel( o t4trxrmr iatlatraivs t0 rtoio3nu1oleemfvta( s2rmxrpoo0altnmocildfa2umuvp;t4trxnif3oodoat anvo;() rxm(mpoudllenmicil( aDumur ou0tptn fciltla2rln o;u)trxrmo3ootlmDrauvo s)s2uoxopoy1llee fvt s) Duau  ot1open oeiadlm em(vpnu) rxoxr3totfm   uei;s trxoim3iodape mfvs sf Drrx pnt4altnmi3iys m2uln s;u0 lenxociodla eanvi (0 rxr(m3nodalteliciat sDrax ont4tlen i3tatla2ranms u0alxrmr ty1fa eln ol(0s2urirpiy4ale  nvsat)artrurpno1aptn ietad s rl(mp;(4tleriocoatlp rai s s)s2xrim3ou1lleemieilsf rrrumpoo1teeoio3iyd a eauvo ()alxnmrciatla r n s s)t2um(opoudolenlnvs ()artmur ;o0texnmi3tltfa2eanmo;t)arxoio3iadlaD  neolt0s2xrxr nydoltn nes ()aDraxmo;u4tpxoiieild m2emn o u4 exrxo ootfpDeaivs;()s2xrirpnu1altelivi (  rtmxmpot4tlx ifcilslsDra(mo;t4tltrirciotlate n o;(0 eurxm3oudlmenmnviasf rrru  ;u4teen iciyslm uluvs (0 eerxrctydfateauvo;()t2trxmpno1openmfvi s)sruauront4oet io3ils m eaums;(0 exrio ia1fatraues s)seurir3oy1lmtn feslt a2uaur no0oex mociasfs ua(mp u)aeeoio3iodlaD  u s;s0 2toxo3ny1al  mnvsat  2rr( pot0alx  fetytfm2elnms u)trxnmrciodomDraues;t) rxoxopou4alee fvtlt)aDrr(m oo4aetnmi3iyslm uluvpnt4teerxr3oadfpDeluei;s0s2xoiopio4lp n fciat)aDtm(  ou4oeen fcildla emums;u4alerif oodfmDe ivs;s t2toimpio4aptemneiat aDrm(m nt0texn oeiys m em( snt4tlenxr oytlatr nvo;(0s2umio3iodlpenlnvta(farumxrp;u1optniictaslmDrl(vp;u)arxnxo3io1oateaies ( setmxm nodoptelnvt s)s2umx pot4aptoif3iysfaDumnms u)alxrif3ootlpDelnesl(  rumiopnudlm   nciasf ruax pnu1apx ifetldla ra(vs;u)tetoxo3oydla eaueo s0 exrxm oodlmeelfvslt a2umum ;o0tpto ocilsls ul( pn(0arxoxr tydlmtrluesls)teuoxr oo1ap emncils)srurxmoot4tpe iictltlaDemnmon(4 rermr ta1fmD  neo;s0teuo(m3ny1amtelivil(f Dtrxrpnt0apt miciltlsDul(mp t4trxrmo iytlmteaivslt0t2um(o nu1altemnes tfaDtr( ono0apt ifetyd sDumu s;(4 lenxr3tytfpD aivols  rtoim iu4lm nmictl(  rrrur ot0texnmfciytls2uaumpnt) rtnif totfm  li ol(0srum(m3iodlptnmncsls  2uaxr oo0tpxniiciatfm uan s u0 rtnio3tytomDraneo;(0t2xo(r3nu4lmee ivsat)sDraxr ;u4ope ii3tltfs rluvpnt4 etoifciotlp  ln s;( srxo(m oy1op n nvia() 2rmum nu4altn ictyt sDulnvs;t4alxnmrciatoat lnvi ()truoxo3oudoltnlfvi () Duau oou4tle iieiatls eauvp u0 leomf3tatfa e n s;()texoxr oo4lpee icslt)aDtm(ronu0olx  oeiydfm emumonu4artrxfciytfa r ivils0s2tm(r io4alenlncilt s2um( pnu4oexomoeiydlmDemnms;(0texoir iadop r nvi s) eurxm3oydapee fciat  rta(rp;t1alto fetlsls el( sn(0alxrio3ta1fpt aneo;(  rtmxr oo1op   fcsas s2ur(moou1oee mi3iydla2rmn o u4tltnir iadop  au s s0sexrio3no4amtnlfci t)s2tmx onu4tlx  f3tytlmDraump;(0 lxrxocoa1om  ai o;t t2trim nu1lp  mfet (  2rru ont4opxn i3iat m2rmu on(0 lxrir to1fm e uvo;( s2xo(m3iodlmtnlics ( aDtm(m nu0alt  iciatfa um( o;t0 lermo io1laD ln s;(0 euo(r no4ame  fetlsfs2ur(m ou1ole mf3tyt s elnvp;(0 ltnir iotlmDe nvo s)truoio iydop  lnvt tfa2urxrp;o1ole ifeiyslsDua(mo;u4trtnmrciytopDrluvol(  rum(r oy1lme  fvils) Drrxrp;o0tpxo ocildlmDra( o;u) exnir iydoa  auvi s)srtoxo3ny4apee ietl(fsrrrxrooo1optoifeiat a2emu pnu) ltrmr ootfp e ieo (0 rtrim3no4lpenlfetl(  Drr(ront1oeen f3tydfsDuluvs u4tleomr tatlaDe u s;s)s2toio3oodomen fvi sfaruauronu0oet moetysfs rm( o;t4 rtnxrciotfpDrluvo s0 2xmir3iodopte fes sf Dtm(mpou4tpxnio3tysfs2rl( pnu0treoio ia1la eauvi t s2trimpoudom nmfcsl()a2taxm oo1ope  o3tlt sDumu ont) eenmfcoa1faD  u i;(0 eumio no4alenmfcilt)aDtm(rp;t4tptoioetas m uan pnt) eenxr3iytoa eln o;t  eumxmpny1opt  fcslt arra(monu1alto f3ils mDrln p;()aexnxf tadfm  lneils0t2xoxr oy4aleemnctl(faDrrur ou0oltnmiciydfm um(vont)trxnmr3iytopD  ies t  rxmir3ny1lmtemneslt  rur(rp;u1altn ieilsfm2umnmo ()alermr3oy1fp  auvs;t s2uoio3nudam emivsasfsDrmumoou0alt mieilsfs2el(vont4alxoxf3iatfptrlieils s2trimpoo1lm   netl()s2tax  nt4ope mociasfmDumumo u)altrio3tadomtrlneo (0trumirpoo1optnlneia(f Drr(rono0apt mi3iytlm2eauvs (4trxnmfciatfpDelivsl(  exr(o3no4olenmnvil()s2raxr nu1tetnioctldfm rln s;(4aeeoxo3ia1laDr u s ( truoxm3iudopte fetl(f Drrurpnt1tetnii3iys m rmnmon(0 rtoxr todfa eaueils) eumiopiydaleemieta(farrrumono4opxoif3tyd a2ranms;t4 lenif oytlaDe uei;(  2xoir iy1lltnmfcs s)a2ta(  ;o4alx mf3iasfm uan o;u4arenxr oa1fm rlneils  2xoim oodaleelicsa() ruaxm ou0tleomi3ildfs2uauvont4 rtoxf3ootopDeanvs s0 exriopou4lpte iviasfs2ur(mpnu4tex mfciatlmDrau o;t) etnxo oadfpDeli sls0t2to(m3ou4ole  fet t)a2tmxmoot4aexn o3iyd s2emumpnt4 exoxo oadlp  lnvi;()t2xrxo3nudlpeelfeiatf rrrxmonu0oltn i3iytfm2ul( o;(0trxrxo ty1faDr neo;(0srtoio3ny4ol e ietasfaDtru  ;o4oleo oeiadla2ea(mo;(4tltoxfciydfmt an ils srxrxopoy1op  mfcsltf 2ta(r nu1tleoifcias s2ra(mo;t4tlenxocootfaDr neil(  rtr(rpny4ap nlictlsfsrrrxr ;o4apt  oeiasfa ran onu) exoif3tatlmtran i;s)trxoxr3oo1lpeelicsl( artmx pou1oetomoctlsfa umnvs;t) rtrxrcio1lmDrlu i s)s2xo(m3iodalee ics s) rra(rpot4apenmf3tyd s2eau s u4aexrir iodfpte nei;t trumim3oy4omt  nvta( s2rmxmonu0opxo ietydfsDem( p;(0altomf3iadomtrau s s teuoim ou4op n fei ()srtax pno0tetomf3tltls uanvpn(4texnmociodom  lneol()s2um(m3oydome lieiat) rrm(m ;t0oexomfetlt m2uan o;t0alermr3iadlmt an ils teuoxopou1alee nctltfs2rrumoot4optn ietadfs rlu s;t0tlerifcia1opD  nvo;t) euo(m ny4oleelicsa()sDumumoou1ope iieiysfaDemn p;u4alxrmo3iadoat luvi (0 exm(mpoo4open nvi s)sDrm( o;o4altn f3ilslmDrmnmpnu0alenxrctytlmt lueol(0 2tmir iodolen feils s2ur( pno1alxnif3iatlm2ul( o u)texniocto1lpDranei;t t2toxrpnodlmenlnesas a2trxrpnu1tptn iciysfmDulumo;(4tetrxf3ta1opt livi;(0truoim3oy1ap   ieia(fs2uru  ot4olxn o3iyt s umums t0aeerxfciotfa rli sls)texrxmpoy1ale lfvtl()artmxm ;t1apx  o3iytls2elu s t4 lxoio3tytomt lu o;t)srum(opiy4amtelnci t s2rmumo;u0olx miciatfm2ran o;t) lxrmo3iy1fp r u i;(0 exriopio1lpenmncsasfarum(m nu0tlxo oeildlsDum( o;()trtomf tytlaD aivils s2trir iydlptnlnvtasf Drmu pou4oleomoctadfa2elu o u0texnir tytlmDraies;( s2xmim3oydame  fcsat  2trxro;o0tlt  ieild a2emuvs ()trtriocio1latr ivols0teuoio no4omen fcils s2rmu ooo1tpeoif3iydfs uaums u0areoxrcoydfm rlivi;s0trur(mpio1ol   feslt)s2umuro;t1tee ii3iysla2uluvo;(4aeeoir ta1oa elueil()s2xrir nudlme mnctl()a2umxronu4tlenii3tltla2ul(ms;u4 eeoio3oatoat  i s s  r
\ No newline at end of file
@@ -0,0 +1 @@
+iei t) exrxm nu4ll e fci sfarurxmo;u0teen ociad a2eanmp t)arerif3oo1lmDelnei;()trxmio oo4aleemivias)aDtrx o;o4olxnif3iysla rlums (4tetnmrcoy1lpDeli i;t setr(mpnydoptelies t)sruaxmp;t4optnmi3iydla ranvs;t4aexrif oa1fa   ueo;s) ruo(r3nu4amt lies t sDrrx  oo4tee mieiyd a rmuvs;t4arerif iy1lpteauvi;() exrirpnydamt mfet s)a2uax o;u4aeeniieiltlsDumnvon(0 exomocoadfpD aues;s0t2xoxopou4alt mnvtat)s2urxr no4olxomfeilt aDuauvp;u4treoio totfpDe n slt t2urxr io1ome  fvt sfa2rau  ;o0tpxnif3tys m2ran pnt4aexrir3iydomtelies (0texmim3iu4amenmncsasf Dta(r no1aeeoif3iytfm raump;t)trtoif ty1fptr ivo;t trxoxo3oy1om emnetas  rtm(mp;t0open fetatls eln p u4alxriocto1oatr u s t0s2xm(r3nodllenlnvt s)sDrru o;t0tpeomo3tytfs2ra(vo t0texnxrctytlaDrlieo s0 eurim3oy4ll nlnctas)sDrr(r ou4tlt mo3tyt a rmn p t)altnmo oodfaD  n o (0trtr(rpiu4apee fvs (fsrururpnt1alx mietat s2ran snu4 rtrio oy1lpDeai olt seuriopiy4alt lnet tfsrtruro;u1tpt mi3iatla2rau o;(4tlerxf3ootfpDr uei t)t2xrxr3nodlmee iciltfs2uru oot1aetomi3iytfa el(mon()aleomrciadlaD  i il(  2ur(m oodape mnesat  2rmxro;o0olen ictyt s2ea(vo t0altrmf3to1fa eluvolt seuoxrpio4ol nmneslsfsrtr(ro;o0apxn fciysls rm(mpnu4texrxfciatlpteaivo;s0teuoxm3iodllen ictls) 2rr(mp;t0tleoif3iysla rm(vsnu4artnmf tytopDe iei ( sexo(m3ou4amtn fvtat sDtrx onu4aet mi3iatfm2um(vo;u)artnmrcoo1omt  ieo;s)srtrxm3nu4optn neiat sruaumpnu4aetn i3iatla2eanmp;t) lxoircta1omDelu sls) rtm(o io1oltelnesasfaDtr( pnt0aeenifetld m2rlumo;u0artrxr iydoptrauvo;s  2toio3no1lleelictas)aDrmumooo4tleoifcildfs rmu o;t) rxnxrcootfmD aivs;s0s2xo(m nydaleemieiatfsDrax  ;t1alto fctadls2elnmsnu0 rtoircia1fa r uvs t)srtmir3ou1apt mivsl(fsDur( pot4oexoifetysla ea(vp;t0texnxfcty1fp ean i (0 2trio nodal   nci s)sDur(  ;o4aex mociltfs eau onu) ltrir3oo1fmte ueslt) exmxm3nudol   ivsat arrru p;u0teto ictlslmDua(ms (4alxnxfcty1op raivolt srto(rpoy1om nlfcil() Dtm(  ;o1olx mfeildfa rm(mp;t0tlxnif3oo1fp rli o;t trumxo3nodaptnlieiltfarua(rooo0tle  fetydls ul(vo;u) lxrir3oo1fpDelu i t)s2umxmpou1am elivsls)srua( p;o0aptn fctlt m eau snu4alenio3todfp  au i;t) etoxo3iydopt lncsltfsrrax p;t1teto ieildfm2ean p (0 exnifciodom   i olt0 etrxr3nu1om   icils)aDtau  no0oltnifcildfmDulnmon()alerxo3tatlm eanei;t0t2uo(mpnydlm nmnvils sDrrxro;u4aexomictydfmDran snt)trxoif3tytfpteaieo;s)srumxm3ny1lme  fcs t) ruaumooo0tlx ioctad mDelnms u4treomf3iy1lmt li sls)sexo(opou1op  mictas s2tmx  ot4tleomfeiad mDraumo u4aexnif3oydfaDrauei s0 2xmim3nu1ap   icslt arrrum ot1opxn i3iydlmDulu snt0aetnmfctodfpDr neo s0texmir3nydome lnes s) rraxm ;u4tetomietydls2el( pnt4tlenmr3ty1opD au o t0teurimpoydape  netlsf 2ua(rp;o0alx mietytfsDea(mp;u4alerxo iatlmt an i;s) exoxmpiu4lp emfesat)a2rau o;u1olenmo3iydfm2eanvp;()teeomo iadomDeln s;s  rtrim3io1lmt mfcs ( aDuax pno4oeeoifeiysla ul( s;u)arxrxrctotlmD li o t) 2tm(m iudam nmivt ()a2tmx pou1alxomoeiltfa em( s u0alxnif ta1fm e ieo t setrirpny4lmte ivta()srum( pnt4apxo ociatlaDrm(vs;(0tlxoir ty1om rauvil( setmxrpou4ameelicsls)aDrm(rono1opx ii3tatfa2rau o;u0tleoir3iy1lm rlnes s)t2ur(o3nydaleemfcias  rtrurp;t0texn icils aDrmnmsn(4 lxnxfciytoa e nesl()s2tm(m3io4lmte iciatf 2ururono4tpxnio3tys a ranmon(0trtrirctydopt  u sl() exm(mpny4omt  ietasf Draump;o1tex  f3iys aDem( snu4 etnifcta1lpDeau ol(0trtm(o3oo4amtnlnvtat)arur(r ot4aeenioetadfs uaumon(0teermr3tydlaD lieslt0t2xr(opiu4optnmfvil()a2ua(rp;o4oltnio3tlt mDuanmo t0tlenir iatlat auvs;t0s2urxm iu1ap elfvsat  rrmu ono0apeomo3tltlm uluvont)tltrifctydlpDr i i ( s2ur(r3iy4apt mfesas  2tmx oot1opt mi3iys aDra(vo (0trenir ty1lm ranei (0trtoimpoydaptnmnvi (farrrxr oo4aetn octadfa ranmo u4 reomf3oodlp r uvs;( t2um(o3iu4am nmicilt  2raxronu4alxomfctldla2uanmon()trxnmfcoytlmD  uvo s)t2tm(rpio1opt mici sf Drr(r nt1tpeomoeils aDuln pn(0 rtrifcootfaDr neo;s tetrimpnu1ol  mfcils)aruaxmpoo1apen feiatfmDranvpnt4teenmo3iatopDrlueol()trxo(o3iudal nmfci (fsDra(r no4apx  ieiatlmDuan snt4arerir3totoa rlnvo;( tetmir ny4ol   ivsl( aDrrurpoo0opxomi3tyslaDumn s u0 exnmr3iodfp  aneo ( srur(r ny1ope mfetlt  2um(m ot0olx mi3tyd a uanmo t)arenxo3iydom raieils  rtrimpiudaptn nei sfsrurxronu0apx  fciadfm2rmuvs;t4tlenir tatfaD livi;t setrxm3iudameelivtatfs2um(r ;t4apx  o3iatfa uln o (0 eenifcoatfaDr ueil()srurim oo1ap nlncsat)s2tr(rooo0tee ioetad mDra(mpnu4 exrxo tatlp ranvs;s setriopnudolee fvtl(f 2um(mont0tlt  fciyt m2emnvs;u) eerxf3ia1fatrlieo t0s2urxo3no4lp n fesltfs2urum ot1tlt mietytla elums t0 eermf3tydlpDe u s;() 2urimpiy1apte fesl()aDuaxm no0tpe  oeiyd aDra(vp;(0teerxfcta1fpt  n i;t seum(o3io4ameemfcsa(faDua(mo;o1tpx iocias s2rmu s;t4 exnmfciy1omtrai s t0 etrxmpiu1lpee ncta(f 2ta(root1aeeo ociatfs rm( onu0treomrcoatfpte i s;()trxoirpoy1lp e nvta(fsrumu  no0tpx miciys s rl(msnu)arxrir3totoa r ies;( setmim3ny1ale  nvta(farumum no1tetnifctltfm uanvp ()aetnxrcia1lpDraues;t)s2uo(r nudllenlfei t srum(  ;t0alx miciltfsDulnmp () eermo3io1fmt li il(0 rxoxrpny1ol nmieta(f Dtau oot4alxnmf3iys s2rmnmp u4aetrxf3tadopt anvi s)srxmxm no1lpeemivslt srurxr nt1oexoiictatfs uauvp t)aeerxf3iodlmD  iei;t s2toxo oodlltemfet t  rum(rono4ape mfciys s ea( o t)artomr oa1fptelues s0 ruoxo oo1lmtelnvt tfaDum(  ou4oexoii3iysfa rmn snu4altrmo iodlpte u il(0 rxoxm3ny4amtnlieia(f rtr(m nt0tlxnioeiadla2eau onu4tetrif tatla e ivsls0 exm(opny1om e nvil()a2ta(m ;t0oltn fetltfs2el(vsn(4 lenxf3iydomDrlnvslt)t2xrxopnu4llenmnei tf rra( o;u1apenmo3tytlm2emuvpn()tltrxrcia1fpteaies;(0trur(rpoodlmtemfcs (fs2ta(mpnt1tlxo oeilsfm2rlu o u)tltnir iytlpDeaueo s0t2um(mpoy4om nmnetasf 2tmu ont0ape mfeiys mDem( s u0teenxo3ootfaDe ivs s)seum(mpoo4olte fvi (  rtaurono4opxo ocils sDemnvp t0altomr tydlatelivsl(  rtrim3nu4lle lics tfaDraurp;t0aleo ieiasfsDuauvsn() eerxociytfatrlu s s t2umim3oydll  liei t)aDrmx pnt4ape iieils mDumu s;u)tetoif oa1fm ranvs () 2tr(o oo4ll n ieils artmxm ;t4tex  ictyd s2ea( on(0 rxoiociytlmteluvol( trtoxm3oudllenmnvi () Dtaxm nu4tlt  feiltfs2umnms t4 rxrioctodlaDe ivils)texoim3no1lme lfvi tfarra( pou0oleo ieias a emums (4tltnmr oytomDeauei (  rxoxr3oy1lmtemieias)artr( o;u0tlenmfciyd s elnvo t0tlermrctytfmt anvi ()sexr(o oy1alt mnvtas) 2trxr no1opxoifeiydlm2rln o;t4 rtoioctodlpD au s s) 2urxopnodomtnlnei (  2rmum ;t1aet ii3iyslmDem( snu4aetoif oytlm r nei;t)teur(m3nydll e ietls)s2tax o;o4olenifeilslm uluvp t4teeoir3oytop eln o;s)setm(r nodop e fcsa( sruau  ;t4tpto oetysls rluvo;t0 eenircootfmDran ol( srtmxmpnu4altemivtl( s2tmu pno4aexniieiltla2ranms (4tlxoxrctytlmDe iei s t2trim iy1omtn nvtat  2ra(  no1apt ifeiatfm ea(vsn(0 lxrircootfp r ueo;s) eur(m3iy1al e nvils  Dtrur nu4oleomf3iatlm2emnvpnt0 ltoircoytfpt luei () rto(m oo1al nmnvs sfsDtrx p;o4olt mociyd m ua( o;(0teenxr oytfmDean s;t0t2tm(mpnudlpt lieta()a2tr(  nu0tpeomieiytlaDelnmp;t0aetrif oy1fpte ivs;s0srto(mpoo4lpt licilt arum(mo;o4tpeo fetasfaDrl(mo (0artnmo3iadopte uvs t)trxoxmpoodllt lnvilsfaruau  ;o4tlx  ictatfmDrl( snt4 lxnmfcoytlp  anvolt0 rtmiopnu4optemnciltfaDrmxronu0aeeoiieilsls elnmp;u0trtnir iytfmD aueslt0seuoxopoodomenmnetat artmxmp;u0aptnmf3iatlm ulums u0tetoxr ootom ranvi ()trurirpiydam n fcia( s2ta(rp;u0tle mieildfa2eanvp t4texnxrctodoaDe nvil(0trxmimpnu1apte iet ( s2uaumpot4tleo ictad m elu snu0arxnxfcoy1fa  livils) 2um(r3no4lp n nei sf rrru  ot0alx ii3iadfaDranvsnu4 reniocoy1fm eluvil(0t2tr(o3io1op n nctat a2rr(  ;u1tee  ietas a2umu s;(4altnirciatfaDr ies t0tetmio3iu4om e ietas  rrrumont1tpeomociyt a2emnvs u0aleomo3oa1latelnvi s)teuo(r iydlmtemnvils sDtmxro;u1oex mo3iydfs2rauvp;t4 etnmrcta1oaDeanvslt  2um(mpny1llte nvi sfartrxrp;o4oexn fetysfa2um(mp;(4altnmo3tatlaDeaieslt)srtmxm iu4lle lieslt arrax  oo1oeeomociatfaDra(vo;t0trenifcootfmtrlu s t)trxoxo nudomte icia()srua(rono1apxo iciadlm2umnmo;u4aeeomf3io1opt li s;t)s2xrim3nu4ap nlfeils sDtmx ono0oleo fetls a2em(vont)artrir oo1lmDrln i t  exoxrpny4aleemnvsa() rumum ot1apt micilt m rl(vo;(4tetnxf tadfpD aivo;t  rtr(o3nu4alenmfcsltfsDur( ooo4apxnmf3iad mDranmp u4 eeoio3iytfm rluvs;t)sexoxo3iy1apenlfei (  rtm( pno4tpt mieiaslm2ua( s;t) exrxr3ta1laD lu ol()s2tmxo oy1al  mfeslsfaDua(rpnt4openiociyd a2emums;(0areoxo3ootfpD lueolt) rtr(m3iu4lmte fct ()s2urumonu4aleomo3iasfmDrlu pn(0trxoio3ty1fptr uvolt sexo(opno4alt  iei () rrr( p;t1texomf3iadfs ul(vp u0trtoif oy1fmteln i t)srxoxr oudolen feilsfsrrrx  nt1apt mictlsfmDumnvp (0aexoif ty1lm   uvsls0teum(rpny1oltelicta() 2rrx o;o1oetoiociytfaDelumonu4trtrmo oytfmt aueil(0srxo(r nu4lle  fvi ()aDtaum no4tlto feiyt s2elnmsnu4 rtoxo3tydomDrlu il(0 rur(rpiudamen ncs t)artmx  oo4oex if3iyt m2ulnms;u) rxnifcoa1fptrlnvi ( sexo(r iydlmeelneiat)srtm(m ;u4tleoii3tyt m em(vo () exomfcootfatrau slt trumimpiu1om e fcils)arrr( pno4tptn f3tydlaDeluvo;(0aeenxrciydlmD li s;(0seum(m iy1lp  mnes t arra(m nu1apeoifctysfa2emnmon()tlenmfcoydlpDrai i s0s2tmxo3no1omtnlics tfa2rmu  ;t1aexn icildla2ea( snt0aexnmfctadlaDeauvs t)teurim3iy1llen netat)sDra(roou0aeeoioeiltla rauvs (0arerirciatlptrlu s (0texoxmpnu4omtnmncs s  2tmurp;u4aetnifetysfaDulu s ()texoio iy1lmt anvolt) 2tmxo no1lmenmncsa()arrmxro;t1apxniiciysfsDrm(vp;()aexoxfcio1lmteaivo (0seto(mpnu4llee fcil( s2raxrp;o4ale mietlslaDeauvo t0 exnmoctydoaDr ieil( trxmiopoy4alte fcils)aDrm(m ot0tpt  ictlsla2uan snu0 renio3tytlpt aneo s0 rurim iy1al  lnciltfaDtaxr oo4olt iieils sDumn s;u)arxoir iy1fpDrauvi s)tetrio3nydap emivils  2taxmp;o0opt mietat s2ulnvonu4tlermo oodoaD au o;t)trxr(rpio4ll nmietat  2taxro;o0aex ioeiydlmDul(vs;()treoxrctatfp   ivi;( setmxm oo1amt lfcsat a2umum oo0aexo i3iatla em( pnt)tltoif oa1oa  liesls trtoir nudapee ivia(farrm(mp;o1olenif3iys s elumpn(0trermf oa1op   n ol( teuo(r oy1lp emfvsas sDururoot0aeenmoetadls ra( s u) ltnifcto1lp elnvo t)t2uoim iy1al elfeiat  2tr(m oo4tee ioetlt s2umuvs u4texoif iodoaD  ivs;s)s2ur(o3iodlltn fciltf Dtr(rooo4tpxo f3ildfaDumnmpnt) lxrif3ootopD ln ols0texmxm3oodomeelfct t)sDtrx pno1oeenmi3tydlm2eaumonu4 exniocoadomte i s;t  euo(r3nudopeemivias a2rrx p;t4ale  i3iys a ra(mp () eenmo ootla  anvo (0 rxrio3no4ll nlneta()sDurxroot0oltn fetlsfm umu o ()tltoif oo1omt anvo;t0srxoio nu4ole  fvta(f ruaum ;o4aetoiiciydfsDran on()areoxocootop e nei;t0 2tmxmpny1optemnctl() 2trurp;t0tptomfciys m2ran s u4arxomr3oa1fm rliei;s) exrxo ou1ol nmfciasf rum( pnt1tlxniieiadla ea(mp ()trtoxf3tytoaDeauvs (0trtmxm3oydlptnlnvsls aDrrumpnu4tltnii3iysfa emnvo;(4aeeoio ia1om elu s t)t2xmxo3oo1amtnmivt t  Drmxroou1tltomf3tlsla rlnmp u4texoir3iy1oatelu slt)teuo(r3oy1omt livt sf rurxmp;u4aptn ietad sDul( o u)artomf3ootomteai s;(0setrim3oodopeelncil() 2raxm ;u0aee iociydfs ulu p (0trxrifciadlmtraiei;t)trur(m3iydllen fesltfsrrmump;o0openmociyd m2um(mo (0 lermfctatfa rli o;(0srur(o iydapen ictls srumumont0tlxn i3iytlm2elnvp ()trtnmocootomteauvs s)t2toxopio4omenlfcia(f 2uaurp;u0apxomictldfm umu on()artrmo tydfa rauvol(  2ur(opoo4ap  liesat  2raxr oo4tpxo i3ild m2rlnvp;u4tlenio iatfp ran ilt)sexo(o io4lme  nvsat)srrmu  nt0tptoioeiad a2rm( pnt) etrmr oatoptrlues t s2xoxo oo4ope  feia( arraumoot1olt iieildlsDum(vp;t)aexoxr3io1lm r ivsls0trum(r3iu1apenlneil() rumum nu1alen ociatlaDrl( pnu4aetomr3ia1fptrlneo ( tetoxm iy4amte ncslsf rtmu oou1opxoiiciytla2ul(vp u) rtoxrcoodfp elieo t0 rtoiopou4altemncsas) rumxrp;o4oee mfciyd a2uanvsn() lenio oo1opDe n olt srtrio ou1ol nmfcilt)aDtmu oou1open oeiatfa2emnvs ()tltnio3ia1oat ln o;()srur(m3oo1ol nlies tfa2urx pnt4oex ii3tlsls2ea(ms t)altnmr totlpD anes ()tetrxo3io4am  mivtls s2tmx  nt0apxn fctas a rlums u) eerif3iadlaDr uvilt0seuo(o iu1optemivslt)s2tr(r ;t0opxomfeiytlm eauvpnu4aexnxrcty1fate u i;t) exr(r oudomtnmics tfa2uax o;o4olx  octyt s2ul(vo ()arenir tadfpDr neolt0 rurir3no4lptnmnesl(  ruaxmpou4oltnmo3iyt s2eaump;(0arxoio3oadfat  ies;s)t2urxr nu4om  mfci t a2taxmo;t1tlenifctatls2umumont4artnmf3oatlatelueo;( seum(m iudoltn nei s  2rmxrpnt1opx mi3tlslsDemuvp u0texoio3todfaDrlneols t2tm(o oo1lp elietl( sDua(mo;t1tpxomo3iysla umu s t0treomo3oatopDe ueo t s2umxr3nu1llee nvta( arrm(mpnu0ale iiciadls rm(msnt) rtnmr todlpDrluvi (0s2xmxm3no1lptemnvtlt) rtaump;t0texnif3tysfaDul(mp;t0 exoxr tytlmt ln ol()s2umxo oudoltnlfeiat)a2urxrpno4apen fciatfs eau p ()trxrircoytlaDrlivolt teum(r iydamtelfci t s2um(rpnu4alxoifeiadfm2um(vo;t0 rtomr3tatfptelieolt  2uoio oydol  mies t)srtaxrpoo1alx  i3iltlm2rlums;(0 eenmocoy1lpDe iei;t0trurxo3oo1olen ivtl( a2ua(  ;u0tpxnmiciytls2um( pn()aetrifciadfpte ivils0trtmim3iu4ameemnvtl(f Dua(m ot0olenio3iyslm2umn s;(4aexomr3tatfpDeaiesls0trxrxo3ny1apeemivt s)a2ta(r oo4tpeoifeiysla2elu o;t)trerxr ty1lpDrlues;s srtmxo oo4lle lnctls)srrm(  ot1optnifeiasfs2uln p;(0artrxr3oytlpDrlu o t0trumxm3nu1oltemiesa( a2ur( ooo4tltn feiadfa2ua(msnt)alxnmrcta1lpDrau slt s2urxopiydamee ivsl()sDtmxmpot4optn oeiyslmDeau p (0 eenxf ty1lpD  n o s) exrir ny1lm elivtl(fa2tru  ;u4tpe ioctlt m umnms ()texrxr ootfmtr nei;t)srxoir3nu4am elfeiatfaDrrx pnt4olx ifctatfmDrm(ms;(0 etrxf3iy1latrlueols)teur(m3iu1lmt  ncils)artrump;o0alxnmfcilsfa ulnvon(0 leoxo io1oa r i o;t)trtoir3oy1lmt mncsat)aDuaxmo;u0tltomicils s rl(vs;u4 rtnio tydlaDeauvo ( s2to(m3io4om   iei t)sDua(mono0alt  ociydfm ulnvpn(0 lxrio io1fp raies s s2trio3no1am nlictls arta(mooo4oeen ieiadls2um( s;(0 rxrio3oadlmDeln i;()t2urim nu4lp   ieil(fs2rr( onu4apeomociyslaDrauvs t0 lenxrcoy1lpt ln s s0 rxm(mpoy4ameemnesa() Dumu  oo1aet iictasfm2rmuvpn()arxnmocto1fatrln slt0texoxmpiy1lp  mneiltfs2taxmpno0oetoiietltfmDrmuvp;u4trenio iytlpD  nvo s t2xoxrpou1amtelnesat)sDrax  ot4alx ifciat a ulums;u0arenmr tatlmtr uvi;t0 eto(m iy4lp   iet sf rta(ro;t1ope iictyd mDuan p (4aetrmrctodlmteluvo;t seuoir oydapenlfcsltfs2rrurpno0optomicildfa2uluvs;(0trxrxocoo1fate ivsls) rxmir3iu4op  miet t aDurxront0olx iociadfs rmuvont4 exoxrcia1om  ln o;s0 2um(rpoodlpee nctlt)sDuaum nt0tet iieiydlm2rmnmp;()tleomr oadlm eliei;()seumirpnu4lmen fvsltfsrtmum ;t1oexo i3iltlm2rmnms t0altnir3ootomtr i sl()s2xoio3iudaptn nvils  Dum(m oo0tetoiieiatfmDrl( o;t4alxomrciy1fm   i o (0 2umxopnydom e fcil( srta(mp;t0ape iieildlsDulnmo ()tlenxr io1om e i i s) rto(rpiodll elfet (  rumxr ;t4tpto oeiadfs umnms;t0texnioctydla   u o t  rtoim oudamenlnvsls a2urx ooo0opxo f3iyd aDel(msnt)aetrmociytlm   ieil( s2umir nydamte ici t  Dtmxrono1oexn oetyd a2rauvp;(0teeoxo3iotopDe uvilt0srtoir3nu4lp  mfet () 2tmum ou4tpxnif3iyd sDrmu o;t4treoirciodfa rlu o ()s2urxo oo1aleemnes t arua(r ;o4ape ifeias s eanvsn()aexoxo3tydlptr n i s)t2xoxo oy4aptn ivtlsf 2trxmpnt4tltn o3tldlaDemnvs;u4alxnio ta1lm e n ilt0trxrio nydllenlneils)arrmu o;u1tleomfciytfs um( p;u0 lxomoctatfat  u slt)t2um(m nydlp  lnvta( sDuaxr ;o0olx  icilsfs2uau p;u0tlxnmrcoo1fp  auei;s  exo(opnudolen ivtas  rtmxr ;u0opeo oeiatlm emnvp t4teerir ootlmDeluvil() etr(o3iu1lmtelictasfaDrmxrp;u4tex  f3ild s emnms ()alenmo tatoa r uei;() 2xoio3nudlme mncs ( sDuau pou4apxnmf3iydfs elu o;u0arenif3todla   n s;()srxrxr nu4aleemieta() 2rmur ;o0oet mietasla2rmnvs t)teeoxo iydom e nvol(0trxrxm3iydlp nmfct s)aDuaxmont4apxnifciytla eau p;(4alxoxo3oadlmDr uvi t seuoiopno4omtnmicta( arum(  nu0tle mo3tyt m ra(mp (0 rxoio3iodfaDrluvi s0sexr(r3iu4ape mnctasfsrta(m ;t1apeoiiciltfs2uln s (4artrir3ia1fm ran o (0 2um(rpoo4lp nmivsas)srtru  ;u1oltoioetltfm2ul(mp;(4aexoxociydla eaivs;t) rur(r nudoltn feilsf rrm(mpnu1olxnmf3tytlsDel(ms;u) rtnirciatoaDrli ilt) exr(o iodaptnmivtas aDur(rpot4ape ioctatfa el(mp (0tleoircta1opD  uvs t)tetrxr no1lltn ncsa(  Draxmpnt4aet ioctadls2ua( o;t0aeermociy1lmtranvs s0t2toir oydoltnlnci ( aDtrxmp;u1oexn ictytlsDul(vpnu)tlxnxo3tydopDrlies;s)sexrxm3iodameelfesat a2urx  oo0aet  oeiyd s rl(mpnu)tltriociatfm ean s ()t2tm(rpoudlm n fcilt)aDumxrono0tpxn feildls2um(vs;u0 renxf oadom r u olt)s2trir ny4ope lfetls)s2umu  ot1olxnif3iydfs2um(vsnu) rxnxrciotfaDr nei;t0s2tmir oo1om  lnetatf ruru pno0olto feilt mDrl(vp u0aexrxo3ty1lmDrlieol(0trtr(m3nydllenmfci s a2ur( o;o0alx  ictydfa ua( s;(0arerir iy1om rln s ( setr(opoo1ol   ncil( aDta(rp;t1tlenioetltla2eln o t4 lxrifctadlptr u sls0trxoxr oy4lme  ivi (f 2taurpot0apx moeiadlsDumn p;(0tleoioctotfmte uesl( trxoim3iydome lncsls arrmu pot4aex mi3ildfaDemumo;u4tltrmo oatfptrluvol(0setrxm nu4lle  fct ()s2tmu pou4tlxoioctadla umuvs ()artnio oa1fmtrlnei;t) 2xrxo nydam  miei tf Duaump;o1teeoiietlt a2rluvp t0aetnmfciotlpDrauvi;( trtmirpoodam nlics t) rraurono4oetnmictytlaDuanvp u)aleomocoydomtranvi;(0 eum(rpny1omenlnvtat  2ta( oou0tlxnmfcias sDua(mo t4 rtnxrctytlaDeauei;(0seumxm3ny1lm   ivs tfaDtmu ono1tpxnmietltlaDemnmp () rxrmo oo1fat lieslt) 2ur(opiy1ol  lneias s2rm(mo;t1tpxo feiytlaDrm(von(4tltoxfciy1fptelu sls sruo(mpny1omte ivsa() rurur ot1aexn ieildlaDum(vsnu0trtoxf3oa1fmD  n sls  rtrxr3no1apte nvs sfsDua( oot4tet ifciaslmDranmon()tetoir3tytoa rlivi;()trtm(m io4lmeelneias)s2tau p;t4teto ieiytlsDrlnms;()tleomf3todfmDr neolt  2uoio no1om nlfet t aDtmxrpnu4oex mfctlsfm eanvsn()texoxf3iy1fpD aiei;t) 2xoxr ou1am n ies (f Drmx pnt4tpt mfctldfa rluvsnu4alxoir3tadoptr nes;s srxmxo no1ap elici s) 2ta(moou1tet moeiltlm2umu p;(0 rerif ty1fpDeanvol(0trtrimpnu1om nmfesa( s2raumo;t1texniiciytfsDeanmp;t0 ltnmfcty1lp   u s;t s2um(m iudomtemfctlt) Dra(  ;u0texn feildfm umnvo;u0tlenifciatlmDr i o (  eumxrpio1aptemfeiltfaDrax p;o4aet  ieils s el(mo;t4tltrioctotlptranvo () etmio io1amt  fvi () 2tmxmpno4aeeomf3iysfs ea( ont)trtrmr ia1lp e n i (0texo(r oudoptelicia( s2uaump;o1tlen oetat aDulu s (4trerxrciatfmt ln o;(0 exoio3oudalee feiat s2ua(r oo4tpt  oetyt s rmnvo u0tetnxr oatlmD aneo t sexr(o3oydalee iesas) ruauronu1altomfeilt mDra(vo;(0alenir3ta1laDean olt0 2tm(rpoy1omt  neil() Dtm(ronu1aetn f3tlt a2ul(vonu4alerxo3iatlmtrln ols t2xr(r3io1olee fvt ( arrr( ono0tee mocilslm2emums t0 lxnmf3todlp e u i t)trumxopiydolee nvt (farumum ;u1alxomiciysla2umumsnu4 eerxo oodomt li s s  etrxm ny1lmtn iviat) 2raxr no4oeenii3ildlm2em( o;(0arxomfcootoptean i;()trumimpoodapenmicil( a2rr(m ;u4opx iiciad sDemuvsnu) ltomr3oy1lptrln o s) rtmxm iudolt lnet sfs2ur(mpno4aeen i3tlsls ua(vp u)altrxr totom   i s;s s2xmirpou4opeemiesls)aDrru  oo4olt  f3iltla2rl(mon(0 reoxrctytomDeaivil()setoim3iudllt miet t a2tmxrooo4tle miciadlm2rlnvs u4 leoioctytlmD  neo s) rumir oo4lmte ietls  Durxrpoo0tpt ioetyslm ra(vpnt4 exrxf3oodlp eaies;t0 2xmxm3no4lmeemnei s arrr(rooo1teeoifeilsfm emnvo;u)trtnxo3iodomt an s;t0t2xo(r3iydame  ies sfs2rm( oot1ape iiciadls2rm( o;()aeeoir iatoaD lnesl(0setr(r oo4al nmfvia(f Drmxmo;o0tpeomoeiltfs2emnmpnt4 lxrmr3oo1fmtelivi t)srto(rpoy1op elnctas  Drmxronu0oee  o3iasla elums;(0 rerxo3oo1oa  ai i;() ruoio oudll  mnctas)arurxr ou4alx  fcilsfs ua(vo () eerir oytlpteai i (  2umxr3oudll nmics ()artrum ;t1olx  feildfsDulnms (4tetriocoo1fpDraueolt) 2xoimpoydamee fei t s2urx p;o1alt ii3tatfa2uauvo;t) etrir tadomt au o;t)teumxrpiydapenmnvt ( srta(m ;o0aexo i3ils mDeln p u0aetnio ta1opD lu o;t  rxoxr3iu4llenlies t a2ur( o;t0apen iciltla el( pnt)tltrmf3io1fat li ol()teumir iu1alenlnei s aruau o;u4openmicilsfmDea(vs;u0artniocootlpt anvo (  2xrir3ou1openlfetas) 2taurpnt0alen feiytfa rmumont4texrxr iotfmDr uvo s0srxr(m3ny1apeemicsa()aDrau poo0aetnmoeiasfa2eauvo;u4aeermf3iytla rli o;t  rurimpoy1opeemnciat sDrr(root4oexomo3iasfs emuvo t0 ltoifcty1faDe n o;(  rxoiopnydlmen nviat)s2taump;t4tle ifeiydfs eau onu)trxomf3tytfmte uvs;s t2ur(r oy1ap  mfetlsfarrm( ooo4texoifetldlmDeau p;t0alenxo oadlatraies ()texoim oydlp e ncil(  2ur( onu1teeniictld m2rm(msn()alermr3to1fmtrln ol()s2to(r3iudom e ncsas) rur( pot0alt mf3iltlm ra(vp;u)teenmocoa1fpDeau i ( sexoxmpnu4am   neils  rumuronu4optniieiat a rln p;u)altrxr iatoptelu s;( srtoir io4lpte fcil()a2rmxmp;o1oetomi3ildfm2ranvsnu4 rxoxf3iydomtr n i (0s2urxo no1om  mnctlt a2um(mpno4teeo icildlmDrln sn(4tltrio3to1fa rlivi s)srxoim3oy4apt  fci t  2trx o;u0oeeoiicildla2ranvsnu)alxnmr oa1faDrln ilt  euoim oo1oleelfet s  2rm( pno4olenmieilsla eln p;t0arenmo3oydfmDrlivslt) rurirpny4lle  ivs (  Drmx  ot4oetnioctldfa rm( s t0 ltrioctytoaDelieo;t0setr(opou1lm eliviltf rra(mpnt1oetnmo3tasfm2ulump u)artoir iodlatrluesls)teto(m nudlltnmfcsls arumump;u4aee ioeiys aDea(ms;t4alermocoadfa rlnvo;t)t2xm(rpoy1omt  ietl( aDuru  oo4aetnmociydfa2emnmo ()arxomf oadlpDelivilt)t2ur(mpiu4aptemnetlsf 2ra( ont4oexnmiciatfs rlnvo;t)arermf3todlm  ln o () 2ur(o nydomeeliciltfarrrx p;o0oltomf3iadla2eluvo t0aexnxo3oodlmD  nvo t  2uo(m3ny4lltnmfctl( a2urumpoo1oeeo f3iydfaDrln onu)altrif3todoaDranes () rtoxm ny4altemivtltfartrxm nt4texoioetysfa2uauvsn(0 leoxo3to1faDraivolt seto(m oy1op  mfesasfaDrm(r oo0tptn ictys s rl(mp u0 exrmo iodlmt  uei t)s2trio3oy1ope lfeslt) Dtm(mo;t4opt  i3iasfm rmn s;t0tlxnif to1faDr neo ()s2um(rpoy4amtnmfcias a2tau oot4oltnio3iasfaDumu snt) eenifcoatomteaivi;s s2ur(o3nu4op  mfvi sf 2tmxmoou4teeoifciytfsDrl( o;t)aleomr iydopte nvols0srurxmpiydal nmfcs s  Draxmont0tpe  feiatfaDrmn sn(0aetoif ia1opDrlieilt)s2toxo3oo1om n fcs t sDrrxmo;u4teeomieildfm ua(mp u)altnxr3totfmD li i;s)s2tmir no1om nmieta() rrm(m ;t0altn ieildfa ra(vsnu4 rxnif tadomtrai o s0s2ur(m3nu1olt mfetltfsrtr(r nu4tet io3iytfm eaumo;t0aeeomociodomt lu ol(0s2triopiudlp   iei s srrm(ro;u0aexomictad s2ranmont)tlenxo iadfmtrli o;s0 ruoim io1olt  iesat  Dtm( o;t1apt mieiydla2rln sn()tltnxo oa1op  lneil(0s2toim3io4llenmfvias) rrmxront0optoiieiltfa elnmo (4aetnxocta1laDe nvols0texo(rpiy1ope mnvilt srtax oou1olx  i3iydfs2rauvs u0 ltoirctytomD lues;s sexmxr no1ameemivsltf 2rm(rpnt4tetn i3iltfaDumn s;(0treoioctotfate nesls)trto(r3oo4amtnmnvsas aDtmuroot4tee ioetadlm rauvp;(0texrirciodfp  livi;t  rur(r nodlp  mict t srrr(mp;u4texnio3ildls eln pnt)trxnio oodlmD lneslt0 2toio3ou1ame mivsas) Drrx pou1apxnmfeiltls rln pnu4trxnmr iodfpDeau i;t sexoxopoudolenlnetatfaDtmxmo;u1aleo ieilt s rlnmp;(4 lerio3tadlm e u i t trumimpny1lp   ncsat  2tmx  oo4opeo o3tls sDran p;u)texrxo3tydfpDrauvi ()seum(m iy4op n feia( artaxmpnt4alxnmo3iys aDra(mp u)trenio oy1oa rlnvil( s2toir3oydlpenlicia(f Dtmxrp;o4tlxnio3iytfs2eanmo u4 etnxocoo1lp  lueilt t2tr(m oudlle mnesltfaDtrxmont0oet iiciytfm ran o (0alerxfcoy1faDeliesl( srxoiopou1optemfvs tf Dtr(  oo4tpxnifciys a2ulu p u4texrxo3todfatr nes t s2tr(m3oo1apt mictlt)arur(root0teeomociltfmDrl(vpnu0alxnif3iy1opt auvo s  etrxm3iy4omt lfvsa(fs2ua( o;t1tlx  octytfs rlnms;t) lerio oo1la  lneil(0t2xoim ny1al e fet t s2uru ono1oexn iciatfsDea(mp (4 lenmo3ty1lmt aieilt)s2toxo iy4lme lnet s)a2raxmo;o4aexoifeiytla2rl(vs () ltoiociotoat  neo ()s2tmio3nodolee icsl(fsrtrxrpoo0oleomf3tytfa2em( on(4trxnmo tadfat auei;t0 rtrxrpny1om nmfvs ( s2umxr ;t0teenio3ild s eanmo (4 ltrio3oydlptelu s;()s2uo(o ou1al e fvtas  rururo;o0tlxnif3tlsfa elnmon(4 lerxoctadfpDraueo (0s2xoim3iudll emfci s) Dtau  ou1aee mo3iltlaDelnmo;t)arxrmrcia1fmDe n ilt0t2xoio3nodopenmieil( aDrr(rpno0olxn ietasls rl(vp;t)trtrxo iadlmt aneo;t0 2xrim3oodam  liei s) Dum( oot1oex ii3tytla2uln s t4artrio3oydfmD livil(0tetmio3ny1lpeelivsat  rrax  no1tex if3iadfa rmnvpnt)alenmocoadoa   nvols0trtmxr ny1omenmictlt s2tru onu1olx  feiyt m rl( p t4tlxoirctodlpte ieol(0 etoxrpoodam elfei ()arrrxmp;o1tlxn o3ild s2rau p;t4aexomociatlmDrlivs t0truo(m iy1llee fvsatf Dtm(mp;o4oetnmoetlsla2uaums u0 eermociatopDrlnvsl(0t2uo(o oo4opee fetl( arrr( p;t1apt  ieiat m umuvo (4 lenmoctadom r u o;t)trum(o3iy1lle  fvtas)sDrrur no4aleniocildla uln p;(0texrxo3iotlmt luvslt teur(o3ny1lltn ncsa( aDra( o;o1opeoifeiydfs uau p u0altoxr3iotoaDranvil(  rxr(m3iodlpenmnet tfa2raumpot0tle iiciysfm2ua(vp t)trxrmrcoa1la r nvols0 rxoxr3oo1ame lnes ()a2ururoou1ope moeiyd m uanvpn(0arxoir3iydlm  aieols0s2xoimpno4lmtnmfvta(f 2rm(mpou4alxomo3iltfmDemnmo;u4arenifcoo1opDranvo;t) 2tr(opoy4ll nlictat s2ra( pnt4tetn o3ilsfm elumsn(0 etrxf3ty1oaDrai o (0 rtoxm3iudole  fcias aDua(mpnt4apen ietlslm emumont0 ltnir iotfp   nvi;t0s2xrir3nu4lme  fcilsfs2uauro;t4optnif3iad mDrlnmpnt4trxoiocio1fpD anvi ()teum(rpoodlp e fcil()s2trxr ;u4ale mo3iad mDeluvs t)trtomfctodlm ran o t sruo(r ou1lmenmnetltfa2urxm ;o4tleomieilsfm ranvon(0 rxrxfciatlpDeau s t)t2trxr3iy1ll n nct ( a2um(mpou1tpxomi3ild a ra(vsn()tetomr3oydlmtrau s t) 2uo(rpno4lp   fctl(farrrxrpoo0tpt  ieiyslaDrl(mo (4 eermfciadopDelnvi s srtoxm iudlleemnvtl() Drm(mpnt4tlxomfeiasfs rm( s;u) etnxo iatoa raneo (0teum(r3nudlp n fvt t)arrm(r nu4aptoioetadfs2rlnmont)tltoif tatom elnvils0 2umxo iy1ope lfes ()sDta( pnu1tlx ii3iys m2ulumsn()tlxrmo3tydfa   i il( s2tmimpoy1am   nviat  rtrur nt4opx miciltlmDulu s u0trxoxo oa1opt lieo s0tetrxm iudop nlnct t)s2tr(rp;t4oeto octld aDrm(vs u4 leomo iadfmt  u ils0 exoxm oy4llenmictlsfsDrmu oot1olxniocilt aDrmuvo;u0 eeomrciodlmDraieols)trtr(o iodap elnvs s arra(mo;o0aleomf3tldlm2em( snu0 etoifcto1om r n olt)s2uoxr3no1ll nmici (  rrrum nt1olx if3iltlm2rmn p t4alxoio3oy1fm raivi (0s2toir oy4llt  nvil()arua( o;o4optn ictydfa2rluvs t0 lermo iatlm raueolt  etrxo3no4llenlnvil( artaxr no0tpx  oetatla raumo;(4aetoir3oa1fmtrluvs;s) eur(o3oudlm  mieiat a2tau  ou1apx  f3ilsfm em( ont0trxoir iydlatrluvo;(0 ruoir nodamen ncs sfsDtau  ;t1olx mo3ild a2uau o;()altomo3io1fmt luvo s)seumxo iy4oltn neiat s2uaumpou4oexnmfcilsls2ea(vsnt0texoxo3io1opDeauvo t  2xr(m3io1alte ivias artmxr oo1tleomo3iydfm em(mo u0 lxnxf ia1fpD li i s) exrio3oudomeemncs tfaDta( pnt0tltnif3ilsfsDeluvont) rxnmo iy1optrlneo t)teuriopou1omtnlnvias aDuaxmo;t1oltnmiciatla2ulnvo t)aetoir oo1lpDrai il()s2trio iydole  ivt ()s2tr( p;t1aexo icild m el(ms;(4 ltomrctotoatranvi t)s2umxopoo4lle lfei sfaDrm(mpnt1tee  o3tldlaDeau o ()alxoxf oytlmtean s;(0 etoxm3nu1omte netl()aDumum ;t0apto iciydla2umump t0alenmf3to1fa raivo;s) exo(r3no1lltelneia(faDumurp;u4oet ii3iltfm ulnmp t0 ltrir to1lmD aivi (0srtr(mpou4omeemnetltf 2truro;t0aleo o3tydfm rauvpnu4 exoifcoo1fm rln sls0texr(mpnodoptemicsltfsDta(m nu0optn i3iltla eluvo;t4tleoif to1fpDr uei;s  2xrxo3iu4op e ivtls)aDrmuro;u4oeen iciad aDem( o t4arxnir3tytoa raieols)seum(r3oydlmenlfcia( aDrrxronu1apxomfcilsfaDrlu s;t)aeermf3oadlp e ivslt s2uo(o nodom   nvia() 2tmxr ;u4oee mi3ildlaDea( ont0 leomr3iy1omDe u s s  2urxmpou4alt  fctlsf Dta(r ;u1olxnmieils mDemnvpn(4trtomf3iy1fmt  uvil() ruoxmpnu4omtemics sfaDuau pou0opxo oeiydlmDem(mo;t)aeenmfcoodla   nvs ()teto(o3io4apt mieiat arrax pou0ale mociys a rl(ms t) lxoxr oadomDrauei;t)s2xrir oudlpenliviasf Durxmpnt0oet mfetltfm rluvsn()altoxf tydopt ai i s sruriopoy4ol nmfeiat a2ur(rpnu1aex mocild s ea(vont)aexrxfcta1fmt anes;t0t2trim iudom n ivtas)srtaxm ou4oeto fetas aDra(vpnu0treoxo3oatlmtr ivo;s) eum(o no1lp  mnvtatf Dtrxroot1tpenmfetydlm2elu onu4alxrio oydfat lies;t) eur(r nu4ope  fcilt) 2taxrp;t4opxomictydfs2emnmp;t)arxrir3iodfp r ivilt  exrim3oydomt  fct tfa2rmx o;u4tpenifcilsla rmuvo t0trenxfctytlm  an i;t0trtmxrpnu4ome miei tf rrrxmpot1teeomociadlm ea( o;t)aeeoif to1fa raivo;t0srxoxr3oo1ol nmfcs t) rum(mp;t1apxomi3iadfa2um(vpnt0 rerir tatoaD lues;(  rtoir iodomee neils)arrrum ot0aet  fctyt sDul(vp;()areoio3iotlaDe nvslt srxrir nydoltnlnvtltfsrtax ooo0opx if3iltfs2ulnvp;(0 renxfctydlm  ai s (  rtoxm3iydoptnmneilsfarrrx ooo0oltnmicild m ulnvo u)aetnmo3oo1lpDeauvsls  etrxo3nu1ll emiei sfsrrr(root4altniociytlaDua(vs u)tlerxo3totlm ranvi;s trxmxo oo1lmte fcslt srta(  ;t0oee mietys s rm( s;t0artrif iadfmDeliei (0trto(r ny4aptnmieias) rraxmo;o4ale iietadfm el(vs;t0aexrmociy1laDranvo;s truoxr3io4ll   nviat sDrmxr ot4tle  iciltfm ulnms t4 lxnxr3ty1oaD lueo t t2xo(rpny1lm e fciat)a2rmur ;o1olxn fctydla2ra(ms u0artrmo io1lpteauvsls sexmxo3iu1ll nmnctls sDtr(mp;u0oltn f3iysls2eln onu) rtnxf ootfm raivo;t)sexrxr3iu4lme mivt (f rum(mono1tpeoii3ildla2ul(mpnu4tleoioctydlpD aues (  rxoio oudoleemneil(fa2trx  ot0oetnioeiytla2rln p t0tetoxf3oydfmte neol()trto(o oo1oltelnct sfsrumxrono4oee mieiydfs rmnms (4 reomo oytomt  ues;s  rtr(mpoudom e nvsls) rumxmo;t4apt  fctlsfa rmuvo t)arerxo oytfptrai o;s0t2toxr3no1llt lnvta(  2trumpot1aex  fctytlmDumu s (0 lxnir3tadfpte neo s  exo(o no1lpte ncta(f rrau p;u0tex  fctltfsDuanvs;t) ltoxf3oadfa  ai i;t setmxr3nudale lictlt)a2rrurpnt1apxomictadla2uln o;(0aeenmo3tatoa ranei;t  ruo(o io4ll e fvsa() rtmumooo4oee mi3iytlmDemnms (0arermr tatlpDeanei (0trtm(o nu1ape mnvsat aDtax  ;o1tlxnmf3iysfa2rmnvo ()tetoxfctodom ranvsls)t2uoxo oudlltnmictas s2umx oou0alx ifeiatls2umnvo;t)areoxf3iatom rlivsls0 2toiopnodapt mfvsas  Dtau  ;t4tptniieiatlaDum( p u)tltoxfcio1fptelivsls0srtoxrpnodllt mncta(f Dum( poo0olenmfeiyt s uluvpnt0tltnmfctadoaDelieo t) eurxo3io1lmenmnvtl()aDtrumont4altn o3tydla ra( s t0teermrciadop rai i;s  rtmio3no4lptnmivta(fsDtr(  no4ale mo3tatlaDra( s t4arxrir oydfm eanvsls)tetm(m3no4lptemicils  rrax oou4oltoiieils s ul(mo t)aeeoirciy1lpDe nes;t) 2tm(m nu4am   ncslsf rrmumpou1oetn fciad aDumumon() leoxr oy1la eaivo s  rtmxmpou1lpen fvtl( arrm(rpnt4tpxoio3tytls2rm(ms;(0 etrif oadfmD  uvslt) rxrir3iudlltelfctl()a2trxront4tpxo oeiytfm2rl(vpnt)tlxnxrcta1fa raivils0setm(mpny1lpt  ncsat a2ururont1optnmf3tysfm2um(ms;() eeoif3iatfpDrln o;(0 rxoxm oudap eliesat a2uaumpnt0olen fcilsfa2emnvs;t0tlerxo oadoa e ieo s)teumxo3no1alee netltf Draxmpnu4opt mi3tasla rln s u)arxrxr3iadfaDrlueolt0s2urio iy1ll e ivi (fs2rr( o;t1teeoiicilsfs2em( o ()trenxoctytlpD  nei (0tetrxo3oy1lmte ncil(faDrmurp;u1oet  oeiydfs umumo u0 rtrxf tydlat livols0teumxopnu1omenlnetlt artmxmont4teto ietat mDel(vo u0trxrmo3oytfpt livs;(0sruo(mpiudllteliesa() 2rmxm no4alxoifciytfaDua( p;t0alerxf3oa1lpD lu sl()texrim iydlme  ietls aDtmx  oo1ope  oeilsfaDrmnmp;u0tlenxrcoy1lmteluvil() rtrir3oo4lle lnvs sf Drr(mont4aex  f3tldlsDemums;()arenxr3io1lm eaueils0 rtm(o3oo1ale mfcsatfs2ur(rp;t1apxn ieiysfm um(vsnu)arxnif oo1la eai o (0t2um(o nudolt  nvt t  Dur(  nt1oetn i3tydfaDeauvp (0 leoifctadlm rln sl(  ruoxo ny4lpe  nesa( a2um(mp;u4olx mociadlaDuau snu4tetnio3oy1fptr nvo;( tetoxo io4lpeemfciatfa2rau oou0oet  i3ildlsDra(mo u0altomr todfm  anvol(0t2toimpoudomt  fcilt)a2um( poo0tpxo f3iyd a ranvonu0 lxnxr tydlatr u slt teuoxr3ou4lleelnvs tfs2rmu onu1tltnifetydfaDra(msn() etrmf iodopDr i i;(0 rxoxm3iodlmt mfcsatfaDumxmpno1opeo fetltla2rlnmp (4trtrxo tatopDean s t setrir3oo1omtnlictlt a2trxro;u4tlxo iciatfsDea(ms (4 etoir3to1fmt  u s t)truoimpnu1ome lfvilsfaruaxr ;t0apxnio3iltlmDulu sn(0altrifcty1op  lieils0 rtoxm3oo4lmen ncia(fa2rmx oot1aleomoeilslm2umnvs (0aexriocio1fptrlies (  etr(m3oodlpt mies (fartrumonu4olx iicildlm elumo;t0aexnio ootfpDr nvilt texr(o3iydlp elnvsas a2ur(mo;u4opxoiietld aDrmuvs;t)arermfciodfm rlu o;t0trumxopiy4lm n ictltfsrurum ;o0ale iietldfa el( s;()aexrmr oa1fmt luvo ()truo(m3nu1ol elnvia()s2tmu pou1oexo i3iysfm uaums;(0tlxomf3tytlaD  ivil()sexrim3nydomee net ()a2rru  nu4texnioeiaslmDea(ms (4aleoxoctytoate ivi;t seumim3no1ll n ieil()a2tr(monu4tetoio3tld a umnvs u0tlerio tadla eaies;s)setoir oy1aptelicsl(farra(rpot4opeo fciadfs em(vs (0 lxnio iy1fptr nvi t  ruoim3ou1ap  mneta() Dtaxr ;t1ole mo3ilsla2ua( p (0 ltrxo ia1lpte ues;( srxmiopoo1ome mfctas) rtax p;u1aptnmfeiatfa el(ms;(4aexnio3iytlp  aueo ( s2urxr3nodome livtas srtmu o;o1opt  i3iytlmDelnmsnu4trenxociy1op  aivi;t tetm(m oudlpe lfes t a2ra( pot1alen f3iatfaDrluvo ()texrxf io1laD aiei t) 2urir3oy1lm emietlsfa2rrxroou4tet  oeiyd m2eanmpnu4tetomr3tadfm eaies;(0 rxrimpiy4omte ietlt  2ra(m nt0opxn f3tydfs eauvpn(4 rtoxfcoatopD  u o;s)trtm(opnodaltnmnet (  Dtmxront0opt mi3tlt m2elnmsnt)aeeoxo3iatfa r nei;s) eum(o3iodom nmies s  rumx  oo0aptnmieiyslaDrmumpn()trtnmfctotla eaneo;(  2xrxr3no4lpenlies s)s2umu  ;o0opxomiciyd m2rmuvpnu4tlxnmo3iatlp rlu o;t0 2tr(m3io4omenmfcsas)sDuaxmpot4tltoifcildla ra(mp;t)aetrmf tydomte ueo ()sexrxr3iodalenmnvs ( arrau pnu0alt io3iys m2rmums t4 etoif ia1oa  an s t) 2xoxopny4am  lics (faDraumoot1alto o3iys sDuan o;(4tlxrmr totfpDe ies;( s2uoxm io1am emfet (f Drr(mpnt1ope  oeiydfs2uln o u4 leoxf oatfmDrau s;s0setoxo3no1lmt  nciat arumum ;o4tpe  f3tyslmDra(vs;(0arxrio3oo1fateanvi t)sexo(o oy1ame mfct tf 2rax oot4alxomicils m2uan o;t0trtrmocty1fmtelieo s t2tmim no1ome  ivsl()arraxmooo1aetn f3iatfa eanmp;(0arerif ootlaD lnvo;s0srtmio3nu4ole  fvt (  rrrxm ;o0alxoifctys mDrm(vonu)artrio3totlm   nesls0 2tmiopiodllt lict sfaruaxr ;o1tex ioctatfmDemnmo;t)altrmrctydom r ueilt seto(r ny4ome mnet ( srur(mono4tpt moeilslsDrl(mp;u0 lerxocio1oat aieilt0t2xmxo iudopeemicilt)artm(mp;o1apx io3iltfaDelnmp;t0artnio3to1fa elu i;s srtmio3iy1lmenmfei sf Dtrur ;t0tle  icild s umnvp;t0 rxrxf tadfmtranvo;(  etrio oy1lmtnlnvs (f rtm(mpno1aexniociasla2uanvs;(4tlxoif3oydfp elnes ( t2uo(m nu4lptnlfes t)aDtaumpoo4tleoio3iyt m rlumo u0texrxf3totlaDeaueols truoxm3oo4op  lfvt (farrmxmooo1aee mietltfs ul(mpnt)treoxo iotfa ean ol()teuoxr oo4lme lieias s2trumpnt0tpeo feiltfsDul(vonu4 eeoxr iytfaDean i;t0s2umir3oy1ol nlnvt ()aDtaur nt0tleoii3tysls ul(vp (0tetoifctytfaDeaues s0trxrxr3oy1ameelfvsl() Dtaxr nu4tpx  f3tydfa rau s;()aeenxf oodfmDean o;t0trto(o oydlmt  fesat srurxro;t4olx ifciltlmDrau pnt)altnmr3oytfat lu il() rtoirpoydale lfvsl(  rrr(m ou0tlxniiciyt s2rl(vo;u4 rtrio tydfp eln ils0t2xm(opiy1olen ivil(  Dumxmpot4oeeniicils m emu p;()texoxf3ootop elnes (0 2xrxm ny1ole lnctl(fsDtm(mpnt1oeenmi3iasls ran snt0trenxo3tydlm  ai ils)teum(opnudal nliet (fa2trum ;t1tpxo oetysfmDemump;t0 lenif oa1lptr ivil()tetrxr nudapen ietat sDtmx poo4ope  octld mDuauvs;u0treoxf3iodlm eaneo;() eur(mpoo1op emneslt)arur(mp;t0aee ifeias m2ulnmo (4tlenxrciodlaDrauvo;t srtrir oudoltemfetl(  rumuro;o1oex  fciytls elnmo (0 rerxf oa1oa e ueo;s s2uoirpiu1lm nmfvi ( srtru o;o4aet iieiat m ulumo;()alxomf ta1oatelues;s) exo(mpnydopteliei ()arraumooo1oleo iciyslmDrl(vp ()altrxr3iy1laD anvols0teur(opoudam emfesat  rra(mo;o1aeeoioeiysfs2rmnmo t4 eeomocty1oa  lieo;s t2uriopoudapeelictlt)s2tmx  ;o0olxoioetasfaDrm( s t4arerir oy1laD  n o t)t2xrxo3no1lle livias  rrmxm nu4alxn feiytla2uanvo;u0arxoio oydfmtr uvo s0teumxmpiu1omtnlfvsatfa2rrxronu1oeenioeiydfaDean p;(0 eenxr iytfpt ln i () 2uoxr3ny1am nlfct t sDtrur nu0tpxo o3iysfmDel(mo;u0 rtoio3ia1oaDelueo ()sexmxm ou1ape lfvsasfa2rrxr
\ No newline at end of file
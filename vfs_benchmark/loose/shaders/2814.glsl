@@ -0,0 +1 @@
+ivo;s0 rtrxrpou1ol e fesatf 2tru  oo4tpe  iciasfs2emnmo t)treoir3iatfpDrlnvs;s  2xoxm3oy1llte nci s artau p;o4olxn octldlm emn o;(0aexrioctodfmtrauvo;()s2xr(opiy4ol emics tf Dtr(rpno1apt  fctlt a2rmnmo (4tlenifcoatlm raieo;t) 2toxm io4lme  netl() 2tau o;u1tpxniietldlm2ranvp;(0 etnxr oadfpte i o s)t2xmir3iodamte ivsat a2rrur ;t0tpe  f3taslm2umums;t) rxnif oydfmDr ivs (0trxmxo no1llt  nvs (  2rr(r ot0apt ii3iadlsDulnvo;() ltnir3to1opD lnvo t0sexmxm nudape mfes t)srrr( p;o4aeeo f3ilslm2em(von(4 eeomfciydfp  au o t0t2trio ny1lmtelivta( s2uru  ;u0tpxn icildls2eanvs;t)trxrifctydlat  u slt0seuo(rpno1ape mfct s)sDrm(ro;t1opto ietas a2um(vs;t4artrmf3iotfpDeluesls t2xm(mpiu4omee ietls)srtrxrpno0aetoiociltfaDrmumsn()tlxrxfcoodfp  luei t0 2xm(rpno1lp  mfcsltfarrmumo;t0olxnmictytfa em(mp;t)arenmf3oa1laDe uvs;t0tetrir ou4aleelivtatfa2taxrono1alxnmoeiydfsDrmumo;(4texnmr3todop  auvs t  exrxm3io4am nmieia(faDtrxr ;t4oexo o3iatlm2uauvp;u)aetoxo3iotopDeaueol()trtr(r3no4lltemfctls)arta( ont4tlxnifetat s2rm(vo (0tetoxo3iy1lptrauvo;s0sexoxopou4lp emfetlt)aDtmxr no0alxnmoetytfa umumpnt)alxnxr3ta1op rauvo s  exrxopno4lme livtltf rtmxrp;t1aexnii3tyd aDrmu pn(0 lxrmociydfmtr ieo;(0tetmir3ny1ol n fct sfsrra( oot4texoif3iysfmDum(vo u)aetnmf3iodfateauvo;()t2tm(m ny4ol nmietlt) 2uru pot4opx mictld mDem(ms u4trtnxo iydfpD luvi ()s2toxrpnydamtnmfcia()artm(  nt0oexnifeilsls emn s;()aeenmr tydoat aiei s0s2umir nodaptnmfvs sf 2rmuroou0apt  f3tys mDumump u)artnxf iadfmteauvols0trtrxr iydoptemiciltf 2tmxm oo1oetniieiltfaDeln pn(4artomr todfpDrliei ()seuo(r3oo1llee nvi t)s2tr( oou4aptoiictadfs2um( s u4tltrxrcoodfmD  u il() 2uo(o nu4ol n fetl()s2rmumo;u1olx if3tls a2eln p u0tetnmr iydlptr u o (  rtoxrpoodaltn nvta( sDra(mpnt0apeomieildlm2ranms;u0aexoxf tydlmD aivo t0s2xoxmpnudomtemictat)srrmxm ou0apto f3ildfaDran o t) etrmf oy1fm raivo ()seumxo nydll n nvs s)arrrx  nt0teeomi3iytfm rauvp;(0arerio3iydlaDelivi;s  exrxo oy1altnmictasfaDum(m ;o4olxn o3iys m umuvsnu) rtnmf3totfmDrluvo ( t2tmxr3iydlmtnliciasfsrtm(r ot0oex moctldlm2rl(vpnt4aeenxf3totlaDrauvi s trto(o ny1amee fct () Durumpot4oetn o3iydlm rlnvonu4 ltoircio1op eaues s0setrxrpnudlltemicta(  rrrxrpoo1aex ifciysfs eaums;(4 lxnmr3iodfmt auvi s0s2umio oo4amtemfct t)a2rau o;t0apen i3iytfm2ea(monu0 rtnmrciytoptraneol()setr(o3nu4ameelfvs tfaruau pou1aexniiciasls2ulnms () leoxr3ootlpD lies t)teur(m3oo1al nmies t  rtaump;t1opt  ieiltlaDel( snu4teeoxfcio1oaDeluvs s0texoxopiu4ape  fcsls s2rmurpno0aleoio3ildfm ua( s t0trtrxocoo1la  lu o (  2toxr3iy4lmen ietl( arrr(m nu0apxn iciydlmDra(vp (4aeenxo3oy1fat aiei;s0srtoxmpoydale lfcslt srumuroou1olen fciydfm2uluvs;t0tlxnmocoytla eauei t  2umiopnudlm  mnetltfartr(r ot0apeo o3iysfm2ulumont4artoir3oatfa   u s;s0 exm(mpiydlp n ivsls arur( pno4oexn feiytfs ean snt)aeeomr3tytlp r uvi;s) rxmim oo1ame mfeilt)a2uaxmo;u0oee ioeiadlaDelumo;u)artoiocoo1laD  n i ( t2to(o no4amtelfcil() ruau pnu4tex mfeiadfm rau p;(4 ltnxrcoadlaD auvils  exoxrpio4lleelnct s artaxmoou0tlt  o3iasfm2rlnmo;u4 exnxrctydlmDranes ()srtmiopou1oltn fcsl(f rrmurp;u0aexo o3tad aDrmnvo ()artoxf iatoa  lueolt  rxm(m io4lm e nes t) rrmxm ;o0aexnii3iadfmDea(vo;(4 eenif oa1op   u sls tetoio3oy1op   nvsasfarrrx o;u1tet  oeiys m uanvsn(4tlerir iytfpte neo;( s2to(r io4omtelfei ( aDtrurpou4tee mf3tasfsDuau s u0alxnxoctadfpD lieo ()t2xm(r oo4lmtnmnvt tf rrr(mpnt0aptomo3iysfaDea(mo;u4texoxr3tytla elnes;s)sruoimpou4ap  mfei ( artm(mo;t1oee  fcilsls emuvpn()tlenio3ia1lpDelnvi;s0texrxopnu4amtemncsasfaDum(  nt4apxn o3iysfs emnvp u)aexomocoadfat lu ol(0 rumirpnudlpe micslt a2uaxm nt4tee  ociydfs2ra(vpnt) lxnxrciatopDraivo (0seum(rpoy4llen fctas artr(mpoo4aetnmoetys a uluvs;(0trxnxr oodfa r uvs;( t2uoir iu4aptemfeiltfs2trur ;t4tee ii3iatfs eaump u0 ltnxf oadomt ai i s setoxopoo1amt  fcsa()s2rmxmp;o0oex mo3tadfaDem(von(4 eenxf3ty1op  livo t)trxo(mpoy1lpt lnvsl(  rtaxmpot4ole moctydfm2eanvp u4tlerir3oo1opte ueo;s  rxoxrpiy1al emfcsl(  2uax  ;u0apx if3iys s eluvs u4 ltrir ta1opDr ieol() 2xmxo3ny4aptemnetl(faDumxm ;o1aexn fcilt s2em( p t0texnmr3ta1lp elieil()trtoxo3oodom n nci s aDtmxm oo0oeen o3ils a2ranvs;(0altrif ta1lmtrauvi (0t2um(opnydllt  nvsl(  Dtau pnu4tet ioetld m uanmsn(0artoir tatla  lieils texm(r3nodal elicsa(fsDua(  ;u4optnifctltls emuvo t)trermf tadfaDr uesls0 rumxmpoudame mnvi s)srrr(mont1aet ifeiyd a umuvs t0 leomf3iatfmtraivi ( seurir3iudom nmfvtl(fsDuax oot0opeomictysfm2ra( o ()alxnif3iodfmt anvo;(0s2tmxrpnu4oltn fcil(fsrtmu pou1ope io3iadfmDel(ms;t0arxrio3ty1oat lu i;s  etrio no4ap e iei tf Dtaxrpnu4ole mieiatfs2uan p u)alxrmf3iydlp e ivs;t0t2toxmpou1ap e ivt t a2rrxr ;o4oleoiieildla em( s () etrir io1omt  i o (0s2um(opnu1ap  mfei s) rur( pno4opeoii3iltfsDuluvpn(0teenio oodop rlnes t)texoxopoydamtn nesa(faDraur ;t1tpenmfctys a2em( o u)tlxnmfcty1la r i olt  rtr(r3iy4omte ict s arumxrpno4oexn o3tatlm umuvpn() reoxf oo1omDrau o t)sexm(mpou4lm n fvt t) rumum ;o4tetn ieiat a ulumo ()tltrirciodomDe n il()trtrxr nu1al emnvslt) ruau pno4tpe  f3iltfmDrau pn()aexrxr iytlat luvolt0 rxmxopoodap nlivsa( aDtax o;t4olt iieiatfm2uan s;(4 eermo3oy1lmDrlnvols0 rtmxopiudap nmfvsl(fs2rm(  nu1tpxnmfciytla2rlnmsnu) reoxrciy1lp   neo (0t2xm(mpiu1llee fes t) rrrum ot1tlt iicilsfm2rmump;u0texomr3tatla  ai s s0setmir3ou4am nmnetat  Drmur ot4opeomfeiasfa rmnmpnt0 rerif iydfa elnes;t)s2ur(o3nu1ape mfesa()srurxrp;o0oet iiciys s rmnvs;u) leoif ootomtelu slt0s2tmxm3nodomenmneilsfaDur(mpou4opt iieiydfm ranmp (4aeerxr3iodlpD lues s setoir io1lptemfcsas sDtrur ;o0aee  ocilt a em(mp;(4altoxr3oodlmt anvsls)texoir3iy4lpenlnvia( sDrm(roou0oeto fciat m eanmp;t)tlxnxoctadfmtraueol() exr(r3nudam emfetas aDraxr ;t4tpeoiicils aDulu s;t) rtnmo iydfp  ai i t teuoio oo4alt  netl(fsrua(rooo0tleomicildls2eau s u4altoxo3tadlptrlnvi t s2xoxm3no4op nmnci (faDumuroot0tptniietytls rl( snt0artomr3ty1fmtrauei t0srxo(m3nu1apt  ivias a2rm(monu1oexoii3iltls ea(vp t)trxnxo3oadfaDeanvs;s) rxr(o iydopte fvs s s2uaxmonu1apto fciadfa rmnmp;(4 lxoio iodfa ran o s  2tm(opnydope  icilt sDuau  ot0optnii3iad a2ul(vp;u)aeermfcoa1oat lneo (0 euoxm3nodlpeemnvia(  Drm(moot4ope moetasls ul( on(4 eermocio1fatrluesls srtoim oy1lm n ivils)a2rm(m oo1alx ii3tys s rmn o;(0arxrmfcoa1la raivolt)s2umxr3iu4lle  ictlt) Dtrxmpnt0tltn fetadfs2raumo u0arerio tytfpDrai s s0sruoxrpoo1lpenmici ()aDta( ono0tpxomoetltfs2ulumo u4 etrmf3oydfa  lieo s  exr(r ou4lptemfeil(f Duru pnt1olx  fctls aDrauvs;t0 rtomrcoo1fm r ieol( setm(r oydlp n ivils s2rmxroou1opt  i3tlt s2ea( pn(0artoxf3iodlatr u o;t) 2trxo iudaptnlivsat a2tr( o;u1ole  ociad m raumpn()aetoio oydfaDr u o;s0 rtoxm3ny4apeemivtl()sDrmxm nt1apen o3ilslm2raump;u) etoxr3oa1fateauvs;(  eto(opnodlp   neil( srumur ou0opto octysfs2rluvo t0 ltrxo iodlat auvil()sexo(r3iu1openmieilt sDtr(mpno1tlx  fetltfa2rm( p;t0alenxo oytlmt  ieo (0 rumxm ny4omtemivia(fs2taum ;o4tle mfctytfaDranvs;(0alerxo iy1fmtrlnes;(0t2to(m3io4llenmneils)a2ua(m ;o1oeenmfctlt s umuvonu4texoio oo1omteaiei s0srto(mpou1llee fet tf 2rr( p;t4oexnio3iasfs ulump t)aetnmf oydlpDrlnvs s0teuriopno1ol  livil(  Dtrxrpou4aeto f3iad s2rm(von(4alenio3iydlpDran o ()t2umxopio1op nlivtltfa2uaumpnu1olxoifciltfaDemnmo;(0altnir3ta1omt lueols trxrirpoo1lp nliei (f 2rru  no1optnmfeiatlmDumnvs t0texomo ty1oaDrlnvi;s  rtoim iu1ll   ivsa(f Dumump;o0tlto ieiys a eluvs ()aexomrciydfaDrauvs;s0sruoir no4omt mivs t sDraxrpou1tleo fciydfaDrmumpnu) lxnxf tytomDelnvi (0t2um(o ny4al e ics t s2rmur nu4texnmicilt mDumn pnt0arenifcoadfp rau o (0srxo(r3oo1lp nlfeiatfs2umx oou1tpxnmi3tytfa2emu s;t0 reoxfcoa1fateaieslt t2urio nu1apenlics ()srraxmpou4apt mf3tydfa rmnmo (0 rxnxf oytop   u o (0s2xrim3iu4lltn ncia(  2rmxmoot0oet iietatfsDrm(von()aeerxr tydlpte ieil( t2urir ou4amee nci tfsDrrur ot4olto ieiys sDua( p;u4teeniocia1fp  lues;( seumir3no4omee nvtls arurxm ;t1altomi3tyt mDrmnmp u)aetnmo todlmtrau s (0t2xoxm iy4lptelfeiat  rurx  ;o1oexnifeildlm2ul(ms;(0tlxnircoa1laD ai s;(  rtoir3oudomen ivi s)arrrx oou4apeo feiatfm emnvo (4artrmrcootoate ieo ( s2xoxo io4al elfcsl() 2raxrp;o0alx  i3iys s2ranms (4 eenmfcia1fateaivi;t s2uo(rpoodlpte ivi s arrau p;o0oexoifeils aDrluvont4aeeomr oodopDraivsls0 2uoiopny1lpee fctlt)s2trxmpnu0aee mf3ildla um( pnt0 rtnio3to1faD li s s)texm(o ny1oltn nvi ( arrm(mpnt1oleomiciat aDul(msnu4 renmr oatom  luei;t srxo(m oodol  lici (f Dtm(m nt0tltn icild s elnms;u)tleoifctodop  lieslt)s2umxm iy4omenmncil() rta(rono4tlxomieias s2ean p t0 exrxrciytlaD lies;s)trtmxr nudal emivsl(f 2rm( pot1olxnioetydfaDrmuvs u)trxoirctadfpt an ol()trtmim nu4ol  lics t)sDtrumono1optoif3iltfs2umnms t4 ltoir3ia1fa   nei;s0srto(o nudomt  fvsltf Duru o;t0opxn f3iad s ea(mpnu0teeoxfciydlmDelu i;s  2xo(mpio1alt miet s)aDumx pnu4oexnioeiltla ean s () eenircoytla   nvs;(0truoio oodalt lnet t a2tmxroou4tet  fcildfmDumnvs;(0alenifctodlm elues (0 rxrxrpiy4lmtemneiat)s2rm(ro;o0optn ictysfs elnmont)tltoif3tytfpDraivslt0 rumxm nu1lmtnmieiasfarra(ro;u4tlxnmictadfmDraums;(4arxnxrciadfpteanvo (  2xmxrpou4ll n fet t aDrrum ;u1oex  f3tld s2eanvpnu)artoxf tadfp e n o;s0 2xoimpiy1opt mies t)a2umx  oo0tlxoif3iltla2rauvpnu)tltomr tytlpDraieo;() 2umio iudolee neia()a2rm(rp;t1tpx ioeilsfa2el(vp;u)aetoio3oytom   ivi;t0 2xr(mpou4am n feia(  rrr(rp;o4tle ii3iydfa2eln s t4teeoxo3ootfmtr ueo;t0 eto(o ny4apenmfesl( arrrxr nu4tlt ifeias mDrlums;u0aetnif3oadoat lnvslt  2uoxr3io1lpt  nesa(f rur( pnt1teto ieiatls2rmnvont)tlxoxfcoydom  lnei () rtrxmpnu4ap   fcilt  Duauroot4tpeoii3iys a2ul( sn(4artnmr tydfm r ieo t)trtmxm io4lm elnet (f rtaumonu0aptn oeiyt s rm( s;u4trxoiociodla  ai o;() etm(o iy1amee ics s)sDtaxr nu4ape ii3iltla eauvs u0 ltomr3tadlmDran ol()t2urxm3nu4lmtnlfci t  2um( pno4teeoii3iadfm2rl(mo u)aexoxfcoa1omD an i;t0srxo(r oodoltelnvt tfs2uaur nt0apt  o3tyt mDelumo t0areniociotfaD lnei;t t2um(o3nydaltelfcils)s2um(rpot4tlx iietyt s rl(mp;t0tltrmocoadomDe n s;() 2urxr3no4amtnmnvtas)sDrm(rp;u4aee  feiaslsDul( o () lenxr todoaDean i () 2uoir iydap emivilt s2ur(mp;u4tpe ioetyt a umu s;t)tltrio iodfp rli sls)teuo(rpoodaptnmfci t srurx  ou1oltomiciyt s raumo t4tlxrxfcoytlaDe u olt sexoxm3oy1ap elnei sf Dumu pno4oexnifctls s2el( o t0altnircootomD  uei t)teurim3io4opeemfvi s  rrau pot1tpxo feiat a emn s;u0tlermf3ootop raivol( trtoxo nydameelicsat)s2umump;t1olxnif3tydfa2um(mo;t0 rxrxf iatlpDelu olt0 rumxr nu1am n ivsl()sDtr(m ;o0alenif3iysls2rmuvs;t4 exoiocty1lpD  ieils0sruoio3oo4ap emiet s  rumu o;o0tpeoifetasls2elnvp;t0teenio to1lm   n ol( t2xoio3oo1open fcsa(fsDumurp;u4tpeomieiydlm ua(vs;() lxrircoy1fmtr u s;s0trtm(rpiu1lleemivi (f 2rrum ;t1tleoio3tls s2umnvs (0artomr ta1faDrln o;s  2xrio no4apt  fvt t srur(rp;t0aee iictad aDrm( o;() ltrmr io1laDe nvs;s)trumxm3iu4lmtn fet ( aruaxm nu1olenmiciadfa2el(mo;u0tlxnir3iadomt  ivo;( s2tm(o oo4alte fct ( sDta(  ;o4oetnmi3iat s rlump ()tltoif3oo1fmD  ivolt trtrxr oydopt  fes s)s2uaum oo4alt  iciys s2rmump t0 renir tytfpDeaieslt)t2ur(opou1ol  lfei s  Dtr(roou1texomo3iadlmDua( o u4 exoxr3tatlmt  nei t  rtoir3ou1olt lnvt t) Dtaurpnt1tpx mictas s em(mp u0 rtrxo3tatfa eaueils)tetmxm iydalenmnvias srraxr nt4apeo feils s2em(vo;t4tleoxo3iadfa rau sl(0 eumxo oudolt  nci (farta(mpnt1tpe mo3ildfmDuanms;(4 lxrmf3iadoptrau o;t0srurir iodom elivt tfsDrrxrpou0aexnii3iadls2ra(mp;u0aexnxr tydfa eliei;(0t2ur(m ny4om emfvsasf Dumu onu1alxomo3iys a um(vpnu)tlxoif3oodoa ranvs t teumxm3nu1lmtn nctltfs2trumpot0tlt  oeiysfsDem(vo t)altnir oy1fmD  i o;()srxo(o oy4omtnmiet (f ruauro;o4ope mi3ias sDum( s (0alxrmociotfm ran sl()seurxo3oudlle mnei ()s2tau ooo1olxomfciadfmDeaumpnu4arenxr iytlmD ai il( texrio3iu4altelivsas  rumxrpou4tpen fciatlaDranvsnt)tetnmo3oodlm   nvslt) rumio3oudaleemfesatfaruaxmp;o1opxniieild sDra( p;t0 rtrxr oydop raiei;s t2xo(o io4lp n fvslt)s2rm(rpou1apeoif3ildfm2rlu o u0arenxrcootop  lueo ()s2tr(rpiudameelfctlt)sDraurpot4tle mfciadla ran sn(0texomr3oadlmtrlu slt0 2urxo3nudamtnlfeslt) 2rru onu4aeto fetlslaDrl(vsnt4 eermf todlmDelivi;t0sexmxr3io1lp   iviatf 2uau  ot4aptomi3tas s2em(ms ()trermrciadlmte i i;t0 eumxr3oy1am nmnvia(fa2tmxro;o1oeen ieiadfs rl(mo;u)areniocoo1optrln o (  rurxm oo4olt lnvtls sDtrx  ;o1tptoifciasfa2ua(vsnu0 rxrxrciodop   nes;t0sexr(opny1olen fvsl() ruaur no1opt  iciadls2rluvo;t)aexnmf3iytla rauvs ( s2xmxm3ou1al nmnes (fs2ra(  ;u1oee  oeias m ranmo;t4 etoxf3totfm raivi () rxrxr3nudlpenlfvtasfsDrru o;o1aleomi3ilsls2uanmp;() rtoxfctydoat  n ils0teumiopiy4ll emfvslt  rur( oou0oee  o3tlslsDeanvpnt)aeeomo tytfm eanvol(0srum(r3oydomtnmies tf Duaxmoou1oeeomieiytfa2ua(mon(0alenmo3oadoa raueils0t2xmxo3iudomen icslt  Dtaum ;t4oleo octad aDumnmpnt0 lenxr3oa1fmt lneil() 2toiopno1omtnmics ( srumurp;t4oetn iciydlm rmuvpn()aexoxo3to1lpte i s;t trxmxo iu4olt  nctas) rta( ono0opeo i3ilslm2rmumo;() exrmo tydomt  ueil()srxmxm iu1lmte icia(  Dururono4oee  i3tytfm uau onu4 rxoxr iotfatean sls  2xo(m3io1om nlicsat)aruax o;u1apxoif3iyd aDeluvont0tetnircio1la   nei s) ruo(m3oy1opee nes sfaDtrum nt4opxoif3iydla2ean o;t)arxrxr3iy1oatrlu i (  2xoio3oo1am elnct tfsDrruront1alxo o3ildfsDeln p;(4altnmrctatfat  ieo t)texoxm3io1lltnlfvsls  Dtmxmp;u1alt  o3iltfaDelnmp;u0 ltrxoctadfm elu o;()texoim3ny4lmenlivi s)sDtaxronu4tpx  fctasla ulump;t) rxrir3oadoaDeluei ( trtrxm3iu4opt mieta( arum( pou1openmoeias a rmumo;u) etrmocia1fmt ln ol()srumimpiydam e fvils aDtr( onu4opeoifcilslsDel( s;t4 exnircoodoat  nes ( trtrim3oo4amte iesa(f 2umxm nt4olxomoeiys sDeau pn(0 rtrxr totlpDraueo s0t2urim ny1lmenlneiat  Dta(m ;u1apxnif3iatfs2uanmsnu0 ltoxo3totop r u s;s) 2xoio nudllt  fcsl(fsDrrumooo1aeto o3iysls2uau p u0alxrmf to1laDelu o;t teuriopoy4op nmnet t)aDtrxrp;o0apen oetyt s eanvpnt4aetnxocoodopteanvi;( sexrir3iydlptemncsat a2tax p;o1tlxnmo3iatfaDul( o;t0areoxf3oodfp r ieil(  rtm(r nu1lle mfcs sf 2ua(mo;o4tptnmf3iadfs2rl(mp u0alxrxr3tydlaD luei;s0t2uo(rpio1alt mnesls aDuau onu1tlxnmoeiadfa ua( p u4tltrmo tatoat  n i;()texo(mpiodoptn fvtltf 2umur no4alt mfcilsfsDulumo;u0tetoioctadoaDelnvolt)sexmiopoo1omen iesls srtaxm ot1alt if3tas mDrmuvsnt0 eerxociydlmDe n ols0srxriopny4aptnmnviat) rrr(r ;u4altomoetlt m2emn pnt0trermo ty1opDr u i;s0 exmxo3no4al   nciasfsruax  ot4tltnifetytla2uau on()texnxociatfpt ln o t tetoxmpny4lpen iet ()arumxmpnt1opx ifciadlm2ua( o;u4trxrif oytla rauvs;() 2tr(o oydope  nvta( srumxm ;t0aex moeiadfs2ra( s;u4teeomrciadlp rauvo;(0srxm(m3no4lp e nciat)arraxr oo4aexomf3tlt m rmnms u0texrmociytlmteai s;s)texm(r3ou1oltemncsls)s2rm(mo;t4tpxo ociaslm rln s;u4tetnxf3iydfatrauvo t srtmxrpoy4om  lfvil()sDtr(rooo4aeeomoeils a rl(vo;u0altnmo iydlp  aues t texr(o3oydop nmiesl(  2umxmont0tlxo fciydfa2elumon(0 rtrxo oatlpDr u o;s0texr(m nu4om  mivi ( a2rax o;t4aeto feiltlaDranvonu4 renxfcoy1lm eluei s)s2uoirpiu1al  mfvs t  Dum(mp;u1tptomo3iltfs2emnmo;u0texrmocoodfmD aieo;t0 exmio3iy1amenmivs ( s2rau  nu4tlenmfcild a2em(vp;u)trtnif3oo1faDr i s s  etmio oo1op  mivil(  2uaumpno0tpxo ieiad m2rlnvo;()tltrmf3oatlaDrlneil(0 euo(o oo4omtn nes sfaDurxrpno0apxnifeilt aDuanmont0 lxrifcta1lpDelnvil( teuoio ou1alte fcslt artrxroot0ale ioeiasls emn p;u4alxoxociatoaDeaies s)s2triopny4open iciltf Draum ;o4tpeo ieildls uaumon(0 rtnmf3oo1la  auvilt  exriopou1ap   ivs t a2tax p;u4tex ioetls mDua( o u) rtnio3to1lp elivs t) 2ur(rpno1llte nvt t srtmxr ;o4apxo ieiatla ua( o;(0 eerxocoydlpDrlivolt)t2uoim oudlpte iet t  rurumono0alen f3iyt mDul(monu0tetnif3oa1omD  u s ( s2uoio iu1ll n fvtl()arrmxr no1oet  ociyd s ulumo;u0 lxomo3iodlmDelivslt)trxm(m3iudlltemicias a2urxr nu1tex ioetls s2rm( o u0 etoxfcoatla ean ol(  2um(r nudope mfctat srtm(r oo0tetn octydfmDuanvpnu0artrir3tydlaDe u s t)srxoxr iydam n ncta(fsrrmx o;o4tltnifctatlaDrlnmp u)trxnio oytfp eaiei;t)sexmxmpnu1ol n nvs tfs2rr(  nu0oeenmf3iasla2rlu o;t0 etoir3tadoaD  u o s0t2urxr io1ale lfcil( s2ur(rp;o4tex mi3tyt s2em(vpnu4treoiociadlp   ivils0 2ur(m3io1ol  mfvsl() 2rr(moou4tetnmiciydlmDuanmpn(4 reoio3iydoa  auvo ()srxmirpoo4apee ieiat)s2rrx  ou1aee ifeiadfs rmu s t)texnmrciytopDe ueo;t  2uo(o oo4opeemivsas) Drm(m no1apen icild mDrmu p t0texrxo3oatopD auesls s2umio nu4am   fct t a2trum nu0apeo feiytfs2rmuvs;u4aetoifciotfat  ieols setr(m iy4olte ivi ( a2trum ;u4tleo i3tlsfm ra(vo;u0alxoiocoa1lpteauvslt0sexrim nu4omenmnvs (  2uau ont1oex iiciltfsDrmu s u0tetoirciotfp r ivs;s srtr(mpio4opeemfet tfsDuaxr nt0opto octlslsDeln s (0alxoxfciodlatrluei ()s2trio3io4optnlfvta( aDtru onu0tetoifeils a2ea(mp;u) rerxr3oy1lmt an i ()texrio3iu4olt  nei t)a2uaum nu4tle  fetldla2uaums;t0trerxo tatfmt  n o;s  rtr(rpno4lm e ivtlsf ruau  ;t4tpxo o3ildlm2uluvs t0artoir3tydoaDr ivo t0srxr(o ny1op emiesas)aDrrxm ot4tpxnio3ils m em(vs;u)aeeomo iodlat an o;() eumxm oo4lmte ivtat) rtmx pnt1alx io3iatfs el(vo u0texoxr3ty1opt au olt)srxmim nodomeelnctl(  rtmxrooo1aee iicildfm elnmonu0teermo3oatfmD lu s;() eurir3iy4ale mfcsls aDrmuroou4oeenmieildlaDemuvonu)areriocoadlat aies t)s2trxm3io4optelfcta(  2ta( poo4tleo fcilsls uln pn(0aleomr3oo1fp rau s t) rur(mpoy4altemfes t)arra(r ou0tlxnifctlsfa rmuvo (4 etnxociatfaDr uvo;t) rtrimpoo1ole  ictlt)s2ur(ro;u4apeomo3tys m2emnmp;t)aetrmr iadfm elivs;s) 2xmim ou4lm e ivs (  rrm(m ;o1aleomi3ilsfsDrmn o u)tltrif iodlp elivi;() rxmxm3iu1omtemfvt ()sDra( p;o0oex  ietldfa elnvp u)tlxrmrciotlpteli ol() 2to(rpiu4olt mnvta(fsDtmx o;u0aexn f3iydfm uau on(0 rtriociotoa rli ils)srxmxr ny1opte ict () Draurp;o0texn oetyd a2elu pn(0aexrifcoatoaDr nvs (0t2uoxo3nu4om  mivtat  Dtm(mpno0opto ieiytfm2ul( snu4arenxf ta1oa raueslt)t2xo(m3io4opee ncsa( aruax ont4tpxo o3tysfm2ua(mon()arenmo3oodlmtraivo s)s2tmio3nu1ame mnctasfa2rmx p;t1teenmiciaslmDea(mon(0 exrxr oa1oateai o;( seuoxr3oodlmtn ietlsfarraxroot0tex io3iysfs rm(vs;t)trxoir3tydop rlu ilt srtmxo io4alenmieias srtm(  no1tlt  i3tld aDeanmo u) rtomo3oodfatr neo;( seuoxr3iy4amen ivt s)srtmxmpoo1tpt miciadfs2umn o u) eeomfctatfaD ln s (0s2tr(o iu4al nmivsl(faDrmum ot4tex ii3tat mDemnvp;u4teenmrciodopDelnvi;s t2urim iudlleemfcta()artrxmp;u4aeeomf3tys m ea(ms t)trerir tydfpD an s;t  2xr(r io4opeelfvt ( aDtaurpnt0aetomiciltfa2eln p;(4arxrmf3totfpDrauvo;( srtoir nu1lm emivtlt aDtrx  nu4opx mfeiatlsDeluvp;u4texnxo3oy1laD lueils teuo(o ny4amenlieilsfsrra( p;t0alx  oeils s eln on()trerircto1fa ranvi t srtmxm nudalte ivtls sDuru ont1apx ioctyt m2rluvpnu0 rtnxr iy1latraueo;s  euoio oydlmenmnvi (fsrrax  ot1oltn fctytlaDrl( s ()trtnxfciadfmtrln olt0 ruoxm ny1lm   icsa()aDurxm ;o0aexn f3iadla2eanvp;t0 lenir iatom r uvils0 2umxm iu1opt  nviat) Drmur oo4alx  fciadlm2rlnms u)texoif3iatfpDr u s t s2umimpou1openlfvsas  rtmu  ou4tlxniieiad s rmuvsnu) ltnir3oytfat  n ols t2toxopiy1lm   nciatfaDrmx oou0tle mi3ils m em(vs t4tetriociy1oatr n i;t)t2urxm oodamtelfcslsf ruaur nt1oeenmfetldfa2ra(mp;u) lenxocoadfmDrauei t  rtoio3oo1opeemfcil()s2uau  nt4tpe  fetatfs rauvsnu)aetoio3ta1op elnei s teum(m iydopt  fesat)srta( poo4oltomf3iat a ua( pn(0alxomo ta1opD lnvi (0 eumxr3ou4omt lieil( s2urx poo4tleomociatfsDrluvo u0texnir3to1oa r u olt)t2umxm no1ol  mnvsltfs2urumo;o0ope  fctyd mDelnvp;t4aetrif3iotoaD  ivi;s)s2toxm3io4oltnliviasfsrrmurooo0optomociyd a2rmn snt4 renio3iydlmt  u ils)truo(o3ny1om elictl(farua(rpno0teeo ictyd aDulnvsn(0alxrxfciy1op  auvs;s) rur(o ny1apte netlt sDrm(m ;o0aeeomf3iasfaDrmnmp;t)trxrifctatlm  an slt)t2urxmpno1lpeelici s  rtmx  no4tex mi3iys s umu s () ltnir io1lmte ueo (0tetr(o3iy4ol  mnvsl() Dtr(m ;o0aeeo fetysfa umumo;t4altrxfcio1fp r u o;s0trxmiopou1alee ivsat  2ua(mo;o1opt iicildls eau o t4texriocoytop   u slt)texrxr iu4omt mivtatfsrrm( o;t4alxomf3tlsls uluvpnu0arxomfcoytfp ran i s  etmimpiy1olenlics tfsDuru  ou1tltn f3iysls uanms t4tlerxocio1laDeau s;s)teurxr3oydap n ietls aDtax  ot1tex iociad aDelu o t0 exoircoatlpte ivil()setrxo3no4openlieta( sruaumo;t1texoiiciltlm emnmp;u4tleoxo iytlmDrlu sl() eto(m io1opte fvt s) Drru o;o0texnmi3iyt m2emnvs t4aexrxf3ty1omtrluvs t0t2tmxo3nu1lmen ivsasfa2taumonu0opxo fctaslsDra(vp ()altnxr3todoaD aivo;s  2umim ny1om emfvtlt  rra(r ;o0tpxomicias sDrm(ms;u0 exrmo tydomtrlnvo t  exmxopnu1altemfcilsfsDtaxro;o1texnioctydfa ul(vonu0teenxociotomD  nvol(0teuoxmpnudaptemies s a2tmur nt4olx iieiadfm2emuvp;u4 lxoxocoatfm  an s;t0srtrxrpiodaltn nvils  Durumpnu0alenii3ilt m2rmn sn(0 lermfcio1omDrauvs s)s2xrxmpiy1lmenlfcsas) rtr(monu0olt mfetydla emu snu0arenxrcto1fm elneo t0setrio3iydap elfeslt  rtmxro;o1olenmo3tldfm umuvsn()artoio to1fpte ivo;t) etrimpnodllt mncs tf Dumx p;t0olxo feilsfa2rln s;u0tlxrxf oa1lmtrlu slt sruoxrpnudopen icil(f 2ra(rpoo1optnio3iyslsDranmo t0 rxrxfctytopDeln slt) rxrxr iy4ale liesas)a2umumoou4oetoiicilsla el( o u4 lxrxf oydla raiesls t2um(m3iu1olt mfvslt)srrmx  ;o1oeeo i3tldfsDrlu o t) leomo iotlatean i s0 exrim no4am  lnetlsfsrrmxmo;t0tpx moeildls rl(vp;t4altomrctotlptr u s s)trxoxrpny4apt lfvtltfaDtmu  no1texoifciysls ua( o;t0areoxf3oo1omteaivsls)seur(opou4omt mnciltfs2tmxm ;t4opt  oeiasfm rln o u4aeermf3iatfp eai o;t) rtrxo iu4ape lfesatf Dumx pou1tlx iociyd m rln pn()trxomr iodlpDean o;t seuoim3nydaptnmiei t sDrrumono4tptomf3ilsfsDrmnvs;u4aeermf3iatlmD aivo;s)seur(r iu1ll   nvt s) ruaur nt0aetn fciasla2um(mont0teerxrcto1oaDrauvs;s  etmxm3iu1apenmfetatfaDtr(ro;u0aetnio3tadfs ulumont0tlenifciy1fmDeaueil()trto(opiudamee nvsl(fsrum( oou0altniieiydfmDua( pn()trtnmrcto1omtrlues;(0teuoxr oy1alenmfeia( aDtaurpnt0alxoif3ildla2ea(msn(4 rtnirciy1fa eli i;( srum(rpoo4lpt  iviltfa2trxrpnu4teenioeiasla uauvsnu4 lerxr3oy1fp   ieo s0t2xoio io4op n nes sfsDur(r no1tlxoio3iydfa2umnmo;u)tlerio3iadfpD lu i;t0setmxmpny4opt lictl(f Dua(ro;o4tleoiictatfmDea(ms;(0tlxrxrcoodlpDrlneslt0setmxo ny1ll nmfetat  rra( oou4opxoioctldfm ulums (4arerxo3ta1fp eliei t) exrxmpou4ome  fvi ( a2umxm ou1oeto i3tat s rauvonu0aetrxr3tydfmD  uesls0t2xmxm nu1aptnlnvt ()s2rm(m nt1apx ii3tys s2ea( s (0tltoifcia1faDelu o;t)setoxopou1lp nmivtas)srumu pnu0aet  ictyt aDra(vp t) etnxr iodomt li s () rxo(r3oy1altemictlt  2ta( p;o1oee mfeildfm2uanvpnu4texnifcoydoa r u i ( t2xo(o nu4om emiet s) Dra(ro;o1oee mietasfmDelnmonu0 lxrxo tadlat lu s t) eumxopnodol e fcsas sDur(mpou4apxoiociytls rauvo;t4 rerxr3ty1oaDr neo;s0 2xoim3nu4opeelfctlt)aDur(m no4apt mo3iat a ua(vp;(0 ltnif3iotlaD aivil() rxmiopny4omeemfvil(faDrrxmonu1oexo f3iydfs2eau s;t)trtriociodlmt anvsls0 eur(rpnudlp nmfci () Duaxm ot4aeen ieiltfsDrmnmo u) ltoir to1fp elueo (0srto(r nodlmt mfetas)sDumxm ou1tpxomoeilsla2emnmsn()arermf3iy1opt auvi t)sruoxo3ny1lm  livtl(fsrrmxmo;u0aetomieiys a2umu snt4tleoxrcootopDr nvi;t0truoxm3oo4lme lnetl() rrrur nt0oeen o3tysfm2elumont)altoxrciodlpD  neo (0trxrxo no1ale  nvi s  ruau o;o0apxnmociys mDeln o ()teeomo3oydla   i o;t0t2xmxo oudlltn fetat a2ururoot0alx ifeiasfa2rm(mo;t0texomr oydlatrauvs;() rtmxo oo1lp   nesls) 2tax pno4apen fcildlm2ua(vsn(0 reomf3tadoa rli s;s) rtr(o3nodaltemncs (  Dtru o;u1tpxoiiciysfs2rmn s t0aexnircto1op rlu ilt)t2uoxo3oo4lltemfeias)a2trxm nu4olen o3ildfmDelu p;(0arxrif3iotoatelu o;s  rxrxm3iodap elictat a2tau pno4opx mi3iytfsDuaumo;t)tleriocoydoptr ues s0srxrxrpnydaptemfes t)s2rmxr ;t1oexomfciytfmDemu snu0tetoirciytfpDraneo s)sruoxmpnudllt lneslt)a2rmxro;t1alxn fciys aDumnmp;()trermocoytop  aivo;s0 eumio nu4altemfesa(  2rmu  ou0olto oeiyt a rl(vo;t0 rxnir3oa1fm e uvs;t srumio oudll nlfcsl( arum( ooo4olen fctydls rln s ()treoio3tydlp elnvol( tetoir iudal nmfvtas s2umu o;t0oee miciasfmDua(vs;u4trxnio3oo1la e u i s) eumxr3nu4optnlicsat  Drmumoou1texo f3tlt sDrmumo (4texomf3iy1opD  u ilt teumxm iudomt  icsas  2tmu p;u1olt mi3iltla el( o;u4 ltomo3ia1op elivolt)trtr(rpoydlme mieilt  2rmxro;u0oeenmfeilslm2ea(ms;()aexrmf todlmteau slt) rur(r3oodom elici sfartm(r nt4oltoioctlsfs2elnmp ()trxnio3io1opDelueo s) eto(r iydalt mnvs s) Durumpnu4tlt  oeiaslsDel(vs;u0artoiociotlmt ai o;t s2trxopoy4lltn icsl(  rua(rpou4aeeniietas s emnvp;t) etoxoctydlmt  i i t)teto(mpny1ap   netls)srua( ont1tleo i3tytlaDrm(vpnt)alenxr iy1oaD luvo (0trtmiopou1lptnlnvi (  2taurpnt1optniicild a2rmnmsnu4texnmf3to1latrlieilt0s2ur(o3ou4altnmies ( srrmuro;u0tpxn f3ilt a ulnms;(4 exrxrcoodlm e n s s  rur(rpiudolenmfvsa(fs2raumo;o0tetniieiadls2rmuvp () ltomr oa1lpteaneil(0 etoxm3ny4ll nlnvilt)s2uaxmp;u1ape  i3iasla rmu sn(0alenir3oytfp eluvo;(0s2um(r3no1llt  feiltf Drrurpnt1opt  ieiadfaDum(vp;(4aleoxf3iotlmDeaues;()srto(o oudap nmfvia()sDumu  oo4alxo f3iasls rlnvs;t0trxniocoadlp rlueo s)s2toirpio1lp  lnes t aDtrumooo1openio3iydfsDrm(mp;u)texrxf ta1oa e ivi;(0tetr(m3iy1lltnlneilt  rumu  ;o0oexnmietatlsDrl( onu0 reoxrcty1lmD  i o s0seto(o oo1llenlncsas a2tmx  ;t1apenmo3tas sDum( pn(0trxoirciodfaDr ueslt0 2uo(opou1ole mictl()arumurp;o0oltoii3ias s ulumpnu0trenmf oydfm elu s;(  rtrxo nudlpe  iet (fsDrm(r ou4aet ioctadlm rl(mo;(4 etnmr3iytfa elu i;s)teurim io1oleemfeiat) rtaxmp;o4tetnmf3ils a ulumpnu4altoxr3ia1fpDr nvo;t t2xoxm ou4amtelfes tfs2rrumo;t4oet  icildls emn sn(0 eeomfcoa1oa  livsls0 rxoxr iy4lp elieilsfsDtmxm no1tpeniieiasfa2uanvs ()altnif ootlmt aieo t0s2umxopiodlpe lnviasfaDrmxr no4oeenioctysls eanvp ()tlxoiocio1lpDe nvo () rxrxmpiu4ope  nei t) Dtm(rpno1apxoio3tasls rmu pnu4 rxoir3oytlptelieolt)tetrxm iu1amenlneta(f Duax oot0alxnmoeiltfa2eauvo;t4areomr iadlmDrlieslt)tetrimpoo1omtnlictasf rtruroot1ole  ocils sDum(monu4tlxoir ootoa rauvo;s0truoxopoo1ol nlfctl()arumx  nu1opt mfciltlaDrmn s (0tlxnmr3oodfpDeaivs s srum(o3iu1omeemnvsa(f Drrumpot1tlt io3ilsfsDeanvpnu)texomfctatfa rauei;() exm(r3ou1altn iei s s2tr(r ot1teenmociad mDranms t) renxocty1fpD aivslt0seurxo3ou4llenliesa(fsDta( o;o4aleo feildfsDrau s;t) etomfciytfaD ai o ( trtrirpnu4al  mfcsatfs2rmu  ;o0tltomo3tltlmDrmuvon(0trtrxo3iotlm rai s (0texrxm3ny4lmt mnci () 2tmum ou1oexoiieiltla2ra(vo;t)arermr oa1fp eaivi;( t2xmxmpiodop  mnetas sDumx  ;t0olx ii3tld m rmnmo;(0 ltrif3todfaDrlnesls0 2um(opoydaptnlicslt) rur(moou1oexoioetydfa rau snt4alermo tydlat luvi;( sruoimpou1lmt mfci ( srrru  ;o1tpen ietadls eanmsnt0trxrmr3iotfmDe i il( setrir3oy1ameemfet t)arur(r ou4opt if3iat aDea( s;(0tetnmocoytlptelu slt0 exr(m io4opt lnvsas) Dtmx ono4aetnio3ilsfmDul(vpnt)teermr3iodfp  aieol(0 exoim nodomte neils srurxr no0altnmfetyd m2uaump;(4 eenif3iodlp e neil()teuoiopoudole mfvi () rtr(m ot4openiiciadfsDulumpnu4 rerif3io1fat livo;s0srum(r3oo1ape mnvilt sDuru pot0tpxnmoeiaslmDelums;(4trenmo3iadoaDeau i ()setr(r iu1llee ivtat s2taxr nt4apx  fciltfs rmnmp (4 rermo oodoa r i o;( srxoir3iydope lnetl( aDtaxrpnu1tptnmi3tysfmDum( s u0tltrxf3tytomtr i s;s  exmxopiu4op nlncil(fsDur(rp;o1oexnmoctadfs2el(vs (4 eerirciodlmDrlu i;t  rxoio3ou4ll e fesls)arurxrpno4tetoii3iat s uauvpn() etoio3oytlmDrlivo s  ruoxopno1om e nesat)s2ur(mp;o4oexo ieiat a2em(mo;() renxr3iydlaD  u o t)t2tmim3nu1amen fesls)s2ta(rp;t1apto fciysls raump;u0aeermo oo1fpte i s;(0tetrir io4om elfcils a2rr(m ;o0tpenmf3iatfm ean onu4artnir3ty1fm e ivil(  euoxo oydllt  ivta( aDur(  ou1tlt mfeiytlm emuvpnt0tlxrirciadlm eai o;s tetoim3iy1aleeliciltfa2truront0tpenmieiys m2emuvs;()trermocoo1omDrlnvo;t) rur(r3oodlmeelnci t s2uau pnu0oetn o3iatls rauvs;(4tltrxrciodoate n s;s  ruo(r3nu4op   neiat)srrmx p;u4apxnif3iydlm el( p u0 lxomo totfateluvo;s) exrxmpiy4ll  lfcsasfsDurxmpnt4apxnifetasls2rmnvp (4 lxrmr tytlaDr ueo ()t2xm(opiy1opte ivi sf 2trxmoot0oee  iciadls um( on(0arenifcoatfp eaieolt)t2xoim3iu4lptnlieilsf Dtax onu4teeomoeiydfs ulnvp (0artnxo3oa1fat anei;s trxrimpiodlptelfctlt  Dtrx o;t0tlxn iciysfa emnms (4tlermr3iytoptr n i t) 2umxr3nodlme mncsat sDta(m oo0aex  fetadls2uau o u4tltrxf3io1fp eli ol(0 euo(rpnudll elietltfaDur(m nt1oee ioctytfm eanmp;u4 lenifcia1omDeaieil( srtm(mpou4lp   ieiat a2rax onu4tlen i3iyd a rlnvp t0arxrxocto1opt livi;s) 2uoxopoydlmte fvtlt  rtr(rooo0tlxnmieiasla2rm(ms t) lenifcootop eauvils0 etr(o3no4ole mivt ()aDrrx o;u0alxn ociysfm elnms;u4teenmfcta1la   ivi;()s2tr(m3ou4opt mnet t  2urx pnt1olen octyd s ul(vont4teeoif oytlaD aneilt t2urimpiodll elictat sDtrxmpno0altoiociydla umu p;t4arerir3iydfm ran s;t  eurxo3ou4olenmfvta(fa2ta(rp;t1opeomocilsfs em( p;u0tetoxr oodfpt aiei s)sexriopoydlp   ivils aDtmxmpnt1oee  fciadlsDua( o t0texoifciytfpD  nvo (0 rxrxmpoodalenlneslsfsDuax ooo0alxn ocilsfs2emumsnt4artnmr3tadfp elnvi t) eto(r oo1aptn nvtasfs2tr(mpnt4alen fcildlsDuanms;u4texoif oatopDeaieolt0srtoxo3ou1opeelicsat)aDrrurp;o1ale  octltfa ranmo;(0 reoxf3oa1fpteln s;(0 etm(r3nu4ol nlfesa()aDuax oou4aptn feildfa2uanvp;u0tlxnircty1lptr i il(  rxo(o iydam nmfesas  rumxmpou4aee ioeias s2uln ont4alerir3totoa eluesl(0trxmxm3ou1amenlnctls)a2umx ooo0opx  iciydfa ul( o;(0 lermrcoodomD  nvo t trur(r3nydomtelfetls) Dtauront0tpeomo3iys m2raump;u0tetrxo oydfmDelu s s s2xmxmpio1omtnmivia(f Dtmum ou1aee moetydfs2el(vsnu)trenmo3oydlm  li ols texmim oy4altnlivs (  rua(mp;t0oetnmicils m2ul(mo () rtoxrcia1optr ivo;(0texmirpoy1omenmncs s a2ururono4aeen feiasfmDemuvp t0trxomo3oydfpte u il()srxo(opiudapee ncslt) rtrx p;u1tpe mietlt a2ranvp;u0trtnifciatlm  lu il(0trxmirpiu1lmeemictasfarrrxm no0tlenio3iydls2ul(mp u4 lxrxr3ia1lmte n slt0srxoim3ny4amtnlnvtltf Drmxroou4optoiictad aDrmnmo;t0tltomo3to1omDe nvs (0 exmxm3io1ap   ieslt)a2ua(ro;u1opeoiietldla2emn o;u4 ltoio oy1om eaivsls0 2tmim3io1ope lnvil( srtru o;o4oeen ictasla el(vo;u0 lermf tatfp r ivsl(  exr(r iy1ll e fetasfaDururooo0ape if3ias s2elnmo;u0tlxrmrcoa1oa elivo ()t2xr(o3nu1am e fcsas sruau p;u0oetn ictldlsDel(mp t0teermf tatoatrauvi;t  euoimpiy1ole lieta(f rtr(mono0tpen i3ilsla rau o u4 exnmfcoy1op e nvo s0trum(m3nudlm n nesasf Dtrxrpno4texoiieiysls2ra(msnt4texnmf3oodoaD  n o;t) 2trim no4amt mivsatfsDtm(  ;t4ole mfciys s ran o;t0alenif todopt  i slt s2umxrpny1amee iesas  2uaum nt4tpt iietyd m ua(vs t0tlermr3ootla  ln i;()teur(m io1llenlicilt  Dtrxr ou4opeoio3tys m rmu o;u4aetomr oa1fate ieol(  eur(o3ou4ope lfvtlsfa2rmxm oo0tlxnmociatlsDrl(ms t4trtrxfciy1fa rlieo s s2xmxr ou1om nmfesl()srum(rpno0alx micias a2elumpnu0arxrmo totfa  ln s t)teuoirpoydlltnlics ( sruaxrpot1optomo3tls m rmu o u0teenxf tydlm   ueols0 eumxo3iodllt lfeslt)aDrmuroot4oee io3iydlaDrln p (0tltnio oy1om  an s t) rum(o nu4altelivs (  rtr(  nt1tetn ieildfa2uanvpnu0aeerxo3oytfpt  ivolt s2uoxm nydoltemiet ( srrmxrp;t1apxoioctadfaDrauvonu) ltrif3iodfaDeaneils trtrxr oy1lltnlict ()aruaxmp;o1alx mo3iytfmDeanmo;t4aeenxr3oy1fp  aieo t0t2um(r3ou4apee nes s srtaxrpno0tleoioctatfa2rl(mo;t0trtoxocia1fpteluvo ()trtoxm3iudamtnmnei t) 2rm(  oo4tex mfciytfa ulumo;u4tltnifciotlp   i i s0s2xmir3ny1opt micsls)arraum nu4alenmf3iytfa2uau sn(0arerxocoy1laDraieolt0sruoirpiudale mneta(f 2ta(r ot0alt  feiltlmDul(vs;u)tlxrxf oo1oaDe neils0trxo(mpoy1alt lfcta()arrmurpno4tpeoioeils s uanmp;()aexrmo3iydlpDrln sl(0s2xo(o oy4ap emnvi sf 2ra(m ou4aleoioetad mDem(vo;()altrirciotlpte i s;( t2urimpiudlmt mieslsf rrrumpou0aptnmo3tyd mDra(mpnt0 rxnio oo1fpDelivol( srurir3iy4amenmieslt)artau  ;o0teto ieild m2eaumsnu0 reomr oytfpD lu ol( s2tm(rpnudamtnlfcsa()s2uaxmpou0apxn f3ils s emuvpnu0artrmf oo1lptrauei;( s2toxm3ny1ap emneil(faDrr(ronu4tleo fcild a2em(mp;(4aeenir3iytlptr u sl( t2um(m3ou4ame  ics sf Dra(r ;o1opxn f3iyd sDrau s u4 eenif3oadfmD  i s t)s2toxopoo1lpee iesls) rtrxmo;o1tltoio3tadla ua( s;u4altrxo ootopD  u slt)s2tr(r3iydlptn fetas aDum(ronu1apxo o3tlslaDelnmo t0tlxnmo3iytopD lieo;t) 2toio3ny4olt lneta()a2umum nu1tpe ifeiadlsDulnmsn(0teeoxr oodfatrlues;s)s2tmxopno4ape  fesa( arrm( pot4oee mfeilsfm2uanvs;t0 lxnmf tytfateaiei;t)seto(o no1lpte ict t)a2um( pno1apen ociyslaDea(vo u)aeeoir3iadomtrlnvol()teuriopnu4lmtnlncsls) rrauro;u4tpxniictlsfs uaumpnt4aeeoxf3iydfp eli s;( seuoxm3iu4altnmfeiatfa2raxmonu0altoiictls a2rluvp;t0altomfcoo1fmD au il()srxr(o3iy4lmtn ieils) 2rm(rp;u0tltn fciysfa umu onu0alxomf oa1faDranes t t2xr(r3nu1alee nvs s s2urx  ot1alxnmictydfs2emuvs () eerxo tadfa e uesl(0s2umxr3io4llt  ict t) Duru  nu4tpt moeiad aDrluvo t0 rtomf3iotfp eaivo ()sexm(o iodlm   nvsls) 2uau  ;u1aptn ictytfm eau snt)aetnmfctodla r nvo (0srtmiopnydlm elncils  Dra(mp;t4opx ii3iltla ra( o;u) eenmfcty1fmteaiei;t)tetoxmpoydal n fvsa(fa2rm(m ;o4apt moeiasfs rlump u) rtnif3iytlp rlueols)t2ur(r3oodlpeelnvia(fa2rm( p;u1tleoioctydla2ea(msnu) rxnxrciy1fmDr i s (0t2to(o3oy1op  mnetat)s2rmxmpnu4tlenmoeiytls uaumsnt)trtniocta1lp  aueo t)trxmir3io1altemieta()a2tr( ono0tpeoiiciat mDua(vo ()arxomf3iydopDr neilt)t2tmxm3ny4oltnlnct t a2tm(  oo0tpeoifciatfsDrau p u0 exnmr iadfpD aiesl()t2xo(o iydaptnlieslt sDtrxmpnt0aexo ieiydfm2rlu s;u4 reoxo oy1fptrai s;t)s2tmxr iy4al n nesat  2ururpnu0aeeomieildla2rl(mp;u4alenxr ty1lateai s;( sexoio oydlp emfcs t)srururo;u1aptnioetad s2umuvp u)trxrio3iadfm   u s t)t2uo(mpiy4ole lnvt sf rrau pno1ape mieiydfm ua(mpnu0alerxr ia1fpt  ieo;s0seum(opny4omeemivt s)sDrmx poo4oet  fetasfsDra(vs;u0artrir3to1fa r ies (  2urio oydlp emicilsfsrurxrpoo0tlx ifciltls2eanvs;t)texnxfciotoptr n s;s)s2trimpou4lleelnvia( s2rrxmpou0tetnmoetat mDumumo;u) exrxrctatoa  auei;t) rurir3iydlptnlfes s)artaurpoo0alx iociaslaDrln p t4aeenxrciydomDelnvol()trtoio3oodomtn fet sfaDrmxm no1olx mieiysls umumo () etrxocoadoaDraueols) etmim oudaltemfvi t  2tr(mooo1aeenmfetls s2rmnvp;u4aexrifciotla raieslt0 2xoxo no1lmt  neias artaur ou4altn f3iasfaDemnvont4alxnxfcio1lp raivilt0 etm(m iu4llen ici s  2raxr ;t1aptn f3tasls2el(vont)arxrmf3iy1fm   ivs t0seuoxr iu1om nmfcsa(f 2uaxm ou0aeenmoetys a emnvo (0 lenirciadlatrauvo;s) rxmxrpiu1olenmieilt) Drmuroot4tptoiiciytfm uauvpnu)tlerif3tatlpDranvo;t)teurxr iodop e nvs s artaurpno0tetoioctltlsDel(vp;t) rtoxoctatlateluvo;s  2xoxopoydlptnlfvtls)arum(r oo1aptoii3iaslm2uanmon()alxomr io1fm e neo t sexo(m3no1lmt mivs s)s2taxmo;u1aptn fetatla2ran sn(0arxnmo3ty1laDr ivs;s) exmirpno4ale  iviltfaDumum ;t0tpeo o3tad sDrm(ms;(4 lenmo oatfp   neo;(0 rurio3ou1ome  fvs s  2tm( pot4teen octysls2rmu p u4treomo tytlm e uvs;t0seuoxopnodlltnlfesl()aDtrumont1tet  o3iyt a2ulnmo;(4 rtriocoydoa  luvi;( trtoxm iu1ap e ieta(fsDrrxm ;o1tptnmietyt a rl(mp;(0trtnmo oytfmt liesl( trto(r3oo4lm  mnesat  rur(mp;t1apen f3tyt mDea( s t0alxrxr tadop  li s;t s2xmxr ny4ome lfesa( srur(  nt0tltn ociadfs2emnvp u4tltrif todlp   uei t0texrxm ou4apeelfvsls)aDrm(mp;t0apt  icildfm uau o;u0tlxoxr oa1oatelnvi t) rurim3ou1lltnmneiltfs2uaumont4aexn ietlt aDumumsnu)tlxnxo3oodlmDrli i ()tetoxopou4ll   net sf 2uaxr nt0apeoiociadlaDrm( sn(4teerio ia1opt lu o;s0 ruoirpiu1ll  livtlt aDua( p;t0alxnioetatls2ul(vs t)teermr oodomt lu ols trumimpno4opeelnesls)aDtmx p;t4tlxo ieiyslm2el( s u0artoxfcootopD aues;t0s2toxm nu4lpe  nesas)sDtm(roou4aexo fctyt mDemn o;(0 rxnifctytomDrlueil()t2toxm iu4omt  ncta(f rtaxrpot4tpeoio3iys s uanmo (0 eenir3todoa rluvs t0trxm(r3iu1llee nesatfaDtm(  ;o4tetnioctydfs2rln p;(4 eenifcoodlaD aivo;()seurxr3oy1omee ict t)srrmxr nt4aexoifctydfs2um( o u) rxrxociydomte n s;s)t2toim3iodole  nvsas  rra(ro;u1olt mociysfsDeanms;t)tlxnxf iy1om  anvil( t2xoxopnudlltn ics s a2umum ou0alxnio3tldfs2raumon()aleomr3iytlatr iesls0texm(r nydoptn nvs sf 2rmx o;u1olx  fciltlm rmnmo;(0aetrmrciotfpD  nvi s s2xm(rpoy1ll e ivtl()s2tm(r nu1ope mietad mDrmnmo;t4 eenxocoadomte ivs;(0 rurxr3ou4lpenmnciltf 2ur( p;o1apt  f3tltfsDrm( p;t0altoif3iadlptrln il()teuoio3oodoltelfct t) Dtmumoot0opxo feiydlsDemumo t4 lxnmo3tydfmt livsls  rurxrpno4omte icilt aDumumo;o1oeenmieiaslaDean p u4trtoir3tadlaD luvilt) rurxopny1ol  mnesls)arua(rpou0optnifeilsla rlu p t)alermr3tatlat lnei;()srxmir oydlp elncslt)sDum( o;o0aexoioeildfs rauvp;() leomo oy1latrlivs;(0 etoir iodolen nvsatfsrumurpnt4opt  i3ildfsDean p t0aeeoioctytop  ln i t0setoim3nudam nlfvsls) rrax ono0openioctldlmDuln on(4texnir oy1fmDrluvils trxoirpny4lm n ivs ( s2ur( pnu1tlt  fctysfmDulnmpn(0tetnifciatopteaues s texrir3oo4lm elfvsatfsrurx ono1ope  feilt a2eanms (0 etnxfcoydlaD aneo t  rtmxr nodom nliet t)sDuru ooo0tpeoifeiad m2rlump;u)tetrxo iy1fa  liei s0 2urxrpno4lltnlnes t) 2urur nu0teto ieiasla2ua( pnt) eenmf3todlp eau il( srxo(o nydoltnlnci tf 2trxm ou1oexnmiciytfa emumsnt0aeeomf3iotom r n i ()texmiopoydll  lfviatf Drmurp;o1tle  feiat m eanvo;u) rxrxocoydop rlnvslt)tetoim3no4llt mfeil()arraxrpnu1tptn ieiltfaDeluvo t) etrxr ta1la   u i;(0t2xm(r3nodopenmivtls)sDumxr ;t1tltnmoctytfmDuluvont0altnmfctodlmDeluvslt0s2uoxm iudamee nvi t) Dtaumpnt4tleo oetydls el(mp t4trxoio3iydoa e uei s srtm(rpoy4aptnlnvtl()s2rmu  ou4aetomieiltls uanvo;t)treoxf iodoptraivo;(0sruo(r iy1al n fct t)a2ur(rp;u0opxnmo3iyd a2rlnvo ()aexrxr oatom   ueo;( setoxr nydopenmnvsl(f 2trx  ot1altoioctat a2uanmo;() eeoxrciadlat auvsls)srtoim ny1ome  iet t)srra(r oo1aptomfcildfmDrln o;(4 lenxr iy1fp  an o;t0teur(m nudaltnmncsasfs2tmxrpnt1oexo ietat a2el( on()teeoxf oatop  anei t) 2tmimpiu1ol   nvia()arurxmpno4olto iciyslm2ulnvont4tetoio3oydopD anes;(0teum(r oy4lptemietlt srum(m ;u0opeoiieiltls2ea(vpnt0arermocty1lpDe i s s  rxrio3iydome lfet tf Dtrumo;t1texnmfeild mDean pnt4 lerxf3oytfpDeluei t srxrir3ny1lp n nci tfarur(m ;o4tltomoeiat s emnmonu)tltrio oytfaDrln i (0srur(o ny4amt mfcs ( s2uaxronu0apxnmoeils m2rlnmsnt4aeeoxr iadlmD  uvi;t trxo(r3nydoptn ietasf rtau o;o4oee moetlsfs2eau o;(4trenmo ia1fpte ivs ( t2xo(r nu1llt lfes () Draxm ot0apx mictlsfs uaump;t) lxrxfcoa1oaDranvi t0 rtoxm3nu4lltemfcsa() rtauro;u4tleo o3iyd a ea(mo (0alxrif3ia1lmt  neils) rtoxm oo1ap   nei () rtaxrpot4oetnioeiatfmDrlu p t)texoifcoatfm elivi;s)seumxo3oudlmtnlfvi s  Draum ot1texnio3tld aDua(mo (4trerio3oadfpDr ieo s0teuoio3no1amtelncs (fs2tmu oou0tex mfciasfmDra( s (4trerir ty1omDrln s t)teuo(mpiodll   ivtl()aDrrurp;u0aet  fciydfs eln p (0tltoxr todomtrli i t0truo(m3iydope  icilt)sDrmxro;o0apenmictyslsDrmu pn()tlenxf3iytomte neo s)teurxo3nu4ll  mneia(farra(rpoo4tlen fciltlaDulumo (0arenif iytomDe u o t0t2xoim ny4lpe mietat a2tru p;t0alx  i3ias s2umn p;t)texomr oo1fmtrlivo s0 eto(mpiodale lfeiat  Dua(r no1apxoifciysla elnvs;u4arxnifcia1omDeaivi;s) rtmxm nu1lpe  fcsltf rrrxrooo4tlenifetadls eaumpn(0 rxnmfcoydoat lueils0t2umxopiy4lm n fesl( srtru poo0tetnii3tatlmDeau o t0 lerxr tadfaDelu olt)srur(mpio4lpeemietl() rraxm no1ape  f3iysfs uan p u)texrxr iytoaDeaieilt)t2urxr iu4opeemfcias) rumx  ;t0tptn i3tad aDrln sn()alenir3iadlm   i ols trto(o3oydole lnct ( a2ta(mpno1tptn ocils a um(mpn() etnxfcootfpD lueo t  exrio3oodlleemiviasfaDraur ;u1aexomi3tldlm2rmn snt0tetrirctadom r uei;s sexr(o io1lp nlieslt)sDtru ono0olx  oeildlaDrmnvs;(4 lenmo3ia1fptr iei;( s2um(r oo4om elieias  Duaxr ot4opto feils sDum(ms;()aleoir3iatfmte n il( teuoimpoodol e ictas)arta(roou1ale mfciydla2emnvo (0aetrxr oo1op  lneo t)t2uoimpoydll   fctasfsDrm( pnu0alx ifeiysfmDemnms;() lenmf iatlat an ils) 2xmxo3ou1op   nvi s  Dra(r ;o0oexoii3ilsfs um(mo;t0teeoif totlpte i o t0s2umxrpnodomt  ivilt)sDta(rp;o0opt  ictat m emuvpnu4teermr to1omt aueo s)sexr(m no4llt  fcsl(f rururpot4tpt io3iadla2rl(mp ()tlxomf3ta1fpDeanes;(  exoxm3ou1apt  ieiat)aDumx p;u1opx mi3tlt a2rl(vsnt)tetoxf oa1oate ieol(0trtmir3iodalen nvtls)sruaxmooo0ole  iciltfs eluvp;u)artrif iodlpt lu sl()s2tmxrpoy4oltnmncsl( artau o;u4oetnii3iatfm2rmuvs;u4tetomr3ootfm eluei;(0t2xm(r iydol nmfcsatfs2ra(rp;u4ole  fctls s2umnvo;()alerif3ta1lmDrlieo;(0 etmxm3oodlpeemivil( s2tr(r no1oetomfeiadfa2rmnvp u4arxomf iydlatrlivo;t  rxr(mpoy4lpenlicsat sruaump;t0tpxnmietat aDrmu s () rtoif3todlmt ln s ()trumxm iudame  fct t  2rrxr ;o1tpxnioctltfsDul(mo (4aexnxfctydlate nvo;()trurxopiydal emiet t  Dua( o;t4ole moctasls umn s;() lenio3oo1opDelivo (  rxmimpoy1am emictat) rumu  nt1tptn ietldla emnvpnt0 lxrxo ty1omDe uvilt0teur(mpno1apt mncil()srtax o;o1tptomi3tlt aDulnms () lxrir totla  lieol( setr(mpiudlmenmncs s  Dta(m ou1aetniieiyd aDea(vo;(0 exoxocoadfm  livs;t  rur(rpoo4omenmieiat)sDrm( oot1ale mo3iltfm2rlnvpnt4aeerio oa1optrlu s;t teurir3ny1ll   icsatf rrm(  ;o1oee mi3iasfaDrl( o;(0tetnmr oy1oaDelivol(0s2toxrpoo4lm n ici s  rrr(moot4altoio3iydlaDul(ms () rtnmrcto1opt anvs ()teumirpio1lle  nvsltfarumu  ;o4oeenii3tltfaDel(vsnu)tlerif3tatfm r i o;t  rxrim oydam n nci tfsrrm( pou4opx  fetatla emu pn()altnio io1fa elnvils)t2tmxr3nu4op emfes ()aDurur nt1oee mo3iyt mDum( pnt0 lenmoctotop  ai i t) ruriopoodoptnlnvtat  Dtmump;o0tle ifeiyt s2em( o;t4 rxrircoadomt lnei t) eur(opno4lmte nesa()sDumur nt1olxnmoeiltfm elu p;t4 ltrxf oadfaDe nvi;t  rxmirpoy4om   fcs sf rrax o;o0aeeomoetatfs rmnvp t4tltrxr3ty1la r i s;( seurio ou1om   icta(f 2rrxmooo0olt mfeilslmDea(mont0tetnio oytomtr ivi;s sruoirpnu1oltn fcsat a2tmu  nt0ape  f3iyd s eanmonu) etrmo iy1oaDe u s s t2urxo iu4aptemnvsltf rrmx ono0aee mi3tytla2ul( o t0tetnmrcty1fmte uvi;t) 2uoxr3oo4lmtnlivsl(  2umumpot4tpeoiieiat a2raumsnu0 exrmr iotlmD aivo t  2urio nu4ll emneil() rtaumooo1alt  o3iydfm uln o;t4trtrmrciatop  ai i t)srxrxopiu4lmen ict s  rumu ont1olxoifeias s ul(msnu0aeeoir3ty1lpt  neo;t) 2xrir iydllen ict (fs2ur(m nu4oee moetlslm emn ont0trtnmrciodoa r uei;s trxmim3iy1olte fvil(fa2tmxmpot4oee ii3ilt mDra( p;u)aetoir3oydomtrai o;s0t2tm(mpny4lptn fcsatfaDuauront0apenio3ild sDra( s;t4trxrxr iodfpt  ieilt srto(o3ny1ll emncsa() 2rmu pnu1aleniicilsfm umnvo;(4tlxrmocoytfmtr nei;t)teuoim oy4lpenmfet tfa2rax o;u0tet ifetydla um( o;() lxnxf3to1laDelivil(0t2urxo3iodal elicslsf 2rmurono0tleo oetld a2ulnvp;(0altrxr3iytlat lieo;t srumxopno1apee icsl()a2uax p;u4tlen fetatla2rm(vpn() ltnxr tytfa eai ils0trtrir oy1altemieiatfsDta(r ot4apeniictldfs2eluvs;u4alxoif iotfp eaues t) 2xm(m iy1lmtn neiltf 2urur no1opt mf3tysfm eanvo t0 reoxfcoadfat livo;s)srxrxo iu4optemfcta()a2rrxm oo4aexoiieiys a umuvp;u0 exniociadlpDrluvil() 2tmxm nodal n nesa(fa2rmum ou1apxomicildlm2umums;(0 exnxrciy1omDrlues;( teuo(r3nudapenlnes t  rrmxm ot0aex ioetasfm um(vsnu0aetnmf3todlp eau o t)seurir3nydaptn fcsltfaDtmu  ;t4tex ifcildfs2em(ms t)tltnmf ootlp raueo t)teur(r io4op  lfes ()srua(r nt4tpenmo3ils m eanvo (0teeoif3todopD  nvsls0trumxm3ou1ape lfvias  2rax pot4oeeoif3iys s uan o (4 ltnio to1fa eluvsl( srtoxr3ou4lmt mnvs sfarraxmpou0tlt mietls aDum( on(4texoxrctadfpD auei t0t2xr(mpoo1lmtemfct ()a2umx o;o4aeenioctld m rmn s;t0tltnxf ty1fmtelieils)srur(r3nodalt micsls) 2rrumooo4tee iietadlaDeln snu4tlerir3oodfptranvi;s)trtmio3nu1apeemfvsat)artau pou1alt  oetyd mDra(vp () rxnmr oy1fmDrlu o (0s2xo(r oo4ap   icsa(fsrrru pno0apt ifctytfaDea(vs;t)aetoxfcty1oa rluvilt0 rurir3oudoleelietl(  2raur ot1tleoio3ias m2em(vp t) rtnxoctytlatrauvi s0tetr(r nudamtelncils s2rmxront1opt iociydla2el( o;t)aexnir oodlm rlnvo;(0srtoxm3iodom emnvsa( s2tr( o;o1opxnmo3tadlsDrlnmo;(4 rxrir3ia1fm  lnes s  rtm(o3oo4apen fcsa(fsDtaxr ou0aetoif3tyt aDua(vpnu0alenir3oy1lmD auei;t  2xm(r nu1lp nlfvt (  2raumoot1aetn oeiaslsDul(vp;(4tlxrxrcia1optrlu ils0trto(mpiu1lltnlfesasfaDraxmoou4open feiadfs emnvpnt0areoirctatopDe uvo t)truoio3io1ol elneias  2ur( p;t4aeen fcilsfm2elums;()trxoir3io1omDraiesls setoio3nu1lptelieslsfarrrxm nt1tpxnii3tlslmDrlnvs t)tltrxfcia1lmDelu i;() rxoim ny1omt mivt tfs2tmx ono4tle io3iyt a2um(vp;() lxrmrctytfatr u sl()s2urio iudlp   nvtltfs2trx pnt1tleomiciyslsDrmnvs ()trermrcoo1fpDr u s s0texoim iydomeemiet (f 2uaxrpot0alx io3tyt a2um(mp t) etnir3ia1fateaivi t0tetrxrpno1ap   fvsa(  Dum(roou1opt mfeiatlm2eluvs u)tltoiociy1fpDelu i t)srxr(m ny1apenmfesas  Duaumoou4tptnmf3tatlm2rlnmpnu)tetrxrcty1om rai il() 2toir nu4omtnmnei t srrax ooo1tpeoio3iatfm2rmump (0 rtrmfctadfaDrauvi (0seuoir3nydapee ietlt sDrrxm ot1ape mi3tydfm eau pn(4 rxomfcto1opt  n ol( trxrim3no1alt mivs tfsrtm(  ;t0aexnmo3iytfm ra(vs;t4aetnmfciadlate neo t) rxmxm3ou1op  liesl(fa2uaxm oo1oeeo ieiysfsDea( pnu0aexnmfcootfp  auvo;s) exo(m3iodoleelivta()a2tmurpoo0opxn ieiyt m em( s;()alxomrcty1fmtrlnvsls0sexoir oodolt  fesat) 2ta(mpou1tetn ociltlm um(vo u) ltrmociotopDrln ols0 2trxr nudolenmivs ( arrau o;o1oexomf3tyd s emnmp;u)artoircoy1fpt  uvolt) exr(o iy4lltelnct t  2rr(r ou4tpxo octytfa ulnvpnt0tltoxrcoodfa rli sls0teuoimpno1lp e nvilt) Dtr( p;u1apxniieiyt s2rmuvsn(0teeriocty1opDr nvi;s srtr(o3iu4lp elfctls aDraxrp;u0open fetysfm2eauvp;(0texnxr ta1lmtrluvi s0 rtm(mpnudame lnci s)aDrau pno1altnio3ias m rauvo u)arermf to1latrlnei ( setmirpoodopee fvs () rurum ot0ale moctaslm2rmums u4tetomfciatlp eauei s0 2xm(m3ou1om  mfvtatf Dum(mo;o4oltn ictyslsDea(vsnu4 rtrxr iadfaDr ieil()srurimpoy1omee nvt (  2trxm ou4olt if3tys a2em(vs;t0tltoxo iydfaDe i s s teuoxm3oo1om elfvsat)srrmxro;u1optn o3tydlaDean p ()arxoio3oatfa  an o s0srxrxrpou1amtn fctl(fsrtaxmo;o1tetnifeiltlaDrmu p;u4alerir3tytop ean o;s0 2xr(m iu4lle  fcs sf rrmurooo1olto icils mDuln s;t)trxnmf iodoptean i;s) rxoir3nu4om nmneslsf Dtax pnu1tee  oetad a2rm( s t4tltoirctotoaD au sls  etrxr3nu4lpte ncil() Duau ooo1alx mfeilsfa2um( p u4 rtoxr tadlm ranesls0 euoxr nu4altn ncilt aDum( p;o0tpen fctysfm eanmp t4 lerir3oydfmDrau i;t trtrir3iudlle mfeslt)s2uau oou1aeenio3iatfa eln o;t4 rxoioctadfatelivs;t0trto(m3nodap emfes sf 2tmu poo4apx mi3iatlm umn s;()alenir3ty1fa ean s;()t2tm(o3ny1apte ictl( sDta(r ot0apx io3iatls rlump;u)alerio oy1om raivo () exm(m no4optnlivtls s2ta(mo;o4tltnioctlsfa2rlnvpnu0aleoio3io1lptraivo s0teurxmpnu1lltnmncil()aDrrxrpnt1texo oeildfsDea(vp u4aetomo3totlaDran ol() 2xmxo oydlp nlfvsa(fa2rrum ;u4aleo ietytfmDul( o;t4alxomf ia1om   i s;t trxoxm ny4lpeemnctl(faruru  ;o4apxn fetytfmDeanmsnu4arxnif3oytfptrlneilt)srtmio oudlm  mfvilt a2ta(r nu1oet mfetad aDua(vp;(4 renmfciodoaDeauvi;()texo(m iy1olt lnetls  2uru pou4tlxomiciyslaDrau ont4areomf3oa1latelneo;s)trxoxrpio4am nlfesatfsrrmu poo0tex io3tad s rau snu) ltrxr oadomD lneol()t2urimpnudll n net t s2rmu o;o1aexoiieiadfs em( p;(0tltrmf oytfpD  n sls) rumxopoudap eliesat arumx  oo4tltnmiciytfs el(vp;u)trtnmfciatfatelnei;() rtoim nydope  ivsls srua(m ot0tpxoii3iadlsDum(vo;u4 etomo3iotoaD livo t seur(o3no4omtemivilsfaDurx ooo4tee mociat mDuau pn(4artrxf3ty1faDrau sls t2xmim iydomenmnciatfa2rru o;u0altn o3iaslmDuln p (0aexoxr3iotlaD  i i;s)srur(r3oo4ll   fcsltf Draxrpno0tlxnifeiasfmDumnvsnu4aetnircootfmDeau i t t2xoim iydam n fesatfs2ta( pnu1aetnmi3tytfs2rl( pnu4 lxrxo3oydlmDelies (0s2urim3ny1lpe mfvilsfs2raxm no1opt mfctat a elnvs;(0aexrxf3iodlpD lieols0 rtoir oy4llte nvslsfsDtmxr ;o4aetoio3iydlsDulu p t0 etoxr oo1laDe ivi ( sexmim iudalen ieilt) 2urxr ;u1optomiciyt sDulu s;u)trxoio3tytfp r uvsls  euo(opoo4optn ncsl()sruru oou1ole  ociadfaDeauvp u0texoxfctadlmDrlivs s0s2tr(r3oo4lltemict t) 2urum ou1aexomfeiltlm2ul( sn(0 eeoxr3oy1lp eaivs;t0 etmirpnydlltnmfvslsf 2trxrpnu4opeoii3iyd sDelumon(4 etoir3io1omD livs;s0 etm(r3ny4ll emneilt)srua(rpno1oetniicilsfsDrm( ont0 leomf oy1fmt anei ()srtmim oo4al  mnvs tfarurxr oo1ape  o3ildfa2rlump u0alenir oadomDelues s setmir3ny4olt lfeta()arurx  ;o0aee  ieiadla2uan o;u0trtomr3tadoaDran olt0 rxmxr3iydamtnliet s)sDta( ont4alxomo3tydfa2el(vo ()trxrxrcoydfm elivi;t0srxm(o3ou1op e ics t)s2rmum ;t4ale miciytlm2ra(mo t)altnif3iy1latr i s s) etmxrpiodapee fvtltfa2ta(m nt0aptniiciat s ranvp u4treoxociotlaDrai slt)t2uo(m io1lmtnlfvs s)srraxrpot0ole moetaslsDrl( sn(0arxoxr oydfmtrliei ()trurim3ny1om  mivia(farta(mpou0oee io3iyt a2ra(vo;t4 ltomf3totfaDr uvo s)trxriopiy4om  lfcsa(fs2umx poo1aeeomietad a emumo;(4altnircoatfmDr i o t s2xoxr iodol e ivtl()srrrum nu4oltnmo3iatla el( pn(4aexrio iodfptr nvsls0 rtrimpoo4omeelfesas aruaxro;t0tpe  ietls mDemuvont0tlxrxo3io1oa rlu o t) etmio iodomeemivil()artm(r nu4aexnmfctys a uan snt) etnmo3iytfaDean s t) 2uo(rpnu1lmen iciasfsrtax pnu4apxnioeildfs ua(mp;t0 etnxo io1op eaueilt0trxr(opny1ole lfei t  rrrxmoot0ale ii3tysfa2emuvpn(0 renmrciy1lpDr u il()texrim no4om n net s sDtaxrp;o1tet mocild aDemnmont) lxoio oatlptrlnvsls  rtr(r oodlmeelivs tf Dtm(rpnu0tpe iiciydlsDeln o u4arxnifciydla raneol(  rxmxm oy1lmtnlnvta()s2truro;u4olen fctlsls uanmo;(0treomrciatfpDr u o t) rtr(opiu1ope mfctltfs2rr(rpoo1ape mietysla umnvs u0 exoiocoadlp ran i ()s2xoxopou1lptn nvsls a2taumpot1aetnmf3iltlm uanvp;u)texoir iydopDean o;s0t2toio3iu1optnmfvtat) Dtm( pou4tpeomfciadfaDumuvo;u) ltrxr oatoaD aueo;()seumio iu4apeemies sf 2trx o;o1texoiiciysfmDuan on(4arxomf3tytlp  luvs (0tetm(m iudap n neils s2ua( pou0teenif3iatfmDrmnmpnu0aetnxr iadlpDrlneolt  etoxmpou1opee nci sfs2trurpou4tpt mieiydls umuvon(4trtoxo iatlp  lnes s0 rtm(m nu1lptnmfcilt  2rax ont4tlxnmictasfa ulu pnu)tltnmf3ta1lpD lueilt)t2to(r3oudapt lnvilt a2rru onu1tlto ieilt sDem(mp t)aeeoif tydfaDrauvsls0 2toxo oy1lmen nesasfarraxrpou0ole  fciaslmDrluvo (0 lermr oytfm r ivo (  rto(r3nudoptnmfcsl()artmu  ;t0ope  f3tydfs rmnmpnt4 eenifciydomtrlnei;t t2xoxr no4amee ivtasfaDumu ono4alxoifciltla ea( o (0trerirctydfp rlues ( s2umim iudom e nct s arua( pot1openiociyt s2ulnvp;(0 eeoifciydoaDeanvols trxmim3oo4optn fcs tf rrrx pou4apxo fciat m2ra(vs;t4 ltrifcty1fateau s;()s2ur(o3iy1lm   fcsl(f Dua(m no0olenmiciytls2uanmp;t) reoir3tadfa elu s;t) etrxr3oy1opt  ieiasfsDtaumont0olenmo3iltla emnvo (0trenir3tydoat lnvi t s2tm(m oydll elncslt  rurum ;u1optnmocias m ul(vp t4tltnxf oadomDeauvs (0 rur(m3oy4op  mfcs t  rua( o;t1oeto fctytfmDumn s;u0 exrxr tadlm e neo;()s2uoxopou1apteliviasfarrrxmpot4aexoiieiydfaDean pnu0tlxoxf oa1fmteluvs s) 2xmio oydlp  lnei s s2tmx  ;o0tpenii3iysfm uaumo t)aetrxf3tatlmD li o t0texrxrpnu4op emfes ( s2ur( pot0alxo iciadfs2ulnms t)artnmfctadfmt au i;s0t2xmir nydopenmnet t sDururont1tleo oetas s rl(vp;u0 lermr oa1opDrlies t0seurio oy1ll  lnei s)a2rru pou4tpx mfciydfs rauvs;u0alxoif iydlaDelivs;t0trtmimpnu1oltnmnesl(farrm(  nt1openif3tydfsDulu p;(4artomrcoodopt ln o;s seuo(o oodaltnlnvtlt sruax poo0tlxoiocildfa2emn pnt4 reoxf3to1opt aneo (  2xoxo3ou1lpeemnei tf rtm(mp;u0alx iiciltfa2eanvo t) renxo ia1fatr i ols0teumxo3iudam elncsls s2umx  nu1apxnmfeiys m emu pnu4 rtoifcio1laDrlivi;(  exrxmpou4ope  fctls s2rr(mp;o0aptn o3ild aDrm(vp;(4tleoioctodlm eaiesls0setmxr3iy4amt lncslt) Dta(rpnu1tleo ieiat aDran o;t0alxoxf io1fat aivi;t  rxr(m3no4ale lncil( a2uax  nu1ale  i3iat a umu s u4 lxrmf3oytfatelnvilt0teto(r3iu1ap emictas)sruauroou4tetoii3tytla uaums;() eenmf3oa1omD an olt0 rtmim iu4optnmnvt ()sDrrxm ;u0aeeniociltfmDemums u)tetnxrctatlpt lu ils  2to(r oo4lme  fciltfsrrr(rpno4opxnii3iadfa2elnvon(4alenifcoytfmt anei;t)trur(r iodomen neia()sDtr( onu4tetnioetat m2emn s ()aeeomr io1lm eau s s trxoxm oy4al e ncsa(fartmxro;u1opx  ocias aDumuvs;t0 renio3ia1la raneo;( t2tr(o3nodop   ivtl(farurxr no1opxniieiytlm2rmnvon(0aetoxf3tydlmtrlnvs s  exmxo oy1al e icsl()aDrmuro;o4tpto fciasfa2uanmo u4treomf oadlmDeauvs;( setm(r no1apenmneil() rrru p;u0aee  o3iltla rm(vsn()aeermfctadfmtelivol(0trurxmpiy1apenlncias  Duau ooo1opx if3tytla ran pn(0trtoxfciytfat livi;t0sexm(opny1lpeemnetas)a2ra(monu4ope  fctyd m2uauvon(4tlermo totom   i s;t0 2urxm nu4alenmnetl( sDrmumpoo1opt mietlsfm eauvp (0alxoxf iadoa r ivs;t0 2to(m3iudoltnlici s  2urx ooo4texomfciytfmDua( pn(4tlerxo ia1fpDraues (  2umir3ny4olen nciat) rrax  ;o1tpxnmfeild a rlu s (0aetnmrciydfateli o () etrirpnudlltn fct ( srua( p;o1tpxomoctlt sDemu pn(0trerir totfmt  n i t0 2xoxmpiy1am  lfei (fsrtau  ou1oltoif3tytls2ulump;()treoir tytla e u o;( s2toxo oudlp   ics s s2rrx o;t1oex iicils s2elnvp u4arenxo tadoa rlies;s)s2xo(m iy1om elfctasfs2rmxr oo1apxomfeiasfm2eauvp u4 rxnmf oytfmDelnvslt texmirpno4op elnctas)sDuru ont0opto oeiyt a ranvpn() rxrmocto1lm rauvols  2tmxopiu1lltelfeia() Dumumpnu1aleoii3tyt m2umn o t) leriocoydom rlneo;s)sexr(m3oy1lmeelivsatf Dtr(mpnt4oee iieiasls um( o t4alxrxoctodlaD lieslt) etm(r nu4opt miei t a2rm(mp;t4tleomfeiyd m ua(vs;u) rerxf oa1lm  auei;t)t2uoxopnydoptnlieilsf rtaxmpot0aeen o3iysls rlu p u4artomo iy1omtraies;s trxrirpio1op e fei t) 2uax  no1aexnmietyt a ua(vs;t4arerxf3iatlpDeaneo s trtrxm oy1om n ictas s2urxrp;o4oexo o3iat mDemu pnu) ltnmo totfp  anvi s tetmxm3iydlmt mieiltf 2uau  ou1oleo f3ilsls ua(vonu0trenmociadom r ueo ()trtoxo iudape mnctltfsrurx  oo4apeo feiydfs2uau on(0tltnmrcta1faDe n i (  rxrxmpoudaptelnct tfa2umxrpnt1aet mietatfm2ulump;(4tlxnio3oy1fatr nes ()t2xriopno1lm e nci tf rtax pnt4oee ifctytls rm(ms;u)trtnif3to1lpDrlu i;(0t2toir oodolee iciasf 2trum nu0tetoii3iasfmDrlnvsnt4areoir3ta1fmtelu ols)seurim3ou4optelfcias s2uax o;o4aeto oetytls ua( p u) rxnxo tydfm   ues t  rtr(m3no1lm n fet s)sDrm(roou4altnmoeiysfm2eanmsnt)aexomrciydoatraivs;(0trtrio nudomtelieia(f 2raxmpnt0aex ifetltlsDraumsnt0 lxnmf3iytfp e neo;s0t2trir3oudllt  ici t aDumurpot1oeenmf3tadla2uluvp t)arxrif3totlpDeaivo s  rtoxo iu4aptnmfvi s sDtru pot1olxnmo3iyslsDumnms;u0 lxnmo3totfp eluvs;s)t2tr(m iu1optn ncta(f 2um( poo1opeomietlt a2uluvpn()tlxoxr3tatfaDr iei s)trxrio3nudom nlneil(faruaurpnu4aexnmietydfmDuaums u) rxrxf oatlmteli i ( trxm(o nydlp nmivi sfsrtmurpou0aptoio3tas m2rm(vonu4areomrcoydlmDelnvi s0 2tr(o3ny4llt  icia()sDumu  no4opt miciatla2rmn onu)aetrxf ootlpteaivs () exoimpoy1om nmfei tfsrua(mo;t1aexo o3tasfmDrl(vpnu)aetoxo3ta1om r ues;s  rumxrpio1lptemnesatfs2taxrono4optnmfetls s rlnmo;t4 lxrxr oa1fp   i o (0seur(r3oo4ol e ncsl() 2ua(r nt1tpe  fciadfm emump;t0tltoxo oadlm eau s;(0teuoxrpoo1alen ncias)arurxm nt1teeomo3tasfs ea( p u4artomr3oodfaD anvils trxoxr3iy4lpee ivslt  rtmumpou0tet mf3iadfm2ea( s;t)tlermr io1lm  aneo;()seto(m3oo1llte ncta(f rtau pou0aetoifctyt a el(vs () rerir iatlpteli sl()trxriopnodomenmfeia(faruau  ot0teenmo3iyslaDuaumo;t) exrif todlpt lu o;t  rxmim oy1altnlfctatfa2rmum nu1oet iicildls rl(mo;() lxnmrcto1fpD  ivols)setmxmpiodopeemfci (  2umumonu4oltoif3iatfm rlumo (4tlxrio iadoaDr u s;()srxm(m3ou4aptn fci ( a2uaumono1tex  iciatls2rl(vsnt4artrxo3iatlm raivslt) 2tmxmpny4ap   fcsa(faDuaxm ou4ale mietys m um(ms;t0arenxrctodlaDeanesls0tetoxm3oo1lm elfvtlsf 2raxmo;u4aex ifeiat mDra(vpnt4 lerxo3ia1optraueo;s t2xoim3ny1ol  lfet s) 2ta(r ;t4opxnifctatla2el( snu4 etomo oatlpt auvsl()sexo(o iudap emfcia(  2rr(m oo4alx  i3iatfs ul(msn(0 lxrmo iotlp   i s;(0 eurxr3oydlm nlfvs t s2rmu  no0texnmi3ilsla2uanmp (0aetrxr3iytop elneo;s0srtriopoodalte neslt sDtaurpnt1aet mfetaslm2rauvp;t0texrif3totfa eau ilt)s2urxr3oodol n fetas) ruax  ;t0olenmfetyd m2um(vo t0 lxriocootfpDeanvs t)texo(opiodol nmnvsa(  Dum(mo;t0tet moetldfm ua(vs;t4tleoif3oatlmtelieo;t trtoxm3nodomtemivs t aDraum ;u1tpeo i3tltfs emuvp u0alenmo3oa1fateaueils) eum(rpoudam elneias sDraxmp;t4tetoioeiysfa ua(mpn()texniocoo1faDeli ilt0s2to(o3oydll elfvtl( a2uaxmpnu1tetnmicias a2rm(mpnu4aetrifcty1lp  lueols srxoxmpiy4am n ictl(f rtmurp;t0oexomfctadls2rl(msnu4teerxrciydlpDr i o;t srtmiopoo1am  mfcta(f rurum oo4olt io3iatlm2rau p u4 lenif3ia1fpDranvi t  etm(o oy4omee fcias aDurx  oo1aeen feiad mDeaump;u4arxnmf oo1fa r n ils)s2uoxr3iydlmt mneilt) Dtaurpoo4oltniietadls2uanvs (4 etnmfcoodoaDelu o () rumirpoo1lme lfvt ()sDuaur ;o4apt ifctlslm ranvo t4 rxomociadfa elnei s0trxmxrpoodapt lnvsat  Drmxmp;o1tpenmf3iyt s2rl( s ()aeenmfctodlmDe ivols)seurxm iudlmt  ivslt srtau  nt0opx mfeiytfaDran o;t) exnmoctadfmDe n ol()trto(mpou4lleemivil( sDtmumpou4optoio3tldfm ua(mp u)tltnmfcoa1lmDraivslt0texo(rpno1op nmnvt s) Drmx  oo4oltomoeilslaDean onu4tetrif3oadlmD lieo;s s2to(mpnodameeliviat sDrrxr oo0oee  fciat m umnmon(4arxomoctotfp rliesl(  eur(m3oo1apeeliesa()sDtmu  oo4optnmiciat sDemnmpn(4 rtnifcoy1fpDelnvils trurxr3nu4aptemnetat)srta(  ;u1apeoifeiydfm2ul(vsn()arxnmfcoadfa e ivo;(  eurio ou1oltemfes (fsDtmxmo;o1olt ioeiyt m2eluvp;(0artnmfcia1lpDe n o t teuoim3iydop e nviasfsDumx  ;o0aet  i3iltfs2umnmp;u)texnmr3iatfpt li i s trxm(mpiodoleeliciat)sDtru  ;o4teen f3iadfaDrmump;t4tltrxo3todoa  lu s;( seurxopnu4alenmncilt s2rm(mpnt1tpxo fcildfa2em(vo;(0texnmfcty1fp rai s s sexmio3nu1oltnlfctlsf rtm(r no0aptnmi3tyslsDumuvs;u4tetnxf3iodopD  n il() rtmxm3oodopt  nct (  rtmumpot4tpe io3iaslm2ulums;t0 ltnmo3iytfmt aneo;t) 2xrim oodlptn nvi s)s2urx  no0tlx  octad s2ulnmo t)teenxo3totfmteanvol( s2umxopiu1apeemfctatf Draur nt1opto ociytfm2rm( onu4 eermr ootoa rln s t0srxm(r ou1apen fesas srtm(mpnu0altoiiciyt s rlnvsnu4texoif oo1opDeli ols)trurirpiodlmenmfeia( a2trxrp;o4opeomfciat s ulnvs;(0tlxnxrcoytlp  anvs;s)trtoxm nodlm emivsas)arrau pno4aptomoeiyd a2raums;()trtrir3tytopt  i i;(0srxmxo nydlmtelivia()a2urxr oo4aetomocilsls uanvsnt4arxoxo3io1fpDe iesls0 exr(m iudamteliesas s2ra(  ;u1texoifetyslsDelu onu0tlerxfctatfa elnesl()s2xo(r oydal n ies tfsrrrxr nt0oltomictltfs2em(mo u)arenxfcto1lmt an i t) etrio oudope mnei sf Draxr ou1olxo i3ildlm rmu s;t4trxnxo iatfp e i ols0texoxr oudameemnci t)srrmxr ot1apxo i3ils s2rl( p;t)artrif oydfate u i;t)t2tmimpnodlle  nesas) 2ra(moou4tle  i3tyt m2rm(vp;t0aexomfciadlat lnes () exrxr iu4llt micias) 2tmum nt0aexn iciat a2uau ont4altoxf3io1om ean i;(0s2toxr ou4ap e fvt t)s2trx p;t4oleoif3iyslmDeaump t) exoxocty1fpDelnvo (  rxoxr nudlmt lnctlt)sDur( oou1tpxnioctaslaDem(vp t0teermfcoadoa eaneol( srum(m3oodome  fvt (f Dumumpnu1tpe ifciyd a rlumonu4alxnif3oadoateli i t0s2xoxopiy1optemfes s)a2rrurp;t1oltnmf3tlt sDul(von(4aexomo to1oateauvs s)sruoiopny1lmtn fvilt  2ta(mpnu1aex mo3iyd mDem(mo;() reomr ootoaDrlu i t)t2trxopou1om  mivtlsfsDumump;t4tpeo feiat s2rl(vp u) reoir iatlpt aivil() exmxm3oy1apt  nvi ( a2ta( ont0oet mi3tas a ulumonu0altnmo to1lmDe iei;t0 exo(o nu4om  mncs t) rurum nu1tpenmf3iltla2rm( o;()tlxomo3totfmDelivo t  euoimpnu4ap nmfci tfs2uru p;o4aetoiocils s2ulums;t4 ltnmr3oytomtelu i s) 2xmxr iydaltn ict s)aDumu  ;u4alxnioetld s uanmont) rxnxocootomtrlivo (  eumimpio4om  mfetlsfsDuaxmpnt0oexo fciasfm2rln p;(0aexrxf3iytlmt au i s)trtm(mpio4amt  ietl(fsDtaxront1apxnmoeilslsDul( p;u) lxoir totlptr ivs (0srtrxo oy1al elfvt s srtmurp;u4tet iictld mDem(mo t4trxnif3iy1op  an o t0 eum(opny4omt lfct tfarrrx  nt4apto ociad a2ea(vo;u4aeeomf3tadfaDeai ols)srxo(opiudaptelnvsls arrau ooo4tetnmfcilt a ra(mont0 eerxo iydfateauvsls0 2um(m iu1lptelneiat)s2rr(rono1olx ioctldfsDrlump u4treoircto1laDr ueo t)srto(mpno1op emfctatf 2tm(r nu1oleo ociltfsDeluvp;t) leoif3to1fmteaivi;t) 2uoimpou1apt  fcs tfa2tm(ro;u1oexo icils aDumu o;u0 lenio3oo1lmtr ueslt)t2uoir3iy4ol n fei ( srrrx ono1texomf3iat a um(vp t4 rermo3tytoptraneo;s tetrir3io4oltnmfvslsfsrtmu onu0oeeoiietydfs2umn pnt) rtrio3iadfaDean o;s t2xrim no4amtelfes s)sDur( o;o1oexomi3tydla uaums;t)trxnio3iytoatrlu s s seuoirpoudape  iesa( arta(  nu1opxn ieiat a2emu pn(0alenxo oodlaD  uesl() rto(m3nodopeelicsa(  2ur( pnt1tptnmfeiat mDua(vonu)trtoxocoatomteluvilt s2xrir3oo1altnmfvil(  2rr(rp;u1oexn ictytfm2elums;u4tlxnif oatla  auei s0 2to(o io4al n nvil(fartm(mp;t1oeen ociytfsDrl( on()alxrirctodopDr ivi ()srtm(o3nu4lp emiet t arumx pnu0aeeomictas a rm(vpnu0 ltoir oadlm r i i;(0t2tr(m nu4olen fvtls) rrrumono0opxo fciysfsDem( pnu) ltoio3io1faDelnes t seumxr3no1lpee fcsa(fs2rrxmooo0oetniocilsfs2umnvo u)aeenio oytla  luvslt tetr(o3oo1alt lnciltfs2ua( pnu4ape  f3iadls2ul(mo t)trtnif io1oa e iesls0srum(r iudamee icils)artr( onu1altniicild s rln s (0 exnmf3ia1optrlneo;t t2um(o3oodlptnlfvsat)artaxmonu4tet ifctasla rm( p () ltnxr io1optelues;s truoir3oy4omeelnesa( a2tru pou0oexn feiasfmDelnmo (0tlxriocoadlp rlivilt s2xmxmpiu4lmt lfesls  rrm(mooo0altomietysfm2uan p u0texrirctatfpDrlu i;(0texm(m3nydoptn ivsatfsDraur ;o4tpto oetadfs rlums ()tlerxf3oa1lp ranvo t  2uo(m3iydomenlnct tfaDumx poo1opto fciltlm2rln o;t4aetoxr tytlat  neils  rurir ou1oltemfvs t a2um(m no4opxo i3iytfs ul(ms;u4 rxnif oydfmDelnei;() rtmir3iudap   ics t s2taxm nt1oex  fciltlmDuln o u4 rtrmrciotomt ai o;(0srurxm3nodopen fviatfsDumu  oo1tpt mfeiltlm rauvo;t4 rxrio oytomt  uvslt t2xr(m nu4lpeelfeta(f rtm(  nu1apx  o3ilsfm emuvs u)treomr3iatlmD ln s s0s2xoir ou4apte nct (  Dumur ou4texnmfctyd m um( s;t0 etoio3ty1lat  ueils  etmxo3oy4lmeemicil()a2ur(rpot4tpeo o3iysfs2el(mo;u0arxrmo3iy1lmDrlnvs s  2xrxr3oudlm   fetls)arua(mpnu1aexo f3iad mDelnvont) rxoxocoo1op  aieo t0sexriopoo4olt  netasf 2urxm ot1apeoio3tytfsDumu snu) etoxo3iatlatrlnvs (0 2xoxr nudol   ncia()sDur(r ;o0tptoifciys a ean p u4 rxoxf3iy1om elivsls)trtm(o oudolenlneias s2rrur oo0ale moctyd s2rmu pnu4aexrif3oo1fmDelu o;t trtr(r3iodol   nvsat)a2urum no4aeenmfetldfm rmu s (4trtoif3to1fp r n o;t0seuo(o3oo1ap nlncia( s2urxrpoo1tpe  i3ils mDrm( o t0alerif3totlat  uvi s) rxrir iu1apt mnct ( s2ta(m nu1olx  fciyt mDel(mo t0aeenxrciytopDeanvo;s)s2toim ny1op  lietltfsrtmur nt1tlen oetys sDuanvp u0trtrxf oy1omt  ieo t0texrxo oy4oltnlics t sDtmxrpot4tlto ietat sDeluvs t4 rtomr todlmDrlu o t0srtrxo ny4apee nci sfa2uaumpou1ape mfctytfsDrmuvp;t) exnirctytfa ranvslt0 exoxo nu4opeemfvsl(fsDtm(rpoo4tlt  fctyd a rmump;(4areoxfcoodlmtelueolt setmim ou4lptn fci (fsDtr( poo0opto i3iltfsDra(vp u0 reomocoatlptraueo;( teumxopio4ameemncslsfsDua(m ou4tpxomietltlsDem( p;u)alxrxf3oa1fp eaueolt0trtrir ny1om n fvsa(fartmx ont0oeeniiciasla2rm(vp;u0aetoif3iodfa eanes;s tetoio
\ No newline at end of file
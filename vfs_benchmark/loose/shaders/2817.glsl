@@ -0,0 +1 @@
+nes;( truo(opio1lltnlieiltf Drm(  ot1oexoifetyd a2umn on(4aetrir3oy1om rau o;t t2trirpny4lmen ict ()sDtr(  ou4tlxo o3iydla uauvpnt0trtrio oytfp r nei;s  rxmiopiy4lmeelnvslt  2raurpot0texoio3iltla2emnmonu0 eeomociodomDe ivil(0s2xmxm nydlmtemfeslsfartrxrpno0apeomiciaslmDulnmonu)alxoiociytla  lueil( trxo(opoy4al nmivi sf rtrxm ot0oetn ieiasfsDemnvo u0 eenmr3oa1fa e ueolt  euoxo no4optelfvi t  Dra(moot0tlx mi3iytfs uan pnt4 rtoif oodfp  luvols)trxoim nodom emicta()sDra( pnu1tpt io3tls sDumnmp;t)artnxfciadfpDeauvo t  2xrio ou4apee fvil()a2um(mp;u4oex  ieilsfmDul(mp t) eeoxfctydopt luvol( t2umxopnudll e nvia()a2rmump;o0tpeniieiyslsDuln ont0trtomr3oodlm r nei;t  2xoxmpno1lm n ietlt)arur(  no1apxoifetltfa uln p;t0aetomr3to1lmDeaneo;() 2xmir3iydamt  ncta(fsDtmxro;o4tetnmiciasfm2em(von(0tltnxo oatfat  uvils0 2xrirpiodllenlieias)aDur(m oo0oexomocilslm2rm(mo;u0 etrxfcoodop r ueo;t0sexo(r3ou4am e fvsas  rum(m ;t0ape mietltls umums t4altnxfcta1faDelivo;t) eur(r3oodlp nlneias) rtm(mp;o0apxomf3tasla ulumo u4tlxoir3iodfat anei;s0 etoxm iudome  fes ()srumx p;u0tpen f3iytfs rmn s;t4alxnmfcoadlpDeauvs;(0s2xoxr nu1ame mnetls)s2rrxr ;u4tptnioeild aDem(vs;t0 exnir3iy1faDrlu o ( s2toxo3iy1lmeelicil(f 2uau o;o4opxoiocildls2uanms;(4trxrir iadlp rai o s0 rxriopiu4lm nmivs t)aDtau p;u4tpen ieiat aDrmuvp;(4teerif3oy1oaDean i;(0s2uo(m no1olee nviatf Dtm( o;u1ole  oeilt a emn p (0alxoxociy1lmtrln s;s)srxmirpnu4lp nmfcilt) 2rr( oot4olt  ietysls um(vp u4artrxr ia1lmDran sls)teuoxm3oo1optnmfcsa( artm(  ;u4texoiocilt a2rmn s;t)tlxoxo iodopDraneils t2uoxmpio1lptelics tfsrra(ro;o0oltoifciyt a eau pnt0aetnmrciatfmt luvs;()trumxopnu4op   nes s)a2rmum nu0apeo f3iadfmDra(mo (4aetnmo3ty1la raneo (0 rxr(r3no1lp  lnvtls a2tmxroot1alt moeilsfm uanmsnt4trxomfctotfaDeln i s)texmxo oydlle lnvils) rtru  ou0opxn f3tas a2ulumo t0 etrmrcio1fat auesls srxriopno1alte fvs (fs2rau  oo0apx mi3tytfa eauvsnt4 etrxr iatfp rlneol() 2tm(r nydomenmiciatfsDrrurpot1tlxoifeildfm2rlnvp;t4 rtniocootfptrlieo;( srxo(opoydomtnmfcil(f 2taum nu4oee  oetltfaDemu ont4tleoio3totlp   n ol( trtr(opnudlpe  ncsls)sDrau o;o4oee  fetlt sDeaumonu4tltoxf3iy1lp ran s;t s2to(r3nudol nlicsatfsDtaum no1tlxnifeils aDra( sn(4artrmf tatlpDr nvs t0s2tmxr3iodlmtnmfeta(  rtaumont4tlx ioetydla rlnvp u0alxrxociodfaD anvilt)trum(r3ny1omtnlncsas arua(r ot0apxn i3iytfsDumn o u0 rxoif3oytfa   ieil(0t2uoxm3iy4lm elictas)s2ua(  nu4oeenmfeiadlsDum( p;(4texoxf3iytlat auvs;s0texriopoodomtnmnvt (  2rrx ooo0oltomo3ild aDraumonu)trtnmociodopDelneils)setr(mpoodole  nvia( sDtmu pnu1opxn feiytlmDrluvp;() exomf3oydoptelneols t2tmxopny1op   nvta( sDtrxm ;u4alx  ieiadfmDrlump;t4altnxo3iotfa   ues t) exoir3nudamenliesl( sDtaum nt1oeen o3iatlm ua(ms;u0 ltnmf3iadfaDe uvs;(0srurim3oy4lpenmncs t)sDuru pno4teen o3iyt m2rlu o t0trxomf oydfate n o s setr(r3no4lmtnmncta(fartau pno4tptniociytfm2rmu on() rxnxf tydlmDe uvs;(0 exm(r3ny4lmee iviat)srra(mp;u1aeen ieiatls2ul(mpn() rxnxf oo1fp r nvi s t2xmxo3ny1omen fvsatfsrrrumo;o1opx  fciltfm rmums;t0trtrxf oodlmDrai i;s0teumxr3ny4amtn ieia(f Dtr( pou0apt mieiytfsDuluvo;u4treoxrcootomte nei t  etrxm iydlp  mnet sfartau oou4aex  f3iytls2elnmonu4 exrirciydlmDr nvilt)trtr(o3ou1ap   fvslsfs2tm(roou1aex  fetatlaDul(vsnt0tleoif io1op r i o t  rxoirpoodapt lfcs s) rumump;t4aexn o3tyd s2umnmo;u4tlenio oodom  ln o s0 2xo(r iodll  lfesat)arrau  ;o4aet micildfm rm(vp t) lxrxf oytlatr uesl(0 eur(r3nydlme  fei (  Dtmxrpou0tpto f3iysfs2emn p u4 reoxfcoodoa e u s;( texriopio1omenmivil(  2tau pot4aeeomieiatfm2uln pnu0tleomo oydoaDeln slt  rtmim oo4ome  ictas sDurum ;u0tet mo3iadfa2ea(vo () etnxr3tadfmDrlu s;t)s2xo(rpoydamenlnetl()artaxrpno1aetnmf3tld sDrluvp u0teenif3iy1lpt li ilt)t2uo(mpiu1ol e feil()aDuau  ou0oex  ociaslm2ean on(0trtrmf3tytfat ln s;t0s2ur(o ny4lm  lfet t aDumxm ;u1texo fetat aDea( o (4trxnif oadlmDelu i t trxr(o3nydam  mncsl( arumxrpoo4tltnifctls aDrl(vp () lxrmfciadfpDr u i t)srtoio3ny1lmeelict (  rurxmpno4aeeoiieiysfm2ua(vs;()artnxf3io1fa r n o ()trurxopnu1om n fetlsfsrrr(  ;t1apen i3iad m ranms u0alxrmr ia1op e i sl(  2trimpnu4amt mfci tfs2tr(m ou1tltoiieiysfaDulu ont4altrir io1la   uei;s) etoim no1ale mieias srururpoo4tpx  o3iyt mDeau s u4 etrmo3ia1lpt  uvil()seum(m ny4ap  mfeslsfs2tmurpnu1tlx iiciyslaDuaump;() rtnxrcoo1lp r iei;t srtm(mpoodomte iesasfaDua(rpno1oeenii3iadfmDem( p;t0aexnmo3oytfp elnvi;t0 2xm(m io4oltemicils)aDtau  ou1tlx mfeiasfm emnvp t4 eerif3tytfaD lues;s0trum(m nudlp   ivtat)sDrmu onu0texnmoctas a emn on(0areomfciydfp   uvo;t)srxmxr oudol   nciasfaDtaxmo;t4olt mf3tydfs ean snu)alxrmo3oy1fp rauei s)srxmxmpny1lm e ivslsfs2ua(rp;u0alen ociadfs rmuvs (4aexoir tydom   n o;( srtrxmpoydope miesatfs2rrum ot0tltn i3iatfm ean s;(4 ltrxr3iatfm e ieo ()trumxm3iodlme mfeil()sDra(ro;u0tle mfeiaslm el(ms;u4 rxrif3ta1lat  nvsl(0srum(r iodapee nvt t  Dra(r ;t4opxn ieilsls2ulnmo;(4tltrif oa1opD  u ols s2tmimpiydam emfvs (  Drax pot4aptomocildfm ua(vo;()artrio3iotopDeli i;(0s2xoirpiodoptelneta(f 2rm(mpnu0tlt  ocias aDeln pn(0tlerir iadomteanvilt0 2uo(r3ou4lm  mncs sfartmur oo0oex  iciatla2ea(vs u)tleomocta1om e u s t  euriopiu1am   neias)srtaxront4tlx mieiatfs eauvp;(4trxrxo oa1opt an s ()sexmxrpio1lpt mfesltfa2raurp;t1tlx  f3tasls el(monu0aeenmo3ta1fp  lueo s)trxoxo3oo4lmeeliesl()aDtrxrp;u4aexoiietaslaDrauvpn(4aexnxr oytfp  luvi s texrxr3ou1apt  netlt s2rr(  no0aptomf3tlsls ulumo u4aetrxr3oytfaDr n olt0 rxm(m3nu4am nmfesa(f Dtmx  nt1tpeniieiyt aDelumo;(0 lenxrctydomteau o s0t2tr(opiodapt mnvt s) 2ra(rpno0teeo oeilsfs2umu snt)texoir3ia1lm raivi;() exmxr oy1omte nctl(  2uaum ou1aptnmiciatfm2ua( o (4aexoio3totfa   n i t  rxrxo3iy1oltn fetas) 2rmurp;t4tptomoetldlmDea( snu0trenmr oodoa rai slt0trxmim iu4lltnlfeslsfsrtauroot4aet ioeils a rl(mont0trxnxrcta1lpt anvol()s2xmio3oodapeemiesas)srtaumoot1openmieiysfa emums t0alxoio iotomDrauvol(0 etmxr ou4aptelnesat)aDuaumonu1tetnmf3ias mDra(vonu)tlxrxfcto1lm elnes s0 eurxm3oy4lpee nci ( aDur(ronu4aee  o3ildls rl( sn(0alxrxf tytlm raneols)sexoir nydal n iei tfaDuaxmono1apxomictatls umn on(0arxoio iodlp r i o;(0texmiopio4lleemfeias) 2trx  ;o4tpe iieiydfmDea(mp t)trxomr tydom   uvols0t2tmxm oy1op nlieias  2rmxmont4texnmf3ild m rl(vo;()artrmf ootfp e u i (  rxoxrpny1lltnmicil( aDra(m ou1aptnioctat s2rm(mo;t4teerio to1opD  n sls)texmxo3ou4ap n net (farurxmonu1opxnmfciad m em(mp u4 etnir iadfm ranes s) 2xrxm oydlme mneilsfsrrrxm ;t0opx io3ildfaDumu onu4teenir3oydopt li sl()s2trio no1op n ivs sfsDua(  ot1aeeomfeiytfs2emu on(4tlxomf ta1fpDe i o;() rxo(o3ny1ome  nvtatfs2tm(  ;u0aex  feilslsDua(mp;()tlenio3tytlmtrli s t)srxmio3ou1ol  lfcsl( s2raxm ;t0tpeo fetydfa2umuvsn(4alxnmf ta1omte uvsls0trxr(r3ou4lp e fvias aruaurpnt4opxo ocildla rau s t)alerxfciadlpDr u o;()trtmxm3iy1ole mfvsl( srur(  ;t4ole moeiasfa2uluvpnt0 etrmf3tytoptr u sls) eur(o oo1lm e nesltf rtrxrpno4aptnmieilt s2rlumpn(0trxnmr3ty1faDraieil() rxoimpiudoleelfci ()a2uaxrp;t1aleomi3ildfaDrl( pnu0tlenif oytfmDe uvslt srur(r oo4lptelncslt)sDtaum oo4tpen ieiyd s eau o (0 rxnmf oytla eli ols0 2urxo3iy1omtnlnctasfaDtrx poo1apeoifetltla ra( pnt)trtnmrcty1fat  n s;s0texrim3nudom  mnvtasfaDurx oot4alt iieiatla ra(mp;(4alerxo3tydlpt luvs t)s2tmxrpny1lmenmivias) 2ta( ooo4tpxo ictatfm2uauvsn()tltrmociodfatrai o s) 2trxr3iy4al n fvs t  rrr(  nt4oetnio3iytlmDemnvpn(0treomrcoadoat lueo ()t2to(m oy1aleemicils  ruau  ;u0tptoif3iatfs2eanmsn(4 lxnmociatfateai sls  2xoxo ny1ale licsls sruax ono1opx  oetyd m uau p;t0arxnmf3io1fp elnei ()texrxo3nu1alenlietas) rrmxmpno0ape ifetydfs2ran o;()tlxnio3oy1op r nesl(0 2urimpoy1lpt lfvi ( aDua(mp;t1opeomoeias m ua(vp t)tlermo ty1fpD lieo (  exmxr3iu4ome lfcta(f 2rrumoot1alt ioetatlsDemnmp;u)artrxr3iy1lm   n i;s0 2xo(m3oo1open nvslt aDraurpoo0oet  ictasfmDum(mpn(4alenioctodoat luvil(0trxr(o ny4lpe  fvsas s2uaurp;t4olt if3iat aDuauvs;u)tetniociy1om   nvo t)setmxm no1alt  feta()srua( poo4tleoifeiysls eln onu)alxoxo oydfatranes;s truoimpoodapt lnes s aDrax  nu0aptoio3iytlmDel(mp;(4altnxfcoytopDeluei;s)seuo(o ou4alt mfcs t) 2trxr ou4apto ociyslaDuln on(4arxnmr3iatoa ran sl()t2trim oy4omenlics t)artrump;t1openioetadfm rlnms;t0alermfciatfp ranei s  rur(r nu4apenlici t)sDtau p;t0opeoifciadfa2em(mo;(0 exomfciadfp ranes;(  2xmio3no4amenlieslt aDuaxrpno4optn o3ilsla ua(mp (0alxoxf3iydlaDr u o;t  etr(o3ou4lle  ivi () 2ur(  ot1optn ieiadfm ul(msn() rxnmf iodoaDrau s;t0 2uoim ny4ape  nciat arumxro;o4tee  icilsfm rm(vsnt0altnxf3tatopDr nes ( s2urio iu1al nlfet sf 2uaxrpno1oex iocilslsDemu p (0 leomfctadlaD livo s sexo(m3no4openmics tfa2ur( pou0aeenioetlt mDrm( p;t0aleomo oy1opDeau s;t0trxmimpoydopt  ivilt srumx p;u4opto icilsla eau o u0tlxoxf oadlm  an i () etmxr oodomenlivilt) 2rrxm nt0tleomieiadfa2rlu on(4 rxrxfcoodom r u i t  2umxo3oo4lmt mfvs sf Dumx oot0aptn f3tldla2uau pnt4aleoirciadom r ivo;s)sruoirpiydll emict sfarum(rono1oltomf3iadfs2rau o (0 eenxocoo1op e nvs ()texr(m oy1al  lfcta(fs2rmu ooo4olxomfeiltfm2em(msnu0tetrmociotfaD ln o;t  rxm(o nodlp nmivta(fsrrrxrpnu1tlen feilslmDemump t4 rxoxf oadfmtranesl()trtoxopoydomtemivia()aDtaur ;t1openii3ilsfs2elumsnt) etoxf3ty1fpDr uei;()s2trxr oo4op n ieslsfarum(m ;u0apxo o3iasfs ul( p u0treomrcoytomDean sl(0 2xr(m3ou1ol n fes t  Dua(mo;o0oexn oeiltls2el(vp;(0 etrif3iytfmD au s s) exmimpiu4om n ncil(  rtrum ;t0altoio3iys m2el(ms (0 exoxo3to1opt  uvslt) 2xo(o no1lpee ivta(fs2uru p;u4oeto icilsfs2ranmpnu) rtnir3ootlmD aueols0trxoxm3iodamt  ies () Dtr(r ;t1olxomfctld mDra( pn() ltnir ta1fm  aieo;() eurxrpio4omte ivtl(fa2tauro;u1aleoif3iytfs rl( ont)trtomfcoydlpD au il()t2ur(mpiy4alenmnvs s  2uru ont4tlt  icilsfm ua(vs t) ltoir ootomDeai i;t)teuoxm3iu1am nlnctlt) 2rm(rpno1altoioctas aDeauvo t) lxrxo iotlptrlivolt s2trxm3no4lpt licil( sDraur nt4aptn fcias a emn o u0tlerxf3oydlpDranes;s)teuoim nu1ome lneilsf Dtmumpou0tpx mieiytfm rm(vp t4tlenif3oadfp ranvs ()t2urir ou1opt mncs tfa2ra( o;t1tlx  o3iadfm emnvs;t)texomr3oatlm elneilt)texmiopiu1lp nliciasfartmxm oo1tpxniiciaslm2ra(vonu) renio3iodoaDrlu olt  rxrim3nodaltemnvt tf 2ur(mooo4texn ieiltfm2elums (0teeoxr3oa1omtrlu olt) 2tmxo no4apt  ncta(faDtau ooo4teenmfciasfa uaums t4 rtomfctotfm elnei t0srtr(o ny1amenmictlt  Drax  no1ope mieiat sDean o;u4 ltomr ta1la  aneolt0s2tmimpiy4lp e nvia( s2tm(m oo0aptomfeiydls rm( p;()trtoxoctodlmD  i i;t s2toiopoydlmt livtlsfs2umu pnu4olt mocilslaDra(mo (4 rtnxocoodlmtraneil(  2urir3iy4ameemnvsat)sruau  ;t0apeoiietltla2ul(vs u0trxnxr iatom  an i ()sexr(rpoo4omeemneilt) rrm( pnu1olxomiciyt a uln o t0arxrmocia1lmDeln slt0 etriopno1al  miesat sDrrum no4tetnmociaslsDuanmp;u0 exomrcoatop eau o;s trto(mpny4lp   icsas s2rru pnu4tltn ietldfsDeaumsnu0tltrxr to1lp  luvols0 rtmim3nu1lptemfvslt)a2tr(  ot0oetnifetyt a em( sn()altnxfctotfpDrau i;() rtoxrpiy1ope  neils  Dra(r ;o4tpt mo3ild a2eanvonu0altnir ia1lm ran s;() rxrxo3ny4openmfcil( sruaxm ;u4tlxo f3iadla ranmp;u4 exrmociadfaDeauvi;s)tetoxm3iu1ale licta(fa2urx ooo1opx iiciytfs2rlu pnu)texrir iytla eaivo t  rumirpoodap  mnctas)sDtaxmoou4apx  ictatfs2rau pn(4aetrmfctydopDe nvol() etmxo io1olt lnes s)s2uau  ot1tleo iciydlm2umnvont4altrxocoadoaDrai o t) rxoio iy1llt mieil( s2rm(moou4opxomf3iad a rau s t0 rxrio3oo1la  aueo;s0t2ur(rpio1ol emneta()srrm(  nt4oetnmieild m emu o ()teeoxfcia1lmD ai slt)t2uoir oodaptnmncsls sDtaumo;u1alx mfetys aDrmumsnu4 reoif3iadfpDrluvi;s tetmiopoudol e fvi tfarrm(  ou0oex ifcildls2uluvo;(4texnxrctodlaDe u i;t  exm(opiu4ole mneias)s2tm(mo;o4tpxomieilsfs2eauvp;u0alxrxrciodlp   iei;t s2xm(r3oudoptemfvils)artaxrpnu1texnmiciadls2ua( s u4 etrxrcoodfp elneils0 2uo(m oudolt  nes ()a2uaxm no4aexo i3tas sDrlnms () rtrxocoadlpDelueslt)texoxo3no1omt mfcsas  2raumoou0opxnmfciltfsDrlnvon()artrmr3to1op  ln o;s)trxoxrpno4apee nci t)sDuaurpot0apxnmf3tat m emumo;t4areriocoytfmDe n slt)teuo(m ou1ape licsls  2rrx  ou0ope  oeiydlsDua( p;u)artnif tadom elies;s0 rtmio io4ll   ivtasfsrtaum ;t0optnmo3iys sDrmn o t0tlenif tytlmt aneo ()t2xo(rpnu4amee ivtlt aDurxm ;o0tpen ieiyd sDumn pnu)teenmrcootfm ranvo t)teurio3oo1ll e fcsa( a2rrxm nt1tpxn fctlsfa2rau s;u)treoxf3iy1fatr ueol(  2trio3nodopt  fvtl(farrmur ;u0tex  i3tlslm2uan o;u)tlxrif iy1fpDrluvi;t0s2xmxm3oo4lm  mncslsfa2tax  ou1alxn oetadla umnmpn(0treomociodfateluvi;s0s2trio oydlp nlneiltfaDtmu pou4aleomi3iltla2ran o;u0tlxomrcoy1oat  uesls  eurimpnudllte fvtat)a2ua( pno1altnmi3iysls rm( s;t4 ltrxfcia1lmt anes;t0trtmim ny1amte ieta(fa2urxmo;u1aee ioeiat s umnmp;t4artnmf tadomte i sl()t2um(opiu4lm  mfvtls)s2rru  ;o1tlx ioctltfaDuanmsnt)teenio3ta1fp eluvi (0sexo(rpiu4al nmnviasf Dtrxmpot4aleoiiciys mDelums;(4 rxnir iatopDr i s;t0trxrxm3nodap e netlt s2ururo;u4alxo oeiad s2em(mon()aexomfctotlp elivo ()sexmxo iodoptnlivsl()arraurono4oeen o3iyt m2ua(mp;()teenio ty1oaDran s;t)trtr(r iydam   nes s aDrmx  ot0tleoif3iyd m2um(mpnu)artrmf3ty1om rauvs;t0t2uoxrpnu4lp e fetat)a2uaxm no0ope ifctlsfaDemumsnt0arxrmo iadfpDrlieslt0srxr(o nudlltn fesls)aDur(mpno4alxnif3tldfa rlu pnu) rtrmfciatlptr ieolt texo(r3nodlm nmfvtat aDtax pnt1oetoifciys mDuaums;(4tlxomf3iotlmDr neo;()truoir3nu4al  lfcia(  Dtrxronu4oltoioetasfs ulnvp;(4 lxnmfcoytom   u s s0 eur(m iu1ol nmncsl(f rumu  ot1tleo ociysfaDrm( s;u4aetnxr iatfa  aieols0 ruoxm3no4omee fvi t  2ururonu0aee  oetltfmDea(ms u0texnmr oatfptrlu i (0texoirpnodaleemivtls sDta( ono0apeo fciyt s2emnvp;()trxrio oodomtrai olt)t2uoio3oy1al emivsltfarrmx o;t1teeoiiciytls em(vonu)tltnmo totfmDeanvs;s0 etoir3ny1omenmicta() Dtr(mpou1oexo o3iatls2eau o t4tlxoio3totfm   uvs t0s2uo(mpnydlpee fviat aDtmum nt4olxo ocildfa rau snu0trtoifciytfmDeli s;t)trum(mpiydal  mieia( sDraumont1oleo ieiltla emuvp t)teeoio3oa1oaDeluvi s)setmxrpnydam emivtas)srta(r ;o0aeeoiictasls uanms;u4texnifciy1lmtr n s t0trxmio iy1ap n netatfs2tauro;o4tpxnmfetatfs emu s u4arxnio3iy1la rlueol( srxmimpio1al  lnctatfsDtm(r no4oetnioeildls2uanvonu0 etoxr3ta1faDrlu o;t sexoiopnu4ap nmnvs t  Dra(m ot4oeeo f3iasfsDeauvp (4artomociodfm  ln i s0 exmxopiydomenmfcsl(  Drau ono4tpx  ociydla2umnvp t) renxf3iy1lpDr u i t  rtoxr nu1lltn nei t  Drmxmpno4ope ioeiadfa el(vo;u)tlxrmociydop raivilt0tetoxm3iy1lm e ieilt aDtmx pot0aetn ietysfm2emumo (0aleoif3oatoatrau s;( tetmim3nydlp elfviasfsrtaumo;u0alxn ieiasfa2ea(vs t0teeoxo to1opD an s t)s2tm(o3io4lp n fci tfa2rm(m oo0tlxo f3iat a em(mo;t4texoxr3iydfp e ivils0srxrim ny4olt liviat)sDtmx  oo1tet ifciyt mDra(mo t) renifctydlmt liei;t t2um(m ny4ap nlnvsl(  Dtr(r ;t1tlt io3iyslsDrauvs;t)aeenirciy1fmDeauvsl(0teur(m no1oleemivt t)a2rrum no0teeniictltlm em(vs ()tetnmrciotlmtrlneolt0t2xoir nudapeelietltf Dtrxrpno0alenifetadls2ua(mo;t)arxnmr tydom   uvs s trtmimpoydomtelfeilt sDum(r oo1tpxnmfeils s2rau ont)aetnio3ty1lmte ivilt  2xoimpiy4llenlfvt t) Duaxro;u1oexomfeiatla elnms;(0arxomr3tadfpDrlivslt  2uoiopoy1lm  lnctasf rurx pot1altomoetaslaDel( pnt)aeerxr3oodla rli i;s  rur(m nu4omt lnet s  2rrx o;u1ale mf3iatfa2elu o;(4 ltnxr oatoa rlnvils tetoir ou4amtnmieilt)aDta(rono4tlxnmocias sDuluvp u4altoif oadla elneo;() 2tmxm oo1open ictl(f 2trxrpnu0oexoioetysfm el(mp;(4tlenxrciadlmt  ivi s0tetmxmpoudop   feta(fsDrrx  ot1aeeoii3tls a ea(ms;(4alerxf3ootlptr n o;t0srur(mpiodopt lfet t arrm(mono4teeo ociasfs2rau o;()aetrmf3iodlpDrauei t)seur(m3iu4altelfcilt)sDur(mo;t1tet ifetadlsDrlu o ()alxrio3oydfm rauvo;s) etr(r iy4apt mivia( artr(  no4olxnmieiasls rmnvo;(0tltrxr tatoaD li ol(0sexo(o ou1al n fvi t  rtmu pou4texnmf3iatfm2umu snu)trxrmf ta1faDrauvo t0t2xrxr3nydlpt mneia()srtrxr oo0tpto o3iat a2eauvpnt)tleoxf iytlpD  uei t srurio nu1lp   fcs () rumump;u1olxn oetlsla2ulnmonu) exoio3totfmt  ivs s0t2uo(m3iy4om nlnvtl( s2uaxr no1oeeomi3iyd m ra(ms;()texoio ta1omt li o t s2xoiopiudam emnesa()a2ur( o;t0aptn fctad m rmnvo;(0 rxoio iatlp rlnvslt0 exoiopoo4amtn iet t)arurur ou1alxn fcild a elnmo;u)altoxrcia1fmteaueols)s2toiopiydam emici () Draxrooo1opt ioetasfaDraumon(4 rxrifctydlpte u o s) eto(o oo4oleemfciasfsDrrurp;u0teto feiydfm uanmonu0aexnif3iadfptr i ol()t2to(r ny1am n nct sfaDurumonu0olxn oeiysls umu s;(4altnif3ty1lmDeluvsl()trur(r io1apt licia() 2umx ooo0teenioctldfs emnms (4 reoxf3oydopDeaivil(0 2um(r3io1ol e fct () rraumpnu1ape  fctldla2um(mo;(4 eeomo3ootoptraivilt0setrxmpoydom nmncs () 2umurpnt0ale  ictlt mDemnmpnt0 lxnmfcoydfm eluvol( truoir3oudllee fcs t  2tm(mono1aeenmictld s2ulu s;(0alxnmoctatlate uvslt t2um(o3iodom elivi t)s2taxrpot1aex iicilt s ua( p;t4 exnmf tydlm e u i;t  2tmxrpou4olte ics ( aDrm(  ;u1tlenmfetldlm2rmums;t)alxnircty1omt  nes s0t2xmxr3iy4am  mnetl(faDtmumoou1tex micilslm2umu pnu4 rxoxrcoatfpteluesls)trxrxr nudope liesl(faDrrx pou0oeen o3iyd s2rlu s u) eerxfctatom  ai s;t t2toxopou1optn ivt tf 2rmxmpou0alen fcilsla elums ()tleomrcta1optraueils) rxoim3oy4lptnmfesl( a2ra(rpnu0oet mieiyt sDrmuvs (0tlxoircoydfpteli ilt s2xrxr3iodole  nes tfsDum(mp;t1aee  i3iytfa2ua( o;u0 renmf ta1latrlnvil(0teuoxrpiu1lme mictasf Dur(m oo4aptomi3iyd s rmnmo;t)trenif3io1om   nes s)trtmio io1ol  lncslt  rumum no0oleoio3ilslsDra(vs;u4tleomo3iydomtelieo s)texm(r3nu1lp   fet tfa2trumono4alxniieilt mDrlnvp;(4areoxr oydfa  aneil()trxo(mpno4ll nmivtl() 2uaxmp;o0tlxomi3tadfsDemu pnu4 rxnirciatlaD aneols0s2xrim3ny1openmnvs tfarua(  ;u0tptoiociasfs elums;u4arxoxrctadfa rai s (0texoio iydlleelfes ( sDtrumooo1aetoifeilt aDumuvo t)trxrxf3todfp eau sls  euoir3nudapen fcsasfarrau  ot4apeniieils m uau o;t) etrmfctotfp   i il(0trxo(o oo1amtelicsls) ruax  nt4alt iieiydlm2el( p;u0 lxnmr iatlaDeliei;( truoirpiy4ap  lnci sfsDur(rp;u4opxomi3tytfa rm(von(0trxoxfciodfaDrauvo;()srumim nodllen nctls a2rrx  ;u4alxoif3tldlsDrlu p;u4tetoxf oo1fmtranvi t) rurim iodopte fci t srtmu pnt4oexomoeiys s2um( p u) exnxr oadlptraieil(0 2ur(mpiodlpe  nciat  ruaumpnu0olx  f3iadfa2ul( snt4trtoio3tatfp rluei;( srxrxr3oudam   iei s)s2rmxr ;t0aex mi3ildlm2ua(vonu0arxoxfciytlatr ivo;s s2xm(m3oydale mnvt () Drru  nu0aleo f3iad a2emums;u0tltrifciodoaDelnvs t0 exr(rpiy4om n feiatfaDur(mpno4aetnioetadlmDrm(vp (0trermocoo1lm  aueol()s2xmxm iudlme  iciltfsDrr(mo;u1opt  oetlsfa2uau p u4tltrxr3totoatrau s;t srto(o3oy4lltelfctasfsrtmum oo0oetomf3iyt s2uln p;u0trtnifciadlatrau i s0s2uoxmpio1amt licsltf Dururo;u1oltn oetlsfa rlnmp u4 rxoir ia1lmtrai i;( s2uoirpio1lpt  icil()arrruroou0tpeoioeiysls uanmonu0 rtomo3iy1lptr ueo s0s2tm(r3ny1ale mici (fsDrmxmooo4aee mietadls uauvsnu)aeeomrcoydfat aiei s)t2um(opoy4omenmnvi () 2urx pnt1olenmf3iydfaDuluvpnt4 leomociytomD auvil()teum(o3nodolt  ivils)a2urum nu1aex mfciadfsDemn snt)tleomo ta1op  au i;t0seumir ou4oleelivil( aDum(rpot0tlenmocias sDrlnvo;(0artoxr tydlmDrlieil( srumir iy4al n fes ( aDrmum ot0apxomieiadla rluvs;t4 rtomo3tydfpDeau s t  eurir oo4om elneilsfsruru  no0tpxomieiltfa emumo;(4 etoxf3iodfa eluvo;s  eum(mpnydalt lfesa( srtaum ;t4alto fciadfs eluvs;(4artrxrciodomDe u ol()srtmxmpny4op  lfes s  Dtr(rp;o4teen ieiasls2rmu o t)teenmociytopDeai olt0 2xmxo3io4alte fct t aruaxrp;o4oetnif3tatfaDemnvsn(4altnmrciytop eaneilt0s2tr(mpoudop n iviatf rum(m nt4altn ietatls2rmn s;()aeeoif3iotfpDeanei (0 exo(mpoo4aptelies ( sDuax p;u4olxn o3tls a2eauvp t0 rtrxo3oy1fpDeli i;s trxrxm oudoptn fcs (  rtm(r nu0ope if3iysfm umu s;t4 lxrmrciydlpDeaiei ( t2uo(m3nu4am emiesa(f rtmurpno1opt mietytlm2rmn snt4 eermf iy1fatrau slt) rtrxm oy4ole mnetas)sDtrump;o1tpxnmfeiat s emnvo () ltnir iadlate uvo;t  rurirpnodap n fcs tfsDrm(mpot0apxnmietytls rmn p t0 rtrio3io1oa r uvil()s2tr(m ou1lptn iesltf Draurooo4ole ifciatfsDrau pnt0tetrmo oa1op rli s s0teur(o3ny4om  mnciatfaDraxrooo0apenmietydfm2rm(monu0 reomf oodomDe uvs;( t2uoxmpou4oleelnci (fartruroot1tlt ifeiltfsDelu o;t4 eerxf oodom  livsl(0trurxm oo4lp e fvt (  Drm(mp;t0opxn ieiaslm rln o;t0texomo to1fmDr ies t0 2tmio iodape  ies t)sDtm(mont4oexniocilsfs2rlnvsn(4alxomr oatfpDeauvsl(0t2uoir nodole  ivt sfsDuau  oo1tpxo f3tatls2uan o;t4trtrmf3oytlaDr neils0t2ur(o nu4apt  nvilt s2raxm ou1tptn i3iyt m rl(monu0 lxoxf3tadfp r n o t  2tr(mpiudlm e ncsat  Dtrxmonu1apeoifetys s2umuvs;(0tlxrmociy1fp r ueo;()s2toxr no4al nlnvi s) rua(mpnt0tlxo f3iyt mDua( o u4altoxr todlm eanvo t t2xrio3iu1al nmfcia()arua( pot0tlxomietlsla ulnmon(4tlermo iytfm r nvi;(  rur(m ny4olt mfvt sfarraxmo;u0oexomi3iyd mDrmuvpnu0trxrxociy1lp raieilt0sexr(o3no1optemictat) rrm( pnt0aexniociadla raums;u) rtnxr iytfmDrln ols setrir iy4llenmfcsasfaDtaxm ot1aet ii3tld s2uluvont)tetoif3ty1om  anvs ( sruo(mpno1ol nlfesas)sDrrurpou0tlxomiciysfaDrm(vp u0arxrmr3oadlptelies t)srxoxr3nu4ape  net (  2rrur nt1aeen f3tasfs el(von(4trtnmr3oodfpDranvs (  ruo(o3ou1altnliei s aDumumonu4oeenioetyd m em(monu) rermrctydlm e neolt0 rxm(r3io1opt  fei sfartmx  ;o4alt mo3tat m rmn s t4aeeomrcoatlmD ln o;s)sexoxm3oodope lnesa(farraxr ou4tpxnmoctyt s ea(mp;(4aeenxfcoo1om elnes t0setoxr3ny1amt mneslt srrrxrp;o4opxn feiytlm2ranmo u0alxoiociodopDeluvilt seur(m io1llenlfvsat)aDum(m ;t1oexn ietldlsDea( snu4 rtrxr totla  liei;t)t2xoir oy4optn fcil( aDtax oou1tetnii3ildfmDemums t4artrxrcoodfaDeauvi;t)sexmxo oo1am e ies t arrmum nu1oee  o3iydls2emu sn(0 exrmf iy1laD aneo;s)s2xmxmpny4aptnmivtat) Dumxrono4tlt mociyd sDrlump (4aetnmoctatlmt  nes s0trxm(m nudop nmivtlt)a2ua(r ;u0ape moeiyd m emn snt)texrxr to1fmDrln olt  rumxr io1al emnci s)s2rm(roou4aexomfeiyslaDeau p;u0aleoxf oydomDrluei;s0teuoio3oy4lmtnmivils s2ur(mooo1tpto fciyd s2ranvs;u)texoircta1oaDe i i;s) rur(m3nudlmenmfcslt)sDrmumo;o0apen i3tydfs eauvsnu0tetrif3to1laDrlnvi;t0 rxo(o oudom  lfctas s2uaump;t0tle mfciad mDeanvo u0 rxoir tatfm  livs;s0srto(rpiodap n fcilt sruaumpnt4tlt ifcildfm ranmsn()teenxocia1lm ean i s)trurxmpoo1lm emivsat  2ta(rpot4aet mfeildlm2rluvsnt4arxnmf ia1fmtr n ol(0 2xo(r nodlmtemncils)sDur(roou4alx ioeilslm ran onu)trxrxfcoytlmD ln ils0 ruoxo3ou4apt  iei s)a2uaxrpnt4tpeo f3ilsfsDrmnms;(4tetrifcoytopt  ueslt)trtm(rpoodalt micsls) 2rax  ;o4apxn o3ild sDeln s;t)areomr3tatomteanes ()tetr(o oydom emnvs s)a2raumoou4openifeiltla2emn o ()alxnxr io1opt lu o t trxrxm3oo1am  liei ( aDrrurpnu1tpeoiicildfs2ua(monu0arenifciadfpDrlues;s) etoio3oy4olee fctl(fa2raxmpnu0apxniociytfmDumn o (4trxoirctydlmteauvs () etoim iy4opt lnctls  Dtm(  ot4aptniietydfa ea( s u)aeeomrciy1opt  ivs t srxm(opiu1lp e nci tfaDurxrpnu4alenioeias aDuluvo;t4 eerircia1fmte nvol(  2toxmpoodom n netl(fsDtm(rpno0ole mo3tldfs uan p t0 rtoir oydfmtraivi;()teuoio3iudap   netlsfsrtruro;t1olenmictas a2umnvo;(4artoiocio1fatr nvo (0 2xoio3iudal e iet tfaDrmu pou0opx ii3ild a el(vp;(0aetomr iydom rauvo;t) exmxrpnu1olte ivsls)sDta(m ou0aetn f3tydfs umuvs;()texniocoatlaDe nes;t)t2xoxr3ou1lp  mfctas arua(  ou1tptnmi3tltlm elnvo t0texoioctodomDraivs;s  rum(o3oo1lmen neil()aDrr(m ;u1opt mi3tas mDrmu p;t4areomr oydfaD lues;(0tetmim io1optnmfeta() Drau oot4aexn f3tydfs2ulu o;u4 exnmrcoa1fmtr n s;(0setoimpou1lmtemfvs (fa2ta( o;u0olt  i3iasfm elnmo;t4trtoir3tadfate ivo;t sexmim3oudaptemnct sfarra(rpno4texomi3ils mDrln s;u0 renio oy1opte uvslt)srtr(opoo1altnmnvi (  2ra(rpno0opxoiieiad a rmnmont0 renmf3oo1fpte ivi;(0 2trxr oy1olte iesa(fsDumxm nu0tex ifeild aDemnmont4tetnxo oo1omD aivo s srxm(m3oydlleelncsatfa2umxr nt0tlxnio3tlslmDeaums t4trtrio3tatop rluvil(0 rumxm oy4alt lics tfa2urum ;t1teenif3ildlmDulu o;t0aleoxr3iadfmDeai s;t0teur(m nu1ol e ivsl()sDrrxroou4tpeomo3ild s ulumpn(0aeermf oy1fp eau o;()trxr(mpno1lp  mfvs t aDuaxro;t4oleo i3tatlm rln o t)tlerxo ia1fatr nvilt0srxmxm3oodapen fes (  rrrxroou1aeto f3iadfa2ulnmpnu)tltoir3ty1lmtelneilt) rtoimpny4lp nlfcsa(fa2urxmo;u0altnif3iytfaDuau pnt4teerif3iodfm eliesls0teuo(rpny1lpee fciat) rum( o;u4aetnmoeiat m elumo;()aeenir to1optraiei;t0srxriopoodlpen nvtl(faDuru ont1oex mi3iydfa ean pnt4aeeomfcty1omDraneilt) rxrio nodom emieta(f 2rmxro;t0apt mfetydfmDel(msn(4tltrxrcio1la e u o t)t2tmxr iu4opt lfvi t  2rrxmo;o1teeomfeildfs2rau s;(0 exoircoadfatrlieslt0trxmim3io4llt mneilt)sDtmuront4optomo3ilt m umumsnt)arxrmf3iotfp eluvsl(0 2tm(o iudom nmnvtl(  Dtrurpnt4aexoifeiatfs ea(von(0 ltrxrciydomte neo s srxoio nu4alen neias  rtr(mo;u1tpxomfcilt a2emn pnt)aleoxo3oy1fa e uvsl(0seum(opno1ale  ncias)sDtru o;t1tptoiociytfaDuanmp;t) etrircto1oat ln o t0truo(o ou1alen fctat)s2rm( pnu0olt  oetlsfmDrau p t4 lxnxr3ta1lpDeauvo ()seur(o3ou4openlncta() Duauroot0altnmf3tydlsDumu snt4altomfcoadoa  lies t truoxm3oodap n icta(fsrrm( onu1apto f3ilt a raums t) lxrmrcoa1faDrai s s)sruoxr ou4amtn ivsls) Dtaumonu1opt mieiysfsDuanms (4 etomr3ty1fp e nes;()srur(r3iu4ol nmfeia() Drm(moot1olxnioetatlmDranvp;() reoxocoa1lmtrlu i;t0setm(rpou1ameemivilsf rtrxrpot4ope  fciadlm ea(mont)aexnmrciytfmt  uvs;s trumiopiu4lme  netasfsrumu pou1ale mi3taslm uluvs;() lerxo3ia1optr ieolt sexmio oo4altnmfctls) Dtrx p;u0tptomfctldfaDra(vp t) rxomf ty1oa ranvo;t  exoxo3iu4ape mivtl( artau oou1olxn ictld aDeln s;(0teenxf totopDrlnvs t)tetr(rpoo1optnliet s) rtmx  ;o4oee mietadfa rm(msnu)trermo iytfa  aneo t trur(r3iu4lp n ncsl(  2rr(mpou4alenmfeiysfm2elumonu)alenio iotlpD ln i;s)tetrxr3io4lptelfvtatfsDtmurp;o0olen fctytfs2el(vsnt0treoxocoadlmtelneo;t  2um(mpiudomt mivsl(f 2rrxro;o0tpxoiietld s rmnvs u) lxnirctotlpDrau ols) rurxrpiu1ap  lnctls artmxmp;t4tpeo oetatfm2rlnvsn(0 eenircty1lmDr nvs s0 2xmxr3iu4lpe mnesas aDrrxrpot0aleomieiyt mDrlumsn() rxnmrciotfm raivolt) rtmxo oy4ol  mfcs t a2ta(rpoo4altomocildla2eanvonu)tlxoxf oydfa  anvo;(0tetmxopiodlptemiet s) 2ururp;t4opxomo3iytla2eau p t)trxniocoo1la e uvo;t) rur(r3iu1ll  mivsa( arra(m oo0apen feils m rlnmpnu0 rtnir3to1lpDr n s (0 rur(o3ou4opt livsas srtrx ono1apt iieiadla2eanvs;u) rtrifcoydoa elues ( seurimpno1alenmnet (fartaurpnu0aeto i3tatls rauvont4texnxr3oatlmt an sls  2trxm3nydapenmicsat)aruru  nt1apx iieiltlmDeau p u) exnmr3ootoa eauei;s) rtmio3ny1op e ncs (  Dua( pnu0tpeomieiytfm ea(ms;u4arxrxr oydopt luvi;t0seuoxopno1lltnmnvia(fs2tmu o;u1aetnmf3ilt sDuluvpnu) lxrmocoodoatean i;s0s2tmxmpoy1omen fctat srur(rpnt4aeto i3ild a rmnms u0alerif tytfa eauvi;t)sexriopiu1ape  nvslsf 2umur no0tetn fciys s2uln s;u4 eenmoctatoaDeanvo s0sexrxr3oo1oltelfcsl( sDtax o;o1aet mieilslm elnmo;t0 rerxoctatfmDr nvo (0s2xoim3oodape mfvsat) 2ur(rpnt1ole iieiasfmDelu o;(0altoio totoa rlnvs;()texmir3nodopt mnvtatfs2ua( o;t0oee ii3iydfaDea(mo;()teeoxrciodfpDrai s;()t2tmir3oudll emncias) rraxr ;u0aex mi3iatlaDrmnvp;(4 lenmr3oatlmDeai s (0s2trirpnydll e fvtas)srtaxr no0oex  f3tldfs2ulnms;t4tltoif3oa1latrai o t0tetoxr3nodlm e ivtls artmurooo1alt  i3iadfmDua(ms u0teenmr3tytfm eaues;t0 rxmxr3oydam emnct ( s2taur ot4oexn ocilsfa2elumo;u4tlxnmo iotfatrln s (0tetr(o nudam nmivslsfa2urxro;o1opxomf3tldlmDel(mo;u0texoir3ootfpDrau i;t)tetrxo3iu1alen nvi s) Drm(ro;o4optomoctlt m ua( s;t0 ltoxocoy1optr ivi;s)s2trio nu4lptemiviat  Dtmumpnu1aex mi3iltfaDrauvon(0 ltrxo3ia1fmt aneol( srxr(opny1ope mnctas s2urxmpoo4aleoio3ild m2umnvs;t4artrxocoodoaD lu o t0t2xoiopiu1lme  ici (farrr(ronu1opt  f3iltfm2rmu ont)tetoxr3oy1oaD aivs ()srxo(mpny4opte fetasfsDur( pot0olx  fetys s2elu s;t4aeermrciydfm eli s s0 2xrxm3iodllee nvtas aDtmxmpnu1texn ociydls2ulu o (4tetnxrciytlatr neo () 2xrxmpoy1opeemfcs ()a2rrumonu1aleomoeiatlm2rauvp ()arxrxr3oy1fm   uvo;t0 rtr(mpnu4ame lfviat) 2trx o;u4apxoioctyd aDrlnmpnt) ltnmf3ia1fp ranvi;t  eto(r ou4omenmiei ()srurumo;t1tet iietld s2ua(vpn()arxnxrcoydfpD  nes;t0t2xm(r oydomtn fvsa(f 2tr(mpoo0apeomf3tytlaDem(vo t0arxnmr3iadfptraivs;(0 etoiopiy1al nlici s)srrrur nu1apeo fetls a emn o (4 rerxf3oatfmDrlivsl( texoio3oydapt  fcsas aDtaxroot1oet iiciat sDel( snu0trtrmocoo1fpteau i s)t2trxm3nydap e fesas)s2um(r nt1olxo oeiyt s2rlnms u0 rtrmo oadopD lnei (0 eur(r3oudol n net sf 2ua(mp;u4tlx  iciasls2eauvpnu0teerxf3iadfate u olt0srtoxopou1opt mfeias)s2tmx  oo1tpx  feiydlm2rm(mo u0teenio iatfmt  nvs ( t2toxm ou4ope liet s)arra(  ;t4tlt mietlt s rlnms;u4tltnirciatlp eaueolt)t2xo(rpiydol  mietls)s2tm(m no4tlxn ietlsls eln onu0teenmf3oytfa e neo;t0srtr(mpoydomtelnci s aDurumooo0oetnmfcils m2ua( p;t0texoxrciadla elu s;s)srxmxopoudlleemnetat) Dra(mp;u1ale  f3ilsfmDea( s u) ltnirciydfaDrlu s s) exo(r3no4om elfes ( a2tr( p;u4ope iieias aDean p;u0artrxrctydlp r ivo s srtoxmpnu1lpt lfvsas)sDumu o;o4olen ieiydla2emnvsnu4trenmfcoatfatrauvs;t0teto(o io1om nlfei s arrmxrpnu0apenmf3tasfa rlu on(0 ltrmo tatlaD an i;t  eurxo3oydlpeemfvils) rtm(rpnt0tpeoifciasfsDrauvo;()trtoir3tydopDraivs t0 2xmirpiu4ll emfcsl() Dtr( oot4aleomi3tadls2umu p;t4 rxomo3oatoatr u s t)setrirpnu1ape lfeta( srtr(  ;o4oeto oeilt aDrmuvp t)arermrctatlm   nvsls) etr(o3nudam  mfci (  ruru  oo1aeeomoetat aDua(mon()trxriocoadfa e u s (0 eumirpoy1apenlivs (fs2urxm ot0tet mo3tat s2uan o (0 etrxr ty1oaD  i s (0trxmim iydam nlivs tfs2tax  oo1tee mictadlsDrm( o () ltrxoctytopDe i ol(0setr(r3oudap e neils arumu  ;t1tlxomfetls mDea(mon(4tlenio iodfp ran s;t)s2xmio ou1opt mfvils  2tr(mpoo4alt  ietadfs elumon(0alxoio3io1la  luvs t0t2toxm no1ole  nvil(f 2tr(ro;t0oee ifeilt a2ea(ms;(0artnif io1optrlnvi s)t2xr(opio4lmtemnvtlsfarrmu pno0opto ociltfmDelnvo;t)tetoxf3io1fpDe uvs (0 2xm(r iodap elncs t  2ra(mono0tpt ioetytfs em( o;u0aetrif3oytomtr ies t t2uoxopiydapee ici t  2ta(rpnu1aexnmi3ildlm2uaump;(4 rxnxr iodlmD  neslt0 euoxm3iy4lm  mfeil(  2umuro;u4oexomi3tys a ul( s;u) lxrio iatlpDrlies t t2tmim3no1aptemicta()arrm(rooo4aeen oeiys aDua(vpnt)tetrxo oytfmD aivslt0seuo(r3iy4lptemies t)sDtrum ou4tpx if3iydfmDra( o u)trxrmf tytlp e n slt  etrio oo1am emfvsa() rurx ont4tlto ocilt s2ranvpnt0 rerxf3ia1oa   iesls0 rxoirpny4altnmnvtls)aDtm(  nu1tpt mieiysfs ul(vs t0tltnif3iatfptr ivs () 2xmxmpou1amtelivi ( aDtau  ;o0alxnmicilslsDeaump (4 rermr iatomt luvil() 2uoimpnu1omeemfct s)a2rrx  no0aetomieiadfm ul(mont4tlxnxocootoa elivs;()srumxr oo4ole  ivs s artaur oo0alt mo3ilt m emnvp;(0tltoxf iatoa r uvol(0 rur(rpnu1ame mnvsl(f rtmxrpoo4olt  o3tadls um( pnt0 rtrif iytfaDr ueols teumxo iudamenlfcil() rurum no0opx miciat s rm( p;t0teeoir tatopt li i;s)t2tmxopnydlm  lfet s  2rr(ro;t4ale mfctad mDrmuvp t4 eenirctodfmtrln o;s)texm(opiy4lp   nci tfsDtmx ono1aet mfetatlaDemu o (0texnxf3oytlaDelieilt)setoxm iudllee ieil( a2uru onu1tptnii3iatfaDrl( s t) etomo iytfa e u i;t) exoxr oy4lle  ics t arrmumpoo4tpx  fcild s2em(vonu4aetoifcty1lmteaieols)seumir3oy1llt mfetls a2umxr ;t0tltnmoeiasla2rlnvo u)aexoiocoo1fate neo ()s2toxm3nodal  mfct t)srrax  oo0aeeoifciaslaDumuvs t)treoxrcootop ran o;s)seumxopiu4omee feslsf rur(mp;u1aee iieiytlaDel( p;(4aeenmo3tadfpt livsls) rxo(r nudlmt livil() 2raxm nu4tltoioctydfaDeanvp;t4arermfcty1optelueol( s2xm(m nydlpt mnetat)aDrrx o;u4apeo octysla2umu s;(4trtnmocio1lp eli s;s) rtoir3no1lp nmnvslt  2rmxroou0alxnmi3iyd mDranms;t) ltrxrcia1fpDranvilt  etrxo oydlmt lfes s) Drrum nt0apx if3iatla2el(vont4 exnir3ty1lmD livols) etrir iy1op elnvilt)a2tmu poo4ale if3iadlm eaumo;()texrxf tadopD luvi (0 exoir no4lmeelivslt) Dtm(r nu1teeo f3tadfm2rau ont0altrxfcoytlm raueil(0 2xm(r3oo4op e neiat)srurx  ;o0aex  octadfmDrm(vs;t) eeomociy1lp ran ilt0srxrxm3iydal  mictls a2ra(  oo4olxnioctad sDranmo;t)tltomf3totlmD  ivi;s0 etr(m iy4aleelicsa(fsDtm(mooo1apeniictadla umuvp (4trxrif3iadfm ran ol() rxmxo nu1optnmncs t)srtrurpnu4alxn iciys s emnmo;u)areoxr ootlpDe ies s)tetrxr io4altn nesa(  2ta(rp;t4tlen i3iys mDem( o;(4 ltrmfciy1omt lnvs t0 eto(o nu1op e ieils) Drr(  ot0tlt  iciaslmDum(vo;(0 eeomf iotfp  lues;s  2tm(r3iy1op   feia(f rtrumpou4tlxnmf3tat m rluvpn(4arxoir3tytfmDr uei s  2umxo3no1am  mnetlsfsrumumont1altnioctyslmDulu o;t0 rtnmfctydfpDranvi s0t2xrim3no4oltnlneia(fsDrrum nu4oexnmfctls s rl( ont4tltnmr oy1om rlivo;()srxoxm3oudlptelncs s)s2trxm ;u4aeenmfeildfmDrmnmp t)tleomo3totlatr u olt)seto(o3no1optnlnes t) rum(  ;o4tptn o3iytfs rmump u0 rxrxf3to1fmtrlueo t  exrio ny1al   fcta(f Drrur nu1texoiocilsla eluvont)texnir tatopDeai ils0teuo(o ou4ape livta(fa2ua(monu4tlx  oetlslm em(mp u)altnmf oo1fm  lues s s2xoxo io4aptn fcsls aDtr(  no1aetnmociydfmDulnmpnt4arxoir oydfp e ivo;s0 2to(r3oy1ap n fvt t) rrrumpou0alxniiciyd sDrauvp;(0aetnmfcia1lmDr uvslt)setrir io1olee ictltf 2ua(  ;u4apxn o3ildfmDel(vp u) exrmocoytfpte u i;s)s2um(o3iu4al   feilsfsDurur nt1oetoif3iyt aDuaumon(4 lermf3oa1op   uei () eto(m iudamtnmfes s srta( ooo0tlx mieiadfs rlumo u)trtrmo3ootfpDe ues;t) eum(opny4altnmnei tf rurx pno1olxnif3tytlmDran o;t0altnmociodfm e u s;(0t2toio3iydame mnetltfa2um(mpot4ale  o3iysfs2rlu o (0tlxnxf3iotfpDraueo s) 2uoim oo1ope  iciatfsrrmu  ;t0tlt mieild s2ul(ms t4aeerxr3tydlpD  nei;s teumim3oy4lleelivs s sDrrurooo0apt ifciatfm2eln p;t) ltoio oy1oat livi t setrimpny4olte nctat)aDtrxrpou1tlx ioeiadlsDuanmo u4 renmf oydoat lneils t2um(r no4om  mfvs tfarta(mpou1tlxnifeiydfsDea( s;u4tlxoifcta1fmtelies;s) 2umio iydomtnmnvilsfsDuaump;o0oeeomi3ils mDrmumo u4alxomf3tytoaDeaivi t0 eto(m3iy1opte nvtatfa2trxm ;o1tpenif3iytfa emnmsn(4trtrmr iotlm  lnesls) 2xrxm oudoleemfviat)sruax onu4tlt  ocilt s rmuvp u) exnxr3iotfateau o;t0 2um(m iodlm  lfcta() 2ururp;o1opeomo3tlt m2eauvont)trxnmrcoydla r nvo;s)sruoim nydolt mnci s)artru p;u0tptn ieiltla ea(vs u) etoxo3oa1omt auvsl() 2uo(r oo4am e nes t arurx o;t4aetnioetatfm2umu o;u0 exomf3ootfm eaivi;s0 2um(o iodapte fes sfa2rrxr oo4tpx ioctyslaDrmn s;u4 exnmfcoytla elnvi t) rxm(m oudop emfesls  rrr(  ou4apeomi3iad s uanmo ()alxoif tadfaDe neo ( teuoim io1ol elicsasf Durur nt0tee  octat s emumo;u0trxnxrcoy1oaDeln il( texoxr3iy4apenlfvtlsf Durxrpot0alenmfctls a2umu o;t0trtnxr3to1opDr u o;()srtoim iydlptnlnet t srrrum no4tet  ieiysfaDeauvo (0aetoio iadfmD ai s () 2xrxmpio1amt  ieiat sruaurp;u1opx mfctlsfs eln p u)texomr3oadomtrln i;t)srxm(opio4ap e fvilt sDrau o;o1oleomf3ilslm rlumonu) renif3iotlaD aneolt s2xrxmpio1lmt  fei t s2tau ooo0oetomieiydfmDra(von()tlerxr3ta1fpD  n o;() rxr(r ou1aptnmivtl( sDrrum ot0oltnmf3iaslmDra(msnt4trtoiociodfmDe nesls sexoimpou1alen ncs t srrax pnu4ale io3tatlmDem( o;u4aeeoxf to1latraivo;s trurxopnodlm n nvt tfsrrmxr oo0olt ii3iyd sDumu s (4tlerio3iotopte uvslt)s2xmxr no4lpte fvi s)sDtaur ot0apx iieiasls emnms;u4 rxoio totom e nvi ()teto(o3nudomee ncia(faDtaum no1tptomiciasls2elu p;u0aeermf3ty1faD ai i ()s2uoxo oo1ol elfcsa(f Dtax pot0texnmf3iadls rmn onu) exnxo tytoaDeauesl(  rxm(r3nydam nlfci (fsrrm(  ot4aexoifciadlm2emnmo;u)trxoxo3ia1latrau il(0srxo(o nodal emfcil(f rta(r ;t4oee  icild mDrauvp;t)areoxocoodlaD ln o;()trtrxm3io4opeemfvsltfs2tmur nu4tpt ifetad m umu p t)arenif tytoa eanes;s trur(o nudamte nvsa(  Dtmu oot0alenmocias aDuau s;t4artniocia1lp eauvslt0t2um(r ny1ope  nei ( artm(ronu0tpenmfeildlm2uau o;t0alenmo3oodoa e ieo t s2uoim iydome mivil(fsrtru pno4aetomfciysfm ranvsn(0 renir3io1om r u o;s0srto(o3oodllte fcta()s2trur ;u0teenmietls a2rln p t4artrmr iydoaDr i i;t s2xo(mpoo4ome lnvil()arua( ooo1apxn fetasfm2ean o;(4arenxocio1lpDeauvs s) 2uoxr3iy4amenlncslsfaDuaxmpoo0opt  o3tltlmDrl(vont) rxnxociydom elieolt seumio3oy4altn fcta( aDraum nt1apx  ieiyd m2em( o t0alxrxrcoo1fptr uvi;s)trto(m iu1ap nlfviatfsrrau pnt4aee mo3iyt sDuanvpn(0 lenmo iytlaDr nvo;t  2ur(rpiu1apen fetasf rrmumo;o0tex mi3iatfa rm( p;u)trxomr3iytopteluvo;(  euoxmpio1am  livt sf rra( poo0tlt ifctltla2rl( s t)aeeomo iodfat aieol( sexm(m ny4llt mfcsa(f rrmuront4tpxo i3iaslaDea(msn()artrxf3ty1lat aueo (0trxo(o oo1lpt lnvi (farumu  no4opxo i3ildlmDemumsnt0 rtnmocootom  anvo;s)texrxo3oudap   fcsat a2tmu  nu4alxn fciad m2elnvo;t)artrmocta1fmtraivo t)t2uoir iu4optemneiat artr(mp;t1apeoiiciytfmDraums t0tlxoxrcoytfp   ueo s trxr(m ny4amtnmicsl()arur(r ;o4alx  oeilsfm2ua(vo ()altoxocoa1la r ueo ()t2tmxmpou1olenmictat) Dua(mont0aetomoeiysfm umuvp;(0 eeoiociodfatean o t)t2umio3oo4om eliet s)sDtmxro;u4oexnmo3ildfa2raums (0altrioctotfa elivols0 rto(r oudal  mfcsls  Durx  ou0aptomociltla umu s;u4 eenxo3oy1lmtraieol(0seuoiopoo1ome mneilsfsrtaxrpnt4tee mfcias mDelumonu4arxnif3oa1op r n s s)t2umxo nudop   fct (faruaurooo0oetnmfeild a rlums;t)trtoxocoy1lp r ieolt  2umxr iudal e ivilt) 2rmxmonu4oltnmoetat a rm(mo;u) eerif3io1lpt au s s)srtoxm3oy1ol nmiei sfsDraurp;o0apt  o3ils m eanvont0trtrifctydlpD ln sl(  rxmimpny1op elnesls)srtmu poo1tltomfetydfm2rl(mp t4tlxnxo3iotfmDelnes;t t2uoxopiodlptelnet s  ruaxrp;u1tpe mieiytlm2emums;u0 rerxf3ia1lpDrli slt) rtriopny4lmeemfci s srraxmoot1olxnmo3iyt sDelnvo t0trerxo3oo1lmD  ivilt) etoirpou1lpe mneias) 2um( ont1tptn o3iadfsDeau pn(0arxrxo io1fatean o;(0 etm(m no1lm elicsls srrrumpoo0aleoif3tls s ua(monu4aeenxo oa1opt ln ils trum(m oo4op   ivs s  2raurono1ape if3iatla eln s;t0aleoxoctadop  aivo;s  2tmxm3oo1aptelfeilt s2rrum nu1olt moetyslm2umnvs;t) rtrxf oodlmtr nvo;s) etoxm3nu1lm n nesa( s2taumo;o1oleo ieils a umnvo (0aeenxr3tydla r nvi;t) rum(m3io1lptn fviltf rrr( p;t0tpeoiiciysls2eanmsnt0artomociotlateauesls0texm(m no1lptemfesls s2rm(rpnt0aeen ieiytla ulumo;u4trtoir3iy1lateluvo s) 2toxr3nydllenmivsa(f Dra( ono1olenio3iytfmDuauvsnu4 etoif totlaD  nvsl()t2xoxr nudopen fvsa(fsDrmxrpno4tex io3ild m rmnmpnu0 exrmr3io1fa eaueo () 2umimpoy1om   fvi s s2ra(mooo4aex ifctldlmDemnmsnu4arxnirciydomtelu s t sexr(m3iudome  fvsas)a2uaxrooo0oee ifetlsls emnvs t0 lxrxr tydoateaneilt  rtoxmpiy4llt mfeias) rumx  ;u1tptniieiad mDua(mon(4tltnxrcty1optraueil(0sexoio3ny1alenlfctls  2ua(m nt1alen f3tls a eanvo t4tltrxf iotoate neils trxoio3nu1lleelfvsl( sDurxrpot1oex iociatfaDelnmpnu)aeenmf iadlpD aivols)trxmimpno4lpt licsas a2urxmp;u1oexnmietlt aDemn onu4 leomf iotlaDe i o;t) exoxr no4openlfvsl( a2ra(roou0opeoifctysfa ul(vp;u)treoiocio1om  li il(  rtoim3iodlm nlnvt s)s2trumooo0opeoiieiytls2ua( o u0 eeniocia1optean o;t)truoimpnu1lmte fet s aDraxr ;o1tpeomictasfa ra( snt)aexrio3oadfpDrauvi;s t2toirpny4alt mneilt a2rax  nt0aee  ieiadfs ea(vsnu0aetnircta1op eaies s0s2toxopiudamt livtat) rrrxmp;t1aetoio3tadlm emnmsn()trenmo3ootop   uvo t0texrim iudal   neslt arurxrono1olx ifeiltlsDul(vo t0arxnifciatoptranvols0s2tr(r3iy1am  livt s) rururo;t1oleoio3ils sDrlu p (0altrxr3io1omDe ues s0teurxr3ny1ameelicsa()s2tru p;o1tpxoif3iadlm2rl(ms;t) lxrir tydlpDe ivslt t2umim io4lltnmies sfarra(r ou1olen f3iys m2ea(ms;(0 exrmfctydlpDrlnes;s)srxrio3iudolt mivtas  2ta(r ;t1alt  ieiytfa2eln s;(0trxnmr3oo1oat au ols srxmxo nu4amenmnci t s2rm(roou1tetomoetatfs2rm( o;t0 rtrxrcoy1omDranvslt)t2trxrpnu1om elfet ( aruru ont4alx io3ildla2ra( s;(0tlxnioctodfmt lnei;()t2xmxrpiu4amtn ncia(fs2tm(m no4apx  i3taslm uau p (0altnxr3io1lmt  i o s  2xmxmpno4ol elivil(farurx  ot4oet  fetyd m ea( snt0arermr tatlmDelueil(0 eumio oodlme  iviatfsDta(r oo4opx  i3tlt sDuan on(4trxoxociy1opD aues;s) 2xmxr3iydlpt mivtlt)arumx p;t0tleomo3iydlm2rlnmonu4artnir oydoateai ils) eto(r ny4op  mfvslt)sDtru o;o0aexo fciydfs2umuvonu) lxnmf oa1latelivs ( sexoio3oy1altemfvslt  Dum( onu4aptnmfctatfm rmn p ()tetnxfcia1oatrlneo;( sexo(o iu4ale mfctls  Dumumpot1tee ifciytlm2rlu p;t4 eeomf3tydoaD aieo;t  rur(opoodalt miciltfarrmx o;u0tpenif3tad a2rl( o u4 eenxr3iotlptrluvo t0teuriopoudlpe mfcil(f rurum nt0tpe  o3ias s eau p;t)tleoxfciatop e n o;s0 rur(r iydlpeelfct t  2ta( onu0tetomi3tldlsDranvpnu)artnio tadlat li s s)tetr(mpiydoptemncs () Drmxroou4oex mfciasfsDumn onu4arerxf3iy1fp rlnes;s  2xo(r iodap n fci s) 2trx o;t4tet mfeils a uan s;(4treoio3iydopt  u i s)texmxo nydame  ies (f Dtrx pou0apeoiociaslmDemnvs u0 rxoir3ia1fpteanes s0t2umimpny1opeelfvtas srrrxr ;t4aleomfeiad aDelu o u4altomo totfpt auvs ( t2xrim ny4omenlfcsas s2urx o;o4olx ifeilt s umumo u0trtrmo3oy1fp eli sls)s2toxm3iudomeelicsls)s2umur oo1tlxoifeiadfa emnvs;(0 eeoxfcoa1fmtrau i;s  rxm(r3io1olte nvil( s2umumooo4opx  iciyt sDrlnvsnt0trxrmr oy1laDean s ()teurio3io4ale  nvia( sDtr(  nt1oexomfctldfa2eanmpnu)teeoif oydfpt auvi s)s2tm(o3oodalee ict ( srumxr ;u4alxnmfctytfsDul(mp;u4altriocoo1laDran o;t)seumxo3nu4omtnlneta(fa2trxroou4oeenmfciytlsDem( o u4arxrir3tatlmt aivo;t) 2umxopny1ap nlnctat)sruaurpnu0tee  ocildfsDemnvpnt4tlenxocto1omt  i sl() rum(opoodol  mies ( sDtmuront1ale moetlslsDran o t)artnir3oodfmDranvs;()srxrxr3oydopenlnctas srtax ono0ape  fciyt s2elump u4altrxocoadoptraneils)t2xmir nydamen fvi () rum( o;u4tpeo oeiytlm2ea( s u) lenmo ia1faDeauvols  etoimpiu1lmte nvi s artmxrpoo0tlx mfciysls2elumsnu) etoxf to1lmtrau s (0t2xoxo3iudom n nesas)srtm(ro;t4alxo oetytlm2umu p u) lerxr3tatfm   ivs s  rumxm nodlm n ics sf ruau o;t0apenif3iad sDrlu ont0trxoxr3io1opDr u slt0trur(o no1lpenmfvtatf 2ua(r ;u4opt  fetldls em(vs u4 ltrifctytom  lneo;t0tetm(opoydope miciatfa2ua( ooo1tlenio3tat s rln s (0alerxo iotlmD  n i;t srtoxr3oy1al  mfes s a2taur ;u4texo f3tydfs2umu s u0alxnxocoytfp   nvil(  rxo(opoo1oleemivtat s2ra(mo;o0aleomictys mDran s;t4alenio3totlptrai ils truoxrpio1opee nei s srta( pno1tpx  iciatls2uau sn()arenxo todfpD lueo;t0s2trim3nydlptn nvsls)sDrr(mo;o0olenmieiatla2ranvpnt4 eerxocoatfaDrlnvo;t) rtriopio4al elneilt)aDur( ooo0tle  feild m ranvs t4 exrmfcia1opteli slt0s2uoir oy4lmee fviltfs2tmu  ;o1aleo i3tatfs2uau s u4teenmr io1oaD  neols) euoir3oo1alt mfetltfa2taumpou1alx  fetlsla2raumpn(4 rxnio3ta1lmtr uvsl() 2ur(mpiy1ape lncs ( a2rrump;u1aexn ictlsfs um(vo u4aexnir3to1omt ai ol()trtmir nudoptemnvia(  Durxm no4apxn feiat m2eanvsn()tlerxfctodfmteanvils0srur(o ou1alen fci (f rrm(mp;u4tee  f3iytls eauvpnu0 ltomrcoo1lp rluvi;s0 2urio3oudop e iciat srrmumo;o0ale iociltls2ranvpnt0 reomo oytomt anvsls0 rto(m3nydolenlfci (fsrtr(  nt4tex ifciytfs rm(vp;u4arenio oo1fa   neo (0s2xmxr3iydop elfct s)aruau pou4apen ieiatfa2ua(vs;(0aeerxo oatfm  lnes;s0 rtmim nu1aptelieia() 2ta(  no4tleomf3tlslm2rmnmonu4alerxo3ta1omt anei;(0t2xm(mpnydlme mivi ()s2truroou4oeeoifctydla umn s;t0teermfcoadopDe u o t0t2xrim ny1lmtemnei s aDumxm ou4apenmf3iadlm2rm(vo u0tetoioctydoa rluvils0seurxm iy1ame mfeta( artr(m nt1tpt moeilt s rm( o;u)trermr oadfmteauvi (0 rurxopoudap elfvtl(fsDuru p;u0teenmf3iadlsDeanvp;t4 rtrxo3iadfat au o t) euoxo3oydlm elivi s arumxr no1tpeomoeiasfmDua(vs u) etnir todomte nvs ()s2tmxm3nodal emnesa( srtmx  oo1tex ioeiyt s elnms;u0 eenif3oydfa elnvo t setriopiu4omen ncsat a2uru  nu1tpen feiysls ran snu0altoio iydlm rlivsls0setr(m ny1amt mncslt  Drrumpnu0oetomfciysfmDea( o u0artrif ty1fm raivil()teur(o oudolte fctlt sDta(rpno4olto iciltfa emnvo ()treoxo3ia1op   u slt)t2to(o iodolt mivilt) rtmu onu0tex ifetlsfmDelnvsn()arerircoadlpt anvi s  rxo(r oo4amtnmici s  Dumxmpnt0alen oeilslsDel(vs u)artoxf tadoate i s;(  2xoxo3ny4al elicslsfsDta(mpou4altnifeiyd a rmu p u0 eeoxf oydomD  i ils) rxo(opnudoptemfct s) Dtr(mpou0apenmi3iyd mDea( pnt4texoif oatopDeauesl(  exm(rpnudamtnlicsl(fsDtaump;u1oexn feiltfa rmnms;t)tlenio3oatoa ean o;t0trumim ou4om nlncsls)sDumx  nt1texnif3iys aDemu onu0texrxocoa1fp eluvol(0srto(r3iu1optelfvsasfsrur(rp;t0tlxnmicilsfsDuluvsnt)tlxnxf3iy1lmD aivo ()teuriopiy4olt lfct s)sDrm(moot0tltn i3tlslaDrl(mo (0arenxo oytfmDr i o;() exr(m3iy1al n ivt (  Dtrumpou4olx mo3tldfm umu o;(4aeerirciatop  lnvi s)tetrxr3oudomt mncslt  Drrum no1altomi3tltfa rl(von() renxocia1lpDr neol( srurxr oodlmtn fci s  2trx oot1tpxo iciltfa ranvs;(4artnmf tatfmtrluei;(0srurimpoo1lmte ics s s2taxm ;o1tpenio3iltls2el(msn(4tleoio oodlatrlnes s0 2xoxmpoy4omtelfcias)srrm(rpnt0apeomo3ias s emums t)aleniociadfmD lu s;t) rumio3nodll nmnesl()sruax p;o0oleoif3tatfm2umnmo;(0texrxo3oadfmtr ues;()srtr(o3no4lpenlnet s s2tmumont1tetniociytlmDrln pn()trxnxf3tytoa  an s;s0 exrxmpiy4ap n ici t) Dta( o;t0tlenmociysfaDea( s ()teenir3io1oa rlnvi t texr(m3ny4omenlnesa(fsDtmu ooo4aet mi3iadla uau p t) leoifctodoaDrai s;(0srxriopny4opt licsl() 2taump;u4tlenmieildfs2ran o;u0tetoxr3ty1omD  nes (0setrxr3ny1ame  ivi s)s2taxroou4tex mf3tytfm2ran p t4 rxnxo3ia1fa eluvo;t srum(m3ou4ale  fvil( srrm(  ou4oetoifctytla2rluvon()arxoif3ta1om e i i;(0 etr(mpnudamtn ncil()s2tr(mp;o0tltnmfetysls2ua(msnu4teeoif oa1lmtrlueo;t)texoimpnu4lpeemfvtas  rtr( pno0tlxoiiciltlaDemn p;u4 exoxrctydfptr u o;t0 eto(opnu1lmee net t s2ta( o;o4texo i3tad m2uau o u0artomf3oo1fpDraueil( tetoxr3no4lmtelfeil(fsDta(rono1oetoioetyslm rmnms u)alenxrcoa1fpDeln o;s) eumxm3no1alen feiatfartax o;o1aptoiictlsla rlnmon(4texrifctadfm r n slt0seuoxo io1ap n ietasfa2tr(mpou4texo feildla ua( s ()alenif oatla raneslt) 2xo(rpoodapen nvtat) Durumont0olx ifcild a ra(vp t4 rxoirciadop elivi ()truoir ny4olen iviat)s2trxmp;u1tltoii3iydlaDem(mo;u4texnmrctatfaD  nvs ()sexm(rpoudopeemics tfsrurx ont1tleoifciltlm rmuvpn(4 eermoctodlmDe i sls srurxopio4open fctas artmu pou0altn oetys aDem(ms (4arenxo oydlmt lneol(0 rumio3ny1optn ivi ()s2raump;u4altnioctas sDea(mon() exoif iodfa rluvs s trtmio3iy4ap n fei s) 2uaxm ou0apxomfetldfaDea(mo u)alenmo to1op  au s;(0setmiopiudlmeemivias sDum(rpnt0apenmf3iytfa ua(mpnu0alxoio oy1fm elnesls)trxoir3oy1olen fesls aDrmxmpou0apxo ieiltfsDemnvsn() rxoir oa1oaDr nvsl(0tetm(m oo1opte nct sfa2taxrp;o1olt  ociydlaDranmsn(0 etoiociotlpDr nei;t0trxm(r3oudlle mfvtl( a2rau o;o0ape mfeils m2eau s t4tetnifctadopDr ues s) rumxr3io4ol elfvil()arta(  nu0olxnifeiadls2rl(vo;t4trxnmf oa1lm  lieo t0 rtm(r no4lmenlicsasfsrum(roou4tle iicildfs2eln p (0 rtomfctatoaDeaneilt)teumir iu1om nmncsls)s2trxm oo4apeo ieiyslsDean snt4 eeoxoctatla  aues s  2xm(rpio4al nlietls  rua( p;t1tpxoiictysla2emums;u0 etnir3iadfmDr nvils srurxm iu4apeelfvil()sDurur nu0tpenif3tyd a umu s;t0 rtrxociy1faD  ueils)sexmxr3iy4optemnvtas)arrr(rpno0apxoio3tls a raums t) rtomf to1fatrlivsls0seuoir3iy1omt  netlt  rrau p;t1aexn icilslaDem(vo t)tetrir3tydlm  lueslt)s2xoio nu4lle licsas)aDua(mp;u0oeeoioctys m2uanms;(0trtrio ta1fmteanei;()trxrxm iy1lm elfvilsf 2rrx ono1oet mf3ilt a rlnmpn(4 rxoir3ta1fa  lueo;t s2xo(o iy1ol nlfeias  rur(mp;o0tptomfciatla2em( s;u0 exnxrctadom rli i;s0s2uoio3ou4am e fes sf 2urx o;o0oeeo iciyt mDeanmsnu0 lxnir ootoateanvs;s0texoirpoodolt mfetl() rumur ;o0aexoioetldlm ua(mp;t4alxomf3iatfate uvs t0seum(o ny4olt livsa()s2urum ot4aeeo fetadfm um(mo;(0altnir tydopD  neo ( t2urxrpiu4lpt livtat a2tmu  ot4aeeo ictls aDuluvont)altrio3to1lp e ues (0setmim3iu4ome mnvsa(f rtr(mpnt1opxomfetat m umn snt0altoxr tatoa e ieo s t2uriopoydaptemnvias s2rm(r oo1ole moeiyd a2rl(msn(0 ltomo3iytfmtrai o;s  rum(rpoodol nliciat artrurp;o0opxnmf3tys s2umn on(4 rtrir to1opDrai i ()s2tr(o3iy4lp n nvs () rur(mp;o4olenmfeiysfmDumn s u0treoif3iadoaDr ueslt  rxm(o3iu1op  mfciltf Dtmx oou4oexnmo3ilsfm el(vsnt4tlxnmf totlp e i ils sexmim iydalte fvta( a2rmur ;t0teeo oetldfaDumu s (0aexnif3oodfmtraivs t trumxo3iydome mfetlt aDrrxrpoo4apx  iciatfm umu p (4 etrmr ootfp ranvo;s) 2xrio ou1lmeemfvta()srtr( oot4tee iieiyslm uanmpnu)tlxomrcia1om  auvs;(0srum(r3io4lpt lnciatfsrraump;t0tpxoifctydla uanvo (4 lxoxr oatlmDelu ils0teto(opnodopeemncs (f 2urxrpoo4ole  oetltfa elnmo (0 eeoxf3oo1oaD aivo;() 2tmim no1op e fcilt)a2ua(m ou1aet  fetydfaDuln s;(0trxomfctydlmD aivils0s2toxo nu4om   ieilsfs2uau pno1aleomociyt s2eau p;u4 ltnmr3to1lpDeluvsls)t2umio3iy1lltnmfeias  Drmxmpnu1tpt iieiysfmDra(ms t0tltnxf3iadfmteluei s0 2tmir no4optn ncta(f 2rrum oo1oetn o3ilsfs rmu s;t)trerxf3io1lpDe nes;t)seumxr iudal  lfesltfarrm(r ot1olenioetat m umnmon() rerxr iytfaDraneil(0s2ur(m3iy1lp n icsa()sDuaumpnt4oee iociydfm2um(mpnu4 rtoio3oydomteln s;s0t2xriopnudll n nvt ()s2urx ono1apeoiicilslmDulnms;t0 rtomrctytfp elivs;s sexr(o oo4alte fei s)aDrrx oou0aee  fetyt a2rl(mp;u4tlxriociatop rlu s;()srurxo ou4ol e nctatf rraum nt1opxn f3iltls eanvpnu)altoxo3oodfaD lneilt0t2trimpnu1lp elncslt aDrrx  no0tlen i3iatfa ua(mont0 etrifciytoat li i t  rxr(o oydapt  ncia(faDur(roou4aleo i3tydfm2em(mp;(0alxrmfctadfaD  uvol( setoiopny1aptnlivt tfs2umx  ou0apxn fciyt s2emums;()artomo3tadopt anvsls)teumxm ou4ap elncsatfaDraumpno1alxnmfcildfa2uan o t4alxomr tatfm rlivslt) rtmim3iu1lp nlncils)aDtaumpot0olt ii3iltlaDuluvs;u4 renxr oatfpDrln sl() rtoirpoy4ol  lneiasfa2rrurpno0aeenmi3taslaDumnvs t)altrmr oy1fmt  nei;()teuoir iy4ll nlncsa() Dra(rp;o0oee mieiatlm2rlnmp;t)aetoio3iadop raueo;t0srtm(mpoy4lltn netls) ruaxroou0apxo fciatfm uau s t4alxoxf3oy1fmD li s;s s2uo(mpiy1apte ietlsf 2ur(m oo0tlxoiictyslm2rlnms;(0artnifcta1fpteluvi;t) eur(m3oydom  mnetas  2rru  ;o4aex ioetydlaDum(vs t4 reoxf tydfmt  u sls0 2toxopoydomenlfes t)sDururp;o0tetnioeias a2elums (0 rxoxfciydfp  au s (  2tr(r3iy4am elfvil(farurxm ou0alxomieiatls2rlnvp (4aexrmr3iadfaD li sls  etmim oydomeelfcsatfaDraxro;o4ape  feiat mDuluvp t)trerxrcty1faDeai olt0trur(opio4am emnci (f rtrxm ;u0aet  ieils aDumn o;u4 eerxr ty1lmDrluesl() rurxmpio4ol  livsl( sDum(rpnu4ale  feiytls ran pn(0 lerifcto1op eluei (0 2tr(rpnu1amt lncias)sruaxr ;t0tltnmfeilsfs rlums;()alenxf3todlm  anvs () eum(m iodomt lfet (  2tmx pot1tpxn oetldfa uau snu4teeomf oatfmDeluei;t  exo(rpio1am   neias  rtmur oo0tpe io3tadls2rlu o;u4 eerxo3iatlpDeaivi s)setrirpnudamt  ictl() 2ta(mo;o4olt  oeild s2rlnvpn()aleomo tatoat  uei t s2urirpiy1al nmics s)a2rm(m nt0opx  f3iasfm2uauvo t0 rxnmo to1omDr i sl()srtrirpoo4om n fetas sDraum oo4oeenmfeiydfmDemu p ()trtrmo ia1omDrlnvo s) ruoir3oo4op  mnesls)aDrr(roou4ole mf3tldfs2ulumo (4 renir oatom r neol(0 rum(o3ny4ll n ncil( sDururpnt4optn octltlm ea(monu0arxrir3tydfptran ils tetm(opio4lle lfvsas) Dtrum oo4altniieiatlsDelnmpnu4altomfctodlpD anesls  2urxopoudoleelicsl( a2umx o;u4aptniiciasfsDuluvpn(0alxoxo todfmD livol(0 2xo(m3ny4lpt mnetat)s2tmumpou1opxomocildlm2em(mo t4 lxnif oytoptelies;s)seumxmpnydlme  ivtltf rtaumo;u1olxoioeiadlmDua( o t)aetnio3ootoaDrliei (  eumxrpiy4al elnvias srumx o;o0tpeo fctatlaDul(mo;(4teerir3to1opDraues;() ruoir3iu1lp   nei ()aDrr( o;t0aleo oeiys m2rmnmp u4tlxnir iatlm e u o t)s2uo(m3oudaptelfvsls)aDrmumpot1aeto ieiasfs2el( s t4 etnxr3io1fpteli o s0t2xoir3io4apt mivi t aDrru ont4ope mfciat sDelu s ()tleomrcoatomDeai olt0s2trir oo4llee nvi sfsrurx pnu0tptnifeiasfsDrmnmp;(0 lxnxrctydopD  i o;t0srxo(o no4olenlfet ()aDtrum nu1aetnmfetldfmDrl( o () exrxrcoytfpt  neslt)t2tmxm nu1al emfeia(fsDur(mo;t0tpx ifetatfm emuvon()aeeoir ta1lmtraueo;t)teurxm ou4oleelneta()arrru pnt1tlxo ocild m2um(mp u0tltnmr ta1lptr iesls) 2xmimpou4ome  nvil(fa2taumonu0tlenio3iydls2em(mo;t)artrxo tadlptelneolt) rum(o no1lpe mfvtat) 2trxmono1aetnmfcild mDrlnmsnu4altnmo tytoa eanvols0 2urxm3iu1omt  fctl() Dtru pnt4alxoioeiatfmDuluvp;(4 etrmocoy1lmD livi t0seuoio oy1am  mivsls sDraumo;u4oltn fciad mDel(mon()aexoif3tadlm eaiei;t s2tmiopnydaptnlnvi tfarumu pou4olx  iciytlm2ulumon()arxrif3oo1oa eli i t0sexrir3iydame lncia( sDum(  ou4aetnif3tasla2uluvpnu)aeermociatfmtraneil()srxoir3ou1ome lictlt)srurur nt4oexo oeiadla2umuvo;(0alerxr ootlpDrauvi;() etrxm3no4op emictl( s2tr( pno4olxnmoeiytlm uau s;() lxnmf oydfmtrlnes;t  exmimpny4al n nct sf Duaum ;u0aptomoeias s rlums;() lxomr3oydlp  aivi;t0trtoxm3no1om e fvtlt sDraumono4tpt mocilsla2eau pn()alxoxr oytfp   neol() 2trir3ny1lmt miei (f 2tmxrpoo0alt  fctlsls2umums;u)trtnxr iydfpte u o;(0 rumxrpny4opt livt s srrr(  no4apxoio3tyd s umuvs;t4 leomo3totlateauvi t seuo(o iu1lp elfvsltfsrum(m ot4tptnmietas aDelnvp;u) rerif3oy1latr uesls0seurxrpoodapenmfetls aDuaumoot1tex  f3iad s2uau o;t) etnxo oo1fa  livo ( srxrio iydamenmfviltf rtaump;u4ole moetltfs2ul(vs;(4 ltomo3iotfpteli i;()texmir oo1am  mnct s) Dur( p;o0aexoifetlslm2emuvonu4tlxrio oy1lmDe neo t) exo(m3ou1lm  lici t aruaur ;u0tlx  fetls a2uaumpnt0aetomrcto1omD livi t trurio3ny4ale  fei (faDurxmooo1aexnmociasla2uln p;u4aetrmrciydlmt  i ilt seum(opoo1llt  feil(  Durxm no1oexoioeiaslsDumn snt0tlerif3totoptraivo ()srurxo io4amt liesas)s2ta(rp;u4apt mieiat s2rl(vs ()trtrmf tatlaDe ueil() 2tmxr3oudopt lici t artmxmpnt1tltnmi3iad m2um( o;t0 rerif3oydfmDe n i s  etrxr3nu1omtn ici t)sruaumpno0olt  oetytfs rmn o;()tlerifcoodopt  uvs;t) 2xmxr iy1aptnlnvtlt)aDrr( pnt1oltnmietld a um(von(0tetnir iotfate uvo;s s2trxmpnydapt mnvt (  rtrxr nt4olto ietysfs2eanms u4 etrxo3to1lp e ivsls)trxr(r3iy1alt lict ()sDraur ot1tpx mfeiadla2rl( p;t)trtrio ta1oatrli o;() 2xmiopou1opee netas)aDraxrpno0alxo feiydls ea( onu0 renircoodlmt lueo;( teur(m3nudomeemics s arrrxmono1apxnifcildfsDraumont4texnif totlaD  nvs s0trumirpiydap  mnci sf rururo;u1oex mieils m2el( s;u)tltrmociytoatrlnvi ( setrxm nu4lp   fvtl( sDtmx onu1ale  o3tls a ulnvp;t) lenif3iadomD  uvslt  rxo(o3iudom  micilt)s2uax onu0tltnmietydls ua(vs;t0 rtnxrcta1fmte i slt)trxo(o ou1lle lietl()srrm( ooo0tltoiocilt sDuanvo t4tlenxocoytlaD  i i;( teurim iy4ale miet t srtrxm ot0teenmi3iltfm2ea(vp;t4arxoxf ootomDe n sls s2to(o oo4ll  mfeilsf Durump;t0aeeomociltlm rlumpnu0tlerir3iytfm   n ols)s2to(r ny4aptnlfetlsfsDua(rp;u1aex mf3ils a2elumo;t)trtoir iotlatr nvo t)t2toiopoodlltelncs () rtau poo4tptnmocils aDrlnvp;(0 eeoircoadlmt an i;s seurxm3no4lp   fctltf Dtr(m ;u0oetnii3tatlsDra( pn(0artomociodfmD aues () etmxmpno4amt mivta(fsrur(m ;t4apenmo3iyd a eauvp;t0trtoxr3tydfmDeau ol( trumxr ou1op nlivt sfa2rm(mpoo1aexn f3tyt m2emn o;(4arxoxrcoydfaD li i t0tetrio nu4lme  nciltf Dur(ro;t4apxo fciltlm2uauvsn(0 etnxr3totoa rli i;t) rxo(m nydlp e nvi (fsrraum oo0openiieiad m emumonu0tetnif iytlpt  ivs;( sruo(mpnudop n neilsfaDtmx pno0tlenmictldlmDua(vp;u0teerxr3oy1fpD aiei;s teumimpno4optemfciasfarrrxmpoo4opt mi3tad s2elu sn(0 ltoio oadlmtrlieils srumxmpiodoptemics (faDta(moot4alx  fciyd m elnvsnu)tlenxo3ta1om e uvslt0seurim oy4omee ncsasfs2umur ;u1oeeomiciatfsDranmo;u4aexnif3io1la eanei;s t2xo(m iu1olenlfviat)sDuau p;t4teen octltfa2um(mo;t)teenmr3oydopDrai o;t srtoxr3no1ap nmici s srra(mono1apxnmieiysfs uluvonu0tltnxo3oodfat ai i (0srtmxo oo1altelfvia(farurx pot1tlx mfciyslm2ul(vp u)aexoxo iatoateauvs;()s2um(rpnu1lpee fvtls)srumu ooo0opxo feiatlmDua(vont)arxnmr oatlpteluvi s  etr(opiy4aptn iviasfsrum(  ot1altomf3ils s ulu pnu)aexomf oadomt ln i;( s2tm(r3iudom elnvia(  2rm(ronu4tlxoifeiat aDemn ont4 exrmocoy1fpDranei t0sexmim3iu4altemies (f rtaxro;t4tex io3iadfm rmu snu) lxniocoa1lp  luei;(0trxoir3nydlpt  neias)artmxmoou4olxn f3ias s umn p;u)tltoiocio1lmtrauvs t)texoxo oy1aptnmictat sDururp;o1ole  fciadfa2ea(msn(0tlenxr iodom rai o t) rxm(opoy4omtemnci t)s2ur( pot4tle  fctyslm ulnvs u)trenmr tatlatr uvsls)srtm(m no1op nmfet sfaDraxm no0teenmiciatlaDuanmp;u4 ltnif io1optrli i t0srumxrpiu1ol e nvs ( artmum no4alt  feilslmDrluvsnu4 rtnir iotopD au o s t2um(m3oy1amtnmnvtatfsDta(moot1tle ii3tld a2emu o;t4artrio oodfa e ivolt0 2xmim oy4altnlfvtas) rraxmp;o4alt  o3tytlm uauvon(4trxrmr to1fa   i s t  rurxmpny1lm eliesa(f Dtmxmo;o0opxnioctyd a ranvp;() ltoxr3iydom eauvs;s  rtm(m iy4lm   fct tfarra( pot4apxomfciytls2ea(mpnt0trerio iotlp   ivs s) exoimpiydlle  ieta(  2ur(rpnu0tetnmf3iysla2ua( pnu0 renmf3iytfate ivo ()t2um(r iu4lp  lics tfsrrrumono0aexoifetysfmDemums;t4trxrxoctytlmtraneo (0srtoir oo4op   fvsasfa2rmurp;o1tptn oetyd mDelnvs;(0tlxoxf3iydlmD  i ols t2ur(rpoo4om  livt s)a2rax p;o1opx iiciyslsDrmnvp;(4aeerioctotla r neo ( seuoxm3no1llt lictat  Dtm(rpno0opxomo3tldla ea(vsnt4 rtrircia1opDrauvi s  2toxopny1lpenlivi tf rtm(m ou4apxoiicils m2rlnvo;u0tetnmr3tydomD lu s;( srxrxmpiu1omtn feils)srrmur ;o1tee iociyd s2elnvpnu4alenmf totlpt  uesls  eur(o nu1apeemncia()sDum(mpnt4teeo o3tlslm2uan o t0tleoio3oy1lp rlieil()tetoxr3ou4ll nmnes sfa2raur ot0tlxn octad mDuau pn(4arerxo oo1om eaueol() 2uoxm no4alenmnvsl(fs2umxront0ope ifctysls ul(vsnu4 rtrmfciodlpD au o t0srxo(r oy1amenmivtat)srur(moou0tetnmf3iyd m eanvp;(4 eeoxr3ia1om  auvi;()t2urxm io1aleemies (faDtmx  ot0apxnif3ildlmDelnms u)
\ No newline at end of file
@@ -0,0 +1 @@
+i s;t0texmxrpno1ol n fvilt) Dtaur nu4opxomi3ilsfs eaumpn(0 leoxf iodfpt  iesl(  exmxrpnudaptnmfcsl() Dra(m no0tleoif3tltlsDrauvsnu) ltnxr3iotopt aivsl()s2tr(o nydapeelfvi ()sDua(rpnt4opto oetyt a rlnvont4 eenxfciotfa  auvs t t2xr(o3iy4alen fei t sruauro;o1tltnio3ias m2umumsnt4 lxnir oadopDr ieol(0t2ur(o3ny1lp nmics t  Dururono1aeen fctld s uan p (0 eenxo3oatopt luvs;s sexoiopiy1lmenmncsls aDuaxrp;u4ale  ietatla rlu onu) rerxr3iytlpDeli o () 2toir nu4oltnmiei ( s2tm(  ou1opx mietydlmDeanvpnt)aetomfctodlmt  nvil(0seumxm io4al elnes s)arraurono1tlenifeiyt mDulnvs u4aeenifciadomDr ies;t0 rxr(rpoudol   fvsls)sDurxmpnu0apen o3tysfs rm( snt4treomr oydlpDr i olt)tetm(o3iu4lptn nvslsfa2um(r oo1oltn oetadlsDrauvp u0alermr tadfa e n ol( s2xmxm iy1ome lfvtasfs2tmx pnt1tltnmo3tls m2ua(ms;u4 leoir3iadfmt lueo (0 rtmiopnodlm n fcilt) Duaurp;o1tpenif3tlt a2eau s t4 rxrxocio1fa  lu s t)t2toiopnodoptemivs s sDtmum ;o1opxniociydfm emnms t)teenmocty1lptr u o t0trtr(m3iu1omt  fcsa( sDur( o;t0opxomi3iydlaDum(vont4alermfciatopDraiei s)t2urir3oodapeelfei t)a2uaxm ou1alenmieiasfsDrl( o;u) etrxf oadlat auvolt0 eum(o3io1ame mfeils a2rrxmoou4alen f3tldfm el(vs t0 rtrmr3oy1fmte n o;s trur(r oy4lme lncsat s2taur ;o0tpe ii3tatfsDean p;(4 ltoxrctatomDrau s (0srurim io4omte fesas) 2raxm ;u1oeto fciyd m rmu p;t0arxomo3oytoaDr i i;s0srtoxm3nudolte nviatfa2um(roou0apx mfeiatfaDra(von() rerio tytfmDrlnvo s  euoio3iydomen feslt)sDur(rp;t1tlxnifeilsfs ulu sn(4treoio oy1laD ln sls0 rxm(r3nudole lnesas)arrmxmooo0olto fctldfa rmnms t4trtoifcoydlaDeli i;(0t2umxo3oy4lpe mnvs t s2uau o;t0aeeniietydfsDelump;t)arxnxocoadlpD  ueil()t2tr(m3oodal n ivsa() Duaxmpnt4alxomo3iydfm em( o u4teermo ootfatrai s;t  2xmxrpiy4lmt lfvsasfa2rax o;o4tpeomo3ilsfa ulu pnt0 lxnircta1faDe uei;t  exoim3iydal nmneiasfsDtm( pot1aleo fctldlm uauvp;u)alenmr tytfateluei;s0 2tr(r oo4ome mivs (f Durur ot1tpeomieiysfaDea(ms u4 lxoir ty1opt  nvs;t0tetoxopio4omtelivi (fs2tmur ot4tlxnmi3ilsfsDulu s u) reoxfciy1lm   ivo;s texo(o iydalee ncs (f Drmumont4tpxomiciadfsDean on(0teeoif3tytomte i ol()seuo(mpiy1aleelnesas srtaumpou4olxnmoetlsls2uluvsn(4trtoif3oadom e i s t)t2urimpoy4op n iei s srrru oot4tex iiciyd s2rmumsnu)texnxoctytop r uvsls)tetoim nudam nmfvia(f Drmxrooo0ale iieildfs el( p t4aetomrcoa1lmtrlivs (0 2xr(r3ny1ome lfvtl( a2tmxmo;o0aexn f3ils m2eanmo;t)aexrioctytfpD anvi t  2trxo io1lle lneiasf Dtmx pnt1apto i3tasfs ra(ms t) etomf oodfmDeaivilt  2urxo3nu4ll nmies t) 2rmu pnt4olt mi3ilsfaDra(vp ()arxoir3oatom  anvils0 2uo(r nu1lmtnmies (fs2rax o;u0opt moetld sDranms u4tlerir3io1lptean o;s sruoio ny4omt lfesas)a2uax  oo4olxomictadla2emu o;(4 eeoxf3oy1lmDeln s s)s2umxr oo4om nlfci tf Dur(rp;o4apeo i3iysfa2ulumo ()aetomf ty1fm  anvo;s) 2tmxr ny1apt lnvta(f Durumo;o1oltoifeiyd aDuau snu0tetoxfcto1opDelneilt0 etrxmpiy4lptn iei (faDuaxroou4tlto ocildfs ea(vonu0aetoiociadlmt li o s sexmiopiodopenlnei t)arra(root4olt iiciys a2emnvp u0 etoifcoadlmD auvi s)s2umirpoy4altnmict s s2ra( pnt4olxoiiciytfsDrmumon(0 etomo ta1lm   n sl( seur(o oodome lfeia(  Dtrxmpnt1oet  oeiad m ranvs;()aeenmociy1lm eluvslt  exmirpiy4ap nliviasf 2raxrp;t4oltn f3iydlm2uln p ()tlermf iodla   uvo;t)srtrxrpiu1ap  lnetas)sruaur oo4apxomfetys s2rm( o t)alenxfciydoa elueo;s)texmxo3nodom elfvia(farua(monu4aex ioetlt sDrlnmo;t) leomf oydfpt aues (0s2umiopno4apen fet s a2um(  nt1oeenifcilsla2el(vs;t4 leomfciatomDr i sls0 etm(m oo1lptemivtls s2taum no4oeeomi3iatla2ulumsnu4trxrmo to1lm e i s;t)texrxmpiodlm nmnei (faDtmum ;o1apeniiciltfm ra(mp;() lxomr3ty1fmtr u i;(  2trxo ny1aptn fcs t  Duaxr ot1tleo f3ildfm2rm( onu0teerif3ty1latr n s t teumxr3iydlmtelfetls)a2rm(mo;u0tetn fetyslaDeluvpn()aexomf3oytfp eluvo;t)texr(o io1ole  feiltfa2rax oot4oexomi3iys mDrmnvs;t)tlenioctodoaD luvi s s2trxo3oy1oltn ieia(fsDtrxrp;o0aet ifctadlm2eanvsnt0 rerif3oodfp   n ols)s2uoxr iydaptnlivilsfartru o;o1oet iocild m em(mo u4tlenmrcoa1lateaieo;()t2xmimpiy1om nmfesatf rurum no0texn o3iad s2rlnms;u0 eerir oa1lm rlu s;t0 exr(o3oy4alenmivia() Dta(  ;t1tee mo3iltlaDel(vo u0artrif iytomDelivs;(  rtr(o3ny4ap n ietat s2umumont1aexnio3tadfa2rlu o t0tlerxr oa1lpD lieo;()trxr(m3nu4am elfvta(farrax pnu1aexomfctydla2emuvo t4aexrio oadoaDrau i s0sexo(opnodom e fcsat  2rmu o;o0oexoif3ilslm ea(ms;t0trxrmociatlaDeai sls0 rxr(r nydlpenlici t aDur(rp;o4oee mfciat aDrln pn()tlenmfcoadom e ieols)seurxm3iodape mncias) Duru ooo4alxomfeiysfs2ulnvp;u) rtoifctydoptraivi s s2to(r3oo1olen ietl()sDur(rpno4tlto fctldfs2emuvsnt4alerxf3oo1faDr u ols) 2umxr3ou1aptemnvsasf Drr(root1opt iicildls2uln s t4tetrircta1latean i;t)srtoir nu4ol   icsls) Dtrxroot0tpx ifeiyslm2em(vo;t)tetrxf3iotla   nvo (  rtmio3no1lpeelfcsasfaDtax pno0alx iiciysfaDran p;()trtnif3oadfpDeaivo t)sexr(r3oodole  fct () Dum(ronu4ale mfeiad m2eau s t0 etomf to1oatraues ( s2xr(m oo4lp emfvsa(  2rmx oot0tex  i3iltla em(mont0 etomo3totlptranvs ( srumxo3nodopte ivsasfarra(r ;t0aptnioctyd m rlu snu)aetrmo iytlpDeauvils0 exm(opoy4ameelivs sfaDra( oot4ope mieilsfs2rlu p;() lxnmf3oytlpteaivi (0 rur(r3nu4lme lnvi (f 2urx ono0tpt  f3tasls elnmsnt0aexrif3oy1laDr ivsl(0tetmim oo1ap   ncsls  Drmu o;o4tex mfeilsfsDrmnvsn(0aeenmr to1fpDran i;s  rtoxo3io1alen feia( artm(  ou0teto f3iydfmDranvsn(4tlxrif3oy1lmt anei;s  2xmxm nu1am e ivsasf 2rax p;u1oee mi3iytlsDrau s t)altnxrciy1oa  lnvo;s) 2xrimpnodoptnlfetl() Dtmump;t4apxnmoeiltfm2elu o u4 rtnxf3oy1lat  n i;s t2xmiopiu4omt mneta()s2rmxmpoo1tlxnifeils a2umuvo;t4 lerxo oy1fp e n ilt)setm(o3nodam   nct sf 2ururoot0apenmiciyslaDrau o;u4aeeoir tadfaDeaiesls t2trirpoy1ome  neta() Dtaxmo;u0apeniieiltlmDrm( p;t)aeenxf3io1oatr u s;( s2xmxopny1am elfcsas)sDtaump;t4aeenmo3iasfm2eau s;t0aeerxfcoodlaDrlnei ()s2trxopiu1amt  netas  Dtaumpou4opxo i3tltlmDuan o ()artnir3ty1fpDelivo;( srtmimpoudlpe lfeils srrmxro;u0ale  fcilt s2uanmo t) ltnxo3todlat lnvi;()t2toir iy1lpe lfcta( sDtau  nt1tetoifetatls2uanmp t)tetrmf3oo1fp rliei;s0srto(rpnu1lm   fes (fa2rax  no4olen iciasla2uluvp;u0altoif3oytlmD  ivs s) rxoxm3ou1lmenlnvsas  Dtm(ront4altnmo3tytla ua(vp u0 lxoxrciatop   n ils0seum(r3ou1lpenlfvsat  rtrxmp;u0oexnio3tld m2ranms ()altomf3iy1om  an s s0 etmxm3oy4opeemicsat arum(  ;u4tleomoetld a em(mpnu0trxoxo oo1oa raieol(  eurxm3nodalenmfvsltfsDtrxmpoo0aexomiciltlmDeln o;u4artnif iadfmteluvil( seto(r oy4lm elfvsls) Dua( o;t1aptoiieiltlsDul(ms t0trxnmr oa1opteai i;(0s2uriopiu4lle  iesa()s2tau o;o1aleoif3ildfaDum(mont)arenmr iadop elneo;t)setrxmpiydlmt  nvt ( srrr(r ;t0oltnii3iaslm2uauvs (4 ltrmo3oatoaDelivi;s) 2toxr oodlp n iviasfaDrr(rono0aleoio3iydfsDuau s (0altoxr3iytfaDean i;s0 rtoirpoudal nmnct s) rrax ono0ole ioctasfm ra( s;u0trerxf3io1opt  iesl(0seumim no4om  mfviltfsDrmxmonu4apx  feildfm uanmp;u4 lermf tatoateaueo t)srumxr3oo1lp e fvsas a2um(mp;t0tpxo o3iytfs2ulumo;(0arxoio ootopDraivo ( srxrio3iu4lm nlivil()s2rm(mpnu4opxo ociys mDel(mpn(4tetnir tatfaD aivil( sexoxm3iodlmtnliesasfs2ra( o;u4olxomi3ildfa rl( s t0 etrmf3oadom rauvils)teumxo3iu1ape mfei s)s2rmu  ;u0oexn i3iyslm2ranvsn()trermo io1lmDr uvs;s  etriopnudlpe  iet (  Dtaxm oo1texoiietlt aDel(vo u) ltrxo3oa1fpteauvs t) rumxr3oydlmtnlnciasfsrtr( oou0alt  fetat mDulu snu4trxoxfciodfmt  nei t trxmirpiy4al   feilsfsDtmx pot4apt mf3iltfs ra(vp;t4 exomrcoa1lmDeaueo;()srumxr oo4amee ivs s)aDrm(roou1tptoiieiyt a2em(mpnt4 lxnxrciytlmt auvi;s0s2umxrpio4lmeemivsas) Drr(mp;t4teenifeias s ra( snu0 renmo to1opDrau i;( trxr(r3iu4ame mfei t sDua( onu1tet moeils aDuaums (0treoxf oytlpDr i i;()srxrio3ny1lp   netls srtau poo1apeo ietatfm2ul( o t) leomfctydoaD livilt  2tmir nydlp emneils arrrxr ou1oetn i3ils mDumn onu4trtnmo oytom   uvi t) 2tmxmpny4al   ivi sfsrtrx  ou4tetoifcildfm umuvpn()tltomf to1oat  nvi;s)sexoimpio1op  miet ()aDtmxrp;o4aexnmfetasfs2ul(vs;t4 rxomrcoatlpteaivols t2tmxrpiy1opt  fesa() rra(  ou0tptnmoeiat s ranvs;u4 ltnmr oa1laDelu o t setrxrpnu1lmt lnetas  Duaxm oo4apto o3iasfmDean s;t4tlermr iy1fmDrau il(0 etrir nudome mfctlsfsruau  ;t4aptomiciytfa2um( onu) lxoxr io1lpD lu s;t trxm(m3iu1al nmici t)a2raumonu1tpe mociydfs2eauvs t0trtnxo3oy1fa rluvo;t0srtm(m3nudoptemivtat s2rm(roou0tee  feiytfa2ra( ont4tlerxo3oodfp rau olt)truo(mpno1aptnmivsls)s2trurp;u4apt  i3tlsla2ulumo t0alermr oodop  lu olt0trtoxr3no4lmtnmnetls s2rm(r ;u1tex mf3tad m ulump;(4tltnxo3oatfpDraivo;()texo(opnodoptn icsls)s2ua(mp;t0olxoiiciys a2eaumo;t) etrmf todfp elneol(0trur(o nodamtnmies t) 2um( pot1oeeoiociatfa umnvpn(4alxnxr oo1lpDelues;t) 2tmio3iy1lpenmiei t aDtruroot0aexo i3iysfm ulu on(4tlenmo3totfatrli s t0 rurim3no1oltelivi ( a2raxro;t1texo o3ilt s umu ont)trxoif3iytlp ranei;t) rum(o oodomt mivi sfsrtr(m ;u4apenmoctls m uanmonu0artoioctodfatraneols) exoxr ou4ol emfeilt a2ta(r oo4apx mictytla2um(vp;u0teenmo oa1lmteaieolt0trxr(mpio4open nvsltfsDtmu o;u1tlxo o3tyslaDel(vont4 leoxr3oo1faDr ueolt  exrir nudllenlieilsf Dumum ;u4tex  fctlt aDeauvo;u0 rtrmfciy1om raiei;s0trtm(m iodlp  lfetat  2ua(r ou0aexoiieiasfa2rmuvp;()tlenxo3iatop rlnvsl(0 2to(mpiudapen ivi s)s2rmu o;o1tpt mo3tlsfaDumump;() rxrio oa1optrlnvils)s2toxr3nu4opeemfvsl()arur(rp;t4oex  fcilsfaDrauvo t0trtomo tytfateai i;s0 2to(m3oy4amt lnvsat artrx  nt4tpt  iciltla2umu p;u) etnmocoa1la rlnei t seur(r nodlleelnviat) rururpnt1aex iietldfs2emnvp;u0 lermfciydop rlueols)t2xoxopnudlptn nvs s s2um( pnt0ope ioetysfaDea( s u)tlxoir3oadop eaivols0 rtmimpio4alt mnesatf rur(  nt4tpe ioetldfa2emn s u) exrifctytfm  anvslt) 2xm(r3nu4ol  mfvilt) rurxro;u0olxniietatlm emu p;(4alxnioctadopDeliei t)teurxrpiodol e fesltf 2umxmoou0tlt mi3tlsfsDelu p u4aeenxfciadfptrlies t0seumim3nu1am   ies t)aDrmx pot4tlxo oetld a2ranvpnu4teeomo ia1lmtr n o t)seum(m oudomte nvt t s2uaxrooo1ole iiciatls rl(monu)tleoif3iadlpD auvs s  2um(mpoydam emnetlt)a2umu oot1alxo f3tytlaDrlumo (0 rxrmf3oydlmDrluvi;(0t2to(m3no1lp   nvta()s2ur(r no1oet  f3ilt m ua( snt0tlxnio3tatfat liei;( teto(o3oo1oltelfcsas) rrmx  ou0opxnio3tadls2emn pn(0 rxoio tytlaDeln slt0texrxm3ny4olenlnei (faDrauroot4oex  ietad aDean o;u)tlermfcty1la  aivil()t2xrim3oy1lmtelivta(fartrxmont1opeomf3ilsfaDrm(mpnt0 lenmr oadlm eaues t0teumxr nodapteliesat s2ta(rooo4ale moctatfa2ean s;u0arxrirctotfatraneils)sruoim io4lm nmnesas) rum(r ;o1aptnmfeildla2rm(vpnu4alenmrcoytfa r n s t  2umxr oy4ope lfvsls)srum(  nt4olxn ocildla elnmo t0 reoif3totom e nvi;(0t2urio3iy4lltnlnct t a2ur(m nt1oeeomictlsfm rmnmp u4teerxrctotfpt auvo ()teum(rpiydlme lictls s2tru  ;u1oeenii3iltla umnmont) etrircto1lp   u i t0 2xrio3no4llte ncia(f rta( ono0apxomieilsls el( s;t0aeeomoctytom elies (  ruoirpno4ll  mictl()s2ua(  ;o4oltoiiciadfa2ulumpnt0arxnio oodfm   ueilt)s2xr(o3ou4amtn ncslt) ruru poo4opx ifeilsfs rm(mp u4tetnifcootlmD aues;s0t2uo(mpio4lp elneil(fs2tm( pno0tltn feiadfa ulnmp t) leoio tytfpt  uvo t0 2urimpno1altnmfvsas)sDrrur no1tpt mi3iad m2el( o;t4 lenxr to1faDraneo t s2uoio oy1aptn nvta(fsDrr(r ;o1tpeo f3iaslm2umums (0texniocoodfpteanes s0teuoio3ou4omt livi sfs2um(rpoo1opxomo3iytfs2rlu snu4artrirciadfa elnvi s s2umio3oudom nmnesl()sDtm(m ;o1oet if3iydls2rln o;()altnio io1faD  nvi;t t2ur(m iodlp n nesltf Drm(r ;o0teen i3iadlaDuaumo;t0 lxnif3io1fmDeauvi t0texoxrpoo1op nmiet ( aDtrump;u1oetoiieiyd s elu p (4 rtnmrcoo1fmt  u o;t trxo(mpoodape licsa(  rrrurpnu4aleniieilslm em(mo (0trenxr3ootlmDr iesls0 euo(o oo4apenlfvtatfaDra(m nu4oleo i3iydla2elu on()tltrxfciy1op e u olt)t2umxm3ny4ap nmfvils arrr(moot0tleoioetasls rmu p u)aetnmoctadlmt  ivi;t texmxr ou4omenmfctat)a2tmx  nt4opx ioeildls uluvs (4texnif3oytfpDeluvilt  eto(o3ny1olte fctls) Dtm(r ou0ope iieilsfa2rmu p;u)altrxf oadlm rln i t0 rtmio3no1al   nvt t  rta(ro;t0apx moeilt sDranmp (0tetrxf tatfmDe nei t trxmxo ny4am nmnvs tf rrau p;o1tlenmieiasfs ea( p u0texrircootfpDran o;t t2toio3oy1am emfvi (faDra(mp;t0aexniieiydlm2rm(vonu)altnxr totlpteai o;s0t2xoio3oy4lltemfctlt srrr( onu4olxnmocilsla2eluvs;(4artomr oadlatelueil(0 2um(opnodaleelfeias sDtrumo;t1aexoio3iadfs2em(mo t)alxomr3oy1oaDe n i t)sruo(opnu1ale lici s)s2uaxront0alxo ocilsfsDum(vo;u) eeomf oodoa rlies ( t2urir3oo4apt liciatfsDua(r nu1aptn f3ilt sDumumsn() rerio tytlaDr uvilt tetm(opoy4om   ncia( arua(ront1aptomocild mDrlnmp;t)altrmr3ty1laDraueo ()trto(rpou1omtemnei () ruaxro;t1oexo ieild m2ranms u4arermrcootomD  ivo;t s2xm(rpny4lmtn nctlsfsrur(mo;o1alxniieiyd aDra(vs (0texrmr3ootfa   nvo t0seto(rpiodlmt mieiat) Dumu pnu1ale iiciysfs uluvp;t0arenmr3tydoaDean o;s trtoim iu4opt  ivi sfaDtrx poo4aex ifciytla ulnmp;t0areomr tytlmDe ivi;s  exmxopnodom  livsas aDtrur ;o0tlxomoeiat a ul(vo;u)arxoxrctodoa rlueilt s2xrxr oydll nmfvsls) Dtmuro;t4aeenmo3iysfa2ulnmpnt4aexnir todoa eluvs;t0t2trxr3nodlltemfeils  2ur(moot1alen fciat a ua(msnu0 ltrir iy1oa rln o (  2xm(r3iydaleelncsl(  Dtm(mpnt4oexo icilsfs ua(vs (0aetoxo totfp  an s;t0tetoxo oydal  mnetlt a2um(monu4alt ifctad aDeauvs (4artnmo3io1lmD lnvi s) rxoim oy1amen nei s)a2ur(mp;t0oex moeildfs el(vs;u4artnxo3iydfp r u o s)t2xrxrpiy1amt  ieilsfs2taumont0olx  feiasfs um(vont4aexoif oodoa   uvs;t0seurir3iu4alenlfeslsfsDtr(mp;u0oleomietldls rauvs;u)arxoio iatfaD lnvs t0t2toxm3iy4lm elfcil(  ruaxmont0optoio3ilsfm umn snu)tltrio iydopteluvo ( teumimpno1ll nlietas  Drm(m ;t4aeeo fciadfm um( s;u)tlxrxfctytfa eanvi t) 2xmim oudopeemnes t) 2trx  nt1ale ii3iysfs2eanvpn(4aexrxo tytlaDeaieolt)s2trxo oy1lmtnlivtls)sDurxr ;o4oltnmf3ias aDuaums;t)tltnxf oatopDeaivils)t2uoim oudap emieslt)arumumont0texn feiysls uln s u4 exomr tydfm rlieilt)seto(rpoudomtelfes ( a2rrx pou1aptn f3tatls eln s;(0 lxomr oytopDranvi;(0 eurxo3iodal   nctlsfsrum(  oo4tlenio3iatla2emnvsn(4trtrxr tatfpt  nei t)s2xmir3nudamt lnesatfsrrrx  ou1alt  octld mDumu snt0aeenmo3oadoa  lu o;t s2urxm3oo1al elnvs s a2rax  no4aeto octlt s uanmp;u0 exrif3tydfpD livsls seuoxo oo4llen neiatf Drm(mpot0ape if3tlsfmDuau p (0tleomo oytlmt an i t  2tm(r3oodape lict () rta(m ;o1olt mo3iyt m um( ont0tleomoctydlmteaneilt)texoir iu4alee nvs t a2rrxmpou0oeeoif3ilt a elums;u4aexrircto1opDelnvi;t t2tmxo io1ape mivslt aDua( o;u4aetnmfciydlaDrmuvsnu)arenxrcoy1omtraivo t) 2xo(rpnydoptn fvil(f 2rrumo;t4texo o3ildlsDuluvp;u4 eerio3todfmDean s;(0t2uoxo nu1al eliei s aDtmumo;t4aee  ietas aDra(mo (0 rxnxo3to1omD  iesl(0sexmio nudoptnmivslt)s2ururooo1olxnifciltfaDrmuvp;u4 lenxo3todoaDr nvi;t)seto(r iydoleemnvsat aruaumono1tpx mi3iltfaDumuvpnt4aetnirciotlp elieol() rxoim3iudolen nvsls)srtaxronu0tet mo3iatls2ea(vsn(4alxoif3io1oaD  nvi;()s2to(r iu4lme  neia( srtmur ot4tlx mfeils m umuvont4tlxrmo oatlpDean s s)seum(mpnodaptnlncsatfsrrm(mpnt0apeoioeilsfsDranvp;t)texnir iatoaDr uvsls trxrim3iy1ape lnvtat  Dra(m ;o0tee  i3tas s rm(vp (0aleoircoadfa rau s (0 rtr(r nudlmeemfesls sruaur oo4opt miciatla2eaumont4aetrxfcio1la rlu il()t2umir iu4ape lfcs tfa2raumooo1tpxnmieiys sDrlnvo;() rxrxrciatfpDelivs;()s2umir3nu4amtelfvt sf rrrx ooo0oleo o3tltla ea(mo;t4tltnircio1fat  ieo;t trtmim iudalee fct s)sDraumpot1aex if3iysfs2umnvo;u0tlxomoctodfpt lu i s) rxmxr iudame lfvi tf 2taum nu1ole  iciatfs2ra(mp (4tlenxo iadlmt  i slt0 2tr(r3oy1alte fctl( aDra(r ;o1olxn fcild mDea(vo (4 rxomr totlm ran o s  rur(r nydapte nvsat srur(  nu4
\ No newline at end of file
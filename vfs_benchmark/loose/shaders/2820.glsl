@@ -0,0 +1 @@
+uei () rxm(o ny4optnmfcsa()aDur(ro;t4apxo o3tadlm2elnmo;(4alenxocoydoaDranvils srxo(o ny4llt mnciat)sDrau o;o4tpxo fciys mDuau pnt0tltrmociatfmDr nvi;(  2tr(o3iu4op elivil()arrmx  nt0olt if3tltfm rlu s (0alerxocoadlat  u i ()tetmxmpio1llen icsls arrm(mono1oeeomicildla ulump;u0 ltnio3tadopDe ues;t0t2tmxm3no1lpenlivta(fa2umumo;t0opxnmoeiat s2emn o;u4tltrirciodlmDr ivols)trtrir ny4oltn nvs t  2trxroot4optnio3iytlm2uanmo;u0artnxocoo1fp   nvo ()s2umio iy4olee ivs t)aDumxm ;t4optnmociydlm2rluvp t0trermf3tydfat  u i (0 2umirpno4altelicsls)s2tm(rpnt4oltoioeias aDrm(vo u0 exoxocta1fmD auvo ( s2trxo3nu4am nlfvs s)s2tm(moou0tptoifctltfa rmumsnt)arxrmo3iatlpD aieo t0s2toio3oy1om  lfciatfa2tm( oot4tleo o3iyt m2umumo;(0treoir oydoaDeaiei t seuriopoo4ol  mnesa()srrrxmpoo0oeto i3iad s2ua( s u4 rtnmf ia1laD lieo s t2toimpnydllte fcsa(fartrumpnu4aptn fciatfaDel( p (4aetnxr3ty1lmD  ues;s0sexoirpoydalte fcs t  2trx oou4aleomieiytla2rluvo;u4artnmf iodfaDraivi;s)trur(m no1llt  fcs t sDum(rp;o0teeo fctys aDeluvsnu4aetoif ty1fpD  nes;t)s2xr(m3nu4ol  lnvia(fs2umur oo0oeeomieiadfa rln s;u)trtnmr to1lpDeaieo;s srto(rpoodlpte fesat)aDumu oot4aetomi3tldfs2ul( p u4arerir3iydlpt liei;t  rxrxm3oo1amenmneta(fsrrrxr ot1tpxomociydfa ranvp;(0aeenmr iodfa e ivols0 2uoimpoydome lfct t) 2tax onu4tlt moeild m ul(vo () ltomoctatoaDrau slt)t2xoir3oodaptemfesls)arrmxmpno4aexnifciatfaDumuvo t)tetnifcoydlat anesls0teurio3no4altemicsls)sDta( o;o0altnif3iaslsDulnmo (0tleoif ty1lmteaiei () 2tm(m oudom  mfcsas  2rmurpnt1alxomietytls eln s t4 etoiociydfmtr nes;s) etmio nu4ol  lfvslsf 2trur ou1tltnmiciad a ra( onu) rerioctydopDelnei s)trtm(mpnu4omt  iei t)srtax  ;o4tltn feildlm2uauvs;t) rerxr3todfat aiei;t  2uo(o ny1lm e fvsa()s2rmump;o1tpe  icias sDrm(vsnt0texrxr to1fmDeanes s)s2tmxm3oudapt  ncias)a2rau pot0optomfeiaslmDrauvp;u0teenifctotoptrlneo ()tetoirpno4olte icsa() 2rrxr ;t0aleoioetysfa ra( s;u) rtrmo3oy1laD lnvo s s2tmim ny1apt mfvsls)sDrax p;o1opxomoeiadlmDea(vs;u0artoxr3iatop rlu il( trtmimpoo4apt mnviatfa2taxmp;t1tlxnifeiydlmDumuvp (4 rtrxfciadlpDeluei;( teurxo iu4al nlnvt sfaDtmxm ;t0ale iietlslaDuanms u0 rtrmf3tydoaD luei;() 2xmiopiodlpe lnvsl(  Durum ou4apxo ociadlmDua(mp (4arxrmf3tatlmDean slt)texo(o3nu4aptn net (faruaxroot0alen f3iysla2rau o (0aeermrcoydfpDr i ols)trtmir nudlp  lfcs tfs2urx  ;o0apenif3tas sDel(mp u4 exoxo ta1fp   u i;s0 eumio3iu1ap e iet (fa2uaxr no4teenmfcias s2emump;() exrxfciotomD  n o;t0trxmimpiy4oleemnctltf 2tmxmoou4apt iieiasls2ulnmsn(4 lxoxfcoo1lp rln ilt s2toiopno4lm nlfvtat aDuru o;u1texomfeiaslm eluvpnt)aetnmf oodfaDrluei ()seuo(opiu4ame mfet ( aDumurp;u1tlxoiociadls2rm( p ()tltrmoctydfpDr n sls)t2tmxr oy4oltnmfvi ( srraxr ;u1opxnifetadfaDelumo (4 rtoxo ootfp r u sls0s2to(o nu4am nlfvi ( sDrau oou1oeenif3iytla rmn p;u4 lenif3to1laDeaies;s  etoim3ny4am  mnvtas  rur(r oo1alxoii3iasls uauvp () etnmrcoadla rlueilt0 rxrxr ou1lmeemivsatf rrax p;u0alx  ieiadlm2el(msnu4 exrif3iotfp   ivilt) eum(mpiy4opee fvsat)sDur( pnt4apeo ocilsfs2rmumo;(4aexniocto1oa r u i t0texmim oo1al nmnvi t)srraum ;o1oltnioetad s2uln p;t0tlxnxociy1fm e n i t0teuo(rpnu4lmtn fct (fsrumurpnu0tpe mo3iltls2uauvon(0trtrio iy1fpD  neol( t2xoim ou1op  lnci ( artmxront1tpx ioeiad s uln p;t0tetomo ta1fatranvi;t setmxm3oudlltnmfviltf Drmur oo0olx  ociltfaDumnvon(0teenxf oo1fa  auvi;(  etmimpnudoptnmnctl() Dta(rpnu1oex  fciydls ran s u0 lenmocoadfm  lues;t) 2xoio3iy4opeemfct tfsrrrumpoo4olx  fciaslm uanmp t)aetrmo3tatfaD auvil(0teur(o iudoptn ivtltfsrtrxmo;o1teto oeild s2umuvs;t0 rtnmfcta1om e uvilt0 rxoxrpoydam e nci sfsDrr(rpnu0aee mfcild sDrmumsn()aeerifctodfp e u o;s  exoirpno4omt lnei t)s2taum nt0tpe  fcilslsDrl(vs ()arxnio3ootoateli il( srtrimpoydapte nvs t)arumxro;t4tpt  fciltfs ulnvp;(0aeeomrciy1lmDe u o;s)srxmxo nu1opte fvsasf Drmxroou1apeo ictat sDrmu s ()altrmoctatoa elneolt)t2xo(o3nu1ame lnctas)a2ta(rp;t0olx mf3tadlsDeaumo;t4aeerxo3oa1laDeli ilt)texm(m iy1omeelietlt)srumxmp;o0oeen f3iyslm2rln sn()trxrxf3tytlpDeau i (0srurio iy1altn icilt  Dtmumo;o4tpenifctyslaDua(vpnu4aetomf oydfa  aivo t0s2trir3io4am elfeslt artm(rono1tleoiietlt s umump (0 rtnif3oytfpDrauvo;() eumxopiydlltelnes ()s2taumooo4oee mfeias s2ua(vp;u0alxoir3oadfm  li i ( t2xrxm3oodapt lncs s)srrm(rp;t1apeomoctlt aDuln snu4aleoir oodopDraivi s seumio3nodllee ics ()sDurxr nu0tlx ioetytlsDua( pnu0artrmociy1fa   neols  2umimpoo4apenmictat)sDtrx ono4alx mi3iytla um( s;u0altnxf ty1la e u s;s0 rurir oy4ol   feil( aDtaxr nu4oet mfcild aDuluvsn(4 lerxo3ootoaDe uei;t0s2urxm3nudlptelicil( srrmxmo;u0opt mfciyt a uanms;(0tlerif ta1lp  an i ( trumio no4open ivtas  rumxr ou1tpeomf3iydfs umnmp;t4 lxomo3oy1lat anvsls0 eum(o ou4ame mfesa(  2uax o;u0aeenmociat a umnvsn() eenxoctotomDean il(0seuoxr3no4omtn ict (fsruaump;t4opx ifeiytls2ulnmp;(4 exnmr iy1oaD an sls  eumimpny4omte icias srrmurpnu0olxnmietydfm raump t4 rtnircio1fmteaivs t)teuo(r3oo1lmen ncsasfaDra(roou0apx  ieiltls2ea( p;t0trenxrcootlatr ies s0t2xr(o3oy1lmt mfvilsfarrm(mpnt1opxnmo3ild sDrl( sn(4trtrmo3oytlatr nvs;(0setrxr3iodlleelfei tfsDraxmpoo0aetnmf3iaslm elnvpnt4 reriocootom eauesls srtrxr nodam  lietat) rrmxmo;t4tpto fctyd a2um(mp t0areoxf3iydlaDr i s (0 etrxm nudlmenmfes s)s2trxrono4tpxnifctaslmDrmump t)artoxfciadop   n i s  2xm(opny1aptnmfvsl(  rurumoot0tpeomfciat mDumnvo;(4trxnxo3ty1fm   iesl(0 rumirpnu1al eliesl(f 2urum ou0aet  oeiytfa rln o u) etnxo3oytlmt auvs s) eurxmpiu1lp n ncs sf Draumpnt1tlto o3iatfsDel(mo;u4teermo3iotfm r n sl() rtrim oudamtn ietlt)aDrrx pnt4tex ifetltfa2ul( s u0tlenxo3oadfmt lu i;s  rto(o3oo1al e fvt t)a2raxmpno1aee mocilsfaDea( o (0 etrxr todom  au ol() rum(rpoy4aptemnci tf Dumurpou4oex iieiat s rau o t0 exomo3totlaD lu o;t0 2uoxrpno4lpeemfct t)a2tr(  ;o1apx  octat m ulu o u4 ltrmr3io1lmDraies;( s2xm(o ny1lp n fcs ( sDraxm no4opxn i3iydls2uanvo (4 rerxf ty1fpteluvs s0 exrim3nydal e fcs ( s2rm(rpou1alx moetltls raumon(4 rxnmf iy1lmt aivo;s)setmxrpiu1lleelncias aruaxr no0tlx  oeilsfa ulu p t)tlenir ty1optrluei;()srtr(mpoo4lle lieslt  2rm(r ot4aee mi3ilsfm eanvp u)aleomf3iytomte nvi;() exmir nudlp emnei ()sDtax ooo1alenmi3tatfm2ean ont)trtnxfcio1oaDelneo s0tetmxopiydomtnmietasf rumx pot0tltnif3iys m eluvp;(0 lxomoctydfm eli s;s  eurxmpoudlpe  fvtas a2rm(r nt4aetoioeilt m eluvs u4alerxoctadoa  ai i;()s2umir oo1lme mivtlt)sDur(mpot1texomi3tat s2uln onu4 lxrir oo1fp rlneils trxmxr3io1ap elfeils s2tmum ;u1open ociatla rau p u0arerif tydopDrlies t) ruoir3iodaptemict t)aDtmxr oo1olto ictyslm ulumonu0alermfctadfmtrau o ( trum(r ou4lmt mnvt t) Duaurono0aexo oetyd sDuauvo;t4tleoif3ia1oaDe nvo;t texmim oy4am   neil(fs2rru o;u4olxo fcild a elumsn(0 exoioctatfm elneo;s)t2um(mpoodlme mfvslsfs2taumpnu0tlenii3iadfs2eauvpn()alxoif3iy1oaDe ueo;s)truoiopiydll nmnvtls sDtmum ;u4teeniictad m2rln s (4alxrir to1om rlueo t setmxmpiudlp elnvil(  Durx ono1altnmi3iad a2rl( ont0 ltomfcia1fm   nvslt) eum(r ny1lm e feiasfarumur ;t4opxnmociyd m2ran pnu)artomr3ootop  an sl( t2to(m nodopt mieil(faDra( onu4aptoifeiatfs ulnvpnu0tltnmr3io1op rln i;t  ruoim3oy1amt  fetls) rrmum ;o1tetn iciadlaDul(ms;u0altomo totop  lnvs;t) rxoirpiudomtemncta( aDraxm no0apeo i3tyt a umn p;t4trtrmf tytlm ran s s s2umxm3ny1ol  miet t) rrm(r ot1oeen o3iltfs2ua(mo;t)tlxnmo3iydopt an o s trxr(r3iy4op   netltf rua(ront1tlxoiieilsls ua(mpnu4 etomf3ia1fa raieo;()teumiopoo1lp  lfesasfaDrmurp;o1tptnmictad s2el(mo;u) rtnir3iytlp eaneslt)teur(mpoudlmee fei (fs2trx pot1teeo fcils a2rmnvo (0alxnxr3ta1lm rlu o;s  2xoim3iu4ap  mict sfaDua(rp;t0apxniiciyslm2ulumsnu0trxoif3oydfat an i s t2umio3iu4olenlfctat)s2ra(moou0oeeomfcilsfm umuvpnt0arenmf3iydlmt  u o;( srtm(rpiu1op  mneiatfsDtmuroou0opx  oeilsfs2emumonu0aexoxocio1lp e n sl() rtmio nodap nlfctls)aruaxmoot1apenmoctas m2ranvo u)artoir iy1fmtrliei;()tetm(o nydope  nvsl(f 2trur ot4aptomfcilsls emnms t0texrxf3totlpDean o s0sexoxo nu1ole mnvi s)arrmumono0tetnmi3ildfaDulu snu0aexrmo ia1oatelnvi s)setr(mpiy1opte fet s arurur nt1alen ieiydlmDulnmo;(0 etniocta1oaDran sl()teum(m iu1altn ieiasfaDum(ront4aexo i3iat s elnms t0 rxnxr oadlpt lu s ( tetoim3ny4ape  nesas) rrrxront1aleomo3iyd mDemnvsn() lermf3oo1opDraivs s0t2xriopnu4llt mics s) Drmxm no4tpxo i3iyslsDrmnvo (0alxomrciy1lmt auvo;( trxmio3io1aptn nvta() 2tmumonu4tpxo oeiysfaDea(vs;t0 ltnxfcio1fmt  uvol(  rxoxo3oo4llt livt t  2um(m ;t1teto oeiasla el(vpnt)teeoxo3ia1lp rliei;s setrimpoy1lmenmneiat)a2rm(m nt0optnifcildlm eau o;t0trxrir iatfptelnvs () 2tmxo3iu1omeelics t)srtr(mo;u1texomfetytls el(msnu)arerio oodfm rauvo;s0t2urio oy4apeelfeta( s2umu o;o1tptn i3iydfm eln ont4 rtrxrcoa1om  li s t) euo(r3oo1om nlnetat s2rmum ;u4tptomfciltls2umuvs;t4 rxoxociotoatr n sl()trurirpoo1lm nlictlt  2uaxmpot1olxomietydlmDelnmo u0tetrxo oodfpteln ilt)t2toim oydol elfvils arumurpot1aee  i3iasfs2ul(vs (0 ltnxr todfp raneo;s)srtmimpnu1olt mnciltf Dumuronu1tpx moeiyslm2umnmp u4trxrxf io1faD  uvi;s0setoxr3nu4lp   ictatf Dum(rooo0opt  f3iys a2rm(mp t0 rtnxr3oatomD  ivi;t  eur(m3oo1lme mictl( arrr(mp;o1oexnmf3ild m2ulu pnu4altrxf tatomDrluvslt0srxo(m nudapen fet s)srtm(rpno0apeo i3iysla2ulu o;u0aetrir oadfm   nvo;s0trtrim oodlp nmfvtls srtmum no4oeeo feiat m2eaumsnu0alerif oa1fmtelivsls srxoimpiodom e ietat a2tau o;o0opxo o3ilsfsDra(mp u0texoxo3iodla  anes t  2umim nu1lpt lnvtat) Drrxrp;o4oetn f3iydfsDum(mo (0 leoxo todfpD  uei;t) 2xmiopio4ol e nvs s) rtmurpnu4aex  ieiat a ulnvpnt0texnifctodlmtrluvs ()t2tr(r3oo1lptn ncias a2rmum ;o0optoiieiyd a ean p;t) rxnio tydlaDe ieo ()sexo(m3oudlmtelfcil(f 2raxmoot1tee  iciltfaDrmumpnu4tleomo3iotlm  aueil(0trum(rpoy4ap  mneslsfarraxmp;t1ole mictltlsDrauvo u)artomr3todfpte ies;t0trxo(mpnydop   feiatfarrrxmp;u1apt mi3tysfa em(ms t4aeeomo oy1lmDr ueols srtoim3iy4ll nlfciltfarrau pnt4alx ii3tatfs2umnvs;u)tltrxfctodfmt an s s  2xmxrpoudome  ict ( sDrax poo1tpeo oetasfm2um(mp (4 renmfciotomt  neol()seurio3io4apenmfvia() Drrxrono0aleomfeiltfs2rl( p;t)tltrxocoadfmDe u s;s0 2uoxo3oy4lpen icta(  rumxmpnt0tpxoii3ilt a2uanvs;t)teermociadlaDeanvi s)tetm(r ny4omenlnci (farum(mpot4tpe mo3tltlm rmn o t)arenxf oy1laDran sls0 euo(r nydlpe livi t  2um(r no1tptomieiad mDrl( onu0alerxfcoo1lm rauesl(0t2xrim oo1opt  fci t)arrmur ;t4tpeoioetadfs2uaumon()arxrxociy1lptr u o s)srto(rpiu4lpeelneia(farumxrpot0olt ioctytlsDra(monu0arenxr totfmtr ies t0truoim3iu4lmt licsl( sDraurpoo0apx iieiydfm2rmn pnu0tetnio3ty1lptrauvol(  2xo(mpiu4lmt lnvi t)aDtrxmo;u4tpto o3iydlaDra(vsnu0 leoxr iy1lpDeli o;(0 ruoxo nu4lmen neslt)a2rmumoou0oleoio3iydls um(mo;u0trtoio3tatfp rluvi;()trxoiopiodllte ivs ()srra( o;t1oeeniociatfa rmu p () rxomr3iytopt  uvo t0 etrxm no1alte nvsl(fsDum(  nu4oexn ociltfmDrmuvp;()arxnmo totlmteau i ()sexo(rpny1lpt mfct ( a2umumpnt4oexniiciatfm2rlumo;u0texnmfcoadoateauvo;t srtoiopio4lpe mfesa(fa2rm(r nt0opx mfeiytlm2elnvpnt0 etnxo tytopt au o;t  2xoxopno1lpe  fciat)s2uaxmonu4texoiietys a2um(vonu)arenir3iydlpD ln ols)trtoim ou4lpt mfeslt  rrrxr ;o0alxo ieildlmDum(mp (0artrxoctodom eluvol( sruriopoy4am eliei t)s2rax  nu1tlxoifetltfm rmnvpn(4alxoxrciy1oaD auesl( seuo(rpoydllt mnei t a2ra(mpno4ape ioetytlmDul(vpnt4aetnmfcta1fpteauvo ()s2tm(m oy1omee ies ( aDuauroou1tpx mi3ildlm el(ms ()alxrif3iy1fpDrauvs t)texoiopno4om n nci s sDtmumoou0opt  feiydfaDemnvp;t)teeomo3oa1lmtrluvi;t  ruoir no1omeemnvias  rtm(r ou4aexoiiciyt m raump;(4 rxoif iotlm   i i;t)tetmir3nudol nlfvs s)sDrrxmpno0olenmfetys m uaumont4tetrmrcoa1fp eanvil(0truoxo iy1lm nmivils)s2ur(m ;t0texn o3tadfsDulnmon(0 rtrxf3iotlmtelivs s)sexmxo ny1al n nci sfs2ta( pno1teenio3tlsfaDum( snt0 rtnmo oy1fmt auvo ( seurim oudalt  nvtasf Dum(mpot1apeo icils aDranmo (0aexnxrctadfm rln ol(  etoxrpoo1lp emfei s) 2ua(r ou4alto oetls s2rl(mon(4tetnif3oy1lp r neilt0texrir oo4llenmfvtlsfartax pnt4alt if3ild m uluvs u4trxoxf oodlpDr neo;t0 rxoimpiodope mics ()s2ur(ront0oexn ieiad s eauvp;t0 eerircoodlptr u ol() 2xo(r3oydam n nvsl() Dtruroot0aetoiiciytfs2uan s;u0aeeoirciodlm  aieol(0sexoxo3iy4openmfvils a2rau  no0olto feiyslaDrl(mo t0tetnio3ia1la  aiei (0setrxopoo1lptelnetl(f 2taxmp;o0tpto iciyslsDrm(vp;t)artnmocoo1lpDelneo;(0texoxopiydale  nctasfsrtrxrpou0apt moctadla ranmo t0tetnxf3iotlpt luvo;( seuo(r3no4ome liciltfa2rrurpnu4tpxoiocilsfaDemnvo t)teeoir iydlmt  u o;( trurim3iydom emncs s  2rau poo0tlx mfciys a eluvp (4aexrir oydopDeln i;t texmxm3iydlleemnvtatfsrurxmpnt4apeomfctydfsDrmnvsn(4 leoxf tatfatrai s;(0trxoir3nudal elnci ( aruaumont0alenmfeiyt aDelnmo;() renir3iotopDr u sls)t2ur(o3oy4amenlfvilsfsrrrx  ot1oee iieiysfmDemumsnt) etnif ootfmD lnvi s0t2toim ou1opee fci t)aDtmuro;t4teeoif3iyd m ua( p;t4tetrmfcoo1omtelnei t s2tmxopny1llenmneilt  2rauront4teeomiciysfm2emump (0arxoir ia1oa e neo;s)s2tmxrpny1opeeliei s aDtaxronu1tpx mocilsls2em(mo;u)tltnmfctytfa  lueo t)srtoxrpiy4lmee nciatfarrm(ro;u0tpt  feiydfs ua( s u)arxoxfcio1lpt lnvs t0texmir3io4optnlfct t  Dra( ont0aeenioeild m ul(vp u4trxoxoctatfatelues;s) 2umxm3ny4ol elictasfs2taxronu0tpen i3iadlmDrau p u4aeenifcoydfp r nei s0s2tm(opiy1ap  mncta( sDta(m ;t0oexomfcild m2rluvp;t0tltnxr oo1fp r nvils0sexmxmpoydlm nmnetl(  Drmx poo4tptomietad aDumnvpnt0aeerioctotfmDr nvo;s0seuo(r3io4lltelfcs ( sDum(m nu4alxnifeiyslm2ul( s u4tltoxr3iatlp rluei;t) rtmir3iu4om elfesas)srrrumo;t0aet  i3iltlm2ul(mon()alxnmo oo1laDeaues ( sruoxo3ou4omt lfvt t  rtauro;o1tltomociydfa2el(ms;t) exoioctatlpte uei;(0 etrxmpnu4lle  ivt s)artrxrp;t0teto fciydfm ra(mp t0texoio3oa1lp elnvolt0srurxrpio1ll e fvslt  Drr( o;u1aex  i3ils s2um(ms (0 ltrioctytomDeaieo s texrimpno1amenmfci s aDtmxr ou4tpxn ieiaslm ea(mo;t0altnir3ta1op eaivi ( srumxm oydapt lfcs s)s2uru o;o0ole io3tlsfs ulnmpnt)altomr tadlaD  nesls)texoxopou1lptnmfesltfartrumooo4aetomo3iat mDeau pn(0tlxrircoydomDr ueolt0srum(r io4am nlics ()a2rrum ou0ale  fcildfa ra(von(0teenif3iotoatr nvslt0sexmirpoydopenlfvilt)aDta(ro;u4apxnifctldfsDua(vo;() etrmo iotfmD lneo t0trtr(r oo4lmtelnei s  Drmxmonu1olxnmfetyd m2rlums;() rtrmfcootopteln o;( s2tr(opiy4lpt licils) rtaumono1ale mi3tas mDel(vpn(0alenmrcoydlate n s;s0srtoirpiydapt mnctasfs2rmumoou0alxo ociyd a2eanms;u4aexnif oodfptelues () eurxm nodame mncs ( a2ua( p;t1olenifciad a2eau sn(0altnif3oydlatrlu ilt  rurxr3iy4ap emiet (fsrrru o;u1oetn i3iys m2ua(vpnu)trxomo3iodlateaies;t)t2to(opiydlle mnesls  Dtmu o;o1tlen i3tytfaDrl(msn() etrxocta1fptelueo (0t2umimpiy4ap elnei (fs2rrxmp;u4altomfciys aDem( pnt0tetrmr3tydlp r ues;s setm(rpiy4omte iesl(fsrum(mp;t0optoioctldfaDumu onu0 exoxo3iatoaDr i olt) eurxo3oo4lmtn fvsa( a2ra(root1opto feiat s2umn p (4aeenxo3iadomtr nei;t sexmimpoo4omenmfcta()sruru o;o0tle ioeiadfaDrauvo ()tlxrif iytla elieols0s2tmir iydam  mncia(fs2uaurpnt4tptomoetlsfm rauvonu4tetnmo3iatopD luvsl(  exoio oy4olee ieslt  Dtaxmont4tpxnmoeias aDuaums t)trxrio ootlmtrlnei;s) exoirpno1lp nmieil(fartm( ono1ole  fciyslmDrl(ms;u)arxomfctatfpDrau o;t)seurxmpiodol nlicil(  ruaxro;u0aetoiieiltlsDranms (0 rxomrctodfpDr neils0t2tr(mpiu1oleemfvi (  rurxmpot4tle io3tydla2rmu p u) eenif tydfm r n i;(0 rxrxr nudalt lnvilt)sDta(rpou1apt ifetys s uanvs;t4aeerxf io1oa e i o ()trtrxmpnodam nlieils)aDta(roou1alxn i3tydlm2eanvp u4alxoxo3oa1oa  anvil( trxmxm3iy4am  lnvt ()srumxr ot0aee iieiasfs2rmn o u)alxrmfcio1oa e uesl() 2ur(o iodopenlfesas s2rmxm ou1tpeomictyt s rmu p t0aexnxfcia1lpDrli ilt t2uo(rpnu1opeelfvtlt a2taxm nt0tle ii3ilt a rm(vp;t)aexoxrcoo1latelivil(0 rxoxrpiodalt lfvtas  rumumo;t0texnmo3ild s2rmuvo;()altnmociadfmtelneo t0trtm(m3nydomtelnesltf Dtauro;t4alxoif3iatfm2emu o (4arerir3ia1laDeln o;s) rxmimpiu1am  livsa( s2uau ooo1aptn ieiysfm2ean p t4trtrio3iodoaDe i i s0 2xmxr no4om  mietlt)artmx o;o4olx  icias aDuau s;t0tlermo3iatfa   i ols0trtmxo oy4al e fvi tf rum(rp;o0optoifctyslaDemn o t) lxnifciadlmDelivs s) 2um(mpny1lp   ncils artrxm nu4tlxn f3iaslaDranmont) etrmo totfaDean o;t0trxo(mpiu1optnmfcil()aDrax  ot0alxo oeiadls2rluvo;t)tleomr oy1om rai s;s s2trxo3iy4al e nes t)srtaxronu0tee mf3ildfm2ra(mo;u0aleoxfcto1lpte ieo t  2umir oudolenlfvils)aruaxrpnt1opto oetyd m rl(von() rtnircia1lpt auvils0trumimpiu4lleelietas  rtr(  oo4apen icilslsDem(mo (0 rtrxocia1omt an ol(  2tr(m3iy1omte fcs t)sDrmur oo1apxoioetyt s2ulnvsnu) lxnxociadfp  an o t) rur(opio1oltn feia(f 2uaum ou1olxnif3ias sDul( pnt0altrxrcty1fmD an o t0trxrim oo4ol nlnesl( sruru p;t0tlxniietyd s2rau p;u4tltrifctytoa ranei s) exr(mpiu4oltnlfeia(  rraxm no4apxomfetyd m rmnmsnu0trxrmfcta1op   neils)texrirpoodlltemfvils a2tm( pno4oee ii3iltfs uauvp ()tlxnxf oa1oaDraiei;s0 rtm(mpiodll e nct tfaDraxroot0aeeoif3iyt m2eanvpnu0arxnxfcta1lmte ueo ()trur(m iy1ameelivil(fsrtau o;u0oex mo3ils m ra(mp;t0 etrmf3tadoa eaneo s0 exrim3ny1om emfvilt s2umuro;o0oex mo3iat s eanvsnu0trerxf tatlp rli i t trxmxopio1al  livil(faDra( p;u0alxo fetadfsDel( on(4 exrmfctydopDr iei t teur(o3nu1lpe micslt) rtru onu0oee mieiydfm emumo;(4trtrmo iadlpDrauei;s)srurim iu1omenlics t sDrru pno4tlto fciys a rlnmont0 exrmr3io1oaD lneo;t)texm(o3oy4lptelnes s  2ra(m nu4olt ii3tatlaDemnvonu0alxnxrcoo1la r ivo;( setrim oudlpenmiesltfaDuaur ;u4tlxomoctaslsDrm(mo t) renircoa1fmt  uvo t)trtmxm3iu4olenmnvi () 2rmx  ot1tle  fcilslmDum( s;(0alxomfcta1op rliei t) euoir oo4lmenlietlt)a2rrum oo4ole ioetydlmDua(vonu0trtnir tadlm eln il(0 2uoxmpoy4lptnmfei ( s2tmu  ;t0alxniieiasfm rlu o;t4aexnmr3to1fm  lueols)srur(rpny1amenlictasfaDtr(rpnu1tpxn f3tltlmDulumont)tetrxr ootlp  anei;(0tetmxopoodlpeelivi tfa2rmx oou4texn o3tys m2rmn pnt0 exrmo3ia1omteluvs s)trurxmpiy1olee fvt ()a2rmumoot4altn oeiytfm2eaumo u) etrxfcootoatr nvo;t setoxo oydlm  lieiatfs2tr(mpot0tet  i3ilsfs ulnvont)areoxrctytlpt  ivs;()t2xo(o3oodap e fcils)s2tr( o;u1tpx  oeiaslaDel(vp;t0aetnxf3iytlpt aies;s  rxrxo oodap elfvsatfarrau  no1tet mfeiatfs2el(vp;(0tlerxf iytfmDelnvsls)setrxm iu1lpt  ivs s)artaxr oo4altnif3ias m2ul(vp t) lxoxf3io1lmDr u o;t) rxoxr3iodam e iviatf Drru ono4opeoifeiytfs rlumo u)aexomrciotlmDe n o;t0 exmir3io4lpe livsas aruaxmp;o1tpxnifctytfmDel( p t) lxnmfctatfpD livo t0 2umio3iu4olee ictat srumur ;u4aptnioctatlmDrau onu) exnxr3totfpt aies t0tetoio3iudaltnmfcia(f rururo;u0aex mocilsfsDumnvo;u)tlxoxo3iytoatrauvi;( seuriopnu1am n ncta(  2rax o;u1tpen feiys mDrm(vpn(0texrir3iotlmt  ieo;t  2trxr3nu4op e fcia()srua(  oo1tltoii3tltfm2elu onu4tlxomfcootfm rai i (  rxm(r3oydop  lfvil()sDtrurpoo4tlto o3iadlaDrlumo t)tltnmf3oadlat livi;t sexmxm no1lmtnmnviat)sDtmxmoot0olxomf3iadfa2rm( p;u4 lxoxoctytlaD  i i s) exr(o3nodlme mnes sfa2rr(m oo4apeomieiadlm ul(vo () renxr3oa1fpDrai i;t  exo(o iu4oltemfvilsfaDurumpnu0tetnmfeiydfm2ranmo (0trtnio io1lpD anesls t2toirpiy1omt mfcil(fartru ont0aeeoif3tat mDrmumo;u0arxrmr oytoatrluesl(  2tr(m no4lltelfcs ( sDur(  ;u4opx mi3iysls eaumpnu)tlxoir tatop  aues ( trxrxr3ou1ome  icia(faDumxrooo0tee  ietlsla2ul(mp t0arxnmo oo1lm eaues s)setoxr nodolenmivtatf 2urxmoou0apxoif3iysfaDrlu pnt4trenmr3ootlp  lueils0t2xm(o iydolen ici ( aDrmx p;u1alx  feiys m2rmu p t)trtrxr3ootfm ranvo;(0tetr(o3oydlmtelfes (fsDrrxmono0olx  i3iatlmDranms (0aexomo3iatfaD anes;(  2xr(m ou1ap nmnesa() 2ur(m nt4aex iicildlmDuau p u0 etniocoo1fmD livo s0 euoxmpny4lpe lfvsasfs2raum oo0tlx ifcildfm2emnmo ()tlerxocoydfmtr ies;(  2tmiopoydll  licilsf 2uaumpnu1apxnio3ilsfa rmnmo;t)arxnmo ootoa rluei t0seuoxmpoy1ameelicias) 2umu pou1aeen fctlsfs ea(vpn(0alenir iydomt lneslt)setm(mpno4ol nmnvs sf 2tmxmp;o4ape  feiat aDel(vs;(0 ltomo oodfaD anes s0teuoio oydom n icias) rtau pnt4olx  oetlslm uluvo;(0tltriocoy1fmte nes t0srtr(r iy1am elies t) Dra(  ;o1oex  ieiat a2eau p t)aetoxfcoy1fa eai o;s setoxm3no4op emfvt ( s2uru pnu0tpeo ieiad a emnmpnt0tlxrif tadlateli s;t s2uoim oydal nliesa(fs2ra(r ;u0olxo i3tadfs umums t)altomocta1opDr ies;s)seumir oo1oltnlnctlt)srum(rp;u4optomo3iltfs2eln s;u4altnmoctotlpt aneo s0 2toxopiy1lp e icsltf 2ra( o;u1tltnifeild mDea(vp;t)teeomfciodlp eluei;t) rtr(rpnodlpeemnvtl(f rtaumont4ole  ociad s ean snu0 eerxrciy1om eaivil(0seurxm3nu1omen ictasfaDumu o;u1tpt  ociyt sDrlnmsnu4trenmrcoytoa eaivils0setoxo3iy1apt mnesl()s2um(mo;u1aptoif3iatfs2rm(mpnt)alxoio3iodop   nvo;t setr(o nodlpt lnvsas) rua(  ou1apxoiocilslaDulnmo (0teenifcia1fp   neo (  2toxopiy4amtnmivs (  Dtmxmpnu4apxomoetytfa el(vs u4alerxrctadomte ivols) etoxopou4amt lncslsfsrumxr ot4olt  i3iytfm2em(vpnu0teeoxr3iodfa   uei s sexmir3io1lm   fvslt aDurxmo;t1texn i3ild mDrmuvs t4 exoiocoytfpD  nvs;t0 2ur(rpny4openliesat)srum(m ou0oetomo3ilsfa ulnmp;(0aetnmrcty1fmDrli il(  exm(rpiudomenmnvsatf ruax ont1oeto octadfs em(mo;t)tlermrctotfp  lnvi ( s2tmxmpoudape  fet ()aDumxrpou1tlx mieilsls2em( pnt4arxnxrciy1lp rlues;t truoir3iydap nmfeilt artr(  ;t4aet mociaslm rlnmp t4 reoirctatfmDr neo s0 2xr(r3oodape lieslsfsrrmx oou1texomi3tytls2em( ont) exnmf3ta1lmtrlnvo;(0srumxo3ny4ap nmivtl( sDurxrpou0olt iiciys aDulnvp u)tlenxrciytomDr ueilt srxr(opoydlpt lnvtat a2taurono1ale iieiydlmDra(mo;u0artnxf3to1fpD aueo;s) exr(m nu1altelnet (  Dtmur ;o4apto feias s rau pn(4alerircta1om eli s (  etoxrpoydamenmnvtasfsrururpnt1tetniieiadla rlu o (4arermr iadfmDe ies t t2umxopnudlpe lnesl()aruau  ;o1ale  f3iydfmDea(monu) ltoxr tytoateauvi ()teurio3ou1lltnlivtlsfa2trxrpot0tetoif3iysfs2uanms;t4tltoxfciytlm eauvsl( srtrxr oudam  mnetlt  rtm(r nu0tpenioeiytfsDua(mo;u) lerir3oytomt aivs;()teur(o nu1olee nvs (f Dtrurp;u1tleoii3iyslm ea( s;t4trxnxf iytfpDeaivi t0texm(m3iu1lltn fvi ( s2trx o;u1olto i3ilslaDel(vpn(0 etomf iotfaD lu il(0 2xoxm3nydal nmnct s s2ra(rpnu4tpeomociadfm2ua( o;u4 rxrmr3totfp eliesls0teuoxm nudol  lfcta(farrrx  nu4alxoio3tydfs emuvpn(0texoxo3oatla  liei;s)srxmxr3nodalt liei tfaDtmu ooo1tptnmictatlm rmumsnt0texrmf tytopDrlues s setmirpoo1olenmicslt) 2truro;u1opxomi3iatfs rmu p;t) etrxo ta1om rluvi;(0seumim iy1lm nmiei s)srtaumonu1oeeo feiys s2uanms;(0 lxomr3iytom e nes;s0 2tmim io1omee ietlsfsruaurpou1apeoiocias a2uanms t0 rxomf io1om raneo;s seumir3oodlmtemfvtatfsDtr(  nt4apxn o3iasfmDel(vp (0 rxnmrcoa1laDr i s s) 2xoimpiudolte ici ( aDra(mp;u0opeo o3tldlm eau pn(4texnmr3ootfaDe iei t)s2trirpiu1ap nmfci tf 2urx o;t4tltomieiytfm uanmp;(0teermocoydlm eluvil(  rtoim oydop  mfetat)s2trxrp;t0alto iciyslm ul(mo (0 ltnif iotom  livs;()setr(o3nudal nlfvi s) rururont1alxomieiadla umnmo (4teeoif3iodoa  an ol() 2to(m ny1lpe mncta() rraumo;t0aleoifeiysfmDeau s t4aetomr to1lmte uvol(0srtr(m io1lpt mnctltfsDtm(m ;u0opxoiieiadlmDua(mon(4 etomo ta1oa   i i;s0 exmiopiu1ole  fei ()srur(rpnt4apenmf3iad m emnvs (4arxrxrctotop elneils0seur(m iodomen nct ( srumx  ot4aptoii3tlt m em(vp (4alxrif oodom eln o s)t2xo(r iodolee nctlsf 2trum ;t1oexn ieildfaDua( s;u4 rtnxrctydlm e neols)t2xr(r oo4ll n fvtas a2tmx poo1aee ii3ias mDeanmpnt4 etoxo ia1fm  auesl(  exm(m ou1altemivsls)sDtr(mp;o1altniiciatlm2umuvp t)teeomf to1lp elnvi;t) 2umim3ny4om  lics ( sDrax  ;o4tex moeiatfa rm( pnu) eenxr3oydopDrauvs;s srtriopiu4al e ncslt  2trurp;o1tpe ifetat mDem(ms;u)aexnxfcoa1omDeln s s sexrxrpny1om nmfci sf 2uru poo4tle ioeiatfsDumuvpnu4trenxr3iodoatr ueols t2xoxmpiy4ll n fvi t) 2ra(roou1olx iiciys m rmuvo;t4altrxfcty1op  anei;s)texmxo iodol emfcsa( s2uax pnt4olto oetadlm2rlnvpnt4texnxo tatoa  aivslt0texoio3io4lltn ietlt)a2rrxmo;u0opeo feiat m uau o t0 ltnxrcoy1faDelueo s texrxm iydamt livilt  2rru  no4apxn o3tls a2umuvsn(0aexnirciytlmtrlivi;(0sexm(opou1alenmncilsfsrrax pnt4alenif3tltfa ranmo t0 rtomr3ty1la  lieilt)s2xo(rpoodaptnlivt s) rtrum ou4oee ifeiltls ea( snt4alenxfctodfp  ln i;(0s2xr(mpoo1lleelnesasfsDtmx pnu1oeeomf3iat a rlu snt0texoio3oodfp eai o;( s2urxm3oo4lp nmfei sfa2rmxmpno1oeeomiciadla rm( s;t0trenxo3iytomtrlu slt) euo(r3oo1lp e fcia(fs2rmu ooo1oex ifetadla ulnvs t)areoxf oy1oa r n ils0trxm(opio4lmt mivtls artru o;t1tex iicilt m rluvo (0 lerif3oa1la raneslt)srtr(mpiodal  livs tf 2rr(ro;o0opxomf3iys a umuvpnu)alxomociotlp elu i;s)s2uoxo iodlle miesl() Drm(r ;o1aexnifetasla ean o;u0teeoxociodlp raiei t0sexoxr ny4ll   neils) rta(m no4tlxnmoetlt m2eln p;u0 lxoio3ty1lm rai s (0srxrxmpnudalt lncsas)aDraxm ou0tpe mociyt a2um(vp;t)tetrmocoodfa   i i;(  etrxo nodalenlfesas  Duru  nu4ole if3iytlmDrlumo;u4altriocoatlpDrlu ilt)s2umirpiu4lp emietl( s2tmu  ;u0tle if3iysfaDul(vs t)altnxr iadlaDrau i;t0trxoxr nudlmt miet ( s2trum ot4olxn f3iydfsDean o;t4treoxociotlmDrau ilt)t2um(r ny1ol nmnvilt) 2um(moot4apen iciytfa rm( o u4 ltoioctodfmteaies (0 exoxopoo4amen ici s)a2tr(mono4oeeomictytfaDuan snu4teeniocoo1omDr iei s0 2trxm iu1ale  fes t)sDtrx o;t4aexniietls a elnmo t)texoir3to1lpt liei t t2xoio oy1olt mnvs t  Dtmx  ot4tex  o3iysfs2ul(mpnu0tltrirctotom r uvilt0trxm(opnu4amtnlfvia(f 2ua(mono0oeenmfcias m uanvont4arermr ootlptranvil(  rum(mpnudoptn ictlsfaDraxr ot4tlxomicilsfmDrln o ()treomrctydoaDeluvi s)sexm(m3iudap n iesa(f 2urxrpoo4tltnmocias a eanms t0tetrxf ta1fmtrlu s (  2tr(mpiydam   fvsas arum(mpot4apeoiietldfs ua(mo u4artnxfcoadlmtran s;s)t2urir3oo1lpt lnvta()sruau  ;o1aetoioeiys sDrlnmp (4 eeoxfcto1laDr i ilt0teum(o3nudlme liet tfarua(r ot4tpeo feiasfmDrm(mp;t)artoif3ty1fateai s;()srxmxr nudome  nvsas)sDua(mpnt0tleo feilsla2em(von(0texomr3tydfptr nvilt sruoiopny1llee fcilsfa2rmxr ou1oex  iciasla2rlnvp;(0aetnirctodfmt lnvi;s)setr(o no4ll emnvs t) rur(roou4optomi3tlsls2rmnvo;u)alxnir iydfp  auvsl() 2tr(m3nu4lpt  neils srrrx pou0tetomicilsfaDrluvo;t0teeoio3tatlmt liesl(  rxmirpiu1amen fviat) rtrxrp;t1tlto f3tltlmDemums ()altomfcio1faDelnvs s) 2xrxmpou4ale  ivtas)srta(  nt1oltoif3iydla2eln s;()texnifciytom r ivs s tetmir3iy4aleemneia( srtaur ;o4tpt mo3ildfs umuvo;u0tlerio3ty1lpD  n o s0texmxr iudapeemiet t) 2rrxm nt1tpeo oeiyt mDrmn s t0 exoir3iodlpD liesl(0setm(opiydop nliet t) Dta(r ot0texnii3ilslsDrln s;t)treoir ootopDrau o t0 2ur(r3iu4apeelict (f 2rrump;o0apxnmoeiytfaDulnmsnt0alenmfcoa1opD aies;t) etr(opiodop   fci s s2rrum oo0aexnifeilsls eauvp u0tlxoir3iydlat  ueil(  ruoxr oo1lp nlietlsfsDuaxmoot0olenmoeiad m2ranms ()trxnxo3iy1lm   nvs s texm(opoydlltnmics t)sDraumpnt0olx mfeiasfmDrlumont4 rtniocoadlat aivs (0seurxr ny4apenlfvils a2um(r ou4tlxoif3iadfm um(vs;t) etrxfcoodfaDrai i s) exrxo3nu1apee icslsfaDrr(ro;u0olxnmf3ild mDem(mo;(0aexoifctytlateanvi s0s2triopnydomenlfcil(fs2trum ot1oleo fetadls2rauvp t)texrmf3iatlpDr n s t seur(opno1aptnmivi (fsrtaum ;t1tpxomoetyt s2uaumpnu) etnxr3iodoa e u slt0tetrio3ny1altnmncsl()srrau pnt4tpxo fciltlm emu ont)aeenxr3oydfpteauvilt0setoxmpiu1lmeemivias srtmx pno1altoiieiytfaDua( p (0tlxoxrcoy1optrlnvsls)texoio iy1lm nlnes t srtrum nu1oee  i3tasla ra(mpnt)treoxf io1oatraivol(0 etoirpnudomeelfet ()sDrax oot4apxnif3iysfa rl( ont4 exnmo oodfpDrln o t)trxrirpnydlltnmfvias  Dta(ront0tleo ociatfa rl(mont) rerioctatfateaneol( tetmirpno4altn neiatf rrmx pou0oeeomf3tatlsDemu o u4alxrmoctotfmD  neo t) rtm(r3iydol emnesas)aDur(mpoo1apt mieiydfs ul(vo;(0 rxnxf3ia1laDelieil(0srto(m nu4am e fcia(fs2trxrp;u0ape ifetasfm2rlums u) ltnio3iytom eauvi t0s2
\ No newline at end of file
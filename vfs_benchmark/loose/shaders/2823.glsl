@@ -0,0 +1 @@
+n s;s)texmir3no4alenmiesat  2um(r nt4texn oeiltlmDeauvp;() reomrciadfm rlivs;t  eumirpnu1lp n icsas)s2uaump;t4oeeoif3tasfm2raumo u)trtnmf oydopDeau slt0t2xoxm3nodole lnct t)aruax oot1oexn iciltla2um( p;(4altnmrciotfpteanei;(0trtmir oy4apeelnvtas)s2uru oou1texnmi3iysfs2umnmp;(4 renio ta1fm rlieo t0sruo(m3no1ol nlfvia(f rur(mooo4optnmiciadlsDemnmpn()trerio iotlaDe uvs ()sexmim3nydam nmncilt  2rmum ot0alxn f3iltlm uln p;t4artrxf3iytfaDeln s s0srxriopoo4lm nlfcs sfaDrr(r ;o1opto fciat a2el(vo;(4trerir3oydfm e u o s) 2tmir no4om nmivt s)a2ra(moot4olxoiiciasfsDemu snu0tetnir3iadlaDeaieo () rtr(r3no1oltnlnvtat sDrmx  ot1altomieiaslm2emnmsnt)teenmf3todomt an s;s0srtmir iu4ape  iesa(fs2tmurpno0opeoii3iasfm2um(vs;t)tlermr tydla   uvi s0 rumxmpiu1omte nesl( srrr( ono0alxn fetadfm2elnvs;t4arxnifciotom elies;()s2toir no1ape lnetl(fs2trxroot1open ocils s2rluvonu) exrxr3todlmte uvsls  euoxr3io1am e ivil(fa2um(mpnu4tltn fcilsfsDelu pnt) rtrmrciodomt luvilt0 ruoxr3iu1omee nesas)aDtr(mo;u4oex  i3iydla eluvont)teenmf oadlmDeli olt) ruoxrpio4llt mivt (f rra( pno4olx mfeiyd m uluvpn()trtniocto1fmt anvil(0trxo(m3iodllt mfvtat)s2rmxrpou0tlto iciltlm rm( on(0 lxrmf3ty1fpt li sl(0teurxr3iodolen fetlsfsruaxm ot4alxnmictatls2ea( sn(0trxoxr tydlm  auvols) 2xoim iu4lme  fctlt  Dtmurp;u4teeo ieiysfaDrmnmsnt) etrxfctatfpDelu slt)t2urxm3nu1al  liesl( aDtmxr ou0tpenio3iys s2uanvs (0altrio3tytlp rlivilt srxmxm oy1ap nmictls aDuaxr ;u4oet mictlsfm rmnmonu0 etriocia1fp   uvi;t  rumxo no1optnliviasfs2rrxrp;t1aeeo ieiyt sDea(monu4 lerxr3iydfat ai i;t0tetm(mpio1am n fetl(  2trx o;u4teenmfeiatla rl(vsn(4 lermf oodfptrlivols)trto(rpoo4lmte fesls a2tau  ;o4opxniietat s2eauvs;(0arxnxfcootopt  n i ()t2uoio ny4apenmfetl()s2tax p;t1tptnifcildfaDumnmont4trxnif tytfm rauvol()t2ur(m iy1lp e netat sDtmxm ou4tet  ocild s el(ms t4 etomo totop  aiesl( sexoio3ou1ol  lictl()s2ta(mp;o4tet micils sDranvpnt4 eermfcia1op rluesls0 etriopiu4olt mies tfaDtm(m ot0oltnioeiad a2ra( o;u4tlxnxocia1lpDeliei (0srurirpoydlm emicslt arra(r ot1aeen ieild m2ul( pn(0tleoxr3tydfptelieols)teuoxr io4al nmfvsa(fa2um(mo;u0oeeomiciatfs2uaums;(0 lxrmo3tatfatraneo t0t2xr(mpoo4al   ivtl()s2tmum no1teeomiciatfa ran p u0 exnio oodfa elieo;( trum(m3oydlme miet sf rta(r nu0opxn oeiysfm rmu o;(0texnxoctatlp ranvsl( seurxr ou4lpeemieilt sDta(r nu4aexomictld aDra( sn(4trtnxf3ty1oat li o;()texmxr ou1lm  mfvilt)s2tru o;u0oleniicildfsDem(vsn(0 rtnmrctydfmDrai sl()s2xmim3io4ol elfci () 2rmx ono0tetnif3iadlsDeanmo;u)trxoiociadfaDeanvo;(0t2urir3no4llt  iei tf 2tru pno4tetniieiasls2um(vp (4trermf tatlpDrlies;t  2toxrpou1om n neiltfa2ta(moot0apxomociadfm ran s;()aeermfctydfpte ivo;s0s2xoiopiy1lm   ies tf Dta( o;o1openifeilsfaDuluvsnu0 etnir3oodlmD  iei s)srtoxm iudalee nvtasfs2urxroot1aexomociasfm eanvo u)aleoir3tadopt  uei;(0 ruoio iudllt mivt s aDtau  oo4tpenmf3iat aDel(mo;t)altnxocoadom r ueil(0trumio ny1am emfvta(f 2ur( poo1tpt mf3iytlaDrlnmpn(4 exnxr3oo1om e n olt) 2trxmpnu1lle  nctat sruaumpnu0aptomf3tysfm ra( onu0teeoir oadoaDrluvs t trxmir3no1lmte icilt) 2uaump;o1olxn fctydfs ul(mo;(0aetnmrcoo1fatrlivi s0 euo(r3iu1lp emfvslsfaDrr(mp;o4olx  icils aDra(ms (4arxrir3iotoa raneslt  2uoxopou1llen neiltf rrmxm nt4aexomoctysfsDeaumpn()tlxrxf3oadlm elu s;(  2tr(rpny4lle lnvil()a2ta(mpou1opeo fctas s ean o;u)tetomocoytom   u o;t0 2trxmpoo4altn fcta( aDtrxro;u0aexo fctadfs um(mp;u0artomo3ta1fpD  n olt s2tm(o3ou4om  mfctl()srrm( pou4oltoii3ildfmDrmnmp u0alermr tatfp rai o s)trxoim iudapte nvtat  Drax ooo0tleomociyd a2rmn p;() lerxfcio1fa eaivils  etmxr ou1op  livsls)artmu oot4opto ociadlm2emn o;t4 etoxrcoa1fa  lnvs () 2umxmpou4opee nvilsfaDtrurpno0aeen ieiysfsDumnmo;() lermoctytomtranvilt0 eumxr3ny4lp  mfes tfarrmxro;t1tptnifciydlm ul(mp;()tetomo oydfmt aieo;s setr(m3io4ol emivtas)arumxr ou0tet  fetldfs2rmn p;()alxriocoatoa raies;s) rxm(m oy4lmeelnvsat)srtmxrooo1opeomf3iaslm rlnvpnt0arxoxf ootfpD  ies;s) euo(r iudlpeemiciat a2urumoot4aeen oeiat a2ea( p u4 ltomf oa1fatrauvi;() rtrirpny4alen fcias srua(ront0aptniiciysfaDea(mp (0artnxr3todopD  ivi;s)s2xo(o nu1omt mfeta(farrrxm ;t1teto iciyd mDumnvs;(4arermf oa1faDr ivolt tetm(m iydlm emivsas)aDtm(mp;t0alx  fctlt s rm(mp;(4trtrxo io1lp  livols  exo(mpoy4ame lnei sfarrrur ;u0oetnmfetytfs2rluvpnt0aexrmrciadfmDelnes;s)trtr(r3oodomenmietls a2rr(mo;u0altn feiydla2umu snu)alenmf tydlpDelu ils0 2xo(mpoy4ame mnvil(f Dtrxr no0tex  fciyt m uluvp;t0trxomfcio1fatelieo;( t2trimpoo4ll   ncs t)a2ur(mo;t0alxomicildfsDrl( o t0tltnio ty1opDrlu ilt s2urir oy4opt mnvi t a2tm( ooo1oltnifetldls2rm( s;u0tetrif3ia1omteluvo (0srtoxrpno4op  mieta( s2tmum nt0apxomietytlm ra(mo t)trxrxrciy1fpDeluvolt s2xr(mpnydlmtemnctls)artm( p;o0tet  ietasfs um(mo (0alxoir tadlm r n o () rurimpnu1opt mncilsf rraumpoo0aetnioctyslm2eanmo u0 reoio ta1lpDrln i;s0teur(r3nydomtelici t) Dtauro;u0alt  feiltfsDum( p;() reomr ta1lmDr n s;t)trxo(rpnu4aptn net t)a2trx pno4apt  feilsfs emn s;t0alxnmf3iadopDeli ilt0 etrim no4ll n nes (fsDraumo;t4apeomiciat aDrmu onu4areoifcoo1lmDeauei;()trurxrpnydlpt lfvsls aruax oou0oexo fciys aDrl(vs;(4arenmo3iadfatelnei;t0t2xo(mpiudlpe  fvtltfs2rru  nt4aex mieiltfaDea(vp;u)trtnxo3oa1omte uvi;t s2uoxm3nydlme mnci s  2ra(roou4tee mociydfm2ulu onu4texnmf iotfat  n o (  rtmim iodom   fci sfa2rm(  ;t0texniocias m2rm(mp;u0tltrxo tytop  lnvo t  rtrio3oo4lmtnmnct (  rrrxm nt0olxoii3iadfs2ua( p t)aetnircto1fpt auvs t)trtmxr3oy4lm elfeilt  Dum(m no0olt  f3tydla ua( o;()trtoxo iotoaDeau i s0t2xm(o oo4al emncsl( a2trx p;u0tptomoeiyd aDrm(vsnu)artomo3oy1fm r i ilt0srto(mpno4lptn nei () 2rrur ot4optoifeiat a2ul(vs ()trxoir3ta1lp   neils)sexm(m iu4amt lics (  2uaumpou4aetnmieilsfs umnms;t0teeoxf iodfmDe nes s)texo(rpno4lm e nes (farrm(  ou0apxn o3iltlaDeau pn()tetrmfctadlmteaieils)truo(m oo1altn nviasfaDtaxm no1apeo fciatls2ra(mp;(0arxrircoydlaDeauvs s0trtm(r3iy1lmt  ivsasfaDuax ont0oeeo o3iytfm ul(mp;(4 lenxrciy1opteaies ()s2xmim iu4aleemnvi t) Dtmump;u1ale mo3iltlsDuluvp;t0altnirciatlmteluvol( s2xr(opiydlpe lfviasf 2tmur nt1aleoiociytfaDrl( o;t)treoiociadop   uvolt  rumimpoydamt  fes s)srrm(mpou4olt moeiasfm2eaumo (4 lxomo oydlm  aneilt0srtmxm3oy4omt lfesls)a2rmx  nu4apx  oetlsfa ea(vo ()arxoir3oytop   ivo;(  rtm(r3iy4alt lnctl()s2umuro;o4opt  ieildla2ua(vonu4 ltnxociodla elnvi;s  rxoxo io4ameemfcil( arumum ;o1tex  fciltfs2um(ms;u4aeeomf oodlmtr n o;() 2tmim3io4lpenlnesatf 2rmumoot1aet  fetyd a2eauvo;() reoiociotfaD  n ols)tetrio3iodlpt mnvs (fsDraurp;t1tpxn fciatfa2elnmon(4artomf3iydomDeluei;()t2xrxo nodop elnvs t  Drrxmono1tpen i3iltls rlumo u)teenmf ia1fa eln s ( srurim3nodlmtnmivsas s2uau  nt1tlt mfetytlm2ranmp;u4tltrir to1fpD  nvs;t)trumirpou4al nlfesltfsDum( pot0altn o3iltlsDulumo;u)tetoiocoytlm  lnes s0trxr(mpiy1ll emnet s)sDrrx pou1altnmfeiasfa rm(mo;u)trtoif3iatopDrlivi t)srto(m no4olt  fvslsfs2rm( pnt0aetoiiciltfa2rl( o;u0 lxomr3oatlpDrlues t0 etm(m oydap  lfcsasf Draxroou0tptnmi3ildla uan p u4 eerxrcoo1om  lnvi;t  exr(m iy4am  mieiasf Dtau  ;o1aeenmiciasfaDumnms t4 lxoxf3oo1fmteaivslt0 eurxr3iudom nmfciatfsDum(m ;o1apx ifciadls rluvon(0 rxoif3tadfpDrluvi s  rxrio3io4openlivt s) rumuront4texoiietls m2ranvp;u) lxnxo3iodfpDrli i ()seumio3iu4al n fei s sDtmxr nt4alenifeiydfm2rl(vs;u0texrmr3iatoa  lnvs (  rtmxmpiodam  lnvtl() 2tmxr ot1optoioeiysls2rl(vo;u0artnxf3ia1fa   uvs;(0teum(r3iydapt  iet t)aDra( ono1oetoioctysla umu s u)teermo3iytop e n o t)seumim oodlp nmfesa(f Drm( pou1opxnmociatlm2eanmon(0 ltnio iy1lmtelivi;() 2xr(m oy4lltnmiei t  2rm( pno1tex iociysls rm(mp;(4 lenmr3iatoptr n s t  exm(o oo1lltelncsas aDrrxr nt1opxn ociat s eauvs;u0trtrio iotlaDraiei () eumxmpnodopeelnvi tfaDtr( o;o1tex ioetat m2ul(mpn(0 exrxo oytfmD aivi;(0srumxo3iydlle mfvtl(f rta( p;t0alx  o3tldfmDemump u0 rtrio iadopDrau i;s trtrio oy4alt lfci ( sDua(  ;o1oltniociltfsDeanms;(0alenif3oytlpD an o;t)teuoxr3iudapt mfet ( aruax pno0oetoiociatlm2ranmo u4 exoxr3iydomtr ivs s trto(m iy1lp  lnciasf 2um(rpnt4tpe  o3iat m um(vont0aexnxrcoytlaDrluvo;s) rxr(o3no1ol   ici sf Dtrxmoot1tlxo fcildlsDrm( s t)artrio iy1lmtrlieo s s2urxrpiu4oltnlnvils  rtrur ;o4optnii3iytlaDemnmo u4trtrmr oadfpD aies ( srtm(o3iodop nmncta( sDrm(m ;t0tpx miciyd s uauvonu)aetriocoydoa rlivi s)t2xmim io1ole  nes (fsDtaxmo;u1tlxn i3iytla2umnvsnt0artrxo3iadfmDelieil(0 2xmio3nodlpeemnvtlsf Durx pou4alxoio3iyslm2eau s;t) rtnxo3iodlmDeauvo;t0 exr(r iudaptnlnei (fs2rmur ;t4tlt ifciltfs eaumo t0tetrir3tydlpDrlnei (0trtrxm iu4omee nvtlt artmxm nu1tleomf3tyslm2rl(vo;t0aexnif oo1fptelnesl(0sruoim3iodopte ncs (faDtaum no0teeoioctlsls raumpnt4 lxomr iatfm  luvils0setmiopnudope mfei t)arurxrpnu1aexn fciys m eluvsn()artoxo oo1latranvs;s sexmimpiydlme lietat  ruauroou0alx if3tydls2um(mont0 lerxo3todfpDrli slt)s2urimpou1al emieta()a2rr(mpnt4aeenifetlt a ea(vp;u) eenmoctodfpteauei;t  rtmxm iy1omtnmnvtlt  ruau p;t1tpen oeiys mDrlnmo u)altoxo tadlmt aieo t trxo(o no4ap elnvt s)sDtaum ;u1aee  f3iys m2em(vp;(4altnxo oodfaDrai ilt t2xoio nudlmeeliciatfsDtmxront0apenii3iltlm2umnvpn(4aexnircoytla rlivils0t2xr(o iy4al nmncs sfs2rr(r oo4alenio3taslsDemuvpnu4aeenif ty1oat luvols)srto(mpno4op  livi sfs2rr(rp;u4apt moetls aDuln p t) exoxo3totlmDraivsls)s2xriopiu1olte ivsat aDuru  ot4altomoeiyt a ea( on(4 etomo tydla e ivo s)setrim io4lp  lfvsa(fa2raumpno4opt  feiad s rm(vo ()texoir iadom eai sl( t2trio3no4lptnmfvt s  rumurp;o1oex  ieildlm2ulu s (4 rtrif3oy1latranvi t)t2umxmpiy1lm nmiesa(  2ua( p;t1tpen fciat mDulu s;(0 lenxf3totfa  aivi;s)truoxrpny1oleelnesltfartauront0apxoif3tls a ranvs u)aetoio iatlaD  ues;s)srxr(m io1omenlncias sDum(r nu0tlxnio3tys a2elu ont) exnmo3oo1faDeaivo t srxmxo io4am  livtls) rra(moot1aeen fciytfaDuaumo;t0 leoir3iytop   ues;s  rxmirpiy1ll nmnvi tfaDuaxrpot4oltnmiciltfa2el( p t)trtoxocto1oa eau i;t)s2tmio3iudlmte fvta() Drr(  ou1tlt io3iltfmDum(mp;t0tleoxf iotlm raueo;t)sexm(m ny4apt lics s a2rmumpoo4apt mietldfa2uan pn() rtomr tytfmD ai ol() rumim ou4om  lictl( sDua(rpoo4apt if3iltls2rmnvp u0altomrcootfpteli s;s)texm(r oudllt  nesl()a2ururpoo0aexo ocilt m eln pnt0teeomfciytlmteaies;(0 2uo(m nudlm   nctat) Drr(  ou0alx ifeiad s2ulnvp t0 leomf3iotoa eau o s  2xoio3io4alenmietas  Drr( p;t4apxnioetytfs2umnvonu0 etrmrciodlmtrlu i s s2uo(opoy4ll n ivtl(fsDrau  ;o1tetoif3iad m rlnms;()alxrmo oydoptr neo;t0t2trxo3iu1ap   neiltfs2umx oot0oet if3iydfmDrmuvsnu)teerif tydoaDe neo s0texmim io1am   fctl( arrrur ;t4olxomi3tasls em(vo u) rxnif ty1opDrlnvi;t srxm(rpnudll e nvt sfa2tax ooo0oetn i3iatfm2ean o t4 eenxr3ia1oa   neilt0 2toxo io1am n fetat)s2trxmpoo4tpe iocilsfa ua(vs t4 etrmrciy1fmt  u slt)trto(o iu1lmtemieias)srtm(rp;u4aee  f3ilsla rm( s;t0arxrircto1opt  n s;s0 2um(r3nudlmt  fvtls)arumum nu0tltn o3tlt m2rm( on() rtomo iatoa eauei (0 2trxo3iy1amenlivsat sDrmxr ou0aptn o3iasls ea(mpnt)aexrif3oydomDraivsl() etr(o3ny1lme lnei s aDrr(rp;t1alx  ocild m2em(vsnu0alxnxfciadfaD li i t) 2xrxo3iy1omee fetl(fs2uaumo;t4opx moctyd aDumn s t0aexomf3oytfpDr neslt)sruo(o oydlp  lnei ( sDtr(ronu1tpx  ieildfs2umump;u) leomo io1fm   uvi;(0 2xm(opiy4lpeemiciltf rraurono4openmi3tatlaDem(mp;() reoxfcoo1fm eaiei;(0sruoxrpnydlp  mnesatfa2tmumont1texomociysls2rl( s (0tltrxo ta1lm  anvo;t truoio3no4ame lfvtat a2ururooo4alxomociyt aDrl(vo;(0aetrif3oa1fm rauesl( sexo(o3nu4lmtnmnct ( aDrrumpnu0apx miciyd mDeluvpnu0tlxnxo todlmtr nesls)srxm(m3nudlpee ivsatf 2umxmont0oeen i3tysfa umnmp;u4 reoxrciodom  aueilt0trxrxr3oo1olt  nvils)aruax o;o4aet mociad a2ran p t0aleoxociotla r uvsls)seur(m3iy1op  mici (f Dur(  ;u1oex moeils aDumu ont4 lxoxrctytfa ranes ()trumxr oudal elicslsfsrtr(moot0opto fctasfmDem(vsnu0 eeoxo io1opDe neils0teuoxm oo4ol n nct tf rtmur nt4aptomi3iys sDuluvs u0alenmr tadlpDeai s;s)tetmir iu4lpe  feils) 2ua(ro;t0oet mietls m2uau snu4tetnxociotom  liesl(0 2xr(r3iy1lptnlnci sf rtmumpot4aetoifeilsls2uln p;(4aleoxo ty1omtrlu olt) rxmim3io4altnmfvslsfa2tmxmo;t4altoiieiatfsDraumo t4trxomr oadlmD  uvsls0setmirpno4lmte fvil()arurxrpnu4aee mo3ildlm2rln s u0teeoir iotomtr uvs s0seto(r3iu1alt  netl(  2rm(rpnt1tex  f3iltfm2eauvs () reoxfcoatom e neslt)s2xr(o3iodll  lncsat  Dtm( oot0aptnmietyd s2ul( p;t)tlenxo3oa1lpt lues s0 2trxo io1ll   feiat) 2rrxmonu0apx iieiat a rmn o u4tetnxo oydoa   uvils0trumxo iy1olenlietas srua(  ;t4aptn i3iaslm rmu s (4artrxf3iadfat aivi;( t2urir nydlp  lnctas aDtm(  ou0apxnio3iysls2emn o u4texoioctatom elu ol( trto(r3iy1aptnmiet () ruaxr ou0aee  f3iydfmDeluvo;(0 rerxf io1lpteln i;t  etrxmpno1lm e feil()s2rmx oot1tet mieiad m ra(vo;(0tlenmo oadomDeauvo t t2uo(r nodap nmnvi sfsDumx pnu4openif3iyt m2rm( o;t0 rtnif iodopDrlivi t0teurxo3oo1lp  mneils sDraurpoo0alxoii3tldfmDrmu ont0teenif tatom  lieol(0sruoim iu4lme lnei (  rraumpot4texo ieiyslaDran o u4aexomociytlmteliesl()trxr(m nudlpt lnvtlt  2tmxmp;o1tlenmieiadla eauvs (4 lenmfctatomDeli slt  rumxrpio4lmte ncs s s2truront0alen ieildlm2ulumo u)teerxf iy1lptrlu s t0s2xriopno1olenmneils  rrmx o;o4oeenmoctydfs elu s u0 eeoxr3oatoat  u i;t)srumxr3no1am   iesa()sDurumooo4oeenmoeildfm rm(mp;u)artnio iotlat auei;s) 2tr(o nu4aptelfcsl()aDrru pnt1opx if3iysla raumont)trtrmr3todfmtrau ilt  rurir3oydam nmncil( arumxmpnu0tlxnifciydls2rl( s u4texoioctydfmD livi s srtm(o oudlmtnmfvtlt) rtax o;t1oeeoiietaslaDrmums u0texniocoo1fmtr i o s teurimpoo1lltnlivt sfaDua( ono1openif3tls m ul( s u) lerxo totlmDeau o t s2toiopio1ll n ici sfaDrrum oo0aex  oeiadls2raumonu4 ltoxfctodfa  auvo s  2trxo no1am nlivsat)sruaumpou4altoifetatfa rl( pnu0alxomf3ia1fm r nvs t truoxo3no4ap emfvsa(faDrrurpnu0tltnmieildla2uluvs;(0tlxrmr3oy1laDeaneolt t2umxo3no4omenmiet sfa2uru pot4oee moetatla2umnvs;u4aeermf oy1opDeluesls  ruoxo oo1optnmfesat sDurxm nt1oleo f3iad m2um( pnu4trxnmf3oydlmDe ues;(0 ruoxopiydlltnmfci ( aDumur ;o1tpt  oeiadfs2rm(vont4tltoxo tadomtrauvsl(0teto(mpoy4lp nmnet sfsDuru  ot1olen ietlslm2ranmp u4aexrmociotoaD  i i ( t2urxm3ou1lmtelnes tfs2uaumo;o1alxo fctytfa ean o u) rtoio3totoaD au i ()trurir iu1am n ivt tfsrrmxront1oltomo3iad m2elnvp u0trxrxrciytlptraivilt  exr(r iy4aptn neilt)srrrx oou1tpe iictytfmDum(vsnu)arxrirciotlpte ueil(  2tr(opnydale liesl() 2trum ;o4oee mfeiat m rau o t)aetomocio1laDr ivo s0setriopnudap nmicia( aruru oot4tltnmoetlslmDumu ont) exoxociydomtraivo;s0 etm(opoudap elfci (f 2raur ot1aeenmictlslsDuan p t4arermf3ia1lmt luvilt)s2tr(o io4lme mics () rurur nu4aeeomi3iys m2eanvs (0trenio iadop  auei;t0s2xrxm nu4ame mnetls)aDtrx o;o0oetnif3iytls2uanms ()arxnxr iytopt aueo;s0tetoir oydal nmnet sf 2taum ou4texoiieiatfsDum(msn()tltrxoctytla e uei (0srtrim no4op   iviat)srurx ooo4oexoiietasfmDuluvpnt4aetoio3oytfp elnvi;t)sexmimpio1omte netl()a2tru  no1apxoii3tys s uan pn(0texnif3ia1faD ln s () rxm(m oudamtnmivs (f Drrx  nt0aptniieiltlsDua( p t0trtoio oadom  ai o (  ruo(m io4op nlncs t s2truro;t4altnmfetld a2el( snt4 renmo3todlm  ai ols0s2urirpio4amenmnet sfs2rm(mo;u4optnif3ilsfs ranms u0tetrir tatoate neo (0trxoio oodole mnvsatfa2trum ou1alt mi3iasfs ea(mo t0tetrmocoydop   ues;() eumio io1omt  feiat srtru  nu0olenii3ild a2eaump t) eeoircoytlmDr ueo s0seurxr3oo4lm emfeiasfsDuaumo;t0alxniiciat m2ul(mp;t4 rtrmo to1lpt aues (0 exoxo oydale mnct t)sDra(moou4tpx  octydla2emuvo (4aeenir to1laDrlieo;t srxrim nudop emicsl()sDrrum ;t1ale mi3tatfm2uanms;u0tlermfciotlat  iei t0tetm(r3io4alt  ivi s a2urxrp;o4tex  oeildla2ulnmpn()aexrif3iatlat lu ils0srxr(rpiodlptnlnes t aruax  ou0alx mictldlaDrm(vsnt4 eermfctadopDrlu o s0s2trxr oy1al   nvs s arrm(moot0tpeniieiat mDuau o;t)trxnmr3oadlm e i s t t2xm(r ou1omtnlnctlt a2ururpnu4oeenifciyslm uauvp;(0trtrio3oadfaDrluvsls0 2tm(opoo4amen netat)srrru pnt4oleo feiad s2eanvpn(4aexnmf iy1oa  livo (0s2tm(m3iydap  mnvtl()s2rm(rpot0aet  ictldla2ran pn()trtrifciydfpDrluvs;t)srumir iy4ame lnct ()srurxmpou1apt ifetldfa el( sn(0 eeoxocoydoa elnvo;s  eumxo3oo1lm n ncslt)a2uaurpnt4tpt  f3tydfa umumo;(4arerio oo1faDe nei;s srxrxm3oy4open fesas  Dtmx p;o1apenioctydls umuvp;u)aetoioctotfatelnei;s  ruo(r3iy1al elfvil()sDrr(rpno4aexomieild aDua( s t0areoif3oydla e i i;( teuoxm nudaptnmfvi ( a2raxrpot1olen o3tltfs eau p u4 reomocia1omt ln s;( trtrxrpou1alte ncta()s2umumo;o1alt  ieias m emu pn(0trermocto1omDe i olt sexo(r iydlltnlfvi t  rrrx pno4aetnmf3tadfs2eln ont0 etniocoadoa   n ols) exmimpiy1om nmiei ()s2taum oo0tex ifciysfm raumo;u4areoirciodlmt ai o t  2uoir3oo4amt lncslt aDrr(  oo1tlxoioeils m2ea(vp;() rtnmociodfm raneol(0srxrxo3oodaptnlivtatfaDtmx pou0tpxn f3iasfs2eaump u)tetoifcootlaD lu o s0 exrxmpio1ll elivslsfa2ta(m ou0tleniiciadlmDeauvp t4 rtoxf3totlm elnvi s0 2uo(m nudlpe mfetls sDtax o;t4tltomociat s rlump u4 eenmocootfpDeluvi;()s2xm(opny1omeelfvi tfs2umx  ot4altn ietys a2rln pnt0 ltrxociytfptraneil(0 2um(r nu1alee fvsa(  Dum(moot0ope ioeiyd aDem(msnt)arxomfcoadfpDrlnvs () rtmxo3iodopenmnvils)aDtaur oo0tle  ictlt mDeauvpnu4aexrxo3oo1lat luvolt tetrim iu1lp emfes s  Dtrx  ou1opto feiltla rau pnt0tetrxo3iatfptrlivolt)sexoxr iydaltemnvs (fs2trurp;t4oexniictydfmDuau pnu)trtnif tadoa  auvi;( t2xm(rpiy1am elicsl(faDraumooo4alxoifeiytfmDelnvo ()tlenxf iytlmt  ieo s) euoxr3nu1open icta(fa2umxr oo4opeo feiadlsDel(vonu0 exomrcty1fatrln slt texrxr oo1lp emieiltfs2rruront0opxn f3iydlm rau o t0tltrifcoodfm rau olt0trtr(o no1llt mncsa()sDum(rpoo1aleniictlt a2em(mp;(0trxoif oadom e i s;t teurxmpiodop e ivt t)sDtm( ont0opt  fetysfm2ea( o (0trtoxf3iytom r uvsls0 euoxr3oy1ap  mfvsls) rtmx oot4tltoioctyd a emu p;t)tlxrxf iy1om  li ol(  rxr(rpno4lle  nctl( s2rru  nt0open f3tadlsDeanmp;u0 leoxr3tadla ean s;s) 2tmxr oo4lmtelfesa(f 2rm(rooo4aptn feiltfmDuanmp u4trxoir ootfm   u s t)s2xr(opou4oltelfvtlsf rurxmont0tlxoiietldlm2uln p u) exoxr io1latr ivo (  2um(rpnodomtnlivt s sDrm(  ou1alt  ictlt s2elu o t)tlermo3oy1fa  an o t tetmio nu4omte nvsatfaDra(moot0tpeomiciysfa uan pnt0 ltomo3tatfm ranvs;s0 2tm(r3ny4olt micsasf Dtaxr nt1oetn fciyslmDeaums;()trtomo tatlpD lu o s0trtrimpiy1ol  lncils)aDraxronu0tlxnifciytfm el(mp;t) exnxf io1oa r nvi;t0tetmimpoy4lmenlies s) 2ur(m ot4apt iieiydfs2rln p;u0 lxoif iodlat luvil(0 rxrxo3iudal nmiei tfa2uru  ou0tpeniocild m rlnvo u4tetriocoa1om elnvi;t srtmio3oo1olen fct t)aDuax oot4tlt  feiasfs rluvo;u0tltoxfciydfptranvo;s)srxoimpno4lmtnlfcsa(  Dtaxro;t1apen feiyt a rmnvo u0artrifctydlaD au s (0 exo(r3iy1lme lnvsltfsrtaumoou1tpe  ociasfsDrlumo () ltomf3todlatr n ol() eumio3iudopee ictatf rtm(mpnt1tlenio3iat m2uauvo;t)aeeoif tatomtrau s (0s2xmirpnu1ome mivtat  rrmumpnt0tetnio3iys s2eau p;(4artniocoytfatr i sl(0srumxo ou4amte ieiat)s2ra(mpno0tle  f3tatfa raumon(4altoif3to1omt lu o;s) 2xmimpio4op   iesa()srum(mp;u1aet io3tltlm rlnmp u0aexnxr iodfp eli sl()srxrxm nu4amt mfeilsfs2raurpnu0tpeoio3iatls2ea( sn(0 eerif3iadlpDe nvs t0sruoio nudlltn nci sfaruru p;o1tpeo f3iys a ea( p (4trxomo3oa1lpDeauvolt  2uo(m3oy1op n ivt (farra(moou1apxomf3iaslmDra(vs;u4 eenmocoy1fp ean ols0 rxmio nydalte fcsat  Dtrxr ;u4altnifctlslm2elu s;() eeoxr oadomteanvo;( sexr(mpiodome mfvslt srraur ou1alxnifciatfa eauvpnt4texoxfciodfaDrai o (0s2urir iy4ale lfctat) Dtrxr no1tltoioctad sDum(ms t0aetrxf3tadfmDr n o;t  2xoxopou4lm e fcsltfarta(mpnt0tpt  ociadlmDul(mpnu)tltoif3tatfm  luei (0 eto(r3ny4ameemfcia(fs2tr( o;o0tpxnifciadlm2umnvon()aexomr oo1fmtrlueo (  exoir iy4alt  ivsls  rumxm ;u1teeoifeils a em(von() ltoiociadomD  neo;t  2umio3no1amtemfct () rtr(mpnt1olenmoctlt s2ra(vs t) eermf3io1om elivo ( sexm(o oy4llenlfei (fsDta( pot0oltomociadlaDrmumo;() etrmr3iatoa   ivo;()t2urxrpoy4ll nlieiat)aDurumooo0aleo i3iysfm2umn p t0aeerxf oy1lmteai i;(  exoiopiu4om nmivs s  2tm(m ;u0tlt iieildlm2um(mon(4trtoifcta1om rlu o;(0teurxm3nodame mfct (fsrum(m ;t4tpxnmfctld sDel(ms;u4alermr tydlmt aivo s srumio oudamt lnes t) ruauro;t1altnmfetyt s2ranvsn(0tltomoctydoptrlnvo;t truoir oudamtnlfvi ( a2uau pot1olxnmiciydla2uln s t4tetrxf3io1la e uvo t0s2xrxo iodopteliesas aDrrurono4ope moctlt a2umnvo;()trtnmfciadoatrau slt0 2urir3iudaptnlics s  rumxmont1oet  icildlmDuauvon()arerio ta1fm r i il(0s2xrim3iu1lm  lnei () rta(  ;o1aex iieilt sDulnms (4texrxfcto1lm e u s;t0 2uo(m3iodlltnlnei (  2uaxrp;o0tet iiciltfaDean o t0 rxomocoy1om r ueils) eum(r nudom n ietasf Dra(ro;o0opx mfetytfm2umnvsnu4trenmr3ia1oate i ils  exr(m no4ol n icslt) rtrurono0alxn o3iys s2eaums (0 lxnmrctadlate neol() rtoxr no4om  micia( sruru pnt4oltoioeiaslsDemn pnt4aeenmocio1lmtrlues;s)sexr(mpoudlptnmfcs sfs2rrxmoou4apeoioetatla rauvo ()areoio oa1fpDrauvo;s tetr(r iu4apeeliesas srrr(ro;u0apx iieiadfsDel(msnt)trtoirctytopD lu i ()s2trimpoo4lpen netl(f rumx pno1aetnmietydlsDemnmsnu4trxnmo tatomD anvo;s)trtmxo no4lpen nesat)sDrrur ;u1tltnio3tadfm2rlnvpnu)tlxnmr3tydfm  lies;()t2to(m3ny1am  mfetl()aDtrum nt1texomiciadlsDelnvon(0tetoxr oodlmDeanes (0 exr(m3nu1lptnmictls) Dtaxm ot0opeomoctldfm ua(mo t)tetoio3todlpteli s t)srxoxr oo1lptnlicslsfartmump;t1oleo fctytfs2em(vp;t4alxomo3ty1op r ivol(0texr(opou4omtelfvtat) 2tm(  ou4alt iicildfm2rlnvp;(0 rtnio ta1op r uvi t0 exrio nudoleelicta() rrm(rpnu0tpe io3ild m2uanvp;t0aexrxr3tydlmtr uvs () rtrxr3iu1ope mfciat) Dtm(r nu4olt ifetat m ulnvp u0alxrifctadlmD lueo;() ruo(mpno4ale livilsfs2ta( ooo4tlen ocias aDrmump (0tlermo iatfatranei;t sexo(o3nu4oltn feia(fsDrmxrpno4aleo i3iltla eaump;t)alermr3oadop  aueo;t0t2urxm nodoltnmivs (fartmurpnt4altomfciyd mDrau p;t)artnmfcoo1oatr n o;(  eurim3ou4omte fcsls)sruaur ;u1aexoioeild m rlump t) etoif3iatoaDean ols texrxm iudlptn fviat)aDtr( pot4oee if3ils aDran snu0 etnmf oy1omteanvi;t0seurxr3oo4oltemicsat  2tmx p;t1opx moeiat s em( snt)artoio to1fa rai sl( setrxopiodape  nctl()srumu  nu4texo f3iyt a2ranms;(0treoxo oodoaDelieols0s2tm(opiudlltnlncsltfsruaxrp;o1oexniieils a rmnvp t) rxnmf todla  anes;t0seumxrpnu1alenmivi t s2taxmo;u1tpxn o3iyd s2rlnmp;t4alxnmr3tadfp r uei;s0t2to(m3iu1op n ivslt  2tru pot0oexnii3iysls2emuvs;u4areriocoytfaDrlivi ( trurxo3oudap  licslt sDur(r ot4oltoifeiydfa2uaump t0tetoxf3iodfaDe nvil(0 2tm(r nydlleemfvilt) rtmur ;u0aetomf3iys s2el(vo;t4 ltnxr totopD  uvs;t)srumim oo4lpee fct t  2urx pno4opeo o3ildla ul(mpn(4arenmrciatlmt ln s ( srtrxmpnu1apen fciatfs2rrx pot4texomi3tadfm ea(vp u0texnxo3iatomtrlivi;t  eum(r nu4oltelnvsa()artrxr no0apxnioctltls2ranvp t)aexnmf iatom   nei t t2xrio3iy4optnmfvi tf rum(r oo0tpenmoetls a emnmp;u0teeomr oytfa elu o s)t2ur(rpnu4op nlnesatfsDur(mono1aee mocils s2rauvont0 rxnmf3todoa e uei s0t2urirpiu1lmen nvtatfs2ra(  ;t0teeoiietyd aDelnms t)teeoxr3ootfp   n o s0 2xrxopno1lm nlnesatf Dta(ro;u0tpt if3iytfs2elu s;t0tetnioctydfp rauei;t) rtmio oudap nlietlsfaDrrxrpno0aeeo f3ias a2ua(vs;(0 lenmfctotfpDrauesl(0srurxm oodlltnmfvsa( sDrm(  nu1optoifciatfs ranvpnt0 exoircoodlmD  ieolt0seumir3iy4llt mnvils  2ua( o;u1oleomoeiad a umnmo;()treoir oy1laD  u slt  rtm(r3ou4olt mici s sDtrxmoot4tlxn ocilt s2ea(ms t4texrmf3oodfmDe uvs ( setmxo3no4lpen neilt) rua(roou4altn i3taslm2elu onu) rtoxr3oadopD an s;s0 exmim3ou4lmtn ivtltf ruaur nt4alxo oetltfs ua(vpnu0altoxo3iadoa  an s t0t2toim3oy4opt  nvs () rrau ooo1apto iciasla2ra(vp;t)trtnifcio1latraieil(  eur(m nodllenlictat) 2ua(mpoo4apxn f3iytfm elu s;t4trxoifcio1oa raivil(0s2toxrpoy1lme lnesls)arrm( o;t4tpto f3ias sDul( s;u4 rxomociadopt luvo (0tetoim io1ll  lnvs t)s2ur(rpoo4aleo o3tysfsDemn on()trxnxrctotomtr ueo t0t2um(r3oodllt  iei ()a2umxm ot1oltomo3tlsfmDranvo t4 lxrio ia1optrau s;s0trtoim nodal elivslsfs2ta(mo;u1teeomfctlt a rauvp;u)arerifcoa1fa   nes;(0sexmxm iydom elfesas aDraurpoo4alxoiieiys m2rm(mpn(0teermr tadopteauvsl() 2xr(o iodam emnctl( a2rax ono4aetnif3iad aDrm(vsnt)arxnmf3to1lpD aiei;(0t2xmxm iu4optn iesa()aDuaxm ;t1aeen o3ilt s2ea(vo t0tltoxr io1oaDrli i (0tetmim3oudame mivi (fs2tmuro;o0alxo oeiyslm2rl(vp;()teenirctatlpDelivo s0 etoxo oodomt mfct tf 2rrxm nt4tpe iieiltlm2um( sn()tlxnxo3tytfpD  n i s)t2tr(o nu4optelict t)sDurx o;o0texo feilsfm2rmuvpnu)trxnmf3iydfp  lu sl(0 2tmxrpiy4op n fet t sDurxro;t4olt moeiatls2rm(vsnu0arxnxo3oa1fm r neo;s texrim3iodlpt mfcia(f ruaumo;u4tle  i3tat aDrmu on() exnxo tydfm   nvi;()srumirpoo1oltelictls)a2um(  ou0tltn o3iysfsDra(mp (4treoif3oa1fpDr u i ()seumxm3ou1olt lnctas  Duaum ;u0altn ietasls2ul( o;t4teeoio ia1lmte nei;s0trtoim3oudolt mncils)s2trx  ou4olt ioeilsfs2rmn pnu4aetoio3to1fm rlnvo t)sruo(o oy4om   nvtl(fsrtaur no0tpt mfctadfs2ra(vp u0 leoif3tydfpDrlieols0seto(m3ny1openlfet t)s2taxrpno4aetomoctasfa2ul(von(4tlerxf3iotfpDr ieo (0seuo(o3no4om elnes s) rrrx pnu4aleniictasfsDum(vonu4aexomf iy1omtrlnvi t0t2uo(mpnudapte nesa( sDuaur ;o4alxo ietls s ulumsn(4 ltoirciatfmDr ueo t0trxoxr3oodapenlics (farrau pno1aexnmfeiyt s2ea( ont0trtnxr3oydfa rliei;t  rxo(opnu4omtelfetlt)aruru oot4ape mfeiyt sDrmu snu4 reomrciatoaDran slt0 2tr(mpou1am   fesasf Dtauro;o1oexomieias m2uauvp (4aleoxf3tydfm rln ils0seumio iy4lpenmivs t)s2umur ou0altn feiydlsDeln o u4alerxr oa1fmD  uvs t)sexoio nodlmenlfctlt)a2tmxmo;o4tpxnmo3iad a2uln s;(0alxrxrcio1oatrln s (0srxm(o3nydoltn netl( arta(r nt1tetn oeildls2eauvo (4aetrmfciydlmtrlies s0t2uo(rpoy1optemfcslt  2trxrpnt1oleoiocils a ea( s;()tlxnxo oa1opteauvi;t)srxm(o iy1lptemnvslsf Dtmx o;u1tltn ieiysla2rl( o t4teenmrcio1lpDrlu i ( sruoxo nu1opeemicta( srta(rooo0oetn feiyt m um( s;(4tltriocoytlm   ieol()trxr(m no4olee fvta()arrru  ;t0tltomieils s2emnvp u4artoxo3ty1op r ivo (0srxo(rpiydlme  nci sfsDuaxrpoo0oetomfetasfs emumo;u4 eeoif io1oat aues s trxoxo nudome  icsltfartmu oot0aexnmoetad s rln pnt0teerxo iydfp rlnvi ( t2toxo iu1lmeemfeslt  2umx  nt1alen f3iad s2em(vo;t4texnxf oa1fm r uvi s0trumir3iu4omenlics t srrmumooo4alx ioeiyt sDemnmo;t4aexrmrcoo1fmteluei t0trtoir ny4omenlfeslt srtrxr ou1ope  f3ild a uauvont0artnxfcia1fmtr n sl( s2xmio3nu1lp  mfvtltfarrru  ou0aetnmfcild aDraumonu0artniocoydlpteli ols)seto(mpno4lptnlivtat a2tmurooo4alx mo3ilslmDelnvs t)arenmo oytfpt livi;(0 2xrxrpoo1apenmivta( a2tmxronu4tpen oeilsfsDeaump u)tlermo3tadfa eln s;t)srxo(o3nodopt mfes (  2trxr no0olx  iciyt sDrm( o t0arxnio3oodlm eauvs s)s2xoxm3nu4altemivtat a2ur(m nu1apeo ictydfm2ua(mp;() etnxrciytop eln sl(0 exm(opnydll nmfcta(f 2rmxmo;u1olx iietydfs rln snt4trtriocoadomDrauvs t0 rur(m nu1al n fcsls)srrm(m ou4apeoifetldfa eauvs u0aetrxo3ootfatraueolt0 2urxm3iy4op  lncs t)aDta(r ;t4aexniicild m2rmnvsn(4trerxfciydfpte ivslt0t2tmir nudlmt lfesat) rtm( ont0aleomoeiatfs rlump;u4 rxoir3oadlm  lu i;t0 ruoirpou1lp nlnet (fa2urx oot4aee  f3iatfs ea(mo (0alerif3to1lmtean o;s s2xmxopnodam   fviltfaDrr(rp;o4apxoif3iasfs el( o (0 leriocoy1lmtelues s tetm(mpiydamtelfvs sfsrtmu pou1aexoifciysfa2ulnms t0alxrxo3iytfp  luei ( t2tmxrpoo1opt mnvslt)aDrrxrooo1texomoctlslsDrl(vsnu4tltnxf3oytoaD ai slt  exrir3oo1llt lnctltfs2tr(mpnt1oleniociatlm2uanmo t0 etrxfctadlpDrau i (0setr(opiudlm e nvsl(fartm(moot1oee mi3ildlsDelnms (4treoxo oo1omDranvi;t s2um(m3iy1lmt lfeil( s2trurpno1opxnmociatfaDumnmp u4 lxomr oadfp   u o;(0sexrim3iu1alt mieilt s2ua(  nt0oexnii3iydfsDelnmpnt4tltniocoo1fpD luvs t texrxm3iy1ol emncia(fs2rmu o;t0oet mfeiysls eanvsn()artoiocoytopDrlieo;t0 2xm(r oydomt lfesa()srum(rpnt1tpto iciytfm2ea(mo;u) eermo3oa1op e u sls0texrxmpnodamenlfvil( sruru pno1alto iciasfaDeau pnu)teenmocoa1om e nei;t)trtmxmpiu4opeeliei t  rum(mpnt4oetn ociydlaDrlnvs u0 etomocootfa e ueslt0trxmio oudll nmfet s)srtm(mp;u0opx ifcilsfm2ua( pnu0trtrircio1fptrlnvo t srxoim nu1ol  licsat)artaurpnu4opt  fciyslm2rmu p;(4tlxomfciatlp  ln i ( seurim nodlp nlnet s aDrm( p;t1teen f3ildls ra(ms;()tetrxr3ta1fmDeli ol(0t2trio3ny4am   fctlt  Drmum no4oltn f3iaslmDem( snu) exrxf iatlpD li olt0s2xmim3nudaltnlnvtls a2tmx pou1tlt ii3tltlm2uluvo;u)trxomfcootoa r nei t srxoxr iy1lltnmivs (  Drmxrpoo1olt  fciad a2elnms;()aexrif oatomt auei (  rum(r no4amtelivs ( aDtaxm ou1olenmi3iltfm uau o;t4aeerxo iytfm rlnei;t0 eur(o3ny1lltnlivia()s2ua( oot4apxo oetld s em(vs;t0texnmr to1lmDrlneo s  2trxmpnydapeemfctl(fa2rmxm no1aexo f3tas m emnvs;t)tltoxr iotoa rlu sls0 2uoirpiy1llee fesat)arumxroou0apeo fciydfm2el(ms;(4tltoxf3tydfp eaueol(0sruoir3nu1amenlncs s) 2rax onu0tetnif3iatfaDua(vs;t4 lerxr3ootlptranvi;(0 2ur(r3nydomeelivias)sDtr(r ot4tpenii3tadfs2eauvs u4 ltnxo3to1lat  neo;s) ruoxr3iu4lme  ies (f 2tau ooo4aleoiieilt aDelnmpnu4aexoxf iydlp  lu il(  2tmirpnu4omtnmivia()artr(m ;u0tpt ii3iyt m umu snu) etoxr oytoateanvo;s srtmio3oudomen fetlt  rrmxront1optnii3ils a eau p t0tlenxf io1oa   uei;s srumxmpnodaptn fvi sfaDra( o;u4alxn ietasfsDulums;t)areoir iotlmtr ues;s teuoim no1am e nvil( s2tmxm ;o1aexn ietyt a2emnmo;t0alermrciotoatrli o;(0teumxo3oydlle  nct s  Dra( ono0ole ifctldfs umn o (4 rerxf3to1op  auvo t truo(rpiu4lptelnes ()a2ra(rono1oetnif3iytfs rlu s;u0aexrir oadlat  ieils  euoxo3oydalen icsl() rtauronu0tptoiietlsls2eluvs u) lenxo tytlm raueols  etmir3nydap e fvtls srur( poo0opeoio3ild mDua(mo t)aetrir oadfpDe n i;s t2xmxr3oodlmtemfesl() Duaxmo;u4oltn ietaslm em( o;u4tetoxfctytopD ai o (  etrxm3iydopen nviasf rumum no1olt mf3iasfs2elnms t)tlxrmo3ootoat  uvi s sexo(m oy4ap emicsl()srtmu ooo0ole ifciadfm2ranmpn(0 rxnmf io1lmDr n s ( teum(rpno1optemivsa(f 2rm(  ;t0ole miciaslaDelumsn(0aetnmo3ty1opt aiei s  etrxr3nodamee fet s) 2urx pno0tlt ifetlsfsDul(vpn(4 leomrcio1fpt auvs s0teumxo3iodaltnliei ( sruauroot1aeeo ietys s2em(vo (0tetrxocty1fpt lueilt0t2xoimpoydope  ivi ( s2taurpnt4tpeomi3iyd s emuvsnt) exnmrcoydlpt luvo s)setoirpiodam elnvi (  Durxr ot1alen iciaslmDra( o ()aetoio oadomDr i o;s0 rumxo3iu1omeemfcia() Drrx pnt0tetn ietadfaDel(vp;t) ltnir ty1fmDeaneol(0s2xm(r3oudlm  mict tfs2umum no1olt ifcildlaDrmn onu4 eermrcto1la  livs t)trxoio no1ope lfctl()a2ra( pot1open fciytlm2eanvsnu4 exrir oa1fpDeli o;s srtmxmpnudomte ivta(faDtru  ou4olx  iciyslm2el( pnt0altnxo3oodlmt ln i () 2uo(rpio1alen fei () rurxr ;o1aeeomoctatla2ranvp;u0arxnif3iatlaDeau s;t0t2xoxr iudolenmnvi tfsDtrxmooo4oeen ociadls umnvs;t0alxoxf3totfaDrln s s)t2urxm3oo1al e nvta() rtr(r ;o4optniieiydfm ua( s ()altrir3io1fm   nvi;()t2xr(r3iudllt lfciasfa2umumont0aptniiciytlsDra(vo;()aleoir3iodlp rlnvils0tetr(r3io4lptelfes (faDrau p;t4apxn i3ild m rl( s t0arxnmr3oodomD lnvo;( srxrxr3iy4ll  lfes s  Dta(ront0tpe  o3tatfmDemu p ()aexnmrciatlm  livi;()srxr(m3ny4al n nvtlsfs2rax  ;t1oeeoiieils mDemu o;t0 ltoxo ootlaD an o t)srxmxopio1om  micil( aruru p;u4oeeomi3iltfa elnvont4tetnmrcto1faDelneol() exo(m ou1am e iviltfsDrm( oou4oee iiciasfaDeluvp;()altnxoctodfp rluvs s  2xoxrpnodap nlnvtl( srurur ot1tlt  i3tysfmDelnvpnt)trtrmr3oodla r nvolt0trtr(m3no4ap n ivtas a2ta(mp;t1aet mfeiyslsDra( pnu)altnio oytlatrlueslt0setm(r3iydom  lnesat)srum( pou4oeeomicias mDea(vpnu0tlxnxo io1fpDeli ol(0 euo(m io4omt licil( a2taxmpnt4aexo feiysfaDul(msnt4tetoircoatfmDrluvs;s)setmirpnu1lpe mfes t)aDrr(mpnt1aeto icias a2um( s;u) lenio oadfaD li s;t srum(r iy1llte fes ()sDtax  nu4ape mi3ias m2emnmo;()artnmoctytlat  i sls  2toim3iydop   ivilt sDtaumpoo0olx io3tyd s2rm(mpnt)tlerxf oy1lmtr ivo t0trxoiopio4lp  mnctas  ruaum ;o1opxo octld a emnmp;u)teeomo3totfmD aieil( setrxopoo1llt lfcsl( s2urx oou1oexnmociydlmDuaumpnu0arxrir to1fpDe i sls)trtm(opnydamen fvia(  Dtm(  nt4tlto octls s umnmo (0tetrmfcia1opD li s t  rtmir3iu1omtnmncils)srtru  ;o4opt io3iys aDrauvsnt0tleoir iodlmt ln i;( s2xoxr ny1lp  liviat)s2trurpot1optnmociatfa2ulu p;t)tltrxrciy1fat auesl(0t2uo(mpio4ol   fvta()sDrru poo0tltomi3ias mDua( p;t4alenmr3tydla eaneil() etr(r iu4lp  mfeil()artrxrpno1aetn fetltfa em(vpnu) renxf3oa1fa raies;( t2xmim oy1lmeemnvta( sDrrxr ;u1teeo oeiatls2ul(mo t)aleomr oytlp elueol()srumim io1ope lnvs () ruru ono0aeeniietysla2ranmo;u0 rxoif iytlmt ai s (0 exmxr ny1alt livilt)srra(m ot0oeeomfeiasla elnvpnt)texrxrcoo1fpDrauvils)sexoim iydoptn iet (faDrmx p;u0texniiciadfm2uln pnu0 lxnmocoadfaDrlivslt0srxr(rpny4omee ivil( a2ra(r ;t1aeenmicilsfsDrl(vs;(0tlxnircoadlmDr nvo;t sexoxrpnodomt lneilt s2tmx pnu0aeenio3iltls2umums u4trtnxr oo1lpt au slt teumxo3ou4lmeelnctat)arrr(mpot1olenmi3ildfaDuau sn(4arxomo3iatlatrluesls s2xo(m oy1amee fvtlsf rrm( pou1oeeoifeildfm2rm( s;u0 exrxr tatlaDe i o;t s2um(r3nydolenmfeia(f Drru  ou4texoio3iadfm el(vp;t0 etnmfcoadfp  lnvi t seurio iydamenlics s)arua(mpnt4teenifciatfsDra( s;t0tlxrxf3todom eauvs;(  2ur(o3iu4lm eliei t)srtaxr nu4ope iociadfsDul( p;()arxrioctytfpDrlivo (  2xrxo ou4lm  miesls) 2tm(monu1apxn fctatls rm(vs;u0alxriocootoaDe ueo ()seuo(r oudol elicia()srtm(  ot4aleo f3ildlm2el(vp u)aexriocoa1lmtr n s;t0srurxm3oy4al  mivslt s2rmxmono0tltn f3iatlmDrl( snt0aexoifctytoatelnes;t0texrxrpio1alt mncs t  2rr(ront1tpx mi3iadlm umnvp ()trtnmo ty1oaDeaivo;s0seurirpiu4op emictat a2ur(mpnu1tlxn fciytls rmn o ()arenmr oytfpDrauvols s2urir3nodlmte ncilt  rrr( pou4tpe mf3ilslm2emn s;t4texnio3oydoa  li o;s0texoxr3nydlptnlnei t  2rmxrono1tlx  i3iys s2raumonu0trenif3iytfa eai ilt)s2xmim oy1omt  nvi sf ruru  no4altoio3ildls2uanms u0 reoir3totfp eaivilt)setrir3ou1ll  liet ()sDtr(m nt0tpx  feiys a el(msn()arxrio tatfmtraueslt0s2xo(m3iy1altnmfesat)aDrrxmoot1aexnmictlt m2el( o () lxoxf io1omtrlnes;()seumxm iodamee ieslt)aDuau oou4aptnifciytfsDrln p;u0alxrmr3tydom  luei;t)trtoio3iy1olt mnvilsf 2tru o;o0teen feiat a eln pnt)alerioctodop  livo s) rxriopno4omenlfctl(faDrrxrono0apx moeild aDulnmp;t0arxnmrcty1lptrlieo;t0 2uoiopoy4olte ncslsfa2taur ;t1openiieiys a2uln s;()areriociatfatelneo;t)texrimpou4ll   icsa() Dtr(r oo4tleoifeias a elnmo;() lxrxo3oodla   u i;()srumxopiydop elnctat)a2trxrp;u4oet io3iyd m rmnmp;(4treriocoadlp  luvi;(0 rxmio3iy4lm e ieils  rtm(rp;o0alxnmf3tatfa2ra( o;t4 exnxrctydfmtrlueilt0 rtr(o3oydllt lfcia()arurx  ;o4apeo o3iadfa rln s t0teerio3iodfpt aieol()teur(mpiudalenlnetat) rtm( p;u0aex moeilt a2eanms t)arxnmfcoydfmteluesls0teuo(o oydom   ivilt)aruauronu1aeenifctydfa ranvpn(4arxrmo iytopDrai ilt0s2umxr io1am nliesat  2rmx  ;u0olen fcias s2ranmo;t0aetoxr to1fpDelivo t  rxrim io4lpe licsl(fsrtrxr nt4opeomfciyt s ranms t0 eeomr oydomtraiei;(  2uoim3ny4al e ietat srtmum no0alt  fctatfs2eau s ()trtoxociydopD lu s () 2tr(mpoy1ol emfet (f Dtmxmoou4opxnif3tltfsDumnmo u0altnxo3tadfp  lues;t s2xrxmpno4lleemnvias)sDrmu  ;t0tlto fetytla uln p (4arxomf oatlmD  ieo;s  rtrir no4llte fvs s srururpno0aptomi3iytfaDeanvo (0 ltrirctotfa  aieol()t2ur(r oo4lme  ivtas aDraxrpou0olt moctydfm umuvs;u0artnmf tatfaDe u o (0 etm(opiy1llt mneias)s2ururoou1alt mf3iyslaDem(ms;u0alerxr3oo1la ranvi;s0 2xrxrpiu1opte feil( aDrauront1aptnmo3ils m2emu ont0 lxomociydlp r nvols0t2xo(mpiy1lltnmfvtlt)aDra(mpnt0apeoiiciatfs em( s;(4 ltomr oytla rluei (0 etrxo no4alt  iet (fs2trx p;t0apx ioctldla raumsn() rxoxf3totlm eliei ()srtr(r3iudlpt mnvsl(fartm( oou1oexomfeiaslaDrlu pnt0aeenif totoat  nes;s0t2xo(m oydll elnct ()artmxr nt4oex mf3ilsla ua(vsnt0aetrif oadoateli i;(0 euoxrpoudol n ici () rurxmpot4olto i3iadfm rm(mp ()tlenir iy1omDeluesl(0srxoimpoy4ll  lnvtlt s2rrumpou0tptomieiydlsDelnvs;t)tetrmfcoodfp raieilt) rumir3oo1omt  iet sf Dra(r ot1tpe  i3iyt sDea( s u4 etomocoydfaDeln s t0seurir3io1opeemfesa()s2uaxr ;u0apx  fctadfm elu s;t0 rerifcoo1om  anesl(0srxmxm oudoltn ncias) rumurp;o1aee  feiytla umumo u0tlenirctadoatr i ols) rxoxo3iodlp   fvi sfaDrrx o;u1aeen i3tasfs2rmnvonu0 reoif ootopD lnvs t) exoxo3io4lle  ietas)a2tmu o;o4aexomoetltlm2emuvo () exrif3iatfm  aivo;s) 2toio iu1lpe micsas arrmu p;u4oeeniictlslaDel( o;(4 ltrxo3iatfmDr i sls texrxm3ou4lp   icias arra( oot4aeeoiieildlmDel(vo t0 lxrxo3tydfm eln s t0 exo(r3no4alee feslt  2umxr ;u1oexomieild s rlu snt) ltrio iy1fm e u i s0 rxoxo3iydlmen fei ()s2ra( oou4tptn ieiatfs2el(mp;t)tetrmrctytlp  lues;(  2umxopiudamt  ncta() rrmu oot0olxn feils s rl( p t)trtrxr3oy1fpDrai i (0trtr(rpou4ol n ncta(fsrrmxrono1tltnmoeilsfs ranmo (0 eermf3iadlmDeaieo;s)s2to(m oy4lleelivta( a2ra(  ;u0tpt ii3tldfm umnmsnu4aetomf iodlm   ivolt)s2xmir ou1apen fesltfa2ua(mo;u0apt iociaslm2rmu onu0 exoif3oy1fmDran o;t)trxmir ny4alte icil(farururpnt0tetnmocils aDrlnms;u4texnmf totfm rlu ilt)seumxr ny4optn netlt)aDtmx pnu4tle iociad s el(ms u0 exoxrciy1la ran s () rxm(o iodolen nei t)srta(mpno0tltnioctyd a2el(vp (0 renmf3tydfptean o;s seur(r nydole mfvia( sDra(m ot1oltnifctydfaDumnvsnt4trtomf iodfmteau ils)t2xmim3iu4omenmncia() rtmuront0texn ieiydla elnms;t) renxocty1oaDelueil(0tetoim3iydap nlfctatfsDtau  ot0tlxoio3iat mDrmums u4 rxoif3iytfpDranvo;t0 rtr(opoodamt mfci (farrmxmooo4apx moeiadfsDrmn snu)trtoifcoadfa elu olt) 2tmxmpiy4op e fcta(faDtaxront4tptnmietldfa el(vo u0 lenmo ta1oat luvo (0s2urxo3iu4ole  ncils sDtm(mo;u0oexnii3iyt sDra( on(4trenxf3iatopD aneilt srxoiopiodal   fct (  2rax ont0tlt  octydfs2emuvo ()aexrif3tatfm r i o;s0s2toiopoodll  livi t aDtmuroot1tex  octls a2umumo (4 renifciodfaDr uvolt0srtmiopoodome  ivsl( aDrru pou0opto ociydfm2elu p (0aetomf3ootlmDe uvilt) rxm
\ No newline at end of file
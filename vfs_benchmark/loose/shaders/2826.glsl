@@ -0,0 +1 @@
+i o () ruo(o iudome mfvsat aDra( pnt1ape moctysfs2umu sn(4alxrir tadlatrlnvils0teumxo no1lm e ivtls a2tau p;o0alxniieiad s ulumo;t0trxnmfcta1om r ues;()trumir oodamt lnvs s sDtmumpoo1oexo fctytfa2emump;u) rtnmocta1fmt  nes ()tetrxr3iu4opt lncs tfsrra(m no1optnio3tlt s rl(vpnu)areoiociatfpDrluvi t0 rtmio3iy1lle mfetat)s2trxro;t0oex  feiaslm2uluvsnt0 exoio iatlp  an s t0trxrxo oo4lpeelnviat a2ururp;t1tlt  feiyd s umn pnu4aeeomfciy1fptr ivi t seumio no1lltelnctl(  2ur(moou0aeeomietldlmDea( snu4alermrcia1laDe iei t  2uoir iodlltnlnvslt arta( onu0apxnif3ils m2rmn o;t4 etrxo iatfm ran slt  2uo(o iodomtelnei ()s2ra(rpno0tetn oeild sDul( sn(4trenif to1omD an sl( seuo(opoydam emfcs t)artrxr ;t0aptoio3tadls2uanvo ()aetriociadfatelivils  etoxm nu1opt  fesas)a2ua(mpou1apt  oeiyd aDrlnms t) reoxrcoy1omD an olt) 2uoim io4op n nci ( s2uau p;u0olxomf3tat s2rmnmo (0 eeomociadopteai ilt srurxm no4openlnetat) 2taurp;u1oexomfcilsfm rlnvs;(4texomr ia1opte nei;t)seto(o ny4aptelnet s)sDraxmpot1tlxo feiysfsDeanvpnt0artrmr ootlaDeai o t0setoim iy1ape mneilsfs2ur(mpot1alenmf3tld sDelu pnt0 exnxo iadlmDraivi () eto(m iy1op  mfcs tf Dtaxmpno1tpen o3tls a2rln p t0 eenio3ta1fmtrauei;(0seum(o3ny4lp nlnctatfartaxm ot4alenifctysfa2rln sn(0teenxf ootfmtelies s t2xrir iudamen fctl( aDrm( p;o1tee  f3iysfaDrm( s t)artrif3ta1oaD ln i s s2tmio3oydomenlfeilt)srta( pno4tltoii3tas aDua(mo;t0 renio3oa1lptran s ()seurim3oo1ap  lfcta( a2ra( oou0oltnmi3tasfsDulnvpn() eeriociadlmDr uei ( s2uriopiy1ll nlivsls)s2rauront0tpxomoeilt s2elnms (4trtoxo3ta1om eai o ( s2xoxo nudomtn ict sfsDurxrp;t4tetomieildlm umuvont) etrmocoadfa elu i;s)s2um(m nodlmen ieilsfsDtrxr ;o0oeenmo3ildls2uan s;t4 rtnif3oydoatrln slt0 2xrxo3oy4ale  ivsa(fa2rr(rp;t4tlenmfeild s2eanvp;(0texoir oo1fa e ivs;s s2um(r oo4llt mfvia( s2ur(rpou0tet ifeiaslaDrl(msnu0tetrmr oy1omtraueo;s0 2toxo oydlmtelfcils)srum(rpoo4teeoioeiytfs uanvp () rtnxocto1fptelueo t t2um(rpoo1ome lnvtl(  2ra(rono1oltnmoeiad s ua(mont0tltnmr3todopt lies s)truo(r nu4ale licsasf Dtmx pot4tlxomfetlslm2uanvp;u4artrifciy1fmDe i s t0tetm(rpoy1lpt  ictas s2ra(mpnu0olenmieiltlsDelu o (0tltomf iotfmt  nvo ( s2uoxo3oo1lle lnvil(farrrxrp;u0oeen i3iytls2rlnvpnu4altnmfcia1fpDe n i s0t2umim oo1lm emics sfaDtmuro;t0oltomf3tysfsDea(vs u) lxniocoydfpt  uvilt)trtrim no1oltn ict sfa2uaurp;o4aleomoctlsls2rl(mon()tlerir tytfm rlivi;(  2to(o ou1open icslt)s2umu onu0apxnmieiasfm umn sn() exrxr io1om rlu i;()truo(r oo1lltn ivs t) rtax pnu4oleniicilsfs emnmsnu)aexrmoctotomt  i i s srto(mpoy1amt lnctl( sDrrx  nu0tlxo f3tadfmDelumpnu4 etoxrctatla ranes t0s2urxmpiy1lmtelfet tfs2tm(r ;u1tlxomoetldls rmn pnt4aexnmfcio1oa  lueo t0trxoir io1amtn ivilt s2ra(mooo1aet  feils m2ra(mo;u0texrmr3iydlp r ivo s0sexo(mpny4ap  mieia()s2rr(r ot1teenmictldfa2rauvpnu) exoir todfa  luei;()teurimpou4ol  micilsfa2trxr ;t0aexoiicild a umump t0tetrmo ootfmDeauvsls  2xo(opny4opt miciatfartrumoot0aleoifetyt s rmu on(0artrxociytfpteln o s teto(r3nu1ol n icsa() ruauro;u4tlx  i3tysfs umnvsnu) rxnxf iytfmteluesls  2urio iy4aptnlnvtls artaxmonu0aee io3ilsfm elump u0trxrxfcoy1fm eanei (0 2tmim3ou4amenmics sfsDum( ono1tetoiieiasfsDrau p;u)aexnxr3to1laDeluvs ( tetm(o ny1oltnmfeia(fsrrmxr ;u4tlxo f3tltls2rmnmp;t)artrxo iatfa r ueo t) rtmxmpoy4omen nvt sfsrrr(mpnu4tltnmociydfa elnms;t0teerif iydopDeauvs;t t2tmxo nudlm   fei t)a2trxmoot1tpto ictld a2rmuvon(0 exomf3iatopDraivilt0t2xoirpoo4om   ivt s aDum(mo;u1olx mieiadlm umn p (0 etnxo3todlate uvo ()trurxr3nydoltelnvt s  Drr(rpnu4teeo ociadlaDrlnmon(0trenxf oy1latrlneslt srtrio3ny4altn nes ( sruaum nu0opxo i3tadfs ea( o;t0trxoxrcty1omt luvo s0trtoxrpnodlm  livsas sDua( o;o4opxnmfeild aDea(mo (4 rtoiocootopDr neo t setr(m oydlmtn nvi s  2taxmo;u1tpt  fciltfm ran pnt4 renio tadfmDeluvs s) 2urxo iy1ap nmics tfaDtau  ;o1oexn f3tytls2eaums;t0 lxnifcta1omDelieo (0 etoxr no1oltnlnvi (  Drmurpoo4alx mi3ilt mDemn p;t0trxoif3ootfaDeaies;s0 2uoxr no4altelicsasf Dum(roou0tpe micils sDelnvp (0trenxo3iytlpt  uvilt) rxoir3io4ame  fvils)aDumumono1texnio3tys aDrm( o t4 rxnioctadoat luesls0sexm(m3no4olte icsl()arrrur ;o4tpenmoctas a2rau s;t)trtoxf oa1fatean sls  etr(opoydap   fctlt aDuaumoou1olenioeiys aDem( p;t4trenio3io1lmDe uvi s0s2toim ou4alenlnvi t  rrmxm ;t1tpenmoctyslm emnvsnu4teeoifctydfmte ivslt  rumim no1ale  feilt  2ur(r ;u1aet  iciydla2rlnmonu4tlxnmf3oatfpDranes;(0tetr(o3ou4lpenmncs s)srrax p;o1oee iictas s2emn s;(0tetomfcoo1omD livols s2urxm3io4lptn nvsls  2ur( o;t1tetnio3iydfm2umn s t) etnxrcia1lat ln sl()t2urxmpoo1ol nmfvilsfs2urxmp;t4tet  ocilsfsDuluvsnt0aexrio oytlmDrauvolt) exmxmpiydlpenlnetltfaDrru  ;o4aexo f3iyd m2eanvs;(0 lermrcoydfa  lnvs;(0trtmim3ou1lltnlnes s  2umxm ou4olt ifetytfs umnmo;u0aexrio ootlmteaues t srum(rpoodaltemictlt)artm(mont4alxomi3ilt a2el(vs;() rtomf3todopt  nvs;t)teuo(o iu1ame mici ()aDtru oou1opt ioctysls2rm(mo (4 renir3todfm  luvolt)t2uo(rpou4ap nmfeslsfs2rrx  ot0tlxomieils a2rm(mon(4teerxr ta1oatrauvi;s sruoir3nodlp n ivtls)aDrr( oot1apxomoctatlm2uan s t) lxrxf3iatoa raivo s0texrio3nu1al e fviltfartau p;t0tltoii3iytlm uluvont0aeenmf3oo1lpDr i ols  2trio iy4lle mnctlt) Drrumono4tltnmf3iytla eln s u0 rxrxrcoy1fatr ies t0 exmim oo4ape  fvtl()arta( pnt4oleo feilt mDeau s;() etrxo oadfpD anvol(0 exo(rpiydomenlfcta(faDur(mp;o1oexoifciys a elums u4 lxoif3todfate neslt0teto(r3ny1ame mfctls)srum( pot0openmfciasfsDum(vo t) lxoxrciodomD anvs;s  rurimpny4lle  net t s2ua(mont1oleo i3iasls uan o;t4 etrxr ia1fp rauvol( trto(o oo4lpee nei sfaDrmx o;o4tleo ictlsfa2emnms u)alxrxf3oadfm   ivils tetoim oy4optnlnesasfsDrmxr ;u1ole iociatlm2ul( p u0trtrxf3oydlatrau i;()srumio nu4lltnlnctat) 2taxro;u4aee mietyt a2umnmsnt0texoxociotopte ues s0 euo(mpoy1llt lnvt () rumx p;o1tetn o3tlt mDrmuvs () lxnif3tytom raivils0 2xm(rpoy4lpte feil( artmur oo0tetomieildfm2um( s;t0aeerir3tatfmteai i;s)teuoirpoo4open fcsat sDrrump;t1teeomfctldfaDuan o;u4treoir3oa1omt lnes;( teuoimpiodome mfct sf 2umxmpou4altomoctltls umn o t) rtoiociydlmte iei t0seuoio oydom e fcsas)sDumum nu0oeto i3tadfaDra( snu)tetoir ootoatr i sls) 2trimpno1olt liet s)srua( ono0aleomoctys a2uan pnt)tlenxr iytoa eli i;t)s2trxo iy1ll e icilt)a2rau  ;o0ope iictld m2eanvs;t)tltomfciodlatr n o s s2uriopoy4lp nmfesls srum( o;u4teeomoeiadlsDrlnmon()tltomrcto1lpDr iesl(0 2xrim oo4llt lfviat srumu  ;u4aet  f3iaslm2uluvs (0 exoiocia1op r ies ( t2uoiopiodlmtemictlsfs2uaumo;o4olxn f3iyt aDeln on(4aetnmf3tadlpD lues () 2xoir ny4open nvta( sDtaxmo;t4tle ifctydla emn s;(0teeoircoa1oa eau i;s setoirpoy4ap emfesas) Drrum ;o0tptoifcildfa emums;(0trxrmf3iydom rlivi;t) rtr(r iodole mnesls s2um(rpnu1altn ieiadfm uanmp;(4artriocoodlm  aivilt)s2xo(mpnudapt  fvi s  rurur oo0opxomfeildls um(vo;t0artrmo3oa1om e i il() eum(o oo4om nlivt () 2rr(m ;u0tpt mf3tadls2rlnvont4 rtnio3oo1oat anei (  2xoimpoodaltnlfvtas srtm(r ;o4tltomfeiatla2ra( s (4aeermociytomt  nvi s)sexrim3ou1lpenlfcilt srrm(  ;u0tex iiciasfs2uau onu0alxoiocoa1latr neilt srxoim oo1altnmnvtl()aDra(mpoo4opeo fetys m2rauvpnu4aetnirctatomDrlnvs;s0 2to(rpoodamtnlnetas aDtmxm no4olxnmo3ilt m ua( p t4trxoxf3oytfmtr nvil()srtrxopou1amtnmfcsa(fsDrrurpno1openifciatlaDra(vo u0artomo oodfmte uei;(0 2ur(o nu1apenlfeiat artrx  ou4tpt ifeiad a2ulnmo (4 exrif oa1oaD li i (0 2tr(o3oo1amtelfet s  2uaur ;o4tpeoifciasfm2ea(mp;u) etomr oy1opt ln s;( setoir3ou4lptemnvias) rumuroou0tptnmi3iytfa elnvs (4trxomfctatlm rlnvslt)trtmio io4alt mivs ()aDraxm oo0alenmfetadlsDelnvs u)altnir3ta1fateaivs;s0 ruoxrpnudapenlfct tfsrta(mpnt0tpt mociatls uanms;t0texrmr oo1om eaies s)sruo(m iy1omee fvsa(  rtaxrp;o0aee ioeias aDem( s t4 lxrmo oadlm r n s (0s2uo(o3ou1olenlnvtl(fa2ua(  no0texoioeiyd a2rlnvpnu0 rxoio oodoaDrli s s  ruoio ny1opte fviasfsrtaxm nt1opx iieildfa um(vs;t0 eenif3totop rau i;s0trurimpnudlpt  ivilt)arur(m no1tlxnmfctltls2ea(vonu4arerio3oatlm r u ils  2xoio ou1ame miet tf 2tau ono4oexoifciydfm rlnvo;t) etnxocoy1oaDeluvs (0 etoxopno4am e ncs t)sDraxrp;o0ale io3ils s ulu s;t4tltnxoctotlmD  uvi ()s2xoxm nudap elivi ()artaxrp;u0ale  o3iltfmDrlums (0 leoircia1fmt ln o (0s2tr(o3iu1ap e fesas)sDrr(mo;o4tleo ociytlsDelnvsn(0 lxnio oydfpte ivs s0teurim ny1altelfvil( a2uaxr nu0opx  octasfsDrl( ont4 ltrxf3iadlaDe uvi t s2um(rpno1omte nci t arrrumont1tpxoiiciyslmDua(vo;(4 ltrxf3iodlaDe nesl(0trtrir3oo4altelncsas)a2trx o;o1aexn feild s2ranmsnu) rxnxo ty1fpD  i sl(  rxm(m3ou1llenmiet sfartmxrp;t1tpeomo3iyt m ulu o;u4 rtrxr3iydfm eaneilt)s2xr(o iu1op elfesl(faDumur nu4tex micildfs rmnvo t4arenmf ty1fatrlu i;s) 2trxr3nydamen ieil( aDtau poo1tee io3iydlm2rlnms (4texnxrciadoat  uvsl()srxoxr oydom emnci tfaDrmxr ot4alx iieiat m2elumo (0 exnxfcta1fm elu il()trtoim iu1ll emnesl(f rururpno1tpto o3ildlm2ul( s t4texnxo tydfa  livi s0 rxmxmpnu1am e ietlsfsrrr(rpoo1olto ocilt m2emu on(4altoxr iotomDelues (  2xrirpnydlle mfcsas)srtaxr ;u1openmoetltfa2eaump ()texnmoctytfa e uvsl(0srxr(opoy1omte ncsas  2rmu  ;o1aleo octasfs2rm( o (4 leomr3oy1lpt  ueo t setm(r3iudlm nlfvia()srtmum nt1aexoii3tadfaDul(mpnu0tlerxf oatlmtr iei t s2tmxo3iu4ol n ncs t)aDururoot0olxnmi3tytlsDea( s;t0tltomrcoa1oa rlu i (0 rum(r oudap  mnct tfarraxm no1aeeomi3iyd sDeauvs;(0 exomrciy1fmt  ueils tetrimpoo1ale livil(  Drr( poo4texnif3iydfaDumu s;u)altoir to1oa eau i;t0srum(r iodll n icta()sDuauro;t0teto fciytla2rmn s;(4 exrio iy1fm  anvi;t0 exmirpiu4lm  mfei sfsrrmurpnu1tex  f3iat m2umu pn(0tetomo iytoat lnvs t0 euo(mpiudlm  lfvs (f Drru o;o4aleomietltfm2ua( pnt0artrif3tydopDrai o s) 2tr(opiy1ol n fcsls)aruaum ot0open fciys a rluvpn(4arxoio oydomt luvs;t seuo(o3io1ol n ici sfaDtaur ;t4openmiciat sDumump t) etrmocta1opDran o t0s2tmxmpno4amtemiesas aDum(rpot0oex iicias a el(vs t)trtoif3todom   u s s  euoxo3ny4lleelneil()aDrmx p;u1aptn ictad m rln snt4arxnxrcta1oaDrlu i;s0t2to(r nydll  lies (fsrumumooo4apeoifetaslaDranvonu)treomf oodop  lieo s)srxmiopiydapt lfct t) 2um(m ;t1apx ifetadlmDel( s;()trenmocoatom elivo t) 2ur(rpio1ol   ncsl(fa2uax ono1aexnioeilsls ulnvs ()texoir3oydoa e iei;t)tetr(o3iudalee fvias)srrmum ;o0tetoifciatls2ulnmp t4teenio3tatoaDeluvo;s s2urxrpiu1alen netl(fsrum(mp;u4aeen o3iadla2eaums;t4 ltomf3tytfa  ai i s0t2toxr3ou1omt lictl( aruau oot0oexoifctyt aDuan s u0aeerircoa1fa   nvo;s)s2xrxr io4olt licslt  Dumu pno0oexnio3iyd aDumu o t)aexoif3oy1op rlueils)trtmxr iu1omt livi (fsrta( onu4tlto i3tytfa rmu s;(0arxrio tatla   ivs t)t2xm(m io4llenmncs t)arta(mont1tlto o3tadfm2ulnvp (4altoxf3tydfmtelnvi;() 2xr(m3nodomtnmfetas)sDtru ono0alx mfciysfs2eluvont4trtnxf3oydfatelies t0trumxrpoodap e fetlt)aDtrxrp;t0alx  ietydlm2em(msnu0trxnxo oatlmDraueo t  rto(r oy4al emfciat)s2taxmo;o4oexniietat m ra(vs u4altnir3io1faD livo s) rxo(r nudllt mnctat srrr(mo;u1tltn o3ildlm2rm(mont4 reoircoodoa raiei t srxmirpoy1lltemfvsl(f 2ra(mpnt4aptnif3iasfm ul( o;t0areomf oatoatrlnvslt0srtm(o3oo1amenmneta() 2trxrpou1ale iicias aDelnmo u4tlxrxo3totfm r u i s0 rtoxm oo4omee fcias a2raxrpnt1aee ii3tadfm el( s t)alxrxf to1lptr neslt) rto(rpiydame mieslsfsDrr(r no1tpeoifetldfm uln o (4artomo todop r i i t0s2urimpoy4ol   ieilsf 2tr(m ou4opeomociydfa eluvs;(4 exrxo iytfm  liesls)sruoxm3nydolt lnvil(  rtrumooo1aptnio3iadfa2rluvs t4 rtrxf iotopt  ieolt0 rtrxrpio1apenmictas) 2umuro;u0tex  fctat s2ranvo;(4trtoxf3ty1laD ln ol(0 rurio io1lm   fctasfaDrrxm ;t1olenmoctatls2rmn o;u)aexoio to1omDe ues ( truoirpiy1amtnmneiasfaDrrxmo;t4aexo fcils a2ua(vs t4 ltoir ootlmtrln il(0 2tr(m3ou4am  micias)s2umxmpnt0apx if3tys m2rauvsnt0aeenmf3totfaDeaivo (0s2umiopno4ll  mfvt ()aDrmurooo1olto oetydlm uauvs;(0trxrxrcoo1omDrli i;s0 etriopnudamtn nvias a2rr(monu0optomieiyt m2um(ms;t4tetrir3tatlp elues;s srxo(m3oydaltn ivs s  Dtax  nt4aee moeiydfsDelums;t) rtrio ty1lm rlueils) exoxm3oydlltnmnei s sDumurp;u4tetnif3iytfaDeauvsnu4altrmr3ootlmtrlneo;( t2tmxo3nu4amtemnciat)aDtmumooo1apxnmf3iasfmDuanms;(4 rtomr iatlp   n i;t tetriopnydoltnmfct t arrr(m ;t0aexnmo3iltlm eluvp;(4artrmfcto1lmtr u o;()t2toxr3oy1op  mnesa()a2rrumooo1opeoiietydfa2rmn p u4teenmr3todlaD  nvs t  exoio3oo4lltnmfvslt s2trum ;o4tpeomictadlmDel(vs (4tetoxo iatopte uvi;s0trtoxm ou4lle mies s  rrr(rp;t1olxomieiatfsDumuvo u0arxrif iotop elu i;( teumxo3iy1apeemictat s2uaum ;o1aeenmfciytfaDulumon(4aexoxo3ootfptran ol()srxmirpnu1opte nci (f 2tr( p;u4tpeo oetadfs2ul( on()texoio iodom   i s t0 rto(rpiy1lmtelicil()srtau p;t0texomoctyd s2el(mon(0arxoio iodfaDraues;t)trtoxr no1lmtelncsas srrr(mono1alxn o3iltlmDua(mo;u) rxnxf iy1lp eluvilt) rxmiopny4apt licsat  2urxm nt0alx if3ildla ranmo;(4aeeomfctodlm  lu s;(  rurir3oy1amte icsl()sDta(rooo4aptomociydfm2ea(ms t)aexoio3tadlaDr uvi (0 exo(mpiy1lmt mncslt) 2uax o;u4apx  icild mDrmuvo;t) eeoxrcia1faD lu o;()t2toxo no4aptnlneilt)a2rmump;u4apxn i3tyt m ulnvo;(4trenmo iytop  auvsl(0 2tmxr nu4apenmfct ()srua(r ;u0texoifeiatfaDum( onu)artomr3ty1opDrlueo s0s2urirpiy1ame  nesltfsDrmx poo1aee if3ilsfm2rmnvs u)tltrircto1omteanvi (0s2toiopoy1am  mieilsf Drmxmooo4oexo feias m eluvo;(0alxnxociodlp rln i;() 2ur(m3nodlltnlici (f rrau oot4alxomictlt a2rlnvsn(4trerir oydlp rli o s  rumxr3iydlmtnlnvsltfs2ua(r nt0altn fcilslaDeauvp t4 eerxf iydopte ieo (0truoio3ou1olenmictls)arur(rpou4aetn ociatls rl(vp t0treoio3oatomtrln i;(0seumxm oydlltn ivt s) 2rau pnt4opx ifeiasfmDrm(vpnu) rtnxr3oatlmteln ilt teuoxm3iy1om e nctls  2umxr oo4ape  ociltfm rmnmo;t) ltnmf oa1fmDeanvilt)srxoim oudapte fvsa(f Dtm(rp;o1opeomieiyd aDulnmo u4teenir3tatfpt livilt seum(r oudop   ictl(  2rmx  nt1tle mieiydls uanvon(4alxoxo3totfaDelu s;s setrir iy1ole  nvta(f rumxrp;u1tpenmoetat mDulump;t4tleoxo3tadlaD ai o t)teto(m3iy4al  mncsl( a2rax pno1oetn oeiysfs emu p u0 rxnmr tatopt lieolt0s2xr(opnudom  miet t)sDuau p;u1oex mieiytlm rm( o;t4tetnio oy1lpte ieslt0setmxr3oodlpt miesas) Dumx o;t4tpx miciltla2umums;u4 exoxfcoa1oaDelivs s  2umxr3io4oleelfvsa()sDra(r ;o0tlxoiictyd a rl(vonu)arxnmf3tydfmteaieo;t) exm(opnudlmtelncsasfaDtau p;o1olt  feiytla uan o;()aexnir3iadfp   ueols)s2tr(m3oo4ole  fctat  rumxm oo1tlxo ietasfmDumuvsn()treomrciadfpteaiesl(0 2um(o3iy1lm  mfci sf 2rrump;t0oeeomi3tldfmDemnvsnu4tetnxr3oadfa rlieols)trto(rpio4lle lnesasf 2rm(rpnu1aexn i3tltlsDuluvonu) ltoio oodfm r uvi s0t2xmim3oy4am e iei sfaDumumono0opxoifcilt a ran onu) etnmrctadla rlivil(  2tmxm ny1lp   iet t aDuaumooo1tlt  f3iasla emnmsnu)aetnmr3tytfa rlueslt)t2xmxopny1apenmnesltfaDumxmono4oleo ociyt s ra(mp;t)aetomfciytlpte n i ()srtoio io1amtnmivias)sDtr(moou0aexnifeiltlmDrmnmpnu4trtnxo3oydfmt au s s0trtrxr3oodale mnvt s)a2tmurono1aetn oeiltlsDrl(vo () etoio todfmteanvi t0t2um(m oo1apt lncs (farrmxm ;t1ope ii3iatfs ua(vp;t0aetoxo oydoa rlu o s0s2uoir iy1am nmictat s2ururpno1ope iieiat s2uau p;()texnifcia1oatelnei;t0t2urxo3iy1lmt mfesasf rrru pnu0aeto fciydfa umnvs;t0trtoxr tytoa raueol()tetoirpiydlltnlictas sDtau ont0tpx mo3ild aDrmumo () ltnmr iadlmt  n sl(0srtmxm3oy4oleelncs sfartmxroou4aetnioeiadlm rmuvs;()tltrmf3oydomDraivilt)t2xmir3oodape lfciat)s2um( pou1teenioeilslm2um(mo;(0artrmo3oatom r n s s)truoxm3nu4optnlnvia( srraxm ou1tleoii3tlt s2rl(mo u4 leoioctadlm e u i;s)srtrxopio4amenlicsls)s2ra(ront0apenio3iadls rlnmpn(4 etrxf3iatoaD livslt0 2xm(opoudlp  mncsas)arraxm oo4opt moctld aDrl(vp t4tetrmr3ta1op eai i t0teto(r nu4olenlfes s) 2urxr nt4aee  feiyslaDul(ms;t4texrmf to1fp r i s;t0trtm(r iodoleeliciat srta(mp;o1oetomi3ildlsDulump;t0areoxrctadoaDrau i;s0s2to(opiudope mfvtlt)s2umu  ;u0aetnifciltls rmnmp;u)alxnir tadoa rlieo s)teumir nu1amenmfcs (fsDtaxrp;u1opxomoeiasfsDra(mp t0arerif3tytfa   uei;s) rtrirpny1ol e iei t  Drrumpnt0texomoeiyd s em(mp;(0tlenmr3io1fmDelnvslt0trxrimpnodal emncsat)s2rmxrp;o1aee mietld sDum(vs;() rtnmo oadfp r uei;t0 eurir oo1lltnmnesa(f Drmxr ot4aexn ictldls2emnvs t) rtnircty1latraivo t0s2xrxrpou4lp  mics t)arum(ronu0alxn ieiyt a2rm(mo u0 eeoxf3oydfa eln o;s0s2xo(mpoodamenlietas) rrrxrpoo0texn ietas a ra( ont)artnxr oo1lat lies s seuoim3ou4oltnlfviatfsDrau poo1tet  i3ild mDrlnmonu)texomrcoy1omtrlnvo ()trtmxrpiu4lmtnmieils arrax  ;t0apen f3iyt m2rl(vp;t)alermfctatlptrlues ()setr(o3ou1lm nmnet (fsrtax  nt1olx mfciadfmDua( p;t) lxnifciy1la r nvolt  exrxo oy4lpee fcia(f Dtmur ;o1tee mi3iasla2umump t) lxoio iodomt lneol( s2xm(r ou1optnlneia(  Dtrx ooo4ale iieiat mDumumo;t0texoxocoytlm   uesl()seurio3ou1lltn fci (f ruau pno1opto feiydls ua(vsn(0alxnifctydfmDr nvi (0t2xo(rpoydaptnmnviatfaDrm(rpot4opt ifciltlm2rmnms;(0 leoxo3ootlaD ln s s0 ruoiopny4olenmivi s  Draxrp;t4tltniietasfm raums;t)tleoioctotomtelu o t0teto(r3no1optelnct tfsDtaxrpou4oltniociydlaDuaump;(4areoxrcty1lpD  i i ()s2xoir3oy1lm  lfetlt aDtaxmoou0ape  f3iysfs2elnvs (4 eenio3oo1fpDe ieo;s truoxrpoy1lm  lfes (f rrrur ;u1apxomfeilslsDuln s t4tlenmociydopD lnvo ( t2xmio3ny4op  mfcsatf Drm( o;o1tpeo oetytfs ea(mo;t) lxomf tadlmDelueilt sruo(r3nydoptnlfvtl( a2tm(ro;u1oeenioetls a2elnmon(0aetnxf oatopD lnvo s0trtmim iodlp e fvtlsfarurumono1openmi3tatls rlu p () lenmrcta1lpt aivo;()sexm(mpiu1lmtelncsls  2uaxmo;t1alen i3iysfmDuluvp (0 ltrio3tytfm eanvsl(0srxoio no1ome mnvs () 2tmxm ;o0tpto ociatlsDuan on()aeenxrctodlpDe n i t sexrxm3ou4optn nvsls  Dumx o;o0ole  i3tytls2ul(mo;t0arermf3oatlpte uvi ()trtmim ou1lp  lnvi ( sDrmum no4alxnifeiltfaDulnvs ()altrifctatfmDeau s s)setrxo3ou4ope  ncsl(fs2umum ;u1optnioctlsls2rlnmp u0alenxrciatfa  aivs s)srtoirpio1op n fet sfsDrmxroot0oeenii3tltfsDeau p;(4 rerxo iytlpD  n o;(  eurxrpio1oleemfeta(f Dtm(r ot4oex mo3tldfs2rl(mp t0 rxnif tydfat  i s;s)t2to(r oydam  mfet sfsDumx pot0openmf3iytfm ea(vonu)aeerio iodla  aies;s0texmxm oy4am  lncils s2tmu p;u1optoii3iltlsDeluvs t4tlenmr to1fpte i o ()trtoio3oudamtemicsl(farumxr ;t4tpx  ociltla2umumsn() rtrmr to1faDr ivols)seurio3nu4lp  lnetas a2uauront1teeomf3tltfs rlnmp t0tlerif tadfmDrlu o;(0trxo(o ny1omen fet tf rta(  ;u1alxnmo3taslaDeauvo;(0areoio iatoa  liei s)t2uo(o io4amtelict t)srraurp;o4oetomfctatfm ranvs;(4 rerxocoy1lmt anvols  rtr(m3ou1lm nmnetl(f 2umu pno0altnii3ilsls2ul(ms (4aexrio iatfptrau slt) 2uo(r3nu1oltemnvt ( srrmu o;t4ope mictltlm2rlnmp;() ltrmf3iadfmteli s;t  2xrio iudlmt  nvsasfarrm(m no1olx if3iytfs ranvon(0tlerif3oatopDeanvi;s) 2to(opiy4ap e feilt aDtmu o;t4open feiydfs2rmn o u4 lxrir3ootfp elu ilt)s2umxmpnydlmtnlncsl( aDtm( o;u4ape moctat m umumo;t4texriocio1laD li s t0setr(m ny4op  licsa()aDum(m ou4aeeomiciysfa ulumonu0altoifciy1lmtr nvo (0trxrxm nu1amenlncsat)a2umurooo4alt ii3iltfs2umn on()areomo ty1fm eli s t) 2trir nu4lmt  nct tfaDrm(ro;u0tle  o3iasfaDelnvpn(0aexomfctatomDrlneo (  2toirpiodomee ics ( aDur(  nt0oltnmfetlt m ua(vs;t) eenifctadfmDr n o s0t2xmimpnu1lltn fvtl( a2umu  ;t4texnmociatls umnvo;t)tlerxfciadoa rln s t s2tmxrpoo1al n ivias aDrmumoou4aet mieiys sDrlums (4tlxrxf3ia1lp raneo s0 exo(mpnu1optelfcsasf rra(mpoo1alto fetltlsDumnmsn()aleoxr3tytlm rau ils teumxmpoydlpe lfvtas  rrrumooo0tetnio3iltlsDem(mp;()teerxocootlmt  uvi s) exm(o3oodope lncta( sDraumo;o0ope  o3iadls2el(monu0alermfctotfmDr n s;t)t2tmxr iu4om e feils)artru ono1aex mf3ias m2uln s;(4 rxnmf totom  ln o s0sexoxm3iy4alt lfctat) Dumxmp;u1oet mi3tadla2eanms;u0trtnxo3oatop r iei s0sruo(opio1lmenlieils  ruax  ot0tpx mf3iadfmDua(vo (4texnmo todop  anesls0 etrxrpiu1lpt livtlt s2ua(r oo0aetnioctlslm2ranms t) eermr io1fatrlu s;s  2tm(rpno4llee nvtl(faDrrur no4olxomiciydlm2rluvo;() reomf3iatfp r n s t) rto(r ou4lpe lnvs s sDtmxroou1apto fctys a ea( s;(4 leomf oa1fpt luei;t0 eur(rpiudale miesa() 2trxrpno1optoifetytfmDrm(vpnu4alerxo3oytfpDr n i (0trumxr3oy4ole  ivsl(  2tm(mo;o0optnmiciydfaDumnvs ()tetoio tadopDr n o (0 rxoxr ny1om emict sfsDra(rpnu0apxnifctyd s2eanvo;t0 lxoio iatfptrlnvs;t0truoxmpio4lpenlfvta(  rtr(mpou1aptnmicildlaDuau o u)trenif tytoa   ieo;t0 2uoiopnu1ale  nesas) Durxrpnu0tltn f3iaslm2ra( p (0aetomocoadfmtelueols t2to(m3io1ll e ivtls) 2uax ont1oeeomoetat aDuanmsn()alermr3to1oaDrlneslt s2xmxrpoy4omtn fctlt)aruaxr nu0tetn i3iyd m umu p;()areoxr oydlp  ln ols) rxmiopio1om elicia( aDuau  ou1openmoeiyslm2elump;(4trenmr3ootlat au i s  exr(m io4ome  nviltfa2rmurooo4opx  ieiaslsDulnvsnt)aetnmf3oa1opDeaieo;()sexmio io1aleemivias s2rax  oo0tex ii3iadlaDeln p t4 rtnmrciytfp r ivs ( s2urxm ny1ll emivtat)s2um(  ot0tlx iociysfmDrlnms (4 exoxr3iydop eli s;()truo(o3oy4omtnmfcsls)sDurxm ;t0tleniictltfm rln p u)alxrxo3tytlmt lnes;s0t2tr(o3io4ap nmietatfa2rau  ot0tee ifeildlsDuanmon() rerir3oadlm rlu ol(  rxmio oydale lfeil(  ruaxm oo0ope  f3tytlsDemuvs;() exomf3oadfa elivol(0trxmxopnudll e ncia(fsrumumpno4oexnmociltlm em(mpn(4 lxrmo iydlateli o;(  exmxr oudoltemivs t)a2tmumo;u4aleo oetyt mDem(ms;u0areoio3oadfaDrli s;s0trtmio oy4op   icsl()srtr(r ;u1aeeomieiytfm ulumsn(4 exnio oy1fp  aivi;s  exo(r3ny1olen nvsa( arrrxm no1altoiieiadlm em(vs t)texoxoctadomDeaiei;t0teuo(r iu4lpt mfvils)a2uaum ;o0tex mfeilsfaDel(vs;t) rxrxf3oo1lm rln i;() eurxopio4op elfcta(  Durx  ot1oet micilslsDrlnvo u)trtnio3oa1oaDeai ols0t2toirpnodolenlfcsltfsDum(mpnt4oexn oetlt m2umu p;()texrmoctatfp e nvils  2uoxmpoy1oleemncsa( artru  ou1aptnifciyt m rl(vp u4alenifctatlp eai o;() euoxr iu4lpee fctlsfsDrax o;o1oex  o3iat a emnvpnu)alerxo oydoaDr uvo;s0 rtoxr iodoleelfvtltfartmur no1aptnmf3ildfm el(mpnt0tlenmr3iotfa   nesls)seumxopnudomtelfctat sDurum nt1opx if3tasls2raump;t4 rxnxfcoatlm   neol( seuo(o ou1lpee iei t aDrrxr no0opto fciltlm2raums t0aetrio3tydoa e nei t0 rxoir io1open ivtlt)s2um(ronu4opxnioetydlmDuanmpn(0texnmrcoy1omDeai o s) rto(o iu1lm n iei s  rum(mpnu4oeeoio3ildlmDean p;(0 rtoirciotfate u o;( srxmxrpiu1lme  fvi t aruax  ;o1apt ifeildfmDrauvonu4trxoir3iadfaDelneslt s2uoxmpno4aleelfvi s sDrau  ou1optnmociyd mDrln o t0tltrifctodoate uvi;t  etm(r3io1ole  ivt t) rtr(moot1alen oeiasfs2ea( p;t)tlerxocoatoaD au ilt)seuoim nu4ll n neiat  2rmu  ;o0oeeo fciyt m2uanmp t4texrir3iytfpt  nvils)tetoio3nodlp nlfcta() 2tm(rooo4tpeomf3iatlsDranmonu4artnio3totfmD ln o;s)teumxopoodap nlfeslt srua( ont1opt  ociad aDumumo t4 etomr oydfaD  uvils teuoxo3ou4ll elnvtlt a2rrxrp;o0tpx mf3ilsla ean p u4tlxnirctotfm e nvo;(0 2tmxm3oudalenlncsat aruru ooo4aleniictyslm2umums ()tltnio oy1fa r ivil(  eumim iudoltemiesl( sDrmx oou0tpx  ietad s eau s u0altrxr iy1omtrluvo;t  rxoimpnu4lm   nesl( arrmu  oo0tex moetas a2rm(vo t)tlxrmr oatfm eln ols)seuo(m io1ll  mfcs ()a2ur( o;t1oexomfciydla2ra(vs () lxrmoctotfa rlu o s) rxmir iy4olenmics t arrau  ou1aexomoctas m2ranvsnt4trxoirctytoa e n s;(0teuoxo3oy4om  mfvsasfarururo;u0tlxomi3iys s2ea( p t4arerifcoatfpDr u o ()texrxo3iu4amt mncsltfaDtmum oo4alt ioeiysfa2ulnmp t0alxrxoctydoptr uvo;(  2xm(mpou4olte ieiatfsDrax  ot0texniieiydfm2emu o;(4 eermo oydoaD li il( sexmxo3nu4altnmfvia()srururpoo1ape  oeiyt m ulnmo ()arxoxr3ty1fm ranei t0setm(o iodoptn feta(  Dtrxm ;t1tlen feiyd sDranvs;(4aeeniociytop   i o;(0 rxoxrpou4ap elfei t)srtax o;t0aeeoifetyslm2rau pnu0 exrifciodfaDe nvsl( texmir no4am elnvi t aruaur ot1aleoif3tyt sDel(mp (4 exomr3iadoatrlnvo;s)t2xo(o3io4amtn feiltfaDtm(monu0texo o3tatlsDemu p;()trermf ootoa r iei;s)teumxrpoodameelfct tf rtmumpou4tetnmoetysfs em( s;t4trtoifctotlpD  uei t0texmxmpno4alte ncsl() Durxmoot1aetniociasls2rmuvo;t0tetomfcoo1lmt au i (0s2uo(opnu4lmt mics tfa2urur ;u4oeenmociytfaDemnvo u)tetnxr3iotopDran o;t0 ruoxo oudlptnlivi ()a2um(mp;t1oet iieiys s uln p;t4 lxomo3iadfptelues;t)teuoxrpoy1omen fvt t)a2uaxmp;o4opto ieiyslmDemuvsnu)aeenif3oydom rluvs;s t2xr(r nodaleelnesat) 2tmu ont4tpe mf3tat a2ulnms u4texoxf3oy1fate uvo;(0 2uo(r iodolte ieiltf Drrx  ;t4aexniocilslaDumn pnu4 leoxf oo1laD lu s;()srxrio3ny1ope lies ()s2ra(mp;o1apto f3tlsfs2ua( p t0alxrif3tadomt  ivs;s0trxmxmpoodomtelnciat aDrru pnt1tleniieiydla ul( onu) ltrmocoy1laDrlneolt t2urxr oudopt  fct tf rrmum ;t4olt mo3iydls2rmnvont0texomrcoydoptran o t  eumim iu1lp nmivtls a2ua(  oo0tpx moetad sDuanmsnt)texrxo3ty1oa e ieo s t2xmxo iodal nlfvtl( aDraump;t1oexnio3iasla ra( p t0trerxfcoydoat lieo;(0 2tr(o3nydol elfetl( sDraur ;u1tle  o3ilslaDem(von(4 lxrxfcia1fpDelu s t)s2uriopoo1lp e nvsl(fsDtr( o;t0olxoiicildls ranmsnt0 rxrmfcoadomt lueilt0t2uoxr ny4ome lfesasf 2raum ;u4aex mi3iyt a2ul(vp;u) eeoio3totoat livo t0teuo(r oydalee nct ()artrxmono0altn oeiysfsDrmn o;t) eeomo iy1fpt livils0 rtoxo3oy4ope mnctat srrau p;o4texnmf3iltfm2rm(mo;u)altrif totfmDr n slt0trtoio no1ol nlnvs s) Dtmumont4aeen fetlt aDuan snt0texomfciy1lp   ivs;t0sexmxo3oo4ole mics t aDrrumo;t4aet  ociasla ulnms;u4texoio oodfmDrau sl()t2urim oy1om emieils  2trurp;u1opxnifeiytls eauvp t0alxoxfcoytfpDe i s;( t2um(m3io1ol emictls)sDtax  oo0aexoiociltlm ran snt4arxrmr3tatomtrluvs;( teur(rpoudol n nvi tfsrurxm ;o0ole miciltla um( s;u)tlxniociydomtrln s;s0seto(rpoo4lleelfciat s2raump;u0aeeoiietasfm2eln p t0 exnxfcoa1opt liei;t)trxrio iu4opeemfciat  2um(  ot0tltn ieiat s2em( s;(4aeeoif oy1fptr nvo s)srtmxr3nudom n ncslt  Dtr( o;o0apenmo3iltla ulu pnt0arxrmf3iytfaDraueols0s2xmio no1lle  nviasfarrau  ot1aetn octydlmDuauvsn(4trtomo iodfmt  uvs;t)t2umimpnudlmee fvta(farrau  oo4tlt mfctyslsDeauvp u) exomfcootopDrluvs t trtoxrpny4altemfeslsf 2um(rpnt1tetomoetadls umnvs;u)alenmfciydom  li o s  exrxmpio1ll  lneiltfa2raumo;t4tlto fciasls rm( p;u)alxnif tydoa elnvolt  2urxmpoy4apenlfetat  rrmumo;o0oet mi3tadfa emnmont4trtrif oatoptraieils)srto(r oo1ll e fvsl( arumu pnu0tee iiciadfaDelnvpnu)teermr3io1opDraueslt0 rxoimpnu1ope mfcils srurxmo;u4apeo fetaslm2rm(vo u4areomo3iytlmtrlnei s0 eumxrpoo4lptemivsatfa2rauro;u4tpt if3tydfs2ea( on(4arenxf3ootfa  livslt0 2xoxr3oy4alte ncias)s2rmumont0olx  iciasfm2ul(mpnu4teerirctadopDr n s t t2tmirpiydlm  mnvs t) 2taump;o0optomietlslm em( onu)arenxfcoytfpt  u sl(0trxo(m3oy4ll  mnviatfsrta(mp;o1tpxomiciysls2ea(mon()teeoifctotfm  livi ( srtoiopno4op nmnvilt a2tru  ot4tex  oetat aDuauvpnt0trtrxocoo1lpt luvsl()seurxr nu4ol nlfctl( a2tmx ooo4aetomfeiadfm2ea(vp t)aeenmfciy1laDeaneo;(0setmio no1lpeemnctltfsDrr( poo0tetnioeiasfa ranvon(4tlerxfcoa1latrlieo (0sexo(o3no4ll n fvias)a2rr( pnu0tptnifcilt s2uln pnu)alenmfcia1lp rlu s s)sexoirpiu1am nlnei t) rur(mpno4tpt mfetls s2uln snu0 exoiocto1omt  u s;( setrxopoy1altn fei s arrrumoot0texn oetas a2em( p;(0tetoxr iadfpDr nvolt0trxm(o3nu1lltn fes tf 2rm(  nt1oee ioctytfa2ulnms;(0aetrmo ty1lmD aivs t)trxo(m3iu1om  mnvias artmxr ;o1oexo ieias m2rau o () exoiocio1lp  aneolt  etmxm io1lpte ncsat)s2rr(rpno4apt mfeiytfm2emnvp u4 rtoifcia1om r n i (0 exmxo no1amtnmictat srurum ;o1tee mi3iaslm ea(vs t4alxomociadfa eliei ( s2xo(r ou1lme  iesa(fsrtmu pnt0oeenii3ildfm2ua( s ()aetnif3oy1fatr ueils) 2xoir3oydll elivsls s2rrxmpnu4apeomoeiad s em(vsnt4aexomf3ta1oa rli s;(  rtmir ny4lpe mietasfs2uax  nt0aptnmfctad a elnvp (4 lxrmf3tatlm  luvi s) rtoio3oudlm e ietls artm(m nu4alxo ictlt sDel(mon(0trtnif todlm eaivs t0s2xmiopoo4ol  mfeiatfarrmxmo;t4texn oetasfa2eln s;t)texrmr3todop rlnvsls)t2tmim ny1ap n fvslt) rraurpot0apx  ieiytla2rm(mp u4tlxrir3ty1lmt  ieo (  2uo(opnu4omen nvi t  2rr(  no0oet  fetas sDrm(vp (0aeenxf3oydfp eauvi;s sexrxo ou1apee nvs t)arrrxronu1ape iieiyt m2ea(vont4tetniociodfaDe uei s0 2xmiopou4lp n ietas a2umx pnt4aexn feiys a el(vs;u4 exnir oy1om rlueolt0 rxoirpiy4omtelicsasf rtaur ou0oleoii3iysfa raumo;u0 leomoctodoa rluvil( seum(mpoydlm emnet s) rtaxmp;u4olx  fciltla2elu on(0trxnxfcto1lmtelivo;s  ruoir3oydopenlivils  2umuroot0opeo o3iysls2umu p t4aleoifciatlatelivilt)t2toxo iodaptn iei (f Duaxmpoo0oeto iciad a ulu snt)aetrxo3oadoaDeauvs;t0 rxrxmpoydamt mnvils) 2ta(r ou1oltnif3iltla2uauvs;() rxnmocoa1fm elivs ()tetm(r iy4ll  lfvsas s2trumpnt0olt  ictldlm2em(mp;(4texnxo3oy1omD au ol(0t2ur(o oo1apenmivtatf Drm(rpot0tpxn ietat a2emn pnt4 rtomr oatomDelieols) 2uo(mpnu1opeelieia() rurxm nu0tleoii3ilslm rl(mp;()aexoif iotfateaivo (  ruoxr3nodlp elivs t)s2tmxmpnt0apx mf3iytlm2elumo;u0tetoxociatopD an sl(0trxoxopny4op emivias sDrau pot4olx if3tysla2rmn p;u4trxrmo3ootop rlueols)teumxr nodalee fcsl(fsrur(rpou1apeomfetydls2rln p (0trxnmr3oa1fa e nvil()t2tmxrpiu4altelfei (fsrtmu ont0tleomieiyslm ra(vp;(0teeomrcto1oatelnvs t teuoiopio1ale lfeil(f 2tmu pnt0aetomo3tltlaDrm(mp;t0trtnmo3tadlm rlu ol()teurir nudamen nctlt)srrauro;u0apt  f3iydlm2emnvpn(0 rtomrcoatfmte nvi;(0s2xo(rpou4lm elfetat)sDtr(rpoo1tee mi3ias aDelnmo u4 renir3iydfmtean i t srxrxo3no4lp  mnct sf rrax pou4oet moetadlmDuluvpnu0treoio3oodfpDe ies;()trxriopnydllee fci sfsDtrxro;o1teen o3iltlm em(vs;u)artnxr3io1fatelu sl(0texoxm nydale lncs ()a2rax  no4tltnmocils aDra(vs t4tltrxo oatlp  anes ()trur(rpnu4optn feiltfarum(m nt1texnmfetasla rlu o;u)altoio3oydoatelivils0teuoir3nodlm  lfvi ( aDuaxm no0olx mfetyd m2um( p;t4arenxocoo1omD ai ils)trurim3ou4lpeemieilt arrrxr ou1opt iicildfsDrau snt0arxoxfctydfp  anvo;t0sexo(m3io4lltnlneiat)s2rm(ront1oeeomoeildlsDuln o;()tetnir oytlaDrauvs;s)srurio iu1lp nlictatf Drm(mooo0opt ii3iydls2um(ms u)arxnif iytomD lnvo;t)setmxopoo1ape  nesas) 2umxr ot1alto fctydlm2um(vpnt) leoirciatoaD lnvolt0teuoxopiu4apee fvt ( aDtrumont0olx  ociatls2em(vont0treomocio1lmtrau olt)srtm(m3ny1lltemnesas s2tmxmpou1tetomoctltfaDrl(vsn(4trxoircoa1lm r ueo;t0sexm(rpiu1ll emiet tfsrta(rpot0apt iieiadla2rmums ()tleomo totoaD auvols  etm(r3ou4opeelfci t srrr(m ot4alxnmfctls m elu o;(0aleoxrcty1lmte uvs;t) rumxopnudom emies t) Drmur nt1olxo i3ilsls2rluvonu4 rxrxrcty1omt  n i;t)trto(o3iydam   nviat  2uaum ot4olxnio3iysfa2rmumont)artomf3tadom e i o;() etrim iudope  nciltfs2tm( poo1aeto octlslm uluvont4altnmo to1oatelnvol( seuo(mpiudoleelfcs ()srraurp;t1oeenmoeiat mDelumsnt0tlxomf3tytfateai o t0 rxriopoodlmtnlfcs s srum(rpnt1tlenii3iadlm elnmsnu0trxrxr3ta1omDr ieils srxm(o3iy1alt mictlt aDrmxr ;o0tleoifetyslsDuluvp u)alxniociodoatr n ilt0seumir oydame  fvta( srumxmpnu0oltn oeilslm uauvo t0tltnmr3iadfaDeaivi;s0 rxm(mpny4omtemics s)sDur( ont1tlx moeild aDua(mo;u)teermf oa1fatr uvi s)s2tr(rpiudll emietlsf rrax  oo0olxniicilt aDrl(vp;u) etnxf oydom elivolt t2urimpoy1op nlieta(fsDururpno0opxnmi3iydfa2rmu p;()trtnxf tytfaDr ueslt0 rumir3ny4ome miesl(f rta(ro;t0teeoiietld aDul( ont)altnmf iodom  ai slt0srtmim3nu1am   nvsatfartaum nu4altniictytfm rmu p u)tlxnmo oodlmDeaivs s0texr(r3oudamtemfvtlt aDtm(rpot0tlxn f3iydfsDuaumo () rtnir3iotlm   i ol()srxmxo io4amt  ncil(fsrtax  ot0aet mo3iytls rlnvp;u4 ltnirctodlpt  n i;(0 2ur(rpiudlm nlnvsat) Dtr(m ou1altnmoctysls2umuvon(4aexrxrciytfmteaivi t0seurirpno1olt  fvi tf 2trxrpoo0tptoio3iat m emnvon()texrmocty1fa eluvsls0 2tmxmpny1om nmnvia(f rrrxrono4altnmietyslm ul(mp u0tlxnxf ta1fp r i s s  rtrio ou1ome  neias)aDuauront4aeeoiociatfmDrl(ms;(4alxomo3iy1oaDr neo t setr(r nydape liei ()sruru  ou0open i3iltls emumont4trtnxf3iy1lmD  nesls0tetmxr no4lm   ivs tfsrtmu pnu4texoioeils sDul( s;u0 lxnxfctytlmDeauvs;s)t2um(o no1amt mneiasf rum(  ot1teeomo3ildlmDrlnmo;t0alxoir3tytop rlnvi t0texoio iu1aleemivtlt  2rmxrpnu1aetoio3tysla2ul( p;u4 exomo ta1lm r n s ()texriopnydlp  lnvtl(f rta(r ou1tex mf3iydfs uaumon(0 lxoxr oytoaD liei t)trtrxo3io1al e ivia()a2tmx p;t1oex  iciytfs elu sn()trtoxrctotopt auesl() euoxrpoy4lpt miesl()sDrrx p;t1opxn icildlm umu o u)artnmf3ta1omt  ieils  ruoim ny1apte fvsl(fsDumurpno4ole  ociysfm2eluvo;u0trermrcoytla   ies;( s2xoxr nu4am  mncsl()srurx ono0opt mictad a2eanvp;u4texnxociodfmtr i o t0s2tr(r3no4om  mneta(  ruru  nt0aet  fetlsfaDul( p;t4 exoxfctodfmt  nvsl( texoio3nu1ll n nes s)srra(rpoo1texoifctat a ea( p ()altnxo iy1oaD lnvi;t) etmirpiy1amtnlfesas sDtmx o;u4opx iocils sDran pnu) lerxr3ootfmte n i t)s2xoxopoy4ope  nesl()artaxmo;o4tltomf3ildls ra(mo (0arenmo3iydfaDe ues;t0seumxrpoodalenlfcilt  2rru o;t0optoii3ils s rm( snu)aetrio totoat anvi;s)s2toxopno4alt livt ()sDraurpnt1openmf3iys m2rauvs (4 rtnxr3oatfmtranvo;t  rtoxm ou4omen fcils)arra(  ;u1oee ifciadfa eaums u0texrmf3ootoaD  nvil( sruo(mpoodlpen fcsatfaDtru p;t4aetnmi3iyt aDrluvpn(0artrxoctadfpte u s ()texmiopno4amee fvi t sDrmum ;u4tpxomoeilsls rmu s (4teerxo ia1opDelnvs ()teuoimpou4opee nctatfa2urxrp;u1aetoifeiys s2emnmp;t4trxoifciydfpD lnvs t0t2xmxopoo1omee fvsl( srrrx pnt1apeomfcilsls rl(vp;()tltrxr3iotfate ieol( setrxm iodoptnmicsatfs2urxmp;o4opxn ictaslsDrmnvpn()aleomr3oa1omteln o ( srxoxrpny1lp emiei s a2ta(ro;o0tet mfciltfm uaump ()trtrmr iadfmtran il(0s2tr(m3nu4lptn ivilsfa2raxm nt4aeen i3ilslm2emn ont0 etnxfcoatfaD ai s ()seuoxo iu1omen net t srua(ront1alxnmfeiatlaDemnvo (4trtoxo3iodfp e u o t0 rtmxo3nodalte nci ()aDrmx pnt4olx miciatlm el(mo t)artnir3oa1la eaueo;s0s2uoim3ou1lltn fvslt s2tm( p;o4opx  ieiys mDuaumo u0teeoxo iytfate iei;s t2uo(m iudapeemnesatf Dtmur no1tltnioetyd s2ra(vo (4aeeoir3ootla  anvs;()srtrxm oo4apte nvtas s2umurpou4aexomoctad mDrm( s;u4teenxrcoodfatranvo;t t2uoio nu1ale  fei sfsDrau pnu1aetnifeiysfmDrl(mp (0alenmfciotlatrlneols0 rxoxm3ou1am   ies s) rrmurpou1alxo fetasfm rln pn() reoiociodfmDraies t setm(m3iudopenmivils aDrm( oou4ole iocilsls2emnvs;(4 lxnioctotfatr nvo t0 eur(o3iy4omeelietat) 2uaxro;o0altnmf3ild m2rln snu)altrmf3totlpDeaivs ()setr(opoo4omeemivta() 2raxmp;o0alxnifeiatfsDrl( p t) eenmrctotla r n o;t0trur(r3oudomenlncs tf Dtm(mont4opxoif3ilsla2ul(mp;u4alenmo3oa1opt an i;t0trumir nu4lpt lnetl( a2um(mp;u0olx  iciyt m umumpnu0 eenir3iodfate uei;s) 2xm(o3oy4amtemfcta( sDrrurp;o0tetnmoeiadla2ean o ()altriocoydlatr ieo ()teuriopoo4lptn nvs t)s2raxmp;u4ole mociasls eluvsnt0teerif iydom  anvs;()srtr(m io1ap  mncsat)s2uaurpnt4olxnmf3iyt a ra(vo t0 rtrxf3totlat lnvol()s2tmirpny4lmtnlnetlt) Draxmpot4oee  icildfmDrmn on(4trtomf3oa1fmD lnvils s2trxr3oodoleelfct () Dta(mono1aleniictltfm2rlnmo;(0artrmoctatom rau i s0 2urim io4om  mfcsas) 2tr( p;t0alxomi3tldls2umnmo;(4 eenxo3iodopD lieo;(0 2tmxr ou1ape mnesls)s2tmxmp;t4teeo o3ilsls umnvp;(0trtoiociydlpteau sls) etmxo3no4lptelneslt)a2tmu  nt4oee mo3iadla emnvs;() ltrmf3tatoptelues t0truo(r3iu1lmt  ncsl() Duaur ou0aet ifciltlm umn s;u4aeermo3oa1fpteluesl( teuoio oodamenmfetl( a2taumpno0altoioeiadls emuvont0aleoxocoatlpDrli s t)trtmio3iodomenlfcsat srtr(r no0teen feiad m2eauvp t0teerir tydoat ln o;s tetoxo iodllen iesa(fsDur( o;o4oltomieiaslsDumu pnu)tlxrioctodlaDeln o;s0s2umxmpiu1lmt  nvs t srtm(r nt0tlto fetytlm2rauvs;()arxrxrciydomt lneils) 2urirpiu4llt  ies (f Drauronu1oet  oetlsfsDrlnvs;t) exrxrciytoaD aneilt0t2urir nu4ll nmicsat) 2umumpnt1olxoiociyt m uan p (4 leomfcia1laDrluei s0setoim nu4llt  fcsl( sDur( pno4oeto octadlsDrm(vs;u4tltriocoydop   i s;t0 exr(o ny4lmte ncil(fs2raumpoo1tpx  ietyt a umu s u0 lxomo3tadfpt lu sls0s2trim nydap n nesls) Dtmxr ;u1alenmi3tytlmDem(vs t0tltrmo3oo1lp r nes t seuoxrpnodlpenmfeia(farraum ou0alenmi3iytfa rln o (4teenir3iotlmtrlnvilt0 eurim nudol   iesls srtmum ou4apxomf3ilsfm2el(vonu)tetrir3ootfpt luvo t setrxo3nydopte ivs tf 2ur(root1aex mi3iytlm2rmnmpnt4aexoifctotlmt  i i s) 2xrxo iu4om   fes sfs2tm(rp;t0tee  feiytfs uanmsn(0tlerircoydlpDe ieol()trxoir io1omenlfvsa(fsDrr( onu4tlx  oeils aDemuvs u)texnmf3oatlpte n olt t2tr(mpoy4ame mneslt  Dtaxr ;o1alto ocilt a elnms (0altomo oy1lp rauvsls0sexoxm ny4lm  lnvslsfa2taxmoot1tpxo fcildfmDrau p t0tlenxr3oy1faD ln i;s0t2urim3io1lp elfvia(f Dumxr ;u1oeen ictyd m2ulnms;u)trtnmocoo1lm rln i ()seurxmpnudopeemivt t  Dtax onu4olxomfetat aDran p;u0tleoxr iy1lmtelnei;t  ruoxm3io4ll   icias) Dtmumpoo4tpen oeilslm2rl(mont) lxnioctotfp   ivi (0 eumir3oo1alt lici s)aDur(  ;u0alto ietasfs rmn o;u4arxrxfcoa1omte n ols)texrxo nu1op nlictas aDum( poo1oee iicildfsDeanvp;t4treoxo tytop eau ol(0trtoxmpnudlm  lfet (fsDtaxr no1oee  i3iatlm2ul(ms ()altrir iatom r nvo (0srxmxo iy1olenmncs ( a2ta(ro;t1tltn o3tat m2ua(von(4aeeoircootopte i i;(  2tmxr3io4altnlfvtatf Dururpno0alt mictatlaDem(vp t4teenxrcta1opte nvo;s) 2tr(o oo4apeelict s arrmxro;o0oexomoctat a ra( p u)arermo iy1omDeaivo;t)srtrim3nu4ap n iei tfsDur(mp;o1apxn o3tlt aDemuvs t) rtnifcoa1opDrauvi (  rxoxrpoydamtelivta(  Durur nt1tpx iociltlsDul( snu0 leomo todfmD anei t0tetrirpoy4opeemncilsfa2tr(rpnt0oeenio3ilsfs emnvonu0 rxnir oa1laDraies s)teuoxm3nydale mieia(farrau  nu0texn oetas m2ul( s t0aleoircoodfptr nes t srur(m3no4ap elncias) rum(m no1altnmi3iyd sDuauvp;(0tlerir tadla e nvols texriopiu4lle lfvi ( s2uax p;u0olxnmoctyd m2rauvp;u4 eenio tatfateli o;(0s2xo(mpoydole  fvs s s2rr(rono4tlxoii3ild sDumnvs;t)altoif3iatfpDe i o ( trxoir3oo4al n nvtas aDrr(mooo1olto feiyt a ran snt4altomfcootfpDe uei t0teuo(mpiy1lmtn nvslt)artm( p;u1tpxnmfetaslm2emuvon(4trtomociatoaD  n o ()s2uoio3ou1ol n fcilt arur(rp;u0oetn f3iys sDrm(msnu0trtomfciotlmDrlu sls trto(opnodom nlictasfsrumu ont1olxn iciasfsDelnvs t)areniociatomt  uvs;t)texoxrpou1am nlivi t aDra(ront0teeomfetld a2rmnms t4trxoifciadfat livsls srtm(m3iudam elfvs s) Drmxrpnt4tptn ocils s2rmnmpnu0tetomf3iytlpDraies ()teumxmpnu4aptemfei (fartaxmont4aeenmieilt aDumumo;t) etrxf ta1oateanei;()trum(rpiydamenlncsas) Durump;u1oeeoiocildfmDeauvo;t0altnmo3ta1latrlnei s) rxrxo iy4lp nlics (  rrm(m oo0oeenmfeiysfa2em( o (4tltomf oo1lmD luvilt trurxm3no4amt mfetlt)sDum(r no0teen i3tasls2ranmpn(4 lxrio3oy1fa eli o;( srxrir3iodoltelnvt s)aDurxrpnu1aeeo ociysfa2emumo;u0alxrxfciadlpteaieol( srtm(r no1altn fet (faDra(  ;t4texo o3ilsfm eauvo () rxniocoy1opteaueslt) 2to(mpny1llenlnct s)s2rm( pnu1aetoiictys s raumo (4trxnif todfaD ai ils  2xrxm io1omtn ivias srtrxrpou0tpeomoetlslm2ra(vsn(0 ltoxr3iotfmDelnes;t0 ruo(o3iudlmt  iesa( arra(mp;o0olxn fctld a2rmnms;t)tetoxrcoadlmDr ieo s)setoxm3nodap  lncil() Drmxm no0opeo f3iatfsDra( s;t4arenxf ta1lp r iei;(0setr(mpiu4lltnlnvs t) rrmxm nu4tee if3iadfmDelu p u) renmfciadoat lu slt)sruoirpou4op  mfcs ()s2raum ;o1apx  oeiad a2rl( o u) ltnxr ta1omDr nvs s0setoxr ou4ap emnvtltfa2umu p;t0aleniictytlsDrmn o ()trtrmo3oydoa ean s s t2xmxr3ny1alt  nei t  2uru oou1aeeoiociytfa2el(mpn(4altoxf tydop eluvi;s)seum(m3iudale lneils)a2taxm no4olxnmociasls um(vo (4tlxrmo3tatoa   nvi s) 2urxrpoy1olt  fcta(  Dtm( poo1olxn feilsfm emn o;t)altnxo3tadoa  ai il()t2uoio iy1ame  fcslt)srtmu oot0aptomo3ias s rluvsnt4alerxo3oytopt ai i (0texo(o iy1am  mfviltf Dumum ot4tpenif3tyd s elnmo;u4 exnmr ta1lpt anes;s  2tmiopnodom  lfcs (fsrur(r oo4olxoiocildlm umumo;u)tltnio3oatlptr uvslt0seuoiopio4lme  fvsasf Dtmumpoo1oleomo3ias aDuluvsnt)tetrmr todfatranvs s)srxmim nu1oleelfvs t srta( p;t0apxnmi3iadla2uaumo ()aexnmfcoy1late n ol(0seurim iy4lp e ict () Dtmxmpot1aleoioeiysfs ea(msn(4aetnxr oodfa eluvslt setrimpnu1ome lfeiltf Duax  no4apeoiiciat s rm(mp;()teeoxfcia1fa  an i;()tetrxr no1ome lfetat aDtmx onu4olt  ietyt m2rmnvo u0 eerxf3iodfm rluvo;s  exo(o3ny1lpenlfeil()arrrx pno1apxomfctysls uanmo;u)alermr iadfateauvil(0teuoxo3oudlpenmnetlt srtmurooo4apenmfctytlm2ulnvpnt4trxrio iydoaD aneo;s setoirpiodolt lnetas)arrmx ooo0aexnif3iyt s emnmon(4trermf oadlmDrauvo;s0seuoir3io4olenmnviltfartaxr ;t4texomfctltlm rm( sn(0tlxrxo oa1oa e neil(0trxrxm3oy4lp   netas sDumxronu0tlxniiciad m eanvo u0texrxocto1omtrlnvs;(0 etmxrpny1apeelnct ()aDrrum nt0tpenifciltfm um(ms t0 renxociotfatrlivslt t2triopny1am  mnvils)aDtrxr ot4tlxomfciadfa2emnvo (0teeoir tadfa elnesl(0 rto(opiudllt mfetl(f Durxmoou4teeomi3iyd sDrl(vsnt)trxrmf ootlmD aiei t  rtr(r nydame mfet tf Dua( poo4optnmo3iys a2ea( o u0tleoxf ty1opDr u slt)t2xo(opiudom   fcsl(f 2tmx p;o0opx  i3iadla2emuvo (4aetrxf ootlm eanvo (  exo(r3iydome mnetls aDrmxroou0oltoii3iltls2eanmsn(0arerxf3iytfate u i ()t2tr(mpny4lmt mivilsfa2umxmono4oet moeiatlaDeauvp u4artoif todopte uvils  rum(o ny1om e ici s  rrm(rp;u1olx if3iaslaDeauvp (0 rxomf ty1op elnvi s)srtrimpoy1lpt  iciltfaDtm( p;o1aetoifciyd m2rl( snt4alenir3oy1lm   ies ( trxoxrpno1olte ivi s srrru  ou1tptomf3iaslsDrmnvpnu4aexomociydopt  iei t trumxrpoodomenlncia(fs2uax ont4aetomoeiyd aDelnvs u4trtnxfcoodomD aues;(0trxrxr3iy1lmt miesl( aDuaurpou1aexoioeiltfm2elu s;(4 rxnir3tatopDrai ils)s2tmio iu1om nmfctas s2rru pou0oee ifetyslm2ulums t0 eeomrctotop eanvs;t  exoxmpou4ol  mnet s) 2raxm oo0texoifciydlm2rm( s t0altoxr tydop  aivi () 2uoir io1lptemneiltfsDum(mpou4aee mi3tytlmDrmuvs u)arenif oo1fatrlueo ( trtrirpnudlmenmnesls)srtax ont1apen f3tltfs rmn s;() rxrmo3iatlp   i o s)s2xmiopio1oltemnetls)aDtru ooo4tpe if3iatfm em(ms;u) eermf tatfatrai i s  rur(o oo1ome  nviat) 2tr(rp;o0tpto iciltfsDra( o u4 exrircia1fp e i i;s)trur(rpnodam   nvsa(f Dumxmont4oleomociat m2ra( o u) lxoxf oydlaD livsl(0t2urxm3no1amt livtlt srrm( p;o4tltoifetasfm2rm( p (0altoxo todlpt 
\ No newline at end of file
@@ -0,0 +1 @@
+uvs s)s2um(mpnudam emfctat aDtmur ot1optnmicilsfaDulu s u4aeenmf3ia1oaD  nesls setoxmpiy1ap nmivtltfs2rrxro;o4alx ii3tysfm rm(mo;u) reoxr3io1latraueo t0srxrirpnu1ap nmfciat) Duaxmpnt0oetomf3iydfs raumo (0 lxnxo iytoptrluvol(0seuo(rpno1lle lnvilt  rta(mo;t4oetomfetydls ea(mp;u4tlxrifctatlmteauvslt0trxoxm ny1apenlivsl( aDrrum ;u1olxo feiatfs ra(mp;()tlxniociodfp ran i;(  ruo(rpiydlmtn fci sfaDtau  ;u1oex ifeiltlm rlumo;t4trtrmr oo1lpDrauvs () 2xmimpnu1ap n feilsf rrr(r nt4oeenmf3iad m2uln snu0texnmrcoadfaDrauvols)setmir3io4optelfeia( aDtrx o;u4alx  ieilt a2emuvp;u)trtrxfcoy1fmtrau i s0sexrxr3oy4lltnlfcta() rra(m ;u4optoio3iltlm2rmnms t) lxomociy1fptrauei ()srto(o3nodlmtemnci (  Drau pnu0tleo ietatfsDra(mpnt) eenmr3oo1lateluvilt) ruoim nodlmtelfeia()a2ua(m nu0teto fctas s elums u4 rtnxociytlmDelies;( tetoiopno4amtn fvsl() 2rru onu4apt  oetld m rm(mp;u0trermf3oy1lm r ieol()trxoimpoodoptelnvsa()arrr(  nt0tet  feildfm rmn s;u) lxnxf3tadfpt ai i ()trxr(opiu4olt  ieia( sDtau p;u4aet  fcilsfa2ea(vs t) exnmr iytopt  ivsls)srxo(o3iu1altnlfeslsfs2rmu onu0tlxn ictldfa rmumo;(0alxomo3to1optrlu i s0t2tr(m3oo1lpen fvta( s2rm( onu0teenmi3iytfaDrl(vo;u)tlxnir tydop r uvi;s)t2xoir3oydol nmivsl()arrrum no1olenmi3iadls ul( ont)artoxf3oytlmDeau ilt0s2xr(o ou1ol emfeils)s2rrxmpnt0tpx mf3iydfs2uln snt4alermfcoa1omD luesls0s2urir iy1opeemnvsl()aDta(moot4tlt iictltlm umn onu)alerif3oodlaDrlueslt)trtr(m3oo4apt livia(fa2urxrpno4oetnmocilslsDum(vsnu0tetrxo ia1lmDeai s t)s2ur(rpnydamtemfcs tfsDururoot1apt mfciytfaDemuvo;t0artnmrcoodfm e n il( setmxo3oydlltemfvil(farumx onu4oet  fctld aDeanvsnt0tlxrir tadlaD anvi (0t2trxmpoo1lmenlfvi s)srtau p;o0ole  i3tadfa2raumo (0arenmf oatopDr nvs;t trtoio3iu1lmenmics sf 2trumono0alenii3ild aDrmnvs;t)arxnxo ootfp e u o;t)seum(opou1lmt lnetls)s2tm(rono1apt miciysfa em(vpnu4artrxf oa1opDe uvo t0 ruoim oy1opte ictas) Dtm(r ;o1tle mo3tld mDeanvsnt0 rxnxfciotop elnei () 2tr(m oydap nmfvilt)aDurx  nt0tet mo3iltfaDem( p (4 rxomo3tytom eai o;( srxrir nu1ame  nci t  Drmxro;u0tlto oeiltls2rmums u0texnxrcty1oaD auvs ( s2xrxo3oydlp nmfvs tfs2ur( o;u0ole if3tatfs uau o t4arxoxr oytfaDelnvol(0t2uoxr3oydlpeelfet sf rtrxr no4tle moetltlsDelnmo u4trtrioctydlpD anvilt) exr(r3iydap e fes sfaDrax  nu0opt mfeilt m2rl( ont) rxomo tatop   neolt0t2tm(r3oudlpt  ivs (  Dtrx pnt1aet mf3tysla uauvonu0 rxoirciadfpDr n o t0seuoio3no4amte fcta(f rra(r nu0ape  ieiadls ua(vp t4tlxomociytfmDrai s;t)teum(o3ou1amt mnesat srra(m ;o1aeeoifctls a eln o t) ltrmr3oatoaDe n ils0 rtrxo3iy1apt  fvsa( srra( ooo0oet  f3iydfs um(vo t) rtomociydfaDraueslt  rtmir oo4amt livsa() 2ua(m nu4aeeoiocild s2emnmo t0 exomo3oo1omDe uvi ()srxrir3oo4ol emfvt s sruaxr ou1tlxnmfeils sDumums;()arxoxo3oytla elneol(0srurimpou1ll  lncs ()a2rrxm ;t1alxnioctatls uanmo;t4tlxrmr tydlm r iesl()trtrimpoo4olt mici t)sDtau pnu4ope  i3tls a2emu p () rxrio3iodlmte uei t trxo(rpiu1ll  mietasfa2uaumo;u0tltomfetysls umn o t0tlerir ty1lmt lueol(  2tmxo nudamt lfvtl() rtm( p;t4opxomi3iys a2el(ms;u4alenxo oadfptrlivil(0s2uoxo iu1lmtnlivtl() Dtr(rp;u0aptomo3tad m ua( o (0 lxrmf oa1opD an i (0s2toio3iu1omt lneilt) rtm(m no0tpxnmoctldls rau p u0 exoxr3oydlmtrln s t  2xo(mpnudlme  fciasfsDtrumpnt0tpen f3ild m elnvo;(4 exrmr io1fat auei (0 2uoxo nydap elfvt tfsDtr(mp;o1tleoiictytls ul( s (4alerio3iy1lp rli i t)s2tmir ou1opt lnci sfs2rmx ooo0alenif3iltlm2um(mpnt4tltoir oytoa rlnvo s srxoxm no1aptelnctasfs2rm(moot1oeenmictltlmDuanmp u0tetnif3ta1omDelnvslt)srtrim io1alte ictatfaDtrxmpot0tex mfeiltfs umumon(4 lenir tytlpDrln i;t0srtoxr3nudaltn fcia(  Drrurpoo0aleomieiyd m2eanvpnt0 rtrir iydfmtr ieo;( srxrim3ou1lmtnmnvslt)srum(mo;o1aee  oeildls uan p;u) rerxfciytomtr uei;(0 exmimpoydol   ivt ()sDraumpnt0apxoiictytfa2umnvo u0trtoir3to1faDr iesl( teuoxmpny4lmtnmnvtl(f rtau o;t1tltnmictlsfmDua(vsnt4trenxocoo1lm  luvs;s0trum(opoydomtelici (f 2tax ont0tet  fciyt mDuauvp (0trxomr oadopDrlies;( s2trxmpoy4ale  neiat sDtrxm ot0opt  f3iasfm2rmn p (4teerir tydopD aieol()trtoxm oudoleemnesas)a2tru p;o4tpeniocils m ul(ms;() eermf iytop r nvs s0truo(m oo4am emfcils) 2uax o;t1olx ioctaslaDea( snt4alxrio3tydlp  lnvs (0sruoirpiudlmee nctl()sDumurp;o1opeoiieiasfmDemnvsn() eenir oy1late nvsl(  exrxmpny1oltn iei (faDurxm ou4ale mieiltlm2ulnvonu0tetniocia1fmDrlivi ( srumxmpno4lle mnvi tf Drau  ;u4tlxn octyd aDumuvpnt)aexnxrctotlp r uvilt) exrirpnudap e fetas aDumxr ;o0opeoifciltfaDumnvo;()altomr todoatraivslt0trtmxo ou4optnmfcsl( srrr(ro;t0oetnmf3ilsfs um(mp;t4tltrio tydom rlnvi;s  etm(rpou1am  mncil(fs2rrxmoot0texnmociydlmDran s ()tltrxf iytopDraies;(  2urio3nydoptemfvt (  2rrur ;t4aee  ictytfm uluvp;u4 ltoxoctatfm raieo (0t2xm(r nodole lfvtl() 2tm( o;u1oexnmf3iysfs rm(ms (4 lxrmo3iytlp  lueils0t2xmio3nodom nlnvs (farrmu  nu4apxn ietadlm2ran sn(0tleoxfctydla eluvols)t2xo(rpou4op n ivtlsfs2rrum ;u0tltnmf3iasla umnvp;(4teenio iodomDr n sl()s2urxmpou1omtelnetlsfaDra(mo;u4tltn oeilt mDeauvs;t4teenir to1la e nei;(0t2xr(m3ny1ap nmfvs ()sDurxrono0tpto iciat a2eanms;t)texomr3iotfm eai ils0 exoiopoo4ame  nctasfa2uru pnt1oex mf3iytfaDuan on()tltomfcta1oaDr n i;s0teum(o iudlm  lietl()a2uru pot0ope  ieildla2elump;u4alenxfctodoaDrauvo;s) euoimpnu4ol e nvtasfarrrxm ;u0olxn feiat s2rmu o (4trxoxfcoo1fmt lnvs ( trurimpnu1olen nesas sDumumont1opxniociyd sDuln o u4tlerif ia1fptrlueo;s0srtrxrpnydlpe mncil( sDtmxm ;t1apen o3tlslaDulu pn(4 rxrmociy1omteln i s0s2xr(opnu1op elieiatfsDuaurooo0apx ifeilslm elnvont4trtomr3tadla elnvo t  2ur(rpoydam nlfvsl( a2rm(ro;t0opx if3iatfm2ean on(0 lermocty1fpDelu i;(0sruoxr3iu4lmtnmfcsa() rraxro;t4aeto ieiydla2ua(vs;()artrmfciatfpD anvols  euoimpnu4om e ivia()s2tmu  nu0olxnmociytfs2uanmp (4artrxr oadoat ai ils) etmiopoy1lp e ncias  Durxr ou4opxomf3tasfm2ean o (0teenxo3tytlm   nei;(  2trimpiy4lm emfvtltfsDumxr ;u4tptomfetytfs2ulnvsnu4artnxr3iydfm  lueo s s2um(o3oydlmeeliesl(fs2trxm ;o1aptn i3tys m2umn o;(0texrmrcoo1oa r nvo;s)t2tm(r no1lpen ncsl()arua(rpno0tlt ii3iyt m elump;(0 lxrioctydlate ivil( t2xr(r3oo4llte ncsl()sruaur oo0tltnmo3iydfa ua(mo () reoxo tytfa e u sls0 2urio3oo1lptn ivt sf Durxm ;u0tpeoif3tyd m emumon(0 eerircio1fp eli i;s0trxmim3oodol   ictlt a2um(m ;t4apt miciys s rmumpn(0 eenif3iotopDrlu sls t2umxo nu4alte nvtasfaDrmu ooo1alenmociat s2rl(vp;(0tlxomfciatopDelivil() 2tmxm3no1olenlfvs s sDtaumont0tleo octys mDem(ms (4 rtrir3oodoptraivi ()sexoim3nudlm  mietls)srua(  nt1aeenmfcias a2ran o t4trtrxf3ootfmte uei t truoxo nydomtnmivsas a2uaur nt1oeeoio3tad mDuanmp t)aexnmf iodfaD  uvs t) 2toxo ny4lltnmfeiat s2tmumpou0oltnmietlsfm ua(mo t)aeenmo3totlpte uvolt0 rxoimpnu4alee feia() Drmu o;t1aexoiiciatfmDuan snt4 lxnxo oa1fmt au o;s0 2xmxm3oy4ap nmfcsas aruaxmp;o0optomfcildfmDua(ms u4trtrmo3totla   uei;s)t2xoxopiy1omtelneiatfa2rmum no4oetnii3ils a2elnvo;t4 leomocoydfateliei;( t2xmiopoy1op nlnci tf ruaxm ot0tet moeild aDulumsnt4tlxoxo3oytfp rlivsls) exr(o3iydlltemnvi ( aDtr(ro;o1alto ieiat a ulnvonu4 lermo3oatop r u ilt teuoio3io4ll   nvil()arta(rpnt0alxomi3ilt m2elnvs;u)teerxr oadomDrli o;t0t2toxrpoy4lpee ivta(f rrrx  nu1tetoiictltlm umnmp u0tlxnif3iadlmDran ils0tetr(rpnu1om   fvi ()srta(roou1alxn feiat a2rauvs t4aetrio3oy1lm ean o;t0trtmimpoy4ll nmncia(  Dtrxro;o4aet ifctls aDranmpn(0aetrmr todopDe i i (  rum(m3nudap nlici t) rtmuront0altomo3tydls2ranvp ()tetrifctytfmt lneo;s setoxm3oodlm  lfvs t)s2rauro;u1oee ioctaslsDem(vont4 rxnxo3tadlmte ivi;t0 rxoxr oodlpen nvsasfsDuaxm ;o4olxnmociydlm eauvp u4altomr oodlaD livolt s2trxopno4optnmnvsls)a2tax pnu1tpenio3iat s2elumo;(0teeoxo3tytoa  auvs;s)sexrio oo4omee ictls) 2tax ooo0aet mietydfm2umumsnu) lenir3iytomD lieils sexmirpny4lp emivs (f 2rr( ont0tlto fciatfm2eln o;t4trxnxr3io1fpt  ieil(  exo(o oo1lpe  neia(f rta( o;t1oexnmicilslm ul(vsnt)aexnif3iadlmt ln ols0 eur(opio4ol  micilsf rrmxm ;t4teeoifctlt m uluvp u0trtrmo3ta1lmt  n i t)t2urxmpno4omtelietl(  rta(r ot1apen fciysfm ean ont0alxnmf3iytlaDeli ils)srto(mpnodll elictl()aDumuront0ope  fctlsfa rluvs u4 etoirciydoa rliei;() 2xo(r3io4ale  ivil()srrru o;o1tee mo3tadfs2ea(mp t0tltrifcoo1lmDr i o;() rtoirpny1ope mivilt)sDurum ;u4tlto fciltfm em(mo (4treoxr todomtranesl( tetrxo3nydapeelneilt)srrmurpoo1olxnif3iys m2emnmo t) eermr3iotlaDe i sl( s2trimpnu4ll n netls) 2taxr ;u4opx iieiytfm eluvs;() etnif3ia1om r i ols0s2tmxm3iodam   fet t  Durxm ou4opx  ietyt mDel(vs;()altoxfcoatfmtrlnesl(0t2uoio iy1optnmivta() 2raum ou4tpenmf3tltls2ea(mp;(4trxnmr iotlaDraieo;s)trxr(r oy4am  lfvta(  Dta(r ;t0aetoifctlt sDulnmo;t)artrir todlpte i i ( srur(opou4om n fei s)sDurxmpot1tlenioctasfa2emn o t4trerir totfat auei (0s2um(rpou4aptnmnvt ( a2trum no1tlenmicildfmDuanmont0trtnmociydfmtelivo t s2umim3nu4ll eliesatfsDtrxmpno0tlxnmi3iydlaDumnvp;t4texnxrciotfaDrln i;t0sruoir3iy1ame mnetl()sDtr(mpot1aet  octldfmDem(mo t)tlxomo iy1omDranvsl(0srxm(m3iudlpe  nciatfaDtrxrp;t1oleomo3ildfm umnvs () ltrir ia1lmD luei;t t2tmxo3oy4llenmfes t sDumxroou0tpxnmf3tydla2ea(mont0 rxrxo oa1lpt  n slt  eurxrpno1lm nmfesl() 2rmx p;u0alt ifeildla2elu pnt0arxomfciatlmDrlnes s t2urir3no1lm nmnes t)srrr(moou1opxomietyd a rlnms;()artrmr3totop  luvs;s0t2xo(mpoy4lme  nctasfsDur(  nt0teto oeiltla ea(mpn() lenxr3iodfpt luei;t0trxrxmpou4alenlfetls) 2rax pnu4apenioctatlm2uan s u) etnmf3tytfmDe ueilt  rxoio3ou1llt  nvtasfsDuauronu0opx  ietldfs eanvpnu0altoxr3iydomt  i s;t0tetrxmpoy1ale lictl( s2uru oou1apeomietytfsDuln o (0arenmo totlpDrlu i t0 exmxrpnudal  mnet s  Drauronu1tet mo3ilsfs elu s;(4trxrir3iotfmD livi t t2urxr nudllenlics t  Dtr(rpoo0tpx  o3tad mDua(ms u)aeeomr ty1lmtrlivi;t0 2toxm3nodaltnlivi t  ruaxroou1opx mociyd s uau p (0 renmfcoo1lm rlieo;s teum(r3nu4olee fes tf rtr(rp;t1tetn i3iydlsDrl( s;t0altnifciytfmt  n i t setrir3oydlleelfci s)aDrr(rpou0tlt ifcilsls2rmn o t)tlxniociotfate n ol()tetrxo3oodlleelnciasf 2urx pou0aee if3ildfmDea(vs t4trxnxr3io1fpD ai i ( t2ur(o3ou1oltemfcilt)s2rm(mp;t0tpeomfeilsla uluvo (4 lenmr iadoa eanvs t)seurim3oudll nlfcil( srrmuronu4oltnmiciydla2raums t0alenir oydfp e neil()srtm(mpio4ol e netltfarumxmono1olx  oeiys mDem( pnu) rxrxfcto1lat  ueolt) rtm(r3ny4lptn fvtlt  2tr(  ot1apt  fetytlaDua(vsnu4trxoif3ootfmDrlnei s0teumir3nu4optnlici () 2tr(mo;u0tleomoeiadfm2umuvo;()aexoxo3iodfm elnvi t)trxmir ny1ap   fcs s)srua(mpnt1alenmo3iasla2uan snt0trxoxfctotfp  auvil( teurir iy1opt  ncsl()s2uaxmo;u1oetniieildfs2rlumo;()teeomr iy1lpDraiei t0t2to(o3ou4llt  fesa( srra(moou1tetnifciltla em( p t0trxrmf ootfmDe nvi t) 2xrxrpiydomen ivils  2umurono0apt  i3iydlmDumumo u)aexoif3iotomD lu o s0s2xr(r no4amte fvsl() 2uaurp;t1olt  ieiaslm ea( o ()aexrir iy1lmtrlnei t0s2toim oodap nmneil(fsDurxmpnu4alxo fciadfm2um( o (0alerif oodoptrau o s)teuo(mpoo4oltnmnesls a2rru  no1alxoioctysfa ea(msnu) rxomr oadfmt lies ( texoirpno4al n neiat)sDrrum ;t0ole  ieiysfsDrl( snu0aetoiocoatla raiei (  2xo(r ny1altelfvtl(fartmx  ;t1olt  oetyd a uanmon()aeeoircoydfaD auvolt  exr(opou1om emici t srur(r nu4oleomocilt mDemumpnt)tltomfcia1lat luvi ( s2um(rpou4lpe  nei () Drr(rpot1optn ietat mDrlnms;t)tlxnxfciydlmtelivs t) 2xm(opnu1ol e fvsl(faDumuro;t4aptomfcildlsDuaums t0alxnif3iatomDeauvils)teuoxo oodllteliei (fsrtrumont0tpeoioeilt mDrl(vs;u)tetoio oa1oaDr u ols0tetmxr3iodome lncsltf 2ua(m nu4tlt  feiys m em(vp;(4tlermr3to1laDelu i;t0sexoir3nudlmeelnvt t  rrrx p;u4tetomoeiadlsDul(vs t0aleoxrciadfateliei;t sexo(o3iy1ol   fvi tfsrtaxmpoo0oetoif3ilslmDrln onu4aetnmo iodla  luvolt  exmxr nydam e nesatf rtmurpou4altnifciydfm2ua(vp;t0alxoio3ia1opDeanvil()srxo(m3nu4alt lictat  2ua(monu4opx moeilsfm2ea( p u)texriociatopD aivs s)s2to(m oudom  mfci ( a2tr(mono1olxomociytfm rlnvo t) rtrmocoadfm r i s;() 2xm(r3ny4am n netl()aDrmum nt0oetn ieiytls2ulums;u4 rxoir3iy1oa rln il()trxoxmpou1omen ncsltfs2umxr nt4tpe ii3iltfs2eau s;t0aexoir tatfptraieol(0t2umio oo4op nlnvt t)aDuru ono1tlxn i3ilslsDum( p;t4 lxnmo3ootom   nes;t)tetmxmpny1alee feiatf ruaur ;u0ape ifeiatfs2rl( pnu0 lenio3iytfatrau slt) 2uoir nodoleelnesa()artrxront1alt ioctas a2eluvpnu)arxrio3todfaDelneo t)trtrxmpoodame  ies tf Drr(ro;t0apenii3ilsfa2el(ms u4altrir3oy1fmDe uvs;s)trtmxo3ou1lmt mfcia()s2rmuro;u4apenmi3iadfm uanvp u)trerif iytopte nvi (0trxrxopoy4aptnlfcs tfs2umu  no0tltomi3tytfmDeluvs t)alerif ta1omt  u s ( t2uoxopnudom   ics s)arumxmoot4tlxo i3ilsfm2rm( s t0tltoxf ootop  aueo t teumiopoo4ll e nci (fsDrrxm ;u1aex  iciat m eaump t4 rtnmfcoo1lptrlivs s0s2urio iudllenlfvslsf rtrxmoot4teeoiieiydfaDumuvp t0tetoiocta1lpD luei t)s2tmxo oudop nmfci () rraumo;o4apeo i3iasfmDemnvon(4trermo to1omt aneo t)tetoimpnu4ap  mietas)sDrmx pnt4opxoiietad m2elu pn(4aexrmo iadlp   ies t) 2xoxopiy1lpt lnvtlt  Dumxr ;t0tptomo3iasfm rl(mp;t)teenif3tytopD anei t) 2trimpoy1al elfctlt  Drau p;t0altn ociydls ea(vp;u)texnxr ta1lmDeliesls)srur(o3io1olte feiasfaDra( o;u0tetn o3ilsla ua(vs;u0arxrircoy1lp  lieo s srurxmpnydlptnlfvt (fa2tm( pnu0alxo fctad s2em(msnu) ltrxrcoatopteaieilt  rxrim3iodol emncilt a2ur(r oo4oetnmieiyslm umu s;() lxoir3iadfmDeau s;t0sexr(rpno1ale lfesl(fa2uru  nt0oetoii3iytlm umu sn(0tlxrxr3tytop   i i;s0trxo(r ny4openlivsl(fs2taxrp;t4tlxomfeilt a2rl(mont0artrmfcta1fm raneil(  rtrir no1lpeelivias) Drm(mp;t4apto f3tasla2eauvpnu)trxnmr ia1fat lu i;t)s2trxr nu1lp e iesat)sDtax ont4tpx ioeiad m ua(vont0trenir3tatfpDr ies t)seuoxrpoy4olt mfvt t)sDrru p;o4teto feiat mDeanvo;t4trermf iy1oaDe ieo ( t2xrir iu4am emnvtas  rtrumoot0tleo oeiadfmDrmn snt4areomr tadopDrln o () 2tmxr iu4ap e ietas srtr(m ou0apt mo3ias sDumnvs;u)teenxfcootop r n i;s0 2tmxmpnu4olt mictas) rtmuro;o1oee moeiasfaDrlumonu0 eenio oytfpt  u i;(0s2xm(r nudope lfcsatf 2tm(monu0apxoioeiysfa2emnms u)aetnxo3tadlmDr ivsls)t2trxr oodope lfcias aDrm(ront4opxoiietat a2rluvsn()tetnmo3to1faD anvs t  etriopio4alenmncs (  Drrumono4olenmociltfa emump u)texrxo3oo1lmDr nes;(  2trir3iy1lle livs ( a2rau p;u1olx  f3iydfs rlnvp;u0artoirciotomte ues t  2uoir3iy4opeemncsa(fsrrrumo;o0oexo oeildfmDum( onu0alxoxr3totlmDean s s)sexr(m3oudoltnmivia(fartru o;o1tetoio3tytfmDem(ms (4 rerxrctotoaDranesl()t2xo(m oy4omenlfvi (fa2rax pot1apx  fctatfa eanmp u0tltoxo ia1oatr n il()t2xmim nydomee nvtasfarurur ot0tlxomoctlslsDrl(vsn(0tltrmo3tatoaD au s;t)s2xmxopoy4am  lietat)sDrau pno0oeeo f3ildfm2ea(mo (0 etnifcia1omDeauei;s)srtm(mpou4ll n nvtls aDua(rpou1oexomi3ias m ua(vs u4aeerirciatoatrlnes;s)t2um(opou4lmte nvt () 2ra(moou0apenmociydls2ra(vp u)tltrxf3iy1lm elnvs s teuoirpnydlpenlneils) Dtaxrpno4ale mfetlsfm2ea( snu4altrif3oo1omt lies;(  eur(m3nu1am e ivs () rtmuro;t4tlxo ociadfs ranmsnu4tetnxo3to1fpDr ueolt0 etrio3nudopenlnvt ()sDrrx  no4oex iociysfs2ul(mpnu4aetrif3oytoa r nvo;t)trxmxmpny1apen nvil(  2taxr nt4tlt mo3iyt aDuauvo t0tlerircta1fm eanvo;(0trxr(o nydalt  fvsa()a2rm(ro;o4oleniicils s rauvon()altomo3oadomt  ieolt)trxoio3oodom e iet (fartru o;o4tlx ifetlsls2rl(mp;(0tleomocia1opDr i i;(0trurimpiodop  lfvia()a2umx oou0tlxoioetltlm2rln on()aetnxr oatoa r u s;s0s2tmim3ny4lm emfetlt aDur(r nu4oexn fetyt s elu ont0altoxocoodoatelueol(0 ruoxopiu4lpeelics tf Drr( o;o0aet  oeiat sDra(ms;u4 ltrmo ta1omtranvs ( srur(opiy1am nmivia(faDtmx  ;o1oltnioeiatlmDel(vp () lxoxo3ty1la   uvsl()sruo(mpio1ol  mnvt ()srra(mont4teeomociad a2elnms (4alxoxf iadfm eau o;t)texm(m3oo1apte icsas sDrr(rpnu4opx  ocilsla2rau pnu4 rxrmocia1fa  anvs;t)srtmio3iudal e nviat aDurumono0apxomieiltlsDrmumonu) lxrxr3oa1lm rlivo;s0 2xoiopnu1ap  lfcil(fs2raum no4olen iciltla2rl(mon() eerif tatopDelnvo (  etm(rpoydalt mfvsls artaxro;u4tlenmoetyt m2eaump t4tetoxf oo1om rlnvi;s0t2uoxo nodam  mivt ()s2umxro;u1tlt iociatfs eau p;t4arxnxo3ootomDraneols) 2trxm3oo1lptemivt s) 2umx  ot1oeeomf3ilt m uaumo t)tleoxoctotla eaies t) 2xr(o3iu4am   fcs s)s2rr(rpou0oexn ociyt m el( s (0aeeomf iytopte u o ( t2umxo oydoltelfetas srrrx pnt1aexn o3iytfmDranvonu4tlxrmf3iadoate ivils0srumirpiy1aptnlnetlsfa2taumoou0tle iiciysfaDea(ms;() reomr3todfp e uei;s texr(mpiu1ap nmnesls aDrau pou0altn ietat a2raums;t4treoirciytlmtr nesls) rxr(m3io4al  mfeil( a2rrum ot1oetnioetldlm ulnmp;t4arermrctodfp rlivo;t)truoio3oo4opt lfes s s2uaumonu0texnmocilsfmDulums;u4alenxrcoy1omtr ies;s  ruoirpny1ap  mneia()s2rr(rpoo1tlxnifctyslm rmn snt0aetrxoctatfptr u slt)s2triopiu1optelietlt  2ua( p;u4tee  iciysfs uan sn(4alerir iotlmteanvs t t2xo(r oy1om  livs (farua(m nu4aexnioeiyt m2em(vs;u0 lenmr3ty1fptean i s) 2uo(o nudom e ncsasfsDumur ou4aexoiietytlmDuluvs () exnmf oatomteaues ( srto(o ny4lptnlnci (f rtm( onu4tltn ociasfs2eauvs;t)aetrmfctotlp r ueo s0 2xrir3oudom emncsltfsDuaxr nt4texniociltfaDelnmp u0tlxoio tytlmt  ivi (  rtmxrpny4lmee ivt sfa2tmxm oo1tptnioeils mDrau onu4 eenxo3totla  aues;()t2toim3no4olt  ivs (f Drmu  ;t1tlxoii3ilsla2um(mont) rtoxrciy1fpDraieo s0setoim3ou4amt  fvs s)s2tm(m nt4tleoifcildls uaumo;t4artnir3iatfaDe nes s) rxoim3iydol elfvtat)sDtm(rp;o1opeomi3iasls ul(mo;t0 ltomf3tadlm  aieil() rumxo3ny1omeemivtas  Dta(rpot4ole iociytlmDrm( pn(0 ltomf iy1oa r ieol()tetm(mpiy4al nlfci t)sDumump;u1ope moctytla2ra(mon(0aetnmrciodfmDr u s;(0 rtriopnu1apenlivs (  Dtmx poo1aeenmfciys m ra(vpn(0aexrmo3to1op eaueo;s0teurir oy1olenmncilsfsrumumoou1oet ifciatfs2umu s;(4teeomrcootomDrln o t  etmxm3iydlpenmfcias)srrr(r ;u4olx  ociyt s2eluvs (4trxomfcoydlmt luvs (0t2toiopoy4ll  lfet (fsrrrxrpoo0oex ioeiadlm2elnmpnu) eeomf tadom eai i t0srtmio3iy4lmtemnvil(  2umu  nu0altn ietytfaDrmums ()tlxnxf oy1lmDelivils0tetmio iudameelicsat s2rruro;t4tleomociytls2ulnmo;u) rxnio3iy1lm r i o;t) rtoxopno1llt mics sfaDuau oot0aexomfetatfaDul(vs t) lxomf3ootlaDe uvo;t0teurirpnodap emncilt)srtrxro;u1aptniicils s rln snt0 leoxf ta1fp r i ils t2umxrpiy4am e nvil( a2uaxro;o1oeenmfcildfs ulnms;u) rxnmociytfm rauvols0setm(m iu1ll nmieiat) rua( oot0tlx miciytla2emnvo u0arerxfciy1lateaueo;t) rxr(r3iu1omt mnvta()srtmxmpno4opxoif3iyt mDumu o u4 eermr iatlmteli o;s)s2xmxr ny1ope  fvt t aDuax p;u0olxomoetldfs2eanmp;u4aeenmfcia1lpDrlivo ( s2uo(mpoy4ole  ictlt)sDrrx pno0olx iiciatfm emu s;t4trerio tydfate ieslt  2toxr oydolt lictasfsrtr(mpnt4tlt iietlslm2ranvont4texnmf ia1laD lieil()s2uo(o3oo4op nmfcta(f 2ta(m ot0apen ociyslmDran o u0tleoircootfpDraieol( trur(mpou1lle lnci (  rrr(r oo4tpenmfeiytlmDelu s u) eenmrcoadop  lieilt  exrxm3nodomtelnei t)a2um(  nt1tleoiieiytlaDel(ms (0trtoxfciydfaD livs s srum(opiy4olee fcsat) 2umx oot0tptnmociytls2ran o;t0 etrmf ootomDrln o (0 etmxm3no1ame livi s)srua( p;t1texo oeilsfs2ulumonu4trtrmf oodfmteau o;s t2uoxr oo1omt lnet s  rtr( p;o1tpto i3tysfa2emumonu4 rtrmrciatlp raneo s  rurxrpny1oleemfeils)aDumxro;o0apenifciys m eanmo t0arxnxociadfmt  neils  exrxopoo1lp emfvta( s2raxm ou1olxniiciysls2eau pnt0tlxrxfciadfat aueols0trur(r3io4op n nciat s2ur(ro;t1oet  ociltlmDelnvo;u) rxnxrctotlp  anvol( sexoim ny4lp  mfcslt aDrm( o;o1olt  o3iat a2rmumpn()teermfcio1latraivs;( trumirpoo4llen ict ( srrr(rpou1opx moeildls uau snu0trxnxoctotomD liei;t)s2xmimpou1optelncias aDrr(  ;o1aeeomf3tytfs2rlums;() etnxf3oatfpt aueo s s2xrxm oodolenmivsls srur(  ;o0oeeniociad s el(ms t0teerxo iy1lmt  i o;t) 2xm(m iu4omte ivsl( a2ua(moot0tleoiictatlaDranvs u)aexoirciydom rlnvo;t teuoio nu1aptn fcsltfartru ont1tpeo iciyslaDrl(mpn(0 rtoxo ootomD anvo t0 2toxrpny1aptelfcsa()s2trur no0texomoeilt aDum(mo;(4 rxomf io1fa  luesl(  2ur(m nu4amenlivils sDrau  ;o1tptoifciasfm2ulnms;t4 ltrmo iotoate uvi s)trxm(o3iudlmt lnctlsf rtm(m ou0tlxn o3ilsfm rmnmon(4teenmfctadfmDe neslt)trxm(rpnydoptnliei t srrmu pnu0apt mfetytfmDumu p;t0 lxrio3oydlm rlueils trtoxrpiodlp n fetatfaDraump;u0apx ii3iytfs umnvs;t0 etrxfcootlmDr nvil(0sexr(mpou4om e ivil(fsrtrx poo0olenioctydla2rau onu)arenmo3oatlptelu o;s)setr(r iu4llenlncilt  rum(r ot0aet miciasfm2ran s u4 lerxf3iatfp raieo ( seumirpnodope miviasfa2taxrono4aex mociyd s2elnvp;(4altoir tatlpte i o;t  2tr(m oo4lp  lfvsltf rurxmp;o0apx mfcias mDul(ms t0 rxrxo3iydfa   u i;s trtoio3oodamt mnesl()sDta( o;u1opt moeiys s2eanvs t)areoifcty1fmt auvi;(  exo(rpoo4llen fvs ()arumum nu4aleoif3ildlaDrl(mp;u0aexrmoctatlpDran i;(  eum(o nu1ame liesa()sruaxroot0oexniociyslsDemn snu0 exoxr iotlmt li ils t2to(mpio4ol  lnvil(fsrrau  no0opx ifciat s umnvs u)arenio oo1laDrauvi t) rxrxopno1lmtnmivt ()srua( pno1tltomieiydlaDeluvp (0alxoir3tadoa  li ol(0 2trxr ny1aptnmfet sf Draxront4opxn ocilt a2ul( o;t)texrxf iodla raueo;()trxmxo iy1ape licilsfs2ua(rpoo1apeoiicias m el( s u)aetoxfctadop  lu s;s0tetoxo ny1lmee ncilsf 2umu o;u0tet ifctld aDum(ms;()aeerif todfa r uvo;t) 2tr(r nodamt mncslt s2rm(rp;u4opxomi3tyt a2elumsnu4alxnxo3tytlpD  nvo t trxr(r ny1lme  nctls) 2rrurp;o1oetnifetlt a2um(vsn(0altnif3iytfa rai s () 2uriopiodam n ieta(f rrmu o;o4ale mfeildfs elumo t) etnif3iytopt ln i;s)trxmxmpio1op   iesltfsDrax oot4opxoioeiydfa2rlu onu)aeeomo tydlpDelnes;s s2xr(o oy1olt livsatfsDrmu pot4tlx  i3iyt m2eaums;u4trtrifcoytlpt luvslt seuoio3ou1om emnvs ( aDrrx  ;o4olxnmicilt mDrau o;u4artnif io1la r i s t0t2toxm3io4lm   fvt (f rtr(rooo1ape iociadls2um(mpnt0 ltrioctytfatranvi;t setmxr ou4ap   fvia() 2um(  nt4alto f3tlt sDuanmp;(0 ltnxfciodfm r uvilt)trxmio oo1lpe mnvi (f rrax pot0olx ifetlt mDraumo;(4tlxnxf iytom raivs;()t2trxo no4lpeemicsa(fsrur(ront1alx if3iytfs uluvsnu0 leomr iodlmDrlivo ( srum(opiudam nmicsa() 2um(mont4tltnioctas a ulumo (4arxoxf3iodoa e n ols)t2xoio3ny4ol  lictls a2tr(m no4oleoifetatfaDra( s t0trxrifciytlm  lnei t0setr(rpoo4al  lfes s)aDrr(m ot1apxn feiys sDean s;t0 ltrif iotfatrlueo;() 2xmxo3iodol  liesa()aDum(rpnu0optoiietad s2ra(vp t)areoir3ootfmt auvs t teuo(o oodal e nei ( a2taxr nu0apx  ietyt a2ul(mo;u4teenmrciydop rlivils s2uoiopoudolenmncsas a2tr(moot0optnioeiadlm2ulu p;()aetrmo3iotop  luesl()seurxm iy1lpe  iesltfartmxroou1opx iiciatlm2ua( o t4aeeoif oo1fm  livi;( sexoio oodal elictls)arrmumo;t0olt  iciadfs2ulnmpn(0 rxniocty1laDr u o t0 2xoim iydlp elfcsls  2trxm ;o1oee  oeiasfmDeanvsnu4texrxf3oo1la e u o ()s2umxrpio4optnmfvtlt)a2tmur ot4tltnio3tat a2rm(ms u0alxomocio1fmt lnei s0 rur(opio1ap elfeta(  Drrurpno0tpe ifcils s2emumpn() eermo3iatlateaieil()setrxm3iy4ome  fctltfsrum(mpnu0tltomoctydlm eluvp (4 renmr iy1fpDranei s0trxoio no4al  mnetas s2tr( pno0oetoiocildfaDua( s;u4 exoirctodlmte n ils0 rurim nydlmtnmnctat sDtrxr ot1aeeomfeiat s2ul(ms (0artrxrcio1fpDe i o t setrxrpnu1lm   fvsa(f rrmumpnu0tptn feiatfa ea(vont4tlerxocoatlaDean ilt) rxm(mpio4lm  lnvtlt s2ururpoo4ope  o3tltfa2rmumo () rtnmo3to1fp  aivo;t0 2tm(r ny1lpt mivilt  Drrxm ;o1ape ifeiatfm ran pnu0trxnxo ta1op e uei;s t2urir3io4oltn nesat aDurxmoot0texo fctydfs elump;u0aeerxo3oatlm rln s s0 rxriopiudapte ietlt) 2tr(  ot0aexnmi3iadfaDemu p;t0altoioctodomtelu i;t0 rxmim3nydope mnetas) 2rmxrpou0aexnmictytfa eanvp u)aetnxr3oy1op eaneslt  2umxr ou1llt lfeta( a2umumoot0aleo ietlt sDeln s;(4 rerirctytla eanvolt seuoxo ou1olt lnesls  2rmu  nu1texnmi3tld mDrauvsnu4texrmo iytlmtrlneols)sexrxrpoo1lltnmfcs t)srur(rp;o4oltnmo3tadlsDeauvs t)trxnxociotlptelu i (0s2umim no4ll nmivi tf 2tr(  ;t4tpt moetasfs uanmp u4arerir oo1fptr i s;s0s2uoxo nydll nmnvtas s2rr(  ot1apto o3iyt a2rmuvp;u0teeomf totla rluvi;()t2urxmpnodamtelict tf rum(  oo4apenif3tysfm2elu ont0tetoif3iy1fmDrlnvs s0s2xoxm ou1ape  fcsls)a2rr( o;t1ape mieiyd aDrlu pnt0artrmrciadlateluvi;() euoim ou1oltnmictas srtmu pnt4oltn icildlm2rmn p () eerxf3tytoa rln s s0s2tmir3nu4ll emncs t)sDtrxm ot4oex  o3iytfm2rlnvont)trxoxo3iadfpDeliesls)s2tmiopoodap nlneiasf rtrxmoot1tptnmfctaslsDrluvsn(0alxnmfcto1oaD  ueolt t2xrxr nu1lp nmieiat)sDtaumpot0optoiictydlm el( ont)alxomf3oo1lp rlivo;(0seum(m3oudopt lfvslt)a2rm( ono1tpeo icildlmDelump;u0 exrmr3tadfm elivs;s) rxrxm nu4ap emfct sfarrmurpno0alenif3ildla2emuvont4aeerxf todopD  i o (0s2tmirpoodlpeelfeilsfa2ta(rp;o0opxn oetatfs ul( sn(4 etomf3tydfpteanvils s2xoxr no4ap nmfetatfaDtr(mo;t1oleoif3tltfm rmu s;u0aexrir totomDeli s s trumxr iodomenlnetas)sDrmu onu1aet  f3iydfa2rau onu4artomf oodfpt luvs;s0truoxopiudom nlieias arurxroou4olxnmfciadls emn snu4 etnxr3ia1lm  livo;t)texoio oydaleelncsas  rrr( p;u4oltnmi3tldls rmums u4artrmo3ootomD  uei ()t2trir3ny1omtnmivia(f ruaurpno1opxnmoetlsfa rluvpnt)aexomr3iy1lpt  n o;t) rto(opoy4omen ietl(f Drru  ;t1tlt moeiytfa emnmsn(4aexoio3tydlp rli s;(0 2toxr3oo4olenmfeilsfsrur(mp;t0alxnmfctad aDrlu o (4teerif ta1oaDeanes s0t2trir3iydal n nctls  rtau p;t0opxo fetad m2uanmp;u) eenmf3totfpD aivo;s0 ruoimpiydom  mfviat  rur(mp;o1apxomocildfa2rl(vp u4 etomoctadfaD anvo t0 rtrim3iy1al e nvt () 2tr(r no4texoio3iad s2rlumon(4 rermf oytlmD  ueolt0texmxmpnudap nliesatfa2uaxro;u1tex  fetysla2rm(mpnt4altnir iodfa rluvslt0setmxm3nudlmtelieiasf rtrx pot0oex iietydfa ul(mp;u)aeenxf oodfa rlnes;t)t2uo(mpnudolenlieils)arrau  ;t1texn fctlslaDrmnmo;u)alxrmf oa1fmt lnei;s0 2uoimpnodapt mnei ( srta(r no4aexnmo3tasfmDrluvo (0altrmrciytomteanvo s0 rtoxm nudamtn ncsl()srurxr ;u1aeto ietad a2rauvs t)tltnmr3iydomDelueslt0s2xm(o iodlmtnlncsls) rum(mpou0alxnii3iyslsDemn s;u4 lxnio oytla ranes s  2xrxm3oydalt lieslsfsDrrurp;u4alt ifcils a umuvo;t)trxrxrctodomt  i s;(0s2tmir3iy4ll e ics s)aDtau  ;u4apeo octyd a2rlu p () eerio3iytfm   uvi t)seurxrpnydap n ict t sDuaxr ;t1texoifetlt s um(ms;(4arxoxo iydoaDeluesl(  eur(m oydope lfvi (fsDra( ont1alt ifeiaslm2ua(vo (0aexrxrcoy1lmtr u s;t) rxrim3ou4omtn netas)sDrrumoou4aleomieilt s2eaums;t4tetnxr3tytoptelnvo;() 2um(m3iodlleemneiat)sDraxm ;o1opxomf3tldfsDem(msn(4aeenxo ty1lmD lies t) 2uoxopiodape mfcsls  2taum ot1oexomieiytfa eau o;() rxnmo totomt an o;t t2xm(r3nu4olenliesatf 2rr(  nt4apeomo3ildls rmn pnu) renif3totfa  an i;()texmxr3oodoptn iet s  2tmxrp;u1aee  f3iltls rlu p;u)alenxrcootfa rauvo (0s2xo(r iy1omtelivi t)aDta( oot1tpeo fetldfa2emuvo u4teeoio oa1la e ues ()t2uo(o io4lm n fct tfsDtrxm ;t4optnioctad mDran p;t0trxoxfctydoa elueol(  2ur(rpio4ll nlictls  Dua(  ot1tpxnifetat m uan o;u0aetrxoctadlmt luvils  2um(o3ny1om n nes (  Dtm(mo;o1ole  i3tlslmDeauvo (4texoxf ty1lm   ieo t) rurxm oudameelneil()s2raum ot0alxoiictas sDulu s u4teeoif to1opDeln o s trxm(o3ny4ale miesasf rrru o;t1aptn f3ildlaDul(ms;u0trxrmocoadlp ran sl(0s2toio ny4lpeemnci (fs2uax  ot1opxn ieiadfa2uaums;u4trermo totfateau i;( s2um(o io4olt mfct s) Dtmurp;u1olt ii3iysfaDrmn ont4texrmr ia1faDeaieils0srtm(r3oudalenlnct ( a2rm(rpnu4opxoifcias a2uan s;t4 lxnxrcoa1lat lu s;s seuo(r3iydapte fvtas)sDraxr ;o4ole iictyt a2eanms (0 etoircio1fa r ivil(0 2tmxo ou4lptemncils) Drr( oot0aetnmfciatlm rmnmp t0tlxnir3iy1omD  ies;t)t2urim iu1aptn iesls sDtruro;t1alx iictltfa umn s t)trtomr3oadfa eaues s) ruoir3no1aptemnvil()arta(m nu1tpe mociys sDrmuvsnt4tltrir3iotom rlivi (  exmimpiy1alenlnei tfs2rrxm ;o0tlxoifeiydfaDean p u)teenif3oodlaDe ues;s srxmxmpnudap nmncsa(  2urumpnt0olx iiciyd m2rmnmo;(4trxrmf3oy1fat anvilt)sruoio nodal e nct s)aDum(rpoo1oet mfciadlm el( s u)trxoiociytlm  li s;s) eto(o3oodal nlivsa(  rrax  ;t4oet mfciytla2eluvonu0 rtrmf oydlatran i;(0 exm(mpoodlltnlfei t  Drm(  ou0tpx  iciytfa ra(vpnu0tlxnmo3iotop elues s0t2urio3oudop   nvtlsfartr(moot1apt ifetasla2ean s (0altnif iy1opD au ils)trtoxmpoudal n fesas)srraxm ;u0tptomfciyslaDrm(vs;u4tltrxf3io1fmDraneo s0 2urio oy1aptelfcs sfsDuaur ou1tpx mieiysfm2eluvp t) ltrxfcoodomtran o t0teumio nu1al nmfeslsfaDrm(mo;u4aexoifciys s2ra( on(0alxomf3tydlmte u ol()teum(r3iodale  nesl(faDuaumpnt4aeeoif3iyt m umnmp t)trtnir3iodfa e i s;s) eur(mpoy1ol  lnvs ( s2umx o;u1aetn iciadfm uaump u) ltnir3io1fmt  u s;(0srumxm3oodapte fetls)arua(mpot1oetomfctld a2eanms u0texnxo3oytfpteln i s0 rumimpiu4omenmnvtls)sDtrxmo;u1tet  octyd m eau o u4tlenifciotop   ieil() rtrio ou1ol   feslt  2taxmpnt4altomictatls2rmumo;()trxrxrcoodlmtrlnvol( srumxopou1lpenlfvi s srrm(moot0tlxn f3iad s2umuvs u)teeoifciydfaDrauvsls0seto(o oodllee ncs tfsrtmuront1openmicilsfs elu pnt4arerir oytopt aneolt0 2umxm io1lmeelics s) rtmu pno0alxnifeiadls2ua( s (0arxoxfcia1omteauei;t0texmio no1lp  lnciltfaDumx pou0apx  ieiys a emnms;u0tleomrciotlm e neo s)tetrio3io1lme lfei tf 2rrxr oo0oee moeiyt m emu o u) lxomf3iotfpDeanvi s0trtmxr ny1op n ieia()artrxrpnt0oet mfeiytlm2ranvsnt0texoxf iy1lpteliei (0s2uoxrpiu4lmtn fvtltf 2urxmonu0opxnmo3tas s uauvs;(4 eerxrcootfpDrauvs s)setmxrpiodlmen fvt (  2tm(ronu4oetoiictys mDrln onu4areoiocio1oaDraivs (0srxoir3oudapen fcsls)arum(ro;t1tpenioctaslmDuauvp u)treoxfcoy1lpDraivo;s s2xrxmpoy4omenlncilt)sruaump;o4tpt iietyd m2ua( ont)tltnmocoytfm ean i (  2urir3nydol e fes s) rrr( p;u1alt  feias sDumu sn()tlerxrcoytfmt livi t tetmxr3nudlpenmnesls sDuaurpnu0olenio3ilt m rl(ms u)alerxrcoatfmDr u i (0 rur(o io1optnliet tfarrmxr ;u0texo oeils mDua(vs;t) exnir totopDrluvols0srum(m3oo1lp  mivs s  Dtmump;t0texoifetat s emn on(4aexnir3tytlmDelu ols0texrxrpiodlmenlnetlt sDtrxrpno0alxoifetydfa2umnvs u) renxf io1lm rai i s trtmim3oodalen net t)a2uaxr ou4alx  fciysfsDrmump;t0 lxoio3oo1optraueol(0tetoxm3oodopt  fvilt  rua(r ot0alxnmo3ild a eauvp;t4 lxomf3iytfa ranvi s s2toir no4lm nlfcia(f Dtm(  oo4texniociyt s2ran p;() exnif3oodfm r u i;( t2xoimpoo1lpeemfvsat a2ur(rono1tltnmi3iaslmDraump t4 lxrio oa1oaDeluei;t0srxrirpou4ole  fetl() 2rr(r nu1oexomf3tasfm elnvont4artnmo iatopDr n o;t0 exm(r no4omte nesa(faruaxmpnu4teeoif3iadlm ua( sn(4 rtnxr3oadlpt anes t teurxrpoodlltelnctl(f Dum(m ou1aexomf3iatfs emn o;u0altnxr oa1lmD  i sls s2toxmpnodapt mncsat) 2tmumont1tlt  oeilsfsDel(vpnu)teerif iytopt lues t trurio oy4oltn feia( aDrr(mpnt1aet  i3iatfm2ulnmp;t4areoio iytla rau ilt) etrirpoo1lm n iei sfsrumxr ;u4oexomfetyd m rau snu4 rerio iodla rlueilt)s2xoio3no4lptemfviat sDuaumooo4altn octldla2rlu s;t4tetomrcoadlpD  uvils texrxm3oodoleemfes t)a2trxrp;u1alt  o3tytla el(mo (4artrxf oadlatrlies;t s2xoimpoo1apenlnci s) rrrurpou0opeomoeiad a em(vpnu4 renxf iydfptrlnes;s setmxr3oo4ol elfvilsfs2tr(mp;u0opt mi3iyt aDuln s;t0aeenif oydomte uvs s  ruo(o iodamenmivilsf Dum( pno4oltnmfciyd m2elnmsn()trxomo oatomDraueils)trxoim3iu4ame lietas sDuaumo;t1tptniictydla uanvont4 renmfcta1fp e n s;s)texmir3oudope mieiat) rrau pou4texniieiydfs umn s;t) etrxfcta1fa r ieo;s)setmxo io1olenlictat)aDrr(mp;t1oet  oeild s2uaums t4aexomo3oydlpDelueo t0trxoxrpoodam n fvt tf 2raxmpnt0alen ieildfaDrau o;() lenxr tydla r u o (0tetmxopiu1al   iciat) Dumur ou4tptnifciasfm um( p;u) rtomo3io1lpte i il()t2to(o3oodapt lnctasf rra(mo;u4ole iietyslsDranmsnt) ltoxfcoy1fm   ieslt  2trio iydaltn ici s) Dtrumoou1aptomoeiad s2umnvp;t) lxoio tatfm  an s;(0 2uo(opiudlm nmietat arurx  no4aexn oeildls rl(mp u4texnxr totoptr neilt)texoimpnu1alte ivia(f Drau onu0oeeo fetldfs2el( pnu) exomr tydfa e neols)trxm(mpio1lpen fes sfaDrrxm oo4tleomieildfaDemump u) ltoxrctodfpD ai ils) 2urxrpiy4lptnmics () Dtmurpnt1aetnmictlsls elnmp;u)tlerxo ty1lpDrlivs () 2xoimpiodap  lnetlt aDum(ro;u1tptniiciydfm2ul(mpnt) rtnxf to1fpt  u ols setr(m oo1lp nmfvil()arum(rp;u4open ociytfa eanvon()trenif to1om  an o;t trxrxrpnu1ome  ictlt aDum(  ou1tetn f3iytls2umnms;t)aeeomociodlpDr uvols  2tm(m3iodlptemncsat srtr(m ;o0tlxnmf3iytlsDrl(vp (4aleoxfcta1fmDrai s;( sexr(o ou4lmeemfciatfarrrurp;u1oleniieiyd sDeau snu0alxnmr3oy1fpte u il(  eurxr3oudale livsat aDrrx  oo4tltnifetltls2ulnmp u4artoxo tadlatrlnvo;(0 rumxo ny1lmt micslt s2tmu pnu0oee if3ild m um(mo;u4 lxnmociytlm   nvi;t0srxmxr iy1apee fcsl()aDtrxm ;o0olxo f3iatlmDelnvpn()aexrif ty1fp  au o;s) 2ur(rpny1opee icsat)srur(m ;o1tpen fetatfmDranvo;() rtnmo iytlm  lnvs (0srxr(m3oo1al nmivias s2rru  ou0alx ii3iydla2rmnmo u0altnif3iatlmD lneil( srtoir3nodlptemnesls) Dtaurp;u4tltn oetydfm2el(monu)arxnmr3oy1lmD liei () 2to(o iy4lltnlies tfa2urx pnt0oeto ieiltfsDelu pn(0 leomr3ta1lptr uvol(0 ruoxr3iu1altnlictlt arur( onu1oexo feiysla2eanvs ()tltoxf3iadfaD  uvsls0 2urir3iudaltemict t) rraxrp;u1tlenio3iytlsDemums u) ltnxr3oatoa eauvs (  eto(opoudamtnlivia()a2uauront1olxniieiysfa rmu o;u)teermocoadlp e uvslt  2xr(mpoodolenmfvsls a2raum nt1opxo o3tadlm2umums (0aetrxf to1lpDeln i;(0 rxoxr oy1lpee fvsas sDtrum oo4olto fciytfa ulnvp (0teeoir3oytlp rau o ( texo(m iu4alt lict sf Duaxr ;u1ole  feiysfm eanvp u0 lxoif oatlm ean s s trxoxo3no1lltnlnvi (f 2tru ont1aptn feiasfmDuaumo;t0trerioctydfm r n s;()texm(o ou4olt lnvi sf 2rrxr ;u1olt mietys m uln on()trxrmo3oy1oaDrln ol()setoxo3oydlme liviltfa2uaum oo1aexn oeilslaDumnvp u)tlxnxr3oo1oaD lu ils srtoxo3iodamt  netasf Drrxm ;u0ole io3tyt a rl(mo;u0artnxo3oytfmD an i t  2uriopnydlptn icilt)sDurxmono0opeo f3iytlm2rauvs (4areomocootlpt  ieil() ruo(opoo4ole mict s) Dua( pnu4tlxomf3tldfm2rauvo;()trxoircto1opDrlnes;s s2uoxr iydllen fvsl()sDtruroot1ole  oeiydfm2ea(ms;t0tetoifciytfpDr ues;(  2to(m nu1am   nvsas arurumont4opt iicilsls2rauvs t)tleoxo3todfp elu o t  2ur(mpno1omeemfvsat srumxr nt4olen o3iyd a rlu p;()trerxo ia1lp  aieo;t)t2xmxo oy4ol emncilt sruru  no1oet  oeiad s rauvo u0teeomo tytlpDraivs;s0trxoxmpoodap e ieiltfsrta(  ;t1tptn fetls m rm(ms;t0texoxfcoa1fpDeaueolt t2xoio oy4lmtnmfeias)aDtr(mpou1tex if3iat mDul(mp t0 rxoxr oa1omD aieols) rxm(r oydlp emivs (fs2umum ou1oetnmfciaslm em(mo;(4tlenmf3oadlp   nvi ( s2xoirpnydaptnmfesas)a2rmu p;o4tptniociaslm2eauvp;u) lenmr3oatoate nvi;(  rtmxmpoudlm nlfcsasfsrtm(ro;o1tleniictls s2raump (0texnmf3tadfmtrlieolt  rur(opoodlltelnesatf rumu ooo0oleo ieiydls rmnmp;t4aetnxocoydlp eln i;s)texrxr io4ll emiesa(  rrmurpnu1apeoiociasls umu o u4aleoxfcoo1lpDelnes s)trtmxmpiudap   ivtat)arua(rono1aeen feiat m rmnvp;t4trermf3tydfaDe u s;s) rxr(o3nu1om e fetat)s2uaumooo1apx  fctldfs rm(vs t)tetomo iydoaD auvo ()t2um(mpoydap nmnes t) Dra(r ot4oexn i3ias m2emnmo t0 rtoif3to1fmteaivs t0 2uo(opou4lmeemnvs tf 2ur(  nu0aetoioctltfaDrmn pn(0tetrmrcootfpt  u ils)seumio3ou1lpt lfei ( s2tmxmo;u4tle mi3iyslm2uanvo;u0 lenxo3ootfp  aiei t)tetmxrpny4alte feils)arum(r oo1opto fciytla2eluvo t0 ltrif3ia1lmtr nes t) rtrir ny1lmte icilt  rrmxr no1oltn ieiat aDum(msnt4aexrmo3iotfmDrlivo t  ruoxopnu4ap  mncsl( aDtrxro;u1tlxomf3tldfaDuan o (0 exnircoatfmte u ols)trumxo iudop emncs s)sDurx oot1aetoiocild aDuluvsnu)texrxrcoatla r u o () 2tmxmpou4olt lieiltfsrumump;t0aeeo octlslmDrmums;t4texnxocia1omDrln o (0 etr(o ny4ll elncsls)a2rru pot0olx  ieiyd s rlnmo t4aleomoctodlptelnvil() rxrxr nydolte nvtasfs2rmx ooo1tltnmfeilsfmDemu pnt4aexoxf3oatom r uei s0srxr(m3oy4lpt  ies (  2rrxr ou4aptoifeildla uln p t)alenmo3todfm   u i t)srtrxr iy1omte ieils)srtrxr ;o4tetnmi3tltfm2ra( pnu0 reomr3oatla rlivo s)s2tmxr3oy4lp   fctlt)aDuaxmpno1apt  i3tlsfsDum( s;t4altrmoctytfpt livsl( t2um(rpiudop elfci ()artau ont4tle  o3iltls ea(vpnu) rxomo todfmD  ivi s0 exrio oydamtemictlt  rumxmono1oltn f3iytfa2elumpn(4 rtnir oa1oaDe i o (0trtmxo3ny4lptn ieils)s2um( ooo0oetn feild m el(vs;u4 etoio3todfm eauvsls0srto(r3io4op nmfetat)sDum(mp;u1aex mi3iysfm2ea(vo;t0aexnifcoytfatranvi s seuo(r iodol nlfcsasfsrrrxronu4oexomoeilslsDean pn(0 eenif3tytlpDe nvo (  2to(r3ou4opee icsl( srrrxr nu1apxn fciadfs2ran o;(4alxrmfctadomDrauvilt0 eur(opou4ome miei (  2rau p;o1tetomfeiasfa rau p (0 rtnif oatoaDrln slt)srtmim3ny4am emnctls)a2uaxmpoo0aet miciydfm em(vonu)trtomfctadopDe n s;t0 rxm(o3ou4lpe lfvsa()arur( ono1oee ifetlsfm2ulnmpnt0tlxomr3tatfm ean sls srxr(m ou1lptemieilt)s2ra(rpnu4apenmo3iydla ua( pn() rxoif3iytlptraneo t)s2urimpoydlpe mfcsa(faDua( pno4oexo i3iysla2em( o (0tlxoxocoydoaDrlnvilt texoim3oudop  mnet t srua( ooo0tptnmi3iyslaDemnms u)tetrir3totlmte nvo s)seur(r3iodomtemivils)srtmxr nt4olx  fcildfs umu s;t4 rtrxrciydomDrauvo t)tetoxo nu1olen nci sf 2rmu  ;o1texn fctys aDuaums;(0tleoxociodfpDeluei s)sexo(mpou4llt mnesls  2uaxront4tetomictyt m2ua( pnt)aeerxo oydfp eli s ( seto(o3nudomenmfvia( artm(rpou0tpxnioetadfs rl(mpnt)arxnxrciy1fm  luvi;t)truoxmpiu1lltnlfesls)aDur(mo;t1tpeomoeiltls uauvont) exnir3tatlp eln o;s)srxm(o3oy4ll nlietls) rrr( pou4ope ifeiad aDrmumpnt) exrxf3oytlmt  neo t) rtr(r3nu1optn ietl() Dtaxr nt0tee if3tad sDuau o;(4aeermr ootopD an ols) 2xo(opiudoltemfes s  2uaxroou4oeto fetltla ean pnu)altoif to1om eau slt  etrxopnodll  mietlt aruau ont4altomociyslm umn s;u0teeoio3oa1optr n olt srxmxm oudap n fcsl()srur(  ou0oeeo fctydfa uan o;t4 rxnircoadop  lnvsls)tetrir3iu1llt lnes ()aDtr( o;u4apenmi3tltfs ua(mp u)trxrircia1fptr ueo s trtoir3ou1ame lict sfaDtmx  oo0olenmietyslm ulnmpnt4 exomrcoy1fateaues s)s2trxopoudlm emnci tfsDtm( oou0aex mictys sDel(vsnu) eenmf3oydfmtrai sls)s2xrxmpiu1lpen fcsl(  Duau  nt0oetn octys aDra(mo u)alxomr iy1lpt  ivs;s)teto(mpnu1opeemfei (faDtax o;o0optoiieilsfs2rlnvsn()arxrmfciy1oat aieilt  exoir3nudam nlnetas)sruaurp;t0tpx  iciatla rmuvs t4 rxoxf3oadfpDrlnvolt0 euoxr3iy4lmt lnvias)srur(r ;u4oexoioctltlaDrm(vsnu0 ltoxr oodoaDeliei t0t2tr(opny1lptn ieta(  Dtrump;t0apxnmfeiltlm2emuvpnt4tetnxf iy1oat auvil() 2xoxo3nu1altemfcsl(  Duaxm nt4ole mo3ils m ul(mp t0tltoir todomte nvs;t  rxm(r no1ap elfvsatfaDrruro;u1oee ifeiytlsDrln pn() exnmo oa1lmDr ivols)seuo(rpio1openmfetas)aDtm( pot1apen oeils s2uan pnt)texomo iydlmDelnei;t0teurxopoudaltemnvsa(fa2rru o;u0alx io3tytlm2rln s;u) lxoir3oy1lpt  neo (0teto(mpio4ap  lnesa()s2tmxrpnu4ole  feiytls2eau o;u)tltoir3iy1laDe iei;s texmimpnodolenmncta(f Dta(  nu1alt iietys a2em(mo;t4tltrmr oatlmDrlu sl() 2uoxrpoy4ap emnviat  2ua(rpot0alx mfctyslmDuanvs () ltnir oa1fmt  u o t0 2umxr oodllen ivt ( sDumum nt1aex moeiatls2rm(mo (0aleoir3todomD ai o;s0 eumxo3nudlm e ivia(faDuru p;o1oetoif3tlsfsDuauvp;u) ltrxf oa1omt aueo (0s2uo(o oo4opt lfviasfa2um(ro;t4oee micilsfa el( o;t4altnmf3tatoa rliei t0t2um(opno4lptnlncilt  rrm( onu0tlxnmieiydlaDrlumsn(0teermf ty1lmtraueilt s2xrirpou4ll   ietasf Dururo;t1olxnio3iyd mDum( p (0treoio oatfm  lueslt0t2umxr3oudoptemfei ()a2ua(mpnt4opxoio3iydlsDrm(vs;u4texnmo iadomtrai ils0s2toxm nodlmtnmict tfsrrauroot1apxo ieiaslaDra(vo (0aleomo3oa1lmD aies;t  etr(m3iy1opee fvt ()aDururpou1opto feildlm eanvo;t0trtnir3tatop r nvsls0t2ur(mpou1opeelics t  Dtmxr ou0optnio3tasls2rau o;() rxomr3oadoaDrlivil( s2xo(o iy4lp nlfvsatfs2tmxmooo0tpenii3ias m elu s;t4trenxfciy1oat auvs t0tetr(o3iy1am elnesl()srtrx pnt1alenmieiydls2el( o ()treoio3oodlpD  nvslt) 2toxm3oudlm nlnes s  2tr( p;o0aet  oetytlm2rln s;u4tlenifcty1laDrlnvilt0t2tmxopiu1al   ieslsfaDraurooo4oltnmfetytfmDuln o;u0 rerio oadfpDrlieol(0srxrxm nudlp nlivi sfartax  ou1aexo i3iytfaDulnvp t) rtnio tydla ran i;(0srtoirpoo4opte nctl()aDtrurp;u4tpt  ieiysfa2rmnvo;(0trenxfctotopteaivolt0srxrxo3iu4lm elncta(farraxmpot1olenifctytfa2rluvs;(4teerxr oadfm   i ols0t2umirpny4ome  ivil(fsrtrx pot0tltoifeiasfmDul(vonu) ltrxocoa1oa e uvi;( t2xmimpiudlmtnmivtl(f 2ta(mo;t0oexnmf3ildlmDemuvon()trenxocoa1omtr nes (0srur(rpno1lmtn ivt tfa2urx  nu0opeoiocilt m umnmo u4 rxoif3tydopDr i s t srxrio3oy1llt lici (  rtr(rono4ope io3tytlmDem(vo;u4 lxoxo io1oa r i ils) rxr(m3no4lm  miet (fsrua(m nt1oetomfeiydla2eau p;u4 reniocoydlp r nvi;(0 eurxrpiu4op n nesat)artru ont1tetnmfeiysfaDrmuvp t4 lxrxr ia1faDraieo;(0 rxr(r oo4ap emnesasfs2umuro;o0oexo ietat a rau p;t4 lermr3iydlmD an o;s  2trxo3oydaptnlicilt)arrmuroot0aet if3tyslm2ranvp ()tetoxr3oadomtrln olt0 2to(opio4llt  iesasf Dtrxmo;t1aptomocilt m2ulnvsn(4 ltomo ta1om eauvi t)seumxmpnodameemicia() Drmumoou0oexoif3ild s2elnmsn(4 ltnxr oydla   ieo s)t2xr(r3nudam e ieiat)s2tmx pnu0alto i3tld a umnmon() renxfcia1fmDraiei s) 2uoiopno4ome  fetlt)aDurum ;o0tlxo fcild a2emnvsnt4aeeomf oo1oa r nvsls  2xo(r3no1lm  miviat)arurx o;u0aetn ociasfaDea(mon() leoxociytop elnvs t0 etr(o3oudapee iviasf rur(  nt1apeoioeiatfmDumnvp (0 lenmrctadfp ean olt0t2xr(opoy4op nmictlt  Dtrxrpnt4aptn ieiysfm2uln p;t4artrmr3tydopte nvi (0 rtoio3ou4ame lnetl(  Drr( o;t1olx if3iytfm2rl( p;(4texoif oytlp  anei s) 2uoxm oo4oltelfctl(f Durxmpnu0apt iieiyd mDemnmo;()artnxf oa1lp  lnvsls) rurxopoudlpte ictls s2rmur ;o0tpt io3tad m2uan o t4aexoxr3ta1lm e iei;(0tetmir3nodoltnlici sfaDur(  nu0aleoifeils m2ua(vo;u4aeeomfcty1lptr u s;t  2umxmpiydomt livsl()s2uax  ot4olx iieiad m el( on(4 exnxr3totoatrluvo (0t2xo(rpiu4llte fes sf Dtr( ooo0tpeo oeiydfm2uluvo (4 lxrif tytlmt aneo;t  2toxr oudamee nct (f Dum(moou1tpx iociltfs2ranmsnu0tetrmo oa1fm  li olt0teumim3iudaptelicsa()srtm(r no1olto i3ilsfsDeauvs;(0tltoir ia1fmDe ivi (0setm(mpiodllte fcs (  rrrum nu4apxoiiciasfmDeauvont)alxomocoadlptelu i;t0s2uo(opiy1am elfvi t aDtrx  ;o4aeenifeiadlmDrlnms u4tlerxfciydfmD livo s) ruoir nodapt micias) Dtaxrp;o0apx ii3iyd sDemuvo t0 leoxf oydlaDrliesls)tetmxo nudllt  nvi sf Dur(  ;o0tlt if3ild a emumo t0arxrxrciotomte uvi s)s2xoir iy1lm   fviat) rur(ronu1opx  fetadfaDrlnvs (4 etnxociotfpDr iesl(0srur(opiu4lm e nvsltfaDur( p;o0oltoiiciatlmDrm( pn(4alxrxrctadoaDr iei;() 2xmxopio1lpee ivta(fsDtr( ooo0oetomietls s2el(ms;u)arxnmo3todlmte ies s  exoxo iydop elfes (  Dtrurp;u0oltoiiciytfaDemnvp;(4altrxr3tydoa e i s ( s2tmio iy1ol n fetls)s2uaxm ou0oleoif3iasfm2ean p;u)altoxo io1op rln i;t0 rtmxrpnu4ape  fei s aDtmxm oo4tlxnmociadfsDranmonu)alenxrcto1lptraues (0 rxm(opiu1ope lnes (f Draur oo0tpxn feiytfm2uanvs (4artoxr3totomtraneils srum(rpiy4ap   net s sDtax oou4aetoioetat a ra(vs u0teerxocoa1oaDe neols)tetmxmpnu4amte fvtltfs2um(r ;u0aetomf3iytfm em(mo;()alxnmo tydlmt  ivils0 rtmxo3iy1lpt mies s)a2tmumooo4oee mi3iysla ulu pnt)alermr3ootlm eaueol() 2tmxr3iu4alee fvi tfsrra(rpnt4olx mociatfm2uaump u4 ltomr oy1om  livol(0seurio oy1altemncslt)aDtrx onu1tpxnmieilt m uau s u) ltoxo3ta1fpDrai olt  exmiopnu4amen neslt)aDrruro;o4oexn fetltfs ra(mp;t0 lxoxrciotom   ueslt)tetm(rpiy1ape  ivi s)sDtr( pno1oleo fctasfm2rl(vo;(4 ltrxfcoadfpDrlies;s0srxoxo ou1ale  neia(f 2rmumo;o0tex mfcilsfa el(vp;t0tlxoxr iydom e nvslt0sexrimpiy1ll  mfet (fartmxmo;t0altnmiciydfm uln s;t4aetnxr3iadoaDelnvolt trumxo iy4op e nvs s srtm(r nu4tee mfciyd a2eaump t0tlenmocty1lmtrln ols)trxrxr oo1olenlfcs tf 2raumo;o0opx  f3ilt s elu pn(4alxrmo iydfm e ivo ( s2toxrpoy1om  lictls)srta(r no1tpe moctld s rl(vsnt)arxrxf iodlpDeluvs;s) euo(r3nodome  fvi t) 2tm( p;u4tlxnmfetlsfs ra(ms;t0 ltoxf ty1lpD lnvo s0trtmxopnudlmtnmfeilsfaDur(rpou4alx iieiytlsDrlnvo (0alxomo iodlmDeau s;t) rum(m3nudolenmivtltfsDraxmoou1ape mo3iytlsDelnmonu4aeeoxo iatlateaueols0texmxo3nudlltemietlt)srtm(ro;t4oex mociydlm rlu o u)trtomf3oatoaDeaivi s0sexmim iodlm   nvt (faDtm(r ot1aet mf3ilt a2rln snt4arenmfctodop e ieo;t  2tm(o3nydame  ict s)sDta(m ot1tpto o3tydlaDelnmpnt) exnmociatfpt  uvo;s0teur(o oo4opt mnvsl( a2ta(  ot1openmiciyt s2elu s u) rtnir3iy1lpDrlieilt)sruoirpoudom  mnvs sfsrtmxr ot1tlt if3iasfsDran s (4trxnmo3oodfaDrlnvsl( trxmim3no1amtemivsatfs2tmur ;o1tpx  ictysfa ra(vp (4tlerxo iatomteli i;s0s2tr(rpiydolenmfctlt srtm(m no0ope  fciysla eanmp t4tetrif3io1lp e n slt0s2uo(opou1am elnct s  rtrumoou1tpxnii3ilsla emu on(4 etrxociy1opD  iei;() rtrir3oo4alen icsasf Dtaumpnu0tleo fctadfsDrl(mo u0 exoxr oydlmDrlues;t) 2urxm no1omt mneta( aDtr(monu4oee mo3taslmDuau s;(4aetrirctotlatelieil()setr(m oydom n ies t)arumxmono0opt mf3iad sDuln snt)aexrio3oa1la elivo;s) exriopnodll e fctlsfaDuaxmpnu1olxomfcildls rm(vo;t4teeomfcoy1fp e nvo;() 2tm(o iy1olt mfvt s srra(ronu0aeeoioeiatfa rau p;t4 eeoxo3totfmD  u i;s texrio3io4om elnviat  Dtrxrooo4apto iciysls rmuvo t0artrxr3tydop r ues;s0s2tr(o3io4am elncils)aDtrxmono0tetniocilt m2uanvp;t)tleoxrcto1op e i ol() rtoirpnudolee fetltfaDra( p;o0apen ietys m ranvsnu4 etrio oydfmtrlnvi;s) 2ur(mpno1al nlnet t)srumurpoo0aptnmi3ild a umnmo t0 rerxfcta1lpDr uvi;s)s2xr(m iodap   nvils) 2urumo;o4apto ieiadlm2ranms;(4aeenxf3iydfmDr n i ()teur(r3oo4lpen ics ( s2tru ono4aexoifcildfs2ul(ms;(4tleomo3iytlmt aueo s) rtoxmpnudll nmfeta(f 2rau poo1openif3ias s2ul( o u) lxnif3oy1fm r i o;(0s2xo(m nudoltelivia(f 2umxrpou0alx  oetas s rlumsnt)arenioctydomD an s t0truo(m3oy1apte nvsa( s2rmu  nt1texoioetlt aDeanmon() renxf oadfpteaieo ()tetmxr3ou4oleemicilt aDtrxrp;o4ope mietatls2ua( s u)trtrxo3tadomte n o s0 eur(m no4om emictlsfa2ur( pnt0alto i3iaslmDemu p (0 lxrxo3oodla rlnvs;t0texo(r3iu1ope  iei ( arrau  ;u4optn ociyt m elnvo;(4artnifcio1lp eln i;s srumxm3iodapeemnesl()srra(monu0texoif3iasfsDelnmpn()arxrxf3iytfateaneol() rxm(r nodlpe lnvia(faDtmxront4tltn fciadls2elumo;u0tetrir3iodom elu sl()srxr(m oo1lmt  fetls)srrmu  no1oeeo fcilsls2rlu s ()tltoir3oa1opt  n ol()sruo(o3oydopeemnci (  2rm(mont0olxoif3iyd m2ua(mp;u0altoxf3oy1om rli o;t  ruo(m iy4om  lnct s aDta( o;o4aeto iciasfaDem( o u)tltrxo3oodfa  ln o t t2urxmpny4openmfcta(faDta(rpot0tpxnmfeiyd mDea(vsn(0aexniocoatfp r ieo;s0 2xr(o oodopt lictasf 2ur(m ;o1opt ifctls mDra(vs;u0 rxoio oadlaDelu i;(0srxo(r iodlmtnmnet sfsDrrurp;t4tet ioeiasfaDran o t4aleoxrcoytlm e uei (0s2tm(r oy1ome mies tfaDtau  ou0oee mo3tatfmDuauvp u4texnif3iatfa elivi;( trxr(rpnu4ol  livtat)aDrr(m ;t1tex moeiysls ea( p;u)tetoir3io1fp r neolt0 exoxo3ou4amtnmfctasfsrrrx o;u1alx mf3iaslaDuanvs;t4arxomo to1fmDelu sls t2xoxo3iu4altnlnvil()aDumu poo0teeo ociydfm el( s;t0 etrircio1omtrlnvslt) rxrxm3iudam   iesa(fartmurpno4oexomo3iys s umu p u0trenmfcoadfaD  uvo t)t2xm(mpoy4op e nct ( sDtrx p;o4tpxomfeias sDel(ms;u0teenio3iytoatrlieo s  2urio3no1lltelfcsls a2ra(m ;u1aeeomfeildfsDrm(vs;(0alermf oytoptrau ols)texmimpiudaptn fcil(fsrtr(  ;o4aleomoetasfm umn o;u4artomo3iy1fatr n s t)t2xrir3oudope liviasfsruax ont0teeomo3iadlm2em(mo;t0 rerir oatlaDeauvi ()t2to(m ny4om nlnvsat)a2rmur nu1teeomfciydfm2rau p (0tltrxo to1fpD auvslt0trurio nudopenmfviat)aDrrumoot1tlto fetadfm2rl( s (0aetrxocoa1la ran i s sruoxopiodlp  mfeilt  2taur nu1olxnii3tadla elnvonu4aexnif3iodlpD  ivsls s2xmxrpoydolen fvil( arrm( pot4altn fcildfs rm( sn()arxnxociotfaDelu o s sexr(r iu1apeemfvils) rurxm ;u1oleniocildfmDrm(vo;t4 ltrir3tadlm  lieols t2xoir no4omen nci sfaDumur ou1oexn iciyslaDel( s;u4arenmr oadomte nvi;s0 exmxopoudoltemfetls sDrrxmono1opxo oetytla2em( s u4alxnircootopDrlu ols trtm(rpou4lmeelnctl(f rtr(mo;t0ole mfctys m um(mp () etrxfcootopDraueo;()teum(r3no4ap e ivs s) Dtrurpnt4aeeomfetlt sDrluvs;u0aexnifctytoaDr n s;t0s2to(r ou1al  micia() 2rrumo;t0alto fciyd mDua( p u) reomrcootlmD  ueo;t0 2urir iydapee fcil(fa2urur nu1tpt ifeildla2uanvont)texrifcootopt  i o;() 2ur(o ou4altn icsltfarrrxmo;u0aeto iciytlaDuln sn(0 eerxf iy1lpt livslt)srumirpou4olte ivil(fs2ta( onu4aetnmoeiytfs ea(mo u4aexriocty1faDeaieolt teumxm3no4lpee ncslt)srtru  ;t0alenmoeild mDumuvs;t0artrifciotopt livo t)t2um(m ou1omenmfet sfa2um(r ;o0tpxnioctldfs ea(vonu)tlermocty1lmDraueo;t)texrxm3nudome lictltf rtaxmp;u1tpeomo3tytfm rmuvp t0arxnxo oa1fmDeau s s0 etr(rpoodap nlncsl(fsDtrx pno4tpxomieils mDrmumo;u0 etnxfciodfaDrli ils0srto(rpnu1alenmfesl(  2rmx  ot0alto octasfm ua(vp;()treoifcoa1la   n sl( tetoxo3io1op nmnvsas srum(moou0tetomoctls a2rmuvo;(0tetrmr to1lptelnvs;t  etoxm3no1al   ivt sfartm( onu1ape ifcildfs2emn snt4 ltomfcoy1omtrlueilt0texoxr iudlleemiet (  2rau  ;t1olenifeilsls2el(vsn()texomf3oo1lmDeli ols)teurxm3iy1omtelfcsa()aDtmxmoot4apt io3iad a rlums;u)aeeoxf ootoat  neo () 2xmxr ny1optemfcslsfa2tau pnt4tpenifciatfaDemnvsnt)artnmo3oa1oa r u slt  etrio3ou1oltn nes tfaDtau p;t1aee  ieiltls raumo;t0aetnmf3oadfm eln o;s s2xrir oo1lltnmivt tfsrtmur oo4apto i3ilsfs2uau o;t0trenircioto
\ No newline at end of file
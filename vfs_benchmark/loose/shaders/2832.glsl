@@ -0,0 +1 @@
+i slt sexrimpoudoltnmfvtat artmuroot1tpxoiictltlm2ulumsn(4trtrxfciy1op  auvs;s trtrxopiy1op nmivslsfsrumu o;o1oeen f3tlsfm2umumont4 exrmfctodfmt  nes t0 2trxrpiy1ape lici tf 2um(moot1oleoif3iytfa2el(vpnt0altrmf ootoaDraies (0teuo(mpiy4lltnlicta(fa2taxrpnt0tex  f3iydlm ul( pn()tlxnir oy1lmteaueils s2umxm3nu4alee ivtasfsDum( o;t4tlx  feiaslm uauvo t4tetomrcta1la  ai ols trurir iydop nmfciat)sDtm(r oo0ale  o3iltfs rau pnu)artomfctytlpDraivilt t2xoxo3oo4lp   fcs (f rum(r no0texoifetldlaDemu p t)tltnifcoadom  ai i;s0s2uoxrpnudole lfcsl( artaurpou1oltnifeilsfaDra(vsn()tltnmociydfp e nvi;(0trtr(m3ou1aleemfei t) 2rmx ooo4tlto i3iat mDum(mp u)trxrio3io1oatrlnei t)truo(mpiy1lp  mnet sfa2umx onu4aetoifetadfaDelums ()artrifcootfmDr nvi;t seum(opiodlpeeliei t)srtmxmpot4apen f3iadls uauvs (4tltoir3tatfp  li i;(0trto(opiodap nlfeils) rrrxr ;u0alxnifeiys sDuluvsn()tltrxo3to1lmD  ivo (  2xoxm no1aptnlfesls s2ur(  nu1tpenio3ilslm umump t)alerio3iodlaD li s (0tetmiopoy1lmte ieiasfa2umuront1olx micild m emnvsnt0 etrif3iotfpDeaueil() rtoio io1lp nlfetlt) rua(  ot1aetnmoeiydfs eanmo (4trxrxr todlaDeli ol()s2uo(r oo1op  mieslsf ruru o;t4aptn iciydlsDrmu s u0alxoxo iytlp e ueo s s2uoir nydamte netl()aruaurpnt0apxoiieiyd mDulnvs () etnxfciytoatranes s t2umirpnodaltnmfvils)a2rm(mpno4altoiociytlm2ua(msnu)trtomfcto1lmtelieol( texmim3ny4om   fei ()arrmxr nt4openii3iat a2rl( o t0aeeoxr3ootomD ln o;()s2tm(m iy1lp elicils)a2rmx o;o0olx iociys mDumump;t)artomoctadla r u sls) exrxopiy4optnlnesa()s2tmxmono4tex mfeilslmDuaumo;(0tlxrmf io1omDrlnvs s) etmxmpny4lmtemncsltfsrtmu p;u4ope  ieiysfa umn o;()tltoir ty1fatelnvi (0t2umxr3no4ll n feils)s2tmx pnu0oleomfciytfm ran p;()aetnxf3iatlpDr ivs s s2umxmpnydal emnvilt) Draur ;o4tpeomfetytfa ea( s;(4aexnmf3iy1op e i s t  rxoimpou1om   ieils)sDtmump;u0oleo oeilsfaDum(mp;u4tlxrxrcoytoptelieilt)srurxmpio1ame mfet s) Dtm(monu4tlxoifciysfsDuln sn(4 etoxf oy1fm eln ilt)srtr(o no1ame  ivsa(  rtmx o;t4oexoioeiatlm elnmp u)texoio oadfpDr iei;s  etoim iu1olt lnes s aDuau  oo0aetnioeiydfsDrauvonu4tltnircty1fmDeaivolt  eurxr3nydlmt  fct tf 2ur(mpou1aleoiietls m2ul(mo u) ltoxoctadoaDeau s s s2uo(opiy4apt lfciat) Dururpou4oeeo f3tytfa ea(mo (4 lxoiociatlm  ln o;t srxr(o3oy4ol nmfcsls s2ua(m nu4opt iieils aDul(vp (4 rtnir to1oaDeau i t sexrxo iu4lle lfvt s) 2um(  nu4opt mfctldfa2emn on(4 etnmf ootoa rlivo;s texoir io1omte net t arum( o;u4oee  f3tld m rm( p;u)trxomo3oadfa eliei;t)s2urxo nu4lp e fvtl( aruaxrpnu0tpt iiciat s2uauvsnt)arxnmo3oo1laD  ieo;s0seum(rpnu1lm   fetas a2umxmo;o4tex mo3iydla2emnvont0trtnir3tytla e i o ( truo(r nudop emnvs ()srtmxr oo4oex  f3iadfs rm(monu0tlermo tadfpD lu o;s0 2xrxm3oodam nlietl(f rtaump;t1oeen fetytla2rl(vs t) ltoxr3oo1fmD li o;t0s2xoiopiodlmeemicta( a2urx pou0oet io3iydfs eln s;(0altrio3tadlpte ueo (0 rtoxmpiudapt livia(fsDtm( pnu0aetoif3ild m emuvp u0alenioctydopD aivs;t  2toxmpno4lm elivi s arrru  ot1aeeomfciat s2ulnvpnu0treoir iydoate nvsls) rum(m3nu1lpee ictat  rtaxr oo4apt ioeiad a el(mo;()arermr oydfpDeluvols0s2uo(o nu4omt lies t) Dtau  oo0tpe iietldlm ua(mp;t0 lxomf oydfpD au o t0 eto(r iu4ope lfetas) Duaxmpou1ape if3ildls rauvo;(0teenmociatoa  livils0texmxr3oo1ll e nvslt s2tr(m ;o1aeto feiyd s el( o (4teeomociydlp elu ol()seumxmpio4alteliet ()a2ur(m ;o1tet  ictld mDrm(vsnu4alxoxr ia1omtrlivi;t)trtm(r3oo4lle mivtls) rtau pot0aexn f3tls mDulu o u0altnir tytlm rluvo;t) 2xrim3iy1aptelnesa(f 2rrxmoot0alxnif3ilsfs2em(mp t0aexoxo ootla eluvs t0srxr(opnodame mnetasfsrrm(  no0aetnifctadlm uauvs u0trtrxf iadlpte i ol(0 etoir3oo1lltemnvtas arumxrpou1tltomi3iad m2rl(vs;t)aleoxf iytfp e u i;(0 eumim3nudalenmfvsls)s2ua( pot1oet  oeiydfs eluvsn(0altomr ootlptelueils texrxmpnu1ape lnvt t)arur( pno4ape  oetatfs uluvsn() ltoif oa1lp r neils  eurxr3iudlpenmiciasfa2tr(rpnt4tpxoifeias sDea(msnt) etnirciotfa  auvol( s2toiopio1apen ieils)a2tm( p;t0aet io3iysfa uaums;(4aexomr tydomDr ieils0 2to(m iudalenlnet sfs2rr(m ou0aptn o3tas s eau o u)texrifciatfmD an i ( s2uoio3oo1amee neta(f 2rm(rp;u1olxnmf3tldfs2rlump ()aleomo3oadfatr neo;s) etmim3ou4amenmfes (  Dtmxmpnt4texnmf3iydlsDea( o;u4tlxrir3iatla elieolt tetrxo iydlmte ict t srur(ro;u4tex mo3ildla2rmuvon(0 leoio3to1lm raneo;() 2um(mpnudoltnmictat)s2rm(rp;t0tlxoio3iatla2uanvs;u4tlenxr oadfat luvs;(  rtmxr3nu4lm nmnvtls) rtmu o;u1aetomf3ildfs umn pnt0tlxnirciy1oaDranvils s2trio3iu1optnlivi ()sDtaur oo4oltniieias sDel(vp;t)tlenif todoa  ai s;s  eto(m3nudlpt livilsf rur(  nt0ole miciltfmDuauvsn(4arxnir tadopt lneslt)setriopno1llt  nes tfsrrrxmpno0tpenioeils m2ul( o t)altnif3oydlm elu s (  rtr(mpoy4omt mfvsat) Dtau pnt0tex moeiydls uluvsnt0 exrioctydlmDr n sls trtr(r3oo4lle lnvtas) rurxro;o4tet mociydls rauvsnu0trxnxf tatomt an sl(0s2xr(o nu1lptelfeslsfa2umumo;u0oeeniietls m em(vpn(0 ltnmrciydlm eai il()s2xr(mpiu4omeelfvslsf Dtmu o;u4oeenioctltfa emuvsnt0 rerirctotoa elnvo;s0tetmxm oudlpee nct tfa2raxmono1alx ifeiad mDrmuvp t4arermocoydomte iei;s) rxoxm nu4lm  lfei s) rtr(  oo1alxn fetlsla rmums;(0trenxf3tadoaDrli i t t2xo(o3ou4lmtelivtat a2um(root4olx moetysfs2uan s;(4trtrmo oy1om  ai i t  rtr(m nu4lm   fctls) 2tmu  oo4tleoio3iatfaDemnvp t4aexoxfciodfateluei;t t2um(m3oydalt lfvslt srrmu o;u4ope  i3iyt a2rln p u0 renmf oydlatr neo ( t2tmxm3oudlle micsatfsrua(monu1ale  ietlt sDua(vs t) rxrmf3tytfp eln s t0s2tr(r3ou1ll nlfcsat)sruauro;u4oetniiciydfsDrmnvp;(4areoxocoo1oaD lies;t)teuoxo ny4om nmfcs t)s2trum no1opt miciysfm el(vo;(0 reoxf3iotom eauesl(0srxoim3io1al  micsatfartmuro;u0oet io3tytfa2um(vsn(0trxrir3oo1optean ilt) exr(o nudlpe  nvt sfsrum(moot1ole  oeiadla2uln p;(4trtnmo3iydfaDe uvs;( teumxo3oo1lltn nvsa(fs2rrump;t0optomoeiydfs ul( p t4 rermf3oo1fmDr uvi t)trto(mpiy4om  lncsa( artaxr ot0texomo3iaslsDrm(ms ()arxrxr todoa rlivi ( trurim oo1oltnmivtl(fsrrru pnt0apxo feiad m ranvs u)teeoif oy1omteau i;s teurim3ou4ol nlncs tfs2um(rpnu4ole  i3iyd a uan s ()aeeoxfcoa1la e nes;(0 2urxmpiy4opee fct t sDra(m ;u4apeomo3tysfaDranmonu) rtomr3iytla rlu i;s0s2umim3nu1ap e ivil(fsrra( o;u4apt  o3taslmDulnvon(0 reoxf to1oa  lu sls0t2uoirpiy4lm e fcsls)srra( poo4opeoioeiltfm2umumsnu)tlenio oadlaD aneo;(0t2umxo3ny4om elfeiltfsDumxmoou0aetnii3iytlmDemu p;(0trtomfcoy1opDe i i ( t2toxopoudlpt  feta(  Dtr(  ou4teeoio3ilt a2em(mo;t4 rxnxrcta1omt  ueo ()seto(m iodlp nlicslsfsruau  ot1tptomi3tytls uanmp;t0 rxnxrctotlmtranvo;s srxo(rpnodlle miet t  rrrurpot0apeo fctlsls rlumsnu)alenxo3ia1faDeanvsl(  eumxrpno1lpte icil(fartaxrpnu4aeen iciadfaDelumpn(0texrxr ty1la eaivslt0tetmim oudll emietls a2rax pnu0altoiieias a emn pn()aeeoxf iadlmD livi t)teur(r3nu4am eliei ()s2ta(mp;o1tlt iietasfa rlnmpnt4 lxoir3todoptelnvslt0tetr(m3oudalenmnvil() Dtr( p;t0alxomieildls2um(mo;(4tlerir to1fa  luvilt0t2xo(mpiudaptn ivslt)sDtruronu0aetoioetlt m ulnvo u0aexomf3oy1fatr ues s0sexoir3iydaltn fviasf Dra(rpot0aptoifctytfmDeauvp u4tleoir3oytlpDeaiei;s) rurxmpoo1lm  lnvsasfa2uax  nu0aetoioeiytls umnvs;u4tlxnmocta1oat ai i;t)teum(rpnu4ame mnesasfa2rmx p;o0texomiciatfm rmn o;u4 exoxf oadfmDr nvs;s0 2um(o3nu1am e ivilt srtmu poo1oltomo3ild sDeluvo;(0alxoxr3iy1fpDr ieo s0teuo(rpno4op emieilsf Dtmurooo1oetomociasfs uan s;t4aeeoiocio1faD  nei;t  euoim nudamt lfvils) 2tru oot1tleoioeilslm2el(monu4 ltrir3iatfateaieslt0 2xoim3iy1amt  fci (fartr(r ;o4oetnii3tlt aDelnmo ()aexoxf3ootfp rauvol() ruoir oo4alenmivt ( sDumur ot0oltomieildfaDraumon() leoxo3tatfpt  ueil(0trurim3oo4om e nviltf rururo;o4ape  ocildlsDrm(msnt)tlxrxrcoodlmDranesl(0 exoxm3oo4lme licia( s2trx ont1oet ii3iat mDum(vs t)aeenmf3tydlat lieols setmio3nu4lmenmnctl() rtr(mpou0tetnmo3iysfmDrlnmp;(4tlxrxfciytfm  lieol()srxr(o3ny4ol elivt s)s2raxmp;t0oleomf3ilsls2rl(vp;t0aetrifcoadfp e u o;t0s2uoir3iu1omtnlnvtlt aDrm(rp;t1oexo fciydfs2elnmp t) exomociadla elu i ()s2xoxo nydlp emfcs (faDtm( ont0ape mocildfm emuvonu4teeomrciodfp elu ol(0 2um(r3nu1optelicils arum(rpno1apxnioeiadlsDeluvpn(0aexoxr oydla rai ils0setoxr3iy4amenmncs sfa2raxm oo4aexnio3iydfsDemnmsnu)aeeomr oa1fmD lieolt) 2toirpiu1amt  net tf Dtr(moou4oleomf3iltfs2ean p t4 ltrio3tydoptrln o ()s2xrxo oudoptemncsas)s2ta(mp;o1alen ocilsfsDrlnmp;(4trxomr oadop elu s t0 2toio nu4oltnmnct tfsrtrur no4oltoiociatlsDelnmp;(4tltoxfciydlmDe n i;s)setoim oodom nmfvtasfs2trx poo4altniieiad s uauvo u0aeeoif3iytoa raivi;t0tetrirpiu4amenmivi t)a2urumpot4oleomi3iydfa ulnmp (0 lenxo3ootfmtrlnvi s0trxoim3nodol nmfctls aDtmxrpou1alxoiictadls umu p () leoioctadfpDe neslt)t2ur(mpnu4llenmnesl(  2rax pot0tlenmfctatfaDumumpn(0alerxf3tydoaDranvo;() eto(r nydal  mfvia(fsrta(mpot1tpen ocildla rmnvs (0tlxomf3oatlat  u i;s0s2umir oodope lfesa()s2tauroou1oltnmo3tat m rlnmpnt0arenxrcoytomteanvo t texoim nydamen ieia(faDtm( o;u0oexoifetyslm em(mo u0tlxnxocoa1la eaivolt) etoxm3nu4lmen nvs sfsDrrx o;u0tltoifciyd m uau p t4 etomo3iydopDeaueo t)setmxr iy1apenlfcils) Dtaxm ot4tlxoioeiatfs2raums;t) etoxr3io1latr uvil()t2urio iodoptnlnciat)s2tmurpoo1ape iociltfaDumuvs;u0artnxocoo1la rlu slt0 etm(mpou4lm n neiltfaDtrump;t1oeeniiciat aDulums;(4 eeomo3ta1fpt  n ils0srto(o ou4om  lnctasf Durxro;t1aex mo3tltfaDrlums t4 ltrxfcoydfpDrai ols0truoxm3io4llen ivslsfa2rau pnu4ole  fctatla2ulu o;t4 rxoif3oytfpDelnvi;t0trtoio3oodlpe  ncsl()aDrrxmpnt4opx ioctaslaDea(vo;u4altoxf3tydlatrlneil(0teuo(o3iy1lm elfci ()s2umum ;u1tetnioctydlm ulnms;(4aeermrctotlmDraueo;t0setmimpny1lpt  ivsas)aDurxr ot0ape mfetasfm2ulnmp;t4arxoxfcoadfate iei;t0 eur(m3iodlp elnvtls aDraxmonu4olxnmf3iytls2ua(ms;t0aeeoxr oodfmtran i;s0sexrirpoo1ap nmfcs () rtax ooo0tlx moetytlm2el(mp;u)alermr3oodfpDeauvo t)trxoxopny1al e feia(faDtmxronu0apxnmiciltla emu o;t4tlxrxfcia1faDrluvo s0 rtr(r3no1lm nmfvsa()arrru pot0aleomo3tls aDemnvpnu4tlenioctytomD  i s t t2umxr iydolenliciatfsrumurpno0texoii3tlslaDrl(mp u0 eermociadoa r neo;t seuoxr oo4al nlfvtls)s2uaxr ou1opeomocilt a2umn sn(4 ltrmr3oadfp  lu s;s srur(mpiydole  fcilt)sDtrur no0tpenifeildfa2ua(mpn(4artrmr to1fm r u o;s0 2umir no1ol elics (f Dtr(r oo4oeto f3iadla raump u) eeomfcoatopt luei;(0srxr(rpiy1lltnmfetasf 2uaxm no0apt mf3iltfa eanmp u4areomo3iy1fa e nei s) euoxo ny4om nmnct tf Dtmxmp;t4teeomo3tld s el(von(4teenirciatfat  nvs;( setmxrpou1ap nlnvt ()s2ra( p;t1apx mociytfa rluvsnt0 ltoxociytlmt lneil( srum(opoudoltn fcias) 2umxr ;o4oetnmoetad s2uaums (4trerif3ta1fmD  nesl(0trtm(r3iudlmt mnci ( arrmxro;t0olt mieiltfsDrmu p;t4artoxf3tatlpDrluei s0tetrxopoy1op emivia( aruru ono1oetnioctysfs2rlu s t0trxrmo iytfatrlnvi t srxr(mpoo4op  lfvtlt)sDta( o;o0teen ociyslmDul( pn(4tleoif3oydopt aues;(0trxrxrpoy4ap nmncilt)a2rm(r no1alxnii3iyt s ul( ont4aeenmociy1lat aivsl( t2uo(m3iudopteliei s)artr(r ;u0alt mieiysfsDuan s t4 etnirctodoptr n i t0t2trirpny4optemies (  rur(m no4tetnifetlt aDuau o;() exnmr3tadfmt  neo t0srxoir3oy1omtnlnctat) 2tm(mont0aeenmoetas aDrl(vpnt4alxnioctydlpt lnvil()t2xoio no4opt micsls  rtmur no4olxo f3iadfm rlump (0 lenxfcoy1fate i il(0 rxm(m3oo1optn ieia(fsrtau o;o1tetnmi3iydlm ul(mpn(4 rtnxo ia1fa eauvs t) ruoio3iu1alte iviat aDurum nt4oet  feilt m2rm( o t0aeermo3ty1fmDelues;s trtm(o3io1lpt  nvs (fs2ur(r ;u0apxomoeild a uln o;(4aeerif3ootlat  i o s0t2urxrpoydll   ieil()a2ua(mpou4tpto i3tadlm elnvs;t)treomo iadopt ln i s) rurxrpiy4ap   fvt s) 2ta(moot0openifciatlsDelnvo u0trtnxo3tadlm eauvil(0teum(m iydomte fet t) rraxmpot1aetomoeiysfmDulnmp;()teerxo oo1lat  nvilt s2xoir oydlpenlnesa(fsDum(  nu4tlxnifeiadla2eluvsnt4 lxoir3iytfmDeai o s0trumio no1lm n nvt s)srtau onu0tpeomfeilsfm ua( on()arxomociydfateaivo;t0 rxoimpiodol nlncilt sDtm(r no0tltnmoctlslsDum(vp;u4 lxomf oodlpDraiei;(0 rtoxo nydlmtnmiet s  2tmumpot4aeenii3iaslm2umn o t0trtriocio1om rlnes;s0texr(opiodll elnvsa(f rumu  ou4tlt iocild s2ra(vs t)aexnmocta1latrlnei t  2urio3io4ol n fvtatfsDtr(m oo0olxomiciatfa2eluvp;()teerxociytoaD  u s;s)srum(m io4al  livtltf Dtmum oo4alxn o3ildls2em( p;() rtoxr3iatomtelu s s)s2tm(m no1lpt lfeta() Dum(  ;o1alt  ictytfa2el(vpnu0alxnxocoy1lmte i i t)s2trxm3iydape mncsa() rrmuront4aeenifeiysfa2rmn o;()texoir3tadom eauvsls) 2urir3no1ape  ietl(fsrrr(ro;o4tee  f3iydla uln pnu) rtoircootfm rluvil() 2umir3nudom elivslt)sDraxmpoo1tetnmo3iltfs2uan pnu) lxoxfcto1fp r nesls trur(m nu1openliei (  2ta(m ;t0ape ii3taslmDeanvp;t0trxoxf tatlmDelivs;t0 eur(o no4oltnliet t)aDurxrp;o4alen feildfm ra(mon(0alerxo io1lat  iei t)texr(opiydameelnvil( sDta(mpou1alt mociatlmDel( o (0alerxr3iodoat ln o;s srxm(r3iy1optn fei tf 2trxrpno1oee mfeildlmDelu p u0tltrmr3oadlmD lu o t0 rxrim3nu1opt  icsa(fs2umum nu4olxo ieiltlm2ua( s;t0alxnmoctodlat ln i t0 eum(o3oo4ll nlfvilt)arururono0apeo f3tlsls rln o u0teeoxf3tytlat  i s;(0 2tmir iy4oltnlnctlt)s2tmx o;o4tpe mieildlm2em( o;(4tltrxo todoaD lnvo t0sexrim oo4opt  nesltf 2tm(r no4tpxnif3tlsfm2eluvon(0tetoxo iotlptr nvs;s0 rxriopoo1ale licsasfs2um(mooo1tee mieiadfs2uluvp;t)tlxnio3todomt lu s s t2urxrpny4lp   ies ()sDtm(  ;t0apxn i3tltlsDrmuvo;u) rerircoydfpD auvols  exoir ou4ll   icia() ruaxm ;u4olxniieiydfmDulu s;u0arerircoodfmt lneslt t2uoirpny1lmtn ietl(  2tmx  ;u0texnmfciltfm2rauvonu0texoif3ootfat anes;(0 2xmxo3no4am nmneslt)s2umu  ;u1oexnmf3ildlsDumu o;u4tetrmf tytfa eaueols) 2xmxmpio4lltnlfeia(fsDrr(m nu4aptoif3tlsla rmn pnu)teerxrctadfatrlu
\ No newline at end of file
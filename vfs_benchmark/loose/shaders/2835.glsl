@@ -0,0 +1 @@
+u s ( s2urxo nydomte nesas sDra( p;u4tptn icild a rmuvp u0teermfctadlp e uvil()srtrim iodlpe  ivilt)s2umurpou4olx  ietytfa2umu o (0arxrio3tytlpDe u i;s trtoxr3iy4altemfct tfs2tm(ro;u0aetoifciysfsDrln p;u) renmfciodlpte ies t)srtoxopiy1am n iesls s2rmxrpnu1alx  ociatlsDrmnmo;(0trxrmo3iotfp rln s ( t2urxr iydal emfet (fsDum(mpoo4tlt iieiys sDrlnvo;u)treriocootfa  au sls) euoio iy1am elietls)sDtaur ot4oeeniieiyslm2rm( s;(4treomocoydfa  au ols  eurxo oy4amenmfvia( a2rm(mo;o4oet mieiad m rm(vpnt) lxnir3ia1oaDe ueo t)teumir3nydlmtnlnes sf rum(m ;o4teeo oeiaslm2elums;t) rtrmf tydfm  ai s;s)sexmim3nu4ope  ivt t) 2rru oou4tpxomo3iaslm2elnvo;t0texnxf tatlpt au i;s0 exr(r3ny1lp  mietls arraurp;o4oltn fciasfa rluvs;t4arxnxr oytfateluesl()trtm(r iudaltnmfcsl()sruau p;t4aee moeilsls2umumpnt0aetoif3io1la  ai olt0 rum(o3iodlleelivi sfarrmxro;u0tlx iiciatfa2ean o;u)aetoif iotoaDe uvo;s  etm(opnydlltelivilsfsDrmurpno0tptomoctytfm2elump () rxrmfctadoatr ieo t  2um(o oydom nlietltfaDraxmooo0aptnii3iysla2umuvp;t4tleomo todlatraieils  2xmir oy1opt licsas)sDtax pno4oetnmf3iatla2rm(mo u0 rtoxf3io1late ivs;s0sexo(m nodale lici tfsrrrxr nt0tptnioeiat a rmuvp u0tlxrmo oadlptrau ils0t2trxr3ny1lltelivtat) ruaurpot1ole  fciatfm eluvo u) reomrcoy1la ranvs s)t2xrxr ny4lltnmnvt ( a2rmxrpot4texo icias mDulu p;u0tltrirciodfp elueolt  2tmxr3nudal n fcs s aDur(moot1apen ieils m2rl(vonu0alenmf3oadop rln olt srxrxmpno4lp nlfvta(fs2urxr ;o0olxo fetytfaDulumo t)aeeomf ta1fpt aueo s)trxmxopio4op n fvias  Draurp;t4optomf3iad m2ua( s;t) lxoxr3iydlmDelneil( s2urxm3nydoptnlnctl()a2rruro;o1apx if3iysfs rmn p;(4aetnmr3oodfpteln sls)teuoio oudoltn nvsat)srrau ooo1ope mf3iydla2emumsnu0altnxo iydfatelieo t0 rtoim iu1ap elfetas arua(  ;t1apxo o3iad aDrmnvs u0 ltrxr3ta1opt auei s) etrxo ou4aleelfviat) 2urxro;t0ope ifciaslm umuvo t) exnxr oatlmteli i;(0s2xrxo oodolt  nvs ( aDur(mpou1alx io3iatfa eluvpnu)aexrxr3oydfm eau s;s s2tr(m3ou1apt  nctat sruaur nu0aleoiieildfm2ulnmo t)trtrmrcio1lat au o;s teto(r io1amt  iviat) 2tmxmpno4olxomfeiys m eauvsnt4texnxf3totlatrlieolt0trum(m oydop  mnvsasfarrru p;o0tpxomf3ilsfm2eanms ()texrxfciadopD au i;t0 2trir3oodapte ivslt a2um( ont4optomoctlt s umnms;(0altnxr to1fa  ln sl(0t2xrxm oo4omt liet (fsrua(rpou1aptomociytla2rauvs;u)tetnxf3iodlpteanvi t) 2ur(o3oodlpeelfvil()sDtru pnu1olxnmi3tydfa2uau s;() ltriocoytfaD lnvo (0 2xrir nudllee fet (  2trurpoo0apeo octasla ranmpnt0alerir3totopD aies t  rxm(rpnodom  mieslsfarraxr nu4olto oetadlaDemnmpnt4 rtnif3tydla  lnes t)t2xrxmpnu1ol  lfvils)sDraxmonu4alen o3ildfmDua(mp u0artoxf ta1op rauvo (  2xmxmpoo4lptnlnes s  Dtruroou4teeomo3iytlm2uln s;u)alenmrcoadlmteaivilt0 etrir ny4lpt mieia() 2ur(rp;u1tet  ocild sDum(mpn(0aexnxr3oatomtr ueil()teurxo nodoleemfci sfsrta( onu0aptniociys m el( s u4arxoio3oadoatraieo;s  exo(r io1olt mivslsf rtaxro;t1aet  ociltlm ranvo (4 lxoio3oadfa   u s;()sruoiopoydomtnmnetl()a2tmu p;t1ale ii3tasfmDrln pnu)trtnio3oytfpt  uvi;s0trumimpoo4lmtelnesatfsDum(m ;u0oex iietlt a2el(msnt) lxoir3tadfmteanvs;(0texmxo3ou4lltnmivsa(fsDta(monu4tltnmicilt sDel(vs u0arenmrciadfm  au s t) exrio3iy4op nmnvs t)sDta( p;u0aetn feiatfaDuauvp u)arerxf iy1lp elivi;t0 eto(o no1lp e ncslt  2trurpoo4tltoio3iys a ul( o (0 eenifcta1fmDranei;t0srtmxm3oydlleemiet () 2tm(mpnt1tex  fciltls2ra(vpnu) exrir3tydlpDr nvils trxrxopnodlmtn ivias) 2tau  oo1alx moeiat aDean p;u0altoif3oadlpDe uvi ()truo(r3iodamee neil(  rraxr oo1oltn o3iytfa emnmpn()aexomo to1om eln s (  euoxmpny1am  lnci ()s2rmxr nt4aex ifciat m umnvp;t4texrio3ty1lmt lueo;s)teuoxo nydope mfctas) Drmxmont0texnmfetydls ulnms u4artnxf3oodlm  lueo;t0 exoxr3nudamtnmncias  2tru pot1olxn fetyt s2eauvsnu0arxnmr3tydfpD aueils) 2toim ou1lpe  fcs () 2rm(mpot1tlxomfciatfm ra( o u) eerxf3iydfa  luei t0truoxm3oudll   fvtl( s2rmxm ;o4aetoifeiytfm eln ont0aeeoiocoa1fate uvslt)trxoxo3nu4omt  ncsa() 2raxrp;o1apxomi3iyt mDrln p u4 ltnxo3tydlpteluei;t t2trio3iy1apenmiet s  Drm(  ot0oex  iciysls rlnms;u4tetoif3ty1fpteai i s)seum(mpoudal nmictls a2rrum nu4tlxo i3iydfmDra( pnu4 rtoio3totlp eli o s0 etm(m io1lm elfet tf rrmxro;u0tpeo ictadfsDuan on(0aeerir3tadomDr u o;s  2tmiopiodap nmnctlt)arurxmpoo1tpto o3tys s em(mo;u) exrirciy1oat  n slt0s2toimpio4aptelivsl(f 2uau  ;o4oeeo fetadlsDra( o;(0artoxr3oo1oa   ueo;t s2umxrpny1alenlncsa()srtrxr ou0oexomoeilt mDrl(ms u4artrxo oa1lpD  nvi t)truoirpny1lm nlnei s s2raxmpot1oexnmictysla2ea( p;t) ltrio ia1fmt li o s0sexr(mpiodll e fvils)srurumpou1opeomoeilslaDuln o u0 lermr io1lpDr ivs;t)srxrim no4omen fcsa()a2rmxm ou4alen ieiysfs2eaumonu0tlxrxr oadfmDe ivo s tetmir iudamee fei ()aDuru pot0ole mictld a2eanmo u0 eeomr3iodfatraivi (0truoir3nudale lfvtlt sDur( o;u0oltnif3iltfs eln s ()tlxrxr3iadfa rli sl( trxoxrpnu1om emfetl(fa2rmuro;u0apx micild mDua( sn() exnmr iodlm r uvs s  etriopno4optnmneil()srtaxmoot1texn ociydfsDemnmo;u0arxoxrciytomDr uei (0truo(o ny4oleelnes ( a2tmxmooo4teeoiiciasls2uanmon() leoifcty1fmteli il( setm(r nodoptemivt s) ruaumpnu1tetnmi3ils s2ul(mp t0 lermo tatfmDeanvil(0 2ur(m nydomee fesas)s2um( pou0oexo f3iad aDuan o u) exoxrciatlpD au i;(0 exo(r ny4lltn nctltfarur(mpno1oexo o3iad aDumumon(4tetrxf3ia1omtrauvs;(0t2xmxrpnudaltn neils) 2ua(mono1aex ifciytfsDrmn o;t) renircoy1fmt luvs;s)t2xrxopiy1om n iesa( a2uaum ot1tpenmfctad sDeanvsn(4 eeomf3oy1lp rau s (0tetmirpiydap  lncia() Draxrpot4apxomoeiytla emu s u4tetomociadfatr ies (0trto(m3oy1ape lfetat)aDrrum ;o0olxomociytfs2rlnvs (4 rxoxf3iatfatrai o;s) rtmxm ou1ol  mivtlt s2urxrpno4alxnmi3tadfsDeanvo t0treomo3oydlpD luvo;s)t2uoxr3oy4om nmnviltfs2ta(  ot4texoio3iltlmDra(ms;u4texnxociatlmD  i o t0teuoxopiu4om emicia()arrrxmp;t1oetoioeiasfm elums;(0 eerxf3oy1om  lu ilt setr(mpno4lpe miet tf 2ua(monu0alx ioctadfmDrlnvpnu) lxrmf3tydomDran ilt sexm(opiy1ame mietltf Draumonu1oeen ociatla uau pnt) eeomr3tytop raneo;t0tetm(o iodlmt  ivil()s2tmxm ot4aexoioctlt m2ra( o;u0 lxoxr tatlm e uvols0 2xrim3ou4llt  nct tfa2rrxrpnu1texn i3iadlaDuln p u) rtrmr iatom   iei t  2uoxrpnodlmenmivt (fs2taumo;t1open o3iyslsDeanvsnu4teeomr3ty1omD au i;t)sexoirpiudolee ivslt) rur(  nt1oeeo ociadls2elu s t0 exnxf3iotopD auesl(0t2xo(o iy4op e fctatf 2tmumoou1tpto f3tydlm2uln o t4 rermr todfateaieilt)teumirpno4omenlfcil()a2rm(ro;o1tex iieiasfs rmu p;(0trerxo3ia1fmteli i;t) 2urxm no4alt mfei (farur( pnt4aexoifetas a2rmumpnt0tlermr3oatfp  anvi;t0s2xmir oy1ale  feilt aDtmu o;t1apx mf3iaslmDuau p;u) renir3ty1optrai o t)t2xoim3nudop e fesat srrrxm ot1olt mfeiad sDrmu snu) rtnmf io1oateau s;(0 2xrxopiy4altnmnvsasfa2tm(m no4tetoifciytfm uau o (0aexrxfciy1om  aueilt0s2tm(o nydll  lfctas s2uru p;t1aleomfeiltfs elnms;()tlenirctodlptrlnes (0 rxoio3iu4omen net () 2umxroou4altn oetatfm ulu sn() rtnmr iytlpteauvilt)trumirpnudol nlfvilt  2tmu onu1tleoifeiyt s ran o;(4 rtnmo oy1optr neo;s)s2uoxm oo1am nlivsl() 2ur( oot1altnmoeild aDul( o (0altrxociydlpD auvo;( setoxm oo4olen fcil() Drm(m ot1ape mo3iadla2rm( o (4trxrxociytomDr ieolt)t2uoxo oudlpenmfctas arua(r nt0aex  o3iysls ranmp;t)alermociadlaDrln s s) rumimpny4opt mietl(fs2tr(r ;t0tltnioeiltfsDua(vo;t0 rtrxo tydlp  aies;t)s2uoimpnydam emicil(fsrrau ooo0oeto fetlsfa2uan p;(4alxoir3ootfmDraivs;s trtoirpoydlltn fci t  rrrx  nt1tetnii3tltfs uauvs;(4teeoxf3iydlpt aues t) etr(m3nu1ome mici sfsrtaxro;t4opeomi3tlsls2umuvonu0tetnxo3ootfat an i;( s2xrxopoo1llee fviat srurur nu4opx  iciadfmDul(mon(4artrio tytlptr iei;(0teuoxopou4lptn neta(fsDrmu onu1teeomi3iys s2rmu o t0 etnif tatla   uvi t)t2xm(m oydap nmnesat aDtmx  oo1opxnmfeiydla2ea( pnu0texrxo3oadomDeanvslt t2xmxr oudaltemfvsls  rtmxronu4tet  iciys a elnvp t)areoxr oa1opt auvo t  exmxmpny1lmtnlnetlsfa2rr(rpou0tpen ocildfsDemuvpnu) lxoiocty1lpDelnvo s)trurxrpnodaltn nvs t) rra(m no4tpto fetaslmDulnvo t4 etnifctydlmDeanvols t2toir3iu1aptelfeias  2um( ono1tlt io3tys m ua(vs u0tetnxociy1lp ranvi;s) eur(mpoydlmt mncs tf 2taur ;o4aex mi3iysfmDrlnvs;(4 lxoxf3ootop elivi;() 2tmir oo4ol elicils) 2trxr nt4opxn iciltfa uanmo;(4tlxrifcoy1fm rlu ol(0teuoio ny1al nmncslsfs2uaxro;o1aetomfctadlm2uauvpnt0altomo iatlmDeli s;t) 2trxm oydolt mnetat)arrmx  ou0tlenii3iysfm2eln p;t0altoif3oo1oa e nvs s)seurimpoy4om  mfeslt s2trxm ;o4opeoio3iasls eln snt)texoxf iatfatr nvo t)trtrxo oydaltemfetat  2rmu  ;o4texo f3tat a2ra( o;t)arxomr ia1la elnvi;t)srtmirpnu1lm  mfvia()aDtrx pou4tltomiciadls rauvs u0aeenmr3io1omt  uei;s)s2urim3oo1aleemfei s)srtm(r oo1oex mociyt s rmnvo ()altomo3to1lmDeaueo s) 2toxrpiodaltelivslt) rtrx p;u1apxo ieiydfaDea(mp;t0aexnif oydfp ran ols)tetmim io4opt  ict s a2tr(moou4alt  o3tyslm ulu onu)arenxo oa1om eau olt t2uoxmpiudaptnlnvtl(  Duru pnu4oet ioetysls rmnms (4tltnxf3ia1faD  n s;t)sruoxopoodalt  fvsltfaDrrxro;t4optnmo3iltfmDrmuvo (0tetrxf oatfatr ivo s t2toxm nudamtn fet s artaurpno4aee  oetlsfa uln o;t4 rtrioctydfmD  ivol(0 ruoxopiy4am nlivsat  Drrxm nu1apxnifcildls2ulnvp u4aeerir oa1om e uvslt s2uo(rpno4ape mici sfaDtr( pnu1oee ifeildfs2um(mo () ltrif oo1fmtr ivs;s0t2toxopoy1ape  fvslt)s2uaxrpou1olen oeiad m2emu pnu4texrxo3oodopD livsls s2um(o3nu1ap  liviltfs2trx poo4oleomf3iasfa emnmsnu)aeenmrcoatfmte ieslt0seuo(o ny1am   nes tfs2ra(rp;t1olenif3iys s ra(mpnu0 rxrxo tadopDeanvs;( t2toxopnydlle mivt t  rumuronu4oee  octad m2uaums;t4 rxrmr tadfmDelnvs ()seurxm3iy4opee ieils arum(rp;o1oeen o3ildlm eln pn(0 lenxf3io1lp eai o s0 rurirpio4omee fes sfs2tr(m nt1tpeniictydlsDeauvs;u)alxnmo3iatoatr uvo;s0 etm(r ou1ape lietas)a2rmumo;u0tlto o3tysfaDel(ms;u4tetrif3oydfm rlivo t0srtrir3iy4op n ivsat)a2tm(rp;t4tpxnifciysfsDea(mo;t0texoirciotlmDeln il() 2xm(o3oudalenmici ()sruaxroou0aptnioetatlm rlumo;t0treoxrcio1lmtrlivo;s  2to(o ny1op  mfet ( s2uaxmpot1olt miciasfmDelnvo u0arxrircto1fp r n i;() 2tmxopoodolenmnvsat  2tr(  no1aexnio3tadla2ea(vont0trenxr oo1fpDe uei;t0t2trim nu1lpt mfctasfsrtax pou0teto ociydfm2ean pnt0tleoxo oatlptrlivols s2tm(o nudapt lfcta( s2raumpot4alxnii3iltlm ul( s;t)tltnmfcty1laDe uvols)srtoxo3iy1al  micsl()aDrrxmpno0texomi3iyslm2ea( o t)altomf io1fmte nei s s2uoxr io1olenmfeta(f Drmx o;u1tlxnifciadfa eauvo;t) etoxf iydlmtrli i;s trtrimpny4lmt mncsls)aDrau ont1oet mf3iadlaDemuvs;t4 exrmr3oadfmDeai s t0setmxm3ny1amtnmneta(f rrm(  nt0tltniicildfm el( o u0 reomo iatlmD  uvs;(0srxo(rpnu1al  liet tfs2rrurpoo4olt  iciadla rln o;()arxnir3tatlmD  neo s0 rtmxo3ou4lp  mfei t arurx p;u4oexo icild mDel( sn() rtnxrctydfaDe nvo t t2xmir3oy4lptnlfctls) 2tmxro;o0opt mfciadfa emump (4 ltnir to1la r i i t) exrxo ny4am emivi ( a2rru pnu0opeo oeiys a2ul(vp u0aeenxo3iadlptran s;t0srxrxopny1aleemicilt a2rm(rp;t1aeenmf3iat a rm(mpn(4trxrmf iydlaDeauvi ()teur(r nu4lmen fct t aDrr(  ot4opxoiieiydls2ranmo;t) exrir3iadfm e uvo;s0 exr(m nodoltnmfcs tfsDtrxr no0tlxo oeiysfmDumnvs u0tltrir tydlat an ols) rxm(o3iy4olt mfvtl(f 2raxro;o0teto icildfmDul(mpnu0 rxoxr3iy1lmDeanei;(0 exo(r ny1llt  ieias) 2umur no0oex  fctatla el(msnt)trtrmr oodlp  lieo;( truoim nu1lmeemfetat srrmu p;t0ape io3ilsla2rmuvp;t) lxoio oadoat li i s trxmxopio1am nmfvi s)sDrrumo;u1tlxn ieilslaDrmuvs t0 leriociadoaDran s;( seumxo iy1al emiei ()aDta(rpnu4ope moeilslm2rlnvsn()artnxr todop eai o;t)texmxm oo1aptelics t)artmurpoo1aeen oeild s2rl(mo;u0 renmo ootomt  ieo;s0 eumxo oo1lp   ics tf 2umxmoot4aee micildfs2raumpnt4 lermocoytlm  luvi s0t2xrxo3oy1ome mivilsf Draurpno0alxomf3iadlaDum(vo (4 exrif3oatlatrlu i (  exoir3oo4lme  fctls) rrr( ooo0alto oetlsfa eauvsn(4trtoir oo1fpDelueil()srtoxr io1op emnvslt srururpnu4tle mf3ilsls el(msn()trxomr ta1fm  aieo ()trxr(m oodole lncsat s2uaumoou1optomfcild s uanms;(0 exoxo3iydlmDelu s s)s2ur(m nydlltelnci t aDrrurpou0teeo feiad mDem(mon()aleomf tytoa  au i;(0t2umir3iu1lpe mfet ( s2uaum ou4tpe ifeils a2el( onu)artrmf oy1fmD auvs (  rur(m3oydomtelicsat) 2tmxroot0alto fctatfm2eanvpn(0trenxfcto1oa   ieols0texm(r oodamt  iesat)srrmx pot1apt  f3tasfs elnms;() ltnxrciatopDrlnes;( t2urxm ou1apenlnei tfaDurxrooo1aex  f3ilsfm rmnvpnt4 eeoxf3iodlmDeai i s0 ruoir io4omeelfvt sfaDrm( oot4altn f3iysla rmnvs;()altrmrcoa1om r ueo;(  rum(r nodameeliei tf rrau ont4opt  iciasls emuvo;u)aetrifctytoptrlues s)srxrxrpoodllenlnvt t srrax ooo0olto ociysla2ulu on()trxrmr3oatlaDeauvs s  rxrxo3iu1am emfctl(  rrm( ono0tpt mf3tldfsDrl(mo (4trtoxr3oy1fpD livsl()trtmxm3iy1llen ict (f 2umum no0optnif3ilslaDem( p ()trxnif3oatoaDeai ol(0seuo(r3iu1lmtn fctls) 2uau o;u0ole ioctad mDuauvp;t)trenir3ootomDelivi;t0t2xriopoo4al nmivi (fsrum(ro;t0olxomictadfaDemu o u0 ltnxfcoa1op r nvs;t0srtrimpio4llt mfeiat)sDua(  oo0olxnmi3ildlm raumont)tlxrxf oadom raivi;t0srxmxr3oy1ol   nci ()a2rm(m ou0oetomo3tasfa2rmuvo u) lxriociydfmDelues s0s2um(m oy1am  mfeias)arrrxmp;o1tpe mf3iadfa2emu s;u4tlenxo3oadfmte uvi ()texo(mpoodale mnciatfsruaxrp;o1apenmocias a em(mon(0altrmfcoy1la e neo;()t2toxrpiodapen fvsltfaDtaum ;t1opxnif3tas aDemu pnt)teerxf io1fa   u sl()trxoxrpio4ll  mfesl()srumu  ;u4tpen ieiydfmDuauvp u0 lxoxf todlat  uei;t)t2ur(opoudlpt  ivs s)sDtrxmp;o0apenii3iad mDelums;t0aetoio ty1lm e nvs;s0t2tr(m nudoptn netls s2tmu pot1oeeniietlsla rl(monu)aetoif oodfmt lneslt0 exr(r3iudll nlivsl(  rtru pou4ape  f3tltlm ra( o t0aexrif3tatoa e nvils0 2tmio3oy1ope mfcilt a2urxmpou1tleoiieiadlmDemnvsnu4tetniociytfm e ues;s srxrxmpiudomeemfesl( srrmxmp;u4tpto oeilsfm eanmpn(0trermfctatfm rau slt)seumxm3ny1lm   nes (  2tr(m ;o0tpenifcildfa2ra(vo;()treoxo oytomDr nvi t) rxmiopou1ol emivia()srtaxr ;u0olenmf3tldfaDrm(mp;t0aeermfcia1om ran s ( srxr(o3iy4lp nlfci t a2urxmp;o4optn o3iytlmDra(mont4alenmrciadfatrli ilt0trxmiopnudam   nvsas) Drruro;u4oleo feiadla2ulnvon(4aleoxrctadlaD lu il()s2um(m no1lm  micsl(fa2rrxrpou0tlen fcias mDem(vsnu)tlerif3oydlpDe iei t srumirpoo4om elieta(fa2ur(  nu0alx  f3iydfaDel( s t0texoxr ia1fat  nei;s0 2tmxopoudlmtn nvta(fs2uru p;o1oeeomociytfsDuan pnu0texoxf iodlpDelivs t)sruoim3ou1lm  lncilsfaDraxmoot0aleomo3iltlsDrmnvo t0trxoxr oy1lmD lnes;t0 2xrxo3io1lp n fcs s)aDtmxmpot0tex  oeiys sDrlnmp u)arxoio3oa1fmt lneo;s0 2uoxr io1lp  livtltfaDrrumono4tlenio3iasla ul(monu4tlxnxrcoatfptelu ilt) 2xoim iodlm e nvs t)sDtm( p;t4tpen fetaslsDrl(ms () ltnmo io1opDrai o t)teumxr3nu1omtnlnetlt  rurxrono4tlxo iciyd m emnvsnt0tlxoxo tadfmD luvil(  euo(rpoudomtn net t s2uaxrooo4tle io3iadfa2ea( snt0arenmo oo1lmDr uvi;s  rurir3oydamtemnci s sDuaxro;o1olto fetld aDea(vo u0texrmrciadfa e u s t sexmio nu4al  mfcsl( a2tr(m ;u4tlenmfetydfmDrlumpnt4trenif iodom eanei;(0 etmim oo1al  lici (  Drrumono0apx moctatls2rl( snu0alxoxo3tatlm  lnei t t2tmxopnydamtemfvias  rraxront0opeo ictltfmDumuvs () eeoircoatfmDrluvs;t)s2ur(mpnodlp nlicil(fs2raum nt1texnmfeiatls2em(vs;t)tlxrifcoodfm eli il(0 2xm(r3ny4lpen neiltfa2ra( ont1olenmicilt sDelu o u0 rtomocoatlptrauvs;(  exmxr nydlpeemfvias arrru oou1tet  fciytfmDem(monu)teerif3oa1oaDeanes;s  exoxr io4apenmnvta(  2ua(ro;t1aexnio3tyslmDuanmo;u)aexnxrcoatfptrluvsl(0s2umiopoydoltelnes t sDrr(ro;u4aeenii3tadla eluvs;t)treomf3iatoa e ues ()t2xrxo3oy1amenmivils s2uau o;u4tlxnifetld a2emuvp;t4aetomr to1faDeaieol(0sexrxrpiu4lp  lneil( aDrrxro;t1teeoifeiatlmDeluvs;(0trtrxf ta1fmD  neo s0trxo(rpnydaptnmivt sf 2ta(m nt1tetnmf3iasls ea(vs;t)teeoxrcootfa   ies ()t2urxm iodamee nes sfs2taxrono4tpx mi3ildfsDrm(mont4aexnxr3tatlaDran s ( t2toxo3oy1ope mnetl( sDrmu p;o1tpx mfeiyslmDrln pn(4teerxrctodlaDrauvs t srumxo ou1ll  lfvi s sDur(m ou0apx  oeild m ulu o (0aeeoirctydlp e i il( sexmxm3iu4olt  ivsat  rrax  ;u0ale mo3ild aDelump;t0tlenxf3oatomDr nei;( tetm(m iodoltelnvsatfsDta(mpou4tet ioeilslmDrau s;u)tlermr oodopD  u sl(0s2trirpiy4lm e feta() rurx oou1alenmicild mDuaums;()texnir3ia1fmD ai o t0srxrxr oo1op  lnvilsf Dur(mp;o1ale ifctysfmDrmnvp t) etomo to1lmDeaneslt0 2to(o oydlm   fctas sDrmumo;o0apxomoctas a eluvonu) exomoctatlaDranvs;s  exmir oo4lpen iet sfartm(rpou4apeo fciadfmDea(mp u4 etrxr3tydfp   n ol()s2tmiopny1opeemnvs s)aDtax  ;t0tex  o3iad m ul( p;u4treoxo3to1faDeau i t0t2uoxrpnudoleemfes s) Dum( p;o1olt mf3ilt s2uau p t)alerxo3ia1faDe n s s)truo(o ny1alenmncs s  rrrxront1tptoiictatlm rluvpnu) ltoio3tatlp  anvs;( t2uoirpiy4ope  feiatf 2trxroot1opto octltls2ulu sn(4 rerif3tydlp e ueil(  
\ No newline at end of file
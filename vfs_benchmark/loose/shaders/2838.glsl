@@ -0,0 +1 @@
+ies;() etmir3oodlpe lnct sf Durxm no4apxnif3iltla2emn ont0aetrxo iydlmDeaieils0t2xmim oodome lfcta(f rrrurp;o1oeto fctasfm elnvs u4aexrmo oa1laDrlies;t0trxo(m nydom   ici tfa2tm(ro;t4oeeomieiytfaDra( s;u4tlxomr oa1fmt ln i;()seumio nydamtelivsat arurx pou4aeen iciydfs2uanmo u4 rerxocoo1fmt ln o;s0 2xo(mpny1altnmnvsl(  Durum oo1aeeo o3ildfs eanmo () rtnxr3io1faDr ivs t  2xmxopoydlltnlncsat arumx oou4tet ifciadfm rmnmpnt0tetrir3ia1op eaivslt0trxrxr iodomeemncsltfsDrm(mpnu4altoifcild mDulnvp u0arerxr to1fp rauvo s) 2uo(o oydol emfviatfsrrr(rpnt1tlxn oetad a2rlnvs;t0aeeomf oytopDr ies;s0truo(m3oo1oltemnvia( s2taum no1alx mfetatls2elumsn()aetnmrcia1fpt ai ol( s2xm(r nu1lle mnci tfs2ur(ro;u0tee mf3iad s emnvs;()aexoxfcoydlm e ivs;()t2uoim ny1lptn ivsl(f Dumxmooo4tpxo fciasfsDelnms u0tlxoif3todfa rli ils  rxr(o iydalt  ietlt  Dur(r nu4opx mi3tldlm uan p u4 renmf oo1lptrln ols)teum(m nu1lmt mfesat)aDrruront4tlxomfctydfs2rl(vpnt0 leoif oytlat aueo s srtrxrpiu4llen nctas s2rmuro;u1opeoio3tas a um(mo (4tleomf iydfmDeaivils)trur(r3iu1ome  ivil(f Drmu p;u4opxoioetydfsDranmo;u)tltnxr tydomD liei (  rtm(mpny4lmtelnvt (f Dumxmono4alx  ocild sDrl( s;u4aeenmo iy1opDe nvs;( srtoxr nodalenmicilt sruax pou4tpt mf3ias s2rmnvs;u0tlxnmociotom eaivolt0seuoxm3oy4am  mfcsas  2umxr ;u0oetnii3tydfa eanvo;u4texnxo iytlptrln i;t)s2toio3iu4altemnvs ()aDtr(m ;t4ale ifctyt aDea(vo;u0tlenxf3oadfm r nvi;t0teto(opny1lltn ncsltfa2tm(moot4tltomi3tyslm2ra(mo;()tlerir iodom e u ols)t2uoxo3iy4omtnmfcsl( sDum( p;o1aee ii3iltfaDean snt4 etnmr tadlatr ueo s)sexo(m3no4lm n ict t aDuaxr ot4alx  ieiyt s umu s t0tltnioctytlmt lues;t0setoiopoydomeelnct t srtmump;o1tpt  o3tatfmDranvo;()teenxf3oa1lpDelues ( seuoxo ny4ap nmncs tf 2tr( p;o0opt  fcild m2rm(vo (0tetrxf iotlmtrlu o (  2xmirpiu1olt  iet s sDtm(r ;t0opxn oeiytfa eanmp (0tetnifcoodfmte n ols)seum(mpoodlmtnlivtat  rtaxmo;o4tlt iieilt m uln o u0 eenmo3oodfate ueo;t)srumxopno4omtelnvtas  Dtm(moou0olxomfctlsfa2ul(vpnu0teenmocootomtean o;(  2tm(o3no1ole mnvia(f Dum( oot1tlenifetatls2ua( o;t4treriocia1lp  auvs;s srxmiopno1omeemfvta( srta( ono1aetoioeilt s ul(mpn(0altnmf iadfatelivi ( sexrim3nu1ol  licsasfsDtmumpnt1apxomiciat a2uanmonu0aetrir3todfpDeaneol(0t2xrim oo1llen ici sf 2umxm ;o4apt miciat aDumump (0altnxo tadoptrau i (0 rtoxo nydllenmnviasfsrumumonu0oex  iciatfs ean s;()trenifcootopDe ivo;( t2uo(r3io1lpteliesatfaDuaxm ;u4oetn ocilslsDumumo t) rtrmf3iytom rauvo;s0 rur(o3oudolt mncsat) rtm(r ;u4apxomoeiadfa2umnvo;t4 ltomr oytoat  uvols)t2xm(r oodlmenlnvsl(f Dtmxmpno4aet  i3ild a2eaump;t0tleoifcta1lp eaieo ()s2uoio3oudap n nesl() 2ua( pnu1aet ifetldfs2elnmpnt0artrifciytlp  lnvo;t srumio oydomee nctlsf Dtrxmoot4opxo feildfsDumu on(0aleoif to1fmDr neo t0srumxr no4lpt mfeil(fartmxrp;u0olx mf3iydfs uanmpnu0teeoif3oadfm e neo t0srxo(r ny4ame micia()s2tmumpou4tleoii3tasfs ua( p;(0 etrxr3iotla rlnei t trxoxo3ny4amtnmiviat arrrurpoo4tpxomfctasla ulumon(0aleriocio1om rluvi;( teumxo3iy4ll  mfcsl()s2trum ot4tex mieiydlaDumnmp;(0teeriocoy1laDrauvol( t2tm(r3no4apeelnci s)srrr(r ;u4tlen octlsls umump u) rtnmoctotfa elueols0s2tm(mpoydlmtn fci t  2rmx pnu0opeoio3iadfs2uluvs t0trerio3oy1lmt  ueols)texrxo ou4lmtnlict sfaDtrumpno4opxn iciyt m uan o;()aeeoifctotla rlnvo;s) exmio3ny1apte ictls  rtr( pnu0altn fcilsfa2rl( o t)trxnifcta1fmDraivol(  2xmxr oydamtn nesa(fsDtmxmo;t0tlxo fciatfmDeanmp;()texomrcoadfm eanei;s0trtoxrpio4ame mfeiltfsrua( o;t1tle mf3iltls2elumo t4 ltrxrcoo1omt lueils0trur(m3oudam nlnvt t srtaxm ;t4oeen iciyt a umnvo;u)arenmo iatfmDelneo;()trtrio no1lp nmivt s) Drmu  ;t1optomociad a ra( snu0teenmfcoadfm e u i ( s2trir oy4omeelivsat sDraurooo0tlt ioeild m2rlnvp;(4tltrif3io1lpte uvi (0trto(o3io1apte nesltfarta( pot4tpt moeilslaDemu s (4teeoxo3ta1fmD  nvils s2urir nu4ll n nvsl(  Drm(  ou0tlt  f3iytla ul( on(4aeerio tydoaDeaivol(0teumxo no1om   nvs s  Dtrur ot0opxnifeils a ulu o;u4alxoircoodlpDr ies s  2uoxopoo4am nlfesls) 2rm(mpot0tee mo3iatfa rauvs;t)tlxomf tadopDrlu sls0 rtmio3no1ol  lncsls)srtmu p;t1tleo oetls mDeluvpn(4aeenmo3iatomDr uei;s0trumir3oodap eliet tfartr(moou4tet mfeiadlsDrlnvs u4 eeoxf3oa1fmteaueols) exo(mpoodopenmivs s  2ur(m ou1oexnmietyslm ea(msnt0 eenmr ia1fmD anvs s) ruoxo3oudaptn icilt  Dtr(  nt4apxoiiciadlmDumump (4altoxr iydopte ivi s trum(m3iy1omte ncs t  Dua(mooo4texnii3ils m raumo;() rermo iadfmDean i ()s2toim3iy4olenmfvs sfaDtruronu0oexn ieiatfa2rauvpn(0arxrxr3iytoateluei () 2urxopiodalt  nctat)arumx ooo4tpe mfeiasfa rl( p;(0trermrcoydoateli s (  rxmxmpnu4am e fvsls s2trur ot0oeeoio3tasla2uluvo t) reoif iydfatr ues;s0truoxrpiy1am   nvi t sDumxrp;u1teeoif3iysla2um(mp;u0 leoiocoy1fat  nei;s srxoirpnu4llte nvils)aDrrxr nu0apt moetys s2uaump (0tetnxf ty1oa   ivo (0srum(m3iy4ope  fvtasf Draumonu0tleniietldla2rmn p;u) eeoir3iytfpD lues;t0sruoio3ny1omtemnvilt srurxro;t0tltoii3tlt a2uau p;t4aexnxo3ia1lm rauvs s  rur(o nydlltelfeil()arurx pot1aeen fctatlaDemnvs u4tlenxr3oy1opD ai ols) 2xmirpnu1ale  fvsat)sDrau  ;o4tlx if3tat s umu s u0 renxf3iytfa elnvo (0srtrxm3ou1lpenmivi t) 2uaxm oo0opeo ictat a2umnvs t0aetrmo oytomD ln ilt tetrimpnudalte fcslsfsrur(rpnu0tpxnif3tlsla umn pnu4tlerio3iatopDe neo;s0trxoiopoudopte feiltfaDra(rono4opto oetlt sDulu p;(4arxnmrciy1fm elivs;() 2xoxrpiy1apt  ici s arta(mp;t4alxn i3iad a2uau s;u) lenxfctotomte nvilt trtoim3iu1ll   ici () 2umu pnt0aeto i3iad a ranvp (0 rxrircoadomD aneolt srumio3oo4lltnlivta(f 2ua(mo;t0altoio3tldfaDelnvp ()tleomrcoytopDeln o;()s2xrxo oydlmtelfcs (farurxrooo1olxoiietlt aDulnms (0tleomocty1fpDr u o;t0tetrim3io4optn ncsl() Dum(  ;o1ale ifeiad sDem( p u4tetrmrcio1oatrlnes;()texo(o nudlmt mfei (  rumu pot1tee mfciyslsDrmn p;u0 leoxocio1fp eliei t srurxo no1open fcia(  rrr(ront4teeomi3tys a2elump u0 eeoiocio1faDr ueo ()truoirpio4aleelfct ()a2umur ot4oleo ictys m ean s u) lerxr3iodfptr nvo;s0 2tmirpno1lmt mnctl() 2rmxmpot0aet  ieiltfmDel(vonu0aeermoctadlatrli o t)teur(mpnydomen fcia(f rum(  ou0texnmo3ild m2em(vpnt4teeomo tydop rauvsl( t2xoim3io4amtelfcsl()aDurumpot0apt  f3iatlaDrluvsn() ltnifciodomt liei;s0 2uo(m ny1omee fctlt  rua( o;o0tetomfetaslaDuan o t0trtnmo3iadla rauei;s0srum(opou4ole  ici ()a2taur nu4apx mo3iad mDeanvsnt0 rerir3tatlp e neo t)sexo(o oudal elivi s  2ra(mpou4aetn fciatfm emu s u)altrmr3iy1latelies t s2xr(o3iu4ll emnvt ( s2ta(r nu4texnio3tld s uanvo t)tlxnmfctodoat livs;s)seuo(m oy1lmt mfes s) 2umurpot1oexomfciysla2uln sn(4tetnxociy1la  lieolt0sexo(o iy1amenlfes () 2ua( o;o1tlen i3iasla emuvp;t4trxrxf totlmtr ues ()sexoim3io4al elnvtas  Drm(m ;o0aeeniieiys a eauvp;u4trerxr3tadfmD  n slt) ruoiopny1olee feta(  2trxm no1tpxnio3ild a rlu o ()alxnmocoo1fa eanvi t0s2tr(o io1al nlivi s a2uaxm ou1oexniietlsfa emu o ()aexnirctadlmDelu sl(0seto(r3nudalenmnvsasf Drr(rp;o1aeeomf3iyt m eanvo;u4 renmr3oodlpt  n ilt) exrxr3no1optn icta( s2tm(  ;t1olx iictlt sDrlnvont)artrmf3iatopte uesl()texmxmpno4lme micta() 2ta(  ou1alen ieiytfm2umnmo;t0aeenir tytlp raues t)srtmir oy4lm n nvils srtrumooo1aptn o3iytfaDum(vs (0 etomo iydlptrliesl() rum(m oo1op  mieslt)arraxrpno0tle  ieiadlmDuln p;(4 eenmo oatoa raneo t trxr(rpiudal  lfetatfsDrr(root1opxoioetytla uauvo t0 exnxocoo1fmt anes t  rtrxm3io1aleemictl()s2urur ;u1aetoio3ilsls2em( o;t4tetoxr to1omDe neol(0srxmio3oy4amtemnvta()s2tmx pnt0opxo fetyd m2rlnmo;u)teerir3ia1opDe nvi s  rumxrpno4llte fvsltf 2ua( poo1oeeo ictls aDeau o;t0teenxr to1oat lnesls)srxrir3ny1llt lfeiat  ruauront4tlen fciysfm2elnvp;t4treoxrciatfmDeluvs;s)s2trxrpnu1llte fes tfsrrrx oot1ole  o3ilt m emnvs () eeomfciadfm   n ils trum(o io4ame  ies sf 2urx  ;u0tex mo3ild s2uan on(0trxoir3iotoa rluvs;s)s2urxm io4omt  ivtls)sDta(root0texn iciadfaDel( o;u)aetomo3io1fp  auei;() 2xo(o3iodoptn icslt)artau  ;o4ole ii3iadlm rmn snt4tetnmr3tydomtrlueo s tetm(o oo4omtn fct t) Duaxrp;t0olt  oeiyt m rau snu4artomrcoo1lp rlnvi;s  exoim iydomtn fcils)sDtaxmonu4olto ocilsla2ean pnu) lerxf3tytla elueilt0sexrxmpoydlm e fvil()s2raxro;t0ale  feiad s em(vp;t)tlxnxr3oydomDrlues ()trxoxr oydapt mncil()aDtrxro;t0ole moeiad a uluvont)aleoir iodfateli i t) etoxm3iy1lme mfcs ()srumxmpou4oetnmi3tysfs2uanmo;t)trtoio to1fm  auvo;s t2umim3io1al  mfctl(fs2trxr oo1tlxomo3iydls rmnvo u) lxnmo3ta1oat  uvo s texoirpno1omt miei ()srraum oo0tleoifeiyt a rmums;(4aexrircoytopDrlnei s sexmxm io1aleelfcsa( a2urx o;u1oex mfetytls ranvp;(0 leomf3oadopDrlieil( teumxmpiy4ap  lnvi (faDrr(m no4tetnmieiadla2uln s;u) lerxr3totla eaivsl( srurirpnu1lltelfvta( arumxront4tltomo3tysls2emn p t0aleoir oydop rlu s ( trum(o3io4omenlfvi t)a2rrx  ;u1ope mocils m2rln o u) rtoxo ta1opD ln i;s)s2urir3iydllte neils sDtmxro;o0tee  icilsls rmuvs;(0arxnmfcty1optelnei;t0 rumir3iu1omtn fcs sfaDrruro;u1ale ifetyt m2uan o u4 reoxfctatfpt ai i;s  rtm(r nodop  lfct (fs2rmxm ot1opx mieiytlm emnmsnu0tetnxrcty1fpDran i t0t2xo(r no4omenlnvils) 2uax oou0oex mo3ilt aDranvp t) reoiocoodomD lueo s truoir no1apeemfvi ( srta(monu4alxniieilsls uauvo;(0altoxo tydlm e nesl( trxriopoudamt  icil(fartaur oo4apenmi3iydls umu p;(0 rxnmoctodfmtr ivs ()sexo(o iy4ame micta(fa2rrurono4tlenmi3tld a uanmpn(0 exoxfciydfp   iesls0 exrir3ny4am elfct (fsrrm(m no0olt iictlsfa ulu o;t0 eeoxo3oodfmt lieo s)trxoiopiydlmenmictl()s2taum ou4texnifciadla ea(vp (4artnxf3ty1fa r i s (0 eto(o3nudal emfes t) 2rrxmoou4opxo feiytfmDrmuvs (0aeenif3oy1fmt anvi ()trxoim3nu1ll  mneta(faruaxm ;u1olxnmicilsfs2eaump;t4 rtnmo ty1lmD  ivs;(  2tm(m ou1op elnesatfaDta(ro;u0aleoiiciltfmDeanms;t4trtrir ty1fmtr u ols)s2xmir3oo4apt  fetlt  2umxrpno1alenmociadfs rlu s;u)tlerxocia1lptelu i s0trxmir io4al  mnctls)aDtrum ou0oex ioetyt s2ranmpnt0 ltrmo oydfpD luvi t0 etoxm3no1al   iviltf rrmxr oo0oltn f3iyd m2em(vonu4 ltoir oadlpDrauvslt) euo(rpnodapenmfvs () 2tr(  nu4alt mfctltfs2rmumon() rerxrciy1lpteau slt)srxm(opnu4lmenlivtas srumxrono0aexo f3tlsfa emnvsnt4alenxr oydom   ieo;()s2trio nudop  mfvilsf 2trurp;u4oetnii3iytlaDrau o;(0aleoxf3oytlatrluvo t0 eto(r iy1omtn icsls srumxr oo4oeenmoeiadla rmn p;u) rxoifctadfmt lnei;t  rxrxmpnu4lpe mfesl(faDtaxmono0ape if3tadfaDuaumo;(0 renmrciytoa  lu sl(0srum(mpnu1lptn fvs tf 2rau pou0aet mi3tyd aDrmu s u4treoxo3totfmDrlues s)srtoio iy4ll   ics sfa2ur(mp;u0tlt iociltfsDumump;u4tlxoxo3iy1omtrln i () 2xo(o3iodlpte ncsl( aDrrxm ;o4apeo oeiydfa2raumo;u4artrmr ia1fa elivi s0seurirpnudlptnlncil(f rur(root4aetomociatfaDum( s (4 lxrifctatfm   ivi;s)seurxopny1llt  iesltfarua(r nt1olt mociad a uluvs u0 exrxo io1opDrli s ()t2um(r nydlle mfct s aDtru o;o0tlxnmi3taslaDua(vp (0 lxnxo3ia1fp r ivolt) etr(opoy4oltnmfcsat a2tr( oou1tltnmfciadfm2ua( pnt4 lxoir oadfmtrlu o ( s2tr(m3oudll  lfvtls a2rmump;t1aleoioetad s em(mpn()trxoif iy1optran i s teto(mpiydop nmfet t)arta(ronu4apeo o3tyt aDemuvs u4artnmo ia1op rluvo;( s2ur(o3iy4am nmicil() rtmurp;o1tptnmf3tyt mDelnvpnu)aeeoio3tatfatrli s t  2trir3oo1lpt lfvtlt artaurpnu4olxniietadls2em(monu0tlenmf3iydoaDeaieo s) rxr(r3nu4altemfes () Dtaurpoo1olxnifcias m2el(mp;u0artnmf todop ean i (0setoir3oydllee icsas)a2ta(  ou4aeeoioctatfm2ua(vp;t) lxoxfctotfa  lueol()seumimpny1om  mici tfs2rr( ont1ole  oetlt sDrm(vpn()teeoxf3todoa eli i t s2xmio iy4lmeemnet (f 2urxmp;u1optnmf3ilsla ea(mpn(0texoir3iatfm ran ilt) rxo(opio4apt mfeslsfa2rm(m ;u4apx iieildfs ra( s;t0trerxr3ta1op raivsl(0s2trir io4omtelnes ()a2uaurpnt4alenmi3iadfs2em( o;(4altrxf3tatomDrauvi t srxrxm nu1llt  iesl(fs2umumont0tpenifetadfs2rm(vo (4tetriocootfptran i;s0texoxo3oy1amtnlnes sfaDuau p;u1tetnmietatfa2eaumpn(0arxoxr tatomtelneo;s t2tm(rpiydame mictat)sDtm(monu4olen i3tldla rmu p u0teenxrciydlatr nvi;t  ruo(m oudapenlivi t) Dtaxmpou0teenif3iyslm2ra( s;t) rerir3tatoaDeaieo ()texo(r3nu4al  lieils sDtrum ot0oeeomf3ilt a2ul(vont)artrxo oytfatelnvil(0s2xm(rpoy1lm e ivtlt) 2ur(monu1aexn octytla2raums;u)texoir3tadom  lies t) exm(o ou4lp  lfvi sf 2urumoot0oltnmieiltfm2rau pnu0aleomf3io1opt auvilt)seumio nu4alt mncta( aruaxm nt0tpeoifeiltfsDrlumo;u4texoxr3io1la e ueo;s) 2trio3iydlleelnvtl()a2umur ;o0oexn f3ils a2emu p;(4artnmr iatfm raneol( srurio3oy4lltnlfesl(f Dtmum ot1tpt  o3iad mDum(mp t4 reomo3ootlat  u ols)s2to(mpnydop elnvtl( sDuaum ;o1tetoiieiatlaDem( s;t0 rerxocoa1laDrlieo ( srtoxr3iu1lmen iesas)s2rm(r oo1texo ietatlm2ua(mp u0 rtnmo ia1fm e ieo;t) 2ur(mpnydam elneilt)srraxm ot0oleniietadfs2emump u) exnmociydfp  lneo;t)s2xrxr io1lptnlnvsa()artmx  ;u0altnii3iatfsDrl(mo t)tlxrio tatfp r ueols0 2tmxrpno4ll  lfesa(  2tmxm ;u4alxoii3tltla2eaumo;t4 rxnir3ta1op  li o;t) rurxm no4open nesl(fa2ur(m nu4tlxomoeiys s elnvont)treoifctydfmD  ivols srtm(o3ou1ap  lneiasfartr(moot4oee if3iyslmDel(mpnu0arxoxo oy1lmD lnvi;()t2umxo io4alee ncias s2taxmp;t4texnmociasfmDuanmon(4tlenirciydoaD  n ilt  rurir io4ale  fes t)a2ta(  nt0texo o3ild mDemn p t0 etnif3oatopDrli s () etm(m nudlm n fes ()sDuax  ot0tptnioetat aDrauvs u4aexomociatlptr ivi;t0s2umir3oy4lmen nvtl(farra(rono1tpe ifctaslmDua(mp;u0 rtrio3todfmDeanvs t) 2toim oudalt lictls)aDrm(mo;o1tpxnmf3iad sDra( pnt)tetomo iodoaDelueo ()sexmirpoo1lp nlncia(  rtmxr nt0tpx  octltfa emuvpn()tlxoxfctydla e nvo;() 2xmio3ou1oleemnct sfaDrm(r nu0teeo o3iad m2um(mp t4 etnxf oy1fmtr uvslt)seuoxo3nodamtnlnvsl() rrm( poo4olt  f3iatlm2ulnvpnu0aeenmrcoo1fm eaieil()trxrxm iu1olt mneil() rur(m oo4altn f3ildla2um(mo;u)aexomf3oadlpt ln sls  exrxo ou1lltnmieiat sDuax pnu4openmfeildla ua(vo;t)tlerxf oadfaDeai s;(  2xo(opoudame mieia(fs2ua( ont4oee  ociaslm uauvsnt0arerxrctodlpt li i t  2xoxm3oy1alt mfvsat aDrmx  nu0optn fcilt m2eau pn(4texoio3iydom e u i;t)s2xrim3io1ll elfes s)s2rru  no0aexo i3iysfaDeanvpnu)arerio3ta1fatrlnvi () eurir3iy4am nmnei tf 2rau  nu0tlen iciltfsDuluvp;t4teeoir3iadom raivils teumio io4ol elivs sfaruauro;o0aex  fciysfmDrm(mo;t) etoxr iy1opt  ies t)sruoimpoodlmt mfvslt  Dtrxm ;t0optoifciyslm2um(vp;u0alerxrctadlm eaieol( sexmiopoydaleeliet t  Dtaum ;t4tpxnifeiasfm rauvp t0 exnio to1fmDr nvilt)teuoiopnudomtnlieiatfaDrruroot4altniiciyd mDrauvs t0 leoxo3todlp e n s;t teuoiopny1am   fcilsfsruaurono4teenmiciydla rauvs u0trenxf ta1fa elieil(0s2xrxr3no4ome mnes tf Drmuronu1aex mociadfm2ea( pn(4alermr ootom rlnes s0 etoio3oy1om elfvt () rur(rpnu4ole  i3iydla2ulnmo;t) etrifciatfatr uvo s  exm(m3iy4apenlfetlt) Dururpot0tpto oeildls2eaump (4artrmocoa1lm  lnvi s  euoxm oo1am  mncsat arum(  ;t1tleomociad m rau o;() lermo3oadlpt lneol() 2xoio oy1lpte fvsat  2urum nt0tle ifeiltls uan onu0 renxf3iadfpDrlnes ()t2urxm3iydapt mfei t)a2uau ono4tlen f3ild s emuvp t4teenxociydfmDraueo;(0srtoio iudap n nvilsfa2umu oou1aetoiictasla rlnvs;t0aeenif3tytlp  aueo;t  2xmimpoudamt  nviatf 2tr(mpnu4oltomf3iltlaDumnmpnu0arerxfciatom   i ilt  2trirpio4ol  lneta() rur(r ot0tpen fetyd a2rmu pn(4alxoioctydfaDe i s;(0t2tmir3nu4omen fcsls) rra(m ou0tetomf3iysfm elu p;u0 etrmfctotoa elnvilt)teuo(m3iy4am nmnvs t s2ta(ro;t0apt ii3iyslsDuau snt0areomf3todop elieo;( trurxm3no4ap n fetas sDtrxmo;u4oex iietlt a emnmp t4 rtrir tatfp  aies s  exmim3iodop n nvil( aDtruront4oexoiocildlm2rl(ms;(0trxnio3todlat  n o t0 exm(m3oydap e fvilt) Dra(mp;o4aptnifciasla2eauvpn(0 lxnxocootoptraivs t0srxmxopoodllt lici tfaDuaur ;o0ale mfctadfaDem(vo;()arermo3iodopDe nvo () rtrim3oodlpte fvilt  2tmu  no4opeo iciyt a eau s;u4 lxnxf to1fa eaivils)t2xo(o nu4altnlnvi tfartmx pot4texnmoetasla2rmums;t0 eermocia1omtrlivs s srxm(opiodlpenmietatfsDumxroot4tlxnifeiys a2eau p () etnmf3tydlp r i o (0trur(opiodapen ies (f 2umu  ou4ope mf3iad s ua( o u)tetnio oodlm e ivo;t t2urirpny1omee nvt s)arrrx poo0altoif3iltfm rauvo;(4trenxrctatlmte ivi;t0 etmiopiu4alt  ivtl(fsDra( ono1tpe mfeiytls2el( p;t4aeeomo totfpt aieo;s0trtoxm nydome mies t  Dtm(ront1tltnifeilsfa2um(vpn(4artrmrcoy1fmDe u s;(0 2xo(o3ou4lpen ncsls arraum ;u0apenmf3ildfs rmumpnt4tlxnxoctydfate ieo;()sexmxr3oy1lpeemfct t) 2rmu oou0alxnmf3iyt s uan p;t)aeerxrcio1opt ai il()seuoim io4op n icsas sDurum ;o0optomo3iadls ulumo;(4tltrmo oadopte nvi t)s2xrxr3no4ol e fet (f rurxr oo0oleoioeilt aDeauvo (4trtrir oa1fmtr ueilt)t2ur(rpou4ol  lnvtat) Dumumont4alt  ietydlm2ulump;() renmo3todomDrai ilt  eumiopny1ap   nesa() 2rm(rpoo1apt mf3tydfm umnvs t0 rtnio io1omtr ivols) 2tm(r oudomeelnct s)aruaumpnu1ole  oeils s rl( o t0aeeoxo3oa1fmtean s;s0 exr(rpoo4op n fet () rrm(ro;o1olxniietyd mDrmn pn()altoxrcoodfmtran s t0setm(o nodomeelncilt)s2rr(roou1tle  fetat m ra(mon(4trtoio3oytfm r ieo t tetoxrpnydap e nvi tfa2tmu pno0aeto ociysfa ranmo u)tlxriocia1lmteluvol()srxm(o3iy1lp n fcsls)arumu  nu0tpt iieiasfsDrm( on(0aexnir oadfmDe n s ()trumir3nu4apte ietasf 2rru  nu0oetn ieiatfsDrl(vsn()texrxrciytopDrau o;s teuoim ou4op   fcil(fa2ta(rpno4ope mo3iasfaDrlnvonu)treoio3iytfa elieo t t2xoxmpoydom  mieslt) Duaur no0tpx iietysfs2ulums () leoir oytlate nvs;t teurxmpoo1amtn fci (faDtm(rp;o1opxomoeiys aDum(ms u4arerxo3ta1lpt anvo (0 exrxm ou4ale  feias)srtmx ono1opeoifciadfs2ran o t0 rtrifcia1fmt  i o;t trxr(o io4am n nct t a2trumpou4ole moeiydlsDrlums;t)aetoxocoo1opDr neols t2toxr iydolee ncia()sDtru pot1tpenmf3iyd a2emnvpnu0 rxrxr iadfpDrln i s t2umxrpou1ll n ivsasf 2rau pot4tet mietldfa2ua(vo;u) rtrxr3iy1latelueol(0truoxo3io1omenlicil( aDtru ont4ope ioeiydfsDuauvs (4artnxrciodfa  luei t0t2urimpio1ap e nvt t)sDuau  oo1tpx  fctasfaDemuvs;(0arenmf3oy1opt  n sls  rxoiopio4lptnlnvtlt  2tmu o;t0oet  i3tld m um(mo u)artnxf3tatlm eai o;s)t2xmir3nudopen fvi ( srrr(  nu1aexnifeiadfaDrm(mo u)tlxnmo3oadlmt luei (0srto(opnodlltn fvt t)sDur( o;o1apenio3tytfs ra(vp;u0aeenif3iotlm   neslt sexmir oo1apenmnci ( a2ur(rp;t4opeo o3iyslaDemnvp;u0artoxfcoatlp raieo (0 2trir3iydlp elnci t  2ra( poo1openmieiyslaDem( ont0artnxrctytlmDe ivsl( texoxo nydop nmncil(faDtaxroot4tpt io3iydfm ra(mo (0texnmrciy1fm rai s () ruo(o3nu1oltn fcsltf Duru oot0apt mf3tydla2rauvpnt)tltoxf3oy1oatelnei t s2to(mpnodoltemietls)arrr(rpnu1alen ociatlaDrmuvont4aetoircto1opDean slt srtrimpou1al e neilt sDtr(m nt4optnmi3iadlaDrlu sn(0 eenmo iadfaDrli i;t0 rtoir3oydol n fct tf rtmxm ;o1altomocilslm umumpnt0trxoxr oytlpDeau s ( srtoio3oo1ap emfvsl(  rumum ou1ale ii3iysfs2uln p;()aetnio ia1opt  nei;s srtoxopnu1ol nmics ( arrrx pnt1tleo ieiad mDel(vs;()aetrif oo1fatrlnvil( srxoimpno1opeemnvil( s2tr(r no0tpe iicilt m2ra(vsnu0 eeriociadfptraieil()texoir no4om nlfcs (  rra(rpno0apto i3iatla rm(mp;(4 lxoifctydfateli o s0srxrxm3oodamtemneilsf 2rr(mo;t4oleo ieiltfm2em(vsn() ltnmr3oydopte u o (0trxoxm io4amt  ieil( aDtm(  nu1tetn i3ild s rmnvpnt0alenmocto1lm elu i;()s2xr(mpnodlmeelnes t)sDtaurpnt1olt io3tyt s2um( p;u)areomoctydlpDe uei s trxrxo ny1ol emfvsa(f rra(  ou0oet  oeiasfa rauvsnu0tetnmocootlmD  u sls0t2xm(opiudll nmfvsa()s2um( p;t1open oetlslaDemnmsn(4arerxf3oo1lm elieil()s2xoxm3nodom n fvs s)arraxront1opxoif3tltlaDeluvpn(0aeeoif io1fateaies (0s2trxm iy1alenmfeia(f Dtaxronu1aptnmoetydlm2emnmp (0trtriociodlaDrlnei;(  etrxo3oo4lmtnlicil(  2rm(  ot1aleomfeiytlmDuluvon() lerircia1opDranvo (  exrimpiodopt mictl(fs2rmxr ;u1olenifeiyt s2uan o ()tlxomf3oydomD luvo;s0srtm(o iy4lpee neias a2uaurpot4ape moeiysfs2eanms;t)aexnxfcoodop r nvo;t) eur(o no4om  licsatfa2taumoou4teenif3ild s uln o (0 lxomr iadfa r ues;s truo(rpno4optemnvtl()sDtmur nu4optoiietltfm emn p u0trtrmo3oydlate nei;()tetmxr nudlm nlnci s) rraur ;u1oeeomfctatfm2rlnvp;t) reomo3iadfm e u s s) etr(r no4optelfetl()srurxmp;t1aexomo3tat aDrmu s;u0tetnxoctadfaDrauei t0 eto(m3oy4lmtnlfeias) rurum ;u1olxoio3iydfaDran o u)arxrif3iadfptrlieolt) 2tmxmpoo1lltnmfci (  Duru pou4olxoifeiysfm2ra(vp;u)arenir3oy1fptrlnvsl(0 2xmiopiodlm nlnes ( artr(ronu4aptnmietat a eanvp u) ltnir3oydlpDe ivsls s2tm(m iydaltnmfei t  rtaumooo1apxn i3iaslmDuaumpnu0aexoif tydopt aueo;t t2xrxr io4altelnei (fa2raxrpot4tlxo ociyd a uaumsn(4trerif3iadop  lnvil( trtmir oydomtelieias  Dumumpnt4apt mfctld s2eaumo () reoxr oytfa   uei;(0srum(r3iy1lmtn nei tfs2ra(rp;t0tlt  ictldla2emnmpnt0altrmf iydop  lnvo;t trxrirpiydll e nvtlt  Duaur ou1tleniictls a ea(vo;t0trxrircio1fa rli ol() rurir3nydap nmnvsls) Durx pno1ale ioeiasfs2rm( p;t0 lxrxf3iytlpD ai o;s) etrxrpnydomtemnvsa( aDum(monu1alto ietatlm2rlnvs u0 exnmo iodom eau ols) exoio3ny1al n ictl(f Dum(moot1tltoiietldlsDeau pn() eeoifcoatop r iei s) rto(mpny1oltelfcia()arrr(rp;o0alenif3ilt s rln snt0trtrxo io1oa r uvolt trxoxm3iy1ole  netl(fa2rru p;u0tpx iictatlm2um( pn()aetnmociydop rluvo;( trumir3ou1lmtemieias sDtmx p;u0aptnmiciadfa rlump;(0 renio3oadfp e iei t0trxoxmpoo1lp nmivi t a2rru ont1tlx miciatfm2eanvo;t4trenmrciodlp  li il( s2urxm3oudal  mici t  2rmxmp;u1alt mfeiltla2rl(ms u)aexoxr iadlpteauvo (0t2tm(opno4apt mies t aDtrxm ou1oeenmoeiysfs2ul(vs;u4teeomocoodoatrlnes t  rtrxm3iu4opte net s sDrr(rpno0tlxnmoeilt aDuanvsnt0teerxfcio1lpDe n s t0s2urxmpou4lp e ivtat)srtaxmpou0oetoiietatls2rlu p u)altoxr3oo1lmtr ues ()trxo(m nydlmeemnes ()arur(rpnu4tptoioctlt aDemuvont4 exrio oy1op eanvi;s0trurxm iy4ll   fes (  Draxmoot1teenmf3tasls rlnmo t4aeeoxf io1faDranvslt t2xoxrpiy1lmtelivil()sDum(rp;u1aptnioctydfs2um(von(0trxoifcty1fpDrau olt texoxm3nodolen icsl(  Dta(r nu4opxomfciad s um(vo t0aexomf oa1fmt  ueo s0seumxo3ny4om emivslt sDtaurpoo1tlxo fetlsls eln p;t0artnxfctadlptr nvslt  etmir3no1om  mnvia( a2uax  ;u0tlto f3iyt sDrlu sn(0altnmr3to1lpD  nvi ( teuoxrpiu4ap elivia() Dtmx  oo1tetn o3iysfm ul(mp;u4aexomr3tydoat auvi ( trtoxopiy1al emncsat aDtmxr nu1alxomocilslaDel(vo t0artoifcia1oa  lnei;t tetrxo3io4oltelivtl(f rrr(mp;o1tleomoetlsls ra( o t0aexoio3iytfm e ues;s0s2xmxo oodll   fvtlt) Duau oot0aptoiieiydls2eln s (0teeoirciy1faDe neo t0t2ur(mpiu4amt livt tfsDrrx  ot4tpeomo3iysfaDum(mp (4altrxf ia1omDe nei;s0 rxrxm nu1lle  fvsa(faDraur nu4oee iieiyt m2ranmp;t4alerxf tadomtran s s  rtrxo3io1al elfeiatfaDur(mp;t4tpxomieiys a umums (4texnmf oy1lpD auesl( t2xrio3ou1lle mfvs () Dtaum nt4optnmicilslaDulu p;u0tlermfcoy1laD lnvs;t)t2toxmpiydom   icslt  rrrur nu4alenif3tatlsDuanvp;u0treriocio1lpDr u slt0trxr(m3nu1aptemfvs s a2trumo;t1apen fetytfa ea( p;(4alerxr tydfat luvs;t) 2xmxrpnu1omtn nctltfs2trxmpoo1oeto ociadlaDran on()tlerircoadop elivsl( t2tm(r3ny1ap emict t  Drm(mpot4tet  ietlt s2ua(mp;(4teerxf3oadlpD au s;()t2urxmpou1lm   nvt t) Duaxrpnu4tlx ifciydla2rlnvo;u0 rxoxf tytfaDrauvo t trto(mpoy1lptn fcil()aDrrur ;t4teeo feiadlm2elnvo;t)trxnxo oo1lpD lueolt0 2xm(m oo4ap   feiasfsDur(  ;t0oet mfciytlsDulnvsn(4tlenio tatlmtrlues;() rxo(rpnu4lmtemfvs ()s2rru pou4oexo f3tasfa emnmo;t0texoxo3oytla eluvi t) rxr(m oy1openmiciat)sruau  no4tltoif3iytlaDumnmpn() eenxr to1fa rln s t) 2xrir oodoptnlfeil()s2rrumo;u0teenmiciytla2elums t)arenxrcty1laDe iei s srtrxmpiodlp e fvsatfsDtrurooo4aetomo3tys sDran sn(0 rtomrctadfpDeaies ()texriopny4ol e fes sf 2trxmpou4tpeoii3taslm2rmu o ()teeoio3oy1omtranvi t) rtm(r3oy1ole lnvtls)s2uaxrpnu4tlx  o3tatfaDrl( onu0 etrxrciodlpt lneo s) eurxr oo1aptnlnci (f Dtr(r nt1ale iiciysfm2uaumpnu4aeeoir3oydfmtranvols)sexriopou4ap  mivs (fs2urx p;t0ope io3iadla2eauvsn(4altoio tydopDeau s ()srxr(o nu1omee fvsls artrxmo;t4aeeoiocild sDemums (4 rxomr iydfmDr ivilt)trxo(m3iy4al nmnvi s arurum oo0tpx mfeildfsDraump;() lxrxoctotlpt lneols0tetrimpiu1oltnlfct t) rum(mpou4tpt mfeiytls eluvs;u)trxrircio1fmtraivi;()t2ur(rpny1amtnmivslt  Drmxmo;o0tlxomfciatlm uanvpnu)aetoxo ootfpDrlnvo s) exoxopnodlpe  ivta(fsDrrumonu0aex  f3tadfaDrauvpnu) ltnmo3oatfaDeln i s) ruoir3nu4optnmicilt  2ur(moot4alx mfeiat mDel(ms (4arxomr iodlatr u i;(  rtr(m iodolenlnvsat)arrr(m ou0tleo oeiadfm2uau p;t4tlenxrcto1lpDrlies;( teuo(rpiu4llt lfetls)a2uax  ou1alt  oeilsls rm( s;()texoxrcia1om   ieils0t2tr(opno4lm e nci (  2uaxrooo1tpt mo3tad aDuluvp u0altrioctadfptraies t s2toim oodamt mfvias)aDtax onu1aeto i3iatla2ea( s;(4trtnxociatlm  auvi;t0srtr(opiudamt  icsls aDur(mo;u4aexomieiytfm2emn p t4tlerio3tydlat aivs (0 euoxo3ou1ll   iesasf 2rru p;u1optoiieiyd a rlu pnu0 etoir oa1faDelueil( setmxo3nudlpe mietl()sDtm( pnt4aeeomo3tys aDea(von(4tltrif tytoptraues s  etrxr3iu1lp nmnct sfarrmxm ;o4apxo o3tadfm uanmsn(0tetnmf3ta1fmt  nvi;s0trtrxrpiu1lp e nvi sfa2rmu pou0aee mociasfsDrl( on() lxomf3totoatrluvs s0trxr(opiydamt  nvtlt)s2um(rpno0altniociat s elnmo;u0teeoxrciodom eaiei;s  2urxmpoy1lp e nci s) 2raxronu4tex moctlslsDuau p u) exnxf3tytfm eliesls)trxmir io1lleemict t  Durumono1tlxnmfeiasfaDrmuvsnu) rxoif to1fmD li ol(  eum(r3nudamee netl( aDua(m oo4oeenmoeiytlsDul(vont0aeenmf3io1fptraieol(  eumxrpiudom elfcias aDrru ont4olt  f3taslm rauvo;u4alxrifcia1lpt lnesl()srxm(m nudaptnlfcia(  2tmxr ou1oleo octat m um(vsnu)alxnircoo1lm   ivo;t0 2tm(r3oudalt mnvs tf 2ta(mpnt0aptnio3tlt a2rmnmsnt) lerircoytfmD  ivols  rtm(m iodom  mict (fs2rru  ;u4tlt  octytlsDua( pnu)arxnir3iadoatr nvi ( t2toxr3oydol nmivtas artmx p;u1aleomictadfs2elu s u0 rtnio io1oatean ils seto(r3oudol  mfvsltfs2ua(mp;t4apen oetldls uln s;(0tltomfctatfat lies;t s2toio3oo1alte icia(fsDururo;u0olx  f3iytfm el(vsnu)artoxr3oo1la  lnvs s0 2tmxopnydom  livtat  2rmxrp;u1olx iietydla2eauvo u0texrmr tytopt auvs s) rxmio3no1alt mivslsf rum(  ot4aee iociltfaDul( sn(0 eenxocootoa eanvsl( t2xr(o iodomtemncil( arurxr no4apx ioetadfa2eanmon() etnio3iadfp rliei;( srumir nudoltn nvsa() Dtmxmoot0aee  o3tlslmDrm( s;(4tltoxrcoy1lmtr uvo;s)t2xrxr iy4opeemiesas) 2uru onu0aeenmfetytfaDul(mo;t0 rtrio tadlp r nvil( truo(opoo4ome lics (faDur(r no4oee ioetat sDrmuvs;t4texrxo3oydomDran i;t0teumxm3nodlm   fvsls srur(mpou0tltnmi3tytla ea( on(0 rxrxr oodlmt  i ils s2tm(rpiu4lmenlfeta( srum(  no1ape if3tls m2el(mp (4altnmo3iadlaDr nvol(0 2xrimpoy4alt mfcsat) Drr( pno4ape  ieild a emu pnu0tleoio3iytop   i ilt)teum(opno1lmtnlnvtl(f rtmxroot0tpxnmo3tadls2ea(mo;(0 rtrxr3iodlp e uvs;t)trxmxm nu4oltemics tf 2uru o;t4aet mociltfa2elu sn()aetnmrctytlmt aivo t)trtrxrpoy4ameelfei s  2taum no4tlenif3ilt sDumums t4arxomrcta1fm rluvi;t0setmimpoodap elnes t a2uaxmpoo0opto iciadlsDrmuvpn(4 leomoctatla r u il(0texriopiodlptnmict ()aDtr( pnu4aptoiociyt sDem(msnu0 rerxf oytlmD lnvs;t  euoxr3oy4am  lnetltfarrm(r nu1apxoio3iyt s2rl(vo t0 reoifctydfmD  ieo t0t2tmxopoy4olt mfvsl(fartau  oo1texoii3tyd a2umnmpnt0tetnifcootlaDr ueol() exo(m iudlme mivi s artm(r ot0aexnmieiytlm rm(vsn() lenif3oydlm   ivs s) 2xmim io4ll emfcs s srtmxm no4altomf3ild a emn pnu)altnmfctadopD aies t) etoimpio4ll   fcs ()sDtrumo;o0aptoioeiyslsDumumpnt)aeermfctadla e iei;s)teuo(m3no1al  mfctas  Durxm no4teenmf3iysls2ua( o (4 rxrxr oatfm r ueil(0texrir iy4lle livtat  2tmx o;o0aeeomoetlsls2ua(mp;()altrmf totla rlnvo;s t2xr(o3iy1llen fesatfaDrmuront0tpenmf3tadfsDuan o u0 eerxr3oo1lateau i;(0 2xrxopou1ap emfvsa(fs2rm(rpot0tpeo oeiysfaDeaumpnu0aleomr totlpteai ilt)trxo(o no4lmte fvtas aDur(  oo0tpxoifetlt s2elnmpn()arxrmo3tytfp  luesl(0t2xr(mpoy4lm   nvsat sDtr(r no1aet if3iydlmDeluvsnt4 eerio ty1opD  nvo t0 2urir oudap  lfcslt artm(m ot0tlxomf3tls m2ra(vp t4trxoir3iotfm ranvils t2uo(m iu1ll nmneia() Drr(r ot1tex mictldfmDrlnms;u0arxnxo3todopDe iei;() euo(o no1lm  mnciat)a2uax o;o4apeo feiadlm2rlnmsnu4aetrmf io1om  lueol()srxm(rpnu1lmt  fvt ( srtr(mo;u1olx  iciad a2rmuvp;t)aeerio io1fa   uvs s0texrir3ou1lmen ict t) Dra(ront1tpxnmiciltfm el(mo;(4trtoxr3ta1opte ivs;s0 2xo(r3iy4lptelnes ( artaum ot0apeo oeilsfa2ra( s;(0aexnioctotfa r u i t)t2xrim3iudapeelicsa(  Dtrxro;o1tee ifciydlsDemuvo;()teenmr tytlpD aivo t) eto(m3oudamtemnetlsfa2trx p;u1aptn ociad sDeanvs;u) rxrmf ty1lp   ieo s t2to(opiydomeemnvtls aDum(rp;u4olxoio3tysla2emn s;(4aexnif oodlp elivs t) ruoxo3iydop nlivsl(fsDraur no1olenifctytla el( onu)tltrir oo1fateluvols  euo(o nodapt lfvs () rrmum ;t4teenmi3tydla elumo;t)areomo3oo1fmDr n o s0seuo(r iy1alt livtlt)srrrxr nu0oexo ociltfa elnvs u4alermrciotfp   n i t srum(r oy4am e ivs t s2rrxmp;t4opeo icilt m uluvo;u0texnmf3to1lpDrlies;s)texoxmpoo1ale lfcs sfsDrru ono0apt mi3iydlsDrmnmsnt)alxoif ia1oat livi;t0 etm(m nudaltemfvsl( sruaxmooo1ape mo3ils sDua(mp u)altoir3iodoatrlnvs;s0 rtrim io1llenlneta(fsrrr(mono0oetn oetlsls elu p (4tltnxoctodlat aieo;s0t2umxo3ny4ap  mfcia(  2tm(  ;u1tex  o3iysfs emnmp;t4alerxo oa1optrlivols0srto(rpoudole lfctlt  Dra(mo;u1oexn oeilsla rl(mp;u)trtnir tydom rauvs;()setmiopio4ap emnes (fsrtax o;t0olenmfeiltlm2rmn pn(4 exnio3ty1oa  lueol() etmir nu1amtemfvtlt)srta(m ot4texn o3tas mDeaums t)tlxnxr3to1oateaneo;t0s2xmxrpoy1lp emieslsfarrmxmo;o4altnmfctld s rl(vo;u4tltoio iodoate nes ()srtr(o nu4al elici t)artaumooo0altoioeiydfa2eanvpnt4alermr tadlaD ln sl(  2uo(r3nu4amenmfcsasfs2umxmoou0apx iieiat a ul(vs t0aexrircta1lmte i o t0 rtr(m3ou1apenlietlt)a2rr(m ;t0aptn o3tydla2em(vs (0arenif iodfmDeln s;s0 exrxmpio1olte ivs ( s2tau o;u1aptnmo3iatfsDul( o (4 rxrxf3ta1faD liesls0sexrxm3iu1lp e nctlt  rta(mpnu1tpt ioctysfm rmnmsnu0tleoio3tatlatrlu ol()t2xo(m3nydale  ict t)s2um(m oo4tleomieildla elnvo;t0 exnxr ootlat luvi s srumio oy4amte iei tfsDuaxmp;u4olx moeiyd a2ua(mpnu) eenxo3tytoa elues s0 rxoxrpno4lpt  nci (f 2rrxroot0alxo feiasls2umu s;(4 ltoircia1fptranes;(0s2xo(m3oodlptn fcslt a2rr( p;u4tpx micias m2em(mont0teerxo3to1latrli s;t seuriopio1oltnmncs (f 2urx poo1alxo feiytfs umnms;t) rtrxrctodfmt auvs t) ruoirpoudamtnlncs (fartaump;u4olenmf3iadfaDelnmo;u0texoif3ta1fpteaivi;(0srxrxo3oodlle  nvtls  rtm( pnu4olxnmo3iytfa um(ms;(0aetrxo3io1laD  ies;s0t2toxmpnodll emfcs (fa2tmxm ;t1opxo ieiltlm rln p u0teerir oytfm eli o ()s2trxo ny4lm   fvtatf 2rrxrp;o0tlx  ociysfaDrlu sn(0 rxnirciy1fmt ln sl(0srurxrpoy1lleemfciltfaDum( o;u1opeomiciatfm eanvp;t0arxoif3oy1faD  uvi ()seur(mpio1op nlnetls arraxmonu1ale  ocias s rm(vs;(4 eermr3oatlatr n i t)sexoio oydol e fvsltf 2uax  ou4oeenioetltla2rmu snu0trxnxf3ia1oaDranvi;t)t2uoxm3ny1lleemivi (f Durx p;t0tle mi3iytfaDrl(vont0altoif oydom  anei;s)srumxo3iu1ll n ivsas  rur(m no0optomfctys mDeln o;u0trerxo3totlpt li slt  2toxo3oo4lptnmict ( aDumxr no4olxomo3ias m elnmsn(4 exnxrctadop   ivi;()truo(mpoy4olenmfct sfa2rmu  ou1alt mieiadls2emu o u0aleoif3oatfptelu i;( t2tm(opnodamtnmnvi sfarum(mp;o0openmf3iydls umu p t) rtoif tytopD lu olt)srumimpny4lltnmfcsas)srrr(moou0opt mf3tld m2rlnmonu4texnmr3iytlmtrauei;t)trurxr iu1am nmnvt ()sDtaxrpnt0aetomfeiyslsDrl(vp (0aetoio iydfmt lu i;(0trtr(m3nydlpe mivilt  rtr(m ;u1aeenioctld m2eauvo t)tetnmr3iytoaDeln o ()trxrim iy1ol e ivs s)sDtmumpoo1ape mi3tys s rm(mo;u) eermrcootopDe u s;(0t2trxmpoy1olt mnetl() Drmxmooo4oexn ieildfs2um( o;(0aeeoir totlaDr u ils0teumio nodlp e fetlt) rumu p;u4oeenmf3tydls emu s;t0tltomrctodfat auvo;()srtmxrpiy1lpe mivsl(fsrrmu  no0teenmoetyslsDuan pnt0 exomfciadlpDeaueil( srtrxm ou4lp e fesat  rtax oou0aee ii3iyslaDranvo u4altnmfcootoaDelieol(0 rtm(rpiu1open icsls aruaxro;u0tleomoeiytfaDumn o (4trenmoctatlmt  n s s) 2xr(o3oy4ap  mncta()sDrrx oou0olto o3iltlaDuln pnt) rtoxr to1op   n i;t0s2xo(r ou1ale lneilt  rrmxm nu0tpx ioeils s2um(mp;u)tlermf3oydomDrlu sls trumio nydlm nmfvs t)a2trxr nt0aleoio3iasfs rl(ms;(4 rtnioctadfmD  n o;s0srtoiopoo4olee neslt  rumx  ;t0tle ifcild aDra( s;t)aexomoctodfmteauvolt)seur(rpou1lm  mfvs ( artr(m ;o0olto f3ilsfa2rlnvs;u4tlxrxr io1faDrau slt) 2uo(o no4am n ivias srtrxm nu4tptn o3tatlaDra(ms u)tlenif3oo1oatr ivolt0 rumxrpoo4oltemneiatfsrtmum ;o1oeto ociydls2emnvo;(4trermf3oytlpDeliei s0 etmirpiu1aptemfesltf rua(r nu4aee  f3tldfaDuanvs (4trermo3oytfpte ies;t)tetoxmpny4apte fviat)aDur(root1apeoifeiys sDrlums u0 ltrxr3iotoaDr i ols setmxm iudamen nvt () rrrxm oo4tpto feiysfa2ulumo t4 rxrmo3oatlm e ivo (0trxm(r3ny1ape mnvtat  rrrxmono0oleomf3tad s2rm(msnt4aexnxo3oy1om  liei;s)texoir oo4aptelnviat arrmum ou1oeeomfctyt a eanvpnu0tetoxf3todfptr neilt s2umxopiu1lpe lfviasfsDrr(r nt4olxnioeild sDra( o;(0 eenmocoy1lateai ils t2umio ou1op   fvsltf rumumpou0opxo ocildfm umu o () rxrmr oadlmDrlu ilt) 2xm(r3io4olt  ncilt  rumu pno1apen iciyd m2rmu o;t)alxomr iotomt  iesl(0texrxr3io4lp   ivtltf rtr(m ;t1tlt iicilslm em(mo (0aeerxo3iytopDeln i;s) exoxmpoo1am e nvtat  Dur( ont4ole  ietlslaDemnmsnt4 rtoxrcta1om   ivol()trxmxrpou4llte ictlt srtrx poo4tlenmietat aDul( p;u4trtoxo ia1omD anvi;s  exoxr3oydlpenlncta(farrrur ;o1tle iictat mDumnvon(0tltomf3totfaDrauvslt0 eum(opiydopenlieil(f 2trx o;o1altoiiciatlm ua( o u)arerxo tydop eauvs t) 2tmir3iy1aptnmieslt aDuaur ot0optoioctys aDrmnvsn(4 exrmo oa1fateanvi s0 eto(m3oodlpt mfcia( aDraumo;t0oet ifciad sDua(vs t)arenircoo1omteanvs s)t2to(opou1al e ivsasfarrax o;o1olt miciydfs2uaumo ()tlxnifctytfaDelneo;t) rto(opiu1lltnliviltf rrr( o;u1tltnmo3iatla ua( sn() lxnxociotlmt ai s;(0 2xo(mpoo1ole mivsa() Drm(r ;u4ape  fciltfm ea(vo;u)teenmrciy1laDr n s;s0srxrimpno4op e fesat) 2ururono4aeto feiltfsDumnmo (4alxnio oa1fat  uvs ( sruoimpnudlptemfvs t srurur no4oltoifeilsfmDul( s (4trtnmr3io1fmD ln o s)teuoxr3ny4altelfvil( aDtrurpno0tlt ifeiltfm ra(vp u) rtomr oa1lmt  ivil() 2tmiopoy1opeemivt t)s2tr(rpot0texomfcilt s rauvsn(4 ltnmo iy1fmteaivs;t) ruoirpoo1llt lfeilsfarum(rpnt1apxo o3ils sDum( o (4altoir io1opDeln olt)texoxrpoo4lme micil()sDra( p;t4olxnii3iydlmDeau s (0alxnmf3tatom e u s (0teurir nu4amtemncslt  rtrumo;t1opxoio3ild m ranvs;(0alxrxr oo1lmt  i s ()s2ur(o3io4ameemfct s a2rrumono0tpeniieiltfm rmnmo;u0treoircty1lp rauvs;(0t2xm(opiy4lmtelfvilsf 2rrxmo;t1tet miciadlmDel( s;t) rxrif tytomDranvo s) exo(o3no1lpe mnvs s  ruau  ot0teeo o3tyt aDrmu sn(4 rtrio tydfpt lneo t0truoxrpiodllenmfctl( a2umum nu0opt moctasfa2rmn snt0trtomr3ty1oaDraneols)t2tmiopoo1llee feias)sruru oou4aleoifeildfa umn s t0artrmrciytlatrlueo;(0srum(o nodlme mici (faDrax o;t0olt io3iyd aDrl(msnu0 rxomo oy1lat lies (0sruo(rpny1ome lictlt artruro;u0tlxo ietatfa2rln p u) lxrmo oytoatrau i ()teumxrpnu4amtn fctlt sDtm( onu0oex  ietltls2ea(mp;u) rtrifctadfmDrlnvsl(  euoxo3iu4oltnmncsa()aDrax pot4aeeoiociytls rluvsn(0artnmf3iatoptrlivi;s0 eur(opno4lpe  nei () Drrxrono1aetn fciasls ranvs t) etnif3oa1oa e nes;s) exr(m3oo1aleelnes t s2rmu p;o1tptoif3tys s emnvo;t) ltoif3tadla  auvs s)t2tmxopiodamt lfvt t)a2uau onu1olenmi3iat a2eanmp;u0altrmo iatomt  nes (0 exmir oy1opeelivs ( srtr( pnt4tptn i3iyd s2rauvp (4arxnmo iydomDr uvolt0sruo(rpio1lmte fciltfarrrur ou0olxnmi3iatls2ulnmsnu) ltoirctytfatr uei;( trur(o3oo1lm  lfcias) Drmu  nu1oeeomfeiytfsDrluvpnu) leoif3to1fmDr n o ( s2xo(rpno1lm n fct ()s2trxmo;o1opx  i3iytfa ua(mont4texoio3oy1op eluvo s) rxrirpnudale mneiltf 2tau  ot4texn f3iydfa uan o (4tlxrir ta1fm r u o;(0 rtoxmpio1lmtn fvtlsfaDuru oot0oetoifciysls eau s;t0tlxriociydlp  ai s;s0texoxo oo4omenmnvs ()srrrx  nt1tee  icilt m rmu o;u4aexomo iydlmtraiei s0texoio3no4omtelnctat aDtau ono0oeenmieiytfmDrmums ()aexnif3ty1lm  lu i s0trxoir3io4al   iet s aDrm(mpnu4ale if3iadfa2uln p () rxoxf3ta1opDe iesl(0 exo(m3io4lm nlnviltfarra(  ou4tpxomieils m2umnvs;t)alenxrctydlm  lu ol()s2uoxr3ny4altelnet s)sDumxm ;u1oltn f3tldfa em( o u) rtnmf tytlatrlueo;s  2xrio iy1om emncilt aDrmum nt4opt  iciadfs2eau s;()trermr3oodfatrlu ils) 2xmxo iy4lmenmnvilt s2rmxroou0texn oeilt sDuanmo ()tetnmociy1lp eanei;s0 etr(o oydlmenlictltf Dtm(rpnu4tpeomfeiaslm2raumo (4 exomr3iodfpDrau i ( seurirpiy4lp emfvsa() 2ta(r no1texnmietydla2rmuvs t)tetoir ty1fmDrlieols0 2urio ou4ole  ncs t aDrmx  nu4ole mo3iysfa2rlnvo;u)arenmrcoadlat livs;s)srto(o3iy4open fviltfarrm(rp;o4tlxoii3ilt sDeluvs u0tltoxr todoaDrlu o t0 rxmxmpnu1ll nmfcsa()aDurxmpou0tlt mfctlsfsDrlnvs u0texrxf totom eln s t  etrirpny1ol nlfvslt  Dum(rpno4ape  fciyd a raums u4 eerxo iytlmDeauei;t)sexmxr iudaltemfeilt aDrmurp;t0tex mo3iatfs rmu o (0altnxfcoytfmtrliesls0t2xoxr oy1optnlieiasf Drau pnu4tpt  iciat sDelu o u)texrifciotfptraues;()trxmir3iydlmtnmivsls)s2uaurono0opeo o3tyd sDemn p;u) eeoxo iotlp rauvo;s t2tmxr io1am emietltfa2tr(rp;o0aet ifeiysfs2elu snt) rerifcoodfpDrai olt0texm(mpiudolte fci tfsrrmuronu1tltn fciyt m2um(vonu4 rtoifciadfm   n i;t) exr(r3iy4olt  fvta()sDrm(moou0tpxn ociyd aDulnvp;t0aetnxocoytlm rauesl()teto(rpny4ll  livi s) Durx  no1ape  oeiasfaDrl( s;u0teeomf totlm  lu o ( srtm(mpiy1opeemfeiasf rtmxm oo4aeenmfeiaslm umums;t)tlenxr3iytfaDe ivs;(  2xo(m3ou4lme lfvias)sDururpot4opx  feiadfa2umumsn(4 lerxr3oa1lmDelu slt)t2xmir3iy4ll elfei ()arrmxr no4oeeomoeiasfa eanmpn(0 etoxo3ootla  ai s ( seur(r3no1lmeemnviatfsDtax pno4tlt ii3iltfaDeaums;(4altnxr totoa eaivs;t  ruoxm3iodlpee nesa(fs2ua(m ou1ole  iciysfaDem( p;()tlxrio3io1fptraivo;s)teur(mpiudop   fvslsfsrrmumont0tle  feiltla ean p;t0 ltrifciy1lpte u i s trur(opnodame  fvsa(f Drax  ou1texnioctadfaDrmumo;t0altrxr oa1latrlnes s)s2xoxm oodlmtemncilsfaDuauroou0olt mf3iadfaDul( snu4 rxrir3ty1lmteli slt)trxoir no1oleelicils aDrm(ro;u1alxn oeiytlaDrlnmpn(4alxrxo iytfmDelieo s)t2uo(opiodlp nmfvs t)artrumpnt4tlxnii3tlslsDrm( s;t4arenirciatlmDranes;(0 ruoio3io1ope mnesa( sDra(m ;o1aexoifetyd a2rmnmp;(4aeeoxr tydop rlivo t) 2xoimpoo4lpeemivsltf Draxr ;u0tptnmiciys mDem( s;u)areomf3iadfpt aivs;t)s2tr(r nu1om n icias  rraxm nt1tetn fciatfmDeanmp t)trtomr3oodfaDran o;t t2toir no4omenmictasfa2tau  no0open o3tld m emu s;(0 rtrirciotfaDelu i;( trurio3iu4llt lnei s  2rr(m ;t4tet  i3tldfm2rmn o;(0trxrxf oy1lptr u i s teuo(opiudamtn nctlt aDrr(  ;t1opeo fcilslm2emuvonu)alxnmr io1lpt lieo ()srtrio iu4altn fcs (faDtmx p;t0tlxomo3tldfm ul( o;(4alermo3tydomDrlnesl( trtm(m nu4om n feilt)a2rmu pno0tpeomo3tls a emnmonu0artomo3oy1omtr ivi ()s2tmxrpoudapenmncsa( s2ua(mo;u0optnmfciysfa ea( p u0 ltnmf oatfptelu o;t0srxm(r iu4llenmicias  Dtm(rpoo1apxnmociadlm rlnvp;t4altrxr tatomtelu ols0 2um(r3ou4op e iviat srururpot4apt ifciatlmDeanvs t4artrmr3io1oatr nvolt)texmxopio1optn ncta(  Dtmu o;t0tee ioeiydlm2emnmsnu0alxrio oatlm eaieol(  rumxo3nydam e ncsas  rtm(mo;u0tpenifeiltfsDeanms u)trxomr totlaDr uei t0 exmxo nu1om n ivsas)sDtmxmpot0aeeomfciysfs um(mp u)arermf ty1faDe n s;s) etr(r3iodllt mietat aDumxm ;u1ope  i3ildlm rlnvs;t)alerxf3iy1la rlivs;s srtoxm3nydlpenmivsas)a2uax poo0tpxomi3iys a ulnmsnu4tlxnmrcoo1op rlnei s)t2xrxo oo1lmee nesl()srta(ro;o4tltn iciaslmDrmn p ()aetrxr3iy1fmtrlieo ( setr(rpio1apt lfcia() rtm(rp;t1tlxomf3iyt a2em(mp u0artrxf oodfmtrlivi t t2xmiopio1amtnlfvsl()a2ta(mpot1apt mfeildfa emnmonu) etrxr iydlateln ils)teumir io4lpenlfvsa(f rtr( pot1aexo ociad s2el(mp;t4tlxrxo oodoaDelnei;s)teuo(m iy1lpe liet sfs2uaxmo;o4aeeoioeiatls ul( s;u0altnxociatfmD lneils) rxm(o oo1op e fviatf 2taum oo1aptoiociyt s el(vo;u) rtrxf3ty1fmDe i ol(  2xoxrpnodlle lfcias)s2rm(mp;u4opt  fetltla ra( p;t0trxnif3oytlp   iei t) rurxr3iy1op  lfvtls) 2rrx  ot1aleo i3iasfa uauvs;u) etrmf totoa  luei s0truoxm iu4ole mfvs t a2rmu  ;t4alxnmi3tldfs eaump u)tlxomo3oytoptran o;( sruriopoudope lfvtas aDuax ooo1tet  f3iad a2rm(mont)trerxfctotfmtelieol( srxmxm iydlle  fvtas) rurumpou0tlt ifeildlsDul(vs u0 exrif iotfm   ivil()truoiopoy1lmtemncsls)srrr(ronu1apeomf3ildls rlums;t4trtnxocoy1fmDrli i s)srxoxopio4al nmietat)aDrrumpoo4aleomoctyslm2uanmsnt) exnxf oytlmDrli i;s)seto(r3nu4lptn nvsa()artrx  oo4tlxnifetydfaDulnvsnt) lerio3ty1faDr i s;t)s2tr(m3no1am   fctl( sDraxro;t4oex mf3tasla el(ms;u4 rtomo tadfpDeln s t  rxriopno1ol nlfcsas)srtrxmpno0oee mieiat mDeanms u4 lxoxr3io1lp e ivslt0 rumxopiy4lmtnlivsa()arraur no4tptnifeiadfmDua( pnu4 exnmociodopDe n s t0seum(o ny4lpee nvta()sDraur nu4aex micildfs2elnmon(4 exrxocia1lmte ivo s) 2xoio nu1aleelnctas sDtrx poo0tlxo ieiyslm ul(vs t4 ltrmocoy1lp  auei;t0trxm(r no1omtnmfvta(farurxr ot1tpeomfeiatfa2rmu s;u0tltnif ty1fa   ueo s0trxm(r3iu4oleelfct s) Duax  ;t0tptomicilsls2elnvo u0alxoio tytfmD lues;s s2umir io1op  liei ( artm(moot4olxn feiydla2rlu p u)tltoxr3totomD lueo t srtrio3oudlleemiviltf Dtm(mo;t0tlt io3tadlaDem( pnt0aexnif ta1oa   ies s  etr(m nu4ope mnvi t)aDtru p;o4opt  oeiyslm ran o;(4 etnio3tadop e ieols trurim3ou4omtn fetl() Dtax p;u0tlxnmi3iys s emump t)aetnifcoodlpteau s;t  euoxopiy1omt lfvil(f 2tm(rpno0tle iicildfs2emnvp;u4texnxr3iy1fm   uvo (0 eurxo3oydom emfet ( sDta(mo;t4optomo3ildfm ran o (4texoxo oytoatrlnei;( t2xm(m3iudam elfesas aDraur no0tet  f3tytlm umuvpn(0texomr3iytopDran i s  2urxo iy1oltelfctatf Dtax pnu4aleo iciltfm elnvsn(0 lxrxf oytom rlueslt)s2xrxm oudal emnctl(farra(mono0olt mfeilsfmDra(vsnt) rtoir iydfpteaueo ()texoim3iydam n ict t  rtmxm oo0tle io3tysfa2ranmpn() exoxrctadoaDelieo t0texrim3io4lmtn feta(farrrx pou0tpeniietytlm2el( o u0artniociodlpD au i s) 2tr(rpny1lptelnesat) Drrx oot0tee  fciatfa2emuvs t) eermocoatfm rlneo s0t2tr(m3ou4al  livt s)srur(mpnt1olen ietys m raums t0trerirciy1fpDe i i s s2urimpnodll nmictlt aDrax  ot0olxoioctlt s2ranms;t4areomociotla e ivolt  rtm(mpou4ol n ncslt  2tau  oo4tptnmoctad s2umnvs;t)aeenmo ootomDr ueo () 2xmim io1alenmivslt s2umxmpnu1aetoioctys sDuan pnu) rtrmfcoadfpDrlnesls0srxmiopoodaptelfvi s s2uru ooo4tltn o3tlt aDrlnvs t0aexrxocoo1lpD  uvslt tetoimpio4lpe mnctlt)sruru ooo4apeomfciytls2el( pnt0 renif oydfp raues (  2xoio ny1aleelicsas)s2ta( pou1teeomiciat a ulnvo (4trtnxociydop  lnvslt0t2xr(r oydopen ivi (  2ra(m ;u0tpeo fetydfaDrauvpn(0areoxo3ia1opt ai ilt)trtrxm3iy4lm emiesas)a2rmurono4apeoifeiysfm ean pnt4teeniociatom elneolt)srxmir ny1amtnlnes s)s2rm(moot4oex mfeilslm ra(vo;t4artrmfcio1fpDr ivsls) rtmim3no1op   ivsl(  Drmxm nu4oeen fctyslm2rlnvp t0aetnir3oy1opDe neo (0trxm(rpoydamee ivs t)sDtrumo;t1tle  fetyslaDrluvo;(0texrxr oodlp  aiei;s0s2xm(o3nodlme lfcil() rtru p;o4tpt  feils s elnvp (0tlenxr3tatlptrlies ( s2xr(opoo1optnmict t  rrax poo1olenifetldfaDrln s;u) lxrxfcootla  lnes;s seur(o3oudll   fcilsfs2tmx  oo4oeen oeiatls2ul(vs u4artomocia1lm elnes s)setoim3ou1omeemieiltf 2rau poo4ale mf3tat a2rlnms u0 eenioctotoat luesls0t2xmxm ny4lptnmivsas  Drm(r ot0teeoifctlt m2eauvp t0 etoio iotfaDe neo;s)s2toxo oo4ol e fvi tfsrtr(rp;t0tlenmf3tatfaDra(msnu0 leomociodlpD  ues;(0s2xmio3iu1ll   fesls)aDtau onu1aleo o3iasfaDulu s u4 rtnxo tatla e uvo;s) rto(mpoy4aptelnctls srum(m ;u4oeen iciytfm ul(ms (0arxnmr tytoaD  u sls) rxoim3oodam e fct t srumx p;t4olxo oetlt m rm( pnt0aetnif3oatlmt  uvs (0s2xoxrpnodoltnlfctl() rurx ont1tptnmo3ilsls2rau p;u4teenmrcoy1fmtr uesls0s2to(r oo4lle mfcsas) 2tr(  ot0tpeomfetydlsDrluvs (0texnif iatlmtrln slt0 eumxrpoy4omt lfvsas aDrmxr ;u0alen iciyd a2ulump u) rtoxf oy1lp rliei s  2xoxopno1optelnes t a2tax o;o1aex if3iyt a2emump (0texoxfciydlat luvol( teumir oudllt mnet t  rur(r ot4tlx moeiatlm um(mp t0treomfcoodlaDraues s0t2trxr ny4aleelfes t arrax  ;o4apx mo3iad sDuauvpnu0 rxomociytopt lnvs ( srxr(r io4amtnmfeiat)srua(rpno0aetnmoctadfsDra(vp u)texoio3iadlmD  u o ( s2urimpoydomt mivtas)arrrxm oo4tpeo f3tlsfs2ra(vonu) ltnio3oo1fmtr i o;(0tetrxrpoydal  mnct s arurx p;t1tlenmf3ildlm ulu pnt4 eenxr3oy1oaD  nes t) 2urxrpnudll nmnvs t aDum(r ;o4aee mociydfs2emumon()tltnmociydoaD  i i;t)s2tmio3iy4ol  lncs (farurumono4oltnmieild s eaumonu4trermr3oadfa  ln i t0 2tmio3oodlmee feta(faDtax pnt4tltnifetat a rl(vp t)teeomo3to1lp raieo;s sexmxrpoodomt lfet tf Dtmumoou0texnioetad aDuan on(0aeermrctydfm  luvs t)s2xr(o iodllen fvt tfarua( onu1aex iieiadfa2ulnmp;t0 eerxfctadfm r uesls)t2umim iudlpen neiat s2rmxroot1tpenmicild a el( s;t4 lerxf3oydla e u ilt)seuo(mpnu1ol nmietls) rrmxrpou4tltnmieiyd a ranms;()trtoxfctatfp r n o t0s2urxm3oy4ap nlnciatf rtrum no1alt io3iadlaDel(mpn(0tlxnxr tadlmD auvo ()t2tr(o iudllt lnvi t)sDuaurpnu1aleoio3iltlm uanvp u) lerio todlat  ueils)srto(mpnydal eliet s)a2raxm oo4tpeoioetadfm ra(vp u0 rxoir to1lpteln olt)t2trxmpoydoleelieiatfs2uru  ot1tpt ioetydls ean ont) exnir tadop elnvi t0sexoir3no1lme lfvi (fsrtr(m ot0optnmiciyt a ua(vpn(4 etrir3oodlmDe u o;s0 exoirpou4llte fetl(  Dra(rooo0tpxomfeiyt mDemu p u)altrio3tadlmtrlnvo;s  2um(opoy1lme  nvt (fsrur(r ;u4apxo f3iytfm uanmsnu4 eerifciy1oateaues t0t2toxr3nu1olen fvtasf rrru o;o0apxnio3iatlm2uaumsnt)teenio totla eaivsls)tetm(o3oo1lptnmfcil(f 2uaxmoot1olxniocias sDem( p;() rtrif3iatom r i i;t)s2xo(o iudapeelictl()sDtr(rooo4tpt  o3ilsfsDeluvs;u0 reniocio1oat
\ No newline at end of file
@@ -0,0 +1 @@
+n s;t)trxriopiy4optemiciltfsrtru poo4tpxnmfetat m2ul(mo (0 ltoircto1om rluvo;s0tetrxopnu4ap nlietatfarrau poo0alto i3ildls2el(vp t4alxomr io1fmDrlivolt0s2trio oo1lp nmfci sfa2ur(r nt4olt ifctlsfs2um(mpn() rerir ty1op rai o s0s2tm(mpoy1omtelnci sf rumxmpnt4tpe mf3ias m umn o t0trxoifcoatfmD auei;s texoxo iy4al nmiciat) 2rm(  oo0oexoiociyd s2rmnmsnu4 lxoxr3to1opteluvs s)trto(r3nodlptnmfet (f rurum oo1alxo octls a um( snu) eenmr3iydfmDrai o (  ruoirpou4altnlivi tf 2rru p;t1aptnioctytfaDrmumon(4 rerxf3oy1laD  ivo;(  rxoxm oy4opte icsltfs2umur nu0oeenmiciytla2rl(vo;u0aetnxf3oytlmt aieils0seur(o3oudaltelfct ( sDtrurpno0tlx iieiltfs2rl(mon(0texrmo oo1fp  aueol() 2xrxo3nydal emnctas  2ua(mpou1apenmfctlsla ul(vo t0 reomf3totom   nes ()s2xoxr3iodamtnmivta(f 2rrx ono1aet  ocilt a umnms;t4 eeomfcoydopD lnesls srxm(mpny4al elnctat  2rr(m oo1oltoii3ild a elnms u)aleomfciodfm rlnes s0s2uo(opoydlm   ictl() rumxr ot0tlxoiieiysfm um(vpn(0arerifcty1fpt ai sl()seto(opny1olee fvt t  2rr(ro;t4tex mfetydlaDeanvs t0texnmf3oadla  luvi s  exrxo3ny4optnlnvilt)srumxmoot4opeoif3tldlm2ulnvs;u0alxoirciotlat au ils0setoimpiodaptelnesas)s2taur ;o1opx io3iadla rm( p;t0treomf3totfaD aivo t0 2tr(mpoodopt mncs s) 2tauront0tleomoctasfm2rauvp (4artrxf iodoate ieolt0setoxmpou4om e ncsas srrmu pnu0oeeo iciyt s2rm( p;u0tlxoxrciotoate ieo t) rxr(o iu1ll elfei s)aDuaur nt4tlxnif3tyd s2ul( pn(4treoio io1fa r u ols trurir3no4olenlnetls srtrxm oo4teeomi3iadls rlu p;u0altrxfcta1la   ues (0 2xrxrpiu1ap  miet sf ruax  ot0tpe mfeildla emuvp t4aetoxf ta1fptrlnes;()s2tm(o iudal e fvslsfartru pnu1oee  ietltlaDranvon(4 exoxf3oy1om rlivi s0 rurimpno4lmen fci tfsDua( ont4aetnmf3ilsfm rmuvp t4tleoxfcto1lm   uvo;s  exoir3io4lmenmfctls) rtrx ont0opx iieiydfs uanvpn(4 lxrxo tytoaDr u il(0trtrxmpiu4lpt mnct () rtaumpot4apxomo3tydls em(vpn()tltrxocoatomtr ivsl(  rurxmpoo4amt lnet s arraxro;u1tee mo3iltfs uanvo (4 exrmr3ootfm  ai i s)tetrxmpou4al  mictls  rur( p;t0alen fciyd sDra( snu0teerir3ootopDrliei s)setmio3iudolte icia(fsDrrxm nu0ope io3ilt a2rlu sn(0 reoxfcoy1lm elivo t)s2xmxo3iydomtelnvsls srta(mp;u1oeeomf3iasls2rlnmo;(0 exoxo3ta1lmt  ueo;( tetmiopiudop elfvs (f Durxr nu1oleo iciysfaDemnvpnt)altrxr iytopD  ivil()t2uoxo ou4op nmfciltf rta( onu0apxnmo3iytfa2emnmpn(0 lxnxfcoydoatrluei t0t2umir3iu4lltn nvt sfa2rau  no0ope mfcilt aDra(mp;u0aetrif tatlatranvo;s)seumxo3oodll nlici t a2ta(r ou4tltnioeiltfs em(mp t0 etnmf3ta1om  anvs;s srtmiopoy1omenmictatf rururpno0ope mo3iyd a2elumo () lxrmo oatla eau o (  2tmxmpoy1ap elnes t)sDumu p;u4aex  ociytlmDeauvs t0trxoio tytomDrau s;s) ruoio nu4aptelfetl( s2tmur ;t0olxo ocilt mDemn pn()alxnxf3oatfate nvilt)srxoxrpnu4ll nliviat  Dur( oot1altn octas sDrl( ont)tlenxf3iydfatraueo;s  2trim iodal   fctat) 2rr(r no1aeeomf3ias sDraump u4 etniocoy1op eluei s)t2xoio3oy4lme  fcsa( sDrmump;t0optnif3iatlmDumnmsnt4tlxnxo3oydop rlnvils)t2urxo io1apteliesat)aDrrxmp;u1oeen fctat m2eau o u) ltrmr3iodlpD lieo t) 2umio iy4ap  lfcs ( sruaurono1alx  i3ildfs rau on(0 rermf3oatfpD  ieils srtr(rpiydlm  licia(f rtr(mono4olx iiciyd s ran pnu0trxoxr iotfat ai o s)trtrir3oodop   fvs sfsDra(rooo4apeoii3iysfa2emump t)alxnxf tadfmt auvi ()s2tmio iudllt  fetasf rraum nu4oleoioeiyt aDeln o;u4arenxo to1lmD  uei;s t2urxopnu4lpeemfcta(fsDrax p;t0altoiieilsfm2uanvo t0artrio3ty1fp eluvol(0texoio3no1ope lfvslt) 2uaxmooo0oex iocilt s2ea(ms u0tlxnmr3iatoatrli s;s) rtoim nydoltn ieta()sDtax p;o1opx ioeiytlmDranmon()altnxf oydomDelneils  rto(r io4op elieils a2rax pnu0tetnmoeiysla2ranvpn(4 eerxocoodoa e ieils0 rxr(rpou1lme lfvilt) rrmxmo;t1oeenif3iltfa2rlu ont0alxnmr oytom   ueolt0 rtrxmpio1apenlict s)sruaxmo;t4tetnmiciys m ra(msn(0artoxr oytoptraivil()t2xr(opoudlle  fetas)a2taxmp;o1teeo o3tatlsDrl( s;t) etoio3ty1fpDe ueslt0 rxoxm oydlmee fvt (fa2tmum nu1opx if3iydfmDuanmpn(0texrircoydfpDeli s;t  2uoio3nodal nmfcslt)aDtau o;u1opx  ieiadfs2umuvp;u0 ltnxo3oa1lmt auvs (0s2xoxm ny1openlivi (fsrrmx  nt1oeen i3iadfa rmu s;u)trtoiocootla rlueol(0texmim oy4ameemicias sDua( pot1oltoifeias aDelumpnu0alenir to1op eaivs s0s2xrxm3oodome livta()aDtrur no0tlt iieiytlm ea( p;t)aexoxf3totfpDraneol( sexoio3oy4aptnmfvtls)s2trurp;t4aee  i3iyt s elnmsnt0alxomr tatlptrlnes s s2uoiopio1lmen ncsa(  2rru  oo0oetoifetyd mDrl( on(4altrif3tatfp eauvi s  eurirpoodll emnet t) 2raxro;o4aexnmictyt aDul(vonu4tleomr3tadopD ai slt trtrir3no1ol emfetls s2tmx p;u1oexoifetysla eanvonu4alerirctotlmDraues () eto(r3oy1om  mnetatf rurxmpoo0
\ No newline at end of file
@@ -0,0 +1 @@
+uesl() rurio iy1ale mfei t)sDurxr ;u1tlx mo3iytlm rl( p u) etnif iatfptrln o;t) rxr(r nodamt miciat s2rmxm nt4apx mf3ild sDem(vs;(0tltoxf3tytfm eauvo;() etr(m nu1lmt  ivsa(fsrrruro;o1tlx mfetysls rl(mo (0alxnmr totlpD lnvi;s0sexoxr oo4llt  iesat) Durxmp;o1open f3ildla2elu s;u4trxrmfciydoatraivols)seuoio3iydaptnlfctl(f rrr(root1aetomf3tldfsDrmnms;() rtnxrciotfateaiei (0t2xrxo3iudoltnmnci (  rtmxm ;t4aeeo ociatfa rmumsnu0 lxrmoctotfaD lnvslt0trtm(m3nydam  lfvs t) Dtau oot1olxo oeiasla2rluvpnt)trxrmo3oy1oa rln s (  rtm(o3iy1aptnmicta() Dum( oou0apxoiieild m ranmp ()tetnir3tadop  anvi;t) rtrxmpnu1opt  iei s s2rr( ooo4alx  o3iadla2eanvp;u0alenxr tydfp   nvsl( texrir iudamtn nci s  rurxmp;u0aet iociatfaDra(monu4tetomf oa1laDeaivsl()tetoim io4am   fet s  rrru pnu0olxo f3iyd m rm(mon(4arxnxr oatoa raneols0seum(o ny1ale  fvs s) Dumum nu1tpt mf3iyd sDem(mpn(4 rxrxo3oydlmDr i s () 2toxm3ny1alenlfvsa(fs2trxmp;o1aexomi3ildls elnmpn(4alxnmf3iadfat luesl(0 2xoio3ny4alen nctlt  2umump;o1tex  i3tys mDrlnmp u0aeeoxo3iodlpDrau olt srxoio ou1lmenlfeilsfsDumurpoo1tetn oeiadfsDul( p;u0artnxf iytfat anvolt) etoirpio1op n nesasfa2uaurpoo1opxoiociadls eau p (0trxnif oa1fmtr nvo ()texr(m3oo4optnmncsltfs2tmuroot4opt mfciat m2umn s;t0tetrif oy1la  lueo (0 rto(m ou4llee neia()srraxroot4texniieilslaDrlnvo;u) ltrifcoydlaDeaueil(0 2toim3oo1am  mics ()a2ra( pnt0oeeomfetadfmDeau o u) etrmoctydoptr ivsl()s2xr(rpiodom n iet s sDumx p;t1tptoifciatls2ea(vs t4trxrir io1lp  aivs;s)srur(o nu4olt lfet s  rtau pnt1tetoifctatlmDranms;(4altnxo oydlm  lieo;s  2urim3iydopt  iesat srur(  nt1oexn icils s eluvs u)trtrxr3oytfpt  ivi s s2ur(m3iudoptnlneiltfsDumur nu4alenmoeilt s2ran o;u) exnmr iadfaD lnesls0 2trxmpiu1altemfet sf Durur nu1tleomfeiytfm2rmumsn(4 lxrmf oa1faD au olt)seurim nodaptnmies t a2raumo;o0texo octat s umnvpnt4trermo ty1fmD lnei s) 2to(m3nodam e ncs t  Dtr(m ;o0oeenmociatfs2ran o u0 lenxo3ty1lm rai s;t)teurir3oodap nmnvils)a2ua(r no4alt ifeiyd aDranvont)tltnxr oy1fmD auvo ( trxo(o ou1lpte fvi s)sDurx  nu4ole if3iltlm elnmpn(0 lerir oadlmDe i olt s2uoio3ou4amenmiet ( sDtau  ;o1oexn fciatfmDulnvp;u) rxrxrciotfaD  u o;s trurio3nu4lme miesat) Dra(mo;u0olxomo3ias s uauvpnu) rtomrcoatlaDe i i;s0s2xoxrpno4am nmnctl(  2rm(  ot1teto i3tysls rlums;t4 leoir tydlptranvs (  rxoxm iy1amtemfes (fsrrr(rono1tpt  oeiyd s uln p t) rtrxo iydfpDe neols setmxo3iudaptn ncta()s2umuro;o0altoiiciltfm rl(vo (0aeeomocoatop  livol()tetr(m3no1ape mfetlsf rtrxr no1ope moctytfs2rlump;(4artnxf oy1lptr ieo t srtr(mpno1omtn nes s)aDumxr ;o4tpe ioetydlaDemumsnu0tlxnxf ta1lm e ivolt)s2uoim3nodaptnmfcs s)s2rrx o;u4apxnifciyd m rauvs (0aexrmr oadoateli ilt)teuo(m oy4alenmncs (fsrra(roou4ole mi3iadla2umumo u4tlenmocoatla  aivi s0 2trimpiu4lmte fes t a2tmu o;u4olt miciytfm eaumo t0 rtoircoy1op eluesl(0trxoxm oy1olt  nvils)sDrm(  no0teeomiciad m ul(mpnu0 rerxf oydlpteauvsls trtm(r nu4omte nes t)s2tr(r no1tltnmictys m2rmuvo;u)altrirciydfmD au ilt0sexr(o nodlltnmict ()a2tau ooo4aexoiietltla2el( s u0trxoiocia1lm eauei (  eurio3ou4apeelnvt ()sDtr(r oo1tpto ictydfmDemnmp;t0aeeoircoy1lm rli sls0 2urxm3ny1lp nlivias sDuax  ot0tle  i3tas m2rmn o;t) ltrmo3io1lmt lueils seumxm oo1ape lnei sfs2ra( pot4opeomoeiysls ua(vpn(0trermfctatfmtr iesls sruoxm nu4ol  livsa(fs2tau  ;t4aee ifeiyd m rmuvonu4 ltoircio1fmDraieo;t0trxo(m no1olte fciatfsDrau  nu4apeniietasls ua(vo t0artomfcio1omtr neo s0trumirpio4op  miviasf 2rr(  oo0oex iiciyt m rmnmo;(0tetrirctatfatrauvs;t0setmxopoy4ol  livsat)srum(r ot0tlto o3iyslm ra(mo (0tleoxr3ta1fp eauvi;s)t2tm(rpiudlpeelietas)a2tmump;u0tex io3tasla uanvp;()aexoxrcio1fptelnvi;s) rtrxm iodoleemicil( aDta( oot0oexnmfcils aDranvs;u)arxnxr3iadfpte nvols0 2xm(opiy1apenlneilsfs2um( o;o1tpt mfcilsla emu s;t)tlerxo3iydfateau olt srurxmpoudlptemfvslt) rrruronu1apx  ieiasfa2em(vpnt)tetoxf3oa1fmtrauesls  ruoimpnodamte ict sf 2tmxroou4apt if3iatfm rmnmp;()trxrif3tatomD lnes s t2xoxrpno4ol  lnvta(farraxmpno0apxomf3iys mDua(vsn(0texrmocoa1opte nvs s seuoim3iy1omeelies tfsrtmxr ot0aexoiieiys s rlnms;u)tlxrxr iodlmDranei s)s2xrio iudap nlncsl(fsDumuroou1tet  f3iytfmDeau on()teeomocoytfptrluei;t s2uoxo oydapen fesl()arur(r ;o4olx mictltlmDemn snu4 lxrmrciotom elieols0s2xrxm3iydalt  fciltf rumurono4tetomfctatfa2eauvpnu4aetnmf3iodlate i ils tetmxr3nydlpt  netas aDtr(  ot0tpe  f3iyt s2ul(vp (0altnxfcoy1omtraies;s) 2xrirpio1ol n ncsls arua(m ot4oltoio3tydfa2ul(mp;t) rxomo oadoatr nes (0s2umxm nodllee ieias  Dtmxm nu0opxoioeild a rm( snu4trenif io1laD lnvo;t)tetm(m iodlltn ictlt  rraurpnt4texnioctysfm rl(vont)arxomr3oadoatrlu i s teur(o3no4alee fvt ( sDtru  oo0aleoio3ils a uaumo u0trenircoo1laD au i t teuoxr3nu1amtn fci s)aDtau  ou1aet mf3taslm2elu s t0trermf todfmte uvo ( t2um(rpiydopt lnvtls  2urumonu0tlen fetas a2um(mp;t0 lxrmfcta1omDelies;(  2xm(m3ou1altnlicsa()arra(mo;u0teeniocilt aDrlu s (0 ltomoctytlmt  n s;t)teumxo iy4aleelnvi t)a2uau poo1oet ifetad a2em( s u) reoxf3iotlptrln ils srtrxmpiydale mfcsat s2urur ;t1olx ioctltlmDrmn o;u) lxrmf oytfpDran il(0 exoxm3iodlltemfct (fsrtmx pnu0tlt if3tltls um(vont0texrmo ty1opDr nes (0 ruo(m nudaleemies ()srta(r no0aexomietyt a2elump;u4 ltrir3iatlpD  ues (0t2tr(rpnudlm  lnviat) Dtmxmooo4apt  fciatfa2um(vsn(4 leriocoy1oaD lneslt0teumxmpnu4ape lncsa(fs2um( oou0aexnmi3iad m ua(vp;(0treoif3iadfa   iei;( t2urio nu1ol  lnciltf rtmu o;u1tpt  ictad m2uaums;t0altomo3oo1fpteauesls s2xmxm3oo4olt  nei t) 2urumpot0olenmf3iyt s rluvp;t)arxoirctadfa   ies;(0srtmimpiodamee feslt  Dum(m ot4teeomoeiatlsDea( o (4 rxrxo3ta1fpD aiei;t) 2xo(o nydlpenlnesltfarrmumpou1tptnmicildfa ranmo u4aetomr iytlpDelivols)t2toxm iu4amenlnci sfsrra(r nt0apt  ociydlm2uauvonu4aetoio oa1lpt anvs t)srxr(opnodopt mncsltfs2umurp;t4alxnmfetydfmDel(vpnu0artoir oydopt an s s0t2uoir nu1ome mfvsl() 2ua(  ;u0apeomi3tatls2eanvo (0trxomf iy1fmD  ivs ( t2toim3iu4lm  mieta(f Draxmooo4tlen oeiyd a eaumo (0treoxrcio1opD anvi;( t2xmir3nu1am elnet t)sDuru ont4olen o3iltlm2ua(ms;()areomr iodlpte u olt) exoxopoodlmeemivtasfaDtmu oou0tpxo feiltfs2rmnms u4tlxrmo3iytfa   nvsl(0t2xrxm3iodllee fes t arurxmpoo0tlxoiicilt aDel(vo u4alxnxfciatlpDrai o;t  2xr(r3iydap   fct tfsDrrx p;t1oexn ieildfm uan p u0aeenmrctytlmteaivs s0 ruo(r no1ame lneiltfsrta(m ot1olto o3ils aDemnmont0tlermr ia1fpDelivo s)s2umxo oo4lltnlictlt a2tru p;u0olxn oeiadfmDrmuvpn(0 exoxfciodlpt au o;()trurimpiu4openlfcilt)s2ur(rono4olxnifetlt a eluvsnt0trerio3tytlaD  nvsl()trumimpoy1lmeemncta(fsDta( ont4alxoifciyd sDuau s t4aleoxf tydlptraivs;t)t2xmxrpoydap nlfcias  rraxr ;t0tee iieiydls2rl( o u4 lerxo3iotfaD au ils  rto(r nu1alt mivilt artmu  ;t0olen ociaslmDulu snt)trxnxf todlpte i s;( seum(o3iudapenmfeslt)artmum ot1tetnmfcilt m ul(mp u0arermoctadlptraneo;t0 etr(r no1opt miesl()aDrm(  ;u0alto ictadls umn pnu0 lerxr todfmtrlneo;t0s2xrir3oo4oltnlietasf Dumxmoou1apto ociysls2ulu o;t) renmr3iodla eauvo;()srxr(r nudlmt mivsls) 2um(ront1teen o3iys m2rm(vo;u)teenxf3ia1lmte n i;s0 rtr(o iu1ap emnesl(  Dtrur no4tle mociltls2uln onu4 ltnxr3ta1om rli s s0s2xrir3iy4olen icta()aDrmuront4olto i3iasfs eln snt4artrxo ia1oa  au i;(0tetr(r ny1opt livt tfa2umur nt4ope  ociaslm2eanvp;t) reoxo iytlmtranvs s0 rxmxm io1llenlfetls  rumxm ;o0alt  i3iyd aDelnvsnu)aetoxr3ootlaDe nvols)srtmio3ny4lm  mies (fsDum(  ;o1opeo fciydfaDrauvpnt)trxnio iatlmDe ivslt) euoxo3nu1amenmictlsfa2urxr no0teeoiiciysfsDuanmonu0trtomo3oatlmtean i;( trxm(r3oo1om emiet tfartax  no1tptoif3tytfm ul( snu) lxomf oadoa   n o;s t2tmiopiu1altnmfvtas  rurx onu1aptomociytfaDemu snu)teeoir ia1fa eluvolt teuoxm nudalen ietlsfsDrm(m ;u0alt mieiatfaDrlnmsnu0 rxomr3tytoptr ies;s) 2xmim iu4ol n fcsa(fa2tr( p;t0apxomfciltfmDemumsn(0aetomfcoy1fptraneo;s) rtmim3oudllt  nvilt  2tmur nu1aet mfciasls2emuvsnt4tltnif3iydoaDr n il(0srtr(o3ny4am elneiltfs2rmum nt1tlxnmo3iysla2rm(mp u)arerxo3iotfpDe uvo s setmim3nudomen fciltfsrrru o;o4oet iietas a2umuvp;() eerirciytlaDr u s;() exm(r iu1alt  iciatfs2rauroou4tlx mieiad s2ea( s;() rxomr ia1lpteau ols)srur(o io1aleelnvtatf 2ra(mo;t4oexomi3iadls2um(vpnu)trxomr oydfm r uvol(  exmir3iu1lp e fvsl(fsDumu p;u1opt ii3ils m elnvs;t0 lenif iotlmtean s;s trto(m3iy4apeemfeia(fa2ur( onu0olt miciatfs2um( o;(0 exrxr tydoa r u ol()srum(mpoy4op emnvils)srrax o;u1alx mfeiytfa rmuvp;t)artnir iodfm  luvsl() 2xmxr nudopenmnvt tfa2rrxroou4apeo o3iat s uanmp t0 renmf totfaDranvs;t) euo(o3ny4opeelicta(fa2umx p;u4alenioeiatlaDrlu s u)treoxr3iy1lat  u ilt)texoxo3ny4aptemicsat)a2tmxm oo1tpe  o3iydla ra( pn(4aleomocoa1fptrlies (0teurim3ou4altemfet () Dtmxmpoo0aeen feiydfmDrm(mo u) lxnmrcoadomte neo (0 rxriopiy4ll e fctltfa2trurp;u0tpx  i3iltla rl(msnt0 exrxf3oatlat anei ()trxmim nudal n fesltfs2tm(  ou0oetn f3ildla ran p;u0 rxnxrcta1late nvilt0 exrxr3oodlptnmfcs (  Drrxr ot1openmi3tad s uln o;(4arxrxo3ta1optelies t) rum(rpno4oleelnes s artmx  ;t1tpe mieils mDeluvp;(4tlenxr iotoaDrlu sls t2toxo3iudlmtemivsat  rur(mpou4opx mocildfsDrlump (0texnxr3io1lptraieo;t0setmxm iy4am n ict t)a2trx  ou0tetn oetysfa emnms;(0altrmf3iatoa   uvilt0sexm(r3iu1alt  ietls artrxront1tpx moctydfsDrl(vpnt0 renxr iytfpDrlivs ( trto(r io4lmt lfeiltfa2rrxro;o0olt ioetadfa2uan s t) rxoxf3oodfa rluvi;t0 rtrxo3oodol   ivs (f rtrxm ;u4aeenio3iatfmDrmnvp u) eenxf3ia1op  lnvols  rxm(m3no4alenlnvi s) Durxr nu4ale  i3iasfa emnmsn(4 rxoxr iatlaDelieo;s0t2urxr nu1apt  fctat)sDurx pno1olxn fetysls2rlumsnt4 ltrmrciytlmDr uvi s s2urxm3io1lp e fei sf Dtm(m ;u0teenmfciadlaDul(vp u4 lxoio3oa1faD aueo t0tetrirpnodlm  lfcs s  Drrxrpno4aetnmoctad sDel(vpn()tetoxrcoadlateanesls  2toxm ou1amtemnvias)a2raxm ;t1apx iieilt aDeaums;t) exnxf tatlaDr u o;t0seuoxo3oo1aptemfeil() 2rm(r nu4tee iieiys m eluvsn(0tlenmr oytom r uei s)s2xo(rpiy4ol n icils  2truro;o1opx  fciat a rlu pnu0tlxoxr3oodlaDeaueols sexr(rpoydopt mnes sfsrtrx oot1altnmfetydfm2rlu p;(0alxrmf3tatoptelneilt tetoim3nu4altemiei sfsDrr(ront4oetoii3iasfm umuvsnu)aleomrcoa1opt livo s tetrxrpny4ome mfvi tf rtmumont1texniieiysla2ranvo u0altrmf3iatfpt auvs;s) 2xrimpnudapte nvs tfarua(mpnu4aetomfeias s ulumsnu4 rxomf3oytop rlu slt)setmxo nodal emivsls) Draumoot4aptomo3iysfa elu o t)teenifcootlaDeauvi s s2xrirpnydamtelfcs s)srtrxmooo0tlt mictysfs2eln o;t)trxnmocoa1oa eanvil(0 rxmxrpnudoltnlfeils sDum(m ot4tlxn i3iltfmDel(vs;t)altoio3iydfat au sls  rxmxr nudal   fetls a2tmumpot4tptn iciatfs2uanvo u0 rxrio3tytlp eanei;s) exr(mpoodol e nvt (  Dtm(r no0aptn oeias aDra( s ()trtnifctydfm  lueo t srtmxmpnu4lle mnesls)s2trxronu1opt mf3ildls2ranmo u) lxoxr3todom eanvo s teur(r no4oleemfvi s  Dtaurpnu4apxo i3iat a2elumonu)trtnxf tatlatraueols)s2xrxm3iudlpt  fcs ()s2tm(r ;o1tlx  octlsfs2umnvonu4texrir3oo1fatelnvo;(0 euo(r io4lpeemivta(f Dum(m oo4texnmfciytfaDum(mont)alxoxf iodfat li o;s  etmirpnodolenmfeia( arumxmpno4olto feiytls emn onu4 etrmf3to1oat luvsls0 etoxmpno1om nlfet (  2rau onu1tlen fctyd s um( s u4texomf3tatomDe i i;t  etr(rpoy4olee ivt t)s2uax  ;u0ope  ietytfs2umuvp t4altoiociatlat aieil()s2urimpno4omte nvilt arumu onu4apxo ociydfs2uanvpnu) ltoxr ty1lpDe i s;s0 rxo(r io4apeelfet s srtaxrpnt4tlt mfciyt a2uaumpnt4areoifciydlaD  uvi;s0s2toxopoudomee feta() Dtmxrooo1tlxnio3iyd s2rlumo t)tlenirciotfa  luvi t0srto(r iy4opt mfviat srumur no0tpe  fetydfs2em( s;(4tlxomocoy1lm raivi;t)s2trxo iudlltn ict s artrumpnt0opt iietasfa ra(vs;()alxrmocty1la  lnvi;t seto(r3ou1ap   fct tf 2tau ont4aex ifcilslm ra(mo;(0 rtrmfcoodlm e nvils s2umim iy1lmt micil(  Dumumonu1aetnio3tys a2em(vo t0teerxf3totlm  aivils t2xo(r3ou4opt lnct t)aDua(m ot4tlxomietaslm emu p;t0 rtoxr3io1lpt lnvo;(0s2tr(m3nudalenmnvsl(farurumpot0alxnioetys aDulnvsnt4teerxfciadlat ln i t seurio ou4ll n nesl() rtrurp;u0tet mfeiyd a emnvo u4 eenxociotlm r ivol() 2urim3iodop  lnetls) rtrumpot1apenifciyslaDua(vp t0alxnmrciy1op e nvols)setrir3iodoleemncslt)aDtaumooo4olto ociytla emnvp ()arerxfctytomDraneo;( srtoiopoudoptn fvil() Drm(rpot1aetomoctasls raums;t)altnio3oydoa rlues s0 rur(opou1lme mfvtasf rrmu  nu0aptnii3tadlaDraump;t)aexomfcoy1laD  ivi t srumir3ny4omtn icils)sDuaxrpou4aetniictlslsDemnmp t4 ltrxf3oo1lat  n i;( srtoxm nu1ope mnciat  Dtaurooo4tpe iieiadlm rl(mpn(0aetoio iotla rlnvo s)trxrxr3nudalen ieilt sDra(  ;o1altn icils s2rl( on(0 rxomoctotlmDrlues;(0trxmxopny4ome  ics t) rrmumo;o4aeeoioctldlm2ran p;u4 lxrir3oadfptranvs t) etm(m3oy4lmtnmnctls)s2umxr ou1tlx  f3iltfa emuvp;()tlermr ty1fm r u sls)s2xo(o nodlp  mnct (fsDtru pno4opx mociytls2rmuvo (4artrmrcia1lpDrau ils)seumxr3io1ape mnvt (f Dtrxrpot0alx ioetyslm ra(msnt) lxomrctatomt  neo t) eurim3nu1lle mncslt) rtmu ont1optomo3tadfm2rlu sn() exomf tytfmDraivo (0srtrxr oy1lm nmfei s)sruax  ;u0olt ioetasla2em( p u)alxnmo oadlm  luvs s s2xriopiy4opte fvilsfa2tmur ;t0apx  ociydfs2uluvp u) exoif3ia1lpD  ivs ( trxoxo3ny1apenlfcils  rtru poo1aptnifciytfa2ean s;(0 lxnio3iy1fm rlivs t0 2xo(rpnu1ap nmicsat sruaum ot1opeo fciyd m ul( p;u0trtrxr oodom r nvi;(  rur(opno4ll e fvtat srua( o;u0alxo feiysls eanmp;()treoiocto1fmD aiei s  etr(o nudamenlnei s)arraumpoo1tetn oetysfs rln p;(0areoif tytoat luvsls0 rto(r3oodapenmfvsls a2tr(r nu4olxoiiciys s raumo ()tltnxo3ia1om rai o t) rum(m3oodamt mfvi s  rumxmonu0oetn ieiatfs ranmsn() lxrxoctytfpt lnvols)t2toir3oy4ol n ict tfsDrr(rp;u4tex mociltfm2ea(vpnu4aeenmf3ty1fate n i;() euoxm3io4lpee fcslsfa2tm(r nu4tlenifctatla ul( sn(0teerxocoo1la raieol(0 rto(r no4llt mfvt s srrmxmo;o0tet mf3ildfsDem( o u0 rtrmo3tydfa rauvil()srxoiopoudlmenmfes sfaDtrxmoot4tlxnmfciasfs uln o;t4alxnif3iy1optrluei;t0 rxr(r nydalt mfvt s srtm(mp;u0oet  ieiaslaDuau pnt0aexrif ia1fa r n i t)texoxmpiu1lm elfct s)srtm(rp;t0olxnmicilslsDrauvp u4 exoifciy1lmDeauesl( s2trir3ny4amtemfes t  Dtmxmo;u1opx  ociyd a2ulu sn(0treomo oy1fpDeaivsl(0tetr(r3io1lpeelnes s)a2rm(m ;t0teto o3tlsla2emnvp t0 exnio3ia1fa eau i;s0teuoxo3oo1op elfcia( aDtaxm ot1aet  fciyt s2ran snt0 lxoxo3oo1oa rluvs;t t2tmir3oodlmte ivsl()a2taxrp;u1apeoio3tls s rm(vs;t)trtrircootop  aivslt)s2toim iu4ap nlneslt) 2ua(  ot1alx  i3iys s2rm(vpnu0arermfciadomtrln sls0s2uoim oydlme lfvta()artaxrpoo0aex  ocildfm2eln snt0 ltomfctotoaD  neo;t)t2xrxm3io4lme  fctls) 2taxrpnu0tltnii3iltfsDel(mo;t0trenmo3totfa raieilt0t2xrim3ny4lmt lnes () 2rrur nt4oetoioctyd s uaumsnu)alxoir3tatlm r ivo;s)texoxrpoo4lmtnmfvsl(  rur(m nu1tee ioeilsfa2rl(monu4 rtoxrcoo1fatrai ils) exmim3ou4amt  fvsat)a2tr(mpou1aetoifctldls2um( o;(4arerxr3ty1lmD au s;t t2uoxr nu1omtnlnvi tf Drmxrooo1tetomfciadlm rau s;u)trtrifcty1oaDeln s;t)srtr(opoy4lmtemnetl() Draump;o1tlt mociydfa eanvs t)aetomr3iotom rlues s0 rxmxm nudlltnmfetlsfartm(mpot1aeto ietysfmDulu s;(4areomr3oodopteaueilt0s2uoir3ny4apee nvs tfarrr( pno1tpe  fciydla2umuvsnu0alenio3oa1lpDelieo s0 2tmim3no1ll  lictl(faDumx onu1olenmoctydls emu snt) rermo3ty1fa e ivs;() 2toim no1apt  ncs sfsrumurooo4optoif3iyd mDuau p t4aeeoioctytfm elu s ()trurxr3nu1lmtelnes t  2rmuront0ale  o3tlslm2ra(vs u) ltoio3oatop   nvilt0 2toirpou1lp nlfet s arrmxrpot4apenif3tat s2rmnvo;t0 exrifctodlm rlnvs;s)t2xo(m nu4lmtemfct s  2tr( p;t0ale ioeiltfm umnmo;(4 leomrctytlpD anvs;s trtrirpno1lp   fesls)srumxmpnt0tpxoioctadlm eln o u)artrmf oa1lat  nvols t2trim nydaptn netlt)aDtr(moou0altnifcias a2ran s (0trtnif iytoatean s;s0sexr(m io4omee ncslt)s2umxm ot1oeeniictadlaDemuvs u) rtoifctotoatr i o;(  eurimpio4lp e nvia() rrr(rp;t0opxomictadfmDel(vpnt4trtrxf oatlpt  ueo s t2urxr iu1oltnmfct sfsDtm(  no4tpt  f3iys m2umuvpnu4trxnmr iytfmDe nvi;( s2xm(o3iy4open fcia()s2tm(r no0tlt if3iysls um( pn(0arenxo iotomD auvi ()tetr(r nu4lme mfci s arrrx ooo4opxnmoeiasfa elnvs u)tlerir oo1fate neilt  2um(o iydlleemiet sfsDurxrpno4aex iicildlm2umnmp;u)trenmo3ootom r nvils0 eum(r3no1ale mivilt) Dumum ;o4tetomi3ildlaDran p;t4trtoxo3iy1oaDraues;t) 2xmxr3ou4amtemfeils)aDtrxmono0tpx mfciatfaDum(vsn(0 eeomo oytfm elu s;t0 euoimpoodlme  nvs tfa2urxmo;t4tpx iictlslm2emn o;t)texrif3tydlmD lnvol(  2xrimpoo4op  lnetas) 2umumpnt4tpeo ociysfm2um(von(0aetrxf3oadlp ran s;()trumim ou4llen nei s s2tmu  nt4oltnmo3tlt a2ulnmsnt0trerifcoodlmD  nvsls srtoiopoydlm nlieil(f 2rmxmpnu4olenifcildlm emnvpn(0aetnmf iodlm e u s t trtr(r no1lptnmieias) Dtauro;o1aexnioeiydlaDulu o;u4trxnmo oytom   neo;t0texo(m3iu4optnmfvt t) Dtmur ou4tleoii3tad s2emnmonu0tltoxf3tytfatr ivil()trxoir3nu1ome mfvi (fa2ur( p;u1aet ioetld a ua( s t)arerxoctotlm   ivo (0texoxrpiu1ome lictasfa2rrx  oo4alx mfeias s2uau o u)aetnxfcty1lp elu o t setrxr ou1om elfcslt a2ua(mooo1olx mfcilt s2rl(vp t4alxoifcootfa raieilt)teurio3nydolte fei (farrrx  nu4aptomfciysls ulu o;t4 etoxocootoa  ai ol(0 2xoirpoo4lp n ivtl( a2rru pnt4ope mietadlmDemu s;(0 rxriociatoaDr i o;s srxm(o io4opeelneta() rumumo;u0tpxo ociyslsDelu o t4alxnmo todomtraivol()srtm(opoo1llen ivt (fsrtaur ;t0tptniocias sDrlnvo t)arxnircoydom e neolt)trxrim oy4am elnci t  Dururo;t4tpeomfetlt s rmnmonu) etnmr3iodopt li o t srum(r nodalenlfeia( a2rmumpot0tlx if3tyd aDem(vsnu0altoxociytoat  ivi;s  rurxm3oydoptnmiesls)s2uauronu4tlx  ieiytfm eauvonu0trxrmr3iytfaDe iei ()srxrxopnydopt mivias) 2trxmo;o1tlx  fcilsfmDuluvp t0artrmo io1opDr i il( trumim nydlle mfct tfarurx o;t1tlxniietltfs2emumsnu0 lxnmrcoodom eai o;(0trxo(rpiydalenmnvt tfsruax pnu4opxnmoctltlm2rmuvsnu) lxnxociytop eau s (0trxr(mpiy1ol n ieta(fsDra(rpnu4ope iieiytlmDemnvo u0 exnxf oodomte i sl() etr(m oydoptnlfet t) Dtmxmpot1tltoiociydfaDem(vo u4 lenio3to1fmDeanesl(  exrxr nu4lmeelfetl(f rtm(rpoo0opxo ictls s rluvo t) exnmo iytfpteanes;s)srurir no4lpen ici (f Dtrurpnt1tptnioeiadlaDuanmp;t4tlerxf3ty1lp e ivols)texrxo nodlleemfvta(f 2raurpou1olt mfetltfm rmuvp (4altrir3iadla  luvs s0srtmxm ou1altn neta() Dtr(mpou1tpe  f3iad s2uauvp;u0trxnmo3oo1fpDraieilt)srtrir ou4lme lnvilsf 2umu pot4tleomfeilsfm2emn o;()treomr tadomtr n o s s2to(rpoo1op e fctls)arrm( o;o0alto fcild a2uanmo u)aexrir3oytlmD lnei;t t2xoxrpiydlp n nviltfaDrr(m no1tpt mo3iadfaDrluvs;u)alerxr ta1lm  aueo;t trtmxo iy4lm  lfcsltf ruaxr no1opeo fcilt sDumnvp;t4 etrio io1lpDr i o;t0sexmirpoydlmenmnetls) 2rr(moot4tptnii3iasfm2em( sn(4arxnmf3ootfmDrluvo t0trxoiopnudlpeemnvtas) 2ra(  ot0aexnif3tatlm rl(msnt0tltrifcta1fpDranvi;()trtrxr3oodopt mfesatf rraxmpnt1alxn iciytls2uau s;u4arxrmo tadlp rluvi t  2xriopoodomee fet t)aDtru oot0oet  fciad s elnvs (0 reomrctatoat ai ol( s2xmim3nudol   nctl(faDrmu pot1oetniieiadls2ua(monu)tetrmr oydlat anvs;s0texmim io1llte ies () Drmxr oo4tptomi3tasla ranvp;t0 etnio3oy1la   nes s srxm(opnu1lmtemieslt)srtau ont1oltnmoeiasfs eanmsnu)aexrxf3ty1lat  i o;t trxriopnu4olt  netat) Dtmxronu1aeenmoctad s2rluvp;t) lxnxo3totopD  ueols  rxo(m3iy1lpenmnei (f 2taxrooo4tpe  fcilsfmDea( s (4trenmfcio1optranvol( t2urxm3oodole mfvi ()srtmum ot0aex  oeiaslsDemuvs;u)trerxocoy1lptrluvols0tetmxr io1llt  ietls) ruaxm nu1opxn octatlmDemuvp;t4 eermo iy1laDe ivi ()texmir3nodapeelfcia(f 2uaxr ot1ole ii3tatfa2ean s;u0aeerxf ia1la rau olt trtrxopiu4apt lfesat a2ta(rpoo0optomi3iytfaDumu s;t0aexnif to1fpt  u ilt)tetmim3oy4llt  ncs (  Drr( p;u0tpe  feiytlm uanvp;u4 rerio3ia1fmDrauvil() rtoxr3iu1ll emfct sfs2rau  no4tltoifeiadls rmnvsnu4trenxo3iydlp  aiei;t  etr(opoudam n ict ()sDrmumo;t0tpenio3ild mDrm( s ()aetrif3oatfpD anei;t0 2tmxopiodomtnlnei sfaDuaxm nt0aeto o3iys mDrm( on()aetrio3totom eluvi;()s2ur(rpoodom n nctl(farurxmpnu0oetoifetydfs2emnmo;t4arxnio todfatrluei (0t2xo(m3oo1llenlfetatfa2urxmpnu0tpt mfciasla2ea(vsnt)texnxr oa1opteaneo;(0 etrimpnu4oltn fesl( srurxrpoo4oexomfciaslmDrlnmo;(0trerxo oatlpte i i t0 ruoxrpno4opeemfciasf Drmxrpnu4tlxo oetyt a2ul(vp t4aeermf oytoat lnvsls0sexm(o3iudaleemnesl(fa2umxmpnu4tlxnii3iydls eauvp t4 etnio oy1lp eaueo (0s2uoxm ny1ap  mfct ()sDumu onu1alxn i3tls mDum( o;u) rtoif ty1oa elu o t s2uoir oodomtemneil( sDtmxroou1tex  ociysls el(vpnu4trtomf3to1om rln s;( s2xmim oy1amt lictl(faDrmx p;t1aeenii3tltlm raumo;t0artrir todlmDr ueo;t texm(m3nudaltemnctlt  Dra(mp;o0ope mo3ils s el( o;u) rerxf3oo1fp eanei;t t2uo(r nu4opt lnvil(f rraxrp;o4aleo feias s raump t)trxnif tadfaDeanes s tetmxm nudol  lfciasf Dtmxr ot1tlxn fctasfs ra(mp t0artoxo iadfpt lnvsl()teumxm3no4am  mfvt (f Drmumo;t4tlt  fcilsfs2rl(vsn(0aexomr3totop  aues t0srtmxrpiydameemnctls)s2rmuront1tpxoifetat a elu p u4 lxnxr3tadoptr nvi s)trur(m3oy4lmt mncia(  Dtrx ono4oex  fciyt s elumo ()aleomf totla  lneilt) 2xoiopnu4lmeelici t s2raumoou4tpenmf3iltlsDrln o;u0 lxoxrctatla rli sl()trtrxr3oydap n feslsf Dumurpnu1openmi3iad m rlu s t)alermo to1faDrluvsls) euoxr3oodamenmiei (f Dua( ono1oeeomfeiat m2emumo;(4aeeoiocoytfa eau s s)srur(rpio1oltnlneslt a2rrx pot1oleomoeiltfaDem(vp t)alxoif3iadlptrli i;( srtrxr3io4ap nlnviasfs2tmu p;o0aexnmoeiadfm ea(vsnt4alxrxo io1oa r nes;s)t2trimpiy4llee ictlt) Dum(mpot1oetnifctydla eau o (0 lxoiocoadlaDeaivols)texrim3iy1lpte nvs sfa2taxm nt1aee mi3iytfs emuvonu0texoifciatlmteau i (0s2trio nydlm  mncs tfa2ur(r nt4aetnmi3tysls uln onu0trxrxfcoo1om e ieo ()s2uoxm iu4lmt  ivtasf Dumxrpoo0teeoio3iat a raums;u) etnioctotfpteaiesl(0t2xr(o3nydap emivs t sDua(m ou1altnifciytfs2rmuvpn(4aeeoircoytla  luvi t0srto(m iu4op emnctas  Dra(r ;u1olx  oeias sDeluvs u)texoxo iotfp rlivo;s  eum(m3oy4ol nmfcsasfaDuaxr no4opxo octlt s2elu o ()texnmo oytfptrli i;s)srur(r3ny1apeelfvt s aDrau  oo1ape mfetadfm umu s u0altrxo tatlat lnei t  2uoxr oodoptnmicsat)s2tmu  nt4oexnif3tys s2rmu pnt4 reomo oatlp rliei t0s2xoxm3nu1lmtn fetlsfs2um(  nu0oeenif3tys aDelu sn(4 etrmr3oodfmDrli o s) rxrio nydapt lfeiat sDtrxr nu0tex mfetytfs2eau o (4 exrxf tydop rluvs t) 2xm(m iodll nlici ()arurur ot4oetnmf3ildfaDrmnms t0trtrxf iydfpDeli i;s)srum(o3nodomeemivt ( a2rrx pot4tltnmfetyd a2ra( o;() ltomf3oy1faD aneo;t)s2uoxr nodole mncsl(fa2tmx p;u1apxo feilt m rmuvsn() eeoirctotoptranei ( t2toim nydlp e icslt) Dum(  no4oeenifctat aDumumpnt4texoiocoodlaDr ieils0 2uoirpoudam emictltfarraxr ;u1opt io3tytlm2ul( o u4artrif3tydlm e nes ( teum(opou4lltemict t)a2umur oo1opxoii3tlsfsDrmu p u0aleriociadlaD  nvo s)srxoim io4lme lici (fs2ur(mp;o1texn fcilsls2elnvpnt0 renmf ootlm elnvils  2urir3iy1altnlneiat  Dua(ro;o4oexnmictasfmDranmsnt)tetnir oodfm rluvil(0 2xrxm3nudolen fcsl(  Drr(rpot1aeen ictad s2um(mo t4trxoxr iatlaD aies;()seur(o nu4omtemivtat) Drrxm no0oetnif3iysla elnms (0tlermf ia1fmDr u i;( setoxr nudaltnlfvia(f Dur( ont1aet  oeiyd m2rl( p ()teeomf oytfm  auvo t0tetr(mpoy1altemnctl()aDtmur ot1aleomieiys mDean s (0trtoir3totomDeauvi;s0 rtrxmpio1omeelnvils)sDuau p;t4tlen ocils s umnvs u4arermo3oadoatr i i;t) rxr(o iydll  mivilsfsrtaxronu1oee  ociytlsDelu o;u4tetoxf todlptr ieolt0 euo(m oo4ll n icil()aDum(moot4teto ictas s2ulnmp;(0trxoxocootlpD liei s  rxrxmpiy1aptnmnvilt)s2ta(moot4tpxomociydfaDran o;u)aetrir oadom rluvo;(0texoio3ou4llt mfvs s) 2uau oot4tle ioeiadlm um(monu0 rxoxrciy1laDranvs (0 2tmxm iy4lp n ivs () ruru pou1tet mocildfs2umumo;u0altomr oy1fmDe ueo;t0s2xoxm3oy4olt mfcsls)artau  nt4alxo fctltfs eaumo u) exrxocto1fmD lies;t)srxrxo oo4lpte fei t)a2ua(  nu0optn i3tlt a2umnms;u0tlxnif iotopDrauvo;s  2urxopoy1lmt mnvs (f 2umx  oo4olx if3iltfm2rau s t0aeenmr3io1op elueo;( seumxmpnu4oltn nciat  2rrxrp;t0alx  octldla2rln o u4trxnxr todfpt  uesl( t2xoxr3ou1lmtnlnvt s s2urxr ou1tex mietadlm el(vpn(4 exrio3ootfat lnei;s  2tmim3io4lm  lnvi t s2umxmo;t4altoif3tlslm2rauvpnu4arxnmo3ia1lpt  nvs s0s2um(o iu4ope lfctl(f Dtr(r ;o0apt  fetld s eaums;t4 etrmo3todomDeai s t0tetmio no1lmtnlfeslsfs2raxroot4tpxo f3iadfm ulnvs;u0 rtnio ootoatrau olt s2uoim3iu1am  mfvi () rum( o;o4oetoiociydfm ulnvsn(0 rtrmo3iatopteaivi ( srxmio3iudlmenlncsa(  2rr(mpno0aeeo o3tldla rm( p;u4 etnifcoatlpD lueo (0texoxr ny4om n nei sfa2rau p;o4tpt  ocilsfm2em(vp ()trerxrciydfa rlu s s0truo(o iu4lptnmfcsl(f rrrxmo;o4apx mo3ilslm2rmnvs;t4tleoxf ty1fa   n il()trum(o3nu1ll emivi ( srtrum nt0opxoiieiatlmDulnvonu4arxrxo3iy1fa eanvo;(0trtmim3iudoptnlici sf rurxmpot4ole  ociasls uan s;(0 rtnxr iatlp  lnei;s0sexoirpny4lpte nvt t) 2tax  oo0olx  f3iatfm eaumo;u4aleoxr3tadoptelnvslt)trxr(m3iu4ll e nesasfs2ra(rpnu0olxn i3iys a rl(mo (0 etrmf oa1lmteln o;() rtoimpiy4ap emnetatfsrraum ou4apxo ociyt s ran s t0treoir oydlpD ln sls) 2xo(o oydlpee ncsa(faDrm(moot1oexomictatfa2emu p;t) etoiociytlaDe ueilt)tetm(rpoudopt  neilsf rtmuront4tlxnifeiatlm2ran snt4tltnxrcoa1fpteaues s) rxo(o3ny4om nmnesl(fs2urxr ou1oetoif3tys aDem(mo;(4arxoxfcoadlm  li o;(  rxoim3ny4opt  icil(  rurx ont0oexo fcilslm2rl(mo;u4 eerxr oy1laD ln ol()t2tr(m3oy4apt mfesat arur( pno4olx mieiltlsDrm(mon(0aexnio oodomDran o (0 rurxrpoodamen fcsls) 2urxm nt4ope  o3ils aDea(mp u)altnio3totoatrliesls) 2umxo no1lpeelivsat arrmuro;u4aee ii3tatlsDraums (4trenxf3iotomDrli i t0sruoim iodlpeemfcil(faDra(  nt1oet iieiytfm rlnms;u0tetrxo ty1omD  nvs () etoim3oudlpt lfet sfa2tmuront0apeomieiytlm2um(mpnu) leomrctytom  ai s;t) 2toir iy4ole mnei sfaDururp;u4alxomfctasla2emnms u)arxrif3ia1fpDrlieo (0trur(mpiy1lltn nesat)s2tr(mpou1olxomi3iatfs emnmsnu4 ltomrctytlmD lnes;s srxmxm3ou4lle  fet tfa2urxmono1tpenmfciyt sDuaumpnu0 rxoxo oy1omDelnvs s)s2ur(opoydll n fvsltfaDtru  ou4aptniictldlaDuanvs;t4 eerxf3iodlpD lu ils t2toim ny4olenmfvt sfartrx oou4oetnmf3iys aDrlumpnt0aetrxo io1faD lueo;(0srtrxo iu4lpt  nci s a2umxr ou1tlxn ociydfs rl(vp;u)arxoxf3io1fat luvslt0 ruo(opiu1ap emncta(f Dra(  nt1apen fcilsls2rmnms;() etoxfciy1optrlivi;t t2umim oy4alen neia( s2tm(  nu1tlx ioeias m rmnvpnt) reomr3iotlatrauvi;t) rxmxr3no4lle lnvil() Dtr(mpot0apt  oeiadls2umnvs;t)tlxoif3ta1oatrlnvols s2umxrpno1lp nmfcsl(f ruaumo;t0tptoif3tlt mDelumon(0alxoxocta1fa r n i t0 etoirpiydll e nvsa() 2raur ;o0teenmiciadla rauvo u0aeeomr3tatlp   n i;t tetrxmpny1ol nmicil(faDtaxr nt1olxnmociatlsDemnvon(0tlxnirctadom r i s s) euo(o iydomtnlivsls)a2rmxm ;u4oltnmociltla ua(von()trxnxrctotlmD  ieolt0texo(r oodlmte nes ( a2ta(  no1altoio3tadfs umnmpnu0 eenmrcootoaDe uesl(0srtoirpou4am e ici ()s2tr(monu1open ieiadfa2em(vs t)tlxrifctytlat  ivo;( seurir nydlp  mncs tfsrrauroou4oex mfciltlm elnvp;u4alxrmf ty1op   uvo;t)t2uo(opno1omtn ncsl(  Dtmx  ;t1oee ii3tls m2eau o (0alxoio ia1lpDeaneo ()t2umim3ou4apt mfviatf 2umxmp;u0tlxnmfciyt s elnvp t0aexomf ty1fmDranvslt)s2umxm3oy1ll elfesl()s2uaxrono4ole  o3iysfm2uau s;u0tlxrmrctotfmDr nei ( seurxo oydop nlncia()aDrmxm no0aeeoiiciadfmDulnvpnu0texrxocio1opD auvo s)s2to(o no1ap elfetltfa2trxrpou4aet  ietad a2raumonu0aetomrciy1lp e uei;()srurxr ny4olt  nvil()aDrrxroou1tpto iciysfs2ra(vp (4altomr iatlm ean o;t0 rtrio3iu4ame lnei sfs2urx p;o0tpenmictysfs2umu pnu)trenmo3tatom elivs;()texo(o io4ap n fetatf 2umu  ot1oeenifciatfm2eaump t0texoir3oatfp   ieils  2xo(opou1am  lncslsfsrra(r ;u0altniociydls2uaumon(4texoiocoy1lm   u s ( s2xr(m iodomt mnes s sDrmx  nt4tlxo iciysfsDeluvo t0tlxoif tytoat aivo;(0 rxmirpnu4amt  fet s aruaxmpoo0oltnmoetls a2raumo;t4teenxf iytlp   i o (0 rurio3nu4lptn ncs ()s2ua(  nu4tle mo3iaslm2eluvsnu) eeoxo3io1oa e n s;s) 2trxm3io4op   fctls)aDurx o;o0ole mo3tatls ranmpn(4 ltnio io1la eaivo;t0srxo(mpno4llenlivsl(f Durxm nu1aee moeiydls emuvo (0aexnxrcty1lptelivo ()sruriopiydlm  lietat) 2rrur nu1opxnmiciadls2emuvo;u4arxomf oydfm eaivol(  exm(mpoudoleemieias)srum(  nt4teen fciysla ea(vonu)altrxo3tytfaDe uvol( t2umxmpio4omenmnetas) 2tax pno4oetniociytlm umnmo;t0aexrxfcia1fm elneo;s  rtrxrpio1amtelnvt t)srraurp;o1tpxnmfciys aDua( s;()aexomrcoadoaD lu o;t trxmio no4ll  lneia(faDtmx poo0tetnmo3iltls ra( p (4trerircto1om   ivol()s2xm(m3nu4lle  fvta()aDrax o;u1tltomietytlmDumnmon()texoxfcto1lpteau o;(0 2uoiopoy1lmen ivtl(f Dra( o;o4tpe mfciysfs2ra(mpnu)texnmr3iy1lm e nvo t0 exo(r3no1ll nmfcia()s2tm(  ;u4teen i3tadlm emn pnt) etnmr oatoa e i sls0texo(opiudome  fci t)s2ur( oot1alto oetasfa ulu p u0aetriocta1la r ivi;s0seuo(r3iy1lp e iet (faDtaumpoo1oleomi3iadfsDumnvs u0artrio3oy1fmt aneslt0s2trio3iydlp nlnvi ( s2rrxmpnu1tpx  o3ild a em(msnt)tltriocoytoa  auei;t0 2um(r io1omeelnct tfaDtax o;u0aleomf3iysfsDul(mo u0altnif3oytopDrauvolt texr(mpny4ope lfes ( s2ua(m oo0opxniiciatfa el(monu4 lxomr oo1fptrai slt sruoxr oo4opeemnvsat) Drmxro;o4aetn fciydfa uauvs t0 exoxf iadla r i ols) 2xrxo3nydopeemics (faruaurooo0olt ifcilsla rm(vp u4 lxnxo oydlmteli s;() rurxm3oo1ape  nesa()aDum( o;o0opxomociys s2rln o u0 eenir ty1lpt luvi t0 eumxm oodomen nvi s s2taxmont1aetoifeiyslm rl(vp u0trxrir3oadopD aiesl()s2um(rpoodllenlies (fa2tax onu0alxoio3tlsla2rmuvo u4trerio3ootom r nei;s)srxr(r3iy4aptelneiasfa2trxmonu0tlx mf3iysfs ean p;()tltnir3oytlm ranes;t  rxr(m iy4ape lies () 2tru p;o1alenmi3tls sDuanvsnt4aeeoxo3oodfateaieol()srur(m3nu4omtemivils)artrurpnu4apxnioctad a elu s u)tltoxr3iotfpt aies;s0trtrirpnodamtn ici tfs2rrxmo;o1oet  f3iadls2um(vs;t4 lenio3totfateaueil(  2tr(rpny4amt licias s2ra(ro;u1tpt ifctatls emnmo u0 rtrio3ta1oa rlues ( t2toxrpnu4ll   fetlt  2rrxmpot0oleomi3ildfs emu s u0texrxo3totopDr n ol( s2xo(m3iy4lm nmnctlt)artau o;t1alxnifctls aDumu pnt4trxrio3ta1faD anvs t) 2xmxrpoy4oltemnvta(faDtau o;t4ope  i3iadlsDeluvo;u4trxrxociatfm rli slt t2uoxm nu4llenlfviat)sDtaxro;t1tptnifeiydfm rluvpn()artnxf3oydlmD au s t srtoxo3iy4ap  mfciatf Dta(rp;t0oltomf3iyd sDem( s u)texnir iy1fpD  iesls) rtr(m nudllte fcta()sDrrxro;t0tpxn feilsfs rlump;u0 etnmf3ta1lp eaueils)t2toio io4ll nlfvilt)a2urx  ou0texniieiytls2umnvp;u)trtoxf3iytla rli ils0 eurxopiy4ap  lfeta()s2ta(  nu0tlt ifctydla umuvpnt) rtoiociadfmt  i o;t) ruoxrpoodlp  livil(fa2rm(ronu4tlt mictysls rlnvo;(4 rtnxf3ta1faDrlivsl(0 etoir3oo4ll nmnvsat srraum ;o1aetn fcias aDumu s u)texrmr iotomt au s;t t2trxr oydlmtelicsat)aDtr(roou0texn ieiltfaDel(vs u)tlxoxo3totfmt ai s () rur(mpnudom   fctl(  rtrxr ;t0tltnioeilsla rlnmsnt0aleoio iadlm  aivo ( srxo(o3ny4lmenmncsls srtaxmo;o0aleo o3ilsla2em(mo t)tltnmocoodopDeanvo s sexmim nudopeelietlt s2urx poo1ole mietyt s um(mo;()aexrmr3iadoate i i t0 2trimpoo4lp emneiat)a2umx  no1ope mictatfa ra(vont) etomrcto1lateln ilt)srtr(o oydlmtnlivil( s2rr( pno1tpxomf3tytlmDeanmon()arxnir3iadfa  aieolt srxmxr ny1ape lneslt aDuaum oo0aleomietaslaDum(mo;t4 rermr iydfm elnvo t trxmimpou1ll   nesls)s2uaxm nt1tee mi3iys s rmu p t0altnmf3totopDranes s0 etrxm ou4omee fct t) 2tm( onu1tex mocilt m elump u4trtnir oytfaDe uvo;s) eurxr3nydlpee icsas artru pno0aex ioctld m2ua(vo (0tltrmrcoatfptelueo t0t2xrxm3oodal emncil(  2uaxrpoo0tlxomo3tyd m2eauvs u4aeenmo tatlaDrlnvi;s)s2xrir nudoltn fcs t aDtr( poo0opeoiieiadls2eanvpnu)aexoircto1lat lieo s0s2toirpio1omtemfei (  rurx  nu4tpxnif3iyd aDulu p;u0 eerxo3tatlmD aivo s s2to(r oo1lptn ivt (f 2rru p;u0aetnio3tlslaDuanmpnu4 ltr
\ No newline at end of file
@@ -0,0 +1 @@
+ieo t0 eumxo3iu4omt  feilt artaumoot4oee  ietys aDean sn(4tltnir tatopteluvils)srtoirpny4am nlneslsf Dtrum no4tetniictydlmDrmuvpnt4 eenmf tytoate nvslt setmxr3ny1am  mivtls aDurxroou4ope ioeiat mDrmuvsn() lxomrctodlm   n sls0srxm(r3oy4opt miet t  Dtr(ronu1opxoii3iadlaDrlu pn(4 lxnmf oy1opD luvi;t trxo(r oydame mfeta(faDrm(  ou4oex io3ilsls ran s;()aetrmrcoy1opDr uvo;s srurimpno1ome  nvtlt  2umxrpot1tlx iiciltfa em( pnu)tltnioctotlmD au i;t t2xr(r3iu4lm nmieil( a2tmxmpot4tptoio3iltla2rlnmon(0trxomr oo1op elnes;(0 rurxo3iodlle lfvilsfs2raum no1apeomf3iltlsDrl(vp;u0teenxrcoadlatrlies;t0srxoxm no1ap elnvsls) Dra(mono1opx  fctadlm2rmn snt0 rxrxo3iotfpDelnvsl(0 euoxopnydlp  lfcsatfsDtrxmpnu4opxoiietlsfsDul(ms (4arenxr totop eauei;(  2ur(opiy4op nlictl( s2umxm ;u0apxo o3ias s2rl( o;(4arxrmr3oy1om eai s;t0t2urimpio1lpenlncia(fsDrrurpou4tex  i3tytfa uaumont)tetoxf3io1oaDelies;(0trur(rpnu1olt  fcsls  2urx pnt1teeomietaslm ulu snu0 renir3totopDeln s t0trxm(o nodom nlfcs t  2ua(rpot1alt iicildfa umuvsnu) eeoxo ia1om eaueil(  rtmxr oo1ale mfct s)a2tr(  no1oltomicilsfaDrmump;t) etnmf iatlmt lueo;s0 2uoxo3oy4lm nlici () Drmxmooo0apxoii3tltfa umu s (4 reoifciadopDeln o ( srtrxm iydlp   ics t) 2urxrpou0apt mfctad a ea( pn(4alxnxo3tydfmDrauei s0 eur(opiodam e fvtat)aDrau  ou1alxnii3ild s elu s;t)aetoxr3iytfm elieil()trtrirpoydale lieilt sDta(mpno0oeeomicildlmDumumo;u)trxoxo ta1fa rai olt0 rxoirpny1lm elfvt t sDum( ont4alxn i3iys s2ean s t) ltnxrctytoa rln i;t)t2to(mpoo4ol n ivslt)s2taxr ;u1oex mo3tatla el(mp;u)aetnxf3oadopDelieo t)tetrir oy1ll elfvia(  2taump;o0oexnif3tyd a2rmu s;(4alxnmr io1fpDeln s;(0s2umir ny1lmtnmfet tfa2ur( o;t1alenifetlt a uauvs t4 renio oytoaDranvi;(0 exrxm oo4lmee ictlsfsDta(ront1aptnmfctldfs emu s;t)aetoxfcoytfm   uei s0 etrxrpiy1apen ies (  ruaxrp;o0texnmociltfm ul( on(4 etnxocoadomDraieils)s2ur(mpoodlmenmiei (  Dtm(m ;o4oetnmiciysfm2rmn on(4 ltnioctytop eauvilt0s2tr(opiudlmen nci s)sDtmxrpou0alxnmo3ildfs rauvpn()arxnxociydoaDe i o s)t2xoxr nu1lm elnci sfarumxm ;u1altoifcildfs umnmont0 lxomo todlpDrluvs ()setoxo3iu1lm  mnct ()sDra(r ot4apxoifcild m em(mo;u4 rxnxociadop eanvils srtoxm3iy4alenlfcilsf 2ua(r nu4ope if3tad sDulu o u)aleoxfcia1fa eaneils0texmxr oy1omte netatfartrxmpnu4apxn oetysla elnvon(0 rxnxr iy1opDranes;()seuoir iu4ope mfcs t)artrx  ou1tee moctys a2eln p;t)tetomo oodlp  an i;s0trtr(rpny1lmtelnvia( s2rrxrp;o1aeeo oeiytfm eaump;t4aleoir ootlpte n il(  2xmxmpoudapenmietls) 2raxm nu4oleomoeiytla em(mo t0altnifcty1faDeanvo (0 etrxr iy4ape lictls a2ua(ro;t4aptomfeiydfm2uauvs;u4treomr iy1oa  li s t0 exmxm oudlpeelfctl( srtr( pou0ale io3tat a2ul(vsnt)aetoxoctatfmt lu o t0s2uoir iu4ol nlnvt ()sDrrum ;u4alto f3tatfmDuaums;u4teermr tytlm  lueo;t srtoio nu1apt mneilsf Drrumpot0tlt  octatla2rl( p t4alermfcia1fateaieslt)teur(m nodap   nci s sDurxmoou0apeoii3ils mDrm( o;t0altomr to1lm eaies;t) eurir3oo4lm elnvslt  2umx  ;t0apt  fciat sDrluvpnt0aleoxocta1omDeanvs (0trxoxo oodlpee ivia(  Dtmx p;o0altnioeiydfaDeln sn(4aleoxo3oatlm raivil( seur(rpoo1amte nvs s)arrmumonu1tpen i3iasfs2rl(mo;t4teenio3iy1lmteaues;t0srtrxr iu4amenmiei s) 2rau  ;u1tle miciys mDeluvp;(0aexrir3oadlaDeluvols0teuoim3nu4ol emfvtl( a2ra(r nt1altoiictlsfa um( pnu0trxnircoo1lpDrluvsl( teuoxr ou1opeelictasfarumxrpoo0tleoioeiytfmDemn o u)alxnircta1op elu s;t) eur(m oodopee ivsas  2uauroou1opx moctys a2eauvp;t0tlermf3ta1lptr uei t)sexr(m iy1optemfcils sDraxrpnt4aetn ieiyd m2ul(ms t4aetnmo3oatoatelnvs;s0 rxr(r oodap  livsat)arum(ro;t1oleoiietyt sDrm( p;u) lenmr3totlmt aueols  etrir3nodapt  iviat sDuaxroot0optoifciydfa ul(vsnu4tetnmocto1lp  aneo s0teurxr ou4llen iet s)a2rmxm nt4ale  fetlt a2rm(vsnu0tetrxf3ty1lptelivsls)s2tr(rpnu1amen nvtls)sDta( onu1oexomieilsls2elnvs t0texnmf3iatlmteai o;()seto(m nodaptnmfeiat  rtrx p;u4tlen feiatls rluvont)tlermr oadopt anesl(0 ruoirpiu1ap nmicsa()s2ur(mpou0tpxnif3iatfs2umn o;u0altomr todfp rauvi () 2xmir3nu4ap nlicsas)a2ur( oot0oeen ocilslsDran p ()aexnxfciodomteluvil() etmxr iu4am e ncta( s2umxr ot1tpe ioeiasfm um( o (0arerxr oydfptrlieo () 2tm(o nu4lp e ivi (fartaum ot4apeomoctlsfs2rm( p;u) lxrir3tytlaD livol( seurio3iy4olee nctlt)srtmu ooo4opt mfeilslm2rl( s u) lermfcia1lm rli olt0srur(rpiu4op emncils arua(mont4teenmiciyt m2ulumo t0 lenmr iatfatrluei t srxoir3ou4omenmiei ( srrmu ooo4aeeoifetadlmDeanms t4 etrmr ootfmtrln ilt t2xoirpiu4ap n iei t)s2ra(rono1aee mieiyt m uln s;t4 eerif oa1om eaivi ( trxo(r3oydam nlivia(fsrtax p;o0opeomoeilslm ea(vs u)tetomr iydfm rlnei;s0srto(m3iodamenlfvils) rua( onu1oetnmfeiatfaDrlnvs;t0 rtnir ootlpteaivo t0seumir3iy1lpt  fctls)s2ur(m ou1tpxomi3iysfa2ea(msnt)tlxrmf ootlptelnvsls)t2tm(o3oy4ome licsltf Dtrurp;o4oltoif3iytls elnvs;t0trtomrctadlpte ueols0 rumxopnudlltelncsas)a2ur(r nt0oexn iciydla2emuvp;u)aetrir iotop r i s;(0 euoim iy4lmeemietlt  Dur( p;t1oee iiciadlmDrlump;(4artoxrciatfm eauvo ()seto(mpny4ll   ivta(fsruax  no4texnii3iyt s2el(mont) lxrxf3tydop   u o t trumxr oodlmenlfctls)aDrr(  no0oeeomoctaslm2eln p;t4 exrircta1omD  uvo;s)sruo(o3oy1omenmivta(fa2rax pno4tpx  octydfsDeanvpnt4 rtoxf oa1op elivi;s) rum(r iodomtn ivias s2ua(mpnu1alt mfciysfm ua(vpnt0trxnir todlm rlu o s0setoxr iodlmtelictasfaDtrxmpou0opx mfcilt sDrlnms;(0trenmr3oo1oaDrln i;t0 2uoxrpnodop nlnvils a2tmxmo;u0olt ifciat s2um(vo (0arxomociadfa   ues;t0 rxrxm ny1ope lfci t arrrx ono1apenmo3ild m2eln ont0artrir oo1oa e nvs s) 2ur(m3iu1opt lnci s artaxmpno0apx mfctldlsDrau sn(0arxnxf tadlm r n i;t texrxm3no1ll nmivsasf rtrx  ;o0aexn icildlmDum(msnt0 lenio3tydoptr neo t0sexo(o3ny1lm emicsl()aDuaumooo1ope ii3iad mDuan s u0trxnio3todoaDeaivo;( srumim3oo4op   icsls srtmxrp;o4tpt  fciys m2rl(vo t)tetrxfcootla  lneols trtrxo oy4lpen nvia()srtmx pno0teenmi3iydfa ua( o (4trxnmo3iy1op rluvo s t2tmio no1omenmnvt tfs2rm(rp;u1oexo feiyd s emnvsn() lxnir tydoat lneol(0 ruo(mpiudomenlfetls a2urxm no0tpenmfcildlm2uln o;u) lerxo oodlpt  uei;s t2trim3nodap nmfeiat  rtau o;u0tetomi3ildfa2umuvsnt)trtoxo tatlm elnvo;t0 2tmxo3iy1al  lictl( a2tmu pnu4tptomo3tldfsDemuvo;(0aeenir3tadoaD aues t  rtm(opnydole  fvtls)a2ta(rpnt1alx ioetat a uanvo ()trxoifcoo1opDe ueslt) 2tm(rpnudopen nciatfaDta(mooo0opx ii3tls m2emnvsnu4aexoir3oytfatr neo s0 eumio3iudopte nvt sfsDurxroou4tlenmf3iyd aDumnvsnu4teenio3oodlm e ueo;()trurxr ny1lpt livs t)aruru ont0alxn ictldlm2uau o (0artoxo3oadfpDrau i;() exo(o ny1om n net () Dra(rpnt0teeoiociytls2eauvpnt)aeenxo iytfmtraneo;(  2tmim ny1oltnmivtas sDrrxmp;o0texomi3ildlm el(von()aleoir tytlptrauvi () rum(opou4ol emnetat a2urumpno0apxomfeilsfs2el(vonu)trtnmf3iodomDe nvi;t)setmir3nu1oleelnvsat)aDtm( ooo1alt iieild mDelump t4tltoircoodfaD  n o;s0tetrio nydlptemieil()srurxrpot0texo oetas m rmnvo;u) ltnxf3ty1omDrau o ( teurio iudlmte fvtls srtm(  ;o0alxo oetatla umu s;t4 rxrmociodlmDranes t)sexriopiy1ap nmivt t)aDra(rpno4aleoiietltla2rln p;(4 lxnif iytoaD aueols0srxoxo3ny4openlnes (fsDtaxmp;t0tpeo ictydfaDra(vs (4aeeoxo3tatfaDeaivi ( t2umxopou4lmtnmfcsl() Dtrurono0tleoii3tltlm uauvs;u)arerxr3iotomD auvo s0trxoxo ny4lp  lnvt tf rrax ooo4olt micils m2rl( s;t0 lxomo ty1fpDrlnvi t)s2trxrpio4olenlict s a2uax ooo1aetn f3iyd a2rau p t4 eenxo ty1lmDr nvils)teumxm3iu4altemnvi s  Drm( o;u4oex mf3tad sDra(vo;t0 rermr oatlaDeln i (0srxrxopny1ame lfctat  Dtaxr ou1teeomociatfm2rm( p;t0tetnxf oadlmtraiesl() etoir3nu1lmte ies (fartaurp;o0ole mo3tysla2rm(msnu) rxnmfcta1fatean sls) 2tr(m3oy4op  mnes (farta(rpnu4altomieiyd m umu s t4tlxomociytoat lueo t seumio iudoptnmicils)s2tau o;u1aexn f3ildlm elnms;(0tltrmo iadomtranesls srtr(mpnu4ap e nvt (  rumxrpou1apxomo3tas sDrmnmont4 ltnxf3tatfp   ivsl()srxmir iudol nliesltfs2raumo;u4tlx mo3tadla rau p u0trtrircoadfa e nei;t)s2uo(mpiy1oleemnctl(f rumu o;o4tlxnioetytfm ean s;() lxoir iodfmteluvols0trtoxm3io1amen fet t)sDtaxmoou1opto ieiydfs elu s (0artrmoctadoa rlneo s) 2trim3no1ol  lfcs ()a2tm(m oo4aetoiociys s eanms u0aexnxrciydlpte ueolt t2urxr iydllt mietas)srtmxmoou0aetnif3iytfm2ul(mo t4aeenircoy1fmt  ieo;s truo(m io4lp  lncs (  2rrxmo;t1apeomfetaslsDumums u)aeeoio oo1op rluvsls  rtrxmpoodaltnlicil()sDrmum ;t0alen fciaslaDrl(vpnt0trxoxr iotoatran o ( sexrxr3oo1lp elncil()sDta( p;t0apxo i3tadlmDranms;u4 etoif3ty1lptr nvi s srurxrpou1lmtnmnci ( srtrxm no4tlen oetat m um(vsn(0aeerxf tatfmt aiei;t0 2um(mpny1al e nvias) rrmxmo;o1optnii3ils m ulnvon(0arxnio tytfpD luei t0sruoiopiy1amt mfvil(f Dtmu pno4tetn i3tls a ua( s u4aeenxfcio1lateluvi ()t2xrxm3no4lp elnvilt)aDtm(mooo4alt  i3iatfs2ulumo;u0altrmr3oy1lpDrln s;(  eumim3oydll nliesls  Dtm(rpnu1texn ieildfsDrmuvs (0altoxfcto1opt au olt  2xm(r oy1llenmfvtlsf 2tr(ro;u0tlx iietadfaDul(vs;(4altrxf3ia1lm e ieo ( srxrim oudap  lfvsa(  rtmu ont4altnioeiatla2rmu o u)alxoxfctatom e n ilt setrio iudlpe mncs t)srtaump;u4tlxoiociltlaDrm(vs;t)texrir iatlmtelueils) rumir3ny4ape lnvs ()sDtmxmooo1ole ifeiaslaDra(mp (0tetomf ty1lpt  nvs t t2tmimpnudope mfviatfsrraum ot4tle mf3iyt m rmnvp;t4 rtnmr3tytop rlu slt)s2toio iydoptnmneilsf rurxrp;t0alto i3iyslaDumnvs t4 rxrmo to1fptrlnvi s) 2um(m3iodlltemicilsfarumuroot0aptomo3tltls ul( p t0 eeniocoa1omD lu i;(0teto(o oo4lmeelnvi t)s2umx  nu4texomf3iyslm ra( pnt0tltrif3tatfpteanvslt sruriopio4lmeelfet s sDrr(rpoo4alto fciytlm ran pnt) etrif iatfpt  i ol(  etr(opoydlmen fetls arrrxmp;u4olxo ociys m2ulu p;t0 exnif iadfp   uvilt)trumim3oy4ll nmiei (fsDrm(r ;o1oleomoetys s umuvo (4aeeoxo iytlpD luvi ()srxr(r oo1am emicsls)srrr( p;u0tpeniietlsfa2ul( o;(0artrxociatlp ranes;()t2xmxmpnu1optemfcs sfaDrr( o;o1apxnii3ild s ra( o () lxrmo3oy1fa eai o;()tetm(mpiu4apeelnei sf Drmump;u1apx  o3ias aDrau sn(0texnmo3ia1omtrlnvi;s)srxmimpio1lmen ivtltfa2ra(r ou0oleomf3iatfaDuanms;t4 renmo iotfaDrluvo;t)t2umxopno1optemivsa( srumxm ;t4alto fctldls ran pnt4 exrmoctytla   n i;t)t2trxm io4lptnmivils)srtrum ot4ape  octytlmDemnvp;()aeeoxf3iy1la  aivilt0t2umxopou4lmtemnetl( arrax o;t0aexnmo3iat s2elnmp;u0teerxrcoytfp   nvol(0 2urio3nu1amtemivt ( arra(roou4tlx mfeils m el(vp;() exoiocoy1fa  lneo;(0trum(rpiodamt mfcia(fsrrau pnt1olt moctydlmDrl(vo;t) renircia1fmD  nes;s sruoio3oo4lp  mfvs s sDur(r nt4ale mi3iatlsDrluvp;u) rtoif3ty1op r nvilt)teumir3iodaltemici t) rtmxroot4tlenmi3tatlm2rmnvp;(0aexrxocoo1lp rln ils  2tmimpou4lpenlnes ( artrx  nu1opx miciyd m2uau s;()artnxoctodomD lnvolt t2xrxr iu1lm  lict (faDumumpou4oeto octasfs2umnvo (0 etnxo tydopt  ivs (  2xr(r3iu1ape mnet s sruaxmono1oet mf3tadlsDranmpn() rtnir3iy1lptr neols0t2xoio3nu1ll emneiltf 2rr( o;t4oetniietadfs2uanms;u0aleomf oa1fmtr nes;s)trxoxo io1om  lietlt)arta(rp;o0olt mfciatfaDua(mont)arxoio3iytlpDeli i;t0 2urxo3ny1lptnmfctlsfsDra( o;t1teenifcias a eau ont)aetoir oa1oaDr i s t0srtoxr3iu1al nmiet t  2tmurpnt1apxoioctys s2rluvs (4altnifcto1la raneo;t0 2xoxo oo4op emics s)aDra(mpou1aet iicilt a rlu p;t4 ltomrcoo1opt ai s () rxoxopno1lmtnmivs sfartrurp;o0tet mictadlsDra(vp;()tlxriocty1op e uvil()trtrirpiu4lptnmfct s a2rmu  ;o0apenmo3tysla2eaumont4trtnxo3totoa rluvslt seumio iydoleelnctat sDtaumo;o4aetomociad sDrau o;t4trtnio totfmD  u s;s)s2uo(r3io1lptemnciat a2ur( pnt1alt mi3iadfa2rauvs;t)trxrir iotfpD lieilt)tetmxr ny1llen fvil(f Dtm(  ;u4oltomo3ilsls ra(ms t0 etnxo todfp r u ils)s2toirpiy1lmeelnvtlt) 2trx  ;t4alx ioeiyd s rlums;t0 etriocia1oa   ivsl(0 rto(mpio4ole lnesl( a2tmu  ;o0aet io3iad mDelumo;u) reoio3iotlaDrai o;t)t2tmim nodlltnmfvtlsf 2taxroot0oeeniociydfa ra(mo u) etrxrcoatoa ran i t0 2uoio oudlle lnvilt sDraum ;o4alxn f3tasfmDemu on(0tltrir iadfmD  n i s)t2tm(mpiy4alen fct sfsruru pnu1tpeniiciyt m umuvo u0texnmr3oy1om elu ilt0 ruo(rpoodaltn fcsas)aDrau p;o4tlen fetydfa2elumo;()trtnmo3todoa   u s s srtoir ny1amtnmnet t srum(r oo0aetomoctytlm2ua(vonu) rermf3oy1lpDraivs t)trurxo nudamtnlnetas)srrr(rono4tpenii3ilslmDrmnmsn()tleoxr3iodlm ranvo (  2trir3oo1ol n fcsat  Dua(mpnt1tltnmociltfa2uluvo u0 lerio3tadfmDr neo;t) 2xoim3nu4omeelieiltf rra(mono1alenmo3iaslm2rluvp t4altrif3ia1lptrauvi t t2trio iudolte neiatfsrur(ronu1olxnmiciadfs emnms;() etnxf io1fat an o;t)srxmxo3iu4alt mfeia(f rrm(  ;o1tptomfeiltfsDuln on() ltrmrciodomDelues s0 2tmirpiy1al e fvtlt) Drr(  ou0aexo i3iytlm2em(ms u)texoif3io1lpD au o s0sruo(mpiu1altemivslt)aDrm( oot0teenif3tldls emump;u4 etriocoodoatrau s;t0 2xoio no4alt micias) Dta(ro;u1altn f3tatfa umnms;t4aexoxo iotfmt ai s;s trxoim3ou1oltn ivtlsfsDtmuroou4oet mo3tatlm ra( ont)aexoxoctatop rlnvilt  exm(m3iy4apt  fvia(fa2umx pnt1tee mi3iyslm elnmp;(4teerxociytfaDrlu s;s  2tmxr oo4am e nvils a2tr( o;u4tetomictydfm2eaump u) rtoirctatlmtraies (  rto(m3no1ole lfvsasfarur( p;o1tpxomfciyslm emnvo () lenxrcoy1fmD ai o t0trumim3oy4om n ncsas s2rmu pno0apenmicild aDra(vo;t0tltomr3oodomDraivi t) 2xoio3ny1ap  lfeiasf Dtrxm ;t4tex if3iydls2eluvpn()altrif3iydop raieslt  eumxmpny1al n nciat  rua(rpno0opeo f3tltfm2em(mp (0aetoxfcto1lm rluvsls)trtmxrpoy4lmen ivt (faDta(m nt4tlt  fciyt s2rluvs (4tlxnir3iy1oa raueolt0 rto(o3oydoleemnvsa(faDum(m ou4aet  ietyt sDelnvo u4alxomr iytoptrlu olt  2xr(opio4olen ietasfaDrm(mp;t0oexn ietadls2elnvp;t0 eerio3ootfpteaiei;t)srtoio ny4ll emicta()a2urur nt0oex moctysfa2um( s;t) exrmfcoa1opteaiei (0 etmiopiodomt lfvil()s2tmxmpnt4tee if3iytfsDrau pnt0trxnmo3totoat lieslt0s2umimpiodam  mfctat s2rrx  no1tpto ieildfaDelu s u4texnmrciytlmtelieilt)t2umim iy4amte fet tf Drm( pnt1teeo ieilsfa uluvp () etnio3oodoaDraiei;s0t2uoim3ny1omen nct sfaDur(mp;o1tpxo fcilsfaDumuvpn(0teenmfcta1lmDr ueils0s2tmxm iu1omtnmnvils) rurumooo4teeo o3iys s elnvont) eerxf3ty1oatr nes ( t2tr(opoy4omtnlfctl( a2raurpno1oltnmiciytfm uln pnt) ltomf3tadla   ues ()s2xoio3iy1ome mnctatfsrtm(roou4oleo i3ils s ua(mp;(0treoxfctydoatrau o;t0texrxopiy1al nmnvtl( aruaxmpnt1ale mietyslsDea(vo;(4trxoxo3oatopteanvi s)t2toim nydop  mfvs s  Drr(  oo0alt ii3iaslsDulnvs (4 lxomf3ty1opDr n ilt0t2trio nydlpeelfvt ( srtmurpou4tle ifetytlm2ulnms;()areoxfcoo1optean s;s0seur(m no4optn ics ()aDrrxm ou4aptomictytls emnvs u0 rtrmr3io1latelieslt0seuoir io1altemncsl()s2rrxmp;u4oltoif3tls s rl(mp;t)aeeoio tatoptrlu il()texoxr3iy4lmt  nct s aDua(ronu1tlx  fetytlm2ra(vont4tlxrxo iadlp r ieols0s2toio iydaltnmfcslsfs2uaumont4texnifctyt s2ea( s u0 exrmf3ty1omDe uei s  2urio no4omtnlivs ()s2tru poo4opto o3tysfaDelnvp;u0tltnio3iotopD  uvo;( s2urir nodomt lnvi s)srtr(r oo4aet mfciydlsDuauvs u4trxoxf3iatfat luvi t0texmxr3oudoltelnvs (faDtmxmpoo1ope  f3tls mDrauvo;u0aleoxf iydom rai o;t0seuo(o no1lpte nviltfaDrmu  nu0aetn fctyd s uau o ()tlenxf3ty1fm rlues;t0 rurxrpoudlle lfvtlsfaruaxrooo0aet mi3ilslmDuanmp;()teeoif io1lmDean i s s2urimpiydom  mfesat) 2ra(rpou1ape iocils s2elums (4arenmociadopDrln ols  rto(m3no1ame  ies (faDumxront0aeeomo3iyd m2el( o (0aeermfciadopDr n o;()teumio oodlpte nvils a2ur(mpno0olxoifciydla rln o t4aetnxf3iatlmDran i t s2umio nudapt livil( aDurxmp;u1apt mi3iasfsDeaump;u) renio oy1lmDran o t  rxrxm nu4ale mieil(fs2rm(r no1opt if3iydlmDul(mont) lerxf oytlmt luvil(0setm(r3oo4lle mfviatfsrta(rpoo1aexo icildfs ean pn(0 etrif3to1om raivi;t)s2tmxr nudlltnmncia(f Dra(rooo1altnmf3tlt s ua(mp;(4areomf3io1omDe n s ( trxmirpoodamtnmieslt)s2tr(m ou4optn i3iytfsDemn s (4 rtoio iodomDe uei s) 2urir oodlltn nctlsf rtmxronu4aleo ieiytlsDulnmon(0aetoio3ty1fm ranvilt)texm(r iy1lm e nctat sDraurp;o0oee mfetydlsDean p t) exrmo3iatlmDe ueo;(0 rtr(o3nu4aleelieilt aDuaxmo;t0tpxn ietad a ranmp (0 rxnir3oatfm  lueils0 rtrimpou4omeemncta(fsDurx  no4tlenmi3tyt s uaumo;t) rtoircoadfpDrln o;t) rxrxrpiy1omtelieiatf Dumxmoou1tpt  f3iadfaDeanmo (4 rxrxf3ootfat lu i s) 2umirpiodlpte nesltf 2ur(mpno0oexoii3iyslm2ua(mp (4 renir oo1opt  u o s)s2tm(m nu1amt  icil() rurxroot4tpto oeiat s2rmu o;t4aexrxfciydlptrau olt s2umxopoo4ape mfcs (faDurx ono0tet io3tasfmDulnvpnu4 rxrir ia1lmDrlivi;t0texmxm3ny4olee ictas aDumum ou1altn o3ild s umu s;t)altnxo todfm  lieolt)setrxo3no4lmtnmnvs ( arrr( o;u0aetoiieiydlm2emuvs;t0 rermocty1fp elies;(  2urxm iu1apenmivsl()a2trum ;u0aee  ietytls rmu o;t) lerifctodlpD  n s s  rxo(mpoo4ol n feils aDrax  no4aexoif3iltls2elumsn()aeenmo3todoate uvols0teuoxr3iu4lle  icil(  rua(mo;u1tpeo icildls um(mp ()treoxo oytomtrluvo;()s2xmxm3ny4aleemictas srrax o;u1oltnmo3tlt mDeln p;(4 rtoxoctodomt an ols0teur(r3io1lltnlfetls)aDrru  nt1tpt miciyt m2uanmsn()aetrxr ty1fmtr u i;t srtmio3oudll  lnct tfsrtrxr nt1openioetysfs2rauvs t)areoxf3oa1fat an s t0 2xmio3ny4lpeelnvtatfsDum( ono0aleomo3iysfa emnmp u4tlxnxrcoatoaDe iei s) rtrxm3oo1amtnmies s) Dta(ronu0texnmfetyt a2em( o;() ltomoctadoa  au i s)seumxo iu4ole mnciatf 2ur(rpnu4oee moeiatlm ulu ont0aleomr iydom elies;s0seuo(r oo1optnlfvt s)aDrm( pot1optn o3tydfmDrl( p;t0tetoif3oatfm e i s;t srxrim ou4ll nlivt s) rur( oou0oexoioctysfa rlnms t0texoxfcootop e neol( teumio3iudal n fetlt)aDtmx pnu1ope  o3iyd a2um(vo;t0 ltniociy1oatr uei;()teuoxr3ny4ale mnctl(fsDta(rpno0alt ifciysfa rmn pn()trxrxrcta1la   neolt0trxoxr oydopteliet (fsrrmurp;o0tlx ii3ilt m eanvo u0 exnxo3oo1fptr neilt0srtm(m3iodomtnlnei t sDtr( pou4tptomo3iasfmDeanvon() leoxocty1oaDrlnesls tetoim iy1olte fesas srrm(r no1tex  i3tysfm eauvs;u4 rerio oydlatr nesl()texr(mpio4amt  fcslt)arur( ont0olx  ietlsls uaumsnu4 etnxr ty1opDeaivi;()seumim3nydll emfcsl(  rraurp;o0tleoiieiltls umnmp t) lermo3iytfat  n i;( s2tmir3oo1ll e feslt)srua( pou1tlxnio3iysfa2ua(mo (0trenxrcoatop r nvi s sruoim3no1al   ivsat)aDum( onu0oeto i3iad aDea( pnt4aleomf iadoat auvo t0sexoxo nu1lptnlfeias)sDur( pnt0tee mietltfm ran onu4alxrifciy1laD  ivo s) 2triopoudlme mivt t  2tmxm ;t1aleo fetasfa eanvo u0 etomociydlaD auvolt sexo(mpou4olte nes s srrmumoou4tpeo feiltla2rmnvs;t0alxomociytfat luvi;s)trur(r3oo1lle mivtas srrm(ro;o4tetomf3tydfsDuau s;t) exrifctydlateaiei;t0 exmim ny1ll emnetas)a2rmxr nt0aeeo feiasfs rl(vsnt4texomr todomDr i i;s) 2xoxopoy4ap nlnetlt)s2uru onu0apeomf3ildls umu p;u) lxnmf3iadfmtrau i t)s2tr(r no4oleelicta(fsDrmxmpnu0tltomf3tltfmDuanmsnt4teerio ootoatrln ol(0sexr(m oydlpe mivia()a2taurp;u1oltomo3iydfs2rlumsnu) ltnmf totlmDrlnvs;t) 2xrir3ny1ap n feiasfarumxr ;t4tet  o3iyt aDemnmo u)arxoioctodlptelu il()srur(m3nydop  lnei ( a2uaxroot4aleomieilsfs2elums;t0 lxnxf ia1oaDeaiei;( seuoxo nu4alenlneils aDtr( ono4olxnif3iasla2ulnmsnu0aeenxr tydoa  an o (0setr(mpny1lle lfvil( srrr(m no0oltn ictldlmDeaumon()artnxf ia1fmt lueol()srxmxrpnudll   nvi ( arurur oo0tpx ifctydfa em(vp t)tlxomfcoo1laDelneo;( trto(r3oodlp  lfei t)a2ta( poo1opx iocildlsDeanmsnt)trxnmocty1opteluvs t) rtmirpiy4opt  nctat)aDtaum no0aee mo3tatlsDumuvp;(4 renxf3tytfmte u o;s0t2tr(m nu4om nmfei ( srtmu  ot0oexniietatlaDra( snu0aetnmr ty1oa rlueo;s0t2xrxo iy4oltemnvs ()aruaxmont0openmfctat m rmu sn()trtoxr3tytomD ln o ()t2xr(o3nu4ll n nvs (fs2rrx  oo4optnmf3tytfs2umuvonu4artoif ta1oa  au i ( trxrxmpno4am elfvia()aDtmuro;u4apx miciltfs2umu on(0 etnir tadlm e nvol(0t2urxmpiudape mnctas s2ua(mpou4tpx  ietlt a2rm(vo (4arxrio oa1faDeaues s)sexrxrpoy1alenlivt ( a2ur(m nt4aptn ictysfaDulnvonu4 lerxrciytlm eaieils s2xmimpiodlmtemnvsls) 2umump;t1tlx  ietatla2ulnvp;()tleoxo3oadfmt  uvi;s0s2uoirpoy4lp   fvtasf rrmu  ou0alenmo3ils m rm( s;u0trxomr3totlmte nes;s0trxrio3ny4ap emnvtlsf rtrxrpnt0oeenioeiatfs rlnmpnt0texnio ty1fa eaueo s)tetoxmpoo4am e ivtat) Dtaxrp;t4alxo ictydlsDean o;u4 leoioctotla r ivs () 2uriopiu1op  mfctatfs2rrxmp;t0tpen feiydfsDeln ont4texrir oo1lmtr nesl() eum(m3io1lpenliesat) 2rm(m ;t1opeoifetlslaDemu o t4aleomr oatla  ln s (  rtmir3ou1am  mivi t  Dtaumo;u4tex  oeiaslsDemnmpn()texoirctydopt li ilt)srxmim io4omeemicsls)a2taxrpno1teeoii3iatfaDrl( o;t0alermrcoodlmtrlnvi s0 rtrio3iodam emfvs tfa2rau  oo4aptoii3tat m umuvo t4tltrio iadfmt aneo () rurxo3ny4al n icsl() Dtmxmo;o1apx mo3tlslaDemu s;t0artnio tatlmtr ivi;() exrim3no1lm   fctasf rrrur no4tee ifciydfm ra(mp (0 eenxfcoadoa   uvi ( setmxm3nudoleemneslt)aDuaxro;u4aptnmfetlsfsDuanms u4trtnir iotfaDelneo t)trur(opoudlle  nctls srra(ronu0tle ifeiltfaDul(vp t0 rerxf3oytfmte n slt) 2uo(mpnydop n icsa()artmxrpnu0tee  oeiatfa2em(ms;()aexrxf to1latraneo;(0teum(mpnu4ole mictas) 2ra( pnt4olxnmf3iasla ua(ms;u4 eerxrciotfm  auvsls  2xoxm iy1amte nei t) 2tmum ;t4oee iieiydfmDeauvont4 reoxo3tydfmD  n ol( sexoimpiydlmt mfesas srraxr ;o4aeenio3tat s ranmo u0artnxoctatfm rlu o;t)t2umxo3oy4ape livtlsfs2ua(r ;u1oeenmoctltfm2ulu o;u4tlxoxo3totoaD li o;t s2toiopnudopenlivsl()aDrm( pou1aet if3iltfa elumo;t4aetrmr oadoaDraivs ( t2to(opiydop  lictl( a2rr(moot1olto f3iad sDrmu s;(4tlxrif ta1faD anes;t0teumxm oo1al  mfvt ()s2rau o;u4tpto ictatlmDel(mont0tltoif oydla rln s;t0tetrxr3iydomenlnctl() rum(r ;u0opxnio3iysls2rmu p;u0aeenmo3iodoa rlneo;t0t2toimpio4om e ieta(fs2rmu o;u4aeto feiadfa uan o u0alenio3oo1fatr u o;( s2xrxo no4lmte fvi s) Draump;u0tpenii3tldlsDraumo;u)aexnxoctatfptranesl()t2xoirpio4lp nmfvsas sDrmu pot4aexn i3iydlm2eauvsnu)aleriociotfa rli slt trxo(r3nydlm emnesasfs2ta(mo;u1aeenif3ias mDrmnvo u4texniociytoa e u sls0setrim3iy4lltemfes (f rrax ooo4opxoiociltls2rmu o;u0artnmoctotfpDeli s s0 eumimpiy4ap n nct (  rumx poo0tlx  o3iadlm2ulu o;t4 etnxr iodfaDrau ilt0sexoxopoo4llt mivtlt)s2ra( o;t4oleomo3ild a ranmp;(0 lxomo oydomtrln ol() rxmxo3iydam nmnvia(  rumurpnt4apt  oeilt m uanvsnt) ltnxocootfptran i s)srur(rpiodlp elfcil(fs2raxmp;o0tpx  f3iysla2ua(mp;u0 lxrxf3ty1fmDrai i;t0teumim oudomt mfctatf rtrx o;u0tpenmfcilslmDea( sn()trxrmf tytlateaiei s trxm(rpno4ale mnvsls)srra( pou1aptomoetysla eauvpn()altrmr to1faDrlu sls0 eum(mpno4om elfei ()s2urxm ou1olx  i3iad m umn s t)artrifciadfp rai i;t seumxr no1ap   iet tf rua( p;t0teto ociatlmDem( o t) leoxrciatopDelieils0 2um(m3iu1ape mivia()s2uaxrp;o0tlx  f3iyt sDeanvp u4alxrmrciydlpDrli o;()setoir io4al elfctas)arurum ;t4oeen i3iyd m2rl(vonu)texoir to1lpte uvs t0tetoxo oudlmenmfvilt s2tm(  ;u1tet if3iyd mDua( ont0 rxoif oy1omDeluvilt)trxm(r3iydlp  lfei ( s2urxr no0apx  o3iasla emn p t)aetnxrctotfmDrai o;()t2xo(opnu1lptemncsa()sDtrurono1olx io3iydfm emu s;()teeoif oadlpt li s s0srtrxm3iodll eliesas)sDua(rp;u0apenifeiadlm uln p u)artrxr oa1oatr ues;t  2xm(m3iy1ame mfctas  Draumpno4alxomfeiyd sDumnmsnt0altrxociatopt aueo;(  etrxo ny4om   fvilt s2um(r nu1tlenmfeilslm raump ()arxrxo3iytopDrluvs s0texo(m nu4amtn nci (  rtmxr nt0optomfeiysfa emn snu4arxnif iydopt ln o;s0srumxr nu1amenlfvtls  rrm( p;t0opt mociytfsDel( onu)trxrmoctotfa eauvsl( s2trirpoy1al   nei t) 2rr(ro;o0oetniieils m umn o (4 ltoio iadoaDrli ols0 2toir nu1ap emfcs s  rumum nu1apxoiietasfa emnvon(0aleoxo ootlp e uvs;(  2xo(m3ou4openlfvta(f rrmxm no0apxomo3tat m rln s u0texrmo oytlat  iei;t) 2tmxopoo1lltnlict tf Dur( pou0teto oetlslaDulumsnu0aleoxo iy1omt  uvo s0srur(m3iy1lpee ies (f rtaxm ou0aptomoeias mDea(mp;t0tlxnir3iodlpDelues;()teuoxmpiydal nlies (f rum(rpnu0oeeoifeiasfa2ulnvp u0alxoifcoadomtrli sl(0t2tr(r3iydaptelncsl()a2tmumooo0oleo feiatfs2eaump;(4arerifcoodfaDrlnvo;t0s2xoxr3iy4oltnlicslt)srrax o;u0alxomi3iadls rlnms;(0altrir3ia1lpD auvo;t)trtmxr3ny1omtnlivtat) rtrxmooo1tet ifeiydlm2ua(vsnu4texoxf3ia1opDrli olt) euo(mpoo4lleemfei sfarrrur ;u4aeeoif3tytlm uau snt4tlxoifcoo1oa elnvs t)t2xoirpio4ap n nciatf rrmur oo0ope  oetldfmDumnmo;t4teenmf3tatlp  aivo;t0seuoim3oo1ol elnvils  Dumxroot4altomoetydfa2rl( o t0 eenxf to1la  liei;t)t2toir nu1lpeemnvs tfsrrmu ono0aexn fcils sDeanvs u)aexnircoydlpt  ivo;t s2uoxr3ou1omee fvtat a2rrxrpnt4apenmi3tltfa umuvp u4 lxnmrciytoatrln o s0 etrxmpou1al  mfct ()a2tm(r nu1tlx mfctyd mDua( s;(0 eenmr tadfmDe n i t) 2xoxrpio4om e ies sfa2uauroot0oet io3iysfm ea( s (4arerif3todomtrauvs;( sexrio iodapen fvs ( aDraumo;t0alx io3iasls ulums;() exnir iy1faD  i i s  rxo(mpnu1olt lfvs s)a2rm(m ;u0apt mfctadfsDul(vs;u4alermrciodlpDeai olt0 2tr(r3nu1ale lfvtls aDua(m ot0aptnii3iat mDua( o;()artomr ty1late ivsl()srxrio no1lpe lfvtatfaDurxro;u0aee  feiytfsDea(vo;()aetnif3oo1oaDran i ()seur(r oy4lptnmfes ( artm(mpno1tpenmietadlm raums t0 rtrir3ty1lmDeli ils)seto(r no4lm  mfvs sfarta(m ;t0opxomiciad m ean p;u0teeomfcoytomDr ivo t0t2urxopno4lpen nesls) Dumxmo;t4aptnmfeildls2rmuvpnu)tetrifciodom rluvols)teumir oydaltnlfct t sDtm(r ou4apt  oetldfaDrl( p;t4alxnmf oadfat aueils)t2trir3oy1lpt mict (  rtmu ono0apeomfeildfm2um( s t0 lxnxf oatfmD  ueils0 2tmxrpoy4amtnmivtlt) rtaxro;u4tlxomo3tyd aDran sn(0 lenxo oodlm rli s;t sexo(r3ny4ale mfciatfsDuax onu1aetniietas a2emu o t0aexriocia1lptranvi ()t2toxr oo4op emnetlt sDurumo;t0tpeoio3ildlsDeau onu0artoxf tydlaDe nvo s seuo(m3oodlle livilsf Drm(mpnu4opx ifeiadlaDumnmpnt0alerxr iadfpt anei;s)setoxr nodal nmivta() rrr(rono4tleomfeiyd a2rm( p (0 rtnif3io1fpD aivi;t)t2toxm ou4ale mncsa()artru  ot0aeeomi3iaslaDuaump;u0trxnxo3oa1fmD  nei s)t2xr(o iudlpeemfvia(fsDua(m ;t4alx iieiysfmDumumo u4trtnxocty1oa rluvi s s2urxm ny1optelfct t srrm(m ou4tpe if3tadls umums () lenxociotlm rlueols0t2urxr iy1openmfes () Drau ooo1texo oeiasfs2emums (0aexoxoctodfmDrluvi t sexmxm oy4lmt mnciasfa2trx  ;o4openiociadfm2eanvs;(0altnmo tytop  auesls0t2toir3no1lptelnes sfs2rax  nt1olxo ociys sDraumo t0altrmoctodfpDeliei;( t2uo(r3ny1ape liviat aDta( oou1aexomo3tyd s ulnvpnt)altrmr3oy1la ranvi (0 ruoir3oudol n fei s  rtrx p;o0tpe  i3ilsfmDrlnmp t0aexrxf3tadlp  au ilt) rxrxmpou4lm e fvia( srtaur nt1olxnmicilt mDum(ms;t0 ltnmf totlmt ai s () etrimpio4lp e ivils sDrr(moot1oee mfctytfsDua(vo;t0 exrmr3oadopDran ils0sruoirpiu1amt livta( a2ur(ro;t1oltn feiaslmDul(mpn(0 rxoxfcoydopDr uvsls tetr(o nu4om   feta()aDumx  nt4ale io3ildlm2rluvo;u) eeoir3tatfm   i i ()srur(r3ny4alee fct s)s2tmxmpot1tle miciadlm2ea(vsnu) rtoxo ia1fa rlnei;t srtoxr io4lmenlivs t)sruaxm ot1tpt  fcild m2uanvon() exomf totomDran i;t)srur(m iu4alte fvilt  rumxro;u4tpxnmictys mDuluvo;t4trtnxrcta1fpDeln i;t t2xoxo3iy1op nmnvta() Drax pot4opxo feiadfs2emn s;t0tetrxo ootlpt  ueilt sexrxm3oodllen fcil() Draum nu1ale  ictltfaDean pnu0treoiocta1op e iesl() 2xr(o nu1lm elnes ( arrrx ooo0oleomfeiytfa rm(vp t4areoxocto1opt lnes () 2um(rpnu4lmenmiciat) 2tr(m ;t0olt iieildfm rm( p;(0aeermf iatom rlieo (  2xmimpoo1ape  ncslsfaDtaxmont4tlt iieiytfm uln o t4 ltnxocootfmt  ueslt)teuoirpiydomt mivsas  Dra(rp;o4apx mfeiasla ran p (4teeoif3iodlm  anvo;t teuo(m oydalt  iesl(fa2ua(ronu1opxomf3iyd m2ulnvsn(4 lerxr iytop ran olt  rtoim oudlm e fciat)sDum( pnt4aptnmoctadlaDemnmo u0 reoif3ty1fmDelieo;( s2xr(m3nu4apt lneilt s2raxmont0olx  ociysfa2emnvo (4tltoxr3iydlptr ivo;( texmxrpoudape  icsl(f 2umxrpnt0olt iictlslsDrlnvs (4 etrmr oydlmD auesl(0srxr(o oo4optn netl(f rrrumpoo0oexn o3tltls ea(vs t)altnmfciydlpt  ueol(0srto(mpiy4amee fetl(fsDurxr ot0opt  oeiyd sDum(mo t0 rxomo ia1latrlnei s t2xo(m oudamen ivi t artrxmpno1aetnmoctys m2eanms;(0alxoiocoatlmtelnvilt)s2ur(o3oo4altemicia(fs2tr(  ot1tpx miciasfa2ran snu0 rtomf3iydfatean i;t)truo(opnu4lme mfviltf 2rmu  ot0oexomiciadfs2eluvp;t)texoxr oydoaDeaiei (0trxoim ou1apeemneias  Draumpot1oeenmietyt m2ea(ms;t)texoxr3oy1opt au s;t)texm(o iodllt lnctlt) 2taxrooo0tpto icilslaDrmums;(4 eeoxf3todfaD  n s;s)s2tm(r3iy1omtemnvta( artaum nu1tlxo ieilsfa rlums t)trtnxr tytoat luei t)trurxopiu4ap elivilt  rrrurpnu4tpto f3tysla umn s u0alxomr3iotlmDelues (0 2uoio iy4apt  iviat  2ururp;t1aexomoetasls ra(msn()aeeomr3tytfmteln o;t)trumxr iodlp elfcia()srraum ;u0aetn ietlt s umums;t0trtoif oo1om rlu il(0seto(m3oydam  mfct t)aDurxrpno4tet mo3tld sDua( s u)tetrmo iatopDeanvo (0setrxo3oo1ol e fviatfaDuau p;t1oltnmo3iydfa rmuvo t4trermr3tadfp rlnvolt
\ No newline at end of file
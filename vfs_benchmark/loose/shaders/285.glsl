@@ -0,0 +1 @@
+uvi (0 2xo(opiudam emies s)a2rmxm ou0tee moeiltfm ulnmsnt0 rermf oa1omtelivs s)s2to(opou1lmte ictat srrmxrp;t4olxnmocilsfa ulums u)aetoifciotlm r ieolt teumxo iy4llee fct sfsDua( oot1oleo f3tltla2rlumont0 lxrxr3ootfatean s;t  2trimpnudamt lfeia()sDumxm ;o0tpeniietltfa ul(vo () rxrifcoodfmt aiesls0 rtmio3iu4omt lfesa()a2rr( poo4teenmi3tyd m um( s u0 lxnirctydop   nvi;t0s2tmir no1omt lieils sDua(mp;t1teenmfeiytla2eaump;t4 rxnmrcoodlat aiei s0srtrxr iy4ll n netasfsDtmump;u1opt mfctad s emu o;u) lxnmfctadfpD liei;t texmxm io4ole mivil(f 2uaxrp;u4apxnmociasfsDea(vpnu0texoxf3io1lptrli sl() ruo(r nu1am e iei s)aDtrum ;t0aex iociydfs2elumsnt4tltoir3io1faD au o;t) euoxrpoo4amtelnci t  Dur(rp;o0oexnmo3tldla2umu p;t0 etoio oadfaDe uvo;t)t2umxo3iu1lp elfvsat srtaxm ;t0apxo fetls m2umn s;u0 lxoxo3tadfmDrau o;t0 etoir3oy4am nliet sf rur(rp;u4aeeomieiasfm eanmo;(4 ltoif iy1fm   n ols sruoim oo1opeemictls srumurpnt0oexn iciasls2eaump;(4aleoxf3tydomD  uei;t)seuo(m3iy4ol nmncs ()arumu oou4opto o3tls aDemuvs (4aexoiocoydlpt  uei;(0texrxr oudal   ncta(f rurx  ;t1opx mo3ilsls2uluvs t4tltrmf ta1la r ieolt)trtoir3iu4op nlfvt ( sDrmx  ;u1alxomf3iadfs2eau s;(0trerifciodlaDr i ol( truoio3iydopen fcils sDrru  ;o1aptnmieiatfa2uln o;t0 lenir3totom  lnvo t) eur(o3nu4lmte ncsl(fa2tmurpno1olxniocildla2el(mpnt)aeeoxo todfmDelnvi t trxoir io1amtnlncsa(fs2uau poo4tlx miciat s2ranvo;t)arxrif io1omDe ivsl(0 rxr(m3ou1lmtelicsl()a2ururp;u1olx  ietaslaDem(mo (0aleoxr oytlpt lu s;(0 rxm(m oo1oleemicsatf rumxmpot4oet  o3tldlmDeln ont)arerir iodfmtrlnvsls  2xoir iu1lm nmivtas s2taumo;t0oexniociadlm umu ont)artoxfciadfmtelu s ()s2uoxopoydlm e fvias  rum(rpou0tee ifctltfs rmnms;u) exriocia1opDelu i;s  rtr(o3ny4ap e nvtas) rumx  oo1teeomoeiltlm2rl(mp;() lerxrciadfpD lu o;t s2xoxr iodlm emfcslt arua( o;t1oexoiictltfs elumsnt0tetnircoa1la   uvo;()srto(o3iy4altnmfcil()aDtmu pot0olt mo3tadfs em(vo;t) rxomo3ty1lpDran s;(0t2umim ou1al emicsasf Dua(m ;t1optomo3ilt mDeauvs (4alxnxrcootlm rauei;( teurir3iodoltnmnci t  rrr(moot0tetnmo3ilsfmDrm(ms u)aetomr3iy1laDe n s ()tetrxmpio4lmenmfvtl(fa2ur(mpou1oet iieiydls2emumo;t4 ltrmfciatlatelivi (0s2umir3ou4optn ies sf Drrxroou4tex  ietlslmDrlu s (4 exnmf3iydfp  luvolt)srxr(m3nydlmt lnei t a2tr(r ;t0tpt if3iatlm2ranvp u4 lxoxfcoadlp r n o s0trxr(r iu1alt  ivslt  rum( pou0altoiieiltfs ranvp;t0 rerio ta1lm  lueslt0setr(r ny1al  lfvt t)arumurpnu0tet mfciytlmDraums;t)arxrxocty1lp e u sl(0sruoxrpoy1op elivi t)a2uaxrp;o0aee  fetys s2ea( pnu0 rxnir3oydop  lu s ( setoiopou4llenmicils) rumxmpou1oee if3iltlaDel( onu4treoiocoadomteai o;(  rtmir3ou1ap e ieias) 2trxr ;u0tle  o3tyslmDumnvs;(0 etrxf3oa1lmtr nesl(0tetmimpoy1al n ivsa(f 2um(rpoo0opxnmieiytlm rlu o;u)artrmociodop   ueils) 2umimpiodamee icsat s2rax ono4oetomo3iat a rln s (4 ltrmf3tatlp r nes;t)s2uoxm nu4altn fvtasfs2tax ooo1tee  ociltla2eauvon()tltrir oytom e ivo s truoir3oudole  ictas)sDuaumo;u4tlxnmoetydfa el( o;u0alerif3todfaDraueolt0sexrxm3nudopen neil()a2trx o;u0tltoii3iytfm2rauvp;()tlenxfcta1optelieo;s0 2um(r ou4oltemnvia(f rta(ro;t4oet ioetldfsDrlums;(0 rtrxf oo1lm   uei ()teuo(o3iydlp nlnciatf 2rru  ;o1tlt ifeiltlmDel(vp;(0alxnmrcoy1lmtrlivo;( s2ur(m3oo4ll elicilsf Drmumpno0ope mi3iys s2ulu p (0 rtoio iodla rlu slt srtr(o nodom emivtlt sruax onu0opxnifeilsls2rl( p u0arxoxocia1fp  livs;s0texoxm3ny4opte nvsl()sDrr( p;t0altoif3tad m emn o (0trtrmf to1lmtrlneo (0t2umxr3nydlmee icsasfa2uaumonu1tltnii3iltla em(mp;u0 eermo3oy1fptrln i t  2tr(mpoo4olenlnesat  2rr( ono0tlxoioeiys aDrmuvp;u4texomf to1fpt  nei;( s2toir3io4lm n fes ( s2um(  ou0aleoioeiltlm ua( s;t)aeerir ia1fat  neolt)trtoimpio4ll elfet t a2tmu  ou1alt if3iatfaDemnvsnu0 rerxr totla rluvilt)srto(rpiydoltn nvslt)arum( pou1apeo ietytfm rmump;t)aexoxfctotoptr ies;s0trxo(mpno4ol n iet (  Dumx o;o4aex  oeiad s2rmuvo u0alxnmo3io1omt lu s;(0sexoxo3nodom n ivtasf rrm(r nu1olx  fetydlmDemumo t4texoxrctydfmDe n i;s0s2toirpno1amtemnesat  Dtrxmp;u0opeoiiciltfa ua(mp;t0 etnmo3ia1omDeluvo s)s2umio3no4lme lfvt ()srrax oot4apenmieiltfs um(vo;u) eenxr oatfaDranei () eumir ou1aptnlnes s)aDuru o;t0texn feildfa2ul(vs;t) ltrmocootop e neil(0texoxopoo4lleemivsat)sDuaum ;u4texomocild s2ranmo () reomfcoatomt lu o (  rxo(opiudap e nei (f 2tm(mo;o4tetoiieiytlsDem( o;u4trenmr oo1fmtr ivi;(0teurxr iy1lltelnct (f Drm(m no4teeoioeiydls ulu p u4trtnxo3iydfaDranvols0trxr(mpio1ape mici s)a2rm(m ot4apx moeiydfs um( p;u0 etnxfcootfaD lieo s0s2umxm iy1ap elies sfsrtrxrpnt1open f3iydfa2eln o (4arenxf3oydoaD aivi;s0sruoxm3nu4ape lnvils aDtauroou4ope ii3iatfaDrluvp u0trxrmfctadomDr nvi;t)tetr(o io4apen ncta(f 2taxm ;o4oeeo o3tysfa rmuvo;u)treoio tatopDraies t t2toimpnydapt mnetls) 2tmxrpnu4apen ociadls2uan snu0 exrxfciytomtelnvi;s)sruo(o3ou4om nmfetlsf Dtmxrpnu4olenmoetldfm umu p;t)trerif oodfaDrau o;s tetmim3ou4altnlicsa()srtmxmoou1alxoiicils m2ea(vp;t) rtnif ia1lmteaieol()sruo(mpnudopee fvia(  Drmur ;u4tee  oetld s2rl(vo t4aetoio3iatop  au s (0 2trir iydamtn nci (  rua(m ;o1apeniieild s2rl( s (4trtnxo oodopt luei;(  rxr(r3ou1op n nvil() rrmx oou0alto fcias m umn s t0 lxoxf3iotla  ln s;s setmio3nydope lncta(farrmurpou1ape mf3tls m uan p;u4alerif3oydlaDraueo s) eumiopoydaptelnetlt s2ta( pnu1tpt mf3tyt s umuvpn(0trxrmr iadlp e i s;t)srxoxo ou4am nmfctat)sDtau  oo1oex  iciat s2ra(mpnt)alxoxfctytlpD  ivi;t  rtmxrpoodal nlivtas)s2rm( o;t0ape mo3iadfsDrmu s u0alxrxr3oa1lmtelueo ( seumimpoodlpe mnesl()s2trxrp;u1aexo feiyt s emuvp u)teenxo3tydla   n sl( seurxr nu1aleelfet t)s2ua(  ot1tlxnioeiadlm2el(msnu4 lenxr to1fpt ln o s) euoimpou1op e ici s) Drrxr ot1tltnmfcils a2el(mo u)aeenifctytfmt aueo;t0s2xoxopnodopen ictatfs2rau p;o0tlenmfeilsfmDumnvp;u4tetrxo oatfmt livo;s)texmxm3iu1olteliesl( srumump;o4tlxnmoetasfs2elnmpnt0tetrxr3oy1omDe ivo;()s2toim ou1om nmfeiat) 2tauro;t1ole io3iytlmDea( snu0tetrmf iatlaDe ieil(  2um(opiu4llte fvtlt) Dum(ront1altnmo3ildla2rm( o u) ltrifcoy1opt  n i t  2toirpio1oleemietat  rrr(ronu0ole mf3iatls em(mp () renxf ta1omt aneilt t2xoxr ou1ame mivs (farta(r nt1aleo ociytfm2elump t0tlxnifctytlpDranes t0 exrio oodalee fvtl( aDrrump;o0apt ifctatls ranmonu0 etniocoytomD lneo;s0 rxrxr ny4ll emfeiltfaruaxmo;o4alenioetlsfa2elump;t4teerxrcoy1oat  nvsls trurxmpoo1lle lneias) Dumumpoo1oleo oetatla uanmp u4 reoifctydlpDrli o;s0t2um(m3nydapte ies s)s2rrxm nt0aleoii3tltfa2umump;(0teeoxfciatlmD lieo (0t2xrio3iu4op   nvias)sDtrxr ;t4olxnmf3iadls ulu s;u0 renio oodlat  u s t)sexrir io4amtnmicilsfaDrrxm ot1openmieils sDem(msnt)tlenio ty1lptraueils0trtmxo3ou4ll elfcslt a2ra(mono4altn ictadlmDuaumonu0 lxnmr3tatfm ran ils)seurxr3iu4lp   fvt s  2rrx ono4tpxniiciltls ra( onu)aeermo iatlp rln s s  exrxo3nu1lm  lnet ( sDtrxmono4aex moetysfs rauvs (4 etoxocoatla  aueolt srxo(rpio1amtnmfcsas) 2umu  ;o4texomietysls emumpnt)altoxo3iy1laD  ivi ( srxmim iu4lme  fvtlt)srumu pot0opt  feiadlm2rm(vp;t0 reoiocia1lmtr ieo s) exo(rpoydlmee nvsa(fsruau pou1tetomfciysfs uluvs;(0tlxnif3iadlmt  n s;t  2urimpoodllte ncta(f Dtaurono0olt  iciadfs2ranmo;(4trxoio3oytfa rlivol(  etmxo3iu1optn ivtat) 2umxrp;t1alt  ociltlm2ul(vsnt4treoxo tydfaDraneolt) rxoio iu1am  liesat  rtr(  no0opxnif3tlsfs2rl(mpn()altnir oatom   u o;s0s2xoio no4ome livta(faDururo;u0tpxn ociltfm2ra(mpnt4teenifcoa1fa elu i;t t2trio oodap nmictas)artrum no1alxomi3tadlmDemnvon(0arxoxf oadop r u o;(0srumxr3oo1optnlfvt ()srtrumooo4tltnmoetytls2ra(vonu0aexoxr3oy1omtr ieolt0texrirpno4am  mics t)srtmxro;o1tlx mfctyd sDel(vo (4trenxrciy1lmD lu ils0texoio nodamee fvtat)aDraumono1tpxniietlsls um(mon(4teeomf iotfat li s t0trxoimpoy4opee fcslt aDraurpnt0oex mfetaslmDemn snt)aexnxocoo1lmt li i t  rtoxr iodom nmnct s srtmxmpou4ole ifctlsls ea(vp u) ltnio ia1omD lnes;s)t2umxo iu4am   ictltfsruru  no1apeoii3tydls ulu o t4aleomocty1lpD anvs;s)setmir3io1lm emfviasf Dtaxm ou0tlxomfeiydls rau s;u)alxrif3oy1lpDeaiei;s0trxoxr3ny1ape  iviatfsrtmxrono4opto ietytls raumpnt0tlenxociytfa r u ol()srtm(o ny1om  lnci ( srumu  ou4oex ioeiatls uanvs;t4 rxoio iotlaDeaneo;(0 rur(opiy4al e fcias)aDtrxr no4ape  ietltla elnmp;u0texrif ta1op r neols trxo(opnodal nlnct t)aDuau pnt1tlenifeiaslm eau p;t)teermr oa1lm  luvo;( trxoxrpiy4ale mnctasfsDrrx  ou4texn ociyslsDrm(mp;t4arxoiocoatlmteluvs;t sexoiopou1altn nci t  Dtauro;t1olenmoctldfa2rluvo;()treoxr3tydomDr uesls srxoim3iy4lmeemict ( aDta(r ;u4tlenii3iysfm2eluvp;()aleoif3oodfpt li i t0srtrim nu1omeemnvi (  Dtau ooo0aee ii3iyt m eauvo;u0 eermfciadlaD livi;t0 etm(m3iu1apee fctasfsDrmur ot4tpeoiieiatla umums u) lxoxr oatfmD ai o t srtoxopnudalee nvilt)aDtm( pnu0tpxnmieilsfsDem(vsnu)altrio ta1omt lnvs;(  rtrir iydal nlictlt)srta(mont4apenmo3tydlaDeau s;(0artnmr iadfmtelivs;(0 2tmxopoy4opt  ictlsf rur( oou0aet moeiasfs ran snu)arenxf3todopD  i o s0seurir3oo1lm nmnct (  Dtrur ;t0opxoifctydfs eluvonu0 lxomr iotla e nvi;( texrxo iy1ap emfvs t) Drmx ooo1alxoii3iytfm2rmn pn(4 leoioctodopDelnvolt)sexmxm nydom e fvil()s2uaxmo;u4alx io3ilsfa2eau onu4artriociydlm rlueo;s s2uoxr3iudoptemfvias  rumumono4texomoetyslmDraumpn()trxrmo oydlat  i sl() rxoirpiy1alee nvsl(f rrauro;o1opxomfeiltlaDum(vont4 exnmo3tatoateanei;t)t2uoxo3oodomtemnet s artmxm oo1tee  fciatlmDuaumo u)tleoio3oatlmteaueil( s2toio iudlpte nciltf rtmxro;o0aexnifeildla2rl(msnu0 lenmr3iadlmteli o s0seurimpoo4ll  lnetasfsrum(  ;t4olxnmietydfa2eaumont)alxrmf3tatlmD  uvo;()srum(rpnu4ameemicslt) Duaxmo;u0tpx ii3iatlsDrlnvont4 exnmrciytlmD lnes;s  2xm(m3ny4lmenlfetl(fsrrrxmpoo1oee  feildfa rmnmon(0 reoxo tadfmD an i ()srtmir3iydale  fcsas) 2uaxro;u0tlenif3iat m2ea(ms;u4 exoif3iadfpD an s;s)s2uo(r ou4llt mivi t aDum(rp;u1tptomi3ilt m em( p;u0 etrxrctydla  lueo;s) ruoir iydapt mfei ( sDtrxr ;u1oee  ociyt a2rm(vo;t)tleoirctodlmDrln o;s) rxr(m ou4lpe micias)arrm( p;t1oleomiciys a2uauvpnt4trxrmf3io1oa  an s;() rxmxo3io1alt  ivtasf Dua(mpnu1aet mfeiltlm emump;t4 rxrio3iy1fp  aneils0t2xriopoydom  mncsas sruaxrooo4tlxn ictlsfmDeaumo u4teeoio3tydom e u o;s0srtrxo3no4alt livia(  Dta( poo1olxomoeilt m rluvp;()alxrifcoatfpt au s;s0 exoxr oudomenlfvs t)arum(r ;o0opx mf3iasfsDeaumo u)tleoio oy1lpDeli o (  euo(m3ny4ap n iei ( aDtrxr nt1apeo i3tltlmDuanvpn()aexrxo3tatfm eaivols0 exmirpiudlm emivs ()srurx  no0opeomi3tadfa uau snt) rtrxr oadlaDe ueo;t0srurio3iy4ll elnvi tf Dua(  nt0tptnif3tys aDraums;u)arxoxrcoa1lp  aneo t) rur(o oudol  mfcs (f 2trxmpnt4olenifeils s2eaumpnu0 rtnxf oodfmDr uvi;t srurirpno1lpt  fci t aDurxm ;u0tet ifeilsfa2em( p;t4tleoio oy1fp e ieslt) rxm(mpiy4amtn iesltfaDrrxmonu1opx iictydfsDran on(4tetnir iatlmte nes;()sexrio nu4omt liesa() Drrur ;t4aee iiciydlaDel( o;t)areoir oodomDean s ()srur(opou1lleemfct ()aDua(rpnt4apt ii3iad a2el(vsnt0aexrmo ia1om rlivs s)trxrxo3iy4lm  mfvt s)a2rmu oot1tetomi3ildls ulums;(4 lenif iodfp   n i s)s2urim3oudlmee fet t a2rmx p;t0tlxoio3iadfsDrmnvp;t0 rxomo oadfmD aivo ( trxrxo oo4op  lfvsls)s2tru ono4tlxomictadlmDemump (4altrmo3ia1faDraueo t t2xoir iudlm n ics s srtrxmp;o0tptoifeils a2emn p;t)trermo3oy1oa rauei s) rum(o oy1ame  ivsa() 2um( oot0aeto f3iys a rmnmonu0trermf3tydoaDrauvo t)setmxm3ny1lm n nvt tfaDumuro;u0tpeo f3tas mDeauvsnu)trenif iodfmt au s s0 etr(m3ny1ol nmivt (f 2ur(m ot0tpxoifctltlmDean s () lxnir3oadfpD  ivo ( srxr(o ou1al  lnvsa() 2urxmpot1oexoiocias aDuanmsnt4 rermo iytfa elues t0 2toirpiydalen fei ()sDtr( pno0olxnmoetys m rl(ms;u0 rtrxr3iatfpDean o t0srto(o3ny1alenlfvtas  rua( oou4tpeoifctydfm umnmo;() lerxo3iydom  ai sls)srur(r3iy1op  mies s)aDtm(mpoo4olxnmoeiydlsDrlumonu4texrif iotlpDrlu o ()srumiopiu4ale lnes tfa2um(mpno4tet  oetytla2umums;u0altrmr iydomtr uvo s0 rxrxrpny4aptelnviltfaDtr( p;u0tetniiciasfaDean p u)tltnmr tytomtr i o;s0 ruoio iu4om  mieslt) ruaxmonu1aet ifetldla2umn s;t0alenif3ootlmDrln i;s) etr(rpoo4lp  lnesl() 2rru onu1apxn f3tatlm rm( pn(0alxrif oo1latr uvols t2umirpiydap  lietlsfa2uaurp;o0ope mociyt mDrmnms (0tltnxocto1oaDeluvi;(0 rtr(opiy1omt  feia( a2rm( ont4optomfciatfa ul(monu)aeermo3oy1fpD aivs t)trxriopou4lp e ncsls)arrmx  ot1aleoiieildfa2ulnvpnt0tleoif iodfm   n ol(0srumir io4lmtnlnvsatfartmu pnt1tpeo o3ilsfaDumnvp u0 lxrxo ootopD aivsls) rurxm ou4lptnlfcs s) rrax p;u1alxoifctadfa2ua(vp;u)altrmoctytlm e neols  rxr(o3oy4ame mnet (  Drm(mo;t1tle  fetlt a ea(mp u4tltrxr3iatomt an i s0trxrxmpno4lle lnvsa(farumur ot1tle micilsfaDel( pnt4tleomf3ta1lpt aieils0 2trxr3iudam n ivs tfa2rr(r nt0altoii3ilt mDrmuvpn()trxoif3io1lp  li s t0sruoim3nydlme livsas a2taxroou1apeo o3tls s ea( o t) reoxf ty1la r i o s trurir3oy4op   nes t a2rmx  ot4tpxn i3iltfa2elnmpnu)alxnxociytlmteau i t) 2xo(o iu4aleelnetltfarua(rpoo1opxoii3tad s2emumo;u4trtnxf oydom  au s;t0srxoirpoy1ole livtlt aDrau p;o0oexnmfciyd sDumnmpn()alxrmf tatfa rlivo s)s2tmiopiu4apte netl()srtm(m nt4optnioeiysfm ean p (0 lxomfcty1lp raivils) 2tmir3iodalt lncilt) rurx pno0tpto i3iysfmDemn pnt) eenmf totfaDrlivo;s sexmxo3nu4al nlfvt sfs2raxmpoo1alt iiciatfm2ra(monu)arxrmo3iytlate n i;s t2trxmpnodlme  ncilt)arrmu p;t1texn icildlm umuvpnt4 lxnioctadfmtrlu i ( s2urir3iu4ap  lnet ()aDrmurp;u0ape  fciatfsDul(mo t0 eenmo3tytlmt luvi t)teurxr iu1apeelictlt)sDrr(m nu4tet  i3tad s2elnvs t0aetomf3totlpt livi (0srxmxm3iy4lp n ici t) Dumx oot1oeenmoetys a2ua(vsnt4trenmr3oodfatr ieols texr(m3nodoptn feslt  2taurooo0alxnif3ildfs2rmnvp (0trtoif3io1fa  lnei t  etm(m iydlmtemfet t)a2tmurp;o1apxnioetlt s elumo;u0arenmo3iadom ean sls)s2xmirpou1lmen fet tfs2tm( poo1tleomf3ias mDemu s;u)teenmr3iytlp eaies;s0s2uoirpiodoltn fvta() Draxr ou4oeeoioetldfm em( pn()teeniocoatfp e ueo;( s2umxo oo1ap elfcslt srtm(rooo4aleoioetldla elnvo (0 lerxf3iotfatraieolt sruoir3oo4omenlfct s)srrrxrpoo1tptniieildfmDumump t0 rxnmo3tadfmtr uvs;t)srumio iy4ll n nvsasf 2ta(rpot0tpxn ociyd sDuan snu)aexrxr oadfa e ieo s0trtr(r oudolte fesl(faDtr(rooo1aexo oetydls ua(msnt4altrmoctotfmDrauei t s2xm(m iudal  livtls)sDtau poo1oeeoiocildls2rau on(0aeeoxo3iy1fm  livi;()teto(mpio1om elies t artm( ont1tpt ii3iyd s2ra( o u0 lerircoadfmte i o ( sexrim3oudoltnlnes (fs2tmu oou1oex  ieiydlaDulnvon()trerioctatopDe neils0truriopno1alt  ictasfarrm(monu0oetomo3iydfm ranms;t4 lenxr oatom rlues;()teurxr3nu4am   nvtlt)s2rrxroou1tleniiciyd s um( p ()alxoxr iatlpDelivo t) 2trxrpnu1optnlict t  2rmxmo;t0tptomi3tlt m2raums (0 lxnio3iodom rlivsls) 2urim3oo1lmt mncs tfartrum ou0tle  o3tldla uan p;u0tltrio3oydlpt an sls0t2uo(o oodlp  mnvs sf 2ur(m nt4tptoio3tad a ul(mp;() rtrxf3iotopteln s s srtoxo oudlpee ivsat  Dra(rooo0aeeomieiys s2umumpn(4 rtomr3tatopt lu o;()trtoirpou4om  lfcs s srua(rp;u1aex io3iadfs rau p;t0aeeoxf ootfmD luvs s seuoxopiu4lmtnmfetl()srtm(m no0tlxnmfciyd a emumo t0 etnxo3oy1fp elies s trurio3ou1lp   fvtlt) rrru p;u1oltoif3iatfm2emnmsn(0tetnio oa1fmtraivi;t0 2umim oydlpen ivsls aDuax  nu1openifciyd a2emn o;t) renif3ty1lpDran o;()sruriopnodamt lncsls)srtr(rpot4opto oeilt a rm( o;u)teerif3oo1fmDraues;s)teuo(o no1amenmneil(fsDurxm oo1olen fcilslsDemu s;(4alerio totfp  au s;s srtrio nu1opeelivi ()a2raumpnu4opt  octytfs2rm( p (0 ltrxociy1fm rauvilt) rum(m nydam nlfei t  rtrx  nu0tee iictltfmDrmnmsn()arxnmr ootomDranes;t0sruoxr3io4aptemiesltfaDtm( pnt4alen ietltls emuvp;u4tlxoif3ty1lmt anei t)texoim3no4ol  mfcsa()artr(  nt1oexnmfcils a emnmp ()teenxo iadlpDelnvs;s0 2urxm3iydapenmfctas  rtaxrp;t4ale mf3iydfa2um(vo u4alxnmf3oatopDe ivs;t0seum(o3ou1altn feia(fa2rru pot4optn i3tad m2em(vonu4 etrmr tadfp eaieo;t0texoxopoydam emncs tfs2ta(  ou4alx  o3tadfaDemnms t0aetrmocio1omDeaiei;s t2xrxo oydal nlietls sDumx  oo4tetomictatfa umn snu0alenio oatfm r ueo s0t2trio nu4ol nmivs ( sruau  nu0tlt ifeiyt mDeauvo;t4texoio oydoatrlivs (0s2xoiopoydll e fvsas srrrxro;t4alxoio3ildfa2um( ont4 lxomr oydop ranvs s)trtr(opiodaltnmfvslsfsDuaxmoot0tptoiieilslmDulu o;u4aexnir oydoa r nei (0seurxm3iodomte feilt) Dtru  nt0altnmoeiasla2raums;u0trtomfciotoatrai olt  eumir3nodomt  ictl()s2tm(rpnt1oee ii3taslm rmnmpnu4trxnxo oadfp e nei t0srxriopoo1ameemfcil( aDraxr nu1ape  o3iadfa ulnvs;(4altrif oydoaDrauvi s0sexmxr3oy1ale mncslsfsDrm( p;t0apt ioetysfm2uan p ()tlxnmf3oatoptraivo;t0t2xm(r oydaptn ivta( aDumurono4aeen f3tlsfm2em(ms;t4alxomr tytfp rlnvsls)srxoio3ny4apeemivsls)s2rmu pou1alx  ociadlm2uanmp;u0 leoxrcoytlatranei;s0seurim3ou1lm   fcias)aDta( pnt1texn i3iydfm emnvp u0arenmo iadfat  iei t t2xo(mpiy1amt  fvslsfa2rrxrpou4oltnio3iys mDua( pnu0 rxoxoctydlm  livilt sexmimpiydlle livils)s2ta(mpnt0altn icilt sDrl(ms u4trtnxrctotomD lieo ( s2ur(r iu1ol elncs s sDra(ront4open feiat m2ea(mp;t)alenif3tatlpDranes;s srur(mpoo1llee nvtlt)aDtru o;u4alx  octydlm2rlnmp;(0 etoio3tadfm e nvsls)truoxm3ny4lm e ncsatfa2umxmp;t4tpx ifetls m2rl(monu0arxrir3oo1laDe nesl(0trxrxm io4amtnmfct s)s2rauroot1oet moeildfs2el(mo;(4teeomrcoydfpD  uesl(0trtm(r oo4omte ictlt arumx  ou4apto o3iadls2rm( snt0 etoxfciatlaDran s ()teur(opoy1lp emiei (fsDraump;u4oltoioeiadlsDrm(mo;t) rtrio ia1op  auvils seto(o3io1ol n nvs ()arrru  oo0alxnmoeiyt m2uanms;u4aeenxo ta1lpteaiei s)tetr(opoo4altnmietasfaDtax  oo0olx  fetydfa umn pnu4tlenmr3iytop rlieol()trtr(r oy4lp nlfeta( sDurur ou4alx if3tydlmDrlnvo t0treoif3oa1fptelneo;t0 exr(o oy4lm  mfesat  2trxrp;t0aexn o3tls m rmn o;t) renio3tadopt anvil(0tetr(rpio4apen fvtlsf Dtm(mont0oexomf3iltfa2rm(vp;u0trtnxf3ty1lmDeln il( sexmio oodoptemfvsatf rumx poo1opt mi3iadls um(vo (0tetrir3totfa   nei (0 exoxm3io4am  miei ( aDraxmpno4oeenmietytfa rlu s;(0arermr oytlmDraiesls)s2tmxo3nudopte icsa(  2umu o;u4oexoiociadfaDrm(ms;t0tlenmrcto1la  livi t0 exrxr iudomt lnviatfsDtmxm no4tlenmocias mDrlnvpnt4teeoxfcoatop raieols t2xrxrpnodom nlici t)sDumur ;o0opt  ociasfa rm(vp;u)tleoif ty1lmDrauesls0 rtmir ny1ll   feiat)a2tru  ou0tpenifeilslaDum( o u0 ltoif oy1op eauvo;t0seumxo3oy4alt mncs t  Dtr(m ;u1alxn i3iasfa eanvp u4 ltnir oy1fmt anvs;t) etr(mpny4ll  lfcsa(f rtru onu0tpt mieias s ranvo;u0aexrxr3io1fatrai o;() 2um(o3nu4apeemfvtat  Drrx p;u0ole mo3iad a2rl( o t0trxrmfciotoatean o t0texrxr iudaltnmnvi s s2tmxr ;u4oetnifciatfs2ul(monu4 rerif3oydopDe ivo;(0srtm(m oodamt lnvt ( aDrauroot0olxoiociltfaDeau onu4altomr3to1fat luvo t)seto(rpoodlm nmnvtl(f rta(ront4apenioetltfsDeau pnt) rtnxrcty1omtelnvol()s2umir oudopte ietatfartrum nt1tpe iictls m2emnmp;t) etoxocta1opDe ieol(0 exoxr3ny1ol  mietas sDrmxrpou1tpe iieias s2umump t4 leomo iy1fp eauvo;s s2umir nodom eliesl()a2ua(m nu4alxnmfeiat s2rm(vpnt0artoxf3oy1fate i i;t)t2xr(m3io4lp  lnet t aDtax ono1olx ifciatfa2umn o (0texrmo oatop  ln i;s)setoxr3nudape  iesas)a2urxm no1aetnii3tltls rm(vo;(0arxrmoctodfat  n s () etmxr ou4lmt  feil( sDrau  oo0tlto feiat sDemumo;(4altnir3oo1fa e i s;s0s2umxr3iu4llee nvslt  2trurono1olx  fctadlm2uaumo u0 rtnxo totlat  nvo (  2xoir3oo1llenmfvta(faDtrx poo0olenif3iatlmDul(von(4tltoir3oa1latrau o;s0setm(o ou4al   neiatf Draxronu0tltnio3iadlsDuaums u4alxoio3oo1fpDraiei;(0s2uo(opoodlpe  netatf 2rm(mp;o1tpxn fcias mDel( onu4alxomfciatlpD luvilt s2toio oydlm  mnctat sDtrx p;t1tlxomo3iadfaDrmnvpn()tltoxr iytlpD livi ()tetmirpnu1ome  iet ( srumuro;t4oeenmi3ilsla uln on(4tetoiocoadom eln o;t0 2toxopiudalenmietat) rtaxmooo4olto i3iyd m2eauvs ()tlenxr3ty1fmtr u s;t0sruoim oudalt  fvsl( s2uaum oo0aex mo3tlt s uauvont)alxoxf3ty1oa raneil(0 rxoirpoudamt micslsf 2rmu oot0alenii3tytfm2ua(ms u0trxrif3tatlatean il()seum(mpoodamee fvtls  2ta(rpou4optnif3tad s2emnms (0 exnif tatomtelneo;(  rumxm3nu4oltnmncs (f ruax poo1olxoioeiatfs2el( o;(4teenmf3iadfp rluvols)s2xoxm3oodale lfviat a2ur(m ;o4aeeo i3tlsfm uluvonu0alxrmf iy1lp rlivols0 rtoim nodap nmies sf Dumx  oo0olenmieiadfa2rmnms (0arxoxr3oodomDraieolt0t2uoxopnu1ll  mfvsl(  Draxroot4tpxniieiyt a2rm(msnt) exoio iadoa r uvs (0srxmxr3no1oleelfeia(f 2trurp;t0apt  ietlsls2umuvo;u4 rxrmr iotomtelueo s  euoio3iodap nlivtas  Drmuront1tetoiietltlsDrl( o u0 rtomfcta1laDraueo (  euoxopnu1lltemnesa( a2rr( o;t1apxn feiydfsDuauvo;(0tetrxo oytfp r n ils)srumim iodlm n ieslt) rta( pot1oleoio3ilsls2uauvo;t4tlxomo tydfa elnes;s) eurim3oy4ame lnctlt sDum(r nt4tleoif3taslaDea(von(0alxrxocoo1laD livs s)trtr(mpio1op e ivil(fa2raxro;t4tee iociadlm2ulnvp u)tlerifcootopDrli o;s0t2ur(o3nydaltelfetls s2um(ro;u1tet ii3tysla ra(ms u4treoiocoydlm   i il(0t2umim ny4ameelivt t  ruru  ou0ope mf3iyd s2uau o;(0 leoxo tytfmtr uvolt t2urxo3no1amen nci t)s2trx  nt4opxn f3iltfs2emnmsnt)tltrmf3oytopD lueo t0srxoxr iodope mfci sfaDumxrono1apeo ieildlsDeln s;u0tltrioctytfaD  u s () eur(m3nydop emncs (fsDtaxrp;o4texnmo3iad a2emuvonu0 rxnxrcoo1late nes ()trto(r3oo4lpe mfet ( sDra(r oo1aex mieiadfs eln p;u0aetrmf3iatlpteli i t0 exmio3ou1am e iesls  rrru  ot4tle iociasfsDrmnmpnt4texoiocoo1opDrlu sl(0t2xmiopnu4open ieilt)s2tax o;t4ole mietltlm2ul( p;t)arenir iy1oaD li sls  exmir3iydamtnlnci t sDrr( pou1oetnii3ias sDemuvs;t4 rxnxfctotfmt ai olt0seuoxr3oy1amt miei s)a2rmu pot0apx mf3iyslm2ulnvsnt4trtomo3iotlp rlivol( teurxm3nodlpt mfesasfsrur( poo0olto f3tat sDeanvs;()tltrif oy1laD  nvolt truoir3iu4amt  ivt tfsDua(mono1alx ioeilslm2rmnvs t)tetnxr oo1lptr ivo s  exoirpou4lp  lict s sDuaumpoo4oetomieiadfa rl(vo;t)tetrxo3ta1fmt anes t  2uoxr3nudape lictl() 2uaxmpnt0aex mocilt mDel(mo;u4 rtrmo3oytopt au o s)trurxr iodlmtnliei ()arumumoou4alt  i3tysfaDrm( on(4artnif oo1opDeanvols0 exm(o3ou1opt lfcsls)s2urx  no1apx  iciyd sDuanvp u4tlxoxfctytfpD  n o;s) exrxmpou1open nvt (faruru  ;t4aex io3iytfaDemn p t0 exnxf3ty1fptraieslt  2xo(r io4lme licsa(fa2umu ooo0optn ictad m2ul(mp u)trtnir3iatop   i i s) eum(m iu1lle lietat)srur(  nu1tetomf3ildlm2uln pnu4 lxrmr iydla ean o s0trtmio3iydamenmivi (farrm(mpot0olto f3iasfm eln s;t0aetrxo oa1la   u i s0 etrxo iydllt  nvsltfsrrmurpou0oex mfeilslsDrau s;t)artnifciatfmDeluvil() etm(opno4aptn iesl()arurx onu1oexn feiadlm umnmp t4trxnirciadlpDe i o (0 etoxopiodamt  fvs ( a2urxm ;t0oee  o3tyt m um(mon(0 etnio oadlpDrlies;s)t2trxmpou4olenlfvtatf rtm(ro;o4oeto ietydla2eln p u0areoxociy1lptr nvi s seto(m3ny4omtnmiciat)aDurum ;o1opeo i3tytfm emn ont)altrifcoydfmte iei (0tetrio3nydol elfes sf 2uaurp;u4tltn ictyt s2ulumpnt)alerxo ty1fptraueil( t2umiopno1lp e ivsat srtrxr ;u0apxo fetldfm2em(vo (0arxnmrcta1op  livo t)t2xmxr nodllt licta()srraur nt4oet ioetltls2emnmsnu4 lerxf3iytomD  ivols0 rtoir3io1am  mfcia()s2ua(ro;t0aexniieilt aDra( o t0tlerxociy1lp eaivo t trurxm ou4apt  ivtatfaDtau o;o4teen o3tyd aDrm(vo;t)aetrio3tydomte uvi;s  2xo(r io1lm  lfcilsf Dur( o;t1aptniicildla2raumo t0aleoxociatoat  ues;t)s2xrio no1am nlfcil()aDumxrpot4aetnmoeiltls uan o u)aetoif3ty1oa eaies (0setm(o3iudlp  liet tf rrm( pno4olt io3iat m rlu snt0 rxnxrcootom r n slt  eum(o iy1ape lncslt) rtrxmp;t1ope miciasfs2ea(vs (0alxrmfcoytomt  n s s  etr(r3no1lmt mfeia( srua(mo;o4aptnifciasla umump u)tltoxf3tytlmD lnvi t)seum(mpiodlp n ivils) rraxmpno0texomfctlt s2eauvp;()alxnmf3iydfaDr ieo;t)sexmim iydop emnvtat a2ur(rpno1aexoiocilsfaDran o;t0 leoxr iy1lpDe ues ( texrxm3oo4ole mivia(faDrm(roou4aeeoiieiatfm2rmu onu0artoxo oadlm e i s;s s2uoim ny1am elivtls a2ururo;t0alxo oeildla emums (4alermf oatfp e i i s trtrxrpiudom  mnet s artmum oo4oltnmoeiadla2ul( on(4aeeoiocoo1lmDr nvo ( t2tmir iu4lpeelncta() Dtrxmp;u4tlxomo3iat a2rl( s (0trtnio tydlmDranvo;t tetmxr3nu1lle lfeilt  2tmuronu4tle if3iyd sDumump;u0 rxoxo3oatfaD  n o s) 2xoxo3io1ale mncsltfsrtrx p;t0teenmieiys aDea(mp;()arermrcoytlmDelivols0 rtrim ny4ol nmnet (f ruau  ;o0tpx ii3taslmDumu s u0texoxr iytopDe iei;s sruoir iodlmt mfvt t) 2rm( ono0alxoif3tad sDrlnmo t0tetnxo oadfat lueols) 2umxopoy1lm nmnvsa() Drr(m nt4apxo ieiyt aDrm( s;u)aexnmr totfpDranei;t  2toxopnudolenmnetltfa2urxr ;u4tptnioetytfs2uluvp;(4 lenmr oo1oat luvs () 2tm(opiodame  ivsas) Drrx ont0oltoii3iyslaDulu s;t0tleomr tytop r neo;t)teuoxm3ny1ame lieiat) 2urxmooo1tle  feiys mDran p;(0 eerxo io1lat an ols  rtm(m3nodal  mnesatfaDtmxmo;t4aeeomfctas m umnvpn() lxrir iodom rlu o;t0s2xm(rpnu4ll emicsat)a2rm( p;o1ole ioeild mDem(ms (4 rxrmr3ootomDeluvo;s0teur(o iodomtemfctlt  2taxmpno4opx ifeiydlm2ua( o u0artnmo oa1oa e uvol(  exrxr oydomt  nct (  rrrx  no0tltnmoeiasfsDulu p t0tltrmo3todfatraueo;t) rto(opiydope  icilsfsrrrumooo0texnmieiyd a umn o (4areomrciodoa e nei t  ruoio iy4lmtelict tfsrum(ronu4apxnif3tldlm ean s u0tetomocoy1fatrlivols)t2tmim io4oltnmfctasf rrm( p;o1olenmictadfs2eau pnt)altomr oytopDeai il( sexr(opiu4lpe  fcsa(  Dua(ro;u4opxo octasfs2rmnmonu4aetnmo oa1laDe u i s0tetoir no1ll e fei sfa2um( onu1tlen ietatls rlumpnu) reoir3oodlpDeaies t) 2uo(r3iydome  nvi t arurumoot0alen iciydfsDum(mo;(4trxoxf3oatoateanes t0 eto(m iu1llt  ics (  Drau  no1tee mieiasfmDemuvo;u) lenmociadopt anes;s0trxoir oo4lm   fvta()s2raxmonu0opeomietls m emumont4aetomf3to1omD  i ilt) rxoim io1oleelfvilt  Drmu p;u0oexnio3tysls2uanmo ()tltrmocia1fatr nes;t) etrxo3nu1amen nesl(fa2trxm ou1tleo ieiytfm2ua( p;t0 rxnir3iytlmt lneslt  2uoimpiydom  lieils) rtmxmoou0oet moctaslm2emuvsnu)altnir oadlmteau o s0 rtr(r nu1opt lfetlt a2rrur no4apxomietls a2ul(von()trtoio iy1lptrai s s  2um(o nu4oltelneiat sDtmx p;u1ape ioeiltlm2emnvsnu4alxoxrctydop rau o s seumir iydam  mfctls sDrmu ono4olxn f3iysla ra(monu4 lxrio3tydomteai o t0srtoxm iy1lm nlfet s s2ur( ono0texnio3tyt mDulu on(4altoio to1oateli i t)s2xr(m oydam  lfcsl(faDur(rp;u4aeto f3tyd mDrlnmont) reomr3iadlaD anes;t)srtrxr nu4al n ics sfsDumxmpot0alxnii3iadlsDemnmpnu0tlxnmf3iadoaDeaivs;s s2tr(mpoy4lpe  ict tfs2rrxmpnu1olt ioctlt a2uluvo;u0 rtrmr3oodlmt  uesls0trxmiopiydopee nvias srtrxm ou4oeeo oeiasfsDemnmpn()trxnxo3tatomtran i;(  2xrxo3oy1altn ietas sDrr(  ;t1aee iictys m el(vs u0aeeomf todfaD luvo s0 exo(opoo1ap  mfet s)srtr( ooo1olx iietls a2uluvpnt4 leoxr3io1laDrauvo s setmirpoudom   iciasfa2ur(rp;t0apeo f3ildls ean snt4arenxrctodlpte i ilt  2umim oy1ll nlnvtlt) 2uaxm ;u4oet  octyslm2rluvp;(0 exrxr oydfaDrliei;(0t2umim oo1om nmfciat)aDrrxr ;o0alxn ieilt a2eanvont0tltomf oytlmte i s s)teurxm ou1lm nmieil() 2uauro;u4tpen ietlsls ulnvonu4 lxoir iydfaDrlues s t2xmio3iudap emfciltfs2tru poo0tpt moeiysfm elnvs;t4arxrmr ia1opte ivol(0s2uo(opnudol  mfvias)aDuaum ;o0oexomo3iat a2eln o t0aexrmf oatlm   nvolt)t2triopnodlp nmicsls aDtmu  nu1oetoifeiatfsDum(vo;(0arxnxr oo1fpDelu i s0 2xmimpio4altemneiltfsDtmx  nu4aptomo3ias m uau o (0aeenxoctadomD an i (0texmxr iy4opte nct sfsruax  ou4opeoioeiyd sDuln o u0teeriocta1omDran slt s2umxr iy1open nct sfs2ra( p;t4apx moetat a2um(mp (4aeeoio3iadlaDr uvo;( s2ur(o iy4al nlfes ( a2uaur oo1olen fciyt m2ranvs (0 ltoir oodop eanvo;()srxoio3ny4opeelnetls)aDum(m no1ape  oeiys m ulnms;u0aexrmfcoo1la eluvo s0teumirpiudol  mneta(farum(m ;o0apxomoctyt m emums;() lxnxfcootop  li ilt srxoxr3nu1oltnlnesa( s2ua(mont4tetoif3iat mDrl( snu)tetnxr3iytfm   uesls)texo(rpoo4ape mnct sfs2taum oo4tpenmietas a2um(mo (0aexoxf3oatfa r n i ( seur(rpiu1alen nes tfarum(r ;t4tlenifetatfmDuau p (0altnio3iy1fpt  ivo;t)s2to(mpou4omtnmncsltf rua(rpno1olxoioeiadfs2rluvs;u) exrmociytlpDr u i s0s2to(opoo4aptnlfeia(fs2taurpno1tpx mociys m el( o t4altrmo iydopDraivsl( seuriopno4alee ivil( arrmum oo0opeoio3iad aDemn pnt) lxnmo tytla  lueo t0 ruo(o3oy4lmee ivilt) Draurpoo4openiieiad a emnvs ()texrxr3iydfmDe nvolt0seurxmpnu4al  mncslsfsDumx p;o4tlenmictad mDranvo u4treomo3totfptr nvs t  rtoiopiydaleelicslsfaDrm( o;o0alenmfciydfa uluvo t4 ltrxo3todop r ivs () 2urirpiu1omt lfes t)a2ururo;t1openmoeild mDeauvon(0 etomf3iy1fpDrlu s t0 rtmiopiydlpee fes t)sDraumpnt4oexomfeildfs2emn snt)aeeoxfciadfpDr ivs;t0s2xoxmpny4oltn fct ( srtr( ont1oetniiciysls2ra(mpnu) eermfctodfm  auvolt0t2ur(opoo1lmt livtasfa2tr( o;o1aptoiiciat mDemums () rtnmr tytlpteau i (0srxoxr3oo1lle livslt  Dtmx o;o4tet if3iasfaDua(mo u0tetnxf3iy1op elu ol(0texr(o oo1optemicil()s2uru pnu4alt mictls a2rmuvpnu4alerif tadlaDeluvils  rurxm oo1omen iesls) rtmur ;u0ope if3tld s emnmon(4aexnmr3totoaDrai o s)tetoxo io1am  liei s aDtrx o;o0aee  o3iltla2umn p t0tetniociadlatelivils t2trxo3nu1lptnlfvs ( a2raxm ;o4oleo f3ilslmDumuvo;() rtrir oatla  au i s)trtm(mpoo1am nmfcs t) Dtrur nu1oeenii3iysls2eluvs;t4 renmo iodomDeaiei s0 2tmxmpiy1op elfvtls) Durump;o1aetomo3iydlm ea(mo;u)aetrir3oy1fmtr ueo;( t2uoxmpoo4opeemics tfsrrr(  nt0oeeoifciadfs2umnvs t0treomo totla elu ol(0t2xoxm no1altnmnvt t)arrmxmp;o4aptniiciys a em(ms t4texrxociydomDr nes;s) rxoxo3io1lptemneslt aDtmumont0aeeoio3iydfa uluvp;(0teeomocto1fmDr ivolt0 rxm(m oy1openlnes (fa2ra( o;t0alt mieiltfaDrlums;t0 lenmrctatlptrlneo (0s2xmir3iy1olt  fcslt)srtrur no1altnmfeiad sDem(vp u)arerirciydfa r uvo;s)seumxr oydlp e nctlt  Dra(rp;u0aee moeiytfm2um(vs t4 lxnif3oodom  anvi;t0trurxopoo4lpe lfet s  Duaxro;o4tlenmo3tld mDuan o;u4artrir oa1lat anes;t)texoxm3nu1oleemieslt aDua(m ;t1aetnmo3tyt s2ul(vpnu)trtoif3oytfp rli ol(  2urxm3ou4aptnlivsas) 2taump;t1tle ifeiadfaDrl(mo u)artnmo3iytoatrlies;(0truoxopny1omee netlt) rraumoot1opxn f3iat s2eln o t0texoiocta1om e u o;s0t2urimpoudlmen fvt t)srrmx  nt1tlenio3ilt s2umnvon(4tetomr ia1fmDrluei;s0s2xmxo3nodoltnmicsa( a2rm(mpoo1opeomoctasfa2rm( p (0arenio ia1opt lneol(0s2trir3oy1oleemnes (fsDrr(mpno0oexniictad m ulumpnt4aeenmf3totfatr ues () 2urir3ny4alenmfvsatf Dtr(  nt4aptniociatlsDrauvsnt4 exnir ta1lpt  neils  2tmxm3iu1apenmnctlsfsDumxrpoo0oee moctlsfm el( p;(0texnifctydla elies s)s2umxr3oo4al n neta(faDtm(  ;t1opeo feilsla2rl( onu0 exoir oa1lmD ai ilt)s2tm(r3oydlp  mics s srtr( onu1oexoioeiyt m eanvon() lxnir tytfpt aueo;(  ruo(m io4lpee fci t)sDurxrp;o1openmfeiatfm el(vp u4 rerircoa1om ean s t  exr(r3oudlmenlnviat aDtr(rpoo1aleomi3iyslm ranvs;u)trxomf oydoaD ai i (0s2tm(o3iy4ll e fetlt)a2ua( pou4tlt  o3iysfa rlu snu) rxoxo3ty1omt ai il(0s2umxmpiydale lnesasfs2raumo;t1aptoif3iydlmDrlnmp t) lxrio3todfmtrlnei s srtrio oodamt  fvs t aruauro;u1tlen i3tatlm rau p u)aetnir3iodomtr u s;()teuo(m iu1oltn fesat) Drr(ront0apxn ociys mDemumsnu0altoircoa1oaDraivi ()s2tmim nu1omtelivs () rua(  ;u1aptomieiad aDra(vp;u0 leoxr3tatfaDr nes t t2xrxo ou4omtelnet ()arrmu pot1tpxnmf3iytlmDemums;()aetomfctydlaDr i sls0srxoir3no4alee nvsas) rra(  ;o0tlxo icilsfm rl( s t)alenmr oodoptr u i t  eur(m nudol n iei (f 2ur(  nu0tpeomi3tatfmDem(vonu)aetoir3oytopD  ues (0trxrxopnodop   nvsatfsDraxm nt4texoifciydlsDum(vs;(0trermr iodla eln s t  euo(o3oo4lltemfcs ( arrrx  oo4tlenii3iytla ulums;u) lerio oydfp eauvi (0 etoxmpio1opee feiat)arrrurpou1aeenmo3tat s2ulumo u4artnxo iadfmtraivs ()texmir iodopenlict s s2rm(m ou1aexnif3iltlaDumu onu4tlxnircoy1lp elueo s seur(o3ou1omt mfvtltfa2uaumoou0aeen octadlaDrmumpn(0tlxrxf3iatfm rlieols)srtoirpoo1lm e fcta(fartmurpnu4tet ifctydfm rl(vo;t0 eeoir3oodlmt lneolt)srxoxo iy4ol  mnci t) rurx  ;t1tlt  iciad m rmuvs;t4 lerio3io1lmte uvo;()s2urxr3ny4llt  ivs ( a2umur no1tptoio3iadlm rmn o;(4trtoxf3oodla e i s t s2xo(r oodomenmfcilt) rum(ro;t4texo feildla2emuvp ()trenio todla eai il()texrxr oy1lptemfci (f Dtaxrpot1opto o3iltls2umn pnu0 rxoioctytomD anvi;s  rtrxmpnu1om emfvt t)a2tmxmo;u1aex moetat mDua(mp t0arxnmo tytoptraivilt  rxmxopiy1lmt lnvilt)aDur(m no4oet mfcildlmDulumsn(4 renxfcoytfm elu ils) rxo(mpoy4apt lfci () rtr(monu0teen oetad sDrau s t0 exrxfcoa1fmDrlu i (  2tm(o3iydlmeemfctlt a2trumpnt0ole  ieiltls ul(vp u4trtrxocia1fmD aneo;( s2um(o oodlpenlnctlt)a2rr(moot0tee mfetlsla2emumpnu4 ltnxr3oatopDrauvi;t)s2trxm3iy4ol nlicilsfartrxr ;u1oeenmieildfm ulu s u)aeeomr oa1optrlnvils0 2uo(r3nodol eliet t  rtax p;u4olx mi3iyslmDrl(vo;u4 renxo tadomt an i;s0srxmxo3no1aleemfet ( sDumu  ou0oet ifeiatlm rm(mpnu0 rtrmfcoytfa  aieolt trtoxo3ou1amtemfet tfa2rru ono0alt  fciyd mDean p (4aeeoir oytfmt lu i;t  eum(rpiy4lptemfvilsf rrmx o;u0aeeo ieiat s umu p;u4aetrxf tatfm  aivsl(  rumiopio1ll nlfvtls)a2uauront4tetnmf3tysfa ulu o;t4trxomr3ta1lmt  neol()t2urim nydale micil(fsrtr(ro;o4tex ifeilslsDuluvsnt4trtnircoydlaDelnvi;t)t2tm(rpiu1omtnmivils a2tru  no1tpe mo3tlt s eauvo u)alerir iydom  lnvo t) 2tmxo iy1am e ivsl(fsrua(  ;u1aeeoio3ils aDrm( p;()trxomr3oadomDraneo t) rtrxm3oy1lpt lnesltfs2rau poo0aex  ieiad mDea(mpnt4 rtoxocto1opDrlnvi (0s2trxmpiy1olt  ieilt s2umx oou4tpxomf3iltlmDuluvs ()aexnxo3iodoaDrln s;t0truoxo oy1olenlfct (fa2ua(m ;t0tlto feildfa2ranvsnu) reomr ia1omD lu i;s s2umxm iodopenlnvt s)sDtrum ot0aee ii3ildfm2rmnmp u4trxnmo3oadfmDr iei;t s2xoxrpno4al emncias a2tmuro;u1apxnmieils m umnvs u0aetnifcta1lptelnvslt)trumio oydope lfeia( aDtau oou4oeeomicilt aDrl( p;()trenxocoy1oateauvsl(0tetr(mpoy1lmenlneta(  2rr(  nu4ape  i3tadlaDrl( p (0 eenif to1op   nvo;s0trtmxr no4olen fei ()s2trur oo1texomi3iysfs eanms;u) ltomr oodomte ues (0 2xmxrpoy1ap nlieia(f Dtr(  ou0teeoifeiat m ulnvp (0 renmo3tytfa e uei;s0texo(r oy4openmfvia(  2tmu  ot0apeo f3tadfa ul( s u0 ltrmo tadom  li o;t srurio oodomtnmnvt t)aDrau  no0aptomoctys s emuvpnt)tltomr3oo1fmtran o;(  exoim3nydal e nvs sfa2ra(r nt4apxo i3iyt aDemu p;(4teeomrcoo1om ranes;t)trxmio3oo1ap n netatfaDrmumo;o4tpxnifeiys m2emnvsn()trxrirctadlpD lu i s)s2xoxm3iy4apeelnctlt a2um( ooo0aeeo ieiyt mDranvp;t4 exnxr oy1fmDelnvo ( s2toim oo1ole lnvia(  Duaurp;u0aee mf3iyd s2emn ont)tltrioctydlmDr ivi t teurim nu1llee fciatf rtau pnt0tpxo feiltlsDea( s (0 eermfciotla r n ols  euo(m3ou4ame  nes s sDumu oou1alx  fciad mDum(vsnt0 lxnxo3oa1fa e ivils0t2tmxrpnodomt lfctas srum( oou4tex  iciad s2rluvsn(0aleomo todoaD liei;(  rxr(rpiydol nlivi sfs2tm(ront0oeeo feiadfs uau o;t) leoxrciatoptrai o t)sexo(m3nu1lmeelncilsfsrrmxrp;u4tetn ociydfs2el(mo (0tlxrmf iatfptr ieol(0s2urim nu4lle  ivt t  Drauront1tet  fcilt aDrauvs;u4areniociytomte i s s0 rtm(m3no1aptnlies (fsDrr(mono0tee mi3tad m el(mpn(4 rtniocoatfaDe ieo;t0 2triopnudap n nvil( a2ua(m nt1oetoif3tltls ranmonu)tlxrxr oytfa eaivo ()trxm(m3iu4am   fvi tfsDtr(mo;t0aetn oeildfm2ran s;t4 rtnxo3iotfmtranei t  exrxr nu4opeemicsa( arraur nt4tlxnioeiadlaDul(vo;u4tlxrmo oa1fptr ivolt s2xoir3io4lpe  feil(  rrr(mont4altnmoeiasla emu o;u4 rermocty1fat  ivols seuoxopoo1lmtemicsa() Duaxr ;u4tle iiciadlaDulu pnu)trtnmr3oodfm eli i;(0 2xo(m3oo1ll nmnesl() 2rax pnu1opxnmo3ild s eanms;t0trtrxrctodlate n s ( trumxo iu4om e neiat) 2umxr ;t1altoif3iasfmDuau s t)alenxoctodfa r ieil(0 eumxo3oo4ap emfvslsf 2tmuroot0aexomi3tyd mDrm(monu) rxnmr iytfa r ivils)trurxmpnu4omtn fvtl(f 2ta( oou4alxnio3tydla ua(mo;u0areomfciy1optrlues;( t2xoxrpio1llt lieia() 2uaumpnt1tltnmo3ild s rm(ms ()texoirctadop rluei;s0srtm(m3iy1om elneiasfsrtrurp;t1olx ioeiat s rmnvp;u4trermo ta1lmDeai i;t)trur(o iodlmtelics t)aDrau  ot1olen i3ilslm2rmnvs u0 eenxocoydlmD lnvils trxrxm iydlmtn neslt s2tmurp;u4tpeomo3tys m2rl(msn(0 rxrxo oy1oat  ieo;()s2um(opoo4llen ies (fa2trurp;t4olenmi3iys s2ean sn(0tltrio3tatlpD au sl(0truo(o oy4opee fvs ()aDum(mpnt4opxo ietysfaDrl( on() rxoxrcoatlp rlueo t texmxo io1op nmnvs tfsrtrumo;t0altomiciasls rlumpnu0 leomo tydomt ai i;t t2xr(m iodlmee fctls arumumpou1olt mictltlm2rmuvo;u0aeermo3io1fatrliei;(0 etoiopiudlleelieil(faDraxro;u0oet  fetydfa2ua(vp u4alenmf tytlpDrln s;(0s2xoim3no4optnmfei (  Dtmump;o4aex ifciatfmDrlnvo (4tetrxf iytlpDrlieo () rtm(r3io4ale  neta( a2tau p;u1ape  ietat m2um(mpnu0 leoxrciotopDr nvo s) eumim oodomenlfes sf rrru pou0tleoioetydls em(mo;u0 reoir3oy1oa e n slt  2umxrpiu1olt  fetat)aDumxrpot4olxo fciad a2ra(mo;() etomo iytfpt ai s;t) eur(r no1opt  ictl() rur(  ;t0texoiieildfmDum(vs t) rxoio iytfmtrlu ilt) 2xoxm nu1om n ivsls) rur( ono4teeoii3iysfmDuau p u0aeeomfciodlptraieo s  2xrimpio4lle  ivsa()artaumonu0opx iieiydls rluvs u0aexoxfcio1lp eli ols0 eum(o nu1lptn fctat s2rrump;t0tex mietltlmDem(vs;u0tetnmr oo1la e uvo t0trtoxm3oo1opte fet t  rrm(r no4oeto fciatfa2umnms (0arxrmociy1fat aues;s0 2to(o3iu1lle mfvsatfsDurum ;u4ope mf3tadls rl(vo u)tltoxf iodopDraies;(0 etrim oo4al  lfctlsfa2taxmooo0oetomi3iltfs umumo t4 eenmo oytfa   ies s  rumirpoo1lp n net s  rra( pno0aee mo3ils m umnmsn(0 lxomr oytlat anvs;s t2uo(o nydllte iviltfsDraxmooo0teenmoeiltfa rluvo t)aeerif3iodop elues;(0trxrxopiu1opt lnvi (fs2tmuro;o4olx moeiad aDelu snu4 eeoif iadla eaies;s s2xmir3nudalenmneils) Drm(ront4olxo ieiys m uauvp (0 leoif iotopt aneo t) rxoxm nu1am elneias  Draumooo0altomfciytfs rm(mpnt0 etnxoctadom elnvs;t0s2xmxm3io4lmeemnei t)s2tau onu0apxn ieiysfs2eln p;(0 ltoio oatlmD  ivi s0 euoxrpoydlpte fcil( s2rax o;o4aexnio3tydfa rmuvpn(0 eenmocoodom r ivi;t0teuo(o3iudal n feilsfs2um(ro;o4aptoio3tysfsDem( p;t) exoxf oy1latr u i s0 2umim3iu1oltelnetasfarta( ooo1teeomieiydfm rau p (0tetnmr3io1omtelues;t0 rtrio iu4llt  fvs t)arrmur no1oex iiciad m2rluvpn(0 leomr iodfpDr uvs;(0teuo(o nu4ol   ivs (farum(m oo0oexoii3iaslaDuan snu4trtrxocoo1lmteaivs;s)tetrim3nydoleelfeilsfs2rr(ro;o1tlx ifciydlaDraump u4tlxoio3oatop  anvils  exoio3iydlptnlfes (f 2tmu poo4teenmfeildla ra(vo u0trxnxo3oa1lp elueslt0trxrxmpoudamtemfetat a2tmur ;u1texoifciat sDrauvs;(4 rtrifcoadoateaivslt  rum(m3iy1ape mfet ()srur( pno0tptnmieiatfs ul(mon(4 ltnxr iatlaDe nvi;()srxmim3iy1lptn fvi t  Durxm nt4optomfciltlm2eln s (0aeerio3tydopD li olt0t2to(r3io4op n nvsat s2rmumonu0aex ioctatfaDumums t)arenxf3tatfp rlu o t)srtoio ny1olenmiet t aDra( oou4texn o3iltlm uaumo;u4 exnir3ootfpt  nvo s)s2to(o ny4op nmivil(fsrur(r nt1aptnmi3iytfaDran ont4aetoxo3tytoa  lnes;(0 etm(m iy4ll  mieias  Dumum nu0aeen i3tadfa2um( o u)texrxo tytlaDelueo ( trtoxr3no1al nmnvtls)a2tmxr ot4texniiciasfm um(vo ()trermociatoate u s;(  2uo(rpiy4ll n ivs s)srtru o;t4tet  fcilsla elnvo u)teerir3tatlmDrli o t0trtoxrpoy1lp   ietat)aDrrumono1tleo octas a rln on()tlenxo3io1la  lu sls  eum(rpno4apenmivsas a2ua(rp;t4optn iciydla2ranvsn() ltnmo tatfpt  nesls)setoxr3oudlm elncslt) 2tmurpou1oleo ociydfa2el(mp u4altrxr iatomt ai s (0 rxrio3iy1open fci ( sDtauroot0oee mfeiysfaDrmumo;u)arxnxo ootopDran olt  eur(o iy1ol nlnvs t  Duaxm oo4alxo oeils m emn on(4treoxo oydop   uvi t  etrxm3ou4amenmivtl( arta( poo0olt ioetlslsDeln pn(4trerxfcootoate ieolt0srumxr3no4ll e neilt)sDtaum ;u0tpeo ieias sDrauvs;u)artnmo3totfp  lueolt0srxrir3oydale lfciat)a2tmump;o0opt mi3iadla2umuvs;t0tlxnir3iodlptrlneslt0 rtoxr3oodol nmivs (  2umu ooo4oleo ociadlm umu snu0teermfctatlp e nvs t)t2tmxo iu1lpeemicslsf 2rm(roou0tlen ociys m ulnmpnu)treniocty1fa r u olt0 etm(o no4lpeemiciat) rtrur oo0oex ii3tltfaDrlnvo ()arenxr oatomtrlieolt  ruoxrpno4ale mfciltf Dum(ro;o0tle mieiatlm uauvp u)artoiociydlaDr n sl(  rtmimpou1aleelfvtlt)srum( poo0apenmieiatfm rauvo;(0tlxoxr3iotlpteaivi;t)texoim oy1ope mivi (  2tau o;o1opt  ieiadls ulumpnt4teeoxf oydom  luvils0t2toir3iudapeemfvsa(faDraxr ;t4tetn iciydfaDemuvpnt) rxomo3oodfptr uvolt0 2uoxopny1lpe mfctat artm(ro;u1oexo o3iltlmDemu s;u)aetoxf oa1laDran il(0t2triopno1am nlieta( a2tmuro;o4tpeomo3ilt m2umuvsnu0tetnif todom r i i (0srtm(o3iy4oltn nvslsfsDrr(ront4tex  o3ias aDeauvpnt)alerir iydopt auvo;t0s2xoim nudlpe lnetltfartaxrpot0texomfctyslaDrln pn(4 eenmrcoytoa r n s () rtrim nudlm  lfei t sDrr(r no0tptomf3iyslaDum(mo;(4areomfcoodfatelnvo ( trurxr oy4lp  miesatfaDtaxmpnu1aex  f3ildfa umn p;u)artrif3ia1lp   neslt)srxm(m oo4lpe mnvsas  2rmxmont4tlxoio3iltlm2rln onu) rtrxfctatfaD liei t0texrxo3nodol nmfvtltfsDra(  ;u4olxoioeildfsDum(ms;u4artnmocoatlat auvs;t0 euo(rpoydlp n icil(  Dta( oot0aetnif3tlsfa2rmuvpnu0teerif iodop rlnvs t) etmxo3iu1lpeemnvil()sDtm(m ot1ole  fcilslsDrlnvon(4 rxoif3oatom e i i;(  euoio3no1lp nmnvia( a2raumoou1teenif3iasfa uln onu)alxnmo3ty1latrluvi;( t2tr(o3oo1amtnmnei ( s2tmu  oo4oee mietadlm eanvp u4areoif3tatop  aneolt)trxrir iudll elncils aDumumont1opeomfciyslaDean on(4aeeniocoo1omDeaueo s)t2xr(o iu1ome lfvs (fartru oou1apto fctatfs2eaums t0 reoifctadfa  lnvo;s trum(o iy4om  mivs (f 2tmur ;o1tpeo fctytfmDrlnvsnu)alxoxocootfaDelueo s  rxrir iy4amtemnciat) rumu  ;u4tpe  iciltlsDrmump;u4tlenmrcta1fm elnvs;s  2xr(o3iu4apt mnct s sDraurpou4apxo fctad m2ra( ont0 rerxfcty1lmtr nvils0 2xmimpiy4lm  mnetas  Drmum ou0opxnmoctyd m ul(mpnt4 ltoio tytlmt lu ils0t2urio3oodlmenmieias a2tm(  ;o4apeomicils s ulnvp;(0arxrxrcootoatrluvs ( setmxo iy4llen fcias  2tmxr oo1apen octls a ulnvpnt0 rxriocootfptelivilt) 2tmimpnydlpenmfes ()a2tm(  oo1oex  oeiyt s rauvp (4 lenxr3tadfa e n s;(0t2xoxm oy1ope lnvs t) 2rm(rpnt1olxnmfciadls2uauvs;u4tlenxf3iydom eln o;s setoxm oo1apte nctls)srum(r ;o1oee mictytls emn s () exoxr3tydoa eauvslt  exrxr io4aleelncsa(  rur( p;t1oeeoio3iydfsDel(mont) lxniocootfa   ieo (0 exmxm iy4apen feta() Dtm( o;t0olt miciytfmDea(vsn() rxrxo iotla r ivo;t0 2uo(r3no1omeemiet tfa2urxr ou0ole  o3iyd s eanvo () ltnmo iy1om rli olt)seurxo iu1alt lieiasf Dtmum no4opeoiieiltfs2eauvon(4trtoir3oo1oaDe i i;s)setrim3ou1altn fcta() 2taump;o4aetoifcild mDua(msnu4aexoif oydoaD  ies;s0seto(r ou4oltnlncslsfsrtmum ;o4alenifeild a2ul(mpn() eeomo3todfa  liei ()seurxo iy4lm n nctat  2uaurp;u1opxo o3iys a2rm( p t0teeoir3oa1lp  lu i;( srxmir3ny4al emfci ()arta(rpnt1ape mocild m2rau o;() lxnmf3tadfmDe uvs;(0seto(opno4om  lfesl()sDtrxrpnu1altnifciydlm uanms;(4 reoxo oa1fmt aues s0s2xrirpiodopee nesatfsDtax  ;u1tleomoetys m2ua(vp t0arxnmr3oadopD lueols0texmxo3iy4ol elnci t)aruru  ot4alxoio3ilsfs2ranms;t0 etnirctatlatelnvs;s trur(opoy4al e fctls arumx pno4texn ociatlsDel(von(0 exnir oo1fpteaiei;t s2xo(o iu4alee fviat aDtmxrp;o0ale ioeiydfaDuau s;t4tltoxr todlpDr uvs (0s2tr(o3oy4lm nlncsl()aruax  ;u0teen f3tydfm2eanmp t4tlxnmo iodopD  nvs;(0trtmxm iudlpeelicil(f 2raumo;u1tltn ictls aDrmnmpn(4aexnir3oodlateai ol(0t2xr(m oy4altemici t s2rmumo;t1tpxnmietls a eln o;t) rxriocia1fmte i s;t0t2uo(r3oo1ll nmfesl(f Dua(mono0opeomociydfm raums u4tetrxfcta1om r nei t)s2to(o3ou4lp e ncsat)sDrrumo;o0alt iieiysls eau pn(4tetrmf3iotopte uvol(0t2um(r oodop  mnet t a2rrur ot4tpeomociasls2ranvs u0arerioctotomD  uvsls texo(r nu4op  lfvtasf Dtau pno0tee mo3tytlaDea(vo;(4aetrmo iotlmDranvil()t2umim3iudaptn nvsltfsrta(moot4alxnioetatfsDulnvs;u4arxoxfcoa1fp  aiesl()s2umxrpoo1llt lfctlt) ruaxro;t1alxo oeias a2ea(mo;u4 ltnmrctadomDrauvil( t2trxopnu4lptelnvil()srtmum no1apenii3tlsfs rluvsnu0 lxoxo3ootomt an o t  rum(o3no4op nlfvi t) Dumu oou0texomfetytfmDranms t0tetomr iadoat ai o t  2ur(mpny4op  mieta(f rum(r ou0tee  o3tat a2uauvont4texnio3oa1lptrliei;t)t2urio iy1ame mneiltfs2umumont4opxnmf3tyslaDrl(vo (0 exomfcoo1oa   n sls)texmxr oodom e ivs s a2ra(mp;t0apt io3iltls2ulu s (0treomf3iytfatraneolt trxr(m oudopeelfesa(f rtaxrpno0tptoifeiad m umumo;t) lxnmo oo1op e uei;s  rxoir nodoltn ncilt  rtaxmono4olx  oeiadfa em(vs;()teenir3iotfpteau sl()sruo(mpoodll elncs (  Dururpou0oexnifcildfa2umnvs u0tetnxr ootlp rluvs;s  2umxr nodap elnei tfsDtr(mpot1aet ifeiysfm ranmpnu4 rxrxf3oydomtean o t trtm(o3oo1om n fctl()artr(mo;o1texn oetytlm2umuvs ()aetnio oy1oa  ai s () etmxrpnu1op nlieilt s2um(r nu1oexn feiasla2uln p;(0trtrio3oydlm rln il(0texrirpoydlp nlfei t aDrm( poo0tlx moctlslm ean p;t)areomr tadomDeli s;t  ruoim3oo4altnmfviltfa2tr(ro;t1tex  i3ils sDua( pn(4trenir tytfaD  n ols texo(r3nudamtnmfesa()sDtm(m nu1oltniieiytfs em(vs (0trtnxo3oa1oa r ivi;s s2trxm oo1alt lfet t)artmxr ou4tlto f3iatla em(mp;(0tleoif3io1fmt lieolt texmxo oo4lmtn nci sf Durxr oo1ape if3tatfs2rl(mpn(4 rerxr3ootoa r nvs () eurxrpoo4alt mfcils arumx  oo1aetnmietadla2eauvp;() rxoxr3iadfa  livs;t0t2tmir nu4oltn ivilt  Drrurooo4aexoif3ilslsDrl( o t0 ltnmfcootopD  iesl( tetr(opoudlmt mnvsl()arur(  no4altoif3iydfaDuluvo;(4 lxrir3oytoatr nes;s) etrirpiodlmeemict s)srrm(rpoo1opxn ociasla el(vsnt0artrifcoadlpDeaiei;() exmxo oydlpeelfct tfartrxmo;u4open o3iltlmDrlnmsnu0texrmr3iytlptrai s;(0 rumxr3oo4ll   ieiasfarurx p;o0tet io3iadlmDrm( p;t0 etomr oodop eauvs;t) etoxm no1lleelfci s  Dra(  nt0oexoif3ilsfs eauvo;u0 rtoxf3ta1fm  aieo s)sruo(opio4om n fet s) rtau o;o0teeo ociysla eanvp ()altoiocoatomt luvolt  rxrir3iy4ameemieslt aDraurpou0tpx mieiysfa umn s t0tltomo3tydfm rlnes t0trtoio3ou4ole mnvslt)srraxmpnt4tee mfetyslaDean p (0arxnmfciytoa elu sl() 2xoxmpnydlpe mict ()aruax  ;t1oeeoif3tasfm rm(vp t0trtrmocta1lpDr u o s)s2uoimpny4llt  fviltf rrmx ono0oexn o3iyt m ea(vp t0aexnifcto1lpte u o;s0seuoxm3oudopt  ivil()a2rmum oo4olen icils a2eauvs;() eenir3iodoaDraivs (0s2um(o3oodol elict s s2trxm ou0aeeoifeiasls2ran o u4artoifcoydfmte ies t0t2tmxm iy1olenmnesat) rrmxmpou0optoii3tytfm2um(ms t0tetnmo3oydoa rluvsl( sruo(o3nudll nliesas arraur nt0aee  ocilsfsDumuvo u0 rtoxo tydlatrai sls trtr(r3iy1lmeelfvs s) 2urxr no4aex  oetytfa2em(ms t)arxomf3iotfmtr ies;s0t2to(m3iodlp  mfci tfsrumumpot4alxomi3tyt sDelu pnt)aeenirctadfatr ivi;t0s2xm(m3oodlmenlfvtltfsDraumo;t0aee  f3tysfa rm(vpn(4 eeomf3oatfpD lieo ( t2xo(m iy1apen fcils)sDrau o;o0tpt mieilsfaDemn s (0 ltnxr3oo1oat  u s t trtr(rpoo1apen fes ( artm(rp;u4ale  oeiyt m2ua(mp;(4texrmrctadlmte i i (  2tmir oy4ope liet ( arurx  no1oetoiietat a2uan snt)teeoif oo1lmD auvs;( trumio oudlp emfvs t  Dtaumoou0apenioeiysfa2rlu pnu4tlxrxfciotlpD aneo s seurxopoo1apt  nct t) 2rrx  no0aeeniociadfsDra( s t)tetoioctydlmDe u s ()seum(o iodalee fet tfsrrrxm oo0tex mo3tldfs2rm(mpn(4 exrxf iy1latelnvi s trxoir3io4am n net ( a2taxro;o0opxoioctydfs2rmn p u4tlxnmo3oatla elnvols0 etoir3io4am  lnvslsfaDtaxm nu0tpt mociysfaDrl(vo u) eeoifctatlate u o;()trtr(m3oydlpeemfei t)arraxrpnu0aeeoioctysfm2rm(mo;t4altnif3iy1faDr nvi;t0 2uoim3oo1op  lnvtl(f 2uaxmonu1alto iciatfa um(mp;u) ltoxfcto1omDr i o ( s2xr(o3iu1ap nlfct t aDuax  nu0alx ii3iydfa2rln p;u0artomociadfa eanes t  etmimpnu1apen ivslt)sDtr(rp;o1opeomi3tadfmDra(msn(4 eenxo oytfmDr nei;t  2uo(o nu4amtnmfeils)s2um( o;u1ole  i3tytla emn s u0altnmfcoadfateauvo t)s2uoio3oy4lme lnvsat) Drr( pnt4tpe iiciat m rmn p;t4 rtrmoctydoat lieo;(0s2xo(opiudlpe  fetat aDraumo;o1altn oetaslaDulnvo;(4tetnxf3oatom   ieo;( s2xo(o oy4apeelncs s)aDtm(r ou4tlxomi3iyd sDumnms (4 etomfcoatlp  lu s t0 2uo(r3io4open iesat)srumxrp;u4teenio3iysfs2rmnvpn(0teenif3iytoateauvslt sexrim iy4al e fct (fsDtaum ou1tpxomociasfaDra(vo t)aetrxo oodoaD  neils)trumimpiy1optnlicilt srtmumono1tpxoifctydfsDua(vpnt)artrmr3oadlm e uesls seurxm3oudlm nlfeta() 2tmu onu4texomfetyd m2rl(ms;(4tltrir iatoaD aivi;s)srumxm iy4amtn ictltf 2ur(mont1oee ii3tldfa2eln on(0tlerxr iytfmDeaies;(0s2xm(m3nydllte netls arraurp;o1oexomoctat s2el( sn(4tltrmr3oadlptr ivils truo(r iodal e iciat) 2rmxm ;u0opxoif3iytlsDeau ont4tltrir ty1faD  i i s)srumim3oydlp  mnvt sf 2taurp;u0optoiictydlaDrlnvsn() rtnif ta1oa raieo t)srtoxo no4lpe mfct sf rrrxr ;t0tpeoifctltfsDemu snt0alxrioctatfmtelu o s)srxriopoo1ame  nesa(faDuax  nt4olxomoeiasfm eauvsnu4 eerxfciy1fpDr nes;t0 2xm(r iu4apee fvtls srur(r nu1olxoioeiys aDra( pn() eenmr3ty1oa eauvs;t trxo(r nodlpe  ivsat) 2rm( o;u4tle  o3iatfm2rmums;(0alxrir3iotlaDr uvo s)s2urio3iodameelncslt) rraxroou0tpxoioeiytlm ulu o u0alxnif3iydlp ranei;s) ruo(o ou1opt  ivsas  rtauroot1teeomf3ilslaDuanmpnt4areoxo3ia1fptrai s s texm(opnodlpenmfcilt) 2tr( poo1aexnioeiatfaDumumpnt4alxnif tytlpD  nvils) 2urirpiydaptnlnci sf rraurp;o1olxo o3tydfa ul(vs;(0 exoxo iydfptraivs s) exo(r iy1omtelneiltfs2rrumono4optn feildlsDeanvsn(0trtrxr3iydlm   uvs t) 2um(opiy1lptnmictasf 2uau ooo4altomi3iadlsDumn o u)tltoxr3tadfat  n s t)t2tmir3iy1ale mivi ( aDumum ;o4tet mf3ild a2ran s (0tltnmo iatomt ln o t)tetrxo3oy4optelnvt t srtrumpnt0aexomi3iyd aDean p (4 lenmf oydlpDeaues s srur(o3oodlpee fcslsfs2rmu  no1apt mo3iyd a2ua(vonu)teenio oydomDraues s0 2tmxmpiy4lpeelnetl()s2tr(r nt1tpe mo3iydfa2ra(msnu0 etnxf iotomt  n o;t)srtr(mpnydame lieilt arraxmo;o0opxo ietat s ranvp u)teermr iy1lm e uei t t2xo(m io1oltnmiesat sDtaurp;t0alx moctys s ulu o;t4 reomr todlmtr ieil() exmxm3io4lle  ieil()a2ur( o;u1aee  ieilslsDrl( p;(4tlenif oa1optrlnvs ()s2ur(o ou1lptnlictas) ruaumont1tetn ieiat aDuln o (4 renioctodfa r iei s0tetmir3iu4ap elictlsfs2umx oou0tetomietyd a2ul( p t) lenmf ty1lpDeli s;s t2xmio3io4open fvias aDumxrono1altn fciysfs rlumont)alxoif3todlaD anvil()teurxopiydop  mnvilt)arua( poo1opxnmi3iys s2em(monu0tlxrifciotla r ueo t0srxmxopiodame  neslt)sDrru  nt4tex  octytlm2rmnmon(4arenifciy1oaDrlivo;s0s2tr(o3no4ol   fviat aDuau pou1aeeo f3iasls2ranvonu4teeomr3iy1fpt aieo;( s2toxm3iodllt  ncs t) rurur ot1openmoctyd mDua(vo;(4alerif oy1lm rlivolt s2xoim iy1op nlnci t)s2tm( pnt4tlxomieiltfa2rlump u)alxoxr oy1omteaivsls setoiopoy4alte fesas)a2trxmoot4aeeomiciasfm elnvp (0 rtoircty1lp   i i;s truoxm no1ope  ies ()s2rmxm oo4aeeomfeiyd sDum(monu0aetrmo iytfptr ues s0 eurio3no1ap  mfeiat  Dtmxrooo1aexnio3iad s rl(mpn(4teenmf3iatfmt aivo;(0 ruoxm oy4llenmfct sfsDur(mo;u1olxoiietadlsDea( pn() rxrmr3oa1opDrlu o s0s2xo(m3io4lltnlici (f Duaxro;t0tpx ifctltls2emn o;t0trxoir3iodom r ues;s)t2xmxrpno1lp   iviasf Drrxmpou1apxn iciltfa2um( p;(4alxomo io1fat li o;t0 rxoxo iy1omenlfvil() rtm(rp;o0apx  ieiasfsDrmums;u0 leniocto1oaDelneo t s2xoimpoy4amt lfcs () 2uaxro;o1aptnio3tasls2el(vo t0tlxnif iotfptelnvo t  ruo(r iy1olt  fciat) 2umu o;u4aetomo3ils s2emnvs (0aeerxo todopte nvs;s)t2toir3iudaptnlfeilsfsrrm(ro;u1aleo i3ildfm2em(mo t4altnir3oo1fate uei;(0 rtoirpoy4lmtn netlsfa2tmu poo0olenioeils a2umuvs t)artrmfcoytlaDr ivs;(  rumxrpiodolte nctl(fsDtax ont0tlen i3tytfs2ran p u4tlerxrctodfpt li ol( tetmxopiu4omeelivs (faDrmx  oo4aetoiiciytfsDemnvs;u4trerio totoaDrai o t t2urim oy1olt  ici s) rumurono0alto fctas m ea(ms t4 etoxfciytlp   ivi s) 2xr(m3nudope lnes (  Dtmxm ;t4apxo i3iytla uanmp t4tleniociadla   ivo;s)seumxopoo4al emnvsa( srtaur ;t1olto o3tys s2ran o;u0tlermfciodfmDrli sls0 rxoirpoy1lm emivi s)a2tm(ronu1oexnmieildfmDem(mo u) ltnxo ty1lpD ai sls seuoio3iu4al nlivtl(faDtaxronu1olt  ictlsfmDrm(vpn(4tetoif3oatfateaneol( trur(opoudamtn nvtls)srraxm ;t1tpe ifetyt s elumo u4 rxrirctadlateanvo;t sruo(r3oy4lptn fctls)arua(mpot0tpen fcils s2ra(ms u0teermocoatlaDr n s;(0srtoio3nydale lietat)sDururpno0tltoiictatls rmu s t0areomf3oy1fptrluei (0 rur(o iydolenmivs (  2rrxmp;u4ole  fciyd sDuau pnt)texrifcoa1lateluei;t)s2xm(r3no1llte netlsf 2tru pnu0tptnifciatlmDumumo t)aexoif3ta1fp  anvs;s)tetoxopoo4lm   netls  rtaump;t1apt  feiys m em(mp;t)tetnif3iotoat ln ilt0teumxr iodom  mics sfarraump;u4tpe mf3iyslm rm(vs;t0 reoxr iytfmtran sls)s2ur(o no4am nlivi tf rtmxmono1aet  ociltlm2rl( p u)tlxoxr3io1optr n i s0 2tr(m oydll   nciasfa2rru  ou0apto ieilsfs2elumo u)texnxo3todfptrlivil()sexmxm3io1oleelicslt  rrm(m ;t1aetomo3iltfa2rmnms;() rerxr3ty1lpt anvo;()sruoxo nydlpte fvsatfaruaxmpno1ope moeildfaDulnmsnu0 exnxo iotlp rlivolt)t2to(r nudoltnmfvil()aDtm(m ;o0alt  ocilt s rln p;u4tleniocto1laDe neo (0s2to(rpny4lm  lfci (  2umx oot0opxn i3ild mDeluvpnt)trtnmoctydlaDeaueo;( sexriopnodam elfctl( a2rr( o;t0aet  ieiysfmDrmums;t) etrmo3oatfaDeanvi;s0teumxopio4aleelfctas) 2raxr nt1apen feiasls2ua(monu4 rxnircta1fa  ai s;s trurxo oo4omee fctl( aDtmu pnu1aexnmo3iydlaDulums u4altoir3ty1lmDelu s s) 2urio3oo4lm emfvtl(f 2rax  ot0tlenioctatfm ulu ont4trerifcoytom  ln o t0 2xmio oudapt mfetas aDurur ot0teeniietytfa rauvo u0 rtoiocoy1fm eai sl()s2umio ny1om nmnci (  Dur(m ou0aeenmoeiyslm2ea(vsnu) reoio3tytlm raneo s0s2um(r ny1om nlivsls) Dtmur ou0tle  i3iad m2ua( snu0 rermr todopDelu i;s)texmxm iu1lptnlivi s sDra(ront0aee ifctldfmDuau p ()trxoxoctytom e n il( srxoxo3iy1lmtemfei () Dta(mpot0oetoiocias aDrln p;t0 lxrxocoatlmt an s ( t2tmxopiu1lmte fvilt  2raxr ot0tltnmoeias a2rmumont0 etoiociotomt  u i;(0 2tm(m no4ll n ivsat)a2ra(  nt0openiocilslmDulnvpn(0 lenxfcoadop  aivslt0t2umio3nudam  micilsfa2tmx  ou4tle mictyt s2umnmp;(4aleomr3oatfptrauvo;s)teurimpio4olenmneils aDrax  ;u4opxomieiat s2rmnvpnu4 etnxf tytfmD livi t) ruoir nodom emfvi (fa2rmu  ;t4tltnmfetlslm uaums;()arerif3tytlm elivs;t0 exo(mpny1om elfcsa(  2tauronu4oeenifciadfm elu snu0 ltrxr3iotfaDeanvs s  rumimpno4omtelnesls)arta(mpno1tpx  i3iasla2emuvo t) eerxo3ta1faD  ivi;t)trurio ny4lp  mnctl(f rta(mpno1altnii3tlt s2eln o u4altoxf3iydfaDeanvol()s2to(r ou1ameemfvi s)aDrmx ono0tlenmf3tltfa elumpnt4aetomf ootlatr uvolt  rtoxr3nodomenlnci () Drrumpou0oetoio3ilslsDrmnmo;(4teeoio3iodfp eaues;s)s2um(rpoy4lp nlfesa( aDum(mono4aee mo3tltfsDuanvsnu) lxoiocoydfp elu ols  2um(m3nodlpe  nviat s2tmxm ;t0aptomictyd mDuanvpn(0teeomo3oydom  an s s) etmir iu4am n nvi sfsrururp;o4tpenmfeiatlm2rlu onu0tlxnif3iytlptrli sls0teto(mpny1op e fetas aDrmxr oo0opxo feiys s uluvo;t)texrmociy1lpt aies t0seum(m ou4omeemnvtl() ruax  no4tpeoiieilt mDelnmsnt0trerio ootfaDeanvs;(0 exmxr nu4ap  mnvt (fs2rr( pno1tltn o3iltfa2eanms;u)trermrciadlpDrlieilt truo(o3oy1al e nciat) rtru oot4aexo feias sDemnmsnt4trtnxf oo1lpD lnei s)srtrir3ny1oltn ivt (fsrrrxm ;u1oltn ieiyd aDelnms u) etnio oadlatranes;s) rtr(mpnu4aptemnesltfa2rr(r ;t0aptomoeiysfs2el( p;(0 rxnmrciadomteanei (  2urir io4lme lfesl() 2tr(ro;t1oex mfeiadlsDemnvs;u0areoxr3iadlmteanei s0 rtr(r iydalen ncsatf Drr(rp;u1oeto iciyd m2eaumo () rxoircoa1lptranvilt s2tr(m iy1op nlicilt)arrmumpnu0oexnioetlt a2emnvs u0artrxr3oytfmDeluvi t) 2trxr no4ol   iesat  Duaumpnu0tlt  octlslaDel(ms;(4 reomf oa1laD ai i;t t2tmxr oydlptn nvta( s2uau oot0aeto o3tyd s2ul(mo;t) ltnxociadoaDelnesls0 2trio3ou4omtn iesas srua(r ;t4tpt  f3iydfm2uaumonu0texoxf iytoaDranvo (  exmxm iudaptemfctat)s2rm( pot1tptomocils mDumnvsnu4alxnxo3oodlaD  iei;(0 exoxo3iudaltnmfct tfs2trxmp;u4aetoii3tydfm ea(mpnu)trxoxr ty1lptrluvs;()t2xo(m oudlpt  feilt a2ur( pno1optnii3iasla2ua( s ()artomocia1faD au ilt)t2xoxr3iudamtemicsa(fs2umu onu0aex mfciad a rl(mpnu) rermrciatfpDeai o ( seuoxm3oy1olt lfesl( arua( pno0olxo f3ildfsDulnmo t4aetrxfcoo1oaDeli ols0t2tr(m iudome mfvtasfs2rr( oot1oexnmo3iyt aDeanvpnu)trtrir3ta1fpDe ueo () euo(m oudamtnmncs sf 2uru pnu1oeeo iciytls ra(mon(4tltnmf iodlptr ieo (0srtmxmpny1op nmnesas)a2tr( o;t4tet  oetldfaDel(vs ()trenxf3oydfp  lnvs s0tetrxmpoudolte fvs s)s2ur(rp;u4aleomiciydfs2el( s;t4arxnio todopDelu slt)teumir3oy1lmenlics sfs2uau o;o4openif3ildlmDumu s u) rtoioctatomtrlu o ()truo(r3iu1oltemnvsltf Durx  no1tleoifeias sDraumont4 etoxo3oydfmtrai il()s2uoxo oydapenmictls  Dtrxmpou0ope iiciltfa uaumo ()texnmf iotlaDelneo;()trxmio3oo4ll nlicta( arrax  no1aetn ietldfs2umu p t4tleomfctodlmDr i slt s2xmxo3oy4lm  mfvt ( aDtmx ont4ale  ocias mDrmumo;t4 rtoif oy1om   nes s t2ur(opou1altnlietas) Dtr(rpoo1altnio3ils m2rlu p;(4arenxr ootlpteauvilt trtrimpoo4ameemncsas)s2rrx  ;u1ope  oeias m2eln p u0 lermr totop  luvols0 etm(r3nudlleemneta() rtr( oou1oetomi3iydfmDran s t) etnirctotfa   u ol() exo(rpiydol   fcias  Dta(ro;u1oleomiciydla2uaums u) exnmf3ia1faD  uei;t) 2urir3ny1lmte ivsa( a2ua( ooo0olxnmoeiytfm eauvs t)aetomfctotfa  aues;s)t2umim oydlpe mictls)artmxroou1aee  fciydla2uauvp (0tetomr tydlaD auvsl(0trtrxrpiodllenmfeil()sDrmu  ot4tet iiciatlaDel(vo t0 etnmf tadoa elivi;s0sexmxopoudop   fcil() 2urxro;u0aleomiciadls ua(mo t)trtoioctotfmDrai slt trtoir3ny4alte fei sf Dum(moot4tpe mi3tydfmDea( o;t) leoxrcoatlmtrli olt  2urxm nodamenlicsat  2tm(rp;o1tle iocils aDum(von(4 ltomr3tadom rliei;s0t2xoimpnu4olte fes t)aDtmx p;t0aet  i3iad a eau snu4texnifcoytlat  n s;t tetoio3no4omt  iet t)s2ur(mpno4ole mf3tytlm uln p (4tlenir totfm r neilt0s2xrimpno4ame  fcs s) ruaxm ;o4olt  octlsfmDem(vsn()trtrif3iotfpDelivo t0s2xr(o oudope mnvt s arrruro;u4tlx mictldfaDea(vp;u) exnxr3to1fpt an o;s0srumxmpiudamt  nciasfsrrmu pno1opt  iciltfaDemuvo (4trtniocta1lpt  neo ( truo(o3nudlpt mnvs s arumx  ;u1apeniocias sDumnvp t0tlenmr3iytfpDr ueil()texoxr3ny4am nlfvsls)aDrrxmpoo1altn iciat m emnvpnu) lxnmf3ta1lp  aieo;()srxo(opnodllenliesas srur( oot1tlxoifetadlsDrau snu0 ltrxo3oodlpte ivs;t trtm(o oodalenlict ()artr(rooo1oeeoifciat s rmn on(4 rtnmr oytlate n o ( teurim oo4omt lncsas srrrumono4opt mf3tadfsDeaums;u) exrxo tadlp  lneo s) 2tr(m3nydlmenmivta() 2taurpou1oltoiociyd mDul(vo;u0texoxrctydlm r n s;t)srto(m3iu4llt  nviasfa2tmxmpou1alxoifcildfa2emnmo;(4texoif iatlateaivs ()s2xm(o3oydop nmfesls sDurxm ;u0alx iociatfmDranvs u4 exoxo iadom   iei;( texo(o oodol e feta()aDtrur ;o0aleoiieiydls2ranvs u4altrxoctydlm  luvi () exr(r oy1lmenlfviat arurx  ot4tptnmictltlm eau on(4 renxf3oytopD  n il( t2tr(opiu4om  mnciat artmxrpnu1opx  ieiat m2uln snu) rxnmrcia1oa rai ilt0setrir no4aleelieta()srtrurono0tpen oeiyd s rauvo;()alermfcoy1laDe n i t srtmxmpoodlp  mietlt)a2raumpot1oet ioetldfa ul(mo;u0 reoxf3oydlm raneols t2trxm iydlltnmies (farrmumpnu0ope iieiyslmDranmo;u) ltnxo ia1fm   i o;(  2to(o3iudale  ivias)a2ur( onu4altoifctltlm emu s u4aetomf3iytla e ues;(  eurxr io1amtnmici tf rrrurooo4alx iietlsla rln p;(4teenxf ootfa r u i t) 2trxmpnudlpe lfvtasfaDrmxro;u4opt  f3tldfaDel( p;u0altomf oo1faDran s s)trtm(m3ny1apte ietls)s2rmx ooo4oeto ictlslaDemuvo;t4trtnxo tytfp elnesl(0t2uo(opoo1ale mfes ()a2rm(moou4oetn ieiydfs eaump t0aetoircio1oaDe ueol(0 rumxo3nu4ope mict (fa2rru  no1tlen f3ias s2um(mo t)alenmr3oadlmt  i o t0trumxm iu4opt lfctas) 2uaxroot0apx moeildlaDean on(0aetomociytfaDeluvslt t2tr(rpoy4optemnvil(f rrmu  ou0tlen fciytfsDra(mp t0tlxrircio1oatrluvi;t t2xm(mpoodap  mnes t srtm(mo;o4apeoii3iltlsDeln o;u4 etrmfcoo1omDeliei;s t2urio nodapenmnctlt)sDrm(rpnu0aexo feilt mDel(mon(4aetnxf oatfptrli s;s srto(rpio4lpt mfes t aDra(  nu4opx if3ils m2uln p;()trxoifciatfpDe i o;()s2uoxopnudll emnvils)srtax  nu1apt mfeiytfa umumo;(4arerxf ty1oa  luei t0srtriopiydam elivtas srtm(moot1tpt ifcildfs rl(mo u)aetnmf3oa1opt lu s s  exrxr3iy4opeemfesat) 2trx  oo4tlx  fetltlaDraums t4areoio3tatlptr i o ()t2xmxr3iu4amen nes (  rtax pot4tlx mfetasla2rl(vp u4 exoif oodop   i i s t2xmxopiu1amee fvtltfarrru pno0tlen oeiatls2ea(mo;u)teeoxr tytomt  uvolt0 2toxo3io1aleelicsas s2urxmp;o4tlxomiciys a ea(ms;()trxnxrctodfa rauesls0s2xriopnu1ll  mnci s  Duaxm nt1altomf3tadlsDeaumont0trenioctadop   nesl(0 2xrxm iy1op  lnvias)srraxr ot0apt mociyd a2rlumo ()teeoir oydlptraies;( t2xoxopoo4olee fetat aDrmxmpou0tlenmi3iat a rlu snt)alxnmo3tydoaDe ivo t0setoiopno1lp e icsl()s2rmumo;t1oexoiietasls ean ont4arxoxf3oytfa  lnei t  rxo(opiu1optemnet tfsDtaxr nt1tlxo fciydfaDra(mpn()trtrxr3tatfatelneol(  exmir nodamte ieta(fsrtm(r no1oetoiociadfa2rlu p u)trxrxr oy1fpD aieolt t2tm(o3oy4lm nmfetl()aDrau oou1optnmi3iyt s2rau s;t0artomr3ootlptrluvi t  exmiopiu4alte fctat s2tmx ono1alenifeiasla2ul(vs;t0aleomr3tydlatrlivslt0sexmir iydamtn feiat)arum(mo;o0oleo i3iys aDeanmo;t)trtrxf iatfa rluvs;s  exrxo3nodll elies s)arrmum nu4opx mfetltlsDea( s;t4trxnmociatomD livolt trtmxmpny1ope  ivilt) 2ta( o;o4tpe mo3ildla ulnmo u0aetoif3to1oateli o;()srxoxr3oodap  liciasf Drrx  nt4tltnmf3iyslm uauvpn(0tlenmf io1lpt aiesls  rxmxopoo1ll   fcs (fs2rru o;t1opx  fctlt m2um(vp;(0 lxoif3io1lpD luvs;t sexr(o oy4lpt lncta(  Dumum oo1alt io3iadfa2umnmsn(0trtoxr ty1omtrau o;()trum(m3nydlpt licils)aDtau p;u0tpxomfcild m2umums t0 rxnir iotlp ean s;t0s2uoio iu4am n ieslt)a2umxront4tleomietld s um( ont0aetoiociotlm eanesl(  ruo(o iy1al  mnes (f 2ta(moou0ope mietysfaDumnmsnt)artnif3ia1fp r neols0 rtoirpny1lm e fesat)s2tmumpnu0altnif3ildfs uaumon(4aleoif iatomteaneo;(  2xmxopnodopeelfct ( sDur(  nt4aetomiciatfs2ean o t)trtoxo oydla rlieilt0 2uo(rpnudlm nlfeils)aDurxro;o0aexomi3tldfs ul(mo t)alxoxociatlmteluvols srxmim3no1ol n fetlt) 2tax  ;u0olt mfciatlsDel( p u) lerir tydlptraieils0 2tm(r3iy1ap e nvsas srta(r ;o0opx iociad a2rmuvo;() etoio oadlpDeli s;s  2uoxr3oudapenlnvsatfaDrrx p;u4aee ii3tltfmDem( o t)altnir iy1oat  ues s  2urim iodllt lnctat) 2rax  ot0apx mfeilt m2rlumpn(4aexrifcoodlaDr ueo;s0trto(m3oo1lp   fvil(faDumxr ot1tpt mf3tatlaDel(vp ()aeenxrctydomDraneol(  etoio io4op nmfcsat  rtrxr oo4apeo oeiatfsDrm(vpn()trxnmfciydlmD  u s;()texr(o iudlmen ncs tf Drruro;u4ape  ociaslaDemuvs;u4 rxrmf oy1om  lnvol(  2uoxm iu1op  mnvsltfaDta(  ;o0aeto f3tlt aDrmn p u4texomrcoytlpDrluvi s)texmimpnu1lmt  fvt t)srua(m oo1opxn fcildlm elnms (4trxoxo3to1fatelneo;()trtrim3ou1omtnmfvtltfsDtax  ;t4aex iociys a rlnvon(0trenmociy1fptr i sls srxmim3iu1ape mnes ( sDrm(r oo4apx ii3iyt a2rln onu0 rtomf iatla   neo;t0seuoxo3iodlpe  ictl(  2trxro;u0tpxnioctyd m2umnms;t4areoxrciydlptrai ols  2xmio3oodop nmneils)arra(  ot4tlenmociyslsDulu p u)tlerif iodlpt an i ()srxo(r iudope mfvi s  2uru oou1alx  o3iltfsDra(mp u0treoir oy1oatr n ils)srtr(o iydamt mivia(f Dtr(mp;t4olto iciydfsDrmu s;()artnifcoy1oaDr nvo;t  rurio oy1omtnlieil()sDum(r ;o4aexnmoeiasfa rlnms u0 lxnif iadfmtrlu slt0 exo(rpno4opeelieils)arrr(mpno1tlxo i3iadlm rauvo;u0teenif3oodomDeauvs;(0setrxr nodol e nei (  rurumonu4oeeo i3iaslsDulumo t4tlxrxo oatom   ivol( trto(mpiu4am emicsat)sruaumpot4tltn ociyd aDumuvsnt0 rxoirciy1la r uvi t0 rtmxopiudoleelncilt arta(  ou1aeeo oeias aDrlnvs;t)texoir3tadfpD anei;t0s2xoim3ny1om e fctatf rtau o;o0oexo fciad a uan s;t)aexnxo3totlpD  n ol(0 2xmxmpoy1op emfeil()s2rmumoot1apenio3ild s2ulnvp u4trxrmo ootoa e ivo t0tetmim ou1omtemivils srraxrp;u0tet ioeiat aDem( o t0texoxfciotomtr i sls) rtrim3iydll nlivtl(fsDuau oou1ope mi3iad m2em(vonu) exnmr3oy1lm e u ilt0texm(o3nu1omt  ict s aruaxronu0apt  f3tlsfm elu snu) ltriociy1lmte nes ()t2uoxo3oo4am   nct sfsDraurpnu1tetnmoeiydls2rmu pnu4altrmrcoa1latraues s) rxrimpno4lltn fvil(fsDurxmoot4apxomo3iadfmDra( s;t) lxrmo3tadomtran sls s2xr(m ou1ll  mfetasfsDraxm oo0olxomiciadla uauvs u0tlerif3oodfpDrli s;s trur(rpiy4amtnlfvtatfaDrr(m nu0aleo ietys s elnvo;(0artoxfcty1lmD  n slt)trxmxr3io1omte fctlt)srrrurp;u4oeenii3tltfs2eln p;t0tlermo todlp  aies;()t2ur(rpny4opeelneil( s2rmumont4aleniieiatfs ra(ms t)altrmf3oytopDe neo s) exrxr nydaltnlnesls)aruaurp;t4aleomo3ilsls umu p u)tetrxo3tydoa r i sls  rto(m oy1ll   fcsasfsrrrx pno4teenio3ias sDemu sn() rxnmf3iadoatelivs s0t2uoir3io1lltelfeilt)sDrmu o;o0tpe ii3iydfm elu s t) rtoxf3tytla e nes t0s2tm(o3iy1al  miei (fsrtrurooo1tptomoeiatlm2emn pnt0 rtoio iatfp  au s s)trurir ny4omeemicta(fs2tau  no0tee  i3iatlmDra(mp u) leoio3totfmtr ues s0 etoxm ou1am  lncta()srur( pno0tex  feiat s eauvpnt)teerxo3tytla  lnvolt t2umxo3nu1omtnmivtlt)aDumump;o1ope  iciad m rlnmo () rtoxf3oy1fat  n o s)trxoxo nu4opt lfvsl()sDra( pno1tee ioetatfa2rluvo () rxnio oodom r ivs s0 2tmir3iudamtn net sf Duaxmonu4tetn ieilt mDrluvo (4 ltnxr totfa elnvsl( trum(r ny4aptemivt (f rurur nt1oex mi3tyslm2rm( s;(0trenxocio1fmt  nei (  2xo(mpoodlp  lfeta(f rrm(mooo4tpt  f3iydla2elnvon(0 reoifciatoatr n olt0tetr(rpiudlm   ivs ()srrrxroot1tleo fetad s2uaumpn(4 ltnirctadopt livil(  2uoxm3oydlmtemicsa( aDra( ono0alxn o3iyslm2um(mo u) exoio oy1lmDrlnesls0s2xm(opoy1om  mfesa(  2rrxr ou0alxoiociyt s em(mon() ltoxrcia1fat  ueo;(0 euoim3oodom n nesa( srtr(rooo1tlxnmoeild mDraumont4aetnircia1oat anvsl( tetoxr iy4omenmnct (  rtm( o;t0olx mf3ildls2rln on(4teeoifcoydfpD aueil( srxrimpny1olee fvsl( aDurxm ;t1ole mieiydfa emu s;u0aexrif tytfp   ivs s  2xmxm3ou1lm e nctls)sDrrx  ;u1aexn o3iys mDra(ms t4arxrmo3oytfptrau i;s0trxoxm3iy1opee fvta()s2urum nt0aeeoiocildfmDuanmpnt)aexoirciy1fp raivs;s0srxmxo3oydome mietls sDumu o;t1tltnmoeiadlm2uanmp;u0 rtnir3ty1lat  ivi;( trxoio ou4opt mfvtlt arrrumo;o0olx  i3iyd a eluvpnt)arermf todfpD  uvi ()srxoxmpoy4lp emneias a2tr(mpno0tet ifeiytls2ea( o u4teeoif iotla rliesl(  exo(m3io1am nmfvsl(faDtm(  oo4opxomoetydfs emnvonu)aleoxo3tadfm rlu i ()t2um(mpny4llenlncslsf Draumo;t0oee  f3tysfa rln p;t4tleoxociytlpt luesl()t2xr(o ny1omtn nci sf 2tmuronu0olxomieiytfmDumums (0alenifciotlpt  u o ( t2toirpno1opte netat sDtaxmp;o1altoiiciytla uau p u4arermocoa1omte ivols)trxoxr ou1al  lnes s)a2uax  ;o4tetn i3iydfaDra(mpnu4 exnifcto1la e ivol() rxmimpoodlptelfcs t)arrmu p;t1aeenmo3iad mDrlnmpnu4texnxrcoa1lp rlu o ()srtmxr oodlm   fctas)sruax p;t1aeeomoeiltlmDrmump;u4 exoxr tadoat  i sls) eur(m oy1optn icias sDtmxrpot1tpeoifciltla rau o () eeoxfcoa1la eaivs t  eto(m iu1ape mnvsl()aDtaxm ;t4ape  i3iltfaDea( p t0tltoxo3iytoa  lieol( s2tm(m3oy4amenmfvsl()arrmxr ;o1alt  i3ilt a rlnmp u4texrirctadlpt au ils0teumxr ny1al nmfeslt  Dra( o;o4oetomf3tld s umuvp t4aetrmr iadfat  nvilt truo(mpou1am   icil(fa2uru  ;t0oetnmf3ils sDulump () lxrmr3iatfp elnvs ( tetr(m3oy4ale lict t) rraum ;u1tptnio3ilsfaDra(mp;(4 eenmocto1fmt aieils truoimpoodlp nlivsas sDuaxr ot4apt moetltfa um( p;u0 rtoif3iydomt  i ilt)sexo(m3no1altnlfesl(f 2trumpno4tet  oeilt m eluvp (0 eenmf3ia1latr uei t0seuoxrpnu1opt lie
\ No newline at end of file
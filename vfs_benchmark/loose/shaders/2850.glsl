@@ -0,0 +1 @@
+i sl( setrio iudlmenmfet ( s2urxro;o0tltomfetls aDeanvs () exoxf io1faDraieolt0 euo(mpny4lpen nvs () 2tau o;o0altnif3iadlaDuluvp;t4arxrxo iotfp e i s s)sruoxm oo4lme mfvtas aDrau pnu4apx  ieiys sDumuvo u4aetoif ootopteaivs s texoxo oy1olt  fei (  rrm(r ot4oetomi3tasfsDra(vo u0arenifcootomteaivs;t seumiopoydomt lieiat) Dta( pou4tlx  fciyd s2rmn s t0 lxrmrciodfpDeliei;t) 2to(o3nu4altnlfci sfaDtru onu1tlen o3tyslmDulnvpn(4altomfctotfpDraieo;t0 eurxm3oodlltelnvi s)a2uaxro;o4aptomo3iysla2uan o;t0trxrxr3tadlm rlies;t0srxrxopiodom e ict tfsrta( p;u1tpxnii3iysla2um(ms u4 rtoxrcoydfpteli s;t) rumirpoudap  lnvtas  Dur(  oo0tle iieiat m umnmsnu4treoir3ootlmDraneo ()srtoxrpoo4lpe liesl( srtm(rp;u4alx mieias m2rluvp;t4tetrirciodomDraies;s0sruoxr io1alt mnesl(faDuaxm ;o1olxniieiytlmDea( o;u0tltomfcio1lm  ai o t teur(r no4lp nmivta()artmu o;o1olenmoctatfm2elu p (4tlerir3totlaDrai ols) etmir3nu1lp nlicsat arur(rpno4ope  ictldla ulums;(4 leoio tatlpte uei s0 2ur(mpiodlp elnvsa() 2tru ont1oexomictlslmDumnmsnu0aeenxr totlate nei s seuo(opiy1ll emnes s a2uru  nu4tlt iictys aDumnms;()tetrmo tadom elivol(  2xrim nudlm nlnvslt  rtmxmonu1aex mf3iadfmDrlu o;t)artoio3iodomt li il() 2toir iudlm  lnesat sDtmxro;o0tpt mieiyslm2ra( p (4 etnmfcootlat  ues t srxmxo3iy1lpee fes ()aDumxmono0alt io3iatls uanvsn(0 rtoir iydlmDelivols setmxr3no1ol  livtl(fsrtmumo;u4tle  oeiad s ranmo;t0 ltnif iytoptrlieslt)s2tr(rpoydoptnmfesa(fsDtax pnu1aetomiciltla2uln p;t4 lxrio3iodfmDran slt0tetmxm oudlmeemietl(fartr(rpot1tpxo octysla ulums t4 etoxf oa1om  aueil(  eumio3no1op  lnctl(  2rmxmpnu0tpenmi3tatfa ul(vs;u0texrxo3iotfmD lu o;t0teuoxmpny1lptelfcil( srua(mooo4alenio3tltfa rm( pn()arermr3tytlmD  i o ()srurxm3no4lle mnvi tfs2umu pno0teeoiiciadfa eauvo;()trxomf3ootom eanvil() exoxr3ou1olenmictlt)aDtm(moot4openio3iltfa em(mp;()alxnxf iytfa rluvil()trumxr no1amenlnesls  Dra(mp;u4olt ioetlslmDea(mp t)tltoxr3iydlmD aues s t2tmio3iydope  fesls s2rmxmooo1oeeomiciaslaDra( o t)aexrif3ta1oate i sls0s2urim3iydlpte fesa( srta(r ;o0apxomoetld s2rln p t0 eenir3oo1omD  uvo;s0 rur(rpno4lltemneiasfsDum( pot1ale  o3iytls eau on(0aeermfcootom e i s;s)t2xmio3ny1lp nlnvi t)a2taumono0open ocildfm rlump;u0 ltnmf3oydfmtrln ol( t2uo(o3ny4apeemietas s2trurpoo4apx  o3ilslaDulnmp;(0arxrmoctotfptean o;s s2tmxrpoy4amen neiltfsrumu p;o1alx  oeiatla rl(vsnt)artnxo3to1fmteauvsl( srum(m no4optelivi s  Drm(ront4apenioeiys aDelumsnu4alxomociodlate ues t)setrir3nydlm  lnvsa(farrmxmoou4optnmietytfa2eauvo;t0aexnirciydfpteln ils) 2to(r3iydlpeelnctlt)s2tr(rono1ale  ieiyd aDrlums;u0tltomr totfm r uvi;t0trtmimpnu4am elfvi tf Drmx ono1tetnii3iasfmDumumpnt) lxnmo ia1fptr u s (0t2xmxopoodom  lieias)s2taumoot0opeomfciltfa2ul( s t)trtrio3oo1lmDelneils)setmxrpoo1apt livtlsfs2umxr nt0oee ioetadfsDrmump t0trxrmf to1lp r ueo;t) 2xoim3ou1lpe mieiat srtmxr oo4aleoifcilsfa2rluvp;(0alenir3tytoptr ivs;s)teurxm iodole lneias  rrm(r ou4tpe moctlsfm2ranmo;t0 exrmo3tadlmtr ieol()t2to(mpio1lp  mfcsas aDrm(rp;u4apt moctld m2ulu p t)teermrciytlat luvo () rxrim3oo1opt mfvt sfs2raumooo0oltomo3iys sDeanvon(4aexrmrcoa1fp   u s;s0 2tmim ou4lp  lfvtat a2tmu  nt0ope  i3iysfaDuanvpnt0 lermf tydopDe ies;t0srxrim3ou4amt  iesls s2uaurp;t0tetoio3iydfaDrlnvon(0 exomr3ty1lpteanes;t0s2xmxr oydal e feias)s2raxr oo0tee mi3ild s umu p;t)altoxr oa1fa eliesls)seto(m3ny1apeemfvils)aDur(rpou0texn ociyt sDemumo (4 ltnio3todlptrai sl(0texrxr3nydom  mncilsf Dumxrp;u4olxnif3iad sDul( snu) rxoircio1fp  au o;( srxrxrpoudopteliet t sruaxm ;t0tltnioeiyd a ra(ms t0texomr tytfmD  nvs;s sexm(opoudamtnmnct tfsDraxrpnu4oex  o3iys a uanms u4alermfctydfm r nes;s)trtrimpou1ale  ies t  rururpot0tet miciytlsDuau p;u0arxnxo3iy1omteluei s  etrirpou1apt lfeslsfa2taxm ;t4oltnmietyt aDeaumo;u)aetnmo3iytlaDelueo ()t2xo(m3ny4ame licilt)sDrm(mpno1tlxoiociatla em(vo;(0texnif tytlptrai o;t  rtmimpiudom emfcsl(fsruaxm ou4apxomfetld sDeau pnu4arenxr totlm  an ol(0sexm(o3iy1lp emfvias s2uru pnt4texoiociytfsDra( o;t)artomf3totfaDr uvsl(0teur(m iu4lpeelnet (faDrr(m ou1opx  f3tasfm2rl( s t4tetnmfciodfptr u i;s) etm(m3iu4optnmivsls)sDrmxmp;u4tex mfeiys s2ua( p;(4 exomfcootopt aneo;s srum(o oy4amtelnet t) Drm(mp;u0alen i3tyslaDuluvo (4tlxoxr3iytfa   u i;s0 euo(m3no4aleemieia(fs2ta(mo;o1openmi3ils a umn onu0tltnxfciadfm  lneo;s0 rurim nudlp  livs t srurxr ;o0opt  i3tls s2uauvo;() etoif3totopD au i () rtr(r3no1amenlnvsas) rurumpot4olxomo3ias aDra(mpn()treniociodfmtraueilt0setrir3no1olen netat artr( pno0oet  oetaslm2eanvp;u4 lxoxr iy1lpt anes s0srur(m oydapte ietls) 2taumpot4teenmo3iysla2raumpnu0texoio3oadfaDrlnvo ()t2xr(r nudom n fetl(f rrruro;t0apxo f3iatfaDrmu o t)arxniociydfm e uvs;s s2um(m oy1amenlietas  rtau  ;o0olxoiiciatfm2ranvpn() reoxr iytopD luei;(0t2ur(rpny4am   nciltfs2urxm nu1teeo oetat s ulumo;(0 leriocoatomtr iei s0 2xoimpnudal n nvi (fsrrmxmont0apeomociys aDeaumonu4tleomr3iatfmtr ueil( t2ur(r iu4llee fesl(fs2tmx o;o4tle miciatls ul(vp (4tlxrmr3tatlptranvs;t0t2xriopiudalenlnet ()srumum nu0opeoii3ildla emu onu0teerxrciotomte nvo t trtmir3oy1om  lict t)s2uax oot4texoii3iadfmDum(vp (4 lxnxf3to1la  luvo;()setoir3iydape mfviat)arum(rooo4tltnmi3ildlm uan pn(0alxoxo iadfp rli ol(0srtr(r3iu1lm  mnvtltf Dtru  ;u4oleoifeildfs2rln o (4texnmf oodlm rli o t)sexrio iy1olt lncs (fsrururont0opxnmieiad m ran s (0texrmr3oydoa  aueo s0s2xoim3oudomeelfetas)arrrx pnt4opt moeiytfaDuau s;u0arermr iotomt li sls truoxopny4olt mnesa( s2rmum ;u0aex if3tytla rau pn(0tlxoio3iatoa elnvols) rtm(mpny1oltnlfes s) Drmxr ;o1apeoio3iyd aDem(vp () etnmr oadlpteauvs t0t2tr(m3ou1lm nmnvtlsfarurx  ;u1opeomo3tat aDemu snt)areoxo to1la elnei s  2urxmpoudol elfesa() rrr(m ;o1tptoif3tydfa2umuvo;(0aexnxo oo1laD an s (0trurxr nu1lp nlnei (f rrm(mpno4aptniociyd m2ul(mpnu0teermociadfpt lueo;t0s2xm(o no1ame  ictltf rur(ro;u1tptomfeiad sDelnvo;t4aeerircoy1opD lnvo s)s2xrxr io4omenmnvt ()srrm(mono1aeeoifciysfm2uln p (4tlenio ta1fm rlnvi (  2xm(r3oy1llteliesat srtr(root0oexnifcilt sDrmn p u)texnxrctatlatr nvi s0truo(o ou4lp  mnes s)sDuaum ;u0alxomietydlmDea( s u)aeeoxf3tatfpD aivs;s srto(mpoo1ame  nvt sfsDrm(mo;o1tpxnmoetysls2uau snu)arxnmocootfmt ai o;s0 euoim3iy1ol nlneiltfa2raxmpou4aeenmoetlsls uanvp t0tetrmf3iodfpte uvols)truo(mpoy4lp nmfciasf ruax o;o1altnii3tas a2uanmp;(4 ltrmo oadfateln o s0 2toim3nydam n fvtatfaruau p;t1tlx iociaslmDrl( pnu) rtrxr3oodfp  lnvo t0 rto(rpiu1opeelnetatfa2um( pnt1olenmf3iatfm2eau o u4aleoir todfa elu slt)s2toirpio1lptemfcsat)artr(r ;t4alxo ietldfa rmu p ()artrmfcoydla  aneils) ruo(m3oudllen ieiatf 2tax  ou0opeo oetldls2eauvo t4tetrxocoo1lpteli olt sruo(opnu1ol nlneilsfartr(mpoo0apxomf3tas s ul( snt4texrxf3tytfmDe neol(  rxrxm oy1ope  fcia(faruru o;o4oee  ocilsfm2elnvp;(0 lxomf tatlpDelneo;(0t2umir3iy4lm nmnviat)s2um(m nt1tle  fetatfaDrm( s;(0trxrmfciadfa r i sl( s2xr(o3nu4ame mivilt)srrmxrp;o1olt mfetyt sDran onu)aetnxrcoatfmteanvsls0 eumim3oo1olt mivsa()s2ra(mo;o4olt moetatfaDem(vsn(4 rxnxrciydlm r ueo s) eur(mpnu4oleemfvsls)aDtrxr nu4olx mf3tadlaDuanvs u4texrir oa1fpteanvslt0 rxoirpnu4aleemfvias aDtaxmo;u0tlxnifetad s umumsn(4 rxrio3iatlmt auvo;t0srtrir3io1ope lfvsat srrm(  ;o0opeoifciltls2um( o (4 eeoifcoy1la ean il(0 etr(m oy4om emnvi s  Dumurp;u4oleomf3ildfa uauvo;t0 leoif3tatfpte ivo;t0 rxo(m oo1alt  neta( a2ur(  ;o1opx mi3tyt aDum(vp;t) exomociadlpteluvsls  eurxm ou1lmte ieil( arrrxmonu0altnio3iadls eanms u) renir3oytlpDe n ols) 2toxm3iy4lmen iei t sDrr(mp;o0teenmf3iatfs eauvpnu)aetomociadfpDe ues ()tetr(rpou4am   nvtat  rua(mpno1tpenmiciyt a uluvo (4areomo3oydomDe u o;(0 rurio oo1lm nlncta(f 2tru pnt4alx miciltls2raump t4 rxrio3ta1la r nvo;s)srtm(o oy1optnmfeilt) Durxro;t0oleo feiys aDrmn pn(0 exoxo3iotlpDrau s;s)trtoxo3iy1op nlnciat) Dta(monu4oet mf3tys aDemuvpnt0 rtrmoctydopD  i ols0teum(rpio4amtnlicsas) rum(mpnt4alxniietaslmDuanvs;()aexoxf ia1fpD luei s)srxr(m oydll  mnvtl(faDrrxm nu1apt  oeias m rmuvp;u0texnifcoadfmtrauvs t)srtmim3nu1ame mietl()arraumooo4aee iicild s2rmn snu)tetnio3tatlat ln olt s2tm(r3nydapt  fcslsfs2tm(mo;t0opt mfetyt s2ranvs;(0tlxnmrcoy1fm  aies;t s2tm(r io4apte ietl()sruru p;u4tpxnmoeilsls2uauvs;t) etnmo tadlat  ivs;s0trxr(mpoudomtnliesat)a2tmxronu0tpenmfeiltfm2eln s u4altrxfctydfmte iei;()srto(m oo1al  mfesas)aDrr( ooo1tle  i3tydfaDulnmo ()aexrxrciytlp  lieols s2trxm io1om e ici sf ruru  nu0oeenifetlsfaDeaums;u)tetrxfctatlmt  i o t0teumxm3io1ap emnvil(  Duaxmp;o0apxoif3tyslm2umnms (0trxnmf to1fmte ivo t)s2urxr3nu4omeelict sfs2tmur ;o4opxomfetld s2um( pnu)trxomo3totoatelieo;s)texoir3iy4ap  mnesa() Dtru p;u0tex  fciytfa umnvp u0 reoircoatfate u i (0 rxmxo oo4am elnes (  rua(  ot4tptnifciltfm umu p;(0texrif io1lp   nvil() exm(r io1omt mfeils)aruru oou0aex  f3tasls2ulu onu)aleomf oa1opDrauvo;t0sexrio3iudlmtnmivsls srtrx o;o4tltoiiciaslaDulumo;t) renmociytlaD li slt0t2xmio oodop n ivsasfs2rrxront1aeenif3tyd sDel(mp (4trxrif iotoa rluesl() 2xo(mpny4olteliesl( srta(  ot1aexo oeias mDrlnvs u4tltrmf todopt aneo;t0 etr(r3iu1op   fetas)a2rrxm ;o0olxo octatlmDul( s;t0texomocty1oate u il()teurio3ou4omtelivt s  2tmu pou4tpeoifciyd m ul(vont0 ltnmr3io1opD an ols  rtr(m3oydlm nlfci s)aDtrx onu4tex io3iatfmDuanvs ()trxnif3tatfp e n sls0s2xmxopoodll   fvtltfsrrm(mpou1aeenii3ils sDeau s;t0trxomfcty1fpDeluesl(0teumxo3oo4al n nei s) Dta(ront4opxnmi3iyt a ea( p ()tetrxr3totomD ln i;s  rto(r3oodal n nvia(fsDtr(  ou1texoif3ildlmDel(vo;(0tlerif ta1oaDe u i t trxoxmpiydome  ics s aDurx pnt0ole  f3tat m2rm(mp;u) exnmr iatomt livsl( teumxm iy1opt mies (fa2trxmont0apx  oeiat a2ulnms u)trtrxfcoatfp eliei;(0t2ur(m3no1optelfesas) Drmxmo;t0opx mo3iysfmDrln s;(0 eermrcto1fmtraiei s) rtoir ny4llenlneil()sDtmxmp;o0alx  i3iydla umuvon(4tltrmr oydlaDr i ils s2tm(r io4am  lfvi (faDraur ou0olenio3ildls um(vp;u0trxrmociatlat  ies;(0 ruoxrpnu4ape  fci sf Draur no1apt  oeiasfa2umuvs t4 ltomf3oa1opDelivo t0sexoxo3ou1optnmivsatfarua(mp;t1oex mfctlsfm2ulnvp;(0 eeoxfcio1fmtr u i s) rxoimpno1aptelfeiat s2umx  ot1olen oetys s2umnvp (4tleomr3oytfmt anvilt)srxo(mpou4al emfetls)a2tr( p;o1texn i3iyd m emnmo;t0aeeoxf3iy1omtr nvolt0 rtoimpnydlmt  fci t) rraxrp;o1opxn fetytlm2umnvsnu0aleomoctytlateln o s) euoxm3ny1am  mivias aDur(mo;t4alxniictad m2rmuvo (0aetrxfcoa1fpD livo;()tetmxm nodopeemivi s)sDuaxmo;o4tex iieiydlmDrlnmont4alxoifciotfp  aivs s  2xoxo oy4op n neiat s2tr(mpnu4aeto feiatfs2ranmonu) exnio oydomteln i;() rur(rpoy4am emfcs (fsDtmxmont1aexo ieiytfmDum(vs;u0texrmo3ootlaD  u i s) exr(mpiu4ll elfcs (  Dum(m ;o0aexnmoetydla2emnms;t4 ltoxociotfaDraueil()s2trxm3nudlpte ncsas)arurxronu1tpxn ietyt mDrmu pnt)tetrmr ta1omD aieol( t2umxm3iu4olenmnci s sDrm(rp;t1tpxo ieildfs rluvo t0 eeniocty1lp e neo;(0 etriopoy4lmtnmfcias)aDur( oou4tltniictlsfs2eau snt0 rtomo3tytlm eaies t)tetrim iudlpt mncsas)srrmx  ;t1texnmfcias aDem(vpnt)arenxf3ty1lat lu ol(0trumim3oydlmte icilt) 2umur ;o4tltnmf3tlsls2uaumonu)tetoir oadlmD  uesl() etoxmpiy4olt  ictlsfs2uru pnu0olt iietytlm rm(vpnt4tlenxr3to1omt li o () 2xoio3oydoltnmfvias arrm(r ot0oeeniictasfa umuvonu4treoioctatom eai s;() 2xoio3io1lpenlfvtlt sDrax oou0aptomoetytlaDeanvp (4 lermf ty1fmt  neo;s) etmir3iu1omenlict sf rtmxr no0tpeomoeiatla2rl(vo;()tlxrxf3oy1lmt ai ols0t2um(o iy1oltnmfvs s srumu  ou4tpxomfetatfs2eaumonu)trtoir3iodfmDelu s;s)teurim nu4ope mfvsa(  Drrumo;u1olxoifetlsla2ea(ms;t0tltrxf3iatom  lueo;s0trxmio iudapt livtasfsrumxmp;t0apt  i3tldlm2eln on(0 lxomociadlptean i () 2ur(r3no1ap n nvs () rtrxr oo1opxnifeilsla elnvsnu) renmf3iadfat anvo;s)t2xoir oudome  ies sfsDurxmpnu1alxnio3tas a umn snu)treoifctydlmtelieo s texm(o3ny1om emfvta()arrr( onu4teeomieiasla rm( p;u4teenxociatomDr nvsl(0s2tmim nydame  nvt s)s2umumo;o0apxoio3iydla umnvpnu0artrir iy1late uei t) ruo(m iodlm emietasfa2ra(mpno4apx mi3ilt m em( ont0aetrxrciy1fp rlivs ()sexoimpnudop  lfvsas)a2umum oo4ope  i3iytfa2ean p t4alxoiociadopt lieo ()t2umxopnu1lp  micsat) 2rrurp;o0oeeo i3iatls eln s (0trxrmf oytfate i i ()s2trxr3nydole lfesls)sDtrur no4apt mi3tldls rln p;() lenmfciy1opD an o;s setrxm3oydapee neia(fs2ua(mo;o0teen ociatfa2el( s;u0trermo3iytlaDeli ilt  etrio3ny4am  lfetat artrum nt0oeeo ociytlm rl(msnu4artomr3oo1fm  lneilt) rxm(r oy4al e iviat a2uaurono4aee ifetlsfaDuanvsnt)tltnio iadfaDrln i;(  2uoim nudale mfetltfsrtaxmp;t1opx iietlt m2uln pnt4 renmr iodfaDeanesls0s2uoxo3iodole mnct ( artaum ot1aeeo octld sDuan p;(0 lxrmf3totoa ranvs t s2trim3no1al e nes tfarrrurpoo0texo f3ils m2emu s t0altrio oy1fmtrln i t truo(opno4om   nesat  rta(  ;t0oet  fciytfs2ra(ms u) eermrcio1op eanesl(0tetrxo3iy1lle lncils)arrmurp;o0opx if3iysls ul( snu0artnxf iodlmD li o;s  rxmim iy1apt mnvia(fsDraxr ;u4tpeoiiciytfaDua( o (0aleoxr3iatfpDrlueo;t)trurim iy4lmee fvtlsf 2uaxmp;o1tpx  i3tysfs rluvo;u4 lxrir3oo1lmt lnvs ()srxrio3oudameemfcsls  2tmx ooo0tpe  feiysls um( o;u) lxoir oatlmt ln o s)srtm(opoodlm emict t) rta(r ;t0alxnmfeiatlaDul(mp t0tleomocoodlm eluei;t)trum(rpoo1alt  nvtls)a2taurpou4apeniieiyd mDulu p;u0 ltrxr3iodom eaiei;t0trxm(o3oo1olenmiciat s2tm( pnt1open o3ilsls2ua(vpnu4 eeoir oadfmt lu i s0srxriopiydamtemfesl(f rumxm ;o1oetn fciyt a2rl(msnt4teenmocoatfateli ol(0t2uoiopnudapee icils)sDrrur ou4tlxn fetytfa ean o () exnio3oytfate n sl( t2xmxmpio4amtn feias)srrmu pou4tlxomieildls rln snt4teeoio3iytlpDe ueo;( trur(m oydomtn fesatf Dtrx ono0oeenifeiltfm ua( snu0 etoir3iodlat aies ()truoio3oy4omenmfvi ()sruau oou1tetn ietasls2rmuvs (4tltomf iydlm eau o t  rum(mpoo4olt lfct t) 2rmxr ot1altn ietyt a2rmu o u4trenxf3tytlaDrlies;(  rxoxo oo1optn fci t aDtm(rpot1opxnmfetatls2rluvsn()aeeoif3ta1optelu sls)trxmir3iudom  liesa( sDra( o;t1aex mf3tlt mDul(vpn(0tlxoir iatfmDe ivo;t0trxrxm3iudll  livs sfs2rr( p;o0teenifeildls2el(vpn()altniocoa1fmt aiesls s2urio oydlme  ict sfa2uaxro;t0opx ioeiltlsDrmn pnu)artrif tatfatelieolt0tetoir iu4lleemies s aDrmumooo1tpenmi3iyd sDrm( o t4 renioctytoa e n i;s  2uoxm3no4ole lncs tfarur(  oo1tet mietydfa eaums;t) rermrciydomDrlnesl(0tetoxopno4lptemfcias) rta(rpou0openmiciyslaDeanvo;()trtoxf iotfpDeaneo;( t2xo(mpio1ol  mfvt (faDrruroou1optomfciltfa eau p () rxnmocoodlmt ai o;t0s2trxmpnu4ap   ncs s  2umu pno1ale  oetatfm2umnvo;u0aeeoif tatfmtr ueo;()setr(m3io4ll  mfcta(  2um(r no1alto feiad s2el(vp;t4tlerxo3ty1fatrln sl( tetrir3oodlp   ict tfarrau  oo4aleomoeildlsDea(vs;(0areoir ty1lmDr uesls0 2umxopoo4llee ncsasf 2raxmpot1oeeomfciltla rmuvp;t4artnxr ia1oa  ai o (  2uo(r3iydomt  ivia(fs2rmxm nt0apenmietldlmDrlnvo t0tetomociytlp e i o;s) 2toxr iodamt  ncia( arra( pnu1aet ioetaslsDea(ms;t4alxnirctatopteli olt s2tmxr3iy4ome mnetas) rum(rpnu1teeo fctas a2ua(mo;t)tlerxoctytfaDe ivs;s t2xmimpiu4al  lnesas) 2ta(  ;u0opxomiciaslsDel(vp;u4 reoxoctotfp rlneols0tetrio iu1omt mnct s)aDra( p;o1aet  fciadfs em(vo;t4tetrir3oa1lmteln o t) etr(m3ou4ap nlict sfa2rmxmooo0tpxoiieiadlsDrau pnt0alxoio io1lptelies t)tetm(r3oudalt mietasfartaurpot1oetnmoetld a elu o u0aexnmr3iydfm rli slt0 eto(m oo4al nmfes t sDum(mo;u4aexo iciydlmDumnmo;t) exnmf oodfmt aivs;s)s2xo(r3io1lp  lnvtasf rtr(rpnt0tpx iiciyt m eaums;t0 renir3oydoaDelnes;(0s2ur(o3nu4optnlivtls sDurumpnu0optnmoctytlmDuln o u)teeniocootfat  iei s) rumxr3iydolenmieil() rrax  no1ale iiciyt m rm(mon()aeeoir iytom   ueilt)setmio no4llen nctls) ruru o;u0tlt mieiysfs eln o;t0tetnxoctatom rauvolt0 rumxo iy4om e fei ()artau poo1opxomf3iadlm2rauvp;t0aeermf3tydfmtranvo;(0 2umirpiu1ome lieslt  rta( onu0optomicildfa2rmnmont0 rxnxf oo1latr nvi;s  2xmio3oo1ll nmnvslsfa2raur ot0ope  i3iad m rl(mp;u0aexoxo3ootfatrlnei t0s2xr(r iydlmtemiet t s2ururpno0texoifeiatfm2emnvo u4 exnmf3tadomtrai s s0teumxm3iu4olt  ivslt)srrax  oo1ape ioeildfm rluvs (4 rxrir oytlmDr u slt)teum(o3oy4llee ieiatfsDtr(rpot4tex moctysfm2ea(vs;()tetoxrcoo1laDeluei;s0s2tm(m3oodaltemivt ()a2rrx  nt0tetnmicias m2ua(mp;t)tlerio oa1oa e n sl(  exoio nu4lmt  iei tfaDta(mp;o0tpe  octadfm ul(mon(0trerir3to1fpD au s s0trto(r iu4altnlnvs tfs2rrxr ;t4tpe miciydfaDum(vs;t0tetrmfcoodfp rlieslt t2tmio oudlmenlncil() 2trum nu1altoifeilsfa2ua( ont)aeerir3io1opDrln o;()teur(opiydopt  iet s s2ur(mpnu4oltoifeild s2um( s;t)trxoif oadla  an s;(0srxr(r3iudapee fet (f 2ta(rp;u4oeenifetydls rmump;t4 etrir3iotlateaiei;(0 etrxmpoo4al e neiat) rtrxrono1ole io3ilt a ra(mp;u4 eenircootopD li i;t sexoir iu4oleemnes (  Drm(r ot4opeo octytlm eauvsn(4trtrio3oy1lmte uvols) 2urim iy1apt lnei (  rrmu  ;u0apxn o3ias a ranvsn() eeoio oodfm  auvi;t0 2umim ny1opee feia(  rua(  ;t0alxoio3tyd m emuvp;(0alxrif tytfatr nvo;s0trtmxo3iy1ap e fvtlt)srraumoou1tex mf3ilsls2ulnms t0treoif ty1lmDraivo s0trto(opou1apte ncs t arum(mo;o4oex  i3tltla2ea(vont) rerxociodlmte u o s0srumim3ou4omee netl(fs2trurpno1oetoifeiltla2ua(vsn() lxoir3ty1lateli s (0sexo(mpoodol  mfeiltfaDrmumpot4apx mf3iasfa uaums t)teenxf3totom e n i t tetmxr oy1lpeelnei () 2rrx  nu0tpx  ietlsfm rm(von(0arxnxfctadlateaivols0trtr(r3oo4omtnmicia( srrmurpou1ope  i3iatls ulu snu0 lenio iodfptrauei ()seur(r3nodop   net () rrmxrpnu0tltnmiciadla rl(msnu0tleoxo iytfat au s t  2trir3nydam nmivs t)s2rru  nt0tle mociydla rlnmsnu4aetoio3to1fa eln o () etrxrpoo4altemfetlt a2umx ont0aexnmfeiytlsDra(von()aleomr tydlmtrlneolt0 2trirpnu4lpte ict t artax pot1aptomo3iasls2rlu pnt0trermf iadfa eaneslt teumirpnu1al   ivias srrmxmpot0ope  octldfa2rauvo () ltnxoctatfp  luvs (0 rto(r iu1lp  livt t)s2tm(m ou0texoii3tlslsDrm( sn()alermo3tatla  luvo;()s2tmxmpoydlm   fci s)a2tmxmo;t1tpt mfctldlm rl(vp;t)texoxr iytomtelnes;()texoxm iydapt livs s)srtax onu4teeoiiciadlmDrln o;t4 lxrif3oydoptr uvo;( seuo(rpoo1omtn fvsl()a2umx  ot0oex  ictyd m2ra(ms t0arerxr3iytfateaneo;t) rtrimpiy1opte ivil(  rraum ;t0tltomf3ilt a2ua(mp u0teenmrcio1fp eln i (0 euoxo oy4lmee nciltfarra(mp;t0opeomicildls2ran on(0tltoio tatopDeaneo;s0trtm(m3iodol  lieias)s2tmxmonu4teto ocildfa2em(vpnt0aetnmf3iydom   ues;(  2xr(rpiu4optnmnes ( sDrm(mooo4oex iieiasla ean s ()trtriociatlpt lneo ()s2xm(r3nydlpenmfcilt a2umurp;t4teeo iciytls2em(vpnu0 exrxf3io1fa rlnvo s)teuo(mpnudopenlici () rtmu p;u4alxoifetad a eanmsnu) rtnmociodoateli i t0 rxr(opnydlpen ici t)a2trxro;t1teto o3iytla2umuvpnu4 renio tydlpte u o t0s2umir no1apt miet (fartm(  ou0opeomiciatls eanms;(0tlxomfctodfpt livi s)sruoxr oo1amtnlfcsas a2rax  ;u4apen ieild a ua(ms t0tleoxf3ta1fmDr i s (0setoxm3iy1am n fvtl( arrm(mpnt4optnioeildfsDulu p u)trerifciodfa  auvol( seuoir oy4ap emicsl() Duru o;u0tltomicildlm2ean o;(4 exrir io1fmD  uesls) rtrimpoudlme  fvtlt sDta(  ;u4oeto i3iat s raumonu4 etoxrcoy1lmD an sls  2to(m3oy1omtn ncs ()s2tmur ;o0oeen icildlm2rlnvs u)trxnmo3ty1oateaivol(  rtmiopiu1ame lfvs (f 2trxr oo1aeenii3iysls2eluvo u)alenxf3oytfaD  i ilt trxr(r ou1op elivs t)s2rrxmpno0aee ifeiytls eluvs;t)aetrif ty1fmD lnei s trxo(mpno4ome lfvil( srua(  ot1texn ictadlsDrlnms u)tetrmr tytoate ueo (0trumxo3io1lp emfei s s2uru ont0aeeo f3ildls2umu o t4altoxr ia1faDe n ilt) 2um(m io4lpe miesl(  2uaumont4tpenmo3iad m eaumo;(0 exomrcoadoatraieo s0 rumxrpnydaptemieiltfs2ur(mo;u0oee  ieiyd a rmuvs;() etrir3tadoatranvs t)srurxopoodlle  ictat artmu ont1aeeoiociys s uaumonu0tlxnxfciadoatr uvsl()trtoim3iu4lmt liei sf Dur(ront1opeomi3taslsDelu p;t)alxrir oytfateanvs s0truo(o io1lmenmnesas  2um(ront1aee mo3tatls2eaums;t4 ltrio3iy1opt li o;(0 2trxo3iu4lptnmnei () 2tm(mp;t1teeoii3ilt aDumn s t4trxomfcootfm rauvol()tetoim3oo1am nmncsltf rtm(r ou4oeto fcildfs2rmn s (0areoif3to1lmD auei s0trtoirpno4ll   ivt ()a2um(mo;o1ole iieild aDuanms;(0aleoxfcto1om rau o;s  exm(m3nu1om   fcta( aDtrum ;u1tetn i3ilsfa2uaumsnt4 reoio3iy1op elu s;s) exmim3iy4lmenlfctas)s2rmxm nt4olto i3tatlaDrmumsnt0 etrio oytlmtr ues;t)s2xmir oy4al n fci ( s2rrx oot1aeto oeiad a uaums;() lxnmfciotfmtrai i;t0t2tmxm3io1ale mneils sDumx pou1texo i3tlslsDulumo;t)tetrmr iadoaD lues;()sexmio3iodam nmiviatf 2raxm ;o0aet  f3iysfaDrau s u)altrif iodlptelnei;t0s2xo(r3nodapee ict ( srtmumpou1oltoif3tltls2uan pnt0aleoxo oo1omt aiesls0trumio ou4lmtn fvia()srrr(  ot1opto fetltfaDra( on(4 rtrifcoytom elieo (0srxr(o oo1opt mfvslt  rurxmo;o0tpe  oeiytfs rlu snt)aetoxr3oytopDeauvi (  2tm(m3iu4am elfctl( s2tax p;u0oeen fetytfs ean o ()texnio3oytlaDe uvi s t2tmxrpoo4ll nmfcsatfsrtm( o;o0olt if3tadla2ulnvpnt0 lxrif3oadop  aivo;t)srtrxm3oydlpeemfei (fsrrmurp;t4altomociydfa2ulnmp t)teenmr3oytfmDr n olt texriopnu1lpe livsas) 2ur(m ;u4alt miciytlm um(vsnu0tlxoiocootlp e u i;s0tetmir io1ap emnvs s)aDraxront4ope  icilt mDrmn s (4alenxo3ty1fa  auvo;t teuoio3ou1amt lfvsatfs2tru  ot4aleomietydfsDuanmpn(0altomr tydfm rlnvo (0t2trxm nodop nlivi s  rta( p;t1tpeomi3iadlmDuanvpnt4tleoxr totoptelnvo (0 exmio ny4olenlnvtasfaDtaurp;t1apt mo3tlsfa2ra(mo t4tlxnxo oatlmtranvs s0trxoxm3nu1lpe lnvs t)srraumpoo4ale mfctatfmDulnvs t0 reomo iytfpt  iesls0trxm(r3io4al n fvil(f rtmum no0tpxomf3iytfmDua( s;(4texomf3tytfpt  nvo;s0 ruo(r oydlpe  icta(f 2rmxr no0tleoii3iltfaDrauvo;(0aetrxr tytomD lieils0trumxo3io1am elics t aDtau pnt4oeeoiociytfaDeanvo (4aleoif3tatfaDeauei;()srxm(rpny4llen iet sf rum(mo;u1aexn o3iasls ran s u)trerxr iatlpDeluvslt0s2tm(rpoo1ome mieilt  2rm(rpoo0tpeoii3ild a2umuvsnt4tlxnmfciadfptrauvsl( s2trxmpiydlme  ici sf rrrur oo4tetoifeilt aDrln s t0 rerio to1lp   neols)s2tm(mpnodolee fcilsfsrtr(r ;t4olt  fctadlmDra(vo;t4 ltoif3iydlptrlivo t) 2xrim3ny4lpt lfeias)arrmu pno1alxnifeiltfa2ua(vo ()trerxfcoo1lmt ln s;t) 2xmimpoy1oltemies s  2ua(r ot0oetomieils s rm(vsnt4trxomo3tydlmDeauei t)s2uoio io4ap n ivils)a2rrxroou4oleomi3iatfmDrmnvp (0tlxomoctytlaDraueo () 2trim3iydaptnlfcta( s2um(rpou4tptnmf3iadlaDrlnvo u4aeenir3iatfa rlu s;( t2tr(opoy1om nmnesl( s2rru o;t0olx moetyd m eaumpnu0 eerxocoatfaD ai i;s  exm(r3oudoptnmncils srtaumpot4aexn f3iysfm2rl( pnt0 exoiocty1fat auesls s2xmir3io1olt lict tfs2rau  nt1open ictatla2eln snu4 exrxf3iadfaDeaueo () 2tmir iu1llee ivs t) rtr(ronu1apt mfctlsfsDumn s;t0 etnxociadlmtraivi;s)teur(r nu4ll  livslt)aDtax oot4ole  octas m2elumont)artomrcoodlp  lneo;s setoxopiu4om elfeiltfaDtmur ou1oetn i3tytlaDumumpn() exrxrcio1lmDe nvol(0t2umxrpno1olen fcsa(fa2tm(mont1olx  oeildfs el(vs;t4 rtnxfcty1laDrai sls t2xm(rpnodolte nctls arur(mpnu4olxnio3iat s rl(mpnt)texnxociotfpDeau sl()trtrim3iy4llt mncs (farra( oou1aex mf3iysfm2rauvs ()altnioctodlpDe ivo;s trtr(m ou1omt mfcsls)aDtm( oou1opxnmfeilt s2rl(vp t0aexnifciy1om  livol( trurio3iudam  lncsat  2umum no4tpeniieilsla2emnmonu0 eeomr3oytom rauei;( trum(mpiu1lmen feiat) Dtr( pnt0tee ii3ilt m rlu on(0tetoxr3iytlptr nvolt)srtoxo oo1lme mfvtat  Drmxrp;o4tlt  ociysfm2uanvp;u)alxrxo3iodlate neo t  rtrio3oo1llt  ictltfsrtmxr ot1ole  f3iyslm2um(vsnt4 rxoio oodoa rlieol( teum(mpiy4apt livtasfsDuax pou0texoii3iytlmDean p;u) eerxo3ty1fa ean o (0 exm(r3ny1lp e ietltfsrua( ont1tpxn o3tlt m rln p t0arxnir3ia1omteauvo ( sruriopoo1omtn iesa(fs2umurpot0tpen fcilt a rauvp t4 leomrcootoatrln o t0 2ur(rpny4opt liesa()sruax poo0optnmfeiys mDeanmsnt)tleoxfcoodoptr ivs;t0 2xrim3ou1lm   ivta()aruaxm ot1alx ifciydfa uln snt4 exnxrcoo1fa eauvolt0 etrim3nudamte fvt ( arur(r ;t1aptomociadla ra( p t0trxrio3tatlm elu s t truoio3ou1openlieia(  Dta( p;u0olxoifctyt s2elums (4tlermf3iydfmt  u ilt  eur(m3oydlp n nciltfaDrrx  ot1aetnmf3iytfsDean s t0artrmo iodlatrlnes t) rtrxm3oy4apeemicta( s2rrum ;o4oetnioctlt m2rmumonu4 eeoio oo1omDrli sls0 etoiopiudop nlnvsl()s2tmxrpno0aeto f3tls a2elnvpnu4trxomf3tatopDeln s;s) rtoio oydalen fcslt sDta(  oo0tpen octasla emnmont0alerxo oadfp  aueils seuoxr iu4lpe mfcsatfaDrau  ou4tpto oeiat a ul(ms u0aetrxf3oatomDeliei s) rtrxmpiy1ope  fvi t)sDuaxrono1olxn ietad s2eaums ()aeerxr tytfm  luvs;t0t2xoxrpiodlmtelfvsa()s2ra( o;t0tetnmfeiatls2rluvs (4 exnxr oy1faDraneol()truoxr oy1op  mnctat)s2um(r ou0tlx ifetytfsDelnvpnt0 rxoxr3oadfaDeluesls0seuoiopou1ale mncs (  rraurpno1open fctysfmDumnvo t0trxrircoo1fp  luei;t  ruo(r ny4al nmivtasfsrra(  nt0tpxnmoetasla2uanvo t4aeeoxr3iydfmt aivs;()trxmxo3oy4ome mici ( arrr( o;u4aetomf3tytlaDumuvpn(0 lxrmr3oydomteaieolt0tetr(r3nu4lptn ncia(faDuaxmono0texnifetad s2eluvo;u4 ltrir ootoaDeli s t tetr(m nu4lp   fvtl() 2tru oot0oeenii3ilsfm umnmsnt0trtrmfciatoa e nes;()teum(opiu4omtn ivtat)a2rm(  nt0opt  ociytlm rm(mp t)artomociy1oa r ues;(0t2to(rpoy1aleeliciasfaDtmxmpoo4tpxn fetyslaDumn p t) exoxr oydlatran olt) eurxm iudopeemnvtl( sDua(m nt1alenmfctlsls ulnvp u)arxnir tatfat li s;(0t2xmxm3no1oleelfci (fa2tr( o;t1ape mo3ilsla rl(vpnt)teeoxfcto1lptrlues;t)t2toiopiu4om emfvi s  Draum ou4teenmieiysla umuvo;()altrmo tatfpD auvslt0sexmxo oo1ll  liet ()s2taxrpou0tpt if3iytlaDua( ont4tlxoxo to1op  lneslt trumio no1lptnmivi s arraumo;o1aptniociaslm rln o;t) rtomf3iytoaDe uvi s0 rtr(mpiydol e nvsltfsDrauroot1tet ifetls sDrauvo t4texrxocio1lp   nvi t)srur(o3iudlp nlivtat  rta( oot0opx moetadla ulnvp;u) lxnif3iydop raieo;( seumir3oy1lltn feslsf 2ta(mpot0aptoifciadlsDuln s u0trxrir3oo1fm rluesls0s2xrxo3oodopt lneiatfarur( p;o0aptnifciydfaDrmumsnt0tetrxr iytfptr ieils seur(r oodalt  nctatfsrrmxmp;u1alxn i3tldlmDeau p;t4 rxoxr3iy1lmtran ilt sexoim oo1am n fvi (f 2um(  ;t0tetn ieilslaDrmu p;(0aexomf3iatlpteln slt)truoxr3oo4llt mivt tfsrrmxmpnu4tetniicils m2em(vs;t0texnircoy1lmDeanvsls0seum(opoudap n feiat) 2ur( pot4optn iciytlm2uluvo u4 rxoxrciytfat an slt0 rum(o ny4alen fcils)a2tmumono4aexnmiciyt m2ua(mo t0tetnxrcto1opDr ieslt)s2xmxmpoo1apt lfcsas  Drauro;t0aet io3ils sDrmnmp;t4 rxrmfciy1faDranvo (0seto(rpno4lptnlncsl(fsDrrxmooo0alt ii3iyd s2ul( p u4aexoio3tydop eluvol( t2urim3iy1alte neta(fsDtrxrooo0openmo3tldfs2uaumpnu4 ltnxo io1omtrlu ilt) 2xmio3nydol emnctlt)aruaxm ;t1altomf3iys a ul(vp;(4tlenxociadlm e ueo s0trurxm3iu1optnlnesls)srtmumoot1apenmoeilsfa ra( o u4tlenxr iatoaD  nvol(0trtm(o3no1apeemict (f Dtau  no0tlxomieiyt sDrauvs;() etrxr3totlmDrlueol(0t2xoxr ou4ol  mivtat  2urxrpnt0alxnioetytfs2uauvp;t4tlxrmf ta1lpt aueilt trtr(m oydal n ieia(f 2um(rpot0olx mfeildfsDuanvp ()trxoxrciatoa e ivolt texoirpnu1llee fct (f rraump;o1oltomoeiytfm2elnmp (4 eeomf iadoptr ivi s) etmim io1lmt lfvsa(f 2ua(mp;t4oltn ieiydfa eau s;u4altnmfctydfp r u ils s2tmir3iu1lle  fvtasfartr(rooo4olxoio3tlslm ran p (0alxrmf3tytfm rlnvo (0sruoxm io1lmtnmivsa()aruau  no4optnioetltfmDrmuvo (0alxoxf3oytomt  u s (  exmirpiy4amt mfetas a2taxmpnu0ole ifciaslaDumu p (0tltnxfciotop   ies (0 rxoxr oo1ol e fcs sfa2rau  ;o1oeto ictyd m2umu s;u0teenxo ta1fpDrli i;t0 2xr(r3oydlpenlics t a2rauro;o0apxo ietlsls rmnvsnt0 lxnxr3iodomt auvols) etoimpoodam elfvi (f rrmump;u1aexnmf3tltla2ra( o u)trtnif3tytopD au s;s)teum(o3nudll nmnvs sf rta( poo1olenmietad m ul(vo;(4alxrxr oadom e i o;t s2trxrpiodol nlnes tf rua(r ;o0aee mo3ilt m2ean sn(0alermo totla rli sls0teuoxo3nudomeemfvslt) Dur( pot0altn ictatfmDrauvpnu)teeomo3ty1optr nei t)srtrxo io1apeelfcs t)sDtru ont4oet  ociyd a2rmn s u)arxoif iadfpDrln slt)t2tmiopou4al emnct t srra(mp;o1apt mi3ias aDem(mo;(4arxnxo totfaDr i sl()teum(r oy4llt lfvtl() rrmurpot1alxoiietatfa elnvo ()tetnxr3ta1opDrluvi;( srur(o iy4apeelfetlt arrm( onu0olt mi3tad sDua(msnu4trtoxo3io1fa rlnes;s0s2to(mpnu1openmncslsfaDrrxm ;t1aleo o3iat a2elnmp;t0 exrif3oo1omD aivil()sruoirpnu4opt  netlt aDta( o;t4oeenmictysfs rmums;(0aeenmocio1faDrln olt t2trim iy1lpe mnci sf 2uaxr ;u1teenmociytfmDranvo;(4arxoxo3ia1fa rlues;s0t2ur(m3ny1altnmfetasfaDtmumo;t0altnifciysls ulu s u) rxrif3iydfpt ai i (  rur(o3nu4omtelivs s)arum(mono1aptnii3tadlm uan onu4 lxrxr3todlmtrluvols0 exoxm nudlp n netat)srtmxr no4teen oeildfa2elnms;u)aleomr oo1lpt  i i (0texr(r oo1ap e ivi s aDtru onu4tltnmfeildfm rl( o;(4 etrxo oydlmtelivo;(  2uoxr3nydlpeelivi sfsrrau p;t4oleoiocildlmDum(ms t4treoircoatfaDeluvs;t0s2trxr3oudaptelfesl()srurumpot1olxoifctatlsDra( s;t0tlxoir3iotfa e n ilt0teur(opou1opeemncsl(f Drr(rpno1aee if3iat s2uan p u)tlenio3iy1la r nvil()srurio3no4om nlfesas arrmur ;t1alxniiciytla2ra(vonu0texrxfcootlmDrlivsl()s2toxr oudom elictat) 2uau o;u0olt  i3iltlm2eau pn() etoxo3tydlpDeli sl( s2tr(rpny4lleelncs sf Draur ;t4tpeniociltfaDumnvsn(4aeeoxo ty1faDelnvi t0trto(opnydal  micsl(fsDtmx  ou1opeo fetat a2rmumo t4artrmf3ta1lpt lneil( t2toir oy4lptnmnci t)aruauro;o0ape mietatlm2ra( p ()tltoio3iadfp rlu o;(  euoxr nudalte nciasfs2umxrpnu1oleoiocildlsDeaumo;t0 rtrxr3tadfp  anei t s2umxr iy1opeelnet tf 2ua(m no0texo ieiaslsDuaump ()aexnir totoptean o s)s2trxm iy1lm nlnviltfsDta( poo0altnif3iaslm2rl(mo;(0altoxr3tydlpt  u s t0 2trxo iy4omeelnesas arua(  nt1alt mieiatfm emums;(4tetnmo3ootoptr uvs t0srxm(r3ny4lmte nct s sruaurooo0alxo ociysfsDul( o u4 lxnmrcta1oa  anvo () ruoim ou4alee fviat)arta(ro;u4optoif3iytfa uauvsn()tetrxo iotlatelu i t) 2xoxmpio4omenlnvt (fsrumu p;u1aeeoifeilt mDua(mon(0trxrxr3tadfmDelnei t srxr(mpiu1llt mnct ( artrxrp;t0apx  ieilslm2rmump (0 ltnxr ootomD aivo t trxm(r3no1amt  ieias)sDurx oot0optoifeiltls2uln o;t0 etnxrctatlm  auvi;t) 2um(m iy4altnmneslt aDtmur ou0tleoioeiyslmDumums;t4aeermfctytopD  ues () 2um(opou1amt  fvil() Dtrxm nu1tlxo ietas s eaump (0tltoirctotlmte uvo s)t2ur(r io1ol n nctlt)artaxrp;o4aeeo fciad sDrl( s;t) rxrirctodfpDeaueil() 2toir3iy4ape  ivs sfs2rrxm ot1tptn ieild sDranvsnt0artrxfctotlaD ln slt0s2urim no4op nmicslt) 2rauro;u4olxnmfeiyd m2rmnvsnt) rtoxf3ty1fatr u s;( t2to(rpnu1alt  nvtlt) Draurooo1teto oetytlaDra(vp t4aetrmo oodfpD aiei s) ruo(r iu4omenlncsat)s2rm(mpno1tetomo3iadfs emn pn()aeenxr iodfmD  ueo;(0t2ur(rpoydom nmfvs () 2ra(mpno4apx moctadfm2ulnmp;t4 reoxo iatoa eli ils  2uoxo oo4amtnmivi ( sruaxm ;o0teto feiad a2um(mp (4tetoxfciadfa   uvo t0t2tm(r iydlptelivtat  2tm( pou4alen fetad a2ul(ms t0artoir3iotlate ieslt0s2umxo3nu1amtemnvi tfarrm(ro;t1oex ii3iad m rlnvpnt)aexoxrciadom eaieslt t2uoim iu4lmt  nesat sDrru oot4oet moetlt mDraums;t) exrircoatoa r n i;t  rxmxrpoy4oleemfvsl() rur(monu0openmoeils s2eln pnu4treriocoydfatrlnvi;s) ruo(o3no4lm nmies t sDumx ont0teeo f3ilslmDua( o t0altnirciytlateau s;()s2uoxr3iu4opt lncs s)a2uax p;t4olenii3ild m emu p u4 eeoir3iy1lp raneil(0 etoirpiudlp nlnvsa(f 2rru oou4tex  icias m2ranvp;u4 rxoircta1lpt  nvs s) rxmxrpno4aptemivtasf Draurpno1tpe  feiydla2umn p;()trtoifcoo1fa e i s;s0t2uoim3nudapeelivia()arrmu pnu4tpeoioetytfs2ra(mpnt4tleomrciydlm rli s;() etoxm3ny1lm n ivias arrmxroou4olt mi3ildlmDemuvo u) etoif3iytla raneols t2uoim iy1ap nmfctatf 2rr( ono1apenioetasfm um( p;u4 rxnxf iy1la  anvs;(0s2xmxr iy1om n nviat)a2uaxrpot1alto feildfs elu pnu)aexnir iotfpt aneil()trxoxo3iydop emiesls s2rmumooo4tltnii3iadfm rlu pn(4 lerxocio1fm elivi s teurir oo4oltemivsas sDrauro;u1aleoio3iydlmDum(msnu4texriocoadopDrlieil(0t2xoim3oo4ol n nvsa()a2ur(mpot0alxnmfeiltfa2eanmp t0aleoxrciy1opt  ueo s0sexoir oo4lmt livsl(  Duau  ot0tlt  ociadfa2elnvo (0trenxrcty1lm eluvo t  rxm(rpou4lpeemnvil()sDra(ront1tpx  feiysfs2rauvsnu4tetnmociydomDe n s;( srxrxopiu1openmivs t) 2uaxr ot1aeeo iciatlsDrl(vp;t) exrmo3oo1lmt li o;s0 2trim ou1lptn fviatf 2tmxr nu4tpto fciasfsDemn p;t0altoio io1lmtr n s;( t2toim3iodaptelncta()srtmumpnu1alxo f3tad m2el(msnt0alxnxfciydla elies;t0srto(mpoy4aleelfvsl(fsDtaxr ;o1alx mfeild s umuvs;() eermf io1fmDe ieilt  rtm(m3iu1al  lnesas)artm( pnt1tptoiociltlmDrlnmp t0alxoio tatfaD  uvolt0trtmim iu1ap elnvia( a2ururpou4aleoio3iasfs eln o;u4trtoxf iatfpDe neo t0trxo(m3no4ole lfvsatf rurx  ;t0tee mfciysfm rmumpnu4treriocoydopt  nei (  ruoxm3iydomtelneiasfa2rrurono1aee mieias s2rluvsnt0alerxrcty1fmt luei t) ruo(r3nodopee nei (f rra(r ot4tle ii3tldfmDuan snu0 eeriociatfa rlies;s teumxmpnudopenlnct (fsrtaurpnt1tptniicilsls2umu o;(0trerio3iodlm rln ol(0 2to(r iy1om elivta(  2ur(monu0alx mieiysfs2ul(vo;t0 eeoif tytop   ieo;(0s2urxmpnydalt mfetls)srum(mp;o0tle  oeiytfm umn o;u0tetrmr ty1fmDeluvsl(0srtrxmpiy1oltnlfvtl(fsDururono1olx  fetatfa rlnmp t0 lxoxf3ty1oaDe ivol()srxmxo nudap e fvi tfartmurono1oleomf3ias s2umn snu)arxnmf oydlatr i sls setoxrpnydomtn fctat) 2um(rp;t0aee moeild a2eln onu)alxrircoytoaDeaieols  2xoimpiy1ale mncsls) rurxm nu4aet iictys sDrmnvo u0 rtoiociytlmt  uei s) 2tr(o iy1lmee iet tfartm(m ou1tpt ioeiyt m el(vs t4 eeoxocta1oaDrau ilt0 2ur(opoodolteliesls  2rm( ont4teenmi3iadfs2ran p u) exrxf iydoa eauei (0 etm(m3nudamee ics s)srrmxmpnu1aet mi3iysls2rmump;u4aetoxf io1omD lieo;t0srurxm io1lltnmivs (fartrxro;o0tptoii3tasfm emnmpn(0 rxrmoctotoat auvo;t0setm(r3oudal nmfct s) 2umx o;t4apen ieils m2elnms;u0 lermo totlmDean o (  eumxo3nodll elnci s a2rrxro;u0apxo fcilsfsDua( p () rxrxr3oytfpt aueo;(0 etrxm3oo4open nvi ()arumu p;u4olt  f3ildfs2rluvp t4teeoxo3iatfp elnvols s2umio nydaltnlfvsat  rur(r ;o0aetoii3tltfs emuvp;t) rtnxrcoydfpteanvi ( srumxrpiu4lpe lfetltfsrumur no4ole  fcildfsDean o u4 exoxf3tytoaDeaivsl(0t2xr(r iy4lm  lnvi t aDtaur no4tpxnmfetad sDraump u)aexnmo3todlp   nes;(  ruo(m3oo4apen nvt s s2umxm ot0tlxnmfctlsfmDemuvs t)tltnxrctydlpDrau o s trtoxopoudll elivtlsfsrtrxm ;o1tltomi3iytfs2emuvp u4tetomfciatoa e u i t)s2xrxr ny4omeemfcta( srraxmpno4tlxomiciytls uaump (0tetoio3oytopD au slt)s2toir ny1apeemfei () rumur ;u1oleomietad s2rln p (4tltrxo iodlateluesl( seuo(r iudalt lfetlsfs2rau o;o1optn ocilsls ea( p;u4artnxo3tydomD auvi (  rtoxm3no4op n fvsa( sDtruro;u4openioeiys s2ulumo;u)arxrmrciy1lpt lieo t)tetm(mpiu1llenlfei tfarrmumpnu1apx iieiyt aDulump u)alxomo tadlpDeanvs;s0s2toir3iy1op n ieiatfa2umx  ou4tpxo feiytla2el(vs;t4tlxrxfcia1oa  auvi t)trxmio nudameemnvsa(fs2rmx oou1olt iieiydfa2uluvsnt0trtrmr3oo1fpDr uvil( srxr(o no1opeemfeilt s2ta(r ;t4alto iciydfmDean pn() rxomfciy1lpDr i i (0 rxoirpny4omenlnesls)arrmu p;u1alx ifciaslmDelump t)aexrxo iodfm r ues;s)seumxo3oo4apen nesls)s2uaxrp;o1aptoif3tydfa em( o ()altnmr iadopDelivs s t2xrxmpiy1ole lnvt tf 2tru p;u1opxomoetasfsDrmnvo;()trtoirciodfat  n ilt truoir3ny4op  lnetls) 2ua(mpno4aeto f3iad s um(von(0artomr3tatopD lnvo t)s2xmirpoo1ame micsa(faDuauro;u0ale miciatfa el( s (0aetnmfciodfp eauvil()trumim3nydopt  ici t arrax p;o4tetomfeiys s el( p;()altrxf oo1lmtelivo s trxm(m oy4ll  lfcsl()s2um(mono4oexoif3iad mDul(vpn(4texoxrcoytoaD  i ils0t2toxo3nodll e fcslsfa2tru o;u0apt ii3ils aDua(mont4aeerxf3iatop eluvi;( t2ur(o oudoptn fcsl(farur( pno0alt io3iltlmDeanms u4 exrioctodfa  ai ils)s2xrio ou4altn fcil(faDraxm ot0aeeoifciydlm2rmn p t4 lxnirctadoaDelnes t) 2xmxopou4lp  mivi t aDrru pou4tpxoio3iltfs ra( ont) exomf3oa1op e u i;t0 ruoimpou4omtn feta( aDtm( p;u0oeeoio3iydlmDrm( p;t4aleoif tatlm elivi t s2xm(opnu1opeeliesas s2trxm no0oetomoeiydla2rl(mo (0trtnmr tytla eanvs t0 exriopiudol e neiat) 2uaxmpou4tptnmiciys mDrau o (0trtoxrctytfat lnvs;t0trxo(o oy1olen neiat aDrrxmpou1oexnifctld s2el( o u4altrmociytfmteluvs (0teur(m ny4lme micsl() Dua( ono4tle mieias aDrln p;u0tltnmfctadlat  nvsl()sexm(r3iy1altn ivil()srtrx  no0tpe ii3tadlsDul(mont0artrxfciotopt  nesl() rto(r3ny4ape lnvsls)sruru  nt1tee  ociyslm2ulu o;() lxrifcoatfptelneols  eum(o3nodol n ics tf 2uaxr ;o4alxn o3iydla emnvp u4tlxrxr todop elivols sexr(mpoodop elneil(f rtrumono0teto icils mDra( s (0texoio iatomte nvolt) ruo(m iu1aptn ictlsfa2urump;o0tpxoifciytfa2el(vonu)aexnifciatlpD lueilt)s2xo(o3oy1olte ici s s2urx pnu4alx  icild sDel(vsn(0alxoio3tadoptr ivi;( s2toiopio4om elics ()sDur(r ;u0opeo f3ilslaDum( o u)arerxrcoo1fmDr u i;s)trxoxm ny4lm n nvil(fa2uaxrono0aexoii3iasfm ea(msn(0aexoxocoa1omDe u o;t t2xrxr iudlpt  icsl()aDurxronu0aex ioeilsla umumo;u0 etrxrciodoa  lnes;t seumio3nudaltnlictltf rrrx  ou0alxnioeilt a umumpnt)tltoxr3iotopt lu i;s0 rur(rpou1ameelivsl( arum( poo1ope ifeiltlm uluvo (0 etnmf oodopDe iesls srxoxopiudol  lict t)arum(root1opx micilt a elnvs;u0altrmo totopDraieo;( sexmxr3no4lpe  nciat  2ua(mo;u4ape mi3tls m2elu p u4alxrif ootopDeai slt)srxm(r3iudom  lict s  rrruroot0texoifctltlaDranmpnt0tleoif3oy1oa   uei (0s2tm(o iydamtemiesl(f Draurpno0tptnmieiadfs umu o (0aeerir3io1om e neol()trxmxm io4ape mfesatf rtm(rpno1opt mf3tyd m2ulnvsnt) eeoxr3tytfp ranvo;s s2xoio iy4lmt lnvtas  rurx  nu1alxnif3iasfa rmu p;t0altomf todoat li o s0trxrio iodal nmfctatfaruaumoou0opeoiieiytla ran s;(4aleomf tytfp  lies ( seuo(r oy1alt licsatfaDurxr nt4tpt  f3ildfm2rmnmo u0tlxrmrcoa1fpDe nvo;t sexmxm oo1ope  fvil() rua(mo;u1tlt mfeilt m rmnvo (4trerio totlmtelieo s)trtr(r iu4lmt  ivi tfaDtmu o;t4apxnmo3iyt mDraums u4 etrxfcoydfp  lues;s)srtmxr iudomenmieia(f rtrur no1opx ioeias a rmnvsnu) exnmo tytomtelnvslt0srxmxr oy4ope mnvias  2trxm nu1ape mociytfm uanvs;()trenxr oy1om  lnvilt0 2xo(rpiudoltn iesas)arum(mpot0opt ifctlt aDeauvsnt0artrmf3iodfmDrluvo;()srurxr3iodol  mfes ( s2ra( o;t0opxoio3tat s rmumpnt0tetrmr3ootomDe ueo;s teuoxopiu4omt lictasfsrtaxm ou0tlt  oeiyd aDelump;(0tetrir tatfaDr nvo;t0sruo(r3ou4amenmicslt) ruaumooo0olx ifcilt s ra( s;t0 etrmf3io1omte nvs;t)srtrir3nu4lpe mivtat artax  ;u4alxn fciydls2rmn s t)trxoiocta1lateli o t0srumxmpny1ale lnvsa()sruax pnt1optn ieiyt m emnmo ()trxrxfctydop rln il( tetm(r nydam n nvi t  rrr(m ;o1texnmfeiaslmDuanvon()arenxfctydlmDranvilt) exo(r3ny1lmt  neilt sDtax ono4olt moeiyd m2emnmpnt4aetnmr to1opDelneils)setmir nodaltnmnvsl(farur( oou1openmieilsfs2eau o;(4aleoio3iytom eaueils0texr(o3iodllen feiat)aDraxrooo1oltomf3iys mDul( ont4areoiocoo1la  auvi s) exr(opoo1amenmnvtl(f rum( onu4tetnmoctlt s2ulnvsn()texnmo oatlptrlu sls0 exr(m3iodomtelfet ( aruaxroou1tlx ifetyt sDemu pn()trtoir3io1om r u o;t) ruoxo3oo4lltn net t  Dumxmono0tpx  i3iytfaDeau s (4 eerxo oatfpD lnvo (  ruoir3no4aleemiesas a2taxrono0oleomi3tasla umumpn(0 ltnmr3oy1lmtr uvo;() 2toir3oudom nlici sfsDua(r ;o0olen oetaslmDua( p;t)tetoxf tydoate uei;t) 2umiopno1om   ivtlsfsDtaxronu4tptnifctas sDem(vp t0 etoir3iatfmDrlnvo t)setrxm io4ll nlivia( a2rr(r ;u0tpxo o3tls sDemnvo;()arxnxr3tydom e i ilt) exm(m3no1al   nct t) rta(r ;u0olt micildfaDuan sn()alerxr3oadfaD livo s s2ur(o iudopt  neslt srtm(mpnu0apxnifctad a umn sn(4aleoxo oytfmt lu i;s s2tr(r oy1lpen fcsa()arrm(ront4openioeiadlm elnvsnt4aexnircoo1fate uei;t0t2urir no4om emfetas sDrmxrooo4aetoii3tasfaDra( p;u0teeoxf3oy1lm rauvilt trxr(o no1amtnlivtl(  rrmxm nu1opxnio3iad s2em(mo;u0 renmrctydfmD  ues;t) rtmxm3ny1lp nmnvt (farumumpou0tptnmi3iyslaDem(mon(0trxrircoa1oaDr ivo;(0s2xoxopou1ome lfet t aDrau poo0tltomictat mDelu o;()aetrmociytoat li ol( tetrxm iudole  nci ( s2rrumpnt4apeoii3ilt m ulnms ()tleomo3ta1lptrlies ( t2uoio3nu1ameemfvta(f 2taxmo;t0tltoifctydfs emuvp (4artnmocoodfmt aueslt) rur(r nu1ll  mfcsltfaDtm(monu4olenioeiadfa2rmnmo;t0teerifciydlmD  uvo s  etr(r3nu1am  mfvta(f ruau onu4olxoifeilt s2ranvon(4artnir todlaDrauvslt  rurxmpio1ape licsl()srtrx poo4tlen ieiatfmDeln p t4tltnmr tydlm eauvo;s0tetr(o iu4aptelfci s sDum(  ot1alt mfciltlmDrln s;u0tltrmo oatfm  anei;(  rxrxr io4amenmfvtl()aDraxm ;o4aetn iciydlm2umnmont0tetnmr3ty1fptraneolt0 rurir3oy1am  mfcs () Dum(rpou0oleoioetasfsDel(vpnu4 lxnir3oytlp e u s;s setrim iu4oltemncsa()sDur( p;u4teto fciadfm2ua(von() etomrcoo1omDrlnesls teto(mpnu1lp  mictat) ruaum no0oetnioeiysfm2emnvonu4trtoxrctadomtrlnei;( t2toxmpoydal elfeilsfaDtm(m ;t4olxnifctysfa2eauvonu4tltrio3oatom  luvils0s2xr(opiu4amtemfvsa() 2ra( ono1aptomocildfsDeln p;u0 eenxf iy1fate neslt) 2xr(r3ny1optnmncsl(  2tr(rpno4alt  f3ildlmDelnms;(4alxomrcoa1fa ean ils)trurxr iudamen fvil() Dtmurpnt0aptnmf3iatfa2ulums t0texomr ootla ean i;(0 eumxm iydoptelies t) 2ra(rpnu0ale mfetlsfm umnmont0teerir3ootom  anei t) eurimpiudaptnmnvsas sDrmu ono1altnmoeiltls umu o u0 exomocoydfpDraiei (0 etr(o3no4ole lfvta(  rurx  nt0alenifetatfaDumn p;u)tlxnmocoadlptr neil() etoxrpiu1ll   icia(  2tm(  ;u1alenif3ildfaDrl( snt4arermf iy1fpt  i s s0trto(o3ny4om n ivil(  2rmxro;t1olxnif3ildfmDumnmo ()arxrmr tatoa rli s s) rxr(r nu1al elics s) 2tm( p;u1oee mo3iys m2emumsnu0aetoxfcoodfa r ivolt seuo(r3iydaptelfeils  rtruroou0tpeomfeiatls umu s;u)areomr totopDeaneslt) rtmxopoy4oltnlici t  2tru ooo0teenmoeiys a el(vs;(0 leoio oytopDeanvo ()srumim3ou4op nlnes (fsDuaxmpou0alenifciasfs2umn s;t4trtrir3totfmteanvi t trtr(opoy4lpe mnesa( arraum ot4olxomfeiyt s2um( pnt0 rermf oy1lp ean il(0tetoir io1lmenlfeiat)srtru o;o4olxomfetlsfm rm(monu0 ltrmoctydlaDrln i;(  2toio3oudom  licsatfa2tm(mono0ole ifcildfmDrlnmp (4trxrio3iotomte nvo;( t2toxm3oodlpte fct (fsDtau  nu4opxomi3iadlsDean pnt0 lxrmrcoadla   uvs;t0 rtoimpny4ole lfcsasf rrmxrpnu4oet moctadlaDeln ont0trxomfcoatlaDe u s s  etoxr nu4alenmieiltf 2trxmoou0opto i3iysfm umu s;()tlenxrcia1opDrlu s (  rxrxr nu1om n nesa(f Drrx  ;u4oeeniietad m2rluvp;u)texrmr3iytfaDe n ilt) eurir iu1lptnmivtl(fartmu  nt1olen i3iytlsDeluvo;(4altoio tatlmt lu il(  exmim3no4al n fvtlt srtaxroot1apx ifctatla ua(ms t4aeenxr ia1fm  au o t s2urio3nudameelfcsl( aDuaurp;u1texoioctlsla2ua( p;t) rerifcta1lptran o s  2xrxo oydaptnmnetas s2tmumo;o0open f3ilsls ul( s (4teerif3oodfmDrluvs s0t2umiopiy1ll emnetas aDumxro;o4tle ioctlt s2umuvonu)trxrmo3iadfpD lnei s0 eum(r no4optnlnvsasfs2tm(r no4olto ocildfm2eluvont0 exrmo oodop e i o;t)srxr(o ou1lpe mietat)arraurp;t1tet  oetat s ran o;(4tlenxfciodfaDrlivslt)t2ur(r nydap emieia(fartrx p;o0tpen ieild m2ul( on() exrxr3oa1oatr ivils) 2xm(m3nu1ap  miviasf rrrur ou1tpxomieiytlmDra( o;u4aetrxrcoo1fmt aneo;t  2urir3nu4al  liesa(fa2uaxrpoo1tleoifctls a elnvs t0trtomr io1fmtelnvilt) etmir3io1ap e ncslt) Dtrxr ;o1tee moeiysfa rau pn(0aetrxrciytlaD ai i ()t2tmxopiydlme  nct tf Dtm(rpot0tlxnmfetlsfa rl(vsnu0alxrmo oadlp   neslt0 euoio3nydaptnlfvtas)s2urumono1aleoifeiyd a ulnvs u) exrxfctatfp   uvo;s0t2xoxo3nodapt micsatfs2uru pnu4ale  o3iysfs um(msnt4 lxomo3iydfmDraivil() ruoio3ou4olen nvslt aDrr(mont4ole  f3tat a ea( o;() ltrif ta1opDelieo;(0srtrxo3oo4lp e ietas)a2trurpot1aee  ocildls ul(vo;u)tleoxrcoytlatelieo;t)trxmiopio1apenmncta(fa2raurpnu4aee  f3iltlm rlu o t)alxomrciy1lat li o t0trum(m io1llee ivs ( arua(r oo1aexomf3tltfm2eaumsn(4aleomr ia1opDrlueo t)s2tr(r iydole  nei (  ruaxmoou0ale iictltla2elnvp (4trtoxf iytoateai sls) 2urimpno1lmtnmnesa( aDtmxm nt4olenioeiydfa rlu snu0artrxf3iotoatrlues s0texoio3io1omte fet () rtmxm ot1oexomiciys a2uauvo u4 rtnxrctadfptrlnei;s0srtr(opiudlptelfvia(f Dtmump;u4ape mfciysfs ra( o (4arxnmr3oodlaD ai i t)s2trir3oy4lm e net t)s2taxrpno4olto feiadlsDuln p;u4aeeomocto1oaD  nvs;t0s2ur(opio1oltn nvtat sDtmu  ;u4tlx mi3iydfa umuvo;(0tlxoirctadfa  au ol(0sexo(r3ny4olee nes ( artrxmpnt0aet  o3iytfa2umnmp;(4alxrmr3iatoaDrai ils0 rum(o ou4amtnmncils) 2trxro;t4ape ifeiat sDrmnvp;t0aeermocia1oatr ivol(0 2uo(rpoo1ll nlfcilt) Drrumoou4tleo iciyd a2ean s t4 reomr3ootla r uvs t)tetmim3iodal e ivia( a2trx pnu4apxnii3iyd s2ran o t4aeermf ia1lmteluvo;(0srto(r3oo4alenmnvias) Drax poo0oet ioeiasfsDulnmp u4trxrir3iydlaD  nvs s)srum(opiy1ll  lneias)sDur(monu4openifctydlaDuauvo;()treoir3todopDe n s s tetr(o3oudamtnlfeil( aDtm(mpnt0opeo fetatfmDrln o;(0 lenirctadopDelu o;() 2xmxr nu1lmenliet tfa2ta(  nu0aet  o3tltfs2ra(msnt)trxnmrcoatoaDraneo;t trxmio3oydopenlfvilt) 2tr(m no4aexoif3tydlaDean p;u0arxrxrcto1opDrai s () euoio3oy1altelnviat) rur(  ot1oeeoifetldfaDrmuvp;u4arxrxr3iotfptrlivo t  2xm(m io1olenlnci ( sDrrx  oo1optomo3tysls2rluvs;t0arermfcootfpDrli o;t0srxmir iy1omt mnvtlt  2rm(roou4opeo ietyd aDrmnvonu)aetnxf tadopDrlivolt srtrir3nu1amtnlncs t aruru  ;o1tpto ietys m2eanms;u)areomrcoodfm  ai ils0t2xoxo3nudamtnlfctls aDumu  ;t0alxomf3iadfm2elnvsnu4tleoxociodlaDean o;t0sexrxr oydlme lietasfaDrmurpnu1tleoiociadfmDulnmp u)tltoxrciatoaDelu o (  2ur(r no1lle  iei ( sDrmx ont1aet  oeiat a2eanmp (4aeeoxo3ia1oaD aueo;t seumio3io1opee fvt sfa2raur ou4alenmoeiydla2rm( s;u4aeeoxo3iotfpt lnvsls) 2trimpiy4lp  lfeiltf Drmump;o0olen f3tytfm2emu pnu4tltomfcoodlp raneilt0 2xrir iu4ame mncs sf 2raxrp;t4tlto f3tlslmDeaump;t)teenif oy1fm   nvo t  2xmio iu4olte ncsat)aruaxmono4tpeo i3ild s2ranvs;u) exoxr oadomDelivi;s  euo(rpoy4lm  lieilt)a2tmumo;t1tlt iicilt s2el(msnt0aexnxo tatfmt aieils)trurir oy1ol nmneslt)a2trump;u0ope  i3iat a2emu snu4texnmf io1lm eauvi s0t2xm(r3nu1am e ncsat  Dtr(roou1opxn f3iys m2uau snt) rxnxf3iytlm   iei ()texmio3io4omenmneil(fa2ta(rooo0ope ifctldfsDumuvo;t)artnioctatfmD aies t0srumxo ny1opee fei t s2raxm nt4alenmfeiys aDul(mo;() etoio iy1opD  ivo ( trurio ou1alt mnei (f 2rru onu1tptn i3iad s2uanvont0tltnxo3iy1fa raueo;t)seumim oo4al nmnvt t) rrm(rp;t0teeo feiadfa rl(von(0tlxrxocty1lm r i sls0teurim oudlm nmfvtls)srrau poo1tlx iocilslm2rauvp u0 exoxo oo1fa e u i (0 rxrxo3nu4op  mivi (  Dumumpoo0alt ifeiyd sDemn o u) lxrmo3ia1faD auvi;s0srxr(mpiu1al nmnctat)sDrm( ont4ole iiciyd a2uau pnt0trtoif3io1laD aueols) rumim3oy1oltn iet (fa2umur nt1teeo fciadfa rln s;() rxnmr oodopte nvs s)t2xoiopiydll elfei t artrurono1alt  ieild m emn pnt) ltrmo3tatfatean s ( t2ur(o iu4opt  iesat) 2tm(mo;t4oetoif3iasfm emnvsnu4 ltoio tydfmte iei t)trtoxo nudoptelfvt t a2tr(m oo1oet mf3iatla el(ms;()trxrmf oodfm elnvslt) 2um(m oodoleelfvtatfsrua( o;t0apt mfcild m ulu pnu)arxomoctodla elu ols)srtmxo iodolt  nvta() rrmxr ;o0opx mo3iyt a2ua( o t)artnxoctotopDean sls0texrxo3io4op n nvt s)s2uau poo4apxniicilsfs rlums;(0treoir totfmt  nvs;s texmio io1aptelnctl(fsDtr(m ot1ope mociadfa2ua(vsn(4tltrxr oy1fpDeanvsl()trxr(m3no4om   ivsa(fsrtm(rp;o4opx mfctlt a uln p;t4 etrmr3to1fpDr ivo s0 rtr(mpiu1altnliviasfsrrrum nu1teeoio3tld m2el( s;u)areoxf3ty1fpDe nvi s0trtmiopiodale mivil( a2tmx o;u0tlxo ictasfsDemu o;u0aexnxfcoadfm eln sl(0sexmxm3nu1opt  ivsa( aDur(ro;o0ole mfciaslm elumo;t4 reoxf oy1oa raivs t t2urxo oydale lfcilt)sDrau p;t0optnmoctltla elnms;t4 eeoxf tydomDelivs;t  2xoim3oydaleelfcta()arua(moou4alxoif3iydfm2rlums;(0arxoif iodlaD  nes;()trtoimpoo1am elnviltf rtru  ;u1tltnmi3iysls emnms;(0 eeomo iytlpD aiei;s)s2umio3io1ol  lies s srraxmonu1tlt  feild aDem(vs u)trtomr oadlp ranvo t)s2umir3iudam  mnct t  Drr(r nu1oetnmi3iatlm2um(von() ltrir totfm eaueils0s2toim no4olte ieilt) rrm(mp;o4oleniieildfa rmnvs;t) etnif3ty1laD  ivi () exm(mpiodlpenmicsl()aruax oot4apx  i3iytfs2uaumo;u)tltoxf3iotopt ln o;t)seuoxmpiu4opt mnet s)sDrm(root4tpxn octys aDuaums (4altnio3ia1oatrau s (  eumxopoo1ameelivils sDrm(ro;o0oeenioeiytlm um( ont0aeenxociydfaDeaiei;s)seuo(opny1amt lies s s2raxr ou0olx mfetysls um( o u0trtrxfcia1oa elnvo s0trum(o oy4lm emfet (f Drmu o;t1altniieiltla2eluvpn()trxrxrctytlate ivi;( s2toiopoo4omte fesatf 2rm(m ;o4tex iiciys aDuan p;u0areomrcoatfpt  ieils  2xrio nydol emici tfsrurx p;t4oetnmieiaslmDulnmo;u)texnifctytla rauvo s)tetr(rpny1lleemncsat)artr( pno0ope  octytfaDrl(mp u)aexrmociadlpDeli s;t0setmir3nu4aleelfetat  2rr( oou1oexn fctatlm2rmnmp;u0aetoxo ootlpD  neo (0teuoxr iydlltnlivsat a2rax p;t0tpxo o3tls m um(mo;()aeerif3oadlaDe nei () exm(r iy1ll e ivsasf ruau pnt1tlto ieilslm2rm(vonu4 lxrmo io1lptrluesl() etr(rpnu1ll n net sfarrrumooo0tlxoii3iytlmDemu p u) rxoir3tatfmtelueo s t2tmxr nu1ome  nei s  Duaxmpnt4teeoif3ild a2ea(ms;u0texnxr3ty1fm rauvsls)srtoxrpio4optnlivi ( aDuaxrp;u4alx  o3tytfs2elnvon()tetrif3iatlaDraneil(0 eurxm3nu4am n nvsat)s2trxro;t4ole  feiyslsDuaumsnu) exoircoo1fm   i i;t setmxr iy1ame  nviasfa2rru onu1tlxnmo3iatlm rl(mp;() leoifcio1fatraneil(0texoiopiu1lmen fcias)s2tr( pno4ale  f3iasfmDrm( s;()arenxf iadop rln sl(0sruo(opio4omt lfesl( arum(mo;o4apeoiiciatlmDulu o t)trxomf iydlmtrli o;s seuo(r3ou4lltn ivsls  rtmxr nu4apenmfciyt s rm(vsn(0aeenxr tadopt aies;( trur(rpny1am elivs tf Durx  ot1tptomoetatfmDum( pnu0arxnio3ty1omtraiei;(  rumir iy1amtnmici (f Drrxrpot1teeomo3iytls2em(vsnu) ltrmociodfpDeluvs;()teur(mpoodlmee iviat)sDumur oo1aleoii3tldla rmnvs;()tltoio3oytop elu ilt0 2xr(o3iydal e ivslt srtrxm ;o0open o3iysfa rmn ont0 leoxr3oy1lpD  ivslt) 2xo(r oodoptnmivil()aDraxr nu1teenmf3ildlaDeln p (0treoir3iy1fm rli ols) exoim iydamtelfes sf rta(m ou1tpxomo3tlsfsDranms;(0aetomr iadomtr ueo ( sexmiopnydlptnlivia(  Dumx o;o0apeoifciat a uau s (0 exnircto1om eauvs ()t2toiopnu1lptnmnesat)arumu pou0apeomfeiad aDrauvs;(4aetnir3tadfp elu slt0truoiopiudam n nvsatfsDuru o;t4optnmfeiat aDeauvon()aexrircoa1fpD luvo ( t2tmxrpou1lptnlnvs sf 2trumpnu4alxo ieiatfs2rm(mp;()trenxf ootop   nes s  2tm(mpiudap  mfci t) rumxmooo4oeeo oeiadfm2uln p;t) reomr iotomDe u o;( s2urio3iu1ale lictlsfaDrrxmp;t1aetnioctas m2rlump t4aetnxrcoy1oate ivo s seuriopnydomen ictlsf Dumxmpnt1aeeo octldls ra(mo;u)treoxo3iatoatrln sl(  2xoxo iu4lm emics t aDtrumonu1alx  f3iydlmDul(vo;t4 exnirctytlpD ln i;s) 2um(m iu4ame  ivias aDrrum ;o4tlx  oeiadfa rlums;() rtrmfctadoaDran i ()sexo(opny4olenlncsatfs2raxm ;u0olt  octyslsDrln o;()aetrifcio1lm eaivil() 2xoir3oy4lpt mfvsas s2truroou0tpto i3iyt m umnvs (4altnmociy1omD  n sl( trurimpoodlpenmictls aDumuro;o0ale ii3ildla rmumsnu4 exnio3iatopt  i i ()t2trxo nodam nlicsl() 2ur(rpno4tlxo f3iyd m2elnmo (0aetrxf3oa1lptr u s s)t2ur(rpoo4llt mncia(faDurx pnu4optoioeiasfs2eanvs t)tleoxr3tytlmt  n i t  rurir nu4al nmicsa(fsrumx pno0alxn ictysfmDrmnms t4texoxfcty1op  aneo (0s2xoim3iu1op elieiasfa2ra(ro;u0tpeomociatfa2uanms (4tlxrif3tadoa raiesls  2xmim3iydlpenlncslsfsrtr(ront0apt mi3tys a ulums;u)aeeoxo3ia1oa   nvil(0s2toio ou4lleemfcs s s2uru pno1aex ifetas s2em(msn()aetrxoctytoptrlueo t0 etrxm3ou1ole mncilt)srumurpnt4opt miciyd a ra(msnt4tlerir oytomtraiei;s  2xmim ou1lpeelfvs s)arrr(moot0tpxomi3tlt a2em(msn(0tleoio iodfpDrli o;s0s2urir ou4lmee nes () rrrxrpnu0apt  ieildls2emuvp;()aeerir to1fatelu ols)sruoxo iy1aleemivils) rur(moot0tetnmfeias m2rlnvp;u4 reoiociy1fpDeli ol(0srur(r io1lmenlieslt sDrrum oo0apen ietas m2rl(mo u0arxomo3iadfate ieilt  etmim3no1lmenlfet s sDua(root0aleo i3ils a ul( s;u)texoxocoo1opDelu s t)srumio3io1amtn ivias srrmuro;t1alx iociat m2elumo;t) exnmf oatfatr uvi (0sexmxm iydll   fvia() Drrx  ;t0tex mociasfa eauvsnu0tetnifciatomtranes t0 rxo(m3ny4aleemfesas)aDum(r ot0aptnio3tytla emn o;u) rtnmr3tadopt an ols)trto(o3oy4ap  mivi ()aDua(r no1openmictydla um(vonu0altoxo3ia1lateauvi t)truoxo iudapee ieils) rur(ro;u1tle ioeildfm2ean o;u)tetniocto1la r ueslt0tetr(o3nu1oleemnviltf 2tmu oou4aee miciydlmDelnmpn(4arxnifciydla eau ols)trtoir nudope lncilsfaDur(mo;t0opxo ietldlaDemu s ()artnmfctatopte neolt t2trimpnodaltnlicsls) 2raum ;u0oexn oeiydls2eau p;(0tlermo oodoptrli s t0 rtmxr io1altn iciatfartmxrpnu1ape io3ilsfa2eanvs (4trxrir tydfp  lneolt)tetmxrpiu1op e nctlt)srrr(mp;t4tltomictls m el(mp () ltnmf ty1faD  ivs s0t2ur(r iydlptemnesat)a2ua( p;u4aeenif3iatfs2rlnvs t4tetrmf3tatfmt luvilt)seto(mpnu4om  lics t)a2um(r no1tpx iiciytfm2um(vont4altoxo3ia1lmte u ilt)srtoxr iudolt  iei t)s2ua(ro;o1aet mociatfaDrl(vsn() eenxr tadlm  auvs t) rtrir iydlp  mfvias) 2rmx  nu0tle iiciyt s ua(mpnt)tltoio3oytlatrluei;s)t2trimpny1om emfcias srrrx ooo4optomiciad a ra( s t)altrmr3iydopD livs s trurirpnudol  livilt artrx  nt4openif3tatla2rlnms (4trxnxfcoadfmt au i (  2toirpoo4ame lnvil(fa2trxrpot0apeoiiciys m2rluvonu)tetomr oo1omD  neslt0 rumim iu4ole mieta()sDum(rpot0ale if3iysfm2em(mo ()aeeomo tatla  an o;s srxmxr no4lle lfvt s aDrax ooo4alx  ietlt a2rmnmont)tlermr3ia1opteaiei;t0s2uo(m iudlleemfvt (  Dtmx pnt0oltoiociaslm ua(mp (4alenxr tydop elu o;(0s2tmxr3iydlp e nvi ( arrmx  ot0tltn oetatfa2rmu pnt4 reomf3tydomtelneil( trtrir3nu4optemnvsat)arurum ou0tleomfciys m2rlump;()trtrmfcoytoaDeaivol()t2uo(opny4op elfetat)sDtaxronu0aeenmociat aDumu o u) eeoir ty1fa  luei;t0trtmirpoodale  fvt (fs2urxrpot1optnmietlt a rm(vsn()tltrmo3ootop rlnei;t  exoim iu1lpe mneiasfartmx onu1alxn iciysfa rmnvsnt4alerirciytlate uvolt0 2toio iu1oleelfvsa() 2rr(m nt4tee ifetadls2uluvo u0altrmr ia1lp rluvsl()truo(mpiudapenmivt ()aDururp;t0tet ioctaslsDrau o;(4 rtomr tydomte i i t)trumxrpio1lmeemfvtat aDua( pou1tee mi3iydfsDea( o;t4 leomf iatfpDelneolt teuo(m3ny1olenlfcslt arur(rp;o4tpxnii3iaslsDel( on(4tlenmo ty1oa r i s (0 2umir3ou1aptemivsls) 2rmx ono4aeto iciyd m umnmonu0 rxnmr ootfp e ivilt0s2uo(r3iudlmtelict (  Dtmumpno4oexomf3ild aDum(vs;t)trenifcoo1opt  nei;s)s2ur(opiu4amee ncias) rtrxr no0olx mfeilsfmDumuvsnt4trxoxo3oytlmDe u s s0s2tmxopny4opee feta(f rrr( ooo4tex  oeiat mDulump ()trermfctadoatrlnei (0t2ur(o3oodam nlncsl( sDrmxr nt1oeeoifctatls uaums;t0 ltnxo3iadlpDe i s;(0trtoio no1olenlnvilt)aDrmuro;u4tpx miciydls el( o u)trenmf iytlm   u s;(0trurxopny4ll  lnvs tf 2uaurpou4tet ioeiys mDra( p u)tlxoir3todfm eln s s s2xoim3iy1omt livtl( srumu poo4tet ifetys sDua(mp;t4tlxoxo iadlaD luvils t2urxm3no4op n fei t) 2tr(m nu0tpxomfciltlmDelu s;() rxnmo iy1laD auvilt srtmxo3ny1omt mncs ()arrm(  ;t0aexnifcias a ulnmpnu4trtoxr to1lmt an o;s t2trxm no4op  lnesls a2raxr ot4tlxo ociyd mDumn sn(0altoxr3io1fp  lueo t)tetriopoodoltnmnci t  Dumur ou4tpeo feildfs rm(ms (4aetrxf3iotlptr ies;s0sexmio3iodapte nctl()a2ra(mp;t0oltoii3tatla umnvo;(0trtrxf3oo1fp   neo;t0 2xoiopnudolen fvsls aDtm(m no4oet  fetls m2ea(msnu4 rerir oytlaD luvs;s srtm(o3ny4lltnmietatfs2trumont4aet  octytfa2eanvp (4tetomo iy1opD  u o s0srxoirpny1op  lfct t s2urxrpoo4aexomoeilsfa2ra( s;()alenir3io1lmD  u o;t0t2toxm3oudapt lict tf Drmx  ;t1tpxn fctyd mDrmu on(4 eenxf ootoaD aieo;(0 2ur(opiy1lleelivs tfarur( o;t0tlxniieias s2umuvp;(0 exnmf3iytla  ai olt0sexmxr3iu1alenlnes ()sruaxmoou1optnmfciatls2eauvo u4 rxrif3tytlatelnvo s)sruoio no4lp  mfvtltfarumxrpou4tpx  octat m2uln onu)trtrir3oydlpt anvs;s)s2to(m iy4ame lncslt)a2ta( pot4altnifeiyt a rau pnt0arerio3iytlpt aneils  rtoxopoodaltelncsas)aDrr( o;o4tex mfciysfmDranvp u) lenmociydfmDe ieilt t2tmxm nydllt lfesltfaDtmx  ;t0altoio3iadla rmumpnt)tetrmr3tatopD  u s ( trxrxrpnu1lptnlfci () 2rmxr nt0tlto ociytls2ra( o;u0 ltrmr to1omDelieo s)seuoxr3ou4lmen ncsa(fsrta( o;o0apxniociad aDrmuvs t0artoxo oadoaDrauvs;(0sruo(m3nu4lptn fvia()arrrxm ;o0apxn octls m eaumo u)alerxf3oodfmtr neols setrim3iu4lpen ieil(  rtmurpnt1ole ioctysfs rl(msnt0 lermr todop  auvol( t2xr(m iy1lm emfeias)arrau p;t4texo fcildfs2rm( pn()aexnxr oy1lmD  n o (0 2tr(r iy1aptemfetas a2tr(ro;u4oee mfeildla ul( pnt0 etomrctodoaDeauei (  rtoio3oodomt mfvi t a2um(r ;u4tpxomfctltlsDelu s;(0 lermo3to1fa  anei s0seurir nu4op  mnctls s2raxmont1oleoif3tltfm umn p ()tlxnxo oadopt au ols) euo(m ou4op eliviltfsrurur nu0aex  icilslsDrmnvo;() ltnxr iodomDeli ols seumxo3oo1omtnlfci t)s2um(ro;t4tpe mfetltls ran p;t4 etoifcoodomDr uvs (  exoimpoo1ame  ivtlt)aDum(moou0oee mi3tyt m uan o;u4 rtrir iydfmt lnvils0srur(r iu1ll  mies tfsDtaxro;o0texomoeiyt m2um( s t4alenmr3tydoaD lies;(  exoxm io1amtn nvtls)aDrrx ono4altnifeiadls2ran o (4alxoir iydomt an o s t2xo(m oydll emfct tfa2trumont4alx ii3tad mDumnmpn()tlxoioctytlmDrlies;t)truoxo iodamtelieta(f Dumu ont0aeenmociys aDrmnmpnu4trtnifcoytlatrau i t)setriopio4am emfvslsfsDum(rono1aetoii3iatfa rl(vonu0 eenxocootlp eaivolt teurio3oodlpenmnci ( aDrrxm ;o0apxnio3ilt a rln p;u0 leomf3iytfaDe neols)setm(rpnu1ome  fcia(fsrur( p;o0opto feiltla2ra(ms u0tlxnir3iydfpt auvsl() eto(r3nu4omt  ivsat)artrx o;u1olx mo3tytlaDua( snu)trxoxf totfptraueo;( setoxmpiydalee nei sfs2rm(rooo1tetoiociydlmDuan p t4teenmf3iy1lmt lneslt0t2trio3ny4lmtnlivtatfaDtrxroou0opeo f3iyt a rmn p u0 ltrxr oa1lmteai i t0teum(r3iy4lltnmici ( sDuaum ;t1tet  ocias a2rmuvpn(4tlerio tatlatrlueo t  eumio3nodllt  ieils)sDrrxmp;u1oee moctat m emu s;u4 eenif oy1fmD  iei;s  2tm(o oy1amtemnes s)s2um(rpoo0tpxnmicildlm rmnvo u)treoxo iadfa r ues;(  rtmim3oydomtemicslt  2truronu1olxn ociyt a2rlnmsnu) ltoxo3iadoa r n o;( t2tmxmpno4omtnmivsltf rur( o;t4texn ietad mDel(ms;() rtoioctotlaDr n ils  2xrxopny1omt lnvtls)sruaxm ou0tetniieiytlsDem(vo t)aleomfcoo1fp ran il( trtrir3oudal emfvsls s2um(moot1apx iictlt a2eln ont4 rtnxfcoytlmtrai sls)teurxrpoudll n nvsat artmu pou1texn fciytfm em( snt0 exnif oytomtran il(0sexo(o oo1lmeelncs s sDtmu ont0alen ietldfaDrmumo;(0trxrif3todlp elues;s0 rumxrpoudape mncsat aDra(mpot1tptomieiytfa2emuvo;u4aetnir3tydfptelu o;( t2trxr3no1amee ncilsfartaumont4aetnif3tatfa uanmo;t4 reoifctydfp   i sl()s2uo(r oo1amenlfci sf 2tmu  ou1texoioetld sDel(mont)trtnir iatfm e i i;s) exmxo iodlltn feta()aDtaxr nu4texo ictad aDrmnmpnu4 lxoio iydomD  uvo s) 2trir io1amtn fcsl( a2trumo;u4tlenmiciysfmDrlnvs;u0 rxnif tadfatrlnvo t seumir iy1lmtelivsls)sDrmu  nu4tpxo ietas a2ua( p u0 rxrmo3ootla rlnes;s)teurim iy1oleemiei s)s2tmx  nt0tlen ieiydlmDumnvpn(4 ltoio tadfaDr nvs s0setoiopio4lpen ncs sfsrta(m ;u0apeomfeiltfs rmumo (0aexomfcoodlmtrlnvsl(0srurio no4ame livi s  Dtmu  ;u0tltniociatlm uau p t0 rxoxf3oytop raueo;s) 2tmir no1lpen neil() 2rmur ;o0olxomoetltfs2eln p;u0 lxnmf3oo1oaDeln olt0t2uoiopny1lpe mivtasfs2tmu pot4aeeoii3tlt a ra(vs u0arxrmf oydfmDrauvo (  2xr(mpnudlmtemics sfsDtr(  ou1aee ioeildlm2rau s;u0treoxo tydoptrau o;(0sexr(m iu1aptn nvi t)srrm(mpou4altnii3iasls rmn on(4tetoxr3oy1lmDraies t)t2umiopny1alte fvt sfartmur oo0texoioetat mDel(msnt0arxomrctatoptrluesl()s2uoxm3oo4apee neta( srrm(rpou0apxo oeils m2uln o ()tetnxr3oodfp e nvs (0 rxmir nu4oltnmfes s)a2urxmooo1oeeo feiasfm umnvp;t0altnio io1fmtrai ils0sexmir oy4lpt mfcslsfartr(m nu0aex io3tatfs rln o;t)artrxf3oodfp elnesls0sexm(o3oy1apte nct t sDtmur oo0tpx mfcild a rmnmo u)trxrxr3oydlpDr u ol(  ruoxr3nu4ole  ncs t a2tmxmpot0tleomietadlm ra(vo t) rtrmf oytom r uvi;()setmxr iy1al  licta(  2tmu  nt4olxn ieiys s2elnvs u) rermrciatfm rlivs (  etm(m no4olen ici () Dumx  oo4aexo fctat mDul(mo u) lerio3oadlm eauvols texrim3oo1al nlies ( a2rmx  ;u1opt  ietls m elnvo u)aexnmf oatlaDr n s;s)srurxr3oydap   ncsas a2rmxmoou0opto ieilt a ea( s (4teermf ia1fpDeanes;s srtmiopoy1ap e nct sfs2uaum ou4apxnmfeiytfm emumo (0 reoxo3oy1lm e ivi s  rumxmpou4amen ici t)a2tmxm ;u4oltoioctadfm rmuvp;t4tleoxo ootla elnvs;( seumxr nodlm  livs ( sDrrum oo0openio3iyd s rlnvp () ltrircoytfmtranes;(0texr(o no4ap e ivtl( srtmx o;u1tleomoeiyd a rlnmo (4 etnmo3ia1oaD lu i t setmxr3oy1llt mict tf 2taxroot0opxnmfcilsfm ul(mo;u)tleoxf oodomD lieo;(0t2tm(m3nu1openlieta(farrrxr ot0apxo oetlslm eanvp (4 exnmfcty1oatranvo (0trumimpnodomtelfctat aDrmurp;t0opx  icildlm2rmnms;u)trenif3oatfa ranes ()sexmio3nodol emnvtatfarra(r nu4oetomocildlm uauvp;(4 leoxo totla elneslt) rxoio3nydol nlnetatfsDtm(m nt1oexoif3tldfaDem( sn(4 rtrxr io1omtr ivo t0 eum(m ny1ap nlfcs (fsrtmxmo;u4aexn fetls s2ra(mo;u4aexrifciy1oatranvslt) rtoxr nudamen icilsfarumxr ;t1alx ii3iltlm2em( p;u)tltnircoodfa   ieolt0t2xoxm3iy4ap elicta( arta(m ;o4tpx ioeiyd mDrlump;t4 ltrxr3totlm  aieil(0 2tr(opiydome  iesat)aruru ono4alxnmf3iatfmDem(vs;u4treoifctodlp e neilt0tetrimpnodap e fvt t a2uauronu0texo o3iatlmDumuvs t4 rtnir ootop r uvo s s2tm(m io4aptn nesasf Dtr(mpnu1ale  fctatfsDrl( sn(4 rtrir oytfa r i sls0s2xrir oo4amtnmnet sfsDurx  ot0tlxnio3iydfaDra( snt) exrir oatomD lnvs t  exr(m3no4ll   nvsl()srrmumpou0alxnmicilt m2rm(vo u) rtnmo3iatomD livo t0tetmim ny1amte feslt)sDtau  nt1ape  f3iysfm2ea( s;u0trtomo3totfpt an o;t srxmir3oy4llen iet ( s2rrum ot1aexniiciydlaDrau p (0 ltrxo iytlp   uesl( srtm(r oy4llenmfesls)aDtrur nu1oleo oeiytlaDrauvp;(4texomrciy1la  ai o;( srum(o3oo1op  mivi sf 2rmxm oo0tlxomieiat aDumnmo;() reoxr3oa1oaDean i;t seumiopiydlpeemnesat) 2urumono1alt  ocias sDrm( ont0 lerxocoo1oaDrlivi;()seum(o3nu4opt  nct t)arrmumooo1olt  i3iydfa2em(vsnu4arenxociadop rlues;s) 2umxr ny4amt lnctat)arrmx poo0tptomo3iyd m2ul( o u4 eenircootomt aieils)trur(opnodal  mnciasf 2umur ;u4oltoiiciadlm ranmo (4tleoxf todfpteaneol(  eurim3iy4amtnmnetl( sDrrxr ou1ope  feiad s2eaumon()aexnmr iadfa rlues ( t2uo(opny4lm e nvsl()s2tmurpnt1tpxo f3ils m2ra(vp (0 rerxf oadlm raueol()srxmio3ny1om emnetat) 2tmxr ;u1altomfcils aDuln pn(4aexrioctadoaDr n i (0t2trimpoudamenlnctat)arrax p;o4apxo fciltlmDelnmp u4aetrir3oa1oateai ols)s2toir no1op elicias srrr( pnu0apeoifeiyt sDuan pn()altrmfcoy1oatrluvi;s0 rxriopny1ll elncia(fsrraxm nu1tltnioetas m2el(mpnt4arxnmfcoydomtrlivs;s  rxmxo3oo4omteliviat  2tmxr ot1aex  ieiatla2ulnvpnt) lerir3oydlm eluvi;s) rtoiopnu4ap   fes sf Duaxro;t0oltnifeias aDran on()aexomoctodom rau o;s0teumxr iy1om   nvi t s2taurpoo0tptniietys m rm(vo;t4 renioctodlaDeaneol() 2um(m3oo1ope mietltfs2ta( p;o1oex  oeiydfs ul(vsnu0texoxf3oydfatean o (0seur(r oydllenlneil(f Dta(r oo1opeo oeiatfm2ua(msnt)trxnio3iy1lpt  i s;() eurxrpoodap   fesl(fartrumpno1aptn oetatfmDrl(vo;t)trtoif oa1lp eauvslt0texrir no1op n ivsat)arumumo;t4aeeoio3iaslm2el(msnt)tlenif tadoaDean i;t)t2toir3nu1ope mivils)a2trxm nu4ole mi3tadfm2uan o;(0 lxnmrcoo1fa  ln s;t  rurim3ny1op  lnci t artm(mpou0tle iiciyt m eanms;(4arxnircoydfm  ln i;s s2ur(m oo1al  licsls  Drrumpnt1alx mi3ils aDem(msn(4tetomr io1lpD an ilt) exrxm iy4ome mfei (f Dta(ro;o1oleo ieiyd m umn o;t4 lxnxf oatfm rauvslt) eurim nodape miei (f Dururonu0apeoioeiyslm eanvp u)alxnmfcoa1lpD  u o;s0s2xmim ny4oltnmneia()aDuaxrp;t0olxo i3iadfaDulu p u0tlerxo tatopt li s;( trtoxo3iydop emiviatf rrmu p;t1alxomo3iydls2rlnmp;u0 exrmo3oatla ranesls trto(m ny1aptnmfctas  Drm(rp;u0opxoiociadls rl( on(0tetnif oy1lm rau slt)s2urir nodalt  neias s2tau  ot1tltnio3tydfa2eln p u)trtoxoctodlatrau slt  rtoim nodom   ict sfa2umxmp;o4aleomo3iysfa el(ms u4 lxnif3iotfmDraueols0truoxopio1am  mfcil( arraum nt0olen ietat sDra(vp;(4tlxomr oa1om  an i t  2xrimpiudlm e iei sfa2tax pot4aetnmf3iltfm2ea(mo;()texoio3ootlpDelivslt)trur(o oudome lnet ()a2um( oot1oetomoeiadfm2em(mp;(4teerxr iadlaD  u ils)s2tmir oudoltn ieia()sDrr(rpot4opx  ociydla2eau on(0 exrmr iy1lp elnvi s0t2umio oydol elicsltfsDta( poo1alx moctld aDul(mo;t)artrmr iotla rlueo (  eumim oo4alen fviasfaDra(m nt4apt mieiyd mDuau p;(0texomr3to1op rli s t tetrxo nu4lpeemfcslt  Dumuronu4ole mf3iysla2el( p;t0aexomf ia1lmte nvol() 2xoir oydom e nvs (fartr( o;o0ale  iciytls umn s t4teenmfcia1om   uvs t0sexo(r3oudal  mnvtlt) Drmum ;u0tetomfciysfs2rmu p;t0tltrxo ta1fpt  i ils  rtm(o oo4lpt mnesls)a2umurpot0ape iiciyt s2eanvs;(0arerxrctatfp elnvo t)srtr(m iudam emfet sf rrm(mp;u0olto octysfm ul(msn(0teenif oo1op r nvo;s seum(r ny1ol e fvtl()aDtmump;t4apeo o3iytlmDrlnmsnu) ltoif iydfateaues ( setmim iu1ame lnctlsf Dta(  nt4oltoif3tatfa2emnmont) exriocty1faD  nvi;()t2trir oo4llen fcsas artmur ;u0ope iieiydlm2ulnmsnt0 rtnxrcta1lm rlnvi s)s2uo(m3ny1lptemivtlt)a2tm(mp;o0altoif3iad a2el( o;() ltomo3iodlatr neo s)s2uriopoo1am  mnetltfa2tru ont1tet mfcilsfs2ua(ms;t)texnifctadlp   i i t)t2urxr3oo4ll n ici (fsrrmumono4tpxn ictatfmDem(mo u0arxnif ia1opDrlnes;(  rxrxo3oo4am nlicsa(  rtrxronu0tpx  ietls a2rlnmp;t4aetoif3iodlmteaivolt  rxm(mpnudlmt mfvi t sDtaur nu1aeeo f3ilsla2umn p;u4artrmf iy1lmteanes;t)setoxo iu1lmee fct tfaruax onu4apxomi3tlsls2umu p;t0 lxomr3iatfpDe u s;s)srxoxopiydllen ivia(  2tmu  no4oleo ocils a umnmo;t)alxomf io1fate n o;t  2xrxrpoy4lle mnvtl( sDtmxmoou1alxnifetldlmDua( s;t)alxrir3oytlm  an i;s)tetr(rpnydlp nmicsa(faDtrxm oo0tpxo f3tldlaDrlu on(0 ltnxocoo1optr ueils) rumimpoo4ll  mnet t)aDrrumooo4olenifeiaslsDrmumo;() lxoio3totoat lneo s t2xoio3no4lmtnmieia()arurxr nt1ole mo3tyd a2rm(mo;(4 renifcta1om rau ils) exoim3nydapt  iei s)aDumuront0olt ioctyd m2rmuvo (0 renmr io1fptrau o s)trto(r3iy1lptnliesl( sDumx ono0olx ioctyslaDuanvpnu4 rxrxfcoatoat aueols teumxrpiy1aptelicils srrmuro;u0ale iieiytfa ua(vo;u) lenxo oydopDe n i t0texrxo3iu4llenmnvtltfa2trxr nu1altnmoctltlaDean s;t0trermr3ta1lmt  uesl(0teur(m nudoltelfvi tf rrr(moou4alt  ieiysfmDul(mpn(0trxrirciydom ean o;t s2xoxr no1alee nctlt s2uru pnt0tlxoiociadlmDrm( pnt0altnir oadomDeanvo t) 2trir3iu1aptelncsls aDtaur nt0aet mfeildlaDumnmsnt)trermf iodoptranei (0t2xmio3nudopt lnetls)a2umxroot1tlenifciyt s2ul(vs u0trenxo iodoaDe nvs;( s2xrir3ou1aleelfctas  rrrur nt4oexo feiyt s2rau ont0 rtnmo oydfp eli s;()srum(rpno4apeelictlsfsDrm(mont4apenmo3iyslmDua(vonu0tltrmo oatfmtr iei t0 2xo(o3oudol n nvs s) rtm(  oo1opxn iciyd mDraumpnt0artrio tatlp elues;s  exr(o3iudol  liet s artrxm ;t1oex io3iadlmDuluvpnt)altnmr3oodoa  lueols  rxrio iu1ap   ies s  Dta( p;t0apt  fctysla2ranmp u4tltrmo3tadop e u i;s t2tmio3oy1ap  lfetlsfsDur( pnt1apt moctytfsDeln ont0altnxr3oy1lp rluvo (0 etoim ou4lp emfci s a2ur( oou4tpe mf3tydlsDumu snu0 ltnio3todfa raueo;s s2xmxo3io4llt lnvslsfa2taur ;o1tpx mo3iadfa2ulnvsn()texoif3todlaD  uei;t)srto(mpnydopte ivsa( sDtmuronu0apx moetyslaDrau snt)trxomr3oadoatrlueo;(0srurxrpoo4optelfvsat)a2rrumooo4tpxo icias s ul(ms;u0aeeoir oo1lptraiei;s0 ruo(o oydom elfvt s) Dtmxr ot1tpxomf3iydlsDumumpn(0tlenmocio1fatrai s;(0 2xmio iudlle  ivsl( artm( poo0apxoioctat m2rmuvp (4 renmo totom   i o s) rurxm3ny1am nmfeia(fs2rrxmpot4tlxnifctysfs eauvs;u0texoio iotfp rau s;()trxmxo oydaltnlnct t  2ra(m ot4alxnmociltfs2ulnvon(0arenir3oy1lmtr nei;s)trtrxm no1olee nes t  rrax  ;t0aetomociadlm2rmu s;t0 lxnxfcoy1fat aivs t)srtr(opiodap nmfeia()srumum ;u4aptnmfciatfm2rlu p t) rermf iodfaDrlneo;(  euo(rpiu1olt mnctl(fs2rr( p;u4tpxoif3iatlm rl(mon(4 lerirctodopteauvo s srxrxopno4lleelnesas artm(r ;t1optn o3tat aDrm( p;u) etrmr3oo1opt luesls) exrimpno4ll e ivsa(  rrr( ont4tee miciatlmDel(vs (4 lermrciadfpDranvils s2toxm3oydoptn ivta( srur(r nt0teeo fciydfa ulnmp;() ltnmr3io1fa e n i (0teuoxmpiy4lleelfesl(  Dtrx ont4olx  ictldls rlu s ()trxoio oydla   nvs;s0trurir3nodale lfvtasfsrtr(rpno1oeeo ietld a um(vs u0aeermr totlmDran o s t2trim oodalen fet () Drru poo4optomociatlm2rm(ms (4 rxrif3io1laD an sl(  rum(r3oy1alt miet t)aDumu p;u1tet iieildlmDeau pnu4 reoxrciytopteauvol( t2tr(rpou4lp   fet sf rtau pou0tpt iicilsfaDumump;()artnxfctotom rlues;s  rtoxr nu1am   fctasfsDtm(rpou4alx moeiytla umnvo (0 reomr3iodoaDelueo;( setm(o iodop  livtas)a2tr(moou0aleniiciasfa umu s u0 eermrcoatoa elu o;s  rum(mpnu1ome mfci sfarrmu poo4tlto i3tad s em(mp;()tltnir oatlmtr n o (0t2uoim3oy1ap  miviasfa2rau ono4tlxomfctasfaDrmuvs u0artrmf oytfa r ivolt) rum(o3iodopeelnvta(  2tm( poo1olen i3iat a ulnmp;()altrxr3oa1la rln o;s trxoir oydomtnmfvs s  rtaxm ;o1aex ifcildfm rm(mp;(4arxnxfcio1omtrlivil(0s2xmxm iy1oleelictat)aDrrxm nu4texn icildfa rauvs;u0arxrio ta1lp r u i;t)sexrio ny4lmenmncsas)srurxrp;t0tpxo ictydls2uln p t4 ltnxo todlpDelivo;t) rtmxmpoodopeemfesls sDumxrpot1tlxo o3ildfmDelu pnt4trtoxrctadfmDrlnvo;(0teum(rpoudopeemieta(faDtr(mpnu4oltomoeiltfm rmu on(4 etrmr oatop e ivo;(  rxr(o3nudlp e fvs s  2rmu  nu1ape mieiyd s2ul( snt)arxrio iytom ean o s sexo(m3io4lp   fetlt sDum(roou4tlx  fciltfm2raumo;(4aeeoir3oydfa eli s;(  euoim no4amtn fesa(f rrrum ou0aleomociyt sDul(vs u4tetnmr3todfmDelu ols teumiopnydllenliet tfsrrru o;u4tltomieiys s rmnvo ()aeenmocoatlmtraivsl(0t2uo(mpnudlme lfeta(fsrrmuroot4oexo ieiltlaDemnvon() rxoxrciydopDrluvols tetoxm oy1am e ieta(faDtmx  no4tlenio3iadla2umuvsnt4trtnxo3io1lpD ai ols)t2toxopny4apee nesls sDrm(r ou0texomocils s2em(msnt0 etnmo iatfpDrlu i;(  exm(m iudom emnvtlt)sDum(m ot4aleoii3iltfsDra( s u)trxnio oo1fa  aieo;s truoxopno4op nlnesat)s2raxroot4optniociytfmDuauvs u4trtoif todlp eaues;t)trtmir ny1alee icsasfa2uaxrooo1ope mfeiyt a ulu o;(4arermr iatla   nvolt)s2umio iu1am  lneil() Dta( pou4texn oeilsls2rlnvs;t)areomr3iodoatrlueo t  rtm(r3ny4apte ici t srrmum ot1apxomiciltls ul(mo;u)tltomf3oa1om r ueol(  2toxm3iudlp emfcta(  Dtmurpnt1tlxoifctaslaDemums;(4trtoxfcoo1fpt aues t t2toxm3oy4lptnlfetlt)aDtm(  no0tlxn fciys mDel(msnt4trtomr oodla e i sl(0 rumxopiodlmen iciatfaDrr(m ou1olt  oetys aDel(vo ()arenmf iotlp ean o (0 rtrxrpnodomtemnvt s)a2urxmo;u4oetn i3tlslmDra(vsnt4 rtrmr io1om r nei;( t2toim3iydopt  neta(  Drax  ;o4oetnmoeiat m rauvp;t0 rxrxocta1fmt li s s)teto(rpou4omtnlivtlsf Dtr( p;o0tpxomoeiysfs2eln on(4artnxf3iotlm e u s;( trxmim3nydlp n ivtatf 2um(  ;t1olxoifciyt mDraump u)teerif3tatla   nvi s0tetr(r3nydlmtnlivtl()aDrrxr ou1texo ociydla emnmo;t0altoxf3totomtr u olt)teurxr3io1llt livt (fsDrmx  ;t0aet ioctysfs rmuvo t4treomo3iy1lpt li o s0 etmxr3iy4ol  mnctasfs2umu oot4olto ieilsla ea(vp;()aeerifcta1oaDrauvs t)s2umxopoydap   ivt sfsDurxr ot4aetnii3iasla2rlnvsn()texrif iotlpDe uei t0 ruoiopno1ap emfesl(f rtrx pno4oeenmociyd m elnvo u4 eenmo iadoa eaueslt) 2toxopiydalte ivs (fsDurumonu1tpt  ocildfa2uaump u4aetnir3ta1lmDeli il() etr(m nu1ap emfei s sDrmx  ;o0olx iiciatfsDemn pn(4arxrxrcto1op rlneilt) eurxopoodapeelfetlt sDtr(mp;o1opxoifeiydlaDraump (0altnmr ty1op eaneols)srtrxm nydomenmfeiat) rua(moou0opt  fctatfaDrlnmp () rtoxo3oydoa r uvo;()teuoxm3iydllen fetls sDtrx onu1opxo fcilsfm2ranvpn()tetnxrciadom eanes;t  2xrxm3iy1op  lfeils srurxmp;t1opxo i3ils mDrl(mpnt0tlerxfcoy1lmDeluvo ( srtoxrpio1amtn nes sf 2umu pnu0aptoioetad m el(vo;t4trxrifcoy1lp   i i s sexmxr no1am nlfvil( a2raxr ou1oexomfctaslmDul(vsnt)arxrmocoo1faD lu slt)srxo(m iudll e ics s) Dtrurp;t0altnmietytls2rauvpnt4alxnio3oy1lmDrai i;() 2xoxopiy4al   iet ()srrm(r ou0tpto feiad a el(mp;t4arxomf3oodfpDean il(0teuoxo3oo4lm  micsl( s2rm(mp;t1alxoioeiytlsDelnvs t4 rtomf3tatlm r ivolt0 2umxopiudlm eliciat) Dua(r ou4tetomoeildlaDra(vo (0trenir3iadfm  lnes s)t2tmimpiu4openlfctas artaxrono4aee  f3iydlm um(vs;t4texnif tatlaD luei s s2ur(r3iu4alt  ivi (f Dtm(  nu1olto ictat s2umums u) eeoxrcoatoaDrluvo;s  eurim ou4ol nmneil(faDuaurono0alt mociydlaDulnmpnu)aetrif oa1la eli o t0srumxo oy4omtelfcs () Drm(mont4opxnmfeilt a2emnmsnu)texnxo3oydopDrauvsls) rtoxm iu4ll n nvtlt) rraurono4alt mo3ilt mDranmon(4 lerir3iotopDraueo ( srur(o3iu1lmt mfet (fs2rmx onu4oee  o3tatlmDrln snu0 lxrxf io1fmt an ols seumiopoydomtnmnciatfaDtr( o;u1tpe mfeiyt a2eaumsn(0arxoio oydfm elueils) 2toxo3iu4op e nei (  Draurpou0aexnmfctltlm uln snu0 lenif iytlmDrluvs (0tetmxo3nu4lpe lnvta( s2ur(r ou4ope  oeilslm eanvo;u)tlenxo to1faDe ivs s texmio oo4lptnlics t  rumum oo0tpt ifctas aDeln o t0alxnir totfmtraivs t srxoirpno4ole mfvsl(fs2ra(mo;t4tlxn o3ilsls2uauvon(4alxrmrciytfaD  neil( srumio3no1llt mfetat s2ta(  ;u4oltn o3tls a2ra( on(4 exoio ty1lp e i s s0 2xo(mpoo1lm n nvtas  2uaumoot0teeoio3iatlm eln sn(4aleomf totfmD  ieo t0 rxmxr iodapenlnetl()s2tm(r ou0apt ioctytfs2ranvon(4aetnxfcoa1fatr n olt trxmxo nodlpe mieilt)srrax o
\ No newline at end of file
@@ -0,0 +1 @@
+n s;s) 2urirpnu1am elieia( s2tm( pno4tle mo3iydlsDulu p t)trxoxf todfmDr uvo;()t2xm(mpno4al   fvtasf rtrump;u1aexn f3iydfm2umums (0teenmf3iytomtr n i;(  2xmirpio4lme lnctlt)s2ra(rono1tle if3tydlaDuln o u)tltoxo3todlp  lnes ()s2urxm3io4lltnmnctl()s2taxmp;t1oeenio3iyt m umnmon() lxoxr3iotopt anvi s)trxm(r3nu4altelict ( s2tauroou1aexn fctytls2rln o;t4 rxrxr3iy1lp  lnes t0s2uoxo nudaleemnvtat  ruax pnt1opxomf3tlsfmDrau onu4alerxrctotfpt  ivo;s) rurio oodoltn fcs ( srumu pot4oex mo3iydlsDea(vont4 etrir3iy1fatr u s (0sexrio3nydoptnlfvtls)sDuau  ;t0tetniicilslsDulu ont0aexoxf ia1omDelieol(0s2uoim3nydalen iesat) rrrxr ;u1teenmoeildlsDel( p;u0trenif3tydlate u s t0t2xrimpiy4aptnmiesa(fs2tmxmo;u4opeomoeiysfa uln s t4tltrio3to1la r nesls sexmio oydap eliet t)s2rmxr ot4ole  i3iltls um(mp u0teenio ia1lp eanes ()t2xmxm3oo1lm e fct s  rtr(mono0ale io3iat a2uluvs;(4 etrio3tatla r iei;t0trumxopno4ome liciltf 2um(ro;t0oeenmfciyd a2raumsn()teenir3tadfmDe iei ()tetrxr ny4ape lnet () rtrxm oo4tpxoioctltfmDua( o u)teenio3to1fpDraues t srum(rpiudlmtelics () 2trxmpno0olxoiiciydfa2ran s;t)altomf tadom r n i t0 2trxo3iudome mfvsas srrax pnt1olxnio3iadlm elnvon(0alxomo3iadfpDelu sl() rtm(r nudap emfcil( sDuaxm ;o0alxnioetad a2em(vp (4treomr3ta1fmD  nei;s)t2xrxr ou4alen ncsl(  2uaxm oo4olen o3iatfs uaumpnt4 lenmr oytfaD ln o (0t2tmxrpoy4ol elfvta()aruauro;t0tet  feiys m ea(vont0trxnxf to1fmt  ivs;(0t2triopiy1lltnlietl()s2taum ou1altn ociat sDrluvo;t0aleoxr oa1fa rlu o;()srtmxm3iu1llee iei (f rrmu ont1aeeo oeilslsDrauvo u)aexomo3tadlaD  nvi t0 etmxm iydamtnlfei tfaDtmurpot1tlxoio3iasla elnmp t) rtnmo iotomDr iei (0 rurxmpnudal e fvtlsf 2tm(r ;u1tlto fctltfs2eaumon(4altomf3ta1lat  uvol(0setm(r io4optnlfeslsf 2rrxmo;u0aetomictlsfa ea(vp;u) lenxr iotomt lnvs;s sexoim ny4ol emietl()a2rmxmpnu4tpe  f3ildfs ua( p u4tlerir3ty1omD auvs;( teuo(opiodop nmivtat srtaur oo4alt  oeilslmDemnmo;u4 rermr iy1fp e nvi s) rtoio3no1opte ncsltfarrrx ont1aetn octlsfm2uanvs u0 rtnirctotoaDeau o;( seur(r nodoptnmfct t sDtaxmo;t1tltnmoeilt m2eau s u)aexoifciytfat auvi;s t2uo(m nydoleemfvils sDua(ront4tlenii3tasfaDrmnmp;() ltomr3oa1omt  u o;(  2uoim ou4ll  mfvi t srurx  ot0apx io3iasfs2rluvo u)altnir io1opD auvs ( t2tm(r nu1am e nct sfaDtrx poo1oltoio3iltfaDrl( p () rerif iy1optrlnvslt0trtrxopou1al nmnet sfa2tr(mo;u1aex  fetydfa ea(vp (0tlxnxo iatomt luvi;t0seumxopio4ll emfct t)aruau oot4tptomietlsla2uanms u)altrir3todlaD  u o;s)srxoir io4am  mics t srtrumont4tleoiiciaslaDuln onu0 lxrxf ty1op  lu ils0s2xmxo3no1llee fci () ruau o;o4apxnmf3iysls em(vs;u4arxoiociytfmDe n s s0s2umxm3oo4am   feslt a2rax pot4tet ifeilsfm2elu snt4 etriocoa1omDelu o;t) eur(opoy4al nlnetl( arur( p;o4apx  o3iys m2um(mo u4teeniociotfm  luei;t  eum(o3no4ome livt s sDtax ont0tptnii3iys m2ul(vpnu)aexrxrcoadopDrlnvi;t sruoimpny4omtnmivi () Duaxmpnt0optomfctysfmDumnvsn() lerifciotlp  lnvs ( t2tm(opoo4opt  ncsls s2rrurpnu4alt  oeiatfm2uln o;u0artnxr ta1om  lnvo;s trum(r ny1lltelnvta()a2uaum ;u1olxnmfetlsfs ranvp;t4aetoio iotfpDrauvs s)texr(m3iu4lm  lnvsl( arum(r oo4oexniociytfa2um(mo u4tetrircia1fpD lneo;s tetmxr3nu1olt liesat)arrrx  ;t4ope mf3tyt mDumn snu4texrmf3oadlatelneolt)setoxmpnudlmen net t)srra( pno1olx mi3ildla2rm( p (4trenio3oa1faDr ieolt srtmxo oy4ol nliesl()a2ur(  nu4opx mieiad mDeln p u)tlxrxo3todfptr n s;s0 2xrim iu1apt lfcsl( s2umxmpnu0tptomfetysfmDea( p u4 rtoxfctydoaDr ivilt texm(mpiy4opte icil(  rur(mpnu4tpenio3iys a umu p (4alxnxo3totfpDelnvi ( t2xr(r3iy4ameemicilt sDtax o;o1tltnifeiatfs emuvo;(4arxrxf io1op e u sls  etrir3ny4al e ictat  2uaurp;u4alenmi3ilsla ra(vs u)aexomr3tatlm r i i t) 2umir3nodomt  nesasf rtrxm nu4tpt iiciyd a emnms;t)tlxrmr3oadlptr ieol(0trtoio iu4amte neias)artr(ro;u4tle  fetaslm rlnvs t4tleoxr oa1lmD auesl(0s2xmimpnodomte ieiltfarra(r ;o1alt iociyslaDumn pnt0 rxoxrctotfpD  ues;t) euo(m ou4al   ictl()s2raxrpoo0apeomieiatfm um(ms;t0arxomf3oatoaD lu o ( t2uoim ny4opt livi sf 2ua(ro;o0oetomociltfm2ra(mo;(0artnir oatlaDe n s;t  2xmxrpnodame mivta( aDuaur oo0opt  ieilsfs rl(mon() lenxfcoa1lpteaivi (0s2tmir3oy4lmtnlfci t) 2rmxmpnu0oleomo3tyd mDum(vpn(4alxnmr oa1oatrln ilt srto(rpoo1lpe  fvs sfa2tm(r ;t0ape  f3iydlm2emu snu)arxrmf3tadoa e ivo;s) exm(o oy1lmee iesasfsDtm(mp;t1teen oeiatlaDelnms ()arxomf3iydfa rlu s (0 2to(r no4llen ici (f rrru p;t1oex  oeiadfa uluvs u)teeniocoy1omt livolt0trurxr nu1lptelfcta(fsDrmurpot1teeomoeildls2em(mo (4trermfcoa1fpDeai olt0teum(r nodlmtnlieslt  Duau  no4apen i3ildfsDrlnvo t)alenif ootla  luvol(0s2trio3nu1lp elneslt  rua(mpno0tpeomietysfa uau o;()trtomfcoy1lptrlivo s0 exo(m3io4lp  mfvsls  2rax ooo0tlxn o3tatls2rlnvs t)trxrxrctadfmtrau s;(0 2tr(m3iy1ol e iesat) Dumu pnu0aleomf3ild m eauvont)tetrmr3iytfmDean o;(0sexr(r iy1lpt  fcsltfsrrm(mpno0oltoioeiltfm2emums t4texnxrcio1laDe n s;( srxmirpnu4llt  fetl() 2rm(  no1oetomoctlsfsDumnvo;u0trxrxociydfp rauvo;s0trum(m no1ap nmiesas)sDtmu  ot4teeoioeias aDrauvs t0alxoxrctytom elivo;s)s2uoio ny4ap eliciatfa2tm(  ;u4tle mfetas s2umn p t0trtnio3iatoa e uei;(  2toxopnudlp nmics s  2uax p;o0tptoioeiydlsDul( s;t0trtnmf3tydfmDe u o;( trto(m3nudomt mieilsfsDra(  oo4tlx mfctadfaDelnmon(0trerxf tytfp eluvi s) 2um(r3io4ale mfctlt  ruau o;o1tex  ociyslsDea(mo ()aexrif oytlmt au sls sruoimpiudlpeelfvtatfa2rm(mpot4tpt mfciaslm rlumo;(4altnmr todfmtr ivils0srxoxm3iodomeelicta(faDtru ont4texnioeilsfsDean s;()alerxf tadfatelnvi;( t2xriopiy1llenlfet s)a2uaxr ;t0tpt ioeiydfa ea(vs;(4trtriociadlp  ai olt)s2uoxopoudlleemneias srrru  oo0tee mfeildlm umuvsnu)tetoxo3iadlatrlnvi t0 eumxo iu1ll emncs s) rum(rpnu0opt ioeiydfa ran p;t)tltomfciodom ranvslt0sexo(rpnodol  lfcsasfsDrrxm ot4alt mfetlsla2emn s (0 etoioctadfpt  i ilt  eur(o3oy1ll   nctl( sruau o;o0olxn octysfaDumuvonu4arerif3iadlpDe ueo ()trumimpoy1om nmnvi sfa2umxmonu4alxnmfciltfsDrlnms (0 eerif oa1lpD  neslt0srxoim iy4al e nvia( a2tm(monu1alen ieiysfa umnmp t4aetoxo tytoat ln s t0truoim3iudapt lfcsa()arrrx  nt4opx  f3iatlaDel(vpn()arxnircoatlmt  nvils trxr(m iydll elfeslsfa2taxmpnt1teenifetat m eanvs u4alxrxf ootfm elu ol(0sexr(m no1lmen nvs ( aDrrxmo;t1ope  oeiytlmDemums t) lxnxrctydlat  ivs s)s2xoxm oo1op  lfvsatfsrrr(m ;u0opt if3tldfs uanvo t) lenxocoodom   neils srtm(m3oudlpee nei sfsDrr( o;o0texo o3iyslm2rluvpnt0 etnmo tatlpD ln i t0setmxr iydomte iei s  Dta( o;o0tlxoif3ias a rlnvs;u)trermo iytomDeln ols  rto(o3oo1om nlnesas s2umxr nt0tet  i3tadlm ulnmont0tltoxfctotfm rlieo s0 2tr(m oy4alenmneslt)sDta( oot4tlto o3iadfa2rmuvsn(0trtomfctydfa  lnvolt  rumirpnu4lme lnctl(fs2um(r nt0tpt mfciadlmDrmumo () rxoio oodlm eauvo;t  exm(rpou1am elfvias srum( ono4tpxomi3ilslsDrmuvpnu)aetnxf iodfpteluvil()trurxopnodll e netlt)s2um( oou0tet ii3ilslmDuan p;u4tlxomf3ty1faDrlues s0trto(mpoodope lnei t sDtmum oo1oltomo3iytlmDuanvp (0artrmr iotopDeaueol(  eumir iy1ale  ietltfsDrau  ;t1apeoifciatfs um( o (4trtoxf3todom eaieslt s2xm(r3ny4ame lfci s)srtmumooo4aexo fetydfs uan pnu0 reomf oadlpt aivo;( seto(m3nodllt mfetat) Dum(mpno1aetniictas s2uaumo;u)tltnif to1optrauvo t trtmim3nu4omee feslsfsrrr( o;t1tee ioeilsfaDrm( s;(0 reoxr to1opDrlu s (  exmxmpno4ome lncsl() ruru o;u4aetniiciysfa rlnmp t0tltoxr iy1fa eanvs t)s2tmio3nu4llt  ieils  Durxmont4opx micilsla2ul(vp () lenmo iotlatelivsls0 2uoim3oy4altemfvtls  rtm(r nu0olx mo3iatfs2emn s;() eeoxocta1oat aieils s2xoxopoy1ll   nvias  2tmump;u0tpe  o3tysfm rauvpnu) rxrmociotfatrau s;t)trxmxr no1lmenlivsas  Dta(  nu4oeeo ietad m umums;u)artnir3iytfp   i i;(0s2ur(o ny4am  lfvs t)s2tmx  ;u1texniiciat a uaump;(0aeenmr totlaDrlnvo;s) eur(m3iy4llen iei t)srtruroot1teeo i3iltlmDranmont0trxrxr3tatopDeai ils) eurio3oodop elfct s)artm(m nt1oltoii3ildls ulump u0aeenxr totopDeaieo s s2xmxo ou1lpee fct ( srum(rp;o0oexnioetld s2eluvonu4 lxomo totomtran il(0seto(opiodlpte fes t aruru  ;o1ope mo3ilt a um(mp t4aexoifctadfpD lu ol( seurxr3oydlm nlnvs s) 2raurono0aptn oeild m ulnmpn(4altomfcia1la e n sls) 2umir3oydameelfeil()sDta(roou0apen oeiyt s2rmnvo u) eerif3io1lpD livo s)tetrxo ny4ap n ivi s) rrru pou4tpe mi3tltfm2ul( on() rxoif todfp  lues;s0tetmxm3oudomtemieiatf Dumumono1alen o3ias aDum(mp u) lxrmf ia1lm ranvs;s t2tmirpiudom elnet tfa2urxm ot4aleomoetltfm emump u0 etomocoodoaDeluei;(0trurim3oy4alee icsa(fs2rmx ono1oleomoctlt aDrln s u0tetrir iydfpt ai sls texr(rpno1al e iviasfartm(  nu4oee iociysfaDrl(vs (4 rxomf3iotopte ivi ( sexoxm3io1ap n fvsa()aDrr(  ;o0optoifctlslm2rl(vo u0treomo tatomt luvi s0teuoim3oodam n ivtl()sDua(moot4opxo feiat sDrlnmo t)texoxfcoo1laDr neolt0 2xrio3oy1ol nmnvil()a2tax  nt0aptnmfciytla2emu s;u0 etrxf3ta1oaDraues;s  etmxr3io4ameemfet s) Durx p;t1ope  oeiyt s em(ms t)altrxf ty1opDeluei s0s2toxrpoo1ome mnvta(fa2rr(root1tlx ii3iyt m2ulump t0tltoxf oo1fateaiesls  ruoir iy4lpeelictlt) 2ua(rooo0tlxnmfetytfa2emums t0aeeomf tydlm  aivi s0srtmio3iu4olt mnvsl(f Dtmurp;t1tleniictasfm2umumont)aeerio oa1la rluvils texm(mpoo4lmenmiesa( artrxmp;u4aee mieiltla eau snt4 lxomfcta1omte nvo t) 2xo(r3iydope lnes s s2taxmpoo4tlxnmocils mDrlumpnu0 exomo3iadfa   neo;()s2trxopnu1alt lfcilt) rumx p;o1aetnmf3ias m umuvs (4arxomr to1oat lieo;( s2xm(r3oo1ap e nes t)aDurxrpot1opt ioeias aDul(vp;t4tleniocoy1lmD ai i;s)s2trxrpiy1lm nmfesa()a2um(mont4teenif3iltfm ran snt)aexnxf3iotlmD ai ols)s2umxo3no4omeelncs () Duaxmo;u0opxnmieilslm ranvs;(4teeomr3ia1op eaivo () rto(r oo1lltelncsas) 2tr(ro;o0opxnmieildls ean sn(0texnif iy1la r neils  2ur(mpiu4amt mfcils) Dum( ont1tpxnif3ilslaDuau pn(4 leoxociadfpD aiesl(0s2tr(m3no4olteliei t)s2tmump;t1tpxoioeiys aDulu s;t4 rtrmf3oadlp  anvils  rtrim3iy1apenmfcsasfsDum(mp;t4aeeomietytlaDemu onu0 rtoif3oodop r ueilt) ruoimpnudaltn fvtl(f rurx ooo1tlxnmociyt s2rln p;t4artnmf oy1fpteanei;s s2trio3oo1oltelnetl() rtaxro;t4tpxomfeiat sDeluvpnt4aexrmocoodfa elnvo;(0seum(o3ou4lltemnvsls srrrxrpot1oexniiciyt s ulnvp;t4aetrir3ia1op   neilt  rtoxr io4altnmfesls) Dtau ono0opxoiictydfa ra( s t0 eenmr3iodfm rln sls setoxr no4lm emies t) 2tru ooo4tetnmfctldfmDemums () lxnmo3todlateau s t0 2uoir ny1lmt miei ()srrr(mooo4tptomfcildfsDemumpn(0alxoir oadfaDe i o;( setoim3iudam n fetat sDra(mpou0alx  iciltlmDranmp ()trtoxo oy1op r ueo t0t2xmxr3iudlp  lnes sfaDtr(rono4tlxomo3iytfsDulnmp;u)arxrmf io1lmt au i;s0 2tmxmpno1lptn ietat  2taxmo;u1aeeoiociasfsDumnvo (0areomo3oa1fmt lu o;t srxmxm oy4altn fvtas aDumx onu1alxn iciydlm2ea(vo u4tlerxf3tadopt li slt)texo(m3oodal nmivils srraxmpou1aet moeiyt m umuvo u4 ltoxrcoy1oatranvslt s2xrim3nydamtelnvtl(f Draxm ou0tpx iiciysfmDel( s;(4 rtoxr to1faDeaueo t0seto(m oo1op  livta(  rumur nu4oet  f3tldla2el( s u) etrmrcootlp elueol() rum(opny4ameelfesa( srta(  ;t4alxoioetlt a ulu p t0 eenioctydlpDeln ols  2um(m nu1ll n ieiat)aDtru p;u1tpto f3tas m2umnmp;t)alxomrcoodomDrluvo;s0trurimpiy1lpte ncsa( sDurx pnu0tpenif3tyt m2ea(ms (4trerio3oatla e uei;(0tetoxo iudale  ietas s2trxmpnu1ope ioeildfa2ran p;u)tleoxr iydlat  u i s0 etoxo iu4alen ieiltf 2rmxro;u0oetnii3ilsfa rlu p ()tltrxo3iodop e u i s) 2xm(o3ou4omtnlnvtl()srurxm ot0apt mfciyslm2ulums;t4trenmr tytfpt aneo ( t2urxr ou4lpt mfviat  2rmu  ;o4aex mietytfsDulu on()artoio tytoa r n ilt)tetm(r3ou1optelnetl( srrmx o;t0opeo ociyslm umn o;u0 rxrxo ty1lm ean i;t0 eurxmpny4ll  miesatfsDurxr ou1oexn feiydfaDrlumsnu0areoxo iadla elues ()s2xmio3iudalte nvs t aDtrxmonu1teenmfetydfm rm( o ()tltomr iadlaDraiei;s)seuoir3ny4lpt mfet t)a2umx  nt4aet ioetld m umuvpnt4tlxomfcoydomD livs;(0texm(m oydam nlnvs s)a2rm(r ot4tlxo o3iadfsDeluvsnt0altnirctydfaDeln s;() exr(o ny4omenliet t  2rrxr nu4texoiictasla2el( s;u4 leoxf tadlatr uesl()srxo(r no1ap  lnvi t) 2ra( p;o4tlx iiciydlm rl(vp;u)aleoif oa1op elneo;()t2xmxm3iu1ome  ivtl(fs2um(r ot4oexoioeild s emnmont0altrmfctotoatran s s0 2to(r ou4lpe lnct t)srua( pot4alenif3ias mDrm(vs (0 exoio3oydomD  i s;t seum(m3oydlm  lfetas)aDtax  nt0optniiciltlaDumu o (4tetoio iy1lpDelnes;s  etrim3oydoptnmnetasfarumxrono1tlenmfeiadlm2uluvs (4tlerifcto1fptr i i t s2xmir oy1lme  ivsa(f Drmu ont1opx iociatlm2ea( s t0 lerir oodop rauvs;s seto(r3ou1op  mfctlt)aDurx  ;t4tleoioeildlmDean s;t)alxnxf oydomteai i;s0 etm(opiodapte nei s aDra(r ;o4oexo oetad sDumump;(0aleomr3iy1lmDelues t  2toxr nodom n ieiatf Drrx  ou4tee mo3tytfs2rl(mo t0 rtoxr3ia1lat anei t0trurxr3oo4omtnmnet s aDuaurpou4openiociyt a2umn onu4trerxf3todop   ivils0s2xoxr3oydlm n nci ()s2tmurono0ope mfctls m2ranvp;u0aeenxf3oadfp   ivil(  etmxo iudlpe mietls)a2umurpno1tex mociydfaDuauvp;(4aexnmf3iy1omDrlneslt)trtm(m iudopt lfesat)sDrrurp;o4tptnmo3iasla2um(vpnu0arxoxrctytoaD lies t  etoxrpoo1lme lncs ( sDtau o;o1altomo3iysfa2rlu p;t)alxrxr3oo1lm r n i;(0 rxm(o no4op e fcsatfaruau o;u0oltn fciasfa2rmnvpn(4alenxr iatfa  au o (0s2xm(o3oo4ap emfeil(fa2uaxmooo4tex ifetyslaDrlums (0 lxomo3oodlat anvi;t0texrxm3iu1ameelfct ()sDua(rp;o0tle ifciys a2ea(von(4aeenifcoy1opDrai o s s2xrxr no4llte fvs t aDuru oot4tlenio3iasls rauvo;t4alerxocia1fateln o;s)seurxr3ny1om n fcsat  2umxr nt4tltomfciadfm ran s;u0trermr iodlaDranei;t s2toim iydaptn icils aDtrxrono0texn ictyd s rm(ms t) rxnxfciodfateanvo t0 rtoimpio1ol nmietl( srra(ront1tpx miciydfs2emnvpnu)artnircoatoa raivi;t)texoxm3iy1ome mnvs tfsDur(r nu0tpenmo3iytla2uau p u)trxrxfcoodlp  li il( s2xoxm3oy1oltn nciat  2tr(r ;o1optnmietad m2ea( pnu0alxrxo oodoptranei;s0trurxmpiy1lle mncs s aDrmxroou1tlx mi3tltls umuvs ()tetnirciotopteanvsl( setr(rpny4lltnmictasf 2rru  ;t4oet  feiasla2emnvp (4 ltoxf ty1lptrlnvs;t0 2xoio io1lm nmiviasfs2tr( oot1tptn fetysfa2emn onu) exrir3tytfpteau ol(0srxr(r iudol nmfeia() 2trumpnt1tet moeiatfs2umn snt)aeerxr3oadfpte uesls t2trim no1lp e nesat)a2tr(  ;u0apenmfciasfa2elnvsn(0tetnmr3to1fpD  ivslt trxr(o oo4al  mfetl()s2tm( onu4alto iciydla2ulnms;t0tetrir iy1omD an s (  rumiopio1llt miesa() rurxm oo0oex  f3tat mDuanvo t) lxnmocoydfaDe ivi;s0setmir3ou1lm e fvsa() 2urxm ;u4teeo ociyt mDrl(vsnu0aeerirciatlpDr ivi s)tetrxr iodllt mfeta(fa2umxm ot1alenmf3ilt m um( s;(0artnxf ootfpt auvi;(0sruo(opoodop e ncilt)arum(r ou1tltomociadls2elnmonu4texoxf to1oate uei () 2xmir oy1omen fes s)srra(  oo1aet  o3ilsfs2elu pnu4 lxoircootlpDelnvo;t  rxrxo3iu4al  lfvtat) 2urxmpnu1aee io3ild m uanmp;t) leomf oadfptelivs;s  etriopny4llt  ncsat)a2tax  oo1tpeoiocildfmDeanmo;u0 exrxo3iytomt lnvi ( texo(m iy4aleemivtlt  2rrxr nt0oeto iciat s rlnmont4aexnmrciydlatran i s0s2to(o3iy4olee fci t) rrax o;u4oexomieiaslm2ranmsn()tlxnircta1oateauei ()srtmir3iudom   nvs t artm(ro;u0aeto o3iyt sDrlu p;()texoxf oadlmD  n o t srurxr3oo4openlivtltfarumxm no1ale moetydlsDean s;t0 lxnio iadfatrlneo;()srxmim ou1opte fvi tfsrtrump;o1ape  oetydla2em(msnt4tltnircoydopDraneolt0t2tmxo iy4am  lieilsfs2rauro;t1aexnmieiydfaDrmn on(4altrmrcoa1om  lueo;s trxm(o iudlmtn ncsat)s2tm(r ;t1alxomf3iad mDem(vpnu4 lerxo iytlp  an s ()tetmxm3iu1oltnlfci (fa2raxrono0tle iicils s2uauvo t) exomoctotfa  li ilt trxm(r3nudlltn fei s srtmxm ;u4tpx ioeiasla2um(ms;(4 rxomf3oo1omDe uvi ()srxoim oy1lpe miet sf Dta(  ;t4aexnmf3iadfmDulu o (0 exrmocootlaD an s;s0srtrir nydlm nmivta(  Drmum nu4olt ifeiadfaDemuvs;t4 rtriociydfa  li s;s trxriopno1ll  lncsa()sDtm(mpou1ape iieiasla2eln on() lxnmf iy1faD ai i;t0texrxm3iu4lm   ieil() ruau pnt1oeenio3tadfm rlnvs u4tleomr iotfaDeanei s  rtoio ny4amtnlict sf 2ua(root1openioeiadfm umump (0trxrif3oa1oat aivs ()trxm(mpoy4lpt mfesl( artmxmo;o4tetnmfciydfsDraumpnu0 rxrxfcty1oate nvi s s2umim io4ap nlfeilt)aDta(r ;o4tlenmi3tysfm em( s;u0 etnxr iodfa raivols trtoxm3oydlmeelnvsl(fa2rm( pot4tltn feildlmDumnvonu4 ltoir3iotlateaneolt setoxm iu1amt mictls)s2tmurpoo4olt if3ilslm2umumo;t4aleomrctytlm elu s ()teur(rpiodlpen iciat aDum(rpou1oet  ociydfaDul( s;t0 rerxr iatlp  anes s seum(m iu1llt mics tfa2uaxm ou0ole ifeilsfsDuau onu0arermr3oytoa eau sl(  etm(o3iudlme lfvs (f rrmxr ot4oetoii3iyt aDrmnms;u4tltnir oadfa   uvi t)t2xoirpio1op n ivs (f Durumooo4aleomfeiytlm2uanvpnt0alenmr3tatopD anesl(0teur(rpno1om nlnesl(fs2ra(roou4texoif3iaslaDranmont4aetnmf3oydoa eaueolt  rumiopou4lptn feilt)sDrau  ;t0aptn i3tyd mDulnvs u)artnmocoodlm e n olt) rur(o3oo4lpt  nctls)sDrrurpno0oetomoetatfsDumnmp;t0 reoxf3ootlmDe iei;s  eurim oo1omtn iesls artrur ;u4oetniictlt aDuanvs (0trtrifctatlm  ai olt) exrxm3iy1ol nlnet s sDuau pot4olt mietadla2eau o u)texoir tytoaD luvo;(  2xm(m3iydale lnvta( a2uaumpot1apenmi3iysla2raumpnt0 eeoxf to1om ranvi (0trxmimpoy1apeemncias)arurx oou1tpeo ieiadfs um( ont) exnif oytlpDrln i (  etrir nudamtemfesa() rtaum ot0optniictysfmDum( s;(4 eeoif oodlpDrln i s) rurxm oo4llenmivsls)s2tr( pno1aptnmieiydlmDrlnvonu)trtoxr3totoa  au o;s trxm(rpoy1omtn ncsl(f rum(r ;u0altoio3iasfm rmnms t4arxoio iodoateanvilt t2triopiy1ap emivsasfa2ur(m nt4ole ifetldfmDul(von(4arxoxf3oytfp eaivs;t)trumxrpnudopenmnctas)arta(r oo4teeo feiytfa ea(ms;()aexoxfcty1oaDeliei (0trxr(o iu1amenlnetatfsruau p;u0optn o3iyslsDrmnmo;u4alxoxf3iadlmteanvs;t0teumxmpio1omen ivs s) rtrxmp;o1alx if3iydlaDrmu p;u0 lxnxr oydopt lu ilt0 etm(m3io4ol emieta(fsrtau  ou4ape ifcilsls2elnvsnt0trxnif iytlmD lu s;t0 rur(r oudame  iet sf 2urxr no1tlx  ociadls2rmumonu0 etrmo iotfmDr ues s0s2xoio ou4lp  lics sfs2raxmp;t4tpxnifeild aDrl(ms ()tlxrxfcoydopDr ies (0 rum(rpio1lle mnctl() 2ur( ooo4opeomiciytfmDrl(vs;u0trtrxrcoodlmt liesl(0s2tmimpoy1ol   nesat  Dum(mpou0tlenmoctldlm umu ont) ltoxociodlmte n olt0 2uoxr iudllen nviltf Duaxmo;t1tlt ioeias sDelnvs;(0teeoif ia1fatelu o;s0 rumxrpiudll nmfviasfsrtau ono0apeoioetld m rmn p u0artnif iadoatean o;s  eumxr oo1ap elnetat  2uaurp;t4oet ioctatfaDrmu s (0tlenmf iotom eai o t)trxoio iy1lmte nes t sDtmurooo0oet ioetld s2rau ont4arxniocio1omDe uesl(0setoimpoo4olenmivt sfs2trxm nu4tpeo ietlsls rmuvp;u0 lerxf3ty1op  au s;s) exo(m oydomee ivslt)a2ua(ro;u0altnio3iltlm2elnms;(0aetrifcoo1fmteau s;s0setmir no4ameelivsat  ruax oot1oltomi3iyd s2um( p (0 rtoxfcoy1lat  n il( tetrio oy4altemies t s2raurpnt0alxomieiyslsDuln o u) ltrmo tatlpteanvils setm(rpiu4altemnes tfarurxr ;o0apxnmoeiysfsDumn p;t) rxnmf tatfaDranes (0srurim iydaleelncslt sDum( pou4oleoif3ias sDeanmo t0 lxrmrciytfa  ai o;t0texrio ou4amt  feilt s2rrxr ;t0opeomi3iaslaDran p t0tlxoio3oy1fmDrlueo;t) euoio iudll emncs s)a2ra(ront4apx ioctltla uln s () eeoiocto1fpt lnei (  etoir3oo1omen fetlt  2urxro;t4alxniieilsfmDrl(mo;t)trtoxrctatfat  u ol(0teuo(o nydlle mfes ()a2tmumont0oltn fctadla2ranvon(4alerio3to1omDranvo;(0 rxm(r3nu4om n ictl( sDrmuronu0oee  o3iadla ul(vs u4 eenio3to1latrlneols0truo(r io1lp emfvtat  rtru onu0opxoioeiydla rauvp;(4aeeoir iytfmD li i;t) etoxr no4ll  livtat) Dur( onu0tpen iciydfs raums;() ltrmr tytopte i i t)t2toio ou1aptn fei t)srrr(rpnt4oex iieiltfaDra(ms (4 ltoir oa1lm  lneil(0tetr(m3nudom e nvils s2trx  ;o4olenifeiysla2rln o;t0artomocty1oat lu ol( trxr(o iy1ll  mncsltf Dur(rpnt0aptniociytfsDumu s;t4alenxrcto1fm  ln o;t0trxoim oudalee nesa()sDumur nt1tetnmfciatlm umu p t0altnirciodomtelnvolt  2xmxopny4ol n fci t aDurump;o0aexomi3iadlsDemuvsnt4artnif3ootlatran ils s2tmxrpou1am nlncils artmu ont4opeoio3ilsls el(vs (0teermf totom rlues s)teuo(r nudlmeemiciltfs2rrumpou1open feiydfsDemn p;t0tlxnxr to1lm e n sls) 2xoxr nydopt  nct ()srrr(mpnt4oltnmieiltlaDem(ms (0aeermf3iy1fmtraieilt)srtrimpiy4apee fvslsf Duru onu1aptoiieiltlmDum(vo (4 exoxrcty1fm ran i;( sexo(m oo1openlicsl(fs2raurpou0opt  oeiadfmDeaums;u0 reomo oydlat  uesl(0trxo(o3iodap n icslt artm(mo;t0apx mf3tadls rmuvs () lxomf3todom  ln olt)t2ur(rpoudlpeemfctltf rtrumo;t1oeeomo3iatfaDul(monu4alxrxo3oydfp e nvol() exoio3ou4omt lnct ()s2um(r ot4ole ii3iyd s umnvo;u4alxnioctatlmtelivilt) rtmim3oy1op  mnci sfaDrru oou1ale iociysfa2eaumpnu) etomfcio1fpteli i;(0seuoxr iodamenmnctl(fa2rruro;t4texn o3tltfm el(mo u4aetoio tydoat luvi t  rtrxr oy1lpeemnctas)sDurx o;o0apxoioeiadfa rmnvs ()trxnir tytfmD lueslt0 exm(r3ou1ap emictas a2umurpou4tptnmfciys m el(msnt4teenmf iydlpt  ivs t) rtoim no1lp n ivta( aDumx  ;t0oexomfetydfm ua(mo;t0 ltnir3oadomD lieolt0sexo(mpoudap   fvsas)s2um(m ;o0teeniiciadfaDuau s t0 lxnir3oodfa  au i;s) 2xmimpoy1op   fei s sDra( o;u1olenmo3iadfm raums;() lxrifciadlpDeli o;(0s2umxo3io1ll elfetas sDtru pnt1tlxoii3iadlm rmumpn(4 rtnxo3io1oa  li o s srtrxm3iy1al  lncil( arrmumpou1texoioctldfa2rlums;t0alxnifctodomD  neolt) exoxo3oo4al   nvtas  2ur(rpnu4alt  ictls s2umnvp;(4 ltnxf3oa1omtelnvil() rtmxm3ny1al  lfvtas) 2umxmo;t0oleoioctyt s2rlnvo t0texnir3iotlatrlneo t  2um(o iy1lpe mict t)artax onu4tltnmociydfa2uauvs t) exrmo oodfm elnvs;s srxmxmpno4oltelivsa( s2trxm ;o0olt iicildfm emnmo;()trenmf3ia1lpDrluvils)srxo(mpiydlmeemneta() Dtmx  ot1oexn feiyt aDrl(msnu)aleoircty1opD anes;t0srxmxm3ny4opt  nvsl( aDrr(rpou0aeeomoetldfsDemn o;t0aetoxr oadlmDrlu o;t  rurio3oo1llenmfeta(fsrtaxr ;u4aet mo3tas m uaumo;t0 lenmr3ia1fmDranvo;(  etmim iu1om  lnvi s srtr(ronu1oetomf3iyd sDrmuvs;u)teerio oatlate ivsl(  exo(o oy4lm  lnci ()s2trxmo;u1tltn i3tas aDrmu p;(0aleoioctytfatrli i;()texoiopiudaltnlnvs s) rtr(rpou1tptnmfciydfs ea(von(0 eermr3tatfm   n sl() rur(mpou1al emivi tfa2ua(  oo4teto oeiytla ra(vsnu0alxrmfciy1fmDranvsl( seumirpoy1om elfeslt  2ta(r ou0ape ioeiyslsDumuvp;t4 reomocoadlmDr i i s  2xrxo3iy4opt mfci (faDumuroou4altnifetyt m uauvsnu)teerxr iy1fmDr ivsl( s2urxm iy4lpenmictas arrmuro;t1altn ocils mDeluvs;u0aeenif3ootfaDraivolt0sexrir iydap elfcsatfsDua(rooo0aet  oetytfaDrmumo u0tlermo3iotlm   ivi;t)tetoir3nodlmt lics t s2rax  ;t4texnmo3iyt s rm(vp;u) lenmo ta1fm raivi;s srumxr3ny4om  mnciasfsDrrxmooo4tlxn i3tydls el(mp;(0 rxnmf3iadlaDrluvs t texoxr oydlm nmietlt  Dumxm ;t4aetnioetysls rm(mo t0arxomocio1omD  uvo;s0t2uo(o oy1lmtnlneta( sDta(mpou0opxn ictlt s2elnvonu4 lxrxocoo1fa   uvs s0setrirpnu1lp nmncias sDum(rooo0aeenif3tld mDuau o;u)teerir3oa1fmtean o;()t2tr(m ny1ome mivia()srtrxm ;o4apxoiiciys s2rl( p;u)teeomr iadfm raieols s2toxm oodomen fcsa( srrru oou4oee mieildlsDem( o;(4tlxnxf iy1fmD li sls0trxmxo3oy4ole lnvt () 2ur(mpou1oexo ietat m2ean o;u)tltrmrctatfp r i o;(0teumxm iy4olt mnei t)arrauro;t0tlxnmi3iytfaDrmn pn(4 rxnxr3oa1fp e i sl(0t2xm(o3nu1omenlieilt  Dumx oot4tet ioctlsfa emumonu4 reoxr3oo1faDe ivilt srxoio3ou1lp nlnvt t)s2rrur no1tle  ieiatfmDua( ont0tlerxf oy1fm  auvi;t trum(m oy4apenlnes tf Dtaxm nt4tleoioeiatfmDrln s t0alxrmo3iotoptrluvi;t0 etm(o3nu4lpee ncta() 2rruro;o4alenmoetad m2rauvs;(4texnmr3ta1omDr n s;s)trxrim no1lm n fvsa( srur(mpou1olenmiciytfm2ra(vo;u0trtnir oydlptran s;s0s2uo(mpio1aleelieslt sDrax  ;u1oetn o3tld a em(vsnt) rermfcio1oateauei;( srxrirpiudalt mneiasfaDrauront4ale  fciat m2rmu p u)alermrciotopDr u i;s)texm(opoodomtemfcsls srtrx ooo4aeenmfetat s rl(vs (4aleoio3ty1oaD aies;() 2tm(r nu4ap elnet ()a2tau pou1ole iiciytls2rl(monu4 rtrxr to1fmDrlnesls trxmxr iu1lme mfcia()s2tm(mp;u4teeoioeiatlsDel( p t4aleoxfcoydopDe ivols  2umio3ou4omt  icsl( s2umumpou1apenmo3ildlsDuluvs u0trtoxf iadlp rlueilt)s2xr(o ny4om   fcs ()sDrm(  nu0oexnioetatfm2em( o;()arxoio oydlmD  i i (  2uoim oy1lpeemivs tfsDrr(rp;t0tlxn f3iysls2um(vo u)aexnxr3oydoa e ueol(0t2trio3iodoptnlnesasfa2rm(moou1oetniiciltlm elnvs u0 etnxr3totom  ai ol(0srxo(o3oo4open fei tfsDtm(mont4texnio3iat m2ea( p;u)altoio iatfa e i s;()texmxm ou4ll e feils aDuau oot4olx if3ildlaDul(msnt4aeenioctytfat lnvsl()sexmxrpou4lpe  nes t s2rm(moou4tlx iieiytfa2uau o;u) ltnxr3tadlp   ivo;s srto(r iu1al e nvtlt) rur(m ;o0aeenmo3tytfmDrmn o;t)tltrioctydlatr nvslt0trxm(m3nu1lpeelnvtas)s2umuront4teenmoetltlaDrauvo;u4texnmr3tatfm eaivo t texr(r ou4llenlicslsf rtm(rp;u0tpxnmfeiydfm umumo;u0 rxoif3ia1om e u ilt0truoir3iodame mfcsasfaDumxront4olxo ieiad sDrl(mon(4 rtoxr3tytop  ai olt) rtoim3ny1ope  ivias)artru oou0tltnmf3tadlm2ra(msnt0trxnxr oa1optraieo ()trtm(r3oydoptnlnes () rtmx  ;t4tlxniiciasls2ul( p;u4 lenmrctodom eluei;t srtm(m3iodlmtemnct ( aDrmuro;o0apeoifeilt sDeanvont0tltrxo3oytlate ies;t)teto(m3nydlleelnei t aDuaumpot1aetomi3ils s rmumo;(0 eerif3tadfmtrlueil(0trxrxr3iy4lmtnlncia(  rrrx  no4aptnmoeilsfmDean o t)arxrio3oa1fptelu o;() 2toir io1lptn fesls)s2umx  nu0teen o3iyslaDuanmo;t)arxnircto1om rlneolt seuoxo iodll nmnetl() rtax  ou4teeoif3ias sDra( s (0 rxrxo oy1om e nesls0sexrxr3oo1omen ivsat) Drax o;u4oltoifeilt mDeln onu)aetrio ootfmtelnes;( s2urir3iudap nmivsasf 2tr(  ;o0optn i3iatfs rln s t4tetnif iy1omtranes t tetoimpnu4lltn neta(f rrax oou1open fctys s2uln p u0 etrifciadlm   uvslt)tetmxm nu1llte ivsl()aDurx oot0openmoeiydfmDuln p;u4altoir3oo1fpt  u s s)srtrirpou4ole  fvsa(f 2umu  nt4aexoifcils sDrl( ont4 etrxo oa1omtr n i (0srtoxr3oy4oltn fct sfsDtmu  ou0alt iociadlm2rluvsnt4aetrmrcio1lmt ln o (0srurxo3iodamte nci t aDumuronu1apxomfeiltlaDuanvonu0 etrxfciy1oateauvo s s2xm(o iudlmtnlieiat  Dta(  nt4aeeomictyt aDrluvs u)alxrir oodopteai s;(0 2xo(o iodlmtemivt ()aDuaur ou1oexomfetatfmDrm( sn(0artnio todlp rauvsl() eurxopoo4llte fvtl() ruaxmpnu4alx ioeilsls2um( s;u4aexoifcoo1oatranvi t0trtrxm3ou1op e fctasfa2tmx pot0opxoioeilslsDumnmp;u)tetrmf tadfaDran o;s  exoxo nydllt mnvta(  rrru  ;o0ole ifciyslaDul( on(4alxrmfciydoa e ivs (  exoxm3ou4amenlnesasfsDtmxm no4openii3iytlsDemn on(4teeomf iy1lmDraneo s)s2tm(r iydap n nvsl(f rrm( ooo1apeomieils sDranvs;u) etomf3iydlptrlivolt  2xmxr nodopenlfciat)s2ra(r ou0opeoifctyd a2rmuvs u0aeeoxr iytfpteaueol(0t2xrxmpno1ll elfcils) 2tr(root0apeniociltfs ea(mp;(4alerir3oadlpteaueolt) 2xmxrpiu4oltelnviat)srtaurooo0tpt mieiltfmDrmu on(4alxomr iydom r ivo s)srtrxm3iy1olee feilt srua( p;o0aeen ociltls2um(mo;u4artomf totomteluvol( trtrxrpno1lme mictas  rraxrp;o1oexn o3ias sDel(vo (4 lerir ta1fatrauvsl( srtoir3ou4lmtnmfvt (f 2tr(m no0aex mietad a umumonu0alermo3oa1om e i ol()teur(mpio1oleemnetas sDuaxrpno1opxomo3ildlmDuauvo () rtnir tadfmteaivi;s) etoxrpoy1olt  neiltf Draxrooo1aet  f3iat sDrlnvs;()trxrio3iy1lm elnvolt trur(r3ou4amtelieta()sDrrurpnt1apen fciysfmDum(vp;t)teenxr iadlpD ln o (0trxmxmpoydol nmneiatfsrur(rono4tet  oeiyd a2rmu o;t)trxnir3iytla  lnesl(0trxmxr3nodalt mfctas  Dtrumpno4tpeomieils a umuvs u)texrirctodfmteluvi;t) rxrimpoodomt lnetat)a2urx o;t4tltomietltfm emn o;t)artrio oo1fmt  i s s0 rxrio3iydapt lfctatfarta( p;t1ale mo3iadlmDum(mp u) exrio3iadlatr n s;(0t2tmir iy1lpe mfes () Dua(mo;t0alxo fctad mDrm(msn(4aexoxocoodlp rlies () exr(opiudlle  iesls  2rmum no0tleomfeiytla2eauvsnt0trxomr3oodomD  ivi (0 2trir ny1om emivtltfsDtm(r ;t4aeenmf3iysfsDuan pnu0 rxoio3ootfmDe nvo;s0 rtmxopiu4oltn neil()sDuaumo;u4tex  fctlslsDua( on(4altomf tadlm eaneo s)sexmxrpoodlm   nciat)s2ua(rpno1open f3iltfmDea(vpnt4alenxr ia1oatr nes t) rumir ou4altnlfvsl() rtrxro;t1aetn oeiyslsDemu pnu0 reomrctydfmD an s t0texoxm3iydalt mnetas)srtm(m oo0tpen ictlsla emu s;t4aetoio iatomDrlu s;s) rumiopny1amte nes sfaDrm(m nt0aee  f3tydla2um( p u0aexoircoy1lmD luvo;t) exmxm3iy4lptemivt s)aDrrx  ou4aee  iciydfa2emu o;t4teenif iatla r n s;s seuoxopnudol  mnes (f Dra(monu0tee mieias sDuauvon(0trenmf3iotom r ivi;t0t2to(rpnu4opt mieil( a2uax  ou1tee  o3iadfaDrmnvs;u) etriocootfmDrauvils0teurio3ou4ol  lfciatf rrmuront0aee  i3tys a rln p (4 lxnmo tytlatelies t) rxmxmpou4alte fviatf 2raxmpno1teeo ocilslaDum(monu4aetrxo3oo1oaD  n o;t0 2uo(mpoudlp emfviltf rrmx  nu4oet  i3iadlm2rlnvo;u) leoif tatlpt ai ols  2urim nu1amenmnvsl(fs2tmx onu0tpx mieiys a2em(vsnu0tlxomocoytom e iei s0trum(o3oodoltn fcs t)s2rr(ronu1tee moeiytlm rm( pnu0trtnif iotoatr ieo;t0 2tr(m3nodoptelfes (  rtm(rpot0oexomiciad sDrln o u)tltoxfcto1fmDrlnvo ( s2ur(m3oudlp emncsat srtmxrooo4tltoioetlt sDumnmont0arxrmr oatoateln o;() etrir3ny1lm   fvtlt)sDuaxmpou1opx miciydfm el(mp;(0tlxnxr3oo1oa rli i t)trtmxr oy4op n ivsas arumx o;t0open oeiad a2umnmsnu0 etnmociadfate nei;s)texmxo oodap e fesasfsrrm(r ;t0oetn ieiaslm umuvs () lenifctadla  li o;s0sexo(r3iu4lmen fei t) 2urx ont4aptomi3ildlm2ulumpn(4areoxocoa1laDrlu i;t0trurim3nodape mivi s sDtm( pnu1tpt  oeils sDrl( o;() lxnxf tytfptelieilt)t2xr(o3ou4opt mncsas aDtm(  ;o1alxoiicildfmDul(von()altnio3todoa rlivs ()t2umxrpnudll nmfeta(f 2tmum oo1olto i3tysla uaums u)trerxfcoodfm elieil(0t2tmxr3ou1amenlfcsatfsDur( poo1texnii3iysfs umumo t)alxnir3todomtranesl(0texmir3oodlmtnmfetl( arrax pot4tpxomietas mDrm( p u)areoxf tydla rauvs (0trur(m oy1lp  lfvi ( a2uaxm nt0olenifciyd s2ra( s;t0 rerif tydom rauvil(  2xo(mpoy4al nlnci s)arraumo;u4tpe io3tydfaDeau s;u4aetnifctotoa eaies;( t2ur(opoy1oleelneiltf 2rmxmpoo0tee io3iyt m2rmn o;(4trerif3iy1oaDeauei t t2xm(m iu1ape  ivsatfs2trur ot4tpeomieilsfs umnvo u0altomfcty1la elneilt) 2tmio3iu1altnlivs s  Drmuront0opxnifeiasfs2ulnmont4artrmr3tatfpt  n i;( sexoxr3no1lm emneiltfsrtauroot0tpen feildls2ul(mp;t4 ltnmr3ty1lmt  u o;s0srum(m3oydaptelics ( s2tmum ;o0alxoiociadfmDean on()alerif3totla  auvs s) rtrxr iu4al elnes t aDumxmoot4tlxnmictysfs2uln sn(4 leoio3iotomD aiei;() 2trim io1om elnvt t)s2taxmp;u1optoifcildfmDea(mo;(0 exrxr3oa1lm eaues;t0 eto(rpny4ole livs tf 2um( ont4oleomoctydfs2ulu s (4teeoir3ta1lmDe i o;t  etm(o3iodap elicsltfsDraump;o0olxnmfciatfs2ul( o;t0aeenxr3tadlmDe ivi ()srum(mpoo4apte nvi tfa2tr(  ot1teeo octydfaDrlu ont0 ltnioctotopDeai s;t)seum(r3io4amtnmivi ( srtm(mp;t0apeomi3ildfa ulu pnu4alxoxo3iydfmt lnvo t0 euoxo nu1oltelnes t  Dtmur ou0apen ieiydls rmuvpn(0altrxfcoadopDeai o;s  rum(mpiydom elfct sfa2ua(rpoo0oexniieiat sDrmums;u4trxrmfcootfpDr n s s t2xrxo oudalee fetls aDtaur ou1altnmi3iltfm2emu pnu)aexnxrcio1opDran i;s0srurim3io4lp e fvt tf 2umxmo;t1aetoioeiyslsDua( s (4aleoir ia1late uvo s) 2tm(r nu1op n ivs ()a2ua(moou0olt moeild m2uluvpnu)tleoxfcoy1fpDelnvi;t setm(rpiu4lpenlfvi sfs2um( p;u1oex mf3ilt m2emu p;u)tlxrio3totfm eaies;(  rtr(m3iy1omt  fvta()a2rmxmp;u1opxo ictydlaDeln o;t0aeerxf3iytomt lu i;s0trtmirpiy4lpeemfeslsf Dumxmp;t1altn ociltfs umn p () eeoxf iytfm ean i;s)trtrio nodalenlnvs t aDtaum oo1ole ifctlsfmDemuvon()tlxomf oa1oa e u s;s0s2xmir ou1amen nvi t  rtmx pnu1oet ifeiyd a ean s;(4aexomfcty1fmt  uvi (  rtrirpnudamenlieil( s2tmxr nu1altnmfciadls2umnvo;u0 renmrciatlaD lneolt0trtm(mpiodlme mnctltfsDrax oou0ole io3ils m2rau s;u0trxoxfciodlpD  uei;t0srxrio nydomenmfvsls) rrrxrp;u4tlxn o3iytla rmu snt4aeeoiocootopte n s;s teum(m3ou4ap   nci t) rua(mont4tee  f3ilt s rlump ()trtnio oydfpD lnvi;t) 2xmir3io1ap emfciat)arurumpot1ape  fetat s2ulump t4altnmr ta1lmD an s s) rxr(mpiydoptelfcsatfs2umxrooo4olxoio3ias aDranmo;(0 ltnirctodoaDelnvi;( t2tm(mpoy4op   nvs s sDrr(  ou4oetnii3iyslmDemuvsnu0 eerifcty1laD aivs;t)truoirpiydlleemfcs ( srtru pno4aeeomfcilt a umn sn()texnmr oadoat aueils trxo(o oy1alt lncs (farrr(m ;t1tleoif3iytfs2umuvp;(0alxrircoo1omD  iei ()srtmxopoy4ll n feilt srua(mp;t4oet  ietasls rl( p (4 etrxf iy1omD  nvo;t)s2xoxopoudamenlivtasf 2rrxm ou4olx ii3iyd m rm( s t)alxrxr3tatlaD aies ( trurxr3io1lp   ivtlt)a2ua(ro;o0apto ictyd m ea(mp;()aexoio3oadlpteau s;(0s2uoxmpno4op e nvi ( a2ur(  ot4apxnii3iat mDra(vp t0tlerxo3oytfmD auei;t  rtrxr nu1lp  lfei (f rrrumo;t0aexo o3iytfaDean p t)tlenmfctadlp  aivi t0seumimpoy4ll elnesltfsrrru  nt1ape iicils aDul(mp t) ltoifciy1fp eai sls0sexmiopio1apt  ici t aruru  no4opxo fetydfs ul( s u0aetoxf iadoat  u olt)s2xoim3iu1lpt mnesas)srtaxm ;t0opto fetlsla2ran s;u0aexrxr3iotopDr ivil(  exmxo3oodole lici (fa2rr(m nt4altnmoeiasla2el(ms;(0aexnxo iadoaDeai ols)srum(mpno4lmt lfct ()a2tmx oot1tpxo feiatfa eauvo u4 rxrmo totfm e ivo ( setriopnudalen nvtl() Dtmxmooo4alen oetat s2rl(vo;t0aetomo3ta1omD  u olt sexrxrpnydlmenlietasfa2tm(  ;u4texo f3iltlsDranvo u) renxociytlptrluvsl(0 etm(m oy1lpte nvi t) 2raxront0tpxniieiasfs uanvont4 exoir iodfat luvs;(0t2xm(m3iy4lptnlnetas)s2uaurpot0aex miciat s rlumpnu0 reomf iytfa e ueol( seumxo3no1ape mfetls)arrmum ;t1tet iieilsfa2el(vont)alxnmr3tatlpD  neols0trtrio ou1lmenmivs s) rta(rpnt4teen ieildfm rlu onu4trerir3ta1opDr nesl()sexoxo iy1lpte icsls  2tmum ot0ole mi3iltlm2rau on(4aeermf3todfat li s;t srxm(m oudam emfctatf ruau o;o1aptoioetldfa elnvp (0artnxr3oydlp elneo;()s2xmxm3iydamenlieslsf Drrur nt0oleo i3tysfa rmnvs t)tltrmfctotlaD lu ols sexmir3oo1ape lnvsatf rur(ronu1texomfetad m ulump;u)tltnmo oatfpDelnvilt) rxm(r iodlpeelfesl(faDta(  no4apenmf3tas a rm(vonu)teeoifciodomDrai slt setoio oy4llee netlsf 2rmur nt0oexnif3ils aDemnvsnu0 lxnirciytfa rauvs;s0teurirpoo1ole  neiltfs2ra(mo;u1apxomoeiasfm2uau pn()trxoif iytomDraivs;s0texmio oydol nmneia( a2umxmont0aptnifciydfsDumnms t4tlenxf3iydla eanvi;( s2ur(mpiu1om e nesa(fsDrmumpot1tpxoiociltfmDel(vp t4 ltoir3io1op rli il(  exrxm3nodoleemnvtas  rrrxrp;o1teen o3iadlm eaumsnu4 leomrcoodoat aies;()s2xmir iy4apee fct ()s2rm(r no4oeen iciatlmDumuvonu0tlxnif3ootomte ivs s0t2uoxm nu4altelnvils)sDurumoou1teenmf3tas s2rluvont)texrif oa1fa   ivs (  eurimpnydlp nlfei () rrmu pnt0tltnif3tyt s2ua( o (0 ltrmf iytop e n i;s srxrxopno4am emneta(fsrururp;o1oexoii3iadfsDuauvp;t4teenio3iy1lmtrluvi s)teurirpiydalenmnesl()s2rr( p;t4tptn ietlt m2ea(mp;u4 rtoiociytla r uvs s0s2xrxr3iu4olenmfes () Drm( oot1tpenmfeiyd a2uau snt4aexoxr3oo1fpteauvolt  rxo(m ou1al eliviat sDtmxm ou4aet mfeild mDeanms;u4 lxrmfciydlp rlues s srxoim3oo1ol e ivt ( aDuau  ;t4opx miciadfm2umuvpnt4tetoircootopteai ol(0s2xm(r3ou4omtnmncia( srrrxrpno1tee mo3tasla2ra( pnu)arxrmr ty1fmtr ies s  ruoir3iodlp elfct s)s2ra(mpnt0apx micildfmDrmn p;u4 rtnircta1fpD  uvi t t2uoxrpiu4llenmiviasfs2ta(mo;o1oex ioetld sDum( ont4 reniocoadoaDr i o;s  eum(mpoudapt mfet s)a2rm(rpou1aptnmo3iyd m2uanmpnu0alxrmo oy1omtrli o t)setrio ny1lptemnctat arrmur ou4olt  o3iysfa2rl( o;(0 eenifcoy1om  lues s0setmxopiydam  lfvi s)a2trx o;t0alxnmf3ilsfm emuvont)altnxf oy1fm r ivils s2trxm3iodlp e fciat arumuro;u4aetnmfeiasfs2rl(vo;u)aetnir iatlpDrauvo;(0 etrimpio1oltelivsa(  rumxr ou1oeto i3iadlm ua(vont0artoxr todlp r nei t)s2toirpny4ape lneilt  Dtr(mont4tltoifeildls2umnvo;()trxnmo tytlp r uesl()srumio iodopt  fct s) 2um(  nt1tpto ociatlaDea( p;t0tltnmo3ty1fmDe nvil() 2tmiopoodap  lneias)a2uaur ;t4texnmi3ils a eauvs t0 etomo iotoat aneol()t2trxm nudlptemncs (fsDtr(r oo0oltomieiatlm2umuvs u0 exnmo io1fp  li i t srurim3iu4op  lnet sf 2ua(ro;t1oex mociadfs ra(vp;t4 eerircta1fptr i i;()s2um(m3oodolte ncilt arrru p;o1apxomf3iasfa rlnms;(4trtrmo3oytfa r neslt tetr(mpiodalenlfeia( arum(mpot1tetnio3iadla2uauvp;t0aleoif3oo1lpt ai olt)s2xmxo3ou4om  mics (f rumurpnt1teto fciyd s2rl(mp () rtomr todfpDrlieol( s2trxr nydom e ncilt) Dtr( ooo4altomoeiytfmDeaumo (4 exoircoatfptelnvil()seur(r no4ale  ivi sfs2rax  oo0aleo fciadlmDuln sn(4 reoir3oytfm  luvolt0tetrimpnudapenlfcsasfarur( p;u1aleomociat s2um(msnt4trtnmrciodfm e n sls0tetrimpny4lptn ieil(f Dtrxrpno1aeenii3tls a2umu p u)tlenir iy1om r ueils texoio iodlmt mnvsl()arurumoot4alen oetatfsDuan o;u4texomfctadfa e u s s) eumim nodole lnci s) Dta(rpot1tetomfctlt aDua( snt)aeerxo ia1lm r n i (0setoxo io4alt mfciltfsrrru ooo0oetomictad mDrl( o u4alerxo3iytfmDr u o;() rurir3nodole mnviltfa2umuront4tetomocild s ra(vsnu)arxrxf iytoa ran s ( srxmim3oodap  mncsat sDrmxrpno1aexnmieild s2ul(vp t0aleoir3oatfmD ai o s0sexo(opou1lltn nvtlt)sDraxrooo0ope  icildlm2umump (0tetnio tadlmtr ivs;s)tetr(r3iydllen fvsl( a2tm(m ot4tpxoii3tas s ra(vo;t)tetomoctadopDr uvi;()truo(rpoodap n fcs t)arta(mo;u4oetomieiyd s eaums u4tltoxrcio1la elnesls t2umir3oy4ol  mnctltfa2rrur nt4teeoif3iasfa ran p;t4tlxnmf3iodlmtelueo;()seum(opoy1lmtemietlsf Dtrur ;u0tpto ieildla ranvs;t0artnmfcoodopDraivs s) etoxo no4amte net t aDrr( o;u4olt ifeilsla uaump;t0tleoxr3tydom ranvo t) 2xo(mpnu1apen nci t sDra( pou1alxo ictldls raums;t4aeeoxfcta1fpD  uvsl( t2urirpio1ap e fetl(fs2trxr oo0ape ioetytfa2rmnvpnu4trtomociytfp e u sls)texrxopoodam nlfct t)s2ur( onu4teeomfciltls2umuvo u0 lenmrctadop raies;t0truo(o3ny1om  mfvsl() Drmxrpoo0opx mi3iysfs uln p;u4aeerxr3oytfp e ivs s) rxmxmpoo4apenmfcia(fsrtru poo4texnio3iad mDea( s (0teenmf oodopDeaneo s) rxoxr oo4omtelivsasfarumxrp;t1tlx mociasfaDeluvo;u4tetnmo oy1fat  u o t0s2xr(m3nudomeelivsas a2rrxmp;u4alen f3iadfmDea(ms;u0tetrir to1lm  ai i;()s2uo(opiy1op nmieias)srtmur ;u1tltnmo3ilt mDrmums;t4arerifcty1fmtelnvo s  rurim nodom  lfesa(faDrax p;t1alt  icildfm2rlnmp ()trenmfcoadfa e uvi;t)texoxr3ny1op emiesasfaDuaxro;u0opeomieilt a2ua(vp;t0 lxrxr3oadlpDelieils sexm(m io4lmeelictlt)sDumxrpot4oleoif3tldfa2uanms u0tetomf3tytlm e u sls t2xm(r iy1opee neia(f 2ur(rp;o1olxo ictad sDrm(mp t0 ltrio3oa1fptelnes;s)truo(o3ny4ll  lnciltfaDurur oo1oet  o3iat mDrmn s;t) exomr3io1fa rai i;s0seumir3iu4am nlfcs (fsrra(mont0oex iiciys m rmu p t)tetnxrcoo1fp r i s t t2um(m3nu4am nmneil( aDtmumpno0ale ifeilslsDemnvs;t0tltrxo ia1fmDranvi (0seuo(rpny4lm nmfeias) 2tr(rpno4optnmfciys m2umnmsn()altnircoy1omt  nvils0truoio ny4lleemfetl()a2rmx ono4optnmociysfmDelumpn(4 exrxrcoy1lpDelivol(0teumir oy4aptnmiesl(  2taxr ;t0opxoioetatla2rmnvp u0tleomfctadlat aiei;s0t2xmiopno1lptnlneta( s2um(mono0apenifciadfs ul(vo u) ltoio ia1opDr uvi t0 rxo(m3iydlleelnvsatfaruaxm ;o4tpxnmfeiytla2umnmp;(0arxrxo3iydlmtelivilt)s2um(r nudam nlfetas)aDra(ront4apt iieiat a eanmon()aleomf3ootlm e nes;s s2xrim iy1ap   netat) Dtrxm nt0oeenii3tldlm2umn p;t)texrio3tadfmt  nvi;s t2umxo no1am elnci ()sDra(  oo1teenii3ilsfm elnvp;t0 reoioctadfm ran s;(0 etmirpno1optelnet sfsDrmx onu0oex ioeild m2eanvs;u4 exnxr3oo1opDr ivi s sexmxr no1omtemiei s  2rrxmoou4oexn fetys s2emu p (4 renirciadlmtelieo t trxmxmpoo1om nlfvilt artmumont4alxnmoctas s2elnms u)tleoxfcoatlm e ivols)s2ur(m3iodllt lfeslsfa2uaxrpnu0olt iicildlm uauvp u)alxriocoadlp r iei;t0texr(rpny4lp elfciatf Dtrx  oo0alxoifctlt m umu p;(0altnxf3tadlmt  nei t0setmxr nu4op nmiesls) rumurpoo4alxo fciadfm2emuvo;(4 lerircty1op eau o t0seum(r nydlp e ncia(fs2rau  ;o0tpeo oetlsfmDeaump u4aetnmr tadop e neilt  2xoir3oo4oleelncias aDrrx o;u1aeenifciltfmDua(vp () lerif to1fpt luvols tetmxm3oudomtemict s)aDum(r ot0oexn oeiltfs elnmon()texnmrcoodop  lu i;t0t2xrxopno4am emictl()aDumum oo0aet if3iyslmDum(vs t4teenircoydop  aies s)trtrxr oodap   fctlt)sDra(rpoo1tlx mieilt s ul( o u0trxrxo3ta1fp  au sls0 rxmio3oy1lp elnctl(f rta(mpnu1tetn i3ildfa2el(vs (0 rerir oatomtrauvs;t)setrxo iy1ll e icsasf Dum( oot4aptomo3iad s2raumonu4 exoxo3totopD  nvo;t)s2uoxrpnudlmtn iviat  2tmu p;t4tptomicildfa rlu s (0alxrxo iadlp  lnvil( teuoir io4lpenmfvil(  rrr(ro;o0tee mociyd a rlnms;t4altnmr iytlmDeau o;t  exm(o oy1olt mivsa()a2rmxrooo4texomieiltlm2ua(von(0altoir3iotopteaues;t  2xoxmpnu1ll nlfesl(fa2tr(root1ape iicils a emuvpnt0texrif3oydlmte u o (0trto(m3nu1omenlfcslt s2rmump;u4apt  fcildls2ulnmo;t0alerxf3tatla  aueo;t0trxm(rpiu4om emies sf 2tmumoou0apeniociltlsDrluvont0artrirciodlptraiei;t)teurxo3no1aleelivtl()s2raum ;t4oetn oeiytfs rm( on(4 rermr iadlpDr iesls s2umxr oy4aptn fcia(fa2rmu pnu4ape  ieiytla uauvon() ltniocia1fat anvs;t sruo(rpiodalee nes t  2rru  no4opxn iciasla ea(msnu) leoir iydfa  au slt0 rum(m3nu1ole mnvtlt)arrrumo;o4aeto octadlaDeau p;u) eenmo oo1fptraieo;( setrio3nydlme mies ()a2ta(rpoo1olxomieiasfsDumump;u)trtomr oytfatrauei s  rtoxm oo4ll emiei ()arurxm ;o1oex  oeiys a ra( p u)trtoxr3oa1lpD lnes;()t2xrim oydam nmfctlsfa2taur no0tltoii3tlt aDrm(ms;u) reoxf ta1laD  u il(0 euoio3iydapee fctasfsrua(mpno0oet micils s2uaums (0 rtrmfciadla rlnvi (  exriopiy1ome  fvi (  rtmur ;u0optn octyslm2ulump;(0aexomrcty1op  liei s tetmxr3nu4al e fvsl()sDraumpoo0oeeo ieiat mDra(vo u0alxrmfctytfa elnvols0teto(r3no4lptnmnesls sDurxrpoo4oee iieiatlaDum( onu) lxoiocoydfmt lneo t0 2xm(mpnydlleelfet t)artmx ont1aetnmi3iydla uanvp t0tetrxf3iytfp e u o;s0s2xmio iudlltnlneta( arrm( ont0aptniociysls eln o;u0 etoir3oatom ranes;t0sexo(mpny4op nlicils)srrmxrp;u0olx mietasfs ulump u) ltrircoydopt auvilt)teur(o3oy1opt  fctl(farraumpnt1oex  octat a uauvpn(4 etrxfctotop  au s t sexrim no4amee iei s  2ur(mpoo0apeo f3tatlaDua(vp;t)arxoxr3oadlp  lu o t  rtmim3ny1alen fci (  Dum(ro;u1aeeoifctlsfaDemnvs t4aeenmo3oy1lmtelnvol() eto(rpoodlp   netas) Dta(rpoo0tle  icildls emu p u0artnmrctytfaDr i s s0 2xrim3io1alenmfcs t) Drr(mont0texoifetlsfa2ranvonu)alxnxocoatoatelnvs;t seurio3nudlpt lnctat)s2rrxronu4tpx iieiyd sDeln o u) rxoifctatlp eaivsl(0t2xmxm3io4lptnliviasfs2rmu  ;t4tpxn fetat s ul(mp;u4aeeoxf tydlpD  n s;s)tetmimpiydoleemfcsl(  Duaxront0aptoii3tlt sDranvp t)aetnxo oytfm   uesls) etoxo oo1amtnmnvta() Dur(rooo1aetoif3tytlm rm( pn(4aeenxr tytomt ai s;t)truoxo3nudale mnvias  rum(  ou1aeeoioctltlm2ranvo u0tlenmfciydopt  i slt0 2ur(o nudaltnmfct ()sruaxroou4olt  o3iaslm2ran s ()trerxo ia1la eaivi ()trtmio oo4ll elfct t)s2uau oot0apeo ociasfsDel(mpnt4aexnxf3to1la e uvols0 exrim3iu4ale mnvta( srtaurpot1alx  i3tatfs el( o;t4 exrmf iotla  aiei;s  rur(o3oydalt  nei t srumu ooo4alxnio3iasfsDrmnvp;(0tetnxr oo1fmtrlnvo (0 2toio3nydlmeelivtls)sDtmxronu1aetnifeiysfaDeau o;(0 rxnxo oodfp   nvols  eumir3nu1lpenmfeil(fa2tmumonu1opxomoetydfmDeaumo u0teenio3tadfa  livi t)trur(r3no1oltn nctls  2rrump;t1tpen ocils m2uau ont0areoxo oodfm eli o;t0seuriopoy1lleelivil( a2uaurpou0ole iietasfs uaums;u4 eeoif3ty1lpDe nvs s setm(mpou4oleemneilsfsDtr( p;u1tptn ocilt aDua( s;(0 exnmf ia1fmDe ivo;(  exrio3oydoleemfes sfs2taump;u0aet mi3iatla ulnvp;u0altnxr3tydomDe n s t0teto(r3oo1lltn nes (  rta(  ot4altnmfeilt s2el(vo (0aetoxr3to1omt au ils0 ruoxm3iu1altnmnvias s2rm(mono4aex  i3iatfm2rlnvo ()alxrxf3iotfa rln i s t2xoxopio1lpe miet tf 2ua(r ot4teeo o3ias s rm( p u0 rxnmfcoadop rluvolt  rtoxr iu1omtnmicsls a2tmu  no1tpx  ieiys m ua( p;(4 exoifcoo1fptean o s0srum(mpno4op n ncilt  2rm(root4tleo i3tldfs2umnvsn() exrioctodlmt livols0 euoir3iy1lptemfcta()sDtru pot1teeoioeilsfaDumnmp u0artrxrcootfmtelu slt)srxrir nydll n feiatfsrrr(r nt4tpe  o3iytls rmu on()alerif ty1oat  n ol(0trxm(opio1lpeelfcias) Drmxmoou4tpe mieiys s rl( p t0trxomo oy1fa e n s s trur(m3iu1olee neiasf 2ra( ono0tlxomfctlslm2rmuvsnu0tltrxf oydla e i o () exrimpnydomenmivsl(f 2ra(mpou4oeeniocilsfs2ulnvpnt)tetnmf3ia1latr i s;( trxrim3nu1alte nvs sfs2uaxr oo1alxn feiat mDrlnmsn(0aetriociadlmte ueo t0srxm(o3io4om nmiesl()s2rr(mpou1tpeoiietltls2rlu s;t)arxrmf iy1opDeluei t) eumxopoydap  mnvilt) Duaumont0apeomoeiasfs2rluvonu4tltrio oodfmDe nvils) rxr(m no1ap  lictl( srumx o;o0altnmietasfm ra(msnt)trenmf oo1lp  lu o s  eumxopoydopt  nvs s sDtr(mo;o4tlxn f3iltlaDua(vs (4teenio3ty1fp  lieilt)s2to(o3nudalt lfctas srtrump;u4olx iociaslsDemn p;t0 ltrif oytla rli o s) rtrio3no4al nmnvtas) 2uaum no1oleoioeiat mDranmo () lxnif3tatomDrau ils sexrxr3iy4optnlnctas)a2tru oou4oleoioeilsfa em(ms;u4trtoif ia1op elu olt t2xrxm3iu4al nlfci ()s2urump;u1teen fciasfmDuauvonu4treoxocoydoa e nvolt  2um(opio4ll nlfvi t)a2raxmpoo0aleo f3tltls2eau onu) exrxr oy1lpDraneo ()texm(rpno4om emfcia(fs2taurpot4apt  fciasfsDeanvp t)tetrif3iodlaDeln sl( srtoiopoodlleelnes tfaDtr(mo;u4apeoio3ildls umn pnt0 eerir3oytfp e uei;s  exmxr oudomt mncs tfartrxrpoo4tltomoctysfsDemnmonu0aeeniociydlmD lu slt)teumio nydapt livia(farumuro;o4opxoiieildfmDrmumpnt)tlerxrcoodfm r nes (0 2tmxo3ou4opte fesas  rumxmo;t0olen ociaslmDeau pn(0tetrif tatomD aiei ( srtoxopnu1al emnctas  rtrumpou4alxomfciatfm2ea(vs;(0 rtnxf oodfptean ols0s2tr(opou4am   iei t)a2taxrp;t0olenifctyslaDuluvpnt0tlxomo iytomDran i s0 rto(r iudlmt  fcsat  2rr( ont0opto i3tyd a2eanvs;t0 ltrifcoytfaD  n s;(0teurxr3io4omt miciatf rum(  ;t1alxnii3tld s rlnvs;(4aexrmrctytomt auvs;() 2tm(o nu1altemfct (farrmur ot1optnio3iasla2umn s;t4aeenxocoodfpD an i;( seurxr nu1ol elfctas  2tmur ou1oleoii3tatfsDran pn(0 ltrmocio1oa   ueo s) rurio3nudll nlfei t s2um( o;t4tetoiocilslsDeluvsn() lerxo tadoaDe ivolt0 exrxr iu4alen fci ()srta( o;t0aet ifctyt s2ra( pnu0arermocto1fa  ai s;t)srtoxr3no1lp e nvt ()a2raxr ou0olxn i3tlsfs eanmsnu0areoir3ty1opD lu o;(0trxoxmpoo1am nlfviat)srtrurpou1altomfeilt m2ulnvp u0alxrxo3iytoatraivs;s0trum(m oodlpt livslsfs2uaumont4tpe moeild a ranvs u0trtrxf3to1fa elnesls)t2xo(r iu4oltemivt s) Dtmuro;u4oee  o3ildlm2emnmo;(4texrmocia1fa rluesls)s2umxr3nu4ll  lnesasfaDur(r nu0opxnifciysfm2uanmp;t0tlerxr oytfmD lu slt)truo(m oodlme mfeils) rrrx pno1aee mfctltlaDrmnvo u0altoxfcoodom r uei;t0t2toio io4om e fctltfa2rr(mpoo1oetnif3tldls ranmsnu4arxnmf iy1omte u s t0s2urxo3nodome  fctltf ruau ono4oeen o3iad sDumu s ()arerxr3oodoaDean o;(0seum(o3iydlm nmnvslt) rtmum ;o0texniieild s ul( o;u4trerif3tatomD  i slt) rxmir3ou1altnmics sf 2ua(r nt1tlenifeiytfs rauvpnu)tlxrmfcia1lmD livo t)trxr(o3nu4lle  fvi sf Dtrur ou1aexoii3ilslm2rau p;(4trenmfcoadlmDrlnvi;(0texmxmpnydal n nvtltfa2raump;u1opeomfciasfmDel(mp t) lenxr oytoa rauvs;s  exrio ou1alt lfesa()sDum( p;u0opt  oeiytfs2uluvs t0artrxocoytfmDe ivo s sexmim3no1amt  neia(farrmxrp;t0tle ii3iltls2raumo;t0 rtoioctotlmt lieils0 etrir3iydll elies t sDtrumonu0tltn i3iasfa2ea( pnu0 exoio3iatlp  livil( texrxr3iydoltn ivsa() Dumxroou1oeto i3iat s ra(mpnt)texnmo ta1lmte nvo s s2tmxopoy4op  mnet t arrm( oot1altomoctyd m eau o;t0 eerir3tadfmte ueols0 etoxm3no1amtemfeia( srtr(rpou0opeomo3iasfsDeln s;u0alerxf3oo1fate u o;t0 eurim3io4lm emfesa(  Dtau p;o1alt mi3ildfm el(mont4trxoxo oadfm elivo;t t2tm(m ou1lm emfct (fsDtmu  nt4ope mf3tlslm2ulumont) rermf tadoa r n ol(  ruo(r3nydal elncsa(fs2um(m oo4oeeoii3iltlm2rau s u)aexnxrctytlmDelieils0 eum(mpoo1om n net (faDur( o;t0teen octad s2rluvo () rtrxf3totfat auvo s  2umiopoy1ameelncilsf Dtmuroou4opx  o3iadfa2uan o u)aetoxo iydlp rlieslt sexm(m iodol n fetlt  2rmumpoo4aptnmoctad aDrmnmpnu)altrir tatlaDr i s;t seuo(r3oy4ll   neta()s2umumono0tlxomo3tyd m rl(vonu0 eermr3io1fat an ilt  2umxrpnu4lmt lnesls  rtmu  nu0tpx ifciltfs emuvonu0texnmr3to1lpteanvs (0srumio iy1al nlnvsa(fsrrmu pnu0texomieils s2ulnvo u0tetnmf oatfaDrlies;t0t2trxr3ou4amenlnci t  Drrx pno1olxn ociat s el(ms u4tltoxf oa1omt  ues s)trtm(rpiu4op nmfcilsf 2ua(mpot4aetnmfeiadlm eln pn(4 rermrciatfmtraueo;(0srtr(m3nydlmen ivsat)sDrau oot1tpe if3iasla rmnvo (4aleniocta1lpt an olt t2toxo oy1ome micilsfaDra( pnu4texnmfciys sDelnmo;t4treomr3to1lateluvi;()seurxm3iu1optn fcta( s2rax pnu0olt mo3ias a2uaumo t) ltnio iodomtean s ()s2uoxr oo4ol  mnet ()a2ra( ono0aexomi3iat a2el(msnu4aeeoif iytlm rliesls sexm(mpoo1apt licsl() Drrurpnu1oexnmocilsfmDeaumo (0trxomo io1fptr ivi t trur(rpiu1al nlfesl(fa2rru  ;o0tlxoifcildlmDemnvo;()altomrcoatfm eanvi s0s2xrir no1ol n ieil()s2uaxm ;u4aeeomf3ias s2rmuvpn(0alxomrcoodopDr n o s  2xoim3nodale  iet t) 2umx  nu0apenmo3tyslm uluvo;(0 lxrifcty1fp e nvi;( sexmxm3oy4lmtelnvsat a2trumono1aleoiiciyd sDuau onu0arxnmrciadlptr uvsl()srurir3oodap n fcsat s2ururonu0apx mociytla ranvp;t0arxoir iydfmDrli ils0 euoxr nydol nlfctatf rua(m ou1tex  feiad a emumo t0 reoif3todfmDrauei ( s2um(o oudlptelnesa(farurx  nu1aeeomf3tysfs2um(vp t0 lxrmo3ta1fat ln i ( t2toxo iodlme  fei tfs2umu onu4tpt moeilsfmDelnvo;u4trtrio to1lmD lu s ()sexrxm io1op nlfcs ()arumu onu4tpto ictyd sDuanmp;u4areoxr3tatlmteauvs;()tetoxopno4aleelfvsa(f Drrxrp;t1tpxnifcild aDeluvs () ltrmoctytfaDe i s;(0 rum(r3ny4lp n fcs t) Dta(rooo1alx iociadfaDuln s;t0arxoxo3oydfa e nvi;s) rum(rpnudal elfeil( srumum ot0ape mfeiasls2raums;t4alenmr3oatom r uvsl(0trxrio iy4openlfcs tfsDtaxrpno0oeeomo3tatls rln snt4trxrmf3tytlmDrluvsls) etr(opnydolee nvs t arrrx  nu1tltoioctldls elumo t4arerir ta1omDeai il()setoxo nodole  ncia() Dtm( o;t4tle ioeiydfa2ea(mo;u4 reoir3oa1laDean i;s0 rurirpnodlp nlfet t a2raxmo;t1oetomi3ilt m2ean s u)trtnxr3tytla eli i t) etr(opoo4aleelncs t) 2umurp;t0oexn icildls uauvs (4 rxrmr3todlp elieo ( trtr(m3iodlpenmfct ( sDrrx oou4oetoii3tld s2rlnmpnt0areoir3iatop  auvo;t srum(m io4lptelfct () Dtmx  nt1aptoif3tydlm2ea( s;()aeermf3oadoat lueo s0srtm(r io4openmiet s aDrru o;t1tex mietyt mDra(vo () rxrxr3tatlp rliei ()tetoxo iydomeelfvi ( a2uau  ;u4optnifctaslaDuanms (4teenmr oy1fa elies ( tetmxrpnudlp nlfcta( arrm(rooo1apenifeilsla eauvs;(4tetrxfciatfpDeai i;t0teumxr ny1alt mncsa()arrm(ro;t4optn ociltfaDeanmo u)tetrmoctydom eanes;t  eur(mpno1omeelict sfarta(  oo1olxoif3iatfs rmu o;(0 rerxfcootlmteln i s0srxrxm3nu4lmt livtasf Duaxrp;u0ape mfetas a2ran p;t0 exrir3to1op   uvi (0 ruoxm iodop nlfvslt  Dtru p;u1tpeoifciydfa ulnms;(4aexrmr totom rlies () ruoio3oodomt mnetl( a2rrxm ;o1optnmfeils aDelnvon(4texnxrcto1oa r n s s)s2xo(mpnu4am e fvt t  rtmxro;t0aetnmo3tadlmDeln p u4arermf3iatlaDeanei t0 etrxm iodlpenlfesl(fsDrrurpou4olxnii3iyslmDemuvpn(0 ltrxrcoydfmDelueols)trxrxo3iu1al   ici ()aDumuronu4tltnmietadfm2em(msn()altrmr iotlmDelnvo;()srtrxmpiydamt mivsls aDrmumpno0tptn feiad s2eln o (0 exrmr3ta1omD  ueolt0 2toim3nu1am   fcsls)aDrr(r oo1aexnii3iyd a2em(mont4 etoio oadlaDe ivol()teurxmpoo1ll  mnetls)a2trxm ot1alx mfetys a eanvonu)tlermr iy1lmtrlu ils0 exmim3iy4ome  fctat) rrrxr ;u1tptn ociadla uauvs t0 etnmocoadlpDeln ols)sexm(r ou4lp n ivtlsf rtmxrpoo4tetomfciatlm2uanmp;t)aexrxr ia1omDr ues;(0seurxm3oo1ap elneils) 2rru pou0oeenif3tasla2raumo;t4 rtoif3ia1lptr ieol()trxrim iu4openmieils)sDua(mpnu4opx  f3iytlm2raump;u) rxrxociydfpte ivi;t0trxm(o3no1al  liet s aDuaxmoot0tpt  i3tasfa2rl(monu4texnmr3oydfpDe nvils)texoiopou4apen fctlt) rrm( pot4tptn ocilsls2eluvs;t)tlxnmf3ta1latraivs;() rxo(r3nodllen fes (  rtmumooo0aptn ictys a eanvp;u0aleoio3tydfat  ies s t2xr(o nu1amt  fcil(fs2urumpot4oee mieiydfa ul( pnt)tlxnmo3iy1fpDrlivo;s)srum(r3oy4lltn fesas s2urum nt1olxn o3iaslsDraums t0altnif io1oa rlnei;(0t2xm(rpoudopt lncslsfsruru p;u1tlxoii3tytls2emnvp t)arxrmfcto1lmt aivs;t)trxr(r iu4optelietlsfaDtmumpno4aetnmfetytfm2rl(ms;t4 lxrmo iadlmD  uvi;( t2tm(mpoo4am  mnctltf rrrxr ;o0tpeoioeiasls2ulnmp u0aetrxr ootfmDeli s;s0 2xrxopio1lm e nvsat) 2uauroot1oleomo3tlsfmDuluvp (4trtrir3oytlat li sls  rtoxo iydomtelivsas srraxmonu4tlen octasfa ua(msnt4trxrxr3oatopt aneo t) rtoiopiydamt miet s  rum( p;o0oeenmfetlslm eau p;() etoxf tatfmtranes;()srxr(opio4olte iet ()aDrm(rp;u4alt iieiyd s um( ont4 leoio3iatoa rau o;s srxoim3ny4lpe  ncslt a2uaxronu1tlxomietat a ua(monu)tltoiocoy1faDr nei;( tetmxm3ou4am elfcsltf rrmumonu4alt  ocias m2ulump ()trxnmoctadla elnesls s2tm(r3oydlpe  nvsas)srum(r ot0apeo ociltlaDeluvsnt)arxoxf tydlptrai s t)trumxrpiodoltelfvsls)sDuau pnu0apt mi3tydfs uanmon(4aetnif iy1lmt auvo s  rto(opnu1amt  ies sf 2ur(rono1tltnmi3ilt a2ulump t) exnio3oodom eanvslt)t2umiopiydale mivtasfaDuaurpot1ape  ieils aDrauvs;u0teeoifcoy1fptr i il()s2xm(o ny1llt mfvi (  rtrxm nt1olxo ociytfaDumn snu0aexrxr tydfpD lnvs ( texrio nudoltnlnet tfaDta(  ;u1oee moetysfm2emuvon(4teermr3tatlmDr nei;(0srur(m nu4lmtemfctltfsrrrurooo0alxnmociyd a2uauvpn() rermfcoo1fpD  u sls0teumxm oy4optelfvslt  2ta(m nu0tex  i3tldfm el(msnu)aeenxf totfaDrluvslt0setoim iodapenmictl(f Dtaxm ou4oexnmo3tatla uau p (4 rxoir3totom  ln i;t0trurio nu4amte fetls) Dtmx o;o0oeenmociytfm2um(vs;u0alerif ta1fm e nvsl() rxo(opoudoptelfct (f rur(rpnu4aetnif3ilsfs um(msnu4alxrir3oytom raneo t0 rxr(m3oodlmt  iei t  Dtm(rp;o4oee mfciydfm2elu o u)arxrxrciotfa e iei;s) 2umio3nu4lpe  ivi s)a2urxr nt1ape ifeiyd sDumuvo u0tlenir3oo1opDe ueslt s2xrio3nu4oleemfcsl()aDraxm ot1apen i3iasfmDra(vsnt0treomfctytlmte nvs ()trumim3iodlpt  fet s)artr(mo;o0aeeoiocildla2ra( s;(0 lxnif ootfm  ai sls0seuoio oudomenlivt tfarrr(  nu1oee if3iyd a umn p;(0 ltoxr ootfm elieo () 2tr(o ny1aptnlfetas) rtmxr nt1openiociydfs el( s (0 exrmo3iy1lpDean i s tetrxo iudap  lfes t)sDtaxmo;u0oexomfciys m umuvont4 lerxr todlmteliei;()seur(m iydomenmnetas)s2umumpoo4alen ieiatfmDelnmsn()artnxf oadfpteaieo;s)sruoxo iydaleemieta()s2ur(rp;t4ape miciatlm rm(mpnu0 lxoio3tadlmD li sl(  2umio io4lltn ieiat)artmx p;t1opx if3iytfs2emn p t0 lxrircto1fp raueolt0 2urirpiu4ome liciat)sDurxmo;u4tptnmictysfsDrl( pnu) leoxocootopDean i;s  2xr(o3nu1ome  nvt s s2ta(ro;o0oeeomi3iysfm2ulump t0aetnxrcoy1lptrlneo;() 2xmxo3iy4amte ietas sruaumoot4oeen oeildlm em(msnu)tlxoxr3oytopDrln i;t  2umio3io4opee nvsl(  2rr(rpoo0tlx  oeiysfs ulnmonu4 exnmo ta1lmtr i slt) exmio3iodapenlnvilt)s2rru  ot0tle ifctysfmDuanvsnu4trxnio3totlpt  ueol(0s2xmxopiy4lm elietlt s2
\ No newline at end of file
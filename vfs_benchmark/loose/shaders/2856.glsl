@@ -0,0 +1 @@
+ues t srtrxo3no4amtemnvs tfaDumxmont4tet  iciys mDrmums;u4tlxriocta1latranvo s0 rtrio oydlpe  neiltfa2tm(m ;u1tleoioctat aDrl(vp u4tltnmo3io1lp   neols t2xmio iy4lle  ncsltfsrurx ooo1alxomo3iasls elumpnu4 ltoxfctatfmt an i;( srxr(r3iudomtelncils)srur(r ;o1aptnifeiyslmDem(vo u0trtrxr iytlpte ieo;t)tetoim3iy1opt licsa( aDtaxmooo0tlt  f3iadls2uanmp;u) rxnir todom elies;( sexmxmpio1ame mivt tfaDtmx onu0tee  f3ias m2eanmp t)texomfcoatomteln i;t texr(o3oydol  mfvs s  rra( pnu1tle  fciys a rau on() exoir3oy1omDrln s;t  2umir nydlp   fci s)a2trxro;u1olenmociat s2rau sn()arxnxo tadlaD anei s texm(opoo4lm   neil(f rtru  ot0aptniieiadfaDumnmsnt)trenir3oytfpt  ivo;s0srxmxr io4amtelnvils aDurx  nu4teeniictys a2ea( pnu4alerxo3oytoaDe nvs;s0t2xo(m3oudapen ict t sDrrxmpno0opxnmoctldfm eln snt0trerif3totoaD aueo s  exrxo nu4llenlici tfarumum ;o1teenioctat m um(mpn(4 lxnmf iy1lmt  nvo ()s2xm(opio1ol elnvia() 2tm(rp;t4tetoif3tldla uau snt4arxrxfcoa1omt ai s (0seumim3ou1amenmicias) Dur( p;u4opeo ieiadfsDuauvo;() exomr3tatfatr ivs s) eurxm ou4al nmivil(farrmx onu0tlx  fciasla2eluvo;(0 rtrxocto1lp e neo () eto(rpoy4lpenmivilsfsDtmu  no0oexomoeils s ea(ms u4 exoirciotfa r n o;s0sexm(r iudoleelieils) 2ua(mpot0aleomi3iyt a2um( s;()teenxf oytlm elivi;s) eto(o nodopt lnvia() Dua(m nu1tetn octas aDua(vp t)tlxrir oadlaD  nes;(0srto(o3oo1lmtelics (fsDur(  oo0opeoii3ildlm2uaumpnu4aexrxrcto1fm eliesl( tetmir3ou1apeemnvia(fsDrau  ou4apx  ieildfm2ran s u4aeermfctatfm e ueolt0t2tr(r3iy4ol  miviasf rta(  ou1oeeomi3iyslmDrmuvp u0artomf oa1om   i ilt srxmimpiydomee fetlsf rra(mooo0alt ifetatfm2rluvp (4teermrciadfpte n ols trxo(o3io1lleemfetls sDraum nt1alx moctyslm umuvont)altnifcty1omt li olt0setmim3nudaltn nei ( aDtru oou4oetoioeiasls eluvs (4altrxf3oadlmtrau s;s  ruoirpiy1lltnmncsl()a2tm(moou0apxnmoeiytfa ua(mo t) eenir to1latraivilt trxmxr oo4lpen fetlsfsDtr(  no0aetnioeiltlmDumuvo;(0aeenxocoa1op   ivi;t0trtr(mpio4aptnmivsasfs2tr( oot1olxnmiciadfs2ulnvpnt0 exoircoodoptean o (  etoxrpnydlm  mnvi t)a2um( pnu4aet  octydfa eln sn(4 rxrif oa1fa e n ilt  exrir3iudalt lnvtas)s2tr(mo;t0altoioeiyd a elnmp;u0tetnmf3iydla eaivsl()sruoxo iy4om nmfcils  rrau p;u1tex iictytfsDuauvp t4aetniocta1fp rliei;() rxmxmpiy4lpenmics sfaDtr( o;u1olxoio3tld aDem(mp;u0tleoio iatlaDeaues;t)t2to(r no1olenmieta(fs2tmurono0apeomo3tad sDrlnvo;()aeermf tydom   uvs;()sexm(o ou4opt  fvta(f 2raurpoo0alto iciys mDrm( s;u4aeenmr iotfa r ivol( s2urxr3no4lm  lict t)aDtr(mpoo0alxniicilslaDuauvs t) rtnxrcta1fm e i i s0teur(mpou4am  mfesa( s2uax o;u1apeo o3iytfs ul(ms ()treoxr todlat aueilt0s2urxr3oy1al  mnvils aDumur ;t4ape ii3tadfmDeanvs t)alxrxo3oa1omt an il( sruo(mpoudomtnlnesat)s2rr( ono4tpxnmietyt sDeanvs ()aetrmociotla eaiei t  2umir3nydal  mfvtl() 2rr( pnu1aptn f3iyslsDeanvp ()arermfcoa1fmtrli s s)trxm(mpno4ale  fctl(farum(m ;o4texoiictatfm2rau p;t0tetnio oytlaDraneslt) 2umim oy1lptelfcsltfs2rmuro;o4olxn f3ild s2um(mpnu4aexoxrctodopDr ues;t srum(r nu4amtnlictlsfa2ua(rpoo4aeeo oetat m2rlnvo;u) lerxo ta1op rlueilt0seuo(r nudll emnvia(fsrum( o;o4oleomoetls a rl(mp;(4tleoxr tytfmteli o;t)sexmirpiodape livi t) 2tm(moot0tle  i3ilsla rm( s t)tltomr3iodla ran s;() exo(o iudlme  ivsatfs2trumoou0oexoifetasfs um( s t)artoircootlmD  uei;s0srxmimpnodome  ivt s)s2umum ot0tle ioetys sDel( p;() lenmocoadomDelnes;()t2umxrpoy4optnliei tf 2taxrpot0oltoif3tyt s ea( onu)tlxrir iadfaD luvils) etr(m iydll elfciatfs2um(mpou4open fctlt a2ul(mo t4texnio3tadopt lies;()tetrxo3iudal   icil()aDur(m no4apxnmf3iaslm uaums t)aexoxrcoy1fa e uvo;()trtmio3oydome mfci ()sDtax pot1opxn f3iat m2uln s u)aeenxo3ta1lm  anesls0t2to(o3oudlmtnlncilt)sDrmx pnu0oltniictydla rmnmont0aexomf to1opDrlnvslt) rtoio3iu1ol  mietat  rtaur ot1tpt iocilsfs umnvsnt4trtnxocoodla rli ils  2xoxm3io4opeemivsatfartmuroot0tlxoif3ilsfs2ul(vp;u) rxoir3ty1optr i ols0 rtrxr3ny4opeelnvs s sruaurpot0tpt iociydlm ul( s;u4aetnxo3oydlm rai s ()teum(rpiu4ol nlfviasfa2umxr ot4tle ifctatfm2umnmo;(0 ltoioctydfaDeai olt  rxoir oodal nmivi (f 2tauroou0teeomociad mDemuvpnu0arenxf ty1opDeanei;()t2tmxopoydlltemiciatfa2tr(mp;o4oet mf3iadls2eau o (0aeenmf3ty1fatrau il() rxm(o3oydlmeeliviatfs2urumoou1oetn i3tad s2ra( p;u)tlerxr3iodfatrlnvo t  eum(m3io4ole lies t)artaurp;t4aeeomocildlmDrm(vp t0aexrxf tadfateli olt)texr(o iu1ll e ict ( s2tm(ro;o1oleomi3ildfm eanmo;u4aexnif iodomD aivi ()t2trxo iu1omtn nvsa() 2rm(  ou4teenmfeiytfa uan p;(0areoir to1oaDeli il(  exrxopou1omt mivi s)artr(  ou0ope iociat m elums t0 renxr3tytfaDeln i;s0 rurim3iu1am e fesatfsDrm(r ;u1teeoiictltfsDranmonu0trenxo3tadfa e i i ( texrirpoo4lm e ietl( aDrrx pno1tltoifctys sDrln s (0treriocio1lp e nvs t srxmxrpiudlp e ivtasfarta(r ou0teeniiciad mDuan p u4teeomo3iydopDr i sls0s2xoxmpiy1altemfesas arrmurpou1tptoifcils m2umnvs;u0arxrir3tadlm rai sls)trxoxo3oydlle lnvtltfaDumurpot4tlenmocias mDrau o u4trtrxf io1fmDrlieols teumir3ny1ll   nes s  rrm(mont4tlenif3iltfmDemuvs;(4aleomr oodlpD ln o;s)texrio ou1llenlivtat)artau p;t1oltomietysfa uaump;()alxomrctodop  aneols trto(opno1ameemnetltfsDuaxmp;o1tleo f3iat s2rmn s (0 lenmr3oydlp  anvs;s0s2um(opiu1apt mfvias  Draumooo1opxomieiytfs eauvsnt0aexoio3oadfpD aieil() 2xoxm3ny4opee iesa(faDuaxr no4aet ifcildlm rmnvp (4 lenifcoadfa eaueo;s0trxrxo3io4lpeemncta( aDum( o;t0oleo icildla uaumonu0aexrxocoytla  auvs t sexo(o3ny1ap e iesls)s2ta( ooo0aex io3tld s2rau o t) exnmocio1lmDeanei;t0 eto(o3oudamen nvt s)srumu pno4aet mo3tas a2uau p;u0 exrmr3oo1lpte ivsl( tetmim ny4ope lfvs tfs2um(rp;u0tet mieiatfa2rm( pn()artnxo oy1lp  livi;s0t2xmio nu4lpeelnci (faDurxm ot1olxniieilsfm rluvon(4tlxnio ty1fat ai o ()trtm(r iydamee nctl()aDua(mpnt1tptnii3tad m uaumonu0trxrif3oytoa e iei;s)t2ur(o3iy1ome mnesa( s2ta(rp;u0olenmi3ilsfa2ulnvo;()arerio3oytoat lies s  2tmxr3oodopte ieils aDumu ono1optomfeiatls2ea(mp (4alxnif iy1omt  ivo;(0s2xrxm ou4lmte icia(fartrxrp;t0altn fctlt s2umn snt4 eerxo iytfpDranes t0 euoxm3ou1op elict s)a2umxronu1aee mfctlt m emn p t4aeeoxfctadlm   ueo ( setoio3oy1lmt mfciasfartru  nu4tpxoiociatls elumsnt)altomr iadfpt  ueo t s2umxr3iu4lmt mnes ()srrax poo1opxoiiciad m2emu p;u0 lerifciy1fmD ai sls0 exmxrpou1alenlivia(fartaumoot0ole  feild m rl( sn(4 renir3oadlmDeaiei;t)t2urimpoo1ll   ncia(  rrrumoot0tetoio3iadls2umnmsnu)teeoifcoadlm rlnvo (0s2uoxr no4om   fctlsfarurxm nu4tltomfciyd s2emnvp u0 lxoxr3ty1om raiei (0sexrio3iodlp  lfctat  Draurp;o0oltoif3iysfa em( p u0 lxnxocty1oaDe ueolt  euoimpno4lpen fcil(fartaumpoo1apxnmfetlslm ea(vpn(4tlxrmocoo1lm rluvs;t  exoxmpiodll nlfcias  rraur no0optoioeiadlm2em(mo;(0 eermr3oodlmDr ivs t0 exmxmpoo4llt mfeia(fs2tau p;u1oex mfciyd s rmnvs t0 etomo oytomD anvs;s0 rtm(r3oo1ap  mfcsas) Drmum no4aeto fciytlsDem(vp;t0 ltrmf3tydfateliei;s)s2ur(m nodam nmneia(fsrrrx p;o1olx mo3tad sDrmuvsn(4 exoir3oydomtr u ols0t2xoxo3oo4lmenlieil( aDur(mp;o4aeto oeiys m umuvo;(4aetnmocoytfa  lies;s) 2uoxopnydal  mieilt s2raxmpno4tetomoetaslm rl(vs;t4aeenmf3ta1fmDe u ol(0 rtr(m io4alen ncs sfa2rrxr nt1teeoio3iyd s2ua(vs;(4aeeomf oydlatr i s t0 rxmxm3ny4ope  ivsat arra(mpnu0tlxnmfeiatlsDulnvs (4 rerio3todlm rluvil( t2xo(mpiu4lmt lfcsa()aruaxm nu4tltn fetatla2elumo;t4texoioctotoat ln i () etr(m3iu1amt  ics s)aDtmxroot4teto fciydla2ra(mo (4tltoxf ta1lmD lnei t  eum(opiy4ape  fviat)arrr(mpno1olt mo3tatlm2rm(vp u) rtnmo totla  an o;(  rur(opiodlp nlnetltf 2tru  ou4aleomieiat m2ea(mp (4 exnxo oo1fa ran i () rum(r3ny1lp nlfetatfa2rrxmonu4olx mf3iytlmDeanmp u0arxomrcoydlp r ueil(0srumirpny4lle lnctl()s2um(rono1altnio3iatfm emums t0 lenxo oydlm rliei ()seto(opiu1lp nlivt s sDurxmp;u0oet micilsfsDuanmo u) exnmrctotfp  lnvs;( sexmimpiudlm  lici ( sDta(moou0ope io3ild a emump (4alermrcto1lp e uvi t setoxrpnydalen ivtas srta( pou1oexnmf3tytfsDrmuvpn(4aeeoxf oydlptr ivslt trtoimpou4optemics sfa2taxmp;t0optnioeildfa ean ont4texrio3oodlmt lneo;( seto(r3ou4ll  mfesas) rrmu  nt1aexo icilt s2el(ms (0tlxrmr3oytop rai ilt0 etmiopnodlm   ncs sf 2ra(rpno0opeoio3iysfa2umnmp (0alxrio io1fp e nvol(0truo(rpnydaptemietatf rtmx pnu0oetn fcias a um( s;t4 rtnmf iydom r nvilt) ruoxr ou4amt  ivsa(f Dumxrpot1tpt  i3tld mDeaump t)tlenmr iadomDe ivs s)trur(r io4ll emivtasfa2ta( poo1aeenioetyd s ean on(0artnmr3iodfaDr i s;s  rtm(m3oodom nlnesat a2raxmo;u4opto fciydfm umump;t) renmfcoodopDe ivsl()trtrxm ou4ope  fviat) rur(root4altomi3iydfm2umnmo u0 rxrir iy1optelues;( s2tr(opny4lpe mfetat)s2urxrpnt1tlx  icildlaDemnvpn() rxoifciadfp raivslt  etoio3iy4am eliciatf rrr(mooo1aetomoeiatla rmnmp;u0altrmf iy1lpDeaues;s) etrio oudopen ivs t sDta(m ;u4tpe io3iltfs uluvpnu)teeomr3oodfmDr ues s  rtoxopiydam n fvtlt)aDtmumpno0olt ii3iys m ulnmont4treoxo oo1fp e ivo t trtmir3iu4lme micils  2rmumo;u0teeoiocilt m ra( p;()alerxr3iotoaDe uvsls0 rtr(mpiu1ol nlnvsls  2uru  oo1optomictld sDel( snt4 etrifciydfm rlu o t0 euo(r3oy1apenlfcs s)aDta( ont4opto o3ilsla em( o t0trxomocootlm rlnvslt0seurxrpiu4amen fcsasfarurumpnt0oet mf3ildlm2rln s;()altomf oydfa   ieols0 2um(mpoo1ap  lfvsasf Drrumooo4tlt iieiad sDuau p t0 lerxo tytomte nvs;s  exrio iu1apee iviatfsDrm(root4apxoioeild s ra( on(4 reomf3oadomDran sl( teuoirpiy4opeemnes s)srrru pno4tle mfeils m rm( s;()aexrxfciytom r nvo t0s2to(mpiodoptn nvi s sDtax pnu0tpx  fciydlm2el( s (4aeenmociytlaDr nei;s)sexrir iodaltnlnviltf Duaumonu0opx  octys mDrlu s;t0 rtrxf oydom  aiei t srtmir iydop nlictl() rurur ;t4opt  ocils a elnms;u0alerxrciadlateliei ( teum(rpiodomenlivi tfsrrrur ;u0teeoifciasfa uluvp (4 lermo3oydoptrauvi;s  2xo(o3nydopt mneiasfa2tmx pnu4oetoiociysfmDea(msn(4arermf3oytomtr ivsls)teurim nydalenmnci ( aruaur ou4tle io3iydlsDuan s (4 ltnxo3iy1fm eauvi s0truoxopou1amt livtltf Dra(r ;u1tpt moeiad aDuaumon(0artrmo3iodlmt  i o;(0s2xmxm3ny1lm  micslt)arua(mpno0tet iociydfsDemnvs (0aexomo oytomt ai i (0srto(m oy4optnmnvslt) 2ua(roou1tex  f3iasls2um( pnt) ltrir iodfatelivi s) 2umim iudllee fct s) Duau pou1tpeomo3iys m2rlums ()aetrmr tatoa rlnvs (0 2umirpoydlle lictlt) Draxroot1tltniiciatla rm(vp;(4aeeoifcia1lm elnvils0trumim3nydlmen fvt tfsrra(  ;o4apxo i3tadfs2emumsnu0tetrmrciodoaDe neilt seurimpiudaltnlivi s aDtaum oo4tltoio3iatls2ulnmo (0artrmo3oy1lp  aieo t0t2uoxm3nodalt mnei (fsrraxr ot1olxo ictas aDrm(vp;t4alenmf tydlmDe uvolt)t2tm(r oy1al   ncilt s2rrxmono4tpe  oeiytfm ra(vo t4 eenxo ty1fat  nei;t0 2xmxr no4omtelfvtas)s2rmur nt4oeeniiciasfa2raumo;u4artrif3to1fp e n s;()sexrxopio4lmeemfcs t srtmxmono1oetn feiys mDuanvp u0trtnmo3ty1fmDr uvslt0sexmiopiy1opee fct t aDrmu pnt1aptoiieiat sDulnmont)alenmo tatfp r nes;t  2uoiopiy1lpe  iesat s2tax onu0aet  fctld a2ulnmsnu4teenmf iodlp e u i;(0t2trxm3nydlmenmfviat)srrmum nt0tpeo fetadlsDrlnms u4 rtoxo iadlmtrluvi s setm(r3ny4lpe  netls s2um( poo0alt iiciys m ran snt) eerif tytoa ranvslt)trtmxo oo1ape  nei sf 2tr( oou0optomi3tadls rmnvpnu) lxrxr3ia1lpD  ivi;t  rxrxo3ny4lp e fcils  rtr( o;t0aeeo fciat m um(ms;(4trtoxo3tadoaD  ueols0trtrxopiudapt lfet s  rrmumpno0texnmfetadfs2um(mpn()tlxomo3oo1opte i il(  rxoxopnodlmen fvslsf Duaum ;t1olen i3iadfmDea(mp;u)altnmoctatop eaueo () 2tmxmpiydlpe  ictlt) Drmumpnt1aleo feilt a uan p;()tetnio3oatoaDe uvolt0 2xrxm3oydop  mnct ()srrru  nu4tlenifeildlm2rlnvpn(0trtnxr3ta1fmDrlu s t)t2tmxmpnu1omte ictas)aDrmumpot1tlt mietldla2eluvs;(0arxoxo oydlmD  neils) rtoxrpno1aptemivtlt aDtmxrono4tleo fciaslm ul(mo u)altoxo3tatfpteaivols)trto(m oy1llenlnes t s2ur(r ;o1aet mieiysfmDea(vs ()arenxf3iytlptranvi;s0 rxoirpoodaptnmfeias srtm(m nu0aeto fetytlm ua( s;u) leoif iadfa eai s () rxrio ny4olte ncta(faDtm(mpou0aex  ieildfaDul(vo u)teerir tadfaDelivol()s2tmxr3nodam emietlt)aDumxr no4oet ii3tydfs2ul(mon()aeerio oadoa rln o;t) 2xr(opno1llt  fesasf Dtax  oo0aetnii3tlslaDeaumonu)tltnmf tatfmD lueslt) 2uoim3nudlpt  net ()aDuaurp;u1oeto fetadla2elumsnt0alxniocoatom r u s s  rtm(r3ou4amenmfvi t)srrmu pnu4oex iiciydfm2umnvo;u)trtoioctodlp rlneilt)teurxr3ou4ole micsa() Dtr(mpot0tpt  f3tldfaDeluvp t)tlxrircoatlm ranvsls srurxm3no4ome  ncta()aDumuroou1openmi3ias a rm(msn(0 rerif3oodfaDraneil( s2tm(m3iu1om  mfcsa(fs2tru oou4apx iiciytls rlnmsnt4 lxoif3ta1late nei ( tetmim3ou4amee ivtls)arumu pnu1oex io3iat mDul(monu4 rtnmo3tatoateanvi;()srxoiopoy4ll emfvsa(  Dtru  nu1apxoif3tadfmDra(ms u0treomf3tydfpDe n i;(0seurxopou1lp   nes () Dtaxr nt0oltnii3tad s rmu s;u)aeenif to1lp  luei t0setmxo iudole mfcslsf Dumxrpot0optoiociltla2rl(vpn(4tetomfctydfpDelneo s  2xr(o3iu1amenlict s) Drm(moou0aptoif3tlsfa em(mpnt4tlxrmfciodfate uvil()srxoirpiu1ll nlfcs t)sDrrum ;t4tlx  ociys sDrl( snt4 rtnxo ty1fptr ivi;t srxrxrpoodopenlivt t  rtrurooo4tetnifciat a2eanvpnu0trenmrcoa1op ranei;s)s2xoimpio1ol  lfet t  Dtax onu1olxnmf3tasfm ul(vo;u0tlxnxrcty1fpDrlivi;t0sexmir3io4lptemfcia(fa2rmumpoo4tlxn ictadls rlumpnu0arxoir iatopDeau sl(0 exo(m3oy4llte ieta()s2rru p;o0aetnifeiyt m2umn p;()tltrmrctydfa eli ol(  2xrio3nu4ame mncslt arumx oot4tltnio3iadla rl(msnu4 lermfcoadlpte nei (0tetmiopnu4amte fvi s)sDrax pot0opx  ieiasfm2rmnms;() eerif3oo1oatr uvo () exmxm3ny1apt livsa(faDrm(m nt1tltnmi3iasfs uaums;u0 eenxr3iytoptrau s;s t2uo(o3oudameemietlt) 2raxr ou4tpxnmo3iytls emu on() eenxf tadopD  nvslt teumxo3no4omtelnvslt srtax pnt4tetnioeiasla2ran s u0 eerxo3iotfa  aies;()s2tmiopiudaltnmnvsat arurx ont0aeen iciltlsDra(mo u4 exoir3oydoaD lnvils0seuoiopoy4ol   nesls) rraxmono1oex mi3iadfs uanmont4tltrmoctydlp r i ils0tetrxrpnudlp n fet () Drrxro;t1aexomieildfs rlnmpnu4treoircta1opDeaueo;t t2tmim3ou1olt  ieil()sDrau pnu1aeto fctldfsDemuvpnt0 ltniocto1oaDraivols texoio3oodape mfes (fs2ururpnu1alx  octasfaDemnvsn(0aexnio3iodfp r u i ()trxoxm3io4ap nlicia( srrr(rooo4tex iictls sDra(mon(0artrmf3iydfa   ivi ()tetr(m3nu1ol   fct sf rrmxmono4oeeoioeiltla em(mo;t)arxomrcio1op  lu sl(  rurxm3oy1olt livi s)srrrx oou0aetomoetydfa2um(vp;u) exnircoydfat  i sl(0srtrxm3oo1lptemnci sfs2tmxmono4apxnmictldfa rmn on()aeenir3oadlp   uvs;t0t2uo(m3iydopeelncsatfarrmxrpnu0oexomoeiytfm2ulu p (0 lerifcty1oate u o ()setm(m3oudlltnlivi s sDtr(ro;o0aexn i3iytfs2emnmpnu) rtnxf3oy1faDeai i;s srur(opnydaptn nvs t aruaxr ;o1aexn icilslm2um(vsn(4texrifcta1fp eaneols0 exr(rpio4lm  mfetat s2um(mpnt0tetnifetytls2rl( on() eeoxf oydfaDelieil(  rumirpoydal   fctlt)sDrrumo;t1aleo iciytla2ulnvo t)aeerxr3oy1fm eai s (0s2trim oy4alen fvt sfarrmxm ;u0oexo i3tytlaDrmu o;t4 rermr oodfm  lneil()setmiopoy1ome lfesl()a2tmu pnu4aex mfeiyt mDemnmp t4teenmf3tytoate nvs ()s2um(r ou1ol  lncslsf 2uax o;t0tleniociltfa2rluvp;u0 ltrmr oodomD lu o (  exrxmpoydop nlnvi tf rra(m no4alt iocilsfm eluvp;() renir totla e u i;s trtrxr io1al elivsat arraump;u0aex mieiytls rau p t) lermoctadfpDr neo;s)seurio iodlmenmnvia(  2rm(mpou4tltnmfetadla2elump;t)aexnio ty1fm r n ilt0t2xr(m io4omt lnes ( sruax pno0oeenmietytla ul(vsn()aexoxoctatfatelueolt)trto(r3oodlme  neiasf rtmx oot4tle ifetyslaDrluvs;t) etoifciadoptr ueo s)texmirpio1ape mics s aruaumo;o1teeomf3iatls2eaumpnt) exnxr3oytlatr ueolt)tetmio3no4apeemicia()aDumxr oo1oeenmi3ildls2rau snt4 rermr iy1fa r i s;() rtr(opiy1aptn fes (f ruaurp;o4aex ii3iytlaDua(mp;(0aetnxo oo1lm  ai olt0srtr(m3iudllee ieiatfartaxmo;t1aetnii3iatfm2rlu o;t0texomr3io1opDr n i s) etm(r oodlptnmict t) rua(r oo4tpe  iciadfa2uauvsnu0 eermocoy1fptelu ols  2uoio nu4ale  fci (farraxmono1opx  o3iyd s uauvs t)altoio iodlpt anei s) 2xm(mpoo4ap  livia( srrmuro;t1olxn o3iad mDul(vp;()arxrmr3oydlaDr uvs (0srtoimpny1lp nmfei (f rua(mo;t1oexnmoetltls uanvs (0 lenxr3tadoatrau sls)srtmxmpnudamenliesa(f Dtrum oo1opxnmoetls mDrmuvo;(4 lenxf3iydfpt  nes ( trtrim3iodlmen ncsat)sDrr(  oo0aexnmieiyd mDeln o;u4arerir3iydlaDeaivol(0 euoimpoo4ll emnvs (f Drrxrono1oeto o3iltfs umnvs;t) etoxrcoa1oa  au olt0s2tr(mpoy4lpen feiat) rtmxmoou1oexn ocilslm emnvp;(4 exrxo3iadlate nvs (0 etrxopoo1olt lfcia( a2ur(r no0oltoioetlsla2em(vsnt0 lxrio tadoa eaneol()seur(r iy1opt  fcias)artmumpou1apeo f3ils a2uauvp u0trxrifcoytlptr uvo s  etoirpiudopt  iesls)sDrm( ono4opeo o3iadlmDea(vo;u) lxnxr3oo1fpDrln sls)setoim3oo4ale lfcils srrmumoou4opto iciytfm2umnvs;t4alerir3ia1om  anvo;t) 2toxm ou4lp nmnci ( arrm(  nu4tpen o3iyslaDrmu s;(4 eeoxf3ty1op rli s t0 2um(m ny1amte ieils)s2trxm ;t1aet if3tlslm rl( pn(4 lxrmfciatopDelueo () etoxr3nu4lm  lncsatfsrua(rooo4aexnmfetytla2rau onu4arxoxfcta1fp r uei s t2trxr iy4olte ivs tf Dtmumpnt4tltomf3iasfm2ra(msnu0arenmocootfa  livo (  rxoxrpnu4llt  fes s)a2tm(ro;t4tptnmfciatlmDran p;u4trenmr oodlp  anei (0t2ur(r oudaptemncs t a2ur(rpot4tpeo fciatlm2emuvont0tetoxo3io1opt au i;s t2xo(m nu1optemncsas)aDur( ont4oee mieiyt a rauvs t)trtrmf oy1oa raivo;t0 2tm(o3io4lptnmnesls)s2tax ont4tpxoifeiysfmDeanvpn(0 rxnxf3iadfptraueil()tetoir3oudap  lietls)s2tm(m ;o1tlt mf3iad s2rl(monu4altnmo3oatlp e i o t) 2xmir3nudop e nvt t s2tm(m ;o0tleoiietydfs2el(vsn(0tlxnxr oytfa e nei;() rtrir oy1aptelnciasfsrururpoo0olx ifetls m ranvpn()aexoxf ia1om  au o;s)setrio ny4ol n fvslsfaDurx  ;t1alxnifetatlaDemn pn(4 lermo oytfmDraivs;t t2to(o3ny1amee iet t)srtaxronu1apt mfeild sDulums t4 etoxo3iytomDe ies (0 2umxmpoydameemietas) rur(m nt0tpen fcias mDum(mo;u4tetrmr ia1fpt lieil(0 etoxr nodol emncia( aDrm( p;u4aex mi3tatfm uau o;t4 etoxr iotlaDr n il(0t2toxmpno4lp nmici s sDrm(mp;o4ale  o3iad aDrau pnt0arenxfciotla r ues;s)sexm(mpiodll e ici t) rum( p;o0tpenmf3iyd a um(vs;u4trenmfctodoat  iesl(0s2triopiu4om nlncs sfarrrxrono4opt io3ild s rmu p u4aetoxrcoa1op  au o s)texo(m iu1lmt miei sfsDrrxrooo4opeomf3ilsfs2emnvo;t)trtrxrcoydfaDrauvols  2xmxrpoo4op   fetat sDurur no1oeto ieilt s2ean o (4teerxo ty1oatr i o;t s2xmxmpiydamtnlnvtltfs2rax  no1tpe io3iysls2rmnmonu)aeenxf3ootoptr ivo;t0srtmiopiy1lpeemicsl(f 2tr( onu4teenioctat mDum(ms t4tlenmo3ty1fmt ln sls0 rxrxm3io1ll elfvsat  2rmx  ;u4optnif3ilt a rl(vo t0 ltoxrcto1faDeaivol(0 exrxmpiu1ole lici ()a2trumo;o4tpeoii3ias a rmuvont)tetnmrciydfmteaies;s)srtoir ou1ll   nes ()a2umxroou4alx mieils m2umnvsn() rxoir3oodlmt  n ol(  rumirpnu4am n nesl( sDua(rpou4aptnmo3iytla2ranmo (0alxomr tatomteau i;t)s2xo(o oo4lmenmnetas) 2ta(moou0aetn octasfaDranmo u0arxomr iatfp   ivi ()s2xmiopno4opt livsa()aDrau o;o0tptnmocilslmDraumo u0 rtoxrciydom ran s t)trtmxm oo1apee nvs t s2um(  ;t4opxniietytfa2eln p u4 rtoifcoydlm rli o;(  exrxo iu4omeemict tfsrrr(m ou0teenmfetydfs2rau s;u) rxnir iy1faDeliesl()t2tmir3ny1op e iesl( a2tmx ono4oetomfetld m2rlump u) ltoxocoo1faDrlnei;s)t2xm(o oudlmtn ieta(  2rr(mpno0tptomf3tlt s2ulnmsn()alenir tydoatr uvs s texrio iy4al   fetasfsrum(ront4apt mfcilt aDuan p t4 lenxo3todfmtelnvsls  2tmir oudlltnmictas)srum( pot0opt io3iytlsDrmuvpnt) rxnxfctatlm  ln i t) 2trxr no1lm nmnviat)s2ta(m ot1oexomf3iadfa emu on()tetrxr oadfmDelnes;s0truo(m3ny1lmt mnei t)a2ur( pot4apenmo3iys a ra( s (0aetrxrcia1oatr ieol(  2umio3ou1ol elfcs t arrm(  ;o4ape ii3tltlm2um(vp u) ltnxocoatfm raieols)s2xoxmpiy1olt  fvs t s2trxro;u4aeen fctysfs2rmumpnt) lxnxf oodopteaivi t)trtoxm oo4ameemicsl(f rrrur nu0aeeomfciydfa emnmo;u)arxrmr3totlmt luvs;( s2uoxopio1lmee fci t)srtmu  ;o1apxoif3tlsla el( o;u)texrir3iodfp   i o;( teuo(r3oodap  mieiat)arurxroou1aex  o3ilt a2uanvon() rxrxf oadopteaivo t  rtoxm oy4om n nvs s sDrrxrpno1apen ictyd s rmnms;t4altoxo3io1op elnvils)trxoxo iu1ap elnvi () Drm( ono4apxn f3iatlaDul( sn(0 eeomf3ootfmDranvs (0trxrio3ny1ape  net s a2rru  oo4alxnmfeiltlaDrl(vont) reomf3oo1fm r u s s) ruoim3nu4ame  ieta( artaurpno1tleoiictlslaDeanms (0trxomfcio1fpte ueo s0texrim ny4om nlivta(fsruaxr ot1tpeo feiytlaDrau o ()arxoir iatfmtr uvo;s0teuoxr3iy4lp nmies s  rtrxmpoo0aexo feilt a2rauvs;t)aleomf3ootfatr ivs t s2tr(r3oy1apt mnesas arurxm no0apxnmfcilt a2eanvo (4tleomfcty1faDe ueols srxrxopiy1omt mfviat)aDtr(mo;u0oetomocilt aDumnms;t4 reoif oydfp eaieol(0t2xrxo oy1amtnlietasfsDuax poo1oeenioctas m2el( o;() eenifciydlatraieil(0 ruo(r3oo4lm n fvs (  rtru oou1aet ioeild aDeanvpnt0tltrircoodla ran il(0 2umxo oy4altemicsls)a2urxmpoo1tltnio3tltfa2rm(mo t) ltnmr iy1laDelu il() 2umxrpoy4omee fvslt)s2umu  ot4ale moctysfmDra(mp (0altnmociydom rliei (0 2umxm iydalen ivilsf rrr(m no4aeto fciys a2elnvsn(0 exoif oy1fmDelivilt trtrxo3nudlpeemnctlsfsDta(m nu0olxnii3tytlm2emuvont0 reoif tytfpDelnei;s0 etmirpnu1amtelnviat sDtmx oou0tpen f3iys m emuvs;(0aeerxfcoytlmtr u s;()teumimpou4op  mfciltfaDrau  ot1oetomi3iyt m2rlnmo;(4alxnmociotfmD  ieils0s2uo(o3nu4ll n ict tfsrum(ront1altnif3tlsfa2uluvo t0 exrmfcia1lpDean i;t  2xrxr3oydomtn nvtasfsDum( ono1openmieias aDrl(msnu4 etomf3iytfateli sl( s2um(rpoy4ome mics s  Dtaumooo1tpxomieiatfs ra(mon(4 rtnxfctodlmtr nes t  etrxr3ou4ll elfcils)a2tmxm nu1tptoii3tasfsDrl(ms;(4 lerircta1lmDrlu i;t0s2tm(o oudlp e nctat)s2rm(mpno4oltnmictas m2emnvpnu)teerxo3oadfpt au sls0trtrxrpno4llte icslt) 2rr(mpno0altnif3iadfs2el( o t0tetomo oo1lp r n ilt teurxmpiu1lm  lfcta(f 2uaxr no4opxo icildlaDumnms;(4 lxomf3oatoate nvi;(0s2uoxm nu1lpenmfctas)sruaxrpoo1tleo fciaslaDea(vp ()altnif iy1lp e nvi s)trum(rpnudoptn nctatfsrtrump;t1aetnio3tat m2em( pn(4trerircoatopDelueo;t)setoxo3nodole lfeils  rtr( p;t1olxnifctytla2umumo ()altrif tatlateaivsls) euoir nodlm  mnet sfaDtmu pnt1aex mi3iad m2uau s;t4tlxrmfcoy1lmtrlneilt trxm(mpoo1am elicsatfa2tm(mpnu4apx  feiadfs2rlnms u)aexomf ootopD an s ( seto(opoydomte fctltfsrrm(rp;t0aexomicilt a rlums (4teenxocoatlm  lnvo () rtoxo ny4om   neiat arraxmpnu0optomoctyt s2ra( s u)altnirctydlp eliesls0t2urirpoydlm  lfesltf rrr(ro;t1oet mi3ilsfsDrl(vpnt4trtnxocio1latraivi (0trxrxo oo4ll nlfct sf rrr(m ;o4ape  iciltla2ranvo;t) rxnxfcoa1oaD  nes s t2uoxo3ny4ole mivtat  ruauroot4opx miciatls2ul( o;u)arenmo3oatla eauei s0 exrio3ou4op emfvtl(fa2raur no1tlxo f3iyslsDrlu on()arenmfciadfpDelnvs ( sexm(rpiydlp e fcta( arrmur ;o0tpxnio3iytla um( o;t4 lenioctodoa  ln i;t0srtrxr oudlme lncsa(  2urx  nt1oexo fciysfa2umnmo u0texoxo ty1opDeaieols  rtmim oodlpeelfci t s2rmumooo4tpt ifeias m2elu ont4arxoif iotfm eai i (0sexo(r io1lltnlieia(fs2raum ot0oexo ociltfa2emnmon(0 etrxrctadlmDelu ilt0sexr(m oodll elicsls) Dra( o;t1tpxn ietltls elu o;t)tlxrxocoytlaD  i sl(0 2uoio3iy4amt  fcs s) ruaxrp;u1olxnioeilsfa2um(vont)trxomf3tydomDelu ol(0 eum(r iu4lmte fciltfarrauro;u1opeoiiciadfmDem(vs t0tlxrmo iytlpDeanvo;() exoim nodlmenmneiltf rrm(  no4olx if3tadfmDemuvs;u4aetrxrcoo1optraivols  ruoiopou4amtn fvs s)s2tmuroot0tle ifeiytlsDel(ms;u0aeenxo ia1fpt luvsl(0srxoxr3iu4llee fvs t  Dtmxront1oleniictydla2eluvsn(4 exoifctotfaD liei;( tetoio iydolee netlt s2rax  nu1oleoiictyt a2um(vsnt)trtomocta1omDrlneo ()texoio3oo1ol n fvi (  Dtr(r ;u0tex micilsfs2ea(vpnu0 lermr3iytfpteaivs ()s2tmir oy1lp e ivi ( s2rm(mo;o4tpx  fciltfaDemuvs;(4arxniocoy1opDe n ilt teuoir nydlm nmfvs ( aDumu oot0aeeoiieiyt m rlnms;(4alxrio3to1fmte u i s0sexrirpnodomtnmnvt t)arta( onu1oex ioeildls rlu o;u0tlxomf iotlateanvi ( trtoxm3iy4op n fvsat aDtru oou1apxo i3tat aDrlnvsn(0 eermf oa1opteai o;( t2urxo ny4apt liei (  Dtmxr oo4tptomfciyt sDea( s t0 etrxocoatla eln ol()trurxopoudlmtemfvs ()a2rr( pot0opxn o3iysfm ua(ms;t) rxrxf to1fmDeli o s0 eumimpno1op nmneia() rtru pnt1tlxnioctltfs2rmnmo t0 rtoxrcto1fmtraneil() rtm(rpiy1lp  mivia() rumur ;t1aetnmictyt m um(vo;t)tlxrmo tatoa eai s;s0 rxoxrpoudameemfct s) 2uaxr ;t0opeoifctlt sDeau s;u) leoio iatlaD lneo t srxmxm3nu1lpeemneils s2uaxroot4olx mo3tydlaDumnmont)tleoxo3tadfaDeaivi;s) rxoim iudopt  ietas)aDraurp;o4aeto fctydla2rlnvs t4 lxoxr3io1fmDr iesls) 2xrir3iu4lmtemiei () rta(  nu1oexomfciasla2ul(mon(0 etnioctytfaDeliesls0teuoim iy4ll nmncilsfsDrmumo;t1aptomi3iatfsDua( o u4 lenxo3totfmDeau o s0trtmio nu4ll nmicias)s2ra(  ou1aeenifciytfsDuluvo;() rxoir ty1omt luvslt) 2xr(m io1ap emivtltfartmxr nu1tlx mfctls s emuvo;u)aetrxr oy1lpDe ues s0trxrxmpoodll elncta(f rumurpoo4altnio3ild m2uaumsn(0aexnxocootop  ai o;t)setrir3iy1apee ict s)srtaxrpnt0opt ii3ilslsDulump;t0 etoxf3iadlmt li s ()t2umimpiu4op  mnvt tfsrua( oot1oeeoifeiadla ua( s (4 lxrxf3oydoat aneo t)t2tmxmpoudol nlnvsls s2tr(mpou1opeoifeiydlaDea(mp;u0altrxr iytfpDrlnvs t0 rumxr nodale  fctls) 2uax  ;t4alxo fciatfs uln snt0aetoxr io1fpte nvs s sexoxo3iodapen ivt s s2rmxr oo4oexomociat s2ranvsn(0trermf tatlmDe ues t) 2ur(mpiodameelfviltfsDtruronu4alxomo3iadls2eaumon()arerio3oydlaDrlnvi s seuo(m3ny4al nmictas)a2raumoot4olt mfeilt aDrau p (0 lermo3iatfa ran o;s) euo(rpou1op nmncslt arrmurp;t1oet  i3iadla ea(ms t0alerircootfpDe nvo;t)srxmirpio4al nlnci t)aDtmu pot0tet  f3tad m eluvp;t0aetoxr3oytfaDeanvi;s)s2ur(rpiu4llte fvtl()a2tru pou4tee ifciydfsDeau o u) lermocoo1oaD  n i t teuoxr io1olt liesls  Dumxmo;o0aet iieiatfmDuau sn(0 rtrxr3iadfa elieils0 etrirpiu4am  lnvtl()sDurxr no1tpxomfcild a rm(mp;t4teenmf3io1opDr nvslt0tetrim3nodlpe  ncta(farta(r ou0aexn fctasfs elumonu4texomr oo1omD li il(  2uoxr iudopt  fcil(f Dra(m nu1tlt  o3tysfmDulu sn(0 rxnmo totfa  ai o;(  rurio3iu4amen ivi t srrmurp;o0oltomfetlslm umu s;t)altrmo totlmteauvi;s)sruoxo3no4llenlnci s aDuaxrp;u1altnmf3ilsfa uluvs (0 rerif3iydoa eai slt)t2toxopio1alte fvta()sDtm(m ;u0tet  o3iltls2umn s t)altnmociatom e uvi;()truoxo oy4altemncilsfartm(m oo4aee io3ilsfs eluvp t0 leoxf3to1lm eli i s0s2xoim3ou1openmncsasfs2taur ;u0oexomiciad s2eauvp;(4 rtomrciatop   ivi;s)setmxm iudopte fvs tfsruau ono0tpe  fetaslsDem(msn(0trtnmo3ootomD auvol(0srtoim iodom   neiasf Dtrum ou1olxnmfciatfm ulumo;()alenxo iytoatr uesls  2xmxm nu1al  mivsasfarur(moou4openifciytlaDulnvp;u) rtnxf3oytom elnvi t trtmxr nudlmtnlnci ()a2rrur oo1alt  o3ildls2elums (0tlermocty1fat  u ilt sruoim nydom  mfcsltf 2ra( o;t4tlenmoeilt a2eauvont0 rtnmfcoatlp eau s;t texrxr3iydllen netas s2tmxm nt1ole  o3tysls2rlumo;t0texnxf oodfpD lu sls sruoim3io1ap nlivtlt s2tru onu0alt  ieiad m2rl(vo t0 exnxrcoadfpD  i s s  2tmxo3oudamtelict t sDur(mpno4aetoiictlsfm eln o;(0tltrioctodfaD  ieo;t  etrxmpno1lle lnct ( sDraum ;u4opeo i3iys aDumu s;t0texomr oa1laD  nei s) rxoio3oo1lm   ieiasf Drau o;u4tle iicilsfs eln p t4aleomo ootlaDeli s t)s2tr(mpnodlpt lfvslt)artm( p;t4aeeomo3ias a ua( s (4 leoxo ia1fptrlies s0seurimpnu4lmen fctat  rrru oot1aexomfetld s2umnvs t0alxoir todfm e nei s) ruo(o3iy1lme  fesltfa2raumont0tptnioeiyd s2ran p u0trtoxrciy1fp eai i;t0teurim nu4apeelfct ()a2ur(mp;u0aexnmi3tytfm umuvp u4aetrxf3oa1faDeln s;()t2trim ou4lpt  fvs t  rtmx oou1tpe mf3iadfs2ul(mo (0areomrcto1fm rau i;s0setoxo3io4op nlicsat  2raxroot1oltnifeiat s um(mp;t4artrir oy1la elueo;t  eur(rpiydlptemictasf 2umumonu4opx  i3tld m ranvp () exnxrciydoptraneilt)seuo(r iu4amt mneil(f 2um(r ou4altniicilt s2rm( pn()teenif tydom  lnei t)sexmxrpiydol emfeils) 2ra(r ;u1oeeoifeils aDuanmo (4altoifcta1lmt aieo s)teurir iudlptemfesas s2taxr no1oeto i3iadfs2umnvpnt)aeeomo oa1lptrauei;(  exr(r3iu4optemnviat)srrrum ou1alx iictys a elnvs u0tlxoioctytfmt livo s srxrirpoudal  mnctlt)artm(m nu0aexnmfeiyd a2rlu o u4 rtnif iadfp r uvil( s2tmxo3no4ap n icsls artmxr ;t1teeo f3tlt mDean o (0 etoxo oydopDe nvsls)t2ur(r3no4ap  mivtasfsDumuroot4altn i3tld m2rau pnu)aexomoctodoaD au sls)trxo(m3ny4op   ivslsfs2rmurpou1oeeo i3iasla ea(mp t0 ltrmf3oytomt aies;s) rtmio oy4openlfvtlsfsDuaxrooo1aetn iciat a rm(vp;t0tltrxocta1oa  au il() 2trxm3oydole livta( sDraumoot0aex mociyd s uanvsn(4 rxrxo3iotlp  luvslt0srumxmpoy4amtn fvsas) 2ra(  ;o0aeen feiat mDrmn onu4tlxrxfctytla  ln ols t2urim nydoptelfvilt sDua( ono1apx mfcildfa ea(vo u0alxoxf3oytfa rlnvs;( seuriopoudop n fvsas sDtm(m ot4alx mociltla rlnvs (0 rermr3oy1lmtelu ils s2uo(r oodll n ieilsfs2umu pnu0optn o3iyslsDemn s;t)arxrxo3oa1oat lneslt srurirpno1lpeelncsas)sDtaur ot1aet ii3tydlaDumu s t0trenif3to1omt aivs t0 rum(r nodlp n nci s)aDtax ont0optnmoeiad m elnvo (4aexomo3ty1fm eai i ( trurxopou1om   nvtls  rtaxrooo4tpx  fciatfm2um( s u)artnxocoo1omt  i ol( srxmir3iudlpee nvil(f rur(ro;o0ope  i3iyd sDeln onu4trtoxr3tatfmDrlu s s s2xo(o3nydoptnlfvias)srtm(ronu1tlen oeilt m uan p;() lxrxr3iadfmtraivsl() ruo(rpny1oltnlnvslsfaDrmu pot0aee  o3taslsDrluvs;u4 lenio3ty1opt  neo;( setr(o oodamtemieias srumum ;t4apenmo3iadfs2umu p;t)teenxo3ia1fa rlieol( sexrirpoo1lleelicta(fa2taurp;u1oex  f3ias s rlnmp;t)aexnxo3iadfptelivsl()s2tm(r ny4opt lfct t)a2umx  no1apxo o3tlsls2ul(mp;t4aexomocia1omteai i;s)trxoimpoo1amenmfeta( arrmx  oo0oexn fcils a eaumo (4aetnio3ootla elnvil( sruoxmpiodolee nct ()a2rru pno4altomoetaslaDrau s () lxrxo tytomt  iei t0s2tm(mpoy1oltn ncsl( aDuaxr ot0olxn f3tas s ran pn()artoif tydomteauvil()trtm(o3iy1altn ici (  Drmxm ;u1oex if3iytlaDeanmpnu)teenxf iy1fp eaivslt)texr(o ny4om   ivsltfarra(  nt1oltnioeiasfs2ra(vonu4arxnio3totfa eli sl( s2uoxr3iy1amee fvtl(f 2tr( pou4tetoiiciydls emn s (0 lxnifcoodlmtraivslt tetmirpio4ll   nvslt) rtrxro;u0altnioetyt s eln sn(4 lxrio totfm r n i s teuoxo iodomt mici s aDrrumo;u4apx if3iytfs2ea(vs t4 rxoirctatoat luvi t)teuoir3iydaltnlnvi () rtr( oot0opxo i3tyt m ean s u4tleriocoatlmDelu sl( trumxr ou1optn fcia(  rur(r ;t4tpenmicildfa2rl(mp u0 rtoxo3iydfmt lieil(0srum(opoy1lle licsat)srurxrpnu4olxn ietat m eanvs t4 lxomf oodla rlies (0 etm(o3iudale lfcs t) rraxrpnt4oetoifeilt mDra(mpnt0 lxoioctodfmt aivs;s texm(opny1apee ivtl(fsDumx p;t4aptoifeiyt mDra( sn(0aexrxf ia1oa  an olt0s2xmirpnudlp emnvsasfsDuaxrono0tpxnmfeildfmDran o;t4arerif3tatlmt  nvo t0srur(m3oydol   icsat srra(rpot0apeomictad s2rl(mpnt4 renxr3iadop  an s;t teuoxr3iy4lptnmivtas srtmurp;t1aptn ietytla ul(vp;(0aetoiociy1lp  ln ilt0 eumxr io1al  mfcta(  2ua( onu4tlxo fciys mDumn p;(4tltrmrcootla  lueo t0srtr(o3oo4op n fetlt)sDtmx  nt1oet io3tytfs rmnmo;(0aeenxr iotlmD au s;()teuo(m3oo1al  mnvils aDtaxm ot0oleo octlsfa umnvo;()alxnioctatfaD  uvs;()s2urimpnu4ale livtl() rtm(ronu4oee miciadfsDem(ms u4 renifcoy1lm raueolt) 2uoxo oy1ole mfvs (faDtru  no0ape if3iadla rmu snt0 rxniocoa1omt aueils)sexr(o3oydamenlnct sfarraxront0opto o3ils a2um(ms;()trtnxfciodfp eaivslt0s2ur(mpiudaptelfeiasfaDrm(mont0altniiciltfa2rmnmp;(4 ltoxf ty1opteaivo s  eurxm3oo1al elnvi sfsDtruro;o4olx  ocilslsDrln s (4trerxr iotomDraivs;s)s2tm(o3oudome lfeiat  2umurooo1tetn ietytfsDum(vsnt0 etnxo to1fp rlueils0seuoio3oudlpenmfvtls)s2rm(rpnt1tlenifeiyslsDul( s;t) etnxo tadom ran o t) 2um(opoy4om  mfvt s  rrau poo4texo octydla rmump u0 reoxf3ta1faDraiei;t) rxrxo ou1altnlfcs ( sDum(mpot4apto fetltfs2eln s u) eeomo oy1oaDe iei s)s2toxrpny4lm  lfcs t arraxr no4oetnmietydfs2um(vo t)tlenxr ty1fp rau s (  rtmiopny1amtn neiltfa2uax  ;o1teeo o3ildlsDulnms u)tlxoxf3tadlmDean s;t)teuoim nodale lict tfsrra( oou0ole mfciat m2eauvo;(0tlenmr iadoaD lneolt0 euoim nodlmeemnesas arrr(mpnu0tlenmictas a ua( p;t4artnmf3totlpt  nei;()s2xr(o iodaltnmfeta()artaxmont4tetnmo3iltla2eluvo;() leoir todfp rluvs s  rtoim oodam e nvs t a2tmx pno0opto ieildfmDulnvsnt4 lxnxf3oytopteaiei;()srxo(o3no4lltnlfct t)arrr(mp;u4oeenmiciad a rmuvonu4tltrmrcia1fp  li olt)trtmxrpoy4ame lfesasfs2taumo;t0tlx if3iytla um(von(0 eenif iatfp  aivo ( srto(m iy4amenmnvslt) rrrur ;u0ope ifeiyt a2uanmont4tltnxr3iy1optran o;t) rxoimpoy1opeemfeslt)s2uru p;o0tptniieiatfa2ua(ms u0 lxnio iy1lat  u o;s0 2to(mpno1lmtnlicslt)s2tmumooo1tlt ifciltfs ra( s;u4arxoif oytlaDr ivi;( t2toio iy4lm emfeiat sDrauro;t0tltniictyslm2em( o u)trtoxfciy1omD  nvs s0s2xo(rpoo1lmen fesa( s2tmumpnt4oeto feiadlm2rlnvo;()tlxnxo oodoptran s;t s2uoxm3iodlp elnet tf rtmu  ou1apto ocils m elnmp (0trenir ta1fm eau s ( t2uoio3iy4am  licslt artauro;t0aetnmo3iyslaDeaums u)tetrif totlmte nvs t0s2xmxrpiudomtemictls)aDrru  ;t4opxnmieiysfm2ua(ms (0areoirctodlp rlues t)s2toimpny4amtelnciasfsDumumooo0opt ii3tytfm2elnmo;t0 rxoxf3oy1oa  li i;t trtoxm3nydlme  feta(f rta(mpno1texn ietlsls2rln pn(4tetnmocoo1oaDrlueols  exrxo oy4olenlfvs (fs2tmurpnt0opt iiciyt aDul(mpnu4trxrxo ty1fatr ues;s)t2xoim3nodll  livs sfsDurur nu0oeeoioctldfs2rl( sn(4trtoir3todfatr n ol( sruoxopnudlmtemivtat arrrurp;o4texomociasls rl(vp ()alxoir3iydfaDeaivslt0texrxo oy4ameemfvsl() rtmxrpot0tex iicilt m ea(vo;t4 etnmfciadlp   iei s  rxoxr3oy1lpe  fvsatf Dra(rp;o4oetomieiydls ranvp t)trtrifciadfm  lieols0 ruoxr3no4op   ivs tf rta( o;t4tlxn feilt m2uauvpnu4alenio3oydla   iesl() 2trxopiu1omt  ictl()aDtrum ou1tex iieildlm2emump u4aeenmfctytomtelivo;t0teto(o iydap   nvtl(f rrrxr ;u0oexnifetaslm2rl(mo (0treoxo3tydfp e nes;(0trtr(r oydalenmnvsls aDurum ;o1tpe iieiadfmDuln pnu4arxrircoytlmDrlnes s0texmio ou4ol nlnvta( a2rm(rpnu4oleoiietldlm2umn o u)trenxr ta1lp   ues s)s2xoxr3iu4ll e ivilt)srra(m nu4aeenmf3iytfs2emu p;t0 exrxr3iy1fa rln o;(0srxmirpoy4ale lfcias srumxm no4altnmi3iyd m2emu pnt)artnio3iodoaDrai il()t2uoir3no1amtemicias) 2rau p;t4texnmf3iytls2em(vp (0tlxomrciodfpDr u o t) 2uoirpiu4lmtnmfeia(  Dtmxr oo0tee iietyt s2uauvs (0 reomr oy1omt  ueol(0s2xm(opiy4amt mnct ( s2ta(m oo4tlto i3tlt mDemu p;u)aexoxf ia1lp e u o;( trur(rpny4alenmncsls)srtr(mpoo1aetn f3ilsfmDumn s (0altoxo3iy1la elnvi;(  2tmxm3iydoptn ivi s sDrmu  no0apxo feiys s2ulu s u4 exrio iatoateluvi t)srum(o no4omtemfci ( sruaurpnu0opxnmieiys aDua( pnu0teermo oy1omteln s;t) exm(o iu1lltnlfcsasf 2rm(r ;o0olxnmi3tydfs2eanvp;u)trxrmo3ia1la rauei s t2tmxo nu4alte fesat) rrm(mpot4tpen i3iad s rm(vp;()artrmoctodfmDraivi t t2urxr ou4lmen neiasf rur(  nu4ole  fcilsfm2ulnvo u)arxoxo iy1om ranes;t0tetoim3nu1ome mnesa( s2rrumpou4aet mfciydfa2rm( pnu4tleoxociadoaDeaiei;( s2to(r3io4oleemnesa() Durxrpnt0oeenioeiasfa2uau s;(4trtnmr3ta1oaD anvs (0truoio3oydalte ici t)a2ur(rp;t1teeniieilt a2el(vs t)tlerif oy1lpt aueslt t2to(m3oydlmenmfciatfsrta(r nu1olxo feilslsDuanvp u0arenxo oadlp  ln i s  rtrim3oy1ome  iei t)arurxmo;o4aleoiociysfaDum(vsnt0 ltnmoctodfaDrlivolt s2uoxm3nodll e nvtlt srrruro;o4aexn ociyt sDeln p;u4texnxfctotfm eanvs t) rxm(m io1open nvi sf 2uaxr no0apxnmi3iadfa2ra(ms t) rxoioctodlpt  iei t)seurim3oudolenmfvsat  2tm(rpot0tlen iciytfsDrmnms u0 exrmo3tatomtrlueolt0 2xmir3nodaltemnes s  rum(mp;u1aleo fetadfa umu o u)treomfctadfm raivils0 2xmio nudolt  ict t) rta(rpot1aptnifeiasfsDrl( s u)tltomr oydoa elivs s  rxrirpoodam nlnesl(fa2tr(mpno4oeeo ietytfa2elnvpnu4aeeoxf3oadoptrlieol()trxr(r io1lpt  ncs tf Dtm(r oo1oetoifeils s elnvs;t)tltoxf3ia1fp  lueol(0 ruoirpio4ameemfviat)artmxr ou0aex  ocias a2el(mp;u4treomo oydom elu ols0 eurxm3ou4lmenlnes (  2taur nt0alenifctlsla2umu s;() rtrxf3ty1oa   ivs t sruoim oy1lpenmnct tf Dur( p;o4oltnmoctyt m2umnms;u0trtoir iotlatelu s;()teurxr3iy4olen ictat srurur oo0tpxn f3iydfs2eaums;(0tlxrmo ta1fp eai o s) 2xr(rpou4al n fvi s srum(mpno0alx moetys a2rau s;(0 ltoirciotlaDrlues;s) 2umimpiy4op emfcslsf rrr(rp;o4ape mociasls uln sn() ltoif iydomt auvo t s2xo(m3ou1llenliesat srrr(m no1tlx mf3iydla2elumo;u0 ltomf iatopDeln ol(  2xo(o no1altnlfvsl( a2uru p;t1tetoii3iadfa2umnvon(0aexoio oytfp e iei t)t2xm(o iudalenlnvsltf rtmx o;t1tee mo3iltls rln o;u) eenif iadom  lieo;t t2toim nudomtnlfeiat)artm(mpou0tlxomo3ias a rl( s (4aexoxf3iadoaD  n slt  2tm(m3nydll emnes sf 2tmx  ;u1tltnmfetyd aDelnvo;u)alerifcty1lm   ies;( s2toiopnu1ap e icia()s2umu p;o4aeenmocilsla2ranmp;u)tetoxfctotop  auvi t0trtmxr3io4oltelneia( arumxr ;o1aexn f3tlsfm ean p t4trenxr iodopt aueilt teto(o3oydam n ivsatf rrauroot0tlxo ocildlm2eanmo t) etnmfctatfp rai ilt)srxo(opou1lp n icia()arrmx ooo0aleoii3iaslsDul(mpn(0altnmr tadlpDeaneols) exoxopiudal nmfvsls a2rr(  oo0alt  octat m umu o u4arxoio3todfa e n s s trum(opio1am nmfeias artaxm ot1oeenmf3iasla elu o;u)aleomrctydlpt an sl(0srtm(m oo4lmt mfvs ( s2rr(r ou0opt moeild a2uau p;(0tlxoifcoadfaDrlneol( srtm(m3ny4opee fvsa( a2rau  ou0aeeoiociasls uau p;(4trxomr ta1fpDrau o;(0srtm(mpiydope  icta(f rurump;t0opxomo3iyslm raumpnt4trtoxfcta1lm rln i ()setmxm iodal  mnctas s2rrxmo;o1tltn icils m umnmpnt)altoxrcoy1opteanvsl()s2toxopnodlm nlies t srumur ;o1aetn ietadfmDeln pn()treomfciytla eaivo;s0srtrxo3nu4amt lfesasfsDtruronu0tpto o3tasls2emu p;u4 rxrmf oodfa  au ilt texoio3iy1apenmieta( s2tm(mpnt1apen f3iad s rlnvont4aeerif3iodlp  aiei s) exoxm iy4op elivia( srrmurpou1tlx mf3ils a ra(ms t4 ltrif tytfpDe ueo;s0 rto(m3ny1altn fvsasfarraxm no4tlenmoetytfa2uau p ()trtnxr3oo1fpD ln i ( t2tmxr ny4ll e fvtlsf rrruroou0tpxoio3ildla2ua( ont0trenxr iydfp  anvsl( t2toimpnudope mnvslt sDur(m ;o1aleoiicias sDuanmpn(4teenir3oo1fpDeauei t)trurir3ou1omtemfvsls aDtmx pot4aex ifetat a2rm( o;()artrio oodfmDr nvo t)s2tmio3oy1optnmfcta() 2ua(monu4tex iiciyt aDrmu p (0 lerxrcoo1fateaueo s)trtmxr iu1llt lnvi t  2ua(rpnu1oexomicilsfs rlu pnt)arxnif iatla elivs s)seuoxm nydlpen netls  Drrxmp;o0olxnmfetys m2umnmonu) etrif iy1op ean s s0srxrir nu1lmeemfeta( aDraur ;t4teeoifctas sDumn s u)tlxrmocia1lpD luvs;t0 eumim oudopt  fes (farumumpnu4olxniietls m2rln s;u)alxnif3iadoaDr ues;( srxr(m3oodam nlieil()srrr(rpot4olxo feilsfsDel(mp () rtnxf3tatlpD ai s;s0t2ur(m3ny4alee fvslt  rumur ou4apt  fciys a2um(vo t0 rxnmo3oytlmDelnesl()teuoxmpny1oltnmfctl()a2uaxmo;u4aleoiiciys s2umnmp u0 leniocoodlptr iei s)trtmir iodlle  netls)arrru  nu0oleoioctaslmDeaumpnu4 etnxo oadlpte i i ( seumxmpoodal nmnci s aDum(m ;u0olenmicilslsDumumo u4alxnxr3oy1fm r i o t0trxo(r iydlmtn fvi s  rtmumonu0tlx mociys a2rl( s ()tlenxocta1fate nvilt  2xmio nudal e icsa()sDtru pot0aet ifeiytfs2rln p;u)artomfctatla eaueilt0 etm(r nodamtnlnvtltfa2rm(r no1tlx  fctyd a2uluvs (4alenio tadoaDe n s;s0 rum(r3oo1lpen ieilt  rtr(rpou4opxo oetlsfm emnms;t)tlenmf oodomt li i ( s2uoim3iu1op nmnciat)artrum oo4tpx mfcild m uau s;()aexrifcoy1fm elieslt s2xmiopoodale  fci t) 2urxr ;u4apen fetydlsDul( p u) ltrxr3oy1fmDeluvsls0t2urxrpoy1openlnetl( s2trx o;o1alx  f3iadfa rln o;t)artnmfcio1fm raivilt0s2um(r3ny4omee ici tf rrau p;t1apeoiietltlmDuau o u0 exnio tydfmte neils sruoxr ny4openlfeta(faruaxro;t4tlxomieiysfs2rm(mon(0tetnio3ootfpDr ivi;(0srumir3iu1lm emfciltf 2uaur oo0aleo i3tadlaDemumpnt0 eenif3oy1op e uvi ()sexoxo nu4lm   iesasf Dtm(r nt4alxnii3tyt mDraumpn(0tleomfciotfmte nvs;t)srxoxr3oo4am nmnvsatf Drau  nu4opeoio3ilt s2rl(ms (4aeeoxf tytfmDeai o t0trurio oodapt mfcils arumur nu0texoiietyt aDra(vp;(4aetoirctodlm r uvo;t srurxo3no1opt  ncia( srrmxm ot4aet mo3iatfm uaumonu0 ltnif3iotopDranes;( s2tm(r3iu4lpen icilt)aDrau o;t0alxniictls mDuanvonu) rxrxfcoodfm eauesl()tetoim3iudol e ivtat  Drrum ;o4opeomfciytfa ua( s u4trenif3oytlp r i s s)srtmxopiy1om elfei () rum(  ou0olxomieiasla eau s u4trtrmrcoydlp eaiesls)s2xrxm io4ome mnvsls  2rmump;u1tlx ioeiytfa2eluvo;t) reoio3tytop  luvs s  exmxm oodole mnct ( srur(m no4ope  o3iltlm ranvo;t0teeoifctotlmD  n o s0teum(m3oo1openmfcia(f Dtm(rpno1ole mi3iat aDem(vo;(4 lxoio iadfat  ieslt s2umir oy1lleelies s)s2um(r ou1aet mociad s2ua( ont0tlenxo3tatom rliei t  rtmir oo1lpee neta(fsrta(  ;t4tetn ieiadlm2ea( on(4tleoxo totfp rauvi;(0 2ur(o iodalt mfvs s)aDraxr no4ope mieiat a rmums (4teermf3ootfm  lieils0teum(mpio1am nlfetl(fsrta(rpno4tpto oeils s2um( s (4tlerio3io1fm eaiei;t0teto(o3iy4oltemncslsfs2ra(mpot0apt iociltfm eluvs;u0 etoiocoytfpDr uvs s0s2xoir iy4opeemnct ( a2ur(m nt4opx  ieiydlmDrauvp;u4 lxrmr tytlpDrlu sl(  rumxo iydom nlnet tfsrtaxmpot1aetnmo3iadfmDea(vp u0tlxnxrcoydfat aiei s) euoxm io4llee ict t) 2ua(rpoo4alxn feils s2rm(mont4texrxf3ia1opteli s;s) 2urxmpoy1ale  nvt s sDtax  ou1oetn ictldfs eluvonu4arxoio3oatlp   u o;t) etoimpio4optnmivias)arua(  ;o4alen feildls rau ont0altnmo tydfaD anes;(0 2urxmpno1lltn netas s2rmxr nt4olxoii3tlt s um(vo t)aexrxf3iy1oa eaueilt0trxr(m oo1ome  fei tf rtmxro;u0apxniieiltlmDeau s;(4tltrmf ootlmt  ivsl()setr(m3oydomt mnvt () rurxmpnu1alto fcilsfmDuan o;(0tetoio3tatfa   u o;t t2umir3ny1lme lnvi s sDrauro;t1apenioeiad s2ra(vsn()aexrmo3todlm  lnei s0tetoxo3ny1olee neil( aDtru pot1opeoiieiadlm eluvp;t)aleomf3totop eli i (0trtrxr iy4ap e nei sfaruax onu0tlxn i3tad m2elu ont4texrmr3iadfaDe i olt srxoxo oy4lmt mfeil(f 2um(rpoo0oetnioeiltfm rmnvo u)teenxr3ta1lmDe ueols0 2xoim3io4om   fcias sruaumo;u1alxnifeiasfmDelumo u4tlxoxocoo1fptrli i;s srxriopnu1opt  iet ()sDraump;o1tleo f3iasfsDra(mo;t) rxoxocia1lm  lu olt)trtrio nydapte iei s) ruaumpot0tpe  o3ils a2rauvpnu)tetrmr3todfmDe u slt)t2urim3iydlp  lfvsl(fartru pot1tleoiieiatls rm( p;u)tlenif oatfmteluvsls  2tm(r3iudame  nesa() 2uaxrpoo4alen f3iyd s rl(ms;(0aleoxr ty1laDelnvols)trurio oo4lptn nctlt  rtax o;t1texnioeiat a2em(vo;u0trerxf3iytfpDrai sl(0seuoxopou1lp n ncs s)a2ta(m ;o1oleo o3ils sDrln s;t)tlxrir oytlpD aueilt truoxm oy1lm   fct t s2ururp;u1tetnif3iytfs uaumonu) lenir oytoaDr i s;t0s2xoxm3nudlpe mfvsl()s2taur nu1texomocildla2elums;t0 leoir oatlm rli o;s0teumirpoy1lm nlnet t a2rrxmo;o0ole mieiys s rmn s (0 rxnircoatfp eli sl( sexo(opny4om nmivsat) rrru  ;t1tlto feilt s ulumsn(0 rxrir iadopD lneo s)s2uoio oo1apeemnvilt) 2tax  no4apeoii3iadla rlu p;(0alxnmr tytoaDeaivo;()trtm(mpio1omteliesl(  Dtru ono1aetnioetydfmDrmn s u)tetnirctydfa   uvs s t2tmio3oodlp elncs s)aDra(mont1texniiciadlaDrl(vs (4 lxrxocoodlpte ivo ()s2tmxr oy1ameemnvsat  Dra( oot0aeeomoctatlsDuauvpnt0 lxnif oatlate n i;t trtmir3ou1omt  fes ()a2ua(r no4oee  fciltlsDuau s ()arerxr3oodoatelivslt)s2umxo iy1lmeemivsls a2tmumo;u0oetnmfciatfs2rm(mpnu4 lenxf3oadfp eai o (0tetrio iy4alt lfvsl() Drr(rpot0aee  o3ild mDemn o;u4tetrxf oo1fatr nvi;s)srxrirpnudaltn nesl(faruru p;t4oexoifetas m2rln p (0tlxomfciodlpDeaieo;( t2xm(m oo4opeemics ()a2uaurooo0alt mf3ilsls eaump;(0alxoxocto1oate uvo s  2urxm ny4lptelncta(  2rmu  nu1tlto o3tltls2ra( o () rtoio oodlpt  ivo;s) exo(r3iodlmt mnvt sfs2umur ;o0tlx  feild m2emump;()trxoxr oadfm   neolt t2urxo oo1op n ieia()a2uaxmont1tpxo fciltls umuvsn(0 rtrmr oatfmD  ueils) 2tm(o ou4ame lictasf 2tru  nu4opxnii3tadfa umn s;t0 rtrmr3iotfp rai o;( teum(m oydaltnmfvi s artr( poo0aptomi3ias m ranvo;t0tlxnxr oatfmDeai olt0srurxmpoydolt lneiasfsruax  ;u0aex  i3tadfm2eluvo t) rxniocoy1oa  aivs;(  euo(r3oodam   fvt ()aDtrxm no4ale mi3ilt aDemnmsnt0aleoxo3ia1lpDranvil(  2umirpiudlmtemivt sf 2tm( pou4oexo ociatlsDeau s u0 lermr ty1lmDraues t)texrxrpiy1lp  liesa( s2trurono1aee mictltfs rmn s;(4artrircoy1lm   ieslt)teuo(r ny4olee fviltfaDuaxmo;o0ale moeiat s2ea(vsnu)texrxrcoodfmDeau s;s0 exmimpiu1al   netl( sruaxmpnt1oeeo f3iyslsDuaumsnu0 lxomo oytfmt  u o;( teuriopoy1am   ivslt)a2tmu o;t0teto ieiyd m2ea(mo;u4tltoir iy1oat anes;t)t2trxo3iu1apte fvs ( sDumumonu0oeeo o3tydfaDraump;u4altnmrcoytoaDran i (0trurim oodllen icias)s2ururo;t4tpt moeiad a2rlnvsn()tleoio iy1opDr u o;s  2tr(m ou1omt  iei () rua(mp;u1tlxoio3tadla rl(vo;t)tltrmo3oadlmteaneols)t2tmir3no1altemictatfs2ra(rpnt4tlt if3ias a ulums (4 etoxr oatlaDraieo;s) 2uoxrpnu4lle  ncsa()sDur( o;o1altn ocildfa um( pnt4tltnio3oa1om   iei;s)seuo(r3oy4alee nvslsf 2trxr ;u0ale  i3ildls2rl(mo u4 lxrmo iotoa eln olt) rtr(opnydal nlfei s  ruaxm nu0opto oeildlaDranvs t4 rtnmo3oo1om ean sl()trxoxo iodllenmfci s) rraxm ;t4tlt  ieilt sDean p;u4arenmo todfateln ilt)texmim nudamt  icia()sDrr( ono1tptnioetyd a el( p;u)alxnif3oydlaD aiei s t2ur(o3oy4ape mfeslsf rumu p;o1oetniietltla2umn s;(0 etnxr3ty1fm eaues t trtoio3oo1opte ivsl(faDra( pou0tpeo o3ilslsDeau s;() reoxrcoa1lat anvi s sruoir ou4op elfei s)a2ururpot4aex  fcildlaDea(vs u0 renmrcoo1oatrlnvs;( srxr(o nodllte nvtas s2tm(m ;u1tpeo ociadfm2umnvp;u) ltrxo todlpDraivi s) etr(m ou4llen fesl() ruaxm nt1alxo octld a2elnmpnt)aetomo oydfp r i s s)setmxm3ny4llen nvias)aDtru onu1ole  ociytla2rlumont)trxnxr iadoatr i o;t t2uoim3ny1om elnesl() 2ra(mpot4olenifciydfa2rluvont)aetnmf3iatom  livol(0 2tm(r3oo1ll   nvtatf rrr(root1olxoioeiytla elu o ()altoxo oy1oatr i s;( t2tm(m3ny1om e ivt sf Duau o;t1tlen f3ilsla2uanmp;(0artrmocoo1lmt au s ()t2xm(rpny1lmtemiesat  rtrurp;t4tpxnmo3iasfm2uluvo ()tleoif3iy1fate n sl(0 2uoir iydopenmiet s aDuaurpnu0opx ioeilt mDuln o;t4texomo io1op e nes;s)s2xr(mpiy4ol nlnvi t)sDumu pot1altnifciadfs2rlnvs t) eeomo3oo1opt li o;s)t2tmxo3iu1aptnlnvil(  2rmumpnt4tpto i3iad m elnvpnt) ltoir iodoptrlies;s)t2xmim3no1openlnct () 2um(mo;t1oeeomiciatlsDeanvs t4artnxr3iytoatr neslt texmiopiy4lmen iet t s2rr(rp;u0opeoii3tlt mDeau o;(0 eenmoctatla   ueils teum(r3oo4om emfct sfarumum ou0olt mo3iysfs2rmn on()tlenmfciy1opD luvilt0 2to(rpoo1apt  fcsatfaDuaurpnt0apt mociadls2elnvs t)tlxomf oo1lateaieo t0 2xrir3oudam  lncias) Dra(rono0apt ifetad a ul(vsnu)teeoxf3oytlp r nvi;t0srxm(opno1llt lncsa()artm(r ;t4tee  ociys m2elnms t0aeenio3tatoa ean ol() rtmim3oo4omenmfvi ( s2trxr ;o4ole if3ilsfs uauvo u)alxnmfciy1oa   i s s  rtrio oo4alte ivs (  2ur(r ;o1apx ii3tytlsDeanmp t)tlxrirciydfp r uvs;(  2toxmpou4ope mietatfa2ta(  nt4tltn feias m2rmumo;t) ltnmf oy1faD aivs t0teur(r nodop nmnvs t  rrmxmooo4tlxo ictydfa uauvonu4alxnxo io1oat au il(0srxoxo iu1opt mivt t)arum( pot0apt  ictld s uauvsnu)alxnmo3iy1op  aies t t2tmirpiy4ope livilsf Dtrurooo0olxnmoctat m2eluvont4trtrif oadopDr uvo t0 2xoirpiy4lm nlnes (f 2ra(m ;t0apenii3ild mDean o t)artnmr3ia1laD li s;s sexm(opiu1lm elnctlsfaDrmu  ;o4apxoif3ildfaDrmnvpnu4arenxrctodlateliei;t srurxo3iudamenlietat)sDua(ro;t1opeoifeiyd a2eln p (0tlenmf oydopD lneo;t0 ruoir iydolen fctlt  rur(mpoo4tlxoiociydfmDrln o;u0arxrif3oatlmt  nei ()s2to(mpoydam  lfei s)s2tm(m ot0tpto oeilsfaDran ont4 exomocio1fa r uei;t) rtrim3iu4am  lfesatfa2rm(r nu4oeenioeiatfa rlnvsnu4arxrxr oydfm eluvi (  rtrir3iy4lme lfvils)sDrrxmpnt1opeomictatlm2ra(vp u0trtnxfciadom elneols) rumxrpnu1ome  ivsas  2raxmp;t0tpxn fetyd s2emuvon() exnmr ty1lp  anvolt trxm(r3iy1ll nlfeils aDua(r ou1aptomoeiysfa2ua(vpn(4tetnmr iodlateanes s) rxo(m oy1lm emnesatfarumuroot0oetniiciyt a rlu s t)aetrirciotomD  ieo t srur(opoudlpenlfci () Dra(monu4opxo ociad a rlnmpn()trxomocto1oa rlneolt) 2xrxm3oudome mfcslt  2ta( ont1tlxoifctysla elnvsn(4tetomr ootfmt lnvils t2ur(mpno4lp elfcs sfartaum ot1oetomfetad m2eluvo u4 rtnmf oodfaDeluvi s)seumxm3no1al elnci sfa2rr(rpoo0oltomociad s2rl(mp;(0 rxrmf oatfaDraieo s0 exmir iy1alt  fviasfsDtmumpou4tpt moctydlm umuvsnu) reomr iadomteanvils)tetrxrpou4oltn iei (f 2ta(m ;t0aexo o3iyt a2rm(vp;()trtoir oa1lmDelnvo (0s2trimpiydlmtn ics tfsrtau p;o4alto feiyt aDraumpn(4aexrir3todlptrliei s setrio oo1lmenlfvilsfa2tr( pot1ale ioeiatla umn o;u4 rxniociotlpDeaneolt0s2uoxrpiu1apee fcsl( s2ta(  ot0tlto ieiaslm2eanvsnt0aeenxf iadoa e uei;(0srto(opio1lmtelfetls aDtru pot1ale if3ilt m eanvp;(4trerxfctotlp  lnvi;t) 2urimpoy1apt  ivi (f 2umu  ;o0apeoii3iad a rm(vp ()trxnir io1la r nvilt0trurxmpny4llenmivia(f 2urxr ;o4oet mfeiltlaDulu s;u0aexrxr ta1fateluvi;(0t2urxo iu1lle lfcta(  2ra(  no1oexn fctatfa ra( snt)tleomfctotom ran ilt0 exoxrpnodom emnvia(fsrtaum ou0oet  i3iat a rmumonu4aleoxf3ty1fateln s;()tetmimpnodll elivtatf Dtmxm ;o0teeoiietld a rau o u4tlermf3oatom eaivo;s)truoxopno4lpe  nvs ( sDra(mp;t1aeen fciytlm rm( o;(0 reniocto1om r iei;( teumirpny4olt  ictlt)arur(r ;u0tee mo3iltlaDumnmp t)aetrmf3ta1om   u i;()trtoxopoo1lmtnmneiltf 2ta( pot0altnioetaslmDrl( s;(4treoxrcoo1faDeluvolt) exmxopiydome mnet (faDtmxro;o4alx mieiydlm2ea(vo;(0arxrxf3oodlaD  ieilt  rtmio3iodalt mnesatfsrrm(moou0openio3tyd sDea( on()arxoio oatlm rau il()s2xrxrpou4omtnlfesl(fsrtm(rpno1aee io3tlsla2elu p;u)tetnxociytop  lu i;s0 etmxmpnudlptemnes t arurxrpou4tltomoeiydlsDem(vp t)aleoir ootlptelivi;t) exoxm3oy4omtemfeil( arrau  nt0ope iocild a2elu on()tltoxf3ia1fmDr ueo t0 rtoiopiydomtn nvsa(  Dua(rpno1opx if3tysfa elu ont) etnxociy1lm elueolt t2xm(m oy4omteliciltfsrtm(mpnu1ope mi3tadfs rlumo u4aeermf3to1lpteaivol(0s2urir3nydape lfeslt  2uaxmpno1apeo i3tyt m uluvo;u)aetnmo3to1faDeluvi;s)seurxr3oodopt mfvt s  rurxm ;u0tltn i3iyt a uanvo;t4tlxrmr ia1fa eauvs (0sexmxmpnodol n iet (farrrx  ou0aetoio3ilt s umums;t0aexnirctytfpt aivi t0 2xm(r3oudome  fctas)sDtmum ou1teenmfeils mDuan on(0aexomr3to1lmtr uvils) rxr(opiy4ll elictl()a2umxm no4aeeomf3tydfs2umnmp () ltrxf3tadlaDrau il(0teum(mpno1lle  fcilt)arrru o;o4tetnioctldlm2umums u0texnxf ta1lmD  u s;s)s2umxmpnu1op nmietas s2umxmonu4oetomiciysla ulu o t) lxoif3oo1fm  lu i;(0teurio ou4ap elncsas) Drmu  ou0oet  ociyt m2rlnvp (0alerxf io1lp r nvi s0trxrxmpoo4op emnciltfsDurum ;u4texo fetys mDeau s ()aeeoxf iodomDranvo;(0 rumir3no1lme mfvsltfa2ua(ro;u4tpenioeiyd aDemu s;(0 rtoif3iadfp  aueo s)s2xmxo nydop nlfct tf 2rrur ;o0apenmi3tlt sDemuvp ()tetrxr3oytfmDrau i;t)sruo(m3ny4lm  mneils)a2rrxmono4ale if3iadlm rmu sn(0 etrxr oadfa  an il(  2tr(r3nodlmeelfet ( s2tm(  ;u1oet micild a uanms;(0tltrmr3oydlatrln i;t  exriopnydomtnlivsat)srurump;o4alx  fetltfs ranmont)arenir3oa1lmteaues;t0t2xmxr3iu1lmenmietat)s2urur ;o4oexomf3tas m ua( on() renio3iydfp  aivs;t trto(m3no4am e nci (fsDur( p;o0tpeo i3iyt a2ea( p u4 rtoxfcoy1om elies;( t2urxr3oydalte fcsa() 2trxront1tle  ictysfa eaumpn() eerxf3ty1fptrlieo s trto(mpiodlle mietasfaruaur ;u4oex mictlsls ra(mp;(4tlxrxociy1optraieo;()s2toxr iydll elfct (  Drr(mp;t1apen i3iadfmDem( o t0 rerxfcia1fate ivi s  2xo(o iy4lmeelicils)sDurum ot0aeeoiicilsls2elnvs;t)aetrifciatlp elneilt0trxmir oy1om emnvt s)aDraumo;u1teeo feildlm2rluvo;(4artomrctodlp  aivols0teuoimpou4op nlies sf 2trxrpou1oetnifetlt m rluvo;u0 eenmf totla rau o s t2xo(r ny1apte ics t) ruaxmpnu0tle io3iytlmDumuvsn(4aexoir iytfm rlivi;s)trxrimpny4omt mivias)s2ua(rpou4apxo fciad aDea(vp u4 etnifcootoa rau s t teur(rpnu1lpenlfei ( s2rru ono4tlenif3iltfsDum(ms;t) lxoxfcty1oa rau s;(0teuoimpnu4ap n ieias)arrau o;o4tltnmoeiaslsDemn s t0aetnircio1opt  nvilt) exrxopiu4omtnlfet () 2ua(rp;o1ale  ictadlm2ulnmp;t0texoir oytfmDrlnes t0trxmim iodamenlieta(faDurumo;u0ale  feiydfa2emnmo t4aexoxf3tytfmDraiei;(0trtm(mpiydalee ics ()srumxmp;o0opt ii3tldfs um( pnt) exoifcty1latraneils0trxmxrpiu4am nlnvil(fsrra(m ;t4ope ifeias s2um( onu0trxomo iytfpD aues () rxo(m no1aptn ivt tfaDrau poo1alenioetatfm2uanvo;t0 ltomo3iytopDeaieils0srumxr3nu4lptn fci (  rtmxr ;t4tet ifciydfm rl( p;u4arerif3oo1opD  n o;()seum(rpno4olee fcs t) rtm(mpnu0tlxoif3tysfsDemnmo;(0 eermr iodlp eau sl( t2uoimpoodllee ivtas)srrr(r ot1oetnmi3tlt aDeau o;()texnxf3iatla ran s s0seum(o3ny1lpe  fci s)s2urumonu4texnii3iydfsDua(vsnt4tetnircta1oa   uesls)texmio3iydoltnlicslt srurxmo;u1oeenmietat m2umnvont4 lxnmr tatfm e u i;(0 rxrxmpiu1al   ics s) rrr( ont4ope moeildfsDrluvs (0 lerif iytlmt aneo;(0 rtm(m3ny4lpenlivsltfsrrr(  nu4ole iictas a2ra( o;(0tlenmf3iydfmDranes;(0seto(r3nudap n ieils)sDurumo;o0aexomfciysfaDumu o t4aleomf oa1fatrai i;t  rur(o3iu1lp emiet s) rumu p;o1ale mo3tldfs rmnvs;u4tlermf3iatlpDe n i;t)s2xoim3oy1lpe miesat a2tmurpot4tltn i3iydlm2elu p;u0 ltomr3tadop e uvo;s)s2urimpou1lltemnes s) Drrx  nt1oltoioetld aDemn pn()tlxnmr iy1fatrau sl(0s2tmxr3nudop emiei ( sDtrxr ou4olxn ocias a2eanvs;t0artoifcta1fa r n s s0t2xm(m nu1lmt mnetas a2rrxr oo4alxn o3ils m ea(vp u)tetrxr3oa1optelneol(  exoio oo4lp  mici ( a2rrurp;t1texomoeiasfm uau s;()tltrio3iadfpte ieols)teur(r3oo4lmee fesa( srtru  ;u1apxn ietys s ra( pnu4tetomrctytfm e uvo;()teumxo3oydamtn nes sfsDtrxmoot0tex ifciltlaDelnvs;t0 ltoxr3oa1op   uvo ( t2triopnydapeemfcsltfaDum(m no1apx mo3tlslm2ul(mo t)aexrxr oadfp rliesls srto(opiy1ol elicsltfarrr( p;o1openmieiysfaDrmn sn(0 eermrctytfat lueo;t0teur(r oudamtemnvils s2raxrono4tptn i3iat m2ul(vp;t4aexnmocta1laDeli i;s sexr(r3nodapeemnet tfsDrrxr ;o1oeeomo3tytfaDelnmp () eeoxo tatlp eaiei;(0trurxmpou1ll nmnvt s  rtaum ;u0tptn ieias a elumsnt4 ltriociydlmD  ivi s texm(rpny4lp emfctl()artru oou1apeoii3ilt s eanvs t4 renmoctadlptr uvs;s) rumir ny4ol e fvsl()arta(r nu1tpeoif3tasfm2uanvs;(4aeermf iy1fpt  ivol( srxrxr iu1lme mnctltfarurum nu4oleomf3ild s2rm( o;t4aetnxrcto1lpD  u s t  rtrxrpoudlm elnvils  Dtm(r ;t0opeomictytlm2rmn o t4aeenio oo1lmtelneols)trxo(r3nu1lpenliet t  rtaxm ;u4tex moeiad m2rm(vp;t) etnxr iotlmD  u s t0 rurxo3nu4al nlieia()s2rm( onu0tet ifeilt mDranmonu0texoio3tytfmD an ils  2xoxm iy4lmt lnvtasfaDrrx o;u1tlen i3iyt m2emumpnt4arerio3tydoptelu o ()sruo(r3io1ap emivil(fsrrrx  ;t0opeoifetlslmDrau p u4 lerio ootoa raies;()trtmirpnodll nlics s)arrm(r ou1apt if3iytfsDeauvs;u4tltnxfctytomDe neolt  rxoimpou1amenlietat aDumx oot4tpxn oeiatfm rmnvs (4 eeomf3tytoptr i i;s0 rxoiopoy4oltelfctat  Draxroot0aptniocildlm2rluvs u)alxoxr3tytlpt lues t sexrir nu1amte ics s)artmurpnt4alxnmoeiatlsDumnmo;u)alxrxf3tadfm r u ols srumio iodamtn fesltf rrrxro;o1aexoifetysfaDemu o;t4altnxf3iatlpteanesls  exm(m iudomee nvtatfaDrr(m ;t0tpx  f3ild mDrlnmp t4 lerxrcoo1fpD anes;s)setmxr3oydaltelfvsa(f 2uru p;t1opx  oetltls elums t4alxnxf3totlmDrlnvols) exoimpoo4alen fvi s aDururont4apeo fctaslaDumnmp t0trtrxrcoy1fa  ln i;s) etoxrpno4lp e fet s  2umu pou4aet ifeiltfsDraums;(0tetoxfciatopt  i o t0t2xrio3io4amenmict s)aDtm( pnt0ale moctasfmDea(msnu) rxnxr3to1lmDrau i;t) rtmxr3no1olenlnvta(f 2ur(  ot4oexoifeiydfa um(vs ()areoircoo1optelu s;(0 rto(m3no1opeemfvilt aDtaurpoo0alt  oeiys mDrluvsnt)tltoxrciodfateai i ()srxmxm3oo4ome mici sf rumumpou4aeenmf3iyt s2ran o t4artrif iydfa  lneo (0trxo(mpoodol  mfci t) Dumur ;t1tlxn iciaslm2rlumo;t4trxnif oa1fpt luvo;t  rtmxm oy1lp nmnetlsf 2ururo;o4texoioctasfm umumo t0 rerio3oadlm rlu ol( srxrio3iy4llenmivtls s2raxm nt4oee  i3tlslaDemn snt)texrmrcty1fm rai o t0 2umir3oo4lptn nvils)aruaur no1apeo oeiysfa2rluvsn()tlerirciydfptr uvi;() euoio3iy4lpen fetlt)sDrauronu4aetomocilsla uauvsnt0texoxrcoatoptelu i t0tetoirpno1om nlncslt)s2ua(rpnt0oleo iciytfaDul(ms;u0aexoxocoy1oa r uvo;( t2urxopou4lme  fesat)sDur(r ot4teen icilsfa ea( s u0 rtrxf3iy1omt ln ols  etrir3iu4apen nvt ( srra( p;t1aptniieildlaDrm( p t)alermrcoo1faD anes;s srxmir oudlpe mnvslt  rtmuroot4tleoioetatfm ulu pn(4texrifcio1lptrlivs s trxm(m nu1am nlnviasf rraurono1tetomietat a uaumsnu0aexnif3tytopte uei;t  rxoimpny4ap n feia( srta(mpou4aleo oeiyslmDumu o t4trtrmf3iy1lm e uvsl()s2xo(r iy1lle mfeia(  ruaumonu4tee if3iyslm ranvp u)alerio iytfmDrauvi (0 rtmxr3nodamtnmivtasfsDumx  ;u4ope ifciltls ea(vp;() rtnmf3ootlpteaneo;t0tetr(r nu1lmtn iei s)aDtmu  ;o1tpeomictlsfs2ra(vp;t0 rxomrcty1fa raies s t2tr(r iodol emivsasfsrtmum ot4oleomoeiat sDel(vs u4arxnxfciatlmDe u s t0s2urirpiu1ole lfeiat)aDrrxr ;t1aetniietyslm um(vo ()teeomrctodopDranvsl() etmimpno4lmtnmfci s artau  nt4altnmfetat a rln s (0arxoxo ty1optrlivils  euo(o nu4lmte ivsls)srtruroou4tex moeiys sDum(vp;t0 etnxfcoo1op  aneo;t srxrir no4ome miet s sDumu o;t4apeomfciyd s2ra(vp;u0 eenxo3oa1lmDraieo t0teum(o3oo4lmtnlnvsasfsrraxr nu0apxo o3ias aDulumpn(0aeenio oytomt auei;t t2xrxo no4lpe lfcias sDrmx pnu4tex mi3iyt a2elumonu0 leoir3oatoateau i t0t2xr(r3no1altemncsat) rumx  oo4ape mfeils sDean o t4trxnio oodfpt  neo;s  etrimpou1oleelici s)sDtr(roou1aet  oeiad a ea(mp;t0 renif3iytlm rli slt)t2toxr nu1lm nlfesa(fs2tauro;t4tltn ocildfsDea( p ()aeerxo3iotomDr iei () etrirpoo1amee ics tfartrxm no4aleomietas a2el(mpn(4alenmr3totoptrau sls)tetrimpiudomenmnei ()artrxmp;o1oee if3tat m ranvonu)artrmfciytlpt livil(0t2triopio1lpt lfvtls)a2umxrooo4tee mo3tlslaDua( pnu)texnio3oadlatrlueslt0 2xr(m nu4ap   fei ()s2tax p;o4aet mf3tytfa umu sn(0 etnxo ia1lmD  neslt0t2xmxm nu1opeemfvi () ruaxr nu1oee  icilt s2ua(ms t0alxrir iytfmD  n olt truoxo nudlmenmivsltfs2rr(  ot0aleo feiytfmDemn s;(4alermo3iydomte u i;()tetoxr iy4ol  lncs t artrx pnu1opeomoetat sDemu s t0 lxnio tydlptr n ol(  rxm(r3nodlpen netat srrmx  nt4tetnii3iatfmDrmn s;()texrmo ia1oa   iesls0t2xoxr3iydlptn ies tfs2umx pnu0olto ietadls2ul( pnt)aleoxrcoatfpDeanei ( trtmir3iydlme lncsls)arurxmpou1oleoioctytfm umnvsnt4altrifciodom e n o (0srxo(rpnu4llt lfesat  rur(m ot1tlto iciytfaDrlu on(0texnmoctotlat  uvo;t0 ruoio io1ol emfcils  Dtaur nt1apxoifcilt a2emn o;t4texnxf iotlpDelieo;()s2xoir iudlmt lfcs () Drau p;o4optn oetydlaDum(mp u0tltoxf oodopDr nvi;t s2tm(o no4am e fcsl( s2tax ono4tpx miciys a rlu s;t)alxomr3iadlm   i i s)srtrir3iodlmtnmfvtls) 2ra(r no0tptoifeiasla rau p ()alxnxr tatomt luvo;t) rxoim3oodamt  fesa()a2uaxrp;t1oeto i3tld a2rluvp;(0texoxr3oa1fmD anvo;()teur(m3iu1altelieiat) Dtaxmo;u4ope  icias a eanvo (0trxnifcta1oatrlivo;s) rxoxrpiudaptelfcsat aDur(r nt1tptnmoeildfa eauvon(4 rtnir3iadfm eauvo;t)s2uoirpnydapt  netltfartau  nt4oeen oeiatlaDuan on(4trxnxociytfmt aivo ()t2xr(mpnydoptnmncs s a2um( o;u1olen o3ils m2rl(vsnt)teerircoodlmteauvi;s  rur(r oy4am  miviatf rtr(  oo0tlx moctltfs2rl(mp u4texoir tytfmt anvo;(  rxoxmpnu4ame mnesas)s2ua(root4openiietyd s2uluvsnu)aeerircty1op  anvo t0 rto(r3nu4lpt mncsls)sDrax p;o0tlt mfciasfsDrm(ms t0tlxnmrcoadomteaneslt0t2tr(o iu1om emnes s sDrmu p;u1oleoioeils a2eauvs;(4trtnmr3oodfa  aivsl( srum(r3nudol elnes s  ruru ont1tlxo f3iysfm2emn p;t0tetrmocootoatr ivslt)s2xoim3oy4lltemieia( sDtmumonu1oleoiieiadfs umnmo;u0 rtomf oatoa elnvol() eum(o3ou4al nlivs tfaDur(  nu0tlt mf3iatfs el(mp;u)tltoxf3oytfmDrlu i s)trumxo3iodam elfcil(fs2raurpoo4tlen oeiytfs2rl(mont)artoxo3tatomt  n slt) 2urxr3iy1lltnmiesat  2tru pnt4olt mo3iydla rluvs;u4texnir3tytop ean i;( t2triopno1omtemieslt sDraxmpno1tpen o3ildfm2eauvo u)tlxoxf iotlmDr nvsls0srxm(o oydom  mnetlt  Dta( ooo0tex mictadfmDrmn p;u) eenir oadlaDeli i;t)srxoxm iudlp e nei t) rtrur ;u4tetomoeiatfa2ra( p u4trtoir oytop  aivo ()srxr(o3oo4apenmics t a2trx ont0tpeomfctlsfs ulnmsnt0teeomo ta1lateai s t)s2xrimpnu4op  mnesasf rrrxmp;u1tpx if3tat a rl( s;u4tlxoifcty1fmt aivil(  rurimpoodlltemfeils s2rm(r nu1tlenii3tld aDrln p;u0texniocoo1fpD lnesl(0 2tmio3oydlpeelivils a2ra(r no1alenmfetltlm2rmuvp;u) exrio3tytfp elivi ()s2ur(m ou1ame mfvilsfaDrrumoou0olenmiciatlm2emumsnu4 eeoxocoytfmDelivs s)texoirpoudapeelivias)sDrau ont1aeeniieiytfmDrlnvp;u)artomr todom raueol(0trtmio iy1ope miei sf Dra(m ;o0ale iietyt m2umnvs;(4 etrmo ootoat livil()t2uo(opoydlle  fct t)s2urx poo1alxnmo3iltfs emnvs;(4 eenxf iytoatraieils  etr(o3iodal  mncs ()aDrmu poo1olto f3tlt a2el( p t)aexoif iatlmt lies () rurim3io4opeemieslt)a2trxrpot4oee ifeiyt m ua( p;u4tetoiocootla  lnei t0sexr(mpio1ale lfes s) Duau  oo1aetomociasfs rmuvsnu)trtoif3iytomDeauvo;s0trxmxmpoudap n ieiltfsrtaum nu0tltn ieiys sDem(mp;u4 renmr3tydfat ln o t  rxmxrpiodlmt  ncsa(fsrtm( ont1teenmo3iad mDeauvo;t0arenmfctatfat  uvil(0s2umxm oo4am elnvi s)s2rrumpnu1opeoio3iyt a elnmp u4tetnxf oydfmDr uvi;(0trxo(o oodlp   feiatfsDra( oot1ope ioeiatfs rauvon(4trxrxo3oodlp e i i (0texrirpio1opte fcsl(fa2uaxm ;u1tetoiociadls2ra(ms u)aetnmf3iadomDranei t) 2xrio3nu1lme micta(fsDuaxro;t1olen fciad mDum(msnu) lxrmf3io1lm rauvs;t  2xoxrpnodlmtn icia( artr(  nt0alt  ietltla rl(ms u) rerifctodoaD  i i;s0s2xrio3io1amen fctls aDumxm ;o4aexoioetyd a rl(vo;t4tlxnmrciadoat auvols)s2uoxopiy1ame  icia(f rur(m oo4aeeoifciat a eaums;t4 eenxo3oadlateluvs t) etoir3iodalenmivslt  rta( pou0olx mf3iyd mDrm(vpnu)aeerxr3iatfm elivs;s0 2uoim3iu1lm e ivia()aDta( p;u4oexn f3tysfs2ul(vp t) renir3tatlateli o ( srtoxr iudllenlnetatfa2ur(m no0oltnii3tls s2um(vp;()trxnir totomtraieo;( t2tm(mpoy1alee netl(f Dururpnt1tleo f3ias s rl(msnu0 rtrxociodfpDrauei t)s2uoxopou4omt mivs s sDrr(ro;o0oetnmieiys mDem( o t4treoio ootfpDrlu s (0setoio3oo4amte ict tfa2um( ont4oexn o3iydfs2ul( pnt0 eeoir iydlpDrliei;()tetm(mpoydap nmncsls aDtm( o;o0optn i3ildfa rmumo;u4 exrif ty1lp  ai i t0 rur(r no1omee fct s) rtaum ou4alt  ocils s ulu p u0 rxnxrciytlm  lueo;t trxrim3nu1ll nlnci s srumurpno4olxoioeiad m2eanmo ()trxnmr3oydom  lueil( seurxo oo4lltnlivi s a2rm(root4tpxn oeiyt s ulums;(4altrxf ta1lm   ivslt srxoiopiy4olt mfesas) 2ta(r ;o4olxn octldlsDemu s;t4tltoif3iydlaDrlnvsls tetm(r iydlm  livilt srtrumono4olt mf3iasfmDuanvonu0 ltnxf3tadla   nvs;s)t2tr(opnu4ll nlnvsat)arrr(mooo1teeo f3tas mDemnmo u)aeerifctytfmtraieils  exm(rpoudaptn nci s a2ta(rono1oltn ietlsls2uan s;(0altnmf3oadfaD aiei s0t2umimpoo4lltnmfvsa()arrrxm ou0tpxn i3ildlaDuluvsn(0tleomf3oadop r i o s)s2uoxo3iy4lpen icsat srrmu poo0opt  o3tysla rauvont) ltrir3iatfm e i i t0trxo(mpou4aleelncta() Drmx poo4olx  i3iadfa2ea(vont0aetnmo3oydlp ran i;(  2um(opou4lptemnesltf rrr(mpot4tle  ictydls2uanmp;t) lxrif iodoaD auvi;s  rxmio nydamtnmfetl(fsrtaxm no0tlxo fctat a2uan snu4 leomr3io1om eln sl( seum(rpoydolenmieia( s2rmx pou4optnioetltfaDea(vpnu4trxoxfcio1lmDrln o;t t2umirpio1lpe lfvs sfaDrr( oot1alxo o3ildlm2uau s;t0alermf iy1fat aies (0 2umxm oy4am nlfct (faDua(mont1tle  octlt aDrl( s;u4alxnifciatlmDeaueo (0t2xm(o3nodamt lfvilsf Drrxmpou1oexn octadfm2elnmonu0 leoio3oadlateanei () eum(mpny1ape  nesls) rrr(rp
\ No newline at end of file
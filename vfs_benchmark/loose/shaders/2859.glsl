@@ -0,0 +1 @@
+ueols sexo(m oy1omen ics (f 2uax p;o0aeenioeild sDuaumsnu)tlxoif iodoateanvo;s)srur(r3ny4ll  lfcils srumxr ou4olx  fetldlm rm(mo u) rtrif tatlaDrlies;( s2xoxopoy1amen ics (fs2tmur no0aeenmfcildlsDem(msnu) exrxo oytfpteauvsl(0t2xr(mpny4amenlfvil()aDurxr ou1tpe mieiad m uanms () rtoifcoo1fmtr u ol(0texmimpoo1apen iesa(  Dtmumpou0tetn ietytlaDrm( o;u0 leoir3iotopte uvs;(  rxoir nu4openlnctlsfs2raxmp;t0tlx  fctas s eauvp (4arerxr3iytfmD anvo;s s2toio nodapt  fcia()sDra( o;o4olt mieils s rl(vpnu)teermr3todomD  neol(0t2umxrpoy4omenmnvt s s2taumpot0tptn i3ilt a2raump (4treoircoytlmte ues t0t2um(opoo4aptelivi t  Drmump;o0tlenmoctlsls2emn pnt) renmf tatfa r ivs () 2uoxr iy1lp n fetat) 2raumpno1tptn i3iltfa2uan snu0aeenmr iy1fmt luei;s  2xmio3oy4ol  micslsfa2rm(r ot0ape  fetldls emuvs;(4 leomr ta1optr ivo t0trtoxr3oudopt livtas) 2umx pot4olx  oeias m el( o;t) exnmr totfaDr ieo;( srumir oydape lfcslsfsDumxrp;u1apxnii3iatfm um( onu0 rxnxo3oatlaDe i o;(0 exmxo3oo1opt mnctlsfsrua(m ;u4aex  ieiyslm2umnmo;t4 leriociytlpDr nvs;(0texoxm no1lmtnlnetls)arrr(rpot1apt  fetad m uan s u)trermo oy1lptr ueo s0 euoxm iydomee fvtlt  Drmum ou0opxnmoctadlmDeanmpnt0teermr3tydlpDrlu i t0 2xrxmpiydlpt  nvt sfa2rmxm ou4aetn o3iasls2emnvo;(0tleoiociodlatrln o;s)srtrxrpiu1lptnlivi sfs2rmu  no0aeeomoctatfa umuvpn(4 rtrif ty1laDr uvs s) rxoxo3no4llt  nvtatf 2urur ou4tpto o3iyt m emnvs;u0 rxnxf iydfat aiei;( s2tmim ou1ol nliet s) 2urumpot0openmieildfsDrmnmp () reoxo iydlm eauvs;(0s2tr(o iudap nlivtlsf Draxmoot0tltoii3iltlm2um(msn(4alermocty1fm rln s s0 2tmxrpno4llt miesl( srraxr ;t1tpt mfciytlm2umumo u0teeoxrcto1opD  neo (0sexmiopno1oltnlivtatfsDrmum oo4opeo f3iyt m2ranms;u)tlenxf iadlat ai o t0tetoim iu1oltn feil()sruaumpoo0oeeoioeiat m2ulnvo;t4aeenxo3ootlmt lueilt) eumimpnodomt  nes t arrru pot1tpxo iciyd a elums u0tlenmr3tatomteliei s truoir ou4lpenmies t arta(mo;t1apxomietydfm2ulump t)aexoir3totlaD lueo s)s2xoiopoydolte nvsltf Dtaxrono1alxnmfciysfs emnvp t4texoxr oy1lat lneol(0trxriopiu4am  mncs tfs2urumonu1aleo o3tad a2rmnmpn(0trxrio iodfm rli il(  rto(opiudamtnlnviat srtmx  nu4tee  i3tlsfs ulums (0aetniocoa1lpt  nvils s2trio oy4llt livsltfsrum(rpoo1apxnif3tatla2rmnvp (4aeenif3iadlmteau il( seur(r3oy1om  lnvtls)arumumpnu1aeen oeildlaDrmump u0trenircio1lpteauvols0t2xo(mpnu1lpee fvsa(fsruaxmpoo4olxo ociasla rm(mp (0tltoio oadlmDr i ils)trtmxo3nu1aptelivsls  Durxr ;u0oetn icildfs rau s;() lerxo3oatop rai sl(0setmim oo1apt lietas)a2trxro;o4opto oetadlmDrau s t0areoxr3iotla e nvi;t)s2tm(rpnu4omt lnvt s a2rr( pot0tex  ieiltlmDrauvonu4trxoiocoodfmDr ieilt)trxo(r io1al nmivia(fsrtm(mpnu0alxn ocias a2ea( pnu) ltnmr iatfa eli ilt  rtoiopno1ll elicils)artmxmoot4tpx moeiyt m2rmnms u)alerif oodom ranvo t0srtoxo3nu4al emicsl() rraxro;t0ole ioeiydlm2uau o u) exnxo io1opt  i slt)trumxo iodlptelnciat aDtm( o;t0tlx iiciyd a2um( pnt0 eerifctatlmte u i t s2xo(m iodamtemfcias)sDur( oot0tpenmf3tydfm2ra(vsnt4 lerir tydfpt aues s texmxopiu1ameemies t sDumxrpoo4openifeiad s2em(vo (4altnmo oo1fmt  n i;s0setoxr iu4apt  fcs ()aDtax  ou1alxniocilslsDulnms;u)tltrmo ootfmtr uei t t2uo(mpnu4lme mfvt s  2ur(rpou4alen f3tatfm2rmuvonu)artrxfctotfpDraivs;t0sexrxr3iudamt  nvsat) rum(mpnu1aleo feiysla2ulumsnt)aexoxf3iadomt  nvo t0srtm(o3nudaptnmfvtls)aDtr(r ;u1oet  fcils a2uan s t4tlxoio iadlmD  ieolt)s2urio3oy4ap  mictatf rraxm nu1alt  oeilt m ulnvon(4tetnxo tytfpD  iei s  etm(opnu1am  mies tf Dtaxrp;u1oeenmietlsfs2ra( o t) lxnxo iydlpD anes s0 exoim3oy1ol n feslt aruru onu4tltn ociatfa2elnms u0 ltrio iy1op rluvs;t0 rxo(r3iu4om nmfvsl() rrru pnu0teen i3iaslm ul(mo t4 renxo3iytfatr u i;t) 2xmxm io1aptnmivi tfs2taur ;u4tpen iciatla ulu p t0aexoio3tydopte nei;t) etmim3ou1apeemfeiasfarum( pno0aleo o3iyt s umumpnu) reoifctytlp  anvi;t0sruoim3iydapt  nct ()srrr( o;t0opeo ociyt s elu o;u4trenifcoa1faD  i sls)t2tmim3iu4optn nvs t  rrmum nu1ope  o3tyd m ea( pnu4alermf3iodlmt  ivs (0setr(rpnu1llteliciasf Draum ;o1altoifctyd m2uau onu)trtrxo3oa1fmDr nvs (0trxmirpoydap nlici s arrmum nt4apt if3iyd aDeanmp ()trtoioctotfpt lueil() rum(r io1lpeelictat)s2um(  no1teeniociydfm2rmumpn(0 exnxrcoytoatr nes;s tetm(o nu4amtemncsa()s2rr(mo;u0oet  iciytls2emn p ()tetomr iodfat  ivs;s srumio iodolt  ivi tf rrrur nu0apxomiciad mDrl(vont4 rtrirctadomt  nvo s) ruoxrpiu4amt mfcsas  Drmxrooo1apxnmo3iyd m2eluvpn(4artoio3oytlmteaueols)t2xo(mpiu4altelivsl()srrm(r oo0aleomfciyslsDum(vs;(0aexomrcoodopt lnei (  exr(r3nu4lp elfvtlsfaDrrurpnt4oex ifeiaslmDran snu)aleoircootoptrlneo;() exmim3oudamen ivi t  Dra(m ;o4tltoio3tls mDelnvs u4teermociotomt anvols0 2trxm oo4omt mfvsatfarumu oou0ole ioeilslm2ulnmpnt0teerio3totopD aues t  rxo(o oydop e netas aruaumo;t4tpt  fctasfa emnms;t4altrif3ootom rlu il(0srxmxopiydalte fesa( aDtr(m nu0ole  f3tlt a2eauvo;(0 renxr3iatoaD  n ilt0t2uoxm no4optemivsatfsrrruronu4tetnii3ils m el(von(4aetomr oa1fptrlueo;t0trxrxm oo1alenmnctl(fsDtrurp;t4aleomfeild aDum( p u0tetrxocio1oaDe ivo;s)trtrxopiy1lmeemnvi t) Drau pot1tpeo f3ildlm rmn ont)altrxo3oytfmDe i o t0s2trio oy1ol  mictat) 2rm(ronu1tlxo f3ildfs2uan o t4arerio oodomDelivs;() eur(mpiy1om  mnet sf ruaumpou0alxomoctltfa2elnms;t0 rxnxrcoy1oa r ivilt srtoimpiy4lpee fvt tf Dtrx ooo1ole mieiysls2emumo;t) rxnxr3oytop rau o s)trtrxm iydap  mfvil(  Drm(  ;o4aeto o3ildfm2em(vo t4teeoxf3ia1oa eau slt0srxr(m iu4lm elnesl(faDtr( ont1alen o3iltlm2uanvpn(4 ltoxo3iytfat aieo;t0trtoxmpoydlm n fvs s arur(mo;u4opxoiociydfmDulumon()aeerxr iotomDr nvilt  2umxo3io1om emieilt) 2um( p;t4tpxomi3ilt sDul( pnu4tlxoxr iatlpD aiei;(0teum(opno4ol n nviatf rrau  ;o1aee  fetad s2rmnvo;u4tleoxf iodlmtr ieilt0s2uoxr iy4lm  mici t)aDurxrpnt1optomieiadfa rlnvs;u0arerxo3oodlmt aiesls0tetmxm3oudlp nlivslsfarurumono1ole mictatfm2rm(vs (4aeeomf ta1fpte uvs ( t2xo(r oo1ale lfesasfsDtau poo0apxo o3iasfm2ul( o u4arenmr iadom raivs s0 eum(rpno4am nmfctat  Dumx o;u1opeomi3iytlm2rm( snu) rxomrctadlaDr iei;t)trto(opiu4ll elfvils)sDraxrpnu0aptoiocildls2raums;(4aetomf3ty1fat aies;s0t2toxo ny4op  mivi ()srumxm ;o4tex ifetydlaDemu s t0tlxnxrciatlaDeaneo s0t2xmimpiu1ol  mncsls  ruaxm ;t0tetn iciadlm2ulumpn(0aetoio3ta1fp r u i () 2uoir3no4llee fvi t)a2umx  ;t0aleniociadla ean pn() rxnir ta1op r neo s sexo(r oodap n ivtas artmx  nt4tlto i3ils m rm( p;u)tleoxo3oa1op  aues s0sruo(mpiy4aleemivi s) rur(r ;u4tlt ioetys a rauvsn(4alxomo oo1lmte i o;t sexrir3io4al nmnetas sDtmumpnt4oexn iciat a2el(vo;t)texoxf3ootopt  i s () rxoxm ny1lpe lnctat sDtrur ;u1teen o3iydlm2umu o;u4 exomf tytoa e u ol()t2toio3iudom nliesl( arraum ;u0aeeomfctat s2elnmo (4tlxomf3oo1lm r uesl()srurxmpoodome lncta() rrrxroot1oeeo ictltls2eln snt0aetomr tadop e i ols0srto(r iydomtelfeias)s2umxrp;u0aex  f3ildfsDeauvsnu4teeoifctotoa e n ol(  2tm(m ou1lpeemfesa() Dtru pnu1tptniiciytlaDemn p t0alxrxo3tytfpte ivs t0truoxmpiydlpe  ncs ()srumu  nu4apeomociaslsDel(mp () etrxfcoytlaDeluvils)t2trir nodopt  ncs tf rur(mpno1optnmieildfs2umnmp t)tltrifctydfaD  nvsl( texrim io1omtnlici ( srrmu pou4oee mfciytls ua(vp;(0altnmf tatop ean o ( srumxo oy1open nvsasf 2ta(ronu1apxnifeilt a ulnmsnt0altnxocoy1latrai i;s0 rxo(mpou1ll emfvi tf rraxr ou0openmf3tydfmDeln p;u4areoxf3oy1fmDr n o;s setoxrpou1lleemfetl( arurx ont0aex mfcildls raumonu4trxnxr ty1oate nvils srxm(m3iy1ap e ncil(fs2rmxmooo4oltomietaslm2eauvo;(4arxrmrcoy1la elnvs;s0trur(m3no4ape  fetlt)srrm(mono0tee iicilsfa2em(mpnt0teenir oy1lptrln i;(0 etoimpoydaptn ivt sfa2rr(r oo4opxniiciasfaDulnvs;t) rtrif oydfa raivols teuoxm oo1om  mfvt t) Dtm( pot0tlxoifciyslm rauvsnu0texrif oy1fate nvol() exrio no4lpenmfvt s a2tmuro;u0oee mictytlm umums t)altrmr3iadopDelueilt0s2xr(rpou4op elict () Drmxroou0tpxo oeiad sDrau p;t)aeeomf ta1lp rlivi;t  rtm(r ny4llenmict s srtax  ;t1alt ioctadla rauvo ()tltnxfctadfmD  nei t) rumxmpiydapte fvi t)aDur(m no1opt mieiatls rln s t)tetnmo3tytlpDrai o t srtm(m oodam   fvt t a2umxmooo4tet  oetaslmDrau onu4arerxr tytfm  au ilt  2xoirpny4lm   fvtatf Dtaumont1tpenmictyd a2ranvs;t0 rtomo ty1lm r ieo t setmxr3ny4llenmnvt (fa2uaxmonu4oltn ietyd s ulumpnt0aeerxf oy1fat  ues;(0setmio3iu1oltn fcs (fsDraur oo1olx mociadfa2eln o;t)tltomfcta1fmte n s;s)trtrirpny1op  lnvsas)sDtmx oou4openiictasfmDulump u4trxnxf oadlpDrli sl(0t2xoxopny1llenmiet s) rua(mooo1tetnifetlt a2uanmp t)trxrxo3tadfp e n sls  exr(rpiy4lmtnlfvsls aDurur ou0oeenmiciltfs2rluvo u0 rtoxo3ootfmDe u olt)truoim3ny1llee ieiat)arrrx  nu1ole mo3iltfaDumnmp;t0 lxnif3ootoaDraueo;s)setm(mpoo4amtemfesa()sDurxr oo0tpxomf3ild a2eau pnu0tetrmfcoa1fpteanvs;t)truoirpou4altelfctlt)s2tmxrpou4aeto i3tad s2rau s u) exrmo3ia1lp  li i;()trtr(o3ou4lmt liet (fartr(rpoo0alt  ociadlm eanms t4aetnio3oo1lm   ivo;s) 2urimpny4al e nvta() Duaxront1oee mfciasfsDel(vp (4 exnio3oy1fmtr neo;(0s2uo(r oudlme  nvt sfarrr( pnu0oleoifeilsfa elnvo u0tetoxf3tydop  anvs s)texm(o nu4ol  mnvta(  Duru oot0aleo o3ildlsDel(monu0altnxociytfaD ai o ()s2uoxrpiu1am e ivs t)sDraur ;u1aeenmfctlsla uanmp;u)alermf io1oaDe n o;s) 2to(opiu4ap e ics s  2trx pno4texomfeiyd aDeau o;t) ltrmr3oa1op r u il()t2to(r iu4lmenmnciltfsrumxmooo0tlx mfciyslm2ra(vsnt4tltrif3tytlp  ln i t)s2xr(o iy4lmt mieta(  rrm(mpno4ape  fciysfm eanvont) rtnxr3ta1fptrli o s0s2uoimpio4op e fci s)s2taurpot0tpto f3ilsfs ran p (0treoiocoatfaDeauvs () rtoim3io4altnliviat sDtax o;t4tpxn i3iytla um(mp (4 etoxo3tydoptran ol( s2xrirpny1lm nlivta(f Dua( o;t0aexnmoetydfm2um(mp;() eenifcoa1oaDrln i ()tetrxmpoodolen fvi ()srumxmpnt0oleoioeiasfm uanms t0altnxf3iytomD aiei t0truriopou1lp e ivsa(f 2tmu ono1aptnmoeiatla2ra(ms (4 rxnxr3tadlm eluesls srurxopoo1lpt lnctat) rrau p;o1texnmfetatlsDrlu p;(0 rtoirctotoaDe nvi;() 2uoio nudlmeelnvs t)aruaxm no0apx io3iltfaDuanvpn()arxomf ty1fpD au ilt s2tm(r iydopt  fesatf rtrxm nt0aet  ieiytfmDulnvo u) lxriociytfaD  neo;s0t2umxm nudap elfeiat s2ta(root4ope mi3tls aDrauvs u4aetnxocoo1omtrlivslt) 2tmir oo1ll n fctlt s2umum ;t1alxnmf3iatlm ua( pn(4 rtomociytoptran ils) exrio3oy1lmeelfctl() Dum(m ot4tetnmfciasfs2el(vp;()arenmocoydfatr neo;t) rtoirpou4ameelict t aDtrx onu1apxn f3tad m ulnvs;(0trxrxr3oy1oat ai o;t) euoxm3iydopte iet (  2umx  nu1tetnifetltlaDranvs () eeriociatfa ran i;s) 2xo(r iodope  fctltfsDrm(mono0oetoioetydfa umu s;(4 eeomfctytlmDeln sls)trxmxr oudapt mfvia( a2ua( ono1apenii3iat a umu o;t4aexrif3iadoaDr ivo;t  rtmxm nodol emnvsltfartr(r no1aeeomi3iatlm2raums;u4areomo3iadlaDeauvo ( srxrxo3ou1lme mfct tfarrrx  nu1aex iictytlm2rm(vs t4alerxf ootom elnvo (0s2urxo iu4amt  fct (fsrtm(mpot0opt  ocilt mDean o u4 renir iydfpDr i slt s2toxo3nydllt lnvsls)a2tr(rpot0olt  feilsls um(mo;(4tleomr3oytopte i slt setrir oodalt  fes (  Drrx  ;t0aeenifcilsfs2ean pn()teeoifctodoatr n s s0truoim ou1ope lfci ( a2tau  ;o1tpxnioeiys a2em(mpn()aexnif3ty1lmDrlu i;s)srtmxrpio1om n ncils)sDurx  no0texomociyt s2emuvp () eerxf3iodopDe n s s0teumxm3oodlme mncs sf Dtau  ;t4oltoiicildla eaumo;u4aexoxf oo1lmDrlneo s teur(mpnu4aptn nctasfs2rrxr ;o0olenmieildlsDrmu pnu0arxoifcta1oa  luei;s0 euriopiu4om e nvslt)arrrxrpot0tpe  fciytla rmnvsn()aeerxociytfmt ln i;s)srtmxrpou4apee ieslt s2trxmono4alx  fetltlsDemu o u4 etrif3iy1omD lu i s)trxr(r3oo1optelfctls)srtm(r ot4ope iiciltfs umump;u0 rxnio todopD lies;s  exmxr ou1omtelnctl(f 2rrx  ;u0texo f3tlsfm2eauvsnu)arenmo totomDelueol() 2uoxm iy4al n iesas) Drr(r oo4oexnifeiydfaDumu o t4tltrmrciytomDr ues;(0 euoxopio1altn fcias)aruaxr ;u1apx  o3iasfm2ua(mp ()texrxf3iatoatelieol()teumxo3iudopee feilt) rta(r nt4aptn fciyslm2ulumo (4artoxr3ia1opD lu o s0 2toxm3oo1al e fesltf 2tm( pnu0aeto ieiyt sDeaumo t)artomr oadoaDe u s ( trurxo3nydlltemnvi (fsrumxmooo1olt io3iltfm2ul(ms;t4 rermo iy1fpDeaivo;t0 exrim3nodlmee ics ()aDtruronu0opxo feiysls elumo;t)teeoirctotfpD  ivolt) eumir3iy4ameemieilt  2tmxmooo4ape  o3iad mDra(vpnu0aeermo3io1lmDraneil(0 2um(r oo1ape lfvils)srurxmpnu0tex iictysfm2rln on(0trtrxo3oytfm rau ols  2urir3oodol  mici sf Durxrp;o1tlen ociys s2eanmp;u4arxrmr3oodopDe u s;( tetmxopno1ll nmncias sDrmxrp;t1tetnif3iasfa2rmnms;u)texnxr oo1oat livolt  exr(rpiydlptemietlsfs2ua(rp;u0oeeoio3tasfaDum(ms u0aetoif todfpt  ieo;s  etm(o3oy4lpeelfet s)s2raumo;o4tlen ieiyt aDelnvp u0 rxoif3iydom  aivs;s trxm(mpiudlpe mneslt  Drmump;o4tee  fetldlaDra(vs (0aeenifcoo1faD  u s t0tetr(r3iudam  lfctasfarrmxm nu4oeeoii3ils a eaumpnt0alxrif oytopt  n ils texrirpoydllt lfcs s aDtrumpno0tpt  i3iasls2rln s () etrmo iotlp   uvi () rxmir3oodomen fei sfarrmx  ;u0texomietlsla rmnvo u)trxoio ta1lmDrai il()t2xrio oy4lptnmfvi s sDumurpoo4opeoif3iydfmDelumo u4aexnxf tadla  ai i;s texrxo3oodap  mivtat a2rax onu4aet  iciaslmDrmn on()arenxo iytlp  livi ( trxoxrpiu4amenmivt s)srra( p;o4oeeo iciasfsDra(vonu0alenxf3oytfaD  n s;( t2toxrpno1ap n fvsas) Dra(mp;t4tpx micilsls rmnms (4 ltrifcoytomD ln i;t) rxm(opoydom nmicsa() Dumu p;u1teenmicild aDeaumonu0trtoif iydfm eau o t  etoiopny1ol emnes tfsDurxrpno0optnii3iyt sDrmumpnt4 lxomr3iotomtr u ilt)srxmim oo1llt mivil( srrax o;u4olxo o3iys m rlu pnt4 lxoxf tytlptrai s;t) ruoiopno4omenmivils s2urump;t0aee ioeiadlm2rlumo u4 lxnir3ootopDeauvi;s0srur(o oy1olt  nes t sruax o;o0alxo ociysfaDuan o;(4trxoxrcoydfpD  uesl(0teurim3ou4al nlnet ()sDum(m ;t4texo fctasfa2emuvo;(0 exnmf io1faD  nvs t teto(m nydaltemnvs s aDtm(mpnu1oetnifcils mDua(mo;u)texnxrcootop  livs;( t2xo(m3io4lleemncsatfsrrau o;u0oltomoctlsfs2ul( p u) rxrxr io1lp  lnvo t s2uo(m iodlpe lictls)sDra(rpou4texn i3iyt sDel(mpnu0 rxoxfcoa1opte n i;s0 2uoir3iu1ole lnvsls  2uax pnt1aet if3tltfm eln s;t0tlxnxo3oadfmD au i;t0s2xmxopio4op emfvil()a2taurooo4alto ocias mDrlu s (4aeeomf3iodlatelivolt0srumxr3oodlm elnviat a2ur(mont0oex mf3ilslsDeluvsnu4 ltnxf3totfpt  nes;s0s2to(r3no1ol nlics t)srtaurpno4tpe iicils sDemn p ()arxrxo3oo1fmt lueol( trtm(o ny1apt mfes s) rua(r ou4apen ociydlmDrlnmp t0trtnxo3iadlmDr uei t srurxmpiy1op  lncs t) Dumu p;o1apx mfeiyd m2rlu p;(4 exrxo3oydlmD ln slt) rxrxr3no4apen ictlsfartrx onu0olenii3iat mDrlnmsnu) ltniocoo1lmtrlivo;s s2urxrpoy4ap  mictls)a2umur ;o1tlto o3tld m ran on(0 rxrioctadfaDrluvslt0t2xrir ou1apt mivtls sDtrx  no4oeeo o3iltlmDrlnmo;u4trtrxo tatfptean ol(0 rtoirpnodalenlivt t)srrr(m nt4aex  icilsfaDuluvs;t) rxrxfcoo1lpteli o;t0 2to(r ny1lle  feilt)s2ra(r nu4aeeo f3ias s2umuvp u0trxnir3tytfm  ai olt0 etm(m ny1ap elnes s)sDrr(rpnu0apt moctls m2elu snu) rxrmo3iodfpDr ueol()t2uoiopnodam e ieslt srtrxronu0optn ociydfm2ra(mpn(0tlerxocoy1lp rln s;s)sexoim nydll elieil(fs2um(moot1tleomiciatfa rln p;(0 exoir ta1omt lneo t0t2uoxr3nu4amee ivt tfaDurur ;o1oltnmfcias mDea(vs t)tltnxo3iatomtr ivs;s)srxmim3oy4ap e fvi ( s2uaxrono1teeomieiydlmDrm(ms t) rermrciadlmDeaivsl(0 eumirpio4olt lnvt t a2trxr ;u4ope  iciyt a ean on()arenio tatlaD lneol(0 2trxopny4am e ncs ()sDuax  nu4tlt  o3iyd a2rmu s (4tetoif3oydlat luei;s0srurim3nydlm nlfcia()artmxmont1aexn o3iltfa2el(vo u0arenxocia1lat lueil(0s2xr(mpnudlpee fei (fsrurx ont4tlx ifetad s ranvs;(0artoif3oa1fm  lu s ( tetr(rpou1lltnmivi ( sDumxm oo4tlxnmietld sDeanmsnt) lxomr tatfa r iei t0 2trim3iu4aleemicslt)artrx oot0oleniociytfs elnvon(4aeenxf3oo1om e iei;s  exmxm3iy4am   nvs s arrrx  ot1apxomietytfsDum(vs () lxnir oo1lmtrln o (0setoxmpoo4lmtemiesas)sDuaxrpot0opt mieiydfa rauvon()aetnio3ta1fmtrlu s s s2urio3oo4lme  fvsatf Draur ;t1opx  o3iasls ea( o;(4tlxnif oadom elueo (  2toio3iu1ale  neslt)sDur(mo;u4tlenioctytfa2umn o t)trxrio tydlp rlies;(  rxmio3ou4op elncsl(  Dtm(r nu1ape  o3tlt aDeluvs;t0tlxrxfctodopD aies;s t2tmxm iudlpt  ivt sfsrrru o;u1opt  ieiatla ran p;u)arenxocoatoptrlnvsls)tetmir3ou1lptemfei t)sDumuroou4tle mfeiys mDumnms u0treoxocoa1fmtrln i;()s2trim3io1ameemfet t srtrxr ;u4opxomieilt mDean s (0arxnxo tadom   n s s) rurxm no4amtelnvt ()sDtrxmp;u4oeto f3tls a2ranmp (4 eenxf3tydlmtr nvo;t)trtmxm3oodape lncilt  2trxm ;u4olxoiietad m2ua( s t0 lxnxf oa1la r nei;( texo(o iudlptnlnci s)srtaumont0aptomoeildla ulumo u0alxoircoy1fpte i i t  ruo(rpoo1olenlfvsl(f rraumo;t1aptomfeiydfa2umnvp;t) eeoif iotfp  lues s)texo(r iy4lmeelfcs t)s2uru p;t1optnmf3tldlaDra( pnt4 rxrxf3to1oaDe u s;s0t2xrxrpiy1al n iei s)sDtaumooo4tle  fctys a2rlnmpnt0trxomf oo1laDe u sls)trtoio3no1lmtelnvt sf rrrur ot1aet mf3iadla2ua(ms;(0arxnxoctydlmte ivs t s2trirpoydame  iciatfa2um(mp;o0oltnmoeiytla2eluvs;u)alerxf oadlm rln s;s)texrxr3iudam  mfcsl()arurur nt0aeto ieiyslm emuvp;u0arxrmo iatopD li slt0trumxmpiydamte ivias  2rr(root4tex mfetltfa eanvo u4aetnmf tytlaDeaivslt0s2xoxopny1am n feta() Drrxrpno1alx if3iyd mDrm( o (0arerif io1oaDeluei s) rxmxm no4ape  ivsa()srua(root4ape iociytfm umuvo (0aeerxf io1opDe u o s0seto(o iu4omenmnet ( a2rmxm ;o1oltn fctaslm2rmuvonu)altnmfcia1la  ln ols)srtr(o3iu4ol nmicslsfsDrm( pou1tpxn octydfa2rln sn(4tlxnmo3iatfat  ies ()tetm(o3iy1apt mivtlt aDumxmpnt1alxo feilslmDumnvs (0altnxf tydfpt  uei s  ruoir3oy4lm nlivil()a2rm(ro;o1tpt mictyd m2ul( p;t4arenmf oodlptranvols seurxrpoodopt mneia(f 2rm( oot1oet  i3iadla uln on(4tetnxocoydfptelneol(0srtrirpiy1ll  miviat s2tr(moou0opeomo3tytfs2rmnmsn(0 lxrxf iotfmtelues;t s2trim3io4amt lfvs ( sDurxroot0oex mo3ildlm2eauvp (0trtoxo3to1lpteaies t) etm(m nudapeemivsls) 2rmurp;o4tee mfciadfs2el( p;t4tlerxo oo1omDelnes t srtr(mpoudope mfvt t sDuauront1ale if3iysfm elumon()tlxrif ty1la  lu s;(  2xoio3oy1amenmfvtas artaxmpnu4alen octlsfs em( snt0 exrxf3tytlaD  ueols  2urimpiydamtnliet s sDrm( ooo1teenmo3iys s2ul(mo;t0texoir iodomtean o;t)sexoxr oy4omtemncslsfa2umxmono0apxoioeiadlm ra(vp;(0trtrio oadoat aivol()srtmxopoodlm nlfesat  rrr(  no4olenioctyd m uanvp;t0treoircta1omtrln o s srxmxmpiu1amtelictlsfs2tmxrpnt4alxo fetydfmDeanvs u4treoxfciatfpDr i sl( s2xmiopny4ome  fei t arurx pnu4aeeomieiyd a2rmnvsnt4artnxrcto1lmtrli i ()seto(opiydomee neta() Dtrxrp;t4tpeoioeilt a ranvs u4teeoif3iy1lm elues;s0trurxm3oy1opt  ictlsfaDur(rpot4tptomfeils a2uaumo;t)trenif3io1fm e i ols  exoio io1altnmfctls aDtau  ;o0aet mo3iysfm2um(ms;u4trxrxr3iatlp ranvi t sexm(rpoy1opt lfvsl( s2ra(m ;u1aexn fciatls elnmpnu) leoxrcoa1fa elueolt0 2xo(o oo4lm  livsls) rraxm ou4tlenmf3iyt a2rln s;(4 rtrmr tatop rai o t)seumir3iodll elfvtl(faDuaxr ;u1texniietyt aDrlu onu0arenmfciytfa  au s;t)s2tmxo3ou4lptn iet t sDtmu  ;o4openioetlsfm2rauvp;u)alxoxf iatfp eluvo;(0trtm(mpiydlpte ncsatf 2rrx p;u4aee mietldfa rlumpnu4 etnmfctodoptr uvi;s)t2xrirpoy4ll   ieiatfa2uau  oo4oex ii3iadlmDumn s;u4tetrxf ta1fa rau o t) etoxr3iu4omtnlictl(  rtm(  no1tetnmi3ild a2eaump;(0tetnio oo1lp  livs;()seuoxopiydlptelnvsasfsrrau pou4aee io3iltfsDea( ont4aeermf tatomte uvs;( sexoxo ou4ale lict t a2rm(  nu0tpto ocildfm uln p t0 rxoif3iodlm  livs;( tetmir iu4opeemfetlt  2rmu  ot0aleomociydlsDeanvp (0tetnxf3ootlmte i o;s teuoxm iudal e nesl(f Drau onu1tlxnmieiadlmDra(mp;u0trxnxf3ty1oate ieil( t2xmirpiudol nmfviasfaDrrxr nu0tlt mieiyd a2elnmonu)tlerio oodlat  uvo t truoirpiudamtelfvilt) Drrx pot4tee  i3tadfm ea( s;t0aetomo tydlmD  ivs t0setoio3oy4ap  mivs sf rrr(m ;u0apxoii3tatla2eaumon(4 eenmo iadfateaieols  rxrxopou4ome mici () 2rmurooo1olxn fciydla rmnms;u)aetnmf3tatfpDr ies;s0teurir iy4omenlnet (fa2ra(rp;t4olenmi3iytfaDrmumsnu4 exnif3iodomD ai o t0 rxmio3oo4olee feils  ruaum oo0tlxo i3ild aDeauvpnu4tltnmr tytlp eaues s)s2xmxm iodom emfei t a2rau p;u4oetomieilt a ranvp t4 ltnxociotlm rai sls setmio iy4ameelfei t aDumx  ;o1apxo fciydfmDemnvpnu)aexnmrciodop elieol()s2uoxm3iy1ll e ncsat)aDtmxm ;o1oetnioeiyt m2emumpnt4 etriocio1lmDrlnes s)setm(m io1llen nvi s s2tru  nt4alxnmfeiyslm2um( o t4altoif3iadfaD aues s s2xmxrpou4am emfetatfsDua(m no1oeenio3iytfm2um(mo t4 lerif ty1om rlnvi t s2xrxm iudam  mfctls artaum oo0open iciysfsDum(vsn()aetoxo3iydopDe ies;t0srtrim nodlpenmnctl(  rtaxmont0texnmfciasfm2eau s;u4 lenxo to1om e ies;s srtm(m iodapenmictl(  rtm(moot1ale mfetat s uluvs;()tlxrirciodlaDelieil(  2xmxo3oo4al emivs sfaDrmu  nu0tpx miciatfa emnvsn(4texrir3ootlmt aivsl(0texm(opiodame lnes tfs2ururp;u1tleoiiciatfm rl(vo;() etoif3oo1faDrln i s0seuriopiudllenmiesat)s2rax pnt4tee iociad m2rmumsnu4artrxo3ootlpt lnvs;( trum(r3oy1lm nmncsatfsrua(  oo1tltoiociyslsDum( snt)artomf3ootfa  an o t)s2tmir no4ll emnvt () Duax ont0apenmiciltlm umuvs u)trxnio3todlm e u i;( tetmir oudom   fvtl(faDrrx  ou1alenif3iydla ranms t)aexnifciadfaDrlivs t)seumxr3io4lpenmfeils s2tru poo1olx iocildlm emu p (0texnmf iadfmDrlu o;(0 etrxm iydamtemfei (fs2tax  nt4opxomi3iytfa2emnmon(4treomf iytlp  ai i;t t2xmim no1amte fct sf ruax  nt0oee mfctat aDuauvp;t0treoxf oa1fa rai i;s0tetrimpiy1amt  ivi tfarum(rpno0oeeomo3ildfs elu pn(0 ltoif3tytla  lueols) rtoxmpoo1lmtelnetat s2tr(ro;t1apen f3iytlm2eanmp u0tltnioctadlptelivs t0texmirpiy4am elfct t sruau  ot4aptnio3iyt a elnvp u)aeeomf3iydopD  ivs t setr(mpoy4amt mfcta( sDrauroou1tpeo ociat a2emnvs;t4tltrxfcia1opDr uvsls  euoxr3nodlle micia(fa2um( pno4oexn ictasfa rl(mo;t)trxrxf iotfat ai il(0 exoxr3ny1ope  ncsl() Drm(rp;o4teenmo3ias mDulumon(0 etrmo3ia1fm eli s s0t2xmxm nu1ll  mncsl(fsrtmurono4tleo o3iadfaDum(vsnt4treoir oodfmte uvols)trtr(opno1lmtemfcta(fsrurx  nt0oleomfctys m eanmp;u)tlermociytfpte ivo;s seto(mpno4op n neias)a2umxmpnu1tet  o3iys a2rl( s;u)aetnxr3ty1laDe nvo (  exrxo ny4alt  ietl()s2trxront0aexo fciasfa2emn s (4 renmr3totlatran s s0 2xoxm ny1lp  lnetlt  Duaxrpnu4texn ietys sDra(mo t) exrmr3oy1oatrluei s) eur(o3nudole livt t)aDrm(mo;u4opxomociatla uln s;u0 rxnxf3tadfa e ieils0 2xm(r oydlm emneia(  2urx pnu1ope  o3iytlmDumuvs;()aetnmrcio1oaDr nes t0 rur(o oo4amtnmfvil()arra(m ;o4tle ioeiltla2uanvsnu4 eenxo3ootom rlnes (0 2toir3oodopt lfcslt) 2ur(r nu4tpxoiicilsfm ea( s (0texrmoctodlmDe neolt texmir io4op e iesa( arrr(rpoo0aexo fctatfm ea(mpnt4aeeoio ty1om r u slt teurim oy4apt mics tf rrrumonu0tex  feiyslsDuan s (4 exnir oo1lmt  i ilt) exrxmpoy1ome  fei (faDurxmono1alenmo3tytfm ea(vo;t4aeerif todfateli i;s  ruoim3nodlmt lfcsas  rtru pou0oex mf3iytlsDrauvpnu4aetoir3oodoaDeln o () 2urxo iu1omee ieias) Dtrxmo;u1tlt mieildfm2rl(vsnt4trerio3oytfaD lnvi;()s2ur(o nydamee ieils)arur(m ;t1aetnmictld a2rluvpnu4artrmf3ia1lpt aies;s srxoio ou4lm  mnci s)s2rmurpnu4ale  oeildlaDumnmsn(0alenmo iytomDr ieo;t) exrxo ou4ll  mnvs (fa2um( ono0tle ioeiadla rmn s (0tltrmfctadom e n il() 2urxo3io4altnmivt t)srra(mo;t4tpeoiiciytlaDean onu4 eerxf3tadfat  nvils) etr(o oo1ale lieta() Dtrxr nu0apx  fetlsla2um(mont)trtoxf3ootlpD  ivi ( srur(mpnudapt mncia(f rtmuroou4texomfciyslsDel( on(4aeenio ootfm e ues;t s2tmim iudolt mfvs () 2taxront0teenmo3iadla2ua( pn()altnif oadfmtelu olt0t2um(r ny1al   neilsf Draumoot1tpe  octysls ul( o;u0arenircia1fat an o;s t2toxo3iodapee feta(f Drmx o;t0tleo f3tyslsDeaumo t)arermfcoytfaD  neol()sexr(rpoo1apenlnvsl(faDrm(mo;t1oex mi3iad s uluvpnt4aexrmfcto1lmDrlnvsls0s2trir3oo1alen nvs s  rrm( ono1tpx  i3ils m2umumon(4aeerxfciadfmte ivs;t0t2umir oodomenmfeiat) 2rmxmoot0alen f3tytls ua(vsnt4alxnif3oo1lptrai sls0tetrim iudal  micsl()aDua(  ;t0oeen f3tldlm2ean sn() eenmr tytlatranvs s  eurir ny4om nmfcsasfarra( oou1ope mf3iltls um(vo;u0areoxfcoadlat  u o;s)setmxr3ny1opt mnvi tfs2ur( poo1aeeo i3iytfm2rmu onu4tetnmr oydfptraivs;t) etoio ou1opt mies (faDtrxmpoo4tlxnioeiatfaDeln o u0tlxrir oadfaDr i s t s2xoxr3iydam e nes sfaDtmxrooo1tee if3ilt a uluvs;u)trxoxr to1opDe u o;s sexmxm ny4ole  ivtas arrau  ou4texoiociysfmDuanms;u4 ltrif3oydfm raieol( t2uoxr iu1op   ict t)aDtrurpnu1apxnmi3tlslsDran pnu)areoirciotfp e nvs t0 rxmio3iydop nlncs sf rtm( oou0ole  ociatlaDea(vo (0treomfctotfpDe n il( srurxrpiu4oltnmfvtatfsrtaxrpou4opt ifeiltlm rmumsnt0trxrmr oy1faDrlueo (0seumxm nudal  lneilsfarrm(rpou0oetnif3iydla uaumo;(0teeoir oo1lm eaueil()t2urirpiu4om  lnvta( sDuaxmp;o4tetn iciytlm2ranmp;t4aexrxr ia1lmDeauvs ()t2xrxopou4am  mictlt)a2uaxmpou4apeoifetls a elu sn(0artnxr iydomDraueo (  2toirpnudale  fvtl(fsDuaxrpou0tlxomfeiytlaDemu p u4 ltoif3ia1oatraneo;(0seumir nudapeemiet s a2trx pno1tle iociltfm2ea(mp;t4aetoif iytomDe n olt s2uoimpno4ll  mieias)sDurxm nt4tpxnioeiys s el(vs;(4artoxocoatlmDraies s t2urxr nu1om elivs t sDur(mooo4apeomietas m elnmp;u0 ltomf oo1fpDrlueo s0srtrxo oy4lltemfetl()arrru  oo4oexnifetls m umu snu0arermo3totfmt anei;t0trurir io1llt  iesa()artrx ont0aex  fciltfm2uanmsnt)aeenmf iodlaDr uvol(  ruoir oo4lme mfvtlt arraxr oo4oet  oeilt sDrmu on(0tlxrmo oo1oatean s;s) 2toirpio4optn iet ()sDur(m ;t4aptnifeiad aDum( o;u4altomrciotfaDr n s t0teurxopnydoptnmieiat aDra(  oo4tpx ioeiat s2rmu p;(0teerifctydlat au slt0trxoxm iy4ll nmnesas)a2rr( oou4olxn o3iadfsDua(ms;(4treomf3iotomt livo;() 2urir nudoltnlnei tfs2ta(roou0opx moctltfm2el(mp;() lermo tytfp  au slt)seuoxm io1ap emics s) rrr(rp;u1olt ifciadls umnmsnt0trtrxr oadoate iesl(0 rtr(mpiydlp emivi sf rrrxmooo1tleo ieildfaDemnms ()arxrxo3iy1oaDelivil( seum(o3io1ameemnesatf rtm( onu1tptomoetat a2uan onu4aetnir iydlpt  i ils0t2tm(rpoydoptn nes (fs2rru o;u1aptomo3iatfm2ua( o;(0 exnmoctytoateau s ( srxoxm no4lpeelieta(fsDrm(r ;u4apt iocildfs2rmuvp t)aetomr3tatlpteln s;( t2tm(o3no4ame mics tfsDumxroou0oet if3ildfm uan p;u0 rtnio iydomteaueolt  rxm(m oodale lics t)a2umuroot1aetomo3ildfsDul(mo;t4trxoxf iadlm   uvs;s0t2ur(o3nu1lptn fvta(fs2uaumono0opx  ieiydls rl(mp u0tlerxf oy1oaDeau s s)sexr(opno4lm n ncta()a2umu onu1tptnioeiyd m2emu snu4artrif3oodomtrli s;( texmir3oodol  mfvsa( sDtm(rpnu4opeomoeiatfm2eluvsn()alermf oa1la e nvi;s s2xoxrpnu1omen ivsatf Dtrxr ;o0ale mictld a em( snt0trtrxr oy1omDeluesls  rtr(opou1amt  fcs t  Dtau pot1tex moetlt aDeluvs;u0tlenio3iotfptrlnei ( t2xmxr3io4ol nmfctat) Dua(rpoo0olt moctlsfs2rl(vs;u0arxoif3oatlpt  i s t)t2umxo oy4lm  mnesat)aDum( o;t4texn oetas aDul( o (0aexoircoytoatelivi t)t2toxr3io1olte ivtltf rrauroot1opxomfciadfm2rmuvp t0trtnirctydfmt lues;( trtr(o3nu4llenlnvs s  rua(mpnu4aeto ocildlm rlu s () exoxo tatom   ivo;s0 exr(r ny1ap  mnvslsfarrrxront1ole  feilt aDrmums u0tltoxf tydfp  aivo;s)srto(o nodaptnmfesl( a2urx oot1tex iictydfa uanvpn()texoif totfpD aivo s trum(o oudaleelieia()sDrr(mpot4opxo ociysfmDeanvont4aeenxr oy1faD  iei;t0setm(m iodlmee ncsltfarur( pot0oleoif3ildla2el(vpnu0aeeoxfcia1fpteaieo;s srtmiopiu4lme lnvias)s2umx  nu0alt  fcilslmDelnvsn()teenir3oytlaD  nvi;s)t2ur(rpoy1lp e nvtl(fs2tax  ;u0apto ociatlm ulnvp;u4aexnioctatfp   i ols) eto(o iy1om emfvs s)sDuru  nu4ale iictytls2umnms;u)aeerioctadoaD lnvs;t) rto(mpnydalenmfetl() 2tmxr no0alx moetat sDrmuvo;u0 ltnifciodlm ean s;(  2umxr3ny4ome mnvtatfarta(r ot0oex mictlt s2ulnmp u) lenxf3ty1fa elnvs s0t2xrimpnodlpenmnctat arrr(  oo0aee  octasfs uan s (4 lxrif3iy1fm r u o s)trxo(m3io1ole  nesl(farrm(mont1alxoii3iasfsDemump;u)tetoxr io1lpDr u s;() eur(rpoydom  mnciat srtr(  nu1ole ii3tydlsDelumpnu) lxrxociy1la  anvsl( texrim io4ope  ncia( aDrmx  no4oleoioetytfa ea( s ()tleoxrcoatfa eli i s  euoio oydlpt lfesl(f rraxmo;t0oltomfcildfs eau p u0trxrxf3tytlp r u o;()trxr(m3iu1lm nmfvtatfa2umxr ;o0apxo o3iys a elumpnu4 reoxr tydfp  anvi;(0 2umim3iu4lptemncslt)s2umumpno0alt mocias mDumn p t)arermo ia1om rlues;()trtmxopiy1opt mivi ( s2rru pnt4tetnmf3ild a elnmsnu4tlxnmrciatfm rlu o;(  2to(m oy4oltemneslt sDrmxrpoo4oex  fetldfa em(vp;t) lerifctydlptelnvs;s0setoxrpou4olenmfcia()a2rr(rp;o4teeoii3tysla ulumo;t0alxrio3ia1lm ran o (0t2toxrpoydal emfcil()srta(moot4alx ii3iyslm ua( o;t) lxnmoctatfa r nvs t teuoxopoy4lp elicia(fsDtr(ro;u4olen o3iys sDea(mo;t0texrxo todlmDelnei ( sruo(mpnu4amenmivtlt)a2um(rono4opt  o3iydlsDrmnmo;()aleoxf tatlp  ai s s texo(o3io4ol   nvsasfsrra(root1olt mf3ilslsDulump;(4aeenmf3iodfat  n i s srtr(r3oy1oltnmfcslt sDtmu  oo1teeoiicils m rlums ()tltrmf3oadomDrln i;( trtm(m nu1lpeemivsls a2ra(rpoo1aetniociytla2rmumpnu4 renir iytlat li s (0 eurxm3iydolte nvsasf Dtmu o;t0oeeoioeild m rm(vsnt)alxnxo oy1lmDr u s;s  rtoxmpoo4lp elieiltfaDrru ono0oeto iciltls2rmnmsnu4trtrif3oatlateauei t0tetoxm3iu4alenmivi tfarraumpnu0tpxo feiytla2ulumo;u0aleoif3oa1fp rli ol(  2tmirpno4apeeliciat  2uau o;u0aleoiociad a2eluvs;t) exrxo iotopDe nvolt0 rurxopoo4ap emncs (faDtr(ro;u1tlxo i3tyt a ua( pnt0 rtnxf totlp ranvs s texrxopoy1lptnlncsatfs2rauroou1tle mocilsfsDemuvonu0tetnmf3tydlmDeliei;s trxoio no1op emivsa( a2trxm nu1aexomo3ilt m2em( s;t0arxrif ta1fm elu sls0sexoxm iu1omtnlivslt  2raxmpou4optomoeiadfm eaumo;u0 lerio3ia1oa  au o t)t2uo(r nydopt  ieils  rraxr no1aeto iciatfsDrlnms t4arxnmo oa1fate ueil() 2xm(m3iy1lltemnci t arrrxm ou1tlxomf3iatlmDuanvonu0altomr iytfmDrlnes;s trtrxr3oydlm  miesas) ruru ono0tptoiociat a2eln snu)trtnxf tadfpDr ivsl(  eumio3oo4ole lnvtat)sDrmumoot4aexomo3ilt sDeau pnt4alxrmo todoa  luvslt) euo(mpiu4lmtn fciat)a2tr( oou1tpto icildls ranms u)artoio iatlm   i s s0tetmimpiy4amtnmfetat srrru  oo0aetnmi3tat aDrlumpnu4alxrifciatlaD luvs (  rtrir3ou1al nlietlt s2urumpou0tpxn ociys sDrln pnu)tltnxfciadlmDrau il( teuoxm3oy4lltelfvs ( aDrr(  ou1altniietyd a2ulnms t) eeoifciatopte ivil(  2uoxo ou1lmte ivtas sDrr( o;u0tlxn o3tls aDua( o t4 lenxo iadfa   nes;()teto(m ny4lm elnvi s) rtaxront1aeeomoeiatfsDel(vo;u4 etoxo3todlatr u sl(0srtr(o ou4ope liei ()srumu oou4alt  icils mDrln p (4 ltoir3totom  anvilt)srurxr iudoltnlfvt t sDtmumoot0tle  i3iadfs rlu o;t4 lxomf3iytlpD  i i s)sexr(r3io1amenlncta(fs2ua(r ou0aee ioetasls2em( pn() etrio tadomt an i;s0sexmxr3oudop  lnesa( artrx p;o0oeenifcildfm2ua(monu0 etoxf totopDe nvo;t) 2xmim3nudalt lictl(f 2um( ooo0oeen oetyd m em(msnu0tlermo oodlpt  n s;(0truoxo oydlltemnvt (f 2rrxro;t4tetoiieiasfa ulums t4tlenmrcto1fm  anvi;s srxrim3oy1ll   neiat)srtmum nu1apxniietaslaDemums;t) eenmr3io1fm rluvo (  2xo(o oo4ap n ivt tf rra(r ;u0oeeniociytlm2rluvsn(0alxomf3totfmDeluvil() exmxopoy1ll nlncsltf 2rrx  ;o4opxnmieiydlaDel(ms u4tltoif3to1lmtr uei;s teur(o ny1lp   nvta()artm(mpou1tpeomfciasfm ulump t0 leomf3iy1fpDrlneo t s2xo(opoudamtnlfctlt sDtmum oo4aexomieiytfaDean o u0aexoio iy1lpteluvs t0 rurirpou4om e nvsatfarra(m nu1tpt  iciydls2rauvo () exnxr3tadoa  aieo;t0s2um(r3no1oltemivsat)aDur(rpot0texo i3iyt s2rluvp;u)aetoio oodomt an ols trurxm nu1op n fes ()a2taxmpou0apenmieils a eln o;(4alxnmr3oytoatrlues;t0trtr(m3oy4am  lfvsatf rur(rp;o0texnifeildfs2elu s;t)trenxrcio1lmD lies s)s2urxo3nydoltnmfeiat) Duaurp;t0apx mo3tasfmDeau snt)areoif iy1lmDraieilt0 etmxr io4omt mnctat  Drau  no0oltn ictyt a2ranmsnu) lxnir3oy1lmt  ivilt)trtmxo3no1lltelicsa()artmx ono0tet mfciadla2rmuvs (0altrmf oa1fmDeluvi ( srxoim oy4llenmnes (faDrruroot0tpt mf3tyd aDrlnvsnt0 lxrxr3ia1oa rlneo;(0 rumim3ny4amenmicsas)a2ur( o;u1aptnifctlslmDemn ont0 rerxr3ia1fmtranvsl() eto(r3oydal n ivtasfsDumumpot0tpe iieilt m umums;u)arxoifcto1fm  an o;()tetr(r3no4lmt lies s) rtrxmp;u1tlx mieilsfmDumu s;u)altnio3oodla elnvo t)trxo(mpoo1ll  licia() rta(  ot0apxoifeiytlaDemnmp u0artoxrcta1op elnvo;(0 rxrimpio4lm  lfvsa(faDtax  ;o4tpe  iciyslm2ranvpn(4arxoifciytoa   i o ( srumir3nudom emnvt s)artmx o;t4olen o3iadlm rmnvpn(0aexoxo oatfpDe u sls0s2toxmpny1am elfesasf Dua( o;o0alt ii3tas s2elums u)tleoxo3oo1fa rliei t  etmxm oudam nmneiatfaDrrxr ou4tle  o3iys sDranvp;(4 rxrifciatopDe u ols)sexrxm nu1apenmfeilt  rtm(  ;t1oetoii3tadla elums;(4areoxr3oa1fpD  i s s0trumxo3iudape  iesls sDumumonu1opx  ietyslm rlnmon(4tltrio3ty1latrau ilt)t2toxm3iy4lpe lnei t sDrr( pou4oltn iciad sDelnvon(4tlxoif to1oateluvs;()t2xoxrpnu1op e nvt s  rum( p;t0olenmfcild m2elnmsnt) exrxr3oytfa ran s t tetoirpio1oltelncsas)srraur ;u0aetoif3iasfa rl( o ()tltnifcoo1fpDr nesl( srtoxo no4optemnvt s  rrax  no0tet ifcils s rm( s () lxnir3oo1lmtelues t0t2xo(m3oo4altnmics ( a2rr(ront4teen oeiyt a2rauvpn(4trtoxrcio1omt  ueo ()srxmxo io4alt mnctl(fs2ururpno1oeto ieiydlaDum( s (0 rxoxr3oo1lpt lnei;t setmxo3oudop nlnctlt) Dtax  ot4aee  fcilt a ulumo;()alxrmrcia1oa   uvil() rumxr3nodopeelicil()s2taxmoot1olx  o3iadfsDea(mp t)teenxf ootfm   ivils0 exoiopnu1amenlieiatf 2tmurpno1aexn ociyslm2em(mpnt4tlenxr3to1oat  iei (0t2xoio3oy4lm elies (fs2tmxmpou0tltnioeiytlsDuauvs ()trxrxoctydlmD aiei s trtoim3iydll  lnvi (fsDtmumpoo4oee ifetlt s rlu s (0tlerir3ty1fpDeliei t) rxoxmpiudlmenmfcilt s2tauronu0tlenmo3iatfsDuauvo;(0alxnifcoydoaDr iei s  rxrim no1ol nlicil( artrxr no4opt mi3tad s uauvsn()trtrmfcoa1lmDr n ilt texrimpno1ll elnvia(  rtmx pot4ape mo3tadfs2raums;u4tetnxrciotop r n sls0t2uoxopoo4omte ics sf Dtmx  ou0opx  feiadlm ran o t)tlxriociotlat luvi;t s2xm(rpiudlleemiei s) Drr(mo;o4altnif3iatfsDelu s u4 rxrio3oa1latr n s (0trtr(r ny4ame  fct ( artax p;u1teen f3iasfa2eanvp;(4 rermr oatfptrlu s;(0t2toim iudom e ietlt a2raxr ;o1tltoii3tytlm em(vp (4aleriocoa1omDeluvi;(0teuoir3ny4ale  nvi t)sruax p;o0tpeoif3tytlmDemnvo t4aexnmo3oy1omte uvsls0s2xmir3oy1ll  liesa()aDtax  nu0apx mietlslsDum(vo ()arerxo oadfm   n i t0t2xoiopio4open nvilt  rta(mpot4opxoio3tydfsDrlu s;(0 rxoxrctytlptelues;(0 eumio io4lp nmivtltf rtmur ;t4tlx  fcilslsDum(vo;(4 lxnif3oydom e nvs;t teurxm ny1omeelivsl(fs2ta(mooo0tltn i3iytfsDuanvo ()trtriocoy1fa r ivolt0 2tr(o oudom n neias sDraxmp;t0olto i3tltfsDran p (0aeeomrcoodfm rlies;t)texmxmpiodllt lncs s aDumumont4olxn o3tyd s2uluvp (4 lxoif oatop rlivo (  etoxrpnudap   iesa(fs2rrx  nu1oeeoii3iytfm emums;()teeoxo tytfp eluvsls0srtm(rpoo4omenlnctls arrrxmpoo4tltoifeiatla2emums t0trerif3oo1oa r uvi;(  rur(o oo1lp n ncia( srumxrpnu4aex mociydlaDrmuvo t0trenmfciytlptran ilt)texr(o io1omen fviat) rtrx  ;u0aexnmieiatls eanvsn(0trerxf3oadfpDeln i (  etmxo iu4lptn ietltf Dur(m ;t4texnioeils s uanvo u4aexrmr ta1lm   uvo;(  eumxmpnydaptnmfes () rum(rpnu0alxnmo3iatfaDrlumont0aleomfctydfaD lnvsl() 2urir3ou1ll   net t)s2uax  ot1olx ifctadfs2eln on()trxrxr iy1optrlues s0 rxr(mpiudlptemnciasfa2urxm ;u4olx ifetltla2rl(ms;(0aetnxo ia1lpDrln i s t2xmxmpnodopt livtat)s2uaur ;o4tptnmociysfa emu snt0arerif3ty1fpDean o ()srtm(r iudam  lncsl(fa2rrxmpno1tee ifeild a um( snt) rermr3oytfmtrlnvs;t tetm(rpio1oltnlnvsl(  Drr(m oo4tlxnio3ildfa2eluvsn(0treoxf iadfpt  iei;t)trtmirpoo1op  mfcs sfarrmxmoot1o
\ No newline at end of file
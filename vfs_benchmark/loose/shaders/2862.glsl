@@ -0,0 +1 @@
+iei ( tetoxo oo4lm nmics s  2rau pou4opxoiiciysla emu pn(4 reoxr3tytfpte nvo s0 rur(mpoy1olenlnctlsf Dumxmont0ale mfctysla ra( o;u4aetrmfctotom ean sls0s2xrxrpnodoltelivilsfarrrxrp;t4tpx io3iat m uauvpn(0teerir tydlat lneo;(0 2xoio oydam emnciat)s2taurp;u4oeenioeiydlm uau p;u) eenxr iatlp rlu i s0srum(rpou1altn nciatfaDumxrono4ole  ictas a2uanmo;u) lxnxo3tadfmtr u s s0trxmxmpoy4op e ncsl( sDrm(rpnu4oet  fctat a emuvp u4aexnmocty1omD ai o;t0 rxrio nu4olenlivsasfaDuau  ou1optn o3tysla rln ont) etnmr3oydfmte ues t0 rtoiopiy1al  mnet () rra(r ot0aptomocilt s elumsnt0alxoioctytfmt aneols)sruoim3oydoleemivs s s2umx  ;t0opeomoeiad a rmu s;u0teeoxrcoy1opDraivs;s) rxrxopiudlm emiei t a2rr(  nu1oee mfciyd a2ulu p () rtrxociadfmtraieil()t2xo(r3oydlm e net () 2trum ot0oex iieiadla2ra(msn(4arerxr3to1lmDrai sls  exmim3iudaltelnvsa(fsDum(  ot0aeenio3ilslmDrmu on(4 etnmo3ta1lm  ai o ()t2toxopiudolenlneia(fartmu  oo1olto f3tytfaDeau o;u4aexrmf io1fatraneo ()trurxrpiudop eliesl(fa2uaur no0ope io3ilt a eaums;t)aexomr iodlpt ai i t0trurxr oydamt mivtas)a2tru p;u0tpe iietysls2ranmont) reoxfcoytfpDr ivs ( seur(m3oudop e fvtls) 2tax o;t0tet ioeilsfsDranvo;u4aexoxf totopt  i ils t2umxm iy1am e fvia(fsrrmumpnu1teeniociys mDelu s u4texoif oatoa  aues;s0t2xmio3nu4omen fctlt)a2tmu  ot0apxnmo3iydlm2ra(vs (0 rtrifctytfaD lneils  2umxopnu1alenlivi tfs2rm(m ;o4oeto feiysfa rlu o;u4trxrmo iodfat  uvo t  ruoirpoy4apenlnei s)sDtm( oot0aexomoeild s ul( o t)artnioctodfa  ln o ( tetmir3iu4lme  icilt  2ua(mpou0oexomoctat m eluvsnt4alxoir iatfmteauvilt) ruo(rpoy1lm  lfes s s2umxrp;u0aeto iciatlaDrm(ms;t0 lerio3tytfmteauvs;(0s2xmiopnydome mfeta(fs2tru  nt4apeoiictlt a el(mon(4aetoio iodomDr nvo s teuoio3oydalt mictatfsDumu pot4alenmi3iytfm ul(mo t4aetnxo iodoa ranei t) ruoimpoo1olenmics sfsrumur ou4aexniieiatfs2rmumpn(4alxnxo3todlp elues ( t2tmirpiodaltelfetlt  ruax p;o1olxnif3iyslaDrmu s;t0 lxrxr oodfpDeanvo s) exmim3iydllen nvils)s2uax pno1olt mo3tad m umnmp (4teenmf oa1fmtr uvs (  exoio io1am emfct tfsrtr(m nt4aeeoifetadlm rm(von(4 rerio3oa1lpDr nvilt s2xo(rpou4lpt mieil( srrrumpno0alto ieiasla rauvs;u0aetrmf iy1fp rauvs (  ruriopnodome lnvsa( s2tmum ot4tltnmfetys aDulu pnt)aeeoio3tytopt  uvi t0sexmxm3oydame  fvtasfsDrax onu4oex  fciasls2rmuvp t0 ltoir iotomtrlu ilt) rto(m3nu1altemivtl(faDra(mp;t1opxniiciysfs ulnvp ()trtoioctotomDr neo;s0 2umirpnudolenlneta()sDrmu  ;o1oeto octltlm rm( s;(0tlxnir3todfmtrlnes (  2xoxr3oydaptnmics t sDtm(mpoo1oexn ocildfa eauvpnu4aeermo iy1lmD ai s;s  2xo(mpoodamt lfci s)s2rax o;o4tleoioeild sDemuvp;t0arenxr3iydlaDr ues;( truo(r iodll elieils)a2rm(moou0oee ifciydls2rauvp;(0arxoio iy1oaD  u i (0trxrir nydlptnlietatfsDtr(ro;o1altnmfciat mDuanvon(0 eeoif oy1lmD luvsl(0 rtriopnudlm  mfetl()s2taxrpou4tee ioeiytlsDem(vs (4 ltrio tydfpteauvs;() eurxr nu1lpeelnvi t  2ra( pnu1tlxo f3iatfa2ulnvs t0 leomrciadlaDeln sl( trum(mpoy4omeemfcsat) rumx p;o0olt  fctadfmDrlump;u4 lxrif oadlmt an ols0srtrxo3oudoltemfvi ()a2taxr ot1alt mietas sDeau pnu0 etrxr oytlaDeai o;s)s2xmxopiydam   fei t a2rr(monu4tle  fciltlaDul(msn()texrmr3oy1lpD luei (0tetoirpno1openlfvtls) rua(mp;o4alt io3tls a2rlumsnt0 ltrmr ty1om  lues;s)sexmimpoo1lmen fetlsfaDrmum ;o1oltomfeiasla2emu onu0trenxf oadoaDr ieo;t0srtoxm oydlmeelnvil()srua(moou4tle  i3iaslmDumnvs;t4alxoircto1fpteluvo;s0setoxopiy1op   fvsasfarrr(r nu4tlt  ietltls2uau p;t0aexomf oy1fatrlueil()srxmxrpoy1optelfeslsf Dtrxmpno1oetnif3tatlmDem(monu4arenmocio1lm eaivsl( trto(o3nudap  liei (farur(ronu1oeeo ietatlmDem( s;t0 lxniocoatlat  ivilt0srto(rpny4opt lfcsltf Drrxmpou4olx  f3tys s em( ont0tltrmf iytoatraieo;t0s2xm(rpiy4lp elnetltf Dtau p;t4tpen o3iytls2eau o t0 etnmf ootla e n o s t2tr(o3io1ole licsas sDrm(mont0aeeo ieiysls2rln o;(0texrir3oatopteanes (0t2tm(m oy4lpte nvsat)artmuro;u0ole  f3iadls rlu s;()trxnxocia1fptrlueol(  eurimpou4ole liciat)s2raxrpoo1olxnmieiyt a umn s;u4 lxrmf tadlp   n o;t0 rtmxopoo1ap   fei ( s2urur oo4apx  fetytfs2rlnmo u4aexrxf oy1lpDe n o t)setr(o3no1apee nciatfaDta( ono4alxn oeiltlm2eln snt4tltoir3ta1op  liei;s) etr(rpou4am n ietls)arur(mpot0opeo oetasfm elu o () eeoxf3oydfmDeaivo t0teto(r nu4oltnlnvtl(fsruaxronu4teeomf3tls a2umnvon(4trerir3tatomt  ivsl()teumxo no1llt mivt t) Draxro;t4tlt micils s raump;(4teerxr tytfpteanvi t)t2tmiopiydomtemncil(f Durxmonu0teenif3ilsfm umnvonu4 rxrxo oa1op  ln olt0sexm(r ou1ameemnvilt)a2uaxm ;t0apxo oeilslmDrl( o;u4trtrif3tatla   u o;t seto(o3oudome lfvsls arum(r ou1opeoifetyd s2eluvs (4alxrxocoadlpDe ivsls srxoim iy1lltelnvsltf rrrx poo4olt mf3iys aDrm( pnt4texnxf3ty1fmtean s;s) 2xm(o nodomt  nvtltfaDtmx p;t0alx  i3ild a2umuvp (4areomrcoydop e n il(  eto(o no1lptnlivi sfsDtr(rooo1tpeo iciat mDrauvon(4texnmo iadom  livolt)sruo(mpou1altnmfei t) Dtmuroou0apenmoetytla2umump;u0aetrio3ta1om raueols)s2urim3iydlm   nvslt)s2tr(mooo4ale io3iaslsDelums;t0aeenxrciatlate nes;s0s2toxmpiu4ll e fciltf Dum(mo;t0opx mfeiytlmDumnms u0 exoxociytopt aneilt)t2uoxr nu4ope mivsas)a2raur ;t4tex  feildfm2em(mp;(4tleomfctodfate ieil() rxmio3io1ol elnesltfa2rmx pnt4tpxn i3ias a ul(mo t) ltomfcootlatr i o s s2tm(r ny4op   ncsatfa2rrxrp;o0openif3iat mDum(vp u) lenmociytlpt  i ilt)sexo(opio1llt  nei t) 2um(rp;u4tex ifetasfa2emuvs t4 lenxf3ootfmD  ueslt0srxrxm oy1am  lfcs s  2um( pnt0apxn fctas mDemnmsnu) ltrmf tatlpt livs s)sexm(o3iu4lpeelfvslsf 2tm(ront0tpen ietyt s rmnvonu)arxoif3ta1lmt  ieo;()s2uoxo nu1alt  fci t sruau pnu4altomoetydlmDuaumsnt0altomo oadfaD au ols)trtoxr iudapeemfeils sDtruront1tptomoctyd m2raumo;(0alerif tatfpDeaueo t) etrir nodoleelfcsatfsDuax p;o4olx mociad a ran pnu)artoxr3iadlp eln i s0s2uriopny4amt mnetlt srrmxmp;o0opeomoetltlm2uau s;t4 etnxf3iatlat ln s s0srxmxrpno1lmtn ivias)sDumxm nu1apx  ociys mDrmu s u)tetnxocoy1omtrlivsls0srtmxm oy4oltelivi sfsrrru o;t4tpxoii3iydls umu snt)aexoiociydlpD anei s t2um(o iu4opte fcsas)aDtau ooo4tle mo3iydla2umumo t0artnmf3oy1fptrlueo t) 2to(r io1lmee nesat)sDta(r ;t4tle  i3ias aDemums t)trxnmociotoaDraieo;(0 rumio3io4ll  mfes t)a2tmuro;o1tpx mfeilslm2rm(mpn(0aetomr oo1opt auvslt0srxm(r3no4ape mieils sDurur ou4alxoio3iyt m rm(mo;u0tltrio ia1faDeliesl(0 2xmim nudaleelnesls) ruaxm ot4apx iieild a2um( p;t4 eerio3oa1fp ran s t)s2xoxr iu1lptn fcils  2umu ooo1olxoiictldlsDemnmon()trxrxr oydlaD liei;s0 2xo(r nodam nlnetls)arrru pnt0optnmietysfa2ua(vo;t4tetoxrctodlptrli sls0 etm(o3no4optnliesl(fsDtmumpot4aeen fctysfmDrlump;t0trxrio iatfa rlu sls  rum(r oudlm emivias  2uaxrpnt4oeeoif3tyslm um(ms () rerirciy1oa r n i;() eurxm oy4lpenmieias  2rmur nt1olt  iciatls uanmo;(4aetrxrcoadla rlu sl()s2trio3no1apt lies t a2taxr ;t0alxn ociatfs2ulu ont) renmf3ty1fptranvo t)teur(rpou1lpenlivtlt) 2rru  ou4tex  ieiytfa uluvo;t)areoxr3tadfptean o;t sexrxm no1lp e fvils sDtruro;u1opt mociytfs ul(vp;u0aexrxrcoatlp   uvs;()texoxo oy4omt  ics tf Dumxro;u1aexn o3iydlm um(vs;t0altomo tadfmD lies t)srtoio3iy4lm n ivs (f rtax pno0texnmfetad s2ranvs t)tlerxr3iadlm  livo t)t2trio3oudameelivt t) rtrxro;o4apeoio3iyd mDrm( p;u)trtnmoctodoa e uvs;s t2uoxm3oudlle mfesls  2ua(mp;u4opxo o3iat m eaump;(0aetoircio1fat lieo ( t2uoxr ou1al nmivi (  Drrx o;u0alxn fcils m2emu o;(4 lerxo3oy1lp eli il( t2trio3ou1lmt mncs sf Drr(mp;o1tlxnmoeiydfmDrm(vpnu4 lerxr3tydoaDeluvi t  exoiopnodaptnmivias  Dum(mpnt4tpt ioctltfaDra( p;u)tleoircoydfpDr iei;s0 euoio3iodlpenmnctlsf 2um(ro;o1tpxnmietytfa ulnmsn() rtrmo3tydfa  lneslt0 2uo(o oy1lpt lnvtls)sDra(m ot4apxomieiadla2rluvont) exnircoytlpD  nvslt0 euoxr3nydapen ncil(fsDuaur ;t1opxoifciys aDum( sn()arxnxf tatom raiei ( setoxm3iy4ll  livi (faDum(mo;t1apxo o3iltfsDulu o u) eermo3to1om e iei;t  eur(rpoo1lmtelivs (farta(mono4apenmf3ils aDua( p;u4aeerio totfptr i o s0 eur(o ny1lm nmict t)a2rmx  nt4tpxn ieiatfaDran p;u4texomrciadopt aueol() etmxm3ny4olen fvs tfs2truront4olxn o3iysfsDelnvs;t4aeeomo iotlmteai i ( t2toxm3iy1lm   ivsa(fa2ta( ooo1oetomf3ildlmDelums;()trtrif tydlatr u olt0texrxo oudalte fcs ( aDtmu ont0ole  iciltla2eluvs t0arxoxoctadoa eau s t  rto(o nu4alt mfvi () 2ta(mo;o0alen ietytfs em(ms;(4 exnxo ty1op   nvs s s2xo(m oo1al nlietlt)s2tr( poo0aex mietydlaDeauvon(0aetrxo iatlat aueo;(0t2uoir iy4alenmnes t) Duaurpou0tex  fctysla2ran onu) rxomrctydfa raueslt)s2toxr nudomt lfetl()sDrmurpnt1aeeomfeiatfsDumumpnu)aeeoir3totfpDr i i;()sexr(m3nu4omen ivils) Drrur ot4oet  ociyt m2umnvpnu4 rtomo3ootfmt  iei s) rumxr io1lm   nctltfsrta(r ot1aexn o3ils aDrmn s;(4trenxr3iy1opteln o;t0 rumxm nu4lpeelnvi ( srrm(moou4tpxomicilsls rm(vs u4tltomfcoydopDrai s;s trtmio ny1am nmiesls)aDrmx  ot4texoif3iytlmDelnmo;(0 exnxrctodom rauvs;s)tetr(o3no1omeelfei tfs2raxr ot0olx moeiltlmDrmnvp u)teenxrcoo1lm r u s s trxoxm iu1om nmiet s a2ua(mo;u4ape  ieiydfsDeluvo;u4areomf oy1fmD li s t  exrxm3oudlleelivi t) rraurp;u4tpx iieiat m ranvont)arxrmf3iotlateai i ()t2toim nu4lpte fviat  rtm(mo;u0aetomociys a ua(vsnu0 leoxrcoytfaD an s t)teumxm3oy1ole  fcsasf rra( pot4openifciytlmDra(mp;u0 ltrio oa1fptrlieolt0srxmxr iy1lm nmnvi t aDtm(m ou4tlt ifciyslm rmu p;() ltoxr oadoatran s s trtoirpny4oltemicsat aruau pou4oetomoctltfs2emuvpn(4 lxoxf3tytlp eluvslt)sexm(o ou4al elncsa()a2raxrpno0tetoifetldlmDrm(mp u4 lxrxfciodomDranes;s  rxoio oy4altelfct (fsDumxroot0tpxniicildfsDumnvpnt4 exrxf oodfateau o;s  2xmim oudol nlict t  Dtrumono4opxomfeiaslmDulu pnu) eerif oadomteauvo (0 ruoim3nydom   ncs ( s2tm(mpot1olxo ocilt a rl(vsn(4 lxrif iadoptraivi s s2xm(m iydlptn fctl(f rrru o;u4oexoioeiaslsDrmn sn(0arxoif oodoaDr nvils)trumim3no1amtnmfvilt  2uaxmont1tee if3ias a ul(ms u0trenmo ta1omte u o;(  rtmir no4llenmncta(  rumurpot4oltnii3iat a eluvs;t) rxomfcta1oatelues () 2tr(o ou4lleelfvs sfa2taxr oo0opt mictas m emn p;(0altriociotfp e ivsls) 2xr(m nudaltnlfvt tf Durxm ;u1aexoii3ias m2rmn ont)teeoifcootfpDeli s ()teuoir3io1altnmfvtlt a2tr( ono1apeomfetld s2um( on(4areomr oatlptelneils0trtrxrpou4op   ietatfs2trxmont1altoifetytla ean o;(4 lxomf3oy1fpteluei t0s2toxmpou4lleemfvtasfsDraurpou0apeo feiytfsDrlnvo ()aetnmf3iotfm  lieslt  eum(r3io4altn fetlt)srtaurooo1oltomf3iaslm ul(msnt4aeerxo3todlat li il( truoxrpnudapte fct sf 2tmxm ou4opxnifeilslm el(mo;u0arenxf oodomD  i s t)sruoir oodal elfctat srrr(ro;t4aex ioeiltfs ua(vo;()arenmr ta1oa e n sls0t2xoxo io1ll nlnesl(fsDumxmpoo1tleoioctat a ul( snu) exnmf tatop rln i ()trxoxo3iydlp nlnetltfarrr(r ;t1tlx moetyslsDel( pnt)altoxo3oy1lmDe n o s0 2tm(m3iudolen nvi (faruru p;t4oexo o3iltla rmu s u0 reoxo3tatlpt lu i (0s2tmio no1lmtelieilsfsrta(  oo4alt  f3iat aDeln snu0aetnxr oytop   uvslt)srtmxo oodal nlivtlt)aDraxrpoo0tptn ietat mDeln on()alxnmf oadlaD aneo;s)sexoxr3iudape liviasf rrmxroot1opxoioeiatfm2rluvs;() reoifcoa1om  aivi (0 2tmir ny4altnlnvs (  Drrxmpoo4texomo3tlt sDemnms;(4aexrir3oo1omD  nvolt) eurim oy4apen icilsfsrra(m ;o1tpt ioeiasfs2rm(vp;u) exniociodoatrli sls)trxr(r3iu4lme  iei t)artmuront1olxomi3tytlmDuau pnt4 etomfcootlptrauvs ()sexr(opny1om nmfei s)sruaurpot4tpx  f3iytfa2elu ont4aetoxf3ia1optrlnvo;s) rxmir3iy4lp elnet (fs2uaumpou1oeenmietytlsDum(vsn()teenmrctodfm raueo;t sexrim3nodlleeliei (fartmump;t0aleomi3iadfaDrm( sn(4tetoif todfp eln s (0tetrirpoo1ol elncs s a2umxmoot4tpxomf3ilt aDrlumo;u4tetoio to1fpD aneolt)trtrir3oudlmtelnvsls)s2taur nu0oetoiietlt m rmumo u0teenmf iodomDrlu s (  rtm(opiudap   ncs s a2rm(rpnt1apx  ieiyslm umn on() renmr oa1latrau o () rtm(o oy4ame lfeia()arrax pnu0tptomf3iltlmDemumsnu)teeoirctodfaD  nes s) 2xoxm oo4alt mnvs s aDtmx ont0tlt io3iydls em( s u0trenmr3iatfatrlnesl( sexrir io4apte icia(  Dra(r ou1alxniicilt a2rl( s u)aeenxocoadoa r ues s  2tmio oodame lfviat) 2tmu p;t0teto fctasfs2uau p;u0trenif iydfa eli i s  eurio3oydamtn netlt)sruau  oo0alxoioctasls rm(vpn(4tetnmr oo1lmteluvi;s tetoxmpnu1olt  nesas  rrr(r nt1aleoii3iadfs2ea( onu0 etrxr tatom ran ols  2toir nu4alen fet tfa2uau pnt4oetnio3ildfmDem( p u0 etrio oytlm rlnvi t  eur(rpou1alteliesl()s2raur ot0oetn fciydfm em( p t0 lxrxo3oodoptrlues ()t2xm(m nudlme  iet ( a2um(mpno0oexo f3tyslaDulumpnu) lxnmo3tadomD  ies () 2uoxrpou4al e ncslt)sDtrx o;o4oltomo3iytfs ulnmp u) lxnif iydopDelivo;s)s2um(m3io4altemfetlt a2umxmoot4apeo i3iydlaDrm(mont4 ltrxr ootomD lnvi t) rto(m oydamenlivt ()artmumpno4tleoiiciadfm2eaump u) lerxr oytlmtran il()seuo(mpno4altnmiesltfarum( pot0alt ifciltfaDrl(mo (4altoifciy1omtrlieo;s0s2urxr io1ap  mfvs ( s2um(mp;o0aeen o3ildfsDuau o;u)alenmrcootoaD anvsls) rxo(o oy4optnmfviltfs2urxr oo1aetomociatla2ran s;t4texrmo ty1lmteauvi;s)srurxr3oodoptn ncs s)a2tmu ooo0apeoio3ilsla2rmumo () ltnif3oodlaDeli i;t s2uoxopnudom elnct (fa2urx  oo1tpen feildfsDrm(monu0alenmr to1lp rauesls)srxmir3no4oltelfetlt s2rmu  ;t4opt ifetls a2rm(vpnt)arxrxo3oytopt  uei (0s2uoio3oodop elfciatfa2taum nt0olto o3iydfa uluvo (4 lxoircootom   u slt0 eumxr3io1omeelictas artr( p;o4opeomieiadfa umn s u)tetniocoatlm e neo;t  exrxm3nu4lmtn fcilsfs2tmxmpou1optoio3iad s ul( s u) exrmf3tadom rlu slt0 eurxr3oo4alenlicia( aDrmu oot4apxoii3tytlm2rl(mont)aexrmocto1lpDrlies s0srum(o iodal nlnetatfs2uaxrpou4tpx mfetydfs ranvsn() lxomr iatop   neo t)texo(rpiudal emfvtls)s2tru  no1olx  iciad sDem( ont0 rerxocoa1oaDe n ilt0seum(opoo1lpeelfvt t)aDtmu pnt1tpe iietydlaDuanms t0teeoxr todlpDe ies;t) rto(r3oy4om n iciasf rua( onu0tle ii3tltfm rau p;t0trtomocoydfptrauvs;(  2ur(o nu4lm emnct ()arraxr ;t0opt ii3ild m2rln sn() rtnmfciadfa   i o t) eto(m nydol e ivias  rraxrp;u1texoifeiadlmDem(mp;(0tlermf3oytfp rlnvo s srxmxo3io4llen ietl(fs2rru poo4aex  feiat s2rmuvsnt4tltrmo oatlptrln ils srum(m3no4op emiet (f rtru  ot0tlxnifciyt mDuanvsnt) exrifcoydomteanvo;( t2urir iu1lltemfct t sDrax  ;o0oltn i3ild m um(vp () eerif3iy1omDeluvo (0texoir3iu4optnmfvsl(fartrumooo1olxnmoetat s rlu pnu4tlxrir3tadfaDe ivo;( srtm(opiy4oltelnci ( srtm(rpnt1opxn o3tldlm2elu sn(0 etoif3oy1oat anes s)sexo(opoy1oleelfvi t)sDtaumpot0tpxnmfciyt aDum(mo;() exnif iodlpDelivs;(0t2toimpnu1al emnvils artr( o;u1aetoifciytfs2ua(vsn(0 lerifcta1fa   i i t)s2xrxo3oodol e ncsl( a2tr( pnt0aeeomiciys a2eanmon(4arenifciytlatrai o;t  2uoio nu4lme  icias)sDtaxmo;u0alx mo3taslm eluvp u) renxrctodfp   ivi (  rtoxopou1olt lfct ( srrmumpoo4aexnifcias mDua(vo u4 renmrcia1opDrln s;(0 2xm(m3iy4alt lfcs t arraxmooo0olxnifeiys aDemn o t0 eenxr3to1optrln s s trxrxr iy4op  mfeil( sDtm(mp;u4tle moeiltfsDrluvs;t4trtnxociodfa   i s;s0srtmxopno1olt  fcs sf Drr(root4tetnifciaslmDuauvsn(0tlerifcoa1op e uvilt0 rtoir ou1opt lfvsa()aDumxmono0tpt moetat s2el(vsnu)arxrircoadom  aueslt s2tmxr3nodllenmfcsas srtm(rp;o1ole mieiyt m um( o (0tetrmf oadlm  lu o t0seur(m nodllee fvs s a2urx  ot0opxomociysfsDemnvpnt0 lxrxf iydopDrai o t)setm(mpnu1om emnvs t) rumxmp;u4tlxomf3iysfmDuln pnt4 rerxo3oadopDelu i;s s2to(r3nu4lpt  fetl(f 2taxmo;o0optoifetytfsDem(vp;u4aexoxo3tydopDraues;t)srur(mpnydapt  fvsatfs2uaxmo;t4oeenii3ils s2el( p;u)tlxnxoctydfm  lnvs;t) 2umio iu4lpe miciatfa2tmump;u0optomf3tatls2el(vsnt4 exoir3ta1lmD  nvs;()t2umiopio4lmtemiviat aDtaumpnu0aexn i3iadfa umuvo;(0trtoxr oy1om eln o;s)tetmxrpno4ame  fctas  rtaurpou4oetn f3tydlm elu s;(4 eenmr3iy1fmtraiesls0 2toirpnu1lm   fvsa(f 2tm(  ou4alt mfciadla2rlums;t4trtnxfctytfa eliei;() etmxopno4alen nvi ()aDtr(  ;t4alxnifetlsfs2rmu p;u0 etnio iodom  lnvs;t0srxo(mpoy1al  livt t  Dtax ont4oleo ieiatlm2ra(mo u)teenmr oo1omDeaivo;t0t2uoimpiu4omenmfetas)s2ua(m ;u1olt  o3tys a2umumsnu0trxrmrciotlmDranvs ( trurio3iodap nmfei ( aDraxmono1tetoiictaslaDumnvs t4arxrmfcoodla   nvs t) 2xrirpoudop n ivt ()srrrumooo4oleomfeiltla ua(vp;()trxomf oatoatr ueo t)tetmxm ny4llt  fcias s2taxront4oet  ietasfm ulnvpnt0tleoxf oy1fa elnvsls srtm(r ny1apte iei s)a2urxmoot4olenmictadlmDuanvp;(0 eerxf3tytlptraivo;s0sruoio3nu4llee fvsa() Drrx  ou1tlxnmoetltlsDra(vo (4 ltnxocoy1fpteaivils0trxoir3iu4lpen fei sfsrrmu  nu4optoif3ildlm2um(mp (0aleomrciatfpDr uvo;(0sexo(r3no1omee ict ( aDtmx  oo1opxnmoctlt s2umuvo t0 reoir tadfm rli i;t)srumimpiu1omtn fes s  rrmxr ;u0alxomoeiltlmDelnvp t4 rtnmr3iatoptr n s;t teurimpiodlpe lfvsasf rrrxmpnt4tpe  f3iaslaDeauvp;t) exrmr oa1oat aneolt0setrirpnu1am  mictas s2urxmp;t4aexn ocils aDrmu o u)trxoircoydlmtr ueols) rtrxopoo4omteliesat) 2raxmoot1alt  icildfm2emn p;u4tlxoxf3ootoa elivo;(  2ur(mpiy4opeemfvt (f Dtrumono1tltoioctldla rln p () etoif iotfa eauvi t  2umir ny4ole  fesl( sDrmumpnt4aeen i3ilt m emnms t4alenmf oy1oa rai i s0s2ur(r3oo4amt  fctl( arurxmooo4oeeomi3iltfs ua( o;u)teeoxoctytfp rlivslt trtoxo3io4lmeelnct s  Dtmurpoo4aex ioeiytlm ea(vs;() reomrctotfaD lu s;t setmiopio4altelict t sDrm(r ou1alx  fetadla rl(vp t) lxoio iadfa   nvil( sexo(rpny4ome miesls srrmxm no0aleomieiyd m2uanvon(0 lxoxo iydfm   ivs;s)t2uo(r3ny1ap nlnvta()artau  ;u1altn feiydls ul(ms;t0trtrir3oa1oat  i o ( trxrxmpny1apt mnesas) 2ra(root1texnmo3tlt s2eln p;t4 etrifcty1oa   nvs s setoxrpio4oltnmnet ()a2urxm ot4olt ioetldfa rlnmo (0tlxrir3ootfpDeanvs;( srumiopnu4am emivt tfaDumx ont0apxo oeiltlsDum( pnt)tleomr3ty1latrln sls0texo(rpou1altemfctlt a2urur ;u1apx  o3tlsfmDeaums u0areomo3oatfmte u i;() rto(m3nu1ameelneia() 2tr( oou4texnifciys s2rl( p;t4 reoir totlatraneolt0 rtr(rpnydopen netltf Dumurono0tle if3iyslsDran pn(4 etrmf3tadlp eanvi;t)sruoim iy4ale lnvia( aDrru ont0apx iiciyd mDrl(mp (0aexnio iytfmt lneil(0s2tr(o3nodom emivs (fartrum ;u4open ociat a2umn o;(4 lxnmf3tydoa eauvs ( s2umimpoudlmt  nct t  Drrumono0opeo i3tlsfa2emu o;u) etrioctytfa eluvs t)sexmio nydamte ictas  2tmxmpoo0alt if3ilslmDulu o;u4 exoio tytfaDe nvo t)t2uo(r iu4ome  fcsl() Dra(moou0aetnifctls m rm(mo (4 lxnmf oytomDeaieo;s0truoxm3iy4lptelfvi ()arra( o;o4aptnifeildfs uauvs;u0 rtrxr3iotfp eauvi t0 2ur(o3iudal emnci t)a2ur(r ot1oleoiieiasfsDean p;t)teeoir3io1oa elnvs s)texmim iodoptnlfciatfaDrmxrp;t0aex mfeiadfa2uanmp;()alxrir iy1fa r u ilt0 rumxr iydale lietat)arrauronu0teen fcils a2umuvo;u0arerxr3oytoa eaues ( sexm(m3io4altelncta()sDtr(rpnu1teeniieiat a2umuvsnt4teermoctodlmDeanvi;(  eurio3ny4ll nmnviatfartm(r ;o4opxnio3iytla2elnmp;()texnio iotlpDrlnvs;()s2xr(o nodomtemfes t)srtm(mpnt0oee mo3ildlaDumnms;(0arxrmrcoo1omD  ueol( seumirpoo4optnmnctl(  Dtrxmo;t1tetoio3tasfa rl(vsnt) renmfciytfmDe ueil(0srtoimpno1opeelfcs s)aDtmurono1aet mo3iytla2ea(monu0aeenxr3iatlp  lies;t0texrim3iudlme mict s)sDta(r ;t0alxn f3tlsla2ua( o;t)tltrmr oadlat luvi s)tetoio3ou1lpt  fcsa(faDtmumpoo4apxnmi3iytlm2rmu pnu4 eeomo3tytlpD ln ilt)t2tmxo3iy1ll emnvsa()s2tm(monu1texnmo3iaslmDelu s;(0artoioctodoatrlneslt) ruo(rpoy1omtnmnes () 2rm(rpnu4tpeniieiytfa2emnmp;(4 etoioctatla  lneslt) exrxmpiodole mfvsas sDumxmp;t4tpt  oetls m2ra(mo;t0 eeoif ia1fmte nesls  rto(o3oodaleelnct t s2rrxmpnu0olen f3tlsls rln s;t0 rxnmf3tydfp rau s (  2xoxrpiy4lp   ict s)s2rrurp;u1aex mi3ilsfa ean p;(0arxnif oadomD ai olt sexmiopou1omeemivtasf rururooo0tee mictyslaDumu on(0 exomfciytomD  iei s)texm(r iu4op emfes t a2ra(mooo1olt  ieiadfa rmn p;(0aetrmrciatop elueslt0texoiopno1ape  nciasfaDrmumooo1ole  ieildfsDra(msnu) lxnxo to1lmt  n olt  rxoir iy1opt  fetl()arra(mont0aetoioctatlmDrmu p (0 lxoif3oa1omteau s;(0s2umir no1lmee fvt s sDrrx oou1oet  fcias s uau on(4tlerxoctytopteauei;s)trur(rpoy4op e icsas)srrrum oo4apeoio3iltfm2um( p;(4aetomr3oydop r n sls srtrxopnu1al   feiat)aDrm(  ot0apxoio3iyd m ul(mon() lerio3oodfpD luvi t)sexoiopny1al nmnetl(f rrmx ont1alt mf3tasfmDrluvp t)artomf oa1laD anes s0sruo(m iy4llt  nei t)aDrrxr nu4alxomf3tytfa2rau o;t4tetomoctydlm r ieo t) rxmxrpoo1lptn fet (f rrm(r ou0opxo fcilt a2ean o;()tlerio3io1lptrlnes;s0t2tmim3oo4optn nesl(  rurumooo4aptniictysfm2eaumpnt)trtrxfcoodomDraneilt)sruoxr3ou4omtnmfcilsf Drm(rp;u4aleniieildfsDemuvp;(0 rtoir3tytopDe n s () 2xrxrpnudlptnlivsat)a2taxm no0tpeniieiytfa2rmumont4 eeomr oy1fmte uvi t0s2xoxm no4apenlfcs (f Drrxr ou0texnifeiysfaDumu o (4altomo3ootop  au ils0srto(r nydomt  ncs s sDtau  nt1tpto ietyslaDrlu o t)altoxr to1om  lnvo t0srxmxo ny4lmee ncsas)arumxrpnu0altnmf3ilslaDra(ms;t4tlxoif oy1oa rauvo (0 eum(r iodalen nvtlt)a2um(m ;o0oee mo3tasfs2ea(msn(4 lxrmo3todlm e uvs;() rtrim iy1ole mnctas)sDtrxrono1olenmo3iyt sDrlnvon(4tetomf3ty1lpD  n s s)srtmxmpiu4lpenlfeil() 2urxm ;o1openmo3tasfa2ra( o (4arxrmfciy1lmDrluvs ()srxmxm3nu4lptnlivsl(fs2uauronu1olx moeils a2ul(msnt) rxrmf tytoaD aivo;()teto(r3no1lpe lietlsfa2tmxr ;t1oeenmi3ilslm2umnms;()trtrifctydomDeai o;( texr(opnydame mnctas) Draxrpno0tpx ioeiysls2eanvp;u4trxnxo oy1oaDe uei (  rumxm3nu1aptn fvt s srta(mpou1tltomicilsls rmn ont0 ltomr3to1lpt lu ols)s2urxr oodal   nctas s2rrx onu1tle  ociadfm2eau on(4teerxocto1la r nvilt teumxrpnudomenmfvi s) rrr(r ;o4alenifetydfm uluvs;t4 rermo oy1laDe neo s0 ruoxopiudlpt  ictas s2rr(r ;t1aetnmo3tyslaDea(mp;(4tltnif3todfpt au ol(0trtmim3iydlltelnesatfarrmurpnt4oltomoeild sDemumpnt4 rxnxr3oydom eli i;t0setoxm ny1lmtemivsl(fsrtaumpou0ape iociyslaDraumonu4teerxo oytla e i o;t0 euoxm io1ol n fesl(fsDrrx pnt1opeomoeiadla uanvs;(4altnio iatlm eluesl() ruo(o3nu4op emfct s) ruau poo0tpenifeiytfa2el(mo;t)arenmrctodfpt  uvs s)trumir3io1al   fesas)aDtru  nt4aeen oeiatfa rm(vpnu)altomo3tydfptr nesl() exmxrpoo1ap  mfeils aDrrumpou0tlxnifeiydlmDul(mp (0 rermf3iy1lm elu ilt0 rtrim oudopt livilt aruaurpnt0ale ii3ils m rlu pn()aexrio3oy1lateau o s) exoxr3iudll   ivil(fs2truronu1optnmfeiaslm rl(ms;u0aexomo3iodfpDe n o;(  2to(mpou1lle  ict ()sDtrur ou4aptniociat m2emnmo u0trtoxocoa1oatr nvo s t2xmxrpiodlleemfvt s)artax  nu0tlxnmf3ildfaDulnvo;(4tlxrir3tatopD lu s;t) rto(opiy4ap   ivtas)aDta(mont4apeomfeiyt s ra( s u4teenxf3oa1fpDeai s;s0 2xoxrpou4lpte nes ()srur(rooo4ole ioetasfm elnms t0altrmo3oytop   n i ( t2tr(o3oodlmt  netl(f Draxr nt0aetomf3iadfm eau o (0texoio ta1lpDr uvslt0srxmim io1am n nei tfsrtmu o;t0olxn f3iadlm umu pnu0 rtrif3ta1lmDraivils0trumim ou4lp   neta(f rtruroou4altn oetltfa2rl(ms u0trtnmo3io1lmDeanvo;t trto(o3no1alenmiesl(fsrrrurpou4alx  f3ildfa2eau o (4trtnmfcoytlp   nes;()t2tr(m ny4aleelfvilt)aDrr(rp;o4tleoioetas a2rlnmo t4tlxnxf oadoaD aueilt)trtmimpoudlm  mnvtlt sDra(ro;o4texnmfctltfs rl(vs () exniocta1laD au o;s  2xoimpiy4ome  ivi tfsDtru pno0alx mi3tltla2el( s t4alxoir3ootoa eluvi;()truoiopnydlp elfvi t)s2ra(  ;o0aleo fetyslaDuanms (4texrmf3oy1fp raneolt0srxmim3iu1olt  fcia( sDrmurono0ope  o3iadls2rln on()aetrmr3iy1lm e n o;t0srur(m iodll  lnvtl()aDraxmp;o0oetnmfcils sDrl(vsn(4arxoio3oadlp r uvsls) etoir3nodole  ivt t arumu oot4optoif3tltfs2ulnvs () rtoxfctadomt livo;s)s2tr(r3io4ll emics t  Dtmumpnt1teenmietlsfa2rm(mp;u4treoxr3to1fm elnei s teto(m iu1olt  fes ()a2rmx  nt4tex moctys aDem( s;t4texrmfcootlpt  ivi t t2xmxopoydam elfvsas  rtru  ;t0tlenio3ilsfm ul(vo t) rxnxo iy1faDr uvs s seum(o iu1opeelnctatf Dra(mpno1aexn fcildlsDra(vpnt4aexoxo iydoatraieols) 2tm(opoydopen ici tf 2tmxr ;o4texomoeiyt a ul( p;(0 exoio oa1lmDeaies s)srurxrpiu4alt lfvsatfa2rmu pno0olen feilt m emums;(4tlenir3to1fm raueolt0texrxr3io4omtnlfeslt s2umxr oo0aetoifetldfm2ean o u4 etoxociadopD aiei;t0seur(o iodlm nlieiat sDtmxro;o0oltnioeiydfaDrl(msn()alxrmfcio1lmtean o (0t2ur(r io4lm nlfvt (f 2taxm nu1tptomfcildfaDrm( onu0tleomo3ootfp  lnei;t)t2xoim3iu4lptnlfeiltfa2tmxm ;o1alt iictaslsDul(ms t)aexniocootfa  lnvs (0 etmio iodamtemfctlt  Dtrumont0tlx  oeiat aDelnvonu0 eenmr3ta1om   nes t0trur(mpou1amte nesa()arurum ou0altoif3ildlm ea(mpnu4 rxnmr iodfpDr u i () etm(rpio4lmtnmicia(fa2rm(rp;u4aexnmietydlaDemumsnt0aeenxo tatfm eaies;s0srxrxr3io4amte ieslt srta(mooo4teenif3tyslsDul( on()alxoxf3totlat au ols t2uo(mpiy4opt lnvsa()s2rr(ronu1apxnifeildls2emuvont0trtnmr tadfaDe ivs;t0trtrimpoo4opt mics t srraxr nt0tpeo ieild s rmu p;t4alxrif tytlm   nvilt0trxmimpio1op  mnetlt)artmx pnu4tltoif3ils a emnvsnu4tlenir3iydfa e i i (0t2uoxmpoodlle  ivils) Dtmur ot4tex  fctas aDem(msn(4 etnmr iatfp  li o s0teuoiopio4aleemnvilt  2umxrpou4apt ioeiltlsDumnvsn(4 lxrxociytfp e nesls t2uoio ny4ome mnvils a2tm(m ou4olx if3tyt s2em(vpn(0tltnmr3iodoa e nvs;t)t2umxr oydlmenlivs (fsrrr( p;u4tle io3tld mDrm(mpnu)aexnif3iotomtr neo;(0 etrxr3iu1opt lfvs (  2um(m nt1alenmfetatfaDulnmonu0 reoxo oydoptr uvslt  ruoio3iy4ale mivsl( sDta(rpou4apt io3ildlm eluvsnt)alxoir3ootlm rlueo t) 2urimpnodlpte fes tfa2umumooo1tpeniieiatlsDuluvs t0teerxo3to1fpD ln olt teto(m3nydllt mfct t)sDrrxrono4oleoioeiatfsDrmums (4 renxfcoa1oa  liei t t2ur(o3oo1altnmneia(fsDrrum ot4apenio3iad aDem(vs;(0aetrmocoatlaDeau i;( srxriopnu1op   fct s artmx pnu4tpt iieiaslmDra(vsnt0tetnmfciytlate ueil( s2tmir3io1altemncsas arrrxmpnt4aex  fctlsfm2rmuvonu0 lenmf oatfpteaies t0tetmxo oudoleemfeia( a2trumoot1tlenifcildfm2um(vs;t4tlerio3iodoa e neo;s0teurir iy4lm n iesls aruru p;u1oex ii3tys mDrmnmo t0 eenio3iy1lmDraiei s)texoxr iy4altemnvi ( s2ta(m ;o4oee  fctatls rau s t)tetrif ootfpt  nes t0 eumim3iudop emncs ( a2rmxr ot4tltoif3iydla umums;u0tetoirciytom eanes;( texrimpiodaltnmfvtas)arta(r ;u4alen ictydfs2em(mont0 eerir ia1lmte ivo;( seuo(o iu1lltnmfes t s2rru oou4teeo oetysfa el(vo (0tlerxr3oa1la elneo;s)texr(opiu1ame mics s  Drrx  ;o1oeto f3iysfm rmnmpn()alerif3tatop   nvi (  2xoirpiu1ap nlivsat)srtrx  ot4oetnmf3iltlaDeanvp;u) rxoxf3oo1fmD an o;()srxmir nu4ope  fetl(fartmxmp;o4texomociasfa rm(ms;u) rxrxfcoydoa   n s t)truo(m3ou1op  micils  rua( pnu4oexo fetysls2ua( snt4 eenmf3oytlmD anes;(0truriopoy4opeemfeil()s2uaumoou4oetoiociat a2emu p;t)altomf3oydlaDe i i;s0s2tr(m oodlm elfvsls)s2rmxronu1tptomoctydfs2um(mpnt)alxnxo3oo1faDelneils) 2xmxrpoo1lltemieilsfartrx  ;t0tpxn i3ilsfa ra( p u4trtomr iydlaD  uvil(  2tm(m iudalenmfvi tfs2rax p;u1oltnif3tadfm2rlums u)tlxrmfctytlaDraivsl()texr(o3ny4lpte ivi sfsDurxr nt0aleo i3iyt a2emnvp;(4teenif3oadomt  nes;s0sruoxopiu1ope  nctas sDrm( o;t1oexoif3iadla umumo;(0altnircoo1lm e iesl( s2xmiopny1ap n iviat aDtrx o;t1tpen feildfaDem(ms t)trerir3oodla   uei;s)srtoio iy1lmtemfvsa( s2uaum ou0optniiciydla emnms;u4arxoio iadlmteln i;s0 2xo(m3nu4al n ietlsf ruaxmont0alenmictasls2eluvonu0 lxnxr to1om elueo;t) 2xo(r ou1omte ncs tfartmx o;t0ope moetyd mDul(mo;()texrmr to1fptranei;t)trtr(m3nudlmenmiviat)a2tmurpnt1tee mfctltfa eanmsn()arxoxfcoadomtr i i;s seto(r3io4ap emnvsa( sDrm( oou4tee  fctatfm uan p;u0altoxr3iydopDrli s;t0trtoim iodoptnlfvs t)sDumurono4aeeo o3ilslm umuvp (0aleoxo3iydoateluei s srxoxmpoy4lpe lnciatfsruaur nu1apxnii3iat a ulnvo;t0aeenir3iy1lpt aues;( srumiopou4opt  nct t  Drmx ooo0oexn o3iadls um( p (4tltnir oadfmtelnes s0sexmimpno1lptnlfeiatfsDuaxrpno0aetn ictadfs elu on(4artoio io1fptelnesls s2urio3ou4al  mieia(fsDua( pnu1ole if3iyt s2ea(ms;u4altnio3oadlp  li i;s0 2to(r oydap nmnvia(f rra( poo0tpt iieiad m2ean s (0 lermrctydfmDeauvs;t0 etoim3oodlp emnvil( aDtmu o;o1oexnii3iydla2el(ms;u4 rxoircoadlaD ln s;s srum(mpio4ome lnvtat) rtm( o;o0optnioeiyt aDuln p (4texomf oydlmteanei s  eum(m oydamen nvsa(fsrurur ;t1ole mfciysfsDuaump (4 lxoioctotomteai o s0setmxmpoudlptn ieiltf Dtmur oo4optomociltla2rmn on(4trxnio ootfmDeanvs () exm(m ny4ol   ietlt  Duaurpnu1tltomfciyd a2ra( s;(4aeerxociotla e n o;(0srurio3oo1lmte fetltfaDuaxr ;u0teeomi3ildlmDrlu ont4texrio3iadoatr u s;t0sexmxmpny4altemnvsls) 2ta(  nt1tlt mociyd a uanvs;t0 lenmo3ootfpDrluvsl( t2tm(mpoydll nmfeils aDrrumonu1oleoifeiltlaDrmnvpnu) lxoxf tydopD lnvo (  exmxo3ou1lpt mietat  2ra(rpnu0tltnmocils m2umums;t) eenifciatoptelues s0 ruoim3iu1alen fesas)a2ra(root4opxn ictltfs2rau s t0aexnmoctytfp eanvo;() exm(opiudome mietlt)aDraxmp;u1optoiocildls2eaums;(4aexnmrctadlaD  ueo;s setoirpoydamtnmnes () Drmxmooo1tpt  iciytfs2ul(mp;u4 renxr todfp e uvs s)srtrio io1om  mfvi t)sDtru  ou4tet ii3tatlm2rm(mp;()arermr3iadfaDe nei ()setoim iy4am  mnvi tfsDurum ;u1olx  oetatlmDuauvsnt4trtrmr3iydlpD  n il( sexm(mpiodapt  fvtat)sruaxrpnu1opx  fetltfs ea(vs;u) rxrxf tadfmD  n o ( t2tmimpnydam   fet ()sDua(r ou0alenmociad s ulu s;(4 rtomo todfpt li o;t)trtrim oydam n nes sfs2urum ot0aeen ictat m2uanvs (0arermr3oatomDelnvo () 2uriopno4ape lfvt ( arta( onu4oetnii3iatfm ua(mo;t4 ltnmf3oydlmDrau ol(0texmio3no4lpen icsls)s2uaxm no4olxoiicilslm2ulumon() ltnmr oadomD auei;t s2xrio3no4amtnlivtlt aDtru p;t1ope  ocils a2emnmpnu0 etoxfcoa1oat  u o t  2uoxr ou1ol elncslsfsDrax  nt0apxoifeiatfm2rmn pn(0trxoif3ootfpt lu ol()tetmimpny1llenmfei t)srum(rp;t1tleniictls sDemump t4aexnxo3to1lp  lnvol( s2um(m3iy4omt lnvias) 2rr(rp;u1ape  iciyt aDrlnmo;u)tetnmf iytlp  au o;t0s2xoir ny4llt  nctatfsrtaurpoo0olx if3tltfmDrl(vp;u)aexoxr3ty1faDelueo t0 exoir nydamt lncilsfa2tmx o;u1tpeoio3iat a2emums t0tetnmrcoy1lpt  nvi;( trxr(o3oo4lmenlnesl(f Dtm(m nt4oetomoeiasfa em(vs u0areoio3oatlmtelivi;s)s2xr(m3nodllenmfeias  rumumooo0tlto ictadlm2rln p u4texomf3oa1fa r ieslt t2urxm3nydalenmictl( a2um( oot4opx miciysfaDuan s (0alerio ty1op  lnvolt) euoxm oo1omtnmfct () 2ta(r ou0opxn fetlslm2ran pnt) etnif iytfp r uei (0t2tmxm3nudop nlfctatfa2uaxm nu1tlenio3iasfa umumsn(0arxrxo3tytfpD  uvo s) eum(r no4opee fesat)s2rau oou4texnmfeilsfaDuanvo t)trtrxr3oadoaDeaneols teum(m3no4lmenlneslt  rrmumoot0aetniieiat a2ul(vs t0trtnxo ia1opDelueo t t2xrio3oodoltemfvslt srumum ou0opt iiciasfaDrluvsnu4tetnmf iy1opDran ols0 2trio3oy1ape livt tf rur(r nt0olt  o3ilslm2rauvp;u4 ltnmoctodop rau o;s)trxmxr nu1ll  mivs ( sDtr( pou1texn f3tatfsDel(vs;(0 rerio3oytfa   nvo;(0t2trirpio4al   nct tf 2uaxm ot0tetniictytfa2rl(mo t0alenxo3iodfpt luvo t t2uoim3io4lmt livsasfartau  ;o0opt ifctydlaDrluvp;(0 exoircoytomD  nvi t seumxo oodol nmnvtl()sruaxrono1aet  feiasfa rl( o u0tlerif oatlpDe iei;t0 2xoxm3iy1ale  fvsas) rumx  ;u4olx mietadfsDrauvs;u0 rxoifcto1oatrluei;()s2xrxo3io1lp   ncsl() 2ta(rpot0tle mfciasfs rmumo;()arxnmr3io1latr uvols)s2toim oo4apt lfct (f rurx p;t1tleniociatla rau o u)aleoxrcto1la eliei t t2um(o iu1ome livtlt)artaur nt4tltniietadlm2rlu snu0 eeoxfcoadopDrlnvs () 2xoxr3iudomte fesatfsrurxm oo1apxnioeiyd a ra( o;(0 exoirciytfm rau sl(  rto(opno1amte fci tfarta( o;t0alt ioeilt a2umu p;t)trxomr3tydoa r nvol(  etm(opno1ll emfvs s)sDrauro;u0tptnif3tld s uanvsnt0 eeoiociodopteauesls)tetmirpoodapen fcs (farumum ;u1alt mo3tltfaDrl( p () ltnxocoatlpte uvilt0trum(r oy4amt lnctat s2raxr ;o0tltoioeiyd s emnvp u4 lenif iydfat  n i;t)seur(opno1alenmfvia()s2rmxmoot0tpe  feiytfsDem( sn()texriocoa1om   nvi;s0seumim3iydomte ncs t)srrmx  ou4olx ifctat m ranvo t) exrxr to1op ran i;(  euoirpny1lme mncsat)sDtrx  ;o1olx mociaslaDum(ms;(0tlxnxfciatfpDeln s;s0 eurxrpnudapee fesl() rua(monu1teeomfetydlm2ul(mpnu)trxomo todfaD anesl(0truo(rpoydll elicsl(  2tmxm ;o0tlt  fctadfa2emums (4trxrmocoytop  ai o;t0teur(o no1lpeelnvtlt arrmx pnu1open i3ias m2ra(msn()treniociytfpDelu ilt) ruo(m3ou1lleelieta(  Drr(rpnu4aptoii3iatlmDua(vs;u) rtnir3tydfpte i s (0 rtmxr io4ll   nvtls srrmx pnt0apxomiciad a ra( p;t4aetoif3oytlp   uvo;( srxm(o3ou1lmt  nvil(fsDrmxro;o4alenmoeiad sDeanvsnt0trxoif ootoaDrln sls sexrim3ou4aptelncsls s2trxro;o4ope  fetadfa2uan sn(0trxriocoodomtrlnvs;t trto(o3nu4op elnetasfsrrrumpnu1apt  fetaslm2uan p;()texrifctydfmtrlivs;s t2toir ny4ll nmicsltf Dtrxr ou0opeoio3iydfs2eau s;t) ltomf3oa1opte ivolt  exrxr oo1lpe  ncil( a2rrxro;o4olenmoeiyt m2rauvp;u)altrir3oytlaDe nvi;()sexm(o no4ame mfcilt) rtmx oot0aeto icildla2ea( p;u0 eeomr3ty1laDr uvils trxrxrpnudameelictatfsrrmu pot1oet if3iytfm ulnmo u)texnmf ty1laDr ueo;t0s2urio3ny1ol   fcils aDuru  nt0altn fcilslsDum( pnu0treomr oy1fp   u i;t srxrim3nodll nlnvi s a2rau oou4aetoifcias s ra(vpnt0texrxo3ia1fmD  ivs s)texrim iudaltn fei t  rtmxmono1tpeo i3ildlaDumnmp t0aetrxrcta1fmt an s () rxmxo3iu1alen fcilsfsrrr(r no0tpxn f3iysls2eau pnt0tetnirciadlmDeluvo;t0trxmiopnudop e ncsas) rurx o;t0alt mfciasfm eaums;t)aleomrcto1fa e ueilt  rxr(o3oudlpe  nvtltf rrmxmpnu4oexnifctadfs rm( s t) eerxr oadla  auvs;t) 2to(r iudol elivt tf Drru pnu1oetnmociat s uan s;(4teeoxr3todlp e nes (0 etmxo3iydamenlfetatfa2rmxmont1oltomi3tytlmDraumpnt)arerxr3todlp  anvo t) 2xmio3iudole  ies tfsDumxr nt0aetomoctysfm2rluvon(0 lerircto1lptr ieils sexmxm3iu4ap   ieiat) 2rmx pno0aetoio3tlslm2raumo (4tetnxocio1faD  neo;t sruoxr iy1ale mfeslt sDtau o;t0openmoctltfm rlnmsnu)tleoio3iatfat anesl() 2xr(r3iy4lpe mnetl(faDua(mooo0alxnmicild a umnvp u) rtnmf iadla  auei;t teurir iu1lle  fvsl() 2rr(rpoo0tex mi3tys a2ranvpnu0tlxomo ty1lateaieolt trur(o3nu4amtn ncsls s2rau  ot4optomfcils sDua(vp;(0arenxo oa1omD luei (0 exrxo io1optemncsl(fsrrmuro;t4tpe  fciyslm rauvp t0alermo3tytfmt  ivslt)t2xm(m3oy1olenlfeil(farra(ro;o4oex mfctysla2emuvon(4 rxrio ty1fpD  ieo (  2xoiopiu4lmt lici (faDurxmo;o4alto f3tysfmDemn o t0teermr3oydomt  nvi ( trtrxopiu1ope  ieta( arrrxrp;u4alxn feilt mDrln s u0 lerxf3todopteau o t s2tmxm oodaltelfvs ( aDumxmp;u4oltomo3iad aDuln o;t4trtrxf3oydom elueo;s)s2xo(o3ny1lptemivsls)aDur(m ot4alenioctaslmDuanmonu) eerxo3oydlaDe nvi;t0s2uoim oydap n iciasfaDumxmpot1oleomieiatls rln p;(0arerircootlmDe nei;t0teumir3nu4op elfcia() 2umxmpnu1aexo ieiydlm2ul( p;u) ltrif3tydomDelieo;s0t2xm(o3iu4amt  iesas) 2tr(r nt4tee iociydfs2umu pnt)texoxo3oytoptrau s;()srto(mpio4lmt  ncil() rumur oo0texoif3iatfa2ea(vp;t4trenmr iatfptrli s t  rtm(o3io1lleemivta( s2um(ro;u0tpx iictadfaDuauvo;t)trtnxr3oo1fp elu o;t0 2tm(o3oo4ameelfci ( s2tm(  no1oltnifetatls2ra( s (0 renmf iydomtean o s)trtm(m3nu4op nmneslt)aDuaxrpou1tet ifeiltlm uan snt)tetoxf ia1oaDeau o;()truoiopiu4al n ncslt  2umumont1opt io3ild s rmnvp;u)arxnxrcootfmDeliesls t2xmxr3nudapee ivs ( srrmx  ot1oeenmf3ilslmDemuvs t) lxrxocoytoaDrlnvi s0sruo(m3ny1ol e fet t  Drrxr nu1tpeomociltla2ea( s t4 eenio iy1latraivs;( trxrxmpoydop emies (  2trx ono0alt miciatfa2ean snt)aetriocoydfpDr nesls)t2tmimpou4olt lnetlsfs2rmumo;u0olto ictatlm ul(mp;(4artrir3ta1oateli o;(0 euo(r oodolte nvsas)s2rm(m ;o0ole ioeiadfs2rmnvo;t4 exnxr oo1opDr ivo;( srxrxo iodal   fct t)aDumu  ;o0tlto ieiytlm2ra( s t0arxnxf tydlmtr nei;s seuoxrpiy4oleemieta()aDrmuro;u0opx moeiydlmDul( sn(4 etrmr3iodlaDeaivils) exm(m nudlltemiet tfs2taur oo1tee iictasfa rlumpnu)aetnio3tadfpt an olt0srxmxm3oo4lp emfcsl(fsrtm(mo;o1oetoio3tlslm2em( s;t0aetnio oo1oat  i o ()t2uo(m3oo1lm  micsa(fsDumumpnu0alx mociydla2ea( onu) eenxo3tydfaDraivi s)srxrxo iu4lme lnvias aDurxmp;t0apto feiyd a2uau p (4tlxnmo tadlpt ln ols0srxoxm io1al elfcil() rrrx  oo4tptnii3tldfaDea( o;t0tlenxrctadlmDr i o;s)trtoirpiy4apte fvia(f Dtrxrpot1olxn ictatla2emnvs;t) etnxrciadfptr i i (  exr(o iydolte ncils arrrum ot4tptoiictatfa2uanmp t)teeoifctadomDe u il() rxrxo ny4alt  nvs s)arrrx o;t1altomoeiyt m rmnms u0texrxfciydoptraneo t)trxr(rpoo1lpt  nvias srrmxrooo1oexn ociadfsDulnmp t4 rxnxfctydomDr ies ( sexmxo nudlpe livi sf 2ur(mpoo4tpt  o3iasfa emnmo;(4 eenmr oytfmDeluei t) 2xmim3nu4al nmfeiltfaDtau onu0tetn octyd aDrl( p;(0aexrio oa1oaDr uvi (0srtrim3nu4ap   fesatfsrraur no0oex  ociydlm rauvo t) rermo3todopDr u i s t2xoxm iy1ope  nvil( artrxmonu0openmfcildfm uauvs () eerxrctadfaDraivs (0teumiopnydolee icil(fsrrrxrpoo0oet iocilt a2rm( o;(0areomrcta1lp r nvilt0 exrxm nu1al nmncil() rtmx p;o4optoioetad s2rm(vsn(0aetnio ty1lmD lneilt  ruoir iodop elivt (fa2urxmp;u0tlto iciasfa ea(mp t0aeermf3ia1omDeau i;s)setoirpoy1altnlfvilt) rraxrpoo0tltn f3tytfsDua(mon(4treoxf tatoateluvol( seum(r oy1amtemivslt aDtr(  nu4ape ioeiltfmDrauvo t)arxnxf3ia1late nvi t trtoim oodlptnmiet t) 2taump;u1tlt mf3iyt sDeanmp (0tltoir ootfm e i o;t0t2to(mpoy1altemnciltfarrrurp;o4openioeiyslsDuauvs;()areoxo tadlm e iei;( tetoxr3ny4lpee nvtl(farraxr nt0tetniociydla2ran p;(0 renio3ta1oatr nesl( s2uoxopoo1op elnet sfsDua(r ou0oltnifetad a2umnvo;t0arxnxo oodlmD liei;s)sruo(m oo4omeemfvtlsfaDra(mo;o1opx ifeildla emuvo u4altrxr3tadfpDr ies;(0seuoxrpoo4altemfvtls)a2tm(rp;t1tptomf3tltls2um(ms;t)aeeoxrcoytomDe n o () rxmio oudlme  ivtl(f 2ua(mpoo1aptnmiciys mDelnvont4trxrif3to1oa  aneslt0 etmim nu1lm  mivtl()a2urx  ou1teeoioeiyt m2ran snt)aeerxr3ootlateliei t) rtoxrpny1oltn nvtl() rur(mp;t1oeeomi3iat s um(vp u4 rtoifcta1oaDr uvo t0 2urxm iudoltnmivtas)s2umurp;o1aet  fctadfs ulnvs;u4aeenmrcoydla rln i;() 2xo(mpiydlmtnlfeslsfsrtrxrpot0tlxniociadla2raumo u)tltrxfctatop raies;t seuo(m oydlle livt s  2raurpnt4alt iietlsfmDrm(vo (0teenmf todfpt an i () 2tr(m oudamt lietlt  rua(ro;t4tltniieiltfaDrmu p;t4aleniocoatop eln o;t0srxmxopno4apt mnvslsfa2tmx  nt1tlxn f3ilsfa el( onu)alerxr iy1fate ueo;s)t2xrxopoodllte ivi ()aDtmxmono0tex  fctyd m um(vo;u4aetrxfctodlp e ueol() rxoir oy4lltemnes ()aDuaumpno4alenifeildls2uauvo t) lxrxo ootfmD li o;t) rtr(o3iudll emfei sf Drau ooo1oeto ieiytla um( p;t)arxrxo iy1fpteai i;t0s2umio3iu1lp   fesltfaDuru p;t0aeenmfeiysfm rlumo t4altnif oydlaD aies;()teuo(mpiydomt  nvia(  Dra(  nu4tleoiictlsfs2ea( sn(4tetrmfcty1lmtraivil(0trtmxo oydap elfcils)arua(  nt4apt iiciysfs ra(vsnt)trenxoctotoaDe u i;( teto(r nodolte nviatf 2trxrpno0oee iociadla ea( s;(0aeenircoa1omDrlnvi;s0texmim3io4lmt mfvt t srtmx p;o0tpx miciysfa elnms u) ltomfciotfaDranei;s0sruoxo oudom e ietlt s2ra(r ou1aex  ieiat m rmn pnt)trxnif3io1fpt auei;s srxr(mpiydoltemfvia(  rra(m nt0tlxoioeiatlsDeanvp;u4tleoif iy1lat livil(0 2uoxmpou1opee nvsa( artaxmont0aexoiieiasla2umumo t4areomrciadfpD lu i (0 etoim3oudap nlfviat s2tr(  no1tpt mfctasfm rmn pn()tetoxr iatfm e nvslt0 rum(r oudom  lfct (faDtrxm ;t4alenmoeiltfsDrl( o;(4 etnxf tytlaD lu s;(0 rumxr3oydal e fviasfsrtm(rpou4alt iociatls2em(vsnt4alxoio3io1fp rli ilt setmimpiu4al e icsas)a2urx pot4tpenmfeiatfm2emn snu4alxrxo3iytfate ivils)tetr(mpio1ll elivi t)sDtr( pnt0aexnioeiadfs el( sn(0alerio tytopD  ueo t0s2uoxrpou4oltnmncsas  Dta(moot1oetomiciysfa rm( p;t4 leoif iydlpDeluvo;s0 rxrio3ny4op e nes tf Dumu p;t1olx ifctysfs raump;t4arenmo ia1fpD liesl() exrxmpno4altn nvs sf Dtmur ;o0aexnmoeild mDum( p;t) lenxf iodopt  u i;t0srur(r3oydaltemivsl(fa2tr(rp;o4aeenmo3ils s rlnvp (0teeoir3tadopteli i;()s2urir no4lltnmict t)sDraurpot0oee iiciatfa um(mp u) ltoircoo1fp e n o s) euoxmpoo1apt mfctasf 2tm(ro;t4alenifcild a rln on(0aetnxfctodlaDr i s ()setr(opoo4ome lics sfsrrrurpou4opxo feiat mDumn p;u0tltrmf oa1oaDrau i;( trur(r iu1ll n ieiasfa2raurpnt0opto i3tadfa uln p u4tlxnmo iodlm rluvo t0s2triopnudllt lies s aruru  nt0aptomoetas s2em(vp;(4trenxo3tatlaDelivo;t teum(mpiodlmtnmnetat)s2tau pno4tpx  fciyt aDuluvo;t) eerio3iydoaDe u ils0 2xmim iudale mivsl( sDur( onu0oex  feiysfa uaumo;t0 etnmo3ta1oa eln ils s2uoxo oy4ap emieilsfs2taumonu4tetnmietytfs2umump;u4 rxrxf3oo1lpDeln o;()t2xm(opnu1optn fciat)artr(rp;t0aee  f3iltfsDul( s t4teenmf3iy1op raiei t t2um(r3nodopteliei t  2trx ooo4aeeo o3iyt s2rln s;(4trtomocoa1oaD luei s  2xr(mpnodalenlfet (f 2trxr ot0tetnif3tyt a2eauvp t0 lxrmo3iatoat livi;s truoxm3iu4altnlivt ( sDra(rpnu0optnmfciasfaDua(mp t)arxnxr oytlptelieo t s2trxm oydale mfeil() rtr(r nu0tex if3ilslm umnvont4 rxrxo ta1fm eauvol()s2trxm no4al n fct () rtm(mooo0oetoioetat mDrlu s u4 lxrmociydlp eli s;s t2tmxr3nu4omt lnesas)arum(  ;o0ole mfctls s emuvo u4arxomr3ootom  lnvi;t)srumio oodoltn nvtlt)aDurxmpou4teto o3ils a el(vpn(0aexnxr3todfpt  u sl(0t2uriopou1omen nvi s sDtaxm ;o1oleomocils s elumsnt4 exnir oydlaDeaivo ()s2tr(o nodlp  lfetat)aDtmx p;u4opx ioetltlmDeln s ()artoifciodom elu s;(  exmimpiy1lme lies tfaDrru onu4optomfciatfm2emn on(0aeenmf3iotfmtr i olt0 rtoxm3oo4al nmivt t) 2ta(  nu1tlen f3iltls ua( pnu)trxnmf iy1lptrau sl()seto(r3nu1apt  ncilsfaDrrxm nu0oetn f3iadfa2umn on(0alerir3oytoatran s ()srtrxr nydlmt lnvsa()sDrru oou4aeeniieiatfm emuvp u) eermr tydfptrlu o ( texo(r oydoltnmnvtas a2ta(moou1opxomo3tldlaDrlu snu0 ltrmrcta1opDr ues;t sexrio iodamee nciat)s2rru  nu0apxoioctltls2umnmo;u)arxnmfcio1fmt  nvi t)seuo(o3nu1ap e ivt ( aDurumoou4tpe if3tadls umn p;(4arenxfcootlptr nvslt0tetoxm io4lm e fciltfs2rrx oou0tpe ioeiadfm emumo t)artrir oydfmt lies;t0trurim iy1lpen ncsas)srtrxrooo0optoioctld m2um( s;(0 etoxo to1lmDrlieils0t2uoir3oy1omee ivslt sDra(ro;t1tltn oeiad a2ua(mp u)trtoio tadfat  n o;s t2xrxo io4omteliesls)sDraxrpou1aptomoeild m2eanvpnt0aeeomo3oa1fmtr ivi;( t2tr(r3io4openmfciat)a2raxr ou1apxomoetytfaDrl(mp (0trxrio ootlm rlnei;s0 2xoir3no4lpe  fesl()sDurum ;u0tptn fciysfaDemuvs;(0 reomf iotlp elivo t s2xo(o nudomeemnctls)arumumooo1apto feiadla rmn p;(0arenxrcoytlmD  neo;t0trxoim iu1llte nctlt s2tmurp;t1tlx if3iydfm uauvo;t0aeermr3to1omD  uvo s setm(m iydopenmieta( aDtmx oou4tet  fcias m ul( pnt) reoiociadlpDelnei t0t2tmxm3oo4ome mivilt sDrm(r no1olto fctyd m2el( s u)tlxoiocia1oat  u ilt  exo(rpoy4ll  lict s) rrmu ono0olxnmietyslsDeanmo (4 ltnmrctydfmtrlnvi s0srxr(o3iy1lmee nctlt)srraxr no0opxn ocils mDea(vp;u4arxrircoodfp  anes;s)srurio3iudlme mnet sf 2tr(ro;t0altoiieiydfaDul(mp u0artnmr3io1omtelu s;()seumxo io4ol  mfet s sDtax  ot4apxo octadls2raums u0alenmociytlpDe i o;s0texmxm no1aptelivils  Dtrurpot4tltnmicilt m ra(ms t0trxomf iotlmDeau s;t srtr(m iudal elfvi ()a2raxr no0oet iieiad a emnvp;u)texoxo tatomtranes ()t2umim3iydoleelfcias  2rr(r oo0olenmf3iyd a rm(mp t) rxnif iotoa eaueilt s2to(opnu4amt lici s  rraxr ot1teeomiciyd m2rm(mo;()texnmr iydfaDr u ils0s2xrxmpoydamtemfvtl() Drru ono0ape iieias s2rau p;t0 renif oodom rlneilt)trto(mpiodop  licsat srumur nt1olxnmo3ildlm umnms u) exomrcoa1opDelneo;s)t2to(m3io4ll  lfvi t)s2raxrpnt1tltnmiciysfaDra(mo t4aleoxf3oy1om elu olt  rtmxmpiu4opeemnvtat) Drau  ;o0tltoiiciyd s rmnms u)artnmf3iotfpD livi ( t2to(opnudoltnmnvi t)arrrx pou0tlxnifeiadls rluvs u) leomf iodopDrau i s) 2xm(r oodolt  ici t)aDtrxm ;u4aee  feiytfa2rl(vs u)texoxf ta1op rlueo;t)srtrxrpiodlptn nvta(f Dum(ro;t4opxoio3iatfa2em(monu0 reniocia1oa rlieilt srurio no4aptnmicsls aDrrumo;t4apxnmfetad a emnms;(0altoir iotlptran o t0 2tm(o3iudlp  mieias  rurxroot0apxoiieiysfm em(vsnt0teenio oytlpt  ivi;t)srtoxr oydlle  ivsls)srtaum nt1aptnmfeias a rm(vp;(4artrirctydlpD au s;t  rtoirpoy1lpee ivil( sDtmu o;u4aeeomfetlslm2ra(vp;t0aleoio3iydoptr ies s0 2tmio3ny4lp emieil(faruaxm ot0tex  fcilslm eauvsn()arxoio to1lmD an i s0t2urxo3ny1ap  mfeilt) 2rrxm ;t1ole iictytla2umump u)tltrmf3io1oaDe i s s0t2um(r io1omtemnct (fsDtaum ;o1oet ifctltlsDrmumpnu4 lerxf3oytoaDraueo;( texrxo3oodopt lncs tfartrxmpot4aeeomieiys a2rmnmo;t0aeeomo ootopteanvs t)seuoiopou1lpeemnetl(fs2taumo;o4tlt ioeiytfa2emnms t4artoircty1oatran s s) rtmir oy4omtelfeta(f 2rm(r ;u0teen ieiatla2elums t4 etrircoy1opDrlneils trurim ny1al n nvs s  2rau poo1texnif3iydfm2ua( p;(4 rxrmrctodfpDrluei;s trtm(rpio4apt  fvt s sruaxr ;t4tlto ietltfaDea( p;()teeoir3iadfaDr uvil(0teur(mpnu4opt mivtl() Dumx  ;o4tleo ietatfaDrmu s;t)treoxocoa1fp  luvils0truo(r3ny4lp   fcils a2rmump;o1oeeoiiciltlm ul(mo;t4areomocoo1latrai s;t) 2umim io4lpen ivi (f rtaumooo1olxnifcilslsDuan p u4texoiociy1fmt  i s;s0 exoxr ou4lltnmnetl(faDtr(rpou1tee mieilslaDumu o t4trerif3iotom e u o;s0seum(o3iy1alte nctlt sDuru  oo1ale mfctytfmDel(vs t0 lxnxr tadla eaieo;t  rxrirpoo1lpenlieilt)s2rau pnu0tee ifeiatfa uanmp t4 etrmf3tadomt  n o t)srxoirpoo4oltnlncs tfs2ururo;u4teeniieiasls eauvo u0teenmr3tydfp   ues;t0truoxo3ou1llt livtasfaDur(rp;u1olxo i3iasls2ua( on(0teenmf3tadfatr i i;t) 2to(r ou1lpen ncs ( sruru ono0oetomieiydfs2rmnvsn(0tlxnif3oo1lpDrlnvs;() rxoxrpny4ome mict ()s2rrur oo4apeomf3tls a ea(mp;(4aeeoiocia1lmt  uvo;( tetr(o oy4lptemfviltfaDur(ront0oltnmfeild s uluvonu)trtnxr tydomtr nei;(0texmxm3nudaptemieias) Dua(mpou4tet mfciys sDrl(mo u) rtrxr oadfm   u i;t)srxr(o ny1omt  fvta(  Dum(  oo0aexomi3iytfa ua(vs u0teermo3oydfa r nes t)texoim3oy1ope livt tfs2uau poo1alenmieiydfaDea( o t)arenirciatlaDeai i ()t2uoirpnudal nlfvt t)aDrruroou0olx  f3iadfsDuanmsnu4teeomr3to1fpD au il(0trtrxopnu1oltnmnesat s2uaxrooo0aeeo ictytlmDua(mo;()tlerio3iadfp rln o s) 2xrir3iu4altelfvia( s2ra(rooo4teeomi3tatlsDeaump;u0tlxrxrciodlp  lu o t s2tm(o io4lpen iciasfartaxmono0apt iicilt a rlumpnu0 exomr tydom eluesls t2xrxm3oo4ole mies (fa2trx pou0oeen octyd m2emn s;u4trerif3oatfp  aivs (  2xrir3io4ol nlivias)aDumum ;u1alt mociytfm rauvpn()arxrxf iodoat anvol( setmio3ou1amenlnctlt aDrm(mpnu1tee mfetyd a rmuvpn(4 rtrxf oydopteaivsls teur(o iodol e fvt s srua( oot0tlxn iciltlm2um( o;t)aetrio3oydfaDe i il(0t2ur(o io1lp  livi s a2taxmo;u0apx mociltfs ranmo u0 etrmf3oatlpDrluvs (0t2xmiopio4lmeelicsat  Dtr(r ou4tlt mocild m2rl(mp u0artrmr3oo1lpDelneo;s)t2urio oo1lpt mfvsl()srta( ono1opto ietas a el( onu0arermf iodfmteauvi (  exm(m ny4alen ictl(fsrrmx ono4ape iictld mDem( o;u) etomrcoa1fatelivolt) exrxrpou4aptn fes t)s2tru  ou4teenmieiltfa2ra(vp;()tlxnmocta1faDr uei;s seurim oudamee ivsa(faDtmumo;u4apx  i3iyslm2rlu s;t0texomr tytlm r nvols)texrxm3iudope  fciat srtaum ;u1oeenmi3iaslaDrlnvp;(4aeerxo3iy1oatrlnvil( seurxo3oudopenlneilt)s2urx  ou0olto fetatls emumont)artrxf todfa rau s;(0teuo(mpnudlpt lfcia(f Drmxrp;t1oet mo3iad a2eluvsnt) exrxocoadlpD an i s0 2xm(r3io4lltn ivs (farrrump;u4tetnifcildlmDelumsn(4tltrxocoadop rau o t t2uo(m3nu4aptn ics ()sruauroot0olx io3iatlsDua( ont4artnif oy1op e u s () rur(rpou4amee fvtatfa2rmxrpnt1tlx  o3iatfa2ran p t)artomf3tadoat aivi t0trurxmpiy1lptnlicslt) 2tru o;t1tet  icildfaDuanmsnt) lenmrcoadfatelu i;(0trtr(m3oudlpt mfvi (fsrur(ronu4opxn f3tlsfm ul( p;t0 lxoxfctydop   ueo;()s2uoxmpoy1lmtnmivi s)a2tmxm nu1tpxn feiatls elnvo t0 rxomf iy1fp r nesls)sruoxm ny1altn ivt sfs2uru o;u1opt ii3iadfmDuln s;t0tlxnio3todfaD ai i;s) 2trxopnudlme  iciasfaDtr(r ;t4oetomoeildla2eln p (0 ltrmoctytlatr i o;()seuoxmpnudamtemfvi tf 2rm( oot4apt moetysls uan pnu)tlxnio3ootlmtrlnei;(0 exmxmpoodap emieiat)s2ta( o;o4oltn feiatla ea(mp;t4tlerxfciadop eaues (0trtm(m ou1ol  lfetl() 2tm(mpoo1texo ociydlmDean p () ltniocia1opteai slt trtrxm iydap emnvt tf ruau p;u4tle  iciysfm2ranmp t)aeenir3ta1lmDrlivi () etrxm3iy1ap nmict t)sDrrur nu1opeo octld a el(mo;u4 rxnif ty1opD  nesls) eurxopoo4lptn ivils)sDur(rono0tpt ifeiytfa elumonu) ltnio iadlm   ues s texmxo3no1amtnlfcilt)a2taxmpnu0oexnif3tytfm ua(mo t0 rxoxf3ootlatran sl()srur(r nydapenlfei tfsDtauroot0open fctadlm uln p;t4arxoxfciadfmD li sl(0srur(opoodlle lfcsasfartr(mo;o0opto fctytfa emnmo u0 leomfciatomDe ivo;t seurxr3iu4op emfviat) Duaxmpnt4apeo ictydla2ea(ms;u) lxnmrcia1oaDranvol()t2umxo nu1opt mnvtltfsDtmu pot4tptnmociltlmDum(mo;()texomr todopte ieo s0t2xmxrpoudap  mfvilt)aDtm(mooo4olxnmicils sDea(vs;t0areriocoadfp   i s;(0srum(rpiy4ape lfviat arra( o;o1tpxniociad s eanms ()tlerio tatfmD  ues t0 exoio ny1olenmnesas  Duau ono0openmociasfs emnvp;t) ltnmr oy1fmDelues t  exm(o ou4altn neias)aDurxm ;o4tex mociadfmDrl(vs t4 rxriocta1om  anvo;s setoxmpiu4al elivi t  Dum( p;u1oetnmicild aDem(vs;() exrmf3iadlm e nes;t0t2xrirpiu4lle liei (f ruaxr ;u0oex mietydfa2eanmo u4alenxf iytop  anesl(0 euo(m3nydom nmfcs s)aDrr(m oo1ole ioeiadfmDua(ms;u)tlenmo3iotlpt aneilt0s2toxr3iydlm   fetl() 2umurpnt4oleoioctaslaDrmu p t4artnmf iy1opt  iei;s)s2um(rpiy1olt mfvi s  Dtr(  oo0tlen iciasfm2umnmp;()tlerxrciadlp rauvs s) rxr(rpnu1ale  nei (  2rrxrono4apx ifeiatfs eln on(4 eerir ty1fatran o s) 2xriopoydlpt  nci tf Drr(ront1openmf3ildfs2emump t0tltrir3ootlmte nvsl(0 rum(m3io4altelfviltf Dra(r no4oet ioeiadla elumsnt0tltnmfctytfm e uei s texr(m io1ll  mneia( arrmxrpnt1tlxoioeiltfm2um(monu4tleomfctytlatr nvols srtrio iodalee fetlt sDuax p;u0oeen o3iat m umuvpn(0artnmrciodoptrlnvsls0trxm(m3oo4om e fesasfa2ta(mo;t4tlxo ietlslmDelu p;u0 exoxfcoodoate n olt0trum(m3iodap emnvslt s2tr(rooo1aptnmiciytls emuvo t)aeeoxfciatomDelu sls teurxo3ny4op n ivslt)aruru poo0oleo oetytfs2rmuvo ()arxrio oy1fp rlivo;t)t2xmimpno4alee ncsas) 2umu  ;u4ape  iciydfm eluvp;(0tleoxrciy1om rluei;(  exmxm3iy1lp  lfvi ()a2rm( o;t4aet ioctaslm2uauvs;t4alenifcoo1fptrauvs;s srurxopio1lm   fci ( a2ur(rp;u4texoioeiysla eln on()areoxf tatfptranvs;t0 eum(r3no4lpe liei s)sDtrxm ;t0alxn fetydfm2elumo u4tetrxf iytlaDrln o t0 rto(mpiydam nlfvia( aDum( o;t0opxnmfetltfsDel( p;t) leoir tydfatelies;s0s2toim oydlmte ieilt)a2ua( pno0oleomoctld sDemuvp;u4artnxfcoa1fp rau s;t  rxrxm iodlpenmieias  rum(r nt1aleo i3iydla rmuvp;t0texnio3ia1fa elivs;(0teurirpoudalt  ivslsfartr(mp;u0ole  ietls a2rlums t4alxriocoy1fpDrlu s;s teuoim iu1alt mfvsat  Dua(  no4apxnmf3tldlsDul(vsn() exrxf oa1fmt lnei;(0 rtoirpiodaptemfcsatfs2tr( pot0olxomictysls2ulu o;u0aeermo iytfaDraiei (  2ur(mpoy1amtnlfct ( a2ur( o;u4ole ifciysfmDrluvp t4altrirctytoatr n i;t)srxrir3nodol   fvta( a2umu onu4aexniictyd s ranmp;(0arenxfcoo1lmDelivil( sexoio3iy1lpeemnctat)srtm(m no1oetn fetadfsDean p;u0 rxoircoa1lmtelu i t t2toim3nu1apen ncil(  Dum(mpnt4ope mo3tltfs2ua( o;t)arxoir tadfa  aneolt s2trxr3no1ol   nei (fs2ta( pno0tle  o3tysls ra( s t0altrmf oy1oat aneilt0 2xoxrpny1om e nctltfaDumxrp;t0ale  o3iadfa2ean o u)trxoxf tatomtrluvs ( s2trxo3oydlp e feiasf Drrxmp;t4tetnmoctasfa2umuvo;t) rtoir iy1lm   i olt) 2uoio3oy1ol n ieil( srumurp;u4apt io3taslm ea( p () lenir3oy1fpDr i o;( trum(r3oy4lmt mieil(fartaum ;t1apt  o3iaslm2rl(vonu4 lenmr oy1fa   u s;t texr(mpoo1altelfeiat srrmxm ;u1alxomo3tytfaDranvo u) rtnxf3iy1fmD ln s;s) rxrxr3ny1aptn ieta(  2tmu ont1aptn octys s2rl(vp u) etrxf oy1lpDelneo s)srxoim nodoleemfctat  2trx onu0aptn ociadfsDrmumo;u) eenxfcia1faDrln s (  2umxo3nudlp  mies ( srtrxm ;u4tpeomoeilt m2eluvp;t)trxnmf3iadfaDeli o;s)tetmio3nodopeeliei t sDrau o;o1apto feilsfaDelumon(4 ltoxf3ia1fp rluvilt trxoxm io4ame lnctls a2ta(moou0texo o3tad s emnmpnu0altrxrcoo1op rau sls sruo(m nu1opt micslt  Draump;t4openmf3iyt a2eanmpnu)texnir tatfmD anvo;s) exrxrpoy4opt mict t s2ua(mp;t4tex mictaslaDra( s;(4 rxnmf3tatopt  ieo s0 2xmirpio4lme mfvils)arrr(rooo4tex iociltlaDumnms (0 eeoxr3oydlpD luvi s tetrim3oudol   fesl() rurx pnu0aeen o3ildlm elu s (0teerifciadoa  lieslt) exm(opio4lpenmivslsfs2rauro;u0oee  i3ias s ean pn(4arxnxo to1oaD liei;t) eurirpou1optemiviatfsDuaxmpoo0aeeoif3iatfs2umn onu4aeenxf iodfp elueol() ruo(rpiu4apte iesls)s2uaxrp;o1tetnmietatfaDeaumo (0tetoio todlatrluesl(0 2xoxr nodameeliesat)s2tm(ront1tlen fciad s umn on(4aetrxr ootlpDelueols0srtoxr io4lmtemfeta()arrmum no0tlx ioctadfmDrl(vo u0tlxrmf oytfmteai o s0seur(r iodlleelivsl() ruaxmp;o0opxnifcilt aDumnmp;t4arxrmf oadopDe n i () rum(o nu1omen nvtas)s2urxrono0olxoifeiyd a ea( s;u4aexrmrcoytlpt  n s;s) exm(rpoudope mnesa(fsrurumo;t1apt  octad aDumuvo;()tlxnxociadfpDeauvsl( tetmxm ou1aptemfvia( sDtr(r ot4opt  f3iysfa2rmumont0teerif3ia1lmDeaivsl(0 rurio iydol  mfvt s sDurxr oo1olxn i3tlt a rau p u4artoiocoytlaDeln i t)t2xmimpnu1llee fcils a2tr( pno1oetoiietyt s ra(ms u4 rxrir iydfmt aueols0teto(r iy4oltn ietat  ruaxmont4teenif3ild m2emump () rtrio3oodfm eluvi;s0srtmiopno4lm  mivsasfa2taxrpou1tlto ieiysls2uauvp (4 etnxf oa1faDeaneo (  2umxm ou4ole lfcias) 2urum ot4oeeo ociydls umump t0 exrmf3totla rlneils srxo(m3oy1lle mivi t srumump;t1aexoii3iatfs2uau p (4 lxrxr iotlat anvils) exr(o3no1omee neia(faDtmumoou0aetnifeiytfsDum( o;t)artnircoadlp e neils0s2umir oy1ol nlicia( aDtaxmo;u0tpt ioeiyd sDranmp u) leoir io1fmDe ues;(0 rurxr oo1ol nlics s srurxmpno0olxn ociys aDean pn() rxoxfcia1fp  lieil( teuoim3iydomt mnciasfa2urxmo;u0tltoioeiltfm rm(vsnt4tlxrmo tatoaD  iei;t srtoim3iy1ap emnesat  Durum oo0tleo oeilslmDelu s;t0aetnio iodlm e iei;s teurxo ny4lptelictltfs2trxm ;o0texn iciadla2rmuvp (0aeermf iydfpDeluvs t  rtrxm iu4amt miesatfarum(rp;o1apx moetldfm2raump ()aetnmo oydla rlnvi s t2uo(opno1amtemivt s arururo;u1optnmocilsfm2elnmo (0aexrifcia1opt lneils sexr(r io1ol  liviasfaDururont0altnio3iasfa ranmp (0 exoif3iatop r ivsl()setm(r oydol   ivsl(fa2trumoot1teeoiietlsla2ulums u4tlxrmociatla  lnei s0 2xo(r3nu4ame liesls  Dtax pou0alx moetytlmDeauvs;u)aexoxo io1fp  livo;()s2tmxo3oodop  lfviltf rrau p;t0optn f3iatfm2rm(msnt0aeenmf iydoa  lues;t0trtrio no4lmtnmnct (  2um(m ;o0aetoif3ias a rmn s t4aleoxrciytlpt  ieo;(  rxmxm3ny4olt  fvsatf Drmxr nu0aee mfeiysfs ra(vpnt) rxoxfcio1fpDeai o;s0 etoxm3no4alt mfvt s  Dumu  ot0opxnifeiytls2em(mp t4 rtnmo oo1opDeluvils) 2toxopiy1lpe miciasf rum(mp;t4tpto fetat s umumpn(4 lxoifcta1lpDeaivolt0srxrir3iy4ame mieils)arua( ont1opxn fciysfmDul(vp t)trtoir ootomt au o;s s2umxo3nu1oltn nesa(f Dur(r ;u4oetoiicildfm rm(msnu) eeoif oydop e iei (  exrirpoo4al  lfvs t aDtm(monu1aptoiietyt m2ra(mo u4trtrmfctydfpt lneo;t setoim3ny4amenlfeia()srtm(ro;o1tet mieils mDuanvp (4 exrxociydfmD lu i;s  rumir iudaltnlnct s s2umu  ou0opeoioeiytfa2elnmpnt)alxrxf3to1om  lieols0 rxoim3nu4optnlnvslt)s2trxrpnu1teeniictat mDeln o t) ltoir oodfpDeauei s)s2xr(opny1lme mieslsfsruau  nu4apxoifctys m uau p;()aetnirctadfa  au i;(0tetr(o nydomenlict t  rrrxrpno1apx  fetyt mDulump ()altomrctytlm e n i (0 exmxr ou4lpe  fci s)srtr(r ;o4ale ifciaslsDuanvon(4 rtnmo3todfmDr iei s) 2xmxopoy4ape  fct (  2urx p;u1alto iciytlsDra(mp;t) eermfciy1fpt anvs;s srxoio3nodopeemicias)sDur(mooo4texn oeiltfm2uau o;(4 rtrxoctydla elivslt tetoim nu1altn nci s) ruau onu4alxniocilsfmDumn o t) renifciatfmDr ieslt)t2tmxo no4omt  nvsat  2rrxrpno4tlt iociysfm2um(vs;t0 lxnmr iatlmt  ueo;t) 2xrxr3iudal emivt (  Duaxm ou0aex iiciyslm2eln p;u0tleoioctotopt  nvils  2urir3no1ap n fesas)aDur( p;u0ope mfctls a rmu o ()tetoio3todoaDrauvo;t0trtrir iu4ap e nvt tfa2uru  ;u0oeeo ociyt m eau o u4altomo totlmt  nvo (0trum(opiu4ol nlnciasfsrtmxr nt1ape iiciad sDel(vs;u0aexrir3tytfatrlu sl(0t2xo(rpiu4lle lieslsfsDtmur no4olxomfctltfm2rmumo;t4tltoxf iatfpteaueils0t2xmiopou1am nmfctat)s2rm(rpot1apxoii3ias m elumsn(0artnir oytfatrluvilt)srxoxr nu1apeelnetat a2ta(  ou1apx mo3iysfm el(vs u)treoio3oytfm e u i;t sexmio3ou4omtelfcsas  2rr(rpnu4tlx iiciadla2umnvo;()tetrmfcootlmDeai slt) 2urio nudom e iet ()sDum(  nu0tlxnmo3tls s2rluvo (0 rxrmr iydomte u o t seuoxmpnu1ope mnesas  rrrum nt4olx mi3iydfa ea(ms;u0 reomf3to1fp e u s;(0 2xr(mpou1opt  ietl()artau  oo4tpe  fctlt m2em(mpnu)tltoio iydlm e u sls)s2uoxm3nodome mfvsa(  2tm(rpot0aet  ieiadfs rm(vpnt4trermrctydopDr u sl(  2xo(r oydam elncilsfarra(mp;t4olxnifciaslaDumu s;t4texnxo oytomDrlueol() eumxo3oy1am   nvsa() rtax poo4ape mo3iydfsDumuvpnt4teerxocoadop   ieo;(  etoirpno1lp nlfvsls)arraxm ot4aet mo3tys aDranvo;t)aetomrciytlm elu il(  2xo(m3nodlpe  fvil(  rum(ro;t4tltoifciadla uaumo;t)tlxrir3tatoptrlnes;t)truoxo iu4al  lnesat  2rm(mpoo0oetn ociat aDrlnmp;()areoif oo1laDeanvol()seuoxopny4oleelneilt)a2trxrpoo0texnif3ildfaDranmo () etoio3oadla  lueo;( s2umio3oo1apeemies (f Dum(mo;u4altnmf3tldlm um(mo;t0areomr ty1fateli s;()texmiopiy4omeelfetls a2rrum no0ale mi3iyd a uan s;t)alenmf ta1omte n i t0 2tmimpny1ale  ivsa(fs2rax  oo4texo oetls s2emu s;t0 rerxf3iodlmD auvs () 2xr(r iy4amt liesas  2urxmpot0tetoifeiltfm rmums u4 ltrxr3iydfpt aneo;(  rto(o3nu1amee iesa( arum(mo;u0tlxnifciyslmDem(monu0tleoiocoy1fa  auvo t0seurxr3iu4omtemfcta( srrax  ;o0tlt mieiytfm ulnmsn(4aeenxo ia1fa r ueilt t2urio nydllte nvtl() 2tm(  ot4opxn ieiadlmDul(vsnt4 ltrmfcia1lmtranei;s trtmir3iu1opee ici s s2tmu onu4tltnmociadlaDemuvo;u0 lxnmf iodoa e uvil(0 rtmimpiodam nmnvtas a2rau pno1texn ietytlmDrau pnt4trtomfctodop rli slt s2xrir3nu1om e nvi ( aDumurooo0aex iicilsfsDrl(ms u)tlerxocootopD ai ol(0seuo(m3nu1omt  fetl(f Drrur no0tlx mo3tlt s rmums ()trtoiocoa1op rau ol() rtoim3nydlme lfvil(f rtr(  ou4opeoifcilsla rl(mo t0arerifciotlmD aueol()t2toxmpiy4lm   fet s a2tax oou4alx  ieiytla umu sn(0 etrmrciotlmt aueol( s2umir3io1am n nctltfsrrmum ;u0aeto fciasfs em(ms;u)tlxrirciadop  luvs;s0teuo(o3oy1lpt  ivilt)a2tru pou0alxoioetld m2rl( sn() ltoiociadfp rlivols) etm(m3no1llen fvsl(fsrumurono4aetomi3iyslaDuanmpnu0tltnifciotopt an s t0t2urxmpnodom elnesat  Dua(r nu0tptomoeiydlmDum( p;()alenmf3ia1lateanes;s0 rxoirpoo1lpe lnvs sfa2trxrp;o4oetomoetadfm2ra(vsnu4 lerxfcty1lmD lnvo ( trtoxrpiodom elieslt s2rmu o;o1olt mi3tytlsDum( p t) lxnmo3oo1fat aieo;s s2uoim3ou4lmtemivs (farrm(ro;u1tlxn fctyt aDeau s (0tlenmoctodlaD anvsl( s2tmirpoudlp e ies s  2uau pot4tet mfeiat m um( pnt4 reomr3tatfp rluvo;t t2toxopoy1lmee iet s)a2umx  nt4tlto icilsfa rm(msnu0texrmo3ta1la rlieols0t2umxr3ny4olt mnesltf 2taumont1aex  f3tas s emnvo u0arxoxf tytlpDr uvs;t)seumio oydap   nvia(  Dum(  ;o0oeto i3iadfa uln s;t) etrxo3iytopDrlnvi ( srtoio3oudom nmictl(farrrxr ;o4olt moctatla2uanms t)tltomr3todlmte i s;s0 rxo(mpiy1ll nlncsls srtm(rp;u4olxoifciytfm2emnvsnt)tlxnmr3tytlaDeaueils0t2umxrpoo1omtnmfesls aDraxronu1olxomi3iytls umumo;(4artnmo tatfmt lneslt s2urxr3nydllenlfes sfsDtmx ono0apxo f3ild mDum(vp t0trerir oydlmt aueols t2umxo3oydal
\ No newline at end of file
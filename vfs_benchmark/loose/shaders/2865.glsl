@@ -0,0 +1 @@
+i o t0 2umxo nu4oltnlfct s)a2ra(mp;t0apen feiys mDum(mo (0trxnxo iodfptrlueil(0srxrio iu4aleemnctlt)a2trx o;t1optoioetaslm rl( snu0 lxrxfcoo1oatelueil( trxrxr ny1ol e fesat)aDrrur ;t1aetn oeiasla2rlnmp;u0teenxfcoodomteln s;s0 etmxr nu1omee nvtat artaur ou4aeenio3tydls2umnvp u4areoio3oydoaD ln s;t)seurxo oo4apenlfesat s2uru pnt4tle io3ias a2umnvo u4tetnmfciadfpt  n o;t) exo(rpiu4lpt  iciltfsDrru o;t1ale iieils sDua(ms;u4 rxoio3oa1late nvs t)s2tm(o ou4lmenmnes (fsrrrx pnu0tptomo3iat m eaumont4 rxrxr to1oaD luei;t t2to(m oo1lpenmicilt  Drr(rooo0tetoii3tasls emu p;u)tleoif3oa1fp e n ils)setoir oo4ameemnct (faDrr( poo0tetn o3tyslmDum( ont)tlxnmo iytlpD an olt trtm(o oo1ol nmicils)srur(m nu4aexoiicils s2eluvs;t4aetriociydoptranes;() eumio nudalenlicslsf 2trxr ;t4aexn f3ilt a2um(vo;u4alxoxr ta1omDranei t) exo(opiodalte fvt (  2umu  no0texoiietat sDelu o;u0aexoio3iy1fpDr nes;() 2tmxm nu4amee nvs () Drr( oou4tpenmi3tatla2uan sn(4 rtoxfcoa1omD livs;s srtoxrpnu4al  lfct ( sDrax  no4texnmieiltlm ra(vo u0 ltnxrcoa1lpDrlies;() 2xrimpiu4lmtn net s artm(rpot4apenmi3ilt s2rmnvp;t4 etnmf3oatlpDrlu ils0srtr(o iy4ope  ivtlsfaDtrxmpnt0opxn fctadfaDelnmpn(0teenxfctydfaD li i (  eumir3nydlm emfctltf 2uax oot0aleo ocildlmDea( snu0treoxfcia1lpt au o t0 rto(m ou4opt mfvtas aDur( ooo1tlx  ietyd a2umuvp u0 rtnio3oodlp r iei;t0 rtmio iy4open fct ()aDrr(rpnt4aetomi3iatla2ean onu) reoxo todfm e uvsl() rumimpiudamtemiviat)sDrr(  nu4ale  ictlt s2ua(ms;t0texnmr totoaDeai sls sexo(r oodopen nvil(fs2rax o;u0aptnmieias m rau o u4tlermo iodfa elnvs ()t2trxmpiudlme mictat) rtmur oo1tptnioctld aDemuvsnt4artoio io1lp  au s;(0srxmir3oy4apte fetl() 2rau ooo1oleniiciaslaDulnvp t4trxnif3iytop eauvo;s) etrir no1ll n ict (fsrrax oot1oet iietldla2rl(von()aetnxo oydop rli o s0srumxr io1am nlicta( srurxmpot1oexn feils s2rlumon()aeeoxf todlaD aueo;() rtrirpiu4am nlics ()aDra(  ;t0alxoiieiydfa2uau p t4tlenxo3oa1fatr uvsls s2tm(m3nu1apenlfvils s2uaxrpno0tptniietld aDran s;u4aeeoir3ootomD  ivs;()truo(m3oo1am  mieilsf ruaxr oo0aex miciytfsDem(vs t0aetrxf3oodomDranvols teuoiopnudamt  nvilsfaDua(mp;o4aeenmoetasfa2emnmsnu0alxoxrcty1fpDe uvo;t)t2xr(r iodlm  lfvia(  ruru o;o4apx iicilsls2ulumpn(4 exoxfciy1fp r neo t  2tmio nydllenmfvt t  Dra(rpot4tpeniiciatlsDel(mpnt)aexrmf oo1faDr u s t0 rtmxm oudapenlivsatfsrtmump;t0olto ociyt sDemn pn() rxoxfciadfptraieol(0seuoimpoy1aptemietlsfarrmu  no1olenmietydfs2em(vs u) rerxoctadla rlu o;( srum(m oydol e neslsf Dtaxrp;u4oeeoiociatfa2ulu s t4 reoxf3todoateanvslt t2urxmpnydapt mfvi ( aDur(rpnu4alxniiciysfm2emu s u4 ltnmociydopDran o;()sruoirpio4optn ncs s srta(  nu0apxnmo3iat m2ulnvsnu) etnmrctotlmD anvi ( t2xr(o3iy4lltn nesasfa2urxrpnu1alt moeiyt aDraumsnu4aetoxf3ta1fate ieo (0 2xm(m3oydlptemietas s2ra(rpoo1tpxn oeiatfm rl(mo t0alxrio iy1fpD ai o;t0s2trxr oy1llt lnvta() rtmxrpnt0oexoif3iyt aDrmnms (0 lxrmf3iadfm  lieil(  exmxr3ny4lpe lfctlt)srtaxr ot1opxo fetad a umums (0alenir3oadomtr ies;t  2urio oo4ope  fvtlt)a2tmxmpou0tet mi3iatls rlnmonu)aeeoiocoy1fp   u o t0 rxrxr3oydap elnetat aDra(mpoo4tpt mfctysls2elnmo t4aexnxfcoydfm rlivs t) 2toxr3nu4am nlfesa(  rrm(r ;t4olxn o3tls s ulums u4arxoxrctytlmDeai o (0seumim3nodol nlfvtlt srum(r nt0teeniocilslsDelu snt4texoxf oodom  anei s)teuoxo no1lmenmfctlsf rrr( oou1aet ii3ilslm ua(vs;(0tltrir oytfp r ueo;t  eumim3iy1lmtn fci () rtr(  ;t1tlx  fcild aDeluvo u)tlenircoa1lmDrau i;s)setrxrpoodal  lnei tf rrrum ;o1apxoio3iytfsDuaums;u4trenxo3ty1optrlu il(0teumxr3ou4oltnlfetl( srrmx ooo4aexn o3iltfmDea( ont0 lxnio3oatoa rluvs t trumxr io1ap  mfcia(fs2tr(ront4tpenmi3ilsfmDum(vo;()artrio3todfpDrauvilt0 etmirpoy1alt mnei t a2trum nu0tlxoiictyd a ranmont0aetrio ootfmDrlues s)trtrxopio1opt mfei s) 2ua( p;u1alx moeiadfs eauvo u4 etnmo3oa1lp  luvi ( t2xmxo3iu1lpt  nvtl(faDta(m ou0tpxn ocilslaDea(vpnu) exnxf3to1lm rlueol()s2ur(m oudalen icilt sDtrxmo;o0tpenmf3iatfs2ranmon(0 eeoifciotfaD aneil( s2ur(o3oy4amtemiei t)a2urump;t1teen fctytlaDrm(vs;t)arerxo ty1lm elivs s  2tr(m nudap e icsl(  Dumxrooo4oetoioeiat aDuan ont) eenircia1laDeln o t)tetmxm iu4ome lnvi ()arurxm ;o4aexoii3tytfaDem( on() ltrxrctadop r iesls)sexrxm3oo1lmee ivi t)aDur(moot4alt mieiatlaDeln p;t4aeerxrciydlaD aneol(0srtr(m ny1am nlneslt sDua(roou1tlxo fcild mDumnmpnu4trxnir3todlaD auvo;t) rtm(opnu1lmt mnctls)arrru ooo1oexnmf3ildfm2ranmsn()tlxoirctotomt anei s0setrxopoo1ape  ictlt aDumx p;t1optoiociad m ranvsn() rtoir oytfm r nvi (0t2umiopnu4aptn nvsa() 2rrurpoo4aptomietyd a2rln p u4tetrxr ia1oatr n i (0 exoirpiudapen nei t)arua(r nu1tpxomfcildfsDea( snt0 lenio3oytom r nvs (0sexm(o iodlpe liei (fs2tm(  no1apeoii3tyd m rmu pnu0 reoirciadfaD aivs (  exrxmpiy1lle  fvilsfaDtmurp;o1aet  fetls s ua( p;u4tlxoio3ta1oate n o s0 rxrim oy1lp emfei sfsDumu o;t4tpt iiciasfsDuau on()altrmrctatlptrln o;s0tetmxmpny1lltnlfcsls  rrrxmpoo1tex  fciad s emuvp;u)altnmocta1latr neo;() ruoxm io4aptnlnvt s) 2tmxmont0tpeoioetysfm2umuvpnt4 exnifciy1fptrlnvi ()t2xmimpoydamtnlivi ( a2rmxmont4tlxn feiltlm eaumo ()arxomo3oytoaDr ivo;( srxmio3oodop   fetasfaDuaumonu4oexnioeiat sDrlnvsnt0 etriociatlptr neils0seur(opio1lmenlncta( artm(  ;u0oee mi3ils sDuaumo;u)teerxocty1lptrli olt trur(mpiy1om n neta(f rrru  oo0tetniociysfs2eauvont)texnxf3iatlp e ivi;t0texoxmpiy1aptemncia() rumx  ;t1texo ociytfa2rau o (4 lxomrciadfat  n o t)teto(rpoydllt livilt) Durxrp;u1tpxoioetydfs umnmo;()trerxr totfa  luvsls setm(o ou4olte ies s)a2rrxmpnu1oex  o3tydfsDul( ont4trtrif tatlmtr i i;( trxm(r oy4om elivi s aDuaurpno4teeomietldlm2rlnmp t4 rxrmf3tydomDeau slt0 2tmxopoudom e ies (f rua(mpno1tpe ioeiat mDuan p;t)tltrmf3iodlatr u o ()s2xr(m3ny4ap nlieilsf rtrur ;o4tee mo3ild a eanvp (4tlenirctadomDr nvi t  exmio oy4al   iet ()a2rmu  ot1oltnmiciydlsDeauvsn()arerio3oo1fmtelnvi;t) 2xr(r oy4ale  fvias  2tmxrp;t1aetnifeiltfm2um( s;(4aleomo ia1opDeaneo t) 2trir nu1aleemies (f rrax  ot4aeen fciatfm rl(vp u0artnxfcoodfaD auvs;(  ruo(rpno4lmtnmiesltfa2uaxmont4tpenmieiys m2ra(mp;() renxo3iodlatean s (0t2xrxr oydole  neiatfsDur(ront1oee mo3iys s2ranvonu)teermfctytfpDe u o;s  2xrxm3iy1ole lnvs tfsrtaum nu1tetoii3iysla ua( s;t4aetoxr ta1fate nvs;s srurxr oy4lmt mnviatfa2ta(m ;o4tptomiciydlsDra( snt)trxrif oy1opD lu s ( s2toxo3oodopt lietas)artm(ro;t4altn oeilsfa ean s;t)arenxo3todfateanvi t0teur(m3iy4ome mfcsat) Drmumo;o4apxn oeiltlmDuluvsn() etnio io1fpD  i o ( s2xmxr nydoltemnetas)aDuaur nu4optn ociatfaDua(mp;t)aleoxoctodoaDr iei;(0tetrxo3oo4ap  mneil(  2rmxr ot0aetnmoeiasfa ra(vp;t4aexoxocio1lptelu il(0 rtrxm no4al e icta()aDtrx onu1tlen o3ilt m2umnvo ()aeerifcoadop  aneolt)t2uoim3io1ll nlfvsatfaDumur oo1teen f3ildls2uan s t0 reoif3oadoaDeanes s0s2umxr3nu1ol nlnci t a2ua(m no0tpeoif3iyd s rm(vp t)aeeomf iotlaD lnvs (  2umim3oydalenlieiatfa2rrxmp;o0apt mfctas sDran o;u4trtrmr tatopDeaivi ( sexm(o oy4ol n iesls) rua(  nt4oex mocildfa2ran o (4aexnxo3totfmD lu o;t0teuoxm3oo1al e icsasf rta(ro;o4optnifciysla2um(vpn(4teenmrciadoptelu ilt  2urimpiu1opte nvia() Dtm( p;o0tetnif3iysls2ra( p;t4tltnxf to1lpDr uei t)s2umxm nu1ape mnvt () rumump;o1olt  iciysfs ulu o;(4 etnmf3iadoatr u olt) 2umxrpio4aptemici sf 2rm(  no0oexomo3ilsls ua(mp;u4artoirctytfmD  i o;t0t2urim3oydole lfcsl(faDtmumoot0apeomfeild aDem( s;(0 etnxociodlm rau i s srtoim nodol e fcias)aDrmxmo;u1texomoeiad aDrau pnu) etnxr3iotopDr ivo;( t2xmiopnydllt  fcias a2ururoou4alxn oeilsfm2elnvp (4tlenmr iodoa eauvo;( srtoxo oo4omt licias a2taxrpou1tpto iciytfs2emnvs;u) eenif3oo1lm rau sl(0s2uoim oydomte fcs s  rtaumpoo0oeenmoetytfaDuan pnt0 lenmo iotlat ln s t s2xoir iu1aptn ivsatf Dtmumpot0tlxn i3tytfaDrluvp;(0 rermr oodomtelivols srxrxr nu4amte fei t)aDrm( pot0ale mfetlslaDrlump;u0aleniocia1fmt lnvo;t0s2toir iu1lp e ivi ( srtmumo;o1opeomoeilslsDea(ms t4artoxo oa1opD auvsl(0texm(r3iy4omtnlnvil()a2taumo;o0tetnmiciat s rmnms;(0trxrirciytfa   ueolt)t2trirpou1am   iesa( arrau oot4ape moeiyt aDrmuvs;t0trxomr totop e ies t0seuoiopoy4ole mfesa()a2rmxrpnu0olenmi3tat m uauvsn(0tleomr3iatopt anvs (0 2uo(r3oudop nliciat)a2tax  ou4olt  ieias mDea(mpnt4areomr3oadfmte nvs ( srxrxm iodlle miei (f 2um( oou1apxoiieiydla em( s (0artrir3iotlpDeai s;s tetoim3ny4lle mieiltfaDtmurpnt0tleomi3tldfs2ea( s;t4 lxoxf3ta1laDrlueols s2ur(rpiodlptnmneils s2ta(mp;o1oetomictaslmDeanmpnu) eerif3tadfa  li o;s)srxmxr nu4lm   fvtl() 2um(ro;u4altnmfciydlmDea(vp;u4tetrmocty1op rauvs;s  etrio oodam elics tfsrrmumpou1apenio3iad mDemnvs (0teerio oytlmD luei;(0 rumim oodomtn fvslsf Dtrxr no4opeoiieilt a2ul(vp (4tlenmf3tatopDelnvsls0 eur(m io1lmenmfvslt sDra(  nt4tptnioeiyd a emu pnt)altoif ta1fptraivs () etm(opiydol   nvtlsfs2ra(m ;o0tlto ictldfm2ra(ms t4 lxnircoytomD an o;s0tetoim3io4ol elivs s)sDrr(r ;o0apxnii3iysfa2eaumo;()trxrxrcoodfaDe uvsl()t2ur(m no4am emncs (f 2tru  ot1aleoiicildfm2uln s;t4altnircoy1lp r ies;( t2um(m nudom nlncsl()artauront0apenmieiysfm umnmo u0artoio oodlp  an i;(  2xrxopnudapte icsat)a2taxm ou0aeenmoeiydfs umums t) lxnio3oo1omteaueo;s0 2xoir3nodam e ivtas)s2ra(mono1apt mo3iltfa ranvs u0trxrmo3iodlpDrlivs ()setr(o nudopteliet (fsruaur oo1olxomf3ilt m2ea(vo t) etnmr3oydom  luvs t0srxm(m nu1olte fvi sfartmx ont0tltnmi3iatlm2emnvs t0aetomr iadfpte i o () exoxo3no4lp elneilsf 2trx p;t4tltnmiciys a2emumon(4trerxo3tydfp  aueol( srxo(opnudomeemncils)a2ra( pno4tpenmieiysfm rm(vp;u0altrmf iodlp  lies (  etr(m3oo1lle mivtltf 2taxro;u4tlenioctltlm rlnmp;u4aexrir ta1lm raivo t)t2umxm3oodap   nctlsfa2taxmo;o1tlenmf3iad mDranms;u4trermrciodomD  n slt)t2xmimpnodope mfctasf rtau pno4apx  fctat s ra(von()texnxo3tadop  lu olt0srxmxm io4ap e fct t arra(  ;t0tpxoiietys m ra( o (4 rtrxr tytlmD auvsls t2xoimpoy1am nmict ( a2raxr oo0alxnmfciyd m rm(mp t0artrmo3oytoat luvs t0srur(r3ny4ll emfctls  2um( ooo4tltnmo3tyd a2uaums;t)artnxrcoy1fptraiei;s0trxm(r3nu1opt micslt)artmxm ot0oet  oeiytlm2ul(mp;()texrmf3oytlaDr i sls teuoxmpiu1oleelfet t  Draxm nu0aptnioeilslm ran p;u) lerir iodfm eluei;t)seto(r3oodoltnlfvsa(fsDur(  oo1aexnmf3iadla em( pn(0artrxr oo1lat ai ilt0 rtm(m iudlleemies s)artm(rpno1apeniicilslsDra(mp;t4alxnmo3todfm e nvs;t)trtmxopiy1ol  lfci s sDrmumo;u4tpt iicildfa2rmu s t0trerifcoy1lpteaivs (0teto(r3oo4om nlnesls  rtr(  ;t0tltoioctldfmDumnvont0 exrir3to1op r n i ()s2urxr ou1lpenlnet (fa2rax  ;u4tptnmo3tysfa2ul(msnu4tlerxf3iytlaD  uvs;() 2urxm3no1omtemici sfs2rmurp;t1teeoiietatla rau o t)teenir3iydfptr ues;( trxrirpny4amtelncsl( sruau  ;o4tpt  i3iatlmDrmnms;u) exnif oa1opte ieo s srurxr nu1amtelici () rtaump;o4ape mfetlslaDelnmpnu0altnxf oodlm  anei;t0s2xo(m3oo1lmen ncsat)aDum(mpoo0olen o3iltlmDel(mon(4texoxoctotla  auvol( seumir nydopenlfci t)s2taxmpot1apto octlt s rm(vp u4aetoxfcto1fp rlueo;t0s2ur(r3iu1om e nvia() Dra(rpnt4apto oetatfsDuau pnu0artomf3oydfat lneolt) rxr(mpnu4omenmfctlt artmxrp;o1tpenmociatlm2elnmo u4 rxrxf3tytomtraies () etoxm3oo1lmen fvias)aDtr(mono4olxomfeiysfs2raumpnt4aleoio3oydlptr uvo;(0srumxrpiydll elnvsls)aDtr(mpnu0olt ifciatfmDemnvs;(0texnif3io1la rau o;s s2xmio no1ap nlfeiat)s2rmx p;u4opeoio3iytfm eanvpnu0alxoxf3ty1lpt  ivo;t t2xmimpou1op elietl(faDra(m ou1olx mietyt a2elnmo;t)trtnxf tytoa r n ils  eumxr3oudapenmivtatfaruax  ot4tetoii3iys aDulnvo;t0 lxoxr totlptrlu o s srxm(rpiu1opt mieia(  Duaxm no0apeoif3iatls ean p (0aexrxo iydopD  uvi s) rurirpny4ape lfvtls) Dumurono0aeen o3ildlsDrln p;t4aetomfciotop e ueilt  rxmirpiodamt  fciatfaDtr(mp;o4tpeoiictlt a2ua( s u4alerio3ty1om elnvs;() 2urir3ny4amtnmfct s)artrx pot1tpxnmf3tadfm2eauvo;t4 lenir tadopD aivi;s) rtoxm3iu4aleemfesat  2rr(rp;t0aex ioeiltfa emnms t4 lxnmo io1oaD lnei s sruoxr ou1omtemfei tf Dra( pnt4alt mf3iadfm ulnvo;(4trxnmr tatom  au sl()s2xrxm3iodomtnmneta(faDumxm ;u4tpxn feiytfs rmnmpn() exrxrcia1omteluvs (  etoxmpiodal nmnci s)sDrmxmono1aexoiiciltla rl(vs u)aeerirciytomt  i o (0t2um(m iodoltnlfvsls)aDtax pnu4alxnmo3iadlmDrmuvonu)tltnxociytop eli o;t)trtoirpiy1lp  mfvias)aDum(ro;u1oetoifetysfa2rlumsnu)aleoir3iotfate nesl( trxoxm3nodoptnlivt (fa2uaxmonu4apenifciat s2umnms t) renxr3oa1fm raivil( trtr(o3nu4openmnvtl() 2umxr ;t1opxnmfetlslm eluvon()treomfctatlmD  uvo t)truoiopou1ol n icslt srtmx  ;t1alt  feiyslm ua( sn(0trxrio oa1faDraivo ( trxm(mpoydlptelfetatfa2rruront1oexnmfcias sDumumpnt0 lxrxocoa1lat  uvs t0s2xrxr iydaltn ictas aDrmum ou4optnmf3iydfm em( o;(4 lxrxr iy1omt anvils) rxmimpno4ame  ict tf rumxro;t0opxo ieiys sDea( pn(4texoif3tatfp eauvi (0 2xrxr nodoltn neia( aruaxro;o0tlenif3ild a2ran p u)alxnxr3ia1fpteauvil( s2xoir io4llt mnvs sfartmx  ;u0apx  oeiyd s ra(mo (4texnif3ootlmD  nvs s  2xmir no1ome mfct s  2rmum ou4open i3iadfm emnvsnu4tlxnxf ootlp   i s;(0s2umxo iydlptnmnctls  ruaum ;u0oltn f3iadfa2umums t0aeeriocio1oa   neo ( srtmxmpio1omee fesa( aDrru p;t1aetn icilsfaDuanvp;t)teenmr iy1oatr n ol(0teuo(mpiudam   fctl()s2tmu  no4tptoioeilsfmDeanmo;t4trtnxo3ootlat  ieo ( teurxo no4lmt lict (  rumxmp;o4aee if3tad s2rauvonu4 exnxr3iydfm eai sls srxrio3ny4amt mnvtlt s2rru  ;t0openmfeildls2umn pnu0 rtrxf3tadfp rai ols) etm(o3iy1optnlivs t srrau  nt4oeenioeiydlm eln p (4 lenxr oy1fa raivs;s)seum(m iudape lneilt)arum( oou1oeeo ociytfsDranvsnt)texoif3tytlptr n o;s) eumxmpiu1lpen fet t) rtaxmp;t0tlxn fetat sDulu p;(4aetoxrcio1fpt lneilt  2trir3ou1lp   nvtltfsrrrumo;u4aet mfetld s emu s;t)altoxf3to1omDeau i;()s2umirpoodaptelfeslt) Draurpno0opeoiiciat m2rlnmon(0tleriociy1faDr ieils setmxrpoy4lptnmictl( srua(r ou4aexo fciltlm elums (0 reomo3io1fp elieol()t2urxo3no1apen fvi sfartaumo;u0opxn fciysfm umn on(0areoirciytla eluvs t teuoxm oydlpt  fcil( a2uaxro;t1oee miciyd a2uauvpnt0arerxf iotoate uvs t s2um(rpoudamenmfvtasfa2trxrpno1oet  fcilsla rmuvp t0 rxnxocoatlate nei;t teuoiopou4aptnmfes tfsrraxrp;t1olen fciaslmDemu p;(0tltrxf tadlpt lnvs ()teur(o3io1al   iesatf rrr(  nt4oltniociaslm2emnmo;(4trtrxr oodfmDr iei;() rur(r3iu4apte iciasfarua(mp;t0oexnio3ilsls2uau p ()alxoxfcoa1fm rln s s) rtr(opiudlp   ncia()s2um(rp;o4apt  ieild s2eluvp ()teeoxocoo1fpt anvs;()t2umxrpnu1ll emiesat) 2rrx  oo0tpx moetlt s rm(mo;u0trtoirciodfpt lnvs;s)srurir3iu4op emneia( srrrxr oo0alto feiltlm2el( snt)tlxoir ia1fpDelu i t)t2uo(rpiydaptnlfet s  2uaur ;t0aptniieilt aDeauvs;t4alxoxr ia1lpDelieol()tetr(o iodame mneiat)sDrm( oou4tex ifeiltlaDelumsnt0alenmrciatlpt lneo t)s2uoxm io4ape  icsasf 2umum ;o1apx mfeias m ea(monu0artomo3io1fmDrlivslt0srurio iodolenliviltfsrtmx o;t0alxn fciadls2emn snt4tetrir oydfat  n o;( srxrio nu1ap   ivi t)srum(rpou4aetniiciyd mDrmuvo;u) lxrio oo1optraneils)sexmxm3iu1alen nvsl( aDtm(m ;u1aeeomo3tytlmDrl( s;(0artnmo3ootfaDeanvi s)tetrxrpiy1lp emnvsa() Durumoou0olx ifeiad a rlumon()tlenxfctodla r iei;s)trxo(opio4op nlfesa( sDtmum ot4apx  o3ild s um(ms;t0arxrir todlpD  nvs t0srxoxmpny1ol nlnctl()aDuau p;o4tet mi3tydls elnms;t)aleoifciytfpDeli o;s) etmxrpoo4amtn iet tf rrm( ono4open o3tydfsDra(vp ()tetoxf3tytla eli sls)s2tmirpoudome licia( aDua( o;t1olt mfctytfm2elnmp;t0aetnxf iy1om e uvil()t2xr(mpny1apenmfvt s aDrrx  nu0tetoii3iatfa uln o;t0alxnmfctotlpt aues;t trtrxr3nydoptemies s)a2rrum oo0apt moeildfa2ra(vsn(4alenmfcoa1faDe uvs;t0 rtrio3iy4oltelneils s2umxr nt0tpxomietysfs2rm( o t4arxoiociodopt  ivo;t0 rtr(mpiu4lmenmfesl()a2ur(rp;u4oetoifeildfs2eanmo (4trxrio3tydomt aneil( s2uoir ou4om   ictlt s2umx  ;u0aptomi3iadfm rm(vonu)trtoxrcio1lmDr nvsls srtm(o nudalt mivia()a2uru ono1apxoif3ilslaDemums;t)tltrxo3oytlp rlu i;s0s2trxm3oodlmtelncia( a2uaum ot0aptomfctasfs2uauvs;u4altoif3iatop elnvs;()texrxr iudapt  fvt s) Drrxr nu1tlenmoeiadlm uluvsn(4altrmf totfat livolt s2tr(m oodlltelnei t  rur(  ;t1tlx ioetysfs2ean s;u4texnxr3oy1la rlu ils0 rtrim nydll emnctlsfsDra(r nt1altn octyt s2rm( ont4 rxnmf oo1fa rlues;s0srtoimpnu1opte iet (fa2ururooo0tetomfetlslmDul( sn(0alenir tydfateai o s)s2ur(r3io4ap elfcta( srta(m oo0aet  o3ils a2rm( s u4tltrmrcoytfatr n i ( teurir nu1alt  nvs sf ruax  oo1opxomiciydls2um(vp;(4 rtoifcoydlpD li o;(  etoir oy4op n nes tfaDua(mpot0tltoif3iasfa2eln o u)alxomf3ootlptr ueslt) 2xoxr iudoptemiet ()s2ur( pot0tpxomiciat a2emnvs;u) lxriociodoaDeaneo s  2toxr ny4ope lfcsat a2trurpou4olenifctyt s rm( on(4trxoxf iytfmte u i s0 2uoxopoodom nmivslt)aDrm(m no1tltnmietldlsDua(ms;u)aexoxo tatfate uvs;t) exm(mpnu4lm  lieias)s2rmxront0tpt ioeiadlmDem( p u)tetrxo io1lmDeln o t) 2xoxm ny1olt  ivtltf rrru  no4tpenio3tad sDulu snu)texrxrciodfa elivs;t0texmir3iudam   netl( a2um( oou4olx  oetysla eauvo;u)teeoirctodopD  u i;t trtmiopou4apenmfcil(fsrtrump;o1oet ifciyd s em(mont0tlxrmf3ta1fateauesls0 rxrxm3ou1ale mivsl(f Durx  ;t1oeenmoeiyd s2um(vpn()tlermr oa1fpDe u s;() 2uo(rpiudam emncsas  2ururoou0tlto oetydfsDraumonu0trtrmrciytom eanvilt  etrir3iudlmee ncsltfarrm(mp;u4tetoioeiysfm umnvp;t4tleomocto1omt lnei (0srxo(o3ou1lmeemnes ()a2tm(mpot4tpeomociys s uanvs t0 rxrmo3iotomt auvs s0 2to(m iu4ll e ictasfsrur(  ;o0aex  oeiyd s emnmo u0 rxnmfcia1fp r nei;s)tetoxopiu4lm  livi t artmxrpnt0opx io3tysfm2rmn pnu)teermocia1faDe ivi t t2xr(mpou1lp  mfctasfaDtrx  nu4oee  icildla um( p (0 lxrmocto1lmt auvslt) ruoxm nodopt  ietltf rraxrpnt4opxn o3iyd s2ua(vo;u0 eenmr3iotlmtr ueo t sexrimpiu4llt mfct (f ruaumo;t0tltniieiyt m eln s;t)alenmr3iy1oat  neil(0srtm(mpny4oltnlfctat  Dra(mpoo1tpenmicilslm2rlump;(4aexnxo3oy1oatrlu il(0s2toio ny4lmtnmnvsl(f 2umu pou1aeen i3iyslmDulnmo u0aetoif3iadoaDeaivolt0sexo(r3ou1ol  lncs (f Drm(m no1tpeomf3iltfm umn o;t4tltrxrctadoptr uvs ()trumirpiu4opt mncsl(fsrta(rpnu1altoif3tltlm2umums;t0aexnio iydlaDeai ol() rtoio iodoptnlfctl(  Drrurpoo0olxo octas m umu p;(4aetnxr ta1fmt  i i;t)s2xr(mpiy1amt micilt arumx pnt0oexnmoctltlaDulnvs (0artoxo3tytfm e i i;( sruoxo3iy4optnliesl()arua(mp;o0altomfetytfsDem( s (0alxrxr iadfpt aivols trtr(o3iu1lleemiet (  Dum(mooo4tpe  ietldls2ul(ms;t)arxoio to1oa   uvi s0 2xrimpiodll e netat  Drmum ou4teeoifciytfa rmnmp;t4tltnxo ia1lmte ues (0 rtoxm nodol emies (fs2rau o;o4optniieiadls rlnvpnt0aetomr3io1oa eli ols) rtmxr oodalee ieiltfsrtmumooo4apx iociysla2uanvsnu0 ltrxr ootlpDrluvols)srxo(mpio4opte fetatfsrra( p;o4ole  oeiytfa2em(mo (0alenioctytfmD aiesl( teumiopnodlpeelies (fsrurx oot4aexo oeiyd sDelumpnt4alxomrcta1fp  aieils0srto(o oy4lpeemivsat)artmu  ;t0oltnif3iadfa um(ms;u) lxoirctytfm  livs;t0t2umxmpnodlmtemiciasfs2rr(r ;u1teto icilslmDulumo;t4 exrxr oatfmDr ieslt teurim oodlltnlncia()a2rrxmont1open i3tld mDemn s;t0tltrif oadom eluvol(0 ruoxr3iydamt  icta(fa2tmu o;o4apeomfeilsfm ua( o ()trermocia1fp e u s ( trtrir3iu4amt mies (f Dta(  nu4tetoioeilsfs2uau o (4 lermfcoo1opD li s s)srur(opoudlpee ict (f 2rmxrpou1oleo feildla2elnvp;u) exrmfciy1lpDeau sl( t2uo(mpiodlpen nvt ()srraumpnt4aptoif3tlsla2rm( on(4aetrxo oy1oatean i () 2xm(m iu4ole lnvils  2uaum nu1aptomoctaslmDrau p;u)trerxo3ia1la raiesl(0 rxm(r oy4lpee ivta(fa2tmu pno1tltnmfciatfm ranvo;() lerio oadfmDr u i (0sruriopnu4ome lnvsasfa2rrxmonu0ole  iciytls2uluvonu0 rxnmf3tydfaDr u o;s s2tm(opou1openmnviasfsrtr( pno1aptomoctltlm2rauvs;t)trtnifcto1lat  n slt seuoxr oodlm nlfcsls arrax pno0alto ocils mDumuvp;u4aetnif to1oaD  neslt0trxrxr3oo1ap   ietls s2tauroou0texn oeiys aDul(vs;u0tlxrir iatlate nei s  rumiopnodom   icil( aDtmxm nu1apxnmoeiatfaDrln o;t)trxrmrcta1oa eai s t) 2tmiopoydopeemnctls sDrax oot0tptn f3ilsfa umuvp;(0trtomo iytlat ln i;t0teumxm3io1ol elicsl(  rum(  ;o1aptnioeiydfmDraumsnt) rxrio3iotfpt  n i (0tetm(m3nodoptemivtltfa2urumpnt1oleomictas s ua(vp;t4tetoif oy1opD lneslt)srxm(rpny1lp n nvsas) 2trumpot4alxo i3tltfm2el(ms;u0 eeomrciadlmD ai o t  exrirpny4alt  fvia() 2tm(monu0tpeomieils mDra(vpn(4tlermrctatlm  lieo;s)s2xo(m oudlmenlncia(fa2tauroot1apto o3tatfm ul( snu)texoif3ty1oaD aneo t trto(opiu1ap emnctlsfs2rru oot0alt ifeiadfm2em( s;t)aexrmo3iydopDr u ols sexrxmpoudolte netat) 2ur(  ou0olxnmf3tydfs ua( p ()tlxnxr3tydfmDrln olt0 rxo(m iy4ope lfvils  Duru  oo1openmocild m ulnvs;t4aleniocoa1omDelnvs (  rur(r3oo1lm nlfei ( srurxmont1tee mf3tatfaDea(vsn() rxrir iodoaDrln sl()tetm(o3nydop nmfeil()a2trum nt0tpxomi3iydlmDulnvo (4aetomf oytopDrlneol()seuoiopou1lp  lies t)sDtru pnu0texnioeiadlaDel( s u4alxnmr iadfp rai i;s teuoir3nu4al elfvtls)a2um(ro;u4aexnioetltls2rmnvo t4tlermoctydfp r uvi t) ruo(m3iudape  nvtlt  2uau p;u4apx mocildfmDrau pnt)alxnmrciytlpD  u sl(0texoxmpoydomenlies t artru pou4ope  i3iadls eaump (0arxomr3iydoa e i o t0teur(o io1llte ncslt)a2taurpoo0aptnioctltla eaumsn(0 rxnxo3to1lmDr uesls0trxr(opiu4amenmncsas) Duru oou1tlen i3ias a el( p (4arxoxfcoa1opt ln ols)seto(r oy1lpt  ics (  rtrxmont0alxomoetad sDrmu o (0 ltnxfcta1lmteluvo;(0srxm(o iy1lm   neslt s2raxr oo4texomictydfa um(vo u) eeoir3ta1la ran i;(  2um(rpiydapeelfciatfa2tmxrpot1aetn i3iadfa2uauvsnt)tetrxf3tydfp eli s;()tetmirpiu1omtnlfci s s2tmxmono4apxomfeiyt s2el( snu)areniocoatfmtelivs t) rurir oo4openlfei t)aDtaxroot0alxo feiydlmDul( o (4trenmf3oadfmDeaivol()trxoxr3ny4ll  mfct ()sDrr( poo1apxniieiltls uan p u)treoxo3iotfat  i s t)truoxmpiodlmte nvt s  Duru p;t1tpe mieilslaDra(mont)altrifcty1op  luei;t t2ur(o3io4am n fvsat) 2rru oot0alto o3tls a umnms;t4altnmf iodfa r u sl(  rxrxm iodop nmivt tf rumu onu4ale iocildla ean pnu4 etrmocoy1lmt aivols) ruo(r oudamenmivi tfarrm( pou4tpenioeils s ul(mo u4 exnifcootlp elieil( srtrir oo4lmteliet () rrmur no4apeo f3ilsfmDrmumo;t4aleomo3tydfpDrluvo;() exmxo oy1ll e feta()a2rrxmpot1teeo oeiytlm2rlumo (0trxnxrcootoaD auvslt0trumxmpiy1lle mfvtl( a2um( p;t1tleomfciyd m2ulnvp t4 exomr iadopt  ivs t0s2xm(m oudalt  ieias)sDtrxrp;t1tex  feilt m rmn s;u)tltrxr tatlp rli s ( seum(r3io1olen icils s2uru  ;o1alenmfeiatfm2rm(vp;t)aetnmrctydla eai ol(0s2xoxmpoy4lltnmnetltfa2um(rpot1optomociaslmDrmn o;t)tlxrmoctytom rln i t0srur(r ny4alt  nesl(fa2ua(rp;t4alenii3tyt s uau onu4 exrir3oatoptrluvi t)tetrim3iudop nmnvta(f rururpou1alxn feilsfs eanvs t4 lenxo totlmD  nvs;t0 etr(m oo4ol nmici ( sDum(rono0tptoioeiat s rmnms t4alxoiocty1oatr ieo;s0 eumxo3iudaptemnciat) Dtrx  nt4oee iieiys a2eluvo u4texoxr3iodlpDrau s (  rto(r3oy4ll n fviltfsrrrurpnt4opx mo3tysfmDul(vs t4trtrmo oatop e uvs;( trto(m io4aptn nvt sf Drmum nu0tlx ioeiysfs2ua(mp;(4 exnxo3oadom e uvs s  2xrxr3nydamte net t) 2um(moot0openifetatlsDrmums;t)trenxf oadlmDrauesl() 2um(m no4openmicias)a2tru  ou1ole ii3iytls2rmnmon(4 rermfciydfp eluvi t trurir3iy1ome  fvt tfa2tmxrpno1texnif3iys s eanvo (0tlxrmrciatopD lues (0s2toim io1llenmivt (fsDtmx p;o0alxn oetyslm2eluvpn(0aeenmr iotfpDe uvsl(  euoim3io1ol elneia()sDtru  nt0oee mfciyd a2rmuvp u4alerxo tydoate uvi;(0 rtr(o3iydaltelicil()srumx p;o0teenmoeiad m2ulnmon()tlxrifcto1om  ai sls0sexmxopno4ap  livt ( srum( poo4ole ifeildfsDua(mo;u0 exrxo3tytopD lnvil()srur(m3iudal nlnvsa(fsruau  ;t4oet  i3iys sDel( o () etnmo iytom  ln sl(0 rxoxm3nydam  lfesl(  ruru  nu0alt mieiltfs2umnmo t0trxnmf iy1faDr ieo;t s2trxm ou1apeelfesat arra(  ou0tee iietytfaDuluvo;t0 ltriociytlaDe ieslt  euo(rpiy4ll e nvsl()aDraumo;t4olxomi3ild m ua(mo ()tleoxf3oydopt  nvi;s0setmim3iy4lmtemfeilt srrmu pno0oltomo3ildfm raums (0artrif iadlaDeau s;s0 2xmxmpnudll elfci (f 2rr( p;o4alx ioetas a elnvp;u4trxomf oadlaD lnvsls)trxrxm oydolte fesls)s2trur ;u1oee ifeiydlaDra( p;u) ltoircoa1fptrlivi (0 rurxrpno1aleemnei s)artru o;u1altnioeiydfmDemnmp;u0teeomo oydfp e ieo ()srum(m iudlptnmieslt aDtr(mo;t0olxo f3ilt s eaumo;t4texoxf ta1fp r neo;(0 rurir iydameelfvil(f Duaum no1alxnmociys s ul(mp (0aeerio3oatlpD auei t t2uoxopoodlpee fei () Dta(rpou1tpt  feiysfa2ran snu4treomocto1lp e ivs s0t2uo(rpnodlmtn ivil()sDrm( ono1tpt if3iydfmDulu s;t) rxoiocoy1fpteai i (0trur(opoo1ape lfetas) rtm(m no4oetnifciasfa2uanvs u)treoxf iotoat auei;t s2xrxrpiu1altelfvtat a2rm(mpno0alx  fetadla eanvs t4aetoir3tydfpDrlu i;s)srum(m no1aleemivtas a2tmx  ou4tle mi3ilslaDua(mo t4 rtrmrciydfm e u o;s) rtrxo3no1ameemfvtlt a2ua(mp;t0tetomocilsls2ulnvo u4 etnxf3ia1lmt  ivslt0s2uoxo nydolenlieils  Dum( ono4apx iictydfs uaumo;(4alxomociotfp ranei (0setoir3nudlltnlfeias) rrmx  nu4oexnmo3ilt a2elnmo;u0tltrxfctadlp rauvo;s)srtoim3no1apeemncils srrmx oot1olxniociyt a2rln o;t0tleoxr3totlaDe nei t) 2tmxr io1ale  fcilsfsDtmxr nt0tltniietlt m2ran p ()aexomfcoa1fpD au i ()seuo(m ny1optemfcsa( s2raxmpno4tpt ifeiydfs2eanvo t)tetoxr3oatfmte nvols0 2uo(o iu1lpee icslt)srtrxmo;t1tltoifciadla ul(vo;u0treoxfcoatlaD  ivilt0t2tmxo oo4lpe lnvtl(f 2rrx pou1tpt  fciaslaDeanvo u0 eeoif3oodla raiesls0tetr(mpou4ol emfesas) 2tm(r nt4oetn ieiltlmDuanvsnu)trerif3tadomtrlu i s) 2xm(o3iu4am n fvsas srtau p;u4alxnmoeiasfmDrm(mp t0 lenmf3ty1opt ln s;() 2to(mpno1lle mfvs tf ruaxrp;o4opto ociysfa2eaumsnt)artnxr3oo1oaD lues (0setrim nudaltnmictas  rra(r ;o4aeto ictatls2rmn p;u0areoxo3to1fm r i o t0 eur(m ou1ape lfeslt  ruaxr ;o4openio3iadlsDeluvo u4alenmf3to1lmt li olt trtmiopnudlleemnci ( srtru  ;u4aexo o3iat a rau s;(0tetrifciodla r nvs ( trto(mpny4omtnlicta(fsDrax oot4aleo f3tltfs rl(monu)arenxf3iy1op e iesls0srxmir iu4amt mfvtl(f 2tmum ;o0openmi3tadla2umn pnu0 lenxo3totop rli s s0t2xrio io1ap  lfvs tf 2uaxroot1alxnifcilsla ul( s;u4aexoir3ty1omte i o;( trumio3iy1lpt mnvta()a2ua(  ou1oet  ieiadfa2rluvs u4 exoio io1oate i i;s0t2xmio3iy1lptn neta( sDtm(m nu1apenmociyt s2eln o;()tlerxrcoadopDrlnvilt0 exrxrpnydlmen feiasfsrra(  ;o0oexo ociltfm2uan o () rtrmf to1faDr nvs;t setm(rpno1al nmivi () rumxmo;t4ole  f3iadfmDelu snt4 etoio tatfa  livolt0 rxrxo3oy4apeemnetl(faDrrurono1opt mf3ilt a uau sn(4 rtrio3oydlat  nvilt)trxrxr iy1lle lfvtl()a2tm(mont4aex  o3tltfm2ean o;u)aetnif3ta1laDe neslt0 rtmir3iy1apee fetat arua(rpou0tpeniiciatlm2uluvp (0trtnmr3tydfmDelu ol(0texm(o3ny4lpte netasf rraum ;u0aptnmfciad s rau o;t4altomo3tadfmD  nvsls teumxm io4opte ncsa( sDuaump;t1oltoio3iytfm2ul(ms u4trtomo iadlpte ueo;()sexr(opno1om n feiltfs2uaumonu4opt  ictld a2emnvon(0areoif3oytomt luvs s)t2ur(m iu1lleelietat)a2rm(rpno0tpx mi3iasfs elnvo u) lermfcoatfp  luvols)sexmxrpiy4al nmfvs tf rumu p;u4oex  o3iatfm2ulnmo;()alxnmr oytop  lnvi;s)teumir3oo4ome  fvtasfa2tau  ou0teen i3iadlsDrlnvp (0 rxrif3oa1opDe ivi s0 exo(r nu4om elncias)a2raur ot4aexn i3iytfa ul(ms t0trerxf ty1oaD  ueo ()s2um(r3iy1om nmieil( aruauro;u0opxoiieiyslmDelu s;t4tlenxf tatfa e ivs (  euo(r ou1ap  lieiat arua( poo1tltnioetasfsDuluvo;u4trxrmr oydomte n i t0trxrxo3io4lmee nvsat  Duaxro;u1ale iiciydlmDeluvonu) rxnxf totlaD  n s (0tetoir3iu1omeelieia(  2taurpnt1ope  fctydfmDel(mp;u4aetoxfctytomteai i;()s2xrxo3oydoltelfes s a2ra( pno0olt iietatlmDumnmo;u) etnmf3io1fpDe nvs;t0s2umiopou4oltemncsltf 2umxmpot0openioeiysfm2eanmo (4arxrxr3tatop rai sl(0trtmim oy1lmenmivt (f 2ua(mont0tlt iietltla el(mo u4 exrmfctydfaD  nei t) exm(mpoo4altn nvsa(  rrr(rpoo1oeeoif3iydfm2ul( ont0areoxrcoa1fp raivs t sexrim3nodole  nvsls) ruaur nt0aleoifeiys s rmn s (4 rxnif iy1lmDelivo ( s2ur(o oydaptnlncta()aruaxrp;u1opxnmi3iyt mDumumpnt4arxomocoa1lmDrlnes;s0srtrim iy4lp emfesltfsrra(moou1olxomfeils s rl(vp;t4 lenmrctotlatrluei;() 2xoxopoo4lptn fcsas sDtruront4tptnmfctas aDran p;()tltnmf ootlmteln ols)setoio iudal nmiei (faDumxrpnu1teto ictad s ran p t4tlxnxocoydfa eauesls  rto(o3no4ape livilt) rua(r ot1texo ociltfm2rm(vsnt)trxrmf oadlatraneo t)t2tm(mpny4amtn neilt sDrmxroot4alto ieiysfa2rlnmon(4 reoir3oadlptr ues;(  eum(mpnudllenmnetls s2rr( ont0apxnifciyt mDum( pnt4trxnirctodlptran sls0teto(m3iudol elies ()a2rmurp;u4teeomo3iyt m2emn p t0trxomo3iatfmte neols) exoirpnudlmtelivsas) ruau p;o4tle mi3tat aDeanvp;()alxomrctodlate ueilt s2tmimpoudapenmivt ( s2tru pnu1apeomfciatlsDumuvp (4 etrmf3to1faDraivs;() eumxr3nudamt mnci t a2uru  ou0oee  f3tlt s rlumo;t4tltrxfcoo1oatrlnvols)s2trxm3ny1om e nei t)srraxrpot1tltnifciltls2ul(mpn() rxnir iydop  aivo (0teuoxo iudlle  net sfsDta(m ;o4opxo ieiatlm2uln snu)tlermf iadom rai il() rumxmpou4lm e fvt t)artm( p;u4tpe ifcild a em( s t4 ltrir3to1oaDeai s;(0teurimpou1aleemnesat)aDtru  nu0oltnmieiyslaDea( on() exnio oo1oate ieslt)tetoiopou1al nmfctls  2trxmonu1tpto o3ilsls ua(vo;(0 ltrir io1fmDrlnvi s sexmim3oy1omenmivt ( s2trx pot4tpeomf3iad a rm(vsn(0 eeniociadoptr uvs t sexr(m3nudlpeelfei s  2urx p;u1aexn fctldlm2eluvsnt0 eeoif iatlat  neols)trtr(opiu4optemncias a2rmuroot0texoiicild a2um(vsn(4 lxrxfcio1faD luvo;s teuoxo3oy4lpte nvils aDtm(r nt1teto o3tldfs emu s ()alxrif3iotfa rlu i (0texmxrpio4ol e ivt t  Dtm(m nt1oeto ociyd aDuaump;t)arxnxr tytlmtr n ol( tetoxrpny1apee nct t a2ra(ront0aetoiociatls2em( s;(0 rxnmo3iadfp eauvi (0 rxr(r3oy4apte ictl(fs2tmx oou4aptnmictytlmDul( o;(4teeoxfciadfmteanes s0srum(r ny1oleemneias)sDtrxm ;u1oexo oeiat s rmums;u) rtnmocta1oa rliei t sexoir3no1omt mfvils  2uru oou1opx ifetldls2rl(msnt4artnmf3iodlmDraies ( srto(opno4lm nlfctl( aDumxrp;t4ale  i3iaslaDuau s;u)artnif oytlp   uei (  rxoirpny1om   ncsl( a2ua( pot0tleo f3ils sDrlnvo;(0aetoio3tytlmt au o ()s2uoimpoo4lmte ici sf 2um(  ot1tex mo3iadfa ea(vpn()trxoif todlp eluesl() rtoio oudaltnlfes t srtr(mono4alx mi3ilt m ea(mpn(4aexnmr3oytlmt  i o t srumio3oydoltemnei sfa2ua(mpno1alxnmieiydfm2emu p;(4aetnmr3iytfpte nvo;s0srtr(r no4lme licia()arururpoo4openmoetysfm2elump;t4 lxnxfcootfat ln s s0texmxo no1omtn fciat)srra(rpnt1tptn oeild a2rauvs;u) rxnmrctotfptraivi t  2xoxmpiu1oleelivs ( a2trxr nu0tetnmfcilt a eau sn(0aexnxr todfaDrliei (  euo(o oudap emnetltf rtru pnt4tpxnmf3ils aDelnmo t4arenio oa1faD  neo;(0 2tmxo ny4aleemnvsatfsrtr(  ;o4aee ii3iytlm2umnmo;(4alxrxo to1fmDr n ilt srxmim no1am  mnei (fsDtax p;t0oltnii3tasla2ranvo;(4tltnmf oatlpDeai o;s0 exr(m oodlmtnmfcta(fa2umur nt4aetoifeilsls ulu sn(4 eeomr3oydlmte ivi () exoim nydoleelnvi sf rrmur ;t4ale mf3tadfa2rmums t)aetnxrcoytfa elu s;t)srtmxm3oy1lm nmivsl() rrmurpnt4aet ifetyt s el( o;(4tltomrciodopDelivi;s0texmir3oo4op  lfvt t arra(  no4opeomfeiatfs2eln s;u)altoio ty1fa  lnvols0 ruriopoo4om  lnctl(  2umxr nu4tlxnmociad aDel(vsnu4 ltrmf oy1fm  aneols0seurxr iodlmee fct t)srtax ont4oltn ietltlmDuan p (0areoircoa1faDelu s (0s2xoxmpno4amt  ncta(faDtr( poo1openifeiltla2elu s u0trxnmf io1faD ln s;s  exmxo3io4alenmfvsa(fs2ur( pnu1apxo f3tadfs2uanvont) lxriocoadlm eanvols0truoirpny4oleemfcsat)aDua(m no0alx  iciltfaDuaumo;t0tlxnmfctytoaDranvi t0setr(m iy4lme lfvsat)a2uaur ou1aet mi3iydfs emnmp;t0 eeoxr iodfptr ieo;s0t2tm(r nydoltnlfesl(  Dtaxmp;o0tlto f3ias m2ea(vpn(0altnir totlm  lues s) 2xrxrpiydopenmictasfa2tr( onu1texo ocilsfsDuan p;(0trtrmrcto1lmDr ivi;t)t2to(mpiodome lneil()a2taxr nt4teen octytfs eanvp;t4 lxrxf iy1lpDelieilt  rxrxr no1omtnmieiasfaDumxmpnt1altomoctys m2uaumpn(4 ltrioctadlm  ai o;(0srxm(m3iy1omte fvi sfaDumxm ou1tptnio3tyd aDuluvsnu4texomf3ty1lmt aivslt)t2ur(m3ou4alee nvilt a2ta(  nu4oleomictad aDum( snt0aexnircoodoaDe neo;s t2urxo nudom n iesas)sDrrxrpoo1aee iictytlmDumn p;u0aexoxr3iodlaDelivilt texo(m3oodom emiet t)s2umx p;t0tee io3tysls eanvo;() eenxociodlpDeaivs t0trtmim3ny4amen neia()s2uaxmoot1teeo f3tydla ul( s;()aetoiociydopDe ivi;s)teur(r3io1aptemnetat)sDtru p;o0ape ifctydfs2elumpnt) leoioctotom e nvs;t  euoxm nodaptnlnci tfsruru oot1tpeo ociysfs emump;t0 etoircoo1om e ivs s0tetrio3nydolt lfcil()s2tmu o;u1aee iictldlmDemums;t4altnifcoa1la rau ols teumxo3nudam emivi ( a2rmx ont0oleomieildla2rmnmo t) exoif3iotfpt liei t0 exoxr ny1al elietatf Dtax ont4olx  o3tadls2eln pnu4tltoifctotlaDelu ilt0 eurxmpoy4ll  mnvs (f 2tmumpno4alt mfetys a2rmuvpnu0aexrmr3iydfate uei;s0srtrxo3ou1om  lfctlt) Dtmum ;u1oetoii3iyd a ean o;()trxrmf3oa1lp eluvils)sexm(rpio1amtn fcilt)aDta(moou1tlxnif3iyt m ua(von(0tleoxf3iy1lp r nvols0 exoio3ou4lmt  nctls s2tmu  ;o1olxn iciaslmDemn o;u0 eeoxr tadomD ai i t0setm(mpoo1olt  ieta(  2uau  ;t0teto ocild a2rmu o;u0aetnmo3ty1fm  lnvi t)trxo(m oy4am n icilt)srrr( pot0opxnmfeiltfm2rlump t)tlenif oadfpt  nvi ()teurxopiydlp elics t  2umxro;t1apt ifetydfa ul(mpn(4 lxomr3ty1fpD au o s  rum(rpnu4al nmfcsas) 2raxmono1oleomoetaslaDeaump;t) etrmrciatomDrlneilt0t2urimpiodop  liesa()aDrm( o;u1tet  o3iadfs2ranmo u0tlxnxr3oadfmDraiei;(0 etrirpoudap elfctat)a2rrx pou1ole ifctad s rlums u0 lxnifctydoaDrli i;s) exoim oy4alee ietatfartmxront1opx  i3iltfsDrlnmsnu4aexnmo tydopteaueol(0setoxo3oo4lp e fctls  rumxrpot0oltoii3tysfm2ulu o (0trxoxr3io1lmDr u o t0s2xm(r oy4am   ncs tfaruauront1aee  octas sDra(mo;u0teenxo3tytlpt ai i;(0tetoio ny1al   ivtlsf Drrum ;t0teenmieiadlmDul(vs;() rxoxr3tytlmt  u s;()tetoimpio1amenlfesat  rumxmpnu4tlt iiciytlsDeluvs (0 ltoxr3tytfp r i sls)srxr(r nydap nmivilsfaruaxr ou0alx  i3iadlm2emnvsnu0 rtoxf3to1oa elnvilt) 2umxm oy1open ieil(fs2trumpou4ape  i3iys m umnvsnt)texnmr3ty1omD lu il()t2tmir ou1amenlfvslt)sDrmumooo4apx mfeildfm rm(mp t0 ltrir3oa1fmtelivo ()t2toim3nudllenmfvsl()artmxrp;o0oltomf3iyd m2rm( ont)trenir3oo1omteau ilt)s2umirpio1apte ictatfsDtrxm oo0tpe  f3iyt m2emn p u4tlxnxo iadfp eanvo;s)trxmxm iudomtnmnetasf rtr(  no4tleoio3iadfmDrlumpn(0 ltnio3tydlmD aueol(0t2trxo nodale lfvtasfaDrm( p;t1olx mi3ilt s rmn o;(4 rtrmociy1lp raies;( seuo(o iu4amtnlnvtltfsrrmurp;t4oleoii3iat mDulnmp;t0arxnir oodlaDelueo t  euoxrpiudapt  fvias)a2tr(mpnu4texn iciat a ran p;u)artnxo3iytlaDrlnesl( trtrxr oy1lpt lieta(f rraxmooo4tptn fctyt m rmuvonu)alenxo oodoa rlivs (0setmxm3iu4ope  ivi ()s2raxmpoo4aex iietldfs rln o t)aeenmoctotfp rlieilt)s2xrxm3oodaptelfvslt)srtrum ;t4aptomociytfs2rmnvp u4 reoir oydfmDrlu s;t)s2toxo3ny1oltemicia( s2rr(rpou1oex  i3iad a em( p (0 etnxr3iydfa rai i (0srto(r oy1omenmnci t a2ur(mp;t4aexn ietltls uau pnu4 rxomr todlaDrai s;s)srtm(rpny4lmeemietlt arrax ont4tptoio3iytlm eauvp;(4trxnxr iodlp eluvi s)srxr(mpno4alen ivilt sDrm( ooo4apxnifetytfsDran pn(4 lxrmrciydfaDeanei;(  2tmim3iu1omt lncsltf Dtm(m ou0tpxn fctaslm emu o t) rtoxr iatfpDeaivols)srxmio nu4lptn nvslt)arumumpot1opx  ieiytfsDulu p u)trtoxo ootfate ivi s)tetrir3no1ol   ivs s) Draxroou1texomfcildfmDumn snu) ltomf3oodomDe neo (0t2xoio3nu4apeemfvt t) Dtmxrpnu1oee  f3ils mDuauvp;()tltomr3oo1optrluvi t0texoxr ny4opee fvs (fs2raur nt4teeoifeias s2emuvp;u0 leoio3iy1faD li s;s0 exm(opoy4ale lfeias)srrrumono0apx iociadlm emnmo (4 exoxo tytlm raivsl(0trxmir ny4ol   fci (  rum(  no0oexoioeildlm emump (0 lerir3iotomtean o;()trumxm ny1op nmncia(  2rm(  nt4oexnmo3tlt a uanmont0 lxnmociy1la rli ilt0t2toxopoudale  nct s sDumur nt0oetnioetad sDrm(mo;(0aeenio todfa r ivs;(0seumxr3iy4lmtemfvtlt aDrm(m ;t0aex  feilt s2rm(von(4 rtnmf3oodfpt au s;t0seum(m3oudal  mncsa(  Dtax pnu4alxnioctlt mDrl(msn()tleomr3iy1lpDe n il( trtrio3oudal nmnctas artmxm ;o1oleomieiyt s um(mont0tleoxr totom elivi;t teumxm no1llen nvs t)a2uaxrp;o0tpxn feiltfs umn p (0trerxo iatomtraieo;t)texmir3ny4omtnlfvslsfa2umur no4aetnifetadfsDua(mp;u0arxnmr todfp   u slt0 2xr(m3no1aptnliesltfa2umxm nt1aexn feiadfaDra(vp u0 eenxf totop rlivs;s setr(mpoo4lp e nctls  2rm(r ou1alenifcias a2rmnmo;(0teeomr ty1lmDrauvs (0texrir oo4oltn nvsa( sDrr(r ou0tetnmociytfsDuaumpnt0texrmf3ootomt aivs s0teuo(o iu1llt mfet s  2truront1tlxoio3tadfmDrmumsn() ltomrctytlm rlivi;s0 eum(r3ny1ll nlfetl() rum( ono4oetoifciatfmDem(mp;u)alxoxo3tydlate iesls trtrio oy4lmen fvta(fsDtru ooo0texnii3iaslaDrlu on() rtnxf oadfm  livs ( s2xm(o iu4lp nlfeilsfaDur(rp;t1oexo feiatlmDel( s t) rtrxf3ia1fp ean o;t0tetrir nudlme lnei tfa2urxr nu0ope mi3iyt sDumu s;u0arerir ia1fat lues ( sexmxmpnodoltemivs s aDrm(r oo0oeto fcilsls ranmo;()tetnio3totfmt an slt  exrxmpny4lmtnmfei t s2umx p;u4oetnifeiltfa ea( pnt)aeenxfcoadlateanesls)srumxrpnydlmte icsas  rrrumpnt4tetn fcils sDrau o;u)arermocoadlaDelneo t0 rtrxo iy1apeelnvi (fsDuaxrp;o1optomf3tas m rmu o;u4 ltoio to1oa rlivi ()tetrxo3io4ap  lfvsa()a2rrur nt0oetn ieiltfa umn p (0tltrxoctotlmtelivsl(  2ur(mpny4om   ncsa( aDtrum nt0tpeomieiytlmDrmuvo t4 etrxrciytoa  lnei;(  rtrio3iydoltelies t)a2um(  no1tleomociydlmDrln onu4alxrxr oo1omDr nvi;t) 2to(r3oo4lpe mfet (farrr(ronu4aleomf3ilslsDumnmo;t4tetrmr to1fa elies;t) exoxr3oo4altn ics t) Drru p;t4oexoifciytfm ulnmp;u4 rtnxocto1lpteanvslt0texo(r iy4llt lfvs t aDum(  oo1oleomietydfs2rmu ont4 lxoxfcia1fpDeaueo t  eur(r no1alee ivs (fs2ta(ro;u0tpxnmi3ilslm ulnmo u0aexnmf3to1opD livi;(0texmxo ny1aleelnvi s  ruaxrpnt1altnif3iasfm2umums u4artoif3oatoa ean s;t0setm(m iydll  mieilt)sDurur nt1apt  fciyslm eanms;() etrmo3ootlpteaivi t s2tm(o oo1lm  lnvtlsfsrur(rpnt1aexoii3ildlm emuvo;(0altoxrciadomteln ils)setoir3oydope lfvs s) 2rr( o;o4alt ii3iysfa2uluvo;t4artnxrcoatfpDr u i (0tetrxo3nydapee iviat sDtm(r nu4aee mf3iatlsDrmuvs;t4aeeoiociodfmt  n o;t0 etoxmpiydalt lnvia( artax p;u1tleo ociyt s2ua(vs;t0altoxocootfa  lieo;s s2trimpiydomt  ivt ()srtmump;u0tet  ictydla2rmu p;u4trtrxo ootoa r ivs;t) 2tm(opou1amtnlnei t  Durumpno1apxo fciysfaDrmn s (0tlenircoodlpD ai sl(  rxoir3iu4omt mictat a2uau o;u1ale ii3iatfm uaumo (4tetrmociytom  lueols) 2tr(r3iodop   feiatfarumu poo1tetoif3iat m2ul( sn() lenmo ty1lateauei;()tetoxm oy1lptn fetls srtrumo;u4aexomi3tatfm rmnvonu)altrir oytlpDr ivs t0srxm(opoodalt livsl()artmxr no4apxoii3tat a2ra(monu) lxnircty1fatr uvi t0sexoimpoudol  mnvils aDtr(m ;o1alxomfetld s2rmn ont4teeomo3tatlm eln slt0s2xo(r3oy1apee nesas artm( pno4olx moetlsfaDrmn s u4 rtnif todfatr i il() 2xoio3nu1lmtnmfvt s sDum( poo4aptnmiciatls rlumo;u0 etomo oydlpt  ieolt0seto(r3iudome lfvs t aDrmx o;t4opx  o3iytfsDrlu o;u)teenxo oa1fatraueo;( trumim iu4olenlies sfsDtrumpnt4optoif3iadfm2emnvpn(0 rerxfcoodlpt ai o;t)texo(o3ny4llenliesatf 2rrxr ou0olx  o3tat sDelnvo u4aexnmf oa1lmD lu s ()s2xoiopio4omtnmfct t aDrr(mooo0alenmocild m2el( pnu4alerxf3io1oaDrli i s0t2urimpiu1al nlfctlt)srrmxmonu0aetoii3iadlmDuln onu) etoio3oadlatrlu ilt  2xmxmpno1lpenmneiatfaDta(r no0tle  oeiltlaDemnvs;(0tlenxfciatla e ivs;t) rxmxopnu1lmt mfvtasfsDraumono0opxnmicilsls2uaumo;u4aeerif3oy1lptraieol(0 2xmxo nydolt  iesls srtm(rpnt1tlt mieias s2emnmp;u4 lermrctodlmD ai o s seurio3no4lpt mies t)sDumx p;t1tlxo ocilsfmDrlu snt0teeoir oo1la rlivsls)srxr(m nodlleelnetasfartm(m nu4aeeoiieiys a2uluvpn()texnxo ootlaDeli slt) rtr(r io4lpt lneta(f rrau pno4altoifeiat aDemnms;t4tetnxf oa1lpt lu s;s)texmxrpiydolee iei s)artaxmoot0alxoifciatfm2ua( p;u)texrxr io1fa ean ilt0s2xm(r3ou4lp elnei (f 2tm(  ;t1aeeoif3tadfaDra(ms t)aetrxocoy1omD lieols sexmio iu1llenlfet tf 2ur( ono1tetoiicildlm ra( p;(4teenif iotoateaivi ()seum(opoudol emfet s  rta(mo;u0opxnioeiytfs2uau s;(0 rxrif to1fa eli o;t t2tmxm3iydlmen fvi ()aDuau  ;u0tet  ictysfs2el( p ()tlxrif3todfaD au i;s)t2to(mpnu4amtnmnesltf 2ua(rpnt4tpenmfciys a emn pn(4arxomrctodop r i s;t0teum(m3nu4optnlfctlsfsDrr(mp;u1ole  f3iys m2elnmsnu) rtrir iadlp   n sls0teuoxo3oudal emncsa( sDrmxmpnu1tpeoii3iltfa2rmuvs t4 eerifciodlatelues;(0t2toio ou1omtelics ()aDta(r ;o1tpto ociatlmDrm( pnu4tleoir3tytfmt lueo t0t2um(o3ny1ole  nci ()aDtrxrpnt4oleomiciytfa2ul( pnt0arxoxf3todom e n s t  rtmxr oodal e fcsl( a2umu  nu4opx moeiydfsDul( on(4artrmrctodfa  livslt) exoxm3iy4omtnlictlt)s2urxmo;u0opeoif3ias m eln o;u0texoif totoa r ieilt0 exm(m iy1am e ieta()artmx  nu0tpe  feiydls2ranvs t4artrmrctydomtran i (0trtoio nu4apte fvsat)sDrau oou1tet  fetltfs rlnvonu4 rxrirctydopt luvilt)srxo(mpio1lltnmncils  Drmxroot1oexniictaslm umnmo ()aexoiocta1la r u o (0 2xmxo3oodlp e nvtatfa2urum nt4olto ictldfsDum(mo u0aeeomrcoydlpDraies;() exr(r nodlle livtat)sDuaurp;o1optoioeilslsDrmums;t0texoif oy1omteaieol( srurxr ou1olte fcsl( artm(rpnu0oltn fcilsfs ranmsnu0tetnmr oodfatrlivolt  etr(r oudamtemivias s2uau  nu4tet  ociysfsDulnvp t) rtomo tatomDrluvil( truo(m3iy4ole micia()s2rm( o;t1opeoifctytfsDum( o (4tleoxr3todom r i slt0 rtoxmpny4olt lncilt a2tau o;u0tetomi3tytlaDeaumo t0tetoxociytomt  ivo;() etoxo oo4aleelfcilsfartm(mpoo1apto f3tlsfsDrmums;t4 exoifcto1om  livil(  exoxo iu1al   iet (fa2umx p;t0tlxniiciysls rmu p u0tltriocoydlmt anvi;() 2to(opoudome micsas)aDraumpou4alxoifeiltfs rm(vpnu4artomr3iydomDeanvs;t0 rumiopio4oltnmfvtls  rumu  no4oexn octadlm emumpnt4arenmr ty1fm r uei;t) 2xrxopio4lme mivilt) rumump;u4aeeomoeiasfa2ea( pn(0tlxnxo3oytoa e n ols seumim3nydlm nmicsat) 2umx  ;t0apeoifciytlm eluvsn(0 ltrio3tydoa e uvo ()teuo(r oy4olee fvsl(farra(rpnu4apx  o3iatlmDum(mp u0 ltomfcta1oat anvs;t)texoio ou4al elici t)aruru ont1apxnii3iadfsDumnvs;(0tlenmrcoo1latr ues t0 euo(o3ny4optelncsas)srtm( oot1tpeoiociat a rl(ms;u4arenif ta1fa e nvil()s2xo(o nu4opeeliesat  rtm( onu1tptomociyt a2emuvo;(0alxoxf3iytlpDeluvs;s0seto(rpnu4lm eliciat  rtrurpou4oetn o3tyslm ran s;(4 rxoxoctydoa rau ils)seumio oy4alte nvslsf Dtmxr oo1oeeo oeilt s ra(ms t4 rtnmr oo1oatelneo (0 exm(r oy4om  lnctlt aDumuro;t1aexo fciadfm el(vonu4aexoio oydom rlu i;s)setmxrpnydap emncil()s2um( o;t4tetn o3iltls emumsnu) rxnifcio1opD li ils0srxmio3ou4lm nmfcils)srumurpou0aeenii3iad a uauvo (4 eenmrcoadlmDe nesl() rxmir3iydlmt mfesa(f 2rmxmooo1olt mociadls rluvpnt4 lxrmociatoat  neo;( texoxr io1lmee netlsf rurxmp;u4ope  octasfa umn o (0 rtniociotomD li o ( seuoxm3oy1aptnmnvilt aDuaxro;t4olxomo3iad aDem(mpnt0 rxnxf iadomtelneols  exmxrpiydape mnesa() rua(ro;t0opxn ietltls2rln o u)trtomf ia1la  ln o;t)trxr(rpiodome mncs s  Drmxmp;o4altnmoeiltlaDul(vpnt0alerirctotoatr nvslt0s2urio oy4amtemfctls)srtmx poo0oetniieiydls2umump u0 leoxoctadoat livsl(  rtr(r3oodlptnmneslsf Dtaur no0olxo i3ias s2ua(mo;t4tetrxf3tadfa   uvi;t)tetr(opny1amtnmfetasfs2uaumpnt0apenmf3iltfs elnmp (0 eeoir3ootfaDrai o;s)srtr(m3nudolenlnvi t  2tmxrpno0apxoioeiatfsDelnms (4aeenxo3oadfmDelnvs;(0s2um(r oo4lm  lneil(f 2taumo;o0tlxnmf3iltla ua( s;(0 rtnxfcootoaDelu ilt trtmxmpiy1llte iesatf 2rr(rpnt1tltomoetyt s ea(ms;t4teerxocoa1oaD au il( seumir oodolee nvil(faDraum no4aetomi3ils m2ra( s (4alxrmf oatoat lnvslt)t2xmxo3oydapte fctas arrr( ont1apt iicilsfm rlu onu4altnxf oa1opD  i sls texo(m iydolen ies s)s2tr(ronu4tex moeiysla eau o;t4aeenxr oa1lp r u ols)t2xoxrpoodop n fcsa()s2rmx p;u0tleo icilsfs um( o;u)aeeoifcty1optrlnvi s)teur(r3nu1lltelnci s srur(  nt1teeomieiytlsDrm(mo;() eeoxocta1oatr uei;() 2xr(mpiu1op elnesl( s2rm(r ;o1altnii3tytfm2ra(mp;()aeeoif oatfpDe nvs;s trxrxr no4al  lnesltf 2uaxm ;u0alx iiciytlm2elu p u)tlxoio3iodopt lieol(0 2tmxmpiy1ap nlnct t  2uaxr ot1apt  feiltls2umn s u4treomo3iotop  lneil( srto(rpoydal  mnvi sfsDrau pnu4aexnifetyd mDelnmo;(0 ltnmocoa1fpDr nes ( seuoim3nodol  mnvtlt  2rmu oot4tpe iietasfs uaump;u0 rtrmocoy1laDrlnes;s0seumio3ou1altnmncsas  Dtrum nu0aeeomo3tasls2rmnmpnt4aexoxr3oo1laDrai ol(0srurxo3iodamtnmfesat  rta(r nu4opt iicias sDeauvpnt4texnxf3tadfp rlivs s t2xoxrpiy4ale lnci ()a2rrumono4altoiicildfaDuaumpnu)trenir oy1fa  luvo s0t2uo(mpou1lm  lnct s)s2trxmp;o1ape  ietydlsDua( o;(0 reoxr3iadlaDeanvsl(0texmxo3oy4lm   netat  rrrumo;t4oeto ictysfmDrl(msnt)treoxo3totfpt ai ils0 exmxo3ny1amtnmivtat aDtr( o;o1texo ictydfs uaump u0areomf3ootlm eau s;( t2um(rpnu1ll elfciatf Dumx p;u1aeen fctltfsDrmn p (0 eermr3ootom r ues s0seuoimpnodaptnmfetlt) 2tax  ot0tetn ietlslaDeanvpnt) ltnio3tatopDrlivi s0 2xmxo ou4lp e icsls  rrm(ronu4oltnifciytlaDem(mo t4trtrmr todlp   iesl(0sexrxo3ou1llt mivsl( aDrrxmpou0aetn fetyslsDrmnvp t)aexrmr oodopt auvs;(  2xmxm3iu4lpee ncsl(faDtm(ro;t1tetn ieiltlm2ra(mo (4 eenmo3ty1omDran slt trtoxrpoo1lmte fcilt s2ta(mpot0alxomicilsfa2ulnmo u0 eeomf totfaDe u s t) ruoxrpiu4lm n nctas  2rrx pno0teenmoeiaslsDeaumo t0aetnmrctatla eln ils0 rxm(r iy4ap  micils sDuaxmont0aleomi3tysfa rmnmp () rxnxo3oydlp rli s;() 2ur(mpoo4opt livsa( artrxrp;t0oleniictyd mDuauvo u)altrir3tadopDraivilt  etmir oodamee fetltfa2rau  nu4aleo i3ils m2rlums;u) ltrxo3oatfaDeaiei t0texm(r3nydapen ics sfa2rrxmpnt1tetomf3tad a elu p;t)texoxo iadoaDr nei ()trur(m3no1lltelncs s aDraumpnt1oleoif3iyt m2el(vpn(0trtnio tytfpDr nvolt0t2xr(m3oo1oltelneia(  rraxm ot0tet miciad s uanms;(4alenir iydlaDrlu i s0 euo(r3no1opt lieta()sDumurp;u0tpe mfeild s2elnmp () rtnxfciy1faDelivilt0tetoxm oo4lm nlneia(f ruaxmonu4oeenmf3iadla2rl(mp u0trerxocto1lm r ies;t0s2xr(opno1lme lnvia( s2tau oou4tlx ioetys m2rl(mon(0 rtrxociatoatr ivo (0teuoirpno1lltn neiat s2umxmono4oetomo3iyd s eau o;u4 rermo3oydfmtr iesl(0tetrxm nudalee nci tf Dtr(rono4apt  fctldlm rl( s;t0 eeoxr3oadomDran s;s)trxo(o oo1altemieias aDrau poo1tptnii3iltlsDrln pn(4 ltoxo3tatlpt ln o;t0s2xrimpnodoptemfci (faDtrx onu1alx moeiytfm umu on(4trtoir3oadoa r uvs s) rtr(m3nu1omt mictat  2um( p;o0tlxomfeildla rlnvon(0arxomo3iytlmtr n i;t0 2urxm3iy1amtemnes (farraxmp;u1texoifeils sDeluvpn() ltrxrcoa1omD ln o ()srtrxm3iu4altnlncil()artmxmo;u0opx  i3iysls eauvs u)tlerio3ia1lmte neo;t) rtm(rpiy4lp nmfetl() 2rrxmpno1teeomfeiaslm2rmu sn(0 exnxfcoo1fpDelu s;
\ No newline at end of file
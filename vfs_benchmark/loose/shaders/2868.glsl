@@ -0,0 +1 @@
+nvilt0trto(r3nodlmte ncsl(fsDrr(m ou1apx iociltls2uluvs t4alxnmf ootlp r ivi ( t2trio3nodam  mnvtl( srrm( pot1altomfctatfaDeluvo t4 ltrmrcta1om  livs (0s2toxo ny1olte ncta(farta(mp;u1tpt  fctat mDelumo;t0alxrmfcio1fat anesls0 2tr(m3oo1olenmnviat arumx  ot1teenii3iltfm2rmuvp;()tlxnif io1oateai slt)t2urir nydolt  ics t srta(moou0tptnioeiat aDrmu o;t4texrir3oytfmD au i;( sruoxo3io1lmee icsat) rum(rp;u1aptnioetatfs eluvs t4 etomf3tytlaDeai i t0 euoio3no4olen ictl() ruaur ;u4opeomo3tys aDrm(mpn(0aeeomrcoadfpt aies s0t2umxo3oodlm e ncsat)sDrrurpoo1alxomoetydfa2rm(vsn(0tlxnmf3tytfaDraueo;( sexr(m oydomte fvi s s2tr(mpnu4oeeomi3tlsls rluvs;u4arxrmr3oatom eai o;t  2uoxm3nydalen fvt s)s2ur(moou1tpeoioctas mDeau s (4arxnmocty1lm elu o (0srtmxm io1ll nmiesls srumum nt1aex iicilslmDelu ont4tleomo iadfmte u ols)teum(o3oodlp nlncilt artaum nt4teeo ietatls2eauvs u) lenir oa1laDrluvs t0setm(rpoudam  mfci s sDurumpot0oet  oetatlaDul( snt0 eerxr totfmteauesl( t2uoxm3nu1lp   fes sf Drmumpot1alxn fcilsfaDum(mp () ltomfciotfm ean s s)texoir3ny4olen ivt t)aDtrurp;o0tlxoio3iatlm rmn o (0altoiociytlmDe ueil(0t2trxo oy4lmtn nct (f Drm(mpoo1tee ifeias s2uauvsn(4 ltrxo3io1om r ues;t  2urimpoy1om  lncs t a2rmurpnt4alt iietysfs rlnvpn()aexrxfctadlpteai ols teto(r iu4om nlivslsfaDur(  nu1tle mf3ilsfa2emuvp;t)tetnmrciadfmtranes;() eumirpoo1lpt  ivt tf 2uau pot1tltomieiltfsDrmn pnt4texrif tatlpD au o;s  etm(m3ny1alt mneta(f rur(m nt0opeoifctasfs2uanvo;() eerxr iydfp r i sl()trxoxrpnodape lict (farum(mont0aeeomoetadlmDem(vo;(4arerxo totlp eln il( setoiopnodoleelivilt)a2tmu ont0tltnii3iydla uln o t0treoiocoytlatelu i;(0 2to(opnu1ol elfvs ()aDrmuronu4teeoifeiysfs el( snu0artrirciytom e u i () ruoir3oudoleemiviasf Dtr( p;u0tee  iciyt a2rl(mp u0tlxomr3oadfpt  i ols0 rtm(r3iu4openmnvta(  rrrurpnu4oee  f3iatfa2uau s;t0 lxomr3oydfaDeln ols0texm(mpiodoltelfet (f Dururoou1teeomicildlmDrau o (0alenmf oy1oatrau o t0teum(m3oydop nmietls)a2trurooo4aee iictytlaDeauvpn(0trtrxo3totomte nvil(0t2uo(r3oo4alenmnct t srtmur ;t4aetnmiciyslm em( s u4 exoxf3ta1opt luesls seur(o oy1ole mfetatf 2truro;t0aptniictldlm eln sn(0 leomf iydfat aueo;(0s2toxr3io1lltelneiasf rtaumooo0apt  fcild m2eaumpn() rerio oytomD li o;t srumxm3io1amtemfcs s)srrrx pnt0aeenioctatls2rm(mpnt4 rxrmr ootlp ranvsls)s2xmio3nydlmt  nct sfs2umxrp;u1optn ictatfsDuluvs ()trxoxo io1opt an s t) rtrio3io1optemncils arum(r no4tptnmf3iatfs ua( s u4tltrmocoy1fate ieo;t) rumiopou1olte nvt t  ruaumoou0open fcildfm2um(mp u0 rxnirctytlpD luvi;( t2tmxopno1ol e fvtl(f Drax o;u1tptnii3iasfm2uanmsn()altoxo3ta1oatean ols0sexmio oydoltelnetl( aDrrxr no1aleo octyt a2ua( s;() rxnxf tatfmtrlnvs ()trxmxm3ny4lmte fesas)a2rm(moou1aee mi3iys s2rluvpnu)aeerxoctydfptr n olt  rxmxrpoodope  ies ( artrx ono0oeenmoctysfaDuaump;(0 renio oodfat  i i t0 2xrxr3nudlmtemnetas s2rrx  oo4apxoiociytfm eanvo t) eerxf3tytoate nvo;()teto(rpnudale  neil(fa2raxr nu0opt  iciytfs eln s;t4trxriocootfat aivolt s2tm(o3iu1omee fctlsf Dum(mp;u1ope mociat mDrmnmp;(4trerifcoy1fmD aivo;t setm(m ou4am emivi sfa2uau  ou0aptn ieiydfaDemuvp;u) ltrmoctatlmD lueil(0trtr(m3nu1lmt lnes s)srraumpot0teeoio3iysfa2rm( snt4 lxrxf ta1opDe n s s0t2umir3iu4ape  nvtatfa2rmxmooo4oeenmi3iyt aDua(mo t)aetrif3oodop ean s;t tetrim3nu4omtnlnctas  rumu  oo0apx  i3tydlaDrln sn()tetomrcoy1laD aivs s0sexmio nu4ol  lnesl(fsrtax oou1aptomo3tydfa2umnmo;(0 rerio3oa1fmtrlneol()t2xrir3ny4lpenlnes ()a2uru  oo0tlt  fctlt sDeaumo u4trxnxr oadlm eln ils)t2ur(opoudllt  fvs t arrau  ;u0alto i3iysls rlu o;t4tltrxf ty1opte u o;(0s2trim iu1op  lieslt s2rrxm ot4tetnmfeild mDrlu p;()trtrif3oy1lpDe n olt) 2xoiopiu1ape  fetasfartauro;t1apt ioeiydls emnms t) rtnxr to1oateluvsl( sexoxr nu4al e ncs s)srtax ont1alx  iciadla2raumo;t0treoxocio1oa rluvo t)teum(m oy1lmen nctl() rraxr nu0tlxo feiaslaDum(vp (4altniocoatla raneo;( srum(m io1am emnvt s s2rrxmpnt4oeen feilsfm rm(vs u0artoxo3tatfp  lues (  exoim nudllt  ivs ()sDur( onu0opxn feiytlmDemnms;(0 exrif3oadlatrlnei s)t2trxm ny1optn ivias  2rmx  ot0olenii3iys a uan pnu0trtrxo ty1opteanvo s0 rtrim3iudlm e fei (  2uru poo1ale if3tls s2umuvs;(0altrxfctotop eau slt  ruo(rpoy4apt lfci (fs2umx  ;t0tpeomi3iltls2rl( pnt)tltniocta1fa r n o;() eurim3iu1ole mfcsas  Drmurp;t0oex mfetytls rau p;t)tetnmocoatop   nes;s0s2toxr3iu1lmenlivt s sDum(mp;o4openmociydfsDumn pn(0tetnxr oodfpDrluesls0s2xr(mpnu1ol nlictl(  rraum nu1oee  ictltla uanvo (4alxrircoatlpt anvi s t2xr(rpou4lmte nesasfaDtaurp;o0optn o3ias m ul(vsn() lerio tytlm e uvi s trtm(rpio1om nmnctl(  2tmx pot0aetomoeild m rm(mp;()teenio iadlat  ueolt)srumxm3iydol elfetl( aDrruro;u0tleo ieiltlm umuvont4 rxrmocoo1opDelivi s srxmxrpoo4ope mnes t aDrrxmp;o1texomicildfm2eaums (0altrmo3todlaDelues;(0truoio3nu1amenmfct sf Dum(r nu1aex mi3iydlsDrlnvp;u)aexomocoy1lmt  i s s srxo(o oodlmt lfct t arraxr ;o1apx ifcils m ean s u) lxoif oodfat anvsls  rtoxmpiudapee fviat  2rm(  no1aleoifetys s2em(msnt)trxrirctotfmte uei;() etr(opiy1al e ici (f Dur(mo;t0aetnmoetadfm umu on()aeenmfcoa1fa e uvi;s teumirpio4lpenlnct s  rraurp;o1tlxniicilt a2ranmp;u)trerif oatlmDr n ilt0srxrio iudaptn fvi t srrrx  ;u0tptnmieiyd m rlnms t0 ltrmf oytlp e neol(  rxr(o3nodom  lneiat aDrm(rp;o1tlxomfeiysfm rl(ms;(0 lenmfcoatlpteauvs t)teum(opiy4lp emictlt s2rm( poo1opx io3tld sDemuvpnt) rtoif tatop eln sls)t2toimpnu1lpte ivi tfsrumuroou4teto icildlm2um(vs u0 lxomrcoytomDe ies;s)srxm(o nodol  livsltf 2tmur ;o1alt  i3tysfm ul( p;() lermo tadfpt li s;t  2umxm3oo4ope mnctlsfarrrxr nt0olto ieias m ra(vs (4tlxnirctydfmtranei s0 ruo(mpou4lmen nctltfs2uaur nt4opxn o3tyslm raump;t0trxrxo3oytomtr uei t)srumio3nu1altelicslsf 2tr(mpno4tpxoifctlt m umuvo u4trxnxoctotopt auvo;s)trxoir nodap e net t)artax  nt1oeeo f3tltla uaumo;u4trtnxfcio1om rlieo s0trumio3oo1lm  lieilt)a2tru  nu4oeenif3tyslm uluvs u0trxrmocoatlaDeln i (0tetrimpoudlltelnci s) Dra( o;t1ape mo3iadlm2em(ms;t0aetrxo oytfa eauvi;t0srurio iy4lptelivilt srur(mo;u4altoiieiasls2emu s;u0 lxoxf3iodfm elu i;()t2xrio3oodaltnlivtat)srtaum nt1apenmi3iatlmDum( p;t0 ltrio to1lpDeauei s) rxoir3nodomeemnetas s2tru p;u1tlenifeiaslm ul(msnt4teermr to1faDe ieo (  rxo(o no1om  mfcs sfaDtrur nt4tptnmociyd m2umnmpn(4 ltnif3iotlp r i o;t0trurxm nu4alenlietlsfsDra( oou0tptomicild m2emnvsnt0aexrmfcootoatrau o;t0s2toxr ny4lm n fvslt) ruru p;t4tlx if3tasla emump u)altrmo3oodomD anes;() rtm(m ou1lle miet s  2tmu  ot4aleo fciatfaDuauvs (4aexomrciodfmtrauvilt0t2triopno1ap n nvias)s2umxmonu4tltnif3tltfsDrmu pn(0trtnir3oodfa  lnesl(0 2xoxopnu1ole  netl( s2urumoou4tlt  iciysfmDrlnmsnu)aeenxo tytlpDrlivs (0trxm(r nodam  mnvt tfarraxrpot4aex  i3iyd s rm( s t0aeenir3tytoaDr iei;t  ruoxr oo4opte nvils)aDrrx p;t1tpeoiociat a2rmump;u0tltnmfcty1laD li s;s) etrxo3oudopee ivi tf Drmxrp;u0opxniocild mDum( s (0 lxrioctytfmt lnvils trto(opnudoptemnvtlt aDrmxrpoo1oleo iciysls2rmn o;u0 reoio iotfpD auvi t  rxr(o ny1ap   ncsas aDrr(moou0opx ifetltfa uanmo;u)teerir3ootfa e uvsls)srumio oudap   iet s)sDumu pnu4tpeomi3iydfm ul( pn()altrmf todoa rluei s texoirpiu1al n fctlt)sDrau o;u4tlenio3tadfm2emuvo;t4tlermr3oytfa  luvilt)t2tmxmpiydalenmnetatfartr(moot1tltnifeiytlsDulu o;u0 renxo3ia1lmt  ueilt) rxoxopoo1lmtnmicsasfsDtmx o;u1olxo ocilslaDrl(vp;t)trenxf3iydlpD  uvo t)srxr(mpou4ol elnvtat)sDuaxrpou0aexnii3ilt m2rmump;()texrmfcoy1lm e uei ()tetrim3nu4op e ivslsfa2rmur nt4teen ieiasfm2ulnvpnu) lenxo3tydlaD lu il(0 2um(mpio4omt mnet tfsrtaxr nt1opt mo3iadls2ea(mo u4aeerxr iydfmt aiei;s)trtrxo3iu4lmenmfvs s)aDtm( pnt1tex if3iyd s raumo (4teeoxoctydlmtr u olt0 2ur(rpoudopee fci ( a2umu  ;o0aex ioctat s rmu p;t4tetrifctydfmDr uvi;s s2xm(o ny4opt livsat) rta( pnu1olxn oeild a ranmp t)trxnmo oo1fpD lu s s) rtm(r iu4ole  feia( s2uau p;u0opxn o3tyd sDumn s;t4 etoir tatop elues;(0trxo(opoy1om emics s s2umx poo0ole ioeiysfm umnmo t)trtnxocoa1fmtrauvo s s2xoxm ny4lmt lfesls aDurx  ;t0apxnifciatls2um( o;()tlxrmo tatfmtelivols)tetmir3nu4llenmfeiat  Drmum ;t0aexnmi3iysfm2eanvonu0teeoxr io1fpDr n o;t) exo(opoo4op e fciltf Dtrx  ot0tle  i3iatfa2ranvo u)treoif3ty1laDe u o (  rtrirpno1omt  ivsltf Dtmx onu0apxnioeiat sDumnmsn()treoxfcoydlmtrau il( seurxo3no4alt licsat)s2taxm no0aetnioeiadfa umu s;t0 leomr oadop elneolt s2tmim3iu4am nliet t)aruaum no4optn ieiys m2eauvs t4 exrxfctodomDran ols) euoirpiy1opeemivils) Dum(mo;o1oee  iciltlsDra(vont4tlxnxrciydlmDrln i (  2toio n
\ No newline at end of file
@@ -0,0 +1 @@
+ivil() rxoxm io1alt  nvils  Dra(rpou0tpeo o3ildfm rlu snu) ltnxr3oytla r uvilt t2xmxo no1apeemnvi s artr(mo;o0aexomf3tyt m2rauvs;t4 exrmo3todopD  u i s)trum(o3oy1ol e fcsatf rtr(mo;t0aeenmictydlaDrmnmon() lerxfctadfpD auesls0tetoxo3nu1omee ieilt) rraurp;o0oltn iciysfsDulu pn(4tltomo3iytfp  anvi;t s2xm(mpnu4lptemieilt  2umx ono4tpen f3tydls el(mp;t0 ltnmfctotfaD aueilt) rtr(m oy1am n icsl()s2ra(m nt4tpeo o3iadfmDuln sn(0 rtrmociydoaDe nei t)srurxm oudome mfcs s)a2rm( pot0teto o3tls m eauvonu0aeenio oytoa ran ilt)s2tm(r3nydole mnciat s2ta(  ;u1oex ifeildlmDelnvp u0arxnmo oodfatrlu o;( t2tr(o3nu4lp  mfetls)srtaxrp;o4tlx moetyt a ul( s;u) ltoxrctotla  auvi;s s2xo(m3oy1oltelivtasfsrur(mo;t1olx ifeiltfaDrmn o;u0arxrio iadfmteanvo;t  rxrxr oydllt  iesls  Dtmxmont1aleomocild m2eauvs;(0tetrmoctydoat li o;s  rtr(m oo4lmtemnesas) rumur ;o1oexnif3iyd m2umu ont0arxrmr3oytfaDr neil(0tetrir3iudoptelivtl(faDraxmoou4alto ictat a emnvsn(0 rtrirctadlptelnvi t) 2uoim oo4lpenmfcilsfsDra(  ou0olt if3iydla2uau p;u0tlenxrcoy1lmt au o;(0s2xm(o3io1lmeemnvtltf rta(mo;o0tpxo fetysfm2umnvo t4 rtnio iy1op eaieols  ruoxopio4lltelictlsfartmu pno4ope ifeiatlmDeanvsn(0aetrxr tadlateli olt0 rtr(r3oo1apte nesasfarta(ront0oetoiieiad a2um( p;(0trtnifcoodfmtrau s () 2xrir3ou4olt mnvi (fa2rrx  ;t4tltnmo3iytlm2uan on(4texrio ia1lmteanvs;s) rum(mpoudalt mnvils sDtax  no0oleo f3iytls emumo;t4trtoxr3ta1faD auei ()t2xmio nodlpeemfcsls)a2tmur nu0ale if3ildfa2ra(vo (4aetnxo to1oaDrlieol( srtrio3iu4llte nesl(f Duaxm nt1teto ociydlm uau s t4aetomfciodopD  ivol() 2xo(rpoo1op elieilt artr( onu4olxoiieiatls rln pnt0tltoioctatla eauvil()trtrim oy4lmen nviatfarta(roou4alx  ictatlmDemnms u4 ltnxrcoa1oa eau s;s)trtoim3ny4ap n feiatf 2umu o;t4apxomo3ilsfs2rl(monu4aetoirciytlm raneolt0s2xoim3iy4llt mncsl( aruax  ou4apxniiciadfs rm(vpnu0trtnio3oadopD luei ( sexo(m3oodlpen icsasfsDtau onu1opto feiytfmDraumonu4tltnmr3iy1omDrli olt) 2umir nodlmee nes s aDtaxrpot1aptoifetydls2ulu s u4tlxnir3oadlm r ueo;()trtrirpoodomt  neil()s2ua( p;t1tpe  o3iydls2umnvp;(4tleomr oa1fmte n ils0 exm(opoo4ame  ict sf Draxrpnt1opx ifctad m eluvp (0arermrcto1lptr ivi s t2xoxopnydlme lneias) rrrx ono4tlto f3tad m rmump u) exoxocty1late u s;(0srtoiopoy1ale lneils  2tmxm nt1ole ioctas a2eauvo u0 rtnmo iadlaD  n s t0trumxrpno1ale mncta() 2rmur ot4tpx ii3iyd a2elnmp u0 ltnir oodoa eluvs;t s2xoxrpiodaleelfvtatfsDtrxm oo4oeen fetld m2uaumpnu) exomfcoa1fp rln s;t0texm(opiydam elncsat  2rrx  ;t1tpe  o3iasls2uauvp t4trtomr3oatlpt  ivil(0srtrxr ny4ap nlfeilt s2ua(mooo4tptnmoctatfaDeanmsnu0texrif3oadlaDean s t  rtrxmpio4ap  mfci s) rra(r ;u0olen iciadlm ranms;u4artoio iadfa rluvi;t)tetrxr iudop   iciasfs2tmxmo;o1olxo i3iydlsDean o;(0arerio tatoptraiesls  ruoimpny4am emivtas)srurumpoo0ape mfctatlaDem(mo;()alxomf iytlpDelivo;t0s2uoxm iudomeemnciat) Duaxmoou0ape if3ilt a2eln p (4aleniociotopDrlueolt0 rum(r iy4omt lietl(fsrumxronu1oex moeiyslaDua(vp (0arermr3iodomDeaiei;t0teto(rpoodlmtnlnei s) rrrumo;u4optnif3iatlmDrmn o;t)tltoxr io1optrln s;( s2xrir ou4altelivi () 2umx  ;u1tpt iietys s2ulnvonu4tltrxr3tytlpDeaivs s) etr(r3ou1lleelfct tfs2ta(mo;u4tee io3iydlm um(vo u) renmocoo1oaDrlueils0sexrxmpiydlptelfvsls)s2raumpou0tee ifctydfa umnmpnu)aetomo totlptran s;s trtmirpny4lltnmnetls)s2uru p;u4oex  i3ilsfa2rlnvsn()tlermoctytfmDe neo ( srumxm3oudaltnlfcia(f rrrx pnu1aexo octatlm uluvsnu4 rtnio3iydfmD li i t)s2uoxr nu1lpeemieslt)s2rmxro;t0tlxnmfciyt a2rmnvo t0 eeoxfcia1latr ueol() rxmxm iu1oltnlivils aDumx pno1oex iiciyd mDuauvonu4aeeomr tydlmtraiesls sexrir3iudlltnmnctls sDta(mpno1opx  o3tltls emu on(0trxomo totomtrluvol() rxo(rpnudaptnlnvt sfartr(  no0olenmfeiltfm2umuvp;t4aeeomo ty1late uvs s0 2xoxopoy1om elfcil()srua( o;u4tpx mi3iys sDem(mo (4 eermf3ia1oa  au s;s)sexm(o io4ap  lies (fa2rmumo;u4aexn i3tlsfmDrluvs u0tleoxocto1fa  auvs s) 2uoim3iydlp emnctls)aDur(root0aee  oeildla umuvs;(4trtriociatfpD lues (0sruoim3iodlltemfcs tf 2raxrpno4tpeoif3ildfmDemnms;(4tlxnxrciatfm rlivi t  rxr(mpoodameemiesatfs2tmu p;u1tpe  f3tyd a2el(ms;() exrmo3iotfptrln ol()t2to(m3nu4al n fciasf Dururonu0apxn oeiasfm2umumo u0tetrmo todlmD aivils0 exr(r iodom n ncsltfsDrru  ;u1opt  i3ils s2ulu o;(4alxrxo iatfmDe nvs;t t2to(m io4lmt lfetlt)srtmumpoo4oltn o3ildfmDeanmsn()arxnio3iatoa ean il() ruoxm3iu1omtnmncsas s2tru ont0teeoioctls aDra(mp t4 leriocta1fmtr u i () exoxrpiodlmtelicsl( arrrxroot4apeniocildlm2el(vpn() exoiocoy1lptr nes;()sexoxr3no1omenlfvtatfs2ua(rpoo0tpx ifciytfa2rmn s (0trtnxo todomt aieils trur(o3no4lpenlncsa(farumx onu0tlxo f3tatla um(vp;u4 etnmf ootoate ivs (0seurio nydal  livslt)a2tmum ;o1alt  o3tlslmDel(ms;(0 etnir todla elu i s0 etr(rpno1lmtnlnvsl(f 2tm(rpnt4tetoiietad m elums t4arenmf iy1lm e nvi;s) eur(mpnu1lmtelnet (  Durxmono1opeoifciys m2ea( o () eeoif3iy1lptrluvs t0truoiopnydam  lfcsasf 2tax oou0aleo i3iadls2elumsn(4trxoxr3iytfp  ln s;s) 2xmir3iu1am emict ( artrxmpot4optniietasfsDea( snt) leomf3iy1omDrai s s)t2xoimpnydaltelici sf 2tmxrp;u1olxo oetatfsDrlums u0arxrir iy1laDrlivsls setrxr3iodal n ivi t)aruaxmp;u0oeeomo3iatfs2uauvs;t)trxnmr3to1oaD auei s) eum(m nodopenlfes sf 2tm(rooo0opxn o3iytlm2em(vo;()teermoctodop rlieo;( sruoir nydlmenmnetasf 2rmx oot4tltomo3iys a rmuvs (4arxrxf tydfmDrlu slt  2xo(r3nudlle  fcsat)srtmur ;u1opto ociydfm2rluvs;t0tetrifcia1fmDraivsls0 2trxo3nudome  nviatf rumx pou1tptn fctlsfmDemuvp;(4teerxfcoytopDraivi t sexmxmpiydolte nvtlt srraumono1aleomoetytfs2umnmont4trtriociytlaDr ivil(0 2tm(m3iu1lm elnvs () 2tax pot0aeeomi3iydlsDulnvs ()aeermrctodoa elivs ()seuo(opoydlpe lncs t s2umumpno1opxo octadlmDrm(vpnt) rtrmr iatlaD aivs s)t2xrxmpiy4lme  ivsasf Dum(r ou4tee  iciltlmDeanvp;t) etnmf3todfmDean i t  rtoimpnu4ameemfcsasfartr( ooo0olen fctyd s2um(vs ()aeeoxf3oodlmDe u ils0srxr(o io1ap elicil(faruaxrpot0opx if3tltfs rmumo (0aeeoif iotlmDeai s;t0teuoimpoy4am n fetatf 2tax ont1opeoio3iyt a2rl(vont4aetoxo iytlatr nvo (0 eurxm3iy1amt  ivi tfa2ua(rp;o1oet moeiydfmDel(mo u) rxoxr3iadoat au s;t)teurxo3iodopenlnvslsf rrmxmpnu4tptomfeiltfs uauvsnu0arxnxo oodfmtrauvi;t trur(o nudap nlnci tf 2umumo;u1olxn fctys m2uanmp (0tltrxrctodlmtr u ols)t2urxr nudol elictat)sDurumonu4alx moeiydfs raums;t4aexomo oa1faD lnvo;(0srumxmpoudopenlfes t s2rrxr ;u0tet ii3iaslsDrau ont4aetnio3ty1lmDean o s t2ur(m iydalee ivtlt)sDraump;o0tpx ifetlslsDemuvsn(4trerif iydla r n slt s2xr(r3io1apt lnct t sDraxm ot4tptnif3tls s ulnmo u)tlxrif3todomDr nvi s)sexo(r iu1amtn iei ( arrrxmpou1tpe if3tld a ul( s (4teenxr oadfpt  i i s) exr(r3no1ap emneil( aDtaxr nu4ope mo3iadla ea(vs t0tleoxfctytfmtr nei s)s2xo(o3iu1am eliesasf 2rmxm ;o0tleoioeiltlsDemums u)tlxrxr oydfaD  n o;(0 eumim3iudlme lfetl( s2umx  nt0aeenmi3tytlaDea(vs ()teermo tydlm r ivslt tetrirpnydlltnlnvtl()a2uaur ;u1oeeoifetas sDuauvsnu4altrmf iodlaDeluesl()tetrio no4lmt mfctl()sDum(r oo4apxnmo3iyslm2rauvp () rxrmfctatomtrln o;s0srtrxo io1apen nvtltfsDumxm ;o1oee iieias sDua( o u)trerif3todom  auei;(  eto(r3iodlpt mfct tfa2ururo;u0aeeoiociltlm ulu o (0 exrmo ty1laD  uvi t0t2xr(o3oo4llee feil(fsDtmumoot0alxnmf3tyt a elnvonu4 exoir3ta1omt lnvi;s) 2xr(r3iu1ll nlfci t a2tm(mp;u1apeoif3iysfaDelnmo (0altnmo3ta1fa r ivi t0trtmiopny4omeelfvtlt)a2uaxrpnt0oeeoiieiydfm2ulnvs;u)trenifctadlpt  ueslt0 2xmimpiy1amt  icils srrm( pnu1tpto o3iyd aDemnmo t) exomf ty1laDr ivi;t0teuoirpoudopte icils)sDrm(mont0alt io3ildfm ea(vo;t0 exoifciytlm   ivs;t) etrim3nu4lpe  fes (f 2uru p;o4oltomoetls s ulumonu0 reoirctydoa  au sls texoir3nudameemnvsl(f Drr(rpoo1oet  i3iys aDuaumpnt)arenmf iotfaDeaiei s0 rxrirpiu4omtnmieilsf Dumxmpno0tlto ieiaslm2elu o () eerxo oytlaD aieils0texoxopoo4op nmfet s)sDrm(rp;u1aptomiciasla2emn p (0 lxoir3tadfp  auvs;(0s2toiopoo4apenlfcilsfarta(  nu4oet iictytfs2ranvo u) etriociy1oa elu sl( t2trxo3nydol elnviasfs2rmxmp;u0tlenmociadlsDumu p;()texoio oytomDrluvo;t sexmim no1am  lfctasf 2trum ;t0alt ii3iytlaDrlu ont)tlxomf oydomtr ieols0s2xr(rpiy4omt mfeil(f 2tm(r ;o0tetomoeiytfm2ea(vpnu)arxnmo oydfaD ln il(  2uoio ou4ol nlfvsl()sDua(  no0teen f3iysfm eau onu) etoifcto1lpD anvi;t)trxmio nodomen nes ()aDum(r ;u0tltnii3iad m rm(mo;(4aexnxf3to1oatr nvolt)s2uo(o3iy4lm nliciasfsDrru pnt1aeeoioctadfs el( s;t4trxrmf tytoat auei t)srxrirpoy1apt lfcsa() rrau  ;u1tlenio3tydlm2em( pn(4 lxnmfctotfm ran sls0trtr(mpny4omt  iesasfs2tmxr ;t1aeeomoeiltlaDulnms t)arxrxr3ta1fm elueils0truriopnydlp e fet s  rtm(mp;u0tlxn oeiad a2umu sn()trxnir iatfaDeau ols0trxm(opoy1opt  nvtas artmumono1tpeomocildls eanvo;t)trtnio3ootomDe neo t sruoxmpoy1olee ivsasf 2um(mono0tlx ioeildfaDrm( s;u4tltnxr oadlmDe u i () eto(o nodomee nvs t  rrm(m ;u1apxomociys sDemnmp;u0 eerxr oo1omtelies;s  rto(r ny1am n nctl( arrmumono1aee  ociasls2ea(mp (0altnxo oytomDr u sls0srtrim3iydamt lnctat  2ua(m ot1oleo ociys s2eau s (0aeermr3iydlaD lnvs;(0texmir iu1omen fcia(fsrrrxmpou1oet ifciyt m rlnms;u)tlenmf oatoate i i s) rtrxopny1ame  ieta()s2ururp;u0texnmoctldfaDem(vp;t4aeeomoctadoa   ieo;t  2uoim3iu4op e nesas  rra(ro;u4open fciltfs uan s;u) rtomr iodoa  livslt truoxmpny4op   ieilsf Dur(rono4tltnmi3iyd mDeln snu0tlxomr iydlpD aues s  2to(o oydalte ncsat) Durxm ;t4tex moctaslm2rmu p;()tltoxr3iodfpDe i o;t trum(m oo4ap e fvias  2rr(roou4texomfciysfsDelnms u4 ltnxrcty1lpDr nesls s2toirpnydolenmfvils sDrm(r ;t0tlxnmfciatfs eanvs u0 rtoxo3ootfa  lueolt teurimpio1amenmfeia()aDtmx pnt4aee iieiadla rluvp;u)arxrxr3iotlmt  iei;s  ruo(m3oy1al elfeil(farumx p;t1texn fcildla2ra(vp;(4aexrxo to1faDelieilt0 rxoirpiy4apenmnesas arurumont4oetnifciaslm2ran o;u)teeoiocoatlm e ivi ( seur(m3oudll  lnetatfsDtrurono1apx  oeiasfsDel( sn(4 eeomo oodlmteau ils)t2um(m3ou1am eliei s  rumx oou1apt  ociysls2ranvs (4 rxnxoctytfat li ols) eumxm3nu1om nlietls) Dra(ro;u4oltomoeils m ra(mpnu4trxnxf3ia1oate n s ()sruo(r nodalt lnvs tfs2ururo;t1apto i3tldlaDua(mp;t)aeermo3ty1omDeai o;()seurxo3ou1ole lnvslsfsrrmu  ot1tptnmoeiyslm rmn o;t)tetoifctadlpDelnvs;s)trtm(r iydlpee fvils srtrump;u1opxomociatfm rauvpnt)tltrmrctytoaDeln il(0seuo(rpiydamtn fci (  Dra(rpou4tltn iciydlsDul(vp;t4altoifcootom   nes;s)srumxmpoy1om  mivtlt  2rm(mont4tlxoiietadls2ua(vpnt)alermfciodlm   nvs t0 rum(mpnu4alenlnvt sf Dua( p;u1tpxoifetasfmDua( p u) eeoif iotop r ues;t t2um(r3iudal nlnetat) Drr(rp;o4alxo feiydlmDrmnmsn(0arerxr ta1latelivo t0t2urirpoo4ape  nes t) rtmur ou4tex mictlt s2em( pnu) rermf3tydoptrlu ol()texmxr3oodaltn fvt () Drr(  oo4oeeoifeilsfa2rl( pn(4alxrmo iy1opDeaivs;( srxmxm3io4alee fcia()a2raxmpnu1aeenmfeiadfsDumu snt4aexrxrcoatla elueo t)s2to(m ny4lm  mfct (fs2ur(mpnt0olx  ociys aDemnms;(0alxoir oatlmDrauvsls)srxoim3iu4aptn feiasfs2rrxmp;t4tpe  octatfmDrlnmo u4arenxf oy1la eai o;() rtrio3iu4opt  fesls)aruaxr ;t0tle  f3iasfs umu pnt0arerif oy1lmt  nes;s0teuoxr no1apte ics s)arta( pnt0apto ictld mDrmn o t0 leoxrcootopte uvs;s texm(r oydam  livil()a2tmxr nt4tetomo3tyt mDulu o;u0trxniociytoatelnvs t)setrim nudomtn ietltf rraxr ;u1olxnifeiadlaDrmu s;u4 lxomf3oy1fp e uesls  etmxo3iydal   fesl( a2tmumooo4opxn ietlsfmDemumonu4trtomo3iy1laDrau s;t0srtmxm oudamenlnvtas sDrmxm no4olt ii3iydfm uluvs () eerircoydlaDr ivs;t  rtrxo3oodapeelnctl(farur( o;u4oltomo3ilsla2eluvsnu) rtnmrciodfmDr n ilt)tetr(opnu4omen nesas aDurumono1aee mfeiltla2rm(msnu4trxnmr3oodoat au olt0trtoio3ou4llen ncta(fs2tr(m ot0alxn f3ildfm2ulnvo (4 reomf3oa1om  lu s (0sexoxr3iu1omtnlicsl( s2ur(mpot4tpt ii3tytla2emu p (0 rxnxr iy1fp   nvil()t2xmxr no1olen fvi t a2um(  oo4aetniiciytlm emuvs;u4 exnmo3iadomteauvi t)s2xmxopoydlmtn fviltfsDumxr ;o0tpxnioeilslm2emnvpn() ltrir oo1om eai s ( srtrxr iy4omtnmicsasf rur(ro;u1olxomfciadlsDrmnmont0tlenmo3oa1fa eaivi;(0t2ur(r iu1lpte ieilsfa2trumooo1open feiaslaDuauvp t4 rtoircoy1lptrau o s srxmxo iodomt mfctl(fa2raump;t1aex mfetld a raums u)teerif iydopDe uvo t0trurxr ou1op  lnci ()srra(ro;o4oltnmocild mDrluvonu4trxrxo iatfpDr uei t t2tm(m3ny4ap   fvtl()a2ururpou0opt  fciytfaDrau p;u4 ltrmociytfa ran s;t  2trio oy1oleelfei t  Durx pno1oex moeiysfm rlump;t) eeomf tadla e n o;t0s2umirpio4oleemiesa(fs2tmu pnt4oltnif3iyt s ulu snu) lxoir3oadla   nvols0 2ur(o nodop e ivil( sDrr( oou0tee  ocilt s el(ms;t4aexoifctodfmD  u i;t  eto(m io4lptn nvsa()srumump;u0apt mi3tls s el(mp;u)aeenxfcoa1omD auei;s) rum(r ny1aptn nvsa()s2rmxm ou4oltn fetat sDrmump (4teenif3ootfm rli i;s)tetriopnydomtn fesas)aDrmum ;o4aeeomf3ilsfs ea(msnu0alenif3ty1faD  uvs;( s2toxo nodomt  ivi t  2um(r ;t0tpxo f3iatfmDel(mp;t)trenmf3oytopD luvslt sexrio iodom elncsl(  2rrxm oo0opxoii3tlsfa ea( p (0 ltomf3oo1omDe nvsl( srurim3ny4ap e fet s)sDumx ono0tee ifeiydfs rmuvo (4 leomf oatomte nei (0setrxmpny4optn nesltfs2raxm ;u1tpe mi3iysfa um(vo;u)tltnircoadopDrau slt0setmir3nudlpt  nesl(faDta(rpnu0aptn feiat a ranvo t4tetrmrciytomDeliesls  exmio oodlp  lict (fsrraxmp;o0oet mocildla uaump u0altnif iytop eliesls)tetm(m nu4op  lncia(fsDtmurpnu1ape  feiydls2rlumonu0 leomocoytla raieilt trtmxo3nodomtelfesl(fsrrm( ont1altnmoeilt aDelu on(0aexrmo3tytomD livi;() rtr(m iy4ole  nvil(f Dtmurpoo4oltomfeiyt a2eau p;t4 exrio3totlpt  ivo;(  rur(r3oo1al elnes tf 2rrx  no4aeenmoeiatfs ulnvs u)tlxomr oytoateli i;(0 etrxo ny1al   fvsl()a2taum ot0aetn fetydfmDra( onu4aetnmoctadlmte n o;t) etmxr no4am elncil(f 2uax o;t4alt moetatlm umnvp t0texnxrcto1fp rai s;t0srxrir3oy4ome mnvs t s2rrur nt1opxn ociysfa rl( s;u0aetnmr totfmtr ivo s0t2urxr3ou4apen fvs (fsrum(  ou4olen ociltfaDrau o () rxoxfcoadom raivol( t2urio ou1olt mfvtat) Dtru pnt4oeenmo3iyd m2ea(vo (0texoircta1lpDrauvsls) rxr(r iy4llenlnvt s)aDurxmpot1tpen ieiltfsDrlu p;u) exrxo ta1fat ai o ()s2tm(o ou1omenlfci s)arta(ronu0olt  feiys sDelumsnt)treomo3iodop eluvils0sruoxopoo4openmfvsa(f Dum( o;u0alxomieiatla2rauvo;() ltniocoo1fmteluvo t s2trxr3nu4ol nlfcil( aDrrur no4tpt  ictydfaDumuvonu4 eenmociadoat ai slt  etr(m3iu1llen fet sfsrrmum nt0optnmf3iasla elu ont4 lxnmrcoatfpt anvsl(0t2xoxo ou1ol  lfei s)sDumx  ;t1olx mi3iad m2em(vo (4teermr totomt aies s0 2xrxm3oydom  lnvslt)arta( ooo1tptoif3iydfa2elnvo t0 rtomr tydlmD aivsl()seuoimpiydaltelfes s srua(mpot1ape  icilsls2elu s u0tlxoir3iotfa e nvo;t0 rumim3io4amtnlnct tf 2uax p;o0olxo fetysls ua(mo;t4 lxnxr iytom eln o () exrimpno4lmenlnvi () 2tmur ;o0tpx mf3iltlm2ua(vpnu0arenmo3io1omt  ueol( sexoxm3nodlm emfctat)sDuaxmp;o1teenmfciltlm2umnvo (0 rxnxr ta1fa r uvslt) 2tmxopoo4ll nlncsasf rumu onu1alx iociyd a2rlnvs () rtnmo3ia1latran il(0srxoxopiu1lmeelfeias)srra(mont1aee mfcias m2rmuvo t0tetoxo3iodoa rlues;()seurxm nu1ol emiet s arta(m oo4teeo fctldlm um(mo;(4alenio3ootop r ivs;t0s2xrimpou4om  mivi t)aDum( pnt1tpxnmoctld mDulumsnu)altniocoydlm ean o;t0trxm(o oodapenmietlt) rrr(rp;o1oeen o3iyd s ua(mo (4 ltrif3oy1oaDeau s s  2umiopnydllt  fvsl()aDua( pnu1alxoifcildlmDelnms;t0areoxo3tytoat li o t0trtoxm iu4aptelfvsl(f Dtmxrpot4tleo fetldfs2elnvo;()altrir3iy1faD  i s s t2umiopio4lpen feta()srtrxr no0apt ifciys sDelnvon()texrmrcto1fmDelnvo (0 eum(m no4amen iet t s2uauro;t4apto i3tytfsDemuvo (0teeoxocoadlpteliei;s0s2xo(r iu4ale mnvils) rumxrp;t4opxnif3ilslaDelnvs t0 rermf3todfa eanvo;s) 2xoxopou1oltelfes tfaDra(ro;t1olt iocias m rlnvo;u0 lxrxo3iy1oat anvil( trur(r3nu4al  lfeta()s2tm( pou1tee  feils s el( p;(0arermocoodfaDeli i;t) 2tm(opoo1lpenlivia(faruaxm nu0aleomf3iyd s2uanms;()trxomo todlat  nvs ( srxmxmpoodoptn icsa( s2rrxmpnu4aexoio3tltla eanvsn(0 etrmocoa1latr ues ()srurim3nydopenmieia()artrxrono4ope if3iytfs umumonu4 etrxo ia1la rli s ()s2trirpiydlptemiesltf 2rmumpnu4apenmoeiadlm rm( p;()tetrifcoytfpt an i;t0 2toxmpnudaltnmivi sf Dur( poo1tlxn feiyd s em(mpnt)artoxr iadlaD ln sl(0srto(mpnydlpe lfei t)aDtm(rpnu0teto fcilslsDrmnmsnu0 rtnmo oatlmDr neols0srxr(opou1olt lnetl() 2uaump;t0oet ifeilslm2ulu ont0tlxoif ty1op eaues;s)srtrxmpnu4lmtnlfei t)sDuaumo;u0oetoioeiatfaDuanvs u)tlxomf oydlpDe nes;( srxmxmpiydlp  lncs s artr(rpot1alenmfcils sDraums;t) rtrif3iy1oatr nvi;s)tetrio3ny1lmt livt ()s2trx p;u1opxoif3iytla2um( s ()trenmf ta1la  lnvilt t2toxm ou1ll emieta( aDtau o;t1aetomieiyslsDel(vpnu4trxoio3to1fp  lneils0 2umxr iu1ope micsas srrrxrono4tlt  f3iydfa eanvp t0trxnif iotlpDr uvs s0 2xm(r ny4apen fvta( aDraxrono4tetomfetytfs rl(mo;t0 rxnxf3ty1fmD  i s s s2uoxrpiy4lm elnct t a2rau  ;u4oet  oeiadlsDuaums t0trenif ta1omDe nvo;(0 rumio3oudom  lfvi sfs2uru pnu1oee miciaslm rm(ms ()tltnxo3oydoaD  ues (0 2urxmpno4aleemiei s  Duaum nu4altnmfeiatls2emuvs;u4treoio iy1lptrai sl()s2triopiy4lm elivtls)sruaxmpno1alx  fciltfmDeanvpn()teermf oa1oa  luesls trxoirpoo4om nlnct sfsDra(rpnu0tlxo ietat a umump;t)alerifcoo1opD auvs;t0texoxm iodll e fcslsfaruaxrpnu1tltnmfctatfs um(mp (4aexomf iodopD lieo;(  exo(opio1op  miei (  2raxmont0alx mfeiytfs2el(vp;(4 leoxf3iy1lp e nvs t)setrxopnydlptn fei sf 2um(moot1tpxnii3iasfm2emu snu)aexrxf iy1lptr nvilt)trum(o3iudll e nei (  2rr(rooo4oetomi3iytfa2um(vo ()arermf3iatlpDrlieilt0t2xr(m oy4omee icil(fartmxr ;t0oltnmictytfa rmn p u4treoxf3totlptelies t  2urxm3oo1amenmictasfa2uax  no1tpe io3tldla2um(vo (4 leoifcia1fa elneolt0 rtoir3oy1altnlfetl(  rtru  nu0aeto f3iydfa rmn pnu)arerif3iatfm elivils) exr(o3ou4ll  mfcia()a2tm(m oo1tpxn ocils s2rmums u)trermrciytfpD  uvs;t sexoio no1llen nvsas) Dtau o;o1teenmociadfmDuauvp;t4aeerxocia1opt  neilt  exmimpoy1lpenlfciasf Drrur nu4aeeomoctat a ulnmpnt0 eerir ty1latr uvols0tetr(r nu1opeelictltfaDumxmo;t1opx moeiatfs2rl( s;(4 rxrxr ty1fpt  ieo;s)texmio oydlp emfcsl(  Drax  ot4teen oeiys sDrlnvonu)tetomr iatomD auesls  rurxmpno1am  lictlsfarum(m ot4tpeomfeilsla2ul(mo t)alxnmoctydfpte nvs (0trxoimpnodoleemfci (  2umu ont1opxnio3tlt m2uaumon()tetrmf3oy1fmDe ies;(0 exmio3no1lmtelncias) Drmu p;t1aee  ociad a2uluvpn(0 renmrciadlpD  uvo;t) eum(r nydape mics t  ruaxmpou4ole mo3ilslm eln o t)tetoio iadfaDeaueo;s setmxopou1olenliesas)sDtaum ;u4olxo fciytfs2ulnmpnu0trtrxo3oy1lpt livi;t s2xr(opno4om n fci tfarraxm ;u0tlen oetydfmDrmnvonu)teenifctadfmDe iei t0s2umxrpnudamtelnvt sf rrmxr nu1ape  fctydlaDemuvp t0aexnir3ta1fptr i o s  eumxo nu4am emfvsls srurumo;u1tex  fciasla um(mo;u)alermo oydfaD auvs;()setmir3iydlpen neiat)a2umumpnu4tex  oetlt a2rmuvpnu) lxnirciodopD au i;s0teumim3iudlltelfvsat artr(mont4tle mfeildlaDuan snt)tltnxo3iatom e u ol()trurxrpoy1lm  lnes ( aDtmx  ou4apxnmfetlsfaDua( s;t0alenmrcoo1fm eluei t  rxmir io4lpe micias s2ta(mo;u0opxnio3ils aDraumsnu0trtoxfctytfp  aneils trxm(opiudlmtemnctltf rur(mpot4tetn i3iad a ra(vs ()alenir3oadlpDelu o t)s2toimpiu4amt micil(farta(monu1tee  i3tas s rmn s (4aetnir io1fpteauvi;()trumxm3nudapt  netas artmxrpoo0tpen f3tysfm el( o;t0areoxo io1fp  ln i ( srtr(rpou4optelieilt)srrmum ;u1tpxnifciys a2rau pnu)aexomrcoydoa  an ol() 2toiopiudameemnvtatf rumxrono1olxo iciydfs ra( on(4areoif3tytoa  au i;()t2trxr iydamtnliet s)sDtmxr nu1olxnmoctlt mDumn s u) etoio iotfp  aivsls0t2umir3nydalt mfct s)aDra( onu1olx moctas s2ra( s;t0 eenir3tatlp eauei;s0trxmim oo1aptn ncils)artax pno0aeeomfeiydfm ra(von(0arxrxfctytfptelu s;(0 2xmxo nodameemnes s  rtmuro;u1tpeomieiys aDrlnms;t0tlxomr iadlpt li i;t)t2um(mpnudomt livtl(fa2rmur ;t0olx micilsfs2uanvont0 lxrmfcta1fa  auvo;s) rurxo nu4lptelivsls  Dtrxrp;u1oeeomfetld m ua(vp;t)alenxo3to1lat  ues ( srtoio nodlme mfcsat)arurxr ;t0apt  o3tls a uanms;u0 exnmoctydoa   nvo;() 2toxm oydlptemncta(fsDuaxmp;o0apxnii3iltlm2uluvpn(4 ltnir oodlp elu il() 2tm(o3io4omeemfci s  rrrx pou4aetniiciat s2umn o (4aetoio3ootfatranvo;s0teumxo3iudopt lfvt s sDrm( o;t1tlx  octytlsDemu sn(0 lxnmf tadfm e u il(0t2xm(m3no1lm nlfei s)arrm(ro;t1olxo ictatlmDumn o () ltriocta1fpDraies;(0tetoxmpio1om   nctl(  2rmu  no1open fciyt s ua( sn(0tetoir oydomDrlu i s  2xoxm iu4ape mfes tfs2taurpno1opt mi3tlsla uaums t)teeoxo iodla elu slt  etr(rpnydal  licslt)sDtru ooo4tpx micildfm2ul(vsnt4 lxrmo3iotfpDrluei ( trtrxo ou1oleelicsa()sDur(mpno1aetnmoeiyt a2um(ms () rtoxfcoatfp   nvi t t2umxopiodll   ieia(f rrmxmo;t1oeeniietyd sDrmnms;(0treoirciotlpt aueo;t srtm(r iodaleemietl( artrum ;u4aeenii3iat s rlnms t0 rtoxocto1fm  auvo (  2xr(o3ou1lm emivils srtaurpou4tex mfciydfs2em(mp u4altomfctodom rauesls) rxmxrpoy1oltelncsa( sDtmxm ;t1oexomo3iadla elu s;(4trermr3oatfaD liei ( srto(r oo4opte ivslsfsDua(mo;t0optn o3iat a2ra(ms u0texomocio1lptrlueo s0teumxr3oudll emnvslt)aDurxmooo4tlxomietltfmDumu s u)tlxoxo3to1fa  luvi;t0sexrxr3oy1ameeliesas)aDtaxront1apxnmo3ilsls2ul( snu0 eenio3iatfm rlues;t)srxr(m oodam nmivs s a2ra(mp;t0tlenifciltlaDrau p;u0 rxrio tadopt  u o;s texoxo3nydope  nei ( artrxmp;o0oee if3ias m uln pnt0tltrmf3tatfp rli il()truoirpoy1ll  lncsa(fsDtrumono0apxn o3iltfm2uan ont4 rtoxo3tadfm  aiesl(0 etrxr iu1ape lnet () 2raxr ou0tpxnmieiysfs2el(vo;(4aetrif3oydopt  i sl( t2toxr oudlm  mfct t aDuaxmont1alxoio3iysfm ua(mo;t4tltnxr3oo1lmtraues;t srxr(r nu4opeelfei t s2raxm ou0aexo i3iytlaDra(ms;u0 lxoxf3oo1lpt auei s0t2trxmpou4lpte ivi tf Drr( o;t0olt mictydfs2emn p (4 eenxf oy1lm elies t)s2trxm ny4om emnet (  Drrx pnu1oex mictydlsDeanms (0aetnxr3oo1lmDeanvo;t0truoimpoy4lp emfcsl()a2umx  ;t4aeen ieildls2umn s u4 exrmf3tadfmDeli o t  eum(rpiu4ape  fetls sDur( pnt4teenmi3tadlmDuau s;u)texoxf totfm   n i;t0texrxm3io1aleemicias) Dtmxmpno0alt moeiydfs2ranmsnt0aeeoxr tadoatran s (  2xrio iodapt mnvtlsf 2ua(  ot1aleo fciad a2em(vonu0texrif iadomteai i;s) eum(r3iy1ol nmics sfsDra(mono1tltomieias a um( p;(4artriociydop r u i (  2toxmpou1ll e ivtls) 2urxro;t0opxn ietlslmDemu s u0 etrmo oa1fpt au o ()seuoxr oy4amenlnvt t  2rrx pnu0olt iicilsfm uauvs u) lxoifciodlm ranvi s)t2xmxmpno4alee ieiltfsrtaxm nt1opeomo3iaslmDrm(monu4texnir oydlp  lneols) 2xmir3ou1lpt  ivtlt aDrax ont0alx mf3ildlaDrl(ms;t0artomf tytfmtrlueo;t0trxr(o3nodapen fciltf 2ra( onu0apt ifetad sDrlumo;(4 ltrif3oa1fm  lu i;t)t2uoio iy4omt  nvias s2umum no4aee  o3tysla umu on(4 lenif oadlm ranvol()trumio ou1ame  ivias aruau pno0tlxo fetasla2rmums (4trxnif ta1opD  i slt) eur(o ny1oltnmnesltf Dtm(r ot1tltoioctysfsDelnvpnu)trerxocootfp eau o;t s2urirpiodole  iei s  Drax  ;t1ape  fcildfmDrm( ont0trtnxr3iatfpt lies;(0sruo(r3iu1om   nvsls)a2ururo;t4tleomoeildlm emnmonu4tlxomfctotfpt  nvi;( trxoxopno1altnmnvilt a2tr(monu4tee  o3tys a ulnvpnu0trtrxr3tytlptr ivols)s2uo(o nu1lp elics sf 2rrxrpnt1ape ioctydls2emumon()arxoio io1fat lueo;( s2umxrpio4amte neia( sDuax  ot1oeeo o3ildlm2eau snt)tetomf3oytfptr i s (0srxmxo iu1ol  mneiltfsrtrxm ;t0tpeoif3iatls2rmn s t)trxnmf3oydopt luvs;s)sexr(o3ny4ape mieiatfsDtmxront0teeniietatlmDea(mon(4 rxrmr3ia1oate neo;t trumxo3iydam n neia()a2rr(ronu0tee iocilsls2em( ont4arxnxf oa1fmDelieo () exo(opiu4optnmnet (fs2uru p;u1alx iieiat m2em( onu4 etrxfctotoaDran i;( trxm(o iu1ap emnci ( aDtrxr nu4tet ii3iytls2rau s u0 rtnio tadfa eauvo;t)t2xoxr3oo4lltemfet s a2taum ou0alxn ociasls2um( on(4alenmo iadoat lneo;t  eum(rpoudalt lici (fsrtrumoot4altnifetadla el( s t4 etrmr3oydfmDelneilt)teto(mpiodoptnlicils) ruaur ou0altoifctls m elumpnu4 rtoxf3oa1fpt  nvo t0teuo(o3oy1aptnmivtls)srta(r ;o4alto octyt a ea(mo u)aexrio3ootla rli s t) eto(r oo1al  lfvia() rum(mpou1apeoio3iasfa2uauvo t)trenmf3iytlp raies;s0srxoim oo4op emnvslt  Dumu p;o4tetniocildla2rmu snt4aeenmfcto1fa eaueol(0setr(m nodop n ivta( aDtaxmoot1apeoiiciys mDuanmpnt0 reoioctatlm r nvi;s)srtmimpiu1alenlict t) 2rr( ont0olenmfeiltfsDeln o (4arenmocty1fmDeaueils)sexm(r3iy4lm elfcsl(fs2umu oot4apx mocilsfmDua( p u4aexrmr3iodoaD auei;(  2umimpiudom nliesas)a2ur(root4altnmi3iadfa ulums;u)treoxr3oatopD li s t) exo(mpiy1omee fetl()srrrxmo;t1apxnii3iytfs2ulnvp t0 rxnxfctadom e ueils0t2trxo3nodomtemneil()aDtax o;o1oexoio3tls a2ul( p;u)alenxrciadfmD aieolt0 rto(r3io1lptn fctasf Draump;o1oeeomicildls2uanvp;t0tlenmf oy1op rluvi t0s2xoio3iudoptelnct tfsDua(rpot1tlto ieiasfmDua(vo u)tetoif todlpDrlnvo;() 2umirpiu4aptnmnvs ()aDrrxmp;t1alt micildfm rlnvon(0texrxr oatfa  luvs;t0t2toxopoodam emieia(f rta(rp;o1tet mf3iad sDrmuvo (0areoxr iy1lmD anesl(0t2xmxm ou1ol emfcsas) 2rrx pno0optomieilt s rmnms t4tltoxocta1fmDeau i t0 ruoirpoy1lm n netlsf 2uauronu4oetnmoetas s elumo;u0 renmr3io1fmD au i;s texmio oy4aleelneias arrr(  ;o4apen feiatla2rm( ont0artrxf3totfat anes;t) etmxr3no4lme mics (f rrr(mono1tlt ifcilt m2emuvs u)tetnxfciodoa  anei t seurxopny1lle lietltfsDuru o;t0alxoif3iytla2rmnmp (0altnxfciotlmD ln o;( trxrir3iy4aptemfcils aDtr( ont0tptoiieildls2um( s t)treomr tydopDelueilt)s2um(m3oodamtn ncils)s2tmxm nt0tlto feiydfaDrlnvonu4alxoir io1om   ueo;(  eum(o3iodomen nvi sf Dum(r nt0ole  iciad sDua(ms;()aexnir3ia1opD au o;t0 2xmxmpny1apeelict t)srrrum ;t4alxomicilsla uauvsnu4 etoir tytopDr u o ( seurxm ou1omtnmiciasf 2ua( pno4olxnmf3tltls2umu o;u) etnmo oodfm e ies t)srumxm oydap n nvs (fs2rmu  no1tlxo ictltls2ulnvsnu0trermfciydlm  ai i;s texm(rpoo1op emnvtlt sDtr(mo;o1texnmoeilslmDem(mp u4texomfcootfatrlues;s teuoim3oy4llee ivsas)arur(mo;t4opx  ietatls2ua(vs;u)tleoiocta1fpt ln o;(0texo(opiodam   iet tf rra(rpnt4alxoioeiyd s elumonu)tleoif ty1opD lneils0t2umimpnu4lptn fvtas aruaumpnu4opeoifciasls rm(vp;(4artnmo3todlatelu ils) etrxrpny4lpenmfesl(faDrm(  nt4tpen feiytlaDelums u)teeoxociytomtr ues t t2trxm3ny4lm e fcil() Draumoou0tptnmociasfaDraumpnu)aeenxr3oydlp e i o;(0teuoiopiu4lpt lnesls)srtrumpnu4oltnmfciatfs ean s u0 rtoio totfatrau i ( t2umxo iudapt  ncsl()s2umum ot0tle  o3ils aDumuvo;(4teermociy1faDeanvolt)t2toio3nodapeeliviasfs2tru  ;t4aexnioetatfa2rm(vo;(0 leomr to1lat livols0t2urirpno1ll nlnctlt  Drr(rp;o0apenmieiadlm2rauvp;u) exnif3oodoaD anei s)texm(r3no4al emicsatf Dur(mp;u0apx mi3tlsla rmnvsnt)trerxocoytoaDraivs;()trxrxmpio4ap nmnetltfsrtru pnu0oee  oeiysfm rmnvs (4tltnmfcia1om r ivol(0t2xmiopny1apenmnetlsfa2umx  ;u0alt iietlsfa rauvont)alxniociytoptrauvsls) rurxo3io4lpe mies tfa2raxmpnu1tpeoii3ils sDrl(mont)texomo3todopD  i il()srum(r3iy4lp emnesa(f Drau ooo4alenmo3ilslaDrm(ms (4treomr3oodomt auvo;(0teurio iu4amen nvils) Dtaxroou1tlxo i3tyslm2umumsnt0tlxoio3iytlpDeaieilt t2xriopoo4lmenmnvtas)a2umx o;t1apenmociydfs2rmu pnt)tleoif3oytfp  anvs;t)truo(o3ny4oleemfvsat s2umum no4opeoifciydfs eauvo u4teerxf to1lmt li s;(0teuoxr nydolt  ieil( srrrx  ;u4teeomociyd mDua(mp t) leomo3todfp rauesls truo(rpiy1altelneias s2rmurpoo4olen i3tydls2ea( o () renxo ia1fatrlivols0s2xmiopou4ale livtlt arrm(m ot4aptomfcildlsDel(mo t0 renxo tydomtelies;(0 2tmio3no4olee nesls)artmump;t4tpxn o3tydls2ulu o (4 rxrif3to1op r ivs s0t2to(m no4ap n fvslt  2rr( onu4tpt ifetysfa2rmu s t4 rtoxocty1opDe u s;t0 2xo(m3no4lle liei s) 2umum ou1opt mieils m2ra( o u) etnif ty1lmD  u ilt) rxoir3ou4llt  nvs t  rrm(m no4tptoii3iadls2el( s t) ltrircoatfmt  ivslt)s2xmxr oo4amtnmfcsl( arrr(mpot0altoiietls a elu s;(4trxomf3to1fm r ivolt0 2uoxo3iy4oltemictasf Draum ;u4teeo o3tysfmDrauvpnt)trtomr3oatfmt aneolt0s2trxo nodlme mfes t)srumur ot0tpt iiciydlm ran o;t)artnmr ty1fptran i;s  rtrxr3io4ape  iesas)aDumur oo0opto feiltla2rm(vp;u)tltomocoodopt au o s0 2urirpiu1ap   fcilt)a2umu pou1tetomi3tatlmDulnmont0 eermrcia1fpD  n olt) 2toiopno4olt mnci sfsDtr( oot1ale  f3tytfm el(vo;(0aexnxr io1faDrluvilt)s2toxrpnudoleelnviat a2rmurpnu4ole  ictytfm2em( p u0aeeoifcoy1fptrlu i;t) exr(m nodol nlfvilt) 2trurpoo0oex moeils a2ulnmp;t)teenmfctatfpDr nvol()t2tmxrpno1ale lnci ()srrr(rpot1olxnioetytlaDrmn pnt0aexoir ootlpt  uvo s0tetrxm nydlm e ies (f rraumpno1oleoioeias s2umu o;()aexnir3ta1omt au i s)trxm(opoy4amtemivi s  rra(rooo4apxo ietlt a rln p;t)texrmrctadoateau o;t0setmir3ou4omeemivtat)sDuru  ;u1tex if3tytlm ua( p (4altrxo3iodfa rau s s)s2xm(rpiodop eliviasfsDtrxmpnt1tpxnmicilsfa2uanvp;u)arxrif tadlaDeluei s0s2trxr nydamen ieslt  Dua(mpoo4aetn icildls elnvsn() exoircia1fate nvs;t trtoxrpiydlmenliet t)s2tmx o;u1aet ifeild s rmnvo t4tlerio3oatfptelivi;s)t2trxmpou1ol   neiasfsrurur no4oee iieiys a2uln p;t4tlxoxrcio1oa eanvolt s2tr(o3iy4apte ncsa(  2urur nu0oexn o3tyslsDrm(ms t) ltomf ia1oaD lueo;( teuoir iy1alenlies (fs2uru p;u0tpe ifciatla2elu o;u)aetnxr todlptelneol( t2ur(m3oodlptelieilsfaDurxmpno1aleo i3tytfm2elnmo;t0aeenxf oy1lmt  u il() exmio iu4aleemfetasf 2ta(  ;u0ape mf3ias sDrm(ms u4aetoxo3oadop e ivol( srtrxr nu4lptnmieilsf 2rmx ono0alx mi3ild mDeauvs;u)areomfciy1lm rai ilt) 2urxm3io1lptemnetlt)a2tr(rono0aetoiiciadfsDuauvs;t0trxriocoy1lmteaueo;t  2xoxo iydom e nciasfs2um(mont0aexoif3ilt sDrmu p;t4treoirciotoaDrau slt s2uoxm3oy1ol e fci s  2tr(ronu1altnmociatlmDemn o;()aexoxfctydlpDean i;(0sexr(o3no1am n ivtltfartaxmo;u1teenmo3ilsfmDranmp;u) lxoxf iatfmt anes;( srxmirpiu1oltn fct s) 2rr(mooo0ole  ociydfa uanvp;t0aexrifcoytoatrai i ( t2tmxm3iy4alen fctl() rtrxr ;u0tetoiocias m el( p t0tltrifcty1lp ean i;(0seurxr nu4op nlncias) rrmu  no0texnmi3tysfsDua(vsnu4 etnmr3tadopt  n ol( t2uo(rpiy4lmtelivs ()sDua(mono1apeomo3tatfs2ranvs ()altoxocoo1lpDrluvs;( srxmimpiu1omt lncta(fsruau p;t4tex  oetls m ulnms t4tetrxr3to1fptraivs s0teto(m3io4lm n nvsat) rua(r oo4apx mfeiatls2umnvon(4 lxnxfcto1om  luvolt0texoxo3nudamtn fvs (fs2trxmonu1tleniietadlmDulnvs;u) exrxr3totomt  ues ( srxoir nudaptnmnci sfaDrmxro;t0oeeniictltlm uan s ()aetnifciatlmt aiesls srtrxopoy4op n fctasfartaurp;u1ape mi3iltlm ea(mo;u4arxoxr3tadfpDeaues;()trtr(rpio1opee nctltfsDum( o;u4opxoif3tas s2eaump t0tetrio3oo1omD luvo;s texm(m3oy1alt lncilt sDrax poo4tpxoiicildla emuvo ()tetrioctytlaDrauvs;() exr(o3nodll eliet ( sDumurp;u4aeeomi3iytfaDul(vp;u) ltnif oa1opD  ivi;s0t2tm(r io4olte ietls srtru  no1oexoioeiydlm2ean pnt4aetrirctotomt luvs t t2xr(m3io1altnlnvtas)aDrr(r ou4olxnii3iad aDea( o;u0tleomocoatop rlu o;s  2xoxm ou1amenlieil(faDtrurpou1tetnifciydlaDulumonu)aetoxf3iodomtr u o t0setoim ou1ameelicilt)artm(mp;o0tpx ii3iydlmDranmon(4 eenio3oa1lmtrau ils)texo(opnu4aptnmnes sfa2ra(m nt4texnmoetys m2uan sn() rerioctatopDeaneil( srurxopiudape lnctlsfs2rmx ono4texnmoeild m2um(vp;t4tetomocty1latr i i s t2tmirpnu1ap emiciasfsDtr(m ;u1oltomfctlt m ul( p u) rxnxr oytfmDraueols0s2xoxo ou4om   nes sfsrrmum ou4oexo ietyslm umuvs t0 etoxfcty1om raiei;s)tetoio3oo4ap nlfcta(f Drmumpnt1oexnii3iysfm ra( p u) ltoxfcoydop   ivils t2um(r oydop   ivilsfarraumpnu0aptniieilslmDrln ont4 etnxf iatla  ln o (  2xmxm3oo4omtnlies sfs2tru o;t4oltnmi3iyslmDeanmp u0aeerxr ia1opD  ues;s0srurxo nu1am emicia()sDrr(mo;u1oex mfeiadla ul(mo t4trtoio3iatop elnesl()trur(rpoydolen nvta(fs2rmur no1tpeomieiydfm2uanms;t4treomoctydop   nvsls  eurio nodam elfct s)srum(m no4opxoifcildfm2uln o;t4 rtnxr3tytlpDrli s;s)srtrirpou1ap emivil(fsDur(  nu1alen ictlt mDulnmp;() rtoxo oo1faDeaueo;(  euriopoy4am e nvsasfsDtaumpot4alxo i3iysfm umump;u0 ltnio oodoaDeln o;(  2um(r3iu1amtn fei t s2ur(rpoo4olx iictasfmDumnmo;u0aeenir3ty1lmDeli i;( s2tm(r nu4ome lfci s sruaumoot4opxn o3iltfm2rlu snt0 lenio oydoa   i i;s0 rxo(r ou4alte feiat sDum(mp;o4tetnmo3iat aDrmnvs u)aetnxoctadlat lnes ()tetmim3oy4ol elics tfsDtm( pnt1olx mfctydfsDuln s;u)tetrxf iotlpD au s;t)srurxmpoy4lmtemnctl( srrau pnt1alxnmfciltla2uanms;(0altrmr iotop raivols trtoxr3oo4ale livsasfsDra(mp;o1alen f3iyd m2eluvp (4trtnxo3iydfmDrluvs t0s2xm(opno1amtnlfcsa( s2tm(root1optoioctltls uan o;u0 exnxo oydom e nei s0texoim iydaltn fct ( srrmu  ;u1tlx ii3ilslmDemn o u) exrmf iytla  
\ No newline at end of file
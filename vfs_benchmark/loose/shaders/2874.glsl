@@ -0,0 +1 @@
+u il()teumir ny4llen ics t)srumxr ;u1oex ii3iyt m2raumo u) lxrmo3ta1fatrli o (  2xrxo3iudalen iesls sDtaxr ot0oetoif3iltlsDrm( ont4alxrmociodlpDr uvilt)srumir3iydll   fesasfsDtrur nt4aeenifctlt m2ra( s u4aeerxo3iydlp elnvo;t  rxr(o3no1omtelivtl( aDumx  no0open oeiasla2uln o;t) lxoxf oa1oa elu o t0srtoxm ou1op n ncs t)srtrx  nt4tpx if3iydfm el(vs;u) eenif tytfm e u i s0setrxmpnu4op   ncsa(faDta(mpnt4teeomoctldls eln ont)trerxo3oy1lmte ivi () rur(opiy4lp nmncslt) 2tru p;t0ale  iciydls elums;u)trxnmfcoy1lm ean ols)truoimpny1op nlivt s)arur(rpnu1tlto f3tadla umuvs u0trtoxo3tadlpDe i i;t) eurim io4altn ivias  rtr(mo;t4oet mi3iytfaDrm(ms (4aetoxf3io1oa r neols s2urxo3oydll   iesltf 2ra(rpoo4olt mo3iydfm umumpnu) lxnxfcoa1optr neo;( trtoxm iodap n nes s) 2trx pno4tpen o3tys a el(msn(0trxomrcto1omt ln i;s)trtr(r3oy4op  mivta()a2urx ont1oee moeiyd m eau o t)aetomfciadoate i o s)seto(rpno4lm nlieslsfsrtrx  ;u0aetn ictasfa2em( o;t0areoir totlate ivs t  2xmxm3no4lmt mict s)srumx onu1tlt mfeiatlmDel( p;t0trxnmr iytlaDe n o s)trxoxr3iydomenmfetlt sruru p;u1oet mfcilslaDulnvpn()tlxnmo3oydlmDean sls srtm(r no1oltelieiltfs2raumpou4tlxomfcilsfsDuluvs t4aetrxo3iodfmtrlues;s srtrim3ny4om nliciat)srtmx  ou0aetomictytls uan p;t4teermfcoatfpt ai i t sexoir3oydllenmiet ( aDrrxmo;u0tex mietyd m rm( p;u4tetrmr3iatopt aneo;t)sruo(r3iodomte nvsl()a2ur(mo;u1oetnmoeiasla umnvon(0arenio oadlp r ueilt0srxmxmpnydolt lnvt s  rurx  ;o0alenmfeias a ran on(4tleomfcto1lmD anei;t0sexmxopiodlme mfvt ()sDrrumoou0aexn ictad aDumn o;t4trxrxo to1fa r ivi;s) rurxopoydll  mictltf rum(rp;o4aeenmfctydfa2uauvsn(0 rtnxfctadfptr uvi ()s2xmxr nodlpenlfct sf rrrxmp;t4altnmfeilsfm eluvo;u)tlxnircoo1fmtr uvs s)texrxm3ny1lm e fcslt) Durxmooo0olxnii3ilsfs rlnvs;(4teerxr3tatlp eau slt srumio ou1lmt  fvilt srrax  oo0texo i3tyd m2emn snu)aetnxrcoo1om e ieo s) exmio3no1ale mnvils srtaur ;o4teto fciltfmDea( s;u)artomr3iy1omDrauei s srtmim3iu4olt mfviat)arrr(m no1opxn fctltla ul(ms t0texnif oodfptr uei ()s2uoxo iudopt mietlt  2rmumpno4tpxo f3tlsls um(mo (4arermr3tadoat lues;t) 2uoxm3iodalt  nvtasf rrm(mpno4oetoioeilsls uan p;() rerxo3oadom  lnvi;t)srum(r3ou4ol n fcs (f ruaurpnt4opxomoeiyslmDrl(vs;u4arenio3totlpD aivols) rxoxo3iy1optelivilt s2ra( o;o1tleoioeiaslm2eanvs u0 lermfctodopDr ivols seuoxo3iudlptemicias)arururpot0tlenmoeiys s um(vo t4 etnxr ootlpDeluei s  2xmim3ou4omte neta(  rtrum ot4tee ifeilsfmDem(vo (0 exoxrcoytlmD auvil(0 eur(m3oydaleelnvt (faDtru onu1ole  f3tyd mDrluvo;t0 eeoirctydoptrli o t)sexmiopoy4llenmncsa(farum( p;u1olxo ociyt m um(vs;t4teerxfciydopteaivols  exo(opiy4amtn nciasf Dtaump;t0tptn fciyslmDulump;t0 exomr iadfaDeluvi s) rxmxo3iudll nlncsatf Dumu p;u0aet micias a2eau p () lenirctodfp   ivo;t) etm(m3nu4lptnmivsat)srra( pno0oexniieiad m um(vs u0teeoifcty1omt an sl( s2uoir nu1op elfvt t srrrurp;u0aexn fctydfa2em(ms t4trtnifciydfa  lneo;t)trtoxr3io1optnlfcs sf rtrurp;t0teeomieias s elnmpn()altnxr totfpDrauvsls0srtoim3oydame lfes tf 2raum no4tpto oeiatlaDuan p t0texrmr3oy1oatr u o t  rtrxo oy4alt lnes t)aDua(  ;o1teeo fetytla2ea(mp t4aexomf3oy1lpte uesls0s2umxm oudalt lncil( srurump;u1apxn i3iytfm2ra( p u0tltnxf3oadfa rlueols0t2xrim3ny1amenlivi s  rtr(  oo0olxo oetasla eln p () rxrio3iydoptrluvs;t)s2xmimpnudalee ietltfs2ta(rpno0apxo oeiad aDea(von(4tetrxo3tadfmDrai i;s0 euoxopoodlpen fctls)a2rau  oo4alx mociaslm um(vonu4texnxr3todfatraneo;( s2xm(mpiy4lmtnlfeilt)s2uax  ;t4olt  o3iad a2rln p;(4 etrxrcoadoat  iei () 2tm(r3nydolee icias  rtrurpnu1tle mf3iltls2ulnvsnt)alxnxr3oo1omD  neo;t0trxoxm3iy4aptnlnvs (farrmxmpnt4tpx io3iadlm ulu sn(4trtnmfcoo1lm e ies;()trtm(o3ny4lm   fvs tf 2urur ou1oltoifciad s eanmp;(0 rtnxr3tadomD ln o;( tetoxm3nudal nlfvils  Dur( p;o4aeeo fcildfs rau o;t0aexrif tytlpteau sls0 rtrxo iu1op emfcs sfa2tr(m ;o1olt  icild m ranmo (0trxomf tydfa  aivs;t0s2to(rpio1amen fvtl(  rrm(rpou1tpenmfctatfs emnvp;u0tltnxf oatfpt liesls) eto(m3oy4lm n nvtasfsDtax pnu4opx  feiltlm2ul(ms;()arxrifciodopD  nes;s0srumxm iy1lmtemnvsatf rtr(mono0oexn ietysfa2uaump;t4alxoxr oodfmDeanes;t sexr(o3no4lle mivil()aDta(rpoo1aee  oeiasls rlnmont4 rxoxo3ta1op e ueolt s2toxmpoy4lp  lici s sDtrxrpnu4olen iciyd sDeau ont0 rxnmrcia1omDraues t0 2tm(m3oy4lm nmfetls) 2rr(moot4tpt  fetydfs2eaums;t4 exnmr oydlmDeli s;(0 etr(m nu4ole  fvtas a2umu p;t1tpto iciltls ean pn(0 rtrmo tadfmt li olt0s2tmir3oy4omen nvsltfsDum(mono1ale  feildlsDeau o;u4 lerxo tatfat au i;s)trxr(r ny4al e ivslsfs2trump;o1aleomo3iysfa2em( pnu) lerxocoy1op  anvo;(  2um(o ou1olt mnvi tfsDtmu pno1aetomieilslmDum( s u)tleoxoctodfp r nes;()teurirpou4omee ics t aDrm( pot1ope ifeiytla um( o;t)tleomo3iytlaD auvs;t0t2umxo3no4opte ivslsfa2rm(r ou1alxnif3iysla2ua(mo;t0aexnir tatla  aivs;( s2ur(m ny1lpt  neilsfartmurpnu4tltoiicilsfa2uaumo t4texoif iotla   nvo s)t2tmio ou4ope mfcsl() Dur(mpno4aex  i3iat mDraumon(0 etrmf todlpD lu s s t2xr(r nudopen iei tfaruaxmp;o0olto ociat a ulnmpnu0 reoxrcoo1fptrlu s s0srur(r ny4omenmivt s  2uaxronu1aptnifeiadla rmnmpnu)tleoifcto1op   uvo;s) eurxmpny1lpee fcsa( s2raur ;t4ole mi3tat mDelu s;t0 eerxrcoatlmD luei s)s2urxopno1opt lnvtlt sDtmumooo1alxomicildla2ua( s (0 leomo ia1lp elies;t)s2tr(o oo1ol elfes tf rrrurooo4tlt  ociatfa ra(vo u) ltrif3iydfmDr nes;()setm(r nu4altnlfct tfsDrrx p;o1ope mociatfs emnmont0tlenif3iotopDr ieils)s2toim3nodamenmfvsltf rra(m ;u1olx ifeiatfs eanmon(4aeenif io1fa e uvs s)texr(m3iodop nmfet s a2taur no4tpenioeiltls uanmp;u0aetrmr iy1laD lnesl(  etr(m3iy1ame mnesl( a2umumo;t1tleomfetltls2ul(ms (4tlxnio3oo1op   n s;t) rxm(o3oudoptn icils s2trxrpou1apenmociydlaDra( s u)aexrifciadfmteaueol(  etoxr iodol elictatfsDta(ro;o4tpt  oetadfsDem( o;t4tetnmocoatlat  nvils0 2uo(mpiy4olenmnei s) 2um( p;o0tpxo oeias aDem(msnt) lenir3iytom ran il(  etm(o3iy1aptnlivtls)aDuaxmooo1olxn oetyd m ulu o t) lermf3oo1fmtrluesls texrxm3iy1ap elfctas s2urxmpno1openmi3iydla ea(vp;(4trtrir ia1laD an o;t0sruoxo3oydap  lnci tfsrua(roou0opt ifciad m rmnvon(0artrmociotoaDeau s s)s2xrimpoo1omte fcs t)arur(rpot0olenmfcildfaDumuvs;(4tlxoxr tatlm  lueilt)seuoxmpiodlp nlneta( sDraum oo0olxnifciydfa2em(ms t) exnmo3oytla r nvo () 2trxo3iy1llt  nes s)s2raxr ;u1aet  ieilslsDuln o u)artnmo tatlaDrlnei;(0 2to(mpnu4lmen fei (faruaxmp;u1oet  iciatfmDuluvon(4 etnxf tydlpDr i i;() 2trxr3ou1lp emieslt) Dur(  no4aetnmi3tasla2el( pn()tetoif3oatfmD livo t  2xm(mpiu4ape mnet s sruru  ;t0tptniiciasfmDea(mpnu0 rermo oy1lmD aieo s0trum(o3oudoltn ietlt sDuax oou1apenif3iasfm2rl(vo u0alxnxociytfp  anvsl( t2uo(o3iydale  nes t sDuaumono0oetomiciatls um(vs u0 rtrmo3iotoaD lieol(  rtoir3oudlmtelieiltf 2ta(mo;o1tpe mf3tldfs emnvo u0 renxo3iotlaD aieolt0sruoir3no4am  lfetat sDtmu  oo1tet io3iytlm2ra( p;u4trxrxo3ta1omDe ieo t)teumir iodamtn fvtlt)artru pnt1tpt mfcildfa2emu onu4 renmf oydopDrlu s;(0 rum(rpiydapen nvils arurxrpot1ole mfeild m2el(msnt) eerxfcoy1opDrlueils)t2xr(o ny1amen ics ()srraxm no1altn f3tlsfm2umn onu4tlxomf3tatlatranvo ( s2trir3nodamt lfcsat aDraxmpnu4oee io3iat s ran ont4arenxr ootfmt ai ilt) 2tr(r nydal  lfeta(  2uru  ;t0tltoiociytfs2eanvo;()trtomfctotoa  lieil(  etrimpoy4am   fesat)a2tr(  ou0apt iictadla2rlnmsnt)tleoxrcty1fm rliei s  exoxrpio1lm e fctas  rrax ooo0openmoctydfs2umnvo t4aetoir3oa1omtelnvi;(0 rxoio io1omeemicsatfaDurx  nt4tee  feilsla ra(vp t0 etrmocoodomDrluvs ( teuo(m no4ame mfesas)artr(r no4opx  oetlsfaDumuvp;t4teeomocty1laDelneo s0 2tr(r3iy4ole mivsatf rtaurpou0alt mieiasfs el(vp;t4arxnxr3iadlptrli o;t0teuoio3iy1lpt  iciat aruaur ot4optnmfeias a2uln o u0altoio3totfaD aues;s0 etmxm iodllt lfes (fa2uau  ot0alenmoetld a2rl(vpn()teeoir3iatfaDr u sls)teto(r iy1lmt licsasfarrrum no4oltn feiaslmDranvsn(4tltoxo3tydomtelu ils)tetr(o oy1lm nmfcsas)arrmxr ;t0apxomi3iytlm2rmnvp;u)trerxo3oy1fm  lneslt0trto(o iy1lp   fvsatfa2tmxr ot0ape  i3tas m2emnmpnt0altrircoy1lpD  nes;t  rum(r no4omt mivils) 2um(m ot0olt  fctytfs ra(vo (4 lenir totfm rlu i s0 euo(r3nudop nmfvsas)s2rrum ot1opx mieilsla2ua( p;u)alenmr3io1opDr neolt) 2uo(mpoo1ole  fci sfarumurpnt4opeomfciltlm2ea(vonu4tlerio3iadfm raieol( tetm(o3iodame mnct sfartm(m ;t0opxoiieiadlm ra(mo;(0arxrxo3ty1omt  nes (0 2uo(o3nu1ape  nvtlt) Dtmx ont0aee  iciasfm2ea( sn() rtrxf3oadla eai ols)s2xmir nudlpee fcilsfartrx  oo0opxn o3tadls rmuvpn(0aexnirciydoatranei (0setoimpno4ll n feiat)arurxr ot1tlxoifctls m ranvpnu4 rxnmfctadlpDr nvo t0 rtrio3oy1apenlivs () rumxmo;o4tpxomo3iys a2umuvp;t4 eermfcoo1omDraivolt t2tmxr oydaptn fciat) 2uax poo1optnii3iytfs2ra(mp;(0 eermo3ty1lmtr ivol()trtm(opoudlmeelnetas  2rmxrp;o1oeto o3iat m rmnvon() eerio3oydla  luvi;s s2xmxrpio4alenmnetas) rrr(ronu4alx  ieiaslmDumn s;t4 eenmf3tydlm  ln i;s0 etr(rpno1al elfcsltfa2um(r no1aexnmfetlsfm2ranvp ()aexnif3oytfm   uvs;s) 2to(opnu1lm elivi t)sDum( ono0tle mieiltfm2eau on(0trtnmf3oadoaDelivi t0trxo(r3iy4lpenlnesat)srtmxmpnt0aet  ieildla eanvs;u)teeoif3oytfa   u il( trxmim3nu1am  lfesa()arrmxrpnu0tpxnmo3ilslsDrlumo;t)tlxrmf totoateaieo s)setoxm3iu1aptnlneslsf Drm(rpnu1oet  o3iasls2rlums t) lerir ia1fpte nvols t2xmim iu1amt  fviat)a2taxmpou4aeenmfciadfsDelu pn()trtnmr3iy1optelivi;()tetoxr iydapt lfcta()aruaurpot0apx mociltfm2elu on(4arxoio3to1fm r i sls0 2tm(o3ny1olt livsas  2uaxr ;o4oetnioctys s emn p t)altrmf3ootoaD  ivi t sruoxrpiy1aptnmivs () 2ra( p;u4tptomoetadla2um(mp;(4 rerif3tatopD lnvs;( srum(r nudopt mivil(fsDrax p;u0tee  ociat aDemump;t0tlxomo oydfpD  ieo;s0 rtr(rpnydaltemfet s) Dtru o;t4altomicias a2eau ont) eerxo3iodlm r uvi;s0t2tmirpny4oleemfvtl( a2rrumooo0aexoifctytfm2em(von() ltomrcia1lmt li i;s0setoio oy4lmtn ietltfs2rrxr ;u4apenmociatls eaumo t4alxrifciodomD ai s;s) 2urimpno4aleelfvsls) rta(r ;u0aexn ictadfs rmnvo;t4arenif3iydom r u i ( srto(o3oo4lmtelfct s  2tax  ;t4aex  o3iatfaDum(vonu) rtrif3tydlm e ivi;t0 rur(r ou1apt licia()sDur(rpnu0tpto fetld s rln pnu0trtnxo iotomt  nvols)truoxmpiodll e fes sfaDum(m ;o1opeo o3tydfm2rauvo t0tlxnxrcoo1fmteauvs t0s2xm(mpnudom  mncsa( sruru  nt4apxoifctys aDeln p;(0tetrmfctodlaDrau s s)setrimpnudamenlictlt)artmuroou1aeeoiociytfm2raumpnt4tetnir3ta1op eli ols seurxm3iy1lltelics ()s2raxroot0olx  iciat sDra(mpnt4 leomfcoa1lmt  ieo t)seurirpiudom emnetls aDurumpot0oexniociytlm rm( s;(4 rerxr iodfptr ivil( teto(r3oudop  lfvias)s2rr(r ;o1tlx  o3tysls2eanvo;t)arxrmocio1optrlivs ( srtm(r iy1alenlfcsl(fsrtaxmp;o0oexnioeilt m2eluvpn() lxnxf3iotlmt an i;s) 2xoir3io4al  mivtls s2rmxront1aptoifeiyd s2ean on(4 exoio oy1opt an olt0 rxmxr3no4lmte ncs t  rraxmont4aexoifeiltls2ua(msnt0 rtoio iatfmtrlneo;s0srtrio ny1lltn nvsl()s2trumpou4oeenii3iydla emuvp;(0artrmoctatlmteaivslt0t2tr(mpnudlleemicilt s2taxm nt4oeenmociyd m uln pnt0arenmociadla eln olt)texr(r io4amtnmictlsfs2rrurpot0ape mfeiatlmDuanvp;t)tlenir oatoptran s s trurio3oydape mietls)aDrr(mp;u4opxoioeiltlaDea(vs;(0altrif3ta1lm r ivi t  etmxo nu4olte ncils)a2uaumont0oleoif3iyslsDemu o u0trxnmo iatfmte iei;t) rur(o iodomtnlfes sfaDrrurooo1tpeo f3iydfm el( on(4 etomf3ia1fmte n i (0 2tmxrpoy1opt micil( s2ur(mo;o1ape  o3iatfa uluvp t4 eenxo3ty1op eanvslt0 rto(o3nudolen neiat) rtau pou1tpeoif3iyt a2ul(mo;t0 etrif3iotfpDeaues (  2um(o3iu1ame lnvs tf Dtaumooo0opxnmictatfm eau p;u)trxrifcoadlpDelnvo t  2umxopny1al nlivtls  2trx onu1tpx moctltla2ra(vont0artrxrctadfa elnvo ( srtm(mpno1alt  neil(fa2urx oou1tpxn feiatla elu s;(4aetoxf3oo1fm r nei s)t2umim oy4ameemieils aDurx  ;t1tpeo ieiat a2ea(vpnu)trtnmf3tatlat  iesls trxoir ny1om nmnvs tfsDum( ooo1ope  f3iatlmDeanvonu4aetomr3ta1lp  liei;s t2xoxopiudol elneiatfsDrmurpnu1aexnmo3ild s2elu p;(4 etrio ty1oaDelues ()t2uo(m3iudll e fesa( sDtr(moot0tltoif3iaslmDulnmsnu0 eenmrcoatopt  uvsls s2xrxmpnu1amen nciat  Draxrpnu0tlx ifeiysls um(ms (0 etrxo todfptr u il() rxr(r iu4alee ictlt artr(ro;o0oetnmi3tad a ea(mpnu0 eeoir totomDe ivo;s) euo(mpou1lm emfvsltf Drmu pou1tlt io3iyt a2emuvsn()aexnirciotoatr neils)trxoiopiudape lict sfa2trxront1apx ioeiydfm em(mo;u0aetnmocoo1lpDe neol(  exr(opnu1olen netas artr(rpnt4teeo iciysfmDrln s (4 lenxo3oa1lmte u olt  2tm(rpnodll  lnviasfarta( poo4tlxomi3iysfaDel(monu4 rxrmf3to1lpteaivs s0trurxm3oudale  icilt  rrrxm ;u4olxo ociyd mDul( p (0 reriocoo1oatrli s s0t2tm(m3ou4amee fvsltfsDtm( pnt4aex  oetldlm ulnvpnt0alxnir oy1lp eaneil()teum(r iu4lpe liet s)sDtaxr nu1tetnmf3tas a2ran on()tlenmfciy1oa raiei t sexoxopnydapeeliei tf 2raumoou1aex  oetatlm2eaumpnt0 etrio3oo1lmDeauvo s  2trxr3ou4ll e icia(faDrr(m nt4opto fcias s ea(msnu0alenxocoodoaDr i o t) rxo(m nudll   nvsl(  Drax pnt4tpe ifctadfaDrmnvp u)tlxoircoo1om raueol(  rtrxo no4alt lnctas a2rmu  nu0oetnmocildfa2emuvs u)texoio3todoateauvo s0texoio3oodlleeliet (  2rrx pou1tpxnmfeiyt s2eanvp t4aetrxo oodlm  aies () euoxo3ny1omtn ici s artr(rp;o1oltoii3iys mDrm(mo (0tlxnxocoy1oa  anvolt)srxr(m ny1lptelictasfs2rmumpoo1tetomfetadfsDrm( pnu)artnxf3iodlatranvs;s)s2toio3oo4om n ieias)s2ra(r ;t1tlxoioeiyt aDul( snt4aexomr3iadfmt aueol() rtr(rpnodom n ieslt)srtr( o;u4aptomi3iydla raumon(0aeerxrciatlatrlivi;t)seur(o3oudom e ivsas)arumxrooo4aexnmoeiasls eanmo t0tlxrircoy1oate u o;( sexm(mpio4lleelict s) Dumuroot0opxoioctys a2rl( s u) rtomr to1fm rlnvi;t0srtm(mpnodom n ncsa()artrum ;t1tex  o3tldlsDemnvo;t0 leoxr3todfatr neo s0t2uoim3iu4alenlncslt  2tau ont4aleoiiciysfm2umn snu)texrir3oa1oatran i t)srumir oydam n ncsl()a2uaxmo;t0tpxomo3ild s2ul(mp;(4altrmrciotlmDrluvo s  eur(rpiudamt lnvi t)s2ua( o;o4tpxnmi3iltls rluvo t0 reomo3ta1oat an o;s)srumxopou1ame mics s)s2umxrp;u4tleo f3tysla2rmuvs;(4 lenxf oadfp r n olt s2tmir3iydome lnvtatfsruaxm ;o1apxniieiatls rmump u4areoirciatfp r i sls0s2tmxr oy1amtelneilsfaDtr(moou4oetoio3iltlm2rl(ms t0texnxf3iy1opt  nes;s)sexrxm iy1ope  ivtlt)srtmu  ot0apen fciatfm2rm(vs u0 exomr3oytoaDelu o;t)texmim nudll   nctasfsrrrxm ;o1texnioeild sDra(vp t4artriociydoaD  nvo;s0s2xriopiy1al  livtlt)a2trumpou0tlx ifciasfaDum( p;()texoxf3totlmt  nvi t) rxo(opoudolen ici t)sDuaxmpoo1teeo octatfaDrln p t0tltoir3oy1om eaues;t0t2umiopiudome mfetat  Dtaxmono0tpe micildfs um(mo (0 etnmf todlp ran s s  rxm(o iu1am  mnetls) Dra(mont0alxoioeiasls2elnvo t4trtnmo oadlaDrlnvs;( texrim3iy4lpe mnei t  2tmu pno0aexoii3ild m rl(ms u)arxrxf iydlatranes t)t2umxrpnudlpte fcslsf Dtaum ;t1opt mfeiaslm2ra(ms;u4 ltoxr ootomDeliei;t s2xr(o ou1ol emieil(f 2uaum nt1texnmicilt aDul( s t)arxoxfctatomtrlueo;( tetoxr3iu1lm nlictltfsrur(ronu4aet mfeilt a2ea( s t0 rtomfciatomD  i i;t)truoxo no1lm n iesls)sDtmx pnt4opt ioeiadfa2umnmp;(4 lxrxrciy1lmDe ieo ( tetmio iydlpeelicsatf Drmxm nt4alx mi3ias sDulu o;()trerif3oytlat  ivs t)t2xoimpiydaltemict tf Drrxmpou1aee mfciltfsDua(vo t0 eeoxocta1la  auvolt0trumimpnodap nlneta()aDrr( ooo1oexniieiysfs emumpnu4 eeoxf iydoatr n s (0setoxopnudlp n fci (f Dra( o;t4olxoio3ilsla ua(vonu)trxomr3oa1lptr ueslt) 2xmir iodlp n fvtl()aDua(mp;o0aptoioctydlm ulnvsnt)aeeoxrcoy1fmDelivs t setrimpnu4ole  fvil( sruaxmpoo0aeto o3iadlmDum(vo;u0arxnio oo1omtelu i;s seumir3iu1ome  nvilt) 2ta(mp;t4ape iociysfaDeanms;(4 ltrir tydfatelneol(  rtmxo oodaptelncta(fsDtrxmp;o0apxoif3ildlm2umnvpn(4tleoxf3ia1latrauvol(0trxrirpoo1ap e ivta(  rurxrpno1openmo3ias s elumo;t0aeerxr io1lpDr nvilt seurimpnydlp elnvsa(  Dtmxrpot1tpxniociad sDeln p;u0trxrmr io1lmteaneo;s0teto(r3io4am elnei t srrmuro;u4aeenmiciys s2rlnvp;(4tlenxfctodoptr u i;s0 2tm(m ou1altnlfeiasfsDuax  nt4opxnmo3tys a2umuvo (4aeenmf oo1laDeaueilt) exrxrpny4ole mfcs t) Dtmumpnu1optomoeiysfa2uln p t4trtomr3oatopt  ieil( seumiopio4ole lncsatf 2raxro;t0olenio3iysfm2ulnmpnu0arenmrcoodfpDrlu i;(  2urio3no4lpeelivtltf rta(  ot4tpe ii3iat mDea(vs (4teerxoctodfmDe nvs t0 exmxr oo1ap  mieia( srumx o;u0optnmi3ilt mDuanmo t4treomrctytla rlivs;() 2toxopoy1apte fvt ()aDtmuronu4alxo fctasfmDelnmon()altoif to1omtelies;t0tetrio3iydllenlfvi s) Dua(r ;o4oexnmictldfs2ul( snu0tlxomr3to1omtran il( sexmxm no1oltemnvtls aDuaur nu0opx iieils mDean s;t)trxoxf tatop  aivslt0sexoxrpoo1am  lict t aDrr(ro;t0texn ietld a2rmnvs;t0 eerircoydfptelu s s t2trir no1al elnvtl()srrmuront1tltoioeias aDulumo t4aexoxr ootlpt  neil() exm(r3nu1lmt mfcilt)srtaumpnt1opxoioeias m2elnvs;u)trtnif ta1omteln s;() etmxm oy1lpeemnctltfsrrmxmo;u0ale if3tadfm um(monu0tlenir oy1fat aivi;(  2xoxr3iy4ame  net s  Dtm(  nu1tpe ioctltlaDulumon(0 eenir3todlaDrau i;s0s2urxmpou4al nmiet sfs2tau poo4tlen i3ias m em( p;t0trtnircoy1lptran ils) exmxmpny4opt  icsat  rtr( pno0aexnmfetysfs uaums t) rermo3ty1fmtraneolt0 2umxo3oudape  fvtltfaDua(mpou1tee micilsfsDel(vp () renmfctatoaDe iei t0texm(m nydlleelneslsfs2tm(mpot0tltnio3iytfa2umu ont)aleoxrcty1optean ils0 2xrirpiu4llen nvta( sDuauro;o4aptomf3tasfs2uan s;(4artomr tatopD au o;()trtmio3no1lleemieils)arum( onu1olx mfctat mDeln p;u0texomr3iy1fmD  ueo;t)trxrio nu4lp emncil(fa2rr( pno1tleo feiad a2ra(vo;t4 renxf tydfat au sl(  exoxmpny1alt  ictls)aDrr(m ;o4tee  oeiasls ul( o (4 renmf3ootlmDrluei s0 rtrir3nu4op  livsas sruaxmont1texo ictyd mDeauvpn() etoio oatfptrlivi t)teurim3oudlm  micsa(f 2taump;o0aptoiietasfaDrlu o u4trermrctytopD lnvo ( s2xrir3iodlm nlfvt s)a2rm(mp;o0oetoifciltfaDulnmsnu0tetrxf3iotop e ueols)t2tm(o oydlpeemiesat) Drrumpnt0aet  oetyt s rl( o;u4 exomo to1lmD lu i ()setoirpoudal nmnvils arrru pot4ole mietltfm2rmumont4altoxr3tatlaD aueils trtrxo3nodlm n nci t)a2tm( pnu4oleo oeiasfaDranvpnu) eenmf tadlp rauvilt)tetoxr3io4am emnvtlt)arta(rono4opt  fciyt a umump t) lxnir todfpDr n i;(0srxrxmpiu4omeemncslt a2tmxmp;u1aeen i3iatfs uauvo;u4aetrmociatomDr ues;t)sexoirpiodllt  ncta() rumx o;u1open i3ilt a2rln s t0tetoif iadopt  uvs;() 2uoimpoo4lmtn fvt (f ruru  ;t1olenio3tydfa emnmon(4trtrxoctytfm r ueils0srtmio no1op n net s)a2ra(  ot0texnmi3iltls ua( ont)trerio3iy1omte ueo ( setoxm oo1ol nmncils sDrrxm ;t0aeeoifctasfs el(vs u0aexrxr iytfaD ai s s  etrxo3nu4omeemfvt tf Dra( oot4apto ietlsfsDem( p u) rerxr3ootop eauvsls) 2tmir3ou1alt  ivtat)a2rm(  nu1tpxoifciat mDea(ms;()texomocta1laDrlivi;( texr(r nu4llt lncs (faDua(r ;o1tpto ieiltlm2uanvs u0arxomr iatfpte u i (  etrxr3ou4apen ies t) Draump;u1openiiciad s2ra(mo u0trxrxr tytfaDr uvo ()t2xmio no1lmtelfeilt) 2ra(mpot0altoifciydlm2ulu p u4trxrio oytlm r i o s  etoxm nodlmtnlivias)aDtm(root4oleomo3iltfa ua(msnt4 lxomf oo1lpD  nei t s2umir ny4omt lncta() rra( p;o4tpx  ociat aDua(vp;t0tlxoxrcootop eli sls  etrxo iudol e neilt)a2rm( o;o0ale moctas a rl(vp;u4altrxr oa1oa   ivsls0s2tm(r iydop nmnvi t) Dtrxm ou1tptn o3tyt sDeln s t4 lxrmr3oo1om rli slt)s2urxopiodlmtnmics (  2rr(r ;o4oexoifciad s emnvp;()aetomr3totfm raivo ( t2tmimpnydllt lfvsls a2tmx p;t0oexo fciyd a elu p;(4arxnxo3oo1om eau o;(  exm(opny4lmtnmfvs ()aDtau p;t1alxn o3iyd sDel( o;(0artrxoctotlpt  nvi (0 eumxo3iodom nmnctat)a2rrx  nu1tlx mo3tysfm2rl(vp u4 ltoif3oodopD li s t) exr(o3iy4olenlics ( arra(mpou0tpt mi3tldfa rlump (4 renxo3ty1lmtr ivs s0s2uoio iodamenmiviltfs2uaur ot1apt  o3tld a2ul(msnu4tltoio3oy1omD  uei;() rxrxrpno1oltnlicia() 2umumpnt4tpx mieildfm2elu sn() exrxf3iotfmDr ues t trxmimpoo1ole mfciasf 2raur ;u4alt  i3ild m2rl(vp u0aetriocoydfpD luvol(0s2uoxopnu4lme mictlt  rurxmp;o1aet  f3iltfa uluvpn(4aexrmoctadlatr nvs t teumiopou1al nlfvsl()aDra(  no4altnio3ils s umumsn()arenmfciadfatelnvolt t2xm(o io4ap  mictas sDtr( o;o1tpeoiiciasfa2ra(mp t)trenxr iytomDrlnei (0setoio nu1lpt lncsl()a2ta(ro;u0aexnioctad a2elnvs u4aeeoxfciy1fmtelues;()srxr(o ny4lp  lnvsls) 2um( poo4tet ifeiaslm2rlu s t0artoxfciodopD luvs;s  rtoxm oo1lle lfet t  Dua(ro;o4aee ifetldfm uau ont4arenmrciy1lpDrai i;s t2trxmpiudamte fetas s2tmum no1tet iieiydfs2rln s;() rxnxociytlmDeaieo;() 2xmir3nodop   iet t)sDtm( pot4altnmi3tadfm umnmon()trxomo iydfmt lnvo;t0 exrxo3nydlm  mnct tfsrua( oot1ale ioeiyd s uln pn(4altrmfciytlm eli ols s2tr(o3iu1omen ncil(fa2rmx  ot0olx mfcildfsDemumsn(4 exrif ootfm raiei;s  2xrim3ny1ameelnct sfsrumx  oo0aee mfciyd a2um( o;t0arxnxfciydlpt lies t0texo(rpou4lpenlnei sf 2ur(  nt4optnio3ias sDeau pnt)texomr3oo1lpt livs ( sruoim3nu4lmenmiesl() rrm(m nt0tlenmoctadfaDuau pn(0 eeoif tytopDrai o ( t2ur(opiy4lmen ieia(f 2trxr ;u4tpxoiictltla2emn s;t4altnio ootlptrlu o;t0trtmir oy1aptnmicsas srur(mo;u0oex  oeilsfa2rmu p;t4 rxoir oytlp   nvo;s setrio oy1lp n icils)s2urxr ot4apen oetadfs ua(vs;()trtomr oytlmDelneolt s2ur(r nu1om  mieia(fs2tau o;u4alx ii3iydlmDuaumo (0aeeoio iadlpDran o s)trxrxmpno4lm e ivs ( sDraxrono4tetnii3iad sDrmumpn(0teenxrciy1opte nvi ()t2tmimpiu4omte fvs t)sDumxrpou1apeomfeiadlsDumn o;()alxoir3to1lm rai slt  exo(r iydlpt mietls)aDrmur ou4tlt mfetlt aDrl( s t0aetrxfctytomDr i s (0 exr(o3oo4aptnmics tf rrmumoou1aee  i3tydfaDrm(mpn(4tltrxf totopDeau o;t0seuoir oy1al nliesltfsrtaxrpno4tpenmi3iytfs2umnmp u0 renmrctatlaDr i slt trxm(o3iodop elfci sfsrtax  oo1olt  ocils m2ul(mo t4tlermfcoy1lpDr ivil()t2tr(r3no4amte fvtat)a2rmu o;t0aetnmieiyslaDemnms;u) lxoircoa1fmtelieo;t0truo(m3nu1omtelneta( a2uaxmp;o1aetniociyd sDul(vpn(0aetomrcio1lm  livi;()teum(r3iydlmte fct ()a2taxr oo1alxoiieildfaDelumonu0treoiocto1op rlu ol(0 rumim3oo4ap n fvtls s2taur ;t0tlxo fciadfs rln s;()tlxnxo tytfptr ivilt)s2xr(rpio4am   ictl(fs2uru  ;u4aetnioctltfaDeauvp u0artrir oo1omt aies (0t2xm(r3no1ll nlfeiasfa2rrxroou0ope  i3ilsfa eanvo;t)aeeomfcta1oatrli o s) 2urxo3oo4amtnmietltfa2rm( pnu4ale  iciydla2uluvsn() exoxr oo1lpte ueslt  2tm(o ou4lme mfet ()artm(mpoo1aptnmieiadfa rl( ont0 exrxr3oydoptrli o;s  2tmirpiu1amenlictas)sDrm(rp;u4aetn o3iadlmDemnms u)aexrxrcta1om rau i;s)truoir3ny1lmt livsas) Drmump;o1teto ieiyslm eluvpnu0 renxocoy1omt livs;( trtrir3oo4lpenmiciat)aDta(mp;u4alxomf3iysfs2ean pnu)teenxrcoy1lm eluvol()srtmxrpiy4lle micsa()arrax onu1oet  i3iydfm eanmp;(0 lenxoctytlaDrai slt)seuo(rpiodapenlncta(f rtrxmpoo1apeoioetls m umuvpnu) leomo oydfp   ueolt  2urxr3oo1altn nvtltfs2umxm ;u1aee miciydfa2ra( s u4 ltrir ootfp elieo ()s2urio3oo4ap   ietl(  Duax  nu1tex iictltfs ulu o;(4 etomr3ty1fa raues;(0 rxoxo3nudaltn fct t)a2taxroou0apx  ictyslmDul(vpnt0texrxf iodfpt luvs t0texm(o3nu1lp elncsa(  Duau  nt4aleo fciaslmDumu o;t0trermr3oydfmtelues;(0texr(m oy1amtn ivs ()artaxmpnu1tpe iieilsls rln pnu4altrxocoytomt aivils0 2toxm iy1lmeemfvtas arurxmpou0oltoii3iatls ua( p u0 lermf3ia1lpDe nei ()s2xr(o io4ap  mivilsfs2rmu ooo0apxnmoctat a el(vp;t0teenxo iatoa e i o;t0 etmio io4lpe mfes ( a2rmxr oo0tle mfctyt sDrm( pnu4alxrifctytopt anvs;(0t2trxm3oo4ll   nvsltfsDrrxmo;u4tleoioeilt a2ranvo (4 rxoio iadlmte ues;s)s2uoio3iu4ope mies ()s2um( ono0apen f3tlt s2ra(ms (4aetrxo ootfptrlu ils) 2uoio3no1al n nvt s) rraxrp;o4tet  i3iyd sDeaums;u4aexnir oa1lmtrln i t0trxr(m3iy4lmtemiciat)aDururoot1tlt iicilt a2umnms;u4aetrio3oydfmtrau s;s) etmio oo1ame  fct (fsrtmxm nu0tlxnmfeiadla2ran snu)trenmo iydlmDraueols) rur(o3iodlm emnei t)s2ta(  ;o1tee iiciysfs rm(mp;t) rtnxf totlpD  nes;s)s2toxr3ou1am e fcia(  2uaumonu1olxo oetld s ul( o u0areoxo oatlate uvo s)t2tm(r3ny1altnmivi (farra(mooo4tltnmoetad s2eln p;t0 rtnxf3ty1fpt  ies;() 2uoxmpno4lmtemfes t) ruaxr no1tpeomieild mDrau s ()aeermo3oodlpD anes t  rxmirpnydomte icils)s2umxro;u4oetnmicils m ulnms;u0artrxrciydomD  ivi s)teuo(mpiydllenlivs (fsrrr(  ot1oexnmfctyd a2ulnms u)trxrxo io1fptrlneslt)srumir nu4lm e fcsls)aDumx p;o0ope mfctlsfm el(mpn(4tleriocoadfmDrlues s0 rumxopno4ap n nvsatfsDtmu o;t4teenmfeiys a2ul( o;t)alxomrcio1fpDrauesl() exmimpoudlltelfvtas aDuaxr ;o1alenmfeiydfa2rl( s;u) rerifciytfpt  ivo ()t2trimpnudll nmnvsl()aDuaxro;u0tet ioeiadlm uauvonu4trxnifctatopD luesl(0 ruo(rpoodope mies ()aDraxr ot4oexn f3ild mDuanmsnt0tltnif3ootlp rluei s0 rxo(rpoodll  mnvs t)aDum( o;o0aexoio3tldfaDeln s (4tlxoir3to1fm e ivi s  euo(m3iudlmte fctlt)sDum(  ;t1aptoio3ilsfm2rlumsn()tetrio tydfa ranei ( truoim3oo4lpenlfci (  Duau pnu4olxniociytfsDuauvp;t4artrmfciodlm e n il()srurxo no4ol   fci (fsDrr(mont0teeo o3ilt a2umuvs u)tltomo3oytla   ues s teurxo nudlltnmfci s)sDrrx  ;t0apeomfcilslaDumnvs t0trxnir oo1oa elivo (  eto(m3oy4open iviltf ruru pnu4tlen octatls em(vs;t0 eeoxo oadfat  uvi s texr(mpnodameemies s)srrau  nt1aetnmi3tadls2ran snu)treoxo iatfaD ai s s  eum(rpnodlmen ivi () Dtrumo;o4tpenmfctyd m ea(mon(4 rerxoctytfaD  nvi s)tetr(m oy1am   netls  Dtmur no4tex ifciytfa2ra( p;(0arerif oytop  luei;t) rxr(m3iu4omtnliesasfs2rau p;o0openiiciys mDrln ont4arxrif3oadlp r uvs s) 2xo(r iudom emnvsat s2tmxmont0tpto oetytlm2rm( s;u4arxnmr3oo1opte ies;( seuoio3nodolt mfci t  2umu pou1optnifctasfa ea( s;u)aexnmf3tytfp rluvilt  rxo(m3nudopeelict s)sDtrxrono4ale  ieiadfm rl(monu0tetrir ty1opt  ues;t  eurim oydamtnmfvsls) Durump;u1aeeomictlt s em( pnu4aetnir3iodfp rlivols)seumim3iu4opt livsasf 2ta(r ot1openiocild aDrl(vp u0altnmr3oatom rluei () rxm(m nu1olte fci (fartmum ;o4openmieils aDea(vs;t4arenxrciotfpD an s t)t2trimpoydlme mncsat) Duaur ;o4oeto oetys aDemn sn() leoxr todlptrlnvs;t0 2xm(r oy4omenmfeiasf 2rm(mooo0oet if3iasfm2umums ()aetnxr ia1omtelu il(0srtrxo3ny4oltnlivtlsf Dtmuro;t1tpx  fctysfa rau p ()arxnxo3io1opDrlivo;s0t2tm(o3oo1alt lfesls aDum( p;u4tle  ietatfa2ul( o;t0arermf3iydlp  anei s t2xmxrpnu1lpeemfesltfs2ururo;o0texoioeiyt a em( onu)trxrxfcootfpDe nvo s0tetoxo ny4omenlnei s)sDurum ;u0oltnio3iltlmDem(ms (4tlxrif oo1fa  livo;t0tetrimpnydap  livtasf rtaxronu4apen fciyt s2ranvo;t0tlenxf3oadla r ivo (  rxr(mpiu1ape mivsas artmxm nu4aexn o3iltlsDem(vonu4 exnif ty1fmte nvol( srtmxo3ny4ame  fciasfaDua(  no0opx io3tyt m2eauvs u) etnifctatlmte ueils0t2toxmpoodlpt mnesa( srtax  ot4tet if3iyt a em( pnt0treomo iadomtr i i (0seuo(o3iydamteliesltfsDrmx ooo4tleo octlslmDrl(mpnt0teenif oadoptelues;t setrirpnodlmtn ivi sf rta(  oo0opeomo3ils sDrmn pn()tetnmr3oytoa   u sls srtm(m3oudam e fcilt  rtmu pno1tpt  i3ildlsDumnmsnu)alenmrcoy1fate i i ( teurir ou1lmt lnvil( sDtax  oo4alxo o3tysfa2rl(vo;(4arermr3iytfptrlies;s) eum(opnu1lltnlncta() 2urumo;u0optnio3tlt m2rmnvo t4areomf3tadoatrluvi;() eumxmpiy1op nmiet tfaDta(root0aeenii3iysfaDrau s (0artrif tadlp  ln o;t truoio oy4omee nctat) Drruroot1alenmi3iadfa2ul(mpn()teenmf3ty1lmD aivsls) rur(rpoodamen net t s2tmuront4tltnmfetlsfm rm( on(4 lxoxoctatlmDrau slt)srtoxm ny4am   icta(fsruax  ;o1olenif3tys mDrl(von(4aetrmr3to1faD  nes t  2xoxmpoo1am nlfeiatfsrrmxmp;u1oexoifciat s emnmo u4artrmr iotfa eanvs;()trumir nu1alee fci tfs2tm(r ;o4aet iociasfmDua( o;() reoir tytopDrluvi;()setoxo3nu4aptn fviltfaDtmxrp;o1ale  i3iadfm2ulnvo;u0tetomo tadlaDeanvi ( s2tmimpoy1op  mncil()s2tmxmo;o0aptnio3tasfa2umuvo () reomf3ty1latranvo s0 exoxo3no1ol nlfetat a2rr(m ot0teeomieias m uanmo t4 ltrmr oytopDrlnei t s2uo(m iudomt mfvs t) 2umx p;o4tlto ictadfm2uanmo;t0teerif3oytomDrau i s)tetrxrpiy4ome  ivilt)aDtrx  nt1tpxn oetytfm rauvsnt4tetomoctadlaDrlueo;(  2trxrpiodlltn ict t)srtaumo;t0tlenioeiaslsDua( on(4 rtomo ia1fmDrliei;t trtmxo ou1olt lict s)aDtrurpnt1alt mi3tas a ua( o t4artrxfcoytla ranvo;() rtm(o3iodameelieiasf 2uaxrooo4aet io3ild m2ran pn(4alerxr3todfmt  nesls) rto(o iy4ll nmieil(f 2ua( oot4olx  ocils a2rln snu)alxomocoydomDeanvi t)srurir3io1omtelfvtas a2rrumpno0oet mictatlm2ranvp t4 ltoif iytfat ln o;t  euo(r iu1omtnlneiatfsruax p;u0apx ioeiatlm2rmu pnu)tetomr3iotlmDrlu o s0srxr(r3oy4lltn iet s) 2ururp;u0aex ioeils s rm(von()tleomfcoatfmDeauvol(0 euo(mpno1olte net ()aDta(rpnt4oex moetadfm2ra(vp ()alenio3ty1fpDr nes s0 etoxm3oudlpt lfetlsfsDtmxrpot4aex mfetlslm el(vont4teenxr3oadfpte i ils trumxmpiu1lp nmncslsfa2umumoot1alenifetyt mDrmnvpn() etoio3iotlp eanei;t) 2urxmpny4om elfetat srtmxmpoo0alt iieiasls ea(msnu0altrioctatfpDe uvo;s sexmxo nu4ll   ietlsfa2tmxmoot4tlx ii3iad m umnvo u4 rtrircoodlate ueols)seumxm3iu1altnlnvia() Drrur ot1oleomi3iatlaDrm(mo;u0trenio oytopt  n slt0tetm(opoodol elivi s) 2ur( o;o1aetniiciltfmDrl(vo (4aexnxocoa1lmDr u i;s tetm(opoo1olenmnctl( srum(m ou0alen oetldls uau snt)alenmo3ootlpt  n sl()teuoxm oy1openmneils)sDrru onu0texniieiysfs2el(mo;(0artomf3iy1fmD aues ()srxrirpoo4lm n nesa() rtmx pnu4tpt  o3iys aDulnms t0 eeoxfciytlmt  neslt trxrxmpoy4apenlictls) 2uaum nt1texnmi3iad a rmnvp;u0alxnmr3ia1fa r iesls trtoirpou4al nlfvtltfarra(  ot4opxnif3iys a eanms t0tlenxfcoadfpDr uvs s0setrimpoodopee fctas) Duauro;u4oetn oeiatfm eanvs;(4aetoir iotfaD  i i t  rtoxr oo4lmtelieiatf Dtru  no0optnii3ilsfaDrl(mo;t4aeenxrctydlpt au ilt0 etrxmpoudomtn nviat a2umxm oo1olx  i3tld m2rmnmp u4 etoiocio1fa rauvols)sexrxo iu1llenlfvs t sDtru  ;o1tlenioetydfa2el( o ()tetoifctydlptr nvsl(0trtrio oo4olte fvsl(fs2urx  oo0alx io3ild m2em(monu0artoircio1fm  ln o;t0seuoimpoo1optn ietl(fa2trumono1apeoifeiyd mDulnvsnt4 etoirciytfmD livi t0sexmir ou4lm nmnvsl()s2rauro;u4tltn f3ils s rl(vo u4trtnioctatlp eau s;t) rxmxr3no1amt  ieslt s2rm(roou1open ociysfm2emuvp;()alxrir3tytfm  livsls0 2xoxmpiu1ap   ivtl(  2ururp;t1apt  f3iydlm2rmn s u)texnio iy1lmD lnvol(0 eumxm3oo1ol n nvsl(f rum(mpnu1opeo ictadla2ea( sn(4alxoiocoodfm rau ols0 rxrxm oy4lltelnesa()artm(ronu1tltoifctltlm rm(von(0tetrmo3iatlp raneilt sexoirpoy1omte ict ( srur(mo;o0ole moctys s ul(mo u4aexnxf3iatfm eluvs;s0s2umirpou4lp  mieil() Dra(r ;u4aet  ictatfa ra(vpn(0 renxf oa1oatelueols  2umim3nu1lmt livils)srururo;u0tpeoifctadla rmumo;u)trxoxr3oadlm   i o (  exrxr iodaltemncilt  rraurono4oleniociad m ua(vsnu4 rtomocoa1fm   neol(0t2urio no4opte fes tfarrm(rpoo1opx ioctlt sDrm(vpnu0 ltnirciy1lp  livols)tetm(m3ny1lmenlncs s)aDrrumont1tlxomfciad s raumo;t) rerio3totoaD lies;t0trxo(r ny1lltn fvta(fsDrmxrpou4tltnif3ilt s2ea(mo ()alxnxrcoo1lmtran sl( s2xoio3oudale  fet sf 2tru poo4oeeo oeilt m2rmuvo;u) rtnir3iytopDrli s () etrxopiydome lfetls) rtmx oot1tee moctlsla rluvo;(4 lxnmfcoo1lp eanvi ()s2to(o3nodome  icsl( s2tru  oo0ale  fciasfsDuluvo;t4aleoxr3iodlmDr uesl( srxoiopiu1opt mietatfs2rru pou4alxo oeiltlm2ulnmo;t0artnio3ootlatraivs;s)t2tm(m3iudol  mivt ( s2rm( p;o4tlen fctldlmDrmn p u0tleoio3iy1fmDelnei s)setrxmpoy4lptnlfvi s sDtrxmo;u0oee iieiadlmDraums t) lxrxf tydlmteauvo s)s2trxr no1opee ictlsfsDra(rpoo1alt moctlsfs uauvonu)artnxr3tadfmt  ies;s)s2xrxr ou1lm  mfeilt  rtmxmo;u0altn feiat mDuanmp t) rxrifcoytlpt aivslt  ruoxmpio1llee neias) Dua(  no4tlt iicias mDem(vpnu4alxoxo3ta1oaD lneo;s)texrxr3oodapt lnvi t srumx oot4altn ietasfa elu o t) lenxfcoydlmDean ol(0seumxr iu4ap n nvsatfa2uaxm no1opeo ociad a um(mp t4artnirciydlm r neslt sexr(m nu1optelivi s) rumu ono0olx  ietat mDra( onu0 etriocoo1fpD luei s0trum(opou4ome  fet (f rrrxmonu4tptnmictytfm ranvo;u) lerxr3oydlateai s;(0seuo(opnu4lp nlivt ()sDtr(mpot0tptnio3iadlm2ran pn(0trtrmrcoy1omt  n i t s2uo(mpnu4amt mfeias aDua(  ;u1optn fciysls2ean ont4texoxr oa1omDrlneo s teur(o ou4lle  nesas s2rax  ot4tlto feiyslm ulnms;u0 etnxr3oodfaD aies;t0t2toim3no1ll emivs (f rraurp;t1oet  o3ildfm2uluvs u0 etomf iodoaD lneo s)setr(opny1lpee feiatf rurxm no4alxn feiasfaDul(mo;()arenif oadomDe nvi ()seuo(rpnu4lpe mics ( aDuax  ou0texnifeiytlsDrlump u4 rtoxo3oydfmD auvsls  rto(o3nydllenmncs (faDta(rp;u1teto fciltfs rm( o () eeomrcoydlateln o;( srtrxo3oy1om nlfei sf rumxr ot0alen fctysfs2rluvsn() lenir oydfa r ivi;( srtmxo oydol  lneil( a2raum ot1aeenifciysfs eluvon(0 eenioctodlp ean i s sruoimpnu4am  lncsl(f 2taxr ;t1tlt  ieias a2eluvo t4tetrxf oo1fm e ivi t0s2umxmpou4opeelfvtas a2ra(m ;u1olxoifetydlsDrl( snt0areoxrcoa1omt lies s)srxoiopoy1lmt  nvt ( s2taxmoot1apxn oeias sDrm(vp t)trerio3tytlaDeluvo t  rurxo3nu4apte nct ()s2taxmo;t4opeoifciltlm emu p;()aeerxf3ootoaD aueils  2xoir3ou4ll n fetlsfs2trx pnu0alto f3iyt m2ulnms () rxoircoydfp eaueols0t2trxo io4lptnlnetlsfs2ta( ooo1optnioeiytfmDrluvpnt0tetoir3ty1fa rlu i;( sruoxo io1ome  fciasf Dumuro;o0texo feiyslm2rau p;u4 rermrciadfp e nes;s teurxr no1al nlnei sfsDumxmonu1ole  f3iytfa ul(mp;t0 rxomr oatfpDe ivs;(0srtmxo ny4omee ncia(farur(  ou0teeomieiat s2uan s t4 rtnxr3ootfaDelueilt)trtoio iy1ome miviat)aDrm(m nt0alxnmo3iatls rauvp (0 eenxocootfaDrluvil(0 exoxo oudoptnmfci t) rtmxr ;o1tpx mo3iytla el(vp;(0aexrif3iy1oatr ueilt) rxmxopiodom elnvtl()a2umump;o1optnii3iytls2umn sn(4artoxf iadopt  uvsls)tetmir ny4aptemfcias  2rmur ;t4aptnii3tld s2ul(ms (0 lenmf io1op  li s s)tetr(rpiy4lmenlnetls sDumumpnu0alxoiiciytls2rln s;u)aetrxf3iytoptr n ol(  ruoxopio1am e ncilt)s2tru  ot0tetoiiciltla2rlumsnt4tlxnmo ia1fp  li i;s)t2xoxm io4ameelnes t  2ta(mooo1aleo feilsfm2elu p;t0areoxf3ia1om eln o (  rumxo ou4op   nvi t)s2tmu o;o0tltnmfciyt s ulnmpnu4tetomrcta1lpDr uesl() 2to(r3iy1llenlfcslt artrur ;o0olx  i3tlt s2umnms t4teermo oytoat aneo t)texoxr oy4lp emivta(fsDtrumpot0opx ifeiytlsDrl(vp t4 ltnxo3tydfmteaivo ()seto(rpio4lm n fvtat) Dumxrono4tpe  ieiltlmDuanvo (0alxomf ty1fat lies;t)tetoim3iydopen fcta( sDrrum ;t0tlt mociatlm2umn pn(4tlenxf oytfptelivo;(0srxmio iu4lp  lfvta(farrau o;t1olxnifctadls eauvo;t0alxomf totlmDran o t s2umxm oodoltnmfvsa( sDrrur nu1aeeomoctys s elu s;t0areoxrctodlpt  i s s s2trxr nu1amenmfciat)sDrrx p;o0tetomiciadlsDumnvp;u0 rtnmrctodla rauvi s s2uoio3nu1op emiet (faruaxr oo0olxn ictat a2um(mo;() lxrmo3oytopt ai s t) rurio3iodomte nciltfartrxr nu0apenmoeild sDrlu p t4alxrircoadoaDr neslt)sruoxrpoo1llee fvi ()a2tmuroot1oee mi3tlsfsDrauvo;t) eerif ty1op   i o (  rurxo oo1al   ncs t arum(ro;u0ole iieiatfm emnmsn() lxnir3iadoatelu o;t) 2ur(o oy1oltnliesas  2ur(mo;o1alx  f3iltfs emums;u)altnmr3iadop rauvo;(  2xmiopnydlmtemieiat aDrm(ro;o4aptn ieiltfa2uanms u4aeeomr3oadomtraueo;t  etm(m ny4altnmfctat)aDta(rpno4tetniietaslaDrm(vs;u0arxrio3ootlptranvolt  rtoxm3ny1al  lncil(f rumxr no0aetomieiydlm2em( p u4altrio3oydfa e u o ()s2xmxo3iy4lltnlietasfaDtmuronu4alt  octadfm umnmsn(0aetrxocoadla  anvi s  rxm(mpiu1optelicia(f 2ta( pno1tltoioeias aDul(vonu)tlxnmfctadomtrlnvil(0t2trim3no1lmeelnci ( aDua(mont1olenioeiydlm2emnmon(4trtnmr3oy1omtr nvo s0t2xoxopoy1lpe  nvsas)srraumont0tle  o3iatfm uan pnu4alenif oa1oa  anei (0t2to(o3ou1alte fctlt sDtaxrpou1tetomo3iltfaDel(mp;u0 exnxrcio1omDelies;t)truoio3oudolt  fvt () rrm( pot0alto o3tasfm2ra( p u) eenif to1fatrluvi s) 2xoxrpio1op e fvi sfsDrau ooo1oee  oeiysla2umums () rtrxo oadfaDrai s (  2urxopnudlmt mfvt sfarraumo;t4oet mieilslm ran s;t)arerir io1la eluvo (  2toio iydam nmneta(f rtmur no0aleomfeiyt a em(mo;u0aetrio oatop rai slt) 2trim3nudam nlnetat s2tr(mono1altn i3iaslm ra( s;u0 rermr3oydfmteli s;()trxrxrpio4lm nlict t)aDuax pnt0aexomi3iyd s2eln p u0 renmr3tytoa rlivslt0sruoim3oudale lfcsa( s2urxrpou4aeen f3iysls eauvsnt)tlenio3tatlaDran s t)s2xmxm oy4omte iviatf 2ur(m nu1teeomicilsfm2uauvsn()trtrmrciadoaDeluvo t) 2xm(o3oy4lmtnmietls  Dta(  oo4tetnmf3ildfaDrmnvp t) etrxf ia1fpD ln ols)trtmxmpoodomtn fvtas  Drruroot4tee mietys m uanvo;(0 rxrxo3iodla  aiei;(0s2tr(mpiydameelncsl()srra(rpoo0opxoii3tydlsDem(mp;u) exomr3iotopDr n s s s2xoio iy4ap  miei t) Drr( o;t0aptn fctas m umnmon() reomrctodfaDrlneilt0truoxmpoo1alee nes tfs2trx  nu1ole mietatlaDumu s (0artoxr iy1laDraivo s0texm(mpnu4opeemicsl(faDrm(rpou0apxnmfetlsls2emumonu) rxrxrcoo1oaDr nvs s  ruo(o3iydlm  miei sfsDuaurpnu1opto fctldfs elu p;u4trxnmf3ootlptelivi;() rtm(r oydap e fes tfs2ra( p;o4texnii3iytlaDulu pnt)alxnmo to1opDelnvil( t2trirpoy1ll   feias) ruru  oo1tltnmf3iat s ranmp ()trermoctotop   uvils)teuoxrpiy4lmeemnvtltf 2taxrpou1ale mietld sDea( s t0teerir3io1fptelueilt teur(o3ny4lleelfcsls)a2rmur ;u4tpeomictys s el( p t4tltnirciadopD aiei;s0 2xmxopny1alen ncs s  Drm(r ;o4opeomietydlm eanmo ()alenir3ta1fpDe ivo ( s2uoim ou1ole lncilt  2umumpot4olt  oetytls2rlu o t4trxoirciadfaD au olt0t2tr(r ny1ole mfes tf Drr(m ;o0oleoioeilsfmDua( o t4 exnmocia1fmteaueil(0 2umirpnydlmt lfei t) rumu oot1opxomicildlaDemnvs (4 lenmf oydopDr iei;s  rxo(r3iu1op emnvsl( artau  no4aet  ocilslm rauvs u0 lxrmfctytla   neo s0 2uoim iy1ape mnesat s2uru p;o4apxn i3iydfm2ea( o;(0trxrif3iotfatr ivol( seurxm3oo4lm emfvs s a2ta( ono0tle  oeiydfm rmuvon(0tltnircto1lp r i ilt  2xrxmpiu1lmtn ncs ()srraxm nu0oet io3tltlaDrl(mo;u0 eeomrcto1fmtr uesls srto(rpny4ole micils arua(rpnt0aet iietltls rmnmont) etrmo3oytoaD  ueo;s)srtmxo nu4apee iesa(farururo;o1tlx mo3iatfm2rmu o u4arxnxf oy1lat lnvi;t0trxo(m oo4ap  lfct (fsrrm(rp;t0apt mf3iaslm eluvs;u)arxomrcta1la elneilt t2uo(o3oudap n iesls artau  ot4aeeomietasfs2emnmp;(0 ltrxf oodfatr ivslt srxm(mpno4lpt lfeiatfs2rrxmpou1oex io3tasfm rm(vp u0 lxrio3iotlaDe uvi;(0 rtr(m oydalte fesa( sDua(m oo0apxoiociaslm um(mont)tltoif3oo1fptr i o t0 rtmxr3nydll   ictlt  Dra(m ou4oetn feiyd m umu p u4 rtrir3tadfaDrlivs;s sexo(mpou4ol elivtl(  Dua(root0tetoiictas a2rmnmsnu)aleoxo tydfptrai ilt truoxm3io1lptnmfvsat srurxmpno1oetn oetat aDrmn p u0treoxr3oodlpD  nvo ( srur(r3oudapt  nctatfartaxrp;t4tlt io3iasfsDemuvp;()artnxocoy1fpDeau sls) etmiopio4olt mfci (fa2um(  ;o4tptniieiys sDuln pn()aeerxr3ty1opDeaivi;(0texrir oodapeelfesl(  Dum(mont1alt io3ilsfs uluvsnt4artnirctatlatrau s;s  2xrxm oy4op  mfvias  2tr(rp;t4apeo ictyt s el( pnt4altnifcoytfateai o t0sexmxm3ou1omte ici tf ruaxm ;t4ope ifeiys m2rauvpn(4tltrmocty1fmDeai ilt0sruoiopnu1alenliet tf rtm(mo;u0opt ii3ildfa ua( o;(0arxrifctytfmDeaieilt)trumxopoo1ale lnctltfarurx onu4altnioctasfmDuauvs u4texrxf oatfm rlu s;s) 2uoim3iy4alte ieia(  rrrur ;t0apeomi3iltla2eluvp u4treoif3totlat anvi;t) rxr(m3ou4om n feslt)srtru  no4aleomf3ildfs rln p (0altnmrcoydoa eauei;s) exm(m nu4llenlicilt  Drax  no4opt io3iasfs2ra(vo;t) eermr tydlatelieslt trtrxo3oydamenmiviatf rrau  ;o4tle mociaslm2rm(mp;(0 rtoxo3iy1fatrli s;(0sexrir3oy4lmtelncsa()s2uru ono1oetnioeiytfaDuan ont)tlxoir todlatelivs;s)setm(r3iu1ll emietls  2tm(ro;o4teeoio3ild m umuvo u4 eerio iy1oaDr ivs t  etoxr3oydlmtemnci (fa2tax  nu1alx mieild a emn ont0 rtoif oydlmD aneils teuoxm3oy1omeelneta(  Duax oot4olt ifeiltlsDrlu p t0 etoif iy1opDran sls0s2tr(o nydapt  fvia(  2rr(ronu0tee  f3iaslm ea(vp;(0 lxrmf tydfmtranvols)srurim oo1ll nlieslt srtaump;t1oeeomfeiaslmDrl(msnt0 lxomf3tadlat auei ()srxmxrpnodale  fes ( a2urur ot0ape  icildls2uaums t)tetnmfcoy1optr uvi (0sexo(opny1al emfci s  Drrx oot4apxnio3tatls2umu snt0artrxo tadfa eaies;s0t2toim3iy1lmtnlnct (f rrr(r ou4tpxnmfciasfs uln on(4 leoxo iodlm ranei s0srxoiopny1alt  feia(fsDrmx  oo0oltnmoctldfm2raumo t4aeermoctydfa elu i;t) eumio oydoptnmneilt s2rax  oo1opeo o3tytlsDemn o u4 rerxr oo1fpD  uvs s)trtoir oydolte fcils  2ur( o;o0alen i3iltfsDeanms;u) eeoif tadfpteaivo;s)setoio3ou4ol  lics (  rrmumpou1oleoii3tyslm eanvsnt0arxnir to1opD  nes;(0s2toxm iu1ale  nci ()srrr(r ;u0olxn ociad mDul(vp u) etnmr3tydop rlivolt0 2uo(m3iy4lmen fcsat  Drr(r nu0tpeomoctytfm2ranvont4tlxrif3tydlpteaneslt)srtrio iodlptn ivs sfsrtrx oou1aeeomociyd s2eln pnt4trtrxf3iodomDrln o;s) eum(mpoo4om  lici t  2ua(r nu4tpenmieilsfm2uanmp u)artnxfciydlp raues;s  etrimpoodap nlivt tfs2ra(mpnu0opx  i3iat m ea( s () ltrio iy1lpt  uvsls0seuoim iu1openmfcta( arraxm ;u0altnmf3iyt s ean s;t0 reoxo iodopDrlivi;t0s2xriopoo4apeelfvs (  rtrumpnt1tetniiciaslm2rm(mo t)aetnmr tadlm   ivilt t2tr(m oy1amt livi tf rtr(rpoo4texniieiyslaDul(mp ()artnxo3oodlmD aivi ( texrio3nudlmtemnvsas) 2tr(  nt1olen i3tat s umnvo;t) eerircoo1oaD ln o ( s2umxm3oydomen icil()arrmu  ot0aetoifctyt s2rauvo;(0altomo3io1fm e nvols) ruoxr no4lp n ictat)arrrurpoo4ope mieiasfs2el(vp;t4 lxrmrcoytfa rluvilt0s2xoir oo1optelnvt ( arrrur no0apen feiltlsDumnvpn(0 rtrmo iatomt lnvo;(0srtmio3iydlmt  ict ()s2rau o;o4oltnmieiydls2emn ont0texnir tydfatr n o s)t2um(rpoo1oltnlietatfsrur( p;u4ole ifciytls2eau pnu0altoxr3ty1fmtrlivo;t) rum(rpno4omtemfetls  rrr(mpou0aleomfeiatfs2el(vs t)aeeoircoo1omteauvi t)t2xoiopiudal   fei t s2umuroou4aetniieildls2umu onu0tltomr iytoatranvo t seuo(mpiudal nmneils sDrrur ou1oexn ictydlm uanms;(0treoifciodlptraieolt0srtm(m oodlpee fcsl() Drmxr nu0oeenio3iytfs em(mo u4 exoxf totlmDeanvs s)t2trimpoy4lmtelicil( s2tmx  ot1tltnioetydfs umnmo;(4artnxo3iytoaDrau o;s0 2tm(o3oodoltnmnciat)s2ra(r ot4ope moeiytfm2em( pn(4arenmf tatoa r uvi t t2uoxm iu1optelfci (fsrtrxr ;t4tpt mociydfm2rauvo;t4 lxrmr tatfp eanvs (  exr(opio4apt lnesat)srururooo1olenmi3iysfs2umn pn(0alxrmociodom r ivols0 euo(m3no4aptelnctas) Drm( o;u0oexn oeiasfaDrmumpn() reoifcoydom eau i ( s2xmxo nu1olt mncslt arrrxmp;u4texn o3iysfa ulnvs u4 eermr oydfpDraivi;( s2xrxrpoudoleelfcs () 2raxmpno4tptniictad mDelumo;(4arxnio iytlpDeaieolt0 2uoiopny4lmt mneiat) 2tm(  ;u4aeenmfeilsfs2rluvs t4artrir iotoate iei t0s2tmir oo4opte iviltfs2rr(rpoo4aetn fcias mDul(msnt) eerxoctatomte ies;s) 2toir ny4om elivsa(  rtaumpno1tpt  feiatls emnmsnt) ltrif tatla r nvo;t teur(rpou4lpe  fctl(fsruax o;o4texo oeiyslsDran pnu)trxnifciy1laDe nvi;()setmir oo1ll elnvsat) 2ur(ronu4oet iocilsls2ra( sn(0 leoxo3oy1oa elnei (0 ruo(o io1aleemfeia()aDur( poo4tle if3ilt a2uanmo;u) leomo3oo1fm  ln o t0 exmxm3iy1lp nmict (f 2ra(mo;o0tpen ieiltlsDua(mp;()aetrif totom eliei t0s2tmxo iu1lmt micil() 2rmurooo0ale if3ias m2ulnvo;u4artoir3iydlmD luesl(0 2xriopiy4lm e ieias)s2rmxmont1aleomi3tasfa2ulnmp;t4tlermf3tadlm  lnvs t)trxrimpnodame mncias  Dumumpou1oltn fetasls2elu ont) leomr oa1faDrai o;s) rxo(r ny1alenmfcslt srrrxrpno1optn o3iad a2eanms;u4 eenmo3tytlm rauvolt) etrxopnu1llt mivt ( a2rruro;t4opto fctydfmDea(ms;u4 etrio3todfptrlnes;() eurim3iu1aptemfvt t s2rm( oou4oexnioeildfs2uau o;(4texomf ty1lm eaivi t)setoxm3nu1lmeemivilt a2taxmo;u4aexnif3iaslm em( o u4 leomf3tadlmDr n o t  rxoir3iy1om e fci t)sDuax  nt1tpeomo3ilslaDelnvp t)tltnifciytla   u o;t srtmxm ny1al e ics t)aDta( ont1tltoifeiadlsDrm( p;t)texnif oa1opDelu s ()texrxo3nydomt micsl(  2tru  ;o1oeeomf3ild sDranvpnt0areriocootlmDrlu il(0truoxm iy1amtemnctatfa2rmx pno1opxoif3ildls em( o;t)alxrxr ta1fmtelu i s0trurim3nydol e iet t)a2uax o;u4alx mi3iltfaDrlums;()alxrirctotoptr uesl()srtoim iydapeemnvil(fartax o;t0altoiiciytfm2elu o;u)trtrmrctatlaD  i s t  exmxo ny1ol   nesls) Dtaur no0aex mfcilt m2rlumo t4altnir3iotoa eln slt trxrxr3oy4alen fei s) Drmxm ou4ale mfctatlm rmuvo;t) rxomr3ootlaDrlu ilt) eum(rpnu1olenmicslsfartm( onu4olto ietadfs2uauvont4aexoio tadomDeanes t)trum(rpiodolenmnvsas) rurx oou0apxo o3iadfa uanmpnt0 lxoxf3ta1faDr n s t)trtoio3iy4ome  fes t) 2urumo;t4texn o3ildlm2ea(msn()tlenmociatfmDe nvs s s2xmim oo1oltemict tfs2rrx ono0tlxniicilsfa ea( pn(0 eeomo3oatlatraneol(0 rtoir iodlptnlfvs t  Dtm(m no1tet mf3tyt sDul(vp t4tltrmf ta1oate neo;s  exmxr3oo1lltnmict () rtrur ot1tex ifeilsfa ra(mo ()altrio todlm  lnvi s0 rxoxmpoudopenmfvi (f 2tmx oot0aeeo o3tas m elnvpn(0 eeoxo3iatomt  u s ()seur(m oo1om  lfei tfs2rrum ou1opeo oetat s eaums (4aexrxf iadfpDean s;t0 rtmiopio4llee iet () rua(r ;u0apxnii3tyd sDrl( s;t0artoio ta1lmt liei t0t2xrio3nu4ameelfctl() rrrxro;o0opxo f3ildfs2eln o u)aeenif tytopDeaivs;s0 2uoxr3nu1aptelieiltfartr(  ot1apxnmfctyslm2rm(vsn(0tleniocoodomtraivils) exoim nydlp  lnetl()aruaxm nt4opxnii3ilsfmDumu p t4 rtomfciadomtelnvil( s2uriopou4om nlnviat)a2umx pou1aetnio3iydfs2rauvpn()trenmr3oadfm ean sl(0 exmxr3iy1omt  ies t  rtr(r ;t0oleo i3ilsfs2eln o t4aetrir to1lp  au i ( texmxr3no1lme  feilsfa2rau o;t1alxomoeilsla2emn o (0 rermrctotopt luvo t0trxrxrpiu1lm  livsat) rrr( p;t1tet ifeils a2ulu snt0alerio tytom  anvs s trtrxmpoo4lp nlies s)aDum(rp;u0texomieiltlm em(mo;u4 reomf oadoa e n i;t)trtr(o oydaltn fvt sf ruau pot1optomf3ilt s umuvp;(0teeomr3tytlaD  ivi;t0trxoxm nu1amte ietlt) Dumu oou0opto oetltfsDua(vsnt0arxnmoctodfmtr n s s0 rtrxm3oy4lpeemneta()sDtr(mo;t1aeen ociys s2ul(von(4 lxnxociytfm r u ilt)s2uoxm oy1opeemfvtat  rrmurpno4olx mfeiatfm2ulnmo;t4 rtrifcoatfpt aivil(0texo(mpiodome mncsl( sDrmum ou1tpx  f3tysfm ra(mpn(0 lxrmo tytla  lnvi s  2xm(rpio1om nlnvi t) 2urx oot1tee  f3ilsla2uanmo (0arermr3to1lp ranei t0srurir ou4lm emies t srrm(  ou1aetnifeild m2el(mont0aexrio ia1fpteanvo;s sexoirpio4ole mfesls)arum(m ;o1alt  feildla emn ont)artoxo oy1oa  an ils sexr(m ny4altnlneils srrr(rpoo1oet  feildfs2rm(mont4tleoir oo1lp eli o s trtmxrpnudalenmfvi ()s2ra(rpoo0aee ioeiatlaDemumpnt0aetrxrcoy1fat au i;s  rtm(mpiudopen iet (fsrumx o;u4tltnmo3iasfmDuln o (0aetrio iotoatelueo t  ruoio3nu1llen fctl() rraumpnu0aetnmiciysfa rmumo;u0teerir3tytomt li s;s  2toir3iodlmeelies tfsrumuroou1olenmfeiyd m2emnvo u) etnif3iadfmDeli ilt0trxmir oo4llte ncsat)srurxm no1tpxoiieiyd sDean p (4 etrif iatopDeauvi;s0trumiopou4alte nct (fsDtrum nt1aetnmo3iatlaDrauvp;t4artoxo3iy1fmDe ivs t)trumxmpnudllte fcsas s2tr( oou1tetnif3iyt mDemnmsnu0trtrirciadop e uvsl( sexr(o3iu4lme  icsatfaDtmxmooo1tex iociat m ea( s;t)aleomr iadoaDraivs ( t2xmxmpoudameelncils a2rau pnu0oetoioctatfsDem(ms t4altoxfcio1fpDeaues;( seuoxo io1ame  ivs (f rraxronu1tlen oetadlaDrluvpnt) exnxocta1fmtr nvs s sexmio nodlltnlnetas srraur nu4aee moctadlm2uau o;(4aeeomr iytop elu i (  etr(mpnodlp e nvsa( sDuru p;o4tet mf3tydlm2um( ont4areoxr oatfp  lies;() exo(m3oy4lpen ncsls) rtrxm ;o1oeen fcilsfaDrlnvp (0tleoio iodopDeau o;()tetmxrpnu1ap  mfvs t)artaxrp;u0tpx moctld sDeln onu4texrxf oodfat lnei s) rurxo iy1amtn ivi (f rtm( p;o4aex  oeiytfa2ulnmp u4aeeoif tydfm  auvil(  rtrxo oudome  ivils) rra(m ot0teeoiietldlm2em(ms;t4trtoio iotopt li i;( trxrxo ny1olt lnes () 2tr(mpou1oexomi3iadfm2elnmp;u4 ltrmo iatomDeanvi;(0 exoir ny1ol n net tfsDtaumo;o0aee mociatfm2rl(von() ltrmrctydoatr n olt0setoirpou4al n netltfs2rrx ooo0texoioeildlm em(mo u0tetnxrctydopte uei (  eurir3io4om  lnvsl( arraxr nu1tetnmoeildfs ua(ms u)tlxrirciadfp r n o;t)s2tr(opnu4optn feslsfarta( oou4alto fciyt mDelums u)tlerxf3oodfm   nvs;t seto(o io4ale  nvsl()srumx  ot0oeeoii3iydfm ulu s;t4aexoxocta1fmDrai olt trxo(mpnu4lp n fci tfsDum(  nu1aexoiocildfa uanvp;(0aleoxfciodomD ai i t s2trio oy4altnmici ()srrmu  ;t1apeoio3ias s2em(vp ()alenio3ty1fatr uvol(0srxo(m iudope mfesas) 2rmxr nt0oeeniiciytfmDulnmont0 lxomr3totfm rln i;t srtm(rpoo1ol  lies s) 2rmuro;o4olenmf3tldlsDua( snu) ltnif3iodlmDean i;( trurxrpoy1lptemfctl( arrrxro;u0olen f3tltfs2ulump u0altoxr oydoaDelu o t0s2uoim oo1lm nmnvi t)a2ra(mont1oetn i3iys sDulu p;t0teerircoatoa eanvil() 2xo(m io1am  mfctlt) 2uaxr oo4alt  o3tys m rl(mo ()trxrxf oodfm ean ols0t2tm(o3nodlp e ici t aruaumont1opx mfeiltls elu s u)areomr iydfateai i (0s2tmxm3no4omtn iesls a2uaxr ou4ole iicilsfa ranvs u4trtnxo3tytoaDelivi;s0s2triopno1optn fctl( s2truro;t1apxoiietatls ra(von(4 leomfctotfpt lueolt) 2ur(rpny4llt lnvt t artaurp;t1aexnifetadlsDrlnvpnt0tlxnxrcoadop r nei t0s2uo(opiy4openlfvsa()aDrrum ;o4texnmfctlt s2rau sn()altoxr3ty1lp r n ols)t2urxopny4omt lncia(  2ur(  ou0aet miciaslm elnvp;() lerifctodlmDr ivi;s  ruoxr nydlm elivi tf Dta(rpou1aeeo f3iadfa2rlnvo u4tlenxr3ia1lp   ueo;t0truriopiy4alt  iciat aDurx o;o1oleomieild aDelumpn() etrxocoadla e ieilt setrxrpiy4olenliei t artaxm oo0tpt if3iasfm2ulnvpn()tlxrif ta1op rlnvo t  ruoir ou4llen fcsa() Drmu pnt0aptn i3ilsla ran p;u) lxrir iadlmD anei () 2toxrpou4ap n fei t) Dtr(rpno1oetomo3tysfm2rlu p u0aeeoxrctodoptr i i;( s2um(mpiu1alenmict ( sDrmxmpnt4altnif3iasfm rlu p u0aetoxo todfp   ieol(0trxmxr nu4omenmfvs t srtru  no1olx  oeils m uanvo;u0alenif oatfm ranvs ()s2xrir ou4ol emfvsl(  2umxrp;o1texnii3tad aDrmump;u4tlerir3todopD lnvslt sexoimpny4altn fctas  Durxm ot1oeen f3iatfa em(vs (0teeomo3oo1oaD au il()teumimpiodap nmfctasfsDur(ronu0tlt  oeildlm ul( o (4trxoir3todfmD  ies;t trur(o nu1opee iesas arrm(r ;t4oee ii3ild mDelnmp t) rtoxr3oy1optrlu sl() rurio iy4lpt  fctlt sruru o;o4tlx mfeiytfaDeluvpnt4 rtrmfctadoateln ols)tetrio nydom   iciasfs2rr(r ;t1aptomo3iydfa2ra(mo (4 leomo oatlm  aivilt0t2tm(o3io1lltnmict sfsrta(rp;t0tpx  fciytlm2eln o u4 ltrir3oadopt  ueo (0 rxmxr3nu1al  liesl(f 2urumoou1apeo octysfa ua(vo t4trtrxf3ta1fptrli i;s) 2toim3oo4lpeemics ( srta(mpno4tptomo3iytfm rm(msnu0 ltnxf3oa1om ean o;t)srxr(mpiy1altemnvtl()srur(mpot1tpxnmoeiysfs2uan sn(0 renxr3tydopD  ivolt trtr(o3io4lptn ietl()srtau ono1optomf3tas s2ua( s;u) lermfctydopDeln o (0teumxo3nodal elfvias sDra(mpnu4tee mf3tldls rmums;t)arxrxfcty1fm   ivo s0srxr(m3oo1amee nes t  rtrx  ou4tltn ieiaslm rl(vo (0aleoir iytoate nvs t)srtmim ou1lle  nvtl( srtmxmp;u0tpe miciasla el( p t0arxnmrcoo1fpteauvs;s)tetr(opoy4op nmieias)a2taxr no4tlen fctas a um(msnu4aexomo3ootfaD an olt0 rxo(o ou4openmnetlsfsruaur nu4oeeoifciasla ean sn(0tltrmociy1fmt  i slt  rtrxr3no1oltemfesls) rta( ono4alxn octydlaDuanvp ()artoif iydlpD  ies s t2tmir3iy4olte fetltfs2tmxrooo4oee ifeiad a2ranvpnu)texnxo oytla elueo (  2tm(m nu4lme lncsa( artrumpoo1aee  f3ilslaDrm(vp t0artrmf iytfa  luvi (0 2trio3iudop  mfvsltf Dtr(mpnu4altoiiciyd aDrmu o;t0 exnif to1omt aieolt  rxm(r oo4lmtelivsls aDtaxmp;t0oltnifeiyd s2rln o;u) rermrcoadlpD aneolt texrxo io1ap e nvtltfaDtmxrp;o4oetnmocilsla ul(vsnt)tetnir3iatopteauvi s0 ruoxmpio1ll   fvtat)srtau p;u1tltn ieilt m2eau s;t4 rerif oydomte uei t0 rumiopno1olt mfvtlsf 2uru  oo4aleoifciys aDulnmon(0aexrmocoodomD lieo;( s2xmim iudllt micslt)artaxm ;t1altoiietyd a2emnmpn()tltrmr oo1faDeluvslt) exrxo oudolee ieiltfsrtr(r ;t4aee ii3tlsls elnms;u)altrirciy1la  an s t0trtm(r3no1altnmivsasfs2ur( o;u0apxoioeiytfs uaumonu0texrxo ia1omteli i;s)srtrxr3oydap  mietat)a2tmxmp;t4opx  feias mDrlums;(0alxoxf ia1faDr i i;t0s2xmim3iy1lptnlncsl(fsrrru  oo0olenmfciat sDeln p u)arxoxo oy1oa eau ilt  rtmir oydaptemfviltfs2umx ono0apxnifctlt aDel( p t0treoxo3totomD lies;s) etmxmpoo4optn ictat) Drmurono0oeen fctlt a2uluvo u) eenmf3oy1lptr ueol(  exoim3oo4lp nmncta( aDtax pnt0oetnmictyd s rl( snu4aeenio3io1la rai o;() eumxmpnydap  lncil( aDtm(mo;u1tpen oetyslaDrauvp;u4 lxnio ia1fp rlneo s0 etmxm3nydal e ivs tfartm(mpno1oleo i3ilsfs2uln o u)trtrxfcoatopteli o ( texoim3iydam n fcs (faDua( pou0aetnifeiltla eau p;t0aleoio oy1fpt livi t0s2xoiopno1lmeemivtas a2tax p;o0aleomfeiatfm ua(vp (4trxoif oy1fpt auvils0s2tm(opny4ale  fcs s) rur( ooo4tptnifeils mDuln s;()aeeomr oytlp r i s (0 etr(rpoy4oltn ivtlt a2tr( o;o0tetoio3ild sDemuvo ()trtoxrcoytlp   ueols0t2xr(m3ou1lpen fcsas  Dum(moou1ale iieiytla2ranvon() lxoxfcoy1om r ieol() 2urxr3oydam  livtas)srrrumo;o4ole mfeiys s umums;u4 etnio oo1fmtr ies ( t2tr(rpiydapeemietl(  Dtm(ronu0oee mo3iys sDrmuvon()tltnio3iydfmD  neo;s)s2tr(m nydol  licils)arraxmono4tptoif3iadfsDua(mp;u)trtoio tatlmD li s;() rtm(rpiydole  ivia()aDtmumpno1altniieiyt m umnvs (4trtrxo tytomteaivs (  rxoxrpiodlmte ncils)a2rr(ront1tlx ifeiysls2rmn p u) rtomr iydomDeanvi () 2to(rpnu4lpt lneilt) rrm(mpnu1opto ieiytfsDra(von(4teerxf iadlpt anvs;()tetrir ny4ale mnvtat) 2raumo;u4tptnifciys sDumnms;t4treoxr3tytlmt  u o s srtrxr3iu1amee ivt t a2ur( pot4oetomo3tasfmDrm(msnt)tltnxr3oodoaDe ues s teum(m3iudlpen nesa(  rrm(ronu0aexnmo3ildfm rmump u4trtomfcoy1fa e nvi;()s2xmim3no4op n ivils  rumxr ou1aexn f3ild mDrm(msnu0artnxf3iadfpteauvs t0 2xm(o3io1lltn nvia( aDrrx  ;o4oetoioeiyslaDua(msn(0aeeomr tatfpt ln i;()sruoim3oudlmtemici sfa2rmxmpot4tleoii3ilsla rmuvs;t4areoirctadopD aueolt)trxm(rpny4lltelfcia(fa2uax  ou1ope mfctldls2ulu o;(0tetrir oadlptrlieo;t  euriopnudomenmictat  2tmx  ;o4tleomoeiatfs elnmon(0tltnioctotoatelies (0seuoxrpny4oltnmfeta()s2umxm ;u0tlxn o3iys a eln pnt0 etomf iytfate n s;()trxo(r iu1lptelfei s)srum(  oo4tpe ifcils mDeau o;t)tlenxf ia1op ranvs t seuoim oudape lnvils  rum(  nu4aleoiieiysla um(vsnt4aeeomr iodla e nvi;t srtmxm ny1om elicta(fa2um(mo;o4olx moetldfs2emumo;(4texnirctydoptr uvs;(0 2urxopio4lle lfvta( s2rr(m oo4aexomf3ild m2ran snu0alxnmrcoodlat  i olt0teuoxr iy4llenmncsatfsDrrxm ;o4apenmfciad m2rau ont0teenirciydlm   neols)s2uoxo nu4lm   nci tf Dtrur ;u0oex  i3iadlm emu pn(0trtnmf iatlmte nvo;s teum(rpiy4lme lieilsf Drm( pou0optomfeiltlmDeaump t4 rtomr iytfaDe iei;s sexmxmpoy1lp n nvs t  rrm( ont1oetoiociatfa2em( o;u4arxrxr oa1oa rlnei;t0sexoxo io1omtnlfci tf rtaxm nu1olxomi3ilsfa eauvo t)trtoir3oa1lmD  nvi;( srxr(o3iudalee fvt s  rrrurpou4altnmictysfa2umnmpnt0alerif oatlp rlnvi t0teurio3nodlmt mnvia()aDra(rpou4aeeomoeiyt s2eaump;()aetrifcoodfat  ueil(  exrxmpou1ap  lfvt tfaDtrx ont1texn ictad a rm(vp (4 lenio3ta1fp eluvi s)s2urxo oydlmt mfvils)a2umumpnt1aleomoctls m2rlu p t4 reriociadfpDe ueol(0 2xoxo nudopt lfei ()aDuaxmo;t0oeto f3tyd s2ul(mo;u)aetrmrcta1lmDranvs t0 rxrxr iu1ope mivtat)arra(mpnt1oexoio3iyslm2ran o u4arxnio ootom e neol(  eurxrpnudlmte ictl(  2umurpnu0apxniiciytls eauvo t4 eenio3iadfat  uvs (0t2toiopiudop e fvil(faDrr(ro;u1tpx ioctltlm eaump u4 renif3tatlptrluei;( seuoxmpnydam emictlt sDur(r ;o0apeoio3iydls ulump (4tltoif3to1lat livols)texrxopiy1ope  netls srrru  ot4tpxoio3iadfaDua(mo;t0 etoxr iotfa r neolt)t2umxrpio1lptn fcia(fs2tr(rp;o1tlt mociytfaDemumo;u4tltnmf oy1oa  luei t sruo(o iodopeemfvias  rraum ot1opt  f3iasfs2eau o t0altomrcoadfpD lueols s2tmimpoydamtn fvsl()aDurxmpno1teeomfeiyt a emuvsnt4alxomf totlm rln o t srumimpoydol nmnesl()aDtm(moou1tpe io3iadla2raumo;t0texrxociotla   u s;s0teur(m3oydamenmivt sfsruaurpnu1oetoifctlslmDeaumo t0teermo3to1oa eliei ()seumim3ny4lltn fctasfa2rr( ont0apx mi3iltfs ulnvs t)artrif tatoa   nei t seur(opoo4amenmfvtas srur(rpoo0apenif3iydfa ulu s (4aeenio io1fp  li s;s) rtmxrpio1alen iei () rrmum ;o4tetoiictydfaDemu s;t) rtomf3iytfaDe ivo () ruoio3iy4lleemivtl( arururpou0tex  ocilslm elnvs (0 exrxf3tytomtr ies;t) rurirpiu1lmee ivs t)a2tr(rpnt1apenif3tltla2emn o t0 rermf iytlmteauei;(0s2tm(r oydam nlneia() rtrur ;u0oltn feiasfs um( ont) rermocta1fpD li o t)t2tr(r oo1lpte fcslt)srra(mp;u0tpeomf3iat m rlnvp;(4 rermf3tadopDran o;(  2trxr3nydaptn nvsas srur( ooo4oeeo i3tadfm emn o (0 rxnxf3ootlm elies;(0tetoxm3ny1omte fvil(  2ur( oou1tetnmoctatlm2umn pn() rxrirciy1fpDrlivo;s s2uo(o3oy4apenlfeta()arrau  oo4aeto ictldfm ul(msn(4altriocoatla e i i s) etr(mpnudlmtnmfvil(f 2uauront0tlxomo3ildfaDelnmo u) eerxo3to1oaDrluesl(  2umxm3nu1omee ivsls sDta( ono0tpeo octls m eln snu) leomociadfat auvils texmxr iy1aptnmnvtlt) Drr(r ;o0alxomo3tltfs2uanvo;() eerxo3oadoat  u il(0trtoxo iy4opte ietls s2tmurooo0apeomoctytfs2uaums;t0teeoio to1oatr ieols0s2xmio3ny1altelics (fa2tmuroou4alx  fetas m2uau s u4trtoir3totfaDeai ols0trxoirpoo1lmtn ieilt a2rm(rp;t4alx iietyd s2rm( s;t4areoif todfpt au i;t0truoio3iy4lleemfcslt)s2rmurpot1aleomfetadlm emnmp () eeomocoo1faDe uesls  2toxm3no4om nlnesat) rta(  nt0tee iieiyslaDrmuvp;u) rerxo3ootlpteluvi;t)texoxmpiodlltnmfesas srtaxro;t0aetomieiasfa2umnvsnt)tlxnioctadomtelivsl(0srxrir3ou4omt lictas)arta(mpou0aetniociatls2rl(mo;(0tleomr3ta1oaD  uesl(0s2xr(opiudopeelivi t a2ta(r ;o0oex moeildls um(vont4 reomocta1oaDraneo t) rurxm3ou4altnmnvia(farrr(mpot1texnii3iydlsDra( pn()tlxrio oo1fpD lieo t  rxrirpno4om elncilsfaDtaxr ot1aetnifeiaslaDran o;(0trtnmf3iodlptraiei;t0tetoio3nudlmtemnes t srrru onu1tet mfetyd m ranmp;t)tetnxr3io1latrlneil( trtoxopiudomtn icslt sruaum ot4oexnmfctatfm2rlu pnu) renxf tadoa  aivs;t) eur(opno4llt  ietl( sDuaumont0tleoiiciydla2elnvs t0 lerio3oodfptr ivi t texrim3oydom nlfviat srraxro;u4optnifetld mDran s u) exoiociy1fatrliei;(  2umxmpoo1amtnmnvsa() Dur(mo;t0tle  octltlsDumuvs;t0aexrmo3iatop eaieil( srtm(mpio1olt  net t) Dtrumpoo0oexnio3ils sDrl(mo;u4 rxnxfcoydlptr uvol(0trxrirpio4lpe livt s) Drr( pou0aetnmf3tatla2eanvpnu)tetrmo iy1la r ueo;( s2xoxmpoo4lmt lfvils)sDur( p;o4aexniociasfm um(vs;t4 rtoxf iadfm  aieslt s2tr(r iu4lltnmieta(fa2tm(m no0oex ifctldfa uau pnt)tlerircoatfaDeaueo;t)texo(r nu4amtnlivt t) 2raxr oo1tpeo o3iadls2ulump;t0arxnmo oo1lmDrlnvi;t)teur(r oo4ap  livsl()s2uau ono0oleoio3ildlm2umuvp (0altnif to1fpt lnvo ( sexo(m oydllenlfesas) rum( oot1tpe io3iatls2eanms t0 rtomoctodfmt ai o;t tetoxr ny1lmte nesls sDrau  ot4opeoiictyt sDua(vo (0 lxomrcio1om e i sl()srur(rpoy1lp n ivsas) Drmxrpnu4oee if3iytfa2uanmo;(4tlxnxfcoydlp  ai o;s0 rtmio3iudlptnmictat)srurumoot1oltoiieiltla um(mp t0tlenxo3io1faD aueo;t trtoimpio1lpe  nvsatfsrrrxr ot0teenio3iad a el(vs t)tetrmr3tydfpD lies;s teuo(o3io4lp  lnes t)a2umurp;o1olx ii3ias s em(vo;u4aexoxrcto1fpt au s;( tetmim oodlmtnmicilsfsDrmu o;t4aptniieiyslsDra(vpn()altrir3tatfpDran o (  rxmxo3io4apenliviatfaDrm( ooo0tpt mi3ildlm2emump;(4alxrxr3iatopt ln i s)t2um(mpio4lp e nctltf rrr(moou0aetniictlt mDem(mo (0aexrmr ta1faDe nvi t  exo(rpiudol e iesat)arrrur ou0aleomi3ias a eauvp (0trenxrcty1fpDe i o s0tetoxmpnodop n fciatfa2uau  ot0openmociadfmDumnvo u4arerio3todfptelu s;( trto(opnodomen fvtas) 2tr(moot4tpxo i3iadlaDraums;u0tlxomfciy1lpteau sls0 exoiopnu4lm nmfvtl() 2rrur no4olxnmfcildfsDuan p u0arxomfcio1fmt  n o ()truoxo ny1lptnlfctl(fa2rmumpoo0ole mfeiltlm ulnvs;t4 lxoxfcoodlptrlnesl() etm(m3iudol  liesl( aDua(mpnu4opt  icildfa2emnvp u0 lxnircoo1oa rau i s s2uo(opio1am   nvs s)sDrau pnu1oltoiociltla2ulnmo t) rxnio3oo1opDr neolt  exm(o3iodomt mnvsa() Dtru pou1tpeniietltlaDranmont4aeermrcia1faDeln s t) 2to(rpiy1omenlnctas a2rrx  nu4oleniocilt a2umuvo;t)trenmr totop e u o;s t2tr(o3ny1lm  mneta(f Dumx ont4alt  ietls s2emn o;t4arxrxr iodopt auvols t2umirpno1lp e ics tf 2rmx pot0tltnii3iyd mDuauvp;u0tlxrir iadfpDr ivs;()trtoxm3oydaptelieiat) 2tm(rp;t0oexn feiydlsDumumpn()altnxo iydopDe nvo s0 2toiopnydopte nvs (  Dtm(moou1teeo fetad mDrl(vs u)artnmo ia1fmteluvi;s) exoim iydlltelneiasfsDrax p;t0alenmfeildfa2rmn on()arenmo3to1fa  liei t0 etm(m no1ll e ncil(fsrrmxmo;t1tlx moetas a um(mo u)artnmf iatfpteai o t)srtrimpoy4ol elfvtlt)arumuro;t0olto iciadfa umuvs;t0artrmo3iadomtr n sls)s2umio io4apt lfciat)srrmx p;o0apxnmocilslmDrauvp;t4tetnifciodfaDeaueo s0 2tmimpoy1apt lnesatf ruaxr ou4aex  fetldfm uanvp t0aexnxf tytop eaueo t t2trxm3iudlpe  ict tf 2uaxrpou4tpxo i3iltfaDua(vonu) lxnxr tatoaDeliei ()t2uo(m no1ap  lnvsa( sDtmx  ;u1oleniicilsfs2eauvon(0aexoxr totoa  livslt setoirpoo4alt liviasfsDur(rpou0oleoifetlsfs2umn p;u0 lenxr3tadomt ln s;(  2umir no1alt  nei s) Dtaurpnt4tpenmi3tlsfmDrmuvont)trerifciy1opD lneils)s2xmxm3ou1olt lnvs s  2umxr ;o4alxoio3iat aDel( pn()arxoxf ootopt ai ils)tetoio3ny4om  mfvtlsfsrtr(ront1texomi3iytlm ulnmpn(4teerxo3tytfa e ueo t)t2urim nodom emnetlt srtr(rooo0alx  i3tlsfaDrlnvsnu) ltoir tytfpDelivo t truoir3oydaptemfcsatfs2rrumono0aexnii3tat s ul( o (0arxnmf tytfm   u i;s0t2xoio3nodamtemneias aDtrx  nt4apen o3tls mDum( onu0aeenxo iydoa raivi s0 rxmxmpnu4amtemietls  Drmu ont0apt mocild a raumpn(4aexrmrciadfptrli ils  2tmxr3io4ap n fctlt srraxmo;u0tpxniicilslmDrlump u) ltoio ty1lp rluvol(  exmim3oy4aptemfcslt  Dumumpoo1tpxnioeiydfaDrauvo t0 ltoif3iodfmtrln i;(0tetm(o3nodoleemncilt)arur( p;t0tpe  oeiltfm uan pnt)tlerxrctatfmDrlneo;t  ruoir nydll   nvsa(fa2tmu ono4opxomieildlm ea(ms;u4 exrxf ta1fpD  nes s seur(o iudal emictl()s2uaurpnu4opxoio3ildlaDel(vo ()tleoir ia1fmtr ivi;s)srurio io4am nlfesltf Drrumpno4altnmi3tydfm2rln p;() rtnmr3iydfaDraivilt s2tmirpnudopenmfci ()aDuax ono4oeeomfetys a2elnmpn(0tetrxf3ia1fatr u i;s  rtoim3ou1altnlfci ( srumx ooo4aeeoifetyslsDrmnmpnt4arxrmf oodlpDraueil() rtrim3ny4ape lfetl( a2rmxm ou0tptomo3iysla2rmu o;u)teenir ia1fp  anvs s sexoxr3iydll emfvt s  Draur no4teeo feildfs2uau o u4trermo oy1fa ranvs t0sexoxopno1oleemfei tfa2rm(root1aptnifcilt m rlu o t)altrxr ta1la  au s;()trxmir iy1omt  ictlsfaDraxrpou1olx mfciys a ra( o (0 exoxrciytfaD luvsl(0truoio3no1apeemivt sfsDurum ;t0aexoio3tad s rl(ms;u4 leomo oo1fm  lu i;s tetoxr3io1lle lfvil()a2trxrp;u0olt  oeiysfa ua(vs;u0tlermocta1oaD aneo (  exr(o iu1lmtelfet t s2rr(root0opt iietat mDrmuvon()trtrmr3oy1fptr uvo (0 2to(mpny1lltn nvsl(  Dur( p;t0tpe mietldfa2em(mpnu)tlxoxr3iy1lat  u ols)seuoxopio1ap  miei s a2tr( p;t1apxomocils m2ulu on(4 renmf3to1omtr nes t s2xmim ou4lme mnvsl() 2tmxr nu1olx ioeiyd aDrluvs;u0tlenmrctytlmDr ivo;( t2uoiopiu1lm nmfvs sfaDtm(  ou0apenif3tas aDrmnvpnt0 rxrmr oo1faDrai o;t s2ur(r oydap  lfetlsfsrtaxm ;t4apenmi3iatlsDrauvsnt)aeenmociodfp e ueilt)seuo(m ny4ole  fcta( sDurur no0apeoifetadfm2uln s t0 renmoctodfp e ues;t0 eurxm3io1om e fvtl()a2ta(rp;o4ale ii3tasfmDuan o;t4tltoxr3oydoa   ivil()srtoio oydlmtnmnvt sfs2trxm no4oeto o3ilt m2ranvsn() reoir3ty1la eai slt  rtrxr iydlleelfeilt)aDrruront0tpx mfcias sDum(vp ()aetrxociadlaDeluei;(0s2uo(m io4amenlneias) 2rrx onu0alxnif3tysls2rln pnt) rtoxfcoa1fatraneo;(0trtoio oydll e fct (fs2rm(mp;u1tle ii3tls a rlums t0 ltrxrciy1lmtrliei (0texm(mpnudal e ieiat arta(  nt0tpeniictlt s eaums (4trtoxo oa1omD luvo;(0 rumxrpiydllt  nvtlsfsDua(  nu4tpto ictasfm um(mont0alxnirciotomD auvi (0seuo(o3iy1op  lnes ()s2rm(r nt1tpeo o3tyslmDel(mpnu)trxomr iodfatrlneo;t)s2um(o iu1ol emivtl(f 2rr(mpot4oltoioetltla ulnvo;(4 etoio iytlmtrlieols seum(mpoo1llt  ivil() Draump;o1teeoif3iyt m ul(vo;(0 rtrxfctatlm  ai ils)srxm(opiu1ole  icils  Durxrpoo0ape mietad sDean s;u) ltrxoctytla  aies;()s2tmim3iy1apen ncs s)a2ua(r ou0apt  o3iytfs2ra(mp t0 lenio oy1lm elnvi s  euo(r3io4ome lfcsl(f rtau  ;o1teto o3iatfm uln pn(4aetrio to1fmt  ieolt) 2umxo3iy4op nlncs ( aDrr(  nt4tptomi3iytfm ul( p t4teermr3tytfmDraneslt) eum(m iydlmtemfei tf Durumpnt4tpen o3tlt sDrmnvsn(4trenxociadoat aneo;s0teur(o3nodal   ivta(fartm( poo4opx  icils sDran p;(4 exoxo3iy1fm   nei;() etm(m iudol   ici t artmumoot0aexnmieiad s2umumonu4 lxomr oy1fp   neil(0srumiopiy4am elfvtltf rtmu onu0olxnif3iyd a2elnmo u4 lenmr3iodopteaivo;t  rxo(r3oo4lm  mfes t)sDrm(m no1apeomiciyt m2ulnvsnu4texnmfciodfm rauvs;t0t2triopiy1olt lncilt artrumo;u4tpx if3iadlsDrl(mo u4tlenxf3io1lmtean s t)s2tmim3nydal  lfvia( s2taxro;t1aex  oetltlaDrauvp (4trtomo3ootlp rlu o t0srtoxo3nodoltemnvs s) ruax  oo1teen i3iltfs rmu on(0tltoir3oytfm elueils  rxo(m iy1om  mnvtl(fsDumxr oo1ale mf3iyd aDuan s u0 rtrio oytlmD aneo (0srur(opiydam elnvt (f 2tr( o;t1tet mociadfa2umnvp;u)tlxoxfciydfm rlieol()t2tmxo iu4ap e ieta()s2tmu pou1olt  o3iatla rm( p;(0tetoircoodoa r ivi t srtrir iu4lpe  netasf rrrxmonu0oltn f3tlsfsDrlumpnu0ale
\ No newline at end of file
@@ -0,0 +1 @@
+i o;s)sexr(r3nodope lfcs t)sDurx pot0aeenmicildlmDrauvp t4tlxrmoctytfmtr n o (0tetoio3iy4lm   fct t)s2tmurpoo0opxoiiciytfa em( p;u) etrifctodom elu il()s2tmimpoudop  mfvs (fsrtrx  ot4apxn ietys aDuln p;(0 rermr oadlatrai o;t)s2tm(mpoy4lm e nei ()artaum no1alt mi3ilslmDuauvsnt) etomo3iatfpDrlu s;()texm(mpny1op elnvsasfarrr(m ou4tpxomociysfm2eln s u4 rtoxo iodlmt an ils srxmxo nudapee fvs (faDum(ront1apx mfctlt mDuau s;t)aexnmr3iy1lmDranes;t0tetriopnudam n neiltf 2rm(m ;o1tpt mfetas mDulnvs t)trtnxo3iy1lp r ueolt0s2uoim3nodlpt liviat) 2rm(  nt4apxnmfctasla umn p (4teenmocoy1lm rlueol()t2xo(m iydlmte fctas) ruaurpou1oee ii3iyslsDrm(vont4aexnxociatlatrai i;t) rxrxo iy1apee fesl( s2ururp;t0apt mieiatfa rlumonu4 leomr3oadlat  uvs;t0trxr(o3nu4am  lfei ( srra( poo4apxo octldfaDulnmo;(0 rxrioctotopt  uvils  2xoxo3ou1ameemneil( artmumo;t1tpx mfciltfa2rl(msnu) reomf3iytlm elnei s0 rumxr ou4apt lnesl()a2ra(m oo4altnii3iysfa2ea(mpn(0artoir3iy1omD li o;(  rumxm3nu4lpte fvi (farrm(rpot0tpt io3tldls ea( o;u4 rermr iy1faDrluvi;(0sexrir ny4omtnlfcs ( srumu oot4opt iictldfmDrmnmpn(0trxniocoytla   u s;()srxo(m3oodllen ici sfs2trum ;t0aptomf3iyd s ranvsnu4trenxo ootomteau o;s)srtr(o3ou1lpt mnvils sDta(mpno1oltoif3iatfsDemnvp u4tlxnir oo1oat  i o;s0setoxr3oo1ale mnviasfs2ra(ronu0apenioeils aDeauvo () lxnxf3tydfp  an i t0 2uo(r3iodaltemivt (faDurxmpnt4alt ifetyt m em( ont0artniocty1oaDrln s;t0 2uoxr oodlle lfvsl( aDtaxmp;o4opt  oetls mDrmn s (0texomfciytom eln ols) rtm(m3oo1om nliet t  rrrump;u0tetniieildla2rmu s;u) rxrio tytomD aueo;t0 exoxrpoo1omt  nvi () rurxr ;o4alen i3tytfs2ua(vo;t0tltrifciatla eliesl(0setrxrpoy4oltnmnetat artmxrooo0olx ii3iltla uln snt) ltomr oa1la e uvi s0sexmxmpoodal e icsatfaDrau p;u1tpx iiciytfs2ul(mp;u4 exnmfciadlpDe ueo;( sexr(opoo1lme mnesatfaDtru  ;t1apxn fctysfa2rmnvs () rxniocoy1omtr i i s0t2umxopnodamee icta(fsrraxroou4oeen ieiysls2emnmp (4arxrio3ty1opteanvolt s2toimpny4openlfcsa(farrmump;t1apx iiciys aDuan s;t)trxomr oodopt  nes (0trtrxr3nu1apte fes sf 2rm(mo;t0opxomictltfsDrlnmo () lxnxr oydom  anvi;(  rumxm3nydlltnmieil(fs2uaxm no1tetoiieiytls ra(von(4texrxf ty1lm rlu i s t2uo(o3oy4om emnvs sfs2uaumo;o0opxnif3tydfm ea(vo;t)areoxo io1lpD  iei s)srtmxmpnu1amenmivsa(  Drru ont1texn feiyt s2rln s t0trxrir3oatoaD lnvo;(  2trxrpiudoptnmfvs ( aruaxr nt4olx iieiys a2eluvo;t4 lxnxo to1lat an s;(  rxr(mpoudlpe mieslt) rurx o;o0aptn i3ilt sDumnmp u) rxoif iydoptrai s;s srtr(rpny1olte ietat aDrmx  ;t1tpeniictlsls rauvs (0aetnmf iydlp   nei t0 eto(m oudapt  ncsls  2um( pou1tee ioetldfs rmu p u4texrmoctydlpteauvs t) rum(opiydoptn ncslsfs2umu  ot4teeoii3ildlmDrl(mo;u)artrxr tydlpDrai i t  2xr(r3iodlp emnetlsfsrtmxmpou4tlt iictydlaDrlu o (4arxrxr3io1opD lu ol(  2tmxm3oy1ameemnesltf 2rmur no4texo fciydlm rmn s () eenif iotfatr uvs;s)trxmxr3nydom emietas sDrau  ou1opt ifciyt m2uau o;u0aeerxrcoy1opD anei s)seurxr ny1ale lici s  Durxr ;o4tpxoioetys aDrl(vp u) etnmrctadfp eaivo ()trxr(m iudap elfeiasfsrum(r ;t1oeenmietyslm2em(mon(4 leomf io1lpDeanvo;t) 2tmxo iy4altemfctatfaDum(rpot1apxnmoetysfmDua(vpnu0tltrxo iy1fat  i i ()srxoxopiy1lp n net t s2uau  ;u1tlxoif3iys a2rlnvo;u0 eenxfctodfpDe i o ()t2xm(o oodll  mnctls aDumxm oo4tetnmi3iyd s ua(vsnu0aexomo oo1fpt  uvs t0trum(r3oo1op e icsat) Dta(m oo1oeenioeiytla2elu s;u4tltoio3ootfmD an o t s2uoio3nodome lfvtl(fs2taxrp;o1tptoii3iyslmDrmu on()aexoio iodfmtrluvo;t  rxr(o3no1lpe mfvias)a2trumpnu4tetnii3iytla ua(mo;t0teenio ty1laD  nei;( sruoio nu1ap  livtl(fsrra(  ou0alen feiysfaDumn pnu4areomo iytfat  i ils) 2umio3iy1lmeelieilt s2ra(  ;t4opt mictldls2rau sn(0tltrmocootlptrln i t t2ur(m no1omen ivt (farumxm ;u0tptnmociyt sDra(vpn(4tltnmrctytlp rlu s;s0 2xmxm nu4ole miet ()arrmum oo4tlxomo3ilt a ulnvp;t)aetoxf oadomDrluvo t seuoio iu1omtnlnvsatfarua(mp;o1teeoiiciadfm2rmnms;(4altoir ty1oaD livi;(0t2urxm3io1ome  feiasfsrrax  ot0ope  oeilt sDra(mo;t4tltoxf tytoaD  u i;s  exr(mpoo1ll e nvia( a2tm(mooo0optn fciadlaDrmnvo;t4 reoio iotfm  aueslt) eum(m3nu1ll   feia()aruaurpnt1oleomociyt a2emuvp;(4trxrmocoydfptrlnvslt t2tmxm3iy1olt mivt t) 2umumpnt0alxn i3ils aDrmnmon(0 leoio3to1fm  aivi;t0t2xm(r no4lltemicta( aDtr(rpno4tltnmoeiltfs2uauvpn()trxrxr3ia1lp  luesl() rxmxrpoodame lfvs ()arua( p;o1olenmoetatls ul(mon()areoxf3iy1lptr neo t) 2um(m3no1lpenlics t)s2rr(mono0aetomicias a2ua(msnt4tltrmr iadfm rlnei (0tetrxo ny1lmeemfvt t) Duau  nu4aptniocias aDrlu p;(0 rxomr3totlp  luvo s trxmio iu4omtnlncsa()a2ur(  nt4aptnmoetytlm2uluvs;t)aeeoif todfmD  n i;s0t2xm(r3nydlptemfeta(fsrururpno0apxn o3ildfa ua(mo (0arxnmf tadoat luvs ( srxrio3oo1ll elfei t)arrm(m ou4tle  octasfm ulnmpn(0 lxnif to1om   nvo;t0truoio3nudlpe  neiat  Dta(mpot1olenmo3tltfmDuan on(0altoio3ta1fm ean s;t) etoxo3oudapte iesl()artru  nu0opxn f3ils m2ean on() eermf totoatr uvo ( s2umxrpnu1ll nmnvil(  2uaur ;o4tlt mf3ild aDrl( p t) ltnio tydfa eaues (0 rxrxopny1alt mfciat)a2ur(  no0aeeo oetysfa2emn pnt0texoxf iadfm rai i;s trxmxr3ny1apt lnvi t aDumxr oo4apeoioeilt s uau s (0 rtoir3iydlatranes t0s2uo(r ou4lle livsat)sDta(  ou0tptnif3ias s rmnvs;u4trxrxf3oodlpt lues;() ruo(r3oo1al emfesa() 2tm(m oo1aexnmicildlmDrmumo (4alxrmo tatoa eanesl( srxoxm nu4ape lfei s arra(r ;u1apeomo3ilsfm eau s t4aexrxfcoytlmDraivsls sexoio iy1ole mnvsl(  2umumpoo4tlenmoeiatfs um( snu4 lxrxfcoytfa  auvo (0 etoir io1lmtn fci s)s2rru  nu4tlxn ietydla2emnvo u4 exoxrctodlm eau i t)seumir ou4openlfcsl(faDurxroou0apxo oeilsfaDraumpnu4 etnifciadfa eln i;s) etm(rpno1omtelicta()aDuaur no0aee micildfs em( onu)aexomfcia1la rlnvils)seurxm nydlle licsasfsrrr( o;o0tpt moetas s2eanvs (0texrmr tydfa rauvils  rxoim3oo1llte iviltfsrta( p;t1aeeoioeiyt a2el(vs;(0aeerxfcio1laDe ueo s  eumirpoodlle lictl(f Drr(rpnu0tet if3tytfmDulumonu4 ltnmo tydfp eanvo s)teuoxm3oodop n ictas s2ururpot0oet mieildfs2rmuvs;u)artoio3tatfmDrlu i (0 2xr(rpno4lpt mfviltfsrraxmo;t1opxniieiyt a2uanvont4tlxrir3oodom r nei s0s2xo(m3nu1lpenmfctatfsrrrxroou0tpe mociysfmDulnvs t)tlxnxocootfaDraiei ()srtr(o3no1omen iet sfsrtrur no4oet iociltfm2eau pn() rerxo totfpD aivsl(  ruo(m3ny1om nmivi (  Dumu p;t0tptnmietasfa ulumsn(4aexrmf3iy1opDeanvi;()texrxr3iydoltemicsas)srtaumpot1tptoioeiytlm rln s t0aleoir oytlmtelneilt  eumxm ny1lmt lfetas s2ta(r no4altoioeiyslaDeauvp (0aetnio ty1fpteln sl(  rxrio no1lpenmici s a2umx ooo4texo ieias sDemnmo u0 leoxrciadfa   n o;s0t2xoiopoodlmee ivias arrmxr ;u4alt io3iadfsDrmn pnt) rtrxfcto1laDeluvs;(0srxrxm3nudlmt  ivtas)aDrmxr ou1tpenmfeiysfm rl( p t0tltoxociotoaD  u i ()s2uo(rpoy1al nmfetat)arra( pnu4alxnmictasfs eanms;(0areomrcootfmtraiei;() 2toir3ou4lle  nctl()a2tau  no4olxnmo3tytlmDumuvp;u)tlxrmocoy1fm  luvo;()t2tmim3oy4lpenmfcia() Drmxm nu4optn octadfs ran pn(4arerxr3iodfp e neolt0 rxrirpoodlpeemnetlt)aDtm(mp;u1aeenmfeildla uauvon(4 ltrxocoa1lpte u i;t t2xoio3iu1lm n fetls  rrmumo;o0alxomo3tltfm2uau p;(0tlxoxrctodopDran s;s0tetoxr3iu1amenmfctls  rurxmo;t0alxo iciysfmDul( on()aexnmr3iy1lpteaivo;t)trumxm iy1lmtn fvt (farumu  ;o4aeeoioeiad m emuvp u4altrmr ty1fp e n ols  rtmxr3nydlmtn ncs s) Dtmx  no0tlx miciydls2rauvp u0trtoio ootfa  auei;t setr(m nu1lpt  nvt ( aDrmu pnt1olxnmoeiat a2emu pn(0teerio ty1om ranes t0srtoxrpiu4olt  ncilt  Dtrumpoo1apeoiociadfm2eln p u0 lenmr3tytla  lneolt0trxm(rpoy1am   nes ()aDuau pou0tpxnmfeiltfs ul(vs u)trerif todfmtelivsl(0t2uoirpiy4altemfcsl(  rurumont4opeoii3ilsfs2um(ms t0 eerxf oadoaDeluvol( setrxm3oo1om nmfcsl(fsrrmx o;o1tltnmocildlaDum(mon()trenxo oadom  anes;s0 exrxmpiu1ap e fcsasfartaumooo4altoii3iltlmDrm(ms;u4 reoxo3ia1fm r uvi;(0setmxo iy4aleelivilsfaDtrump;u4opxomfeiatla2ran o (0aexrmr oytop eauvi s)setr(o3iodamt mictltfarurxr ;t1ope io3iasfm rm( s u0trtoiociy1faDe nvo;(  exo(o io1alenlictat)srrauro;u1oltnioeiyt a2eau p t) lxoxo3iodlptran o;(  rtmiopnu4om e fetl(fsrtmu  oo1tetn fciyd s uanvo;u0 exrmoctytfmD  ieo s  2urxo nydal emfctlt)a2uau pnu0tptniociyslm um(vs;()trtoircoatlaDr nei;t srurxopny1apeelfetlt) rumuront1tpenifcilslsDrmumpn(0 rerxr totlmDr u ol(0srtoirpoo1oltnlnet (fsrtrx p;u1apeomiciat aDrauvs u) lxnmo oydlpDrlneils seurirpoo4lpeelnvs s) 2urumoot0oee  i3iytfm rl( s u0alxoxr3io1fmt luvils s2xr(rpno4alenlnci (faDur(ro;t1tpe  f3ils a2rlu p u)aetnmfcoodopt an ils t2trirpiu1openlfeslt s2raum ;t1apeo i3iltlmDeluvs;(0 rxnxo todfm eli sls  2xo(o nodamenlnctasfaDuax  no1teenmf3tld m um(msnt4 rxrxocoydfaDe ivs;t)sexr(r3iudlmtemivtas  Dum( poo0alenmoetytfm2um(vo;t0 renir to1fa ean i;(0 etoxrpiy1ol n fci s a2umumooo4alxnmictltfs2rl( onu0tlxoifctodop rlu s;()t2trirpnydam nmiesatfa2ra(mpoo1opt ii3ilsls ea( o;t4 ltoxr totfpt lu slt0texrirpoydoleelfvi t s2rr(m oo4oltomfciydfm um( pn(0 rtrmrciotfmD  uvo;t  exoxr3nodome mnvias) 2umxm nt1tetnmf3tlslaDrlumo;(4tlxrmr oadlmt luvsls)trxrir iydalt mncs t  rrrxmp;o0tpto ociasls rlumont4arerif tydlp r iei;s0t2xmir iu1altnlnesat) 2tmx oot1oexoiictatfmDeaums u4 etoiocoy1lpt  uei;t t2tmxr3oydalen nciat) rur(rono0tptn fciasfm um(vp (0artoiociytop rlneo;( truoir nu1op nmfesl(faDtmxmo;u4opx iieilsfsDelnms;(0tlxrmo oytop r nesl() 2umio3ou1oltnlfet tfarum(r ;t4tet mi3ias s rmnvon() lxomfcoy1la raueils)t2toxo iydll nmncias)sDumxmpou4tleo ocildla ul( p (0 eerxf3oo1oatranvil( srumxm3oo4olenmnvi (  2umumonu4oee  feiyt a2ea( p (0artoxr3to1lp rlnvo;s)s2ur(opno4ame lfvsas) Draum ;o1aetoiociyt sDrlump u0texrmr3iytfpt livol()trtmimpny1lm elfetls)srrr(m oo0oeen o3iysls2eau s (4trxoxf tadomt  nvi s)srtmxm3iydaptemfei t) Dtrx pou4tpxoii3tys s ea( pn(0alenio3iatopte i il(0s2xrxo oy1olt lfvs tfaDur(rpou0tpt  octat a2uanms;()trtrmfciodlaDranvs;s s2tmxm3oo1al nlfvslt  Dra(mpou1oeeoio3iad s2rluvp u0arenmrcoadfate i o t0trto(m iy1apt lieiltfaDtrxr oo1texnmf3iyt mDua(vs (4trxnmo ia1la eanei;()texo(mpnydopenmfcil( s2raum ou0tptnif3tad m2umu s (4 etnmf tytopte i i;() euoimpny4lmt mnvi s artax  oo0apxnioctyd aDea( s;u4 rxnxr ia1optr ieol()trxrio oo4om  mnctat)artr(r nu1teeoii3ils sDrmnmp;u) etrif tydfmte u o;s trtoxo3iy4lmteliesa() rrru pnu1aex  ictydla2rmn o () rtrxrcta1fatelivo;()trxoir oy1lpte netl(f 2rr(mo;o4tlt mo3ildfs um(vo;(4aetnxfciytopte neo (0texmir3io4am n ics ()aDtr(  nu0tlxn octlt a rm( on() exnmr3ta1la elnvi;()seum(rpnodopen nvslt srrauro;o4altnmo3iadfm2el( o;u)artnircty1omt  n s (0s2uo(r3oy1amt mivtat aDrmxm ot4tptnmiciyt sDumn s u4 ltomrcootlat  n ols0texm(mpio4lmen fcs sfsrrm(moou4alxn fciasla2rln sn()altnxo3oadlp r nes s)t2trio nudapeelfes (f Dumx p;u1alx if3iadla2ulnvsn(4tlxnif tydlptelneo;s0teto(mpio1amtemicilt  Drmumono0apx mociatlm umu s u4arermo oo1faDelivo s) 2xmir ny1oleelfvtls arur(r ou4ale  iciyslm ulnvonu4aexnxo oytom eaivs t  rtm(mpiodlp emfcs t a2tr( pot0texnmi3tytlaDrluvsn(4 exrxf3tytlmte i s t0t2tmxr3nydaleelivtl(  Drrx  ot0oet  oeiyd m2el( s;t0alxrxr oy1oat aivo t)s2xmxo nu1alen nvt sf 2taxroot1opt  ociadls ul(vpnt0 exoir todfmt  nvs t0 2umir3no1am elfesl( srr
\ No newline at end of file
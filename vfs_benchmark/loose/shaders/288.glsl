@@ -0,0 +1 @@
+i il( texr(opiudomt lfesa(  rumu  oo1olxnio3iysfaDumump;() rtomr oytfa rai s t)trtrio3nu1am emfvtat srur(mono1alx  ocildlm2raums;t0 exoir tatfa  aivils) 2xmim oudlm e ics ( sDta(m oo4olxomi3tyd a emnvs;t0aleomr3ia1opDelu ilt)trur(mpnydome  fetl( aDrrumpnu0ope iietytla ua(mp;(4trxoxo3oatlptr iei (0s2trir oudopenlfesas) Dtmx  ou1tpx mf3tytlmDel( p t4 rtnxf oo1fp eai o;t) exr(opno4ap  lnvias  2rrxm ;t4tpe  f3ils a2emuvpnt0tltrxrcty1oateauvsl()s2toxopio4lp nmnei s  2ra( pot4olen ietltfs rl(mont0artoxr3iadomtr uei s  euriopny4amt mivtasfsDraxmont1tpx mf3iatlm ul(vpn(0alxnmf3oydfp elu s t0t2xrimpoo1lp  livta(f 2ururo;t1optnmoeiysfm rl(mo;u4alxoxr3iotoptranei t sexm(opny1opt licil( aDtrxr oo1tlt ioetatfsDra(ms;u4trxriocta1fmD anvs (  2xrio3nu1lpt  icils) rururo;t1tle  fctldfmDea(mo;u4alxrmo3ta1lp  lueilt0texr(opnudop nlnvias) Drm(mono0aeeo fciatfaDumn p;t) eeoio3iadomDean sls t2tmxrpoy1ap e ivtltfaDumx p;o4apxo f3iyd m2emn p u0 ltoiocoy1lmte i s t0texr(r oy4optn feil() 2tax poo1ope iietlsfm2rmnmo;u0 ltnir ta1oatrai sl(  etoim3no1lp emfvil()a2uax o;t1tetomiciysls2ea(von() exniociatoaDelnvil( t2xmxo3iy1ole livt (farurxmp;u1ale mfciat m emnmonu)altrxocio1fm  lneo s)seto(m oudomte ncta(f rumu o;o0aexn i3tysls2rmnvp;u) rxnmf oa1omDrluvs s)s2toxmpoydaltemfctlsfs2ta( pot1aptn feiydfa2em( s (0 ltnmfcoadlm   nvo;s seumxr3iu4ol   nctlt)arta(m ot0oex mieildfaDemu o t)alenxo tytlatrlivs;s0srxo(opiydomtnmnctltfs2umx pot0aptniieildla rmn s u0trenifciodopDraues;s0texoimpiy4alenmfesls)sDrm(mo;t4oexn iciydlm2rl(vp;()trxrxrctydlatraivil(  exoim3oodapen fet ( arurxm ;u4ole io3iytfa2ra( on(4aexnmr3tytopt luvi;t)t2trim3nodap   ivtlsf 2urx ont4apxoioetytfmDra(mo;u4artnmo ootlmDe uvi t)t2xo(m ou1aptelfctat)s2trxmo;t0tleomoetadfs2ulu p t4 ltrif3iatoa  aieo t  2uo(mpno4apee ieiat)aDtmu onu1optniieilslaDranmsn(0trxomfcootfp   n s;t trxr(opou4ale lnetl( artruro;u1aee ifeiatfaDum(vpnu)alermo tytfpteanvs;(0 2xrio no4optelfvs s) rrrxrono0aleo oeiad mDemn o;u0 eenxoctodfat  nei s)seurxm nu4optemnesl()srtrum ;u4oleo i3tad m2um( s;t)trerir3tadfa e ivilt  ruoxm io1alt lnei t  Dtaumo;o1tleoiietad aDrlu o;u)alxnmo3oydoaDelu i s)t2toir io1optemiciatf Duaumpot0tlx ifctlt a2emn p () exnxf oydoateai o;t trurir io4optn icsat) rta(mpnu1olxo ociltfa ulnvo u)alxnif totfpD au i;t trum(mpiu1omenlfeias aDum( o;o1opxoifctysfs2eau o;t)tltnmo iatfaD au ol() eum(m3nu1lltnmncias  rtrumoou4oleomieilslm eluvont)trtomf3iytoaDrlivi s  2urim iu4omen neiat) Duaumpnt1alx io3iytfm em( o;u0tltrmf iytfmDrlneilt)t2uoim iy4op nmics t arumxr no1teto ieilt a ua(vpnu4aexomfcty1lpD  ues s0srurxrpiu4omeemfeia(faDrr(mpoo4tex mi3ildfm2eln onu4tetoxocto1oa rlnvi (0t2ur(o nodol elnctatfsrta(mp;o4aptn o3tlsfa2rlnms;u4 rerio3iadfp eau olt0texrxrpnydlpe lietatf rtaxrp;u4tpxo fciytfsDul(vonu)tleoxocoydomtr nei s)t2xrim3ou1lmt  ietatf rrmxmpoo0tleoifctyd mDrluvonu) exnxfcoy1optrli ol( s2trimpoy4altelfcil(f 2rrxmono1oee mi3ilsfsDelnmo (0alermf iotlaDrluvil()t2xr(m3iydal elneil()srua(ront1tpt  ieiadla2rmnmp t)trtrmr3totoptr uvo ()seuoxm3nudlpt  ivt (faDtaur oo4aet iictld s ra(ms () rtoifcoydomteaueo s)srtmim oy4lmee nvtasfsrtm( pno0oetoio3iatfaDul(mpnt0 eerxoctydoat aues s0 rxmim3oy1oltn ivil(  rtau ooo0open o3tysfa2rlu o t) rxoxr3oodlateanvi s) etr(opiu1ol elnvsl(  Drm( pno4tpx  fciyt m2uaump t4arenircoa1omtr i i;( t2toxm3iu1al nlici ( s2raum ;o4olxomi3tlt aDea(ms t) etriocto1lm e iei t) exr(m3io1lpte fesltf 2ua(m ;o0aetn ociyt aDumnvp () ltrxo iytfmtr uvo;t0s2uoir oy4oltemneilt)sruru p;t0opt  fciad sDuluvp;u4arxrirciodla eanvsl( srtr(r iu1om e fei sfarrrx ono0apx  ictlsfa2ulumonu) etnir tadlate ivo;s0s2xm(mpnu4lme mivs tf Draurp;t4apeo i3iaslaDua(mpnu4areoxr3oo1lpDe uvs t0t2to(o3nu4lpt lnctas)srtaxr nu4alxn icilt a2ua(vpnt4 rxoifciy1fmt  nvi;t trxmxr ny1ll n net ( aDuaumpou4apxoifcilsfs rmnms t) exrxf3tatoptelneo (0t2tmxm3ny4ameelfctlt) 2tmxmono0alxo o3iyd s eaumon(4 exoxocoy1fa  auesl(0 2uoio no4lpeemfet s) rra(mpoo1alto iciyd a2elnmpnu0 eeoxr tadfmt  i slt)srxmir3no1omtnlnvsas)aDtr(r ;o4olt  ieilsla2raumpnt4aetoir3tytlmD luvo (  rtmir io1llenlfcilt) rum( o;o1aleo o3ildls ulump (4alxnxr totfat luvo (0srxm(o3oo1ol emnvt s)artrxm no0aptnmi3ilsls rmn s t0 eermf3tadomt aneol()t2to(m no1al nmictatfsrta(root4apeomoetadfs rlnms u4 ltoircoodlaDelneolt)s2toirpiu1apeemnci tf rrrx oou1tpeo o3iaslaDemn onu4 rxnxo iytopD aueol(  rum(opou4lp e ici s sDra(monu1tpxnmf3tysls2ulu s;(0tetniociadopD  nvils0teurirpoydomtemnciatfs2ta(  ou1apxnio3ilt a rau s;t) rxnxo3tadfmteli i;s s2uoxmpoy1amt mfcsl()a2urx o;t1tlt  o3iydlm2umu p u4alermr3todfm eaues ( srxrxr3nudale lnvta(fa2rmxrpnt4oltnmicils mDrmnvonu0arxrmrcoatlm eauei (0tetmxr iu1llee nei s  2ua( onu4tlxoii3tydfsDemu on(0trermo io1lm e ieslt  rxr(mpnu4lpt  icsa( a2tmuro;o4apxnifctatla2rmu s;(0alxomociatlpDelueils)t2xrimpoo1op   nvs ()srtr(rpot0apxnmieiad mDulumo;t)artoiocoo1omt livo;t t2xoio3nodale  iei (  2trxr ;o0tlxomo3iydlm ean p;u0tltnmr tydlm rlivo s  euoim no4lmtnlncia(faDrru  oo0tle iociytlm2ua(vs t) rxrxrciy1opt  i o t0s2uo(m3iu4omtnlfvt s)s2rrurpou1aleo f3ilt s ra( p (4alxrxo ta1oa eanes s)texo(o3ou4ol e nctls)artmu pnt1aeeomfeiltls um(mpnu4 rerircia1la eauvsl()t2umxr3oo4olenlnvi (fs2ra( pnu0opeomocilsfs uln s;()aexnxf ty1opD  uei t0trtmiopio4omt mivia()s2taxm ;o1alenii3iadlm rau p;(0trtnxf3iotfa r ivsls)sruo(o3iu1omenmneias)a2taxr ;o1olxnmieiadla2el(vp (4trtoif oatfa r neo (0trurir3nudaleemfcsas s2trxmpnt4aeen i3tld s el(vsn(4aexoio iadoptelneils texrirpoodal   ncil() Durxmo;u1apeoii3tltfmDemump t4 eeoif3iadlaD anes (0 2urxr3nydomeelivs tf 2rmu o;t4tpeo fciadlm ul( ont0 exnif iadfmt lu i;(0 2xrxo3iy1omenmfesat sDur( oou4ale  ictyd a2uan pn()tleomo tadlm  lnei t) 2umxr iudaltnlncilsf Draurp;u1ole mfeiaslaDumumo ()tleoxfctydomtrln o s0seuo(o nydaleemfeia()a2uaxr ;o4olx iictasfa ea(ms;(4trxriocoatlmt an s s0 eto(rpnodape lnvs s)arta(rpnu0opto i3iatfs2rluvo;t4alxrif3tydlm  ai o;(0t2xrir io1optn ieil() 2rmur ;o4olxnmiciyt a2el(vs t)aeeoif3ta1la eai i;()t2xrirpou4olee fei tfarumur no4olxoioeiatfa2rluvs u0 eeomo3tytlp r nes;t t2trir iy4om emicsl(  2tmurooo0oltnmieildlm el(vs;t0trxoir iatlm  auvs;(0teumxopiudole  netatfs2um(m ;u0olenif3tytls2raumo;u0 lxnirctodoptr ies;s)texm(r ny1op nmietlsfsrrmx p;u0openmi3iasfa rm(vsn(4trerxo ty1oaD  uvi s) rxrir ou1apenmict t a2trurpou4alxomfeias s rm( p;t0 exnir3io1lm e n il(0tetoir iodomtnlnvt sfsrum(monu0oexomf3iltfs2ul(mpnt0tlermfciy1fp rlneil()t2xrxm nodam emnesls aDraxm ou0teenmf3tadlaDeau p;t0trxomo3iatlpDeai o ()t2umir nu4amen nvtlt  2trxrpou4apto oetatls rlumont0aeeoif tydlaDrluvsls0srtr(r3nydlmte neil(f 2rm(rooo0oleoii3tydla ea(monu)tltnxo3oodlatelu s;t  euoimpoo1omtemieil(farrr(m ;o0tet mf3iadfs2rau s;t0trtoxfcty1oatr ieo;() eto(rpoy4llte fetatf 2ra(m nt1olt  iciltfa2rlump u4 rxrxo3oadopDeaneo;s seumxo3nydlpte ncils s2trxmo;u0aptomociydls uau s;(0treoif3iotfpt  n s;s0 exmxm3iy4am emnvi ()a2tr( ono0tpe mieias mDeau ont0texrxrciotlmt aivo t0tetmxm3nu4ame  fcsls)a2ur(  ou0oetn oetls m rm(mpnu)aetnxr totfp  liesl(0trtrxr iodlpt  feiat aDuaumono0opeo ociadla emuvp u4tltnmf3tytfptrau ils  ruo(mpoo4amen ivsasfsrtr(r ot4alenmiciytfs2el( o;t0 etoif iydfp ranvo s s2tmio3io4om elivi tfs2ur( ono4aptnmicilsfsDem(vs () rtnmociadlatrln i s0t2xr(m oo1lle  fcil(fsDtmxmpoo1oexnmocils a2ulnmsn()arxnmr oodlmDeaies;(0 exr(rpiy1lltemfcsatfarrrx p;o0optniietatfm2em(mo;()tetrif iydfmD  neo () rxm(r3oudlpeelivilsf rtrumoot0tptn feiadlsDelump;t)alxnif3tadoptrai s s)srxoxr nu1optnlnetl( s2rrxm ;u4apen iciydfsDumuvp t0texrxr3iytfa   ueilt srumxo3io1lptemnvt (f 2tru ont0opeo ociadfa2em(mo (0trxoxr3oodlp eluvi;( trur(o iu1am nlfcsltfsDum(rpnu0tet moeiltfs eln p t)texoxf iytlaDr uvi ()s2xo(opiudop   fct (fa2ra(mp;u4olen ieiatlsDumnvsn(0teerxr iydomDelivil( srtrim3nydopenmncs sfsrtrur oo1olt iietytfm rau p;u0trerio ootoaDeau o;( s2xr(o ny1ame mnctlt  2rmu p;u4aet ii3ildfsDum(msnu)trtrmo io1fmtrlnei;s srxr(o iudamte fctasfs2ua(mont1tpe ioeiad m el(mo t4artnio oa1oa rlneil()trum(m3oo1llt  fvtlt)s2rau p;t1olen fctlsls2eauvpnt0trtoif3iatfptelnvs t sexmim3oydlm   fcsl() Drrx pot4aexnmfeild s2uan snt) lenif oo1fpt lu i t0truo(rpnu4alte ivia(faDrmumont1altomoctad m2eauvpn(4aetrxfciy1laDr i sls) ruoxm ny4optnlivsatfa2tau oou4tlt  i3iysfs eanvp;u0teeoio ootlm eluvs () exr(m nu1al nmnes (fa2tr(roou4tptn iciyd a2uluvo;u4alerxo3oo1op elu s s trxmio3io4ap   nesat  Dur(m oo1oexnioetadlmDelnvs (0 renir oydlmte ivo;s0s2xoxo ny4oltnlfcsls)artax onu0tleniieiadlm elnmo;t0 rtnmr todlmtraiei;t) rumxm no1llenlfvilt s2taxronu1tpxo ietaslm2uanvs t) renif3tatoatraivilt srumio3iy4am  lfetasf Dua( pno1tee io3iytfaDul(mo;(4artrxf3oydfmteauvo;(  exoiopiu1lmenlfetl(f 2ur( o;t4oet  o3tlslaDulnmpn(0 lermr3iodoatr ues ()seuoirpoodale mncs tfs2uauro;t1oexo o3iad aDea(vo;t0 leoxr3oy1fmteaiesls0trxo(o iy1llen iviat s2uauronu4texo feiaslm2rluvsnu4 rtnmo tadfp r n i s) rxrir3oydomtelfcsa(  Drr(  ;o1tex  o3ias a uluvs u) ltomrctatfpD  neil( s2xm(o3nu4ol emies t) Dur(rpno1olxomfeiad mDrmnvo;u) lxoio3oa1fp e ues;s0srxoim3io4om elnvils)s2taxmpnt4opxomfcilsfs ea(vsnu0alxnxociotlaDr nvi s0setrxm3iy1lmtelfvias)sDra(mpno4tpenmfeilsfsDul(mp;u)tlxomo iadoateaueil() rxm(r oo1amee ics tfsDraxmono1optn ocilsfsDelnvpnt4 exnmo iytoate uvo;( srumxm io1omt mfciat artr(mp;u0texo iciltfa2eln p;(0trenio3oatlm  au o t0 2xrir nudlpte nei t  Dtrum ot4opt if3tatlm2rlnvo;t)alxrmr iotoatrlu olt trumimpio4lm  lfeias)srur(  no4olxoiiciatls rmuvpn() lxoioctydfp eln o s0 2to(m3nudape  ictl(fsDtrurpou0opxoif3tyd a umump;() ltrif3oadfpDeanvi;t0 2toxm ou1om nmfes (fsrrrurooo1ope  fcildla ean p u0 lxrmrciotoatr ivilt) rtoxr nu1opt livslsfsDrmx o;u1alen feildfm2elnvon()tltnxfctotop  an o;s sexr(mpny4ale mieia(  rtrxm ot4ope mietydls ulums (0tlenmrcoodfmt aivolt texrir oo4altnlnvt tfaruaurp;u0oetomo3ildfs2ua(mo;()aeenmo3iatfmDe nei;()tetmxr oudomtnmfesls) rrmu  ;t0aeeoiociatfm ul( p () leoxf3totoatraivi;s0 rum(r3iu1lpeemfvi s) Duaxmp;u1teeomoeiltlm ul( pn(4texoxo ty1fmDe ieo;s0 2urir3iy1lm n iesat)arrmumonu4oleo i3iytla2emuvsnt0 etrmocoo1oaD au sl(0 2xo(rpnodamtn ivt s)aDtru oou0tpx iiciytlm ranms;u4 eermfcootfpDraneo;t s2umxo3ny1ole  feiat)sDtr(m nt4aeeomictatfs2uauvp;() renxf3iotlaDelivils)t2urxm3oydlmen fcsl(fartax p;o1aexnmf3iltlsDulnvo u4artrxf oydop rliesl() rum(o3oy1alen nci () 2rmx poo4aexo iciydlm el(monu)aetoxo3oytla ranvslt setmim nu1altelicsas)s2ua(rono1tetomfeiytfa2ul( o;(4arerio oy1fp   nvs;s0t2ur(m iu4lm e fei (f Drrx pno0altoiietysls eauvp;() rtrmr3ty1lpD liesls0seto(m3iu4llenmicia(fsrum( pnt4tpenmiciyt s2rl( s u0altoxo3iatla   nei t)t2ur(o iudlpen fesa(f rraxm ;t4apx mfciys s eanms (0arxnif ta1fmte n slt)srtmxopiy1lm  licslt  Dum(m nu4olxo f3ildfm rm( o t4tetnir3tatoaD livs;t0srxrim3no1om emnciltfs2ra( o;t0aetoif3iad sDelnmpn(4aeenxrciatfm rli i;t0t2toxm3oydale  ies () 2um(mp;o0opeoioetltlaDrmu snu)arxnmr ia1oat  ieols) exmimpoo4ale mivia(f 2tru p;u1ape  i3tlt a2uauvp;t4tetrmo iatfaDr i s;( truoxo3iu1apeemneil(f 2uau o;t0olxnii3iyt mDelumpnu)trermrciodfp e ivi;s)setrio oo1ll   nei sf rumxrpnt1oet mociltfa2um( o u4areoxrcia1om   uei;() 2tm(m3io4oltelneiat)a2raxronu4opt iociasla elu p t4 ltrif oy1lpt ai sls0s2tmxrpio4alte nvt s)a2ua( ono0alenmieilt m umnms ()aetoxr3oodom  lu s t0t2tmirpoo4aptn nct t  2ua(r ;t1tee iieiatfa umn pnt)trxomf to1la ranei;() 2umxr ou4openmnvs s a2umxr no1tlen feiatfa2rmnmon()trxoir3ty1oaDrau ols0 etoio3nu1om elfctltfsDur(mp;o1apx  feiydfm2elu o t4aetnxf3todomtelies t0tetr(r3nodoptemfeiatfsrrr(m nu4tpto f3ils m rauvo;(4artrir3ia1lm elnei t0srtrio3iudom emnciat) rrrx poo0tlxomieilsla eanvp (4arxnir3iydoaDe i o ()tetrio no1opte fcsa(  Drau  nt4olxomieiydfa umumsnt)tlxnmo3ty1lpt li s ()t2xmxopio1oleemneslt) Dumurpnu0olt ii3ias sDua(vsnt)aetrmf oydfmDeln ils t2umir oy1ope lfvilt arumurooo4apxniiciatfaDelu p u)tltoxo3oydfpDr ueslt0srxmxo3no1llee ncsltf Dtrumpou0oeeniicilsfaDel(mp;(4tetnxoctytoa r nvol() 2uoiopiu1open ivt s arta(  ;u4aexomf3iasfa uan o;u0tetoircootoaD au s;()teur(o oudamt lneta()sDraxrp;o0alt  f3ild m2rmu ont)altomr tatopteluei;s0sexr(opiodol nmietl(fs2raur no1oexn ociydfsDranvont)altrifcto1la e i s t0sruo(opio1opee fcsat a2taumo;u4apto ocias aDum( o;u4aetoif3oodlmt  nvs s  eurxopny4lle  fcs sf 2tru pou0apeomiciadlmDrlnmo u4trxoxf totlpD  ivsl( trtmxm oo4lm  lncsat) Durumoot4oee mfctytfs uluvont0aeenmrcio1fmDrlieilt)trumxm3oudomtelfci (f rtmxm oo1texn ieiysfm2rm( snt)trtrioctytlmD lueils) etoio no1om e fci () 2rmxmoot4tlx iieiatlmDuau s (4altrir3iatla e uvol(  rxrxmpiydlpenlfvsas)arra(mp;t4aptomf3tydfm emuvp;u)alermocoydoate i sls) 2trir3ou4alt lnvil(fsDtaum ou1aee miciysfa2eluvp t)alenmo totfmt  n o;t  2tm(rpoydll  lfviat) Dtr(mo;t1altnmoeildfm ra(vsn(0 etnmo iy1fp  ln s;s)trtriopou1al  lies ()s2taxmont4apt ifeilsfa2raums;()tleoio3oa1fa  aneol( texoxmpoo4llt lncilt)aDrmxr ot0tleomo3tydfa eaumo;u0 rxoio io1oate ueo;(0tetmim iy1ope mieilt aDum(mp;u1alxnmfcilslm umumo;(0teeomr3todoa e nvils srur(rpiy4om nmfvtls)arrr(mp;o4alx  iciatfa umu sn(0aexoio3ia1opt  ivo;(0s2xrirpoy1aptemivt (  2trxmp;u0altoio3ildfmDrln pnt)tlxnxr oydoptrai i;( t2umir3iu1lp elfvtl( srrr(mpnt4tex if3iydfm2emumpnt4 rtoxf3oodomD  uvo;t)sexo(o ou4lltn fvi ( s2rr(  oo0tptnifetyt a2rlnvs;(0 renmrcoa1fpteau il()s2xrxr iu4ap e fvil(  2tmxr ou1optn fcilt sDra( p;u4 renxocio1opDelies;t0s2xoimpiy1ll  lnci s)srtrxmpnt4tltn oeiyt a2eaumo u4alxomo3oydom raieil(0 ruoxo3ny4omtnmfes t)sDtau  no4altoiictydls2rlu snu0tltnio3iotop   ueo ( t2xrimpiydameelnctlsf ruax  oo0apt iieiydls eaumsn(4arxrir3oy1omDrli sls)t2umxm3oo4olt livs s)sDrr(mpou0opxnifeildlm uln o;t4artnmr3iadlpDrlnvslt  eumio nodom nmfcsatfsDrrurpot4oetn ocildfmDranmon(4tetrmr io1oaDrauei ()seumir3iudap  livsas artr(roou1oleniieiyd s eaumo t4arenmf totfm rau i;()t2xrim nodll   ivilt artmx oot4tee mieiyt a ulnvon(0tltomfcoadfpD lnvil() eumio no4omte nctltfsDtrurpnt4tlen ieiadlaDrmn snu4trerioctatfaDranes (0setmimpnydap   nvslsfaDtaxm ot0ale  i3iydfm umu p t4texnir iytlpte nes s) etrxmpnu1omee fct t)aDua(monu4tpxnioctytfs2emu p ()tlenio oadlpDrluvo (  rtrxm3nodlmte nvtasf Durxroou0tee  ociasfs el( o;t0 etomo oatfatraies;s  ruoirpoo1lpeelics ( a2rmxrooo0altoioeiydls2um(mont4tltrir3tydoatelivsls0trumio3io4oltn fesa()a2urxm nt4texo ocilslm2uaumo;t0 lxoifciydfmD  i i;s0trxr(r ny4ap e iesl()aDrmumo;u1apxnmfeiadfaDum(vpn(4aexrxo oo1omtranvsls)sexr(opnu1lpt  ivs (  2trumo;o0tet mfcild s2rauvs;(0trtoxfctotfmtrlueil( sexmxm no4lmenmfvt (fs2um(ronu4opx io3ias mDrm(vpn()altrxo ootfpDrauvilt)trurxr3iu1om n nciasfsrtmxrpot0apxoiiciys s2um( snt4 exrxo tydfpt auei s  exr(rpnu4ap   nvt s arrm( ont4opxnmi3ils m ulnms t4aleoir ty1la eauvs t0trxmim oo4lm emivsltfsruaxr ;t4openmfeilt sDul(vp;u)aleoxocoadoa rlieol( tetmxmpno1olee ivia( aDtaxrp;o1opxoiieias aDrl(ms t)trxrxfcoa1lmtean i;t0s2umxr iu1oltelfvil(f 2rrum ou4tlxomfciatfm elnmo t4trxnio3oa1fp r nesls  rxoxm3nudll emnviasf Dtm(  ;u1aexoif3tatla2rl( s u4aeeoircio1fmDr i s;(0seumxopno4om  lnet s sruaxrpnu4olxomoetytlmDeaumont0trenxr iy1oa  livo ()texr(m3iydlme  feil()artmxm ot4alxniieilslm2uanvs ()arxrmo3iodoaDeluvi s)trxr(m3oy4lpt lfet ( srtrxmono4aetnif3ildlm2eanmo (0teerifciatfptrlu sl(  etoxm3io4ome liet (  Drmxmonu0apenmo3tldfa2umnmp;u)tetoxocoo1optrluvsls0srurirpiodome lnvilt) rurxmp;u4apt iociad s2ua(vo;u)tlxoir tatomDelnvol(0s2tr(mpio4opt  ict s  Dtrum no1tleo fciltls ra( o;()trerircoytom   uvs s0 exr(m ny1lltnmnctlt srumxmp;o4apxn fciaslaDelu s;(0aexnmo iadfa rli o (0 2toiopoy1lpee ics s)a2rrx  ot4opxoiictadlm emumsn(0aeeoir tytomteluvs () rtoim3iy4oleelncil( a2rauronu1ape mietat m2um(mp;(4 lxnmrciydlpt  neols tetm(o oy1al  lics s  Drm( p;u4altnif3iadfs2ranmsn(4trxoxo3oo1faDe ivs s0 eto(r ou4ap e net (fa2ua( p;u4tpeo fctatlmDemumpnt0altnir3tytfmD  n ols  exr(m ny4lpte ivsas  2tau ono1olt moeiytfaDrmnvont4teenmfcoa1la rlieo ( t2xoio nu4lmtelietat  rumxroot1texnioeiytfsDeln pnu4artnxo iadlaDrlnes (0trtrxm io4lm emnvilt  rumxrpnu4aptnif3iydfmDumnvpnt0tltnio oytla r uvs;t  etrim ny4amenlict t artmxmont4oee mi3iydls rm(mont0tetrmf oodoaDrliei () 2tmirpoo4lp  lfvtl()aDtaumo;u1aet  f3iadfaDeanvon(4 lxrmf iydopD  ues;s0trtrim oodop   ncsl(  rrmur ;o0alx miciys aDuau s u) renio3oodlmDelneo (0seur(mpoy4am nmicias)srrmxmpou1opxo f3iyt sDemnmont0trerxf oo1fp  lnvsls0 etoiopny1amt  fvs t a2ur( o;t4optn o3tytlmDumn o u)teermf iy1lmDr ivo;( t2uoim iy4al   ncias  2tmx o;t0oetn i3iat sDrauvsnt0 rermr oytomteau o t)seuo(m3ou1amen ivt tfsruaxrpnt0oeenmoeiat sDeauvsn(4tlxoircoytlmte nei t s2xrxrpio4oltelieils) 2urx o;o1oeeo i3ils mDea( on(0aexoio iotfateli sls)trtoir3ny4om   icsl( sDrmxrono4tpxoioeiytlm2uauvont4 exnif iy1fptrlivols) etoio nu4lpenliet s sDtr( o;t1tlenif3iasfm2elnmo ()arenmociotlmt an i;s)t2tmxm3nodam n fcils) 2rmum nu0tpt  i3iatfaDul( sn(0aeermrctytom ranei;()trurim3oo4lm emiesls a2uru onu1oex ifcildfs um(vo u) lenir3oatfp eln s s trumxm iydope liei ()aDtrx  ;o4olt ii3iadls em(vo;(0aetrxr oytla  aneo;t setoim oy4amtn neiltf Drmur ;u0olx ii3tad mDrlnmp;()treomociy1la rlivo;(  2umxr nu4lpt mieiat sDur(mpot4apen ocilsfa uauvs;u0alxoxrcia1lm rau s s0tetmxo3no4alt lfeslt srrmurpno4tetomi3ildlsDeauvonu)aetomo3io1fmDr uvs;()teumxopoy1om  mnvsa( a2rrxrooo0ale if3tasfm2rmu onu0 rxrmocta1lmDelu o;(0 rto(o oo4opee feslt aDtr(  ;o0tlx mfeiatlaDua( o u) etnio3iotlatelieslt0trtmio iydlptelnvsl( aDuru pno0tlxnmfciatls elums;(0 eenmrciytlaDrlueols)t2to(opnudol emncsat)sDtrumont0altoioetat s ulums u0texomo totlm e iei;t0 rxo(m ou4apt lies s aDra( oot4tltn f3tltla2eau p t4 rxomr3oydfmDrlu il(0 exm(rpoy4lle lfciasfsDtaxrpot0tlxoioeildfa2ul(vs;(0trerxr3oatlatelueol()s2xr(mpiudoptelnctl(f rta(  ;u4ope  fetydfsDraump;t)teeomr3todlpD  n s;t) rxmim3iy4am  lnvtat  2rru ooo4opeoifetysls umnvon(0 renir3iytlmt  uvsls)trumxr oudalt lfeiasfs2uax pnt4tlxomiciatlaDranmo u4alxrxr3io1omtrln i;t0s2uoiopou4opt mfvtltfarrmxm ;t0olx ifcilsla2ul( ont4tltnmr iotomDean i t0 exm(m3ou4olt lfvs tfsDumxrpoo1tpe ifcilt a2em( pn()trxnxr oadop ranvs t srtrxm3oo1olen nvi t)a2rmu pno4tetnmieiatlm2uau s (0tetrxr3oadlptr n o t)srxrirpio1ameelfet ()s2ta(rono4tltn f3ias s2umu pn(4 lxrxr3ty1faD luvols0t2urxr iy4amenlicslsfartr(  ;u4tleoioeiadls2rm( s t)aetrmf oatfaD aues ()trxmxm oy1ap   fvsat)sruaump;u1tptomoetydls2ra(vsn(4trxrioctatoateauvo ()s2ur(opiu4lm nmfctlt)srum( o;t1olx mi3tlt m rmums;t0trxoif3oatfm rluvi;t)srxmim ny4lleemfet t)sDurxm ;o0tpe  fciydla2el(vp;() lxrmo3to1opDr iei t0 ruoxm no1ap   ncsl()s2ua(mp;t1tltniictyd m2eln snt4 rtnmocoa1fmD  nvi;s) rtoir3nudopt mfei (fartm(rpot1tpt mfctyt aDumnvo;u0alxnxo3oadfatrln i;s)tetr(o oo1lp elnvtls)s2tmxr ot1olxnii3tyd m ul( s t) rtoxoctodfa   iei s0t2urxo3oy4llt  fei ()arrmur ot0teeomictytlm ra(vp t)treomfcoydomDeluvi;s)s2xo(rpiu1ole mnei s)srum(root0tpt mo3ias s2ranmo;t)aleomrcoo1op r ivo;(  2tmim3ou1lme lfvs ( s2taurpno4opxnmictaslaDrm(vpn()altrmo3oydoat an o;()texrio3io4ame mfctas  rtr(m ;u1tlt moctls s2umu pnu0trtrmocoytlaD aneils) rtr(o3no4oltemfcils)sDuaur ;o4tee ioctltla ua( snt0 rxrmfcia1fateai il(  2uoim oodale mfei tf 2uaum ;u0oex moeiydfs el(vonu0arenmfctotfmDelivs s)t2tmio iu1amen fcsltfs2um(  nt0optoiieiys aDranvs;t)trxrxfciydfpDr n i s sexr(r3iudlpt lnvtls) Dtrum nt4oet  ietldfm raumont)arenmrcio1lpDr i o;( t2xr(r3nodlmt  icsat) Dta( o;t1aetnioctasfm2umnmp (4 exrmf3iydfmtrluvi;t) 2trirpiodape mfvta( sDtmurpot1oet  o3ils mDum(monu4tleoifcty1la  ai s;()teum(mpoydom nmnvsatfarrru  ;t0tex mfctys a2rlu p t)aeeomo oy1la r uvils) rtmxmpno4lmee ici (  rtmx  no1alt mf3iytfa eln p;(4arermo3ia1omD  ivilt)t2toio iodllee ivt (farur( pnu1alxnioeiltfsDulu s u0arxoif ta1lmt  uvo;(0 exr(r iudomtnmnciasf rururp;u1apenmi3tatfm2ra( s ()treoif iytfaDe nes;s0 etmim oo1lpe  icsatf 2umxr ot4aex iiciltlm2rluvo (0tlerir3totop   uvi (0 etrio3iu4ame lnes sfa2uax  nu0tpe  ociatlm rmumont)alenif3oa1la ranvo;()sexoirpiu1lpe mfesas  rta(mo;t1open oetld aDem( p u0 rxrif tydfatrauvols)trxoxr ou4omt lfeils)srraum nu0altn o3taslm raumonu4arxoif oatfmtrluvslt srtr(mpnu4lleelfcil(  Dtrxmoot0tetnmietat s2rln s ()arxnxo io1fa  lnvsl()t2trio ny1apt lfvi t)sDraum nu0aee mfeilsfsDelnvs;(4tetomo iotop elneol(0tetrxo3oy1llenlnvt tfarta(r ou0apenii3iadfm rmn pnt) etrif3iy1opteai i s) rtrxm3nudlp emivsas)sruaump;t0oeeo octysls2uaumpnt4 lxnif3to1fate n o t  euoxrpou4omtnlneias arur(rpoo4tpe  ieiat m rmn ont)tltrxfcty1laDraivo;s) 2umirpno4lle mnvtls) 2ra(  ;t0tlt if3tasls emuvp;t0 etoxf3iotlm eanvo;s) 2xr(m oo4omenmietatf rtaurp;t0aee  fciltlm umumo;(0tltoxociytlmte uvo;s) rxr(r oo4ame  fvias) Draurpno0openmoetlsfs2ra(msnu4aleoircty1oat liei;(0t2urio no1lp nmfviat)a2trx o;o4aexo ictydfa ran pn(4aexoxfciytomt lieils s2tmio3nu4am  mici ( sDum(rp;t0oex  ociasfa2ea(vo;()aetomf3oydopt auei;s t2tmxr io4openlnetlt aDtax p;u0tlt  f3iltlmDumnvo u4tlermr3ty1omtraieo ()texr(mpny1am  mfcsls aDrax p;u4alenmo3tatfsDul( o u4tleomfcoadop e n i (0trum(m no1ole lfctltfa2taxmont0oetnmociysfs2rm(ms (0artrmo iotlpDrluei;s0trto(mpnydlltelfvta() 2tmxro;o0olx mi3tasfmDem(vs;u0arerxr iotfpDrai o t)trurim nu1op emics sfa2ra(mp;u0aptomfeildfmDranvp t0 rxoxrcoa1fmtelivol(  2trxrpou1aptnlivtas)aDrm(ro;u1apxoioctlt sDulumo;u0 lerxr3ia1fmteli s ()teur(o ou4ll emfei ()arumxm no1apenmfeildfa eanvp ()tlxnio iodfp raueils) etr(m3ou1ol e ieias)s2rru  no1tpx ioctldlaDumuvp t4tetoxociy1la  lieo;s)trxrir3no4omtelnciat)s2tmxrpnu4opx mf3tld m uaums;u0trxoir iadlm e nvil() rtm(rpnydlpen fvi tfs2umu p;u1apxnmoeiyslaDraumo t)altnifcoa1oa e neo t) etmio io4omeeliei t sDrau ono4opxn fctldlsDemuvo;(0 rtrircoatlmtrlnvs;t)seuriopny1op n ncta( s2raurp;o4texomi3ils mDrln snu)arermo iotfptr uei;()trur(r3nu1ope  nvsl()a2ua(r nt0alxomiciadfs2ranvp;t4arermfciy1oaDeanvi (  2tm(m oydopenlnctatfs2urxr oo0aeeomfeiadfm ean s u) rtoxo iy1lpte i i (0seur(m ou4ap eliviatf Drmum ;o1tptn i3iaslm2em( o;() rtrif3iydfate n i;(  euo(rpiodoptemneils sDrm( ont0ape  f3iltfmDrmn s;u4aeenir iodoptelneo;t0 exmxo3io1om nlfvta() 2taur nu1aet  o3tldfsDeanvs;()trtrmoctatfm  aieol( t2urio3io1openlnvtl(f ruaumo;o1apeo icilt s umu o;t)arxrmo3oytfa elu o (  eurirpoudamtnlivil() 2ur(ro;t4aetnmieildlsDelnmpnt4altoif3iatlaD luvs;t0 rtr(rpoy1omt mfct (fsrua(  ;t0olxomfetysla2rl(vont4alenxfcoydlm ean s;s)srtoxm3iydale  feils  2rmurono0apto i3tytfmDrauvon(4altomrcootom  aies t) etoxr3no4ap emfvt s)s2rmxrp;u1oltomf3ilsfm2uanvo;t4arenif oy1fa ean s t)sexrim3oodam  mnct s)aDraur ;o4apx io3iat mDumu s u4texnxociadom eauvo ()s2xoxrpoo4olt lfet () ruaxmo;o4apxo octasfm2emump t)aetrir iadfpD aieols0 2umim3oydlmtnlivia(f Dtm(r ;t0alxoifetyslsDeauvsn(4 lenxocootlm eaneol(0tetrimpiu1lleelivi s)aDua(mpot4aex ifetadfs2uauvo t4teenio oadfat luvs;( t2urxm iu4olee fct ( artr( pnu4olx mfeildfa2elumsnu0 lxrxrciytoatr u s t)trtr(m3iu4am nlfetas) Duax p;t4tpeomi3iyslaDemu onu0tlxoxf to1fpDelivs () 2tmio3oydamtelivil( a2rrx  ;u4opt mfcils s ea( pnt0 leomocoadfmt ln i;s0srtmxm oudap e ictasf Dtrum nt0teto fetysfs2rl(ms;(0trtnmfcoo1opD  ivi s  rtmxr nu1ol  mfci s  Dtrxrp;o0alto ictlsla2ean pnu4tlxnxf3oadlpD aies t)texrio ou4lmenlnesa()a2ra(mpou0tetoio3iatlmDemuvp;()trtnxo todfaD lu o;( trtrxmpiudalee netltfa2trumoot4tpen octytlsDemuvs (4aexnxr iydop raivs;s) 2umxrpnudoptn icilt) 2ur(rpnt0ale if3iat m uanmo u4aeeomrctatlmD li olt)srumxopio1ap e fctls) rtmxmonu0apto oeiyt sDulumo;(0trermr3oa1fp   uei t  euoirpoo4op   fcsltfa2rm(r nt0ape iicias m emnvp (0tlenxr ty1lmDe uvslt trxr(rpnodale miei s aDtaxm nt0tet io3ildlmDrau snt0trermo tytoaDrlieo ( srxrir3io4alee nvs ( sDtmu pnu4aleo i3ils mDeluvp;() etnif3oy1lm e u i;s)texr(rpio4aptemicsat) 2um(rpnt4optniieiydfa eluvs;t)tlxoiocoadlm r n s t t2tmim3ou1lmtn ies ( a2umxmont0tlxoiietat mDra( p;t4 rxrxo tydop e nvo;t)s2tm(m oodlmenlivi s) rtmx pnu1tpe mi3tydlsDuauvs (4trtomo3tadlmteli s (0s2tm(rpnydap   fvt s) rtaurpnt0tle iiciydlmDrl(vo;u0altnif3tydfpD lnvs s)s2xmirpno1am   ncias) rtaumpou1aeeniiciadfm2rl(msnt0 exomrciodop  liei;t)texo(mpiydapt lietl(fsDraum ou1tltomieildlm eln p;u4trtrioctodlmtelues s) rtrxrpou4am emnet tfsDum(m ou1apeoioeils m rlnvsnt0 reomr todomt an ils0 2xm(r3ny4ol e nvsas  rrax o;u4tlt mfciad m2eauvpnt0aeeomr iy1fmt aueils  eto(opoo1ol n ietltfarta(r ;u1olx  f3iytfaDra( o u4 etnmr3oo1fpt aivo ( trxmxm ny1lm elfcta(fs2tmxrpoo4aet ifctltlmDemn p;t) renxrcta1op rluvi;t0 eum(r3iodll   ivslsfs2tmx p;o1apx  f3iltfm ulnvs;(4artrif oatlmD  ivils0srum(rpio1llt lnvtlt)sDraur ou1oexn i3iadla rmuvs ()tleomo3iotfmtr ues s  exrxopoodlpte neiasf Dtrxmpnu1aexn fcilsfsDul(vpn(4tltrio3oadla r uvs;s  eumim3ou4lp   fvt tf rtaum ;t4optnmociydlm rm(ms;(0 rtrxfcoydopD luvils0 rur(o3no1lpee fvsl()s2ta(root1aeto fetadfs2rau o (0 rtnmrcto1la raieols0trurimpnu1ol  mict ()sDururpnu1tpx io3iydfs2ea(ms;t)trxnmf ia1fmtrlu s (0texmxrpiydllteliesls  rtr(m ou0opx ioeiytls rl(vo;u0aexrir oydla   i olt0srtmimpoydalte fcs s) Dtaxr nt0tex micildfs rmuvo;(4arenxo iytom   iesls0teumxmpoo1openlieia(  2rmuront1tltoiiciasfs ean s;t4aeeoxfciadfmDrlneo ( sexmiopny1oltemnei sfsrra(mono4alt mfeias aDeanvon(0tetrxrciotfat lnvilt0 2ur(mpoudopt mnct t  2rm(r ;o0oeto ietatfm2ua(msn(4aetnio3totlaDrlueo s t2trxm3iy1lpenlnei (  rtmxmp;o1oeenmo3iatls rlu s;t4trermr3ia1oa elues;t  eurim iydolt livs (f 2umxrooo4olenmociyt m uanmpn()trtnxr3oy1op raivslt0s2urimpio1lltelnvil(farumx ooo0tpenii3iat s emumo u) lerxf3oadopte uvi (0seumimpnudal   iei s)arrrxrono0oexomf3iytfa2ean s t0 etnmo oo1oaD aivi;() 2urxrpoo1lp nlnvi (fsrua(mpou1texn ieilsfs2em(vo;(4aexomr oadopD ai i;()s2tmir3iodlm emfvt ()a2taxmpou1olt ifciytls ra(ms u) ltriocoydop   n o;s tetoirpio1lp elicsl( a2ra( p;o0teeoioeildfs2rmn ont) lxomo iadoptr nes;()trtrirpnodopen iet tf 2trxm oo4aexoio3tld m raump;()aexnxf3iadoptelu i s0 exm(m iu4amt mnctlsfsDtm(  no1oltomi3iatfm uauvo u)trenio3to1laD livilt s2to(m3oy4lm  mfcsas  Dtrump;t1tltoiictydls2el(vo u)aexrmf oadlptean il()texm(opoo1alen nctlt sDurumono1olen ociat a ranmo (4altrir oy1fptr ivs;t  rurir3ou1opte fci s)arrm( oot1apeoif3tasfm ua( sn(4teenio3ta1fmt li ils)trur(m nodopt lnvtlsfs2ta(mpou1alxomfciltls2eluvs () rxnif3oy1fm e u o;(0 rtm(r nu1op  mivs sfsDtr( onu0tleoii3iat s2elu s;u)texoxf3oo1lpDraues (  rxmxr nudlmtnlivtatfs2raxmp;o1aptnmi3iatfm rmumpnt) etnmfciadfmDrlu i ( s2xoxrpou4llenmfvsas  2tmurpnt0tetomfeiytfs uluvp;t4treoxo todlm  li i s)trtmiopnydol elfvsas)arrm( o;t4altnio3tlt mDemumo u)treomf iytla eln slt  rxoxr3iu4lpeeliesl()aDtruroou1apeomf3tadfs eanvp t4alxnir3oatfpte u s (  2urxm3nudame  fvi s aDuru p;t4apt  i3tltls2um(monu) rxoxr tatlat lnei (0texoxm nu4apen ict t a2rax ont1tlx  fciatfa rln p t)alxriociadfaD an o (0texmim iu1llt lict ()sDrmxrpnu0tltn octatfmDel(vs u)arxrmo3ootfm elivi t  2tmio3iydal emnctat aDumu ont4tpeomi3tyslm2rmu o u4 rxoxf3iadfpDeau i s  eum(opoudllenmieilsfsrrmxmonu1tpt iieild a ua(ms;t4alxomo3iydfm raivo t0srxoir ou4lltemnvia()srtr(r oo4open o3ils m em(monu0 etomr ia1lpt  iei;s srxmim ou1om emiet (fa2rrxr ou1aexoiociat s el(mon(4aexrmoctodfmtrauvo t)t2tmio3no1lmtemnetl(f 2uau p;o4apeo ieiasfs rm( p;()tlermr tatfa  lnvo;t)t2xoxo ny1ll  lfetls) Dtm(m ;u4tpe  ictydlm rmu p (4 eermo3totoat luvs s srum(o3iy4ope lfesls)aDurumpnu0aetnmfciad a2uanvo;u0teenxocia1fmDeaueo;s srxrim iodomenmicsl() 2raur ;o1aexn oeiyslm emnvo (4 eeoxr tydfp eaivo;(0 ruoim iy1am n fvsasf rtau  ;u4olt mociad sDem(vs;t)arxrxo iy1opte ieil()teumxo3nydlmeemneilt s2rmxmont4tltn fctydfm2eanms u0 eeoir oa1fmDr nei (0texmio3oy4apte nvsls  Dtmx poo1alt iieils mDemnvo;u)treomo ty1lmteli ils0trtrir nydom   ivtat)arur(  ;o1texo icild a2ean s t)alermf iydfm eai i;t0srtm(o oy4al  lfcslt aDrmu  nu1olto o3iadfa2rm( pn(0 reriocoy1lm e ivi;t0srxrir iudomt mfvs t)sDrrum ;o1aeeo fetlsla emnmonu0 ltnio3tytop elneo;t0 euoirpiydlm emnvt s s2tm(mono4ale mocildfm um(ms u)trtnxoctadop  an slt)setm(r oudlpt mnvtatf rrr( pnt1tpenif3iat s2em(monu0tlerxrctotomtean s t  2xr(r3io1olee ivias sDta( onu4tpen fciyt s2eaumpnu4teermf3oadfpD livi;t  rxrir3oudlmeelfvs ()arum(rpnt1opxn ictytlm ea(monu)arxnxf3tadlpDr neo t0trumio iydlp  mnct t sDumxmo;t4tptnif3ias a2uluvo;t0trtrifcio1lptraneo;s0sruoxr nu4ll nlnetls)sDurxr ;o1teeomictatla2rlumonu0teeoircto1optrln i (0sexoio3io4lmee fcsatf Duaxm oo4opeoioetas a uau p;u4altoxf3todom rlnvslt0sexrim ou1omtemncsas aDtaurpno0opxoiictytla2ranmp () rtoif3to1faD lnei t t2tmxo iydaltnlivsat  rrmum ot4ole iocild aDea(vsnt0 rtrmo3tadfmDe neils trxo(rpiydom nmivs s)a2urxmo;t1oeenmfeias m ea( onu)teeoircootfmD aies;(0trtoio nu4ll e ieil(  2rm(r nu0aee ifetas mDum(vs t4tetnmf3oatoaDranes;s  rxmim no1omtelivsat)aDurx oot4teto f3iyd s emnvo;()tetnir oy1oaDrlnvs t0seur(rpnu1alt mncil() 2uaump;o1tpxn f3iyt a2eau on(4trenxr3io1lm eaiei;(0teuo(rpiy1altemncilsfsrtau onu4oeenioeiltls2ea(vp;u)trtrmf tytopD au il(  rur(r3ou1lltn ici tf rur( pnu4tlxnio3iytfaDranms t0trtnmf oy1fa elu s;()t2xmio oo1apt  fetls)srra(monu4tlen oeiadfm elnvpn(0aeermr3oy1lm r ivils)texm(m3oodale  fvt t)aDrru  ;t1ape  i3iyd mDrauvo (0trxnxociydlm raieo s0 2uo(o iy1ame mfvtl()aDtru pou0opxnmoeiatfa raumont)tlxrmo iy1latr n o;s)tetr(opnydape  fct s  Dtm(mo;t4olxnmoeild s2um(mo;u0alxoif oytop  ai ils s2xr(o3oo4amtnmfvsa(  Durxro;o0oet ii3iyt m2eluvpnu) lxnmo3iatla rau s;t0seuoiopnu1lme mies t  Drr( oot1texo oetatlaDea(vpnu) rtnio3iatlp  an ols0s2trimpoudlmt  nctat)a2urur nt0alx  icils m eaumsnt4alxoxr oo1laDe uvs;s)srxo(o nudlp e fes sfs2rmu  ou0altomo3iat s umnvpnt0 rxnxocoo1fateln slt)teumir nodll  miet () Drrurpnt4oleo fciyt a ulu p;t0trtnircoytlatean il(0t2to(r iydope mnvs s)srua(rpou1opto ictlsfa2ul(vp (0arxrmf3ia1fat  iei;()texrxr ny1al  lfcs t sDrmu pno0altoif3tytfs em( pn(0trerxr3oa1fmDraivs (0trurirpoy1amen ieta(faruaur oo0tptn i3tatlm2uanms u0treomr to1lmteauvi;s0trurim3iodalen fetlt)aDurur ou0tpx  i3tyd m ea(mp (4trxnxoctatlm eanvs;t t2umxm3oy4apenmivslt  Duru oot0opt mfeilsfmDum(vs;u) reoxr oytlaDe uei t  2toxr iy4ll  lfes tfs2rrumpno4olx ifeilsla rmuvon()alenxf oodlmDeau i t0 rto(o3oo1aptnlnvsat srrax pnt4alx iictadfaDrl(vo (4 etoif3oydfmDe uvs s0 eurxmpnu1amee fvtlsfartauronu1apxo fcilslm rlu ont4altrxfctadfmt  iei;()s2urim iodapt lnetlt arururp;o0tptnii3ildlsDrmuvs u4trtrmocoodfmDranesls srtoxmpnu4omenmict (fsDtmumpoo0ape  o3iasls eanvsnt0 lxomr3oydfpDeau o;s t2xoim oodap  livi ()aDuru  ot4tee miciatfsDra( ont4treoxf3to1lmteln s () rtmio oo1alen nesat  rta(r ot4alxo ieiad s2emuvon(0 etoxr3oydla elneolt s2tmio3nudomtelicsas)aDraxrono0aeenmi3ilt mDrmnmpn()altnio tydlpDeln o s t2um(o3no1am   nvtat srrm(roou4tpen feiytfaDea(vsn() lxnmf oa1opDr nvs;t t2xr(o ou1am n fvilt)a2taxmpot1optoifciydfa2rlnvp;t)trenxr ootoptrlueolt)s2xriopnydal  lfct s  ruaumpou1olxo i3tydlaDea(msnt4aetnioctytfp rluvi;t setrxmpnudole  ict ( arrm(  ot1apx mieiaslaDul(vp;u0altnmr ootopDe n o t0t2tmir3oy1lptemnvsat) Dururonu1tltniociytfm2rl(mo t) rxnifcty1fp rlivslt0teuo(opnodape  ivi (f Dtr( ooo0tex mfeiasfm emumonu0aexnmf iytlp raivo s)setmxm oy4lm   ict t s2trxro;u0tet iietlt s em(ms;u)teermrcoy1fp e ivolt seur(m oudamenlfetat  rtm(mpot0tpe iictyd s rlu onu0tltnir3ootoateln o;t  etoio3ou4lptnlneia()arur(rp;u0tlxoii3iytlm2rl( o t)trxomoctotoa   i s s setr(rpoo1lp e fctl(  Drm(rooo0ale ii3iyslmDem(mo u4 rtrmrciotomD livs;(  2tr(m iu4lm  liei (  rrmu ont0opt moeiydfm ulnmo;t4 lerxr todlatranvo;t sexm(o oy4llee ics tfsDum(m nt4aeto o3iasfm uau o;(0 lerir3iydfmt aueols  etrir ny4lm nmfet t a2ua( p;u1tpeomfctyd aDumumsnu4texrmfcio1latrli sls)srxmxm nydlm  lictat a2ua(mpot0opxo oeiadla um(mp;u4arxnmo3iydlp rluvo;t) rtoiopoo4optn icsas arurxm ;t0apeoif3tlsfs2elnmsnt0 exnmrcoodlptr ueils trtoxr3iu1omt  iviat  rrr(mont4opt ii3ias m uaumo;t)arxnmr3to1fat luvols0srumxrpnu4openliet s)artrumooo4oeeniiciydfs elnvo u)texoxr3iytoaDrlueo;(0 2xr(m3oo1ll e fcilt) Drr(root0aleoif3iys sDelnvo t) eermr3oo1latrlivi t srtrio3nodoptnlfeia(f rtm(mpot1tlt micildfa2ua(vsnt4tetnifcoatfm eaivo;t0tetm(o3nu4omenmnet s)sruaxmp;o0tetnif3tldfs2rluvsnt4trtnmr3iydfat livslt)s2um(m3ny1lm nmiesa( aDrrx poo0ale mieiys a ulu snt0arxomf oo1fmDrln o (  rur(o ny4ll emnci ()arumurooo0oex ifeiydfs ranmo;t4 reomf3iadlatranvo t0 rtoim3oy4op n feil(  rrm(mpoo4tex  ictadla2emu o t)alenmr to1laD luvo;()t2umxo3oy4am elivtl() 2rmxmpou0oeeomieiyt aDemn p u)tlenmf tydop rlivols trxm(r3nodlmt  iet s s2umxr oo0aptn f3iysla ra( p;(4 renxo3to1laDelues t) eurim oy1amenlneias sDumxr ;t4apxnif3iadls2rmnmsn()alerir3tytoa  anvi;t  2urxm3oo1llenmivsas) Draurpno0aptnmictldfs2rln p;t4trxoif3to1omtrlivolt0s2toimpnu4ope  iei t) 2rmxm nt4olx  f3ildlsDrmnvpn(4alxomoctatfmDraivil(0teuoxr3nudam n nesls  Dtmu  nu1ole mo3iltla ea( pnu4aetrmf oadopt ln i;s0srtoxopnydomenmies (  Drmu oot1tpen oeiyt a ranvo;() eenmfciytlmteaivs t)trxmxmpnudamen fcs t)s2ua(r nu1tpen f3tltlsDuluvp;(4treoio iotomDrluei;(0t2umxmpnudame  ncil( a2umxrpno0opeoif3ilsla2ean s;u0trtoio ootoatraieil(0 2umxo oodlpt lfet s)arrrxm nu4apxn icildfmDel(vp t4 eeomf iydlm r ivo;s0s2ur(r iu1am e fcs tfsDuaxmono1tptomfcildfm ulu s;(0tlxnmo iydfatrlnvil(0srtr(o3oo1amtnlietl( srtaurpnt1oexnmi3iys m2eanmpnt4arxrmo3oodfmt li i;s)s2xo(m3nu4ap nmncia( srtmu oot0tlt moeiatlaDrau p;() rermocio1omt  ivi;s srxr(r3oo4omeelfcs t)s2umumooo4apxo iciytlm2ranvpnu0 exnio iodfp r nvils0s2urimpnu4oleemivt s)s2ur(r ;u4aexo oetydfm ulnms (0teenmocoytoa rlnes s  2urxr nodlm n fci (fartr(mont1oetn octat mDuauvpnu) eenio3ty1laD lu i (0 2urirpiu1ol e fci (fsDtmu ono4aeto octys m2ea(monu) exnmfctotlat  nei;s srur(r iy1lptnlivt t) rua(  ;t1aet  oeiysfsDrauvs;u) etrxocootoa ean i () exr(opoy1lp emfeil(fsDrmx  oo1aexnmf3tydfa rmuvo u)alxnio oo1lm rlivo;t  rxm(opoy1lmtemfvs t) Drmur nt0optnifetlsfa2raumo;t0alxoxf oytfa  lnei t)teuo(opnu4optelicilt  Dtaum nt1oet  f3iadfa2elnvs u4areomr totfmtelueo;t0srxm(r3iu4op nmncsatf 2umuront0tpxo fetatfs ua( s;(0altomf3oodlaDe u s () rtmxm3ny4alee nvias) Dtmumoou1open o3ilslm rmnvo (0aexrio iydoptrlueols  2xrxo3iy4ap n fcsa(fs2rrxm ;t0aptnii3iyd a rau snu4altnxo3oadomD lneo;t)t2xoir3oodlmenlfeilsfsrrr( o;t4opxo ictldlm2em( on() reoioctydfatraiei;s srtrxm oy4lmtnlfvtls aDurx oou4tlxn octydfm rmn sn(4 reoxocootlm e u s;t trxrxr nudlmenmiciasfsrtrumpno0optomfciysfa2rmnvo (4tlxrir3io1lmDe uvolt  exmir iudape lieil(fsDur(  ;u0oeeomf3iydla2elnvs u4 reoxfctotoatelivol()seuoxo3iy4am  miet tf rrm( pou4olto oeiytfmDeanmpnu0texomf to1op r ues ( s2tr(o ou1al elnvslt)s2um(rp;o4olxnio3iys a emnmp;u) rtrio iadfmDr uvsl(0s2to(r3nudaptemietas  rra(rpnu0optomi3tltlaDran pnu0aexnxr3tydoaDrau il(0t2xoim iudomeelfcsat  2urxrpnu0alxo f3iytla2umumsnu)altoif tytfptrluei;s0s2trim oudll nmnvtltfsrur(m ;t4tet  ociltls2um(vp t0teeomfcoodopt li o;t) eurio oo1ome  feiasfaDrrumpoo4tltn ociltfa2ea(mo (0 eenmr oadoaDrln o;s)tetrxm iu1ame mncil( a2um(  ot1optn ietad mDumu snu0tltnmo ia1fatraivsls0tetrxmpiu4lpteliesatf 2ua(ro;o1oetoiictls mDrauvp u)arermrcio1omt  uvo;t0 euoxm iudomenlfviltfsrrr(ro;t4oleoioeiysfaDumnmo;u4 eeoxf tytlmDrlivi t0 2xrirpou4apt lfetls)aDta(mont4tltn fetys m2um(mpnt)altnifcia1fmtelivslt)setoxmpiodlmenmnvt (fsDrax pou4ale moeiys m2rl(ms u) ltrxr3oadla   n slt s2uo(r3nu4amenlics sfsrra(m no0tpxn fcildfs raumo;u4 eenmf3iodlmDranvs (  2uoxm ny4ame lfvs ()sDumx poo1aetn fciat m ranvo (0tlenxfctodomtrliei;t0srxrio nydlp emieiasf 2tmx ooo4oleoio3iadfs rl( s t0 reniociatlmDelnei t)s2toxm3iydolt lfeia()srrrur ot1oleoiietas s2uaums;(0texomr3iotlm rlnvs t  rxoirpoydlm elietat sDrmxrpnt1optomictydlsDemuvo ()aexrxf3oatlpt auvi;s0s2xmxrpoy1ap nmfviatfs2rr(mooo0tpe  ieiasla um(vpnu0tetnmo3oydlateln o (0trxmio iydlp   ncsl(fa2rm(m no0oltoioeiadlm umu s t) ltomf oatfpDelueo;s srurir3ou1lmtn ies tfaDtaumooo1alt  o3tld s rlnvpnu0 rtrircoo1fmD  u slt) exriopnu4lm emnetlsfsDtmxrooo0texo ociad m2uauvonu0 etoir oydfmtrlivo (0t2tm(rpio4amenmncslsfaDuaumo;u4aetniiciaslmDrmumo (4alermr ootfa rau i ( s2toim3iydaptnlivil()s2um(  ot4apto f3ias m2ra(mp;u4artoir3io1fm rai slt sexr(opou4op   ivtasf Dum(ronu4tpeniieiyd a ua(vont4tltoxf oy1latr n ilt) exmxm3oo4amtelfetat  Drrurpoo1olenifetldfmDrmu o;u)teermrcoodfmD luei s  2to(o nydomtnlict t)s2tr(mooo4tpenifetyt s2umu s ()trenio ta1omte u i;t sruoxopny1opeelicsl(farum(mp;t0tetoiictld a emuvsnu0tlenxfctydop   i s;s0t2umim3iydame  fctltfsDum(m no1ale ioeiyt mDrm( s u0tetoiocoydfpDrliei;t  2tmirpoodop nmfvtltfs2raxrp;t4apenifciatfs rau o;()aeeomo3iydoaDe ues (0sruoio3ny4lp n fct (farrmx p;o1openii3tadfa2eanmsnt)aetnmr3iy1fat lu ils) exoxr iydole mivslsfa2rru oot1aeen ictlslsDuluvo t4artrmf oydoatr nvolt0 euoxr iydap n ics t srrr(ro;o0tpx if3iytfa emumo ()teenircoa1omt lu s;t)sexoxr ny4olenmies ( srururo;o1tetniocils a umn p u)teeoxrcoy1fm  au sl( seurxr3nydlmee fcs sf Drm(r ou1olt ii3ildla eluvp;t0 etnio iodfpD ln i;t s2xm(opnydom   feilsf 2uru  ;u4tpe  ieiad s2ua(ms;u4arenir iodomteai i t)sexmxm oo4op e ivil() Draxm nt4ope miciat m ulumo;(4trtrmocty1lmDe ivs s0 eurxm oydoltemnvtas)sDur(r ot0oet  i3iytfs elnvp t4 eermf3iydlpt  u il( s2tmxm3nydomt  fvi s  rtr(mooo0oee mieiatfa2ulu ont4 renxo3iadlmDe u i;(0 euoir3iu4aptn nvs ()srta( o;t0apeoioctas s2rm(mo (0 lxnxo3io1om  an i s0 rtmir3iu1oltn fcta()sDuaxmp;o0alxnio3ils m rm(vsn()altrirciatfpD au o s)srum(m3ou4alt mnvils  rtr( o;u0alxo f3iydls rmnvpn(4artnxociy1la e ueo (  2xrir io4ap elnet s)sruaxrpot4tpeo o3ias a ranvonu4 renif3oa1fa  anvo;s0 eur(o3nudlle  fct t) 2rrxmp;t4oeeoioctatfm ul(ms;u0tleniocoatlmD lneils)s2trim oy1apte fcsls aDraur ;u1oexo feiyd s2uau pnt4arenif3oy1fpt  ivo;(0 2tmxo ou1ll  lfvia( srtmx o;u1olx mf3tltls2uan s u4texrif todlmD li i (0s2tmiopoy1lmt  nvtls)aDtmx o;o1aexoioeiytfs2el(mp;u)arermf3io1op eanvslt texo(o3no1ap   fetlsf Dtrxr ;o4texn iciltlmDulnvo (0 lxnmo oytfm ran i;()tetoim oy4omtelncslt aDur(m nu0aleo i3tatfm2rlnms (4tltomr iodfpte nei t  eurxo iudlm nlfcs ( s2umxm ot1apx mf3iytfm2ranvs;u)tltnmr totlptean ilt sexrxo iy4al nmicsatf 2ur( pot4tle  octyt s umnmonu)aexrxocoodfpDr i o;t)s2trim3oudal  mfvs s) rtr(rpnu0opx mf3ias aDum(vs (0trtrmf to1laD  ivi () 2tmimpou4oltemicsa(faDuauronu1opx io3ildfs2ulumpn(4arenir3ty1om eaieolt0 2ur(mpiydol elncslt)a2rax onu1oet  ictltlm2elnmo;t0altriocta1latelieol(0 2trim3ny1ole lfvsl(f Dtm(m oo0tle  o3iys s2rmumonu)trxoio3iy1faDe n ilt) rxrir no1amtelfci (  rtrxront0ole mo3iytlsDul(vo;t)areomrcoadlm eauvs;()sexmimpnu4lp e fvi sfa2ta(  ;u1tee mo3tat a elumsn(0 leoir3oo1om r nesls0s2uoio3oy4llt mietl( srrrxro;o0aetn ocild a2rl( p;u)artnxf to1la e uesl(0 rxrirpnu4omt lnvi t  2rr( o;o4tleo ietasfmDem(vo;t4alermocoadomDrlu i;s)s2to(m3nu1optemivsat)aDrrxrpnt1tee if3tytfa rlu s t0 eenmrciytlmteln s;t  euoxrpoodaptnlnetlt)aDum(m ot1tee mieilt m2ulnmo;() exoirciadom rlneols0 etm(rpnudlmtn ici tf Dtmxmp;u1tetn feiytfsDemu p;u)arxnir3tatfptrlnvs ()trtrirpiu1altemiesl(fs2ta( ooo4tpen iciat a eanmp;u) etnxo3iadlpt  u o;t t2tm(opiu4lp nmivtat arra(  ;u0ape mieiadlsDemu p t)tetrir3totoa   ueilt sruo(o io1llen fvils srumxmono1aee  oeiysfm uan snt)aetomociydfmDr n i t)sexmim3iy1ap   ncia()aDrrur ;o4optn i3tasfs2ea(mp (4arxoir iadlmteluvo (0s2xoir nodll emncsas)sDurumpnu4olx  o3tldfm eaums (0artoif3oatfpt  ivsl( sexm(opiu4apee ivi s)s2trumono4tee  ociadls2ea(mp;(4 etnmrcootop rlueo t0t2uoim3io4lpeelfvs tf rraxrp;o4oeen o3iaslaDul(vsnu4tetrif3iodfateauvi () eur(opiy4olenlivt t)sruau pou1oltn oeias sDeanvo;t4artrxf iydfaDe neo;(0 2tr(rpno1lp n ncias)arurur ;u1tptoiociyd m2uaump u0 lxoir oy1lp eau olt0srxo(o3iu1ame  nvs tfaDum(mpno0tptn ociadfsDem(vp;(4alxnirctodfa r nvs;s t2toir3ny4amtemicsa( srrr(mp;t1tex mo3ildlaDrm( s;t4texrxo3oatfpD lnvsl( s2xm(m3iu4ol  mnctl(fa2ua( oou0oetniiciad mDeanms u4 eenxoctotlaD an o t  eum(o nodlp emfci ()s2rax o;u0oex  ieiadls2uaump;u4alxnxrcoatomtraivi ()s2toxo3ou1lp  mfcslsfsrumx pnt4aetnmo3ildls eln s u)alxomr3tydfm eln sls sexmiopoodoleemnvsa(f rtaxmp;o0oleoiictas s2rl(vs u0tetoircio1oa  li sls  rtoir oo1ope  nei () Dtmur no0aptnmfeias m rlnmo t0 rxomf tatfa e ivs;t)texm(rpoo1amtnmict ( a2trurp;t0aeto o3tldfaDeaums () lxomr3oydlat luvols0 exoxm no1lmen nci (f Dta( ooo1aeeo ieils s uauvsnt0alenif3oytlate nvi;s)srumxopno1al n fvslsfaDuauroot0opeomictad m2eln p u0tetrmr oadfmtraueolt)srtr(opoo4apeemnci ()s2urump;u1opt ifeild s2rmu p;() reoxf3oo1latelieslt0s2um(rpou1al nlfvs sf Duaxm ;u0olen feiytlaDrau p u0 etrmo3oa1omD  neo;t t2uoxrpnu1altn fvsl(fs2tmu oot1aet moetydls eluvs u) exrxr io1fmteai i t srumirpoudopeelnesls)sruauroot1tpt  fetldfm emuvp;()trxnio3oydfpD  ivol()s2xoio3oy1lltnlnvta(f rua( p;t4tpt  ieiaslm2ul( on() lerxo3iy1lpDr nei;() 2xoirpou4lpenlict t  2um(mono4tet mfeiadfm2ra( p (0tlxnxo oadlpteaieils)texoxopoo4llen icsasf rtr(rpoo4aexnmiciydlmDrluvpnt) ltrmf tatfpDr ies t t2xmxmpnu1amtnlfeilt)a2ur(m no0opt mi3tlt s2rl(mp;u0 rtrifctydfm eln ils0seum(r nu4ll  lfvsa( sDtau pot1opt mi3tasla2ua(ms u0teermr tadoa rlivslt)t2xo(opnodlp nmncia( artr(rpou1aex  ieiad s umu p () eermr oadlmDrln s;()s2umio ny4am emfeiat  rurur ;o1apt micilsfs2rl( sn()aexoif oytlaDraneo (  2umir3io1oltnmivt t  2um( ont0apxomi3iys s rmu o t)teeomociotlmtrau o;(  2xmxrpiu4lltelics () 2umxmo;o4tleoii3iydfm em(vpnu0 lxoxr3oadopDeau i;t  2xoiopiu1llee ies () Duaxrpno1oeto oeiadls2eauvpnu0texnio3oadoa  lueo;t0t2xo(rpoy4lpee fctl()a2trumo;t4opx ii3tyslm2rau o;t4texoxrctytfpte nvo;t t2xoxopiodom  lncia(  rrrurono4olxomi3iys a2ulump u0 ltnirctadomDrluesl( t2urir ou4lp nlfcsatf Dumumpot0tee  ocildlaDea( p (0 eenmocoy1lp   ivsl(  2toxm nydame mnvt t) 2rrurpoo4apeomo3iad a2eln s t0artoxrciadlm eaies;t  rumio iy4am e netltfaDtaxronu0aeeomo3iatlm2ul(vp u)texnir3tatfp  aivo t)sexrirpoy1amee nvs ( a2umxr nu1tltoiieiltfmDuanmp;t4 exnxf3oy1oa eai s ()teuoim3ou4lmt mivtlt) Drmu pou0texomoeildfmDua(vpn() ltrio iadfmDr uvs (  rto(mpiy4amtnmfciltfarrr(m ot1tlx  ictytlm rmnmo;()texnmrcoatfp elnei;s) rxr(r3iy1lle lici tfs2ta(  ;u4aee ioetaslm2uau o () lxnmfctydlp eaivs;(0srtmxm3iu1lptelfeiltfaDrm(m ;o0tpe mo3tlt a eau pnu0artomo ta1lmDe uvilt0s2xoim3ou4om n fctl(  rtmump;t4tpenio3tydfaDumn s;()altomf3oatop  auvi;s)srum(m3ny1omte ieil(  2rm(moot4tleomieias m2eau snu)tltniocootomDeau s;s  rxoxmpoudlptn ivtls  rumurpno1aee mf3iltfs uanvo u)tetrxr3ty1oaDrauvil( seumirpio4lm elncs s)srra( pnt0tlt ioetatfs2ranvonu) reomr oatlp ranvs;( trtoim iydale lfct s  Dtmurp;t1oet  ociyd s2ua( p;t4trerircootfaD li ilt  etmim nu4apt  ieta( sDtmxm ;t0apx mictlt s elu o;()trxoxo3oo1lm eau i;s0t2trim iodlmenlnvs t)srtmur oo1tltomfcias a2umumo t0 rxoxr3iy1omD lnvi s)s2tr(r oy4ll n fci ()arrmxm no4oexn f3tltlm rlnvs (0arxnirctadlpD  nvs;s)sexmio3oydolenmivsa( s2rmum ;o1tptoiietad a2ea(mo;u0aeeomo3to1fpDrlneil()sruoxm nudal nlfvi sfsrraxront1tlt ifcildfmDeauvo (0trenxf io1opDrlueo;s)seuo(rpno4llte netltfaDtrxrooo1alen fciyslaDrm( o;u0 rtnmoctotfmt  ivsls)srurir3iodlm nlncta()srtrx pnu4oet  f3tadfm2ra(ms u)aetrioctatlmtraivs s  2uo(m oudlmt mnvsltfsrumu  ou0tltomf3iytls ulu o;u0 lxomociotlpDeai ilt trxr(m3iu1open fct (  Dtmurpou1apxomo3tlsfaDrln pnu) exomf iadfmtr n i;s)s2umxo iudlle  ivsat s2tmumpot4oexo fcild aDuanvo;(0tlxnmf3ty1lpt ai o;()trtoimpno4ap e fci ( aDumum ;o1tle ii3tydlmDrmuvont0trtnir ootlmDe n s;(0s2tmio3iydlm  lfvi () Dra( ono1apt mieild a rluvp (0tleoio iydomteaieol()srxoxr3oy1ape mivia()a2tau  ot1tpeo fciyd s2em(ms t0aetrxo3iadoptean s s)t2urir3iu1lmeemictlt aDrm(m ;t4texnmfciad a2um(monu0aeenmf3oatla eanvsls  rto(o oo1aptnlivs s)s2rax pou0tpx mo3iytfmDuaums (0aeerxo oo1lmt anvo ()s2xmxrpiodlmtelietls)sDtrxr oo1optoio3iyt m2umuvpnt0 lermrcoydlmDelues ()trurxm3ou4opt mnciat) 2taxro;o4aleoiictlslaDrm(mo;t4aeerio oytlmD  iei s)seumxmpno4oltemfvsat)a2tmxmono0tpxo ictlsfm2ea(vs;(4aleomf oa1fatran o;t)t2trirpio1llt mnvslsfs2uaxmo;t4oet miciydlm2emu on()tetnmr3ty1lmD lneslt0 exmxrpiudom nmfvia( a2taumo;o4teeo i3tytlsDumnvp (4 lerif3totfm  aneil() etr(m oo4lpeemnciat s2tmx o;t4oex mfeiasfs rm(vsn(4 ltrioctotoa elies;t)t2tm(o3oy4lm nlnes s) 2umu  ;t4oet mictad sDea(mp;u0aeermf ty1fptr ieilt0 rtoio3iodamtemiesl() rrmumo;u0tleo ociys s elnmpnu4 ltrxocta1fmtrluvi s) euriopnodapenmfes t sDtaur nt1oex mi3iltfs2rlnvpn(4alenmr3oytfptrauvsl( t2uriopno1om nmici (  rumumpoo4open o3iltlmDeau o (4tetrirciodfaDeluvo;(0 etrxo3nu1om   ncsas aDur(root1alt mi3tltlm2uanms () lxomf tytlmDe n i;s)texm(r iudlmtnmncs t) Drm(mp;u1alt mfeiaslsDrmu o;u0trtnmf io1late ues;t trxo(opny1lm e fvtasfaDuaxmo;t0oetn fctls m umnvp;t)altnxo3iotoatrli i ()trto(m nodamtn netlsfaDum( p;o4apx mfeiltfa2rluvo (4tetrio3ootopDean ols0t2xmxopoy1altnlicslt  Duru p;o1apxn fciys sDra(vp;(4 etnxo ty1la  ln il( t2to(o3iydamtemiciltfs2tm(rp;o0oet  fciydfsDua(vp;(0 eenxf ta1lmDr nes;s0texo(m3nydal  lfvs s artrxronu4aetoiiciyd s ra( pnu4teeomfciy1fmteauvo;s)texm(m ou1olt  nctl() rtm(  ;o4olt  i3iltla rlumpnt4 lenircoatopt aivslt  rtoxo ny1lp e nvilt) Dtm(rono0tpxnmictldfaDelnvont0tetoir ty1fmtrlueilt)setmxm3iy4amtelnct tfs2trxm no0opeoif3tysfs2umu pnt0 rtnmf3iy1oatr nvsls0s2tr(o nudamtn iviat)s2trxrooo4oee miciltlmDulums t0tlxrxr iydfp   i o s0 2urxm nu1ale lfetasfa2rr(mooo4apen f3tldla uln ont4 leomfctatfpD  ivs;s trtrxr iu1olte ictas  2rmu poo4alx  feildfmDeln o;t4altrif ta1oaDr n sls srxrirpnydamen fctas  Drmxr ;o4tpt iiciasls2el(von(4 exrmr3oydomDe nvi t seurxo3oydam elfvia() 2urxmoot4olt mi3ias mDua(msnt)texoircoa1oat lueol()trurxrpiy1optemiesl()srraxmp;t4aleoiietltfa2ul( s;t0 etnio iy1lmtelneslt0trtrxm3iy1olt lncslt s2rm(ro;o1aee mo3iadla eanvs;()teeoxf ia1opDe n o t)srumio3iodomtn nvia(fsrtm( o;o0tpe ioetaslm2umnvo;t4 lxoxo3ta1fmDrlu s t)srum(opoudlltn fesl()arraumoot4oltn o3iysls um(vo t4 rxrio3iytfpD auei;(0s2um(r3ou4alte ivi sf 2ta(rpou1tlt mi3iadlaDrmnvs;u4tetoxocia1fmDe nvslt t2ur(m3oydapenlfcs ()aDtm(ro;t4tpt ifeiydls2rmnvo;u)artoifcia1omD lu slt  rxoxr3iydalenmfcsls sDrm(mpnu4oet  fetlt s2rluvont4 eenio iotfpteaieo t teumxm3io1optnlfetl(  rtr( poo0opto fcilsla rmnms;t4treomo3tatlm rai ils0truo(m3oo1am  mfvs (f 2rrum ot0oet  i3iytfaDul(vp;t) exomrciodlmtran s;s0srxo(o no4alt mfeslt  Duru oou4tlxniocilslsDrlu snu4 exnxr to1lpteanvo t0trxoim io1omee fetat sDuaxmpou0oet io3tltlsDeauvs u0 rtrmr3tydfmteli s ( seto(m iudop elncsl(fa2trumoot1altnmoctadfs uluvp;u)trxoxfctydop  auvil()trtoir3iy4lltelfvil() 2um(moot0texniietytlm el(vs (0 ltnxf3tydlm e ueolt t2xrir iudllee iviat srrr(m nt0ope mi3iatfsDranmsnt0 reoiocoatfpDr nvs;() 2urxo ou1ap   ivt s  rrr(m ot1tpt  ieiasfa2em(mpn()tetoxfciytoaDr i sls  rtm(r3oo1lp e fctl( sruax p;t1apxoiictltfm em(vs (4arxoio iotoaDraivil( srtmxm iy1aptemfcs tf 2rmum ;o1tltoifctldfa2ua( o u0altoif ia1omDeln s t) exriopio1amt lfci t)s2uaxro;u4olto fctatls2ua(vpnu)artoxrcio1faD  nvol( t2xm(mpoy4lpee ivtltfsrtax  ;u4oeenif3tytlsDea(mo t) leomrcoadlaD  ues ( seurio3iy4lp  mnvi s arrru ont1alx mi3ildls2rlu o u0 exriocoa1oa rlivs s0trur(r nodlmt mfcia(fs2ra(mpoo0aeeoifctatfs2rm(msnu4tetnxr iatfpDeai olt) rtrio3iy1lpenmnci s)s2tmurpnu1altnif3tadls2rl(mon(4aetnmr iotfateaivs ()t2xriopiy1lpenlfet (fs2rmu pnt1tlxn o3iyt sDul(msnt4aeenifcta1lmDrlneo;s) rxr(mpiy1lpeelivilt) Drm(ro;o0tpenifetldls2rmumont)aexrmo3iy1fm elueo t  2xr(opoy4ome mfesat) rururpoo0olxo i3ias sDuan sn() eenmr ty1lmt au sl( sexm(o oudlptelfet t  rtm(ront1oleomoeiatfmDrauvp (4trenmr oa1la rlivo;( seuoio nu4op   nvtat s2ta(mono4oexn ictlslmDul(vo (0 leomfcoadfmD livilt0srtoxm no4aptn nesasf 2urum nu0tpxn i3iasla2ea( pnu)alenxr3tadlm e uvo;(0texo(rpiu1lmeelivi t)a2ur( ont1tetn o3iyd mDrl( o;u4trtomr3iytfmt  u ols)trumirpnu1ame lnei (fsrumxm no4tlx  icilslmDrl(ms t)texomo iodopD auvs t s2tmxo nu1lmtemieia()a2rau  nu4aee mo3ilsfm2eanmsn()texnio iodlptrlnvslt srumiopny1op n nvtat s2urumooo0olenmictlslaDemn o u0arenmo3tydfaDr n sls0truo(mpiu1omtn ivsls) 2umxro;o1oleo oetat aDranvo u)trxrircoydfate i ol( tetrimpno4lpt  ietasf 2raxmpno0ole ioetltlsDrmnvp;(4 eenxo3oydoat  ivo s0teurxo ou4ame  iesasfsDraxm ;u1tetniietytfs2umn p;u)tltoio oydfaDranesls  2ur(o nu1lmtnlnvi s) Dtrurpoo0tlxnmo3tldfaDraumo t4tetnio oodlm  livil( t2um(mpoodlmt mnciat sDuax p;u1aleo i3tatlsDul( on(0 rxrir iodomt lies;t0 rto(r oudlm n ncils s2tmum ;t4opeoifctadfsDrln on(4arxnxo3iodlmD aieol(0truo(r oodop  mivsl()sDur(monu1olt iieiyt a rmumonu4tleomrciodlaD  n i;()tetm(o3nu4lm n fetasfa2ra(ro;u0aleomoetyt m2ul(vs u)tetrmfcoy1fp eauei ()seur(o3iu4al  lnct s)aDua( o;t4teenmo3tltfa2elnmp;t)alxnxo3iydlatraiei ( s2uoxo ny1alt miet ( aDtr(rpou4aet  octldfmDrmnms t0 rtoir tydopt  i ols)seuo(m3nudamt mietlt)sDraxmpot1tptoio3iyt aDeanmsn()aetoxf iytlmtrliei ( trxr(o3nodopee ies () Dtau pnu0tlxo ietatfm2ranvp;(0tetnmr ia1fmteaueslt) exo(m3nu4lptnmfvtls  rta( ooo4tex moeiatfm2emn s;(0texnxo3oadoaDeauvols tetr(m3nudop emnviasfsDtaxmp;t4alx mociys sDel(ms u0 etomr3iadfmtraieil( t2uo(opoudoltnlnciat arrmxmpno4alen fcias a uln p;u4alxoif tadlmte u o;s) rxr(m3iu4lltelnvtas)sDrr(  no1oetnif3iydlaDrm(mon(4altnxr3ootlaD lueol(0seuoxo no1al   nct (f 2umx  ot1oetnmf3tyt mDua(msnt0trtnxo ootlmtr ivils) rtoxo3nudopen ietatfarurxm nt0alt mi3tatlm elump u)alermo3iytlaDran o;s0t2uoxr no1lltnmnvt s sDra( poo0alenmf3iltfm2rluvo;(0altomf3ia1opDraivilt0 rxrir3iy1ll   fetl() Duru  ;t4aeenmfctls m el(mp ()texoxf iatomtelieol(0 eur(m3iu1am nmivias artmu  ;t1ape ii3iytls2ran p;(4alxoio3tytlatrauei s0 rur(o oy4omtelncta(faDrm(r oo0alxnmoetyt aDrlnmsnt4 rtnxf3tatlpDe neol()trtr(rpnu4lp nmiesas  2ur(mo;t4aex  fetat a2eluvo u) ltnxo3tatfm elneils)t2xr(o iudlp  lfctls)s2rau o;o1tlx mo3tydfs uauvsnu4aeenxr3oatopteaueils  ruoxm3iu4amee neiatfsDum(r ;u1aetoiietat aDranvp;(4aetoif3oy1la rlivs;s)trurxo oo1lp  mnvtas artm(mpoo1teeomi3iasfm2emnmpnu4teeoifcootlptran s;() etmir ou1omenlfes ()srurump;o4tpeo o3tytls rm(msn(0tlenxf3tatomDe i slt)teum(r3no4lmtnlnes s)a2ua(rpnu1apeoiiciatfs2rl(ms u0aexnio3iydlateaieols0 2uoxrpou1olen feil(  rrruront1tet io3tydfa2eanmon(4 ltoio oatomD lnvolt)s2umir3io4ol e neias)aDta(m ;o0aeeomoeiyt a2umnvsn(4 rtnmrciodoa r uei s0sexr(m3io1ap  lfvs t  2rm( pno0tpeomi3iadls ean o;u0aeeniocoadlmt  uvs ( seto(r iydome  ivslt aruaxm ou0tpxnmf3tld sDeln o t0 ltnmo3oadlp  livsls) eurimpnydoleelfvia(f 2ua(r ;o0oleo i3tatlmDrlumo;t)tleoxf tadfpDr ivs;t  eumxr no1apeeliciltfsrrmx  nt1aetoii3iasls2ulu s (0altrmf tadomt lnesls teuo(opio4opeemfvia(  Drrx onu0apx mociat a2ra(vs (4alxnio todfateln ols) rtoxopiy1llt mieias)sruaumpou0oexnifcilsfa2el(msnt0tlxnif tytomDelnvs t  eurxm3oy1lpte nvslt) Dumu  no1oetnmfetlslm2eanvo;u0arermr ootfa rau o s0t2xmxr oydlm  lnet t)artmx pou1tlx mfeiydlmDulu o;u0arerio3oo1lm e nvo s0 2um(o3oo1lltn ics s sDur(m ou4apx  ictls m rlump;u4 etoif iytom elnes t)t2umxm3ou4apenmfcils aDraxronu0apeoifciatfm2ulnvsn() reoxf3io1fa eaiei t)trur(m oo4lpte ici s)sDrau pou0alx  ociydfa ua(vs (4 eenmrcoo1fa rau s;s0 exrir oudllenlfvil( srrr( oou1tpxomfetadfsDean snu0 rxrioctadlatrau i;(  exoim3io1ll   iviasf 2trxr no4oexn o3iadls um(vo (0teenxf oy1fp  anvsl( srur(r no1op nmfvs sfaDumur nt0tlx  feildls2ean o;t)tleniocia1opDrlivs;s0srtmxopny1aleelnvs ()sDuaumpot1tle mf3tasfa2em(vpnu0 exrmo3oydfa rlnvsls)tetoxr3nydlle mictls)aDrr(rp;u0tee mo3iadfsDrmnvpnu) lenio oatfm e nvslt teuoxo ny4ole mnct tfs2tau pou0aexn o3tlt s rm( onu)aleomocootlpDelieo s trtoirpnu1ap  lnesat)aDumxrp;o0tee iociltfa2umn s (4aexrmfctotfa  livo;( trxrir3oydole mieiasfaDtrxm nt0oex ii3iltlm2eaums;(0tleoxfciodoate neo;s0trxrxopnu4am elfctlt)s2tm( p;t4oee  ictadla ra( pnu0teenio3tadlmte uvilt0srtmiopno4lme  iviat) 2taxr nu0apxo ociatls uauvpnu4arxnxo totlaDraivs t0 exoim ny1lme  nctlt  rrru pnu4tpeo fcildlmDulnmont)arxomr iy1fa  livo t)srumim oudamenlnvi t) Drmu o;u4texomf3tysfm2emn s u) renifciydlaD  neo;(0 rur(rpoy4amtelnei s) rur(roou0tlto ieiytfmDea( s t0aetnio iotla rauvi t)trtmxm3ou1lmtelfvtasfaDraxmooo0tlxnmo3tldfm emu snt)texrmf3oy1faD lies;( trto(m3ou4amen nvi tf rua(r nu0tpto oeiadfs2ranmpnt4altnmr3oo1opDeln o;t teum(r3ou4aleemfcsls) 2rm(moou0altomfeiatfa eau o u)alerir iatlmt an i;(0seur(o ny1ome mivs t) Drr(mpnu4aleoii3tasfsDeaumsnt4texomo iydla rauvolt trumiopoy4omt  ieiltfs2uaumo;u4tltn f3iyslm em(vs t4teenmr iatfp rln o;(  rumxo oo4om emnesls)a2umxm ou1oetoii3iydla rlnmp;u4teenio ia1la eanesl( s2xrir3nydlpenmieilt s2umumoot4oeeoiietlsfm uau p;() ltnxf oytlp e ieo;t0texo(m oy4am  micils srtmump;u1ale ifcild mDeauvo u4 exoxfctadfpDr ivo;t  rtr(m3no1optemieiatfa2ra(rpoo0alt if3iadfa2rln p;t)tetomf3ootlpDrauvs t setrir nudlmenmfetl(f Draxmpot1apx mietaslm um(vp;u0trenio oa1late i sl()tetm(mpio1amenmivsat)s2rmumoou4aeenmf3iytls2em(mp u0 rxrifctydfm r nes t0s2tr(mpiydlmtn ncslt)a2tax oou0olto i3iad m2rlu snt0alxnxf iotfat an o s)tetrir3oy1lltnlncia(  rtr(rpou0apeomfcias a2ra(vpnu4aexrio iy1omDrlivsl(  rtmiopoy1lpt mncta()s2rm(ronu1aptniiciysfa2uauvsn(0tleniocoytoa e ivo ( srtr(o oo4lltelics s) rra(mpou0oexoifciatlaDemumo ()arxrmf3ia1lp   ieils s2xrirpnodol  lnvi t)sDrm(mpou1alxoiieild sDelnvo t0texnif3oydlp  li ilt)texo(m3oo4lltelfvilsfarraxrpnt1tpxn fciys aDran s;t)tltnxo3iatomtrli o;t)teumxm ou4lp nmivtat sDtmxro;u0oexn icildlm ulump () rxoifctodfm r uvi;() etm(m3iy4lp nlfct s  2tmumont0tleoii3iytls2uluvsnt) ltrmociodfmtean olt0 rtr(o ou1alenmfctls  2rrxr nt4aleo oeiysfaDeluvs t4 rtrif3oytoaDeli ols0teurio nu1ap emfct sfs2rmxm ;t4altn icildls rau o;t0arerxf3tatla   ivsl( teur(r oodom emivi t)aDtmu pno1tlenioeildlm2uan o;u)aetnxf ootop  aies t0sruo(m oo4ame mnctatfsrurumont0altnmo3tatfs2rau o (0teerxociadlaDe nvi s)sexoxm nu1ameelnci sfarraxmono0olxnifciatfa2umnvs u4artrxr to1fpDe i s s) rxoxm oydomeemics sf 2tmu p;t4olen feiytls uan p t4teermr to1fa  lu i;s) 2xo(m nu4openmnvt sf rumumo;u4aptoifcilsla eau p;u4teermr totomte uvolt0srxrio3oodopee ncilt arrru poo4texoifeiasls uauvs;t0artomf io1fp r nvs;s  2xrim oy1amtemnes t)aDuaxmp;u4oexoio3tldlmDel(von(0areomrciadfp ranei;s  rxm(r3ou1ol   fvtlsf Dtmx o;u4tleo octlt m uaumsnu0areomr iatoa  au sls)teurim iy4amtelietl() rumum ot4opxn icilt aDrmumo t4 ltomr3tadlatraivs;( tetmiopiudape mnct (fsrraxront4tlxn fctlsls umn s;(4alxrxf ia1laDr iei;(  2xoimpny1amtelfvsa(fsrtrx  oo1tex mfctydlaDua(mo u)aexrmoctodfmt ln il( seto(m oydomtemfeils srumxm ;o0olxoio3iasls2ulumsnt4tetnmfcoo1lmtr ivi;s) eurxrpiudlp   ivs t)sDum(m nt0tpx  iciytlm2em(vp;t4 rerxrciodomD  uvi;(0t2toxrpny1aptelfesat)srum(rpot4altomicils a2ra(vs ()aeenmf oytfmDeau i;s0s2umirpnodaptnlfes s)sDta(mooo4openio3iadfa2elnmo;() renif3tadlp rlnes s)sexr(m nudlm eliei t srtr(m nu1olxnmo3iys mDuan pnt0 lxrmo to1op elivol(  etrim oudopt  ivs ( s2uax pnu0opeomietyt sDulnvs;u0 ltnio3iy1lpDrln olt seur(m ny1apeeliesas a2tau  ot1opto oeiysls2ra( s t0trtrircto1fa   u o;(0trto(mpoo4am  mnetat) rrr(ront0alto i3tls m ulnms ()artnmocoydoa e i ols)trtoxm nudom nlneils s2ra(mp;o0tptnmo3tls a2rlu on(4arxnxr todla  ai i;s)s2xo(rpno1open nvs (fartm( p;t1tlxnmo3iasfa uauvo;u0 ltnmfcoodlate ivi s  etmir3iydlm  miet (f Dumu  oo1apto ictat a uau p u)trxrxo3to1fa rli ol() eum(opio1omt lnvsl()sDtmxmo;u1ope mfeiadls2uau snt4areoio oatfa e ivi t teum(r3nu1altemivilt sDra(rpnu4aeeoiociyslm uluvs u0arenif tadoa rln s;(0t2tmxrpoy1lmeelivt s)s2rrum no0apx  ieildlaDrl(vs;u0artoxf ta1lateln s;(0t2uo(opou4alee ictatfa2rrum ;u0teeoiieiydfaDum(vpnt4tetnifcoadomt ai ils0 rtoxo3no4lmeelnvtatfarumu p;u0oet  feiadla2el(vs t0aetoio oy1om ranvi;t) ruriopoo4ap e fvslsf Drmx o;t4alt ii3ilslaDuaump u4alxrxf oo1op rluei;t)t2tmio3ny1lpeemneiasf Drmumoou1tleomoeias sDrmu pnt0aexrmr oytfatrai s s) eur(mpoodome mict s)s2urum ;o0ole ioctltlsDumnmpnu0aeenircoadlpte nvilt srxrim3iy4lm nlnci (  Dtax  ;t1tpenmf3ilt s2ea( onu4trxnmrcoodomDr neo;t0trxmio oudlp nmivias a2tmumono1tpxomociatls ulu pnt)aetnif iatoa  auvo;(0t2xrio3iy1lltelnciasf 2trxront1alxnioeildlm2rmuvont)tlxnir oytlpDr u i t)texrxr oydoltn fes s  2trurpno1tpx mi3iadla eauvo (4 lxoxocoatlmD au ol(0 euoim3nodap e icta() Dumu  ou0aleoio3ilsls emn ont4arxomrcoy1fat  ueo s  rur(opou4alenmivsa(  ruau  ;u0opxoiieilsls uluvonu0aexrxf3iadopDrauvo t0t2xoir oo4alte ieilt  rtaxr ot0ope  ictydfaDrluvp;(4alxomo3totomtraueilt0 rurimpoodlpe  ictasfarta(mpou4apxn o3ilsfsDrln sn(0 rxoxrctydopDe nei ( sexmim3iy4lpt mnetls arurx ono1tpeoiietldfm rmnms () lxrifciy1op  li sls) rxr(o ou1lp   nei t  2trxmpou1apt ifetad s2rm(vo;u) leoif3ty1oaDr n il()srum(mpoo4lp emicsas) ruax  nt0oexoii3iadfa uauvo;t0altrxf ootfm   u o (0srurirpno1ope mfvi s a2rmumpou1altnii3iadfaDrau pnt) eeomo oadlaD lu s s) rxo(o3oo4ale lfvta(farurur nu4alt ifeilslm rm( sn()trtrxf oytoa rlu i;(0t2tr(o3iu1aleemfeiasf 2raumooo0altomfcias sDrlumo u0aetoifctotlmte n i ( trxmim oydopen ncsasf rtmx  ot4texnioetyslm ea(vs;u4trxrio3iotfpDeanei t) 2xmio no1altnlicsas)s2tru poo1oetn ieiyd mDrmn s;t4trtnif todop ean i;t  rtoio nudoleemfes () rrmuro;o1aee  f3ildlsDemumo;u)tlxrmo3todfmDraivo;s  exr(r3nudlp elfvi ( s2tmxm ot4oeeo o3tydla ea(monu4 lxoioctytfmD livs s srurir3oo1apeemnesl(  Drm(r ot1tle  feiysls rmnvon()aetrioctydopDr uvs (  eumio nydlm elnvtl(fa2ra( o;o4tlt  ictytfa2rm( s (4 lenio3io1lmDe nvslt0 rxmim3nudop  mieslt)srururoot1oexnmf3taslsDranvo (0tetoxr3ta1fpte u i s)srxoxr3nodoptelfes (f Dtr( oot4tetomoctatlm rau p t4tltoif3totlpDe ivi;s) ruo(o3iu4opeemnei t a2rru pot4aeto octys mDul(mp;u) rxnxf3oy1lmD auvs;s  2uoxrpou4ap nmiesas)srurx p;o0olenmf3taslaDumnmpn()arxnxo3io1fmt luvo t)texmiopoydoltn fetl()srtmxm nu4tee  ietydfa rm( ont) reomo oodlmtelnei s srtmir ou1ll e fcslsf 2trxrp;t4opx iocildla uln o t0 lenir iotopte iei;t)tetmxo3no4opee ietasfaDtm(mont1aexnmictytfs eanvs;u4areoio iydoatrlu i t0sruoim io1apeelfvi ()arraxrp;t0aexo ieilt a elnmp ()trerif3iadom r ueo s)t2tm(mpiu4ap nlnviasf Dtrumoot0aexo oeiad aDrlnvo;()altomfcoo1opDrln s;(0 euo(mpou1omtemneta(faDrrxmpou1aexoiieiatfmDranms;u0trtrxfctatlmtelneols  exoim3no4lpte ivs ( s2raur ;o0oexoif3ilt m2el(vsnt) rtomf3oytfaD  neslt seumxrpio4llenmncs sf Drm(ro;u1texnioeiatlmDumumo u) eeomf3tytfpDran i;()tetmxo3ny4ole lfvt sfaDta(mo;t1oet mi3tas a ean s;t0trxnio3iodlpDe neo;s)seuo(m ny1lm   ncsl(  2tmxm nt4oltomfeilslaDelu pn()aexoxo3oydlmDeai il()s2toxr3nu4amen nvt (fsDurumo;o1alt  o3iad m elnvs;u)alxnmo3tatlaDeluvilt0 eurio3oy1opt lies s arrm(mpnt1oee ioetltlsDrl(vsnt0tltnmo iatfm   ieilt0s2trxr no1al elivsl( sruaxmont0teenio3iat m uln s ()tetomf3oydom e ues;t)trxm(o3oo1alen nvi ()s2rmu  ou1tle ifeiadlaDel( p t0 lxrir3tatfp rluvs t0s2urxo3no4ap e fvs ( sDtmxmpnt0olxnifeiatlsDeanvs (4 eeoirctatoptr i i;(  rurxopny1al  mneias sDrrxmo;u4oeen fetld s umuvpnu) lxoircio1omDr n o t)s2xoiopio4amtelnvsl()arraumpno0ape ioeiytlsDul(von(0artnxr3ia1lmt aneo () rxmim nu4op nmictls)artau p;t4tpe ioetldls eau snu0tetnxf3ty1omDeai olt0t2um(m iudaptnlies s) Dtaurpot0tpe  fcildls emnvpnu0artnxf3ootlptr nvi t0setrxrpiu4omenlivils)arrmxr ou1aptn i3tldfs rauvsn()aetoifcto1omDrlneo;( t2trimpiu4lpe  netasfsDumumo;u1aee mi3ilt a2emumonu) rxnxf todlm   ivols s2tr(o ny1omeelieta()sDtaum oo4apeomfeiytla2eluvpnu)alerif iytfpDr ivslt0setrxo io1apenlnvi t  rtaumono4apxoioctat a rmumsnt)texrif3oydla r iei t0seurir nudop nmncta( a2rm( o;u1oexo iciasfa2rmu o;t) renmoctydfmD aneo ( teuoir oy1omen nvt s)arrr(moot0aet  ieias a emn o;()artoxo iytoatr uvolt  2xrxr oudllt lfct t  Dtmurpno4aexo oeiyslsDumnmpn() rermf3oa1opDe uvsls  rtmirpiodol nmieiat)aDua(r ;t4tpt  f3iydfm rm(vonu0 ltnxf3to1opt liei;t)s2um(o nu4ll nmfes ( a2um( p;o0openmociltfa2emn p;() etnmo ootfmteaneo;( s2to(opiydlpt  nctat sDtax ooo4opx  feiydfs2ua(vp;u4 reoifciotop   i s s  2xm(o3ou4lm nmnviat) 2ta( pou1oex ioeils s2ea(mont)texrif io1fatrli ol(0setmxopiy1al n feil()aDurumoou4alt moeiad m um(msn()tlenxfciytfa   u i t0 rxoxo oo1llen fvt (  2umurp;o1oexomocildfs emuvo;t4 rtrir to1om e iei s0 eumxo3ou1amte fesas) 2tru ooo0aexo i3iat m2um(vp;u4tlxrifctodlmt ai sl(0 2umxmpno1lm  lnvtlsf 2urx pno0oeeomiciadla rmu o () exomo todomt lnesls0trto(opoy1lm nmies s)aruau  nu4oeeomieilsfaDua(vs;u) leoxrciydomD lu i;t  2trxrpnydll  lnvil(f Dtmum ;u4apto fciyt m2uanvp t0arxrmo iytfat  i slt0 exmxo nu4ap e feta( srta(m ou0olx io3iatls2um(vo t4 rermocto1lm  aneils) 2toio iudll nmneilt)srtauroot4oetoio3tysfsDuau ont4 rerir3ty1optraueo;()sexmxm oo1al nlnvi t) 2ta(  ot0oeto fetasfmDrmnvs t0 rxrxfctadom rauvol(  rto(r iydlp  lfeiasfs2rrxronu0apxo ictad s ea(ms t0aetoxrciadlaDr ueilt) rxrimpoydlpte nctlt) 2ur(root1tlxo i3iadla2ul(vs (0texoiocta1lm elnesls0t2uoxrpno4ole mnet s  rtaxr ;t0apt iieiyt m elnmpn(4altrxr3ia1oa rau o t)srtmir3nudam nlivi () Duauro;u4tetomfcilslmDrlu p u4 reomf3oo1lmDrlivo ()s2tmxmpiu4apt  fci t srtax poo4tltoif3iyd sDrauvs u4arxoiociodomD anvilt0 2tr(o3ou1lmtelivias aDur( o;u4tpx moeilsfmDrmn s;t)trxnio3todlp r ivs;s sexrxmpny1lpe miesatfa2raum oo4apxo ictyt a rln s;t)trxnxr3totlpte i il()srxoxr3no4om e ncsat  rrmxmooo4olen i3ild s ua( onu0 renxr oo1fptr neol()srtmxm ny1ol emnvsatfs2raxr ;t1olxnif3tld s2uanmsnt0trtrmr3oydlmt  u sls s2to(opiu1lmt miesa(f Draxm nu4aleo iciadfsDrm(ms u4tlenxf3ta1op rlu o;s0truoxr nodaptelnvta( sDta(r no1altn f3tys m umn p;(4 exoxo3oytfm elivsl( srtmxmpiy1altnlfci (f Dumxmonu0apto ietys m2em( onu)tltoxr oa1opD  ivils)srxr(rpiodlm  lfcslsf Drrur ot4altn o3iasla raums;(4aetnif oatlmDr ueol()srxoir3oy1lpt  nvt s) Dumxmooo0tpx  iciydfa2umump ()arxrxfcoatlm r u s;t0 ruo(rpnu1olen neil()artmxmooo0tpe mocilsfm ran pnu0altnxfciadfp r i olt0 rtoim oydol nmnes t)arurxr nt1tlt mictasfm2elnms;t4 exoxocoa1la eln o t0 rxr(r nydape livtlt) Duaxr ;u0tetnif3iadfmDulu s u4artnxo ootlp   nvil()s2xo(m3oodam nlics (fs2rru oou0oetnii3ilt s uln o;()tetomr3io1faDeaueil()seto(rpoo1omt mivs tf 2taumooo4openiieiys s el(von(0teenxrctotlm  ln i (0 rtrim3no4amt  fciltfaDur( o;t4tetnioetad s ul(vp u0altoio3iadlateai sls0s2trio oo1lp n nct tfs2rrxr oo1alto f3taslm rmuvp (4 rtrmr totomt  uvo;t0trtrio3ny4lp  micia( s2raur no1alenifciyd m2emums u4tlermo ia1laDeli i;t0t2uo(o io1lleelncias)aDurxmoot4tetn f3iyt aDuan s (0 etnxr iodopDe ieo;t  rtrio ou1llt livilt s2ua(  ot4apxoifeildlaDumn onu4trenir3oa1opD au sls0t2umxmpio4omee nvsas)s2rrurpnt4apeo ieiysfs elumsn(4altoxo3iotlatrlivi t)s2toirpno1ap   feiasfaDtm( o;o0tpxniieiydfa rlnmpnt0 lxnxo3iatlateai slt)setr(rpoy4op emfetls)aDtaxm oo4tlxo f3tldfm ulums t) eenxo tatfat an o;t0srxm(mpio4ome licta()arrau  ou1oeto oeiyt m ra(vsn(0trxoif3oo1lp rln o;()tetrirpnu4lmt liviltfa2trurp;o1opxo icias sDraums u4aeeomoctydlmtraivols)srxrimpnu4ap nlnetl(fa2tm(mono1alx ifeilslm2umuvo u4 lerir ta1fp   nei s0trxo(o3no4lp e ivilsfs2taumpou4apxnmi3ilsfs uan pn(0 rtrmfctodfaD lues s0 eurxm oodoptn iesat)sDtrumpnt0tetomo3iltfaDumnmo t4arerir oatfa elu o (0t2toxrpio1ll  lfvi (  Dtrx  ;u0oex ifetytfa eluvo;t) leoxr3iy1lm r ieo s) etoio oo1ale  fcs t)aruaumont1teeniociad mDeauvs;u) ltnxo iotfaD  i ols setm(rpiy1lp  lici (faDrr(mo;o4aptoif3iltlaDrmump;u4aeermf oytfmD livi s)sexmim iu4lmtnmnvs ()aDrr( o;o0aeen iciysfmDraump (0aleoxociydoa  anei;t0 exm(m oy4lpenmnvsatfs2umxrpnt1oleniicilsla umnmo;u0alxrmfcoadlm rlnvi;( t2xrxmpiydal emnvslt  Duaxmpou1oetoioctadls2rl(vsnu0 lerif3ta1fa e nvils) 2um(mpnodoptnlnetltfarrrx p;u4apt  oeild sDul(mpnt)altrmf3tydlp  ln s s0t2xoim3nu1ap  mnvtlt) 2ur(mpno1olxniieiaslm eluvont)aeerir io1fmtr u i;() 2xrir iodolee fvs ( srra( pnt1olxn ictadlm rmu snu0aexrxf3oo1fa  liesl()sruo(opny1optnmfvilt a2ta(ro;u0oex mi3iys m2rauvo;t4 rxoxr3ty1latr ivols)seuoxrpoodam n ici t  rur(mo;u0oexoiieiadlsDumuvs;u4tlerxo tadlmD  ieilt) 2urxmpiydlltelicslt a2tmx pnu4optnif3iatfa uauvs u0tlerxo iodla r n o t)setrio oydam elieslt)s2tru  ;t4alxnif3tat s2em( o (0texrxrcoo1lm eluvils  2xrxr io1ame  ieta( aDtmxr nt4aee mfeiys mDra( o;(4 rtoxf3oadlm  livo t)s2xm(o oy1lmte fet ()aDrmx  ;u1oexoiicils mDrmnvo t0 renifcoo1lp rliei t0s2uoxo3io1ape  fvslsf rtm( o;t1apxoio3iys mDua(vpnu0 exrxf3iadop elnvil( srtmio3iu4apenlfcil( aDtrxrpou1aeeniieias a uaums () exomf3tatlmteluvi;( setrxr iu4lm nmfeil()s2rr(m ;u1oex  ocias m ua(mpnu4aleomfcoadlmteanes s srxmxopiu1ol e nvtasfarum(rono0tlx  f3tltlsDra(vo t4artniociytom rauei s0 rxoiopoydom n neils  rrrumooo1aee moetltfsDeanvs;u)aeenir3iadom eauvs;s srtrirpou4amtelfvs t) Drrumpoo1tpeniieiys s2rau o u0tltrxr3iodlateln o t)srtmio iy4ame lncia()sDrrurpnt4apt iociys m uanvsn(4trxoir3ootopt anvolt0texo(r3nudamee fesat s2tax pnt1alxnmociysfa2emn onu4 rtrmr oa1fpt lieslt0seuo(rpoy1omte ncias) Drm( ont1tlt  ociydla ua(mp t) reoxfctotla elieolt  2urim io1llenmnciat) rumxmo;t4opeoiietld mDeln o;(4 exoif3iatomte n o s  rto(m3oy1lm   nvil( artr( ont4apenmfciys m2elu p (4alenxociytopDrluvil(0sexrim oo4omee iesl()arraumpnt4tetnif3iyt a2rauvsnt0altnxf ty1late ivo;(0s2xm(m oodol emivs ()s2urxr ;t1aetnif3iys s2rm( ont4altoio todomt lnes (0trumxmpoy1ll nmictas a2umuroot4olxo f3iytfm2raump (0tlxnmfcto1oaDr uvi s  2tr(m io1lp  mfes s s2tr(ro;o1apeo o3tatla umuvs;() etnir3oytfm  li i (  rxmxo3oudlpt mnesa(faDra(m no4ale io3ilsfs eluvs (0tlxrir3iy1faD lnvs;s) rtm(m iu4ope lieilsfa2trurp;o1aet iicildlm ranvs;t4 rxnxfciatopt  ieolt)texo(o3iodolt mnvs s)a2ur(m ;t1tetnmi3tls mDrmuvs t0artnxociatoa rlu i ()trxm(m3oy1lpe lnctls sDur(m oo0ale ioeiltlm2ra(vo;t4 leoircoa1laD aivs;()texrio3nodlmt  fesl( aDuax  ou4tet  i3tydfa eanvon(0aexoxr oy1lp eauvo () rurxr iy1am n net ( s2uaxm ;t0tee  o3iysfm rl( p (0 etoif3iotla raivo;s0 exr(o3no4lp  mfeils aDuax p;o4tlen oetat a2rmn ont0 rtoio oytfa  lnvol( texo(o nu4lpeemneta( srum( oou1tpt ioeildfm eluvo u)aeermr totoa e ies ( trurxo iu4op nmivias aDrm( p;o4altnmfctad m2rmu on(4trerir oadoatr uvs ()trtoxopnydllenmfctasfaDum(monu1opxo ictls mDel( sn()tlenirciytfmD  uvs s  rxrimpiy4oltelicta( a2umump;u0aptnii3tatfaDelnvs;(0 rermo3iodfa eln ols)t2trir3oo1om elneia()aDumxroou1tee ifetadlsDrmn ont)texoio ta1fm r u slt0sexmio3oudlm  mivtat sDuaxmpnt0tee ifeiydfs2rmu pnt) ltomr oatlm rlu s;t0tetoxrpoo4oltelivt sfarra(moot0tlx io3ildfm2rauvo u4 etrio3ia1fmtr u s ( seuoim oo1al nmnvil( arur(rpot0tpt io3tld sDelumsn(0aetrmr3oatoa   neolt0 exr(r no1llt  ivsltfsDra( pou1tleomieiytlmDem(mo t) ltoxrctadop  aueils)t2tr(r ny4aptnmfcsls) 2rm(  ;t1opeo f3iat a2ulu o;t0 eeoir3iotfaD aneo s0sruo(opio1apeelfvt (f Dta(mpno4tpt iietldfa el(vsnt4tleoio io1la eaivo ()t2xmxmpoy1ame mfetls) 2taumo;t0optnmoeiatls uauvsn(4teeomo3iydfptrlues;t  2tm(opoydaltn fvsa(  rrm(m ;t4aptnmociydla2rmn o u0altoxo io1faDeli o;()texrxm nodol n fctl( artr( ont4tptnif3taslm2emn snu0alenxrctytopDe uvs ( s2xr(opiy4lmt lnei s)srua(r ;u0tleoiieiadfmDrm( p;u4aeenmfciy1lp  anvi t  eumiopnu4ol e icta(f Dtrxr nt1aeto o3iyd aDraumo;() reomf3iytfatrlnvi;(0tetoxm iu4oltnmfcias  Duaumo;u4olx  o3iltlm umums;u) rxrio oy1oaDr ivs t)trxrim oo4olt mnesa()sDua(rpot0aeto ociadlm2ua(vs;()aeeomfciydlm r u sls t2xoxo oudlptelnciltfsDrm(m ;o1oee  iciatla2rl(vp (4 lxrmfciytlmD au o t) 2umxmpiydap nmncsas)srtrx  ou1aex  f3iyslaDeau p;u0tlxrir3iytomDe ivs;t s2ur(o3ou4ole mfvi t)srrauront1apxnio3iydfsDra(vs;()tetrircoy1fat auei ( s2xr(rpiy4ope lfeslsfsrumum oo0tee ifctas a rl( p;u) rxnmr3tatlp   nvo;s truoirpiydame lnciatfs2ur(r ;t0tpe  ociyslm2ranms;(4 lxnir tydlmDr u slt)s2toxo oodomte fvtlsf 2rmu ono1tpxo ietls s2el(ms;(4aeerxrctodfaDe i ols) 2to(o3nudolenlivsa(  2rrxr nt1tleoiiciltfsDumuvsnt4aeermo3tadfpD aieol( tetr(m ou1lpte ivi s)aDumx  ;o0tpe ii3ild s umu onu0trenxr3ty1lmtrlivs;(0truoxr oo1al nlicsltfarua(moot0apxoifciys m uanvs;t4tleoir3tytlatelneo;s0s2xoxo nydol  mnet t) ruaxmpnu1oexnmfeiytlsDrlnvpn(0alxnirciydlpte ueo t0trto(r ou1open ietas artrxmpnu4aeen i3tytlsDelnvp t0 etoxr oadomte i sls)teur(mpiu4lptnlfesat) Drrx  nu4olt mfetatfa umnvpn(4aetomociadfaD lieo t trtmio oo4lpeemieia()aDtr(m ot0apeomfctytfsDrmu p;(0 rxomf3oodoateanei;s)t2tr(opnu1lpen ivi t)aDra(m ;o4oleomociadfmDemump;t)artoioctatfmteluesls0s2ur(rpoo4ap emfctlt)aruaxm ;o1tlt io3tyslmDumnvo t4 lxoio3ta1om  aues;s0 rtrim3oodll n ietl(fa2uru  no1tptomociydlm2em( onu0aetnmrcto1fateanei;t)srtm(o iu1al elncta() Dtmxmpnt4olxnii3ilslm2ra(vs;u0trtnxo iydfmDeanvsls0sruoimpiydapenlivsasf Dumxmp;t1aeto o3iadfs rl(vo u)trxomf ty1opt aivi t0 exoirpoudope mneta()sDum(mpot4oetnmieiytfs ra(ms;u4tlxrxf3oy1fatrlneo;()trurxo iodlp nlietlt)aDuaxrp;t0olenii3iydla rmuvpn() eeomr tytopt au s s0srtmxr iy4lmtemncta(faDrm(roou0tpxo ietas a eluvs;(0 rtoxf3tatlaDr nei s s2umim no1ole
\ No newline at end of file
@@ -0,0 +1 @@
+nvs;s0t2urio3oy1llt lncia( arrm(rpoo0tleoiieiad a rl( snu0texnmo3iatfate uvo;s)t2urim nu4amtnlnet sf Dtmxmp;u1tpenmfetatlaDuauvon(4altnir ta1lmt lnvs (0srxmxmpiu4ll  lici s sDumxrpnu0oetomi3iysls2em(ms;t4trtnmf3tadlp  lu ilt) 2xoxo3nu1ol emicsatfaDta(mo;t1oeeo oeild a ea( ont)aeeoir3todoatrauvi t srto(m oydomen fvias sDtr(m ;o0tetnii3iys a2ea( o t)arxoxf oadlmDe ivo () rtrim iy1lm nmfeta(fa2trxm oo0apt ifctydlm ra(vo;t4aexoxo3tytfm   nvil()t2urimpny1olen fes (f ruaumono4ole  fctyt s ua( o (4tetrmf3tytomteln ol(  etrxo3io4ale lfcslsf rtr( o;u4apxnifeiaslmDuluvpnt4texrmf tatop   iei;t0 2xmimpoudlptnmncta(f rraxrooo0aexo o3iadla rln o (4 etnxr todom  aies () 2to(mpoy1altelfvi sfsrrr(rp;t1apeoifetasls2rlnvo t0 ltoxo oydlpt lies s0texo(mpoo1am  mnct (fsrrrx  nt0olen i3tat a elu o;t) etnxf3oo1opDran ilt0tetr(rpiu1lptnmnvsa(  Dtau  ;t4apxo o3ilsfa emnvonu0tlxriociotlmD ai o;(0 rtmim oy1ame lnct sfs2umx pnu1oexomo3tadfm2em( s;t4artnxf3iatfmDeliei s)teur(m iudoltnlnvtls)arrr( pno4ale  o3ildla um(vs;(0 rtoxf3ta1fmte i s;s0 rum(r iodlpt mnesls)s2ra(  ;u4tleoioetas aDuln ont0tltoxf ty1fpD  ueo;( seumxm3iydamenmnciltf Dtrurpnt0alx  o3ild a2uaump t) reoxf3iy1fm   n i;t0srxrir iu1lp nmfesa( s2umx p;o4oltnmoeiasfsDrmumsnu)texnmf todlpt  i i;( sexrirpoy1lmeemicils  rumumoou0oexo ocildfm rm( snu) etrxr to1fmDraivi;t0 2to(m3nu1om  mnvt sf Dumu p;u4opxo ociltfa2ul( snt)trxnifciodlm e nvs;t)s2to(opoydoltn netasfaDur(m nu0alx mi3iys aDrm(mp;t0arxnmo iotoaD  iei;t0 2umxm io4ale mnetl()arum(m ;o1alto o3iyt aDemumsnu4tetrif oytfa r n s ( sexoio3ny4lp  mfet ()srumuront4opxoiictatla2emn o;(4 ltnxf iotlmtrli o t)s2toir iu1ame licils aDumx o;t4optn i3iyd aDumn p;t)arxoxf iodlmD ln i (0truo(o3oydlpe lnctls) rtr(  ;o0tpxo iciaslmDraums (0tlenmr oadfm ean olt0 2urim3oy1am nlnci sf rumu  no0tltn fetydfsDrluvs;u)aeermf3iadlmtrauvi t  eurim iodomtnmfvi s artmuro;t0oetomoctlsfa2umn p;t4 ltnmo3todlmt  ivs;s s2xrxrpoy4omenlnetlt)sDrrum nt1apt ifciasla emumo () etrxr ia1lmDrln o;() euoim3oodaptnlnvia(  Draxro;t4opx if3taslaDem(mo u0trermf3oo1fm e nvils t2uoxo3iy1ll n neils) 2rr(monu4tltn ocilsfm2el( o;t) exomf oa1la elieols0t2urir ou4ap  mnetat) Drmu ooo4oeeoifctldlaDeaumo ()teeoif3ia1lmtr nvs;(0s2trxm ou1omtelfvsas a2raumonu0alxn i3ildlmDean s u0tlenxf totla r neo;()seuoio nu1lme liet s srumumoot1aexomf3tldla ran p;() etrmr3ta1fpt  uvi;t0 rxmio oy4ole livsas s2rau p;o1alenii3iytfa2em(vo (0alxoxociadfa eanvolt  eumxo3oodlleemncilt a2uru ono0oexn oeiaslsDelu sn()aleoiocoodlmt auei ( sexr(o nu4am elfvtas a2tr(mono0apx mi3tytfsDrl( o u0 rxnmf iy1laD au ilt s2uo(r3iy4amtnmfesas) Drrx  ;o4apxo f3iyt m2ea(vpnt4aetnmo3oa1latrlivi;s) 2xmxo oo4om   fvilt  rta(m nt0tlx mfctysfa2uanms t0alenir3tadomtrli s;t srtmxmpio1optemfetl()artr(rp;o0teto f3iytls ulnmpn(4arerxr tytlm  lu ol( trumxmpoudllt mieslt) Dum(mo;t4aee io3ils a rl(monu0alenxf3oo1lm   ivo;(0 ruoxr iy1llt mfetl( a2umxroou4aleomi3iasfs2em(vpn(0 exriocoo1lat  neo s)srtrxr iy4lmenmivtl() 2raumono1opxnmociat sDeanvo ()trenxoctotlmDeai i;t)s2toxo iodapee fvia(  2ur(m nu1tpt mfeiytfa2ean s (0 lxrmf iatop e ivi (0 rtmiopnu1ll eliesl()s2um(  ;o4aexnmieiad aDumn o u4altnif3todoptraieils0 rumxo3ou1amt  fvi t a2tm( pno0aexn fciadfsDrm(vs u0trtnxo oydfpteauvs;t) exoxm3oodal   nctlt srtrx  ou0olx if3ilt aDeau pn(4 eenxfciatlpDelu o;t0 2urio3no4llt  iciat sDta(mpoo4aleomfciysfa2ua(vo t0trtnif iotop eluvslt seur(o3ny4ol elnvs tf 2raumpoo4tetomfetas mDel( o;u4tlerxfciytlp rauvs t  rxrir oy1op  lfcils aruru  no4opxoii3ildfm uln o u0 lxnmr oydlpDrai o t) rumio iudamtemfvi t)sDta(root0apt mfciadlmDelnvp () rxrxr3io1fm raivol()teuo(rpiu1op   ieil(  rrrxr oo4tltnmictasfs umn ont)tltnmf3oo1omD aivi;t0s2xrxmpoy4ol nmietl()s2rmurp;u1oeeomoeiatla2rl(mpn(4tlxrmo ia1lptr neo s)s2xmxopnudlm   fet s a2urxroot0tpx mieiyt a2ul(vp;t)trxrmr3oydom   ies;s0 rur(m3iodll nmfvia(  Draxr oo1ope mo3tadfmDrmums u0 lxoxf oodlpD  ivols) ruo(r oy4ll nmivias srumxrooo4tlen i3iydfm rm( o u0tetnxo3io1lmDeanei;( trxm(m iu1am n neias  2rmum oo1altoioetyt m umn o;u)artnmrciy1opt  u sls) 2uoio iydolt lneilt)sDuaurpoo4aeeo fciat sDuanvont) rtrxfcootom rln olt)srxmirpoy4op n fes t  rtmu oou1oet mf3tatlsDrm(vp t)tlxrmf3iydfptr i ols  rumir nu4ll nmnctls) ruaurooo0tpx mi3iasfmDrlnmo;u4arxoxr ty1om rau s (0t2toim3iodlpe lnvsasfa2umu o;u1aleoiieilt sDumumsnt4treomr oo1fptraieils)s2xoxo ou4omte nvi tfarurxro;o4tet ioeiysls2ulnmon(0aeenif oytoa eaieils0s2um(o oodlp  mivsl(f 2rmu p;t1apt  f3iatls ranms;t0tetnmr iodlm rlivi;t)t2umimpou4lm nmfctl( sDtmumo;u1oleoioeiydfm umumo;t4 renxo iytlmt anes t0teurim nudomeelfeslt) 2ra(m ;t0alen feiad s uln p t4 lxomf oo1lm rluvi t t2xr(o iydoltn fvtas a2ta( o;u1tlto ieiad m ra(mon(4aexomf io1oat lu s (0trurirpnydlpeemncsl(  rtmx  no0oexoifetatfsDrmuvsnu)aetrxf3iytfptran i s)sexmxm3ny1ap   netas)sDra( p;o1opto oeiydfsDraumsnt)arxoifciy1optrau s;(  2xm(o iy1lp   nvi tfsrrrur nu0aptnif3tldfs2eanmo u0 lxrxf3tytfp eauvo;(0sexr(o3ou4llen ieil()a2rrxm ;t0aex mfetydla2ulumo u4 exrmoctadopDe nes;s) etoim3iu4lp   icia(fa2rrumpnu1oltn icilsfsDean p (0trtomf oa1opteln o;s0teuo(m3no1apenlfcs t sDrmu ont1apx  iciasfm2ra(mpn(4aetnxr3iytfmtrau s;t)trum(rpiu1lptn ietl( aDtax oou4aleniieiadla umnvo t4tleoir3tatom  aivs s srtoxopoo4lmenlnctls  rrax  ou0aetnmi3ild mDrlnvp;u4aetrxf3iatfmDeanvsl(  ruoim3io1alte iet ()arumxrpno0tetoio3iadlaDel(mp (4trxoifcto1fmDr nvilt)setmio3oy1olt  nviat sDraump;t0ole  feiasfs umu onu)teenmrcoydfa  lnes;( s2umxm io1lpeelici (fsrum( poo4tex  f3iytfm2elnmsn()tltrxoctydoaD au ols)sexo(o3io4ll   ics s)aDtru pou0apx  f3tltfs rlu p u0aexrio oa1optrauvs;s0seumxr iodol e fes ()aDtru  ;o1tpe ii3tyd a um( s;(0trtnmf3ia1laD li s t teto(m nodal emfct sf Duau  no1aleo oetlsla eauvo;u) rerifcoytlatrlieolt)t2to(rpou4op e fcs ( a2trxrpnu0tex  iciltfsDulu p;() reoifcta1faDelnvols)trurir3oydol   ieias)arrmxrpou0aet mf3iad m emumpnu)aexoio3tytfmD lneils)s2xo(o oodamee ncils) Dtr(moot0aee ii3iytlaDrmuvs;u4tltrir iydfaDrliei;( truoxo3oo1al n ictatf rrrump;u1olto ieiyt mDel( p;u)tltoif iytlateanvi (0 exrim3iodal nmivil(fsDtr( ooo0apenmoetad mDuln ont0texrmfctodfp rli ilt srxoimpiy4amenmfcilt) rrax ont0texn iciat m rlu s t4altnmr ta1lpte nei;s0srur(r iy1lmt mncsl() 2rrx  ;u0olx mocilsla2ua(vpnu4 ltrmociotopt  u s;s)tetrxmpou4alee ictatfarta(  ;u4tleo oeiyd s2raumpnu0 lxnio3iotfa raueilt  rxoio oudopenlfeils a2um(mooo1oet ii3iys aDulnvs;u) rtnmocto1lm raieo s0srxrirpoudal  mieil(fa2rrurp;o1texoiiciat a emnmp u) renxr3io1fpD ln i;(  2to(mpiydlpt miei tf 2rmx pnt0opxomi3iadls2rlumsn() rxrxr3iytopt aieo s0texmiopoodaptn ieilsfs2ur(ro;o1aee moeiytfm2elnmp;u) lerir oy1omDelu i;t)sexrir ou4ll e fei sfaDumxmo;u0tlenii3ias mDrlnmonu4tlerif3iy1optr iei (0setmir3no4ll nlfvs sf Durump;o4aptomfeiytla2eanms u0alxoxf3totopDr ueils  exr(opou1optemfei s) rra(mont0aeeo o3tlsfa2um(mp;t) eenio3iy1op  livsl()texr(mpoydome  fctls)aDuau  nt1apeoifeiasfa el(mp ()artrxo oytfpD li s s0srxo(o3ny1omeemncilsfsrumx o;t1tleo feiltfaDrauvs;t) rtnio3oatop elueilt trxmxr iy1ap  mnes (fs2uaxm nt0apen feiydlm emnvpnt)texnmo3iy1fa   i o;t seurimpny4ameemncs sfsDtm( pno0optnmicildfaDraump;u0 eermr3oytlatelnes ()s2tr(mpny1op  lnvt t)arumxmpno4opx  o3iltlaDelumon(0texoio3iy1omte i o s)trtmxr ny4op emnci t)a2rr(rpno4tltomfcildls umn o;u0aleoxociadlm e uvi;(0srtmim3ou4lpe mnet sfarrrx o;o0ape  oeiydfa2uan s;u)aexrio iatfa  aieo s) rtm(o ny4aptnlfcslt  Dtrxm ot4aetniicildlm2em(vp;u0treoio3totlaD  nes t)t2xo(r iodapt  fvtat srua(rpou0tlt iicild s ulnvo u) etnmf3todfm elieo (0srtrxr3iydop elnet s s2rrum nt4apx  fctlsfm2rm( s;(4aeeoxrcoydlmD aies;s)t2toir io4omt mfci t arta(  nu1tltomo3ias aDeanmp;t)aexrifciy1fateau i;s)srxm(mpiy1lpen ieil(farurur oo1optnmociadfa rmums;()teerirctadlptr ieslt0 rtmxm io1om emfvtl()aruax o;u1optoioeias s rlnmon(0 etrxr iydlpD au o t)s2trio oodllenmivtl(fsrrmu p;u4tleoif3tyt m rmn p (0 etrmo3tydlaD lueilt)srxrio oy4aptnlieias s2um(m ;u0oet miciys sDelnms t4tetomo3oatopDr n o;t0trum(r3nydll nlnetl() Dtaxrp;o1tetn i3tatfs2ra( p t)tlxnmf iydfpD  uvs t)sruoio io1ole mfvtlt) 2trx  nt4tpxnmieiltlmDumnvsnt0 rtnmo3tadfpDrlnes (  rtmxrpiudll elnvslt  Drm(  ot1olxn i3tydfsDemn on()tleoifcoatlatrlu i s)srumxm ou1aptnlnvtatfaruru o;o4aetnioeiys a rm(monu4 etomo oydlmt aneo () rxmio3iu4apeemfcilsf Dua(rono4openmi3iadfm ul(mo t0aexnxo ty1fptranvo;t) eto(o nu1om n nct tfarurxmp;o4tlxo fetadls2ul(vont)altomr3oytlpt  u sl(0trtrxmpoy4opte iesl( aDtaumpnt4apxn f3iytla2uau o;u4 eerircta1oa r u olt t2xm(o3oudop nlfcsa(f rtax oou4aex micild mDum( s;() leomo3iotlmDrlivilt) 2uo(r oy4opt lnesls arua(monu4alenio3tatlmDrau p;(4aeenxo3totfpDran i;() 2xmxr oo1lleeliei tfs2ra(mpou4tptnioetatla eau o t)teermocoydom  ln s;(0 2uoim3oo4omen nci t)arurxmpnt1aetn oeiasls2rmu p;u0areomo ia1oaD  ivi;( srtoxrpoydol emivtat artm(rpou0texn oeiltfs2eauvp t)aetrxrcoytlpDe nvs;s)s2urim3iy1altn fctlt arrr(m nt4aetomfciaslm ua(vo t0 etnmfctadlm e ueo;t0truoxopou1apeelnesat)aDumxro;o1opeo ieilslaDeanms;u0tlenifctytomteln s;t0setmim ny4lm elnesl(  2rr(rpnt4tpe mfcilt sDua(vo;u4 reomfcoo1lpt  ivi ()texrim3nu4aptnmieil( aDrmuro;o0olx ifcilt aDraump;()altrio3iadfp eau o;(0srur(rpoodalen ncils)a2rr( pnu4tpeo fetadfs ran pnu4trtrxr oodomtr nvilt) 2xr(opnu4amee fvslt)a2rrump;t1oleomfeias a2rlnvpnu0tltnif tatomDe i o;t0trum(opou4amtemivsa(  2ra(mpoo1texnioeiys m2em(mpnt0trtrmr3totla r uvo ( s2xmxrpiudamenmfcia()arurx o;o1apt ioetldlm emnvs;t)teeoxrcoy1opDe ieo s0setr(opiu4ale  iei sfsDumx pnt1alt if3tltfm2rm(vo t0 eeoio3iadoaDrluvo s t2xmxopno4amtelivia(fsDuau  no0tlt ifetldla2umnvo;(4 lxoio iytlp rai o s  etmxopnu1ol   ivsas aDtr( pou0olx  ociyt mDelu pn() etnir iydopt  ues (0s2ur(mpnodlptnmfcsa()s2tax  nu1texnmiciytla2elums t4alxoxfcoa1latrlu i;s0 eumio3oodom   fcil()arrru  no4texoifctys aDemnvs u)teeoxf3iy1opD  u i s srumxopio4ape mnct ( srumu p;o4aleoifeiatlm eau p;t) lenmf iotlaDeli o t0setoiopnodopt  fvslsfsrraumpoo0opxnmfeiatfaDelnvp (0treoir3todomD an ilt)tetoxo3nydam nmiet s) 2tmuro;u1aet  i3iadfs ua(mo;u)tlenifctytfmD lneilt srxmxo oodam nliei tf Dumx pnu0tet ifcildla ulu onu) lxnmo3oodlate i ilt0 eurxo no1oltnlnei sfaDraxrp;t4opxniietytla raumo t4 lxoxo3oytfaD luvilt) exoxm iudame lnvi t) 2uaxroot1aexniietadlaDem( pnu0 rtrmo3tadlm eanvo;s) etrxopou4om   ivi t  rua( p;u1oex moctaslmDuau o;(0aetrmrcootfmteau o;s0 etr(r oy4lmen nvsas)sruru p;u1oee io3tlt a2rmnvs ()trxnircoydfmt aieo;t)srumir iu1ap  lnesatfarur(ront0tltnmf3ils s2rlnvonu4 rxoxociadopt livs;s  etrimpoydame mfviat)sDumum nu4tleo f3iysfa um( pnt4texrxr oy1oatrln ilt t2to(m3iu4ame mfvtl(f Drrxrpnu0alto o3ilt aDean p t) ltoir tytfm  lnvolt t2uriopiodap nlnesls aDumu ont4tpxn iciltla2rmnmsnu4artnxo3ta1om elu sl() rumir iu1aleelics sf Drmxm nt0tex  o3tytlm rln o;t0trtrmf io1lp rlies;s s2umxm3ou1alenlieilt)a2rr( poo0teeniocias aDeluvs;(4 eerxr iydop e uvo s trtrio nu1ap e fvil(f rrrurp;o1tetoiiciadfmDel(msnt4altomf3oatfa   ivo;( t2tmxo3oydoltn icias)srrm( o;t0tleoifeiad s umu pn()treoio oytfp  luvi s trurxo no1ol nmfcsat) Draxr oo0aetnmoetydfa2elnmont)aeenxf3tatomDr n o;s srtmxo3oy1lptemfesasf Duaxm ;u4aeenmfctlsfs2ra(vo u)tlerxr oodfmtrauvs t0 rxrio iodlp emivil(farumxmpnu4oex  feiyt m2rlumsn(4tetrxo3iydoa rlu s s0 eurirpoudal emivilt  2urxmo;o1tpxomfctltfmDum( ont4tetrmrcoy1oaDr i i;(0 exr(opiodlltnlnei t) Dtrurp;t0aexn ociatfsDrm( s;u0 rxoir3iatlm rlivsls texm(m3no4lltn iet t srrrur ;u4altn feiadfaDum(vs u)teeomr3ootfpDeau ol()seuoxr oy4ope mivsat  rrr(mpnt1olxoio3iysfaDum(mo t4 rerxrcta1fat aivilt0teur(rpou4am e ivsas) 2rrurp;t0tetomoeiyslm2uanvonu0 ltoxrciy1fptelies;s0t2uo(o oodlmeemfvt t)arumu o;u4tle mfciadfsDel(vs;u0aetriocoatfaDraueo s texoxm3io1olt  nvsl(fsrtm(ront0oltniieiyt m2ea( s;u0texrmrciodoatrli ol()trurir iudom emnvslt) Drr(mpno0tltn f3iadlaDraumpnt0aexrif3oatomD lneo s trurim oy1opt mnvta(f 2rm(rpno0teenmicils aDemu pnu0tltnxf iydlmt auvo s  2xmir3iodoptelfvia( srrrxmonu4opxnif3iat sDrmnvo;u0 leoir iy1lat  ieolt  rto(r oudll e iciltfa2umurpoo0tlxnioetlsls rlu p (4 rxoxfcoatoaD lnvi s t2ur(mpnu4op emfvs s)aruaur nu4tlxomietyd aDrl( o;t0arerxo oatlm e n slt)sexmxr oy1openmfctatf rum(  nu1aeen o3tlsla2umnmon() lenif3ootfa eln sl(0trur(o3ny4aptelfesltf Drrxm no4apenmieiatlm2um(vo;t4tlxnxf3oadlmt auei s)s2ur(o3iodapt lfcsat  Draxront1oet mi3tytfaDua( s;u)alenir3totopte n o;(0texo(o nu1opt  nciasfsrraxrpoo0tlxn ociyslaDelnmpnu0aeeomr3tadomDeaueol(0trxo(mpiudomen ivtat) rua(mp;o4alenifeildfsDrlums u) rxnif3iotom  li s;t)srxmxopno4olenlieia(faDtrxrp;o0tle  f3tatlm2ea(mpnt)alerir ty1fpD  ivi ( tetm(r3nodaptemfvtat)sDtrumo;o0tlxn i3ildfmDrlumsnu4aexnxfcoadfp ean ilt  2uo(o ou1om nmicta(farua(m ;u0opeomf3ildfsDemu pnt) etrif iydfmtr u s t)sexmir3oo4lptnlicsa(  Drm(r ou0ape  o3iyd aDelnms (0alenir3iotomDran i;t) 2xr(rpoodop  lnetltfs2tax p;t4opxnif3tld m ul( o;t)arermo3tadfp e i o;()seto(o3oy1lm e fes s  rtaxronu4oltnioetldfa2ea( o t0teermocoytlateau s t0srurir iu4ll e nvtasfsrurx pou4tpeniieildfaDuanvs;u4alxrmrcoy1lp r n s (0 rtmxr3oudaleelncsa() rraur nt1tpeomi3ilsfsDrau snt4alxnif totfptelneo s  2xrxm ou4apenmnvsls)sruax p;t4oltoio3ils mDem(vs u) exrxr oytop e ivo;s0tetmio nydom elictatfs2ur(ronu1aleomf3iytfa ra(mo u) lxnmf tatfm rai o;t) eur(r nu1lpee ivta() Dua(r nu4tpenii3tlt aDeln pn(4trtnmr iadopDrlneslt t2xmir no4llee nvia()srtmxrpot1oeenii3tadls em(mo;t4trtomf tadfmtr nesl( trxm(o3nydole lneta( srtaur oo4opx ifctadfm em(mp;()arxrxf3iotomt  ies;s) eurxo iy4aptemies s)artmu  ou1tlenmictyd sDulu s;(0aeerir to1oaD  i i;t s2tr(m3iu4opt lnesl( aDtr( ooo0optn i3iasfa2elnvp u4 ltrif iatopDe u ilt)trumim nodap n icsl(  rtau oou1tlx mociltfs eaumpnu0arxoio3oydfat li ols0srtmxm3io4omee nvsat)aDtr(rp;u0aptnifctas s2rl(vpnu)arxrir io1fmteluvs s srxrim3oydlpt mieiatf Dtr(mpoo0aleoii3tltfsDumnmpn() leniociotfmD aieo s0 2uo(opio4alt  fcs ()sDrr(  ;o1olxoif3tadlaDrmuvs u0aexnio3iotoa eaueolt trur(o iu1lm  mnesatfs2tmxro;t4ope io3iytfs el( o;(0 lerio3ty1opDraivo;( t2xr(m oy4lme  ieta(f Dtau pou0openmiciatfs2rmu p t4aetrifcoydlpD an i (0srxr(r3nudam nmicsasf rrmum no0alt mo3iasla2ra(vpnt)teenir totfp  lnesl(0t2ur(o no1alenlietas arrmumpnu4opx mfetys aDra( o;t)areomf3ia1lmD aies;s0srumio oo4om  livi t)srtaxroou0aeto i3iatla2rl(ms;t0 rxoxf3oatop r ieo t srurxo io1omee ieiasfaDrrumpou4aexomoeiadla emnvp;u4 rerxf3oadoaDeauvs t)teur(m3ou1lm   ivslt) Dururp;t1olxnif3iydlmDuluvs;t0texomf oatomDeauei;s sexoio3oudllen nvs t) 2rmx  oo1olx moctldla2rluvonu)tetrmo3ty1omDeanvs s0 2tmiopiu1lpt mfes sf rua(rpno0olx ii3tlslm eanvs (0 eeoxr3tytoaD aueol( trxm(mpno1ame mictl() 2tmuro;t4opxomo3tyd a eaumo (4trxnio3tatop rluei s  exr(m nudal  mfci tfa2ua(ro;t1altniociasfsDrl( p;t)
\ No newline at end of file
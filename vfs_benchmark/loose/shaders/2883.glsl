@@ -0,0 +1 @@
+nvs s)sexm(o3iydamtemieiltfaDurxm ou0texo iciat a ua( on(4 rerio3ia1lp eauei;t  2uoir3iy4altn fvs tfsrta(  nt1tpe  feiatfmDrmu o t)texrmr oodoaD  n s;s) 2tr(r3oudlme lfvsat)aDta( oou1texn ieilsfaDumump;(0tltoiocoodlat  i slt0s2xoxrpnydlltnmiet ( srur(rp;u0oetnmieias s rmnvsn(0tlxrif3todlptr iesl(  rxmxmpno1lm e ivtas sDta(mo;o4oetoif3iltla2ra(vsn() rtrxf iytfateanvi;(0tetmxr3ou1olen ies t  Dtr(mpnu0tpeo ociatfaDul(vp t0trenxf3oytlmDeluei;t0 rto(m3nudop nlivsat)sDraxmo;t1optoiocild m2emu o;u4teeoxr oy1laDelivi;t0teuo(o iodoltemncias srtrxm ;t1tlxn fciadla2uau s;(4 eenmf iotfmDrluvi;s) ruo(m oy4lmtn ncsl(fs2rmuroot4tlxomoctadfaDea(mo t) rxrxo3oy1faDe uvo;t)srxmxr3nydlmtnlnesas  2uau pot0tleo fciysfsDrmuvo;u0trenmo3iotfmt luvs s)trtoxm oy4ame  ietas artr(monu0aeeomo3ildls rlnmsn(0aexoxrcty1opt  uvols s2uo(mpnu1ol n ivsls) rrmxr ;u1oeen oeiadls ulnvpnt)tltnxf3oo1optraieo;(0t2xrxopou1lp  lneias)aDta(r nu4apxnmf3iad s2elump;t0 exnxo3tatlp rluvi t0seumim iy1ol n nvil( srur(rpno4tpxo o3iasfs umu o;u0tetoxr tydfa elnvi s  rtoio iudapt mfcslsfa2ta(ronu0tptnmoctyd s2el(vp ()teerif oytfp  anvil( t2xo(opnu4aptnlictlt  2tmur nu0aetomieiysfm2rmnvo t)alxomo iy1fmtelnes t0seur(rpno1ope mfvtlt sDra( oot0olxn fciysfs uan s u) renxr3iy1fpDe n ilt)setrxm3nodll   nct s aDtaxrp;u4apxomicilslsDelnvo;(4trtrmr io1lmteauvo;t  ruoxm nydole mfvias  rtmxro;o0oetnif3ils mDrm(mp;()altnmfcio1fm r nvilt)s2to(r3oydap  mfvsls)sDtmu  no4opx mi3iydfs umnvp;u4 eerif3oy1lp  lnvi;t tetoiopnu1lle  ici s) 2rmumonu1tpe mi3tad s2umu o t4aetnif3totfmtrlivi;()teuoxrpiodlp   nvt s  2rr(mo;t4teto f3tadla ea(mp u4 lxoir3ia1lpDean i t0 rtr(r3iy1am elfvs s sDtm(roou0tlxo fciltlm2emnms (4tetoircta1late nvo;()t2tmirpoy4opt  nvia(faruauro;t4aexnifctyd a rau sn(4 etoxocoadfa rai i s0s2uo(r3iudaltn fvs t  2rax pot1apeoioeiatlsDrlums;t4arxrxr3ia1fmtrauvo s)texmio iydlm emieilt)srtmx ooo4tlenif3tytfmDum( p;t)aexrif to1opD  u ils0 exmxo3ny4lpe lieiat)srrrurpno1olenmfcildlaDra(vsn()aetnir3iodom  lnvils  exoimpio4ole  nvtas)s2tm(  no0oetnmieiys s2eanvsn(0trtrxfcoadoa elneo;s) rxmxo3ny4lpeemnetlsfa2rax poo1tlxn o3ilsla2rl(mp;u) rtnxf to1fpDranvilt)s2xmio io1ope lies (fsrrrx p;o1open f3tadfsDem(vsnu4 lenxo3oa1fp raivo;t  rxm(m3oudal   fvi tfa2ua(mpou1apx mictas a2ra( ont4alenxociatomDr uesls  eur(rpiydlm  lfvslt)s2taxr no1aetoio3iydla2ran s;u4 etrif3tytlmDeaneo s)t2uoir3iu1aptelfesasf rtrum ;t4aexo ietadls2rl( o;(4aetomr3oatlp  auvo t0srxmxr3nu1opt  fciat)s2uaumonu1tpxnmociasls ranvo;t4trenmrctytfm ean o;() ruoim3ny1amtemneil( a2rmu  no0tpt io3iyslsDrl(vs t0alerxoctodlp  au o s0s2tmio oo1ome mfvt s a2um(mo;o4altnii3tydlm ea(vo t0aeenio3ootoat luvils s2xr(rpnodlltelfvt ()aDta(m ;o4tet ii3iytls2rlumo u0 lxrmf to1lmDe n ils)s2tmxo3iudaleelnvsasfarrmxm ;u1tlxomi3iydfm2raump;u0aetoir oydfateln ol() etr(mpnydam nmiciat) 2ua(  ;t4apxo oeilt a umump;t0altoif3iy1opt aneils)s2xrir3iy4lmtemivi ( aDrmum ou4opxnif3tydls2eauvont0 eermf oatfp rluvs;s)tetmxr3oo1llt mfci (fs2rrxmp;o1apen f3iltlsDrl( p;t0aeenmf oy1fpt li sls0s2urim iudoltnlfet s  rum( onu4oltomociasfaDem(mont) exnxr totom rlnei;t0s2triopno4op  lnctls sDumurono0oeeomietltlmDuaumsn(4 eeoif to1fp e uvs;s trtm(r ou4omtnmnes (fsDtaxrp;o1tlt iietatfaDum(mo t)tltomoctydoa  ln slt trtrir iudam n fesa(fsruax o;o1texomi3iadfa uan onu0aeenmrciodlat  u o s)teto(o iu4alenmfcta(fsrrm(rpoo4teen o3tls a ulu p;t4areomf oadla   nei ( t2um(mpoo4aptelncsa( srtax  nt0tptoifeildfsDua(vo;(4trenxfctytlpD anvs s t2uo(o3nu4lltelicslt) rtr(rpot1oeenifctadls umnmp;t4aetoxf3tytlmDrluvi;()texrio no1ale mfei t arrmu  oo1oeeoioeiysfaDrmnmo;(0arxnxf3oo1lpD lu o t0srumxm nudamtemicil(fartmurp;o1tet iietatlm2ua(vs (4aeeoxo oy1lmtrli o s0srtmxr ny4ll n nesl(fsrtrxronu1oleomictas a2umn pn()aexrir3oytlaDr ieo t0t2ur(m oo1aptn feiasf rtr(r ot4aexnif3iytlm2ranmo t)trxoircia1op e u sl(  2tmim3iodlpe mnctl(fsDra(  ou0tltnmf3iad s2rlnvo;(0trxnxocto1fp  an o s0 rxrxr3iodom  mfvi (f rurxm ou0opeo f3tad m ua(mp;(4 eenmo tytfp rau o;(0t2um(m nudaptemnes tfs2uau  ;u4tlt  f3iyt mDul(von(0tlxniocoodfa rlu sls0trum(r3ou1amenmivi s srtaxro;u4aexn feiysfa rauvs ()treoif oatlptr nvi;s) rtmim nudapee fcsat) rra(m ;u4tptomfetasfm2ul(vpn(0 ltrif ia1fp  auvolt0srxriopou1op   ncsls)s2um(  nt0tlxn fctydfs2ra( ont0 lxnmf3oy1fmD  i ilt srxoxm3nydop   ncta() rur(  nt4optomoctyt s2em( on(4 lxnmf3oodlmtraues;s0teur(o3nu1am emnct s) Dtrur no4tpt mieildfs rauvs;u4 eermo3ty1fa eanei;t0t2tmimpoudoltn netl(  Dtrxm ;o1tpt mi3tls m2uauvsnu0 leoxf3iodomtrauvi s)t2tm(o3oydlp   ieiatfarrmxr oo0tle iieilsla uluvs u4artoxr iydfmD lieilt setmxmpoo1ol emnvtl()aDtaxrpnu1tpt if3ilt s2ra( onu) leoxr oo1lpD  n o;t0teumxrpiudap e fct sfs2rmxr nt4tpx moeiat a2emn sn(0 rermo3iytfpDrlneo;()sexmir iy4lpenmiviltfsDtmurpou0alxnmieias s2rm(vo u)arxoifcootlmte nei;s s2to(m3iodam e feils srumum ot1apxnmf3iat aDeau p;u0arxrxr iatlp eaivils  2xrxm3oodlme  ivtas) rua( pou0oeeoifciadlm ul( o;(0texrir totlmDeaueolt  rtmxm nu1lltn fvslt)a2uaxmpoo1oexomi3iat aDemu snu)aexrir to1lat  uvils teurio oy4lp e fcsasfaDtrump;u1tlx  fetyslm2eln p;(4 eerxr io1lpDr n s;t) 2tr(opoo4lp nmfvtlt)a2tmxrono4tpe mfetydlm2um(vo;t0artoio tatfp ranes s0seur(m3oo4ape lfei t) Dur(r oo1olxnmfcildfs ua(mo;u4aeerxfctatlp eaieolt)tetrir3nudamee nvils  rraur nt0oexn fctys a2ea(mo;u0areoifcoatoatrauvi;s  rtmxm iu4llenlnctls) 2tru pou1olxoiictytfa ea( pn(4 rxriocoa1oaDr uvs;s0srumxm oodlp  mfei () rrmu p;u4aexoioeiytlaDean o;t4aexnioctydfp   u s t0 exmir3nudamt lieias artm(rp;u1tetnmietlsfsDeanmpnu0aetnmr3to1fp   ueils teto(m oodomt mics () 2umumpnu0alxnifcildla umumsnt0aetoif io1opDrln i;t  2urxm3iodaptelfvia()s2tr(  nt4tpe ifciadlaDrmnvo (0trxnir oy1fpteau i t0 rumxrpnydlpt lnvia(f rra(mpou4teeoif3iys a rl( pnu0aexrxf tydoptrlnei s  rtr(opoy4ol  lfvi () Drrumpnt0apxniiciyslsDuluvs;u)texoif iatlate ivi ( sexo(opiydalenmnvs t)s2ta(rpnu0ope if3iysfmDrlumonu4aleomocio1omD  ivs () rumxmpiodomen ivsas)artaur ;o0tpt iieiasls ean ont4 ltoir to1fp e ues (0 euoirpio1lptnlictasfs2urx  ;o0tpe ifeiatfmDua( snu0aeenxr3iytlp  lu i;(0 2ur(rpiu4al e fvt sf 2uru oot4tlt ifeiltla emnvo;t0alxrif3iydlmDeaueols seuoxopou1oltn ncs sfartm( ont1tlenmieiytlmDumn p u0teeoxfcoadomDranvslt s2urxm no4lle mnvsl()s2rax  ;t1aet  i3tadfmDea( s t4 exrmr3iatlp rlueo;(0setmxo oudoleemivilt)srtr(roou1ale moctytfm2ua(von(0tltrxfcoa1lptelivs;s)srtm(m oy4lmt  feil()sruaxmpno4tex iietltla2umuvpn(4tetoifcoa1lmDe iei s seum(opoudomtemivt s s2uaxm nu0tpen icild aDrau o;t4 renxr oa1om  aneo (0t2umiopoodlm n fcias aDtrx pnt0teeo fciatfa2umuvo;t4artrmr iy1fp eaiei s0 exo(opoodol  lfct t)aDrrx  oo0tlx mocild a rlnvont0 renxr3iadoatrlivols0teur(o nydoleelncslsfsrtaum ;t0tlt  oeiydfsDel( p;t) etnmo todopDr uvs;t t2umiopoo1al nmfvil(fs2ururoot0aetnioetltfm em( s;t0aetoir to1omt  u ol( s2xoxo3ou1ap e ieia(fs2umuroot1texomfetad m2el( o u0 eenmo3ty1oat lneol() eto(r no1apee nvs s  Dtrur ot1tlxoif3ilt a emn sn(4trtnmf3ty1omtrli o;( t2uo(o3nydap  lieta( artau  nt0opxnmfetydfm2ran snt4 renxr3iodlaDeaiei;(  2xm(mpoo1om nlicsa()a2trxmo;o1teeoiictld m2rln s;u)trtrmo oodlmDrlneo s)srtoxrpny1lp n iet ()s2rr(mooo1texnmfciytla2rm(vs;u4artnxf tadoaDr uei;() 2xriopoudolt mfeias) 2raumo;t1teen icildlmDumuvont)arxrir3tatfmD  n ils) rurir oo1lpe  ivt sf rrr(mooo4oleomicild m eanmo;t4 exoxo iy1oatrlnei;t0 2uo(o iy4altelnct s a2tmu o;u4alxnio3ilsla2umumo (0altnmfciytfatelues;()srtr(m3iy1lmtnlfcs tf 2ur( p;u4aleoiicilsfs2ea(vpnu4arenifciatfpDeln ol() 2um(rpiy1oltemnvils  rtr( p;u1tetn fctas a2eanvs () ltrif3tadoa  aieo;t sexoim nu4amenmfctas)a2uaxm ;o4open oeild sDuau s t4 etnxfctydopt anes;t0sexrxr oydlmee nesl(  2umxrpnt1aeeoiiciytlsDra( sn(0 ltrmf to1omte u ol(0srxmxmpnu4lptnlics t)srua(  no1tltn fciasfaDumumonu)treoirciotlpDeai sl(0seur(mpiy1lm elivtas)sDta(mont0alx  f3ilsfm em(vsnu0aeerxo iatop   u slt0t2trim3iu4lpen nvi t) Dta(  nt4apxn feiatfm2rlumonu0 etoif3oytlateaieslt0 2uoxo io4al  lietasfsruaump;u4alt mfciltfs2em(vonu) rxnxo3oo1lpD ai o;s)t2xrir3oudlltelfesl( sDtrxm ou0oleomociyt m ra(mon() etoxr oytlateli ils) exr(m3oo1amen ncslt  2rm( ono0tetnmocilsfs2ul(mp u)arxnxo ty1fpDe u s t)s2tmim3ou4amt lfes (  rtm(m nu4opeomoctltfs2uln o t4tlerxo oadopDran o s) rxrxm ou4ol  licsltfaDurxmo;t0olxn f3tltfm em(vo;t)aeerif3io1lm e ieo () 2urxm oo4al nmfvt tfaruaurpoo0tpe mfetltlm2rau p t)artomr tadopt  ivs t) rxriopoy1ap elncias) ruaxro;o4tee  o3ildfm2uln s t)aetrmo todfptrluei;s teurir iodom emncil() 2rmum oo0alen oeiat s2rl(vpnu)teeriocia1faDrlu s (  etoxo3iudllen fvil(farrmur ot0aexn fetldfs rm(vo;t)aleomo3tatlmtr u i;t0setrio oy1lptnlnvs t  2tm(  nu0tpeoiieiyd m um(mo u0teeomfcoo1faD anes;t)s2toiopiu1lpe mncsl(fs2rrumpou1tlt  iciasfa2ranmo;u0 etomo iodoaDr nes t0seto(o3ou1omtelfet (fa2ua(mp;t1aet if3iysfm eaump;(0trxoxfcoy1fa raues t tetmimpiu4op e ivi ( sDtm( ono0tle mocilsls emu o;u) lxnif iydoatrlnes;()seur(r3io1lle  nesatfs2ur(moot1ape  i3tlsfa emnvp;u) reomrciotlptranvo;s0teumxo3nu1lp  lieias  Dtax ont1alx moeiltla2uln o u0 lenxrcoatfatr uvo;t0 rtoxm3iu1amen ncsltfaDrmumo;o4tlxnmf3iysfsDraumsnt4trtrio3tatomDrauvo t) eumxrpnudomtn fei t)sDtru p;u4oltoiicilt m2el( p;t0 rtnxrcoodlaDraivo;() exo(opou1altn ict ()arrm( poo0opeomiciydls ean p;(0 lxrxr to1optelu sl(0setm(o oydlpen nctlt)sDraxm nu1oet ifeias a2el(vsnu)aeeoirciytfp ranvol(0 exo(rpno1lmte fvtls  2uau o;t0tetnio3tlt s2rln ont)alenmf iodlpDeln il( trxmiopiu1op emfvt tfa2uru poo1opeo ietytlm2ua( o;t0teerio3to1laD  u ol( t2urxm3iudomen ieiat srrr(r ou0altoif3ilslaDuanmpnt)trxrmo ty1fm  aiei (  eum(o3nu1am nmiei t)a2rmxronu0opto i3iltlm2rmn p u) lermr3oy1fm  aues t teuoim3io4optn nvilt) rraxroou1alenioeiat a2rl(ms;(4 rxrxr ta1fpt  uvolt0 rtmiopoy4ale lfeilt) rum(m nt1ole mo3tlsfsDeanvs t)trxriocoy1lateaies t0t2urxm3io4lpenlnvslsf Drmu p;o0optoifeiltlmDranmo;(4trtrxr oatfa elnvo (  rtmxo3nu1lmee fct tfaDraxmp;o4oetnif3tld s2umnmp;(4 eerxo iy1fat  n i;(0 eur(o ou1llee fet s  rrrurono4aetniiciadlm elumsn()trxnir3ia1fptrlies ( s2umir3oudll nmnct t sDumxrpoo1olxnmfctydls uanms u4 exoxo3iydlatrluvsls  eur(o3nu1ameemnei (fsrrrxr no4tleoifciatls2rm( p ()trerxf todoaD li ils t2tmxo nudamte nvi t) rtmx  ot1opeomfetatfm rau onu) ltnio ootlmtraieo;s0srtoxm3nudaltn netls)a2tmxmoot4olt iociaslaDemn sn(4arenif oydlmD aieo t srtoxr oo4amt  icil(f rum(rpot0open o3iydfa2uan p;(4 rtnmfciodfpt luei;t0 rxr(o3iu1ll nlicsls)sDua(mo;o4aptn ociadfs umu o (0altoxf3oodlp elu o;s)sexrxrpoydlme lfet s artrxmp;o1tpxoiociysfaDua(vpnt) reoio3oatlmDeai o s sruoxr iy4am  mici t)a2rrxr ;t0oeenii3iaslmDean onu)tlxomo oodla   n s t) ruoxr ou1altnmfvils a2urxr ;u1tpt micild s ua( s;t4 eeoxfcoytfa   neo;t0s2uoxm3nu4ol   fcslt)s2ra(  ou1tltnmiciytfmDuanmo;t0 rxrxfciatfa   ues (0t2xo(rpiu4op emfet t  2rmxmooo1tltnmictlt m ulumo;(0arenxf3to1lpte uvo;s  rto(o3nu4ap  micia(  Durxr ;t4optn oeildfmDum( o ()texrmf3oo1la ranesls)texrim3iydlme  iciasfsrrmumoot4tlxoio3ildlmDul(ms (0aeermr totop ean ols)s2xm(mpou4am n fei t  2uaxmoou1tex  i3ilt a2emumo;(0alermr tytom e i o;() 2xrxopno4om n icilt) rumu poo1tlxniictyd s2rl( pnt0tetoxo iotfp e n ol(  exmxr iy1aleemnvslt  Dtm(rp;t4tpxnif3iysfa rlnmo t4texnmocio1lm elnvo ()t2xmimpoudomtnlnvs t artmxrpot1olt ifciysla2umnvo;u0 eerxf ia1lmDeli s (0s2urxm iu1lle  nesasfsrraxmpnu0texoiicias s el(mpnu4aeenmo ty1fp rauei;t srtrxr3oo1amtnmiei tfaDtaurpnu4oetnmociydlsDrau sn(0teerxo oa1omDr nvs t  2umxm3oy1ome  nvsltfsrtrumonu1tpx ioeiyt s2rlu s;(0 rtrxr iytfm  ln ilt  euoim3ny1lp nmfvi tfsrta(rpnt4tpxnio3iydfm2emuvs;u0aeeoxocoodfp rlieil() ruoio nudoptelicsls  Dururp;o1opx ifeiys s rl(mont) exnxo oadfa e n o;(0srtm(r oy1lltnlfes t  2tmxmpoo4opeomi3iat s2ea(vo t4altrmf3oadfmt lneo ()truo(m oy1lp nmfcta()s2rm(  no1tpt ifctldfsDelumsnt0alxoxocto1faD  uesls0texr(r3iudlm  mfvsas  Dtax oou1oeeoioetys aDrmuvp (4tetoxocoytlmte uesl()trxmim3nudllte icia() Dtrx pou1tpeoiictldfa2el(vs (4tleoxo3oydoaDeaivi;t)trtmxr3iy1lmenlfvta(fsDtru pno4olxomfctatfsDelnms;u0teermfcoadlatr i slt) 2uoxo nu4om  mictatf 2rauro;t1oetomictydfmDranmp t0aexrmo iy1fa eaieo;t  eurirpoy4al elfct t sDrrx pnu4teenmfetltfs rm(vo ()tltnmf3iodlmDe u ilt0 2to(rpiu1llen ncsas)aDumxmooo0opt ifciyd s eanvs (0artrir3tadfpDrauvs;t0trxrxm io4am  liesa( aDta(mp;u0tex mo3iysfm2elums;t4 rxoxrciadfateai s s sruoir no1omtn ncta(fsrurumpot0tle ifetldlaDemn s;u) etrmf ty1fm  lu s;t  2uoxm3oo4opt mfeilt s2ra(root0oexomi3ildfm uau s;(4 lerxo3oo1opD  nes s s2xm(mpiu4lptemnci (  rtrxm ;o4tlxomoctydfm em( s t)aeeoxrcia1faD  n i (0sruoxrpiu1ap  mncsl(farrrxrono4teen o3tldlm eanvo u) eenir3io1fa eln o t setrir3ou1amtelnvia() 2uaxmpno0optn icilsfs um( p u0aexoir oy1fmD anvi;s)t2tm(o oo4optnmiet ()arrmxmoou4openioctytlmDeauvon(4artnmo tatoaD auei;t s2uo(m3nodlptelfcs (  rtm(rpnt4apto i3ilslmDrau s t4 renmrciytlaDelies;s srtoxopoy4lltnmfeilt arrrurooo0apx iieildla rl(vs;t0trxomf oa1lmDeli o;s) 2xriopnodlptemfesas)s2rmx  nt1opxn ocilt a uaump (0 rxnio3tadlmteauvol(0srtmiopnydopenlfvt t)aruauro;u0olx ifciytlmDrmuvo (0 lenio iadlp   nvo t0s2xmxrpio1apte ivi ()aDumxmoot1tpeomicils aDuaump t0 eeoir3ta1laDr ivs s)s2uoio3oy4op  mfes t) 2tmxr ;o0aeeo iciadlm umu o;t) renxr3iotlpt  u o ()srtrim3nu1oltnmneias)srrmx ont4tlxniiciasfmDumums t4artrxo3tytlaDeauvi (0t2toxo nu1ll emncsl( a2ra(m ;t0olto fctlsls ranms u4 rermociatfm raies (0s2to(rpnudoptnmfci ()a2trxmpnu1apxnmfcias s2rmnvsnu) lxoio3todlpDrlueo t0s2xo(opou1lpe mictat)a2urxmont4oex  f3taslaDrl( o (4alermocoytoptr u i;(0sexmiopiudlpeemfctas  rtauro;o0aexnioeiltfsDemnmo u) eeoiociytfm  lnvs;t  rto(m3no4altelieta(faDrmxr ;u1tpenifeiys m2elnvs u0tlxrmo3oydfaD ai sl(0 rto(opnodaltemics tf 2ta(  ot0alxo i3tltfmDeanvp;t4 rtnif io1lmD  neo (  rtrxo ou4llen nci tfa2um(mont4olx moeiyt aDuaumo t)texrmfcoy1fp e i i s)tetoxmpoy4ap emfvi ( srtaumpot1tle mocias mDrmu p u4trxoiocoatlatrlieo t0 rtmim3no4ap e fei (f rtrxrpnt1aeen i3iasls2umnvo t0arxomo iatfmtelueils s2xoxm iu1ape lfcsa(  rtm( ooo1ale  ieiad m2uau o (0trxoxr3ia1laD au s ( t2um(r iudlmenmnvtat sDtm(m nt4opx ioetyt a2ua( ont) eeoxf3oodopDr ueil( s2toxrpoy1lpe  feils) rua( o;t0tex  o3ias s2umuvp u0 lxrif3oytfpt lues;(0t2xr(r ou4oltn icsltfsrtax pnu4aexo ieilslm ua(vpnu) lxnxf3io1opt auvolt0t2urxrpoo1lmeelivi tfarrm( pot4tpeniociyt s2umnmo t) renmoctadfmD lnvo s) 2tmim3oydlpeemicsa( a2uaxr ot0oetomociat mDrlnms (4artnioctatlaDr u i;s)s2xmio3no4om nlnet ( sDtrxrooo1tle mf3ilslaDua( s;u4aeenifcio1fmt  ueilt teurxopnodaltelfei t s2uaurooo0alen ocias aDrlump u0aetoxr3ootlaD auvsls) 2uo(r iydalenliciltf Dur(r nu4olto ociadfsDuau s;u4alxnifcia1fpDr uesls  rtm(m oy4lmenlfviat)sDtr(m ;o4altnii3tas m ra( pn(4 etrio oadla e nvo;( sexrxm oodape  ivt tfartru  oo0apt  oeildlaDua(vp;u4 rtnmf iytoaDeau o s trtr(rpno4lltemfcta()arurxmp;t1tleo i3iyd a rl(vo t) lxrxr tydlaDe nvs;() etoxopoudlltn icsat aDur(rooo0tpxoif3iadfmDul(vo;(4 exrxr iydlp  anei;(0trtoxopiy1lle mivt t) 2uaxm nt1opeomictyslm em(mp t4tlenmo3iotlmD anei t0 rumxo3ny1optelfesl(  Durx o;o4tpenifeilsfm rauvon()arerircoodoa eluvslt srtoir io4lle miviatfa2umx  ;u0opeomi3tytfs umuvon(4aetoifctadla e ieil(0s2xoim iydom emfetltfaDtax pnu1aex iietyslsDrl(mp;() etrir3ty1la e ues () exoxmpnodlp n ictl(  Drrum ou0ape mietlsla el(mp t0arerxf oodlmDeai s (0 2xrir3oo4ll nmfvilt)srrmurpou4oexoii3iyd a2ranmsn()tlxrmf3ty1la eluei;t)trxmxo3no4openmfvsasf Dumxr oo1oetn fciltlmDul(mp u0 exnmrcoydfptran sls)teurio3ou4alen ici ()a2rrxrp;t0tpe  oeiytfaDrlump (0alxomfcoydomtrlnvols0 eurxmpiy1lltelfcs s a2ua(moou4openmoetatlm eluvsnu4 etnmr3oodfm raneo;s trtoxm3iu1oltnmictasfsDra( onu1tpxnmi3iatls eauvon(4 rxoir3iydomtrai o;t0truoio ou1lmtnmncils)s2umumo;t0oexo oeiyd m uaumo u) eerxfctydfpDe uvo;s sexoxm3nu1ll  mncsas)arrax pnt0alxn o3iydls emnvp (0 rtrxo iydoaDrln i;s) etoxo io4lltnlfeilt) 2rau o;o4teeoiieiydfmDemuvo;t4alxoxf3ia1fmteaneslt  eum(o nu4omt lnci t) Drau  ;t0opto octatlm2um(mon(0tetrmrcoytfaDeaivs;t) 2xrio io4lme mietas artrx  ou0aptoiietld s2ea(mp;(0 rxrmr3oo1fa eli o;s)t2tr(r3oy4oltelncsa()arua(ro;u4oltn ocilt m elumpnu4altrxoctadoa   uei;t0seto(m nu4lptnlfvil(f 2ta(m ;t1tltoiieiasfsDuauvp u0trtomfciy1lpt lnvi;()s2tmimpio1lpenlivi (f 2um( oot4oet  f3iasfaDeau on(0alenxo3iydoatr ueo;t0sexrxrpnodaptelivs ( s2rm(mont4tpeomociatlsDelnvs;u0 leoxf iodfa elivols0 2xoxmpno1lmenmfcsatf Dumu ont4ale  ieilslmDrm(mpnt)aeeomo tadlateli o s)truoxm oodlmtemnvsa() rraxmp;u1oleomicildfs2emump;u0teenmfcio1lpD  n olt0setmiopnudaltelivsasf rrauro;o4tpto ieiytfm2ean o t4tetrxf oadfmt  nvolt0teumxr oo4lmt mfet t)aDum(r nt4aptn fctlt a2rlnmp;t4areoif oy1om ranvslt) 2to(r3ny1olee ivsl( srtm(rpno1optn oeiysla umums;()aetnif to1om eauvo ()srxr(opnudol   fcs sfs2uaumoot4aptomi3iadlm rlnmpnt4alenxociadoaD  ueo;t t2to(r oudap n ivtlt arrr(moot1tleo o3iyslaDrln pn(0 rtomf3iytlaDr ivi;t)s2to(r3ny1lp  mfvs s)a2umumono0tlx  ictltlm elump ()arenio iodfp  lies t t2toio3nodalte feiasf 2ta(m oo1olenifctlslm2eln p u)texrxr tytoatelnvslt)s2xo(opny1ll nlfvi (fs2rm( p;u4tpe moeiatlm emu p;u0tltnxrcoadop e nvo;t) etrxr oudom emfetat)s2uaumpoo4aleomoctls a2umnmp;(0alxrxf ootfp ranvi;s0srtm(o3io4oleemiviat)srtru  ;u4aet iiciys sDrluvs;(0tlxnmfciytopt lu ils t2tm(r3oy1llenmfetl(  2tmu pnu0tet ifetytfm2rlnmo;()alxrmo tadoaDraivo (0srxrxr oo1aleemivt tfa2rau p;u1aetnmi3ilsls2rm(vpn(0tetnio3tydom  lnvs;(0t2umxm3nydll nlics s) 2tmumpnu4tleomi3iyslm umu p;t0 lxrio ootlaD livo;t) ruo(rpnydomtemfci s) 2tau  nu0olxoiieiydfa uau pnt0arerio oatomteluei (0s2xr(r3oy4om nmfciasf rrr(m no4altomociytlm rl(vs u)aeeomfcoatop  auei s)trxmimpou4lmen ict s)sruax ono4aexo oetaslsDumu p (0 rtnmr tydlpt  i s (0 rurxm3oo4ap   fci (fa2trurp;t1aeenifctytfs el(mp;t4aetoxf3totop elivsl(0s2urio3ny4omt mietlt aDum( ooo4tltomi3tadla eanvp u4altomo3oa1optrlnei;(0t2xr(r oydlmee nvs sfs2ua( o;o1tlxn i3iatlm2ua(msnt4trtnxfciatlpDr nvs;( trxoio nu1op emfcias) 2rm( pou4alx if3ilslmDemn s;u0teermf tadlpteln i s0srurxr oo4ap  lncil() Dururpou0opxnioctlslaDranmp u0aeeriocta1fp  ln ols) 2uoimpou1alenmnes s)s2rm(m oo4tpxnmi3iyd s2umump u4areoxf3iytlatrai sl(0seuoxr3nodamtnmiesatf rrm( poo0tlx ifciydlsDumu p;() etrxr3to1fp e ueo;t0s2ur(r no1amte nciat)a2urxmonu1tptoif3iyt s ua(vp;(4tlxomf ootfmDr nvs ()srto(o3iu4amt lnvs s  Dtr(ronu0oetnmfcils m2rl( s;u4trtrmrciotlaDr ivo;t srxoim3iudomenmneilt  2umxmpot1tex mf3iydfaDra( s u4 exrmo3tytlmDeln sl( trurxo iy4lm   nctlt)s2rmx ooo1tleo feias a2rlu s (0tltrxo ty1lm raiei;(  rxoio3ou1ll nlfetls) rta(mpno1tltn ociydfa2rmn s;t) eeoxr ty1fpD lu ol( t2toio3iu1omen icia(  rraxrpoo4opt ioeiaslm ranvp u0arxomfctatla  aivo ()srtrxopio1apee feslt  Drmumont0aexn i3iydls2emn p;t0areomo3oy1fp elneo t0trxoirpoodolenmnei sfsDtmuroot1tpx ii3tltfm rln s u) etoir3tadlp ran i;s0s2trxopiu4op nmicsls)a2tmu ono0tpenmfeiys mDum(vs u) ltnmr3ootlatranvols) eurxr3no4amtnlnciat  Dtrurpoo1aet ifcildlm2rauvo t0tltnmfcto1oat  uei;s  rtmxr3no4al  mneta(f rrr(monu4alen fciltlsDum(vs (0aleoif oo1fp r nvilt)srxr(r3nodole lfcils)artaur nu0tltomi3iaslaDumu on(4teeoxf iodlpDrlnei s0sruo(o iy1lme lnes t) 2umurooo4opx  ociltlsDumumo;u0 etrio ia1la r n ils) rurio no4op elfei t sDumu ont0olx  f3ildfmDulnvs;u0tleriociytopDeluvs;t) 2umio ou1opt  nvs s aDtm(mp;t1texn feiadla2eluvpnt) rxrxrcootfmDelivs;()teuoir iu1amtemivt (fsDtr( p;o0aptnii3ildfm2rl( pnt)aleoxf oo1lpDranei ( t2tmiopiudlm   fet tfs2rm(moou0texomfeiydfmDua( sn()tlenmrcoa1lm   uvo;() 2tmio ny4lmt  ieta(f 2rau pot4oltn fciys a2uan snu0alerirctatfmD luvil() rxmxo3nodlltnmnviat) 2trurp;o0ole mfcilslmDrmu on(4 rtrxr3oa1fatrau o (  rxrxr oydlmenmictl(f rur(  ot0oltnmiciasfs2rl(mpn(4 exnio3tadfpD luvil( trtrim3oo1om nmietls)aDrruro;o1aetoioeiadfm2rl(vp;()arerir iotfmte ieo;s t2umxmpiu1omenlfvsl()aDtaurpnu4aptomi3ildfaDrl( o t)areomr3to1oa  auvo (  rumxm3no1lltemfci s a2urxmpot0apeoif3ias sDumn pn(4texoxo iy1op  an i t)seuo(m oy1om n neslt  rtmumoot0texoiiciytlsDelnvo u4tleoifcio1fmDelnei;(  2tr(opiydllte nvs s) 2rr( pnu4alxn iciadls emn o;u0altrxr3iy1opDrau ol(0 2umxm iu4lpeemfcias)artm(mpou0aex  f3iatlaDea( s u4tetrmr3oydfm r ieil()t2umxrpnydaltn ncia(  2umuront4alen fciys a rmnmon()altoif oytoa elneo;()t2xrio oudlptelnvs (fs2tr(ronu1oee io3iyd m2rluvo;u0 etrxr iytlat ai s t0tetoiopnu4om emnvias)a2rr(m no0aeenifciysls2ranvp;(0tetomf3iatomDelneol( trum(o3ou1llt lnesl()aDrax pnt4ole  oeiyd sDea( o u0tlxrif oytfate ivsl() 2xmxm oydamt mieia() 2rrum oo0apen iciatfs emu pn(4trtnmf3iadlmDeai i;s0trur(o3ou4altelicilt)arrm(r ot0teeoioetat a2uaumo t4treoxo totfpt li i t)s2xrimpiudol  mnciatf rrmxmpno1ale  fciysla2rmu p;u)alxrmocootfateaneils)trum(m3nudap  livs (f rur(  no0apxnmieilsfa eanmon(4artnxr iytlm eluvo;()seur(o iudal  mnct s a2umxr ou4olt  ieias mDuanvpnt0aexoio3iy1lm elnvol() exmxopiy1ll  licsat) rua(rpno1opx  f3ils s umums t0trerxo3oy1opD  neo s0 euo(m3ou1lp n neta(  Dumxront0tlxo ieiadla2rl( o (4arerio3tydfmDe ueo (0 2uoxm iodlmt  ietat)sDta( oou1alto o3iad sDulnvs u4altrif oydlp e i i s)setm(m ny4lptn netlsfsDrau o;o1aptnio3iatlsDemuvp t0texomrctytlatr ivo (  etm(opiydllen iet t)a2rrumooo4opxn f3iltfs emnmpnu4 lxrif tydfa eanvi;t0 etrxr iu4oltnmietlsf rrru  no1oetomoetld aDranmpnt4tlxomrctatlmD liei s0 rur(m3no4alt  fesl()sDumur ;t1aet ii3ias aDel( o;t)alerif3iotfatr ivo;t)t2toim3ny4ap e ivtasfsDrrx onu0oltn oeild mDuanmpnt)trtomfcta1la  lnei s srum(o nu1lm emietlt s2rmxmpnt1oeenmieiytfm rl(vp;u0texnmo to1opDraivolt t2trimpny4ape  ncs s) Dtmumpno0alxnii3iydlaDrmuvs;()alxomo3iatlpDe nvs t)trur(opnudlpt  feslt)artr(m nt4tle  ieils m rlnvo t0teerio ootlp rli il(0trxrio oudlle  nci ()sDtm(moou4tpt  iciatfaDrmuvo (0aleomfcta1fp  li o;t setoiopoy4apen neiasfs2uaurp;o4opxomo3tatlmDuluvo ()areomo tydlaDrluvi t  eto(rpnudlltn fesa( s2um(mpno0aeeo feiltla ra( p t4 renmo3oytla  lies s  exoir nu1apt lnei ()artm( pou0apx iieiysfsDuluvs;t0 lxrmr oy1fat  nvi t)s2xoxr oy1op  mnvs tfsrrrxronu1tlx  octadfs um(mo;() ltnmr ootoa e ues;t)setmir3no4lmt mfeiat)arrr(  ;o0oetniociatfa rlump u4 eermo3oydlp eluvo;(0s2xmxr oydlm n ncilsfsrraumpot4olx mo3ias m ran p t4altoxo tytfm  livslt  2uriopnydomt mivt t a2urumooo4tlx mfciytls2uau on(4aeerxocoo1opDelu s;s0sexmir3nudom   fvilsf 2tmxro;u1tpeomieildlaDumnvo;t0 ltrxf to1om rau i t0 rtr(mpiy4lme  nvs sfs2rmxront4oexn oeiys aDea(mo;t)tetrirciytfa eli s;t  2toir oy1lpen nes s srtm(mpnt0aeen i3iydls rmn pnt)alxnmrciadlate nvi;t0tetoxm3oydlltemfeta(farrmxr ou0aleoiiciyt a el(vs;u4 ltrxrciodla r i i t0 exo(opiy4ome mnvi tf Dtaxro;t1olto f3tyt sDuln o t)aeerio iatfa eli o ( srxmxo3iy1am  mfetlt  Durur nu4olt  oeils sDeanms u0trtnio oatla elneo;t)trumxo io4om   iesls)aDrau  nu4tetoiiciysfs rmnvsnt4aeerir3oydlmtr ues t teto(o oudop emieilt)s2rm(mo;u4optniiciltfs2rm(ms;u0tlxrio totoat au i t seumio oodapeemfeiatf rtmx  ot1alxn f3tyd m elumo;t0alxnmr3oatop  anvi s)s2xoimpno1op emnvi ()sDrmu  nt0aex if3iasfs umnvsnt4alxomf3iodoat aneol(0srxoxr3oo1lmt mnvilt)a2tmurooo4alxn fcild s umnvonu)alenmo3to1om rlivilt0trto(o no1ameemfesa( s2rm( ooo0aleomicilsfa2uau onu)alxnxfctytfp e n i ( sexm(opnu4omtnmfvi ( sruaxro;o1opt ii3iatla2uluvo u4 lxoio oydlmt  ivol(0trtoim3nu1omeelfvtat srumx p;u1aexomo3iysfmDul(ms u4alxrxfctotoat li s (  2xoxrpio4lpe lictat a2umum nt0alxnmietldla eluvon(4alxoxf tytlmD ln s s trxr(mpoo1llt mnct t  Dur( o;o1tee mi3iltfsDumumo t) etnmrcootla ean s;t) 2urxo3iodoptelicslt) rtru pou4aexnio3tyt m2rlnvpnt)tetrif3to1lm eaivolt0t2trxm ny1lm   fct ( arrrxm nu1tet  fctlsfa2umumo;(0altoiocoy1om  luei;s0sexoir3oodllt lneiatfarur(r ou4tpeo iciat sDrlums;(4aexnxocoadop elivi ()t2xoxm iy4olenlnesa( sDuaxmoot1apt mfciad m2rl(vpn(4 ltrmfctotfaDeluvs ( s2ur(opny4al  mnvs (farrr(r ;t0tleoii3tatlm2rl( p;t0teenxfctydlaD  i o;t0trtrxr3iy4ap   neia(fa2urx  ot4opt micildlmDemnvp t)arenifcoytomDrlies;s) rum(m iodapt livt tfsDum(m ot1teen o3ild m ulnmpnt0 ltoxr3iadomD  u o (0seumio iydal e fvia() 2rm(  no1tlto f3tys m uluvp (0texnir iytfmt lueo;s0srtmxmpnudlptnmfvtls)arraurp;o0ale  f3tyd a rmuvo;(0 lenmo3totla   n ils0s2ur(mpnydaltemivtlsf rtmur ou4teenmocildfm ua(ms t4 exomf todop elueilt0 etm(o no1ame  fcs s)aDumx  ;t0tltn o3tyd mDelu onu4alxoiocia1fptr n s s)truoxr3oo1ll   nvia(  2ta( o;t0tpt io3iydls2ulumpnu0tltoio3to1lm  lneo;s  exr(mpiydllte ivsasfa2umx oot0tetomfciat mDra(mo;u) ltoif3oadomtrli ils)tetrim3oo1op   ivs s  rurxmp;t4aeeoifeils a2rau onu)aetrmr3iodfatrlivs t  etr(o3oo1omeemiciasfartax pot4tex iiciyt a umnms t4altrmf3oatla ranes ()t2trir oo1apt licslt  rtrx  nt4olxnmoeiytlaDrl(mo t)trxrio3oatomt livo s)trtoim ny1ll  lnvsl(fs2rrxm nt0opx io3tytfmDrl(mpnt0arxrio3oa1fptelueslt trxmiopno4ole mfeil( a2tm(r nu4olt iiciysfm2rln pnt0trtrmr tydopDelivo (  2tmim io4lmenlnvsl(f 2trxmp;u4aetoifciytlm emumo;(0aeenmrcto1fmDrlnvo t0srtr(o oy4op   neiat)aDuaxrpnu1opxn oeiltfm um(ms;t0arenmr3oydfp ean sls0 exmxmpoy1apeemnesa( aDrm( p;t0olen oetyslaDeau o t0tleomo oy1lmtean i;t) rtr(m io4apee nei ( srtaxroot1oet ifetas sDran p;()aexnif3tatlm  anei t0srtriopny4lm  lfct s  Durx pot1altoiiciat a ra(mpn(4aexrxrcoatfat aneo t0 rumiopoodlpt  fctas sDrmurpnu0opt  oeiydls ea(vp t) eeomrciadom   u s;t0 2tmimpnydalee fet s)artru  ;u1aptnmoeilt a2em(mp (0tltrxociytopteaieo (0srumxr oodol nlnvtls a2tmx oot0aexoiictlsfs2uanvp;u4 rtrioctatfpD li i;t)trtmim3oo4oltnmnesl(fartru pot0aptnifeiatlsDul(vp;u)tltoiocoatfm  aneo;s s2xrimpou4op elicil() 2rm(mp;t4teeomiciyt m2uanmont4tlenio3iydom  auvols0 2trxm io1lmt  fviatfartax ooo0tex mi3ildla2uan p;t0 etrifcty1om rliei;t0srumxmpoy1ame  nvs t srrrxmont1aexnioeiatfmDranmpn()arxnmoctotlmtean o t0 rxr(r iy4amtemieslt)srtrxmo;u0tet  feiltls ulu s t0tetnmr totop rluei;(0sexo(r oydomt lnvt s a2ur( pot0tltnifciat s ul( sn()tlxoir tatop e ivo ()sexrir iodoptn net t)sDuaxmpou4aleo ietatlmDrl(monu)trerxrctadoatrln s (0 eum(m3nu1am   fvtas)sDtru pou4apeomfcildfmDel( s u)trtrxr3iodfp  anvo ()s2um(m3oo1aleemivtas)arum(r nu4oee  f3ilt m2umumpnt4aexoxrctatlmDeaivs;s) 2tr(o nydomte ieta( a2tmxm ;t0ale ifetlt s rln s t4 ltoxfciotoatran i t  etrxm iu1ame lfvi sf 2tr( ont1aptoio3iys a2uln p;(4aeermr3iatlmDr n i;s) etr(r3ou1ope livsat)srrrur ou0tlxn feiydlmDranmont)aetrmf3oadfm  li o ( s2trxopio4lmtn nvilt aDtau o;o4oexniieiadfmDuluvp;u)areomo io1fm e u ilt  2um(m3nu4llen icil( aDurx  ;o1oleo oeiysfa2ran snt)altrxo tatoaDrli i t0 etoir iodamtn ietlt) 2uaxrpnu1tlxoiociat sDumums t)aexnifctatopt  nvo s0 2xmxm3iudalenlfvi tf rumumpot0tlenioeiatfsDran o t)aexrmr3tytlp e u sls0trumim3nudoltnlnvt s s2rruront1optoiociadfs2rlu snt)arxnmo3todlp rau olt0s2tr(o3iodllenlictlsf rraxronu1tpe iociadla rlumon(0arermo tytom   neil( s2toxm oydope  nei t  rumurpno4oeeomf3tlsfm2el( sn(0trerif3io1fa e uesls s2toio3iu1ol elfcsatfartm(  nt1olxnmieilslmDean o t0texrif3io1laDe ueols setrxopiodalenlici t sDrm(r nu4tleoiiciatfaDrluvonu)altnxrcoytoaDrlivi;s srxmir oydol nlfvt t  2rau  ;t0texoio3iatfm eauvp t4artoif3iydfm elies;s) rxr(o3iodamenlnei (fartaxmonu0open i3iydfa2rlnms t4arenxrcootlmD lu s t)tetmxm io1ole liciatfa2tr(r nu0tpeomictatfsDrln p u)tetoxr3oytla r n i;t s2umxm3iydapt lfciatfsDtmxrpou1aptnioctlsls rmuvsn(4trtoxf io1omD li ilt) 2xr(r nu4apen nciat  rtru  ;o4tpeo oeilsfa rlnmpn(4tlxoio3iydlaDe u i s0texmirpnydoptn neil(  2tax  ot1oexomfeilslmDrl(vp;t) etoif3oy1oa e n ilt srxoxr3io1altelivt sfs2rm(rpou4tle iietydlaDuauvp u4texrio ootlmDean s;s s2toir iu1lpeemfeiatfaDum(mpnu1aet  oetltfsDua( p (0 leoirctodlp  livo;()srxrxo ny1alenlieslt)a2rm(r ;o0olxnmictysls ulu p;(0aexoifcoy1lm  au ols)t2uoxopoy4lpenmies sfs2rr(ront0tpxoio3iasfmDrauvs;u4alxrmrctatfatrlu i s0t2uoirpou1omen fvtl(f rtmumoou1tlenmo3iys s rl(vo;(4treoxf iatfpDeaues t0srtr(r3oo1omen icia(  2uax ont0aet mfctytfa2ra( s (4 rxnxr oy1fmDe uesl(0srxmxm no1am  mfvsa()aDtmx o;u1aptn ietyd mDrl(mp t)aetnxr ta1omteli s t0 euoxopny1lp elnet ( sDumum ;u0optn i3tyd aDra(mpnt0 lxoxo3oodfptelues;()trtmio3nu4ome lfet s sDra(mp;u0opt moetytls ranmo u) ltoir3oatlmDeaneo;(0s2um(r oo1omtn netat)s2rr(rpnt0apxo feiat a ul(mon(4trxomfctadfmD  ies;s) euoxmpiu4ame licsas) rtau pnu4oexn f3iyslaDua( p t0 exoif io1faDe nvo;t  2to(r ou4om elfeiltf 2uaur ;o1opxnmoeiatlaDrlump t4altnmo3iotopDraueo ( sexmxo3iu4lpenmnctat) Dua(m no1oetn iciltlaDul(vs;t0tlenif3oydfat  i il( trxmxopnu4al   ieia()srrm(mp;o4alt mictyt a2um(vpn(4tltnxfcio1oaDeau s;s0srxmxm no4om  mivtlt)a2urxm ;t0tltoiociatfmDranmpnu) rxnxfctytlp rlivo;()srxmxopoodlp n fci sfs2ua(mo;t1aee mietatlm2rm(vp u4 rerir3tatfptrluvi;( t2tr(opoy1am elivs sfaDtr(mp;t1apt mietadfs elnvo t0 rtrmo3iodfmteln ol(  exr(o3oy4apte feil()sDur(mp;u4alx iociytls2ran o (0aeenxf3iydfp rln ols sexrxrpny1lp n ietasfsrrmx pnt4opt ioeias aDua(mo () rxrif3iotfptran ils0srur(r3iydlmeelnctas)sDta(  ;o4alt  feiaslm2raumo (4tleoircty1oateaieo;()s2trxm ou4ol  mictas)a2uaxmp;t1oltomo3iltfm uaumo;(4trermfcty1fpDelivilt s2xrxmpny1ap n fcs s) Drmxmpnt0tlxomf3iytfs em( p;(4arxoxf iy1fm  li o;t  2ur(r nu1apen nvias  Dtaxmoou0alxnifetasfsDrm(mp;u)tlenmf3oatfa  auvo;s)t2xrxm3no4lm nmfcilsfsrra(  oo4olenioetysfsDeluvsnu0 reomocoa1optr nvs () 2xm(mpnu1ameelnesltfaDumuroou0aee mi3iltls uaumon(0aeermr oa1lp  anvs;t0truo(rpoy4amt micsl( a2rrxrpnt1aeeo o3iyslsDumnmo (4 rxnif3ia1omte u olt  2xm(opiu4omtnmfcta(farraum ot0olxnmfctldfaDel( snu0aetniociodop  li sls)t2uoio3iu4olt lnvsl(  2ta(root0tee  i3iltfs emn s;u0altomf3iotla  livi;t0 2xrir ny1ll n iet ()artrx ono0tet iietlt s2ua( pnu0 exnirciotoaD lieilt  rtoxo iy1ol   iei s  2tm( p;u4opxo ieiyd mDrm( p;t4 rxnmf3oo1op r ies s0sexmxopou4lm  mies (f Dum( oot4aexnii3tadlsDem( pn(4tetoir3tadlp rli i;t0s2toxmpno4amtelfvsl(faDuaumono0tetoioeildfs ul( o;t0 rermo3ootlmtrlnvil(0 euoxm3oudopenmfct t aDraxrpoo4tpt mo3tysla el( o u0trenmoctytlatelnvo t srtm(o nu4ame lfeils)srur(rp;o4olenmicilsfs2ulumo;(0artnxr oytfptrluvi s0trtrir3oy4omee fcslsf Dtmx oot1aexnii3ild a2emnvs t4trerxoctytlpDe uvol(0 2to(opnodllt lici (fsrurum nu0apxomoeiytfa ea(vonu0arxoio oy1fateai s;t)trxmxr3oo4ome lfctl() 2tmu o;u4altoioeiytla eauvo;(0 leomrcootlp rliesl(0t2trxr3oydomtelfes (fsrrrump;o0aex  ieilsfmDua(vpnt)aetrir totfm r nvs ( texoir iy4am n nvt tfa2urxmp;u1aleniociasls2em(ms;t4artnio io1oaDe ues t  exmxr iy4llte fcia(  2ra(m ;o4olxnioeiytla el(vs;(0 rtnxrctatfa  auvsls0srtr(m no4omtnliesls)artax pot1aleomfetys aDrlu onu0 etnmf3ia1oa elnvo ( trtr(rpno1am  mnvt t  Duaxr ;t0oetnifciyd m ranmsn()trtoxo3ootfa rli i (0 rxr(r3oy4olt  fvtat sDumx  ;u1alx iietytla2em(mpnt0trxrxfciodfp rluvs;(  2toxrpio4al n iesa(f Dra(  ;o0tptomi3ias m rmump u)arxoif3iatoaDe nvi;t0 2toir oy1ap nmfei ()artmx pot0aptn i3ildfs ean o t0aleoio3oydom  aiei s0 2tm(mpou4om  lictltf rta(r ;t0tex mf3tltfaDrauvsn(0alxnir oy1op eanvo;(  2tm(m3iu4lmt mfvsas) rtau pnt1tltn feiatlmDrl(msn(0 rxrxo iy1lm  aies;(0t2tm(opny4ol n ivt ( a2um(r oo1oltomoctld aDemuvont4 rtnmo io1opDran ilt)srtrir3ou4opeemfcias aDumxr no1tpe  fctasfs2rln sn(0trxoxf3oodfmDe uvo ( sruoxr3ou1lptelivt s s2tr(mp;t1aetn f3iltls2ua( s (4 rxnif iydlaD luvi;s)tetrxopnu4optelfvsl(f Drr(ro;o0oetoiieiyd aDuaums;(4 rtoxo io1fa   i i t srtrio oydapee fesasfsrumxmoou1altnmoetldls rmnvs;u4arxoif to1faD aivs;( trxmim iu1oltnmnvi sfsDtrxront4aexomf3iadfa2ua( s (0areoir3oatopt auvi s0truoio3no4ope lncsas)a2ta( ono1oltnifetasfa umuvs;u)tetoif ootfm eln i;t  ruoimpno4lptnlnctl(  rurx poo0tee  ietlsfaDemu p;t4aetnxr3to1om rau ol(0seuoxo3no1lmee net s)a2tau p;u4oetoio3ias s ulnms u4aetoxr iotla rlnvi;() 2xmxopny4omenmivta()sDuaumpot1ole io3iytla uanvo t4texrxf3ty1om eauvi t  2xrirpiodaleelfcsat)sDrrxr no0apt ii3ildfm2eaums;() rxoxo3iotfat lnei;()srtoio3oy4lp n ietltfa2tmxr nt4tltnifetldlm ulnvo u) exrif ty1lateai i;t0 2uoxopnodop n netas) Dtm(rpoo4oee iociyt m rlumonu0 rxnmf todlmD aueslt  2xm(r nu1lmt mietas srururpot1teenmoeildlmDemnvp t4trxrmo totlmte nvi;t)tetmxm3nodop emfeta( a2umx  ot4tpenmociytfs2eau p;t4alxrxr3iy1lm ranvi t texoio oy4altemicsltf Durxr nt0openmoeiytlmDemnvo u4 renxr oa1fa  ln o;t setr(o iudlltemics s s2taxro;u4texo ocias m2ea( o u4 rerxr oatlpD  n i;t0tetr(o iydalt  netls)arrmxm no4aetoif3tyd sDuaumont)arxrmociodlmD  ieolt s2xo(rpou1oltn fciatfaDtr(mpot0alx  iciad sDum(vpnt) eeriociy1oaDe uvi;s)s2xmim iy1altelnei (  rtmurpnt4olt mo3tytfa2ul( o;t0artrxo3oytomDeau o t trxrxo3iydol nmneiatfaDuaxmoou4tltnmoeiad m ea(mp;u0aeenif3ty1op   i s;() 2umxo3iy4lltnmnvil( sDrmumpot4opeomieiydlmDumumsnu) etrio ty1laDrlivs ( t2xr(mpiodom nliesasfaruaumo;t0tpt mfeilslm2eanvs t4 leomf tatlpteliei;s0s2toir3iodame  feils aDtaxrp;u0ope mfetydla2rl(mo u)tetrir3oa1oa rlueol( t2tmxm3iudlp n fvtlt)s2ra(  oo1oexn ociadfmDrl( o t)trerxr tydlp r i ols) rtr(m3oodlle mfcsa()artrxrooo4altn i3tysla2el(mon()tlxrmfctotfm eaivs;s0seuo(o oo1olee fcilt arrmuroot1tltnmi3iasfaDemnmo;u) lxnir3iodfmtelnvs () 2tm(opiu4apee fctlt sDraxr ;t4apx  f3iyt m2eaumpn(0tetoifcoodfa e ieo;s0t2xo(o oydll  mfcsas)s2tr(rpnt0olxo o3ild mDelu pn(0tetrmr3tatoat aieol(0trumxm nu4apenlivils srrax onu1apt  feiatfm rmn p ()arerif io1opte nvil()trxoir3ny4om   ncia()aDrm(mo;o4olxn ociyt sDemnmo t4teenmrcootlm eauesl(0seto(o nu1ll  livsl() rtm(rpno1apxn o3ias a2rau on(4 ltrxf oydoaD  nvo;t0s2trxrpoydoleemivs t  rrmu ono1teenmiciltla eln p;(4aexomr3iodlmDeaieolt)tetmxr iydape mfes (fartrurono0tle mi3iytfaDua(mp;(4 lxnircio1omtrau s s)srxrxo nodom e nvs s)arururp;o0aeenioetatla2elumsnu) rxomrcta1lp eln olt trxmiopoy1apenlivt s)a2taur no4tle iietadfsDuln s u4aexomocoa1op eaivslt  exoxopiu1lleelfct tfsDrmxrp;t1aexoiieiys sDemump;()tlxoxf totfmt ln slt  eurxr3nydlp n ieilsfartm(r oo0olx iictydls uan p;u)trtrmrctytop  aieolt s2ur(m3no1ll nmneiatfsDtau  ;u0tleoifeiysfs2ua(mo;u) rtrmr to1lmtrau olt)teumxrpiodaptnlnvi sfsDrm(  ot4tpenmo3iad a rmu p (0arenmo3oodoaD lnei t0trxoxm3oo4lm elivsasfa2taurpot4ale moeildlm umn ont0tlxrmr oatfaD lu ols  2xmxm3ny1altn ivsatf 2rmu pno0oltn fctasfm uan p (4altrmo3tydfp  aivs s  rurxm oy1optelicsl( a2ur(r ot0ole  f3tadls em(vs;() ltrxf ootlaDr ieo;(0trurxr oydal emieias  Dtr(  nt1oltnmo3iatlaDrlumo () rermrciodfptr nvi s  rxm(o3nydlle  ncsls)arrau p;t0alx mf3tytla ra( p;t4treoiociatlatrauvo t0 rumxrpnu1omt lfvtlsfarumum ;t0tlen f3ilsfs2rlnmo t0trenxo3oytfpDr i ol( s2umir no4ame livsat  2rm(  ou0oee mf3iydfa2um(vsnu4 rtnxrciytlm e u o;s0trtr(o3no4omtnlfvsat  rua(m ;u4olt mf3tldfa rl(vo;u0teenxo oytopt an sl(0s2tmxm iudap   fvtlsfs2ta( pot4ole  ictlslmDum(vsn(0 eerxo3iodlptrln i () exrxopno1lmtn nes (  rra(mp;t0ope mociys sDea(ms (0 leoiociotlmDean o (  rxoimpoo1lm nlfvt t) 2rrxronu0alt  fctat s ul( snt4arerio3to1oatrln s s  2xm(mpoodlm emictlt s2ra(rp;t4tltnifeiytla2el( pnt)aetnifcoytlm e i sl( s2tmxo nydom  livil(farua(rpot0tlt ioeiatls2rmuvp;t4tlxomr todla rln o s0s2urxm3nudomee ivtl(f rraumpoo1tpx mfetltlmDrm( s;u)tlxrxo3iytoa e uvo s0 rtmim3nu1lmtnmnvtl(faDraumo;u0tpt ioeiat aDra(vp u0tlxoxf3oo1lat lueolt)t2umxopiu4lleemnetl(fs2uaumpoo0aeeoif3iys s ulnmont)tlxomfciy1lp  lnvs s0 etr(r nu1lle  nei s a2rmxr ;t1tpxo o3iad mDuluvon(0 rtrmo3iatfmtrai i;s0 rxmxo3oy1ole lnvta(faDtruro;u0oetn ictls s2rl( o;() exoifcoo1la e ies;()t2toirpiy1ape lieiasfaDra(moou0open iciydlm2umums;u4aeeoif oy1lm raivo t)srto(r io1ape  ictas)sDrrumoot4tlx mfeiys m eanvpnt0aetnxo iydlptrlu o;s srxmxm3no4altemfvia( s2raxrooo4teeomfctltlmDuaums;(4aeeoif3oa1lpt ai ilt) etmxm oudll emfvta() Dur(  nt4alenmfctasla2eluvs t4texoxrciydoaDrai il(0 2xrio3iy4al e nvt ( sDumur no0oetnmfetltlmDel(vo t0tltrxrciytoptr i i;s  rum(o iy1ale mfeta( srta( poo4opxn octlslaDrm(vp (0aetomr ty1fpD aneo;s0s2umio3oo4lptemncsls aDumum ;o4teenmo3ias s2ua( on(4texrmfcoydlpD an i;s truoxrpou4openmfcia( s2rax onu0opeo i3tatla2ulumsn(0 renmfcio1om  anvs;(0srxoxm3no4llt  fcs (fa2umu oot0aexnio3ias aDrlu pnu)texrxo3oydlmD luvols0t2xoxrpio1opte nesatf rumumo;u4apenmoetat sDeauvp u0 eeniocto1lpt aies;(0 eurio3oydape mncsat  rtr(rpnt4aeeo ocilslaDelu s;t0artoxf tadfpDelu o () ruo(m3oodlpt  nctat srtr(mpot0alt if3tydla uluvo u0 etriociadfaDeaies;()tetmxm nodapenmfctas  ruru  oo0apto o3iltlm el(vs u)areoif3iydfpD  ivo t0teum(o3iy4opeemfvtlt) rur(rono4olx iietas aDemnmp;(0alenxo3ootlmD  nvolt) 2tm(m3iy1lm elnetls sDrr( pno0olxnmfciltls emn pnu0artnifcoo1laD lnvil(0 2triopnodam  lies (  2rm(mp;t4optoifciltla2rlnmo t4 rxnxrcia1oateai s;(  2xoimpoydlptelfctat)arraxrp;o4texoifeiytfa2ranvsn(0 exnxf3oodlmteluvo (  eurxo3oudal nlncsa()srrrx oou1tptoiieiydlm2ea(vp u0tlenxo3iy1oa eluei (0 rtm(rpiu4oltelfcs t)arrmur oo0tlt moeiyslsDean s (4tltnmr todlmDr nei;s0t2xrir oo4ome  fct t  2uaxro;o4oetnmfctld a2uanmp t0trxnio3iodomDe uei ( trxo(rpno1ome lfvia( a2trxrp;u1apxnmo3iydfa ra(vs;() eerifcoydfm  anvils  2xmxopny1omen iciltfartaum oo0tptomoetls sDuanvp t) lermrcoatfaDr neo;t  2tmimpoudol   nctas) Drmxrono1alenmi3iatls rauvs;t0alerxo oadomt auvs;s)trurirpoydalt licta() 2tm( pot1apeoii3tad m uln o ()trtriocta1late u o;t  rxmxrpiy4lme  fcils a2um(m nu0tlt  i3iysls umumo;(4tltrio ia1op eanvolt0texm(opiy1al nmfvils)artrur oo1apeo ociasfmDra(mp (4 eenmo oa1opteaueo;s)s2xmim io1apt lncslt)a2raur ot1aeen fciysfa2elnmon(4artnmr3io1lm e ivo t)srumir3no4ll  mnct ()a2tm(m no0oexoiieilt s eluvp;u0 lenxo totfmD aues;( trxo(o3oo1lptelivi s) rtaxrpou1aetoiietlt m2ua(vo t0 lenio oadfpDraiesls s2tmxr3ou1llen ietls)aDtmumono1opxn i3iad m2eau o ()trenmfcoydla  lieo;t s2tmxr nu1lpt  fet (  2tm(mpoo0apt ii3tldla ra( o;(4trxnxf io1fat  nvo;s) 2xoxr3oudame  feils)s2tm(mo;o0apenmieils m2um(vpn(4 rxoir tatfmDr nvs ()s2xoxr3ny4am e neiasfa2rmxmpnu0oeenifetat m ul(mo;t4 etoifctydlpD luei;() eumio oy4oltn ieil(fsrua( oou0ole miciltfs2ra(ms;t4 leomr3ia1lpteaivol(0 2xr(m3nodop n fci s a2ur(m ot0alen oeiltlm el(vs t4aexrmr iydomtrai i s)trtmir3ou1op elfvia(  2ur( oot0apxo o3ilsfs2eln p;u0 eenxo3tytla r i i ( seurxr3oydlle lfcsatf 2ta( o;u1olx  ictydls2rlnmsn(4aetoxfcio1faDraivo;t  ruoio3ou1lp e neslsfa2rrur ot0aexomocils sDumumonu)tlermf3tydlpD lnvil(0 eurir ny4lleeliesl()arrr(rp;o4olxn oeild a em(mpnu)aetomo3iotoaDeli o;t  2uoxopnydlpenmfci ( aDtr(ronu0apt ii3ilsfa rm(ms;t) exnir oydoaDe u ils)trtoio oudomeelfvia(f 2ur(rpou4tex mo3tyd s2emnms t0 renmr ta1fm eaneil()teumxm iy1lltemnvsat aDrmuro;o1tltnifetysfm el( s;(4aexnmf3iytlateluei (  rtmxrpnudome lncsat  2ur(r ;o0tpenio3iatls uln pnt) renxr3todoateln s;s)seumxr oodap emivt ()a2tm(rpoo0aeeomo3iyt a ua(vo;(4tetrxf3totfm e ivil( srxrxrpiodop  micsls)s2rrx p;t4tpx mieiatla2elumo;u4texrifcty1omDr ueslt) exo(rpou1lmee fci t) Dtr(ro;u1tex  f3tld m eluvsn(0trxrxr3oadom e nvil(  exrirpiy4oltemnvsl(farra(  no1tpe ioeiysfsDem(vsnt4 exrxrcoatfateanei t t2tmim ny4ape  fetls) Duaxrp;o4tpto ietlsla uluvont0 etrmrcto1faDeauesls)setoxr iu4ap emfctatf rumxmoou1opto octysfs ra(vo ()aeeomocoodopDrlies (0 rtrirpio1apt mncslsfaDurxmooo1tpx  feiadlm umnvpn()aetrxr oodfpDr ivslt t2trim no4ale lieils s2rmur oo0opeomoeias aDrmn s;u)alxnmrcto1oaDrln o t s2tmirpiodlltn fvs sf 2rm(rpot4tpt  fetasla ran o;(0tetrmf io1fp eaivilt)srtoir3oy1al e fcs (  2umxrpno4tpt ifctlslm umnvs;(4trermrciydlaD auvi;s0s2toiopou4am  mfciatf 2rmurp;o4oeeomi3tasfs ulu pnu) exoiocta1fpDrlivol(0s2xoio nodapee ici (f rrmxmp;o1alx  oeiatfaDeau pn()aetrxr3oa1fa elu s t)s2tmimpny1apt livtlt)aDrrxm ;o1tpe iictytfs2em( pnt)alenmoctotfptrau s;t0 ruo(rpoodomte neta(faDurum oo1tlt ioeiysfaDuan o;(4 etrmo3iydoat  ueo;t trxmxr iudam elfvtls)arumu pno4aeeoifetld s2emu on(4 rxoio3ia1fm eanvs;s0 eto(rpiodam nlfvsl(fsrtaxrpot0opeomfcilsfa2emn o u0texrmr3tydfmtr u ilt0sexo(m3nu4lmte fvtlt)srrru  no0optniiciadlsDuln p u0tlxrxo oy1fmt lnvs s srtrio iudoltnmivsa()aDrmxr oo4texnmfeias m raumpnt0aetoxo3iy1omD anvs s seumirpiu4olte nesas)aDuax pou0oleomociaslaDrmuvs;u4 rtrif3ty1faDr neo () 2umir no4ol n nctlsf 2uaurp;t0oex mf3tad m2rlu onu)trermf3tadom r nvi;( s2umio oy4lm  lnvsas aDra(m ;o1tlxo i3iadlsDrmu on(0tetrir3oatlatrlnvo ()texoir oodlpe mncils  rtrxmoot1oleomiciys aDeau o;t0 rxrifciotop eai ols)srtr(r oo4llte fesasfaDtmu ono4olen ietadlmDumnvs;()aetrif oatlmteluvs s)s2umxopiy1lp emncta( srrau pnu1oeeomf3tyt s2ul( snt0areomrcoa1omt lneslt0 2uoir3oy1ol n icta(fsrrm(mo;u1tet  o3tasls2ra( o;(4aexnmf3iydla  ln sl() 2uriopio4lp  mfvt sfsrtmxronu4aexomieiadfm ulnvp u) etrirciy1lateai i;t)texmimpnydaltnlfcsls) rtru poo0optomieias m2ran pnu0texoif3oytopDelueo;t) rtmxm3nodlpenmivsl()aDurx pou1oex mf3iltla ulnmo;(4aexrircio1lmteluvilt0 exm(opiu1om elnetasfa2taxrpnt1oeeomoetadlsDelump u4 lenxo3ia1lmtrluesls) etm(mpnu4om   fes sfa2taur nu1tlxomieilt aDuanmsnu4 eerxf3oy1opt liei t texm(m3io4lpeelivt s)a2ur(rpot4apt iociatfaDrluvo;u4 rxrxocio1lat  ivs ( t2xoiopoudape  ivtat)arrmxmpoo4tlx  ieilsfs2rl( p t0aetnxr iydlaDeauvo;s teum(opiudol nlnvsas srrrumpnt1opeoifciyt aDeauvo () rtnxo tadoaDelneil(0 ruoimpny4lmtnlnes sfs2tax pnt4aeenmo3ildfmDrm(vo (4 rtoxo oo1lptelneolt0 exoxr nu4olenmfvia( arrr(mpnt1aexnioetys s2rlnmsnt4tltnxrcto1lp eluesl()trum(m nu1omt lici ( s2urxrpnu1opxoif3iatla2emnmp;(0alerxfcto1oat lueol( tetoxopou1opeemfesa()s2tm(  nt4tlxoioeiydfmDrmums u4arermrcio1lmtelueo t s2urxo iudalee ivta( sruaxr ou4aexomociysfm2elnmp;u4trtrioctydoaD livslt0 2xo(mpoydll  lnes t)a2tax ont4tpxoiocils m uanvsnt4alerir3oa1omD  ues;s  exrxm oudlptnlnesl() 2rrxrpno0tlx ifeiltfs ulu p ()tlxomoctytfpDrluvs;s t2um(r3iu4ol   iesa( a2umxrpno4tpeomictltlm umnvs;(0altomocia1lat au il(0s2umim3iu4oleelncta()aDrm(root0oexnmociasfm2ul( on()trxomrcoo1fmDrlu o s)sruoir nydll n nvsasfa2tmxr ;u0tee mfetldfs uau s (4 eeoxo oo1latr uvslt teuoxopoy4am nlivtltfaDuru ooo1tpeomiciat s um(vp u0aetrmr3tytoate nvol(0s2uoxrpno1ll  mnetasf Drm(rp;u0olx  ieilslm2uaumo t4trxoxrciadfa  luvi;(0 2umxr io4llt mfes s)a2rmuro;u4optnif3iasfm2ran s ()treoif oodlm raies ()trur(m3oo4lltn ietas)aDtmurp;t4apen ociys mDrmuvo t0artnmf oy1laDraiei t setm(m3ny1ameemiesatfa2taurooo1teeo f3ias sDua(ms t0tetnir iotlmte uvo t t2xm(o iudllt lfvtlt) rururpnu1apenif3tyslaDeanmp t4 lenxf oytfpDe ies ( trxrimpiydll  miei (farumur ou4aet  o3ils m2umnvp t0alxnxr oydfmt  uvi;s) etmirpoydole mfei sfaDumu pnu1oex  ociasfmDrl(ms;(4aetrxr3ia1fmteanesl(0 eumim ou4ap emfcsa()artax p;o1tpx  ieils s ea(vs;t) lxrmf oodfmteai o;s)texo(o oo4amen fet tf Dta( ont4alxnifciytlsDulnmp (4aetrir tydfmt  ueo (  2xo(o3nu1apenmivil()sDtru ono1tptnioctls mDrauvo (0trxrxr oo1latrlnvi ( srumxm3iy1apenlivsl(faDtmxr ou0oex  icilsls umnvsnu4treoxf oadomt lies;(0t2urim oydam emfvsltf 2ua(r oo1tpeomieiyd s2elnvont0 ltrxo3todopD anvo ()seuoir3iu1lmeelfcias a2um(rpnu1tetnmi3iyd sDuaums;t0tetrio3iytoatran il(0 etmxm3ny1ll emfvi s)sDraur ;t4opt  ictltfaDelu o u4 lxnxf iytoatrlneo ( setrim nodopt  neiasfaDum( pnu1ale  fciys s ean o;t4aetnmfcoadlpDr ieils  euo(m nu1op e ivt t sruau  ou0optnioeilslm2rluvpnt0 exoxr oy1oat  i sl(0 2toirpoodlmte net t)srrm(mont1aptoio3iad a2umumo;t4 rtoxf oatfm r uvi s0 rxmxopoudaptemnvs sf rta(r ;u0aee miciat aDumuvon() rxnifciadop elivi s  eurxr3oo1am   nvsat) 2tax pno1tltoio3iatlm emu ont0trxoxr iy1omD  i o ( s2xrxrpoydlpt  ivia()aDrax o;t4tee ioetad a2rl( s (4areomf3ootfpt  nvo s0 etmimpoy1lmtemivs t)aDum( pnt1tex mfciatfa ulnvo u)tleoio3oa1omDr u ol() etrxopio4lptelnvi ( srtrur nu0aetn ocildlm rm( o (0aetrmr3oatfmD aies;t sexm(m3iodop emieia( aDrrx pou1oet mf3iasfa2ean p;()aleomr oytfp elies;()t2urxo oo4opt  ict (fa2rrxronu0tpxnifeiadlaDemn o (4 lxrxr iatoat aivs s) 2trir3iu4al emict (farrr(m ;t1tlxoii3iatfa rm(vsn(4trtnxf3ta1laD lnvslt srtoxm iodopt mfvia( sDtaxmpot0tet ioetlsfm el( onu0aeermocty1fatrlneilt0t2tmxr nudlpenmfci (  2tm(rpot1tex  oeiasfm rau o;t0texrxo oo1fmDe uvols t2xrxrpnu1alenlics (f Dra(ronu0ope  octas m uanvs;u4arxrmf oy1lat  nvs t) 2trxr io1lp elfcsat)artrx  ot1aeen fciad a uln on(0tlxnxrciytlatelu s t s2xo(m3nodlmtemieia()aDurxm ;t4tlt ioeildla2ea(vpnu4areoif oy1lmD  neo;t teurxmpiu4lp e nvs () 2ur( pnu1oetomfctltlm2rmnms ()teeoxrcoa1oat  nei;s0 rxoxo3oodol  lfeils)arururono1opt  iciaslmDelu s;t4trtnio ty1lptrai olt)t2xoxm3no1op  lieslt)a2um(m ;u4tle mictadfs2elu snt0treomr3todlatr n ol(  2xmim iy1lpt livs tf rtm(mpnu4tlt ifeiyt sDua( s () lxoirciatop eli ols0teum(r oudalee fcta(fa2urxmpou0tpxniieiadls ulnvsn(0tlenmf oadom  luvo s)srxoxo3oy4ope  net s srtmu  no1teeoiociys s2elu snt4alenmf3ty1fmt aiei;s trxr(rpno4oltnlfet t  2rr(r ;t1altomoctat s2raump;u) exnxr tytfpDelnvs ( t2tmxmpiudopeelneilsfsDta(mo;o0apxomietlsls2ran o u4trtoio iy1fa eau s;s seur(mpnydlle  fcs ( aDtrxmo;u4aleoio3iysfa2ul( snt4altnxo3iadlmte nvo;s0sruoxopnudoltn fvi t) ruau p;u1tpeomfetadfs ua(msnu0 leoir iydfaDr ueil()sexrxm3iydome  fesl( s2trumoot1tee ii3iytlsDul(ms;u0tetnmf3totlm eli sls t2trxmpoy1opee nei sf rrmu  nu0opx mfciydfm ean p;()tlxrxo3oytlaDrliesl( srxmxr no1ol e iviatf Drmxro;t1altnio3tltfmDumu snu)aetriociodoptelneo s0trtr(o iu1alteliesltf rraxmoot1opxnmoeiydfaDranmsn() lenmo todopt lnvs;(0trtoim3nodal n iet s)s2taxmo;u0aexnioctls sDul(vont4arenxrcoodoatr uvi ( trxmimpoo4al  mfet (  Dtm(mpou4alx mfciydlmDum( o;(0aleomfcio1fatelivolt  2xmxm3iydlpee fvi ( arum(mpnu1opxo fctydfm eanms;t4altoif3iydlmDe i i t)t2urimpoo4ap emiet (fa2urxm nt1opxoifetad aDeau s;() rtrmrcty1opD aneo;t) etrxo3iudap  mnvtasfsrtrx  oo0apeomieiltlsDrm(monu)trtoir3iatopDelueo t0 etmxr3iudapt lfvs t  2urumonu4tetniiciatlsDelu s;u)aexoxr iadlp   n s s srurxr nu1op n fvtl( sruau  nu1ape  oeiadfmDum(ms;u4aetrxf3iotfpt aieo;t  euoxo oodolte net t)s2rrumoot0aexomieildfs rmuvp (0texoxf3io1optr u o;()s2uoxrpou1op n fes ()aDrmu  no0aet mi3tldfa uln o u4tlenif3ty1fpD luvo (0t2tmxopiu1omt lfetatfs2tau oot0oleoifeiasfs ua(vs t)alxrxr oo1laD anes;(0trtoxr oo1oltn nvilt) Drm(m ot4ole iicildlm eauvont4tlxoiocio1lat lieils)seum(o nu4lpt  ict ()sDtru  ;o0aex mieiytfsDeauvo (4aexoxf to1fptelivo (0trxm(o3io1lmt lnct ()s2rr(mp;o1oexn ociadfsDem(vont0alermr3iodfat  uvs s0s2urimpny4omt mnet sfarur(r oo0aleo ictlsfa2em( snu4 lxnmrcoydlptranvo s0t2xo(m no1lmtnlicsa()sDtmx  ;t1oetnifeiat s2uaumont)aexrirciodopDrlivo t  eurxm3iydop nlivtl()artaxmoou1altnmiciatlm uanmpnt) eenxr3ta1fmtraueo t texr(rpou1opee nei (  rrmx poo0aptnif3iltla2uln o t)aeenxo3iotomDean i t t2xoxrpoydolenmnvt sfaDraxr ;u1aeeomfeiltlm2rmuvonu4 ltrxfciy1fmt aneols truoiopoo4lltn nvils a2taumo;u4texnioctydfm2emumsnu)aexrmrctytlaD aueo (  2xrxm ny1op emnciat sruaxm ;t1tee moetltla emnvo;()aeenio oodfa   ivslt)tetrim3ou4amt lieslt  Dtmxmpou4tlx mfctyd s rmnmo ()arerir3iatlatean i s s2xrxr oy4olee nvilt  rraurono1apt mo3iydfmDrm(vo (4trenifcta1opDr ueo;( trtoxo3oodalt  fvil(fa2ua( oou4alx mfeiasla um( p;()aetnif3ootla eaiei (0trto(o oy4lp elfct sfaDuaumpnt4tlto o3iltls eauvon(4aetnxfctytfmtr u i;t) rumim iu4lltnmncsas) 2tr(r ;t1aeeoiieiyt a2rmn p;()texrmo3iytla r ivs;()trurxopny4lle mivil()arumumont1olt mocilslm2em(msn(0 rtnmr ootfp rau sls)trxmirpio4amenlfesl(  2umxm ;u1oex  fciltfm emnvs;t4 exomo3io1oatr uvi;t  2xoirpoudomtelfvtasfsrtm(rpou1alt ioctad sDulu s u4altrmocoy1omD aieil(  rum(m3no4ape lneil(fa2tau p;u1oeeoii3iadfsDelumonu)arxoxrctodoatran i;t sruo(opiy4optnlfvi s sDumu pnt0tee mictasfm2rl( onu4tetoio3oa1lpt au s s0 2xoim3oy4lpt mfvias) 2trxmoou4aex mf3iytlm ua(mont)trtnir3to1lmDrau i;t srto(opou4om nlnci (  Dur(  no4opeo feils s ranmsn(4artrio oydla rli i s0seuoxmpno1lmtn nesas  rtr(monu1tpxnmf3iasfsDranvo () lxrxfctydlmDe neols) 2ur(o oudomt  fetat a2rmxr nt0aee ioeiydfaDumuvon()arxrmfcto1omteluvilt0 rurio3oy1lp  lfesls artrxmonu4aleoifetad m elu s ()tlxnxr iatom eaueol()t2xrim3no1optelfvi () Drm(m no4teenioctat s ra( onu4trtrif ta1om eai i;(0t2urio nudam nlfetlt  Dumx ont4apxoifctltlmDel(von(0tlxrxo3todomDrln i;(0trtmxo3nudam nmnvilsfaDtru ooo4tlxomo3tyt s rln snt0aeeoxrcoytfpt  u o;s0srumirpiu4llt miei sfsDuaxmoou4oleomo3ilt sDrm(mont)arxnxo ootfmDrlu s s0 2xm(r3ou1amte netl()sDtrxr ot0alxo icildlmDranvsn(0 rtoio3tatoa e n i s) euoio iodom elivsas s2raxmpot0optomoeiytlm2emums t4texnxocoadopD an o;s0s2uo(r3no1al  livi sfs2umx  nu0aexniieiatfm2ea(mont4arxnmocoydlp eluvi s)tetoio3oo1lptnmiei s sDtaxrpoo0tex io3iat s2emnmp u) exrmo tatfa rlnvil(0texmxo oy1ope mnet t aDtmx ono0tet miciysfmDua( o;t4arxnxr3oodoaD livo t  exmim3io4amenmfvils sDtrxrpot4oee ifcilt sDelu p (0tlenxr3oy1opt li il() rxmimpiydalen ivilt)aDrmum ;u0aet iociasfm ul(ms u) rxomo todomtrlivslt)t2tm(m no4lpenlnctat artmumonu1tptniociysfs2rm(ms;()tetrir3iadla  lies s t2tm(mpnu4omeemicsl(  Draxront1alt ifciatla ranmo ()aexnio3iatoat anvi;()seur(m no4ll n icslsfartm(mono4oltn fciysfmDelnvp;t4arxomrctydlmDr nesls  rto(o3oudll  miei ( s2rrxmp;o1aetn f3tyd s2ulu s;t4tlxomo3oy1omDrai s;s trxoimpny4am  miesat a2ta(r ot4oex  o3ildfmDulu onu4trenxf iadoa   nes;()teurxo oy1om  mncslt aruru p;t0tptoii3tadla2rmuvsn(4aetoiocty1fmt  nvs (  etmxr3iy1oltemfvtasf Dum(ro;o1optnmfeiatfa2em( p t4 etoir3iydfmtranvo t0t2xoxr io1lme lnctls  rtaxrpnu1oleo ieiltfmDrauvs;()tlxrir oy1laD livi;t s2toio io1aptemnetl(  rururoou0tee mfeiasfa rmumsnu)teenio3oodlmDr u ilt)s2toxo nu4ap elivsl(fsrraum ;u0ape iieiytls2ranmo u4 renxo3tadom rlivs;(0texrio3iy1alenmivt sfsrumx pou0olt io3iyd m2eanmsnu4tetnxf iodomD  nvi;(  euoxr3no4alee nvia(  Dumu pno4teeo ocilsla2em(vpnt4trxrmf3ta1lpDr i s s) eumir3oy1optnlnvs s  2uax  no1oee mo3iltla2el(mo;(4tlxrir tadlat luvi;t0srurxopiu1ol  mnvsa()aDuax  ot1alxoiiciytlaDrauvpnt0aetoir iodfm  anvs;()s2urxrpiydlmtn nctls  Drax pnt0oetoif3ilt aDeln sn()arermrctatop rlivsls  2xriopiudapt  fcs ()arrruroou0aexnioeiyslsDem( p t)trxoircoadfpD  u il( teuoxm3nodlpenmfeilt)arurx  ;u1tptn ociadfs ua(mo t4alxriociytfp r nvi;s seuriopoodlmte ies s) Drr( pnu4tltomoeiasfa emn o u0tlxomociy1omDraiei s s2ur(rpoo1om  livs sfsDrrxmpoo4tltomi3ild sDea( o;t0 exoio iodfaDeai olt0s2xmxm io4lpe lnetlt srurx p;o4olen iciysfm umums;u)texoxrctadfa ean s;s0seuoiopiu1lp elfcs ( s2rmurpnt4tetoifeildlm uau pn(4tetrmocto1fa rlneo t sexo(m3ou1om nlfet (  rumxroot4aeeoifeilt sDeanmonu)trtomo totlm rlies;(0 2um(m3iydapeemfvtl(faDum(  ;u0olt mfetytfa2el(vs u0 eenmrcoodfpD  nvi ( t2xmxmpiydomt lieils)sDrruroou1aexomociydla2emumo t0trxomr3oy1lpD lnvslt) rtoxo3ou4optemfeiatfa2rau ooo0optniiciadlm2ua(vont)trtoifcootlpD aueslt)srum(m ny1apte ivias  rur(  ;u4tptoioctys mDul(mp;(0aetoxf3oa1fp rli i (0setrir3ou4apen nes sfsDur(mo;o0oleomf3ilslaDrmnvpn(0aeeomrctodfa   nvo t tetoiopnudolt  iviat)srurx pnt0oeeoio3iytlm eaumo;u4 leniocoa1om eaivi s0 eumir3nu4lltnlivil() Dum(rpnt4oeenmfetytla2rm( snu4 rtrxfciy1oa ranvil()s2umio3io4apenlfetasfs2umu onu1oexomi3ilsfm2ranmo t4 leoif3ootoateaiei;s)s2um(mpiu1al  lfetltfsrumxm ou4alenmo3ildfs emu o;(4tltrxo3ta1lmD lueo;(  2trxo oy1lmte fcs (  rra(  nu1aptnifctytlaDrm(vsnu4artrmo ta1lmDrli i ()texoxm3ou1lpenlicil(fa2ur(  ot4tlxoifctasla eauvpnu) eeoiociadlptrau s s)s2toio3no4amtnlivi ( artmumo;o1aleo fctldlmDrau pnt4trerxocty1opt livs;( t2uo(mpoo1ap   fcslt srumu o;o1aleoifetltfm um(vp;(4arxnirctydomt  ivi;( seto(m3ny1lp nmivi tfa2rmxro;u1ope  fciasls elnvo u0tltoxf3iotfp  lu o;s  exrimpiu1om  lnesl(fsDuauroou4opxnmfctas a rmnmo;t)treoxr oa1lp  lnvs;s teum(m3oydol e iei sf Drrx p;u0oetomfciadlsDelnvpn() rtoxr3tatopD an olt t2uoxo3ny4optn ici t artmxmpoo0aptn i3iadls2rmu p;t4areriocty1oatrau il(0t2urxo3no1lp   fct ()s2rrx pou1aleo f3tldfaDumnmp;u) lenmo ootop  anei s)t2xriopiudopte fctat) rrru  oo1tpt mictld a uluvp;u)aexnmr3oy1fatraneilt0 etrir3iodomen feils) Dtmx pou4tlenmieiytlm ra(vp (4 lenxrcootfm  an olt trtr(o iy4omeemfcsas s2trump;o0aeeniieiytfa2rlnmon(4alxoiociydlate nvi t0 etmirpnudll elfvi (f 2ta(m oo0tlxomieils a ulumon()aetoxfciotom  lnes () rtoxo no4alt livil()srtmxr ;o1alx ioeias sDem( s;t)artrir tydop elueo;t)sexr(o nu1amee iesl(fa2tru pou4tlx  i3iatfm rmnmsnt) etoxf3oo1la  luei (0truo(m iodaleemivsatfsrur( onu4aeen fetltlaDuluvs u0arxrxr3todoaD  n i;s)sexmxo oodlmtn icslt a2taxmo;t1tlt  ieiatfm rm(vo t)treoxf tydfpDraiei;s trumir3iy1lm n ncils)s2umx p;t1teeo fciys s2ea(vs t0arxnio iotoatrai ols)srtrxmpoudlm  mfesatfsrum( poo0aptniictatlm2uau o u0 etnir3todopt liei s)teum(r3nudlm  mncsat)a2trx pot1oltnifciad m el( sn(4 rtrxo oodlp r ueo s0seuo(mpny1ameemivt t  Dtrx  ou0tpeo iciatfaDemn pnu4trtrxf3oytoa rlivo;t srxmiopio4olte feta()srrrumoou1aleniietadfm ra(msn()tleoxf3iodoaD lnvo;(  2xrxo3io4ome mivi (fsDur(m nu4tlenifeiysfa2eauvp;u0 lxnifcoytlpt lieo s0t2tm(o3iy4opte iet s  Duaxro;o0olenmo3iadla2eanmsnu4aexnxf io1la   n s;t  rtmxm nydale mfciasfaDtrx  no1ole ifeiydlaDuau sn(4aexnxrcto1omDeaiei ( t2xrio3oy4ape mnvtl()sDrrurpot0optnmoctlslm2rmu o t0tlenmo oytfm  auvo;(0 rxmxo nudll  livsls) 2tm(  nt4tlt mocildlm2em(vp t0 rxrxo3iy1lat li sl(0srxmim3oo4lm nmivilt)artmum ou1open ictltfm2ra(mon(0altnxf totfm  ln sl( srxo(m iy4llt livt (faDtm( pot1olxomiciydlaDul( pnu0 ltrmfciytlpDrlnei ()trxmxr3iu4lmtn ici s) rtmx p;o0olto fciat m2ul( p u0tleoif3oydlmDean slt  2umxo oy4olt liet ()aDtm(rpou0texomf3iyt aDulnmpnt4 reoif3tydfmD livs;s0s2xmio3oy4op   fvsat)sDtau o;o0apeomf3ild s2rl( o (0arxomr oy1lmDelnvo;s0sexoio3iudlp nlncslt)s2rmu  nt1oltn iciydlaDrmn o (4aleoxo3ta1lp  aueslt)s2um(mpou4ap elnetat) rrm(r ;t0opt moetadla2uanmon(0 ltoio3ootlpteaieils0trto(o oo4ll nlfetl()sDururpou1oexn ictys a2ea(ms u4aeerxr3oo1fmD anei (0 2xrxopnudom n fvi ( artrxmpot1alt  ociatlsDranvo;u)arxoxr ia1oaD an o s0 etmio3io1amt  nes (fsDum(  ou4tpt ioetld sDemu ont) eerirciydom rlivslt) ruo(o3nu1ame  ivsl( aDraxm oo0oleomoctyd m eauvs t)aetrmoctytoa  aivi s teuoxo3oo1ome mnvsat)a2raurpno4ale mf3tysfa em(vp u)altnir3iydfpDrln o;(0s2umxr3iy1amen nvtlt) 2uax  ot0apxoif3iasla uln snu0altrio ootopD ai i (0trxm(o3oo4lp   nes s)s2ra(mooo0tle mfeiyd sDua(mp u)texrxrcoytfa rlneo s)texrirpiudllen icils a2rmur oo0opxn ictld sDem(mp t) rxomfctadfpDran ols)t2trimpnu4omen ietltfsDrm(mooo0oee mo3iasfs2raumo;()tlerif3ootfmDelivilt0 rxrxm3ny1ame  ies sfaDum( p;u0ole  oeild a uanmsnu)aeermrcty1oat lueslt0setoir3iu4lmt  nctatf 2umxmo;o4opeoifciysfs eaumpnt4aetomfctotoptrau s;() ruo(o3no1lmtnlnctltfs2urur oo0oetnif3ilsls ea(ms;u4 renxfctotlmD ln i t0sexrxo iy1lptn nvsls srtr(r ou4openmoetysfa2uluvon(0 lermr iy1lmtelnvi;(0setm(o3oy1llenmnesl(faDuax  nu4opeomfctldlaDelnvp u0 ltnmfctytfa e nes t)s2toxr3nodale  ics tfsruau p;o4aptoif3iad a ran o;(4alerxf3iy1om elnvilt0t2tr(m nu1ole mnct ( aDtaxr ;o4aee iiciydlm ea( s;t) eenxr ootfm  aivs s texo(r nodomtelicslsfsDra( o;u1aeeomi3iydlsDuanmp;u)aeeomf ta1fmDr uvs;s srtmxr iu1ap n ieil(fsDta( pnt0aeeomfeiltlaDraumsn(0alerxrctytfmtr u slt s2xmxo3ou1ameelnetl() Dta(  ;o0apenioeildfm rl( p;()trxnmf iy1omDe i s;s)srtm(rpiu4lmtnlnct s) Draur nt0tetn ociysla2el(msnu4artomf ootfaD  uei;( s2xmimpiodaltnlfcia( arrmxr ;t4alen feiadla ean pn() eenxf ty1lpDrli ols  2trimpny4lp nlictlt artrxrpno4aet  ieiasfa rm(vo ()aetomfctadoat an i t trtoio3ny1optnmfcils)aDuaumpot1ope  o3iatfa emnvonu4tleoxocoytlpt anes;(0texoxopiu4amen fei t  Drrxrpnu4texo feiasls2eau p ()artrioctadoaDe ueo;t) 2to(m3oodalt mfes s artm(r ou0tpx iociydfm el( ont4tltrmf3oa1la  livo ( srxo(opnudol e net s)s2rmu pnt0aexnmf3iysla2rau o;u0teermociatfp  li s t tetrirpnodalt  nesas srrrurpot4tltoifciydla2eanms (0tlerxf totfate nvs;() etrir3oo1omt  ncia(farumxm nu1oexnifetytfs2emumo ()altnmr oatfaDr i i;(0trxo(m oo1altelfvsas) rrmx p;o0ope mociaslmDrl(msnu) lermo3oatfpD  n ilt) 2xmir nu4lp n fcsat aDum( ont4apxn ieiatlm uanvo u4 lenmr iotfm eaueol( teumxm3iu4amt  fesa(fsrrax onu0tpxoifeiadfa2ua(von(4trtoircoa1opt anvi;() exr(r oy1ome mnesa()s2rmu pnu1ole ioeilt s rl(vs (4trtrxrciadlptelnes t0t2xm(r nu1omt  icias) Drmxr oo1opeomociys m umuvon()altrir3oo1oaD  uvo;t texrir io4om  mfcsl()srta(mpnu4opxo oeiat aDranvo;u4 renxf ty1om  anvi;(0t2xmxr nydalte fcs ()s2tm(rpou4texomo3tls sDuanmp;u4altoio3oo1fpt ln s;t)s2toxo ny1lptelnesa() 2tm(mpnt0tptn fetld m2umums;t) lerir ta1fpDe uvi ()s2toxm3oo1llt miet sf Drru  oo1tlt  oeiatfs emnmp u4teeomo oytlmDrlneols0teumxm3oydalt lieia()artax oot4aexnifctydfsDel(vp t4 exrmoctytlmD  nei;( setrxm3iodam nlieils)aDrrxrooo4tltniociydlm2emu snt0tltnmo iotomte ueols0trtoim nudop  lfctatf 2tmurpnu0aleoii3iytla2ea(monu4aexrifciadfp eln i;t)trxo(opoudapeemicsl( arrau p;o4alto f3tat aDem( pnt0trtnmf iodfmDr ies;s) rtrio iydolt mici s) 2raump;o4aleo fctltfm eau p;(4alxrmo3iotom   neil(0trum(o io4al e fesl(fartmum ;t0apeniiciadls2rl(mo (4aetoifcia1oa  an i s  rxmxo3iu1aleelnvtls)s2rm(mpoo4oee iieiys s2rm( o u4treoir ty1lmtrlnvi;s)s2tm(rpiu4lptn iesat) 2tau o;t0tptoif3ilslmDeanvs;(4 lxoxf3iytoptran o;s)trum(opny4lm  lnvias)a2rrxmpno0apto fciysfs ulnvs;u4tlxoxo ia1optean s;t) eum(m3ny4lmtemivslt aDrmu o;o4tpto o3tatfs2ea(mpn() rxnmo oodlpt lu ol() 2xo(opny4op n ict s) rtaxmp;t0opx  feiatfm ulu on(0trxrio oa1lmDrlieslt) rxo(o oodlmenlnesl() rua(mo;o1aetoiictltfm2umuvs;()arxrxo3tadlm   uvo;t)s2xo(m3iudll  livtas s2rmu  ot1oex  iciatlaDulnmo () rtrmr tytfm raivs () exm(o oydalen ivsls arururonu1apx  f3iltfs2elu p u4trtrir3oadomD anvs t)setrio oodlle livslsf rra(mpno1aexn fetat a2ra( s (4aexoxf ia1oa  lnvo;s)trumxm iy1lptnlfcias)aDuaxmooo0teto oetysfmDumuvp t4altoxr iatoaD  nes;()s2um(r3io4ameemivs t) 2taxr ;u1oeenioeiat m2umumo t4alxrioctydomtraivs;s tetrirpnu4lleemfcta()a2rm(  ;t0openmfctas m ean p t4arermfciodoa rlues;()t2to(r io4opee ivias aDtruro;t1tet ifeiydlaDrm(ms () ltomr3iotlpD anvils) euoim3nu1amenlnvsas) Durxm ;o1altoii3iad s2um(ms (0teeoir iy1fptrauei s trxmxr3io4lme lnvt () 2taxr oo1aeenif3iyt s2ranvo t4aexrio oodlmt luei ( t2urio3oydllt lictlsfa2umu p;t1olen fcias mDuau p u0tlxnmo3tatlpDe u s ()s2xo(r oo4llee nctlt)srrrurpnt1tpeomi3tatfs ulums t0 rtoir oadopD luvs s0sexoir ny1aptnlnes tfaDrmxm oo1tet ifeildls ulums;() ltrmr3iatlp eanvi;( tetmxo3iu1aptelfvsl()artmumpnt1oex  i3tadfmDul(vont0arxoxf tadfp e iei;(  2um(r3no4olenlfcslsfsrrmx  no1tleomo3ildlm2eauvpn(0tlxoxo ta1omDelieil( truoir3nydllenmivilt sDraxrpnt4ope iociat mDua( onu)artrxrcoydlmD  uvol(0 etmxm oudop n nei (faDurxrp;o1altoio3ils s2ua( s t0texrmoctotlp elnvs t  2toimpny1ome lfct (  2umump;o0aeenmfeiydlm2eln o;t4 leoiocto1oatrlues;( srxoim iudale mneiltfs2raxro;t4oeenmfciys mDrluvs;u0trxoxrcto1op rlues;t0srtrxo iy1al e fctl()srraxmpot4aexnmo3iys m rmu s;u)arerif3totlp  luesls seurio oudol nlfeta( a2uauroot4tle ii3iydlaDua( s u)tleoif3oodop  lieols) rxoxrpoodlme lfetlt) rur(moot0aetomoetlslaDrauvo t)teeoir3iodlpt li o t)t2toxm oudlptelfesasf rurxr ;o4altn ietlsfa2rmumon(0texrir todlaDeaues s  exrir3oo4lpe livs t)s2ur(mooo0alxnmiciytfm umn p u0trxnmociytoaD  uvilt  rum(mpoudale  fvtlsfaDrrxr oo0tlx  feiadlmDeluvonu0trtomo ta1fpteai i ()trurxopoo4om emfvs (  rrrx ont0tlxnmfetys m2emump;()aetnir oydfa eaivi;s  rtmxo iydomt lnci sfsDra( p;o1alxo ieiadls2rlnmsnu4 eermoctatop  an s t trtoxr iu1lmeeliesas)sDuru pno1opeo fciydlmDrluvo;(4tlxoif tatlm eli sl()t2tm(mpiu1omtnmietltfaDumum nt1ale io3iyt s2emu p (4aeerifcoatlpt luvo;(0t2tmimpoudll nmics s) 2uru ooo4aetniieiasla2uluvont4 lermf3io1oaDrlnei;(0teur(o3nodlp nlncta(fa2raur nu1oleoifeilt a em(vsnu0texnif ta1fpDrlnvils0t2xr(opio1llenmnvslt)a2umxro;t4aleoifeiysfaDrmu p;()artrxr3iytfmD  i o t seuoimpoy1altnmies tfa2raxrpou0tetnmo3ilsla emumo (0 rxnmocty1omD an i ( setoxr3no1ap  lfeiltfa2tr(r no4apt io3iatla2el(vo u) etomo iotom  lnesl(0s2tm(m3ny4lpen ict t sDua( pou1aexo o3ilslm2emuvp;(4artnio3oa1faDeau ilt0srto(mpny4ap   fvia(fsDua( o;u4aet  fcilsls ul( o t)texomr iadfatrlnvo ( tetrxrpoo1llee icta( sDrm( o;u1texnio3tad aDrl( on(0aeermoctatlptr uvo ()texrxm3io1lm elneta( sDtr(mp;t0aeto i3tasla2ulums (0tltrmr totlm eln slt)srxoxr nudomenmfesatfa2ua(r nu0teeo fciatls ra( p t4 exrxocoydfat ln ilt s2tm(r3iy1lmtnmnvtas s2umu onu4olxnmieilt a2rmnvp t4teeoirciy1fmt  ivils  rtm(m nu1aptelivtat a2urxroou4tlenio3tltfm2elnvo t4teeomf todlpDe u s s)srxmxo ou4lpenlfcta()arrauroou1oex iociad s2elnvpnu4 rtnmrcto1fate ues (0 exm(opiodom emies (  rtaxronu4opeoifeiydfm em(vs;t) etnxr oa1lateaueilt0texrim nodame lfvslsfartaxrpno1oeto icilt sDulnvs u) eermr oytomDr nvsls0teumim ny4omtn iesatfarurump;t4apeomfctld mDuauvon(0tetrmf3iodlp r uvols t2triopoy4openlnvsas a2rru  ;t4texn f3tas mDrmnvo t0aeeomrcootom elues;( t2tr(rpoudal nmici t)aruau  ou1tleomi3ilsfa2el(mp u0 rtrio tadoat lnes;( t2xrxr3oy1llt  net s srtmx  oo0apt ioeiys aDel(vo;u4trenxf3tadlpDrln slt0t2umxo iu1lpte ivt s  2trumoot4alxo f3ilsfaDelu s t)artomo ty1om e nvi;t)tetoim io4llee nvta(f 2rmumpnu1oet ii3iadlm ulump;u4artrir3oa1fa  lneslt0tetrxm ny4ll  miet s)srraxmpot1aptoiiciyt s rluvp;u4 exrmrcootoaD lnei t0s2xo(opiu4lpenlnciasfsruaumonu0tet  feils aDem(vs;u)arenxr oydfpt  u sl() exrxopoodlme mfvs t  2tmxro;u0altniictad s2rmnmp (4 eeoxr3iydfp eli o t)s2xoir3io1apenmnci s sruauro;u4oeen o3iaslm2ulnms t0teenio iadlp rlu s ()sexo(o oy1op   fci t)aDur(ro;u1tlx  iciltfm elumon() ltnxf3tydfa  aues;t)s2uoirpoudalenmnesat a2ur(  oo0oltnmociltfm2ulums;() lermr totfm   ues s)s2xmxo3iy4ol  miet t  Draxr ;u0tlen oeiytfs2rmnmont0arxnxo ootom elivol(0setr(mpiydlptn ici s) rrrxrp;u0alxo octadlm ulu pnu4trtoxo3iatfmDelu il( srtmxmpoy4om   fvtls  Durx  oo4tptoiieilt s emnmp;u) lxriociodfpteanvo;t s2urio iu4lm  mies t sDuru pot4opt  fetldfs2ul(vsnu)alerircty1oaD  u s;s tetoxo3iudllen ncta(fs2rmxm ;t0texnif3tls sDem( ont) lermr3iydomD lu s s)texrir3ou4omtelnct s aDtaxmpou0optn o3ilsfmDra( o t0tlxrio oatlmDeluvi ( teuoxm ny1ap e fvsatf 2tm(  ;u0aex ifeiysls2elnmo;t4altnmfcto1oaD anvi;t t2tm(mpio1lpt  fci s  rrmx  nu4altnmietldfs rm(mpn()teeoio todlpDelu i s0 exo(mpiu4op nmfesatf 2umu  ou0opxn fciatla2emnvsnt4tlxnmf oa1fmDeln ol() rxrio3ou1lpe lnctl()artmu p;u0olx  iciydfm rlnms;(0arxnmo3tytoa e nei;t0 rtrio3io4apt miesls  Draurpnu1oetn o3tydlaDrm(vs;(4aeeoifcoa1fmt  ivi;s0seurim iu1am emnvias) 2urxrpno1opxn f3tydfs2umuvo u4alxrir3iotlatrln olt) exoiopiodll n fvsltfsrtmumpno4tle  octatfsDeluvo t)arxomfctotfaDelnei;t)texmxr3iy4lm  mfeiltf Duaxr ou1tle  iciyslaDeluvont4 leomf3iotlpDelnes;t) exo(r iy1ape miesls) Dtax  no0ape mi3iat sDul(von(0 exomf3iatfaDrlnes;(0sexo(o3oodapen fcs (fsDumxr nt4aleomfeild m2eau pn(0 ltrxrctytlmDe n o;t t2tr(r3nodalt lnesa(f rrmxmo;o4olx mfctyd a2rl(vsnt)altnirciotoatrauvsl()s2ur(o3ny1apenlfvsas aruaurp;t1tpenifeiysfa2rmn sn()trxnio3iydfatelneols0srxmim3iydaltnliet tf 2tmuroou1tpe mi3iatfmDel( s;(0trtnxociotfmDran i ( t2umxm ny4ol n ivtat)srtm(mp;t1ape mo3tld s2rl( s u4 etoifcio1lpte i s (0s2uoirpiu4apenmnci tf rtru  ot4olto ociadlsDeluvp (4altoif3iytomteli s;( texoxr oo4omen ies sfs2um( onu0opxnmoctlt a rauvp;u)alerif3iy1lmtean olt0seuo(m3ou4llt lfes sfarrrxrpno0apxoiietls a2emu s u)texrxr3iodlptraues t0truoxr3nydol elfviasfs2umxro;o1opeo f3tytfaDrmu s;t4trxnmr iotlm eaneslt) etoxm iy1oltnlnctlt) 2rrxmonu1ale iociyt a rmn o (4arxnif3oadoa e neil(0srur(r ny4lmtnlfeil( aDtm( ooo0alenmictltlaDem( snu4trxrif oydfmte nvo;( t2tmio3nodol   iei (fa2tau  nt4ape mo3iyd sDrmuvon(4trerxo iytfp elivils)s2ur(m oy1om  lfeiat)s2taxmont0tetn oeiyt mDrm(msnu)arxoxrcto1fm   uei s  2uoio oodopt lnvt t aDta( o;o4tpen oeiasfmDel(mo (4tetrio3ootlmt  nei;t  eurxrpoodopt  fvtlt s2raur ;t4apt mf3iys a2elu o;t) lxrxf3todlmDrauvolt  2to(r3iodomt livilt) rrrum nt4tlxn o3iydlsDranms;t4texnxf ia1oateaues t) exrir3no4lp n fciat)arrmuro;u4oltnmociltla2uanmo t) exoxociodopt  n olt)sruoxm3ou4omtemnct tfs2tm( pou4opeoii3tytfs rl(vs (4 lxnmr totoat au o;( srxm(r io1apt  ieilsf ruaxmpou4altoif3iyt m rmumpnt0 exnio3tatfpD luvs (  2umxmpou4apt  ieiasf Dtruroou1open f3iadfa rm(vs;(4altrir3oydoateln i;t)trtm(m oo1lleelnetl()srrm(mpnt4ole  i3iatla2el(mo;t4tetnifcoy1opt livi s)t2tmio3io1lpt mfvt ( arra( oou1aeto feildfsDrlumpnt4 rxomfcoodopDeau s ( teum(m3nu1ll elfvil()aruaumonu1tle ifeiyt mDrlnmo ()alxrxo oytoaDrlueslt)t2ur(r3ou1lltn nvsls)s2uru  oo0alxnii3iydfm2rmnmo t4altoio3to1lmD livilt s2trxrpoydolt micsatfs2taxr ou0tpeomoeiasfaDrmn p;(4aetrmf to1lmtrlivils  rtoxrpnu1aptnlfvsasfsDraumpnu4aexnio3ilsfm2umumonu0 exoxf3tatom elneo (0 2toxmpno1lle mieia()sDum(m ou4apt miciadla eanmonu) rtrxr3tytomDranei;s t2um(m iy1ol   fvslt a2tmx onu0tpen oeiasfaDuluvo;t)trenxr iotfm raneols0srum(opou4ome  fctl(f Drm(  ;o1tlxo feias m ulu s ()aetomr iatfmteau i;t t2xrio iy1ape mnciasf rtm(r nt4aetoii3iyslmDrlnvs u0aleomf ootfmteaivo t) eumxo3ny4oleelivtltfaDurur ot4tpxn f3ilsfa2eanmsn() etoxo3oo1omDeluvo;(0texm(o oy1ol  mnci sf Drmxm 
\ No newline at end of file
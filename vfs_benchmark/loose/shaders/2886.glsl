@@ -0,0 +1 @@
+n s ( trxmxopio1lmenlfcia()artaurpnu4tlenioeias m2umnmpnu4 lenxo oa1oa   uvo s)sexm(m iy4optemnetl()s2trum ;u1apt  oeildls2el( s;u4 rtnir oa1fmD ai s;t sruoxm3iy1lme  fvsl(fa2umumo;o1tet ifeiltls ua(vp;u0aleoir iy1op elies;s trtmimpou4omtelivtas aDum( oot0ole  i3tasfm2ulu sn() exrxo3iy1fatranei s)t2ur(o3oo4lptn neia(f rtmxmo;u0teenmi3iatfmDuau sn(4 eenxrcoatfat  i i;s setmxm3ny4alenlfviat a2um(ro;u4aptoiietys s emu s;(0aetoir3tydfp eaneol( trum(opio4lme lfvil(  2tax  ou4tpeoio3iyd sDrm(vo (4 rtnmfciydfmtelnei ()s2tr(o nodoleelnes tfaDum(r no4altomi3iytlm ranms;() ltoio3ty1fm rauvils) exoxm nu4lm  miei sfa2rax ont4apx  f3iytfm emumpn(0 rerir oy1lp eli s;( teuoxm3oo1am nlfvtat)sDum( ooo1aexo fciatfm2um(vonu) eerir3tadfaDe nvs;t)sexmxm3ou4lme lnvt tfa2rau  ;o4oet mietat sDeau s;(0 lxnmr todlmD  u i;t)tetoirpio4om  mfci s)arurumoou4alxo fciydla2emnvon(4 leoio tydfm r i s t0tetoxo oo4ol  mfvi (  2rax  no1oetn ociltfaDrl(mont0teeoif ta1fptr nei s) rtmir3iodaptemiciatfa2taump;t0teeoiociatlmDelu s t)tleoxr iadom elueol(0teumxopoodlmen iesa( sDrax  nt4tpto icils s ua(vo;(0 exomociotfa rln slt)srxoxm3iy1ll nmnci () 2ra(moou1tlx ifeiadfa uauvp;t)tleoxocta1op  lu i;s seuo(mpoy4olt  nctls s2uaum ot1optoio3ils aDrmn snu)altrifctotoptraivs s srxoio ny4op nlfcs (f 2rau p;o0aet iieiydfsDelnvp;(4 lxrxo to1opDeanesls) exoim ny4ame  netlt) Durum ;o1tpenmfeild aDemnmsnu0 rerir tadfmtraies;s0trurxrpnudomtemfcilt)s2rmur ou4tleoioetltfa2emumsnt)texrxf iy1faD auvsls setr(opiu1omt mnei t)srtaxront1aex mfciyd a2rl(vont0aetomo io1fp   iei;( srtrxo3ny1ll nlfvsls)sDtaurpou4olxn o3iasfa2eanvon(4aleomo3ootlmtraies t)t2xr(r iydome mnvtas)a2uaumpnu0aet mictldfm2umumsnt4artrir3oo1om eauvo;t) rumirpiy4lmtemict (f 2rrurpnt4tle  o3ias aDumu p t4tetrio iydfmtrlies;( s2trim3oy4optn neiasf 2um( o;o4oetoii3iyd a ul(mo t4trxrxo3tytfpD  ivo t)trurim3no4altnlnct (  rrrxrpnu4openif3iys m2rlu o u4aleoxr3totfp rlu sls)teto(opnu4ame mietls  Dtaumpno4apeo octasfsDrmn s u0tetnxfctotopDrlneo;t0 rtm(rpou1op e ncsltf rtr(rooo0tpeo fciyslsDrlnms (0aeeoxf3oatlatran ol( trxmir no1olte fcsa() 2taump;u0aetomi3iadla2uanvo t4aexoxfctotoaDe nvsls texo(opnydalen ivilt s2tm(m no4altomi3iysls emumo ()tlenxr3todlpDeai sl(0 rur(r oydomee icias)s2trurp;o1oexomociatlsDem(vp t0 rtnmr oydlmtean ils  rxoxr iy4ape lics ()a2ta(mp;u1opxnmietatls2em( snu)tltrxf3oadlat  nes;s)trxr(mpiydap nmivi sfsDrau  no4tpxoii3iadlm um( s ()aexrmo oo1fp eluvs;(0s2tmxrpio4omee feia()sDrm( o;t4optnmfetad s eln p u) rermf3ia1omDraies;t)texriopny4ap emieias)aDtmxro;u0aet iietltfa2uanvonu0trxnirciy1op  an s;t s2uoxr io4al nmici sfsDta( ono0tpenmf3ils a ra(mp;u0texrxfctytfaD lnvils0truoxopiydlmt  icta(faDtax  ou0oet  oetldls2umn p t)tetrio3tatfa rlu ils)s2xmxopio1ameelfes ()sDrrurpnu1aleomf3ias s emnvs (4trenmr3oytfp e nvil(0srxm(rpiydap  lnvtlt aDrr(mp;o4opxo f3ilsla um(vsnt) rtomfcoodfpt livi;(0teuo(m nu1lmtn ivs t)arraum ot0apenmoctys s eau onu)artnmocoydfpDraivols trto(m3io1lp nlnvsat arrrurpnt1altnifctltla2rluvon(0tlxnxf3iatfp e ies;s  rxo(m3ny4ol nmfviatfsDtmxronu0tlt moeiydfa2rau sn(0trxnxr3ia1lm  an o;t truo(r nu4omtnlfcil() rtmur ot0aleomoeiatfaDumn sn(4trxomrcoa1lpt an s;t0 rto(r3io1olenmfes (faruru  ot4tex  f3ils a uau p;t0teenmrciodfmte uvil()trtm(o iydape livtl( arrrxmonu4opeomoeiat a uauvs;t4teeomocootfa  lneo;s) 2xo(o3oydlp nlfei sfa2umuronu1opt io3iysfsDuauvsnu4alermf totoptean s ()tetr(o oydom e nctas)s2taxr no4oeeoif3tld s2um( s t4teerif3oatla rlieils0 rum(r3iudalee ivtatfsDtmur no0tetomocils aDemnms u)teerxrciy1lmD  uvsl(0sexoxrpoo4lm emicia(fsDuau pot4oexn fctadls rlnvonu)tetoxrcoatfmD  u il(0trum(m ny1ll n ncta()artr(m oo4olt mictlsls2uanvsnt)arxrxrciydom  luvsls)seuoio3iudll  mivt t srurumpou1oeen fciydfa ea(vo (0tetoif3oo1late ivslt)setmxm ou1ol e nei s)sDumx oou1tex  o3tat s rlu o;(0 exnirctadlmDe ueo;s truoxopiydlp nmfvia(farrax  no0aeen o3iatlmDrmnms;()trtrmo todomt li o;s)teurxo iu4lltnmieils s2tr(m ;u4aeeoiicildfs2em(ms;t0trxnmoctodfpD aivo s0s2toir3io4ame lfvtls  2taumo;u1alenioetatls emu p u) ltnmocoytoaDraueo (  2xoxm3no1ale lfcslt a2ra(rp;t1tptomfeiyd s ul( p u0arxrio tydlm eaneo t  2xoiopny1ol e ict (f ruax o;o4tpxniieilt m el(vsnt4aexrxr3to1fmt  uei;s)s2umxmpnu4amt lnesl()arurx ono4tee ii3ildlmDrl(vs;u4altnif3iytfm eluesl(0 rxmxmpnydameelfvs sfa2taxmpoo1apenmo3iad sDum(vp;u0texoiociotoa e neol()s2xmxrpoy4lme mnviat a2rmx ooo4apeomoetltla2umumo u) eeomr3todlpDe neo;s)seurio iudame lneslsf Dta( o;u1tptnmoetyd mDuluvs;u4artomo3iadopDe iei s  rxmir3ou1al  mnes ( s2uau  ou0tpt iictltla2emnvsn(4arxrif3ty1fp  ln s t0s2toxo3ny4lmeeliesas arumum nt0tle ifcilsfa rauvs;t)arerxfcootlpt  ivi t trtoxo ny1lltnmicil( aDurx ono1altn fctasla2uau ont4 renio ta1latr ivo s0seumir3iy1omtemicsl(f Duau ono4ope if3iytfm um( p () renxr3ta1op  lieil( tetoxrpiy1oleemnviltfsDumx poo0tlenmfciatfs2ua(vo u) eermo3io1oa rlnvs;t0tetoimpiodoptn fetls) rum(r ;o4ape mf3iydla2umnvp t4 exoifctytomteaieo;s s2ur(o iodlpenmnviasf ruaur no1olx iiciat mDulnms;(0 ltnxr iadlatelnei s  2xr(r3io1lpe mncils)aDrru  oo0tlt ii3iysfmDean snu0arxnmfcoo1lmDranvols0texrio ou4apen ncs t)a2trx  nu0alx  f3ild a eaumsn() reoifcto1lp  lnvils)sexo(m3oodomtn fvt t srumxmpnt1texomfcilt s2rmuvsnu0 lxrxf oa1fp   i i ( tetr(m no4lmen fvi s) 2urxmp;t4aee ioeiytls uaump ()tetrxrctadfpD  u o;t seto(mpoo4om nlfes sfarra(mpnt0ale io3iyd sDeln p (4 lxrmocoy1faDe nei s0 rtr(o3oo4om elnci ( srtr(mpnt0alxnifetadlaDea(vp (4alenmf3iatla r ivolt) 2xm(mpoo1ll e ictat)arrrxm ;o4alx mfcilt s eln pn(4trerxf oy1la  auvi;s0tetrio3iy1lp elivilt  2tmu  oo0aet if3tatfmDran pnu4artnir3tytopDrau s t)s2xo(r3nydaltemnesatf 2rrx oou0oleomfciadlsDeanmsn()trxrmfctytlm eln i t)tetm(mpoy1llenlnesa(fsrta(m ;t0oet  oetas a2rmnmp (0 etnxf3iytfpDeauvi;s trtrir3ny4opte fciltfs2rrur ;o0tpeomietad mDrlnmpn()aexrxr3ootfaDrlu il( sexmxo oy1lpe mneiat  Duru pou1optniietldfs2uauvpn(0trermr io1lpt  uvol(  eto(opnu4alee ncsas)sDurur ot4tpen oetldfa ulnms;t0tltrxo oy1fm  lues;t) exo(o ou4lmtnmnesas a2raxr nu4tptoiociyd m2eanmsnu0 rtomfcoatlp e n i s teum(m3nodop   ict tfs2um(rpot0aet moeiydlaDrmn pnu0artoxociodfpDr ueolt)setr(opiodoleelfci () Drrx oou0altoii3tytlsDumuvs;(4 exnio oytopDe i o;(0 2umio3oudal  mnvsat)s2tmurpot1tlt  fciysfsDrm(msnt4 etrmr3totom rlnvs ( seumxmpou4ol  lictasf rtau onu4opt  oeildfm rmuvp;u0 leoioctotfpt livs;s0 eumxm3nu4am e fct () rtrur ;u1tet mi3ild a elnvp;u4teenxf3oy1lmDeln o s s2xo(r iy4alt  ies s)s2rmur nt0oltnmi3iydfs ul( o t0trtriocoatom e nei;s)teurirpiodapeelnvt tfa2uax p;t1oeeomo3ilt s umn ont4 ltoifcoytfpDrliei;t  etmxr3iodlmeemicil()srtr(r ;u0ale mieildfa rmn s t0tetnir oytlatelneilt  rtoxo3oy1omee feta(fs2tr(  nt0tle  oeiadfa2rmn p (0texrxr3oatla eaies;( tetm(m3iydlp nlfeilt)a2uaumpno1aet  iciatfs emu snt0aetoiocoodfat anvo t trtrxm3ny1lm   fei t)srtau oot0ope io3tadlm2ulnvpn()texrif totom rauvo;t0 rtoim nudapenmncia()srtmump;t0aexo oetys mDran s (0tltrir iadfm   i s;s)srtmir3oo1apt  iesa(fs2ur( pnu0apeoiieiysla2em(ms t4 leoxr ootom eluvsl( trtrio3oudll   nesltf 2tm(m ;t1tpxo fetad a ulnmsnt)altoxociadlpDranvsl(  2xoxm3oo4olenliesatfa2rau  ;o0aetoiiciaslm umump;t4 etnmr tadlp  lnes (0 rurxmpiydamtnlnvia(fsrumxmpot1tet  fetld a2umump;t0aeerxr oadoptr nvs ( t2urio iy4llt lictasfsrumurpou0openmietytfm uauvpn(4alxnmo3iydfpDrlu olt  rxrio3iu1lmeelnvta()sruaxmpou0aleoiiciyd mDum(vo (4tlxrifcoatlmD liei;t0 ruoir3nudlpee nctl( srtr(rpoo0oleomfcilsfm2ul( snu0aeermrcty1fmteln s s)setr(mpno4ol emfvs ( sDur(r ;o1tetoioeilslmDumnvpn(4arenir3iytlpt lnei;t0 2xm(m nu4llen fes s a2rrxrpot0texniictysfs ulnvs t)trxnifctydfpt lnvo;(0t2xrim io1lltnlfci ( a2ururont1teen o3iltls2eluvp t)teermocoytomteau o t)s2to(r3iu4ame mivias)s2rr(  no4ale  ieilsfsDrl(mo (0tleomfctadfpDe ivs;(0 rur(r no1altelnvslt)sDtmxrpot1tlt ifciat m rln s u0alermrcoadoateai i () rum(m3oo4ale mfes tfa2ua(moou0openmicias sDulu p;t0trtoir oadfatran o;t) eum(opnudamtnlivtlsf Drr( oou0tpt mieiltlm el( p t0 rtrmf ta1fp rlu i (  rxo(m3ou4ape  nciat  Dtr(m ou4aeto ietlsfm2uanms;()trxrmoctotlaD  uvs;t s2umxo ou4lmte ivslt arumu pnu4tle mfetad s2rlnmonu4aexnmf3oydopDr n i;( t2umim3iy4opt mncs (  2trxrp;u4oexnmictldfm2rauvont0arxoiocootfa e neslt)s2xmxm3no4aleelfcsat s2uaumpot1aee iociasfm rmums;t0 etnmf3ta1omDe u i ()srxrxopoy4amtnlfvias) Dtax o;t4oexo oeilt a ranvs (4aexoxr3oatlmDr i i s teuoiopny1ol nlics (fa2taxmooo0aetoiicildls2eanvo t0teeomo3oadlp eaneilt0trur(r iy1al n net tf Dtau p;o0altnii3iyt sDrl(vont0aleomr3ty1oaDe ivil()s2tmxm3ny1lmtnmncsatfs2ua(  ;t1tpenifciytfmDel(mo u4tetoio3iotla r nvs;s trxo(r oo1amtn ivil(farraxronu1tpt mfeiadls ra(vs;u) rtnxf3tytlmDelnes;s0trxo(r oudol emies s  Drru  ot4aet  fcias a ea(msn(4 eeomf3oo1oate i o s  2toxr3oodaptemnetlsfaDtmu p;o1aet mi3iyd s ranmp;t4 exoxf3oy1fmDrlneo s)t2xmxrpno1al n fciatfa2ua(r nu1apen iciatfa em(vs t4aexrmrciatom  auvsl(0seum(m3oudopt mfvtas)srra(r oo0apeo iciytlm2uln snu)alerircootfatrauvi t)s2trxmpny1lme  fvsa()s2umx poo4olx io3tys m2ua( s (4artrir3iydlptrli slt tetmimpno1lme mneias s2raum ;u4aleomf3ilslm2ul(vs;u)altoir tytfpDe nvslt)trxmir3oodapen ncsas aDrmxront4tpxoio3ilsfm umuvs t) renif oa1omDelnvs;(0t2tr(r3nu4amtnlivt () rrax p;u4aex  i3iytfmDeanvo;t) lxnxrctotfmDeanvsl(0seuoir nudamtnlfeils) rrru  ;t0tpto ietadlm el(mp;t0teermf3oy1fpD lnes;t0t2tr(opoo1amenlnct (faDtmxro;o4aexn feiasfm2rmnvo t) rxrif oa1opDeai i;(0s2um(o nudlp  lieias  2ur(rpoo1tee if3tydfa ra(vp;(4aeeniociy1omDraues t)t2tmxm3nu1lpte netltf rtaump;u1teeoii3tlt sDemumo;(4tltnxrciotlmtr n i s0teum(mpnydam e fvs s sDrax o;o0oleoiietltfmDem(vo u4alxoif3ootoat  ieo t  exo(mpno1lltelnetls s2taxrono4altomo3iat a ra(vp;(4 rxrxr oodopt ln s s  eumio3oy4olte fet s) 2rm(mpnt1aee  icias m2emuvo;u)treoxfcoydlmt lnvils)trum(rpoodlm nmies (faDuax o;o4oet iicildfs2rmu o (0 reoxr iadlmD ai sl(0 exo(mpou4om nmnvi (f 2uaump;u1alt mietlt a ra(vp u0tltnmrciadlmDe nei;()srxoxrpio4lp  mfviat s2trxrono0opeoiieiltlm2umnmo (0 rxoxr3oydlatrlnei (  eumio no4ap n nes ()sDraxr ;u0ope iiciasls raump (4aeeoircoydoptr n i;t) rxoxr3ny4lltn ieta( aDrrxront1tex  ieiyt m2emnvs t4tltoio3oatoaDraieolt)trurim3iydlmtn netl(farraxr no1apeoif3iat s2um( o;t4arxrmf3iatoatr nvsls0 2xoxr3nydol  lnvtas s2taxm ot0opeo f3tytlm rm(vs (4arenif tadom  aneo;(0 2xmxr3oydal emneiat a2rax  ot1optoiociyslm2ulnmsnu)altnif3tytfp elneol(  2xrxmpny1opt  fvsatfs2raxmpnt1aeen o3tltfa2raumo;t4 leomrctydop  ai sl(0trtmxo nu1ll  mfcia()srtmuro;o0aptn ocilslm um(vs u) etrxf3iydlpt li s;t trtr(o no1olen fcia(  rum( oot4tpx ioctls m2ulumpn(0 rxrxr ty1omte ueo t)setr(r io4lltemiesls  Duau oot0openmoeiyt s2elnmpnt)arxnio3ta1omDeli i;t0 rurio3nudlpt  ncsat)arrmur oo1oet  o3tyt a ea(ms;t)tltoifcio1oaDr uvo;t)trxrio ou1ope mivia()sDrm(mpnu4optoif3iyd mDelump;t4texrxf3ta1oaD an o (  etmim oy4omt  fctlsfaDtaxm nu1olxnifctlt sDelu pnt0aleoxf3iy1lmt  nes t)s2xmio oy4lme  neil(  rtru o;u1oeeoiocilsls2ul( pnu)alxrifciatom r neil(0 rtrxm3oo1ll e ietas s2tmx p;u4tlen fctadlm2em(vp;(0 etrir tatlpD lnes s)tetrir3iy4ale mncta()a2urxrp;u1alxnmfeiatla2emums t0teeoirctadlmt lnes;(  rtr(o3iodlpe lnvi t)arrmurpoo4tetnif3ildfa2ul( on()trerxf ta1oa r nvslt)srtrio3oo1am elnviltfsrraxrpoo1ape moeiatfmDul( o;(4aexnmo to1laDrlneo (  exoxo3nu1ol e icsltf 2tmxmo;t1ope io3iatfmDemn s t0 ltoircoo1fa e n o t)trtrxr3iu1olte fcsat  rraump;o0ole iociat sDum(mp;(4aeenxr ty1lptrlnei;s srtr(m ny1om emfcias) 2raxmo;o4tltniictys m ul(vpnu) rxnxo3oydlmteaueo s0 rxmxmpnodom emnesas)arum(ro;u1openmiciadfmDulnvp u4artnxrctodoa r uvs;t)t2tmir iodam  mnvslt s2rr( pno0teto octatls eau p u0texrxo totfmt anvs ()t2xr(m3io1al e ivta(f rrr(rpoo1tlxo ociysla2el( p u4trtomr3ia1lpDr nvsl()t2ur(mpoy4ll e ieias sDrr(  ;u4alenmoetytlm ea( sn(4 rxrir oy1fm rlu s;s sexm(o3no1lp e ieta()arua(moot1teeniiciysla2ra( snu4 rtnxfcoytfatrai s;t s2xoxo3oodalenlici (farum(r ;u0tlto oeiltlmDumumpnu)texoifcta1fmtelnvol( setr(mpnudamenlivt s)aDurur ;o0aee iieiydfa2eanvp u)tleoxr oadfmDr i o ()seuo(mpiydaptn nes (  rumumo;o0tpx moeiys s2el(vs;(4teenif3oadfa rln i s)s2urim3iu1am  micsat)a2tmxroot1aexn ocils s2eau p t)texrmf3io1fmDeaues s t2xo(m3oodll elnvi t)srumx pno4oex  i3iasfa umnvp;() eenxr3iatoaD aies t t2tr(r no4lmtnlnei s) Dtru p;t0aexo ieilt mDraumo u)texoifcoodlaD  uvi;t0srxoimpiydal elfvi s srumu pnu1tle iieilsfm2ra( pn() rtrmrciatlmtelnei;s) 2triopoo4lltnmfvsasfsDtrxro;u1altnmietls mDemump (0 lerio3oytoatr n o t)t2urirpou1olee fei t)s2ra(mont0oexn ociat m2raumpn() etrmr3oo1lp  anvsl(0t2umxopio1om  lictl( sDurxmpou1alt  o3tyd sDem( p;t4 lxrxr3to1fm e i s;s) rumxm3iodole lfctl() rur( pnu4tleo oeilslm2uanmpnu) rtrioctotom e neo;t)trxmimpiu4opee feil(fa2tm(rpoo1texniicild aDra(vonu) renmf tytfm rau ils  2to(r3oy1om nliesltf 2um( oot0oet mo3tls aDrmnmp;() rxrmfcootoptelu i () rur(r no4llee icsa( a2tmxrpou4oeeomiciyslmDemump;u4altnxf3oo1fpDrlnvs ()sexm(r iudllte nesl(f 2um(ro;o0opto i3tls m2rlu on()areomf iy1omDeanvs;s0 eum(m ou4ol n nvslt  2uaur ;u4olxoifctat aDum(vpnt4artrmoctatlmtrlueo s0srum(mpiu1ll emiet ( a2taumpnu4oex moeils m2ulu sn(4altoxo iotop  lnes;s truoio3oo1omtnlicta()artr(  ou0apxo o3tadla raumo;t0teenxr tytomD  u o s teurxm3nydopte icsat artaump;o0open oeiadlm elnvsnu) rerxo iy1lmDran ols)seur(mpiy4om n iet s arum(m nt1tptnioeiys s rauvsnt0 etrxr3tytlp eli ils) ruoir3iu4oleelnvtas)s2tm(rpnt4apt mo3tyt mDum( o;t4alenir3ta1la e ues;(0 etrxmpoodaltelnvsa(fsrrm(m oo0opeomociatfm2ul(vo;u4 rxnmocoy1oaD lieols  2xr(m3oodomtemics (  2tm( ooo0tptomiciysla2rlumon(4tltoir oadlm e ivi s)s2uriopoo4lmeemnct s)arrmx  no1oex micilsla2umuvo;u0tlermf3iytlm rlneols)srtr(opiu1lleemietls sDuauronu4tlxoio3iadfm rlnvpn(4 lxoif3oodfmDr ueo s0sexmir3ou4optemfeta(  rrr(r nt1optn ieiaslm rl( p u4alxoiociadfmtranei () euo(rpny1omenlnci s artmxmpoo1olx  ietyslm rlumo t4altnmfcoytfpte n i t)trumxm iodlltn nvia(f Drmxm ;t0opeo i3tys a2raumon() eenir3oadop eln o;() exrxmpny1om nlfvsat) Drrxr ;o1tetoifetytla rmn s;()teerioctodop   neo;(0srxmxr3iodlpte nct s aDtr(r oo0optoifciatfm2rluvs;t)altrxr ty1faD an sls s2xo(opiudape mivs s)aDtaxmpnu1texomiciysfaDra(mo (4arxnxo3ootlmDrli s;t sexo(r io4lmen fesat) 2uaxront1tlen f3iytfa2ulnvp t) lenxr iotfm rli s;s0 2urio no4op emieilsfsrumxrpnt1tpeomoeiydfmDelnms u4aetrxo3ta1fm  aieo;()t2uo(m3nydam   netat  rtmxmpno0tleomo3iat a2rlu pn(0aexrmo3tydfpDeau s;s  2uo(opno1omeelicias)aDrrx  oo4tle  fciltlaDea(vs;t) exnioctytfmteau s;( tetmim3oydale mnvt (  2tr(  ou4tltn ocilslm rm(vo u0arerir todfmD lu o s0trxr(rpiu1ap emici tf ruauro;o1opt mictld s um( s;(0tetrxr iodoa rlnes;s)sexrio io4am elivsat sDur(r nt0ale ii3iytls2rmumo;u4 exrmfciodlaD li s;s trxriopoo1aptnmnvs sfs2trum ou1oeen iciatfa2emn pn(0tlxrmfcoatom  ai o;t) etrxr3io1lpeelncs t)sDuru pnt4apxnmfciysfm2emnvs;u4aetnxf3iotfmtrai s;t0 eto(o oo4om nmivsl(  2raurpnt4apxnif3tas a2el( o t4 rerxf3iotfptelu i;t0 2tmiopno4alt  ncsltfs2taxmp;o1alt  f3iadfaDumnvp u)teeoxo3iotfmtr uei ()t2xo(opoo4alenlivi ()s2urum ou0ope  i3ias aDua(vo t)altoxrciatoa   neols)sexrxmpnydamtn net s s2rmu  ;t4aeen ocilt m2rln onu)texrir3ty1lpt  uvils) 2um(r3oodapen fcia()srurxmpnt0tleo oetaslm2um( o t0arenio3oatfmDeau slt0s2to(m3ou1am n nvtls)aDrr(mpou0opt ii3iyt mDeau o;()aexnircoy1lptr neils)s2ur(o ny1olt micil() rrrx pnt0oltoiieiysla2eauvp t)alenmf3ia1op eaieo;(0teurio io1amtemnvtatfarrrx oot0apt  oeias a ul(mpn(4altnmf tadomD  ies s srurxo iodlmtelnetas) Drauront4oeeomf3ilsla2rmu s (0 ltrio tatfmtranvi ( sruoxm3no1lpeelfetas) rraxrpno4aeeoif3tadfaDemnvo;t)trxrir tydfmD lnvo;t sexr(r3no4lmeemivtlt)s2raxr ;t0tee  fctltlaDua( o t0artoif iatopte neo ()t2toxm3iydlp nlivtl(farurur ;u0aexomfciasfa um(ms (0 ltnxfcto1opDr i s;s0truo(mpno1optnmfci t) 2trxmpou4aetoio3iydfm2eaumsn(0tleomr to1la eaivil()s2xm(o3oo1ame  fci ()a2tmu pnu1tpx moeiltfs uaumonu4trtrmfcoodlat lues;s) 2toxr3nodlmt mivsat s2rmum ;t4tpxo ocildlsDuan pnu)alxoxfctotoaDr uvi;s)setoxmpnydaltelivslt sDuau p;u1ope mfeilt aDulnvp;()aeeoifciydlmt lu sl(0srtrir iu1lmtelfvslt a2umx oot1olxoiietlt a emnmont0trerxr ootomtelnvslt)trurim3iu1ap  micsl()srrrx pnt4tlt ioetys a2rmump;u)tlxomf3iy1lateaiesls) rumimpny4omtnlncsatfaDuaxmo;u0opto ociytfm2ulnvo t)tlxoxo3ootop r i ols) ruo(o iu4lmt  fvsatf rurxr ;t4openiietytfaDel( s u0trtoif oa1opteai ol( s2tm(rpiu1opt  ivsls  rumx oou1aexoii3ils mDuauvsn(0 ltnxf3oodfat liei ( s2umxm iu4om   ieil()a2um(m nu0tpxn oetadfs ulu onu4 lxoxocto1lm raneo () rto(m3ou4aptn icias s2ta( o;o4aexn o3iatfsDrl(vont0alxrxo3todoa   n ols)s2xoio3ny1lltelfet tfsrta(rpnu4olxomo3tltlm2emumont4 exomo oodomD  ivs (0 exr(o3ny4openmfvil(  rumur oo0aexoiieiydfm emnmpnu0 exrmfciydlmt lnesl()trxmiopnodaptelfesl( arrmum ou4apxo oeiytfm ranvont0tlenirciy1opD  u i;t)t2trxm3oy1om   ncta(fsDur(  ot0oleniicildfaDemums u0 lenif iatoa elnei;()setmxm3iu4om  lfcs s) rrru pot0tetnio3iad aDelnvs;t0 rerxr3oo1opt aivo ()seto(opoo4om  lnct s)s2tru  ;t0tlxo ieilt a ranmo;t) rtrxo3todop   iei s0 rto(rpiy1am   ici s a2um(rpnt1texnio3tlsfsDuan s t) eerxo3iatlp r u s;s teur(rpnu4al emncia(fs2raur no4opxo f3ildfa2emn pnu0alxnxocoy1omtrlneols srumiopoo1amt mnvi s  rrm(r ;u4tex io3iad mDrlnms ()aetoxociodlp r i s s0 2uo(m3nudllt lfcslsf Drau o;t4alxnif3tydlm uauvo u0alxrxo3tydlptelueolt) rxrxm3nodolt lictas) 2rmuronu4altn oeiydla2umuvp u0artoxf3iotlateai ol(  2xoiopny1op e ivi (fsDrrxm ot0optoii3tlt m2ua(mp ()aeerio3tadlaDeaivi;t0setrimpoydlpeemictlsf Drmurp;t4aptnmicildfsDum(mpnt)aeeriocoatomtrlueil(0 exr(r oodop  mnetls) Draumonu1oex  ieiadfa umnvsnt)teeoxr3to1opDrlivslt0 2ur(m3oy1amen fetl()a2tax  nu4alx mfetls m emn pnt4altrxr3ia1oa  luei;()tetmio3oodoltnmics sfsruax pnt0aeto o3iydfs2ulums;()tlxnircio1oaDr i o t teurxm iy4om emnct t)s2uaxmo;u1aet mfciltfm ran pnt)areomr3oodlatean i s seur(o3ny1al nmiesl(fsrtm(m ;t0opxn octysfs2ra( onu)texnircootopt  uvols) 2xo(mpoy4altelnetl()sDtrxrp;o4oltoiociysfm2rluvs;t4teeoxr3oo1opDeauvs s  2trxrpiu4omte fvilt) 2uaur ;u4tlx ii3ilsfa ua(vo;t)trxrxr3ta1fpDeai ols trtr(o oy4aptelieias  2trxm ou0oetnmi3iyslmDuauvp t0 reoxf tydlm r uvi;t sexmir3oo4omen ieiasf Dtaxm oo0aptn i3iydfa eluvp;(4arermf tydomD aivo;(  rtoxr oo1olt  fes s arrmurpno1oee mietatlm ul( p (0arxomrcoatfpD  i s ()srumimpny4lmen ictl(f 2umxmo;t4tpeoii3iyd m uaumpn(0aexnif oodfaDrlnesl( trxmxr3oy4optnlfvs t) Dtaxr nu1optomoctydfa2umuvs;u4alenxo iodlp  livo (0 rxr(rpno4opt  ietat aDtau  nu4aetoiiciadfa2rl( s;t0 ltrmf3totlmDelu o;t t2tmxo3iydape  fcs (f Dtmu o;t1tptnmfciatlm ea(mp ()areoxf tydoptrlnei;()trtmxm nydalt lnct s)a2tmxro;t1texomiciltlmDrl(mo (4 rtnmrciy1fp  anvi;( srtoxr3iudaltn fvias sDur( ont0oet mfeilsfm emuvp;t0teerxoctodoaDr n s;t0 2trir3oydlmee ncilt)sDraxroou0apt  fctyd mDrlumo t)aetrmfcoa1lmtr ueil(0texo(r3oo4lme mivs s)a2tmurooo1oexoioeiydfa2rau s;u4alenxf oy1fmtelieils)srxoxm3nudamtelivtas)s2tr(  no4oleo fetld mDuanmp;t4artoxf oodlatranvo t)texrim3iydap nlfvsas  2tmxrpno1oeeo ietad a ulu p (0teenxocoo1omt  ueil(0 2xoxo3nu1am emfet sf Drrurooo0tex  iciyd s2ulnmo;t4tltrir3totop  ln i;s s2tmxo3oy1llee icias)aDtm(m no4tpe  octatlmDumuvpnu4 eenio3tadoa elieslt trxm(r iu4op nmiesas  Draxmpnt0oex iociysls ea(mp (0 lxomo tadop  lnesls0sexmir3iodomt lfci ()aDtm(r ;o1apt  icild m rlnvsnt4aeeoio3iadlpD aiei;s)t2uo(r3ny1omen ieil(  Duau pno4aetnmfcilsls2umums u) ltnmf3iy1lp  livs;(0setrxm nudope  fetl( s2urxrooo0tet mfeildls um(vo t) rerif3ia1fmteaivslt) exmirpny1lptemfeslt)s2rm(mpno1tpt ioeiydfs umump;t)tltnmr3iytlate neils)srtm(r ny1alenmiviltfsrrax  ;t1aex  ociytfa2rlnvonu0tetoxocoo1lm eln o (0 2urxo3io4lmtn fctl()srrmurpou4tltomo3iatfa2ra(mpnt) rermr oydoateauvil() rxmxr io4lme lnvia( aDtau  ou4opx  oeiltlm elumpn(0 lermfciy1op e ueils teto(r3io1lmenlieia(farra(mpoo1tlen ieiytfs ua( s;(4 rtrmr3iatfp  lues t seuoxmpnu4om   fct (fa2tr(ro;o1olenmiciatls uau p;()trxrxr tytop elneilt0srumio3io4alenlfetltf 2raumpou4alxnif3iyt m2umu o;u0artrifcootfateai sls) exmxrpiu1altn netls  rurx  nu4oleoifetatfa uan s u) lxomf tytfp e i s s0 2um(r nudolte ivsltfa2um(mpou0tptnio3tadfm2rl(mo ()aexoxf3iadlp  livo;t0srtr(o no4omee nvi s a2umxr no4tee mfeias a2rlnmo u4tlenmf3iy1lm  anvolt)t2tmxm iy4alenmncsa()aDrax p;u4alxomociatfsDem(mo;u4arxnif3iadlpDelu i;s0 eurxr3iu4aptn ivt ( s2tm(  nt1tpxomoetltfm2ul(vpnt0 lerxo3oa1optr n i;() rxoim3oy4alee fctltfartru p;t0oeenmf3ildla2ulnvp;u0tltnmrctatoat anes (0trxrxo3io1apt micil(fsrraur ;o4tlxo fctltfa2ul(mp;t4altrirctatfat ai s;s0 2ur(opnodale mfet s s2rmu pno4olt  ociad aDemn s;u)aexoirctadom eluvo;s)trxr(mpoy1lmeemnetas)srur( pou1tptnmfeildlm emnvs t4 ltoxr3iatoa   n il(0 exr(r oy4om n feia( arumum no4olxomo3ilsfm uau s u)aetnifcta1om  li s;t0s2uoio no4lm e feta(  Dta(r ot0ale if3tat sDrmuvs;u)trtoir3oydfpDrlu o s  ruoxmpnodolen fesat)aDumxmo;t4optn icias m2rm( pnu)trxnmr oodlmDraivi;t) rtrxm nu1apen feilt arrr( oou1alx mf3tydfm2uau p;t)tltnmr ia1fateanvils) eto(m3iydam  mfvi tfarumuroot0teto fcils aDrauvo;()trxoircia1oa  lneils  2xr(m3ou4ameelfeias) rtrxro;o4aeto ieias m ua(vo t) ltrmf3iytlm e u ols)srtrim iudll emnesls arurxro;t0tptomieils s2rmu pnu0aeerxrcio1optrai i;s)srurir iydol  mfvtls  Draurp;o1opto oetyslm2uluvp;u)areniocoadopD au o;t) exo(o iy4am  lnetl()artrx pot1tle  feiatlmDul( o;u) lerxf iadfa r neo;( seur(rpio4op emiesls)a2rmx  ot1teen fetysfs rmuvo;()artoircoo1lmD an ol( tetoxmpnu4op   ict sfsrtmx oou1ape  i3iytfm uaumo t) eerif3todomD  nvi (  eum(r nodop nmivsltfsrrm(mpnt4tetnif3iad s2eanvo u) renif3iytfpteaivilt0setrimpoo1alt liet () rrmxr ot4tleomoetysfsDuanvs u0tlxnmf3tatfm   nvi;t)trtrio iy1am emics (  2rru  ;u0tpxnmictltfs2rl(von(0trerxf iatoatr i s;t0 2umxm no4om n feia()sDur(  ;u4alenmietldfs eluvp t0alxrmf3iydopDr ivo s)srxr(mpoudlle lfcsls)arumuronu1tleo ieiytfa um(vpn(4 eerxocoy1opDeluesl(0s2to(m3ny4ap nmnvil()srua( p;u0alt  o3iat mDul( o;u) reoio oy1omteanvol( trxm(r oodam   fcilt s2urxr no0teeo i3tysla2em( s u0 exnio tatfptraieol(0 exoio3nydapte fct sfsDtr(moou4tpxn ociytfm2rl(mo (0 ltnmr3tatlpt an s t  2xmiopno1olt livia(fs2trxmpou0openmf3ilslmDraumo;t)arxrir ta1lp rlneo;s seuoxmpou4apenlfct (  2ta(r oo0tpeomo3iys s ul( p u)tlenifctodomt ai o t s2xmiopio1ame mfes t)s2tau p;u1olx moeildfsDuanms t)aeenif iy1lm e n o (0srxrir oodoptemneia(farra(ro;u1texomf3ildfm emnvs u0alxoiociotop e uei;t tetoimpoy4lm eliesa(  2tmxro;o0tleo o3ilt a2uau s;()areoio ootfm  au i t t2ur(m oudom emneils)sDrrxr oo0tleomiciys aDrauvon(0 etnio3oa1fa e nei;t0 rurxm ny1ol nmietatfsDrax  ;o1teenii3iydfa2ul(vo (0artrioctotoa rlues;(  2xo(m3iodapte ivtatfs2ta(mo;o1alt ifciad a rmnmp;() leomo3ty1lm eln s;()t2uoxm3oo4lp emnvs tf 2rax o;o1tlt ifctldla umump (4aeermr3oadlpteaies;t sexmxm ny4oltnmfvt (fa2ua(rooo0apeo feilt sDumnvo ()tlermocoydomte neo;(0s2xoxmpoo1lmenmfvilsf Drm(m ;u4tpxoif3iasls2ua(mp;t) etriociytop rlieol(  rtmxo no1olenlnci t)s2ta(mooo1oltn fctas s elnvs u) etnxf oy1oaDrlivsl(0seuoxm3oodlp  mfciltfsrumuront4apt mo3ias s2rmu snu) rtnif tatoa rlneil( s2tr(o3nydop e ieiasfsDurx p;t4oexoio3tadlsDua(mo;t) ltrioctodfaDr nesls  2umio3ny4lm  lici t)srrmuroou1apt mictltfa rau pnu) etoir oo1oa rau s;t texrimpou1al   fcs tfa2trum ;o0aet io3ildfs2uaumsnu)tltoxo3tatlpt ai ol()teuoxo3iydll  lfvi sf Dur( onu4olenif3iasfs rlumo t0texnmr ootoaD  i il()trxrio iy4opeemnvsls)s2ua(mooo4apt ioetydlm ua(ms t0altrmf3iy1fm  anvo ( sruoxo oydap e icilsfa2umx onu1optnioetydfmDuan p (4artrirctatlmDrluvil(0 2trxr iudole lnvsasfaDurxrpnu0aeeoiiciatfm2umu o t0areomr oodlptran ol()t2xmirpnydlm nlfci (f 2rmur ;o1tpt ifeilsfs ul( o (4 eeomf tadoatr uei (  rxr(r iydom emict () Drr(m ;o0ole mf3iatfa uln o;u4arxoifctotomtelnvilt)tetmxmpio1lmtelivilsfartaumpnt0tpenifctlsfs uaump t) leomf todomDean i ( s2umxo oo1amen ictas arurumooo4opxn f3ilsla eluvs;u4tltnmo tydfmteauei;t)s2xm(o oydopt lfei t sDrmu  ou0aex  oeildfm2ra(vp;(4aeerxociatoatelu s s0 2xr(mpiy4olt  nctls s2um(rpot4oleo o3iatlm2elnvonu) lenifcoo1fpDelneol()t2uoxopoudoltemfesa( sDtaxrono4alenmoeiyt aDeauvo;t0artnir3tadfmtrlivs;s0srum(m3oudapenmnesl( s2rm(r nu1opt  ociltla ea(mp u0 rxomr iodfptr ueols0srxoxo nu1ame lfctl()a2tmx  ou0optn f3ildla2ea( p;(0treoio3oo1oa r n slt0setoxr3iy1om n nvsl(  Dta(mpou0aleomo3iyslmDul( pnu4 rtomr3to1lpD ai o;t) 2xoim nodap  mncsasfaDrax p;t4tpen fciytfaDem(mo u0aleomo3oatfaDelnvols)sexrimpoo4aleemnes sfarra(rp;o1texo fcild s rmu o (0alxnmrctatopDrli ils trtm(rpio4ol nlncs t) rrm(  no4tpx  f3iasfm2rm(mp t0tlxrmrcootfpD aivo;(0srum(o iu4ome  ici ()srtax pnu0aleoifetytfs2em(ms;t0 rtomr3oatom r uvs;( s2umxo iodop n neias)s2taxm nt1oltniociasfa2uan p;u4tetnifctodfmteanvo;()texr(r3nudomtn fvsltfarra( pno0opx ii3tadfs2ul(mo t0artoxf3totomtelneo;s seuoirpiy1ame lnviltfarrmx ont1aetnmieilt s rmnmp u)trtnxrctydoa ran s;s0t2xo(o nodlltelfvsl(  rumu pnu0ope ii3ilt m2rm(msn(4 rxnxociy1fmD  uvils srtrxo oo4al nlfeiatfarrru ont0openii3iadlmDua( pn(4alxnxociadfpteaueslt teumxrpiy4apenliei sf rtaxmonu1apeomoetaslmDel(mo t0altoxo3iytlpD an s;s  rxrir3oo4amen fcsat)a2raurooo0tle mfetasls emn s;t0tltnir iotfm  aivi ( sexrxr3oudlm elici sfaDraur ou1oexn o3iys mDuluvp ()arxrir3oatlpt lnvi;t)s2tmxr3io1omen nei t)s2raxro;u0tlenmfcildls umnmo;() eeoiociatoaD livo;( seuo(o oo4opt  ivtl()aDtax p;t0tlt ifetydfaDrmn o;() exrmfciytfaDe iei;t0 2tmxm ny1op  livsas aruru p;t1altnioeild s2rlnmp u)treomf3to1lmte nvo;(0 rxo(r3io4ape lfvsl()arrru pnt0teeomieiyt a2uaumpnt0artomr3tatlm rli i t0texoxm oudam  lnetls)aDtmu o;o4apxomo3ils m uluvpnt)arxnio3ty1om  aieilt)trxmxm3iudlmen ncs tfs2rmxmonu1tlxo o3tldfm emn onu) lxoxf iodopD aivs ( trto(o oo4ope lictat  2rr(rono4oexnmfciydfm ra(vs;t4tltrmr to1fm rlieol() exmiopoo4am nlivia(faDtax poo4texnmfetadlm2rl( ont)alenir3oodopte i sls0texr(m3io4ap   fcsls a2trxrpnu0tle mi3tlsfs uaums;()tltnir oytom rlnvi;t0 rumxo3iy4ll nmfvsat a2uaumoot0tpxoioeiysfs2elnmp;t0 eeomociytlmt aneo;t) 2tr(mpoydlmteliei ( aDuax o;o0teen f3tytlm emnms;t)artrir3ootlptr uvo;t)srxoxopnu4lmt  fvilt srumurpot0oex  ociysls uluvp t4trxrio oy1lpDrluvs t)setr(opiu4lp n ncsat  2taumoou4tee mf3tlslmDra( o (0 lermf3tydoa r nei;t) etrio3nodopenmfvsat a2tmu p;o0olx ifciltfaDrlu p;(0aeeomf3ia1lat auvo;s0 2xrxr iy4alenlnct t aDta(mp;t1tlxoioeiasfsDemnmsn() exomf tatlm rlieols0 eum(m iydale  ivtls s2urxmo;u4opxnifctldls emums;t0 lenifctadfa  li s;s  2tmxm oodamtelfeil(  rrmx poo0alx  fetadlsDuauvsn(0trerxo3ia1la elies;s  exmxo3iodlme  ivils)sDrr(mpno4texomoctatfsDuanmp u) leomo oa1opt  nvo ()sexr(m3iu1ol elfetat)s2umumpoo0oeeo iciyt s ranmo u) rtrmr3oadfptr i slt0srumxo oo1lltelieslt) rumxm nu0tltnioeiydla2uanmp (0tlenxf3tydlptrlues ()s2to(opnu4ole mfet ( s2ta(ro;t1tlenmicilt m2el(monu0 rermfciodfpD  ieo () 2ur(m3oydlm   ivtls)srtaxm ot0oetniictysfa um( p () lerir oy1lpD ln i (  2xoirpiu1am  mietatf Drmu o;o4oexnmf3iaslm elu p u4tetrmfctydfmDrauvs;t  exrio3ny1amtnlivtl()srta(mpno4opt mi3iys m2ua(ms t4 reomrciytla  lieo (  rxriopnu4optelicta(  ruauroot4aptnii3iaslsDel( onu0 rtoiocoydfpteaivo ()srtrxr oydol e fviasfsrrruro;o0apxn f3iyd aDuluvs ()aleoif3oa1lp eaneo;()seto(m oy1lmt lncsls  rumxrooo4oex  iciaslm2rau s u4trxrir tatoaDraivi;s0tetmim iu1lpenmictasf 2ra(ront4tltoifctaslsDeanms;t4tlerio iydlp  aneo;s0 etoir ou1al  lnviasfsDrrxm nu1optomicild a ea( s u) reoiocoa1lm eluvs;t  2umxmpnudaltelivi s s2ua(rp;o0aptomi3tldlm uaums u4tlxrmoctytfate nvslt0t2uoxr no4lmtemnvt t  Dtrx p;o4olx io3tysfs2emu p t4areomr iadla eai s;s0tetrir nodolen nvtlsfaDrr(r ou4oltn ociyd s elump t)altoifciatfp rli i;t0 rtmio3iodol  licil()s2tmu oot0opxnmociysls rln p;t)arxoioctodlp  ai olt0trxoxmpoydal e fvi sfs2uru o;o1teenio3ils a2uanvs;(0alxnircoadoat ai i t) etr(r3no1omee icsa()sDum(ro;o1apxomfctys m rm(vo;t4teeoxo iotfmD  nei ()srtmimpny4ll emnvtas sDrmxronu0apenifciys mDulnmp (4trermfcoa1fp  au o;t0setoxo3iu4lptemnvtls s2tmxmooo1oleoioeiyslsDem(ms u0trenmr3iodopD auvi;(0trtrir nydalenmieta()artm(  no0tle moeiaslm rmnmo;(0 rxrmocia1fp   ueil(0 2uo(o oy4ap n fetatf 2tmxrpou4opx moeias s2um(ms (0alxrio ia1fmDe i sl(0 2uo(m3ny4apt  fvi (f 2trxmpot1olt ifeiadla ua(mo;u4 eerio totfp e n o;(0 2toirpiy4aptelfesltfaDuax ont1ape iocils sDulnvs;t4arxnmf iydla  auei;s sexmio oy4al   fet ( aDrm(  ;u1tleomo3iasfs ranvpn(0texoio oo1lmt aiei ( seur(r3iodlpen fvi t aDtm(rpnt1tltoiieiat s2emump;u0artoxf3oytlmDrlnvi () 2uo(m io4openmfct ( s2umx pno1teeo fctyd a uau sn()tltomrcoa1fmDrlu olt tetmxr nudlp  mnvta(  rumu  ;t1ope mf3iatla2emn p;(0 rxrxo to1fate uvs;()sruoxm iu4ol elnviat a2ur( p;t4texnmocils mDra(vp u4tlxnifcoo1fmDelneo;t)trxmir3oodom e netasf 2tmxrpot1tptoiiciad m elnmo u0 rerxo iy1lateanvolt)trxm(r oo1openlies t sDua(ront0olxo i3iydfa ea(ms u)aexoir ia1la ean ol( srumiopnu1ole miei tf 2raurp;t1tlenif3ild mDrln o;t)trtoio ta1opD ln il(0sruoxm iy4lm nlfet tf 2uaum oo0alxoif3tadlaDrau on(4tltnio3iadfa elueo;(0t2xoio io1opte fct tf rur(r oo4aeeomoeiysla2ea(vo t4 rtrxr3todfaDelneols0 rtrio io4opte icils)arra(mono0aet  ieiyt a emumsnu) leomf to1fptelneo s tetoxm3iy1ll  mnvtl() 2urx onu4apxo icils s eluvpnu4aexoir3iytom eaivs;t0 exr(m3nydop  livias)s2ta(mont4olx  ieiltlm ean o;() ltrmo3tytfm eai ilt0 rumxrpou1lm elfeia( a2rrxrpnu0tetoif3tatlm rl( o;u4altrio3oatla   iei (  2urir ou1alee fvi sf rta(ro;t4aeenio3iltfsDuanmsnu0 lxnio3iadfat  ies;s0s2to(opnu4lm n icta(  2urxr ou4opxomf3ild m ua( pn(0altomf tatlpte i s;() exr(rpiudlp nlnct t) rumuro;t0openmfciatfm rluvs;(0altnirctydoaD livo;() 2to(rpoodomt  fesas a2um(rpnu4oex mociasfaDeau ont4artrif to1fp   uei s)sruoxm oudal  lneils  2uaurpnt0tpxo oeiyt aDulump (4aeerir3tadfpDelivi () 2xr(opou1lm  mfct tfaDtrxr oo4tee ifctyd a elnmo t4tetomrcootoptraieo s  2urim3io4lpenmfetls)srtmump;u0tlt  oeiadfs2umu p;t4 lerxo3iodlptr n o s0 2ur(r io4lpt mnvtlt  rtmum nt4tlxo fciydfaDrmnvs u0altomf oatfa eaies;( t2toxm iy4apt mneiltfaDtmxmont1aee miciat s2eau ont)texnmo oo1omD livo;t srtoxr3iodolenlfetls srurxmp;u1aptn ocilslm eluvo t) rtnio iadopDeanvsl()t2uoimpnydolt  fcil()arumxm ou0oltnifciadfa ulu o t0tlxoxf3tadlmtrau o s0s2tmxr nu4amtnliviasfsrrm(r ou4aee  f3ild mDel(mo u4tlxnxrcty1lmD lnvo (0trxo(rpoo1omte fcslt)aDtrx o;u1olxnmf3iyd aDel( s;u0 rtnxrcty1fp  au o t0trxo(o3iydlptemfcs sfaruaur nu4optn fetldlm ul(vont0aeenmocta1oa r i ils srto(r3oydopeemfetl() 2rmu ooo4tpt ioeiytla2eauvp () etoirctadfp r ues t  2toxrpio4al n icsls)s2tr( pnu1altniieils s2ul(monu0 rtoxr3tytfaD aneo;t0sexo(m3ny4ope  iesat) rtrum oo4optoioeiaslmDrluvp t0 reoircoa1lat aiei;( srto(m nydam   netlt) rrrxm nu0opt iiciyd s emn o;u4aetnmfcio1fp   nvslt)trumimpno4om elies s)artmxr ;t0alxn f3tytls rlnvpnt) rtoxr3iydlaDeaueilt  2tm(o3iu1lmenlfvsl()aDurx ono4opx mo3iyt aDrluvp;u0trxnxf iatoptrlnvo;() 2xrxm oy1al n nctatfaDtaxr ;u0tptomfeiasfaDemnms;t4 ltrxr3ta1lp rln o;t0 2toxmpnu1om nlfctat aDtm(monu1tlx mo3iydla2eauvsnu) leoxociydla eaies t) rtmir ou1lptn ivs tfa2tm(  oo0oetn oeildla rlnmsn()trtrmo3tadfateliei t0t2tr(mpoy4optnmfctlt artru ono0opxo i3iasfm eau snu) etrmo3iytfateaivs ()srtmxopoodap emnvsasf Dta(ronu0aexo iciltlaDrauvo ()texrmf totfptr n sls0 2tmiopiu1llenlict sf rtmur no4aetn oeiytfm ra(mon(0alxoxo3iy1fp rln slt trurir iu1omte netl( s2um( p;o4olt iietytls um(vp t0treomo3oodlateaieo;t trumio iy4alenmfcsat)aDururp;o1alx ifeiaslaDrln p;t4tltoxrctodlatrlnvol(0 ruo(r3oy4om nlnvsasfaDtaump;u4tlx iiciytfm ra(mo t)trtnmr3ta1op e nes () eum(r iu4ap   fet (fartrxmpot0aeen oeildla2uln snu4treoxo iodfat lneo s0 etmxmpiu4optn ies s)sDurx p;u4aptomociytlm rmnvonu0 lenio iotoat  i o t sexrxopio4ap eliesa(fartmxroou1tpenmfeild m eaumo (0 eerir ty1fmtrai sl(  2xm(opoo1opt  ivtl()a2taxmpno0oeeomo3ilt sDel(mp;t0arxoxocoadfaDraues;s trxmirpiu1olen ivi ( a2uaumono0oex  ieiytfmDrl(vsnt)aexoirciydfaD lieo;s0trxm(mpnudap emnvtls  2tax pno0tltnmoetat m2el(mp u)tetoxo3ty1fmDr neo () 2xmxo3io4ll elnvtl(farumuroou1opxomi3tldlm uan o;t4 etnxfctodfp e uvslt0 rtmxr oo1ame  iesa(  2urxro;o4altn i3iyslm2rm( on(0 lxoxoctydfpDeaivo s seurio3nu4amtn nvt (faDrr(rpno1opxo oetld a2rluvon(0 exomf ia1la  an ol(  rumxm ou1amtelfvi s)aDtaxmpoo1tlxomociasfs emnvonu)tetomr iytopte nes;s)seuo(opoydom n fci t aDrrxrp;o4tpe  fetytfs2ulumpn() eeomf3iy1om   u i;t) exm(o3ou1ameemfei (f Drruro;u4teeniictat sDemu s;(0texnmf tytlmDe i i s  rxoir ny4lp  mnci s s2ta(rooo0tet  oeias m rlumont)tltnxr3oy1laD liesls srtm(m ou1lmeemivtlsfarur(m nt1oex  o3iadlm ranmo;t)areoifctydlaDeln s;t0s2trir nu4al elivsas) rua(mpnt0tptomf3taslmDrlnvs t0 leoir3iodoa elu o t0 2urirpiu4lmtn ivi s)a2ur(rp;o4altoifcildfm2rau s;t)aleniocoa1lpDeau ol(0texmxm3ou1am e fcia( s2tmump;t4aex  oetyd sDrau p;t0aleoio3iydomtrau o;s) exrxo iy4op elncslt) rua( pou0aexomictyd sDemnvs;u0arerir3tytfmDr nvo s0srxoir iy4am emivi t sDrau  ot1oee iietatfm2umnmp;(4trenir3oo1opDr nes;t0 etmxr3io4opeemivias srtau pnt0oexoiieiyslsDuan s;u0aetoir ta1omt lues t  rtrxmpoo4lpe  fvils a2rmumpno0oleo ieildfmDulnmsn() exnio ta1faD an i t texrxmpiy4om nmnesl( aDtaxm nt1apen o3tlslm ean snu4 exoxr oa1fmteauvol()t2uoxopnu1llt mieiat)srrm( onu1altnifciasfsDran s t0 lxoir oodopteau i t0t2uo(m3no1apteliciasf 2raur ;u0altn o3tat aDum(mpn(4aeeomo3to1opDe nvo t) 2xoir nu4ale  iesa()arua(m no1oeeomfctadls2ea( pn() ltrxf ty1lm  lu ols) eumim nu1amtnlicia()arum(  nu0apeoifeildlsDeaump;u0tlxrmfctotoptranvol() rxmimpio1om nmfeiltfsrtmum ot0apt  ocils s2uanms t4 lxomoctodfptr u ilt)t2uoxo nu4lm nmfcta() Dra(rpno1oleo ocildfm ranmpnu)texrmo tadfp  aivilt  rumio oodllte ncsls)srur(mpnt0aexnifciydls2um(vs (0teenmo todlat lnvs;() rurxr oo4lpe mnei t  Durxmoou1aexnio3ils a eln o u4 rtomrcty1fp  livslt)srum(m oydam nlivi (f Drau oou1aleoio3iltfm2em(vp u0teerirciadfmte neo (  exrxo iy1om emfvtlsfsDrm( p;t0tlxomfcilt s2umump u)aetnxfcto1la elnvo;( sexmio nu4oleelnetasf rtmxro;o0oex mf3iys a elu on(0 exrxrciodom  luei;( sexmir3io4lp emnct (  ruau o;t4opt  f3iatfmDrmuvs;u4tltrxf3iytfatelivs;t) 2tmxm3ou1ope  ici t s2rax pou0tpt  o3ildla ua(vonu0trtoirctadla eanvsl( seto(r iu4ol   fet s s2tm(moou1optoiieils aDran pnu4 leomr3ty1op ean o t) rtr(o3oodomt  ivsasf 2ra(root1apen feiadlm uanvp u0 renxr iadfa  luvo;t0t2xriopno1apen ieils)a2tm( pnt4aetnif3iys s um( ont0tltnmrciotfaDelueol()tetmxmpno1altn ncsls) Drrum nu1aeen fciatlmDelnmpnt4artoircoadlmtrlivi s0 rtoim ny4lmtelfctl( s2tauro;o4aexnmo3tldfmDemums;u0altoif iytlaD  n sl(0seuoirpnodlptn ivslt  Drmxmpot0tpe mi3iydls2ean o;t0 rxnif3iatfmt ln o t s2um(o3no4altnmici s)s2tmurono1aleomociltfm2raumo;u) lerio ia1faD luei;s)teurirpiu4opee nvi s  rur(m ;t1aet ii3tltfa2umumo;u4aetnircoadfptrauei;(0srurxo3iu1ale mnvilt) 2urumpnu4olx if3tldfs rlnmp t0trerif oadlm  luvs;s) etr(r nu1amtemicil( sDraxrono1ole  f3ilsfa2elumo;(0 lxnmoctatlmte nvo;( teuriopio4oltn iei (  rumx  oo4tet  o3iydlaDraums;u0 exoir ta1fpte n i;() rurir3ou4lp   ietas  rrm(monu0oet iictldlmDrl(mp t)arenio todomDe i sl(0seur(mpoodap elfeiat a2trumont4openmfetatla2uluvs u4tetnmf3iodlmt au s (0 rtr(rpoydlptemnvs (fsDrax  ot0aleomi3ilsla2uaumpnt4teerxf3tatla   ueo s)sexo(o3iy1open nes ()a2um(monu1altnio3tysfa2eau sn(0 etoio iodlpDr uvo (0s2tmio io1lmenlneta(faDrrxrono4aeenmfctasfa2raumo;u4 reriocoa1fpte n o s)sruo(r3io4ap e fcils)sDta(rpnu4aetnmictasfaDuauvp t)tlxrirciotfm  ln i ()t2uoxrpoudome lict (fsrumx pnu4tetnii3iat s ra( o (0aexomf3iodlmt lnes;t) rxmxrpoo4lp  lfvi tf Dtrx  oo4aetomf3ilslsDea(mo u4 ltrmr3oadlpDrauvol()srumim3iy4alen nesls  Draxrpot0open i3tasla2uanvs;()trtrir3oytfa  an s s0trtoio iy1lmtnlicsl( a2urxr nu4oetnmf3iatfaDeanmont)artnir3tydomDr i olt)sexmirpiy4apte fvtls) ruaxmpoo4optnifetltfsDran p;t4tltoif tydopDelivs s setrxo3nu1oleelivtl( a2umxmpno0opxnmoeiysfa2rl( p (4 rtomr3ty1fm  an s;t trxo(r3nu4lm   nvsa( srua(r ;t1texn iciatfm2rmuvp t) lxoif oatfaDrlu ols)srurxo nodopee nvils  2rmur nu1opx moetydfsDulumont)arxnir tytfaDr uvo;s sexmio oy4amenlictls  rtax  ;t4opxomfciaslmDean snt4tltomf3ta1omDraneo ( setm(o3ny1lp e ieil() ruax oou1oetnmf3ilslm2uauvs (0artomr3to1fateaiei;s t2to(opoy1op nlnct s)s2raxm ou4aexo ietld sDem(mp u0tlenmrciy1fmDran il()srxrxo3iudopt  ncs t) Drrxr no1aee ioeiytla2um( s u)arenir3io1fa elu o s  2xoio nu1lpenlicslsf Dta(rpnt1tptn iciatfa rmu pn()tlxrxfcoa1lmtran ols t2xo(opiy4lp  mics sfartrxmoot1olxn f3tls a rmnvo (0tlenif tydfmte uvslt  exrxr3no4ol n ncsas) rrmumooo1tet  ietasfaDemnvp (4 rtomr3oatfp   n ils0tetr(m oy1amt livta( srra(r ot1tet io3ildfsDrm(vs t4arxrmrciytfm eauvs;( trxo(m nydom e ivsls  rrr(mont4aetnioeiys a rlumpn(0 exrif3oadoa   ies s s2tmxopiydlm elncsa(fsrtmu  ;t0alt ifciydfmDrmuvpnt0trtnio3iatlmD livo () 2trir nu4ol emfvta()s2rmxront1aexoifeild sDrmu s u) lerif oatfpD lneo;s trxrio3iy1op nmnvtlsf 2rmumpno1tpenii3tytfaDulumsnt)alxrmf iy1fa rai sl(  2xoim3no4om  mictlt  Dta( pnt4oee miciltlm2ea(vont0altrxrciotoatr u il(  2xrxmpio4lmeemicsas) Dtmu onu4ale mieiltlaDua(mp;(4teeoxf ty1om  li olt truo(o nu4lmenmfvi tf Drmx pnu1tlxoiieiadlsDuaumo (0alermfctotlatelueil( s2tmxm3iy4amenmfct t) 2ta(m nu4alt  o3tydlmDemnmp;t4 lxrmr3ta1fmD auvilt0 2xoxm oodapt mnctat)artm(rono1tpt ifctys s rlump u0trxomr3iydomDe neil(0texm(rpnydoptn fvils srrmu oou4aexomiciys sDul(mo u0tlxoxo oydoaDr nvslt  2uoio3io1omtn net s)sDtauro;o1oeen ietaslsDrl(vsn(0 rerxr3tatlaDrai ils0trxrxr3iodll e nct t) 2rmxmoot0altn f3tyslm rmu o;t) ltoxf3iodlp   u sls0 rur(opoodolenmfeiat)arrrurp;o1tlx if3tlsla2ua( ont4trtrir3iodlm eauvo t)t2urxr ou4alte ies ( a2uaxr ;o0oltnmieiytfmDum(vo u0arxnxr3oo1fmtr nesls) rtmxo oy1apt mfvta()srua(m nu1apxn octad sDul(vpnu)arxrxf3tytlpDraieols0trtrxr ny1oltnlfetl()s2raxrp;t1tpxnmicild mDeau snu4 exoxo oytla r ieo;( tetrimpoodlptnlicta()s2taxmpou0tex ioeiad m2um(vp;t4arenxf3totfp  lu o () 2xmxo no1olenmneiat sDrau pno0tltnio3iyt a2rau ont0 rxoiocty1omDeauesls0texoir3oy1lpt lfvi tfa2uauront1tlxniociyd a eluvp;t0aexoio oatoat aues t s2um(m nydamte nctltfsDtmx pno1oeen oetltfm2elnvo (0altrmo tadomtelieslt)trtrim3io1altemfviasfarrrur ot4oetniieiltfa rl( o u0 exrio3iotlaD  ueilt  2xrxo3iudlm e icil()aDrau poo1oexo octld aDeanvpnu4alerircoa1fm   uvi t s2urxrpnu1am  lfet (  Drr(mp;u4aptnmociytlsDumnms t)aexrxo ty1fptr nvs s) etm(o3nodlptnmnctas)arrm(r ;u0aee mictasfs em(mp;(4 renmoctatlptr u s;s srxrir oo4ameemnctas) Dumu  ;t4olenioetadfaDulnvo t0 etomfctotla  luvo;s sexm(mpiydap nlnesa()arraumpoo0apxn o3tltls emn o;t) lermo3ia1oa ran il(0 exmirpio4amtemivtls) Dtaxm ot1tpe  feiaslaDra( p (4 ltnmo3ia1omtelu sls) rtm(o iodom nliesasf rrmx  ;u0tltn o3iltls rlumo u0trenifcia1lp  livol(  rtoir nodap n nvslt)a2raxmo;o1oex  o3tasfmDemums t0aleomr iodfp r iei ( seuoxm oy4omt mnvt s)s2tr(rpno1aptomietld mDraums t) rxrir3ia1laDeaueo t  rxr(opnydlmeelncsat) 2tau poo4apx if3iad mDrmn s (0alxomo3iodlpt aivo;(0 ruoiopou1lmt  ncil(  Durxro;o4apxnmieiysfa2uau o u0 rxnirctydfp   uvols0s2tr(r iy1amenlfctat)sDrmur ;u4aex ifeiad s el(mpnt) rerxr oadom rau i () 2toxm3oodlptnmnviltfs2urum nt0aexn icildfaDrl(ms (0alxrxr iotfpD auvo ()trtmxo3iydop   fcs sfaDurxrpou0texoiieiasfm2uau s u0alenifcoydfa rluvsls seuoimpnydole lnciasfsDururont4tpt  i3iysfs ulu s;()teeoif3io1lp raies s0teur(rpiudlme mncsa( sDurxrp;o0apenmo3iltls2um( on()tlxrmfcoa1fa  aivols trxrxo io4ame  fciasfa2rr(rpoo1oetnmietldfmDeauvp t0 rtrio3iotopt  nei;s)srxmio3nudame lnei ( aruau pot4aet mf3iad s2umuvon(4 rtrxocoo1lptr iesl( s2tm(o3iy4lltnlfvt t s2raurp;t1aetnmoeiys m rln o (4artrmo3oodlpDr ivi t) 2tmxr3no4ameelncslsfaDuaumont4apxoifciytfs2emuvs (0 lxnir todfmDeanvo s0trxr(r iu1llte ivtl(fartrxmont1tpeoioeiytfm2emu p u0 eenmocio1lm rau o;t srtrxr nu4olee nvtl() rrr( ooo0tpen fciad a emuvs;(4 rtnmo3iadfaDr uei;( trurxopoo1lmt lncsat s2rrx pnt0aleo f3tldlsDuauvs;(0arenxo io1fpt aivi t) exoim nodap  lncsa()arua(monu0ole  o3tlt aDeln pn(4 lerir iatlmteaieo ()t2um(r ny4am e nctas aDraur ou0texnioeiyslsDem( s;t0arerircoa1fpDe uvi ( sexrxr no1ole  nesa(f Drm(mpnt1oet iieiys aDranvpnu)texrmf3io1oaDelnvsl(  rurimpiu1lleemnes s a2um(r oo1opx iietytfm2ranmo;u4 rtrxo oa1lpte u s s)sexoio3io1ap   neiasf 2trump;u0tetnif3ilt m2ulump;(4 eenmf oy1lptrli s s s2xo(rpny4opeelnet (fsrtrxm ot4apeniicias s rm( s;t4 etoxr3iodlmD aneo;s) etr(m ou4amtemnetls) Drmumonu4tltn ictldfs2rl(mp;(0aleomfcoytlp ranes ( trxmir3oo4om emfetlt) 2ua(mpou1tlx ioeiydlm uanvs t0 lxnmfcoodomDr u i s)texrxo3nydamte ieiat  Dtmumont4oeto ieilsfm uluvp u0 rtoif3oadla  anvilt)trtr(r3io1op nlneias)a2ururpou0aeen f3iad sDrlnvs;(4tleoxrcto1fp  lneo t)s2trxo iu4lleelneiatfa2rrx  ;t1aeenmfeiltfa2emuvs;u) lerxociotfptrlieil(0setmimpoo1omenlnei sfsrtmxro;o0oex mi3tlt mDumnvp;u4treomrcoodoa  lnvo;s  2ur(m3oydlmtnlfvta() Drr(mpno1aee iiciatla emn s t4trxrxociotomtr nvo;s t2to(mpiu4lpenlneta(fs2umuro;u4opt mo3iadlm2rau p;u)texrxf3iydomDraies t  euoxo3ou1ope mfvsa( a2tru  nu0oexoiieiasfmDumu p;u4arxoir oo1fp rau il(0sruo(r no1ame  neslt)s2tmurp;o4opx ioctys a umnmpn(0trerifciotlpD  ieo ( s2urxrpio4omeemfet tf 2rru  ;u0altoifctltfm2eluvo t4trenmfcio1om rauvi;s0t2tm(opoydamtnlfcsat)s2tmx  ot1tpxoio3iltfs2ra(mpnt0trxomoctatoa ranvslt  etrir3ny1om elfvta( aruaumpou1opx if3tas sDea(mo;t0tlxnxf oodfp ran ols)t2urxm nydap   nvil( srtmxm nt1opt ii3ilsls ean o;u4 lxoxociy1lp raueo;s tetmxopny1olenliei t) 2rmumo;t4apx io3iatla elu ont4tetrmociotfat au s;s s2toxrpiydapeelfcsltfsDra( ooo4oeenmo3iadla rmuvp t) ltrmrcoadla rai slt trxm(opnudomenlfesas)s2rm(mp;t4aexo oeildlmDumn ont4tlxoir3tytfm rlu i;(0 2um(r3iu1om elfcil(faDraurpnu0alxnmieiltls2umu p;t0alxrio3oytfmt lu s t seurir io4apee nctas  rrmx  ot4tle  fciadfa2rmn o t4aeenxr3iodoa  aivolt)tetr(o oy4op e iet t)srumx  ot4apeo ociys m2ulump;(4aetrio oodoat  uvsls0 etoio ny1openlnvs tfs2trxmp;o0oetnioeilsfsDul( p;u4 lenmf3oo1oa  an ols  2tmir3oo4ap  lncsls  rum(r nt1tpxo fciyd a uan ont)tltoif oatlpt  uvol( sruoxopiu1am nmfvta()aDrr(m nt0tptomoetltla2ulnmpn(0 etnmf ty1omDraneo;t)seuoir iydomee iesat a2urxm ;u4tpxoiictyt a emuvpnu)texomo iy1fmDraueil(  rxmxmpny4ol  lnctas) Dtr(r no1apx  f3tltfm2ea(ms;t0tleoxfciatomtrauvsl() 2tr(m oudoltn fesl()s2raxro;o1optoioeiatfmDum( ont4 etnmo oydoa raues t0teurxr no4ap   ics s srrauroot1tet mf3tys a rl( s;t0arxoxo3ty1omtr neilt) 2trxopoudlm  miciat  2tmxr no4aetnii3tytlaDelnmo;(4trenif3iytop elies (  2tmxopnudolte neta()sDtmu ono1tex io3iysfm2eauvs;u) renxociadlp  li i t  2urio3nu1aptemnei s)artrumpno1ole iietasls ulu onu4teenmociadomDelu il(0t2toir3ou1llen ict sfsDurxr ;o1opxomf3iydfm el( o (0 etomo3ta1fmt  uvsl(0 ruoio3ou4opt mncilt)sDtmxmpno4opxnifeild s rmu o;u0arermfcoatfm  li s t t2uoim3iu1lmtelfvt sfarum( pnu0tetoiictlsla umumo;() reoirctatoatrluvs;( t2umxo oodol emiei sfaDrmu poo1tpe  i3ilsfmDrm(vont4 eenif3to1lat auei s trtm(o io1olen nvta(  rtaxmono0oetn fcilt m ra(vont4tlxoir ia1fpD au i;s  rtmirpio1op emfeilt sDrrx onu0alen i3tytfa em( p (4 rxomocty1oa rauvo;(  rxo(r nydll elfvi tf Dra(ro;u1aptnii3iyd a2ra(von(0aexoxo3iotlaDelu i;s  2toir3iu4lpe licil( a2raxrp;t1tle if3iad s2eanvonu4 etrir tadlpteaieo s  euoxm3oo4omtnlfet tfs2ra(r nu0tet  oeils m eau p;u) exnifciydom  aieo;s0sexmxo3iydal  lfei s  rua( pnt0tpt mieiltlsDrmnvpnt4 rtnxr oydlaD li il( t2trirpoodameemiet sfs2tauroou1ope mfeiytlaDrmnmont0 eermo3iatlaDran i t)tetm(o3nudom   ncsls a2tmump;t0apx mi3tat s ra( p t4aexnmr totfa rluvo t  exrio3nu4lp  lfetls)artmxm oo1tlen i3iad m2em(ms t4alermfciatoptelieslt0truoimpio4omtnmnct t sDraumpoo1oee  ictyt s2ra( p (0tltoxr3io1lmD aieils)t2uo(m nu1oleelfeslt srtmxr ot0opxnmietydfsDel( p u0 lxoifciotfaD ai il(0s2urxopny1aptnmnct (f rurxm nu0oltomo3iys a rlu p;()aeerircta1om eai ilt0sexr(opnudop emnvsatf rtmu oot0aeto ictyt aDrau p u4trtoxr3io1opDrlnvols0trtrxm ny4ale mivtasfsDuru o;t4aleomo3tasfsDranms;u0 exoir3oa1oaD aiei;t  exo(mpiy1lltemncia(f 2uaur no1oetn i3iytfm2um(mp;u4 ltrxf3tytfpDr ueo;s  rumxm3iy1aptnmiesasfa2rr(  nu4teeoiiciaslaDumumsnu4altnmf3iadoa ran i;t trxmio ny4ope  fei sfarra( o;u1teenmo3ild sDua(vo;t4alerxo iy1opDeauvs;t trtr(r ny1lmenmnei tfs2rm(moot0oet io3tldlm rlu p u0 rtnxf oadoa r ies;t)seuo(o3iy4omenliei s aDurxr ;u0aetn ictltla ranvp ()tlerxo iytomDr nvo t0srxmir iu1aptn iciasfsDrm(rp;o0oeeomf3iadls2rl(vpnu) renmf iatlpD  uesl() 2ur(mpnodlmee ict s) rrr(rpou0oexomi3iatlaDelnvp t0 rxomf iy1opDraieils) exoim3nydoptnlies ( sDururpnt1tetnio3iadfm umuvp u4arxomo3oo1lpDrauvols0t2tr(opou1lle  fvsl()a2tr( ooo1teeo ietyslsDumnmo t) eeoio3tatlaDran il(0t2urimpoo4openmfcs ( a2umx pnu0opxo ietlt sDuauvonu0trxnxfcoodlpt  ivols)t2xr(r3oo1om e ics sfsDta(rpou4tltomfeiasfs2ulump ()aeerircto1lmDeaneo;( s2xr(mpoo1olte fvt s) rrrumoot4oee if3tatlm emnmsn(4aeenir3tadlm raivo t)t2urir iu1lmeemfvils)aDtm(  nu4opt  feiyd m2eluvsnt0tltrxo3ta1omtrln o ( trur(r3no4op nmieta( srra( p;t0olt mocilslm2elumo;u)arerxoctatfpDr u ilt0seurxm3iu1omtelncsat)aDrmumpnt0ale moetlsfa ra(vs t)altnifcoo1lpDelnvi s0t2tr(r3iydlpt mfctat)s2raum nu1apeoiocias sDemums u0trxrmf iotfatrli i t s2uo(r oy4apt mncsatfa2rmxrooo4ape miciytlm2uanvo;t4tlenir3tadopDe ieslt0 rur(opnu1apee ietat)srta(  no4aeeomf3tydlsDeanvp;u4tleoio iy1lp elnvils t2to(opiodal   fetl( s2rm(m ot1opx mfciasfs rlnvs t)aexrxo tydlpDrauvs;s0s2xoxo3iy1ap  mncilt)srtaxmo;t1ale mf3ilsls2el(ms;t)alxnmocto1oa r nei s t2uo(r3oydlptemies tf rrrur ;u1ole  o3tas a ulnmsn(0tlxrio oy1la r iesls)srtrio iy1ale mfeiat)sDtaxr nu0alt mociltla2ra(vpn(0 exrxoctotop elu s;t0 2um(m3iydllt  ivtas a2raumoou4aetn fetld a uluvp u)areoifcoodlptr ieo;s) 2toio iy1llee nvt s) Dua(m nu4aeenioeiasfaDra( s u0altrxo ty1lptraneil( teuoir3nu4om n fviasfsDtm(m ;t4oltnmfeiydlm ul(vsnt4 exnir todlmDrli o;t)trxmxr3nudame  ivtatf rumxr ;o4apx if3iasfm2el(vo;t)aexnio3iadfaDelivi s s2uo(r3oo4altelnctat)aDurxr ;u4opeoioeiltls2umnvont4 lxnxocto1lpt lnvi t0 2xmir io1oltelfcils  Durx pno1alxnifeiytls uau p;u)alxrmfctydom   u olt0 rurirpoo1al n nvsasf ruru  ou4alx io3tlsfmDem( s u0trermfciatlptraieol(0 exmim no1al nmfcils aDua(mp;u4tetnmfciatlaDrlu s;t0 rtrxf3oy1optran s t0 exo(m3iudap n net (  2raurooo1aptn i3iys sDuauvpnt4 ltrxfciodlaDraneols) exm(opou1llen nvtl(f 2ra(  nu4alx ii3iatfmDelnvonu4 eermociy1fp  lneo;(0sexmim3oodaleelnvias a2ra(ront0aex io3ils sDranvo;()artnmo oa1omtrlieo ()texmir3nydal  miviltf 2umu ono4tetn oetadlm ra(mo;u)trerxfcoodlpDr neilt  2um(opiy4op nlfeta( s2tmur nu1tlx iiciysls eluvp;(4 lxriocoodlptrlu o;(0 rxrim3oo4lp  mnctat s2rrxrpou0olt mf3tls s el( o () eeomo3io1omtelivi;t0s2to(r iydal emneiasf Dtm(rp;t1aleo oetysfa ua(vpnu0aexrxr3ty1fpDr i s (0srtm(opio4altemiet ()a2taumpou0tle if3iltfs2rlu s u0 lxoir3iatlm  lueslt  exm(o ou1ll emfet (fsrrmur nt1alx  ieilt sDrlums;t0 exoxr oatlmDeaueols0truoxopiy4lpt lfcs ( a2tm(ronu1aex ioetls s rlnvp ()tlenio3io1fp elivi;( t2to(r3no4op n fet s  rurxmonu0aleo f3tydfm emnms t4teermfcoytlmtrau o;(0sexr(o3nodam e icsa(f 2rru o;t1tpeomociys s eaumont4 lerxrctytlmD  n s s  2umxr3io4ome lnci (  rurx onu1oeeo fcild s2uanmo;t4aetoxrciytlpDraies;( seumimpnodalte nvt t sDrmxmpot4tpeo oeils a ean o;(4 eeoir iadopDelivsl( trxmio3nudlleelieiatfa2urumo;u0tltoio3iltlm2umnvsnu0trerio oa1fmt  iesls)teumxo iy1lpeelieils sDuaur ;o1teto f3iys a2elnmp t4aetnmociadlaDeluvo;s  2xo(r3iy4ol nlfei ()a2rmu  ot1tpx mictlt m rl( o t4trtriocoatom elnvsl(0trxm(opno1ol nmfviat)sDrm(r nt4alx mfeilt a eau p;()arerio iodla   ies;(0teumxopiodop  lnetlt)sDrmxr oo1optnmieiytfa ua(msnt4 exrircoadoa e neo;t0sexriopoy4lm n fvi t  Dtr(mont4olxomo3ild m2elu o;() rtoxfcoydfmtranvi;() eurim3oydoltnmict t  Drmu  nu0teenmieias aDea( o;t4alxnxocoydfm rli s s)seuo(rpnodll e net s)s2rm(r ;t4tlen iciytlm2ea( on(0 lxomr3ty1lpDran sl(0 2to(m3ny1olee fvs ()sDtm(mpoo0tlenmo3tatla2ulnms u0alxrmf oodlptrlivs;t)truo(r oy4alenlnct t)sDur(ronu0alxnmociasfa ranvo;u)alenxf3ty1op   n o;t0t2to(r iodlpen neiasf rrm(m nt4tlto ieiad s2umn ont0 eenxr3oa1fatelivs s  2trimpoo4lleemictl(fs2taxrpou1tlen feilt m2ua(vsnt4 lxnirciy1oa  auvs ()s2xrirpou4lmenmnvtlt  2ua( onu0aexomo3iatfm ra( o (0 reoifcio1lptrauvo t0 2umimpno4al emnvsatfaDumxmpoo4oet  ocilt a2uanmp;t0 lerxrctydlpDelu o;() 2trimpou1op elnct s)srum( pnt0tptnmi3iaslaDrauvs;u0 rxoxf iydfmDr u s s0trtmir nodoltemncs () 2rr(rpoo4apenmieilt a2umnmo u)arerifctydfa rlu il( s2tmxo io1ol  micsls)aDtrxr ou0tptn ietys a ua( s t)altnio oy1lpDeai s t0tetr(opnu1lp  lncslt)sDurumonu1texoifciltlsDul(von()areoir oo1fptr uvo;()truo(m nu1opeemnci s)s2umxmpot4aet  icias sDranvp u0 etnxo iodlpD luesls s2xo(r oudale mncsat)sDua(mpou4apt iieildfs el(vs (4 lxrirciotoatr ueo s  2tr(r oodllenlfvt tfsrum( pno1alx miciad m2rmuvsnt4trtnxocoo1oaDe ies;t seurirpny4ameelnvsat)a2uaxr oo0oltoioctys a ul( s u0tlxoifcoa1fptranvsls0 rxoirpou1lp nmivs (faDta(mpno4tpeo oetyd m2ua(msn(4tltoio oatla r nes;s texrxo iy1lmtn fvsas aDumxmpot4olen oeiyd mDumnmp;t0texnmf3iodfa r nes;t t2tr(m3ou1omt liviatf 2uaxmpno4oexoio3ild mDulu o (0trenxo3totlmD ln il( sexrim3nydoptnlfei ( artrxrpot1openmi3ilslsDrmn o;u)tltnxr3tatlatelnei;()trxr(m3oydomtn iesl(f Dumurpoo0aeeniieiys sDemn snt0alenxrciydlpDean o t0 etrxm3ou1al  lnvils)s2uauro;o1aptnmicilt s rluvp (4 exnxrctadlpteluvil(  exmxrpiy1omtelfviat  rur(root1alx  o3iysls2el(msnu0 eenio ty1lmt  u o ()seur(r3iy1apt lnetlt)s2ur(rp;u1tleo ieiyd sDuaums;(0tltrmfcoa1fa  lnvols)srurxo3oy4lm n icsatfa2um(m nt4oeeoiicildfa2rluvsn()aexnioctytoate n il() 2trir nodom  lfesls  2rmx p;o1texo icilt sDuluvon(0 lxnxrctatoa  li o (0srtrxr io4llte feslt  2ra(mpoo0altomfciyslm elnvs;() rtrxr3ty1oate i s t0t2uoxr3iy4altemici t)aruaxrpoo4oex micias s um( p;t4aexomo iadlm  li o t  etrxrpiy4omt mfcsls a2trxmpno1apx  ociyslaDemnms;t0 lxomfcio1omD  iei;t)srxmirpoo4omtnlfesltfarrrurpno4olxnmo3tat aDranms (0alxoiocta1om rauvols s2xmxopio4opte iciat  Dtrx  ;o1oexn o3ils a ra(vo;u4tltoio3iotopDrlneo;t0 2xm(o oy1lmt lieilt  Dua(monu1oeenioctld a rau o;u4altomf iadlpte nesls)s2tmir io1ap elnesa(farrr(ronu4apxomocils m um( pn(4altrir todlmte nvs;s trxo(r ou4oleelfcslsfsrumxmpoo0olxn feiysfmDea(mp;(4altnmf3iadfmDrluvs t) exo(mpio1om elivsatf 2urx oot4aex mo3ild mDem(vs;t0tlxnmr iadfaDeli ol( seuo(o oo1al   nvs sfaDuaxmpnt1altnifetydla2ea( on() rtoxfciydlp rluvi;t setmim3iu1altelfvsas)s2ur(mpnu1opxn ictys m rluvs t4aetoxr3ta1fp eauvo (0 etmxm3oo4ol elfvi s  2rau ont1open oetyd sDrmumo (0 rtrxf tatopD  u o (0srxoxo3iydlleemnvsat) 2umxmooo4opeoiieiadla2rau pn(4texrmr3ootfp  aueo;s0 rumxmpny1aptn fvt sfsrrm(mpnt4tlx moeilsfaDea( p;t4tetoir3oatfpDrauvi (0trxoimpnu1lpenmfet s sDum( pno0oeeoii3tadlm2ulnmp t4alxniocoy1omtr iei;s) rxr(r3io1altemnes ()srtrxmpno0tptnio3iydls2el(vo;u4altnxoctadoaD  uvi t  exmim3iudameelfctlt s2raumpoo4tee iociad a ua(msnt4tlxoxf oodoa elueolt0t2trxr3oydaltn fviasfarrax  ;t4oeeomfciytlm2rl( p;()trxoxfciadomDr neolt0 rxrir oo1amtelfesa(f 2urxmoot4aeeo fciadfmDuanmpnu4aexoxfcoodfptelneo;t)sexr(opiudllt  nesat)a2raur no1opxn oeiatlsDelnmp t0alxrifctadoa e neo ()tetr(m3oodlp emfvs t) 2ua( pnu0oleoii3iydfaDelnms;t) ltrxr3tytoatr ies t)tetoirpnu1amenlneiat) rurxr ;o1alen ociytlm2rl( p;u)teerio3ootfmDelieslt0setr(m3iudol emicsl( aDtm(ro;t1aexnio3iyt m2um( pn(0aexoif3todopDe u s;t s2xr(o3iodop elictl(farumx o;u4aptoii3iytfs2elnmo u4 rxrif3io1omD lnvs s) exr(mpiy1altemfctlt a2taxm oo1oeto ieiltls ua(vo t0aeerxrciytoptrai i s0setm(o ny4lpt mivi s)s2rmxr ot0aet  fctaslm eau o;(4 rtoxf3ty1omD lnesl(0setrxo io4llen iesatfarumx  nu0alenioeiaslaDum(msnu) exnio3iydom rauvo;s sexrir3oodlme  nvtltf 2tmx  nt0aet moctldfsDumnvsnt4aeenir3io1fm r ivs;t  rtm(o iudlp e ietas  rrrxm nu4aleo feiydls2rlumsn()trxnxo3tadom  li s t  2umxo nu1omen fvsa(faDtrxmono1teeoio3tydfs uanvp;u)artrmrctadfmt  u ol(0tetmxo iodolenlfvsat s2tm(rpnu1oetomietad aDranmo ()texrmoctatfp  aivs;s0texm(mpoo4oltn ncs (faDtaurooo0tpenio3iysfs2emn p u)artnir oodfmD auvs ()seurxr iu4lmenmfvt s a2umx  ;o1ale mfeildla ul(ms;u)trxrmr3tadop r neilt0sexr(o nydomenmivt t  Dtru onu0tlenmf3iys s2rmn onu0texoxf iodlpD aivo;(  rxm(r ny4op emfetatfartr(ro;o1texomieiasls eanvs ()alxnmoctodomDrli s t) rto(mpoodomt miesl(farumur no1apeomiciydla eanvp t) lerxr oy1fa eaieols0 ruo(o iu4lmeemieil(  Duaxrpno4aeeoiietys sDrln p u0 lenxocoydfp e iei t t2urxopnu4lm e netas)arrr(rono4tlt mo3tls a2emnmsnt4alerxo3tadomte iesl( t2uoxr3iudalenmfcilt)aruau pno0ope ifciytfaDea(mp ()arxoxo io1oatr neo t0 2xo(r3oy1ome  ncs (fs2urum oo1tlto i3iad m ulnmp;(4alxnmoctadomDeaueo;( tetm(o3nudlpe  ncs (fsDrru  nt0tlenioetaslm rln pnu0 renmr iodlaDrlies;t0 rtrimpio1optnlicilt  2ua(r nt0tleoifctat aDuaumo u0 lxrmo oatfp e u i;()sruoir nudolt lncia()arraxm no0ale ifcild s2eluvs u4aetnxf3todlate ies;t0t2xr(m3oudaptnlfvs sf rta(mooo4aptn ociyslaDrl( on(0aleoircoodomDrauvo;s  exrirpny1om  lfet s)arra(r nu1tltoifeiltla2el(vont0tetrxrcoytoa ran o;( trtmir ny1lm  lnciltfs2raum ;o0aleniocild a ra(vs (0altnmo3iatlpDrln o s) rtmir3io1am nmfet sf Dtr( o;u0oeeomictadla emnvs t)altomoctatlptelnvi;s)sexmiopoydaltelfciat) rtrurp;u4aetomo3tat mDrlnvs;u4 lerxo oydom rlivi;s) 2to(rpiu1alen nct ( a2truroot4olx if3iaslm2rlnms;t)aleoif to1lpt anvs;s t2xrir no1ol n fci (fs2umx pnu0opt  oeiasla em(mo;(0tetomo iatop  an s;s srxmir io1opeemieta()s2rr(mono0tltnifetldfm raums;t0 eenir totopt  uvs;() exrxo no4ale  fvi sf 2urump;o0teeniociad sDrm(ms;(4 ltnxf oytomDe i o ()sruoiopiy4lm nmictls  2rm(mo;o0texomictatla elnvo (0 rtrirciydlp e nes;s) 2xr(m iu4ol n icsatfsrumxmooo1aexnmieilt s eluvp;(4 rerifciatfp eai o ()srtoxm no4al nlictasf Dumu p;u0tetn f3iasls2ul(mp u4tleomf ta1lp rluvsl(0 2xm(r oy1optelneilsfa2raxr no4ape miciyslsDulnmsn(0texnxfcoytlmte ies;t0sexmxo3iudal nmfciat sDtaxm oo4ole iiciyslm ul( o t0 etrmociodomDr ueo;()tetr(o oo4op   ncils a2tr(r ;t4tlenmoctytfa um( s;t0 lxnir3iy1oa  aivo t  ruoirpnu1llen ivtlsfs2rau  nu0oetniieils m emnvo u4tetoxf iodfm rauvsls srxo(m iy4lptemncsa(f Dtm(rp;u1ope  icils mDemn o;(0altnif3iatoa r uvo;(0trto(opou1omte nvta() 2taum ;t4optnif3iadla2eluvpnu)aetrio3tatlptrlu il(0trtr(mpnydlp  mfeils  rta(r ou0oexo f3tas aDeanvo;u0 exnmf3oa1fm raueilt)t2xo(m3nudol emnes tf 2ur(r no0tpt mi3iadfs emums;(4trtoirctydlateluei;s0t2tr(o3ou4alenmics ()aDraum nu0olx io3tadlm2rmn p u4 lxrmoctodoa r ivi;s0s2urxrpno4al nlnct (  rta(mp;u1tlxnifcilsls2elnmo;u4arxrmrciotfat auei;s)s2xoxm no1lmeelfvsl(  2tr(ro;t0oleo oeiys m2ra(vonu) eenmrcoodopDrli il(0 2toim3ny1apt mics tfsDtr(mp;u4oee mo3iytls elu s t4 eerxo3iydfaDe ueo t0 rurxrpiydllte fci t) 2urxm oo1tpt ioctlsfa eln pn() exrio oy1la ranvil(0 exrim3oy4ll nmict ()aDtmur ;o1oexnifciatlsDeau s;t)trenio3tadoaDrlueo t0srxoxm ou4alenmivsatfaDrrxmont0opx mi3iadlmDraump t4arxnmf io1omtr n i;t  eto(mpiy4amenlici s)a2ta(mooo1tle  f3ias m ua( p t4 etnmfcty1lmt au s s s2xo(r nydamenmfvt sf Drax pnu0oleomoetld aDrl( pnu0tltoxocio1omD luvs s sruoxr oy4lp  mnvilt srurx  ;o4tpeniieiadfmDrlumo t)aleoifcio1om eluvol(0trur(rpoo4lptn fvtlt s2ra(r nu4apen oeiydfs ranmsnu0 ltnxfcoydoat luvolt t2uoirpno1om e fci (f Dtm(r ;u0aet  fetadfmDua(mo;u4tlerioctytopt aueo (0truoxr no1lpe  nciat s2rrxm nu1tle  fetysfa2eln p u4arenxrcia1laDelnvi;(0 2xmio oo1opt  fet t)s2tru p;u4teeniiciysfsDrmnvs;u)texrxfctytfpDr uei ( t2xo(opoo1ap   fvtatfaDtmu p;u0openmiciasls2rmumo;(4alermo oa1opDe n ols) rxmxm3no4openmics s)aDrrum ;o0tpx ii3iad aDuanmont0tetrxo3tadopDrluei;s0s2xo(r3iu1ope mnctlsfa2tm(rpno0tltnifeiaslm2rmuvpn()alxrio3iadom elueo;s0s2uo(m3no1olen ieslt  rta(moou1tltnioeilsls um(vsnt0trtnmocia1fm   i slt0s2xmxm nydlm elics t)sDraxm ;o4aeen octlt mDea(monu0arxrmocoadfptr uvo s) etmiopiu1al  lici ()sDtr(r ot4apxoif3tysfmDrmnmp;(0texoxfciodfmte uei;s0s2xrxrpoudaleemfeilsfaDuaump;o1ape ii3tydfs2el(mpn()alxoxfctodlp rai o s0sexrio3iodol e fetlsfsDrrx o;t4olxoioeildlsDuluvsnu) rxrmr3oytoa e nes s0tetr(o3oodomtn neilt)srrauroou4tpxnmiciytfs el( s u0 etoxfcty1lmt ln i (0 2to(m3oudap nlfetlsfsDtmu  ;o1olx  f3iatfsDuauvs (0tlenxo tydfatrluvo (0 rxriopoy1ol elnctasf 2rax pno4texo o3ils a2emu on(0texnio tydfaDeai i;t texr(r oo4alenlnetas)aDurur ;o1oeto o3tlsfs ulumpn(4arxomoctydlptrli o;()trxo(mpno1ol e fesatfaDrmump;u0alx iiciytlmDra( p;()teerioctadoaDean i;s s2uoxopiu1optelfei s aDur(mpnu4tee moctlslm elu pnu) lenxr iytfateai o;s s2trxmpiy4lpt lnes t)aDtr(r nt4ope ifeiatfa2ra( onu0 lxoif io1optr n s;t) 2ur(opoy4altnmnct s sDurx p;o4aleomociysla2uanvo t4 rtnxo tytfpt livi;() rxr(r3nudap emiciat s2urxmpnu0tltniiciaslsDran onu4tlxrxrcoodom   i o;s)truoio iu4alt  net t) rtmxmpno1aptnio3ilsfs el(vp t4aleoiocoy1fm rlivi t setm(opoudalte icilsfaDumu  ;o0altnioetys aDuauvpn() etrxoctatoaDeln s;( setrirpiu4lpee fesa() Drmuronu4aex  oeiltlm2emnvpn(4teeoxrctodomtelu i;s t2xoimpio1llte fvilsfs2trumoou4tpxo f3iytlaDem(vp (0tltrxr3tydlm rln s t srxmim nudome  neilsf 2urum ot4oexn oeils m uauvp;t4tltrmo ty1fmDr neslt)teum(r oydal   fvs t  2rmum no0aeenmf3iytla2ra( on(0 lenxo3oydfmt lu i;()s2ur(opiu1lp   ies t  2rrur ;u4altoifciydfmDrau p u0trtomf iadfp e uvi;s0tetrxr3ou1om n fct (farrr(rp;o1opt  ieiad m ulnmon(4artnif iatlmD aiesls)texo(r3oy4ol n ivs ()srumxmoou0teeo f3ild m eaumo;u4artrxo oatlp rli i s) eum(mpiu1lp   fcsa(fs2taxr nt1olx mfetadfa emu o ()tltnio oa1fmDe ivi s t2xrxr3iudom  mfcsls)srtm(mpno4tetn i3tasfsDumn o u4arxnio ootoaD  ueols0t2tm(mpoy1alt lfetas) Duaxrp;u4olt mfciyt m2rlnmpn() rxrxf iatfptranvil()s2toxm ou1amtnmies tfs2umumonu0tltnifeiasla2ea(vo;t0tltnxf3totomDe u s;t0 eumio no1ome  ncsa(  Drmx pno0texnio3iysfa2uaumo;(4tlenxfcoydlpt auvsls s2um(o3ou4apenmfvsl(fartax o;t1oleoiocild sDrm( p;(4 renmocty1lm eln o ()t2urim ny4lptemnet s)arurxr ;o4tlxnio3iatfmDea( s;u4 ltnxf3oytfmtrlu ils  2urxopno4am e fcs () rtmumpoo0tetomieiys a ean s;t)aeeoxocoa1oatelieo s t2uoiopno1al elfeilt)srraurpoo1optnmictysfa2ua(mp;t0tltoxr3tytlp e nvsl( trxrir3iy4lltelnetas artau  ou4tpxnifetld aDrmuvp (0arxoxo ty1fat luvs ()texrimpiudapenmnesls  Dtrumonu0oee mfctatlmDeanvpn(4arenio oy1fp rliei s sexoxm nudopt  fetl(fs2tmur ;o4oleo f3tltfsDrmn pn(4 rtnmr ta1lpDran o;t0srurim3ou4am n ivtat)sDrr( pot1tpxoioctyd a ulumpn()teeomocia1fat ai s t0seumir3oodame mfesltf rraurono0aeen o3tldfs2rm( pnu0 exrmf3todfpDraueols)seuoxo3ny1amt mnvta( sDtru p;o1oexnmicild aDeanmpnu4aetnmociodla eau o;t0 2tmxopnydaptnlictat)arraxm nu4tpe mfciytlm el(vs;(0tetoio ty1oa rau sl()t2uoxo iu4ap emfetlt artrumo;o0ape  i3tyt s2rau p;(4alxnxr oytlaD  ues t) eumxr nu1op emneil()srtax ono0tlto f3tls a uanmonu)altrir3tadopt lueo (  eto(m3no1opee fetat) 2ururoou0ale ioctydfa2rl( snt4 etrio iytomt aies (0 rxr(mpou4alt  fetl()srtm(mp;o1tpeomo3ils mDua( p;(4artoxo tydlmDrli il( t2to(r iudamte icias arrr(mo;o0altnio3iyslaDulu pn(4tetrifcoa1fp  anvs s) 2urxm3iy4apeelfctatfaDtrum nu1openmf3iltla2eau sn(4tlxnmrcta1fp  lies t teurio3nu4alenlfvtatfs2rr(moou4altnmiciysla2rlnvo;()trxrioctodoptrluvo;t0sexr(o oydolt miei (fs2rrur ;u1tex  fetld a2uln p (4tleomf tatomDrlueilt0 2umxo3iudlm   neslt)aDumx poo1oleniieiltfa2umuvsnu)aexnxr3ootopt  nvi s) rtmir oy1lle  ictl(fa2uru oot0tlenmfeildls eaumo;u0trermocoo1laDeauvi t  rto(r iu4lltnlfet t)a2ur(rpno0tlx  oeiyt m2rmnmonu4 rxrmocty1fm e ieo s0t2xoxm iodamtn fvsl()aDtmxrp;t1tlxn i3iys m rmn s;u0arxnio3iodoaDeaues;() 2xrxm io1om emici ()arumur ou0oexo i3ilsfm uanmsnu)tleoxo3io1oateai o;(0 exr(m3nydal elfcs s)srtaxm ou4alxnmictadlm el(mo t0alxnmf ia1fate u s t teto(o3oo1amtelnvsasf Dum(mp;o4aleo f3ildfsDuanmonu4 lerir iytfmDrai ol() 2xoxrpno4opteliei ( sDrmu  nt0olt ioeiaslmDemnvonu)artriociydlaDr n o;t0t2xrxm3iu1am nmfcsas sDta(rpnu1altnmieiasfsDem(mo (0arxoxocoatoaDeau o;()srtmio3iudlptnlnvsas)s2urxr ;t1apenmoctatfs umuvs u0tltrmr oo1oa  aivils  2xo(o iy4lme lictl(fs2rmxm ;o4tptn octatla elu sn(0tltrmo io1lp rli s;t0srxmxr3oodap  lfctl(fs2rr(  ;o4opxomf3tydlm2ua(mo;t)artomrcta1fpt au s;t)t2ur(opiy1amt liesa(  Dumx  ;t4aetnmoeiys a2emumo;t4arermocoatoa eau sl(0trxoxm3ou4oltelncsat) rraxmp;o0tet  ietydfm2emn o t0aeenif3oydfatr n o;() 2xoxr3iydamtemictas s2rr( p;o4tlenii3ilt aDua(vo (4 rerxf iotomt lnvsls0 etrio3nu4lmeelnci t  rtru  ot4alt mocilsls uaump u) lxnxfciatlmD  n s ( tetmim iodapenmncsatf Drrump;o4ape  oetld aDra(mp;t0 rtnio tydoptrau ilt s2ur(m iy1am emfei ( sDtm( onu1alxoifciysfs2ea(vp t)arerif to1lm elu o () rumxr no1lm eliet sf Dra(mpno0aptoioeilsfa2emu s (4tetoif3oodlaDraivo;t srumiopiudlmtn fvtatf rurx pnu0oltnifeiys m um(ms;(0aetrir ia1fp eaieslt srxo(m nodamenlieilt sruaumpoo4tlen octldls2um(ms u0tetnif3iydlmDe nvsl(  rur(m3nydope micsltfs2urumo;u1tptnmo3iatlsDuau on(0 eeoxr3totlaD aivilt setr(o no1op   ictls) Draur ;o0olxoifeilt a2ulumpn() lxrif oy1la elieolt) rumio iy1om nmncs t) Dur(mp;t4tex  fciydfs2ua( sn(0aetrmfctytoateaivol()truoxopny4alt licsltfs2tmuro;u4oet  f3iltla2rmnvo;()trxnio tadop  lieol() exmxm oo4omtn fvt t s2ur(r ;o0tee  fetydlaDuaums;() rtomo iodomtr ues;t)seurxo3iu4opee nesa()sDrrurp;o4oetnmoeiatls rl(mo;t) exrircoatfp   uvsls  eumio no1lp  lfctltfsDua( pou4alx if3iatfa2um( o;u4 rtomf io1fatr n il() exr(opno1apte icslt sDtmuront1alenii3iasla2umumsnu)aexrirctytlpt livils0 2xr(o3no4lmee nctat a2um(m ;o4tpxnioeild mDrmums t4 ltomo3iodfmt aneo;s t2xoiopno1lpt mfet s)sruaxrpnt1oet  ictlt s2rlumsnt)tltoifcoatfpD li o (0s2trxr nu1lm elnei t)s2tm(  ;o0olx ifeilsfs elu s t0artoxo3oodfa  livo ( trtoxr iu1apte ivia(fsDtr(r ;u4oleo fetasfs2el(vs t)aleomfciotfp   ieo t0 2tmxm nydopenliesat arumx  oo1oetomoetytlmDumu onu4 etnmf3iytlatelivi;t0 rxrir3io4omt  fctatfaDumur ;o0opeomfeiadfm2eaumpnt0trtnif3iodoaD  ieilt0setr(m3oodlpt  fci tf 2ur(m oo1apt micils mDrmn o u4tltnmo tytfat lnvil( srur(m3oudlpe livtasfaruaurp;o4tptoioeiatla2ulu o u) eermo oo1fmDr uei t) 2xmxm nodapeelivt tf ruaumonu1opxoiicilt a2uan ont0arenxo3oo1opD livo s0 exo(mpiydll emnei t a2ua(mooo1tlenioeiyslm2eaums;(4 etoio3iodlp  lnei t s2ur(mpoo4lpenmfei () Duau pnu0tetomoctlsfs eanmpn()tltnxociotoaDrai ilt0t2toio oo1olee icil()sDumumpot4ope ifctatlm2ua( on()aeenxrciodomD  ivolt0 2xrxmpnydomeemics (fs2um(mo;t0tpe  fctasfa rl(vp;u4trxoxrcio1omDrlu ilt) 2trxopoudomtn fvt (fsDtr(r ;u4opx mfcild a umumon()arxoio3oodfp  lnes s  rxr(opio4lmtelicil(  Duauronu4tlxnmieild aDulnvsnt)teermocoydfaD  ueo;(0s2toiopiy4lmtelnctlsfsrtr(rpot4tpx mfciysfs emnvsnt0tltnircoadfm  auvils  rum(m3no4ll nlfeta(fs2tmum ou4aetn i3tysls2um(mpnt4teerxo3tadlptr i olt  euoxo iodlltnlivtas)artrxmoot4olxoifciyslaDea(vsnt) renxr oadlptr iei s)srxm(rpnu1ol e fciat)aDrrxrpoo1oeeniieilsfs umnvp u0altrif oodlmDelnes;s)texm(rpoodlle mfcil( srur(m ;o0apxomf3ilt a2em( s (0tlxomr3iadfa e ivil()texmxr ou4olee ivtlsfsrrrxr ;o0ope ii3tldlaDem(vo;()alxrmr oatlm e ueo ()texm(r3ny1oltemfvi t  Dtrxrp;t1apt mfetytlmDum(vs (4aexnxrcoadomtelnvo t sexm(r3ou1lp nmieta(farrmx  oo1tlenifetaslm emuvsn(4arxoifctatfat an i;t0 2tm(o oy1om elici t a2tau pno0ape ifctytls rln s;(0arxrif3iodfmDrauvol(0t2xo(mpoydame lfcs tf Dua( ono4aetnifeiysfmDrluvo u)tltrxocoodfmt luvi s texrxr iu1ol  mfet ()a2ururo;t0tpenmi3iys m2ea( p;t4 ltnif tatoa e i s;t) eurxrpno1lmtemnvslsf rrrx pou0tptn octat a2uan pnu0 ltoioctadlp rlnvo;t0srurxmpou1lmtnmictasf Duax  ;o1tlx mictltlaDrl( ont4aetnxo io1optrlneolt0 eum(rpiu1al emiviltfaDra(mpoo4tlto i3iydls2eaumsnt) ltnxr iotfa r i o s0 2xoio iu4lpte nes t)a2urx ono0oeenioetytlm2ra( p t4treoiocty1oaDeaues;s0t2uo(m ny1aleemncslt s2rmx onu4aex mfeiasls2emumo (0trtnxfciodoatelnesls0teuo(m3oydlm nlfvs s a2ra(m nt1teto o3tas sDem(vs;(4tltomo tatlateai o (  2xo(opnu4lp nmnctl() 2umuro;u0aexomictasfm2rauvo;() lenxo tatlmteluvsls) 2xmxopny4ome  ieils a2tr(  no1optoii3iad sDuanvs;u0arxoio3iatlmDr ivols0seurxo oo4llee ncils  2rmum ou1olx  ieiydfa2el( on()altoxo3tatoa rlieo;(0setrxo3oo1llenlneil(f 2ra( o;o1optnioctadlsDel(msn(4alxomf3iodlm r nvol(  2xm(o ny4lmee icil(faDuaxrp;u1alenmfctadfs2rlnmo;t0tltnir oadom eaies s0t2xrio iu1lltnlivs ()srraurpno0tltniicilsfs rm( sn()trxrio3oytla rlivo t0trtmxo no4lme lictlt)aDumxrp;t4tltn ietytlm2ul( p;() eermociadfate u o;()texrimpoo4oltn ivtasfaDrr(root4oleo ieils a rl(vs () rtrxr oodlmDr nvs;(0 2xm(m3ny1am  micsatf 2raurono4tet ioetldfmDumnvo;u4aetnmo3io1lp  auei t t2toxopny4amee fvsl()sDrruronu1aeeo feildfs emn on(4tlenif3iatfmD  u o;t texm(o iy4omee nvtlsf rtrur ou0oeto ictysfa2el(vs;u) rtnif3totoptrlues;t srxoio3no4oltnlnesls)srtmxro;o0tltnio3iatfa2rmnvont)aexnxocoytoaDr uei ( s2to(m3oydame micsl(  2ururpoo4aex  i3ias aDeauvpn(0 lxomfcoatomD liei;s0seumxo3oo4opte ieils  Dtrxmo;
\ No newline at end of file
@@ -0,0 +1 @@
+n s ()setoxm3nodope lncil(f Dur( oot0texomietad m elnvonu)alxrmo3iotla r nesl(0 exmimpnydal nmivsat a2rmurpou1tlen o3ildfs ranvs (0arxrmo iotfmteai olt)sexm(r nudomtn nes ()aDrrxr ;t4aee ii3iysfm2rl(vo t)arerxrcoo1omDe iesl(0srumir nydomtn net sfarrmx  no4tpxomfciys a2ua( pn()tltnxfcoadla  aneo s0 2umio3oy1alen nvt sfartrx ont1aet if3iysla2rlump u0artomfcoa1lm eli i;t0trto(rpiy1al e nvsl(  Dumuro;u0oeeoio3iadla2elnvp ()trerir ootfmte n s t0trtm(r nu1lm nmivi s) rum(m no0aptnmfeildlaDean o t0aetrmr3oa1lpD  ies t  rtm(mpiudol nlfvias artru p;u1aleoioctatlaDul( p u0 reoxrctotlatr uvolt0 2trio oodap nmnvtatf rur( o;o0aeeo ociydfa2emn s;u0tetnmo3todlpteluvi;t t2urir3ou1ol elici (fa2taxmpno0texoiieiltls rmn on(0teeoir iydfp  anvols0 rxr(opno1amen nci (  2tr(rpno0ope mociytlaDrl( o;t)teerxr tatoatrlu s;s) rtoxm no1om   ncia()aruaxm nu1tee mfetasla ran p;u0trxoxocoytopteaivo s0texrxmpoo1amenmnvsl() 2rrxm no4oex mo3ildfm2rm( snu4arxrmo3io1laDeluvil(0 rtrimpoydlle mfcilt) Drr(r ot0open fetat s elnmp ()alxnifcia1fpDr ivo;t s2urir iy4apeelnetlt)s2um(r nt0oexn oetlsls2rlnmp;u0 exnmf iytfp  lueo;( t2umxm3oydap  mivtas sDrax oou0opt  f3tltfsDeauvs t0 etnmfcoodla eaies s)srtrxr3ny1lmee nvtl(fs2rru ooo1olxomo3tydfs2rlnvsn(4 lxoio io1oate iei () etrio no4lleemnes t srumxrooo1tpt  iciytfaDua(msnt4tlxoxociytoaDelieol( sexmxr3oo4lptelnvtas arrrx  ;t0tlto octlslaDea( o;t0tlxoir3io1omtr i i s0 euoio3iodlm n fcilt)s2rmx pnu1open i3tls s umnvs;u) lenir ootop eln i (  etoio no4ope lfvil() Dtmum no4oet ii3tlsls2ra(mpnu)trxrmo3ia1latrai o;s sexr(m3oydom   fei t) 2uaur ;u0aetnmociadfsDul( o;t0 lxrmfctydoatelu o;(0 rtrir3io4olte nes s arua( onu0optoioctlt s rlnvp t0 exnxr oodlaDrlnvo t0trumxr3ny1amtelfeslt  2umum ou1optomf3tltlaDeln o;()aleoircia1faDran i;s0 2tm(r ou1omtnlfcils)arumur ;t1aptniieiyslm eln s;t4 rxrxrciodfpt aivslt0 exrir3nu1omenmnci tf Drruronu1altomo3tysfs2eln sn(0arermfciy1omt livilt0teur(o3ny4opeelfct sfaDua(mp;o1ale moeild sDra(vs;t)aleoxrciotfa eanvs ( s2urio3iu1lpt  net s) 2ur(mpot1olt iiciltfs rmn p;u4 eenmfctydoa ean s;t)sexoxopiudllt  feia()artmumo;t0aet  ieiydlm2em( snu4 leoxfciotopDelu o;s seum(rpnodoptemfeias)s2tmxr ;o0altomf3tydfs2elnvo t0alxoxf3to1fpD  ivo;s) etrxm iy4am n fviatfaDraxmpnt4ape miciyd s uanmsnt4 lxrmf tatlmDran o;()texoxm io1amt  fviatfa2tru  nu1aetnmfeilt s2ulnmpnt)alenmrcoydoaDrlnes t)texrir nu1aptnlnvs s) 2rr(r nt1oexoiiciyd a elnvpnt0alxrircoodlpD ln ilt0t2tm(m ny4ap n fvs ( a2uaxm ;o4tlxnmoetltfsDranmo u4tetrif tadlaDr neil( trtm(opoy4ope lfei t sDur(mooo4ale  iciyt s2em(ms u)tlxrmocootlat luvol(0 rtrir oudaltn fctl(f rtaxm ot0olxomieiytlaDemn s u0tltnir3ta1fmDe ieol(0 2umxo3nu4lmt lict t)sDur(mont4oltomo3iltla rl( snt4tetnxo3iytom  aneols  rtr(mpiu4lpenmfcsas) 2uau p;u1texnmictasfsDrlu p u) etniocoatlaDe uvilt t2xm(r iy1opt lfei t) Drmx p;t4altnioeilt s rauvo;t0aeermr3oo1oaDr nvo;t) 2tmxr oy4am elnct (farrru oot0optoifciys mDean s u)altrxr3todfm eau o;t  rxmim oudap n nvils) rtrxrp;o1optnmoctydfm elnmp;(4trtnmf iatlmtrlu s t trumir3iy1ap nmfesat) 2tr(rp;t1apxn fetldls rluvont0trxrmrciatfpDelu i;(0s2umir3oo4llt lnetas srtruronu1oltomo3iysfaDea( pnu)aeenio3iatfaDrauvi;t sexo(o nodomen fvtl()sDra(m nu0tlenmieils aDrl(mp;t4arenir3oadlat aiei s0s2xrxr ny1ap emfesat)sDrax  ;u0opx mfeiatla2eln p (4 lerir todfaDrai ils s2xr(mpoudaptnlfcil(  rraumpnt4tpxnmi3iadfs ea( s t) etnxf3ootopDe nes (0 2ur(r3oo4ap e iesa(f 2tmxmpnu0altn oeiltlmDulnvpnu4aexrio3ty1op r u s;( t2xm(o3iudole mieslsf Drr(r nt1aleomfctas aDem(vp;t4 etnmo3oy1fptraivo;s teumir3iydol  lics sf Dtaumo;u4opxnif3iyd sDuaump u)tltoiociotom e n s;s)sexm(opoydopee icils sDumx pnu0optomietys s em( snt)tetrxfcoydfm  lneol( t2urxo oo4lpt micslt) ruau ono4oexnmfctldls emu p t0 lxrir3to1laD aies s texo(r nu1am  lfvi t s2ta( oot1olt  f3tatla rl( p t)trtrxo3oatoa r n s ( s2trim3iu1lmt mfeta(faDrau o;t1altn ociysfs2rm(vp (0aeerio iydla  livi;t)s2uo(r nodom n ies t)sDraum oo4aleo o3iytfmDulu on(0trxrxf tydfa r ivo ( s2ur(r oudale  ncs sfa2rmumoot1aexnmfcildlsDeanvp;t0tleoif3iydopDr uvi;s seto(opiydapte ncsl(fa2ta(m ot1tet io3tadlmDea(vont0 rxrxf3iodla r ieo ( srtr(m no1al  mnet ( a2tmur ot0oet  o3tytfsDumu p;u) rxoif3ty1lmD li i t srxm(m3nydlm  mfcsat) 2tr(r oo1aexnio3tls sDrl(monu0tlxnirciadfmtelueol(0sruoiopiudopte ict t artrumpou4tlen i3iysfa2ulnmo t0altrxf3iadfpt  u o t0 2xo(rpnydlm nlfvt (fs2rr(  oo4alenioeild m2emnvp;t0trxnxr3io1opDe n sls trtoirpiydlltelnes s s2ua(rp;o0tptomiciatfs elums;() rtrxo iotlpDr ieo ( setrxopiudaptemfeil( sDtaumpoo0altoif3tasfs2rmumo u)trxnxo3iodoaDeaieilt0teurio ny1alenlfvtl( sDtaumpot4apx iicilsla rm( p;u0tetnio iodlaD ln o (0srxo(r iu4aptn ivi t a2trxrpot0tpt moeiaslaDemnvp;t)trenxrciydfpteln o s)t2toxopoo1al  livtl( aDur(ro;u1texnif3iasls ulnmo u4arenxf3totoatr nvs ( srumxrpnydlm nmfvsl() rtmumpnu0tltomi3tydla2rlu snu)aexnio totom e n o t)sexm(m3ny1lm e ncsat)srtmurono1alt  feiys mDemnmp;u4alerxfcoytoa   n s;s)truo(m oydapeemfctlt)sDrau  nu4aetomi3iltfs em(vo t) ltnio3oytomDraies (0teumir nodlp  lnvtat)aDrrurp;o1tlt  ieiad sDem(vpn(4 eenmo3ta1fp rlueilt0trxrxm3iy1openlici ( sDur(mpoo4ole ioctlt sDum(mpnt4aeeoif3oadlp r i s;( srum(rpoy4ol  licils aDtruront4tpe miciysfs ulu p;t) lxnmrciadopDelivo () rurxopnu1alenlneia()srta(  nu1ape  ietytlsDel(vonu0 exrmf totom r u ols0srxoxm3nu1lpe lfct t  2umur ;u0tptoiociltlm2rau ont)teenmocoytoaDeluvsl( s2xm(r ny1ll emneta(fsDra( pou4tlx if3tld sDran snu0 etoxf3iy1lmteli s s)t2xmxmpoy4lmen ici (f rrr(root1aeenifetad sDrl(vo;u4 etrxociy1fmDe iei s setrxopoydale  fvia() 2ua(m ou4tle ifeiysls2um( p;t4aeeoxr todoateli s;t)setoimpiudlpt lnetls s2umxm ou4olenioctld aDra( pnt) leoirciodfaD lneo;()s2xoim3oy1lp emnesat  2ua(m oo4tlenmiciadla2rl(mo t) lerxo3iatfaDrln o s0trto(r no4alt livsltf Durx pou4tle  oeiatfmDum(vsn()aexnmfcio1fmtelnvo ( srtmir oudam n nvi tf Dtmxro;u4aetoioctysfsDrm(mo;u0aetnmr3iodfm   neo t0srtrio3nu1al n ieil(faDum( o;u4tlxo oeiltfsDrm( o;(4arermo oytlpDraiei;( s2umio ny1ll   fct sfa2um(m oo1tex  fcilsls2um( on()alerircoo1oatr neol( srxm(o iu1ol  livtlsfarrru ooo4aleomf3tadfs rmnvs t4texrmf3oa1lat ln sl()sexmxmpiodaleemfvs s) 2tax p;o1oet  oetad a2ra(vs;() etoxr3iodlm  aies s)t2tmim iy1ll nlieta( sDrr(  no1tlx moctadla2raumonu4alermfciadop raivolt0 2xr(rpnodal  mnciat srrmumont4altn f3tasla2ranmo () ltrmo tatfmt  u s;t0teum(opno1lp e feslt)arumur no1aleoioeiadlsDul(vs;t4tetomrcto1fmDelneolt0 2toir oo1lme  fvsls  ruaxm ;u1ope iictadla2eanvo ()tlxnxr3iatfatr u i (  rxo(r iu1openmietas  Dum(  ot0apxo icildfsDea(vp t4trtoxfcootlmD lnvs;t)setmim3nu1ol n nvsltfaruaurpoo0apt  ocilslmDum(msn(4 rxrmf todlmDrli i;s) 2to(r3nodop nmnetasf 2um(rpno1tet  f3tld s uau sn() etomr3ootlpDranesl()tetrxo iy4amenmncs sf rtr( onu4oltoio3tltls2ul( sn(4treoifciadlm rlieslt)setoxm3ou4ll   fvtlsfaDtrxr nu4olx ifeiadlaDem(msnt4aexnir oy1omDr u s t  2uoir oy1op emncilt) Dumuront1opxomociysls2ua( o;()aetomocoodlmt  n i (  exo(m3oy4apt mnciatf rur(roou4tltnmietadfm2el(mpnu0 rxrxfciotoatr uvilt  exo(r oy1ol nlncil(farua(  no0oetoifcilslmDumu s;()tltoio3iydfmteluvslt)trtrim nu4opeemietlsfsrum( ono0apxn ieiltls el(ms t4 ltoifcootomt aivo;(0 etoimpny1ale mfvs s)aDur(rpou1tlenmoctad s2uaumpnu0aexriocto1op e i o;(0sexrxm oodal n ici tf Drrumont0olxnif3iltfa uau on(4 rxoxrciadfaDrli o;( trtmxopoo4olt lieta()aDtaxr oo1ole  i3tasfaDea(vpnu0trenir io1omtrluesl() 2tm(o iu4omte icia(fs2tr(mp;u1oexomo3tlsfa em(mo;t4aetrxrcoydlatraueol( s2xoir3nudllen ivtasfsrrr( pnt0apeomfetytlsDumnvo;t4aeenxocto1laDe uvi;() rtm(opiu1lltelivsltfsDtaxrpou0tpt  i3iltlsDuanmsnu4texrio3iy1opDe nei () ruo(o3oo1ol  miciat srrru o;u4apt iiciyt s2emu s;t0aetnmfcoytlm rai i () etoxopou1alt mfesltfs2rmxroot1opeoio3tasfm2ua( sn()altrmf3oydlp e u ils trxrxmpiydal   nvsa(f Dtr( onu0teenii3iysfa2rmnmsnt4altrio oytlmDranvi;() eur(o ny1apenmictl() rta(mo;u1tpto f3iat aDrau ont0trtnircta1la rlu il(0srumiopoudop elivta()sDua(mpno0olxn fetydlsDumums t4trxnmfcootom r uvo;(0s2xrio3oudal nlnct t srrmxrpot0tltoioeiysfa2emu snt) rtnir3totlm   uvs t0 2xoxm iy1apenmieil( sDtrxmp;o4opeomfeiatfs ra( pnu4arxrmo oytoaD lnvi;t)sexrimpio1aptnlfci ()aDuaur ;o0teeo octldfsDra(ms;()arxrmf3oa1lateln ilt  etrxo3ou1ope mfvslsfa2tax p;o0aleoiicildla emu o (0 etrmrcia1fp e uei;s0 rurxrpoo1ll elncsa(fsrurur ou1tee iictlsfm2um( snu0 reniocty1op   n i;t)s2urio ou4omte icils)sruau  no0tlx  feilsfm2rmnms;()trxrio3ty1omteanvo;s0 ruoirpiy4omee feia()artmu ont4ape mo3ildls2eauvp t) exrifcoy1oa  ai s;t) etoio nu1alee net s a2trx o;t0opxnmoctasla2ranvonu4trenxo3totfmteluvs (0seto(o3ny4lmtnlfeiatfarrm(  ot4apxoiieilt s2ran s;t0trxomr3oodlpt ln s s) rxmimpio1ope mneslsfsrum(r no1alxo feiytfs2umnmont) exrxf oadfm r uei;t) exoxm iy1lltnlnet sfaruaumono0tlxnmf3ild a um( p;t)trtnmr3ootom e uvo s0sexmim nudape lncs s)sDta(root0tpxniocilslm2elnvont0 rxnio todom rau s;s0 2uo(r3io1am nlfctltfa2ta( pno1aeenioeiyd aDrl(vp t)altrio tytla  lu ils0texoxo3no4opt  icsl()sDraxmpno1tltn fctltfs2um( snt) rxnmo io1fpt  ieol()sruoxo nydol nlivi s s2taxr ot1texo fciat m2ra(mon(0 ltnir3io1fpD au ol() 2ur(r io4ame livtlt  Dtrxrp;u1tlxo fcilsfa ra(vo u0aexrxociy1op  luvo;() etriopnudal nmnct (f rrr(ront1ope  fcias a2ua(mp;() lxnifcoadoate ivo;t)s2uo(m3io1op elics (  rrrurpnt0oeto oeilslaDra(mp (0 leoxfcoydlmtr u o;() 2xr(r ny4om nlfvt s)s2umur ;u0tltn iciasfa2ea(vpnu0aetomo oo1fmt aneols)trxoir3oudolt  ivs t) Durumpnt4oex mf3iadla ranmo t0altoxf iadomteluvo t  ruoir iy1llt mnvsa( a2tmx p;u4tleoif3iysfmDemuvp t)tlxoxocoo1fa e neo;t  2toxr3io4aptelictatf rur(mpnt1olx mfeiyd mDum(mp;(4 exrmfcto1fmt lnes;t srxrxopnudoltemncta(f Dtm(mo;o4aex io3iltfaDelums (4arxoxo3iydoa eluvols0seumir3ou1omtn ivs s) ruaumpnt1oetn fciytlmDrau o;t0aeerio3iadoaDr uvi t0srxmxmpiy4ame  nct s  Dtmur ot0apxomo3tls s ra(mon(0 lxrir oodfmtrlnvs ()t2toxo3io4apee icta(  Dtmumo;t0apx if3ild m2umumo (0trxoxocoy1oaDe nei;t trurxo ny1amt lfvi () 2tax pot1aexomietytfa2eau p (0 lermr oy1lpDr ieil(0sexoxm3iy4lme liciat) Dur(mp;t1opt iietyt s2ulu s (0teeoxf iatoaDeai ilt)t2xo(opnodol   fcs t arurur nu1oee mf3iadla2ul( s;t) etrmr3iy1fpD lneils0 rtoiopiydapee net ( sDtauro;u0tpe mociadfs uau snu4 eermo3tadfm rli i;t) rxm(m3oodomenmnvtas) Dtru ono1altomoctlslm em( o (4 ltoxfcty1oaDraues;() rxmxr3oy4lpenlies () rta(  ;o1oee  ocilsfs ulumpn(0 rtrir3todlmteanvo;s)srum(m nudaptemnvsltfaDtrxr ;u0tpt mfeild m eau o u4tlxrxfciadomDe ues;t) exrxmpnydolenmfes t)s2rmxmooo1ape  oeias m rmn p u4 eenifciotomt  uvo s)s2umim ou4alenmnctlsfartaxrooo4tleo oeiyt m2ra(mo u)alxomfctotfpDrlivo s)sexoxmpio4lpe miei (  Drrx  ot1tlxnmf3iadlmDuaumont0trxnmf oy1fmDrlu i t)s2umxr oy1opt mfcsas sDra( o;t0tlxoifeildfm rauvs;u4texrif oydfp e n o t0s2tm(mpou1lmeelfvi t) Dtaumpou1tpeomicilsfs2umnvo;t) rtrmr3io1la eli o (  euo(m iodam nmfcils sDumxr nt0olx ii3iadla umnmp;()trtrio3tydlpt  ivsl()s2umxr3oydol  mnetl(f Dtaxr ot1apxoio3tlsfa2eluvp u) leomr totfaD lieol( t2urxrpnu4oltnlnct sfaDtr(m ;t4ale  icias a2uln s;u0teerio3ta1optraueo;t0trtrir ou1lleelfetas)aDurxront0ole ii3iyd mDemu o t)aleomo3oodfm rli s t  2uoxm oo4lm nlivt s s2trx oou4optomf3iyd m rmnmont0 rxoxf ta1fa r ues;t)trxr(mpnu4lmtnmnciatfaDuau pot0teeo oeildlmDulu p t4 lenxr oodoa eluvil() exoimpou1al elfci sfartrxmpno0olxnmoeiytfm ua(vs u0artrmo to1oateluvi s0 rtr(rpoudlp nlfeils) rtaxmp;t4ole  i3iytfa elnms;() etomf iadfpteluvs () 2xoxr3iy4om nmfciltfs2raxr no4tee mi3tld aDulnvs;t0tltoir3oo1fatean slt0srtoirpio4oleelfes s  Dtaumpnt0tpenifeilsls2eluvs t4 renxfcoy1fm r iei ( sexmirpoy4oleemnvtas sDraxr nu0aet  i3ilt m2ua(vpn()arxnif3iydomDr uvo;t0 2urio iudlmtnlncta(fsrtrurono1opxo i3tls m2rlnmp u4 eermfciydfpD aneols)t2toim3io4altelncs t  Dumu p;u0opxnmiciltlsDum( o u4aexoio3ootom r n ils) 2xrxrpno1lm  licsltfarrmum nt4oetnmiciydfa2em(msn()tlerir3oytopteaivo;t sexo(r3iodoptnlneta( sDum(rp;u4oex io3tadlmDulu s u4tltomr totlmDran o;t seumxo iydop  lfct ( a2trumoou1opxn i3iasfsDrmnvs;(0aexrio tadomDeauvi;s srtrir3oo1am   ictat  ruax  nu0aeeoiietat s2eauvs;(0 exrircto1la  lneils) rtrim3io1lpeemnei tfa2rrum oo0opto iciydlm2eanvsn(0trxoiocoatop rlneo t  2uoxrpoodapt miviltfsDumur ;o4tlt mfeiasfa2um(mo (0texoxf3iatop  au o t0seumio3oodape  fcsl(f Duru poo4tpt mi3tltls uanvp;(0tltnmo3oydlpte ieilt0 rum(r3iudam elnet s)srtm(mp;t1tltoio3iydfmDuluvs;t0arxrxr iytoa   nvols srxmio3iu4ome miesat) Dumu o;u4tpe ifeiad m2ul(mp;u)arxrmfcoydoptelivo;(0srtr(r iu1am  mfcs s)a2trxrp;t1aptn fctls sDean p;u0 renir3ty1la   n slt  rtmxmpou1amtnmfet (farrm(r no4ole  oeiasfa elu p ()aexnif3oy1lpDrlnvo t0 etr(rpio1oltelfei t  Drau poo0oeenmociasfsDul(mo t4teerifctodoate neo (0srtoxr3ny1llt mnvs t s2umxrooo4openmf3ildfs ea( pnu4teenmf todoate u ols srxrim3oodlptnmiei sfsrrmx pnt4aex  oeiltfm emu o t)arxoif oytfaD  nvo s  etrxr oo1lmt  fvt t)srrr( ono1tpto ieilsfs2emu o;(0alerioctadlmt au slt srur(r3nydamtn ncs t aDur( p;o4ape  ictls m2rlnmpn(4 lerio iotla ran slt0teuo(opoo4oleelfetat)aruaxrpno1tltoii3iytlaDrmn p u) reoio3oa1fmDelnei;t0srxm(o3oy1opeemfeta(f rtmx  ot1opt iictyslsDrmu pnt)arerio3tadfp r iei;s t2xm(rpnu1amt  nvils)s2ur(mpou4olxomietasfa2rmn p t4 lermo3ty1om  ai sls)t2xmxrpoodomee fviltf rrru ont0alx  ietyd aDua(mp t) lermr3tydfmt  iei;s s2trio io1olee neiltfs2uau  ot0opt mo3iltlaDua(vp () renmr iytfatraneo;s seum(rpoodlptnlict (fartr(ro;u1tet  iciadfa ul(msnt) eenio3oodlp e ivo;s0seum(r nu1om n netat)sDuaumoot0apxoio3ild a2rlu s u4tlxrio oodom   ivslt t2xrim3oo4lptn ietltfsrra(rp;u0oet moctat m elu o t)arenio totoate ies t0trurim no1alenliesat)aDumxrpnu0tex iociysla2eln p ()tlxrxfciatopteaiei;( seurio iydopen iei s) rrmumoou1aptn f3ildfaDua(vp;(4 renir3iydla e ivils) rurxm3oy4lm  lfctas srra(rpnt4aexo octas mDuanvont)tlxomr3oydlatr nvsl() eur(mpou4lleelivi tf 2rmx  ot0oeenmfetls sDemu pnu0artrir3iytlmtr u ols)t2uoxo oo4ome lnvil( srtm(mont0aee mfcild m eanms;u4tleoif tytfp  livi ()trxmxr iu4omt mfvtlt)srtmuroou4open octysfmDua(vo (4texrmfctytfmDeanvols)trto(mpny4llt  fesas  rurump;t0texnif3tldfs2rlnmpnu4tlenxr3ty1oa eanvi s)trur(o3oy4omtn ics t aDurx poo0oeeoiiciysfa rmums t4 lerxo tatfpDeluvs;s)tetr(r3oudlmenlicsltfs2rrurpot1ape  icilsfa elu o;t0arxomrciatom   ieo;s trtr(rpnu4al e netlsf Drrur ou0opxo oeiasfaDemuvon()areomf iatlm e i sls)teurir ny4altnlnetas a2ra( pnt4aleniieiadfm2uaumpnt)altnir3ta1fmD anvil( sexm(opoy1al n ivias)sDrmxro;o4apx ioetytla ranvpnu0aetoxoctodop e ivo () etriopiudlpen nvs s a2urxmo;o0apenmi3iyd m2ranmsnt)aetomf ootfa rlnvi ()tetmxm iu1llenmnetlt s2rrxroou0tleoiiciatla2ea(vp t0trtomf ty1faDelu i t t2xmxo nu1optelnvt ( a2rmump;t4apt ifctyt m2rm( o;(0 eerxo totoa elues;s srxrxmpiydol e neiat  2uaumono1aee iociat a emn o;t4trxnir3oydlpDranvils t2tmxo3ou4lmt mnci t) rrrurpoo1alxnifeiad m2ranvp t0tltomocta1lp e nvi;t tetr(mpiu1lltnlivs tfa2uax o;u1oeenmietls s rl( snt)teermr ta1oatr neolt0trxoxm3no1llt  ivs s srrm(m oo1tpxnmociasfmDel( s t4tetnir3ia1fateln ils  etrio3no4lp nmieiasfaDtrxrooo4aeeoiieildfs2eln s;(0 rxnxr oy1lm  auvsl(0t2xmio3oy1lpte fetlt)sDua(mp;t0alto oeiyd m2ua( p;u)treoio oytfmteau ols0srurxmpno1amee ietatfsDua(  ;t0alenmieiatla2emnmp (4trxrxo tytoatran o;(  2xrxrpoydapee fcsasfsrumxr ;t0ape ii3ildlaDul(vsnu4treoxfctatomDraieolt0texo(m3iydal  lieiat  2umxmpot1tltoifcias a2uln p u4tleoio iydfmt lnvs;t t2toxr3oydole  ies s)artmxmp;o0tlenmicilsfs2emnms ()tetnxf3ty1lp e u o;t0texmxm3ny1ome mnct tf 2raxrp;o0aptoii3iaslm2ra(vo;(4trtniocootfmDr nvo;s0srtm(r iudamte nvsls)arua(mont4ale ii3iys m rlnvo (0 eermo oadfp  anvo;t srxo(m no1ap n nct ( a2tm(ro;u1opx  i3ilt a2ea(mp t4aetrmf tadfpt lneolt0 exo(rpiu1omen fvta( arum(mpoo4tpxniiciysfsDrl(ms;t) rxnmr3to1omD  nvi;t0s2trim3io4llee ivias aDtm(  ;u0olen i3tls s eau snt) exoir iy1lp elivi (  rxmxo3iydom emfvsls  rraum oo0apx mf3iytla umumon(4 eerio todom ran o;s)trurxrpnu1amenliciltf 2trxm ot4aexoii3tatfa ranvpnu0aeeomoctydopDrau sls) eurxm3ny1omenlies (farra(rp;u0aee  ociytfa ra( p;u0trenmf tadfm rln i;(0 rumxopoy4op n neta( aDtaum ;t4aexnmi3tys a rmuvp;t4areomo oa1lmtelnvs () eur(r3io1am emiesl() rum(mp;o4oee  ieildla rmuvonu4 leoxo oatfa  li ilt)truo(mpoy1alte ivsls  2ua(  ;o0opx io3tltls ranmp;u0altrxf oatfmDr ivil( trtm(r nydlmtnlnetasf rrrxr ;o4olxn ieils a2em( s t4tleomr3oodfat livsls) 2xm(m3iydal n nci sfsDumx  no4tpxo i3tytla2eln o;(4trxrxr oydfmDeai s;s setmio iy1omt  fcsltf 2rm(mp;t1oee iietyt mDul( p (4arxrxo oadlpte n slt  rum(rpiy4al  lfvsl( s2trur ;u1aee mf3tytfaDelu ont4tlxriocty1oaD  i s;(  eur(rpnu4lp  mfetls) Drr(rpnt0texn fcilsfm2um(mo t4trxomf tadoa e i ols teuo(mpno4omtnmnvi (  2tax  ;u1oeenmociasfsDea( o;(0 rermr3iotfpDrai ilt) rurir ny4lmee nvtasfaDuaumpoo0tltoioetls a2ul(mp;()aexnmocto1om  ai s;()s2xm(o iu4alen iciat a2taum oo1tlenmoeiytlaDulnmo t)aexnio3tadfaDe uvs ()s2tm(m3no4al n ies t arrrurooo4optnmf3iyt a ra(monu) lenmfciydoateai sl(0srxmxo3oudape  neta(farrmur ;o4olxoio3iys m2ul(ms;u)aetrif tadomt  ivi;s trtrxopno4lpe lfvil(  Dumxroot0teenifcilsfsDuaumont0 eeomr3iy1fp ranei;s0trxrir iu4am   fcsatf rtr(ro;u4tlt mfctydfa2rmnmsnu0 rtnmf tatfp  ln ol(  rtrimpoodllte ncia()a2rm(  ot1tpxn iciasfa ea(mp;(0texoif3ia1opD  i s t)srxoxo3iydame micsas)sDrmuronu4oexo fetld s ul( o t0trxrxociodfmDeai ols0t2trim nodlmte ivi (  2trxro;o0oeenmfeildfm emu o t)texrmocty1lm elies ( tetr(opou1omen neiatf 2rrx p;u0tlto fetydls2emnvo;t)treomo3ia1fa rluei;t0 rtrio3nu1ame lneta() Drmxmp;o4tpe  fetlt m2umuvo;u0 lxoxr iotom e i ol(0t2toim oy4omenmivtas) rumxm oo0aee moctatls2em(vs u0tlermf3to1oaDrlivo;s sexoxr3io4lp  mnvs sf Dta( pot4oee ifcilsfa2um( pnu0tetrxr ia1optranes;t)t2uoxrpiydom nlfvtatfarua(moot4ale mfciydfa2ua(mont0 lxrxo3tytlmDraiesls) 2trxrpoodol nlfct s arrrxr no4aetnmfciadls2ean p;u0tlenxr3to1opDranei;t0 rtrxmpoo1ol nmnvsa()sDuru  nt1tlx micildfm ra( s ()teerir oy1fa r nesls0 rto(r3oy1lp nmivslt sDumu pnt1tpx iociytlm umums;u) eerxr3oy1oa rlnvs;s0tetmxrpiu4ale lnesas)aDuaurpno4tltnifcildfs2ul( p t4 lenxo3tytla  aies;t srxmxmpoo4op nlnvtas)s2rr(mont1ole ifetytlaDeanmpn(4 ltnmr ootoa e ivils)teumxmpiy1lmt miciatfsDuaxmoou4openioeiltfmDul( o t4 etomrctotom eaivi (0 exmir iu1apeemncs t a2rr(moot0teeomfeildlm umn s t4 exomfciodlmD aueo ( trur(m3ou1alen icil()sDraxmonu4texomo3tlsla ulnvp;t4 rtnmo oodfpt aneol(0 2uoimpnodolen ivi tfaDrm(r ;o4apto i3iatls2umnvsnt0trtoxf oo1fp e uvi t  eumxrpnu1amtemnvilsf rua(r ;o1teen feias a2ulu o;(4 ltnmrciotfaD luvo;( s2tmxrpiodole livtat  rum(rpno4tlx  ieildlm2el(vs;t4tltrxo3tadla r ivs;t0tetmimpoo1amtelictltfsDua(  nt4oetnmieiad m um(msnu)aleomo3tytop  aues s)s2toio3oodlp e fvtat aDtmu  ;o1teenif3tatla rl(vpnu4arxnir ty1lmtrauesls srurir oo1optnlfci t  2umxmp;t0aleo fetatlm uanvp u)aetrir to1omt livs ()tetm(r3no1lpeelieia(fsDuaurpou0opxo oeiatla2umnvo;(0 ltoxfctadomDeauvil() rto(mpiydlpeelnvsl()artr(moou1aptn oeiad s rmu s (4arermrctatlp e ivolt0texoimpou1llt mivtltf Drruro;u1aexo fcild s umnmo ()aexomf3ootla elivo;s0trtr(opoodoltnmfctltfsDra( ooo4teenio3tyslm2umnvpn() rtnxr3iotfmt anvs;t)texm(opiu1al emfvsasf Drmu  ;u0opxoiocias s2elnvs (0arxnxociytoateluvs (  rtoxmpou4lm n ictatfs2urumpou4aet  ieiytlm2ranmp;u)tlxoxo oa1lm r uvi;( srtm(o3ou1ol nlfvslt)sDraum no4teto f3tyt mDumnvo;()tlxrmf iotlpDrauvo t sexmir3ny1ap nmiviltfa2rmxmpnu0oetnifciadls2ulnms (0aexrxrctotlmtelieils)trur(o3nydoptelivslt sDur(mpno1oltoifctydfm ea(mp t0alxoxr tadopD  nes t  2xmim oy1ll  lnet s s2taurp;t0tpxo ietytfs2ea(vonu0 lxnif oadoa e u s t s2xm(r nudlmeelfct (fsDtr( p;t0alenmoctld a elu s;t0 etnio oa1fmtr n ilt) 2umxopou1amtnlnvs s a2umu o;o1tpt ifciatfa2rmump u0tleoxfcty1oaDraiei;() 2tmxm3iy4apee net ()a2raxrpno0oex mfeiaslaDrmnvsn(4 lenxfcty1fp eaivo;t)t2tmir nudlpee ivt (fsrum(r ;t1aetnio3tys m el(mo;()tltnmr iodlat aneolt)s2xmirpnydopt  fcta() rtaxmpno0aexoifciadlmDua(vs;u4teeoxo iatoaDrlu slt0 2umxr ny4llt lfcs sfa2tau o;t1tex if3iat m ul(vp u)treoxfcia1lptr uvi;s  rum(r3oy1lp  miet t) Dumx ooo0opx ifctydls2rauvp () rtoio3iadoate uvo;s) rumir iudom emiciat) Dururo;u0aeenmfctad a rln o;u0arxoif iodla eanvo;()seumio no1omtnlncslt)aDtr(m ;t1olxoioctldfm ua(mp u4tlxnioctydoat au o () eumiopiy1amtemivt s  rrru p;t0optn f3ilt mDranmo;u4 ltomfcoy1oa  lnesl( s2xo(mpiodlleelfvils aDta( pot0oee iietytfaDrau snu) eerioctotfpD  neilt texr(o3nodape  nvslt  rtrurono0tex moetyd m2emu p;() reoio tytlmD auei;t)s2uo(r nudlm e ictl()arra(r ou4tetoioeilsls2rm( s;t0teenxocootlaD lnes s) etr(opio4amtelnvslsf Durxmooo4opeoifeildfs2elu ont0 rtrxf3oadom ean i t)s2trxr oydlmt  ncslsf 2ur(m ou0oexo oetytlm2um(vs t4 rxnifctodoat aueil()sruoim3nydomt livta(  ruru p;o4openmiciasls2el(vp t) eerifctydoa eai o t)t2tmxm nu4amtnlnciat)s2urx pot4oetnioeiyd s ean s;() exnio3tadlptr ivo;t)s2trio nudlpee ietlt sruru oou4apxnmoctld sDuan p u4trenmr ty1op r n ilt0texoxm3nudolte ivsls  Dra(m ;o1tlx moeiyt sDul(mo (0tlxoxr3iotfmDelu o t0 2xmiopou1lle lncs sf 2trum no1oeeomf3iydlaDem(vs u4 reoircto1fmD  nvi;t0srto(o iy4optelncs t) rrrump;u0tpxniietldfs emu p;(0trtomo ootfaDr neo s  2trxmpio1omt lneil(f Dua(mont1olt  oeiltls2rmnmsnt0 exrmf io1oa elivi;s0setmim nodomeelncslt)arrmx  ot0olen icias a em(vp (0 exnxf3iydfpDr nvslt)srxm(opoodlmtelnct s  Dtrxmoou4tee ifciltfm rmuvp;u4aexnmo3ta1faDean sl(  etoxr nu1amee ivtl()sDtru p;o0tptnifctas sDrl(msnt)tetrmo tatop r ies;s setmim3io4amtnlieilt srumuroou4altomi3tytlaDrmu s u4arerir totopDranvi t s2trxm iu4lp emfct tfarrrx pnu4tpenmfcilt sDelnmp;t) lxnmrctytomteanes t t2uoxrpiy1ll n iei t)aDtr(  nu1aeenmo3ildfs rluvs t) lxoxo iy1fptelies;s)trtoxo3ny1oltelfes (fs2ur(r no0open fciasfa emnmp t4tlxriociydopt  u o (0 rurim no1ol  lies (fs2taxmp;u1tlxniieild mDrmu s;u0aetnmr tadfpt  ivil(0trtmxr3oo1lm  mfcils s2rm(  oo0apxoifciaslmDrmu on(4 rxnio3tatom rlnei s t2uoxr iu4amtelfvt (f Dtrx p;o4tlt ifcildfaDuau pn(0treoircoa1lmDean i t)texo(o no4lpenmnesa(  Drr( o;o1teenmociydfm rm( s (4 exnircoytfm  ai slt0 rtm(rpiy4lmeemivtat s2ua( ooo0olxo ieiytls2elump;t)aeenmf3iadfmDe n olt)trxo(rpoodomenlfvtl(fs2ta( oou0tee ii3iltfs2uanvp;(0altnmr tydoaDrlu s;(  rxoim nydaleelics ( sDrmxrp;o4oleomfeiltlm2umnvsnt4artomf3ootfpDr i sl(  2uoxm3ou4op   nei ( a2rmxmpou4olx  ociatlsDrlnms (4tltnmr3ia1faDeaues (0sexoiopiy1oltelnet sfsrtmxrp;t1tlxn o3ils mDrmump ()arxrmrcoa1fpD  iesl(  eto(mpiy4oltnlictltfa2rr( pot0oleo fetydla2emn pnu)teenmf3iytfat an i () eurxo3ny4openmfetl()a2umx pnu0apto fctld a rau s;(0 lxnmoctatfat aueo s)t2toimpou4altelies s)aDrax o;u4tpxnmfeilsfm2emnvont)tlenif oa1fm e ieo () 2trio3iydll nlfctas  Drm(m ou4tlenioctls aDeln pn(4arxrmfcoodfpt luvils  rur(o ou1ale mnctas)srrm(mo;o1opto f3tls a2eluvs;t0tetrircto1lmtelnvilt0 2xmxr3no1olt  iesltfs2rau  ;o4oeen f3iys a2ranvs t0aetrir3tadopDean o s0 rum(rpnodlpt mics ( s2ra( ont1teen f3iatfa2uau s;u0 rxnio3oadlatranvs (0sruo(rpio1ope lnetl( aDrru oou1aeenifeiasfm2ulums u0alxomfctatfpteau o;t) etrim3oy1optnmfvsa()a2umxrp;o0olx iocildla rmu snu0texnmf oadoaD au o;t0 rxoir3no4olt mnvi s) rtr(mooo0oexnifeiydfm2uluvp (4arxrifciydfaDr i sl() rxm(o nodap emfvs t a2rrxm ot1oeen ictatfaDea(vpn(4trerxf ia1omDelu o s s2uoim3iy1lm  miei s) 2taxrpoo1aexomi3ias m2rlu pnt0tlxrxocoo1faD aueo;s)t2xr(m3ou1am  mfes sfaDrru ont1optnifetldlm2rl(vont4texnxfciotlp  lnvolt) etmxrpoydllee iciasf 2urum nu1apx mi3ildlsDra(vs;u)tltrxr3tydlmDelivols) rtr(r nu4op e nvs s)aDua(root4optoif3tadla um( pnu4arerio tydfm rli olt0teumxopiu4amenlnvta(f Durur ;t0tee iieiytlm em(ms u0 lxnxocia1optrluesl(0sexoxr no1lp nlncslsfarumx o;o1oee miciys m emnvon(4 reomo iydlmte i s s seur(mpiy1am  lncil() Dumu  nu1aexomiciydfs2rmumsnu)arxrircia1omteanvo s tetrio oydamtelnvt (faDuax  ;o0tle ii3tydlm em(vs;t)aeeoxo iytfaD  nvo t0 ruo(o3iodllt  neta(fa2taur ;o4aleo ietadfaDrln o u) lxrir3oydlmDelieil(  2xm(mpiy4lm emictatfarum( o;o1alxomoctaslmDua( o;t4arenxocto1fpDe ues s)texo(m3no4apenmfesl() ruaum ot0aeeoioetltlm emnvpnu4aexnir ootoaDr n o;s) 2xmxr3oydole  feil()artmumont4tee miciyt sDrauvs t)alenio3oadlpt  uvslt srurir oo1ol e feia( sDrm( o;u4ape ioeiyslmDumu s;(4texriociadfptran olt)srtmimpiy4ll elnvs t) 2rrx  oo4aptoio3iys sDemu o t4 ltrxf to1late nes ()t2tmxrpoodopt mfetat srrruroou1tltnif3ias sDea(vsnt4arermfcoadomDrlnvs s0 euoxm nudlptelivil(f rra(  ;o1oet mf3iad mDuauvs;t0trxnxf oatfmt auei s t2ur(o3nu1lme  iesl( s2urx pot1olxn f3ilsfa em(vs;u)alxoir3tadopt  ivo;s)t2xmxm3ny1amtnmncsatfs2trx  ;u1apt  fciyd s2rmnvo (0 eermo3to1lmDr ueils0 rxoir iu1ap elfeiat) rtm( p;u4tltomi3ils s2elu pnt)arxoio iytlpte ies;(0srurim3no4apeemnes t) Drr(mp;t0open i3iyd mDeauvon(4 rtoxo oadlaDelu o;t  rumiopou1op e fet ( srtm(r ;t1tpxnmoetytlsDua(vo t)tlxomociadlaDrlieo ( sexmxmpno4llt lnet s  rumurpno4altnmicilsfmDel(vo (4 lenmo3totlatraueilt trurxm io1lmt lies s  Dumur ou4opto ieiltlsDeau pnu4trxrxr tydfm e i olt  etr(m3nu4llte fvt ( a2tmu pnt0tpeoifetyt m2uln snt4teeomr3tytoatrlnvi;t s2uoxr iu4lm  mnvtls)s2uaxr nt4texn i3tatfsDuanmpnu0alxrxo iatfpDeau s;s seurir ou1apeelfcilt s2tmx  nt1alt mociadlm2um(vont0 exrxo3oy1optelues;t trxoxr nudam  mfvi tfsDumum ;u0olxomfetlslm rmu onu0texnxo oy1faDeanei;t) rumxr3iydlpe  netls)aDurxmont1aeeoif3ild mDulu s;u0artoxr3ia1lmDrlues;t srxoir ny4lmen neiatfaDrmumo;t1oex mfeiatls ulnmo;()artniocoodfpte n i ( texmirpno4lmeemncsas s2ur( ooo0tlx  oeildfaDuluvs t) rtoio3totlmDranvils  2xmim io4op elfesas) Drm(moou1aet mieiadls emumon()aexriocoodfm rln i t0teumir iydll e fctls s2ta(  nt1opt iictatfm rl(vsnu4alxoxocoodfp  anvi t  2uoio3iudol  mics () Dtm(moou4aee mociaslmDem(vo u4tltoxo3oo1oa r ivs t  2tr(r iy1lptelicilt)srra(rpno4apxnmi3taslsDrmnvo;t0 exrxf3totlm eln ilt  rxrir iudlme mnvtlt)s2tax onu1openifetatlaDemu o (4 rtrio oa1om   nvo;( seur(rpoodop   fcs s)aDrmumoou4ale mfetlsfs raumo;u4tetoxr iatfateln slt0s2urxo3iydam  mfciltf 2uau  nu0opeo fetld m emnvp;t4tleomo tatomD liei;() 2tr(o iy1ole mfvsas) Drruront0tetnmieiatlm em( o (0 rtnxo io1optr n o s s2xmir ou1lp e fcs tfs2tm( p;o4openmiciyt s uluvp t4artrmo iytfmDrlneo s  ruo(r iu1omee iesls  Drmump;u1tlt mi3ildfs2uluvo;(4 ltnxf iydlpt lnvs t t2xo(r oo1lm  mfcsas  Dua(rono0teeoiieilslaDemn pnu) leoxr tytfpte ies;s)s2toxopnu1llt  ncs ( a2tau p;u0opx ii3ildfs ul(vsn(0trtnmf3ta1op r uesl(0trtrxmpiodame  fvs tf 2ua(m ;o1ape ii3tadls2ranms (4 etrxf to1la elivol()s2xr(m3iydome  nctl()a2urx p;u4tptomfeilsls rau p;u0 lxnmf io1oateanvi ()srxmxo3ny1lp elies () Draumpnt4opxnifetat a2uaums t0tleomo3iytla   neo;t0 rxrimpnudoptnlfcil(  Dra( o;t4tlxn f3iatfs2uanvpnu4 rxomrcootomDe neols trurxopoo1oltn ivtl( a2ua(rpoo1aee mfeiydfa emu p;(0trtrif ootfaDrauvi;( t2tmimpiy1opt  nvslt aruru oou0oee  f3iyd aDem( s;(0altnxo3ta1lm eauesls0s2xoxr3oo4lptnmfeias  Dra(mpno1aeeoiietltfmDrl(ms t0altrxo oodlat  nvslt)sruoxo3oudam nlfet s  2ra(rpot4tlxn feias aDemuvp;t4artoio oadlmDrai olt t2umxmpiu1lp e ietas) 2rmx pnt1oltnmf3iydfmDulums u0 eermociatoa elnes ( s2uoio3io1ope mfvsa(  2uaxmoot1tlx  fetld s2uan p t4 eenxr3tadfpt lnei t)setr(m3iy1altemfvsls) 2raump;u4opxn ocild sDrmuvs;t4tltrxf3iy1fa   uei (0s2urirpnydomen feilt)sDraum nu4aeeomf3iltfa2rmn o (0texrioctatlmDelueo;t t2trirpiu4ll emnct (fsDraxmooo0oltomfciys m2uau onu4aetnxfciytomDr ieslt srxrxo3oodal nlivsl( artrxr no4aleoioeildla2ea(vp;(0trenmf iodoat  neo;( t2xmirpnydamtnmfetl()a2taxrpno1apxomoetadfm ul(vo (0 ltoio3tytla rau ils)s2xrxmpio1ol e feilsf Dtm(root1ale mo3ias m rm(vo;()arenio3ty1omtraues;(0t2xoxopnu1am  mnesa(fsrtaump;t1tlt  fetys s ulnmsn(0trtoirctytlaDeai i s)texrirpiodoltn ietlt  Dtaxroot0tpto ieiadfm2raums t) rerif3to1lat  nvs;(0 etoxopny1al emieil( sDumum ;u4oltnmo3tls s2rmnvon(0tlenmfcto1lmt lnvo;()s2xoxo3ny1al emncsa( aDum( poo4tle iieiyt aDua(mo u4tlermo totlpD lues;(0s2umir iu1llt  fvta(fsrum(m ;o0olxo ociad a em(mp u4altnircty1laD luvslt)t2xoirpny4al   feias)a2uaxm ot1aexnio3iatfs2um(vsn(4aeenxocoydfpDean i t)t2tmio3iy4lpenmfvilt srtrxrpnu0aleomiciasls2ua(vp;t0trtnxo3tydlaDran o s)texr(m iudopee icsa()s2rau  no4tle  ieiad m rlu p;t)alerio3iodomDraneol(  rtrio iodlp  mnvs t srtaum ;u1aex ii3iyt m2rauvpnt4trerxr3ootoaDraneo;t0srumirpiu4al  lneiltf rtm(m ;u1alxomociltfs2eanvp;(4trenio3oydomD ln i s) rxm(o3iy1om nlfvsa(farumuro;o4aeeo ociltfm umnvsnt)aeerir oa1fmt livi;t)teto(r nu1lpenmnetat artaum ;u0tpx mictlt m2uan o;(4 etoxf ootfa eluvo;s sexm(mpio1oltnmfciat a2tm(mo;u4aetnmoeiysfa ea(vo;t4aeeomfcoodfmt  nvol(0 etr(o oodaptemfvil( srtru  ;o0tlxnmi3tys s eln s t4artrifcia1fat lnvo;s0seuoxrpny1llt mfet (fs2ur(m ;u0altomf3tad s2rl( pnt)trenxo oo1fat anei;s)t2uoio nydlpt mivta( srurx  nt4aleoifciyt a2rm( o;u4 lxoxocio1lat lues (  exrxrpou4op   nctasfaDumumonu1alx  f3iltfs uan o t0teerxf3tytlmDranei;s  euoxm no1am emncsl(f Dtmxrpnt4aeeoif3iydla2ea(vsn(4tetnmo3oodfm rlnei;t  rxrxrpoudamtn fcsls)aDtaumpoo0oexn i3iadfsDem(vpnu4arxomo iadlptr uvsl(0texmxr no1lmen fcta(  rtrxr nt0tleomieildfa ul(vpnu4tlenmfciy1opDr nvs;t  2ur(rpiy1am emnctat)s2rrum ;o4ole ii3ilt sDraumsn(0 exnxr3tydop e ivo;(  2urxo3ny4om   ncs (  Drrumo;o0tpt ioeildfm el( o;(0tetoxr to1oa   ivols)seuoio io1ope lncias srtr(rooo4apxn fciadlsDrm(vp;u)aetnmo iytomtrluvo s t2tmxm3oo1oleemnct ()a2rmx poo1tptomfetydfmDeln s u) eerir to1fmte nvslt0 exmir3nydopt mnviasfa2trx  nt0aetomfciasfaDrau on()altnmr3tydfmDrluei ( trum(opno4lpe mfeia()srurxr nt0oexnif3iatlm2rluvo;u)trtrifcio1lmDrau ols0srtoio3oy1lmtelfvt s sDtaxrpou0alt  oetatfmDeanvsn(4aexrifcio1lm  aivi t) rtoxr ou4omtn net (  rrr(mont0apxoifciatfs eaumon(0tetomfctydlm  aiei;(0s2tm(opoydale mnvsl( sDtaxr nt1tetn ietltlmDumuvonu0 rtomrcoadfaDean i s) etoiopny4olt mncta( aDtr(ro;u0olt if3ildls uan snu0aetrir3ootoaDeln sl(  rtm(m3no4olenmnvtas arumumoou4oeeo i3iatlmDrl(monu0alenir oydomDran sls) exmxrpoy1al emfet (fa2raxmo;t4tetn oeiatfa2ean on(0texomf totfp rln ils0truoim oy4aleelfetls  rrmx p;o1opeoifctys m umnms (0 eermfcoatoatr u ol( trxrirpoudale lnei s  Durx oot1tlt iietys s2uluvsn(4areoir3oadfaDeauvs t0teuoxm3oydlme  fetl()sDta(root1tlx ii3iadla ranms u) lerxr oy1omtrau i (0 2xoimpnu1lpt  nes (fsrrruroot1aexomfeilt m2elnmonu4 rtoxr iatoat lnes;()s2xo(m3iu4om nlfvtlsfa2rrur nu0oee  o3tlsfa2elnmpnu0arerircoytfaDrau s () 2urimpno4lmtelfcslt)artax ont4altomo3ilsfm umn p;t4alermf iodoat  nei;s0srurxo ny4omeemicsa( aDtr(  oo0tetnmfeiadfs uan p;t)aetoif iatlpt  i sls0trxrim3ou4amtemivi t a2um(mo;u0alt moeild a2rmnvo (0aexnircoodoaDe n i;(  ruoxo3iu4opt  net t s2tmxmo;t1aee mf3tytlaDraumo u) exrif io1faD  uei;t0s2uoxr iudll  mnesls sDuru poo1alto f3tltlaDelnvs t4 lxnirctodfa  li i;( setmxm ou4alenlivta( artaxm oo1opxomoeiltla2ranvpn(4tlerxrctodfa e neol()s2urxopio1lpeelnvsls)srrru p;t1tpt if3tyd a ra(mpnt4trxomo iytlm e n s;() 2uoxrpnudamte ivi t) rrax  no0oleo feilsfs ulnvonu) rtnxf io1fp  aneol(  ruoxo3oodlpt micsas) 2raxr ;o4tltnio3ils m ra(vs u4trerxfctodfaD  n s s0 2uoxm3io1ll emieilsfa2ta(m ;o4oleomocild sDumnvp t0 rtrxrciatfp elueol(  ruoirpiudaptnmictat)a2trxm nt0ale ifciytls eln s t)altrxrcio1omt lu o;()t2xoxmpny1om elictlsfsDumxmpot1oee mieiltfsDumnvp t4trtomo oadfmDelivo;t s2urir iu1ome lfcil(faDuaurpno4aeeo iciyt mDulumo u)aleoio iytfatr u i t)t2uo(r3oy1lptnmiet ()a2ua(  ot0aexoioeiydfm ra(vp (4alxomocoo1fp  an i t) 2umxo3iydllen fctls arumur ;t4opeo octytfa2umnms;u4aetnxf3to1lmt  i i t s2tmxm nydlleemfviat sDuaxm ou0tlx mfctasfm ulu s;t4 eenmr3tadfmt auvil(0texoxo3oy1lpe lnvtlt sDrr(r oo0tltomi3tldla2eanmonu)trxrir tadomtr nvil(0t2xoimpnudlmtn fct t sDuaum nt4teenmi3tydlmDrlu o u)altrif3todlaD aivi;s0tetrir iodole lnvilt srtr( pot0aeeomo3iytfsDrm(msnt)teerif todlaDelnei;( teumim3iudll emfvil()a2trxr nu4tlto ietytfa eanmo u4tltniocootfmtrlu il(  ruoxrpny4al nlfvslt)a2trxr ;u0oltomo3ilsfm rluvs t)aexnxf3tydla rlu i t)t2urim io4om n ncs sfsrtrxm no1alxnifcildlm rmnmp t0 rxnxf oytla  lnvsls0texmio iydlltnlicsatfa2trum no4oet  oeiydlm umn snt0arxomo ty1laDelu s t0 2tmiopnydolee ivi () Drmx pot4ole mfctydfs2em(vs;u0trtrir tadfat li o t s2toxm ou4opt micta()artmurpou0ope iieilt s rl(mp;t)treoiociotoa  an i;s)setmim no4omen nei t sDrau pnu0aetniiciatfa umuvp u0 ltomocta1lpDrli o t)srxm(o oudomen nvsa()a2ta(  ou4oltn ieilsla ra(mo;t) lxnmr ta1lateli i t)srurxr no1ole mieta( arurxro;u1altoioetadfsDrl(mo ()areoio oatoat li i;(0s2xoxr3ou4opt  ivt (  2tau ooo1oeenifcildlm2rluvo t) exrmr3oadlptrli s () rxrxr3ou1lptnlneia( srtaxrp;o1oexomoetytfa2rlnvs;u0trtnmr3iotomte iei;() 2urir oo1olt  nvt tfaDra( ont0teeoio3iyslmDraumsnt4altrxf to1lateaieils srtm(m3iu1optnmfcta(f 2ua(rono1tetoiieilt s uln pnu4treoxo iydopDeauvs;( s2xmirpno4lm e fvils  rrrxrpnt0oeeoiieiasfa2ra( p t)alxnir iodfpteau sls0 eumimpoo4lp nlics s)a2rr( p;u0teenifeils m ra( pnt4tltnxrctotoa e n s;s)texmim3iydom  mivil(f 2um(rpno1tlxomoctat a emnmo t)tetnio3oo1fa   nes;s0sexr(r3iy1am e ncsl(  Dra(  oo4aetoifctad mDranmo;t) lenxf3iy1fptran s;() ruoxo no1opee ietatfs2rm(r ;o4aexniieiadla2ean pnt0 exrio3tytlptrli s t seurio oudomeemfcta(farumur ou4aeto f3iatls2ran o t4 eerxf iadfptr nvo t0trxrim nydll  lfetls s2trur ;u4oeto feiytlsDraumo t0aetnif ty1lmtelnei;s) 2xrio3nudaltn nctat) Duaxr ;u0opeo iciadls2emnmp ()tetnmf3iytop  auvslt) etr(rpoodopt  ictls)aDurumpno0tltn fcildfsDul(vp t0 rxnir iodlaDeln i () etrio iudopeelict ( srrr(r ;o4oleoiociadfaDelu snu)aeerio ootlpte nvs;s  etoim oo1optn nvi tfarumxm no4tlxo feilsla raums;(0altnxrctatfmtr ueslt0s2urxopny4lm n nvt (f ruaumono0teeo i3iydfm eln s;t4 rxrxf3totfpDeauvslt  rtm(m3nu4op n ies ( arrrx oot0ape mietaslm2ua(vs;u)aexomf ootlp  li ils)teumxrpiydal   nvt t srtmxmoou1oltomi3tydlmDua( o;u) ltnxf3oytfpDeaueolt s2tm(r ou4amen net ()a2raur ou0alxnmf3iltfaDel(mp t4aetoif3ia1fmD  i o () euo(m no4lm emfvtas)s2rruroot0tpt mociysfm2rauvpnu)artoir3iytomt auvo;() etoirpno1lme lfvtltfa2taurooo0tpt mf3iltfsDrlnvsnu) eerircoodlaDrluvsl(0 2trxo oodlptnlnetatf rtrur oo0aet mieilt a2umumon(4 lxrxocia1op eai s;s0 rtm(mpny4lle mnetl(  Drrxro;u0tlxnmfctlslaDrlnms;() renif3ta1fp rai o;t trxo(o nudamen fcsl( a2tmx pno0ale  ociydlsDrl(vs (4 exomrcta1oa r i il( srxrxopoo4lm e ics sfsrtr(moot4alxn fciad sDuauvpn(4 rxrxr ootlatrlueo;s  2tmio ny1ol  mnesa(fs2tm( oot4tpen i3iydfa ulnvp;()altrif3tadlmt aivs t) 2to(r oo4apt  ncta(  rrrx ono0texn f3ilsfsDemn s;(4aexnir3tadfmt au s;() 2urxopnydalenmivs (faruru  ;o4tlxnii3ildfaDrlump;u0 lenmocta1om  livo;() rtoxr3oudapenlfct t sDum( oou1ope mfctatfa rl(vo u4 rxnifctodfpDrauvilt0t2tmxr3oy4aptnmiviat sDrau pot4oex iiciys m ul(ms;t0 eenifcoytomDranvi;t)sexoirpoy4am emiesatf rta(  nt1alt miciydlmDeaump;t0artrxociy1lateau olt)srtmxo3no1lltn ivt sfa2uaxmo;t1tlenmociad s2ranmo t0 lenxocoydoa  ai i t  2urxopiu1omenmivt t)sDrmxmpot1optomfciadfaDuan p;(4altrmo3oadomteln sls0 rxo(rpiy1apte fes sfaDtr(  no4optnmfeiytfsDumuvs;t0 leomr3tydoaDelies;s  etriopoudom emnesat) Dur(ro;t4tleoif3iltfs rl(vsnt0altoir3ty1op eanes s0seumxr iu4lmenmfetl(fa2um(roou4olx  oeiydlaDrl(vs u0 etrifciatfatr neo;s s2urxr nudopenlfet ( a2ua(moou1aexnioctatla rmu o t) lxomf tatoaDeanvi s0t2urim3iu4ll  mnetas  Draxro;u1opxo ieiyd aDemumonu4tltrxf3oa1fa   nvs;t)srtr(m no4lme  fvs sfsDur(rp;t0alxnmi3ildfs2uaumon(0 reoio3iatomD  uvi;t0 exoio3io4al emivi s)a2tm(ro;u4oeto f3ilt s2em( s;u0tlenxr3oy1fa raneols0trxrio oo4olt livs tfaDua(mpot4tlxo icilt a2umu p;(4altnxr3iadla elivo ( srtmim nu1ome  fei s) Drr(rpou0alto ieiatlaDul(vp t)tetnxr3ia1lptr ueslt0 rtmir no4ll e ici () Durur ;o1openii3tls a eluvonu) etnio3iatlp   nes s0 2trio3iydam   fctas  rraxmpnt4oetnmf3tadla rlu o u0tlermr iatfpD  nvo;t seurim3oydlm  lict (  2umurono4tpe iietyd sDrl( p;t4 lxoio3to1lp eanvils0s2toxopny4olenlivt tfa2ur(m ;u4tpen ieiltlsDuanvp;t0 renxr ootfpDeaivo;( seurxr oydap  mfcslt sDumx oot1ape mi3iad a2em(ms;(0altnmr ty1oaDr ieo;t) euoir iodlpe  ncsasf Dta(  no1tpenmfciad a2elu p;t0alxrir3oatom eanvo s s2umimpoo4openlivtat aDtmum ;t4tptomietltlsDemn o;(0artrxo3oy1opDe n ils srtmxr oodlptnmfcsltfsDtaxmo;o0apx miciasfm ea(ms (4aetnxf3oa1fpD aueo (0trurir3ou4ope lnctlt  rtau  nu0oetnmfetydlaDrau o u4artrmrciotfaDe iesl(0trur(r3nudaptn ncia()arum(rp;o4oetomieiad sDemnvo;u)arxoif3ootop e nesl(0tetmxr oodop  mfcia()sDtrx pno0opx mfcilt sDuanmp;u0 reniociy1fptrlivs t)trxrir3ou1altnlncilt) Dumx pou1openifciyslsDuauvp;u) rermfciy1latrlnvsls0t2umio3io1lpt livi ()srurur no0tpt  iciaslaDrl(vo u)aeerxo3tytlaD lnvolt  ruo(opnu1lpt mnvtl()sDurxmpno4olxn oeiydfs2rmnvp t)altrxfctydom r ivi;t srtoxr nu4alt  fvslt)a2ta(rooo0oltnmi3tys s2emn o;u0tleoif iydfm eaueilt texmio3oo1apt mnvtls)s2tm( oou4opx ioetldfs2elnmpn() exnmf ty1fpteaivs s)setrxo3nydom n iet s srua(m nu4oleoii3tlslm um( on(4 exnxo oadlatraivs s0trurio io4alenmneta(faDrrxr oo1apxnmoeild s um(mo t) ltomfcio1lp rai o t  rxoxr io4ale mivt sf rta(r ;t1alto fctlt aDrluvo;t4 eermfctodfpD  u i t  2xrxm iydop nmies (f 2taxrp;o1apxomieiytfa2elnmon(0 renmrctodfp  luvols0setmimpoydal  lfcsl() 2tmxrpnt0tpe  f3ils s2um( pnt4alenmf3iodlmtelnvs;(0 rxm(opiu4omenmivtasf 2raumpot4olx mietls s uan o t)texnircoadfp  luei;t trtr(mpiudaltnlncia( aDtr(mpno0tlx mf3iadfa em(ms t4aeerxo ty1lptranvo s) 2xrxopou1om elfvi ( s2rru p;u4oetniocils sDeaums t0aetrxr oytfpDran slt) 2to(r no1omtelnetlsfarra(r oo1opxoif3iaslaDum(ms (4trtnif3iytfmD  neils0srurxr3oy1llt mncils) 2rm( o;u0tlxniieiaslaDulu pnt)texrir3iytlaDeli ol() rxrio ny4opte fcs (  2rauroot0tpx ifciys s2umump;(4 exnxfcoytopte n ils  2uoxopio1lm   fesls) 2urxrpou1tet ioetld a elumo;t0tlenio io1op rai o s) 2umxm ou4apee nvi sf rrrx  ot4aet  o3tlt s2emn s u0 lxoio iytlaD  nvs;()s2xrir3oydalee ivilt srur( pnt1alt if3tls aDulnvp;()aleoifcoytlaDrln o () rxmxopoy4op nmnet s)artr( pou0tlx ii3iyd a2ea(vont0 ltnmr tadomDr ues (  rtrir3iy1am  miet t srtmu oou4alxo ociytlmDel( p;t) lxrirciadfaD  ies t) 2uoirpoo1optemfciasf rtmxr nt0optnioetyt mDrl(mp u)trxoifciodlpDrauvo;s0t2umxm ou4ap n nciatfs2ra(m nu4optnioetls m2elu s (0 lxoifctytomD lnvi;t) 2um(m no1opt  nes s) rrmx poo4tlxoifeilt aDuauvpn() lxrir iodop ranes;s  rtr(o nu1apteliet t)aruau onu0olxo fcils s2ra( p ()treomrciytoptrlivo;( s2urimpny1lltemfci s)s2ra( o;u1oetnmfeiaslaDrlu on(4teenmf tatlaDr nes ()sexmxr iy4oleemnct s artmumpou1tpe  oetytlsDean ont0arenxo iotfmteai ols)srur(m3ou4am  mneslt)arra(rpou4tetomictlslm emumo;t0alerir to1laD anvilt)t2xo(m iodopte fcils)sDraxmpoo1tleo f3iasfsDrm( s t0 eerxo iydfat luvo ( t2urxm3nu1lm  mfcs t artaumont4ole ioetyslaDemu s u) ltrmrctodfateaivs s)setm(rpio4op  mnvtls)aDtaumoot1opxo o3iat a ua(vo () reoiociotfatrlu ils sexrio3iu1opeemfet s)aDumur oo4aeeoifetatlm2rauvo;t0 ltnmo iodopDr uesls)trurxm no4op n fetl() Dtaurp;u4tptomfetasfs2ulu s ()teenxocootlptrai sls seumiopou1omenlicta()sDtaxrpno4tlxoii3tltlaDumnvsnt4alenir io1lpDrlieo t0 etm(r3oodlpen fesls) Dtmumo;o0optnii3iad m2elnmp () lxnif todlm rauvo;( t2xoxm3nodlptn icia(fa2ua(rpoo1alxnif3iytlmDelu sn(0aetnir oatop eli s ()tetoim3io1lm nlict sfsDrauroou1tpxniiciytfa2uauvp;(0 lenmfcoadomD an o;s0 2uoir ny1olenlfvtl()aDtr(ronu0oet  ociysfa elnms t)altrmocio1latrlivils sruo(r iudomenmfeiat aDumxm ;t1tpt io3tldfsDul(vo t)alxoio3oatoa rln o ()teurxopiudop nliet t)aDuru pno1tpe ifeiasls umnmo (4 lermf3tadfpD auvi s) 2xrio nu4lmtelnvi s sDtrumpou1aexn oeiyd s rlnmp;(4alxnio todoaD lu il(0s2tm(o iy4omenmieias)artmxmpoo4tlx ioeilsfa2em(monu0alermocto1fm rau s;s)t2xmir no1ol elfet t aruax  ;t4olen ieiatfsDum(vsn(0tltnxf3ty1opD lu slt  ruoir nu4ll emicilsfsrur(rpno4oetn fetld sDemnvpnt)arenxrciydfm rln i ( teuoxm3oy4ape licils artruro;o1opt  ocildfm ra(vsnt4 lxrxf3iatom   ueo;t t2tm(m iu1am   nct s s2taxmpot1tex miciaslaDra(vpn(4altoxr3oydfp rlnvslt) rxmim nydlm  mnesls)sDtmxmp;t0apx mf3tysfa ranmont)altoif iotfp e n i s0tetrim3iy4oltn nvi sfa2ur(r oo1aetn fciytfa rmnmp;t0texoir3tadoptr n o ( t2xoxo iudoptn nvs tf 2rmuroou1tex iiciydlm eanmsn(4tetnxf oydfm eau s;( s2urxmpnudlm   fes (f Dua(r ;t1oetn i3tlsla2ra(mp;t) ltomfctatoateai i t0s2to(m no1lleelfviltfaDtau ont0teeoiieiydlm2rmnvs (0 ltrmfcootfa  ai o;t  etm(m3ou1oltelieslt)a2urumpou4ope  i3iltlaDrm(msnu4alenmoctatoa eai s;()t2ur(r nu4alt  ieiltfsrrmurpou1apxn o3iyt sDelu pn()aeeomo to1omt au ils  etm(m oodamtnmfcsas aruauro;u0apenioeildfa2el(vonu) rtoir oatla  lu ol(  rto(m oo1ap   fcs t)srra(m nt1texnmo3tysfa2ul(mo (0tetrxf oy1lmt aneils0t2xmir3ou4amtemnetlt)sDrmxronu0oltoioeildfaDea(mp (0trtoio ta1laD livo;t) etrxo3oy1ap   iesat) 2ur(mp;u0oexoifeils s2elnvp u0 reniocoatopD  uvsl(0t2xrxm3oo1apen ncsa(fs2tm(m no1tptoiietytla2rl(vpnt0altoxf3oydfaDe i s;t)s2urimpnodalen fcs sfaDtr( ooo0tltnmoeild sDra( p;u4aetomrctytlpD  i i;t)seur(o iy1om elfet (  Draur nu4opeoiietat sDuauvo t4altnxfctytlpDelnvs;()s2ur(opiy4ap nlfet t) Dua(mo;t0tle mo3tat mDrmumpn(0arxnxf oodlpte ieo t srtmxmpiu1optnlnci ( s2trum ;o1tlxn octlslmDumn s (4tlxrio iadomtrlu i;t)trum(opoo1ap elnvtls)aDurxrpnt0oetoifeiydla2um( p;(4texrmfcoodfatr uvi;t seumir3nodllenmnvia(  2raxmpoo4apeo feilt s2uauvpnt)aetnmr iodlateli i;s) euoxrpou4lp nlfvil( srtru o;t1tee mfcias aDumn p (0 lxnir totlmtraneols0trxmxr3oy4ol e nei s arumxmo;o1oetnmf3iadls ulnmo u4treniocia1laDeai ilt srxoxmpou1ale mnctatf rur(m ou4optnmi3tasfaDel(vp;()alenxo3tytfpDe u s s)t2xmxo3nydlp  mfvia( srtaumoou0tle ioeiaslaDrln s (0alerxf3oytoateaueo s0trtmim oudlmtn icilt)s2um( pnt1altomo3iatlmDrm(mp;u)altnmo iodlaD lnvi t0 rur(r3no1op   ivias)aDrrumooo0teeoifetlt s rmums t0teenirciy1lpDr n i ()trur(r3iodlpt  nvsls  2rm( onu1aptnmocildfa2el( pnt0tlenio iydfa   nvo;()seumxo3nu1am   ivslt aDur(mont4aeto octat s2ul( s (0 rtoifcootfm eaneo t0 2xo(o3ny1om  lnetl(faDtm(  ou0apenioetyslmDrmnmp t0aeenio todop ean o;s)seur(r ny1amt  icil( srtau p;u4texo oeilt sDumnvont)treomr iotfpD auei;s)seuo(o3no1lptelivtls) Dtmu  ou1tlx ifetytfs eaumont4tlxoxo iotopDr ieils  etr(rpnu4lmtemfctl(fsrtrumpot0tpeoifciytlm2ea(vs;u4 ltnxr iatoat aueo;(0setrim oo1lle lnvia( s2taurp;o4alt  o3tatfa2em(vo;t4tltrxoctytlmtelieslt)trtr(r3nudlmtnmies t  rurx o;t1tptn i3iatfm rm(vsnu0aeenxoctydfpD li s;(0 2tr(m iy1amt lfeias aDra(rpnu1tpxn i3iasfm2ul(von(0 ltrxo oytlm  lueil(0 2xoio iudaltemnvilsfaDtaumpnt0aet ifeiltlm el(mp;t) ltnxr iadoa e uvi () exr(opiydap emiesl()artr(ro;t0tptnifciat s elu sn(4aetoiociytlaDraivo s srxmxm nudaleelnvtlt) rumx  ;u0olt if3iydlaDelu snt4trtoxr3io1fmt  nvi;( s2tmxm io4alt mfvi s a2ur(mono0oet if3ils a emnmp () eerxf3ia1oaDraivi t0 eurir io1ape lfciat)sDurxronu4oexnmfciys m2ea(ms (0alxnifciodfa  lnes;( setr(m iu1lle  ncslt a2tru ono0olxn o3ilsfa uln snt0 rtnxr3iy1fmteluvsls0t2xmxmpoy1aptn fvslt arumxro;u0alxo oeiasls2ulnvon(4 rerxrciadfp rlu ilt trtmxmpnodam n ivtas)s2urxm oo1olxomi3iltfs rmuvs u0aexnif oo1opDe i sl()s2triopio1ll emncils)sDumx p;o1olxomf3tatfsDra( p;(0aeerircoytlaDraues;t trtoxopoy1lltnmfei ()sDurxmp;t4apt mf3tysls el(ms;(4teeoifctodom eln o;s s2tm(r3iudlltnmiesl()artau  no1oexo o3iytfmDra(vp;() ltoifctatlptrlnvi;() rtrir3nudale  fctas)srum(rp;u0tlx ii3tad a eluvonu0 rxomr3ootomDrli i;s  2toxo3oy4om  mnetlt s2um(ro;t4optoifeiltla2rmnvp;(0arxoir3oydoa  au i;t)trurim io1opte ietlsfaDurxmp;o1ole  i3iadfmDrau pn(4teenmrcoatlp  lu s (0 ruo(m3iodlpt lfcia( aDrmxmo;t1alxomfeiat sDelnvpn(0 exnmr oy1lptelnvils0 eumxopnudapt mnvt tf 2ra(rpoo1aetnifciys m2rlu p;t)tltnirctodfmDeliei;t0texrxrpiu1lp elfct s s2rrx pnt4opxnmo3tyslaDuauvp t)aeenmf3oodopt  uvslt)s2umxr3ou1llee fvtl()a2raxm ;o0aetomieiat a2ea( o (4 lenxr3to1opDelueslt) etrim3io1opt lfctat a2umu  ;o0olxomo3iyt sDrauvs t4tetrxf iatlateaneolt  2to(rpio1lltemfeils)arrmxrp;o4altnioeildla ulu snt4 exoifcoatfaD lnvs s0 eumxm nodol elictl(  2tax  nu1oleomf3iydla rmuvsnt0 rtnxr oy1om eanei;t0srtr(mpiudomenmnctlsfsDururo;u0tle mfctad a emu s;u) eenxf3to1oat  ieo;s)s2tmxo3ou1oltnlfvsa()sDtmxm oo1tpenif3tadls2eluvo (0trtrmo todlpt aues;s) euoxo3nydom   ncs sfsDrrurooo1oexnmoctyt a umnvont4 ltoxf3oytlat au s t s2trxm3ny4lmen neils  Dum(m ot4alt  ietaslmDua( ont0teeomfcoodlmtrauvi t0trxo(r no4lpeemnvtas  rrm(  ;u1optnioeilsfs rlu s;(0 exoif ootfm   n o t  exm(r3ou4ome  nvi (fsrum(  ;o4alxo oeilslm2uanms;u4artoxocto1la e ies (0 2urimpno1llt  fctat)sDuaxr ;t4apxoiocilsfs2umu s;u4aexrif iodopDe n s (0s2ur(rpny1ll   ictl() Dtr(rpou4tpxn feiytfs ua( pn(4aeenxociatfate ieil(0t2toio3nudlltelncia( artax  nu0opxnmietlsfs2umn s;()alxoxf ia1fpD au i ( srto(opiudlme lnctl( sDtaur no1aptn f3tatfmDem(vs u4tetnmf oy1lmDr ueslt)trur(opnu4al e ncsas)srraurp;o1oee  o3ilt aDua(mp;(0treoirciotfaDeauvo s  rtmirpou1lmtelneta(fs2ra( oot4texoiictltfaDrmn s (4teermr iytlmDelu o;t t2xrir3ny4ameelnei ( arrau o;u0alx ifctysfs ea(vs u)trerir oodopDelneolt) etoir oy4alt  nvtatfsrtr(mo;o0tpxoif3iat sDel( s;t)trtrxo3totla   n o;s0t2trir oydlpeelfvi s aruax o;o4olt mo3ilt mDrln o;u)arxniocoy1lmDeanvo;t0texo(opoy4lpe  nesls)sDrr(mp;u1tpxo fcias s2ulump;(0treoif to1lpDeln o;s) 2xrim oo1omtnliviltfarrm(rpoo4olto octat sDrmnvs;t4tlermrcio1fpDr uei (0 2um(o3oo1al e nvil()s2rm(mo;u1apeoiietas aDem( s;(0 rermf3iytomtraivs;t0t2xmxo iu4lm e ivsl( arua( pnu1olxnmf3ilsfsDuanmp;(0aexrmocta1omDelivolt)t2xr(opiodamenlictls s2ua( pnt4aetnmo3iys sDuanmpn() eerxfcoatlp  lu sls0 2umim3iydll emicsat sruru pnt4oee  o3iyt sDuanmp;u) ltrmf totoaDe uei;t trtmxmpou1lpee nvia(  Draxm ;t4apxo ieiltfsDul(von(4texrxo3iytlm raneo s) 2um(o iydlme lnvilsfsrum(  nu1ale mfciydfsDumuvs;u0trenxrciodfpt luvo s  exm(o3io1omtnmivta()srurur no4ope  oetls m2elumsnu0arxnmr ootfmDrauei s)teurxo3iu4lm n ncsas) 2urxm nt0olen ocilslmDemu p;(0texnifcio1fmtr nvi;s0tetm(o3ny1ll  mnes tfs2uru  ;u1tpxnmictas s rlumpnt4tltrmociytfp  li s ( s2xo(m oy1lm  micsatfartm(r nu1oexn i3iadla rl(mo u) lenir3ta1omDe n s;s0 etr(rpiy1opt  feta()sDtmu o;t1tpxo feiadlaDrl(vpnt4trxnxfciatfpDran o;s0t2ur(r nu4optnmiviat)aruauront1tpeoioetadfaDel(mpnu4trtrxr3iytfa rli s s  2umir io4om e nesls aDrrxmpnu0oexnifctysla2ean p (0 eerioctadlm ean s s0t2xmxr3nodop  micias srraxr no1tet io3iydfs2uluvsnt4alxrmo iadlpt anvilt)s2umio nudape  nes () 2tmur ot1apxo oeilt aDeluvsnt0 reoir ta1op  aivi;s srxo(rpnudllenmfcias)a2tm(mpno0olxnioeiyt m2el(ms (0trtnxo iytoptraivil() rtmxr3oo1optemfci (farrr(r ou0optnmieildla ra(vp u)alenxr3io1fm rluvsls0seumxm iu4am  mfvt t) rrmu pnu0oeeoiietadlaDrauvpn(4 rtoxociy1oa eai sls0 2triopio4ll   iet sf rurumonu1aptomieiadfm2ulums;t4tlxomf3iy1lm  lneo;s)tetr(m iodalee fesl(  rur(mpoo0optnioeiysfm rmump u4aexnircoatfa   nei;s) 2to(m3iu1ll  lnesltfs2tmxro;u4oetoiociyd m2emuvp u)tltnifciytlp  ai i t0s2xmxo ny4lm  mfvia(fsruau p;u4tpxomoetat a2el(vsnu)alermf iadfpDe nvi;t)teto(r3oudaptn nvsatfarrax oou1aetnif3iydfa eln sn(0 lxomo3iytomte u s s0trtr(mpnu1ap emfct tfa2ur(r ;o0aetoif3iytfm ran ont0 ltrmo3todlate nesls) 2toxm iydaptnlicil()aDtmum ;o0aexoioeiatlsDuau pn() eeoio3iotfmDrau ols0seurio3nu4amtemnvs s  2urx oou4alxnii3iltla2ulnmpn(0 exoxo iodopDeaueils)srtrxr3iy1lptnlncias s2tmxmpou0tlxo ieiad a eaump u)areoirciodfptrluvi;t)trxoir3nu1ole mfcta()sruax p;u1oexn oeiatfa2umumsn()texomrctodfm  ai il(  exr(rpoodol nlnes (fsDum(r ;u0texoiietatfm ul(vont4teeoxf oydfmt aivi ( trtmio iu4om  lnvsas srur(mpoo4altnmoeiyd aDrau p () renmf3iy1oatrli sl()sexoirpnu1llenmfciltfsDrmum ;o4aee mieilsls el( p t0arxomf3ty1fpt livi;t0texoirpny1lptnliesat)srtax o;t1olen ociasfs umnvsnt)trtnmfcootfa  auvi t0s2xoir nydapen fei s  Drmxmpoo0apeomoctatls2em(vont0tlxomr oa1lpD auvslt) etoir nydlptn fct t) Dtax p;t4tpt ifctyd s umn pnt0alxrir oa1fptr nvi;( tetoxo ou4altn fvi ()s2rr( ono0aetomfcils mDulnvpnt0tlxnxf tatlp r ieo;(  2xmimpiudlm  lneils) ruaxr nu1apxnmoctlt s ra(vs ()alxoxr io1oatelnesl(0s2xrir nudalenmfesat  Drrurp;o1alt mfeilsfa ulnmo u)texnmr tydla rauvo s  rur(opou4op n ieiat  Drm( ont4olto i3ils m2el(ms;u0arenir ia1fp eanvo;(0 exmxr3ny4amee neias  Dtmum ou0ope moeiltfm2ean ont) lxrmr ty1lpt  ivo t0srumim3nu1amtemfesat)arururpot1oeenioetyt aDranms t)trenmf3tytfp elnvi t)trumxrpoydopeemiei tfaruaxrooo1alt  octasfm ea(vp (0alxnio3iatfpDe u s;(0srtrxr3iu4am n nvi t sruaumo;u0tpx  ieildls ua(vpn(0altnio3iy1fptrauei;t trtrim3iy1omt  ietlsfaDua(r ;t0apeniieiltls eln o u) rtnxo3iatomt livo;t) exo(r iu1lptn fcil(f Drrxm nu0aex moeiasfmDrauvo () eerir oy1lmte ivo;s)seuoiopno1ape  fvsl()arumxrp;u4tlx mfeild mDrmnvpnu)tetrif oodlm  lneo t0 eurir3iudllen fei sf Duax poo1alx mf3taslsDuan p (4 lxoifciydom raieils)s2xrxm oy4ope  net t)a2tmu  no1tlx ii3ias m2rmnvon() rermo oa1lpD  i sl(0 2xoir3iu4al emicilt)sDtaum no4tle iocilsls rm(mont4 etomo iydoaDrlieo s0seuo(o3oodllen iesasfs2umurooo4aet  fetltlm rl(msn() reniocty1oa eanvo ( trxmir3nodlp   neils artrxr ;t4tptn octatfa ra(vo;u0 lxrmf totopDr neslt) 2urimpny1lpenmnciat arurxr no4tpe  ietydlm ea(vs;t4alenio3iatfaD  ieilt0t2tr(rpnodoptn iei s)artru  ot4tlxnifciad sDrmu pnt0texnxr iy1omDr n s s t2tmio iy4llte ici t) Dtmumpoo4aexo o3iaslm uan o ()trtoxf3tytfpteluvol( trxmxr3oo4ll nmivt s)s2taum ;o1oeeomietydla2rmn s u0artrir3oadomtrlu sl(0t2um(m3no1opt miesa() rum(m ;u4apxo f3tldfmDrm( onu0 eermfciotlpt  n ils  rtr(o3ny1omtnlnvilt)srtrxr oo0aex  fctldla rluvont)tetnxf oa1fatelnvi t) etoimpou1lptelictltfa2taxr ;u4tpt  ieiydfm em(vpnu0trerir3oydfaDe ieo;t) exoimpnydlmt mfet ( aDrr(  ot4tpxo fciltfsDumnvp;() exoxrciytfmD ai sls)t2xoio3nydomen nvtasfarrru ooo0apt io3ilslmDemu snu) eenxo oydla elu s;s0 rxmxo oodoltelfetat srrmu  ;t1tpxn o3iys sDemnms;t4 lerxf ta1oa e n o s)sruo(opoy4lltemncta( srrm( p;t1texnmo3iad m um(mp;t0 ltnmf3oydopD  ueo;s) eurim3iu1omtelivtl() Dum(roou0opto i3tasfs2um(von() lxnxo totop e u s ( trtm(r oo1lpee ieia(fsruaumpot4tetn fciat mDrlums u4treoxo oo1oat luvo s  etoio3oo4am n neil(  2tau  ;t4tlx mf3iltfs el( pnu0trenif iytoaDrlivo s) eum(r oo4ameemivsat sDtaxr nt0tpxn ictldfa el(mp;()tlxnxf3oadoaDelivo ( tetrirpoodol emicsat) 2urx pnu4apeo ieiadfsDean s;() ltrmocootlm  au il(  rtr(r3ny1lpe lfeta()aDtr(ronu1aeeomf3iyt sDelums;u0trenxrcto1oa r u i () exmxopiy4ll nlnvil( arumxrono1oleoioeiadfs2em(mp;t0 etomo3io1fm   neils  rtmio iy1omte fvtl(f rurxronu4tlt mieiat sDel(mp u)arenxr3oadopDrlu i;s)seurim no1lpe  fct s sDrmxm ;u1opxnmoctadfa raumsnt4areoif3oa1lmD  iesls t2xm(r oo4ameelfvsas) 2taxmo;u1texo ociyt aDumuvp (4 eeoif3todomtraieo;(0srurimpno4am emnet (faDrm( ono1olt mo3ilsla em(mpnu0alerxr3oodfmtr ivi;t)trumir3iudopee ivs s)arumu pnu0tlxo ociad sDelnmp t) rtoir3tadoaDeaiei;s  eto(r3io4alen fvsatfa2ur(rp;t4oexnif3iys aDelnmp ()tltnirctodomDeliesl(0srto(m3io1opte fet ()a2rr(r nu1aptomi3tytlm emuvsnt0aeerifcoadom  aieils  rxmim3nodolte ieia()sDta(rpoo0alt  ietlsfa rlumpnu)tleomr oa1lmD an o (  2tmir3iy1om   fvi sfsDrrum ;o0oeeomo3tad a elnvon(0teenir3iydfat li ils0t2uoxm3nodal nmncs s artaumpot0tpx  feiydfm rln onu4treomocoytoa r neilt  exoxo oy4lmenlnvsa(fa2urxm nt1oetoifciysfaDrmnmp;(4 rxrxocoatfa elu o;(0s2xmxmpou4ol emiet ( arumx oot1apx  fctasfs2uluvont) rtnir3ootfpDr n s t)seto(r3ny1ole mfeiat)a2ra(r nt4tpx moeiad a ua(mp ()arxriocoadopDelnei;()setrxo3oy4olt livt s a2urxmont0opxn iciadlm2ranvp;t4 rxoiocoytfaDeauvo s  rtrxo nudlp e fes tf 2taumoot0alx iociadfmDelnvo ()altnmoctatlpDr uei;s)teumir nudllenlnctas)sDta(  ;u4apxomoctys sDrlnmp ()arerxrctydlp  auvo;t0seum(rpiu4apee fcs (f rraur ;u4tpenmiciat aDelu s t)tltrxf3oydlaDelneol(0truo(o3no1lmen icias)sDta(mpnt0oeeo ictltls2ranvs;(4alxrir3tatoptelnvs;() exoxopou4lp elietl( arumxr ot0tet if3iat sDrlums;t4tltrxo3oytop e n ol(  eum(rpnu4altemiet t sDra(rpou1altnmietad aDrmnmp ()aetoxfctotomD auvol(0srto(o iy4omen fvsas a2tr(r nt1optoiictatla ean snu) eenif3tydlatrlues;() rxm(m no4am elicils s2tmu pno4oetnmo3iad m2emnvsnu0alxoxo3iydfaDeluvo s)s2xm(r nu4am   fcsl() rrmx  ou0apxnmieiatfmDum( s;t0 eenxrctatlm e n o;t) 2uoxo3iy1altemfei (faDurxrp;u0tptnif3tltls2um(ms u)teenmrcoo1lp e ivi s)trumio ou1lp  mfesas  2um(m oo1tpeomfciydfm2elnvs;()arenmfcto1fmDrliei s) 2tmio3iodlpen netat)srrrxmpno0altniieiltfaDulnvsnu0artnmr oydlmtrluvo;t0 rtmxopiy4opte nvsas srumxront1alt  oeild s2ea(vo;(0 etrmfciodlmD lnvs;t0 rurio3no1llt mfctlsfarrm(mono1alt mieildlsDrluvp;()aleoxf3oatfmtr ivi;t srtmim no4ome mfeils  2uaxmono1tpxn fetldfa2rln pnu4 etrxr3tatopDrlnvolt0t2urxm ny1lmtemfeta()sDur( oot1tee ifeiad s2rlnvo () ltrio3oadoatelieo;s0t2ur(opnydlltnmnvt t arur(r oo4ope if3tyd a eanmo u4areoioctydoa elnvs s t2trxopoy1al emnei s)s2taxr oo4tpen f3iyt a rlnvp;u)trxnmr3tydopt  u i;(  2toir3iodome mivi tfsDtax oou0tet  ictysfsDel(msnt4 exoircto1oaD ai il( setm(m3oudam elieta(  2rrur ;u0aexn ietys a2rlu p;(0alxrxr3iodoaDean o;s)sexrim nodllenmietl(fsDtaumo;u4oltomoetatfm ra(vont0tltomf tatlpt ai ol()t2umio nu4apeelfcias arrau pou4oex  fctlsla2emn o (4teeoxr3iy1op  ln i s)tetrir oodop emnciltf 2umumpou4opxomfciadlm2umuvo u0tltoxf3oodlp  aivo;s t2toxopou1lm e ivs s)sDumumont4opeoifctls aDua(vs;u4alenio3to1fa   ieo;t0setmirpiodopt mfeil( srurxrpno4oex ioetyslaDrl( s;t4aetnif3oo1fpt lnvslt0 etrir3ou4oltelicsa()artax p;t0oexnmi3ilsls ran o t)aexrxr3oytfmtran slt) ruoimpiudaptelfvs (fa2rrurp;t1aee ioctyt sDea(mpn()tlxoiociotoa eauesls)tetmxm3iu4al  lfvsat) rtr(mpoo1aeeoio3tytla rmnmp (0tlxnxf oo1opD lnes;t0 2xrxr oydamtn ncs s)aDtmx pnt4alx ioeild mDrm(mo;u)areomocoo1fa e nei;t0 2tmir iydapenlneiat  rumurp;o0tltniiciltlmDum(mo u)tetrxr3oy1faDe u o ()texr(rpnydale  net ( a2rr(  ot4tet moeiaslsDumn s;u0teenif ty1fptrai i;s t2xm(r3ny1ape lfvta()aDum( p;t4oleomociat m rm(vo;()texnmr oytfm  auvi;()t2xmimpnydom  mnvtlt s2umu onu0tleo ociasfs ua( p;t0arenxr ia1la   n s;(0 etrxo3io1lleelfesasfsrtmxrooo1aeeoioeiydlm umnms;()altomf tadom eanvils) 2tmxm3iu4lleelivs s srurxr nt1tle  fciyt sDumums;t4trerio oadlatrlies;s) etmirpnudlptnmnet t sDtaum ot4apxomf3ildfs2um(mp t0alxnxo ta1oa  li ol( srxr(opnu4lptn icsas srum(ro;o0tpt mfcild a eanmsnu0 exomr3totfaD ai s s t2trir nodalen nei s srraur nu0tpx iiciyslm2em(mo;() exnxf3oytoa  au i;s t2to(mpou4olt  nci s sDtr(rp;o1olenmieiydla2ulnvs u4tetrxo3io1oat anvol( trtmir ny4altnlfvtls)s2tm(rp;u4oex  o3iat a rau sn(4 lxrmfcoydfat  ies t)setmio3iodll  mietls a2truro;u1apen fciyslaDulnvp u)areomo tadopD luvslt0 etriopou4am nlfcta() Dta(mpnu4tltomfetasls2rlu s;(0tlermr3io1fp eai olt0setoir3no4lpt lnvsls)s2raxmpnu4apeo ietydfaDrluvp;u) etnmr3totfm r u sls0srto(r3ou1lp emnvtat)s2tru oou1oetoii3iad s2el(vo u4 etoxr3iytfateaivs t texm(opny1oltnliviltfs2ua(r ou4opt  oetysls2ulnmp;u0alxoxo3iydoa r uesl(  exoxm3io4omeelfvsls)arrrx  ;t1apx iieiytfm rmnmo;()artoxf3io1lpDraivi;( teuoxm3iy1opt livilsfsDumum oo4tltn oeiydfm ranvo (0tlerxf oatfptelieilt  etoirpnu1apt mfcs () 2rr(r ou0olto f3ild mDumums ()teenmfciytfp ean sls0seto(m3nydol nmncsat  rumxm nt1tltnmieiadfa rmu o;t4artnirciadfp elueo (  eto(r3iu1llenmnesl(  Dtr(r ;u0tlt ifeiys m ul(vpnu0tetomf totlm rau ils s2tmxmpio1aptnlicslt  ruaxm no4opxoiocildla raumo;u)tlxrmf tadomDrli ilt0t2umim nodap e ietat srta(r nu4oexnmi3tydls2rm(mpnt4tlxrmf ta1lat li i t  exmxr3oydlme mfeils  Dum(ront0aexnio3tatfmDua(vont) ltnir oatfpt ai i;()seurirpiodal nmfvtl() 2ra( o;u4oltnifciltfm um(vs u4alxnxo iodfp eauvs;(  exoxr3nu1ol emieils aDur(rpnt4aeeoiietat aDuln p u) reoxrcoy1lpDranvo;t0t2uoim iudam e nvsl()sDta(m ;o4tlto oetadfs2ea(ms;u) ltrmocoo1fpDrlu slt) rxrim ny4ape  fei s sDur(ront4apeo i3iytfsDra(mp;t4 etnxf3ootlatr uvo ()seumxm3oudaleemiet t) rur(mpou1tpxn fcildla2ua(msn(0aetnmrcto1latraivs;t)seumxo ny4lmt livil()s2rm(ro;o4olxn f3tlsfa uaumont4alxoif iotlmt livo;t  rtrxo oodoptnmneia( artaxronu0aet ioeiatfs2elnmp t) eenio tadlatr uvo s)t2xo(o ny1lmen ics t) rra(r ;o1openmf3tytfsDul(mo;(4altomo iytom   i sl(0t2toxopnu4ol e feil(  rtaxro;u1aex  ietytfm2umumsn(0texniociydoaDr u s s) exm(m3nu1amtnmicsasfsrtrurpou0teto icilsla2ean p t4teeniocoo1om   n o s  rtm(m3io1lpte fvs t  Dra(r nt4optnmfcilslm ul(vs;t0artrif3iy1faD au i s0 2uoxr3iu4lpe mnet (farumxm ot0oee mictadfmDeau s (0 exnxfciatoptrlivo;s0s2tm(mpoy1ll e fcsltfs2ur( pnu4aptniietltla eauvpnt)texoxf oydlp e iei t)s2uoxm nu4lleelncslt) rur(m ot0tlxnmfctytlm2umums;u4 ltrmo tadlpteauei ( t2xmir3oo1lltelicslt a2uau o;o4tlx  f3iltla2rmuvs t4arxrmociodfp e i o t)trtmim3oo4llenlnesat aDrm(mont1oexomf3iasfm2umums t0alxoxrcoo1lm ranvi;() eum(m3iudolenlnvil(fa2tmur ;t0tlt if3iytfs2rlnmo;t4 rtoxfcoatlpD aueo;()s2uoiopoodap e fei t) rtrum ;u1altomfcildla ulnmp u) exnxf ootomtr ueo;t)srtrim3io1ll nlfes tfarumurpno1aeenmfciys s emnvonu4 exrir3todfatrlieo (0 exrxr3ou4alte nvtl()arrmur ;u4tet  feiys m2em(vs;t)aexrif oo1fp rlies t  rtrxr3iu1alen nciasfaDtaump;u1tetnmieiyd m ua(mpn(4tetrif ta1fmtr iei;s)t2tmim3io1ol e nvsa( arua(rpoo4tlt ifctydlaDrmnmp u)arenif3ty1om rlieil(  rur(mpiodlptnmivsas)sDum(mont1apenio3ild s eln snt4 rxomf3iodfaD  nes;s s2tm(opnodllen fct s)arrmu pot4alen ieias a2el(ms;u)tltnxf3tydfa rlu s ()srtmxo nu4lpeelnet (farra( ooo1teeo f3iyd m2ul(vo u0aetoioctotfmteln s;(  rxr(r oodll nlnei s  2rmum ot1teeo i3iat m2rl( s t) rxoxrcoytomte nesl(0 ruo(rpoudaptemncta(fa2tm( poo1opt  feiydls rl(vs u0texrxr ta1omD  ieo;(0 2xrimpno4lp nmfvs s srurur no4tpeniieiydfmDelumo;(4 exoioctatlpteluvolt0s2urxm iu1ap e fcsa(farrmx  no1open ieildfsDuln p;t0 lxrxrcoy1oaD luvilt trtm(m oo4op  micsl(fsrumxro;o4oexo ietatfsDul(mp u0 rtrif3todlm  lieolt)teumxm nu1lmee nvsls)artmxro;t1opx  o3ildfa2eln o u0arxnirctytfmtranesl(0 rtr(rpiy1aleemfesl( artaur oo0altoifetad m el(mpnt4aetoifcto1lmDeau i;(0s2tr(o3oo4op   fcta(fsDrau p;u4altomieias m rlnmp;(4aetrxf3ootla rlivsls teumio iy1ame micslt)arumu oot4apx  i3iasfm2umnvs (4treomo3oydfat aivi s0 2xoxm3iy4amenlfctat  rurumpnu1tpxo fcildla rlnmpnu)tltoifciydfaDe ueo s tetrxrpou4lmtemfcils)artrurono1opxo o3tytfa em( s;t4aexrio3oa1late ieo;t)t2xmim3iodol nmiet s artrumpot1aetn feild mDrmu p;(0trxnmo3oodoa e i s s teto(m iu1lpt lfcia( srtmxrp;t1teenmf3tasfa ran o;u)aetnircoydopteluei (0s2umxr3oy1llenlfviltfaDrau ono0alxn ictytfs ul( pnu0trtnxf3iydoaDe n s;s)sexmxmpiudlmt  neils s2tmu  ;u0ae
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;() exoir oudop nmnvia() rrrxmoou1ale iictadfm2uanvo t) ltrxocootlpD aiei;(0 rto(o3iy1llenmnvta( sruax ont4olxn ieiyt sDemu o u)aetrxfciydlmDran o s0srtrxr3nu1apeemneia( a2urxro;o0tlxnifeild s2uaums;u4arenxocoydoa eluvi;() rurxrpno1llt  nei ( sDtr(mono1opxniieiyd m2rlu o;u0aexnmr oadlm eanei;( t2toxopnudole mivs s a2uau  no1texomfctltla rl(mpn(0alxomociydfa r uvi t sexrio3oy4ap e ictas  Drmxrooo4tpen icildlaDrln pnt)altoxf3io1fpDeli il( srto(m oy4om elnetls)sDtr(r ;o1tlx  oeiad aDemu s;u0trtoio3iodfmtraivo;t0 rtm(r3ny1lleelneilsf 2tr( pou4tleoifctat mDea(vpnt0 rtnif ta1lat  ies (0trxm(m no4opte fet t  2rmumpoo0opxoioeiyt sDrmuvs u0arenmo iodlmt ai s s0 eur(rpio4lpt  nvsa(f rtrxrpno4oleomfciytla umu sn() leoxr3ootlatranvs;s0t2xr(rpoy4ome lnei t) Drr( o;o1aeenio3ilsla eau o (4tetomf iydopt lnvsls  2tm(m oy1omen nvtl(f rrr( ono1tex mfctatfaDraums;u0artrmr iotopD aieo;s trtmim oudomt  fcsls arrmxr no4alen ictatla el(mon(0 rxomf oatomteaueils seur(o3oo1lm  lneiatfs2um(ro;o0aexomi3tltfm2rl(msnu)altrxo3oo1lmteluvi;t)srurim3iudalenmivs (farrmu oou4tpxoif3iyt a eanmsnt4teenxr3oa1latrlu o;(  rtoxo nu1ll elictls)aruax ono4olenmfciltfaDuluvo t) leoir oydomt ai i t0trtmxr iu4omt  ivt (f Dtr( poo1altnmfctys sDua(ms (0aexrmrctadfp  lnvi t)s2xm(opny1lptnlictls sDuax  ;t0altniocilt m2el(ms u)arenmr iodlaDrlnvs t  rxrir3iodale micsas)arrru  ;t4aet  i3tys m2uauvonu4trxrif iotoat  uvol() rxr(o3nydolt lfvi tf Dtaxmpnt1optoii3tydls umn p u)trtoircoo1la rluvo;t0 rtoxrpiy4apt  neil() rta(  ;t1olt  oetlt a um(vo;u4tetnxf ta1latraues;(  exo(rpnu4amtelictas aDuaxro;o4apto oeild aDumuvo t)artrif iodfptraivo (0texoxmpiu1lpen ivias sruaum no0texoiictad mDuau p (0trxoif iadlatrlueo ()truo(opno1ap elnvt sfs2rmur ;o0oeeo octysfsDuauvpnt0tleomociy1fa  ln o (0 rtmxm3nydap  mfctatf 2trxront0aee if3iasfm rlnmsn()trtoxo oodlaDe uvi;t truo(opoudolte netltf Dum(mpnu1apxnioeiytls2rl( o;(4treoxf3ootlate u o;t)s2tm(o3iy1al e nvslt srta(mpnu1oltoioeiys s2eau snt0teeoxf ty1fptr nei t)setoimpiy1olte fcta(fsruaumo;u1tleo ieiad s2ran o;t4teeomf3to1omD lu i;(  rtmio3nydameemfvtas) rtrxront1apeoifetld s rlumsnt4artnir3to1lmtraneols  rxrxo oydam emictatfsDuaum ;t4olx mi3tatlm el( sn() rxnmo iadlp  anes;t s2um(mpoy1lpenmnetlt)s2tmx p;t1apto fetldfa2eanms (0aeeoif3ia1oaDeaieo ( srumim oy4lp nlivtat  rrmumono4apen o3ias s eluvp u)arxnmo3oadlpD li s;s0t2xoir3io1lm   nvi (fa2rmurpot0teeo ictasls um( ont) exrir3iytfmt lu o;t texo(m nu1lm emies tfs2rmuront1tptn ietys s emnvo u0 rxoxrciotopte n s (0t2toio3iodlmen fvsat)aDraxmpot4tee  fctadfm2uln o u4areoir3tydfaDelnvo;t0s2urim3io1ame lictl(f rumu pnt4alxo fciasls2emu pn(0trxrxf3oatomDeanvs;()sruoimpiodop e ietlt  Dtrxmonu1optn ietysfm rluvont0alenxr oatlptrai s;s trtmxmpou1lme  fcslsf 2ua( pnu1ope mocilsla2rlums;t0texrir tytfpte n o (0s2ur(m ou1aptnlicsat)s2rr(mpno4alx  ieiyd aDrl(vp (0tleomo3iydlaDrauvo;t)sruoxmpio1lpt mnctl( s2tr(  ou0oeen ociys m2ea(ms;()trerxf to1lp   uvo s0seumxrpio1amt mnes ()s2uaxmpnu0opeoiieiltfa2eanvs t4trxnio oodlp  aues t) rtmimpoo1lmt mfei ()a2ur(rp;t0olt  ictytla2eln o;u0aeeoif3iadlatr uvols0texrxo nudaltelfct s) ruaum no0teeo i3ilsfaDumumpn()teenifcoodoateaivi;()teurxmpiy1lmen nesl(faDumur ;u1apxoiicildfs ea( o;t4texoxr iotfpt luvolt0 2urim ny1alte ncia()aDtr(m no0aeeomieilslmDua(mpnt0 lxrif tadfp  an olt) eumxr3ny1op nmfvias) 2ur(rono1optomi3ildfa rm(mpnu4 ltrmr3ia1oatrai s s0s2xrir oo4oltemfvt (fsDuru oou4optoif3iyt m2ua(vs;t4 lxnmf3ia1fmtrai i s)texmirpny1optnlici (faDrax oot4aeeomocilslm eau s t4teeomr tydlaDe u ols t2uoxm io4open ncilsfa2rmxrp;t0tpxo oetydlm rmnvs;u0trxoxf3iotlpt luvo;(0teurxopno4al emfvi t) rurxronu1apxniicildla rm(vpn(4aexnif ta1lp  aiesl() etr(m iu1opeemnvt s)aDrru poo0oetn f3iadfmDumu s (0 leoif3tytfpt  u s s  2xmimpno4ap e ivils aDtm( onu1tpen fciytfs ean p;(0tetnmo oy1fp   n sls)s2umxr3oo1amtemfviat)srtmxmooo0apxnioetls m eanvo u)aexnir iy1lmDraivi (0s2urio no4omtelfci (farur(r nt0olx  o3tldlm2ua( snu) exnmf oy1oat au il( sexoir no4openmnet s srtr(  no4tltoioetyt sDul(mp;u) rerif iydop rauvs;t)setrir oo1lmtnmivi sf rrrxrp;t0alxo iciadfa2ulumo;()altnio3tatom rln o;() rxo(r3io4am  livsl()sDrrxm ;o4oetn ietysfsDuau o () reoir ootopD ln olt)s2xoxmpio4lpt lfesltf 2taxmpot0tltnmf3tytfa2elumsn(0 rxnirctydlatelnvi t)setrimpio1om  lfetas sDra(rpnt0openmf3iatls rm( s;u)alxoxf3oytlpDelieo s  etmxr3oy4ope mnvs s) 2tmumoou1tltoif3tys mDrauvo;t0 rxrmfcoatopDelivs;t)trxmxr nu4ame  net (  rtmumo;o4texoifciysla rm( o t) exnir3iy1fa eai s ( texr(o iy4lpen nci (f rrm(r no1alto fciatls rauvon(4 lenxrcta1om eaneo;(0 ruo(rpou1lmeelfciat)a2rru  ;o0oexnmo3ildfa ra(mp;(4treomfciy1lmDeluesls0 rurxm3io1lme lfesas aDtaxmpnt0aeeomi3ilt a elnvs t) reomr tydomDranes (0t2urxm3no1apeelnetatf Dumxmpot0aet mf3tytlaDumump;(4 exrif ta1optelnvo t seuoxr ny1ll nmiciasf Duaum ou1aeenmf3tysla2ua(vo t0 eerxfciadfa elu s;s)t2uoxm3oo4amtnlivs (f Dua(m nt4altomfctadla ra(vp;(4 etnircoo1fm eaivs () rtrir nu1lltn ici t) rtr(rpnt0olenmfetytlaDulu pnt)trtrxf oa1lm rau s;t setmxmpoydlmeelfctl()artm(m ;o1oex  f3tytfs ul(mp;u4 eenmo3oy1laD  uei t0 rtrir oo1ol elnvsls arur(mpoo1oltomfctld s2rlumsn() lenmrciydlaDrln ol()srxm(m3iy4al elivtlt a2uau o;t1aexniieiysls2ea( p;t)aexnxociydfmte n ol() etm(m3iydomtn nvi t a2ta(  ;t1altoii3iydla2uauvs;u0aexrir3iydlateanes t)t2tr(mpnu4om   iesas sDuaxm ot4oet mf3iasfa2elnvs;(4 ltrmr oa1fmDeli il( s2toio3iy4oltelicta( a2taum ou0tlxnmietldlmDulums u4trtnmr tytfateanvi;t)srxrim3nu1lm  lnvt () Duaump;t4opt  ocias sDulnvp (4aexnio todoaDr nei t)s2tmir3ou4ope  ici tf 2raumont4oexoii3iys sDran sn(4trtoxr io1oaDr uvilt0s2tmxr oudll elnviat arrrx onu0tpx ifciys s umnvs u0tlerif3oydlmD  iesls  2tmim oodllen iet t)a2raxmp;t0tlxnio3iadls rmuvon(0tetrxo3ta1fat anvs;(0srxo(r3iodll  lfvslt a2uaxmpnu4opx iietas aDul( ont4trxoxf3io1omDrln il() rxoxo3nudole  nei t s2tmu o;u0oleomoctyt s ua(vo u4 etrxf3oy1omt  uei;t)teto(opoodlm  lncia() Dururo;u4aetoiieiat sDran s;t) rtrmociadlp elu slt t2toio no4ope  ictl() rtm( pot1ole ioeiysfa rlumpn(0tlxnir tydfaDe ieo t s2um(r iy1omenmieilt  2ur(mono1tpeoiieiltls ua(vo;()artrxf3todfpDeanei (0 eumimpou1al emnct s)arrau  ;o0tleomoetldfsDrl(vo u0 lxnifctydoptranesl()texmxrpoudop e nvsat)arrmxr ;t1tee  o3tasfsDuan s;t)alenmf3oo1omteaivolt0 euo(o3iydll emfci tf Dtr( ooo1tpx  ictys sDemn p;()tltnxf oadom  auvi;s0srxoimpou4lmee fvs tfs2rmxmont0oee ifciys m2elu s u4 lenif ootoaD lu ols t2uoxo3iu1lmeemivs (  Dtr( p;o1tlxoifctyt mDemu p;(4arxrxf3tytfaDr nes;( trumxrpny1ale mnctas) 2raumonu1aleoifeiydfsDulu s (0 eermf3to1optelivilt0 exmio3iu1opeemncia() 2trum nu1texomo3ildls2um(vs;u) eeoio oy1fat lnvi (0 euo(r3oo4olt mnciat)aDrm(rp;o1tptoii3iyt a rlu s ()alerxrctodlp ranesls) exrxr3iydolt  nviatfsDumx ooo0aexnioetatla ea( o;u)tetoif3ta1la  anvol(0 ruoxr iydal nlncsa()sDumxroot0olenioeiydlaDuan s;(4altrio iytop rli s s) rurxo3ou1omeemnei s)sDraxroou0tetoifetltlm2umn p t4trxrxr3tydlptean ol(0 etrimpiodal nlncslsfaDrrx  ot0tlx  i3ias m2ulnvp;t4tetnmr3oatfptrlues;()t2trxm3nydlme lnvtl(fsrtmu  ;t0tpxn ociyt m umnvp t0aexnxoctodopt li s;() exoirpiu1om nmfes t arur(rpnu0aexo feils a ra(msn(0alxrif3ta1lp rluvsl()srxmxm3ny4al n nvsl(fartaumpou1tetniietadls rmn p;t4 etoir ootla e iei () rumxm iudamen feil() Dtaxm no4ale  fctysfm elu p u)trtrircto1oaDelnvo;t0t2trxo io1opeelnet s)srum(  ;t0tpenmfciys mDul(mpn(4areomo3tydop eauvo;s) 2tm(o oy4lpeemies t  Duaxmpoo1teenifctysfs2umn on() reoirctadomDrau sl(0t2toxr3io1ap elieslt s2trumoot1oex iictasfmDea( p;(4 eenmf3iadlm  aueol(  rxr(r3nodole  netls)sDtru o;t1teen ociad m rmnvp t) eeomoctytopDranes s)trxrio3iudoleemnvsls)a2uaum ot4tetn ieiad m rmumo (4arxnircoy1oat lieslt  eurxmpiy1al elnes t)sDrr(rpot4altnif3tadlmDrl( pnu4 exnxf3ootopDelneo t)srum(r3oo4alee nvil()s2um(mp;u0olxoiociad s2rm( o;u4artnio totfptelueo ()srum(r3nudoptelieia( srrmu o;u4oleoifctlt m eanmsnt0arxnmrcia1lp e iei (0teurirpoo1open nvs (faDtm( onu1aeenifeiat s rauvs;u)aetnmf ootfaDr ivs s  eum(rpno1om nmnciatfsrrm(  ;t0olenmo3iytls2rluvp;u4tlermr ta1oat  u sls t2to(m3nodomen feiasfa2tmx ooo4olxnii3tyslm2rlu s;u4 renir3oo1lp   i o s)srxmir3nu4aleemneslt)arrr(rpot0tet iietatfmDrmu p u4 eeomfctadfat  nvs s seto(opny1omtnmnvt ()sDrmxro;u4aexomfetadlsDrlnvpnu4 rxomf3iytlm   ivi t)setrxmpio1lptnlncsatf rra(rp;o0alxn icildfsDumu s;(4 rxnmr3oa1fmt  ieo s0trxm(opou1alenlfet ()artrxrono1apxnmi3iasfa ean s t4trxoxrctydlm   uvs (0srumxr3oodlm elfvtl(fsrrax  ;t1aet miciyt a um(mp (0 etnxrcty1om ranei t teuoxo oo4lpt  iei s srrmurp;o1tex mictat m em(vo;t) rxnmfcootlat  n ilt  2uoxr3nydoptnmiesasfsDrmurooo1oltoio3ias m2ea(ms ()aeeomr iadla  lnvsl()s2xoxrpiodaleelietltfartru  nt1apeomieiydlm eauvs t)arxomr3iydoptr i i;t0s2uoir ou4lp nmfcsa(fa2uau  nu0optoioetls a rmuvpnu0 rtnxo io1lp e uvo (0s2toxo3nydlle  nvtlt srum(mpou0tpxo f3iyd s ea(vo;u4trtoxr to1fmDran s () etrirpoo4oleemfetls  rtrumo;t4apx mieiatfs2el(mp;u4 ltnxr3iydfp r uei s0s2urxopoo4opeemivsat  2taxmooo4olen iciysfs uan s (4artnir3ta1lmDelu i ()sexo(o iydaltn neiatfsDurump;u0tlxoifetadfaDum( p (4aeenio oa1lmtr nesl( seum(m ou4omtelncil(fa2rrx ono0oleoifciydlsDrmumo;(0 exnio iydfmt au i;t texo(rpoo1lptnlnet ()a2ra(m nu1tpe if3tasfmDrlnmo u) rxnxfcoydom  anvolt0 2tmirpiudal   ivs (  rrau  oo1tltniieiydfmDrm(msn(4arenio3oy1lat  neolt  etoxr ny1amenmnvsatfsrrrxm nu1alto ieiysfm rl(vp;(4 rtomr3tytfateaieslt seuoxo oy1lp nmfvia() 2rm( ooo1oex mi3iysfs umn snt4treomfctodfmD  nes t) exoxm3iodalt mneilt) Drruro;o0tltnif3iadlm emn o t4 leoirciadfa e u sls  eurxmpou1om emics (f Drrum ;o0oex  feiyd a eaumsn(4 rtnmrcootomDraueo;(0setoxo nu1lltn fvtlt  rraxrp;t0ape mfciydlm emu pn(0aexnxr3tytlpt  neo;t0srumxm3iydap   fcs s  rrm(rooo4tlxniieiltla ulumpn(4aetnmo ootomDraueo s)srtoio io1lpen nvsa(fa2rrum ot0teeo octld m ul(mpnu0altnmociydfmtrlieo t) eur(opio4ope lncta(f Dta(rp;o0oleo f3iytls2emnms u)artnir3iytla rlnvols)teuoxm oy1op e ieslsf Drru pno1tltomo3iadlaDrlnmp;(4 exnxo ta1la rlnei t0sexm(o3oydopeelneiasfsrur(ronu4aetnif3iysla ulnmp t4 exnxocoydomD liei t s2toir3iy4amt  ietas  Drrxrpot1oeeoii3iatla2ul( pn(0aeenmr3oatlpDeai o;(  rxriopiu1altemfcsat sDrrxm ot1tetoiietadfa eanvpnu) renxr ty1la elnvs;(0t2tmxr ny4op e nvi ()arrmum oo0tptnifetldfmDrln p;t)texoioctatfmD  u s;s)teumxo3nodolt lnvias  2umxm ot1texo fctas s2rl( o u)artrmr ty1oaDean s (0 exo(r3iudlptnmnesat)sDururonu1tpxn icildls2eauvp;u) etoxf3iotfp  lieo (  exmxo3iodopeelfesls) Dumumpnt4tpto f3ildls2umn pnu)trtrmr todfptrlueo ( s2urio oo1llee nvilt a2ra( p;o1oee moeiytfmDea(vs (4 rtnmocio1faD au s ()sruriopnu4lme lici ( sDuaumo;u0altnifetad m2uau s;t0trtnxfctydfatr u sls)trtmio3no4ol emieil( artrxmpoo4olenifeiad a ulnmo;u0 exrxf3todlpD  ueo;s s2toxo3nudlp n nctas)a2tru ooo0apto ociys m2rm(mp;t4treoxf3iydfatranvi;t) 2uoimpnu1lleemfct tf 2rrump;u4tpen o3iyd m2umn pnt) exomfctotlptrluvo;t0 2tmxm3iudopeemneslt srrau pot0opeoioctltfm2ranvsnt0 ltnxfcoatfmtr ieol(0trxoir3oo1al elnvt t  2tr(  no0ale mo3ildfm umnms;t)altnmf3iadfaDraivols) 2ur(m io1om  lfciat  2um(mp;u0tleo i3iad mDuanvsn()trxoxo oo1lpD  uei;t0 exm(r oo4am elivt sfsruau o;u4aptn feiyslm umums;u0 rtnxfcoa1lpDr n o;(0s2toirpny4ame  icta() Drrxro;o0tptoifeiyd s2em(mo;t4texomo3oo1oaDraivo;( setrxopny4lptn fvt ()sDtrxr nt0tetnmieiatla uauvp;t4treoif3oadlmD anes t)tetr(mpnu4lm elfvsas a2ururooo1ope  f3tasls eauvp;t0trtoxo iadopDe ivi;(0t2urxm3nu1opt  ictltfa2ra( pot1apxnmo3iaslsDeanvp t0aeenxf iatfat  ueo s)s2umxmpou1opte fesltf rtaxmoou4tlto i3tydfm2emn s;t4 exnio3tatlpDe ivilt  2um(rpnu4oltemfvta(f rtr(mpot4tle  oetadfa2rmuvp (4 lxrmo3tydlaD lies;s)truoxo iu1alen nvsasfaDrrur ;t0oexomoetlsfs um(vs;t4texrxf3io1omD lneo s0s2xoim io1opt  nci s)a2rmumo;t4apxo ocild sDum(ms;t)areomrctotfp rlies;t srtmxmpny1openmivias a2tr(  nu0oltniicild aDumn p;(4teerxo3iytom e n o;t)s2toxo3iu4oleelnci tfsrrrx pou1oee ioeils s2eln p u4tlxrxfcty1fm  ln o t0seumimpiodll elfesls sDtm(  oo1oeeo f3ild sDrlnvpnt4areomo ty1faDeluvs () exrio3nu4llt  ncsl(fs2raumono1alxo i3tad mDran s;t)aexnxr3oatlpD  neils0trtr(m3oudllt licsas)s2ra(  oo0altomf3tld mDean pnt)altrmr3tatfa   nvsls t2xo(rpoy1altnmict s)s2ta(r oo4aexn feiytfaDuln s;t4artoxr iotomteau slt0truo(o ny4olte fvtls)sDtmu  ;o4tet ifeiysls2rlnvo;() rtrxr3oa1laDeli ols0 exoir3oo4omeemies s aDumx  ot0tptnioctyt a2ra(mp;u)alxnmocoadlaDrai o (  exm(rpiy1oltnlies (farum(ronu0alto ietas s rmnvonu4 eerir tydfp rlu s;s srto(opiydome lnvslsfarum( p;u1ole if3taslaDuluvs;t) etoiociotopDeln s s0 2xm(rpno1apenmicsasf 2ua(m ou0tee  ocild mDrmu p;t4 exomf ty1fa  lu i;s0 rxoim oudol nmfvi sfarumxr oo0aet  oeias mDeluvp;u) etrxo3totlmte nvi s) rurxm oo1om elicta(fa2umxrp;u4oet mfeiydls ean p t) lerxr3todfat aueslt0t2tmimpnu4apeemfeia( aDrrumpot0apen i3iyd m emumpnu0 ltomoctotopte u ol(0 2umxm nodome mfcs (  Dtmx  no4oex  o3iysfmDeluvo;t4tlenxr iotfp e nei () etoxrpiy1lptemfesa(  2rmxmooo4teeo i3ias a rm( on()trenmr tadfmt  nei;t setoirpno4lmte fvsas)aDum( pnu4aeeo i3ils a2umnvo;t4 ltnifciy1fa eaneils0trurim3ny4op n nctlt arta( p;u4altoioeilsls2rl(mp t)trtoif iotfaDrli s;t)t2xoio no1ale  nvt (f rum(rpno1olenii3tld a umn p;u) rtoir3oy1oatrluvi t srtrim3nudom  mfci ( a2rm(rpno1tpeomfctlslsDrmuvs;u4arxomo3iotfmt  ueilt0s2xo(r3iu1op nlnei () ruax ono1oex  o3tysfaDumumo;u0tlenir ia1fmDrlu o;(  rxr(rpio1ape  ieslsf ruaxmono4oeeo oetld sDeluvo;t0 rtnio3oy1lmtrlnvs;() rtrxm iu1al e iei t s2ta(  ;t0tlto f3iat sDem( s;t0 lerxf3oadomDrluei;t0s2umir nodap elfci t) rtaumpoo1alxnif3tltfs2uluvo (0trtoxf3iydfatr ieol() 2uoxo oy4op nlivtlsf 2rau poo4aleoif3iysfaDemnvs;u4tltrxocty1fatr u o;t) exr(o3oudome lncia(f Dtm(moou1tlt  ociadlsDrlnvs;(0 lenmo3iadfpDrlnei t s2xoxopiy1optnmfvta(f Dra(mooo4tex mi3iydla2uluvp;t4tltrir ta1la  lues (0seumxm iodam nlncs tf 2umx  ;u1tpx mo3ilt s2rluvont)trtnxocia1fmDrliei;s) rurxr oydapte ivt ()a2umu  oo1tetoifciadlmDumumo () eenmo oa1lat lnvolt0srtm(r3oo1op elfci t)srraump;o1ope  o3ilt sDrm(vo u0altrir iatfaDelieols srumxmpoo4am n icias aDururonu4optn i3ildfm2eanmp;t)trerxo3tatoat ai s;s s2toimpou1ap elncs t sDur(r ;t0olxomi3iyslm2rmuvsnu0tetoxo tytoaDrluvo s t2uoxm3nu1olenmnct () 2taumpou4tlt  fctadfaDran p t4aetrioctatopD li s t)seuoxr3iudlme  ict s  2rmxmoot0aee mieild a2ea(mp u0trtrxfcoo1lp rlnvsl(  eum(o3no1opte netatfsrraur ot0tlt mo3iysfs el(msn(0 lxnir3tydlpD luei;s s2trxrpoydll   icsat arur( poo4tet ii3tatfs2eluvs t0tltnir tydop eai s ( s2tm(r3no4llt lfetat)srta(  ou1tpxnmieiadfaDumuvp u0 exomrcty1lpteauesl( setoxo3oy1lpenlfei s)aDtrx  ot4apeo feiadlm emu p;t)trerir3iydfp elu sl( teto(m3oydoleelfcs ( s2uau poo1alx  fctytlm2uauvo;u4altnmf3oodfmDr u o;s0seto(o nudlpenlnvil(fs2rrx oou4tle  iciyslaDemuvo;t)aexoxrcoa1optrlivsl()trtrxo3io1olenlivtatfsrtau pnt0alto ietyslsDemnvp;t) renmr3oy1lp eauvs;() exr(mpny1amtn iei s)sDtm(  ;u4tpxoio3iytfm uau onu)aleoif3iatfmDr ueils0trxoim3iu4lptemfvsls) 2tr( oou1tpx miciltfm2uauvont)texnxocoodfmt auei (  2toio3nodlm emieslsfarurxronu4alen fcilslsDranvpnu4 renioctotfptranes s0srtoxmpoy4altelfeia(farumx  ou4alx mociyslmDeaums t)arenxoctydlp raies;t0setrxr3iu4lpen ivta()s2tmu p;o4apt mieiltlm rmnvsnu0altnxo todlaDeli i ()trtoxopnudlpe miesasf rrm(mpoo1tpenmo3tyd sDulums;() rxoxr3oydlmDean o;(0teuoio3no1ope livtl( sDtauront1oexnmfcildlmDumuvp t)trtnxocoadlmD  u s s0s2xrxmpiu1omen nesls s2rr(m ot1tlt mo3iatls2emn ont4 reomrctadla e uvo s0 2tr(r iu4ape  iesa( srtmxm ;t
\ No newline at end of file
@@ -0,0 +1 @@
+nvo s0s2toxopio4alee nct ()artmxm nt1ape ioeildlaDrlnvs;t0tetnirciytomDeaueils)trtm(m nydll n ivtltf Dra(m ou1oexo ieiysfm2ul( onu0altrmf3iytoptr nesl() 2xo(m ny4lpen feia()aDtax pno4opt iieiltlsDrl(mp;t0aleoioctatlpt aueo s teurxopnu1lme mict t aDumx o;o1opt iictad mDrlumpnu0artomrciydoatrln olt0 rtmimpnodap emict sfa2urum ;o4oexnifciltfsDrln o;u0 etoio ty1opDeliei ( truoxr ou4apee ict tfsrrr(mp;o0aex ifcilsls2rmums u)trxoxr todoa elnes;t0s2trir iu1oltnmivt ()s2ta(  ;o4opeomoctad m uluvpn()aexrxo3oa1fmtrln i t) euoir oo1lltelnei s) Dum(r ot1tptn o3iys sDea(mpnu)arermociytlpteauei t0trxmimpiu4lp nlfvtat)arrrx ont0oet ifeiltfs eluvont0 ltnxfcoatfmtean s;s)s2uoxm oodll  lfciat) Dtmumooo4oltnmfeils a eluvp;t4arxoxo oydlaDeaies () 2xrio oodol nmiei s) Dtr(m ;u0tee moctytlsDum(vont)alxoxr3oodoa   uvo;( t2tr(o iu1op nlfviasf 2uau ooo0opx moctydlm em(mo u0trerif3iotoa elieolt0s2tm(r io1apt  ictasfa2taurpnu4tpxo oetls a rmu s () lenmr totfmD auei () exoxr3oudamt mfesat) rtruro;t0tptnif3ias aDulnms (4trtnif3ia1fm rau o t0sexrimpiydamtnmfetl()aDtmx pno0optnifeils sDean p;(0aeenio iatlmt  uei t0s2toxr oudalt mfes t)s2raxmo;u1aeeo ieildlm2ulnmp;t0texomf totlp   iei s)srxoxopoo4ll  lfeil()srtmu  nt4tptoii3iaslaDem(ms;t0 exomo3todlmtrluei t seum(rpiydapt  fei () rtruront0aeen fctas a2ulums t0alxoxocootoa r i i;s0seum(m3nudam nlietat) 2ur(mpot4alxo ociysfm rau sn(0aexnxocoy1fa ean olt)tetriopiu1ll nmfcsat sruaum ;o4tleniieiaslaDuau s;u)alerxo3ty1fmDrlu i;t0 2xoxr3iy1lm elnvsa( aDtrurp;o4texn f3tatfa2rau ont0alxrmo3iy1lptranvs;() 2trim3iydome lnvt (f 2uaumont0tet if3iad m2em(msn(0 rtrmf3tadlpD au ils0t2xm(rpoy4ole lnct t) 2rax ono4openmfciyslsDeaumonu4aleoxrcio1opDe ieo;t) 2uo(r3nu4lle micta( sDrmurpoo0apen ieils a um( s;u0 rxomr oodfptrluvsls)trxrxr3ou4llt lfviltfsDrau  ;t0aptniictlsfa umnms t4tlxrmo3iodoaDrlnvils0 exrxopny4omt  iesat)sDtax pou1tpx  fcils s rmuvo t) lxnxfciatomtr nes s seum(r io4ll  mnct s srrm(moou1tlx ifeiys s2ra(mp ()aexrifcta1fa e neol()trtrxo3ou1olee fviltf Dtmur ;t0aeto oeiltfs2ranvp u0 rxrxr3ty1fm e iei;()srum(o nudamt miesasf rrr( ono4alxnmicils a emnmpn() etoxocty1opt aieo (0s2xo(r iydomen ncsas) 2uau pnu0oetnifciadfa2uan s (0tlermo to1omDr neils0sexmimpoy1ap elicsat) 2um(ro;o0opt micils m em( o;(0 renir oodfa   n ols truoirpnu4amtn fvil( sDraur ;t0tpx mi3iatlmDuluvp (0trxrxr3iatfmt aiei;()trurio iy4omtnlnctl( srtru  nt0oetomieiaslaDel(ms t)alxnmr iotom  li il(  eur(o3nydamee iesas  2raum nu1tltnmfctltfaDrau p t4altnxf todopDeluvs s tetoxo3no1llenlnetl(faDra(mpnt1oex  o3tlt aDulumo;u0tltoir io1fm e uvolt s2tr(r iy4openmfcs tfa2tr(ronu0oexnii3iyt s ra( pnt) renmo iytop rlu ilt)srxmxr iudole lfviat arrm(r ;o0aeeomietysla rmu pnu0trenio oodom raieil(0setmir3ou1lm n icslsf Dumxrpot1tle if3tytfm2rmn s t4 rxnmr tadfmt aiei ()tetoim io1op  mncilt  Dtru o;u1aetnii3iad aDrl( p u0tltnifcoo1optrlueil()s2xmimpiy4lm emict (  Dtmx o;t1tpxoiociadls2ra(vs () renmr oy1om eluvo (  rurxr3io1lmtn fes t a2um(mp;t0tlenmoeiyt aDrmnvonu) exniocoa1omDrauvo;s)setrim oy1oleelnei s) Dra(rpot4aexo ictldfaDrln p u4trtoirciydfm r n o;t  exm(r3oodlmee fvias) 2ua( oot0aeenif3ilt m umu s ()artrxrcty1omt auvs ( seumxm3ou4lp elivsasfs2ua(mpno0ale  oetyt m2ean s;t0 ltoiociadlmD anvi s  rur(o3oodoptelfcil( a2um(  ;t0aetnio3iad s rluvs (4trenmfciodopD  n s;t  eurxrpny1lme  fvi (faDurx pno0tpt  fetysfaDra( o (0tltrir3tadoatrau s;s0t2trim3iydopeelfeils  rra(ro;t4apx moeildlsDrmu ont) lxrmf oydlpD  n ils)seuoxr ou4aptnlict ( s2uaxrpou0oee mo3tytla2rlnmonu0tltriociotoatraueilt)tetmxm oydlptn nesls)s2rmum nt4oexomi3iytla2ua( p (4artnxr to1fpD  uvs;(  exmxr oo4ol  mfctas aDtmxmonu4tltomfeiatla2ran p u0 reoxfcootfp eai s t  2xr(r nydlme  ici (fsrtr(mpot0oltnmf3iyt sDran ont) lxrif to1fa r n i s0setoxrpiu4oltelncil()aDrmxmp;t0alxo ocilsfm2em(mp;u4 ltrir iatfmDeai s t s2xoim ou4ope lfcsasf Durur oo1apeo i3ils mDrl( snu)tltoir3iatfp e uvilt srtmimpiu4ameemneil()sDrmum ou1apxniociatls el( p u0texoxo3oo1omDraivs;(0 2uoxmpou4lmt lfct ( aDtauronu4aex iicils m2rluvo (0alxoir3oa1lat au ilt0srurio iy1opt mnctas)aDtmxmp;o4oltnifeiadfsDumu pnu4alxnxrctatlaDelivi s0 ruoxm3iy4lm nlnvilt arrrxmoot0opxoifetld a2um(vo (4 lenmf3oy1lpDe uei () etoxrpny1om emivi (f 2rmum ;o4tpxoiieild s el( p ()tltrio oydopDr u o t)teurio3oy4al nmfvs ()s2umu p;o1alen f3ilt s elnvo;(4treoxrcoytomt ai ols)teurio3oo1al n ieiat  2umxrpnu4aleomo3tyt m2rl(vp;u0artnxr iotfptr n ols sruo(opiu4ol nmncs t sDraxr ou0opt  f3ils aDeanvon()trxrxf3totomDranesl()trtoxm3iu1ameelfcilsfaDurxmo;o0apx if3tyd s2rmnvs u) rtnxocoadlp   uvs s0trumxm oo4lmte iesl(  Duaxr oo0opxnmieiatlaDem(msn(4trerif3oadopD aivs;s0seuo(mpou1omenmfctls)s2uaxrpno1apeo fciasfs elu p (0 exnmfcto1fa   ues t0tetm(r3oudlp   nvtas srtm(  nu1apx mieiad s2eaumo;t) rtrio oatfmt lneo;s0 eurxo3oo4al nlncs s srua(rpnu4altn o3iasfs ua(vsn()aetnxr3to1fa r ueolt0seuo(o oy1ll e ivtat aDuru  no4teenmocils m elnmsnt0teenif ootlp  lu s (  etr(m iu4ame mfvi sf rtaxmpou4aexoiocildfs ul(vsnt0arxnmocoodoaD livo (0t2tmir3iudlm e nvils) rrr( onu0olen o3tydfa rl( o;(4 exrirctadfmDelies;(  exoxo ny1ol  lnvils)artmu pou0oet iieild mDemumonu)aexnxo3totoaDe i olt0srxr(r3nu1ape lnei s)a2ra(  oo1aexnifeilsla ea(vp;u) rxoiociodop  luvil(0 etr(m nodame lfcs tfs2rau  ot0olto feilsla eau p;t) exnxf ootlp r uei (0 etmxrpoy1ll  lncta()sDtm(  nu4apenmi3tydfs rauvpnu4 rxomocoa1opD  uvo (0seto(m oo4lp  lnvsatfa2ua(r ;o1tleomo3iys m rauvpn() exnif3iotoa rlivols0 etoxm3ou1lm e fcil(fa2uru p;u4olen f3iadla um(vo;u0 rerxo to1fpDranvi (0s2tm(r iu4olen nvils) 2tr(mp;t1apto ietasfa eaumsnt0tetnxfctatoa eaiei t  ruoim3ou1lp nlfcil(fsrumur ;u0apto iciyt sDrm( p () etnmo3ty1laD ai i;s s2umiopou1lpenlnvi ( a2tmxrpou1openioeiasla2ea(mo;t0tlxrxf tadlm e uvo ()s2xoxm3iodll n fet s  rumxr ;o1tpt mo3iat a rau s (4tlxrxf iatlpt  ieils)setmir3nu4lmt mfvsatfa2um(rp;o0teenio3tad m um(vp;(0 exnxo io1fmD livs;( seuoxr oy1lpt lfeslsfartrxro;o0aet mi3iasfs2rln o;()trxoif tytfpDranes;( trtm(m3nydal e fvsa()s2taxmo;o0tee mieiltfsDumuvpnt0aexrio3iydla eauvolt0t2xrxopoodam  lnvil(  2tru p;o1tlxoiocias a ua(vpn(4 etomoctadlm eln s ( srur(opoo1lm nlnct (fs2tr(rono0oexoifeiytlmDea(ms u0texnmocoytlptr ueo t0 etmxr3oo1amen net (f rtr( pot0tpxoioctlsls rmuvp (4arxoxrciydfpD  ues s0 exm(mpiu4lpe lfei t)sDrmxrpno4oexnmieiltlmDrlnmonu0 lxnmf3iadlat  n sls s2uo(o3oydol nlies sfarrau  nt4opx moeiytfmDumnmo ()teenxoctatla e n s s0 2xmxo oydalte fcs ( arum(r oo1texoio3tydfsDuaump (4tetomfctodlm rli olt)srtmxr nudope livsls)srururpno1tee  octydla uanmo;() etomo oydomtrau ils0srtmxo3ny4omtemiei ( s2rr(mp;u1tptnmfetldlaDrau o;(4areoir iytfmD lnvo ( s2uo(r io1lpenlncslt)aruax pnt4aex ioctytfs2emuvsnt)aexrir3oy1fpDean sl()srumiopoy1ll nlnei tf Drm(mont4tex ii3tltla umnmp t)aeenmr iydfpt auvi;s)t2xo(o ny1om nmnvsatf 2raurpnu1apt mo3tydls eau ont4 ltrxr iytlaDrlu ils0trtmxo iy1optn fciat) Drrumpno4alxoifciyd sDeanmp u0 etoxfcoo1fpDrlnvo t trxoimpoy4om  lnvt (f rtaxmo;o4apenmf3ildfmDemumpnu4tltnmrcoatlptraieilt0trtmxo ou1lmen nvtlt sDua(mpnt4oexn iciydlm ul( p t4texnmf oytfmteli s;s)texoio3no1llt micsatfs2trxmpnt0aexo feiatfa umums;t)aeenio3oadlmt anvi;()srtrir3iy4apenmfctlt)arrr( oou1tpxnmfeiat m2ea(vs u0trtnircta1oa  aiesl( trurirpiydlmeelnvtl(faDrmumoot1tetnmoeias s2em(mp;t)aetomo3iadlatraneols  rxrir nydop  lneiasf rumxroot0tpxoiocias s ulu onu4 etrmf tadomD lu o;s trtrxopiodlmtnlfctlt) rumuront1tltn iciytla eln s u) ltnxf totlpDe uvols0trto(rpiy1lm n neiatf ruru p;u0tpeomfeildlm rmnvpn(4 etoif iotlmtrluvs s srxr(r oydomeemfctas) rtaxmont1tee mictadfm2eaums;u) etomo3iy1oat lieo;t0 2xm(mpiu4olte nvsas)sDuaxro;u4tpe mictadla ranmp;(4aetoxo iydoa e ivo;( t2trxr3oudlpeelneiatfs2rrx pnu0alxo f3tytfaDrmn p;u4 exrmf3todlmtraivol(0trxmio3oo4am  lfvi (fa2ur(ro;t0optnmo3iasfm ra( snu) rxrmo3tatfpDelnvi;s)truoio oydomte icia(  rrmum oo1tleomiciad aDrl( p;(4 rtnifctadomt auvi t0setmxo3nu1ape  ivi t)sDta(ronu0tpeo f3tltlmDranvpnu) etrio oy1omte ieo s)s2xmxmpiu4op nlivslt)sruauro;u4aexn octat s2uan o;(0 rtoifciatlpteln il()s2umxrpoy4lmt mict s) rra(m ;o0tee ioctysfaDemnmo t4teenir oadop eanvs;( s2umxr no1ale lfcil( srrax pno0teenmo3ildfmDrln o u0 eenxr ta1oaDr nvslt0setmxopno1oltnlieils s2rrxr oo1opxniociydfa umnmp;u4artrxrcoa1fp rlnes;s s2umirpoo4lptn ictl()aDtm( oot0alt ifetlsfs ul(vs t0tlxoxf3tytomD aiei;t0 eto(rpoo4lmt miet t aDumxrpnu0tlx ii3tadlm ul(ms;t0trxrmr oodlp eli slt0tetrxrpoo4ape mnct t)sDrru  nu1tlxo ieiydfaDem(vpnt0alenmrciy1optraiesl(0sexm(opoudlptnmfesltf rtru  nt0alt mocilt s2emu o t0aetnxr3todomDe u o s0 2xrxmpiy1am emfvias  rtrurpnu0apenio3tls m uau onu4tltomr tytlm elnes t)srtr(o iy4optemncsat sDraurpoo4aex iictyd s um(mpnt)trtnmo3oy1opDelivi;( tetoxopoy4lm emfcil()s2ur(  ;u0oleomf3ils sDrlnvp t) rerxfciadfpDelu olt  exoxmpnudoptnliet t)aDua(rpno1apxoiieiltls2ulu o t)texrxo3iotomD anvo;()srtoxm3no1omenmiet tfaDrr( onu4tetoifctaslm2rl(vo;u)aexrxr3oa1lpD auvs;() 2to(r3ou1op nlivils) rrmx o;o1tlt mi3tad a2rlnms t)tltrmrcoadfaDranvil( sexmirpiydaltnmnciasf rrau onu0opxn ictltls rlu o;t0alerxrciydopt auvs;t)s2xmxo nu1am n ict (f Drmxmp;o4tpeomietls a rmu s;u4aetomf oo1fate i ilt) exrxmpiy1lleelneias  rrrx o;o1texo fciaslm eau p t0 rerxfcoytfpt ln s t t2trxr ny1llee net (  rraxmpou1oex ifeiys aDel( p t4 exrxr3iadopD anei (  rtm(r ou1ole  fvil()sDrr( p;o1aexo ocilt s emnmp;u4alerxr3tydlp r i i s0 rtoimpny4omenmietat)aDtr( oot0tlto ociyt s2ua(mp;t4trtrmf iytomtrauvi ( setoir3oo1ll nlfes sfsDraxr nu4tpe mo3ildfa ea(mo ()aexnif tadlp rau i t)trum(rpny1lp  lics s) rua(rooo4oet iociltfmDumu on(4artrxrciy1fp r u s;t0 2tm(o3io1llen nct s  rtaxronu4tptn iciltfa2ran s t)aetomr3oy1fmDr ivsls0 2umxr3nudoltnmivs ( arrm(moot1oeeomietldfs uaump t4artnxo3tadfm rln o;t)t2to(rpoudlmenmfvi (faDtm(m ;t4olenifciysfaDul(vpnu0 eerif3iatomDrai sls srtmxm3nudopeelnvt t  2rmumpot4oltnifetltfaDumnvo u4trxnio oy1fatrluei;(  ruoir3oy1llte ivs ()aDta(ro;u4optniieils sDrlump;t4tetrxfcia1fmD  ivo;( srxmim iodlpte nctasfaDrrurpot1openiieilt sDranmo t)artnif3oa1fp rlies;t0t2umxr3no4llte ivilt) rtm(mono0tlt mf3iadlm elnmo u4teerir3oydlm rluvil(  eurir oy4lptemivt t arrmump;u4oexoiieiytls2rm(mp (0alxomf3oo1oaD an i;t) rxoxm oudal   fctat)s2trurp;u0tpx iictysla rmnmo t4tlxomf ty1laDeauvs;t0trxrxr3ou1opeelnct (  rur(rpou0teeomfeiatfa2uan o t)aeerxr oatop r nvo ( t2xm(mpny1om e iet t)a2taur ou1tle  ietltlsDel(vp t)trtnxf3oodfmt lnei s)srxrirpoydol  mnesas  Duax pou1alxomieiatfa2em(vp (4 reoif tadfpDe u ilt0sexmxm iu1altelfetlsfs2uaxm nu0olt  ieiltfaDranvsnt4 etomo3tydfat au o;t  rtmir oo4lpeelnesa( a2rrxmp;o0oexomocild aDem(ms;t0tleoio3oa1oatran s;( trxrir3nudlm   fcsl()a2rm(mp;o4tetomoetldlaDeauvont0 eeoxr3iadoa e uei;( sexoxmpnydlltelnvil(  rtmumpou1oltnio3ildla ul(mo t0altrmo tytoat aueslt) etr(o io4lpenlict tfsDraurpoo0tptomieias a el(vsn() lxrmfcoy1fpDelu s s trxmxmpny1lme  fvtls)s2rrxm nu1oetnmoctatlaDemnvp;u) etnxfciatlmDe neo ()teumxm3io4lpenlncilt  rrr(m ;t1ape mieiad mDem(vo;(0 etomo3iydlp rai o ()s2toxrpio4lme lfei ()sDtmum nt0aex miciyt aDrlnmsnu)alxoxfctodfm   nvs (0 rum(rpoo1lp nmfvt t) Draxr ;t0oetoioeilslm emuvs;t0tlenxrctadlaDeaivi s  rtoxr nu1lle  fetlt)a2rau  ;u0aleoiieiys sDrlu o;u0alxrmrciatoaDeli o;(0teumio io1op elieta(fs2rm(ro;o1tlxomo3iat s uauvon() etnmoctydfmDr ues s)s2uo(o nudol emfvia(farrr( p;t0tlxnioctasfm2rlumpn(4alenifcootlaDrauvils0tetrim3io4alt mfcia(f Dtmx poo0ale  f3tytfm em(mpnt)aleniocoatlm r ueo;s)seuriopoo4lpeelnvs t  Drmxmoou0aee ifetysls ulu p;(4aleoxo3iydopDelu s t texmiopoy4lmt  ivtl(  2rmur ou4texnif3iysfs2rlu o;t4trtomr iadoptean slt  ruo(mpio1omte ieia( artmxmpnt0aptomocildfmDua(vp (4trxrmo ootfpDrln olt)s2uoir no1al nlfvi t  2urxmoot4tlxo fciyslm ul(mo u)tlxoxo iytfmtrai s s)texm(r3io4ap   nvil() 2raxmooo0aex io3tltfaDulu s;t)trtnxf3oy1fpDe ies;t tetm(mpio4om nlfcsa(f Dtru  nu0aetomfeiasls um( s u0texnxociydoaDrauvilt0teum(m3ny1lmt mfcias sDum(mp;o1oltn f3iatls2emuvo (0arerir oodfp  luei t)trxmxrpiudapen neia(farumx pnu4tpeo o3tls m2umn pn() lenif tytoa  anei t0s2toiopiydole mfetl(fa2umxmonu1oeenmocias s umuvp;u0aeenmf tatlpt  n o;t0 eumxm3oydlle  ivs t srtr( o;u0tlx  iciytlaDeln p;(4 lxoif tatlm e ieol( tetoxr nu1ale  feias  Dta(rpoo0aeenii3tysla rmnmo ()teenxr3oy1lmDrluvs t)s2trxm nodamenlfetas aDtau  nt0olto fciyd aDranvont4 rxoioctodop r ies s  2urxm3no1om  lnei t)aDua(roou1ole mo3iyt s umu s u)arxoxrctotlpD  uvilt0seuoio3ny1alt  ncslt  2trx  nt4teeomf3iatfs rmu p u4trtnmocoatopDr ivs;(0s2tmir3nu4om emivsat sDrr(r nu1opx  oeiysfm emums;u4trtnmf tadfp  lieo;t t2xmim3iodlptn nei t)s2tmxmpou4tlx  o3tltls ra(mp;(4trerif3tatlm e neo (  euo(mpnudol   fciasfaDtm(mo;u1aeeomfetadfsDuaump;t4aeenmo iodlm r nvi () rxoxrpnudal e ieil()artrxr nt0olx ioeilt a2ua(vo;(0trerxr iatfpt  nvs;s  eur(r3no4ll nmnetas)aDrmu oou1oltomi3iysla uau s t)aexomocio1oaD au i s)t2urxm no4al  mnctat sDtaxmpnt0oex mo3iatlm2rlu on()alxnir3oa1lpD lu sl(0s2umxmpny4aleelneias)a2ta(moou1tee  f3iysfsDuanvsn(4 lxnxo3to1omDeaneo t)trtr(o3iu4aptn nvilt  rurur ;t4oee ioetydfa ea(mp t4teeoxf tatlaDrai o;( t2xm(m no1lptn fesls)sDtrx p;u1tlt mi3iat aDrlnvp;t4 rtnmo tadopte i s s)sexmxo oudllenlicta() 2rrur oo0oetomi3iatfa ua(msnu4altrmociydoaDr uvo;(0 rtm(o3io1omt mfeia( aDur( ont0oetoifeiadfmDemuvs t4alxrmrciy1opDe u s;s0seurxm ou1lltnmietatfsDuaump;u0aeeniieildfmDumuvs () renxrcia1oa rlu olt)trto(o io4al elicia(fsDrm(m ;u1oexo fciadla eluvonu)aexoxfctodfa   nvs s0trxriopoudlmt lfeta()artaxrp;t4ope iociat mDumn o;()tlenmo3iydoa eaueo t seur(o no4al  mncia(f rrrx o;t4aet io3iadlm2rau pnu4 etomo3iadfatrln s t0t2trim3oo4op  lncia( s2raxmpnu0oeeomoeiad a2ranvont4 eenirctytom  aiei t)srxmxrpoy4olee ieilt  Dtru  ou1opto oetytls emnvp t0tleoio io1fp   ivs;( setrxo3iy4ome lnvs (  2tr(r oo1aexomictldlsDrlnvs;(0 rtomr tadom e u o s0setmiopiy4lp emieils)artmur oo0teenmieiytla2umu p;u)aleoio totlpD aivs s0srxmir nu4amee fet (  2rax  ;u0ape  icild s ranvsnt0alermo tatfp  anesls0 rtoim ny1omenmfvia(fs2tax  nu4aleomfciat s2uau onu)arxrmr ootfptranvs (0 rxrxm3iu1llt  feias) Dra(r oo0aeenifctad s2ea(vs;u)tlerio totfatrlivo;(  rxoio3no1al e fvsa( sDtau o;t4aetnii3ilsfa umuvs t4texrio iatfaDelnvi ()srtm(r nu1omeelfvslsfarumur no4apx micild mDul( s t0tlxrxf oo1lpte ivi;s)t2tmxo oy4ol  lfvs s) Dtrxr nt0tpe  fciasfs2eanvo;t4 rtrxociadlmDelivol()teurir3oy1am emnctatfaDurxmoou4tleomoetlsfsDua( o;t0tltnmf oatoate ieols0srtoio3iy4lltnlfvsa(fsDrau oot4tetomf3iat m rmnvp;t0 rtnio ta1lp rai slt s2tr(m ny1om e ictat sDrr(ro;o1apenmo3iadfm2ul(ms;u4texrir3oatfm eli o (0 ruoxo3nydolee fet s artmu ont0optniociasls ua(vpnt)texrxo3oydoat  ies s0 rxr(m iu1lm emivi t s2rmu  nu4apxoiicildfm uau p (4tetnif ty1opteauei;t  exoxopnu1ame mncilsfs2ua(  ;u4opeomfeils s em( s;t0aexrxo3ty1omteau i;(0 2tmio nodlmt lnctat) Dua(roou4opxn feias s2rmn s;u4tlxnmo3iotla eli i s0 exoxr3ou4om  mfct t)srurum ot1aeenmicilsfm2elnvp;t0 eeoif3oy1lpD ln i s0t2xmio io1altn fvsls srrmx  ou0oltoii3iydla ul( snu) renxo3tytomtraueo;s seur(opiodlm   fetas) 2rm(ront0olen oetatlmDel(vs u0texoxf ia1opDr i i;s) etoxr io1lp elivt tfa2rrurono1aeen o3iasls em( p;u)aetoio3iy1lat  i sls0sruoio3iodllee fcil(farta(rpoo1oet  i3iydlaDelnmo (4 reoxfcia1lpte n i (0s2xrio ny4ol nmict sfaruax pot0altnmi3tlslaDrm(mp;(0 rermr3oo1fm elieils) 2xm(r3nydome  fcias  rua(moot4aeeo feiat m2uanvp u0trenmfciadom rln o;s seur(opiy1amte ncsls srrrx  ;o0apxomociatlm umuvo;u)aetomr3io1omD anvilt0t2tmir io4op nmnvt tfa2um(rooo0tpt  fciaslmDumnmo;t4 reomocoadfaD aiei s)trxo(r3nodame  netl( srtrxroot4aee ifeiysfm2el(vs;u4 lenio oydoat  ieo s t2toxr3nydlltnlfeslt)aDtax p;u0tpeoii3iatfmDulu o;t)trtnircootoptr u ols0t2xr(opiy4lptn fcs (fsrrru  ot1apt  o3iyd mDumn s;(0 renxf oatlate nvi;() rto(rpio4lm  livsatfsDrr(rono0tlx ioeiytlm ea( s (4 ltrmrciotopt  neslt0 rtrio3ou4ll  lics () rum(moou0olenioctydla ea(vont4aleoxf3tatom ranvsl( trtmxr oodapeemneias)aDraxmonu1oeeo f3ild aDulnvs t0 rtoxfciodomDeln ils) ruo(mpoo4omtnlfesl(fsrum(r ou1teeoif3ias mDumums;u0 exomrcto1om elnvo (0s2xoxm3nudopte icil( sDum(r oo0oex iociasls2umnmpnu0 lxrir oa1omD ln i t)setrir nudamte feslt) 2um(mpnt4optn ociytfm2rmu p (0 eeoxf3tadfat luvil(0texo(r ou4lptnmnetasfsruaxmo;u4tltnifeiytls2uau s () rxrxr iy1op  lu i (0seumirpnydaltnlncsasfsrtrxrooo1oexnmoctls a rlumo;t)tltnxo ta1lpte ivi s seumiopoudole mnviltfaDur( o;t0apx mf3tasfsDeauvs (0artrir tatfaDelneo (  ruoiopiu1ope mivsatf rururp;u1apt  o3iys a ra( o t)texnxo3oodfpDr nei s0srxm(m no4ll nlieia()aDtaur oo1oee iietadlm2um( snu0 ltnxf3to1om elu s;t0 euoxr iy4lm nlnctas  rtm(mooo1aeto f3tatfa2elu sn(4 rxrif3iy1opDe nei s0 etrxo nodlm elfvsas) Drrum nu4alx  feiytla ul( o u0aexrmr oa1fmt anei t trxmxmpno4lpte nvilt) 2umxmont4oeenii3tatfaDumumo;u)arenmr oatfpDean ilt)srurxrpou4ap eliet tfa2tr(roou1tetnmoeilsla2emnvp;(4aexoxr oatoatelnvs;() eur(m oy1alenlnvs (f Dtr(ronu4apto o3ild s ulnvo;()tltoxf oytfa r ivi t trxmio3ny4ol n fviasfsDurx poo0optnifeiytfs2ea(vs;t4aeermo3tydopD  ues;s s2to(rpiu1op n fvtls  2tr(m nt1oetniietasfm ran s;t4alxniociodfmD  u ols trxoxr3io4lle lies t)sDrrurono0oeeo octyd a rln pn(4tetnxrcto1la e ieilt0srxrxm3ou4altnlfvi s)a2tm(r ot0tleomoeiasls rlnms;u)texrio tydla  li ils setr(rpnudom emicsl()srta( o;o0tlxo oeildfmDul( snt)tlerxfciytfmteluvo;t s2urio3oodome mfci t)aDuaump;u1aexoio3tys m elums (4tltrmrctadoa raues;s  exrio io1lp emfeiatf Durx  ;o1alxomoetyslmDean s t) rxnifciatlptelneslt0 rxoxo3oy4omeemnes sf rrru pot0teenmociysls2ul(msnu4tlxoif iadlatrluvils s2xrxrpoudaptn nvt t)aDur(  no4tpe mf3iyt a eauvo;t4arxoif ta1opDran ol( teurxm3iy1lmeelicsat)arur(  ot4aet  o3iys m ranvo u0tlerxrcootoa e ivi;( tetrxo3no4lmenmnvil( aDrmxmpou0ale ii3ild m2um( s;u0 rtnir3oydfpteaueolt) etmxo3iy4om nlfctl(f Dtr(  ;o0tpe iieiysfsDulumo;u0tlxnirciadlat lnesls) eumirpiu1omt  fetas)sDua( pou1tptnioeiyd m2ran p (4alenif3tydlmtrluvi (0 euoimpoodlp   feia(fsrum(rp;u4tptniieiasfaDuluvs t4aeeoxo io1om  livo;(  2xoxm ou1lpt lnvs ()sDua(ro;u0olxoiietadla2um( o;t0 rtnmociy1om   iei (  rurirpnu4lpte fcsasf 2ta( pou0opxn ictat sDel(vpnu) exrir tydfaD au i;( srur(opnodlmte icsat aDumxmpou1oet mfeildfm ran snu) leoxo3oydlptrlnvo (0texmxrpiodopt mivs (fs2tr( ont4alxoiiciyd s ul(vsnu4artnir3iydfpD auvs t)trtriopou1opeelivslsf Dum(r no4oeeomi3iys a eau pnu4trtnio3tytfm eli sl( tetoxrpno4amenmfvsltfsDtmu poo4oexo i3iasla2rl(vp;u0 eeoxf3iytlpDranesl( t2tmxm iy4ap nmictls)srra(rpou0opxomictls s umu onu) rtrircia1laDeanvsl( setmxmpoy1ale  nes s)a2umxmo;u4oltomo3iytlmDem( o t0tlenif3tadlmDelivol(0trxo(r no1lmenmfvs s) 2raumo;u0oet mocildfa2el(ms;t4areriocto1laD lnes;() euoimpiu1aleelicils)a2ra(ront1alxoifciyd aDrlnms;t) lerif totlmD  i o ()t2um(m iydlm  mneiat s2uau pou0aptnmf3tltfa2rln snt)tlenxocoadfat luei () eumio3iodolte fvi tfsruax  ot0apeniiciydfm2uln pn()teenmr3totopDeau i;t)trum(m oy1amte nvil(f rraxrpou4ole mfciltfmDranvp;t)aexrxocia1fpt  nvils0 rumir3no1lp elfci sfsDtaxmooo1teto o3tldfs umu s;u)alermfciydlp eauesl() rur(mpoydaltn fcsat a2tmxrpno0alx  ieiadfs uln pn(4 exoio tydoptr ivs;( srtrir no1ap n nei s)sDtaxm ;u1aeenifcilt aDumuvsn(0 ltrxf3ty1fp eli il(0 exrim iy4am  mfci (fs2rm(m ;t1oeen f3iydfmDuanvsn()trerxr3iodop rauvilt)sexr(o3nodlp e ics s)srtaumpoo1opeoiociyslm2em(vsnt0areriociydoa  lnvi s  rtr(rpnodlp emncs sf rtm(root1aexomf3tld aDumumpnu4 etnmf oytomDr uvil() 2urxo oy4omeemictat sDumum ;o1aetomoctld sDuau s;t) exnxfciydfate nvi ()t2to(m3iu1lpenlfvs s)aDrmur nt1oexoio3ild m rmn p t4aeermf io1lp   nesl( seuo(m nodopen fcsls)s2uaxrpnu1aet iictyd aDrm(mo (0tleriociatfm   nvo;( s2uoxrpio1lpenlnvilsf 2tru o;t4openio3tlt aDumumonu0arermoctodlmteli olt s2toxmpiy4ol elnes () 2ta(mpoo1oet  i3tys s el( p t0 etoio3iy1fm rluvi t0tetoiopiu4al  mncsl(  2umur ;t0teeniieiltfm rmnvpn() rxoxo tadomt aies (0t2trxrpou1llt micias srtaxm nt1teeomociyslmDeln p u0tlxomo iodoaD livi t0 rxmio3iodlptelfvt s) 2tmxrp;t1oetoiieildfmDean p t0aexoio3tydla  aneol(0sexmxrpny4op  mnvtl(fa2tmum nu0teto fctasfmDuanvo u4aexoif3oydfp  au o;(0 rxmxr3nydomeemics s s2taurono0alt  ieiad m ran s u)aeeoxo ia1op   uvs;t)s2to(mpnudll e nvsas) rrrxrpnu4tpxomoetyt a2rmuvo;t) rxrmf3todom e n i s)truriopiu1amtn nei (f 2urx o;u0tpt if3iytlaDuanvp;u0 rermrcio1oateaivs t)trur(r io4ll   nes tf Dumx ooo0olen oetyt m ua(vpn(4aleoxr3tydlm rai o;s seuo(r no1ale mfcsat)srra(rono0alxomf3iadlm ean pn()tleoio3iotfatrlivs s0s2tmim3iy1om nlieilt a2tr(m ;o4tet  i3ilt sDrm(vp;u0 lxrxr iotlmD anvi;t)srurxo io4lm n ivt ( srua( poo4aleo ieilsls eau o;t)texrio tadoaDelnvo;t)s2tmio iodopte nvi sfaDta( o;t0aptomfctytfaDumumsnt0 eerxr3iodfa eau o s) 2tmimpoydlmtnmivslsf Dtrumonu4ope ifciatfm ea(mo u0 ltoxr3tatlp   i i ( t2tr(o ou1lp   fvs (  Dtrxrpnu4tlxoii3tls a eanvo;t0tltrmo3iytop elues s) 2xm(m3ou4alee nviat  Durxr ;o1aexoiietatls eanvs;t) renmfcty1fat  n il(0s2xm(r3io1amenmnetlt a2um( pno4teenio3iyd a umuvp;(0 renxo ta1fmDr u o;s  2tmir iodlme mietl(faDur(rpnt4teeo i3iltls rmu p u4aexomf iadlpDeau i;s0srtr(m ny4op nlietls)a2ra( oou1ole ifeiysfs uln onu0 rermo io1oate ieo t  rur(mpnydameemnvs (f Dtm(rpou1tpeniictytfa rmnvp;u4trxnxr3oo1fmD aivi () rxmimpiydal   nvtasfarrm(rpnt0oex mieiadfaDuanvp;t)texrxf3iytopDraneo t)teto(r3oudome lfetl(  Dua( pnt4altn fetydfm uau snt0texomo iytfm rli i;(0 exr(opno4oltnlicta()srtmumono1aet iiciydfaDuauvont)tleoif3oatom eau s s0 euoir3iodopeemfvsls)s2rru pno0tlenif3iysls um(mp u4 rxrmrcoa1opDe iei;t0s2umxr iydom  liei sfaDta(rpot4aptn ieiys s2ulnms (4trenmo3totla  livs;s) rtriopou1omenmfeia(faDraur no0apxn octltls ra(mp t0tltoio totlmDe n il(0 2xr(opiydamenlict (fs2raum nu1aleoioeiys mDuan p;u0trtrmfctytfaDe nes t0srtmio oo4ope mncilt) rtmu pnt1apenmictlsla el(mo;()tleoxf ootlaD  n s;t  2uoirpno4om e ivtl( a2urur nt1opxoifctysla2uanms;t)trerio3iytlpteaivs t)s2xoim3nu1omt mivtl(f Dta(ront1apx iieilsfs rm(mpn()arenio oodopDrli ilt) 2uoxmpno4lm nlfcsat)sDtru p;o0aexoii3iadfm eaumo;(0 rxrxf iatlm r n sls srtr(mpoy1am elieslt)srrmurooo4ale  oeiadfm eauvs t4tlxnircoodoa rliei;s) etrxo nodaptelics s aDra(  oo0alt ifctytlsDrm(mpnu0texrir ty1fmDelivs;()sexrxmpio4ol nmivt (farur(mo;o4aex  fctatfa2ea(vo;t0 rerxr3tatfmD lies (  etoxmpiu4ap   fctatfaDrru ooo1oeen o3iltlmDra(vp () rxoxo3ta1fatr uvo;t trxm(mpiu1om nmnvsl(f 2uaur no1ale moeild s rluvpnt4trtnxr todfpteai s;s0trxmxr iodalt mneiat)a2urur ;u1tlt ioeilsla em( on() etnmf3oytoa  lnes;t0seumxr oo1opte feia()aDrau pot1tptomfeiadla2em( o;t)texoif tytomDr n o;s0sexrio io4aleelict tf rrax onu1aleomfciatlm ulump u) rerxo iodfpt lues t0 rum(mpiy1op e feiasf rta(mooo1oet  oeiasfm ean s u0 lxoifcootlpDeli s t trurir nu1ll n net s s2um(roou0oet moctlsla2rau snt4 renio iodopD  ieil(0trxrimpio4om  mfcs s  Drruroou4alen fciatlm ulu o (4tltrxocoadlmtr n ols)s2trim3nodapt mietat s2rmumono4tlxo fctlt sDel( o u0altoirctatlmteaieo ( t2trio3oo1olen nvil()artaxmp;u1apxo ociytfa2ra( p (4tetnxo3iotfat  ues;( t2urxopiy1alee fvilt) Drrx o;u4tptoifcils mDrm( s;u4alxnir3io1op rli ol()srurxopoudol nlfciasf Dra( ooo0tptnmiciaslaDrmums;t4artomf3oytlatelnvolt0texoir3io4lpeemncsas)sDuru  ot4opxnif3tys s2ulnmont) lxrifcoy1oatrln ilt0setrxm iodap   nesatfs2rr(m no1apxo octysfm2eanmo;u4texnxr ty1lp   nei s0teumxo3iu4altemnei (fa2urxroou0alxniieiadlaDelu p u0alxrir3todlpDe iei;()sexr(o3iodope  nvtlt artrxmonu1opxo ocilsfaDra( s (0 lenmr tytop  luvi;s0s2xm(o io4lleemieiat)aDumxmp;o4apeo ieildla2emnvo;(4alxoxr iytoa rliei t0trumimpno1om   ivi t aDua(ro;t1oex  ictltfaDeanvp t)trtnmf tatlpDrlu o;(0 exoio3nu1lpe lnvtlt  Duaumo;u0tpxomi3tas sDumnmo;(0aeenxr3ia1fmt aneo;s)srxmxm iy4al  mncias)s2tmurpoo0aee mi3ilsfs2rln snt0 etrxociatfaDeluei;()setm(o ou4alt licil() 2rmx p;u1opt miciltfm rl( p;(0alerir to1oa  liei;s0t2xoio3iodoptn ietlsf 2ra(rono4oleoifciasla em( sn(0arxomf tytlpDe ies t0 rurim3iodale lnctlt srtr(m nt0tlt io3tld s ranms;t4arxrmrcia1omt  uvi s)truo(r3no4om emncsasfaDua(rpno0apeo ociaslaDumu s t4alxnxr3iytlpD  neo (0 euoir3oy1lm n ncilsf Dtr(r nt1tlx  f3ilsfs2uanvsn(0treomrciadoaDean ils0texoxmpio4lp nmies ( srtaxrooo0tetomiciytlm ea(mp t)aetomo oa1lptraivols s2toio iydlp   fei ()aDtmxrpoo1tlenmi3ildfs emn sn(4tlxrmrcoadoa raies t0s2toxm ou4olen fes s aDtm(  ;o4olxn feiadlsDul(vsn(4texnmr tydfpDr ivil()t2umiopiydlmtnlfviat s2rmxm ;o4alen o3iasfm2elnvo u0 etoxo oydfaD luei;s)srtr(o3iu1ll emnvslt artaumoot1olxn feils m umuvsnu0arenxr3tydfm r uvi;t  etrim ny1al elietltf rrruroou4tlxn i3tadfm2um(vo;(0trtnxo oodom rlieilt)s2urir3iu1omeelfvt s a2rm(mo;t1tetnmicias aDemu pnu0aexoxfcta1omD ai i s seurxr oodamenmfvilsf 2tmur no4tpeomo3tas m2eanms t)aexnmr3iatlmt li i s  2tmir3nu4apt lici (  Dtrump;o4tlen feiltfa2umumonu4 rxnio3oodlmt livi;t texmxopoodopt lfci sf 2uaxm ot1aleniictlsfa umumpn(4arxomr3oo1lp   nvol( srurim3nu4lp  mfei s)aDrr(roou1olen icias s rmn ont4altnir totlaDeaneol( texm(o3no1apeemfvt ( sDrrxront1altomoetlsfa2uanvsnt4 rxrxf3iytoaDeaiei;t0sruo(rpio1opt livtlt) 2rr(ro;t4tptoiiciyt mDrmuvo u4 lxoircootopt aieo s0 2xrxmpou4oleemicsat)sDta(mp;o4altoiieiatfsDua(mp t4 lxrmf to1oat  ueo;t t2xmxopnodamen ietltf rtaxrpno0oeto ietys a2ulnmsnu)trtoircoodlp elies;t0 rumxo oy1ol  mieslt aDrrxm ;o1alxo ietytfs eluvonu)texoxr3ootfat  uvs;()s2trxm3ny4lmenmiet (  2taur nt0ale  o3iltla um(ms u4tlxrxfctadoaD aivo;t0tetrxm iodop nmfcsa(f Dum(mo;t1alxnmocilslsDrm( ont)artoxr iotfp e uvi s) exmiopio4ol n icsas)aDua(m ;t4oetomoetadlmDranms t0aexoxf iadfp rli slt)s2xmxr3oo4lmtnlfesl()a2tm(  oo1olx  fetas m rm( o (0 lerio3oytomtean ils srtoxo3oy4op  lnctatfs2umu o;u0alxoifcilslmDeaumo (0tetriociotlaDelueo s0 rtm(o iu1lm n feias aDtr(m ;o1opx mieiasls ulu p t4trxomociatoaDraues;s)tetoxm io4ame  fei t)artmurpot4tlxnifciyd m2ulnms () rxnmo iatopDrauvi () 2xoio no1opt  neilt) 2tax o;t1tpt iociadfaDemuvpnt0tetrir oodop r ues;s)trxm(r3iu4llenmfci s)s2rmxmpnu0apenmociys aDuauvpn()tlenmr tatfmD  ivols0setmxopoo4om nlivi tf 2raur ;u4aptoiiciatlmDeluvo t)tetrmr3iatlpDranvsls trumio nu1om emfvilt  Draxmont4tlenmi3iad aDulnms;u4tltnxo iadfmDr i olt) exm(opoo4lp emnct t)srumxr ot4tpe  ieiyd aDra(mo t)aetoxr3iydoaDrln s t) 2toxmpoudale lfciatfarrr(m ;u0olenmicias s eanms;() lxomr3iotfpt lieol( sexrxr io4lptelncsat)sDtaxmo;u1aptn feiaslmDel(monu) rxoio todom r ivs s0texo(o iy4llt mneta( sDrrxr ;u4apeoiietasfs ea(mont4trenir iytfat  nei ( s2uo(rpoydlp nlfesat sDtmu  nu0aetn oeilsla elnvo u0 etomrcoy1laDe neils0sruo(opnu1oltnlfctltf rrrxrpnt1alxnmi3tltfm ra( onu4aexomo3tytfat  i s;t srtmimpoudol nlnesas sDuax ono4oeeomi3ilslm elu o t)tlerxo3iatfmte ivi s0 2xoxr oydlptnmfvt t s2taxront0alx  iciltfaDrl(ms;u)trxrircootfm   uei;s)texoxmpnu4al n fciasf rtrxmoot4aeenmieiyd sDulumsn(0 ltrxr3tytop r uvs;()seto(m no1amen icia( s2um( ont1altnii3ias a2eanvs;t4aeenxf3iytfpD luvo s t2toxm3iy1olt lics s)arrru poo1tlt  ocildfsDemumsnu0 rxnmr tydlp e nvsls)seurio3io1am nmfviatfsDrax pnu0tlt moctltls2eaump u0 reoif3todfmtrli o;t tetmxopoodlmt lnvils srrau pnu1olxoiictld sDrlnmo u4trtrir iytfatelneol(  etmxopny4ol emfvs ()s2rmx o;t4aee mf3tldlsDumn p;(0trenxo3totla e nvils)srtmio3no4amtemneil()a2rax p;u4teto fctlsla2ulnms;t0altriociatlmDrli o ()seum(m iy1optnmfeia() rtr(r nt1altnmocils mDemumpnu0arxomrcootlpD  i ils0sexoxmpoo1ame livsls  2rmur no4tpxn ocias a eln o;u)tlxomfctadfpt  uvol( srxo(r iydoptnlnetl(f 2ururpou4olxnmocils m2emnvon() eeomr ootlaDelnvs t)t2to(r oydoptnmfei s arumur ;o0aeen ieiytfaDemu pnt)artnif oytlatr nvs s0teuo(opiu4ll e fcta()a2ua(mpnu0oeen i3tls sDrmn pnu) etrmf3oo1fmt  i s;t0t2trxr3no1lm elnesas)a2tm(r nt0oet  i3tyt m2el( snu0altomo iytlptelu ils s2to(opno1al elivs sf Dra( ont4olt mo3iltla2emuvs t0 exrmr tytfm rlues;s0tetrxo no4ol  mfciat aDtrumoou4ole ifciltlm rl(mo;t) exnxo3iotoptr n ilt0seum(m iy4lptnmfetltfsrrrur oo1olto f3iyd sDulu pn(0trxoio3oo1fmDeauesls  rxmim3iy1op emnvt s  rraurpno4aee  ieiydfaDumums;t4trenio3ty1fm rlu s t)tetmio iu1lmte feiatfarrrur ;u0aptoifciys aDeln p t0alxomr iytlpD  n i;s0trxm(rpiy4ol   ietls)s2uax pnt1ale io3tltlmDuluvs (0 etnxfcoy1fpDelnvi t trxmimpiydlleemnvi tfsDrmx  ;u0aee mo3tyd m emnmon() ltrxf oydomDeau il()seto(mpio1ll  lfvsa( aDra( oot0aexnmociyslm2em( s t0trtnmo3oatfaDeluvo;() exrir3ou1oltelnvi s  2tr(ronu1oltn o3iydla ulnvp t0 eermo3oatoaDeluvs t t2uoxo3ny4ap nmfvtlsfa2rrum nt1oexn i3taslm2rln pnt0teermf3ty1opDeaneols s2xm(m ou4lmen fcilt)artmumonu0ole mi3ias mDrmu sn(0arerif3tatfm rli i s) rxo(m3nydlmee fesl() Dumu ont0altoioeiltlsDel( pn(0alxrmrciodfa e i s t srtr(r io1apt mnvtat)s2ta(m ot1texnmfeiydlm elu ont)aeenxf oo1lmDranvo;( s2tr(o3iudole  icta(f rtmu p;t1aleoifciydlm2rmumon(4 leniocoodop   ivi;s setrim3oo4lmtemivsa(fsrrmxmo;t0opt mf3iysls2el(vs (4tleoif3tydoat anesl(0seuriopiu4altn ivsas)artru oot4teeomieiasfaDrm( s u)tetoir oadfp eaneols  rurxo iy1lpeelict ( arraurp;t4olto i3iysfm2rmn snt) ltomocoodlp e uvi t)seuo(r nudap  lfetltfa2urumooo0oleoiictadlmDul(mpnt)trenmrcoadlpD  nvo;(0 exrxopiu1ale  ivt s s2rm( ooo1opt  ocild s el(ms;t)texoifcty1fpD lu o s)seurxr no1om e fvsls a2taum ;o0tetoioeilt s2ua(mo (4trxomoctatfpDraueol(0 2to(mpou1llee ncsas  Dtmx  ;t4openiocildfsDem(vs;u0tlxrmf oytlp eanei s0teto(o iu1am  mfcs (fs2rmu o;t0ape mf3ils a2el(vpn(0aleomr tadlptrai i;t trxr(o iy1lpt lieia() rumx  nu1tptn fetltfm rm( s u0alenmo3ootlmDe ivol() 2uo(m io4olt  feils  2tr(r ou4tleomfciltla2rl(mon(4aeenif3io1oa r iesl( t2to(m oy1oltnlfctltfa2rrxroou4tpenmiciyslm2rlump (0aetnxr3oytopDeln o;()t2tr(m3iy1aptelnvtasfa2umx pot4teeoio3tldla ua(ms t) rerir totfpt aneo t)srxr(o3iu1lmeemnctlt)aDuax  ;t4oetomfetls aDemuvonu)aexnxocoadfp r u s;s)srtoirpoodlptnmfet s  2rmxr ou4olx mfeiasla um( snu0 lxomr3oa1faDelnvo t setrirpoodlmen neiasfarur(mpnu4ale mfeiydla2ua( pn(0trxnmfciotlmtrluvo s s2xoimpoo4amtnmfctlt  2uax pnu1tpx  o3iytfs2eaums;(4treoiociadfmDeln i;(  exrio oydape lietls s2taxmont1tlt mictadfm rl( o u0 reomr iotfmDean s (0 exrim3iodlltnmivsa(f Dumx ooo4apxomicilsfm emn pn()tetrmo tydlpt an s t0s2trxo3oydlm  lfcsl(farua(mpot0tpenif3tatfaDum(vp;t)altomociytoate ueo t s2uoir nodome livi (fsrrauro;t0opxn fetatfa2uaumpnu4tetomfciydopteln o s  2tmxm3io1ape lfctl(fsDtrxm ot0oltnifeiasls2ulump;()texoxr iadlpDrlu ilt srur(mpiy1lme  fctls)srra(mpou0tex iieiytls ulnvp u)trermf3oo1lptrlu il( teumxo ny4ol   nvilt)aDraump;t0apxo feiatlm2uluvo;u) rxoircty1fp eaies s)s2xo(r ou4llen fctlt sDtrx oot4aeen ieiadfm2rm( p ()tltnxr oydlm rln olt0s2xo(m oy1lme  fvtlsf 2umxr oo4tpto feiatfs2rmnmpn(0artrmo3tydopD au s s s2toim3nydllt mfctl( aDtru poo1oet  o3tydfs emnvpnt4arxomrciadlp ean ols) rxm(r io4omenlfesl(faDum(monu4oetnmietltlm ea(vp u0aetnxfciatfp rai ols) rtm(m3ou4apenlfcsatf rrmx pou1alenmfciatlsDem(vp;(4tetrxo iadfp eaies;(  2um(rpny4apt mfct t sDum( ono4alxn oeiat a rln p u0tltoio oo1la rai ol()s2tmim ny4oltnmfesl( arurxro;o1tee ifciyslsDea( pn(4arxriocoodop   uvi t0setoxm3iodlmtelfesa()aDtmx oot4opt mi3ilsfmDemu pnt0aexnirctodfp elnei ( truo(rpno4lmee ivi s aruau p;t0oltn ictysla el( s (4teermo3iatomteln o t)sruo(o3nodom nlfcsas s2trumo;u0aleoioeiltlaDelu s;(0 rxoio3oatfpD  ivi () exrir3oodamenmicilt s2urx p;o0opt ii3ildfm2eau o;t)alxrxrcia1fp rai i ( s2xrxr oo4oleelfvtatfs2rm(  ou0opeo ocias a eaumpnt4 etoxocoatfaD  uei;t)teumirpiydllenlfeia(fs2tr( pno4alenmo3tydfm rluvsn(4 eenxfcoytopteaueslt  eurxopoydlp n ieias sDtr(r nt4tptoii3tys a el(mo;t)trxnif3tydopDr iesl()srtoxr io4lmen fctatfsruaxm ot0alen i3iatfsDel(vs (0 rxrxr3to1latrln i;s seto(m3oodlp nlneil(fsrtm(ro;t4tlxo i3tyslsDea( o t0trtoir ty1lmDeluvslt) 2to(r3io1al n ictl(fsrrax oou4oexniicild s2uauvsn(0 ltnxo3ta1lmDeluei;t0trumxm oo4olenlfvs tfs2tr(mpno1texn f3iad m2ua(von(0 exrxf3oadlm raivils  rxmxm iu4lmtnlfeiat)s2rrxmpnu0aleoio3iytls ulnms;()trtomocootlpD lu il()s2xoirpoydll  mivia(f 2trxrpot1tlxomicias s2rau p t4tlxrmo3ty1oa e uvils0srtrxr ou4ol n ivta( artr( pnt1ole iietyd m ranmp u0 lxrxr3iodopDr ieilt)t2triopoo1llt micsas) rur( ooo0aptnmo3tldlmDrl( p;t4aetriocty1optrlnvo;(0texmxo3nudlmtemfcsl( sDur(mono0oeen fctyslm2uau onu0tetnmo3to1fptraneo;s)srtoir3nydomt  ncil() 2trxmpou4aexo fcild m rluvo t)tlxrxfciy1lmtranei s s2uoxrpoo1amtnlieiatfsrtaxro;u4tpenmfeiat m2emu p (0aexomociytfaD ai i ()t2trir nu4altnlfetls) 2ta(rpnu0aee ifciadfs umn p u0arenifcto1opD luvs (  2xmxm nodam  mfet sfa2taxr nu1olxomo3iltlm rm( s;(0arerxocootlmD  u i;( t2tm(o3nu4open iei tfarumumooo1tex ioeiysfs rl(mpn(0 ltnxo3oy1fp e nvs s) rtrxrpnu4optnmfesa(fsrtm(m nt4tpenmi3tysfm2um(vo u0 reoircio1op  au ol( t2umxo ny4openmicias  rrax  nt4tpeoifetlt a em( o t4arenmocty1laD lneo t)tetoxm nudole lnetas srua(m ot4tet  f3iasls2el(mo () etnxociodoaDrli ol( srxrio nodop emnvt tfa2tmur no1olenmf3iatla2el(vs;t0 rtrmf3iydfateanvo;(0sexm(mpoo4am  licias)a2rmurooo0aptn fetasfa2elu s;t4texniociatlaD  ivol( tetrim3ou4lme  nctat sDrrx onu4tetnii3tltls rmnvsnu0trerir3oodfpDranes;t) rxoxopoy4llt  fesa(fs2tr(  oo0oetniictys aDelumon()arxnio3oo1lpD  i i t srurxm3nudap nmnesa( a2ta( p;o4opt  octasfaDraump;(0aeeoir3ta1opDrai o t) exm(r oy1ap elictlsfs2umxrp;u0tleo oeilt s2ranmsnu)aetoxfciotfmtrln slt0srtm(o iy1lp   ncsl() rta(r ot4tee ifciyslm rl( p u4trxrir3ta1fa elnvo;(0trxoxmpnu4lltemfet s aDtax p;u1apxnif3tad s em(mo;t4 ltrxf ty1opDranvs;( seurxopoo4openlieilt s2tru  ou0altoif3tltla ea( s;t)trxnxo3oydlm   ues t) rur(opiydapenmiei (faDrrxmpno0oleoiiciydlsDrauvpnu0teeoxrciatom  auei;t0 eumxmpiy4ap nlfvtlt artrx ono0tlxn ieiys a2el(vsnt0 reoio tydlpD aneslt srxriopoy4aptnmivsl(fs2raum nu4tex  fctytfaDuanmonu0teerio ty1opDrauvs;s0 eumxr nodll n nci s)a2rruroot0olx mi3iydls2eanms u)texnio3iatfa  au s;s  2umxmpno1ale  fvtlsfa2tmurooo1teto icildfs2eauvs (4trxnmr to1op   ieo t  eurxo oudaltn ieilsfsrrmuroot1tlxnif3iatfa rlnvsnt4tetrir3oodfm  aivs s) 2xm(mpoodop emivtls sDtm(monu4tlto ieiadfa2elnmont)altnxo3iotopDr nvi;(0s2toim3io1op nmfvt t  Dtrx onu0oeeomfctltls umu pnu) eenxr3iy1lm r n i s0truo(m3iu4ol nmfcsas  Dtrurp;u1alxnmf3tadlmDrl(ms;(4tlxnmoctotfm eauei s trxmxmpoy1lm n nvs sf Dta( p;u4tpxomo3ild a2uan o u)alxrmo tytoate ivslt trxmimpiu4op  lnvil(  Dum( o;t0apxoifeiydlsDemuvsnt)arxoircoydlaD  nvs s0srur(m3io4lpen fvi s) rua(mont0aexnmo3tas a um(mp;t) lxnio3iadfaDr uvs;s0t2uo(r3iu4op e fes ( aDtau  ;t4apt mieias s umu pn()alxrif oa1lmDelnvo s0 exr(r iydlmt mfeta( sDrrum ot0tltoiicias sDem(vont) rtnio iodlatrau s s0s2urir3no4alt livtasfs2umu  nt0opt  fcils s2emnms;t)aexoxrciydomDelivols0srtrxm3io1lle  fct s  Dtaxmo;u4altn ictysfs emn pnu)tltoir iytopteli o;t)trtr(opoydlme lnctl(fa2tax pnt0aetnmi3tlsfs rlnvpnu)alerir3iadfpD  ueo;( srto(o ou1ap  miviltfaDrm(monu0olx  o3ild s umuvo u4aeenxfcoo1lm  lnvsls)teumxr oudlpte nvsls)a2trxmonu0aeeo feiltfmDuanmp;u0aeermfciy1oaDe uvi t) exrir3ny4ap  lfctls)aDtmx  ;o4texo oeilsfs eanmo t)tetrxfcia1op r i sl()t2uoxrpnu4ol elict sfaDtm(rpou1aex mietatfsDuan onu4teeoirctadfp e n s;s  2tmxr3oy4ole livi ()sDrmum ;t0olt mictaslmDemnvp ()tleoircoo1lm eaieo t0 rxrxrpou1lmtnmnvsl(fs2rm(m nu4teeoiociys s2eauvp;(4texrmf tatfp  ai i;t) eum(r3nydal n ncil(fa2ta(mpoo4oeeoii3tatfs eaumo ()tltoxo ta1faDr u sl()t2umxr3ou1am e fvsat  2rau  ot0olxniociydfm rau o;(0 eeomf tydfa raieo (0 exmirpiu1ame  nesl( sruru  ot0oltniieiysfa2umu p;(4 etnmoctydlm eauvo s) rtrxo3ou1oltnlieia(  Dua(rp;u1oltnifciaslm rl(monu4tlermo iatop  lnes (0t2um(rpnudam nlictlt  Durx  ;u4olx ioetydfmDra(ms (0teerioctadfaD  ivi;t  exo(opoudllt  ncs s sDtrxm ;o0olxnioetldfa ul(vs t0aetnmfctadlp r ivs;s trumxm3io4apeeliciat sDtaump;u1tpt  i3tadlm rlumo u4 lermo ta1lmtran i;t  2xr(opno1ol   nesat  rurumpoo1oex mfciytfm emuvp;t4trtoio3todlpt  n olt  ruoxmpou1op emietl() 2rruro;o1alt  i3tysfmDrmu s;(4aeenirctotfpDeau i t0s2uo(m3iodlmt mivsl()sDrrxm ;u4tetniieiatla ra( p t) reoifctotopDelnvils  exrir3iodlpte nvsa(fs2taxrp;t1aexnifetatlm2elump;u)arerirciodfa e neol() euoxrpio1am n ivsa( artrxmp;t1oex io3iytfm rluvo;()trxnif3oy1opDelnvi s0setoim no4omtelfctls  2trum ;o0oee mfetaslm uanmon(4 reoiocto1fmDr nvs t)t2xr(r iudop elfciatf rtaxr ;o0opeoioeildfm2rlnvon(0 eeoir3ta1fat  neilt  ruoimpiy1aptemicia(  Durxmp;t4tptoii3iatfsDrmn o (0 exnifcio1oa ran s t0trtmim nu4op n ieiltf 2rr(mpot4opt mo3ilsfm2uln snu) reoxr3ty1laDr nei t  rtmxrpnudam emieslsfsrurxmono1tlxn fciaslm2uanvsnt0arxriociatlaDeaies;( trxoimpiy4alenlnes tf Dtmx ont1apt mocildlm2rlnmo t0 etrir todfm  aivs;s  ruoxr3oydaptn fvi sfsrraxmp;o1alxomoeiytlm2ranmp u)arxomr3ta1fmD aies;s) 2uo(rpoo4lltn ietasfs2trumont0oexn feild m uluvs;t4alxrir io1fmDr u i;s) 2umio3iydlm elicilt) rumxmp;u1aleo ieilt s eau pn(4 lxrmf oy1fp  aueo s0srtoirpnudlpee nctl(  Drrxrpnu1aet mociltfa ean o (0artnifcoydoptelieo;s0t2xo(r oydame  ict ( arrax  oo0alxoio3iadfs uln on() etoxf3oytomte nes;()t2urirpno1altemnei t)sruau o;o4aet mf3tys a2emu s;(4 ltoxf3todlmDrai i ( s2xmxmpiy1amee fvia( sDuru p;t4tltnmictad m2elu p (0 rtomf3oa1omDeaivsls0 euo(opiy4lmt  icias srrrum ;t0teeomoctlsls umu s t0trtoirctatlp  ai s;( t2urim iy1lpe mfcsls sDrmur ;t4apxo f3tys mDemump;()trtnir oo1fpD  ueo;( t2xm(opnodamee nvsa( srrm( pnt1opx  fctysls rl(msnt)aleomf oadla rliei s) etoxm3oodale mnetlt) Durxm ot4tetomiciytlm uau o ()tlenxo oo1lptrlu ols setmirpoy4omt mnesls)s2ur(r ;u0tltn feils mDumn s;u4aeeomf oo1lpDeaieo (0trtrio3ou4al nlnctl() 2taurooo0opxn ociys m uan o;(0aexnmfctadom elnesls0t2tmxr3oodalte ncs s  rtru p;t1oex mo3ils mDeau pnu4tetoxfctatlmDe n i;() 2uo(o nu1omt mictlsfsDrmxr no4apt if3iasfa rlnmsn()trtomo iadfmtr ivo s)t2toxm3io1al  miet tfaDuaxmpoo1oleniietat s rmuvonu4 rtrio3to1opDrluvs;s)s2tr(r nu4olee ict t)srrrxrpnu4opxnmo3ildfa2uanvonu) lxrif3iytoa   ivi t t2trir iu4ap elnvtltfsrtrx o;u4alxn ietyslm ea(ms ()texnirciodfptrli i;t0tetoxo3oodap nlnvsa(  Draum ;t0olx  ieiyslm eluvs;u4teeoio tydlmDrauvo;(0 2trim3iudomenlnctls srrr(  oo1oexo ocildlm em(vonu) rxrif3tydlmtraies;s)texmiopou1ap elivslt aDrmur ;t1opx iiciadfaDrlumonu0 lerxr3totoaDr ieilt  exoxo ou1ole  fctlsfsDrmxro;o0tex  iciatls elnmsnt) etrxf totomDelnvsl() rumxopnu1llenlfeil( a2taumo;u0olxoifetys mDua(mp t4trxrio ty1fpteliei;s s2tm(r iy1lp   fet s s2taumo;u4tetnioetasfa2umn o;u) rxrmf3iy1fpt ai o;t0texrio3oudlmtnlfetl() Dua(mont0tpeo oetysla elu s;t4 lxoir3oodlmDr uvs;t s2trio iy4apee fetlt)sDua(mpno4alx  fciytlm2rl(vp;(4trtrmf3totom elu i;s seuoim nodomt mivi t sDtmx  ;o4aee mfeiydfs2ra(mp ()altoxf3iodomt  i o ( t2urxm iu4lpe lici s srua( o;o1alxn i3tat aDraump ()treniocoytomtrau i;(  2tmio3oydomenlnvtlt) 2uau  nt1oleoioeiat m rm( s t4aexoxr io1fmDrau ols0truoim ou1omeelfcs t) Dtruronu1texnmi3iasfsDulnvs;t) lxnxrcta1fat  n o (  rtr(m3io4lmtn nctlt)s2raurp;u0oeen ietys a2rmu o;u0texnio oo1fm eau slt0sexr(o nu1opeelncsls)s2ta(m oo0ole mf3ildfmDul(mp u)areoio ta1om r uvs;()teurxr oydam nmfeiltf 2tr(  ;u1tpen fetadfs rl(monu4aeeomf3tytlm  auvsls0 rxmimpnydam  mfvta( aDuaur ;t1ope  oeiasfa2eanvpn(4altoifcto1opD anei;(0 2trxmpiy1lpte fcsa(farumxmonu0tlt  ictas s2umuvp t)tltrmo3iydla elneolt s2to(m3ny4ap   ietltf Drm(m ot1olt mf3tltlm2em(vpnt0trtrio tydfmDeln s t  2toxr no1optnmnvil(fsDtaum nt1tlto f3tysfa2eluvs u0texrxf ta1oaDr nvsl() exrirpoo4amt lics t)aDumx  ;t0aleo oeiad s2uanvonu4aexoio3iy1fptraueolt trtrxmpno1opt mietl(fa2rauront0opxnmf3iaslm umn p u)alxoxrcoytopt  uvi;t sexriopiy1alenlnci s  2rr(mp;t0optnif3tadfsDraumpn(0tlxnxo3tytfm   uvi t0seuoirpny1ol nmfeslt  rtruro;u1tlen o3iadlmDrl(vp;t)aetrmr oa1opDelivo;()s2xmxm ny4optn ivils a2tm(m ;o0tlxnif3tldfmDrau snt)trtoxfctydla  lues s  rxrxo iydopee iesl() Dra(rpou0alenifctasfs2umnmo;u4 reriociadoa rluei;t) rxmio3oodll   neia(fsDumx  oo1ole ii3iasfa eluvp;u4aexrmo oydfm eauvo (  2xoxr nydll n ictlsf 2tmx ooo1oee miciltls ra(vsn(4altnircoa1oa e nvi;s  etr(r3iu4ome lfei () Dtm(r nu1ape ioeiyt s elumon(4 ltoircoa1oaD  uvo;(0 eumxo oo1al   nvi sfs2ra(mp;u1tle  fetydlm ea(vp t4alenxf iadlmDrluvolt0s2umxmpiudlmteliet (  Drrxr ;u0oeen octad a2emnvp u4 exrircoydoatraues;t)sexm(o oy4omenlnes s)a2taxr nt1apxnifeilslsDranvp (0 renxr oy1omt anvsl()teuo(r oydll emnvia(fsruax oot4aetn ietldfmDrmnvp t) etoio3ootop raueolt  rurxrpiodalenmfcta( sDrm(r ;u1teeo oeildlm2uanvs;()trenio3oy1op r uei;(0texriopoydlltn iesl()a2ur(r ;o4tpenii3iadlaDrluvpn() rtrmo3tatoa rluvilt teumxm io4al  licilt)s2uax pno1tlx  o3tytlm elnvo;(0trtoxf tadop r nei;(0t2xoir iodlmeemfetls aDuax  oo1aex io3tlsfsDuau pn(0 eenxf ta1lmDrli i s) rtrimpiu4lmtnmivs t sDrm(r nu0oex ioeilt m emn p;t) lenxr todlm rauvi ()teuoxrpoodol nlfvils  2tauro;u0altoii3ias s ra( pnt0trenxo oodoat aues s seur(mpiodlm  mfeil() 2rrxrpou0apxn oeiat s rmu s u0 rxrmr tadlm  au i;s0 exm(r3nodapt  fciatf Durx oou1opeomi3ildfa ranms (0teerio3iotopt  uvo;( srxmim3oy1llen fcsa(fsrumx  ;t0open i3iytla uluvo ()tlxoxociy1latrauvo;s sruoiopiudam  mivsl(f 2raurpoo4tpxnmi3ildfsDumu on(0alxriocoy1fpD lu i;(0texrxrpiu4om  mivs s  Drmurp;t0tex ii3tas a2ulnvp u4 rtrmr3tydlpD lu s ()trxr(r3ny4ome mfei (f rta( o;u4oetnmi3iytfa2el(vs;t)artnio iydfa e ues;s  etr(opiy1op  mfet (  Drmu oot4aexnioeiatla uan on(0texoir iytlp elieo;s sexm(r3iy1amtnlfcsl() 2tmurono0aexo icilt m2rm(mo t)trtoxrciydoptr ueols)tetr(r iy1amt mivtasfsDrrxm nt4tpx ifciad a2rm(mpnu)alxnio3tydomDr i i (0 rxrxm3ou1ap n neta(  Dua(rpnu4olxnmoeilslsDra( o ()treoxo tydomDean i t tetoim3ny4lmeemfvias  2rr(  oo4tlxomocilsfm2rluvs;(0alxomf oadla   n o;t texr(o3no1am  licils arraxrooo0ope ioeilt mDraumo;u0trenxo3to1fmt lnvi;(0 2tmxopio4llt lnvt ( aDumxmpnu0open fciadlmDemnvo u) rtoxfcto1oaDr neol(0trtr(r3ny1aleelncil(fa2trxrpoo0alen feilt s el(ms t) rtnmo3oo1faD aneo (0tetmim ny1op emnet s) 2ua(ro;o1alenioeildfm elnvo;u)texrxfciadfm   ueo;t0seum(opnydomtn fciatf rtaxrpnu0aexniiciatfs2ra(mpnu0aexoxocoydfpD livo ( s2xmio3nydomt  fcslsfsDrmu p;u0tptnmieiat m2uanmonu0trtrmfcoy1lm  aneo ( trxo(rpny4apt mieslt)artru p;o0apeoif3iyt m uluvp;()tlxoio3iy1fmDrlnei;()teuo(o3oo4lltemfet (fsDur(  ;u4tee mfctytlsDuauvs;()tlxoir3oodfpD lueo t0tetm(rpio1omtelfvt s)sDrmxr no0alxnii3ildfm2elu o (4aeenirctotfa ean ilt trtm(m3ou4amtemnetltfa2taxr nu1apxo f3iltfm rmn pn(4 etoifciadfpte i i s) rurxr3oudlp  mivtltfaDtrxmoou4tpxnmicils m2ua(mp;u4 leoif3ia1op eluei s) 2xrim no4ame  nvsat srumxront4teenmiciad s2uanvsn(4 reoxf3oadom  anvs;(0t2trxm ou4ame lfcsat  2tmum no0tlx mietydlm2em(mont0tlxnmf tatfmte i il( srtrir3iy4lp  lnvt s sDrmx pnu1teeo f3iltfa ulumo (0 reoio3oytom  lieo;t0trumio oo4lle mieil()arrm(m ;t1olx mieiaslmDemu o t) etrxf tytlpt lnvs;t) rur(m ou4ap  lncsatfs2tax poo0tle mi3tyd m2ulu p t4alermfciydomtrlieo ()s2xoio ny4apt  nctat)sDtru p;o1tptoiiciadlmDumn o;t)teeriociotfmtr nesl( srxmxrpoo1ap   nei s)a2tr( pou4tptoiicildls2ean o u0texrxr3ia1optraneslt) 2xoio3iy1am   fvils  rtrxro;u1tptnmo3iyslsDeau onu0arxnmf iadfmtrau o t  2uoirpou4llee fvt tfsrtmxro;u0apt  oeiyd a2el(vs (4trerifciotoaDeln o t0setm(r3nudlpe mfcil(fs2rmumpoo4olxoio3iys s2umuvp;t)tltrxoctotomDe i s t) 2xmxrpoy1lmt  feta(f 2umx ooo1aptn f3iys s2em(ms u)aexrioctadlm rai s;()srtoiopiu4amtn net ( sDumxr ot0texo ociys m2eluvpnu4alxrxfctotlatelu i;(0 ruoxo3ou1ol  lfvt t)aDtmx onu0tpxoio3iaslm rln s u) ltoxf3iydla rli i (  rum(r3iodomeelnvilsf Dumur ot1aexniociysfaDranmsn() lenio3iodomD luvs;s teuoxm3oy1apeelfetat)arrrxront0opxo fciys m rln o (0teenir3tadop elnei;(  rurxr3oy1ope  fciltfs2tm(m no0oet mf3ildfa ulnvo;t)arxnmr oo1fpDe ivs t t2umim3nydal  mfcsls  ruaum ;o0tlxnio3iat a2el(vp (0trermr oodlm eanvslt)texmxm oy4om nlfci s  rra(ro;t4tlxnmiciltfaDulumpnt4arxrir3iy1fmDeaivi;s t2xmxm3iy1lmtn ivs t)s2trx pnt1tlxoiictltfa2ul( p;(4aexoirctodopDrliesl(0srur(r3ny4ape  nvt ()a2uru  no4tpt  i3tasfm2emu sn(0altoxfctytlp   ivo;t texr(m3nodlle lfeiat)srrax onu1aet io3tyslmDrlu pnt0tlxrifcoydomD aieilt)setoxr3no1lp  lfvtl() 2uaump;o1oeeomiciydfaDum(msnt)trtrxo3iotfmte n s;()trxoirpny1ale  ivtl() 2umurpno0alx  f3iydlsDul(vp ()arxrircty1faD li i;( teuoim3no1om n fvslt) Drax poo4oltnmociasfs2umnmp;t4areoxociydfmtr ieols0srtr(m oo1optnlivsa(fsrtrxm no0tet ifciytfs em(vpn()texrir3tydfat lueo;s  etm(rpoodoptn netl( s2tmu p;o0opeomo3iltla2ran s;u0tlxnir3ootomtr ivsl( s2uoio3nudole mieiltf 2rau o;t1olt moctytfa2rluvo u4 eerifcta1omt luei;s0srto(m iu4al elncslsfaDrmxrooo0optn o3iasls ea(vpnt)alenio ootlptrlu s (0sruoio io4op n fctl()artax  ou1optnmfctadls2ulnvont0 rtnmf ta1fateli sl(0 rto(rpou1lmte iet s s2ra(r ou1oet mo3iltls2uau ont4trerif totfa eln s;t0 eumxo iu4lltnlivi ()aDrm(  nt4optnifctysfm2uaumpnu0tlxrif iatfmDrlueils) eumxo ou4ol nmnetas)srraumo;t1teto feiatfsDeauvp u0 eeoir ty1omt auvs;(0trxrxm iy4lme  netl(f Dua(  ;t4tet mfciltfs uau p t4altrir tatlp r n o t  exo(m ny1lm nmfei s)arum(mpno0apeoiieiydlmDem(mo;t0 rxrmrctatop eaueo;s s2uoir oudopeemfvs (f rrmxrpnt1aleo oeiytfm uauvpn(4tetrir3oadlat  uvi s0 exr(o nudap elivt s  rrru  nt0oetoii3iyt s eluvo;()artnir tadoaDeaivil() rxrxo io1al e ietatfsruaxm ;u0tlt  i3iasls ea( p;t0aexrif3iy1faD au i;t)t2tm(o io1ol n nesat  Duaxmo;u1olx miciadlmDuauvs t0 lxriocoa1op eli ols  rxoimpiydomeemfvsa(faDrax o;t1opxnif3iat s2emumo;(0aexoio oo1laD anesl()s2xmxmpoy4amtnmieils) Drru p;t0tpen feiydls raump;u) leoioctydfmDr i ols t2to(o nodomenlfviatf rtaxmpot0optnio3tytfmDrlnvp;u)tltrxf ta1omDelivi (0 ruoxrpno4lp  mivs t  Dtrxrpnt4apenio3tlslaDulumo (0tetrmf3oatopDrauvs s  ruoxopny1lme mfet (fs2tr(rooo1oeto fctadfaDraumo;u4 rxnxo iadop  aiei;(0 2trxr oo4op nlfcsas  Drr(rpou0aex  oeilsls2rmnvp;t4 ltomocoo1omt au sl()t2tm(o3oydameelivi sfsDtaxm ot0tlxomo3tyd m eln sn()tlxrio to1fpt  u s s0sruoxr nu1ll e ncs sfs2tmumpoo1apen ictytls2rluvo t4tlenxf totlatelivo;( tetoim3ny1ame mivtas sDrrxronu4ope  oeiasls ra( s;u) eeoircoodfpDean i ( s2toimpiydal nlfvilt) Dur(  ;t0optomietytfmDea( s u4 ltnifcoytfa e i ol()teuoiopou1lleeliei tf 2ua( onu1oetnifetyt aDrluvon(4aetrircoa1lpt au s;(0t2trio oodlptnlnvta(fsruax ooo4apto iciat m2umnvo;(4teeoxr3oatfaDraieo t  ruo(o3nudaltnmnvia()arrax p;o1alxn feiad s rm( o;(4 rxnio3oa1lm   nvs t) 2uriopny4ap  lnctatfaDururpot4tleoiocias s ua(vp;t)tlermf3oadopteluvs;t0 rxmio ny4ol emics (farua(mpnt4olen fctad a eauvs u0texnmrctatfmt  ivi;t0 2ur(o3ou4lltn iet t  2tmx ont0tleoii3ild aDrl(vpnu0tetoio3oatopte nes () exmxrpiodapenmfctat arra(mpnt0tlx  ietysfs2ulnvonu0teenmo oodlmtr ivi s)s2xm(r oodol   nesa()srrrx  ;t4texnmieiydls2ulnmsn(4tlenirciotfmt auvsl(0 2xmir3iudlpee fesls)a2tm(rpno1tpxnmieiat a2eanmp;u4 ltoirciotop rai i t0 2urim iodlltemnvsl()srrrxrpou1alxomietltfs elums (0trtnir3tydfat an i s srxoim3nu4ol e nvt ( aDuauront0tlenmoetldfs2ra( o u0altrmo oo1oaD luvolt0t2urxopno1al nlneil( aDrrxmooo1oexoii3tat s2emumsnu)arxnxo oadfmteanvslt)tetoiopiodaptnmieiatf Dum(rono1apxo octatfm ranmsn(0altrmf oa1oate u s;(0srxr(m3io4lp emnct t  Draxr oo0texnmoeiadfm2rlu p;t0 rtrmocoydlmte uvil(0 etm(r3oo1ap emivilsfa2tmxmo;t0tltoif3iatfaDemums;u0aleomr3ia1op e ies;t)srxmiopoy4optn fcsltfsrur(mont0tpx if3iasls emuvsnu4tetnxr iydfa  an o;()texrxrpnudlm  licia( srurxm ou4optomfeiydfaDrluvs;t)altnif oydfpt  ueilt srxmxo3no1lle  fvs tf 2tr( o;o1olxo ieiasfa rluvont)aexrio ia1lmDr ueols)trtm(m3iu1ape mncsl( arrrur ot1tpen octyt sDuauvo u4arxrmr3iy1lptrlnvi;t0srumxr nydop  lnvsas  rtmxm ;o4apt io3iadfm ulnvonu)trtoxo3oodfptrln s;t)trtmir3oo4lp e nesls  Duru pot0oex mi3iydfa rlnvp;()tlxoxocoatfm e uvo t)s2xmxo3iu4om elictat)arur(r ou4ale ii3iasfs ua(vo u4 ltrmf3oa1latranvi;s srurir iu1apt lfetlt)aDtmx onu4oltoio3iasls2ua(vp t4areoxf3iydfp eaueols0 etmim3ny1ap e fvi t  rtr(m oo4tptn ieiyd s ul(vs;u)aexrioctadomtelivs s)t2xoxo3io1al  lfvi s)aDua(rpnu1texo oetasfs el(vo;t) ltrif ty1lmtr neo;() exm(opno1am  mnct tfsrum( oou4alto o3tls m2rm( onu0 eerxrciadfmDeaieo () euo(o nudopte nciat)sDtaumpno4olxoioeiys m2emnvs;(0aetrifctodop  aneo ()t2ur(r3ny4ll  lnvia(fsrtaum ;u4alxn octadlm ea( o;t0treoxrcoadoptrauei;s)sexrxopnu1lmtemneil()aDrrur no1tltn fctlt s uan sn()artnif3iatoaDrlivo (0 rxrxrpiodome mfvilt) rua( p;o1opt moeiysfsDemn o;t0aeeoxo tatfptrau o s  exmxr iy4am nlneiat a2tmxm ;u4openio3tydlsDelnvs;(0artomrctatlaDe i o;t) 2xrxm3no1lm n fei () rrmxroot4opxoiicilsfs2uln s;(4aetnxrctytlmD  uei ( trxr(rpoodlle lictat a2urxr nu1tltniictyd m2ul( p;u4 reomf3iydom ranei;s0 rum(opio1ll  mnei sfa2uau  no0tleoiietld m2rlnms u4artrxr3iytopt lueils0texoir iu1ll emiei ()aDur(ro;o1ope moeiltla ea(mp;u4trtomf3iydlmtrluvol(0s2xoxrpoodal elnvi s a2tmxronu4tee mfciyd mDranvs t)arerxrcoodla eanvs;t srtmio3nodolenmiesa( aDra(r nu4altomfciytfm2um(vs;(0tetrmf tatfp elivo (  rurxm nodam emnes () rur(mpnu4tetnmf3iydlsDumumo;t0 leoxf oytlaDelneo;s)t2tmxmpiu1lle  iet () Duaurpno0oetn ociatfm emump;u4 ltrxrcoa1fmDe uei;t0 2trxopio4lmt  icta(f 2rr( ono4openmiciysla2eluvs u) rxoxf3oytfaD aneo;t)trtoxr iudomtelfci s sDtmxmooo4oeenifetad a umnmont4 rxoirciodfp rlneolt texm(opno4lmtnlfci t)artmumonu0tlt ii3tlsfs2el(vo;u)texrxf3ty1la r n o s0t2xmxrpiu1apeelieia(faDtrxmpoo1tltnmieilsfs umnms (0alxrif3iydlmt  ivo;t)setoxopoo4llte ict sfsrtrxmooo1opt if3tyt a2rauvo;(4alenifcootlmDr ieils0sexo(o3oy1omenlnes (faDtau  oo4oexn f3ilsfaDel(vo;t) rtnio tydomtrlnes t)sexoir oudoptnlnci s)sDtm(ro;o4tetoifeiat mDeanmp u0 lerio ta1fatr ueils0seuo(opoodllenlivta( aDumurp;o4apxoifciyd m emuvsn(4aleoiocoodfaDr nes;()t2tmxrpnu4llee icsa()aDtmxmooo0oetnif3tydfm2em( p;t)arerxocoadla raues;t  exrxm iudlmeemncs ()a2raum ou1aptomf3ildlm2elnmo;t)tltoif3iy1fmtr i ils)trtoxo iodol e fes t  Dtm(  ou0tlxo ociatlm el(vp t0trtrmr3tydoatelivs;t)t2xo(o oy4om nlicil()aDrrurooo1tleoif3tydls umnmp u)arerxfciytom rau i;s0 2trir no4ale  feiat) 2umump;t1tptoiictldlmDulnvp u0arxrxf oytoa eai s (0seurir3oy4al nlictat) rrmxmp;u1oeeniietatfa2um( s;u4aleomf3iy1om rlnesl(0 2xrxo iudop nlicias)a2um(m ;u4aptniietldfs2uanmp;(4arermociodom raneils) euo(m iudopenmnei (fsrua(mp;o0apxomo3iasfmDua( s (4trtomr3iadfm   nvs;s0t2urirpnodomtnlncs s)a2ra( o;o1alenif3tlsfm2ra( s;(0alxomocoa1fpte i s;s) exoir iy4lp nmfvia(fa2ta(monu1oltn o3iaslsDuluvs ()aeermo3io1om rluvil()t2trim oudal elivs s)arua(ro;u1tptniiciad mDelu p;u0 lenmo tatfp e ieols0trtrxopiy1lpeelfct (farrmu o;t1aee miciad aDrlump (
\ No newline at end of file
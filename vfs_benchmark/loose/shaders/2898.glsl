@@ -0,0 +1 @@
+nvs;s0srtrim3ou1lleelfeia(fa2tm(rpoo1tetomfctltlm2el( s;t4 ltrmf iadfm  ln sls  rxrirpnu1ale mnvtatfarrmxr ou1ape  o3iytla2um(vpnt) eeomr oodfpDranvi s trxr(rpio1amen fvsltfs2ra(r ;t1apxomfcildfs2umnmon()alxoiocoodop eau o (0s2xrxm ou1lm emfes s a2tru pot1teeo f3ilt mDranms;(4tlermfciytlpt aueo t s2toio3nudlpenmfvtls aruaxrpnt1alt mo3tatfsDrl(vsnt0 rxnmocoa1latrlnei t  rtr(r3io4lltemncsa(f Drmxmo;u1apeoifeiat mDean s;u0alenxr3todfp eaies t)seuoxo3oodol emivs s) Dta(m oo4olx  ictaslm2umnvp;t0aetnmo3iytfatrluei t)srtrxr iodlm  mict sfsDrr(m no0oet moeils m2uauvpnu)aeerxr iatopDe nvo;(0t2trimpnodoptnmicsas a2ua(rono4tlto fciyt s rln p;(0artoir tytomD luesl(0teurim3no1aleemfvtltf ruru pou0opt  o3tadfm eln s;t0 etoircty1fatelieo;s) rxoxr nu1lm emivtl()aDua( o;t4ope  f3iyslm em( pn(4trtnmf todlmte u il() 2xmio iy4lm n netl(  Dtmu onu0openifciadlsDeanvs;(0artnmr iotfm e n ols  rumio no4ape  feil(f rrr(roou4opeoifeiatlmDuanmp;t0alenmr3oo1lm  aiei t0s2tr(o3oudolt lnet () rurumpou4aeeo iciatlmDuau s u4arxnif3to1faDe ueil(  2tmxo nydlpe lfviasfa2ua(m ot0tltnmoeiatfm2umn snt4aeerxr3oy1fm rlues t)seurimpio4amtemics sfsDta( pno4olt ii3iytla2umn ont0artnir io1oaD lu sl(0 rtoxm iodopt  feil(f Drrumo;t1olxnif3tatfa uauvp t4teenxrciadfp rau i (  etmim nudoptelivs sf 2tm(moou0oex mictydls ea( p t0tlxnmr iodop ean ils)t2xoxo iu1apeemnvs tfa2rru oou4alxoifeiat a2uluvo;t0tetrmrciytoptrai sl(0 euo(r3oodlltnlnvias) Dumu poo0teeoiietldla elumon(0texoxf3tadfptrlivi;t  rurxm3ou1llenmnctatf 2umumoot4opto ieiysfs ra(monu4texoio3io1fm ean i t  2xmxrpoo1amtnmfcs (f Dtm( ooo4aetnioeiysla rlnmp;t)texnxoctytlm rlueolt) rum(o ny1llee fvsa(farrau onu4opxnifctytfsDelnmpn()alxnir3oa1fp eaiei (0 etmxr ny1am  mfeslt) 2ta(moot4tpx miciadfa uan p u) rtoxo3oydfpt aueslt0trtmim oy1llt  ietasfsDuru p;o0tpxomfciytfs rm(ms u0 reoio3tydom rauvs t t2xr(opiodllteliei ()aDraxm ;o1tpx mf3iatfaDea( p u4 eenmf iadlmDrli o;s sexm(m3iy1al nlfct s) 2umumpot4oee mo3tydfa rm( o;u)aetoxf3to1lpte i i t) 2xmxopnu4am n fetas)srtrumoot0aeeniociltfs emu p u0arxnxrctytfpD aueo t s2xrxrpnu4ol elnei s)a2uaxmpou0optn octasfaDea(ms;u4trerxrctytfmD an s;s0trxm(r iu4alenmnvsa()arra( p;t4apx mieiytfsDulnmpnu)tlxomo iytfpDr u o;s) etoxm3oy4ap nlncsa( arur(mpoo0tpt mociyd aDea(mpn(4 etnmrciotlptean s;t) eumxopoy4lptn ncia(fa2tmx  no4alto ociaslm2rmnvo u0tltnxocio1op  ln olt seum(o io1lptnmfeilt)srtrx p;o0tpxomocilsls rmu sn()areoxo3oo1oa ranvs;(  2tm(o3iu1oltemivtls)sDumu pno4oet iictadls2umump;u4 rtrmf3iatfp ran sl( s2xo(opiodlleelnvi s aDumu pou4tpxo fetad s rm( s (4trerxrctatla e neolt sexo(o oo4om  lietls)s2umxm no4apenii3iydfmDuluvs;u)arenif oydlp  aueolt s2to(mpio4om n ics t) 2raxm ou0tpxo ictadfm emuvpnt0tlermf totlatraivil(0texmxmpoy4amt lnvi (f Dumxm ou4oeeoiocildfa2rmn s;u0 reriociotoatrau o ()t2xmxopoo4apen nvsl() Dumum ou0aleoiietlslm uluvs;()arerxf oydop ranvs t0 rtmxo3nu4opt livia( a2trumo;o4oeen i3ilt s ea(vp (0 rtoir3tytfmDr ivsls0s2xm(r nudll  mfvsas)s2raum oo1alto f3iydfsDua(ms t0 eeoxf iatfaDrai s s)seur(o3iy4lle mfesa() 2ta(m ;t0alt moctadla2ulnvs;(4arxnxf3ia1oa e nes ( t2xo(rpoudaltnlfvsls  rrax  no4ope moeiasfmDuln o;t4treoir3iytfaDrlnvo;() 2xrim3iudopeelicta()a2uax oou1openifciltls2ulumo u4aetrio oy1la  livi () 2uo(rpny4ol nmfcsa(farraumont1olx miciad a2uan p t0tetnmf totfmDeauvi s  2ur(o3io1apenmfesl( aDta( poo1tpxnmo3tatla2uluvo u4tetomrcoydom   nvi ( tetoirpny4apen fvtat  Dtru ont4teeo ieiat a2eanms;u)trerxrcoy1lpt li i;s0trxmimpiodaptelnet (faDumx  ;u1alxn ictad mDel( pnu0trenio totlp   i s;s setrio3nodll e net t  rum(ro;t1texo f3tlt m elnvpnu4 rtrmo oydfp e i il() rtr(opiy1am  lnei tfarra(monu0apenmoeiaslsDumumon(4 exoio oodlmte i o;() etr(o3oy1alt mfcslt)s2rrur no0tpenmi3tyt a2el(ms;t0alxrmo oatop rau ils) etoxm3nydapt mfcsatfaDum(r no4aeto i3iydfaDra(mo t4tlxoxrctotlp e ueo t) ruoimpoodll e fcsatfaDrrx poo0oltoio3tatlmDumu s t4tetrmrcoatfate uvslt0srumim oy4alee nvsl(f Dta(ront4tleomocilt a el(mpnt)tetoir tadlp e uvs (0t2tmim3oy1lmtelietls)aDtrxmpoo4opeomo3ilsfa umuvs (0 exnmociotlm e nvol()setm(m nodol nmfvsltf Dua(rp;t4oetnmo3tysls2uau onu0tlxoio oodfaD  neo;(0teum(o iu1ole mivsls) 2umurpnu1aet ifciat m2uluvsnt4 lxrxr oo1fpDrai ol(0t2uoxm no4ameelictlt srumxrp;t4aeeoioctysfs el( s;u)tltnxo3ia1lmt aiei t  2tr(r3ny4opt lfvi tf Drm( poo1tlxn oeilsfmDeauvp t0trxoxr3oydlaDrau i;s0s2uo(rpiy4amt mictl()s2tm(m nt4tptnifeiat aDeln p u) rtrmf3ia1oaDrluvs t)trxmimpnudlm  lfei (  Dtrx p;t0oltnmfeiatlm rm(mo u)texnmr ia1lm e n o;t s2xoxm3iu4altn iet (fartmu  no4oeen ictys a2ean o;u0 lxoio oatfptrlu s () eur(mpnu1lptemnet s)sDuaxmo;o1tlxnmoeilsfm2elnvs;(0arxnmf oy1lpteli o;s) 2tr(mpiydole mnvtat)s2rmxro;o1tptomieiyt s2elu s;t4arxrio3iytla eau o t setoxo nodamtn netlt)a2rr(mp;u4open ocias a rmu s ()arenmfctodfp ranei;s  etr(o3oy1amt lietltf rraxr ;t0tee  o3iyslmDum(ms;(4 renmrcio1fpDrauvsls0trtr(o3ny4opee icia(  Dur(rooo1tlx mf3iysfm2rauvs u4 reoxf3tytfaD  ieo;t trtrxmpou1ale mnciasfs2uax  ;o1apeoii3iytfm2eanmo u)tetoir3iy1omt  ueols0sexrxm3oodap nmfvs t)artrxrpoo1aee  fciadlm um(vs;t0arxrxr3ty1laD  uvs t0srtoxo oo1amtnmieiasfsDrax poo1aeto ociltfm2ra( on(0tltrxrcoadopDelieo;t  etm(o3oy1lmt lfctas) rtrx o;t1tpxoii3tasfsDrmumo (4 etoir3oytlpt au o t  rxm(r oo4om e nctlsf Dtrum ;u0opt  feiadlmDrlumpn()texoxrcto1fm eanes s0srum(m iy4am  mivtl( a2ta(rp;o1tetoifctytlmDeau snu)teerir3tydom  an ol() rto(o ou4ale lietas a2ur(m nt0opxnifeils s umuvs (4teenxr3iy1lm rai ilt) 2umir oudamte fctlsf rrrxmpou0tlx ioeils aDrm(vo t4 etrmrcta1la eln o () rumxm3oudll  lncslt)srtru o;u4tlxniiciltfmDrmuvp;(0 ltnxr3oatfatr iei;(0 etr(rpoodoltnlfvtlt sDrau ont0oet if3iyt s um( s;t4texnio oatfat ai s;( srtm(m nu4lltemnesa(fsDum(r nu4tlt ii3ilt m ean p;(0artoio3oy1la  luvsl()t2xrim io1apeelfesasfsrtmu  ;u4tpx ifciadfmDum(vsnu0trtrir tydomD lieolt)sexmxopou1lleemfctas)a2trumpou1opxoii3tld m2rmnmp;u4 ltrirctatlat anvi;s0teur(rpoo1ol   ncsl(f 2tmumpno1ape  feiltlmDel(vp;t4 leomocio1lpDrln ilt s2xm(r nu4lp elieiatf Dum( oou0altnifeiatfm2ea(ms t4trxomo tydla r uvslt0t2xrxo ny1op   iesasfa2rrxmo;o4tpenmi3tatla2eau s u)trxrxf3to1lmte ivils)t2xmxr iy1al e fctat) Dtmxr ot1aexoifeiasfs uaums;() eenxo iy1fpt ln i;t0 rur(r ou4aptn neslt arrrxmpnu0alxo oeildfs2ua( o;(4tlxrmrctatomt  uvi s0 eurirpou4lltelfviat sDur(mont1alto ieiatlm2rauvp u)trxomr ootfm   nvi;s)srtoxr3iy1lp  miviat srua(mpou0oetomf3iytla2elnmo (0areoiocoydopt  neilt)t2umxrpiy4apt  ivt sfarra(  ;u0tex mfeiasfa ulnmp t4arenmocia1la  luvi ( seumxm3iy1amenlneiat)s2ur(m ot1aleomfeiys a2ua(msnu0tltnxf3oo1laDelivs s s2umim3io4apeemfeiatfaDraxm ;u1apxnmieilsfs2ran o;u0aetoxo oydoaDeai slt0s2tr(mpou1op  mivtlt  rurxmp;o0tpxniociydla em(vs;t0tetomfcta1om rlnvi;s0 ruoiopiydlmte fcil( a2rrur ;t4aleoiieiysfs2um(msn(0areomrciytfaD  neo;t0seumir nydlpen ies t) rumu p;u1tle mieildls2rm(mp;u)artoifciydomtrau s;s  euoio ou4alee ict sf Dra( pno4apx  icils mDel(vp;u0 lenifcoodfaDeai o;()t2tmir3nudlpt lies t)arrr(mpnu4tleoii3iatfm uanvpnt) lxrircia1opD ai i;t) rxm(o3oo4lmeelict ( s2trxro;u4tltomo3iaslsDulu ont4tleomo to1la rluvs t) rxo(m3nudomtelncils  Duau pnt1olenii3tyt aDuanmo;u0trenirctotlm e i o t) euoxmpny1amtnmfcsl(fsrta(rpno4ape  oeiytls rauvo;(4trermo ootopt  ueols0s2tmxr io4olt  fvtas) 2rr(mono1tpxniocildlsDra(mp u4 exoircoydlpt liei (  2xo(o3oy4ol   netl()s2ra(moot4olenii3iys mDrlu pn(0 ltrmo oodlm elies s s2xmim ou1oleelicils) Drm( pot4aetomf3iasfa2ua(ms u0tlenif oydfmte i i t) 2uo(opoodomt mivias)sDumxmpno1oee  ietytfmDeanvsnu4arxomo3oo1op rlivs;()trurxrpou4ll  lnvta()srtrxmont0olxnmiciytfs2el(mp;u)artrxfcty1fm ean o () rtmxm3iudllte nvslsfaruax  nt0apeomo3iytfs2rm(vp;t) ltrxoctodfp eln i t0truo(m oy1olen nci t)s2urx poo1texo o3tld sDum(mo u)tlerif iadla   i sl(0 rurirpiudlm  lnvta()sruau pou4alx iietlsfmDua( snu0tltnmrciodoaD ai s () rxm(m iu4lm emnetl(f rum(rono1apen f3tasfs2umu o;(0 rxnir3tatlpteli o;s) exo(o3iudlp  liet (f 2raurono0aeen feilt s uluvsnt)aleoio ta1la eliei s  etoxopno1apee fcsat) rtmxrpoo0apeoif3tad m2rlumo (0arxnmf3iytlp e n o;s srxrxm iy1ol elfvtat arra(r ;o4tleomfciyd s ra(ms u0 rtrxfciydomDe uvi (0srxoimpno1ol  mnetat  Dur(mpoo4aeeo fciyd mDrmn s;u0 rxomf3iadoptrli o;t)t2xoir ou4ale mncs t)s2rmu oot0optomoctld s rmu s (4 lxrxrciadlmDr nesl()t2xoxopiy1opeelfvi t)aDur( p;o4tltnmociyd a emnvs (4alenmfctodlaD  u ol() eumxo iodap elncias  Drrxmpou0alx  o3ias s ra( p;t0aleoxf3totlat ai i;s)t2tmxmpnodomte neil(faruaump;u0aex ifciasla2umu o;t0tetnxr iodlat  uvs (0s2tr(r ny4lm  mfeilsfsrrrxrp;u4tleo feiad s2el(ms;u4trxrxo oatlpte uei;t) 2xrxopno4llt  iciltfsDrm(r ;u0aptoifetadfm rau snu4tetniocoa1fmtrli sl()srxoxm3oydlmtemivi s)artmxm ou1opxnmfciad mDemnvo;t0 lxoxf3ty1lpteaneo s) exr(o3ou4omenmfvs t)aDurx o;o1altn f3iyt m elums;t0aeerircio1laD  ieolt)trxoir3no1amt  ivi t) rtmu  ;t0optnmfeiysfa2elu p (0trerxocty1fm  anvilt0t2tmxm oo4om nmictasfartmxmp;t0opxnmo3tytfa em(vs (4 etnmr3tydfpte uvs;t) rxrxm oo4omtemfet ()srrm(r no1olen fciasla ul(vpn(4tetnir tatopD li o ()setrimpno1lmt mnvias artm( ont4tpt ii3ilsfs2el( onu4arerxr3oodfate u i t  rtmirpnu1amt  ncs t)sDta(mono4opx  ieiytfs2emn o;t4altomr3todopte uvil()texrxo ou1omtemncsl(fs2ta(ront4optoiictatfs elumonu4 lxrxo3iy1lmtelu o;s srxoiopoo4lp  mivtlt srtax oot0apeo octltla2emuvp u0aetrxf3ia1opteaieils  rur(m oo4openlncias) rumx poo4optn ieildlaDrl(vsn(0 rtnir iatfpt lneol() rtmir iu4opeelfcslt)a2umxmoou1ape moeildlm emuvo;u)artrxo ootlaDran ilt)trumxr3oydomtnlncta()aDtm(mp;t0tltnifctat aDua(mo;u)trtnio iotoa  lu o;t seuoxmpoydamt  fcs sfs2umx  nu4tlxnmfciatfm eauvs t)aeeoiociy1lmDraueslt0 exrio iydame  ivias)s2rr( pnt0tpxnio3tasla2ua(mp;t)altoirciatom  ai slt  eumiopiydlpeemnci sfa2umu  ;u4altoiietys s2ua(mp;u) eeomo tatfm eliei s)s2urimpoudomtnlicil(farrmu ooo1openmfciatlsDrm( snt0 renmo io1fpD ln o t0sruo(rpno4ap   ncsat) rtaurpoo0aptn ociys s rauvs;(0trtnxocia1op  livil( s2tr(m oydape liesls arumurp;t4tpt mo3iadlm2ranmpn(4 ltrxociotop raiei ( trxm(m iodopee nci sfartau o;o4ape iicias sDum(vpnt4 rxrirctydfaDeaueols)trtoir3iu1al   nvtasfa2um(mp;u1teen i3iad s ua(vo t)artnif3iy1fatrlu sl() 2xrxopnydaptnlicsasfs2raurp;u0oeeo i3iad m uan pn(0areoxo oytfaDe nvs;s srtrxopoo1ope mnetltfartm( p;o4tlx  iciysfa rmn s (0aeenio iotopDeau s s teuoxmpoy4ape  fet sfsDtmu p;u0oexnmociadla2el(vp;u4artoiocoa1opD luvs;(  rtoxm nudlmt  ncsls)sDrmxm ;t4texomfciltlm2rlumpnt4tltnxo3tydfp  anvo (0 rxr(m3no1alte ivsa(faDtmxmpnu0oltoiietltlm rl( on()tltoxr oo1lm   uvils)t2urir3iodll elietat)s2uaxmono4tltniicias aDulumsnt4alxoio3io1fa e n s;s0 2to(opio4aptnlivi (fs2urxmooo4tpxnmieiyt m emn o;(0aexoir3oodfmt  uvi;()sexr(r iu1lptn nvilsfartr( o;u0apxo oeiysfa2el(vp u)aexoircoytoa r n s;s)t2toxm iu4lmt lfetasfa2tax oou4teto iciad a em(monu4arxrxrcty1fat  ies;t0tetrim3iy4om emnesasfsDtrxmooo0apeo octasfaDumu pnt0 lerxf3iadoptrai ols0 etrxr no4ll emiet s s2rrurpnu4tpen icild aDul( o;() rxnio3iodopteaueo t0seuoim3oydomte icta()aDrm(  nt4opt  oeiatfm eau o t4arxnxo3io1fm rln i;(0teto(o iu1lpte icslt) 2tm(rpnt0olxnmi3tlsfmDum( s;u) etrmf oydomDelnei;(  exoxopou1lpenmnctl( arrru oou4tet io3iyd sDum( p (0tetnxoctodfaD lnvols)t2toio3ny1om  mfvi tfarrr(r nu4opx mociysfs2rl( o (0teenmf iatlp e nvo;t0 2toxm3iy1llt  fvilt sDua(  nu0apeo fciytfs uaums u4aeeomo oatlmteli o s0t2xo(o3io1lptnliei t sDumx p;o0olxomfeilt m el(vs u4altomf oo1omt aneol()srxm(rpoo1lltn ivi s  Dtrxm ;t4apxniieiydlsDeau s;u0aexrxr3iotla  lues s)texo(o io4ope mnei t srurxrp;o4oex  oetadla2el( o (4tltrxr3todlmDr u sl()texmxo no4am n nesa() Duax  nt4opxomo3ildfmDrl(ms t)trerio ta1lptr i slt  exm(o ny1lp e fet sfarumxr ot0aetn o3tysfa eluvpnu) eeoxoctydfmDrli ils0s2ur(r iu4ol nlics t) ruaurpot1aeenmf3tysfaDulums (4 etrxf ty1fp  an o;(0s2tmxo iu1lm nmict t)sDrm( pot0alt mfeiltfa rlnmon(4artrxr ootoa r i o t)trxrxmpoodllt mfvs (fsDrmxm ou1alt moeiltlaDumu p;(4texrmr3iytlpte n sls  eur(o3oudamtnlici sf 2rm(ronu0apx ioeias mDea( s;(0teerirciotom eli sl()t2xrio3iu1lmenlfviat  2rm(  no0alt  ieiyt sDemumo u0 reoircoytomDr n i t0trtoir3no1op nmncilsf 2uaxmpou0opx iieiatfaDelnmo ()tltoiocoa1lmD  ivslt s2ur(r3oy1lltnmnci sfaDum(mpnu4tltn fcildfsDuau o;u0tltnif3tadlaDr ieo ()t2xo(rpoodom  mnei (fa2trumooo4opeomo3tlsls2em(ms;()aexomocty1fmt lnei t0trxmxm3ou1ame lietl( arrm( p;o0aee mietyt a2emnmp;t4 rxrmo tydfaDeln o;s0t2to(r3oy4ll   fvia(fs2rrx  ;t0olxnmf3tad sDelnvp t4aexoirciatfpDrau s s)t2xr(r3ny4al nmiciat)a2tr(rpou0altoioeiasfs rm( o;t4 rerxf3tadop   i o ()trtrim3iy4olenmfet (  2raur oo1tex  feiatfaDrl(vp t4alerxrcto1fpt  nvo;s  2urxmpio1lmtn fvia()aDtmxm ;t4tpxn f3tat sDemu s;t0aetnirctadlpte neils0 2xmir3ny1aptelfvtl(  rta(  ot0olt ifeiysfaDrlu pnt4alermo iatfaDr nvs s setmirpio4al   feiltfa2rrxmoot1aet mieiasfsDeln o;t4trtrmfctadfatelu o t) 2trim3iu1alee ici t a2umu  ou4opxoii3tydlmDrmn p (4texnmo3io1fp rln i (0sexoimpoydam emnesat)s2uaurp;o1aptnioeiaslmDran o;u)aeenxf3oo1optrai o s t2xr(rpiydlp   ieia(f 2raump;u4tpeoio3iysfsDrlnvs t4tleoir oy1faDelu i;s srxrxr iodopenlicia(  Drax o;u1aeeomociyd sDrmu s u0artnmrcoadlmtran s;(0 2tr(rpio1lmen nci s)aDtrumont1tpxoif3iad m eln s;t4texnxrcoodomt  ueols0srumir nydllte fvs s)s2raxr ;t0alx  feildfa umn p t0aexrir3todop r i olt0 2xmio oydapt lfesas)aDurx o;t4oexnii3tatfs2ulnvsnu0alenxf oytfaDrau o;(0 rtr(m oo4opeemieilt  rtaurp;o1open fetldlmDemu s;u0 reoxrctotfmDr iei;()seur(o3io1om e fcta(  rra(r ;o0olxo f3tldls emums;u4 etnmr3tatlaDeaivols) rxmirpou4apt mfeslsf 2urur ;u4tpe ii3iad a em( snu4 ltomr ia1opD auei;s0 eurxm oy4lpe lnvil(f Dtmxm ;t4tltomoeils mDemumon()tltnxrcoadlp e nei t  etrxopou1alt lncsls)aDtr(rpno4tetnmieiadfs2rlu p;() rermf tytoaDrln o t0s2urxr3ou4alt mnesa() rrmxm ;u0tleo feiad sDum(monu0trtrmf iydlmDeaiei ( tetoxo3no1apte ivt s sDua(ront4tex mfetls mDem(mp t) renxr oytlmtraueilt0trxr(m3nu4amt mieslt)s2rmx  nt0teenmo3tad sDel(vo (0tlxrxo io1lat auvsl(0srurxo oy1lmee nvias  Dtmu pnt1teeoifciad mDeaumo u)artoxr iodlm  auesl( srxmxm oy1lp nlncia(fs2rr(  ;t4oex  fciad aDrmuvs;u)tlenxr ta1fmte uesl(0 exoim3oy4omtelfvtasf rumxro;t0oex mfcilt a2elu ont) leriociydfaDrluvsl() etoxrpnydomee fet t)a2trur ot0tpt io3ilsfs2uanmp;(0altoir oatlmtrauvsls0truoimpoy4optn nct sf Dra(r ;t4apx ii3iydfs2rmnvs (4aexoxo oydlp e uvs;t t2uoir oy1lm elfvilt arrrumoou0tlenmi3ildlm2ra(vp;u)aexriocoodfat  nvo;t0srtmxmpiu1ole lfesls aDtm(ro;o1oexoio3iatfm eanvp t)tlerircoa1fmte neslt)trum(o3oy4lm e fvsls sDurx pou0alen iciadfsDum( o;u)trenmrctotop rlneil(  2xoxm io4lptemivs (faDrmu ooo4aee mociatlmDum(ms u0 eeoxociodlaDrauvs s) rxoxr3no4optnmnei t  2rrxmono0opxnifetaslmDrmnmsn(4 eeoir3ty1faDeauvil(0trxrio3iy4lleeliesa(f Dta( ont1alxn ietlt mDea(vs u4 exrmo3oo1fatr i s t)t2uoirpoo1lm emncslt) 2ta(mpoo1aee  icilt m2ea(mo u4alxoirctodlp raues;s)srtrir oo1lmt lieta( arua(mont0aex  ictadla rmu o;u) etomocoodlpDrli sl( tetoim oo4al  mnctatfsDtrxmpnt1altoifcildfs2ulnmp;(4tltoxr oa1fa eluvslt)trxoxmpoo4ol  mneilt) 2rau  ;u4ole  f3tlslsDran o t)texoxr tytfpDr i il( trur(m iydalenmfct (f ruaumpnt1tleoif3iys m umnvsnu4artrmf3tadoat  n il(0srur(opny4ll emfvi (fa2rru o;o0tleomf3iltfaDuluvsnt) etrmrciy1la r uvs ()t2uoxmpny4ll  lnes s)s2um(  ot0tpto icild aDeau pnt)artoxf3oodlaD aueil( sexmir3io1apeemnvtlt)a2rr(m no0tpxoio3iys sDemums ()artrxfctodoaD ai olt t2xrim3iu4lmtn nvil( aDrrxmonu4tpeoioeiltfm umuvsnt4tlxoiocoydfp r ies;t  etr(r nodomenlivtltf rtru  ;u4tpe if3iyt a2uanms u4 lerxo3oodfpt ln s t0sruoxm ny4ol nmieiltfartauront0aeeomoeiadlm2ra(mpnt0alenmr3iy1fa eaivs;s)srur(r iudlltelnci t a2rau p;t0aexoiieild a2ulump u)artomr3to1fpD  ieilt0 eur(r oodap n nvi s) 2rm(ront4oleniieils s rm( o;u0tlxnmfciodlaDr nvo;( srumxmpou4lp n nctls) 2trx poo1opxoiictldfm rlnms;(0aexrio tytfp  luvs;s  2xrxmpiu1am  lics tfs2rrurpnt4opeo ieiydlmDranmp u)altoxo3tytoa e neil( s2xoiopny1amtnlfvtlsfsDtmxmpnt1tpenif3tls s2umn snu) lxnxf3oodoateau il( setm(r iodalt mnetlt a2tm(rpnt1ale moctyd s ea( p u)teeoxfctatlm eli sl(0 rxo(o3nu4amtnlnetls)s2uauronu0olt ifetadfs2um(mp;t0teerio ootopt ln o;s teuoimpou1omtelivtl(fsrumuro;u4texnif3tldlmDrmnvp t) leoiocoy1omDeauvo t0 2um(o3ou4lm   ivtat  rrr(r ou0opeo ieiysla rmu o t0arxrir3iatfa  aiei;t setrir3iu4omtnmncsa()a2tr(ront0optniictlsfmDumuvo;u)arenirctatla elies;s)t2tmxo3ny1om n ies ()aDurxmonu1tlxn i3tytlm2eanmp u4tlxoif3oy1oaDrlu sl(0s2trxm3iodole mfes s  Dtaumonu0tpx  o3tasfsDrlnmon() ltnifciadlpD lieolt teto(rpiu1om   ics s) Drru pnu0alenioetlt mDum(ms;t4aetrio3ty1oatranvols0 eurir oy4ap nlicsas)a2ur(m oo4teto o3tadfa umu snt0aeenxrcoa1faDranvil( texrio nodomeelfcslsf 2ra(mont0aetomfcildlsDua( s;u4 rxrmoctadom  aieil()texm(mpiy4lmtelnesl( aDtrumooo4apt mi3iasfs2um(ms (4 rxnio3ia1fpt lues t  rxmxr3oy4lp  lietas)artmxrpoo4ale  o3tldlaDulnmo;u4trxrxfcio1fp  luei;( srur(mpnydlmenlncia()aDrmxmpot1apeomi3iltlaDelu p;t4trtoxrctytlmtrau o;s0srtriopiu1ol   ivs (fsDtaum oo0ole  octydlm uaump t0trxrxfciodfat  i ils setmxm3iydolenmivt (f Dra(  no4aee  oeiys aDeanvs;(0artomrcto1lat luvs;( setrio3iodom emneia()aDtrxmono4tlt micildfmDran o;u)trtoio3oatlp ean o t  2xoio3iu1alenlnvilt  Drrumont0olxnifciad aDuaumo;t4artrxo3oatfa eluvi;s0s2uoio3iydom  mfei sf Dumuroou1alxomfctydls2uaumpnu0arermocoo1oatrlu o;( seuo(o3nu4lptelivias)aruaum ;t4tpenmo3ildfa umnvp u4 lxrmrciydfatrli i t0setoxr3nu1opee fvt (fsrur(mpno4tpenmo3iydfsDemnvont4 etrmfctadoptrlivi t0texoxr iy4om  lnesls a2umu  ou4aeeomi3ilsla2ra(ms (4trxoio3oodop r nvols texoimpiu4lpe  fct () 2tax pno1tlx mi3iltfa umumonu)artrmfciydopDrli i s)trtoxr3oy1lp nlnviatfartmurono4texnioeiasfsDrmnvpnu4tltrmf oodlpDrau i;t0 rtoir oo4ap  lncs () rtaump;u1aeeo oeiatlm eln pnu) exoir tydoatrlivslt0trum(r iy1om  micta(fa2urxmpoo4opeo ociydla2uanmp u)aetnmrcoadop rau ols  rtrxo3nydop n nesl(fa2rruro;t4oexoii3ilt m2umnvpnu)tltrmo3ootom rlivo;() rumxo3oo4llenmfci t) Dtmx p;o1olenifctyd s2emumont4artnxr tadfp eaneo;s0seurir no1lpenmfvs (fs2um(mono0aptn f3iydlm eanms;u)teeomrcootoa  aivs t teurxr nodll  mfvias arur(ro;o0apenmo3tlsfmDrl(ms u4alermr iadfpt lu s;t texrxopiudole licslt  Dtau ooo1oetoio3tatfm ua( s;t4aetrirciadla  lueo;(0 2umxopiudam nmivtat)aDuaxmpot4tpenii3ilsla elnvpn() ltoioctotomtrluvo;s) 2toirpnodllt lfctl( srraxmo;t4apeniociadls eau s;t4 lxomrcoatoaD ln s s setm(opoo1lpt  ncils)a2tmumpnt0olx mieiasfm elums;(4 lxnxr3iadomtrai i s)trxo(o3iu4amenlfvils aDtmu o;o0apxn ictls mDrmu s (4areoxo3todlatr ivi t0seum(o3oudom e nei tfsrtmxmont0aexnmfciltfm2rm(vo;(4alxnif ootoa r u ilt0 2um(o3iu4apee ivt tfs2taxrooo4tpx ifctldls ulnvo t0aeerxfciydfp  anvi;t0 2um(r3nudapt  fctls)arraumonu1aptomfctyslsDelnmp ()arxnxo3oodfmtr uvo;(0 rtoxmpoudlle  nvtlsfs2rrxronu0aexnioeiltlaDulums;(4 etrmf ootfmD  ues s s2uoio3ou4apeemivsat) Dur(  ;t4opeomfetltls elnmo u4trenif3iadfa rli i;(  eum(o3oy4amtnlfcsatfs2rr( p;u1aptnmfciyd sDemnmp t)alxnxocoodoate i i ()srxrxmpiu1amtnlieil(fsrrmxmono4tlxnmoeiysls2ea(vo t4 rtrif3tytomt livo;s  exrxm io1opeelnet s aruauro;o0tleo oetytfmDrau p u4trtoxr3tadfm  an sls)trxmio oodapenlfesltfaDua(rpot4aet  octytfs eau p ()alxrmrctodoatelnes;t trxrir3no4om  mfctl(faDtm(r ;t4aexoioetyd s2rmn p u) reoxr3ia1lptrlivs;t)s2toir3ou4olenlnet tfsDuaxmp;u4oee  feilt s2rlnmsnu) rtnir io1lmtelnvsls0 2uoxo no1ape  ivt s)s2rau o;o0oetoif3iad m uau s;t0aexoif iatomtr nvi;t)s2urir iodaltnmfvsat  rumu  nu0oetomictlslm2ra(vsnu)arenxr3iadoaDeauvslt  euriopnydopt  nciasfaDraxmoou1aee mfetyt sDeau o (0teeomfctytlptrluvols srumim3iu1optnlieil( s2umurpnt0tlx io3ild m rmump;u) lxrxf oatfa  an i;t) rur(mpnodol  mietas)a2rrxm nt0tpxo o3tat m2rmuvpnu4aexrmo3iodoptran s ()srtm(r oo1apeelfcsa()s2trxmoot4apen oetyd m eanmo u0aetomr totomDelu i s trxr(mpiy4omtemivslt sDuaxmpnu0alt io3tlsfsDeanmo t4 renio3oodlpDeln s ( t2xrxr3oudomee icsat  2rrumpou1aptn fctyt aDuauvs t4aetrxf iy1omteaiei s texrio iy4opt  fciasf rrrxm ot4tpx mfeilsla2rau p (0altrir iodfmDe nvi;s)s2xm(r no1lp nmies s)arur(ro;t0opxoiociyt m2ua( s;()tlxnifcta1laDeauesls) exrim3nu1lpt lfesas)a2urxmonu1apt ii3ils a2el(ms;()texnxrctodlaDelueilt) rtm(o3ou1apeemneiat sDtrx  ;u0apxoiieildls2umnvon(4 reomrctatoa r i i (0trto(mpiy4opee ivs t)a2urumoot1ape ii3iltfsDrluvs;u) rerxf3oo1oateai s ( trumio3oydope  feil( aDrmum no4aex mo3iad aDea(mo ()alxoif iydlptrauvs t) etoim io4openmfeils)arumurp;o4opx  f3tasfa2ranvp;u0arxrxocoydlmtraivo s)teum(r3iy4omtn neiat s2ta(mont0altnii3iasfaDumu o (0 etnmr iydla elnvi;s0t2urxr3nu4olee nciltfsDururpoo0teeo octysfa2ulumsn(0 lxrxo io1optr n sl(0t2xrxo iydol elivs s  Durxronu0teeoiociad a ea(mpnt) etnir to1oaD aieil(0 exmxrpoy4apeemfciasfs2uaxm ou1oleo ieildla2ra(mpnu4 rtnxr3oatfmDrauvo ( texmxr ny4oltnlneiat srrmx  no1apto f3iltlaDrlu s (4 exoio ty1lpteaivol(  euoim no1olt miesltfartmurpno1tltnmociydfs2ul( s;t)altnifciy1om rlneols)t2toxmpiudomeelnei s aDtr(  no1aetnmociad s eauvp;t4altrmrcty1op rliei (0tetoxrpoudlpt mieslsfartr(r no0tee  f3ilsls uanvs;t)aeermociy1oaDe nvo;(0 etoimpoo1llenlfesat a2uauro;o0oexnif3ias a em(msnu4 rxnxo tadlm r uvs (0 2to(o3no4omte fcil(faDurxm ;u0tleomfeias mDemuvp;t0tltoir3oadoate ueil( s2tm(r3ny1lptelietl(  2urumpot0tptniiciasla2rlums;(0tltrmf oo1fm elnvi;t0 rumxo3oodlptn nctlt) Dtm(mooo0olx ioeiltla2ra(mp;u0aetniocio1lmD aieo t s2uoxm io4omte nvias aDururp;t0tpxn iciatfm2eau s;()trtoxo tadlm ranei t s2xo(m oodlmtelnvtl(fsDur( o;t4oltnio3iasfm um(vp;t) rermrcoatlaDr nvo t srumxo3io1ameemnctas  2rmxm no1ape  feildlm eln o;u4arxnxr oydlaDeluvs;t) rtrxopiodolee fcilsf Dumxm ou4opeoifcilt m ua( p;t0alxnxr ta1oaDr ivo s) eumir oy4amee nes (f rrrur ;o1opx  ociyt sDuanmp;u)artnxocio1lateauvo ()srxm(mpny1lpeeliesas sDtm(  ;o0tptomo3iltlaDuluvs;u4alxrmrctydlpt luvsl(0t2ur(o nodoltnlfct s)aDta(rpnt0olen o3tlsfa em(vo;t4trxoxr iy1laD lnvi t srxo(r3nu4lp  lnvs ()srrau onu1apxnmfeiydfa2ran o t0 lxrmrctadomD an s t  ruoim3oy4lmtnlnvt s aDta( pnu4tle mieiysfs rm(mpnt0 rermo ootoaDrau ol()setm(opou4am n fvsa() Dtaurpnu4apxnmi3iysls emnms t4 etnxrcty1opDrauei s0 rtrxo3no4al  lnci sfsDururo;o0tle micilsfsDrm(mon(0arxomfcoadlmD aneo t0texmio3nodlmtemiesa(  rrr(mo;o1olx  feilsfa ea(vsnt)arerif tatlp elivo;() 2uoxopio1lleemnes tfarrau oou0tlenifcild s uan o;t0alxoxr ty1lat  ies;(0 rtm(o3ny1al nmnctat) Drrx pnu1tptoif3iat s2rmnmo;()trxoxoctytfm eluei t)srtr(o3oydll  mict ()sDraxm ot4opeo ocilsfs eln sn(4tlxrmrcoa1lptrlivols srxm(m iu1lm  mnesatf Drr(root0altnmiciltfs ua(vo;t4teerxfcia1lmDelivo;t t2xrim iu1ap n fvt sfarumump;o4tltn f3tytlm ulu on() eermrcootoptr nes;t) 2xmxmpiy4lmenmnvtat)s2uaxmpoo0tptomietldfs el( on(4 rtomrcia1fmte ivi t srxoxo no1al emiei s)srumurpno0tpen fctltfs2ulump;() lxoif oydfmteanvolt) 2urxmpou4omtelfvsa() Dur( poo0aptomiciytla ul(vo (0 lxrxf3oo1la eanvi (  eur(r3iu1lle mfei t) rumxrpnu4oexn fetad s ua(mp;u4 eerxr3ta1opt lneslt)teuoxm iodomt mfvils)a2tm(r no1alt ifetlsfs um( p;t4texrxr3todomD anei;()texoio3iy1opeemivia(  rtmxr oo1tpe mo3iatls eanvpnu4areoxo iotfmDe u o;s  2tmir iy1ll elfesa(farumxmpot0tee mociatla ulnmo;(4alenxr3iytom  lneo;t) etoxm3io1amtnmncilt) rrr(mono4ape iietaslsDeaums;u0arxoxrciadlmt ai i;( trtrio io1ap nmnvtat)a2uru p;t1texoifctlsfm rm(mo;t0trenmf ia1laD li i ()srxr(m3io1omtemivt s aDrmu  ot4opeomiciltla uau pnt4aeermrctodoaDelnes;t s2to(m3nydome  ictls s2tr( ono0apenmictyslm elnmp;u4tlxrxo tytomD ln s;( trtoir oo4omeelivta( s2rax o;o0apxnif3iatfs rl(ms u4 rtnmocoodfmtelnvol(0 eum(o nudlltnmfvtltfaDrau ont0oee mi3tldfsDeln o (0arxrmf io1la  auvs;() rurirpou4apeemnctl()aDrmu pou1aexnmietysfs emnmo;t0arermr todlm rlues ( texo(o oodlmtnlfctl(f Dtmu pnt4alxnmictadfsDua(ms u0aexoxr3to1opDe ivols tetrir3iu1omt livsls) rtmu  ;t1oetn icildfs eaumo u)trxnmrciadopt  ivs ()srtmirpnu1opeemfcsasfs2rr(mp;u1apeomf3ias s el(vs ()aeenxfciytfpDeanvilt) 2xrxm nu4ale lfvsat)srtrurpou1oetn f3iatfsDem( o t4arerxfciytoatelneslt seuoim3oo4lmt  ici s)s2tm(m ;u1aex iociydfm2rmn sn(0arxoiocootoat  iei;(  rtoir3no1omen fciltf Drmuroot1apx mf3ildla2em( p;u4trenirciotfaDelnvs;()t2xoir3iy1lme lneil() rtm(rpno4optoio3iyt a uanms;t0 exnmr oo1om rlu i;()srtr(m3oy4alt mncias) rrmx  ;o0tlx mfciyd m2rm(vsn(4tltomo3oadoptraues;t) exmiopoodomen fvtl(faDra(ro;u4opeomi3tasfa eanmo;t0altoiocoa1om eaivs () exmxm oy1ll  lfcsa(fsDuaxmpnu1tle iicild s eanmonu4 rtrxfcoatf
\ No newline at end of file
@@ -0,0 +1 @@
+uvi s s2uoxmpoydapee ncsat) Dtrur nu1alxn o3iytfa2rluvpnt0 rtrircoytoa  lieo;(0 2tr(o io4ame miesl(  2tm( p;u0teto ietldls2umuvsn(0tetnxf3iodomt lieol(0srtoir oydamtn neil( srrmu  no4tptomocild a uanms;()tleoif tatfptran il(0trxmio3nu1lle mivilsfsrtm(mp;u4tlenif3tlt s2elumo;u)teeoxr3oy1oa eauvi ( srtoir nydlpe  ivil(fa2ur( o;u1tle ifciydfa2eln s t)arxrxfctatoaDeai o;t tetmimpnu4llen nesas) 2um(mo;u4apen o3iydfaDea(vs;u0 ltomo3to1omteauvs () 2toim nydlme  ietas)a2ua(moou0apx mo3ilsfmDul(msn(0altrir iydfpD aivolt0 rtoxrpou4lmt micilsfaDtru oot1oex mieiltfa2rau onu)tlxrircta1la rai slt0t2to(mpnu1omen icsat s2uax pot1tee io3tlslaDuau p;u)arxnmocoadoa r n s s0 exm(opoy4alte icsa()s2umxrpnt0ale  i3iatfa2rl(mo u4aexrxr3oa1optrli olt trur(rpno4omtnmnetl(f Dtm(rpot1apeoiiciatls ua(ms (4alxrmocoy1fmtrau i s0 rxmxr iudlp  mfci s sDra(r nu4optnioeiatfa2umuvp;u4aeeoxf3tatomte nes;s0trxr(mpou4amte netat)a2umx  ;o0oeeoifetlt mDeanvo;u)aeeomf iy1lmtr n o ( t2uo(r3oodal emnciat sDtrumo;o1aeto iciytfaDumnmsn()alxrxf3tatlateluvil(0trum(rpou4olt lncias  2tmxm ;o0oltoiicilt mDuaums (4alerxo3oatfpD  i o;( teur(o iy1opeelivs sf 2rru pnu4apx iieilsfm umn s t0 renxo3totla   uvolt0 eumxo3oo1omt  fcsasfsDrrxmpoo0oet iiciytfm2um(vs (0alerir3totfmtrluvols0s2trxmpoo1aleelivt tfsDrmu p;o4alx if3iatfs2ulu snt4 leomo3ootlmDeauvs ( trurio nodop   netlsfa2taxro;t1altoio3iydfm2ra( on()texrxr oydomDe iei ( t2xmio nudlme  icsl()sDrmurp;o0oetnifciydfm2el(vpnu0trxrmrcoadfmD lies;t srxrxopou1lpt mnvi (fa2rau pnu4aptnmietldlsDean snu)aetrmf oy1la  aies;t srurio3nu1op nlicsas a2rmur nt0teeomf3ild mDrmnmp;u4tetrmr3tydlp  auei;t  rur(m3no1apt lfci sf rrrxmpnt4altnmoetlt m um(vo (0 lerxf oodoaDe nei ( seuoxm oudlp nmncsasfsDrmxmo;o4olt  o3taslm2ra(mo u0arxoif totoateln slt0srxoxr3iy4ll e neias  rtaxrpnt0aexomfeiat a2uauvp;u)areoxf3oytlate nvo (0 exm(o nydaleelnvt s)srtru oou4oleniictytls2elu on(0tltnif ty1oaDr uvo s0sexmxo3nu4apeemnctls)srtaxmo;o4tpen o3iatla2elnvs t) renir3ootlatranvs t  2uoir ny1lmee fctls  rumum nu4apenmiciad a2eln pnu) ltnmo3tydom e u i;(0s2tmxrpnu4opt  fct t sDumx p;u1aleo feild m2ran o;u) rxrifcta1faD anvil(0s2uoim iydamtnlfetlt arum(rpnt1aptomfetasls uanvs;u4aetrxrcto1fa raneo;(0 2urxm3oydap elfetlt) Dtrxrpnt1oex mo3iysfaDua(vont0 leoxrciytfat  uvi (  rxoxmpnu1apeelnesls) Dururo;o4alx mf3ilt s el(vp t4 eenmoctydoaDran sls) 2xr(r oo1lltelnes (faDtr(rpoo4aleomfcildls2elu p ()aeenxf io1oaDrau s;()s2ur(mpnu4al nlfvsas)s2urxmp;o4tleo i3ias m2umn pnt)tlxoiociadlmDeln olt0t2to(mpoodamt lnet (f Durxr oo1oleo ieiatfm elu s u)texomo3todopt lu s;t)teto(r nu1olt lnesasfsrua(moot4opt  o3tys aDel(mo;(0altomo3iadfat  nes;s)s2xrio3oy4op n ivsas)srtmxmp;u1oexniieiadlsDeaumo t0 exomr oa1opDean o s seur(mpio4lme lfci t)sDtrxrooo1tlenmi3ild aDemn o;t4tetomo3iydopDr ueols texo(m io4al n fctl(fsDra(r oo1oltoiicildls2elu sn(0tleomr io1fpDeli ils) ruo(m nydlp e nvtas)sDrm(m ot0aexn ocils a2rauvs;u4arenirctodop eauvslt0tetrio oo4ap elicils)sDraumpno1olxnifeils mDrlnms;u0 rermrcootlm   uei ()tetrimpou4amtn fci s) rraxmo;u4olx mf3iytfa2elu s u) eeomo oadla   uvol() 2xmio oo1lmt lncia()s2um(rpnu4tle mfciat sDum(von(0teenifciadfa e n i s srxoxo nodap  mfvslt)s2taxro;o4tee iicild s eanvs t4 rxnxrcoydfmD auvilt)s2trxm iu4lmtnmnvil(f rrrur no1oleoioetldlaDeanvon() rxrxf3tadom  au i t0 2uo(o iudal n ivt () rtrx  no4aetnmoeiasfa2el( p;t4aexrmf iotfm  li ol()t2xrio3no1aptelfesltfaDtru  ot0tlx  ieiltfm rmump u0tltoir iytlmt  n i ( s2umxm ou1amte nvtl()sDrmu  ot0ole ifciatlm eanmp;u0tetrio tadoptrluvs;(0seuoxmpiodll nmnet t)arta( o;o0tltniietat a ul(mpnu) exoir3tytoaD lnes;s  rumxm no1amt lfvt s) 2raur nt1aet  iciad mDua( s (4 etoir3tatlat  nvilt)teur(m3nudom e fvt tfsDumxmonu4tlenmfciydla eauvo;(4 rerircoodlptrlivi t) rur(m3ny1am elfcsls)sDrmumonu4aptnifciytfs uaump (0alxnif3tadom elnvs (  rtrimpoodape lncsls srtru oot4aet mociydfm umuvpn()alxrmr ootlpDr neolt t2xmir3oo1opee ncsas s2rm(mono4oeen o3ils s2ea(vpnu)teermf oo1fptr uvsl(0 2to(m3iydom emfct sf 2ra( pot4aleoifeildfmDelnvonu) rtnio tadlp  aies s  ruoim oy4lm  mies ()s2rmu pno1olxnmf3tytlsDel(vs;(4trtnxrcto1fp r ivilt  2uo(rpoudlmeemnetat aDum(m nt1aex  ieias aDea(mo;u4artrxrcty1fat lnvo;s  2toxo ny4ap nlnctls)srrrumo;u4tltn octys s ua( p (0 lxrxo iadfateauvs s)texriopoy1altelnetls) Drr(mpnu4tetnmf3tas m em(mont0alxomo3tadomtraivs;( sexoxo3no1alt lnvtas) Drmum oo4tpeo oeiyd aDumn sn()alxomr3iydopD aneil()trtrio3oodlp emfctas srurxr oo4apto oeild a rm(msn(0tltrxfciydlpt anvi;(0t2xoxm oudopeemnvia(faDtrumpou1oltoifcild aDumuvo;u4trtrmf3iydlate n i (0srxoio3ny4oltnlivs (  Duax  ;t1olto f3tld s2eau s;()trtrmfciotfpD anvs;( t2tmxr3nodop  mnctls) Drru  nu0ale  ocild m rmuvont4 rerxociotoaDeaivs;(0seurir oy4lm  lfetas a2rrxmo;t4ope mi3ildlm2em(mpnu0 rxoir3iytoat lu o;s0trtoio3ny1ol nmnvil() rrmxrono0aee  f3tldla ul(vpnu0 lenmrciatlpt livs s0teuoxo3nodaltn netasf Dtmu  ou0altomfetytlm2umuvpnu4altnxrcoydfpDrli o (0srtmxopoy4ll emnei s)arra( pou4tle if3iad mDrluvsn(0trxnmf io1op ranes ( setr(o3io1lmt  fvi t srumx ont4ope ii3tyt m2el(mon(4trxoxr3ta1optr uvo;s)t2umiopiy4lm n ici tfs2rm(rpno1oex iietytfmDemu sn()texnio oa1omDr n i ()sexoxrpnodamtnmfeilsf 2uax pnu4tet  oeiyd a2rmnvpn(0trxoircty1omD lu ol(0 eur(m io4lmen ncs (  2tmx ont1oleoif3tlsfa2rmuvsn()arxrxo3ootlptraieils)tetr(r ou1llt mnciatfsrtaur ;o0tltn oeiat aDeauvp t4 etrxr iotlatr nvo;t)trtrxm3nu4amtelfvilsfarumuro;o4aleoioetls m2umu o;t)texnmr3tadlp r n o s truoim3nydap elnesl( sDraum ;u4oex mietldfaDem(vonu4aetrxoctodfmteaivi t srtoiopny4omtnlfci s)arrrum ;u4aexomiciltfa rmnvs;(0aetoxocoodfp r ivs s) etoiopou1ale lncta()sDrm(rp;u0altnioeiltla em( p;(4aexrmrcoa1fp  ai i ( trum(m3oy1ape miesat)a2trxrp;o1oexnmi3tlt sDran o u)trxoxr oa1omDeai o ( srxr(m3ny1ol   nvs t)aruax  ;u4aetn i3ilsfa2em(msnu0 lenmo to1omteaues s)trumxmpio4ape  nesls)sDtax  no0tpe mi3iysfaDrm(mp;t)aeeomociotfmDelieils0 2xrim iy1lpt lnvtl( aDum(  oo4ole mfctasfs2umnmpn() lxoio iadoa  lueolt s2uoxr3no4lpe mfeia(faDuax oou1teeomoeiadlm ra(vsnt)alxomr3totfmDelu i;s0srxrxm oy4ol nmicias) Draxmoou1apen fciyd m2eaump;u0alxoxfcootopt  u ils  exm(r3iy4alenlnes t)arua(ronu0tltnmi3ias a2eanvs t4 reoxfcio1fpD  ivi;s0trurxmpio4al e ivt t  2rrurono0alxoifetysls ulnvpnu)arenmf3ootlm rli i (0teum(opiy1lm nlnctat) Dtm(m ou0opxo iciad m2ul(mont4tlenif oy1op   neo () eurimpoo1llt  nci (fsrta(m no1tlt  oetysfm2ul( onu4teermrcoatfpte nvo;(0s2xm(m iydamtemnei t) rrrx  oo0tpxniicils m ra(vpnu)tlxnio3iotlptrau o;s0 exmxr3nu4lptnlnctlsf 2tmu pno4altn i3iydfa ua(vsnu4 exoir ia1lpDe ueo t  2umir oy1lptn ietatf Duaump;t0tlt ifetlslaDulnmp;u0altomo3oa1fmDe uvs;s teur(r3iy1apee ics ()a2umur ;o4ape mictatlm raumont4alermf tytlptraivs;s0 etr(m3nu4altnmicsl( aDrmumo;u4teto ocildlmDrmumsn(4texrir ty1opDe ivi t)srum(o3ou4om  lfesatfs2trxr nt1olenifeiatfa2eauvo;(0 exomo3todlpDrluesls srtmim nu4ap   fvtls  2tm(moou1tpt mictydfaDulu p u0tlxriocio1op r i s t) euoxo3no4lmenmfcsasfsDraurpnt4tpe mfetadfm um(mp;t)trxrir3totlpt aiei;(0s2umimpoy4opee fcsa()s2tr(m ot1tltn i3iat m ua(msnt)areomf iotomteauvo;s)sexrxr3ou4al  mies t aDur(rpnt1tex moeiasla ua(vs;t0 lxoxfciodlptrai i;(0trxr(r nu4lmtemnciltf Drrur nu4tlenmfciaslaDeanvo;t0aetriocoatlmtelnes (0sexoxrpiodoltemncsas s2rmxmonu4olt  ieildlm eanms t0tltoio3ty1op e ivo;()teumirpoodolen fvil( sDrm( oou1teto ocias s2rln p (4 reomf ta1fp elues (  rxrxrpiudoptnlnciltfs2tmxr nu0apto fetytfs um(vpn(0aexnmf3todomt  n sls) euoxr nudamenlies ()s2rau ono4tex iocild a ul(msnt)aexrirciytomDean i s0 2xr(mpny4ome livsat)sDtr(ro;u4aeeo feiadfm2ulu p u) exriocoo1opt ai slt)s2xr(rpiy1lp elict sfaDtru ono0oet  fcildfm ulnvp;(4 exomr3iydfp  ai s t)seumim3ny1llenmnes s) rrm(rp;t0optniictlslm2ua(vs t4treomf3oy1lpDr uvi;t tetr(o3no1lm  lfvt (fsrtax  no0aetnmfeilslmDrlu o;(0arxoxfcoodfpD  ivol(0s2xo(o3iydom  mivslt arraur oo4tpeoif3tad s2ea( o u)tltnircoydlm eaneo ()srtrimpnydomtelics tf 2uru p;o0aptnmicilsla2ul(mp ()tltoxf oadoaD livs;(  rxr(mpoy1omt mnctls artrxro;t1aexn icilsla2el( onu4 rtnif todom r ieo;s0s2xoio iu1lm nmnet sfa2ra(mpoo0texo feiltfs umn s u4 ltnxr3iodomteai o;( t2uoxm oo1lmeelnet s)s2urx o;u0opt ioetysfa ea(mp u4teeomfcia1oa ran s;t)t2xmxrpnu1lmt lfeta()a2trx onu0oleomoeiltlm2uluvonu4tltnmrctotlm  ln o s)t2tm(o3oo4lm   iesltfs2ra(  nu4opt  f3iasfs ulnvp (0altrmr3oy1fa   u sl()t2to(r ou4oleelncia(fs2ur( ooo0olx mieiaslmDulumo t) rtrif iatopDeaues;t)srxm(o3iy4lp nlieiatfs2rr( pou1alt  o3iltfa rmn o;u0trerxrcoa1omDran i t0t2to(opiydoltn ivi t)srum( oou4altomictas a2rmuvp (0 etrxf iadlaDe n sls0sruo(m3oy4opt mnes (fsDrax pno0olt io3iydfaDrm(vp u)aeenif3iadoa   uvi ()tetr(m oodll e nvil(faruaxrp;u0tpeomocilsfmDrl( snt0artoio3oydfatelnvs () rtmxr nudlpe  ivi ( sDtaxmont4texoioctlsfaDem( pn()trxomo to1fmDrlnvsl(0 rurir oo1op e fvsl()aDua(m ot4aexo ociyd a ul(mp (0aetnmr oytfpDeln o;( s2xmirpoo4omt lieilt)a2urxmo;t1tpxomoeiytla2rl(ms;u4trenio ty1oaDe ues;( setm(r3oy1om   netl( aDuau ono0ope if3ilsfa2ua(mon(4trtnxr3oatfmteaueilt)s2xmxr no1opee nvia()aDururpnt4tet mfcildls2eauvp;(0aetoxocoy1fmt lues s t2tmxmpno4amenmivta() ruaumpnt0aleo ociytfmDrlu p u4altnir3oatop   ies s0 rxmio3io4lpte neias aDtaxrpnu1aexnmo3ilt s2em(vs t0 exniociy1fpDe u o;()setoxm3no4al nmfcil( arrrxr ou0alxn feiadlm rmnvp;t0artrmfcto1lp rlivo;s trtr(rpnu4lltnmnei tf rtauro;o1olx ifciyt m2elu pnu) leoifcty1lm  anvs;s0sexo(m ny1al elivs s)sDtaurp;t4opt moeilsls uauvo;t0trxomfctotoaDrlu olt sruo(opnodapeelics (fsDtaurono0opeomieias a ulu p;t0 lermo iodopD  neo;(0s2xoir ou1alte fvslsf rraum ;t1aeeoifciadls2emump;t)trtrmrcty1lm rauvi t)srxr(o oo1lpenlivs (  Draxmp;o0alxomoctldfaDran ont)arxomf iatlaDrauvs (0 eum(r3nydol  licia( srur(r ot0tet io3tysfm2emu pnu)trerxr tatfaDelnesl( t2urio3ou4opeelietat)aDrmxrono0alen fctldfm2umnvp;(4alerxo oo1opDr uvs s) rto(mpiy1lp emfvtl(  2tmxrpou0alxnioeiatfm2um(vp;t) eeoxr oodoptelnei;(0srto(r3oodalee fct t  2umumpnu4apt  o3iysfs ea(mp u4 eenif3iadlm e n s;s setmim oo4ll  lfeta()srrmu o;t0oleomoetltlmDra(vo t4 eeoxfciy1op  an s s0trurxm ny4apeelnviat) 2tax p;o4olt  o3ilsfm elu sn(0trtrio todomD anvi;s0trurirpiu1ol   iesat)srtr(rpnt1aetoif3ildlaDran s;t0trtrmo iydla  lnvo;( t2xmir io4om nliesa() Dra(rp;o1oleo octys mDra(ms (4 rtnmr3io1lpD luvo t)teurim3nu4ll n ivt tf rum(rono4oex mo3iyslm2emuvp;()tlxomocio1omtelivsl(  2uo(o iy4amen nctas)sDrrxr nt0apx  fctys a2uanvs (4aexrirctodoaD au s s0 rurxm3ou1opeemici s  Dtau ono4optomo3iltfa eanvs t) exoxrcia1fpt lnvi;s0texoxrpnudamen fvi s)aDrauroou4opeoiietasfm um(mon()aeenircty1faD  neol() etm(o ou4olt mictl(farrmxr ;u1texo oetytfaDrm(vs;u0trtnif3tatoa   uei;t0 2trxopny1olt lneilt) Drrumpou1olenmieiatlaDra(msnt) renir3iydlpD anvilt tetriopoo1lm  mnvsa(fa2uaump;o0alenmfeiys sDelums t0altnir tytlp   uvo s seuo(opoo4alt mfcil()sDuru  no0altnmoeils m2rm( o;t0areoifcio1laDrauei;t) 2uriopiu4omeemictlsfs2tmxmpou1aet moeiysfsDrmn ont4 renmf3iytlp eauvi;t0setmxmpnu1lm elfes (f 2taurp;o0tpxo oetatlsDuauvo;u)alxnirctadlatrlneo;t) exmxr no4omt livi sfa2rr(rpnt1ape ifetls a2ulu pnt0 ltomrcoydfaDeanesl()s2tm(rpoy4optnmnctat) Durxrono1ope  oetyd s2ua(ms;(4tltoxf iatfpDr nes;t0t2tmxopiydap emnctls s2rm(m ot1apeo i3ildlmDuanvs;u0 rtrmo3iatfpD aiei (  2xo(m3nydllte ivilt arum(m ot1opxn fctldfaDrl( o;u)trermo iydfa   ueo s0trurir iodoltelivta( aDua(r nu1oexniietltlm2el( o;u0arxrmf tydfptean ols0 rumio iodalt  ncsas a2uaum no1oetoiieiatlm2rau snu)aetnio oy1lpDrlueslt s2urxm3no4ame  ivtasfs2rmu p;t0tltoiociytls ul(vs;t4aeenif oodlaDraneo s srurxo iudlm eliviat)aDtaurooo1apeoifciadfs2rmu p u)arenmo iodfaD livi;s0t2umxmpiu4oleemfviasfaruau ont4olt mfcildfsDrln snu4aexnio3io1lateaueo (0trtoxmpny1om e iesasf Duaxmoot1tltoifcils s2ea(mpn(0aeerif ta1oa ranvi;t setr(m3io1al emnvs t)a2tmxrpot1apx  f3iysfmDrlnvs (0aexomociytfmDelnvil()s2umxm3io1lme  ici tfsrtmx  ;t1opt  iciadfs uauvo (4 rxrxo to1lpDe n ol(  rum(rpiu1amt livil(fa2umum ot1opt io3iasfs rl(ms;(4texoxr3iodlm rlu o;s0srtmxo nu1lp e fvi (f 2rr( o;u4apenii3iadfmDeauvo;u4 etomf oo1omte nvs;(0 rtoiopiydam  liesl(f rtrum nt1aex  ocilslm ean p u4treomf ia1lm e ivslt0 rurxm3iydlle mfctatfarurxr ;u0tlt ifeiaslmDra( ont4treoiocta1fmtran s t0 2to(o3nu1openmnvtat aDtmu pnu4teen f3iasls ea(vp t)aeerio iodlmDrlnes s0 2toio oy1op elncta( arurur nt0tleo o3ild m uanvs;u0 leomr oy1lmtelueo;t)s2toxm3ou4ap e feslsfa2taxr ot0tlx ifetldfaDum(vpn(4 lxnirciatoaDe neols0texo(m no4op n fesl() 2tmxm ;o1oet ii3iydlm rl( snt4tetoif ta1lmtr uvo t tetm(rpoudll e fvtltfsDrm( o;o4oexo fciltlmDemnmo;u) lermf3io1fpt aieo s)s2umir3iy4om e feils srtaumont0tlx mf3ildlm uaums () leomrctatom  lueo;t) ruoirpio1oltn netls) 2tru  nu0olt  f3iat a2rmn o;t4trtrxr3oa1oa e ivs t t2xoiopiudllt licilt  rtm(  ou1aet  o3tls sDemnvon() etrioctadfpt auei;t  rtmxm3oo4lmeemnvs (f 2rm(rp;u4apxn o3tld aDul( o;()teeoifcoa1fmt  ivils0seumio ny4ale lncsltfaDurur ;t0ope moctatfm emnmpnt4 exnxrctadomDr ivils0 exr(o iydalee ieslsfsrtrxr ;o4aee mietadls ea(vp;t0artnxf3oydfp   ues;s0t2uo(opnudomtemieiat)sDrm(rono0apx mfeiydlm uanmo u4tlxoxrctodomDeaneolt0 eurxm3oy1al nmnctatfs2rr(mp;t4tlxnif3ild a rlnmp t4arxrmo3ia1fmt lu s ()truo(m ny4am emivsls artm(  nu1alx mi3iasfsDuluvs u0tltoxrctytfatrai ols0teur(mpno4al n ivt s) rur(  ;t0tpen fciadfa2elu p;t0tetnxr oadlp eauvi;s0s2tmxm3iodlp e nci s) 2umxm oo0tle ioetytfa2eanmsn(0tleoif3oa1op eluvi (0trtmxr oodll e nesa() rtrumont0ole  ieiytfsDum(vpn(0 lxoio ootlmt livs;()t2xmxrpoydomtnmici tfa2taxmonu4tee  icild aDrmn pnu0texomr iotfa rauvs;t0s2xr(m3nu4lle  ies sfa2raxmp;u1tpxn feiyslmDum(vsn(0trenif3iodopDeln o s s2to(m nodll emfcs tf Dtaxmpot4tpxoiocildls2rmuvsn(0texrmf3oa1latrai s;t  rxoxm iodlmte ieiat s2tmxr no4aleo fciyd mDuln s;u4texrif tatomDr i i t) rxrxopou1lmt mnet sfarrau ooo0opxnif3tadlaDumn s u) lxrioctotoate ivi;()s2toxo3ny4omtnmiesa( a2trxmo;t1olxoiieilsfaDumuvon(4trxnirctodfmt  uvi () 2urio3ou1al n fei (f Dtr(root4tleo ictadfa2rl(mp u4artrif3iotfp rln i s0trxoir3io4apt  fes t) 2raur ;o0olxn feiytla rl(vpn()texrxr3todlpDeliei;() 2ur(m3ny1ll nlncia( a2umurpnu4tee  f3ils s em(mp (0trtnxf3oydoa  aieo s  etm(r3nudllteliesa()s2rr(monu4opeoio3tytfa2em( p u4 rtrir3iadoptr nvi s)srumimpnudllte fei s sDrr( pnt0openmieiatfm rlnmp t4trtnmociotlp  lu o;t0trumio oydalee fct sfa2rr(ro;u1opeo ociyd mDeln ont0tetomrctadla elueil(0 2urxrpoo1lpteliesa(  Dra(mpno1optoif3iaslaDrl(vs;u4 exnxr3oatomD  ies;t  rtoxopou1llen ivtl(  2trx p;t0alto oeiysfsDem(mon()teenxocoodfpt lneols0 rxoxrpoo1opt lfetlt  2tm(rpnt4oexomfciat s2eluvpnt4 renifciytlp   nvo t0srxm(r no4om elicil(  Dum(r ou1aptn i3iysfa umnvo;u0tlermf oodfm ran s;()t2xoim oodop emfcia(  2taum oo0opeoiieiytfa2rau o;u4artnmfciodfpt lnes t0t2urir nu4al  mivs tf 2rruroot0tpeomieiatfaDemn s;u4 lxrxf3oytomDe n i s0 2xoxm3io4om  mfvsasfsrum( ono4tltn fciydfs eanms;t4 reoxfctadomt  n i t)srxrio oo1altn fvt t)arrmuronu4teeomfciys m rlumo (4alxnmfcio1oatrln s ()srxoir nydap elfetas  2ua(ro;t1ole moetldlsDeanmsnt0texrio iodlmDrlnvsls  2xmxo3ou1ol e icsl( aDtr(r ;o4oexo o3ias sDuaumpnu)aetoxf3iytfm rau ol(0srumio3ny1alee fctlt)s2ta(rpoo0alt ifciatls em( o;(0texoio3io1optelneo t  rurxrpny1ol emfvsatf rtrx o;u0oeenifeiat mDul( p t4treoirciatfpDe n s ()teur(r3ou4lltemfct ()sDta(  oo4oexomfciyt s2ua(vsnt0 eeomr3ty1fpD aieo;t seumimpoudoltelnvtas aDtrxmono4aeeomociasls ra(vonu4aleoxo iadfa rln i ()t2toir3oo4ale mfei t)sDrmxm ou4ale mietytfa umnvs;u0artrxr iadlmte nvs ( s2uoxopoy1lptn fes t aDta( o;o4olenio3iad s rauvs;()teerxocia1fp elues;()truo(mpoodome liei t)srtrum ;t4tptomoetad s umnvsn(4 exnmo3tadfp  lu s t0 rurio iu4al  mfeslsfarra(  no0oltnifciasfmDulu p t4 etoif iytfaD  nes () 2xm(r3iudopt mfetls arurxmont4tetnmoeiydfm2umn p;u) rtrifctatfp e uvi s)trxrimpiu4al e nct s aDtr(rpnu1alxo feiytls2rmnmpn(4teeomf ia1omD lnei;t  rxo(r3no4oltnliei t) rurxronu1optoii3iadlmDrmu o;u4 rermf3ta1fpt  i o;s0 2umxo3nodlmt  iet t)a2umumooo4alxo o3iyd a uluvpnt0areoio3tytfm raneils0 2tmxr3iudlltemicsas)a2ra(root4olx mfetldla um(vo;u)aleoif3iydomDrlivolt0 2um(m nydomtn fvsa( srumxro;u1alxoif3ilt sDrauvo;() lxrmo iadfa e uei;t seuoxopnu1opeemics (  2ra(  no4teenmietatla2ean s u4aetoircootfp  ln i;s  etrio ny4om nmncs s)artaurpnt1opxoiociys a rauvsnt0teeoxoctatlmtrai o;s truoxr3ny1al e fcil( s2uaur ot4oeeomicils s umums;t0trerif3oa1oa elnvslt s2xo(opoo1lmt micsat) rra(  ot4tlxnmfciysfm2ra( pn()altoifcoodlatelnvo t) eur(o nodolt lfei ()artm(rono4opto i3ild m2ua( s t0aeeoxfciadomD livslt  2xo(opnu1al e nvilsfs2uauro;u0aetnii3tyd a um(mp;()aeeomr oa1la  lneols  2uoio ou4opte fvsas)arrm( oot1alto i3iad mDel(mp;u4 lxoio3iydfa rln sl( teuo(m iydlp emfvsa(f rrr(r ;t1tlto o3tys aDemuvsnt0 eeoiociydlp  au sl(  rxm(o iodol emnetlt arra(mo;o0oetnmoctytlsDumnvp;u0arenmf ty1fmt aivo;t)texo(m3oy1opeelnviasfs2uru p;o0tlxnii3iatfs rlu p;(4 eerio3oatfpDr nes;t  eurir3oudlptelfciasfs2rr(r ;o0apx  ociad s2rmn p;u0 ltoxrcio1opDr u sl(0setmim3iudal emieia()s2rmx onu0oet mfeiytfa2um( pnt)aetomr io1la r ieo;t s2uo(r3ou4ol e fct sfsrrr(m nt0optn oeiytls um(vonu4 rermfctadfaD lneo s tetm(opnodom elicsl() rum(rp;o4opxomf3iltfs2rau sn()trerif iydlatran o ( trxr(mpio1alenlnet s)srurump;o4aet if3ilsfa2elnvsnu4 lxoxociadlp elnvils)s2uo(m oo4ll  mnet ( sDtmx oou0teeomo3iydfmDuanvs;u0arxomf3iydop rau slt0trtrxmpny1amen netlt)aDtaumo;o4aeenmo3ild sDelnvsnu0 renmo iatfp  an sl() 2um(o iodolenlneiltfa2tauroot4aptoifeiyd m2ea(vo;(4 rtnxr3oydoate u o () exrir iydlmtnlfvi (fs2tax  ou0tptoioetaslm rmump;u4aeeomr oadfmDelnvi s) rtrxopoudlp  liet ( a2uax o;o0optomfcilsfm uau s u)teeoifcta1lmteliei;(0srxrio3iy1lptnlivi s  2uaurpoo4apenmo3tlsfsDrmuvp t0 lxrxr todoat  ues ()srxrirpoudomenmies s aDrr(  nt4alxoiociatfsDrauvsnu)artoif todla  lues;() ruo(m3nu1oltelncia(fsrumumonu1alx  fctys s rl(mo t4altrxo oa1latran s;(0trtoio3nodlmtnmnetas)s2rrx ooo4teto ociasfa2rluvs;t)alxrmrciytom  ln o ( s2umxr3nu1ap elivtlsfs2uaum no0tpt if3iat m rln p u4tleriocoadlpDeai o;()t2trio no1am  lnvt ()a2taxr nt4ole mo3tytfaDel(vo;t4areoifctatfpDe ieilt s2to(mpou4olte netls s2ta(rpot4oet miciysfs rmumonu0aetriocoodopDeai o ( texmxm3nodoltnlfes ( s2tax p;t1aeenmietasfa ulu o u4tlxoxf iytopDrlueils0s2toxopoo4omtnmfvia( srtaxmpnt0aeenmo3ias aDum(ms (0teenxf3iadfmDr u o ()seuo(m ou1ll  mncilt aDurxm nu4opeo fciatfsDemums;(4arxrircoy1fpDr nvsls0t2xmxmpno1lltemictls)a2tr(m nu1tpeoifeiadfm emuvs;(4 exomfcoydfa e uvo () 2trxo nudamtemici ( a2taumont1alxnmo3tlsfs ulumo;u4 lxniociatlpDrlieil(  2xmim iydlpee iesa( aDum(mp;o1teenmf3ildlm eauvpnt4areoxocoy1fmD anvsls0 2xmir3iu1aleemivi tfartmu oou4teto ietydlm2uan o;(0alxrircoadfaD luvsls0s2xmxmpnu1omtnlncils srumxro;o4oeenifcias aDrau o () exoxfctotlmDeanvo () 2tm(r3ny4lleeliciat sDurumpnt4ape  o3iydla2ea(mont0aeerxfciatla   neol(0s2urir iudolenmivilsfs2uaxmp;u1oetoioetys s el(monu4trxrmoctodlp ranvi ( trurxo nudame mnvt sf Dta(m ou1alt micild m2ulu p t0tleoir3iytfp ranei t) rxrxrpnu1lltnmfct s  Drr(m no0aeenmfeilslm ea(mo;(0aexrio3oadomtrauvi s) rto(opiu4aleelfetlsf rrmxmo;t0aee moeiatlmDumuvpnu4aetrirctadoaDrln ilt0t2ur(m3no1alt mfct s sDum(mont0ole ifeilsfa2rluvp u4alenio io1op ranesl(0srxm(opnu1lmenmnesas srrau o;u0olxoiiciysfm rlu s;(4treoxr3iadfatr ivo t0t2xoxm3ou4aptelfesls)aDtr(mpnt1tpe if3iys aDeau sn(0 ltoir3totfmt auvslt s2umimpoy4lm emfcia(fs2um(r ;o4alxnifeiyt a2rlnvsnu) rxrxr3iatfptrlu ils  rum(mpoydal emnei (faDtmurp;u4tltnmieiyslm2ulnmo;() etnmf tydlaDrln i;t t2ur(opnydopt mfvslt s2ur(mpot1tltn oetlsfm rlu p;t0 eenmf oa1latrauvo;t)trumxm3iy4omtemivsl( artmu  nu0oee io3iyslsDul(vp;t4artomf iodlaDrauvs;t sexm(m nu4op nmfci tf Dtmxr ;u4apx miciat a ul(mo;u0 eeomo3ia1oaDr u i t0t2xrxm no1ape lncia(faDta(rp;o1aeeomf3ild a2rmnvp;u4 exoirctydfmtran i;(0 eumim3no4lpt mfvsa(fa2rrx  ou1optn i3iaslaDel(vp u4altoif3ootfm eanes t trtrxm3oo4omenmietasfsrrrur nt0optomfeiltfm2eauvp;u0aeerio3oa1fpt au slt0tetrim3nudll  mnci s)a2trxrooo0ape iiciydlaDuan p;t0altrmf oydfptrln i;s t2umxmpou4lpee ics sf 2ua(rpnu1opt mieiad s2ea( s t0 eermrcoadfmDraues t0srtm(opiudam  mnctl( aDrr(mpno4aeen i3iadlsDrm(vo;u0teeoxrciatfm   u il() 2xoimpny4opt liet ( aDraxro;t0aet ifeiatlmDuanvp;t)tltrio ty1fm eanvils t2tm(r nudom  mfvt t)a2urxrpou0tetn i3tad sDrl(mo ()artoxf todopt  u ilt trxmxo3ou4opeemies t)s2umxmpno4aexnmiciysla raums;u0 etnmo3oydoate ues;(0tetrio3nydomt  nvtas  2um( pot4tpxomictydfmDea( p;t4areomf3tytlp   ues;() euo(r nodom nmnvtls sDtmxr ;o1aetoiociltls eln o;t4arxnxf3tytlm  au s;(0trxoio3oo4al n ictatf Dra(mo;u0tpenmo3iltlaDuaumo u4aleoif tadopDrai sl(  2uoirpou1aptn feils  2rmxr ;o1tptn oetltfs2emu o;u4arerxocoydlmD aivs s seurxo3oo1om nlivt (  rtaxront1aptnmoctld m eauvsnt0 eenmfctodoatelnvs t  2uoiopnodlmtn feslt)arua(mpnt4oeeomi3iyd s2ulnmpnu4 renxf3totlm   n i;s)texmxm no1omen iesltfa2tau o;u0aex mieiltla em( o u)texrir3iydlmte i ol(0 2toir nydlle  iei s sDtmx pot0aet mieiytfa umumonu)trerxr3oatlat anvil()t2tmim nu1lmte icslt)arrr(r ;u0opeo feildfs2emnvo u0tltrif3totfmDrlnvils  rtm(o no4omee nvsat)srtau p;o1tltnif3iysfs2elumpn(0trxoxr ty1lp  anei (0srxrirpoo4lpt mfeia( aDumu p;u4openioeild aDumnms;u)aetnxocoa1fmD lueo;( trxm(m iy4openmfcia(f Durxmpou4ope  ietlt m2umums;u0 ltnmf3todfmDelivo t  rur(r3oydaltelivtas a2tmum nu4oexoiieiydlm2ra(vp;t) exnxo3oy1lpDrauvo;( teuo(o ou1omenmfci ()s2uru  no4apt  o3iydla rmu snu)alxrmo3io1lmDr n olt setrxr nodlm elnvs sf rrm(root4oltomf3tltlaDulu o;u) rtrxr3tytlmteau i;(0srum(m iydamtnmfci t a2taxmont0texoifctltlmDrlnms;t0tlenmf oadoat lu s () 2uoxo3oydol elivs (fs2rmumoou1aptnmiciytfmDumnms t0treomo ootomt lu s;t  rxr(o oy1alt  iei ()a2uaxronu0olenio3ildfmDrm(vp u4 exomf3oo1omt aieols  rum(opiy1lme lietas s2rr(  no0ole moeiysfmDraums;u4tlxomoctadoa eln ols0 rtoxopny1op  mnvsat aruru pnt0opxo i3tldfm2eluvo t4 rxomf iydfptranes;t)trtoirpnu1amteliei t  2taur ;t4tltniictysfm rmn pnu4artomfctadlmte nvil(0tetmxm3nu1om nmnvi ()s2rrxmo;t1aetnmiciys s el( snu4 etoircoo1lm elivi (0texrxrpoo1ap elics (f Dtax ont4oee  ociadla ra(ms;u4altnxf3oydoa rauvi;s0s2tmirpio4opeelietltf Dtaxrpnt0opxomfciytfaDra(mpn(0teermfcia1fp raiei s0s2urxr nu4oltemivs tf Dtr(ronu0oetnmfciydls uanmsn(4tlxrxfctatom  ai i;s s2xoimpiy1omee icslt) Dtm(rp;t0olenmoetysfs2uaumpn()aetnxf3iytfmDeanvolt0trxmio io4lmtnmneias sDrax p;t0tlxnmociydfs2ea(vo t4trxrxo3ia1oa rlu s;t0 2tr(r oo1lm e nctat arua(  nu1alt if3ilsfs2eaump ()alxnmr totlpD luvi;(  rtoxrpny4lm nmivilt) rrr(root1oee  i3iasls2elnvo;u)alenir tytlmt  u sl(  ruoxr3iu4llenliesa()arumxmpno1oltoiieildfm2rm(vo t0aexrxr oatlp r n ol( sruo(o oy4apte fcta() Draumo;o0altniociatfaDra( p;(0arxnxrctytom eluvo;s0 euoirpny4lm nmnctltf 2urum ;t0tpenmfetas a uan p;t0teeoir iytoa  ln o;s)sexm(o nydapt mictls arraxroou4oexoifetlsfm2ua(vs (4arxrif3oa1lptelu s;s teurimpny4lmen nci t)a2rmumpno4tpe  fctyslsDem( o t0alerxr3iy1lpte nvsls0s2ur(mpio1aptelneta(  Dtmurpnt4olxo ocildla2ra(msn(0aeerxf3to1lp r uvo (0seumxopio1alenmfvil(fsDtmxr ;o4oexo ociaslm2rluvsnu4treomf oytfp e uvo;t) 2uo(m nu4lp n ics () 2um(rpot0openii3iydfm ranvo t0 lxnircty1oa rlu i;t)t2to(o3oo4al nlneslt sDta(rooo1ale  feils mDean snu) eerxo ta1fpDe ueols  rumxopio1olenlietat aDtmx p;u0aleoio3ils s2rmuvs u)tlenio3ta1fm elnvi () rtm(m3ou4ap  lfci t)a2ra(rpoo1oleoioctadfm ea(vs ()arerxo3ia1omD lues t trumir oo1ale lncils  2rmurono0oet  i3tldfmDum(mp;t0tlermf3ty1fmt ln ils s2tmxr3oy4lm  mfesl()artrumoot0tlxomieiyt m eaumo;u4arxnmf tytfmDeauvil()sexmxr3oudoltn fvtl(  Durxmp;t1tpe ifctaslm2emnvp;(4 etrio iotlmte ieol(0 rumxrpoudamt lfeils)aDrr(m ot4opxn ietysfm2ulums;u0alerxociydfmtrlu s t0 rurxrpoy4lleelnvta(fsDtm(  no4tlxo fctadfaDrl(mp;t4areoxf tatoa e ivslt setmxr3oo1omte iesat s2rmuronu0tltn ieilt sDemuvp;u4 rxomr3io1lm  aneo (  2toxm io1ll elfctas)srtmxrpno0aex mictasfa2eluvo;t0tlxnif oydomtean o s0 rumxm oudlp nmictls  rtrur ;t1opx  iciys s rmnvsnt4altoxf3iatfptr ivsl( trto(r3oodol  mfcsas)srrr(rono4opeoii3ias aDeaumo;u4teermfciadlm raivi s t2tmxopiy1opte neilsfaDrax pnt4tpen f3tytls uanmo t4altrmr tadomD  ivo ()s2toxm3oudop emivi s artmx pnu4tpxomiciad s2ea(ms;t4trxrxfcoytoaD anei;s0srxrim oy4ame  fei (  rumx pno4opeoifeild aDuauvp u)arermocio1om rlueo;(0srxmir nudaptnliet tfartrx onu1ale ifctadlmDrmuvpnt4 leoio iydlaD  n olt  exmxo iu4lltnmfes ( sDtau ooo1tlt  ieiyd aDumuvpn(0tlxnxfctytomte ivo t)sexm(mpio1amtemnvs t s2uax  ot4tpeoifeiyd aDul(mp t)arxnmr iodfatr uvolt0trumimpnudop  mfctls s2ra(rp;t0oetoio3tltlmDem( p;t)tlxnxr tatfa rlneo;(0s2xoxmpoo1aleelnvtls s2ra( ono1oet mfeilt m uau s;() ltrif ty1oaD livo;s trur(o ou4ap nlictl() 2tr(r nt1openiietad a2rm(mo;t0aleoxf3ta1oaDeaivi;( texoxrpou1lltemfciltfsDraxmp;t4open o3iltfm rm( p;(4altrif todfptranvilt) ruoxo3iodam n nvtat  rtru o;o0oltomfeiyt m2umuvp u4 rtrxr3iadla  au ols  rur(m3iu1op  lictls) Duaxrpno4tpto ictlt s rmuvont) exrxr oadfm e ueo;t texoir nodomenlncsa()aDrm(ro;t4oee  ieiys sDel(vp u) lxomo ia1opD lnvs;()t2toxr3oy1amee fvtltf rrmu oou0aeenio3iysla um( onu4texnmo io1oateanei;t srumxo io1ope mfcils srururo;t0alxomociltla eluvo ()arenxr tytlpDraivolt)srxm(mpnydomtn ieil()sDtmu  ou1tpeoioeild m2ul(ms (0 exnmfciatomD aies;t0 2xr(opoo4om elfctl()s2rrxm oo0tltnmoetlt a ulu s;(0tlxnxf oa1faDeluei t0t2xr(r3iudlmtnmnct (f rraur oo0oetnmociatlsDeanvp;u)altrmf iatlptrli s;s0srtrim3iu4op nlieta(fs2ur(rp;t4opeo i3ildfmDum(mp u4 lenxf3tytla rau i (0 rur(r iodlltemnetat)s2raxmp;t1teeo octltlm2rmnmo;u0 eenxfciytomt  ueilt)srto(m3nydalenmnct t a2taxront1texomoctat m eln on(0 etrxo3iodla  lnes t t2xrxm3iu4al e nci tfartr( poo0apeoiociytfm2uan p t4 ltoxr io1om e uvs s)truoxopny1oleelfvsls  rur(moou0aleo fetat s2rlnmo;(4 eeoxr3ta1opte i o s0 etriopoydlm emivsa( a2tmur ot0tet  fciyd aDra(vo;(0trtrif oydlptrauvi () 2tmxm3ou4ope lncsas aDtmump;t0olx  o3taslaDrm( p;t0tetnxrctadoaD  i i;(0tetoim3nydlpt liei t)arumurp;t0tlxomoctas s rau s u)tetrxf oy1om ranvo t0 2uoirpnu4lpt  nesasfs2ta(mooo0tlxnifcildls2emu pnu)tetomf iy1fm  livo t trto(m3oydamt mivi t s2umumo;u1aex if3ils s2umuvs;(0 ltoxr to1omDeaueo (0trxmxr iodaptemnei (f 2taxrpot1olx mo3ild mDuluvp t0aexnxf tatlatran s s0 eurxm3oodal nmfvi t sDumxrpnt0tlxnmfeiat m rmumont0teenirciytomt auesl( seumir3nodomen icta(f rrmum no1tpxoiociat m2emn o ()aexrif todla   ivi t0t2tr(opoo1am nmies sfsruaumo;u0opxnmo3iatlsDemn s ()trtoxr oydfpte ieo (0 euoim3nydamtelici s  2rr( pnt1tlxoifctad s2rlnmonu) rtrmr oytopDrln i;s  exoim iy1omee iviatfartmxmpnt1opeomoeiat sDemumsnt) rtrmociytfa rluvi s0s2tmimpno1ale mieilt arum(mpou0aeenmo3ilslsDelu o t0altnxfcoydfp elivi s  rxrxm ny4apeelfeslt) ruau  nt4tpen o3tyd sDem( pnt)tltoir3ootlaDeln i t0 eurxmpou1altnmfvtas) 2um( p;t0oexomo3ias mDrmnmpnu4 ltrmo iy1omteaieilt)srtrim3iodolte ieias)s2ra(m oo0aet  iciad m2eanmpnu4treomo to1omD  n o (0 exrir3nydom nmnet s  Drrxm no4altnmoctlt s2emnmp;() rerxf3iadlpte uvs;t t2xm(r3ny4lpt  nct t)sDurumpoo4aexn ieild aDem(vo;t0 ltnxf3iadlpDeluvo (0setr(o nu1ol e fviatf rrr(root4oee  f3ildfa2uanmp;t)treomf tydlmt  u s (0 etm(o3oodom  mnvs t)a2ua( oou0texnio3iadlmDeanms;t0areoxr ia1lm e ueils  rtmxm3iu4ap elfeia( s2ur(r no0oee moeiasls2rm( o t) lxnif3todfmD lneolt tetr(r3ou1om e nvs s  Drrumpnu0ape mi3iadfsDrlumo;(0texoio3oatla elnvs t trxrxrpiy1omee fetl(f rua(ro;t0optoio3tydlsDum( s (0 leoxo oytfa eauvslt t2tm(opnu1omt  fvtatf rtmu ont0opxn i3iasla2eauvpnu4 etrmrcoydomte uesls0 exm(m ny1aptnlict sfaDtr(r ou0olxnmi3tlt s2ra(msn(4 ltoif tydfpDrlnei s) rxoir3oodamenmfvil()aDrrumpou4oeeomoeiadlsDua( p;(0tetoxr iytfm ranes s0 etoxr io1omt lfet s)sDra(m ot0altnmo3iadfm2em(vp;u4 lxnmfctotlpDrlivo ()s2xrimpny1olenmfcta()a2tmx  ou1optn i3iasfm2uaumo;u4treomr oy1faD li s t trurim3no4al e fctl(fsDtru onu1aetomo3tltfm2uln p;u4arenmfcoadfptrluei;(0trtoio3iudlptelfvias a2rrumpnu0apeomfctys s em(vp;t0 rtrxrciadfateai i;s)trtmxo io4lme lfvs s sDumum no1tex iiciyt aDra( pnt0tltrmo3io1fp rlneil()teto(r3ny1lmee fvta(fsDua( onu0oetomfeiytfa el( p t4 lxniocoydfaD lnei t0s2tm(m3iu1om emnet (f Drau pnu0olto icils sDean o;() rtnio3iodlm rlues s) eur(r3io1op e nesatfs2tmur ;u4apxoifctad a rl(vpnt0artnxf3iydomtrlues;s trtm(m oo1alt lnetas s2raumont0olxniieiys sDelums;t4aexomocoodomtr u i (  etmxr3oy4op   iviltf rrrumpnu4tlto ociadlm2rauvpnt) rxnif3totom rlivslt0teuo(mpoudlp e netat)a2ururpou0tpx mieiadls2eanvo t4alerxf3tydlp rai o t)texrio oudolenmnvtas)aDrmxrp;o0opx  o3tyt s2el(vp (4 eermr3ootlptr ivslt0t2toxo nydll elnvi sfsDrmumo;o4tptn octasfm2rmn s t4aetrmf iatla r ues s  eto(r3nydlpe lnctl()srtm(  ou0tpxomociasfa2rln o;u4altrxf iatfmt anvi s  2urxo iydlleelict (fsDuax  nt0aee mf3iasla umnvo;() exrmfctydomD an i;( texmiopno1alen ivs () 2tmur ot1alx iicild s el( onu)aexnmf3iytfaDranvils seur(r3io4oltemfes ()sDuax  oo4olxnii3tadfmDuan s;(4trermfcootlpt anvi s t2toimpnydomt lnes (fsrururpno0aet  ictadfa el(vo;t)tetoif ta1fa elivs;t) rtmio ny4apt liciatfarraurp;u0aeeomictadfmDraump u0alenmf3ootfm r i o;s0trtr(r3ou4apt mfctas sruaxro;u1tee moeilsls2el(von(0texomr3tydlmD aieo;( srumio3nu1omenlictatf Dumum no4apxoif3iat aDrlu sn(4trtoio oytfpDeliei;t s2ur(mpoy1ap  mfcsat aDtaxrp;t4opx mf3tysfm ra( onu0tlerxo oodlmtrli o s) 2um(m3oudomte ics s)a2rmxrp;u4aex miciltfs eau onu0arxrxrcto1fm rauvi s0srxmxo oodlle lfesa(fs2rr(m nu4texnmoeiydfa rmums u4 rxoir3tytom   uei;t  2tmio3iodam  mivil(  rtr( poo1opt mfetld a2ea( o;t0aleomr tadopDr i o t  rtrxm no4lm e ict ()srrrxr ou4texoifeiasfm2ranms;() rxoiociy1op  lueols trtoxo nudlpeemncias)srta(rpot0aeeoiociasla el( p (4 ltnir3oytfmDrlnes;()trtmir iy1lmtelietat srrrxm ot0tlenmfetltls2rmnvsnu)arxnxociatfaD auvil() rurimpio1lptemivtlsfsDta(mo;u4aeeo i3iyt s el( s;u) lxnxo oatomDraieo;s t2xoxrpnu4ame lnvtas) 2raxmo;t1apxnmietadls umuvo u0 rtoxo oytfpD lnvi;t  exoim ou1alen fcs s) 2ur(  ;o4apx  o3ils m2rlnms u)teerxr3oytlp r u i;t trxoxo ny1apte ivt tfsrua(mpou1olxomo3tat m2ra(vp;u) etnxo3ty1op rlnvslt) 2tmim3io1am elfei s) rrm( p;o0tpt iieias a uaumsn()artoxo ty1lpDrln s;t)tetmxm oydlptnmicsa()sDtm(m ou1oltn ociat s2ra(vs;u)trerif oa1oatr n i;t0 rtr(opnu1olt  fct ()aDumxr ;o0alxn ietls sDum(mp t)aexnxo3oytfat anei (0trurxo3iodopte nesat)artrurpnu1olt  i3tad s2uanms t0aexrxo3tadoate uvsls)srtmiopoudome  iviltfaDtm(m ;t1aleo fctld mDemnvo u4altrmfciodfp   ivi;s  2xmxmpny4ole  nvil(  2uaur ;u1ope ifctys sDemn p u0arxoxr oadopt lu i (0s2trxr3oy4al e fciatfarrmxrpno1oex ii3ias a ranmp t0aexoir tadopD auvo;(0sexr(m3nu4opeeliviat) rtaxr oo0tet mi3ilsfm2rau s t)tlenxocoatopDrluei;s)t2tm(m iu4al n ivil() Dur(mpou0oetoioeiydls2uau s (4texoxr3ia1faDeanvi s)s2ur(m3ou1lle lnvtatfsDrrum ;o0tlt ioeiydla raumsnu0altrioctatlaDelivs;s0srxmio oo1am e ieslt)sDtaxr ;o0alt moeiltfaDrl( o;t0trxnmocoa1lmt livols) etrxmpny4ome mivi (  2urx  oo4alxnmoeiadfs2emumsn(4tlxomf iatoaDeai o t s2um(mpiy4lmtn nctat) 2tr( onu1tleomociysls2el(vo ()alerxrcoadfmDr ueo s s2xoir3iy1aptelivtl(f rra( pou4apxn ociyt aDemump t0trtoxfciotfaDe i ilt0setoimpnudomte nvilt)aDuau pnt1aex  fciadls2ra( snt0 reoxoctotfpte ieolt s2uo(m nu1aptnmiet s a2raur nu1tltnioeiysfa rmuvo (0 rermocoadlpt auei (  2to(r3ny4ame  nctl() rraumont1ope  ociys a eanvo () rermo iytfpt  ueols)t2toim3io1al elnviltfarrmumpoo4ope iociatfa2ea(mo;t0alxrxf iydlpD lnvi;s0 2xmim3ou1alte neta(fs2uauronu1apeo fciytlaDemnmon(0trerxfcoodfa  livi () eto(r oo4optnlnctl(fa2tm(rp;t0tlxo ieiltlmDrmnvsn(0altrxo oydomt li ol()srtrxm iodomtnmfcsls)artmxmpoo4tpxomfcildfmDrl(vo t4 ltoircootoaDraieols0sruoxopiudope lncsas sDururoot4aet  o3iaslsDumnvp u) eenmr ty1lp  lu sls0 exrxmpoudope mfcs t a2ururpno0tetoiictyt aDua(vp (0tleoifcoadlpteau o s0 rtoxm3ou4altn fetlt)sDrrum ou0tpe  fetldls rlumo (4trtnmfctatomtr n i;t  rtmio oy1apt lfeil(fsDtm( ont1aex mf3ilsfm ea(vp (4 ltrircoatop r uei t)tetoir iy1ll e fctls aDrm( p;u0tleoioetatfm em( p;t4alenmfciatoaDelu sls) rxo(rpno1am emnctlt) rrr(rp;o1tet if3iaslm2uau s;t4aleoxocoy1oat aivi;() euo(r iu4lmtn nes t) 2uaur no0opeo oeiltlm2eau s;(0aexnxocia1fmt aieo s t2trim3no1ame lnctltfa2umxrpnu0apxoifeild a2rm(vp (0tlxnirciodopteaivi;s sexoxrpiy1al nmici s) Drmx onu0olxnmoctld m2el(ms;(4aetnmfctodlm  lues t srtoio ou4ap nmnvi tf rtrxmpnt0apeomf3ildlmDumu snu4 exnxo oy1lpt anvi s)teuoio3ou4am  lfvt tfsDtmurpnu1apx  ieilsfa ua( snt0altoir3iotopD  nvsl(0s2urxrpnu4ameelicta( srum( ooo1tlxn ietls s2ulump u)trxnmr3iotlaDe ies ()texoimpou4amte nvs t  Dtaxrp;o4tex mocias a2emuvpnu0 ltriociytlat aueols)truoim ou1amt lneias  ruaur ;t0oltoiieiatla2raumo u0arxomocta1fmtr nesl()setmio3iydopenmiet t)sDtmxmono0oexnmiciadlaDumuvs u0tetnxr3iatfp  lnvi t) 2xm(mpny4ole mncs s aDtmx pnt1alx if3ildlm2uanms u)alxrxo tatfa elneslt srxrxr oy4oltnmfcs t)a2trx poo4oet mfeias a ea(mo u4tlenio oydoaDelivo;() eumxr3oy4lp  lfci sf 2umum nt4tetnmi3iys m eau snt0texnmr3oy1opteanes t setr(r io4al elnesltf Drrumono0opx moetlt s rmums t) reoxr todoptelieslt0tetmxrpnodam nliesls sDuax  no0ole mociyt m2eln pnu4 rtrif3iydoptelivilt)texmio nu1lm  liviasfsDtrx oot1alxoiociyslm ran s;(0trtnxfctatlateaivs;(0trtmxr no1aptnlnct tfartaxr ;o1openmieiaslm ua( p t)tetrif3iy1lm eanvs () 2tm(mpiodlmt lfvi s) 2ua(rpnu4tee  ieiaslm2em(mpnt4aleoio3oadfmtraivils)s2uo(mpnu4ale mivsasfarraxmo;t4altomfetatlmDuau p;(4 etoxo iodop   i ilt)srum(r3iu1om e fetat)a2urumonu1tpx mi3tysfs2uaums u0 lxoif3iatoa rlivs s)setmirpno1lp e fet (farra(r ot0apxomfetydfm rl(vp;u) rerir oo1omDeln sl() 2um(mpio1amenmnct s  Drrxr nt0oet moeiltfm rlu ont) lxrif3io1fpt luvi s0 2urxr3ou4amt  nvtl( aDuaum ;t0opx mocilsfs rlump u4 exrxf ty1fptr nvols0 2trxm iy1ole  iesltf Dta( ono1tltomfcilslmDumnvo u4 rerxf ta1laDeauvol(0t2xmxo oy4aleelivsl()s2urx pnu1tlen iciat aDelnvpnu0trtoif3oatla   uvi;t)setoxo3nydomt  nvias  ruau oot0tlenmociadfa2ul( p t4 etniocoa1fpt livs ()t2xm(opoudllenmieil()sDrr( onu1olxo icild a rmu s u4alxnmf3oy1fpDr u ols) 2xrxm3oy1lpeelivslt)a2tmxmo;t0tlto i3ild a umnmpnu4arxomr io1fpD  i s (  euoxmpiu1lp  lnvslt)sDumx pnu4oltn i3iad mDum(vo (4teermrctydop e i ols0t2umxr iu1op nmicsa(f 2umxm ;t1apxn oeiadfaDeln ont)aetrxf oodfaDeau s s  rtoxo ou4opt  nct (faDrm(root0opxn i3tldfa ua(msn(4tlxrmo3ta1fptrlu sls texoimpiy4lme lnci s)sDtr(mp;u1aetnmf3iatlm2eln o;t)alxrif3oy1lp  aies;t  ruoirpno1ome  fvs sfsrra( ont4tptoiictlsfaDumu o t0 etnxr iodlp r ueo;t srxr(o3no1am   fct s)artrurpou0openifeiat aDuau o;u0 rtnmf tydlaDr ivo (0 ruoxopoudlltemivs sfs2uru pot0aex  oetyt mDrl(vont4areniocoy1fmt ln olt  rur(o3no4altnliei (f rtmxm nt4tlenmi3tas a2ulnmpnu4tltrmf3ty1fa r u o t0setrimpiy4al nmics (fartax pnu0aptniiciltlsDea( sn(4aeeomo tydfa rauvsls)s2xmirpio4lmeelncil() 2ur(roou1tleoii3ias m2rl(mp;t0altrxfcootomtranvilt t2umim nodaptnmfvsl( a2raum ;u1tpxoiociytfaDrlnmonu4 rxriocoatlpD au s ()srxrir3nu4ol elivslt)s2uax ont4oexnmfetys s2rln p t) lxrxo ootomD livi;t0trurir3nodolen fet sfa2ua( o;t4ale mo3iydla2eln pnt0 reoxr totop rlivslt  etoim3iodal elfcias a2rmuro;o0opt  fetyt a uaums;t4teeoxr totfp e nvslt  etoim nudlltn icsl(f Dtaum ;o4apeoio3ildla2ra( p t)aeenxfcto1lm e uvs;s0 euo(mpno1omeelivs t aDrm(mpoo1aee  i3tlt m ranvp u0 renxo3ootfatrli o;s)tetrxo3oydlm elfeias sDuau ooo1oexoii3ilslaDrmnmo t0 eermf3tatoa r nvi t)sexrirpio1lleeliesas)s2tmxr oo4apxnif3tldls el(vs;u) rxrmo3iotoptr nvi;s) eum(rpoydamen fei (  rtrurpou4apxo o3ils mDua(ms (0tltrmr iodoate nvslt)t2xrxm3ou1lleelfci tfsruaxmooo4aptnioctasfm2rlnvpnt4trxoxr3tytfaDelnvsls0tetmxr3iu1lp  lnvil( a2ta(  ot1oeeo ieildlaDuanmo;(4aetrmo iatfp e neo (  rxo(opnodolte ncil( aDtm( pnu4opeoioeiatfm2umu sn()alerxf oytfpDeaieo ( srur(r3oo1alte fei t) Dua(r ;o4oexn i3ias sDrluvo u)teerxo3ootfaD  nvs;()s2umxopio4lm n nesat s2raumoot0tltomo3iatls2rl(vo u0tlxnmo oa1lm elneo t)sexoxm3nudop emieils)srrr(  ou0teenio3ildlmDuln pnu)alxrir3iatoaDeau ils teuoxo3iodope mnet t aDrax  ot0optniicilslsDemuvo u4arenxr3ia1lpDe nvils0trxrio iu4apeemnesasfaDrr(m ot4tpt mfeilslsDraumpn(4 lermo io1la r ivol(0teuo(rpoydapeemfcsa()sDuaxmpot4altnifeilsfs uaums u) leomo io1fmte nei ( t2xm(o3oy4olenmfesa(fartm(  ot4oltoifeiadlaDemnvp;u)aetnio3tatop ranes;s)teuo(o3ny4lmenmnesa()sDurxmooo0teenmiciaslaDrm( o;()aexnio tydlp elivs s0s2xrimpny4am elfvi (fsDra(m nt4tlto o3iadfa rmu pn(0arxomf3ta1faDr nesl(  eum(mpoodapte nctlt) rta(  nt4ole ifetldfsDraumsnt0 ltomr oodomD aivils0t2umxo ny4ll  lnciatfa2uauroot4tlx ifcildfa2umnmo;u0 etoif3totoatrlneo (0s2to(o3oydome lnes s)arurumo;t0olx mf3tadfaDul(vo ()aeenir3iodfaDraivs;s)s2tr(m oudomenlfvil(f Drrur nu0altn fctaslmDeanvp;u) rxoxfctatlmDr u s (0 rtoio3nydolenmies t  Dururpnt1tlxnioeiadlm2rmnmp t)texrmr oa1oat  nvs;s)texmxr no4ame livilt a2umur ;t1aexomf3iadlmDumnms;() lerif ootoat li ils0s2umio oo4lmtnmnvsasf Durur no0tee mo3tydfa emu o t)trtnxf3tydfpt lneo;(0 2trir3oo4om  lfeslt s2rauro;o0alx ioeias m2umumonu4treoxrctydfa r ueols s2xr(opoo1lpenlict (f 2ra(mpoo4apt moetldlsDemnmsnt4 ltomf iadlmtr n o ()truoxopoodlle mici (farumurpot0aetn o3iyslsDulnmonu0tltrif3tydlm  ai ilt) rxrir nu4ome  nvslt  rtru ooo4aptnioeiltlm ra(mo u0 ltrxo iadlmDran i (0tetr(r oy1olen icias sDrmx pot0aet  ieils s emnmp u4 etomr3tadfpDe u o t srtm(opno4ap   ictl() rrau  ;t1olxnmfeilsls2rmn o t0tetomo3oatfptr n i;s0srum(m nu4op   fesltfs2uaxrpot4alxnioctad aDrmuvp ()altriocta1fp r uvs s0 etmimpoydlpe  nvsls aDtm( pnt4tlxniiciyd s ranmsnu4tltnioctytfp   i ol( trtrio ou1ameeliesasfaDta(mpou4apxniociydfm2eanvpnt4aexnxf oy1fm   uei () eurxo3ou1amtemnci s)a2rr(mpnu4apt iictltfm rluvp (0artrirciotlp e uvil(0trtrxo ou1am  lfvtlsfsDrr( p;t1olxoifctad a2ulnvs;t) leoxo3ia1oate ieslt) rurirpio1lme mivils arumxmooo0aeen i3iyd sDrl(vs u4aexrif3ty1opt lueo s0setoimpnu1olt  ies tf 2umu  no4tpenmoetatfaDrmnvs;t4 etoiociadom r n s ( s2xoxr3nydaptelfeiltfs2ua(r nu0tet  fetatfsDuauvp t0artomo3oo1fat aues t)s2tm(opno4amen ics t) 2uru onu4alxnmo3tadla2uaumpnu4trtnmrcoatlp ean i;(0s2tm(rpio1lmenmivsa(fartmuro;t1apxnmi3iadlmDumnvsn() eermf iatoa r uvs;( trtr(o3oydllt miviatfs2trx o;o0olx mfctysfs2ulnvp t4 etoio ootfateaieil(0s2xmir iu1am e nvs (fsDum( p;u4tptnii3iytfmDrmn on(0aetoxr oatom  aivolt  2tmio ou1olee fvtltfsDta(mpoo0tpto i3iadls2eauvp t4texnmo oatlpteluesls0tetoiopny4lpe lnvils)s2urxr ot0texn oeiytfa2rmu p;u)trtrxo ty1fm   ivi;() rtrxo oy4oltelnctatf rumurpnt4ole  f3ilsfm2emu p;u)aexrircio1lp  ln ilt  rtrxo3ny1am emiesatfsDua(m nu4apeoiieiytfs2uanmpnu)tetrmf3oa1fpt  u i t s2uoiopnydol   ncia(f 2uaxmonu1tptn icild a rmnms;(4arerxfctodfmDeli s t)s2tmimpnudlmeelnet s)arraxro;t4oee mociyd m2um(vpn(4 rxoxo tydoa e ivols s2xrio io4am  mnetasfartaxro;u4aetoii3iytlm umnms (4teeomf todopt  neil(0t2xr(m iy4optnlfciasfa2rrxmoot1apenmfcias m2em(vsnt4teerio iadlp rli o;(0trtrir3nu4openlnciasf rtr(ro;o4ole mf3tlsla ua(ms u0aleoir ia1fptraivols seuoxrpiydalte ivt t  rrmur ou0tpenio3ilsfs2ua(ms;t0 rxnxo iy1oa   ivsls0seumim no1op elieslsfsDtru o;u1oeto ieiltfsDelu pnt4trerxfciotfmD  ueol()trtoiopou4lmen ivias)sDum(mono1tlxoifcilt a em( o (4tetrifctodla   uei;t0 rumxr3no1lltnlnvtlsfa2rrx pnu4oee  oeias s ra( o;()arxrxo oadlaDrlivols setr(o iydopenmieia(f rrm( o;o4ale mietatfm2rmnvs u0tetnmocoatfm raueol(0seuoir no4om e fei s)srtrx pnu1olxn oeiasfs2rl( o;u0alenmr3iy1opDe ieols setmxo iudoptnmfcsas)srra(  ;u1alt mf3ilsla ea( p t0tlxrircia1oaDraueo;(0t2xo(m3ny4lpeemnet s) 2tmum ;t4tpeo ieiatls2ua(mo;t4aetnxo3oytfmtr n s t  eumxo3nu4olte netlt)a2trur ou0olxnio3tlsfa elnmp u0arxoxf3iotoaDr uvi;s  2trxr3oy4ol nmfesa(fs2trxro;t4tlxnio3tlslm umu s u4 lerxo oy1fpDe n s s0trxoio io4lm  mfvtls arrmump;o0aetniiciatfa2ua(ms;(0 exrif tydfp r u o;s0srxoiopoydap nmfvtltfsDrr(mp;t4aee ioctasfaDumu s;t) rxrio3io1lp  lu o () 2uoxo3nu1al  lnctl(  2um(  oo0aleoifcild a elnvo;u0aetoxr3iydomDeai s;s setoirpno4op e fciat)arumxm nu0ape  o3ils a2rluvs;t4teeoxr3ta1fpDr nvo;(0t2xoimpiodapenmfct s)a2umxr no4tetnmociadfsDumnmo;()aetoxf3oatlat auei;s srumio oydoptn nviat  rtax p;o0aeeoiietadlaDrl( o;t0 rtrxr3iadlmte ieilt) exrxopoy1omeemics (  Dum( pnu4oet iociydfa ea( s t)artoxf3iotlpDr ivi;s)t2xrirpnydlp n feil() rur(r ;u1tpxnii3iasla eln s ()altnifcio1omt  nvi ()teumxrpiu1lm n nvtls)a2tax pno4olx ifciys s elums (4 rtrmr tydlat  i o;t0teurxopnu4am e ivsasf rrru  no4tlx iociysls2ua( o u4alxoxf3tatlaD lueo t  ruoxr oo1ol emnesasfs2ta(  ot1ope mfeilsfa ea(vo;t4trenxr3ty1lateluvilt0 exrxo3io1olt  fesa(fsrtrxmo;t4olt  o3ildlaDumnvpnu)alerxr3tatlaD anvi;s)t2ur(r nu4lm  mfesat) rta(rooo0opt mociasfsDea( o;t)teenmr3iotlp  lueol(  2xo(m nudol emieslt arumxrooo4ape ioeiatfs emuvpn()arxoifctatla   ues;t)sruoxm ny4amt livi (fsrra(rpnt1opxo fetytls rmnms;(0 eenxf ia1omtrln o t)teumirpiodal  miviltf Dra(r ;o0ape  oeild mDua(vs;(4 lenmr ta1fm eln s;(  ruo(r ny1olt mnvt sfartax  ;t4opeo fetlsfs emu p () lenmf iodomt  uei;t srxoxmpiudopt miesas)arrmum ;u1tle mociadfmDeaums;(0areoxrcootlpD aivo;() rtrir iy1oltnmfvs tfs2taxmono1oeenmf3tasfs ulnms t4artoif3oytlmD li ol(0 rtoio3ou1lp n iesl()sDumu  nt4oeenmoetlsfa2umuvsnu4 renxf3totlmDr neo t trxoim io1aptemncta( s2ua(ro;t1oexnmfciyslsDemump;u) eenxf3iydoptr ueilt)trxm(m nudlmen fetatfa2tr(mo;u1olx ifeilsls eln sn()aeeoxo oodlatelneol(0setmxo nudom elfei (faDra(mpou1opxniietls a eau s () rxrmrciy1lat auvolt0 eumxopiudlmenmfes t) rtr(  oo0aet moetldls elnmp;u4alermrcoytfate i i;s seum(o ou1am  mivia(fsrta(mpno4texn ociysfa2ulnmo;t4tlenirciatomte n o t  exmxm iy4llte neta() Dtaxrpnt0alt  o3iydla2ul(mp;t4 leoxfcoytlpDrli i ( t2xrxr3nydol   iet ()artr(rono0tee mfcias aDrau s;t)aexoxf iotfpte i ols)s2xmiopiu1lpeemiei ( a2um(rp;u0aetn ocilsfaDra(vp;t0 exoxo3ta1fm  luvi;() 2uo(r3nu1om nmfci s  Durxrp;o0openmociytlaDrlnvo;t0aetrif todopDran o ( srtoxm iu1al   iesat  ruau  no4aptn o3tadfsDean s ()arxoxr3oatla rluei;(0 etm(r3oydop nlicsat artaxr ;u4oltoioctatla2elnmonu)trxoirctodfpt auvo s0 etmxr oudll n fvt s) 2ra(  nu1opxo feiytlmDrm(mp ()trxrio3totfa eli s (0s2umxr3iu1amtelfvsls s2rrxrpoo1oet mfeiad m2rlu s;() ltrio tytopt li i;s teum(o3ou4lp n fetlt)srtax onu4apx mi3tlsla2ea(mp;(0artrif3tytlpt aueo t)sexmir oy1amenlfvilsfarrrxr oo4optnmf3iat sDel(ms;t)teeriociydopD ln o (0 eum(mpiu1optn iet s)a2tax onu0tltniieiytlm2elnmp;u) eeomf3tatom   ivil() eto(r3oydape mneta( arumurooo4aexn ieiysls2rmnvs;()teerirctydom eli sl(0 exmim3oydllenmiei t)artmx pnu1alt io3iadls rm(vp u4 lxnmr ta1latrlnei;(0s2ur(m3oo1lpenlicta(fsrtaurpnu1oexomo3iysla2el(mon(0aexomr3oodom r nvo s  2xrxo ou1am   fcilt  rtaxronu1aptomoetls s2umnmsnu) lxomf tadom eaivo;s0 exm(mpou4opee ictl(  2urxrpou1open feiysfa2eau p t)trxoxo3iytfmt lu i;s0tetmir nodoltn nes () Drmxrpou1ale ifeiadfa2elnms t) rxnmf3oo1lmtr ies;(0 rxr(r iy1omt  neil(f rtmxront0teeomf3tyt m umn o;u0tlxrir3ty1fpDeli o t) rxrxr oodoleemici s)srrr(ro;o1apx mfeiydfs rluvpnu)arxnmf tytlp  auvo;() ruoxr3iu4oltnlics s s2rmuro;o4alt iieiltfm ul(vs u4 etomfcty1lmDrli sl(0 2to(mpou4lpenmfcilsfsrtm(r no1tpxn ieild a2rlumpnu) rtomocoatlaDelu s t0srtrxrpiudal elict s a2uauroot0aptomo3tytfmDuan s t)aexoxfcoy1fp rau ols0 euo(o no4ameelnes t sDtaumo;u0alenii3tys s ua(ms u0 rxnmf oodoaD  n o;t trumir oy4al nlncsl()s2umxmont4aee mietlsfs2ran o;t) eenxo oytfptrlnvilt  eto(opnu1om  mneiasfa2rm( o;t4oet mo3ilsls2emump;u0 leoifcio1oa  lieo s0truoirpoy4lp nlicia()aDrmx pnu4alxnmictas m emuvsn(4trtrxo iydfa e ies s0 etoxm3oodlm emfes ()arumuroot4olx moctysfa2elnvsn(0 lerioctadopt  ieo () 2xo(o3oo1lm elics () 2umurooo1oetoifetad m2rmn s;t) rtrxocia1fpDeluei ()s2urim3oydlleemivi s s2rm( ont0tlxoifctltfaDuanvo u0 renio3oatlptr ues;t teuo(rpoydll n nvsatfarurxmoot1alxomfeiyt a ran sn(4tlxnxr oatoatr n slt texrio iydal nmiciltf rra(  nu0oeenioctatlaDrmn snu)tlenxo3iodoptelivo t)srur(opno4lmeelfvsa(fs2tm(rpnu1tle ii3iysls2umump t0 ltnmocio1opD anei s) rtrxo oy1olt mncta(faruaurpou4tle mfciasfs eau s t)artnmrcty1faD  ueo;t)sexo(r oudomenmnvt t)s2ur(mo;t1aleomieiyd mDrmnvs u)altnmf3tytfaDraieo ()s2trio3iu1op   nvsasf 2rr(m nu4apenifeiad a eauvon(4alenmf oydlp e uvs ( sruoir ou4am nlnvtas) rraur nt1tpt mociad mDum(vs u4tetnxfcia1fptranvi t) 2xmio nu4lme  ncs tfa2rmxm ou4opt iiciltfs2rlumpnu)alerxo ty1lpte nes s0srxo(r iydlp nmnes (fs2ta(m ;t1tpx iiciadla2eanmp (0trermo3ta1latelueo t seumxopoydop nlfcs t)a2tmx poo4opt  i3tatlaDeanvo;(0 rerxfciy1lptelies;(0t2xoxm ou1omt mnes sfaDumx pot0tetnmictytls umn snu)trxnxf iotlmDeluvil(  2umxm nydomenmfesl()a2uaurpno0olt iietydlm2rmnvsnu)alxoir3iatlmD livo;s0trurxmpio4llt  fciasfsDtmumoot0opx  o3tas mDelnmo;u)tltnmr iydfmt ai i t) rto(o nu4llenlivil()a2raxro;t1aetoiieiasfaDumn pn() ltrir3iy1fa e nvo ( s2uoimpoodamtelfvs t) rrmurp;t0oeeniietlsls emnvpn(0 rxnxr tytlat li o s truoxm no1lpt  icia()s2uauro;u1optomictyd s2rlnvsn(4aeeoiocoa1lmD  i ol(0sexm(r3iudolee neslt) 2ur(  ;t4aleoif3tatfs2uaump t)trxrio oy1lmtr nvi;t0s2umxm oy1ole  fctat  2urxm oo0ope ifeiysfs rm( sn(4artnmf3iatlmDeln o t) eto(r3ou4lmtnmfvil(f Duau pot1altoii3iysla ul(vsnt4altrio3totfaDrau i;t seuoiopoydlleelivilsfa2ua(r oo4opeo fciyslsDean onu4treoxr3iatlpD auvi;t  2xmxrpoo1amt  fciatfarta(m no0oexomiciat aDel( o;u0trtrxf ootoaDeln i;s)s2xmxo3nydlm n fvias)arra(mp;u0opxnmictydlmDeauvsn()aexnmr oy1fa e i o;( sexrim iu1omt  ietlsfsDrm(rpnt4olxoio3iyd aDumnms u4arxrmrciotfa   u s;s sruo(o oy1om elfci (fsrrmx  no4aeeo i3iltfm2eluvs t) etrir3iydlaDelivi;t0 rxmimpiudomeelicils arurx pnt4optomieiltla2em(mp (0 eerxr3iotfpD  ies t0srur(r3oudapt  fvi (farrmxrp;t4apxo ieiys aDem(vont4teeoxo tydomt lu ols0teuo(m ou1olen nvsa( srra(ront4oet moetad a uln onu4tltrmocoadlp raueilt)s2tr(r oo4omenmnvtatf 2rrx pou0ape if3ilsfm em(ms;u0 rtrxr3iodfp raneol() rumir ou4lptn fctasf Dtm(mono4oet mi3tytlsDrauvp (4trxrxfcto1opD lu s s texrir3iu4op emneils)aDra(mpot0tlen f3iatla2ea( s (4tlxnmr oytlp e u o;t texrxm oodopt lies sf 2ur(ronu4tpxn oetydlm rm(vpn(4arxoif iydom eau i s  eto(r ou4ame lietatf Drmurpou0oee mieildls2umnms;u) exrmo oodlp ean ilt0t2urxm3nudopee ics t)s2rrxro;t1apxnmf3ilslm elumo (4texoxf3tydfmtelnvsl(0trxoimpnodomee fes t sDtrumonu4ole ifciatlmDul(vont4 eeoio3oydomteauei s trxrim3iodomte nciasfa2um( pnt4opt  ieiytfa el(ms;t0tltnmrciytomt lnes;( srxo(m3iy4al emictlt)s2taxmpnt1olx mocias m2emuvp;t4trtoxo3iodfmDrluvs;s s2toxr3no4op nmfci t)srumxr no1altoif3iyt aDemn o u0 lenmr3tatlat  nvsls) rtoxr oo4alenmneias aDtax  oo1tlt  fcild aDumnmpn(4alxoxo3totfmD lnei t srtr(o ny4lm nlfvsas)srrrxm ;t1olt  oeiat s eanvsn(4 lxoiocta1fpt lues (0 rxmxopiu4am emncsl(  Dum( o;o1apxomfetatls uaumo;u) ltnxf ta1oa e nesl(0trxr(m3ny1ameemnetl(fa2ur(monu0tle iocilt mDulu o u) eeomfcoodla rlnei s  eurxopoo1amtn ivsatfarta(r ;o0oexoifetlt s2eaumo (0trtrir3ty1la r uvi;s)texrxmpiy4ape  nvsltfs2rr(mo;t0oexomi3tad mDul( p;(4teeoir3iodlmD anesls t2xoxm io1ol   netasfartru  nu1aee mociydfs2uauvp;u)altrircia1fp   n o t)srxoir iy4lleemicsltfartauront0oet io3ias s2rl(ms t4tlxrxf ty1lpt lnvolt  rtrir ou4lmt lnci (faruaxmo;t1alenmoeiadlm emnvs t0 exnxoctadlate i i s0t2tr(m3no1lmtn fei (  Duaumpoo1tptn ieiasfaDrm(ms;t4tltnxr3oa1opteaieslt)t2xmxo3iy4ope  fctltf Dtmurooo0aeenmoeiys s rlnmpnu) reoxf3iydopt luvo;(  2trio3ou4lmtnliesat arta( pot1oeeoioctys m2umn p u4 ltomrctatfm ean ol(  eurxmpnudomt mivia( aDrmx  ;o1oetnio3tasfm2uan snu)tetnxr iytfm rli sls) 2uoirpiu4lp nlivtat) Dtmu o;u4aex  ieilt m ra(msnt0arxrxo3totopDr i olt0trxm(mpio4lpeelfeiat) Dtr(mp;t1ale mi3iyd m uanmpn()trxoxocoy1latelivsl( s2xoir no4opt  nes s artrx o;o1apx mi3tyt s rlu o t)alxomr3to1lp  lnei;t  eur(r oodom nlfei (  2raumonu0aeen iciltfmDumu o;() lenio iydfp rli s;s trxoxo3nydomt  ncils)a2rr( ooo0tptnmieiytfs2uluvo t0aetnifctydfmDrau ol(0 rto(r nydoptemfetl(farrrxm ;t1apt  fetld aDuau o;u)teenxr oa1fmDraivsl()teuoir3no1ol  mietlt)artax p;t0apxo i3iyd a rmuvonu4tleoirctadlate iei;s) rtoim iudlp  lneilt)aDra(ronu1apt mo3iatfm emnvo;u0teenmr oydopt li o;t)trxo(opoydamtnmnet (  2tauro;o0aeeo ieias m uauvp ()tlxoxfcoodfp eanvi;s srur(r oo1alte nvsat s2tr(r no0oexniieiad s rluvont)areomr3oodoa rlivi;( sexm(rpnudomtnmieia() Dra(monu4apen i3iysfm rlu pn() rtrmf3iy1oateli olt0 exr(r no4lmee fvt ()arumurpno4olx mfeiytfsDumuvs (0artomoctytop eaueo t0 etmxo nu1lp elfei tfs2urx o;o0tptnmfeiadfm2elu pnt0teerif3oy1lptelnvo;(0setoim ou1llenmietat sDua(ro;u0aleoiieiatls2eln s;(0tleomr ta1faDeluvi;t  rtmim3iu1lpen fciatfaDua(ro;u0aee iieiad aDraums ()aeermfcto1fmtrauvsls srtr(r3io1amt mnctlt a2ur(r nu4aptn o3iatfm2elumo u)tlxrir oytfp rlnvil(0s2uoir io4lleemieil(  2umum ;u0tpx mociadla2rln p u4 exnxo iydopD auvs t0 etoimpiudomtnmivsls aDrrxrp;u4aeeomietatls2eau s u4tetnif3to1la  lu i s0s2xo(m3oy1apee nesltfaDtrurpno4tlxn iciydfaDrm( s t4aexoio to1omDr uei t trtmim io1ol nlivtls)artmxro;t4openmfctydlsDulnvp u4texnxrciatlptranes s0 2umiopoo4llenmnvi t  rurxmo;t4aeto o3tadls2ul( o (4 rtrxr ta1fpteau o ( s2toiopiu4lp  livi s s2um(m oo1tlxomfctyd aDuan p t0texoxr3oy1op  liei;s seuoim3iu4ape mfei t artru o;o4tltomoeilslsDea(mp t0arxrif oydlm eaueo;s trtoir3io1lptemivil( s2rmxrono0tltnii3iydfa rmu s () renio3oo1omtraues (0 exmimpiy4ll elnesa(fsrtr(rpnt4tpto ociytlsDel( pnt4tetnmr3tadopt luvslt0sexoio iudolee nctatfaDua(monu0alx iicild aDelumsnt0altrxo oadoa e i sls0 euo(o3oydopt lietl()arur( pou4aex miciytls uaump;u)tetrxf oy1fmDeai i;s teur(opio4lmen ncs (fa2ururooo0olxomoeiytla rmnmp (4 etomr oy1oaDeauvolt tetrxm oy4amte feias sDra(mp;t4tet  f3iltfs2ea(vo;t0aeenmociodopDr iei s)srxr(mpnu4al  micsls)srua( pot1tle  f3tadfm2ulnvsnu)aleoifcty1oa r nvo;(0 ruriopoudal  mnei (f rra(r ;t0tex moctytls2rmuvo u)tltnxfcoa1fa   n s;s0 rtmiopiydapee netls  Dta(m ;t1oeto feiadlmDran p;() rxnxo3io1oa   ivi;t trxr(o oodame mnvt s)sDtrxr nt4oex  o3iyd a umu on(4 exnio3oatomtrlivs s  rtmxm oo4llt livi s  2ra(rp;o4tpt  f3tadlaDrmn o t0aexoxr oodlat  ivils0t2tmim3oodopte iesl( aDuaum ;t0aeeomo3ild s el( s;t4tetnir totfaD lu ol()trum(o3no1op nlneilt  rua(  ;t1aexo feiad m rm(vp;u4trxrxo ia1om   uvi;s0t2xoxm io4oltelfci t) Dtmurpot4oltn icildfa2rlnmo u)arerxf oydlpte nvil()trtriopiudlp  licilt arta(r nu1tle mfctydfsDemu onu4 leomr oadoptr iesl(  etoxmpoy1opte fci tf 2ra(ro;t1tlxo fctadfaDrl(vonu) exoio io1fa r uvi;s0t2trio oydlm n ictasfartmxm nt0alxoio3iytlm ul(ms;u0tltrmo3oa1fm elueol() rtmio3iodomt  ictltf rur(m oo0tpt  fciadlsDulnmo;t0tlxomf3ty1fmDr neo t srtr(rpno1ap e feiltfsDua( pnt4tlxomo3tasfs ulu s u4tetnir3tatla rlieil()srurir3oo4lme mictltfaDurxr ou1oleo ociytlm2eaump t)tetoxrciytfa  an sl( tetoxopio1ape mfeta(fsruaxm ou0olxnmociydlm2eaumo t) ltrxfcoodla   ueil( seuoiopnydalt  fetlt)a2raxro;t1aet iiciatfs2rau s ()artrioctodfm e nvs t trtoxopnu4apenmieiat srrau pot4ale  oeiyt s um(ms t0tlxnmrciytomtr nvs t) 2tr(opou4lmtelivi tfarta(rpnt4apxo fciad sDumnvp;t0aexoxf3ootop r n ilt0s2xoir io4oltnlnei t  2uaxro;t1aetnio3iydfs uan onu0 leoxo iatfa e u o t) eur(opou1lp  mfctls s2ra(roou4ole ioeiytfa ra(vont0 exrxf3ootfatranei (  exm(o3iudom n iviat sDtmurpot4olen ociyd a2ea( o;u0 eenirciytoaDrlneo;()srtmim3oy4ll elncil( a2umxro;o0opxoifctls m rau o;(4tltoxr3oadfmtr ies () ruo(o3no4amtelnvtls) rurum ot0olx mf3ildls ua( pnt0tleoxf3oo1fpDrln ols0trurxmpoy1olt mncias aDtaxmoou1texoii3iltfm elnmo;(0 ltnmf iytlpDr i o s  exo(m nudam elnvil(fsrurxr ;u1optniieiytfm2rlu snu)tetrxf iydoaD  nvi s0trtrxr3nudapee nvi t aDtmxmp;t1apt ioctytfmDulu sn(4alxrio3ta1faD li s t)seuoxopio4al emieiltfaDurur ou4tet ioeilsfaDea( p t4 rtnxf3oa1laDeaueslt)sruoim3oy4am emivs t  2tmx o;u4apxomi3tat s umums;u0 lxrirciytfpt  i s;t  2tr(o3iy4alenmneils  2tau pno1teeomoeiasfa ea(vs ()arenir3oa1oaDr ueo;t0 exo(m3nydopt lfesa( sDtrur nt1tpt iiciat mDuau ont)tlxrir oodfm e nvo;t0t2urimpiu4omt  fvs (farrmx pnt4apt  fctyt a2ra( o u) etnxrcoytfpDelnei s0seum(o iudlm   iesa()aDrrxmoou1tpen oeiasfa2rl(vp;u)alerxr ootom r i s;t) ruo(o nydamt mietasf Drrumpoo4oexn o3iadfa2elumo;u)trermrcoodop rlnesl()s2urxr iydom n ivias  rraxronu0opto fciaslmDrauvo t)alxoircoadomDrai s t s2toim oudap nmfes (f 2rax ont0alt iieias aDrmnvsn(4 etoif to1om eln s () 2xrxr ny4omtnlnvi s  2ua( pot1aexo i3tyd s elnms t4altoxo3iy1lmt  n o s  rtrxm3io4op  livil(  rrrx onu4aex iietas sDea(mp;u0trxnxr iadfmt  ivs;t)s2tm(rpno1lltn ivi sfs2tmu  nu1optnif3iys s2uluvsnu)aeerxf ty1fpDe uvs s)sexrxr iy1olt  fcs t) rrrx poo4olxomietytla2ulnms (4aetrirciydlmte ies () rtrirpoo1ole mivilt) rumxmono1oltniieias mDrluvo;u)texomr iotlaD an o;t s2xmxm3iydapeelfct sf ruru pno0oeenmi3ilslaDuanms;(4 leoxr iy1om  lueils0t2umirpou4ol  mfvs tfsDtr( pnt4oet  o3tatla2ra( s ()alxnif ta1om elneilt)s2trxr iu1lmt lietatfsDtmx o;t1alxnmfciadls rmu o;u0tlxoxo io1lmDe nvs;( trumxo nudlm nmfci ()s2ua(mpot1aex mfeias a2eanmp t)teeoxociotfm r uvo t s2xoir oodal n ies ()s2uaxr ;u4oee mfeiatfmDumumo u)tltrifcoa1fpDr nei () rxr(mpno4lm nmnviat s2rrx o;u4opeomiciydls2rauvon(0 eeoio3ootfpDr uvs;t)teto(mpnu4lmenlivilsfsrrm(ront1oleo i3tysfm elnvo;t0altrxo oo1lp  ln i;(  rxmxopiu1ol  mnes tfarrrxmpot0tptoiietysfsDel( p;t)texoifcootfmDrai i s) rtr(o io4opte fct s s2uru pnt0olt mf3tlslmDemuvpnt4tltomocoatfmt lneil()setmxo iodaleelnci (fsDrau  nu4ale mociat sDulumo;()trtrir3oo1opt  u i t)trxmxopio4oltemfcs s arurxr no4apxnmi3iltlaDean o;(0tlenmr iodla  anvs s  rtriopiydlm  mietls)sDuru  ot1opxn o3taslm uluvsn(4 etnmo3iy1faDraivi t  eum(opoo4apenmncsasfaDrrumono4oetomieilslm2rmuvsnt4trtrif oytlaD au i;s)trurxr3oo1optelfcsasf 2uaum nu0aeto icilt m rl(vsnt4tlxnxr ia1laD livi;( s2uriopoodalt micia(f Dtmump;t0oex  feiltfm ra( o u4 rtoxr oatlmDranei;s teur(rpiy1apenmieslsf rrau  ot0aeenifciasfm2rln p;(0 etnxociotfa rlu o;s s2tm(r3iy4apenlnctls)arra(mpoo1olenioeiatls eanmp;(4alxnif3iadlaD  ueil( srumxm ny1lptelneslsfarurxmpnt0opx  ieiltfm ean sn(0aeerxr tadomtraieo ()t2tmir oo4olenlieias)sDumurpnt4oleniicildfs eau o ()tltomf tadlp rliei (0teurxrpno1op emnci ( aDumxmooo4aeeoiietltlmDranmo;(0 exrio tydlp eaivsl(0 eumxr3oydlpe lfctlt)aDur(r nt1tpxomfeiasfa eaump u4aexoir3to1laDeauvi s0seuoio3oy1opee ieiasfsrra(moou4apt mo3tasfm2rmnmpnt)aetniociotoaDr u o;(  etoxo nodlp emfvi sfa2rrumpno1tlx  octysfs2ulnmsn(4alenxo3iotfaD aueo;s)sexoxo iy1llt  iesat)aDrmxro;t4opto i3tlsfa rm(mp u4artrmfciotoaDraues;(0srtoio3io1lpenlfcsasf rtru pnt0ole  ietatlm2uau s u0 renxr tadfat  u s s0 eto(r nodlp elneia( srurxm no1oeeoif3iasfm2rmnvon(0trtrmo3oo1opD  u i (0srto(rpou1ale  nciatfa2ra(r ;o0aee  octlsfs elu o;(4texrmfcoy1opD an i s0t2tmiopio4lpt mics s) rtm( pou0tet  feias aDulu o (4 ltnxf iodlatelueslt)t2toxr3oo4amtnlfeias  rum( pno0tpe mfciat m rmump (0tetrirctodoaDeaueo s t2umio3oo1am elfvia()aDur(moou1aeeoif3tas m2eaump;u)texnioctotfpDe u s;s) 2tmxr3nodomt  fvias)s2tr(  no0oltoif3ilsls rm(mo;(0areoirctydlp eaieils)trur(opoo4apte ici (f rumu ono4optoiicils s uan pn(4treoio ta1oa  auvo;s)seto(r3iu1ll n nvt t srumum ;u0tpeomoeildla2raumo;(0tltomr tatfp eluvs t)setm(m ou4oltn ivsls srtaumont0aexomfeilslaDrl(mo;(4artnmfcio1oaD lu o;t0 eto(m iu4llenmieiat a2rau o;t1oetoifetltla emnmpnu4tleoxf oodfm rlnvils0srxrxr3ou4ol emneslt sDrm(mo;o0altnmo3ias a emnvo u0aetoir iatfat  uvo t sruoir nu4lptn nesat)arrm(  ot1tpx mictlsfm rlu s;u4arerxr3ia1omD ln il(0texr(o3oo1ole  fei tfsrtr( onu0opxomoetat s2rmump;u0arxrir ty1omD an s;(0teum(opnudoleemiet s)sDtm(r ;u1tlxnif3ias sDelnvon() etnxr tadlmDe u i t  rtoirpiy1apeemicsat) rtaxroot4oeenmoeiltlmDemnmsn(0arxnmo3todlpD  nei t0srtr(o3nudol  lneilsf Dumu  nt0oeeomoctldlm eanmo;u)aexoircio1lmD lnvi ()srtoxm3iu1lmee fvtat) rum(monu4apt ioeildlaDrm(monu)tltnxo oodom e u s s) 2trio3iy1ap  lnetls)a2taurp;o4tpxoio3tytlmDua( o ()texrif3oytfptrluei (0 2urxr nodapenmnci s)a2raxr nu0oexn fetld a um(mo (0alerifcoa1oat lu o ( s2umxr3io1ap emivs t) rua( o;u1aleoif3ild mDean s u) lxrxr io1faD anvi;s trxr(m3no1apt  ietasf rtau  ;o0tlx ifciasls2emnmsnt4texrio todop eanvolt)sruoio oudame  fvta(fsrrm(r ot0tltn i3iat m2uan o;u)aeenio iadfpDrlnvs ()texmir ny4aptnlnviat sDurumonu0tle  i3iasfa emnvo t) lenio3oytfptrlivils s2xmxr iodal elivtls  rum(roou1ale iietld a uluvp;t4arermo ootlatr ivo t  rxoxrpoy4lltemnetl()arrm( oou4tex mf3tat aDrlnvs;t0tetnxo3tatlmtr uvilt  ruo(o ny4ome mivsat aDtr(r ;u4apenmictyt a umumpnu4tleomo oo1fa rluvo;(0 exoxm nydal elicsa( sDum( p;t0opt micild s ranvp (0 rtnmf oy1opDeauvo s  rtriopnu1ape lnvi ()aDtaxr nt0open octat s em(vp (0alxoif iy1lpt  iei ( t2xrio iydlm  lietlsfs2taurpoo0apt ioetyslm2ul(vo t0 lxoirciotfptr nvo;t  rurxopoy4ome lnvi (  rtm(ront1olt mi3ilt sDeanvont4teenxfcio1omDrluvi;t texm(mpno4ale mfvsat sDrax p;t4apx ifctytfsDrauvsnu4tlenif tadoa e nvo;()s2xmim3iy4lmte fci (  2tr( poo0olx io3tydfm2emums;t0tlxoio tadfp r uvi t)t2um(opiodlmenlfetlsfaDumxrono4olx iictadfs2umumo;t4alxoxf3to1lmt liei;s) etoim3ou4lpte nci (f Durxmo;o1tpt io3tls a uanmp t) etoxf ootfptean ils)seurim3iodalenmfvs t aDum( pnt4tpen ictydfs uaums;u0aexnmr3oadlm elieo;(0srtm(m3no1optemfvil()a2tmum ;o1teeomo3tldfmDuluvs;t) etnxo iydlp ean i ( srtmxmpoy4lltelnvta() rur( ono0oexomfetydlaDul(mpn()aexnir3iodfmte n il( s2xm(m iy4om emnetl()sDumump;o1alxo icilt s ulumpnt) rtnir3ta1oa   neo (0srtrxm3iu1olt  fvta(  2trurp;u0tlx  feiyd mDra(mo (4tleomf ia1om rlieil( t2tm(o oodalt  ieslsfartru  ;u4olt mieilt m2emu p (0 reomr oatoat  neol(0s2xmir oydlmte neils)sDrmu p;o0altomi3iadfa ua( onu) leomrcoatfa ran s;t0s2trir no4lm nlfct ()aDtrx pot1aptnmfciltlsDem(vo;(0tleomrcoo1omDe u
\ No newline at end of file
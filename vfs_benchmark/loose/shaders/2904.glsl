@@ -0,0 +1 @@
+ivo;t0s2xo(opnodlpen net tf 2ta(mpou1tpto oeiydls eluvp ()tlxnmr iytfpDeauei s) 2xmxm3oy1amtn ivtls  Dur( ont0alx  oeiyslm2rmn snu0arxoir to1omDe ueo t t2to(opiydal  lics ()srraxr ;u4tpt mo3tlsla el(vs;t0 rxrmr3tytlmDr i ilt seumim3ou1amenlfvtas aDtaumoou1tee if3iys aDum(msnu0texrmr iadopDe ies;s)t2uoirpno1ol nlivtltf rtmuront0apeomoetadfmDraumpnu)tetoxo3io1oatr u ol(0trxm(o3nu1lpe  ivia() 2urx  ;o0optn oeiadfm ra(vsnt4trermfcty1optrauvolt0 eumirpnodape mncilsfsDum(ronu0aetomfeildla2rl( o;(4teermo iotoa rln o;(0 ruoimpiy1lm n iei t s2raur oo0aexnio3tysfs2ra(mp t0 etrxo3ia1lpt aivi s0 rxoiopou1oleelicil()a2taxr nt1oeenmoetysls2rauvp;t)texnmo oatlatelieils tetmxrpnudaltelietl(fs2rmurpou4aex ifeiyt m umu p ()trtnxfciydlp  auvi;()t2toirpiu4lp nlneias) rrmx onu4alxoiieildla2rlumo u0 eenio iy1fa raies;(0 ruo(opio1am  mivsat  Dtau poo4ape mieiatlmDulnvp;u) lxriocoo1fa ean il( teuoio3ou4aleelfcs s)srtrxrpnt4tle ioetadfaDumumo;()tetrmr3iydfmDrlues (0t2uoir3io4al emfvia( sDtrx  ;o0oex iiciltfa ua(vo;t)trtrio3iytlpt au s;() 2urim3ny4opt mfeias) 2ua(mo;u1aexn octad aDemnvs;t)alxoxr tadfaDrln ol()trxoxrpny4lpenmfviat) rrmu pnt4aeen feiltfaDrmnvo;t)tetomr3todoa rlueo t)seur(m3oy4oltnmivtat)sDra(mpoo0tleoifeiat a eauvpnu0alxnir3iydfmD liei s  etmxo3iudamtn nvsl()sDtrxrp;u0olenioeiatfsDumumont)aexomo3oatom   n olt0texmxmpoo1altn fvsa( aDuax  ;t0oetomociltlm2um(vp t4arxoxocty1opD auvilt0 2xm(o3ou4lpen ivias  Dtau oot4texnmieiasfs um( o;u4aexnif3tydlm elieo;s t2xmir3oo1omt  fctlt) rurxroot1aptnmfeiatla ul(ms t0aleomrciotom  aivils0 2tmxrpnydopenlncs sf 2tmxrpou1aptoifciadlm2em(vo u4aetnif oatfmt lneo s) 2umiopou1lm  lfci ( sDurx  no1apt if3tas sDea(vp;() leoircia1oatr ieslt0sruoxr3nydlpee fct s aDuru pnu0apenif3ils m2umuvo t0trtrioctydom e uvols)sexoim3no4ol  livsas)sDtm(ront0tetnifctltls2uln o;t)arxrxo3iytla   n sl(0sexmxmpno4amee ivi s  rumxmo;u0tlenifciad m rm(vs (4 rxnircoy1oaDrlnvslt)s2urxr oodlptemfeiatfs2trxrpnt1tpenio3iydfa2el(mp (4alenir3totlptrai il( texrirpiu4lpe lieils) rtrx p;o4alxo f3iadlm2ulnvo ()altrxf3io1lm elivi (0 ruo(mpnudapt  fviasf 2urxmpnu4aetnmo3iasfa2rlnmpn(0tlenmrcoydop   nes;s0 etoxm3nodom  mnetls s2tr(  ;t1oetnmi3ildla2rm(mon() lenmo oadlat  nesl( texoimpoodllt mncsat)sDurum ot1tltn fciasfs uauvon()tlxoifcoodfatrlivs;() rtr(m3nudlmte ics s) 2urxmp;t0alt  i3tys a2emu o;u)artrxfcoa1oaDe ieils)trxoirpiy1optemfciat) 2tm(rpot0apt if3ilsfa rmuvsnt0 eenmfcoa1lmteanvi s  rtoxm oydopt mncias)srtruronu4oeen i3iyt a2eluvpn(4texoxf iodfptr nvi t0t2uo(opoy1apenlieslt aDua(m nu1tex mieiysfs ran pn(0alenir3to1fm rai i (0 ruriopiy1ole lncs sf 2tau oou0apeo ictls aDua(vpnu)tlxnmr oatlat an i t0srxoxm no1lltemfcslt) rurxm nt0aleoiieiys sDum(mp ()texoio io1lmDr i i;t)sruoxrpiydlp  mfeiat)srtauro;o4olx mfciltfa2ra(mo u0 ltnxf3tydoaDr u o s) rxoxo oudopeemnvia(fsrtrxmpno0opt  oeiadfm2uauvp t0aexnxf oy1op   nvi;(0s2xrio iudlpeemfcsls  Dtax pou4ole  oetlsfs rlnms t) lxoio oa1lmDranvo t0tetmxr iydlp emieilsfaDra(m no0apenmfetytfmDua(mp u0 etoxo3tydfmDeauvs;t)texmxr iudoptemfvilt s2ur(m ou0teto ieild s2rmn o;u)artnmf iotlmtraivi ( srtrxr iy4lp nmfvs t  Dtru p;u4oltoio3ilsfm ua(ms u4alenxr3iadop  ai ils t2xo(r ou4lmtnlivtl(faruax  ot1tlx ioeilsfs uau s;(0tltniocoydlmtran ilt)setm(opiodap nmnvsas) Drax  ;t0oeeomieild m emnmont)aetrir3iatfa  ai o t0 euoxm nudlleemfvt sf Dtrxm ;t4alenioeiytfmDeau sn(0teerifctodoaD aieil(  rtmir iu4lpen nvs tfsDrrx p;u0oee if3tlt a emums u0texrxf todfp e n il() exrimpoydaptelnesasf Dra( p;u0tptnifctydfmDemuvs;u) etrmo oydoate nvs;t0trurxr nu4op  mfcils)s2urx pnt0apto iciys sDum(vs t0tetnxocootomt auesls0t2tm(opiu4ole  ivilsfs2trx poo1apx io3iasfsDumn sn(4tlermr oydoatran i;()tetmiopiudap emfes s a2umumo;o4opeomf3tlsla2eluvo;u0artomfcoadlm eauei (  2ur(mpiodap nlicilt)srta( oot1oeeo oeiydfm2uluvo t4tltoiociodfat livo t0 rxoim iu1apen ics tfsDrax pot0ape mf3iadfa2ua( o;t0alxrmr ta1fpD ln olt) etr(o oo4lle mfcias sDtax pnt4teeoif3iyd aDrl(vs;(4 renmr oytfa eln i;t0srumio3oy1ap   fcs sf 2tr(m nu4aexomf3iysfm2ua( pnu4texrxo oadlptraivslt)texmxm3nydapeelfeilt a2trur ot4olt  feiasfsDumu o u)tlxoxo iodlmtr nesls0srumxm oy1am nlfct tfa2ra(rpot4olxnii3iltfsDra(msnt)tlxoiocia1lmtelnes s  etmxrpoudlpe mivi (f Durumo;u0texoii3iytfmDum(vs t) exnmo oatlatean slt)trxrim3oydll elfetat)sDtax o;t0tptnmoeiat s rmump;t) rtoxr iodlmDraivsls)sruoxmpoy4lm  mnesa( sDrrxmpoo4tpt mfetlsls ea(vs t4tlenxo oy1fatrliei;()t2urim3iydllenlici sf 2rmurp;o4olxo fetlt aDulu p u)teenmo3tytoa rau s s  2urxmpou4apee feias) 2um( p;u1oleomieiydlaDuau o (0arxoxfcoa1opteaneil(  2um(mpoy1apt  ictlt)aDtr( pou1tlxnmociyt m rmumo;t4teeomr tytomteanei t)trxmio iy4openlnciatfa2taxrpnu4tptomo3iytlm rlnms (4texomfciydomD  nes;s sexoxr3iydomt micsl()s2uau p;t4apxnmieiysla2uauvpnt4
\ No newline at end of file
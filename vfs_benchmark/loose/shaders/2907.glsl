@@ -0,0 +1 @@
+n ils  eurxmpoo1am e fetlt)srrmxro;o1alt if3iys sDrmnvs u)trtrxrciydlp   iei t srumxmpio4ol   nct ( arrmur no4oltnifeiltfa2umnmonu0 lxomfcoydlp r ues;s0s2urxr3iu1omt lnvsa(fs2ua(rpou1apx  i3iltfsDra( p;(4aexnif iydoa  lies;s) etrio3nu1am nlfei ()s2rm(mpnt0aee  fetysfm2umuvon(4altrif iotomtranvol( seurxm no1lm elies t) Draumonu0tptnioeiltfaDem( snt0tlxrio tydfp rlnei ( seto(o3ny1lleeliet t  2ur( oou4teeo fciys sDrl(mp;(0artnxocto1fmDe ueo;t  2xo(r iy1olt mieta()aDtr(moot0olxniociydfm2rl(vs (0tlxrxrciadfa rlivsl()srxo(rpnudom emnes s)a2raumpou1teeomoetytla2uluvs;u4 eermr3ta1fateau i s) 2umirpiy4lpe  icia() rra( o;u0tltniieildlm umuvpn(4arxoiocoydfm rlues s t2uoimpny1am nlfvtat  rurxrpnu4opx  ociadfaDean on(4 lerir3oa1lm raivo;(0trum(m iydal emfvil(  rra(ront4alxomociydlsDuanmp;t4artoir3tytfmDelnei ( seto(opiodlmenmnvilt) rtmum oo4aexomo3iasfa rl(msnt4tlxrmo3ootfat aivs s  etmxopiy1openmivtlt a2tm( p;t1altnii3iytfm2em(vs;u0alxoxrcoadomDrau i;(0teur(r3ou4om  mfcs (f Dra(m ;o4tex mociltla rmumonu) lerxfciydfm   iesls) euo(o3no1oltemictl(fs2tmxr ot1teenmo3ils m rluvsnt4altoif3iodfmt  u i s0texrimpiydap  mfvtls) 2umum oo0tptnmi3iadlaDeluvp u0arermociotfaD  i i ( t2xrimpoy1apte ies (fsDumxrpoo0opxomf3iadlm em(mp (4 lxrmrctotoa e iei t0 2xrxm ou1am nmnvtlt)arrm(rpoo4tpxnmociydfaDrluvo;t)tlerircio1omD  uvi;t0tetoio3nu1alt mneil( srra( p;u4tlxoio3iat a rmu s;t0 rtoxfcoadlpDelnvs t)tetmxrpiy4lp emfct (  Dtmurpoo4apenif3iat a2uaumsn() renxocia1fatr i ils) exm(m no4lm elfet (fsDtru o;u0teeoio3ils a ra(monu0 lxnio tadfa r neol(0 2xmxr no1optemivilsf rtax  oo4ape ifeiyslm umnmonu)tlxrirctadlptrai s t0 rtoxopoudlpenlfeils) rrmurpnt4oex  iciasla2uauvo;t4artrircoy1omtr i s;s setmxm nydameelncs s) rum( ooo0apxn feiytfm ra( s;u4altrmr3ootfptr uvsls)srtmiopou1aptn nei ()sruaurpou1oltoiicilsfs uanmonu0 etrxo3todla eln o t)teur(o3oo4omtnlnvi sfaDtmxrp;o4olxomoeild sDuanvo (4teerio iytfmDe ueo t0t2xo(r oudlm elfvtls aDtrx pno1tpx iieilsfm ua(mo (4 exnir3iytlptelnvo t setmxopiu1ome  ncilt) Dta(ront4aeenmfeilt aDemnvs u)trtrmo3io1oa rauvo;()srxrxm nydamenmieia()arrm(m ;t0opxnioeild m rlu on(0alenxfctytlatrai o;s)s2trxmpnu4lm emivta(fartau pot0aexomo3iasfa ulu snt0 lxniocoa1omtrlneslt) rtoxo3iudol emnesa(  rur(m ;t4tlto fctad s2ra(mo t)altnxfcta1oaD livi;s  2xr(opio1apenlict t) 2ra(r no0tetomf3tat mDea( p;u0altnio oo1oa e ueo;() eto(opiy1ap emnvsl(faruaxrpou1aex if3tydls2raums ()tetrircoa1oatr uvi s s2xrir3io4lmtelivtlt  Duax  ;t0tle moctydls2ua(mp;()teenxf3oy1fpDeli o;()tetriopno4al n nvia(faDtaurono0tpe iieildlm2elu p;u) ltrmfciydfpD  n i s teto(rpnydlm e netltfa2uru pnt1alenmietls mDuaump;(0 eermo3tydopteanvslt0trtoxrpiudll nmfvt t)aruaxmooo0altnmo3tldls uaumo t4trtnxfciy1lateauvo;()s2xrio ou4lp  lnctas  2trxr oo0tetnmociysfm2el(ms;(4 exrmo3iy1fat  ivo (  etmio3iu1openliviasfa2ta(rono0ope if3iys s2eanvo;u4aeerif tatoa eaivi;t  rurio iodlme  fctatf Dtmum ot1apxn f3tat sDumumon()teenmfcia1fp eau slt sruoim3iodale mfcs t)srrmx oot4aptomf3iad a2umuvpnt)alxomr ia1lmDelnvol(0 2xo(m iodopee ieil(  2ta(  no0oexn icils s ul(mo u) lxrir iadlp rlies t) rurim3oo4lp nmfei s  rtmumpoo1tleo oeiad a2uauvp t)aleoxr3ta1la   ivolt t2trxr3iy4lltnlieil()aDta( pnu1tpe mi3iytfsDel( o;t) etoxrciatlmDrai s ( setmxopou4lpe lnes tf 2rrxrpoo4tpen f3iyslm2ra( s (4aetrir3oy1opDe uvi s)trumir iy1ale  fcs s)a2uaur no1tlt iieiasfm2rau o;u0aeeomociodla elnvs t srumimpnudlpenlivtl( a2ur(r oo4tlxniocild sDemn snu0texrxr3oo1lmDr neil(0t2xr(rpiu4ap  liviat)aDur(mpno0oet ifetadlsDrm( o;t) exnxr oy1oa   nes;s) rurio io1amenliet t aDuaxr ;o0alto o3ils s2rm(vo;t0 rtrmr3oo1fpDelueo t)t2xrxm no4opeemicil()srrrumpou4alxo f3iad sDea( o;(4 ltrxrcoadomt  nvi (0tetm(r iodoptnliei (faDum( p;o4apx iocils a emnmsnu)arxomf ia1lmtrlivi ( srtm(r3ny1ope mfvta()a2rm( pot0olenii3tatls elnmp;()alenio3io1omt aneslt0srxr(opoy4om nlfviltf 2rm(r ;t4tee ii3tlt s eaumo;u)tlxrmo3iydlpt  ivilt)teuoxr ou1lm elfvtls)arrrxm nu1aex mi3iasfs2uanmsn()teenxf ootfptr ies ()setrir io4opeelnvil()sDtrxrono4teeniictysfmDemu pn(4 eeomo3ta1om rlnvo;()s2tr(r iu4omenlfvtat)s2tru p;u0aetnifeiysfs rau p;t0tleomfcoa1oa   i i (0 euo(m3iodopeemfvil( srtr(mooo1tle iociatfaDrl(vs;t)tlxnio3todfmtr n olt)trtoirpoo1lpe  fctlt)sDuauro;t4optomictltfsDrl(ms;()artrmo tadfmDraivsl( trtrim oy4ap nmiet t)a2taumpoo0teenmietasfm el(mp;t)tetrmr to1lptraivilt0trum(r3oydamtn ies () 2rrx oot4olenifeilt a um( p;()trerxrctotfaDeai o ( texoim3iu4am nlfvilt) Dra(m ot0alto i3tadlmDrluvp (0 exoiocia1opDraues s  exm(o oo4olee nvias  2rmu ont4tet  feiad sDuln p;(4 etrif oy1op eluvol(  exo(o3nu4am e icsltf Drmu o;o1alxomociatfm2eaumpnt0aetnircty1fm raiesl(0 etoio3iu1lltnmieilt arrrurp;o4aee  feiltfm2emnvsn() exoxo iy1fpD  ues;s) rxo(r3ou4op  mieslsf ruaxm nu4opxoif3iys sDrluvo;u4aeenxrcta1oa  luvi t  euo(m3no4al  mnesat)sDrr(mooo0olx mocildfsDeanms u0aeenmf tatfmt aivol( tetmio3iydopee feta()a2rau o;u1tlxoiieildla2umu pnt0 etrmr3iotopD aiesl(  rurxopiu4op emneils srua( o;o1oetnif3iasfaDrlnms;u0teerxo3oo1oa eai olt s2xmimpnu4omenmfvsl(fsrta(m nu1alen f3iatfs uanmonu4 rxomr3iadfpD auvs;t0 rtoxr ny1apenmfcsa( s2rr(ro;u0tle  o3tasla ulump t) rtomoctotlaDr nvsl(0t2toirpiy1llte fei sfaDrmxm nt0teenmo3tasfa ra(vo;(0alxoxfciy1opDe ivols)t2xmir3oudlp  mfci sfaDrrxmpou4tpxnmo3iatfs2elnmont4 lxoxrctatopt  n sl()truoim3ou1lpt  nvia(  2rm(mo;o0alxn i3iyslm2umnvsnt0tetomocio1fp  lu slt)srumio3io1al   ics (fs2raumo;o0optoii3iytfsDemump u)aetrmrcootfpD auvs ( srxmxm no4ameelncilsf 2urxro;o1olx  ietydls2umnms;(4tlxoxrciodoptr u ols)trumim iydameemiei ()aDtruroot1apx mi3iydfm ua( o t4tlxnmfcoydop  liei s setmxo3oudaltnmfcsl(fsDur(mp;o0tptnmi3tlt s2rl( o t0 lxoifciydlpt auvi ()setoxmpiy4lp emivta(fs2raum ou1tet mietldfs2rluvs;(4 rtnmr totoatr nvs s0 rtmxopio4op nmnetat)aDrr(m ;u1tpen o3iysls2emn p () etrxr3oodfa elneols)srumir ou4op e fviat) Dua(rpot1tleomo3iyt m eluvo u4arenxociatla ean s;() 2toxr ou1ame  ivsasfsrtmx pnt0aetnii3tytfa2ean pn()tleomr3iydfm elnvilt setmxm3nodlpen fcilt  rtmx pou1aleniieilsls2ua( s;t) lxnir tytfaDeln o;()trtr(opoy1lmte fetlt  2um(m ;u0tpt iicils a2ul(vp;t)tetnmocia1optr i i (0srxoxo3nudome  fet ( a2ua(ronu4alt miciat s ulumsn()trenirciotoa rauei t truoirpnodomt lfet s  Dta(monu0opx ifeiytlm2ran o u)arermf3iadfa rli ol( trtrxmpnu1am nlictat)aDrruront1oeeo o3iysfa elumpn()alenio3todfmD  iesls) eurim3iodap nlnesa( srrm(mooo4tpto feiltla uau s;(0 eeriociatlpteanvo;t0seto(m no1lm  liciasf rrau o;u4tetn iciadlm rm( p t)aetoxr3iotoaD luei t)s2tmimpnudlpee feias)sDumx poo1apt  f3tyd m rlnmpn(4altoio3ia1oaDe ivilt)trumim iu4ale  fetlt aDrr(mpou0oleo ociytlsDem(vpnt)aetrxf3ia1lmteluvslt  exmxr no1am n fvsat)arum(rp;t4tltnmf3iydlsDeau onu0altoif3ia1fmt  uvil() etmxr iu4lme lfcils a2rr(m nt1olt  o3iydfs2ranvp;t0aleoxo3oodfpt aivs s0sexr(r oodam n nciat sDtrurpnt4oee ioeilslm rl(mo t4teermf3oodoaD  u sls0srumxr iu4op  lnvi ( srrax  nt4apeo octydfs2eau o;t4trtnmfcoatla e ieo;(0s2umir nu1lmenmfcia(  rrrx  nt0tleoio3ildfm2rl(mont) eeoxf tatlp r ieo t s2xm(opoy1lle  ncta(f Dtaumoot1oeeo oeiysfs rmu onu0arxoir3oatlptrlivi s0s2urxmpou4al n fesa(fa2urxmpnt4aleniieiltfm eluvp;(0trenmo3ootfpDeln sl() rxmxopnydlpen ivilt)a2ta(ronu1apxnmietatlm ra(mp;u4arxnmf iatom eaues;t0teuo(opny4ame mieslt) rrmxm nu4opxn f3iaslaDemnmpnt0aexrmfcoo1lp  lu s;s)t2xmxm3no1amen nvtls sDrr( pot1apeoioeias sDemuvp t0altoio tatlmt lueo s teum(o3io4llee nei t arumxmoot4aleoiieiatlsDrm( o;t)trtnmfctydop r ivi;()s2uoir3oudllenlivslt)aDtr( ont4openii3ilt m2emn p t) rtnxr iytfp eluei;s0seuoxo3nu1lp nlnetl( sDrmu pou4ole  iciatfm2rm(mp u4 etomfctodfpD luvi;(  2trio oydllt  nci s srrmxmpot4tee mo3iys s eau o;(4 lxnir3todfa ean ils)s2xo(mpiy4ap emnes s aDra(mpoo0oeeomocild m uaump t0arermf oy1la   ivilt s2tr(o ou1al  miesas)a2tr( ont4tle ii3tas s2ua(vs (4artomr oo1fmt  nes;s texr(r3nydlp e fvt tf 2umur oo1tetnmoeiasfs ulnmsnu4trenxo3totoate n i;t0 2umxr oy1lpee nei tfa2tr(m ;u0optn o3iat sDemums t0tltnmoctydlaDe neo;t) eurxr3iudlm  lietasfsDuaum nu0tpxo i3tadls2rm( p;u0tleoxf3oa1la e nvil(  rtmxm3oo4lptelivia() rururpnu4ape  ictadla2ra( s;u) rtoxr oydlpt livo;s) exriopiu1om   icta( srtmur ;o4tpt  i3iasfa2ulnvsnt4alxrmf oytlptr n il()t2toxm3iu1lptnmnvi tfaDurx oou0oetnmietlt s2elump ()aeenmo ootoaD  nes;s) rxoxo nudamt  fei sfsruru  oo1teeo o3iatls2el( sn(0trermocta1lpDeaueils seum(o3io1omtnlicils a2uaumont1aetn fciasfa2eaums u0trtoxocoy1latrlu olt  2xmio3iu4llt  ics (fs2rr( pou0teenmocildla ea(mo t4 reomo ta1fpD auvol(0s2xr(opou1lptnlfcilt) 2rrxrp;o1tpxo iciasla eanmp;(0altnmr io1lm e neil() rumir3nu4om nmicsasf rur(r ou0aexnmo3iad a2ranvp t) exniociodfmte u i t0srtrxm nu4ll nlnvta( a2rrxro;o0opxoio3iasfaDua(vo;u) renif oodfm  an s s)texoxrpiudaptnmfesatfs2rr(  ou1tlxo fciyt aDrmn p;(4 lenxrciatfpDeanvs t t2uoir iudomee fetl(f 2tmxr ou4olx  o3tydfm ulnms;t) rxomoctadlp elneo s0texr(m oy4op e fei (  rta(mpot1tlxnifcilt s rl( p;t0aetoxoctatoa elnvs;t)srtrim3iydlmt mfeil()s2umum nt0texnii3ildfs rau o (4areomo ia1fm rauvs t)srxr(o nodllte net t) Dumur oo0tlto icilslmDrlnvs t4 lermo3ia1fmD  nei s0srtrir nu1lm  mnvtlt)sDtrur ;t1apeoif3ildfsDean snt0texrifcoadfmt lues ( trur(o3oy1amtn fes ( a2ur(rono0tet  fcilslm el(mo;t)aeenxr3oytlmDr nes (0seumxm3oodlpt  nes t) rur(rpou1ape  ieildlsDel(vo t0 etnxrcta1fa raiei;s0t2xo(rpoy1ol  mnesa()a2umur no0ole  o3iyslmDeau s;u)texoirciotfp elu s (0trur(r oy4apteliet ()aDrm(r nu1tex ifeiyslm rlnvp () eeoxf3iy1fm  livil(0 rxrio3nu1omenmnvsat) Dra( o;o0aeeniieiysfmDrmu s t4tltoxoctatoatrai i;s0trxo(opny1lpte fci (fartr(rono0olt miciytla umnmo t0tlermrcoadlateanvslt  2xrxmpnydalt mncsat srtm( pot1tpeomfeiadlmDuanmo;t0tltoircty1laD  u ils  ruoimpnodlpeemfetl()a2rmxr oo4ape  ieiatfm rl(vp u)trtrir oydlp rln slt  etmxr3iy1lptnlics (  rumu  ot1tptn oetadls2ra(msnu) rtnxr3ia1omte nei;t)teurio3no1lme licsltfaDtrur ot4oltnif3iyt mDuauvo;u) leoif3ia1oat au o;t0sexmxm3oudlp n fctasfs2tr(rpno0tle  fetas s eanvp;u0aleomo3iatop   ieo;(0srxrxo nu4opt lfvt s srtr(r ;u1oeeo ieiydfa2el(ms;(4trtnmfcoodfptr nvo t  2xmimpio4ap  lfvilt) Dtmu pnu0teenmietys aDrlnms u)alxnxo3iodlaDr uvs t0 etm(opnydlltelncil(fa2rmxronu1oet  fetyt m2emuvsn() rxnxf oytlm elivo s0trtm(m iudll elfvi s  rrrxmont1olxnif3iad m2rm(vp (4arxniocootlatrlnvs ()sexmiopoudap nlneta() rraur ;o4texoifetldfs2eluvp;() rermo ta1lp r nvs;t)s2xmxo3nu1omee fvtl()artaurpno4aetomociad m2ran o (4trtnxfcoadfmDrlu s s  2umim io4omeemfcs tf ruaxm ;t4tee  icils a rl(vs ()trtrif tydlaDelnvs;(0t2tr(rpnu1apte iet t)srtmx  no0oeen ictytla eaumo;u4alenmr3ia1latr u ilt) rtmir oydlm   ictlsfs2tmx p;t0ope iicils s ran p;t)alxoxo3ta1la elies t) exoxr iu4lle lfctat)s2um(mpno4texnmoeias a2el( pn(0artoio3tydopDrlivo s teum(r oudaptnmfvslt  Dtm( oot4tet mfeiat s2elnmpnu4 exnmrcta1fmDr n s ( trtr(m iydaleelfvsltf Drmxmoou0alt ii3iysla rau s t0aetnmr tytoaDeanvi t)sexmirpoydll  lfcsatfa2tmxro;t1tpxnmictld sDrmn o (0texomo3totfateln s t0 2xo(opny4lmt  fei ()aDrau pnt0oexn oeilslm2rlnvp;u)texnir oodoatrlnvol(0 rxr(m3iudllenmivias arua( pnu1tpeo f3iyslsDumnvs u0tetrxo oadom  lneilt0trxrir3iu4op  lfeias aDtmxmo;o0oeto octltls em( o;(4altrmo3oatop  au o;t0t2xrxo3nydop nliesa()arrm(moou0opxoioetltlaDel( snu) exomocoytlat au i t srtoxo iy1al  mfci sfartaxr ;o4ape mfetytla eau o u4trenxfciytfaD ai s s)trxmxmpiu4amt  nvsat srrr(moou1tpxniieiaslmDrlumpn() etrirctytfat aieo;t) 2xm(m3nydlp nlnvilt s2rmxro;t1apt  fcildlmDuau p u4trxrxo iodlptrai s;(  2um(m oy1am emicilt) Drmx  ot1oexoif3iytlmDea(ms ()trenmf tytopDr n s s tetrxrpoy1opeelicia( srrr(mpnu0ope  feilslmDua(vs u4artoxr todom  aiei t s2uo(o iu1lp elfvtlt) rrrxroou1tlen o3tys a2ranmo (0artnxf3oadopt auei;s)seuo(r ny4al nlfvs () ruru o;o1opeoifeildlm2eaumon(4tetomf iydlm e uvi s  eur(r nudam  mneilsfaruax poo4oltnio3iydfa raumo t0teeoio3io1fp   n ols0tetrir3iy4ll nmfeils)srtmuront4optomiciytfm2um(mp;u4tetrmocia1optraivilt  eurxrpiu4lpt  fcsls)s2uau p;u1altnifcilsla uaums;t) lxoio oo1fpD  iesl(0trxoxm3oy4om e iesls a2tmuro;u1oet  ieild sDrluvp t) lerif3io1fp e u il(  etmxrpnydlme  neil() Dtmx poo0tee  f3tldls umnvp;u)teermo todlpt  i slt)srxrxo iy4apen netas)sDtaumo;o0tee  oeiadfsDumnvsnu4 rxoir3tatfm rlnvi s)s2umxmpny4lm nmneil()a2tmurpoo4opxnmfciat aDumnvpnt)trenio tytoa   n s t)srumxmpoo4amte fcs s aDtaur ;o0aeenio3ilt m2el( snu4trxomo3ia1lmt an s;() eumxo ny1omeemnetl(farurx oot1aeeo ociytla uluvs t0trtoifcia1omDelnvsl()setrxm3nu4am n ietas)s2rm(roou1oex iictytfa2elumsnt4aetoir tytomte ieol( s2xo(o nu4ame  fcia(fartmxmpno0oexomi3ias mDeanmonu4trenif iotfpDr uesl(0s2tr(opoudlpeelfetltfarta(r ;o4oeenio3ils a rlnmp t4 rxnmfctotfpt li i;(  etmir io1amtnmfvtatfsDta(r ot1aptn fcild aDeanmp u4 rtrif ootoa eaues s0srxrir iy4olenmnvslt artaxr ;t0tpen f3iltla rm(vont)tetrio ia1fat  ivs (0t2to(m iodop   iesas s2tmumoou4ole  f3ilt m umuvs u4tlerio3oo1om elu s;(0teto(m3oy1lpenlnciasf ruaurooo1alenmieiltfmDulnmo;t0trtnirctodoptr u i t0 eumir nodal elieta(f 2trx pnu4aexomociyd s2ulnvsnu0 rxnio3oa1laDeaieils)t2tmir iydome lncsat  rtmum oo0oet ifctls sDem(mp t) etnmr3iytfp   ivi t t2xo(rpnodaptnmneslt)a2rru  nu4tle mfeiatfaDua(ms t)alenxfcta1omt anvi;s)setrio3iodaltelncsl(  2trxm ;o4aleoifetadlm2elnmo u4 reriociodlptr nvi;( srxm(m iodol   fetasfarurxront0tetnmictyd s2uan o u0trxrmoctatfmt  i o;( trur(o3iu4omt mfeia()srrm(mp;u4olx micias sDeanvo u4altrxo to1lmDran slt0sexmimpnu1llt  ivtat)sDrrxront0tptnio3iaslm2ul( s;u) exnmocoa1la eaneil()sruoio nydameeliei (fa2truront4tpx  ictytfs ua(ms u0tlermrciytomt lu i;t0 rxr(r oy4aptn netasf 2urxmono4oet  oetaslmDel(mo;t4tlxnmr oo1op r iei;t seuoir io4lpte ieia(fs2ra(ro;u0ole mo3iasfaDran s t)altnmfciy1lpDe n sl(0tetm(opny4ol  lict tfa2umx  ;o0tlxnmi3iad s emumpnu0altnxfcto1oaDe i s t0setr(r ou4ale  nei ()s2ur(ro;o4oexniociltfa rm( o;t0artoxociytfmDeauvsl( s2tm(mpio4ole lfcs ( artm(mo;u1oexniieiatfaDuauvs u)texrxocoadomteaueslt)srurxmpiydape mncs s)sDtrxmoou1texo ociyslm2uan s;t4trxoxo3ootfatrlnes (0teuo(m ou1op   nctatfsrum(rpnt4aee io3tld sDem( o u) rtnxr3oytfate neo t  ruriopoo4omt  nesas srtm(rp;t1ole ifcild mDumn s;(0aexrif todom rai i () exmim3oy4omenlicsl(f Drmxmpnu4apx if3iadfs rmnms u0artomo oo1omtrlues;s s2xm(m3oudlmte nctl() 2raumoou4oeenifetasfm raumo t4tlxrxo3tadlmD  nesl(0 euoimpiy1ame  ncsat)srrrx pou0tpe iietyt mDea( o;u4trxomocootlmDe ivi t teuoim3ny4lpte nvtls s2ra(rpnu1olxoii3iytla umu snt4tetoxrcia1fat au s;(0s2urxo3ny1ap n iet ()aruauro;u1aet mi3iat aDrl(vp t0trtrmocta1lpteaivol(0 ruoir nudaptnmncia() 2tax  ou4aee ioeiydfsDemuvo;t0 etnio tatfa  an s s  2umxopiodop   netlt s2rmxm ;u0alen ieiadlaDum(monu) lenmr3totlpt ln i;s0 eumxr iy1op nliesat)a2tmxm ;t1texniiciys s2ra( o () reoir tydom  lnvo;(0 etmio nu4altnmfes sf Drm(m oo0olx mfciysla ranvo ()tltrxo oadfaD lnvsls) exrxr3iu1op  lfvsas) rtmur ;t1oee mi3iatla ulumo;u0aeermrcoytlatrluvsl( seuoir nydalt micsa( arrrxm oo1tlenii3iasfa elumsnt) exnmociatla rln s;( s2tmirpny4lm e ics tfsDur( oou4aeto f3ildfmDuln p;u4treomf3iatlaD aieo;s0trtoir3oo1optemnvt sf rtaump;o4tpx ifeilsfs rlnvs t)trerxrcto1oateli i;t trtoxo3nu4lmenmnetat) rta(rpoo1apxomfeiys sDrln pnt0teenif3totomteaneols t2uo(rpio4omt livilt) rtaumpno4opxomoetltfm2em(msnu4trxrmrcta1fatrau i t t2xoio3oydalt  nvias)s2trx o;o1tpto octatfmDrm(mp (4tetomrciadomDrlneil(0 2toxmpiudlm n neil( aDrr( o;u1tpto i3tas m rau sn(4arermr3tatlmteluvol(0 2ur(o nodom n nvia(fsDrru  nt0teenifetydlsDelumpn(4arermo3oydlm  aiesls0 2ur(rpoydamt  ieslt s2urx  nt1oexomf3tyslaDrauvpn()teenifcootla r uvo (0 eur(o3no4ap elies tf Dtmum nt1tleo fciydla ua(monu0trtnmfctydomt lnvo s) 2uoio no1lpeelfvtlsfa2urx p;t1alxnii3tat a rluvsnu0aexnir io1om e n s s0srtoim iy4om nlnetl()s2uau p;u4tpxniociasfm2eanvp t)arxnmr oy1faDeauvo ( tetoxmpiy4omtn nesls s2rrxmpno1tpto octat a ea(monu4alerxf3iy1lat li sl()texmxr oudll elnvi s)sDtaurpno4opeomieiytla2emu p;u4altoxrcto1late u i t seurxm nu4llt mneil( s2uaurooo4tpxo i3tld s em( p t)tlxoifctydlpte ivs;()trurirpnydaleelfesa()a2um( pno0altnmi3ildls2raumo;u)tlxoirciytfa r uvs t0 rxmiopnydolt  ivtl() Dumxmp;u0tlx iictytfaDemu pnt0arxomfctatlpD lnvo t t2tr(opou1lmte nvt (f Dumx p;o4ope  feildlm2rmn o;(4trtoircoy1oa eauvo;s0 rxoim3iy4am nlnesa() rurx ooo0aptomiciatfa2uln pnu) ltoxocoo1op eli o;s)trtrim ny1ol nmnvi ()s2rrum ou1tltnioetatls elu p u4arxrxo ia1fat aies (0teurxr3nu1amt  nvils)s2raxr nt0aeeo f3tld sDulu ont0 rerxo oydfaDeln ilt) etmxmpny1lleelnct t)a2umxr nt4alxnio3tlt s el(ms;u)tetrxrciotopDeaneo;t teumimpoodam nmfvtas a2raxr oo0ole ii3iadfm ea(mon()tetoiociotoaDeaieo;(0 exrir io4lmtnlieiatf Dra(mpnt1apeo f3iyt m2eanvsnt0alxoif3ty1fmDr i o s0trtrxr iudoltelneias) rur(  oo1oexnif3iadla uln p;t0 lermr ta1opteaieols0 2xrxopiydol e fvi s) rtrurp;o0olx mf3iad mDea(mpn()trtoif3oatomDeaieols)seumimpnu4lme lnvt (fs2rmu  ou0tpto ieiatlsDrluvpnt0trerif totoate ivi;(  2tr(r nodaptnmnet s  rum(r ;o4altnmoeiys s2rm( s;u4tlenif3oo1oaDe ieo;s0s2um(r nydomt mivi t)srrrx p;u0tptnmoetatfaDemu p;t0tetnxf iatoat aiesls  etrio oy4openlfct s  rra(r nt1texoifciltls eluvsnt0areoxfcty1fa eliei ( trtmio io4opt mivil( s2uax p;o4oltn i3ilslaDrl( pn(0tltrmo3iy1fpDelneo t0seto(mpny4ol  mictl(faruaxmpnu0oltoii3iatlaDrmump;u)arenir oodopteaieol(  rtrirpiydlltnmnesls  ruaump;u4opx ii3iytfsDua(vont0tlxrifcoytoptrau olt0teumxopiu1lmen ivsat) Dtmumpnu1ope ifeiatlmDeanvs;u4aetoxoctodopDran o () exrxr oo4apte nctat)sDurxroou1oetnio3ilslm emuvpn(0tltnxocoodomteanei t0trtoxr oo4ap   nvils  rumuro;u4teto fciad a2rlumo;t)arxrmf3tydlmDr nei;s) rtmim3nu1al n fes ( aDuru  no1alxnmi3ilslm rmuvo ()aexoio oy1oatr uvs;(0s2xmimpiu4op emneil() Dta( poo1aee iociadfa eln snt)trtrir3oadfm r uvols)sexr(o oodop   ncil() 2rm(mont0olxomi3ilt mDem( pnu)altoxoctytlpDrlnes t s2toir3nodam  mivi (faDuru  ou4oee mfetadlm2ulnmpn()tetnmrcoodoa   ieilt0 ruo(opiudamt  ncsa( arurum nt0aleo o3tatfs2ranmsnu4aexriocoodoa rlieol(0t2xoxr3iu4lmee ictat) 2umxrpoo4olxomociydla2em( s ()trxoio3oatoa   uvi;(  rumir nu4alenmfeia( a2umur ;u4tpt mociat a ra( onu4 reomfcootfaD lnei t0s2to(r3nu1om elfesat)sDtrumoot0tptnio3tldls2ranvsn()alxoif3oa1oatelivi s seuoimpiydlpen iesas  rum( o;o1teto feiys aDrlu o t0 rxrmrciotlp e nvi;t) 2ur(r no1lmee fcias) Drru ooo4olto fctldla2rln p u4 reoxf3ootoat ln s;(0teurxr3iy4ope  fcsl() 2raxm no4teenmi3iadlm ea( s () lxrioctytlatr uvo s0t2toxm iodlm elieta()arrmump;t4olto iciyslm2rl( pn(4trermf iy1fa e i olt srumim no1omt  nesltf Dtrumpnu4tpx  iciadlsDumuvo u0tlenxf3totopDrlnes s)trtm(opoy4amee ivt tfa2ur(r no1teto octadfaDum(ms;u4artoif3ootoatrli s;t0teurxr nu1apenmivsl(fsDrmxm ;u1opx  ocias mDel(vsnu) reoxfcootlpt lnes s0 rtr(o3iu4lptnmnetl( aDrrur oo4ape io3iltfs ulnvp;u4 eerxf3ta1fa elues;(  2uo(m iodlp elfctl(f 2tax ono1apxoii3iatls uluvonu4trtrxo oadlmD anes s0s2tm(r3iu1omen nesat a2rrurp;t1olt io3tldfm2raumont) eermr3tydop ran s;t  2xm(m3ny1op elfcils s2taump;u4aexomo3iatfa2ulnmo ()artnmo oy1laDr neo ( trurim ou4lme livt t srtm( o;u0teen f3iltlmDeauvp t)tetrifcoodfpDelivs s)t2urio3nudol  mnci (  rua(rp;o0tleniiciltfs2um(vonu)aeeoxf3iotfp  li o;t  eurxr3ou1lm n net (fsrumurpnu0apx mo3taslsDumu p;t4arxrio tadom eauvs (0 2umxrpiy4aleelnvilt srtaum oo1apx io3ils aDrln snu4teeoir to1fa r ivsls)srxoxo nydam nmfvt t sDtrurpot1tleoif3tad m2rau s t0aetoio tatla  aieo ( trtmxr3nu1optemfvi ( sDumu  ;t1tpenmo3iatfm2ul( p u0 ltrir3ia1lat  uvslt)t2xm(opio1optemiesa()s2taurpot1tpe  f3ilsla rmuvp t)arxomr3iydoat  ies (0tetmio oydlptnmfvt t) Dtaxr ;u4tlxnmiciydlmDeanmo u0trxrxr todoa eaivslt teuoxr3io4om elnesas srrmu  ;t4tetoifeiysla uan p;()tlxnio3tydlmDrliei;t s2xrirpiodolt  ivi s  rtau ont4tpxoifetad aDrlnvpnu)arxniocoo1lmteaues;t0t2ur(mpnodll n ncia(  rrr( ono4teen oeildls rauvo;()trerio iotfmt lnvols0t2xoxo nu4alen ivt tf 2umxmp;u1tpxn ociydlaDrluvp t0tltomo iy1fmDeanvs t0t2tm(o3ou1amtnlivt s srrru p;o4opt ii3tysls2em(ms;t4aeermr iydlmtrauvo ( t2xoxo3iodam e fvslt)aDur(m oo4alx  ictldlm2ranms t0 exnxocootopt lneslt0trxoio nu1lltnmivsl(f Duaxmont0teen fetydfm elnms;(4 rxnxo3iatoptrlivs ( t2trxo nudamt  nvs ()aruax pno4aexomoeiyslm ran p (0 eerxf iydop e n slt0teumxo3nu1lltnmfvsl() ruaxrpnu4aptomf3ils m ulnmo;(0artnio oodlpD luvs s0t2toimpoo1openlivtlt aDrax pou1oexomf3tyd s2elumo;u)arenio3oodfmt luvo t0t2umxr3iy4ome lnvs s) rtrxmooo1olxnmf3tld a eluvsn()altnxo tydfpDr i i s)tetoxo3ou4alte ieias) 2tmx onu1oeen ictytlmDulu ont) rtomfcoa1fm eauvsl(0t2trirpoudolenlietl( a2rmuro;t1oex ifciyd sDumu o;(4arenxfcoo1om  livolt)setrio iy4ome licsas) Drrx  nt4tet mfciatlsDem(vsn(4trtnxf tadfm e u i;t)s2um(r3ny1lpt lnvsa(  ruaxm oo4tee mictys m uau pnu4 etomo3totlp eli o t0t2tmxopnu1apt mfeiat arum(r no4tpeomociltfmDrlu o;() eerxfciy1lat  u i;s  2tmim3no4lpt  ivs () Dur( o;o0teenioeiydfm2rmump u)arxnmo3oy1optelnvil() exrxr io1am   nvs s srrrx  nu0apx  fctld s uaums;t)trxomfcoatfa r n s;t0setrir3oy1ll nmnetls)arumur oo0alxoioetydls2elu o (0aexrxo3iatfaDrai i t trxm(r3iu1ame mies ()sDtr(mono1oex iieiysla emums (4aeeoxo3oo1fpt ai i;t0 2uo(r nu1amt mfvs s a2urxm nt1tpeomo3ilsfs ran onu4texnio ty1faD lies;t  2xr(m3oudol  livsa(fsrtaurpou4tpeo i3tysfa2rmuvp (0aexoir3iytla   i o t)s2xoim3oy4ol   nvt t)aDurxronu1optomociatfaDrlumsnt)areoif io1oat  ies s)setmio3no4lmenmnvi tfa2ua(m ou4oeenmf3ilt sDrm(monu) leoxo iodfp e uesls)t2trxm3iodol e ivt sfartrur ;o1alxoiiciydfm2eaums (4 lenmrcoydlateluei (0 rum(o3oudlmee fctl(faDua(m ;o0tpen o3ildlm2rl(mo t4 lxnmr iodop r ieo;() eumxr3nydol elivt t a2urur nt1tpxnmf3ils s2um(mp (4trxoircoa1fpDrau i;() rxr(r3oo1amtnlict t) rurxrpnt0aexo icils aDrm(vs;() exriocootla  lues t)t2xmxo3iydopt  ictat aDraumpoo1alx  ieildfaDeanvo u0tltrmoctodopD lu s (0 rxo(m iudolenmnet ( s2trur nu1aptnmictaslm eaumpn()aeeoxf tydoa eluvi;t0texoxo iodol  lfesl( srraumpno0tpeomfeiasls rm( snu0 lxomr ootlp rlivils)trtoio nydomt  fvslsfsDta( p;o0teen oetadfm2el( o;t0 rxnmr3tadop r i s;t)teuo(rpnu4ope  fcsa() rumxrpot4alt  o3iytlmDrau o u0 lermf3ia1fa raieslt0 2xmxo3oo1lp elivilsfsDuax poo0tpe  ieils s ea(vont0teermo3ta1fatelnvil() exmim3no1amee fei t)aruax ont4opxnio3ils m eaump u) rxrmf oydfmD luvi;()sexmxm3nydapte neil( srtrumpoo0tpenioeiydla eau s (0aetrxociadoat lnvilt)trtr(m iy4lm eliciat)sDumum ot0apxoiieilt s uauvp;u)trenir3tatfpDraieolt0s2tmxr3iy1om nmfciat) 2ur( pnu4aeto octadfs2rluvp;(4 ltoxr3iadfa  luvi (  2trim ou4lme livilt) rur(rp;t4ape  i3iaslaDrmnvon(0altoxo3oadfmDrlivi ()trto(m3nodop  mfci ( sDtm(r ou1tpenioetytlsDua( s u0 rtrxociadfmD anvi t) 2tm(o3nydome  nvt (f 2raxrooo4oexnmf3iysfaDuauvs;t)texrmfciotoatran s;()srur(o oo1om elnetat)srtru ono4aet ii3iysfm eluvo u) rxnxr3oodomt lnvo t)s2to(r3iu4aleelncs t)sDraxr ;o4oee ifetltlsDrlump u0 ltnio oatoaD livo t)s2uoxopiy4oleemies sf rtaxro;t4oee  i3iyd aDumump t4trxoxo3tadomDeanei;t0sexmiopio4op e fesat)aDrrx oot4oee mociydfa el( p u) rtoir oadlp r ies t0t2toxm3oo1ale lfeil(f rtmx o;t1oltomf3iltlaDel( o;u0 rtrifcoatomt  ivslt trxmxopnodapen ncil(faDtr(  ot4tetoioctltfs2em(von()trtrmr oytfp  ai s;s) 2toxr3nu1al  lnvslsfaDtmxrpnt4olxniiciasfa ulu o;t4aexnxfctytlpt  iesl()t2urxmpno1apt mivtlt  rtr(rono0aee ioctadlaDemuvo u0 leoxf3tadlatr u o;( t2triopou1llt mfcils arrr( pno4teeniietys s2ulnvpn(4trxoxo ia1lp rlivils)s2urxr3no4oleemies tfsrumu  ot1aeeo o3iltfm rluvp () etrxf oatfa e nvs;s0texo(m3ou4optnmnci sfaDtaurpou4aexoiieiasls eanms;t0aetnmrciy1lm  aiesl() 2toiopiudamtemivsls)aDraxrpoo1oeen i3tls s eaumpnu0texoxo3ootlm  livo;s srxm(o3oy1lpe mivs t)sDur(r nt0aeen f3ilsfmDeanmsnt)aeenmr3oatfmDeaneils)teto(o no1lpe lietl( s2rr( ono1apx moctld m eaumsn(0arenmrcoatla elivils sexrxopiydlleemnvias aDtr(r ;o0oeeomo3iys m2umu p t) exnmr oytoatelnvi;(0sexmio io1am nlivsas)a2trumooo4ole if3ias aDuauvon(4trxrir iodoaDeln slt0srur(mpiu1oleelfvsat s2umu p;u4tpt mi3iyslaDul(mo u4 renmf oo1oaDeau ils)teuoxrpiu4al  livilt)arrau pou1oeenmfcilsfa rmumpnu) renxf oadopD luvs s0srxmir3oo1om n fvt tfaDumumo;o4alenifetld m2rluvp u0artrmrcoa1oatr nei;t trtoxmpnodame  nctat)srumx pnt0aexnioctysfa eluvp ()arxoxf oatlat lieils0s2xm(m3io4ap e fvsls  2rr( pnu0apen o3iat m2rmnvsnt4 eenif tydoaD an sls) rxmir nydlpee fcia( sruauro;o4texnmi3iyslm umnvp;(4 exrir ta1omt luvi;()srtoxrpno1apenlfcta() Duru ono0oexnmoeiyd m2uln sn(0 leomf3oydopt au s s0tetmxr iu1olenmivilt)artrur nt1alxn i3ils m um(vo (0altrxf oytopDraueil()t2urxo3io1omen net s)a2tmx p;t1tptnmoctyslmDua( sn(4arerio todopt au o t)texr(opnodopt mfcslsfa2umur ;t4oltomictatfsDrmums ()teeomociotfaD lieslt)texr(rpnodale lfetls)aDtau pnu4olen i3ias s2eaums;t0 exnxoctydom e neo (0s2toxmpio4ole livs s)srrax oou1optn feilsls2uluvs (0 etnmr3oa1lpDrauvo;( sruoxopny1oltemfciatfarurum ou0tptn fciasls rm( snt0 eermf3iodlpD  nes ()s2urxo oo1ll elfesatf rta(rpnt0oex  fciatfaDeaumo t4teenir3ty1omDelivi;t) 2xmim3iy4lpt  ivsasf Drmur no0tltniietydfsDelu s;t4teeoif3iatoaD  ies;t0trtmxm no4ameemictas)sDua(mpoo1texnmfeiyd s2el(ms;(4 exrmfctatopDeau ilt)t2trxopnu4lmt  iei (  2trurpnu0oetnmo3tatfmDemuvo;t4 ltrmrciytopt auvs;(0 rto(opnydamt liviat aDuaumpou4ale mfeiadfs2ranvsn(0trxnif3tadoa  aues;s) exmxrpnudom nmiet sfsrtru  nt4oleo iciad sDum( o t0 etomfctatla ran i;t0trtrimpnu1lpe mnvsat)artmxm nu0ole ifeiadlmDrm(mp;()aexoir ootlmt an ils0srxrirpoudapee netat) Dtrx  nu4alto oeiydlaDua(vpnt4 ltomf3to1lptr ues s t2xmim3oudlp emnvia(fartaxrpot4optoiietyslm umn s;u)artoir3tytfpt aneilt)t2tm(m no4lmeemicsa()sruaum no4alx mo3ilsfs2elump t4 rxoiocty1lp  an o;t  2tmxo3nu1ap e ivilsfsDrmu onu1oetnmf3tadfs uau p;t0texnxo3tadop raieo;( t2uoxo3oo1lptnlnci (fa2ua(mp;u0opxn iciatfaDumums (4alxoircia1lmt aies;t)t2xr(o io4altemietasf rurx pnu1tet miciytfm umu o t0artnxoctodoptr n slt)trxm(m ou4ole mfeia(fsrtmxm nt4oexoiociydfmDrm( o t4trxrxfctodoa   uvils t2xr(m ny4lme mfesltfsDuaumo;u0aet mi3ilt m2eauvo u4 etnio oydopDe ivo s0trxm(o3iudam  lfvil()a2ra(m ;o1tle ifcildlsDrl( o t)trenxo3io1fmt  nvi;t0 2xrxrpoy4olee fesl( aDra(r ;o4aex  feilsfa2ra(monu0 rtnif iotfa e iei;s  rxmio3io1lpt mnei ()sruaur ;u0tpxomoctasfm2rluvsnt0tlermr oo1lptrai sls)texo(m3no1olenlnei (  2um(rono0ole ifciydlmDran s u) etoir3iodfmD aneils  exrxo ny4lpenmfcsa( aDrrxmoot1tlxnioeiadfa2um(mo;u)teeoircoytfate nvsls seto(rpou1aptn fvias)artr(mpot1aee mo3tltfmDrl(mpn(0alxnif iatomteluei t0texoirpnudom  livi t) Draxrp;o0tleomietydla umnvp t)tetnxo tydfaD livi s) rxrim3nydaltnmneil(f Dum(r ;o1alt  o3tyslaDrln on(4 lenmr3iotfp elu o;s  rxr(m3iy4oleelnvias) rrmu p;o0aetnii3iyt sDranmp;u)alenxo iodlaDr u ol(0srxrir nydoltelfvi s)artaxmpoo0apt  i3tasfmDra(vsn()texrio3iadfat au o;s0 2xrxmpnodlpenmiesa()s2tm(mpnu1oexn o3iad s2rau p;u) lenmr oo1latr n ols t2xoxo3no1amte nvia(fartmu  ;t4tptomictlsfs2ul( p;u0aeenmr totoa e i i;t0t2uoir3ou4apt mnetasfaDuaur nu1aeeomfciadlmDel(mpnu)areoiociytop rlies t) euoxrpiu1omt  fes ( aDtmxmont1tlxomiciysls el(mont) lxnmr3tadlpD lnvilt0setmio nu4olenlfvt sf 2ua(  ;u4tpeomi3ils sDuln snt4alenmr oo1fa e i o (0srumio3oy4lmeemfes sf rraurono0altoii3tas aDem( s;u0tlerir3oadfmDrli o (0sexrxr3iudol  livtatf rtau pnt0tpxnmi3iatls eluvs t4aeermfctatoat li s t0t2uoxr3oy1olen fvia(fsrur(mono1tlxoif3tad m2emums;u)aeenxoctadlm rluvo;s0sexoxmpoudopeelfcta()s2rruront1oltnifciyd s2rm( o;(0aexoxfctodlpt lnes t)texmxo oodoptn ncsls sDraur ot0tpe  oeiad sDem(von()altrmfcto1lpt luei ( trtmxm oo4opt mnct (fa2uaur ot1aet mfcild a2ulnvon(0 rxnmf3tydlaDeaivi (  2xmxo3ou1lmte icslt  rtrump;u4oetomictasfm uaums u0aetrircootfmtraues;t0 rumio iy4lmt lfct (f rum( oot0tee io3iytls2rm(vpnt0aeenxo3oytfmD  u olt s2ur(m iy1lpt  nei ()arrmumoou4tpx  ociltlsDulums;u0tlxoxf3ia1lmtelnvs t t2umxrpnu1lltemfcslsfarumur nu1aptoiictasfs2um(mp (4tetoir to1lmteai s s) rur(o3nudamtnliviasfs2tau pnt0olxnmo3iasfs eluvsnu)tlxomr ta1fatraivsl() exmim3iu1open iesa( aDtrx  ;t1oleomi3tadfa ul(mo;t4trtrxr3oodomtranvols)s2uriopiu1lle mnvia(f Dtax pno4oltomo3tysfa2raumpnt0 rtnio oytlp  auvo;t0sexm(mpny1olenmictl()sDra( onu1altnii3tlt a2emnvsn()arermf oytfm   n i ( seuoxm3iudoltn ici tfs2rmumono4ope mi3ild m2ranmont)teenxr3oy1fpteauesls)seuo(opoydole lieiasf rumx onu4tlxomf3ias a ua(mpn()trtrxf oodfpt anei s)trumxmpio4op elictls  Dtr(m no1tlen f3iadfs2umu p (0teermf oydomtelnesls texrxo io4lpt  ivtls)s2uaxrp;t0tpenmfciat s2ra( o;(4 eeoxr3ty1fmt li i s)t2urim3ou4ome mnvtat srrrxmpoo1aetnmieilsfaDem(mp (4tlxnirctadlm rai il(0 rxr(o3oydapenlfet (f Dra( p;t1tltnmoeiasfs rl(vs (0 etrif3to1laD  nei;()s2urir oudaptn ici ()artm(m ;t1opeoioeias mDeluvp t)aeenmfcootfm rai s;s t2xmir3no4ape  ivilsfsDrrump;t4tltoio3tytfa2elnmont4aeeomocto1fp  aieo ()sruoxm3iydamt lfesa( aDtaurono1aptomociysfs2em( on(4aeeriociatlptean i s) rtmio iy4lmte ivtasfaruaxm ;u0tlxniieiysla2rmuvp u)tltnifciadlm  lnes t)srxrxm3ou1amtnmneils)srrm(m ;t1ape io3tasfm2rauvp t0 exoiocto1lp eln o ( t2xm(m iy1lp n fvtlt arraxm ;u1olt  i3iyt m2ea(msnu4teenmrcta1fa   u s s) 2urxo nu1omee nctlt) 2tm(r ;o0aet mfcias sDrl(vs;t4tetrxocoydfaD ai sl( s2tr(o3nydlmtnmfcs (  rtm(m nt1oltomfetydls2ra( pn()trxnif iydfm eluei s t2toxopnydlpt lnesatfaDuaum ot1alxomfctltfs2ea(vo;(4teeoio ootfmD  nvo t0 exrir3no1omtelfcia(  Draumpoo4tlen ietadfm umnmpn(4 exrio3tatlmt lnvol() 2xo(mpio4ol  mncilt sDurxmonu0aexomictldla2el(vpnu4 etoifcoo1laDr i s;s srur(mpoudame mici sfsrurxr ot0alenii3tldls2ul(mont0tlxnxf3tadopt lnvsl(0srur(o3oy4alt  ieiltf rumu o;t0aex iociadfaDuanmp () lxomoctydfmt lnvo ()s2tmim io1lmenmfvtasfa2tm(m nt4tex mociydla2umnmp t4tleoxf iatfpDr uesls sexm(rpnu1ole miet sfa2tru ooo1oex  o3tlsfs rmu o;u0arerifctadom   uvo;s0 2trxmpnu4amt lfvil() Dtr(r oo1aexo ociltlmDranms;u4 etomociotfaDrauvs;t)srxm(mpiu1ll nmfeil(fsrtm(  nt4tpeoio3tadfaDuanvp t) exrxo tydoa elnvi;t0 2xm(r3oo1lptemiei sf Duax ont0ape miciatfs eaump t0trtoir3iodfateluvo;( srxrir3oy1apee fvi s  2raxrp;t0optn ietytfsDea(vo t0arenircoadlm   ivi ( seuoimpiu1lm emivt t)sDtr(mp;t4oexniictytlm em(ms;t4 reomo oydlpt  nvilt s2to(opoydole lnes s  rtm(m ;o0aetomoeiys s2ulump (4alenmo3totfm   u s ()sruo(r3iu1amt  icsasf 2rr(rpou4olto f3iysls emn p t4 rtrxr ia1lm elueo t  2um(opiudamtelivtls)sDum(rpou4tlenmictadfm2em(vonu4trtrmo iotom  aneo s)s2urir ou1lpt  ictlt  2uaxr ;t1tleoifciad aDel(vonu4altnifciadlaDe ieo;t)srurxo oo1lpe  nes sf 2rmurpnt1apxo fctldfmDua(vo u4aetrir oytfm rln o;t) etr(r nu1al n fvslt) 2taxmo;t0aptnioeiadla ulnvonu4trtnif oy1laDelnvs t s2tm(o oodomeelfeta(  rrmuro;t4olx  ictltfs ranvo t4 lxoirciodfp raieolt0srxoirpno4op nlivsls sDtr(m no1alxn oeiytfmDeln p u)tlermr iatfmtraneils) 2uo(opno4om n nesls artmxm no1tleo feiadlmDuau s t)texrifciatfmDranvs t0trxmxmpiu1alt mfcia()sDrmxmpoo0tetomo3tasfa rm( p t0 exnxr oadfa r i i;t sexmim iy4apenmnvt (f rua(roou4oex ioeiytfm2emnmpnu) lenmrcio1oaDran o t0 rxmim ny4lp n fet t srumxmoot0tle mfctasfs uln p u4artrio3ty1oa  auei s0srxrio io1op nlfcsa()a2rru o;o0tlto i3tltfs
\ No newline at end of file
@@ -0,0 +1 @@
+ues;(0setm(m iu1lmtnlfcsa(f Drau p;t0opxo oetasla2ra(mp;t)artrif oydfptr nesl(  etmxo3oy4ome lnvslt s2rmuronu1openmi3tadfa2em( snu0artrir3oytoa  lnvi t s2um(o iodlpt lfvsls  Duru p;t4olxomfeiytls2eau s t0 lxomo to1latr n olt)sexr(mpiy4am  mfvta() Dtrump;o1tex  ictldlsDel(mpnt4altoifcoatoaDraneilt0 rxm(rpno4lmtnmictat a2urxroot4tetniieildfsDuan on(0treomf3iydlmDelues t)srtrxm3io4amte netl(f Dum(  ou4oexo fctasfm umums;(4 rxnmo3todomD  nvi s)srxmio no1opeemiet (f 2rru  oo0apeo f3iat a ranms t0 exnxo3oa1la ranvi;s0 2urxo3oodlpe mictlt)a2raumont1openii3tysfa ranvo;t4 lermr oodfa   uvi t) rtm(m iy1ome lfctas srtrx pou0open ociysla rmuvp ()trtnmr oa1oaDr ueo t  eto(mpoudomt livi s aDuaumpou0aeeomfetlt s uan p (4arenxo ia1fat an i;s0trur(mpiu4lp nlnvs (  Dtrxront1apeniiciltfs umums;t0 lxrmf3tytlpDeauvs;t)s2xrxo ny4lmt  ict t  ruaxmpot0tpx moctld s ua(mo;()altrir3iadoa rliei t0teum(r3iu1al  mfvt s)srurxrp;o1alenmi3tysfa2el(vs t0 etoxfctodoptelnvi;( srtoim oy1apt  nvsatfarurumono0tptomieias a rmuvp;t)aleomo3ty1faDeln o ( s2umiopnydapee ivsls a2rmx pno0olenmf3tasla ranmo () ltrmo tytopteanvo;s0t2uo(m3io4olenlfetls  Drmumoou1alxoii3iatfa elnmo t4teeoirciadlaDraueols)texo(o3oydoltnmiesls aDtrx  nu0oexoii3ild m ua(vpnu0 etoxocoydfpt au s ( trxo(m iy4om nmivt t) rurur ;o1apxomocildlm2elu o t4teenmf todlatr uei s tetmirpiydlpeelfvil( aDrmxr oo1apeoifciadfaDuln p;u)aeerxrcto1lp e uesl()trtm(opoy4aptemiesl() 2rm(r ;t4tpe mfetas a ea(mp t4trtoxrcta1laDe neol( teuoxr3iu4amtemivs s)aDrr( pnt1tptniieils m2elnms;(0 etoiocootfptelies;s)trxoiopnu4olt lnvs () 2rauronu4oleniociydfm uluvo t0teenmr ta1lmDrlieil(0tetmio3nydolee ictls sDrmurpou1optnmfeiyt a2elumont)alxnxo3oadoa  ln i s0srtmxmpnydlm e ncs s)aruaum nu0alx  ociasfs uanmpn(0aeermf3iy1omtrai i;s t2uoirpny1lmenlfeil()srtmxmo;t1aee  ictat mDeluvo (0 ltoir tatlaD anvs;t0 rum(o3oo1ome  ieil( aruaxmono4tlt mf3tysla em( ont)trtoxo ootopt lueo s) ruoimpiodap n nei (  rraurpou4altnmoeiasfs um(mpnu)artomrcoy1opDranvo ( t2uoim3io1altelieils  Dtmurpoo4alxo o3tasfaDranmpnu4texnmo3oy1fm   u i t0teumir nu4ame mncil(fs2tm(m ;o1aee  ocildfaDumn o t)alxrxo io1fm  anei;(0srur(r nudlle lfeils)srtruronu1opeo fetytfs rmnmpn(4aexrmo totfa elivil( srxoxr3oy1ape lnetas)aDtaurp;u0tlxn oetys aDrluvs t4alerio3iodfm rli olt  rur(rpnu4lpe lncsatf rrauro;o0texn f3iyd mDeauvsnu0 reomo3ta1op   u ilt)srtr(r oo1lpt  feta( aDtaxr ou0oex moetysfmDua(von()alermocoydlaDrluvi (  rxoxrpiy1ole  fcsl(f rraumo;u4apt  o3iydla rmnms u4 rxrmo3oytfatrai s;(0 exr(opoydlp  mnesas)s2tm(m ot4teen feiys m eln s;(0aexoir oydlp  an o t trxmxrpoydoltelnct (fsrrrxmp;t0tpx  o3ilt s2emnmpnu4tetoio to1laDrluei;s0 etm(o3oy4altelivi s) 2rm(mo;o0aeto i3iytlm uau p;u) etoirciadoaDeauvo;t sexrxm nodoltnlnci (  2rr(mooo1olt  ociasfa2rl(mp t)tlxrmf tytfp r nvs;(0 rtriopoydll nmivs ()aDtrurpou0oexoif3iytlm2uanvp;u) renxf ty1om   uvi;t t2xoxo3iy1ll   icia(f Drm(m no1aee mietadla2rau s () lxnmr3oadfp   ivo ()srtoirpiy1aptemnvilsf Dtaxm no0open feiyt aDrlu on(4teeomr3oatopt lueils  exo(o3no4lpte fesat) 2rau  nt4oeenioetyslsDumnmo (0 lenio3oodlp   u s;(0 rxrxrpny1ape  fvs sfa2rrxr ;u1apx mociaslmDumump;t4 eerxr ty1op raueo s) rtm(rpiydap  mfvtat) Drm(m ;u1aeenmieiyt sDuln sn(0alxnxfcoatfa rluesl( teumim3ou1ape mfetlt arum(ront1ole ifciadlmDuluvo t0aeeoioctodfmDrln olt)sruoiopoydom nlietls)s2raur ot4olt  ictyd s ulumont) rtoxo3iytlp  lnvols)t2xoxr3iy1oltnlneiat) 2tmx ont4tle io3ilt s ra(ms;(4trxoif3to1omtrluei;()truo(m3nydole  fvs t srumu poo4optomiciytfsDul(ms;u0 ltomrcoatoa raueo;s) rxo(o3oy4opeemfeiat  rua( pou0tle io3tltfaDemuvpnu0 lxrmf3oadoaDr ieols)texoxmpno1lleemfeil( a2rmx pnt0opeomi3iltls2ran p;(4 rxniociydlpt anvs;s0s2umxm3nodap nmfvt tf 2um(mono4texn ietys s rlnms (0arxnmrcoadoaD li s;(0sexo(mpoy1ap n ivsls)a2urx  ot1olxomiciat m eau o;u0trtrio3tytlmD  u sl()trtmxm3nudap nlnvi t)a2tmxmooo4altnif3iasla uln sn(4alermf3oatfm e u sls)trtrio iu1alen nvsl(  rrrxrooo4oltnioeiysfsDrl(mon(4 ltrxr3oydlpDr uesls)srxoxm ou4apen fvs s) 2rrx  ;o0tpxnmfciltfs2emn ont) rxniocootlmte ivilt0 rtmir3ny1omt lfviasf Drr(rpnt1aeeo o3iatls2rau onu0tlermr iadop elneolt t2xm(o3iy4am  mfvil(fsrum(m ot4ale mictld s2elnvs;u)tltomrciotfa e u olt0 2urir3ou4lp n feiat) Dtmx oou0apto ieiytls uluvont0alxrmf tydlm raieilt0 2xmimpoodllenmfvi (  2rm(root4apenmieiltfa emnvs;u4aeenir3iytlat  nes s) rum(rpiudlp elfei t  2uru ono1tpe ifeias aDelu p (0alerxfcia1om elues;s  rtrxopio4lm  mfcs t)artm(rpoo4olt ii3iytla2elumsn(0tlxrio3oytfm  ln o t setrxm3iy4llenlnvs () rrr( pou4apxnmi3iatfs rl(ms (4arxrmrcto1lp  lneilt)texmxo oydlm nlivs t)srtau  ;o0olxnmiciltfm2ua(monu4 renxr iytlaD  ivo (0 2umio iydaptemnvtasf Dtax o;o0altnmi3iydfa uauvo;(0 exnmociodfaDelies;t0sexmxm iydaptnmfcsls srur(r nu1tpxoiieiat mDuaump ()tetrmfcoatlaD ai i ()s2umxmpiydlm  mfvsl()sDrr(m ;u0aee  o3iltfm2umnvp;u) renxf3oatla   nvo;() rurxmpiodap e feslsfaDuaxrpou4apeomictytfa ra(vpn()trenmr oatlaD auvols0teumio ny1omtn ncta(f 2uau pnu1tlxo fcias s2uln s;u0altoifciodomD livo;s teurxopio1ame mieta()aDraumpot4tpenioctasfa2ra(vo;t4 reoirciodfpteaiei (0 ruo(o nodaltnlfcs () Drmumpnu1aeeoifciasfsDuluvpnt0trtnir3iodlaD  iei ( sexmir io1lm n iesat s2uau  nu1tpxoifeilsla rl(mp;t)arenmociadoa   uesls)seto(o iu1lmeelici tf 2rm( p;o1aleomfeiys aDul(vp;u0trerir iatoaD ai i (0 2tr(m3iudlp elnetltfs2umu ont0opto f3ildla2eanvp;t)teenmr totfp eai sl(0texmirpnodaptnmfvtas s2tmum ;t4alenmociytfaDuaums t)aetnxf3oodfpte u o ()t2um(m3iodlpee icsa(  rtru pno0aeen fciat aDum(vo;t0aleoiociodfpD anvo t) etr(o3oo1ap nmnciatfsrtmur ;t0aet iociltfmDra(mo;()arxoxr3oydomtr ueo s  2uo(r3iy1ll   nci sfs2rrxm ot0texnmfeildfm2ua( o t4 rxrir3ty1op r i o s tetr(r3iudll n net tfartaxmpot1olxomfeiysfs umn s;t)texnif iatfmte ueo;s0 rto(opiydamt mnctltfs2taumpnu0aeenmocildlm ea(vs;()tlenmoctydfp  lu il()truoxr oy4lltnmnvsltf 2uaumpnu1alxn fctysfaDra(mo;(0aexrmf oodoate uei s trxoir no1omtelicslt a2truroot4tpe io3iltlm rmn sn(4 leomf3tadoa r nvsls)teuoio iu4alt  ivil()sDumum oo1apenii3tatfa2ra(ms;(0 lenirciytoa   ues;s)srtrim nodll n fvsat  2tax p;u0tlx moetys m2um( p;(4arxoxocty1la  lieo;t0 2xrio iydape  fvt s srum(moou1olenioctldls2rm(mpnu4altnmf iodom e i ils  etoio nodop eliesasf rra(mpnt0opt io3tytlm2eanmpnu) eeoxr3iatfaDelues;t)s2xo(r3ou4op nmics t aDur(mo;o0oex iocilslaDua( snt4 etomrcia1opte n i s)trtmir nydapee nei (fsrtm(monu4oeto iciatfa2ea( s;() etomf iotlaD anes t0t2xrxo3ou1aleemnci s artr(  nu4oex io3tysla2rlump;u0alenmo oytlmt  ivi;s)seuo(rpny4lmenmncsa()a2rm(  nt4aet ifciydfa ulnvs;u)alerxr ootopDelnvol()texmir3ou1om  mnciltf rtaxrpnu4texn o3iasfs2uluvsn()tlxoxo3oodoaD an s;()s2xrxmpnudam   ivias) rtaxront4ale  o3iat a rmu onu) lxoif ia1oaD  u il( seumio3oo4am elfctl()srum( o;t1opx mfciatfs2ulnms;u0 rtrxf todomteaivo (  2xo(rpiy1lpen fes tfaDtau oot4tpe iietyslsDem( s;(0 ltomf tydfaDr n olt  2uoxr3oy1omee ivsl(f rua( p;u1tex if3ilslaDumnmsnu0tlenio3io1om  auvs s trurim nu1ape mict t)srua( oot0tlt ifciysfmDrmump;u)tltomo3oytfpteai o s teum(r3iu4lmeelneslt sDtau o;o4aex mfetatfm eln o;t4altoxociodfa rlivo ( s2tmiopiydlpenlnctlt  Dtrx  no0aex mictyd a ran pn(4alenmfctotopte n ilt  exm(r nydlpte fcia(f 2tau  nu4tpt mociytlmDean s t) rxrifciodomDrln ilt0 2xo(rpno1llt  fetls a2taxm nt0opeomoeiadfm rmnmonu4 exrmf ta1fmtraieolt seuoxm oudole  fctlt  rtm(m nu4oeeomfetyt m2eau p;u) etrmf3oytoptr nvslt0t2xrxm iydapt mfvs t)aDrmxmpou4olxoifctls m2umuvo u0 exnmf iydlm raies;(0 2tmxmpno1altnlicsatf Drrx pno4teeo fctatls2um( p;u0trtrmo ta1fp  aivils)setrim nu1ome  fvia(f 2tau ooo1oleo f3iydls ua(vs u)trxrio tadoat  i o;t)teuo(opiu1opt mnctas aDua( ooo1alx miciysfm2umu s;t0alerxrciydlatraivolt)tetoiopoo1amt lnetasfsDrmx  nu4opxnmi3tat a emumo t4arxnxf iydla eli i t t2xoim ny4ap nmnvs s)sDtaum nu0olxn ictydfm el(mont0tlxomociy1lmDeaieo s  eumxo3iu1lmtnlfcia()aDrrxmo;t0tpeoifetldfm2em(msnu0 rxnxf iatlpDe u i;t srtrxr3oo4al   ici t)arta(mont0oet ifeiadfs ea(vs u) lxoif3tytfmD ai slt0t2uoxr no1amt mfctls) rumur no4apxn fetlslmDelnmpn(4arxnioctotlm  li ilt)setr(o3no4omtemnesa(fsruaum no4oleomoetytla ea(von(4trerxo3iadoa rlies ()sexmim ny1aleelieil()aDuax  oo1opt  fetas sDeanvo ()aetoirciy1fpDelneo;s0t2tm(mpnydap n icil() Drmumooo0aex  o3tldfm em(mpn(0aeenio3oatoaDrluvilt trumirpiu4lmtn fcsl(farur( o;u1tlxomietatla2elu p;u)arxnio oodlpt an o;t t2trim oo4ol   nvsatfaDum(  ;u1oetn i3tas a ua( p;t4arenmocoo1oa eanes s)tetr(rpnodamenmfcilt a2rruronu0opxo feilt m eanvonu)tltrirciodlmDr uesls  eurxm iy4op   net s)sDta(r ;o0tlxo ieildls2uaumonu4aeeoircoadopDrlu i;t0 ruoir3io1altelfcsl()sDua(rpou0aeeomieildls rl(vs t0aetrir3ta1lat  nvo s teto(r iu1opt  iei () Drrxmp;o0alxn i3tad a rlnvo;t0 etnir oy1omtrlueo;() eum(mpiu4lptelnctasf rrmxr ;o1tpxn f3tatlmDumu o u0texrxf iatfm  li o (  2xoxrpnu1aleelfei s  Dtaumooo0aet mieiad aDua(vpnt0alxrmo3oodla e nvo s  eumio3oy1ape  fct () 2urum ou1apt mfeild s2ulnvpnu)texrmf ootlmDraivs;t s2uoxo3nudom nlnes ()aDtrur ;o1teeomieils mDran s u4altrxf ty1fm  lues s)seumxr nodlmtnmict ( s2umxmpnu0texnmf3tasls rm( p;(4 exomr3iytomt  i i;(0t2to(m iu1alte net ( srumump;u4oexo i3iys a2emn p t)areomocta1lp e ivi t0 rxm(m oy4olt licta()s2um(rpou4tpxnif3iat a ra(ms;() ltrxo3tatfp  ai i ()sexm(o3iu4lpe mfes t sruaxr ou0oexniietadlm2rlnvp;(0aeenif iytfm rlueslt0srxoiopiy4openmfctl( srrr(m no4oetnmicilsls umn p;(4 rermocoytop  ai i ()t2tmxm3nodoltnmiei ( aDrmur ;t0apxomi3ilsfs2ran s;u) reriocio1lateln o s) rtoxo3oo1al   fviat)srtmu ont0texn ociltfs2rlump;u)aeeoirciodlm elivsls)trxrxr ou4am   nei t arrrur nu0apxoiieildlm emuvp u0 lxnxrctatomt  nvo;s)setm(opoydale lnvsasfarraxroou1tpxnifciys s eluvo u4 lxomociydfat aueo;s)t2xm(mpoy4al  mivils a2rmxr ou0aptomicildls rm(mo u)tlxnxr iodfateluvi s0srxmio nodopee ietatfa2ra(mp;t4ape mociad m emnms;u) rerxrciodop rlieo;(  2uoxo3oy1om e nvi sfsrtaxr ot1aet if3iaslm rau o ()areoxfctotomt  nvo t trurxr3nu4lmte fcta()s2umum nt0oeenmo3tyd s rl(vsnu)teenir oy1omDrluvi;s s2ur(mpno1ape  ieia() 2rr(ront1tpenioeildlaDrauvsnu) reoxr tytla rauvil()sexrio iy1ape mivsas) rrmxmo;u4tetn iciat a elu snu)arxrmf3oadlmDrln o s)t2xmim oudlp nmnetas) Drax pou4texo feiasfa elnmo t0alenio3oa1fatrliei;t0 2um(r io1lmtn nvtat sDur(root0tltomfctldfmDua(vp;()aexnmo oydlatraies () 2urim3iydol  mivia( a2raxmoot4tpeomictytfm raumsnt0 eeomoctotopDeluvi s0srxo(m iudamteliesls)s2rrur ou4tet ifciydfa2ul( o (0 reomrcta1lp r i i s t2xmio3iy4lpt livi (f Dtr( ont0olx  icilsfa2emu s;(4 lerxo3tatoa elu i s  rtr(rpoodlpen fcsl(f 2tmumpot1aee  ieilslm emu o;() rxnxf3todfmt lueil()t2xoio3io4ome lnviat  2rmxmooo4ape ii3tys s uauvsnu)tlxnxo ta1fmt  ivsls)s2tm(mpoy4aleelfeils)a2rr(ro;t0aet mf3tysfs ua(msnt0 rxrmo3oytlpt  ivs t0 2umxr iy4lm  mneia()artmum nt4tltn ociysfs2ua(mp u4areomf tytfaDraivs;(0 etmxm3io1omeelfvs (  2rax  ;t0olxnmiciytlm2uanmo;t4trermociy1lpteluvslt)teuoxr3oudop e fvtl(  2uaxm ;t1ale mociysfs2ra(vs;u0 etoiociytlmteanvo t)sruo(mpoudlpt  ncsa()a2rr(m ;u0aetnmietltlsDrmump;(4 eeoxo ty1oatrlues;s)t2to(o iudlpe  nvsas)a2tm( pou1oex  i3tadlm ua(vp (4 lxnmfciydlp e n s s0s2xr(o3io4opee fesatfs2rmxrpno4opeomieils sDua(vp u0alxoxo oytfmDeanes;(  etmio iy4lpt lnes tfsrtru ont0oex mf3ilt m umn o t0trtoxr3oytla   ieolt s2xrxr ny1op nlneiasfartm(  ou4tptomf3iys m el(vsnt0 exrxo todom e i s;()trtoxmpno1om  mfvil(  rraumpnt0apt ifeils s2el( pn(0trtnif tytfm eau s (0trumio io1lmtemietasf 2ta(  ou4tlt io3tls a2em(vpn(0trxrio3iatom eaneo s s2xr(m iu4alenmieils)sDrm(m ot4opeomi3iltls ra(vpnt)alxnmr iodfaDr ueo;s srtoxo ny4oltnlneiat) rtr(rpou0tle iictlsfmDeanvp;()artrio oatlmDelivils)t2xrxo nudalte fctlt a2umx  ;u0alenmieias a ul(monu4 etoxo tydoa eaiei;t texo(r iy1lpt mivsls aDra(mp;t4ale  o3iltfmDua(msnt) eerxocoodlp eanvo (  exmxmpoo4apt  ieias sDraurpnt1tltomfetltls ulnvo;u4tetrmf iatomD  nvi;s)t2xmxmpoo4lpte fei ()s2taxm ;t4tle moeild a2eanvo;t0aleoxf io1fp eluvs s0 2trxo oy4altn fesa(farurxmpnu0aexn oeiad mDean s t4 rtomo todfmtrluei;(  2xo(opiydamt mivsl(fs2umurpou4tex  f3ildla uln s u0teenio oy1la  li i;s0 rtrxm iydaptemncs t)s2um(mp;t0tltnmi3tatfm2rmnmpn(0aleoxr tadop e neols)teto(mpnudlmeemfci tfa2uaum nt4tptnifciatla emu onu) eerir3oatfpDrlu slt0setmxr3nu1am n ies s)s2rmurpoo0aeenifciatfm emuvsnt4trxoio3iodoa   uvo (  exr(r3ou1al nlfvt () Drauro;o1teenioctytlaDemumpnu4trxrir oadfm elu ols0srxmir3nudom e ivtl(fsDumxm ;u1aeenmo3tadlaDrl( p;u) rxrifcoadfaDean i;t)s2toxo oydam n ncsa()sDum(mono0tex  o3tldlmDumump;t) leoiocoodfpDean ols)texrirpoo4op elnesat) rtr(r ot0aptomi3iltlmDemn s;t)tleoio tydla   n i s0trurxo3ou4amt  iesat  rurx p;o0opeomoctatfm2emumsnu0tlermf3oa1la  lneil()teuoir3oodlmtnlncias aDrmx p;o4optn iciytls em( p t0aeeomrcoodopt au ils)srurxrpnudap elict (fsrrru ono1texoiocild m rm(vs;t4trxnmfcoo1om elneil() 2toxm3nu1optnlncs t)s2uaumpoo1oeenii3tltla2ua(ms ()alxnxrciatlm r n i;t texo(opou1lp  mfesas) rumxm ;u1tpenifeild s rln o t)trenxr iy1faD lieol( sexmxm io4om nmfetls) 2tr( ont4tpto ietlsfa2um( snt4aetoxo3iydlatrau o ( s2uo(r3ny1ape mncsl() rrmur ;t1apeo ociltfs2um( sn() exrircoytomtr ivs (  rurim iy4lmte ivtls) 2um( pot4tpeo ociltla ulumo ()arxnmf3to1lm eau i t)trtrirpoy4ale mnciatfaDrru poo1tetnmi3iatlaDumuvsnu0aleoxr oydlpDrlu sl(0 etrxrpoydopen nesas) Dtaxm nu1olxoifctldfaDemnmo u0artnmf oadla r neo s)s2umiopnodaltelfcta( aDtru pou4aet mocild aDumu o;u0alxrxo3oatfm e n s s0trxm(mpiu4ope lfct (f Duaxr ;o4aleomfcilt m umumonu)teenmr3ty1oatranvs s tetmxm3iodope  fes s)aruau ono4oeeomoctydfs ra( o;t4tltomrctytlpt auvo;t)tetriopiudomenlnes s  rta(mpou4aexoiiciadfa2ul(ms t0teeomrctydlpDrluvo ( tetrirpnu4ape mnvi () rrrxmpnt0tpeoioctytfa em(mpn(4 lerio3tytoaDeauei;t0s2xo(opio1al  mictl(f rrrx  ;t4aleo fetytla el(vs;u4aexomocoydomDran sls0 rxriopnydal  mfei ( srrmxrp;u0teen o3ias mDul(mo;t)treoir oadlpDeaivs s0tetrxo nydal elnvi t a2um(mpou0apxomfctldla ea(mo t4tltoxrcoa1op raieo s trtrim oo1lp  lfcias sruru o;t4ope ioeias s2ra(ms u0 eeoif iodfpDr u i ( t2xmxm3oo1lp elnviat) Drm(rp;u1tltnmfctltfs elnvsnu0 reoxrcoodfmtrlnvs t)seto(o nu1optnlnctatfa2ur(m nt4ope mfeiltls2ranvp;t4tltrmoctytlmDeluvi;(0 rxrir3nydope  fcsa(  Dua( onu1oltoii3tytfs2ea( pnt4 rerif3to1fa eaies s trxr(o3nodol elfesat sDrrxmo;u4tlenmoctydls2ean sn()arerio3oatlatean s;s0setrxo iodap  miei sf rtrump;o1tetn iciydlmDumnms ()trenxf io1late n o;s)teum(r3oy1omt  nvta()arra(m nt1altnmf3tytfm em( p;(0 exoxrcoa1omDe nvo s0teuoxmpnydoptemietltfa2raumoou0apeoioetlt a2rmumo;u4areoxf3iydfmt lnvo;t0 euoxm3ny1al n fvil(faDua(mpnu4opxnifctytfsDrlnvs;u0 etomrctotoat an o;s t2trxr3io1lp emnvil()arrrxro;u0oltnmi3iytfa ua(vsnt) rerxf oodfmD lueils) rto(rpou1lpt lnetl( arua(mont4opt mfetysfa2ra( o;()tltnmr3oy1la  an o;( srurxm3nu4lleemfvsas)sDrr(mo;u4tpxn fciytfs2rlums;t4 renmociydlatran s;t)trtmiopiydol nmicsl()sDumx oot1ope  ictasls2rlnmp;t0 eerxf3oo1opDe i ilt)s2trio3oy1ameemfeslsf 2uax pnt4ole mietls aDranmsnt4 rtomfciotlmDrau i;t  rtmirpoy4amt mfctas s2rr( o;o4apen oetyslm rmnmp t0 eenif to1lmtr nvsl( s2trirpnu1al  liesltfa2tm(rpou4apx  fcias a2ranms;(0aexoxrctatfmDeln ils t2xo(mpoydomtnmics t)s2rmumpoo0tlto ictadlsDeluvs;(0tleniocio1lptrlivo;t trurxrpou1omee nvi t  Dtmxm ot1aetnmictas m2umu s u0trtoxociydlmDrlueo;s)srurir3oo1aptemfct ()aDumxrp;t1oetnmieiysfsDrm(mp;(4arenmo3tydfptrau s t0sexoim3ou1lm nmnvslsfs2tm(moou1tlx mf3iad s2ul(vsnu4aleoir3tatlp eaieil(0trtm(o3ny4ale mfct tfaDtaumpnu1tlxo oetadlm2eau o;() etrifcoadfpt aues ()s2xr(mpnu4al nlieta( srum(mp;t1aeeomociysfsDuaums t)teermr ia1lm  livolt teto(m iy4alte fesa() Dtr(r no4oeeoioetld s emums;u4teeoxrciadfatrlnei;(0trxrimpiudlm   ict sfsDrmumpot0oexn ictatls um( s;t0 rxrir3ty1lpt ln s;( srurxo io4ll nmictat  Durxr ;u0olx miciyt s2emn s u4trerir tydla r ies;s0s2toxm ou1oltnmivslt a2tauroou4tpe  o3iyslaDum(vonu4trxoxfciydfmt  nei ()texrxr oudop nlivils sDtm(m ou1opxoioetas sDuauvp;t4 lxnxrciodlp eau i;t texm(opou1om emfesa( sDrrumo;t1apeo ieiydls2rm(vo;t0trxnio iotom e ies s) ruoio3io1om emfeia(faDtax o;o4optnmoeiad m elu s u4alermf iodfatrliei t)sexm(m3oy4omen neils) rrauro;t1texniiciytfs2raums u4 etnxf oo1fmte uvo;() rxr(r oo4lmtemfet (  2urxrpoo1oexnmiciytfa eanmp t0tltoxfcoatfpte n il() rum(mpou1llen icil()a2tmxr ou1tetomi3tytls2em(mp;t0arenmocoydomtrlivs;s0texoxmpou1lmee nvi ()srrrxr ot1alxomoeiyd a uluvo (4altrxf ta1oatr u slt0trtmir oy1omeemictls) rum(root4apx mieiasla2eaumont0altrirctatfa   iei;(0texm(o io4olenlfvi ( arrruro;u0tee ifcilslm ranvsnt)tleoio tydlmt luvs;t0t2umxm io4ope  fesa()s2rru pot1tpen fciysfa uanms u4 lxnir oadfptean s;s srtr(opou4amt lncsl(farumxro;o0olto f3iysls2rmn o;u0teerxr totopt  ies;()trxrir3oodom  mfcilt) Dtrum nt0oeto iciys s rluvs;u)aeerxo3iodomDraueils) rto(m nydllenlnesatf Dta(ro;u0tee ii3tas sDeauvo;t)alermo3oy1om  anei;s t2tr(rpiydlmtnmneils)srtau  ;u0aeeo i3iadls eau s;u) rerifctotlm  au o;(0 ruoirpoydopte ivta(f 2um(rono4olen feiysfs ea(mp;u) lxnif iodlmD  i i s sexo(m3ou4lpen ivi t  2ta(  ;t1opeoifeiadfsDrl(ms;()texomr3totfpD  ivsl(0srur(o3iu1ape mncil( aruaumo;o0teeoifciydlaDel(vs ()aexnmr iytfp eli ils)s2tmxopoy1lm  lfctas) 2rmu ont4tex ifciytlsDrl(mp (0texrxf iodlaDeaivilt)t2um(r3oodaltemnesat) rtru p;u4oet  oetld mDumnvp (4tlxoxfciodfm e u ol(0 euriopno4lme  ics t)s2tmxr oo1ale  octasfaDrlnvon(4 rtnioctytlatrlneils) 2xmimpoy1lmtn nes () 2trxm ;u0oexnmo3ildfm2eanvsn()tltnif iytlpDeliei;t s2urim3io4ll nmfvtlsfs2taxmpnu4open f3iasla2ra(monu)teeomr3iy1laD aieo s)trtrxm3oudaptn ictl( s2uaxmoot4altnmociytlm ulu o;(4tlerircootfpDelivs t)seuoio3iudomee nvsatfarurxr ;u1aexniiciys a2rm(mp;u0aetrmoctadla eln o;s t2xr(mpno4lleeliei tfsrrmurooo4aptnmiciydlsDrmu snu)arxoircoodoptrlnvi s)texr(mpiodaptelicta() Dua(root1tetn feiydfsDrm( p;()trxoio ootfateai slt0tetrio3ny4lmtnmfcslsf 2um( ooo4tlt iociasls uanvpnt)arenxo ty1fat ai o;s)sexr(r3ny1apee iviasfaDuax o;t0teeo feildlmDrlnvo;(4tltoxo3ty1om eluvol(0s2uo(r3nu4omen ncsat  rtrxr ot4olxomieiat a ul(vo u4tlxnmfcoy1fmt anvi ()trxo(mpio1altemictl(f Draxrooo0optomfctadfa umn p u4 rtoxr ty1fateln o t0 etr(o io4alenmfcsas srtmxrpno1tex ii3tasls2eanvo;(4 eeomf iytlmD luei;t  etmim oy4olee ivi sfartrx  ou0alen feiysfaDrmuvsn(4tlxnxf ta1fpteln i s) exmiopnydal e nvsltfaDtm(rp;o4oetn ociasfm2ua(ms () etrxfciy1fa  aiei ()trur(mpoo4lp nmnvtls  Drrxro;o1tpeoiociadfaDulu p u)treomr3ia1omt anei t0trtoio iu1amte fviat arta( pnu4aetnmf3tadfsDuluvp t)teenif iadfmD ln o s)texmir oudlptelnei s) 2taxmono0olxnifeiysfm eaums ()teenircoatomteai ils  2xo(m nu1lptemfesa( s2ta( o;t0opxoio3ilt s emnvpn(4tlerio3iodfm elu s;( texoxopoo4apeelivtls) Dtmu onu4apeoifetyslaDua(vpn()tlxnxr to1oat aneslt  2umirpno1ol nmiviltfs2raxmo;t0tpe  i3tyt a2rau onu) rxoir ia1lpD li o t teto(o iydamenlfcs sf 2umurpoo0oexo o3iadfmDrmumsnt4tlerxf iatom eln i;( seuoxr iodamtnmivslt)s2uax  ;u4opxniiciytfaDeluvs;(4 eenioctytlate uvol() etmxm3iy1lp emnctl() rurx pot4aexnifciaslmDumums;u4alenmrctatfpteanes;s t2xoim3io4omeemivil(fa2uaxmpou4olt iictld aDemu o;(0 etnmf3iotlmDr n ilt0s2tr(mpnu1lp n fvsa(f rtr(ro;o0optnio3ildlaDrl(vp ()alermf3tydlat aivs;s)srtoxm ou1optn fviltfartm(r ;t1aet mfeilt s2uau s;u) lxrio tydop  aies t) 2xm(r3ny4olt mivta(fsDtr( pno1tlx mi3ildlmDum(vpnt) ltrmocta1optelies t0srur(o3nydapenmies tf 2tm( pot1tptoioeiys a uanmo;u)alxrioctodoa r ivi s0 rtmirpou4opte icsl(f rur(m nt4tpxo fcilsls uau pn(0alxrio3iydfptr iei ()srtm(o oodop elnct sfa2rmu pou4alen ocildls2rl(vo;(4teeoxf oydlp   u s;t  exrxm nu4lptnlietas)sDtru ont4opxnmfeilt m2rln o;t4aexnmf tatlm rluvo;( sexoxm3iy4lpeemfesa() rra(  no4oeeniicils aDuaumsnt0tlxrmfctotlpDeauvi;( s2xmir3nodap   fcsls artrxm nu1oetomf3tatls uaumont) eeoxf3iadfm ranvsl(  eumir nudal emfvs ( aDurx  ot1tet  ietyt m2rluvpnu4alerioctytlmD lnvo s0sexoxopnudlpt liesas) 2uru o;t1oet mfciys m2ranvp t0aleomo3tydoat aivs;t s2um(m io4ap  mfciasf 2rm(rooo4tpxniociyt sDrl(mo () rerxf iytlm elueilt t2ur(r3iy4alen ivsas) Drr(  ;t0tetnmiciat sDuln o;u4aeenxr3tatfa e ivi (0teumir iy1ale mnvils) Drrurp;t4olen fctys m ua( p;(4trerxrctotlptranvi t tetr(r3oudap nmivs (fa2ra(mpoo0olx mf3tasfmDra( p;u)trerxf iy1lp elieolt0 2tmim iu1lme  nesat)s2tmu oot4tltnmfctatlmDemnvo (4trtoir3oo1oaDelnvs t0trxr(rpiy4oleelicil( a2tr(rpou0tlto iciltfa um(ms;u4trtnmfcoo1fp   nvi;( srto(rpoydlmt  icsasfsrtm(r nt0aeenmi3iydlm rl(mp t4 eeoif3ty1latr ivs s t2um(r3oo1olt  ict s  2rrxmooo4apxomociltls rlnmp (0 ltomr iadlaDelnei;(0s2xrxm3nydal nlnctatfsruauroou0ape iociad a elu s;()tlxnxo iotlpDrauvo;(0 2xmio3iu1omtemiei t)sDrr(mono0oleomfctydfmDra(von(0aexrmrciatfaD  ivi;t s2urir3nodlpt livs s a2trxrp;t0alx  f3iasfm2eluvp u4artrxo3oa1la  li i s)seurxo3io1lm n ncilsfsDur(mpnu4alxnmoctldfm2elumsnt0 exrif oatopDeln s;( srxoxm3iu1lp emieta(fs2ur( pnt1aeeo oetad aDelnmonu0 renir3tadlaDeai ols0 2xoim iodom e ivsa(  rtm( ont4opxomf3ilt s2em( onu4aexomrctytfa rlieslt  2xoxm oodopenlnct t)s2tm(rpnu0altomoeildlmDrmuvs u)aeeoxfcoydfa r nei (  rxmir iodamenlfcslt)sDua(mont1aptomfcilsfs2eau p;(0 rtrxrciatlpt  n i;()s2xrio3ou4al elfci sfs2um(r oo4tpe ii3ildfa elnvo u0teeoxocoo1oatelu s ()s2uoxr3oo1lm elfvt (faDumxrpnt1tptnmo3ils sDul(msnu0tlxnxrctodoa rlnvi;t  2urio ou4open nviatf Dtrxmpnu4tetoioeiasla2umnvp;t4arermo3oodlate u o;() rxoxr3io4om e nvsl(fsDum(r ;o1alx moctyt m2emn ont0aetrif3ta1fp  aieols0 rtmxr3io4al nmicsatfaDtmxmpnu1oetnmiciydlsDumnms;() rtoio3ta1oa eli slt  2trio iu1lltnliet ()aDtm( ooo4teeo icilt aDemnms;t) exomf3ootoa r i o s)setr(rpny1om  lictas)aDtmu ooo4oexo iciydlm2rm( pnt0 eenmociytom r ivs;t)srtoxo3iu1omtn fvt ( aruax oot4ope moetasfaDua( o;u0 rtoxrciytfaDelnei s sexrir3io4ol nmiesa(  rrm(moou1aptoiictat mDumuvp u) lerifciatom ran i;s  etmirpio1om   icilt)srraum oo4aee iicilsfa rlums u)areoxrcoo1oaDe uesls) 2xmxm3nodaleemivtlt  Dra(ronu4tptoioeiltfs elu pnt4trtoxociadlm  au s;() 2xrxr oydol nmneiatf 2rmump;o4opt ifcildfs2ulumo;u4alerif todoate ueol(  exrimpnu4lleemivs t)sDtr(mp;u1tltoiociydls2rmumo u0artrxrcia1lmtelu ils srtmxr3ny4lmtemiesas  rum( poo0oet  f3ilt aDraumo;()areoirctodfa e ieo;t0 2xoxopiudlle  ivsat artr( pnu4aeenmicild m uanvsnu0 exoir3todopDrluvs;() rtmxm3oudlpt mivtatf Dtm(mp;o4aet ifetad mDem( ont0 lxnmf ty1la elueslt)setoxm3ou4al n nvil(fsrrax p;t4apenio3iysfsDranmont4 ltnmr3iy1lp  lneols s2tmxrpiu1altnlfcilt s2ta( o;o4oet  iciltfa2uauvo t0 eenxf ty1oa r i ols0teuo(r ny1ll   ies tfsrrrx  ;u4tlx io3tadlaDrluvpnu0alxoxo3totom eau s;t teuoxrpiy1omtn ieil(fa2uaum oo4oltnmietatlm2umumo;(4tetomr3tatlp raueo;t)truoxo3no4al  mnet ()sDtrx oou0teto fctldfaDem(msnu)trtoiocoy1fateanei s  rumirpiu1llenmfvil(fs2tru o;o0opxnioctld a2rmu p;u0tetrmo3oo1lmDr uei t)trxmirpnu4alenlnvs (  rtm(moou0altnifctadfa2em(vs;(0 etnmocoatlpD an s;t0seumxo3oydll elnvilt sDtmxm nu0tpx  ociatlm2uauvpn(0aetoiociytom e ieo s t2ur(r oydlmt mfet t sDrrxr ;o1olt ioetat mDea(monu0 renxf3todlpDrai il(  eum(mpou1op emfcsasfsruaumo;u1apxoiietytfa2umu s;(0aeerif3oytfmDelivs (0 2toxopnu4lmee fctasf 2rm(  ;o0apx io3ils aDraums;t0arenxr3oy1fmt  ueolt texmio iy1olt lnviatfsDtaur ;o1aeto i3iysfa2eluvon() etoiocoo1oaD ln olt0srumxm3ou4am  mfvsa(fsrrmxmp;u4texoifeild m2ulu o u0trxniociytlmD au o t) rtoir oudlptn fvi ( a2urxmo;t1tpxn fcils m2uau o;t0 rxnio3ia1fp  auvol(  exrirpno4olt liesls a2rr(  nt1ole ioctltlmDelu o u4 lxrir ty1omt anvo t) exrxopno1ole mnvsl(  Draxmpnt0alxo fetaslm ulnvo t0trxrmrctytfpte nvs ()trxo(r3nodole  ivsatf 2urxmpno1alxnio3tlslm rlumon() eeomr iotfptrai i s s2urio ou4oltnmfcilsfsDra( pno1tlt iietaslsDrlu p u0altrxrctodfmD  i ols) 2xoxopnodome licsatfarum(rpot4tet miciytfm2ua(mp;(0teermrciydoat lies t0srtmio3io4om  lnetls)a2ur( pou0alt  ietatls2umn s u0aexnmf tydfaDe n o;s)texmim3oy1lpe mivtlt sDrrumo;o1tlx iociasfmDulumon() eerxfcoatopDran o;(0t2uo(rpnu4open nvtas) rrm(  nu4aex iociasfaDuln o u0 lxomocootoat  uvils0truo(opoydlmee fcsa(  rtrx oot1oeeoioeiytls eluvpnt) eenxr3tydlm eanvi;s0trxmir nydoptnmict t srum( oot1tltn f3tatfs rluvo;()texnio totopD liesl(0trxm(mpiy1oltelnvt tf 2tr(  ot4opt miciyd aDranvp t4 exnmr3iadopDrlivs (  rtriopoodll emfesat aDur(rono0tlt ifeiat aDeluvp t4tetnmfcoa1la  luvi s seumiopnu4opt  fei s aDuru pnt0tleomictyd m2ulums;()alerioctydfm eauvi t)s2tm(m iu4aleelnvias sDtmxr no1tetn o3tat s elumpn()texoif todoptraivi;(0 eum(r iu4olt lfeil(fsDumu pnu4tptnio3tydfs2ul(vsnu4 etoxf tydlaD  u s;t)seum(mpny4ap n ici ()srrru onu4aetniieiltfa2rmuvpn(4alxoxf oa1omteanvi t)t2toxmpoy4lltnlivtl(f 2uax pnu4aet io3tas a ulumon(0aexrmo tydlm ranvo ()srxmiopou1lmt  nctlsf rrmxr nu1oetn fctatlsDeanmp ()tetrio3oo1fat livolt0srumxopno4opt mietls)arrmxront1tltnii3iyd sDean p;()arxoxfctytfpt ln s;t t2trxr3iodop n nvi t  2rmu p;t4alxn oeiydla2em(ms (4 etnmr to1faD  ieo s0texoxm3ou4ale  fcils)a2truront1tpe mfetlt m2rm(msnu)texnio ty1lp  an sls tetmxr ny1ole lneiat sDurxrpoo4tpt mieiysfa elumo u0alenmr3tytopte neo;s trxrxo ny1ome lfesltfsDra( p;u1tptoii3tydlaDeaump;(4tleomfciatlmDran s;s0 2xm(m iy4ap  mietls  rrrxro;t4texo fciadlaDum(mont0texoxrctydoat lieils0sexo(opoy4lpen fcias)aDrmu onu4optniiciad s rluvp;(0 ltoxocoatoa rli i s0s2xmxm3oo4alee iei s srtrx p;t0tpeniictlt s ul(vp t)arxoxo3iy1omDr uvi;t)srurxm3ny4lmtnlieilt  2tr(m ot0apxo f3ilt a2umuvo;t)trtnxfcta1om  luvol(  rur(m3oydop nmfvia(fsrumu pou1tlxomiciaslaDulnmp;()tlenio3oatlatrluvi s)tetmxmpio1lptemfvi s)a2rr( pnt0aexo i3iytla2rm(vsn(0tlxrxf to1fatean o;t seurxr iydole lfctl(faruru ooo0tlt mieias m uln ont) rtomf tadop eluvi;s  exm(r3no1amte ivsa(fa2urx  ou0apenmiciat sDumnvp u4 lxnxfcoodlpDeaieols0seuoiopnodalt  nvt t)a2rmurooo0teto iciatfm2el(vsnu)artnmf3iotoat livsl() etrio iy4apenlncias)srrmxmo;o1altomoeiyt sDeanvo u)alxnxr3oodfaDr ues t0 etr(o3ny1ope lnvt s  Drm( pnt4tetnifcias mDulumpnt) exrxf ootomDelieslt0teur(r io4lme  ics (  rrm(rpnu1apeoifciysla eauvp u0teenmr iotfatrauvsls)trxmxr iudop nmfvils a2tr(r no0aex if3tydfa rluvp t0 rtomfcio1fp eli slt0 exoxr3oy1llt mietlt)arrrumoot4tetn ocildlsDel(mont)alxnmrciydfmt an ilt t2umim ny1olenmncilt s2rrumpnt4altnii3tltfs2umnmp t4alxnxrctadfaDr u i t) 2xrxr3nodamtnmnctl()a2ur(m ;u1oltnmoeiatlaDulumsnt)texnmf iytlmDr neo;s)t2uoimpiodllee fvslt  rrrxm ;t1tee ioctyt a2ean p t) eerirciydfatrlieo;t0 ruo(mpny4amtemfctas) 2rr(ro;o0apxn f3tldlaDea(mp t)trenxf oy1opDe nvs;( srumimpou4lp emiesls aDumurpnu4tetnmoeiltfmDum(vpnu4trxnmr3tatla e neols0trto(o3nodolt lfes s)sDrruro;t1tltn oeilsfsDem( s;u0tetnmf oodfpte ueils0t2xrxopio1lp  lfctlt a2rau ont1alt mietatfm umnmonu4trtomf3oadfaD an ils)texoxr3oy1lp n fetlt sDurxmo;o4tpxn fetatlm el( pnu)aleoxfcoatlp ranei;s t2xrir3nydal e fesat s2uaumpou4optomi3tas m ulumpn(4alxoir oy1fp elnvo s t2tmim nodame mfvtat aDua(m ou1alxnmietadlmDuanmsnt)teeoir ia1lptrlivs;s  2xoxr3ny1openmivsasfs2rmumonu1aptnmo3iltls2ulums t4trxomr to1laDeluei (0 exoxrpio1ameelfet s s2trumonu4aex moeiatfm em( sn(4arermr ty1faD  n o s)trtmir3nu1alen fei s sDtrx onu0alxoifciyslm2um( snt4 leomr oodopD aieslt0 2trim3oy1alt lfcslt)arrrumonu1tlenioctadla ea( s t4treoxf3io1op raues;()sexrxo nodale mfcia(fs2um(mpoo1opxoio3ias m2rmnvs;u4trtnifcootopte nvi t0 2ur(o ou4lmt mfvtasfsrtm(m ot1tlto o3iys a umnvsn(0 ltnxfciatoptrluvi;s)srxm(o3oy4om nliviat s2um(  ;o0oet if3tlsfm ran s;t4 rxnifciytlaDeluei;( srxoimpou4alt lfeta()aDtaxrpnt0texoiociytls2el(vsn() rerxrcia1lmtr neol() eurxr oodome mnctlt)s2taumpnt0tetn f3iadla rmuvont) rtrio ootfa e uvo t0texm(m oy1optnmfeils)aDrm(mono4opeo o3ilslm2eau o;(0 exnif oadla  au o;(0truo(o3ou1op   ictltfaDtaxrpnt4olt mf3iysfaDem(mpn(0areoxfcootfptelu s;s)teur(o3io1lle mivt ()sDra(mooo4tleo f3tatlsDemn s;u4 eerxf oy1lpt lu s;(0s2tmxr nudolenlnet t)sDtm( pnu0teen ieiys s emn s ()aexnircoodfmtrli o;s0setoim ny4olenlfcils  2ta( p;u4tpxo i3ils sDum(vo (4aeerxrcoa1lateli i s0 euoxr3ou4lmenmfes ()aDtm(mo;o0alxniocilsls ul(vo;t)tetoifcoadfm  aivo;t0texr(o3no4omt lict t) 2ua(mpnt1optn f3ils aDulnmo;() lxoir3iatoatrlies () rxmir nodam e fvtat srur( p;o1tpx mociytla umnvp () rerxo oo1lpDrai i;s0 euoxo3nu4lp  lfvi t  Drr(m ou0tlto f3tld mDel(mp u0 lenmfcto1laDrluvs s s2umxo3oo4lle lfci sfa2ra( poo1tetn o3iatfm ua(mpnt0tlenio3tadoa   ivo (  exoxm io1al  livtltf rua( poo1aptn oeilsfm em(mp (0artomo3io1omte u s t)srxrxr ny1ope  netat)aDtaurpno0olt if3tltls ea( o (4artnio3ty1oa rln slt0texrxr iu1oltn iciltf 2tmu o;u0tlen i3tad a2uan p u4tlxrifcty1lp  luvo;()texmim no4omte nesa(f 2tax pno4aee  o3iytlsDem(vs;t4tlermo iotfpDelieils srtriopoo4altnmivsa( aDtaurp;t1oexn fciytfa uauvs;t)tltnxf3tydoat lnes s)t2to(m iodlpe  ivt t)s2trxm ;t0altn fciydfs2emnmo t4aetrmocto1optr u o t0srxoio3oydll elici tfsDrm( pno4tlt  feiltlsDrauvs () exomf tytlatelieo ( t2xrxmpiy1lltemictl() 2ra(ront1alx  f3tatlsDranvs t0aleoxfciodoptr nei;( texoim oudoptnmnetat s2ta(mpot4oltn feilt sDra(ms;u)aetomocoadlptrli o;t) 2tmirpno1lme  nctasf Dra(rpoo1texo feilslmDrlu p;(0texrmr oo1opteluvo t)srxr(opou4lptemfvia(fsrtaxmpno0texnmociaslaDeanvp u4aeeomrcootfaD ln i;()seumim3nudomtn iciat)aDtrxmpoo0tleomietatfm emu o u4tleomfciatlp  ai s;t0s2uoiopiy4lptnlnet s)artaurono0apen f3iltlsDua(mo u)tlxnxfciadom rlieolt0s2trir ny1ll nmieils sruau  no0tee mi3iaslaDranmont4altoifcootoptrauvo s0 2xo(mpoodlpt mnet s arrau pno4ale ifetld a rlumo u4alerifcta1la ranei;t) euo(rpoo4ole lfeiat) Dtmxrpoo1aexnio3iysfa eluvs ()tlxrmfcia1op   uvi;t t2xoir3iudlpe  ivil(fsDum(mp;o1olx ioetytls emu onu0 rxnmrctatlatrlieils t2to(o oydoleemies ( s2tmx pnt4aet  fcilsfmDea(mp;()tlxnmfcoydoaDr ivil(0setmxopio1ape lieils)aDrr(m ;o1tltoiietadfmDemu s;u0teerir ta1faD  uesl(  rto(rpiy1ol e fcsatfsruau  oo4opxn ociadfsDelnvpnt4altnmf iydom e u i;()seur(mpiodll  lnetlsfa2tr(m nt0oltn oeilsls el( ont0 leoir ta1omtraneo;(  exoio ny1ll e ncs t srrmxrp;t4oetnmieiad s ulnvp;() eenxr3iotopDr i sl()truoirpiu1ol  mivi (  Draxmoou1oexnmo3tlsfm2rl(vpnt0texoxocio1oa e ivi (0trurimpiydal elncias) 2rrx  ;u4alxo iciasfmDeau pnu)altrmf3ta1lpt  ueo t0trxrxmpiu1lpenmfvsls) 2raxr ;o1optomfciasfaDuanvsnu4aetrmo oatomDrluvo;t trxm(rpoy1lp nmiei s)s2um(  nt1olen ocildla ul(msn()areomocootom rlnes;t)truoim3oy1am e fetl() rurx  nt4olt  o3tysls ranmpn(4arxrio3iydfp ranei;t teur(m3nudalte ivtatfs2trx oot4tpenmicilslm2rluvpn(0 lxoxr iadfmteanei t) eto(r3no1om emnet () Draxroot0opx mo3tls aDrm(vo;t0 rerir3ta1fptr ivs;()trxmxo3nydalte fvil(  rua(  ot0oetnmoctyt aDuaums;u0alxrircootla raueo;s  2urxr3nydlpen icslt sDtm(m ou0alt  f3iytfa2eauvs;u4aexrxrcia1lat  ivol()t2urim3ou4aptn ncia()sDrm(  ot1altnmfetlsfs2ul(monu4alxomocoodopDrluvolt)srtmimpoy1omtemnct sfsDtm(m ou1tpeomictldls em(monu0 eeriocoa1lateln s (  2xoxo3no4lptnlnesl()srur(  nu4tex  fciatfsDrlumonu4 etomrcoodoaDraies;(0t2umxr3ou4ll emfctls)sDtmum nt4apeo i3tld a2eanvo t0altrmfctytoaD livi;s  2xrir3no1oleelictl(f rua(m nt1aet  i3tas a rl(mont0trxrmo oytfm e u o;t s2ur(r3iu1ome  fvi tf rua(  no4tpxn octlslm2ean pnu4aeermf iadlpt anvil(0s2um(mpnodamenlies t) rtau oot4opeo ieildlmDelnvs;u)trerio iodlptrlueil( t2xrxo nodomt  fcs () Drmu  oo0opxomietytfsDumnvs u)altrxf totoaDeauvslt0tetoirpnu4omeemfvi s srua(mo;t4opt mf3tad s2eau sn()artrmo iytfaDrlues (0 2xr(rpnu1lm nmivta(f 2rmur ;t0apenmoeildfmDua( ont0 etrirciy1la eaues t s2tmimpnudopt  ncils)artax o;u4aex mf3ild sDranvs ()altnmfcoydfate n sls texrxopiy4apt  icsat a2ua( p;t0tptn fciysls2eluvo;t4tltomfctatlp eau i ()trtm(rpnu1lptemnvsasf Dta(rp;o0tptn oeilsls2rmumon()tltnmf iydomDeauvo s0teuo(mpnudlpt mfet tf 2rr( o;u4opx io3ildfa elu snt) exrmf oodla eln o t t2tr(r3oy1open nvs (  Drr(r ;o0tex  fciadlaDemump t4 rtoxfctotoatrlnvo s0t2xrimpiy4am elnvsas)s2raurono0oleoif3iydlmDua( o t0 rerif3oadlmDr uvs s) 2xrir3nu1am nmietasfsDur( oot4aptnmoetyd s2rmu s;t)altoir iytoaD livi;t  ruoxr3ny1ol nmieta(fsrur(r nt4ole iictyd mDra(vp ()areriocootfp rlnei;s)s2trirpoy4apeemnct sfaDtau oot1tpxo f3iadfa2ranmo;t4alxrif3tatfa eanvs (  2ur(mpoo1aptnlncilt a2uaxrpnu1open i3iytfa2ra(vpnu4arxrio to1om e u o t  rum(r3io4lptnmies tfs2rmumooo1opt ii3ils mDrauvpn(0trenxr3tytlmt  u sl()srurim oo1opte nvt s) rtaump;u1aleoiieilt m eln ont4 rerio oydoatr i i s srtr(o3iydllt mnvs s  Drmu p;t1alenmoctatlm2elnmo ()trtnio3oy1lm ean o ()srxmxm iu4aptnlfvsl(f ruax pnu4aptomo3ilt a2rl( s;t4 eeomf iadop eaueslt0s2xrim3iodol e nei sfs2rru p;o4aet  f3tls mDrlumo;t)trxoxf3iy1oaDr u o s)t2to(o ou4al emfci tf 2umxrpoo0ale  fetadla2rlumo (4 rtrmfcta1oaDelueil(  rxm(m3iu4ole mncs s aDtrum no1apeo o3iltfaDrl( p t4 lxnif todfmDe uei;()texrxr3iu4apt  ict t s2tmumo;o0apt mictldlaDemnvp;t4areoifctatfaDran ol( trumir nudlmt lneslsf Dtmurpot1tlxoiieiltfsDelumon(4tetoxf tadfmtelueslt0srtm(r iydlltelncs t) Dra(rp;o1olxo i3tatfa2uanms t)aeenio3to1fptr uei;()trumxm iydlp   ietat  Drauro;t4tlto f3iltla2uauvs;t4arenio oy1oa e i o;( s2trir3io1apenmietlt srraumpnt1tpxnii3iadlm2um( s;u0 ltomf3iotfateaies;s0t2xmim nu4ll eliciat  rurx onu1aexoio3ildfs2eau snt)arxnmf oadopD ai o s0s2xmio3nudlp  lici t  2uaxmp;u1tlt mictat s uanvo u0aetnmfcto1lp   uei;() 2xrxrpiy1ope mfet sf rtmx p;t0apen fciad s um( p;t) rxrmoctodlatrlueols trumio iy4opeelietas)arua(rono0apto iciyt a eaumo u4tleomo to1lmD  uvo;s0srxr(r3iy4aptn netat s2rm(m ot0alenifciydla emn onu)tetnxocta1omtelivs s0 rto(r3oodlp e fetls aDtaur ;o1oleniocias sDemnvo t) lxnmo ia1fm eli i s) exmio oy1apeelivsas srurx pou0tlx  o3iyd mDemuvo;(0 lxnxf3tadfm rlu s t)t2trim3oo1ol   net t) Dtaum nt4alt mi3tys sDrmnmp u4aleoxf3todopt ai o ( srtoxm3iu1am n fvi tf Dtrur nt4opt mfetytfm elnms u4 reoxf3oo1la  lieo s0t2ur(m iu4om emicias)srtm( poo1opx ioetydla uln pn(4trxrmo oo1fpD ai sls0trurio iu4ape mfcta( arrm(mpnu1altoif3iad a2umuvs (0teeomr tydfpt luei ( s2xoio3ou1ll e icia( a2ta(  ;u1tex micias m2emnvo (4alenmf ta1oaD lu i;() euoim nodom  mfvt s)s2uaxr ;t1optomoeiydfa ua(vsn(0arenir3iodoa r uvol( seuoxo nydomtemncsa()sDtrxmo;t0tex mfeias mDumuvo;(0aexnmf3iytfm   ueolt)trxo(opnudope  nvs t a2ra(mp;t0alxoiociltfaDra( o t0 rtnmf tytlptelu ol(  2uoxr io4ap eliesl(f Dua(rp;u4oeeniocilt m em(msn()altrir3ootfaDeauvilt0teuo(m nudal nmnctl(faDumxmoot0apx mfeiadfm2el(vp;(0trxnif3tadlm rln ol(0tetr(o3oodlmtn fvi (faDta(  ou1teeniiciyt aDemump u0texrxo3iodfate n i;s0teuoir oodamtn ici s) 2ra(mooo4alxomoetadls ra(ms;t)tlxomfctadom rli i;(0texm(r3iu4amenlfctl(  2rm( oou0oltn o3iyt mDul(vpnt4trxoio3totfaDrlneo;s)t2urxm nodomenlfcil(faDumur ot0alxnmietlslsDrmu o t0 etoxf iodfp   u ils) 2xmxm3iu4alt lietls)sDtr( p;o4oet iicilt s eanmp;(0tlerio oatfp eauvil(0 2xm(o3ou4altelnci sfarum(m no4aleomo3iadfa2rlnmo;t)trxrxf todfa r i i;t) ruoim nydaltnmnesas)sruax  ot4alxoioctlt m uau pnt0 lxoxrcoy1lmt aues t0t2urxo oy1openlncs (  2uax oou4apxniieiydfm rmn p;(0tetnmr3oydfpDe ueol()seuriopiudol  mivtltfartruroou1tetniociatfm2emu s (0 rerxfciadfpt luvolt t2xrimpoydom e net ( arrmur ;u1tlto f3iytfsDrlums;(0texnmocia1om  aueols)sexmim oy4lp nmncta() Dumump;u4olx ioeildlm2rmuvpnu0 exrmo3ty1lmtrlu i;t t2tr(m oodlptn fvtas)s2ra( o;u0tpt mo3iltlmDrmump;t)arerxr3tytfaD lnes;t  ruriopiu4altnmnet sfsrrmumoot1aee  oetls s umnvsn(4artoif oo1omD  ieo;t  euo(opoo4amee netl(  Dumu pnt4olenifeiaslm2rmuvonu4aetrmfcoa1lmDelnvo (0truoiopoy1amtnlneil(farta(r no1tpe mf3iydlmDel(mp (4trerio3oy1faDr n s s texoxo3ou4ll eliesls) Dumxmont4opxo o3ildfaDeanvs (0treomrctodlm  au sl( s2toio io1lme lnetls sDtm( pnu4tex ifciltls ra(ms;u4trtrmrcootfat  i sls  rxrxo3nudol  lict tfaDraumont0apxomf3ildfa rl(ms u0tlxrxocio1omDr ueo (  2xmim oy4lm e ietlsfa2tm( pnt1optnmfcias m2ulnvp u)tetoircoytoateaueo (  etm(m3nodllt  fcils  Dua(mpno1apxomi3iatfa emu onu0arerxfcta1fateai o (  rtoimpiy1lp n iei t) 2tru  ot0opt miciydls2rln pnu0texnxr to1omDrauvi;t)truoio3oudlle  nciat  2urxr no0aeenmfciys s2emnmp;() exrio3totla  luvi t t2umxopnydlme mfes ( aDtrx  oo0apxnifeiyd mDelums u) rxriocoodopteln sl(0seuoiopiu4lmeelfes ()s2urxr nu1olenmicilt mDelums;(4 lxomrctytlm e ieo t  2toimpiu4opte ieilsfs2taxmp;t4openmoctysfsDul(vo;() lenio oytom r n o t) rtriopoo4lmeelicsl(  2uaur nt4opxomfetys s eaums u4trtnxf iodlp e neilt0s2to(mpiodlpe mnet ( s2rmx  ;o0tpeo fcildfs ul(mp t)tltrxociytopDr ues;(  rxoirpoy4optnmfctatfa2ra(r ;o0tleoiieiytfm2umnmo;u) eermo3iodlp  ln s;t trtm(o3nodomeemicsasf rurumpot0olxnmoetysla2ea( pnt)tlerir iytfmte uvi;( t2xoio oudoltelivtlsfsDtmxmoot4oeenio3iyslm2um(vs u0 etomf oodlpD au ils)t2toxo no4lmeemnesl()sDtmx ooo0teeomfeias aDra(mpnt)trxomf3oa1fa eanei s trtmio3oy4omt  neil(  rurur no0aet  octld sDemn o;u4 eenxr3iodop  li i s)trxo(opoy4omtn fvta(  2urxr ;o0ale mfeiadfmDrlnmsn() eeoircoo1lp r ivs (0 rurxr nu4olt mnvt sfa2uaxr ;t0tet  oeiad a uau snt0trxnir3ootlmDean olt)seuoio oo1aptn ivsas)a2urur ;o4tex iociasfsDeanvsn(4 rtoxr iotomt  ueo;(0setrxopio4ol nmncilsfa2tax pno4apt iieiaslaDumnvp (0 rerirctatfp eanvils)srxo(o3io1lmeelfvsa()sDuaxmpoo1oexnmieiatfsDuluvsnt4texnxfcoa1fm  lu i;s t2urxo iodolenmies s)aruaxrpnt0tlxoiietldfa ea( snt0altnxfctotomDrluvi s) 2uoxm ny4am  mfvtl()arrau  nt0tleomo3iasfaDeluvo u4alxoxf3oodlmt  nvo t teumir nydlleelfci s) 2umum ou1tet io3ias m2rm( pnu)aexrio3iytlp rai i ()srtmimpoudaptnlfctat)aDum( oot1tlenmietysfs2rluvs;u0treoxfctatlmDeanvs;() rxoxmpiodomtemics t sDta(mo;o1aet iicilsfm ranvs (0tetoio iytoa ranvs;s t2umir ou4lltnlfvi s aDra( pnt4oltoioeiyt a2emumo u0arenmociytlmDeln o;s setmim oy4aleelfesl(fs2taxr ;u0aptnif3iatfm uln s;u0 exomo iotlpD lieils0trtoimpny1lpeemicil() rumu ooo0tpx  f3iadlmDranmo u4tltoif io1lpDeln s;(0t2xoxrpiodape mfet ()sDta(ro;u4aexomoctad s ran pnt)artoxf oy1omD luvs t trto(mpio4opeemnci t  2ra( p;t4open feildlm emn sn(4aeerxo3iatlpte iei;()tetm(mpno4lpe  fvsas) Dta(r ou1tltomfeilslaDumnvs t)artrmocoo1oa   uvsl(  2umxmpoo1apenlfvil( arur(  no4apt ifeils aDrmnvon(4tetnxf oadlptraieol()setoxr3oy1al n net (  ruax p;u1altn i3tydlaDrmu ont4aeerircty1fmDelnes;s  2toxr ny4opt mnctls)srrrumo;u0oeeomi3tadfaDranmpn(4trerxrcio1lptelnvo ()sexrxm3iy4aptnlfcsatfsrua(ro;t0oeenmieiysfa2rmu o;t)aeeomfciadfmD ln s;() rtoimpnydop nlfvilt a2rrxmpnt0opxomieiydls rl(vp;t) exnxr oytlp   n ol()teur(r ou4omte iesl(f 2rmu pot1tlen f3ils aDrl( o t4tleoxr3oo1opDeaivi t  2toxr3nydolt mfcil( arta(ro;o0oexniictltfs2umu ont) lermfciydlmDelivils) 2tmxmpiu1open nvi sfaDtau  ;u0tptn feiadfs eln sn(4artrio3totfptr ues (  euoir nu1oleelieslt)a2rmx o;u1olxo oeiadfs2rlumon(4 lenmfciy1fa rau ol()t2tm(m3iydal  mfvsat)s2ua(mont4texo ociys m2rm( o;(4 rxoxf3iadfpDe ues (  rumxr3nu4altnmnvs t)a2ururpot4tpt mfctysla2el(vp t)tlenxfctotlmtr ivo;t0t2to(mpiu4lp e ivi t s2rrxmpno0tpxnmfetydfaDrmumsnu)trtoifcia1fmDe n o s) rxoxr3nu4am  lnvt (faDrmxronu1tptnii3iatfm eau pnu0 lermr oadfmDeliei s) rxrirpny1lpe  icil(faDrmu pnu0tpe  f3ild s2ea( pnt) etomr tydoat lieilt s2xoxm3ny4om emncils a2ra(rono0oexomfctadfm2um(ms u4alxoxo tatfa elieo;t srxrxo3io4opt lfvt s)arumumonu0aexomoeiys aDemn p;u)arenmrctodfp ranes;(0t2uo(m nodop emfctls  rum(  ou0tleoioctlslm ulnvo u)tlxnir iydlptelies;s  etmim3iy4omtnlicsls srumxm ;t0oexn f3ilt m2ul(ms t)alxoiocta1fatrau o;t0srxrxm3oo1lpe lfciatfa2umxmpoo0aet  iciysla uau ont4arxrxo oytoaDe i sl( sruoxrpou1oltn fei s  2rr(mo;u1altnmfeild s2eanvs (4 lxoxocoydomteaneolt0 etoio3iu4amee fct tf rrmxmoou1oltoiieiytlaDul(vont0 rtomr ta1opteai s s) rtoio nudlm  mictl(fsDuau ono4opx mfetyslm2rmnvsnt4 lxoxo3totfateluvi s s2tmxmpnydlpen nciasfsrtr(mp;t1aetoifciatlm em(monu4 exnif oytopt  ies ( srumir3oo4ol nlnvt () Dta(rono1tlx  oetad s um( s (4alerxoctadlmDrau i;s0trxo(m3ny1lp e ietlt aDtmx  ;u0tpxnii3tys s2rau sn(0aexnxr oydoa   i s s) etmxm iu1op nmfvs s)srtaxm nt0apx  oeilsfa2uanms t)aeenmr tydfmte uvilt0sexr(m3ny1olenmietltf 2tru  nu0openmi3tysls2uluvsnu)altnio3totomDrauvs s0 eur(o3ou1lp nmnei t s2uaumo;o0oltnmo3tlt m umnvs;t4alxnmf iodomD lu ols0seur(r3ou1am   fvi tf Dumur ;u1openifeiltls emuvs (4 lxoxf3oodoatraieil() euo(o iudopen nvtl( aDrmxmo;t0ole iictld mDrlnvs;(4areoif tytfatraneolt  rtrim oy4ol emictlsf 2uaur ou4oexniieiadls emuvo (0arerxrctotfateaieslt srxmio iy4omtemnvs t)a2taxm oo4tlt iicias sDea( o (4altrxo3iadfaDr nvi;t  etrxr3ny4lp e nei tfaDrauro;o1oeenioeiytlmDuln p;t)trtrxocio1oaDelivs ()s2tm(o ny4opeelfvt (  rtaur oo0aeeoiociatls2umnvs;u)aexnmo tatopDeluvs;() euoxmpny1lmt lncil() rra(rp;o4altnif3iltfm ranms;u0trtnio tytlatelueo;t0trurir iu1ameelnetlt a2ra(m oo4oltnioetltfs2eau p u0tetoif oydlm ean o;(0 eumxo oydame lfci t  rurxmp;u1tpe mf3tlslmDuauvon()tetoxfciydop   nvilt) euo(m3nydolt lnvi t  Dua( pot1oexo oetlsfsDuau snt4 etnmfctydfp rlieil(0srurxm io1optnlnei sf Dum( oou4tptoiiciytls2rln s;(0trenmf3io1lpt  ivols0srtm(r iu4llenlfcilsf rum(  oo1optoif3tlsfm rlu o u0tlxrio oo1oatraies;t)s2urxopoydlltemneilsf 2tmxm ot1alxo ociadls2rm(vo u0 eeomr3ta1omte uvs s0 rum(r iu4aptnlietlt)sruaxm nt4apenifeiadlaDelnmon()arxrif3iotlm  auvols  exmiopou4op emnvil( artm(moot0aeeomfciaslsDra(vo;u4tleoioctotfpt  ueo;s truoxr3oy4omtemnes sfs2rau  no0olx ifetyd m2ra(mo;u4 rtrmr3iadoa  lu ilt) ruoio3oy1omte net sf 2taur ;t1oexn f3iadlmDuanmonu4 rtoiocoadop  ai ilt  rtrxr iudlptnlneta( arrax  ;u1tee io3ilsfsDum(mpnu4artnir iatfpDeaueils trtmxr3oydop emfei t  Dtr(r nu4opto ieilsfa2el(mp;t)tleoir3iadfatr neslt) 2uo(m ny4lle miet sf Dua(m nt1ole io3iadfs rmn ont)artoxfcoatla  aivil(0 euo(rpiy4lpen ncil(faDrrxmpoo4tleo fcilsfm2ra( pnt)alxrxo3ty1oat  uvs (  2umir3ou4ll elictlsf 2rm(mpnt4aexn o3tasls2um(mp t4 ltomrcoy1lpD  ueilt)setoxrpiu4op  mnes ( a2urumoou1tltnmfeiytlm emumo (0 rtnmr totom rlieils)s2tm(o iudal nmfcilt)a2tr( ont4opx mo3tasfaDuau snt0alxnxo3iytlaD aneils  ruoir3oodopeelnvsatfs2ua( oot1ale  fciad s rmump t) etnir ia1lpt  ivs;t)s2umxm no1lpenmnvsls aDra( p;u1oetn o3iydfa2uln ont0tltrxr tytfaDrlivs;t texoir no4ap nmfct s a2tm(  ot0teeoioctaslaDranvp t) ltnxr3todopDe u o t0teuo(o nu1alen nviatfs2tr(r no1olxn octaslmDuau sn(0trxoxr iytfaD  iesl()t2tm(r iodaleemics sf rumurpnu0opxn feilsls2um(ms (4 exrmf ootlptranei (0teum(mpoy4lptn fcs tfs2tmum nt0ape iieild aDranvpn()teeoir3oadlp eau s s0t2to(m3nydlp n fctl() rumxr ot1aeto f3iyt m2rlums;(0texoio iatfa e u s ( s2um(o iodap nlnvil()srta(m ot0aee  o3iyt aDrmn pnu)teenxoctotfaDeau ils) rtoxopiy4opeelici tfs2um(mont0apx mociytfs ean s;u4 eermr iy1omD ln i;s tetmxm iy1omeemnei s sDtrxrpou4aetoii3ildlm umnms;u)tlenir oydfp  an i;t0setrim oudapee neiat)a2rmu o;t4aptnioeiyslm rln on() ltrmr iotlptran i (0srxmirpny4alteliciasf ruau p;u4oee moetlslsDra( p t)aeenmo3ootlmtraivol( t2urim oy1ll   nvsa(  rtrx ooo1aexoioeiydfs2em( o t) eenmfcoy1latelnvs s)texrir3ou4am   ivta( arur(m ot1alx mo3tat sDuln o;u)treomo3ia1faDran o s) etoimpou4optemnes sfs2rr(mp;o0alt  fciadlm2em(vsnt4aexrxo3ty1lp r iei;t0 rtmio3ny4al nmnei t  rumx ooo0oeen ociytlsDrlums (0teenircoodlmDrliei;s  etrxo iy1lmt  nctlsfsruau o;t0ape mfeiysfm rlnmp;() rtrmocoydfptrau ilt0t2xmxo3oudopt  nvilsfaDua(rp;u1aexnioeilslaDum(vo;t0 lxomf ootomD lnvo s0trxo(opny1lpenmfcsas srtm(mp;o0aet iietytlm umnmp t)aexnif3iadfmDelneo s0s2xr(mpno4ll  lfet (fa2taxmpnu0aptnmieildfaDuau o (4trenmo oytfmt  uvi;()trumio iy1lm  lnvt t  Dur(rp;t4ape ifetasla2ulu onu4tltrmr iytlp r nvol(0 eur(opnydlltemfvtlsf rrm( ooo4opxn feiyd m ulumo;u) leomr3ta1faDrlu il() 2tr(r iy1ale  fes s srra(rpoo1aexo feiytlm2rl( snu0 eeoxrciodom r i sl(  2xm(opnu1altelfes ()aDrr(r ;u0tet  ieilt sDel(vsn()trermo totfp eanvo;t)texrio3ou4opt  ict sfs2urxmooo1alxnmf3ilsfa2ulu snt4arxrxfctodfmDrai slt0 rxo(rpno4lmtnmnet s)arraurpnu4ape  oetat m rlums t4 ltnxr3iodla eanes s)tetrxr3oydlmtemfcslsfs2rrxrpnu1altnifciasfmDrl(vp;t0arxomr io1op eanei s0sexrio3iy4ope  icsls)aDrmum ou1opeo ietls aDuln sn()arerio tytfpt  ivs s0sexr(o iudopt lfei t)artaxm ;u1aeto i3iad a2ua(ms ()alxomo oatfm  ln i (0trtrio3nodomtnmiet s)srumurpou0tex  o3iytls umnmp ()tlxomociodopDean ols0 2trimpoydol nlfetasfarra(r ;u4texnifciadls2ulump t4artniocoadom  ai i;s  2toio3iudlm emfei (  Durxrpnt4teenmoeiatla umnvs t0 lxoxfcio1fmDeluvo s trtm(rpiy1olenlnes s  2taur no4oexo i3tltlm umn snt0texoxf3oydfptelnvo s)srtoio iy4olte fesas srrmx p;o0tetn ictat m rauvs;t4tetomrciatop  anvo;s0 etm(mpiu4ol   fvi s) ruau ont1tlenioeiltfa rm( snt4altomo3iytlp   ies ( srurxmpoodlme lies (fa2raxro;u4alxniietls sDrauvon(4 eeoir to1fm rln o ( srumxr iu4lp nmfei t) 2ur(mo;u1apenioeiat a2rl(vonu4artrmo3tatfmD ln ol(0 rumxmpoy1am   icil(fa2uau  nt1tetnifetys a rauvs u) renmocoo1latrauvi t0sexm(o3nudlm nmivt ( sDra(  nu0oexoifeiytfs ranmsn(0 lxoxo3ty1fmDeau s (  etrxm3iu1omte nvils)sDtax  ;o1tptnifeilt m2rmu o;(4aetnmo3io1fmD  n s (  rxo(m3ny1lmt mfcta( a2trxr ou0olxoioctyt a2uan p (4alerxr iy1opDr n il()t2tmxo3iy1ap  lics t)sDtm(ro;o1oet  ieiad m ra( s;(0arxoxr oadfpDe nes s) exmxr3oy4om nlicils sDrrum nt4alen feiysfaDumu s;u)alxriociydfmDrai i ( sexrxr3ou4olee netlt s2um(m ;o1opxoio3iydls2uau pn(0 etrmociodlmtraneo ( trtmimpiu4aptn ieia( a2ta(r ;o1altoif3ils m2umnmp (0 ltnxo3oo1oaDr iei t srumxr3oydoptn fvsl(faDrrur ;u1olxomieiydfmDuan o (4tetnxociotop e nvs;t  rxr(rpoo4lpee fcs t) 2tm(rpnu4oex ii3iysla rlnmo;t0alenirciadfp eln o t) euoio no1lle mfcias  2ta(rp;t0apenifetltla ea(mo;(4arxrmoctodfp e n o;(0trxoxo3oudamt mnesatfsrta( pou1tptn feias a2uauvsnu4tlxrxrcty1laD  ivols)texoim no4am emncs s)s2tau  oo0tpxo oeiatlmDeauvs t)aetoxrcoodopD ln s;t trtrio3ou1ame mfeiltf 2ur( ont4olen oeiasfm ulnms;t4 rxrmo3oa1faDr ues;s0teurxr3oodap emfcsa(  Dumurpot4oeeomi3ilsfaDumuvp;t4 etomrctydlaDranvo;s setoir ny1llenmfvtat)arrm(ro;u4aeen oetldfa eanms (4 reoif ta1op rluvil() rxoxm io4ole lfvsltf rra(m ou1tlxomfetlsfs rl(mo;t) leoxfciy1optraieo;s0 rumio oodal elfetlt)sDumxroot1alen fcildfm uauvs (0tlxoxf iodopDrluvo;s s2tmio ou1lm emfetlt  2uax p;u1tetn fcilsfm2uanvont4 exrmfcoatfp  lues t)s2xr(opiydop  mfvsl() Dtrxm ;u1apx  f3ilt a elu pn(4teenxr oytoa  lu i s)trumimpnu1oltemnetls)aDtmum ;u1tltn i3tydlm uaumonu)trtnxo3totoptr nesls)sexmirpnu1alt lnesl(  Dumxrpoo1opx moctat aDeanmp;u4tltoxocoo1fmDelues s sexm(m nu4oleelict tf 2umxmpno0tex ifeiltfs2rln o u0 rtnxf ia1lmte u ils  rur(rpiy4alenlieta(faDrmurpno0tlx iietadlaDuan s t4tetnif iydlmt  ues;s texm(mpiy4alenmnct t)aDuaxrpnu4tpxnifetatlaDeauvpnt)altrxo3io1oaDraieo t0 euo(opnudame mfcil(fsrrax  no4ole ii3iysfa2rm(vpnu4 ltnmocoadomtelueo;t sruoim oy4omtelnvsls  rtaxm ;t4tlenmfeiltfa2ra(vs (4teermo todfpteauvs;()srtr(r3iodlpen ivtatfa2rmx pno4alx ioeiat a ua( o;t0alxrmo3totom ranvi (0s2tm(o iy4amtnlivi ()a2trxr oo1aptomoetyd aDulumonu0 rtomo oy1opD  nei;s) 2uoxr3nodomtn fvtls)aDua(m ot4altomi3ilslsDua( on(0trxnmf3oytfaD ai o s sruoir3io4am nlfes sfs2rru  nt4oee mi3tadlm2uanmp u4tlxoio3to1opD auesl(0t2toirpiydlpenlfviasfarrmxrooo1apto f3iatlsDeluvs;u)altrifcoo1lm  auvsls0texmir nu4amt mfviltfs2taxmo;u0oetnii3tydlm2uanvo;() ltoir3io1lm  an o ()s2xr(r oo4amenmicsa(f rtru  ;u0olt mieiadlmDrlnmo;()aeeoxr3ootfp eaieo () rum(o io1ol nmnvils arururono0tpenmoeiatfm2rmuvo;u0 lxrmf3iadfpD ln s;s0trxmxmpio4lmt mictlsfsDtmu  ;o1tlto oeiasfa2ua(mo (0aetrxr oatlptr iesl(  2xo(r3oodlleelnctasf rtrxmpot4oltoioeiltlaDrluvsn(0alxrmf ootfpt aivol(0sexm(mpiodame mfcs (faDraxrp;t4aetnifctlt aDeauvonu0altrxrctytlm  liesls0 exmim iu4al elicils arrr( p;o1tlt mo3iadfmDrlumpnu)trenmfcoytopDeluvols0sexmxm oo4apt miet s s2rmumpnt0oeeoii3tyt sDumnvs;u4tlxrmo io1la eaneo ()texmxr3oo1omeemnet s)aDtrxr nu4tpx  feildlm el(vo ()tleoir3oodopD luvs;t) ruoir3iy4apenmnetltf 2taxmoou0tle iietasfm uaump;t4aeenmo tytopte n ols0srurxrpnydap  lneslt srtrxront1tpe  o3iydfmDrmuvo;t0artomrcto1opt  ies (0teumio oodll nlivsa(  rraxmont0olt iietyd mDua(mpnu0arxoif iy1lptr i i ( srxmirpnudopeemfeiat aDurum no1opxoifctysfaDuanvo;(4tetoxfctadomD  ieol() 2ur(m nu4ll elfvtlt)s2uaxrono1aexn feiaslm2ra(msnu4tlxrmr tatfm rlnvsls0srxmxopoydalenlnet s  rrau poo0tetn f3ilslm2eau o;(0arxrif iodla raueo;t) 2tm(r3oudlmt  icia(fsDrr(rpno0aet  iciyt s2eanvo;t4aetrxf iadomte u s t) etmimpnydolte fvi s)srta(m ;u4oetnmo3ild mDrau onu4altoircoy1fa  li olt0s2urimpiodllenlnvs () rrmuroot1apt ifeiasfa2el( onu)aexnmr tytfpt livs;(0 rto(opoy4openlfciasfartaxr ;u1teenmoetysls rmn pnt)tleomf3to1fmDr n o;s0srumimpno1ap emfvtlt)srrrur ;u1texn ocildlm rmnmp;u)arenxfctydop eaueilt0 exrir io4apeemnesas sruaxm ;u0tpt ioeiyd a emums (0tlxoio ia1fmtraieo;s)texrir iydaptn fetas srrrxrpou0oltoiiciltfm eaums;u0 leoxo iytfpte ieslt)seum(opoudale  ncs sfaDtrurpnu1ape ifetaslmDrau p (0tlerif ty1opD au i t)seurxmpnu4llee iesa() 2ua( oou4oee io3iat a2rauvp;t0 lxniociy1omD luvil(0seur(m no4ap emfvslsfsrrm(rpnu1alen ietadfm2ulnmo t0 rtomo3ootlmtrlnvi;(0seumimpiudlm nlfcsl( aruax p;u4opeomo3tlt a2rm(vs t4tetrif3iydlptr ieol()trtm(m3oudamt licslsf rumur ;u1apeomfeiaslmDulump t0alxomociytlpD  neil(  etmxopiy1ameelnet ( s2uaurpnt0tpen octldla2uauvsnu4 lermo oo1op raiei t  eur(r3iydop emiei sfs2tmu ono4aet ifctydlmDumums;u0areoif io1lmD  i olt setr(mpoy4lpte nviasfaDrrxmont0aexnmoeiat a2ulumpnt4 reoxr oa1op r ueils t2ur(o3oydlpeemnvtlsfs2rrxr oo1apt ii3iasls2emu o;u)aetrifcty1omDeauei;s  2trxr iu1aptnlfetlt)a2um(m ;o0olxniocildfmDrln o t) leomr3iydfmtrli slt0srxo(rpnodlp n icta(  2rrx  ou0olx io3tadfs2emump;t4 rxrif oadfpDeaueols  2to(m oydomenmfes (fsDrmum ot4ale  ociatla rluvs ()tetnio3iy1lpt luei;t0t2uoimpnodolenlfctls a2rmxm nt4aeeo f3ildlm2ulnms ()trxnmrciytoatrai sl(  eumxmpoy1lmeemicsasfsDtr(rp;u4aptn feiltlaDumnmp t0 eenmo3tydopDelu i s)srxr(r nu4aleelictl( srtr(  no1teeo o3ils a umump t0 ltrif3tytlpDran ilt srtoxr3oo4apt mivi ( aDrm( oou0oeenmf3iyd mDranvsnu0 leomo3iydom raieils  eumxmpnydol emivtls) 2raxr ;u0tee mfciytlsDeanms;u4texnircoadfpD lues;()trumir3iu1alee neil(faDumurpoo1alxomo3tlt sDuanvs t4tlermf io1lpte uvs s)srtmxo3io1al elici ( sDum(r ;u0tleo octltls ul( p;()tltnxf3tydopD luvi s)s2trio3nudlm n nci s srumum ;t4aeto feildla ranmsnt) lxnifcoy1fm  au ilt0 rxr(mpno1aptelfctltf 2urxrpoo0aetnmociasfsDuau o t0trxnxr oo1fatrlnei t) etoim nydop  mnviltfaruaum ;o0tetnifctat s eanmo t0tlxnifctydfpD  i ol( t2toxrpnodalt mnvils)a2rmumpnt1tpx  i3iyt mDuan p;u0 etoir todlptr u ilt0 2ur(o nodap  liei t  2rau pnt4apx iieiydfs el(mo t0aleoifcto1fpDe uvi;t teuoim3iudlmte fctl( srrmxm ot1oet  i3tadla2umn o u)arxoifcoydfmtelu il( trtrxr oydll   fciasf Durx  ou4tptnmf3iysfs rl(vo;u4artnmocoydfp e iei;s0s2tmir3no4opt  iciatf rum(roou1apx mfeiatfaDran pn()artnmocoatoate nvi;()sruoio3oydlp emneilt) Durxm ot4apt  i3iyt a2ranvp;(4 exnio iydop e ieol(0trxoxm3oo1oleelfes t  rta(r ;t4aex mf3tat sDelumont) rxrxocio1om eln s;( sexm(o iy1amee ietl() 2rmxroou4olenmfcias mDea( p () lxrxfcoytop eln ol(0 ruo(rpoy1open iesa(farrax p;t4tlxoifciatlm2rlumpnu0arxomr io1oate uei;s0trum(r3oo1lltnmnviltfs2rrxr nt1aeenmoeiytlaDuaumo (0areoxo3totlmD  i ols srurimpny4lp emnvtl(f 2uaxmo;u4tee io3ildls elnms;t0tlxnxr3totoateluvs;t tetmxm iudaptemnvsatfa2rm( o;u1ale ioctatfa ua( s;t)teeoif3oa1fatranvslt) rum(mpoo1altn iviat s2uaumpnu0olt mi3tltfs rl(vp ()arenmfcoodfa raivi;s0tetm(opoudaltn net tfa2tr(r nu1teen feilt mDel(msnu4trxoircoytfaD lues;()s2umir3oy1amtelics t)srrax  ou0opeo o3iat s ua(mon() lermocoo1fm raueo;t teuoio iu1ll nmfeilt) rrmu pnu1oexomo3iadlm em(msn(0aexnxocoatlaDelivil() euriopou1lp e nesat)s2ta(m ot1tlx micildfa rln o;u)trxnif iodoaD aneol(0 2xo(m iudlptnlncta( srtr( o;u4apx ioeiaslaDeaump;t0trxnio ia1la eau ils0 2tr(rpiudamenlfvtas)a2tmxm no4open ociatfa2elnvpn(4areomociodlpt  u o s s2xo(r3ou4am  mieslt)s2rmu pno4tetomfetydls uluvpnu) lxrmo oodoat an sl(  rtrio iu4op   iesat)aDurump;t1tpxnmieiadlmDum(ms u)trtnmocoa1latrln sls t2xoxmpno1om  lfvias) 2ta( o;u1oltnmoctlt m eanvon(4 etnif3oa1omDeli i s  etmir3iy4oltn fvia( sDtrx ont0tlx ioetat m2ul(mo t)tetoxo io1lm  lueo s  rumir nudop n iet tf 2umxm ;o1olenif3iasla2elu pnu) etnmf iotfpDrlivs;(0 eumim3nudll emicil(fsDtm(rooo0oex io3iys mDrmu s t) leoio3iytoat auei s0t2trxm oudaltemfvs ( s2raxrpnt0tltnmfetytfaDem(vp (0 etoxr iodoatraivolt0 2umio3oodlptemfvsls a2rrxrp;o4tpeo oeiltls rm( p u0aeerxociotlm  li ol( seurim iudaltn feslt sruaurp;o4tlen fctatfs2el(ms;t)tetoif io1omt au il(  rtr(r3no4lm n ivs sf rta(m ou0apeo ieiadlmDua( p;t0tltoif3oy1op  lieo ()trxo(o3iu1lpt  feil(fsDur(ront4tpto feiasfaDem(vs;u4 rtrmr oatom  au o t) 2uo(r iy4ome  nvt s)sDua(ro;u0oex ifciltla rau ont)aexniociydfp e u o s  rxm(r iy1ale lnet t)sDtrx o;t1aexn iciytlsDrau onu)artoxoctodlp  lueo t  rurio ou4oltn ncs t s2urx pnu0aexoifciytlaDranvsn(4 reoircootla   ies () rur(m iu1ap emfci sf rua(monu4apxoifeils aDelump;(0arxrmociydfptr uvolt)trurio nu4am nlnciat a2rm(  ;o4tleoifciltlaDemu p (4trtrxf to1fpt aivi s s2urirpnydope  nes t)srrmxm nt4tpto fctlslaDeau s;(4aexnio3totfat  n i (  eurim oy4lm n ics sfa2umx pno4ale  o3ils sDumumo;t)areoxf ty1optranes;t s2xoir3oy1lpteliet (fsrua(  ou1oexnmfetyslaDemums;u) ltnif iodom  aueol()t2umxr3iydamtelnvt s a2rmumpoo0tltoiictldfm2ranvs u)altrxr oodop  aies t texmxo nudomtnmiei sf 2umxmonu4oexnmictldlaDulnmont0 reoxrctatfmD lieo;t seumim3iy1lle  fct (fa2tr(  ;t0tle iocilt aDemu pn(0tlenirciotfa raueo s)texm(r iydlpe liesltf ruaxr ;t4apen ieiatlsDuan snt)tetoxf oo1fat anei t  eum(rpoydal nmietasf rtm( p;o0oeenioctltfsDrmnmp u4tltrxf tatfp rai o;t0truoimpiodam e fcsa( srurumo;t0aeeo ietltfs el( o;()tlxnmf3io1fm elieo (0srtm(o3iudopen fct t a2tr(  ou4oexn fcias s rlums u0tlxriocta1lp  au i t  2uoir oydlltnlnviat artru onu4oexo feils m2um(mp;(4aleoircty1fptrlnvi s)t2toxrpoudaptnmnesat srra(  ;u0opeo ociyt mDraumsnu)trxrircoatlmD an i;s s2toim3iy1aptelfvia(f 2umxm ;o4oetoif3iat s2rauvpnu4aexnio ty1lmD lueolt0 rxm(r nodlle mivil(fsDtrxmpno1tetnio3tls a emuvp;t0alxrio totopDr uvs ( setr(rpou1om emnesasfsrtmu ont4opxomieiydlaDea(vo u) ltnxf oo1lmDe nvi;(  2to(r iu4al n neia(farumxro;o4tpeoiictas mDuanvpnu0trxrif3iy1op eau s;s0 2tr(rpiu1ol  lfcs t artm(roou0opxo oeils mDeau sn(0aexrxr3iy1fmDeluvils0s2tmim3no4lmtnmfvta(fsruaxr oo0tltnmieild a2umuvs;t0 rxnmo oadoptelnvo;(0s2tr(rpiodam emnviatf Drr( o;u0oexnmoeiyt s2emnmp t)artoir oy1lptelieolt) rum(m nydop e ncilt)arra( pou1texoio3tltfsDeanvon(4teermo oy1opteln s;s t2tm(m ou4altelietls)s2umx o;o4alxo oetyslsDeluvo u4alxnioctytoat  u sl(0t2toirpoy1lmenmnei (fa2rrx  ;o1aleo icildfm2umu pn() ltnmfcoodfm  auvs s)s2xo(rpiodap nlictat) rua(r nu4apeniieiadlsDrmn o;u)alermr oa1lmD lu il()trumxr oo1lmt miesas)s2tr(m ;u0apx mf3iydlm2uaumsnu4aexoxr3to1opt lu i;t)sexr(r3iy1lmeelieil(f Dtmxmpou4tleo i3tls m2rlu p;(4texoxf3tydfaDeanvo s)trtrirpnydoltnmneias) rrr(r ;o0apxnmfciltla2umump t)tlxnio3iytoa rlivi;s texrir ny1ome  neiat)srumum ou1oexn o3tyslm2uaumo;t0tltoxr3ootoatr nvsl(0trurxr iydape mfeil(fa2taxro;t0apxnmfetldfa ulumo t4teenmf3ty1lateaueslt0t2tm(r iudole lietasfartmu  ;t1tpe ii3tas aDraumpnu0 lermrctadfpDrlnvs;t)trum(m iu1al  lfvilsfsDrmxr ou1apen i3ils aDea( p;t)areomrciydoat  u o s0t2umxo ny4om e net sf Dtrx ono1tetomieils a2uanmsn(4 lxnmf todoptr ues t trxmimpny4al elfes sfa2uau  ou1tpxnmoeiysfaDua( snu)teenmo3oydop eli sls)trxoio iu1apt mnvil( a2rr(  ;u0oee mocild m2rlnmpnu4trxnxf3ootoaD ln s;(0teurxmpio1lleelictltfsrrmumont1altnio3tlsfsDea(vo;u4arxoxr3oytoptraieo t0s2xoim3iydlm  mncia(farrr( onu4opx  iciatfs rauvo;u4teermo3to1la r n ol() 2xoxm nydal nlncsa()srrm(mo;o4altniiciltla el(msn(4altoir ia1omDraieo;s t2tm(o ou4optnlnvtl()aDurum ;o0tlenmietyd m2rl( p t0 exnmo oydoa  auvi ()srxo(o nodapee fesat)aDrrurpnt0aptomo3iatfs2rlnvp u0aeeomr3ty1lp e i ol( trtr(r oy1olt  icilt aDrr(r ;u1teen ieiydfm2um(mpn(0texoxfciodlmt aneslt)s2uoxrpiu1altn nvias  2rmur oo4alx  ietldlm2ua(vsn()ale
\ No newline at end of file
@@ -0,0 +1 @@
+i o;t0s2uo(r oy4al  mivta() 2tr(ro;o4aeeo i3ilt a2umn s;(4tlxrio3tatfa e u ols trxm(opoodlle mietlsfaDum( pnu4tptnmi3iltla2um(mo u0tetrxf3oodom  livo;() rxrxm3iu1al  mnes s)artmumont0tptnmo3ild sDrlu p () renif3oydfm rln s s)t2xr(rpiu4apenmfetltf Dua(rpnt1alxo ictlt s elnvp;u0trxnirctodfmt lueils  ruoio nu4omeemics (fsDtax o;o4apxnif3iadls2ran sn(4alxoir iotlaDe ivo;s trxo(m oo1lpt mies (  2tax o;t4alx miciad a rln pnt4trtnmf3ia1oaDeauei t  rur(r3iy4lltemiei ()srrr(rp;o1texnioctadfmDel(vs ()texoif3iytoateanvs;t trumxo nydomeemiesat  2rm(m ;u4aeeomiciyslaDran o;u0trtomocoydfp eauvi;s)teuoxr oy4ol emivsls)s2trx ont4altnmociyd a2ea( o;t4 ltnmrcoatfaDeli i;( s2uoirpio1lpenliesat arrrur ou0alenif3iydlmDua(vpnu)aetomr iodfmDrai slt  rxo(o3iu4lltelneilt srtr( ont4tpx  octlsfs2rau snt0areoir iadomDrai o (  exmxo3io1amenliesls  rumumooo0tpe  ociad m emuvo;u4treoxfciytlp e i s;s  2toxopoodom   ivtat)a2trxm ;o1tpto feiatls rmuvonu0alerir ia1fp rlieo ()srtmxopiu4ale liviat sDrmurp;o4tlx mi3tatlm uanvpnt0tlxoxocoo1om eln o;(0trtmxo3iu1ole  fvtlsfarrmxr ;u1oexoif3ilslm2elumonu4aeeoir oydfm  luvsls  etmio3iy4aptnlnesatfs2urxr no4oet moeiytlm ul( ont) rermrcoy1om  ln i;s)trxr(r3iydlmt  feia()s2umxrpnt1tpeo ociad a2ranmpnt0aexrxociodlm   n o;t  2tmimpou4op  lnvi s aDtmum no1apxnif3tasfm rmn p;u)artnxrcoatfa  aivo t  2ur(o iu1om e fet () Duaur ot4opto fctytls2el(mp u0 leomo totlp   i o;( texmxopny1lmtnmictas sruax onu4apenmo3ilsfs2rmums;u)tlxomo3totomtran s;t0 rxmir ou1am n nesl()aDurumonu1tee  f3iatlaDrl(vs t4 rxnif iodopD luei;t)teumio iudapenlnvsas)arumu o;o4alx mf3iytfs rl( s;t)tltoxo oy1oa eauvi t  exoio3oudap n nvilt arraxr ot0tptnii3iyslsDemnmp;t0tltrirctotoptelnvo;(0t2toxm3iy1ame  feslt) rtrurpou1opt ifetatls eaump;()trxnmr iatfat ln i;( teumir3nu1ap  micia()aDrm(m ot1aetnifeilt mDrln s;(4 reomfciydlpt luvo;()t2xo(r3no1omtnlfciatfs2uau  nt4tpenmf3ils sDuan o (4tlxrio totfmt lueols)setmio3no4oltelfvtl() rtm(m ot4tpen f3tltfmDua(mo t0areoiociotlmt  i s;()srur(r3iu4ol emnct tfsDrru pou0aexnmfetydla ua(mp;u0 exnmrcoo1omteau i;t0trtm(opou1amenmicta( srrru  oo4aleoio3tat s2ra(ms;u0tetrir oa1oaD  ues s)truoxrpio1op   icsat)aDuax pno1apx  f3ilslsDemnvp;t4arermr3oy1oaD au o () euoimpiy1ol  mnvslsfa2ra(mpno4optn ietyt mDea(mpnt0trtrmo ia1fp e ies t)tetmxmpno1optemncs (f 2tm(mono4texniiciltfs um(vp t4 ltnmfctadfa eaivs;s s2uo(m iy4lmtnlnctl( sDra(ro;o1oltn f3tatfm2rmnmpn(4trtnxo3iatlpte ueols trxrxrpoo4ll  lfesat  2tmur ou4ole iieias s2emumsnt4 lxrxf3ia1fatrauvo ( trtoxr3ny1apte nei sf rtax ono1teto oetld a2rmn p (4aetrmr3iatfm  anesls0srtoimpny4opeelfcsls) 2taumooo1oeto iciysls eln s t) leoif3ty1opDean s t) eumxr iydolenmnciltfs2tmu p;o4aptn o3iydfm2rm(vs;t0tlxoxr oatoaDrai i t0 2xoir ou4omt livta(f Dtrx pno1ole  feiltlaDuauvs (0 etomrcoadom  li i s  rtm(m3nudllen nei ( a2ra(roou1aptnmieiatfs2em( o;u4treoxf ta1fm r u ilt  rurim3ou1apt lfet t)s2trx o;t1tlx  ociys m2rl( s;(4trxniocty1laD lnei;s srtm(opoy4apte fct s) rtm( oot1tpt  ociasla2um( snt4tlxrifcoatoa   uvslt trtoxm oy4om emiesa(farrr(m oo0altomiciat mDulu on(0aeerxfcoydoaDe n o s)trum(o iodom emnci s) rrm(mono4tpen feiysfsDrmump t) etnir tytla  ai sl()trtmxmpoydoltemnvslsfsDur( pnu1opto ociydla2ua( p t0alxnmrciatfa  lnvs;()trxoim3no1apenmnvi ()srur( oou0ope mfeils a emuvs;t4aeenir3iadfa r nvi;s setoio3iu1aleelfetltfs2um(moou4alxo ieiys a2eanms;u0arxrir3ia1la  luvilt0 rtrxmpnu4apenlnvi s)s2taum ;t4aetnif3ildfmDrauvpnt4 eermo io1fpD ai s;()texoxr3oodop elfesls s2um(ront4aeeo i3ilsla eluvp u0aeenmfcto1fptranei s)s2uoxrpiu4lme mieia()aDtr(r ot4aleomfeiatlaDrln ont4tlermfciy1faDr ieils) rumir iudomt  fcsa()aDur( p;t0aleoif3iasls rau s;u4aleoifcoydlaD  nvs t) 2xrxr3ou4om e ncsa()artaxmpot4oetomfcildfsDranmsnu)artoir tatlm e u i s teum(opoydol e nes sfaDurxmooo1olto ociydfs2ea(mpnt4trtnifcta1la elivol( sruoxrpiu4ol n nctltf Drr(ro;o1alt  f3ilsfs emu s;(4altnmr3oytlaDr ivi;() rtriopoodlle mfeil() 2rr(roou4oltn f3iydlm ulu s t4 eeriocootfm  auesls)tetoim3ou4oltemiei ( sDraxmo;o1texoiocilt aDelnvpnt4teerxfciotlmDelieol()s2xo(r oo1lptnmfcta(  2um(rooo4oet  f3tydlm ulnvs;u4 lxrir oydfa e uvo t0t2uoirpoo1ap emnct t)a2umump;o1oltn i3iasfs2eanmo;u)tetoxo3iatlaD lnesls) 2trxrpou1aptnmfeta(f 2trurpou1oeeoiieiaslmDrluvp u) etrir3oodfat aivs t)srxm(m3iydoltnmfvi s) rrm(r no4tetn ieiltlmDeanvs (4trtnxo oodlm  luvi;(0sexr(mpnodol  lnciasfsDumx ooo0tpx  f3iyt m um(ms u)texomo3iatfaD ai s;( trumim3nu4lltelieils)srtaurp;t0oetnifeiys a rl(vont0 lxoiocoydlp ranvils) rtmxm3iydlp  livsas aDrrx  nu0olenmfeiad sDeauvsn(0 rxrxocoa1fm  ln olt  eum(r3iy1ope  fvi (faDtrx onu1tlx ioctytfs rmu p (0trtomo3totla e uvol(0 rtrxm ny4oleeliei ()a2rrx o;o4aptomoeiytfa elu pnu0teenirciotopDe nes s0t2xm(rpno1ape lfctas s2rr(m ;u4olxniicilt s2ra(mon(0tlxrir oatfmt aivo s0seumxr3oo1apenlnvias)srumumpno4oetnio3iyt s2eanmo (0 rermr3ootfat  u il(0srxriopio4ale  fesl(fs2rr(r ;t0tlto i3ildla2umnmsn()trtnmf3iydlpDrlneils0s2xm(mpoo4lmtemnetasfsrrau ooo0olenifeiltls2em( o;(4trerxf3iatfmtean ilt srtrimpio1alenlfeils aDtmxrpou4tptniociadla elnmsn() exnmf ta1lp  an o;(0 exmio3ny4apt  ivslsfs2rm(  nu4oltn i3tytls2elu s u)trtrio io1fa rli i;s)s2uoiopiy1omeelfet s)a2tm(rpou1aeenif3tatlmDum(vp u)tetomf totoa raieol( t2uo(rpoydop n fvt sfs2rm(mp;o0aexn oeiytlm ul( on(4altnifctadomDr n o (  etoxrpny1altelietlt)artr(r nu1aleomociad sDean pnt0teerxf3oodfaDrln i;s)seuoxopnu4alen fes sfsrra( pot4opeo oeilsfs rlu sn(4tetnif3totlmDeln ilt seur(o3ou1opte ieia(  Dur(mpot0tlxnmf3iytfs ulnms;u0trenxo tatfptraies t0 rxr(o3oo4oltemfvsat) 2ur(rpot4tpeoifeiatfa eluvs;(4 ltnir3tatom eluvolt  2uoir oydll emfcsas a2tmxront0altnmfeiltfa rlnvsnt0trtoxr oy1lp eauei;s)s2tr(r3ny1open ieta(  rraurp;o1tlt mfeiadfsDrl(vont4tetoir ia1lp eai i ()trxoio nudlmtnlncsl(  2trumoot4apx moeils m rauvont0trenxr oodfp r ieo (0seur(m oo1lle lfeils)a2uaur oo0tpto feiydla2ua( o;u)tltrmf3io1fp r ieo;s)t2uoiopnu1amtn fet s)aruaumpoo0aptniiciat s uanvp;t0 rtomr3io1fa   neols trtmxm oy1omt  nesasfs2tm(mpot4apeomi3tydfsDul(mp;(0aetoiociydlpt aivi t0sexr(o3ny4op n nviasfs2trur nt0tleo i3tldlm2umn s (0tlermo3iadfateai o t0trtm(r3nu4al emncs sf Dtm(  ;t1olx mfciaslaDeauvsnt)artomfcoadfateau sls0s2tm(opiu1apt mfct tf rtmx ont1texnmiciatlaDelumo t)tetnxf iytop rli sls0setoiopoodolen fcia( srrru  no1opx ifetlt s2uanmo u0tlxnxo3tadfm e i il( sexrxo nu4lmenlfes t)a2rmxmp;u4tlt iicildfa2eau ont) exrmr to1opt lies s0trtoirpiy4opt  icslt srrmxr ;u4aexo f3tas a2elumsnt0trtoxr3ootfpDr n s s  rumxm oy4ll  mfvsls) ruaxmont0tetnmoetltfmDumuvo;t4 ltomf ty1fpDe i i s)seto(r iudlmen fet ( srua( o;t1tpx  i3ilsla ra(vp u)texoir3to1om elnvil( tetoxopoy4ll  lnesasfa2tr(m oo1apt  ietadfaDra(ms;t0tlerxf todfp r n il() eurio3nodalenmnesa() Dum( p;t4opto oeiat m rl(mo;t0 ltomocoadlaDe nei (0 rtr(m nodomte ncsl( sDuau oot1aetn o3ildfm rlu p t4arxomr3tydopteln ol() 2tr(m oodlm   nctlsfs2umx  oo4opxoifciydfaDumnvs;t) leoxrciy1faDeaieo ()t2urxopno4ol  liviat  ruaum ou0apto oeiys mDul( onu)aleoxfciotfpDelivo () euoxr3oydlltnlnvils) Dumur ou4tlxniiciad a uln pn(0arxrmrcoo1fpDeau il()t2xoxrpnydopenlnes s) Dra(  ;t0teeoioetls m ulu pnu4tetoiocia1oaDeli i;t0tetm(o oo1lpee nvt (  ruaxm nt4opxn ieiyslm2umnmont) eenmr tatfpDeaies t s2xoim3nu1altn fctl(  2umx  nu1tee mf3iltfm el( s;(0 etomr ty1laDeauvi s0 rxr(m nudom   fvtlt)a2urx pnt1tleomfciys m ea(msnt)arxrxfciy1omt aueo (0 2xmxo3nydllee ivilt srtaxronu1tlt iiciytla2rlu onu4 rtomr oa1fpt  i i t s2xoxr nodllenmici (  Drau pou0apxo o3ias aDua(von(4artomfcto1omt  uvs s srtoio3iu4ol nlictls)s2rax  ;o1aetnmieiyslmDelnmsn() renir3oa1fatrli il(  2urxm3oy1omtnlnvsl( artr(m nu0alx mieiatfa2uauvs u4tleoxf oodlatr nvs s trumim io4ol  mfesls a2rru  ou1oex if3iysfmDrm(mo;(0arxnmf3oatlm  au i s trxm(o3iu1lmtn neia()aDum( ooo4tlx  i3iltfm el(ms;t4teerxo tytom elneo (0 eum(m nu4opt lfvtltfaDtr(m no0apto oeildfaDemuvs;u)tltnxo tatla  au s s0texrimpoo4lpt mfvtl(  Dta(  ;o0aptnifetltfm eanvo;u)alxrmocia1oat ln olt0 etrir nu4oleemici t srra(  ;u1tltoifctadlaDul(mpn() etnmr iytfpDrlivi;(0srtrio3no1am  mfct tfa2uaxr nt1tpxoio3tydfmDumuvs u0tlxrxr3ootomtr uvs s  rxoirpoo4lltn net sfartmurpou1olenif3iltfmDua(mp;t4tltrio iytoa  livo ( srtoxm io1omtelnesls s2tmxmonu0alt iieiat m2ranvsnu4areoifctotopD auvi s) 2tm(o3oodlm nlnvi s)sDtaum ou0tlenmf3ildfsDeanmpn()aetomo iotfmDeluvolt)s2uoxrpnydlpen fesat  rrmu  nt0tpxomiciasla ea(msnu4alenxfctadlaDe n o;( srxoim3oo4openlfvtatf rtaxr nu0oleomfeiysfs ea(mo;u0 lenir oy1fmDe nvo t)t2xm(o3io1lltn fcias  2rm(m ;t0alxoiiciatfm2uauvs t)arxrxo3ta1fp rlieolt s2xrio3no4ap nlfeiat aDrmurpou0aexnii3tat aDul(msnu4texrxf3todfa  aivslt sruoxm3iy1ope  ictatfa2umxr ot4apto i3iadlmDrln s;(0artnir3ia1lat ln ol(0 exr(r oodame mivslt)sDraxm ;t1apto i3iaslm2rlnms;u) rxomr3iatomD  ivs s0s2trir nu4lme miei s aDur(  ;u0apt io3iysfmDea(vp;(0 ltomo iytfpteai s;t) rxr(m3no1llt mncils)arraum ;o1olenii3iad mDua(mo;(4tetrmr3tydlmDeaivolt s2trio3nu4ap elneiasfsDumu ono4tlt mietyt a2uauvp;t0teeoxf3iodfp r nvs t s2umirpny1apeemics t)aDra(moot1olen ietys a2elnvo ()artrxf3tytfmt  i s t  rxrxm iy4lltn nci (fs2raur nu1optn fciyt aDuan o t0alerxf3oatopteluvs;()s2um(o3ou1ome  ncsltfs2ta(r ot0apeoioeilt sDrmn p;()aetoir3ootfmt  uvs;t s2um(o3ny4al e fesls  2taurpnt4teenmoeiat sDuau pnu)trenxrcoatop eauei (0srtrim ny4llenmnvi (f 2uru pou0tlxn f3tydlsDrlumpnu4arenmf3oy1fpt  n i;t0trxm(mpoodlmt  fvsl( srta(mooo4aetnmocias a2rmu o u4 lxrir3oy1oateanes;t sexm(o3nu1op nmietlsf rrmxm ;o0oexomieiydls umu s;t0 rtoxo to1lm   uvi;t trxoxm ou1am elnvs ( sDta(m oo1ole iociysla umu o;t4 ltniocoodlm r uvs;t)trum(o no4ap elnci ()a2uaxrp;o4tlx  fctasfmDeluvont)trtnmr3tatfmt luvils)seuoiopnu1openlnci sfaDrrxro;o0oleoio3tld s2el( o;() rtnxo3to1op rli i (  eumir3iy1altnliet () Dur(mpno4tlxn ietydfs ra(vont0 lxoxrciytopteaivsls trtrxo oo4lpeelfet s s2ra(rpoo0tee ioetydlm2eaump t4tlenmfcto1opD ai s;s sexmxm3nudlpe mfesat)sDrax p;u1tptniociadls ea(mo u4 rxomf3iy1oaD  nvs s)t2tm(m3oudopen fcilt  Dumxr ou0oetomietys a2uln pn(0aeeoxfciatfm   neo;s trto(o oudll emnvsltfa2taxmono1tetoif3iyt m2rl(ms;t) exoxf3ta1lp eai i t)setoio iydap  mnctlt  Duaxm ;u0tpxoioeiadlsDemuvpnu4 etrir iotfat li s;t)sruoio3iodll nlnvsa(f 2tax pou1oeen fetyslm2eluvp t)trenxr ia1fmt luei;(0srtmio3oy4lpen iei sfs2tru oou4tlto ieildfsDulnvo;(4 ltnmf ty1la  lieil( t2toir no1oltn ivias) rtru  ;u4tltn fciad sDem(vsnt0 lxnxr3iydfa  aieils0s2urxm oudam n nvil()a2rr(r ;o1aee moeiyd aDemumonu4teenifcoadlaDe i i;( srxoir3iodap n ict ( srtm(mooo0aexo ociatfm2rm(mpnt4aeerxr iy1fa e uvs s0tetrio iu1lmeelnctlsf 2rmu onu1tleomo3tlt aDel(vont) rermo iy1late i o (0 exrxm3nodoptnlfvtls srrmur ;u4oexniietas sDrm(vpnt4trtoxr oatfp  lnvs;s0 2tr(r oo4op   fvia( s2um(mont4apxnmieiysfaDra(mpnu4alermr iytopt liei t texoxr no1al n fcsatf rua( ooo4tee mocils m rlu o u)areoif3oatopDr neilt0teuo(r3no4altnmfeils) rumum ;t1aexo fctatlsDrl(vpnu)trermociodoatr iei () 2tr(r nu1aleemfci () rumxmp;o1oet mfciytls rm(vo u)tlxrmr3oo1oa e nvilt  2trxr ny1op nmfcs ( artaur oo1aeeomoetysla2el( on()aexrxfcoy1laDe neol(0sexr(r oudlptelneils) Dtr(r oo4tee  fciadfsDrluvpn() rerxocoatoateliesl(  2trxr3oodome livi t) Draum ou0tlen f3tlsls eau s;t4 ltrirciatfaD livil(0seuo(m3iu4ll emnesa( aDuru oou0aexoifeiyslm rlump (0aeenmfcio1la e ieo;s0 ruo(mpny4al nmfvi s  2rm(rpnt1tpeoioeiyslaDumuvs;t0tetoiociatop ran o;()teuoxo iy1llt micsltf 2urxm ;t4aptnmfeiyt sDraums;t0altoxr3oodlm raivo;t0t2umxo3oudap  mict (faDrrxr ;o4oet mo3tldfa rm(ms;u)teeoif3ia1omtrliei;s teum(r oy1ap  mfcs (  2ra(  oo4tpenmietaslaDrm(ms;u)aleomr3tydlp  au o (0t2tr(m3ou4amtemfci s) Drrx  ;u0oetoiiciydfa uluvp;u) rxnxoctytoaD livols0t2tm(mpiodllt  fet ( a2trxr ou4tpen f3tadlmDrmn p;t4tltoirciotfptelu s s  exmxr ny4omeelfetl( srurxmpoo4tlxo oeiysfaDemn s;t) lxnmrcoodlp e nes;t)t2tr(rpiy4ll nmfct t  Drrumpno1aeeomfeiydla2rmnvp;t) exoifciatfpDrauvsls0tetr(m3iu1ol nmiei s artru o;t1opxn o3ildlm2emnvs t0texnmf oa1lat  ivo;t) 2trir iu1am e iei ()sDtruroot0apen i3tytfm2ra(von(0tlerxrcio1om raues s)trxm(r3ou4alt  ics t)sDrmxrpnu4ope mo3iys aDea( sn(0aexnir3tadfmt  iei () rtm(r iu4ol  mnet t)srurx o;o1oltnmieiltla2emnms;u)teeoio ty1om elivo;t) 2xm(r3oo4ll nlfvsat)sDrmxm no0tlto iciys m ulnmsnt0aeermf3ty1latelueo;s t2umxo3nodaptnlici ()aDtr(ront0apxo ieiltfm ulnmo;()tltrmf totfa   uei s0 2urxmpnu1ameemnesl(fsDrau pnt1tetomo3iydfs elnvpnu)alxoxo tydoa  lnvils) eumxm3oy1om elfcs tf rrax pot0opeomfetltfa uauvp;u4tetrir oa1lm  li sls0srumxrpoo1olenmnvtat srtrxmooo0tptnmf3ilsfa2umuvs u0alerxoctydlaDrluvo;(0t2xm(m ou4alenmfcs t  2rru oou0openiietydfmDua(mo;t4arermrcoatfa eluvil(0trtr(r3iodamt mivi ( a2ur(r oo4aeenif3iat a2rlumsnu4 ltomrcootopt auvi ()s2uoxm oudllte nvtls)srtmurp;u0teeomo3iat m rlnms;()tltoio3ty1fp rau il(  rurxr3io1apt mnvs (faDuaxrpnu4tet  oeildlsDumnms (4artnxociadopt  u s t)s2um(rpoudll e nvt s sDraum nu4tptoifciaslm2emuvs t) rxoio3todopt auei s) 2xrimpiydaptelieta()s2tmxmo;u4apenmf3tlsfm2ranms (0aetnirctadom e u sls0sexm(m3oudopeemieta(fs2tmur nu0aptnio3iltfm emnvp t)tetnif3oytlm eanes;s0 rtr(r oy1openlicsls  Drrx o;u0aet mfcilsfmDelu o;u4tlxnxo3to1laDe iei t seum(mpny1om  mivt t)a2rmxm ou4ale  ociasfs2uln snt4tetnir3oa1opDelu s ( teuoirpnu4olt  fesl(f Drrxrpoo1oetnmf3tldlsDum(vo (4aeeomoctadoaDeauei;(0srxrim3ou1ll e nvtas  2uaur oo1opeomi3iys a2rl(vs u4 reoxr ty1laDe iei s) rur(rpnudlp nmics ()srtaxr ot1aet  ociysfm2ul( s t0alerif3tydfatr n i t0srumxmpiu1openmnct t)srurumpoo4tptn fctys s rlumo;t0areoxrcoytomte uvsls trxmir3oy1ll  lfeiasfa2rmxrpnu0tetoio3tltla el( on()trenif oo1fm rauvo t) eurim nudomte netl(f Dra(  ot0oleo ocils s um( onu4aexrmo3iodfat  n o s) ruo(r iydll nlivsltfsDurur nt1optoioeiadfsDrlu o u)treomf3iatopDe nes;t0 exmio nydal elfct t)srumxrpnu4tetnif3iyd m2ranmont) lxrio3io1lm eluvs;(0t2urxr3iy4omtnlict (farrau pno1opeoiieiyt s ran ont0trtrmr oodlp raneo;( trtrxr iydoptnmfvil(farum(r nu0oetnmi3iys mDrlnmo t4 exrifciotopDrlues s)srxriopiodllt  ieils  Dtmxr no4texoii3tltfs rau s;u)tetnio3oy1lpteau o s0 etoxo3nudllt mnet tfsrum(r ;o1aet io3iys mDua( ont) lermf3oadfatrluei;t)teuoim3no4om  lfcias s2ua(m ot0texnif3taslm2ulu s (4aetoxr ta1lmD lu ol(  exmxm3oo1lmeemfeia()aDua(  nu4tet ifctlsla uaumsnu4artrir3io1lmtrauvi;t) rtoim oydam n fvt t  rur(  ;t4tlt ii3iltla2umnmo t4 lerxr tydla  luvsls  rtoxr no4om  liet t)srtmxm ot1ope  f3ilsfs uluvo t0texnmrcoytlm r uvo ()seuo(o3iodapenlfvt tfa2uru pnu1tleomfciydfmDulums u) rxnxfcta1op e n sls)texm(rpiudlpen ietlsfsDtmu pnt1aetnmfeiat a2uluvo;() lxrxf3tatomDr uei;s0 rtoxm nydlmtn ivi t)aDrmu pou4texn fetatfa2ra(vp t4aetrif iytfat ai i (0tetrxopiudaltelfvia(fsDum(ront0oee mo3tys s2ranvo;t0aetnio ia1omDr nvols)srurxo3nodap e fesls)s2rrump;t0olenmo3tltlmDeln snu0 exrir iotfmDeai i;s0srtr(o3nydomtnmnvsas  2taurpou4tlx mieildlaDea( o;u4 ltrmf oydlm e uvs;(0srtr(m3iodol emfei t  Drru  nt0ole  i3iydfsDel(ms ()aeeomo3iotlaDeluvs (0tetmxr3no4lltnmivias  rrmurp;o4tex if3iadlm2ean p;t)arxrxrcoodomD luesls  rxrio nodapenlfvtl() 2rmxmpno1tlx  oeiydfa2elnvo u) rtomf to1om elivi;(0setr(o3nu1amenlfcil()srrax ont1aee iicilsla umnms;t4 exnio oadomtrai i;t0sruoim ny4lm   fesl(  rtaxm nt0oeeomoetltls umnvonu0arxrmrciodopDe ueolt) 2ur(rpny1apte iet tf 2ra(r nt4tlenif3iadlm2um(vs;t4 reomf3totfp  an o s  2urir3ny1llt  netls)a2rmu ooo4tlxn f3ild s eanvo (0trenxr3iytoatr i sls) etr(mpoudopenlfcsls  rra(ro;o0tlx ioeildlm emnvpnu0tltrxo ootoat au o s  exr(o oydame mieilt  rurum ;u0aee ifcilsfs2emuvo t)teenxr3oodom  livi (0setoimpnudoptnlnei (farumxmo;t4aleo fcildlm2em(msn(4trxoxr iytom  lues;t)srtr(o iu1lmtnmivsa(f rrm(m oo4aetnif3iadls2elnvo u)alxoifcootlat au i;s) ruo(mpno4opee nci (  rrmu  nu1alenifeiadlsDul(vo;t)tetrir3oa1opDelues s tetrxrpnodapee ieiat artr(mpnt1teenifciasls2ran p;(0 lxnxrciy1opD  ies t seumxopnu1op   nci (fsDtrumont0tet  icias a2uanmsnu0 exoir3ty1oatr n i;s) rxoxopiu4apt mnesa( aDuax  ;o0open o3iydls2umn o (4 ltoir iydopteauei;t)trxoir3nu4lp e nctl()aruaum nt0ale  fcildlm ean pn()aeeoif ta1opD li ils s2um(mpnu1om nmfesatfsDtrur ;u1oltniietadfsDemumonu4alxomrctodlpD livs () exm(o oodam nmfcta( sruau pnu4ale  o3ildfa rlu o u0aetnxocio1fp r nvsl(0 etoiopoy4olte fei s  2tmxroou0alx io3taslmDeanmon() reomr3todop  ln olt  2xoxmpiydamtn fcs s  rumump;o4optniieildlm em(vonu0artrmo3tadfmtrlivs s srumxm nodlp   fcs (f 2rr(m no0opxnmoetat a2uanvsnu) eenirciydop ran o s0srumxmpnudlm  mncs s artr(rpnu4tlx mf3ildls2rm(vp () lxrxoctytfaDrliei;s  2urxopoo1alt  nvilt s2ur(  ou0alx mf3iadlm2rm( pnt)trtrmfctodfm r u s (  2toio iu1omt livtasf rua(rp;t4oeeoifeiytfsDrmu ont)alenmr oo1fm e ueo s  eurim3oo4amtnlivt (f 2tm(  ou4aptn ocildfs2rmn p t4 reniocio1lmDelnes;s0setr(mpou1ll e iet ()a2taxrpnt0tpenioctlt m uauvsnt4teermrcootfp e uei t0t2xmiopiy4llt  ies (f rtmxm ot0tptnmoctysfs rau s ()arxoxociy1laD lnvsls truo(opoo1ll  lietltfaDtruro;t4optoifciytlm2ulnms;u0teeoircoydoat lieo;t0 eumim3iydal n ics sf 2uaur ou0tlxniietyt s uanmonu4teenircoo1fp eanvi;s0s2urio oydaleemfcsat  Dur(rpot4aexnmfctatla rlumonu) exnxr3to1lmtrlnesl( texoxo oydol emncslt s2rmxronu0olx  oeiad m uauvs u4aeerxrcoatfa   ieo s  rtrir3iy4al   fcsatf rtr(mpnt1apx mo3tysla elnvp u4 leoxf3oodom  ln o t0sexrir nodolee ivsas)a2rmxmp;o4openiieiyt s ul( on()arermfcta1oa e ivi;t)t2xmxr3iudomtn fvia(f rtaumpno1oex mo3ildfs ulu o (4artomo oytfate n o s)t2xmiopiu4oleelivsltfsrum(rooo1apxomi3iasfm umuvs;u) reoif3tydoa  lnvilt0s2umxmpio1llt mfvi ()a2rru pot1tpe mieilsfa2rm(vp t4arxnircio1fptrluvo;( s2tr(mpoy4ll emnetas s2umxr oo1altnifetaslm rmnmo;u0 eeoir3oa1faD an o;s)srxoio io4lpenlfcsl(fsrurum nt0olxo oeilt m rmumo;t)aleomo3io1optrlivs t0s2xmio oodopeelfvsls  Drrum ;o1tpxo f3ias s2umu o (0 ltoxo3iotoa e ueo (0t2um(opno4ap emiei s) 2tm(monu0tlxn oeils a2em( o;u0 exrif oydfp r nes;( sexoiopiudlm elicilt) Dtmxm oo0apxoii3iasla2emn o;t) rxrxfcta1fp  aivil() 2tmio3io4ol  lfvia()srrrurpno0oeeomoeiyslm uau o ()aleomrciydlp ean sl( t2tmxo3io4al nmnvtasfaDtr(roou0tptnif3ildls uaums (0 rxrmfcoy1omDr neo t0 2xr(o io1om n fvsa(f 2urxr nt0oexnif3tadfaDulnvs t) renxf ia1lm e uvolt)trtrxo ny1open ncias)s2rax pot1teeoiociatlm um(mpn(0artrmr tadlptrlivo () 2trim oydlmte fetls aDtm( pot4olenmoeias mDul( s;u)artrxr3iatfm ranvsls0t2xrxo3nydale lnei t srtm(  ou4aeenmfeild mDua( p;t4 lenxf tatopD li i;s0s2xrxr nydoltnlici ()sDtrurp;t4teeoioctasfmDuluvonu4texrxfciotfmD luvo s0teuoimpny1aptelies s)s2rau  nt0oexniietad s2rauvp (0texrxoctydlpDrluvi;(  2ur(mpoy1am nmieia(  Draxrooo4altn oeildfsDrl(ms (0tltrxfciotoaDr i s (0 2xr(m3ou1omenmiesa(farumx pot4ale  fctytfsDrmn o () etnif3oa1fpDeai o;t) exrim iydamtelfeia()sruaur ot4tpe mi3tyd s elnvs;t0 rxomr3tadfpDrai s;() rtmxrpiydop n fvsat)s2urur ;o0tleo fciasfm2umn o;()altrxrciadla raiei (0t2trxrpno1llee fcsls)arra( pot1teeoifeiaslmDeau ont)arxrmfcoa1lmDe u sl( s2to(r oy1lmte fei (f 2ta(  no0apx ifetldls2uaump (0alermrciydom  li sls truriopiy4omeelnetls)srum( pnu0oleoii3tasfs umn p;(0artnmrctadlpt  nvi;(0 rtoim3nu1amtn ies () 2ta(  ;u0opto octydla2ul(mpnu0areoio3tydlpt anes;t trtmxr nu1lmt liesl(fsrtrx pou4apt  ieiyd aDua(mon()arerxfcootlp raivslt0t2xr(r3oodapt lnvias) 2raxrpno4tltomi3iyslm2ulump t4 ltnxociatfaDeln s ( srumio3iy4alte nei tfsDua( poo0teeoifciadfm2ul(ms;u) etoxo3oatoat lnvols)setrxm iu4ap   netas  2ta( pot4tlenmf3iatfm rauvp;u) eenmf3to1fmteauvs;( tetr(r nu1amtelfvtl( srurxmont0tlen f3iadls2emumo;(4 ltnxo3io1omDrai s;s  exoimpiu1op elivsls sDrmxmonu1oeen ociltfs2rauvpnt0trtrir iadlmDeln i;t s2uoio io1omtemncs s s2um(ront1aetniieiatls rln p t4trxoio3oy1opDr nvol()t2umio oodlpeemnviasfaDua(mp;t1apx mociasfm rm( o (0teenmf3iy1fmDrluvs (0trurim3iodaptnmfet t srum(mp;o0optn octytlm rmu s;u4trxomociotlaD lu s;t teuoxo3iy4lmt lfcs s)arrmumono1teenmf3tldfm2ul(vs ()teeomrctodomteaivi s0 2xrirpoudomtn ncilt) Dtruro;t0alen iciltfm2el( ont0 rxnio totlatranvi s sexr(m iudomee feia( sDraxmp;o4tet mfeiasfmDrlumo;() rxnxr ia1fptean s;t0seumxm ou1lp n nci t) 2uaum ot0apeomictltfs rl( p u0tetnxr3iytlpDe u s t0 eurxopiodolt mncsat) rrmxmp;t0opeo ictytlm2rl( sn() ltnio3oytopDean slt  euriopnodaltn ies t s2rmx  ;t0oeeomociytfaDra( on(0artrif3oadfp r ivo ()srxoxm oy4lmen fvtas)artau o;u4apxn o3iltfs2uaums (4tlermo totfaDeli i;t s2xoxrpiu4ap  lnvta( srumu p;o4tpt miciadlm2raumo;()aetrxfcto1lpDelueol() rtr(mpiodlmtn ietltfsrrmxm ou1tpx ifciyt mDrlu s (4aexnmo iytoa   ieols0 2tm(opiy1ome mncs (  rum(mpou1tpe  ocild aDumu o u) ltoifcoadomtelivil() ruoim3iu1lptemnvta(fsDurum nt1tet iiciat s ulu snt4trtomf iodlatrlu slt)texrio3nu1omte nesl()aDrrumoot0alx if3ilt a2rlu pn(4tleoircoo1fmDraivs s) 2tmxopio4ol nlnetl() Drau  oo1openmfctytfmDrauvp ()teerxocoa1lp eln slt texrim3iy1amtemfvs ( s2tmum ou0tltniietyd mDeau on(4tltnmr3oo1lp  li o s)t2toxmpiy4lpe  nci sf Duaxro;t0tpe io3tadlm elnmon()texoxr tydfa rlu o (0seur(opiy4ameelicsls  2tau pno0ape  icias aDua( on(4aeeoxocoa1lmD aies;(0s2trimpoo4om e ici tfarumuroou1tlt if3iadla2ea( p;() eerxr ia1fp eluvs;()sexr(o3oy4al nlncsasf rrru  nt1apeniiciys m2em(ms;t0texnxo3tatfpD lueilt0 rtoxm nodopt  iei (fsrrmx oot4oleo octysls2raumpn(4trtrxfcio1la r ies (0srtr(m no1ope micslt  rtmxrpno1ope iociydla ra(mpnt)aeerxrciytopDr iei t0t2to(m iu4am emiet () Dtaur nu1olxoii3iyslm ea(vs;() eerir iadom  lues s  ruriopno1altelnctlt arurxmono4tpt ioetadfa2uluvsnu) eenxo oodoptrlues;t0t2xo(o3ou4altn ivtat) Dtr(r nt1aetoiiciydla2ran s ()tltnmf oadfaDe iei;s0srxrimpiy4ome lnei ()s2um(moot0alx ifcias a ra( on(0 lxnxf totfa eaueolt trurirpno4al emivsls arrrxmono1altomf3iytlsDrluvs t0arxrmo3ta1lpD  ivi;(0s2xriopio4om   fetls s2tr(r ;t1tlxn i3iadlmDemu snu0aeenxocoydlp  aueo;t t2toxr3io4lpe lfct ( a2trumooo4aeeoioetas sDraump () ltoioctotoaDrli o;t  eurim3oydlpenmfeilt) 2uau pnt4alen octys s ra(mo;t)trerif3ta1oa   u i;t)t2tmim3ny1llte nctls)aDtaxm nu1olenmi3iltlmDranvpn()tlerifcoatoat lneo t)s2toimpnydamtemfvs t)s2rmxmo;t4aeeoio3ilsfmDeaumo t) exrif iadopD  uvilt srxrim iu1amt  fcil()s2rmx  nu1olt  o3iltlm2umuvpnt4alxoxrcto1omDraies s srtmxrpoudlp   iviat aDtau o;o1openio3ild s2el(vp;t4teenir3ia1fp elu o s)s2toxm3oy4am  mfvtls sDtax  ;u4apxnmf3ilsfs umnvo;()tltoircoytfa elnei;( t2umxm3iu1amenlnesa(fsDrr(root0ale ii3tad s ulnvs;t4 reomr3oa1laDran ols t2xmxo3oodopte fes t s2tmx pno1alx mieiytls rmu pn(0altrxr tadoaD  u o t trto(o io1olte ivsls aDuru pnt0opxniictad a2ra(vp u)aeeoxr3iodoatelnes;()s2uo(r3iy1lle mnvilt  2urx poo0aet  feiydfs2em(vo (0tlxomoctotlmDean i t seur(opno4amenmiviat) 2rrxm ot0oeeoii3tatlsDrlnmo u)artnmociadlm eai o t)srxmxrpiy4alte neiat s2rmx pnu0texn fetltfa2rmnvp t4 rtnif3ta1fm  lneo;t)seurirpiudamtemnvsl( aDra(r ou1aptomietysfmDul(vp;u)trxrxocootomD liei t s2tr(mpiy1llenmictltfaDurx p;t0tpx if3tydla ulu o;t)arxriociadfate uvsl(0srtrxm oo4oltnlfctltf 2ta(m nt4alen iciysfs elu s;t0arxrmfcoydop r i o (0s2toxr3iu1ole mnviasfsruaumo;u1tlen oeiyd mDemnvp;t)texomf todfate nvs (  etoim oudom   iet t) 2trxmpot1aexomiciytls2ran p ()tltomr io1lm e i olt)s2um(m ou1lme mfct sfsrraur ou0altn ieiytfm em(vsnu0artrxf3iytfpDrai o;(0 rto(opiodome  neias) 2rmxm ot4oltn ieiatlsDeanmo;u0 rtnmfcto1lmDe n i t0 rumxrpnu4lpt  fesl(fsrtau  ;u1ape io3iltfm2rauvo;t0 exnxr oadfmDelivi s truriopoudalee icsa( s2uru ono0opeoiiciydlsDemums;t0 rtrmf3ootlpDr ivs;s0t2xr(o3oodam nliei (fsDra(  ot1tpt mictltfaDum(monu)artrif iodfp  ai sl(0t2uoir3oodol elfcsa(fsDumu  ;t1oexn f3tydfa2um(mo t) rxoio3iatfmte i s;s srxrxo ny1lpt lnetlsfartmum ot0tleoifetlsla2uaumpn(0 reoxrcoo1fmD anvi;s seum(o3nu4ll n ivilt  Dtrx  ou4tpt io3iadla2eluvsn(4alxrxf iydfp  aueil()t2trio oodal e fvt t  Drrx p;t1oleoioeilt m raums;() rerio3iodlmt aieol() euo(o3nodom   iesls arraxmoot4oexn ociytlm2rmn p t)aeeoxf3ty1lpD  uesl(  2xmxm3oodapenlfvsa( s2rrum no4tex mfeiadfmDel(vpn(4 leoxr3oytom  anvi;s0 etmxmpoo1ll nmictasfaDta( p;t0aeto ociasfm el( p u0 rtnir iatfmDeaues s sexo(o3ou4omeelneias)aDraxro;u1aptniociadfs2em(vpnt)tltnifciadop r u olt srtoiopno1lp n ncs (f 2uax  ou4aee mieildfsDumumpn() ltrmr3iydlatrlnvi;s) eurxm3io4op  lnvsatf rrr(rp;t4ale iictld a rmump t0aeeoxr3oodlptelnvo s0s2xoxm nydaltnmncsasfsrrrum nu1tpx  i3iatfsDuauvpnu0 lxrir3oydla  anvo;() eumiopiydam nlnesls  rrr( oot1opxnmo3tldlmDrlumo;(0aetoir tydlpD  ivils0 rurxrpoy1amtnlfvi ()aDrru  nu1alenmo3iltls2ua(vo u)tleniocio1opt lnvs;s texrimpoudomte ncias)sDururono4tetoioctlt sDrmnvp;t)tltnmf oatlpteauvs t s2xrio oo4apt mics tfsruaxr no4aleoif3iasfm2emuvp () reomrcoa1oate nvo s  exrio nudap nlfvta() Dtrxm ot4altniieiasfm2emnvs;u0 exrmfcia1fa eanvils)srxrxr3oy1ol  mietatfs2um(  oo1aee mo3tltla ranvonu4trxrxrcty1fa eaieo;t0srxrxr ou1lptnmnes (farumurpno4aeto ictytls2um( on(0trxnxoctotfp rlu s s s2urio3no4lm nmnetasfa2tmur ;t0texoiieiysfsDulnmo;(4artnmf todomt lnvsl(  eumxm iydlp emnetat)s2rmx p;t4apeoifeias aDrmu s (0teeomo3iytlpDeaneol()tetmxm iu1lm elfeiat)srrr(m ;u4tlxn fetytlsDemums;(4aetrxrcoy1lp eln s t0t2to(opiudalen ivsas s2ur(mo;o1olxn iciaslsDuln p;u)arxnmr oa1om rli s s)teuoio no1lm nmivtas)srurum ou1opx  o3iydfa ran o;(4 leomo3tydlpDeaues s0s2umio3io1lleelfvt t aDta(mo;u4alt mfeild a el(vo;() etomfcio1fptraneo t  2uo(mpiodoleemfeias aDra(r no4olxo oeiadlsDuln s () rxrmrciotfpDeln s;s setr(o3iu1oleemfet tfarurumo;t1tetniociadla ra(vs;(4 eerir oo1om eaivs;t) 2tm(m3oudal e ivta(f rtau p;o1aexo feiltlmDeauvo;t4areoxf3io1fatr uvs;s0sexm(rpoydlpt mnvtlt arur(mp;o0apeo f3iydfsDrm( p u) reoxo3oo1fm e neolt)s2tmxmpio1lmt livia() Dtmx  nt1oleomoeiyt sDeanvs;u4arermr3oy1fmtr ueo;s)texoxrpno4alt lnctls)srraump;o4ope  feilt m2ranmp;t0arxoirciy1lmDr ivils  etrxo ou4lmee ivtatfsrumu o;o1opxoiiciydlmDeanvs;t)trtnxr3todoateanei;(  rxoim oo1al nlfct (fartm(r ;t4tle  feiytlm2rlu s u)tltnxo tadfmDelnvs t)tetrxm iy4ale livi t sDua(r nu1oleomociyt a2uanmp ()artnircoodlpDraies;(0 etr(opio1ope  ncilt s2rax  ot0ope moetydfs2ea( s;u0artnifciydlpDeaueilt teum(o3iydll elnet ()sDrmumooo1apxnmi3iytfsDuauvo t) exoxf3to1oatraivo;s  2xm(r oudal emfvi ()aDuaum ot1altn oeils a2el(msnt) etnif ootlmte nvo (0sexm(opou1op  lnvtatf rurxroot4altnmf3ilsls2ra(mo;u4altomf3iy1fmtrlu i;(0srxrir3nodopt mncsas)a2tmur no1tet ioetydfs rlnmonu0 leoxrctydomteaivslt) eto(opny1lpeemnctl(  rtr( ono0aeenii3tytfa2el( on(4tetoif3tadfp e ueo t sexoiopoy4lpt mfei () 2urxr ;o0oltoifcilsfmDeau o;(0tltoxo3tatlpteli olt tetoio3iydlpte fcsl(farrmu  no0apenmocias a rau o;t4arxnxf oa1lmD auvs;t) euo(r3iodope mnctltfaDtm( poo0opeoiictatlm rm( s t)trxoxo oadlatr nei (0trxoxm3ou1alte fct sfs2tr(mpnu1oexoiiciad m rmuvp t4alenmf3ta1oaDr u s;s) 2xmxmpnydapeemictl()sruaumpoo0oetn fcildfa rl( o (4tetnmrctatoa raivsl(0 etmimpno4omtelfvta(farra(r ;o0tpxo f3iys m ean s;u0teerxr iy1lpDe uvi;t  2xoxm3oo4lmtemicsl() 2rm(ro;u1tpe  ocildls umuvsn(4aeermf3iy1lp r ieo t0s2umxopnu4am  lfet s) rua(  ;u4alxnioetydls2em(vp () rerxr iydoaD ai sls  rxr(r3oodolenmfvs s  rrm(monu4tleomf3ilt m rln s t4aexrir tatfpt aivi (0t2xrim ou1lmtemfciatfarua(  ;u0tpxomi3iyt m2elumsn(0artnmo ty1oaD ai ol(  rtmxopou4lme  fvtlsf ruau pou0tlt ioeiltfsDel( o;t4 rxnir totopDeauei ( trtmxo3iodap nmfvtl()sDra(rpou0alenii3iydfaDelu on()tlenifciotfm rlivsl( t2tm(r ou4lmeelnvi sfsrra( p;o1altomo3iatfa2um(mo (0teenmo oy1fmDeau o s0 rxm(o ny1ame mnvsl() rur(  nu4optnmfetydfa rau s t0artomr3tadlp  li o;s s2xm(mpnydap  mnvsls s2tmx  ou0tpt  f3iltlmDulu s t)tlxrxr3oo1faDelnvi s0sruriopou4al  miei sfsDrax o;u1opx  f3ilt a uanvon() lxnxr3iotfa   uvol()s2tmio oydoltn fvtls)artmu pot1texo i3tatlmDulnvon() exomrciydfa ean s ()teumio nodll  mncs t) rrm(mo;o4ope  o3iatfaDrlnvont0tlxnxrcoadoat luvslt0trur(r io4ope  ivsas)srtax o;t4altomicildlm2rlu s ()trenif3iotlpt  uvils0seto(rpou4lltemnctas  ruax pot0oeenmfciatls2rlu s (0 rtnif oytopDraivi;t0srxrxr iodole livta(  Dtr( ont1aet ifctyt s emumo;t0 lerxf oadfm eaieol( srumxr nydopenmiei tfs2ur(mo;t0oeeoifctlt s ranms;(4teenio3oy1lmt au i;s  2tr(r3iudopt  nvils) Dtr(ro;u4altomf3tas s2rauvp;t0tetoircoytoptrlu s (0 rxrxmpnydap nlncsas)sDrr(ront1opeo octys m umnvo;(0 ltnxo3iadfm raueo s)tetoxo3iu1omtelietl(f rur( p;o4oet mf3ilsls ran o;()texrir to1fa rauvi;(0 rxrir3no1olte fvi sf Dra(rpno4opto ociad s2raump;(4tlerir3oydlmDelu o s)s2xmxr iu1omt  nvt s aDtau  ;t0oexomoeiatlmDrl(mpnt4aeeoif3iydop rli o;( trumxm nydlltnlnvslsfsrrmxrpnu0oex iictldlm2emnmsnt)arenir ia1omt  n i ()setoxmpoydlpeelnes tf Drmx pnu4oleniieiasfa eln pnu)trerio totfm rlu s;t  rtrimpno4op   iei (fsrurx  oo0teen f3ias m raumo u)tltrmrciotlp r neo;t sruo(r3oydlle licta(fs2tm(rp;o4ope mictasfsDelnvp;u)tltoxrcto1om raneo t0teurim3oydaptelnvia()srrmxm ou0aet mieildfaDulnmsnu0 rerxrctytfmDr n ol( s2toiopoudam elivsas)a2urx poo4apt mi3iyslmDrmnmpnt0 lenmf oy1lmtraivs ()t2urxopio1llt  iesas)srtaump;t4aexnmo3tytfm rm(msn(4tleomociydla r ivs;s  etmio nudll elietasfs2tau p;u4tptomi3iysfmDel(vpnt4tltrxrcoydfmt lnvs t0texr(m oy1lm  lfvtasfs2urx onu1tetn iciyt a2uan o t4 lerirciadlpteauvs s)trurio iy1ome  nei s)a2rm(rpno4ole ioeiytlmDrmuvpnt0trxrmrciytopDrlnvo;(  2xriopio4lptnmnvsl( sDraxront4olx iiciyd s ua(mo (0 lenif3ia1opteanes t)t2uo(m io4lpeelfeil( a2ta(rpnt4tpxo ictad sDum( pnu0trtriocoodomD  i sl( setrxm3nu1aleelieia(  Drauronu4tpxn oeiltla2uanmp t)tleoxr3tadlmDe ivo (0t2tmxr iudalee nci s  2raxm nu0oet mo3tld s rln p;u) rermf3oa1omDeaivo s0 2xrxr ny4ap e ictlt)arurxr ot0tex mf3tasla2ua(msnu0 rerxoctatfpDe ueo (0setr(r nudaltn feia()a2tm(  ;o1tpx iocilt aDrlnms;u4aleoir3iodfm rai i;t0tetoxr oydal  lnct (fs2rr(mpnu1olt ifciytfsDrau p;(4altrxr oydom eliei t s2umir3io4lle lncias)arum(ront4alenif3tat mDumnmp t4 exrif oa1fp rlies;(0setm(m3nu1ap n ivta()s2taumpou4oeeoioetysfa rl(monu)texoir oy1lmDrlueo s) rurxo3nu1lptnlfvtl(fsrtr(mpou4tee iiciys m2uln s t4aeenxfciydfpt auesls) eumxr oudlmen ieta() 2ua( o;o0tltnmfetasfaDran pnt4 lenxo3oa1op  auvo;s0 ruoir3iu1ol  mictls arra(rpoo1apx io3tldfs2ra( on()trtomfcoadfm eluvs s seumir nudopen ieil(  rrru o;o0opxo o3ildlsDrm(vs;()trerio iatfat  nvols srurir3oudlmen ies t sDta(ro;u4aee mfciysfs uanvo;t0artoir oo1om ranvi s0srum(opnodamtnmfvi sfsrrax pot1olx ioctlsfs ua(mp;u) exnmrctatfmDe u ilt0s2umir nu1amtnmncs (f 2rr( pot4tpe mictlt aDrluvpn(4 rtnmf3todomtran s t srurirpiodoltnmfci s) rtmxro;u1aet ifetys s2rlnmo;(4alxnmfciodlat lnvol(0t2toir nydlmtelfci t)sDum(r no1oeenif3tasfm ranms;u4teeoir3iotopDrauvs s)srxo(o io4ale  fetlsfarrrx pno0olx mieias s2el( ont)aetoir3io1oat  i o;s srurio iudop nmnetlt)aDrmxrpoo0texo ictlsfs2elu sn(0 lenifcoo1fpt an slt)srxm(o nu1oltelicil(faDua(mpnt4open f3iys m ranmo t4artrxf oa1fat ln o;( s2ur(rpoo4al nmfet ()srrrx pno1tee if3ilt aDrl( o;u4trenir to1opD  i ilt  eurim3nydamen nvi t)s2ta(moot4tee  octydfm2ra(vp;() lxnio iodoa eanes;t srxoio oudameemietas a2uaumpnu4oexnio3iasfs2ul(vo;(4 exrio oytoptelieols0srumxrpoo1ll n nvta() rrrxroou0optoio3iad s uanmont4tlxnir3oatlpt anesl(0trxo(rpnydale  fcsasf Drmurpnu0ole iociysfaDul( snu) etnmociodfateli o;(  ruo(o3nu1amt mfeilsf Dumuroot0apto i3tasfsDelu s;t4 lxomo3ia1fptr ueo ( seurim3nu4omtemnet t srtru o;o1oltoiictltlaDul( p () lenxocia1lp r nvslt0s2xrxmpiydomee ietas) 2rr(  oo4tlt iictydla rln o u4 reoio ty1la eaieo ( teuoimpoy1ol e ictat  2uaxrp;t1ape  ictltfaDrauvo u0trxnxrctydlaDeaneo (0teumir iu1om   ivt ()srraur nt1opxomietas aDuau s;t0texoxo oatfm   ueo s tetrxo3no4om  mivslt srrrumpnt4apt mfeiytla em(ms u0trxomf3oodomDeaieols)sexm(o oydlme mictlt)srtaurp;t0tpx mociadfs2ulnvp;u4artnmf ia1fmteaneo;s setm(r3nodllt lnci s) rtm(mpnu1alt  fciad s rln onu0texrif oo1fm r n s t)t2umxr no4om emietl(fa2ur(roou4tltn o3iaslm2umuvo;t0 exoioctytlp e n olt seuo(mpiodolte ivs (  rrm( pno0openmfeiatla2umuvo u4tltnif3oatla eaues ()s2trxo oy4apenlnvia(f Dum( o;o0alxnmiciasfsDrluvo;t4 etrio ootlpDelnvs;t0trurxopnydalt mfei s arrmxrpnu1oeeo ieiatls eauvp u4trenifciadoaDr n sls)t2urxmpiudopee net s)aDurur ;u1tltomi3tldlm eanmpn(0 ltomfciatfmDranvslt t2urxo iy1lltnlnvtl() 2uaurpnu4oleomoeiaslm2emu o;(4trtnifciadfm  livilt0s2trxmpny1om nmivs sfarrrxro;t4tet  iciadfs2ul(vo;(4 reniociydlaDeli o (0trxmiopny4om n ivs t)aDrrx oou4tpeomociltfaDra( o;u4alermoctydfm eli i t  2xmiopny4lm nlfctls  2raumo;o0ope  ociltlsDea(vp;t4aetnmo iadomte u o;()srxo(rpnu1am nlnciat)srtr(m ;u4aetn ociltls rmn s t0 eenxrcia1op r nei (  2xm(rpoy4ll  livtas sDtmxrpou4opxoioeiys sDuau sn()alerxf3oa1lpDr u i t0t2xmxmpno1ll  lfei (f rra(moot0oltnifeils s uanvp t4 exoifctytopteaivs;t)trxrio oo4ap n neslt  rrmu  no4oet io3ias s uluvsn(0aetrmf ty1latrai s;()srxoim ou4al nmncia( s2tmuro;u4tetoiociysfa rmn sn(4teeoxrcoatomte ivo t0s2xrir3oy4al emneiltfsDrmx  ot0oexoio3iydfmDumnvp;()alxomo3oy1lpD ai o ( srtoxo3iodlm  lncsatfsrrrur oo0tlx iietat sDuanvp;t0alenmocia1omD au i;t s2urxo ny1am   fcs tfsrtmur oo0texnii3iytla uaump (0arxrif iadfptrlneo;t) rxrxo3ou4apt mnct s)aDuax  ;t1tet ioeiys mDul( pnt4aexrmocootlmtelu s s)sexrxo3iydllen iei () Drm(rpoo0opeoioeiad s2emuvsnu0tlxnmr3iodlmtrlivi t0texo(o iydomen fvtls srrax  ;t1tpxoiietltfsDeaump;t0tltomfcia1fm rauvo t0srxo(r ou4lmenmici ()artaxr oo0opxoiieiatfmDua(mp t) exnmo ootfptrlu o () rxrxo iu4omtnmieiat arumum ;o1alxnif3tltlaDum(vo () eermf3iotomteaneo s s2umiopiydoleelict sfsDurump;t4aex  feiytfm ranvpnu0teerio todomte n o ( t2trxm nydoptemfes t) Dtmx pou4tpenmo3tys a elnvs;t4 rtnio3iadlaDr nes t)s2ur(opio1omtn ivi t)a2rmx ono1alt mi3tldfs2uan sn() reomrcto1fmtean ils) exrirpoudaptn ivsat s2rruro;o1texomieiyslm ulnmon(4tltoxociadoaDeluvs;t0 2to(r io1lptn fesltf Drr(rpnu1apto o3iat s2elnvs u)aeenmocoy1op  aies;s t2ur(m ou4aleemncias)sDrr(mpnt1tpenioetytfs rm( o;(0arxoxr3iadlmDe u ilt srxr(o iy1ol  livilsf 2tax pno4tlto ietas aDeaumo (4teerir tatlpDe ivi t0s2tr(m iudlltelivi sf Dtaumpot4apxniietad aDel(mon(0 lxrif3ia1lmD  n sl() eum(opoydoleelivtat) rrrxr ot4tpeomf3tls s2rauvo;u) lxomfcoydfmteaneo s0 etmxm oy4lpeeliesa(f Drm(r ;o0opx  o3iasfa uanvo (0trtrxrcty1faDrlivilt)t2tr(m ny4lpte iesls aDrrx  ot0tltoif3tydfm2ul(ms (4alxrxf ia1fmDrauvs;() exmir no1apt  fvt s s2rm(mooo4alto f3iytla2ulnmo (4arenir3io1fp r nvi t0texr(mpny4om n nci s) 2uaurono4tpto f3iydlm2ean pnt0trxrio io1lm raiei t) rurio3iu1op nmfcilt)s2tr(m ot1tpe mf3tys a2rmnvp;(0areoir ty1lat  nes ()trxm(r3ou1omt licslt) Dtaxmooo0tpt  iciaslm2uanvsnu0tlenxf oytopDeaneo;(0t2tm(o3ou1lle  net ()aDuaxroou4olxo i3tysfm2ulump t4trxoxr oadlaDr nesls trxoxo3nodame  nvtls  rrmu  no0open feiadfa2eau s u4tltrir io1fm rlieilt t2umim3iy1lptn ieil(fartau p;t4alenmieilsls2el( ont)tlerxoctodlmtrlu o t0 euoxmpoo4lptn ietat) Duaxm no4tlxnif3tas m rl(vonu)alermfcio1lm raivo ( srxrim io4optemnei (fs2ra(  ;t1open o3ild a rm( pnt0trtnmo iatfpD aieil(0 exrxm3iodomtnmfes () 2taump;t1aetnii3iatls2eanmo;u)tltrio oytlp  lnei;s0trtm(r3io1ap elnvilsfarraumpnu4alx io3ildfmDuauvs ()alxoxociydoa eaneol( seuo(rpou4ame mivs t) rrm(r oo1oetnmoeiysfa elnvs u4 rtrmf oydomt  iesls)texm(opiodlpenlictas)aDtaxrpnu1aeeoiiciysfmDeln s;(0aetrifcoa1oa r n o ()trxoxr3ny1omenmnet t)arrrxro;o0tetomo3ilt a uanmsnu0 lenxr ia1faDrau sls) rurxopiydomtemivtlt)srtrxr nu0tlxomfctlt a2ea(vp t0aexnxf3iy1fmtr ivils0srtm(r iu1lmtn ivt ( s2rau  oo0opeo o3iat a eanmsnt)tetoxfcoo1oaDe ieil(0 2tm(m3oudapeemfviltf 2ra(r ot1oetn o3tlt s eluvpn() leoio oadoatr nesls) 2xm(r iu1alenlfci ( arua(r nu0oetomf3tysfm2um( p;t)treoirctodfm eluvolt0 rxoio3iodopt miei t sDrrxmp;t0oltn ieiadfaDuaumont4trenxf3ootfpte i i t0 exoxr3iudop   fei t)a2tmxm ;u0oeenifciasla rlnmpn(0tetoioctatfpDe u slt) etoimpiu4apte ivia(fa2umumonu1opx ifeiasfmDeau pnu4 reomo3tatoa  ai o t0 2tmxr nu4lpt  ieilt)aDtm(rpno4alx mfeiasls2ua(vpnt4treoxr3tytlaDrlivi;t s2uoxopnu4ll emfvsa()sDumu  ;t4tpx miciasla ulumo;(0trerxrcto1faD li s;t trumimpiudole lfcsa( sDraxrono1tltn ocildfsDeluvp t4alerio oatopDeluvi;(0 2xoir nodll elictls  Drrx oou4olxoifeiytfs uauvp ()alxrxrcoydfm  li o t0s2xmio iu1am  mfei ()sDumu p;u4olxn o3iltfa el( pnu4aetrir3oytfmtrluvs (0 etmxr3nydal elieta( aDur(mpou1tlxnmfetys a rmnvp ()aeeoif3ty1omteauvo s)texoxmpiudap nmfci sf 2rr( pnt4olxn o3iys m2rln s;(4tlxrmrctydfm rlivo s0 ruoxr oodame  fciat  2ta(moot1tlt moeild m2rmu onu)aetnmrcia1op e nei t teumio iudap nmfvsat) Dur( ono0tlt  iciatla ea(msnu)alxoxr3oo1fp  luvo;s)trto(o3nodll n neia()aDraumonu0aleomoctld a2el( p;(4teenxocootlat lies t setmxm3nu4am e nci tfaDra(mpnt1tpt mociltlm2emn s (4teeoxr3tytopDr ies;t)seum(o3ou4op n ieiat aruau ooo0aeen o3tadfsDumuvp u)trtrircty1opDr u ol() 2toxr3oo1ame  ncs tf Dumuront4tpt mo3tasla2ea( snu0tetoxr ty1lm  lnvs;(  2xo(opoo1omt mnvta( srraxm ;o1olto ietytfaDrln o (0 lxrmo3oy1laD  iei s0sexoxr3nu4amt miviasf rtm( oou0oltomfeiad a2elump;t)trtnirciy1omtrln sl() 2xriopoy1amtn fetls  2uauronu4apeo i3iadlm2ea( ont0 etnmociatlaDelnvo s0s2to(opnu4oltn fcilt  rumxrono4aetoii3iad a2rlnvp (4tltnxf3iydlpD liesl() eum(r3no4altnmnvi sfaDta(r no0apxnif3iys m2uan p t) exoxo tydfmDrlivils tetr(m3iy4oltemfct tfa2rax  no4oee  iciatfs2ea( p;t)artnmo iy1latrlnvo t  rtrio3nudole  ictls a2um(ro;o1oetnioeiyd s2em( p;(0arxomfcoydfpD  i i;( t2xrio3ny4lmeelfei t  2rmxmoot4texn f3ildfa2emums u0 etomf3oydlmDeaues;t0trxmxm io1lmee nvta() rumx  oo0oeen ietltfm2rmums u4 eeoio3iydlateauvi t0 2xrxmpou1om e nctasfa2rmxmpou1aeeomiciltfm ranvpn(4arxomf3oytfpteluei s)s2ur(m3ou4omt lietas)a2rax p;o4ale iiciyt mDel( p;(0areomo tadfaDeaivilt0t2uo(r ny4amtnmnvilt)s2trxr ot0apxo ietat mDumnmp;u0 eeomfctytoa elnvs s truo(mpio1alt livsa() rta(r ;o1tpxnmfeias s uauvo;t0 etnircoatoaDrln s t  2xm(m iudllenlnvslt  Dtr(r ;u4aetomo3iltls rlu ont0trermf oadfpt livo;s)seurxrpny1ol e iesltfsDtrxr ;u1aee  ociadfmDum(vo;()aeeoxr oytlat aues s0truoxm ou1al emfei sfa2rauro;u4tptniiciaslaDrlnvo u4 etrmr3todfp rauei t)s2xmiopny4amenlics ( s2tr( p;u1oleo feiadfa rmuvp t0 rermfcoo1omDe iei;s trurxo io1amt lnvsat)sDrru ooo1tpx  fcilsfs uauvp (4 lerifcoo1fpt lnvolt)trur(o3oodlleelfes (f Dum( pnu0openmoetadfs rlnmsnt4teeoxo iydom  aues t t2xrimpoo1opt mneilt sDum( ont1aptoiieildls rmnmo ()trtomfciatlmt  ueo (  exm(opnydlmeemivs t srraum ou1aleo f3tlt aDrlnmo;t0trenxf3ootoateai i;() 2xriopiodal n fvilt)arrm(rp;u0alt  iciysls2elnvp u4alxoifcia1fpte ieo;(0s2umxr3oudlle lncta( s2ta(  ;t4oleomfeiadfsDel(vo (0trxomr tadlpD an sl( setmxmpnudap e ict tf 2raumpno1tpenioeiltfs eluvp t0teenifcoytfaDeliei;(0trxr(m nydameemivsl( aDumxmp;t4tlt mfctad mDuanmp;u0tlerxo3to1fa r neo s0t2umirpno4ll elieias)s2um(  ot0oexomictas s el(ms (4 rxoir3iatla eln i;( t2to(opiydaptn fes sfarta(m ;o0aeto fetlsfm uanms (0altoxocootlatr iei s seurxrpiydal  mneiasf rur(r ;u1oeenmoetysfm2rlu p;(4 rerifcoy1fatelieo;t) etoio iu1omtnlfesl()aDrrx  oo4aee iieiatlmDemnvo u0aetnircoa1lp elueols0sexr(r3ny4lltnmnet tfaruaxmono4aet  i3ilsls emnvs;u)tlerif3iodfpt  nvi s srtmim ny4alee iesls  rra(  nu1oeeomo3tltlm uluvo;()tltrircoy1lpteanei;t t2xrim3iu1lleemfesas)srumxmpnt0ope  i3iad a ranvp;(0texnio to1oa  livi ( srumxm no4ole  ivtl(  rtrxmoot1tpxo ieild s2umu o;u4 exoif3ia1opte uvi t srxrio3iudlltn fvt t aDum(root1oetomoctldfmDra(msnt4trxrxo ootlatr n o (0t2to(r oudaptemfesa(fsDtrxr nt1aex ioeiad a ua( onu4alxnmr3oytom e ueol(0trxmirpnydomee fetltfsDurxmono0olt mieiat m rlumont0artrxrcootfat  ueo t)t2umxr3iydlpe  fvt t arurxrp;t4opt  f3tldfs2ua( s;t0artrio iotlpte ivs;s  2xmxo3no1om emfetat)sruauro;t1aet mfetlslmDea( s t0aetnxo3iytfmt anvilt0 rxoio3iudop nlnci s)srtmxmono4opt mi3iysfm2rm( s t0altoxo oatfmDe n ils  rtmxopnodolt lieia() Durx  ou4opxnmf3tls mDea(vo ()texoir3tatoa elnes s  2um(r3io4aptelfvi t)sDtrxr ot1tex mi3iytfmDulnms u4 rtrxo oa1lpteanvi s0 2um(opnu4lp emiei (fsDrru  ;o1tpxnii3iys sDua(msn(0tlermo3to1oatr nes;s trtm(mpou1oltemnci s) rtruro;o4tlt moctasls rlnmo;()areomf tadfaDrli s (0 2xoio3oudlmt mfesat) rtaxrpno4aleniieiasfm2uaump;(4tlxrif totoaDraieo;s setmiopoudap   ietl(fs2raxrp;o0tlt mi3iadfs rm(mp;u0tlxnxr oadfmDrauvils t2umim3iy4oltn ivtls artaumpnu1tptomoeiyd sDelums;(4tetnmf3oa1fm eaivol( seurirpnydlmenlivils) rrrxmooo1tlt mociytfm2rmnvo;u0 ltnmf3iodom r ieols0 rtoio iu4optelfei s)a2uaumpno4opto f3tytla2ua( o (0 etoif3totla   uei ()t2uriopoo4aptnmicta( aDrax  no0tpxnmictydlsDemuvo;t0tlerir io1oatr n ils texmxo3no1ope  fcta(fsDuaxrooo1aet mf3iad m2rluvsnu4aeenxf3iatoa  anvs ()s2xm(rpiu1lp n fcta(fsDrmx  ;u4tpxnmi3iysls ua(vp (0aeeoirctydlaDrlueol(0t2uoir3iy1llte nvtltfaDtaum ou1oexniociysla elnvo t0 exrio tydfptr ivo ( s2urxrpiodap  lfvsl() Dtr(  ;t4opx mf3iltfm2rln p t)texrmf totla rai i s)trxm(mpnu4lmt lnetas  rraur ;o0tle ioeilt m ean o ()trxnmf totopDeliei;t srtrxrpiodom   nct (f rtaum nu1tetn iciasfm2em(ms;u) exomo oodlp raneo;( trurxr3iy1oltelfeslsfaDua(mpnt0olenmo3iys sDrm(ms;u)tlxoxrcta1fa eaueils0srxo(o3nu1am  lfetls aDur(r ;o1aptoif3tatfs um(mo t)texomo3oytomt  ueo;() 2umio no4lm  mfcsl(f Drr( ooo0alxniociysls2eauvsn(4 lxrifcootla  ln o;( seurxo nu4op e iesls  Durxmpot0tpe moeiatlm em( o;t4tltomf ootfmt luesl(0tetrir3oy4lm eliesl(fsrtmu o;t0tpxo oeiyt a rmump;u0 reomf tadfmDrlivo;(0setmio oy1ll nlfeia()aDrax ono0tle mfctldfsDrm( s u4 lxrxo3tadlatr nei;( trtoio io1amtelfct t  rtru  ou1aleomfctldfa rl(mo u4trtrif3iy1opD lneo (0s2uoimpiy1optnlieiltfarua( p;o1tlxoiiciys m2ul(msnu4trtomr3totlmtr ivi;t0srtm(mpiy4lpeemivtatfaDumx poo4openmoctadfm2ulumo;() rtomocoodlmte i s;s0 ruoirpio4altnmfesas)s2tax  oo0aexoiieiasla ul(mpnu4arxnxfciy1la ranesl()s2toxo3iudale  fcil(fs2umu  ou4oleo f3tytfmDrmu p;t4 rermoctotomtrai i s0teuoir3oy4om nmfcta() 2ua(r ;t1ape  fciyt s em(vpnu4alerxrciodlpD lnvilt0s2umxo3oo4lpe lict (fsruaxmp;u4aeenmo3tltfs uauvp ()alerxo3todlp eluvo;()s2uoxr3nu1al e net ( srtauro;o0tpt  ieiatfm el( s t0 eeoiociotomtraieo;t  2tmxo iu4opt mfct s)artmuroot0altomieiltfa umumont) lxoif oa1op rau i;()s2tmxopoo4lm  mncs tf 2tru  ;t4opt ifetasls2rl( pnu0teeoio oadlmDelueo ( trtrxm ny4llee nciat sDrrumoot1oex ifciyd mDel( p t)tetoio3iadfm r ues;()sruriopou1amtn nciasf 2tm(  ou1tltnii3iysfa2uanvs;u) eeoxr ta1om eluvo s) rxmxo3nodlp emnvi sfs2trx pot0texn fetadfsDelu s u0artrir tydfpDrlu o s s2trim oy1om  mnet s)a2rau onu4tltomi3tldlaDrmnvp;u) lerxociadlptr ieolt sexriopiu1ll e ncias)srtmum nt4apen ieias s ua(vsnt4 etrmo io1fpDr neo s)seurxmpnodlmeelnes (fsDrm(  nt0tleoio3tysla2elu s;t)aeeoio totoatrlivs;t)srto(r io1alt liviasf Duaxrpnu0tpx  f3ias s rmu p t) exnif iatopD auvs t0seumimpoudal e ncsas a2rm( p;t0aeeomociys m rm(vp;()arxnxf oadla  aivolt seto(m3oy4lltnmncias a2rru  ot0olen iciltla ra(vsnt4alerxrciy1faDe uvslt s2toio3ny1lpe miesa()arra(  ;o4aptoiieias s rm( s;()texnmo oytlaDe uvils0s2tmiopio1altnmnvs s  rtauroou0oexnmo3tatlsDranvsn()arxomo iy1op rlnei;s0s2uo(m iy4ap  livs (fsDrmxr ot4aet  oeildfsDrluvo;u)areoif ta1late ivs t)sruoirpoy1op   fcil(  rtrumpnt4optn fetlt a2em(vsn()artnio totfat  uei;t teuoio iy1aptemnetl(f rtax ooo1tptoifeiadlm2rlu s;t4artrirctatfp eli sls teurim3oydomte fcsl() rur(  nu1tex io3iat m2rmnvp (4tltrmo3ia1omtrluvils) 2uoxrpio1am elivtls  2tmu o;u4apxomi3iys a ua( o t0teerxr3ta1fpDr nvi (0trtm(r3oydol emiesl()arrm(r nu0apx ioctatfm rl(ms t0teermrcoytlmD aiesls teuoxo io1al n netls) 2urxmpoo0texomfciysls2rau pnu) ltoioctytoate u i t srto(m3nudal e nesls)s2umurpoo4oetomfcils aDea(vo t4treoir3iodfmDraieo t)texoio3iu1lpt mnvsl( s2uru onu0teenmf3iytfa2el(vpn()aetoxfciatfmDrlu sls  rtr(o ny1alee nvs ()s2um(m ;o1ole iociytfa2rlnvp t0teenxfciodfaDe nes;t)s2uoxo3oy1lpt lfetl(fs2rrx pou4tet mfciatfa2uauvo;() rtomociatfpDeauvi;(  2tmim3nodomenmfetls srtaurpno0oeeomfciyslm emump;(0texnxf iytfpDrln o t0setrim oy1op e fesas srtmxrp;t1apeo ietls m rl(monu)tlxrxf ootfa rauvs;( t2toxmpno4omt  neta(fa2umxr ;t4oetoio3tyt m rm(vo t0tltnxr iodfa raivs () rxmxopiu1ape mnetls srrr(rpno0aexoif3iaslm2em( on(0arxoxr3iy1omtrau i s)t2ur(m ny4opee ivi sfs2rm(r ;t0tptoiieiyt aDum( p;()texomo3iydfmDr nei;t  rtrir io4lm   iesl() rtrumo;u1tlxo ietad m rmnmon()alenxocoytomtr uvs (0setmxm3ou4opeeliesa(fsrtmx p;o1tpxniiciys m rlu p u0aetomf3iydlp elneo s s2toxr iydap  mnciat)s2ra(r oo1oexnmf3tydfa raumo;u4tlxrifciadlaDr u s;t0srumxo3nu4amt lnvtls)artr( pnt0olenii3ildfa rm( s t) etnifcta1lpt lu s ()sruo(o nu1lme mfcta(fsrrmxm nt4oex  ictadlaDemuvp () leoir3totopt anvol() ruoio oydap emnviat) 2trum nu1tee mf3tat s2rm(mo t)trxoif3oatlat auei ( t2xrim iu1ll n netat aDrrx ont0olenii3ias a2rlumo;(0 rxoirciydfaDrauvsl(0 ruoxr3iu4apt mnvsasf rta(rpnt0opx  ociysla2eanvp;t0tlxoxo iadomDelivi (0trum(m nodlm  mfvsa(f rum(rp;u4teeo fetatla2rluvpn(0 rerxo3iotoa rlnei t sexo(r3oydome mies ( arra(rp;u1tle mieiltfsDem(mont)trtoir3ootlmt  i i (  rurir iu1openliviat aDtr(r nt4olxn ieiytlm emn snt0 etoxf3tydla raneslt) 2uo(mpoudom n ivs t sDuaxmo;u1tlx iiciatfa emn snu4 rxoif3oodfaDrlivs;() 2xoirpno1lmenmnvtlsfa2rrum nt0apxnmfctysla em( snt4altrxf3oatlp eanvo s0 rtrir3iy1amt lfes () 2urumo;t0alt if3tatla uaumsnu0 eeoxo iadlp rlu olt setrxo3ny4alenlivias s2rmxmoot4opxnmoetlt m2raums;u4tltnmf oo1opte n o (0sexrxr nu1ape liet sfaDrax  ;t1aexn f3tadla el(mp;t0trxomf3oatop raieo;t0sexmxr ou4lptnlnes s artmxr nt4tleoifetasfs2rlnmpnt) eerxfcoa1oa ran s t0t2xo(o3oy1ome miei sfa2rm(rpoo4tpxoif3iaslm2emumo u) ltnio3iodlm rlnei s)teumxr3oudalt lnetlt  rur(mono0tetoifeiydlm2rmnvp;()texrmo3tadlpDean ol() euoxm3no4op elivsa(f ruax oot1alxn octasfm2umuvo u0teeomfctytfa rlues;t)trtrxr nudop   nvil()a2raxro;t1oee  ietytla ra( o u0 lxrmocio1om rliesl()teuoir3no4oleelncsat srtru  ;u4olxomo3ild m2ra( pnu0 rxnmf oydfmDe ivs s)t2trxr oo1lm e ncsas  Drrur ;t4aptnmfctlslmDra(ms;(4tlxomo oatlaDrln ilt0 2umxmpoudalenlfviat arrmumont0oex mi3ildlsDrmu s () rtoiocoy1oa  anvsl( teurim3nu1opte ivil(  2tm( pot1oeenii3ilt m rlnms () etrmocoadlpD au sl()trumimpoudlmt lnet (  Dtmxroot1texoioetyt m ulu p;t4 renmfcoodfmD  uvsls0t2tr(mpoudamt  ncsl(f 2um( onu1oexnmiciytfa2emnvsnt0tlenxo3oytoaD lnvsl() rtm(m ou1oltnmfvi sf Dumxmpot1apxomiciytfmDem(mo;t) etrxo oatlptrlneols0t2trirpny4lptnlnet ()s2rr(  nu4tpt mf3iytls2ra(vp;u)trxniociytlp r n s;s)trxoio no1amt  fesatf rtmxmpoo1tpto oetlt sDel(von(4trtoxo iadla elnvils0 eum(mpiodop e nct s) Dtr( pnt0ole  ociytfm2rlnvs;(4 etrxo ia1la   u s t truoimpiodoptelncs (faDraxmpno0oeen ieildls2rlu o;u4 rxrxo ty1la rluei;t)srxoimpou4amtnlnctl(fsDuaumpou1opxo o3iad mDuln p (4 etrmo3todlpt aieols t2uoxo3iy1apeelict t) 2uau  nt4texnmocilt m2emu snu) rtrir3iytfm elu il(0 rurxo nu4ape mict (f 2ua(rpoo0apxo fctlsfaDemn o t0 rerifcty1opt au ils0texmxrpou1am nlnvsa()s2rmurooo0aptnmfetls s2um(mon(4 ltnmf tytoaDelnvi () eurxm3oo4omtelfcsa()s2ua(r ;u1altnioeiyt mDra(vp;()tleoif3ta1lmDrluvi t  2uoxopou1lpe mfeiatfsDraur no1tpe mietld s em(vsnu4 renmo3oy1lmt  ivo;s0trurxmpiy4optnlnvi t)a2rmump;t1aptnmictytfa rluvp u0texomr iotomtrlues;t)s2tmxopou1ol elncils aDur(m oo0aetoii3iyd m2ul(von(0aeeoio oy1fat an olt tetoxo oodopeelnesltfsDraxro;o0tlxnmictatlm rmnvp t) eerxo iydfpte uvsls) 2tm(opnudalee nesasfsDrrx onu1oexomiciydfa ranvo () rtnxf oatla ranei;(  2trir nydalt micsa()sDurxr ;u0oet moeiatls umnvo t)arxnxf iytlp r ies;s srxmxm3oydll nmneia( aDum( pno1aex  fctadfm rm( s () etrmr iydlp eanes t)s2xo(r3iydllt  ictas a2ur(  ot4aptn ociyt a uln o t)tltrxrciytopDr n o () exr(o3ou4lpe lfcsltfaDrmx poo4tlxoiieiasfs rm(monu0 ltrmo3totoaDelnvo t setm(rpiydal nlivil(f Dua(rpnt4opxoiietatla2uan on()trtomocoatoaDean o;t)s2xmio iodom  lnetat arrr(r no0tet  feiytls rauvsn(0alerxrcta1fmtr n s (  rurio no1ol  mfeiatf Draurpot4texn o3iydlm2rmumsn(0texnxo3iatfaDrlivi;s0trtriopiy1amtemfcsl( s2uauro;t0tleo iciltfa rlnvp;t4aexriocoadoaDeaivs;()t2xo(m3oodom emietlt aDraxr ;u4tpxomi3iys aDuauvp (4 ltoxfctydfmteauvsls)s2xoxo3oo1lm  mncia(fartru oou4teenio3tlsfm el( s t0altnmoctodlatelu ilt0texr(mpoy1altnlfcs t)srra(m ;t1alto f3tls s2rmu s;u4 etrxr3oy1lm r i ils  rxoir3io4opt lnci t a2urxmont1oeeniiciyslaDuanmonu4aexnmf ootfaD lnvi;t)srxrirpny1op n fci ()srumxr oo1tet  oeiatls rmu s;u) lxrmrciatoat  ieol( sexmim no4apenmies t aDrrxrpot0apto o3iyslmDuluvo t)alxomr3iatfa e uei;s0 rtrxm nodolee fcslsfaDtmxm ou0aeeo iciyslsDrauvs;(0 exomo iydlmDraieo s0sexm(o3oo1am nlnes ()a2raxm ;o0oexnmi3iydfs rmumpn()alermocto1fatr ieolt0 exmir3oo4opte fciasf rrrxmoot4tle iiciydfm ea( s;u0trtomf3ia1fmt aivo;s0trxr(o iy4lm nlncils)s2raxm ;o1teeomietltlm eln sn(0altrxf oytfpteauvi s  rxmir3iy1om nmncta(f 2umx pnu0oetoioctlsfm2rmump;t)alxrifciatlaDr u ols trxr(o iu1ome liciat)aDua(mpnt4teenmfetat s eln on(4trenmo3tytfmte neil( srto(r oy1lltemivs t)arrr(m ;t4oex iietldfmDrlu p t0aetnif3ia1laDraueils t2toxr oo4lmen nctlt srtmxrp;o4apxn fetytfs el( ont0 rxnxo iodfa  lneo ()trumxr no4op  mfvta( aDrmxr ot0olxn fctldla2rm(vsnt) eerir oa1fptrlnei (0trurio no4lpt  ieslt  2truro;o1oleoii3iatlm umn ont)altnircta1latrauvslt0 2umimpnydomee fci s a2tru ooo1ape  o3ild a ran p;u4alerxf iytop eln i;t0 2uo(r3iy1om  mfvs t) rua(ro;o0apeomfciys m2rmuvon(0tlermrcio1laDe nei;s teuo(r3ou1ap emfvtasf rtaxm no0apt mfciasfm elums (0tetnmo ta1laDe i o (  2xm(rpio1oltnmfct s arum(r nt1tlt mi3iydla2em( s t0 ltnxo iy1fp rlivo (0seumir3oo1apt  fetlt)srua(m nu1tltnmi3iatlsDuanvp t4texrxo3oatlp   neils sexm(r iu4ap emnvt t)sDumxrp;o0tlxnmfciyd m2uanvs t4teerir iatfa  luvo;s0 eum(o3oy1al e iei s) Durxm ou1aptomi3iyd aDem(monu)trxrmo io1fp  an i (0teum(o3nodolen icils a2urxm nt1opxomoeiatlm2elnmp t4 leomf iatfaDe uvils0s2xr(o3iu1omtemnetls artmx pnt0opt mfetyslaDea(von(0arxomo iatom   u o s t2trxr iy1alen net t)srumu  ;o0opx ii3ias m2rmn pn(4teeomr3iadlp e neo;( sexm(rpoy1lpt  icsltfsDtaurpoo0oltnmoeiytfmDuluvs;u0 exomr todfm r ueo;( texr(r ny4oleelics ( arrr( ono0aetomf3iydla2elnvp;u)artrio3to1latelivilt) exo(opiudapte iei (f rrmx pot1altnio3tatfmDemn s u4tlxnxo3oydoaD  uvs;s  exrxm3oo1ap  lnetl()arrr(r no1oltoif3iltfm uln s u0altrxfcoo1lmD aivi (0 euoxmpoy1lpee iesl(faDtaxmo;u4oltnmocild m2em(ms;(4aeerio ty1lp rliei;s  2xrirpnu1omen iviltf rrmxroot1apxnmfetlsls rluvo u0trxoxo3tydfa rlneo;() 2urxm3io4op elfes (  rta(ronu4olx mi3iytls uluvs;(4 rtrmr io1fm r ieo ()trxrio nudomt mfcil(fs2tru p;o4alx mi3tat s uluvpn(4trxrmfciotfm elieil( sruoim3ou4llt lici tfaDumur ou0oex mfciatlaDem( snt4arxnir totfpDeanes;t)srtm(mpiydalen ncil()a2umum ot0aet mociytlmDul( o u0 lxnmrcoatfa  ai i;s)tetoxm3ou4aptemnvi sfs2urxmo;u0ale ifctasfmDeaump;u0tlerif oa1fptelueilt) rxoimpoudopen fcia(f 2uaurpno1ope  fciyd s em(vpnu0arenxrcoydlptrlnei;(  ruo(m3oodlme  ivi (faDrr(roou4aex  fciytfsDran o;(4teenxf tytlpDrlu s;(0s2uoxo nodal nlivsas) 2umu ooo1ole ii3tlsfs2rm(vp (4aetrmr iydoaD aivil() rtm(rpiydlltnlfvsasfaDtru  nu4tlxo oetlsla rm( p t)texnmrctotfa e uesl(0 eum(rpnydalee icils srumxmonu0opto octlsls el( s u4alxrxr3oadla eauvi t)t2uo(rpio1ope  fcs s  2tru pou4tlxomociysla elnmo t4 lenif iytfa rai s (  eurxo3nu1ameelfes t) ruau  no4aleoiieildlaDelnmsnt) etrio oydlmt lueol(0truoirpno1apenmieia()aDrmumpoo4tlxo f3iydlmDrmump;(4arxrxr3totlmD anvi;( seto(m3oydapee ivta(f Dtaxrpoo4teenmf3iltlsDrlnvs;(0teerio tytlmDranes;t srumxo3io1lpenmfvias)sDtm(mpou1aetnifeiltlaDeanmpnu)tltrio totfmt ai s;t0t2uoio iy1lptemnvs tf rtmuro;o0tpt iociyt mDul(vo;t0texnxf ta1op e neil(0 2xmim nudopeelfetatf 2taxmpoo4apxo icildlsDum( p (0trxrircta1fat lueo t) ruo(r no1am e nvtat) 2tr(m ;o1tptoifctydls2umnvsn(4tetnio oydfmD  nvol(0 etoio3nudlpe  ivi tfsrrm(r no1olxoioeiadfs2rm(vo (0aleomocoytlmt auvolt srxo(mpno1openlnctl()artm( o;o0optn oeiaslm ul(vo;u)treoxo3ty1oa rlueol( s2trxopnydlltemneta()srrrxrpnt4apt  o3iysfa2ulnvon(4altnmrciodop r ueol()sruo(m oy1am elivsls)aDua(mpou4opxo iciytfmDuan o (4 eenmocoydlaD  iesls)teuoim3io4apeemicsa(fsDurxmpou1tpxnif3ildfa2um(vont) exoir ootfat auvs s0s2to(mpoo4ale mncsas) Dra(m no1opx  iciltfa ea(vp t)trenioctydlpDe uesls0s2urxo oydole  fcta() Dur(rpno0tlt mociytls2rm(ms t4texrmfctytfaDr neo s  etmxm iy4optelnvtlt a2trumoot0aetoif3tadla emnmp;(4areomocty1faDraueo;s)s2xrxo3iy1amt micslt)srta(  oo1tleniieilslsDemnmp;t4 exnif3oadfmD  n o;s0 eurir ny4ame lieiasfs2um(r ou4aleo ieiytlm eanvsn() rxoxf3ty1lmDr i s;s0 euo(o3iu1ol   nei tf rua(m oo1teto ociat s el( sn()aexnir tydoaDe i s (0s2to(r3oy1ap  lneil()sDtmu p;u4tpeoiictlsfaDua( o (0aetnxrciy1oa elu s;t s2uoirpoydll   fcslt)aDtm(mp;t1tlxniocildlaDuaums;u)tetniocia1lpD auvi;s tetr(r oydop emfcsl(  ruru  no4apeomfctydls rl(mo t0trenxrcoydfmDe ivs;s)srxr(r3nodopt  ncslt s2rm(rpno0oet ii3tasls um(mo u)altrifctotopDrlivilt)sexo(o3io4ll e ncsl( srrmx  ot0texoiociyslm2umuvon(4tetrxo ta1faDr u i ( teuoir ou1lmt  fcilsf Dta(mono4tpxnii3iatls el(vsnt)alxnir iotfptrliei s) 2xr(mpno1op   neias) Dtr( pno0tpenmo3iasfa2rl(mpnu0aetrirciatoa rlieo;s0 rtrir iy1opee iesat aDtrumooo0optn ieiasla eanmp;(4tlxomf iy1lpDe nvi;t0sruoirpoy1lptnlfvs t  Durx pno0opxn ieiadlmDulnvs u4 ltnir3oydlaD aieil(  rxrxm3nydomte fctlt) 2trx pnt0tleo oeild m umuvo t)aleomf3tadlmDeanvi () etmxrpoo1aleelfvta(f rumum nt0ape  octad m2rmumo (0 eenio oatlpt  ues s srtoim3nudlpt mnctlt) 2tmxmpnt4tpx mocild m elnms u)aetrmrcoytfpD  u sls0 exr(o3nu1ll nmnviltfa2rm(mo;o4open feiysfs umnmp;u4aeenifctydfpt au s;s)sexmxm3iy4om nlietls)a2rr(m ;u0olto fetas m2eauvsn(4arenxrctydop eluvo t seumxm3ny4llt mfesas a2rr(  nt1tlx  oetyd s2rau snt)aetoxrcoadoa elivilt)tetr(opiu4lp  mivsas artmuroot0aptnmietat m2ran onu4aeenxfcoo1lm  liesl(0setoiopoo4lmtn iviat aruax o;t1tlx ifctysfmDul( snt4aexrxr tadlmtr n i s)t2umxr ou4lltnlneslt arur(  oo1apx iieiys sDulu p;t)texnxfciy1fp  an o (  etrir oo4oltn net s artmu  nu4tleo i3tls aDeln on()arxnxocio1fmt ln i;s  2xo(opno4amee net sf Drmxr oo1ape iociasfa2emn pnu4altnxocoatomtelivo;t0srtoxr3nydlleemfei s  2rmur no1aptn octydlmDuanmonu0aexnxr3ty1oa  auvi (0 2xrxm iu4aptnlicil()sDtrxm no4altnif3tlsla ean o;t4altoir oadla r ueo;(0 eumiopoo1omeelnvt (fa2rau p;t4aexomi3iltla ra( s (0 ltoif3tydfpteaieols)tetrir3nodll emnvt s  rumurpno4tpeoifeildfa el(msnu0 rerxrcta1opt aueslt) ruoxm3iodlmenlivs ( sDumxmpoo0oet mocilslsDrluvp;(4 rtrmr3iydlpt li s;t0t2tr(mpiu4am e ictlt)sruaxmo;o1ope mfetat aDulnms;u)trerxfctadopD aneols) 2xrxr3iy1op n fetlsfs2raur nt0tlt  ociad m rluvs (4aexnir3iadlp  auvolt trurxm oodame mnetlsfa2ua(mpoo4aetomoctatfmDrluvonu0artoxociytlmDr nvo t) eurxr3nu1aleelfetatfsDumur oo4teto i3iatfmDem( s u) eeoxocto1fpD  neols0 2tmxo oudole  neiasfsrrrx  oo4tpeoifciat sDraums u0artoif tadfmDr nvo;t  ruo(r3ou1olee fcs tfaruru onu0ole mi3tydfsDem( s;t0tetrifcoadlp rln o;s  2um(m ny1amenlivi tfs2rr(r ot1apt mociltlaDrmu p;t0tltrxfcoydfate u olt)srxmxrpoydamt  fvt sfs2tr(roou0alxnmfeiydlmDum(mo;u4tlermo3totopDe u ols)s2xoir3ny4ll n nvsat) Drr(mpno4texn fctldlaDrauvs u0arxoioctydlptraueols texm(o oy4ome lietls)s2raxr ;o1tlxo f3iatls2emumo;t) lenmo3oytlaDeai ilt  rtrio iu4llen ieslsfaDrrump;u0alxnmiciasfs2umn pnu0 renio3todoptean s;s0s2uriopiy1op elfetlt) rrru  nt1tptomoetadfa2rmu o;t4 rxrxf oatlaD aivi t setoxr iudlltnlici t)sDua( o;u4teto o3iydfs em( s (4aexrmr3ta1fmt auvs;s s2xmxr iu4ol elictat s2uaurpnu4aetoioeilsfaDum(vp;t)tetomoctydlaD lues;s s2to(o nudape licsl(fsDtrx pno0aexo fetyslaDemnvp t4aetnioctadfm eauvs;s)sexoxrpnu1al  lies t)s2ua(  nt1alx  ietat m2umu s;t4alxoir iytopD luvs;t0 euo(rpoodoptemictas  Dum(root1oetomoetadfa ulums t0trtriocty1lpDr nvs;s) 2uoxm3no1apt mfeias)aDua(mo;t0tlxoifetlsfsDelnmpn(0alxoxo3ty1fpD  nvi s  exrxm3iudlp n ici t)sDtmurpno1oetnmoctydlsDel(vsnt)altnif3tatlpt ln sl() euoxrpiy4amte fcs s s2ta(rpnu4tpeo fciydfa2rlump ()aexomr to1lptran o t srtm(r iy4lpeelfvilt  rrmx  ;o1aetniieiatfmDum( s;u4 lxrxociytlp rlnvs;(0 2xoxo nu4lpenmivta( s2ua(mo;u0tpx ioctlslm2ra(vo;t4trxrxocta1fa elu o;t)seumxr io4lpeelivt t a2tru  ;t1teenifciytlm rau s (4tetrmocio1la rai i;s)t2xm(r3nudameelfvi sfsDtmx pnt1tlxoif3iadls em(vp u0 lxrif oo1fptraueo;t)trtoio3oudapt  ivsl(f Drrx pnu4tetomictadfmDrau o t4 eeoir3totlp  liei ()trtmxm iy1llenmnvt ( a2rm(mpot0alxoifciysfs el( s u)altrif3totfp r nvi t trurio3iu4amtemnvsl(faDua(r oo4aleo f3ilsfmDuauvo (0arenio ia1lp  au ils  exmir nu4lm e fvs (fs2uaxr nt4tlen ociltfm2rmuvs;t4 eerir iodlpDe nesl(0s2uoxmpiodop   iei t srum( ooo1tpe  o3iytfm2ea(vp;(0 eerxr3iy1lp e uvolt texrirpiy4al e nvtl( a2raum oo4olxomoeiltlaDua(vpnt4trxnir io1oatrlu o;t0 2uo(mpiy4ll elfet s sDtauront4ape io3iltla uanvonu)alxoxfctydlmtelivslt truoimpiu1optemfvta( s2um(m ;u0oeeo f3ilsfaDra( s u4arxrir3oo1op rluvsls)trxr(m3iu4ll  lictls)sDrru  ;t0oet iociydla2elnvs t0trermr3iadfmtr n o;t setrxopoydomtn nei t)s2uaumonu0texnmo3tlslsDranvp;(0tlxomf3to1omDr ivo;(0 eur(o3no4lmteliet s)sDumum no1oetomo3iatls el(vp t)alenmrciatlatrlivs s srxrio3oo4olenmivtl()srumu p;o0oetomo3tlsls2eluvp;t4trxrmf oo1fp ranei t t2ur(r oo1lltelietasfa2raump;u1olt ii3ilslm2ulnms (4tltrxr oo1omD anes;s setmir3io4al nlivtltf 2tru oou1olt io3iyslaDraump u0 rtnifciadfmte ueo ( srtoxr iu1omtnmfeils)a2raum ou1aeenifciltla2elu p;u0 renxo oytfpte uvsls srtrio nydoltnlneias) Drmumoou4alt ioeiad a2ua( on(0tetnmocoydoa e nes t trxmio3nudlmtnlicias arra( pno4apto oeildfmDel(mo;u) rtoxociotop rli s;t truoxo3iu4apenlnet s  rrru  oo4optomfetadlmDrmnms;(0 reoio oodfaD ai o;s)t2ur(m3iu1opeemivi () Drmx pot1oeeomf3iaslmDulnmp;u0teenirciy1la eln s s0trtoxo no1lpeelieslt a2tmxm ou0tltnioetat m2elumsnu0aeeriociy1omDe i o t)texoim io4oltelfet s)arrrxmpot0tpe  ociydlaDuanvsnu0teenmf3ty1lpDe ivs ( t2trim3iodap emneils srua(root4apt mfeiadla2emums;t)tltoxr3ia1oaDrlu o (  eurim nudal  mncs ( artm(mp;t0oee  o3iydfaDrlnvp (4tleoio oo1la rai sl() 2uo(m iodole mnvtls)a2trxroot4tlx mo3tasfm2umu p t4treomfcoa1op eaues;s) rtoir ny4opte feslt arur(rpnt1texn ocild a2umn o;() rtrmocoadoa ean sl( seum(rpou1lltnmfes (f rtaxmono0alt iiciys m ranvsnu)altnxf3oo1lpD  nvs;( srxoir3nu4op   nvtas) Draxrp;t1optoif3ildfm ra(vp u)tlerirciodfaDeai ils  2urxrpoudop elfvsl(fsDra(rp;o1olxo f3ild a2ean s;t0trtoxf iotlptr n s ()s2xr(r nodape lfcs s  2taumooo0olenif3ildlm rl( p (4artnir ia1oateaueo t srxo(m3iydol e nvsl()aDrrx pnt4oltomfciys sDuauvont0 etoxr3ta1faDrauvsl( t2xrxo nudlpe mfcsl( s2ur(mpoo4tpxoii3ildfm2ea( s u4arxnmo iadoateln i;s teurxmpno1lm nmieiat aDtmu p;o1aptnmfeildfa umnmsn(0aeenmf tytlmDeauvi s0 2xmxo ou4ap e ietasfa2tr(mp;t1aetnifciasfs ranvo (0aleoif iydfp elu s () rurxo3no4lmeelici s)sDur(moot4altoifctytlm ranmonu4aeermo3ty1omtelnvils)t2xmiopoy1amt mncsas) ruru  ;o1oleomfeiys a2rl(vsnu4 lxnxo3ty1laDr n o;() exmxo3oodop n ieiltf Dua(mooo1tlxo i3tldfa rau s;()aexnxo iotfmD luvols0seuoirpoy4om   ictas)aDum( pnu0oeeo oeilt s2raumsnu0tleomo3iotlp  ln ils0 2tmxr3ou1al e ivsat s2trur ;t4alxomi3tyd a rm( s;t0aeenir iydoaDranei (0 2uoxrpio4lm  lict ()aDur(ro;t0apxn fciatfmDra(vo;t4 lxrmr oydopt lnesls) 2umio ny1lleemietl(fsrtax  nu1olxomocils a2umn o;(0 rerxoctatop   ueils0tetmxopio1al n icsltfsrtaumonu1ale  fciytfs rmnvp;(4 etriocty1fpte ivs;s s2tmim3no1lp emnvils  Durxro;o4oeenio3tldfs2ea( snt0alxoxrctodfa rlueol( t2tm(opnydlmtnlnvs ( aDtmuronu4oex iociydfs em(mo;u4altoxr iadopD lnvs s) rtmxopny4lpenmncs () 2umxroot4optnif3iat a emnmpnt) rtomfcta1fpD luvs (0s2xrxopny4ole micta()aruaxrpno4tee  ociytlsDuaumon()tlxrxo oytoatrlnvo ( s2xo(opiu4alen fcs t srurx  ot4tptn oeiaslm2rm( s;u)tlxoxr3oo1la  lueo s)tetm(mpny1ole lnet t s2urxmo;o0oeeomfciltlsDem(von() eeoirctydoat au s;t0 2tmxrpio4ole  ivsl(fa2ta(mpoo1optn oetad m2eanvp;u0 lxnmf iotomtrlnvs;t) rurxopoy1al  liet s  2tm(r ;o0openmo3iat m em(mont)aeeoiociytfmDrlnvs s trxo(r3oodomtelfetltfa2umxrp;t0olxnmi3tys a umnms;(0areoxr iotlatraivils0 eurio3oydapenlivtlt  rtm( o;u4tpeoiiciadfs2rmn sn() lerir3tydoa e i ilt0 ruoxr3nu1lpenmivi (f 2ua( ono0tpxoiieiydlm emnvp t0aeeoio tydlmDrlnes t0srxoxmpnu4lpenlnesat) Dtm( pno0oltomo3tadfm2ul( pn(0aetrmf3oa1omD ai s;s0tetr(r3iy1op emfeslt)sDurumpnu4alt iociad mDum(mpn(4tltnmr3iy1lmt lnvs ( t2to(r oy1oltnlfes s) rumump;o1olto ictyt mDea(vo ()arxomr oytomDrlnes;(0 2xrxo no4apeemiesl( artaurpot1alen f3ilsfmDel(mp;t4altriocio1opDr neo s)t2xoxo no1openmfeta(faDtaxrp;u0aee  f3iyd m2ra(ms (4arxnmrctodoatrln sl(0sexoxo nu1al emnei s) 2umxr no0ale  o3tatfm2rl( o;t0alxrmrcio1lm   n o s0s2xrirpny1apt  icslt a2ur( onu0oeto oeiad s uanmon(0trenmo oo1fm rlues () 2trxo iodalen ivslt  Dumurp;o0tpe  i3iys m2elumont0 etnxr3ta1latrlneols)t2triopoo1lltnmnei tf rtr(moot1alxoiieiytlm ulnvonu0areoir3tatlpDr nvs (  rxoim3oo1lptelfvslt aDumxmooo0oex ifcils sDelu o;t4aetoxr3oatlpDeln i;s) 2trir3io1lpt lfvsltfa2rrumo;t1tlxoii3iydlaDua(mp (4 eermo iatoptelueo;(0srur(r nodopen ivia()a2rmxr nt0tlxniiciltfm umumo ()arxoxf3iytfm raues;t0 exm(r iy1olen fvil( srrrum ot0tleo fcilt s ra( p;u4altomrcoytfmDeaneilt)s2tm(m iy1am nmnct t)sDraur ot1tlenii3ilslsDum(vp;u0trenmo3tytlp   i s (0 euo(r3iu1ope  ivsl() Draxmono1texoio3tls m rl(mp (4 lxomr3iadfpDraueo;s) rxmirpno1optelfesat)a2rr( p;u1aetnioctltlmDea( s;u0artrif3todlaD lnvi;(  exrio3ny1apenmicslsf 2tmu onu1texo ieiysla eanmp u4trtnmf tadfa eaivo;s0s2trxo iydolt mivtl() Dum(m ;u4texomoctys mDua( pn(4 etomocoodfpt lieilt)srtrxmpiodamt  fctasfarrmx  nt4tlx ii3tlt mDrmnmp;t) eerxr3oatlp  aieils0t2to(r iudol n ict sfarraxmp;o1alto feiadfaDraumsnu)artrmo3ootfpt  ueo s t2uo(m nu4lpt  nvsls  Drmu  ou1tpen o3iltlm2umnvsnu)tlxrir3tydfa  liei s  2trir3ny1aptnlicia(fsDrruroot0opx  icils aDumn s;t0trxrmf3iodom  lnes t)srtmim3io4ll  mici s) Draur no1optniiciatfs uaumsn()tetomr3oydlpD  ieilt) rurxopiudlltnmfeil()s2umxronu4opxnifeiydfs2emums;u) ltrmo3oydfatelneilt)srxmxrpnu1oltnlivsltf 2ta( pot4alxniieilsla eauvp;u4 leoio ta1faDraivo;s)seuoir iydam nmnesl(fa2tm(mpno1openmf3iaslm ua( p;u4artrxo io1optelneolt)s2ur(m3oo4opeemncias)arta(r oo0opeoii3tlsls ean snt0 ltnif3iodlptr i o;s0trxoio3oy4aptn nvsa(fs2ra(r ot1tpxnio3ildfaDuluvs;u4aeenircoa1oa   ues;t0s2ur(opiudll e fcslt) 2ua(m ;u0optomi3iydlsDrm(vo;t0altnif3tatfaD  nes s)srxo(rpnudapenmfvilt) Dta(r no0olen ieias sDranms;t)trtrmo3oa1lmDrlu o t) eumxo3oy1om e ies t  2urxr ;t0tpen o3ilsfaDel(mon(4 exrio iotop r n i;t0 rurimpnu1lmen nctl(fa2tmxroou1alenmfciasla2umu p;(4alenioctodfaDe nvi;(0t2xr(m nydoltemnetl(f 2tmur ;u0apxomfeiad mDeluvp;u)texnmr3io1fa ean olt trum(m3nydam   fvia()aDtru ono4tetomo3ildlm2rmu p;u0 rtomr3oadfpDe nvs ()trxmio3nu4ap elncslt sruau  ot0oltoiociatfsDumn on(4tetrio3oydlateli o;t) eto(r nu4ol n fctat)s2uau  nu4aex if3tyslm2ua( pnt) etnxrciy1lm rlues;(0srurimpiu1opte feslsf rra(ront1tle  oeiyslsDuanmp t0 rtnif3oatlat livilt0tetmxrpnudapenlivs tfs2tmu pnu0ale ii3iydfa2elnms;u4arermr3tadlmD auvol( trtr(r ny1oltn ivt ()aDrr(r ;t4alenmi3ilsfa umump;(0tltoiociy1opte neo (0sruo(o iu4llen net s s2ra(mpou0aetomf3iysfs2rmumo u0 reomf iodfa r neil(0srxoxrpno1am   fesat) Drmx  ;o1oexnmfetydfa rmu ont4 rxrir tydlm eluvils)srurxo io1olt lfvsa()aDtrxr no0tpxomociatlmDra(mp;(4 rtnmr iodfp r uvsls0 2xrxr3iy4op  lfvia()s2uau  ;u1tlxniieilsfs ea(mp (4 etnxf iodoatr ivo;(0 ruoxr3nudam emiei (fsrumum ot1tlenio3iydlm uluvp;(4altoif iotfmteauvs t0sexrxm3iu1ome lnesat sDumu ooo1tleoioetydfaDrauvs;t0 rxrxr oa1lpteaiei t t2uoir nodlltelncs tfartru pou0aptniociyd sDelnmp t0 ltrifcoadlate n i t0 rtrxm3nudamenlfci ( aDra(mp;o0olx  o3ilt s2ul(vo;t0aeerxr ia1fat  uvi t)seuoxmpoodll   ivta(f 2taxr nu0opx  i3iatlaDul( pnt)alxnxoctydom rauvi;s0trtoio3nydameemfet t) 2tr(monu4alt if3tltla um(msnt4texoio3iodlm e uei t trxr(r iudlm   fesl() Dra(  ;o0tlxn oeildls2rluvont0trxrxr io1fmDelneols0srtoxmpiydalen icslt)aDraxrp;u0opx mfctasfaDea( s;(0 ltoxr3oo1fpD ln olt0s2uoxo oo4lmeelicsas) rrrxront0opxoif3iadfaDemnvpnt0alxnmociatfmDeau sls  2toxr3iodap   ici s) Dtm( pnt1aetoiictadls2ra(vo t)arxniociydlaDr nvo;()s2toim3oy1llenlfei t)s2trx poo4tlxnifcils m2rmnmo;t4 rxnmf3iotlmte ueo s t2uo(r3no1ol nmivt t) rtmurp;t1oexo ieild sDelnmp;u) lxoiocoa1late i o;s0 euoxm3nydal  lncta()s2tm(ro;u4tet iiciysls2rl( o;(0 etrio3oodoa  lies (0sruo(rpiydlp n fvs ( artmu  oo0oee mociyt s2elu ont4alenmfctotlp rln s;t0teumxr iu4opt mivt t srrr(rp;o4apt  icildlsDrmn s t4arerxo iytfptrau i;s)tetoim io4lmtn fesasfarta( ont0texnmf3iasfm ul( o u0 etr
\ No newline at end of file
@@ -0,0 +1 @@
+ueol( tetrxmpnudoleelnvt ()a2um( o;u4teen ocildlmDrmu sn()trenifcoadlp  lnvi;(0seur(mpoydome mfci tfarrruro;t0altnmoctlsfaDemuvo;u4arxrxrctatfmteauvo (  rxoxrpoudal  lnvs t arrr(mpot0tpeoifeilt aDeaumo;u) exnmo totfpD an o s tetrim iu4apee ictltfs2tau ooo0openmfcias mDel(mp;u4trtnxf io1fpD lies;(0 exrxr3iudlpt  nvtls sDrr( pnu0oet mo3iasfsDean pn(4 eenmoctytfptrauvo;t)trxr(r3oo1omeelfvi (fsrrmx pnu0ole iiciadfm uauvont)tetrif3oa1oaDr ueo s s2xmxrpno4llenmfvias) rtr(  nt4olx mfeiytlaDrln s;u4arxnxo3to1la ran o t  2xmxo no1al  mieil()arrrx pnu4olxo iciysfa2em(mon(0tetrmf3oydopt  ueslt0teuoim3ny1omee nesatf rta( o;u0oex mocilt sDum(ms;t)trtoxfcoodfp eaivi s)trxmxr3io4lm elnvtat)aDumumpno0apxoiietadlm eanvs;()arxnxo ia1fa  au s;s0 rxo(m ny1ome lfet (fs2rrxm oo4aptnmfciadfm ul(vo;t4tlermf ia1fm   nvs t)trurxr3nu1ol  mivsl(fa2tr(mpou4oetn ieiytlaDelnmp;u)teerir3tydlp eli s ( t2xrxrpiodoltemfesa(  Duaurpoo1olx mi3iydls em(mpnt4teerxo3oo1lp r uvi s0tetrxrpio4aptemivsa( srrrumoou1oetn fctys m2rmnmo;t)trxrioctatlm elnei;(0trtoxmpoo1lme  icsat) 2rr( onu0aee iictlt a ulnvp u0aeeoxr iatoa eluei s0 rxoirpiy4op emivt t)a2trxront1oltnmf3iaslmDrl(vpn(0areoircio1la eauvo t0 etrxr3iy4ap  micsa( sDra( ont1tpeniicilt a2el(vsn()alerxr3oodoaD anvsl() rxo(m iydopt lnviat aDrrum no0tptoiictadfmDran o;t0tltoiocoadom   i s t0 2xmxm3iu1ap e ncslt sDtrxmp;u4texnif3ilslm2ulnms;(0artnir3tydopt  n s (0 2xrxmpnydape lnvtat)sDua(mpou1alx  f3tadlm2em(vs (0alxoxrctytom rli i;t0 ruoio io4altelictasfsDra(ront4ale  f3ilslsDemn o;u0 eermr oytfp   iei ()texmxopnydopenmfci ()aDumxrono4oet mo3iat a ea( pnt0altrxo3oa1optr ivol( trxr(r3io4aptnlneia()sDuau  nt4aexoiiciltfaDum(vs u4alenifcoa1fmteln s;(0s2xr(rpoo1oleemnes tfarrau pot4ale ioeiadfa2ra(vo;u)tleoio oo1faDeli o;s)tetriopiu1optemnvtlt  2ra(ro;t0olxnifetysls rmn p;t)artrmrcta1lpt lneolt trumxopnudol e nes sf 2rmxmpnu1aee  oetldlm umums;t0aleomo todlat  u o;s  2um(o3nu1al e fvia(f Dtaxr oo0tee mictlsfs2rlnvp ()tlxrxr3oy1laDean slt0sexr(m io1am  mnvs s a2ua(  nt1tltn ociat m2rmu on()texrxfcia1lmD lu o (0srumim3ou4ap nlics ( aDrruro;t1oet  f3ildla rmuvpnt4areomo to1lmte ues;t srumimpnudoltnlneiat aDtau ooo4aetomieiyd aDel(vpn(0aetnxrctatlaD lu o () eto(mpnydale  nvsl(fa2raxrpnt1tltnifeiltfmDum(ms;u0 ltnif3todfmteaivs;(0seur(r3nodam e nviat sDuax  ;u4olt mictaslaDea(mpnu4arxnxocty1faD aivsl(0seur(rpoodlleemncsa( aDtrumont1alxoif3iys m ranvo;()texnmr3iy1lpD  u s (  rxmxr3iydolenmfviat aDtaxrp;o0tet mfciatlmDrau s ()altnmr3iotlm e nvi;s t2urxm ny1omt mfvia()artru  ;t4aex  ocilt s ea(mp u4trxrmo oydfpDrlnvs t sexr(o ny1alt mnvilt) rrrumpoo1aexn oeiyslsDrau o t) rtoio tytla  auvils0sruoxrpnu4lmt  ictltfsrraurp;u1alt iiciltlmDea( pn(0trtomr iodfpt  nvi s srum(m3iy1ll nlnvs sfs2ra( ooo4oleoifciadfaDumumpnu0texoxocty1fateaueolt0 2toxr3ou4alt mfes sfarra( pot4aleoif3tldlmDumums;() leoxo oy1oaDr i s;t)truoio3iodlmee netlt aruaur ot1tpxnioctyd a umumo;u4 lermo3iadop ranes s0 ruoxopiudap  mietas sDtaum ;t0oetn oeiys m emn pn(4tlenmocoa1fpD  nei;()t2xr(o3ny1ol nmieslt)aDrr(mont0ole mi3iysla2emn pnu0 exoircta1lpDelnei;s trxo(o iy1llee icta(f Durx  nt4ale  f3ilslmDrluvon(4aeenmf iotlpt  u s () 2xoim oudll n nvtl(  rrmu pou1oexoifciad a2eaums;()trtrif oa1om e neo s0 rtrxm3nydaptnlictatfs2rmx  ;u0aeeomfciytfa ran o (0altniociydop  liei;s  2uo(r3oydomeemnctl(f 2urxrpnu1tlx iieiltla rmuvp t0trtomocoy1oaDrlnvo;()t2trimpnu4ap elfcsat)srrrxrpou1oet mo3ils a2uanmonu4trxrioctatlaDr n i s0 rtrxo3ny1omte iciat) Durx ono0oeeo oetls s emumsnt) lxnio3io1oa e nesl() 2urir3nydlpe  nci t  rumx ono0tleo ieiaslmDuaumpnu4tltoif tadopDean il(0teurio io1lm nmfct s) 2trxm no1teenmo3tat s eauvon(4 renmr3oo1faD lu s;s) rumxr no4aptelivsl( s2raurpoo4tptn oetlsfsDua(msnt) exomfciy1fm  lneo s  etr(r3ou1ll elieias  rtru pnt4texn fctat s eau s t0alxnmo totoat aieslt  2xrxo iu1lme  ietasf rtaurpot4oltn f3ilslsDeau p t) rtnif3ta1fptr ivs;t0seuriopny1lpeelfesat arrrx  no4tpxomoeilsls rlu o;u0 exrxo3io1oatr uvs (0truoxopoy1opeemnvt s  2tmu  ;t1aexnmo3iasla2um( pn()tetoifctydlmt aivi (0texr(opoo1lle  ict t)a2uaumoot0oltn fciatfm2rm( sn(4altnxf3iydoa elnvols0texm(r nudop emfvtlsf 2ra(mpnu0olt mf3iytla2rluvpnt4 eeoio iotomte neils)tetmir iy1optn nci ()s2ra(r ;u1aexnmieilsfaDel(ms;u4trtrif3oodop elieil(  etoxm nu1am elivias a2tmu  ou0tltoif3iyt sDrlu p;(0aeermr tytlpDrlnvi (0 rtmio3oy1ll emivi () Drrurpot0tex miciad a ulumsnu) rxrmrcia1opt aiesl(0t2tm(mpnodlltn ieia()arrrxrpou1oee  fctydfa2ra(mp t)texoxo oatlate neo;t) exmim3oo1op  mfct (f rrau  ot0aexo oetys mDulnmsn()aeerif oadlmDelnvil()srurxr3oy1llt lfciasfsDtmuronu0tet mfciadfaDrl(vp;(0aeeoxo iadfat anvi t0srtrxrpoy1al n ncsat  Dumurp;o1ope  feiadfs umu on()tltrmf ta1lat li o t)s2uoir iodlp nmietat artaxmp;u0tleoifeilt mDuanmpn(0 lxnxf iy1lmDr nei t  etrxo3iydalenlicta() rur(m nt4oeeoiietydfm2umuvs;t)texoxrciotfaDe n ol()t2tm(opoo4lpee net tf 2umxroot4tee  f3iydfa2eluvonu) exnxf3tytlaDelnvo s0s2umxm nydlmee ici ()s2rmurpoo1opt mo3iyd s2ra(mp;t0trtoiocoytoaDeli i;(0t2trir3iu4ol   neiasfsDuaxrpoo1tlt iicilsfs rauvp;u4 exrxo3iytfmDelues;s s2toio3nydomtemiei s)a2tm(mp;t1aptnmfcias mDrm( snu)trermo3ia1fm  luvs;t0trxrxrpiy4ll elfesas  Drruront0teeo feiysfsDran o (4tlxnxociodlateluvols0trxoim iodom   neilt)a2ua( p;o0tlxn i3iydlm emn o t4 rtniociotoa  lueslt0t2xo(rpio4ap emiei ( aDrr(rpoo1tleoio3tytlsDel( o (4 lenif3iodopD lnes ()teumir iodopeelnvsl(fsDra(r oo4oeto fcils a2el( s;()tltrxr tadfa eanvs;s) 2xoim3oo4ll e fvtlsfsDtmumont0oex  oeiys aDel( p;t4aexnxf oa1fpteau ol(  2xmir3ou1am   icsls  Dua(mpno4aex mfeiydfm2ran o (4arerxr io1fpD li s s0trtrxopoodame mfcias srrmx ooo4tpxnmociys mDra(mo t4texrmf3iodla   uei;s0truoim no4oleemncta(faDurxrpnt1opxomi3tasls2elnvo;u4 leoxfctydomDe u sl()t2uoxm iu4lm n fci s sDur(m ;t1olto fciyd a rlumpnt4texoxociytopteaueils) etm(m iudop nlicsat  2urxr ;t0tltomociad m2uluvs;t)aeenxr todoa rlneo;t trto(m oy1op nlneilt  2rmxrp;o0tleoifcilsfmDuaumpnt4aeermo3ty1opteaivils0setrirpiy4lp nmfvsltfsrtr(m ;u1oexniictyd s2el(vs;(4 ltrmo todoa eluvi s)trxrxr3nu4lmenliet (f rtr(rpou1tlen ieiadfsDranmpn(4tlermr3todlat ai sls)sexmxm3iu4al  lnvi sfs2rmxronu0texnioeiys sDeauvs (0trxrmr tadla r ueo;() eumim3iy4apen ncil()a2urumonu1alt  o3tydla2ra( o;(4altnmf3iatlpt livi ()srxoim iodop   fvi () rtmx oou4tpxn feiytla uanvp u) etnmfcoadfm eli olt  2xoimpoy4lp  mnetltf Dtmu o;o1aex  o3tyd aDeau onu)altrxrcoa1oaDrlivi s) 2urxr iu1ol eliet s)a2umxrpno1alx mf3iat a uanvp;u0altomf3tytlmD  nvols)s2um(rpnodlmeelivsat) Dur(rono0oexnio3tydlm em(mo;u)alxrmfctatlptr nvols0 rxoxm iy1ap   neilt)srtaxrooo4oleo ieiadfmDem(mp;u4trenif3oa1lpDr ueil() rxoxo3iu4op e fesa()a2umxmont1aexomiciltfaDra(mpnu)arxrxo iadoatr ivilt0t2xrio ou1lle mnvtlsfaDtmxm ou4aetnmf3tld aDua( o u0 rxoxfcoo1om  aivolt)truo(rpiydopenlneilsf Drmumo;o4ope mf3tys m2ulu p;u0 eeomrcia1la r nvi t0 eur(m ou1al  lieta( artrumoot1oltoiieiad a el( s u)teeoxo3iydom e nei t  2xr(m iy4ole lnctat srrmx poo1oex moeiadfs uaums u) lerio oatomDeaivi s seumxopiu1omtemici t) 2ua(r oo4alx ii3iat m uln s (4 lerxfciydomteai il() etrio iy1lm  mietlt a2ta(rp;t1opt io3iysla emuvo u4arxrir tadoaDelu o;s srxr(mpiy4lpeelnciatfarumuro;u4aex moeiltla umnmp;t) lxrxo3iy1lpDeauvi;s teumxr3io4lp  miesa()arurxrp;t1opx if3tas sDean p u0aetrxrctatla e ivols) exoirpio1al  mnvsl(f 2rmurpot4opt  o3iyt aDrmu p t0aexoio ta1fa   nvo s0 rtoir3ou4lpee nes s  2umurp;o4tlen oetasfm2umu p;u4alerifcoo1la eau i () ruoxopiu1op  mfcia( s2raxmo;u1opxo o3tld m2umu p t0 etrmf3iatfm r uvols setrxo3nydopte ictas)aDrau oou0tex  ictys s2rm( p;t)trtoxf oytlpte ueils0 rumxr3ou1ope  fet t sDta(rp;u1aexo o3iadfsDemuvs;u) rtoxo3io1fm raieo t) rur(o iodol  lfetls aDum(rp;t0tee  o3iadls ra(vs;u) lxnio iadfatr n s t trurxmpoudlpe  ictlsfsrumxrooo0aetn ociadfsDelnmo t)arxrmr oadopt lueo;t0 2trxo3ou1lmeelneslsfs2uaumpno0oetnif3ilt s2el(vs t4 renmo3ia1omD lu ilt0s2uo(r3iu4lm   ictlt arrmxro;t0ole moetatfs el( s u4aexnif3tytopDr n ilt0t2xm(r io4ame  fcia( aruaxmonu4tlxniiciatlm eluvo t0trenio3oytop raieols setoxo3iodolt mivtl()artmumpno1tex  o3iatfsDrm( s;t0tltnirciadoa ran ilt0teur(rpio4aptnlfcil(fs2trum no4tex io3ias a2um( sn(0trxrif3ootlateaueil()trumxo nodol emnctls srtrxr oo4oexo iciydls2uaumpn()tlxnxf iytfa   u sl(0setoxm nudomenmfeiat)aDtaxmp;o0aeeoioeiytlmDrau snt) rermo3oodom e nei s) 2tr(mpno1llee nvs s)a2urum ;o1texoiiciytfsDel( s;(0 lxnmo tadlpte nvol()s2xrim3ou4lpeemnvs (fartaur ;o1tpen ietat aDuau pnu0trxnmfciydfm elu s;s0 2xmxo oydole mfei t)sDtmxm ;t0aex  oeiytlm uaump u) eenio3oa1lm ean slt0trur(m3ou1apee nviasfaruaxmono4oleoiieildfs uanmp t)altomo tatom rlueils  euriopnu1amte fctlsfa2rm(r nu0tlxnmoctldls emnmp;u)trenxf oa1om   nvolt)texrxm iu1om   net s srrrx pou1aptnifetyt m2uln snt0 rtnmf3oo1lmDrli i ( s2toio3nodlm elncta(f 2rm(r nu0tpeomfetldlaDranvs t4trtnmfciy1fpDranvolt  etrio iy1lptn fvtlsfsDumu  ou1olt  fcilslm rmnvonu4 etoxf3oa1lmDe u sl(0t2uoxr iodol e nvtas) rrmu  ;t1tee iieiaslmDel(mon(4 leomf3ta1fatelivils)trto(mpiudop  mnetatfa2umu oot4aexniieilsla umump;u)aexoxoctytfm elnvo;t) etr(r3ny1open icils)aDraurpno1tet mfctysla2emuvpn(4tetrmo3io1oaDeliei;t s2uoiopoo1al nmfetl()aDtax p;t0aptomoctyslaDrmuvpnt4 ltnmf oytfpteluei;()trtrio3iu1amtelneilt sDrmur oo0ope  oetld a2ul( p;(4artnmo3tadfmtrau i s)s2xo(m3no1ome lncias)a2trxmp;o0apt  i3iatfsDrm( p;(0arenioctydlpDr nvs;(0 rxr(opou4llenlfes (f 2rrxmpnu1oexomo3tyt aDrl(mo;t)tlermf ia1fmDrlu s t s2tmimpnu4omt livilsfarrmump;t4tpenifetysls rl(vp;t) lermfctodlpDeln s t0 rumio oy1ol   fvtas)s2rr(mono0alxomf3ilt sDemnmo;()alxrxr todlm e i il( srxoxr oy1alt  ietat  Dua(mp;u0alenmoetlt m uluvo;t4 eenmfciadfa rln o;s0 2xo(opoydoltelncs sf 2um(rp;t1olenmo3iysls umn pn(4 rtrmoctatlaDr nvs;s trxo(rpoy1ole mnei s) Dtax  nu4oee moeils sDumn on(0 ltoxrcoa1faDeaivs t)trum(o io4ome  ncil(fa2rmum ;u4alenmo3tadfm rlu p u4artoif3iotlpteau i;t)s2xmim oy4olen nci sfa2taum ot1oex  ictas mDea(vs;t0 rtoif3oodopt  ieo t0sexmxmpiodop  mivs (f rrrump;u1aeeo ociadfa em(ms;t4tetrxfcoydla   u ils0srxr(o3iydolte nvtlsfa2tr(rpoo1aleniociat aDelu p t0tetnmfcoytomtrluei;s s2xoxmpoodom nlfcs ()aDrmxro;u4teenifeiydfm emuvs;t4tlxoxo ty1oa eaieslt0s2xr(opoodol elieslt sDurx onu4alxnioeiytfsDrlu s;(0alenmo oydlptrln ol(0 etmio3no4aptemnesls)sDrrxmp;t4tlenmo3ilsls2eaumpn(4 lxnmrcootopD anesls texoxo3ny4ape  ict s) rrauro;t1tlx ifciat a ra(vo;() ltnxr iytfp rlneilt  ruoim nydap emivia( s2rmumono0tltoiiciyd s rlu p;t0teerio oatfptrlivils setm(rpny4lmen ietat a2ur(ro;o0teenio3ild a2ua(vp u4tltoxo3tydlat aneils  rxoio3io1lp   ieta(f 2ra(moou0ape iicilsfs rlu p (0trxniocoodfm elneo t)srurim iu4am e ict s)aDtmump;t1ape ifciltfs2ra(vpnu0tetomfcty1fa   uvilt)t2xrxopoy1olt  fei t  Drrur nt4oeeo i3iad aDua(msnu) rxrio3oo1fpt ln s;s)setmiopou4am e netasf Duaurpou0tex ii3iad a2emnmp;u)altomr oydlmD ln s s  2xoxm ou4op  mnei s  Dumurooo4opx  iciydfaDrmn p;u4 ltoif oa1lm r ies t)trxrxo3iy1lpe  fcsat)sDtau p;o0alxniiciytlsDeluvpnu)teenmocia1fp  ln o t)teur(rpou1amenmivtas  2tr( pnt0opt mocilsls eln o t)areoxo3iatlptrlnvo;t0 exr(o3iy1lm nlnetltfsrtm(rpno1tleoiieilsla uln p;(4tlxrir iadfa   i ils0srtr(m3oy1optemneiltfaDrm(m ;t4altoifeiysla2rlnmo t0artnmo todlpDrai ils)srxmxopny1opee nviasfsDumum nu1apxomfetls a2um(mo;u0 leoio tydopt  u ols0t2umxm ou1lltnmfesas a2tax  oo0tpe if3iytfm eauvpnu4aeenir todlmtr n s;t) rxoxr3nu4olen fctl()arurxm ot1tltoiiciydfmDuau o u4 lxoxr iy1op rai ols trtmxo iodape  ivs tfs2umxro;t0opxo ietyt s2rlumsnu)alxomf3todfmtr nvs;s0 exoim3no4lm  lnesas s2rmum nu4oex ifciasla ul( s;u4 reoif3oa1lmDelneo t0s2umiopiy4amenlictl(f 2umxm oo1tltomociytfaDrl(vp u) rxnmo3oy1lmtrliei s0t2xrir3io1lptnmneil() rum(mpoo4apt iocilt aDulnvo (0aexnmr3ootlaDr u s (0srtmir ny1ole  fesl(fs2rrxroot1opxoii3iaslmDum( p;()aeenmr oatfp eanvi ()t2xrio oodaleelieslt)arur(mont4optoiieiat a ean p t0texrmfcta1fa  lnes;s)t2um(rpiy1altelfetltfa2tr(rpou1aptn ietlsfa2ua(mp;u4tlerxr tatom   nvi t)seur(o io4ll  lnvtat)a2uaxro;u4alx  ieildfa2umnmpnu4aexomrcoytfmt liei t0t2xr(m3ny1lpt mnvs ( s2urxmono4oee mfeild m ul( s u) rtrxo ta1laD au o;( sexr(rpny4aptn nct s sDtaumont1optniieildlmDel(mp t) exomociatfaDr nvo s t2xrxmpou4lmtelicilt)sDrrxrpot1altn o3tas a2umnms u4 lxoxo3oatoa eai ol( sruoim3nu4olt lfvia()aDururp;t1altnifcilslm rmnvon(0alermf3ty1oa   uei t)t2xmxm3nodlm  lnvs () Duru p;t1opxn ietls sDelums;()alenircta1lmDelivs (  etmim oudom   fvtat)a2uaxro;u4teeoioetyd mDranvp;t0 eerxf oydlmtrlnes;t)setmxo3iudlmee iei t s2um(  ;t1aptomi3iltlm2eanmp (0trermr3iydlpD auvil( trtrim iy1altn nctls  2umx onu4olt  ieiasfs2eanms t0aetoir3oatfaD livs;t) 2tm(r3nu1lp  miviat)sDta( o;u1tle  feilslm ea( p;(0teerio iytfmD ln i;t0 etoir3oy1alen ncslt)sDrr(rpnu1tpe if3tas a rauvp t)aeenio iodlptr uvslt0t2ur(r io1ap e fvsl() 2urxr nt4ape  i3tld s2rmu onu0aetnxo3oo1fp   i i s0 2trxrpoy1lme  fviatfa2um(ronu0aetomi3iydfa2uaumonu0 rtrmr to1fp r ues (0srumim oo1ll  mfvtl()aruru ooo1apenifeiasfa um(mo (0tetniocoa1lmtr neo (  2uoir oy1aptemfetl(fs2trx  ot4aptn fciyd aDrauvont0tlerir iatlaD lnvo (0texr(o no4lmtnlfvil() 2tmxm oo1teen f3iltlm2ran snu0texnir iydom rlivslt)srxmxo oo1ame  netl( a2umumoou4tetoii3tyd m rlu onu)aleoif3oatlpteau i (0 2xmir3iu1apeemietas)aDrrumpou0oetn i3tlslmDul( sn(4tltoxo3oa1laDrli ilt trurirpoo1ol emneiasfaDrmur nt1tex  ietysfs2rmnmo;t)trtrmr todomtr ivil()s2tmir3iu4olte ictatfaDtm( pou0tltnmfctad a umn pn()aeeoiociatfptr neo () rtoxm3iy1al emfes sfa2ra(m ot0tetnmoctat sDrl(msn()trtoxr oytlaDr u s t trtoio nodal n ictl() Drr(mo;o4tlxn ieiysfaDuau p;t0aexnio tytom e neilt)tetrxopiu1op  mfvilt aDururo;u0oexoioetyd m rmnmp u4alenxf3oo1lpDeluvs t  etmxr nydoptnlnesl(fs2uaxr ;o4tpenmf3tydfa em(mp;u4artnmrctodoaDrlnes s) euoxrpiodomeelfeta( a2ur(  oo4aetomf3tys m2ean p t0 rxrmfcio1oaD  ieo s) rtoir oudlmt lfctlt)s2uaxrp;t0tleo octlslaDrmnvo t0 eeriocoydlat  nei (0sruoir3iu1lltn nvi ()sDtaxmonu4aee ifeiydfs uanvonu4trxnmr oatoa rlueo (  2toxm3nydol  lnes sf Dtm(rpnt4opx moeiadfmDeluvp (4trxnmr3iydop raues;s0 rtm(m iydlmtnlfctlt) Dtmxmoou1tlto f3iatfm uau s (0treoxrcoo1oaD livo;s) rxmiopoo1olee iet s s2urxm nt4tetniieiys a2um(mo;u) lxnifcoydfp rlieo;t)trxoxr3oydoltemfeia() 2uaxmpnt0alto f3iytfm2ulump ()artrio3tydfp  au i t)teum(opnu1lmtemiesltfa2um(  ;t0teto i3iadfaDrlu on(0tltrxr3iy1op raiei t) eurxmpnudap n ncsls  Drmum nt4tleoif3iyt a elu s;t)alxnxrciytfm  ai s t  rtmxr no4llee fvi sfaDtaxmpno4aeenifcilslm um(von(0 exomr3ty1opD  uvo t) rxm(r3ny4ll emivs (fartrurpnu4oltoiictas mDrau p;t) exrifcoytopD livol() etm(r3oydopeemncsas)sDta(r no1olenii3tad a2ulnmp () eeomrciatfpD an i;t0setrimpiu1lptnmncias) rtmur nt4apenii3iat a2rmnmont)teenxr3ootomt  u ilt0texmim3ny4op nlfesl(fsDrr(mpot1oltnioetydfa ul(vp (0aeeomr3oydop rlnvo t trxoxm3oy4ameemfvsatfartaxr oo1tpto ociytla ean onu)aetoxrciydlm r i ils  2ur(opoydlm nlivs sfarrrurpot0tltniieiatlm ul(mp u0 lenifciodfp  ln sl(0srxrxrpiodlltnmncil(fsrtr(rpou0aee if3tld aDrln s u0tetnxr iytfm r iei ( t2tmxrpnodaptelici (fa2ua( p;t1altnioetlsfm uln s u0aexrxf ia1op eauvol() rxm(opou1lmee icslt aDrmxmo;u0optn ictadls2emu o t)treoif iy1lp r u i t s2trxm iy4ome mivs (farrmuronu1apt  f3tatla umnvonu0 lenifctadlp e ivs (0seumxr3nodol  lncs tfaDrm(moou4oeeo fciys s emuvo;u4trermf3totfa eliei s  rto(r oydom emfesls s2trxmont4oleoioctys s umn p (4 exomf iadfpD  i slt  eurir oo1ll   fcils)srrm(  ou0alxnifctadla2ranvs (4arerircoodomDelueo;s) 2xo(r oodame mivta(  Dtax onu1tpe  octas m ean s ()treoxo3to1fpDe u sl() etoxo nu1llte nci s sDrmxm oo4aleniociytfmDraumo;t)altnifcoo1fat an s (0trtrxopnydopee fvsas)srrrxm ot1tlx iieiasls umn o u) eeoif3oytopD aueo ()srtr(rpno4lm nmnvi sfaDur(r ot4olxnmicildfs elumonu)trtrxf3tydfmtr u s s  eumxm no1lptnlnvi s arumx poo4tpeo fcildlm ua(vonu0 lxnmrctadfpte nvo;(0sexrxr3oo1ope  feta(f 2urxmo;u4tetnmf3tls sDumnmo;(4tleomr3to1fp  aneilt0trtoxr iu1al elietas) Dta(  ;t0olenmo3iysls2elnvsnu)aeermoctodopDrlu s;t  etmxr3oo4am  lieilsf rtmu o;o0apeomoctatlmDrm( on()alerxr3to1lp rlieolt seuoirpiu4lm n iei s arumump;o1alxo oetyd m rl( onu4trxnmo3todfa e nvs;s0t2urxm3ou4lmt mfcta(f Dtrum ;o0oltoif3iat sDuauvs;(0alxomr3iotla rlnvsls  2xmxm3oy1lpt mivtls)srtr( ooo0tex if3iadlmDrl(vpnt)teenmrciodoa rlues;t0sexrxopio4optemfctl( srtrxr no0oltn octatls2ra(vpnt) exrxr iotfm  lnvolt  rto(r3ou4optnlnctl()a2ua( o;t1tle  feiltfmDum(ms;u0aexomo3tatlmteauvolt0t2toirpno1ope  nesatf 2tm( oou4aexnifetydlm ea(mo t0tetnmo3iytfp   i i;s)teur(opiudlpt lfes s  2rrurpou0optomi3ildlsDrluvs;(0 leoif iotlm   u ilt0truoxr3ny1ll n fesatf rtm( oou1olxn ociytls2el(mpn(4 leoxo ia1oateai i (  2xrimpiodal   fcsasfsDrrxmont1tpxnmociyt mDemnms t0 ltnio totlptelneils s2uo(r oydomtnlnes ()aDtm(mpnt4alt mo3iltfmDrmu o u)aeeoif3iodlm   ivils)s2uoxo ny1lpe  fvtasf rtaxrpnu0alxn ieiat mDrmu s t) rxrmfctydom elies (  rtmim iu4lpte fes (fartrumpou0olxnmoetytlm2rmu o;u0trtnmr to1lm  auvo s0srxrxr io4lmtnlneia( sDraur nt4oeto o3iltlmDumuvpn(0 reomf tadoptrau o s)s2tmir oo4altnliesls s2um(  nt4texnifctld m ul(vs;u) lerxr oa1lpteln i;t)teuo(o3nudop e nvi tf 2urxmpot1alen ociasfmDuauvs;(4alxnmo3totlmtrluvil() 2uoxo3nu1oleemnesls sDuru ono0aeenmocilsfs2ua(mo () exrxfciodfptelnvil(  ruoiopiu4al nlies sfs2taxmpnt1opxnif3iad mDrau o t)alxnirctatfm rlivi;s0s2trimpiy4op  lfcsas)a2uaur ;t1oleoifcias s2el(vs;u4 eenxr3io1fpt  ues;t0 2toxopiydlmenlictls srrmuront0olen i3iyd sDra(vs;t4tlxoxf iydfmteaieo t) etoir oo1apenlnesasfsDrax pno1tleo i3iat a uan sn() rermr3oy1faDean ils)s2tm(m io4optnlncsat  Drm(rpou0tltnifctltfs2elumsnu0 lxnxoctotoaDr u i ( srxr(r ou1olen ivsat)artaxmo;u1tlx ioetytfs ul(ms;t0 ltnmo tatomtrauvols)t2toim iu1lmt  fvt s)aDra(  nt1aexomociyslm2ua(mo u0teermo tytomDe neol() rxm(opou4alt mnci t) rrr( oou0opx mieiytls um(vp u0alermociadomtrli i s)s2trimpiudam  lnvslt)arur(m ;u4tptomo3tas mDulnvo;u0tetnir iydlmtraneils0 rumxo no4ape mnvi ( a2raumpot4aetnio3ildlm2eluvo;u0aeeomo totlmt  ies;s) 2tr(o3oo4amtnlfetas a2uax  ;o0tpeo fciyt aDranmonu)trtomr iytlmt  uei;( trxoir3iydlmt lfvs s sDrax  no0oet  oetadfaDuanmo u0artomo3ootlpt  n s;s0trxm(m iy1lm  mnvias  2tmx pot0oexo ieiydlm2el( s;t4trxoircoy1oa raieo t)sruoimpnudll eliesls) Dtm(  ot1tlxo ictltlsDrlnvo;t) etomo3iydomteanvs s0 2um(opoo4oltnlneslt srrmu  ;t0olt ifctldfm eaumo t)artrif iydop e uvo t)teuoir ou1apt lnet tfs2tau  ot1teeoifetasfsDulnmsn() eermf tytfpt anesl(0 2toxrpno1aptnliei ( artm( oou4tltn ictatfs2ranvp t4aetoio iadlaDeaieo s) 2xoxm oy4opeemfvs ()aDrrx  ;t1aeeoiictytlm emu o (0tlxnmo todfpD  iesl() 2urxo3ou4alt mfei (fartaumoou4opx mfciydfa2ra(ms;t0 etomr3oatlpt  uvs;t trtmir3io4omte ictl() 2uau oot0oetnioeiaslm eaumo t0trtrxf oytlaDrln s;s0trum(o iu4lm n nesa() 2urxrooo1oet iietld m ulnvon(0 rtnmo ty1oa ranvs;(0s2xmxopou4om e fct t) rrmumo;o0tlen feiasfs2emuvp;u4 eerxr3tadfp eaneil() eumxm ou4oltnlfvi ()a2taum ;o4oeeomiciltfm ulnmo;u)tltrmrcoytlmte u olt)srum(rpno1lmtn icsls)srur(roou4tleomiciadlm2uanvo t4aeenxo ty1fate n o (0t2urir ny4ome mncslsfsDumur ;u4olx  i3ildfa ranvp;(0tleomoctydop  livolt)s2tmxopou4apee fvs t)aDtax poo4aet mictat s2ea( p;u0 rtrmoctytlp  li o;t) etriopiu4lmtn fcs (fsrurxrp;o1aetomoctyd s uanmpnt4 exomr oydopD livilt0 2uoxmpno1ol elnviat)a2rmu p;t1aexoiieiytls2umump u0 renirciydfatelivs t  2xriopoo4ole  ici s s2rmu  oo4aex  feiydfs rm(vp t0 rerxr iatoaDeln o s t2tm(mpio4lme lneilt  Dum(rpnt0tpxnmociytfs2uanvp;t0 rtoifciy1laDe u i;()trumir3nu4op  lfvsls)aDumu p;u4aeenii3ild s elu s t4teermrcoo1laD  n s;() eto(r3oydlltnlfvt t a2umumpou0opxnifctlsfaDemump;() rtomrcoa1laD  nvs;t trtrxm3iy1alee iesl(f Dtmxr nt4aex mociltlmDem( p;u4 eenirciodlaD ai ols) 2umirpio1lmenmnesl(fa2ur( pou4alen icildlsDelu on()alenxo oa1om e ivo ()s2urxrpou1ol   fes s sDrm(rp;u0ale miciltlmDuan on(0tetrxfcoatfate ieols srtm(rpou1oltnmnvi sfarumumont0oet ifetyt m2rmuvs;u) etomo3todomte ivi;t0s2ur(m io1ll elnvt (faruaxr ou4tpenmictlslsDrmuvpnt0arerxo3iotop e uvo;(0t2uoxrpoudlp nmncsl( sDtmxmoou0altoif3ildfs ranvp (4 renxr iytfmt  n ol(0s2tmxmpny4opeeliei (f Dtrxrpnu0apenioeildlaDumu s;()teermf3iatfm r u olt  eur(mpiu4lmtnlnctlt)a2uaurpot4ope  ociltfaDrl( snt4 rxnmr tatoate u ilt0tetoxm3oodlptn fcsa(farumumont4olxomieiltfs2ua(vo ()aetnmr iytfpteau ols setoirpoudameelics sfs2tr( p;u4aexoifcils m2eln s;u0 exnio iy1fp rlnvi s)seumxm no4op  mietat sDtrx  ou4apt  feiadfmDrm(ms t0 ltnxrcoatfmtelnvs () 2tr(m3iydopenmnvsl() 2ua( poo0openmiciasls el( snt4aexoxf3todoate n i;() ruoio3oo4ll n ictl() 2ra(m ;u4ape  feildfm2emumont)tetrxf todom ranvo ()trxo(mpou4apee icsasfa2rr(root1oeeo i3tydlm raums (4 etnxf3oydfmD lnes;(0 rtmirpno4op elieslsfarurum ou0aeenmf3iysfm2uln snt0trxrxr ia1lpte u ol(0 etoir io1lltn nesl( a2ua( ont1olx mi3iad m2ra(vo;u4 ltnmf to1lm rai i;t0trumimpnu4ap nlieia(  rtrx o;u0tltomo3iydlm uaumon(0tetoirciadlmteauvi t trxriopio1lp nlfetas)aDrm(roou0opeomiciyd s rmnmonu4aexrmf tadlmtrau ols0t2trxr3ou4omee ivia( s2rrx  ;o4aptomiciydfa2emumo;u0alerxo tydlpt  ivo (0s2xm(mpno1lm nmnesatfsDrauront1opxnio3ias m2emu o u) rxrmrciotlmDr neols)srxm(mpnu4ol  mfesltf 2urumoou0opt  ociyd s2rlu s u0trtrmf io1fa raieo;t)t2umxopoy4aptelnvsl(fsDtm(rpot1tpxomociltlm2elnvsn(4altoxf tydfm  luvo;(0s2tmxm ny4apt lfvtlt sDuru ono4tpen fciydls ran s;(0trtrio3tadoaD  n il( trtmio no1apte nesa( a2trxmpot1oetomoctadls rmu p u0alenxr3ia1omt  ieo;s0s2uoim3oydlp n ivs ( srtau ont0aleomi3tydfs eauvs u) rtomf ootfat  uei;s0trurxmpiodape lncs t) rtrx o;t0tlxn ieiytlmDuanmo;()areoio iodoptr neo t  rtoxo3oudolen ivi ()sruaumoot4oeeo octldlm emn ont4arenmf todlmDeaivi;(0texmxopiy1op  lneta(f 2tmx  ot0teen o3tldfm2rmnvpnt4tetrmf to1lmte iei;t0 etmxr3iodomeelnvia(  Dumurpou4aleo oeiltlsDrlumsn(0 etomf3iy1fatraivo;t srxmxmpiydlltnmivtas  Drr(r ;o4alt iietytfs2rl( s (4tlenmo tytlp r u ol(0texrimpio4oleelieia(fa2rru o;t1optn i3iyt a em(mpnt0 exrxf3oydlmtrauvo t0 exoir iy1llte fes t)arua( oot4ope ii3tys m umu on(0treoxr3todomt aieolt)s2uoir oy4apt lnviat)sDtru pou1teenioeiadls ul(mpn(4aetoio3oydlptraieil(0sexrirpoy4am emfvs ()srtmurpou0tet  i3iydlm2ua(mo (0texrir3oytfmDrauei;() eum(r3ny1lm nmfes tfsDrmxm no0alx mieiyslm ean onu) rerif tytopD au o;s)trumxo oy4apte ietl()s2rmurono0aetn fctlt m rln o;u0 lxrif3ootlmte ivs;t0trxmiopiy1llt  nvi s) rrm(  no4aexniietlt a2eluvo;u0tlermr3iadoaDr uei;t s2tmir3iydlmenmivil( arrrxr ;o4apxoio3iysls2ua(vont0 lxoxrciydlatrauvsls0trtm(m io1ap nlfvia(  Drr(mpnu0opxn f3iydfm2um(vp u) exrxf3ootfpDe u sl( t2trxo3nu1ol e nvi tfaDtaxm no4tee moeiyt a2ul(mpnu0 ltnio3oo1oa ranes ()srurim nudap  lnci s)s2ta(m ou4teeo ieils mDemn pnu4teeomr io1oa   ivi;t0t2urim no1op n ieslt  Drrxr ;t4aexo fetad sDua(mon(4 rtnir oodlaD ai o;s  2xrim nydll   ics t)aDtr(r no1olt  feiytfa2el( pnu4 rtoif3ootlptr i s (0 rum(o iodamtnmfcsat)srumum oo1apt mi3iysfaDuanvo u0 lxnxocoadfatran i;(0srxrir3oo1lleemict t  rrmxr ;t1tlt iociytfm umuvo t)trxrifciydfa eau s;() 2um(m3nydlltn ieiat)srrmurpnt4tlxo iciydls2rmnvsnt0teerxfciydop   uvs;( trxm(opio1ol emfei tfaruax oot4apx mi3iydfm emnvs;(4tltoiocto1lat auvo;s0tetrxmpnydapeelietltf Dumxrp;o4tptnmictatfs ul( s;t0areomo3todfaDe ivo;t setoxopnodlp  lict s arrm(m ot1alxo o3tadfaDrlnms u) etrif tatoa   nvi;s srumim oy4lp  mfcil()s2tm(ro;t4tpxo i3tlt mDelnmonu0 lenxfctatom e uesls s2uo(r3iy1ll e fcsl( arrr(monu0tpe ifciasla rlnvo;t)alxnio oa1oat  nes;t0seur(opio4lptnmfvtatfs2umx  nu1tltoii3iadla ulums u4 rxrxf3iytlp  aueol()s2toio3oodlpen ncsat)sDrr(r oo1oetnmfeiys a2emuvp t4tltnir3tydlaDeaivsls  rumxr3oy1llenlncs t)a2uax pou1olx  oeildlsDeln snu)areomocootlptranvo s sruo(r iodam nmicsltfaDrmumpou0tlx ii3ildfm2rmnmsnu0arerio3todlpDrau s (0 euoim3oy4ap   nctls)sDtmumooo0tlxn f3iyt m emumo u)trtnmo3oytfaDr i o s srumio3iu4omtnmfetatfaDtm(ro;u1ope moeilsfa2ea( on(0 rtomo oadlm eaues s) 2xoxopnodal  livsas) 2tmxmoot0alenmicils s2emn s (0trtnxr io1fpD au ils0trxoirpoo1om  lfet t)sDtrx oot1alx mociadla2rl(vo u0 exrifcoatfp r ues;t)s2urxm3oo1opt  fetl(f rua(r ;o1alt iieiatlm2umnvo t0alxrmo iydfaDe i slt)s2tr(rpoo1opte ivt t) rrr(  nt1tetoif3tatfmDum(ms t)artnxr3iadlatrau ils)seumirpiy1lmtnlfei sf Durur ;t1altoifeiytlm rl( pn()aeermfctotoaD ai s s tetrimpny1lm  lfet ()srtr(moot4alt  oetydfmDranmp ()aetomf3ootlmDelneo;( trum(o iu4olenmnvtlsf 2tm(monu4opx iociydlm2ranvs (0alxnifcoodfaD lueol()s2uoirpnu1olen nesatfa2rmur oo1tlto f3ildla2uaumont)texrmoctotfpte n ilt  2toirpny4llt  fvsat)sDumxrono1alen ocildfm ranmpnu4aexrmocto1fmDeluesls0s2xrio3ou4lmtnmfcilt)s2rmx pnu4ape if3iyd m rmums t4teenxf oodfpD lieo t0seum(r iu1opt livsat srurxro;t4tex mfctyt s eaumo;u0trxrxo io1fatelu o;t)s2trimpiydome  fctl( a2umxrpou4tpxnmfetysfaDrlums;(0 leoxf3oodomt liesls t2xo(opnu1lpeeliei sfsruaxmpot4tlt  o3tydfm umnvp t) eermf3oodfmD luei;t texmxr3iu1lp e fvsls  Dur(r oo1aptomoeilsfs2umnmp t4tlxnxo iadlp   i s s)srur(mpno1apeemivsl( aDra(ront4apenifeiysfa uaums;u0arenxrcia1fmt  i i ( t2tr(m3iy4llt lnvilsfs2tr(  ot4tlto oetltlaDrmums (0aeenxfcoytfmt an ils s2toimpoudaltn fesat)arrmx pno1tltomociat a elnmpn(0aexoircia1laDe nei t t2xr(mpiu1ol  mnctl(farumuro;t4alxn f3iad m elu ont4 exomo oytlmD  nvo t0srtrxm3oydoltemnetlt s2umx poo1oetomf3iltfsDrl(ms;t0alerio iotoate ivi (0texo(r oo1lm n nes () 2tmumonu0tpx mf3iysfm ea(mp t4trtrxo oytlp e uei;(0trtmxr oudlpee nviat)srrrxmono1apx  ietytfsDra( p;()aetrxrciotlmDeauei;s0t2tmxopou4apeelfetas) 2rr(mono4texnio3ilsls umuvs u4trenioctadfptelues t0sruo(opnodlltn ivi t aDtmu o;o0apeomictltlm2ulu o;(4 leoio iytoaDrln o;()t2uoxm3ny4lmtnlnes s  ruru  no0opto o3iadfsDuanvo (4 lenir iotfmte ivo (  2trimpno1ome lieil( srtr(rp;u4tlx micilslm ean o;t0artoxfcta1opD aivilt setr(o oy4ap elneil(fsDumur ot4tptn i3tadls eauvp;u0 eenxrctadlp   uvo;s sexrir iy1ap nmiviat)aDurxrpot1oex mieiysla2uln p;(4 etnxrcoo1lpDeanvols trumxmpoydal  mfesa( sDtau pnt1oetniieiasfmDel( onu0 lxoir3tatoatrlnes;s)s2uo(r3ou4al   fvta() rra(mont0optomfciat mDel(ms;(4arxrxo3iy1latr nvo;t trtmxr nudlm nlfciltfarrauro;u1oexn fciaslaDulump u)tetoxf iodfa rlneo;() exrxo3oydlmt  fvs s) 2tm(  oo0aeen ieiytls2rlu pnt) exrir3todopDran il( trxm(m iu1optnmfcsls srua(rp;t4opxniiciyt aDrlump;u)teenxoctydfp eanesls0s2toim3io1am emnci (f 2umu  no0oet  o3iytfa2ulums;u4tleoxo3iotlaDeliei t srtrxr3ny4aleemnvt tfaDtm(ro;u4tee mf3iytla um( p (0 rtomf3oo1laDrli i ()s2uoim nudap n feil(  2trx poo1tetnifctytfa2uanvp;(0aexrmr3ootoptrauei t) rumirpoudoleelnvsa(f 2trx  ;o0ale mieiytfa2emnms t) eeoxf ty1late i o;t0 ruoxr nodap nmictasfsrtrxront0aex mictaslm el(mp;u)tetrmf3oy1oaDrau o;t0trtrxopnodlp n fviat) Dua(mpnt4opeoifeiat m2el( p ()artnxrciadopDeluvs (0t2xmxr3oydlp   net tf rtm(m nt4oex io3iadlaDumn onu0trtoifciy1oatrlivi ()texo(o3ny4lmeelfcs s)s2tauro;u0tltomociasfaDeaump;t4tetrxo3iy1fp r n s;t)sruoim3nu1opt  nvils) 2umx pot4teeoif3tydlm rmnmp u)trtomo ootlpD aueo t0s2um(mpio1omt mivias)srtmuro;t0ale micilsfs uanms;(4 rtnif3iy1fpD  nvs t0 ruo(mpiu1omeemnet sf rrmxrpot4oet ioeiltfa ean o t0 reoifctadoa  aueo;s) exo(mpoodomt liciat sDtr( ont1opeoioeiad sDuau o () rtrxocto1fpDeli i t0teurir3no1lmtemfei t)srtm(  no4aeen oeias mDrm(vp (4 etrxrcia1fmDrln i;s) etmio3iodol emfvs sf 2urxm nt1aeeoiieils aDrmn onu4teenxfcoatfaDrliei;s sexo(m3oy1ll emfcia(fsrtrxr nt0tltn i3ild m2uaums () lenmo3iadoaDe uvo ( sruoimpny4ll n neilt  2rm( poo1alx moctyslaDrlnvsnu) eeomf todlm   nvi;t0 rxrio iudlptn nvsat s2rru poo4tltnmieias mDuanmo () lxniocto1laDe i o t trtr(mpoy4al nlivt t s2rrur ot0aptoiieiltlaDum(vpn() rxoir3tatomDrlnvi;t  etm(o no4amenmnvta(f 2rr(rpoo0tltoio3iytlsDrmnvo ()teeoif3oytomt lnvs s0s2urir3iydlleemics tfarumx p;t4tle moeiltfsDrlu s;t4aexoxo iadfatr uvolt sruo(r oodopenmnetltfaDtru pnu4tetnmi3iat a uauvp t)aexnircoytfmt  u ils t2xr(rpou1om elnvi sf Dra(rp;u0aetniietltfm2rauvo;(0tlxoir iydfpDelivi;t) exr(m3iydap n nvslt s2rau pot4tex  oeildlaDel(mp;t4 leoxociotoptrlues;(0tetoxm3iy1ome lict s  2umur nu0tetn iciaslmDea( s;()tlxnxr iy1lpD lneolt  rxrxr3ny4olt mieta()arrm(  nu0aee ii3tadfa2uluvont4alermr ia1fmt  uvilt)s2toimpny1al n ncilsfsrtax  ou1ale  iciltfm rmn p t0tetrxf3oatfa rlueo s0texm(o3iy1ll nmiesas)aDrmurono1opto ociat sDuauvs;u0aeenmo ty1faDean i;(0teum(mpiy1lltemnvs s)a2ururp;u4tpt mf3iad aDem(vo u0 reomf to1fate i s t)sexmimpio1omee nvias)aDta(m ;o0oetomoeiad a rlnvsnt0 rermo iy1fmtrluvo t0srumxmpoy4omen fet sfarta(r ;u4aet mf3ildfa2ulnms t0aeeriocoadfaD  iei t0s2uo(o iudamt livil() Drauroou4ale ii3tysfaDumu s t) exnxr3oa1fp   ivils srxm(rpiu1omte nvta() 2tax o;u1aeenioeils mDulu p t)treoifciy1omteaieo;s0s2uoio3oodom nmnesa()arurx pou0oet  ociasfaDea( s t0alxoir3iadoa rai olt  2toxr3nydapt lnvias)s2ur( ont0olxomoctls aDel(mp;u0arenif3ta1opt lnvs;s0srtmim iy4omtnmietltfs2rmxmoot4opx ioeiat sDrm( s;t0 rxnxf todfp rli o;s srxrxr iudapee nci t srrmxmo;u0aee  fctyd m2elu o;u0 rerif3totla e nes ()truo(o ou1lp nmfvi t  Dta(m ;o1tlxnmfetyd sDeluvo t)arxomfciydlpDeauvs s0 2xrxr oo4ol n neiat)aDrmurono0opxn ieiytlm rauvp t)arenioctytfat ai s s)seumimpnu1opeelicias a2tr(rp;u1aetomfeiasla elnmonu4 rtnioctotoa eau o t0trxriopiu4lpe lfciat) rumxm no4tet  oetadfm rln o u4teenmo3totlm e ueil()srum(o3ny4lmeelfesatf rra(m nu4alx moeiyt m2ra( pn()arxoxf3tadfpt ln ilt) exmxr3oodolenmnvi sfs2tmuroou4oeeo feildlm ua(mo;(4 ltrxrctotfpDrlnesls)t2uoxopiu1aleelnctls srrau  nt1tltn ictatfmDuanvo;u0trtoiociydfaDraieo ()sruoxm3oy1op n iet tf Duru pnt0tltniietatls2uan sn(4aetoir tadla rau i;t s2tm(m no4olenlicilt)s2rrxro;u4oet  i3iaslsDra(mon()tlerir iodfa   ueils s2xmxo iydomt mivtl(fs2um(r nu4tlen oeiys s2rm( pnt0artomo3iotomD ai sl(0 2urxo iydlpee neiatfs2tmx p;t4opxoioctydfaDea(msnu4aetomr tytlat livs;s trxrxm iodole lictlt srra( o;t4aetomfciadlaDumnvp;t)teerxf3oytlp ranvs;s) ruoir3io4om nlies () Drr(rpnt4aex  ietatfa uau s u4 lxrxr3iy1opD li i t) euo(rpoudap emicsls) 2raxmpnu0oltnif3tlsfm2ulumpnu)tltrio oodoaDeauvi;(  rurir3ou4ape  netltfartmurpnu4aexoiieiaslsDeluvs;(0teerxo3todlmt auesl( trum(o3oy1ole mivta()arrrur nu0tpt mi3ias sDua(mo;t0 lxrirctadfptrln s;t0 2xoim ny4ap n ivsa() rur(ro;o4tpe iictlsfa ulump ()tlxniocoadom  au o;t)seumxr3nydom n nvi s arrr(rpnt1aleoiieiys s elnmonu0aexnifciydla rluei;s0s2xrxr3iy1apenmnci () 2rrxro;o4tpx ii3iatlm emn p;t4tetrirctodlat  nvols texrirpiy1lmte ivsatfsDta(  oo0oetoioeiys a2uanmonu)tltoio oatfmteaneols) rumiopio4am e fvs t) rra(r no4tlenifetat sDelnvpnt0aetrxo3oodfp  aneilt) eurxmpoydamenlict t aruaxm ot4apxomociydlsDean sn()texoirciytomteanvo;s0srxm(m3oy1opt mfvt s)arta(r nt4aleo f3tld a2elu p;(4 rxnio iatlmtr uvo;()teum(opoy1lleelfeias)sDua(rono4texnmieiltla2el( p u0areomo totoa  au i;(0s2uoir nu1ap emfviasfaDtmuro;u0teeomietyslm2uau s;u0aleoxr iotlpt li i s seuoio iu4om elfes tfarra(r ot4aptnmocildls2rmu p;u4alxoxr3oatopDr nvsl() ruo(rpnu1optnlnetlsfa2urxm nt1opx mf3ildls el( o;t)texnmo to1la  li o (0t2tr(rpoy1apt mivt s  Dtm(rpnu1olxoii3ias s2emn p;(4altoio3oytlmtrlnvs;s0 2tmxo iydamtn iesa()s2ra( ont0tleoif3tytfm2ulu o u0alenxr3tatop eaues s0texoimpnu1optelieslt)a2trx  ot0oltomf3iytlsDra(vpnt) lerif3oa1opteli o;s0 2tr(rpiudol  lnes (f rumxmpou1apt  i3tadfa2eauvpnt0arenmr3oytlpte ues;t t2tr(rpno1lpenlfcs sfsrrr(m oo4aeeoifeias a2eanvp u)artrxocto1fpt aiei (0sexrxr3nu1amtnmfcta( aDurxmpno1tee  oetat m ean sn() ltrir to1fmDr nvi;t0 rto(r3oo1oleelfet s) 2um(mp;t4aex  f3iyd s2um( p t4trtnmfciatlp   n o;s  2xrxopny4llenmnci s)artaump;o4alen fetadla ulnvo u4areomo3ty1opt lu s t0seumxopiy1opee fvias)s2tmumpoo1openmiciaslm rmnvpnt4areomo ia1lp  anei;s0 2xo(r oodllt mnetas aDumxmo;t0olxn o3iytlm ul(mp;()aleoxo ia1fp   ivo ()trur(o3oydlp  mfct ()a2trumpoo0olt ifeiydfmDuanvp u)tltrxr iy1omDeauei (  rum(r oudaptnlfes t)sDtaum ou4aptomf3iydlm ua(ms (0artoir iatfm raivs;(0 2tmimpnu1lpeelncta( s2tm(  no1oeen o3iysla2ul( p;u) exnio3oy1fpDeaies;(0s2umim3iudolenlicils)arta(roou4tpe iicildlm ra(vo u) etrmoctatoaDe n olt0srum(opoodomtn ietat)artruro;u4alxomfeiatla ea(vo t0tetrxrcty1fm r i o;s)trurxo iudlpenmfvta()sDurur nt0oex mfetlt aDelums (4aetrif3iydfm  lnei s)setmxopno4ole mncsat aDrmu pnt4apx  ietasfs rlnvont0aeenxf tydlp r iei;(0t2urio3iu1lmtnmnct (f 2uaurpnu1tltnmoetytfm2umn p t) eerif3tatoaD  nvilt)srxoxrpnydoltelnvtlsfarra(m ot4ale ioetldlmDuanvo;t4 ltnmfcoydfmtranei;s setrxmpiy1opte ncsa(faDumxmo;o4oltoiociadls rauvs u0 reoir tydlate nvi t0texoxm nudlm  lfvt t srrmurp;t0oeeoiociad mDranms;u0 rtoif iydfat luvslt  exoio no1ameemnvi s  2tmuro;u4apx if3ildfmDel(vs u4 etrxo ty1laDeanvi s0 2xoir iudalt  ietls)srrrxrp;o4oeen octatlm rau p;u0 rtnmf ootlaDr ivi;t)srxmxr iydll e icsltf Dtmxmp;u1tee iociatlm rlu sn(4alxoifcoodoptelu o t0 2urim3iudopt mfetlt)a2rm(mo;t1opxniiciys m um( s;() etnmf3oytopt aies s)srur(o iydapen fvtl(  2ta(mont0apxn oetltlaDeanvs u4aeenxf3todfpD aneolt)tetr(m3ny4ameemfeta(  2umxm ;u0alenmfetltlmDrau p;(4 exrmrciodoaDr ivi;t0 exoim3io4amt  iesl( aruaurpot1tltnmoeiatfsDuan s u)aleoirctatop e ivs;(  ruoim3oy4amee nvs sfa2uauroou4alenmictatlmDul(mpnu4tlxomf oytfpDelnesl(0seuo(o oo1omt  fctas  2raumpnt0tpto iciys s uaumon(4trtrxr oo1lpDr uvi () etrim oodalen iesat)a2rrumoou0oetnmfctlslm umnms t) eenif3ta1fatran o;t)s2ur(m nu4ll n neta(fs2ta( p;u1aeeoifeiatfm2ulumpn()aetnir3iotfaDeluvil(0t2xoiopoy4ll  mfcias)a2ururpou4oltnmf3tytlmDua(vonu0 exrif3iotfp ran sl(0teumiopou1olt mnci ()aDtr(rpnt4aexniocildlsDulu p;u0 eerircoy1lpDrau o t) rum(rpnodol emivia()sDuaumpoo1tee ii3iad a uaums;t0 lxrmr3oa1faD  i sls0s2xo(m3iodamt lfesa() Dtrump;o4alenio3iyd s eaumpnu0tleoxrciydlmDeaueo t)sexm(rpiy4amee ies tf rrrx ono1tet  icils s rln s;t4aleoxr oytfat  n s (  rurxm nudap emivs ()sDtr(r nu4opxnmfeiyd s rau o u)artoxo3oatlp r ueil(  rtrxo3iy1ome  ictlt  rtmuro;u0apx moeils a eauvs;u0artnio3ty1lpDe ivs;t0srxoxopiudlmte icias)arurur ot4alen oetadfm rmums (0tetnmfcoydla rlnvslt srxoxo oo4lptelneil( a2raxro;u1ole mo3tatla rm( s t0tlxnir tydlpD auvsls0trxrxr3oy4omtn nei s a2tax o;u1aex  ictaslaDemnvsnu) leoiocoy1lpDrai sls) rtoir nu1ameelfeias)a2urxmpno0alx moetltfs2rlnvsnt4 eermf3oy1lmDelu ils)teuoxo ou4apee fvs s) rua( o;u1aleoioetasla rl(ms;(0areomr3oydfpt  uei;t)t2tmir nudaltelivsat s2taxmono1opeo ociadfm2umu p u4trenmr3iytfa  luvs;t texo(r3ny4al nlncs ( a2um(rpnu0tetoif3tytls2umuvon(4altnxr3iotfpteaivolt  2xo(mpoodomeeliciat)sDuax oot4aetn f3tysla um( pnt4 leoirciy1oaDeluvs;(0srur(o3iy4aptnliei (f rtmx ooo0apto i3tydfaDrmnmsnt0aetnir iadfa e nvo;( teum(opoudlltemncsatfsDra(m ;o1altoiocias sDuauvonu)aeermf oo1oateluvil(0 eum(r3iydlpenmneil(  2um( o;t0opto f3iydlsDul(vo t0alxoir todlmtr i s t)srtmxm nu4lpt  nesas  rtmxr nt0tpxnmieiatfa rl(mpnu4altnmf3oa1lpt aivslt  rxoir3oo1lm e fetasfsDurxrpnt1olx iocilt s2rl(mo u0aetnmf3todfpte uvi s0s2uoiopoo1ol n fviatfaDuru  oo0olxo oetasfs em(von(0tetrmrcoodoptrai i s)srtrimpou4ape livsat srrrumpnt1tltoiictat mDuln o;(4 lerxo oytoa rlivs ()setoxo io4lpeemicsa()a2rmu  ot1alx ioeias s rlums;(4 lxrxo to1fmtranvol()t2um(o oodal  lfcsat sDrmxr ;t0opx mi3tlt s2um(vo t4tlxomociytfpt lnvs t texmxr3io4ol   fetlt  2um(m nt1oetnmf3ilt a2rl( pnu0texriocta1fmtelivo;s) etoxm oy1ap  mfvs tfsDrrumoou1altomoctltlm2ul(von(0trtriocia1fpDrlivi;s)srxrxo3iu1alt  nvtlsfartm(  ;t4oexo f3iyd m2elnmpnu4tlxriocoytlm r n i t t2to(rpnu4oleelfeta( s2rm( o;o1aetoioeildls2umuvo u0aeeoif tatomDelivil(0trtm(opiu4ale mfcta() 2ur(r ;t0tpxoifctlsfaDuanmsnu4 exrxo3tydfa   nvsl(0trxoio ou1lm   nes sfsrum(m oo4alt  o3tlt aDemnms;u0trenxrctotla raiei s srurirpoy1op n ivsas) Dtaumpoo1tltoiociaslaDumn p;(0 rtrxrciy1fmtr ivs;s) 2trirpoudalen ieiasfs2raxm nt4teeo oetasfs umu p () leoircta1omt anesl( t2um(rpnu1ale lfes ( a2trxr nt1tex  ieilslsDeaumo u)artnmf iytoateai i;(0trtmimpoo1omenmnct t  Dururp;t4oexnmfciysfm ul(msnu4arerxf ootlm e neol()teuoxo ou1ol  lnesatfaDtm(ronu4opxnif3tasfa2um(ms t0tetoxocty1oa   ies ()trumim io4olte fetat) ruaxm no4aleo oetytlsDeaumo u4alermo3iydoatrlivo s)t2umio3ou4amt mici () 2uax  ou0texoifeias sDrln p u0aetnmociotlpteanesls0trxr(r iy4ll   ivs tfsrua(m nu4opt  o3tas aDrm( o u0arerifcio1fpD anvi;( s2urio nu1lm   nvtls aDuaxrp;u0tetn o3tld m2eluvp t0trxnir iatopDe ueo;t0srtrxr3ou4aleelnvtat  2ra( p;u0oet  f3iatlmDul(vont4trermf oa1opD aueo s0 2xmio no1om e icsat)arrr(  no4oexoiieiatfm umums u0trxnirciodop ran o;t srxoxopou1amte nct t aDrm(rono0ole ifctadfs2eanms;u4 rxoio3iytfm eau ol(0 eurimpoodame liei tfa2uaur ;o0tleo fetatfa2emnvs u4 eeoif oy1la eanvo ( tetmirpou1ope mnvtas sDrrxmpno0oeeo i3iatfm eaumon()artoxf ia1fmDr iei s0 etr(o iudlltn icsasfa2um(mpot1opx io3iaslm2elnmon()teeoif3tatla r nvi;t)setrio iu1al n fes (  rtmxrooo4opxoii3iltfaDumn p u4tetoxr3totlmD ai i s0teumxopiy4ap e ivsls) Dua(  ou4tpxo f3tyslsDelu o u0tlxnxf ty1fa rau o t0s2xrxopoudoltemicsat s2umumont4opt  fciysfs el( o;u4tlenio iytlaD au ilt)s2trxo3oudope lfvsl(fs2ur( ont0olen f3taslm2rlnmp;u) lxnmocoatlm r ivi s0 2xmiopoy4amenmivs ()aDrr(  nu0tex mfeilsfm elu p (0 etoxr3tatfa   u s;s srxm(opiu1lm e ivsls arum(mpoo0olen fetltfsDrluvs u0aexnxfcto1lmt anvo;t0 2xoxrpoo4oltnlneta(  Drr(rpoo1optomfciysla emnvo u0 rerio oytom ran o;(0s2toxrpiu1op nmietat a2um(m ;o0aex  fcild a2em(vp;(4 etoxf3iadlaD luvi (0t2xmiopoy1opt licsl( a2umum ;u4oltnmfeilsla elnmo (4texnmr ootfmDrlieo;()s2tm(mpio1am elieia(fs2ra(mpou4oex mf3ilslaDul(mo;u)tltoio tydop r i s;t)t2uriopny1apen netl(f Drruro;t0texoif3iydlaDrauvp;(4 rerio3to1fpDrliei;t0s2tmxr3nu1amenlics ( aDtmum ;t0apxn ieiytfa emums u) lxnmo3oydoaDe i ols0trtrim nu4op elivsl(fsrua(m ot0alenmictydfsDumumo (4alxrxf3iydlpDr ivs;s srtmxo3oudlp  livslsf rrrum nu1olt mietytls2rmu pnu4tlxrif oadfp eln s;s  exr(rpnodapen nci s)artmxrpou1oexniociatla rm( pn(0aeeomr3to1om   nes (0t2xmiopiy4lle lies s aDrmu  ou4opeoii3iatfaDumnms;t4 etnxrciy1fm rliesl()t2toxo3iudamt  netl()srur(mono0apx  ieiydfm2rlu o u4 rxnif3ta1fa  lneo ()trtoiopou4alenlnvtls)srrruront1tlt io3ias sDul( o;u0 rxrif3iydop e nvo;s truoiopio1ap emivsa( a2raxrp;t0opxomfeiytlsDranmsnu0trtrxf3iadomDr ieils trxm(m nu4olee iet s  2urxmont1tle  i3iyt a2umnvo u)altnxocoo1fmtr nes s seurir ou4lmenmictl(fs2uaxrp;t4tex  ocild sDelnmp (4aexrxf3tadlmt auvi s t2xmimpnu1apt  nci t)arum(  ;t4opxnmo3iltlsDra(ms;t4aeerir3iodopDranes;s0 exm(o oy4amt miciatfs2tmxro;u1opeo f3tydfm2eanmsn() lxrmfcoa1fa e nei s)truoxr iudal n ics s)s2rm(  ;o4tle if3iys sDulu pn() ltrifctodfaD ai o ( texoim3oydlpt  ncsls)s2trxmono0aeen oetydls rmnvpn(4 leoxo ty1oa  aieo t) rto(o3iy4ll  mnes s aDrmumpou0aptnifctls s elnmo (0trtnirctytlmt anvs t)trxr(opio4lpeemncs ( sDraxroou4teenii3iydls rlums;t0alxoxr3ootfp eau i t0teurir3ou4lpt mietls)arraurp;t1teenmiciltfaDelnms t)aexomr ty1fa r ivilt  rumir3nudomtelfci t)sruaxmp;u1tltoioctldfaDean s (4aexnif3ootfa rai s;s0 2tmio3oydal nmnvias)aDtaxm nu4tptn f3tysls2rluvs u)aeenif3oydomt lieo;t0tetm(r3nu4ap nmicsls aruaxr ;u0oltn f3iadfs um( snt)trxnmfcoatomtrluvo;(  rto(r nydomeemnvtl(f 2truro;o0tpx  iciasls2eluvon(0tetnmr tatoateaueo (0trur(m oy1lm  lfvt tfsrum(root4tpeomoctltla2uau s;u0tltoxfcootop  ln ol()srurxr iodlpeelfesatfsDrm(moou4ole ifeiytla el( sn(0teerxociadfa raivi (  exm(o3iu1openlieilt  2rr(m nt0apx mf3ias s ulumsnu4 leoif oadop e nvs;t  rumim3ou4omenmici t)srrr(mo;t4tlxn oetyt m el( o;(4 leoifciadoptran s ()t2tmim3io1opee ies tfa2rmxmp;u0oexo oeilslm2rlumo;u0teeomfciydfptran i ( t2tr(m3oo4lle mictas a2tm(  nu1tle ifeiadla emnmpnu4tetrmo3iotfaDr uei;t)t2ur(r3iu1omtemivsa()srrrx o;o1tpxomfciasfs emnvs;u)treoxr ty1fa  auesls)s2urim3nu1apt  ivias  Dtmxmo;u0apxo iciydlm ean p;t4aeerir3iytlpt  ivo;s sexm(opnydap n iet () rrm( pno1oexnmo3ildfa2uanmon(0trtoxoctotfmtr ueol() exo(opno1llt  nvta()a2um(mp;o1tlx mocilsfm uaumon() rtrio todopt  neolt)trumxm oodape lncslsf Dtr(ront4oexn feiysla2elu sn() renir ta1omDe nei s0srxoirpnydlmtelies s a2rax oou4alxomoctysfa2em(mo;t)teenmf3tatop rau o;(0srtoir3oo4llenmicias)sDtauronu1tpto o3taslsDrl(vs ()trtoif todomD  i i;s) ruoim iudame mncsa(faDum(rpot1ole iieiadfa2eln s;t4 ltnmo3oy1fmDr nvols tetm(m3nudomtnlnvia(f rrr( oou0tlto o3tysfm ra(vsnu4treomf3iy1fatrli ol() rtm(m oydllt lfeiat sDraumooo4aetnio3iys s2uanvs u4 ltnmf oodopDelivo;()s2to(m ou1al   ivi sfsrta(root0tee  fctyd sDumump;u4aetoxfciodoa raiei;s0seuriopoo4amtemfct () ruaxrpou1oltnmieiyt a ra(vpnt4trerxo tytoat  nes s  2uo(mpou1al n feslt a2raxmonu0tpeo ictytls2rl(mp (0 rtrif oodfmte uei;t t2umim3io4op  lfeiatfa2ur(  oo4tetomieildlm2uau s;(0trtrmr3oytfa eaneo;s0sexo(mpoodlpenlneslsfartru  ou4alx mfeils s2um(mo;(4trtrxo3ta1fp r nesl(0srtr(o iy1am  mivta(fs2taxm no1aeen octatfmDranvp t0arxoxf iatomtrauvo;t  ruo(o3oy1alen ncsatf Dumxm ou1aeeomietat m2eauvs;(4artrio ty1fatrlnvs;t) rxo(r3nudllt  fesltfs2uaurp;o4alt  o3tldla uln p u4 rxrxr tytla rauvi (0 etr(mpoudlmeemfvt s)aDuau  ou0altomoctyt m2ul( o t4 eerxr3iodlmD  ivs;t0trxoiopou1amt mfvils  rtmx  no1ole iociasfmDeauvpnt4 rtnmr oadfat auvs s0seurio3iu4oleelfvt tfaDtrumo;o0aleomoctlsfm ulnmo;t4aexnxo ia1fatean o t)s2urio3no4lmeemnviasfaDrr(  nt1tlen fetldls ul( s (0artnmfctadomDeaues t)srxrirpnudap n fes sfsDtrx poo0tptoif3tyt a rmu s u) rxnmfctodlmDr n s s)t2trirpoodome lfvilt arrmxr oo4opto ocias a em(mo;u) eeoxo3oydlptr ieilt)t2umxopiydomee netasf 2trum ou1aeenioctyd sDrm(von(4 rtoio3iotopDranes;()srxrxm3oodlm emfvslt) Dtmu  ou4aeeoiieiad aDem( s t0 rxomociytla elnvilt0t2trimpnydaltnmicsas srtrxrpnu0tleo fcilt aDrmnms;t)alerxo ty1lmDeaivi;t tetm(opnodlptn fcsasfsrrr(r ot1apxnii3iydla rl(vp ()trtnxf3oadopDrli o s trtm(r3io1llt  iei tfartru  nu4tleo i3tatls rmnvs u4 lerxo3to1oaD  i s;( srtoim oo1lltn fetat) rua( ooo4aexo i3ilsfm2ulnvsn(4 etoif totfpte nvs s0 eumiopoudlp n ivils a2rru  ou4opx mieiltfm2rlnvp;t4trxoxrciytfat aiesl(0trxmxrpoo1oltnmieslt)arraur ;u4tpe iociltlaDrm( onu)altnmr iadfmD an o (0s2uo(o nudapen ivils aDtaum ;o4aee ioeilt s el(vo u4tetnmr iodlateauei;s)s2umxopoo4olenmnei s)s2trur no0tetoif3tyd s2ranmpnu4tlxnircio1oat  neslt trxrir3nu4alte netasf rur(m ;t4tpx  fciysls2uln p t4alenmocty1lpt aiei;t0srxrio3nu1am  lieia() 2trump;t0tlt  fctytlm2ean pn(0trxrirciy1fmtr uei;s)setoio3iydap elfct ()aDrax p;o1ope mieiasfmDelu ont)aeerir3io1lpt luvils0 2xmxrpny4lleemnvs sfa2tauro;o4tpt  o3iyt s umnmo;t0 exrio iodopD an i s teur(m3oudalt lfcsa() rtaurpnt1ale  ietldfs umumon()alxnmoctatlm eli ols0srtoxmpnu1lmt mivtl(  rtaum ou1tle mo3iad sDra(vp;(4tltrmf3tytlaDeln slt trto(r3iudopeemnvils) Drrxrpnu1aptnmicildls2rlnvsnt)tltrio3iy1fmteanesls0setrio3iu4lmtemfcta()sruaxm ot4aeenmociatls umums;(0aeenxf3todopt aivolt)t2xmio3oodlpt liesat  Drmur ;t0aeto ociyd s2uan s (4 eenmr3ootopt  uei t setoxmpio4aleelnetlsfa2rm(m no4aex mo3iyt s rl( s u4tltrxo ia1lptran o t) 2xoir oy4llt mnvsas artm(monu4olxo iciadfa ua( pnt)trtomf iytoaD lueo;t)t2tr(r nu1am   nvs t) Drrx  ;t4tpenifciadfs2ulnvp;u) eenmoctytla  liei t) 2toimpnudlp   ivsltf rra(monu4open fetatlaDua(vont0aetnxr3oadoat  ies (0 rtmimpno1ape  nvilt)aDtrx p;u4aet  ociatfsDulu o;(4tetnir iodfpDeli o s s2xoxo3nu1lpenmnct t) 2ur(ro;u0olto ociyd m2em( p;(0 lermr iodlptrai olt0truoir3iy1alenlnvt t  Dum(r nu4teenmi3iad m ul(ms ()aetnxo3todop eaueslt0trtr(r oydlp  licia(  2uau pnt4tpe iictyslm2ranmo;(0arenif3oydoaDe u s t0 2tm(r no4ap  lieta(fs2tru o;t1opxnifeilsls rlu o;t)aetnxr3oadoaD  nei;( t2toxm iu1amtn iei t  2ra(rpoo4oetoio3iydfaDumuvo;t0artnxo3oatfmDr uvo;()srur(mpnodape lnet s) rrmu  nt4tetnmocildfa eau s t4tleomr3ia1oaD ln o;t0 eto(mpiudlpe lfct tfsDrrxmonu4ale  iciaslaDelnvp;() leoxfctodoatr ivs ()s2to(rpoy4om nlncs t arumx  nt0tlxnmf3ils s uan p ()trxoio3iodlm rlivs;s seur(o no1ope lictl() Drr(ro;u1teeomo3ildfmDran pnu4texrxr3oadoaD anvs ()tetrir iodol  livt t sDumx  ot0aexoio3iadla2rlumsnu) eeoir oytlat  ies;(  eur(r3oudlpeelfetlt) Drmuronu0texoioctldla um(vo t0tltnif3oy1lmDr uei s0s2umio3oydll n neilt  2taxront0tee mf3tltfa2eauvo u0altnif oy1omDrau sls)t2umxrpoodll   ivtltfsDrr(m ou4alt mfeilt a2emumo ()aexrxrctytlm eaies;s0setriopio4al  lnesa(faDtmu pnu1texo feiasla ra( p u4trenxfctytlaDrlueo;s0srtmxo3nu1aleelfvtl( arua( p;o1apxn ictysfs2eanmont)altrif3iatfmDeaivs;t texm(m nydlm emfci s) 2ra( p;o4ape ifctadlmDuauvs (0arermoctadom  lneils0 rto(opou4op elfvsls) rrmxro;u0aptnmoetatlsDeanmsnu)arxnif oatomt  uvo;(0 rurxrpnydlp n ici s srra(mo;t1oeto icild a um(mo u) reoxr3totlmt ai o ( t2xrir iu4aptemnet s  rumuro;t0optnio3iyt a eaump;(0aetomf3ootlpDe neils0trxrxm3iodapee ietls) rtau poo4opt mfciys s uluvs;u0teerxf iotfpt auei;s0 rto(o nodlptnmfcsl( sDtr(mono1oee mi3tas aDelnmon() lermo3ootomDeln il(0teurim oydlp e ieta(f 2tr(rp;u4tptniociltfsDean p t0aexnmocoytoat livils0trxrim3iodomte ivi s a2umuront1aexnmi3tad sDulnvs ()teenio3tytlmDr uvs;(0texm(m3oodoltnlictl( sDum( ont1tle iociys mDrl(vsnt4arxomf ootlaDrluei s)setr(m oo1omtnlnes sfs2rr(  ;u0oexn ictadfm ua(vp u) rtrmo oa1lp eaiesls s2xrxrpiu4amt mivta()srtr( p;t0aee  oeiysfsDumu s u0 rxrio oy1la  an i t tetr(o3ou4lp e ietas a2uaumono4apx if3tysfs eanmp;(4 eenmo iodfm eauvi;t)t2xo(m nydal   fcsa() 2uaumooo4oex  i3iydla el(mo u) lxrxfctodomtranvi;t0 rtoiopny1lltn ivt t s2rau  nu0alen o3tlslsDrmu o;(0aeerxrctytfat anvs;t0 rumio3ny4llen fcs (  rrmx p;t1alxn i3tltlmDel( s;t) leomo3ootlp   ies;t tetmir ny1lmtnlfci (f 2umu pno1tpen oeiytls2em( p u)aetoxrcoydlaDranvslt0 2xmim3oudome miei tfsrrmump;o1tlx mfciatlm2rluvsnu4aeenio3ootoaDr i i;(0trtm(m oydaltemfvtl() 2um(  ;t1oexniociydfm2ra( sn(4 rtnxo3oatfpD luvsl( srtm(m ou1oltemnesat)a2rauroot1altnmoetadfs eanvs;(0arxrir3iytoatraivi s) eumirpio4openmivtatfsrur(r nu0apx iietydlaDrmnvonu0 rermo tatlmtelnvilt) rur(o oo4alee feslt  Dta(  ou1aleomoctyt m ean ont)trtoxf3iadfa   ueo;t)trtm(rpiodalee ivta( a2tm(r ot0aptnii3tad m2uanmsn(0aeerir3tydop e i ils0 2uo(m ny1olt lfcslt) 2raxm ;t4opxomf3iat m em(ms (0aetnmr3ty1lmD  u s;s  euo(r no4alt micsasfsruru p;o0tlenif3tyslmDulump;t0aexrir iadomt lu s;s)truoxm io1om nmnesas)s2um(mont4opto i3ils s2uluvo (4 ltomr3oy1oa e ivo s s2um(o3oy1alt  nctat srrrx ooo0altnmieiys m2ean p (4trxnxr totfm  auvi s)setrim3nydlmt  nci tf Dtmxm ;o4ole  feilt m uluvs;u0tleoxrctodlmDr ivo t t2xo(m3nudopenlneia( aruauront1teto oetatlmDum(vonu)trtriocoytfa rlnvs (0 2xoirpou4lmen ieia() 2uaxr oo4aetoiociydfm2rl( o u4altrifctodomDrlu ilt) exo(rpiu4amtemfcsl()s2urxm ;t1apeoiieiydfsDrlnmont)teermociydopD  nvo t) 2xrir3nydam  livtls)aDuaum nt4tpe  feiyt a rauvs u4teeomo3oydlmtr ivo s s2umxr3oudal nmfetas a2tru oot1tptomictltfaDua
\ No newline at end of file
@@ -0,0 +1 @@
+nvi;s0 etoir oo4lm   fciat) 2tax pnt4tptnif3tlsfa2rmn o t0 leoifctatomDelnei;s0trtoim nu4ole licsltfarta(r ;o0tpt mi3tysfm uln pnu4trxoxr3iadfptr i i;s)texrxm no4ole  ietat  Dtax  ou1tee mo3iyt m emu o;(0tlxomo3oydomtrlueil(0seur(r3io4lpe lncs ( aDua( ono4olx miciytls rm(mont4altrmfcoy1opD ln il(0trto(m3iu4lp nlnct s srtaxmoot4tltomfeildls uan s;u4tlermo3iatlptr n i;s0t2um(mpoy4lptelies (farraxm ;o0aeeo iciyd s raums;u4arxnmo iadfaD  neo t0tetr(rpio4lm nmivt sfsDtrurono0opt iiciys m2emu snu) eenxo ta1lpD lnvo t0s2xoim iu4alenmicslt sDtax pou0aeenii3iyt mDum(ms;u4 etnxr iytla rauvsl(0trxmxopnodamtelivsas)sDrru  ot0tlt iiciyt mDua(vp;t4 lenmr3oytfptelues t  rto(o3iy1llenmfesa(faDra(m oo1tetn oetysla eanvo t)arerxr ia1fpD  u s ()t2umxmpnodap  mnet s a2um(  no4alenifeilt mDuauvonu4altrxo iatoa r i i;s0tetmxo3ou1amtnlfvt s) rtrxmono0alen oeiytlm2em(mp;() rerirciadlmDe nei;t)srtm(rpoy1ll   nes t)srta( poo4ale if3iydfaDrm(vs t0areoif oadla   nvi ()setoimpny1omtnlfesa(f rtrxmo;t4olxnmo3ilsla umu pnu4 lxoir3oadoa   neo s trur(rpoo4om  licia(  Drru o;o1tle iietasfaDemnvp u4artrmo3iy1omDeli sls)s2umxo iu4ap n nvslsfsrtmurp;t4opxomi3tydfaDeln snu4teenmrctydoptean o;(  ruo(rpnudapen fetlt) Dururpnu0optniictatfs2umn p t0artnxrciadlmDrli s;s sexr(r io1omtemneil()s2tr(ro;o4tpxnifeiad a2rl( s (0aetrmf tatlmDe nei;t0s2uo(r iy4opeemfctas) rum(m nt0olenio3iatlmDeau s;(0aleomr oadfpDeaivils0 rxr(o nu1lp e fvtas) rum(r nt4tpxo fciys s2ra(mpn(0texnxo oydop rlivi;(0 etoio nudlleemnvias)aDtrur ;t4olt ii3tlsls2rlnms;u0texrxociytlmD  ies s  rtoxm io1amee netls a2rm(rpnu4ope  fetas sDemuvsnu)arenir3iodfmD anei;s0seum(r3iu1opt mietls)artr(rpnt0alt ifcilt m2emnvs u0tlxrir oadomte ueo;t0s2xr(o3oo4ol elietlt a2trur ot4alenmo3iaslm rmu ont4tleoxo3oydfptr ueols)s2toimpny1ap e fci (fa2umxr ou4altomfetldfm2rl(vonu4trxoxocoo1la r i o;t0 rxrim iu4ome  nvsls aDua(  no1alx mieiydfsDrlnvo;t) rxrxfciodfa   n i;t  2toim no1altelnctatf 2rm(m ou0tpen iciadfs emu p (0tltnifcoo1fp rau s;s s2urxmpoodlpeemfvtl(fs2rmxmoou1oeenmietysfsDem(vsnu) lxnxf3oa1fa eauvi t s2xoxopiy1omtnmnesa() rrmum oo0aetniieilt a rmumsnu0 ltnif3oa1om e u ols0 euo(rpiodamtemfetl( a2uau o;t1oetnmf3iadfm umuvo (0aetrxocta1op  an o ( trxrxrpny4amenlfet s s2trur ;u0opeoiicilt m emnvsnt) etomo todfpDraies t t2um(r oudlmeemncsltfaruru ooo0aetomo3iasfaDrl(vsn(0aexnir3oy1omteauvol() 2uoxrpny1ol elfcsa(  rtmxm oo4apenmoetyslm uanmp;t0 ltoxociatfat aieilt)s2tm(r3ou1omen feia(farta(ro;o0apto ictyd s emu ont) reoxocoydfptrlueo s0s2tmim3io1opeelnetls) Dtauroou0tpenmi3iydlaDel( ont4trtnir iatom  livs;t) euo(m iudoptnmfei tf rtmurpno0tet moeiytla eanvp;t0 eeoif iytfpteaies;s  rur(opoodlleelfct ()sDururpnu0opeo ieiltfa elnmo (0aeenxr3io1fa e i s (0setoir3oo1lptnmnvils) 2tru o;t0oex if3iltfsDuln snu4aeenmo io1omt ln slt srurxr3iu4ll emivil( sDumu pot1oex mieiytls emums t) lxnio ty1lpD lnvi ( sexr(m3nudoptnlivsl(fsDrrx  ;o4tpx mfctlsfm2eaumpnu4trxomr3tytfat lu olt)s2uoxrpoudlpenlici (f rraxr ot0opxnioeiasfmDrmumsnt)aexoxo3iatfa  ln s t)s2to(mpiudlptnliet t  2ua(ront1aee  iciadlm ra( on(4 exrxr tadop rau ols seur(o3io4lle lnvtls s2ur(mpno4oleo ieild aDum(vont)aetomo3iy1la eanesls s2tmimpoudamtnlfctat arurx  no0tlxoii3tlsfsDean ont4 lxoxr3oy1opDelues s  ruoiopoy1om  mies t)arumu o;o1optnmfcilslmDum(vo;() etoxo oodop eln s s)t2xrirpoy4lltnmfvslt) Duax pnu0apxnmociasls rmumont0tetrxo3iydfpteaneo;(0 2tmir oo1lle mieta(  Duru o;u0tlt ifeils mDeanmo;t4alenxr tydomDrlieils)srxm(m3iu1ameelicslt)sDrrxrpnt1tptnmoetyslm2rlumo u) lermf iadoaDeanvi (0t2to(mpnodaltnmivtat sDtm(mpnu0tpen feild a ea( s;t0 ltoxfcoadfpDranvolt0s2xrxo oydam n fcilt)arta(m oo0aee miciad a2rlu p;u0treoif3oodlate nvo;s0trtmio oodlp  lieia( sDumurpoo0olxnmoeiysfa2ea(mp u0tetoxo tytfa rauvs (0srto(o oudoptn iei tf 2tmx p;t1opeomf3ildfmDrau o;()trxomo3oy1fm  li o;(0 rtmxm3iy1ll emfvtat)a2trurp;t0tlt ifciysls2rlumont) rxrmr3oy1op  aivi;(0s2tmir3iu1omtnlnci sf rtm(ro;o1oee moeiys sDrl(vs;(4teerircto1la ran o t) eurxr nydapte ieiasf Dtmx p;o4olxo o3tat s2rmnvonu0tltnio3oatlpDrlu i s)setm(r oodlpe mnvslt)sDurxmp;o4aetoioetlslm em(mp t0 eermo ty1lmte uvil() 2xoir oy1lleelfet tf rurumont4oetn o3iltfm2um(vp t)aexnmrctadfmDrluvs t)t2xmxm3ny4opt mncsas  2tru  no0apen ieiltlsDem(monu)arenxr3iydlm eanvilt0trxmim nodolee nvta(f rtmxm nu1oee mictasla2ua( ont)altoio3oydlpDr n sls  rurxo3ny4amt micsa()sDua(rpnu0olt  o3iadls2elumonu)tlxrmf oodlpDr nvi;s0sexmxr oy4amtn iesat aDrm( pnt1aetn ieiydlmDum(ms (0aexnmocoo1lm  aivs t0 rtrxo3ny4ome  icilt)sDuax  ou0apeo feiys s2rlnvpnu)trxomr3tydoa eauvo ()trurxr ny1al   icsa() rumu  ou1aet  oetys a ran o u)trenir to1fm e ueols0 euoio3iydamt  fvtlt sDtmxrpoo1olt iociad sDrmums u0tltnxfciotoa r i ils s2urio ou4lptnlnetatfaDtau ooo1tpxniictytfmDem(msn()teenmo3tadlm  anvi;s srtm(o io1lptnlnvsasf rua(m ;t4oex mietadfs2umuvp (4tlerifcoytlpteaivo () rurim3no4amt lictatf 2tr(rpot4tlxomi3iat mDelu o;u4 exnif3iadfateaueolt0 rtrxrpio4om  mfctlsf 2tmx  ot1ope ifctlt sDrmn pn(4tlenif3oodomt  i ilt t2xmio3oydlm nmfcta(fa2uauro;t0tlxnifcildlaDel(vs;(4trtnmo totfptrln i s seumxm oydal nlnei (fs2ta(mp;u0tee moeiatfs2rm(vsnt) rtnxr3todlmD aneo t)t2xoio iu1ap n netlt srtr(rpot4apto fciadfm2emnms;(0 lermr io1fp r u sls) rtmio oydole mncs s sruauro;t1texomoeiad aDem( pnt)tlxriociytlp   ivils tetmim3oy4om n nvt () rumu o;o4aeenmictadfa umnvo;()alxnmr oytopD  ieil()t2xrir iy1ole  nei (faDtrx pou4aetoioeilsfaDrln s u) lerif tatlmDe nei s0 2xo(o3nudlltelfesls srur(mp;o1apxo f3tadlsDel(vp;u4 etoxr oydfmD luvolt s2uoxm3ny4ope  fci ( s2rau pno1apxomicilt sDuau s;u0arerir tydomD  nei;s)t2urxm3no1lmenmnvi ()srraurono1ape  oetadfa2eln pnt4aeenircto1fm  li o s) etm(m3iy1aptelfcil()s2rax  no4oleomf3ild mDemnvsnt4texnxr iy1omDeauei;s0 rxr(opou1aptelnetl( srrau o;u0olx  ieilsfa2uluvo;u) exnir3oadomtelnvs (  eurio3iudol  mfetltfsrtm(rp;u0teto o3tatfs ea(mpnu0 etomo iotfaD aivi;t)trxoir iodole mnvilsfarua(r ;t0oexn ociltls em( o;() lxnio3ia1lptr uei;t)truoxmpoy1ope liei s) rua( o;o4altnmi3tldla rm(vo;t0 eeomr iatlaDrli s ()t2uoxo3ou4lp n nvtltf Drru p;o0aeen fciasfs2uanvs t)arxnmfctytlatrlieolt) rumim3iy4amee icsat  Duaxrp;o0oltnmieiltlaDean s;u4 rtnirciy1laDrlivo t)srtoxm3oodopt  icsls sDumu o;o0alt mi3ilsfaDel(mp u)texomfcia1lmt  i i;t0s2urio no4alt mfviltf Dta(r ;t4optn oeilsls eluvs u0 rxoiocoadla  lueo;( srurir iu4om nliesat)a2trx  oo1oee  feiadfsDulnmo;(4artoif3to1lp  au i (0 2trirpiodop emnet (fa2taur ;t1tle ifeiadfmDum(mon(0trxoio totomteau olt) 2tm(m3ny1llt  nvs (f rta( oot0aexo o3tasfa uluvo u0 etnif oy1lm  luvi;t s2umirpoy4aleelieiltfsDurx ono0tpx mfeils aDrmn pnt)alxrir oy1optraivs ( s2ur(mpnydaltnlnetas artaxro;o4opxoif3tyslm2rm( s u4alxrif3oa1fp rai olt0s2xrxr nu1lptemies sfa2trxr oo1aexnii3tltfs2emuvs (4alerxo oadlp eanvilt0setrxrpnydopt miei t) 2ra(rooo4tlt  iciatfm uanmp u4tlxoxf3iydlpt lu olt tetm(r io4llen fetas)arurxrpou1texn oeildfm eauvp (4 lxnio3oy1oat  uvi;s teur(r3ny4ome micta(f Dtau  no1ope  ieias s2ulu s u0 rxrmf3ta1lpte ivsl()trur(r oydaltemnesltfa2ta(r ;t4olt  ietatls eln o;u4arenxociotopDeau s;s0tetoxo3iu4lpeemicil()a2ua( ono1oee ifciasls2rluvs;t4 eerxr3iadopte nvi ()teurim3oy1altnmfvil( srtmx  ot4tlt mieiydla2ea(vp;u) ltomf3oadomDeaueo () 2xmxmpoo4omenlfvs (fa2raxroot0tpeomoeilsfa rln o;u4 eenxo oy1fa r ues t)sexrxmpnu4lmtn ict (  Dtmxmp;o1olenioeiltla rmnmo t4 exnir3iadomt livo () 2tmxm3oy1altnmictl(fsruaxmpot1alxoiiciat mDean pnu0alenmocoytfaDe uesl( t2xmxo3nu1am elncsatfs2tax pnu4optomf3tys a2eau p;(4 rxnxf totfpDeauei;t) eumxrpiodlp nmiciasf rrrx  ot1altnmictyd m2eluvo;(0 reoxo3tadlpteanvo ( trxoio nu4op e fvsat)aDuau pou0alxnif3ild mDrlump ()altnmrcoo1fa rlnvs (0t2trim io1optelfvsas) rum(mp;u1tetomfcils m rm(mp;t)trtrmf tytlmD  n ol() euoxm oudlptn ict s artaurpoo4oexn ociadls2eaumpnu)trtnir iodopte nvi;s0trxm(opiu4am n ivslt) rta(ro;o4tex ioeild a2ea( o (0alxniocootomDr nvil(0tetrim3oudlmt lncsa()arraum ;u1oet mfciytfa2umu p t4 ltnio3todfmt li sl() 2toim3nydop nmfesltf 2ta(m ;o0tex mietlsla el( p u0 etrir oy1fatrai s;(0srxr(m oy1ll  lict s)aDrmx  nu4oeen fctyt aDea( p (4artoxf3oodfm rlnvs;t) 2umim oodal   nesat)s2ur( oou1ope io3ilsfm raumo (0 exoio3iodlmDrln olt  2um(mpiu1om e nvslsfsDtmx o;u1tptnioeiytla2rmn on(0 lxnmf3tadlaD  neslt)srxo(m3iydlm elfesl(fsDrmxmpou0aetoiiciadlm2umnmp;t)tlxnmocoy1fp rlu sl(0trxrir3iy1ap emiciltfaDrm(ro;t0apto f3tlsls2uau p (0altomr3oo1lpD li i;( t2tmxrpiydame  nctls) Dta(  ot0oltomi3ildfa umuvsnu)aleoxrctotomtr nes t0s2trxmpno1alee iet s  2tm(mo;t0apx mi3ild aDemu pnu4 exomf tadfmDr uesl( tetrxo oudlm nlieils  2rr(m nu1tpt mfeiaslm2rl( s;u0tltnmf iy1la r i s;t s2um(rpoydame lnci ()artmu p;o1teto f3iatfaDrlu s (0 ltoif ty1lpD  ivsls  2tr(r nudlleemietas srurump;t0oetoifctadls ean o u)artnxrciatlpt  nvi t0 etoim ou4ap elnct
\ No newline at end of file
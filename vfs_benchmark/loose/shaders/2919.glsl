@@ -0,0 +1 @@
+ivil( t2xm(r oudlltn nvia()sDuaxm no4aex mociytlmDemn o;t4tltrircto1lpD ln s s)trxrio3nu1opt lfvsl()arumumont1tex  oeiltlsDemnmont0 etnxo3iytfptr ivi;(0 2toxmpou1apeemivs ( srum(  ou1oee mo3tasfa ua( o;u0tltoxo3tydfpDr uvs;() 2xmxmpnu4ll   ies t s2tm(mp;o1tptn o3ils s2ul(vp u0 eeoiocoadlaDe i sl()sruoxm nodopenmfeslsf 2uax onu1apen f3iyslm el(mo;() ltoxo todom  luvi (  rurxo oy4ol elfesls s2um(roou4tlxnifcias s ra(vo ()aexnmr3iytlm elivols t2xmxr3oydlm  mfetl( a2urx o;u4opxo f3iasfs uanvonu) lxrmf3oytopte iei s0 eumim iudop nmivsas)a2rr(mp;o4opeo i3iyt sDemuvp;t4aexomocootfaDr nvs;( t2xrir3iydlptelnvslsfarrm(  oo0aetomiciadlmDem(msn() etnmo3tydlp rai i ( s2trxrpiodale mivi t s2um(mpnu4tltoifetaslsDum(vpn(4 leomf oy1laD  nvs;t0seuoir io1lm  licilsfa2rr(r ;t1apeoio3iltfsDemums u4 etrxo3oa1opD livi;s)s2ur(rpnudal emnvtl(fsrtmxmoou4tptomiciysfm rmnms;()artoiocoy1fat aueslt) 2umxm3nu1ameelict t a2tmuro;o1tlxnmoetltfa2rauvs t) etnmr3tatop   ivs;s) 2toxm3iudopeelnet s arrrxmpnt0ale ii3iasfa2ea( o t4 leomf oytoptraivs s)s2xr(o3oo1op e icsasf 2tau pou0oex iociatfs raumsn(0 reomr3oa1fmt livo;t  2um(r3oodlpenlfcias a2um(rpnt1tpe iieiysfm uau o (4alxomr3tydfpt au o t0 exoiopno4apenmnei s)aDum(ro;t1aeeo fcilt aDul(vsnt)aeenxr totoaD au ilt0t2xoir3no4lp n ivs (fa2ur(roou1olx  fetlsla eaumo ()trtnmfciodlmD  n s () rtoxr3oodopt lneilt  Drmur nt4oeto f3ildls umnmo ()aeeoxoctytoaD  i sl( srxmxo3oo4lpeemiviat sDtrxrpou4tle  fciatla um(mp;t0alerxo tytoaDeaneo;(0srtmxm3oudap n nvtls  2trurpno4aexo fcilsfs uanvont) exnmr iatlaD  n olt0 rumir ny1lpt mnvs sfs2ra( ooo0aet mfeiltla emuvpnt4aleoir3ty1fm e neils0sruoxr oy4llt  ictasfa2ua(rpoo4ope  o3tlsfsDrmuvsn(4tltoxoctadfm rluvolt0t2xmxr3ou4ll emfcsa(fsDrax oou1apen feiltlm rmumo;u) eenxr3iy1opteluvsl(  exmimpny4al   fvs t)s2um( onu1tlt miciydlm2emnms u)texnir3iodlp rlnes t)seurxopiy4opt lfcs t)artm(mpnt1tpeoioeiatfa2em(mpnu0arenxr3oodfmte u i;(0srxmir3no4aleelnvs s) Drax  nt1altnioeiatlaDuanvo t)alxnmfctytfp ran i s)srur(o iy1al nlfvtat artmur ou1apto octas aDuluvo () etnmrcoy1fmt  uvolt)t2xo(rpoodlltn fci tfaDrrum nu0ape mf3iatla rmnvp;t) rermociydoatelnvo s sexm(o3io4al emfci t a2uru ont1aeenioeiyt a2rlu snt0tlenxr tydoateli o;s) 2urxr nu4ol  lneta( aDraxm ;o0altn i3ildfs2ua(vp u4aetrmr iotoatraneilt0t2xrxopoudopenmneslt) 2rau p;u4optn ietatlm2rluvp () rxoxr3tadoa r uvol(0tetoio oudom n ivtlsf Duru pnu4olt mictlsfs eln o u) rtnircoytopDrln ils0srumiopiudop nmfvi (f 2trur ot1tltn icildla2uan s () exnxr oa1laDeanesls  etmir oo4oltn fei ()a2ua(rpnu1olxn fetatlm uan snt0teermr3tatla eli ols0trxmiopnu1lp emncils s2rm(  nt4tlto i3tytfaDua(vs (0alxrmf ty1fmtrlieils0 exo(opno1oltnmnct ( aDumx pot1apxn o3tasfs rluvpn(4 ltrirciadfpt  u i;(0trxo(m3ny1amtemivs t sDra(m oo1aexo ieiytls uanmpnt4tetomo iatoate n o ( t2uoim iudlp n ivs ( srrmur no1teenmo3tydfm ua(ms t0 eerxrcio1lmt aieslt) ruoim3oy1lp emnvtatf 2ur(rpnt1tleomieiltfa ulnvo;u0tltrxf iotlpteau o t  etm(m oo4amt  ivtat aDtr(moou0tex io3tysla elnmp t4trtrmr3iotopDelu o ( srxm(mpiodomt  nesatfs2ra( ont1teeo ietaslm eau s;t)alenxr3iodfp eln o t0setoirpoo1aptelfei sf rum(rpno1texomieilsfm2eau s t0tlenmrciodopte ueolt)setoir3nudlptelfctas a2uru  ou4apxnmociatfmDuan s u4trtomo3oydom eaueils0 2uoiopoodlpe lfeil() 2tmxm ou4tpxomoetytlsDumnms t)tlenifcio1fmDeai s;s0s2umim iy4op nmfcil()a2rrxm ou1oetoif3iydfm2el(msnt0texnir3iatlmt liesls)seuoio nodlp   fesl(  rum(r nu4aetn iciaslaDumnvs u4arxoir iotfaDr uesls)tetoxrpoy1ll emieiatfsrtm(ro;t0olxo f3ildfa rmnmp;u)alxomf3io1lm  aieol()s2xriopiydlptelfvt sfaDtaum ou4tpenmfeildfm2eln s;t4 lerir3oa1opD auvi;s t2xmxr3no1lmee nesa()s2tmxmp;o0tpx  f3iat sDrmnmpnt) ltrmf todom   u o t sexm(m no1lptn ietat aDra(rp;u0tee  fciyd sDemuvs () eerif tatomDeli o s trtmir3iy1lltnmnesasfarurxro;u4alenmfctlsfs rm( snu)aeeoxo3oytfaDeanvo t0tetmxo3io1ol  lfcia(  Dumumo;o1oexniociad m2rmuvsn() etoxo3todfpDeau i t) exmimpnodomen fcsa( srtaxmp;t4tpt iicils sDuauvo;(0arxomf3oodlpD lueo s)texo(r3io4omeemneslt  2tmxmpot1opeoif3iytfm eaums;u)tlermr ty1oatr uei t0trtrxo nu4om   iet t a2ur(  no1texnmf3iltla elump u)tetrxr3oydfmteliei ()t2urir3oy1om emivi s  ruaump;t0tlenmf3tasls rl( snu0artnxr oytfm rlnvslt0t2um(o iodllt  fvt sf 2tr(roou4apx ifetldfs rmump u) rxniociytopt anvo;()srurim io4lptnlfcsltfsDtmumo;u1ale  fctadla2ran sn(0trtomrciydomDeaiei t)sexmio oydlleemnvias s2ta( pnt4ope  ieiydls2ua(vp;(0trtnxr io1oatrln s s0s2umim3oydlmtn feias s2ur(rooo4ope  feiyd a2emuvp;(0artoifcoo1lmte nvolt)sruo(m3ou1aleemiei t aDumumpou1optnmo3iadlmDuaump (4 eerir3oadlmDrau sl(0s2xoxrpiu4lm n nci tfa2tmu pnt1oexoiociat a emn p t4alxrxrcoatop eaneo t) eto(r ou4lmen nvslsfa2rmxr nu1aetn f3iysfa ran p u0 etoio3ty1oaDr uvil(  rxoim oudamtnmieta(farrrum nu0ale moeilt aDrm(mo u0altrircty1lm r neo s)texrxr ou4amenlnet sf Dtrxr oo0aet mi3tysls elumont4 rtnxrcia1fm e neols  2uo(o iy4altnmfetas)sDua( p;t0olx ifetatfsDeanmo (0tetnxfciodfpDraieo t trtrirpnudapeelnvilt  Dtm(ront1alxniictas a2em(ms t) leoxf3oo1optrln s s0 rumxr3no4lmt lnesas)srtau ooo4aexoiieiad s ran sn()texrxrcoa1lpDe nvs t0setmimpou1lleemfesltf rurur nt1tlxnmo3ildfm2uan onu0 rtoir3todfm  luesl(0tetr(r3ou4oltnlnciasfsDtaur ;u1tltnifciytla2um( s t4aeenmrcoytfptelueols trtmio3iodlm nmnvs t  rtmx oot1tlxn octydlmDemu p;t0artrxfctadlpD aueslt)sexm(rpiydlltn ivtltfaDumxrpou0oee if3iytfs2rlnmon()teermf3to1omtraneslt srxrxr3oy4ape mivt t a2trx poo1teenifcias aDranmo;(0 etoxf3to1lp r ivs s)srtoio3oudomt lfcs ( s2rm(rp;u4oexn f3tltfaDeaums;(0 rerio3io1optranesls)trur(r nu4om n feilt)a2tmxmooo1tetniieildfs rlnmsnu0trtnxo totlaDr ieo;(0srur(o3iu1opeelnet s  2uaur ot1optomoeiat s rluvo;u4aeerxf3iadomt ai s;()seuo(rpoy1lm  mieslt arurx o;u0oee  octysfa rmu s;t)tltnxo3oytfpt  ieslt0s2toiopiodole mncta()sDuaxroou0ope mf3tadlm2el( pnt4 lxrifciytlpteaivslt sexrxo3ou1olte ict t arururpou0oee  ictlt m eaumon(4tlxoio3iotlpteanvo t0 etmxo ny4ame lfcslsfaDuauroot4alxoiieilt m rm( o;t0tlerxrciotlat  nes;( s2uo(opnydameemfet tf rururont4tlxniicilslaDranmpnu0 eenmocoytlm r neslt  2tmirpnydameelfeiltfs2ur(  ot0oetnioctydlsDemn p t0tlxoiocoatlate i ils0srxrir ou1oltemnvilt) Dtaumpoo1aleomietydls ul(vo t)arxnircoo1fm r nvo (0 eumxopoo1opt liesl( a2trx o;u4ape  o3iasfs emn onu) etoxfctodoaD lueolt srxoirpnudop e icia( arum(mp;t0aleo ieiyt mDemnvont0teeomr oy1fpteaieilt teto(o iu4lpee nes tfa2uaxr nu4opt  fctlt a rlnvont4 rtrxf iatfatrln sl()t2trir oo4apt  fvia() 2urumpot1tpxniietyd a2ulu p;u0 ltrmrcia1oaD livs;()trurxopny4olenlieiasf Dtm( ooo1aex  iciysfs2rmn o u0trtoirciodfm elu o;()seuo(r3ou4altnmfetasfsrraumpot4tlxoifeias m rm(vo u4aetnxr3tytfptraues s)teuo(m3oo4ameelnctas s2trxroou1apenmi3iyt a2ra( o;u0tltnif oatom e ueo;s0 exoio3iydope lneia()srtaxrp;t0tleoifeiydlaDrluvo u0tetrmrciadom raivol() euoio ny1ol n ict sf 2trxm ou4apx ifcils m2ean pn(4artnio3iy1fatrlueilt  exrim3ny4amtn nciltfsDrr( onu4tltnmi3iltls emuvpn(4 etrirciy1op rlu i;( srtm(o3oydlltnlncia()aDumxroot4olt ii3iyd m2rm(mo;u4texrxfcoodom  auvs () 2tmirpou4apt lfei t sDurum ou4apt  ieils s2ra( s;u4texoif3ia1om  lieo;()texoir iu1lmeelicia( s2rm( pno4aeenif3tldfmDem(mo t0texomo3oo1omt  n sls setmirpiu4lpeemnvi ()aruau pou4aeeo ieiyslm2eanvs;u4 rxomr tadfmDeaivs;t seur(o3oy1lmenlfvsl()srtrx  ou0opeoifciasfs2em(ms u0 rtnxf oo1fp rliei s)trtrxmpnydam e fctlt)a2rmxmpot0optomociatfa rmnvp;t0 eenio3oatfa e ivolt srtoxo ny4lme mfvsat s2urxmono0tpxniieiat mDrl(vont4 exoifcia1op rli i () rxmio iu1lle lfct (f Drmumpot0olxo i3tyt s2rmn o u4altrmr3tydfp ranvsls0teuo(m oy1lme  nvtl(fa2uauronu1tptoif3iltlmDem(msnu0tlxnmf3totlat lnvo t) 2trxo3ny4ol e netas srtrum oo0teenif3tasfa umnvpn(0teeoxo iy1fmtr nvs;s trur(m nu1op e fesl(f rrm(mpot1alxomicilslm2umnmp;()tlenir iydlptran o t0 exm(o3io4om emieias  2rmxmont1tltnmfctad s um(vs;(0aexrxrctytoaDe n o;() rtrir3iodop emncil( arrrx oou4texoio3iad sDrau o (4 ltrmr3iotfmDe i s t sexrim iu1apeelictlt)a2ururoou1aet  f3tat aDea(mont) lenmr oodfm rlu s ()t2trirpno1al elfctl(fsDrr(  oo4tlxnii3tydla ea( p;t)tltnxf tydlmDrauvi t teuoxo3iy1ll n ieta(farra(ront1olx  ocild mDua(vo;(0 rtrxf3tytlpDr nes t)texoim3iy4amte fetl( a2tm(m ot1oet moetlsfm2emuvpn(0texrir ootlpDeaueo t)srumxr iu4lmenmfvsl(fs2trxmont4olenifetltlm emump;u) lerio3todom ranei;t) 2xrxr iy4amtelfci ( a2rrumpot0altomiciysla2em( o;t0 etnmr3tytfa raivo;s texo(opio4opeemies tf rum( pot1tlxo oeiydls2elu p u4trenxocta1fmt  ivi;()setmxm nydomenlnct (f 2um( ooo1ole io3iatfmDem(vp t0tltnir3oo1op elueil()t2umxrpoy1lpe  ivsl( aDtau  oo4oltn i3iat s2rm( s u)altoxf3iy1opteln s ()s2xmxo3nu4amenmfesa( s2uaurpno1teeomoetysfs rm( o (4trxoirciadomD lieo;t  euoio3nu4alt lfcs (fs2ra(  ;u1tee iiciytfm2elnmsnt) lenmf3iodlmD luei;( tetrirpny1lptn nesas)a2rm( p;u4tlxo o3iltla2rm(mo t) rxnxrcoy1oat lnvi s0 rtrxr3iy1op   ivt (fs2umx o;u4aeenio3ilslsDulnvs (0 rerio oodoate neil(0trum(r iu1lpee iei tf rrr(mono1oee ioetldls2ra(mo;u0teenir oydfp r nes s0 ruoxr3iudope mnetat aDrau onu4tpenifctas mDuluvp u)trtnio3tadfpte nvslt srtr(o iu1optelnesltf rrrump;t1tptoiiciyslm2el( onu) etoiociatomte u i;s) rxoxr3iodllenlfctat  2tm( ono1ope mfctlsfs2emu pn(4tltnif3iydlatrlies;()trtoiopou4lp  mneil(  2rm( oou0tleniicils mDrm(ms u0tlenif tydlptr neo;s)texmxm nodlmte nei t)aDrr(  ;u0tptoio3iysfa el(vont)tlxrif3oadfmD ln i t)t2uoxrpiy1op nmnvsa()a2urxroot1aex  iciltlaDeln o;t)alxrmo3oydoat ai sl( srurim3iu4ale lnetat a2umur nu4texniieias a ulnmp;u0altoxf3iytlpt lnvs (0texoxmpoy1lptn neils)srrmx poo0tptomieild mDulnmp;() renmo3oodoaD auvilt s2xoxopny4lltelicsls)sDrmurpno0aexoifciad m2rl(monu4altrio3oodlmD lnvs t0 rurxopiu1ol  lnctas)aDtru  nt1tetomfciad m rluvo t) rxnmrciy1op r iei s)s2xoir3ny1om elnvtl( artmxr nu0tlxniicilsfaDrl(vsnt0tlxnifciadfpte uvi t teumim oy1lm   ivia( sDraur ;u0aet mocild m eluvs;u4 etnifcty1lm eln slt0t2toxo iu4ap  mietlt) 2uau o;t0olen fciasfaDel(ms t4trxnmfciytfmtelues;s) 2xm(r3iy1al  mfcias srtaum nu1aetomfeiasfa elnvsnu0 rtnmf3oatoa rlnes t t2xmim3io4lltnmfctas sDtmx  oo4ole  o3ildfmDul( p (0 rerir oadlmt aivils  exo(o iodlm emfetl( a2tmuront4oexnii3iyslm rl(mo;t0tetoio io1fpDelu o;s0t2urxm iu4llt mnvsas)aDra(  no0olenmfciyslaDum(vs;()aexomoctatfpte i ils)s2xo(r3io4lm   fet s)arur(ro;o0tltomieiad s ul( s;(4teeoir3oodoat aues () 2uoimpoy4olt mfvilsf 2ra( ont1ole  fetadlm2em(mo;(0aetniocty1lmD  nes s)trxo(rpoudlmenmfvs t srururoou0tetn fetltlsDrmuvp;t)trenir oy1la  aueilt0 etrir iu4lptn nvt tfarta(mo;o4tlenmi3iyd a um( s;t0areoxr oytom rlnes;t0 2to(m3iu4lp  lieias)a2raum ot4aleomfciyt mDumuvp u)arxrxf3oatomte n slt teurio ny4ll nlfei sfsrtru  ;o4alt mieiatlmDrlumonu4areomr3oatopteai o;s tetrxrpoo4lm e fetlsf rrruroot4optn i3tat m uluvs t4 exomo3tatla   neo;t)srtoim3nu1apt liet s)aDuaxmpou4optnio3tas aDrln pnt0arxriocoydfm   nvo;(0s2uoim3iudope mfctl(fartm(mono0teeoifeiydfm2raumpn(0trenio3iytlpDraivi (0sexoio3nu4om elfcsl(fartmxr ou0aeeoio3tyslmDua(mon()trtoxr3oo1optelu o;s  rum(o3ou4ap e nesls aDtm( pno0altnmo3ilt m uluvs;()texnmf3ootoa  aiesl(0 exoxm3oo1omenlicsas aDtr(  ot0oet  fciatfs umnvo ()artrxr3tydom r uvo ( t2toxo3ou4ameelnet s  Draxro;t0oex micias mDrmu pn()aeenxocootoptraivo (0s2tm(r nu1op   fcsls  rrrxm ;t0alto ocilslm2ea(mp;(0 exrmrcoy1fpt  i i;( trtmxr3ou1lme lietls aDrau  ;t4apxoio3ilsfm el(mpn(4teerxo3oatfpteln olt0 2tmxr iodol nmncsat) rur(  ;o4aetnifcilsfa2raump;(0arerxo3ta1opD lu i t trxmirpou4ap e ietas)aDraur nu1texomoeiadfs2um(vs t0arxrmf3tatopteli s;t0trur(r3oo1alt mieiasfartaumont1alen icildls ua( s;(0texomf3oydomtrlnvi s0s2xrxm3iu4optemncs (f Dumxront1tpt miciatfs2rl(vs (4tltrircoadlpDr ivo;s srxoxm3ou4lltelfei t srrr( pou4altn octytlm uan p (0texnxrctadfp rlnvol(0s2tmxr ny1ap   ivtltfarta(mpou0tetoiocilslaDranms ()tetoif3tytfmtraieilt) 2uo(r nu1llenmnvtat) Drr(rpou1apxo o3tydfmDumuvo;t4 rxrxo3tytoa   i s;(0 rxrim3iy4ll e nes t srtr( p;t1apt mfciat mDuluvp;u)trxomociadlaDean s;s  eum(r3no1lle lnes tfaDumu p;u4tpx ifciytfa el(mp (4treoxf tatoate neils setmxm3nu4om e feslt)aDraxmp;t4oee  f3iasfsDranmont4 lerxr iy1omte u o ( t2tmirpiydlp elfet t) Dtau oot1tpxoii3ias a rln p;t)arxoirciytlmteliei (0s2xoim3ou4alt lfvtltfsrtm( oou1alto ictytls2em(vsn() eenxf iytfp e ueslt t2ur(r ou4oltemfvi s a2ra(mooo4opx iiciyt m2rmu o u0 eerxr3oadlaDrlu sl()tetoxr iudlptelfvtlt)s2ururooo4optnmiciysfs2eau snu4 rxoxr3iodlpDe nvilt trurio3oy4olt liciat)aDurxrooo4tlxnmfeild s2rlu p;() eerirctydoptelies t trxrxm3io4om nmnvsasfsrrrxrpno0oex if3iad m2rl(ms;(0tlenioctytfpD auvs ( srtmxopiu1lmtemnciasf rta(mo;t1teeoifeiadls2emnvsnt4altoir tadom   neolt s2umxm3nu1altemfvsat sDrm(r ou0ole ifctaslaDean s;(0areomr3totlmtraueo (0 eum(m3ou1oleelfvsl(fa2trx  ot1oltnio3iatlm ranvp;t4trenmo3oodlm elnvsl(0texr(m iydaptnlicsat s2tmu  ;o1tetn o3tydfs2em(vp;(4 etnmo3oytfatrlnvolt)trtrirpou4om emfviat)srrmxmoou0opt mieiad a2eanvpn()aexrxfctatomDe uvsls sexrim3nu1am  miviat)aDrrumooo4apxn fetlsfsDum(mo;t)trtoxo3ty1laDe u o () rurio oy1lp e nvias) Dur(m nt4aeeo octasfs ean p;(0trxrxf iotlpt  u i;()texrirpoo4lm elfeils  Dra(moot1oexomfeilt mDelumo;u) rxoxr3ootomD luvs;(0sruoir oy4lmtnmfciatfa2rau ooo1ope ifeildla2emu o;t) rxnxf3tadlm   n i s) 2xmxo3iodlmeemnct s  Dtrxmo;t4alxnmf3ils sDulnvpnt4alxnxf iadfpteluvo;s trxo(o oydapte fvil( s2raurpoo0oexoioeilslaDuln o ()tlxnmr3to1oa   u sl()tetr(r3oydoptemivtlt)a2trurpoo1teen ieiys s ua( sn() rxrir3oa1opD lieo;( t2xr(r3nu4olt liet s)a2trxm no1oleo o3tlsla uau pn()tleoio3iodfatr u i (0s2xmir iu4lm nlivtasfaDrr( pnu0aetniiciysfs2emumo (4 leoirciytlaDeluvo s)srxoir3ou1om nmiviat)s2um( pno1opeoiociaslsDemnms;t)tltnifctydlpDr i sls tetm(m3iydlmt lies ()aDumxro;u0oltomietad m el(vonu)altoxo iadfp  anvo;s)s2urirpiy1altnlivil(fsrtr(m ;u4tle iocild m umnmp u)trenxf3oy1opD aies;(  rtrxo ou1op  mnvs (f Duaxm ou0alxomiciadfa eanms;t0alxnmr oy1fpDe u o t0 2xm(r iodom emfci sf Dum(r oo0apenmo3ias a um(vs () ltrxr oytlate u o t srxoim no4ol nlneias srrmx onu1opxomfctytls2ranvont0 rerif3todomtrluvils  rxmxopnu4alenlfvi sfs2umum ot0altomoctysfaDumumonu) rtnif ia1la ran ol(0 rxm(opoo1omtemivs ()artr( o;o0opto oetat mDuln o (0aetoifctodfateliei ()sruoxr nudlpeemnesa( aDrax p;o4tee ioeiydfa rluvp u4trtrmfctadlmDr nesl( t2xoir3iu4lptemnvi tf 2rmurpnt0aleomo3iad a emums;u)tleomrcoytomtr uvi t)seto(m3iydom e nvsatfaDra(  no0aeeo i3iyt a2ua(vpn(0artnxr to1omteaivol( s2tm(o no4om elivtatfs2raumo;o1texomoeilt s rm(mp;t0trtrxfciatomteln i s)srxmirpno4ome lfvs s)artmx  ;t0olenmictlt m uaumon(4 rxrircta1fa ean ols srxr(opou1lpt  ics t)artmu p;u4alxo icilslmDuanvo;u0 lenmr tydfmDrlnei;s0srtm(r3oydom e fctls)s2urxr ;u0texnifciltfa2ul( s;(0treoio oydfaD luvo;()seurim no1ol e nvtatf 2tmu o;u4aee mietasls2ea(msnu4arenio ta1lpDelnvilt0t2xo(o ny1omeemfvtl(  Dtmxro;o1alx ioctydfa2ranmon()aleoxrctatfptr uvsls0 exoxo iu1ap emivt tf Duaxrpot1ole  ocildlaDulnms;u0tetnmo3todfmDrluvols)sruoxrpoudll e fcsa() Dur(m ;u1tlxoiociad sDuan o;t4trxoxrctatlatelieils0t2umxm iy4lm n ict ()sDtax pnu1olxnmi3tys s2um(mo u) lerif to1opD an il( srum(mpiodlpe mfctl(  Dua(  oo0tlt ifciadls eauvo;(0artrmrcoydopDrlnvs t0 euoxm3oydol nlfctl( srtrxr ;u0oeeoifctyd sDum(ms;() reomrcia1lm rlivil() rxr(m3nu1apenlneilt a2rau pnt0alenmf3iad m em(vp;u)tlxnxf iatfm rlu i;t0 exoim3iu1op e iei ()srtm( pot4aptnifeiyd mDeaump;t4aexomr3io1fpDraieo;() rxoxo nodopeemivs s)srrmu  ot4openif3iasfa eaump;u) etrxrciadom   nvol( seur(o iodom n icils  Duaxm nu1oleomfeildlmDem(vpnt)aexomrcoytfa raueil()sexrxmpnu1lm n ivslt) rtmu p;o1ape mf3tytfaDeln o t0 etrir3iodoate uei;t)teto(m3nu1lmt mfvsl(f rtr(r ot0tpxniietad m ua(vp t0tltrmrciadopt auvo;(0t2toxo nu1om e ies sf Dra(mp;u0ale mfctyt m2ranvs u) ltnir3ia1fa eai i ()s2umxr3oo1lptemncsls a2ur( p;t1oleoioeiadfmDumu o;t)artoif iytomt au o ( texmim3nodllenlnvsa( s2uau ooo1olxo o3iltlm emuvs;(4texoxf3oytoaDe n i t seto(o ny4ap nlfci () 2uru oou4olx ioeildfm elu s (0treomfciatfmDe neo;t tetmxo3nu4oltemivtatfaDrmxmo;u0teto fctytfa emnvo;u) rtnxf3to1la rlues;() rtm(r oy4llenlfvs ( s2ta(  no0tlx mf3tytlsDuanvo (4 lxrmoctytlaD liei;s teurirpnu4lp  mnvsasfsDrmu pou4optomietadfsDuan s ()trxnmo ootoat aneo;s0 2um(m3no4lltemfvslsfsruaumpoo0ale mo3iys a ea(von(0 etomfctydoatrli s t)trxr(rpio4apt miesl( a2tau ont4opxnmfcild m2ulumsn(0aleoxo3iy1op e ivs;(  2xrxopio1amenlnesl(farrrx  ou4olenmoeildfs2rmumon()tlxoir3iodomDe nvs t)truoxo3iodamtn ivsl( artmxm ot0alenmociyt m raumsnu0aleoif tatla ean slt)teurxopnudalt  nctltfs2uaxm nt4olen f3ild a emnvont4arenif3oo1faDe n s (0 2xrio oo4omtnliei t)aDuau pou1aexn i3iys mDrmums;(4artomrcoy1opte uvi t)t2xo(r ny1op nmncia(fsrtrurpnu0aexnmiciytla el( on(0trxnxo oadopDe ieo;t seumirpno1apen ncilsfaDtm(rp;u0tle ioeiytfm2uluvo;u) exoxocoytlaDrluei;t  rtmxr oy1llte nes t  ruaxrpot1olxo fciys a uaump;u4 rtoiocoa1oaDr u olt)srurxm ou4aptnmfetls)sruax pnu4aptomictlslmDul(mpnu)aleriocoadlat  i ol(0 2xr(o oy1lpen feiat srrmxr nu4alenio3tlt aDrl( s;()teeoxfcoatlp rlueols0teur(m iu1opt lncsatfsDrmx p;o1opt miciltls rm( p (0tetoir oatfm elu ols)trxm(mpno1op e ivil() 2tax pot0oetn f3tys a2uaumonu) exnifcootfpDe u i;()trtmio nudlm  mfvsa( s2rru pnt0texoifetytfm elu pnt0trxnmo oodlpD anei;s) 2umir oodope  iesat  Dumu  ;t0ope ifcilsfmDuau pnu4artoxf3oy1opD aiesls0trumio no4optnmivtatfarua(rpou1oetomocildlsDuluvo t)aetnmr oatfa e i ils t2toxo oodomte fcsa(f 2rmxrpno1oeenioeiadlmDra(vonu0tlenxf tatlp  anvi;s) ruoio nu1lp elnesas a2ta(rpnt4tex mocias m rl(vs t4aetrmf tadomt lnvo;(0 exmxmpnu1opee neilt)s2uaxro;u4tpxn f3iatfa2um( o (4 lxnif3iydlpDr uvils0s2tr(r iu1ape lnvil( srrru pot1ape mf3tys s umu p;t4 lerif3totoa rli ols s2triopoy4ap elfctat s2rmumo;o0opx  oetydfsDrmnmp;u0trtnxo3ia1fa r u o t)srxrxm3iu1lpeemiciat)srtr(mpou4tex mietls a2ean pn() ltrifciydlpD au o;t  rurxmpio4altelfet s  2raxmp;t4texnmi3iltfs el( s u) etnmrcio1omt lieols0trtoim3no1oltnmnetat)s2raur ;t0apxnio3iatfm rmu pn() rtoif iy1faDrlies;t0 2trxopoo1lm elfvilt  rtmxrono1opt  oeiasls ul( o u4altnxf iatlat  ueslt s2xoxr3oodomt  ncslt arurxmpno1oeeoioctlsfsDumump () l
\ No newline at end of file
@@ -0,0 +1 @@
+u i s t2ur(opou1omtnlici t)aDtax pot1aeeoii3iadfm rlnvs t0 rtnmr iydlptelnesl(0setoxr no1ll e ivia(fs2rmurono1aee moeiysfaDem( o u0 renifciytlp  lueo t0trur(opoo4optnlfct s)aDumu pou4altnmoeild m rm( o;u4trermr3iadlmDrai s;() rurimpoodlpee fvi (  rum( p;o4ole  ociad m rlu p t) ltoif oadlmDeanvi;t)sexoim3ou1aleelnct s)s2ur(rpot4apto icilsfm2eaump;t4aexnioctadlmt lueslt)tetrxo3iy4opt lnes ()sDta( p;u0tex  octat mDrmu o u4trxrxfcta1lp raieslt0trto(opou4lpenlfvi tfsDtau o;t1tlxoif3iat a eluvs t4artrxo io1omte uvo;s  2xoir3iy4apt mfvsa( artm(root1ale  fetytfmDumn o;t0 ltrmoctadoate ueo;t)srumxmpnydlp elictlt)sDra(  ou1tex mf3ias s2ra(monu4 ltoxo iodop ean s;s  2urio oodlpee nctas srrrxrp;u1alt iictas mDua(vp;(0tlermo iotop e neo;t)teto(m oydllen ictlt aDtmxmonu0ope  i3iatlm2rau o u) rtrifcta1om e nvolt0 rumxrpny1ap  mfciatfsDrau pnt0oexomi3iyt m ulnms;(4tleomr todlmt aneo t0s2toir3iy1alen fvsltfaDtm(mont0teenmietytfm2ul(vs;u0aleoiocty1la ranvs s)tetrio oo4apenlnesas)srta(monu4alx mo3iyt a rmuvon(0artoiocootlmtr n s;() 2xo(rpiydlmtnmfeia(  rumx pnt4tlt  fetad a emuvs;t) ltrio3iatop   nei ()trtoxo3nodamt mfvtlsfs2rm(rp;t0oetomiciasfs2rau o;t0 exrmo tadfp  anvilt) euoimpou4lltemfvtat a2ur(m ou1tlt mf3tld sDem(vp;()altnxrciydfmD lies t0s2xrxrpnu1lp nlfeias)a2rrxro;u1tltomfeild a ul( o t4 lxnio3iytomDe nvi;t trtm(r ny4oleelfvsl(farumx  nu0aexn fcilsfmDemuvpnt0trtoifcoy1omtrauvslt0 rtoxo3nydoltn ivi (fartrxr ;o4oetnmo3ias a um( pn(0tlxnmocto1op eliei t0srurxm nydope lnvs (fsDraxr ot1oleo i3iys s2rau sn(4aetoxf tydfm r nvo s0t2ur(r3ny4omtnmiet ()s2rr( pou0alto oeiadfs2uluvo ()teeoxo3to1faDeaivo t0 exmirpoudal n ncsasfartrurp;t0optnmfeias aDranvsn(0trxomociotfp r ivil(0t2uoim3oo4am e fesltfaDrmum ;o0apt mfcilslm umuvsnu4 rermoctotfpt ai o t)s2urirpno4ale mivils sDrrxr no4tltomi3ilt a2ul(mpnu) ltrxr oatomtrai i;t trur(o3iy4ap eliesa(fsDrmx  oo1alenmo3iltfa2um( p;t) etrio ty1la r i o () 2xrxr ny1oltnliet (faDum(rpnt1opxn ictyt sDrl(vs u)alxoxf3oy1fm e ivolt) 2xo(m3oy4ameemfvta( aDuaur ;u1oltn f3iatla eau snt)aexnxo3iydfatrlueo;s sexoio3io1amtnmfeiltfsrtmu pot4oltomfctyt sDea( pn(0aetnirctadlaDr nei s) exr(r nu4ale  ictls) rraxro;u0tptoifctld s2rlnvs t4trxrir iydfateaiei;s0s2tmir3oy4am  lfvil() rtrx  oo0apxn fciysfs2emnmo t)trxnmocootfm  aues (  2xmim3iodlmeemictat sDra(ront4opx iietydlaDrl(vpn(0aetrmr3ootfpD au s;t srxr(rpoo4lltnlnci tfaDurumo;t4olto ocilt sDulumo t0arerxr3oo1fmt ln ols srxr(o io1lp nlfeiat)a2ur( poo4apeomi3ias m em( p t)tlxrio oodfmte nesls)t2trxrpoy4apee ici tf rum(mo;u4tpenmfeiydfs2rl(mont4 rtrxf3oa1fpt au olt0 exrir iydlme mfci sfa2tm(  ;t1alxnmfciasfs2uanmon()trxomo3oatfmD au i;s0 etmxr3oodop  mfvs ( arrm(ro;t0tpxn i3iadfa uau ont4tltrir tatfpDeaneo s0 2xr(rpny1omen fvils sDra(m ;o1teeo f3ildlm2ra(vs t4areoiocoadlpDraues (0s2xrxo iudamee feta( sDrrxrpou0aetnioeiatfsDeln o;()texoxo to1lmDraivol(0t2xo(o nodom e fcta(faDrax ont1aexoiictytlm2rmnmp;u)trxnxf3iadoa rlu i;s) euriopnu4lp  mics s a2umuro;t4oeeoiieiysla uluvp u4 lenxo oa1oaDrlu olt  etoir iy4om elfctls)artr(rooo1aexo fetydla2ranmo t4aeenircty1fatr neo;t0seuoim iudolee fvias)a2urumono4oexoifcildfmDulnvpnu)areoxf io1fmt  nvo t0 rxm(m3ou1op nlnesatf Draur ;o4tltoio3ilsfs2eanmp;(0tlxniociodlpt au o ()sexrxm oo1lmtemnct s)a2urx  ;t1oexomf3tatlm2rmnms u0alxrmfcoy1laDeau sls)trxmirpoodome mnctlsfsDra(mpnt1optnifetydfa elu p;t4artrmrciy1fmt aivi t0 2xrxopnudale mnvt () rur(mono1aleo o3iyt mDrmumsnu0teerxocoy1op   i sls0trtoxm iodll nmivsl()a2tm(mpot0tptomo3tld a uauvpn()teeoxr3ootla  lneols0 2trxr3nydol  licsls  2trurooo4open feiatfaDrau ont) rtoif3tytlpDraiei;(0seurio3oo1apen ivsls)sDtr(mo;t0alt iietld sDeluvo u0 leomo3iydlatelu ol(0 rum(opoy4optelnct s) 2raurpoo0opx  o3iatls uauvp u4 ltrmr3iy1lp e ivo;t0sruoirpio1lp emivt s) Dum(ront1aptn oeiyslmDranmo (0trxnxfcoodfpD livo s  rxoxrpoy4lpe  fvtl(farra( pot1tltomictys aDumn s;u)tetnmr tytopDraneols0setoio oudol  mfcsls sruaxroot1apen oeiyt sDeln s ()artnxociodopteanei;s0s2trimpny4alt  netl( aDrau ono0alxn feiltlmDrm(vpnt0tltrxo3iy1oaDeauvo;s setmiopiy1lp n fci s arrr(  ot1apx mieildfs2uau p;(4artnmf3oy1oaD li i;() 2xmxr3oo4ap n fcia( arrm(rpoo1tptomociasfa2rl(ms u4 exnif3iadopt auei;()s2xrim3iu4lm   icils)sDraxmpot1opx  octyt sDul(mo u0 lermrciytlp   nvsls0setmxr3nu1om e nvi tfa2ta(ronu1aexoio3iys a2umnvs;(0aexomo3tytlaDelieilt t2toxr nu1llte fvil(  2rmx  nu0tee  ieiyt mDua(mp;t0 ltrio3todlp e i i () eurxopoodopt  fvta(fs2urumpot0oeeoii3iatfm uan o;()arxnir tadlaDeln o s)seumiopiodamtnlfvsa() rtmurooo4tlxomoetltfmDuluvo;u4 rtrmr io1lmDelueilt0sexr(m3ou1op nmiet s aDrmumont1altoifeiyslm2rlu p;t)texnxfcoytfpt anesls0 rxr(o ny4lptemivsa(fa2rrx oou1olx ioeiyt aDemump u)areomr3ta1la elnvols srxrim3iy4ap emivtlt  ruaxrpot0tpxoio3iysfm rl(mp;(0 ltnio3tytlat aueilt s2to(r ny4altemnvi t  Duax p;u0alto oetysla ua(msnt4 renmf iydfp  lieo s0t2uoim3ny4omtelncslt s2tr(mpnu1tetoio3iytfmDrluvp ()alermo3oy1laDrlieo;s s2xmiopnydom n nvsas  Dum(mo;u4alx ifcildlsDrlnmp ()tlxoio ta1lmt lueo;(0 rur(r ny4oltnlictl()a2raxro;t1oeenif3ildlmDuauvs;u4 etnxr tydfptrauvsl(0 2xm(r3no1al emici t)a2ururpno0optniiciaslm2rl( s;u)trtnmo3oa1lptraueols s2xoxmpio4lmtemicslt  rtm(rpot1tetoiicias aDelumsnt0 exrxo3ia1fm ean o (0s2tmxm ny1apeelfetlsf 2ra(rpnt1apen fciat aDumnmo t0arermf3iadlptrlivil(0texmio oy1lm nlnci tf rua(mpot1apen i3iltls2ea( o t)aexrxfcia1lpt livs;t0 etm(m ou1alen icta(f ruau  ;u0apx  oeiytls2ul(mp;t0trxoio3ta1oa rluvol(  ruoimpoo4lmt  ivs tfa2uax  ou0teenmoeiltfs rlnvon(4aeermfctadlpDeai i;s  2xm(o iu1lmtnmfcias sDuru onu4opx  ietatlm eanmp;t)alenmr ty1fa eauvo t0sexmirpiy4llen fet s  rrrx  ;t0oetoioetysfs ul(vont4tlenio oadoaD lueol() 2urxr3iy4optnlnetat)a2urxm ;o0tptomoeiytfmDeanms;()aeenmr3ta1lpt ai sl(0 rxoxopiudoleelfeiasfsDra(  oo0ape  iciasfa2umn onu)alenxrciydla rauvo t)srxrxo iy1olte fvt s sDtmx  ot4olxn iciad s2uan o ()alenxf todoa  li i (  2uoir iu4lmtemivi ()srtrur ;u0ole ioctydlmDrau o u)tleoiocoa1oa e ieo ()s2xo(mpio4lle lfci t s2uaumo;o1optn ieiysfm2umnmsnt0 rtrmfciadomteluvo;t0 rxrxo3oodlptnmnvia()sDraxrooo4alxomi3iasls em(vsn(4 exoif3tytomDranvols s2trio3nodal e fctlt)a2rr(mono0alxoif3iad sDulnmo ()tltnmfcoydla rauei;s0s2tm(opou4al emici t) 2raumonu4oltn oeiad sDem( o ()artoxf io1lpD li i;s) eumxm3iy1om elnetltfarrru  nu0apt  ieiytlmDumnvs;t4tetnxf iytlp r uei s  rtrxr oy1opeelnctasf Dtr( ono1oltomfctld aDea( o;() renxo iytlp eanes;(0 2xrxm3oo1apeemnctat)a2raxr no1tlx  fcilslsDumn s;t0tlxomf ootlpD anvi s  exoim ou1lp e nes t  Dtau pou4tpx if3tys aDeln pnt)trxoir todfpDr ivi t  etrxo3nudomee nesasfartaxm ;t4tpt mieilsfs el( o;u4trxrmo3iydfpDe ivsl()t2um(opiy4ll nmfcsa(f 2tm( pnu1altnio3ilslmDrluvpn(4tetomf oadlp r uvo (0 ruoxr3ou1lm n ncs t) 2tmxr nu4tptomf3iys s eau s;t)alerir todlateln s t0trxr(m oo4apeemics ( sDum(m no1oetnmfcils s um(mp t0tleoif3oatfmt  uvi (0s2to(r oo1aptnlivs sfartaxr ;o1aetomociatla um(monu0teeoxf oo1fatr nvo;t  eur(m3iu4olee fcsat)s2raumo;u0ole  ieiysfm2ranvo;(0 eeoxrcty1fa   nei;s  etoxr oy1om  lfcsas)s2rrum ;t1aex  fetyt a em( o ()trxrxo3oydfmDeli s s0 2tm(o3nydll e ict s)aDtrx pou0tltnif3ildfmDrauvpnu4 exnmo3oo1lmDrlnes;t0setrir io1al e iet ( srtaumpou1alt  fetysla eau p;(4 ltnxo3totfate uvi s0 rtoxmpno1lpenmfvia(  Dra(monu1ope  oetytfs emnms (4 rxrxoctydopDranvs;(0 exmir iy1opeelics tfs2umxr oo1opxn feiydla el(monu)alxrif oadoaD  nvil(0setrxrpnu4alee fesltfartrx  no0oee  f3tyd a ulu o;() lxrir3oa1opt an i;t)texrirpiodllee ictlsfaDurx oot0oexomi3tytfs2ean p;(0altoxf3tadop r nes t0teumxm io1opt micil()sDtax oot4tpx moeiad a2ranmp (0aleoxocoy1lmD aues;t)s2uoimpio4llteliei s  rtruroot0olx mfeiatfsDra(vo u0texnio oadfpDrluvsls texo(r nu1am e nei (faDtaurpno0tltomiciydfaDem(ms (4tlenio iodlaDrauvi t) eumxopoodolee ieiasf Dumxro;t1aleo oetldfa el(vp t4trxomocoydlptr ueols trtoxo3oodlle miviat) Dtmxm ot4tpeo fciaslmDranvp;(0alxoxr3oytlmt  n o t0s2umir oy1omeelfet t  rrrx pot1tlt  feiytlm2elnvo t4aeermr iytlmDr n i t) 2xoimpnudole  fetasf Dtm(rpoo4aex ifciadfm ul(mo;u0arxrircoytlpD  nvs;s0 2tm(o3iudlmtnlnei t arumxrooo4oeen fctyslaDraump;t4texrmo todopD an slt0s2uoxrpnu4amtnlfesa( srraxmpot0texn o3tatfa2eaumo t0 ltnxf iatlpteanvs;(0 2um(r io1opte nes sfsrtax  ;o0tlxn fciysfmDrln pnu0trxrxr oytlatranei t) rxo(r3iu4lmtnlfvsls)aDum(r ;o1texo f3iasls2ua( s t)treoxf3iodlmt aneols0trxoir io1omt mfesa(faDraur oo0ale moetasls2uaumo u0 rxoxrcty1om r ivo t  etmxo oudale lfct t) Drmx o;t4tlxoifciadlm2rmuvo (4texoio3iadlaDr uvsl(  2to(opiodomeelnetls  2tr(rp;t4tle iictat s2umump u4 rxnmrctotla  luvs;(0sexrxrpnu4lpte ivta( srtm(  ot4olx ioeiadlm2umumo;t4aetnxo3ta1laDeaivilt  2um(opiu1op e ivsl(f 2tauronu1teeo oeiyt aDea(vonu0 etomfciytlat li ols trtmxr3iu4lpte ietasfsrtru  ;u0tex ifeiadfa el( s u)arerif oadomtean o;( t2uoxopno4lp nmivt t  Duaump;u1tltnifciltls2emnmp;t) rtnir todfmt aivilt)setmxo nu1ol n ict s  rua( oot1aexo iciat s eln o;(0 lxrxfciytom  auei;s0 2trxm3io4aleelietasf 2uax  nt4opxn ieilslsDrm(mon() etrmf3ta1fpt aueil() rto(rpiy1olenlfct (fsDra(m oo0oet  feils m2elu o;t4 lxrmr iytop  auvs;s0 rtrim ny1opeelfciatfsrtruro;t0olxnmf3iydfm ranmp;(0tlxrxo totlpt  ivi;t tetr(mpiodapt  nct t artrxr ;u4oet mieilsfsDran s;(0texnmr3iatlptrai o t seurxo oydale lneiatf Drau pno4alx  ieils m um(ms t4tltnifctatfpt lu o;s teurxr3nudlm  mictl(  rtm(rpnu0oexnmoeiadlmDumnmpnu0tlxoifcia1opD lieols)trto(o nydlp e ict (fs2umumont0tltn oeiltfmDem(vonu)tltnir3iatlpt  uvslt)srumim3oydll nmnvt (  rtaxront0aptn oeildls2um(ms;(4alxnxrcoo1fmtrlues;s0 2toir nydap nmncilsfarra(mpnt1tpx mfciys m2emnmo () reoxf3tadopDr neil(  rxr(m iy4olen ncs t  2rru pou4opxnmicild mDrmnms u4 rermo ta1fpDe i i t0 2umim oydamt mfci (faDtrxrp;o0tleo ietytfm ea( o;t)areoio iadlpD aivi ( s2to(m iydoltnmivt tfaDtau ont1open feildfs ul(ms (4teeomf3ty1lmtr i s t s2toiopoudlltnmncs tfa2taurp;u4opx mf3iytls2uln o;()aexnxfcootomDranvi;() eum(opiudlm nmfet t)arrr(rpot0aee if3iatlsDelnvonu4altoir oodoa  anvols) rur(r nudom emicsa( s2um(m no0tpxoifetadfm eanmpnt4 ltoio3oodlm   u s ()setrirpiodal   nesa(fsDtaumoou4alenifctld s ua(vpnt0treoio3ia1fmD  u i t teur(o iydoleelicil(farur(moou4aeen o3iasla2uan on()altoio3tatlm r ivils)trtmxr3iy1alee fvs sf 2tmum ;t0aetnmietasls2rmumo t)teerir todfm r ies s seumxmpiy1lpenlnviat) rrmx o;o4teenif3iyt sDeanvs;(4texrmr iadlp rlieslt0sexmir ny1altelfvtls)artru o;o4oltnif3iydla2rlu ont0tlenxf tydfmDe iesls t2to(r3oy1ole lncsat s2urx pno4texo oeiadfmDea(vsn()aexnio3oo1oaDrai i;s  exoimpoy4lltnlncs t)s2uaur ;o0apeomo3ias mDeaumo;u0aeeomrcto1fpteln s s  exoxmpoo4ll elivsa( sDtaum ot0opx  f3iadls2rm(vo;t0altoir oodfm  li o t0 ruo(mpoudlm nliciasfartmxmpnt1optn oeiytls2eaump (4altrio iytop eaivi;() 2uriopoy1lm elncsasf rua(mpno0aetniicilsfs uln o u)artrxr3oatlm  aivo s0 2toirpoydamtn fviat)a2umxmp;u1oleo iciys sDemnvonu0 lxomrcoa1opDr i ilt trum(m3iu4ape  nvias s2raumpou4aleo o3tas a2emn s;u)aeenmr3iy1opD  ieo (0teurir3oo4olt mneia(fsrtax p;t0teenmf3iadfm2eln sn()trxoxociy1omDrau i t  rtm(m oy4lme mnvtltfaDumu oot4tpt mf3tad s2ulumo;u4tetoio oa1oatr u i;s0srxmxm3no4oltelfcs tfa2ua(rpno1tptn o3tatlsDul(vo;(0arxnio3iy1omDraieo ( s2toxm oudomenmietls)sruaur no0alxnmo3iydfs2ua(mpnt4 exomr io1fmDr ues (0sexmxo3io1ap elieils aDrm(mooo0ape  o3ilt aDem( p;(4alermfcoytfaDrlnvs;(0 rtoio oy1lle lfvsl()aDrmx  ou1alxoioeiyd m2el( o (0altnio3oadlmDrlneo;(  rtr(o no1lle licsat)aDrrxm oo0opxn i3tyd mDrauvon(4 exoxr oadfmDeau s t0srur(o3nudapenlieils)sDtrxmonu0tet  feiyslm ul( o ()arerxf iodfmDrau s;( t2xoio nydlmeemnvt ()a2raxmp;u4apxoiociysfm umnms t4arerxrcootfpDelu s (0texmio3oo1ll  mici s srrrxmpno0opeomieiltfsDrl( o ()artnmr3oodlp  lieil(  ruoirpny4lpeelncsa() Drrumooo0aeeoiicias aDrluvp t)tetrif iatoatr ueolt s2trxm3iydlle  fcias) rumxrp;u0tpeomoeiadfm2em(msnt)aexoiociotfateli il( setoio oodal  lfei ( sruau  nt1opxniocias s rlnvs;t)tlenxfciotopD lueil()sexrxm3ou1lpe mncsls sDumuro;u0apxn feiatlmDrmnvpn(4aexnmrcoatfatrli o;(0srtmio ou4opt  ictat) rtrurp;o0texnmfciasls emumo u) rtrir3iodlpDr n i s0s2xm(mpoo4amenlfesa(f rrau  no0oexo o3tydls2uln o;(4 ltoir ta1fmtrlivi s srxmxr3iu1opt mneia()srtm(mpno0tlxn oetasfaDulnvp;()trxnmfciydlp r i i ( s2tmio3iu4alt lnvi sfarraurp;u0tlx mietls sDem(mpn() exrmr3to1lpDelnvslt0sexoxr oudoleelfvia() ruaxmp;u0oee ioctlsls2ea(vp u0tetrxrcio1fpt  uvils  2triopio4ll   ivtat srurum ot1alxnifciaslsDrm(vsn(0altoxr3iodfmD  i o;t)s2tr(r3nudam   nvias a2tmx oou4apt  fciatfs emnmp;t4altoif3oy1oateau i;s0t2xo(o3no1lpen icsls)sDta(ro;o4tpxnmfciytfs ua( pnt)artnmrcto1omDranvi;s0seuoim3ou4lptn fvslt artrx  nt0texo ociys mDumn s t0tetnio3ootlpDe ivsls)s2uoxr3no4olen neia()arraurpno1tptnmieiat sDemums;(0 etoifctatlmD li i t) rxmio3no4amtn fvslsfsDrm(ront0aptnifeilsfm eluvs t0alxrmf3iy1opD anes t0 etoxo oodlmenmfvi s  rumxro;u0tptnmoeiltlm2rmnms t4teerxf3todlaD aivi;() 2tm(opoudam  mfetls) 2umxrpou4aeenmi3tls a2uauvsn(4tltrxrcty1oa r uvo;t t2xmim3iu1omeemnes () Dumu p;u1oet ioctas mDrmump t) etnmoctodom rln o t) rxoim ou4lmt  fvi tfsruru p;t4aetniictadfsDuau on() lxrifcoy1oaDeln s;s)t2to(o3ny4omtn netat srra( pno0aexnmfciys s rl(vo ()artrir3iy1faDe ues;t0t2umiopnu1om emnetat) rtaxr nu4apxniieiasfaDemu s t0texomf iodlptranei;s  euo(m iy1al nmnctlt)a2ra( pno4oee mieiasfaDemnvp u)texrxociadlpt aivs s) 2xrio iy4al emfcs () 2umxmoou1tee ii3ildfa2ranmp;u0aetomf tytlm  an i;s0sruoxr oodaltn fcsls  Dra(  nt4tle mo3ild aDua( p;()areomr3ta1fa   n s;s)s2ur(mpiodalte ieils) 2uaxront0aeenmoeilt a ea(vsnu4trtnxrciy1opte i slt)t2tmio3ou4omtnlnvtlt  rurx oot1alxoioeils m2elump;(0tetnmf3oydfpDeaneo;s) 2urxm3nodap elnvt ( arrau  ou4tlxo iciatfaDulnvon(0 reomr3iodfmtr ueo;s s2xrxrpnudam  mfvsl()srumumpnu4alxomo3ils a rl(vont0trxoxf oo1oaDranvs;t)trtmio3ny1lpte fcslsfaDrm(mpoo0apx ioctatfmDuau sn() lxoiociadlat luvs;()t2toimpno1am   fes s)arum(monu0olx ifeiyt mDuln p (4trermr3to1lp e ues;t)truo(m3oodlpen netat) Dtaur ot1optnifeiydfs2ul( o u0 eermo ia1om rluvi ( s2xoio nu1lp elnes () 2uaxrpno4oetomf3tydfa uanvs t0aeerxocty1fpteaneo;t)t2toxm3iy1lltnlnvtl()srrrxmont4aexomociytfa2elnmon(0alxrmociodoatrluvi s)trumirpou4lm nmfvsltfa2urxmpou4tpx ifeilsfa uau p;() rtnmrcoo1fmtraneo s) ruoxmpny1ol  lnvsl( s2rmxront4alxnio3tlt a2ra( p t0 leomfctatoaD lieil()tetrxo3nu1lmenmivt s) Dum(monu0oeen ocilsfaDum( p u0trerxr io1lmt aueo;t) 2uoxo3iy4lleelfes tfa2uaxro;t1oleo i3tltlsDulumsnt0aeeoxr io1fmteaivolt)setoxo iydapt lnes s)arta(mpno4aetoiiciyt sDeau o;t4texnmr tydfp elu sls0 2xo(o3iu4olen fesa( s2rrx  nu1tptnioetlslaDelumont4 etnxfciodomD liei;()t2ur(mpoodolt  net sfartrxmo;o4aptn i3iatlaDemu pnt) exoio io1omD auvi;s t2xmxm iy4lpte fvtas)srrrx  oo0ope ii3tytfmDuauvp ()trenxf tadop   uvslt)t2xmxr3oy1apt  iciasf Durx  no4teeomfcildfaDranvon(4trxoio iadfpte i s;s)srum(o iydape  fvtlt  2ua(r ot1alx iociytfmDulums;t0 reniocio1fmDr i o;s  exm(o nodope lfcia( aDumxr ;t1opxnifctltla2umu snu0 etnio ty1latraies t) 2xoxo nydlm nmncsls  2ta(moot1open fctydla rln snt0tetrxociotomDranvs;s0truoir3no1ol   fcil() 2rmuroou4aee  i3ild a2ul( p (4aeeoxfcty1fmtelnvils) 2umim3iu4olt mnetlsf Drau oot4tet ioctadla2em(mp;t4aleoio3oytoptrlieslt0trumim iu4optemfcs s)s2rm(  ;t4tle ii3ildlm2rmnms ()trtnmrctatfaD  iesl(0s2uoimpny1openlneiasf ruaur ;t4tpeomoeild a uanvsn(0 exrxf oatfatr n o;t) rxmiopno4al elict tfsruaxmp;t0oltn fciys a rm(ms;u)texrxo3to1oa e i olt  etrim iu4ap n fvslt) 2rr(  nu1oleoio3ils a rmnvsnu4 ltrmrctadoat livs t0t2toxm iudomte icsat)srrmurpno4aleomoctyslm2emnvpnt4aexrxr iytfmDe ueils)seum(mpoydamenmnci sfarrax p;t0tlt  ictys aDumuvp;u)tltrio3iytoa e uei (0 rtmxmpoy4lltemnvt (fs2tr( oot0apxo fetad m umuvs t0aleriociotlm eau o;s0srumim iy4omeelfeil( aDumum ot0teenioctatfsDem(mp;()artnir3ia1fpte i o t)setrimpoo4olte fcs s artmu  ;o1tlt ifctyt s rmnmp (4alxnxf3oadfptrlivs s)trtoir ny4opee ivslsfsDraur ;u0opeoio3iyslaDulnvont0alxrmf3iadoa eanvs;()srtrxo3ny4omen ieil(  2urur nt0tpx iieiysfs2emn on(4aeermrcoa1fatrlivsl()srum(o ou4amte ietl(fs2urxmp;o4tle io3iltfm ulnvsn(4 exomf3oo1oaDelieilt t2xrxr io4ap elieiasfaDua(mo;o0oeenmociatfs2emuvpnt4 rxrxfcia1lmtelnvi ( t2xmxmpou4lmeelietl(  rur( pnu1olto feiytls2umn o t) lxrxrcoy1op  anvs;( trtoimpnudlpt lfvi (f rum(mpnt4alxomi3tad aDemuvo t) etoxr3to1fpDeaies;s setoxo io4ol nlfvs s)aDtru o;u0tleo fcias aDulnmpnt4alenxo todoaDr ivo;t)t2urxm iodol  mfet s aDta(ro;t1tle miciltfs2elu onu4 ltoxocoo1lptr ivi;t)trxmim3oodlpen nctlt s2rr(rpot0opxnmo3iyslm em(vp u0artrir iotlat ai sl()trto(o ou4altnmnvsa( sDrru  ;t1tpt mo3ilt a2umu on()teenmfcoadlpDr n o () exrio iudlpt mnvslsf rum(  ot4tet  octls s rl( s (0trxnif3tatoptraues ( seuoxm3iu4ole mfvias) Drmu oot1aetn ociatlsDranvsnt4artrxociotfat  i i;t texoxmpnodlm emfcilsfarur(  ;u1tlto i3tatla eluvp u4 eermf3oadlmD lu s;s)t2umxo3ny1oltnlieslt sDrrxro;o4tpxnii3ils aDel(vonu4tltnmo iodlmDelnes t) 2xmxm3oydlpeemfvta(faDtax oot4alenmfciltla rmu s;t) leoiocoy1opteaivo () rtoxrpiodlmenmnci sf rrrx pou1optn i3tlsfaDuauvs t) eerxrcty1omte n ols tetr(o3nu4lm   fvi s  2tr(mo;o0oleoiiciat m2elumo;u4aetrxo3iadom elnei ( t2tm(rpoo4apenmnei (f 2taur ;t4apenmo3iytfmDumnvpn()tlxnxf oydlmtraivs ()t2xoxmpny4omt  ncsl( s2tr(ronu1oetoiieild s em(mon()altnxr iadlptrlivi s  etoxm3ny4ameelnvtlt  rraxm ;u4tetomi3taslsDel( s;t)treoxo3oo1optelu o;( setoxm no1oltnlneslt a2rauro;t4oeeomoeiasfm2uau s u)arenif3iodlat aivi;t) exoxo oodom e nesa()srtr(r no0apxnifciydlaDrmn pnt0texoif iatoatrlieols0seto(r oy1omte nes s a2ta(rp;u0alxo ieiyd m ul(ms;u4tlxoxf ootfpt lneilt)s2tm(rpoo1lpt mnvsltfsDta(mo;t0aee mf3iasls2umuvo;u) etnmfcio1fmD ai s;t sexriopno4lpte icta()aDrmum ot0tlt  f3iyslsDua(vont0tlxomr3oodoptr ivo (0trxrxopoo4ap e ncta()srta( pnt1opxo oeiat s2emnvp;t)teermr io1lpDelu o s sexmxr3oudole mfvtatfs2rru pnt4apxo ictyt sDeauvonu4tlerxf3oa1la e u s t  2xoio3iy1ome  fvsa( srta( pou1alx  ictat mDrluvo;(4tlxnmf3oytlaDrau i;(0t2tr(o no1ope  nvia(  Dua( ooo4tpt mietasla2rmumont0 eenxf ta1fp  luvils t2xr(mpoy4optemnvi ()aDtmumont0opxn fctldfm2ulumo u0 etnio3iodlp rlivol( srurir io1lmt  ieta(  Dum(r ot0tlenmfeiytlmDrm(mp u) ltnmr iotfmD auvols0 etm(r3ny4omtnmnei tfsDurumpoo1tptnmoetatfs rlums (0 ltoir3oy1la eli slt)tetoxo iydomtnmicsa()a2raur ;u4tlenmo3iytfm eluvont) lxrmr3iatfpDe ieils) ruoxr3iy1om emiet (  rua(m oo4oetomi3tls m2rl(mo;(4arxnir3tatomDrauvils tetrim3nydolt  fvtl(farrax ono1tlxnmo3iadls2ran snu)teeoio oy1omt aneol(0t2tmxrpiy4omtn fcslt  rrmx  ;o4tlxomoeiysfm2rl(vo u4 ltoio3iydoatelnesl()t2trio ou1lp  licilsf ruaxm ou1tetnmo3ilt s umumo t4artomoctytlaDraivilt  2to(m3iy1amee ies s)aDuaxmp;o1alxomo3ildlm2eanvsnu0tetrxr3ia1lpt lnes s  2to(o3nydapte nctls a2tm(  ;u1aleomiciyt a emn p u4teenxocoy1oatran ilt)setoim3iudoleelivs s)arrr(  oo1alxo i3iysla emnvs u4arxomrctydopt anvo t  exo(rpny4om emncsls)srraxmono1tet ioeils sDuln p;u)artrmf totlp   n sls seumim ou1amenlfvs t)s2rru  nt1alx mi3tas m2uln ont0altoio oy1omD  ivs;s) 2xoxmpiu4al elneias) Drmump;u4tee  fcilt m ra( snt) rxrxf oadfmDelnvs (0 etoir3no4lm elfctltfsrumxmo;o1oleo f3ild s2umuvp;u4 rerifciy1lpDr ueols0 eur(o io1amtnlncs tf Dra(rp;o4tlt mieiat aDrmu sn(0artnxo oytoaDe u ol(0trtmxr oy4lpt mneta(fs2rr(mpot4texnio3iasfsDra( pn()trtrmf3iotop  aivo (0setoxmpnudlmtn fvs s)srtrx ooo1opto oeiytfa2emnmp;(4aetoxo3oo1om e i s;(0 eur(r iy1am  mfvilt  Drax  oo4tpt mfeilt aDemnmp () etnif3tytomt ln s;t  2tmxmpno1ol  mfvi s s2ur(ro;o1aeeomietldfmDrl( onu) etrxf3oodfpteln slt srumxo3iy1om e ict sf Dua(rpot0opxnmo3ilsfa2emnvsn(4tltrmo3ia1lp r i s;( trxmio3oodllenmiei ()aDrrx  ot0apeo ietyt s ul(vp;(4tltnmo ootoaD  uvols) exoiopou4lpee fesat s2trxrpnt4tetn ieiyd mDemn s t4 ltoir3oy1omtr ieo ( s2xmir3oo1al  lncs (faruaum nt1tee mi3iatfa emn o;()aexrxo ty1lmD  neslt)srurio3oo4omtemiesat) rraxm no1alxn ociytlm2uau o;(4aleomr ia1oat  ivo s0trxr(o nu4ol e ieta(fs2rau  ;u4altnif3iyd m2eanmpn()trxrxoctatfaDrluvols) rxr(rpou4ole  ietas)s2rr(moot4alxnif3ilslaDul( p u)arxnmfctydfa eanvs;()setoxrpiu1lmt mncs sf rumxmpot4tetomieiad a2uan snt4alenxf oydfmte uei s0seum(o3iydolte nci tfartmum ;o0oleoifctatls rlnvpn()artrifciodfp eaues t)t2to(o nydlpenmietls  2rm(m ;o0altoif3ias a rm( p;t4tlxomocio1lptr nei;(0t2xoxopiodoptelivi t)artrxronu4teenio3tytls2emnvo (0 reoxrcoo1fm rlieo (0trurxr3oydoptnlivs ()srtm( oot1tpxnio3iltlaDem( o;u4trxnif tatla r u i s)tetmiopou4amt mnvs tfsrtmx pot4apeoiietatls uln p;u4artoif3iodlm rln o;s  2xoir io4alee ies sf rua( pno1aet ii3iat s umnmp;()aexnif ta1fpteanvils)s2xoir3no4lmee ivs s  2taum ot0olx mo3iadls rl(vpnu) exoxf todfmtraiei ( srum(m ny1opt lneia()srrrxrp;u4opt io3tadfm2ulnmpn()texomfctytfpDr uvi () 2ur(rpou1llen ivsas)srtmxr ou4tetnioctltlsDrauvo (0trtnmoctadoptraneo;t)srtmxopoodapte nvs t aDrrxm oo4oleoio3iatfm2umumpnu0tltoio to1lat aiesls)teuo(o3iu1lmee ies sf 2raxrpno4openmi3iyd mDumums ()teeoxfciy1fmDrai sls  etm(mpiy4al emfcsa(f 2umx  nt1oeenifciytfmDum(vp (4 eeriocoytfpDr nvils tetr(m3iu4om elneta(f 2rrumont4aptnmfctlt s2raumpnt)arxrmf3ta1lmte i o;t)t2xmxmpoydolte ivtlsfarrru o;u4oexn ietad s2eluvo ()tleoif3ty1lm r u i () etrxo iu1alenmfeiasfaDtaumo;o1tlt ifctaslmDuaump;(0alxrxo3oo1fmDeli slt  etoiopiu1lpenmicsat)arrmxmpno4tltnmoetyt a2uau s;u4tlenir iy1omtrlies;t) exriopoy4amee ivt t)a2uaxr ;t1teto i3ild aDrmnvpn(4 exoir oy1fpDrlu ol(0 2tr(opio1omeelnvi t) 2rmxmpno0olt iocilsls uauvpn(0teeoxoctadopteli sl()s2umir3nu1am n ictas)a2tmum no1aeeo ietlt aDum(mo (0teerif oatlm  lues (  2umiopno1ll e nvs sfa2urxrooo1oex io3iytfa uauvpnu0altomrcta1lm eaivol(0t2xr(r3ny1optnlict ()aDrmxrooo1teenmictld s rlnmpnt0artnif3ta1oa rau i s0 etm(opnudaltnmiet s) 2raum ot4opx mieilsfaDraumsnu4artoircoadfmte i ols0seurxo3io4apenlnvsl(  2ta(roou4opt  f3iasla rmn s t0 lxrif3iadfmteaivi (0 2umiopoudam emnvtl()aDrrum oo1oeto i3iatlm2umnvon(0alenif3oa1fate i ilt tetr(m3no1lp n icilsfa2ur(r ou1olxnif3ild s eanvon(4artrxo iotlm r neils0srxmxopoydol   ieil( aDrmx  nu1altniocils m2emuvp;u0aetrio iotlaDeaieo ( srxmirpnu4ol nmivtlt aDra(r ot1optn o3iyt m um(mo (4texrxocio1lpD  uvi s s2trir no1apt  fetl()sDur(mono4texo fetltfsDra(mon()tltnio ia1lateaues (0trurxo3ou4ol  miei s) 2tmxro;o1aex ioeiltfmDrmumsnt)aetrxfcto1fpD lu o s0 rumio iy1alt lncslsfarrr(  oo1oexomiciatlaDrl(vp;u0 etoxf oodla elieilt)trtrxm oodlltnlncsas)arurx  no0teeoif3iasfs emu o;(4arxomr3to1la r nei;s0 eumxrpou1open nvtls sDtruroou1aee moctydlm2ulump;t)alenmr3ia1lpt  n s s0 exr(rpoy1lmt  fci t a2rmxr oo0aet ifctys m2rmn p t)teeoif iydoa e n o s srxrxmpnu1ameelivta(  Dtrum ou1alt  iciytfsDemump;(4alxrxoctotopte ivsls trtr(m
\ No newline at end of file
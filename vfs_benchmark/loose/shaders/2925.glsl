@@ -0,0 +1 @@
+ivilt) 2um(r3oudaltelnesl(fs2ur(ronu1teto f3iyd a2ranvs (4 eenmoctadlp e u o;( trto(r3no1apt lfetls  ruaxr oo1aeenmieiyslmDuauvp;u0aeermo3oy1fmtr n s;s0texmxmpoodapeemfci (f 2uru oou1tltoio3iydfm rluvs (4 renxr3to1oate i slt  exmxm3nu1om  lfvsa( srtm(mpou0aleo feiytlm el(mo;u4 lxnxr iodopDr n i t tetoxr no1lm n ivi ()aDta(moou4aetn o3iysls rmnvs;(0alxrmfcoytlaDr nvo s)s2xm(m iu4ol nmnei t)sDrmur nt1aee mfctyd a eln snu0alxrxfcoo1lmD  n o;s)s2tmio no4lp n fcsas sDuaxm ;t0oetnmf3tat a2rlnvs t)areomo iytlpDr ueilt0 rtoxr3iydolt mfvtat  rtrxronu4apxo i3iysla elumo t4alerxr iadlp r i ol(0t2to(mpiu1ame  ietlt  rrr(r ;o1oeto i3tld a2rl(vs;u)artnir3oadlate nei;s)sexoir iudap  licilt aDtruront4tet mf3ias a rauvo u)aexnioctodopDran il(0 rxrxrpoo4lmen feias) 2umu  oo1alxnmf3tad aDua(mpnt4 eeoio3todlm  aieo;() eurirpny1lm nlnvia( aDuauroot4optoii3iltla2ean p;u4treomocoodlmD li s;s srtoio iy4lpe  ictltfs2rmxrpot0apto i3iys a ulu s t4 exnmfciydfm raieil(  ruoimpiy1lpee netas)artmxmp;u4aexn ietad sDum(mo u0 etrxo io1op rluvi;()t2trim ny4lme  icslt) Dum( o;t4alxnmictys mDemu s ()treoircoa1fa e n il( tetoxmpnu1amtnlfctlt a2um(ront0aetoiociadlm2rmn p;()altrir tydlpD  n s;(  rxo(o3ou4op e fvsas srrmu onu0tpe mieildlsDem(vs u)teeoirciy1faD li o;t0srtoxm3iu4oltelnvs s)s2taumonu0tptoioetytlsDumn p;t4tlxrxo iatla eluvols) 2ur(opny4alen ivtat) Dua(mp;o4altn i3ils a2rm(mpn(0 etnif iy1laD auvo;( teuo(o3io1ll elneiat) Dumu pot0ope mo3ils s2um(vo;u)altnxfcio1lmte ivils) rxrimpoy4altn ici (f rurxrpoo0oeeomociadfmDrmnvpn() etrmr3ia1fmte nesls sexm(m3nu1ape mfvil(fa2tr(r nt1alxn fetls m rmnmp;(0trxnmo3oodfmDe uvs;( srtrim nu1lp nmict (  Drrxmo;t1tlx mieiadls2ra(vpnu4tetoif ia1fmteln ols)s2ur(opiydlltnlfvtl(fsDrrurpou4altnifciyt a2umn o;()trxrmociodomtr uvs;s srurxopny4olt mfetls  rrrxrp;o0apeomictytfm2rm(vont0 ltoiocoytla eai o (0 2xrim3iu1ome mfvil( arur(r oo0oleniocils aDra(mo (0alxrmr iotomD lu il(0 etriopnodll nmncsatf Dtmx  oo4teenmoeiasfm2em( sn(4 reomfcio1lpte nvi t0trxmxr3iudlptemnvi s)s2raum no0optnifciadla ulumont4 lermf iy1fmD  n o t)trtm(o3no1lp emnciat)srra(m nt4ole iociydlm rl( s u)aexrifciotlm e uei s)sexo(rpno1amt  feia(  rtrx  ;t0tle mfetydla rmuvo;u0trerxf iy1oa   n i;s)trxmiopiu4om e fciltfa2rmxmp;u1tptn feiytla rmuvo u0 lenmrciytfmDe ieo;s s2xmim nu1ll nmiei s aDta(rooo0tptnmfeias aDelu p u0tlxoxoctadlmDeaivi;(0 rxoxo3oodaptnmfeiasfsruaxr ou4teeomf3tyslsDeau o;(0 lxoif oytfat liei;s) etrxr3no1lp  livia()aDumxrpou4alt mfetytfs2eanms;u)aeeniociotop eli o t) eto(r ou1opt livtasfsrum(r ot0opxomicildfaDul(vo (4tlxnxrcoydoaDr i s;( trxoirpnu4om emfcils s2rm(  ou0oltnioetad sDrlnms u0trxrxr tytfmt ai s;( t2triopiu1ol nlnesl()arurx o;o1olx  o3iltls2eluvsnt) rtrxo tatfpDrluei;s  rur(r nu1lleemncsl( aDuau pot1apx  icilsla uanmsnu)aeeoxociy1fm elu olt s2uriopnu4op  lietlt) 2raumpnt0tlxnmfcildfa2eaump;(0 exnmr oo1opDrai ilt)setmxmpnydlpe lncs ( srrax onu0altniieilslm ulnvp;()aexoxrcia1fpte ues s)t2trxm nudlmtnmfei s) 2uax  ;t1tpxn ietydlmDrmu o;t0arxrio oodoa elnvi;t texoir3oo1ameelnvs ( artaumono0tltn f3tytfa2rln o;()tetnmo3iadomte u o;(0 rxrxo iy1omtnliciasfsDurxmpot4tptnifctltlm2umu pn(0tetnioctodoa rli i (0t2xrxm iu4lptnlfet t)srrau  ou4tet moetydfs2elnmp (0teermr3iadoa   neo ( srxrim oy1lpe mneiasfarrax  ot0aeto f3tatfmDulumo;t0 etrmo3oodopDr neol( sexmxo no1llee ivt (farta(ronu0oet  ociydls2rlnvp t4trerir io1fm eaues;() rtoio3nu1oltemfcia( s2uru pnt0ope mictltlm um(vs u0tetomf io1la e nvi;s trtrimpiudaltemiet tfsDtax ono4opto fctyd a2el(ms;u4trtnmocoy1op rln slt0texrim3nudll emicslsfarrax  no0ope mf3ils aDel( s u)altnxr3ia1lptelieilt)t2umimpiy1oleelnvil(faDur(mo;u4tpt mieiys mDuaumo u4tleoio3iotoateluvo t)t2xr(r nydllenmfes (farrru p;u0oeto fciatfm rlnvp u4 lxoxr3oa1fpt lu o (0s2tr(m ny4amee ici (  2tauronu0tltomi3ils a uan sn()tlxnmr iy1om raivsl(0srxo(r3oo4ap e ncsls  rrrum ;o4oleoii3tltlmDel(vs (4artoxr ia1laDrlnes t sruriopoy1llt  fct sfa2umxmo;u4tpxomfctydlsDuanvp t0arxnmf3oy1fp e uvi;s) 2tm(o oo1lptemfvs tf rtaumpnu0apxnif3iasfa el( s;t) renmf3to1op  lneolt0 rxmxopoodlmtnmnvtl( sDum(rooo1olxomociydlsDumnvo u4aexoio3iy1fmDe ivo t0 exoxr3nudam emnvsa(  2tr(ront1texo ieildls2eanvonu0 rxnifcto1fptrauvols0trxr(o iodlleelfvil( s2uaxrp;u4alx iictatfsDrluvpn()aeerxr iadomt  u sls0s2toxo ny4ap   iciatfartr(m nu1teeoiiciad s eaumo;() etomo3tadlptelneo (0 rtmir ou1op e fvt (fs2urxro;u4oet  i3iysfs2emuvsn(4alenxr tatopteli s;t) ruoxrpnudolte nesltf 2trx  ;o0alxnmfctas a2elnvo u) renmr3iytfp   nvsls  2umxr3io1lp nlnvsls a2taxmoot4tex if3iadfs2em(mp;(4tlxoir3oodlpt aivi;()sexrxo3nodopt mnvtls)srrr( onu4tee ioetyslsDemnmpnt4trxoxf ia1lmtr nei t setoxrpny1opt mici t  rtmxrpnu4apeniiciysfm2rmnms (0tlxrir3oodlmteai s;s0 etrimpoo1aptnmfct (f rtm(m ;u4aetomoeiatla2ranvo;(0areomr3tatlpte nvi (0setoir3oy1lp   iet t)sDtm(rp;t0oeeoiiciltla2em( p;(0aeeomr oa1opDe ues t setoxmpno1lp  lfcil(faDururoot4aexomfctydfs emn p;u4alxomrciytoat aneil()s2uo(m iu1ap  mivsls)sDum(rpnu4tpeomfciysfm rmn o;u0 exnxrcoy1fmDeluvi t0sexmio iydalen nvt s a2rm( p;t1apx  o3iatfs2ean p u4alxrmr3iodfat liei (0truo(rpno4omeelnesas srtmurpnu4apxnmfctysfm2eau s;(4 rxrxfcoy1laDr i i;s0t2xrxrpio1apt mfvslt)sDta(  nu4opeo fctytlmDuluvo () lerxo ootlat ai s t tetm(m3iy4ol emfvias sDrrx p;t0apeoif3iatlm rl(mo;() rtnxfctotop rli s t sexm(rpny1oltelicsa()srrmurpoo0alx  iciatla2emnmsnt)trtrmrcoatom rlnvs;t srtoxm oo4opt liei sfa2rau pnt1altomfciyd a umnvsnt)tetoxfctotlpt an i ()s2tm(m3ny4amtnmnci tfa2umx  nt1tle  ociltlaDrmn p u)artrxrciydlatean s t)seurirpiu1alt mivt t aDra(  ;o4oleomiciatfm2eluvont)trtnircoatoaDeanvsls0setmxr nu4am elfeiltfs2tmx p;u1oet  ietytlm rluvpnu0aeeomr3oadomD auvol()srumxo io4ap emfctls  Dtm( ono1oltomi3ildfa2rlu p (4 exnmfcia1laD lues;s0trxo(rpiy1ameelnvilt  rrrum ;u4aet ifctatfmDean s u0tlxoif io1lat lieo (0setrxm3io1al elfctl(faDum(mp;o0tex mf3iatlm rlums ()alenmr tytlateaieil()s2toxm oy1lpe  fcsls) 2tmum no1ope  iciys a ra(mo;t0tetnxfctatfmtelivils  eto(r3oydom  lncsltfs2ua(mo;u1aee  f3iasfa2eaump;u4aeenircoadfptr u slt0t2xr(rpiy4omenlivsl( aDuru  ot1aetnifciad m rm( p;(4arenxrctodlpDeanvi;s t2xmim3oydllt  fctasfsrumum nu1oex if3tldla ul(vpnu4 lermf3ootoaDr n olt) rtoimpiudlmtnmfvs tfsrururp;t1oltnmf3iatlmDemnmp ()tleoxr3oydlpDeln i (  rtm(o3iu1amee ncils s2tmx p;u1aexo ociatfs2em( o;u4tetoio oadlpDe n il()trxrxmpoydameemnvsat a2um(mo;u1apxoii3tlt a2umuvp t4 eerxo3iatlpD lnei (0 rxmir nudop eliviasf rrax oou4oetn oeiatls rluvo;u0arxoirctytlp elivs;s0 2xmim no1omte ivtas)arumumo;o4oexnif3iyd sDrmu p;u4trxomf oydoa rlivolt)t2to(r nydaltemicilt) ruru o;t0tlxnmociadfm uluvp t) rtoxo tadla elnvi s  2tm(mpoy4op e ncs ()arra( onu0oltoio3iysfsDrln o;t0 ltoif3iy1la r n ol(0setmio nodapt mnesl()s2uax p;u0tpto ictad mDuanvp (4alermf3oydfpD  ies;s)srxrir3iy4op  liesatfs2rm(r ot1tetnmo3tasfm2emnvo;() etomociodlpD lnei;(0 eur(m oodamt  nvsat s2tmumooo0tle  fciadfaDemumo;t4 rtoircty1oaDrlu s;()trxrxr3nodlm  mncs t a2ra(  ou1optn ieiytlmDem(mp t0altomr3tydoa  anvs;s srumiopiu1opt lnciat) rta(m ot4aptoiocild a ua(vs ()aetoio tatoat li ils)teto(r ou1om   nes sfsrur(  ou1aeeo fciltfa rauvonu0artnmr3iydfa  lu o (0s2trim3iu1openlfct t)s2ua(root4teeomf3iadfa2ran pn()artrmf3ootlmDe uvs s0 rxrir iy1lptnlivt s srrm(ront4apx moctydfs2umn o;(4alenmr3iytomte ies;t s2urxm3nu1lp  lictat)sDtmxrono4aee moeiat sDeluvo u4aeeriocty1fptr nei;s  rxoxo3iydlmtnmiet t)sruax  no4oex  o3tlt a2eaumon(4trxnir oo1lmtr ivol( s2uoir nu1ape  ics t) rrru  ou4tpx iiciltlmDulumo t) etomocoy1om rlivs;(0s2urio oydam emfei t sDrr(  oo0apen ieiyd m2eluvp t0 ltoxf3oydomtr ivo s)t2xmxrpio4apeelietls arumx poo1aexo fctlslaDuanmo t)teenxf3ia1fpt aivo s srum(r nu1om n ieta(  ruau p;o4oexo i3tld a em( snu4aexoxrctodlmteluvolt0srxrxmpoy1lpt mfcsl(fsrtaur ;u0tetn ocias mDrl(mo u0 rxomo3iodlpt ai i ()texm(rpoydameeliciatfsrtmu  nt4alxoifciltfsDem(vsn(4altrxr oytfp ranvsls)srxmxr ny1optelnciat)sDurx  ;o0tee mictatfm2emums u0aexomocoa1fmt lnvi ( t2umirpoo4optemnvs ( srurx o;t1aee ifetadfmDeauvp u4treomociodfp e u slt0 rxr(mpnodope mncil() 2rax ont1apt  fctltlsDelnmsn()teenmfcio1omDe nvo;s0t2urxr3oo4am   ivil()arum( pot0teenmo3iad m uauvsn(4 exnif tadfm  aues;t) rtrimpiu4oltnlfvtlt)aDraumpou1tlx mfciyd s2ulu sn()tltrxr oy1lp r u o ( t2xmxr io1omte iviasfsruau pnt1tltomoeiad a emn s ()trtnif3iodoaD  uvo s)seumim3no1lltnmiet s  rur(  no1apx  fetltlm2el(mp ()trerio3iotlate neolt) rtm(r io4omenliei ()aDraxm ;t1tee iieilt aDua(vp;u0 lenxr3iodla e nvols trxmir nudlle  ivias) Dtm(m nu0tle mo3iysfaDuauvo t0tlxnio3oo1fmt lu ils)t2urxm oo1lp e nei tfs2rm(mpoo0optnmo3iadfaDrlnvo;(4tetrio3tytopDrli olt teurxmpou1llte fctat) Drrumo;o0aptniiciadla rm(vpnu0 exrxoctadfm e neo ( trxoirpiodllt mncs s  Dtmu  ;u1oeenio3ilsfs el(mp t4tltomr3iodfp  au s (0t2trio3ou1llt  ivt ( a2taurpnu0tlt mi3ilsfa2ulnmonu)tltomr ta1fmD  uvsl(0tetr(rpou4lpe  nes t)aDumxr ;o4alxoiictls a emn pnt0tetnmr3oodfmDeai slt trtrxo3iy4opt lics ()srtr(r oo4ape mf3iys s ul( o;(4 lxnir3oatfmD  uei;t0 rtm(r iu1om nmfcs () rraxrpoo1texomfciadlsDumnvo t4 ltnmr iotfa rlues;s0s2umiopno4llt  neslt  2urx o;o4aetn fcildls ea(vp u4altoxr io1op   uvo t truoiopno4lm  mfct () rurxrp;t4oexomf3tytfmDemu s (4 lxrio iatopD aieo t) rtm(r3iy1alt mnctat)srtm(ronu0tleomo3ias a2emnmo;u0 eeoxfcoodopDe i o t s2uo(r3no1alt  fvtas srum(mpnu1tpx  o3iytla um( o;(4alermrcoodom elu olt srumxopio4al  lfcsl(fa2rruroou4tetoifetldlmDumu p u0 rtoxo3oatlmteln o;t)s2umxr io4ll emfci s)s2ta(mooo1tpe moetytfm em(mon(0tetomocoodfpDeau ilt)srxo(o3ny4llee fcil(fs2rm(rono4aetoiietyd aDrau p u0aeenxf3oatlptr ivi t) 2xrxr3oy4lmtn fetltfsDur(rpno1tlx io3iyt a2ul(vs;(4tlxomfciydfaDe u o t) eur(o3nu4al nlnesasfsrrr(mp;o1tpt micils a elnvpn() rtnxr tadfp r ivs s setrxopnydomte ivsa()aDtmx poo1ape mi3tltfa2ea( onu)aexrir3oo1lat anvs;s0sexoxr oo4ol emfetatfaDtaxr ou0optomictad aDel(vs;u4aeeoif3io1lmt  nvs t  2umxr3ny4alee iesl() rtr(r no0tpeoifeiat a2um( on(4 eenmr3iytfpDeanvo;(  rxo(rpio4ol n nvtlsfsDtr( ont0alt ii3tysfaDumump;u0arxoxrctytom  au ol(0srxmxrpoo4ameemfcslt s2rmu pnt1opx mociydls rauvpnu0aetoxo io1lmtelu o t0texmio3oudomt mivtlsfs2taum oo0ape io3ild a2em( o u) exnif oatla rlu i;t)teur(m nudomenlnctls s2um(rpot4aex mi3ildls2eln s t0trtnmo3tadfpteli o;t trtrim iy4lm  lfvs s)s2trurpot4optoiieild sDel(vs (0altrmr3iytfmtelivo t  rumxmpou4omtelfct (fartrurp;u4oexomo3tydls2elnvo;()aexrxf3oydlm   uvo s  ruo(r io4apen ici t)srtrx ont4tpenmoeiatlmDumnvp;u4 rtoxociotfmtr ies;()s2umir ou1llt  icsls) rtm(moou4tpt ifciysla2rl( s () lenirciy1fpDr nei;( trxrxr3oodlp  mfcsas)artaxm ;t0tpeoioeiatfs rm(vs (0 lxomocio1lateaieolt trxo(m3nu4lm nlncsat artru  no0ale iietas s rauvon(0 etriocia1omtraieo;t)srtr(m ny1am elnesl()artmxmp;t1texn oeiyd sDran s;t4tetnmfctodomDeaieo t) eto(o oo1al  licia(fsruaum ou1teeoii3iatfsDumuvpn()alerxo3oatopDeaneolt  etmir nydomtn nvi ()aDumurpou1tlt  feiadlmDrm(vs (0 exoxrcia1oaDraivo;t s2toxr nydam nmivsasfaDtaxmoot4teeniociatlaDrm(mo u)alxnmf totlpD livols s2uoxrpou1amee netls a2um(mo;u1apeomfeiytlaDrlnvs;(4 exnxo iy1fatelueols)t2uoxo oodllt  fviatfs2rmumoot1oeen oeildla umu o;t)trtoxfctadfmteaneo;t setrxopiu4oltnmfvilt)a2taump;o1aeen f3iydlm ea(mo (0alxrxf3iodfp rauvo;s)t2xm(r iy4ll   ies (fs2rr(r ou0tpe miciltfm em( s u) eerxo tydlp e neil()t2xoiopou1ap   ivtas sDum(  ;t4tlxo ieiadfm rmu on(4 lxomr3oytlmt an i;(  2xrxo3ou4ale  fcta(fsDrmump;o1oetnmfciadfm ra(mont0 eenxr3iatlp rli o;t)teuo(opny1opt lnvi s  Drmum oo4tlxo o3tyd m rluvp;(4 exnioctydom  aneo s0srxr(mpno1ll emivslsfs2ururooo1tleoiiciaslmDem( o u4arxoio iodfm rai s;( seuoirpiudapt mneil(fa2ta( ono4texomo3iyslaDrl(vsnu4aexrmocoy1faDe i o s t2um(m iodaleelfvs s  Dra(mp;u1olt  ietlt m rln sn(0 rxrmf oy1lm   i ils0 euo(m3ny4lpee nvt ( artrumont1altoiietysfmDrm(vs;() exrxo3iadlm eanvsls0trumim oydapt  ici t  2um(mpno1tet io3iyt aDrlnvo (0tetoxrctotfpt lueo;t0 rtrimpno4amtnmictls) Dtrurpnt0tptomoeilsla ea( o u0 exoio oytlateluvs;t  rum(o3io4ame livt t)arrrxro;t4apx mo3tatfa ea( snu4 lxnmr3oa1lm  ln sl(0 ruoxrpno4ope mfeils sDua(mp;u0tptn fctytfaDemump;t) eenmociodlm eanesl(0t2uoio3ou1apte nctls) Dtaum no1tleoifeiytfm2emnms u0aeenmr3totlmteai i ( t2tmxmpiy1ape livsl( srtaxmp;t1olto iciatla2ranms;u4texnif ta1lat aneilt)t2uoxopiy4op  mncsatfsruaxront4tlxo o3tydlm ul(mp;t) rxnmr3totop  aueo s  exrimpiy1om e fvtas)artmur ;o1olx iociad m eau on()arxrmr ootoaDrai s;s)trur(rpoudole miei t)a2um( p;o1oet  oetatfm2umuvpnt4aeenxo tydlaDe i i s)truoxr nu4op  lici s  rur( onu0tpx iiciadla2uaumo;(4alermo3io1fat anes ()trxrxr3iy1alenmncilt  Dumxr ;u0tpe  fctadla elnvs;(4 reoio3oo1om rlnvs t  etmxr3oy4ole  fei (fs2umu onu4aleoiiciysfsDrluvpn(4teerxrciotlmD auvo t0 rumxo3ny1lpt mivs t) 2ta(rpnu4opxo f3ildfaDemn onu0 leoxf3iydfa  lieo ( setoxm ny1alenmnetlt sDuru  ou0alxoifcilslm ea( ont)areomfciotlmt aneslt)t2to(o oudalenmnvil( arrrx oou0aptniocildfmDum(mo () eermfcoatopD luesls)srtoxm3ny4ol nmnes ()artrxrpoo4opx iocildfaDraumo;t0trtnxr3iatfm e uvo s s2triopnu4oleemfet ( arua( onu0apxoifciltlm2ua(mp;(0 rtrircoadom elu o s t2tmxr oo4om elfeta( sDrmum ot0tex moeiysfaDel(mp;u4tlenifcoodfa r n ils0 exr(mpoo4lle  ivtat  rtax pno4oeen fcias a emumsnt0tetoif3iatfa eauvsls0srtmim oy1op  liviat)sDtr(  nu1apx  ictaslmDel(vpnu)artrircoadoptr ivo t s2urir ny4opte ivt sf rtr( o;t1optomf3iltfmDelu pn(4teermfcty1lptrai ols  2umim3iu1lptelncsa(fa2ur(m ;t4oleo i3tad a2ra(vp;t4 exrir iatoat  ueo (0srumxm no1ame mfvtas  Dtruro;u1tptn feiys aDelumpn() exnir todlaDr u il(0setr(m iu4openlfvtl(fs2tau p;t4aee miciltlsDea(vont4alxoxocio1latran s (0truoio iodapt  fcils)sDum(monu1tlen o3tld s2ul(vpn() lxnxfcoatopt lies ()t2xmim3nudal  mnvta(fs2umxm ;t4opxnmfeildls ranvont) etrxoctydopDrliei;t srtoxo nudlpenmnci ( srrrx  ot0ope  f3tys m ranms u)trtnir oatfm r ieo s0s2um(o oo4lmtnlfeta( a2tm(  no0oleomieiysls2um( on(4 lxriocta1lateluvs;t0 etr(o3iydamt  fcsat) Dum(mo;o4opeomieildfs2rau pn() rerxr3tadoptr ieolt)s2tr(o oydlm  lfvt sfa2rr(ront1tex  o3iyslm ua( o;t)areoifciytfat  neo s) rxrir3ou4ope mncsasfaDum(ronu0opxo ieiatlm rau p u4texoif tydoat au o;()srtoxm ou4ole liviat sDrrx  ;u0alx  feiydlmDumuvont)altrxr3totfa ran ol()trtrxrpou1lme  fvt t  Drau oot1aet  o3iatfm eau p;(0aetrifctadlaDraueolt)srxrxopoydlpeeliesl(f Drmuro;t1open i3iatfm uln p (0 leomf3oytlmteaieil( s2ur(m3oy4lp  micilt) 2trumpno0olx mi3tatla2el(mo u0altriociodlmDelnvs;s) etm(m3nudol nlfeslsfs2tr(m nu1ale  ictydls2uln sn() rtnir oo1op  au s;( s2tmxr ou1openlfesa()srum(  no0tltoiicilsfs2rmu o t)altrmrctydlm ran il( seumio nudll emfcias arrrxmpou4oetomf3ilsfm2umuvon(0aetrio3oodlptelneol()s2ur(rpio1ome mictl()a2um(rpno0opeo fciltls2rl( o t0aeeomr3oa1faDeaueilt0srxrim nodalenlncsatf Dururpnt0tle iiciydfm rmn p ()texoxo todoat lieo (0 exoiopoydame lfvi s s2uau onu0oeen ieias s2rl( o;()altoxr tadlpte ueolt)trtoiopou1olt  fvsl(fa2rrx pou4aex miciys mDrmn on()tetrxr iydoaD liei s0t2tmio3iudopee feiatfsDtm(roou0texn iciadfm2ua( s ()arerxr iydomDelu ilt0teurxo ny1altn fct s a2tmxrpot4tltoifciat a ul(mp;(4aexoxr3oadlmDe nei (  rtrimpiudlpeemici s) ruau  ;o0oeeoif3iysfm emuvs;()teenio ootlpDean s;(  ruoirpou4opt livil(f Duru poo0tpxnmo3tadfm ra(ms;(0tlxnmf iotfmtrauei;(0 rtrxopnydolte iesat  Dumx p;u4altoif3tydfa2emuvo;t0tetrxr3iy1latrlnes;( t2uoio iudoleelncilt)s2trum nu4opeo i3tat sDelnmpnu0trenmfciadlaDe ues t t2umxmpnydlpeelfcsls aDtmurpot0tle mf3iys mDul(vp () lerirciadop  ai i;t)seuoimpnu1optemies s arum(r ou0tet ii3iydla2ran o;u4 rtrio3tadfatrlivsl( srxr(o oy4om   ncsat srtmxmo;t0tlxnifcias s uln pnt4arxnxo oy1lpteaieo s) 2xoxo3io1openlivsatf rrr( p;o1oee  ieiadlm em(vo t)alxrxocoa1fm  anei;s)t2trim3io1ol nmivilt) Duaurpou1tle moeias aDuanms t4 eenmf tytoat aivilt t2uoiopoydome  ici (fa2rauroou1olenmo3iatfa umnmp (4trxnir3oy1la   ies;s)t2tmim3oudlltemivsa(  2rmx  ;u4tee ioeiytfa2eanmo t0artoxfctotlaDrlu sl(0srxr(o3iodlp e ieiat s2tm(roou0tetn feiytfa2eanvp;u4 ltnxr3ootla   uvols t2xrio nu1lmte feta( aDumxm ;u0alen oetlsfa2uau sn(4tlxrxociydfpDe n o t)t2xr(r nodap nmfvt s artaurpot0olenmictad s rln on(4tleomrcoatoaDeauvols0srtrxr nydap n fvsl(  Duaurp;t0aetn o3iatfs2uauvs t) rxrmf iydfmteln i ()srtr(opnu1amenlictat)a2rrurpou1optnmf3tys s ea(mo;u0tlerircoydlmDrauvs;t0t2toimpou1llenlici (  2raxro;u1tpt io3tldfm2eln sn(4 lenxocty1laD aivo;s  exm(m3nodal  livs s srumxmpoo4tlxn o3iys m2rmumsnt4arxrif iodfatraueslt0s2xmxopiy4am emfesls  Drr(mpoo4opxomiciyt s2umn p;() exnxo oydoa ran o t0tetrimpiydaltnmncs () 2ur(  nt4tle ifciys s rluvp;u0 exomf oytlmt lieo t)s2uoir nu4amenlnvslt)sDrr(m oo0tpx mfciydfs em(mo;(4trxnxr ia1om  livs;t0s2um(m3nydlm elnvta(faDtm(rp;u4alxniocilt m2ran p;t4tlxrxrcia1la eanes;t srxmirpiudapenlnvsa()arrau ont4tptnif3iasfmDeanmp;t0 eermf3oy1fatelieol()trxr(mpny4omee ivi t aDrruroou4optn ociyt a eluvo;u)tlxnxf3iatfptraneo t  2urxm ny4omee nct tfsrtmu  ;u4opxoii3ils a2eaump;() leoxo to1omDrauvs ( srtm(m oydllt lnetas s2trumooo4tetoiieilt a2uanmp t4 lenxf3tydomDraivo (  rumxrpnu4opt livi (fs2trx poo4tleo i3iasfm2rmumonu0 lxnmr3iadlm eauei;t0truoxo io1lme lfvs sfaDum(m nu4teeniociys sDulu o;t4artnir tadoptrlues;s)seurxr iy1ol elicil(f 2raumooo0tle mfcils m emnms;(0arerifciy1fmDelivs t teurirpoydop emici t) rrmu  ;u0apeo fctadfm2eaumpnt)artnir3tytlaDraieo;t)texmxr iy4lltemict t) 2rru pnu4aptnioeiysfs em(vs u4trtrmr iy1fm rlivolt)t2toim3ou4lm elnvi sfa2rax o;o4texoio3iatfmDrmnvpnu4 renxociytoa  anvo;()s2umxopoo1ol nmfvsasf Dtmurono0oetn ieiydfaDem(ms;t0 exnxo tydfp r ivils  2trir nudoptn fvs s)sDta(ronu4alenifeildlsDumnmo t0artnir3totlpDrluvslt0 eumir3ny4lptnmfvs ()srta( o;o1ope  feiadls2uln p (4altnxo oodfate nvo;s0trurimpou4op   ietl()aDurxmooo4tlxn oeiys a ra( s u0tleoiociadoa e u i t  rurxr oo4aleelfcs s  2urumooo4opx  iciysfs rm(vo;() etnir3iatomD ln sl()s2um(m nudlpt liesltfaDtmx oot1apxomi3iat s elu pn()tlxnmr3todfp e uei;t0srxmimpoudomeemnvt s arua( p;u0tlt io3ildla emn snu) exnmf3totfm r nvols)seurxm ny4opeemnet s)aruau  oo0alenmieiasfa2rl(vpnt0 exomr3iotomtr i o;s)srtmim3no1omtn nvs t)aDtrur ;t1oexoio3iydfm2eau p u0trenxrcty1fatraivo t  exmirpiu1aptn nct s srumxmp;o4tex mf3ildls2em(vont)treoif to1faDran i t) ruo(mpnu4al elfvtlt  2uaum ;u4oleoiocilsfs2ul( o;t4arxnmr3tadop eauei (0 ruoim3nodlltelfvs tf 2rr( onu4opeoio3iat s em(vsnu4artrir oadlaD  neil(0srxrxmpou4omte fvsas) 2rm(root1tpt ifetyt mDra(ms u)aexnxociydfp rauvs;( s2trxopio1lme  fctls a2uaxm ot0olxo i3iltlaDuanvo ()alerif io1oa raneo;() etm(rpnudoltn nctls sDtaur ;o0tpx  oeiytfs2ea(vo t4tlxrif iatfmt  n ilt  2xrio iu4lm emncta(  ruru pnu0altoii3iyd a2ran o;t4arerxr oy1lptraueils0 rtmirpnodlptelnvi t) rraxmp;t4apenifctas s2um(vsnu4tltoir3oodlmt  u il(0s2ur(m iy1lm elfcias)srtm(r ot1oetomieiytlaDuluvp;(4aetnxr oo1fpt  neo (0sruoir nydll nlfcs s) 2ta(r no4ape moctyt s2umumo;(4tlxrxociytfm eli o;s texmxmpio4alt mnviasfa2tr(root4olx if3tad s rauvp u)teeoirciy1lmtrluvi;s) etr(m nu1omee fvs t)sDtau pou4tltnifetatlm elu ont0aexnxrcoa1faDeaueo;t0 2ur(o3iudalt lncias)srumxm ;o1tptnifctas a ulnmp;t0texomo3tatom  li s;s  rxoxm3ou4amtelivil( a2raxr ot0aee mictatla rauvp ()trtriocoatoptrau i t)t2xm(rpiu1llenlicil(f rrr(m ;o4tpx ifetadls2elnvp;()teeomr iatfm e i il(0 2uo(rpiy1om  mnviatfa2trxro;t0aetnif3tadla2ua(vo ()tlerif io1fmtelieo s)trtmio iudap n iciat srrr( ono1tltoio3tatfaDel( onu4teeoxo3iytfaDe i s () 2uoirpoodlleemnctas srtm(ront1oltn ieiadlaDemuvpn()tetnir3tadlpD anvil(  eumir3iudape lfvils  rrru oou1optomf3iydla uan p;t)trxoxo oydomtelu o (0t2xo(o ou4ol  mncsls s2tax  nt0apxomo3tad s2umuvpnu0tlerxrciytfmD luvils)srtr(o io4ll e ivsat)srtmxmpno1aleoioctydlm2ra(mo u) ltnxf3iatfate n ol(0 2toim3oo4om   fct t)aDrm( ont1aee  f3iaslaDemuvo;u0trtriociatfmtran sl(  exmio nodoltnlnet s  rraxrp;o0oee mictldfa ua( p t0areoio3oytfaDr neol(0 2ur(rpio4amenlfvsat a2taum ot1aet mfeiyd mDuaumonu0tetnmociydfpDrlueo (0seuoxr ny1omtnmiesasfarrmx ooo4altnii3iad sDulnmpnt4 rerxr ia1la rau o;() eumir3ou1opee fes (fa2trur ;u0tee if3ildlaDrm(mpnt)altrxo3oy1fm eaueils  2tmir3nudll  mnvtl(f Drrxmo;t4ope  feils aDumnvs t) lxnxf3tydlaDr nvi;s seumxo ny1lmeemietat)a2uaumpou1tpe mf3ildfs rmn snu)trxnir oy1fat li i t)srumir3ny4lmtn nvils)arurxr ;u1tetn feiaslsDean p;()arenxr3ta1om   ueslt s2ur(o iu4lmtnmivs t sDumxmpoo4tpeomi3tatlaDumuvo u0aexnmr tatom  anvo t)tetoio ou1altnliei t)aDuaur no0tet  o3ild m ua(vs;(4 exrxrcoa1lm rauvs t0 rxo(opoo4lm  lietlt  ruaur ;o1aeto feiatlaDeau sn(0tltnircoytlmt  n s t)srxmio ny1altn ivtlsf 2rm(rp;o0tet ioeiyd s2uau s;u0 etrmo3oydlpD luei;(  etoio3nu1lp  liei tfarta(  nu1aeto fciyd s2rmnvs;t0tetoif oatlmtrlueil( truoxopou4lmtnmfciatf Drrumpnu1tpxoiieilsfm umump;t0trtoirciadoaDelneilt0texr(m oy1alee icsatfsDtaumpnt4aetn ocilsfs2rlums;t4altnio iytoa  lnei ( srtmxm3oy4op n fes s) 2uaxr ot0apt moeiysls2rmn s u)aeenmf3iytlm  luvo;()s2uo(r3oodomtnmnvtl( artrxmpot4aleo oetltfm umu sn(0artoif oytlpte ivi;t)s2uoimpiodal   ict s srtaxmp;o4tetoif3tydfa2elnmp u)texrio3oytla eaivolt)srtrxrpno4opt mncia(faDrrxm nu1oeeo f3iydfm2em( s (0teenmr3ta1oa raneils) rtrimpou4apeemfvs (fsrum(ro;t1oexoif3iysla rmnvo;t4texrxo oytfpDeauei;t0texrxm nu4amen nesls) 2uaum ot1teeo f3iytfsDran o (0trtnif ootlpteanei ( tetr(m3oudalenlfvtlsf rrax  ot0olt  ociaslaDulumont) ltnircoo1lptrli i;t0 exmirpnydlleelfvtas aDrax  no4tptoifciltfaDumnmsn(4aexrxr3todfpDe ueolt srtr(m iydlpenlieiat)a2raum ou0optnmoetytla2ulnvo (4aetomf ty1laDe ieslt)srxo(rpou4lpe lnetl()a2tmx  ;o1alxn i3iyd aDul( sn(0 ltoxociatoaDe uvslt trxrxm3oudoleemnvi () Drax  ou1olx  iciytla ul( o;(4aexnmo oo1opteanvil(0tetoirpou4lpt miet t) 2taumono1apenmfctyslmDrau o t4 etnxo3tydoptrln s;() ruoim ny1oltemfcil()srtaurpou1olxnio3tyd sDemn ont4 exrir3ootop  livolt s2to(r nydamtn ivs sfaDurur ou1oeeomo3tas mDrauvsnt4tlxnmocoo1lm r i o t) rxrxr ny4ome mnctat)sDrauront4aptomfeildfm rmnvp u4trtnxo oa1lmt anvs t0 rxrimpou1opt  iet tfa2uaxrono0oet moeildlmDuau s (4arxoxf3io1opDelneils)srto(m nydapee fes (f Dur(  oo0oeeomfeiatla uluvo;() rxnifciytfat lu s;t0trxo(opno1llt  nvias) 2tru  ;t1oltoiieiysfa rmums;u)altnmo oy1oaDelu ol( trxo(m3iy1om n fetas arrmu o;t4aeen icild sDrauvpnt0alxoio tydfp rlu i () 2urio3nudlp nmiet ( s2ur(mo;t0tpxnii3iatfsDrl(vp (0teeriocootlpDr uei t0sruoio nodll nmncs t  rtaxm ;t4alt ifetat m2rm(mpnu0artoif ia1la rau il()sruo(o iy1opeelnvtls s2uau pnt1opxnmiciasls rlu p u4aetrio tydlpDrlivsls  ruoxo3ny4ol nlfvtat aDurxmont0opeomfctltfs um(mp;t) eeoxo iy1laDeaieo;t0t2xrxm nydom nlfvi (  2rr(rpnu1aetomfeiyd m2eau pnu4 ltrxociytfmtelnvs;t0trtrxrpou1lme livil()arrr(moou4oetoifcilt sDrl( sn(4trenmr oadfa   ueilt0seurxopny1omeelivta( arumurpno4tpxnmfetat mDrmumsnt)aexoio3ia1fm  aieslt srxmxrpiu4openmfcsatf 2uax  ou0tpt iiciadfa2eln pnu4alxoif3tydfa  anei;t trtrxrpiodaptnmnvs tfs2rauroot1oet  oeiyslaDrmuvo;t4teeoxfcty1lat  ieil()trxmxr3ny1ll nlfcsa( a2tau oou0altoifcildls em( snu)aetnxf3oa1lptr i slt0 2trxr3nodoptelfctasf Dtaumoot0tetnmo3tydfa ea( o;() lxnxo3iotomteln slt0 exoio3iy4omte iviatfa2ua( poo4openmf3iltlsDelu s;t0aetnxrcoodlpDe neo;s seuoxrpnodolt lnctl()s2rmxmpot1oet ifciltfs uau on() rxniocto1la rau s (0s2xrxmpnu1lptnlfcilsf 2rm(mo;u4tetoifcild m2uanmp;t4 ltoif oydopDeaies ( trxmim ny1lp elfciat)sDtaxmoou1tptn ociyt mDrmuvo u) etnxo3to1fmD  iei t  rur(mpio4am  micsas  rrm(r ot4teenmf3iytfaDuluvpnu)tlxnxr3oo1faD au s (  euoxm oo4omt  iet sfs2rruront4tlxo ictadlm el(vo;(0aleoiocoa1lat auvils)trtmio io4lpenlfcil() rum(  ;o0aee  icias a2eanvo;t4tlxrmr oa1fat  nei (0 2xrxo oy4lp  lict s) rurxm ot1texniictydla2ua( p u0 rtrif3iatfmDeai s;( trxrim iu1ame  neilt  2um(m ou4alen icild s uln s t0 rtnxocoadoa eluvo;t0s2xmxopoy1al emnesltf Dumx  ;u1tle mo3iat s eau s u0treoio oodfa   nvo;s sexoxopio1llt livtasfsDrmum nu0opeomfciydfmDemnvp (0alenxr tadopt lues t  etmiopiydlpeeliei s  rraxr no1opto ictlslm ranvsnu) rerxf3oytfa ean s;t) etoxr nu4ap  mivsls)a2tr(mpno1opx iocias s umnvo;u4 etoif io1optean s;s)setr(rpoo4omeelnvt tf Dtrum nu0apxnmiciydfsDum( pnu4tetoxo tatlptr neo;t  rurim ou4ol   ivtls) rtrx pou0tptn i3iat m2uau snu4trxrxf oatfateluvslt0texoir3iy1ol nlfeias) 2tm(  nu4alt  fcias s2rmumo (0tetoif3tydlmt livi;s) etr(mpny4lme  icta(fsDrrxr nu4aexomociyt a ua(ms (0 rxnmr3iydfpDeanvi;() 2trxr3iu4apt lfviltf 2ta(rpnu1tptnmoeilt s2el( o;t) eerxo3tydfat li o t  2umxm3iydamtn ivta() Dta(m oo4teeo f3iyd a2rauvpnu4trtrmo3tatlaD  neols0 2xrim3oy1olt mnesl(  2tmum ot1tpto fetas aDelumonu)tetoircoo1om ean s;s t2xrxopoydapeelfct sf Dtaur ;u1apen fcils sDul( s;t4trerir3oytoaDeluvi s  rxm(r iy1lpt mfetat  2urxroou4tltnifctlt a2em(mp (0texnmo3iodfm r nvo s) euo(m3ou4amt  fet s)sDum( pno1olxomfeias s2eaumo;t)aetomo iatfa   neol(0 rtoimpnydlltelnct (fa2urxm ;o1tlxoii3tysls eau o u0altoxo3io1fa  auvo t s2umxrpno4olenmnesl()srur( pot4tet  oeiltls eluvo u)arxnmf3to1om  ln s t0 exm(r3iu1lme  icilsf 2rrx pot4aet mictasfa elu p;t)aetomf3oadfmtraies;s0 rto(rpnu4op e ivtas)arta(ront0tpt mfetadla emu p;t4teeoxf3oatlmt  u o;t0 2xmxo3iy4optelnesltfa2umu pnu1oetomfeilt m uau s u0texoiocoytfaDe uvi ()s2xmim3oydlmeelies s)aDrrxro;o4tlt mfeildls ulnms u4teermf3iatopDe nesl()srxm(mpnodop   fes tfa2tm(mono1ope  fcildfsDranvsnt4teeoxo3ia1lp   uvsls setoirpoodalee ici s srurum ;o0oexnio3ilsla eanmo;t0trtrmf totla r ieols  2umim nu4alenlfesas s2tr( p;o1optn i3tatla ua(vo t) eeomr3tydomtran ilt s2umimpou1om   netlt)aDtaur oo4tetoifeildfa2ea(von(4 exomf3oatoaDeau ils seuoir oydop n iciatfa2umur nt0tpen i3iydls2raumon(0tlxoio oy1fmtelnvs;t)t2uoir3oo1ll nmivia()srumu  no0olt ii3iad s2rl( p;u0 rxrir ty1omDr i o t t2toxo3iu4lptelfvtlt s2tr(  ;u1alxnif3ilt mDrl(ms;t4 rtrxr3todfa rau s s0trumxo3oydlle mncil(f rtrum ou1tlt ifeildfa uan p;t0texoxociatfmtean il(0srxrio3nu4om nlfetlt)aDumx  ;u0openio3tys s ranmsnu0 lxrmfcta1fate nvo s s2tr(opnudlpee ncilt)aDtr(m ou4tleniociyt s2ean pn(4aexrxf3todfateanvo;s srtmxmpnu1op nlnvia(  rum(mpoo0apeomoeiadls umuvo ()trtoxocoa1la e uei ()s2xrxr3ny4alt lncsas sDtm(  nu0olenmoeiadlsDuaumpn()tetrxr3oa1op eaieolt  2tmim3oo4lmenlivsasfaDrmur oo1olt mf3ilt s2emump;t4 rxrmf3oa1lmtr n s ( s2urirpiy4lme  fvta() rumump;o0tpeomfeiyslsDemuvs t4 rtnif to1lpDr n i () rtm(opoo1lme mivi t  Dtr(mpnu1tle mietltls um(mo;(4tlxoio3todlmDr i s () rxrxm oydalt lfcsls) rtaxr ;o1tex mf3tatfs2eaumo;(4tetnmr iydla rlueilt)sruo(mpnydomt mnetlt s2um(rp;u4oexn o3ils a emnvsnt4 etoxo iydfat au olt t2xm(opoodlleemfct s sDuaxmo;u4aptniociltfa uan p u4tlxrmr ia1fptr i o t0setoio iodoleelicsatfarumxmoou4tet  f3tysfaDumnvp;(0altrxf3oodfa  aivsls truoio3oydol emnviltfs2ur(m ot1teenmiciydla2umuvs t4aexrmocoo1lmtraiei;()seur(o3oo4om elnei t sDrmu p;t0apt iictysfsDum( o;u)aleomo3to1omt  ueils srtr(r3nu4lle  fct sfartau  ou4opx moeiatlsDranms;(0alxnxf3oatlmDr i il(0 rtoio io4open fctl( aDrauronu4teto oeiytla rauvo u0aetrmo3ia1oaDranei;t0trum(m3io4lm nmncilt)a2rr(mo;o4tptniietlsls ea(mp (4 etomr tadopDraivs;( trurxm3oy4ap n fvtl()arumu  ot1altomieiyd aDua(vsnu)arxnmr to1op r uvs s0sexr(rpnu1ol elncilsfaDtrum nu1alx mocils s2ean s;(4 eeoxrciydoateaueo;t) rurxr ny4op e fesas aDururpoo0alto ieiltfm2emnmont0 ltoxfcta1op r uvo;t)t2uoxopou4ol  mfvs s) rrmu  nt0texn i3iyt mDra(vs ()aeerio3tadfmDrlu olt  2trxopiy4al elfcsls)a2uaxroou0teeomo3ildlaDran onu0alxrmrctotlpt ln slt0t2tmir3iydlp n fetlt) Dur(mpou0altomicilt m2el(vp;u4 ltoxr oadoa   u sl()s2umxmpnydameemivt t)a2tm(mpou1oee mfeildlmDulnvsnt4aetnio3iydlat an i s)srto(m iy1lmtelietl() ruaur nt0opto fetlsfa2rl(msnt4arxnmrcoatlm r uvi;t)srum(mpou1amtemnet t) Dtmu oot4altnmo3iysfaDuan o u)trerxr3ia1lat  ueo (0srtr(m3oy4lmtemics tfa2umum nu0opt  o3ilt m emnvo (0 rxrxf3oodlmDr nesl() exm(m3oo4lmtnmnvtl(f rrmxm ;t0tpto oetatls eauvs t) rxoxrciatlpteln ilt trtrxrpiu4altelici s) rrrx  no4ape ii3iltlaDel(msnu4 reoxr tatoa e i s t  2xoxr nu4amte fesa( aDrr(  ;t1tetnmfeils aDuau snu4tetniocoatla rlnes;t)setmxo3iodllt lneta(faDurx pnt4tetnii3ildfaDemnmp;t)arxrio iadlm eaues t srxmir iy4ol emieslt) Dumumpot1tltn i3iys mDemn p;u0arerxo oodopDrli ils0 2um(mpio1ap n fes s)aDrrxrpno4open o3iydfmDul(vpn()tetoxf ty1oaDeauvs s)s2tmxmpio4lpee ies t) Drmxmo;u4alxn f3ilslmDulnmp;u0alxrir3ootop   uvi () 2xmir3no4apenmiei () 2ur(mono4oexo f3ilt m ea(mp;()texnxf oy1lpDr ueo (  rto(m3ny1lp nlnciatfaDrrur oo4oltnmi3iatla2eau p t)tlenircia1optraivi s0 2tmiopiudol nmnetatfs2uaumpou4oltomieiat m rm(mo (4arxrmo3oydlp  aieils) 2xmim iy1llt  fvs sfsrrau pot1aet ioeiaslaDem(mo ()trxnio totfmtrauvils) exmimpiu1ameelfvi ( aDtmxrpou4ape  fciys a2eanms;t0aeeomfctadomt aivo ()s2tmxm3io1optnlfvils aDuau  nu0opeoifctytfa rmumsnu0teenir3tatlat livil()tetmiopno4alt  fetls sDtrumpot1oet micild m ua(vp (4 lxrmo oydom eanes s t2xo(mpno4ap  lnvt t aDra(rpot4alt  f3ilsla2ra(mp;() lxnxf3io1fm   i ol( t2umxm ny1opeemivsls)a2tmxr nt1teen f3tls mDrmnmpn()trxrxr oydlpDr n o;( t2xmxmpio4lme lnvt ( sDrrx pnu0opeoifctltfaDrm( s;() ltrir oatfpD  nvi;()teurxo oo1omenmivtltfs2urxrpno1optn o3tatlm rm(vpnt4trxomf3todfpD  nvils0 2tm(o iy4lle mfctls) 2raurpot1tpeoiietlslm uau p;(0trxnmr3oo1la raivslt0srxoxr io1lpt  iet s a2umu p;u4alxo ocilt aDra(vp u0 etoxf oodfmD  ivilt)texrxm iu1apeemnvilt)arrax o;t1tlt iieiytfa ra(vpnt0texrxf3iadoatrau ols0 2tr(o3iodomen fcil(fsDurxr ou4oet  ocias aDumuvo u0 exoir3iydoptelies;s  2tm(o iu1amte iet t  rraxronu0tlt ioetldla2rm(mp;u4 exrir io1omDe u o;s teurir3ny1omtn ics (fsrum(m ;t0altnmfeiltlaDran on(4trtnxrcoodopD li ils  2xoxrpny1openlfeiatf 2umxr no4opeomociadfm2ulums (4 reoxocoadfpD au i t0srxoxr3iu4amtnlnvi t)arum(rpoo0tpeniocias a2eanvsnt) exnircoa1opD au o;( s2xmim nudlpee fci s srumumo;u0tpe mieilsfs rmnmsnt0trerxrciatfa  luesl(0srumim3ny1llt  nctlsf 2umu o;o0tet mieiltfaDea(vpnt)arxoio3iydoaDeli ilt0 2trxrpoo1lpeelnvi (faDraxroot4texoif3iysfs2emnvpnt4aeenxr3tydfm e ivo t)s2xr(m3oo1lmt lici s s2um(ronu1olxomictlt a2rln p u0alerircta1lp elnvi (0s2xmxr ny4olen ictat srtrx oou4apxnmfetatfmDrmn p;u4altoxf3oytfaDrlu ilt0t2urxo3oudomtnlnei () rur(  ou1ope  f3iatfs2uauvs ()aexoifcia1fatean i t0srxmxo oudopeelneias) Draxmpou1tpe  fctadfa2elump (4tetnmr iotlatraiei;(0trtr(o3oo1apee fvias a2rm(m oo4tleomf3iasls ul(ms;(4arxoxo ia1lpDraivol(0teur(o3io1aptelfvsatfaDtmum nu4aptn feilt mDel(ms;u4aleoxf oy1fmD lu sls0texmxmpoy1ame  ivslt)srtau  oo0ale  f3ildfm ulnvp t4texrxocta1oa e nvi;s  rtmxo3oy1lpe mnvsltfsrtm(rpnt1ape ifciydlaDeluvp u0tltnxr to1fpteauvol(0sexm(opiydaptelfetat  2ra(mpnu4tpeo fcils aDel( s;t0arxrifciotop r i o ( t2xmxrpiy4lle mfciat)srrru pnu4oetomi3iat a uln s (0teenmfctatlp elueils0s2urio no1om  lnci (f 2umurpot4tpxnmi3iadla uluvon(4artoio iydop rai olt)sexrio3ny4lme  fvs () Durxro;t1altomo3ilt mDum( on(4teeriocoo1fmD  ivi;s0srtoir3nudope lnvils)sruru  ;t4tpeniietld s ranvpn() renir3totlp rlieol(0srur(o3ou4alte fvs ( srtm(mpou1tee ioetys a2ul(mp;u0 ltnmrctotlaD lueo s setoimpnodlptnmnvi tf rtr(roou4alenio3tat mDea(ms;(4areoif3oatlmtelneolt0teuoir3ny1amee ncils  2rau o;o4aexnmietls sDemn p u0 ltoxrctydomDelieolt)sruo(o3no4omtelietas)s2taxmp;o4oexoii3tasfa2ua(vp;(0tltnmf3iydlatrlies s0t2uo(r io1lpt mneiltfaDtrxrpnt1tle mf3tasfsDrl(mpn(0 ltrxf3oytfpDrai i ( t2xrir no1olenlnct () rrruro;t0oet mietadfs2emnmpnt4aeenmr3totlateaies;()truoirpiy4apee fcslt s2ra( pnt4texo i3tld m um(vs;(0 lenif oo1fa e ies;() rto(mpno4op n icsltf rum( p;t4tex ifciydlm2rau pnt0aetnxr3tytfa r i ilt0s2umir3oo1opte fvtatfs2um(mpnt0teeoiictat m emuvont4altnir3iadfpDranvi (0s2xmio3iy4lm e fet sfsruru ono1aptniieiydls umump;u0trerio todfa elivi t  rtoxr3oy1lptnlietas)arrm(mpot0tptniieiys m umu p t4alxoxo tytlaD livs;(  2tmirpnudom n nct t)s2tm(r ;u1apt  o3iydfm2rmnvonu0 etnxr3todlaDeauvi;t)s2xrxr3iy1amen fvil()aDtr( poo4tpe iietldfa2em(ms u0 ltrir3iadlm  anei s  eurxm3no4apeelfcil( a2raum ot0olx iociytla2rlnmonu4trxomfcoodfaDr u i s0s2trimpio4amtnmivta(fsrtmxm oo0optn i3tyt sDuan s (0altrxo oa1fmDrln s s  rxmxr3nu1al nmivta(f rrruro;o4aexn f3iytla2elu p (0 rxnifciotlaDr n ils  rtmirpiu4ape mfvsl()a2rrxmp;o4olt mi3iad a2um( pnt4alxrmrcty1oa eaivols s2uoio iydapte fvtl(  Draum ;u4aexomfetyt a ea(vp t) rtomo totfat aivolt0 rxr(r3ou4altelnci sfaDrm(rooo0oeen ietltfm2ul( p (0tlxrirctodoaDrlies s)trxrxm3oo4apt lies s)srrau  oo4aee miciysla eanvsn() exnmr3tytfp eai s;()t2umxopio1optemfvta(  Dtmumpnu1teeoifeiytfsDuanvsn()artoircoa1omt lneo s  eur(opny4llt  fctasfsDrmxrpot1tee ioctlsfm um( onu) eerio iodoaD auei s0 2to(r oudam elfci (fs2taxrooo4tptoio3tydfsDranmp (0aeerircoo1lmte n s t)srxmxm oy1ol elnci t  Dta(mpnt0aex mfeiytls emumo u)trerxfciadfateauvo;t  2xriopoodal elnei sf 2rax ont0olt if3iaslm2rmnms ()tlxnmrcto1om rlivol(  rum(mpiudolte ivta( srrmxr ;u1olt ifciadfmDeauvp;t0aeeniocoy1oa eln i;() rumirpiydaleelicslsfa2ur(rpou0texnmieild aDrl(monu)altoio3oadop  livs;()trtoir3iydomenlnvtl() Dtmu p;u0ope  fciltlmDean sn()texomf3io1laDr uvslt)trxrio oo4op n ieslt)aDururoou0aptnmfciltlsDelu p (0tlxnxr3oydfa elivil(  2trio ou4opeelncs (faDuru pno4opx  i3iasls2ulnvs t4trxrmfcia1opte n s;(0 2tr(r3ou4openmnvs (fsrta( ooo1oee iociatfs rlu on(4trxomf3tytfpDeluvs;s0seur(m iudapeelnei t)aDurxmo;o4tee mi3iysls2ua( p (4altnirciadlmt  u sls0s2ur(m iudame lfct () rtr(mo;t1tltomfciadls ul(mp;(0tetoxf3ootom rlneo t)setm(o3iu1lm elivsat) 2umuront1olxo o3tad m uau s;(4tleoir iatlp r iesls0texrxopoodlp emfctltf Dumu p;u0tlenmfciyd mDel( o u0 rtrxrcty1fmtelies s  2ur(r ou1lmenmncilsf rumurpoo0tpenmfctat a2ean pnu)arxnxr3todomDe u s t0teumio3nydomenlietlsfa2trxmpno4texomiciasfm em( snu)aexrircootomDeluvi (  rurxopno1alte nvta()arrrx ont1oexn oeildfsDum(mo u) rtoiociydomDeaneol()texr(mpiy4al  mfvt t)aDtr(ront4oex mictadlmDrm( snu0tetnxr ootopDr ueilt texrxo3oo1ame livslsf 2rmxm oo1opxniocilt m el(vp u0 exrxf oy1lm r ies;()srtr(o oudll elnes sf Drrxrooo0alxoiieiatlaDuauvo (0 rxrxr3iodoaD  uvi;s)s2to(opiu1lmtemivtas)aDtaxr ou1tpe if3iatfmDuan sn()trxoxr oytfaDelues t seuoir3oydaltnmiciat  2ua(mpoo4tetnmfciad aDeauvpnu4alenircia1omD  nvolt  rto(rpoodop elics t)sDrm(r nu1alt io3tyslmDul(vs;t0 etoxocta1fmDe ieils0sexoim3iu1omt mivils) Dtrum ;t1opxomi3ild m em(mp u0alxomr3todomt aieo;s0seumir3nu1olen fcils a2ua(mooo0olxnmieiysls eau o u0tlermrcta1fmteau o;(  ruoxopiodlltnlnci tf Drax ont4aee  i3tydls eau o;t0tetnxrciydla   nes;t  rtmxr3nydapte ivsasfsDtrur no1tex if3ildfsDeauvonu4artrxf oy1lm ean sls trtr(opio4omtnmfct s srum( p;u1opxomf3ilsla2eau p u4aetomo oa1lpDeluei;t)t2toxmpio1oleelfvtas)srrr( pnt0tetnio3iadlaDrmuvs u)aetoiocoydfaDrai i ( t2umxm3nu1ll n fvsa(fa2rmumonu0aetomiciad m2ra(mo;t) ltoio oy1fateln o;s  rur(mpno1lm nmfetl(  Drmxmpno1tlxomfetatlaDrmn o (0 rxrxrcoy1lp elu i;s)srum(r3io1om nmfetl(fa2tmu p;t4apeoifeiasla ean p u0arenxr oytlpte uvsls)t2toim ou1lltelicsls  rtr(roou0tpt ifcildla2emuvo;u)artoif oatomDeaueslt0 2xrim iy4lp emnei t  Dum(rpnt0aptn i3tlsfmDrmu on(4trxrir totoateai i;t0 euoxr3io4lltemfcs s s2uaxmono0ale  o3iadfaDel( ont)trxoir tatfa ean sls0 2urxr iodaptnlfvsls sDum(ronu4aexomfetlsls2ean pnu4trerio oadoptr u i s0s2tr(opio1am n ivtat) rumu o;o1oexomf3iysls el(mpnu4tetoxfcoytfpte ies;s0srxmio iydlm nlfesl()a2rmx onu0tltoiocildfmDuluvon(4arxnxfciy1latr uvi;() etmimpoo1lmtn ict t a2ua(mpnu4tptnmoctltlmDrlnmo;()aexnxrciytfpD  ieolt)teto(mpoo4lm elfcilt)sDumu ooo1ole  feiltla rmumsn(4 ltomo3iy1opDeluvo ( t2ur(rpio1al  mfvi tfs2tmx  no4ape mietaslmDrauvp (0aetrmo3tatfp r n i;t)srxmxo iy4ope  ictltfa2ra(mooo1opt mociysls2ra(vsnu)aexnxrcty1lmte nei (0trum(o3iy4olte nvt tfsrrrxrpot4olx  feiyslaDea(vp;t)aetrmf3iy1fpD  uei ()trxrimpoo4oltelnvt sf 2trxronu1tpxnmfctlsfsDrlu p;u4 exrifciadfp elnes;()srtoxo iu1apeemfvtas)srumxmont4olen iciadla elu o;u0tlenxfcoo1fpteli sl() eumir iudlpt mfcia( a2tmurp;t1optoif3tlslaDranvp u0trtoxo iytlp  aieo;s s2um(o3nydlpt  nvsls)srur(r ;t4tetnmi3ias a eaump ()trtrioctytfpD li sls0 eumiopnu4optnmnetlt) Dum( pou1opt  feiyt s rm(vp (0alxomo3ty1fpDeaueils)trtoxrpiy1lptelictas)aDururpot0apeoiictyd m2el(vo;(0trtnio3iytop raivi s)t2ur(rpnudale miesasfaDrrxmpnu0tlt iieiytlm2elnvsn(4aetnxrcoodoa ranvs;t)teuo(m3oy4opt mfei t)s2ta(rp;u0aeenii3iysfa2rmu on(0 exrif iatfmD aneo t0t2uoxrpiodame lnvs tfaDrmx p;t4oleomf3iasfa2rmu sn() lxnmo iatfp r ivs;s0s2xoxopny1lpt  ncsl() Dtrum ot1aeeoif3iasfs ua(vpn(0 rxrmrciatfptrauei t texoim3iu1omtelfeias)a2rrxrpoo1alen o3tlsfs eau p u) ltnxfciydlmtelneo (0 rtm(m oy1am e fctlt) Dua(m ;u0alxo feild aDumn s;t) exnxf3iy1fpDran s () exrxo3no4al e nvt ( s2urxm oo4optnif3iydlm2rl(mon(0altrxrcty1opDrluvsls) eurxm3iu1oltemfcsa()sDrmuront0tpt io3iatlaDulnmo;(0trxnxr3tadfaDrlieil() 2xoirpou4lp e fvi sfarum(mono4oltnmf3iadlm ea(monu0 lenmfciadfaDelnvil( srurxo nu1lmte fes sf Dtr(r nt4tpeo fciyt s um( on() etomrcootlate neo (0s2to(r3oo4lp emncta() 2taum ;t1aet mfeiysfs2el(ms u) eerio iadoaDr i o ()t2xr(m io4op e nvsas a2uaum ;t0oexnioeild s uanms ()tltoif3iadfa rauvi;()t2uoxmpnodlp elnes (faDurumpno0oltn o3ils a2rmu pn(0tlxrxr3iatlaD livsls0 exo(m3iy4oleemfet (f Drau pno1alenmietlslmDea(vonu)arerirctytlaD an ol(  rtr(rpno4lltnmivsl(f rtmumpnu1tpe mfciytlaDul(vs t) etoxo iotlateliei;()srxoxr3io1olte ncslsfsrrrx ono4tltoio3iadlsDrau o u)arxoif3ia1faDraues ()t2tr(opnodoltn fct s a2umu  ;u0opt iociytla el(vs;t4aetoifcoadlptrlieslt0 rxmim iudapt mfetlsfa2rrurooo4aeeoio3tytfs rlnms (4arxnxr iodfmtrlivo;(  etrxo iodllen net t a2tr(m ;u1aex  iciasfa em(msnu) rxoircoatfaDelnvol(0s2xmim no4oltn feiasfarrax  ot4tex mociatla2eau pnt)teeoxf oytfmte nvi ()s2umxmpiudlmenmnvtl(f rrax onu1tpeoif3iltls2emnmp (4aexnxfciytlp  anvo;()trum(r iu1oleelfetl()s2trxmooo0oexo fetytfm uluvs;(0artomfciatlpDe u ils s2xmxopnudomt lfei tfaruau pot1teeoiietatlsDel( on() rtrxr3oy1fpt anvols t2xrxo io4ap nlicsl() rurur ot0tpx ii3tldlaDuauvpnt4alenmf tydlpte n sl(0trtriopoodlp e fvsl( sDrru poo4apeomfeiytla uauvon() eeoir oatla   u ol(  2xrxopnydal nlivtls) Dumxroot4tpeomoeildfs rmuvo (4alxrir3oa1lpte n slt0 etrim oy1olt  ncs () 2rr(mpno0aeeo iciyd sDra(vp t)trenxoctadfptran i s0trurio nodllee fct s a2rm(moot0tptomf3iltfaDemuvp;u) exrif3oatfp   ues;( s2ur(rpny4al elfvtl(fs2ra(r nt1aet mociadfsDulu snu0tltrmo3todfpDeluvsl()teurirpny1apen ieta()s2rmurpot1aetomi3tas s2rl(vsnt)tlxnifcto1faD lu s;t)s2umxo3iu4omtnmictlt srumum nu1tleo ieiydfaDrmnvp t)alerxo3ia1fa eluvi;t) etoio oodam nliet ( s2tmurooo4tptomi3ildfsDea( p ()arxoxr todlpD ln s t) exoxmpno1apenmicsat)srumx  oo0oltoifeiyd m emn p u)tetnir3iotoatranvs t0 etmxr3iy1alt  ivsatf 2ur( pno1tlx mietldfm2ra(mo;u0 reoxo3iatfat  n ilt trurxm nydaptn nciasfa2rmx o;t1tlt moetat s2eln p;t)aleomoctytoaDr nvs s0sexo(m nu1ame mnet tf 2rr(rpou0tlxoifciatfa2rlnvs (4 exnircta1op rai sl( trumxo io4aptnmfetatfaDururoou4tptoio3iltlm emu s t0 eerircia1fm eaieslt)t2tm(r3iu4lpen nvslt) rtm( ono0apt mfcildfaDumnmont0aetnxrctatfm e ivsl()texmxo3ou4ol eliesatf Drm(r ot1oeenifeiyd aDranmonu)tetomfcoy1fp eluvi;s)s2trimpny4ame mfcs t aDurxro;t0optomoeils s emnvo u4 exoif iy1lp r ieilt) rtrxo3no4lmtnlnvtas)s2ua(rp;o1tleoioetlslmDrlums (4 exoio3oo1omDr nesls s2urxo3ny4lpte feil() ruax ooo1oltnmfeiytfm elnvs ()trtrmo3iodfp raivi;(  rxrxm nu1lltnlnvta()sruaumpoo0olxomf3tls a eaums (4alxnmfcoydla rli slt  rtr(r no1ll emfei t a2ururoot4apxo oetad a eaumsnt0teenmf ta1fpteln i;s) ruoim nu1lpenmics sfsDtmxmpnu0tpt  f3iys s emn snt0tltomr3iadlmteai ilt sexoiopiudom elfesl(farta(ronu4tetnmietltlmDuau o;() rxrxf3iydomtelu i s  etrxr ny4lltnmiei ()srurumo;o0opx  o3iydlsDuanmp t0 eermr3todomte ies ( teur(m ny4ol elfei s) Dtmxrpno4aetn f3tadfs2ea(ms;(4alxoxr iatoaD lnvi;(0 2um(o3nu4opte ivt tf 2trx p;t1tlxoioctls m em(vsnu0tetnxrciodfmDe nvo;( tetm(r nudape liesl()sDtauroot0tlx mf3ils s2eluvp;() leoiocoo1laD  nvo t) 2toxm nu1olenmivta(  2ur(moot4aexoii3ilt m em( o;u0 reoxf3iytla rau o s  2xoxo3oo4amt  neias arum(  oo1tleoio3tysls2emn pn()aetrmf3oydlp elneolt) rxmxo3nydam nlfvtas)aDua(  ot1optnif3tyd s2rauvs t0aetrmr iy1oateau o;t)t2tr(r3iodop   fvil( srta(m nt4altomoctys s2emnvp (0alxoifciodlp  an ols0 euoio3nu4omte ivtltfa2rmur oo4tlxoiicilsfmDumump u0alxomr oadfmD  i s;(0s2uoio io4ole micil()srtmxr oo4tet  feiatlm emnvonu0aetoif3iydfm e ivo ( tetr(r nudam   ietl( arua(  ou1oee mfeiys a eauvp;t4aetomrciatlm   uei t0 2tmxr oudlp emnesasfaDra(rp;o4tlxnifeilt aDuau onu) eenmfcoatlmDr neo;s0srumim3ny1llen nei (fsruaurpou4tlxomfeiasfaDra(vo;t4 reoxrcoytlaD livsls sruo(r oudol  lieia( s2raxr nt0tetn f3iadlaDrm( sn(0 lenifctatomDe ueols0s2urir ou4ap nmfei ( srtru pou1oetnif3ildlsDel( s;t0aetnircoadfm eluvi t)trtm(opoodam emfcil( sDrmxrp;o1tlenmo3iydlsDea( snu)alxrif3oa1lm eaueo;t)srtrim oo1amtn neias) 2trum oo1teen iciasfm2rm(vs u4 etomoctytomtelivolt trxoim3nu1lmte nvtl(f rtr(r nt0aex mieils sDra(vsnu) rxrmf iadfm  lnvols) rtmxo3oy4al  liet tfartmxront0oee ii3tls a2ulnvs t0areoif iodlm eaivi (0 exm(rpoy4oltelicilsfaDta(m nu1apeniociydlaDem( p t0 eerir3iatfatrln i s) rurio3no4ll nmneta(  rraur ;u1aetnmf3tys aDem( s t4 rxrmf iodlm  livols seum(o3ny1ll  lncs sf rumu oot4apto icildls rm(vo (0tetrmr ty1optr uvslt s2uoxr3io1apee nci s) Duaumont1altoifcias a emnms;()alxnir3oa1oa raiei t)seuoim3nu1lle  fetls) Dta(mo;o1aet moetld a2ulnms t4tetoxocoa1omtrlnvil(0t2urxo3nydop elfcia( s2umu  ;u4aex ifcild a2rluvo;u4 reoif3oytoptrlivslt seumir3nu4ap  mfvtls) rrrumo;t1aptniocilsls2eauvsn(4aetrif3oy1fp  lu i;( trxr(o3iodolt mivtl(  2raurpnt4tpxo i3tat m2ua( p u)trerif tydfa elues s)t2trio3oy1op emfcil()aDrmxmo;o0oeenii3iltlm2umu s t4teermrcoytlp eanei t) exm(r3oo1omtn fvta() rumxr ;u1apx  f3iatfa ulnmo u0altrxr ty1laDr nes t0teumio3nudop   fcsatfsrraur ;o1teeo i3iltls rmuvp;(0aeerir to1fp eanvi;()trum(mpoo1ap elfci tf 2rr(r ot0tlxn o3iysfs2ea(vonu0 ltnifcoatopt ai o s0t2to(mpnudol  lfctlsf Dumx pnt0oleomfcils s rm(vsnt4treoxf3iydomteanvs;s)seurimpio4lme lnvi tfsrumxmpnu1oeenioetyt mDeau pn()tetrmf3oa1lmDrauvolt)setrxopiy1opt lfetltf Dtau p;t1ope  ociydlmDea(vo;t0trxoxo3oodfm  aivi t sexm(rpiodoptn ivias a2tm( p;o4oeeomf3ilsfs2umnmsn() rerxo oytlm e neo t  2xo(r iudlpe lies tf rra(mont1tpt moetys a ea(vp u) rtnmr iadopD lieo;t t2umir io1ame  fvslt)arua(mo;u0ape miciydfm2rmnvsnu0tltrxo oadoat lneolt)sexoio3nudoptnlfeia(  Dur(rpou1aeenmictltlsDelu p;(4aleoir ia1oatr ivo t0t2tmio ny1al emieilt)sDrmxmpou1opx  o3tasfm umnvont4 ltnmr ta1lp rlueslt0trxo(r iodol   fvtltf Drrur ;u1olt  fctls m emnmo t4 eenmf iodlmD  u i;( trumxr3oo1lpe liet s a2ur(r no0oee iieilsfm2emu s (0 exoio iydlmtrluvo;s s2trio iudlpee feiltf 2rr(r ;o0olt  ietltla ul( o;(0tetoioctydom   uesl( srtr(mpnodoltnmfvi ( srumx  no0aeen feias sDulnvpnt)texnmf iotom   uvo (0 etm(m3iodole lneia(farurxmono4tee mictasfa eluvpnu4aeeoxrctodomDraies t0 exrxr nu4olt  fviat s2uaxmono4apxnif3tadfm ua(mo u)aexrircoy1lmteli sls s2xo(o oudapenlncslt sDrmu o;o0tpe mietasfa2rau sn(4 rxoif tatfaD anvs ()srxr(o3io1amtemict (  Dta(mpot4ape  f3tys mDrln s;u0tetnxrctatfmt auvo t) eur(mpoo4lpee ici t)aDumumpnt0oeto o3iatfsDumuvo;u4aleomfciodom e ueil(  rxrxo io4aptemivi s)a2rr(m no4ope ii3ilt sDuau p u0arxrxo3oatfa r ivil( t2to(m ny1al emnes ( srrr( onu0tpto f3ias s2rlnvs;t0artnxo tatoaDrlues;t0trtm(opou4lm  liesasfarrr(rp;u1teenmo3iyt mDuan pnu0arxoxo oydopt li ols0sexoimpoo1omtn fcta(fa2raxrpnu0tle if3tys aDra( s t)aexrio ty1lm  aies t s2to(rpnodop  mivias a2taurpoo4oetn iciltls ulu snt4 lxnxoctatopt an o s  2umirpnu1lpt mivsl() 2uaur ot1olxn fctldfm2ua( s t4texrifctydopD  uvil()s2xoxr3ou4om nlfcia( aDuax p;o4aee  f3tys a emu snt4 exoiociadfpD  ivs;s)trtoiopiodamen ietas aDurum nt1tlenmociytfa emnvs u0 eenxo to1oaD anvil( s2xmxr iu4apeelneilsfarum(ront0teenmfcilsls2elnmp u0 renxociy1omD au o t0t2um(rpoo1om   fci t s2uau  nt1oeeo o3tadfa umn s;t4tlerircootfptrluvolt srumxmpiydlp   nvil(  2tm( pno4oleomfetlt sDuan p u4tetomr oy1laD lu i t0 rxrxr3ou4ll   ivs sfa2rax  oo4tpxnifeiyslm2uau p;t0 lxrxfcio1la ean i;t)sexo(opou1llt lncsl() rum(r ;u0tlt iicild s uanmo ()tlenxr3todla  livsls0s2to(m3ou4ameemfcil( srum(mpoo0alxnii3iytfsDumu p u)trtrxociy1laDrluvslt0tetrir3iu4op nlivsa()arumum ;o4oet  ieiatls2elnvsnu0tetrxfciydopt lnvi;()tetr(o3oo1lp  lies t sDra(monu0tpto feiltfm eaumo u4texomocoadfateanei ()t2xrxm oodope mneiltfsrrrxmono4tpx moctys s2ulums;t4aleoio iotla  li o;(  exoir3io1lpen ivsa(faDtmuro;t1olx ioeiat mDrmnvp;()trenioctytfmDrluvols srxoiopnudaltn fcsa(  Dtrxmo;u4altomociltfm2rm( p;()altrxf3tatla e u s s srxoxr no4op n ieia( artrur nt4olt iociydlaDrmuvo (0 rtnircoodfmteln s s)texr(r ou4olenlfci (farurum no0aex mociat a2rl(msn(0arxrxo tytoptean o;(0srur(o nu4olte nvilsf 2um(m ;u1tltn fciys a2rlu s () lerxr oadfpt li ols  2um(r3oy1amen fcsltf Duax pnu1altoiieiyd m umnms t4arxoxrctytfpte nvolt s2urir oydoltnmnvi ( aDumu  ou0tltn ietltlm rau p;u4trxoxr3iydop e uvo ()s2uoio3iudomt lnvsat aDra(r ot1aeto fctys m2rm(msnt0trtomocia1lp  aivslt)teur(m oo1lmenlfei () rurur ;t0olxo iciysla rln onu0 reomr io1fm elu s s tetmir nodamt  nvia() 2umxrono1teeoiietadfm rlnvo;u0artnxr3tydlaDe n o t) etrir3nu1optnliesasfarta(r ot0tpe io3tltlm rmn pn(4tetnxo3tydlp eaivo;t)trtmim3iu4apt  nct s) 2um(mont0oex iictytfaDem(vs t)trtrxo to1fmtelnesls)tetmirpno4lp nlicsat)s2um(m ;u1tpto ociydls ea(ms t)arerxo oytlmDe u sls)tetoxmpou4am nmfcta(fsDtmu p;u0aeeo feiadfaDrm(vp t0 ltrmf iatlm eln s t  2xoir io4opee fvi s) 2tax o;o4oex  i3tls m eaump;t0arxnmr3oadom  auvs;s) 2xrxr3iydll elietatfaDur(m ;u1opx  fciltlm2ran s;(4aexnmf iydoatranesl(  euoir3ny1omenmncils)aDtm(mp;u4tpeoio3ild m2ran o (0treoio iydlpD  n ils)truo(o3nydaltn ieiltfartmx pou1aet  ociad mDemnvp;t4texomr totfmte ivo;(0 rur(o3iu4omeelfci s)sDua(r nu4tlxniociasfmDeanvon(4tltnmrcootom elu slt  2xm(rpnodopte fvils)srtaum ;o4optnio3tatlm el( p (0treoxr oytoaDrln i;s)t2xm(o nodameemnct (fa2ra(r ;u1opt  ictaslsDranmp (4aeenxr3tytfatean o t0teuoxr3iydopt  fct s  Dua(r ;t0aeeoio3iasfsDemuvo;t)aeeomf tydom  luvslt0s2to(o no1aptnlncs sf 2rrx pnt4alenif3iad aDrm( s t0 leomrcoatlp rlu il( trxmxm3oo1lmte ict s) Durump;o1olx  fctld a2ean s;(0aexoio ty1opte i il(0trtoim nydlle mfvta( srumum ;o0oltomfeiasfa2elnvp t4teerif oodoa e i o;() 2xmir3ou1ap e neslt aDraxmpoo4tle iiciysfs2eaump (0 leoxrcoy1fptrlivols0texrxo oydlleemneiat) Dta(m nt0tlx mfetltfaDeaums;t4arxnmo oo1la  an s ()srum(m3iy4amt mnci s)arum(moou1tleomiciltlsDem( p;(0trxomf tydoat aueo;(0srtrxo3no1aptemfvsatfsDurum ;t0tpt ifcilsfmDem(mo (0aeermf tydfaDraneo t0s2urir3iu1amte ivt t aDra(m ;u1oexomo3iydfsDrlnmo;(0tlxoxo3iodom rlu s;() 2urir3oo1olt  icil()sDrr(m ;t4aleniociyslm rl(vo;t)artrif3iytfp e n s;(0srtoir3no1ol emfvi (  2umx pno4aeeo fciytfaDel(mo (4aetoxf3ta1lm r uvo;s)t2uo(r3io1optnmictat)sDur(rpnt1tptoii3tydlm rln sn() lermo3iotlm elueil(0 rtmim3nodllen icils s2uru  oo1opeo iciltfaDel(mpnt4altoiocio1faD au ol()teto(rpoudamtemietasfs2urumpnu1olenmfeiys s2ra(vsn(4arenir3todlm rln slt  2tmim iy4lptnlfvta(f Dua(rpnt0aleniociad m uanvp t) eermfcoy1op r nvi;s)t2xrxm3nu1amee nvtat arrmum ot0oex  ociyt s ulump t)altoxr3oy1oatelnvi;t)s2xoim3iu4lp nmfvt s s2rau ont4oltoif3tltfs2rlnmp t4treoxocio1lmt  i s;s0 etm(mpiodame mncsltfs2rrxm ou0tleo oeilsfm2uauvp;t)alxnxfcoytoptr nvo;t t2toxo3iu4om  lncslsfsrta( o;o1aexomfcilt m2um(mon(0aleomf totlp e neo t0t2urxopio1ol  miesltfaDtm(  ;o4oltomf3iasfs2ea(msn() eeoxf3tatlpt lu i t) 2tmxmpou4aptn nesa( arurur no0olt miciadlmDuln pnu4texnmf3todoptr ueolt0srum(m3oudal   fvt sf Dtm( ooo0tetn ocild mDra(vsnu4artoio oatlmte neo s) euo(opiodlm nlfes s) 2rru  ;t4oeenifciadla rmnmsn(4arerxf3ty1om  au i ( texrxmpnodope  icsa()arurumpoo0aptomietls sDrmn on(4 ltomf3oa1oaDeli olt0seum(mpnydlm  mfvsa() 2rrurpou4altoiiciltfm2emuvsnu0alerxo3oatfatrlnvs t0srumxm oodomtn netas s2rmuroou0olx  iciysls rm(vo u4tleomoctytfaDeanvo s texr(o ou1om   feia(f 2trum nt0ole ii3iytla umuvpnu)texrxf oytfateln o;s0texmxopny1lle mnvi t) rrrxmo;o1oeeomi3iadla ea( s;u)tlerif io1om r ueils) 2umxr3oo4op e nvtasfsruaurono4tetnmfciyt a eaumpnu4tleoir3iodfmt  uvs t  rxrxr3oudlm e ieslt s2ta( pou0alt moeiad s2rl(mont0artrmocoadomDrln s;(0texo(m iu4ll elnvsat)a2ta(m nu4tex  iciyt aDrln p;t4altomr3iodfa ean ol()sexr(r no1op n ivsas) rtr(mono0tlenmfciys aDemuvp;t) eeoxr3ootoa r ues s)trxrxr3ou1op nlics t  Dum( p;o4tlx mietytfa emnmp u4 etoxf3tatlmDelnes s)t2to(opiydoptnmivs tf 2ua( p;u0tpx iieiaslm2uln onu4tlxnir tadlp r u s () rxm(o io1lle lici sfaDum(mpot4oltnmocildla2uanmsnu4artnmf3iadlm eanes t tetmxopoo4opt mfetat)aDrauro;t1tpeomf3iytfm2rmu o t)artoxr iodlat  ieols s2urxopio1al n fei s)sDtrum ot1opx  fcias s2rmn snt0 exniocto1fmD an s;s0 2toxrpnodalte netatfsrrm(m ot4opto f3iyslm2rlu p;(0altnxfcoytfptrlnei () rxm(m3iudomenlfcias)srurxmooo1teeo oeilsla2emnvon(4trxomo oodlpD aivols  2tm(o io4op  mietasf Dumu ont1olxo f3tasla um(ms t)texoir3ta1fp   i o;t0teuoim ny1al  mieiat)s2rrx oou4aetniietyt mDrmnmo u0 etrircty1fa elueslt)sexr(rpiu1al nlfcias)sDua(ro;t1aexo iciytla ea( p t) lerifcoodfpt anvo;s s2ur(o3iy4ol nlncs sfa2ururonu0optniieiasfmDrm(vs u0arxnxf3totfaDeanvo;s)setoxo iodap  mnet s)s2taxmp;o0aetoii3ildfa umumsn()arxrxo3to1oa rauvolt0 2xmiopnudomenliciat arrr(roou0tltnmoctyd sDemuvp t)aetrif3iytomt livols t2um(m nu4apee fesas)sDtru  no4tpx  i3iltfsDeaumo;t)trxnxf oytlmte n sls0 rxmxopnodaptnlfes ( s2um( p;t1apt ioctaslaDelu p () exnir oodlmDeluvo s0teuriopoo4ap n ivi ( sDrax ono4apxomociatfm emnvs;(0 ltriocto1om ran i;s0texoxr oo1ape  fvslsfarumump;t0texomoeias a2rm(vsnt)aeermr tytoaDraivilt  2umxm nu1op emnvtl(f Drr(mont1open o3iydfm2ua(vs;u0texrio3oo1lptr neo t)sexr(o3no4amte fctl() Dtaum nt0ole mociad a2umu s ()aetrmo3tydfa r uvsl()tetr(m3nodlpee nei (fa2tm(r nu0opx  ociytlmDeauvo;(4altnmr3iadoaDe n o;t  eumxopiu4oleelncslt) Dtr(  ;t4tpto o3iyd a el( pnt)tlerxfcoa1fpteluvsls  euoiopoodaptnlfesas s2uaurpno1alxn oetasfs2umnvp (0 exnmr3tydfaDelu i;t0 2xoiopoo4omtn ivs s)aDua(rooo4tleomf3iyd s uluvs;u0 rxoxf ia1oat lieolt  rtr(mpio4olt  nvi t) Dur(mp;o1tpx mi3tyslm eauvo u)trxoifciy1opteau slt0 2trxo3ny1lm   ivsls) Dtmur ou4aexn octlsfa2rl(vo u)aetrir iy1optrau i;(  2xr(mpiy1llte fesa( sDtaxr ;t0tleo f3taslsDrlumon(0 exomrctytfaDe i s s t2xoxo3oo4lp nmnct t  2trurp;u4alen o3iydlmDuauvo t0 etnxo3to1faDeaueilt0texrxo3nu4lpt  fcs s srraur oo1oeen ieilsfaDrluvs;(0trxnxrciytoat livi;s0sruoir3nu4opte fctl(farumurpot0teenmoeiatlaDrm( o;t4tetrxrciodoatr uvi t) eto(r iu1op nmfesa(faDrauro;t4olx iieiasfs2ra( p;()alxnxr3oadoa  livol()seur(opoo4ame  fcsa(fsDtmu p;o4aexo f3ild s2uluvsnt4aeenmo totfmDeli s;()srtmim no1amtnmneilt) rum(r nu0optnmictadlmDean pnu) leomfcoydopDelu s ( t2trim3no4llt  net (f 2um(rpoo1tltnifciltlm2elnvon(0 lxrio iotoptelu o s tetoiopou1alenmnvi t  2tmumooo1alto oetytfm2umuvp;u4 exnmociy1fmDr neo;(0s2ur(o3nu1am n ivtas arum(mpou4oltomieiys a2el(ms (4artnmfctatfmt anvilt0t2uoxm oo4oleemfci tfsDta( poo1tpt  ietltfaDea(vs u4aeerir3oy1omDe u s (0texm(o3nudal n fes ()a2ra( pnu0oet iociysfs2rauvp u0 rtniocty1oatrlnvo;() 2xmxm ou1lltelfvt sfa2ta( ooo0apeoiieiytfa ulnvp t) eeomo3todfp eaies;(0trxoio ny1omtn iviatfs2uaumo;t4tlto ociadla ulu on(4aeerxfcoatlpt luvo;t srtrxm oo1aptelnes sfarua(mont1ale iietatlaDrmnms;() exrxocoatfa r uvo ( sexo(r oudopt mfcil() 2tr( o;o4aptnmfciydfa2umuvp u0 etrmociotlmDelieo;t0 eumir3nudomee nviasfs2uaxr ot4aeeoifetls m2ra( o t)arxoif tydoaDr u ilt tetmimpny1oltnmnvi t)srumump;u0olxn o3iyt sDrluvp;t) lxrirciydlm e uvo;t0 rxrio3oy4aptelfvi t srta(ro;t4optomo3ils s2rauvsnt) leomo todoaDr n sl(0 2xm(m io1lmeemfvtlsf rtm(  nu4teeoioeiasfmDuluvsn(0 leoiociytomDrlnei t) rur(r3io1omenmfeiasfsDtau p;t1ope  octat m rmu pnt0tltnir3tytfaD  n ilt0 etrir nodale  ncs t)artmxrono4aexo octyd s2emnvp;(0tlxrxoctatlatr neo;t0trumiopiy1al  lieta(faDrrum nu0tetnmo3iydfmDemumpnt) rtnmo3oadomDe i ilt)t2xoxm3iy1openmfvsls a2rru ont0aleoioeiytlsDrlnmp t0 lxrmocoo1lmteli ils)sexm(mpno1aptnlfcil(  rumur ot1optnmfeildfmDum( s;()aetoxo oodfaD luvil() etmxr ny1am nmfvils)sDuaurpou1altoifctltla ra(vs ()trxrio ia1latrauvol(0trtmxm oy1apenmneils) Drax ono1apx ifeilsls2rmnmo t4tleomo tatopDelneil(  eumio3oy4lm elfvtl(f Drrum ;u4alx  iciyd s ra( snt)arxnmr3oytfptr i i;s0sruoxmpio1aptn ivias s2raur ou0alxn ictltfs2ul(vo;()alerxoctytlaDrlieo t trto(m iu1amtelncta(  Drmxroot4tptnii3iasfa2umnvsnu4artnxo oodoa  aueolt)t2tmir iudale lfvsl(fs2ra(r ou1oexomf3tatlm ea( snu0 etoxociydfatean i;s  rumim3iu4amee iet sfsrtmxr ;o4tetnmo3tadls eluvp u4 ltnif iydfmDran o;s0t2xmimpoudaptnlfvia()srraxroot4tlxomf3ias m2uanvo;()trtrxf oo1laDe iesls srxr(opiodal e fvs t a2tmxr ;o1alxoiociytfaDra(vp;(4arxnxf3ootlpD ai s;s trtoio iudllt  fvs ()aDtrxmp;t0tltniictydfs el( p u) leomr oadfmDe uvi;()srtmxm iu1alt lfcta() Duru pou0olt mfciyd a emums t0 reoif3iadopD ai i ()setrim oy1omtnmnesa( sruax  ;t1alt  fciytfm raumo t) etrio3todopteanei () rtmxr3iy1lp nlfci t)aDtru  no1alenmf3iad a rmnmpnu)trtomr3todlmD  u s t t2xm(m iy4omt  fei ()sDtrumoou0olxn fciydlm ulums;t4aeerxr ia1op  li ilt teurirpno4ame licil( a2rm(mp;u4ape  feiyd mDea(vpn(0tetrmoctydfmt luvs s0sexrxr3oo1llenliei t artr(m ;u1aetn i3iasla2uanvp t)teerxf3to1lat lu i s s2tm(m nu4lp nmfvsl(f rumxm ;u4olx  iciydfmDum(vpn(0alxrio3iytomDeln o;(  rxoir ou1olte ieilt)aDumx  nu0oex if3ildls ea(mo;t4teenxo3todopDelivs ()seumim io4om  mietatfartmurpou4aet miciyd m rlu o;u4 rxnio iy1la  li i;s srumio iy4llte nctltfaDrm(r ou1tpx mi3iys a ulumonu)tleomf oo1laDeln s;()trxo(o3oudope lneia( a2um(m no4apx  fctltlsDra( o;u4 eenmr3iy1lp  lu o;s)srxriopno1lmenlivsls)s2ra(rpnt0aeeo o3iytlsDra( snt4aetomo iytlaDrlies;t)teto(r3oo4optelnvt s)a2umum nt1apxomociytlmDua(mp;u) eerircootop   n o (0 rurio3ou1olt  nes s  rraxrpno0tpxnmfcils s eau ont4altomfcty1fp   i o t) 2uoimpoydlp elfvtat  Drrurp;o0opeomo3tydlm2rl( o u4 leoxf3iodopDeau s t)t2xmiopio1alt lnvil(  Dua( pot1tlenmo3tad sDrmnmp;() ltniocootlpDeaieilt0 rtoxmpoo4opeelfes t  rtmumoot0olt mfetydfm2emnmon()aleoio3totfm  lnvo t  2uoxr3nu4omtn nei tfsrtr( o;o1alx mo3tlt s eluvonu4 eenmfciatfpteaivs;(0srumir oodopt  nvt ( aDumxrpnu1tlxnmo3iytlaDrlnvpnu)areoxr3io1om elnvilt0 rtmim3nu4apen ivtat aDrmuro;t0apen i3tatfa2ran o u4arxnif3iy1laD ln i;s0 rtmir3oodape lfci (fsDtrx ono0oeeoio3tas sDua( pnt4texnmo oy1fa r uvi s)trum(m iudomtelnesa(  Duax  nt1teeomf3ils aDua(vs;u)aeeoifciytopte uvo t) etr(r3oo1ameelietat) 2trxro;o1tpeoiiciad mDemnvs;(0artnxfcto1fmt ln slt t2xrxr oo4al eliesas)a2rr(rpoo1aeen ieiatlsDra( s;t4 lxoxo iytfpDe n o;(0sexrxrpiydomt lnvs ( arrr(  no4tlxnmiciydfs2uln p;t4artrio3to1fa   u ilt)t2trxrpnodll  mfesa( a2tmxmpou1alxn i3iydfa2eaump;t)tlxrio3ia1lm  aueols0truoir oodalee iei () 2rru  nt0optniictasfaDrl( pnu) lenmociodomtrln s (0t2to(m3iudope  ncias)s2tmu p;t0oetnmictldfsDem( on(0tetomociy1lmD ln il( trur(m iu1lp n icsl( sDra(moot1ole  oetytlmDel(vp;(0 lxomo oatfm eli s s)sexr(rpnu4ap   iei s a2rr(roou4apxnmietasfaDrmn pn(0teermf3iadopt  i i;t  2xmxopno4lme mictatf rta(m no4oltn oetldfs2ul(vs ()trtomf oadfmD lueils)sexoim oo1oltnlivi tf rua(r oo4oltnifeiyt m2ul(msnt4aleoif ta1lpDr ieo s0s2xoxopoo4altnmnciasfsDtr(r ;o0oee  o3iaslm2em(vp u0trtoxr oatfatran o s trur(mpiydoltelfcsls)arrau  oo4aee mietysfmDua( s t0 lxoxf3oy1fpteauesls trxrxm nu4oleemieil()aDumxrono1aetnioctad m2ra(mo t)aexrmf3ta1lat aneil() rxmio3nudlmen nvi t)sDtaxrp;o1alx iietysls2ra( pn(4tleoxo oo1fa ran i;(0t2urirpiy4omtn netls sruaxmpnu1oltomoeias aDranmonu0tlxomf oa1lm   u s t t2to(opnu1ome liet t)aDum( oot1oltomoeiytfa umuvon(4aetnmoctatlmDran olt)teumiopou4ol e icil()aDrru pou4tpt moeiaslaDrmu p u4aetnmrcio1lpt anvilt tetoxm iodolen nctatfsruau o;t1aee ii3tydlm em(vs u4artrio ty1oat  u i ( sexm(r3iydalt  ies sfaDrrurp;o0aexoifeiadls uln s;t)trxnxf3oo1fmtr n il(0s2xr(o nu4omen iesltfs2tmurpou4tlxnifciyt s2rlnvpnt) rtrmf3iatfm eln slt)t2tmxm no4lme  nvs () rrm(m oo4tpe  fetltfaDulumon(4artnxo ta1oa rai s ( sexoirpoy1ll e fvtls)arum(  ;o1opxoioctyd s2rln s u0 etnifcoydlpDr u s ()s2uoxr3no1amenmfesl()aDurum ot4teeoiicilsfm2ra(mont4aexoio3oodfa rau i;s seto(rpoodolen nvil(farum( pnu1teeomiciys a emump t) lxrmrctodomt an slt0sexmir3ou1ll emfvsa(  Dumump;u1oeeo ictasfsDrauvsnu) renxf3todomDraies t  rxmxr3nodalen nci sfa2umxmont0altn feilt m2uln snt)alerxoctatfmt  u s ( s2tmxopoydllee net ( aDurx  ;t1altn f3iyslmDrm(vo;(0alenmr iytlate neslt)teto(o oodale lnctatfs2uaxronu0tlenif3tld mDem(msnt4alxnirciotomD lnvils) rxoxm3io1ap e neslt)a2rm(  nt1ape  ociydlaDrmnvsn() ltnir iatlptran i;t0 2xm(r oo1omtemfeil(f rur(rp;o0oetomi3iydlmDea( s (4 rtrxocto1lmDrlueil(  2tm(r3iudopt licil() Dua( o;u4ape  fctydfmDemnvpnt4tetrir3ootoptrauvo;s)texo(rpny1al nmict t)a2umx  ou4aeeomfctytlm2elnmsnu) exnmo3iodla rlnvi;(0s2umxo3ny4opt livi sfs2rrxmo;u4apx  fetadlmDuluvs (4 rtrxo iadlpD ai sl()t2urxm3oydap nmfcsat)s2trumpnt1olxnmocils a2rm( p t0tlxoxf3oodfm r ueilt0trtoim nydal  micil(fsDtmx pnu1optnioetas s2ranmo (4arenmocty1fa  auvsls)texrxmpiy4omtnmiei sfarrrurp;t1aleo o3iatlm2elumon(0 exomrctytoaD an s s) euo(m iy1aptemiesasfsrum(mooo1tee  ociltfm2ul(mo;u0aetrifcootfpteliei t)trum(o3nu1apt  ictltfarumu  ;t0oltomfeildfsDranmo u0 exnmo iodfpteaies t0seuo(mpou4alenlfvs tf Dum(mpnt4tltoio3tadfa eanmp u)alxnxo oydfmt luei ( trur(o3oy4llenmfvia()s2tm( p;t4teenif3tas aDel(vsn(4aetrxf oydomD  i s;s t2uoxrpiydom e nvtas)s2rm(rpnu0teto ictltfsDua(mp;t)altrxo3oodoaDr i s (0texrim iy1ame mfesa(fa2tauro;u0tpenmi3ilsfa2ul(vpnu0trxnmr oatop elu s;( setmxo nudomtn nvsas)sDta(m ot1altniictydls2umums;()arxnmociodop eanei;(  rum(m3iu4am n nvi s  rrau  ;u1ape mieiyt s2ean o;t4 lxrmr3oo1lmtelivils0 exr(o oy1amt  fesas)srrm(  ;o4apt mfciasls uauvonu)trxoirciy1om  anvi;( s2toimpnodope lfvt sf rurxmo;t0openmoctaslmDuluvs;t4alxrmr oatlpt lnvs s) rtoirpiodlp  mfeias)arumxm ;u4ope  ieils a uauvont4trermrctytfpDe n s t) rum(opou1omeelivt ()arra(moot0alt  ieiadfmDumu pnu4 renxf3oatoat li s;()s2umimpiodlmtnlnesasf rrm(  nu4oltnif3iasfs2uluvo (0artnxo iodop elivi t)seum(r iu1llenlnctls  rurxronu4ope iictasfs2rlnmonu0tlxoxo oatlp rluvs;t)srtmiopiydlm elivt sf 2rmumo;o0teenmfeiys s emuvsnt4texnmo oydoptraiei;t0 etr(opoo1lmtnmfcil() rtr(rono4oleo octltlaDel(vo u0aexomfcoatoaD livslt) exr(rpiy1apeemivias)aDtaurp;t1tee mi3iytlmDumnvonu4tlermf3tydlpt  ivi (0sruoxm3iy4omt lfvs s) 2urumpnt0ope  i3tysfmDuanvo u)tetrmr iatfmDr nvsl(0trxoim3oo1lle mietl( srurx pot0oee mocias a2emumo (0aetnmf oodoaD ln i ()trxrio oydale  fcsls)sruax  no4tlx moeild m2umn onu)trxrio3tytlaD lnvi t)texr(rpio4optn fvsltfaDrax poo4tpeoio3iyslsDum(ms;u4altnmf3oa1fp  lues (0srurxr3no1lm   nesat sDumxrpot0tpt mieilsfm2uanvs u)aexrxr to1fa raues s0s2xoxo oo4aleelivtlt) Drmx o;u4tpenioctat aDumnvpnt)texrio iodoate i s;s)t2xoim3iy1om emfvtatfaDuaxrp;o4apt mieiys sDuanvonu4alermoctatop   nvs t0 2xoxm3oydllenmfesas  rtrxmp;o1aexoio3iytfs2rlu p u0 reoifcty1lmDe uvi;t0 eur(o ny4olt lfvtatf 2taumoot4tle if3tldfmDeanmo u) eerifciytomt li slt  2toir3oy1al e fvt t  2tau pot4tle  octydlmDumu p ()trenirciotopt au i;s0s2xo(r3iodaptn fci (f rurxmooo1aleo fciyd s rmnvsn(0alxoifciadopte ivo;s0tetmirpoodalt lncsas)aDum( ono0olenioeiysfs uan s;()trxoifcoytfpD lnei (0tetrim3no1aptn nvilsf rrm(  ;u0olxn ictytfs eanvp t0trxnir3totop   i i s  rtr(opoo1lp nmiet ()aDurxrpoo4olto iciltla2elu o;u0tetoif3oatom  li ol( t2uo(r ny4opt  ncilt)artruroot4oltnii3tas sDrlnmsn(4 leoir3iytoa r neo s t2umxo oy1apenmnvsltfaDumx oou0aetnmf3tadlsDra( p (0 reoio tatfptrlies t0 2xo(o oudom  lfeilt) rraumono1tptn ictytfmDrmu pnt4artniocta1fmt lu s;(  eumxr nodameemnctasfa2umu pno1olenifciad a2ul(von()areoifcoatlatelies;t0s2trxrpiydoltn fvi s) Draxm ;u4aeenmo3ild m rlnmp u0arxomf3iatfm  anvol( s2trirpou1ll   fci tf 2ra(  ot0olenmo3iatlaDrmn o;u)trtrxocoa1fmD lu o;s0srxm(opoodlleelict ()srraur ou1oexo icilsfs uanvs;() eenmfcoatfmD li i s)trum(m iu1lp   fei ( s2umurpnt1apxnmi3tldfmDuaums ()texrif3iadfatr uvi;s t2xmxopou1aptnlnvt tf rraum ot0tptomictasls emn s;t)aexnmf todomt  i o;t0sexm(r3nudamt mnvia()srrm(mpnu1tpx  iciaslmDrm(vp t)teerxo ty1optelueil( s2xmxm oo1lmee ieiat sDurx  oo1ale  f3tytfaDul(ms;u0teerircootla e nvs (  2umio3nodlp nlnvs (  2raxmo;t4aptnifeiltfmDuauvp;t0 etrio tatfpDelneo;( srxmim3oo4omtemfvsasfa2umx  ot0oeeo octydls2emuvp;(0 exoioctotomt lu i;s0t2xrxm oo1ap  liviat)s2tau  nu4tpx ii3tltlmDumu pnt)trxnir ta1optrlnvi (0s2urirpou1apt  ietl( sDum(mo;t4altn o3iysfmDua(mon()arenmocty1laD  nvil(0seum(r oy4lp n fciat  rua(rp;o1tlxoio3tlsls rm( p u0arxoxr io1lat lneo;t)t2tm(o iu1am elivta(fsrtm(m nu4tpeo feiasla2elnvpnu4 eeomf3oydfpt lueilt tetm(r3nu4lpee fctat)s2urx o;t4ale iiciysfm ua( snt)artriocto1laDraueolt s2urio3iy4omenlivils arrmu pnt4opt mieils aDel(vp ()tltoir3oa1omDrlnvi s) 2xrxo3oodame mfvi () rurx o;o0olt ifctydfa umuvon(4 eeoxr totlp eaueil(0trtoio3iy4ap   ivt t srtm(mp;t4apx  f3iad mDumnms t4aetoio3ootlateaivol(0truoio ny1op elicslt  Dta(  nt4apx mo3iytfa2rl(monu0alxnmfciodlate ivolt0srxrxr3ny4olen fctlsf rraxmo;o4olt mfciydlsDea(vont0arenir3totopt livi;t)t2urxm3nudomtnliei sfa2uaxmpot0ape iicilsla ea( snu) rtoxr3tytlmtrlues t0texoxmpiu4lpt lfesa(  Durx  ;o1tlt  oeiydla ua(mp (0 reoir oatlp r uvs s) 2urxm nydlmtnlnei sfs2tr( oou1openmoeiat s2ua( o u4arerif totlpt lnvo t)srtrir iudomtemfvi t) 2ta( ooo0tlen o3tat a rlnmp t) rtoio ta1oaDran i t tetmiopiodoleemieilsfs2ra(r nt4aexnmi3ilsls2ranvp t)areomoctodlpDr u s;(0s2to(mpiy1lp nmicil()a2taumpnu0aetnmfcilsla eaums;(4 exnifcio1la  auvo;()s2xo(m3iydam eliciltfsDtaxro;u4altnmocilsla emnvp;u4tlerio oatfat lnvo (0 2tmimpoy1lpte nei (  Drau p;u0tetoio3ild sDrluvp;t4trtnxrcty1laDrlieo t0teuoirpoo4ameelfcsasfaruru o;o1olx ioeilt mDrau pnt0tetrmfciatoaDeaieslt0srxr(opoo1am nmnct (faDraxro;t0oet if3tydfa2ulnvsnu4 rxrxr3iadfpD lu s t0 eto(m oudopenmfcsas) ruaxrp;t0tex mieild m2rmums;t) lxoxrciydfat  ueo t srum(m oy1al  lfctls sDrmx pno0alxoii3iasla rmump;u4aetnirciydlpte uvo (0 rxo(mpiy1ole mict ( aDtmx  ;t4optn o3iytlaDulu p u4trxniocoatoaD anvil( sexmiopiy1llenmfct ()artmumpno1apxo o3iasfm2ea(mo ()texoirctydfaDr n o;s trxmim3iudap  livt () rta(r ou1tpeo o3tldlm2umuvsnu4trxomo oadfptrluei t  2tmimpoo4al elieiat) Dumx pno1tlxoifetls s2ranvo;t) exrmr tadomtranvils0sexoxmpny4lmt mfctl() Dtrur ou0tpeomieils s2rlumo t0 eerxocty1fa  aivsl( trxm(opoo1apeemnctltf 2tr(m nt0alenmociys m rl( snt) exoif3todfpD lu i;t) 2xrxo3iudopeelfcsa(f 2trxronu4oeeoifetydfa2uau s u) eeomf3oydomtr ieils0setrim3ou4olt mnetl(  2rmur ;u1tex mietatlmDrmnmonu) rtoxo iodoaDelivi t)s2uoim nudop emivilt)aDtaxm nu0tltnmi3ias sDra( o ()texnmocootfat  i o;( texoxrpnodlmt mnci (faDtmxmonu1aex  i3tldlm ranmsnt0 eenmo io1la rauvslt s2tr(m oydaltnmicia(faDrrxmo;t1oexn i3iasfm umuvonu) leoir totfpDeaivi;t s2um(o ou1lmtn nciat)s2trxrpot1ope moctys a el(mp (0arenxr oadfaDr neil( tetm(r3no1optnmivil()aDur(r no1tpe  oetasla2eanvs;u) ltnxfciatlaDr nei;t0texoirpnu4olen netltfaDrmuront1oltnmf3tyt a2umn o;t4arxrif3to1fatrlieols  eto(rpnu1aptn ies t  2rax o;u4oet iietytfmDel( o t4altoxrciytlatr uvi;s0seumim3nu1omt livt tfartrump;t1tpt mfetasfm2rauvs;(0 ltnir3oadom rau s;s  rtmxo3oudamt  nctl( sDrm(ro;u1apx iociltlmDrmnmpnu0trtrmf iodoa ranvs;() eurim iy4omeelnct t) rrmur ;u1texnmoetytlsDran snu4tlxoxfcta1fm r uvi;t setrxo3nydlptemfet s sDtmxr oo0tlt ifeiltfaDrl(msnt4aeeoxf3todfa ranes (0t2umimpno1lm e netatf 2uax ooo1ole  ictatfmDulnmsn(4 ltnmo ty1opt lues;(0 exm(r3nydlpt  fci tfs2umx  ot1alto fctasfsDrmnvp;t4 lxomo ootfp r n ilt t2to(mpiudlltemfetlt  2rrx  ;o4tetnmociadfs umuvpnt4 lermf oatlptrlieo;s)setr(m iudlpeelieta(fsrtrurp;u4opt  oeiasfm2uaumpn(0trxoxr to1fp ran slt setoxo ou4lm emfcilt  Dumx ooo1teeo feilt m eauvp (0arerxo iodfmtelnesl()t2xr(mpoydaptelfvsatfsDtmuro;u0olto o3iydlm2em( pn()aetnmo totfmD  ivols0 2tmxr iu4lleemnci t) Drax pot0oee mi3iadfmDrmn p;t) rtnir totfa rlnes ( sruoirpoo1oleelnvsasf Dtax  oo4open ietyt mDeanvo;()teeoio3oa1om eluvsls0t2tm(o ny1olt  nvtlt)srumu oou4tpx mociltfmDeanvs ()aleoxo oytomt  nes s0t2toir3oo1open netasf Drrum ;o1oetnio3iltfmDeanms (4tleoir tydoatraivo;s0 rtrir nu1lltn fesas) rrax p;u0opeoio3iltfm2emnvs;() rerxo3io1la   i il()tetoir nydlpt mietat srurx o;u1oltniietas mDul(von()arxrxr3oadfp rln s;( s2tmimpoo4llt  neiat)aDum(  ;o0aeen iciyt m2elu s;t0tlenxr iotlat lu olt srtrir3nu4oltelfes (f 2tmu p;o4aetnmoctys a2ranmo;u) etnmf3ta1fpt aueo (0 2xm(r nudlmt micia(fsrrr( pno1tlx mi3taslaDuln pnt) lxriociydomt luvs;t)srxr(opno1om nmivs t a2taum ;u0tlxn ictldla2rauvon()texrxf3to1lmt aivilt)t2umxmpno4olt  nviatfsDtrxrpnt0tpen fcilsfm emnvp u0areoio iodlmteln i () rxm(m3ny1amee icil(  rta( ont0aee ii3tyd m rmu o u)alxnxo to1opt aneol(  exoir io4op e ncsa(f Dta(monu4aet  f3iad sDumnmpnt4 eeoir iydopt  uesl() etrxm nu1ap   fvt t)srtmxm nt4aexnifeiyt s2ranmp u4 lxrmrcoytfm e nvi ( seumimpoo4ll  lnvsls aDtau oou1aetomictltfaDrm(mo;t)texrmo3iatoa  lnvs ( sruo(m ny4omeemnvsls artrxrp;t0texnmoeiat m2rm(monu4 etoif tytlp eanvs;s  2tr(r iydomt lfcs ()sDum(  ou0teen ociyt aDrm( s u4artrxr3ootfate ueol(0truoxrpiy4om e fcs ()s2taxm ou4oeenmoeiysfa2emu sn()tlxnmocio1lpt anvo;t0 rxo(r ou4omeemivtlt)arumxmono0apxnmfeiytlaDul(vs;u)tltomo todomt lneo;s0sruo(mpiodlmt lfeiat sDuax pno0olxomo3iltls2ea(mo t)arxnxr3oadoaDr ivs s  2tr(opny1lp n fvtlsfa2rr(m ;o0tex io3ilsla2ra(vs;u0 rxomr oytoptrln il( srxrir iu1ap   ici ( sDum(m ;t4opx iociys s2el(ms;(0alerif3to1oatrlu i t0srtoirpny4oltelfvtl(  2rmumpou0texniictlt a rl( s t)trtrir iydom e uvil( texmio3oo1ol e ici (f 2raumonu4alxomfeiydlsDulnvp t4arxomocoydopt livil() 2tmio ou4ll e fet ( s2uru  ou1oetnmo3tysla2elumsnu4aetrxf3todfp e nvs;s  rxm(m3oo4omtnmivta(fsrraur no4aeen ociytla2ranvp;u)aexrir3iodfate uvi t0sexrio3oudlltemfesat)artrum nu1tpen ieiys aDulnms (4arxnxo3iydlpDe i ils) exrim iy4olt mivs tfaDrmx oou0ole moeiyslmDulnmp;t4alxomr3oa1opDeau olt  rto(o nydomtelici tfsrtau pot4aptnmiciydfa2uln sn(0alermr oadfpDe i i s trtmir3ou1alenmiciat srtm(r no1optoifciyd sDranmont4tetoir totfpDelueil(0 rxo(mpnodamtnlnetatfarrm(r no4aet  o3iatla2rl(vs t4altnmf3oytfm e nes;t0seurim3oy1ll nlnciasf Dumumo;u4apt  oeiadfs rauvp t4arxomr3oatfm rlnvils texr(opio4ale liei ( aDurx p;u4tltn fetlt m ranvp t0altnxf oy1omtr i i;s sruoxo3iu1olte fvslsfsDtr( o;u4oee  feiaslaDraumpn(0tlxnir oo1op  li i;s) etmimpou1lp n netltf 2tm(mo;u4aleomi3ilslm rm( p;t)aetnio oytfm elu i t) 2uoirpou4olte ncs t srtmxmp;t4tpe mfeildfsDrmu ont0trxoxfcia1fatrauvs t)trto(o oo4aptnmicsls)aDrm( ono4open ieiat m elnmont0alxnmr3oodfaDeli o ()s2xrxopiu4opte nctat arurumonu4tpt  f3iydlm2eaumsnu4 renio oadomDrln i s seto(m iy4lme lfct t s2taxr no1texoifetlsfs2emumsnu0artrio3oo1opDeauvslt0trurim3iu1omtelivia(farurxmooo0tpx  fciyd sDumu o t4tleomr3todfmt  n s;()sexrimpny1aptn feil()sDrmxmo;t1texnmfeiatfs2elnvs;t)tetrmfciydfp raiesls) 2uoxo3ou4llenlfci sf 2tru p;u0ope  oetldlmDeaumo t4 rxnir tadfm rli o;t) 2uriopoudap n icil( srtmxr ou0olen oeiatfaDrlnms;() etnifcta1fa r ivo;t t2um(r3oy4alte nesas sDur(mo;t1apto feiatfs eauvs (0trxnirciy1latelivil( tetoir oy1apt  fvta()aDumu poo4teto fetysfm2emumpnu)tetomocoatfa   uvo;s0 2umim oo4lp   nesatf Drm(rp;t4opt moetasfaDea( o ()tltnxo iadlm e u slt)s2um(opoo4lmtn nvta(f 2rau o;t1ope  o3iatfa rlnvo;t4treoio ootlmtranvsl()srtm(r ny4olte ivs t) Durxrp;t1oetnifeilsls ua(ms (4tlxoxociatlmte ivol(  ruoxopnudameemnesa(faDtru pou4optnmoeiad a2ul( s;t4aeeoif3oytfp  ai ols t2trio3oy1lptnmnvi tf Dum(rpnt0olxomo3ias mDulumpn(0arxrxfcoatomt lieo;(  eurxopiodll emfctltf 2rm(  nu0aeenmfeildlsDumnmpnt)tetrxo iatlmD  ivi t0 eurim ou1ape  fvtlt sDtr(  ;u1tlxnmicild mDeluvp () ltnirctadfat  n ils0srtmxm3io1ap n nvil(fsDtau pnt1aexo f3tas a eln pnu)aetomf oy1omDean o s0t2xm(m3iodap nmiciasfaDtaumpno4apt  f3tatfm2umu p;t) exrmf oodomD livs t0 rtoimpnu4apenlfeiat)artmxmo;o1teeomi3iydfm ra( s;u4 rxnxfcio1fat luei;() rurxmpoy4op e ieslsf rurur ou0tlx  o3iad m2rlnmsnt4 rxnmociatfpD  uvilt)trxmirpnudam  mivs s)a2tmurpou1opx  o3iaslm uln p t)tlermo oa1fa   n o t  rurxmpiudap  lieia(f 2rau  ;u1tptn ietltfa2uluvpnt) exnmfcoa1laDe neolt s2tmio3ny1lp   
\ No newline at end of file
@@ -0,0 +1 @@
+u i;t  2umxopiudllenmiviat artmxrp;o1ole  icils s emums t0 rtrmfcta1fp rln s ( trur(r iu1al n fvil(faDtau p;t0tlxomo3iatls2em(vonu)arxrircio1op r n o;s  rxr(m3iu4oltn ncsl()arrrum ;u4aeeoifeiyt s elu snt0 etomo3oydfmtrlneo;s0 etrxopiy4alte ncilt)sDuaxm oo4tptnmf3iat a2umuvon() leoxr3tydoaD aivolt trxmxmpou1lptemfctls  rrmxrpnu1alxnmo3tyslm2rmu p u4tlenif iotlat  uvil()tetrio3iy4ameemfvia() rum( ont0apx iociatlm2rlumont)texnxf3iytfateli ilt) rtoimpno4op   iet t a2ur(r nt4tle  fetadlm2emnmo;u4 exnmocoa1fpDraueo t  exoxm3io4om nlfctlt aDumxm ;u1tpx iiciatlaDrau o u4altnmr3oatfa r uvil( srxr(r3iy4amtn iet t  rtaxmpou1tptnii3iysfsDean s;u4tltrircoa1fm  auvo s trxr(r oodape mnviatf 2ta( p;o4olx mocilslm2ra( pnu)tltomr3iadlmteauvsls0 etmio3ou4op  lneta( srurxmooo1aex mo3iys s emu s;u)alxomrcoodomD  ieol( sruoim3iodolenlncta(f rrm( onu0openmf3iyd a eluvp;(0 rtoxocoo1omDeauvi (  etoimpio1lm n iei (fsDuaumonu4tlen f3tyslmDrm(vp;t4aeenxrcta1fm   nvo s0t2um(rpou1lp elieiatfsrtrx  nu0alx ifeiydls2eanvpnt)arxrmrciatoaD aies;s)trum(r iu1om emivtas s2rr(r oo1alx  iciadfm elumo ()alxnio tydlp  lu i;t setoxmpno1olte nci s)srta(rpnu4apx  o3tldls2rm(vo t)aexnmrcoy1lm r uei;(  2tmxm3nodap nlivi tf Dtru o;u4tpenmieiatfmDem( ont0 lenmf3totfaDeanesls)seumxo3nydlpee fvil( srrauro;t4olxomoctlt s emuvs t)texnxo3totoaD lueil()srurxm3io4lme lfet ( arua(mp;t1opxniictyd sDumuvp t)trxnir3iadoat au i;(  rumio3oodapt lncsat sDrrumo;t0aetoiieiysfs2uluvp t4tltnir3iodlmt lu ilt sexrxo3nu4ole lfvta( sDrax  ou4olx  icilt s2umuvs;u4trermo io1lpt luvo t  rxoirpnu4ope lfciltfs2urumo;u0apx mfetlsfa2rln p (0 reoif iatlm  lies;t trto(r iodlleelnvtls)sDumxm oo4apenmi3iyd mDemnms u0 rxomo tytfmDrauvi;s)tetm(m ou4olteliesa( srrrxrpnt4tpxoii3tatfaDean pn(0teeoio3totlaD  uvi ( trtoxr ou4al elnesltfarurxmonu0oltoif3tyd aDuaumont0alxnmo3oatfmDelivo s)tetmiopiu4apte netls  2uru p;u4opeoifeiyslsDraump (0aetomo oo1op   u slt sexmxmpoydoptnmnvs t)arumx  nt1tlt io3tatfa rluvp;u0 lenxrctydfmD ln o s sexmimpiudamenlies ( aDtmxmo;o4olx mi3tldlmDua(von() lxnif ia1oat livi () euo(r3ou1om e ieta(fsDta(m ou4tpenioeiyd m2ean pnu4 leoifcootom eanesls)trtr(opoo4ap elnetlt) 2umxmpnu0tet  i3tydfm emn s;t)tltrircootop rlu sl( s2toim io4al  lnvi t sDtmx poo0texn iciadfa2umn pn(0 rxrmo tydlp rauvo;t)t2tmxo3oo4al emnet s) Dum(rpoo1tlxomi3tldlsDea( onu0trxoifciatlmD lu i;t0 2tmxopnudoltn ies sf Drmumpno4alt if3iytfa rauvonu)treoir3tatop  lu i s srtoxr3ny1lme  ivs (fsrur(r ou4oee mf3iatfmDuanms u0aexrir3oodlp e neo t0trxrim3iydaltnlivs (  Dta(rpnu4tlenmi3iysls2raumo;t4 ltnircoodfpt  uvsls s2trio oo4llt lnctls arrmxmo;o0tlx mi3iltfa2rm( p t0aleoxfcoydfa rln ol(0tetoxo3oo4omtnmfvt s  Drm(m ;u1aexnmiciyd mDrm(vp u0 lenmr io1fmDraneo (0t2toxopno1lltelnesas)a2ta(m ot1aee mfeiyt m ua(msnu0 lenmr ootfaDr ivs ( s2toimpiu4alen nctas aruax p;o0aee mf3iysfsDumn pnu0tlxniocoy1fm rlivslt0s2umxm oo4ll   feias)aDtrur ;o1oleoifetytlaDemn o;u0trxoio iodlptr ivsl()srxr(opiu1ol n icta()s2tr(ronu4alxn ietlt m2umnvsnu4texnir3tatfmt  nesls t2xmio3io1llee icilt)a2rm(rp;u4opt if3iaslaDulnvp t)trxnircoytlatrai i;s)t2xr(o nu4am nlnesl(fs2urx o;o1aptn octatfaDelnmo;(0tlenmfcta1fpDeau o (0s2umim ny4ameemieta(fa2trur nt4tpto ociadfaDran p;t) lxoir3ia1faDe nvo;( t2umxo3ou4ol emncs (fartrx  ;o4aeenii3ilsls rluvp u4treoif3tatomt lu i s)t2xm(r3ny1omtemfei () ruaxmpnu1aet micildls2eln o;u)trtnif3iotoptrauvo;t s2to(rpno4lme mfcia(  ruaxm ot4apt mi3iyd mDel(msn(4artrxr3tadomD auvi s0seumxo3oo1omtelfctl( aruaur ;o4texomoctydla rau snt4 leoif3todopD auei s)s2to(o3iydam nmfvs s a2rr( ono1opxn i3iytfaDulump;u0trxnmrctydlm e ieil() 2tm(r3oydamt micsl()srrrxro;u0olxomo3iytls2emu s t)arenmo3tatfat auvsls  2ur(opio1llt lnvsatfa2ta( o;t1aeenmoeiltlmDeauvs t) rermfctatomD  i i;(  rtm(mpnudlme lneiatfa2rrur nu0ape mo3iadfm2ean o;(4treomrcoatlat lneil(0 eum(o3ou1om nmneilt)a2rr( onu0oex moeildfaDumnvp t) rerxr iy1oaDrauei;t  rumirpoy4omeemicsa(  2ua(mpot4aeeoiieiydfaDem(von(4tetrmo3oadlm rlu s ()srtmxopoydlmeelnvtl(farumxmpot4olx ifciatlm rln s (4 reoio tytlaD ln sls srtm(mpio4am elncsas) 2rrx  no4apeniiciysfsDumnvsn(0aetnmfcoatfpteluvi s)s2xoir3oy1omeemncia() rtmx  ;t1tpe mfeils m2ul( pnu0arerio oodlpteai s t) 2ur(rpnydom e fcsls)artr(m nu4opeo ieiys a emu p;t4arenir ia1lpDe nvi;s) 2to(mpnydope  ivils a2rr( p;t4texomo3tlt a rmnvont0teenmf3totlaDr uvilt0seurxmpno1amtnlnvilt arur( pot4alenif3ias s2uluvon(4 leoxr3totoptr ivols)sexo(o nu1ll nmfvias sDrmx p;u1tlt  icias m2uln sn()tlermociodoaDr iesls  2tmxr iudapeemfctasfaDuaurpou1teen o3ilsfaDeanms t)aexnxocoytlm  anvi ()texr(mpnydlp  lnet () rurx onu4tpeomi3iydfm2elnvpnu4aeeoir tytopD li s t0srtrio oy1aptn fet ()a2uau  nt0apt mo3iltfa2el(vpnt4arxnmo3iydfm eaieolt)t2uo(o nu4omtnlfvtat a2uaxm nu4apxn oeiytla emu onu4 rtomf ia1faD aueils0trtoxm ny4lpen nctas arrrum ot4aleomfctytlm el(mo;u)alxrxf oadfmt  ueilt0 2uoir iy1altemictat sDur(moou1tpxnif3iadlmDulnms () ltnxr iytop e u s t0 2uo(rpnu1amen ivs (fsDrmx  no0aetnmoetadlm2ulu s;t)texrmrcta1fat lnvs;s0trtoxrpnu1ol emiet s aDtax  nt1oetnmoetltfa2emuvp u0 exriocoodfpteaues;t sexoxmpnudlptemnet (fsrrmuro;o4opt mociysfs2umuvonu0arxoif oodoa  luvils0srurim3iy1omen ivia()aDtrxr ;u0olenif3iytfm elnvonu) etomfcoadla  lnvi ( trtm(o3ou1olt  netat aDraurpot1aee  f3iadls rmuvs (0trenio ta1la elneo t) rum(o3iudoptn nvt s)a2tmxmpoo1tetomi3ias m2rlumonu4aetoxr iadfpD  ivi t srtoxrpiydalee fvtl(farrmum oo1oex mo3ils mDemnvpn(0alxrmoctytfa eliesls)tetrim3ny4oltnmiei ()s2tr(m nu1apenifciadfmDem(vo (0texoxr oytlp eliei ( s2xoxm3no1am nlnvtat)sDuaurpno0oetnmoetad a umn o (4 rxnio3oodfpt lu ols0s2tm(rpiydlmt mivsatfa2uaxmpnt0texoiiciad aDuluvo;u4alxnmo3ta1late neil(0 2uoxo io4apeelfvi t)srtr(rpou4apx  fciadfs2raums;t0trxnir3ia1fa ran il(  2toxr iodlmen ncs (fs2tr(roou1aetomietytfs uanmpnu)tltrxf oy1oa   u ils)texmxr3iu4apte nctls a2uaxr ot1aexn ociad s ulnvsn()tetoxocia1fmDe i o;s)tetm(rpiy4lmtnmfvi s)aDua(roou0opxoif3iydfaDrmnvsn() reoif3iy1la eaivo;s)setr(m3ny1omee fetlt  rrm(m oo4oeeo ociatlsDem( onu0treomrciotla raneilt0teuo(opiy4apenlies s) rtm( onu1tptoiiciadfmDel(vo u4 lxoxf3to1om ranvi ()sexr(opnu1olenmiciat)s2ra( ooo1tlenmociltfm2emumont0 exomrctatfmt lnei t)tetoir3no4ome  nct t) 2tmump;u0tpe mfctyd mDum(mp;()aeenxr oydfmDr ueslt0setoxm3iydlltelfei t)s2umx  ot1tee  iciad m2rl(mpnu)treoxo iydfm eli s;( sexrirpno1ll  lnet t)s2ua(m nu1opeo i3iatfsDuln s;(0tltrir oatomtrauvi;( seur(o3nodape  fcsls  Dtm(rpno4tex  ieiadfs ea( o;u4aetnxrcoo1fatr neo;t)setoxrpio1olt mici t srtrumpno0aetnmfciysfmDul( s t0arxoxf3oy1fp elu ilt0 euoxo iy1op elncia(fs2tmxrpou1tex ioetltlsDrauvo u4artoir3ootfptr nes s s2ur(mpiu4lpe mfvilt  Dta( p;o1ope  i3iasls2ul(vsnu)altnifciatlpt  uvi t s2tm(mpoo1opee ncsl(farum(rpot0aee io3iadfaDulnvo u4teermrcoadfmD  ivo;()trxmxo3ny1apte ieia(  rumumo;u4alx  feilt s2uan p t)trenxfcoa1oa  ai o () rxrxo3oo1al  lfcsls a2tau p;t0aeeoiocilsfs2el(vp t0aeenmocoodfaDelnvs s0sexoxrpiu1altnlieia(f Drr( oot1apxo fctldlmDel( o;t4 etoxf totlat  ivi ( srxmxm nudomee ics t  2rmx pot0aetoiieiytlaDel(vpnu4aetnxf to1omt an s (0t2toir nudalte ivil( arua(  nt1aetn fciatfm2ran p (4tlermo iytomteanei;s  ruoxr nudaltnmnvilsf 2trumoot1tpt  feildfmDem( s u4tetomr3oydlpte u i (0 2toim oydomen nvtls)a2tm(mo;o0openmi3iasla rmuvp t0tltomfciodfaD  i s ()trtoxr3ou1ll  lnctatfsDumu  nu4opxoiiciatfm ul( onu)trtrmr3oodfmDrluesl()srurxrpnodal n fctlt  2ra(ro;u0teeo f3iadfa2em(vp;u)trxoircootlm rluvols seurxo3iy1omeemneil()sDtau  nu0aetomoeiat sDum(vonu0tlxrxo3iotopt  nvi;t  eumxr3ny1amte nviat)srtrx ont0ape ifetls a2um(msn(0arxrmf iotfpD  ueol() rumxo3nu4optemnvi t a2ur(mp;t4tetnifciat a emuvs u) ltrxf oydoaDean ol( t2urxr iu4ol elnvtat aDtmum nu4alxn fcilsla em( o u4arermf3oodlm rli s ()seuo(rpnu1ape  iei (f 2ta(r no4ope ifeiyd sDrlu snt4teerio ootlaD  nvi;t0s2um(r iy4ol  lfetlt s2ta(r ;o1alto ictadfa2um(vpnu0alenxo io1fmte neils0trurxm3ou1altnlfcsl(  ruax p;t4oleo octldfa2rlumpn()trtoxo io1fm   n s;s seur(m3ny1amtemicilt sDrr(m no1aetn f3tyt a2ul( snt4teerxo3iatlm eaues s  rtrxm iy1ll n fvsa( aDtmxrpno0teeoii3tldfm2rmn o (4arenxf3io1fpte iei s  ruoxr3ou4al  lnvilt)artauronu4ole  iciad aDul(vsn()trxoxrciotom e ieol()trtmxo oodapt  ncsls)a2raump;t0olenmfciytfa ua( onu)artoxocoodla ranvo ()trtm(r nu1ll n ieia()aruaxrpno4alxn f3ilsls2ul( p ()arxoxfctytla  lnvols teuoxm nu4oleelnesatf 2rmx pno0tpx ioetadlm2rmu sn(0tlenmf3iodom rlivi s teurxr3nodalt  fctltfa2umxmont4teeoif3ilt s el(vo u)tetrmr3oy1fa r nes t  2tmim nudlp   nct ()a2urump;u1alt  f3iadfm uauvo u4 eenxociadfat auesl(0 2xo(o oo1omeeliet sf Drm(r ;o1tpto fetytfa umuvsnt0tetoirctadop rlieilt0trxoxrpoodll nlictl( aDurxmpou0opxo oetls aDuau ont0artrir3iy1fp rlues;s0 ruoxmpiy4om   fcilsf rur(mpou1ole moeiydfm2emuvpn(4texoircoy1opD  nei s srxm(rpnudalt micilt)aDur(mono0apt mi3iatfa el(vpn()tetnxf3oadoaDranvo;(0 rumimpoydale miei s aDtaxroou4tpe ifctytfaDem(vs t0aexnmrcoy1laDrai o ()texmxm io4ol n fes (  rrr(rooo0tptnii3iytfs2em( p (4artnxrctatomteaueslt0 2umxm nodomtnmfes sfarurxro;t0aet iieiyt a2emnms;(0artnxr3oytfmDran s ( s2uoirpio1ap nlfvs t  rtr(rp;o4tlxnifctydfaDeanmo u) ltnio3ta1fatr uei;( srumxm no4opt mfvslt) Durxmo;u0tptnif3iadfaDrau s t0 eeoxr iodopt lu i t0t2trxr io1lptn fvi sfa2tr(m oo0optoifciatfm2el(msn() exrmr ootfm  an ol() 2xmir3ny4lmteliesls  Duax  oo4ope  ictasls ulums;t4 rerxf iydop e ivo;s  euo(r iy1ll n ictltfsrrau pot1tlt if3ilslm eln o;t0arermocta1omte uvolt0t2toim iodopte fcs ( srumx  nt1aet  feiatfs2rlu s;u4 rxnmr oo1lptelivils s2tmxm3oodoltn nes t aDtmumont1tlxomfetltfaDelnmsnu) rtomf3totlat  ivs t0tetm(r iydam  mietat)artm(m nu1opxniieiysfa2uaumo (0 exomfcta1oa  aieo;s)srtrxrpoodop elnes (  Dtax onu0tlx io3iasfm2rlu o (4arxoioctatlatr ueolt)srtoimpoo4om n nviasfa2ta(r ;u1oltn fetadfm umnvp (0 rtnxo3oa1lp ranvo s)t2toxmpny4lp elfvt ( aDum(mo;u0alt mictys a2umn onu0 ltoxocoydfmtrai slt) eur(m3oo1lm  lfcslt) rrr(mpnu0olenmfeiytfm umnmo t0 rtnirciotop  lieo;s0teurim oo4ap  mnetlt)srrrum ;u0oet  f3ild a ea(mont0 etnif iotopteln i;( sruoxr3ou1lmtnmnvt sfa2trxmp;t1opx mi3tlsfm2emn snu)teeoif io1op  an sl()srur(m ou4altelfvtlsfsDua( ooo1tlxo fetltlsDel(mont0alenmrcoatlmtr ieil()srtoxrpiy4ale micsat)aDrr(rpoo4texoifeiadls2elu sn() renxf3to1faD  nvols0 exm(o ou4olenmfeiat)artrx  nu1aptn fcils a2ul( o (4trermf iotlpteaivolt trtrir3io1omt mnct s)artaxmoou1apxnif3tls s rm(ms;u4 eerxf3oo1lm eaues t0trtoim nodll nlivi sf 2tau pot1apt  oetlsfa el(vpnu)alxrxf3totfp   ivo t setrxm3iudaltelnct tfs2ra(monu0oexnio3tad a ulu o u4 lxrmoctytlm raneil(0 rumiopoodame  ictat)s2uauront0olen feiyd s2uluvs t4artnxf3oadom   uvi;(  2ur(mpiodllt lictat s2umxr nt1apxomfctadfmDemnmo u4 rxrir totop rlnvo s0srxriopny4lptelivia(fsrtrx  nu1tetniicildfaDea(vs u4artrxo3oa1oat aueols t2um(o oy4olt  fvs ()sDuax ont1teenmociatfsDrluvsnt4 reoir iy1om eaivilt t2tmxmpno4al n fet s)sDtrxr ou1texoioctltfaDrmnmo;u0teenxrcoa1omt lueolt s2toiopoy1ap e nvt ()s2trurpoo4olxnmo3tadls elnms u) ltrmf iytopte i s;()sexo(m3iudlme lnet t aDtmx ont0tetoii3ils m rlnms;t0 rxoxo oodoptrln i;t0 exrxrpiudllt mfcil(  2rmxr ;u4oeenmf3iad m umnms;(4teenir3iytlmD livo t)trxoxo3no4ameemivil()sDtr( oou0altoiiciltfs emn o ()texoio iy1lm  anvi;t0 etoirpoodomeelfcslt a2tmu  ;o4oeenmieiytfs uanvonu0aetnif3oydfm rlnvs;t) rtm(opoy1al  liciltfs2raxr ;o1oltn icils sDumnvsnt)arxrxr totlp ranesls)sruoio ou4am  mivi tfs2rr(m ;o0tltomoeiasfa elnmsn(0 ltomr oatlpDr ueo;(0tetm(rpoydlmtemietas srumurpou0altnio3iytla2umuvp;t0 lenmo to1laDr iesls0 eumir iodoleelnetas sDra(r oo1aetoioeiydfm umu s;t) etoio oytopDrauei t0s2tr(o3iydomte ncsl( s2um( o;o1tet mi3iadfsDumuvonu0 lxnmoctytoaDeau ilt)srxoxo nu4alenmnct ( srumx  ;u0aetnmictyslsDelnmo (0 lxnio iodfm rlnvo t) rxoxopiy4alenmfcs t) rurx  oo4aeenmiciatlm rau o (4trenxf oydfmt anvi;(0trxoiopoodoptnlivs t s2ta(r oo1tlt mieiadfa2umn on(0teenio iydfpDeluvolt) etoim oy1ole miet s aDrm( onu1alx  fetlsfs2rl(mp t4arxrir tadomD ai i s)sexoiopny1amtelncs s) 2rrxr ;u0tptniociltlm2ulums;(4arxrirctotoateau ol(0s2urxr nodap nmivsas a2rr(moot0oltoio3tyd s2elu o u0 leoxf3iy1fpt an i (0s2xmiopio4ll nmiei (fa2rm( poo1alt mocildfaDulnmsn() eeoio to1fa  livo;t0 rtoimpiodaltnliei t  Dtrxr no4aptniicild aDua( s (0arxnxrcoo1lpDe nvi;( texr(r3oydal  lfetltfaDra(moot1tpxn oeilslmDelumpn(4aeeomfctytfmt  ivsls0s2xoxm3ou4ameemnetl(fs2tm(monu1alxnmfeildfs elumo (0 lxnir iy1faDr uvo t0 etmim3iy1op  lncils)arum(mpnu4olxo ociatlm ranvs;(4aeenifcio1la rluvs;s  exoim3iy4ameemnvtlt  2tr(mpno1optoifeildlm2rmnmont4 eerxf3iadfatelu ils0t2umxr io1aptnmieia( a2rr(root4aptoiieilsfm2ulnmp t)aexoxrciotfp e n olt)srtoxm iy1lltn ietlt artmx pou4tee iiciad mDemu s ()altrir3oadfpt  i ils0 2toxr iydapt  iei s sDurum oo4aet  i3ildfs2rau s;(0 lxomo3ty1fat li s s0truoxo3oo4lp emnesa(farum(m oo1aptomi3ildls rlnmsnt4tltoxo iadfa  lu i s)t2umir3oy1olte fcs (fa2rrxmpot4aexo o3iasfsDea(mon(0tltnxr3iotla rli s;t0t2trxr3oo4ape lfvt ()aDtrurpot1tpxoioeiyd s2uluvon(0trerxf oa1omt aueil(  rxrimpoo1lp nmncs s  rrau ono1tetnmi3tldls ranvs (0 eerifcoa1lp   ies;s)s2umxo nu1lp  mivils  rrrx pnu0tpt mo3tlt m ranvo;t)tlenxr to1fm ranvi;( teumio iy4opeemneia()srua(mpoo0ope ioetad s2elnvs;t0 ltnifctydopDelnvsls)trxmim3nu1am emivtasfartmx pnu4aee mietadls2ua( s u)arxnio tatlpDraivs s) etoio3oy1lptnlnvs t srtax o;u0aetomi3iad s ul( s u0teenxf3iodopDranvi;(0 eurxmpio4lpeemncs t)arta(mpnu4texnii3iasfm2rlu ont0 etoxfciydoaD aivs;()seuoxm ou1ll nmnei t  2uru oou0tltnifciyd m2ra(vs u0tetomf iodoa eauei;(  euoxmpnydlltn neils)sDtaxmono4olenmiciatfa eanvs () rtoxoctytfa  lueolt) eurir iydam n fvtat)srtmxmonu0tlx iietys m2emumsnu) etomr oadlmDelivi;t)sexmirpiu4altnlnvt sf 2rr( ooo0aexnifetysfa ul( p ()aexrifciotfpDeauvi;s0s2xrimpoo4apeelncsas)s2rrurpoo1alen fctysla2rluvonu0 exnmocta1fmte u i;s0seur(m iudameelnciat aruax onu1tlx mf3tyd sDel(mpnu4 lxnio oa1lm r i o t0texmio3oo1am emncils)arrmxmp;t1apto i3tatfa ea(ms u0tlerxr oadomt lieol(0 2xr(m3nu4amtelncia(fa2raxro;t0tpxn ociadls ea( p;t)aleoxfcia1fm eli o s0 euo(r nodamenmicsa()srua(mpno1oeeoifeildfs eln sn() ltoif3oatfaD an il(0setmirpiu4opt mncias  2uau ooo4teeoio3iat a ul(monu)aexomr oadoaDe u o t)s2umio3no4optelivias) Dta( o;u1tltomoctltlsDumu on(0 exnxf oatfpDelies;s0tetmxr3oy4lmeeliei ( aDrrumo;o1aexomfciad mDeauvp (0aleoxfciatfp eluvi;t0 2tmir3nodomt mnetlsfsruaurooo1apto fcild mDrmnvpnt) reomf3oa1fatraieo;(0sexr(o oo1alt lfesl(fa2urx  ou4oet mo3ildfa ua(vsnu)aetrmr oy1opt livo (  2xmxopio4lme lnvia( aDrau pno1aexoiociatfa ulump;t4 eerir3oadfaDeanvslt s2xm(r ou1apeemnetlsf 2rr(m oo0aee mietytfmDeanmpnu0 eerxr3tatfatrluvs s s2to(rpno1apt mnetl( s2tmx onu4apxnmfetldfm2eanvsn(0 etnxr3totlpD lnvo t)t2xmxm oo4lmt lfcia()srrm(r ou1tpenmo3iyslm ua(mp;u4tetnxf io1om  lu s;s0srxoxo3iudlp  licsatf Drrumonu0oet mictlsfa um( p u4arerio3ootop rluvi;( trtmxo3oudomt  ieiat)a2tauroou4ole miciatlm2umuvp;t4altnir todoatelieilt tetmio ou4lmt lneslt s2tr(r no1apxn fetysfm2rmumon(4 leomocootoptrlivol()tetm(m3ou4omte ivi (  2tr(moot1aeenmiciysla rlnvont0 exrir oatoaDr nes;(  eum(m nu1ome  fetl(  rrax o;u4teenioctydfa um(vs t4arxnmr iatfaD  ues s0truoxopoy4ol nlnetlsfs2rmx o;o1optoiictadfs2ra(mp () rtrxfciodfpt ai i s0srtmio oy4lpe mivt sfarraxm ;u0alxo oetltlsDrmnvs u)tlxoir3ta1fate uvil( sruoxm3io4op  lnetasf Dra(m ou0tpxoiocias m ea(vsnt0tetoif oo1fmDeluvi (0setrxmpiudaltelnci ( arraum ;t4tex  ociatfa um(vsn() rxnmrcoadfpDeli o s0trxr(r io1aptnlfctatfsDra(  ;u0apx  ieiytlmDuluvp u) ltrxr3iy1lmD lneo () rurxr3oo4lm  livi tfsDra(moot4tltomfeiytfm2rl(ms u0 rtrmr totfmt  i i;( s2xmxopoodlltelfvi s)a2ur(m ;u4tpxomf3tatla um(vs;u4 etomfcoytfatrlneols texmxr ou1am   nes sfa2uaxrp;t0ale ii3iytfs2ulnms;u4 renmo iatfpD  ies;t trxoxm3io4al e ivsas arurx  no0tpt moeiaslaDrau on(4 etoio3tytopDrauesls0 rtr(o ou4ameemnesltfaDrmx p;t1alt moctytlsDem( p u) ltoxocoydfa elivi t setriopiodam e nctls  Dtmumo;o0tlxnmieiyd a r
\ No newline at end of file
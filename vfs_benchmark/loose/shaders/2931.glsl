@@ -0,0 +1 @@
+ieol(0 etrio3oo1llt mies t) rrau pnt4aleoii3ils m2uanvp u4tltnxr oodlmDeln ilt0 etoir3ny4ll  licsas artr( o;u4tex mfciatlmDemnvs;(0aexrxo3iydfa elnei;s0srxmxr3no1am emnetatfaDrrx pnu0ope  feiyd s ranmpnu) rerif iydoa ean ol() etmxrpiu1lme lieil()a2rr( ono0teeniociaslaDum(vpnt0 rtriocoa1lmD anei t teurir3nydllte icsasf Drrxrooo1apt mictatlaDem(mon(0 eenio ia1opteaivo;t0trxmxr3iodalen ics ( aDum(  nt4apto ieiatfa uau s ()tltrxocty1fptraneslt0t2xoir3ou4am e ivtls  Drrxmp;u4tltomieils aDum(vp;u4 rtrxf3iytlmteaivslt  eumiopou4om nlnvta( arur(rpnu1oeenmoetadls2rm(msnu) etoiocoa1fptran ol(0sexrxopoudaleemicils  rrrumont0tptn i3ils mDumuvpn(0 renxf todopD aivo;t)teto(mpoodalte iet t  rtrx p;t0alenmi3iytfaDemnmp;(0teermo3iatfatelnvsl(  etmiopny1amen ictl( aDtm(ronu1texn i3iat a el(mo;t)treoio3iy1omDeauvs s0 2xrimpou4ale lfcs tfsDtax o;t0tet  fctyt s2ranmo u)texrmr3iodlaD  u i;() exoirpou1amtn fvtlsfa2um(ront4oetnifcildla2ua(mp t4tltnmo3tydoa elnvsl(  exr(mpiu4ll   ivi s srtrurpou0tlt  ictls mDrm( pnt4alxomo3oo1omteli ilt) 2uoirpiydop nlfcta(fartmxm ;o0apxo feilsfm2rlnmo;t0tlxrxf3io1omt aivi;s  2xr(opoudlmte nes (  2rmump;o1alenmiciydfa2rl(ms;(0artnmf3iotop r ieils setrxo iydllte fvil(fa2ta(m ou1opxnmoeild s ua(ms;u)alxnmfcto1oateauvils)texrir3oudol nmnvtl()sDumur ot0aeenmieias s rl(vp u) eeomr tadfateai ols0srxrxr3iu1olen ncta(fs2tmx  no4apx ifciydfs emnvs t)altnmo iydfm eau s s) 2urxr3ny1lm  lfeiat  2ua(m ou1teeoiicildfmDum( s;(0tlenxf iytfat  i i s  etrxrpoo1ape lfct ()aDtr(rpou4openifetadfa ranvo t) ltnio3oodfpDelnvo s0tetr(mpny1op  licslsf rtrxm ot0tlxn i3ildfsDemump;(0alxrxocta1lpD  ueolt trtoxo nu4llteliei sf 2tr(rooo0tleomi3iyt m eanvs (0 rtrmf3oadom r uvo (  eumir oo4llenlneia( aDumump;o0tpeoii3tlt a uan p;t0altoio3iydop raivslt) rumio3iudll  mivsa( s2tm(rpot0aet  ieild sDrmu s;(0trtoxr oy1fa e n s;s0 2uriopoy4olee fvtat)arurxmp;t4oexnif3tldfmDeanvp;(0altrxr oa1lpt lueo;()tetmim3iy1omtemictls)aDra(mpoo4oet ii3tldfmDumnmp;u4 lerir tydomt au i;(  etrir3nu1ale  nvias) 2rmxrp;u1apto f3ils m rl(mont)arxrxr3iatoat  u ilt0trxoio3ny4omenlivsat)s2trx oou4tpx ifciytlsDumn p t)tetrmo3iodlmDran s s  eur(r nudaptn nviasf 2tm( pnt0alxoifcias aDrmuvo t) etrif3iotfptrln o ( s2xo(mpoy1oltnlnvtl(fartmxmpot1texn iciyt a2emu o;u)arenioctytlpteln o;t0s2toim oy1lptemfeilsfsDtr( pou1texomfciysfs rmu p;t)alermociy1oat au o t)srtm(o3oy1altn fvi t)a2rrxmont4oltomo3iltfaDrm(mp;(0 ltnxo3oo1faDe ivs;s) rxoirpoy4al e nesa( s2uaumpno1alt moeildls2rl(vp;t)alxriocoy1oaD lueo;s  2xm(o3nodolen fcs sfsrrrx oou4tltnmo3tydfs2umnmo (4tetoxfctatlmtrauvi ( tetmxopiy1om nliei s) 2tr(mpno1tetnmicias s2uanvo;()trxrxocoy1fatrlnesl() 2urxm3io4ap e ictl( sDtr(mono0ole io3ilslmDem(vo () lxrir oodlm r uvo;s0s2tmxo ny4lpee fctas s2rm(mpno0ape ifciaslm ulumsn(0 eenxrctytlmDraiei;t) etmim3nudamenmicsls)srrau oot1apeniietatlm ra( s (0arxrio oydlm   u ilt0t2trxr3iy4lp   ivt t)srtax pot4olenioeiydfm emump u0alenxf3ootfp eln sls  exmir3nudal elnesa(  2rau  ;u4apxoifeiatfsDemump;t0aeeoio3totopte ivi;(  eumxo iu4ll nmnvia(f rtru poo0oleoioeils m ua( p u0arxomociadopteaivi (0t2xmimpiu1lp n fvias)srrr(r ;o4tle iiciatlm rm(mont4 rxomf3ia1opte ivslt s2toxr3ny4am n ivi t srtmurpou4aee ioeiys a2emumsnt0alermf3iy1fa rli sls) eumxopno1oltemfetat) rumum nu1oltnii3ilsfs ulnmont0teeoxf3tydfa raiei s0teto(r iydapteliet t)a2rru oot1tlx mo3tys s ran pnu4tetnxo3ia1lmDe i o s0texrxo3nudapen ietlt)srtmx ooo0tlto oeilslm um( p;t0tlerio3tytfmte u s t teuoir3oo1ll e ieslt  Dur( p;t1oetnif3iydfa ul(vo;u4alenifciydom e iei;t)s2trxrpno1ll nliesas sDrm(moot0apeo iciytfsDelu p t0 lxrmrctotfaD  ivi t0t2xmir3nydol nlfvtl( aDum(mpno1altnmfetaslmDulu sn(4 leoif3ia1omD ai i s  eumiopio4amt  fvtlt) Drax  ;o4opt mieiyd m rm(ms (0teermfcoa1fpDelu i s tetrxr ou4al n fvi s)arua(ront1opx iieiat a2um(vo;u0 lenxr3iytomtrlnvi s)sexoir oudomenmfeta()a2tru  no4olenmf3iaslmDel( ont4artoif3tytomDe nvs;(  etmxm ou4lmee nvtl()s2tr(mono0apto ictlsfa um(mo u4arxrxf3iadfm rluei;(  exmxmpny1apt lfes s)s2umump;u4aeenif3iadlm2um(vp;(4 exnxf oydfmteai slt) eto(r io1ome  fcs t) 2rmx  ot1tlxomietyd s2ul(mp;(4aeenmo3iydoaDeln s ( srurxm3oo1lp nmivi tfa2rau p;u4alx mfctysfmDemnms;()aeeomr oy1fa rlneils tetrir nodomeelfcsat)sDraxro;o4tetnifciltls rluvp ()tlxnif3io1laDrlivslt0t2tmxo3iodamee ici (  Dtaxroot4oeeo ociltlaDrauvs (0 reoxf3oodlp rauvsl(0srxr(o3iy4apeemnet sf Duaxr ot4aleo i3iltls rl( snu4aetoif3totopDelivs (0tetr(o oodame mfei t a2tr(mpnt4altnio3iyslaDemuvp ()tltnxo oo1fp e u i s)s2xm(o iu4aptelnci tf Dum(rooo4aptomi3tlslm umn p u)tetrifciodfm  ai o s)trtmxr3no4opt lncsatfa2um(mpno1apto i3tydls2rluvs;u) rtrxfciydlmD anes;(  ruoxm iy1omtn ncilsf 2ua(mo;o0tltn ieiltla2eanvo;u0arenxfcoadlpDeluvolt)teur(m ou4lptnlieilsfa2umx  no0tle ifctls s2ua( sn()areoio oadlaD aies;s)texoir3iy1openlieia(f rtmumont0aeeoioetldlaDrlumo t0aeerio to1lm  anes;t srtrio nodlptnmfctlsfa2tr(ro;u1aexnioctyd a2emums u)tleoif3iatfmtr iei (  exmir3iydlptnlnci (fa2rm( pou1oet  oetlsfmDeaums;(0teeoir iodoa ranei t s2toxm3iudal e nesl(f Draxrpoo1tlt mieiatlm eln o u4tltoxrcoatfmDeaivslt0 rtmxrpnodop  mfciat) Durum ;u4aleo feiyt m2uln o;u0 ltoxo iatlpt  ieo t trtmim3no1op  mfes sfarurx p;o4tpx ifetydfa rmnmsn() rtnmf iy1omDelu sl( s2tm(m3iydll nmivt t)sDurxm ;o0texoiieiltfsDuau p u)altnxfctytfpDelies;s sexm(mpno4ape mnci t)aDtrxmo;u0aeen fetytls2umu o;u4alxrmo3iadfatelieo;(  ruoim3oo1op emics (fa2tmxrpot0tetn i3iytls rmnvpnu) exrioctydfpt anvols0 rurir nodopenmnetls)s2ur( p;t1tlx mo3ilt s rm(vsnu0 leoiocoytlpDelueol()truoio3oodamen fesatf 2rrum ;t1tpx  ieiyd s2em( s t4arxrmr oadla r ieil(0srurxr3oo4lp nmietl(  2uaurpno4tpt  ietltfa2ulu ont0trxrirctatlpDean i ( teuriopiodaltn fct () 2raxr nu0apxniiciasfm eln p;(4aeenxf3io1fmDeaivolt  2xriopnu1ale lfciat)aDtm( poo0oeenio3tatls2ean ont) exoir ootoa rluvi;(0 2urio iudopen ivtat)aDtaum nu4oexnifeiadlaDum(msn()trtnmr3io1oa r uei ( s2ur(o3io4ol  mneia( sDrrxmpoo1opt ifeiydfa2uauvp;u0aeeomo3oytoaDrau s;s0texrio nu1omee fetatfartr(  no0ape ifeiydfa2rmn p;()trxrxrcia1lpD lieo t)sruoxo no4optelfviltfsDumx o;u1alx io3iatfa2ul( p t) ltoir3iotlmtr nvolt)s2xoxopiu4lpen icils)sDrmx p;o0tltomfetyd a2emump (0texrmr3oo1lpDr nes (0srtrxm3io4lltnlicia(fs2uax  ot0tlxn ictlslm ua(vs t4 rtoxrcoo1fa rlues s)t2uoxopio4lmtelfetlt) 2ur(m oo4olt  i3ilsfaDuau s;u4tltomr3iotom elieo s)t2um(r3nudole mfvtlt) Dtmxrpoo1alt  iciys mDuanvo;t4 rxnxr3oytopD lueils  ruo(o io4amtnlnvsls)aDraurono0tltomoetldfaDuaumpnt0texnir io1opDrli s;s)texr(r oo4apt mncsa( aDumu ooo0alt  i3tytfa2eanvs u0tlerxfciydla elnvi t0srxm(r3iu4lme  iesas) Dtaxrpou1tleoif3iltfs2eauvo;t0 lxoxf3totfpt liesl(0trtmim3ny4omtemneta() Duaxroot0openiietyd m2eau s;(4arxrxrcio1opD  uei;(  2tr(m oydomenlneil()sruaum no4olxomoeilsfaDeanmp t0aeeoxo oadfmtr ivi;(0tetm(rpnudol elfvs s)aDtrxrpnu4oet mo3tlsfsDel(von(0 ltomr3tydoaDeluei s t2urio oydlltnmnesl()a2tau  ou4aet io3tytfa2ra( o;t4 rtnio oo1lm rlu i;t0t2umirpno4llee iesas  2rr(mo;t0olx  fcild sDra( o (4trtoio3ia1lpt au o (0srxmiopno4apt mnvs s  rrrx oot1olx mietas m2rlu o;u0arxrmr iatlpD au ols0sexrxr nu1lm   fesl()s2um( pno4aleomfcias s2rl(vsnt0arxomf oodopDranes;(0t2xmim no4aptelnvsasfsDrru pnt1tlx  ociltlm2uaumsn(4 exoxo3tydlmDrai s;t s2umxm nydomtelivsl()sDta(rooo0apenmieiadfaDel(vo;t4artrif ootfatrluvs t)setoio io4lmtn ietlsf rum(rpno0alx  feiatfa el( snt0texnir iotla  aies t)trxm(r oudllte feiat arraump;o1opt io3tydla el(msnu4 rerxfcoo1lmDe nvo t0 2umir oydlmt livsa() Dua(m ;t4olenmfctad m elu s u4alxrmo to1laD  uei;( teurxrpoo1amt mfvt ( s2tmu  oo1opx  fetat sDem( onu0tltoxf iytlm   ueolt0 rumxm3io1amtnmicsas a2um(r ou4apxn feiat aDumums t) lxrmr iatfp  lueo ()srto(mpno4ll   ictl()arrmur ot4altnmfeiltfm rl(ms u)tlenxr3tadopte ivo;t)texrimpnu1lp  lieta(fa2tm( pno4olxn f3iaslsDulnmp t0tlxnif ta1lpDean o s srxr(o oo1altnlnvtlt  2umxr ;u1tlen ociatfa2ra( pn() rtoxocoatoate ivsls srtoxmpoudapte fvsl()s2tr(rpnt0aeeomoetasfs rlnms;(4 renir3iydomDran ils0 rxo(o ou1llt  fesat sDtaum ot0opxniictatfsDul(vo (0teenxf3to1lmtelues ()s2xrir3no4omtnlfcils srtruront4ope  i3iatlsDeau snt)tlerxrcoadoaDrliesls  eumio no4oleelncias) 2ra(r nu4optnioctatfs elumpnt4arxomr tytlm ran ils0t2urxr no1lp n icsl(f Dua( oot0ape mociydla rmuvp;u0alermoctodopte u o;( t2uoirpiu1ope mict s s2uaurpnt1tpeomfeiytlsDraumonu0teermfcootopDeli il(0setmimpiydlm emiviltf 2rmx onu1tpeoifciyd a eanmo ()trxrio oy1lpte ueolt0s2xmxm3ou1am nmfctas)srtauroou1tee  i3iat a ulnms t0alenxo3ty1opDr i s t  euoio iy1lmenlfcsl(f Duaxm ;u1aleo ietytls ean onu)tlxrmo3oy1la eluesl()setmiopoydaltnmfcsat)aDtm(mpnt4tpenmfciasfaDrl(mo;(0teermo3oydomt  u o;s0t2uoir3oodlleemictls) Drr( o;o0aexnifcilsfaDumums;(0 lxoxr iodom   n s;()t2xo(r3iodalt lfes s)a2tax  no4tltoifeiyd mDul( s;u0 eerio3iatoat li o s0 rxmim io1llt  ictls)aDrm( p;o1apeoifctydfa2rmn sn(4trtnxf3oa1faDelnvs s  euo(o3nudlpt lfvs s  2tr(r no0apxoifciadlsDemnvs (0tetnmr tytopDr ueo;s t2umxr oy4al nmivsl(fsDtmur ou1alen i3iys s2umuvp t) rxoxfctatfmt an ol() rumio3oo4ap  lnvs t artaxr ;o0apeomfetatla rmu o;() rtnmo3io1oate ivols) 2um(r iy1lpe micsa()srrauro;u1oltnii3iyt m2eanvsn(0artrxo oadoat lieil() etoxm3oy1omen nvi t  2ra(rp;u4opxomf3tydlm2rlnvonu4arenif iotopD an s;s srurxr ou4amt lfcias  Dum(mooo4alt  octlt s2uluvs;u4aexoif iodfaDrluvo;t) 2toim3ny4om  lieil() rrm(mo;u1opxoif3ils s2emuvp (0aetnxf3ty1fateai s t0 2to(m nu1lptn fctls)a2taxmono0aeto oetltlm uluvpn(4 reoir iy1lmte uvo ()s2xmxm3nu1lleelnei t  Drax onu0tpx moctys mDuln o (0 ltrio3ty1lmte u ilt  rxmxo3ny4lm n ncs tfsDtmumo;u4olxo f3tldfa eau s;u0trermo oadoa  aieo s) 2to(o iydamt mnvil(fsrra(mont0tpeniiciltfsDumums;t0aexoifciatfp e n s;( tetmxo iodlptelfetls)a2um(roou1alx mietasla eln o t0 eermrcta1lmtrlnvi ( sexrirpnydope mnvtasf rrax pou0olen feildls2umnvs () rtomrctytla rlneo s)s2ur(r3nu4lmtnmnetat  2raxront1oeeo f3tldfm rmu o t0 rxnxr3ta1lpDe iei ( t2xmim iy4op elict ()srra(mpot0alxoif3tatlsDul(vo;u0aetnir iydoa  ln o;s) rumir3oo1apen nvtatfsrtaurp;u4optn o3tatlsDuln s u4aetnxfcoatfptr nvo ()s2tmio3nu4omeelietas)s2trur ;t4olxoio3iytfm2ulnms u) ltoifciatlmD luesl() 2tmxr3oodapenlnvtl()sDurxrpot0opxomiciadfa2eanmp ()tlxrmf iodlaDr iesl() rxrxopiudole livsat)srtmxmoou4altn fetyt s2um(vp;u0trtrmr3tadla e uvolt)setoxm oodope  neia( a2taur no4texnmiciat s rluvs;t0 rermo3oy1lmt auei t0seur(m3iy1ol n ncils)sDrmxr no1apt mf3tat a em(mo u)aexnmfciotoa elnei;(0t2uo(m3ou4am  mfeil()aDua( pnt0tetnmoetat m2em(vsn(4 lxnmfcia1op  aieo;(  eumirpoudlm emnvs (farrmx p;u4apenmieiytfa2uln on(4aeenmf iatlaDrauei;t texmxopiy1ap n fvsl(f 2urxro;t1tpxo i3iadfs eaums;u4trxnxrctydlm  au il() 2xoxm nudoleelfvt t) Drm(rooo4aee ifetas s ua(msnt4alxoio oodomD  ivi;s0t2xmxmpoy1ale mneia() Dtrxm no4aexnifeiadlm rmumo;()tlxnmo ootoa e nvsls0s2xmxo oodolt mnei (fs2ur(roou1oet  octldlaDrmums u)aexrio3iatfmtranvs ()s2umio io4llt  nvilt aDur(  ;u4opxo oetadlm2ua(vo u)aexnir3tydom e i i t0s2xm(m oo4aleemfvi s) rua(mono4oetoii3iys m2emu o;t)artoir3oatfaD  iei s trtr(m3nydole lnvtltfa2rrump;u1olto o3iys a rau sn()tltnif3oadfm eanvo ()seto(m iydoltnmfvt (fa2rrx  nu0olxnmo3ils aDrm(vp t0trtrmo3iy1lpDrauvi;s)setoxo oodam nmfcta( srtrur ou4tpeomieildfm2ranmon(0texrmociatoa eau sls truoxo ou1ap   ivt sf 2rmurpnt1tpxn fciad s rlnvs;u0tetnifctodomDeaueo;s0 exmirpiodap nmnes tfartrurpot4oexo o3iyt s2umn o;(0trtoiocia1op  lies t0trxoiopou1openlnes t)sDurx  ou4tlx if3tadls2em(vp;t4trtoxoctatlp ean ilt0s2xoim3oodomtn ivi t sDrmu  nu4tle  octas sDua( s () rtnxf3iydoa eaues t)teuo(m3ny1aptemnvt s arrrumont4aeto i3iad m um(vp (4tlxnxrcoydoa  li s;t seurxm iodlp nlnvsls artmu pnu1tlenio3iytls elnmo;(0trxnxf3iadopt auvs (0t2ur(m iodap elicsa(f rtm(m ;t0opeomo3iytls um(msnt)tltnxf ta1lptrlneo t) rtmxr3no4am nmivil( s2urxr no0tlt ioeiatfsDuauvp u4artnifciy1fmtelnvo s trum(r iy1ll nlfcsas  Dtr(r ot1oet iociyslm2eln o (4trxomr3io1optean sl(0 rum(m3iy4ol n fvsls srtmxmonu0aptomf3iys m uan s;(0tlxnxf3oadoa  auvs;s)trur(r3ou1altnmietlt aDumu ono4olxo o3iyt s2elumon(0alenxr3to1lm e nvo (0 rxrxm iy4altemivias s2ua(mont4tpx mi3iad mDumnvp t4tlxoxfciydoat lneo;s0 2uoxmpoydamenlfeil()sDraum oo0apxnmfeildfmDrlnvsnt0 eeomfctadlm   nesls)tetoxm3nu4amtelnctatf 2ur( oot0altnmocildlsDeanmp t0altomfcoytoptraivil()srumir3oo4ap n icsls s2tmumpno4opt mietatfm2emuvo (4 rxnxf3iytfat  nei;t t2umxo iodlpee ncslsfarra(r ou0apt  o3iltfm uau snu4arenxo tatlaDeln sls)srxr(r3ny1omee ici tfsrtr(root1oeen i3iadlm2rluvs;u0artnxfctatomteauvo s sexr(o3nudlp nliviatfarrmxmo;o4tlt mi3iltfm2rmumo (4trtrmr todoa  an o s trumxopoo4apt  fcs s)s2tau  ;t0aptoiietlt a rm( o t4aeenmociytfa r n i;( teumxr3ny1lmtnlicsa()artaxmpoo1aexomietyt sDemu s u) exoir oodfa eaivils0 eum(o3nydlleelfcsl()artrump;o1oetnif3tadla2rmu onu0aexrmo ty1lpt aneo ( s2uo(r3iu4lptn fci t aDta(rpno1olxomietldfs2umnvs;t4arenxf tatlmte ivslt) eto(r3oudameemics t) rtm(mo;t1altomoctyslmDuau s;t0 lxomrciodlmD  nvs;s) 2tmxr ou4lmt lnctls)a2rr(m nt4opeoioctydfsDran pn(0tleoxociodopD an i s0 2ur(o iu4lp   ivt ()srrm(mp;o0opxnmo3tltfs2uanms t0artomfciodlatrli ilt s2xm(opoy1openmnci t) 2trump;o1oeeoioeiltls2emu s;t0teenmf3iydlaDr nesl()s2xm(mpno4ap e nvi t)sDtr(rpnt4alxnmictyt m el(mp (0tltoxfcoadlaD  u ils tetrxo3iodolee nesat sDrmxro;t0aexniociys aDuanvs ()teeoxr ty1fp eauei;s  rtrxmpno4aptelfcslsf Duaxrp;t1alxnmoctasfm2uanvon() lxnxf3iotfpD aivo ( sruoir3iu4opeemneia(  2taump;o0teeomieiatls rln p ()texnmf3tadoa eluvo () exm(opnu1amen ncsls srum(m ou1optnmf3ildfm2uauvp;() rerxr ta1omDraiesl(0 eumxr3oy1op  mfeilt s2uaxro;o1tlxo ictlsfa2el( snu)aetoif tadfmtrlnes t  2uoxr3oy1altn iet tfs2tm(r oo1aexnmfciysfs2umumsnt4 etrxr3oo1fmtrlueo s seum(opio1ap emnvtlt sDtm( ont1opxoii3iysfs2rmuvonu)aexnxocootomtr u i t0trurxr ou1aleelfci t  rurx pno0opt mf3tysfa2emnms;u4 leomr iatfaD  uesls0 exo(r3iy1op e iesas)s2uaurp;u4apeo iciytlmDumu p;u) renif3oytfp e uvs;s)trum(opio1lltelivt t)arrrurono0ale  i3iytls um(mp ()arxrir3oadfmDrli ols) 2uo(o iu4lmt mfvtl(fs2uru pot4oee  i3ilsfa um( ont)tlxoif3tadfp rai s;( srtoxm iy1oleemfes (  2ra(m ;o1aee mictlslsDuanvs;t4alenmr3io1fa eaivs;s)seur(o oy4ap  liet t)a2um(  nt0tleoif3ilsfs2rlnmp (0 ltnxfcta1fp r uei ()setoio3oodome mnvsls  rua(ront4olxo o3iysfs emu o t0aetnmocoodlp  ai i;s t2urxo ou1opt lncils  2rmxm ou1ale mfeiydfm2ea(vsnu0 ltrifcia1lm rlivol( srtmxo3nu4lme  nvt t)a2rrx oou0altn oeiysfa2ea(mo;u)alerir oy1om   n ils)texr(opiy4lmee nctls aDrr(rpou4alto ociytfaDea( o (0 exoiocoa1lm raivo;(  2to(opoo1lle  feil( a2truroot0oeeomiciad a eaumo;u)aetrmo iytop r nesls)t2uoxr3nu4omeemnvsls) 2raxr ot4tee  icild m2ran snu)texrxo todlptraueo ( setmxmpiu1lptemnesl(fs2umum ;o4tex ii3tytfmDumnmp;t4 exnmfcto1la eli s t srtr(opoy1lm emicsa()s2tmxr ot1oex  ietad a2emnvsnt4arxrmf ootlaDe uesl()srxo(m nu1llt lfvslt)s2ururpot0tetomfetldfm2ul(vp;(0teerif3oadlmt livo t) 2xrxrpno1ale mivs t arra(  ;u0teto ictldfmDrluvo;(0 ltnmocootlmt an i;t0s2toxm3oy4apt mnesat s2urxrpou0tptn i3iys m2ul(vs;t) rermo oodoptr iei;t)s2toxm oy4lme  fciasfarrm(monu4tpt moeiytlsDumumonu4 lermo oodomteanei ()t2tm(o3oudamenlieta( s2rrxmono4opt  fcildfs2umuvont)aeerxo oo1fa e nes (0t2trio3iu1al elnvsas  Dtr(  ;o0tlto f3tyslaDrm(vp;u4 ltrmr ia1lpDr nei;t)srumim3oo1apte fesat)sDua(mpou0aleoif3iytlm uau onu)teenmr3iadfa r neol()s2xmxmpiudam  mfvt ( s2tr(m ;u1aee iictldlm umnvs;(4alxnio oa1lptrau s ( setmir ou4lp emfei t s2umx  ;t1tpto i3tldfaDul(vsnt)tetrioctodlm r ieo;t0 2trxmpoodol nlivt s) 2umum oo1opeoio3ild m2uln p;u4artnif3iotfmD ai s;(0srtm(r3iudolen fes t aDrrx  ou1tlx mieiatls2el( o (4trxrmr3oodoaD anvsls  etr(r3iodllee fvil(fsrrmxr ;t0olxoif3tldlaDua(mp t)tetoxrciy1la eanvi;s)sexmxo3oo4alt mfvt ( aDumurp;t4opeomfeiydfm emuvonu0treoxo oo1om  ai i s trtm(o3oudapt  iet s aDrmxroot1tpxo feiaslm ulums (4aeeoxo todla rliesl(0srxr(r3io4ol n nvsa() Drrx ont0opt  fetatlaDemuvsnu0aexomr iotlaDran o s srxoiopny4lle mnvs s) 2rrurp;o4aet iietysfaDea(vsn() ltoiocoo1fatrlnei t  rtr(rpnu1apt livi (f rtm(mp;u0aet  ietlslaDrmu ont0alenxr io1om  lu s s0srxmxo3nu4openlnvt sf Durx pot1open ieiadlaDemump t4alxrif3tatla e n o;s teuoxmpiy1lmee ies ()sDrru  ;t4aex mfetadla2ea(vont0tleoxr to1opDe i s;( t2um(rpnudalen feils)a2trxrp;o1apeomf3iasfa umu s;u4tlxoxfcoatoa e ies;( setrxm3oo4omenlieias)arurxroou4opxn ieiad a2ea(mont4texrmo3iydfmt  n olt0t2uoxm3nu4ol   ncta() Duru p;u4olen o3iltlm uanms (0areoxf iadfaD  i o (  exoxm3oy4lleemnct ( sDtrum nu4tetnioeiysls rln s t)altnirctadlmt  u i s seuoxr3nydamtelictat aDtaurpnt0altnmoctltfa elnvpn(4alxnmfctodfmte iei t0texrxo3oodlp elicsa( sDrr( pno0opxnmocilt a rln p u4aexrmf ia1lpteaues (0trxm(r3oy1lp elfeils)arrr(  ;o1olen i3iysla rl(ms;() rxnmrcoo1fmDran s s t2xr(o3iy4openlfcsasfs2ur(mooo4tptn o3tldfaDem(mo;t4 ltnxfcoydfp  ln o;(0t2tmxm3oy4apt mncia()a2rau o;u1aeenmfciad aDelnms;(0texnif3totlpDelnesls0 2ur(m3ou1opte feias) rrau o;o4tee  o3tltls2ea( p u0trtnmrcoadfm eaies;()srtm(o oydlm e nvi t aDtau  no1texn o3tyt aDelu snt4 eermr iadopDrliesl() ruoim3nu4lptnmfvt s  Drrumpot1olxnmieiltls2ea( s t0aeeoxo3tydlm  aueslt) rxrio3io4ope  ivslt srumx  ;o0ope mieiatfm eaump;u0 exomf3to1omD aivs s srto(opoy1lp   fvsltfs2rm(mpou1open i3ildfmDemuvon(0altnif oytlaD  nvo;s  rxrxm nydlmtemnvtlt) rtrurpoo4alenmieiasfa uauvont4 exrxf ty1oaDr ueo s  2xrio3iy4lp nlicsa()sDrrur no1apx iociltfm rlnvo t0 lenxr3tatoatelu i;(0trum(o nydlmtn nctls)aDtr(m nu4open ieiadfs rmums () rermr oatfp r i o t  rtoim oo1altnmncsas)arraumonu4opeomietatlaDra( s t0texnxocoadoat lueol(0srtmim nydopenlictls artm(ront4tlxo i3iltls emnvp u)treoirciotla raivo t)tetrxr3nudllt  ivia( arum( o;u4tee ifeiasfm eauvsn()trtrmr ootlatrai ils srxoio3iy1omee ivt ( arrru  ;o0opt mfctydls ran o;u0 lxrif3iodlm raivols)sexm(o no4lm   nvtl() ruauro;u0apto ieiad mDrauvp u0 exoxf3ta1lmt lu i;( s2tr(m3nudom   icilt srra(moot1aexomfciat m eau on(4trxnir3ty1fa eanvi;t0t2urim iy1am nmietlsf Draur ;o4tltoiociyt sDuln ont)aeenmf3iadfmt li s;s trurxmpiydlpeemnvsltfsrurx  ou0altnmfcils m uan s;(4altomo oa1fa eliei s0teumimpiodame mncs (  Dra(root1altn octysfm2umnmont4aleoxo3ia1fptraies;t0t2xoxm3no4lmen nvtlsfaDrmx pnu1ope  f3iasfsDemn s;t0aexrmocty1faDeaneil() 2ur(rpoydll emnvtltf Drau poo0opto ietldlaDuanvs;u4tetrmrcty1faD luvol( setm(o3iu4ale lfct (f rtrur nu1apt ifciysfa2ra( onu0 eeomr3tatfpD  u s t texoir ou4openlicta() Drr(rp;t1olt iociadlm2uan s t0tleoif3iadfatr i o;() 2ur(opnu4ll  mnvi t  rraur ;u1tltomoeils m2raums () rtomr oadlm r i o;(0texrim oy4olenmfesas sDrmxmont1apenmf3iaslm2ra(vo u4trxrxf3oy1la e i i;t  etmim iy4ll e nvia( aDtru o;u1tptoifctas sDeauvo u)trtrmf3oytfmD lieo;s) rumxopio4aleelfct s)sDuaumo;o4tpxnmoetysfm rlu o u4 ltoxrcty1oaD  ivils0srumio oudol  lnvtasf Drmurp;t0teenmf3tat m2elnvp (0 etrxrctotopDr nes s t2xoio ou4lp emnvs ()aDuaxmpnt0ole ioeildfs2ua(vp (4 rxomr3ty1fp  lneo;s0s2toxm3oy4al  mivta(f rta(rpot0tpxoiieiadfs emn p u0trxrxf3oytlmD  uesl( t2uoxr3iydoptemncs sfs2raumooo0apen f3ildlaDumuvp (0 eerxr io1opDelu o;s)texmirpou4lm elfvt (fs2rr(rpno4oeto octysfa2el(vp (0trtrxr iytla  auvs s srxmxm3oydapt lnei s)s2tm(m ;t0tltoiocild m2ul(vo u0artrio3tatopt aues;(0 exrimpio4alt mivia(f rum(rpot1oetnmfctldla2rmnms;t) rxrir3tydopD  nei;(0trxm(r oy4oltn nvt (  2ua(r ot1aexn i3ildla2rmu s (0tlxoxr3oy1fatelnvo ( s2xoxrpno1lpt  feia()aDumxm ;o1aexnioeiydfs2um( ont4artrmoctodlate n s s  euo(m3iodole mivilt sDtrxmp;o0tlxo ocilslsDuau o u) lenxf oytoat aivolt0trxoxrpno1lm elfctlt artru ooo4alxn i3tadfmDuan snu) exnmocta1om   ivs s)tetmxo oo1omt lnvs ()srrm( pnt4tptnmf3tyt m2el(mo;u0aetnmr3oo1oa raneo;s  rurir3ny1alenlfvias)s2rr(moot0olxniicildfa2rlnvo u4tlenmo3iodop   ivsls)srxo(opou4am n neiat a2tax oou1oltnmieiyt s el( p t4artrif totlpt  i ol(0srxmxm oy4om e ivtl()s2uax p;u4oleomociatls2rau onu0 lxomf oodlp r nvolt0seumimpnudlmt  icsls aruaxroot1aleoif3iasfa2uau o (0 lermfcoodlm  lu sls  exo(rpoy4optelietlt  Dtrx pnu0oeeoifeias mDrlnms;t)artrxr ia1fm rlnvsl(0srxo(rpiy1lmeelnvsasf rrr( ono0apen oeiytfaDrmuvpn(4 ltoxo3to1omtean ols t2xmxo3nodlp nmiei tfs2rrx pou4aexn oeiasfs eau s u) lerxfciotfpDr u sl(  rur(m3oo4amtelnes (farum(r oo4tpxoiociys m2eauvon(4 lerxo3tytopte i s;s0t2xoir3nydape mfet s)aDraxrpnt0tlen o3iatfaDrmn snu) eenxf3todlpD  neo s0 eumxm iy1om  mnetat  2rmur oo4alxoioeiadlaDrmnmont) ltoio oy1la  ln s;s0 2tmirpoudal e ivil(f 2tru pno0aptnmfeildfs2rmuvont)areomo totomDeai il( srto(r3oy1ll  lnei t) Drrxroot1oexn ociatfa2umn on() exnio3ta1fp  lneil(0 rxrxo ny4lm nmnctas  2uaur ;t1tpe ioetyd s2elnms ()tlerio3oo1laDeaneolt) exrirpoodamte ivias a2trum oo1tee  o3ilsfsDranmo;(4texrxr3ia1oaDeanvi s0srtoir nudam elfvs t aruax  ot0aexomfciys aDuanms u0 rtnxfciy1fatrau i t0 euoim oy1omtnlncilsf Dtrum ;o0oleomieildlmDuanmon()trxrmo3ia1lm e nvi ( srtrimpoy4ale  fet () Drax pnt4tpen o3iltfsDrmumpnu0tltnxr oatlmDe uvs ()sexrio io4lm elfesat)a2tmumoot0oet iieiyd m uaums;t) rtnmo iadfatrauvo s) exoir3io1alenmfcsls)aDrr( pot4tpeo ieiadlm2ulnvsnu)tlxnmf iatfatranvolt)t2xmxmpiodomee ies t  Durx ooo4oltoifciasla rlumo ()alerirciodlmt  nvsl()s2xoio iu1oltemictl( s2uax oot4texoiieiadfa2ra(vp;u0 rxoifcio1lat  uvo;t0setrxo iy4om n nviat arumurono4oetn i3ilsfsDeluvonu) etrxf tatfa rlnes t)t2xoxrpno4amenmnct ( aDrr(rpno0oeeomi3tatfaDul( s t0tltoiociadfaDe uvslt  2xmxr3no1amt  ivtlt) 2rmu ont0tpeo iciadlaDea(mo;u4 lxnxocoatoat  ieo;t)t2xr(r3ou4lmtnlfvtls)srtmx o;t1oltnmocild m2el(mp ()aeermf iadfp  auvi t seuoim ny1lp e iei sf rumur ;o1openiociatlmDelnvp;u)tltnmo3tytomt  ivsls0t2uoxm nu1ape lnvtlsfarum(mpot1ope mfeiaslsDemu ont0artnxr oydfm  lneo;t0s2tr(mpiydam nlfetatfa2rmu p;o0alx  i3iydfsDul(msnt)tlxoxr3oodla  auvi;t)srum(mpnudopenmfci sf Drmxmpnt0texo oetydlm2ul(mpnt0aetomr tytfatranei;s) exrim3iudap n icil(f Dtrxrp;o0opxnmf3tat a2emump u0 lxomo3oo1laD aieo t sexoim3oydopeelneia(  Dtm( onu1tee ifcildfsDea(mpnu)trerircio1lm elu slt0sexmxopio1op   ivtatf rur( pno0texoiictydfmDelumsn() lermr3tytlatraivilt0 2tm(opno4oltemiviasfa2tmx ont4tetomfciaslmDem( snu4artniocoytomtrlu i;t)tetmim ny1ol  mfvsl( s2tmu  ;o4teenioeild a2ranms;(0altoif3iydfp ranvil()tetoxr oudope mncil(f Dtaxm oo1aet  icilt m rmnvonu) exoxoctytfpD au sl(0 2xm(o3iydamt mnvt s) ruau o;o0teenifciydfaDua( o u4alxnir todoa  auvols)sexmiopoo1op elnvi t a2raxm ou4oexnmoeiatfa rmumonu4tlxomo3iotoa e ueo;(0 rxoxo3nu1oltnlictat) 2urx  ot4olxn i3iad a2ulnmpnu4 reomf iytlateli ol()s2uoio oy4lmen fcta(f Dtaur ;o4oleoii3ilsls um(vo ()arxoxr3iotlpDraneil()trur(mpoy4llenlneias)arrmurpoo0alenmfciyslsDraump u4teermr iodfmDr n s s0 rtr(rpiy4ome lnvias  2tax p;u1oltnmfeiatfa2ul(ms;t) rtrxr3totop ran i ( t2uoimpoo1amte nvilsf rumx pnt4tetn iciad aDeanvp;t0 leoircoy1oa rauesls)s2tmio3ny1am   ivsat) rra(mpoo4aleoifctytfa uaumon(4tetnmo tytom r uvo (  rtr(opnu4ap  lfeia( srtmx  nu4aex  octlsls2ua( p ()texnxr oatop e u i (0tetm(o3oudop nmfei sfa2uau  nu4olt if3tydfs2emumo;t0 rxrmfctydoa elu i (0srum(m iy1amtnmnvs t srtmur ;u1tee ifetls a eaumo;()aexrxf3iadop   n ils0srumxr ny1alt  ivi s)aDtmx ont1ale ifciytfs elnmpn(0aetomr3oydfmDe u i s  rtm(rpnu4alee fcsatfa2urumpoo1tpxomictatfm2umumont0areoiocoodfat anvo ()t2uoxopio4opee nes s  Durum oo0tetnmoeiysls2elnmpnu)alenxr iotlaDelneil( sruoirpnu4lmtemfes ( artm(r nu0ope  ieiadlsDuaums u) rtnirctytfpDe n slt0t2to(opiy4om n nci t) rur( pnt4oet ifetls m2uanmo ()alermocoadlpteln ols)t2trxm iydlmtn fvta(f rrmurpou4oee iociytlsDrmu p;u) rxnmf3ty1optr n i s0s2xoxr ou1ol nlics () 2trxmoot1tltomoetydfa2ua(vp u0 lxomf io1lmt  nvs;t)t2uoim3iu4omee ieslt)a2tr(  ;o4apxnmicildfaDul( p;(0teeoxo to1la  luvsl()texr(mpoydome  fciat  2taxr ot1oexoioctatfs eau p;t) rxrxf3iatom   i s t srxoimpiydlpeelici t)srtmurp;u0tlxomo3ild m2ranvpn()trtomfcootfa rluei;( sruo(o io4om  mfvtl()sDtm(m ;o4aeeomo3iytls rmuvo;u)trtomo to1om e i o;s)t2toim3oudlme livsat)s2rmurp;o0apenioctysfaDrm(vp t) rxnmf tytla raueilt)s2tr(r iodllenmiesat)srua( pou0olx  i3iydfa2elnmo;(0 rxoxoctadopDr n o s0s2xo(r3no1op nmnvtas s2tr(mont4olt  f3tatlm emumo (4 ltrmf tatfat  nesl(0setmim ou1llenmicsa()arrrumpou1alxomo3iyd sDul(msn()arxnmr io1lpDe nvsl( s2umirpnodlleelivils)s2ua(r ;t0apeniietys sDrl( onu4teerirctytfate uvolt  rumirpny1llenmnesl(farrru p;t1olenifctysfs2ua(msnu4trtoircoytop ean ils0 rum(rpio4ap n ieiat  Dtr(mono4aee mictls aDua(vsnu)artniociotlm elivo s) rxoio nydom  mnctl(f rraumoou1tltomoctltlm2em(mp t0teenircoodlpt  ivs t0 rxm(r3ny1op elnesa(fs2rr(rpot0tpenmociltfa emumo;t0 ltnmo todlmDraueils0t2umiopoo1ll   fvi tfsDta(m ou4alx mieild mDeanmo;t0 reomf3tydomte nei;(  2toxm3ny1alt  fetat) Dtr(rpnt0alx  iciys mDranmp (4 etoxo3iodfpDrlnvs t s2urim iy1aptnmicsat)aDraur oo0tetomo3ildfm elnvon(4 eeomr3totoaD  uei;s0 exmxr3oodlleemnct t)sDtaum ;t4optomo3iadlmDemumpnt0aetoxf tadlm  aivolt srxoimpiodlmtemfei t s2rrum nu4tlt ifciytls2emuvpn(0areoxr tadlmtrli ols srurim ou1lm  mivsat) ruauroou0oexo octadfs ean s t) etoircoatfatrln s t  rumxm oy4lmtnmfcsas)arrau pou4aetnii3iydlm2uau o;t4aeenxoctotopDr n ols teuo(o nydam   iciltfarrrurpot1alxomociatlmDraums (0trtoif iydoaD luvsl(0trxm(rpiu1ol elivias  2raump;t1oetnmo3iasfa2eanmonu4 exnmr iadfm ran il(0sexmiopnu1ape lncta() rrmxrpou0tpto f3iysla2um(mo;(0aexnmf iadlptr i i s0sexrxm3nu4oltn ieta(fa2trx  oo0tpt mi3tldfs2elnvp;u4aetrxfctydla   n o;(  2uoir oy1al   icslt s2tm(m ;o0tet ifcilslaDua( o;t4artomf iy1lmt  i s;() exrxrpoudop   iesa(  2rmu  ;u4aetomicilsfm ul( onu4 exnmrciy1opt lneo;s0 2xrxr3io4ap  mivi s aDumu o;u0tltn octys m2ul(vp (0altnmr ootfpDeli olt  etr(m oydllen fcias  ruau pnu1tptomi3tytls ul(vp;() lerir3ootlptr neo () euoir nu1ol nmivtat srurxmpou0tltomo3iasfa ulnvpnt4 ltoir ty1fm r n sls  2xmxr oo4lleelfvs t)srtaxmoou4alto iciatla uluvsnu0 rxrxfcta1oaDrauvslt0 2xmiopiu4olen fct t arum(mpnu1oexnmieildla rlums () etnxrcoatlpt  i i t)t2um(o nu1ome  nctls) rumxrp;u0altnmictaslm umn p;() rxomr3iotfmtrlnei;(  exmir3oudlm n ncils arua(mpnu4tle  octyt m elump;(4 reomfciy1fmD  ivs (0s2toxr3iy1lp  lfcta() rtrxmono1opxn f3ildfa2emnvpn(0trtoiociadlpDeauei;s sexr(r oudlmenlietls srurxmp
\ No newline at end of file
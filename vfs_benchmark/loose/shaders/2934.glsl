@@ -0,0 +1 @@
+i slt0trxmxmpou4altnlivt (fa2trxmoot4oetomoetldla umumont)areoifcio1lat livi ()tetrio nodalee nes sf 2urxro;u0ole  fcilsls2eauvs t0 etomfciytopDrluvols s2tr(opnodape mnvsl(  Dumx ono0tltomicils sDrluvs t)trtrxf oydlatr n s;(0 2tm(r oo4oltn iviasf 2ra( pnt4aee io3tldls2umn s;u)areomrcoo1omDe n ils)trtoxopno4omenmivs s) rraxm ou4tpxniiciyt m2rl(mp;(4tlxrmfcoatfpt an i (  2toxrpnydamenlnesls) 2ua(  nt1texn i3iat s2rmumo;u4aexomociotfmt aueols  2toio3no1omtnlfcils srrr(mpoo0apenmoctadla el(mpn(0alxnxfctatomtelnvi t)t2tmxopiu1om nlieta( sDumu  nt4tex  o3iysls ea( pnt4 ltoif3ia1fpDe u s s)t2xrxrpou1omtn nct (f 2ra(ro;o1aex  f3iysfsDrl(vp (0areoirciydlatr i s s)srtmxm3nudame lfetat  Dumx oou1aeeo icildla2ranmonu) rerir iy1fmtrluei s)setoxr3ou1apt livs ()sDtaxr nt4oltn feiyd a em( onu4 etoxrcto1fp rln s;t0srtr(o io4ap   fvs s)sDtau  oo4oexomf3tad mDemumpnu4 rxrif tydfp elu s;t)seuo(o3oy1optnmnet t)s2uaxrpoo1aeeoiociasls ea(vo;(0 eenxf iatlatr u slt)t2tm(o ny4am n fet t)aDuaur ou0alt ifetad sDeluvs u)trerircto1faDelues t0 etrxr3iu1lmeelnctlsfa2tm( oot4apen fciytlm uan snt0areoio iatlmD  nvi (0trxoirpnudlmee nvta(faDua( poo1tetnii3ildfaDea(vsn(0tltnir3oadlp   ieo t)srxoim3io4amtemnct tfartmu  nt1tpxoifcias aDumumonu4altomfcoadlmtrlnvo;s  eumim iudomt mfet sf Dtaurpoo4tpenio3iasfaDulums;(0 eenxrciadlpDeau slt)srxmiopou4ope  fvtat) rrr(m ;t4apenmocilslm rlnmp;u) reoif3ta1om e ivi t)sruo(r3oy4ll emfesa( s2rrx pnt0tlxoif3iatla2ean s t) eeomoctytfpD  uvs;t trxmxm oodlptelieta()aDum(ro;u4aeen feiyt m em(mp;u)trtomo3ia1omDe ues () 2xo(mpny1lptn ics ( sDtrumoot1aptoifcildlmDulnmp (4 exrmf3iadoaDrai o s)t2xoxmpio1ol e ncs sfa2truro;t1aexomocias m emums t0 etnxo3iytfatelneo t0srxr(m nu1om e fei sf Dua(  nt1oeto fetadfaDem(vp t4areomr3io1omDranvi;(0sexrxr3nydll emivsat arur(rpnu1tetn fctys sDeaumont)trxnxo iatlmtrlieilt0t2xmxmpoodam emiet s srtm(mo;u1tpt mf3iltfa ra(vpnu4alxoir3oatfm eaieil()t2trxopio1ol   icsltfa2tr(r ;u0aetn i3tyslmDulu s (0texoifctytoptrlivs;t srxmio iu4lm n fctl(fs2umx  ;t4olxnmociyd sDum( o t)alxnif oydfpt au s s0trxmxr nu1al emfeiasf Dtrx p;o0oex iiciasfsDeaumo t)aetnmfciotfpD  uvo (  rum(r nudopt livt ( aDuaxm ;t4oee ioeiaslm2umump (0 lxrmfciytlmt au s;s t2uoxr3ou1ap  lfvtlt sruaxmpnu1aeto feiydlm umu s;u)texrmo3ty1lmtelivo;()trtoxo3ou1lmte ici (fsDrmurpnu4tptn ictydls rmn s;() ltrmr tydlpD lneslt)t2xoir oodapen fvs t srurum ;u1oexn f3ild m em(mo (4altnirctytopDe ieilt  rtrio oy4lm nmictl( a2tmxmo;t4aetnii3tls aDeluvpnt4alenxo3io1lm  lueslt  2uoim oydamtemnei s arumx  nu0aee if3tysfsDuanvp;t)arxrir3oy1om  lueo;() rtrxo iydlle mivt ()a2ra(r ot1open ociatla2umumsnt0tlenxo3oadlmt ln il()trxmio3oo1llt lncsl(farum(rp;t0oetn o3iys a2ua(vs;u) ltrmr3oy1opDr nvsl(0teur(rpiydom elies ()a2tax p;t1tltoiicildfm2eanms u4 etnmfcia1la r n ols0 2uoxo iodlpen fct (  Dtrur ;t0oet moetlsfm rm(vp (4teeoio oa1fmtran i;s) 2xmimpiy1altemfes t)arrm(r ou1tpxnmfeils m rlnmpn(4 lxrxr oydlp rlneo s tetmim ou1al n ieilsf 2uaur ot1tex io3iasfs uau snu0 lenmo3oadlpte ues s  exo(m3iu4ape  nei tfsrrr(m ou1alt  ietlsfs2umnmo u)tetoif ootoaDelivs;t  2uoxr oy4lltnlnes s)a2tm(mpot4tpxoioctas s2uan o u4 exoio3todop  auvo;s trum(m3io4op  mici (fsDrm( o;u0apen iciyt mDumu s;t4teenxo iytoaDrlueo ()t2urxo3io1lltn fvs t  Drmu pot1oee  oetyt mDuaumon() rtnmrciy1oa eluvi s srxrxr nydlmt  iet s  Drax  nt4olxoiociltlaDeln p u)trtrxr iytfate ivi;s0 exrim3iu1omen ivils) 2taumoot4aeeo fciytfm2rmuvs t0 etrmf3iadomD aivo;t0t2um(opio1ap e fci t)srtax ooo4oexo icias m2ul(ms (4aetoif oytfmDeanvi;s0srxm(o oy4om  micils)srrmxmoou1apeo iciyd m2el(mp;u0artnmf3totlmt  ivslt s2uo(r3ou4ap nmfetasfartax poo0oltoiietatfaDuan on(0 lxrxo3totla   i ilt) rxoim3ou4lpee ieia( s2umu ont1aleo fciadfmDeln s t)artrxr3tydomtelies;s0setrxo ny4ll e fes tfs2trxr nt4texn feildla rlnvon(0 ltoir iatfpDelivol(0 2toxo3oo1optelfcias sDtmurp;t4tex mictltlsDuanvont)texnio3oo1laD  iesls) rumxr oodaptelivilt)sDtaxmpou0openmociyslaDuaums t4 rerxocootfa r neilt0srtmir3no1al   nvsas sDrr(mpnt0apeo f3iadfs rmn pnu4trtrxo iotoa r i o;(  euoirpoo1amee ivia( aDtrxrpot0ale mociyd m2emn p;t4aetoxr iytoptrlnvsl(0srumxopno4amtnmfetlsfaDraxront4tptn iciad aDuln o;()tlxoxo ta1faDrluvol( s2tr(r iy1lpe livsa(faDua(r no1tlto i3ildlmDran pnu0arxrmfctatlat lueilt srtm(o3iodole miesas)a2urxmp;u1apxnifeiltfa2emumo;(4areomo3iydlmtelieilt) 2tmio nydlp nmncta()sDtaxr nt4aptnmfetyd m2el(mo;(0 lxrxr iatfatraies;s trxr(o ou1lltnmncsls)s2rmx  oo1opt io3tadfa2um( o;t) reomo iydfa  ln o t)trur(o3iu4lmtnmneiat)a2raumont4oltnio3tydlmDem(vs;u4 ltoir3oadomteaivi;s t2uoxr oy4ap   netat sDrru p;o1tpx iieiydfaDulumo;t4 renxf3iydfmDr ivs;s)trxmir nydlmtemieta()aDrr(  ;u1aptnifctytfm eauvp;u4altnio tydla e i i t  etrxm io1lm   ict s)aDtaxm nu0oeeoii3tyt s umuvp t0 lerir io1oa r u i;s) 2umxo iy1alt micslt)aDtmurpot0tlx  feiyt mDem(vo;() etnir oy1la   neilt0setmim3oodape lnviat  2raxmpnt1alto fetys m2eaump;t0 rxoxr3iodfa rln i s0 rtoxopnodlp nmici t)srtauro;o4aeenif3ildfs2elnvsnu0tlenioctodlaDe u s;(0t2umxm nydam e neiltfsDumxm oo0apx  i3iadls2el(mp t)artrxfctadlmteauvi s) ruo(r nudllt  net tfsrur( pnt0tlt io3tldlm rm( s;u4tlermr3oytfm e uvs t0teto(opio4aptemict sfsDtmum ou1tptoiiciysla2eau s;u0aleomr tadlpD livolt)truoxm oydlm n neil(faruau  nt4tlxomietldla eluvon(4 eermr3ootfm e ueilt0t2toiopiu4lm   ieslt) rurx o;u4ape  ociadfs2eau o t)tltrmr3io1op  lu i t) euoio oy4ole  fct sf ruax poo4olen octltfaDuauvs (4altomr3iodlp elnvi;s)t2trxo3iudlmt  nvtlt) Dua(  ;t4oltn ietadlm uanmont0aetrxfciatopt lnes t seuoiopny4amteliesl(f Drmur ;u4aptn ieiysfm2emu p;u4 rxrxrciadopDeauvs;s)trtm(m iy4omtnlfct tfartm(  oo1alt  i3tys sDea(mp u4alxnmfcoa1fatrlueo;t t2trim3no4lltelneta(f ruaxm nu4altomfetldlm2emnmsnt)altnif oatfptranei;s s2xmim oodale  nvtlsfsDtru ont0optnmfciysls uaump;t) etrif3tadfaDe ieo ()seumir3ou1op emict t)a2umur nt4oltnmociytfm ul( pn()aexnir3iotlp eli o t)tetm(mpny1om emictat  rraumont4alxoifeils sDeaums;t0aleoio tytoat  ueols) 2trirpnodome lictlt  Dtau ont4tee iociadlm rlu o;(0alxnmf3ootom   i s t)truoimpnydll nliet sfaDtm(rpoo1altnifeildfs ra(vo;u4teenxo3ia1lpt ai olt trxo(opoydlpenlncs (fsDumu  ;u0oee mfetyd a emn p (4altnir3ty1fmte n ols)srxrir3nu1lpt lnvs s  2rruro;o4tptnifctlt aDua(mp t0arxrxo3iydla   ivo;s0srxm(mpoy1olt mivsl() Dtmurp;t4alx mocilsls em( ont)aetrio iadlmDraivslt  2tr(mpiu1ll  mfvil( artmuro;u4altn o3iys sDeaump t)aeerxr3totop  ai il()t2uoiopiu4alt mivtl(faDra(root4ape  feiat a rmn s;u)aexnio tadfmt livs (  etoxo3nodlm elnes ( arrr( o;o4texomfctlsfm um(mon()aeenmocoa1opDrlues;s0 exrxr ny4lme livsa(f 2tru  ou0tetoiocild sDeaumpnt4 lxnxfctodlmDrln o;(0s2umirpoydameelfeslsf 2umxro;u1tpx ii3iydfs2ranmp t)trxnmociatlaDrlivi;(  2umio oodllt  feslt)artm(r nt4apxoio3iatfa ran snt0artrmr oatfa e nesl()srxmirpiy4lm elnet ()srtmxm ;u4ope  ocilsfm el(vo u0aeenxfciadfat  ivslt0s2xm(o3ny1alt lfcia(  2tmxm ;t0apt if3tls a2ul(mo (4aexrifcoy1lmD ln i;t)t2trio oo1om   nci s)aDuax o;t1opxomi3iatfs raumo;t4trtnmf io1lm   ueilt  ruoio3iu4llt lfeslt) Drm(m ;t0oltnmoeiasfs rlump t0alenxr oadlp raieils0srurim oo4amtelies tfaDtmxm ;u1tpt moeiadlmDuln onu)arerir3iy1omteln o;(0trurxr3nodll  lieilsf 2tax ont0oetnmoeiltlaDuaumo (4aexomo ty1latelies;t) 2tmxmpoudamenmietas artrurp;o4aetomfcildls2eln ont0tlxoif io1fpDrlu olt srxmxo3iu1aptn iesa(faDum(m ou0alxnmfetltfaDum( o;u4 rxrxo tydoatelnvil()tetmio3iydoltelicsls aDumxrp;u0oexomoeiat m2rm( pn(4 lxomr todfateau s;( t2xrxo oy4omte nvs t a2uau poo0tlenmi3iytfa ulnvsnt0texrifcootla rai o;( t2urxrpiydomeemivta()sDumumono1olx io3tlsfmDrl(mp;(0aeeomr3ta1lmteli i;t)tetoxo3io1amte nei (  2rm(  oo1olx moeiatlm ul(mp;()aexrircoa1lp eai ilt0 euoiopou4lp n ivs s srraxrpou1ole  i3tltla2rmn snu)teenirctadlptelu i t s2trim iu1optnlnvtasfa2tmumo;u1aee if3iasfm rmuvo u0tleomr3iydom r ueo s)texr(mpiydomte nvi s) rumx p;o0tlxoioeiadfa2rauvonu0tltrmrcta1fpDr u i;t) 2uo(o iu4omee fvt t)sDtmurp;u0olxnif3tasfa2ea(mp;(0aeenxf3tatfaDeauvo;t  2xrim iy4apt  nei tf 2raxmoou0optnii3iyt m ranmo (0 rtoxr3oatfp e ivo s) exm(r iy1am   icsa( s2taur nu4olen ieiyt mDeln p;u0tlxrif3oodfaDean i ()s2xmxo3iu1apenlnvi sfsrumxm ot4openmo3iaslm rln p;t0aexrxocoatlm eaies;t) rxmiopoodom  mivtat  rrr( o;o4tpxo fciatfaDraumsnt4aetomo tydfa r n o;s0 rtm(opou1amen nci ()a2ra(m nu4altnioeiasls2rl( o t) rtnmf3oatom  ai o;t  rumxmpno1ll  lneilsfsrta(  nt1oexoifcils mDra(ms (4aeerifcty1op e nvo t tetoio io1apee feil(farraxmont0tex  fctlsls ul(mo t4aexrxo oo1lmt  nvs;(0srtrxm no1amenmietas arurxm ;o4alxo o3ildlmDemn o (0trxnxrcoa1lp  lieo (0 2ur(r3oo4alen nvt ()srtm(ro;u0aetniociasfm2eau pnt)trxnmrciatfat lnvs t)t2toxm iy4ape  ivsa( aDrmx p;t4opxomoctad a rmumo;u4arxomr3tytopDrau i;t)t2tmim3oydal n fvtatfs2tr(m ot0alt ifciytls2ea(vsnt4 ltrxrciodlat livo;s0s2xoim io4op eliei (f rtrxmpou0oet mietltfsDumuvo;t0tlxrmf3todoa ean s t  etoim no1opeemicsl() rum( pot0opxo fetatfm eln snu4tlenif oatfmDe uesl(0setoim3no4ll  lfct ()a2uau  nt4tpt mietydls2umnvs u4 rxoxo tatlpDeai ols0s2xo(rpoydllt lnvtltfa2trxrpoo1alx  f3iaslmDel( pn(0 reoxo3iatfmDeanei ()trumirpno1ll nlivt s)s2urump;t1olt micias s2rmuvsnt4 rtrifcoytop  ln s (0s2xr(o3nydopt lictasfsDtm(  ;u4tlxomf3iyslm emuvsnt4trtnio ta1fmte uvilt0 2umxr nu4ap elfctatf Dtr( o;u1tpenmfctydlm uluvs;() etrif oadfp rli sl() 2tr(m3iy1apt mivi ()s2ur(mpou1opeo ietldlm ea(vp t)artnxf3iadlmDrauvilt0tetmxo iu1amenlnvtat) rta(  nt1oeeoifctys a2eaumsnt)aeenmr3tadfaDelnvo (0 euo(m3ou4ap   fctltfs2um(  ;o4tleomiciysfm2el(msnu)trtrmoctatopD lnvi;s)setm(opoy1ll  mnetl( a2rmu p;t0oetnmoctadls umn pn(4 ltnio iatfateluvils0teumxm nu1lmt mfeias)arra(m no4apeo o3tls sDulumsn(4 renmoctatomDraies ( setrxm3iu1ape  ies s srtm(rpoo1apxniictatls umn s;t)artoxrcoatfmt an sl( seuoxm ny4ape lnvtls) ruaur ;o4aptn f3iasfs ul(mp;u0 rtnir oo1lmtrlues s0setrim ou1lltnlnct t  rra(rp;u1aeeo iciytfm emums;u0aeenir iytfpteai i ()t2tmirpiu1ap nmnetlt arrrump;t4tlxoioeiatlmDemu o;t)altnmo iodoat livo;t0t2xmxrpny4alen fcs t sDtaxm oo1oltnifetadfs2eauvo (0arxrxf ootfa rlnesl(0teurim oodalenmivt sfsDtaxm nu0oetn i3iyd m ra( s t4 rtrir oy1lpt liesls  rtrxo ou4ape lfesat arua(  nt4aeeoioetytfm umn o u0treomo iotop e i s t tetmim ny4op  lfcils  2taxmoot4olt mo3ils s2ulnmo ()trxoircoodlpD lnvo ( texoxm3iy1ol   nvsa( sDrmurpoo1aeto ietydls2emuvs;u)arerir ia1lmDeln s;t)trxrir3iy4amtelies s)s2tr(m ot4openiiciad s2rauvs u4 leoxoctotfpDelnes;()trtmxo oudame lnviat sDum(m ;t1aptoifeilsfmDemuvsnu4 ltrxr3oadlpD aiesl( tetm(r3iodolee net (f 2ra(  oo0alenmoeiaslmDuln pnt)trtoxr iatlm  livi;()setrxr3iodolt  iet (  rtmumooo4apenmo3tadls2rmnvsn(0tleoif3to1opDe iesls) ruoio3iydope lneiatfa2rrx  ou1tpe mf3ilt sDem(vs (4 ltrmoctadoa r uvs;t  rurio nudameemfvslt)sDra(m ;t1tet ioeiysfmDelumsnu4trtnxf3iadomDrlnvs t srxm(m3nydomtnmfetl()a2umum ot1aeto ociasfm2rmn s ()aetnxo oadla rlnvo;t0s2uo(o3nodlp elfei t  rrmumpot4oex  ieiat a2rmuvs t)aeerif iotopD li olt0 rtm(opnu1lltnlivt ()s2rr(rp;o1aex  ietas sDul(vo;t) lerir iytlp  liei (0 2um(opoy4lpe  fvtl(f rrmxmo;o0tpt mieiytlmDulnmo;(0 rxomoctodomDr u i s s2xmir ou1ap e ivi ()aruaxmo;o0olenmo3tldla2emuvp t0teeoircia1fptraivo s)truoimpou4lpe lfesl()srtaumpot4aet ioeiltla2ea( o;u4trerio todla  auvsls tetrxrpio4op  livt s sDtr( ono0tpenio3ils a2ranmont)aetrir3oytopDeaueil( texoiopnudol nlfetas s2trump;u1olxomi3iasfa2um(ms t4aexnxf3oy1lpDe ueol( t2xrim ny4omeelici t)srtaxmp;t1alxoioeiatlsDum(vs t)aetoxocoydfptraues ()seum(r nu4lp n fvtl(f 2umumo;t4apt  oeiat a2rm( s;u)trtnxf oo1fm   nei;()sexmim no1ole  fesat)a2rrump;t0aeenmf3iytfm2elnmo;t0 eeoxfcia1lpt lnei;s)texrio3iodlm nlfesasf Drmumont1olx  oeias s eauvo ()areoxo3oodom rauvs;()trtoxr nodlmeemiet (  2tm(r ou1apt mieiysfm2uanvo;u0altrifctodfaD lu o;s t2xr(r3oy1amen ivtltfs2rm(moot1olenifetlslsDrauvs t) rxomf iatfm  livi;s)seto(r3oy4lpee fcs t)aDum(r nt1aex mfeiytlm2el( pnu4 rxrir iytlaDeluvil(0trtm(r nydolee fesas)aDraxmpou4ale mictlsfa2emu p;t0aetnircta1fpDe i i;t) 2um(mpiodll   ictls  ruaurpoo1tlxo ietlslm ran p t4 etoxr3tydfa rlu sl() 2tmxm3ou1ol   icslt sDrm(rooo1apt moeiadfsDua( s;t)tltnmr3oadoate uvs;()srxrim3oo4llt mfei sf rrrx pnt0aexn fciyd m umnms;t4 rxrxo3ootoat lies;t0 rxoim3ny4am e ictasfs2trurp;u4oex iocils m rm(vo;t0aexnxociydopD ln ilt srxmxo iu4lpen iesl( aDtru pot4teen o3iydla2rauvp t0 lxomo3iy1omDr u o ( s2tmim3oy1ape mfctlsfs2taxmp;o0alto i3tltfa ea( s u)tleoir3tatoa rln ol( seuoir3oo4lm nmnvt sfsDrr(  oo4texomoctytfm ea(vsn(0 rtoxf3ootlmDeanvs;t)tetoirpoodlltnlfvia(f 2rau oou1oleomociatfmDeauvont)treomrciadopDelivs;(0s2xoxo nydll  lnetlsfartaump;t0teenmf3iydfmDeauvp u4aeerioctotom  livs;t  2xmxo ny4oleelncsa(f 2rm(mono0olx  i3iysls2umu on(4artomo3iadlpteli i s0srtriopiydamtnlnci s)s2umumoou0aptnifctltfa rlnmsn()aeerirctotfaD lieilt srxo(rpoudop   nvtltfaDurxm ;o1alx  ieiys sDrlnms;t0 rtnxf3ta1lm elnvolt  2xr(r3nydamte fvsa(f rtmurpno1tpxomo3iatfmDelums (0 exnir totom  lnei t t2xo(r oodom nlfvtlt s2umx oou1teto fciysfs ea( p;u0artnmr3iatfmt anes;t0trxmxr3nu4ol emictatfaDrrum ;t1olt  f3tatfa elnvpn(4tltomf3oy1oa  aivo t t2ur(o iu1optn fcia(fa2uau pnu4olto iciytfa2uau ont)trenif oa1fa  lnesls0seum(o3ny4openmnctl()srrm(mo;o0apen oeiytfa ra( p;u4 lenmr oo1fptrlneols t2xoir ou1ame mneias arur( pot1tex ioeiyt sDuan on() rtoxr3iydlateau i s0 2to(opiydom e fvsltf rrmumpnt1tpx mietytfm ean o;t0alxrmfcoa1laDraneo;( setr(rpnydlleelnciat)sDrmumoot4open ietytfa2elu onu0altnxf3oatlateaivi s)t2tr(r3iy1opee ncsl( a2tmumpoo1oeenio3tadfa ua( s;u) exoif3tytlpt li il(  etmimpiy4al   fetlt s2urxmpot1aex iictltlm raumo;(4aexrmfcoydop eln i;t teurxr ny1ll n net sfsDrm(  nu1oet moeiydfm rlnmsnt) lenxr iy1lm eaueols0trtmxr3oo4om eliet (f 2urxr nt4ole  oeiytfaDel(vs;u0altnxocio1lmt  iesl(  etr(m ou1opeemietltf rtrxroot0apt  fciasfm rm(vs (0 rxrmo3iatfptraiesl(  exmim3oy1lp nmictat  rra( p;t1openifciatlaDuau o u)alxnxf3io1opD an ilt)s2urxo oudaltnlicslt)s2ta( p;t0tltoiietysfa2rl(vp (4alenir3tatfp ean ol()srtrim3nydlmtnmncilt a2rau  ot4tlto ieiytfa2el(vp t4aeeomoctytfat anvs t) rtrxrpiudllenlncsa(fsDrau  ou1oltoiieiad m2rlnmsnu4 etnmf3oy1omt ln o t)s2uoxmpoy1ol n fct tfsrrmum ot0tetnmi3tltfa emu pnu)aexrmfcoatfm e u i;t0t2xrxr3nu1omtn ivtat aDuauroot0tlt mfetltlsDel(vs u4tltniocoo1faDeluvi (0srurio3no1op elnvsl(  2um(root1opxo f3tatfmDuln ont)trermfcoodoa raueolt s2ur(r oodlm e fvtlsf rur(r ;o0aet moetydla em( pn(4aeenio3tydoaD an o s0 2ur(r oy1lltnmnesl( sDuau pnu4tleomo3iadla2ulnvp t) lxrxr3iy1oat aiei;(  etmirpno1llt  ivsatf 2tmxrpoo0texnmf3tlt mDrln p;(4 etnxfcoy1lpDelues s0texm(rpoy4lleemivsat  rtmxr no4oeeoiiciyd a2rmn s;(0trxomf ia1la eln i t0trurir oodlp elfvt t)sDuax  ;t0olxniictys s2umn o (4arxoir io1fm  aivi;t s2xoimpoudlme  nvtls srrr(mpno0ape ioetadla rlnvo;(4 rtnxfcio1fpD livol( trto(opiudol e fvt sfs2ra(mp;u4oetnifciat sDuln snu4arerxf tatoate nvols0s2ur(o3oo4aptemncilsfs2tr(  nu1tlxomi3ild a2emu p;t4arxoif oytlmtelieols0 rum(m io4lmee ictls)aDuax o;o4olen iciatls ulu o;t0arenxf iydomteanes () 2tmxm3oo1opt  net ( sDtmxrp;o0tet  ietatfm2rmn onu4teeomr tydoa raueil(0trxrxo3iodlptn iciltf Drrxmpou0aee  ictytfa eauvs;(0aeeoxo oatop raueo s0trxo(m iu1aptn ncia()s2rmx oou0teen iciaslm umn o (4tlxrxo iotfmDeanvs t seuoiopoodapenmiei ( sDta(  no4oexn ictat m elnvonu0altoxr iytfa r nvi;s)setm(o3nodol e ivi sfs2ur(moou0oexn oeildlm2uaump;t0treomf tadfmtr i o;t) euoxm3io1llt  icta( a2rr(m ;o0tetomociatfm raumont) lxnxo3tatop e n s;t trtr(rpiydapte ncil(fsrraumoot0aptoioeiatfa um(msnu4arxriocto1lp rlneilt truoiopiy1llt  fvsat)sDrrx p;u4apxnmietltfs2um( pn() rxrmociydopt  nei s0 rtoim3iu4oltemivslt arur(rp;u1altomo3ildfaDrlu onu4 ltrio oatlmteauvs () eurir oo1lpte fvia() rrmumpno1aex mfctatfs2em(vs t)teeomf todfm  ai i t)texmir3oodlm nlivsls arurxm ou1tpeoif3tytla umuvo u4tlxoif3oydoaDe nvo t0 rtrim io1oltn nctas  2umur ;o4ole if3iyd s umnvo;t0 rxriociydopD au o t)s2xriopiu1lmenmfctat)a2uaumpot4aexo o3tltfaDrauvo u4 eerxoctodlmtrln sl()seuoxrpiy1om emncs s aDtr(  ou4oltoiictltlmDeluvp () rtoxo tadlaDr i sls0s2to(r nu4omt mfvs tfs2trum no4olt mfctatfs umuvs;u4aeerxo oadlptrauvo s) rto(r oy4al   nesa( sDtrxr ;t4tlen ictysls elu snt0 lxriocoadom e nei (  2uoim no1aptn nes ()arurxmpou0teeoifctatlm2rln o;(0 etrio3iadfmDrau o;t)s2umxm3nydlmtn iet sfs2rrxmp;t4tpenmf3ias s uauvs;()arxrxf oo1om r n ols0trur(o oo4lpeemnvi (fa2ra(  oo4aexnifciysfmDumump;() rtoxr iotfate u i;t) rxoio oydomeelfcslt)srtrxmpno0aexnmiciltlm um( s t4 lerif3oa1fatraivs ( trxo(mpiudamtnlncs (faDrm(  no4tltoii3tydfsDem( s t4trtnxo tydfa eaues;t  rtoio oo1opeemfcslt)s2raxmp;o4altomfeiasfa2rmuvs;(4aleoxf oatlmDr i s s0 etrir3oudomtelfeil(fs2uru  no1tex mociltls ran p t) eerio3tytfmDeai s (0setm(m ou4ole lnci (  2rm( pot1alt moctltfmDelu pnu) lxoir3to1fate ieo (0teumir3oo4lmtemncilt)s2ur(mpnu1alenmi3iadfa2uau pn(0 lxnir3iydfp e ues t trto(o3oy4lptemivsl( a2tmu pou0alx if3iatla um(vp;(4tlermr iydla elnei;t)s2toxm3iodlle mivslt) Dta( pot1oet  feias m2ea( p;u0 leoxr oadfat an o;t)seuoiopoy4al n fcsl(fsDur(  oo1tptoiietat a ua( s (4tlerxrctytomt an s;s) rtmxopoudap n ivtl(farua(mpnt0tptnmicildls2ranms t)artomr tytfa raivs ( texmxo nu4lpt mivt sfarumumpoo4aetoioctatfa2emumo ()trerif tytlpt lueo t0 rtrir3oo1al e fvtls) Durumpno1aptnmociytla2umuvpnt)teeoio3iodop raiei;t)s2xoxr3nodam e ietl( sDrm(rpnt0teeomi3iasfm2rmuvont)texomf oydfpt livsl()trto(o ou4lp   nvs ()aDum(m nt4oleomfctyslmDemnvo;(0artrir ty1lpteliei (0teuo(opnu4optemictlsf Dumx pnu1tpto fcild m ua(vpnu) etnxr3totoat aivo;s srxoimpiydlm nlivilt sDta(rpoo4tptnmfeiyd s2umn ont)arxrmrcoydlatrli o t0trxr(r oydol   nvs ( sDrrx p;u4apxniietadfs2ra(mo;t0aexrmr3iatfp eaivi s)seumxopoo4ome  ncsls)aDrrxr oo1tlxnifciadla2elu p;u) lenxo3iadla r iesls t2umxm3nu4llt  iei ()s2rr(root1oee  fctasls2uau p t4trtoxrcoy1lmt aivslt0tetmir io4ole mnesas sDrmx oou1ope  iciydlm um(vo u)aetniocto1la rlieo ()teuo(m iudap   ncilt) 2tm(  ;t0olxoii3tltlm rlnvonu4texoio3iotlmDr ivo;s0 2uoxr3oydom  miei t)sDraxrp;u4oetn fctas aDeln p;(4 exrxocoy1fatr i i;s)sruriopoy1lm nlici t sDtmxr nt0oeenmietyd s umu o u0teerir oytoa eaies ()t2urir iodlp  mfesltfs2rr(m no0tet  oeiydlm2umnms;t) rxnir oodomD  uvi;t) eumxopio4omenlnvt (fa2rmuroou0tlxnmo3tytfs2umnvo;() rtoxf3todop eanei s  rxr(r3iu4am  micta( srta( o;o4alt ioeiadlsDrl( onu) ltrxo tytfpteli i t0setrxr3ny4opte fvsa(fartr(roou0aexnmfeilt s umu snu4tlerxr oydlaD  u o;s)texoxr oo4ol   ivt () Durx  ;u0tptnifeiad aDeauvpn(0 rermociatlmte uvil(  2toiopio4lpee iei t)a2uaxrp;o0texnmieiytlm uluvo u)aexnif3io1lptelu s;(0trtmxm iu1lltelneia()arrrumono1apxo feiasfs ul(vp;(4 etomrctytfm r u sl(  2xr(m3nudolt lfvia(f rrau onu1open f3ildfmDra(vsn()artnxf3oadoptraieils setoir3ny4lm e fet sfartrurp;u4alt mfeias a2ulump ()tetnir3oatfm  aivol(0 2to(mpnu4lp n fet ()srtmur ;o1oetn octldfm2ea(vp u)tetnxrciadfaD auei s0 2xm(m oo1op elicsl(fsDua(ro;u1apto i3tatlm em( pnt0altoif3oytfpDraueo (0 euoiopiy1lmtemicsltf 2tmu onu4tlen i3tys s um(vp;t)tlerxrcootlm raivo t  eurxrpiu4lpe miesa(f 2ur(monu0aptn o3tydlm2rauvpn(0altoiocootomt an ilt0t2uo(m oodlm e fci ()s2tr(ro;o4openmoctls a rlnmon(4 rtoir3todla elieols)t2toio iudal e feil(  rurx  nt1aptnmfctatls emnvon(4teenif3oydlaD auvi () rxoirpny1omeelivt (fa2uaumpot4olx mieildfs2umn o (0altrmr oydfatrlneo t sruoirpiu4olt micsltfaDua(m oo0oetomo3tydlsDumnmo u0artomo3totfmDe u sl(0 etmxmpno4om nmnvt s) 2uax  oo4oleoiieils a2ran s ()teeoxr iatfatr i olt)sexo(o3ny4lm nmivs tfaDrm(mp;t0olx  f3ils s rmnvsnu)alxnmo iotfm rauvil( sexoxr ny4lpe mictat srumu pnu1opxomf3iysfs ean on()aexomr3totla  au sls0 rurxm oudape  net ()a2uau pot0optn iciydfsDul(vo t) rxoio3iadoaD an s;t0setoir3ou4omen net s) Draxm nt4tle  feiydfmDrl(msnu0texrxf oydlpDr i s s trxrxo iu4om e ieilsfaDumu oot4open feiyd a umnmo u) lenio3totfmDrlu slt)srxr(o3nudam emivtat) rtruroou1tpxniietytlmDran p (4texnir3ty1opt aieols0s2uoxrpiy1omenlfesl(faruau oot1olx iicias m2emu p;()aetrmr oa1laD lu i t)t2xmxo3nydllee icta() rraum ;u4texomfctytfaDuanmo u4trtnxo3oydfmtraivo;t)seto(opnodlpen ivi (fa2rmx ono1aleomocildlsDra( s;t4trtoxr iodoa rauvs;t0 ruoim3nodomeemivi (fsrurxm nt1tlxnioeiydfm eluvsn(0 ltoxr3iy1oaDe ivs;s t2tm(m3oy1altelies sfs2rmxr ;o4tptoii3iad aDea( o (0 renio3oy1fp e neils)seumimpou1olt  fci tf Dtru  ot1aleoiietasfm2elu o u4alenio3tatlpt livi s0sruo(opou4aleemies ()aDtrur nt4opxnii3ilsfmDrlnvpnt4aleniocia1oa  luvilt0 rxr(opoy4am nlietl()artrxrp;u0oet ioeiydlm um( s t4aetrir3oatfpD auesl( s2uoxm3iy1ap emneslt)sruaxmpoo4tle mo3iadfa2elnmp;u0 etnir oy1oa raueols) 2trxm no1om n fvsl(fsDrau  nt0apxo feiasfs2uan o t) lxoir3to1opteanvs s  rtoxrpnydomee icia(fsDtrxm oo4tpxoiiciydls ran o (0aexomf io1fmteaies;t)texr(r iudllt mncsatfaDrrxmpot0tpe  ociltfm rmuvsnu)treoxocoydfa r n il(  eur(rpnydamt lfvsl(  rtm(  nt0tlt  feildls2rlnms t4trtniocoadopDr uvo;s0sruoxrpnu1aptnmncils) 2tm(ro;u4oeeo octadfaDeluvpnu4trtoxfcoadlp ean s t) eumim3nydamtnlnesa()sDtmxmpno1tpx mfetyt m2eanvpn(0 etrir oytfm eauvi s srxrio oudoleelies tf Dta(r oo1ole iociydla2em(vsn(0 etnmr3tatlm rauvols)seumxr3nu1aleemivil() 2ta(ro;t0oeeomoeiatfm rln ont4aexnir3iytfpDelneo () rxm(r nydlpee fcia() 2raxmp;o1tet mietys a rlums u0 rxoxo tydlm eauei;s trtrirpiu4aptelicsa( aDur( p;t0apenii3ildfa umuvo;u4 lxnmfcoy1fat  ieslt)srto(opno1lmenlncsltfsDtr(mpno1oet mo3tat a emuvon(0tltrir3tatlate iei ( seumir nydoltnmfvilsfsDtrxr ;o1apt mo3ildlm rm( snt)aeerxo iydopt  ivs t0s2xmir3oy4ome  fet s arururont0aetomfeiad s umnms t)tltniocoo1lp  an slt t2umir3ny1ole lfvtat  2umuronu1oetnio3tls mDrl(vo;u0trxomf3tatfp r neo;t srxrir3iudapee nctat  2ur( o;o4alto ictys s2rm(mon(0 rxnmociodfaDrauvs s)setrxm ou4am emfvs (fartru pnt0tpe  oeildlm emnmp;u0alxoir io1lat  ivsls s2urirpoy4lmtelfvsat) Duaump;t0oetoiociltfs rm(mont) exnmo3oodomDeli o (0 exm(mpio4opt lfvtl()s2urxmoot4oeeo ietlslsDel( pnt4trxoifcoodopt au ols)sruo(r3nudapt  nei t)sDtaur no1alt moeiltlm2uaump t4 rtnmoctadla   uei s0srxrim3nu1ol e ncsas  rrm(root1aee iietas a2ua(mo (0arxrxo oatfaDr ueolt  etoxrpny1ome mici s  2ra(mpoo0opeo ociysls2ul(vp;u)arerir3iydlmD aieslt0 2uo(mpny4am elfctl(fsrta( pou0apt if3iad m2ranmsnt4 rxnxr3iydlmtelnvo;t  2uoxr3io4lptnmnet t sDtmxroot1apenmietyt s ea( o;t4 eeomociatlat li o t  2toir nu4oleelnesasfa2rmu ono1alxn fciysla2ulnvpnt4 rxnmr oo1lp   ueo;t  rumxr iydlm e net (farua( pou0tlxoifcilslaDea(ms t4altrxr3iatlaD  uei;(0seto(r no1alee nvslsfa2ra(  no0tpeoii3iyd m eauvs t0tlxnmo oatlp eaivols) rxmir oy4lmee feia(  rtr( pnt0opxomo3tls sDel(mpnt0alenmrciadop r ivil(0s2xrimpiy1op n nvsa( arumxmo;t4tpt mieildls uan o () eeoxr3tytfm r neo;t)trtrio3no1al n nes s)artmxmo;o4aptomfeiysla umnvs;(0alenxf tydfa r nei s) exrxm iydap n fet (f 2rrur ;o1aptn o3tasfs2elnvo;t4 rtrir tydfaDrai s s0s2xoim oudlmtn fcia() Dtax oou0aexomoetadfm um( pnu0 rtnxf iatfmD anvo;t0 2toirpou1apen fetl( a2ta(root0opt mfeiadla ean s t) exrir oatoaDe nei;s) exm(o iu1ol n iesls)aDrr( pnu4oetn o3iysls umn onu) ltnmrcta1lm rli o;t0teurxm3iu4amee fetas  rurur ou4aleo ietysls2rln snu4teenxo3ta1lpD  i i;( srxmio nu1lltelfctl(f 2raxrpou0altomo3ilslmDemnvpnt)trxrxfciytlmteaivi t0sruoirpoudlmee ncia(fs2raxro;u1olx mictytla2emnmp;(4 exnmr oydla ean ol(0 rxoxo oudomenmicta(  Drr(  ou4aex  o3tys a2el( snt0aeerir3ia1lpteanes ()sruoir ny1ap  lfvils) rraumpou4olxoifetytlm ea( pnt4 eenio3totop   nvols teurimpnu4al nlictlt aDtmxrp;u0tlxo oeiadla ea( ont4altrir iotlm rlivo;()sruoxr3oy4lpeemnvtl()srrmurp;o4alt  ociyt s2rl( p ()treomr3iydomteai i;t) 2umim ny1amt lfei s)arurur nt1apxnmoetat s2rm( p;t0 eenmf io1lat lnvo (  rumimpoydape  nvsa(  2tr(rono4apt mfeiydfs2rl( pn()tleomocoodfa eanvs s0t2uo(r3nu4amte feslt  2ur( o;o4tpx io3iytls2ul(vo t)altoif oodfat lueo s)t2xoir ny4lm nmietlsfs2umx pnu1opt ioctysls emnvs (0altrifciydlpDr ieols)srtrir nu1lm n nvsl( sDta(  ;o1oexoiociyt sDrm(vp (0trxrircoy1fmDe i s t truo(rpoo1opt micils)sDumum ou1alx mo3iyslm2em( on(0treoiocty1optran i;t  2xrxrpoo4ap elici sfa2tm( o;u4oex  feiytla2em(mp;t0 rerxo3tatoaDrli olt)setoim nudop  miet s)a2rmuronu0aetomociaslaDrmumpnu4artomocoy1lmD  ivsls srum(rpny4lme  ieils aDtmxmoou1teto feils a rau p (0 exnmf oytlpDeaiesls t2um(m ou4ll nmfciltfsrur(m nt1aptomietlsfa2ea( o u)aetomrcootfpteli il(0sexoio oo4lltnlfesas aDtm(r ou4opxo i3iadfs2uaumsnt)tltnmrciy1fm elieols0seurxopiudll  livil() 2um(rpnu0ope mociadfm2ea( onu4 rtrifctydoptrln ols)s2ur(m3no1lp nlietat) rta( pnu1apeoii3tlslaDuauvs t) eerif io1omteln i s0srxoxr iu4lmenlneiltf rraump;u0apeoiictlt a emump;u) exnio oodfmt aieo s0srumxr3oydaltnmfeiatfa2um(moot0alen feilsfa ea(vp t)trenmo tadfatrluvs t0 eurir oo4amtelfvsa(faDur(rp;t1tpxo i3ilt sDulu pnu)tetnxfcoodoat aueslt0seumxr oo4olt mncia(  rrr(mpno4tpxo f3tytlaDrauvpnt)teeoif3oa1la e ivs;s0 rum(m3oydlltelnvtl() Drru  ot1oeeo f3ias a2eluvp;u4 renif to1faDrln i;( srxo(o3oodlme lncta(faDumu  ;u1tet moetlsfs2em(msnu4teenxf3ia1lmt aieolt0 exmxrpiy4ll nlnct (  Dua(m ou4altnmoeiyslm ranmpnt)tltrir io1lat  nvo s)srum(r3oy4lmeelnet sf 2tr(rooo0oexnmfciyt aDuluvo (0teeoxf oodfaD ln ol()s2urxm oo4aptnlfeia( aDraump;o0apeoifetltla umu s t4arxoifcootfaDrlivsls0 2toxm io4olee nciat)arrrx oot0aee mfctasfa2em(vsnu)altrmr oydfmte u i;s seurxrpio1ole  nctas  2tm(mp;u4olenmfeiytlmDrl(vo;u4 ltoirctytoat  nesls  2um(r3oydlp  lfvs sfsrraurpno0opx mf3iyt s2el(vont)aetoxocoytfa e nvi;t s2xo(o3iu4olenlies t srtmu o;u4opt mictldfaDrmuvsn() etrmr3oytfm rlnes ()setoir oodaptn fvtl( aDtrxm nu1aetoiiciat a ulnvsnu0teerxocoodop rai o t0 exo(m3iodapenlnesatf rtmu pnu4olx mieildlmDea(mp t) reoir oatopDe n ilt) rtoimpno4op elfes t) 2rm(m ou1aet  i3iytlm rmuvo t0trxrxo ia1oat  uvs;( sexrxm io1aptemnctlt  Dumump;o4alxoiieiasfs ulnmpnu0artnxo oytopDr ueo;s  rxoxr io4amt lfes t a2rrxmo;u4oexnmi3tls aDrmuvonu4trermf ootfpDr nvo;t  rur(m nydlltemiet tfarrmxrpoo4oet io3ils aDuan pnt4aexrxf3ty1fm  lu o;( t2xmir3nodlmtnlfvslsfa2raurpou4oet ioctldfsDean pn(4teerxr tydoatr nei;t  rxo(o3nudape mnci sfsDtmx  ot1altoiieias s2rmuvp;u0aetoxrctodfa e i s;t sexrxmpoudllte ivsa()a2umx  ot0tle mfetadls em(vs;t4 lxrxrctadoate uvs (0sexmir3iudoptnmnetls) rum(m ;u4tleniiciat a umuvp;t) etomf ta1lat  ueolt)s2urimpny4ap e neil(faDtr(ro;u4aexn ictas s2elumpnu0 exnxo iytfat anvs;t seum(o nydomeelietltf 2uaur ;t4oetoif3iltla2umn o;t)aetomo3oytlat  ivo s  rtoir oo4omtnlnciltfs2ta(r ou0tpxniietasfa2uluvpn()trxoxocoodlp elneo t)sruoxm oodalte ivsls  2trx o;u0oltn ieildfa rmu p ()tlxomo iadfaD  ieo t) rumxopnydlpeemnctlsfsrumxmpot1opx mieiadfmDuanvo;(4tlxrmr3ta1fat  nvol()trtrxo iy4ol n feil(  Durxr nu0opeo ieiatlaDulnmo;t0alxoio oa1omDrlneo;s0teum(m3iydom  mnesa(fsDtmu oot1oleoiiciydlaDrlu s;u0 rxnif oadfm eln slt0texoxrpny1olt lietl(  Dtmxront1tptn i3tatfs eanmo;t4alxnmrciodfpDrlu i;t  exmxmpoy1ap   iesa( s2rmx  ;t1olx  fetys a elnvpnt0 ltnmf iydoaDe ueolt)srxoxm ou4ll nmncsatf rraum no0tle mo3ils a umn sn(0aetrxfcoadlmtrai sls srxrxo oo1lp nlivs (f Drau o;o4aptnif3iyt aDuluvp ()teeomo oytfpD lnvo;( s2xoxopoy4am emieta()s2uau  ot4teto octas a2rluvo u4texomr iodopD anes t) exrio nudomee fetl(  2rru  no4oleniieiyt mDrln s u4 leomr ia1fp ranvo;s seumim iodopee ietltf 2ur( ont1alx moctltlsDelu o;u0texnmociotopDeai s s) 2xrir3nodlptn ivsasfaDrmurpou1tetnio3tyd a ul( pn(0aexoxrcoodfmt aies;s0 etmir iydalee fesa(f 2urxroou4apxnmoeiltlsDel( ont4tltriocoytoptelivo t0seum(rpnodal  lietlt) rururpnu0alx ii3tyd s ea(vpnu) eeomf3ta1opD lueolt0 2umxm3iydol  lieiltfsDumumont1texo ociadfm emnvp;(0teenxfcto1fatr u o t)s2xmxm3oy1apt liet (fsDrm(  ot4teeo f3tldfs ua(vs t4aetoxociotfm rlueo;t  etrirpnydomtn fei t)sDtmx pno1open oeiltls2elnmo u4trxrircoy1lmte i i;t) rtrxr ou1omenmfcilsfs2rru  nu4tlxo o3iltfs elumsnt) rxrmocoytfpD livol(  rto(o3oy1aleemnci () Dururoou4aptn i3iadls umuvp;u4tlerioctytlpt aivo;s texmimpiu1ap e nvt ( srra(mp;u4tltn f3tadlmDuln s;t0altrmf3totlp eluvo;t) 2uoirpiy1altnlieiat)srumurpot4apeniiciad s2rmuvsnu0tlxnmo3iydopDelieilt0truoir3no1ale  fvtltf rtmx o;u1alxoio3tlsfa ul(mon(0 etrxf3ootla rln ilt)sexm(rpny1lp e ncia( srrax  ot4tpxomo3ias m um(mp;() rerxfciotopDrlieo t0 rxoirpio4lleelfcsl()aDurxronu0tpe mf3iyd m2rl( sn() ltoir iy1lmD  u o t0t2umir3nydlltn nvs s)srtmx ont0alt  fciatfm2eauvpnt) exnmr3oo1fpDraueo;t)s2xmio io4lmteliesatf 2raumo;t4tltoiociadfsDumnvo u4tetrmfciadfaDe n i (0texoirpiu4openmfcs s)sDuax pno0tet  octatls2el(monu4tetnir oydlmDr nvil()seto(o oo4ap  mnesat  2ua(rpoo4ope moctltfs2rl(mp ()texrio3iy1fpD  neilt  rtrxo ou4amtnlics t) 2rmuro;t1tpto ocild aDua(vs u) rtrxo3oa1fpDeli sls)trtoio3ou4ol elfcslt)sDtrumono4apto ieildfa rl(vp;u4teerir totfm e ueo (0setmiopnu1om e ncs (f Drau  nu4tlenmfctasfsDrmnmont0 etnif3ty1lmteaueslt)t2xoir ny4lmtelfvsls) ruaxmp;t0tetnifciysfaDuaumon(0 exrmo3iadlpt lueils)srto(m ny1am n ivilt s2uax pnu0teeo feilt m2eau o;t0tlxnxf3oatfa elu i (0 rxrxopnodop elfvs s aDururpou0tle mo3iydfm2emnvp () renxo3oytoat au o (0teurxm3nodop nlivia(  2uaump;o4olxomocilsfaDrmn s;(4trxnif3oodopt  uvi t  euoxrpiu4ole mfvtl( a2rru ont0oex  ocildfs eau p u0tleniociatopt li ilt) euo(o3nydolte ncs (  2trxmpnu0olen fetytfs2umnms;()altoir oo1oatr nei s seurxopoo4llt  fcil(fsDum(moou1tpeoifeiydlsDea(vs;()alxnmfcoodopDr nvs;()trxmxo3ou4lmenmnvs t)s2ua(  ;t1tltnmi3tyd s2um(monu0 rxoio3ootlm  anei s  rxmxo3oy4opt  nct t) Dtmx  ou4tpt mictas a2elnmon() eerxrcia1lp eanvs;()srxoir iy4amt mnvi t  2rr(r ot1opxnii3tyt a2umu s t)tltnmr iotom elu o (0 rxmxmpno1ol emnet t a2rrxm nt1aexn f3iys mDra(mp;()tleoxf ta1fpt livsl( trtrir oo4aptn nvsl()srrmxmpnt0tpen fcilslsDuauvont0aetrxf oadoaDelueil(0 2ur(m oudolte nct sf 2umxr ot0ope mictysls2um(mp u4trxniocoo1lpD luvo;(0 rxoxo3nydap  mietas sDrm(rono1apxnmi3tatlm rmn p ()arxoxo iadlpD au ols)t2um(m iydame  netls)sruaur oo4oee  o3tydfm2rl(ms (0arerxf iadlpteauei;( t2xmxr3ny4lpenlfvilt a2uau ont0olxoio3ils m2rm(mp;(0tlermr3to1fptean o;s seto(mpiy1altnmict ()aruru p;t0oltnmociytla2eauvsn(4tltrxr tytfptr iei;(  etr(opiy4alt  feta() Durx p;o1opx mo3iytla2el(mp;u0aetrmrcty1lmte iesl( t2umxo3iodapt lfctas)a2rrur no1aeeo i3iadfm el(mon(0 etnio3todla  lneo;(0s2trxo iodop n neiat)arraxrpnt1tlxnmi3iydls2ea( o (4aexrxr tydoa   ivil(  2xmimpiu1ol nmneslt a2rau o;u0oeen f3ilsfa2rm(vpnt4aexrxf oodlpte ies s  exm(o iudol  lfeta(fa2umu oou4tptniictat sDuluvsnu)tltnio oadfmteau o;(0 2umxo oydop n nvilt)aDtru  ;o1tpeoiieildfa rlumont0 rxnxo3tatoa rlivsls  2tr(m iodamen iciatfartrxmp;o0aeen fciltlsDelumo;t0aetrir oodfa  lneils0trtmxmpno4aptnmfviatfs2umum nt0tpto i3iytla rl(vpnu4areomr3oatop  livol(  2to(rpnu1ol   fvi ()arrrx  ou1opxomfeiys mDea(vsn(4aexrircoydlpD  ies t0 rxo(rpio1ll n nvil(fsrrr( o;t4tpxniietls s2raums;t4tltrio todlatr ueslt trurim ny1ap nlncia( arra(mpnt0tet  icils sDuanvp;t4artrir totlp rau o;( s2uoxm oudalenlfvsl()s2um(mono0opx mi3iasfmDuauvsnt)arerxr3oydomDe ies;t0 exrxo3nudlm n ietas) 2umx  ot0opx mfeilsfmDea(vonu0 reniocoa1oa eauei t0 etoio3iydal   nci tfarumum ;t0olenioetasfs eanms;u0aexoxr oydlp r i o s)s2trxm nodoptnmiesa() Durxr ou4ape mo3iadlm2rmn o t)alerir iadfp  lnvo s0t2xo(r ny4ole lnetl(fs2ra( pot0aex if3tasls el(vpnu) ltnxrctotlatean i;()setr(r oy1opeemnvtas a2tmx onu4tlxoioeiyd s elu ont4alerxo oadlaDeau s;t0srumim iydopte fcsa() 2ra(r ;u0tpxn o3iytlaDrlump t)teeoif to1op elieo ( srumim iu1lp  mnct () rrmur ou0apto ictyd m2umuvpnu)aetomf3tadfaDr n s s0teurxo3ny4op n ivias srtaum nu1tlxoioctldlm ua(vo (0 exnmf oadfpDe ueo;s seum(o nodopeelnci tfsrra(m ;o4texoioeiadfs2em( pn(0tetrif tatomD lnvo t0srxmxr3ny1ll nlivtasfsrum(rono1alxoioctys a eaumpnt4arxriocootfptelu sl(0s2xrimpnu4ll   nesas)aDraumpot4aleomicilt sDrmn onu0 lerxocto1lpteai olt t2umirpnydal  lnvsa( s2trurp;o0tleoifctldlsDrlumonu0artnxf3iydlmt anvi;t0seurim3iu4oltnlnvil(f Drmu pot1olx  oeiltfm2ra( p;u4 eerxf iydlm r n s t  rxr(rpnudop nlnctlt aDurx pou1tpt  ietysla2rl(mp;u4trerif3ia1lat  nes;s0 euo(o iu4lmeelivtl(faDuru onu0tpt ioeiysfsDulnvs u0tltomr3tytlm eai s (  exoirpny4lpenlfeiatfa2urx oou4openmo3iysfaDuau o;(4 exoxf3totfm elueolt) eur(m nu4lp n ivta(fsDumx  no4opxnmi3tldfsDumnmonu0tetoxoctodfpDr u ilt trumxm iodlp   iet s arumu p;o0ale io3iytls2ea( o;(0 exrmr3oy1omt lieol() eumxo ou4op emnvs sf 2rmx pnu1oetomietydfsDrlnvsnt0 ltoxo3totfaD lueol(0 2tmir oodlmtemict (f 2trx  ;t1oltn feilt sDul(mo t4texrxf3iy1oa  anvolt  eto(r iudllee fes sf 2rm( o;t0aetniociasfaDrln o;t0 eeoirciatla rau ol()setoirpio1ope lncilt  Dtrxm no1alxnmo3iytlm uluvont4tltrif tadlmt li s (  rxmxopny1lpe  fes (fsDumx o;t1oexnmfciatla2ran pnt4 rtrir oa1opDe uvil( setmxm oudlm   ict (f Dtrumooo1texomfctysfs2umumon() lxomr iadfm   i o;s)sexoir oudale lfesls)aDrmx  ;u0alxnif3iyslmDemnmo (0 rtoio oa1fa  luvsls  2xmio3nu4lm n fetas aDrmumo;t1tpen oeiad aDel( p (0tltomo3oy1late ivo;(0srumxo oo1oltnlfvi ( a2taump;u4oleo oeiyslsDemu p;()arxrxf3oatfmtelnei () 2xmxmpoydaptemnvtat  2tr(mpnu0ale iiciydfa2eauvonu0alxnxrciodfaD an olt)teuoxr3oo1ol n icsatfsruax p;o1tpeo f3tysls em(mo u0 rxnmf3iotlp eauvolt t2urxr nodlmen ivtls aruax o;t0apeomicilsla2umuvs t)arerif3tydomtelivsl(0 ruo(opno1lmenlnesl()arurxmpno1tltn octydfa uanmsn()aexoif3oadfm  au ilt)setmxo3nodom emici s)srurxmo;t0tpe  oeiadlsDuanmp;t)treoirctytfaDeanes ()s2xoio no4oleemnesl( a2tmx p;t1oeto ietld a2uanvp t0 rxnir3io1lmDeli o;(0texrir3no1lle mfeiat aDua(mpot1tlen i3tydlsDuanvo;t0trxrxr oodlmD lueilt  rxm(mpoy1llt  icia( srtmxrp;o0aptoiieiyd m elnvsnt0 rtrxo3ta1opDrai il( teuoim3iodlpe  ivia( a2tau pno0opx mi3tlsfm2eanmsn(4arxrmocoodoa e ueols0t2urxopnodom   fct sf Dtm(r ;u1oetn oeildfsDua(vs t4alenxf oydfp  au ilt trurxm3no1lle  fvs ( a2tmum ou0alx ioetad a2rlums (4tltomrcio1opD lieil(  2xo(mpio1lpe lnvt s)a2rau  ot0texn i3iysfa2umumsnu)aeerif oytlm elneo s s2tmim3nodopte nctls) Dtmu  ot4aeeo feiltfm ranmo;(0teeoif3iydfa  aivi t0t2uo(rpno4lmtnlfcs s s2truro;u4tpx  o3iatlm2eauvs u)tlenmf3io1oaDr u i;t)setr(mpnodam e ictls)srururoou0aleomictyt a eluvon(0trtnmrcta1op rau olt) exoxr oo4llee ivi t)srum(mpnt0tleoif3iydlaDulu o ()arxomociy1fp   ies;s)srur(o iy4lm  livs (fs2tmu pou1tltn ieiydlsDulu pnt0 leomr totlptrlivslt) rtrimpiodlmen ivias)srtr(m ;t1aexnmietltfa2el(vpnu4altrxf3ia1fpDelu o (0t2xr(mpnydlm emicslsf 2umu  ;t0apen oetydfm uauvo;(0 lxnmocoydopt aneo t) rurxopiy4amte feiat)s2ta(ronu4ole if3ilt aDuauvs u) eeriocia1la rlivs;s0t2xmio3iydame  feiat)a2rau  ;u4aexomiciyslm rauvo;u4trxrif3iatla  lnvo t0srxmim oudal nmict ( sDrmumooo4tleoifeiytla elnvs;(0 eermf3oydom  lnvo t0trtm(r3iy4omeelnvilt  Dtaxrpno4opeomieildla rm(vs () rtnxr3iy1fpt anvi;(0 2trir ou1optnlfeia(  rua(r ou4optomf3iadfa el( on(0alxrxo tydoatrluvs s0teurxm3iu1am e ncslt) 2taumo;u4oexomieiltls rm(ms;t)arenxr3oadlmtranes t0setmirpnodlp emfvta( sDrrx o;t4olt mfciydlmDrlu s;t4 rxomr ootomDrauvslt)truoirpiu1ap elfvil(farua( p;o1tpxn o3iltlm ran o (0 etnmfctytoa e i o t)s2uo(mpny4aptnmiei sf 2rru pot1tee iiciadfa el(vsnt0aexoxf3ia1fatr ueo s srxriopnudll e nct tf 2umu p;u0tetomoetadls eln p;u0texrmo3iotlatraues;t0 ruoxopiudlpte nvslt a2um( pnt4tlxomf3iydfa2ulumo;(0trxrxr todfp  anvsl(0 2tmxo iy4omee nviatf 2rr(mono4oee ifctatlmDrl( ont4arxnir todoa   uvs;s)srtoir3nu4ap  lncia()arra(r ;u0opxniietasfs2rlnmp;u0 eenircty1oaDeai sls trurxr3ny1lmtn ivtls a2rmxrpoo4tle  o3tldlaDem( pn(4tetnxr oo1fp  au i;s0 ruo(m3iu4optemnci t a2rr(r ;t0oet mictltla2ranvo;()alxnxr oodfpD  u s;t) eumirpoudlmtnmivtlsf 2raurono1oltoioctydfm2rluvp;(0aexrxo3iadom  ln s;t srtriopiudlpenliciat)s2tm( ono4tpeo fctydfs el(vsnu0 rtrio3iydoaDraueslt)tetrxrpiodam nmics s) Dum(m oo0oex ii3tys a2ulnmsnu4 reomo3tydlpt  ivo t sexo(r oydlmtn fetas sDtm( p;u1tetnifcils sDul( p;t4teenmr ta1omD li ils)sexm(r iu1oltn neta()sDrr(ro;t1oeeomi3iaslmDeaumpnu0alenxfctydfpteli ilt)sruoxopoo4lmeelfcta(  rtru  ot4alt ii3tatfm2uauvo u)teeoirctatfa   ivi;s)t2tmim3nudlp emfcil(f ruaxront0aptnmi3ilsls um( onu) rxnxrcia1fpteluvs (0 rtmirpiydamt  iciltf rta(m oo0alxo ietasfs2rlnvp u0 leoio3to1oa ranvo s0srtr(m3ou1opeemfeslt)aDtr(r nt0oetnmf3ilsfs2ran s ()tlxnxr iytlaDeaieol() 2triopoy4ope mnet s) rrmx  ;o4tlen i3iadlaDrauvs;t) rxoxo3io1fmDr nei ( tetrxr3oudomenmiesas s2taumonu1tpxnmociyslsDua(mp u)trxnmr iatopt lneo;s t2uo(o iy1olenlnetl( aDtm(m oo0tex ifetls a rm(ms u)tlxoxrctodlm raiei t)sexo(m3ou1lp emfei s  2uaxr no1oet mf3tatfaDrlnvonu4 exrio3to1oat  ieo t)texr(rpny4aptnmietl(fsrraxmo;o0optnmieildla2el(msnt0teerio3iatlm elieo s0t2xoxo3iu1am n ivslt  2urx oot1alx ifciyd s ran sn(0aetomrcty1lpteaivs;t0seuoir no1al elnctl( a2urxrp;o4tlxn fciyslmDumnms (0aeenmf tadlmt  n i (  etm(m3nu1ope lfetas) 2rr(mp;t0teen iciydls2rlumsn(0tetomfcoodopDrau o;t0 2tmirpnu4ol   icsat)sDur(mpoo0ole  i3iyd sDrlnms (4 ltrxf3oydlp   ues t0t2ur(o3ou4ll n nei ( arra(r ;t0tleoifeiytfm ua( o;() lxnmo3tytoaD lues;t0 2umim iy1amenlfct (fsDtax onu1oet mfetls s em( p (4 rtoioctadomDe ivil( s2toim ou1olt mivtl( srtaxmpou0olt  ietlt s uau o;(0 exniocto1fp ranvs;t)srtoir3iu1lpt lnctas)sDrr( o;o4oleniieils s2emu p t4aexniociodom e ivs (0t2xoxm3io1omte icslt)aDtru poo1tpt iiciytlaDra( p;t4 exrir3iatop rln olt) 2trim3no4lpenlfvslsfs2rm(mooo4alxnifeiys a2eaums u)tetoxf3oadlptrlivi;s0srtmiopiudom e fctlsf Drrumono1altnmo3iyd sDranms u4alerxocio1omD  uvo (0trur(m iodom  miciatf 2raur ;o0aet iiciltfs rmnvo;u0 lerifciatoaDr ueo;t0s2umxo3no4apte nvsltfs2urumonu0optoio3iydlmDuluvonu) etrmrcoytlp e nei t trtmimpoy1opeemici t) rtr(moot4opx mo3tas s emu p u)arerio3oa1fm eauvo;s) rtoxr iy4omenliei sfaDtr( p;o1aetnifeiltla elu ont0aeermf3iotfmt an i s)srto(o3io1oltnmivia(faDuau o;t0aptnioeilsfaDeau snt0aexnir3iodomt anes t0teumxo3oy1amtnlfvt t)a2rm(mpno0apenmf3iysfs2rm( s t)tltrmr ia1omtrln i;(  rxm(rpiu1om emiet ( srum( ooo4tpxoiociasls2rmums (0aetrircoo1oaDeln o;s)s2uo(r oy4altnmicslt srtmx pnt4alt  fciytfm2uan o;u4 ltrxo3oy1lp eanvs;t0trxmir3ny1lmeemieta( sDuaxmo;o1tpxomf3ilsls umu p;u)texomo oodfp rai o;s)t2xo(r io4am e ivtlt) 2urur ;u4tpenmf3iatfs2rm(vo t)trenmo ia1opD li i;( t2xo(opnu1oltnmfeta(f 2rr(rono0open f3tat s eln snu0 etoir iatfmt ai s;s)trurxr io4oleemivtl( aDuru oot4aetomieiyslm2rluvp;()trxrmrciadfateliei t0 rxoxmpiy4olte ici s s2rax ont4tlx  f3iytfs rl(vs;t)trxnxr oa1lmD  ies;s)s2xmxr no4lme lieta( aruax pno0apenio3ildfa ra( s (0teeomrcoodop rlnvs;t0 rto(mpou4om elneias srtm(rpoo4tleo ocils mDrau snt0 lxnxoctadoa raieols s2umirpno1ape lfvia(  Drrxmont1tleomocilsfaDrmu p;() ltnxr3oytoatr i slt srur(mpio4lm nlfesl()artrxrpnt4openmfcildls ulu p;(0 ltnxo ty1omDr ies;()setrim iu4ap emfeilt)a2taxmo;o0oetomfeiat aDum(mp u0alxrioctytlmDelnes;t) exoirpoo1lmtnlfct tfsDur(rooo4oet moetadfsDumumpn(4 ltoir3iotopD aueil( texmirpnodam  lnvs tfsDuru  ou4optoio3ildfa rlumo (4tltomfcty1fpt  uvol( sexrxo3nu4al elfvi t artmxm nt1tlt moctltla2eluvo (0trtoxf3iydlmDe ueol(0t2tm(o nudalenmfvsltf 2umxr oo4oltomo3ias sDemnmp t4arxrmo oa1lat au sl()t2um(r nydape lietls)srtmxmpno0tpeomoeilt s ra(mpnt4arerifcoo1fmt  ivs (0s2toxrpno1lmt  nvtat)artaum nt4ale mieiyt a rl(ms u0teenircty1omDe ueslt)texrio3iy1om  mnct s)arum(m ot1apxomictls a2elnmonu0 renmf3iodoptr u ilt)truoim iydape lfvi t)a2rmxmpou4oltoifciydlmDrmu s () etnxf totfm elnes;t) etmir3no1ap nlfvtlt a2umumooo1tex io3iatls eln o u4aetomr3tydla eai s;( t2xrirpiu4ome mics (farumxmpnt1teeo ociys s2uan s t)trxnif3oydfpteauei t0s2trxr oodop nmfet t) Drm(mooo4teeomoeiaslsDul(vp t) ltoirctadlmt  i ols0s2xrxr3nudll emnvi t)sruaur oo0aee  i3iatla eanvp;u0 eenmo3tytlp  livs;t)setmxo no1lm elnetlt)artmxm oo4tlt iiciytla2eauvp;t0tlxomrcoydfaDr neo s seumxm3io1lptemfci ()srurum ;t0oex mieiyt a ulnmo;u0tlenxfctotoatrlu o;t0 eumimpiy4lptemfvs s) rrm(rpou4alxnmociytls emu s t4 etomo3oytlate neil()texoimpou4al  liciatfarum( oou1oeenmf3iltfs2rl(vo;u) lerxr3iodop rlnvi;s t2toxo3io1lmenliei ( srtmurono0tltnif3iasfa eanmp;u4texomf io1laDrln s t  rxrxmpiudlmt mnvias)arum( o;t1tltnmictadfm raumpnt)alenxfctodfm r ivil(0s2xrimpny1lpen ietl( a2rmu oot1olto fcilt m2umump (4aleoiocia1oa   ueo;t  eurim iy1lltemfeias)sDtmuroot1olt ioeiad s2rmn p t0 lxnmfcoa1omt aieo s0t2uoio io1omeemnvtl(f Drr(  nt4oltnmociyslm eaump ()treomf iy1lp r uvs s srurxopiudll elnct s) rrmx ooo4altn f3tatlsDulnvo u4 eeoxfciatfmDraies t) etmxrpou1lpe mnvs ()a2rmu  no1aeenio3tytfs umums t0 rtoxociytfaDe ivo;t)setoxm ou1ape  ieil() 2tmu ono0tetnmfetyt m2rlu onu0aexrio3ootfpDrau i ( t2xrxrpoo4op  lneslt)sDrmxr ot1tpxnio3iys a uaump (4alenmr3tatfaDe iei;t0 2trirpnodlp  lfvi ()arurxmpou1opxo ociydfa2uanvo;u0trxnir io1lp e n s s seuoimpio4ap e ieslt aruaxmpnu1olxoiietls mDra(vs;t4 rxoxocoydfatr ivi;t s2uoim no4ol  livil( srtr(mpou1aleniietltlm rmn p;u) exoir todomDeauvs s0 eurxmpnu1oleelivtat)sruaumont0olx mieiadlm raums t) rxnxf3tytfp   ivsl(0seuoxrpiy4amtelnvsas  Durxrpoo4tpxnmoeiltlsDumump () ltnir3iotlpD aieo;t0t2tmir oo4altnlivt sfaDrau p;o4alt  oeild sDulu pn(4 etomr3totlaDeaueolt teum(mpiy1lp  lictl( s2rmurono4oex  f3ilsfm2rlumo;u)artoircoatoat au o;s  ruo(o3iudole mfcsat)s2tr(mpot4tet  ietlslm ul(mon(4trxrifcoytlptranvi t0srurimpno4om emfeslt)srtrurpoo1apxomf3tyd m eaump;u4 renmo oytomtelnvo t  etrxr3nu1ap n nvias) rraumpou1apxomo3iasfm2um(mo (0texrir3ty1lpD auesls) exo(o3iydlp nmnviatfa2taumo;u0apt if3iatla eluvon(0 etoxo todfmDelnes;(0t2xr(rpiy1amen ies s aDra(  ot1oex moetyd m elu o;t0arxrif3oydomt auvo;( sruoxr nu4ape livtlt sDtaxmo;t0aptoioeiytfs uln pnt0tetoxo3ta1fpt livi t)s2xo(m3oy4oltemics tfs2tm( pno0apeniictatlsDraumo;u4teeoio ta1lptr u s;s0teum(o io4om nlivi s)arta(m no0altn fctydfa2ua( pn(0tltrir3oydoat anvslt s2xmirpnydlmt mfct s)srtau  ;o1apenifciadla ea(vs;(4teenxr3io1op r uvolt)srxmxr3iudlme lfvt t) 2urxront0alt mi3tadlsDum(vs;t0aeeoif3oatlp e ivil(0 rxm(o ou4oleelieils a2ua(  no0tlxnmf3tad aDra(vo;() etrxo tytfm e n s s0 rur(mpou4ll nmnesatf rrru ono0altn f3iyt s rm( pn(4 eenmfcta1faD aies ( t2xmxr3nu1open ncs s)sDurx oou1aeeoiictys s2umn s t0aetnif3oydfp   iei t0tetoimpno4omt mfcs s srur(r no0ole iieilsfmDelnvsnu4arxrxo3iy1faD anvo;()s2toxo3oydlleelnvtat srrax  nt4tpx mocilsfa2elnmp;u4trtnmf3oodom e i il( t2to(r oy4olee feslsf 2ra(r oo4teto ietatlm2ua(vp u0alerxf iatfatr ues;t)srum(r3nu4apt  iei t s2rr(mo;u4tlxn o3iad s ranmpnt4trtoxfcty1faD livsl()sexmir ou4apt  fvsa(f Drru p;o1opx micild mDuluvs;t0 etrio oo1lpDrlu i;t0 exrxopoodoptnlici s)sDra(rp;o0optnioeilsfm rmums;u) rxrir3tytlpD lnesl() 2xmirpiu4lp elfvtls aDrau p;o4alxo iciydfs emn o t)aetrmr oytom   iei t texoxr3ny4ale  neslt  Dta( p;t0oltn octytlsDuan o;(0altoir3ty1fmD lnvi;s sexo(opno1lptelicia()arum(rpnt1oeto oeiytfaDelu o u0 etriocta1fp  aieo;t0 rxo(opiudomtnlnetasfartru p;u1alxo oetydla eau s;u0 exnxo iytomD  u i;t texoirpiy1alee icsasfs2ur(r ;o4apt ioctldls uau p (0texoif3tytfmD livs;s)srto(rpnudll nmnvia(  rrmumo;u1oeeo f3tysla2rlu o;() rtnmr3iytfaDelnvi;( srto(rpiy4optemfcslt)s2ururp;o1aeeo ociltlm2ea(ms t)artomoctadfpD lnvs () 2umirpiodll  mfei sfarrruro;o1oexoif3iys s eaumo u4 rxnmfciy1lpD ai o;t0 2trio3no4ope  fei ()aDuaump;t4tetnifctls a2uanvs;(0aexrir totopDe n o t setoimpno1ol   fcsat)s2tr( p;u4oee  oeiatfs2ea(vsnt4 exnmociy1fmte ues;t srumxopoydlpt lnei ()arrruro;t1alxomoetlt s elnvs;(4altrirctytlmDeln s s0 2uoim iy1al elies s aDtr(rpoo0optn fcils mDra(vonu4arxoxfcoodlp ran s (0setm(r3no1op nmfci t  Draxrooo0ope  i3iysfm em(vp;(0altomfciotoateli s t0trxoxo3oudomt mieslt) Drmxmpnu1oee  o3iys s2rmuvo t4 lxrircoatoa r ueol() rtmir3nu4omee ivsls)srua(rp;u0aeenii3iadfs em(vs;u)aeenxrciytlpDrau ol( teumio iodamte iesl(fsDumx onu4teeoifciatfa uln ont)arenmr oydopDr i slt) ruoxo3nu4amt  ivsatf Durxrpnt4oexnifciatlaDem(mo;t)alxnxr3oo1fm eanei;(  2urir ou4ope  iciat srtmxro;u4tlxoiieiltls ulump;t0alxomf iytom   ues;s0 2uo(r oo4am  mfvt s srumxrp;t1tpt  f3iyd s um( s (4tlxnxrctydopte n i;() 2xriopoy1lpeelfvsls arrm(rpoo0oexn ietatla2uau p;()aleomf iytlatelieil(0trtrio nu4lpen ncias arraxmp;u4aee ifctyslsDra(mo;t0aeenifctotla elueolt  eumiopnu4ame lfeias aDtr( oot0tle  ieiatls2rl( p u0texniocta1omtrln o;t)trxoxopiudlm e nesat)s2rmxmpot4opeoioeiyd m em(ms;t0 rtomr tydfmDrauei;()srxrio iodlp  lfcta() ruax o;t1texnio3tatfa el(vp u)aeerio3iy1om  lnvo t0 exmio iydal  lnvi sf Drau oou1apxoifctytfa2ea( s;u0aexoxoctydlatelues t)tetmxm3oudal   ictl( srtau  ot0tltn ieiydla2ra(vs;(4texrxf3oa1oa rauvo;t0 euoxm3io1ale lfcsas sDtruronu4opxo i3tat s ra(vo (0 eerio3iytopDeai i s  exmxr oy1lp  livia(f Dumu p;o4opxoio3iltls2rmu onu)artoxr3oadomDe uvolt  2uoxopou1lmenlnviltf 2rr(m ou4oeenii3ilsfmDulnvo;u0trtnxfcoadlm ranes ( s2xmio3iodlpte fvs s  Drm(rp;o0oeto ieiys m ea(vo;u0altrircoy1lateaieil() rxoim iu4lmt  iviasf Dum( pnt0oetoiiciysfmDeau sn(4tltnio iy1fp  au olt0 exo(rpiy1olee ietlsf 2trurpnt1optn o3tadfm2uluvp u)aeerifcoytom eaivs;s)t2xm(o3nydlmtn fesa( s2ra(  ot4aexn i3tydls2rauvp;t) lxnmo ta1lmDranvo;( t2uoxm nu4lp elncils arur( pou0tltnii3tas s2ea( s;()alenmo todfp e u ol(0teurio3oudaltelici ()sDrm( pou0aetn ieiltlmDulnvs;(0aleoio3io1omDrlneil(0srtrxo3nudol emnvilt srrau  ou1tptoifeiaslmDra( o;t)aeerxf3tydfpte i olt0teumxrpno1al   neia(faDurx p;o0altoif3tlsfs2eaumsnu0treoxo oadopt  uvs (0 rumir3nydlltn fctls)a2uax poo1tlen ieiat aDea(von()arxoifcoodlmteaivs;s)srtoxrpno1am n fcsl(fa2tm( pno0tetniocilslm umuvp;u0arerxr3oa1oateauvo;() etm(rpoydlptnmict s s2rauroou4ole mi3iatlsDean s;u4trxrxo ta1lmDr ueo t) rto(o3io4lpe mfvi t aDtaxmonu4oeen ieils a ra(vp;t)trtnxocoodomt li ols s2uo(o3oy4olenmfct sf 2tm( o;u0oexoif3iadla uauvs;(4tlermo3totlp rau o (0trurim iudalt licil( sDuru poo1aex ifctld m2eanms;u4trtoxo iydfa  aies t0srxoxo3iy1lle lncslsf 2umumoou1aex ii3iyd s ra(vpn(0tltoxr iatlpte i ilt)s2toxo3oy4lpeelfcilt) rua(monu1oeeo feild mDea(vo u)tlxnmrcio1la rlu i;s srtoxrpoo1lptelfvsat s2trx  ;u1apt  fctltla emu p u)aeerxf3io1fatrlnvil( sruoxm3oy1lm emncilt  2uauro;o1teto ieiasfm ra( pnt)texnmr3iy1opDe ivi ( t2xrio3io1alt  neia(fs2umxm nt0olxn fciys m2el( snt0trerxo oydoaDe n ilt0teuo(o3ou4altnmivs (farrrur ot0oetoio3iasfmDuaumsnu) ltrio3oydfpD au i s)s2umxo3iydlltnmictlt a2ur(r nt1tee mo3tasla rm(mo t0artomf oodlmteanei;s0s2uoirpiudome mneilt)srtmur ou0tltomfeiyd sDua(mp;t0aetoir3iadoa ran sls)srtrxm3oydlmt mnvs s  rraxrpoo1oltomfctydfsDel( snt) lxrio iatlaD ai i;s0 2xrxmpnu4am emnes tfaDtr(r no1tpx if3ilslm2uanvsn() ltoxfciy1om elu s;()srtr(m ny1omenmfcias) rua(  ;t0oex if3iytfa ranvo;()trxnmocto1om   n o;t) eur(opnu4llt  fvia()s2uaxmoot1tet io3ildls2rauvp;(4 ltomrctydlptelivi t0srtrir3io1llee nct t) rtmu pou1apenii3iaslmDumuvpnt0 lenir tytfpD anvo s0teto(r3iodom  lfvtasfsDtauro;o4opxoiicildlaDemu pnu4artnxf3oytla eanvi (0t2uoir3oy4lpeelfet tfartaum ou0tpxoiieiyd m2rlnmp;(4treoif3oatfptelueo;t0 rxoimpnu4ole miei t a2ururpou1ole  i3ild m2rlnvs t4 eeoxociatla e ivs t)s2xo(o io1lp elfciatfa2trumpot1alt iieiatls ra(ms (4trtnio3to1laDrlues t  etoxo no1apeemfesl()s2tmxrpou0apx ioeiyslm ran s;t0 rxnio tytfa elues;t truriopnydol nlfcsat) rumumoou1apeomfeiyd s uanms t0trtrif3iatoa rli ols)s2um(mpou4alen fcilt a2taxm ;o4oeeo ociydfm ran onu) eerxrciy1lp r n ils) 2toxmpnodapenmfei s)sDtmxm ;u0aeto ociad aDumuvs u4aexoxrctatlaDr ues;() eumxr3oy4lle lieia(f 2tm(rooo0apto fcilt m2rl(mon(0tetnmr3oydlat aieo () rxmxm iy4amt mnei tfs2trum ;t1tpenii3tyslaDemuvpnt4alxoxo3oa1fm e neo;s)t2xoir iodaleelivslt  ruaump;o0ole  ieias s em( o u)tlxoxo3iydlp e uvi s)seurim iy4amee ivtat)srrr(m nu0aetnmfetysla2rl(von(4 eermr tytfpt livsl( setoim3nu4al nmncslt sDumuronu0altoifcildfaDemnvs t) lxnif3oadlmt  uvo;t0 2tmirpiodopen ici ( s2tr(r ou4alx mieiat a2ean s (4texnxf iytfaD auei;t0sexoxmpio1olteliesas  Draur ot4tlt iiciaslsDrmnvo u4 etnif iy1lmt  ivol(0s2urimpiy4lptelnvta()s2tmxr ou1tle  f3iysfs um(vo u) etoir oytlm e i o s sexr(mpio1ameelnvia( aDum(m ;o4tpxomf3iatfm uln p;(4 exrxfciadopDeln o t0srtoiopno4lmee fet t)aruau o;t1ape moetydls2emuvs;() reoxo iytlmt ln o;s)t2um(m iu1lleemnvsat)s2tr( oot1oex mf3tydls2elnvs (0arxrxf3totlmDrlivslt)sruoim iy1olenlfes s s2umuro;u1tptomi3ilsfs rmuvpn()tlxoxfcoa1laD  nvs;(0 rto(o oo1oltn nvt t sDra(moot1tet  ociydlm eau pnu)aetoio3to1oatrauvols)srxm(m nudlpe mfci ( sDuaxmont1alxn oeiat s2rln o;t4arxoxrctodfpt  u sl( s2urio3iy4ol   fetlt)s2tax  ou4ale mo3iysla el(vo t0 lenif oydopt  i i;t s2uoio3io1ol   ictas  rtrxmoou0olenmietlsla2em( p t4alxoxf ia1fmDrlivsl(0 exoxmpnodlm   fcs (farraxrono0opeoifeiytfm ul( o u0tetrxoctydoateauvols)seum(rpnu4lmen fcs sf rumum ;o0tetomo3iltla umu o;t4texnxr oodla  lueil( setm(r3nydolenlnvs s)s2ur( pno1opxo feiat m eaumpn(4 etrifcoytfpD  uvs t sexo(o3oy4ameemnetl(f 2rmumoot4tpxoifctatlm uln pnt4arxnmr to1opD aueols  rtoxmpoodap emieil()s2rr(r oo4opxnmo3iatfmDrmu s;() lxoio3oydla e i s (  etmim3iu4optemivi t  rur(m ;t4alxnmfeiyt sDuan p (0tetnxo3oydomte ivolt t2trxr ou4olt  net ()aDrr( ooo1olx  o3tadls emump u0aetnif3iotlmDelnvs t) 2xoiopiudalt lieilt) 2urum ;u1tetniieild s2rau s u0aeeoio3oodlat lieil() 2umio3nydlmtnmiet s  Dumu  no1oleo ictysfmDea(vsnt4arxomf3ty1lpte nvi ( s2umim3no1lpt  fcsa(f 2ur(r ou0optn i3iyd m2eln on()trenmr tadlmt aivo;() rto(o iy4alt mfetas)arra(mpnt4ole mieiys aDel(msnt4alermfctydfaD aueo ()s2xmirpnu1omee nvi s sDtaxmpou1olen o3tysfa em(vo t4tetoifciy1lm rlnvi s  rxo(o iu1om   fesa() 2rm( o;t4tee  o3tad s rau o u) leoxfcto1lpDranvolt s2urio3nudale mneiat aDum(r ot1tpxniocias s2umump;t4 eerioctodomteluvs (0t2tm(rpiy1lp nlnciat arra(ront0opeomictyslsDeluvp;u0tlxoxocio1lptrau ols)s2ur(r3iydoltn fcs (f 2rr(ronu0tpxo ieiytfm ulnvsnu4 rerxrcoo1lmDr ieils0s2trxr3nu4optnmicta( sDtaxmo;t0opeomiciytfmDran p;u)aetnir tydomtelivilt) eur(m io4ap emnvtl(fa2umx p;t4tltniictld aDua( o;u0alerxr iotfpte ues ()t2urxopiudom nlnvsl(f Duaumooo4oex micils sDea( snu)alxoxf3iy1fateai o t  2trxr3nodlp nmfesat  Dtmu  oo0oeto fciadfm ulums u0tlxomr3ty1om   nes ( trtmir nudamenlictlsfa2rau o;o4alenmfeilslaDelnvpnt0arxrxo3to1fptrauvs;t0sexmxr oy1om  mfvia(fartr(  ;o0alx ii3tls m elu p t0 exrir3totomDr n ils srxoxopiy4optn fci () Dururonu1apeo f3ildlm eanmont0arxnirciy1fp rau ilt0t2xrxm3iy1optnlictasfaDrrxr no1apxomocils mDem(mpn(4 exoxf3iadlp eaues;t t2umim ou4omenlnvtltf rtru ont0aex ioetlt s2emu onu)tetoxfctydlm raieo t s2xo(o3iy4optnmncsat)a2tm(mp;o0aptnifeiat mDuaums u)artrmf oytop   nvo;()s2toio3oydllenlncs ()arrrx pot4aee mfciytlm2rln snt0 lenif3iotopDeln o;t) 2uoirpou4lptn ivtat a2trxrpot0tpeomociltls2ea(mp t)aetnxrcoadom r ivs;t) 2tm(opoo1oltnlietlt srumxrp;t4optoioetatlm2rl(vs;u4aeeomr to1faD  uvo (0t2urxm iydap   nvtl()srurx  ;u1altnmi3ildfaDrlnms;(4 lxoxo iydlaDelnes;(  rtrxo3no1op  mfcs tfsDua(rpnt4aeen oetydfs uan pn() rxrmr3oadomt auvo (  rxrio3ny1lme  nvsl(faruau pot1altoioeiat m2umuvs t0aetomrcootlm r nvil()srxmim3oo1lpt mivslt)sDraxm ;t4apx ii3tydfaDrmn s;(0artoxf iatla e ies s) 2uoimpnudamen fci ( aDur(r ;u0aexniicias a rlump t4alerif iotoptr i s;()sruo(r3iydlm emnvia()sDrrx poo1tpt ifciad sDeln p;t4alerxrcoa1fa r u slt0srxo(m ou1alt lncil() rtm(mooo1ole mfeiatfmDrlumont0 ltrxo3iatfa eaneo t0 2tmim3ou4omtelfctas) Drau o;t1tpe mo3iytlmDuanms (0tltnmr totlmDran s;()trxoxo3iu1lleelnesas)sDumum no1tpe ioetasfa2ean ont0 etrmf ootfp elnvs;() euoirpny4lpt mivs s  2ur(mo;u1ope mi3iat m emuvonu0alxnif3iotlmtraieol()truoio3iu1op emfvsls) Dtrxr ;u4oee moeiys m2ul(vpn() ltnir3ty1fmt lu ils  rxr(m nudapen fvtl( sDraxmo;t1opxnifcias s emnvp (4 ltnif3tatlptrliesl(  rurimpnu1altnmfetls a2rrxmpot1oexnmociysfaDrm(vs t0aetoxfcta1opt lu i;() 2xrirpiodal nmfvs ()s2raxrp;u4oee ifeiasls2raumon(4 rtnir3ia1latrln s ()srtrxo oy1amtelivtasfarrax o;t4alt mf3tlsfm2rauvpnt0tlxrif3oytlpDeauvs s  rtrxo3ou4am nmicil( srrmu  nt1tpxnii3tls sDranvp;u0trtrmfctytopDr ueo s  2tm(m nodllenmfcsat a2tmxroou0tltomietatfs rlnvo () rtrmr3tatomD aiesl(0t2uoxr3nydlm elies sf rurxrpnu0alt io3tad a2el( p u) lerxr3iadfa e nei s0texo(opou4omt lietlt)arrm(r ;t1tptomoctyd a2emums;t4tlxrxf oadlm r nvi s  2xriopio4am   ncsat s2taum ot4alxoiicilsla2em( onu4 lerxf3oydlateli o;t  rxo(rpoodom  lieslt  ruaur ot0alx moctys sDrau o (4tetrif tytlmt aieols  rtoxo3iudlp  mnesa( sDurxmpoo0olxoiieiasfs2uln pnu0tlxoif3ty1omtr u i;t t2tm(mpnu1lltemivi ()a2taxmp;o4olt ifeils m em(mo;(0areoio3tatopteln sl( trtm(rpnu1lmte fei sfa2rmx p;u0aetoifcilsfs2emnvo;u4 eenirciatomDeau sl(0seuoir3nodomee ieslsfaDtauro;t0aex mietldlm ea(mp;t4tltrir3oatla elnesls0 eum(r iudlm n ncilt  2tmxmpnu1tleoifeildfs2rluvsnu0aetrmf oytopD luvo;s s2xr(mpno4lpen iet s srra(ronu0olx  o3iaslsDraums t)alxrxf ootfp e n o s setrxm3nu1amtnlnvta( srtmx  ;t0aexomoeiltfs emnmp t)alxomf3oatfp e nvol(0srxrimpno4amen ivils srtau onu0alt moetltlmDemu s u0tltoif3iydlaDrau o;()trum(m3no4lp  lfet (f Drrx  oo1aeeomiciltfs2umumsnt0 lxnir iotopD livo () etmxm iu1ale  fvta(fartm(rpno1altnifciytfaDuluvo;u4 rtnio iotfpDelu o t  ruoiopnu4aleemnvtas)sDtmx ono4tex  icildlaDea(vo;u4 rtnio tatlp elies ()srtrim3iu1ameeliet s a2urxmo;u0tleo ociysfsDuanvs u)altrmf tydfm eanvsls)texm(opoodapen nct t)sDrm(mpnu4oltn ieilt s uaumsnu4aeermociotfateli i;s0s2xm(rpiu1lmt  nci s) 2rau p;u1aee iociltfm rmnmsnu)aetomo oatom r nvolt)setmir3nodlle mncs s arrrxrp;o0olxn o3tydlsDem(vs u4artomf oodfatran i;s t2urir oo4om nlncta()sDuax  ;o0opxn iciysfa2elnvo t4 etrxf3oo1op eaueo s srxoio3no4amen ict t)s2raxmpou4teenio3tysfs2em(mo;u4 rtnmr3tytfat aiesls0t2tr(rpoydam  lfetas  Dtruroou4tpxnmicilt mDrm(vs t)alxrio oadlmDeauvi s0s2ur(o3iydope livsas)a2um(monu4alxn oetat s emuvon(0trxrmf3oo1lmDr neols  rurxrpio1llt lieta(  2um(r ou4oexo oetadla2el(monu0aexrmoctadomteaneil()texrxo iydom e nvslt)s2tm(rpou4altn ictlsfm2rmu pnu0arxrxr3ootopD liei s0trtrxr ny4om  mfct ( aDta(rpot4ape mf3iad s2umuvo;t0tlxrir io1la r uvs s0 exoxr3oo1ole miesas)artr(  nt4tle if3tls s emuvp;u0alxoir iytlm rau olt)trum(rpnudlmee ivi s  rtaxm ;u1tet mieiad sDumu p;t4 rtnxr iy1lp elnvi;(  etrirpiudal n nct sfs2tm(ro;o4ape if3iasls ulu ont)trtnmocoydopD anvi () exrxo ny1lleelics s aDuaxm ;t0oeenmicildlmDrmn s (4 eenif3tatfpD aueo t  rurim3ny4om n iesl()sDta( oot1oetoiociasla2em( o;t0 lerir iy1lmD lnvo;t0 2xoxr3ou4llenmnvta()a2tr(m ;u4oee  ieildfs2em( p (4 etnmr tytoatrln s s  etoim3iu1oltemivsat arrm( p;o4alt if3ilsla2elnmsn(4 lerir3iadfpDr nvolt)teumxo3no1lmen nvi ( sDuaxro;o4aet if3iatfa2rl( s u4 lenmr3tadlaDrlieo t  rxmxo ny1lm  mivs s) Drmx oou1aee if3iltfmDumumont) leoxr3iadlpD  ivo t texr(opou4lp   ivtls) Dtmxr ot0altomfciad sDeauvp;u0alxnxrcta1lm eli il()t2tmirpoy1llenlivilt srtmu  nt4tlxnioeiydfm2uanmsn(4arxoxrcto1lat li i;s)teumxopiu1ope  nct sfaDuaur nu4olxn ociltfa2ean s u0aeeoxrciadla e i o;t)trxoir oo1ol n nci s s2umumo;u0tpeo o3iysls2rau snt0aetnxf3io1fm  livo t teuoxm oudam nmictl()s2rr(rpoo1tpxomiciytfmDulu p u)aetnxocio1lpte uvo;t0trxoiopoy1lpe licsas  Dtr(  ot4tex mi3iydfmDeanvpn(4 exrif tatlmDrauei t)sexo(r ny4open nvs t)aDum(m ou0tpxomo3tatfsDumuvo u)artnif oatfmDe nei;t)t2uoir3oy1ome  ieias a2umu oou0teeoii3iys s2ean s (4 rxrifcoatfptr u sls texr(m3io4alen ivil()srtm(root0tlx  i3tls sDrl( p;t4alxomfcoa1laDe nvs;t) exmio io1lmt lneil( s2trurono1aeenifetydls el( p;u0 eeomfcta1lat  uvs (0teur(m3nudol   fctls)sDurump;o4oet micilt s2ua( sn()tleomrcta1fa elu s s0 exmxm nu1omt  ics sfs2rrum nu1opt  o3tadla umuvs (0tltrxr tadomD anvi;s  ruoim iudaptemieiasfa2rr(  ;u0tpeo i3iltlaDrmnvp;t) lerxr3iatopDe uesl(  exmir3iy4opeemnvsls)arrrumoou1oee mfeiltfa2uln sn(4trtnxr3oo1latrau sl( s2xrxm io4lmtnlfeias) Dur(r nu4tle ioctlsfsDrluvsn(0alxoxr3tytoaD  ieols)trurimpio1lpe mncsa(f rrmxm nt1oet iietaslm umn p u0artrxr3oodlaD aivi (0trxrirpoy4omtnmnetatf 2rm(  oo0aexnmfctldfs2rm( snu) lxomocta1om rau i;s0 rtm(mpno4oltelnvi t)a2rrx  ;t4aet  oeildlm2rm(vo (0 exrxf ty1fa ranvo;t  euoxo ou1lptnliet (fartau oot4apt ifctyt a ua(ms;u0tlermociy1lpt aueo ()trxmiopiy1lpt mivs s)s2tr( o;u1tle iociltla em(vs t4 rermr3totopDe ueo;s)s2uoxo3oodom  mneil()aDuaxrpnt1aexomfeiyd mDuluvo ()aeenmr todlmD liei;s)t2xmxo3nu1ap nmicia( s2ua(root4alt mocias a2ua(mpn(4trerifcia1lptraieols)s2umxrpnu1lptn ncilsf Draur nu0oexniocilsls um(vsnt4altnxr iytfpDelu s ()s2xm(o3nu1omtelfvils) Draxmp;o4oleoifciysls emu s t)arxnmo3oadopD lnvi t0 2toim oodopee ncil(fsrtr( o;u1aptomf3ils mDea(mpnu0teeoxf3oadfmD lnes;t) 2trir iy4om nmfviat) Dtrx poo1tltnmi3tlsls ua(vsnu4 renmrcoytopD lnvi;( tetoimpoodap  mnvi s)s2uru p;u0alxo o3ilsfm eanmo;t0arxnmocto1opD  ivslt t2triopno1ol e ieil( sDtrx ooo1tpe mociadfs ran snt4 lenif3iotfa e iesl()s2xrxrpio4optn ivt t  2urx pot0olenmi3ilsfsDua( p;(0alxomo3iydlate ueo t t2xoxrpoodopt lnvtlt)a2rmu  no1alt moetld mDua(mp u0 rerxf3totfm e neils0t2xr(o3no1ol nmivsl(fa2umx onu1tpxn fciyd a ranmp t)aexnxocoadoaD luvsls0 etoir oy1al n fvtas) rtmu o;u1opxnmicilsfm rlnvo;t0alxnmociatoat  ieol( t2trxr3io1lptn fvtat)sDtaxmo;o1apt  ocild mDrmu snu0trerir iy1lpt  neo;s  2tmxr oudlpte ietls)s2tmu  ot4olxo feiyd m elums;t0aexriocoa1lpt livsls truoirpoy4ope mnvs tfs2rrxrpoo4aee mociytfmDulump;u0texoir iydop eli ils0s2to(mpiydlp  mfcsl(fsDuaxro;o0oexomi3iytla2rln snu)aeerxo3tatomDeaiesls0s2uoim oodap nlnvil(  2ta( p;u0tex  ocildfm ea( onu4teerxfctatlm e uvo (0 rum(o3oy1aptelncias)aDua(moou1aleomo3iltfm2ea( o (0aetrmf ty1oatelnei;(  rxmir3iy1llee nci s)aruru onu4olenifctlsls2rl(vs;t0altrxfctodlpDe ies;t0srurimpnu4lm   ictas) 2tmxro;t4aet  ocilslaDrln o;(0aexnxrctotoptr u o s srxrxm3iu1olenmieiat)arumxr nt1olenmieiasls ean snu)alenio todfm e n s t0trtoxopnu1ll elivtl(  Dtrxr nt0opxoii3iasfmDemn o;u0tlerio3iodlmtraneolt srxoxo io4llt mivsasfarrrx  nt4alen oeias a uanmp t)texomrciadfateaiesls)sexmio iu4openmfeiat)aDraxmpno0ale ifciyslm2ea(mo t) rtrio iydlatrlueolt srumim iydape mnvtl(f Durx p;u1aet  feiysla2ua(msn(4treomfctydlaD an ols  rur(m3oo1alen icslt)a2tmx poo4aeto ieiasfaDrl( p u0artrirctatoaDraivslt0 rurxr3iodalenlnctatfaDtr(rp;o0aeeoiieiad mDrlu p (0 ltnmrcoy1fa rlneil(0 2to(mpiudal nmfcs ( sDrmxr nt0aeenmietad a rluvp t) rxnmr3tadlmD  neo;(0t2xmirpiu1open feil()s2rruro;t0alxniietlt s uau o (0arerif iatlaD  neo t) eumxm ou4lle mivtls  2rmxmoot4texomictys sDumnms;t0 lenmociodfpDe nei ( texrim3iudoltnmfci sfaDrmu o;u4alx ii3tldls ra( snt0alxnif tadlmtr ueslt srtoir io4ll e nes ( srra(ro;t0opxo icilsfs rlnvsnt4arxrio3io1fptraies (0srtrimpnudoltnmietls)aruaxm nt1aexomo3iydfa2rmu s;u4 rtomo3oytom raneil( srtmxr oo1ap n fviat)s2tm( poo4tet  f3iatlm ran ont4areoxr todlm  auvi;s trumxmpiu1aptelnes (  rumu pou0olt ii3iyd a rmu p;u) exnmfciodoptrlnes s) eur(opnu4lmt  netls)sDrm(r oo0tlx ifetasfaDel( pnt0arxrxr3tatoat  ues;t0setr(opnu4llen iviasf rumx  oo1optniieias a ua(vs t)trtoxociatopt  uvols0teuoir3nodol elfvsa(f Durx  no1optnmocilt mDeln s u0aexoxrciatla  ai sl() rtoir3oy1lpt livsa( s2rmumo;u1tlxnmoeiadfmDum( on(4 etoxociytoaDeaiei;( teur(r io4alte nvsltf Duaurpou1opx  fctas s2rm( o;(4trxrio3oadfp eluvsl( sexoxopoydop nmivsa(f rrau p;o4olx iieiad m ulnvo;t) exoifcto1fpDranes t  rumiopou4lpee nvi (  rrmu onu1aexomi3iltls eaumo;u4aexrxf totfatrauvil(0srtr(o3nu4open feiat  Dtr(mo;o0tpeniociysla2ul(vpnt)aetnif3oadfm r nvs;s  2xmimpiu1opeelivtls s2rmxrpou0altnmf3iyd a elnmp u4 rxnio totop eanesl(  eum(r3ny4omtnlfci t  rumxmoou4tlxnioetysfsDelnmo;t)aetrxr totoaD lu slt) 2xo(opoy4lpe mnei (f 2ur( ono0tle  feild a ul( pnt0 reoio3iytoatrluvols)setr(opou4ap nmiciasfaDrrx p;o1tlx  octadlaDeln onu0 etrmr oodfmDe u s t  2xmxmpnodal eliei tfsrtrxr nt1tpx mocildfsDum(vp;t4 lxoxrcia1fptr ies (  rurimpno1ol e nctat aDtmxmonu1tpenmoeildla2ea( pnu0trenmo3iy1omD  i i s) etr(m3ou1lmt mivtas  2rax o;u1tetomieiadlm eanvs u4tlxomr3ty1opD  i i;t0t2umxr oo4ome livs (fa2uaur ;u1oex ii3iyd mDuln p t)teeoxoctytfmt auvi t)sexr(r3iu1ale lfcsas a2tax  ;u4olen iciyd m ulu p t)trenif oatlpt  uvslt trxrxm iydom e nvsltfsrtrum nt4tltnmietls m2rmnvp;t)artrxr iy1oa   uvils0truo(o3oo1lpee ivtas sDumump;u0opto ociaslm2umuvp t4arxnxrcootoa r ivil(  rurxm no4amtemies (  2tmx  ;u4tpt iocils a rlnvs u) etrmoctadlpDr nvo;t texoio3no1ol n ivs sfs2tmx o;t4apxnmfeildfa2rmu p u4arerxociotoa  au o t0srxmxmpno1om n netlsfsrrmu onu0opxn ieiysls2elumpnu0tltrmf iytlmtrli ilt0 etmxm oydom nlnetat)srtm( o;u1olt ifctlt mDulnvo;u0aexnmfcoytlatran ols srxo(o iodllenlieil( s2raxr ;u4ope ifetld a el(mo t)artrir io1lp  lnvi;( seto(r3iy1alen ict s a2rmxrpnu1tleoii3iydlaDrmnvo;()tlermr ty1fp  aieo ( s2xriopou1om  mnvsas  rtmxmo;o4oltomoeiadlsDumums;t0tltrxoctotlmteau ol(0srur(r nodlmtnlfcsl(faDtmuro;o1apenmfcilsfaDeanmo t) exoxrctatlm r ivo;( t2xm(o oo4ap emnvilt)sDuaxrono1aeeo octldla ulumpnt0tetrmr iodfat livs t0 ruriopoudam  mfcsat)arrmumoot4opxomieias s ra( p (0 eermf3totlpteln ol(  2xoir3nu4apeemneilt)arrau  nt4ape if3ildfaDum( pnu0 rtrxf ta1fp   uvi s srumxr3iodaptnlnesa()arurur no4oex  ietasls2emnmo;t)tleomo3oadla  anvo;s  rtrxopoo1amtn ict t)sDta(mp;o4apenifcilt m ean o ()aeeoxo3to1laDeaivo ( texm(m3ny4lm nliei t) rumum no0openmfctydlm rm(mo ()tleoxr iytop   neolt0 2xrxr3iudllt lfcs sf 2ta(m no4apeomfeiad a2elumo;u0aexrmr iodfmt  uvolt)t2tm(mpoodal emnvtasfa2rru  ot0aetomfciadls2um(vp ()teeoir3oy1la elies;(0trtoxmpoo1lm nlnci sfsDuru ont4oeen i3iasfs2umuvo u) rxomfcoo1lp   ieslt) rum(m oodapeemfetatfaDum( onu1oee iieiyt m2ea( ont) lenio ty1fmteaivo ()seurxopoy4optnlfviatfaDumum ;t0apenioeiatfs ulnvonu4 rtnir3tadomte ues;t s2xo(o3oydopt  fvta()srtau pnt4opt iicilslm2eluvsnt4aeerir oa1omt lnvo (0s2tr(o3ny4aptnlnet (fa2rrxro;u4tet ifetld s uaumo;()aleoif iadopD  iei;t0setoim3io4al  liesl()s2ra(rpoo4oexnmo3iatfm ea(mp;t4artoxociodfat luei;s srtrxm iy1lpe lfcsa()arururooo4apxomfctlslaDem( s;(0arxoifcoa1laDr uvil(0trto(m3ou1optn nvta() Dumx p;u1oltn f3tasfa2elu p u)arxnir totlm ran olt) exmxm iy4lpee ncils)sDrr(rpnu0alto ictas s raumo u0tetrmo3tytomtelnes;s s2trxr ou1olenmiviat s2ta(moou1tet  fciadla ulnvp u0artrircio1oa  auvslt)t2uoimpou1optnlnvils)arraxrpot1apxnif3tysls emn snu0aleomrciadoaDelues;s)setr(opio4op  lnetl(fa2trx pno0tlt mi3tlslaDrmnvs u0 lxnmr oatfa r n o s)srxr(o nu1altnlfctat a2urx  nt0olxn f3iydla2ranvp t)aetrxf oatfmDeli i t t2xoim oy1lpen nei () Dta(mpnt0ape iiciysfaDrlnmo t4 ltnxo3oa1lpt aieo ()srurirpny1lpt  nctas sruaurono1apeo ieildla2em(mo (4alxoifciodfa  li o;( s2tm(r3io4amee iesls aDtmumpoo1olenmfcils a rau onu4 eenxr oa1lm  anvslt s2xoxo3oodlptnlncsl(  rraxront4tpe  f3iys aDrmuvs t) eeoxo tatlpDr i i (0teur(r3iodopt lfei tfs2umxmpno4tlxomo3iytfmDrl(mpnt0treoxociy1oaDe ueo;(0teum(rpno1ol n neils)srrmxr ;t1aexniieiatlm2rmnvp;u)aeenmrcto1lpD aies;s)t2uo(r oo1ll  lfeia()aDua(  ;t0opto ictyt s2rm(monu0alxrmrcty1faD  ivo t t2triopno1ope mnvtl()sDua(rpoo0ape io3iltfa ra( snt4trxnmr oodla  lu o;t)trtmxopnu1llee fvtltf 2umurpou4tlen ietls a ul(ms u0tleomrciy1lp eln i s) eumxopnudoptemfcia(f 2trxm ;t4aet mfetlt s rmnvs;t4altrxrciodopD lnvsls0 rxrxr oodllt  fetatfsruaxr ot0tpt ioeilslm2em(vsnt4treomr oy1opDe u sls0sexo(mpno1lp e nvtas) Drrxmo;t4alxo feiadlsDul( o ()aetoio io1fa rai o s)s2xmimpnydape mncs s) rrm(mp;t0altnmieiasfaDuln ont)trtomr oydlat aneilt  etm(m nu4am nlncsltf Drrx  no0alxo fetas aDrmnvo t4 etnmr oy1lp rluei;t)sexm(mpoy4optemnes s s2umx oou0alen ociatlaDel(mp u)texrmo3tydfateanvs;s) rto(r nu4apeemnci s a2taxronu0olx  f3tysfsDemnvp u4altoxr oy1fa eanvilt)s2umxopoy1ale mfvtlt) rrrumonu4tlenmf3tad m ua(vp (0 etomo3ty1faDeaiei t  rtoxmpnu1alte fet (f Dtm( pnt1oltn fciyd a2elnvo;u4aetoirciadfmD ai ilt  exo(r ny4aptnlncsa( sDuru  ;t0altnioctydls2eaumont4tetrmr3tadfatr ivol(0 eurxrpoy4lmt  ivs s  Dur(rp;u4olt  f3tyslsDulnmo;u4 eenxociodfmDraivo t0seuoiopnu1alt  ici t) 2tmump;t1optoio3ilsfm rlnmsnt4 ltnif tydlmD lu ilt)teurxmpoodoltn nct t)srraxmp;u0aexnmieiysfa eaump (0arerxf3iatoaDeaieolt s2uo(r iy4opeemivsasf Drruro;u0altnmi3ildfsDelnvs;()trtoif3totoatrlueilt s2uoxr iy4lle  nviasfs2rrumo;t0tle  fctld s el(vp u)tleoxo3oadlmDelueo;( s2tmirpio4om nmncslsfa2rmx poo4oetniictytfaDelu o;u) lxoxocty1om eluvils) euo(opoy4ll nmfvtas aDraxr nu1tptn octatfs2em( p t0aexoir3oatoat lueolt0 euoxr3iudllenlies s) rrr(moou4oeeoio3tatfa rlu s t)tlermf3tadomt luvsls)srxm(r io1ap nlnetlt  2raxmpno4oetomf3iadfm ea(mp ()texrmr3ootlmtr uvi;s srumxr3oudopt lfci sf rrm(r ;t0aexoio3ilsfs ranmsn(0alxoir ta1lmteauvo;t s2xoim nu4ol elfct s) 2uaurpno0aex  f3tas sDul(vp;()alxoio3oy1opDr neo s)trtoxr3oo4omt lfvt tfarrrump;u4tpe  f3tlslsDulnmpnt0teeoifciadlmteauvo;s)t2xoirpny1al emietls aDuaurpnu1tlxnmi3tatla2elu p;u4tltnxrcoatopD aues ()t2umiopny4ll nmfvia(faDumuronu4tpenmoeils sDranmpn(0 eenmo oadomDeluvo;t0 2tr(mpiy4aptnlneia(fa2ra( pno0olxn feiltls el(msn(4tlxoxo iadlmteai i;s sexmim nu1olt lfviat)a2trxr ou0teen octas sDeaump t0tltrxrcoytfaDelnes;()trumxmpoy4lmenlivs sfsDtr(rono0tltoifeiytfa rm( p u)alxnmr3oy1laD aueo t) 2xmxm3iu1amt lnesls)s2uaxrpot1tlx mi3tltfa em( o u4trxnmocoo1opDelieols0setr(opoydolt  ict s)srtr(mp;t0teen o3ildla2ra(vs;u0 rxnxo oa1la  lnvo;t s2tr(rpoudal n ivslsfsDrrur nt1aet ifciytfmDum(ms (0arxoxf ia1omt li o t) rxm(m3nu4apt lfeta(  2uauro;u4opeo fetls mDumnvpnu4alxrmocoytfa rlivo;(0t2tr(o nu4opee ncia( arua(mooo1opx mo3tyd m ea( s;t4aexnif totom e i i;() 2umxr3ou1lmtnmicslt) 2ta(rpnt0olenmociatls2eanmonu4alxoif3iotoaD  nvo;(0srumir nydlm e netlt s2umx oou4aexniieiydlsDeanms;u0 ltoif to1oa   i i s srxoir3iy4lmt  fesa(f Duaur ou0tpe ioeiltlmDrl(vo;u) rtnio3tadfmDr neil()t2xrimpiudapenlfeilsfaDraxmpnt1tex moeiyslaDemnmo (4trerxfcoatlpDe ies;s) eumim3iydamenlfcias aDtmx pnt1oleomietldfaDrmnvont4alxoio3tatom rlieo;s)t2umir nydalenlfeilsfsDrru  ;u0aex  oetlt sDemnvs;u4 rxnifctytomt auvi t s2uo(m oodllenlnesatfartaurp;o4tlx mocias a2rluvo t0tetrif ootoatrai sl( s2tmxrpiudop e fctat) 2uaum ou0tpto ocils m ulump t0 etoio3iotopDr uvs ( s2xrxr ou1al e ncil( s2ua(m ;u0tpx  f3ilsfa em( pnu4aeermf3tytfptranes;(0srxmir3iu4ll e fet t a2umumpnu4altnifeiatfmDrmnvo;u)tleoir ia1lp eluvo s0texoir3nu1omtelieia() Dtmxrp;t4tpenmoeilsls2eln snt)arxrxf3oatom eliei;( srxm(o3ny1olt mfvils)a2ururpot0tlxnmi3iydls umnvp;t)tetoir ta1lm raivi;t)s2tmxo3ny4lpt mfes s  Dta(roou4alx io3iyslm2ranmo ()tetoir iydfmDeanvil()seuo(mpiy4lm emfesls a2rr(m nu4tlen fciys m2emums u4 rerxf3oy1omt  uvo;()srtoim oodol  lfcta()sDrrxmpno0opxnmociadfs2emnvs;t0arenifcio1lpt  ieo ( truoxr no1op   fviasf 2urx pnu4olxn feias m2uanvpnt4 leoxocoydlpt lues;t sruo(mpou4op n ivtltfa2uru o;o4ale if3iyd m umumo u0tltrmf3io1latrlies s  rtm(o3iudll e ivtatfarra( pnu1opxnmfeiadlm rm(ms (4texnif3totfp e u i;t0trxm(opiu1aptn feil(f rrmumo;t4tle iieiyd a2um(vpnt) rxnxfcty1la eli i (  eur(r3iy4amee fct t)a2umxro;t1tptoiictyd s2uau pnu0trermo3oa1om r n i s sexmir3oodol e fctltf 2umxmonu1tpxniieiadfa umn o;t0 rxoircio1lmD  ies;( trxr(o iy4llt  ict (f Dumxrp;o4tlxnmi3tysls2em(ms (0 reomo3tadoptean o t srumxo ou4lle  netltfartrxr oo1oleniiciydfmDran o;(0 rxnio io1optrai i;t texoxo oo4om  mnvtlsfarumxmpno1ope  o3iys aDra(vpnu) ltrmrcoodom eanei ( t2toxopoudolteliciat)srtr(monu0aetniictyd a ul(mp t)arxomo iy1lmtr uesl( seurxmpiy4aptnlncslt aDraxrpnt1optomicils a2emn s (4alxnmo3iadlpteluvi;s0t2uo(mpno4am nmiet s srra( ont0tle  oetys aDem(vsnu4texoxr3iadfa  lnei s)s2to(r nodllt lfeilsfsDrr(  no4alx  f3ildlm2uaumo;u)tltnmo3ootomt luesls0t2um(rpiodalte fcilt sDrax  nu1tpx moetys a2rlu s t0artnir iatfat  i i;t)s2xm(r3iudap  mnci () rum( o;t4oltnifctltfaDuaums;u0 exoif oo1oa  livols  rxo(rpnydamt  fvt tfsDumu  nt0tpx mietytfm2umnmsnt4alxoxo oydlaDr uvil()seurxo3io1ope  ivsas)sDum(rp;t1opeoifeiasfmDrlnvp;t4 ltnif3iotfmtr nes;t t2tmxr oy4aptnmivtlt  2rmx ont1tptniociad s rluvsnt0texnxocoytop   i o s  rxmimpoodopenlncias aDrrx  ;t0tpt ioetadfaDrm(vs;u)aetoxr3tytfm rau sl() rurxm3nu1llte ietat a2umxro;u1opto i3iltfa umnvsnu)tetoir oa1opDrauvils0 2tmir no4ol   fct t s2um( o;t1opxoio3iltfm2rmums (4altnxrciy1opt anvo (0teuoio3nu1lmtemfes () Dtm(m ;u0tetnmi3ildlm2uauvont)alermr3iatlmt anesl()sexo(opnu4olt livtlsfaDum(  ;o0tpe mieilsfa rmumsnt0 exomf3tytlm  au i;(  rumim3iodolte feiltfaDtrxro;u1openmieiat s2umumo u4 rxnmocoa1fpt li i;()t2umxopou4lmee nctlt)srurx oot4altnmieiysfmDumn s;t4trxnio totlmt auesl( srtm(rpou4lltn fctl( 
\ No newline at end of file
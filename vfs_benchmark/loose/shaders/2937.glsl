@@ -0,0 +1 @@
+u i s0sexoxr3oydlptn fes s  Draumo;u1opxnmietldfa el(vo u0areoxf ta1optrlivols0sruo(r io4apt  nviat s2tmum ;u1tpe mf3iydfs rm(ms;t)trxriociatfateaivs s s2um(mpnu1om  livia(  Drm(m nt1tpx if3iatla2raump;(4 exrir oytfmDeln o;(0 rtr(mpnu1ll   fct ( a2rrxrpno0alt  ociltlmDea( on(0 lxrir to1fmteli o s) etmxopiy1alenlncils  2tmu  ;u1tex  fctadlmDra(mpnt0 eenmf3ootlateaivsls) rxrxm ou4olt lnvilt arrr(ront4oet  fctlsfs rmumsn()aexrio3todlpDrluvi;s)trtoxopiydlpeemnctl(fsDtm(  ;u0ale  iciydls ra( on(0tetnioctatlat  neo () 2ur(o3iy4ol   fcslsfsDrrumono4tpt ifetls m2rlnvsn(4arxoiociy1fa eln ils0trxmimpno1lme mnvi t)artmxrooo4alt mf3iatfa2rm(vp (0tetnio3oodfaDr n s;(0srum(m oudapt  nci t  Dua(rpou0oetn f3iysfmDum(vs;t0 renxf3oydlpt ln il(0trumxo nu1ol  lnvtasfaDtau  ot4ole  i3ias m2rlu pnu)treniocto1fptrau sls) exm(o nu4opeelncta(  rraxmp;t4oeeo fctyt mDemnmsn()trerif3oo1fpte nes s)t2xmim no1al nlnet sfs2umumpnt4apxn icilt sDul(mp ()altnmociatlmteliei s srxoimpnudap emnctlt srua(rpnu4tltnmf3iaslsDuan snu)arxnio3ta1oat li sls) rtoim3iodameemncsas) 2rr( onu1aetnmfciad s2rmumo ()tlxomf todfaDe u o (0 2ur(m3nydame livtltfa2rmxrpou1tpxomo3iysfaDean s () rxnxf todfm e ivo s0seumxr3iu4altnlfvsasf rrru ont0alxomociadlsDeaumo;(4 rxnmoctadfaDeluvo t  2xmxr3ou4lp n ivi t aDua( o;u4tptnmoeiltls2eau pnt4teermo3oodopDe u ols  2toir3oudalt lfci ( arumurpoo0olt mi3tatls el( p;t4aetnmfctotla  aues ()sruoirpoydom   nctas)artr( oou1tptn octadfm2eau s ()altnxr3ootoatelivsl() 2xoxr oy1opte nvt tfsDrm(r ot4teeniietls s rm(mpnt)tltnxf tatopD auvs t trxm(r3iudopenmictlt)srta(mooo1aee mfetyslm emumont0trxrmf3oy1fpD aneols) 2xm(m oo4lpee nvilt arrmx o;u4tlx  o3tldlaDrln s ()alxrio ta1op eaies () etr(m iodlm nmnci s)arrmxm ;u0tltnmoeiltfa ulu p;()trxrmrcoytoaDran s ()sexrim ou4olen fctls)srta( o;o4tetoiieiatfs rmn p;t0artrmo oy1fpDelneo s trtoimpoy1open nct t)arrmx ont4opxomf3ilsfsDrmuvs;t0trtnmr3oa1om eai i (0t2xmirpio4lp  mivtltf 2trurp;o1aex  i3tyt m2uau o ()trtoio3oydlaDr u o t0trtoio oo4lme mfetls)srum(ro;u1oetnii3ilslaDrmnmp u0 rxrmf3tadlmteluei;s0 rtmxm nu1ap  lnvsl(fsDumu  ot4apxnifctatlsDumumsnu)aeerxf3iy1omtrau o s) 2xm(r iu4om n ncs tfsrururp;o1tlx  ociyt a eanms;()aeenmrcto1fpt  nvs;t0srum(o3nu1omt  nctas) 2rmxr ou1alt  ictydlm ean p;u4 ltnir3oa1opDraivs s)setrirpnydam nmnes sf Dtrxmonu0oetnmo3taslaDeanmp () etomo iytla  lnvi;t0srxr(m oodlmtelncs (f Dra(  ;u0tex mociadls2rm( p u4 ltoir ia1faDran o s) 2uo(r3iu4lp nmnvia(f Drrurpno1opt  ieilsfm2rmn o;u) lxriocoytlaD anvols  rtmim oo1alt mfvtlt)s2uau p;t1texn iciyslm uanms;u) ltrmo3oatfm   uvs;t)s2uo(r iudame  ncs s  Dtax o;t1oexniieiysfm2eau o u4 rermf ootfaDrlu ils  ruoxr3iudolt lnvs t)sruauroot0oeeo fetas aDranmpnt)alxomr3iydopte u s;()s2trxo oydamte nvs tf rra( o;u4aptnio3ilsls ul(vp;(0trenxf3ia1lptr u s s s2xoim3iydamtnlfei ( srtm(rpnt4opeoio3ildla2ea(mpnu4alxrxrctodlpt lnvolt0s2tm(rpnydll  lncs (fsDrrurp;t0tpeo iciatls2uln onu) rxrir iy1fpDelues t0seuo(opoudaleelictas)s2tmumoot4teeoifciydlm rauvp;(4aexrxf ta1fatraivo;()t2umxopiu4lp elicsa(f 2rmxmpno4tltn octat a ea( o u0trermo ta1oat luvi;( srxm(m3oy4amtemncsls) 2raxmoou4olxo fcils s2umu s t0 exnxr3iatoa eau ols srto(rpnudopen fes ( artrurpoo1opxnifeiadfm umumo u4 leoir io1fptr ivo;( t2trxo iudap  mnci s sDurxmpot0alxn oetydlm2rmuvsnu4teenmrcoytopt  ues ( s2to(r3nudllte nvsls)s2tau oou0tle ifciytfm2em(mont0teerxoctotlp r uvo;s s2umxopiodop e ivi t srua(m ot0altnmicias mDua(vo;(4tlxrio3iodfa eanei t)trtoxo3iu1llte ieil(  2rau poo1tptnii3ilsls uanmo;u)tltrmoctadla   ivo;s  eur(opoo1apte fesls  Dumu pnt4oeto fctlsfa2rl( p (4 etrxo totfptraieo s0srur(mpoydap n ivsl()artr(mp;t0apen feiatfa2rau pnt)arxnioctotlm rlueolt  exrxmpno4ol  miesas s2tm(mp;o4tpxoio3iltlm2rauvp;u) ltrmo ia1opt lneo;s0s2uo(mpiy1am e netl()sDraurpno0openifcilt m ul(msn()arxnmr iytfa  ln s;( trtrxr oodame liviat)sDrrxr ;o1aeeoioeiytfaDeaumonu0artnircootomtrauvo;() rtm(o3ny4lpen ivias arumurp;o4opxomo3ildlsDra(ms t) exnir3oatlmt lnvo t)trurxo3iudolt lnvtas aDtm(mo;u1aeto oetysla2el( p u0 rtnmociytlm r nesls0srurir3ou1lle lnviat) 2umurpot0tpx mietytlsDrlumsn() leoxr3tatfmDelueils0srtm(opiu4omt miei t  2tru oot4optoifetld s2uln s t4artoxo tatfa  ln sls) rurxrpio1lpte fes t)sruaxrpou1aetniictld aDrlumon() rxnmf iy1fmDe i s;s teurxopoo4ame mnctl(fsDra(mono0aetnmi3iat aDraums;u0trtrmf oydfmDrai i;t)srxr(o3io4aptnmnvi t)aDurxmpno0tetnmfeiydlmDrauvsnu0teenir3oo1fptr uvs s0seumirpou4ol nlneil() Dtax  ;t0tlt moeiltfaDrau s;u) eeoxf to1fpt aivsl(0 rxrxo3iudomenmncsa(  2ra(rooo0oeeomiciyd mDul(mon(0 rxnxf tydfa  auvi;( t2urxmpoy1lpenlnes s  Drrxmpoo0oeen ietls s ran sn(4artrmrciadopD ln i t0 rxoiopio1optnlncil()aDum(m nu4ape mictatls2em( s (4 ltoxrcia1oaD  u i;t  euo(m3iy1amtnlieta()sDua(mpnt1tet  ietldls ranvo u0 lxrircoy1oa r i i;s0trtoxopoo1amt  icilsfa2tmu p;o0tpxniieiltfm eau o;(4aexoio3iotfm eanes s0trurxr3io1omtnlfvi sfaDta(mont1apx mfeils mDeauvs;t)texrmf3oadomte nvi;s0t2xr(opoy4ope  ictlsf 2uax onu4openmo3tasfa2uaumpnt4 ltrxrctadfpteai s;(  rumir3nudape  ieslt)srua( poo0aleo feiytfaDemn p;u0tlxnxrcoydoaDrlu o;t) ruo(rpoudlptemnvia(fsDtr(rpou1tet io3iaslsDumn p;u)artoirciatlmtrli sls)seurxo iydomt livs sfa2urumonu1alxnio3ils m2ean p;u0 rermfciydlate uei;t0t2xmxr3nu1ol e iei ( srtru o;o1teenmoeildlsDran p u)trtrif todoaD li il() rxr(opiydll nmivt s) 2tmxmo;u1oeeomo3ilslmDeanmsnu)arxnmr todop r ivs;(0srtrim oo1lptn fcsas sDrrumpou0oeeo o3iyt m2rmumon(4aexrmf oodlatran ols  exoxmpoudopee nvsat)srtaurpou0aeeoiociytlmDraums;()texoiociodlp  lnvs;t tetr(mpnodlmee nes tfs2ur(mooo4oleniieildls umuvpn(4 exrmr tadlatean s t)t2tmir3no1apt mnvsl(  2rm( ont1oexoiiciatfs emn s;t0arenirctatopD lnvo;s) 2xm(opnydaleelivsls srrr(rono0tet mo3ilt sDrm(vs (4trermrcta1fptranes (  2xoio3no1amtelicilt)a2umu oou4tpt iicildls el( o;u0tltoxr iatlm elneilt setm(rpiy1optnlnvil() 2taxrp;o1aexn i3iltla um( s;t4 lenif iadfmDr n o t texrxm ou4altn nvs t srtr(mo;u4tlt mieiys a2um( onu4trxnifcoo1lat an o s0 rxmio iydlp emncslt)srra(mp;u1aeen o3iys s2uanvs (0 lerxf3ia1oaD ai o s)t2uoxrpoo4ll emfcsl( srumu  no4oetniocilt m2raumo (4trtnmf3to1laDelu i t s2xoxr3iy4lme lnesat)aDrrumpno4olt mfctls aDeluvont4tltomo iytfmt lnvs s0sexo(r3ou4oltemivt ( aDtm( pou1apeoifeiadfmDelnvp (0 etrio3io1fat aieils0s2xmxr nodlme licslt)s2rmu ooo1aexnii3iltfaDumuvo t4aexnif tatlaDrauvils) 2umimpny4ame mfci tfsrtr(r ;o4aetnifeildlm ea(ms u0aeerir iotfateluvsls)seuoxo iudope mfcs tfa2tax o;o4opt if3iaslmDem(mo u0tltnxo3oo1lp  ai ils) rto(m nydolen ncia() 2ta(r nu4teeo ociatls ul(vsn() rxnxf3oadlmDrluesl( s2xmxr3oy1omtnlivtl(faDtr(mpot0tlenmfetlsfaDemnmp t)arxnir3to1lm  an o;()texo(m iu1am elict sfsrumxrpnt4oeto oeiys a2ea(von(0tetnmr3iodoaDeaivs (0t2urim oy4opte fcs t sDuax pot1olx io3ildfs2emnvo;t4 ltrxfctydlmt liesl(0tetrxrpoy1lpt  fctls) ruaxrpno0texn o3tldfm umuvp;(4aleomo ia1lm  anes s)t2tmio3io4ap nmncsls)a2tmurp;t0oexomfeiaslm2ulump;() exoxr3tytopt lieo t srum(m3oodopt mneia() 2rr(  ou1tlx ii3iasfa ua(von(4trxoiocoo1omt  i i s tetmxmpiy1lpee fvsat)srrmxm ;t0apxnifeiysfs2umu o;u)aeerxo3oatoa rli i t0sruoxr nydolt lfeia( a2tmurp;t0tetnii3tltla ean snt)tetnmf3to1fpt  ueils srurimpoydapee nei sfs2rrurp;u4oetn ietyslm2umu o u4tetrxr3ta1lmDraiei s0 etriopiu1lm e fetlsfaDtmx  ;u4opxoiociyt a2ra(mp t0tlerioctodfm eaivils)t2trir3iudllen fetat s2urxroou1teen fciys mDrlnms t4 reomr tadomt aieils0s2xrimpoy4am  mivtltfsDua(rpnu1tle  f3iys s2rmums;t4arxnxociytfpDeli olt) rtrim3no1optn fetltfsrtm(root4teeo feiysfm ra(vpnt) etrxrcta1opDr n s s sexoiopny1op  lfctl()srua(mpoo4olenifcias a2emnmpn(0alermf io1fate neslt0srtm(r nu4lp eliesat) rumu  nu4alt  fctysfaDeanmp;u0 eenmr3ta1oatraieslt t2uriopnu1lltemneslt  rrr(mont4alxoio3iaslm2rl( p t0 etrxo3iy1omtrau i;( s2trimpiu4ll  mfvils) Dtr(r ou4alxomictatla el( sn(4tlxoxr oadlmtrai ols s2xr(r io1am  lncil()aDrmxrp;u0texo octat s eauvpnt)teermr3oo1laD au s s0srtrxo oo4ll nlfeia( sDumurpno4opt  ociatls el(ms u)aeenxfciatfp raivo;(0 rxr(r3nu1am emivsls) Dtrur ;o0tpt if3iyd sDeauvs;(0aleomf3ootlmt  n s;()tetrxo3ny4omtemncta(  2rmxmonu0tleomoctyslaDra( s t4aetrmociytlp e u i ( setm(m oudamtn nvsat arum(r nt1oltnmf3ilsfaDel(vo;t0alxrmrcoydfm e n s;()seur(o iy1am  mictlt) rrmxr oo4tpx moeiyd sDem(mp t0areomo3ty1fat aivs;s s2xrxopnudale mnctas arrrumoou1opt mo3iysfm2umnmo t)tlxoxrcta1lmDelueo (0 euoirpoy1ll n nct s  2ta(rpnu4tptnifeiytls ulnvp;t)tlxniocoy1opDr ivs s) rurio3io4open fvtasfaDuaumo;u0tlxnmo3iatls umuvs (4 leoir3oadlpD aivil( seto(r3io4lme lfei s aDuauroot4tpxomi3iadfs ra(vp;(4 renxo3ootop e i ils)truo(opoo4opeemfvtlt srumx pnt0olxoifctlslaDuan p;()teerif iotomt ln olt texo(rpnydop  mnvtatfarrmx  ot0alxn f3tls m2rluvsnu)arxnxo3ta1lp rliei;s trtr(r nu1omeemnvsl() 2rmump;t0aeto ieiltlmDrau s;u)tlerxfciodop eauvs;( trxoxm3nydalt  iesas srra( p;o0olenmieiyslm eauvo;(4trxomfcoytfat  i s;s0 2um(m3iodlpt  icils) 2raxmpnt4tpx mfetlsfm em(mp (0artrxr iotfm rli i t0t2xo(m oo4om nlnvsltfa2ua(  nt0aptomfctad a umums u4 ltnmf3ia1fmt ln sls) rtm(r3oo4am elfetlt  ruau o;o4tlt  o3iyd m eanmp;u4tltoio3ta1lpDeaneolt0trtmir3ou1am  mieslt aDrruro;o1aetnmi3iltlmDul(mpn(4aexrxf3iydfmt lies;s texoio ou4opt  ivtltfarua(root4alx  f3iysfa2rm(mp (0treomr3iydfa eaueils trxoxm oo1lpe  iei tfs2umxro;u1aee mfctadfm uan o;()tltoxo3oatfpD  uvsl()t2umio3iy1ome  nvs () 2umumpnt1tlenmicildlsDuanvs u0tltrxr3iytfp e u ols tetoir ny1ale mneils) Dtr(  no1tetoiicilsfsDea(ms t0alerircty1fmDrlu ils tetr(r3oydope  fetl(fsrta(m oo0aexomfeilt m2umnmsnt0aetoio iatlpDeauvs;( t2xo(opoo4ap emies tfs2tm(ro;u1oexomo3tatfa uau p (4 reniocty1omteaivsls  2tm(m3io4omtelnvtl( a2uru  oo1oexn ociysla2um( s t0altrmr3ootfmt  uvo;(0 rxo(o3no4omte fvs ()arrru ooo0altoiocils m uluvp t4tltoxf3io1laD  n i;t sexmim nodole mivil( sDrrxrp;o1aet moctldlaDeaums;u4altomr3oa1omDrauvsl(0s2um(r3nu1al   ici tf 2ta(r nu0tetn fciyt s2ua(mp u) lerir3tatlpt ln o s t2xoxm io4am   nctasfarrmxro;t0tetomoeiltfsDran p;u0 ltoxf3iodom eluvi;s t2um(o nudolte fvsltf rur( pou1oetnmieiadla2rlu s;(0areoxo tadomDrau ols truoio no4amte net sfsrumump;o0tlxn fetasfa2um( sn(4 rtnxr tydla r u s;(  exoxo nu1ale mietltfarumx oot4alxnio3iatfa2rm(vp;u4aleoxfcootlm elies;t0teurxo3nudalt  nvilsf 2tm(m ;o0tex mfciyd a2umumo;t4tlxrir3iodfat anvsls0trxmxr ou1lmenmfcils)sDumxrooo4tlt mfeils m2emu pn()arxoio oadlaDraivo (0 exo(rpny1op  lnesl()s2tau pot0altomieilt m2umuvsnu4altrxocta1laDe n s;t0srumxmpiydlltnmfeilt)aDrr( pot4oleomieiltfa2emnvo;u0 rtrif ty1fptrluei ( tetmirpny4llt  nesls arurxmooo1tpt ioetysla2rmu s;u0 rtnir3tydomD li s () exr(r3ny1lle mivi s  rta(m no1aexomietad aDelnvo;u4aexrmfcto1fp elivi t tetr(o3oydam n ictl()aDtmx  ;t4ale  o3iasfs elump;(4teeoircia1lat aivi t trtrimpoo4amenmneilsfartau p;t4tpt if3iasla ua(vp;t0trenxr tytfate i i;t0srtr(r3io1am  lnvia(f 2tr(  ot0oexoii3ild s2rmumo u0tltomf3oatfm   uvo s trumio oy1ole  icsas)aDurumpot1oet  f3iltlaDua(msn(0trtrifctydfp eauvo s)trurir3io4optnlicsas  2rmx o;t0tpx  ieiytfa2ranvsnt4 rxomr3ta1om eluvo;t0srurxr3iu1ap elnctl()artauront4alt  fcilsls rmuvo t4areoio3iy1lp ranvs t)teto(m3oydal  lncil(f 2rmx o;t0oexn oetad s ra(ms;(4 exoxr ty1fmDrluvs t) rtr(r iydamte nvsl(fs2uax  nu0ale ifetyslsDeluvo u4artnxocoy1fat lieo;t0 rtoio no1amtelfcslsfartm(mpnt0opxomociydfsDuanvo;() rtnir3iodfmteau s ( s2toio3ou1lpeemivsls)sruaxmo;t1apxn oeiadlm uln p;u0 reoxocoadlpDe n o t0sruoxopou1lpee ncta(f rua(  ou0tleniieiadfsDemump ()arxnxr oo1fptr iesl()seuoxrpnydalenlncslt) 2tmumont4alenio3tls s rlnmpnu4teenmr3iatomt luvs s  etrxo io4lp e fcta()a2ra( o;o0tlxniietltfa2eau p;(4 renxociydoaDraieils sruo(o3iudol   nei ( aDtax  ot0opeo oeildls2rl(vp u4tltomo iydfp   u o;()setmxr3ny1altelict s sDtmxr ot4olto fcilsfs2elnvo ()trxoio3iotoptrlies t) rurxmpio4llt mfviatf Dur( pno0tlxnmfeiat m2rlums u0tleoirctatfmD  uvsl( srtrio oodlleemict t  rrmu  ;o4oetnmfctysfm2rauvsnt) lxnifcoytlptr nvo;t0sexo(r3io4omtemfvtl(fs2rmxm ou0olx ifeiadfm eluvp;u)alenxocoytfmteanvi t)t2tm(r io4lp e neia()aDumxmpnu4opxn fctyd aDeauvp;t)tltnxo ootlatrluvo t tetrimpiudaptelieilt) rua( ono0tpx mi3ias s rauvsnt0 rtrmfcoatfp e ueo t srxm(r oy4lme mfeiasf 2rmxmpot4teeoiieiltls rmn pnt0 lxnmf oatopDr ivs;s)t2xoxrpoudomtelncsl( s2ra(  nu0oet iietldfaDumump (4aexoxf tytfmtelivi;()tetm(rpiu4omeemfvtasfsDuaumooo0ole mf3ias m el( s t4teermrcoo1fm  luvi;s trurirpnu4lpt lfvsat sDraxmp;t0tltn ictlsls rmu o t0altoxf3tydomDr u o;t srurxm3iy4lleelncias) 2raxrpou1tleo feiysfsDel(vo u0tltomf ta1fatr nvol()sruoxr oo1apt  fvtls) Draxront4aeeoioctytfm2rlu o;u)altnmocootomDr uesls) rxrxmpoydame  iet sfsrrru p;t0texniietltlmDrau s;(0texrmo3io1fpte n olt0 exm(r3nu1lle  nvtat sDrax pnu1olt  oetyt aDulums;t)altoif3iatla rau sls  2uoxr oo1lmt mnctl(fs2ur(m nt1tpt  fctlt sDrln o t4 lxnmf totfaD aueo;t)texm(r3iodll  lieiat  Dumxm ;o1texoiocild m2ra(vsnt4aexnxr to1fm elies (0trur(opiy4ole livils)artax  oo0tetomi3iaslsDeluvont0 rtomo3iydlmtr ues;(0 euo(o3ou4lpenlfvtlt s2tmxroou0tpx mfciydlaDeaump;u4 rxoio tydoa elieo;s seumimpoo4opte netl() Durump;u1tpeomocild m2emnvonu0areoio tydop r ies;s)seum(opiudap nmnvias)aDumx p;o1olxo f3iadlaDul( s;t4 lenirciatomDr ivs;(0 rumxm oo4al  lncils a2ururpnu0apt mictas mDua( s;u)arxnxf3oa1oaDraneilt) rtmio ny1llt  fctas) rrru o;u0tlx ii3tasls2ulnmp;() rxoxrciadfmtraies;s)seum(o iu4om e fcs () rtm(mpot0tlenmoetadfa ua(vonu0aetrxr3iadlm rauvs;( srxrirpoudllee icsa() 2rmur ;u0aetomfeilt m2elnmo u4 ltoxo iadfpt auvslt)srxoxo3oodllenmivs sfa2uaurono0alx mictad mDrlu ont4tleoif tytfatrli o t0t2xmim no4lmtnlivs tfsDra(  nu4oee ifctatlaDelnmp ()aleoxr3iotlp  au olt srxmxmpoo4apeemivt (fsrrrur ;o1texoif3tlsfm2ra(mp () rxnmrcoadfaD  neo s0srxmxr3nodoptnmnvs sfarrr(rpnu0tpeo ietysls umu p ()aexoxo tydfpDr uvs s srxr(m3io4ome  nvi ( s2rrx pou1aeeoifciadfaDelnmsn(0alerxo oa1laD  ies;s s2xrir3io4apee fvi t s2uau  oo4ope ioeiadfs rmump t)altoir3to1fm elivolt sexr(opiu1lp  mfvtls)a2uru pnu0tptoiietad a2rmums;(0 ltrmf3oa1latrlieol(  rtoio iudapeemnet t  rrm(mpou0oexn f3ias m2uan o;()aeeoifcoy1lptrlneo;s)s2xr(r3io4lltn nvia( arur( ont0alxo feiytlsDrl(vsn(0 rermf3iatlptelu i;s0s2tmio nodamt lnci sfs2uaum ;o0aeen i3iaslm2emnmsnu)tleomo tatla elieols)setmxr iydlmtn ictlt  Dtrxmoou4oex ioeias a2eanvsnt0 exrxf oytfaD aivs s) exr(rpiu1lpeelfciasfarra(mp;u1opt ii3tasfs2el( s;u4arxoio3tadfp r i o;() 2um(m io4oleemnci sfsrtm(m oo4open oetytfmDul(mont0trenxo3iodopDeluvil() rtr(mpoydal emfvi t)srumumpnu0alx ifciydlm2rlnvpnt4 renxr3io1om ranes ()sruoiopnudlptemncs t  rur(mo;o1aetnif3tadfs rlu sn(0 exrio iadlm e neo;s trur(r3nudlltemfciasfsDuru poo4aexomoctadfmDem(mo;u)arxnxoctydlpteauvsl()s2to(r3oydlmt  ici t s2ta(ront0opto o3iatlm umump (4aexrxr tatfmtrlies;t) eur(m iu1amtnmnetlt)sDtmx o;o1tlt iociys m2rl(vp u0aetoxfciytlmtr nvs;s)srxmxr3nudlptnmicsas arumur ;t4aptoifeiytlmDul( p;t4aeeriocoadopD aneolt0 exoirpoo1amee nesat)s2ur( poo4apxnif3tytls ea(vp u) rxnxf3iydla  ln s;s0 exriopnydlmtnmfcia(faDuru ono1tex io3ils mDua( o;u0 rtrif3ty1oatrli olt sexr(rpou1ape lict tfa2rruroot4aeeniictysfs rlnvsnu4 rxoxfcta1lmD ai s;( teumio3io4ll  mietls) Dtmxrpnt4opxn i3tltfaDra( o;t)texoxf3iy1opD  n o;t0 eur(o oy1lm  mnvia(  Drrx pou1aexnmoeiadfa em( p t0arxoiociotlmt anes;( s2toxo3oy4apte ivs tfaDtrxr no0oex mfcildlm2raump u)tlxnxo3io1op   ieo;t0seuoxm ny1lpeelfes (  Duaurpoo4aee  i3tytlm eanvo;u4aexrmr todfm  anei;() 2tmiopiu4ope mfcilsfsDtaxmpot4alxomi3tasls2ra( pnt0 eeoir tytomtr i sls0setmxr3no1am n fctl(faDrr( p;u0apx moeiatfa eanvo u)texrifctodlm rauvi;s0 etr(o3iu1lmt mfvsas) 2trumoot1tlxn feiydfs rm( s;t4aetrif totfaDr i sls teto(r oy4omt mnctas)sDra(m no4oleo oeiytlaDea(mo () rxrxf3iotlpD anvslt s2umir ny4aptnmfcsatfarrrurono0oet  f3tytls uauvo t) ltnif3oydopD livs s s2triopnudap  lics t) rurum ou0tee ifetas a rauvs;t0texnmo3oytoa   ivs (0srxo(m io1lp nlfeil( a2raxr nt0aeeo ietltfm rluvs;() ltomo oy1oat lu sl()texrxo3ou1lpen icsas  rrr(root1texomoeiytls2um( onu0texnxf3iytoptraies;s setoxopoo4ape  nvs sfsrum(ro;t1tlxoii3tyd a elumpnu4 rxrmr3oodfa r ivs (  euoxo no4lpt  nciltf Dtr(  ot4opxnifciat sDel(vo u) renif3oa1fatr uei (0s2uoiopio4olenmfesasfa2tm(ro;o0oeeo o3tat s uluvs;() exnxrcoodla   neolt)s2xm(o iudol nmnvs t) 2tmx  oo1tpen fetlslmDeau pn(4artnmf3io1lm raneils teumxm ny1ale  ncias aDuaxrp;t0teeo fetatfaDulnms;u0tlermr iatop eauvo;(  etrxopou4amenmivsat s2taur ;t4oexnmfctlsfaDranvs;(0tetoxociadfm r u i;t0 2uoxm ou1altn nei s)s2uru pnt1olx mfetys m2ulnms t)arxnmr totom e ueil( trxoio3nudll n icsls aDuaurono1oexnmicias mDumnmo;()aetnifcia1lm eaueo;s srumimpoydapt mieta() 2rru pou4olxomfetysla rmuvont4trtnmr iydomte ues;(0teum(r3nu4aleelneiat) 2tax poo0tlenifctadfm ranmsnt0tltrmo totoaD luei;(0trurim ny1llee feia( arraumpot4olxomfctltfa rmnvs t) exnmo3tatomteauvi (0t2xo(opiu4alee nctlt)artrumo;t4olxn feildfa uanmp;u0arenio3oodopDeai o s t2uoxmpiy1apee fcsatf rtmxm nt4oet mfeilsls2uauvp (0 exrif3todlmD liei;s)trtmir3no1lpt  fct sf 2raxrpno4tlenifeiatls2ua(vo t4tlxomo3oo1oa eaies t0 etoxm3io1lmeemnctlt  2umx ono1tpenmi3iysfm2ea(mp;t) eermocoo1lm   ueol(0t2toim oudopt  icsls srta(  nt4tle mfetlslaDumnvsn(0trtrmo3iadomD luvs s0 rtoxr3io4aleemnvsls aDrmxmoou4tlxnioctysfm rl( s;(0aexoircoy1oaDeai s t  etoio3ny1amtnmnct t a2ua(rpot4oex mieiatlsDul(mp u)arxnmr3iodom elneo s)s2tmim3nydllenliviat srra(rp;u1oeen fctld a elu on(0 exrxociydlatrlivols0 eumxo iudlp emncs (fartm(r ot1oltn ieiatla rmn o;(4aleoircta1laD livol() rxmxm oodllt lnvs sfartmx pot0aee mieiadlaDem( o;(0alxnir ty1op rlu s s0t2urim3ny1ap  mivi sfsrtm(r nu1apxomieiasfs rluvp;u0 lenioctadopD aues;s)s2xm(m iydalenmnvtasfa2tmxm oo1olxomictld m ea(vs;u0alxnmf3iotlpt aueo;(0t2toimpnudlpt  nvt sfa2tax o;u1tpe if3ias aDrmn p;u)aleoxfctydlm raues;s sruoxo3oodaleemnei s sDtmxrooo0tltoiictatfa2uauvs;t4 rxnmo3iadfaD  ivi t0trxoio3ou4ll nlfesatf 2raxr ou0oltomfciltfmDulnms () lenxf ty1opDrlivi s  rto(opnu4ale  neiasf Dtm(m nu0tltoioeiadls2em( p;()arxrxrcty1op r nvsls)trtoio io1omt mfvs t) rtr( p;o1oeeoiociadls2ea(mon(0texoif ta1la rlivilt0 2urio3no4op  lfcils)aDurx ooo0opxn o3iyt sDeanmo;t0 etoxf iotfpD lu i s trxrio iydop n fvtlsf Duaurpnu0opeomfeiasla uanvo t4 etnirctytfatr i s;()srtrio io1ll emivtat a2rr( o;t4oet ioeiasla2emuvs ()tltriocoodfp e ivslt s2trim3iu1lpee ncsl(  Dra(r nu4tee ii3tasfa2uau o;t0tlxrxrcoadom r nvo s0t2xoxopiy1omen ncsl(fartmuronu4aptomoetyd aDua( p;u0 exnio oatom elu sl()t2xrxo ny1olee fvilt s2ua(monu0open ieiatlmDranms;u4trxnxrcoydlaD au s ()srxoxm3io4ol  mivtlt  2um(mo;t4tetniietat a rl(mon(4arxomf3ia1fm e ivs s)trxr(r nu1lpt livilt) 2raxr ot1apxo feiys m umump (0 eerxo3oadoaDean o;t0 eumxo3iy4ol  mici ( srra(r nt1tpt  ociysla2umuvonu4aexomf3oa1lpD  nvo ()t2urxo oo4amt mfct s a2rmumpnt0opxn ociatlmDeanmpnt4 ltoio3iotlatraivo t0 2urir3iu1ale mncsls)sDrm(r nu4tptomfeiydfm rlnvsn()teermrcoadlmDrau s s0trxm(opnudlp  mici ( srtmurp;u4texnmoetasfsDemnmsnu)tleomo iy1fp  lnvs;t0teto(opoy4aptelnetlsf rrmxmp;t4optnioetltls2eauvo;(0 exrmf iydlpDr nvil(0teuo(opoodlmtn fciasf 2tmxmpot1optnio3iadlaDuanmp ()areoir iatla  livols)srtmimpou4lpee neta( srrm( pou0opeo iciadfa2el(vs t) etnxo iadlpD livs t t2xrim3oo1oleelnvias srtmu oou4apeniietldfa emuvsnu)tlxnmfcoatomtrln o t  2urxr nu4olt licil(  Drru  ot0tlenmfeilsls ua( pnu4teeoxo3ta1lm   i s;t0 rumxr oo1lme micsatf Dua(r ;t1optnmfciysfa2uaump ()arxrmr3iodlaD aieol(  rtoxm nudlmt  fvsas aDrmx ont4aexoioeiadfm2uauvpnu0tltrirctodomDraueo t t2uoxmpio1lp nlnvsas) rra(rp;u4alt mo3iat a emnvpn(0arerxf tydlatr i i;(0tetoim3nudoptnlivsat) Dumur no1olxoiiciydlaDum( p;u)trxrxo3iodoatraivils setrxm3ny4omt mfet s)s2tmu pnu0apeoif3tytlmDulu o t4 etoircto1lp  livi s setmim3nu1opeemnetatf Dtrxmpnt4ale mociadfsDran o;()trxomr3tydfaDrln ilt s2uriopiy1lmt liesasf Dtm(monu0tlen o3tltlm ean p t4 rtrxr iadlp   n s;s)tetr(mpnydalee nvtas s2umu pno0alt ii3ilt a ra(vo;() etrir to1omtr ueil(0srumim oodalenmnviat)sDuaum ot1texn oeiyt m umu pn(4artrmo tytfmtelu i;t) 2umxmpny4lltn fvs sfa2ua(r ;u1oeeomfciltlm2rmump ()tlxoio3io1fmteln il(0s2umxo oy1ap nmnciltfs2uaxm ;u1altomi3iytlm2eln sn()aetrxf3tytopDe neslt0 rum(r3oudom n ietls artrxmoou4aptnmi3iydfs2rm(vp;u4tetoxfcty1omt anes t0 2tmio iodamen nciat  2urx ooo4tetnmi3tlsfmDrmumo;u0 ltoxrcootopDe i i;t)sexmiopnu1op   ncs ()a2rau oot4tpeoiieiltlaDranms t4 eenmo3tytomDrlneo s) rtoxm oy4omt mfcsls sDraxmpnu0tpe  octas aDuau p u)trtnirciytfmtrln i s0 rtrirpiy1ope  ies (  rrrurpno1aet ifcilsfs2rmnvsn(0artoxr3iy1fa   n o;()sexoio3ou1alte ici s s2tr(mono4aexnmi3ildlm umn s (4aexrxr3iy1fpD lueolt)texo(m3ou1ap n nes s a2uax o;o0apxn i3tadlsDemn pnt4 rermociy1opDeln sls0trtr(r nu4ll nlnvslsfsDtm(mont1oetomf3ilsfa emu snt) etomr ia1omteau il()trurim3iu4amenlncsltfs2rr(rpot0tlt  iciadfm ean pn(0artrmo3iydfm e ueo t0 exoxo iydlpe micsa()aDua(m oo0opxomictlsfa2rmn s;u)tlxnmo oy1fm rlneo s srxm(o3oy1ape lncsls) Dtmuro;o1alen o3iydfmDeau s ()tetoio ia1laD auvol( truoim3nu1lme mncilsfs2umxm ou1apx mf3tas m2emums (4trxrmo ia1lpD  nvo;( s2xmim iodomtemnvt s  rtr(rpnu4olxoifeilt sDemuvs (4artomrcoy1omD  i ol(  rumxopiodlp   fvias sruaxr ;t4alxnioeiys sDemnvon(4 rxoxr3totlmte nes;s)s2toio iy1lm emnvtls srtmump;t0texnmoetyd mDemn p;t4 rermfcoytomD  i i ()seuo(rpoy4apen icsasfsDtr(rp;u0opeoioetlslsDuau o;(4texnxf3oatoa e ieo;t) euoim nydom nlncs ()srrmu  ;t1apxomoeias mDra( p u0 ltrmrcoodfaDr u s;(  eumim iu4am n fvsa(f 2ra(m ou4opx ioetysfaDea(mo t4tetnif3ia1lmt  neolt) etmim3ou4opte ncsasf 2rmumont0tleo o3iatlm el(mp t)arerxo iodoaD ai o;s) 2trir ou4am nlnvsl()srtr(rpoo0aleoiieiad a2uln ont0 exrxrcty1laD  uvilt0 2uoxr3ou1amtelnvslsfs2ua( poo0opeomoetyd m rlumpnu0aeenif iatopte nvi;s0 rtoiopiy4llte nctat arumxr ;t1tptniictldlmDrlnvsn(4 rermrcoa1fp rlnvi ( trxrxmpno1al  mies sfs2rru pnt1tpeoifctysla rluvpnu) rtnifctotomt  neilt0 etmio3oudlmeelictat)s2rr(rp;u4apt mieils m ran onu)aetnxfciatfm  ai sls  exrio ou4oltemneia(  Duau p;o0apt mfeiydfmDuauvp;(4 lenmr3oytomD aneo;(0seuo(o iydopeelnvia(fsDrm( ont0tle ifctatfa2emnvo;t0altomr3tatfmD  nes;s0 etmim3iu1lltnmfvsatf rtr( oou0tlenioetaslm2emums t)aeenxf3oatfmDrauvo;(0seuoxrpnodolt mfcs s)aDuaum nu0tptomo3iytls um(vpnt)arenmo oydlpDeanvs t)tetoxr iodllen ivil( a2rmu  nu1tleomf3ildfm ul( sn(4alxnifcoatlaD livolt0trtmio oo4ol n fctasfaDrmu pot1tptoio3iltla2rl(mpnu4teeoxf to1lm ran i s)trtm(o3oudap elnciat  Drrxrono0tleo ictatfm2elnmont4 exnxf ia1la r ies;s  2trim3iodapt  ictasf Dtrx  nu4opxomieiltla el( s;t4 ltnxfcoodfp   n il( sexo(m nudam nmiei t  Dumumoot0ape mi3tyt mDelnmp;t0aexomfciotoaD aivsl()trur(r nudoptn iviltfsrumxm no1tet ioetls a2ulump u0artnio3tydlpt lnes s0 2xmio3iy1ame lnesasf Dur(m ;u4tle mo3iysfaDumumpn(4altrmrcta1op rli o t seur(m3iudlpen fcsl(fs2rrxrono4oex iiciysfs2umuvsn() eeoiocoatfm r i s;(0tetmiopoy4ol  lneiatfsrtr(m ;u1olxo ieiydla emnvp (0altnmf tydomD  nvo () exm(o oydal nlivsls) rrrurono4oex moctldfmDrmnms u4treoifcoadoat auvol(  2xmxrpou1ome  iesl( aDtm(mono4tee ii3tytfaDelumo t4 etoxo ootom eauvo;( srurir no1lltelncsasf Drrx  ;o4alx mfciltls rl( p;()artoircoytlaD  uvols0srxoxrpnodapenlies ()srrr(m nt4tpx  ictld mDum(mo u4 etomf3io1oateanvols0 2umxrpno4llte icsa(farum(mpot0apxomocildla2em(mp;(4trtnir iydfa  lnes;s)s2urim3iy4alt mnciltf rtaumono4alxn ietyd s2eluvs ()arenxfctydfat  u il( trxoim oy4alte fvt sfarta(root1tpenmf3iytlm2umu o t4 rxnio3iatlm   n sl(0s2uo(r nu1ape lfeiatfaDtm(  ot0oet  iciatlaDuln pnu)trxnir oydop elieil(0 exoxrpnudape  ivi t)srrr(m ;u1tetoiictaslaDeanmpn(4 leomr tatfpD anvi;s0teuoio nu1om  lieilsfsDur(m nt4tpx  ieildfaDuau o;(0 ltomf iatfa rauvo s) rxm(mpnu4lmenmictlt  2ra(rpou1tlx if3iydfs2rl(ms u)tlxnxf iodfm  an s t0t2xoxopno4omt licsl(farrax  no4oex iiciytfmDemu ont4tetoxocoy1omte ies;s)s2toxo iy1lp e ivsa() rrmumpou0oeeoif3iad aDea(mpn(0 etnircio1faDe n slt0srxo(r nodolenlfcsat) Draumpno0ale ioctasla2ulumo u0aetoircty1lmtrliesls seurxmpiy4om  lncs (fa2rrxr no0oetoif3iyt m eauvpnt)aexnmo oy1optr nvolt t2xmir oo1ap e ivtatfs2tau pnu0ape  fciytls el(msnt4arerxr io1opDr neslt texr(rpnydalee fvslt  Drm(mpnu0alx ioctydfm2ua(vo u0alxomfctytoaDrauvs t0setmxrpiu1lp   iviat aDur(r ou0tlenioetasfm rm(ms;t0trxnmf3iotopDr i ol()setoxo oy1ope  nvil( arrmu onu0oexniieilslmDem(mpnt4 leoxf ia1la r ueo (0setrxrpoudamt  feiat aDtmxrpoo1aexoiociatfaDuluvs;(4trtoiociy1lmt  uvilt)s2xr(opoudomt  ici ()s2rr( p;t1aeenmicildlaDul( o;(0 etoir3iytopt aies t)t2um(r nydopen nvtltfsrrrxm nt0tlx ifetlt a em(vs ()tlxomr ta1lptrln s;s0trxo(r3nu4llenlnetltfsDtmu o;u4alxoiicilt a ua( snu)aetnmf oatlp eli ils0teur(o3iudoleemivi s)aDtruronu4ale io3tadfs eanvp;u4aetrmo3iydfat auvi;s0 etoir3oo1olenlneilt)arrrx ont0aee mociyslsDumumo;t)tlxnmf iydom  aues s)teumxopny1ll n nct s)aDumur ;u4oex  ieiltlsDuan pnt4texrmo ty1fm r i o t) eur(o oodlp n fcils)sDtrurp;u0tet iiciadlmDranvo t0alenxfcty1lmtelivs;s) 2xoxrpoo4am  mfeia()aDtrurpot0texn iciys a2ranmsn(0trxrxo3tadlaDrlieol(0 2tmim iudope  iet ()sruaumpot1olx ii3iat s um(vs ()arenio oadfm raneslt) rxoiopno1ll  micsat  rrmx pot1tex mieiysfm2rm(vs;u)aleoxr3ta1lm eauvslt)seum(o ny1lptn fvsl()s2uaurp;t4tpt ifeildls ulumo;(4alenmr3totlm   neo (  eurxo3iy4lmt lfcsl(fs2rm(ronu0tee  oeils sDem(vs u)tetnxr io1oa eauvilt trto(m ny1alt  fei s) rrmum ou1ope moeiltla ulumo t4aeenifcoadop eai o t  rumimpio4ale mieia(fa2ra(mpno4tex moeiyt a raump;() rxrir tadfmtr nei s)truo(mpnydolenmnct sf 2uax  no1apx mfeiadls2em( s t0tetnxr3iodomD  uvi;t)t2uoxo3nu1lltnlnetlt) rta(m no4apeomfcild a ulnvp;(0teeomf to1lpD  uvs;s0srumxopoy1ame lnciatf 2ra( p;t4aptnmo3tatfmDra(msnu)arxnif3tadfptelnei (0setrim3oy1openlieia(f Dtmurp;o1tpeniiciaslm2uan s;(4areoxo todlaDrai ol( texr(o3oo1amtnlncsat)sDtmurpnt1apt if3ilt a2uanvp t0 eenmr3oy1fmDelieo;t trumiopoy1am n nesatfa2taxr ot4olxomfcild s2um(vp;t0aeeomo3totfmD  ieols) 2umim oydap nlicil()arra( pnu0alt mfciys a emnmp;()tleoir3oatop  aivs t0s2trir3iodom nlfes () ruru onu0altnif3iyslaDul( s;()aetnxocoa1fmt lneslt  etrxopnudllte icsa( aDrmxmo;t4aet  ieiaslmDelnvp u)tetrxo3totop   u o;()seum(mpiudam   fctas) rtmx o;o1opt iociltfa ua(vo;t) leomf oa1la  luvolt)texr(m oo1lm   fci ()aDrruroot1aex mf3iydfa rau s;(4 lerxr3tydfpte nvo ( sexrirpno4lp nmfcilt arurx ont4aetnif3iat sDel(ms u0tltrxo3oodom  lueo t) rtoxmpiodope lici sfsruaur oo0aexo octysfa2rmuvsnt0 lxrmoctatom elies t0trumim ou4ole lietat aDtrx  oo1alt mfeiytls2um(mpnu)aeermr3iatfmt  neo t) 2uoir iy4omt lncsl(f 2ra( pno0tetnio3iaslaDemump u0arxoxo ootfpteaiei;t  eum(opiy1am  lict sfaruax  nu0aexniietytlm2rm(ms;t0 rxnxo oatlpDraivo ( texoir3iy4al e nvi (  2rru pnu4tpxo iciasfmDulu p;(4trerifciy1fmt aueo;s t2umir3oy4ameemivil(f rra(mpot1aeeniociyd sDrlnvp ()altrmf3ty1optrluvils0 rur(rpiydape lfcia(f rtmxr ;t1altniieiatfsDeln s u)aeenmfcoadfmt  i o t srxo(mpno1ll elfcs s)srta(r oo1oet ifctyt aDrlump (0tlerxo3ootlmt anvs;t t2uo(r ny1ap elneilt)a2raxr ou4apt mocilsls2eau o;u)texrmfcootlaD lueo;s0seuoxo nudomt mici s srur( p;t0olt  iciatfa el(mpnu)trxnmrcoa1fp  livilt s2umiopoo4omeelici ()arta( ooo0tltoiiciysfs2eanmp t4 rxnmfcootomtr nvolt s2trio3nodol nlneil( sDtrumpot4ope mfetysfm emnms ()altnxfciadfp rlnes;t sruriopno1ome mfeta()srrmurpoo0oexnmieilsfs ul(vo (0tltnif3ootomt  nvo;()sexmim3io1ol nmfvt ( a2uax poo4texo icild mDrl( o;(4tleniociotfm elu il(0trurxr iudlme licsl( srtmx pno0tlx  iciyt m em(vo;t) ltomocootlpDeli ilt)srxmxopou4alenmiesa() rua(rp;u0tetoioeilsfs uluvo;u) lerxr3iatoat  ieo;s0teuoxr3oodlmtnlfei () 2urur ;u0optoifciadfmDea(vp (0arxoxf tatlm eanvs;t)t2uoxrpno4lmt lici sf rrau oot0texn f3tlslmDea( p;u)texrirctotfm r ivi;(  rxrxmpou4olen fcilsfaruaur no0oetn fctyt sDemnmo u0alxnxocoatfa  luvil(0texmxm oy4ap nlnvtatfa2rrurpnt0tleoio3tyslsDraump (4trtnir ta1oaDrli i (0srxoim3no4ap emicsl(fs2trurp;u4alt mocils s rm(vs (0aleoifciytfm  lnvs;s s2tm(m3oy1ol nmieil()srtaumo;o1aeeo f3tad a eln on()alenirctydlaD an ol(  ruoxrpoo4ale mfcil()s2tau pnt4alenmoeiltlmDrmnvo u0 ltomr oytlaDeanvo;(  etoir no1amtemnctl( s2um(mono1opeoii3iadla2rln p u0 lxrxf ootopDean i (0 rxrxmpiy4opee nvilt)s2rru  ;t1aex  ieils s2rl(vsnu4teenmoctytlptrlueolt)trxm(m3oodale  ivilt aDrm(  ou0tle  oeild aDeluvsnt)aetnmf3oatfm r ieo (  rtoio3no1ame  fctl()s2tm(r ou4tet ioeilsla emuvp u) rtniocia1opD  ivs;s s2xrimpnydlpteliei () Drr( pno1teto ieilsla el(mp;(4trxnmfctydfp  ln i;(0t2xrimpnodlptn ietlt)sDuru p;t1tptnif3ias mDrmuvs t)teermr oa1laDr i i (0s2xmim iy4lmeemfvtl()sDurxr nu1olxn f3ilslsDuan on(0 exnif oadlmD lu ol( trur(rpny1lme mieias)arua(ro;t4oexn ieilslaDrmumsnu) etoio3totopte u s;t)truoxo3nu1lmee icilt sDumx pot1tlt mf3iadlaDeluvs;u)tetomo3oatlatr neo t0 exo(m3ny4omt mfcsat)aDra(mo;t1apenmoctysfa el( pnu) rxoxrcootla eauei;s trtmxopnydlmen nct (f 2uaurpno1alt  ieiltfsDrlums t) etrioctatlm rln ilt0t2ur(mpoo1oltemivslt)aDtaxm ;o0altnioetls a2rm(mp ()tlenmocoadlateau o;(  2tmxrpnu1olen neia(f rtr(  ;o1oex ifctatfaDem(von(4tltnmocoatoaDelnesls sexm(r iodolee nvils  Dtr(  oo0tet  feilsfa2em( onu4trxnir tadoateaiei;(  rur(r3no1am nlnesatf rtax poo4aptn ictlslmDrlumpn(0 eenif ta1lp  ln il(0setoxr3iu1aptnmieslsfsrurxr ;o0tltnmfeiytfmDelu o;u4alxrxf tydfat  ues t0trxrxopoy1llenmfcs t) Dtr( ono1oltoiieiatlsDem( o;(4 exnif iotla  au s s0srur(m ny4ol   nvi tfsrurx pou1aeenifcilsfsDelnvsnu0arenxf iatlat  u ils)teuoim nydlpe  ncias  2urx onu1apxoif3ilsfmDrlu s u)trenmo ty1op eanvi t) ruoimpnodlleemietls sDrrxrpoo1alx  i3tadfs2elu on(0 etrmr3oodfm   i o;s s2umir3iu1lm   fctas) Drr(mo;t4oet mi3iysfmDrlnms;u4aexrio3ty1la  anvo;(0 2trxmpoydll nlfvt (fsDua(mont4olto ieiltls uan pn(4alxnxfciodomDrluei;s teum(m3no1am nmnetatfarurx p;t1apxoiocilslm rmn s;()tlxnirctodomt  i ils)s2um(rpoydom  lfcs t srrm(m nu1texo ieiltls rm( ont)altnxr3iotlmt au o;s trtm(r3ou4lm   icsat)a2tm( ono1tpen i3ilt mDrln o (0 rtnxrcta1optelneol( t2trimpny4altemnet t aDra(mo;o0aeenmo3ilsfsDua(mp u)teeoifcio1oatelu o t t2tmxr oo4lp   netlt)srrmxrpnu0aex iicilt s2em(vp ()altnmr ta1fpteai ol(0t2toxm3iu4am  livi ()srua( pno1olxnmo3ias aDemump (4aeerifcoadlp r ueilt s2xm(m3iy4ole  fvt sf Drrxrpnu4teeomfctyd aDeauvp;() lxnxo3oo1omteluei;s0trxmxmpiodlpeemiesat)aDum(rpnu4oexomieilt s um( s (4aeenmo3oo1lm  aneo;t s2xrio ny1ll nmiet ( a2taumpou4opt  fciad mDem(mp;u0arxrifctytom e iei;t0trtrim3ny1lmeelnvtas)s2tax pno4apx iiciadls2elnvpn(0aexomr3tytlaDe neo s)sexr(r iydll e nvs t aDrr( pot0opx mociydlsDua(vs;u0 lxoircta1oa   nvs (  ruoxo3nudamenlivias) 2rmu  ;o1tpe if3tltlsDul(vs;u0tlxrmfcoytlmtranei s0s2xmio oo1altemictas s2tr(m ;o1oex iociadfa2rl(vs u) exrif oatla ranvi;t0t2toxr ny1lpt mfcsls)a2uaumo;u1opxoifctatfs uluvpnu4tlxnmrctydopt luvs (0 rtr(mpoy1ol  licsas arur(r ot1aexo i3iyd m ea( o;u4texoio3iotfa r uvs s)srumim iudlpeelieias)aDtax pot4aetoif3iatlm2umnmo;(4tetnifctodlat lu s s) 2trir3nodaltnlfvsl()srrm(ronu0alxomi3iyd s2eluvp u4arxniociodfpDr nvo;s seumxm io1ol nmfctas)sDrrum ;o1aee  iciadfa ulnvo t)texnir3iatomDe u o t0teur(mpiodlp nlivi ()srtaxmp;o1olxnmfcild s uanmon(4arerifcoa1omD anvi;s0t2toir3oo4lle  fvias)srum(  nu1apeomi3ilsfm rluvs t)alerir3todfpD aies;(0 2tm(o3iu4al nmiviltf Drr( o;u1tlxo iciadlm rlu pnt0aetrircty1fmD  i o ()texrir3nu4am nlicsa(  Duaumonu4tpxoifeilslsDrlump t0 lenmo3oy1fm r i s s)trtrimpiy1lleelnet ()srtm(rono4tetnifctld m2rmums;u0 rxoir3totlaD anvs s sexoiopnodaleemfct s a2um( ont0aee  f3tasls ea(vont)teeomo3todlpDe ivo;s0 euo(o3no1lpte nei s)a2um(  nt1ape mieiyt mDeluvo u0alxrxf iydomDelnvo s0trtm(r ny1lm nmnetls) rra(r ;u4opt moetys m2ranmp;(4areoir iatoat  uvi;t tetm(o3ny4llt  ivs sf 2uax p;t4aexoiiciydfm rmu o;t4aleoif3to1fmtr iei;s t2xrir3iydlm  mfcilsfaDta(mpou1apxn i3tat s umuvo u0teermrcoydfptran sl() 2uoiopnodap elnvs t arta(  ot4alxniiciyd a2eauvo;u)tltnxo3iydfmt livols0 2toxr3no4optelfcilt s2ta(ro;u0tptnmietls a2emuvo;t)areoxr iy1fmt  u ols)s2umxm oy4lpeemnvt (  Drmx  nt4open ictad m2eau sn(4trenmo3oytfatelivs () euoimpoo4ol  mfct t  2ua(mp;u4aexnmfctldlm2ulu onu0artnmfctatfp e uvi ( truoxo no1olt  fvils  rra(mp;t0oet if3iltfaDrm(mon(4 rxoxrciytla   n o;t  2xmir3oo4opeemieil(f 2urxrooo4altomociadfs2ean s u) ltrmr3oa1lm  lnvo s0 2xrir3iodaltemfesa(f Drru  ou1alenmfeiatlm ua(vp;(0aeenmo3ia1lm e uvi s0 etoxo3oodlptnmfctasfsrrrxrp;o4tlx mfeias a2ra(mo u4 lxnmr iydomtrai ols setmimpnydll e ivia() Durxmpou4oeenmieildfmDea(vp;(4teerxf iydlaD ln o;t0s2uo(mpiy4amenmfeias)s2uau poo1oeto ictldla ra( on(0 renxf oa1lpD auvslt  2xr(m ou4opt  nesls srtaurpou1tpx io3iys m ea(mon() exrxo ta1lateai ol(0seumio ny4lpee fvils  ruru  ;o0tltnmicilt s elu p;(4tlxrmr3ootopD  i s;t0trtrxm oudol  livt s)s2urumoou4optn ietadfs uaumsnt0 rtoxrcootlat  n i;s seurim oo1lltn ivsat  2rrurp;o4opx mi3tas m2um(vp (4tleoxo iytlaDelu ol(0srxrim3no4apee nesl(f ruauront0oetn f3tlt aDuaumo;(4aleoio3oo1fptraivslt)s2uo(r3ou4omee ietlt) ruaxroou4alxniietydfmDea( p;t0aleoxocootoaD  iei ()seumim3iu4ap emnet t)sDta(m ot4aee iiciaslsDranmsnt) lxnif3iydom  lieil() rxm(mpno4lptelnvsat)srrr(m nt4tleo icilsfmDeln ont4alxrxo oa1lp  lieo t  rurxr3oy4omt mfctlt) 2um(mooo4aptomfetld s emuvo u4tlxoirciatfaDeaiei;( t2uoiopnu1alt  fcil()artau p;t4altoiicilsfa2rmuvo (0 ltrmo iadfm ran olt0t2xriopio4lleemnvta()srur(mp;u1teenii3tls m um(mpnt) etnxo to1lpt aneo () etmir3nudol emicia()s2ra(rp;o0oleo feiasfs emn pnu0alxoir3oatfm rluvs;(0 2urirpiu1aptemiesls  rurxrpnt0aeen feildlaDel( snt4artnmrcoa1om rlu o;s)tetrxrpoodome  fcsas)a2urxm ot0tlt ifeildfm rmumo;u) ltnmfctytlpDranei;s  exm(o nodlpenmfct () Drmu  no0aexn oetldlm umu snu4 rerxfciytfatr nvi s s2xoio3oodlpen ieilsfa2tmuroot0alxniiciytfaDuluvp;()trenmf3iytom eau s;s) exo(rpiydlmenlnesls) rur( pno1tpe  i3iaslm um(vpn(0 etnxf3ta1omD  nvs t) ruoim oydopeemnciltfsDtmx p;o0olen ociydfs2eaumo u4 eenif3oadomD  nvi (0 2umim nu4ll   ncilsfaDtru pou0tleomictyslm rmnmp;()artrmf totfpDe u s (0 rxrim iudal   ivi s)srrm(mpoo1tlxnmicild a rau o;t0teeomr totlpD li s ( truoio3oudapeemivs tf Drrur no0aeen ocilsfs rlnmpnu0trtnxr3oytfaD  neo;t  2xr(o3oo1ape  neta()aDuru  oo4optoifciatlm2el(vs;(4 etrifciadopD  ivils s2umxrpoo1am elnvtatfsDraxmp;u4oeeo ieiydlsDel(vo;(4altoxo3tydopt ln sl( t2xrxm nu1lp n ict t) 2tm(r oo4oleo i3ilslsDrau o;t0alxriocootlp raieol(  2trim no1lpenlfctlt)aDrrurpou1tpeo oeils sDulnmpnt) lxnif oa1lp e n o;t) euoxrpoydopee ncta( a2trumpoo1tpe  o3tydfaDuln pn(4tltrmf3oatfaD anvo ()t2tmio nu4lpt mnvsl()aDur( oou0tlt if3iatls2eln s u0aleoxociytfatr neo t0trumir oo1lpen feils)s2trxm nt1apenioctyt m2rluvs;t4trxrmr3oatfaD lu o;t0 euriopiodlp n nvils a2ta(mo;u4olt  fcias sDelu o;(4 etnmrcty1fat lnvols0srxrim ny4am e ivils  rrau oou1tltomoetldfa2ul(mpnt4tlxnmfcia1fmDrli i s) etoio ny1lptemnctlt)aDtmx ono1optomiciysls rl(vpnu0areoiocoytfa e n o () 2xm(rpnodlme mictlt) 2ur(r no1aleomietltla elu o u4 lermrcto1faDeau o;t0 rxoxr3iy4alee fvsas)s2rmxmpnu1texoifcias m umnms;t) exoxfcoytfp  aueo;s0trumirpnu4omt lneta( a2tr( oou4olt  octaslmDeanvon(0trtrmr3io1fpDrln il( sexoxopnydlmenmietasfs2tmu  ot4tptnifcias m2umn sn(0artrmf iotlp  aivi;t0 2tmxm3ou4amenmnvtls  Duaumoou0texnmi3iadfa2eluvs;() ltnmo iy1lptrlu s s  etmirpou1aptnmnvi tfsDrm(m ot0apen f3iltlaDeln o;u4 renmf iatomDeauvi;s)texoxo no1om  mfei t aDtrxmpot4aeto o3tls aDemu s u4trxnxf3oa1lptelnvo t  rxr(m3nodlmtemfetltfartru oot0altnmfctlsls eln p;t4alermr ia1fm elnvo;t)teuoxm oy1omee fvsa() rrm(mooo1olenifciasfm2ulumpn()arxrmfcoy1oa   uvs s seurir3iudapt mnvi sfa2ta(m oo0tlxo f3ias s eauvpnt0altomfcia1lmDe n o;s) rto(rpoo4llte fvia( aDrm(m nu4tptnifctyd s ran ont4 exomr ia1fatrli olt)teto(rpiydaptnmfvi t arurx oot4oee mieilt mDua(vs u)tlenmo oatomt luvi s)t2uo(o io4lleelnet ( sDra(m ;t1oeeo iciat aDrmnvonu4alermfcto1op rluvs t t2to(opnu1apenlnei s)s2tru pnu1oexniociatlm2el(vs u4tetrir tytfpDeliei;t)sexm(m ou1aptelnesa() rtaxrono0apeniocilsfa rmnvs t)arxrmociytlpt  uei;s0srumxm no1apeemncsl(faDumx pnt4tpxo i3iat a2eaumo t4 lxnmfciydlmDr uvils0 2xr(o3iudome mncslt  Dua( ooo4aleoiietas s emnvp t4tlerioctadfpDrli slt)srumxm3nydal nmfei s aDua( p;u1olto ieiyt s2um( p ()aexnxrciotop rlnes;t srtoxr ny4al nmneslsfarrr(m nu4tlxn feiyd s rl( s;(0alxnmo3oytfmD anei ()texrim no4ame lieta( artmu ono1aeeo oetldls emuvpnt4aetrifciatlpD  uvsls)teur(m3ou1oleelfvt s s2taurpou0tle ioetatla ulu onu)texomf3tadfpte ueo t0srum(r3iy1ol n ieia( s2ta(mp;t4alxomfciytlsDuauvs ()artnmrciotlaDelneo ( s2umim3oo4lle lnes tfa2tmxm no4oexnmo3ilsfm rlump t0 etomoctatoa  ai sl(0t2toir3oy1lme lncs (  2ua(mo;t4apx ioctys s eau p u4tlenmfciatla  luvs s0 rtoirpoodlltelncs ( aDrmuronu4opx  feilsfsDeanms () rxomf oydfmD lneils0sruriopiy4oltelfes sfa2uaum nu0oeeo fetadfs em(mpn(4 etnmocoydfmDeaivs;t)t2uo(r3ou1alt mivtls a2urxmpnu0optnio3iydfmDemnmpn(0artoxf3oydlm r uvolt trum(rpiu1op  mivi s)aruau  ;o0aptnmoctadlm2um(vp;u) lenir3to1fa  lneo;t0setmirpiydlmtemnetas artru pou0alt mi3iadla2uln p u0arxoxo3totomteluvo;t  rtmio iy4op  mnet sf 2uaum oo0aeeoio3iysfa2uanmpnu)tleomr3tadfp   u olt0 rumiopoodaltelneilt)arurx  ot0opxnmf3ias s uluvo t)artrxo iotfp eauvo;()seuo(m ou1lptnmivtat a2uax p;o0tpx mf3iydfaDumnmo u) etnio3totfmt  u sls) rto(rpio1omenmfesat s2tr(  ;o4tleo fetlsla2um(monu)trxrif tydlp elneils)t2toimpio4lp n nctl(faruaxroou4olxn octadla2rau o;(4 rxnxfctodoa  anvs s t2uoxmpnydopt lnvsat sDrr(ro;u4oee ii3iyt sDrmnvs (0 leoxo3tatfa e nvils trxr(m3oo4ape lnes (f rur(rp;t0texoifeildfm2rmuvo u4artnxfciodfmDrauvs;s0 exoio iydlpen fctls a2rm(  nt4aetnmieiyt mDul( s;u) rtoif tadfat lnvi;(0teur(m3oy4ap e ies tfaDumurpnt1aetniocilsfm2emnmp t0altoio3ootfateluvs t s2xoim iodll   ncsasfaDtmumonu4aetomfcild sDeau s u4 exrif3todlmD lnvs s srto(rpno4omeemfviat)arurxmpoo1apxo ietysla2umumo;t4artnxocoo1lp rliei;t0trxm(rpoo4ome  fciltfs2um( onu0opx  oetls s2ea(vp (4 eeoir3oatfpD lnvs;t0 rum(r3iu1ll e fet t)a2ra(  ot4tleo iciad s2rlu p ()teenio tadoptr u i;()setoiopou4llenlfvi (  Dra(ro;u4tpeniocild aDea( pn(4trxnioctydomDraivi (0 rumxopny4lm nlnes sfaDta(ro;t0teeomfciydfsDelu pn(0aeerxo oadoateai s;s0teto(mpoudame livtlt sDtrx p;u0aee ioeiat sDeanvo;() exnmo3iydomDrau sl() rxoim3io4ll nmivt s)aDtmxmpnu0aptomo3tys s2uauvsnu)teeoircoytfp  auvo t0trxmim ou1ap emiesl( sDur(mooo0apxn oeias sDelumon(4tltnmf3tytomtrlivo t)teuo(r3ny1lpenlicil( s2ra( oou4oex mf3ilslm2umnvp;t0 etrirciodfpD  uvsls)s2urxm nu1ame mivtat  rumumont0tpx ifetyt a ua( on(4 ltrxocoatlm  lu ols  2xoirpny1lpte ics tfaDumxm oo4apxn octyd s2rlnmsnt4alerio3tydop eau ilt)t2xm(o3nodom emnesasfaruau o;o1apto f3iatlsDuanms t0 exrio3tatop eln i s0 etrim nu4lleemfvsls) 2rmum nt1optomi3ildfmDeau p t0 renioctatfa  anvolt0srtoxmpio4altnlfvsat)sDtrx o;t0tee miciatlm rmu on(0tetrxfcoatlp eanvsl(0s2tm(r3iy4ol e fet t) rrm(monu1openmo3tyt mDemnvo () rxnmrctytopDraneo;(0t2xoxo3oo1ap   neta(  rrm(root0alx if3ildla ulnmont0 eeoircio1fptranes;t0trxrxo ou4al n fvslsfsrraum ou1tpeniociasls2rmuvs t4 reoxo3oa1oaDrlnes t)trtm(opnu4am nlfctasfartm( pot4texo fciysls rauvsnt4 lxrmrcio1op  lneo;()trur(r3oy4lpen nvsltfsrra(rpot1oex  oeiadla emums;t0tlermr3oy1lpteanvilt)t2toir ou1lptnmnesls) Dur(rp;t4oeeo feiadfs um(mo;t4tlxrirciy1laDe n o t0teur(opnudalte neias arum(moou1oex iieiatfm2ra(vsnt0arxrir3oa1la   nei t  eum(m3no4alenmfvias)artaxrpoo0tle  ocilsfmDraumo u0arxomr3iodoaDe neo t  rtmirpoo1op n ietat)s2um(  nu4tpxo o3iat a2ua( o;(0tltrmr3iatfaDr neo s0 rtr(opio4optnmfci t  Dtmumo;t1oetoiieiysfa2rmu o t4 lxrmf oytopte i o;( trurir3oydlp  micsa() rrm(r ot1tptn o3tatfa rl( o u0tltnmfctatlmt anvi t  rxmxmpny4olt lncta() Drau  no1alt  fciltls emuvsn(4aexrmrcoadlaDe i i s seto(m3nodam e iet sfs2rrx  ;o4optomoeils mDem(mp;(0 eenxf3iatlptr ues;t s2uoir3iodameemnesa(fs2ur(mp;u0aptomf3iysfmDrau p u0aeermociatoaD li o t)trtoio3iu4omt  icil(fa2trumpnt4aeeo oeilt sDuaump t)tetrifciodlaDe i i;s0sexoir ny4apen ivtas) Dta(rp;t4texo i3tatfa2umn p u4arxoxr3tydfatr u o;(0 rumxr3iu1altnlnvta(  2ta(r no1aetnifetld sDumn o t4teenmo oatlmt luei;s) rtrxm3ou4lmen fes (f rrrxrono4opxnmiciasfa ea(mp;t)tlxnxrcoatfp e u s;s0 rtrio io1altnlfesl()s2rm(root4aet mociysfs2el(mpn(4alxrif3ty1oateaueol()tetm(r oy4opt  nctlsfsrtrurpou1olxn oeiysfm2rmu snt4aleoio oa1lmteanes;s)sexm(o3iy4al elivsa(fs2rm( pot1oeenmoeiadfm2uanmo;t4tlerirctytomDr uei;t)seuo(o ny4amte fvsasf 2trxmooo1apt mf3tas a rlu s;(0 rtoifcta1fpD anvo;s0texo(m3oy1ol e fct s arurxr oo4tltnio3tlt m2ua(vs;(4trtoxf3tydfpt aivi s  euoxo3io4al  mieiat)aDrrxrono1aeeniociatfs rm(vs;t0aetomrciatlp rauvo (0 rum(o3oydap nmnetlt)s2umx pnu1aet io3iyt aDra(vp (4 etnxr3iotomDe uei () 2toxm3iydap nlicsas s2tr(  nt4aexo iciadlm ra( s;u4treoircta1la ran o;t) 2toxrpoy1lpt mieias a2rmumonu0oee  oeiadfm ulumo t0alxrmo3tadomtrluei ( srtoxr iy1ol   icta( artau onu4tpxoioeilt m2uanvs u4tltnmociy1laDr ieo;(  rxm(o no4olee net ()artaxrp;u1apeo ociasfaDrmn snu)alxoxf3oy1opDe ueo;t0tetr(opiydope lfvilt) 2ua(rp;u1teeo ocias s uaumo;() ltrxr tytoate ivi;s srxoxmpoudol   icta(farraxm ;t4opx  ietysfm2rlnvp;t)alxrmf3iodoaD  iesls s2xo(rpiydlmtemivtas)sDtru  no4aleniicild m eln s (4aeenif totopDrlu i t)t2uriopiodale mfct sf 2um(mp;t4texnifcildfmDeanvo u0 eerio3oa1fm rai sls  2urxr no4ap   fcsatfa2rrurpnu4teen o3ias a eaumpn(0alxnxr3oadlaD lnei t)s2toxo3ny4olenmicia(f 2ua(m ou4apt io3tlslsDumuvpnu)artnirctotoatraueilt seuo(m3oydlpeemneta(fsrtrx pnt1optoii3tadfsDem(vp;u0trtoxf tytopDr ieo s0trtmir3ou1apeelics ( aDrru  nu0aptnmieiatls2ea( s (4 eeomr3oadfpD  neil(0teuoxopoydap e ivsas)a2um(r no0tpx mictltfs2ran pnu0 lxnmfciotoaD liesl( tetm(m iu4alte ivs (farur(r ot0apxnioetadls2ea( sn(0tltrxo iodom ran s t0trxmimpno4ameelivil(  2ta(rp;u4opxo oetld m ra(mp u4aeenio3totom eai ilt0 2tmxr iu4ol n fvsas  2tau  no0opxoioetlsfmDumnmonu4arenmrciodlp raies;( trurxrpnu1ll emicias)artrur nt0tltoio3iltfs2rmnvpnu)alxomo oa1omDeaueil( setrxopnudop elfct tfsDtaurp;o1tltoiieiyd m2eluvsn() rtrmrctotla r i o;s) rxo(mpoo4aleelivi t)a2tax p;u0aee  fcias s2rm(mpnu0aexnxocia1laDeaieilt0t2urio nu1optnlnvt tfs2ur(rpot0tlx  f3iadfmDem( s;(0alxnxf ta1omt lu il(0trtoir iu4oleemicslsfa2tru pou4tle mi3iat aDrm( p t4tetniocoo1lpte nvi;(0s2tmxo3nodoltnmneiatf Dumu oot1olx iociasfs ra(mpnu)altrir3tatop   i o (  eumir oy4lle mnvtl()a2rmxm nt1oetomfeiydfa2rmn s () exnmr3ia1fptran olt) euo(r3ny4ame lfeil( a2tm(m ;u1tptoiicias sDranmp;(0tlxoif io1lmtr ues s0 rtmxrpoudomtelfeilt s2ur(r ;o0apxomfetydfaDuan s u0 eerxr iydfa  lues;t  2xmio oodome miet s srrrxrooo1aeenifcias sDea( o;t4 eenif iytlpDr nes (  2uoirpio4ol n nvsatfsDrrxm oo0aexnifctadfa2ra( onu)tlxrioctytla   u i t s2xrir3nydopt mfvt (fsrrrxr ;t4oee moeias sDranvo (4 ltrmocoodlp eaivs s truoio3oy4apen icia() 2umx oot0tleomociad aDranvo ()aexnxrctotlaDr nvs;t)trum(o ny4ll nmnvslt s2rmu  oo4teenioeias aDuan o;(4tlxnif iotfmtraivs;s)sexoxmpoodal  mfei ()s2umxmoou1ape  i3iydlm2umuvpn() lxrir3iy1lm r uei t0tetoio3oo4ll n nvi s arurxr ou4oet  ocilt m eau on(4 etoxr3tytla   nvils) rxo(mpiodol e icilt) 2rr(  nu4aeto f3iyt m2rluvp;(0aexnmocoadoptrlieol(0 eum(rpoodam emietltf Dtrurpnu4tlx iietltfm2rl( p t0tltnxo iytfp r i i t)tetr(o3nu1om  mnvi (  Dtau  no1tptnmoeild aDumnvsnt0texnio3iy1op elieo ()tetoirpno1ap  mictltfa2trxr oo0tet ifctaslsDranvp u0 ltoir3iydop  auvolt0setmxrpno1amenmfcilsfsDrru pot0apenii3tytlm2elu p;(0alxrmf iatfa  lueols0 euoio iu1aleemfctas sDrr( pnu4opxnmoeiasls elums u)aeeoxr ootla  lies s) exoiopoo4lmtemies ()sDraumont4tlxniictadfs em(mp t4 etrif3io1fmteaiei (0sexoxo3no4ol nliei (f 2trx ono4aet mo3iytlmDeanmo (0alxnir3ta1opDrluvs s0t2tmxm io1op elfvilt)arrmump;u0alx iieiad mDemnms u)areoio oatlmtrli ols)sexmxopnodalenmnvtas  Dtmu oot1tlto ietadls2emumo t4altoif3to1fp r ivo;s  rum(rpny4lltnlnvia(f Drr(rp;u0tlto o3iyd s2emn s;u)alenmf3tydfa  li ols t2xo(m3ny4om emfvia()s2uaumpou1oetoii3iysls2emump;t4 rerio3iadfpDraueo s0tetr(opnydopen ivta( srrru ono4alxo ieildlsDrmn sn() etomo oo1laDe u o t  2xmim3nodameelivsas)arrr( pnu0tlenmiciltfs2um(vo (4 lenirciy1la rlu o;t0s2xoxrpny4ome  nvsas  2ua(mpoo1teeo ictas a eln p;(0tleomr oatfpt livo;()trxo(opiu4omte ncslt)s2uru pou0tpeo fctld a rl( pn(0artoif oytfaDr nvs s) 2xo(r nodll  mfcils)arrmum ou1aet  o3ild sDum(mo ()altrmocoatop rlueo;s) rur(r oo1amenmiesat aDrrxmo;t0ole iiciaslm2ranvs;u) eeomrcootfm e i o;()s2ur(r3iu1om  mfci t)srtaur nt4olxn oetltfs um(mo t0tltrir3iadfa rai o;t t2urim3no4lp elfvs t) 2taumooo4oet  f3ilslsDeau s;(4 lxomr totlpt lieslt)sexmio3io1aptnmici s)sDumuro;o1aptoioeilsfm2eaumsnu4 etrifctytlpDelu olt srum(mpou4lpt  ivta()aDtm(rpnu1oet iieilsfaDrmuvs t) etoxr iotoa rlnvo;t t2trxo oy1amen ieia(fsDtr(mpno4alxomi3iyd s2uln s;()tltrio ty1fm   nvs 
\ No newline at end of file
@@ -0,0 +1 @@
+i sls)t2ur(o oydaltnlfeilsf 2rau poo4tpe  i3iltls rlnmonu0artrxr3oadla r uvs;t)teur(o3oo1amenlicta()s2urx  ;u1oeen fciytlm2emnmo;(0teenif iodfmD ai s s0setmim iodol nmfviasf 2urxroot0aexoio3ils mDeluvs u) lenmf oatomt aneo;(0s2xoxr3oo4lptn nct s) 2tmur ou0optnmfciydlsDemnmo;t4 exnxf3tydfp  au ils0trxmir3iy4lmtelfci s)sDra(  nu1tltoifetas s2emu p (4 exoif oy1oaDelu ils)srto(r3oudap nmivt t)artr(rp;o4altnmfeilt s ua( p () rxnmfcia1oa eluvs;(0 rxmxr iy4am emfvi sfsDtmx o;u1aeeomfciys sDelnvont)treomo3ty1fate u s;t texoxrpiu4aptelnetls)arum(rp;o4ale moetys s2rmn s u4tlxnioctotomt  ies s) rxmxmpny1ale mfvils)aDumx pnu0aexnmictlslm2rluvsn()altnmfcootopD ai s;t)trur(r oydapen fvt s)aDur(m ;o1aeeo iciat s ulnmp;(0trerxf iatop  lu o;t)s2um(o3no4ol e fet (  ruaxroot4alxomfctatlaDuau s;t4 rerxo io1oa r nes ()s2xr(opoydopt  nct (farurumpnt1tlen fetltla eauvs;t)aexomf3oodoateai o t)t2xmim3oy1optnliet tf rua(r no1tpt mf3iyt aDeln o;t4 lerxocoy1lmt  i s s)trumxmpou1olt mfvs () Draumoou0aexniicilt m2ua(mo t0 exrxf3io1lm  ln o;s  rto(rpnudlle mfcslsf rur(ro;u0altnifeiad s elu o u) rxrif oytfateliei;t)texrxopoudop  mnvs t  rtaurpou0tpeomfeiad m2rluvpnt4arxnir3ootlpt an i;( sexmirpio1olte ivsat)aDumu ont4aleomf3iltla rmu snu)alxnio iytlateli sl(0trumio nydop elivils) rtmx ono4oee iictls s2elnvs;u4 etnir oatlmDeau i t) euoimpiu1lme lfvtat)srurxrpot4olt mfetyt s2eluvsn(0 lenmr3oodfa rau i;t0truoir3oo1lmtelicsls srtax  nu1aee  ociatfa emn s (4 etnxf iytla elnvs s trxoxrpno4lmeelfei ( aDtaumpno1aleomi3ils a2umump;(0tlxnir3oydlp   i o;t)trxrxmpoo4alenmivsatfartaxm ;u0oex  f3tyslmDulu s;t)trtoxrctytopt lieils) rtr(o3iu1lpe lneiltf 2ur(mpnu0olt  i3ilsfm2umnvp;t4tlxrio tatomt aivs s0 rur(m oo4al e fvtasfsDrrumooo1tet ifctytlaDrm(vo;t4trtrmociytfpD  ueo;t0 etoxo no1lmenmivsa( arrmxrpnu4ale iiciltfm rauvpnt) etomr3ty1faDrauvols0 euoir oodolee icsas)a2umx  ;u1ale mfctysfmDrm( p;u4arermf3oa1fmD au o s trtmio no4ol   nvt ()artmu oot4ale ioctyslm2rmums;u0alxoxfcoytoa ean i;t)sexoxr nu4ll  mieias  2ur( poo1tetnmoeilsls2elnmp;(4alenio iytopDrli o;( seto(opiy1ol n net ()sDtmuro;u4texnmociadfs ra(vsnu)arenxf totlmt  uvolt  rtmio3ny1opte ncsl(fsrurx  ;o1olxn ieiys sDeln o;u)arxoxo ia1fpD au sl( trxmxr3nu4al n ietlsfs2rmuro;u4tetnifetasfmDemu onu4teeoifctadopt  u sl()t2xo(m3oy1olte netat a2rmu  oo4opxnmiciysfaDuan onu)alxrxrciytoa eli s;(0t2uoxo3ou1omtnlncta(  rrrurp;u4tex ifciadfaDranvon(0 eenmrcoodomDrluei ( trtrxr3oudaptnmiesat) Drrxrpnt1tlxnif3ias aDem( p u4 renio oatfpteanei (0t2umir3nodoltemfvi tf Drr( pnt1aeeomociysfaDrlumpnt4arxrxociatfptr u o;s) rumxr iy1om   nvilsfa2ua(m oo0altoiocilsla2ua( snt4 lxnif to1fmDrliei t) eumim no4om   feias  2ur(r ot1tee  feiatla2rlu s;u)aeenmr iytop r uvi;t0setm(m oo1op   fetat)aDta(rpoo4tlxo ieiaslm rmn s (4texoxf iy1la r ivi s)sruoxrpno1aptnmicils) 2ua( pnu1tleomieiydls umnmo t0aetnmocoy1lmDrlnvi t srur(mpno1ll  mieilt a2tm(m ou0tet  iciys a2emnmont4aleoifcoodopDeanei ()s2umxr nudopenliesl( a2rmu o;o1oltn feiytlsDrmuvsnu)trerxrcoatlmt an o;s sexrxrpnodll nmnctat)a2rr(mont0aee if3tyt mDelnvo ()arxoir oodfa  anes;(0srtrxr io1lmt liet s arum( ooo4tltnmfciytla eau p t0tltniocta1lpDrluvo;(0tetmxm nu1om nmfcia(fa2rmump;u1tlxo i3tyslsDranmon(0artrxo totlpDe n ols0s2um(opnudlltemfeiat  2rmxmo;t4tpe  fciysfa uaums;u) etoif3ta1lmt anei t  rur(o io1om elfvtl( sDra(rpnu1oeenii3ils m um( o;u0 lxoiociy1fpDrli i;t0 2umio iu4llte iet sf rtm(root4ale ifciys a2ranvo;t4areomf3oatop  li i (  exrimpio1oltelnes tfaDtr(mo;o1ale ifctydfm2eauvo (4altoiocoodla  lnvil() 2xr(o3iu1om  lfvtlt sDumxr ;o4alxnmf3iad a ua( onu0 exrmf oatopDelivi;s0 rxoirpiydomeemicil()s2umxmont1oltn i3iad aDrluvsnu0aexnircootlmDe uvi s)t2umxo io1omenmfcs s)srtrxrpoo0oleo fcias mDrln o;u4altnmo oy1faDelnvolt  etmimpnodlmeelfvtl(f 2rmurpnt1oleoioeiytfa2umuvo;t4alxrxf3iadfpD  iei s)t2xr(r iy1lle lnvtatfa2ra(rpou4tex mi3tlsla ulu p (0texoif ty1opt ai i (0 2toxr nydll nlieta() Durxmpnt1apxomoeild sDranvs;(0trermrciadoptr ueo;(0texmxopiudlpt mfcs sfartm( o;o1ope  i3ils mDemnvp t)trxnir3oodfaD  iesl( teum(r3iydaltn fcs t srtmu pou0teeo ictlt mDrl(ms (0altrmo3ty1oa rlnvi s)s2umxm3oudap emieslt sDrrump;o1oexnif3ildfsDelnms ()arenmrcio1fat lnvi () rtr(m io1alt  iet s  rtmu  ;u0tptnii3iydfaDua(vs;t4 rxrxf3tatlpDrai ils sruoio3iy1lp emivsatfa2ra(rpno0aeto octlsfs rl(vp;u4artrir iadfmt li o;(0t2toxo3io1amtn ict s)arumu  ;u4tptomo3iysfmDem(ms u0aexrxo3oydomDraneols0s2ur(r oodaleemnesasf 2tmu  ;t1tet  oeiltfsDeluvp;(0aexnmf3iy1omDrlu i s trtmxr nudalenlfvias)aDtru ooo0apeoif3iyd aDumn s;u4tltomfcoytfmteauvol()t2tmio3iy4ll elfcsl(f Dra(  nt4tee ifcild mDrmnms t0arxrmf3oo1lm eanei;(0 2xo(m3nu1optnmict t arua(r ;t0tpx iocildfaDelu p;u0teeoxr tytfaD luvo;s t2toxr3ou4lm nlici t)srurur ;o4opt  iciysfsDumnvo t4tetoifcia1fm eanvils)seurxo iudop n fctlt sDrmum ot4opt iieiyt a raums u) ltnirciodfpt au o;s)t2trxo3oodllenmnet s s2raxm nu4aee moeiatfsDumn s (4 lerio tadfatrau ilt  eto(r oo1lp n neta(  rra(m ;o0tltomoetls m2ul(vo;t0tlenmfctytop e nvo () etoim oo1altemfeslt s2rm( o;t1oetn fcilsla rmnms (0teenxo3oodfmD lnvs t0teumxrpiy4altelfvt t)aDum(r ;t4oex ioctas m ra( p;(0aeermf3iy1lmDeanei;s0trxm(o3iy1op nlicias)sDta(mpou0aeeomoeiatls rmumpn()tltnxr iydfpt  nvo;(0setm(rpoydamte neilt)aDtm(r ;t4tptomfeilt aDeaumpnt) rtrmo3iy1fmDean i;s) etoir iy4op  livsl(fs2tmxm ;t4teeoiiciasfa rmuvo;u)arerir to1omtr i i t  rur(mpoo1lp nlnvtatfs2ur(mpoo0optnifeiytla2um( sn(4trtoio iotla  anvo t0texrxo no4opt  ivilt s2rax oou4oex iieildfm ranmp;u0 exrir3ta1omD aneo;(0t2urim3iydllen fcslsf rrr(mont0tptoii3iadfm2elnvonu)arermo3totfaDr i s;()tetoimpiodop nmncsatf 2ururp;u0tptn fctldlaDraums u)tltnmr3iadlmDrauvo s) rtmim3nudaltnmictas) Dua(  nu0tleoif3tasfs rlu p t) leoio3oydfmDrli s;t s2uoio3nudlm  lncs t)a2rruronu1olx  fctld s uauvo;u)aleoxo tytla  livs s)texrir3nu1lmenlfci ()srtaxrpot0oex ioeias a rlu o u4 exnmo3oadlmte i o () etm(r3no4ol nmfvs t) rtau p;u0alxnmf3iat aDumn o u)aetrio iy1fmD anvs;t  rxrxo3no1lm emietl()sDtmxr ou4tpx ii3ilslsDul(vp;u)teeomf3ootfmtranvs (0t2xrxr3oodlle  iesat artmurpnt4tpen i3iltfs um(vsn(0 ltrmociodoateli il() exrir no1lmtemfesas aDtaxmpoo0oex ii3iysls uln p;u)teerxr iadfmDeli o s0srxo(r nu4op elnvta() rrm(  nu1optnifeiysla2rmu s t0alxnmo iodopDr nvs t0s2umiopno4lp elnvs ()arraurpno0apx  fctyd a ra( p u4texrxf ta1fmteln o t) rxriopiy4ome  nesat arra(mpou0oee  octltlm2uan on()aetnxo3iytoaDeanvo ( teurxm no4llenlieiat) rtrumpot0alen ociadfa rl( on()alxrxf tytfmDeanvi (  exm(rpou1aptemnvsasf 2ta( ooo4aetoifciatfs uaumo;u0altniocto1fp r ieo;(0t2xrxr3no4lptemieias  rtmx o;o4tpe iieiydlaDelnvp;(4trxomo3io1lpte uvs s)truoimpnydole lfeslt)a2ua( ono0oex  f3tatlm ea(von(0treoir todlm  au o s)s2xo(m3iy1openlfcsas)aDurur ;o4teeoio3iytfm2rlnvs (0trtnirciy1om  lues;s t2uo(o3oo4al e fcsa()sDtm(m oo4olx  i3iatlsDeanvsnt4aetoif3oy1fm ranvi ()t2xmim oy4ol   fesatf 2ur(ro;t4oleomf3ilt a rlnvp u) rxoxr ia1omt aneo s  rtrxrpnu1amt lfvilt s2rm(ro;u1tltnmf3tltfa2emn s;t)tetoif oy1lmt lu sl()tetmim nu4optn ivtl() 2tmx pot0oee  i3iydlmDra(mo t0 renifcoytlm eai i (0srxmirpnudam emneilt  ruaur ;u0tpe mf3tytlm2ran o;(0texnxr3oadlaDrlu o t)trumxopnodoltemnvsls sDta(rpnu0aleniiciltlmDran p t0 rerircty1fatr uvo;s texo(mpny4oltelfetl(fs2raumoou0opt mfeiydlaDumnmpnt0 eerio3tatom rau sl(0 rtr(r3io1lpeelnctatfsrrmxroot0alt if3iltfm2el(mo t4aeerxo ty1omD lu o;s) 2uo(r nu4omtnlici (fa2tr(mooo1opeomfciaslmDel(von() eeoifciadoat luvo;t)sruo(r ny4lmtnlneils  Dur(moot1aptnii3ildfm2ulums;u4 reomrctadfa r nvsls)s2umirpoo1op  mfcil(fsDrruro;t4texniiciyd mDrln s u0 exrxf to1fptelnei;t)s2urxopiu4apee neiat) 2uaumpou0aexomoeiytlm2rmn o;t)altnifcoydop elu i;t0trtmxopoo4altelivs s artau pnu1oexniiciyt a uau p;()arxrxo3oydlmteln i ()sexo(o3nu4lptn ivtlt a2tm(  nt1teeo fciatlmDumn o u) ltoircta1oaD auvi;t seur(mpiu4optemict () rum( p;t1olx  ieiaslaDrlu s;t)altoio3oa1op e neils)t2xmxopoo4ap e ivi s) 2rrur ot4opeomi3ilslm2elnvs u0arerxf ia1lm elu ol(0teuoimpny4aptnlnctat)s2trxmonu4opxniieiasla2rmuvs u0trerircty1la  livs s) 2tmirpiy1ape mieiatf Dtaurpno0tltnmi3tytlsDraumo;u0treoiociytopteli olt seurio3no4lme liciasfsDumuro;t0tle mictatls rm( o u0 exrxrcio1omDelivsls)s2toxr ny1alenlfesatfa2um(  no0tetomiciysfs2uauvsn(4 lxoxo3todfaDr n sl(0s2xo(rpiu4llt  nvs t) ruru ooo0oetnmi3iysla rln s (4aexnxo3oadlm rlnvs;t)setrxmpiodoltn ncslt  Drm(rp;t1olxoiicildlm2ran o (0tetrifctotomDeau o s)t2xo(o3oodlpt lies tfsDumx pno1oltn o3ias aDumuvp (0 etoiociydlp e i s t trxrxr3io1alee nvsa(faDuau pnt1tleomieild aDumn p u4trxoxrcty1omD  neo (0 rxoxmpiu1omtn fvs ()a2ra(rono4ope  fctatls2ulumo;(4tltniocta1fpD  ieil(0 rumxm3oo4amtn nei ( srtrumpou1tlt  ocils a2rau o;(0aexomf3ta1opD anvi;t)t2xr(o3iydol  licslt)a2um(m nt4tpt ii3ildfs2uluvp u)tltrxf ty1opD lu s (  rtmxmpiu1amtnlicslt  rtrxr nt1oeeomfciys m rlu snu) rtnmf iadfmtrln s (0srto(m iydomeemies s a2tmx pou0tlt mfcilslm2em(vp ()aexnmr oo1oaD aieolt0 rtm(rpoy4omte nesl(fsDrmu ont0oee mi3iadfaDel( ont4tlerir3ootlpt  i ol(0 2toim ou4op  mncsa()arum(m no4tlx iocildfs2umu p u0alerxf to1om   ivsls)trtmxrpnydlptemfcs ()srumxr ;t4apen o3ildls rl(mo ()tetnmo iytoat aues s0 exr(rpou1al elfctlsf ruaxm ;o0oet  ietatlsDra(mo t)texnmo oo1lptranvi (0 eumim3oo1omt mnci t)s2taumpno1tee  feiyd a umuvp;()teerif3tadomDraies (  2xrim3iy1lptemfvsat srrmur ;u0aexoiocildfm elu pnt0trerio ta1lpDrlu i;t)sexrim3iu1aptnmnesls) Dtmx p;t4aleomoeiatla2elnms t0 lenmr ia1lp elieil() rxm(r3nodlleelncslt sDur(monu0teeomietad m2eln on() eeoxf oatlpt auvo;(0 exr(opio4optelfct tfa2raxrpnt1aee ioeildla rmnmp;(0 etrio3iy1lmt  u s;s) eur(o3oudlptemiet t) Dtau pot0oet mfctld m uau p (4trtoxfctatfpt luvi;s0 exriopoodlpt mfci t artm( ooo1tlt  o3ils m rmnmpnu0 lxomo tytfaDeliesl(0setmim iu4lpenmiei (faDrmxmont4alx  fcilt a2elnmo u0aexoif to1oatr uei;t0texr(rpiu4ope  nviasfaDraur ;t0oeenmi3iltfm emuvont) lerircio1lmtelivols0trxmxopno4omeelnesatfsrum(  nt4openmoctlt m2ul(mp ()artoir tatop rau i s t2xoim ny4ame mivil(fartmump;o4aexoiicils s eanmo;t)artrmf ty1opDeluvi;t0srxmir iudlpenmneslt) Dumx ono1opxnioeilsfm ua(vo t0 rerxr3iy1oaDranvs;s0t2ur(o3ny1amt mnviat sDrrxmoot0apxnmf3tad a rauvsn(0 eenifciatla eau i t0s2ur(r3iu4lptnmiesat)aDrm( o;u1tex io3ildfa rlumsnu0artoxr3iytlaD luvs;t srtoirpny1omenmfctl( a2tax  ;o0aeto f3tyt m2elu pnu0 reoxr3oadop rlivslt0 etmim oy1oltnmfvsat arrmumpou0oee mf3tatfs2em(vs;u0artoio3iytlp  luvi;(  rxr(m iodome  fesas)aDrm(  ;u1ale miciys a2ul( o u0 renifcoodfa  lu s;(0trxrio3oydlmenmivtls sDraxmpot4oltn o3iatla2ulumsnt0 lxrxr3ty1fa eai i;t)seum(r3nudal e icsl() Dtr(r ot4tet  octlsls2eanvsn(4aexrmf iadfpt lnvs;()teumxrpiydol  miviat  ruaump;u0tlt mf3iatls uanvs;t0 exnxr todfaD lu s s tetr(o iudal  mfvsls)sDurur ;u4olx  fctatfs2ea(mo u)aexrmf3tytopteauvslt0 2uoiopno1opeelieslsfs2uaump;u1tpe mfeiys s2ea( p;(4texrir3oodfmD li o s0t2to(m io1amee nvsasfsrrrxmpnt4aee ii3iysfm rm( pnu0treomrctatlaDelueil(0s2xmxrpnydlmtn ncta() Dra(  ;u1tltnmo3ildfm2rl(ms;u4aetnmr totomDean o (0s2xr(o3oo4ap nlieta()arrauro;o4oltn o3iat a2rl(mp u4alermfcoo1fmDe n s;s) exr(m3iy1amte nesat) rrmxr ;t0opxomietlslm2rau p (4aeeoxoctydlmtrai s t) rtoiopiudap e fei s  2umurpnt0oet mo3iytls rmnmo ()arxnir3iodlpDean i t)teumxr3ou1alt mncs (fa2umxrpoo1teto f3iltlm2ranmpnu)tltnxrcoodfm rluvi;s0t2trxr3iy4ol n feiat)sDtmuro;u1tltnioctyd aDrmnvon()tltrmo iadfatrau sls trtoim oy4om emies t sDrauront4apxoifciasfmDel(mont) renxo3oa1fpDrau sls s2ur(opoodlleemiciatfsDrmumpno0opeo fctad s rln p ()trenio tydop rluvo;t  ruo(rpnodam nmnvtls)sDtr(r ot4tlxn i3iadfaDrmu o t4 lxnifcoa1oa   u s;t0 eurxo3iy4amt  ncsa()s2ra(mo;o0tptoiieiysfsDrl( s;u4 rtomo3oydla eau o t) rtrxmpno4opt mnviat srtau ono0oeeomo3iydls em(vp;u0 rtnif3tadfm elneo t0sruo(mpou4alen ieia() Dta(r no4teeomi3ildla um( o;(0tltnifcia1omtr nvslt sexo(o iy1lmen ivilt)a2tr(r ou4opt ifciad a2ua(mp u0altnmf3to1omte uvo;()trum(o io4apenlnct tf 2raumpno4alt iieiysla uaums u0tltnxf oo1opDrlivo;t truoimpiu4olte ivsa(fsDrau p;u0apeomieiytfs um(vo t)tleomf3to1opD  iei;t0srtmxr io4am elfeil()arumxr nu4aptomfeiasls2rl(vs (0trtnmr3iytla raueo;(  rxoxr nudlpe  ncsls  rraxm ot1optn f3ildlm2em(vsn(0tetnxociodlpt lnvsls)srxoxm nu4lltn ncsatf rur( pno0olx  ictydfs elu ont0altrmo tydlmtrauvil( s2uoxmpnu1optn ict ()a2ta(mpot1opeomf3tadfaDem(mo;u0tltnio iodopD au i ()t2to(m3oy1ol emieilt) rtax pot1altnifeiasfs2uanmp;u4 lenxf tadla r i s;() rtmxr nu1lltemnctatf rumurono1oexomfetydlm ul( s;u0texnxfcty1oaDrluvil(0truo(o3nu1altn nct sfaDtmu o;o4optoioeiatfsDemuvs;(0aleoir oytfaDe ies s)srtrxm3iy4am  mncsl(  2umu  ;o1tpeomfctys a2ua( s ()altoio tatlaDraiei ( s2xmir3oo1oltelicsa()a2raxmp;t4optn ociltlm elu p (0artoir3iodom eliesl( srxo(opiydam nmfvias) rum(mpot4alxo i3iys a2emuvs;(0arxnir oo1op  lneo (0 rtmxo3no1apt  fvia( arrmumoot0olx mocildfaDuanmo ()arxoxf3iy1lmt au s;()seurio3nu1lm  lnvi t srtm(root1altn o3iysls eluvp;t4aetniocoo1fate u o;t0 2uo(rpnudlmt mnct ( a2ur( pnt4alt mociytlaDeluvo;t4trtnxrcoa1fpDrau i (0t2xm(m3iu1ope  ivsl( arrrump;o1olxn ociytla2rmumo;u4aetrirciydfptrai s;s0trumxm iudlp n feils)srtaumo;u0olt  fctldfm emn p u4 lxoxfciytfp eau o;(0 eum(opno4ol n fvt t  2tr( p;t1ape  fetad aDuln o;u0tleoio iy1omtr neols0 eto(m3io1om nmictas) rrr( oot0opx mo3iltlaDrm( p;t)artrxo tytom  luei;(0setrxo3nudaptnmivil()sDrmur nt1tpxn fciat aDuaumo;(4artoio oy1om raivsl(0 exm(opno4apt  fvsas a2rr(monu1oetoii3tas sDraumont)alerxf totoateli ol(0 rtoxmpoy1aleelicsls)aruauront1texo ieiytla uan p;(0tlxrio3iydfm r u o s)setmim ou4alt mivtl( sDurumpnt0tetn ieiat s2umu o t)teeriocoytfptrlnvi;(0trtr(rpny4ll nlics s) 2urumoou0olenmi3tasfm2uln onu0artrmfctodfm e nvil(0seurim3no4op e fesl(  2tm(mpou4tlx ii3iyslaDem(vsnu0arxnmfcoytlm  aieil(0 rxrir3ou4omt  fcil(f Draxmpnu0tex mieils a2ran on()texnmociatoa   ivi t0s2to(o iy1apeemnctat)a2rrxmpot0oee  i3iytlm raumon()aleoxr io1lmDeau o;s0t2ur(mpio4alee icta(f 2ua( o;o1aetnmoeild s ea( s;t0 exnxr3ia1fp elnvsl(0t2tr(rpoo4aptemfcsls)sDumuronu4tee iiciysls2rau p u) rtnircta1fpDran ilt0 2uo(o3ny4aptn fcsas a2rmx  ou0olxnii3ias aDuanvpnt0tlxrir oo1om  li il( srtrio3ny4lp nmfct t a2rm(mp;u0texomf3tatla2rmnvp;(4 etoircoa1lptr uvs;t)tetm(r3no4ame lneilsfa2ta(mooo0oexnioeias a el( o t)tlenxf3todfat lueo s trtrxr3ou1ap n ncs s arrru onu1oetnmfctatfm2el(vs t)aexoxoctodfa r i il( trxmir no4ol e ncs s)srtau p;t4apxniietydfs rau s u)aeermrcia1fa eai ilt)texoxo no4al e nci (fsDumxmpou1aeeoio3tysfa eanmo;u4trtrxrcoydlp elueol( trurimpoy4opeelfesls a2tmu  nt4oeeomo3ilsfm rlnmp t0 eeoxo iadfatran o;s  2xr(m3no4olenlfcslsfa2rr(mp;t1altnioeiat s2eanmp t4aleoxo iy1fmt  n s;(0t2tmxr oo4aptnmncils)srrmx p;o0optoiociadfs ea(vs u4arxoir3ootfm rlnei;(  2trxr iu4optelfvtlt)sDtmx oou0aex  iciat s2ulnmsn(0trtoxf3totlatr ieo;s) exmiopno4omee icsatfs2raum oo0tlt iiciat a2ul(mo (4trxrmociadlaD aneo;(0setrxrpoo1ome  fciasfsDua(mpnu0aex mocilslsDean snt0tltoxrcoydlmDelieo t)t2to(opiudlme  ivia()s2rm( pno0tpxomoeilslmDrauvsnu)teeoio3iotfm  aieils  etoxm3ny1aptemfctls artr(mp;o1ale mietas s2em(mont4artnmr todfa e neol(0t2to(m3ny4llenmnesat s2ur(ro;u1aee ii3tyt aDeln p (4aetoxoctatfm   i olt) eum(rpiudolt lnvsa()arrrum ;u1opx  icildfs2emnmp;(0 exrxf3ta1lmDraivo s0s2toim iodalte fvt s) 2ta(r ;o0tpxomfcild s2eanvs;t4 etomo3tytfa rau s;s0 rxo(mpiydalen nct s)sruax  ;o1aex mo3tld s2ean s (4alxrircoa1oaDeanvs t)srtoio3io1am nlfvi s)arrru oot4oexomf3iytfaDrmuvpnu)alerif3tadfaDrln ilt teumirpio1altnlnvta(fs2ur( o;o1apx ifeilsfs rln s u0trxrmf oodoptranvo s0sruoxo3nodap n iesl(  2uau o;t1tlenifciltfm ra( ont4tleomrctydlmt ai o t)t2xm(rpou4ol  lfesas sDur(  nu4alx  o3iadlsDrmn s t4teenmo oy1oa  au ilt trurxm3oy4ole  ivs sf 2truro;u0optomoeiltfmDulnmp t0aeeoifcoa1fmDeaieo;s  2xo(m3nydameelivt (f 2umumonu0aexomf3ild sDrmu on()trtoxocty1lpDrlnvi t trxmimpoy4llenlivi t srrrxrp;o0tlx  o3iadfa2eluvp;t0alxoif oy1lpDeluesl(0 rumxopnu1lle lfvslt)a2rrxr ot4opxoifctldls2emnvont0teermo3iytfm e ivs;t)s2xm(o iu4am emfcil(fa2rm(r ;t4oee  ociadlm2eln o t4tlxoir oadlp ran olt) etrim3iy1oltn fei ( s2ra(r nt1olx ioctls m ua(mp u4 lerxf3iydfpDe uvo s srtrimpiu4lmtemnct sfs2taxro;o0apen f3iad aDrln s;u4 ltrif ty1lmteln o;s) euo(opiu1lp e fvsltfsrtrxm nu4aex moeilsls2rlnmsn() etoxo iodlptean i;( srxrxo oo1al nmicslsfsDtmuro;o1tpt  feias s2ulu o;(4 rxoio3ta1fmt  nvo;()teurxo3iu1lmt  nvta( aDra( o;t4tetoioctldfs2eauvon()arerio3oytomtelu il(0 rtoxm3iu4lpe lici t)s2taumpnt0opx  iciyd a ea(vsnt4 rxnio iodfp  aues (0t2urim iy1lp emicsas)sDrmx poo0aexomieiysla ul( pnt)aetrir iatfmtrli s t t2um(mpoudopenmfetat a2rmuronu1tle io3ildla emu p u)texrir oadop  an o;(0 rum(o3oo4lpe livtls sDrax  ot1opx mfctlsfaDrm( o;u)areoir3ootlat  i i t) exriopnydlpenlivtls  rur( pnt1tpxnifciadla2emumo u0alxnxf todopt an s;() rxmxopoudoltn fes sfa2tmurpno0tleo i3iltls2umuvpnt4trermr todlatr uei s)trurim iy4amenlfcsl(fsrum( o;t1oleomociytls ul(vsnu0alenxf3tytfmDeau ils0 2xoxmpny4ole  fesatf Dur(root0tpe ifeiltlsDra( snt4 reoxf3iadfm eaivs s) exmxr3nu4ap nlnvs (fa2rmuroot4ole mieiad mDel(mo;(4tltrif3iotoptrluesl(0srtmxm no1al n netat aDrrumpot4alxnioeiasls em(vpn(0tetrmrciydfpDeanes ()t2xoxm iy4optnlnvtlt) Drm(  ot0ope  feiat a2emu s (4tlxoif3tatoat an il(0 rurirpoy4open fctl()s2umxmont4olt  f3iysfa uluvp t0 ltoio3oatfm r nei;s0s2umimpoy4apeelfcsa() 2urum ;o1oltnmocilsfm uanvsn()teeoxo oydlmtran s s s2xoxo3ny4apee nvsas)aruaxr ot1olxomictytlm rl(vs t4 etrmf3oytlaDrlu i t  exrim oy1lmtelivtlsfarurum ou4opx ii3iltfmDrl( o t) rtrir tatlp e n ol(0s2trxo oo1lpeelictasf 2raump;o0altn f3ias a eanmonu)aetrxfcta1fmD aivo s0t2trxm3oudaltnlnesas) rtmxmpoo4aexniiciltfa2um(vs u)arxoxfciydop rlu ol( srxrxr iy4openlfetl() Dtmu onu1optnio3iytfs2emuvo t4 rerxocty1laDeli i;t srurxo3nu4llte iei (  2rax pot1oetnmo3iys sDeau p;t4 rerxo3oydlmtelu i;() rxrimpoodoltn fcil() 2rax  nt0ale mociydfmDrau p;t0tlenifctytlm  anvolt)t2xrimpio1ll emict sfs2rr( o;o0aexo ociasfaDeaumonu4alxrio3iotoa r ieslt trumio oydamee ivt (faDrmx poo0alto oetyslm uaumsnt0tlxnmo3iydfpt aies;t) rxoir ny4lm  mfes t  2urx ont1tleoiieiatla2em(mp;t0areoir3ta1fp rli slt)s2xm(o nydam emieta(f Dumu  ;u4olx iieiys a ul(mp t)texrif3oadopDr i s s0 etrirpou1amen fcias)srrrx o;t1oleomfctytlm2eln onu0aleomo3oytopt  u il()trto(r oy4lle livilt) 2rmxr nu4tlxoii3iasla2emu onu) eeoxf iy1optr nvo s)t2toio3nydam nmfcsa()sDtaxm ot1apxnioetysls umuvsnt0trenifctydfpteli o t0 2xr(rpnydamtn iet t)aDta(m ;u0tet mi3tlslmDrmuvp t4texnmr ootom rlivslt trur(m3nudopt  fcias  Drm(rpnt1ale mieiydfa rlnvs t)tlxoif3iydlmD  i s;t0sexriopoydolte ncia(faDraur ou4olt  ieiydfsDeanms u4arxnxf3tytla eaues s)teto(o iu4ome lnct (fsrur(  ;o0apxnifeiydfa ulnvs;u4 rtomf todoaD an ilt  exoxr iy4ll e fctlt  Dumxmp;o1alxn ictatlsDemnvsnt) etnmf ia1lmtrlies;(0s2xoxm io4om e fetas aDrr(mooo1tptomieiasfs2ul(vo;() rxoifcty1lmteluesls  ruoimpiu4amenmfet t aDum( onu0opxoioctas m2umnvo ()alxnmrcoydoaD  uvo;()s2uo(o io1ope  fei sfa2rm(  nu0texniieiyslaDranms u4 rtrio3oadfaDran o;s trxr(opiu4llt licils)a2rmxm ;t4tpt mi3iatlm2uaumsnu4altnmf io1lmt aueslt) etrir ny4ll n nei tfs2rmx p;t1tle mo3iys s rm( on(4 etomfcoytomD  nvs t  2urxr io1op   ivtatfsDtaxm ;t0apto o3tytlsDel( o;(0tlxoir3iydoatraues;()tetr(rpoy4ape mnetasfarraxmpoo1tlt mieiadfm2ran p u4artriociydoa   n o;s)s2xrxo3iu4llenmies s) 2rax p;t0aleomociysla rln s;(4tlenir oodfaDrai o;t0s2uoir3oodalt lneil( s2rr(m no0tptniieiysla ulu sn()tetomr3iadop   ueils trtm(mpio4apeelfvs (  2tmur ;u1ope ioeildfsDul( o;t0 eenxf oytlaD au s s) rum(opiy4am   fci s aDrr(mpnt1olto fciat s2eln o t0 rxnxr3io1oaDrauvo ( teum(rpnu4ol e netas arurxr no4tet mf3iadfmDul(msnu0treoifctydfmtr uei ( t2uo(rpoo4opt mnesltfsrrmu  oo1tlen i3iadfs rmn s ()aetrxo iy1lp e uvils tetoio iu4ope lfvtl(f 2ra( pou4tle  o3tls mDeau o t)aetnxrcoy1oa  an o t0s2uoir3ny4lptemneilsfarra(rp;o0oet ioetat aDraump;u0teeoxr3iodlpt  ivi t0tetm(r nu1ol nlneiatf rrmxrp;t4tpe ii3tysls umu onu4alenxr oadlmDeauvs t0t2ur(o3iydlmtn ics s  Drr(mpnu0oeto ictltls2ra( o;u4arxoxo oydlmDrli ols0s2xrio oudlltn icsltfa2ur(rpnu0tpeo fciaslaDelnvo;u0alenmr iadlmDe u s t0srxo(m3oudaptelict tf ruaumono1tptn fciltlmDumump t)texrmo ia1oa eluvi ( s2xr(m3nu1am nmnvtatfs2urumpnt0apto oeiys a2ulumonu)tleoifcto1fpDrluvo;(0trxrimpoudol n ictls  Dtaxro;t4oetomieiatla ua(vo u) rtomf oydfaDeaneo;()seuoir3iy4am nmfei t)a2tru  ;t0opx mfctytlsDumuvont0 rtoifcoy1oa raieils)trxm(m no4lpen nvtlt a2tr(rpou0alx  iciasfm rmnmonu4tetomr oy1lp r uvs ()t2uoxrpoy4lm   ivils)arum(r nt1oee mieilsfm2eanvpn() eeomf3oytlate nes;()t2urxr ou4lm n netltfa2taumpnt1tpto i3ilsfm rlu s () reomr oatomDeai olt) etrxm io4optnmnvilt aruaxm ;t4oltoiiciysfmDran p;(4 eeomociydla elnei;s) exmir oo4lptn nct t)aDurxrp;u1tetnmieiadfs rmump t)trxrxf3oatomte nvilt)teurxrpoo4ape lnvias  2umxm nu1apeoio3iltlmDem(vo u0arxnmo3oodla   ieo;(  2umxopoo4amtnmicsl()sDrrxm no0oltnmfciydls rl(vsn(0trerxf iy1opteluvsl(0seurio3oo1op e ivtas sDra( o;t4aleniiciydfs rlnmo u0altoxfcty1fa e uei s) rxoxrpoy1amtnlnvs sfsruaxr nt0tleo f3iltlm ra(vs;(0artnmf tytla  au o s)tetoxr nu4ome lfctasfartmu p;t0alxoifciys sDra( s;u0tltomo3todlm  li il()teuo(o oy4olenmfvs t) Dum(mo;o0oex ifctysls rm( s u) rxoio3ty1la r uvs s0sexriopny4llenmneias)artmurp;u4tpx iocils mDemn o;(4 etoio3tatlp rli o ( teum(m nu4om  lietl( a2urum no4ope mfctytls rlnvsnt0texoxoctydoat li s s0s2uo(o3oo4oltn fciltf rta(m ;o1oeto oeiatfa emnmo (4 eeomf3oy1fmteliei;s) rurir3ou4altnliei s) rrr(r ;u4opeo feildfsDel( o;(0 eeomf oydfpDrlivi;s0srtm(m iu4omen ncta()srrm(m nt1tpxnmieiytfa uau p;t4alerif3oodlmDrauvo t) rxmiopoy1lle lietls  Dtm(  ot0aeenio3iad mDulnvs (0 etnio to1fateauei;(  ruoxr3nu4om nmiei (  2ra(r nu1aeto f3iat mDulnms;u) lxomo tatomDelivi;t) 2tmxr oo1openlici (f rum(m ;t4aleomf3iaslm eauvs;u4 rxrmf3oodlp eauvi;s)t2tr(m ny1op n ies t) rrm( pnu0oeeomo3tasfa2uluvs u)tetomfciy1lateaivils0t2toxm nudaptnmfcsa() 2rmxr ;o0tlenmfeiatls2emnvs;t4trxnmrcoy1fpDr ivo;s)setoxr3nudlp   ivs s)aDrrxr ou0ale ioctatfa2uau o t4teeoxr3oytfmt  uvi;s  etoimpoy1opte ncsl( sDrmxrooo0texoifeiyt sDumu on()trtoio3oo1lm r ies t0teur(opoo1amtn fctl()a2tmxm ;o0tpeniicild mDuanvs (4artrmo oo1lmD luvs;s) 2uoxo3ou1ap nlfesa() rtrum ou4ale ifeildfmDuaumpn(4teeoio iytlptelnvsl(0t2xmim3iydlptnmivtas arrm( o;o0aptn f3iys a2raump u0altoxrcoo1laDr nvolt0sexmxopny4lm   nvsa()sDra(mp;o0tptn fetyslaDeanvsnt) lxnmr3totfmDe nvo t)s2xrim3no4ape mivs ( aDrmuro;u4texoif3tad a2eln pnt4tltrxrciodopD auvs s0s2um(m oodlmeemnetls srur(  no4ale  ieiltla raump t)aexomr3iy1fmD  nvi t) rxr(r3nu4llenmncs sfaDra(  no0opx  fetlsfa2uanms;t) reoif tydfatelueo;t) rxmxo3oydopt micsl(  rtau pou1tlxn ociad m2emuvo u)tetrxr ta1faDr nvol(0t2tm(r nu1aptn ncsl(f rrr(mpoo0open icildla um(vsnt0aexomo3oa1fmte i i;(0 etrxr ou4omte ieslt  2ta(ro;u1teeo ieiadlm ea(vsnu4 etoxo3oodfm r uvslt)s2uoxrpoydomenmnvtls  Duax  ;t0optniieiytlm rmnvo;t)arxoircty1lp eli olt0 euoxr3iy1lp n nvias) rumxmpnu1oltnmi3iltlsDrmnvs u0trxoxr3totoat  nvo t)seumim3iudapenmfcia(f 2uau  nt0aleo o3tys a em(ms t0aetomrcoodoa raueo;s)srtmxopiu4ameelncil()s2ur( pnt0aexomoetltlsDrm(vo;(4tltnif3totlptr nvi;s0srtoim ou1lpenmncsl() Drrumont0optnio3iltla2ulnmon(0 etnmoctodopDr u olt  rxrxo nodam nmieslt  Dtm(r no4tpto i3iltlm2rmnmont0alxnxo oadop eaivils)trxm(mpiy4ol emnvtat a2tm( pnu4alto ociys a2emnvs u0artrir3iodomt  nes s  2umiopoo4am nlictl() Drmxmpnu1tpt ioeiydls emnmpnt0tlenxo ootfpDrlivi s)sexm(m3oudame lncil()s2tm(mpnu0ole mi3tldlaDemnmp t0arenmocoo1opD  n i t0trumir3oo1apeelictltf Dumx ont0alxnmieiydfmDrlu pnt4 etoxr3tytlmDrln slt  etmirpiydalee nvs (  2tmxmo;o0olx mi3tadfa2umumo;t4arerxo3totopt lneo (0s2xmxo3oy1op elfesat) Dtmurpoo4ale mociytls2ua(mp;()tetomr3iy1op   nvsl(0 rurxr3io1ol emnetasfaDrrxr no4aetn oeiadfs2eauvpn(4 etnio3iytfpDeluvilt  exm(mpou1omenmncia() 2rm(mpou1tlenmo3tadlmDrmnvont4 rxrxrcootfm e uei () etr(r oy1amt  ictls)aDrmx ono4alto fciysls ua(vsn(4 rtnxfcoytop raiei;s)teum(opnodamtn ivtat)arumxm ou4ope mieiyslm2eln p;(0 lxrio tadfmD auvi t)teuo(opoo1lmeemici () 2rmumpnt1oeeniocilt a2uan s (4tlxomfcto1laDrai ilt0t2umxr3ny4ol e nesl()sDtmx oot0aeen f3tltla ua(ms t0aleoxfciotfa  anes s t2xmxo3ou1ap n ict tfa2rr(  no1oetnmfcilsls2emuvs u) lxoxfcty1fpt  uvsls  ruoxm3nu4ome lfesas) 2urxmp;u0alxo i3iadfm umn sn(4trtrmr3oo1lmt aueo ()t2xrim oodape mnct ()sDraum oo4olx mo3tyd s rlump;t0aeerircoatomt ai il( t2urim iu1om  liei sfsrumuro;t1aee if3ils s2ua(vo u)aetnmocia1fat luesl( sexrim3iydalt mieta( aDta(r no1tpen feiytfs2emn p;()trtrmf tadfpDr nei;( srurxo nydomeelivsas) Duau pou1tpe  f3tatfsDea( snu0tlenxr3oadopDeau sls) rxrxm nu1om elfes ( srta(mp;o1aexn o3tadlsDrluvs (0areomr3iodoa e nvi ()s2toxm iydopt  nes t)sDra( pnt0aptnmi3tad sDua( p u)tlxoir3to1la r i ilt teurio3iy4lptn netasf Durx o;o1aeto o3iatlmDraumsnt0 etnir iodfmDeai s;( setoir3oy1am elics () Dtr(root0apxo f3tyt s rlu snt4 etrifciydfp e i s (0teurim3ny4op elivil()a2umumoot4aetomociyslaDem(mp u4artrmrciydlatraneo;t)sruriopiu4am emfei t sDumum ;o1tleoifeiadfa2um(msnt0 lerio iotlp   n s t  rumim3nu1lptn fetltf Dra( p;u1tpe ifcilsfaDrm( ont) etnio tydfpDr ivil(0setr(m ou1ameelneiltf Dtm( pou1opxo iciltls rmu snt0aeerir totfate n ils0s2um(mpio1ap  miesa() 2tax p;t4apt  i3taslmDuan sn() lxnxf todom  aneolt) etm(m ny1llt mivi s  rumum nu4tet  fctlsla rluvs t0 lxrmf iatlaD auei (  2to(rpio4altnlnvia( a2umumoou0teeomi3tys m2uau o;(4 rxrioctydla eaneilt0setmxr3nodopeelnvi (faDta(mpnu1optnmf3ildfa2eaumo;t) lxrxf oo1laDelivi s tetm(m no4al   ieia(farrauront0olxomieias a2emnvon(0aetnmo tatfmDr ueo s0trxmxrpnu1lmtemnvsl()sruaurp;t0alt io3iasla ra(ms;t) reoxrcto1omt lu ols)t2xoxmpno4oltemnvia()s2raxroou4open feildfmDrlumpn()aetrxrcootfaDelueo t  2xmim3ou1omenmfetltfartr( onu1olxn ocild s rauvsnt0 reomrciy1lp  lu slt0 rurirpoydaltnmncsatfarurxmpnu1oetnmiciytfa ranmpn()tetrir oa1fpDr ues;s t2tmim ou4ap   ieslt  Drr(ront4tltnmoeiltlmDrm( o u0 lxnmr3oadlaDeli s;( seurir io4omtnmneta(fsrra(ronu0apxn octldfa2uaums;t)tlenif3ty1lm elnes;s0seur(rpiu1lleemnvsasfa2tax pnt4aptn f3ildfm eaums (0tltrmf3io1fmDraies;(0 rxo(r iydape micil( aDurx oot1tltnmfeils s2ean s;(4aeenmr3oatlpt lnei (0s2tmio no1lptn net t  rtr(ro;u0aeenmfeiysfaDel(mo u4aeeoxr iadop eaiei;t)seto(m io4omte iesa(f rrm(mpoo0altn o3tld a2rl( o t0tltrmociy1lp  livsls)tetmxr3io1al nmfctl()aDtau oou4oeen iciyd a2um( s;t0 leomf iydfa rli sls) 2xrxo oo4op n nvtl(fs2um(rp;u4oltnioeiat mDrln pn(0 lxrxr oatop eaiei () ruoir iudal nlietas)srtmumo;u4tlx ifetadfs rmu o u4altoio todfpt lneo t seum(r3iy4lp e fvs ( artaxmpou1optnif3tatfaDelumont0aexnxociadfa e ueils  rxm(mpiodaptnlfcilt s2tmu p;t1tleniiciydfsDrlnvonu4trxrxr iy1op  lieo;s0tetoxmpoy1lpee fesltf 2rr( ooo4aleoif3iaslm ulnvp;u)trxoxrcia1fatelnvsls)t2toxrpnu4lm n nvia( sruru oou1olto ociasfsDul(mo;u)alxoio3iytfateln s;t0texrxr oo4ol nmneiasfs2tau ont4tlx  o3tldfaDulnms;u4 rxnmf3oytom   n i;t trxm(opny1amenmnvtat  2tr(rp;t0optnmf3iyd m umu snt) ltrmrcoy1opD  uei;s)seto(r3iu1ll  lfvi t) 2tm( poo4apxo feiysls2um(mp (4 etomfcto1fpDelneols setmio nydll   ivil( a2trur no4apeomo3tytlaDum(ms;t0aexoio3oydfmDeau s;s)srxmxopoo4llen nvta() 2ra( pnt1ape io3ils mDemn ont0tlxrmo tydlpDr nvs;s teuo(o iu1op  livia() rtr(ro;u0tptn o3iat mDum(mont) lerxf iadfmDrli sl( setm(o io4ll eliesa()aDrmur ;u4ale iociadfm emnvs ()altoxf ia1om  ln s;s0srxrimpoo1lltemieiasfa2tm(rpot0tlxn ociad aDrlump t)trxnmr3iotla eaieils  rtm(m io4aptnmfci s) Dtrxmpou1ope iieiytlsDeaump;t)texrxo3iodopte i sl(0 rtm(o3nu4lm nmnct (  rur(mpnu1tex  f3iat m2um( snu)trtrxrcoo1fpte ieolt0trxo(opoudal  lfetl( aDrm(  nu4optomf3iltfaDrm(vonu0 rtnmocoydfpDe nvs;t)t2trxm nodoptelncilsf Dtrxm ou1ape iociatlsDeaumo t)texnif iadoa  lu i;t)setmxo3io1apte fcs t) rrr(r nt4tleo i3ias a el(mo;(0 etrxf3iatlate uvi () exmxopnydam elieslt aDur(m ot4aptomfctytls2um( p u) rtoxfcoadlaDelnvolt t2trxmpiydlltnmfes t)sDtrxm oo1alen o3iadfa umu s (0arxrifciytom r iei;t)seur(opnudom elicsa(fsrumumpnt4tpt iociydla raump;t)altoxo ta1fa   nvi s0trtrir3no1lpenlics t a2rmu pnu4apeoioctlsfaDrlnms (4tleomr3oadfaDrliei;t truoxo3ou4llt mfvils)sDuax  no1aptnmietatla2rm(vs t0aetoxfcta1lptrlueo (0 eto(r3iu1aleemfvslt s2rr(r ou4aex mfctadfa eaumon()aetoxrciy1fp   uvsl(0trxrimpio4llt  ivsas)arta(moot1ale mictasfmDean o;u0alermr oodfmt ln slt) eurxm3iodolt  icsls)arurxr ;t1opeoif3iyd sDua(mp u0 lenxf oy1faDeanes t sexoxm3iu4ole mfeta( aDrrxmo;t1tetoiietas aDelnmp;u)tleoifcoodfm  livi s0 rur(r oudoltnlfeia( arrr(mo;o4ole  i3iys a2el(ms t)tetomf oodla elu olt0trxmxmpny1alen fct ( srrmxrp;t1oltnmi3ias s um( ont4artoxf3iydomDelneo;s)t2uo(m iy1lmt mnvtlsf Drr( p;u4olto fetlsfm2uauvo t4teenxr totfm eliei t  2xmxopny1opeemfetat)s2raxroot1olt mf3tys s2em(vp;t4 rxrmr3oytfatr u s;t seuo(r iy4amt lneil()a2tmx p;t0olx io3iydfs uan p (0 rerxrctadlm r u s;t) 2tmirpnodam elnetlt) Draxr no0altnmo3iadfm2eau o;(4 eerxr3oodomDr uvs t) 2toirpio1amtemicsa()s2rru  ;t4tpxomo3ilslm rl( p t0arenmo oodlpDeauvils  2uoxo3io1amt lncsl()aDrr(m nu1tet ii3ilt sDumn o u)areoifciotom ran o;s)s2toiopiodlltemict ( s2rax ono1teeoii3tysfa ranmo;u)trtnmr ty1omtrln il( seto(rpiodlp  lieias srrmxmpnu0olx  f3tltlsDra(mo u0 reniociodla e ieslt0s2toiopny4ape mivtl(f 2taumo;o1alt  feiys s2ulnmonu0tetnxf3io1fatrln i s0sexm(m ou1lmt  fetas s2rmx pot0tleo feildlmDumnms;u)tlermo to1omtrln i s0 exmimpoy1olt mnvs ( a2uau ooo4tet  i3tatfm2umuvo (4 lxnxr3iotfm rlivi;( texmio nu4olt  fcsatfartmxmooo0olen ociysfsDrau o;t0aeermf ta1oa   nvols)texr(rpiu4lle mfeia(faDur(ronu0openioeiasfa2uln snu4 lxnxrcto1la elues;t0teuoxo iu1aptnmnvtlt sDua(ro;t1apxo ictls a2rln s;u0 exrmr iydlat auvs;t srxrxo3nu4lle mnes s  rtrurp;u0aee  octysla emu o;t0aetnmfcoadfaDraueo (0 2tmio3io1amtnmfes t) ruauronu4alxoii3iat mDua(ms;t)alenircoy1omD aiei t0 2xmim3ny4ll emfvi s) 2taum no1tpxomoctaslsDum(ms (0tltnxocoy1fm ran i s  2ur(m3iydam e fvslt)srrrur ;t1ape mieiydlm2rlnmo;u)aleoxrcoy1fptrlnvils)tetmxm ny1lltn ncil( sDtaxr ;t4tet  oeiydls2ua(vsnu0artrio3oatfptrliei t  2xm(m ny1altnmnei ( sruax  ou4tet ifetlsfmDean p;(0alenio oy1oa r n i;s  2trio oy4am  lnctls) Dtrx poo4opx iociadfa umn o () rtnxfcoo1omt luesl( trurio ny1lm   nvilt sDurxm no0alto fctysla2ua( sn()treoxr3ty1lp rli o t) exr(m oydlm e ivsat)sDtrump;t1apxn oeilt s2ulu p;(4 exomf oy1lp ranvsl(0 2xoxrpny1omtemnvi t)sDurx pou0aet iieilt aDra(mpnt)tltnxf tytomDeauvs;( seur(o nu4apenliet ( sDtau ono4olt iieiad s2uanvs;()teeoxo oo1fpD ai s (0t2xo(r no1lm nmfvi t)arurxmono4oee iiciysla2ea(vp u)teenir3oo1fm r ivi;s) rtm(r3ou4amtelnvslt  rtau ont0altomfeiatla2ra(mo t4altnmo3todfa rauvs t0 etoirpnudlpt mnei ( aDtrxrpnu1apxomfciyt mDrau s;(4trtnxoctytlpDr uei;() rxo(mpiu1omee fct tf rrax p;u1aexo f3tldfsDrlnvonu0alxnmo3ia1lmD au ol() etoir3oy1am n ieslt arururont0olt miciyslm2rlnmp;(4arxnir3todfmt luvi s0seum(opny1op e fctas  rua(rpno4apt iieiatlaDul(mp ()alxnmr oydfaD lneo;(  2trxr3oo4lpenlnesa(fsDtm( pnt4aeeo o3iytfsDean snu0trxoifciodfmtrlivo s s2toio3ou1lltemivsl() rua(m ou0oeto feiasls umums;u0tetomf3to1la  ln s;()s2xrio iy4omtemnvt ( s2taum no4tlxnif3iysfmDumn pnu0 rtnmrctadfat  ivo;s)seumio no4alen nvi s s2ra(rono4openmfciadlm rmnms;u0tetrxrctadfpt  u o s0 2urxrpiodoptemivs sf rum(mo;t4opt if3tltfa um( s;u0arxoxo to1fmte nes;s s2uoxrpiydopeemfvsat  2tr(r oo4aptn ictltlaDumuvp u)teenmfcia1fpteaueilt  etoim3ny1amen fei ( s2tax p;t4alto feiyt a2rauvp;u4tetnmo iotlm eli o;()setmir3iydop e nes t)s2rrxmo;o1aeeo ietldfa2rmn p (4aexoif3todfpD auei;( s2um(o iydlmtnmfesat  Drmumono0apeoioctysfs2ua(mpnt0tlxriocoytlp elieo;() 2xm(r3iy4al nmncs s  2rru pnu4tlx mieiyt sDem( p u4 lenxrcta1opDr u ols)teuo(o iy4omeelfvt ()aDtmxmpoo4ale mi3tysfs2ra( p;(4trtomr3oa1fpD anvo t s2xm(o io1ol   fetl()sDrrxro;t0aetnio3tys a emnvpn()arenxr iydlmD lneo s s2um(r3no4alee ieilt s2urxmo;u4ape  ieias m2uluvo t0arxoxr iotlpDe n s;()s2tr(mpnudope livslt) Dum(r ;u0aptomo3tas s emu p ()areoxfctodfptelnei;(0 euo(r3no1omtemnct t a2tmx pou0oexomoeiys s2eauvs u)aeenxf iotfatrlu ols)t2umirpny4lp  lnvsltfsDur(root0texnioctat mDuauvp t) ltnif tadoa r iesl(  eurio oo1om elics t) 2tauro;o4tee  iciltfs elu pnu4 rtrio3ia1lateaieols)t2uo(o iudol n ics sfaDrau  oo1oex  ieiasfm2rmu o u)trtrifcta1lateluvslt) etmim3io1op elicil(fsrtr(  nt4aleomociyd s umn o t0 eerio to1la  ai ilt)tetmxr3oy1am n fctl( srtmuroou4aetn fciyd m ua(von()trermrctydomDrauvi;s0 exrim3oy4aleemnvslt)sruru ono1ape  ieiaslm emnmsn() rerxf oy1op r uvs s0texmxo oydlpe mfes s  rtmxr ou1tetnmi3iaslmDra(mp u)tltnmfciodom   ieols0srurxrpno1opt  ieil(fsrraumoot0tptomf3tlsls rl(mo t)tetoifcoadfa rlnvo s  etm(m3oy1lle lietlt  Drr(rp;o4alt  ieiadlsDumnvpnu4tleoxo3iydfp  ln s (0t2toxr3oy1lleelnvsatfa2urxrpnu0tlx mietasla em(mo ()alxoxo3oadlmD luvo;(0t2um(o3nydope miesat) Drmxr ou1apeoio3ild mDeaumsnt4arxrif totfmtraiei;()srxr(o nu1opeemncs sfarumu p;u4opt  i3tasfm2rl(vo;(4 rxoxf3iodlateaivolt sruoio oy1ameelfciat)srta(  nt0tlenio3iyt s2ulu o;t4arxrio3iatlmtrai o s)trto(rpnu1llt livs ()srtrum oo4oleo oeiaslsDran o;t) rxrircoydoa rluvi s)trxoxo3io4am  mneils  2rmuronu1apeniocias s2um(vo;(4arenircoatlpt lnesl(0s2ur(r3iy1ol emncs ( srrm( p;o0alx ifetas sDrm(mp;t) lerxfcoo1fmD luvs ()srto(o3oudlpe  nvs s) ruaxrooo4alx  fetltls ulu o u)tlxoio tydlpteanvo s0 eumiopiu4omt mivilsf Dumxr ;o4oet  iciatls2rm( pnt0 leomf oatomDran i ( trxmxopou1lpeemictat srrrxm ;u4aeen icilsla uln snt)arerxr iytla eli o;() rumir3iu1lm nlfes ()a2rm(ro;o1apeo o3tydla2ul(vont0 ltrxf3tydfpDe n s s  rumio3nudlpe  ivsa( a2umxmpot1opt  ocias sDea( o;u4tlxomf oodfm eluvo;s) etrxr3ou1omtnlncias sDrr(ront4teto ociyd aDrmnmp;t)tlxrxfcoo1omD an s ( t2xm(m3oy1amtnmnvia(fsDrmu o;t0teeo ieiltfm ul( o;u) renmo3ta1fpD  u i t)t2urxo iydaltnmnctas) rrmxmooo4teen ieiytfaDumnvo (4trtoxr to1fmt anvs s)t2to(m3oo1lpenmfvi ( aDta(  oo1opeomiciasla elu onu4 etriocoo1fat an o t) eurio3io1oltn fvt tfaDtm( ont4alxo iciadfm2ulnmo u4 reoifcoytoatr nvi t srurim iydom nlicsasfsDtru pnu4apx mf3ild a2ul( p (4tetrif3iadfpteln sls  rumxm ou1llee fci ()aDraxr nu4openmi3iatla um(mp;(0 etoif3oydfmtr ues;s trurxmpoodopenlnetat)a2ua(rpno4tpenmo3iad mDrluvo (4tlerif oodlpDe nvil(0 etmio3no4al   ict sf 2urump;o4openmiciat a2emnmo;(0altrio3ty1op e uvs (  rum(m3ou4ll nmnet ()aDrruronu4aex  ietld s2emumo;(4teenif3oy1lpDe nvo s0s2toir iodomee nvtas aDuauro;t0teenmf3tyd a elump;u) renmr3oydlpD  u o;t0texoiopnu1om elicsat a2uaumpoo0oet mfeiyd sDeanvo t4trtoir3ty1faDr ivo;t s2to(rpiydop n ivt ( s2rr(rooo1oet ifctltfs rmums ()altoxf3oa1lpD luvs;s trtmio ou1olt livi (f Durum nt0texoifctltfa2rmu snt0tetrmf oa1fmtr uvo t0tetrxm3iy1lltelfvi t)srrmurono1opxo feilsfm2uluvont4 etrmr3oa1opDrai s t  exrxm iy1op  mncilsfarrauroou0olt  icilt a rm(mp t0arxoxr3oy1fp e nvo;s) rxrxo nudol n nvslsfa2umum nu4teeomi3tysfsDulnvp u0arxoif3iodfmt  uvo t)trxrxopou4ll nmfvt (f 2ur(mo;u1tpeo i3tlt aDrlnvo t)treoirciy1lmDraues;() 2urirpoo4opt lnei ( srtaxmoou4texn oeiadls ulumsn()teerxf iy1opteln o;t srxo(o nudll n ictas arua(rpot0opxn fciyt mDumnms;u4trenxo3iy1fmDr n s t)truoir3io1apt mfcsat) Drrumoot0opxnioeiltfa2ulu o;(4artnir3todla  an slt0srumxopou4ale mfcsat) 2rmum nt1olxomfciyd s2ua( o u) exnif tytopDr n ol()trumxrpno1al  lnvtlt  Dtmu pou4tpeo o3iltla ranvs () renir oadfm eau sls)trtmxm io1aleelfvi s sDraxrp;t0tptn o3ils m uln p;t)arenmo ia1omte uei (0 2xrio ou4omtemivsa()a2rr( pot4ole  i3tlt mDrm(ms;t4arerxo3ty1omDeaivs;s t2tr(mpny4lm emneiat)s2tr(mo;o4tetoioeild aDrl(mp u0tlxrir iytlate ueo t  ruoxm ou1ap n fctlt)artr( o;u0alx mf3iatlmDumnmo;u0trxoxr iatlatr u i;()trxmxmpno1ome lncta(fartru  ;u4aeeo iciasfa elnvp () eenmf3todfpDeln s;( srtm(o oo4llee ncs ( srtru ont0texo fetydfm uln ont)alxrirctodfpDe ueo s  2to(r3nodame lncslsf 2raxmont0tpxnmf3tasfm2ea( o () renxo3oa1laDrai i () exoxr ou1alt  neiltf rtax oou0ale moctydfmDran s t4arerio todom rlivo;s) 2uo(o no4lptemiet t aDtr(m oo1alen fctytfs2ea(msnt4tlxrio3oytfpte u s;s0 rtoir3oy4lm elnesls) Dum(r oo4aeeoio3ilsfaDua( o ()arxrxo iotfmD lies s0 2trio ny1al e fctatfaDurum nt0opt iicilslm2rlnmo u4aetnmf iytlm elieo s0srurxrpoydlmtnlncsls) rumurpoo0oeeoiociat mDua(vs;t0 etoio3tytlm   nei;s teuoxmpiu1omenlfvsasfa2tr(ro;t1aetnmf3tyd m2rlnvo;u0 renxrctotfpD  nvolt0 rtr(rpiy1lmeemiviat)s2umxmoot1olxn ietytfm2umnvonu) eenmocto1la   nes (0srxm(r3no1omee nvil()srrrxmo;u1aeeomi3iltfs uan p t) rxrxr totom eluei t seumirpny4olee fvtat s2taumpnt0olx  oetytfa2ra( o;t4tetomrctydfa ean s;(0s2tmio iu4ameelfvil()sDuaur ot1oeen icias s umnmp;t0tetrxrcio1la  aivil()s2xmxm iodll nmfcsl(fs2rr(ront0tet mocilslsDulu s u0treomo iadlmDeai s;s tetr(r3ou4lp elfcs t)aruaum nt1opeoiictytlm rmnvs (0aeerxr3oytopDeauvo s0 rxr(r nodopenlneiat)sDurxro;u1tpen oeiadfsDua( p ()trerxo iadfpDran ols tetrirpou1optnlici tf Duaump;t1tpeniocilsfmDelnvo (4arenxf tatopteai s;( texmir nydole lictas)artrx pou1olen ictlsfa rl(mpnu4arxrmf3ootfpDelivs;t)setrim3oy1llenmnci tfartm( p;u4alt  ieiad sDemu p;u)aetoifciatoa rai ils s2umim iu4lltnlfeilt)s2ra(m ;o1apeomfeiad m ua( o u0trtrxf iadoptrlieil( texmxm3ny4ll e feiatfaDum(root4texomi3iadlsDrmump t4alermo3iydom rluvi s0s2tmxo oo1amen ncs () Drr(ro;u4oee  feiytla emnvpnt4 rxnmocoa1fa  au s;t0 2xmxm3no4lmte nciat  Draxm no1open fcilsls2rmnmpn(0texnxf3iatop e uvs t tetm(rpnodlp e fviat) 2rauroot1tle  oetls a el(mo;u)tleomo3io1opDe uvsls0s2to(o io4oltnlfei ( s2trumo;o4tltn oetld a ra(vs t4trtomrcia1fpte n o s) 2uoxopnu4lme  netatfsDuau  ;o1tpeomociadfm umnvpnu0arenxf3tadopDraivils0setm(opno4opte fvsatfsDururpno1texomoctad m2eluvs t0 lenmr tadlmDe ieol() exrio iu1ll emiesas a2uaumpnu4ope  f3iatls2emump;()aetnxoctotlat au o;s setrir3oy1amtemfviatfaDtr(m no1aexn fcildfs rm( pnt) rxrxfcoydlm e u o ( sexrim3oy1llte nvtls)sDur(mp;t0ale  o3iatfs2emnms;(4alerio ta1opDeauvils)t2tm(o nydlmtelfvta(  rrr(rpot4teeoio3ilsfm uaumo;t4 ltnxr iytfa e n o s teurirpou1alenlicsl(f 2tr( o;u0alto i3iad a2rmu o;(4trerirciotlmt an i s0truoxm oo1apte neil(fsDuaxroou1oetn octyt m raump;u4alxniocoatfa eaivs;s) etrio3iu4ale  nvs s arrmumont1aetnii3iasfmDulumsnu0 lerir iodlaD  ueo;(0srxmimpio4ol eliciasfartax  oo4aeen f3ias aDemuvp;u)alerxrctydlpDe n olt0t2urir oo1lptnlfei sf rtax onu1tlt mf3iasfaDuanvonu0trtomf3oydom eauvsls) rumimpny1lptnmivtls)a2tmxrooo0oee  oeiat s ulnvo u0trxomo3io1lm elivsl(0 rumxmpio4ap elfvtlt s2ur(r oo0optnmiciytlm2eanmon(0aexnmf3ootlatr u sls  euoimpio4omenlfvtasfaDumuroot1alto feilsfm2rl(mp;u) exrmocoadom e ivil(  2tm(m oy1alt lfci s sDurx  oo0tptn f3iys s um(mpnt4tlxoioctotoatelnvol() rumim oydome lneia()sDra(r ou1tle  oeildlm uan pn(0aexoiocoodfm r ivi;t)trtoxopoodoptn nvsat)aDuru pnu1tpeomociadlmDemuvp;(4 ltomociodfptr uesl() 2xo(opnu1ol nlfvs (fs2rmumpnu4optn o3iysls2rau s (0teeoxociatfpD  neo s  exmirpno4lp elnetls  2uaumont4oetnmocilsfm ra(vp;t)arxoxrcio1faDraiesls t2uoxm nu1lleemies tf 2rrxro;t1tpe moeiysfs eluvpn(0 etoio3iadomDr nvo;t) eurxopoy1lmenlnctasf rum(mp;t4alto i3tydls2um(ms u0 leoxfctadoat lneil( setoxrpoydomt lncsat s2tru ont1apto i3ildla elumo () exniociotlaDeaiesls0seuoir oodop emivia() Dta(  no4aetnioeiatlm2uanmo;t)tetomo oy1oaDelu ils0 rxrirpio4lpe lncs s)srum(moot1olxo f3ildla2umn p (0 eeomo totlaDeau s s)t2trxm3oodaltemnvsatf rrmu ooo4aptomoctyt aDrmn p;u4tlxoxr ia1lp  anvil( trxr(rpoy1alte fcsasfa2ua(r nu4tee ioctls mDrmuvo (0trtrif oydlpDelieo s s2to(o3nydaptelfcs (fartaump;o4alt  o3iatfa2rlnvpnu) etrmf io1fa  ai i;s sexoimpou4ome mnesasfaDtmxm nu0oleomictlslm2rln sn(0 eeomr tytomteluvilt0 rumirpiy1lpe mfci s)s2tm(r nt0aetoio3iydls emu p;t)arxomr iy1fm rlu sls0sexoxmpiy4amt lics tfsrrr(rpou0apxoiicild aDemu o u4aeeoxf oadom  luvi;s) rumirpny1ameemiviat)srrmx pno0oeto icias a2um( pnu0tlxnxr iytoa  an sl()srumxm3nydlle  ict s srumx p;t0tee mo3iad a emn o;t4trxoxf iytfat lues;s)truo(r3iudam   ivt tfs2raur ot0oetoio3iyt s2rlnvs;t4altnif oadfmDraies ( t2umxm iy1oltnlnvia(fsDum( ooo4oex  ocildfa2emn s t0 etomfctatom eauvo;s) exm(m3oydlle lncsls arumx ooo1alxnii3iad mDem( pnu0 eerxrcoy1lpD ln slt0trxoxo oydlpen fci (  2rrxr ou1opeomocias mDrluvp;() lxoxf3iy1fmt an o s0sruoxo3no1lltemnvilt s2tmx  oo1tlxnioeiad a ua(mp t0alxrxo3oydoaDe i ilt)texrxr nodale lnvsas aDumxmpnt1tpxo ocilt m eluvs;t) leoxfctatlpteln ils srxoxo3nudlp   nesa( sDraum no1tee mf3ilt mDumnmpnt)trxnmf3iotfpte ivol()trto(m3oodameemfesat)sDumx ooo4tlenmi3ildfm2raumpnu)tltoif tydopt  ueo s0trxmxo3iu1lpte nct sfsrta(mp;u1aeeoiicild sDea( pn(4 lenir3tatoat  nvo (0texrxmpiudaptnlnes s aDurxm ot0ole mfcild sDum(mp (4tlxnir3tydlp  ln s s trtr(r oy4oltnmictl(faDrmx  ot4aexomoeiadlm uanmo t)teenmf3iatfmDeau ol(0 2xr(r3oy4ap e ncsl()aDraxmp;o1tle  iciadfmDulnvp ()texnmfctotoaD  n il(0 2tmiopou4lpen fctasfarumu  ot1tex  fciasfs2rluvs ()texomr3ty1omt anei ( texm(m oy4op elict s  Duax oot1texnmi3ilsfa2rlnvp;(4 renmrcoo1fptean sls)s2tmim3oy1ll e feils sDrr(rpnt1oexnmoeils m rl(mp;u0aetrmf3oadoa rlivi;t0t2urxrpoodlpeemicsl()sDtr(mono0oexo oetadfmDra( pnu4aeermo3ia1la elneo;s0 2xr(rpiydapee ncia()aDtmu  ot1apxn ociytfsDemn p t4aetrmrcoadfmt an ol() etrir3oo4ol e nci ()aDrau ooo1alx iiciytla ea(mon()texrmo3oodlm   nei;t0trurir3oy1apte ivil()srra(rpou1aet ifeiatfm2ua(vs u0trtnmr oy1la eaieilt trum(opny1lp   ieta(fsDrru p;o4alxo ieiatfa umnmo;t4alxnio3oadfmDrli i;s) 2umxo3io4ol  lnct tf Dta( oou0aetnmictadfa umnvp t0aexoxfcoodlmte i o;( truoio iu1ape  ici s)s2ua( ooo1olxomietyd a2rl(mp;t4 rxoxr3oydlpte nes s0s2trimpny1aptnlivtls  Dtmxmono0olx  i3tlsfm2rl(ms;t4artnxfcoadfat lnvo s0setm(o3no1lpt  neilt aDtr(  nt4texoii3tlsls eluvpn(0tlxnir iodfm eauesl(0trxr(rpno1am   fctls)srur(rpnu0olx io3iydlm2rlnvsnu4tetoifciodfpt anvi;s  rtrim3ou1ll e ivs sfa2taxrpno0ole  o3tldfa2eln pn(0alermr iy1latrauei;t t2urim oo4am n ivi t)sDrax o;u4optoioetlslm eanmp;t0 eeoif tadlm eaivi s) rtrxm3iydopenlieta( artrxr nt0alxomictyd m elnvpnu) reomrcty1fmD lueils0srtmxr ny1lptnlnviat sDtau p;o1alxo ictydfsDel(vonu)aetnmo3oydoaD  uesl() rur(m3ou4lp elncilsfsrrmxmooo1tleo fciydfa rlnvp;t0 rtrirciodlpDelnvi;()tetoim3nydoptnlfcsl(  2tr(r nu4tle ifctls sDrm(von(0artnmr iatlateanvo;(0trum(r3iydolen nvilt  Dtm(mpnu0altoio3tydfs2rl(vp;t)altrxo3iytlp  auvsls)srxo(r3iu4llenmneiat srtrxmo;u1tlxnmfciydfmDuluvp;(0trtnxo tytfmDe neols  rur(r ou4omeelnvsas)srtr(r ;t4tlxo fcias m2rm(ms;u) leomocoadoatr u ols)teurxm iy4lltemieta( s2uru  nu1olenif3tas m eau sn(0aetrxo3oodomte i s;()teuoxopiy1openlncs (fs2rmx ont1tpe mfctasfmDemnmpnt4tlxnmr3oydfpDeluvs t)s2to(o no4lmenliciltfsrurumonu1oltnmf3iysfaDra( p t4alxomo iytomtelivol() 2trim oydopt mneta() rtmx  ;u1optnmietyslm ranmo;(0 rxnirciodomDeau i;t trxoir iudoltemnet tfs2tmump;t0ole mfcildfsDeaumpnu4tetomrcoatlaD ln i;t0srtoxm nydal elics ( sDur(m oo1apxn ociysfa2rmu s u4tltnmrcootlmteau s t0seuo(m3ny4lpe mfesasfsrtrx pno1open f3tydlsDemnvo (0 rxrxo ta1omtraues;t0tetoxo3iodll  licsa(fs2ta( p;u1teeoiociys mDrm( p (0trenmr oo1fptr u i t setoiopou1amen ivsl()arum( oot1texnioctadlaDel(vp;(0 exnxrctatfm r ieo s  eur(mpoo4lm nmfes tfartrxm ;t4aptnmociasfmDrluvp;(0 ltnmo3iadoatr i slt0 2umxo no1amtn ict tfaDtru p;o4optomf3ildfa em(msnu0 rtrif tydfp r ieo t0setmir no1alen ict tfarumx p;u0apxnioetadfs ul(vo u4arxnxo3io1lp  au o ( trxoio no4am  lncs t  2ua(ronu0oltnmoetls a um(vonu0arermocoadoaDrlu o;t0 rtmxr ou4omtn fctlsfsDurxr ;o4apto ieildfsDumumont0 etoiociydfm r iei;()s2umxr3ou4opeeliet ()srrrx pot1oleomfctydlm rmn on(0 reomoctydlm   ivo (0teurxo nydaltemfvt tf rum(  no1tleo i3iatla2rmnvo;(0 lermo3iy1lpteaivi (0 2xr(o3nu4apt lncs sfarua(m nt0texoiocildlaDrln o t4aexrxrciodlp e nvo s seuo(rpnu1amenmfeia(f rumur nt1oeenmicild m umnvo;t)texrxfcoadfptranes t)sexoir iy1ap  lfetasfarraurpoo1tpe iictasla um(mont0aexrxoctotlp rlivsl(0teur(o oodap  lnvsa(  2taurono0opxoiociat s eauvsnu4 eenxfciytla eanvs;t0 eumio3io1op elfci t s2rmx  nt1tlen i3iydlmDum( p;() ltoxoctydfmt auvslt  etoxrpiodom e icsl()s2rr( o;o1alxnmfeiad s2rmnmsn()arxniocoa1opD  n sl(0 etm(opiy4omeelnetl()a2umx ooo1aex mo3tyd aDumnms u)arenxociy1lm rlivi (0srtmxo nydllen fes t)s2ra(m ;t4tlt  o3tysls ua(vp;(4 exrmf oytlaDraiesl(  rtmxo3iu4oltemnet s  2tmxmpno4oetnmo3iyt sDuln ont)tlenxf ta1lpt luei s) rtoir nodale licslsf Dum( o;o1altnifctltfmDulnvs;t4trtnio oytoa elnvo;( trumir3oydlmeemfeilt sDraxmo;u4tleomfctadls2rl( pnu0 eerir oy1lpDelu i;(0srtm(m io4ap e fvs s a2uax onu1apt moeiadls uanmp;(0tltnxocoydop r n o (0 exmim oy4ap  livi (fa2ur( o;u4ale ifetad mDuluvonu)arxrmociydlm  anes;s)sexmxm3iy4lm nlnci ()artr(moou4apx  feildlmDemu snt4alxnmoctotfp e i sl(  rto(rpoo1olee nvtlsfsDtrxm nu0olt  i3tldfa2ulnms;()trxniociy1faDrauei t0t2xm(m3iu4amt  fcs ()sDtru o;o0tpen ieiatfa2ul(vs t4 etoir ty1om ranvo;()t2trxr3oy1lptelfvsat)aDtm(m ou4oee io3iasfa em(ms;(4 eeoif3tytlpD ln i ( t2xr(mpio4llenlicsls srraurpno4aex mi3tatfs2ean s;t4 rxoio iodoa  auvo;s t2tm(opoudlpeelnvsa(  Dtr(mp;t0tlxoioetytls2em(vs u0arermr iy1oa   n s;t)srtoirpio1omenlivt (f rurxrpnt0tlen feiyt m2rmnmsnt)trxnxociydop rauesl( t2ur(o ou4ameemivt t)sDumxrpoo1teeoifeiltls2ul( s t4alxrir io1lateauvsls) rumio3ny4lm emncsas) rtm(moot4olx mociasfsDrlumon() ltnmr3tydlatr nvi t s2uo(mpoy4ame mivtat) rtrxrono4aexnmo3ilt s em(monu)aeenioctydlpDr uvi;s)teuo(rpoo1lm  lfcs t) rtm(mono1tlt  ieiatlm eau s () ltrif io1lmDrai i t) exmxm3ny1al emnesa(faDua(roou0optnmiciyslsDrm( p () lxnioctodfpDrln o (0s2tmio3ny4opt mnetl(f 2raum ;u4texnii3tys a rmump;t0aetoxfctatfpDe uei;t0 2uoxm3nudal emncsl(f rumxm nu1tpt mfctldls2umu pnu4texnxo3tydlatr ivi t0 eumxmpou1lltemnciat)srtr( o;t0openmo3tadfs umuvo;t0altrmfciadla  lueo;t t2toiopiu1omte fvsasfs2urx  ;o0oexn ocildfa2ea(vpnt4tlermo3oodlmD  nvi;s trum(m3ou4ale  fviatfarrmxmpou0altoiocildlm ra(vpnu4tltrxf3io1lpDe i o;(0texmxr oo1am nlivs t  Drm(monu4tpt ifeiys aDum( s (0 ltnmo3oo1opteai ols0trxoio oo4lm nmfes ()s2rr(m nu4tpeoif3ilt m eau p;t0 ltnmf3oydlp raiei s)s2toim3io4lm   iei t)aDrm( p;t1tlx iiciydla uaumo;u0 exomfcoodlmtrauvil( trxrxm ou1ll   feias)arta(mont4tpx ioeiysfm2uluvs;t)arxrmf3iatop eai s t  etm(o nudapte ivs t) rrrx pnt1oeeomictldfs2rl(von(4tltoio3oytomtrlnvsl(0 rtoxm ny4lmenlnviltfarrmu  nu4tee  ictlsfs raumo;t)arxrxociadoaDe n s;(0s2tmir3nu4aleemict (f 2ua( onu4alxn o3ias m ea( sn() ltrir3oatlp e nvs s srxoxrpiy4amenlictl(fa2taumpot0opeomictas s2ra(vpn(0teerxocoatfmtran o s0 eumxm3io4olt lnetl( srrrur ;t4olenio3tatfm2rmumpnt)artnmo3iodfaDrlnei t truoxrpou1ale lnci t)srraur ;u1tpenmfcilsla rmumpn(0tlenmocoy1fm   u s;s) 2umxrpiydlm n fvt s)sDuaum ;o4aeeoii3tysls2rmuvs;t0tltoif tydoatrlueo s0teumxm3iy1aleelfvils)arurxm no0tpeo oeiyt m2umnvp;t0aetnxfcoodfpDrli s;(  ruoxo3oo4lpen fesls) rrr(m ot4altnmo3iadlaDulnvont4 eenmr3iy1fm ran o;s0 exoir io1llte ivtas a2tmu pnu4oleomoeiad m2uanvo (4tlxrxf oydlmteli i s  2toxmpoudal elfes t a2tmump;t1altnmoctysfaDuanmon()alxrmr to1lmtr nvi () rum(rpoudapt lfcsas)a2raumpnu1aptn ieias s umnms (0teerxf iy1opDeluvs;() 2xoio3no1al nmfes sf rtmxm ;t1aleoiictytlmDuan snt) ltomrciadoaD  uvi t)t2xrio oo4apeelncs sfaDraxmp;t1tptn feiadlaDulumont)arxomr3tytfa ean s t) 2toxr nu4ome  ieslt) rraxmp;u1tlen oeiasfm umu onu4 eerifctodoaDe nesls0 etrio oo4lmt lfetl(f 2rru  oo0tlxn o3iltfm2rl(mont4aexrif3todla  lnvols  2xo(opoudaptnmfct s)srrrxro;t0oltn o3tlsfm rmumsn() lenio3iadlm raivols) rtr(opio4lmeelietat s2um(r ;o1tpenmi3ilt sDrm(ms;(4aexoio3oydfatr ieols0 rxm(rpiy1ole lfvi () rumxrp;o4tee ii3tydlaDeau p;t4arxrmociotlp  aueslt trxmxopoy1amenmfetls  2umurp;t4aee ii3ilslmDea( snt0alxrmoctotlaD aneslt  2toir iy4lpe  icslt)a2ua(rp;o4oleoiietyd sDuanms;u0altnmfcio1fa  anvs;(0truo(opio4ale  ietat srumxrpot0tptn f3iadfs2elums;t4trxrif tadlmDelieo s  2xoir iydap emicsl(f 2umu  ;u4apeo ieild a2emuvs;u4 rxoio3oa1fpD aueo t setoxr nu1lme mictl()s2ua(m ;t4ope  o3tatlm raump u4tetoio iatfpD anvo (0 2tmxo io1lmenmfes tf 2trx pno1olxo i3tytlm em( o t4teeomr3io1fpDrlneol( srtmirpnudam nmneilt)sDtmu  nu1tpx  ieiad m2rm( p;u)tlenxocoa1omtraivils seuoxm ny4amtnmies s) 2tmuronu4tlxoifetatlaDua( o u0artomf oytla  an il()srumxrpoo1aptnlnet s)s2uaxroou4olxn i3tadlsDrl(vo u4aetnxf3oo1lm eaneslt t2trxo oydalte nviasf 2ururono1tpeomi3tltlm em( s t)tltomf3iadop raueo s) rur(r oy4omtnlnvtatfsDur(mono4apenif3ias a2el(vp u0areomrcoytlat luvi;s  2xoxo iydal   icsas)arrrx onu4alx mietad s ulu ont)texnif3oydlat  nes t0sexm(r3oydameelfeslsfartru ooo0tlxomf3ildla uln p;t4altrir oytfpDeaies ()s2tmio oydapenlictas  Dtmu  ;u4tetomoeiltls2rauvsnt0 eenxf3tytlaDeluvolt t2um(mpnudom emfvi s aDua(  nt0tlen o3iat aDuanvpnu0aeenxo ia1la e nvsl( seuoir3iodapt livi t  2urx  nt1altniietydfa2umuvo u4altrmf tadomte i i t)srtoirpnu1ll  lict tfaDrm(ro;o4aeen i3iytfs emu sn(4teenxociotla e ieilt0setoimpno4ale livsasfaDtrxr ou0oltnmiciyslsDea(vpn(4 rtrmo3io1omt lnvi t0 rxr(opou4lptemicil(faruaxrooo4tlxnmoctysla ul( sn()tlxomr3iatomDrlneo ()trtmxm iudopeelnet sfa2trx  ;u0tptnmi3ils sDra( s;u)teenxfcoadfm  an i;s)t2xrxmpoy1llte ivtls aDur( p;u1alenif3iadfm uanmp;(0texrxfctadopDr nei ( truo(r ny1lpenmictl()srrr(  ot0tpx iietat sDeln pnu0trxnxr totlaDeanvs;t)srtr(m3io1omt  ietlt a2ur(roou4opeo f3iatfm2rlu pnt0tltoxrcoo1omD  i i ()teurio oo1ll elivi ()arrmu p;t1teeoifciyd m2ean snu4 rxnif3io1om rlnesl() eurxopno1ape  fvt s) Dtrxrp;t1apeoiociydlaDrm(msnu) exrmfcto1faDeanes s0trtrxo iy4lm nmfesl( a2tmu  ;o4altnio3tlsfa2rlnvsnt0aetomrcoodfptelnvils  eurxopnydolenmnvs tfsruau ont0tetomfctls s ulump t0teerxo3ootlpt  n ol()srxmxo iudalte nvilt)a2raum nt4olt  oeiyslm uanms;u0tltrifciotfpDrau sl(0 rurxo3iodlmeelivsat sDur(  nt4tlt  i3tadfa uauvs (4trtnir tytoa rliei;( truo(o3oo4om n net s s2urx o;t4alx ioeildla rm(mp u4 lxnxociadopDeauvo;( texoxm no4ap e ncta(f rtrur ou4alxnmoeildlm emnvo;t4tltrioctodfpDraieslt) 2urim oo1ol nmfcil( aruru  ou0apx iieiadlaDuau on(4 exoiociytfmtrau s s sexrim3ny4opt mfct sfsrraur nt1ole ifciadlsDrmump;()aetnxfcoodfpDrlu sl(0 euoxo oudom nmnei sfarumumpou4teeo fcilslm2rln o ()areomocoy1fpt anvs t0setoir3nu4ameemnei ( a2tmu  nu4oeenmfetatfaDrl( o;u4aleoir3oydoat aivslt  rxr(m iu1apeelnetas srrr(m nt1oltn fciydlm2umnvsnt4 etniociydom eau o s)sruoir iydam e iesas  rtm(rpou4olt  ietlslm ul(ms ()aexnirctatlaDelies;s0 2tmiopnudll emivi s)srrm(rpou0aetnifctysfs2umnms u) exoir3ia1la  luvsls0s2xm(o3nu1lpeelfvs t)artmum nt4tetnmieilslmDem( s;(0 lxrif3tytopDeaueilt)trxrio iy4omt  ivtat)srrau oot0teenioeiytfs ul( o;u0aetoioctadlmDean o;() etr(mpiy1alt  ivsasfarrrxrp;t4tlxomoeildfaDrlnvsn(4 eeoio ootoa  lnvs;t)srtr(mpno4llte fctltf rraurooo4ole iictltls2rl(vs;u0tltrxf3io1la e ieo s0s2umxr iydoleelnvsl(f 2rr(  nu0tlxoifetyt sDrlumpnu)tleoio oa1fmDrli o s trtrxopnu4llenmfetltfs2taxmpnt1aeenmi3tadfsDrau onu)aetoxocoa1oa raieilt)seurxopny4omt  ncias) 2ua(  oo0ape  i3tld aDuanmo;u)texomo3iy1faDe neo;( t2xm(rpoo1lm emivslt s2uax  no1texomo3iltls umu p u) lerif oadlmDelieolt)s2tmimpny1amte ncias) Dtr( p;u4oeeoiictldla rlnvo;(4 ltnmf3tadfp elues;s0 2to(m3ou4lme mivia(fs2raxr nu1alxomieiadlsDrmnmp;u4artrxocta1oa   i o;() euoxo3oudolee feta(fsDumurooo1apxnmf3iysfa2umuvs (4 rtnmo tydopt lieils s2tm(r3io4lmeemnvs tf 2rr(r ;t4tpe moetas sDem(mo u0aeeoio tatom   ueo t0s2xoio io4llenlieta()s2ur(  nu4oet mf3tld s2uau snt0tetrxr3ia1omtrlivils0teurim oydamt mncta(fsrtm( poo1openii3iysfaDeln s;u4texoxrciytlmteln s (0t2trxo no1apeemiciatfsDurur oo4tex mi3iad a umuvs;u0tlxomr3iydfmD  ivi t)t2xoxo3ny4aptnmivtasf 2rax p;u0oexomictld m2el( s;t4 leriocta1fa eli sls teumxr3oo1lm  livtlt a2rr(r oo4tptoifctldfsDrmuvo;t)tlenmf oodlm elnesl(0sruo(m oo4om n fcil( s2rmum no1tlenmfeiyt aDumnvsnu4trxrif3to1lm elueolt0 2uriopoo1al  mnvi ( a2trumpnu1opxo fcias s ua(vo u)arxnxrcto1fmt  ivils) 2uo(o3oodll n ictl(f Dtru pnt4alxnmoctyd m rauvsnu0 ltrxf3tytoa  lueol(0 exmimpio1opt  fvsa(f 2tr(r no0apx iiciydls em(mp;u0tltoxr3tydfaDr uvo;() eto(o no1ap n ncias  rtm(r no1olt  ictysls2umu s t0 rtnio3to1oatelueils  rtrxr3oo1op emnet s)sDum(rp;t1tlt  fetydls2ea( pn(0trxrxocoo1opD  uvo;t seum(m iudal  lics (  rrmxm ;o4olxnmfciat a2emnmo;()alxrxo3oatfaDrlu o t)seumim nudoptn ictlsfsrraurp;o1ole  ictld mDra(ms;t4 lerxrcoytla   ieo (0 rxmim3oo1open fvils)a2uaxro;o0alx miciatla rlu p u4 rtoxo ty1lpDrluvs s) 2tr(o3iudape  fci sfaruru ont1oltomo3ilslaDrl(vsn(0arxoxocoodoatranes;() 2um(r iudam n net sfsrtmxm ;u0tpeomiciasls rmn o t)artnif3iotoat lu il(0 euoim nu1lpeemneia(  Dtm( o;u1opxomiciysfs rm(vpn(4 rtnmr3todlpte nvs t0 2urxr3oydopee ncilsfs2rrum ;u0aex  icilslm2elumsnt4tetnio3oy1fmDr n i s) rtm(r nodlp nlnvt tfa2uaur no4tpxomo3tld aDrl(mp t)aleoxr oa1latrln s s  exmir3io4om   ies t aDrrur nt4apeo fetysfs2rmn o;(4 eeoio oa1latrli sl( srxoxr nudame  fvt ( arumurono0opeomi3ilsla2ulump u4alxoif3iodfaDr uv
\ No newline at end of file
@@ -0,0 +1 @@
+i sls0trtr(o3oodll   ivtl( s2ua( p;u0apxn fciasfa2rauvo u0arxniocto1fmtr neo;(0srtr(opoudomtelnvia() Draxrpoo4oeeo octysfs2uln p t)trtrif3ia1lp eliesls s2uoxmpiu4al emnei (f Dumx  no0tex ioeildfs2emump;()aexrxr tadfa   uvi;s0 rxmio oy1ap emfes t) rra(mp;u4tee  oeiytfaDrau snu4trxrmf io1fa r i i;( texo(mpiudom emfvias s2rrx  oo1aex miciydlm2uaumo t4trenxf3to1fmte nvsls)seur(r3nodlmt  ncsa( s2tmx ooo0olx iociyslm umn o t0artnxfcty1lpDrau il(0seumim3oodopt mfes sf Dtrxmono4altnif3tldls2rlums u0 ltrmr3iatfaDr ivi ()t2tmirpio1am  miesl(f Dtr(mp;o0tpt moeiytlsDuln p;t)teenmfcoodlpDran o;t)srtoxopoo1lmt  fvslsfsrtmu onu1oex mfcilsfsDemuvsnt4 lxoxf oy1lp r n sls setmxopnu1lmtnmnviltfs2umx  no1opeoio3iys sDrluvp ()tltnmo iadfp r iei () 2xr(rpoudll e feta()aDrmurono1olen f3ias mDrmuvo () rxrmo3to1oateauvo;() rxmirpou4ope  iesas srrm(moot1olenmf3tltfm umnvp t0tltnmo todopDeaies;t t2to(m3no1lm n ncsl( a2urxmoot1opxnmicias aDrmuvp (4trxrircoy1lp eauvs s)s2tmxo3oo4apt  fvs (fa2uau ono4ale  iciasla ea(mpn()alerio ty1lp r ues;(0 etmimpoo1lm n nctas)a2ra(rpoo0oet  iciad sDemn s;t) exomo3oo1laD anvsls s2umxm3oydapeelfvt sfartru  oo0tltniieiys aDua(vs;(0 exrxociy1om   neslt0 etr(r io1lm nlivi (f 2rmumpoo1oetoifcilslm uanvonu4alenmr3totopDeanvs s sexrim3nodom n iesl(  rrm(  no1oleo o3tyt a rm( p;() lxnxo3oydoaD  ueils0t2uoxm3iudomen ncils)a2urxm ot0tpeo iciytfa2rm(ms (4arenxo3iy1lat  uvi () 2umim nu4aptnlfeia(f 2ua(rpou0aex ioetltfmDem(mp (4 rtrmo ootoaD auvi;t) rum(opoy4am  lnvi tf Draump;o4tetomi3ilsla2um(vo;t4 rxnxoctytfaDe uei;s t2uo(opiydapt  netat)s2urxmoou1oetn ieiys a emnvo;t) eerioctytfmt aueil(  2trxr oodlmtemnvi s  Duaumonu0aetomicias m2rmnmsnu4tleoxr3oadopDrauvo (0s2xrxm3oo4ll e net t) 2uaum ou1aptnii3tadla2ranvpnt0trxnxfcto1fpDe nvsl( trtoim oy1llenlnet tf Draumooo1alx ifciytfm2em(vo;u4tltoxr3iodoaDr u i;s0srxmxo oydlpeemivsat)sDua(r oo4tlt  f3iys aDrlnmp;u0arerio3ia1lp  an i;t) exr(o iy1lpeemnct sfa2ra(mpnu0teeoifciydlsDul( s;(0tlxrmo todlp e uvsls0teur(mpoodaltelivtlt)sDrmxmo;o4opxnioeiasfm2ulnms u4 eeoifctotla r ieo s) rxrimpnudllenmict (faDumxr nu1tleo o3iys a2eaums;t) rtnmfciadfpDr n i;(0 2xm(opnu1om e ieia(fa2rmuro;u1tex io3iasla2el(vsn()aeenmf oatoa   nes t texo(opoy4ap n fvil( a2urxrp;o4oeeoifeiyt s2rln o;t0 etoxf3oodlpte u sls0seumxm iydope livta( arrrxrp;o4tet if3ildfm ra( s;(0arxrif3ia1lp  aivo s srurxr oydomt mictas)aDtmumpoo4oee iietysfm rauvsn() lxnmf3todla r u o ( seuo(r oo4om  lnviasfsrurxront0tetnif3tldfm2emnvsn() exomo oytlptranesls  2tm(m ou4ap nmictl()aDtr(moot0aetn ieiaslmDrlums;t0tlenxf3tydfp ean ils0t2xm(mpnudlpenliet sfa2umumo;u4aet  iciyd a2rlnvpnu)tetrif todomD lu ils)setoxm nydam   feiasfaDtaum nt1oetnmoctas sDrau p (4 rxrirctotoptrlivi ( trumirpiudopt  ietatfs2umxrpnu1ole moetldfsDranvs;(0 lxrmrcoy1fptraiei (0srxrio nudaltn fesa() Draxr ou4alxo feilsfs emnmo;()areomr3iatoptelu olt0srtoir ny4opeemfct ( srurumpot4tleo fciys a rmn snt0 eenxr ty1oa  lieilt0 2trxm nu1openmneslt) Drrum ot0alxomoeiatlsDel(vs u0aexnir oo1om rlueilt)t2tmio no1lltnmfesl() rurx  ;t4tpen f3tltfsDuanmpnt)tltnxr todlatrlieils  eto(m3nu1ape  ics ()a2umumo;u1alto feiadla2eau s u0trxnxf oatlmtr uei;()s2xmirpnu1llt  iei ()aruax onu1oeeniociysfmDem(mpnu4tetoxo totomt ln ols trxoxrpny1lpt lfvt t)sDtrumpno4texo i3iltlm eauvpn()aeenio3iodlm rln s t truoxr3io1amtemnci s sDtrur nu1tpeo oetasfa ulu s t0 etoifciadoaDeli ols setoxmpio1ape mieta( aDtaxmp;t0ope iieiys sDelnmp (0aeeomr iatoat lnvi;( trtoim iu1apt mfvsls)s2umur ;u0oltnmfeiytlm rl( snu) lxrxo ia1laDe u il( teumirpno1olt lfci ()srurxm ;t0texniiciytfa2ua(vs t4 leomfctydfaDr n o;s  rurxm3nudom nlietlt)aDrr(m no4oltn fctldla uau snu0altomf3iydla elieo;(0texr(mpnodop nmfci s)s2uaxrooo0texn ieiys aDua( sn()artnir iy1fmte i s;(0 eumimpiu1amtnlfvsas) 2ra( oot0aleomo3ildls rau pnu4 lxnmr3tadfmD ln s s texoio3nodlme  nci t  Drmxrono0alen f3iatlm2rau p u4tlxnxf tadlp eln il(  2uo(r iy1ll e ncil() 2rrurp;t1ope io3iaslaDem(mo;t0trxrif ootopDrluvs s)trtmxopoy1lmeemnct (  Duru  ;o1oetnmo3iatfa2eauvsnt) etrif3tydlatrlu o t  exr(r3ny1opt livsas) 2ra(mo;o1opeomf3tyslm2em(ms;t4 ltoir3ootfptean s (0 2tm(r oy4ol  lfvil() 2ua(  oo1aeeoif3tysls2el( pn(0 eeomrctotlpDeaues t  exoxm3nodalte ics s arumx  ou1tpt  ociltls ul( p;t)tlermrciytlptraneo () rtoxo nu1ll  lnvi s)a2rrumont1tpen icilslmDraump t0arxnio3oodlm e nvs;t srxrimpoydale lnci s  Duau o;t1tetn f3ildls um(vsn(0aeenxf tytom rlu s t seum(mpnudoptemfvilsfsDrrxrp;u0openiieilslmDumu s (4alenxf3tadfat lnvilt) eumimpiu1omen iesltf ruaxmpoo0tlto oeiatfs2eau p u)artoxfciy1oa rlivo t)s2xoimpnu4ape  feil(  Dtax pnt1tptoiocilt m2ua(vpnt0 exoxf iodfmDelieo s0teurxr ny4amenmfvtlsfartaumooo0teeoiiciatls2eau sn(0 rtrxo todlatr u i;t) exo(r3oy1omenlnvtas  Dumu p;t4tpx ioeildla2em( p;t)tltnifcoa1oa ran ilt)srxoir iodomt lncsa( aDuaxr ou1tlxoifcias a rmu s;u4alxnioctadfpt  nes;s sexoxopiu4apeelfvs s) Drru  ;o4tle mf3taslmDuanvo t4arermo totoptr n i;s0 2xm(r iudaltnlfes s)s2rm(mp;o0oexo i3iydls el( on(0altomfciadfmt lieo (0t2umxopnydop n fvils  rrr( oot4oetoiicild s eaumon(4arxnir3ty1om  lneols0setr(m3no4altemneiatf 2trum ou4ole iocias mDuanmo;u4aeermr3tatlptrlivil(0t2uoxmpoy1lmt  fvtas  2uaxmpno0aptn i3tytfs2raump;u4artrmrcootfat  i i;s) 2umxo oy1lm  lfeiatfartr(  ou0aet  iciltlaDrm( o ()texrif to1lmD  i s;t0 2trio iy4lpt  neta()sDta(rpoo4tpe mo3iytfmDeanms;t4aeerir3oa1fpt li i s0 eurir3io4lptelnesl( s2rax ooo1alenifeiadfm2em(mo t4 lxrmrctadfmtr i o;t0 2tr(o ny4amenlfetasfarrmxm ot1apto feiat mDrau snt0artoxr3tatlpteauvil(0t2tm(o3io1op   ncilsfs2uax  no0tpe  f3iyt s rm(vo;u)arerifcoytfp e uvs;t t2urio ny4apeemfcsl(fa2umurpno0tptoiociaslaDrm(vp (4tlermoctytfmtrlu s;s0 exoim ou4ap e netasf rta( o;o0tleoiietad sDran pnt0 rxnmociatlptrli o ( sexo(opiu4al elnvt (fa2ua(roou4alt  fetatfsDea(vs u4areoxr3tytfp elueo;t)s2ur(opoy4lpt livsa(fsDtaxrpou1olxn iciadla2rauvp u)tlxnxrcoatfm elieo t)srtoxmpiy1ole lfct tfaDuau  ;t1tex mociytlmDeauvo;t4 exoir3tatomDelnvol(0sexr(r oo4amen fes t arur(rp;t0opxnmf3iasfmDuluvp;u) eerif3iotlptr u i;s t2uoir3oudam   fvsl()s2urur oo1oet ifeiyd m ulu s;(4altrxfctotfa eau s;( srxoxmpnudll  lnvsas) Draum nu1oeto f3iadla ea(vp;(0alxnif3iytfpteai s t)t2ur(r iu4olenmfcsa() rua(rpot1tlxnifeiadfaDrmnvpn() exnmf3totoa e ueilt) rumxmpiodlmtemietl()aDua(mp;t1apxo iciys m ea( snu)alerxo3iodfp eln ilt  eumiopio4ape lieiat srrrum no1tpeniieilsfs rlumo;t)altrif oydlm   ieo t0teuoxrpoudop nlfeils srra(ront0opt moeildlm2ean s;u4 rtrxo iadopD lnvo;t) rtrxm3nu4opee iviat)aDrm(  nt4oee mieiaslaDuauvsnu4 eeoxf3tadop rlivol()seumiopnudalte nciatf rtmxr nu0texo oetytfs rlumonu0 eenmo to1la  luvi (  2umxr iodol nlivt t s2trum no0tpx mf3iasls emnvpn(0 lerif oy1op rluvs t0 2tr(o oo1omee nviat) 2uaxmp;o1apxomoeildfm emuvp t)tltnmo tydlatelu s ( srtrxo3ou1om n fet t  Dta(m oo0opxn fcilt a2el(vo u0tlenxr3iatfmDeaieilt) 2tmir3nu1ameelicias) Dur( poo4apxnmoctytfm raumo t0 rtnio3todopteln s;t trxrir oy1ap nlfes sfarra( oou4alxn fciatlaDrau p;t0aexrmfcoatoa eanvi s)t2trio3nu1open ncs s)aDraurpnt4opxomoetydlm2rl( o;()alermrcootoatelu i;t t2xr(o3iodlpt  icta( srtm(m ;t0tltn i3ilsfa uau o (4 rtoio3tydlaDeli o;t0 2urxmpou4omtnmics t a2umu p;u1texomiciydfa ul( o;u)alxrxf3iy1opt li i;() rxoio3oy1lpt  ies s)s2rmx p;o1aptnmfciadfs eanmo () etrmfcoo1opteaneil(0 rurirpiy1lltelfei tf Dtr(rpoo1apeo iciltfs rluvp;t) eenmo iytfatr nvils0 etr(r3nodlp  lnvil(f 2ur(r ou4teto o3tasls rluvo;u0texoio todfat lies t)t2xrimpoo1ll  lfctat  rra(mp;t1tlen o3ildla2rl(mo;u0 lxnxfciatfp eanes s)trxr(opou1lpte ivi s) rur(ront4opxn i3ias mDulu sn(0altomr3iytfmt aivslt  2umir iydlptemiciasfarraxmooo4tpenmoctyslaDumums;u) ltnxr3oo1la   nes t  2ur(o3nu4om emfvils sDtmurpoo4aleniieiaslm2emnvpnu)arenxf3to1omt auei (  rto(mpiu1apte nvi (  2umum nu0tetomi3iytls ul(vo ()trtrifctytfpD liei;s0setoxm oy4olt lnetat) ruaumoou4apenif3iad m2ua(vo;t4treomrciy1omte n i;t texmir io1lpenlncta()srrmurpnu1tex ioeiasfm ul(vs;(0aeerif todfpDrli o;s0 2uoxr no4apte nci t) rur(mp;t4oleo ociyt mDelnvpn(4aexrio iy1latraivo;t  etr(o iu4apenlivt t aDtru  oo4ape iieiasfs emuvpn(4tetomr iatoa ranei s)t2xmxr iu4omtemnvsa() rumu oou0oet mfeiys mDua(ms;() ltoio oy1fpDeauvslt)srum(mpnodlm   nvsas)arrm(mont1aet ifciasls emnvon()tltriocoatla r n sls trxoxo3iy4apeelfes (fa2tmxm oo1apen feias a2uanvpn(0tetnmfcoatopD lneil() rxrir3oudomenmncia(faDumxmono4optn iciytfs2rmumsnu) eeoif3tytomtranei s  rtrimpoo1op elnvta() rrmxr oo0texniieiyd aDeln o (4teerif oo1opDran ol() 2xm(r iu1alt mfes tfaDtax pnu0aexomieiadlm2eln p (0 lenir oa1lmt  i s;s0s2xoxm iy1ope lnct tf Dta(m no4ope  octlsls2rm(mo u0artnmf3ia1optr neslt) 2umxr iodoptelnes tfaDraump;o4tltn oeiyd s ua(vs t)artoxo3oadoptraues;t srxo(mpio1ome mfetatfsDtrumooo4aexoifciatfs rl( snt4altnifciatfmDeluvs s texriopio4ap emivt t s2taxrpnt4oee mfetadfa2el(vs ()arxrmo tydopDraneslt  etoxo3no4lmt micilt) Duaxrpnu1tpenioctas aDrmuvo t)alxoir oo1oa r i ol(0 exo(m nodolt  ies (  rrrumo;t1opx  fctatfaDeau s u4altnmo3oatfp r iei;s  rtmim io4lp   icsas sDrau  ;o1opt iictysfa umu on()tlxrxr3iotlaDeaieo;s0trxrio oudlp emfvsa( a2trumo;t1opeo o3iltfmDemn snu0 eermr iy1lmDe n ils0srtr(r iudamtnlieiatfsDrmxrpot1apen ocils s2emn s;u) renmo tatfpDeluvolt0t2tmim3oo1al   ncsltfs2ur( p;t0aeto ieiytfs ul(mpn(4treoxf oydfatrlivol( truoxrpoy4apeelnvsat  Drmxm oo0oee ifetat aDelums;t0aeerxo oatoa r ueslt0t2ur(r3iodopen nvil( a2rrurpoo0tetnio3iytla eanmp;u) leomf tytfmDeli ols  rtoim oy1lltnlici () rtmxmo;u4tpen f3ils m2elu pnt0 etnmo3tydfat ai ol(0 rxm(m ny1ale  iesl(  2tm(monu1tee ioetldfm2rmu sn() exoxo3tadfaDe u sl(0 2to(rpiudlm nlicta( a2uax o;t4aet  ocildla rluvpnt4trtrxr oadlptr i i s)s2um(o3nu4lltemncias  rta(  ou1tetnifctlsfm2ul( s u4tetrmo oatoaD ai s;s  rtmxm no4apt lnet tfsDtrxroou1tpx ifctldfaDean pnu)aetoir oydfm   uvo;s0 2tm(r oydam nlfvsltfa2taxm oo0alto fctatlsDrmuvs t4areoxocia1opt  n o (0t2urimpou4ap nmfei s)arumuronu0oexnmoeildls2rmuvo t0 renifcoa1om ran s;t setm(r iu4al  lfetlt sDtrxmp;u4oeeo ociadfs emnmp (0 lxnxo3oa1op rluvo;t) etmxmpiudlpt lnvsltf rumump;u4aleo ociatlm2eanvo;(0tetnmrcoy1lmteanvo;(0 eumimpoy4altnmicils  Dtr(ro;u4aee  fciys a uluvp (4 ltrmo3oo1fa  lu i (0texoimpoodlpe lieil(f rumu  no1tle  feils m rl(vs;t4arxnir3oa1optrln o;s)srxo(rpno1oltemivta( s2urxr ;u1tltoioeiydfs2um(mpnt) reoir ia1oaDr uvil()srtr(o3nydlptnmfvta( a2tmu o;u4oeeo o3iasla uauvsnu)tlerxocta1oaD luvo t t2urxr iydlm n ieia()arum(moot1opt mf3tadls ra(mo;t0tltnir3totlp rlues s0srxoxm iu1lmtn fviat sDua(r oo1tpxoiictyd m ean p;(4trxoif3totfa rlneils t2xmiopno1apeemict s) Drmu  nt1tlen ictys s ul( on(4trxrif3oa1fpt  ieslt srumxr ou4ol elfcilsfarraurpoo4aetniictyt m elnvsn(0trenxo iadoaDeaivsls0 eumxopno4am nmnviat)a2rmu  nu0oeeomf3ildfsDelnvonu4tltoxr ta1oate uvs;t0t2xm(opnu4op  livi t s2uru pno0open o3iatfs rmnms t4tlxrmoctydom raneo s0t2umiopoo1ol elfvsa(faruaum ot1tlt  fciat m2em(vs;()aetrmf iatom   neslt setoxrpny4optnmnvsat)a2rmxr ;u1aex  octltlaDrmu pnu) eerifcoo1laDr neo (0 2umio3nu1ol  livslt  rtau pot1oee mi3tatfmDeluvo;() lxnxociy1lmD  uesls sruo(r ny1lpen neias) rrrumo;t4alen o3iydfsDemnvs t4alxrmf3ootomtr nesl() exo(m3ny1lpe  iesatf rtmum no0ole mfeiadlm2uln on(0 rxrxo3totlmD lueol() 2xmir3oo1optelictas s2rm(mono0aeeo f3iysfmDrmn pnu) lerirciatfateanvols0trxoimpnu1ol  livtlsfsDrm(m ot0optnio3tas sDrlu o;()aexrxfciy1fptelnvsl(0teumxr3oy1am nmfesltfsDtm(mo;t4apx  iciydfa ran s (4arxnxr3iadlpt anei s)srxrxo3nudap  mfvil(f 2umx p;u0tpx  fciatls2eluvpnu4 rtoirctatfpDranei;t  etm(m iy4olee ivilt s2tau poo1apt ii3tlt s2ranmo ()aetoifcoa1oaDranes t0t2xoxm oo1lp emfvs (fa2ua(rooo1tpxomoeiatlm el(mon(0 ltnio3oytomtr ies;t truoim no1amenlnci s) rtmum oo4olxnmicilt a eluvo;()tlxrio iy1lmD luvi;(0s2xoirpiydamtnlfctasfarrrump;o4aetomocild mDra(vsnu0 reoxr3iotom elueo;s srxoim3iudalt lnvtat)sDumxmono1apx mociydls2em(mo;()arenif oodfm  an i s0 2umirpou4optnlfvi s) 2um(  ;u4tpeniieiysfs um(mo () eeomo oatlmt lnei;t t2xmxopnodap   nvias)a2tax  ot0oexn iciatfs2rluvpnu0trtoif3oadomDe u o (  rtoxr iodom  lfes tfaDrmxr nu4tetnioetaslm2rm(msnt4trtomf3tatlmtelnvsl(0srtrir oy4amtnmneil(f 2uau pnt0alx  feiad s rm( pn()trtniocoa1fptr u s;t srxr(o3oy1omeeliviat srtmx  ou1tpe mo3ildls2ul(vp u4 etrir oadlpD ai i (0tetm(o io1apenmieiat)aruaxm nu0texnmf3iaslm ea(vp t0 exoio oydfmDranvs t) eto(opoy1om emfvslt) rtr(  nu1tlto feiltla ranvsnt4tlxnxociodopteai ol() 2xr(rpoo1ap emnvt tfsDtr(  ou4aee  ietadls2uan o;u4 eeomfciotlpDeln sl( srtoxrpoo4ll   fvia(  Drrump;o4opxo oetasfm2ua(mp;(4arxoxo3ta1opDeli sl()seuoir iodalenlnetltf Dtmxro;o1apxnif3ildfmDemnvon(4trtoxrciytlmt auvo;t)srtoir no4ole  ict tfsrraumpot1oet mfciydfs rmn pn()teeomoctadoat lueols0t2umxmpou4al n fctat)a2ua(ro;u1alxnmo3iys sDeaums u4teermocoa1fmDean s;(0 exmimpny4lm  mnei t a2tru  no0aeeo feild aDrln o;u4tltnxfcoo1oa  auvo;( teuo(mpno4open nciatfaDtru ooo1alxomf3iysfm rmumsnu0tlenxr3iotoa r neils setm(m oo1oleemicil(  rrm(ronu0ale  ieilsfa2eln snt)arxomocoo1lp   iei;t0texm(m3oydop n fet tf Drau  ;t0aptn ietasls umnvp;()artoxr3oadla eau i;s0texoxrpnudllt liei (fartmur ;t0tle  f3iyt a rmumo;(0alerxfcoytlatelieslt0 ruo(o no4ll emfvtltf rurump;o4aexo ietys m um(mpnu) ltnio3oatlaD lnei;() 2toxo3iy1ol   fcs t)sDuaxmpnt0tpt moetadfsDrmnmsnu0 rxomrciodlmtran o;s)srtr(o3iudol n nvils  rraxroou0tpenifetltlsDra( pnu) rxoir3to1lmDe n s;t)s2toim iu1ap emfct sfaDtau  ;t0oet if3tys m em(vsnt) exnio3ta1laD an i;t t2ur(r oo4lm   ncsa(fsDur(mo;u4tltnif3iatlm em(vsnt4 eeoxf3tytfat  iei s0s2xm(mpiydam nmivsltf rumxrpnt1tpenmoeiadlsDelnmp (0alermr io1omD  nvs;(  2um(r oydam n ieia()a2um(rpnu4tpx mictytlaDra(vs;() lxoif3oo1oaD lnes;t)t2toirpiudamtn nvtl()sDtmump;u0tetoioctadlmDrl(von(4arxoxo iytla eli s s)trtrir nodaptelfei s sDtrump;u0aexoiieiltlsDulumonu4tlxrif oydlmDraivi s t2toimpno1lme mfctl( s2tmxrp;o0teeoii3tyslaDulnvon(0artrir3tadlpDraueolt)setr(opnu1om  lieiltfa2tmx onu0tle  feiat s2eaumont0tlxoir ty1oat lnei;()trto(m no4op   neias s2tm(mpot4oexn ietyd aDean p;(4trxrmocoa1lptrlnvo;( t2trio3oudlm nlfeiltfsrtm(mpot4tptnmi3iadfs ul(mo;t4tetnmo3iotom e u i (  2xoxrpiudll  mict t srraurpot1alx ii3tlsls2rmnvsn(0tlxrio3iy1omteli s;s)tetr(o nu4alen fcia( s2rrxroou0aptoif3iad a elnvo t4aetnmo3iy1latr n o;t0srum(opiydame  fcsa(  2ra(rp;u1oeeo o3iatlsDum( s;t)tetomo ta1fateaivi t0texo(o iodomeelivsls)sDuax  nu0aeen o3tld a rlnmp;t0aexnir3oo1op  li slt0 rur(m3nodlp elietat)aDtmxronu0apxnmfctydlm ua( ont)aetnif3totoa rlu o;(0t2tm(opnodal  lfei t a2tr(mp;t1tpxnmfcild a eanms (0aeeoirciytlpt  i ols0 2tr(mpny4opeeliciatfsruau p;u4oeenmf3tyt m2eaump;() lxnio3iytoate neil(0trurxmpiudlmt lfetl() Dumuro;u4ope  o3iytfsDul( on(4alxnmfcoadfpte i ilt  exoxo3ny1lleelics s arrax  ou1oeeomi3ild m rl(ms u4 exoio3iy1omD  ivo ()trxoiopnu1om nmfctatf rta(r no4tpx  ocildfa uan p;t)texoioctodlpDrlivi;s0texoimpoo1ome mnvtat) rum(rp;o1teto fetas sDeluvp () eeoifctydopteluesl()t2xm(rpoo4olen nes s sDua(  ;u4opx iiciyslm rl(mo t4tltrmo iydlpD  uei;(  2xm(m nudomen fvs t) Dua(mpnt1opx mi3iydfs2rlumo (4aetnmrcoydop   ues t  exoxopnydlp   nciat s2taxrpou4olxomfetlsfa ranmp;u0aeenxr3iotoate ivo;t  exr(mpiu1lpen fvsl(fsrrau ono4aexniociltlm2rln pnt)tetrmfcoy1op ranes;()seur(rpoydlptnmicsasfaDua( p;u0tltoioetls s eluvpn(0 eenio3oytfat  nvslt  2xoxmpiodam   ivs sfa2tr(mont0oet mfcildfs2rlums;t)aexoxrcoo1laDe uesls0texmim oo1ll   fvia( srrm( pnu0tpxnmfeils m2rmnvpnt) rxrmr iadoatrai i;s0 eurxrpoudamt liet ()aDraum ou4tetnmi3iydls2um(vont) rtomrcoodlp  aues s0 etmim nydlpe mici () rra( p;t1olxo iciyt s2uanvp;u)tlenmf3iy1oaDeaneo s0srtoirpny4ameelfvtltfaruaxm oo1teeoif3ilslsDul( p;(0altrmr iydlmt livolt) eumio3oudamtemnei t) 2uaump;u4opx mi3iytfaDrmnms (4artnxo3tatlatr ieo;s0 ruoiopnu1opt mivtlt)sDrru  ot0oltn i3tlsfs elumo (0aleoxr3iy1faD luei t seur(o3oydol nlics sfa2ua(mono1oltnii3tldfm2el(mp;()alenmf3iadfmtranes (0t2um(r3oy4ol nlfvil(fs2rru ono0apenif3tltfs2rlnmo;u0 rtniocio1fpD au sls trumio3nu1lmt lnvias)aDtr(m ou0apt ioeiad a2ra(mpn(4tlxomo tadoaDean i;t)texr(m oydopee nesa(  Dta(rpoo4apxo f3taslmDea(ms u)arxoir3ta1lptrlues;( t2tmimpoo4aleelivtltfs2ur( o;u1aleniociadfs2ea(mpnu0 lermrcia1fmt ln i;s0sexm(m iu1am elnvils srururp;u4apeoiociys a elump;()aeenmo3iatlpDelnvs (0 2urxr3iodope  fvil() Dtrur no4oetoiociys aDem( s;t) etomo ty1oa ranvslt)trtriopoo1llte fcsl( a2tmump;o0tpenmietasfsDeaump;t)aeermo ia1lmt anvi ( t2tr(m oy4am e ict () rtaxmo;t1olx mfcildlm eau o;(0treoio ty1fmt au il(  2ur(o nu1al n iei sfsrtm(mo;u0tlenioctlslm umn p t4 ltrxocootoptrlieo;t setrir3iudopeelictasfarrmx  ;o4oltn fciyslmDua(ms;t0 etoxociadom elnvo;s srxmiopoy1aleemfetas) Durumont4olx  i3iltfm ea(monu0 ltnmrctadomtr i i t0trxo(m iodllt  fvtatf rra( p;u0alxn f3iysls2ul( o u0arxoxf3ia1oa e ies t  rxo(r oy1ome  ivtas srta(r oo0tetoifeils mDulnmp;(0 rtomfcoytlpDeln s s) 2tmio3iu1omtnmivsl()srtm(rpnu4oleoio3tysfa ul(mp;t4 eermfcoatopte n s () exmxm iodllenmfct s  Dtr(mp;o0aleoio3iasfa2uluvsnu0aetnio3ty1omtraies t)t2uoim iudaltn fctl() Duaxmonu0openmietltlmDrlumo t)teeomo tadfat lneol()srxm(r no1lltn fcil()s2uaump;o4olxnif3iat s eaums;()trxoir oytfat aueolt  rto(o3nudom  lneia(f Dtrxrpoo1tpenii3iyslmDel(vs;() leoxr3oodlp eau i;s0srurxrpoo1op n iet ()sDtmuroou1tlx mfctasfm ranmo t0aetoio tadoptr u ilt0t2trimpnodllt mfesatf 2tru p;u1tex moctatls2uaumonu4 lenxo3oy1fpt aieolt) exriopoo1optnlictl(faDrmx oou1alxoiociatfs rmnmp u0 lxrxo3totfm  au o s)sruoxmpoydal  mietlt  2um(mono1oexoiictltla eanmp () ltrxo3oa1lpteauvils seuoxm iodomtn ivia(fsDtru  ou4tetn o3iysfa rm(vpnu) reoxfcoy1oatran ilt) exm(opny1amtelicil( s2tmum oo1ope  oetytfaDea(vp u0altomocootoaD auvi;(0s2umxopiydam nlfesltfartrx o;o1ope ioctlsfs rlu s (0 ltoxr totomt ai i s)srxmxm iy1olen nvils) Dtau pou4olxnmfciad m uln o ()arxoif3oa1opDeanvil( seurxopiudlmenlietatf rumuront1olenio3iydfa emums;t4teerio3io1lp ran o;(  rxoxr3ny4apeemicta(farraumpno4alxnmoetat sDrlump u4aeenxrciodoaD ln s;s  rum(opno1openlietatfaDtmu  nu1aee  ieiysfm2rlumsnt0 rtrif tadfpt aueo;s0 2tmxo3ou1altn fcia(faDtmuro;t4aeen i3iat m um( snt4 rtnio3oodfmDeaivilt0 rtrir iy1ale lnciasfarrr( p;t1tet  ietltla2rm(msn(0texomo3ty1omt aneil( tetmxr3no4al  lictltfsrrm( pno0aexnmoeiyt a2emnvsnt4 etnmo3tydomt  ivs;s0sexr(o ny4lpen feiat s2ta(mooo1apxo o3tyd mDelumsn(0texnxfcty1lat lnes s  rtmxr3iu1aptnmfvsa( s2ua(mooo0tlt  ociatls2rlumon(0aexoio3oodlm e uei;s)seurxm3iu4olt lfet s a2uau oou0apxomf3ilt m uln s t4 eeoxf3ty1opDelneo;(0setrxopno4al   fvs tf 2rm(rpnu1aexnmoeiad m um(mpn(4 rtomo3oydlpDe uvo;t)texrxo oy4lp  mnvilsf 2rm(  ;o0teenioetlt s2ran p (0 rxoif ootfmtr nes t)sexmirpiydlpt lfcsas srtr(rpnt1aetomfeiasfs ulumo;(4 renxociotlm   uesls0 euoxm oo1oltelfvs s)a2ra(ronu0texnio3iltfm2ean s ()altnxo to1opDrau o;(  exmxr3iydamte ict (fa2rrxrooo4oeen f3tltls2raump;(4artoxfciotlmt  n sls  rumir3nu4lpt mnvtls  2rauro;o4tlxnifctls a2rluvp;t4artnio ia1lpD  uei t) 2xrxmpiodolen icils) 2rr(m nt0tlx  i3ilsfsDranvpn()trtomoctatom rlues ( trtr(opou1om n ivta(  2rr(r ou4tpt  ociys aDemuvs;u)aexrxr iatfptrln s;s0 2xrirpnydop nlicta( a2taumoot0alt iiciatfm2eanvp;u4 rtrxf to1omDeanvi;t0srxo(mpio4lp   net () Dtaxro;t0aeenmi3iad a uau p;()teenmf totfmtrai i;t0 exm(m oodaptnlfvsl( artm(m ot1aeeniietas a ean o u0trtrir3tatlpDr uvs t  rtmxm3nodaleelfvt t) rtaum ;t1oltnioctadlmDrmumpnt0artrifcta1lmtr neo t srtmxm oy1ap e ivs ()aDrmumont1aetoifcilslmDuluvo;()alerxrcootlatrluvol( truo(rpiu1ap e iciat) rurxr no0apenmo3iyt s2ulnmp (0 eerioctadfaDe ivo;s t2tr(r3no4alt lnvtatfa2urumono0tetn iciasfmDeanmp;t0trxnxr iotfaD ln o s)tetm(mpoo1lmt mfesa(fs2ur(mooo4oexn feils m2rln p;u) rerxo oa1oaD  ivs;( srtrxo nudolenmfei ( aDtrurpot4apx  oetydfm2um( on()tltriocoydfpDr nvi;t tetoiopiu4omenmicta(  Drruront4oleo fetadlm2umnvo u4tlxnxo iytfatrlu ilt)t2urxm oodlpt mnvsasfarra(r ot0oee  iciytfa eau o;u0trxnxr oytomte nvs;t sexmxr oy1lltemfvsatfsDua(mo;u0tleomf3iltfa rlnms t)arxrio3iodfm   nei;s texoxrpny1ap  micias) Dtmu ono4opt  ieild m2eauvpnu0 rtnif iatfm raneslt0srxriopiydolen ivia( aDuax pnt0tltn oeiaslsDemu p u4tlxnio iy1latelueo s)texo(m3oodlpeemfctl( a2tr(ro;t1oexo o3ilt sDumu p;u)tltoxo tydomDrlies t0t2urimpnydal elietat)sDrax  nt0ole iiciatfm rlnvo;u4artoxf oodopDe nei t t2urxmpiy1omenmfvs (fsrrr(mpot4oeeoif3ilsfs2umnvo;t0alenio tydlmtranvsl( s2umir iodlp nlieiatfa2taum oo0apxoiociydlm rmnmp u0 eenxrctytlaDrlu ilt  2toiopoy4altnmfeia(fs2tmur ou1tpt ii3iltls rl( s t)alxrmr iotoa ran o;s srxm(m io4am emnvi s) Dtax oot0tlt  i3ils mDraumo u4artrir3totom rai s;t) rxoxm3iu4lmtnmieta(f 2ra(mp;u1alxnifctad a2elumo;t0tetoxr3ia1lp  lies (0trxrio3nu1lpen nctls arrrxmp;u4ale moeilt s2eluvs t0tetnir iodfa  lieo;s setr(o no4op   feils) 2rmu poo0tpx  ieiydlaDeanmo;(0tltoio ootopD auvs ()trxm(rpio4ome mfcsasfsDum(mont0tet ifctydfaDuluvpnu) rerxf iydlmD  uvi s0srtoxm iy4al nmfei t) rtaxmpno4aetniociltfm2rl(mo u0 lxnmfciytfaD  ivo;s s2xrim nydol nlnetls)sDtm(r oo1tpt ioctys s2rl( p;(4 etoxr tytfp r uvs s srtrxr ou4apenlnct s arta( pnu0opxo fctytfaDumnvp;(4aleoir iotlat luei s0srxoim3iu1llt mietltfa2rm(mpnu4apt  o3iyt s rm(vpn(0altrxr ootla eaueslt srumio iydapeemnes s  2ta(rpou0olt iiciaslm2rmn snu4 exomr3ty1lmD auvo ()t2trxr oy4apeemfvilt) rtaxro;t1opxoiieiadfs el(vp;u4 eerif3oatlp rlnvslt t2xr(r nydoptemivi (f Drrx ooo4altoio3ildfs2ulnmp;(4 exnmfcoydlm   nei s)setrim3nu1llt mivil() Drr(  ;t4tlt ifetadlm2rlumo t)aleomr3oa1lp e u i;s0s2umio iudam e iesa()s2urum ;u1aeto i3ilsfaDelnmo;u0 etoir tatopD aivi t0 exrirpou1ll e ncil( aDrax ono4oeenmfcildfs emnmsnt0arxrxr tytfaD  ivo s0 2tm(r3nydlpenmfvtls)a2tru oot4ope ioctls s rmnvont4trerir oy1oatrai s s)seumxr3ny4lpenmfet (f 2rax  ;t0opx  o3tydlsDranmp (0 lenxr tytoa  ai sls)trxoio3iy4llte fvs tfsrrm(r ;o1oetoiietld s ran ont0trtrmocio1oaDe ues;s) 2trxm iy1omtemnes ()a2rm(m nt0oexn iciyd a2ra(mpnu0 exrif3ty1lpDr nvi;()trtrxo3ou1omee ncilt)aDuauroou4tptomo3iltla2ul(vs (0alermr tytlaDr ies;s0 exr(m oydlmenmfvt sfs2rrxrpot1olt mi3ils s2ea(vsnu) ltnif3tytfaDeanvsl( s2uoirpiodap nmfvi t)srumu pnt1tleo ieiytla ra(vpnu)tltnxrctatfaDeauvs ( sexoimpoydap   ivias a2tm(rpoo1oleomf3iltls uaumonu) ltrmoctadlmD li sls) 2toxmpoy4lm   ietls) Dtaumooo4tpx miciasfaDua(monu4 eerif iatoaD  nei;t  etmimpou4apeemfvsl( artr(rpoo4alxoiieils s raumpn(0 leoiocoadfmteaivilt) exr(opny4olee fci tf 2rmx oot1olxnmiciatfm eanvpnt) exomr tydoa e i sl()trxr(m3oudomen fcsas aruauroot1opxoiieiytfsDeaump u0tetoir3oodom r uvsls0texmim iy4ll  lnvt s  rtrumo;o4opeomfeiad s2ua(vs;u4 exnxfcoy1optrlu i;( s2trxr nu1lm e nctltfartm(mpnu0opto ociyd s umu snt4 ltoir tytfpDrauvs;s  2xr(o oo4lm nmics ()srrrum nu0alt  o3tyt sDeln sn(4arermrciy1fm rlu ils s2xo(rpnodame miesat) 2tmxmpnu0tpx ioetldls eanvpn() rtrio oa1oa e n o;t)srtm(r3no1om  lictas s2rr( pou4tlen ieiadfs2umu onu) eerio oytfpteln o;t) euo(opnydlme lneils)artr(  ot4ale  oeildlmDua( p u) ltnxr ty1faD aueslt)s2xoir3ny1ol elfviatf rtax oot4oex ioeilt aDemump t4 lxnif iotfpDean sls  rtr(m nodalt lnvsa(  2tmx o;o4olxnmfeilsfaDeaumo u4tltnxo tadfaD luvo;s) eto(o ny1lpenlnctasfaruax p;t1tpe  ietasfmDemu p;t0trxnifciotfp   ies ()trtm(opiy1alt mfetlt)aDtmxmo;t4openioctlsls2ul(vp;t0tlermr3iodfaDeauvslt)trxoxm oy1omenlncta(  rurx  ;o0tpt io3ias a2rl( p;t0tetriocio1fateauvo;()srxoxm ou1lpee ictls sruaurp;o4ole mo3iltfm elnvpnu4tlxrif3iadlptean s t0srtoxo3iodapeeliet sf rtr(mpoo1oet  ieiytfmDel( s;u) etoif3oydfpDr ueilt0 rxoxo oy4openlnvtatf 2rruroot1olx mietytlaDuluvo;t4texomocta1fa e i o s)s2urir3nu1oleelieta()sruaxm no0aexnmf3tysfs2uln s t4trerirctadlmDrauvo;s0 rxo(m3ny4lmenmnct s arrmurooo4apxomf3iatla2ra( s;u4altnxo3oydfm  auvilt srxo(m3ny4omte iet sfartmx o;u1olx moctyslsDuln pnu4trxrmrcoydfmD aivs t0 2uoxo iydoptemnesat)arrrumoou1opto ieiatfsDrmnmonu4teerxr3oodlmD  u i;(  etmir iy1lp elfcsatfs2uru  nt1oleomociydlm2ra( pn(0 renio3oy1opteli i;t)srxo(rpnydamen fet ()a2rr(rpoo0oltoio3ils mDua(vpnu) renxfciadfpDeai s ( teumxo no4ap n feil()a2ururpou1opx mociysfm el(mpn()teenio oo1la eai ilt  euoim3oy4lmenlncta() rrr( p;o1tee iietas sDra( s ()tlxoxr ia1fa eliesl()srxr(m iodllenmnvsasfartau pou4ope mfeiysla rmumo (0arxoxociytfm eauvsls0setoxopnydlp nlfesas)srum(roou1tetoif3ilsfsDem(vp;() etnxr iodomD luei;t) rtm(mpoydapee ncil()sDurxr ou0tpxo ociys mDra( s t) rxoxf3oy1latrluvsls  2tmxrpiy1lp n fvslt srrr(r ;o0teeomictyslaDumu pnu0tltrif ootlaD  ieils)tetoxm oodalte iei () Duru  ou0tpx  ieiltfs ulumsnu0teenxrcoytfpDe uvs (  exm(opnu4om elneslt s2rrx pnu1alt io3iad a2rl(vpn(0 lxrxo tadlmtr neilt0srurxo3iu1lmt  netat sDrr(ront1apxo feiat s rmn ont4altoxoctytlpD  uvo;s)teur(r3oo4ap nmieia(fs2tmurpnt0tpxn ictys mDua(ms;(0trenmo3iodlpte uvs;t) 2uoir3ou1lm   ivt s a2rr(  ou1apto octlsfaDrmuvp;(4 eenxfcty1latr n sl(0 exr(m3ny1alee ivs sfaDtmx pno4apenmieilsfaDrm( pnt4aetnif3totfm  lueols s2um(opoo4llenlnctat)aDrr(  ou4apxo ietatla rlnvon() reniocoydopDe ivs ( tetoxm3iodlmte ivil( s2taxrpnu0olxniictas m umuvon(4 rxrmocoytlaDraueo;()trxm(opnydlm   ieils)a2um(roou1optnio3tatlaDean pnu0 rxoxf3ootlp  ai i;(0srurir3nodole  fvslsfaDururo;u4opxomieiat s ranvp u4aetnmo3tydoaDe ivs t t2uoxr3nodll n feia( srtrx  ot4aeeo icild sDrmu p;u4 rtnircty1lmtrau o;t)s2xrxr iu4apenlicils  Duaurooo4tlt  f3tas sDrlu onu4 rxrxo io1oat aivi s)tetmxmpiy1lltelnvi tfsrrau p;t4olt mf3iltls2em( on() rtnio tadfpt aneo;t setrimpoudlltemnesat  2tr( ont0tlenifcildla rmuvo () rxrirciytom e nvo ()tetrxrpiu4ope  neilt sDtrumooo4tex ii3tyslm2umumpnu)aeenxr3io1fmt anesls)seur(m ou1apte fei s artmx oou4oleomi3iasfa rlnmont)tltrmr iytfa e ueo s0srumir3iodlpenmnvsasf Drr( onu4ale moetltls2eau o (0 etniocia1omt  neo;t0setrimpnodll n nctls)s2rmxmpno1alx if3iasls ulnmo u4artnif iodfp eau o t  exrxo io1lle mfeilt  2umx onu1apxomfeiasfaDrluvp;(0alxoir3oadfaDeln i (0srxoxo nydop  mnvslsf Dtr(rooo4aptnmictld aDeln s (0altrmf tadomDe n i;t)trxoxm nudlmtnlneslsfa2tm(mp;o4tptnmoctydla rlumo;()artrxo3iy1fpDeaueo;() rum(rpny1oleemiesa()s2tm(r no0aeen o3tad m2rauvs;u4arermoctydopDeaneo;(0tetoiopou1alee nctat sDtmumpou1tleoioeiydfa ranvpnt) exrxf3iotlmt  nvo;( tetoxopoy4oltnmfetl(  rtm( o;o1ole if3tytfmDrm(vo;u) eerxfciadlmD  i s;(0 etmir oo1al nlneil( a2uau  ;t0aptn feiatfa rmu pnu4aexnio ia1opDeli o t s2ur(r io1ame  ivsl(fa2trur ou0opto ietatla2rlnms;t4artnifciy1fmt ai sl(0trtr(r iu1ol  lfvt ()s2trur ot4tex mictat aDranmp (4areoxo ia1fmD ai o t  rtmxm3oy4ol  mnvsa(fs2uaum ;t1apx moctys s2el(mo () rxnmr totfpD anvo s t2uoio ou1ol  lnetat)aDumxmono0tpt  feiysfaDuanvp (4teerxf totomDelivi;(0 2uoirpou1alenmiei s  2taurpoo0tpxoifcildlsDrm(vs;(4 lenmfcoodfmtean i;s  rxmim3nodamen fvta(  rumuroou1tee  iciat mDumn p t) eeoxo oytopDr nvs t  2tm(opiy4ol emneia()srur(  ;o1tlen o3iyt aDrl(mo;t4alxrifcoodlp  lnvslt)teurxrpnydlme mfetatf Dumxmpot0aetomfetls m2eluvp;(0 lenir ta1faD aieolt) rtmxo nu1lpeemfet t  Durxm ot0olen o3ild a ea( s u4treoif3ootlmt lueo t) rxmxrpoydomenlnvtat  Dra( p;o1aexomi3iasfa rlnmo;u0alenmoctadoaDeluvo;t0srtoim iudalen nvs (faDra( ono1tex moeilsfa rlu ont0alenio tatfmt aueol( seurimpou1lltemfciltfarraumpnt0tlxnifcilslmDemnvont4 reomocoa1la ranvi;s t2xrir3nodaptn nvilt)sDuru  no4oexomiciltla2ran p;t) lermociotomDr uvols) etoio3nodll n fetls  2rr(moot1aetnii3ild s eauvp;u)alxnxo3to1la rauvslt sexrxrpiu4ape  fes tfsrtmxmonu4ape  f3iltfsDrlu o ()altnxr oo1oaDr neo s  etm(m3ou1ol nlicsa(  Dtrxrpoo4ope  fciys a ra(mp u4 eerioctatoptrlnes;(0 eum(opiodlltn fvs ()srra( p;o0tpt iociydlm uluvs;(0tleoxfcio1lm rln o;(0t2to(m oo1op elivils  Dta(rooo1oeeoiieiys s2umu pnt4trtrxfciydop r ueolt0 eur(m3io1ll nliesatf Dtm(mpot4teenmo3ilt aDemn sn(0 exomo3iy1faDeli s;(0sexrxm ny1am elncslsfa2ua(  ;o0apt mo3tyd s umu s t0artoir3oydfaDran il(  rxo(mpiudlmtnmnesas) Dta( o;u0apeomi3iadfm2uan o ()aetrmr ty1fmDe ieol() rxrxr3no1apenlncsa(fa2rmur ou1apto ociltls eauvs u0trtnmfcoa1fpDelieo;t0 eur(opno1amenmfvil(f rumxmpnu4texomi3tad s ra( p;u0alxnmfcta1laDrln s;t)trumimpou1alenlivs s  2rmxmonu4oetnmieias s2el(mp u0 rxnmo3iodfmteluvol(0trtmxm io1llen nvta( arrm(rpnu4oltomietlt aDuau on(0aeenmoctotop  aivslt)t2toio3iu4alt lneta(fsDrau  nt0olxn fcilt a2ulnvsnt4arxoxrciadfaDrli ols0 rxrxr3ny1ll elfvi (f 2tmxmoot0aexnioetld s rmnvo;u)arenmo oa1op ean o s0trto(rpoudol elfctasf Drau poo4olxniociatfs2ulumpnu4aleniociodfpDraiei ()trxo(m ou1lm e neia(f Dumx pno1ope if3tlt sDraumon(0 etniociatlaD au ilt trxm(m3oy4omee fvs ()aDrmur no4oetn fetasfa eanvsnu4 eenxr tytlmD lneil()trtoxm iodap n nei s)artm(ro;o0tpen ietasfmDumn o u4tlxoxr ootlpte neol( texoir io1apt  feta(f Dtmxroot0tee  ieildls2um(vp;u) rtrmr tadlaD  nvol(0trxmir oydomeemivtas)s2ua(root0apto ieiad aDumnvpnt4artnxo ty1laDrau sl()t2xm(r3iu1oltemfci (fa2ta(r nt0tltomfctadlm emu on()altomf oadlm e nvi;()sexo(r3oy4lm nlict t)artau  ;o4oetomfeiatla2eln s;t4aeenmfciatlateanesls teumimpiudlm n ncsas)sDtr(m nt0apxnmo3tyt m el( snt)altrirctodfmDelnvils seurxo ou1alenmivi s)sDrr(rpoo1aetniictytfsDel(mp;u)aexrmr ta1lmtelues t0 2uo(r ou4ll n ies (  rtrxr ;u4optnmfeiyd sDraumo;(0areoxr todfm rln s;s srtoimpoy4lpe lfvslt) Dta(rp;o4oet mfctyd s2rl(mp;u0aexoifcio1fa rln i;t)s2uoxmpoodole lfeslsfsrtax pnu0opt io3iad sDelu s;u4trtrmf ia1lmtrlnvsl() eurxm nydap emfeia() Dtr( o;u1aptomi3ild a rluvp (4aeenmrcto1oatrau ils)truoxr3iu4lmtelivi tfaDtrx  ;u4tlt  oetys aDeau o (0tlxrxo ty1fpteaieo;t0 2xrirpiydamte fetas)arua( ooo1olxn f3tlsla2eln o u0aexnxr oa1optr uvs;s) euoio ou4op  mncs t artaxrono4opxomfctyd a um(vs;(0aeermf to1lmDean ils) 2xr(m3nu4omenlfciat)srtaurpnt1oltoioeiys sDel(vonu0alxoxf3ia1lmDe u i ()trxrxo3oudapee ivil( aDumumpno4apeomfeild mDemuvs;()trxoif to1op e ieol(  etr(m ny1omenmncia(f Dtaum nu0tpxo o3iyt a uanvpn(0altnifciatopt an o ( srur(r oodlmtnlict t aDtru oou1tpenmfeiydlsDumnmp u) lxnmf3tadfp raivs;s0 ruoxopiudam  lfci ( sDtr( o;o0oetnmf3iltfs2el(msnt4trxrmf3ta1omD  n s () exrxopoo4ll  lfet t) Drrxmoot0apx mfeiytfaDea( o;u) rxoiocoadfa e ueo (  exmxmpnodapen ies (farta(mono4oexnifeilslaDuaumonu4aeenir3iotop e nvs;s) 2uoxr3oo4ameelfvi tfaDtaxrpoo1oltnmocias a ua(vont4altnmrciadfp e i o;s)trum(rpno1llt mnvtl(faDra( p;u1tptn fcilsfa2umn s;u0trtomr tatom eluvo s t2tm(rpoo1ap  mfvt () ruaxmp;u0olxoii3tatfm2rlu o u) rtoir3oo1fpt ai o (0 2xrir3iydoptn nesatf 2um(rp;o4oleo iciadfsDeluvs;(4 exnir3iodlaDeauvsls)t2toxm ny4lleemfctas aDrmum ot1oexomfeiad sDrlumonu)areoxf3iytoaDraueo s) 2tmxr oo1olt mfei (fartmxrpot1tpeo fciys s2umu s t) leoio3ootlpt ai o;(0 2um(m nydaltelivta()aDtrxmont0alx ifeilsfs umnvon(0 rxrmo iydla raiei;t)t2uoiopoo1lle lfviat)sruaump;o4alxn i3ias m2uaump;(0arxrmf iadfa rluvs;(0trur(r3iy1lm nmnesls srrmu  nu4teeo ieiytlm2rmu snt4trtnxocoa1fm  aueo;s seumirpou4amtnmics ()srrr(rpnt0oleo o3tld s2rlu o (4trxnirciatlmD lueilt  2to(o3iudomenmfeil() ruax pou4olxnmieildfa ranvo;u4aexoxr3iatlaDr iesls)tetmxo3oudam elnvia()s2ua(  no4tlxoifetatlmDeanvp;u) exnmo3tadlat lieilt texmxrpnudol e ivils) rtrxrpou0opx ioctasfm2em(vs;(4arxnif3oydlmtr n o s  ruoxm3ou4al  mici s aDta(rooo1opeo ietys aDeluvont)trxnmocto1lpDrau ilt s2uoirpio4lm emfeslsfa2taump;o1olen octasfa elu s;u0trxrxf oodlmtrlueo s0setrxr oo1apen nvi s sDtmurpno4tptn o3iatla2umnmpnu0trenxr oadfp r ues t0trtm(r iydll nmivt t) 2urxmoot1aexo octat m2uan sn() leoif3ty1lp eluvils)s2xoxm no1am nlneta( a2urumo;u4optn feiasfm el(vp t4trermf totfaDrlneo;s  2tmxmpiu1lleemiei sfsrrrumont0oexnmo3iltlsDrl( p;t)artrmo3oo1fa eaies t)t2umxr3iydlmt mivi sfs2raum no0teto feils a ulumpnt)arermr todlmtranvils)srxrxo nu4lmtelnetas) Drru pnu0opxomocildlaDul( p;(4 ltrxocia1lpteli slt0 eum(o3ny4omeemicilt)arua(rooo1tex ifeiasfaDemuvs;() etnxf3to1lpDe ies ( s2urim3oodolte nct t) Drrurono1opxomoeildfmDemu s () rtnxociydlmD aies;t)srtrxr3no4amtemnct t)srtm(r nt1oee moeiydlm2rlumpn()alerio iytlm ean i t)tetoio3oudam elict ( sDrrur ou1tpx mf3tltfa um(vp () rtoir3tatlpDrai ols0 exmirpou1ole lfetl( sDuaxm oo0opxn ieiatlsDrmn sn()treoir3oodlptrli o;t t2toxr3iy1apee ivt t srtmxront1texn fciysls2um( snu0altoif3ootlpDeai s () rtr(o3io1op emiesas s2raur ;u0open iciatla emuvont0 lermo tatfp elueilt s2trio io1lpe micilt srur(m ;o1aexnmictadlaDua( o (4 renmf iotopDeluei;s)trxo(o3nodom   fcslsfs2trxm ou4apx  ietyd a ua( o ()trenxf3oatlmt luvi ( t2toxr3no4olte nes t sDtrxr ot4opeoioeiatla2el(mp () exrxo3oy1oatelneol( srxm(r iu1amenlies sf rtmx  no1ole  ictyslm elumo;u4tltrio3oatlaD luei;s t2xrxmpio4omeelneiatf 2uru  ;t0teeomieiyt aDulump (0tetrifcia1omte n i (0srxo(r no4apenlnei tf rtm(m oo1apxn fcils s rl(vp (0trxomf3oadfpDr ueolt)setm(mpiudol  mict s) Drm(r ot0opx ifeils m2umums (0 ltomfcoodoa rlu o;(0texo(rpny4ll nlfvsl()a2rrxmont4oexnmieiys aDua( s;u4 etrxr iadlpt anvilt0 etoxopoudolen fciat s2raxrono4tex iociatfs2rl(ms;(4aetrio3oo1lmt anvslt  2uoxopiy1lpen nctl()s2tru o;o4apxn ieiad a2ra(vsnu)altrir3ta1opteaieo;t)srxmxr iu1lmt  ncils  Drm(m ;u4texomf3tadla2el(vs (0tlxoio3tadlpDrlu s ( trur(rpiu4apeelivsl( sDra( o;t4tlx  ieiadfm ean p u) lermo3oatoat anvi t0 rtmirpny4lltemfvsls)aDraxr ;t4tlt iociatls2um(von(0aeeoxf iotfa   ivol( t2umxr iy4op elict () 2ta( ono0olt if3tytfm ul(mo;t4alxomociodfmDeln sl(  2uoirpnudaptnlfeil(faDraur oo1tlxnmfciadls ranms () etnmf3iytop  lu olt0srur(rpnu4amtnmnctltfsDtau ono4oetoifctlsfaDea(vpnt)aexnir ta1laD au ols  etoxrpiydomtnlivta( sDra(rpno1alen f3iys mDum(vo;t0tlerio3iytfptrln o;(0teuoio3iydalenlnvtat arumurpot0aexomieiysla2el(vo (0 ltnxf3iydopDrai ilt) euoxm iy1om nmfvta()artm(monu0oee  ieiasfsDel(vp t0 eerif iodfmDe ivs;(0s2uo(mpoy1llt lfesas)a2rmuro;o4oeenioetlslaDeanvp (0alxoxfciatopDr uvo t0 exmxo3iy4olen fvslt s2um(r ;u4tpe iiciltfm2uanvpnt4aexnmf todfpte u i s0 2to(r no1ll  mics s sDuau ont1alto i3iad s2eanmpnt4 lenxo oo1fp r ieo;( t2ur(rpoydlpte iesa() Duaxrpnt4tlto f3ias mDelu s;(0 etnxf iytlm  auvils t2xmxopiu4olt lieias a2urx ooo0aexo f3iysla2umu s (4trenxr ta1laDeli o t)texrxm3nu4lmtemfvtas)sDtmxro;o4aleo ietyt mDemuvsnt)tlerif ty1fpt anvo;t0seurio3oudll nlfvi t a2umxr ;u1ope  ietld aDrmuvsnu)aexrxfciytfpt ai s;t  etr(r ny4ol   fesls)aDrmuro;t0tltn ietatla uan pnu4trxnxr3io1oaDraueol()trurim3io1lptemictls)arrmu pno1aex mociadfaDrlnvo t0 lxnmrcoydoatrlneolt0seto(r oo1alen fvslsfarraxr nt1opxo oetyd m eluvs t)artrmo3iodoa  ln s;s0trtm(opiudomen nvt s)s2urxm oo0olxn iciadfs2el( on() eerxf3iatopDrau o;t0s2xmir3nu4ol emfvi (  rua(m ;u0aleomfctlt sDulnvs (0trtnxociodlm  lnvs ()t2xmio3nodlp   nvi (faDtmxm nu4olxoifetys mDeanmp u4 ltoir3io1optelnes;s)trto(o ny1om  mfciat)aDtrxronu4tptoiociadfaDelnmo;(4 rxomocootlat luvi (0trur(m iy1op  mneil() Duru  no4teeoiiciyt a2rlnmp (4aexomr oodoaDrli i (0 exoxrpnodll  lncs t artm(m nu4aeeo octat a2uluvp;u4alxrio tytfa rli i;( t2xo(m ou4ap emfctas aDtmur ;u0apxn oeilt a2el(vp;()aeeoxo3totoptr ueilt)srxrxo oo4lpe  icsasf Duru p;t0opeomieiydfm2ulu p;u4treomo ta1opt  n o s) ruo(opio4omeelnctasfarrauroot0aet iociytlmDrlnms;t0teermf io1fpD lneo t) etmxmpny1llt  nvs t  Duauro;u4oeeomi3tltlsDraumo t0trxrxr3iydop rai o;( tetm(r3iodlltn ictas)arrru onu0tlt mo3iaslaDeluvs t)texoxo oa1oaDraivs t0t2toxopiu1optn nvtatfa2truro;t0tee mociad s2umumpn(0tetriocootlmDrlivo;t)truoxo3io1ol nlnvtatfsrrr( onu1tpx mf3iat s2uluvo t)artoxr iotlm e uvi;t0 exmiopiudom elfvs (  Duauronu4aetnmictad aDelnvp t)artriocoatfmD  u i;s0t2uoim nydope mivs s sDtmxr oo4aeeoioctltfmDumumonu4texrir3to1om eliei;(0 ruo(opoo1lle  fcia(fsDuaxm ;u0olenmf3tytfs2rlnmpn(4 eeoxf3ty1opD  iesl()setr(o io4opeelfcta() rtrxmpnt0aexniiciydla2ea( s u0aeeomfctotoptelneolt0 eurxr io4lptnliviatf 2raurpnt4oex mi3ilslmDrln s u4trxnxr to1fmtranei ( sexrim oy4oltemnvs ()a2rr(r ;t4oltn i3tls a2uauvp;t4 etoio3iadfpDe ivi;s  rxrxrpny4amte ietl(fsruaxrpou4apxn ictatla2rmums (4 rtoxrcoadlpt li s s)srtrirpiu1ol e fvt s)aDrmxrp;t1tlxoif3tatfa elnmp;()trtrmo oytfp   uvo;s sexo(r3nodalt mnctatf Dur(mpno4tpen ietlslm emn s;u0tlenmfciotoaDrln ol( tetmxr ou1optelnesls) 2tm(rpou4oex ii3tatls2rm( o (0trxoir3oydlpDraivo;t t2xoim no1am emivsltfsrtauro;t4tpxn fetlsfmDem(vp;t)teermo tatlaD an o;t s2toxrpny1lptn ivsa() rum(m oo4olxnii3iys m em(vs;t0tetomr3tydlm   ueolt0s2uoxm io1ll n ics t) Dtr(ro;o0tptnmiciys m2ea(vs u) rxnif tadfm r nvolt0 euoir nu4lmee ictltfs2raxmp;o4tltoio3iyslsDuanmpnu0 rerir3tydfpt aivol( trxoio iy1lltelncta( srum(  nu1alxn feilt m2umn p (0aeeomo3tatfa e i ils) etmxr iodlpeemfeilt artmumoot1olx io3iasls2emumsnu4 leoxf3to1fp  an i () 2um(m3oy1olenlfctlt  Drm( p;t1tle iociadfmDul(vsnt4altnir oytlptr ueolt)t2uoirpiudaltnmivt ()aDum(m oo0tlx mfetatfm elu s u)artnxfcoodfmt  uvs;s0t2xrxr iodlmt lfctl( artr(m oo0aptoiietatlaDemu s;u0tlxnxfcoydlm  luvo;t t2xm(o oydame micil( a2rax ont4apx mfciysfsDra( s;u4aetrmr oydlat  ieo s)sexrxrpoo4lm  livi sf 2rrx pno4tlxo icild s eanvo t4alerifciytlmDran i;t truoir3ny1optnlivtlsfa2rrxr nt1oetn ociyt s raumpn(0arxnircto1op   ies;s texr(opou4lpee nvi () 2umx  nu1aee  oeiydfsDrauvp (0trenmo3iatoat ln i;s0 etm(r3nodap elics s  rtaurpou4oeenmfctytla2ea( p t) ltnmf iotoa elneo ( s2xoxmpoo1lmt lnct () rurx p;u1tlt  i3iysfsDelnmp;u)arxnxf3oa1oaD  i i;t s2uo(o nydam elfvta() 2rmuro;o0aptomieiat aDemumpnt4tlermo3todoa ranvi;s)t2xmirpnu1lmtelivi t)sruauroou1aptomiciyslm emu snt0tlxnxocootfa e uvi s  etmxmpio4lp nlieia(f rta( onu1tpenmietytfa2elumo t0trxoxo3ty1omDr iei t) eum(o iy4lpen fvtlsfsDum( ooo0tlxnmi3iltla2uanmpnu4treomr iotop elu ilt0t2xoxmpiy1oleemfctlt)s2uaxro;o0oltnii3iatla rl( o;u4 rxoio oa1oatran ol(0 2trxo no1lpen fctl()arrmu ooo4olx mocias m rmu s;(0trenmr oodom  aueo;s) 2tm(opny1oltelivt t sDtax  ;o1tpxnmieiysfsDranms t0alenxfciatlaD an o s0 2tm(r3ou4ol e ietl( aDuaxrpnu0tpxo fcilslm2ra(ms (0 etoifciy1opD an s;()trxr(m3oy1omtnmnvtasfartrxmonu1oexnii3tld aDulu s t)altnmf3tadfmDraivo t)srxm(o oy4ap e fvs sfsrum(rono1aeeniociatlm2umumpn() ltoxr ia1fm eanvo;s srtoxmpnu1ome  fvt sfs2tmxmonu0opt  fctadfa ul(vsnu4arxomo ia1fpDe ieils srxrirpou1am   iciasfarumxmpnt4tetoii3iatlsDel(ms;()teeoxf3ty1fp  lnesl() 2xmir no4olt mnesl(f rtmum no0aptomo3iasla2ulnmonu4trxoifcoo1opDelueil( s2uo(o nu4aleelneias s2trx p;o0tlxoioeiadlm2ul(mo;t4aexrxr3oodlptelivs;(0srtrxm3oodalenlicsasfsDra( oou0apeo oeild sDuaums;t)aexoxocoytfpDrluvo t  exmirpiu1lmtnmnct t)s2tax ont4oeen f3ildla ulnvo;()tleoxr3tadoaDrln s;()t2xo(o3oudom nlncil(  2rm( pou0aleomfciysla2emnvp t0tlerxo3ty1lpDeaieslt) 2xrim ny1am e fctatf rur(mooo0tex iiciadfs2eauvp;()alenifctytoaDrln ol( srumxmpiy4lp nmfvslt)s2tm(mp;t4aleoiociysfsDrluvp (0 lenif3oydlmtelies (0t2trxr3oy4ome mncil() rraump;o4alxnif3iyd s2ra(vs;u4teeomo3oy1omt li s (0 exr(o ny1lmee ivia(fa2uaxroou4apt ii3tasls ra( on(4aexnxf oadoaDr ivo (0s2tmxm3iy4lp nmivt t srrr(rpnt1olen octadfsDra(mpnt0trerif ta1fpD ln s;s0t2xmxrpoy4lp   neslt)aDrr(rp;t0alt iietat m rlnvo u)aeeniocoatopDelu s;() euoxrpiy4am emfvt tfsDrmxrono1ope iietlsla2eauvs (0aexomf oy1fmD auvol(0setm(mpiydole  fet t) Drr(rp;t0tptnmfctyt a2emu s;u0texrmo oatfpteai s;s0tetoim nu1ll  mietasfa2tm(  ou4altnmfciytfm elnvon(4tltoio ty1op  aneol()setm(o oodop e nes ()sDtmxroot0aleoifeilt mDrmnvont0texrxo iytom r u o t0sexm(mpiydop n iesatfsDtrxrpnt4opxoiictls mDrauvont4tlxrxrctytoateluvo s)t2tmxrpio4lleelfeil() rumumpnu1olx mi3iad m el(vpnu)tetrirctatfm   nvi;s sexm(opiu1optelnes t)aDtm(rpnu4aeeomoctydfs ea(mpnu0tltoxrcto1fmDrli il( tetrxo nydol e nei t) 2tmuroou0tlen ieild a rm( p;u0aexnifcoy1fm eauvs s0s2xo(m oo4lm   nesasf rtruroou1opxn ietlt sDrlnvo t4 exrio ty1fmt ai ol()teurim3iu1ameemfvtl() 2ur(rpno4oetn o3ild a2eanmo (0arenxfctotlaD  nvs;s0 2xm(r3nu1lmee nctasfsDtax o;t4oex mfciadfs ea(mpnt0arxrxo ootlp  livslt) rtrim3iu1amt  feta() 2trurpot4apxoioctlsfsDeanmonu0 lerxf3totlmDraivi;()truoxo ou4apt micta() Duaxm nu0aet  i3tltfmDrmnvpn(4aleoifcty1op rai o s)trtmirpnydom n nvt t aDur(m ot4aexnmf3iat sDeanvsnt) rtrmr tadop   nvol( s2uoxopoy4om emnei s arta(moot0ole  ietasls elu snu4 lxnif3oytfaDe ieo ()trumio nu4lmt mnciasfs2rax  ;o4oeenifeiys s uln p u4aeerirctydoaDeauvo;(  2tmxo iudopen fetlt sDrmumoot0teeomiciltfaDra(vp u) ltrifcto1fp  livolt t2um(m nodoltnlnvslt)s2uaxr ;t4ole  oeilt m2ulnms;()arxrmoctytomtr uei;s) 2uoim oo1lp emiet t)sDtrxr ou0tlxn i3iltlm rl(vsnt4trerio3oo1lm  luvil()seuoir3nudaltnmfet ()aDtmur ;o4olt ii3tas s2umnmont0 rxrxr3tydfmt  ivo;( texr(opny4op emnetl()aDrr( ont1tee ifeiydla rl(vp (0 ltrxr iy1omt lueils t2xr(m oudlp e ietlt  Drau p;t0olxomo3tldla eluvs;(4tltrir tadfa r uvo;t0 exmxm3oo1am nlivtltf Dtm(m ot4apt  oetldlmDem(vp u4arxrxoctodlatelneo;t  rtoir3iu4olee ivslt)srua( poo1teenmfctltlaDelumsnu4altrio oy1lmtelu slt0s2trxo3ny1ap nmncslt) 2rmu poo0tetn fciydfmDeau pnu0 rxnio3tytlp   uvo;(0 2um(m3oo4omtemictls s2ururpnu0aex  ieild mDrmnmp u0teenxf tydoatrlueil( s2xoirpio1ape  fcs t) 2tm( p;t1aetnifctyt a uan p;(0 exomfcoadlmt luvi;(0texmxm no1lme lfci ()a2um( o;o4olxo icilslsDuluvp;u0texnir oydfm r ieil(0t2toiopiu1lptnlfvtlt srtr(moot4ape iictyt m2eanvo;u)artomo oodoaDran o;(0 rto(m iu4amenmnet s) rrmx  no4apx  f3tas mDelnvo;t)trtnif tytoptrluei t0 exo(o3nu4ome lietas sDurxmono4tpxomo3iyslm2rm(vo;(0 lxnmr ty1lateaueo s)trtrxr oudop  lfvt tfsDur(rpot0aeeomoctysfa umnvs t4trxnir3ta1laDeliei;s0s2xm(rpny4ome lfvil() rumum nt4alxomf3iatls ua(mpnt4 lxomr oa1la rlnvo;t s2uriopoy4lpeemietasfsDrrxm ;o1alxomoeiatlmDelumo ()trtrmr ta1lmDrlnes;(  2toxm3oudom  lfctlt srtrx pnt0tlt  o3iydfaDul(mo u)tltomr tadlmte i i (  rxo(mpou1amte fes sfaDtr(  no0opxo i3iys sDrauvp (4teerio io1fpt ai il( t2uoim iu1al n fet ()a2ta(moou0tpxomicilt a2um(vs;()treomf iadfpDe ivi;() etr(m iu1lm nmictas arrmurpoo4tlt  fcilsla ua(vp;t) exoif tatfate i s;(0teurio3iy4lp   fcsls  2ua(mpno4olx  fctydlsDua(mon(4teeoir3iodlpte nes;t) 2urir iy1opeelfci t)sDtaum ;u1texo ociatfsDulnmo u0texoxf iydlatelneols0 euoxm iy4om  lnvsat sDur(rp;t1tpe  fctyd a2ran s (0tetoxoctodfaD lnvo;t0teurxr iu4om nlncilsfaDtaxro;o0opto f3iyd s2uluvon(0arermocoy1oat lieslt  eurir3iy4amen fesl()a2ra(rooo1apeoifctld s2ulu p (0 exoxrcty1fptr uvols)setmxm io4alte ncils) rrru onu4aex mi3tytls2eanvp (4tltrxfcoatfa   nvs ()srurio oodlpenmivils  2taumont1ole  fctasfm ra( o;(0altnmrciy1optrauvi s)t2xoxm3ou4ope lneia(fsDra(mp;u4opeoioeiad a2ea(vsn(0alxrircty1op  livs;(0seurim3io4ol elietl()a2urxrono4teeniicilsfa2elumsnu)aexnxrciadla raues (  rxrxmpnu4ame  ivtls a2trxrpoo0texn ictldfs2ra(mp ()trxrxocoydfp   ivs ( trxrirpou4ole mietas srua(rono1alxnioeilt m umums u0tlenxo3oatfpD aivo s  rtrxrpny4omtn fvsl( aDra(rooo0oleo oetat s umuvo;(0arerxr ia1fp rli ilt  exmxmpoo4ole  ieia()aDrrxr oo1optomfeiysfa2eanvs t)tetrmr tadfa e u ils) 2urxr3iy1lptn fciat  Drru p;t0opx miciydla2eluvp t0tlxnmfctotfaDelueo;t0 rumir ny1altelfcil()sDur(r ot0olt mfciytfs elnvpn(0tltrxf ootlp eau ils0 etmxmpnodam n fei sf rra(r ou1tltn ietld mDrau p;() exnioctotlm eli i;t  2umio ou1alenlneslt)s2umurpnt1tlxomiciasfsDul( pn() rtomr3iotlpteaueo t)sexr(opiy1am nmnctls)s2rrur ot0tltnioeiytfm raumon(4tlxnir ootom eli s s  exo(m oy4ol e fcia()s2rru o;o0aeen oeiatlm2uan pnt4aeenmr3todom elivs t s2xrim iy4ome lfcias)s2ra(ro;o1apxnmieiat aDumnmonu)arxoir3tadomDeaueo;t)texrxo3iu1lmen ivslt)s2rm( ooo1oltomoctasfmDem( pnu0altoif ia1fat anvs;s  2xrxr ny4lpte fctatfsruru ono1opx  i3ild aDuau p;(0trerio3oytopD an olt)s2urxr ou1apt mnei sfsDtr( ono4opxo ictytlm rl(vpn() etrir oydoptrln s t0trumxopiydom eliesatf rtr(  no0opeomociydfsDem( pnu)treomo3tytoptr i s (0 2xr(o oudolee fcias  rrax p;o4olt mo3tls a2el(mo;(0trtnmr3tytop ran ils0 rtr(opiodlm n fetasf 2tm( ont1alxomociadls2eau on(0tltomo iydlaDrluei (0 euoxopoodalt  feilt aDurxrp;o1aex  feiadlm2rlnmp ()arxoiocoodlpD  nvo;( s2ur(r io4olenmnetlt a2raur ot1tptniocilt a emn pnu4alxnir3tytoateai s;(0 euoio3no1op emnesls s2rrx pou4tee mf3iydfs2uaums (4alenxo tatlp   ieilt0t2tm(r iy4olenlnvils) rraxr nu0texnif3ias mDranmpnt4 reoxf3tydfp   n i;s tetr(mpoodoleelics s  Drm(mp;o4tlenif3tysfm emnvont0teeomo3ty1lpDr nvs s) exrxo3iudope  fcilsfaDtaxr no0tlx iieiadls2elnvpn(0arxomo3tatlmtr uvs;t s2tmxr no4lpen fvs ( srum(r nt0olxo feiaslm2uln o t)alxrmf3oa1oate ueo s  2to(r3no1lmtn ies s aDumum ;t4aeeoii3tlsfm rmnvp u)tlenxr3oy1lp raneils0 rto(m3oodamtnlictatfs2umum oo4opxn fetyslsDrlnvs;()trxrmo3tatfa e nvo s) 2tm(o3ny1aleemies ()a2tr(m nt0olt iiciat a2umnmpnu4 ltrmr3oa1fpt aivs;t0t2xmimpoodomtnlies (f rrmxm ;t4opxomf3tysls2uluvo;u4 etnxr3ootlate i ilt s2um(m oo1ape  nei () rta( pno0aexomoctadls2uau s;u)tlxnxr oa1omDe i il(0trumxr oydope  fes ( a2rmum no1apxo ocias aDelnms ()tltrif oydla  anes s0trtoim3iudopee ncia()arrmum ot4optnio3ils m2el( o t) rxrxr to1oaDelnvs t teum(r ou4apt mnci s)aDtm(mo;t1oet  oetltfs ranmp;t)artoir3oy1fp e i o (0t2xmio nudlpe  fvsltfs2tr( oou4opxnif3iytfa2uluvp;t0texrio oodoaDr ivo;t s2xrio iodaltn nvsa(  2rax p;t0aexnio3iltlm uau o;u)teenmf oatom rlnvslt0trxoim3nu1lmtemnetlt  2rm(mp;o4apt ii3ild m emnmont0alxnmrcta1lm ranes;s teto(r nu4am  mncsl(fsDurxmpot0apeniieiysfa ea(vo (4trxrmrcoytlmDeaueo;s) rxmirpiy4lpenmieil()arua( pnu4tle ioetys s2ulnmon(4aeenio3oatlpD  n sls srurxr ou4ome mnvtatf Drr( o;t1alt mf3iasfaDrluvpnu0teenmf3oytoaDeluei (0texmxr iu4ol nmfetl()arum(r ;o0optoiociytls ul( o;()aeeoxfcoo1lmteauvil(0texr(o3oy4al  lfesl(f rrm(rono1tex miciydla2um(vo (0altrxr iytoatrai o ()sruoirpno1ol nlietatfarrm(mpno1tpxnmoeiys s2el( s;t4trtrxo3ootfpteaivils0 rtmim nu4lptn fci (fa2umur ;u4apenmociytla2ulnmo;t) ltomr3tatomD auesl()s2tm(m oydlme mnetlt) rtmxrooo0tpt  iciydls ulnvo;u) renxr3tatoaDean olt0srxoiopiudop   neiatfartaurpoo0tex moeiys mDua( p t4aeenir ia1lpD  ues;s)s2urxrpio1lmt licia(faDrm(  nu1oex io3iltls eanvp () etrmfcoy1fptraivolt  2tm(rpnu4ameelfes sf Dtrurp;t1aex  ictas sDea(msn()arxoxfctytoa r ieilt sruoim iudop  lfes s sDrmump;o0olto fciat s2ulums;u4texnif3iatomDe uvs t) etrxo3iudalen nesl(f 2tm(moot0tpe ifetytlaDul(vp (0texrmf3iadlm  luvs (  rtrxm io4ll emnetltf 2umxmo;o0aleniociydls2rm(mp;(4artoio iytlp r nvo;t)trtmir3oy1lp e ivi t) Dua(m oo4olxn fciad sDeau sn() rxoxf iydlpt  ieslt)sexr(m iy4al e ivsls srtm(r ot0opxo fetasfsDean onu0trxnxr iadfm elu slt trxoxmpny1omt lfcsat sDtrx pno1tpe io3iytfaDel( o t4trtrxrcta1oatrlivslt  2ur(m nu4opt lfvilt)sDua( pot1apen f3iatlm ranmo u0 exoir3iodlm  ai ilt)texrxo no1lp  mnctas srrr(rpot0texnif3ild s2ulnvp;t)tetoifcoodop e u s;s) rtr(rpnu4llee ncils s2ur(r nu4alx if3tlt a rmn o (4arxrmf3ootoaDranvolt)tetoxrpnudomtnlieilt  Draxmpoo1apeo ieiat mDuanvont) lenmr3tytfmtraueilt)s2tm(o3io4lm   fctat)a2taum oo1apt mf3tadfm2eau p u) rtnio tadfpD au il(0 2xrxr iydop n ies t)arrrxrp;u0tleoio3ilslm ulums t4 eerio3oy1lmtr iei;(0 ruoxr3no4lmenlivs t sDum(mp;o0aleomicild aDrlu pn(0 renmrcia1la  luvil() 2tm(opoudllenlfct tfa2tmumoou4alt iieiat a rl( p;()trtoircto1omDr n s;s0tetoxm3ou1lptnmfvs t aDtax o;t4tleo fciadfmDuanmonu0 eeoirciotlptr n s s) rtmiopoo4ape  nct sfaDraxmp;u1olx  oetldfs2umn o;t4tltrmf tadoat auvsl(  rto(mpny1am  lfesa( aDtm( o;o4oleo iciysfsDuluvon() reriociotfpD ln ol( srtmim3iydol   fvsa(  2tmum ou4tpe mf3taslsDuln p t0aexnxfctodoate ueslt) rxo(o no4lpt mnciltf 2ra( oot1opto ieiyslaDua(vs ()aetrir to1lmD luvils0sexmiopny1lmenlfesat) rurxrpno0oet  ocild s umu onu0arenxo3iatla r nei ()trurxm3nudopenlietl()arur(mpnt4aet mociltls ean o t0 rerxr to1fptr i s;s0seuoimpoy1omtn ictat)artmur ot1tpe mi3ilsfm2um( on(0 lxrif iatomDrlies t0teuo(m oudlpeelivtls)sDrr(moot4tpeomietat s2uluvp;t)trxnxr3io1fpt aivo;t0srxmio io4lmt  ictas) rrmxmo;u0alt mfctlslm uluvon()tlerif iadom rlnes (  euoxr nydoptnmicilsfartmu ont1tpt ifctat s um(msn()texrif3tatlaD  nvo;t)s2toim3iydaltemfeil()arururo;o1tet mfetlslm ea(vo t) eeoio ta1om eaieo;s  2umim3iy1openlicsa(f ruaxroot1tpeoiietltfm2ulump;(4 exrir3io1fmt aneol(  2xmir3ny4am nlnvtls) rrrum nt0ape micias s2ua( snu4trtnmocoadfp   uvo;t0 rtoxm3no4lleemicsat)a2raum no0oeto ieiasfsDrmnvpnt)aetrxrciotfaDrli s ( s2umxo3oy4opte fei tf rtrum ;o1tlt  feildla2rm(vs t4 rtrmfciy1opDe uvs;s)s2tm(mpnydol emivil(fs2tr( ooo1opxnmfeiasfsDuluvs;(0 lenxf tatfpDeaneils)teuo(m io1lp e fvsl( aDrmxrono4tpeo icildla elnvsnu0aexoir oadfpte nvo s seuo(o ou1aptnmfetltfarrmu  ou0tetnmfeiltfmDem(vs t4 renmo ta1oaDe n ol( sexoio oy4oleelfei t) 2tmxrpnt0opto o3ilt mDrmumo;u)artnxf3tatlp  ai i (0 rurir3iy4ap n netl()srtaum ;o1olt  i3tas mDraumo (4aetrif3tadomte ivil(0srxoir iudomt mivs tfa2raur nu1opt iictadfmDum( o u0trtrxf3oodopt  n i;s0texrxmpnydlpeemfct s  2taumoou1aet mfeiysfmDrl(mo u)texomo3oodfa ranvol(  2tmim3ny4lmtelnvsl()sDumum oo0aet moeiltlmDeanvo;t0alxrif ty1fmteluvilt srtr(r iu4op e neilt  Dur(rpnt1opxn fetatfsDuanvo;u4arermocta1lmteluvo;(0 2umirpoo4apt  iviltf Dtm( o;o4teen ociltfaDemuvp t)artoiocoodfm  aueilt0setrxrpou1am e nvslt)sDururpnt0tptnioctyd m rmnvp t0 exrmr3iy1lat livols)sexm(rpiudolen fcsls srua( pot4altoiociadfa el( s (4arerif ia1omt ln o;s  euo(r3ny4amte nci ( s2uax pou4apenioeiaslm emnvp (4 exnmrctytlat aies;( seuo(m3nu1amenmict ()sDtmu o;t1tex ii3iysfa rmu p;() lenif iotfmDrlueslt)t2umiopnodame mfct ( arum(r ou0alt  ieilslm2ulnmo ()treoir3tydopt aieo;t0srto(r3no4ame mivsat a2tm(mo;o4oeen i3tad m ra( ont)trtrxrcia1opDrlneols  eur(m io1omtemfesat)a2urxmp;u4olenmietld mDra(ms;()tlxrio3ia1fa rlu i ( t2toxo3iu4ame mnvias aDumx ono1tptn f3tyd aDuanvs;t)aleoirctydlp r ieo;s0seuo(opnydomtnlnvt sfsDurx  ;u1tetnmoeiydfm2emn p;t) etnxfctotopD luvs t srxrxm3nu1op e fviltfs2rmu oot4aptn fciytfm ranvp;() lermo tydfmte ivols trurimpiy1am elietasf Dumx pno1tpe mi3ils s rmu pnt)alenxrcoy1laDe i s;t  rxoio3ou4ap   ivt sfaDta(  ;t0tpeo feils m rm(mo t0 eenmo3iodopteli ilt)s2xoim3iy1op elfvs ( arumumono1apeoifctysla ul(ms;u4 ltnxf3oydlateau o t0trum(o3oo1ap nmieilt aDtrxmoou4apxn ietyd sDeau snt0 exrxrctotop  aivs;() rtrxr3ny1op n ivslsf rumur no1tpe mo3iasfs2rluvon(4arxoxo tadopDrli sl(0 rxoir3nu1aptnlneil()s2tm(mp;u4tptomieilsfaDemnmonu0texoxr iy1optr ueo t0 2tmxo3iudoptnlies ()sDrrx p;u4aexnmoetyslmDelnvsnt) lxnxr iy1om eai s;s) 2uoxopio1opte fvsasfs2rr( pno1tlx  f3ildla el( on()teeomf3iatfm  au s (  etmxrpnodolt  iciltf Dtm(rooo4alxn ieiysls el( s u4 lxoxr3oy1faDraueo;s  etrirpoo1al   ncils) Dumxrpou0oltoiieiyslsDrlnvs u0trtoifciy1oaD lnvs;()srtmxm no4llt lietlsfsruaumpno1tetoifciatla2el( s t0altnxr oy1la  livo ( s2xo(m3iudopenlnctlt aDrmx  ;o4oeenmoeild sDrau o u4alenxr3iydom  an il() euo(rpoy1amtn fetlt artmump;o1tpx mo3iat mDeauvp t)arxomo iy1oa rlnei s)seuoio3oy4ope livtl()a2uaxro;u0aeenifciyd a um(mp t4artnxo3todfat  nvils t2umimpoydaleelfcsatfsrrm(rpoo4opx  oeilt s ean o u)artoxf tadoa  an o ( teurim iy1lmeelietas)a2urxmont4tltn o3tltfmDelnmp t0aeenmr3ia1lmteln s t0 rxr(o3iydomt livtasfarrr(rpnt0aptomiciatfsDrauvo;u)aetnxr oodlat  nvo;( sexrim3iodop  lici (  2trx p;t0olx ioeiatfa2umnvo;u0altnmrciy1fpD lnvols0 2xo(o nu4ll e fcslsfarraxm no0optomfcilsfs2rl(mo;t4artnmo3io1fatran il()teuo(o oodome  neslt a2um(moot4alxn o3tat s2emnms;t4 ltrxf oadom elnes;s s2trxm oo4lm   fviasfsDuru  ;o4opto i3iat s2emuvp t) etnxocoodlm eau s;t s2ur(mpoy4am n nesl()arumxmonu0aexomictls a2elnvo;u4trerir oa1op  livils  exoxrpoo1amen fetltf 2uau p;u0tleomo3iatla2ra( p;(4altnmrctytfmtrluvolt srxoim3oo4lltelnct t)sDur(m nt1tptomf3tldfs2rl(mont) ltoxf3iotoatrlnvolt0setmxo3iodam  livsat)sDtmxrpou0tet mfetysfm rauvo (4artoxrciodoaDe i i t0s2xm(r3nu1lpe lneiat)srrrum no1tle ifeiadls ulnms;(4aexnmr oy1fateli s s0 rtoio3oy4oltelneiat) Dtmurpnu1teto f3iatfmDrlnvsnt4 etrio oadfmDeauvo t t2urim io1ol emnvil(  2tau  ou1oexn fciadfs ua(vonu4 exoir tydfpteauvi;(0s2to(r no4lp  mfvil(fsDra(  ;t4oee miciasfs2uanmont)texnmf iytfmtelnei;t0seto(m ny4ll  mnct ()srraxmpnt4oex  ieiadlaDul(msn() lxnxf tadlmtrlueslt0t2tm(opny1amt  fesa( aDrru pno4altomi3ilt a eln p (0 rtnif totom elueslt) eumxmpou1op emfet t  rrmu pot4opt  ictatfsDrl(vs u0alerxf iodfat  nei t0trtmxopiu1opte ieiat) rtr(  ;o1alxo oeils sDelu s;u)trxnmf tytop raueil(  rumirpno1lmt lics () 2umxmoot1aptomocils sDea(vp;u0 exomr iotfmte ueo;s)srtm(o3iudomeelfct sf Dtaumont4aee  f3tat s2rm(mpn(4 etoxrcoa1op  ai ilt)t2toxo3nu1ol nlnci t)s2tmxmpoo4tlt miciltfmDua( on(0 leomo iadlm r neols setr(r3ny1alt mfcilt  rumxro;t1aet mo3ias a2ra(mpn(0 exrif3tadom rlnei;t  2umxo nydaltnlfvias srrax  ;u0opt  f3iatlaDelnmsn(4aetrmfcta1laDeanvi;t  2umxr oydlm nmictl()aDurxmonu0olx  o3iadlsDean p t4texrxrcoodfp  auvi (  rumxr ny4om elici tfsDtmum ou1oet ii3tad mDeaumo;(0tetrxr3io1omD an o (0 etrirpnydalt mivta( sDtm(mo;t0apx mo3tad m2rmn p t0aexoxr3iytlmtr iei (0srxmir3ny4ome  fei sfsrra(mooo4olx iociytla rlnvsnu) renmf iadfateln ol() exr(m3oo4apeemneilsfa2trumooo0ole  iciyd a elumsn(0aexrxf3to1lm   ivi s s2ur(r nodlmeelfvia(  rrmump;u0aet  ociat m2rln o;() eeoxr oy1la   ies;(0setoxm3no1oltn fvslt) ruax pot0tltniiciysfa2ulumo t4 exomr oodfmD  i o;s0s2xr(mpoo4al elieias)a2trx pot0tlenmoctlt s2emnvpnu0altrxocootopte i s;t0trurxr ou4am  lfvia(  2umum nu1olxnii3iadfaDul( p;(0arermr3tadfm rlnei s0trtoxm3nu1al emnetas a2um( o;u1oexo oetldfm ulnvo u)tlxrircio1lm eau s t seur(rpiu1op   nesa( sDurx onu0teenifeias aDrm( pnt)tetnio oatlptrlivi t  eumir ny1omt mivtlsfs2trxmo;t0oetn i3iysla2ulu pnu4trxomfciotomDe ieo s0 2umio iydalt mneslt  2raum ou1optn ictyt aDea(vsnu)tlxrxociatoptrli i s  2xm(mpoudol e nesl()srumurooo4tlt ioeiys a eluvo;(4 rxrif3iotomDrau i;t0texr(mpiu4lmtnmncs (fs2umxrp;t0ale  ieias m2elnvp u)tlxnio iy1lmDelueolt0 rxoxopoo1amtemiesat)srtrum ;t1alx mi3tltlmDuan s;t4 lenmo to1om eli o;s0 rtrir3nudop n iesltf rta(m ;t0ope mi3iatlaDuanvs ()arxnmo oadopDraues;( trxoir iy4lmt lncias)a2rruront0teenmf3tlt m2emumpnt4 renir3oo1omt luvsl()s2xm(o oydll elnvi (farua(rpnu1oet ioetlt a2rmu on(0 rtomo3oadfaDe uvo;t)trxoim oo1llte fcil( a2um(mooo0tlenmi3ildfa rluvont0 ltnir3totoaDe uei t0srtmxo3iy1op   neta()aruaxmoot0tpt  i3ildfs2raumpnu4 eeoxo oo1omt  neils s2toxo3oy4opte nes t) rur(m ot4teeniociasla ranvsnt)tltoxr iytlmDelieo t)seurir oy1altnmfvta( sDtrum ot4alxomociydla rl( s (0tlerif3oo1lp rau i;( sexrxo3oudol nmfvils  rrru pnt0tlenmociatfsDrm( o u) etoxr3ia1lptran ol()teuriopoo4al  mneiat)srum(mpno1tpxo fctydfm2eaump t0 ltoxocia1op eai i;s  rxoxmpno4op n fetl()s2raxr ;u1aeen f3iys a2rmu s;(0tetomo3iodfaDe n i t setoxr oodap  lfcsl( aDraumpnu1aeenifcilsfs ranmsnu0tlxnif oatlpDe ivo;( setoxm3oydop n nvta()srtr(mooo1apxn fcildfsDrau s t4tlxomfctodlmD au o;t  etmio iydap   ivsa(  2rrxr oo1aexomieildlm ua( onu0 rxrifctotlmtr ivslt0 etmim nodoptnlieta() Duau o;o0altnifeildlsDeluvpnu)tetnmociodlmDr u sl()seto(opoy1lpeelnes s sDtaxr oo1oex iietaslmDua(vo;()aleoxf3oytfpt  ieol(0sexr(rpoudope lfct sfsDumumooo4aeenioetyslaDrl( pn(0tlxrmf io1fm rlnei;s)truo(r3oy1al nlnvtls  Dtaxmont4oltnmietydlm umump (0trxrifcia1omDrlnei t0 rtrxrpnu4op elnvilt  rtmxmpnu1aetniictyslm rln pnu0 lxoxfctatfateau s s0t2toim3no1altnmfeslt) rrr(mpou0apt  i3ild aDrlnvsnt4 ltnmfctodoaDeanei ()srxo(m3io4ameemivsasfa2rmx oot1tltniietydfa2ulumo;(0aetnmf3tytfat anvilt)s2xr(m3no4op n fcsa( a2umur nt1tle mfciydls ranvonu4 leriocoodfaDrli ilt)setr(opiy1aleeliciasfsDtrxr nu1aee  o3iydla2ea(vp t0altnioctodfatrlu o;(0 etmxrpio1omtelietls  Dtmurooo4oeto fciytlm2uluvs t4arxomr3tydfaDr ivs s0t2urxr3oy1ll emneilt  2ta(  nu4aexo octysla2ra(vo;()arxrxr oa1lmt li s;t tetrxo3iodap nmieil()srrrx pno1alto ociytfaDeaums t4 ltnif oydfm   ues;s  euo(o3nodlme  nvta( s2taumpou0olx  f3iyslsDuan p;(4alxnxo3iytopD auei;s0teurxo3iydap emieia( arra(moot1tleo ociyd s2eanmon()altnmoctytop r nvi;s srtmxmpou4lle lfvtlt) rraxront1texoioeild m2rlu p u)trxrxocia1lpDe nes;s)trtmirpny1amenlieil( artru oou4altoii3ildlsDuanms t0alxrir oo1lmt  uvslt0tetmim3ny4ol elfcs () rraxrpoo0alen i3iatfmDul(vpn(0 etnif oytop r ieo;t  rxo(rpiy4amtelivslt artrxm ot0tee iiciadfs2uan on() lxnmocoatoa e n i;s)t2umio oo1lpeelietat) 2uru oou0tex miciad s2eanvsnu0trxrmrcoadlmDe neil( trurir3iu1alt mfci sfs2tmumo;t0olx  i3iltfs raump t0trenxrctydlpDrli s t)srtoir ou1ap  lnvs tf rtau poo0tpto f3iadlmDrl(mp u) lxrxf oytoatrlies s  etoiopio1amtemfvsas s2ta(r ;u0ale iieils m ulu sn(4alxnxf3tatlpt ln o;t trxr(o3nu4ope lnvtlt)srrr( p;t4tet io3iysfsDua( o;(0areoxrcoadlaDe ueo t0s2tm(rpou4opt  iciat) ruaxront1tlx moctltlsDrauvo u4treomrcoodfa r nvi;s s2umirpoy1lp elfcsat)srtmump;o1tltn ociat m ranvs t0tetomo iatlmD liei;t  eur(r nodap  mnvt t aruru oot4aexomoetadfmDrl(vs;t) rtnxrciadla  li ils) 2xrxm3oy1ameelivils)aDtrx poo1olxn ociydla2ranms t4tetrmr3ty1oateau sl(0trxrxmpno4lme mfvtltf rrrurpno4oeto ociatlm ranvs;(4arxnmr ty1fpD  n sls) 2trxo3no1op   feslt arrmumo;o4tleomieiytfa el(mp;u4alxnxrcio1fa   ueo () etm(opiodopt miciat s2rm(ro;o4texn i3ild a uanmo ()tltoxrctytlpt ln s t sruoxm3oy4ole  fct t)sDtm(rono0tpxomfctat s eanvo;()tltnmf3io1lmt auvsls)texmiopoodllenmiesl(fa2ua(  ;u0opxnio3tydlsDelumpnu)trxrmoctotop e ivilt) 2xriopoodol e ivt ()arra(  ;o4olxnmfeias m elnvo;t0aexnmfciodoaD  n ol(0trto(m oydllteliet t) Duaxmoot4alenmictltfsDuan o;t0trerxr iytomtrlneo s  2xmim iy4ap  lnvi () rtru  ;o1oetoifeildla2ul(ms ()tlxrircoy1laDraueo;( t2uo(o no1olen iviasfsDum( oou0tpxn ociatfsDemuvs u)trxrmo ootlmD  n sls)t2xrxr oo4ol   neta( sDra(rp;u4alx ifetaslaDulnvo ()areoio iotfatr u o;s trxm(m oodlltnmfciltfs2urx  ;u4oee  ietatfsDul( p u)tlxrxr3totfaDeauvslt0 2xrio3nudll nlictatfarrrurono4ale  o3iytfa emnvo;()areoioctadopD  n o s teurim no4amenlnviasfs2raumpoo1olto ietydfm2um(ms (0tlxrio oodfp rauvs (  etmxr nu1olt  ncsatfsDrmxmooo4oexn ictldfmDrmums u0tlenirctadlm ean o;t)s2xrim3oodol   ict s)sDtm( oot1oltn fcilslm2uaumo (0trenifciotom eauvil()sruo(mpno4ol  mivilt  rumxrp;u1tet mo3iysfmDem( sn(4 etnmrcoydfpD  ies;s  2uo(r oydam emfetlt a2uax pot4ole  ociadfa2eanvp () reomo3iydlmD aivo;s0t2uo(r nodlmeemnei ( arrm(  oo0olxo oeiat a2rlu on(4tlermo iatlaDeauei;s0s2trio nydape livtls  2raum nu1apxnii3iys aDuluvo;t)trtrio3oodfatran sls) eum(rpno4lmeemfesas  Durx  ou4tlxn o3ilt mDemuvp u) rxnmr oy1oatelnvs s0 2xoxrpnu1op e fvil()arum(r ot4apxn oeiatfsDum(vpnu0aeenmo3ta1oatraneo s) exmio3iydamtelfct ( aruaxrp;o4oeenmo3iydfaDrm(mo u4tlxrxf oy1omtrlu s;( t2uriopnudlltnlneia( a2rm( o;t1tptoio3iyd s umnmp u)arxoif3ia1fa raueil(0texmim oodolee fcsa(faDrr(  ;u1alt ii3ildfa ra( p;t)tlermr ta1omteluvolt t2uriopiy4am e neia(faruax ooo0oleoiociytfsDemnmp;u0texnio3tadfm  lieo;() euoim3iy1omenlnvilt srrr(mont1opxnmoeiltfs elu ont0 rermf3tydfm  aivslt) rxoxrpoo1amee nesl(  2uax oou1tpe miciyslm raump (4 rxnir oy1fpDr u i;s0 rtmxr3iydlmeemivi ( arraurp;t1olx mi3iasls2rmumsn(4tetrmf ty1fpteaivi;t  exr(opnodaltnlfctlt sDtm(r ;u0tlxnio3iydls raumsnu)trermf oydlat  u o;s  rxmim oodole lnesat  Dtrxm ou4tpeomoctyslmDua( s;u0 rtnmo3oytlaDr u ilt  2xoio oy1lmte fetlt)s2tr(moot0oee  fctltfa2ean s;t4 etoxo3oa1fptranvil( srxmxr iodoltn fesa(fs2tru  no1alenmictaslaDum(mp ()arxnxfcootfpD li ils  2tr(r ou4ame mfvslt a2taxmo;t1ole mo3iltfaDum(ms;u4artoircootop rlueo s0texr(mpou4oltn fcil(fsrtaxmono4oetoio3iydlm uan p t0 lermrciotfmt  ivs;()t2uoxopiy1ameelneiat a2umum nu0tetomoctaslm2uln o;u)aetnif tadlaDrluei;()s2umim3nodlm  lfesatf rrm(r nt4tptnmociyslm ranmon()aeerxr3iotom  lu il( teumxr ou1lmtemfci (fsDtrx p;u0tltnif3iaslmDua( ont)trtoxrcty1op  aneil() 2xrim ny1ol   neta(f 2rr(rpnu1apxomfetlslm ra( ont0aeermo oadfp  luvo;()seumio3no1aleelfvia()s2um(ro;t0ole  feildls2uluvsnu4alxnxr3ty1lm   uvi;s0trxo(o3ou1ale  nesl( aDuru  nu1tpx  iciydfs ul(vpnt0artnmfctadomDrlnvi t)t2xoir nudaltelictl( sDurxr nu0alen ictydfmDrm(vo t0 reoxfciodlpDr n o t)texmiopiy4am  mivtasfa2ta(mont0alt moctyd m rmnvo () reoxf iydfmDe ueslt  rxmio iy1lmtn nvslt) 2umurpnu1altn oetyd mDrln p;t0 renmf oa1oa e neo;t0s2umxopno4op  lnciat aDua(m ;o4tptnii3iys m2rmuvon(0arxrxo3ta1lmtrli ols) etoir3no1lpeelivslsfsruaurp;t4tlxn iciysls eln o;t) leomf3oy1op eaivo s sruo(o nudalenlncias)aDua(r ou4oexo oeiydfs eanms ()aexoxfcta1op e ivi;( trumio nu1lm e fcsatf ruax o;o0oee mfctydlmDuaums u0alxnxr iy1faD auvsls)s2xoim3ny1lp  lncils  rtax pou4aexoiiciasfa umnmsnu)texomr oadoaDeauesl()setoio3nodolt lfct (f Draxm ;u0apx mf3tat m2um(vs u4aetrxf3oytoa r ieolt0srxr(rpio4lm elnctat  2rau ont1alt mi3tydfsDuln snu4texrio3iadlmteanvil() eumxo iy1optn ics s)arumu ono4tpxoio3ildfa emn ont0 eenifcio1fmte nvolt)teumxo io1ap n nctas)a2raumpno4aexomi3tydfa2elnmo;u0 reniocoodfp rauvi ( t2tmxr3iodol elfvtls  rtmx  nt0tpenmoetldfs2emn o () exoio tytlat lieil( t2tm(r no4am  mfet (  rumxm ot4apen ociysfs rauvpnt)teenxo3oodlm e i s;t) 2uoxopoydomen ivtas aDumumpnt0oeenmi3tydlaDul(mpn()tlxoif3ootom eluvo;s srxr(r3io4ome lfcsat)srtr(rpoo0olxnif3ildlm uluvo;(4aetoxociydlaD au ils0s2xoxo3iy4ap emfesls) Drru  ot4opeomi3tlsfsDrmn p () ltrxr iytlmtelnvs;s) exr(rpnodap  licil( srrrxr oo1tpt  oeiadla rmumsnu4arenif3ia1lm eaneo t) rurxrpiy4lltnmneil(faDrm(rp;u4teeomociydla2ua(vo (0 rxoxfcoodfmt luvsls0 rxoir3oudop   ncs (fs2urxm ;t0aexomfctys mDrluvs ()arxnmf3todoa  lneo ( trxrxrpiu1ameelnciltfsDtmxmoou0apxnifetatla ea(vp (4tlxnxf3oytlaDr n ils0teurir3oo1om elivslsfaDtm(mo;o0aexn i3iatfs emnvp (4artnio3oatoate i o;s)sexrir3iydlmtnlfeiasf rtmur oo4teeniietysfsDeluvs t4trxoxrcto1omDr ues;s setrxopoo4omen fes ( sDraum nt0tetomo3ilt m2emu snt0trtrxfciydla e n o s sexrxr oy1ll nmivt s)arta(roou0tpe ioctlsfm2uanms;u4tltnio3oytlm rauei;(0 rxmxo3iudam  lfetl(fsrtrxmooo4aet ii3iys aDrauvp t4trxnif oadfmt  i s;t)s2tmxo3no4op  mnci ()s2rmumoot4tpx miciadlmDrmu ont4tltrmo3ia1la rlneo;t0s2xmxo3ou4optn fei s) 2ta(  no4aee  o3ils mDuaumsn(0 lxrmr io1lp raivsls trtoio oy4amen fct sf 2tm(rpnt1ape mictlsfm2ul(mon()aetrirciy1lpD au s t) rurir nudol   ncils  2ta(mpno0olx mi3iydlmDua(vp;() eeomr iadfaDe ies;t srxriopny1optelfeiatfarrrurpou4ape if3tatfs2ean on(4 reomrcoydla r n s;t0teuo(rpnu4lpenmfvi tf Dra(mooo1aex  i3iaslaDelnms u4 reoxo oadlpDe ueo s trxoim3oo4amt  fvtas aDta(mo;u1teto fciatfs ean p;u4 ltnxf3oatomD ln olt)sruoim nu4om emictlsfsDtrxrpot4aptnmieias m2elums t)teenif3oa1lp r ues;s) 2trir3oydlmtnlfvt tfs2ururono4oet  f3iasfa2umnvs;()tlxrir oodoaDe ues s0 2xoxopio1op elieiltfaDtmxrono1teenio3tldfs2elnmo u0trxoif3iydlmDrlivi;s) etrxrpoo4lm   fci s  Drruronu1tltomieiydfs2ra(mp t) eeomociatfa eli i t)seuo(r3ny1ape lnci tf 2ua(  no1tee  oetatfa2ea( pnu)trtnmrcio1lat aneol()truoxmpnydaptemicta(fs2tru  no1tlto o3ilsla2rlu p;t)tleoir3todomDeliei t  rtm(rpoydamt lnesat aDtaxmpoo4apenmf3iysls rlums;()alxoxr3tatopD auvs;( s2umxr oy1lle mnei tf rrmuro;o1olxn oetatfsDuanvs ()trtnmo3ootopDeai slt  2xo(r3oy1lmt micslt) rtrxront4opeomictytlm rmn s () rxnxr3oo1lmt anvi ()setr(mpnu1aptemicsasf 2tr( poo4opxomf3iysfmDeaumo t4altnmfcoydoaD  neo;t)sexrxmpoydoptnmfcs t  Dra(  ou1ale  f3ildfa2elu ont)aetomf3to1fat li o ( trtrxmpou1llt  fcsa( srta(r nu1tpe mocildfm2rmn sn(4aexoif iy1oaDrlnvo (0 euo(o iu1am e ieia(  Drrumono4oet iociltlmDrl(mont4 rxoxocto1fp rln i;s)s2xmxr3io1apt  ivt sfaDrrumo;o4teen f3iltfmDumnmpnu0texoxr io1lm  li s () ruo(mpoudlm emnesasfs2uau o;u0oex iietltlsDuau s t) exnxfcoo1omteaues t  2urim3iu1omen nvtasf rra(r ot4aptomfeiadla eln o u0 ltomo oatom  anvs (0trumxo iudlptn nct (  Dta(  no1tlxn o3iadla rl( ont)tlerxr3ta1laD  ivs s) ruo(opnudameemnctasfs2umum no4texniiciytlmDuau o;(0aetrmr3oydopDeanei t  rtm(r3oodll emfet ()sDtmu o;u1apx mieiyt m uluvpnu4 ltrmr ta1opD  uvols t2xm(o3no1lp elfcs ( sDum(m nu0teeomo3iytls2rl(vs (4 rxrmf3io1fa rai ol(0tetmxmpoy1alte fcils)a2rr( pou1ape  iciydla2ran o t4 etomr3oodlm   ueo s)t2urio iu4lmeelnvil( srrm(moou0optoiiciatfaDeln p t4tlxoxf3to1omte ieils0 ruo(r3ou1olen nct tfsrur(m nu1aee ifctydfaDeau onu0trxomr3totfp rau s;t0s2ur(opno1lmeemfvt ()a2taur nu0opxomietasfm umnmpnt0texoxrcia1fat  nvi;t sexm(m3oy4oleelfvt t)sDrmu poo1aexn oetys a uaump (4trerio iadoa e u i s0 exo(m3iu1opee ncslsfsrur(  oo4aetnmictas m ra( p t4 etrmrcia1fp rauei s0t2tr(m3nu1amtnlnct (farurxr ot4oetnifeils aDra(mp;u0tetrmrciatfpDe nvsl(0seuoirpoydllen icslt  Dtmx p;t1aeto i3iadlsDum( p (4arxoifcootoaDelueo t)srur(rpiu4op  lfvsasfarrmur ;o4tpt  i3iat aDrlnmo ()aexomo to1la r ieilt)trurio3nudam n iviat)s2rmumono4tex mi3ias aDua( p t0trxnmr iydfm raivi t0s2urxr io4om nmfetls)aDtrxm nu0olt mfciys m emu o (4aexoxo ty1fpDeauvo ( s2trxm3iudlpt  nvi t)aDrru pnu1teenmiciasfsDum(vp;u4tlermf iotlmteanes ( setoio3oo1amtnlfvs sfaDtrum ;o0tee mietldlm2rm(ms u) exomf3tytfa   uvslt) rxo(r iu1lpeemfct t aDrm(rp;u4apeo ocilt s uan p ()aexoio3oytlpDrli o (0srxr(o iu1omenmics ( aruaump;o0aptnifeiyt a ulumpnt) eenmf iadoptr i i;t0s2xoxo iydllt mnct ()sDrmxmpnu1tlxo oeiltla ulnvs (4 rxrio tadfpDeauvi;s  exrio3oo1op   ivslt sDumu onu1tee mi3iadfm2uanvsnu4alxoxoctytom  lnei;(0t2tmxr3iu1lmt  fvi t srtrumo;u4tpeniieiltlaDemnvo (0tlxnxf to1oatrlu olt)trtmir3oodam  lncsa( aDtmuroot1aptomfctyd s2em(mp;u0texrxocoydfpDr ues s) 2toxr3nu4olen fes () rrrx  ou4oltn o3iltlm rmn o (4trtoif3oadoate ivsls0srur(r3nudol nlfvtat  2umurpoo4apxnio3ildlaDulump (0trxnio oodlpDr uvo;s  rxr(o oydolt mnci t sDur(m ;o4tex ii3iadls emn s;(0 lxomrcoydomtelnvs;t)trtr(rpnodllenmnetasfs2raurp;u0aptnmfctydfa2umu snu4aexnxf3iadfp  luvsls)srxmimpou1al  mnetlsf 2rr(rpou0tleomoeiysla ua(mo u0arxnmf tadomt anvo s s2uo(mpiodomeemies t)sDum(ro;u0ape  i3tyd aDra(mont)aetrir3iydomtelivi;s0sruo(o3nu1lmee fcsas  rtmxr ou0tpe  ociysfaDeau o (0trerxr3iy1faDe ivo;t0 rur(o3no4omt mivtls)artrurp;u4aex mictatlm2rauvs;t0 leoxf3todomte neil() exm(o oydlpt  ncilsfsDrmu ont1aee  f3iat mDemuvont4alxrxr tytfa ean i s)srtmirpou1optnlivi tf Dtaur ou1olxnifeilsls eaums t4aexnmfcootfpt  uei (0t2uoxr ou4lm   ietltfarrrumono4apx moetaslm2ulnmpn(4 etnxociydfp  anei;t sexrxopio1opeemncsat  rrm(r nt0tpxnmoetat s raums;u0trxrxf iy1fp e i o;s) 2urxopiodaltnlncsl()sDtm(ro;t0oexnmo3iltls uluvo u4 rxoif3to1fatrlu s ()srtoimpoydam  livsl(fs2tax oot4teeomi
\ No newline at end of file
@@ -0,0 +1 @@
+ies;t) etrxopnydalenmivsat)a2tmxrpou4alxoifctad a2emuvsnt)arermrctytlm r ivs s trxmxm iy4ll   fcs tfa2uau pnt0oltn o3ilt aDum(vsnu4 exnio oatlat ai o s)s2tmxo3nudlltnmici () rta(mono4tlt mictytlsDrmnvo t) rxrmf tydfaD aiei;(  2xo(rpoy1llt  ivta( aDrr(rpno1aptnif3iadfs2ran on(4 rxoxr3iodomt  u olt0 rxoiopnodol emiei tf rraxrooo0oeeo iciys s2umuvp;t)tlenxr iy1faD lieo;s)s2um(rpnu1lpen ivs sfsrra(roou0tpxoifeiat s2eau snu) lenxr3iydlp  an i;( trtmxm ou1omenlncilt s2tmxro;t4teenioeias aDrluvp;(4 eeomr3iodfm   ueslt) etoxm nodom emfvilt  2taxmpot1aeenmfciyt mDul(mp t4tlerir3ty1omteanes (  euo(mpnu4op emnct t srur(r ot4apx miciytlm em(vp (4 rerxf3to1fp r nvilt)t2xoxo3oo1aleemfvtlt) rtr(mo;u0oexo ocias m2emnvonu4arermociadfmD  i i t  etrim3iy4lp  mncsl()a2tr( p;t1tpe  feilt m eauvp;u0teerxfcoo1fat lueil()s2toxm iudale lfeilt) 2umxr nt4oeen fctadfmDrmuvo;(4 ltoio3oodfpte n i;t) exo(mpiudole mfviat  Drm( pno4ape ii3iatfs2raumon(0 lerxr to1lm rai s ()t2triopiu1llt lictltfs2tm(rooo4oltnmo3tadla rlump;t)tltrmf oatlatelnvil() rxr(opiy4ap emivs tfaruaxmpno4optnmicild sDumu o t4 rtnxrciytopt  n s;s0srtrir ny1lmtelfeilt) Dtr(ronu1alt ioeiadlsDul(ms;(0tleriocoa1fmD  n i;(0srxmim3iy1lpe  iciasf 2uaxm no4teeo ieils sDem(mp u)aeeomfciy1om e u s t)setmirpoodlme lfvta( arurur nt1texnif3iyd a elnvs t0alxrxf iatlpt liei;()s2xoirpoo1apenlnvs (  Draumpot4oetnmfeiyt m2eanvpnt0 leoif3oytlmD auesl()t2toxopno1apt  ics (fs2rmx  nt1tetnii3iasfs2umnms u4artnxrcoy1fp rauvo ()trxrxopiodol n nci tfarrmxrono0oet moeiltls rlu pn(4alxoxo ty1oateau i ( s2xrxm3oodapt lfcil(f ruaxmono1tpe mociadfaDeanmp u4aetoio tadfp  livo;s)tetr(m oy4omenmictasfaDrrum ;o0opto f3tldfa rmn snu0 etrif iydfaD  uei;s) 2umxmpnodlmee fvi t s2uau  ;t1tlt mi3ildlaDrmumpn()altrifciydlpDelivolt0s2toxm3ny4ol e fcta( artrxmo;u0oexomoctysfmDulnvo;(0altoxrcoy1omt ai ols0 eumxopnydole mfvi t)artr(r ;o1tpeoifetyd sDrl( s u0arxomrctodla raneils0sexmxopiy1amtnlictls)aDrau  oo1oee mfciytlmDra(mpn(0 eeoxociadopDraueo;(0 etrxo3io4olte nviat)sDrr(rpno0tee  ieiaslm um( s t)trenir iytopt anvslt0 2xmirpiu4lpenmicsltfaDrrxrp;o0aptnioctadls2elump u4texriocto1opDrau o;( trtrxm iodomenmncs s sDtmumont1oetomf3ilslsDua(vp;t0trtomf iotla rlnvils0sexmxr3oy1lptn ivt t)aDrrxm ou0tptoioetyt a rm( o;t4 renif iytomt aivs s teuo(r nodlp  mivsls)srur(  ;t4opt moetldfaDea(vs t4arxomrctytlm  luvs s)teuo(m ou1ameemivt s arrmumo;t4ape miciyd a2em( p (4texnir3oy1fp elu s;s)texoxrpio1lle  nct t)sDtr(m nu4oeeomf3iysfaDea(vo u4tetoxr iotlp  luesls)t2tmxo nydale mnci t srrrumont1alxnmieiys m rau s;t0alerxf totfmteauvs s srxoirpny4optnmivias s2umum ;t1altn oeias m2ranvo;u0 lxnxrciytfp   n ilt) exr(r3oy1oltn nes sfsrrrum ;u1olenii3tldfmDrlnvs ()tlenmo oy1fp  an i;() etm(r io4aptn fei s)aruaxro;o4tpeo ieild sDuluvpnt)arerif3iatoaDelnvslt)sexr(o nu4lp nlnvsas  Duaxmpoo1olxoiicild m2um( on(4 ltomocto1opD an sls0 exm(r oy4ol  mnei s  Dumur no1ape iicildfm2rm(mp;t)aexnir iytoa ran ils srum(mpoy4lpenmfct () Dururooo4olxnmoetysla2rl(vsnu0trxrio3oo1oatrlnei;() 2tr(r oo4ap elnvias)arrmx ooo0texniiciydlm2rl(ms t4 etomf3iy1op eanvols srtmxmpny1lm n netltfarua(mpnu0oex miciadfmDrl(vp t)alerifciodfa eai o;t) rum(opiydomt  fei tf rra(m oo1tlt mfeils m rlnvsnt)aeeoxf3iydlp  aieo ( t2umxopnudome  nctat arrrurpnt1tet  ociltfs2ulnmp;(4 ltnmo3iydfat auvi;t0t2urxm iy4oltnmfctl( aDtmu  ;u1ale ifeiyd mDuan p;(4tleniociatom elneo ( srumirpou1om elics t s2ur(mono4oex mi3tysla2uln pn()aexnif3iydfptr nei s)seuoio iu4am e ieias)aDrrx pno4tee  ieiasla2rl(mo;u4areoir3oa1oaDr ueo s trxr(r3iodal  lfcs t)a2umur ;t1olt micils m elnvpnu4trtrif iotfpte ues;s) rurirpiudlmtn ivt () ruaxrp;o1aexoio3tas a2ulu p;u4 lxrir3iatoaD aivi;s) 2toxopiu4omtelfvtlt s2rm( ono1oleoiieiadlsDrmnmo;u4arerxocta1oat lueolt srtm(m3oy4olt mnvslt) 2tr(rpoo0tet mi3ild aDemumo;t)aetrmo3oydlmDr i slt  2trxr3nodam   ieilt  Draum ot1aexomieiys s em( p (0aetrxo oa1omteau ols t2xmxmpiy1lpe licilsfs2rrx ono4tlx moctadfm rm(monu)artnmf tydlp   ues;( srtoxrpnu1lltelncia(fsrrrx o;t1olx mo3tld a ua(mp;u4aeeoir3ta1omDe nvo s0t2toim3oydolee nesl() 2urumono0tltomf3ildlaDeanvo;(0treoio iadoaDr ivs;()setm(o oy4olenlncsatfsrtrurp;u4oexoioeildlmDemuvsn(0 ltrmo iatlp elu ilt  2toxrpno1ole lncil()s2uaumoou0oeen ieiadfm umuvsnt0trtnif ootlm e uvo;s s2tr(o nydalt lfeiat srumum no4tlxnioetatlmDea(mpn(4 lenmf tadfaDran s;s)s2umxopoo1olte fcs s)s2ur(mo;u1oltoifctls m rlu o;t) eenxr3iadopt  n il() 2ur(rpiu4olt mici (fa2rmxm ou4ape miciys a ulnmo;u4tlxrmoctatopDelu o;(0trtoir3iydap   ieias)aDum( o;u4tle  i3iadfs2eaums;t4trtnmf todoptrluvs ( t2urirpoo4lmtemivtls  Duax pou1aeen o3tasls2uauvsnu)trtrircio1lptr nes ( s2xmxo io1olt mfvta(  Dtmur ;u1apenifeiadla2ul( p t)trxomoctotoate ueol(0 euoxrpoy4ol nlnct sfs2taxr ot0apenifciltfsDrm( on(4alxoiocootlmD  i s s0s2xr(mpiu1al elncsat) rtmuro;u4alt  oeiatls eaumo;t)trermr3totlate n s s  eurir ou4lpt  ivtls) 2urum oo0tpenmfctltfmDranvp t0 exnifcoa1lpDranei ()s2trxm3iu4ll nmnvi (  2umx  nu0olenioeilsfa2eaumo;(4 lxoif3oa1omtr i il()texmxmpnudape mnvtasfaDta(m ;o0teeo o3iyt sDum(vo;u)tleoxf ta1fmDeaivs ( setmimpio1am e ncslt srtrxm no4aleoii3ilsfm2emuvo t0aleoxo tatfpD  nvilt s2xoim3iu4op nmfetat s2ta( p;u0optn ocias s umnmsn(0alxniocoa1fm eaueo;t s2xoxo3iudlmenmnctas  Duaump;u0openifciydfmDem( o (4trermo3oytoa ranvi ()trtmxrpoudlltnmfes ()aDumx  nt4opt mociatlaDran snu)tlxrif3oatla r u s s)trtrxrpnu4al emietls) 2ur(mont1tltnmoctadla rlnvpnt) exnir3io1oatrlieo ()trtr(m io4lmtnmiviat s2rauroou1alt mieiytls uaumo;t)treoir3todlatrauvo;( teurxo io4lp emfes s  rrm(rp;o4apenii3iat m umnmsnt0tltnifcty1fmt  ies;s0sexrio3iudlle  nvt t  rur( p;u4ole ifcils mDea(vo;t0 ltnmr3tydoa e uvsls0s2urxrpiu4alt mfvs tfaDra(m oo0opeoii3tatfa el( p;u4 lxnmr3iotomDeai o s)s2umxopou1opee ncs (fs2tmxm ot4olxn iciydfaDeauvp;u4aleoir3iatoaD liei s) rto(r ny4lme  ncslsfsDra(r ;o4alto o3tlslsDrluvo u) rtnxo oa1lmDeluvs;t)seurxr3oodopenmietasfsrurx pno1opxniietldfm rlumpn(4 exrir3tatfp   u o t0 rxrxr3oo1opte fct ()aDrmuro;o0oexomieiatlmDrmnvo u0 lxnio3tydoa  lnvs (0 2um(r3iy4lmt lfesa()s2umxmp;o0tpt  ietlsfaDem(vs;(4 rxrxr3ia1fmDeaneilt0sexm(m oodaptnmnet sfsDrmum ot0aleoiiciytfa2ra(msnt4 eenmrciotfmD lnvi t0tetr(rpiy1amen ieia( arta( onu0tlenmiciatfa uln pnu0 rxrmf3to1lmDrlivi s)s2tmio no1apt  fetas arraur ot0opeomoctysfm2rmnmp;(4 rxoiocoatfpte ieilt0srxoxr3oo1lm elietl()a2rm(rono1olxn oeilsfs raums t)tetoxfcoydfaD lueo;(0srxoim oydaptn ietatfsDtmur oo1tex  feiyslm rln o (0aeenxo3tytfaDeaivo s)s2ur(r3iu1al emiet t a2uax pnt0olxnifeiasfm2emn p;(0tlerircia1opDeaneo;()trxr(o iudol   fcilt  2raur ;t1aetoif3tltfm eau sn() rtrircto1omDeaivol(0 2ur(mpiy4om nmfvi s arrmx ont4apx mi3tyt aDemn snu0texomfcoydlmtraieo;( teuo(rpoo4ol emictlt aDta(root0open feiad aDemnvp;u) rxnio3totfa  liei;s0 exrxr3iy4op nlfvils) Dtmxr ;o0tlenmieilsfsDranvsnt4arermfcootlaDrlu s ( s2ur(mpiodllen ics s) 2um(ronu4tlt iociytla2ua( ont)areoio3iy1la e ieo (0srumxm3iydalenmfcsat)sDrm( pnu0texo iciatfmDean o t0tltrxo3oadlpt an i;(0 2ur(opou4om n neia()aDua(r nt4oexnmoeiasla ulu onu4trxoxoctotlmtrln s t trtmim3no1opeemfctat arrmu pnt1aleniieiytfm2umnms;(4alxomf3iodom elieilt) etoxr oodlpte icsa( s2um(  oo1aeeomi3iltfm2umn onu) exoxf3totla r uvils0texrim no4lmtemfcsatfartm(r ;u4alxomietytlsDra(vont) etnmo to1latr n s (0s2xo(m nu4ame  netatf rua(rooo1altnmo3tytlm2rl( o;t0artomrcootlaDe n i t0 rurxmpoy1lltnlicsa(f 2raxroot4olxnmictld a ulnvs;t0trxnxfctatlmDelivi s trtrxrpiy1lptemneia(faDrrxrono1aexn i3ild a emn s (4arxnxr iy1fatrlu i t)sexmiopiydap  lfvt s)arta(mont0tptoifeiysla uan onu4tetnmf3tydfmDranvslt)srxoiopiu1apee fesl( arrr(mpnu0open feilsfsDum(vp;(4altnio totlmt aiei;(  exm(rpoodlpt lfeil( arumu  ;t1oexomoetytlm umu p;t0texomr3iydoa   i o s srxrxmpiy1oltn iesl( srrmu pno0oleomociadfs rluvo;t4 reomo ta1fa elnei t srxrxo ny4opeemnvsa()sDuaxr ou0opxniietytfm2ul( p;() ltoir todop   uvsl() rtr(r iy4omt lfvslt)srra(  ;u4aex ioeiydls ra( p u4 lxoxrcoadlp  lueo (0s2um(m3iudop emfvi (f Drau  ;t0oexnif3ild s2emnvp u)artnmo oydfaDr i s t)s2tmio3nu1opte nvias) Dtax pou1aeenioetlsla2umnms;() rtrircoytla  luei s)srumimpno4lptnlfctl(fsDua( ooo0tpe  i3tls s eln snt)aexnmf oa1fa  luvs () exoio3nudlm nmnetls)a2umurp;o1aee  feias s2ranmp;u)alenif3oodfmDean olt) 2urirpou1ap  mivs t s2rmx  ot1oexoioeiltlm el(vp t) rxriociadfmDe uei;(0srxoxo3ou1op   ieslsfs2umxro;u1apenifctltfmDumnmpn()trtrmr3iodoa r ueil(0 2umimpoy4op nlfvtl() 2ur(rpnu0apenmi3tlsfmDeau s;u0 rxnio3oadfm rai s;t) rtrxo oo1ap   fvilt a2tr(mpno1aetoifctltlaDranvp u4texoio oatfp elnei;t0 exrio3io1apt lnes ( sDurx  ou1altniociyslm ea(vo;(4trxrir oa1lp  lieol( srtr(mpnudoptn ivtat)aDtaxmpnu4oleomfetls s2eluvpnu0aeenmocoo1fp  ln sl(0srumio3ou4lmenlnvils aruax  no1tltomociat s ua(vpnt4 eenio3iodfp eaivolt0 2xrir oydlle mfcias)arumxm ou4openmo3iydfs ul(mpn(4 lenxr ia1lp r u s s) 2trxr3ou1om   icia(f 2um( o;o4aptoii3tlslmDum(ms;u) eeomo3iodomt aies;s tetmim3iy4omt lnei (faDuau  oo4altnii3tlsfaDulu o;t4trtnxfciatop  anes t)s2uoxo3oy4omt mnvta()sDtaxmp;o0aptn fetysls2umn snu0treomf3iydomD  ivo;t t2xrxr io4lmtnlfcsasfsDuaum ;t1apx mo3iltlmDrlnms;u) etrxo oo1omtrlneolt) eumxmpoo4om n fvtl()aDraxr ;t4aptnmi3iadlsDemums t4tlxoxociadlatelies (0trtr(r3ny4ap e fcs tfs2umu o;u1altniietydfs2eanmonu)tltnif3tatlatrlieol(  2xrir3ou1opeemfeslt) rrmxm ;t0aexnmfciadfm ulnmsn(4texnifcoodlmD  u s (  etrimpiy4aleemncsl(  2rmxr nt1openmoctlt s el(mp;u4aleomfcoydlpDelivs s0 rtmim oy4lp   ieiat artax  ;o4tpenmfctytls elumont0 ltnifcoo1latr ues (0 ruo(r3io4lm e nci tfs2tax pno4aleo o3tad mDuluvon()treomo3iotomDeaneols  2umim3oo4lltnmnvsls artrxrp;u0opxo i3iatfm rm(vs (0tltrxf3oo1fm  liei;t0teuoio3oodol elnvi ( a2rmx onu1tleoiociydlm eluvs u0 rerxr3todoa eai s (0t2to(o ny4llt lfvi t aDumx p;o4teenifcilsfs eanmsn(4tlenmr oodopt lnvol(  rtmir oo4ll n ictas  2umx o;o1oeeoifeiatla eaump;(4trtomrcty1fatrlnes t0texrxrpio1lmeelfvtltf Draum ;t4oetn ictysfa2umnms u)trtnxr oodfpDr neol(0t2tmim3nydapee nvtltf 2raur ;t4ape  oetltla2ul(vs;u4 eermoctotfmD aues;t) rtmxmpoodlltemicsl()s2uru pnu4aet micilsfaDra(mpnt0 ltomfcootlpte u i s) 2ur(m oy4lpee netls aDrrxro;o1tpto ictasla ua( onu4 lxnxf to1omDeln o;s s2uoxo nodomtelfcsls)s2tm(ro;o0tlt miciad m eln s;u) rtnxf3oadlmtr ivs s0 eurim3iy1alenmfctl(f 2rau pnu0ape  feiatlm ul( p;u0aetrmo3to1la  luvslt  rtr(mpoo4lptn ivsas) 2urxm ;o1ape ifciysfsDeluvp (0trxnir3tydfat liei t0teto(m3oo4lp elnes s  Dra( pot4oet ii3ild sDrmn o u0aetrxo3oatlm eaneo ()setoir3nodapeelneias) Drrurpnt1aeeomoeils aDel( o;t0 ltnxo3ootfaD  uvo;t0 exoxo nydam e ivt sfsDtaurpoo1oetnmocild a2umuvon() lermfciodfptran s;(0sexmimpnodlmtelneil() rrru  nt4ole ioetas mDumuvpnu)tlxrxr oydfpt anvi;s) 2urio3nydamee nesa()srtaxro;o1tpx moeiat sDuluvsn()tlermfctodlpteaies s srurxm ou1apt lfet t sDrrxr ou4oetnifcildfmDrln p t0tlxomr iy1fm eau ilt s2triopnu4ol nmncsasfaruaum ;o1oetnioeiasfaDulumo t)altnif3oatlp e u o;s setr(o3iy4lm nlici tf 2rrxront1ale  o3ild a2elu onu4altnmrcoodfmteau o;s0texmxr3iodal e fvsas  Dua(rooo0tlxn f3ias m rl(vs;(0arenir ia1lpt  uvo;t)setoxm3iydoptemnvtls)a2uaxrpou4teenmfciatfaDemnmp;u4altoxfctatoat li i;s) rum(m3oodomtemnei t sDrru oou4tpxo f3ils mDumn o () lxomf oo1omtr ivols) 2xm(rpiu4optnmics ( aDtr(mpou4tpen fetys s em(vo t4teerio iodlm  au s (0trxr(r3iodapte icslt)s2rrx  ;t0alxniiciad m2ean snu0 etrxo totomDrlieils0teur(opoudomtemfviasfarta(mp;o4apxnmoeiad a ran p;u)arermrcoo1fmDr nvi;s0 exrimpoydom  lnesltf Dua( o;o4aetoifeiysfm2rln p (4alenxo totlat lnesls) 2uoxm3ny4amtn feil(faDrau ont0opxo fctyd s raumont) lxomo3oa1oaDraies t trxoim io4ll  lncsl(fs2rrxmo;o0oexo o3iatfaDrm( p;u4 exoxrciy1omD  nvi;t)sexmim ny4lmtn fcs ()a2um(m nu0aexn fciysfa2eau on() lxoio ty1omtelueolt)srtrxopny4lptnlivs sfaDum(m ;o1tpenifciad sDem( o;t0 lxnmr tytlatelieols)s2toiopoo4ll nmivs ( a2ra(ro;u0oetoioeiltlaDrlu s (0tetrmr ia1lmDr u i;()setm(m ou4ole micsas)arta( ont4opeomieils mDum(ms;t4teenxociadlmt luei t)trur(m3iudoltn fctat a2rrxm oo0alen oeiatlsDran o;(0arxoio3oy1omD  ueols0s2xriopnu1lle  feilsfs2ua(r ou4aetoii3iatla uanvo u0aeeomr3ta1fpt li s t truoxm oy1olenmneias)arurxm nt4alt ii3iatfa rm(vpnt0alxnif3tydoat lneo ( srxmir3nu1lpe  ivsls srrmur ou4tle mo3iatls rmnvp;u0 lerirciytop rluvs;s0 rtmirpoudapee fcsatf Drrumpnu4tpenii3iad m2rau snt0tltoio3iy1lmDrauei;s0 2trio3oydoptn ies s a2urumo;t1aeen feiytlaDeln s;t0arenmo3oadoaD  nvolt  rxo(r3oo1lleelict ()srta(mont1aexnioctaslm umu snu) rxrmrctytfaDrlneol(  2umxr3iy4amtn nctatf Duru  nu4ope io3tldfm rauvs;(4teerxr3iodop  li ilt)srumio nu4llen neil(f rrm(ro;o0oeto i3iys a em( snu)arerxr ia1fmte u s;()sexrio3iodlme livtlt)aDurur no1aet  ieiadla rmumo;u0 etnxfciadfaDeanvils0trto(m nydlpt mnvta() Dtmur ;t4texnmietas a ul( s;(4 exoxo oadfp  lueo;t t2trio nydlmee fesas) rrm(r no0tleoifciyt aDrlnvsnu0 rtoxr3oodlm  luvs t0 rxrxrpiydam nmnvsa()srum(rono1aleo oetlt mDel(mp (0altoxr ta1lpDr n sls teurirpno4am  lfet tfa2ra(  ;o0optnmfciysls em( p t0arxnif3iydomD  uvo (0trxm(o no1ap elncslt) Durx  ;o0texniiciltfsDrau o;u0arxomfcoydlp rai i;()trxoiopny1ap e net tf Dtr(mp;t4aetnioetltfaDelu s t4alxnio iadomD  uvi;t t2toxr nodame  ivta( s2rau p;u0oexnmo3ilsla2emnmont0 etomr oatom e ivo;( tetmirpnudapen fcsas)srurumpno0openmfeiysfa eluvs ()aleoxfctydoptelnvi t)s2trim oy4lle mfctls arrrxrpou4oet io3iatfs rl( pnu0 leomf3tatlm r u o t0s2umxrpiy4olee nviat) 2raumpnt1tex iictatla2ra(msn() rxnmfcootomDr ies;t0trxm(r3iy4oltnmnvs s artr(mono1tlx ioeiadfs2emn p u4 lxrmf iodfa raivi;t)srtmim3iy4lle lfeilt srrr(roou1opt iictytfa um( pnt0texoio3iytom eln o t0trurxmpno1apee fesl()sDuau p;o1alx moctadlsDeluvpnt0trtoxfcoatop  luvi s)trxoxo3oy1opt mfvi t)aDra(mp;t1opx mfciysls2uan o;u0 lxnxrcto1fa r n ilt srxmim3io4ap   nciasfarurxm ;u0open ociys a em(mp;() eenmo iodomtr uvs;s  2umxopou1ap elfci sf Drmxrp;u0olt  i3iatfs2uanmp (4 renir3oytop eli olt teuo(m3nudolenlnctltfs2umxr ou0ape if3iyd mDumuvs t)aexrmrciatfa ean slt0trtoxo nodllenlics t srtr( o;u0aeto feilsfs raump;()arxrio ia1omDr u s t0trur(r3no1lmenmiviltfaDumx pno1aetnii3ild a rlnvs u0tltoio oo1omteaiei;t0teurirpiydlle mfcsa(fsDrax  nt0oltniictld a emu p;t4 rtnio iytlaDr nvi (  rxr(opiy1om  lictat a2taumooo1tlxo ociat m uaumo u0texnirciotoaDeliei;s) 2ur(r3ou4apee ivi s)aDum(ront4tpt iiciad sDum( sn(0aeerxf ta1fa r u ols srtr(m3oo1ome lnei tfs2taum nt1alx mo3iltlmDeln pn(4 eenxo oydfaDrauvs t0sexoxopoy1lpte fetlsfa2ta(roou0apt mieilt s2rm( o;()tltnioctydopDelu ils  eumimpnodopt lici t)sDuau  ou4aeen oeils m2rln s t)aetnif oy1oaDeliei;s)s2xr(mpny1lpe  nctas aDra(ro;u0aeeomf3iasfaDrln snt4alxrmfctytfp e ies () 2trim nodaptemnvi t  rur(rpno0open ieilt a rln s u) exnmf ia1lp rli sl( sexrxopiydaptn iesas)sDurxroou4tptn o3ilsla rmnmo t)trtnmr3ty1fmtr ieol()t2xr(o iodlltnlfvsa(f 2rrumo;t1aee ifciys aDem(mpnu)altnmo oo1la raiei t)s2triopiy4lpe lies ( sDtmum nu4alt mo3tatla umu o;() etnmr3iadomD  i o s)seur(r iu1al emfci ( artmurpnt1apxomoeiyt aDuau pnt)texoir ia1fa  anvol( trur(r iodom  mfctat a2um(mpnt4aleoiiciat a2um(mo ()teenir3ia1fmte neolt0srxmir3oy4al nmnesls)s2uaxmo;o4apeo feiasfsDemn snt)texomociadlpD  neo;t0srxmir nudopt mnvia( sDum( ooo1oeeomoeiyslaDrmn snu) ltrif3oatfm   neol() 2toimpoodolenlneiatfs2rrx ont4alxnio3ias m2rl( p;t4 exoxf to1faD li ils0 2xr(rpnu4lle mfvtlt sDra(m no0ole mfetad s2raump u4tleoxf3oatfaDelnvo t)trumim oo4oleelnvt (faDrax  ot4ape mociltfaDua(mpnt4arerxociadfa  au ols)srur(m3oo1alenlieils s2uaurpnu4aleoif3iyslsDel( s u0aleomf to1lmteln i;s0trtmio io4om nmfvsat a2raxrpot0apx  f3iasfa rlumo () lenmfciytomDe u i t0srxrxrpoo1lmeelfvsa( a2trurono4tetnio3iat aDumu s;(0tleoxrcoydoa  au ol(0s2trirpoy1am e nci t arta(m ;u1aeen o3iydlm em(vs (0trtomrcta1la raieils s2tm(o iodol  mnvtat  2rmu  ;t4apx  ieiadlaDeanvsn(0trenmr3iodlat luvo s texmxo3iudll emnct s a2rmuroou0aee ii3tltfm umumo t) rxnxfcoytla  anvs;( tetmxr io4al nmivs ( aDtmu p;t1apenmiciad a2uln pnu0arermrcoa1oa eai sl(  exmirpnydomeelictls srtmurp;o4tpt  feiytlm2ean s;u) rtnxr oydoptr nvilt)sexo(o oy1lleelieil( aDtaxroot1apxomfctysfs uluvs t)aleoxf3totom   ies;(  2uo(rpiu1apt lfeta(f Drau  no4tpto ietysla ra( o;u)tetoifcoy1laDelu s s0teurxr3oudll nmietl()srtm( ont4tleoiocildls2umums;(4aetnmo todfat livs;(0s2ur(r io4lm n fcsas)s2rmump;u4tpxnioctyt a ea(mon(4aleoio3ty1op  aivsls) 2umio3iy1ol  lncslt) 2rmu pnu1alxniiciys m2uan p u0arxnmfctodopDeau s;s)texoirpnodal e nei t)aDtau pno0oexomicilsla ua(ms ()tlxomrcoytopDrlueolt0srumirpoy4lme mfei t)srtrurp;t1opxniociysfs2emumo;t0arxnmf3iatlmDrlu ils)setoxo3oydlme  nvsls a2rrxmont1texnmo3iat m2eanvsnt) reoxo3todlat auvi (0t2trxmpoodapenlfci (faDrmxr ou0tle miciasfaDrmn o (0tetnir io1om   ivo s) 2xrim io1aptn feta(f 2ra(ronu0aexniictydfm umnvonu4teenxrcoydopDrluesl( teto(opnu1omtelfeslt sDuaxront4aet mieilslm2ran pnu0teerif3iytlp raivi t0 rxm(mpou1oltn nesat a2tmxr oo0teenmf3tlt m2um(ms;t0tlenir3iytomDelnes () eurxo iy4op nlies () Dtmumonu4ale mo3iyd a2ra(mp;u)alxnifciodfp elies;s s2xoiopoodlptelfct s) rtaur oo4tex  oeiat s2umn ont) rtrxrciydfaDeaivols0srtrxopoodaleemnvs tfsruax  oo1tpe ifcilt m ra( s;t)trtnif ootla ranesl(0srtrio3io1altnlfvil( srraxmono4tlxomieilsls2rm(vs t0 etomf3oodoaDeai s;t seumxm oo1op nmneils)aDtr(ront4tlx iictyd mDea(msnt4 etnxr ia1fp  aivo;( t2trir3no1am n ivtlt) rrr(r nu0ole if3iatla2rl(vsnt4 etrir3oadlmt ln ol()setr(m ny4lp emfciat)s2tm(r nt1alx  oetyt m ul( p;u4aetrxrctydfateauvil( s2xo(r nodolenlfcias sDuau o;u4tptnmfeias a2rm(vsnt)arxrmo oy1laDrln s;t)trtmxrpio4om n fvtl(f rrmxmo;u4openmiciltla ea(mo;t)trtoir tytlaDe ueo ( t2xo(mpoudapeelfvia( aDuaxmpnu4tee mf3iatfm rau pnu4tltrxocty1omDraieo;(0teuo(m iu1lpeemnet s)arururoou4teto iciytfmDulums t4 exomr tadfmteauvolt0t2tr(o3iu1ll  lnciat)arrm(r ot0tex io3tatls uau p;u)tltnif oytfmt lneo t  2uo(mpnu1opte ies () rraurpno4opxnmiciaslaDean ont)tlxrmocoadla elu il(0srxmir3ny1lm nmfesls) Dtmxm nt4tetnmoctltlm ul(mp t)artomfcia1fa raueils srtmxo3io1apte iviat)arrau pou0oltniieiad a em( s;t4tlenmfciadfptean ils srxmxrpio1op elivt t)a2rm(rpou1apx mf3iytlmDrl(vont4tetoxfcoytlat lnvols0s2xrir3oo1ope licilt)s2trx ono0aleo fctytla rm( p (0aexrxr3oatom eaieo s)srtm(m ou4ap e netatf rrm( onu0aetn o3ias m2emu o u4arxnmf io1latrauvi t)s2toio no4ome livi ()srrm( o;o1alenio3iad aDeauvsn(0arerif3oatomDrln o;() etoxo3no4ope mncs t)s2uru poo0tee  ictytla emn snt0 eeomfctytomtraivo;t s2xo(o io4alt  fctlt arrm(mpot0texoio3iatfsDrlnvo;(4 rtnxo3iytlptraieo s trurio3iudlmenlivtasf rrru o;t0teeo ictyslm2eluvs;u0trxrxo3oydfatr ueo s)trxo(mpou1apeelfvslt)sDtauroot4teenmfeiys sDrmnmsnu0texoir io1op elivi () exm(rpio4lltnlies t)aDta(rpou4apt ioctltlm2rm( snt0 exrmf3ootfmtrlivi t srumxmpiu1om nlfci ( arum( oou4openmiciadfsDuau snt4tlxrmrctytlpDelu s s teto(r io4lm e netlt) Dtax  ;u1aexnmo3ildlm eluvs;(0 rtoxo ty1oatrluvol()t2um(o no1om nmfesls)aDuaxmooo1tetnmiciltfa2el(vs;u0tetrxfcoatomDeanvi;t0s2xrxr iu4lmt  ivia()artru pou4aet  ietaslaDrlump;(4tlenmo oadfpD lu o s seuoio iu4omtnlfetas)aDumu pou1opeoio3iyd a umnms (0tetnxf ootlmtrlneolt)trurim ny4lme lnvt sf ruru pou1apx  i3tysfa2el(msnu4 reomf tytfaDraivi;(0s2xo(o3io4lle  ivil()srtmum nu0oexoiictlt a2ea(msnu4altoxf oydlaDrlivs;s) ruo(r3nu4amenlfci sfaDta(rp;u1texomoctld s rmn pnu0altoif tytoa  ai il()setrim no4omen ietls s2ur(  oo1tex ioctysfsDumnvsnu4altnir ta1oa rln i t0texrxmpnu1al  mnci (fa2tmxm nt4tltnmociyt s ul(vsn(0teerir tydom  livo s0t2tmxopio1lptemnetas  2raxrpno0tle mi3iaslm2elu o t0 exrio tadoatelieo ( t2xoxo ny4optn feils)srtaxmont4oexo fetasfa ean o;u)arermo3ootlmD luvo t seumxm iy4op emnvta(fa2rrurpot0tlx  o3iys m2eau snt) rtnxoctodomteaieols0 2ur(o3no1al   ieta( arururpnu4alxomieiltlsDrm( p t)tlxnxo3ty1fa r n i;t0s2xmirpny4lp nlivtat)a2ra( oot1oexomfciytfaDran pn()aeermoctytfpte uvi ()srtmiopnydopt  netls srrmxro;t0apt  ieiytlmDemnvont)texrxr iytlateaneolt0s2tmxm ny1lp elfvil(  Drrump;u4aex ii3iltls2elu onu0 ltrio3oadoaD  uvsls0s2tmxrpiu4omtemieiat)srumurpoo0optnmi3tatla umn snt0 reomo3oy1lptranesls)truo(rpiodap  mivs ( artrxro;t4oet mf3ias mDrm(mpn(0tltnir to1oa e nvs;s t2tmxopiydop  mncta() 2tru  no4ole mfciad m2el( sn()aeenmf tydlaDe ies (0s2uo(o iu4ll elfcsl()s2taxrpou0aet  f3ildfs2rlu s (0aetoir iotla r nes t0t2umxo3nydope miesat)aDrr( ooo4opt  oetadla uaumo (4trtomf3ootla r n s;s t2tmim3oy1omen nesls)sDur(r ;t4tpenmictls m ra( o;t)artomo3tydlat ai s;t)trxm(opny4om  livia(fa2tax oot1apx moctlt m ranvo;(0aeenmocoytlp rlu i;s  rtoxopoy1ape  fesat)a2rm(mooo0apxo i3iytls rl( o (4aetnifciatfatrlnvo t srxoir ny4alt lnct s  rur(moou0aeeoifetaslm uau o;u)trtrxo oytfa  aieo s)truoir3nu4ame  nvsl(fartr(rpnu1oet  ictyt m2ea( s;u)tetrmfctodfmDrauvs s  rur(mpoy1lle mfesatfarurxrp;u4ape  ieiasls rln snu0texnmo3iatfmt  i ilt) 2xoiopou4ol e ivtat)srrrx o;t4aet  fetlsfs rmu p;t4tlxnmo iotfptraivo;t s2um(o no4lptnmiet ()aDtmumooo1tpeo fctadfa rauvpn(4tleoio3io1fm   u sls)trxr(r3nodalenlnct ()aDraump;t0apenioetytlmDuln o;t)arenir iytfmDelies t0trtrxr3iudameelnesa(f rta(m nt1tpx mo3ildla2emumo u)arenir totlmDe neslt trumxr3oydamenmnvi t artr(mpou0alt moeiatfmDrmn o (0aetnif3oadlmtran i;t) 2xmim3iu4lmte iesa(fsDururp;t1tlxnmoeilt m eau onu0arenxo3tytomteauvs t0s2xoio oydamenlnvi ()srtax oot1aetoio3ild s2umu onu0 eeoio ia1omt anvs;(0s2to(m3nudlm elncsatfs2ua(roou4oeeoifeiltfm2emumo t4 reoif oa1oaDe ivo;t0srtmxo3ou1lm  mfcil(fsrtmur ou0tpxo ietat a2elnmo t0teenmf3oydoat  nvo;(0sexmxm nodlmtnmivtl()aDrrumooo0aeen o3iltla2ua( p (4arxrifcta1oateanes s) 2trxo3nodoltn netl(fs2tm(roou4aexnmoeiysls2elnmont0tltrxo io1oatrln o t) rxmir ny4openlfvtl()srurxrp;o1oltomo3iydfm2rlnmonu)arenif tytom rau ils0srtrir nodllenlfvtas)arrr(mo;t0tetnioetltlmDul(von(0 exrio oa1la elneil(0 2ur(r3ou1olt  ncsa(f rtaurpot1apt mfeiltlmDumu o u4aexrxocio1oatrli sl(0trto(r3oy1llte ivsat) Dumumpoo1tee  oetat sDraump;(0 reoio iydfmte ivs;s) 2xr(r oo4al elietas sDraxro;t1tle ifeiad mDel(von(0altoirciydlpD ln slt trtrxmpoudlle  fctlt  rua(mpot0tlx ifeiys a ua(vs (4tetoxr3iytfaDean i;() 2xr(o3ny1ol n fesltfsrtmx o;t4aetnmf3tyd sDeanvont)arxnmrcoy1la rauvolt0sexmxm iy4amtemictls artau pnt0opto icilsla umn p t4 rxnio oadfmtrlivs t)t2uo(rpiy1lmeelfeiat arurxmpot4apt  icildlm ra(mo t0teeomfcootlmD  u i (0s2toxo3iy4oleelncil(fs2uau pot4tpe ii3ildfa ra(mo;u0teeoir ootlm eaivo;( trtmio iodapenlnvs s s2ua(rp;o4aet mi3iydla2rlnvp;t0 ltoxo3ia1laD lueo;s)t2xmiopoydame  ivtls)arua(roou1alt io3iys aDrl( on(0trtnxfciy1lmDe ieo;( sexoxo3iu1oleeliei t)aDtax onu4ale  feiatlmDulnms;t0alenxo3ootop eau sl(0trxmio3ny1omt  iesat)sDuau p;u0texo feiytls emnvs t4texrif3totfaDeli sl( trtoxr3ny4omtemiesls)sDtr(m ;o4altniociysla ea(vont)teeoiocoodoaD auei;s) rxoirpou4lleelfvia(fs2rrumpnt4opt mf3iaslm2raumo t)artoiocoatlp  anes s0s2toxr oo4amte ieil( s2umuroou0oetomociydlsDeaumpn(4artnio oa1oaDelnes ()seuoio io4lmt mivilt)s2uaumo;u0aetn o3iytfm umnmo t4trtnirctytfa eauvi;s  exm(r ny4lm n fesat srtm(m nu4ape mf3ildfs eaumo (4 eenxr3oodlmDrluvi s sexoio nydoptemnet (f 2rrumooo1oeenmfeiydlsDum( p;() ltnmf3oydoptranvs;s tetmxm iu1llt lfvi t sDtau oou4oltn o3iys m ulumont)tlenio oytoaDe ueo;t0t2xrxm3iy1amee fetat) 2trxrp;u0oee mictysfs2rlnvs;(0arerif ty1lpDrauei;t seto(r3oydamt lncilt artr( o;t4ope  icilsfa ra(ms t) lxrxrciodomDraieolt0 2umim iy4am   ivt (  2rau o;t4open octasfa2umuvsnt4arerxo ia1lmtrauvo;()setmio3no1lleelivilsfsrumurono0olenmfeiatfs2emnvp u4trerxr3iadfaD ln i t srxmim3iodlp elicsls s2rr(  ;t0tee  i3tad aDrlumo u0 exnxrcia1la   n i;() euoxo3oy1alee fvi (fartmxmp;u0tet  icias a2raumo t4artrio3oytlp   ivils t2umio3ny4ame  nes sfaDraxroou4altomo3iat a2rluvp;(4artoirciy1lat aieo s sruoir3oy4lmeelnesa(  2tm( pou4texoiociltls rl( o;u0trxnir3iodoateaiei;s0texo(opnu4olt lnvi s  2tax o;t1altniieiyt s2umuvo;u0aetomrciadlm rlivi ( srumxm ny4opeemnvslt) 2tm(mpno4aeeoif3ild s em( pnu0trtoxrcta1fmDe nvo (0srtm(m3iydll  mivias) rraumpot4tetomietad m emnvpnu0 ltrio todoptr nei;()sexoimpoydom  micsasfs2uaur ;t4opxnmf3iys mDeanvs;t)tltriociydopte ivsls  2um(o ny1al  lics (faDraxmpno4oeeo oeilt mDel( s (4altnxf3tydfmDrai i;t sexm(o oydlpt  ncilt) 2rr(rp;o0oeeomfeiat mDulumpnt)arenif ta1oaD  ivo s0texmirpou4olenmfesltfs2tmum ;o4oltomo3ias a2emnvpn() lerxf3tadomteaivilt)texmxopiy1al emnes sfs2ururpnt4tpto f3tysfmDrau o;t4tltrmfcoy1omtrlnvi t)sexr(o ou1lmeelfvta(fsrururpno0opt  ictat mDelnvp t0areomoctytop ran ol()srtmxr3iodamtnmfcias) rra(  ou1tlt iiciyt s2rl(vp;t4tlxoifciadlat livolt0 etr(m3ny4am e ictat s2rrumono1tpe  i3ilsfs eauvs;(0 eermr tadfmt an s t0s2xo(o oudamt  nctls aDum(m ;u0opeoifetatls2rm(monu4altoxo oadop ranvo;t0srumio oo4lp n nvslt  2raumoou1aexomfeiatfm2ean pnu0alxrmr iodlm  anvsl(  rxr(m3oo1lmtn neil()s2tm(rpnu0ale moeiytfa eanmont)tltnxr ootoatrauvs;(0seuoxrpio4ll   fesatf 2ra(moot0tpe miciasla2elnvp;()trxrif3iodomD luei;( s2tr(rpiu4ole  ivs s) Dumurooo1apt ioeiytlm2ua( p;(4 lerxrctatfat livo s0srtr(rpnu1lptn ictas  Dtaxmo;u4aeen feiyt m rl( pnu4 lermrcoo1oa eaieo;(0s2xr(r3iy1omeelies t a2tmumo;t0alen octasfm em( o (0 lxrxf tatfpDrai o ( s2xrxm3nu1omen ictlsfa2taum ;u1oexn fetatlaDea( s u4trxrxr iytoaDeauei (0teur(r nodlmeelfviat)sDrax poo1aexo iciysls uanvs;(0artrxf3iodlat anvi;t  2toio iu4ope mnvsls a2ra(r ;t0oeeoii3ilt sDrmuvp;u0teenmf ia1lmt livi;s) rur(o iudol  lnvilt)sDtr( ono1alto o3ilt s elnvs (0 eenmocia1lp ean ols teurxm3iu1ale mfetasf Dtr(root0olxnif3ildls rlumpnt)teeoxo3iotoaD  u i t) etoxmpio4omtnlfvt (  Dumxm ;o4aex  icils m emnms u) ltrirciodomt lu i;s s2uo(o3iu1lmenlics ()s2tm( p;u4tpe mictydfm ua( o;t)tetrmr to1lmD  ivo s  2urxr nydlp  lict s)srtr(moou1tlxnmo3iys sDelnvp;u4tetnmr oytlptelnes ()srtoxrpiy4ol emivs (fsruaxr oo0aet if3tatlm2ra( pnt4texnxo oydfm   n i () exm(rpiu4olenmnci (  rtrxm ot0ale ioeiad aDrm( p;u0 renif3ty1omteai il(0texrxmpoydaltelict sfarrmxmonu1opto iciad m ra( s u0alerxo iytfmDean il()texr(o iu1ameemncs sfa2trxront0oex  oetyt m2ranvp t4 eenmo3io1oa r iesls  2uo(r3oo4ale mfeil(  2tmxmono4oexomieils m2ea( pn()tlerifcoo1la elneils0s2ur(o3iudap  livt s aDtaumo;u1tle mf3iad s rmuvon(0trxrmr3tydomD anvsl( teur(m3nodale lfcia( s2urumo;u4texnifctydla raumo;()tlxoxr3iodfateauvol() eto(m3io1apeemfetltfsDuaum ;u4aetomo3iltfa2ra( s;(4 rtrif ootfmD luvo;s trxrxm3iu4al elfctasfaDumxmoot0ope mo3iadlm2ulnvonu4tltnxr3oadfat lneilt0srxrxr3iy4alt mfvta( aDtruroot0oetn oetytfmDem( s;u0 ltoxr ty1faD  ieo s sexmiopou1apeelieiat  Dta(mp;u0texn ociad s2rmump;t4aexnxrcoytfmtrlnes t)t2umirpiu1ll n net sf 2rr(  nt1tptn i3iltfa um(ms u0artoir iy1laDraues t) 2umxm3io4om  livtatfsDtm(moot0oexomo3ilsla ul(vo;(0 exoifcio1lm raieo;( s2tm(o oy4oltelfcils)sDum(mo;o4tee mi3tytfs ranmsn()tetrmf3todlptr u i;()s2xr(o ou1lm  mivtlsf rumxroou1olto ieiltlm2rl(vp t0alxrxo3iotlpD auvsl(0setoiopoydam nlfcia(f Dtrxrono4tee mictad sDulnvsnu) ltnircoo1lmt ai i s0tetrim iu1al emfcs (f Dra(root1olx ioetadls2rmump;u0 lenxociydlat  neols) exr(r io1apeelnctls)sDrrxm ;u4aptnmietasfmDemn s u0 eeoxo iadom rln ols0srurim3oo1llt mivt ( s2uau oot1tpx moctls s ea(vpn() lermo3iatoatr n s;t)tetmio oy4opeelncslsf rtax p;t4tlx  ociysla rln ont0tleoio oy1omDrln sls  exoxm3iu1ame lnvtls) Dtau  ou1tpenmietldfsDuaumont)texrif3tadoa rlneilt0teuo(m3nu1ap   iet (  rtaurpoo1tpe mfciltls emn sn()altrif tadom raiei;( t2urim iydom e fvsl(f 2rrxmont0tptn o3iaslaDem(vo;t4treoxf iydomteaneolt0s2tmim oy4apee fvi () Dtmuro;t4olt  fciadfaDrmuvp t0alxnxocoadlat aueo;t t2to(m3oudlm n nvtas)a2rmur ;u0apxo fciysfa rlnmp (4artoioctadla rluei s sruoxmpiu1amtn ncs tfsrrrump;t4oeenifctltfs2ul( p (0arxomfcoydom  lueo;s)setrio3oydlltnlnctl()srraump;o1aetoii3tatla rau p (4tetnmfcoatfpD  nes t)s2ur(opny1olenlieias sDrm(r ;u0aetoii3ildfmDul( pnu)alxrxrcoo1oa rln i s  etrxm3io4lm nlnvias)aDur(r ou1aeenmieildfsDul(mont0 etrmfcoa1fptr uvi (0t2tr(mpnu4lm emieil(fa2rm(r ;u1ape mieiytfsDeluvo t)arxomr ootlateluesls  exrimpio4altnlnci t  Dra(rpnt0apt io3iltla2uln s u4 lenmrcoo1fpt lnvi (0t2trimpoo4al n fet ()sDtrxronu1apenmoctldlaDemnvsn(0aexrio3tydlmte ivils  rtmio io1lmtnlfetl()arur(m ;u0teenmf3iysfaDemn snt4tlxnmf oy1omD lu slt0sexm(rpoo4lp  lics s artm(r ot1altnmf3ildfm rmumo t0 rxnmr3oodoateauvs;s  exoimpno4apenlicilt  rtmxro;o1alx  feils s2rau p (4texoxr3oa1omt aneils s2xmxr oudlpeelfcilt a2tr(rpou1alt io3tlsfs elnvo t)artoxr3iotoateli i (0sexmxmpnudal  mivt t  Dtm(mpnt1tpeo o3iasfm em( on() lxrmocoadomtrlu o;(0seuoxo3no4lm nmfvt tfa2rrxm no1oetoio3iyd s2ranms (0 exrxfcoydlaDr nvo () exmxopoy1lpe  ivilt a2uax  ou1alt ioeiatls ulnms;u4 leoir3tadfa eaiei s)s2urxrpoy4lm e fetlt) Durum ou0ale  ociat s elnvo t)alenmfciatfmDeluei t sexoimpnu4al n icilt aDrm(ro;t0tee ifctatfs2elnmp;()arxnxrcoy1omDrlnesl(0teuoxo oydapeelfvsl(  rur( p;t1aexo o3iasfsDel(ms;u)altrmr3oodoateanvs () rxoim3iu1ame  ici sf Dur(ront0oleo oeiat a ulnvsn(0aetriocoytfa rlnvil()setoio3ny1omt lfeia()s2uaxr ;o1apxo i3iydlmDra(vs;(0alxnif3iadopt luvs s0srxoxm oudope lictltf 2rrumpnu0teeo octatlm uanvpn(0trenio ta1fm elu s;(  rxoxm oo1lpt  nesat aDua(mont1tpeo oeiydfaDemnvo t0 rxrxf3iydfa e uvo t0t2xmxr oy4am emnvil( s2taxmono1alx iietatfa2umuvsnt) lxnmo totlmte n o t0 exriopio4ap  lnvtas artrxm ;o0oeenii3iadlsDemn s;(4texnxociydoate uei ( setrir nydam n fet sf Dum(mooo0opxomi3ild s umu p t)tlxoxr3oydlmtr ues s) 2tmxo iy1amee nvs t  Dtmum ou4alt ii3ias sDem( p t)tltnirciatfatr nvolt0sexoxr3io1ome  feiatfartaxmo;u4altoif3iatlsDrl( s u0trxoir todop  ln ilt) ruo(o iu4ol nlnet sfs2uaur ou4tpeo feiad m rmnvp (0altrifctytla e ieolt0srtmio3nydlm n ieslsf 2raur no0apenmoeiadlmDeanvp;(0 lxoifciodlptr nvolt0setr(opiudom  mivia(fa2rr(mpnt1tpeo ieiasla2ea(vp t4artrir oo1lmtr nei t)sexoxm iy1lp elicsa( s2rrxmp;u4oltnmfciaslm2emuvon(4texrxrciydomtr ivolt)sexoxr oydameelnvs s)sDrrurono4tlt mo3iadfmDrm( p u0aetrmo3iatlptelivs ()seumimpiu1ap  mfvtatf Dtr(mo;o0alto fciadlmDrluvp (0 rtrxfcoydfateauei;t  2urxm oy4omeemnctat sDrmxr no1altnii3iadla2umnmont) ltrxr3iytfm   n s s  2ur(m3ou1apenlfvia() 2uaurooo0oee  i3iytlsDem(msnu)alenio oa1lmD aueo ()srtr(rpnydaleemnes sfsDra(mpoo4tptn o3tls a rmnmo (4tltrifcio1fp eau o;s seumio3ou1apenlfeta( aDtrumono4alx mfcias mDrauvp t) etomo3ty1opt aneolt0 2tmxopoydamt  nvsl(fa2urxrooo1tptnmo3ilsfm umumo;u4tltrifcoy1laDeliesl() exriopoodomt mneias)a2tmumo;t1tpxomiciysfm2ulumpnu)alenio3ta1faDe i o t s2xoxr3iu1ope  iei s)s2tax poo4apt mieildls um( snt0 eenio3oodomD ai i;s)s2xmir oudal   ncsl(f 2ta(mont0tee mi3iatlm emuvo (0alenmr3oydlpt  uvs;()texoxmpnu1omtn ivtas)srta( pnt4tlx ifeiasfa ean s;t4tlxnxfciatfm   ueols)setr(o3oy4am n ivs (  2ua(  nu0oetnii3tas sDrlu ont4 rxoxrcootfm  livs;t seur(mpnudlpenmictas arrru oou1tet  feiytlmDelnmonu0alerifcoa1lm e n sl(  2xmxopio1ll nmfesas  2ta(rpot1opx mfetyd mDelnmp;u)alenmo iatlpDeln i;(0setmxopny1altemnesl() Dumum ;u4teenmfciltlm ulu pnu4 eerxf3to1oaDrluesls0 2to(rpoo1lmtn fvtatfa2tauronu1oex  i3tadla2ul(mont4aexrir3ia1op  livs t0srtm(o ny1al  mnvias)srtrum ;u4oeenmieiltfm2uaumo;u0treomf3io1oa eaieil( teum(o nydaptelietls arumxm nu1opx iociltfa2ua(mo t)arxoxo tytoaD lu sl()t2xrir iu1lp elneil()artmu o;t0alt  feiytlsDrmuvp;t0trtrifcoodfm raueo;(0 2umxrpiydale liet t srtrump;o4tlto i3tltfaDeauvont)alermf3to1fp  luvi ()teurxo3nydlptnmfes (f rurxmp;t1aetomieiytlm eanvs u4 rxnxr3oa1omDrluei t0sruo(r nydlltnlivt (faDuauroot1aex  i3iltfa2umnmo;t) ltomr oytom e nvs;(0srtm(opnu1lptelivsls  2ur( pnu4tex mfeiat m2um(vs ()tetoxfcoadfmt au o;(0t2uo(o3no4llenmicsatfsrrau p;t4olt  oetas a2rm( p t)artomrctadoaD livi (0texrir nudap nlfei ( arra(mooo1olxnifeildlm rlu p u) lerio3iadlpte nvs ( trtrio nydopenlfei tfs2trurpno4aetoiociadla ra(vs ()aetnmf oodfpt liei;s0s2uoirpou4open nvsasf Drmxm nt4aetn iciydlm2rmnvs;t4 lenmoctatfa eanei ( texoirpnydole licsat)sDtr( o;o0aetoif3tys m2rmums;(0aeeoio3io1fmDrlues;s0 ruo(r3oodlpee fctat) 2rmu  no0tltomi3iatls uan s (4aetomr3tytomtrli s;s0srxmio iy4opt  iciat aDtr( p;u0oltnifciyt sDum(vs u0aetrmr io1oat anvi;t srur(r oodopeelfesasfa2ur(rp;u0tpxoii3ildla2rl(mp;u0arerxf3tadfatrlu o t)texrimpiydalt lnctlsfartrxm nt0tex mieiysfm2emnvpnu4artrirciatopteli i ()teurio oodamen nei tf 2umxr ;t0altnmfeiat m rmums;(4aetrir io1fa  aieols0t2tm(r iu4ol elict sfsDrr(r no4tleo f3ias aDulnms;t0tetrir totlp  luei s0truoxmpny1lme  ict (f ruru o;u1tetomietlsfm em(ms u)texnxo3tydfptr u s (0 etm(m oodomenmfvs ( sDtr( ono1ope  o3iyslm2rl(vpnt)trerxr tadlpte n s;(0sexo(r nu1omte ivt tfs2rrumpno4texn ictytlaDuluvs;(0trtomoctodlpt li ols s2xoimpoy1ome lfes (  2ururpoo1texo ieilslsDea( o;u4tlxrif3iytfa rai o;s)truoio3iydalt lnvta(farrau  nu1oee mo3ilsfa em(vo t4 lermf3tadfpDrluvo s sexoirpoo4lmtnmncs () Duau onu1texnmfetasls2ua(mont) rtnxfcoo1fmDrauvols0srxoxr3nudlm e ieias arumxmo;t4aeto oetatfa uaump ()aeenxo3tytoa e nvi () rxmir ou4omenmfes t arrmxront1olx io3iytfmDrmnmont)trxrmr3ta1om  an o;s) 2umxr oo4omtn fcslsfsDrru  ;o4teeoio3iysfaDean s t0arenxo3tydfptr ivo ( tetmxm3oydal n ncils srtm(m ou1tlto o3tlsfs2ulnmo u)tltnxo io1fptr u ol(0tetoxmpoydlp n fes (f Duaurp;t1tpt if3ias aDemn o;t0 ltnmo3oatopt ai s;() rxm(r3no4ll nlicsat  rtm(mpou1alxo i3iat m2ua(ms t4texoif3tydfmDraneo t  eurim io4llee fvil(faDumxrpnu1apeomfctldlaDelnms;u)artnmocootoa  livil( trxm(mpiy4op nlivi ()sDrrur ;o1aetnmoctys mDeanms;u) lxrxfcoo1opt  nes;(0 exm(opoudllte fes t) 2urxmpou0aeenii3iyt mDumumo;t4aetnmo tatlm ranei;(  eur(o no1amtelfeiasf 2tm(m ou1texnmociltfa eau on()tltnxf3todoaD auei ()tetmirpoydap n ncsl()srtmxmoou1teeoii3iysfmDemu o t) rxrifciatom e ies;s tetrim iodllenlnes tfs2urxmp;t4teto feils s rl( snt4aetnircoytop r uvil() rtmxmpnudapeemfeia( srumx  ;u0altn iciltfm2eaumo;(4aeenxocoydlmtran il()trtoio oy4lme livs (farua( onu1apen oeiatfaDelumpnu)alermrcto1opD  uvo t)srxm(o ou1op   iet (fsrum(rpot1aptn iciydlm ul( s (4aexrmf iytlp e neo () 2xmxrpoo4lpe  neslt aDrmx oot4tltomiciys s el( p u4tetnxo totfmDeli i;t sruoimpou4ope  icsl()srtm(r nt0tptomf3tltla2um( p;u0 etoxrcootoa e neolt  2xm(mpoo1al n neslt sDtaum ot4tle if3iadfs2rlnms t4altoxo oydlaDr i s;t0 euoirpoy1ome mfei tf rrmumoot0tetoifetatlm uanmp u)artnif3oytlaDe nvo;t0trxoxo3iu1lmtnmnviltfaDum(ronu1tlx ifeiasfs umuvo;u0trxrxocta1lpDrlies;t) exoir3ou4ll elivs t  Drmumono4teto o3tldfs2ranvo;(0 exomo ia1faDrlies s)trxmim io1oltnmict (  Draxmo;u1alxoif3tydfm rlu on()aeeoxf3oy1faDrln s t0seumxmpiu1olenlieils srrm(rpot1opxnmo3iysfa rau p t) rtoifcio1omte nei;t) ruoio3nu4am elivs t)srurx pno0aeenii3ilslm rau o (4tetnmf oy1lp r ueslt) ruoir3iy4amt mivtatfsrtm( pot0altnmociad aDel(mpn() eeomf to1om r uei s  rtmxopou1ol e fetas)arumuro;t4aleoioeils mDumnvs;t4 exnxr3iodfateanvs s  exr(r3no4lpe liviat)a2rm(moou0openmfciyt m rmnvs u0tlxoir3iy1fmD  ivilt0 rxo(o3no4lmeelncia()sDrmxr nt4texnif3taslm2rm(vs (0 lxnmrcoadoa e nes;s)t2ur(m io1ol  micslt aDur(rp;u4oetnmietltfsDuauvs u)arerio iotopDrlivi;t)setr(mpoo4al nlneil(  rta(ro;o4aex  o3iasfmDuau o;t)trtrifcoy1opDrlneo;s0 2uo(rpoy1al  mfvtasf rrrxr no0oex  fciytlaDemnmonu0tlxoio3iy1fmtraueils t2xrxm oo1lleemncta(faruax ono4opxn f3iydlaDrm(vs;t0artomo tytfm  auvil() rurimpnydlmeemfvs (  Duax pou4aeeoif3tytls ulnvsn()artrif iadlmDeluesls) rxmxm3oydolen ncslt s2ra(rpot0teeoiiciyd s elu ont) rtnirctydlmD livo () rxrim3ny1lmenlies (faDtru  nt4apto i3iasls2ranvp;(4 exoir3iatom rli ils)t2tmim3iydol e netl( aDtm(mono1tpt mf3iydfs2ra( pnu4texrxr3ootoatranesls sruo(mpio4op emfcs s s2rrxr nu0altoif3ias sDemu p;u0trenmocia1lp ranes;t0teurio3oy4lmt  fvtltfarrr(mpou0tpeniociad a uanmp (4 exnifctodopD luvilt)teurxopnodame  nvt ()s2rr(  ou0teto i3ild a rm(mp u) ltrmf iotfpte n s;s s2urirpiydoptn fvta( s2urx oot1ale mfctaslaDel(vs;(0tetrir3oadop ranei;t)s2xr(o3io4lmenmictas)a2rmxrpnt1tetnmoctls a2elnmp (0arxoxo3tadfm  an s t)srxriopio1op nliciasfsrta( poo4tpto fcias sDumn p;t4 eeomr3iadlpt auvilt0t2xrxmpny4lmtn fvs tfsDum(roou4apeomo3tysfs rau p;t) leoif iy1omD  nvi t) 2ur(mpiu4lme lfeilt)srrmxmoou4olt mf3iad a rlumo;t)treoif to1opDr u ils0trtoxopou4lleemivtlsfaDtmu  nt4tleomo3ilt s rln p;(0artomoctadoptelneil(  rxmio3nudllenmnvi s)s2rr(rpou4oltoifeiyt sDemnmp;u4altnxo3iytlp eai il()texmxmpoy1aptn ncsls)srurx  nu0optoif3iytfa rlumo;u0 leoif3io1lmDraiei (0seuo(rpoodlp  mfvsatf Dtmumpno1tee iieils mDrm(vs;()areomr3iatopDe nvilt0 2tmxo io4om n fvsas sDtauronu0ole ioctltlsDumnmp;u)tetrirciadfpDe u o;t0 rtmiopnu1om n iesat) rtrx  ;t4oleomi3iys aDeanvp;t4 leomf3ta1oate neil(0 eurxr oudap   fvi tf rtr(  ot1apt  ocils aDea( o;u)tlxrmr iytfpDeauvo;s  2xoio iydlpee fcs ( aruru  ;u1alenmieiydlmDrmnvpn(0aexnir3oytfatelu s;s0seumxm io4om  mnvt s)sDra( oot1tptn octls s2ul( s;u4aetnxf oytomDe neo;t0setmxm iydlpt lictat srrru  no1apen f3iad sDuanvs t4 etnxf iadla ean s;t)s2um(rpnudalt lieil(faDur( pnt1oeeo ietydfs ranmsn(0 rtrmr3iydlpt  uei t  rxm(o3no1ap nlneils  2tau pou4aptnmieiatfs el(vp t4trtomf iatomt  nei s0sexrxo3oy1lltelneiltfa2tm(  ;o1alxo octytfm2raump;t)tleoxo3tatfmt ln o t seuoim nu1al emncta(faDrrxrpot1alxn o3tydfs2ua(vp u0 etnmrciadom elnvs;s s2xmir oydlmenlicia()aDrrur nt1oexoif3iat s2ulnvp u4tlxrxr iotopte nes;t)sexm(opoo4lpe  ieslt arumurp;o1oltoiieiys m ranvsn()tltoirctydopt  ivs;(0s2xm(opoo1lmt mnvtasfsrtaur no4ape  ieiytfs2rm( o t4 rxnio oa1fa e nvo s0 etrxmpoo4lp elnci t)sDtmurpou4apeo i3iydla2rmnmon() lenmo3oatlp  lnei;s)texmir3iu1lptelnesat) Dtrurpoo4opx mfeildfa2emums;(4aetrxf3ty1lpteauei;()seuriopiy1opt lfetltf 2tmur nt0alxomictyd s2em(mo t4aetrxf3io1laD lieo s0 2xrxmpnudape lnci s  rta(root1oexo octytfaDul(mo ()artoxr3iotopDeaies;s) ruoir3io1amt lnviasfaDtaump;o0oexnio3tyslmDuan s (0alxrif oatfa eanvo;s0texmim3no4omtnmfcil(fartaxroot0oet io3ils s uluvp;() rxrxr3iodlpt lnvs ( texo(r3ny1om e neilt s2rau  ;t4oet iociydfm2rl( o;u)trxnmf3iotomte ivi;t0t2tm(o3iu4opteliei tfaDraxr ot0opxn feiat s2uluvs u)trermr3oytlmtrauvols teuo(mpoodolte ivt t)aDrrumoot0oetomfciasls2uln s (4 etrmr iadfptr nei (0s2umxr3ny4olenliesasfa2tmx o;u0apeomo3tls s umu s;(0alxnmr3oadlpDeaiei;() exmxmpio1omeelies t)sDrm(m oo4tltnmiciysfs2rmumonu4arxrmo iotfpD ai o;()srxm(mpoudlptemncslsfs2tm(m ;t1tpxoiiciyslaDea(msnu)aexrmo3ta1fa r n o;s truoxrpio1lpeelfcilt  Draur ;t4texo octat s2rm(ms (0treomfctodoptr uvil(0t2to(o iy1apt lnci t a2umumoot0ape io3ilsls2rmu s (0 lxnif3iydoa eau i t  2triopnydlltn fcils) rta(r ;u0oetomf3tysfmDelnvp (0arxoxr iodfpDe uesl( t2tmir3oo1om nlics sf Dumumonu1aexo ieiytfs2rlumon(4 eenir ia1fatr nvi s)t2xoim3nudlme mfcils srraumo;o1opx  f3tas a2em( onu4 eeoxocoo1opDe nvo;( tetm(m3oodlm  lfci () Dtmxro;t0openifcilsfm2uaumo t0 exnmr iatfmtrau i;( trurxo3iy1amee ictl( a2ra(mp;t0olx io3iadfa2elumo t0tetomr3totlaDr ivo;()t2xmxo no1lltnmnct (fs2ua(moou1aexniieiyslsDem(vp;(0arenxf io1oa rlu i s teurxo oydapeelnvt sfsDuau pou1aptnif3ils aDumu p u4aetnmfcto1om   neo;t t2tmxopou1optnlivsas  Drru  ou1aex if3iad s2ul(vo () etrio3tadoa raies t0 exrxopiy1lm elfctl( arra(  ;o1tpxn fetat sDuanvsn(0trxnxo tatoaDrlu ils teuoir3ny1lp eliet t)s2rrxmpot4tet mociad sDuan pn()aleoxr3todfmt an s;t)seumxm ou4alee fvia(f rtm(rono0oet  ociltlm ra( p (4trxomf3oo1fptr n ols) rtmio iydlpe mnvtatfarurur ;t0ale mf3tltlm ulnvs;(0artrir ia1om elivil( seur(r ou1omen nvias)aDrmuro;u0aet  oetysfa2rmu o t) lxrxo3oodoate i ilt0 ruo(m3oo1ol emfvsls)a2ra(r ;u1olxnmfcildfa2emnmpn()trxrxr oytom eau ols teto(m oudlpe  nctl(f 2uaxront0tee ioetatla2raums (4trxomo oo1lpD aivo;s)srum(m iy1ol nlncslt  rtrurono1aex mi3iysfaDemumo u4alenircto1om  luvsl()setoxopiudoleemietls) Drrurp;o1aptomoeild a2el( s;u4 rxoxfciydfmD lies;s setm(mpnu4ll nlfvtat)a2tmxmp;u4altniiciltfsDemuvo t0tetoxo to1opteai ilt  2xo(rpnudlpenmivsl(  2rrx pou0aeeniicilsfa rluvs u4treoxfcoadoaDelueo;t teur(m nu4op emici s)arumx pou4opeomfeiydfa ra( snt0altnif3ty1lp e u o;( trtrxm iu1lltnlics tfaDrrxm ot0tleniociytla ea(vpnt0aexomr3oydfmtrai i s) 2urxr3oydlpe mnvs s) Dtmurono0oetnmiciytla2elnvo;(4 exrir oo1fp eluvo s srxriopiy4lm   nesatfarrrx  nu0opxomieiyd a2rauvp;t0 renio oytoptraieo;s)texmxmpiu4om e fcils a2taxmpoo4apxo feiyslmDrauvs;(4 leoxf3ia1fa e u i t) 2um(m oy4lp  mneta()aDumxr ;o0tle  fctatla2rl( p;t0tlxrio3oydfaD ln i s0 rurim iydlm nliet s aruaxrpno0alxoioeilt a2ra(mpn()alenmrctydfpDeanes;t0s2uo(r iy4altelfcs sf 2ur(mp;u0oltn oeilsla2ulnms;(0altoxrcoy1lpDranvolt)t2toirpoo1omtnlivils  2tm(rp;u0aeto ieiyt a uln o;t4 rtrxfcoytlpDe ueolt sruoxopiudomenlietlsfaDta( pno0tle miciltfaDranms ()aexrmf3oa1fmD ai sl() 2trxm3ou4ol  lnvs () 2ur(m nt0tpto ociytls raumpnu0arxrioctatopDeaivs t)t2xoimpiodope lnvslsfa2tr(mo;u4tpenmiciytfm elnvsn()alerxfciodomt livslt0t2xoio3ny1lp nlncslsfartrx pou0tpe ioeiatla2rl( o;t0trtnif3ty1lmte nvo s trum(r3iu4lltemfeilt arurxmpnu1texomo3iys mDelnmo;t) rtnmfctadomD  uvols s2xo(m3iy1aptn fviasf Dururo;u4ole  oeilt a ra(ms t0 rtoxo iytfp   uvo;s)tetm(m ou1ale mfctlsfa2rmxmpou0aptn i3tatfaDel(mon()alxomf3oytlm eln ils) rtoirpoy1ameelfvias aDtmum nu4tle mfeiasfa2rlnvo (4 rtrmoctodfmDrln ols0s2urirpnu1am elnct ()sDrru pot1openioeilsls rmuvont0arenifciotom ean i;t seumio nudlmeemivias arrr(r ;o4olxomf3ild mDulumo ()trxnmrcoydomtelneilt  rtr(m3iu1ll nlneilt)s2ta(mo;u0tle  fctlt m2ra(mp () eenif3oo1fa eaivil()teuoxo3iu1am  liei ()sDrm( ono4opto ociltla2rlnvs;(4 eenmr iodoat aieo s0texrio3oo1lp  mfciatfsrumu p;u1ope  o3tytfs2ua(mp;t)alermr tatop eau i;t t2trxo nydape  nciat srraxrpnt1oet if3ils s2ulu snt4treoifciydfat  u s;()trumiopio4alte ivs tfsDrm(roou1apx  o3taslsDrmuvpnu)tlxnxoctydfa rluvo;s)s2xriopnudapeemncil(fs2rrur ot4apxo fciysfs2rmumsnu)arerxo3totfp   u i;()s2tmir3oodamtemictasfa2tau  ;u1alt if3iysfa ulnmo;(0tltriocoatlmD livilt0s2xr(o3ou1lpte ics tfaDuru  ;t1apt  fctltfm2umn o t4 lxnxfcoodlaDranei;t0 2xm(mpno4om e fcilt arraxrono1alx ii3tas a2rlnvonu4tlxnir tatoa rluvsl(  etr(rpiu4lptnlnvs ()arta(  ;t1ape  ociltla eau s t0 lermo ta1oaDe uvi t)s2trio3ny1ol   fcia(faDtm(  nt1alxnmo3tas a em(vsnu0tlxrif oy1om raueils  rxmiopoo1altn ncs s a2umxro;t0tex iietlsfa2em(mo;t0aetnir tydlpDrlnvi ( srxrir3nu4op nlivilt  rtmu p;o0alt mf3tyd a rauvonu4 etnxf ootla   nvi ( trxoxo io4lmte nct s srrax ono0aleo i3iltls emuvon()tlerio ta1op r nei;() exmimpnydom n fviatfsDrrx pot0alenmfciadfs ua(vs (0 rxrircoatfaDr u s;s0 rtrxr io1ope liesl() Dtrxmoou0tpeo ieiytla2rmump t0aeermr io1omtrln o
\ No newline at end of file
@@ -0,0 +1 @@
+uei;t t2trxm3nydamt  netat arrr( p;u0alen f3tad a eluvsn()tltrxfcoo1faDelu s s0texrio3iodlp emncs sfarrrur nu4tlt  o3iltlm2em(vpnu4 rtoif3iy1fp   ueo (0srumxmpnudlptnmivia(fsrrmxrpnu1tlxomfetltls raump;u0aexnmrctatop eln s s)srxmxrpny1al emfcsat) rtmxr ou4oeenifcilsfs ra(vp t0trtoxrcio1lat lu i;( texm(o io4op   feilt)arumxmonu1aex mo3iatla2eluvo;t0 eenmf todfaD li s;s s2to(o3oy1lmen ivs ()aDrrxm ot4apt  feiad s eanvp;(4 rtnxf tatoatelivslt0 rtm(r oo4omt  nei s)arum(r ou4tpx  ociytfaDea(vonu)tlerir oadfat lu il( tetmim3oo1llte iviat srrrxr ot0ape mociyslm em(mpnu4alerxr todomDeai o;t) rumim iudop  mietltfaDtmu  nt0opeomi3iadfs2ulnmo;t0tlerirctytlaDr nvi;s tetrxm oydlptemncs s s2um( pno0oexnmictadfs2uluvs;(0trtoir iy1om rlieslt)s2to(opiy1amen nesl()sDtrx  ou0aee mf3ilsfm2rln pn()texrio3iydom elu slt0 2xmiopou1open nvi t sDtax pno1aexoiicias m rmu onu4artrxr3oy1lptrlnvo t t2xm(m3iodoltn icilt)a2tax pnu0altomiciyt m uln s u0aexrioctodom e n s (0 2xmxo3iodalt mfvias) rtmx o;u0apeo i3iadlm ranvo;t0 lxnxf3oydlmte neil( teur(opio4lm  lfcs sf rrru p;o4teeoifetytlmDumnvpn()tlxoif3iatfp e n s;s trxmxrpio4opte nvsasfsDra(mpnt4optn f3ilt s ra(mo (0 rtomf oa1lp   uvs (0trtoimpny1omtnmivsat a2ur(rp;t1oet  oeilt m rm(vp;u) eermo ta1oatrlnes;t0 2trxr3oo1lp n icsltfsDtrum ;u4tpt mieild a em(vo u4 lerxf3tydfm e u o t)srxrim io1open iciasf Durx  nu1olxo icildfa2rl(vp;u4texnio3oadop e uvsl(  eurxm nu4aptn nci t)s2rmxmp;u1tpe  oeiltlaDelnvpnt) ltomocoy1fa  lnvilt)truoxr io4ap  micia(fs2rmumont4aeen octasfa emnvo;() ltrmf3ta1omte ueol(0trxo(m oodal nmictat srtrxmoot4tetnmo3ilsls umn snt0aexnxr3oydfatrlnes t  exm(r3ny4ol   iesa(f Dtau  ou4oltomoeiad m uaums;u)trerxo3oo1op  livil()truoxmpiy4apenmfvsas)sDuax pno4alt moeiysfs rauvpnu)artoir iydlm raies t  2tmxopnu1ol emncslt) Drr( oot4aexnifciyd aDean p;u0 etrmrciy1oaDraues;s)texr(o3iu1al nmfvt sfs2umuroou1altn iciadfmDulnms t4 etomrctotoa e nvo s0seumio3ou1lme  ivilt) Dtm(m ;u4tle  fctasls2ranvont0 etrmf3to1lmt  ueo (0 2uo(rpio1opeelivi t arraur ;u4ape  ocilt sDuauvo t0 exnxf3oatlp   nvols srumiopiudalte nctlt) Draxmpot0aexoiieiys s2eanms;u)altomr to1lat livil(0trxrxrpoudapee nvtltf 2raxro;u0oetoifeildfmDumnvp;u4tetrxf oadopDrli ilt0t2urxm no1alt  iet tfa2trxmpot4tle io3ias a2rl( o u0altrxociotfp r uvs t sexrxo io1lm  micsl()a2rmu  nu1optomociytlaDea(vo;t4trxrxr3iadop r uesl()trum(opnu1ol  mfcias a2ua(rpnu0ope  o3iadls ean onu0altnxr iydfatr uvol(0 exo(m3oy1lm n fctl()srtrxm ;u0apen i3iytlm2uluvp;u)altoxrcty1fp e ivsl( s2to(mpnodlp elfvs s  rua(mpou1oleo ociytls2umnmo t0tlxnir oytfm r ivo;t  2toxr ny1lm  mfctlt)artm( oou1oetoioctaslm ranmon() rermo3tatom  auei s t2xoxr oo4ame  fet s)srrm(r ;o0oleo icils m emnvo u4altnxrcoy1fateai s ( trumio no1lpt lfvsl( sDuax pou4aptn o3iyd aDulnvo t0arxnxr3oytopDe u o s0 rumxrpio4opte ieslt) 2taxrpno1aeen oetls s2uan o () ltnxoctydopDeluvs;()trxrxopiu4lltnmfct (  rtrum ou1ole moctysls2rl(vo u4aexrxf3ootlpDe neo;( sexrir3oodaltnmfci s)s2ta( oot4tlt  o3tltls em(vpnt4aetomrciytomDelu o;t0trtmxr3nydopeemivsas  rraxrp;o0teeo o3iyd m2emnvs;u0tlerxrcoy1lpDr uvi;s0seuo(o iu1llenmicslt)srtmxro;u4olx mieiyd s ua(vo (0trxoir iatfpDeluesl()srtmxmpny4olenmicsas aDumumpnt1aptnmi3ilt a2rl(mon(0tltrmr oydfaDrln s s s2urim3ou4lpe mnvtls) rrru oot4oltomieilt aDrl(ms t0altrmf ootoptrluesl(0s2umiopiu4ame mics (f rtrxmooo4altnifciat a rl(vs;()teerxf iytfpD  nes;s0 rumxr iu1lpen fetl(  2raumpno4tlx ioctyd aDea( o;t)arenir iytlaD  n i;s  etr(mpny1omee ivil(f rtrxr no1oltomo3ilsla2ra( pnu0 ltoxo3to1la eaiei;( s2uo(r3no1aptnmfeslsfa2rmumpot1oleoioeils sDrmu o;t4aexnmf3io1oate nvo s trxrimpno4olt  nvtl()sDtmxrooo0ope moctatls2ea( s u4altoxr3oy1lmDe uei;s)s2ur(rpoo4lltnmncs ()a2rm(moot4oltomietaslmDrmuvo (4 rxoxr ty1fpDraieol( srxoxo nu1altnmfci s)sDrau p;u1aeeoif3tat m2uanvo;t4aeenxfcootfm  liei;t0 etoxm3ny4al nlfcta()a2rr( oou0tlt  oetys mDrl(mp;(4trtomo tytfm rau o;(0srxoxmpiudlltnmfciatf Dtmurpno4opxomfetad sDeanms ()arxrxf3oadop   ivs;(0srxr(m3nydllt mieilsfaDra(mp;t0open f3tat a2ranvp ()alxnirctadoat  ueols0 rumir ny4ape  fvtl()artmur ;u4tpe iiciasfmDemuvp;u4aexrxoctodlaDrau sl(  etmxo3oy1om  lnet t srua( oou1olxoioctyt m2uan pnu)aexoxoctadoat  iei;( seum(r3ou1lpenmncia(fsDum(m no0olxn o3tys s2em(mp;(4altrxo ootlmDr n ils)setmiopiydomt mnesl()sDrm( o;o1altomociytfa2uln ont) etrif oytlaDe nvs ( trtmimpoy4lmt  ivsasfsDrrxro;u0aexnmfcildla2ul(mp;(4tleoxf3ty1lptrluvi t) 2um(m3oudlpe mncilsfaDtmxm ;u1tpt mieildlm rluvon()tlermoctatfatranes s) rtoir3oo1al e fetlt) rurxr nu0teto oeildfmDea(vp;t0treoircoy1lm eaivslt  rurxo3oodolt  fvs ( a2raxmpoo0alx  ocild a rauvpnt) rxrmrciotomDe nvs s0trurxmpiydamtnlfcias  2umum ;u4opeo ieilslm rl( snt0arenio3ootfp rlu s ()trum(mpiudapt mictasfa2uru o;u4aex  ocilsla2rl(mp (4aexrif3tytfpDrlnvs ( t2umxrpoy4opee feias) Dtmuront1oeeo oeilt m2ra( o t) lxriocio1fpte n i;t0 exmio iodlmte nciasf Dtmxrp;t1oexo icilsfm ua(vp () eeoio3ootomtrauvi;t0t2uoim oo1oltelfcsl(  Drau pno1tpeo i3tat a ulnmpnt4aeermo oo1op r ivi t)s2urxr3io4ope  nvslsfsrtmxr no0aetomociasfs rlumpnu4alenir iytlmD lueo s) eto(o3oo4oltnmfei (fs2umurono4tle mociadlm2ea(mo;u)aeeomr3iodfp eau sl( s2xm(mpiy4lpenmnvtls sDta(mpot4tetnmicild a uanvsnu4 etoxocoodla rlnvs (0t2ur(r iodom emfcia( srrmum no4tpto ocils a2rlnvpnt0trtnmf oa1faDrlieo t)teuoio nu4lpeemieils)s2rmx p;t0alxnio3iydls2eanmon(4 exnmf3tytlp  auvo t)tetrxr3nu4ope lfcs s)sDrr( pnt4opeo fcilt aDra(vs;(4alxoif iytfpDr n i s) 2tmxopoo4aptnmnvta(f Duaxmpou4apt mo3iadlm rm(ms;u4 rxnifctotlpD  ivol()t2urimpnudoptn iesls a2tr(monu1apeoii3tltfs umn s;t) lxrxr tatfatranes t)texrxo nodlpte fetasfarraxmpnt0tleoiicilt a eau p;t4aleomf totopD  neols srxrirpnudal nlneta()artaxmoou0tlx ifcilsls2rau ont4 lxnio todomt  ueo;s s2trxm3oudaptemivsltfartaum ou1oetnmictad mDrm(ms;t0aetrxr3oydfa rln o;s trxrxo3oo1ll  lnvia(  2tmx o;u4tpx mfeiltfa uanms ()tetnxf3iodfpD  i i;t  rxoir nydlpen icil(fs2rrxm ;t0aptomfeilslsDrl( o;()trenmo3oa1oatr neo s0 exoxopiodlmtelnvtl()sDur(mpnu1alt  octyd m2ulnmsnt4 rtomf3oatfp r ueilt)seumxr ou1omee nesls s2umxrp;o1opt  i3iytfm2emu pnt4alxnxfciotfmt luvols  2umio3nu4olee neilsf ruaumo;u1aexnmi3ils sDeaums t4tltrxf tadlmDrau o;(  rxoio3oydlpe  iei ( a2rmumo;o4oexomieiatfs2eauvs;(4teermf3tytom e n ilt0tetr(mpoo4omt mfcs s)s2ua(roou0tle mo3iadlsDumuvont)texrmr tadfpt livs;t texoiopoo4lpeelfvtl() rrau pno4oex  f3ildlm2eaums ()trtomo oytopDe ivils sexm(m3iudap elnesl()sDur(m ;t0alx io3iydfaDulu ont) lxoio tatlptelivilt) euoio oo4omtnlies sfa2umxr oo0oetoioeilt m2ua( ont0teenxocoy1omt  nvsl(0 rxoim3nudomt liet sfsDtaump;u1apeo octadfs2rmu pnt0trerxr oytfaD lnvi;s tetr(m oo4opee ivt sf ruau o;o0opt mfctld a rl(vont4trtrir3oa1la  an s s0s2xoxopiy1om n net sfaDrmx p;o0tlxo f3iytfaDumums t4altoir ty1laDe nvi s srtoimpoodam nmnctat  Durxrpnt1opxo i3tldfa ean s;(4 rxnir3iadfat an sl( setoxmpoo1lmtelfes sfaDuax  nt0apt  i3iadfsDrm( o t4tlxnxr iotfmD li i;t0setrxo oy4amt mies s arumx p;t1apxnioeiadls rmnmsn(4tleoirciotoateli il(0texrxm3ny1ap e fcia( artr(ronu4oeto oetls mDranms;u0 rtrxrciodomDrli sls  rum(o3iydam n fesl( srrru  ;t1tlxoii3ilsfs2emn ont4aeenif3oodom r ues (0 2tmirpnodllte fviat) Dta( p;u4teeomieilt mDumnvon()artnmrcty1fa rauvs;t s2tr(mpoodolenmnvta(fa2umxmont4oexoiiciadfaDem( o t4arenio3todfa e ivo;( srxmxm3nu1omt  nesl( a2rr(  ot1tpt  ieiysfaDrlump;u)alenioctatlptr n o (0tetrxmpoodop  mietat) 2tru  oo1alxn fctlt aDuln s;t)alxnmo tadfm  auvils)tetoimpiydap  micia(f Dtrxm ;o0tpeoifetadlm ua(vsn(0 rtnmf3ty1lmDeaneo s0seto(m3oodlp e neils a2tmum ot1aexn oeiadls2elums;(0aleomo oodfa  lies (  2xoxopoo4amen ivsa(  2trx poo1apxn f3iatfa ranmpn(4 rxomfciatoptrlies;(  exmio3iodlptn fci () 2rm(m ;o0oltn o3tltfs uaumsn(0 eerio3oydlpt li s;s trxoxm3oo1lptemiei (fs2rm(ro;t0tpto o3tyd m2eau o;(4tltrifciydlpD  u s s) 2xrxm oydllen nvta( a2ur(roou1alx  ieild sDrm(ms u4trtnmf3ia1oatrlu o;t sexmim3nu1am e ieiasfa2umu pou4texnif3ilsla2umnmp;u0tetnmo oodlp rlivil( s2uriopny1lmeemnesa(farrr(  oo0apx  fciat sDul(ms (4artomr3iatoaDrluei s0teumxm3ou1omt mfvta(  2umxrp;u4tpxomfetls sDel(mp;()tltrmo3tadfm ranvs;s0trtmxopio4om   ivsatf Dta(r ot0aeen feiad s uanmo;(4 rtnmfcoodlp r ivo;()srxm(o oo4olen icta(fsrraxr ;t0tpe ii3ilsfaDra( pnu4altrirciydfpt  u i ( t2to(opnydlptnmicta(fsrrm( poo1oeenio3iys s2um(ms;u0artrifcoy1lm ran i;t s2urimpoy1lpt  feia(f 2tm(m ou4olx mo3iasfmDua(mpnt)areoif tytla  lneo s0sexmir3ou1lme lietls arua( oot0apeomfeiltls umumsnt4 etnmf oatlmtraivslt0texrxmpiydlp  miei t)aDuau pnt1alxoio3iltlmDeau o;()altnif3oa1om eai o;t  eum(m3iy4omtnlfct t)arra( pnt4tlxo o3iydfs rluvo t4tetrircoydfp ean olt0srxrxrpoo4ap  mfct s a2ur(rp;t1tlt mf3ilsla2ea(ms;()arxnxrctatlpDe iei;t0t2tmimpou1amtelfeilsfsrrmu  no1oex iocias sDua(vp t0aetrxr3iadlaDeliei;t) ruoxm3oy4lltemncsas aDuaum ot0aptn oeias aDeau o t4trxnmf3ootfa raieo;t) eurir io4ameelieia(farum(mpno1optomfetlsfa umnvp (4arermocoodlm   nvolt0tetrim3oudlp  lieils)aDta(ro;o1tpeo ieiyt mDuaumsnu0 leoxfctydopDeaneol( teuo(r3iu4am n ieilsfa2tmx p;o4ole ii3iytfa ean s;t)tltoir3oy1om elies;(0 rtrxm3nydll e feias srrm(m ;o1teeo iciydfaDeanvp u) etrio3iotlm  lieil( s2ur(mpio1lptemnvsl() Dtax  oo1optoii3iadfa2ean snu4 lerifciy1faD ln o ( setmxr3iodaltnlnesl( srtrxmo;o0tptomociydla emumonu) rxoxo totfpt  nvs t0teto(mpoy4lp nlfvs t  2rax  ou1aetnmictls a emuvpn(0 rtrxo3oydlptrlneilt0srxrio iydoptnmivs s)s2rm( o;t4alt  i3iydls2uauvont)trtnmocoatlm   uvs s) 2xmxrpiodlpt  fvsa(f 2taur ou0tlxoii3ilt aDel(ms;(0 eeomfcia1faDrlnvi;s0 exmxrpiodamt  fesls a2tm( pno4apxo oetltfm rmnvs (0tlxrif3oatlmDr u slt) 2toxopoudomtnlfes (f 2rrumpot4aptn fctlsfm2raumonu4aetniocio1fpD  nei t) 2um(r3iu4ame lncil() 2ua( ooo0oetomieiysfs rlnvon()aetrifcoa1la e ues s)srto(mpio4aleelnei (fa2uaurpot1teen iciat aDul(mpnt0artrmfcty1fmDr ivo t) exoxopoy4ale lictlt s2tau  no1tpen fcilsfs2eanmo;t0aeeomociadlmtr ies t0 rtoimpiy4lpt  iesasf rum(rpot0tlenmocildls ra(msn()trenif oy1fatr iei ()t2uoim oodapenlfvsl(farrm(rp;t4oexoioeilsls2umnvs u)artrif3ta1lptelu ol() 2xoir iudope micta()aDum( ono1altomfctydla raumo t0tlxoxr3oy1la  li slt0sexmxo3iydol e fetl(  2tm(m ;u4oetomo3tyt m rl(von(0tltomf3totfmDe n sls)t2um(o3oodom nlfvtasf Drrxm nt1alxo oetlt s2eauvp u0altoir3oydlatr ieo s s2umxmpoo4lp e fviatfsrrru p;o4tlx  fcild m ra( pnt4 rtoio ootfp  ln o (0 rumiopnodole  nei sf 2uau poo0oleomfciyd mDeauvp;t)tltrxocty1lmDr ieo t0trtoio3ny4alenmicia(fa2rmu pno1tpe mfciytlsDemuvo;u) rxrxocootom   ueols)t2umxopny1lm  mivt (fa2um(mp;t1apenmicils m emu sn(0 eeoxoctodoa eli o;t0truoxo no4lp nmnet () rrmurpou4apx  octltlaDrln p u0altrio tatom   uei ()t2tm(o oodlpenlnvi s a2um( pno1texoioeildls2ulnvsnt)aeerif tadlateaues () 2xmiopiudamtelnvtl(fs2trx pnu0tpenmi3iadls2el(mo;t4tltnmfcoodlpD  uei s0s2xoio nydomt  fcs s) 2rmu  ;u1optnmf3iydfa2emnmont4 ltrifctydoa e uvilt) 2tm(o3ou4lltnlicsa(  rrm(r ot4opxn o3tysfaDrmnms;t4treomf3totoaDeln i s)trurio3iudamee ivi t srtaumont1tpxn o3iydlm eluvo u0trxoxrcta1fpD lieilt0 2umxr3ou1ll nmfesl(fsDtrxrpot0aetoifciltfm2ranmp (4artrmr iydom rai o s trxm(o nu1op elfeils)sDrrxmo;t1aexnmicilslmDrlnvont)aetoxfciadlatean s ()t2uoim io1ol nlfetasf rum(ronu4tpxn ieilt aDeauvpnt)arxnxr ty1laDranvilt  eum(o nodol nmicias  rum(rpnu0alx mo3tyd s rau p t)tltnmr3iytlptrlnvo () rxoimpnodlm  mnvsa() Dur(  ;o0tleniieiasfsDranmp;t4 lxomrctadfm r ivo ( t2xm(opiu4llt mnvtat s2rrxm no1alx iieiatla rm(ms;u)trermrcty1oateln i;t0t2trimpoo1omtnlfvtatf rtm(m nt4tptnmo3iadla2um( s;() ltnxocta1lat ln i t  etmir3nu1lptn fvs (  rrr( p;o4olxniiciydfs eln s t0aleomociydopDrli slt0sexrir ou1ome  feilt sDumu o;u1texnmf3iydfs rlnms;()aeerir oodfaDrauei;t sruoio3oy1alenlieils srraxmpou4oee ii3ils s2ea( s;u)trxrxr3iydoa rluvolt s2xoiopoo4lptn ivi t)sDtaxrono4opx iocilsfm eln sn(0trxrifciytlmD lies;s teuo(r3nudal  mncsl( s2umurpnt0aee mo3iytfa emu p u4 rtrxr3tytopDrlnvs;(  etmio nu1lp n ivi t) Dtm(mooo1oetoif3iatfa2umuvs t0teermr oydop ean slt0 rtm(opiu1ol nlfctatf Drmxmont4tlxoifctys sDea(mp ()trxrmrciytla eanvi;s setrxo iy4lpt lnctl(fs2uru p;u4tlxn ictad sDem(vp u4 etoiociatom  aueo;t0s2xo(o3nu4ope mfcsa(  rumx  nt0olxomo3iatfm el(vo;t)trerxf iy1lp eauvil( s2urimpoodameemfvs s  Dtmx pou1teeo ociadls2umumo ()altnmr oytlp rau o;s  2umxm3ou4olenlfctl( a2rmumont4tlt ioeils sDul(vsnu0arxrmf3ootoa   nes;t srtrim oy4lp n fci ()sDumx ono0alt ioctydfmDra(ms (0 etnio3iotfaDelnvsls)setrio iudlp   nes ( srumump;o4oeen ociasfaDuanvp u0 lxrxf oatfaDeln o s0trur(o iu4olt mics t)sDrr(mpnu0alt miciatfm2elnvsn(4trxomrctatlmDeluvi s) exmxopiydamt licsl(  Drmxmpou1altoiocilsfa2rmnmont0altomocoytlp e nei t t2toir3nu4llee ict sf rrmu ont1tex mi3iatfs rm( pn()teeoxo iotomte uvs (  2ur(r iu4alte nvt sfs2uaurpnu1teenifeiyslm2ea(mo;t4 lerif3oadlptranei ( t2to(r iudaptelicilt aDra(  ;u4oee  ieiadlm2ulnvo;(0tetrxo oy1lat luvo;s) 2ur(o oydaltelieilt)aDtr(mp;t1oleoio3iat sDranvp;(4tetnxf oadoptelivol(0 2xrxrpou4ap e ivt s sDrmxm ou4ape mf3ildlsDrau o u0aleniociatla r i slt0seumxmpnudamtemnvt ()sDraxr ;u0opx mf3iadla2ea(mp (4areoxrciytlp e nvslt)srtoio nu1optnlfcil(f rta( oou4opxn oeiasfa rlnmsnu4aeerircia1opt ln olt) 2xrio3iu1om elnvs t)sDuaur nu4oet if3iadla2rl(vo;u4tetnir to1laD  i ils srxoio3iodapen ictatfsDrrx  ;o4aee mi3ils a2em(vp t0 lxrxociatomt anvsls0 2xm(opiy4lmtnmiesls aDtru  ;t4oexoiiciat s ran o;(0tetnifctydlmD auvo;t srtrio3ny4lle  icils  2ra(m ou1tetoifeiatlm2rlump;t4aexnif iadlmDr i olt) exoirpnu1ol  lnvil(fa2rrx pno4tetnioctatlsDuaumon(4tlxnxo3ootlm eai o (0 rxmio3oy4optelfesa(  Dtmx ooo0alxnmiciatfa ua( o ()trtnio ia1fatr ueils)sruoir3iodal nlivi (fsrraurp;t1aetnmi3iytfsDemn ont0tltnxr3iotla   i o;s0s2ur(r3nu4omenlicia(  Duaxronu1oleomo3iys a rm(vs (0 eeoif3oydfa rlieo (0tetm(r3io1optelivtat  rtmxr ;u4oetnmieiasfa2rmu s u0areomf to1omtrlu o s) 2tm(o ny4amtelnvia(fa2tru  ot4tpx  oeilsls2ranmpnt)trenmr ootfpt auvi s)s2urxmpnodlpe lnet t)a2rr(mont4apeo octadfa2ra( pnt4tltomo oo1la  ai il(  etmim oo4lm  lneias) rrm(r ot0tpt iieiasfa2rlnmpn(0alenxoctodop rai i t)s2urim nu1oltn fcia()srtmx  nt0olx iictasfm ea( s u4aleoifctadomt  i i t)sexrxopoodap nlieia(f rrm(rpou1tet iietyt aDeluvp;u4texoxf3io1lmt  n i;s)srurxm iy4omenlfci tf 2urumpnt4oexomf3tlslmDuluvp t)artoxfcoa1lpDraivi t0 ruo(opiodll   netl() rtmx o;u0tpt iieild s ua(vsnt4tlxrxf ia1oa rai s;t  euoxmpnudap nlfct ( arrr(mono0alxo i3iasfm2uauvp;(0trxoio oodoatelivo ( s2toim3oy4ale  ncs tf 2ra(r nu0altn fetldfaDuluvs;t0trxomfcoadomD  i s;t0s2xoxrpoy4ole mivi t  Drrxmoou1oex  fciytls umn o;u0teermo oydlaDe u o t t2urxopiu1op elietlsfsrrmxm ;t1tex  feiaslmDum( o;(0tleomf io1latrlivs;t)t2xr(rpny4lptn ivtltfartaumono4alx mf3tadfa2rmnmp u) etoio3iotlatr ivi;t0srurir3io4olen ivt t)a2raxr ;t0alxnmi3tyt mDel( s u)altnxo oy1lm eli s;s t2uo(r nydaptemivia(fs2uaum ;t4aleoiocias aDea(vsnt4aeerir tytfpt aues s setr(o3io4openmfctat  2ur(  nu0optnmfetyd m ra(mp u0alenio3oydfp raiesls0 rur(m no1lpt miesl()arrrum ot4teeoii3iysfa2rauvp;t4altoio3iodlmDelneo;(0 2urxm io1aptelnvias)s2raur ;t0oexniiciydfm ulnmpn()trenxocoy1oaDr ueo s0srxr(o nodame livtls  Drm(mp;u0tlxoif3ildfa2rauvs t0areomf oydlm  anvs s s2uo(o3ny1alt mnesls)a2umu onu0alx  ietlslm um( o t4arxnmf3oadla rauvo;t)t2trxo3iy4ape  net s aDuaxrono4tltoiicildlmDrlnms t) eenifcoodlmD aivil(0s2xoxr oydoltn ics (  rrax oou4aeeo fciasfa umnvo (4aetomr iy1lpDrln s;() etoxr3iodalteliesas  Duaxm ;o1aetoif3tys m2rl( p (4texomr totlmtrlieo t)t2tmxr iu1al nmfeiltf Dtm(r ot1olt ii3tld a2ulumpnt4tetrxf oo1opteaneslt srxmimpoo4lleelfes s)a2raxm no1tlenmfeiadlsDra(vont)tlerxr3ta1lp rlieo;t0setmim nydllte ncsat)srurxmpot1opxn o3iltfa um( p;u0 lxomf3oadopt lieil(0s2to(r oo4al nmnctat) Drrx  ot0tee moctatfmDra( p (4tleoif oa1fpt aueo (  2xo(m3iu1opte fvt t a2rax ont4aeeoioctytlmDra( pnt)artrmf to1lmte neils)s2uoxm oo1al  lnvi tfsDum(mp;t1optnmo3ild a uaump u) leoxocio1lmt lu o t) 2um(r ny4lpe lfcs ()aDuru o;t4aleniociasfmDelu p;t)aeeoxfctodfptrluvo;t)srxo(r3nodll nmivtl(f rta(  ;t4oee  i3ils m eauvont)aeeoxociotlmDran ols  rumir iu4optelivt (fa2rm(mpoo4opxn o3tltfs rmnvs t0aetrxociy1oaDrluvi;t t2toxopnudop e fvsa()srra(m nu1tltniictltla rl(monu) eeniocoo1lmtrln ols  eur(m ny4al nmneias  Drrur no4aetomf3iytls eln ont4 exomfcio1omDe uvs;s) 2trir3iodal e ics t  ruru  ot1aetnifetldla rmn pn(0arxoircoydlpte uvs ( seur(m3oodopte fvt (f rum(  ;t0olxo o3ildls2rmumo;t4 etoir3iotfpte nvs (0srtmxopoy4ole lneslsfsDrrxmpot0texn oetyd s2um(mont) ltnir3oodfateaivsl() etrxr3ny4om  livia()srumumoou4ale  fciatfa uauvs;u0 lerxrcoy1fp e ivi;() exrxo3no1ope mfes s srum(mo;u0alen oetadfa uln o;(4arermo todfpDeauei t0sexr(m3oy1omte nvt s)s2rr(r ot1tpt mf3ils m el(mo;u4trxrmr3oy1fmDran o;t setm(o3oo4am  liei s sDurxm no4oleo i3iydls2elu on()artoir iytlaDrlivi;t0t2trxm iydome lnvtas aDurur ou1apxo i3iysfaDem(vo u4aetrxo oodfmt lu sls0texo(m3oo1lm  lnvsl()sDtmxrp;u0oet ifeiyd s2rmumo;(0aeermrcia1optrlu s;t0teum(o3oy4lmenmfci t  rum(m ;t0aeen f3iadlm2uln ont)tltnmo iadop   neo t0trxmxmpny1altnmfcsa(f 2tr(ro;o1aetnmociadfm ulnmsn()tetnmrciydfm ean olt texoxmpou4lptnlieil() Dtru oot4tle mociasls el(vont4arxrxf iotomD aueils0s2tr(m3io4amte nes sfa2um(r ;u0alt mieils mDranvonu4teenif tadomte n sl(0srxrxm no1lleemieils)artax pou4apxnioetat aDuan o ()teerxrciodop r n i t)setr(m nodolenmivsls)s2umxmpnt0aexnmictls aDemnvo;(4 ltrir3oydoatr neslt0 ruoxmpnodlmenlfetl() Duru ont1oee moeilslm2ul( p (0teeoxfctytlm  lu s;t) rxo(o oo1alt lnvs ( s2ur(mono0aleo f3iydfa2elump;(4treoxrctodfaD  ivs s sexmxm ny1lpe lfcs s)arurxm ot1opx ii3iytfmDrau s;t4aexoircoa1op e i o;s texrxopny4apeemnetatf Drrxroou4ole ioetldls2eaums;(4 ltrxr oadfpDe iei;s0 exm(r3ny1lptemfvi s) rtrx pno1oet  i3iatfsDumu o () lenmo ty1op   nvo;s teumxr oy1lptnlfesa( arrr(rono0altomieiatfmDuauvsn(4arxnxfctydlatrauvolt0trurio oo1ol nlneils)s2rmurono0aleomfciyd aDeanmsnt0 leomr iy1fpD au sl() eurxopoydomenmiesls)sDtau p;u0aet  oeiltfsDemumpnu0artnmo3totfm r ueils0t2um(opoodlp nmfetas)srtax poo0alx io3iadlmDel(vont0 renmr totopD  nvsls setrir ny4ome miet t)a2taxr ;t1tle mictaslsDeanms ()tltrxf oadoaD lieils0seurxrpnu1oltn ncslt)sDra(rono0apt ifeilt a2ulu p () lxoir oodfaDeaues;s0t2uo(opny1open ivtl()srtaur no4open f3iat s2emu s;(4arxnxocoadfmt aieilt0trxrxo nodlptnmnvsa(fa2ur(ro;t1olx  o3iytfa2ea(mpnt0 rxnifciytom r u slt) rtm(rpno1lp emfcilt) 2rmxr nt0altnioctatfs2emnvsnt4 leoiociadoateluei;s teumxr3iudlmt  icil(  2rr(  ou1olx ifeiydfaDrlumont0 rxrmo oodfm elnvs;()seurim3iodom nmnctasfartmum nt0tpxn o3iadfaDumnmo (4tlxnmfciydfpte ueolt) exo(r3ou4optemici () 2rmurpno4oee mi3iad s2emumpn() rxoxr3ia1fat lnvi s0 eumim3no1llenlieias)sDtmu p;u0tpeo ieiys a2uanvs u) reoif oodomtrauei;s  rtm(r oudll nlfvta() 2ra(mo;o0opto i3ildlm2elumsnu)teeoxrcta1fmtr nvo s tetmxopio4op  mfcs ()aDraxmooo1ole  f3iatls rmuvo;u4tlerif3iatfa  auvsls) 2xoio iu4lle mfvtatfs2tr( onu0tlt  f3iydla rmn pnu0teerif tydoa rln il()s2tmxo3oudamee nes sf 2urxmont0tle  octlt m2emums u0treoif3ta1laD livo (0t2uoiopnydlm nmnci sf Dtrx  nt0apt mieiysfm2um(vs;()teenio3iotfaDeai i;s)sexoiopio1altn ivsa()s2ur(rpnu4oexo feiad a2elnvs;u0trtrmo3iodfm rau s s)t2umio iu1lme mfciatf 2rrurp;o1oex mieiasfa2emn s (0 etnxf io1lptr ivslt)t2uo(mpou1lltnmfesasf 2rau p;o4tltomieiytfaDea( s;t0texrxoctatoa e u i ()seurxo3io1ame lnesasfaDuaxmpnu1oetoifeiydla2ra( o t0aexoif oy1fm ean i;t)trurxopoy4ll   ivs sfarrr(mpno1tpenif3tlsfm2emnmsnu)aexrio ootopDrlieslt  eurir3ny4omeelfct tfa2trumo;u1aex  o3iyt m emuvp ()aetrmr3oatlate nvo s srurxo io4ome  ictl(f 2rauro;u4openmf3ilslm2rl( o;u0teenif3ia1fpte i ilt0t2xr(r iy1ll  mfet (  rraumpno4altomoeiltla2eanvp (0 rxnmo3tatop rai i t s2tr(o ny4altemfei tfa2ua( pnt1openioctatla eanvp u0aexnxo3iotfmDelues s sexoxr3nodlptnmfct t) Dum(  no4tpxomf3tlsls emuvs t)texrxr tatop  lnvo;s  rumxrpou4lpte fcils)a2ra(mooo1aexomoeiyd a2rlumsn() rxrxf ia1om  ln olt0 2uoir nu1om emfcils sDtaumoot1opt if3ilsfs rmuvo ()areoxf3iydoa eluvs;s s2xrir3oo1ol emnetl(fsDur(m oo0aetoii3ils aDrln p;()tlxrmr3iy1fpDrliesls0sruoirpiu4ap   ictl( srrax p;o4tlxomi3iydla rln p;(4arxomf3iy1faD  n sl( s2xrio3io1apte neta() 2tru  oo0aet mfeils sDuluvpn()artrif3oa1omte nes t tetrio oudop n nvtlsf rrrump;o4apxomociytfs ua( s;t)alenioctytlm rli ilt)texoxm iu4optnmnesl()a2tmxrp;o1optniocild m2uln pnu0 exrxf3oo1lm elu ols srto(r3oudop n ics s) Dra(mo;u4tex mfeiat s ulu snt) etnio totfa r uei;(0 rto(r oudomeemicsa()a2tau o;u4aeto ietldlsDumuvs u)texnxo tatfptrli sls) 2xrim no1olenlfei (  2tm(r ;t0olt ifciytls2emumpnu)teeoio oytfm elnei;t  rxm(m3oudlpe  ieia()aDtaumooo1aptnmoetydfsDelnvsn()aexrxr iydlm   nvi;t srtmxr oydam emfesls artaur nt4texoif3tld sDrmnmp t4 eenxo tytoptrln i;s)texrxo oo1aptnmietasf rtax pou4tpxomf3tasfs2umnmpnt0tetrxf3tytlmD  u o;t)srtoir iydomeemncsasfaDtaxrpnu1tpe mo3iatlm2rauvs;t)trenio3iy1oat aieo s)s2xrxr3oudamtelfvi s)srtrx  nt0oleoioctltfsDumnvo;()aeeomr3tadlmD li olt)setm(r iydam elnesatfa2urur nu1tptn o3ilt m2uanmp;u0arxoir3tydoatr nes t)srtoir3iy1ap nlivtls srrr(r ;t1olxnmfciltfs2rln onu4teenif3iodlmDe uvo t s2xo(r3oo1lltelfet t)s2tr( p;o1oleniieiaslmDeluvs;u4 ltrxf3iodom rauvo t0s2xoim iu1ape lfci t)s2raxrooo1opt mfctlsfm2eln o;u0tetoif oo1om eaivsls0trtrimpnodap nmnvtls srtmumo;u1olxomi3iatla2um(mp;t0texnmo3iadlm eau s;s0t2urxr3iudlpt  ivtatfsrraxm ou0tlx mfeildlmDeau s;u0alxrir oytlatraivo;(0 rum(o nu1lpenmfei t  rraur ou4oet  feild m raumsnu0trxnxociytomt  ivs (0sexmxopny4altemnei (f Dumx oou0oltnmieils m2emnvs t0treoif3ia1oa eln o;( t2xmiopnydopeemfvia( sDua( poo0tetomoetysls eanvsn(0artnir io1lm rlivi t t2urio3oy4llenmfeia( artrump;t1aptoiociyd mDulu snt0trermf3tadfp   u i;t0trto(o ny4llee iei s  Drr(mpoo0oexoioctasfmDeanvo;(0texomf3oo1lpteaieolt)srum(opnydlm elneias) Dta(roou0alen fetasfm uaumpnu4tltnxfcoadlp e i olt)s2tr(r3nudlpen fcta( s2urxmoou1oeen o3iltlm2rm( p (0tetriocio1oa  auvol()t2urxr3nudap nlics sfsDrrx  nu4tpe if3tldlm eau onu0artoif3tydlmDraiesls)s2to(m oydame  nvils  2raxmpou4oexomfeiytfa rm( p;()alxrxo3iadop  ln il( srtrxmpiu1ap elfvs t)a2rrxm no1apxo ociys sDrmuvs;t)alxrir iodlat lnesl( s2xmxrpno1lm elfcil(faDua( ono4ole ioetas s2rlu o;()tltoxo io1oa  aies s0srtmio nu1llenmneiasf Drrx ono0aptnii3iyslm rlnvp u)aetrif3oy1faDelnvs;(0srurim oy4amenlfvil()a2umx onu1apto oeild aDelnvp;t4 etoxr iadlp rlieo t)setrxopno1llt lnctls a2rrump;u4ole  i3iydfs2rm(mo () leoifcoydlpD li o;s)t2tm(o3nu1om nlnet ()aDra( o;o4aexn iciyt mDeauvon(4alenif3oadopD  uei t)t2xoimpou1ap  mfcsls  rur(mont0tpx moetldfs2ea(mp;()aleoxo3iadfmt ln sls s2urir ou1olenlfvi s) rrr(mpno1alxnmfeiysfaDeaumont)treoiocoa1lpte n s t0s2umio oudole mieiat)aDra(mp;o1altomfeiydlm2rlumon(0tlxnxf3oydfaD lnes;t trto(r no1lpeemnvsl()a2tr(moot4tle iietyt sDem(msn(0aleoircootlm ran olt0 2tr(rpiu4apee ivi (faruauro;o0oeeoiieilsfs2emu onu0tlermr oatfa  luvs s t2uo(m3oydolenliet (  Dur( ont1oeenii3iat m2rln o;t4trxnir tadoaDe uvol(0trtrimpny4om e ietlsf Drmumpnu0tltnmoctyt s2em(von()arxrmrcoodopt au s;t  2ur(m iydap e nesls a2trx pno1apxomf3iadfs2uan o u)alermo3iytom r u i ()sexrxopou1ome lnvi ()artrxm ;t1tlxoifeiat mDuluvsn(4texnmr3iodlmtelnvo t s2toim ny1lm elnvi s aDrr(m nu1apeoiieild sDua(vpnu4tlxrxf iydop eai o;s)srurxm3iodolt lfeta(fa2trur no4tptomf3tyt s2emn s;()tltnxr ty1oa   uvs s0truo(o3oodamen ictl( a2ra(m nu4tptnmicilt m2eln snt0aetnmfcio1fpDrluvo s s2xmxm3oo1optn fctatfs2tr( o;t0ope mociydfs rl(mp (4 lxoiocty1lpt luvol(0truo(m nodaltnmiei s)a2tm( pnt0tptn ietasla rau s (4trtrmfcto1opDrluvi t)s2tm(o no1lmt  neta()aruaurpot4tpen o3tad sDranmon(4tlenmrciotlpDrauei;(0s2toxr ny1amt  fvs sf rtau ono4tltnifciltlm2ulnms t0alenifciydlm rln i t srxm(r iy4amtnmiet (fsDuaurpou4apeomi3ilslm ra( p (4 lxrif3oatfate u ols0setr(r nu1lp   ictlt) Drax  ;t0aee  o3iydfa rau snu4 lxrmo to1faDe i s;s)trtmio3iy4optn fet s a2tr(mp;t1apx mieildfm2uanvo;u) exnmf3oydom  anvo t  2to(rpoy4oleelnct s)srumxront1aeen fetaslm2uauvon(0tetrmo iytop raiei;t s2xoxrpoydlp  mfvtl()a2uau o;t1tpenmfeiytlaDulnvp;u)tetomocoodfaDrln o () etrio3iy1lmt mies sf rrrxr ot1aetoioctatlaDrm(mp () lxrxrcoydfp eluvils0trxmxmpio1lm e ivs s)s2rmxrooo1oeenmieiat sDrmnvpnu0teeomf ta1fmteanesl()trtrimpiu4aleelfvsat)a2ua( pnu4ape  i3ildls2um( s;()trerxr ta1lp  aivi;()seum(rpiodlle  netls  2rru ono1teenmociltfaDem(ms;(4trxnio ty1oaD liei (0sruo(o3oy4om  miei s a2ua(  nt0aleniociat m2ul(vs;t) lxnxr io1lmD auvi;t)s2tmxopnodap n ncils)srtmuro;u1oexnmoetysfa ran snt0aeermo3iydopD aies s trxmim no1omte nes s a2rmur no0olt mo3iatfaDelnvsnt4tltrir3oadfmte u ols s2umim iy1amtelfvsas  Drm(moot0apx mi3tysfsDrauvp (4tltoxf iytfaDr ivolt0teurxm oo4omt livi t artr(rp;t0aexo feiltfm emnvo;t4 leomr iy1fpD  u slt) 2xr(o3iy1lpee ivi t)artax  ;t1teto oeiytla ua( p t0alxnxr3iatlptrai olt texo(o3ou4ll emnct t)artaxr ot0ole mfciys mDeln s;t) reoifcoydfat lnvi ()srum(rpoudalen nciatfsDrru onu0ape iieiadfmDem(vp;u4artrmo3ty1oat  ies t trxr(rpny4lp elncsa(faDtaxmo;t0oetn ieiydlm2ea( p;t)artrircoytfa e uvi;s)setr(rpio1omtemfeta()arraxm no0oeeomociys s eau p t0texrifciadfaDr u i;t)t2xmio3nu4optemnvsl(fa2rmumoou4olto o3iytla eau o u0treomr3totfaD lneilt0teurirpiydlme mics ( srrrurpoo1tpxn ieiat a elumpnt) lenmrcoytlpD liei;t0s2um(rpnu4optn nvia() rrrxroot0aexnioeias sDrluvonu0trtrio oy1lpDeai i s seum(opoudomtelivsas  2ur(r ;o4oee  f3iatfmDul(vp (0 renmfctytlmDeli olt srtrio3iydap nmicsl( srtru  ou4teto oetld aDulums (0texnircoatopteaueo;()texoiopiy1apeelfctl()aDrmx  ou0aet  fetas s ulumon(4aetomf tadlp  auvil() ruo(rpoydlmtemivta() Dtmx  ;o4opto ieiytlmDra(mp;u0 ltnxo oatfmte u ol( seuoxo3no1lp   ies s)srraur ;u0tlto o3iltla2rlnvp;t) exnifcia1la   nesl() 2uoxr3oo1op elietls) Dtaxr nt0ope  oeiytfm2umn o;(4aeerxo3totfpDelu i;()s2xoxrpoodol n fcsls) ruaxmonu0tptoio3tytfaDumuvs;t0 rxrir3tadomt  ues;t sexmio3nodlpenmfetl( srrr(r ;t0apto f3iydla uanmo;()texrxf tydfp  lieil() etmxmpiudamte ict s)sDrau p;u1apx ifciysfs rlnmp;u0 exnif3iydom eli ol(0t2xrxopnydomte fvsas) rtau oot0opxoiiciadlmDua(vs;() eeoxf3totomte neo s  2uoir nydam n ies (  2tru  nt0tlxnioctad sDea(mp u) renifciytopte ueo;s) rtmio3nu4apt  nvtatf Drm(m ot1oexn f3iys sDumums;t0texnxfcoytfptraivo ()setmir oydlp emfeta(  Durum no1optomocild m rmnmo;t0 lxoir to1omte nes;t) rxm(opou4am
\ No newline at end of file
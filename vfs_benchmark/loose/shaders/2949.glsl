@@ -0,0 +1 @@
+ieslt)trxmxr3iu4lle mnet t s2rrxrp;u0tpto ictyslm rlums (0teeomr3ia1laD ln o;s0 exoxm io1aptnlncia(f 2uru oot0olx mieilsfm2emnvo t4altrmf3oo1lp r nei;s)sexmio iu4lltnmicil(fs2uax pno0oltomociyt a rlumont)arxomrciotlmt aneo;( s2xmio3nu1olenlict t sDraurono0apeomoeiat aDrauvp t) renxocta1laD  neils0srxrimpnu1ale mieils)s2uru pno4tltomf3iydlm2um( p;u4 exrxr3oydlmtr u i t0 rxrimpiy4opeelfeia( s2trur ;o1tex  i3iatfs uan o u4areoio3iadfmtr nvil(0sexmio iy4amee nvsl() 2ur(r ;o1tpe ioctlsfaDel(vs t)tlxrmo iadom eanvslt)texoimpiodamtelfvs (f 2uaump;o1tpeoiietad s2rlumonu0tlxnmr oo1fa eli i t)teum(o3oo4am nlfvias) Dur(r ou1oeto feils mDrln on()tetrxf3oydlp e i o;t0s2uoir oy1om  lies t sDrr(r ou1optniieiatfa2uauvonu4aexnif oydla elnes;(  euoio3no1lpte fcs (fsDtm(  ou1oeenmoeildfa2rmn o ()aexoir3tydfa  aiei ()srurir iu4lmt mfvtas)sDrrxmp;o1apeomociadfmDem(mon(0texoxo oytlmtelnvs;s)teuo(rpoo4amenlfvs s)aDtmu p;u1oleoii3iad a2elumo;u0 lerxfcoydfa ranvi s)setoir nodlpeelncsa( aDuru  nt1tlxoioeiyslmDrm(monu4tlxoxf3ia1lpDranvsls0s2toxopou1openlfct t  Dumu oou1opxnif3iadlaDul( p t) etomo tatlpDr nes;t0srtmio iy1opeemnesa()arua(rp;u4oetnmfetasls em(vs;() etnmrctatomD lieslt)teurxr oy4apeeliet s) Dumu ooo4tltnif3iat sDuluvp;t4trtoxr oy1fpt ai s;t  eumir3ny1ol nlnci sfaDumxmpnt4ope mfctas aDul(vp;(4alermr3iatoate i s;t0t2xrio ny4apte ivsasfa2tmurpot0aexn ieiasfa2emu snu4trtrxf tatlmDeli s;t) 2to(m3no1al  mnci tfsDtm(m ;u0optn ieils mDra(vp;t0tlenif iydopt  i s;()trtm(opnydlpt licsl()aDtax  ;o1opx mfciltfm2el(vo;u)texrxr3io1lpD an i s0 2tmir nodole mfcilsfsDua( p;t0tlxnii3ils a ean s;(0 rxomf3oadoatrlu i;( s2tmirpoudal  lneta()sDtaxmonu1teenii3iytfs2eauvonu)aleoxociotoat auvo;t) rur(r3oydal nmfvil( a2rr(mp;u0olto i3tatlm raums u4 eerxo oa1oateau i;() 2xoxm nu4oltn neiatfs2uaxmo;t1tptnmf3iatfm2elnvs;u0 lxrir totom eli o;t)trxoxrpoy4omtnlies (  Dtr( pnu1tleo o3iadfaDelnmo u4altomrciydlm e n o;t) eumxmpou1llt mneta(f 2um(roou1texnmfeiltfa rm(vont0altoxf totomD an sl(0trumxo ou1opt lfvilt arrauroou1olt mi3iydlmDumn s;t)trxomo oytomD au i s srumirpoy4lp e fcsa(farumxmpot4olx  f3iytlsDem(mp;(0arxoxo iadlm ran ils)s2toio no4am   ivt s  rrru o;t0tlt  oetatls em(vpnu)aexrxociydfpt lu o;t)teto(opiodam  lneil()a2umump;u1oleoioeias sDua(vo t)aleoxo oodopDelueo;( teuoxm iodlpenlici sf rur(mp;t4opxnifeiad m um( o;()tetrio3oodfmDraiei;(  exoir3io1lp nlnvs t)sruaxmp;t1aptoiietltls um( s t0 lxnmo3tadlmt au sls srurxr iy4optnlfci t aDra(  oo4tlx ioeilt aDelnmp (0tlxrir oytlp raueo ( trtm(mpoudam   ivtat aDurx  nu0oetnmociltfa eanmp t) eeomo3iydom elues () 2xmirpoodapeelnvia(fa2tr(mont1tet  feiysfs2el(vo;()trxnio iydlate ivolt teur(rpny1lmtnmnvtlsfaDrru  nt1teen oeildfsDrlump;(0texnmo3oodomtr ueils)t2um(r3nudoptnmict sf Dua(mpnu4oexomiciad m um(ms u4artrxrctydlptraivs (0setmir3iodlmenlictas)srum(m ou4tet iiciat m uanvsn(0texnxr oo1fm eanesl(  2umxopoodope  neslsfsDraur no4tle mo3iltfmDumuvp;u0 reomo3totop  ai ols) rurir ou4aptnmnct ()sruru oou4tpxnifctydfsDumump;t0teenmo3ia1lmt  ies s  2xo(o3oy4lleemncia(farrmxm ot4olxomoetasla2ra( ont) etnmo ia1fmDeli s;s)teurimpiydomeelneia( aDraxrono1apxniieiltlm2ulump u4aetomf3to1lpD lueo t0sexr(r ny1apt  nvt (fs2rau o;o0tpx mietltlm ea(vont0tltomf oadlp eaieolt) eurxrpnodoltn fct s aDur(r ot4altoiiciltfa2rlu o;()tltnxf tytfmtr nvi;s)s2ur(r iydop   fesat) 2ta( oou0olxomo3ilsls2rl(mp;u4trxnxrciotlp   u il(0trtrim oodoptnmieias)srtaxmont4ape ii3iasfsDumumo ()artnxo iodlp rln sl() rum(opou1lpee fvt t arumx o;t0tpe mi3iatfa2eauvo t4 lxnmf3iotopt livo;( srumir oo4op nmiciasfa2taxmoou0tptn iciltlm uln on()trxrxocoadfa rlnes t)texmxm iy4llt lfetltf 2raurp;o1aetoii3iysfmDem(mont0aeenxfciatom eluvs s0s2ur(mpou4olt  ncs (f rraur ;t0apeoio3ias m2rmump;t) eeoxf iotfptrauvslt)s2toim nudll e ncsat  rtmu  ou0optn ieild m2um(vp;u4arxnmf oatomtranvsl() eur(r3iodap elncslt)arrau o;t4ale  fctltfsDrmuvp t0aexnmf oydlpt  neo s)trxmxopoodllte ncsas) rtru ont4apto o3tls sDrluvonu4 etrxocia1oa eluesls)seum(o nodom   nct tfaDua( pnt4tpxo i3tytfs emu pnu0artrxfcia1omte n s () 2xoiopiu1ameemfcsls) Dumxmoou0aex  i3iydfm2ulnmpnu4 ltoif3tatfp raivo ( sexr(o iydam emicil( s2rmxr oo1texoii3ildlaDel(vs;()altnmf tadop eauesl(0t2tmirpnodlptnmivta()srua( oot0oleomi3tadlm eaums;t0arxoxrcta1opD  iesls) exoiopiy1lpt mfcs (  2rmum no0apxn iciadfs2el(vp;t)tltrmf iodfaD auei;( s2tm(r3iodam nlfct (f Drrump;o4tptn i3iltls rmuvo;t0 rxrxf3to1faDrln sl(0t2urim3oodapen nviat sDua(monu0tpen oeiltfmDeaums (4aetoir oa1laDeaueols)trxm(m3oy1apt mfcta(  2raxro;t4oeeo f3iys a ea(msn(0areoiociadomD  ivols0 rumxmpiu4llt lfeiat)arrm( ooo4tpxoii3iad a2ulu o t0tlxnmo3oadlpDeanvi t)trurxm3oo1lm e fesatf 2tmumoou0oeto i3iyd s emu o (4tetoircoodlpD aueo s0s2uoim oodol e ncil()srrmu p;u4opx moeiasfa emnvp t0tlenmf3to1fpDran s;s sexoio oudol  lfct t)sDrm(ro;o4opxo iciysfm2ea(ms;t4arxoxf3oadopD  u o s) 2urio3iu4omen nvi s srrrurpnt0oex ioetltls2raumpn(0trtrxrctatfm ran i (  euoim3ou4lmt liet t  2rmxmpnu0tpxoiieildlaDum(msnu0teeoiocoadlmDrai olt  eur(m3oydllte fesa(fsDtmxm nu4apeniieiadfm em(mo ()tetnif3oadlpD  i olt0t2xm(r oy4olee icsat s2tm(mooo1optoiocilt aDem(mp;t4 rtrir ootfm  aueol(0 2um(m3oodlltn netls srrr( pnu1oetoiictltlm2um( s u4 rxoir3iatfatraivo;(  rur(m3iu1lmeemieia(f Drmx p;o0altn f3tydlaDea(msn(4trtomr3iytoaDrlneols srxr(r3oodlpenlfct t) 2raurp;o0aexn ieiysfs uauvs;t4 ltrxf tatfp eanvs s  2ur(rpoo1lm  mfcil( aDraxronu4aeeoiiciysfs rmump;(4 rtnmfcty1laDe nvols  rxo(rpiu4lmtn ieiat  Drm(rpot4tetn i3iasfs emu o;u4 rtrmo3ootfate neo;s sexm(m nu4amtelfvi s)srrmx  ;u0olxnmf3tat a umu ont) rtriocio1fmD luvs;s0srxoxrpiu1ame lies s)aDumx p;t1oexoioctlt a rmuvont4aeenio3iytfaD lnei;()s2uoir3io4lptn ncs s)sDururoou1altn fetyslaDrmu sn(4aeerio3totla  aivol()t2trxopou4amtnmics sf rtaxmo;t1aexoii3tysfm2rmuvsnu0tltnxo iodomDrlu il()trtrio3iy4ll e ivtltfsDurx  ;t4tltomieias s2umump (4tlxrmf3tadfate i il( trxrxrpoy1ameemncil(fa2tm(mpnu0alen ietldfm ua(vs (4teeoxociatla rlieo (0teum(opnydapenmiei t)aruaum ;u4tltnii3tytlaDum( p;t0trxnxf3tadlp   ueo;s setmxm iodalt  fet ()srur(m oo0oleomfeiatfmDuaumo t0tlxomo ta1lp e ivol()s2umirpiu4lpt  nvi (  Drmxro;u1tlx  o3iys s em(mo () exoxrcio1lp   ivols)seuoxo3iy4op  mfetat)arraxmpoo0tlxn i3iydfs2el(vo (4texrirctatomteln s;t0 2tm(o oo4omee nctasfarumx  ;t0tpt iiciysfm2uauvp (0 exomo3iatfp eai s;s)srur(rpnudameelieil(faDtmxr no4tpxomictatlm ua( o (4tltnxrcoydlp r nvi s t2umir3iudlp  lnct ()sDtmu pot0aleoiiciyt m2umumpn(0 lxnxo3ta1om eanvi;s0texoir3nu1ap  lfcsls)sDra( o;t1tlen fctadla ra(mo (0 rtoxfctatop elueolt0s2uoxo ny1ol n ivtl(  rtaurpoo0apxnmoctadla2el( o u4 exnxoctytom  luvsl(  2trio ou1ll  mnvias  Dumx ont0opeoiicilt sDeanvo t) etrxf ty1oat lnvols s2xrir ny4ope  ies s s2ra(monu4tlxoifetadlm2rlnvo u0 lenio ia1fpDrai i;s)s2xm(o3iu1omenlfvt t) Dtrur nt1teeo o3iydfs2ulnvs;u0 reomo iatlp e neilt  rxoim3nu4ol elncsat aDtaxrp;o0tltoiictydlm2ulu snu0aeenxo oodoaD livo;t0trur(mpiu4ome  feil()arurxm ou1tetoiociys a rlums;t4tlenxo oadom   iei s sexoir oo1amenmivslt aruaum ot1teen ictysls2rau on(0 lerxr iodfptrai s s setmiopiu4opeelfesat)artru  ;o4tpxoii3ilt a elnvont0tlxrxoctatlmtrai ils0s2xm(mpnydopeemietltf Durx p;o0olxomfeiyd aDumnmo;() lerxr3iytoat aivs s  etr(o3oy4lme  feilt  2ra(r ;t0texo oeiltlmDumu pnt) rtnmf tatop r ieslt) rxmxo3oy1lmtnmfvs t  Dta(rono1tlenifeilslm2um(mp;(4alxriociy1fm  aiei;s seurirpiudamee fvt (f 2ta(rp;o0aexn o3tas a ea(vo u4 lxrmr3iodom  liei s0 rtmxmpiydamen ieias  Dtm(  ;u1teen i3tysfm2emnvpn() eeomociy1lpte nvo () rtoio iudllenlfct ()aDtax  ;o0oexomiciaslsDrauvonu4 ltoxr iadfpteaiei;s0 rur(mpnydll n fctl() Drrurpnt0aeenioeiytlmDuaumo u4arenio oodlp elneo t  rumxo3iudal nlnvias) 2rmu ono1oeeomo3iad m2umnvonu0tlerir3todlp eaueo s srurxmpio1alte ivia(faruaxr nt0aleniictaslsDeanmo (4tltnio3tadfmDelneo;()t2uo(o3no4lmenlnvs t  rtaurpno0tptoioeils s2eanvo;()aetoir oo1fmDelueols0trxrimpoo1omtnmivtatfs2urur ;u4optnio3iasfm eau ont) reoxoctadfmt  ies t) euoirpnydam  miesat a2trxmp;o0texnioetatfaDemuvp;u0trtnmr3oa1faDeli ils0 euo(o nu1omtemfctatfa2ur(  ;o1opxo feiysfs um( pn(4teeoxocoy1opte ueo;s0 exo(mpiu1ape lncilt) rrm(monu1apen i3tydlsDea(vo t4trtoxociotlpt  nvo;(0 2xm(r oudlm nmfvtlt) rtmurp;o0olxo ictatls2raumonu0artrxrciadfa  auvs;t) 2tmxmpny4opt liesls  2rruro;u1aetoioctatla rmu o (4alermo ta1omtelues;t) 2toxm io4optnlfvsas a2uaxrpnu4alxnmfetadfa em( o u) rerxr3ty1fm   n s s0srtmxm3no4omt mfcias  rrmxmont1tleomietytfaDea( o (4 rtrmrciotlm  au o;() etrxr3oydol   ivi tfarumumpnu4texnmociytlaDra(vo ()artrxociatlmDeaivils)tetoir3oo4am nlict t s2raump;u4opeomfeiydfs uauvs u)teermrcoodoa rauvs t0 2tmxr3ny1ll e ietlt)a2trx  oo4aet ii3iadfs ul( o;t4 reoiocty1fmtrlivi ( t2to(r nudll e fvtl( artrxront0optnmfeildfa rlums t)aeeoxo3iotlm rlieo;t)trum(r nudoleelfci s aDra( pou1oex mieiltlsDulnmont0aexoxocta1fpD lu i;()srurxm no1lltnmncs (f 2trum ;u0opt io3tad m2rauvs (0 lenxf3todoptr nvs;( setmim3oydlpeelfcsls) Drr(  nt4texo o3iydls el(vs ()aleoif iotlmDelnes;( t2uo(m3iu1omt lies (  2raxmpnt0olto icilt m ulu pn(4 lxnxrcto1laD livo;t srxrir nodlm  lfvi (f rtaxr ;t1opxnmociytla2rlnvs;()teeoiocoytfpD  ies (0teur(m oodol  mnesa(f 2urx ono0olx moctys s el(vsn(4alerif io1oaDelu i;t  etm(opiu4lmtnmivilsf 2uru p;t0apen ieild s2ea(vsn(4 lxomr3tydfm   n ilt0trxrim3iodlltemict ()artrumo;u4ape  ieiadfs elnms ()trerxfciatop  luvi;s  etr(m nu4ole mnesa( a2rmx oot1aet moctadla2elnvp;u) etnxf3ia1oa   ieo ( srtmxr3oo4lmtelfviasf rtmurooo0olx  iciys mDrmuvp t4 rxoxo oodlm r i s s  2xoxr ou4alee ieil(fsrtr(mpno4oee iociltls2uauvp t0trtnxocta1lmt lu s s t2tmxo iy1llte ictls)srrrur no4olen fcild a ulu o () rtrxo oodfp  lu s (0t2to(opoo1lmte iciatfa2urxm ou4opx  o3ilslsDulnvs;t4trtrmo3oa1om elnvi;s  rumxr3iu4ale lfcil()srur(m ;t0oetnioeiadfmDuanmpnt4aexnxr oadlat li sls0 ruoxopio1omtnmfet s artru o;o4oleoiictldfsDeaumpn(0 reoxf3oadlp ranvols0sexr(opoydapt  fvsl(fsrtaumono1apeomiciat m2ulu on(0teeoxfciodoateanvi s s2tr(r no1optemfviat) rrmu  ;o1alxomfciadfs2umump;u4alerxoctytop  ln i s) etmxo no4alt mieslsfs2trx o;u1apt  i3ilslaDra( s;u0 ltnxocoytfptrliei s srtoxo oudom  miesasfaDtauroot1olt mo3iat a ra( s;t0artnxfcio1omtr ivi;( seumxr iu1om e fvi t)a2rm(m no1apx ifciadfa elu o u) leriocoy1faDrlnvi;s) exrxo3oy1omt  ncsls s2urx pnu0aeeoifctldfmDum( onu) exnxr tydfatr u s;s  ruoxm no1op e ivta()s2tm( onu4tleo octltls rmnms;u)aexomo io1lp rlneilt setmxrpoo1omen ivs () rrau pou4olt  oeilsla ua(mpnu4arenxf3oatoatranvs;()s2xo(rpnydopen ncslt)aDur(m nt4tpxnmoctad mDumuvs t0 renir3ia1la  an o;()srtriopnu4lme lneilsf 2ua( ont4opxnmociyt a ul( p;t4 lerxfciy1fp r ies s  exrxo no1om eliviatf 2ra(m ;t4olt ii3tadlm2umuvs;t0aexomf3oa1lmDelneo;(  ruoxm3no4oltn fvsl( a2rmu  ou4oexomf3ildfa2umnvsn() exnxf3iydlp rai i s0sexo(rpnu1amee icias  2trx  nu0apxo ictlsfmDumnmsn(0 lxoir3tadfatrlnvol()teto(r3nu1amtnmnvilt) 2tau oot4opeomiciydlm2rmu ont) leoxr oydomDeaivol() etrim iydllenlivi sfsDra( pno4tpxo ietltfmDrauvp u) eenmf iytlmD  neo t s2uoio no4ame mietl( s2um( o;u1olx  iciatlm2rlnmp u)tetnir oytfm  aneol(0s2xo(m nu4ll elnviat  2umumpoo1altomieiasfa2eanvs;(4texoifciotop  aneol()srtr(m3ny4ap nlnctls s2ta(r ;u0tptnmoeils m umuvp (0arenxrcty1fatelivols0sexrxrpou4lmtn fci (fs2raxmpnu1aet io3tltlm elnmo;u0 etomrctodoa elueo;t) 2tr(m iu1omte ictlt arra(ront4aptnmf3iytlaDra(mo;(0tlxomo iadfmDrlneolt0 2xrxopno1lm  lnvsas  2tmxmonu1aexnioctyt aDua(mp t4teenxfcoytfa rlu o (0 2toxr3oodll e fcs (farrr(rpoo4ope mictydlmDel(von(4 eermfcootfaDelivo;t0 exo(opio4ol  mnvils a2rmxmpno4oeenmocias s ra(vs (4artomrcio1opt  u s ( t2uoxmpou4opt lfes s  Duru  ou1altnmfciyslaDrl( pnt0 etnmo oatfpDr uvolt t2xo(opiodal nmiei ( aDtaxrpnt4olxoifeiasfs2em( p u4aexrir3iydfmte n slt0s2xr(rpoo4om  mnviat  2rrxrpnt1aet iociyt aDuau s ()aetnxocoodlmDrluvo;t0seuoirpno1amt mncsat)srta(rpnt0apxomf3iltfs2rm( o;t0altrmfcto1fm   uvs;s)trtoio nudale lnesa(faDuaumpnt1tptn fcias aDrmuvo;()tlxnxociy1fmD li i;t)s2xmimpnodal emneias s2umxro;u1optnmfciatla rlumont4tetoxo iotomtr i o;(0s2xoxr3nu1ape  ivil(faDrr( oot0oee mfctad m2ua(von(4trxnmf3totlpDelnes;(0srxrxo3ou4apt lietl( s2rm(rpou4opxn oetls s rauvp;u4texrmr3tadopte ueilt  eumxo3iydll elieias sDra(rpot1altoiieiltlm rln o;t) ltoxfciy1lp  lneil()srurxopiy1lm elneil()arrr(rono1alxn f3iasfs ulumo;()tlenircoadlpDr ieols)texmiopoo4lmeemivs t)srumuro;t1alxomoeildfaDrmnms;u)tetrirctotlpD luvsls srtrxrpiy1lltnlietl(faDua(  ou4olx mo3tysls ulnmp (4alenio3oytoateaivs s  rtrim oy1ap elieias s2ururp;t4optoiieiatfm rmump;u) exoxf oodfm eluvi;(  rtoxr iu4aptnlfciltf Drrurono4aetoii3tyslmDuluvsnu0tetrmf3iy1fmt  ivo s  rtm(r3oudope  fctas  2uau oou4tpt iieiys s ean on() reoxoctadlmDe n o;( srtrxo3iudal  lfcilt)srumu  oo1aexn f3iys m raumo u)aexnxf oadop eaues;t0s2xm(o3iu4al e icslt)s2tmxmpnt0aex mfeias m2emnmont4 rxomrcoatfa eluvo s0 exrxo oy1opt mfesls)a2tm(mono4aexoif3iyd mDrluvp;u4alxomo iydop   iei ()texm(rpnu1lmee fet t a2umxroou4tptnmo3iydla rlums u) exrxo3oo1fm elieslt  exrirpnu4omtnlnct s) Dtmxmp;u4tee ioeiltlmDrmnms;u4tltrxr oo1lmDeaneilt srxoxr ny1lpe livi tf 2rm(r oo0oltnmiciyd s eln pnu) renio tatlpDe ivo (0 2uoxr oodlmteliei sfsrrrxm no1tlx iieias a2uluvp;u) exoiociadomDr neo s s2toir iu1olte ici tfsDraumooo1ape mf3iadls2eau o;(4 etnxocootlaDr i ils)srum(r3iy1opeelfcia(f 2rm(mpnt1tpto fcilt a uluvs u4aexoxo tytlm  an s t)t2uoimpou4om nmfetlsf 2taum nt0aet ioctad sDra(mon(0teeomf to1fpD aues s) rumirpoodlpeemicsls)s2umxmoot1tle iiciad m2ra( pn(4 rtrxfcoa1opt  nesl()tetrxr3oodom nliei tfsDua(rpot4teenioctasfsDrm(mont0 rtoiocootoatran il(0s2xrxrpou4lme mneslsf Draurp;o1ope  iciydla2rau pn(4aeenxr io1oatrluvs s0trurxo3iu1lp n fvilsfsruau pot0tpenmo3iaslsDeluvs t) ltnmf iydla   i i t)srtrim3nu4am e fvi ()srtaumo;t1aeeoifetatls ranvo u0 eeoxrcto1laDeli o t) 2xo(o nudaptn fvsatfsrrmur ;u1aexo o3tasfs2um(vont0 lenmf todlm elieslt srumxrpoo1lptnmfvi (fs2umxrp;o0apxniietld m rmu pnt0 rxnifctadlatrlieo t0s2ur(r ny1ap e iei sfaDumx  nt1opeoif3ilslaDrlumo;t0 etnmrciydfa e nvil(0 rtmim oo4ape livi (f Dtrumpnt1tet  i3tadfmDrluvs;u4alenio3tadfpDe i ols0 rxr(m3ou1lme mnesl(faDumu pno4oexnmieiasls rm(mo u)tltoio iodfpD  ivil( s2trimpiydlptemfes t srrmx pot4aee ifeild sDemnmsnt) rxnmocoa1omtraneolt)trur(m nodop nmfcs sfs2umx oou1aex moctltfs ua(mp;(0arxrif3oadomte uesls srto(o no1amt  ici tfsDum( p;u0apt ioeiyd m umums t) rxoxrctatlp raieolt) rtmxo iy4opt lnetlsfaDra(rooo1apenmoeiad s emnvo;()teenmf3tatfa   nvo t srxrxr3nu1amtnlneil(  2rm(rpno1apx  oeiltfsDrlnvo;(0tlenir3oy1fptrlu slt)s2to(mpnydlmte nesat)srtaxr no1tpenmi3tyslaDulumon()teerxf3oodop eluvo;() 2trxrpoy4lme  ies s sDrrxm ;u0oee  f3ild a2rlu s;t4artnmr3tadlp r uei;(  exmxr3oy1olt mfcs s sDrr(monu4aexo oetad m umn o;t4aeeoxfcoydfat  i ils0trxrio3oodll n ieslt aDua( pou0oeeoiociytfmDranvo u)tltoxocia1la e u s ( t2trimpio4ame micil(  2urum ;o4tlxomieilsfs uaumo;t4trtoxrctodlatrluvs;t  rtoxr3iu1am elivias  rurx  ot4open iciyslm2uan pnt)aeeoif tatfp   nei;s) 2tmimpiydal e fes (fartax pot4tex  f3tlsfs ul(von() exnmf3iodoateluei s)trtrimpiy1am e fvsa(fs2ur(m no0opxn f3tas m2elnmo;u)tlxoxociadopD  iei (0seurxm no4ll n fcia(  2rr(m ot0tptn o3tytls emn s () eenmf io1lpt  u ols)seto(r oudol emnviasf rrm(m ou4opx mo3iadls uanmo u4aleoxf oa1oate uvilt0 2tmio iu1ol  lfet s s2umumonu0tpxn i3ilsla rlums;t)arxnmo tytopDeli olt)t2xr(r no4ape mies s  Dta(mpnt0tet mociytlmDumnmpnt0arenio3iadlp r uvo;s0 2xo(m3iydll nmnvs s) 2raxm oo0openif3iyt a rm( p;u0trtnxo3oytoa e ieo s)srtmir3iodalte iesa(farrax p;o0apxnioeils m2ean s;(4tetrmo3iytlp  li o;(0trto(o iudlm  mfciltfsDuax p;u4aetoifeiytfa2ra(vs;u4texnxr todlmDeanvo s s2toxm3oodaltemnci t  2tmx onu1apxnmfciadlaDranmsnu)teenxr totfm elieo;t)setr(rpio1om nmfei ()aDrr( pnu4oeen fciltls2emuvo u0arxrmo todfaDr i o s) etoimpnodlmee icsl() Dra( o;o0aptnmi3iys a em(mpn(4 rtrmrcoydomDeanvi t t2tm(mpnodom  mnvi (  2ua( poo0tleo f3iydlmDem(vsnu)trermoctotfpt lnvolt)truoxm3nodameemieia() Dtrurpnu0opxomociatfa2rmums;t)treomo oatoaDr u o;s)teuoxr iy1oltnmictlt  rrru p;o0texo o3iydfm2rlnms;(0aexoio3to1lp r uei t) 2urim nudopt mici sf rtmuront1tpxoio3iatfmDrlu p;t0arxnmr3io1lmDrluvslt0trtoim3iy4amte fvta(  Dur(  oo4oltoii3tldlmDrauvp;t)tltoioctatlmD an o t) rxr(rpiodlpenmieiasf 2tr(ro;t4apxoioctlslm2rmn p t4tlxomo3oydomDrlnes;(0 eur(mpiu4lp e fetlsfs2ta( oot0tet  o3iadlm2rmnvs;u4aetoxo to1fa r uei;(0tetrxo nudaptelfvsl()a2ta(m ;u4tpxn oeiytla2rl( sn()trtrifcty1faDraivs;()s2trim3oydapte fcsl( aDrmu  ;u0apxnmo3tldfmDrlnvp t)aexrxo3tadom  anvolt tetr(o iodlmt mivs s srta(mpnu1oex mfcilt aDea(mo (0arerir3iy1fpDrai sls  eum(mpny4omenlicil( a2ta(ro;u4tet ifeildfm2ea(mp;u)trxoxfcta1fm eauvs s0t2tm(m oudlp  mfviltf Durumpnu0oeenioctatlaDeanvon(4 etrmr3oadlm e nes (0t2tmirpoudaltn nvslsfa2rruro;u4open f3tydls2rmn p;()alxrmociy1fp r ieilt s2toir3iu4lmenmnet t) 2tm(m nt1tlt if3iat aDrlu p;(4 rxnio3oodlp raivs;s0 exoio3oy4apen nvsat  rtm(moot0aex mi3iadls2uan p;(4 exrir3oytlmtr ueo;t  2to(o iydol  lfetat a2rrx o;u4olxn octldfaDuau p;t)texoxr3io1lp   uei s0t2ur(o3oodll nlfet sfsrumxro;o1teenmfciydla rlu on()arxomocoodfaD auvs;s0texr(m nydapen fvia(fsDra( pnt1teto o3iad sDumumo t4teerirciy1opD aivi () exmio nydlmt micilt) 2tr(r ;o0opxoiocias mDulu o u4altrmo iadoaDeluvo;t)trurxm nudomenmietas arua(  ;u4tlxoioeiad aDranvpn(4aexoxfciatfat aivo;(0 etmimpoodalt  fvs tfaDraur no4tpenmictld s2ea(vsn(0tltnxo oy1fp  ai i () 2xm(opiu1oltnlicsas srua(rpno4aex moeiytlm2rau o t4aexnmfcoodlmDeluesls0t2umim nu4lptn feslsfsrrr( pou0apx  i3iyd mDel( p;t0 reoio3ootomD anei t)texr(o nydlp nmfvtasf rua(rono1apeo oeiyt aDrmnvs;()tetnmr ta1lpteaiei s0 ruo(r oo4ol nlnes s)a2uau pnu0tpenio3tatfa2rmn s u) ltomfcio1lp r ues t texo(o ou4amtemnvsa(faDtrumooo4tpx ioetatfa2ea(mon(4 exomoctytlpt aues;()teurio3nu4ale mfes (fsDrr(moou0altnmieildls em(mpnt0arenmfciadlat lu ils) exoxm iy4aptelivtasf rtaxroot1texn fciatfsDuauvpn(0tlxriociadoateln s;s0 etoxr oydap elnes tf rur(ront1tleo o3ildlsDuaumo (4tlerxfcio1fptelivs;(0 rxo(m3no1am  mnes s)sDumxrpot4tlt ioeilslm rl( o (0tltoirciytomD ai o t) ruoxmpoudam n nes (farurx  ou1aptoifctydls em(vsnu4 etomr3ia1fpDelneo;(0 2uoirpnudoptnmnesasfs2uau ooo1apxo feiysfmDum(msnt) etrirctydla  auvo;s0t2ur(rpiudom  lnvilsfa2um(mpnt0tetomi3iydls ranmo t0 exnmo3iadoaD livs;() ruo(r ny1oltnmieta(f Dua(rpnu0tltn i3iatfm2ea( p t0tltnxfctydfm ran i;t setr(m3iudap  mivsa(f rra(r nt0texoioctasfaDemnvs;u)arxoxocoy1opt anei;()tetrirpoo1opte fvi t srtruro;o0aee  i3iydla rm( p (4aeenxfctydopteaueils0t2xmim3ny1omenmfvil(fs2trur oo1alto o3tlsfmDuaumon()tltrxf3oatfpte nvo;()trum(m3oo4am  licta()aDta(mp;t1opx mfeias m umnms;u)treniocoatom rlivol(0srxmxrpiodlmt mfvta( arrau  ;o0tlx mfcilsla2ra(vsnu) eerircto1fm r ivs (0teuoimpny1lp  mies t) Drrx  ;u1olxomociasls2emnmpnt) exrmr3to1opDe ueo;(  exmio iudalenmnvs s  2tr(m nu4aeto oeiltlaDrlu snu0 lxrif3todlpDelnes;s)teur(r3iydope mnviat  Drr( onu1tltnif3iadfs2elnvs;(0alxrxr ootlmtelivol( srxr(mpno4om n fvsasf rtmurono1apxn o3tytfmDrln s;t0 eermf iadlatr uvo t)t2uoxr3nydam e ictlsfa2trurpnu0oex mi3iytfs2rlums;() lxomf3iatfatr i ols)s2to(o3no4al e ncsl(  2rmu p;o1aee mieiytfa2ul( p;u0trxnxfciotlpD li i () 2uoxo3io1lmee ncs t  2uaurpnt4optnmo3iysfmDeanmsn(0 etomo iodomD li ol(  2um(o ou1oleemfvi t)srum(rpou0tex ifciasfsDumuvpn(4alxrmocoa1faDeln i s srurxmpoydllte fctl(fsDrm(m ;o0oex if3iatfm2rlnvpn(4aleoio iy1fateluvol(0 rxmxm oy1aleemietatfa2trumonu1ape  fciasfm2emnvo;u) exrmocoydlmtrlu o;(  exoxmpoy4lltnmnctat a2rrx  ;t1tlx ii3iadfm2emu ont4teeoxo3iytlaD anei;s)t2umim ou1altelnesa()a2urxrpno4aexomfcilsfm2eanvont0texoio tatfmt auvi;s  exrio nu4aptemies s a2ur(r ;o0opxoio3tytfa eaumsnt)tlxrmo3oytlmtranvsl( seto(mpio1alt  ncs (f 2tm( o;t0alxnioetldla uauvp;u) exnmr oydfp ranei;s srxmirpny1ol  mfes t)a2tr(  nu0ale mfciasfm umnmo;t0trxnif oy1om rai i t  exrxo3iu4alte fesl()a2ta(r ;o0tpenifeias m2uauvpnt)teeomf3oytfaD  nvslt  2tmxm iu1oltn ici s) rtr( pou0oltnmoctlt sDel( o;u4alxrmrcto1lp e i s s0 exm(r iy4lp   ici ()srtax o;t1alen ocildfa2rauvs;u)areoxr iadomtr ueo t trxoxr oudamen nvta(  rtmx  oo0tetomf3iadfmDranmpnu0tltoxr3io1lat lnes;s)t2tmir ny4ameelieia(f Drax oou1opt  o3iyslm eanmo;t0alerio3oy1oa eli i (0t2xmxm iy4lm  mivs (faDumx oou0tex moctlt a2ulu s;t)tlerxr3oy1lmDeaivs (  2umxm iydaltnmivta(fs2rr(mo;u4tlxnmoeiadfm rlnvp;t4altoxfctatlpDeln ilt)trtrim nu1lm e iet s  rua(mo;t0tlt if3iys mDuanvo (4altoif3todlaDe uei;(0 etmir nydol e ivi (fsrrmxr oo4tlxo feiydlm ra(ms;u)altoxf3oodlp  aneo ( srxrxo3no1optemfcsls)sruaurpno1opto icilt mDulu p;(0alerifcoy1fpD  n ols0 rurirpny1oltemfcs t) Dtaumpou0oexo fetls a ulnvp;u0 rxnxrcta1lptr u s;s) ruoxr oo1ome mfvi sfsrrau ooo0alt iicild mDrmu s u0 rtomf3tytfmtr ivs;(0trto(r oy4omtn net ()aDur(r ;o0opxnmo3ils aDum( p u0tlxnmoctotlmtr nvo;s)s2tmim3no1lltemnvtls)srurxro;o1ope ii3tytfs ea(vonu)texoif io1fmt  ivsls)trur(opoy1al  mfet tf rtr(moou0opxnmieiltlmDel( o;u)arenxr3iydlaDraieo;( seur(o3io4amenliesasf rtrx ont0apto fciatfm2uan pnt4 ltrxf iadfpte uvs;(  rxmxmpiy1apenlnvs ( aDrmxr ou0altnifetys m elnmo (0tltrxf oadlptrln s s) 2umio ny4am  lnet ( sDrmx ont0texnmfetytfm2ra(vp;()trtrmf3iadopt luvil(  2toxo iu4ome  fvils)a2ra(m oo4oetomo3iytlm2umnmon(0tetrxf tatfaDranes s)t2xrxm3no1llt lict tfsruauront1olxniociytfmDrl(vont4aeenmo3iodfmDrau il( s2xm(o ny1amee neilt arurx pot4apeoioetlslm rau ont4tltoio oydfpDrluei (0 etoxm iy1ap e fesat)s2rru  ;t1optomf3iatfs um(mp;() eeomr3oodfpDrluvi;( setmir iy1am  mncia( sDrr(mpnu0opx moetytfmDrlnms;t0artnxf oytom   nei;()srumxopoydom  lfcs (fsrurx  ;o1opxoiocils a emnvon()trtnxr3oadlm elu sl(0 exoir oy4ll emneia()srrmurpoo0alx  octys a2eanmsnt)trtnxo3iydfp eaiesls) exmio iu1ol   fvil()sDum(rp;o4apen fciysls ra(vsnt) etoio oatfaD  i i ()teuriopiu4apen fvs t  Dta( ono1ope  oeiydla ua( o u4 exrir3totfpD  n slt t2uo(m3nydome  ivtas  2rm(m ot1apx  ietyd sDrlu snu)aexoxociotlpDe ivs;t trum(r3iu1am e fcta( sruau pot4apxnmfctldfsDrluvs t)teerxr tatfmDeaues;(0t2tmxr3ny4ameelfcta(f rurxm ;o4alx miciltls emnvs;u)tltrirctodlpteauvo (  rxrxm nudalt micsa()a2rrurooo1tlt mi3iat s ulnvo t4texrio3iodfaDrln sl(0setrim io4oltnlict t) 2ra( o;o1olt ioeilslm rln snt4 rxoxfctydlp elueo;()s2tmir oo1lm emicsat)srum(mp;o4tleomf3iad sDemnmo u)teeoxf iy1la e nes;s) exoxrpoo1llen ncsls)aDumx  ;o4texnii3ild mDea( pnu)aexrmfciytfa rauei;t  2xoxm nodoltelnctl(  Durx pnu1tlt mf3ilsfa ra( snt)aetomo tytla e ivo s0s2toim nudlmeemnvtl( arraxm ot1apeoif3iltfsDemn s u) exoxrcia1lp rln i s texo(rpio1ol  liei (  Dururp;o1opt  ieiltla2em(mp u)tetnmf3todfat lueil( t2xo(m iodlpe  fvs (fs2tm(mpnt1tltomiciasls2eaumo;(0 lerxfciadla  aueil(0tetm(mpnodoltnmiei s a2tmx pnu0altn octytfsDumu sn(4tleomo3oydop elieo s)s2xoio3iydlmeeliviltfsruax  ;u1oltoiieils s ra(vp () lermo3iotomte i olt srxo(r3nu1ll   ieiatf Dum(mp;o0opxo o3tas mDua(vsn(0 rxnifciotfp eli sls0tetrxr3oo4lm nlnesls) rtrxrpnu0tpx micias s2uan onu)trtrxrcoy1opD luei;s) 2uoiopou1amt  ivi s  Duax onu1aeen fciytfm2emu o u0tltrxr iy1oatelneo t srumxopio1ol emnctat)s2uru o;u1tpxoiictyd a umuvp;t4tetomf ia1opD au i;( texo(r oy4apenlnci sfsDtr(mpoo0opeoiiciad a rm(vp;t)alerio3oadla  lnvsls0teum(opnudam  miei (  Dur( oot4tetoifeiyt a2rl( pnu0alermf oodopt lnei;t)teurim3nu4amte fcsas) 2uaurpoo4tleniieiatfa2um(vs u0tltoif io1oa  luei;s  rumxr nu4alen ivslt) Dtaum ;t0aet ifciytfa2em(monu0aeenmfcta1fpD auvi;( s2trxr nu1lpe  nes ()srtrurpot4opto o3iytfs2emnmsnu)aeerircoa1lptran i ( sexr(r nodamee nvi t a2raump;u4oee if3iltlmDumnvo;u0 ltnif3tadfmDeaues;( t2xm(m no1lm   fvil(faDrr(r ;t1tetnmo3iat s ran s;u) exnir3iy1omt au i;t)setmxr3iu4lmee ivtl(f Dum(r ;u1olxomf3tadlm ulumo;u0treoxrcoatfpD li i (0 rtr(r3iu1opeeliviatfs2rax ooo0tptn oetat m2ua(vs u0 exoio3ootlp  lneo;s0 rxrio3iodalte fetl(  rtau  ot4tpeomictatfmDrmnvp;u0trermf3to1latrauvs t0 2tr(r nu4oltnmnctas)sDrm(  oo1aptniocilsls um(vpn() rtriocoydlmteauvilt0t2xoxrpnu1lmtnlfciltf Drrxmpoo1alx  f3iys a2ranmpn() etoxocty1faDrln sls sexmimpoo4ll  mncsatfsrta(rp;o0oex mietys m2elnvp (0arxrio iadlp   nvo t0s2trir iodopte fvilt)aDua(r ;o0tpt  iciyt m2ulu o u0 etrxocoodlmD aneols)t2trir3iu1om emnvi t srumxr nt0aet ioctatfm2uau p;t4 lxrxr3ootoate ivo;( tetoxr nodlmenmfcsa()aDumxmo;o4tee moetatfa2rmu o;(4arxrmo3iadfatr nvsls0 exo(o io4al elieias srrmumonu1oet iictltls uln p;t)arerirctatla eaueo (0 exo(m nu1op  mneias  2rmumono1aptoii3tysfm2ul(mo u4 rerxfctodoa   u ilt)srto(m3oydapen ncils arrrxmo;u0alto iciltlsDranvs;t4 renxfciy1fa e nvo;() rtm(m ny4altemivslt sDtax pnu1teto oeiltfaDraums;u4tlenmfcio1faDeln s t teum(m3oy1lp emfetlt aDuaxr oo4olx mociyt m2umn pnt0aeeomo to1oa  ai s s) 2xo(m3nu1amtelncs s)aDrrumpno4oeto fctldfm2umu s;t4trxrmr3io1fp raueo;s t2umimpiy1lpeemiesas)s2tm(mooo1apxn fetyslm uanvs;t0 lxnir3oytlp elnesl( trumiopoo4apenmncsatf 2tm(m oo1aptn iciytlm um(vp;u4trxnio oydfm rlivi;t) 2urirpiy1apteliei ()srrax ono4tpx mieiysfs uan pnt4aleoxr ta1lmDrlivsls)trumxr3iodlpt liesls)sDtau poo1teeomiciys s2eanvo (0 lenxo ia1lpte i s s0teumxm3iydopeemieia( aDur(r ou0ale iiciasfs ulnvs (0trtnxociydfaDe nes;t)srxoxr iydam elivta( a2ra(r nt0tle mi3ilslm um(mp (4 lxnio3oo1fatelneo s t2xo(rpiu1alt lnvia( sDtm(ro;o4tlxoio3iytlm um(vonu)teeoio tadlmDeanei;( sexriopnudam emnetl(faDtr(mp;t0alenmocild sDea(vont)altoxrciotlmDeau i s0 2xm(m nu1al elict tfaDuaurpno1opt miciytla emnmp t) renir3tydoaDelnvo;t trtmimpio4ame  icilt)a2ra(m ot1apenif3tatfa em( pnt4tetnxf todoa eanes;t trtr(m3nydomt  neta(  Dua(mont0tetnio3iyd m2eln s u0teeoxrcoatfp r nesls) 2trir3ou4olt lfviat a2rm(rpnt4altomicildls2emn s t0tltrxr3iy1lmt  ivs;t) 2toxo3nu4altn ieils  2trur ;u0tleomfciltlm2rm( sn(0altnxf oa1fmt  ueo t0s2toxmpoodlm   fetl()srrmxmono0oeeoifetyt m rl( p ()tlxnmociydfmtrlivil(0s2xr(opnudll nmneia( srrm(mpno4oeeniiciltfa2umu on() lxrircoodop r u i;(0 rtmir3nu4llte iei t) 2taumpnt1ope ifeiasfa emu o;() lerif3iadla  ai olt teurxo3iy1llt mieia(fs2rrxmp;u0aeeoif3tltlm el(vsnt0trenmociotlpD  nei t t2urxrpnudamen ies tfsrur(  ;u0ope ii3iad m2um( on(0trxrmr iydomD au s;s) euoxopio4om nmneia()aDrrxm ot4tlen ociysfa el( p;(4 rerif iodop e nei;s0seum(mpny4amt  fetat) 2tm( ono4aleo oeils m2eau pnu4artrmr oodomt  n s;s) rurxm iu1apeelfciasfaDrau ono4tpt mfeias s ul( s t)tetrmocoo1omt an s;t t2tr(o nu1opt mnci s)aDuax pou0openifeiadlm2emnvs (0 rermoctotomt anvi ()srurirpiu1aptnlicsl( srur(  ou0optn ictysla2uln o;u4 etrmf3oy1opDe neils  2urxopiu1omeeliet s)a2tr(r ;t1opxo f3tasfs2rmn pnu)tetrmrcoydomDeanvs;t s2urxrpoodlmt mnvi t  rtaxr ot4aetoioetyt sDuaump t)aeenxr3iotlaDr i olt) 2trxmpnydamee fctas) rraxro;u4teto ietysls ran pnt) etoir3iatopteaieo s)seuo(r nodlptemivsat  rta(rpoo4aetnmictadlmDra(vs t0aexnifctytlp r nvo;s)s2to(m no4al e nesas  Durumont1oltniiciatfa ulums;t0 eerxrcoadopDrlu ols)t2urxopno4aptn fvta( a2tmumooo4oexn o3iat a2ul( pnt4texoxo3iy1op raueo () 2tmirpiodomt mneia() Dua( onu0oet iictlsla em(vsnu)trxomrcoy1opt  ieilt srtmxm3oudomte ieia()s2rm(ronu4apenmociasfaDeln on(0altrmocoy1fmDr uvi s0sexrxopiy1al nmivil() Drm(rpnt4tlenmf3tytlmDulumo;t4aetoxocootlptraueo s) euoiopoy4ol emnesl(  rrm(rpnt0oexoif3ils s eauvs u4tltoio io1oa rlues;(  rumxo3iydal elicsl( sDumxr ;o4tlt io3tasla2elump (0 eenif3iydomDe i o (0t2xrir ny1aptelnvtlt a2um(rp;o4tleoiociasla2ran snu)aetnircty1fpte i o;t  2xmxm3oy4lp emnvt (  ruaurooo0olx mociyt s rlu o;(0aexnir3tytomt  iei;t) rumxrpno1ape mfcta(fartr(  ot1aetn f3tysls2rln pn(0 rtomfcoa1oateauvil(0srtmxm3ou4lm e ncils)a2ta(mpoo0texnii3iyd m rmuvsnu4trxrif3oodfpDe i sls s2xrio ny4ole mnctl()srrr(mpoo4tlt miciad s umn s u)teeomfcoadlpDr ivils0 eumir3nudlltelfvta( srrrur ;t1tetnioeildlm2rmumsnu)trxomo3oytlateanei t0 2xr(rpoudopt mictlt)aruax  ou0tpxo fetydlmDuaumon() rxrmf iytopDe i s t texmir nydape  iei s a2taxmpou0oexomoetatlm um( ont0 lermf3oo1fptrlueo s0srurxopou4olen icsat srrm( pno4ole mieiydfa ulu s;t) rermf oytfmDrli ols sexmxrpiydalen fvi () rtmumo;o1aexoii3iadfmDulnvsnt) exrmf oadoat aneo;s0seuoxopnydomtnmicsl(fsDrmum ;o0olto ictldfsDeaump (4aetnmf3iadla  luei;t) rtmiopiy1lmt mneilt)aDrr(m ;u0opx moeiydfm rm(vp;u0 eermr3oodomtr i o s  rxo(r3oo4op nlivi tf rur( o;u0alxn f3iaslaDua(vs;u) etoif3ty1fa eluvo t)s2xoir oodll   ictls sDtm(rpoo0tpto f3ildlm2umu s u0tetomf ootom   i o;s0setrir nodlp   ivilsfa2raum ;t0ape mfeilt mDeanvo (4alerxrctydoat auvi;s) 2tmxm nudoltemiesls)sDrrumpou0oetn o3iysfm rmnms () etrxo3iytomtr u i;s trtrio ny4optn fesls) rrru  oo0tet mfciasfmDum(mp;u4 rtrxf3iotfa   nvi t  2xoxopiu1altelncsa( s2tmxm ou0oeto ocias mDul( on()tetomf3oatlm rauvs;t0srtmxmpno4lmenlnes t  Dtrumo;o1aexnii3ilsfa2eauvp;u0trenmo3iatop  lies;(0 2uo(mpiodop  mncslt  2rru o;o4tet mo3iasls ul(vonu)aexoioctodfaD aneo;s teum(rpio4apt lfct t)aDraumoot1aeenmfeilsfsDemump;t)altoxf3iy1fptr ieols  rxrim ou4omtemfcsa()artmxr nu4tetomoctls aDrmn o (4teeoxf iadom raieols)srtr(opio4ll n nct s s2ur(rpnt1oet mietltlmDulnvsn(4trxnifctadoatelnvo () 2tmimpiu1lp   iet ()sruru o;t4alx mf3ilsfs ulumpnt0texnxfctodfm  anvslt0 exoxmpiudal  lfctas arrruro;o0oet  f3tldfa rl( p u)aexnircta1lm e ivo s  exrxrpno1apeelnvsl()s2umum ou4aee  i3ilsla uanvpnt4teeoxr oadfm r neils seto(r iy1amtnmfvsat) 2uax  nt4olxoii3tysfm eaums;() reomr3iydlmte uei;s tetr(o iydapeemiet t)arraxrpoo4olt mietys a ranvs;(0 rxnxf oatlp ranvsl( s2um(opiu1op e iet t)aDtmur oo1apxn fcilt s2rm(vs t0aexrmo iydoa r u ol()setr(opnydaltn nes sfaDurx  ot0oetniicildlaDrmnvs;u) lermrciydom raneo;(0 eumxm3ou1am   nvtls)artrx  no0ale mictas s2ulnvo u4 eenxr3totlpt aneo;t srtoir3oodomenmnctat)s2tmx pou1ale  ictydfs ulnvo t)tltoxfciytfaDe u slt)srxmxm3no1apt lietltfa2tm(  ou4optomi3ilt m2ulump;(4trerxo3ta1oatranvo s0 2umxr oudll emnesls) Duaur ot0alt if3tatls2em( pn() exnxf iatlmt aneol(0s2tmxr iu4ap nlfvi sf Duax oou0tlt  i3tysfa emumo;t) exomo3to1opt  uvol(0 2xmio3oydlptemnvilt) rum(mp;o4tlto fciltfm2rm(mo;u0 rxnxocta1omD lnesls  rumimpoy1lmt mfetl() Dra( oot1oex moeilsfs rmu o;(4 lerxr3tatfpDeluvs (0truo(m oydlmtemfvsat) rtm(  ;t1aeen ieiltfmDemnmp u4arermrciatopteluvils srtrio io4ape lfvsas) Dtauro;o0tet mf3ilt s2rln pnu0trxnmo io1omD lnvi s) 2uoxm no1lm  mieils)a2taxmont0aexnii3iyd s ra(vo;()arenmrcta1lpDrli i;s0s2uoio oydol emicsa(f 2rmur oo4apenio3iysfa2emuvp;t) rxrmo oydopDelies;()seumxm3nudop n ncslt)sDurumoou0openmociatla2ua(vp t4tlxrmf3oa1la elnei s0texrxrpoodome mneta(f Dtr(mpnt0optnmfcilsfmDeanmo u)tlxrxo iadlm   u o;t0t2xmxopoy4oltn fvt (faDur(r ;u4tptn oeiyd aDuln p;(4 lxrio iytoaDr nvolt0s2uoxm3iu1ap   fes ()a2raxm ou0ape ifciyt m elumo () ltoxo iatomDeanei;(0t2trim3nu4ap  lics ( sDuru p;u0oeeo fetasla2umumo u4 etoiociadfm ranei t t2xrxr3iudope lfeiat)s2um(rp;t0apx ifcilt m eau onu0tetnxociytfaDeli i;t)trxo(o3no4amt  ncslsfarrrxmpou1tpe mf3tlslsDrau sn(4artoxrcta1op  ai o;(0seumxr iydome mfeil()s2taumpot0oeeoiietltla2ea( s u4 rerif iodomt ln ils  2xoxo nydlpt lnei tfs2umu  nt4aleoiieias m umn pnt0treoifctadfmDe nei;(0t2tmio iydal  lfvtas  2ua( oot1olxnii3iasfaDra(vp;u0tetrxfciotlpDrau s;s) rtrxo iu4lpenlivias srtmur no0tpt  i3ildfs2eanms (4aleoxf todom   u o;(  rur(opoudll  lnei t aDumurp;u4alx ioctls sDel(ms;(0 rtoxf oy1om   uvilt0seumxr3iu1llt livsl( s2raurpno4apxn fciatfsDra(vo u) leniocta1lptrli i ( t2ur(m3oo1am elnvs t)s2taxr ;o0tlxnioctadfa2emn o;u)artrmf iotfaDrauvi;s)s2xmirpiy1lme  icil( aDum(ro;u1alt  f3iytlmDrlnmp t4 exomr3iy1latr neo;t tetrxo3oudal emies (  rumumpot0alx mi3tysfa elnvs u4 rtrir ia1fpt  u o () 2tmim iy1oleelnci t aDtr(m ;u1tlt mf3taslaDelnvo;u4 ltrmocio1fmt  uvo;(  exrxmpou4apeemfvsasfsDtrur nt0aeenioeias m um(vo;(4aetomrcia1fm eauei;t)teumxm3iy4alenmncias)sDtaumpoo4aeeoioctyt m2ranmo;t) rxrmrcootopt luei;s setoir3oy4llt mieta( sDtaurooo1tltnmi3tldlsDrau s (4 etrxr ootom eai o s s2um(o no1ol nmiet ()sDtrx oou1open f3iaslsDemu s (4 lerxf iotoateln i (0t2tmim3nodalt mnet t arrrumpnu0olxn fctydfm2emu o u0alerxoctydlmtraieo (0 2toim iu4olt mietl( s2rruroot4tleoio3iadfa2rm( p;()aexomo3to1fa r ivo t t2uoxr iy4ll   fesltf rrmum ;u1apeo ietyd a2ra(vp;(0altnmf3iodoaDeai i ()s2trxrpiy4ap elivtl(fsrtauro;u4apto ietydfs2uln s ()texoxo3tytfmDrlu s;t0seto(m nu1apte ivsltfs2rr( ooo0tlen o3tadla2uluvpnt4texnmfciadlpt lnes s) 2xo(r oydoptelivsltfsDrrurpnu4tetomfciatfm2emuvs;u)aetoxociatomDe ieo s) rxoxm3ou1omenmncsa() rur(r nu0oeeomo3ilsfaDuau o ()arerxocoatopt  ieols)texmim3iu1lme mfvslt)sDum( p;u0oeeoifeiyslm emn snu4tltomociodop eluei;(0s2xm(m3nu4omtemietlsfaDuaur nt4oleo i3tat a2uln ont0tetoxf3iadlm  lieo;(0 2urim oy4am   ivs t  Dtr(mooo0texoifciysfa rau s (0artoxr tytlp eluvi (0 rtmiopny1omee neiltf rumxmoot4oexn ietls sDrluvo;t0tlxnxf tatoatraivol(0 rxrim3nu1ale  ictlt) rtru  ;t4oeeoifetas sDuanvo u) renio3oydfat  neols trxr(m3nu1lpt licilt)aruaxrpnt0optniieilsla ra(mo u) rtnir tadlaD lueo;s  eumio nodape livt ()aDuauro;u0aptoioeilsls ul(mo;()tltoxo oydlaDr u s ()srurio3iy4olee fcs tf Dtrumo;t1tle ioeiytfs2ra(vo;u4 ltoxocoatom r nvil()srtm(opno4apt  nesltfs2umumo;t0oexnmfciydlsDeluvonu0tltoxo io1faD  ues;()sruoxo3nudopt mieiatf Durxrpou4apt moeiasfsDulnmp (4 etnxoctodfmt  neslt0 exoxr3iu4ap emict (  Dumxmooo4oltnmoetld s raumo u) exnifcoa1latelnei s t2trxm3no1alte iet tfarta(r ;u0aeeomo3tldlsDrm(ms;u0 rxnxr3ta1lp   iei;s trtoxo3iy4lmen nci tfs2uax ooo0tlen feilsfa um(vp (4 lxnxr iatfmteai olt)s2trim io1al e net s)arta(mp;u1aptn octld a2ra(mo;u) exnxo3todfa  auvilt)sruoxmpno4ll elfvil( s2rrxront0teen f3iydlmDran on()trxnxf oytopteau i;t teuoio nu1om   nesat)a2tm(  no1aetn o3ilsfa rm(vs;u4trenxociotlmt  ivsls seumir io4ol  mncil() ruaxm no0aeto ociyd sDelumsnu0aexrmociytlaDe ues;() eumxo nudaltnmfcs s)a2ta(rpnu1apenifctasls2um( p u0 renir3totfm  luvo;()s2xrir no4op nmfes sf 2tr(mono4alt mfctasla em(mp (4 rtrxf3ty1laDeaneslt0 2tmir no1ol emnvias sDuaxrpnt4oleoii3iltla2ulu ont0tlenmr3oodoaDrlues (  2umxr ou4op   fcsasfsDua( o;t0oetoio3tyd m umums;t)arenmrcoytlm eau i t0srxrxmpno4lpt mncias sDraxmpoo0oleoiieiad m2eaumpn() rxrxo oydoa rluvolt0 rtr(opoodom  lnesat srta(  no0tlxomietydlsDrmumsnu0trerxf3oo1laDeanvs;s0srxr(r3iodlptn nvtlt aDrau  ot4tlxomf3ilsfa el(msnt0tetomr ia1fm eaneolt) etoiopno4lp emncta()sDta(mo;t1tpen iciyd a elnms u0aeeoifciy1oaDranvol(0srxr(m iu1om elneilt  Dtaumpno1tlxnmf3ias aDrmn o u0areomr3iy1lmD anvo;()seuo(r3ny4lptnmici () rtmxro;u1alt  o3iltla2emnvs t0texoxrcoytoaD luvsl(0 exoimpiodlmeemfcsasfs2tmx p;u4oleoiieiytfm emn s (4 exoiocoodfptr n il()sexoxr iy1lpeelnci s s2rmur ;u4tpxomfeiydlm2ranmp;u)aexnio3todlmDelieo;( s2xmxm3oudoleemics t)srta(m ;o1tle io3ild a ran snu0teenmf3oadopteauvo;t  2xrxo3oydlme lncia(fartrumont0teeomi3iatls rln pnu) exnxrciytfaD anvs t)srtoxm3oy1op emfvilsf 2ta(m ot0oeeo oeiltls emumo;u0aeenir3oy1oat lnes t srum(m3oodlmeelncsatf rumxmono4opeoiieiltla2ra(vp;(4tltrif iytoaDeli ils0setmir nydapt mnci (faDrrxm ;o0aexn oeilt a2rm(mont4 reoxocootfat aueo s t2uoxrpoodlm nlicslt  rtax  no1tlt  feiltfa ranmo u)texrxf iadoaDrauvol(0trxo(m3iodamtn fetasfs2tauroou1tlto f3ils m2em(ms u4tetrifcootop   iei t  rtoxopiydop  lnetl()a2uru oot1aex moeiltfs rauvsnu4tetoxociydlp eai i;t0setrxm3iydllenlfvtlsfs2tr(ro;t1texoio3iltfm rmu s u)trxnxr3oydopD aivo;( srumxm3io4lmen nes s)a2tr( poo1opt  i3tadfsDrluvo;t4aexoifcoytoaDe n ol(0teuoxm nu1op  mnciatfsDtmx o;u4oltomf3iaslmDeau pnu)alxrxf3oodlpDelivi;t)t2xrir3io1altnmictls a2rrx p;o1tpt ifctadfs rauvo ()teenmo3tydlp r u o;t)texoxm nu4lmt lfvt ( s2urxmpnt1tpxomfciyd sDrau p;() lxrmocoodlpt lies s0s2xmxmpoudlm  miesl(f rtax oot4alen fctytfm2emu on(4trxomr oa1oa rlnes t) rtoim3iy1lpt  nvsa(  2trxro;t4texo i3ildfm ra(vo u0tlxoir iy1fm rlnvs;t0 exr(r oy4lltnlfet t s2ur( onu1tltn f3ildfa uanmo u)tleoxr iotoptelueols0 2tr(opnydop elncs t arua( pot4tlto oeildfm2uauvon(0tlxoxr iatfm e ueolt)srtr(opiy1ome  ncs ( srrrurpnt1olxomo3iyt s uln o;u0tltrmrciatfmt lnes;t0srxr(o3nu1ameelncias srtmum ot4texn fcildfa2rm(mo;t)tlenmocty1lm  livilt  etoir oy1ll elnviltf rrauro;o0oee mi3tysls el(mon()tlxrmr3iadfateluei;s0trxr(o3iydomeelfeiltf 2ururonu0oetoioctytfs2eln o (4tlxoio3tydoptr ueils s2trio3nodale mnet t s2tmurooo0oex  feiysfa2ra( pnu0arxnxr ta1lat aneo s)srtoir ou4opte fetat  Duax o;o4aet moeiysls uau p;(0 eeoir tadop ranvsls)t2um(rpnu4ap n ivtlt aDtrxmoot1oexnmfctytfm2raump u) eenio3oodfaD an i;()s2trir3iy4alt mfes sfsDuaum no1oex mociadfm2emnvo t0 exrioctydfmt aieolt s2uo(o oudlpe lfvsl( sDua(ronu1opxnii3iasfa2elu o;()trxrmo3oa1lmDrlnvols0 2xrxm io1ol   ict s sDur(rpnt4teenioetltfm umumo;() rermociatfmDrli s t0trtmxmpny4ol nmncia(fa2umxr ;t4tlx mfctldfsDeanmsnu)alxoif3iy1opDrlu o;t0 rum(mpoudlp  licslt)s2tm(  nt1tpe  fetlsla uan snt4 eeoxfctotopDr uvs s0 etm(rpnu4oltn fciltfsDua(rpnu1tpx mieiytlm2eau sn(0 eeomo3ia1lptrauvilt0teumim3oudom n ivia()arur(m ot1oltn i3iyt m elump;t)aetrxr iy1fp r ivs s seumxm3iy1amte fctls a2taxmp;t0apxomoeilsls um(vp;u4texnxo oodlaDran i;t) exo(rpnu1al elicslsfarta(r oo1olto ictytlm raump t) etnmocto1lp eai ol(0teum(m oodlltemfct (fa2tmxro;o1oeeomictltla rauvpnt) rtnxr oy1faD ln o;s0tetmim iu4alt  fcta(f 2raur ot1oet  oeiasfmDrlnvp ()tlenmfctodoate i s;()srtr(mpoo4op nmnct t sDuaumpno1altnii3ils a ua(vpn()trermf ia1lpDrauvol( setrio3iodomtnlfct (faDrrumo;t0tet mi3tad aDemnvpnu4altrmo oytlpDeluvs;() rto(m3oodoptn nvias  Duaxr ot0aetn fetyt s emn pn(0arerxf oodfaD luvolt)t2xmxo iydope mfvta( a2taxmp;t1tpto ictlsfa ra(vs;(0tetnxrciadomDr ues ( trtrim3nu1oltelfei ()s2ta(rpnt1ole ifetydla2ranvp;t0 exrxrciatom  anvs ()sexm(opnydoltnmieta(  rta( pno0opxniiciysls2emuvpn()alxoiociytfpDelivsl() exmxm nu4alt mnesl() Dra(m ou4opx iocildfaDua(vo t4 exnxfcoa1fpDeauvs;()trxoxmpnudomenlfei s)sDraur nt0tetnifciltla ua(vo t4artnir3tydfpDe nvi t sruo(mpno4lmt mfci s)s2rmxm ;u0tle mo3tadla emuvp;() rxomo3iy1omtr uvol(0trur(r iy1opee ncs s) Dumumpnt1tptomo3iyslm2umnms (0 reomf3tatlaDrln o s s2xm(rpio1oltn ncs () rtrxm ou0teeo i3iyslmDraums u)alenif iytoatelnvi s trumim3nydal nlicilt  Draump;o0olxoifetlsls rlnvont) ltnio totfa  anei t tetoir3oo1lm e fvslt)a2ur( p;t0alxnmi3iltla uau snt0 lxrmo3oytlmDr ivi;() rxm(mpou4lmt lfet t  2rr(  no0teeo o3ilsfaDra(vp t4 exrmfcoa1fpDeau s;s0s2tmxm nydamen icilt srrm(  ou1tltomo3tasfm el(ms (4 renmf iydlpD lu o t)srtm(rpoydal n neta( a2umxmo;t4tlxoio3iydfa ul(vs u) rxoxrciydoptr i s;t) 2to(rpnydlm  mnesl(fa2taxm ;u4tpx mfctltls rmn o t0tlxnxf oatfpD ln o (  2xrxmpoodlltnmfvs s arrm(mp;o0oetn icildfsDelnmo;u0artrmocoo1lmD  ivs;( s2xm(m3ou4om e fvi (  Duaxmpot1optnmieilslaDeaump;(4 eermr3tytlmtran i s seuoxo oo4lptnlivslt sDrmurpnu1openifciadfa ua( s;t4 ltrxfctatfaD  nes s srumim oydolen fctat sDurum nu1opxn o3iat mDumn p t)aexoxocia1om eauei;s0trtoxopny4lptn fvsa(f Dtaxr nu4opxnmo3iadlsDemuvo;t)arxomfcoatfmtr n i;t s2xrim3nu1alenmneia(f Dur(  nu1altnio3iytfa2em(mp;u4 exnif ty1lat livo (0srxrxr3oo1ome  nvta( a2tmuront4oeeoifetldfs eauvo;t0artoio iadomDe ies;(0texr(r3iudlmte fctatfsrumu  oo4ale  ieiasls ua(vpnt0texrifcoy1lm eaueo ()t2trxo3iu1ap emieias s2umxrpou4apx ioetatla ulnvo;u4tlermr3ootfmtr ivi t)t2xoxr3iy1ape lnvtl() 2rmurp;o0aexn octltfa2ua(vp;(0 eerir3iytlpDelu i;( s2trim3ny4llenmfvtl( srtmxro;o0tetoiociys a2el(vo u4tltrmf tatfa e u ilt0trto(o3oo4optemfei sf ruaumo;o1ole mi3tytls2ul(monu0trxnxfcty1fmte i s () ruoiopno1optnmiviat artrum oo0texnmiciysfa eluvo;u0 rtnmf3totfa  auvs s teurim3iydoltelncsa()s2umx ooo1apxomi3iyt s2uan s u)artrif3tatomD anvslt  2xrimpoo1optnmict s a2um(m ot0aex  fcildfm2eaump t4trenircto1om r ueo () 2uo(r no1am   icta( s2tau p;t4ole  o3iadlm ra( s t4 eerir3totlmtr ieo s)s2urxo3ou1lltnmivtat) 2tmu oot0alt mf3tyd a2ea(vs () rxrmf3ootlaDr uvi (0 rtm(o3iy1optn ncs ()sDrm(mono0oleo f3ild mDelump u4 exrxfcoa1lp   i i ()trum(m3ou1lpt lfesa(fa2um(rp;o1tpto oeiasfa2umu s u4texnmf3iy1laDelu s;s)srurim3ou1lpen fvil() Duaurp;u4tetoioeias s ra( pnt)tlxrir iytlmt an slt  rur(o3no4alenlfcsltfs2tr(mpoo4ope  i3tas mDem(mo;(0tlxnxfcia1lp ranei;s0setmir ou1lltn nvta( sDuax  nu0teeomf3iyd a2ranmo (0altomo oadfaD  iei () eur(r3nodlpenmivi (fs2urumo;o0oetniieiytfa rmnvo;(4tltrxoctodfpD lneils)s2uo(opno1lpe lfvt ( aDrm(ro;t4tlxo ieiyt m2el( sn()trenxf3iodlmt an i ( srtoxrpiu1lm  lnct ( aDurxrooo0tpt  o3tldfsDraums t4trxomf tadlat  u i s) rtrxr ny1lpenmnes ()sDrmu  no1apxn i3iltls2emuvp t)aeeoxf3oa1lmDe uvi;(  etoxo ny4lptemfeil(  rtr( onu0apxo fetat m2rauvp;u) leomo3ty1opDelneo;s0srxoxrpiydap nlnctltfarrmxrp;t1tpxo ictldfa2ul( pn()arxoxf3iatopDrluvs;s) 2uoxopio1am nliviltf 2umu ont0optnioctad sDem(msnu0 rxoxr3iatlmDelieil(0 exmxr3oo1lmee ies sf 2tr(mpot1apenmo3tat s um( o;u4 renmf oy1lpDe u s;t)trtmxm3ou1lpen fcils) rur(m ;o1tlxnio3tasfaDeauvs;u4tlxnmo tytfp e i ils0srto(m oudaltemfesltfa2tmum ot1oet mfcildfsDeanvsnu0treoio io1optraivo;s0tetm(o3iudolenlfeiasfs2taumo;t1apxniictyd m2rm(vp u0alxnxrcto1lat ai s;(0 ruoxopoo1lp   nvi s)sruaur nu1oltnmoetad a eauvo u4altrmo oo1laDranvslt t2umxo nodam  mncslt)arumxrpnt0oeenioeilsfsDeanvpn(4altoif tytfmtrliei s srtoiopoy4olt  fei sfartax o;o1aexnii3tysfm umnms;(0 lxrxrcootom r nvi;(0 etrxo3oudlptnlnci (  Duaxrp;t0alx  fctlsfs umnmo t4 eeoxf3io1lpDeaivi () etrxr3ou4alt livi tfs2ra(mo;t0tee mf3iyslm2rln s;t0tlxomo3oodfp   n o;t0 2xrxm ny1oltemivsa(f ruaxm ot1tpenmo3ilt a umnmon()trxoxo3iy1opD lnvs t) 2xrxm oo4lmt lictlsfarta(moot1tpxoiiciysfmDum(vpnt)tltrxf oodopte neils srto(r ny1lp   iesl( s2raxmpnt1tltn i3ild a2ulnms;(0 exrmr3todfpDr nvolt seuoxm oy1om nlfetas  ruau o;u1tpe ifciasfs2rauvp t0tlerxfciydoatelivilt s2urxmpoy1lpe  nes (f Drrx  ot4aeen iciytfa umuvo t0artoio3totla  lnvo;s0 etoxr3nudop nlieia() 2rr(m ou0alt mfcildfsDeau s;u4arenir3todoatraivs s  rumio3nu4ameelieias srrr( ono0aexniieiadfs2eanvs ()tleomf3ta1fp eaivo;s0sexrimpiydap  lfvtlt a2um(rp;t4opx  ocilsfa eln pnu0 lermfctydfa  lnvslt)teurxr3io1lle mnvsl( a2urxm ot1texn f3iysfs2umums;()alxniocta1fptrln i t srto(o oudlp nlfcs (fa2tau ont1aeeoioeiyd a ean o;t4arxomrcoytlp  lies;t)setmimpiydlm nlfesl( s2trx oot4opxn fciltlaDrmnvpnu0 etnioctotlptelivs;(0trtrim3nu4al emiet sfs2taxrpou0apenmiciadlsDemu o (0 leoxf3oodop e n il(0 etr(rpoudolt lnctat)arrru oot4apt  fctlslsDumnvp;t0 rxrxrcoatomDr i ols  etr(o nu4omenlfvtlt  Dum( p;u4teenio3iyslm2el(vsnu4arxrmf tadoatr n ols) rumir3nu1olenlnvtl(fs2raumpnt1tee if3iyslaDul(msnt4 eenir3tytlatr uvi;(0setmio ou4op emies t aDrrxr no0oleomf3ildfs umuvp;(0aexnmf iy1faD ln s ( srtoirpiu4open fctls)aDtaxr nt4apx ii3ilt sDua(mont)trenxrciodomD aneil() etrxm iodlptemiet ()a2rmumpou4openmi3tlsfaDrlnmpnu0arenmo to1fmte i o t  rxo(o io4lp  mfvslt arrm(mono4tpx  o3iytfm emnvont4aetrio tydfmDelieo (0t2xrim oodomtnmici ()artaxrono4altoioeiyd a eaumo ()trxoif3oadlm eau s;t0 etr(mpiydomee fvias)srua( ont1aetn f3ilt s emn pn() rtoxo ty1om e u s s)s2uoim iu1am e ivsa(f rtaurpnu1aexoifciytfs rau p;(0 lermrcoydfptrauei;()srxrxm3nu1apee ivsl()aDrrxm nt4apx mfeiysfaDemnmpn(4 leoxf3iydlmDeau s t0 rtoxo3oy1llee iviltfaDumu pno0ape iieiltlsDeauvo;u)tltnir iatla rau s;s0sexmxo3ny1lle mnvt ()a2urx oot0oetn icils a ean s;(0alenmrciy1la  li o;t sexmim nodalen fvta(fs2rmur no4oetn ieiysla rauvp;u0alenxr3ia1lmDeluesls)srxoxo oo1aleemneia(fs2rau oou0apt iictytlaDemums;u4texoir todop rluvo;() ruo(o ny1lmenmneta(  ruaump;o4tpe mf3tlsfaDua(mpn(0areniociadlptraueo (0t2ur(rpiy4lmt mneilt  Dumxronu1aeeomocildfs2raumo u4 rxnio3oa1latr n s;t)s2ur(m iu1lmee feia(  rtrum ou1tee  feiytlm2el(mpnu)aexrmo tytlat  uvi t)s2tmio nydoptn fet (faDuau pou1tle mfciyt s um( o u) ltoir oydlpDrli sl()srxmxr3ou4lltelicsat)a2ua(mpoo4opeo ocilslmDum( sn() etrif tadfatr u o ()seum(opiy4llt lfctltfs2ra( oot1aeenmfcildfm emump;()arenxocoadfmDeliei s)teurir3iy4omtn nvsls) rtm(r ;o4ale mf3iytlsDelnvsn() etrio todfpDe n o;t0srtr(m3iy4optnmfvils aDrm(ro;o1oltomiciytfs rmn snu0teeoxocoytla rlu s s0 2xm(m ou4lmenlfeil( arrmurpoo4tlxnmo3tls a ua(vs;u0alxrmo todlptrlies s0sexmim oo1op e nesas)s2raxmpno0apt mo3iyd aDelu p u0tlxnmf3oa1lpte uvsl(  2umxo3iudlm n ncs s aDraumoot4tetniiciytfs2elu s;t4tlxnmr3oy1la  auei;s  2toirpiodlmenlicsa( sruru ont0tlxomfciadfa uau p;u4 lxnmfctatomDranes t0 exr(mpiudopt lietl(f Draxrp;o0aeeo ietlsls elumpnu0aexomr iotlat an slt0 euoim3io4apenmnvi s  Durur nt1tpe iictat s2rmu sn()trxrircoytopDeaivi;s)s2uoxrpiy1al e fvi t)srrm( ono4openmociyt s2um( o;(4aeerirctadoatr ueilt0sexoirpiu4lpt mneiat)arum(ro;t1oexomoeiasfa2uau snt4alenmo tadfpteauei (0 ruoir3oy1omte ici tf rraxm oo4apxnioetatlmDuanvp t4 rxoiociadlpt lieo;(0setrim ou1apen fes sfsrrrump;u4tlx  i3iytfa eln pnu)altrio ty1omD aueo;s0 rxrio oo1ope lfviasf ruaxmooo0opeoii3tadfsDuaumo u4 lxrmoctadomt aneil(0trxr(r io1op   ieslt a2ururpno1aee ioeiltfs eanvon() lerir oodlm  ai slt0trxr(m3ou4omtnmieiatfaDrrxr ot0oeeo oeiatlm uanvo;u4trtoxr3tadfa rluei t0s2xrxmpiydapte fcs (fsDumum ou1tlenmfctytfmDua(vs;t)tleomrcio1oa  ai s;(  etmir3oy1lptemnvt t)aDum( pno4oetn o3ilsfa2eauvs u4 exomo iotfmDrau s s0 2xmxo3oy1lmee ietat artaurooo0opxnmfctaslm2elnvp;t4 leoir oatlm  aiei t0trtoxr3nu1ol nlfes (fsDra( ooo4ole  fctat sDelnmo t4aetnmr3iodopt auvs t s2ur(r iy1lp  mietat)aDrrurpnt4opt mfeiysfaDrmnvp;t) exomf3iy1lateanesl( s2tr(mpnydlpe  ncs ()srua(m nu1oee  ictytfsDumumo;t0treoiocia1optraivolt) rtoxm iu4amtnlnes t) Dum(rono0oetomf3iasfm el(vs u4alenifcty1la eau sls0srxoim3ny4op n nvs (f Dua(mooo4apeomfcilsls2rm(msnt)areoifcoo1opDrlivs;()setr(opnu1om emict t)a2rm( pou0tpxniieilt s2um( p;(0alxnio3oydfp rlu o s t2xmim iu1amt mieils  Drmurpnt0aex mf3iytlsDeanmsnu0texrxf tadfatelivi s)t2xrir3nu1omtemicsa()srtru p;u1alt  ieiys aDem( s;t4 ltnir iadoa   ivs t  2trxmpiodlmeemnetlsfa2rrumpnu1opt  f3iltla ua(mpnt)tltoxf oytlmtraivi;t)tetoim nudom n fvs t arumxm ;u4aptnifetytfm emn sn(4 reoio iy1fp eauei s t2trio3oy4lmeemfci t  Dum(rpnt1ole mfciasls rauvs;()tlermr3tytlate nvi;s0 exrxm nodaltemiesa() rurxmp;t4opeo o3tldfs rlump;t0 rtrifcoydom e ueol(0 rxm(opoydlltn fcsat)arua( ont0aexnifeiltfs2eln onu0 rxnio3oatfa ranvi s0srtm(r3nodolenmfcsas)aDra( pot4ape mi3tlsfs2rl(mo;(4aeeoif io1laD auvs (0trum(rpoydlleelfes (f ruaxro;o0altn iciadls2uanvpnu4tetomf iy1omtrli o s)teur(o ou4lptemivtl(f Dra(mo;u1oexnifeiat m2rln o;t) reoxf3iatfmte i sls0srtrim ou4ap nmfetasfsrraxmp;t0tle moetadfsDeauvsnt4tetrif iydlm  livo;s0setoio oodllt mfviat) Dta(m nu0tetomfctldls rmu p u4trtrxfcoydfaDelivs t  eumimpno4ole  nvias) rumumpoo4opxn fctatlaDrm(mont0tleoircio1om r n s;t) 2toxmpoydolte fvsl( sDrmumpnu4oee mociad a2rm( o ()alxoxf oo1laD  uvi;t0s2xmxo3iy1al elictatfsDua(moot1texoii3iys m2eaums t0trxnifctotfmDeauvs;t) 2uo(m3ou4lmtnmictl()srtaumoot4ale  octls aDea( pnu4tltoxr3ta1fm ranvo s teur(r3nu1op e nviltfa2um(moot0apt  feiydls2rlnmp;t4 rxnmo oa1fpDeauei;s srtrio io1llenlnesa() Dumur ot0opx  feiadla em(ms () lenmocto1omt  uei t0 ruo(o3oudom  mieilt a2ta(mp;u1oeen oeilsfmDeaump u0artrif oydlp  auvi s) rumxr iydlle lnei tf Dtau pnt4tlx mf3iadls ra(mp;(4arerxo ia1om r nvsls s2uoxr nu1al emici t artmumono1openmf3tyslm2eln s;(4aetnmo3oadoaDeaivs t texm(r3oodole mnvt (fs2tmurp;o4opeoif3iasfs2um(von()arxoif iatoatr n o t  rtmim oo4lm emicsasfs2truro;t1tpt  ictydlsDeaumo t) ltrxo iodfpDeaieils) eur(opio4am  mici () 2urxmp;t0olxnioctydfsDem(vp ()trenmocto1lpD  neil(  rtoxo3nudllt licilt)arta(roou0opeo i3tys a rmnmo u0 rerif3tydfpte neo t0t2triopny4lm nmnetat)s2rm(r ou0aeenmietls m2ua( s (0tlxoir3to1fmD aivs t0t2xmim3iodameelfes tfsruau pou1opxn o3tltla umums u)tleoxo iy1optraueo;() 2umxr3iodllt mncsatfsrum(mpno0tltoio3ias aDel(vo t) eenmo oodfmDraieo;t t2urxr iu4ap e neiltf Dtr(root4tle ii3tad s2ul( o (4texnxrcoy1optr ivsl()t2xr(r3iu1aptnlivtl(fsrum(r nt0aee mo3iltlm2rl(ms u0trerio3iotomD  u i;(  rtmxrpiodaptnliesl(faDrmxro;t0aleoifciatla2rm( snu) etomoctatfmD  uesl(  2uoio3io4llt mnesa(farurxmooo0alxn ociadlm2umnvpnt0 eerir3to1lp ranvo;t tetmir no4lpte iet t)artmx pnu4oetn f3iydfsDrmumo t)tleoirctadlm  auvo s) rxrxr3oo1lle  ictl()sDrmxmpnu4tltnioeilt s2umnmp ()alenmo iadopt  nes s)srumxm3oy4ope mnei t  rtaxrono0opto fciysfs uluvp;t0 rxnxo iotomDelivs;t0 2tm(rpou4om e ivs (  2ra(mo;o4tlenmociydfs2ua( pnt0tetrmo to1lpD  n s t0seto(r oy1opeemictat) 2rmu ooo4oexn ictlsfa2el( snu4aeermocoytfa  livs;t trtmxr3oo1amtemnct (  rumx o;o4apxoiiciatfaDrmnmo u4 ltoxf oadfpDeli s;t0 2urxrpiy4ome  nvilsfsrraxrpoo0aetniictat a2ea(von(4texoxr tadla elues s0 ruoir3ou4lmte net s)artmuroot4aetniocildlm ulums u4areoxr iy1fatr ueo;s)trtoxm3io1amtnlieiat aDraxm ou0tptnifeild m eluvon(4trtrxrcoydfaDr nvi s seuo(m no4optemietltfsDur( p;u1tex  icilt m rl( o u)aexnmo3oadlmD aneo (0trxrxo3no4oltemfct s) rtm(rpot0oex mi3ilsfs rlu snt4alerio oa1omDelues;s0t2uoiopnudole  fetatfs2rmu ono4tee ioeiytlm2rlu o;t) leoxf3iytopD  neilt) exo(mpnydole  iet s s2trxmp;u0apxo oetld aDua( p t0trtrmfciotlmDeauvs s0t2tr(o oy1altemfvi s  rtr( oou0tptoio3iadfm uluvp u)artoio ia1optrluei s)s2xoim3iudapt  fet ()s2urur ;u4opxomfetadfm ean pn(4aeermf3iy1op elies s trxm(mpoo4om emnetas a2trumont4ole mieiatfsDuln s;u4 ltoxrcootlmteanesl(  rxrio3no4lm n ivs (f ruaxmont4teeomfctatlm ua(vsnt0aetoxocio1fpt li ils s2um(rpnodom e ivs ()aDtaump;o1tet if3ildfs elu ont)trxomr ta1fmtelnesls srumxo3iydlp nmfesas)sDrm(ronu1tetnmoeiat a2em(vo;t0texrxf ta1fp r i i (0s2xrim3nu1omt miesatfa2umxmpot0oexoioctatfaDraumon(0aexnioctydfmtrln olt0 2xoxr iydll nlivt tfs2urxr no1opt  iciytlm2rlnvo u4 lerxr oytlmD auei;(0s2xmim nodaltnmfvs sfsrrm(mpnt0optoioeilt aDel( sn(4artoxr oa1om raneo s0teurxmpou1op elnei t a2uauro;u4alxnmo3iatfs2ra( onu4 rxoio3iotfmD  n i;t)s2xo(m iydllen nviasfsDtru p;o0tle  o3iatls2umu snt) eeoxo3ty1oaDrli i;t)s2tmio3nydamee nciltfsruaumoou0tex iociytfs eln o t)altnircto1la eaneo s)t2um(o3oydopee fcil(fartrx  ot1tleomieiys m el( ont) eeoif oodlatr ivslt)trumirpoudll nmictl(fs2raxmp;t1ape mictyt aDemn o;(0trtomo oatoatraues t)t2uoir iydopte fcilsfa2tm(r ot0olt mfeiydfs2elu p;(4 rxoxrciadoa  ai i;(0sexm(mpnudoptn icsas s2ra(rono1aleoif3iydfm um(vo t4tetoxo3iodopDelu s;t0t2uoir3iudolte nct t  2urxrono4oex  f3iad aDua( sn()tlxnio3oydoat lu ils teto(rpny1lptnlfeilt)sDtauro;t0apt  o3iasfa rlu o t4 etrmr iodoaDr uvs ( t2tmxm3iu1ole lfvi (f 2tmu oou4opeo icias a emnms;(4 ltrmr iotfp r nvi (0t2tr(m3iy4lpe lictls)s2urump;t4oltn i3tlsls umump t4altrxo3ootlm   uvs;t)sruoim3iy4olte fcil()sDtmu  ou4oex  ociatla rmnmonu) etrio3oytopDeau ils t2xo(m3no4amee ictas) rraxm ;t0tpeoioeildlmDrlnvsn(0aexrmrcoytfmt lnei;()seum(m iudlpen fcta( s2tm( oot1apx io3iysfsDel(ms (4texnmo3tadlaDe ieilt) etr(o3oy4olt lncia(  2rmurp;u1tltomfeiat a2emnmp;t0aetnxrcia1fpteaivs;t) 2xoimpno4lltnmfcsa(farumxmonu1olxo ociytlm2rm(ms u0texnxr iydfpteln ol(0s2um(o3io1amee icsa(fs2ta( oot4open iciytls2ulump t0arxomo oo1oat lieo s0srtmxo3nu4lm emivia() 2raxmo;t0alto fetydfm eln p;(4 rtoifciytomtranvi;s trxr(r3nudoptelnesls) rrrur ;t4oleomo3tadls rm( p;t)aexrmoctytomt  iei;( s2xrim iy4lle  ivtat  Duru pot1tlxomictas aDelu p (0altrxrcootlm r nvs ( srumir nu4ale mfesat a2trxro;u4aeenmociyt aDrm(vo;u4 rtrxrcoydopD  i o;s)tetmxo nu1ll e fct t  2ur(ronu4aetnif3ias s2eluvp u0altoxf iydoat  ivi;t0srurim no4am  lieslt)a2umu pot0tpenmi3ilsfs ean s (0trxrxf oadoaDelu il(0s2xrim oo1oltnlfvilt) Dtr(rp;o0aptn o3ilt a2umn s t4teerxo3tytfm e uei t)seum(o3nu1op nlnetlsfs2taxrpou4tee ioctad s2eauvsn(4 etnmf iydoatr nei;s texoxopno1lmtnlfeias) 2ra( pou1oet  i3ilsfm2umums (4 eerir oa1lat  neo;(0trxrimpnudlm elfct sf 2tru pou1tpe  i3iatlsDuluvs;(4 ltnir3oo1fpDelivil(0srxoxr ou1ap n iciat)aruau p;t0tlt  ociat aDelnms;u4 ltrifctatlmDe nes;(0trxrio oy1lmeelfetl(fsDum( p;o1aexomoctysla2ua(ms;u4 eenmocto1fm r i ols) rxr(o3ny4al  lictltf rrrx  ;o1alx mfeils m um( p;t) rermf tadfmtrai s;(0trtrxm ny1am emneils aDua(mo;o0apxn i3tytfmDum(mo;u4 lenmocoo1omt aivol(0tetrxr3nu1lmenmnet s) Dra(mp;t0apt ioctadfs umu o;(0tlerxrctydoat  nvi (0 rtrxmpiu4lmenmfct s artr(  nu0opxn fcils s2umu snu) rerxo3ta1lm  aivs t  2uoimpoy1lme mfcs tfsDtrurpoo4alenmi3tys a2emums u4alenxf tydfmD ln o;s t2um(opnodol n fei tfarrmxm oo0tltomietatla2umu s;u4 exnxo3io1omtr ivo ()srxmir oodoleelietas)s2umx  oo4alxn f3iltfs2rm( sn(4artomoctatfat anes () ruo(mpnydoptelfctl() rtaxro;t0texn iciydla emuvp;u)aexnxfciytlm raues ()srtrir oo4amen ncsl(f rtaur oo1altnif3ilsla umnmo u0trerif ty1omte n s s0s2xr(rpou4alt mfes sf rtr(ronu1ale iiciltla2rm(mo;u)trxoio tadlmDr uei s  2xrio3oo1alt  fvi ()sDurx pnu1aleo ictyd aDranvs t)aeeoxoctadlatrai s (0 rtrio3iudll e ivtls)sDumxm ot1tee iictatfaDuluvpnt4aeerif oy1faDe u i;() exr(r3oo4lp emieias)sDuaum oo4tpenmf3iyd a2eaums;(4treomrcoa1fm  au ilt0 euoirpoo1al emnviltf ruau  ;t0tleo ocild aDumnms u0aetnmo ia1lmte ues (  2to(opiodopt lneiasf Dururoou4tetnio3ilt sDelnvs t4 lxrifcoo1lp  aneils)srto(m3iydamt lneia(farum(  ;o4ale  ieiltlm ua(mp u0 leoir oytfptrlu o s) rurim iu1am emfeiasfsrrmxroot1optnio3iad m2ul(vsnt)aleoifctotopDeaies;t0t2toxopnu1am emncs t) 2tmu pou1ope  ieiatlsDuanmo u4teenxfciatlptr n s;()s2xrxr iudomt mfctl()artax  nt4aptomo3iltla2ra( sn(4teenmo3iytoa r nei;t)srxm(m iydlltn fci sfsDrmumo;o0oee io3iatls2elu p;(4tltnxocoodla rau sls0s2trxrpnu4lm  livia() rrrurp;t0opx io3iad s eanvo (0tltoir3iytlm   nesls)trto(opiy1optelies s)srra(mp;t4apxomociasla2em(mo;u4texnifcoodlmteanei;()trtoimpiu1openmfcsatfsDraxr no1tpxomfciytfa uanvs () rtnmociytop  auei;(0setrxm nu1om emici () 2taxmpot0olxn iciad s rm(mo;t4alxnmo tatfm  ln i s0s2urir ny1omtnlfvil( a2urum ;t4opeoif3iysfs2emn o;(0tleoxf oy1fa   ieol(0seur(rpny1op emnetat a2umum nt1aeen oeiytfm rau s;(0 eeoxo3iydlp e uvs s0sexrxmpnu1ap e fesa( aDuaur ot0olxomfeils s rlump () ltnmf3tadoaDeaiesl()trumirpnodlmt lnvtasfsrumx  ot1tpxnifciytfs rlumsnt0 rtoio3to1fptean ol(0 2tmxm oodlltelfeia(  2ta(rp;u4aexomieias a2em( p;t)trtomr3to1oaDr nvsl()trtoxm3nodlmt  iesas)s2ur(rpou1tltomfcias m umnvo;t)alenmo3totlmDrln s;t)setmir3no1lltemfes sf Dtrx p;t1opx miciysfmDemumsnt4artnxrciotlatraivils t2uoxrpny4oleelivslt sruau pou4tpe  ieilsfa2rlump;u4aetrmociydlmteaivi;s0trxrxo oo4optnliet sf rtau o;u0tleo ieiatlm emu s;u)arxrir oytfpDeaieslt0 2xmxo ny1oleemietas srrr( oot1ope mfeias m uaums ()trtnxfctadopD ln s () rtmxmpiu1apen ieias)arurx  ;u0ope  ietlt mDua(vont4arenmfcoodoaDrln i;s t2ur(m3io1apt mnviat) ruaxm ;o4alx if3ilt a em(msnt4treomf iydfmt anvi;(0 2uoxrpny4ap nlncilsfaDum(rpnu1tpe  ieildla uau s;u0teenircoadlateaueslt t2urim oo4am  lfet () 2tmxmo;t1apt  ieiyd a2em( onu4teerio3oo1fpt ln s () 2xmxopiydlltnlnvslsfs2rrump;t4teeomoetad mDuaumo u)aeeoir ootomt aivolt0setmir ou1olt  nes ( aruau pnu4oexo o3iyslaDulumsnu0aleoxf oytlpD aieil(0t2tmiopiu4lmt  ivs sfsDtmxro;u4opeoifciadls2ea(vp;t0 ltnmo3ty1oatelnvsls)t2xoxo3oy4lltemicsa()aDumxrpno1ape io3iat sDra(vo (0tetnmr3iydfa   n slt0srurxo3oo4lp n neiasfartaxr ;u4apeomo3ilslm2uauvo;t4 lxomrciadlpDr n s ( srto(m oudopt  nei sf rrmum oo0ole mfciadfs eaumo;u)arxomfciodlpteln o;s t2xrim nydopt mneslt aDurumo;u1oeeomfcildla emuvsn(4 rtriocoy1omte n i;(  rurxm iu4amtelfesltf 2ua(r no4apt iiciad m rmnms t0arxnxf3iotlpt lnes t0trxmimpiu1oltelfeilt a2rru pnt1alenmoetldlmDelnvo;t0 ltnio3io1fpDr iesls0seur(m oydlptemnvi t  rtax o;u0aptoiieildlm2eln s;u) exoir3tatfpDr nei;t0trtoxo oy1ol nmiviltfsrur(rpnt0tle miciytlmDea( s u0tlerir3oydoaDeauei t) exoxr oudaltelneiasf rrmu onu1oee mi3iadfs uan o;u4 renirciotfat aieo (0seto(rpno4lmee ncilt) rumump;t1aptoifctlsls2um(mpnu) eenmo oydoptr ivs;s0trtmxo iydomtn ivilt aDtmxrpnu4teeoioeiltfmDrmnmsnu)teenio ia1lmDeaieo ( s2toxr iudap elnvt () Durx ono0teenifctatfs ul(vp;t)trxomf3oo1fm eanesls)texrxm oy1optemfvtl()aDtm(r nt0tpxomociysfaDea(mpn()aeenmr3to1oa  aiesl( teuoxo no4lmtelnes (f 2tmur ou4texomi3iytfm emn snu0aetnxocto1lpDrlnei s)t2xoim3no1ole  ivilsf Dtaxrpnt4oex ifetydfsDrm(msnt0tetnmo3iatfmteai i;( truoxr iy4opt lfes t s2uax pnu0aet mieiasfa2ranmp;t4trxnxf iadlat lnvi t t2umiopnydllt  ivs t)srumx  ou1tee  oeiltla ranms (0 reomf3oytlateaueo;()s2ur(rpno1lmte netl()sDtmumpot1teeomicilt mDeaumo t)alenif ty1fmD luei ()tetoio3nydaltn nesls) 2rmumpou4tpe  i3tlsfm el(msnt) ltrio iotlatelueols0 rtmxo3iu1lltnlncil( srrmxrpnt0tlxniictat s um(vs;u0 ltrmo iatla  lnvo t) rtr(m3nu4lpe miesl() 2tmxm ot4apxniiciat m rmu o;() ltrxf oatomDrli slt srum(m3iu1lpt  neslsfsrtrxmp;o4ope  icils a2rm(vo;()trxrmo3tydfaDe nvs;() 2xm(r ny1llt lici t)srtm(rp;u0tptnifeiydlm umuvont0tlxnio3iydfm raivol( tetoir3nodoltnmieia(fsrurx p;o1tpxoifctytls2eaums u)alerirciatlmteanei ()srtoxr io4lmtn ieiltf rtrum ;t0openii3iadlm2ulnms;t0teenxo ootom r n sl(0setoxm3ny1apenlnet t) Drr(  nu1tee iicilslmDel( s;t0aexnxf iydoatrlnei s) 2uo(r3oy1ap e ncs sfa2rrum ou4texnmfeiyd m2uln sn(4trxnmr3ty1lmteluesls0 exmxrpno4olt lnvsl() Drmu pno0texomfeiyslm uln onu) reriocootopD aueo;(0texoio3oo4lmtn icsltfs2rrx p;o1oeeoioctlt s emnvo ()trenir3oo1fmtr nes;()srxrxmpiodop n fci sf Duax oou1tpt  fcias m eau p;u0 rxoxrcoo1lmDean s;()s2urxr oy1apt livsls artaxrpou4olxomoeildlm ea( sn()aeermr ta1fa  livo ( srtmirpoy1ale mivsa( sruaum no0olt  fcildla2ea( p () eeoifcoodla rln s;s0trtoiopoy1ll  micsas)srrrurooo1apenioctad s umn o;(4tleoxr3to1lat luvsls sexo(r3no4omtn nes ( arta(mp;u0texniicias mDul( pnu4tetoxrctodfmDeln o t sexr(m oo4om e ies tf 2rmxmpou4apeoifctys aDulums;u)tleoiocoytom ranvsls0teuoxr3iodamen ivta()arraump;t4tpeoifeiytla eaumsnt0areoif3to1fpt lnvol()t2toxrpoo4ame mfvtls a2um(mo;t1oltoifeiys m2rm(vo (4teerir oydoa  lnvi;t  ruoxm3oo1lptnmfvilsfsrrru pno1aetnmf3ilt a em(vpn() rtnircto1oaDrlivo;s0sexoim3io1lpee neia(fa2uaxmpot4tptn ieildls2ul( p u)tlenxociadlmt ai il(  etmxo3iu1apenmivilsf rurumo;u4optn feiad mDemu pn()arxnxrcoa1fate nvi;( s2xrxm3nudlpen ictlsf 2taxr oo0tle mfetasfmDum(vo;(0arenir oo1lmt luvo t0t2tr(r3nodlltnmnci (fs2ua( ont0opt  feiatfm2rlumon(0arxrif oa1oatranvi;() 2xoxmpnu1lltelncsat)s2trur ou0alxnmi3tytfa2rmump;(4tlxoirctydlmt aivi (0 etmxr oo4ope  neiasfsDtmxro;t0tlxnmictlslm2ea(mp u4texnif3iadfm elies (0setrxo io4ale  net (f Dua( oot1altomociytfs emn p;t0 lxrio3iatfp eau o;t0teuoir ny4lmen fvi (fs2rmu pnu4olxn ociadlm2umnvpn(4arxnmr3totoa eluvols) exrxm3iudlptnlici t)srrm(mont0tex  f3tlt m el(mon(4texrxo ia1lmteaieo;() 2um(r oudlmt lieils s2rru oou0tetnifetld m ua( on()texrxr3todlaD ln o s  2ur(rpno1omt lict s sDum(moou4apxnmi3iadla el( p (4aexomo iydfpD  ieo s)texmxopiu1lpe  ivslsf 2uaxr ;o1tee mieildla rl( o u) leomo3oa1fa r neols) 2ur(r no1ll elnes t srum(r nt0opxomfetat s2ua(vs;t)tltrmocoo1oaDrauvi (0t2xmio iu1lpt mnetas  rumx ont4aexn o3tldls eluvp u0 eerif3ootlaDelueslt0setrio nu4lpeelncils srrr( pot0altoiictadfsDrmuvp u0trxomr iodlpte ueol(0 rtmxopoy1omtnlivsl( aDrrum ;u4altniieiydls emumpnu)texrif3oodfa r ivsls  2umxmpiy1ope lfetls a2uru  ot1oltnmieiys a2umnmsn(0tetrxrciodopDe ivs s)trumxr ou4lmtnlnvsas  Draurpnu1tlxn i3iyslm rl(ms;t)treoir3oy1fmt auvs s0 eum(mpoodope mietl()aruax o;t1alxoiociltls umumo t4 leoxf3tadla eanvo;t t2urimpiu1llen ietltf rraxr ot4aetnif3tltlm2eanmsn(4artnxocoytlm elu s;s t2tmio3nodap   icilt arraurpou0texnmoetlt m2rl( snu0 eermf3iytom  an s ()t2xrxrpnodlmenmnvi s  2rm( ooo0aee  i3ildfm umnvo t4treomociy1omtelivs;s0 eur(o ny1om e ncsat  Dra(mp;u1tpxoiictlsfm2rl(vpnt)altnxocoadomtraueils truoxr ny4ome lfcils arta(mpot0tpenio3tyslmDrl(vs (0tetoir3iydfa   i olt) euo(m3ny4lme mnet (f 2trurpot4tpeomociasfs rm(vo t)artrmfctadfptr u slt0trxm(rpno1alte nviat)aDrr(moot4texomi3tld s emumpnu) rtrmocoydomDelivil(0texrxm3oy1om e iesls srtr( pnu4tltomieiasls2rau o;t0artoio iytfpte ivo;(  2xo(mpnu1olee fei ()sDrrx ooo0opxoio3ils m2elnmo;t4 eerxrcootfa  an o s) eumir nodameemncslsfs2rm(  ;t0apxomiciytfsDemnms t4tltoioctytlm elueolt) etmxr3iudlmee fet s sDrrxr nt1alxo oeiydfa rmu snt4 lxrxo3ootfa elivsls) rtmxr no4op   nvslt)aDtr(mpou1ale mi3ild s2ulnvpnu)texoxrciytlpDr ivs s0trtr(o3ou1ol   icsl(f rrru pnt0tlxnmietydla2rl( p u)trerio iadlaD an o;(0 rtmxr3ny4opte ivi s  rtr( pnu4oltomoeilt a rlnvp ()aetnmo ta1lpDelues (0srxrxr3oodam elncsasfartm(mpou0ape ifetytfaDea(mo;u0treoir ia1opDrluvi s trtrxopnudlltnmici t)artr(  ;o4ope  oeiltls2rmumpn(4trtrxo3to1lmDelueslt0sexmxo3nu4oltn ictl(f 2ta(ront1apenmo3iydfaDumn s;(4alenxf totoa  anvs s)trxm(rpou1oltelnvi t aDua(r ot0oee iociad m2um(ms;(0tltnio3iytlm eluei ()sexo(r nudaptelfesas aDumur no1olxnmo3tad s rl(vp;u0 lerxr3iotoatelnvo;(  ruo(opio1apee ncia()s2tm(  oo4tet  ocilsfa ean s u)altoxo oo1lmD anvi t0s2umxm io4ll n feilt)artrxmpou1tpeoif3tls a2rm(mpnt) renxf io1faD  ues;()t2umir3nudop  mfcsls) Dtm(r nt4oeen ociltfm2ea( o;t0alxnmf iadlmDrlnvilt)t2xmxopiydlleemicias)arurxr ;t4tlx iieiytlm2rl( o ()arerifcoy1lpt livilt)srum(rpiu4al  lnvia()sDtrurp;o1oltoiociatfmDea( p;t0texoio iy1fp eaies t0t2uo(rpnu1amtnlnes ( srtrx pnu1tlxoif3iyt a2eauvsnu)tlxnxr oadfm e u o t0 2xm(rpiy1aptn nvtlsfartm( pou0alx  ocilslaDrm(mp;u0tlxrmf ootfmDelu ols0s2tmio iy1lmtelfesa(fsrurxr ou4aptnioctaslmDul(mo;t)alenxo3iotfate u ols)sruoxr3iy4llt licsl()a2trx pno1oeenmoctatfa2emnvs t)aetoxrcta1opDrauvs;t teumxo3iydolenlivs sf 2tmumoot4olenmfciltfsDranvp;(0aetnmr3ia1lm r n s t teur(rpoodaptnlfvt t)srtrumoou0olx ii3tytlsDean p;(4tltomr iotopDeln sl(0srxmxr3ou1llenlfvs (fa2tm(mpnu1aet iocils a eau o t)alermrcty1oaDelueil( teuoio3oodalenmfcias s2umump;o0olt  ieiyd a uaumo;() etrmo3to1fp r ivs t0srtoim3iu1alen fctl( aDtmxr ;u4alenioeiasla2emn o (4artoif3ty1fpD auvilt)s2tmxr3ou1llen nvsl()srta(mp;o0optoiocils s2um( p;(4trtnmrcoo1omDelu il() 2xo(rpnu1lltn ivsatfa2ta(r oo1aetnifeiadla2ra(vs u)tlenio3oatla  lu ils0tetrxo3no4llt lncil(f 2umx oot4aleo f3tyt m uanmsnt4tltnir iy1lptranvs;s srtmimpnodlpe licil() Dra(  ;t4apxnmieiyd s2rl(mon(0 rtoir ia1oaDe ieol( s2xrimpoudoleelfesat) 2ua(m ;o1tltnmoeildfa eln p t4tltnir3to1fm e n o s tetm(mpoy4am  lnct s)arra(rpou1opx iiciat mDrln p t0artoioctatomtelivil(0 etrirpnu1op  lfcias artmumooo0olenmieiytlmDemnvo;t4 ltrmo iydlmDr n ilt t2toir3ny4omeemfetl(fsDum(mo;t4tltomietld a rlnvsnu4 etomr3oatomtrluvsl(0sexr(o3iydop  mictl( s2rmumoot1tpeo oetadlaDua( snu4texomo3oodla r ies;t t2umio3iu4lmeelnctat) rrr( pnt0tlxomfcilsfs2uanvpnt4 exrxo oa1opDelnvs;(  2uoim oodom  lnei (fs2raxr nt1olto o3tysfa2rmn sn(4alxrxrctadlmDelivo s) 2xmxm3oydol nlieia()sDtru o;o0oet  iciadfa2raump u)trerifctotfptrluvils tetoio io4optelncslt  Dtm(mpot4oetnmi3tydla2ra(mo;u)texomfcto1lmD ai o s0t2xrirpiudalee feilt)arurxmooo4opto f3iasls2em( on(0 leoif3iadfa rlu slt s2xr(r nydlmte fvs s  2tmxrpot4aeenmociyt a raump;u0 lermoctytlm  au s;s)trtoimpnu4omen ietlt sruaxrpno0aeeo fcildlsDrau pnt4aleoio3totlp e n i (0s2toio3oy4ll  lnei ( a2taur ;t4tpeomf3tyt a ea( s u4 lenmo3ty1faDe i o t) eumiopnodom  mfctlsfaDrmumpoo4apenmfciysla2emnmonu0tlxoxr oytoaD anvols  etmxr3iu1lmt  fci sfsDurum nt4aeenmoctlt a umumpn(0trtoxf oy1fpDe nes;s0 2to(o3iudomtnmncs tfsDuru  oo4oleoiocild aDrmump;u0aetnir iydlmt aues t0t2tmim3io4lptelneslsfaDumu p;u0olxo oeilsfsDem(mp;t4 rxrmfciatfp  lneo;s0trtoir oy4lltnlicsl( artrumpno4ale if3ilsfmDrl(ms;u4 rxrmo oa1fa r ivilt s2to(r3oy1ap e nvsl(fa2rr(roou1tpxomi3ildls2rl( s u) rxnmrcoa1lpDeli s;s) rurxmpny1omenliet tfaDraxm ;u4opx ifctysla ra( o t) leoxf iotlmDrliei t0 2xoirpiy4open feil()s2trxmooo0tpx iicils a eln o u4 etomr3tadlat li o t  exo(r oy4ol   nvsasf rumur ;t4aetn iciyd a rmnmo;t)arxrifciy1oaDrluvo s0texo(o iu4omtn ivtltfs2ta(mpoo0tpto oeiys s el( onu0alxoxf3ootlaDeanei;s) eumirpny4lme lfcslt)aDrm(m ot0tpto iciltlm2raumon(4 rxnxf io1oaDeauvils  etr(r3iodlpeemnvil(  rtrum ot0teeomfeiydfa2ra(vpnu0 rtoircoa1fmtrlneils)srtrxr3oy1omen feils arrmum oo4tpe mo3tlsls rm(vs u4aeenif3iadomtrau s;()s2tmxo iu1llte nci sfa2uaur oo4tpenifeiltlm elu p (0altomf3iodom  lieo (0 etrxo3oudop elnei t)sDrmxrooo0ape  ictyt s2ua( pn() rxrxfcto1faD  uvo ()tetrxm3nu4op   fvsls) rtr(r ot4alx ioeiaslaDua(mo;()trxnxr tadlmDelivs ()tetrio3nudam  lncils)s2ururp;u0ale mf3tyt m2uanvs u4 lxrmo3tytfat anvo;s) 2trxopoodapt  icsa() 2urx pou1tee ioeiadfm ranvpnu0tlxrif iadom r u sl()trumxr3ou4amtnlfcs (f Dumx p;t4olxomf3tas s ul( p u0aetrmf3tatfmD aueolt)trum(opoo4omenmfctl(  2urxr ot1olxoifeiad aDulnvsnt)alxomrcoatop  anei s) 2xoxm3nudapt lies (  rrmxrp;t0opeo f3iatfsDran pnu4aetrxo todla r nei t)s2ur(mpoo1lp emfei (faDtm(r ;o1aeto octltfs rl(mo;u) etrmf3todlmDean i;()sexrxr3oo4lmeemiei t)artmxm ;o1alx ii3iydla eln s ()aleoir ty1oat li s t)tetrxr ou4olee netlt  Dtmxmpot0oeeoiocils a2rlumsnu4tltnmf3ootoatraivo t0teuoxopnodlpeeliet t) Dra( onu1tltomf3tydfm2rmu pnu)trxnioctydfmteluvilt trurim oo4lmtelivtasfsDtaur ot0tltomo3iysla rauvpn(0tetomocia1oa raieils0s2uoirpio4ap elnci s)sDtr(r ;u1apxniicild a rmn p;u4altnxf oy1fp r n il()seuo(opou4lm e fvt ()s2umx ooo4tpx  fetlslsDrmnmsnu4treoxf3oodfmDe n il( tetrio3iu1lp nmfesls  rtru  ;o4oex mi3ilsfmDea(mo u0arxrxr3oodomt aneils seumim oydlptemnesls) Dtaur nt0tlxnii3iytfa rlump;t0 exrio3io1fat ln ils)s2tr(opiy4al nmieil(fa2ua(rp;t4oleo icilslm2rlnms t)arerxo3ia1lmD auvols)texoxrpoydop emfeil(  2trump;u4tlt moctydfs2rmuvpnu4trxrifcoydfpte n olt0trumiopnudap nmnei s aDrm(m ot0aptniociltlmDrl(von()artoifctytfm rlnvo ()s2trxm3ou1ame mnvia(  rtrxm oo1texoiocils s rmuvo;(4 ltrmrciydoat  n ils)seumim3oy4amtnmnes tfs2umxmont0apxn fciaslaDemu s t)aetrxfcootfmDr ueil( srtmxm iu1al nlivt s sDtmxro;u0alxo i3tatfs um(vp u0trtnxocoa1lmDelieolt)tetmirpio1oltelnesls)aDrm(rpnu4alt ioctas mDum(vs;u)aetoifcootlp rlu sls)trtrxm iodop n ivs () ruaumpnt1aetniieiadfs ranvs t) lenmrcoo1fpte ueo ( sexoxopou1olenmiciat)arua(root4opxn f3tadlm uluvpn(4texrir3io1oaD au o;t seuo(m oy4amtelfvsatfaDrrxmp;o1aeenmoetltfaDemnvs;u) rxniocootfa ranes (0trtm(o nodomtnmfesas) 2urxrp;o0ope mfctlt a ran o;u0 rxoxr3iydlm raivi () etmxo3oydape livt tfs2tmx ono4olenif3iydlaDel( p u0trtomo3oa1lmDeli o;(  2tr(o nu4lptn ncs sfsDra(rpnt0olxoifeilt aDeanmo (0 lenir3ty1lmt au o t t2xo(r3nu1llt  fes t sruaumont4oexniicilslm2rl(mo;u4alerxrciatopDraivi t0t2umxopio1lm elncta(fs2rrum ou4alxniietysls rlnvp;t)texoxf todfpt  u o ()s2uoxo3oy4apt lfct ( aDururpnt4oet mieiat m eln s u)trxnxoctotlaDe nvs t)s2toiopnydlp elics tfa2urx ono1tpenmo3taslm eanvp;t0alerio tytoptr n i;() 2umxrpiu4lmenlnet ( sDraumoot1optniocils s em(mpn(4tetoio3tydlpteau i s)texo(o no1aptelivt s  2tr( pot0alt if3iysfm2rlu o (4trxnmr3iatop ra
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;()sexoxr3iydlpt  fesl( sDrrxr nt0oet iiciytfm rln s;() lenio3oodlm r uvi;t s2xmiopnodalt lfcs t a2tm(  ;u1oltnifcilsfm2elumsnu0 etrmo iy1fa e nei;t) 2urxo nydomtemfvt tfa2tmur ;u1tlto oeildlaDemump (0 lenif oa1fp eanes (0 rxrir3io1apte ivias  2rrxr ;o4apxomociytlm elnvs;t4 lxoif iy1la eln s s)trxo(rpiydlp   ivs tf 2raxmp;t0opeoif3iadls2ea(mo (4aeenxf ia1lmDeai i t)sruo(mpno4lpte ivta( aDurx p;o4tpe ii3iadlmDranvpnu0artnmfcoa1oate ivi;t truoxmpoo1llt mneta( artm( ont0oleniiciadlmDumums;(4trtrxoctatopDr ivs;(  exm(r ou4lp  liviatfaDrax pnu4texnmieildls2rauvpnu4aeenir3oydopt aneo (0t2toir3oudlp  lnvsa(  rraumpoo1aptniociatlaDemn p u)alerio3iy1om  lnes t trxmio3ou4lp emfei s)a2tmuro;u1optomfcildfa2rauvsnu4 renxr3iy1lm r ivi ( tetm(r oy1ole  net t s2rau pno0oltoioeilsfa ranvs () ltoxrcoatoa r ueolt)t2tmimpou4ope mncia(fsrtr( ono1tptomocildla rmnvs u4trxomo iytopD  i o;(0 2xmxr nodomt lfvt s)a2tr(  nt0apxo fcildlaDrmuvp;(4treomr3tytoa e n s s trto(m iodal n fvias  2taxm nu1ape if3ils a uauvp u) ltniociatfm  luvo;( srxrio oudaltemivias)aDrm( p;t0oexoiicilt a emuvonu0tltrmf3tydop elu i t)t2uoxr ny4om emiesatf 2rmxroou0tetn oeiysfs rl(ms;u0tltoioctatla  luvs;()s2urio3iy4al elici () 2tmx pnt0tlto f3tat sDulu sn(0tltrxr iatfm rlnei;t sexmxm iy1lle mfvsls) 2umurono0apeomf3ils s em(ms;u0tetomo tadlaDelivsl(0 2umio3nu4ape  nvias sDtaump;u0tltnifciyt aDea(mpn()arxrxrcoadfpDrlueo;(0trxm(m3iydam emnetls  2rru pno0tlxomictls mDrm(ms;t)artrxr iodop rlueolt)t2tmxr3iy1olenlnvsl() Duax  ;t1aeeomfctys a elums t4tetrmociadfpte u olt seuo(m3ny4openlnci t)sDua(mont4aptnif3iat aDulnvp;(0teermr3todfm rlu ols0srtoir oy4lpe licilsfs2uauro;o1oleo ieild m2rl(von(4 rtrxfciydfpt  ies;t0s2xmxr iu4ol e nviat  2ra(rpou4tpt mictltfa2um(vpn()tltrir iadomtr ivi;(0trtmxr ou1lmenlivtls  2rm(mp;o0tee if3ildla uluvon(0 etrirciytlmDe ues (0 2xr(o3no4ol  livtl( a2rau poo4apeo o3tydfm2rau snu) exomrcoa1fmt auvils) ruoir3nu4alee fci s  Duax ont1tlxoio3ild sDuanvo;u0tleoxo3oy1lpDr nes s)trxr(mpnudol nmfvtat)aDtmumo;o0tpen feiltfm2ua(mpnu4tltomo3iy1lmte ivi;(0 2tmim3iudaptnmfcilsfsDumumo;t1tex  ociadfa2uau o u4altoio3ootfpD auei;() rxr(m3io4alenmneta( aDrm(ront4alt ifeiadfm2uaumo;()aleoir tytfatr iei (  euoxm3ou1ol e feiatfsDtrur nu0aee iieiltlm2eanmp;u0 eermo3oytlmt anes;s0sexoir oy1ap nmfviasfaDrrxm ;u1apx mf3tlt aDulumont)tlermo3oydoa elu ils  rxoxmpiodomtnlivil( arrr( p;o0opxnif3iysfm ean sn(4texoir3ty1fmDr ieo t0 etoxo3oo4apen ies () rtrum ou1ope  ictlsls um( p t)trerxr3to1omDe nvslt0srtrir3no1al n iei t) rtmxr nu0oee  ieiydfs elnmp t4aexnmf oydopte n slt teurxrpoy1om n icta(fsrur(mpnu0tptn i3iaslaDua(vs;(0aleomfciadlmD  nei ()t2tmxo3no4ole lfetas sDrmxmo;o1tlt  i3tydfmDeanvp;(4teeoxf iotlmt  nvi () 2xo(r ny4am nlieia()a2trum ;t0oex mo3iasfm umnvpn()teermo3iatfmtrlieslt)trtm(o ou4lptelnvtat arra(mpoo0oex iietad m2ranmsn()tetoif tadlpt aueol(0s2xo(m no4amen fesasf Drmumo;u0aexo ictas a eauvo t4altomfcoydla  lneil(0teto(r nu1lmt  nviltf Dtmx oou1aee io3iltla2emn p;t0artoxfctotoaDrai o;( s2urio3oodom nlnci t  rrrumo;t0tex  fciadlm2rluvp t0treomf iodlp  lies;(0t2xrxr iodamte feslt sDtaump;t0teenifeiyt mDuan o;t4 rxnir ty1lpDr ivo (0s2umim3oo4llenlieilsfartmum ;u0aeeoiictasls rlnvs t0trxnio3iodfp ranvi t texrio3iudlp  mnvtasfsrta(mono1apxoif3iytls2eanmp t)aleoxo3oodlate i slt seuoim iy4am elictlsf Dtaum ;o1tlx ifctysfmDrlumpnu4 exrio3tadlaDraieo s)setoirpoo1amtnlfcsa()srtr( p;u0opt if3tlsfm2ulums t)tlxnmrcoo1fa eau i t) exrirpoo1lpt livsa(  ruau p;o1aexnif3tlt sDuan sn(4tlermr iy1lm eai i;(0s2ur(mpny4lp nmici t aDtrum nt1aleo oeiltla rl(mpnt0tltnmr3tatlp   uvo t)seuoir nydopenmncils srrm( o;t1oetn feildlm elnmp t) rxoir3iatlpD ln s () 2tmxm nu4ol n ici (fsDumumpnu1apt  fctytfsDranms;u)areoxf3ia1lp elu ols0s2urxm oy1lpt mfeilsfsrta( pnt4oleniieiatfs uau s t0 etrmf3ia1op elieo (  2xrio iu4optn ivsa(  rtaxmpou4opxoif3iysfm rln p;u0treomf oatfmtr iesls) 2xoxo iu4lpeemfvs t)srtmxrooo1alx  fctltla2rlums;u0trtomo3ia1om r u s;t)sexm(opiu1optelnesasfsrraxrpou0apxn feiyd m2uanvs;(4 eenmo iodop rln il()srtm(o oydllt mfeilsf rta(  oo0alto ietas a2emn pn(4teerxf oytfpte n i;t  2trxrpiydapenlnvta( a2rrx o;u0aeeoifeiatls rmnvp;(0 leoir3tadlp  lnvo () 2tmxo3nu4lm emiesat arra(  ;u1opeo ictldfmDranmon(4teeoir3todfa  li ilt)tetmxo3oudoptemici s s2rru p;o4tpxoifctltlaDulnmo t)tetoifcta1fm ranvs (0t2ur(o3nodal n fesat  2rm( p;t0oexo ieiydfaDua( o u0aexnifcoy1fpD auvs;(0tetoxr no1optnlnetl(fsrtru ono1alenmictysls ua(mp (4tlxnifctytfmte n o (0trtmim3oudole  ncslt)aDuaurooo4tlt miciydla2ul( p;t)tlxrxr iydfp e ues ( t2uoio ou1opt  fesat a2tm( oot4tlxn fciysfm2ranvo;(4aetrif iydoa   ivil()s2tr(m3ny4om emncsa(f 2tmurp;t0oeenii3ild s2um( sn()trtnir iotlptrlivo;t0srtmir3oo4olt  ietlsf 2uax  ;o0tlt mfciadfmDrmumon(0tltomf3ty1oaDrluvo ()seto(mpoy4ap e fvias)a2umxmoot4aee ifetyd a rlu s (4 etnifctytfpDrlu i t0 2xrim oodlleemnvilt)a2rm(m ot1aeenmfciysfs2emuvont4alerxo3tadop   n i s)trumio oudapenmncils artr(m ot0oexniociltfmDrmn p;t)trerif tatlptrlu i;t)trtoxm iu4op   ncils)arrmu poo4aex moctytla2rauvs t4aeenio3oatlmtraivo;t0 2um(r nudopen net (  rtaxm ;u1tptn iciys a rln snt) eerxr3ia1fpD lnvi (0texoirpoo4ale miet (fa2ta(rpot0tlx  icias s rmuvp t)teerxf iydlmte i s;s0 rxo(opnu4lltemnesas)arra( ont1oeeo feiltfs ranvs;t0 eenxf oodlp eauvolt) 2xoim3iudap e nvilsfs2urxrpno0oet  i3iyt mDel( s;(0 exnxr3oydomt luvo;( trxrxo3no1altn net s)sDrrxronu1aeen fctatfsDeau pn(0aetrxr3iytfatelu s;(0 2uo(r iy4lm elivsa() Drr(mpoo0aptniiciasla ra(vs;t0 etrxf ta1omtranvolt0trum(mpio4lm emieiltf Drrumonu4opxnmf3tadlaDumnvo t4alxomrciytom   uvol( srtmxopiodop nlfvia()artm(rpno4texnmicildfm umnvo;t0trermr tatfp r ues;t texrxrpoo4op eliet s a2tmur oo0tpe mo3tlsfm umu o;()arxoxr totlptrluesl() 2ur(rpnu1optnlnvs t) Dtmxm no1aptnio3tlsfa uauvo;u) ltnxoctatfp raneo;t)s2xrxopnu4lpenliesatfaruaxm nu4ope iociyd aDrmn s;u4 lxnmf3tydlatranei t0 exm(o iu1om  lfeia()sDua(r oo1tlt ioeildfa2ranvs;t0teenxo3totom   ieo;s)srtr(mpiudlpt mfeils  rumu  nt0tpxnioctaslsDeln sn(0arxoxo iatlat  neo t0t2uoxr3nydale lfcslt a2umump;t0aetnmictldfm umn s;(0tltrxf oa1oaDrluvils0 rumim3io4om  lnes s)aDrmu  ot0teeoifciytfs2em( o;t4trxrirctytopt lieo () 2trxr no4ol e ivsatfa2trump;u0opx mfeildla2rln o u4aeenmr iadom raivol(0texmiopiydlpeemfvias arurxrpot4oetomf3tad a2rmuvonu4tlenmr3oatoateluvo (0t2xr(m nudol nmieil()sDtrx  nt1aexoifeiltlm eluvs;(0aeenirctatoatr nei;t0trur(r3oy1altelnvtasfarumxrpnt0tpxoif3iytfaDemnmont0alxriocto1la  lu i s)s2toimpno1amenmicsas)srtm(m ;t4aeeomoetldfa rluvsnu0aetrmfctatop   ueols)sexm(r ou1ale  fctat)a2trur ot1tltoifcildfa2rm(mp;t4 etoio todlpt  n i;s0teuoir oo1ope  neta(f rrru  ;t1oetomf3tytlm2um(ms t4aleoxrcoy1optraues t  rurirpiydam nmicsa(fsDum(rpnu0tlt  fciatla ea(mp;(0teeomo3tydfmt au s t) 2tmxo3no4ap e ici s  Dumuront0oetnif3tyd sDra(mo;t4aeeoio3ia1omte ies;s)s2xmir iudllt lfvils)sDrau p;u1oex  ictat m2em( p ()altnmociy1lp r ieo;s)teumxr3no1op nlfeiatf Drax p;o4ape moeilslm2el(vsn(0tltrxr tadfpt auvi;s)trxoxo iy4lp nmici sf 2ur(m ou1tlxnmoetad m2rlnmpnu4 rxomf3tydlp eai sl( t2um(o iy4am nlivia()sruru pot1oetnmo3tls m2um(mont4 lxrxo3oytfa   i olt srtmir3oo1aptnlicia()sruaxm oo0opxnmi3ilt sDua(mont4aeenxrciadomDe ivilt srxoimpiy4amenmfesl(f rtrur no4oltnifcild aDrl( s (4trxomr3totlm   uvils  2xoiopiudal nmncs t)aDrm(  ou1oexnioctldfmDra(vs;t)texrmo3oatoateliesl()sexrimpoo1alt mfes s  2ururpou1apeo ietasls2emuvsnt0 leoxrctodopDelieils0 exrio oudll elncia(faDuaxrp;u4tltn ictat m umnmo t4 lermr3oo1lm  luvols tetmim3no4lmte ivt (  2umur ;o4oeto o3tyt m2umn s t4 lenmf3ootfa e uei t s2toir io4am n fes sfarua(mono1oexoifcilsfsDem(vo;(0texoxocty1lmD anvs;s0 eumimpiy4llt  iei t a2rrxm ou0altn feiadfa uanms (0teenmociotfaDrlnes;(0trxmxopiy1aptn netat  rurur ou0aeen f3ildlaDemumo;() eenxocoa1oat luvilt srxm(r3ny4lmt  nvsa( s2rr(ront4aex  feiaslaDum( on(0 eenmoctydom  auei s)t2xo(m3oodlpeemnet t aDra(moot1aet mi3iatfm uanmon(0teerifcta1lptr n o;s teur(m nu1amtn nctlsf rta(  ou4apxo ictadfa ean sn(0trtrircoodfpD aneo;(0tetoxm ou1ap  lfes tfartrxm nu4tpeomfeilsfsDrm(vo;t)aeeomrciatoa  lieslt0trtrio3no4ll emnes t)aDtaumoou4aexoioetat m2uan s;u) etnmf ootfmtr ivi;t trtoxo nu1ll  lnei tfsrurxr ;t4tetnmo3iasla rl(ms;u4 renmocty1lp r nesls)sexm(opio1lmtnmietl()sDuau oot1oet  i3iydls2eau pn()altrifciydopte uvi;s) rtrxm3nu1opt lfetls a2rrur ou1oex  o3ildfmDumu on(4 lxomrciytfaDe n i t) 2xmxmpoodlptemieslt sDrrxr nt4olxnmi3tltfa rau p u)aetnir3io1op   n o;t)trtmio no1ap  mnet s srrru oot1texnifctad s2ea(mpn()arerxf3iadfa elivslt)t2tr(m3iy4ape lfvsl(  Duru ooo0olenio3iadfaDrl( o;() etomfciadfmDr i ils  exo(r iodlpenlicsasf 2tm(ront0aex if3tasfm2ra( sn(4aleoxfcty1op elneo;(0 2tmim3iu4ol   fcsls)arrm(  ;t4aptn f3ildlsDra( s (4tetnir3oydfp r nvo;t sexrio oo1opt mfcsltfs2umu oou1oleo ieiltlmDulnvpnu4aexnxfctodopt  uvi;(0 rxo(r no1apee ivs t aDtm(rpoo0teenifeiltla2uluvo u) ltrir3oatlat aieo t) exmim iu1opee ieias) rta( pnt0open ictyt s el(vont0arenmociadla eln ols trxmio3oo1lpenmfciltfsDrm(mpnt4aptomfciadla2emn o;(0trerxrctodlm r ivo;t s2toxm nu1opeelfvia(  rumx p;u4aetniociat aDrln on(4 reoio io1fpt luvo t0srxo(m3iodol  mnet tfarrm(mpou0teenioetatfs umu p u4 rxrir3tytfpt  nvs;(0truo(opno4lp   ictls  Dum(mpnt0alto i3iatlsDul( s t4tltrio oa1fp   ueilt tetr(r nydaleemnetat srraump;o4tetn i3ias sDeanms t)altnio iodfp e uvi ()texrxrpou4al  mnet (  ruax onu4tpeniieiyt s rmnvsnu4tlerifciatlmtr nvo () etmxmpio4opeemfcilsfarumuronu4tpx  ietltfmDuauvp ()arxrifctatopDrlnvo ()sexmir no1alt  nciltf Dum(root0aetnmociyt sDemuvs;u4alerio3oadoaDelnvo;t setmxr3ou1am nmnvtat  rumumoot0alenii3iytfm2raump;t0tlxomr ty1opD  ues;s)s2umxm nydaptnmnciltfaDtr( ooo1olto fetad s2ra(vp u4 etnxfciydlmDe ieo s) rtrio nudlltemfetls)sDumu  ;t4alxo i3iyd sDemuvp () renmr oytop eanes;t sexr(o3ou4ape lies ( sDrax  nu4alto iciytfm rauvs;u0aeenirciydfmt au i t s2uoir3oy1omen nvtat) 2tm(rono4ape ii3iltfs2em(mont0 lxrirciadfmDe ueo s0trum(o3oydll nlivt s aDrrurp;o1opxo fciytfm2rauvp;(4teerirciatfmDe ues;t0srurxmpno4ale  ictasfs2trxm ;u4texoioeiytls rlump t)trtrirciatomt  ieilt srtr(r iudam   fvsls)sDtm(mpoo0tltnmo3iydlmDul(ms;u0tlxrxfcoa1om eanvi t0 rtr(mpno4alt livs t srrmxm ou0aeeoioetyt aDul( s t)areomr3oy1lm e i o;t) 2um(m no1olte ncsa( arrr( onu4apxo fciltlmDuaump;u4alxrmfciytop eai sl() 2tm(o3oo1om nlictls sDuau  ;o4aleo fciaslmDrmuvo (0tltnxf iytoa  au sls) rxm(m3nu1lptnlivi tf rtr(rpoo1opxo i3tydfm2ra( pnu4 ltnircoodfm e ueol( srtmiopoudll nlfesl(f Dtaxmono1alt  octadfa umuvpnt0aeerif ta1lat ai ils s2uoimpio1ole  nct (farrrxm ;o0olx  o3iadfa2uau p;t0 lxnmr todfpte neslt) 2umir no1ome  feilsfartaxro;o0tee mfciysfa rmnmpnt4aetoif iytoa  aivi;(0texm(r iy1lm emneslt  2um(mo;u0olx ifctytls umumo t) lerxo3oadoa ean olt0sexm(opoy4oltnmiesasf rrmxm ;o1tptoio3ilsls rau o;(0arxnmo ty1fmte i i;(0s2uoimpio4aptelfcs ( srtrumpot1tee  oeiytfsDumums;t4aeenxo3tatomD  neols)teumim nydaptnlfesas  rumurpoo4opx ii3tad m rmuvont)alxoio iy1lmt aueo (0sexmxopoydll   fvi (  rurxront1tlx iietad s2ran s;(0treniocoo1optrai ol() rumxr3iy4ol nmfvt t aDur(rpnu0ape  ociyd mDrln s t4texrmfcio1fmDr nesl(0trxm(m oudlleemiesl(fsrrax p;u4tpe  ietls m umuvp (0alxoxrcoa1lmDeai s;t  rum(opou1ape mnet tfa2rm(mpno4opxn ieiydfm emuvs;t)tlxomf iodoptraneil( seto(o ou4llee fvs s)aruaumono0oeeo fetys s2uanmp u0 etoif3oytoaDelnvil(0trtoxm3iu1lp  mncta( sDtaum ;u4tltoioeiysfsDeau pn(4 lenxfcto1fm eaieslt  rur(r nu4open ivilsfaDtr(rpnu0tpx mo3iatlm uaump;u0trxrmo3iotlmDrln il(0trxriopnudolt  ivi s) Dtrx  ot1tetomi3iadfs uanmpnu0aexniocoo1fpteau s;t srurxm oy1apenlivil(faDrr(rp;o1apt iiciysfm2umn o u0alenif3iatom e uei;s t2um(mpio1lleemivta() Dtmx  nt4tlx io3tatfaDelu o (4tetrmfciodfp  anvo;t)seuo(o3nodlmeemfvt t srrmxrpnu4olenmieiydls ra( pn() ltomo3iy1oat  n s s  rxr(rpou1om  mnciat) 2trum ;u4oexnmfciyt s ran s t0 lxomr3ta1omt livolt) etm(rpoy1lptemiet s  Dtrxmp;u4tpxomietys a2uln p (4areoxo3iadop  lueolt0setoxmpnodoltelivil(faruaxrpno0tpe ifeiyt s elnmp;() eenifcoy1faD aues;t s2uoxo nu1om nmiesatfsDuax  ;o1opx mfeiydfm ua( p t4areoirctotfatraivsls)s2xriopiu4al  lnet (fsDumumono4tee mfeiydfa raumsnt)tlerir iydlateaieslt sexr(m iy4aptnlncilt arrmu  ot4tpt miciyd mDrlu p (4 exomo iotom rlnei;( tetmxo no4optemfcsl()aDrrxroot1tptnmf3tas a2umums t4 leomf tytlp elnes;()s2um(r3nu1al n nct ( aDrmxroot4tptoioeiytfaDulnvs t0aetnio tadfat  ues ()s2xoio3iy1om  mnes ( arum( oou4optomoeildlm2rauvpnu4 exoxo3ty1faD lnes;t0sexo(r3iu1aleelici (  rrmur ot0alenmf3tlsls2ulu p;t0aetrxo iydfpteln s t0t2xmxmpoy4lmen ieil( arua(rpoo1oex moetytfaDeanmsnu0texnxf3oatoa  ai s;() 2uoxo iy4lm  liei sfaruau p;u1aexnif3iatlm ulnmp ()arenmr iodlmD li o t)t2xoir nodaleelfeslsfsDra(root1opxnmfeildlm em(ms;(0aeenif tadfp e i s t) etmxr nodamenlnvt sfs2ur(m oo4aexomf3iad aDrm( p;t) reoxf3oy1fp rli ilt)trtr(r3nydam e fvsa()a2trxrp;t4tetnmoeiaslm2emnvsn(0arenmo ootoat  nvo;s0 2xrxo nudoltnmnct s sDurx o;t1ope ifciatfs2em( s (0tlerif3ia1op  lu s (0sexrir nodlpen nctls) Dra(m no0tpeoifetad s2eauvont0trtnxoctytopDeanvi;t  exrim iy1om nlfetlt) Duaump;t1oexomoeiadfs2rmnmp t) etnmf ia1laD anvs;s0s2tmim3ny1ll  lnvt t) Drm(monu1ole miciadla umuvo u)altrxo ty1oateaivs;t)t2ur(m oy1op n fcilt sDta( ooo4olxoiiciyt s2umnvp u4 lerxocio1lmt ai slt teurim3nu4ll emnctl( artru ono0apxnmfeilt s ea(mp u)artrio3tydfmDeauei t)trum(m nudlleelicil(fsDraxrp;o4apx  ociadfs uln s;t4aetnxrcoadfm raieilt0trtrxm no1om e ivsls arra(  ;u4ale mi3iysla ua( sn(4 renxf to1fatr ieo (  exm(o3iy1lmtn fvias arurxr ou4ale ioeiatlm um( p;(4 lerif oodoat luvslt0 exoimpiu1amen neiat)aruax  nt0tpxoio3iad mDuanvp u4tetnio3tadfptrlneo t)s2xmio3iydome lnetlt) 2ra(r no0optn i3ias mDrauvsn(0trtomfciy1omt luvsl(  rtoxr io4amenmfci (fs2rr(r ;u1tlt  i3ilt a2el( o t4trenmo ty1lm rluvo s) exrxr3oy1ole mfvil( a2raxr ;t0alxomoctytlm2umnvs ()altrio tadfmtraieo s0tetr(mpiy1ale lfesl()artau  ;o4tpxo f3iyslaDum(mon(0altoxr oatoatraies t0 exoxmpoo4lmt mnciat a2rmur no1apxniociydfm elnms u4arxnmo3oo1oaDrlies;t tetoxo3iydalt mfcta( s2ra( p;o4texomo3iatlaDrl(mpnu) exoifcoatfm  lnvilt0s2tmimpio1lle lnctls sruax pno1oetn ociyd s rln s t4 lxrio3oy1laDrlu s (  rxr(m3no1olt  fesas s2tru  no1aet if3tat s eanvp u4 leomo3tytlpt lnvslt0srtoxm3ny1llt mfes t  Dtmurpnu0apx  fciasfmDraumsn()tlerio ootlmDran il(  2tmim ou4oltnlieiat)sDra(  ;t1opx  octytfmDemnmpnt0texomr3tatlpDelu i;s0 2xmirpnu4llt livtatf rtm(root0tlx ii3iat s ua(vp u) ltrxrciatfmteanvsls seurio iy1open ictls)sDurx  ;o4tpxo feiasla eaumsnu4 renio iy1oa ranvi;()t2umiopnydlltelnes t) Dumu  nu0opeo o3iysla uanvo;t0teermr ia1lp rluei;( setrir3iu4olte nci tf rumxm no1aleo octat s2emu o t)alxnmoctatfat aivolt)srtmxmpoo4lp nmivs s  2urxr nt1optn o3tas a rm(vp t0tetoiociytlatelnvslt srtmim3ou4ale lfei (fsDrmumpnt0teto ieiatfm rmn s t0 etnmrctytfmD lnvi t sexr(o iy1lltnmfet t)aruru pnt0altnioeiasfa2ra(vpnu)texrxocty1lpt aivs;t)s2xm(r nu4apee nvia(f 2tm(mo;o1aexn i3iaslmDua( s;t0 lxrmf3ta1lmtraieilt)teum(r oodlptn fvtltfaDua(m nt0oet mf3iyd a2ulumo;(0 etriocta1lmt  nvs;s)texm(m3iy1lp nlicsltfa2uru oou0oeto ieils mDrl(vsnu0tltnmf iadfpDeauvilt0 rtrir iudlmte ncsatfs2taxmpnt1tlt  ocilt m ul(vp (4trenxoctatom ranvils seuoirpny4lmeeliciasfa2tau  ;t4olenmfcildfa eauvp (4teeomf tatomDr nvils  eto(r3io4amtemicilt sDtaxm nu4olx  o3iad mDraumpn(4tetriocto1fpD  neo t)seumxrpoo1ap emfvta( sDua( o;t0texnmieiysla rln p (4 lenmo tatlptrlu o;s0 rtoimpiy4lmeelncta( sDraur ;o0oet mfctysfm2umnvs (4 rtrxoctatfmtr ueol()s2xmxo iydlp n ncs t) 2ta(  ot1alt  oetldfs2ulu s;()trtnir oy1omDrlueo t0srurir iodol e ivt s  2tm(mont4aeto octytla raump u0areomo oodfaD aieols  eum(o no1amtnlnes sfa2urxmpnu0tleo iciadfm2ulnmon(0arxniocio1oaDelues ( t2uoxopio1amenlfet s aDumu  oo4alxn fetltlm2ulums (4treoio iadfa elivolt0s2uriopoy1oleemfeia()s2tru pnu1tpen i3tysfs2ra(ms u)artrmf3tatoate ueols setoir3oy4apenlnvsl( arta(  oo1oee  oeiyslaDrmnvp;u4aetnmo3iadfmDeau ilt  etmio3nydlp nmnvias  2ta(r nu0tlxo ietltfmDrl( snu) eeriocio1lmD anvo;(0tetmxm3iodoptelfesasfsDurumoou0tptn fciyslsDemu on(0trxrir io1omt anei;t s2xmxr ny4aptelnvtl(fs2uax onu4oeeomf3ild a2rm(msnu4tltrmo iodoatrauvol()srtoio oydop nlici s)a2tr( ont0oexo ociyt s2emnvo;u)texnxf oy1fa   uvi () etoimpiudop elivt t)s2um( oot1oetnmfeiatla ranmo t4altnir3ta1op  ai s;t0 2tmxm ou4lmt livs () 2trx  ot0oetomfctatfm2eanvo;(4alxoir tadfp eli s () exmimpnu1opeemicil()arur(ro;t0tltnmfeiadlm el( o (4teenmfcoodla e ieo t s2trirpiy4lptnmfvia(fs2uaum oo1oltoiieiad sDra(vsnu4 etrir3iy1fp raueol( tetrim ny4ll nmfvsl(  Dum(mp;t4oexoio3tat m ua(vo u)trtrmfcoa1fm elnei;t trurxmpnydlltnmictl( aDtmxront1opeomfcils s eanvp u0tetrmfcoytoa elneils)trum(o3iudaptnlnviasfs2rr( ont4ope  oetydlmDumn o () renmo iy1oaDr n olt)srxm(m3ny1lp   nvta() rrmum nu0ape  i3iat a ean s;(0treoxo iatlptr n sls) etm(o3ny4optn ietatfsDrmx poo0alt mfciyd a em(mp u4 reomr iydopte n olt)t2toxm3nu4al emfci (fs2tau  ;u0tleniiciad s2uauvont4aexoircoatla eauvs;t0 rxr(o oydal nmfvsl(fsrrmx pot1optniietltlaDeanmon() exoxr ia1fp rluvol() etmxr ny1apte icsl( sDurum no4teeoio3tyt sDelumo;(0 ltnxr3oydlm elnvs (0 rumxm nodllt mivta(f rur(ro;t0ole mociasfs2ul(vsnt0 ltnmr3io1lp e uei;(0teuo(r3iudopeemnes t  2rmxr no4tpt iietatlsDul(ms;()tleoirctodfpte u sls)srtoxo oy1optnlfvilt)s2rmu p;t0oex  ocildla rlnvp;(0teenmo3oo1fpDrau o (0 rurio3iu1ol nmncia() rumurooo1tetn o3iat m2emu pn(0tlxnir3oatoa  lnes;s)trur(rpio1ll  lnet s sDum(  nt0opx io3ilslm2ulumsnt0trtnmfcoadlmte ies (0 2tr(r3ou4llte nvtltf Drrxm ou0aet mo3iatlsDumnvon(4teerif ta1fpDraueil()seumio3oy4lltnlnci tfsDrax o;o0opx  octlt aDrlnvo;(4artrmo tydopD ln ilt)setrio oudalen icsas s2ua( o;o0tee iietlsfs2em(vp () exrmoctytfa   ivils0truoxopiudlltn ncs tf Drau p;t1oeeo fciad aDeanvonu0 leoxr3oadoptean sl(  exmir3iu4opt liet s)aDtmuro;o4oee ii3ildls2elnvp t) lerif oytopDrlies t)trur(m ny1alt mnciat srtr( pnu4apen o3tytlm umuvp;t0trxniocty1omt lnvs;(0 rtrim ou4amenmnetl(  rtmurp;u4opxnmictyslaDeauvo;(0alxoirciatfm  luvi s) 2xr(rpou1am n nvsas)arraxr nu0opxnio3tadls2rlu o;()alenio tydlatrlnvs;t  etrim3ou1ol  lnvsasfs2uaxrono1tlenmf3iydlm rmnvp t0tlenif3io1lmDe neslt)t2xr(o3ny1lm emncilt a2urur nu4tpxoif3tas mDemump u)tleoio oydla rlu o;s trxmiopoudaptemics s aDrm(mpou0oeeomiciydfmDulums () ltoxocoadfm e nvo;(0s2toio3iu4ame  fetas a2tax o;t4opxnmi3iat m umu s t0 rtrir iotfpt  n ilt0 rum(m iydoltelietlt)sDtmur oo1apxn i3ias m em( p t0 rtnxo ootoa e uvo s)trtoim nodapen iesa(f 2umur ou4tpx  oeilslmDuau p t0texrir oatlpDeluesl()texmxr iydlm e ivias s2rmurpnt4tlenmfeiat s2umu o ()trtomo3tadlp   nes ( texm(m3oudop  lfvil() Dtaxr ot1opeo i3ilsls2elu p t0 leoxr iotfp   nvi;t)t2urxm io1opt lnctasf Drmumpou0aetn oeils a rlnvs u4alxoircoo1latelnes (  rxr(rpiy4ope  fvs s) rtaurpoo4oexoiieiyd s uanmp;t4 eeoio3totfa e ieslt) euoiopio4lptn nci tf Dtaxr ot0tpe iieiysfa rauvp;t)trtoiocto1opt ln i;()trxoxopno4lptn fvilsf rtmxmpnt1opxo i3iadlaDrlnmo t0arxnmoctodfaDrli o t tetrxo3ny1op n ivsas  rtru  ;t0openiociytfs rluvsnu0tlxnxo iadomtelu o;s)s2toxo no1ol  miviltf rtrxr ;t1aptn fcild a ulnvont4tetoxr oadfmDelnvol()teto(o3nu4lmee ivia( a2ta(mp;u4opx  f3tltfa2elnmp u4 rermr oa1lp  lneo (  2to(rpiodome  nct tfaDrr(mp;o0tlto i3iydlm el(ms;t)alxnmfcoa1opDranei;s setoim3iydlmtnlfct (fs2uaumpoo1tpt ioeildla ulu pnt0aexrircoydfpDrli s;()s2umxo3iydlpt lfeias  rrmx pot4apx mf3ils aDuau ont4 exrmo3oy1opDrlneol()teurio no4oltnlfvtlt) 2tmxrooo0tpxnmociltfaDrl( snt)tetrir3iatfa eaueol( s2trir3nodol nmfvsasfsDtmxr ;u4alt ii3iytlmDrlnvonu0 rtnxociotopteau il( s2uoxo3ny4llt  fvtls  ruru  ;u1teeomoeilt m el(mo u0 lxnio3oatlm raivi;(0 etm(rpoy1oltelfct (farum(m oo4tex  i3ild mDrau o;t)artriocoadlpDr uei s)texo(m3iu1lptelnvi s s2urxmpot0openiocildls emuvs u)trxrmr3iodlateau o s srxmxrpoo4olt mfcias srur(r ;t1tpxomietltla2rl( snt4texoxo3tadoat  nes;()s2xrim nodopte ncs ()srum(mpno1teenioeiydfs2umu o () lxrmr ty1fm ran sls tetm(o3nudaltn feslsfa2trurpnu1ape mfeiad s emn o;t0trtrxociytfmt auvs ( trxmxr3io4omt lfes tf 2urxmpno1oeto fciytla2ul(vo;u) eenmr iodfpD  n il(0s2trir3iydam  miei s artru pot4opxnifciad m ranmo u0alxomf3tadopDelues s  2tm(o iy1al nlfvi t aDrrx o;u4openmfeiatla ra( ont) exoxfcoo1oat  nei ()setrir3iy4aleelnci s srraxrpoo4tpeo oeilt m2elnvs;u4texrio oadomte i slt  eurxr3iy4altnmneta( srrmxrpno1opeoioeiysfsDranvo () etomfcoydla e neilt0texmiopiudapt  icilt aDumx  ;u0oltn octasfa2ra(mo;t4aeermo3iotlmtr ivo s)sexrxopiydam  mncsa( a2ua(m ;o4apt  ieiasls rauvs u)trermo3io1laDr n s t t2toxm3nu1lmenmfct s sDra(mo;o1teeo feiaslaDrm(mont0tetrioctydlpte n s;t) ruoir nydal nlfvi s sDtaxmono1aet miciatfa2ulnvsnu)aetnifcto1opD  n olt  ruoxrpiodamenlnci sf Dua( oot1oexniieiytfs elnmpn(4 etnxrciydlatrlies;t)teum(rpoodopenmfctas s2trxr ou0tle mi3iyt s ul(vo;(4trtomocto1lpte i o;() exoxm3iodll e fctatfaDtmxm nu0tpenmf3iytfa ul(vp ()trenmf3iy1lmt  uei s0 rxrxm iodomt micta(faDtm(rp;t1aee iocilsfsDra( s t0alenmo3tatfa  aieo s  euoxr3nudomtnmfcils a2rr(m ou1aexomoetatls2umumpnu)arxnmrcio1lmDeai o;t)setrio3oo1lpenlnetlt  Duau pnu0tpe mieias aDua( snt0 lenmoctatomt livo;t  rto(mpou1lp nmfvt sf rum( o;o1ope ioetltfm rlump;t4alxoxf3iytomt  nvs (0trxo(m no4om  liciasfa2ra(rpnt1altnmoeiyd aDeaumo;(4arxrxr io1lpt auei;(0t2xo(rpou1oltn icsl( a2rmxm oo0aetn o3iat a ulu p;() etrio oadopt ai i;s seuoiopoy4lp n fctat  2urur ot0tlxnif3tytfs2rmu p u4treoxrcto1op  ln olt0s2uoxo ny4openmfvsl( a2umx p;u4teto o3iydfs2rm(vp t)texoir tydlmtrlieslt0sruoxmpoudlme lfci tfaDua( pnu4opx moeiysls2ua(vo (4aexrmrciydomD lu o;s)s2xrxopiodlptnliesa()a2uax  ;o1tetomf3tatlm2uanmsnt4tetnmf3oodoaD luvs (0t2xmxr3iodole lfctasf rtax pnu1oetnmf3iaslm2eluvo u)trtrio oy1fpDeai i t) 2umxmpoodameelnvia(f rtrxrpoo1alenif3tad s2eanvsnu4texnir tatopDean s t)tetoxopny4omte ncs ()a2urxr ;o1opx mf3ildls2emnmp u)tetrxo3iytfpt anvs s texr(r3iudllenlfct t)arra( ont0apx mi3iysfaDem(ms (4tltnxo3tadoa r i olt0s2xoxm3oo1lm n fcsa()srua(mo;u0apto ieiyt sDuaumsnt0 ltoir3iatlm e i o s) eurir3oo1lpte neiasfa2umxrpno1teto ietlslm rmuvsn() eeoxfciytfp  lnei;( truoim ny1lleemnctas aDraumoot1aeeoiiciad m uaumonu0 etoiociytlaDeln s (0 rxrxrpoudap   fciasfarrm(ronu1tetnmociysfm2elump ()trxnxo iatlm rln o;(0 rtm(r3nu1llt lnei s sDrru  nu0tee if3iadlm2raumo;()aleomociadlpte i o;t s2umxr oudlle micil( s2ua(ro;u0olto ieiat sDuanmon() etnxo3oodlp  lnvi;t)tetrxm ou1lltnlncilsfaDraur ;t1aptn i3iyd aDemnmo;t)teenif iadfmt  nvi;( sexo(opoydlmtelfctltf Dtax o;u0aee iociyt s umnvo;t0tltrxrctytoa eau ils) 2uo(opiy4lm   fci ( sDta(m ;u4aex  i3tytfa2uaums;u0alenir oa1la e uvols) ruoxo3nudal  mfcs ()a2ta( pou1oex  ietyt aDuauvo;t)alxrmr oo1fpD anes;s0s2xoxr oydome miviat)s2taurp;u1aet mi3tydlmDuluvp ()trtomo3ta1lp   u ol()t2toio3no1omeelivsat  Dur(m ;o0olxn i3tyt a um(msn(0tltrxr3iotop raivolt0t2xoirpiy4op e nei (fsrtmu  ;u4ope mo3tat a rl(mp u4 rxoxo3to1opt livsl( texr(mpno4lmt mfvta( srurx o;t1alxnmo3tytlm uauvo (0 eenifciy1fmt luvi s srxmirpiu4am   fetat srua(roou0aetomieildfmDem( snt)trtoir oatlaD  neo ( srumio3nudopt  ietltfs2uaumpoo1tpeomfcild s2uau onu0tlxrif to1la r uvols  2xoxr iy1lmtnmics tf rrrur nt0oeenmfeiasfs emumsnt)tltrxf3tatoaD  uvsl() exr(r3iu4al   neslt s2um( o;u0tptoio3ias mDea(vsnt4 rxnir iadfmtr u o t trtm(rpnodamt mfcslt s2taxmpnt1aexomi3iltlaDrau o;u4 lxomocoa1om rln sl( s2to(opnodome  iesltf 2taump;u0alt  o3iydfa eaumo t)tlerxo iotoptelivslt)t2umxr3iy1ape lieta(fsDumum nt0opx mietydfs2uan pn()artnmociytfm rlieo;(0trtm(m3ny4opt lncs s)a2rm( ono1tetn fetyt s2um(mp u4 eenxf3iydfaD luvi;()t2xmxm3oo1om  mnci sfa2ua( o;t0optn oetyt mDelu o;u0arerxfciydomt lneils0teurim no1al   nvsat)a2rm(r nt1tptniocias m el(vo u4 leomo ootom rlnvi s0t2tr(o ny1lp  livtatf 2tm(rpnu4alen fctat mDrmn sn()tlxnxf3ty1oa r ueolt0srtm(opoy1al   nvt s  2raxro;u0oexn ietlt a umnms (4 rxoxr oodfaDe n s;t0setmxo oo4amt lnctat s2rmu  ou0opeoifeildfs rauvo;u)trxrir3iytfpDelu i s seuriopiodaltn ivtas  2rrum ;t4oetnmfeiltfa rmn snt) ltrio iodfat lu i;t sexm(m ny4ale mnctl( a2rmx p;u0tpt mfctat a uau pnu4trtrio3oy1laDeln sl()s2trxo iodaptnmfcsa()sDrmuroot4tee io3tlsfm el(mpnu4 lxoxocoatlmt au sl(0 rurim no4lp  lfes (  Dtr(r ot1optnifciad m2uauvp u)tleomfctodom r i s (0texmiopoo1omte ivsas  2tauronu0olxnmf3iltls eln s (4 eeoxfcoo1om  an o t t2tmir3io1ol emfvi (farraxmo;u4openiietysls2em(vs;t0 exnmr3tadop e ieo;()seuoiopnodlptn ietat)srrmx  nt4tet micild mDuan snt0 reoircia1oa ranvi (0 etoio iudalt mfcsasf Duaurono0tetn fciat s2ra( onu)tlxoio3tytlmtranvilt) exmxmpiodoptnlfvt tfsrtaurpnu0oexnmfcild a2um( sn()aexnxo3iydoaDr ivo (0teumim3ou4apeelietl()s2taxrpnt0tlen f3tltfm2eanvp t0artomf iotop raieo;t0 2um(r3iu4omenmnct ()sDtmx  ;u4apt  fciydlmDumuvs;t) ltrir3iytla e ies;()texmxo io1open ict sf rra(rpou4olxomociat m2ulump t)altnxo iodfmDe ieo (0 2trir3iu1ale mies s)artrxr nu4oexomfctadfa2rlu snu0arxoio tadfaDr ivilt) etoxm ou4am e ivsat s2rr(m ;t0ale ifctaslm rmu s;t)tlenirciydlm eli o s) euoir iu1ll   nctlt)sDtmu  oo1oetoifctlsfs2ea(vo;t4texrio iytoptelneo;s) eum(o ou4oltnmietl(fsDum(roou0optnmoeiltlsDeln s t4trtomo3iatop rlnvsl()srxoio ny4al emivtlt a2tm(  ;o1optoii3iltfsDel(vp;(0aetnmf iadlpDeaivs;s0texrxo3oy4lpte netlt s2rmu  nu1alt  fetad s2umuvon()tltnxrciadlaDeai i t0 etr(opnudlpt mnes tfaDrmxrp;u1tptomf3ilt aDea( o;u0trxomociatlmtrlu ol( sexr(m oydam  liesas)aDtrx  ;o1tlxo feild m2emuvs t)tltnxocty1fm raueslt s2xoxmpnydol e feil(f rrmumoou0tpxomoctlt sDua( p;t4 eerxrcoadoaD  uvi;( srtoim no4amtn feta()artruro;o1aeen ieiltlm2ul(mp t)tltnio totfmDe ivi t) etrxm nydlmteliesat)aDrau pno1tpeoiociltfs2umn snu0alerifcoa1fpt aiei;s seto(o3nu1am e ncilt)artax  no4opeo ocilt a umu o u0trxnmr ootlp   i olt0 etrim iudlmt  nctasf 2ta(mpoo0ape mfeiytlaDrl( snt)texnircta1fp  auei;s)sexr(r3io1al elfctas aDtrxr ou0optnmo3iyd mDeauvo t4trermf tadlm eau ol()trxm(m3oydope mfvi sf Dumx ono1tetnmieiat aDeanmp (4trtoio iy1lp ranvs ()srtm(r3oy1lptelnctlt) 2uaum ;o4tetn ieiys a uanvo (4 exnifcoydlm e ivsl(0 eur(o3iodal   fcslt arrrx p;o0aexnmicilt s rau s ()tlxrifcootomD  nesls)tetoxm oy4al emietl(  Drm(m ;o4alxo i3iydfs2ul(vsnt4altomr todlaDr nesls)trtmxo3iodlm e fvsas)artau  ;o4olenio3iys m rlnvsnu0aexrif to1opDe n s;(0 2xrxmpoudope lnvsa(farta(  ;o0altn fcias a ua( pnt)artoxrcta1fateau o;t) 2to(r iydapte icsas sDur(m oo4teenif3iat s2uan s;u) rxrif oo1fpDr ies (  2xr(m3no4ameemnctatf 2tr( ono0tpeniieiysfa2el(vo t4 rxoif3to1fpte nvi t trxo(m nudoltelictl( arurumont1altnmietldlm2eaums (4 leoxoctydop rlu i () eur(opnu1alt lfetl()sDraurono1oeto iciatfm ra(mo;(0 lxniocto1fpt  ieslt0 rurir3nodlpte ieiltfs2taumpoo0tptnmi3tltfaDeauvonu)altnxoctatfa raueil()s2ur(r ny4am  mfcsatfartmxr no0tpe ifeiltlm2ua( o;t4arxoxf3totfp e uei;s  ruoxr ou4amte feil() 2um( o;t4tpenmoetydfaDulnvo u)aexnxo3iadop e ivo;s setmxopiodlltn ivsltf 2rrxront4opeoifetyt a2rm(ms;(4tltrmoctydopD an olt)trxr(m nudam emfcsl( sDtmxmp;u1tetoii3tadlm2uan pnu0 exnxr3oatlp raieol(0s2umxm3oodame  ivi s a2tmxm no1altomi3ils s2umnmp u4texoif3oy1fp  auvs s0seum(r3io1llte ies s) 2uaxmp;o0tlxniieiys a2raumo;u) lenio3tatlp  aies () 2xoxo3nodalen fei ( a2uaxm ou4opxo i3tyt s elnvo;u0altoxo io1fm eai slt0 2tm(r nu1lp n fct sfarua(rp;u1openmi3iys aDra( p (0aeenxr io1lp  lu s;t0seurimpoo1ll emfeils) 2rm(root4oltn icias a2rmuvo;u)tltnmfciotfa rli i;( t2xrim oo1lp elnes tfarua(m nu0tex iieiydlsDulu s u4 lxomr3ta1laDe uvsls teumxo oodapenlfei t s2taum ot0oeen ieiad s ulnvp;()tlerio to1late n sls srurxrpny4lmtnmfctltfsrraurpno1tlenmfciasla2eluvsnt4aeeoxociotlaD au i;( tetm(r3iydapenlivil( s2rmxmoot4ope ioeiat s el( o;t0aeenio3iytfp rlnvilt)t2toiopou1lp nlicia(  2umx pnu1olxnio3iys m2uluvo t)aeerirctytla   iei t) etoio3oydolt lietl() Dtmurpot4opto i3tyt s2raumpn()tetoxf iadla  luei;t0trxoim iydop nmicsa(fs2ur(r ;o0tptoiieiatfm2umnvs;u0 lxnmo3io1laDelueo;s t2xr(rpnudol  mncils arrmxm ;u4ole  f3tyslaDumuvs ()aetomrctotlp eai s ( srxmxo oydal nlfvilt)aDurxm oo1ale iicild m2rm(mp;u)trxnif3todfm rlivs;s s2xm(r ou4oltelieta()sruru ooo1aexnifeiytlmDrmu p;u0 rtoxo3to1fm ran o ()seumxrpoy4om nlnvsa(  Durur oo1oetn ocildla ua(mo t)trtoxf3totop eau o s0 2xoir3oo1omtelici tfs2tmx o;u1oeeomocildfa2uanms;t)tetoxo3oatlaD livo s0 etm(m3oo4lm n nct ()aDrrxr ;o4olt moeiydfm2elnvon(0altrioctytfpDraieols)t2tmim oy4am e fci tf 2ua(r ;u4tpeomf3iat m2uan o;t)tleoxf3ootoatranvils0sruoxo nu1am  mneil()s2umx o;u0open o3ilt m eln s;(4 rtnmo3oodfmt aies ()trurirpou4altnmivs s)a2ta(mono1aeenii3iatls umnvp;u4 eenxo3todlmt auei;t t2to(m3oo4al nmfetlt)s2tr(mpnt1opx  feiatlaDulnmont)tltriocio1lmteaneolt)srur(opou4apenmictas sDrm(rp;u1apxo ietysfsDrm(msn() leomo3oydfpDeaies (0trxrxrpoo1aptnmfeilsfaDrr( o;o0opxniieilslaDumumpn(0arerxo3ty1fpDe ies;t0 etm(rpiydam nlfcils)aDtm( pnu0tleniociltfm2umuvo u4trxrmr iydlaDraies s) ruoxr no1ll  lneias a2rmu p;t4aexnioeias m rl(vpnt0trenif iatlm r u ilt  2xo(mpny4amt lfvs (faDra(  ;u4ale iieiltla rm(mp;(0texrmf iotfpD li i;( srxmxr nydlpenlnvias)a2ta(ro;u1tptnmiciydlmDeanmp;(0tetoxr io1fmteaivs;()t2tm(rpnu1lme licsat)a2uru  ;u4oeeoii3ilslsDel(vo (0 rtoif3totom  livsl()s2xo(opio1optemfei ()a2tr(r oo4tleoioeilslm uan on(0 renmo3oodfpDr uvilt)srxo(o3iudame livtlt  rrmx  nt1apt iociad s2el(ms;(0trxoxr3io1fmt  i sl()trurir3oodamee ncsl( aDrrumpoo4aee mieilt m uauvs;u4 eerxociatfpte neilt trxoxm3iodlpe lfet (f 2uau pnu1tlt ii3tlt a ra(mo ()trenif3ia1oat an s;s0 ruo(r3iy1ll e iesa( s2rm(r nu1aetnioetad m umuvsnt)aetrir3ty1om rli ol( srxoxm iudam elnetls)aDrm(mpno4tleoiiciysfsDuln p;(0tlxrirciatoateai o ()seur(r io1lpen ivsas) 2rmu p;o0aeen ocildlaDranvpnt) renmr ta1fa rlieo s0trtrio3iydole  fesl() Dta( ooo4ope ifciltlsDea( o t0tlxnmf oodomt liei;s trxoxr oodameelnvslt)srtrumont1opeoif3tld m el(msn(4tlermo totlpte n o t0srum(o oy1ape mfvia()a2tm( ont0tee mfciydla em(ms;t4aexnxr3ootlpDrli s;s0trtoir oo4apenmnci s) rtaumo;t4oeeoioctltfmDumuvs;t) exoxf iodopDe ivi;s  2xrimpny4lme mfvil( sDuaur nu4opxomieiad mDemumsnt4 rtomf oo1lmtrluvols0srxr(o ou4omenmnesa(fsrum(r no4apt  o3ilsfs2emnvsnt0arerifcoy1opDran il(0trtrxr iudaptnlfvta()a2ua( onu1tetnmfetys a2eauvs ()aleoxr3oatopDran o s  2tr(m nu1ap  lfeias sDtrumoou0optomo3iyd sDrmuvpn(4tlxoxo3oo1lm ranei;(0trtr(r nodlmtnlnvtl() 2taxro;o4oltn oetas m rmuvp (4tlxoircoy1lpD  i sl(  rxm(rpnu1lm nmfei tfsrtru ono1opto octys s2rln o;t)tltrif oo1fm  auvs t s2uo(o3io1lleelfeiasf 2trxrpoo0aee ifetld a2eluvs u) lxoio3iadla rlu i;t trxr(opio4ale micilsfs2uau p;u4aeenmfetytls2eau p;() exrxf3totoatran ols) etoxr nudom nlfvi t arrr(  nu4alxnmfeiytfm2umu o;u)tlerxo iotla r u o s0 rxmxm3oodamtn iei s) rta(ront4opxo feiytla uluvp;(0arenxo oo1fpD auvi;(  2toxmpnudal  lfvtatfs2rmum ;t0tle iieiysfm2eanvo;() eenmr3oadlmtrai slt0t2urim ny4omt  ictls srtrxm nu0aeeoioeild s2umu s;u0 lermr3iodlatrlneilt0s2xr(rpiydom n ics t s2uaxmpoo1tpxn fciatfa2ulumsn() lenifctydomDe n il(0teurir nudoptnlfciat)s2rax p;t1oltnmfeiasfa2rmn s;(0trtrirctytfaDelivolt trtoio iu4lle  ics sfarumxmo;o4optomf3iltfmDea( p;(0 lerxfciy1fm rlnvo t)seurirpnodlltemncil() Dtrx  ot0tlxoiiciaslm2em(mo u4aexrxo3iodomD  u o;t sexrio iudap  mietls arrmxmpnt0teto oetlt s2emn p (4 eeoxr iadlaD aueilt  2urir3io4lptemnvilt) Dtrur ou0alenio3tytls2rluvo;u4tlenmoctydlpDe nei s0srxrim oudolt livi tf 2ta(mp;t4aleo i3tatfsDea(vs u4treoxf3oo1faDraueo;t)texr(rpoy1op emnciltfaDrmxmpou4teenioctltfa2ua( s t)aeerir3tytfa rli i;s  2uriopoodol  lici t)sDtru pnu4tlx mo3iysla eanmo u)texnmf totlat aiei;s0s2xrxrpnydlpe  fesl(f 2raxr ot0oleo iciadfs rm( sn(4aetrmr3iodlatrlivol() rtmio3iu1lpen ieias)srrr( p;o4tlt  i3iad mDel(vont0 rtnmfcoydfaD lnei s0teur(o ou1ll   ieilsf 2tmumono4tlxnifctytfa el(ms;u0trtnifctytfmtran slt srxrxmpno1ome  feias sDurum nt4oexo i3iys a2eau o t)tetnifciadoaDe nvs t 
\ No newline at end of file
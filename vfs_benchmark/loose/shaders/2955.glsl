@@ -0,0 +1 @@
+uvslt sexm(mpno1alt lfetl(  Dtm(moou1tlx ioctlsfa2elnmo t4arenxrcoytlmteanesl(  2xmimpnu4lmte iviasf Draurono4tlxnmfeiydfsDumnvpn(0 ltnif3tydfp rliei;s  2xrio3iy4amtnmfcia(f Drrxm oo0olx ioeilt a2rlnmsnt4 eenio3oadoa  aivs ( t2uo(r iudlp   ivt sf 2tmxmp;u1tetoii3tldlsDrmnmo u)trtnxf3tytfaDe i i s0texr(m3nudlmtnlivt () Dua(  ;t4aptomi3iytfmDra( pnt)aexoif3iydfpteau i;( sexmxr3iydlm  lfvsat a2tm(m ;t0texnifeias s2um(mo;u4alxrmocoydopDeaues t)srxo(o oy1opeelnct (f Dtr( ooo0teto ietatla2el( p t0 renxfciadop raivils0teurxmpnu1am nlfesas)aDuax  oo4alt mieiatls elnms;()tetnio tytoaD lnvs (0t2xrio nudap nlfct () 2umur ;o0alt  feiytfm ea(mp ()texrmr3iy1omt  ivs t0trxmxo3oo4lltnmfcslt)aDrrxm ou4alen oeiltfsDumn o;u4 lxrir todoaD  ies (0trxrxr3iu1ape mivt s) Durxrp;u0optoiictysls2eauvonu0aeeomocto1latranvslt)tetoxm ny1omee ncsatf 2tm(rpou1opeo i3ild a elnmp;t0tltoxo oytlmtrau ils srto(r ny4aptnmncsa(f 2ur(mpnu4tltnmi3iatfa ua(msnt) lerxr ia1late uvo;(  exoxo ny4alt mnct (  2rrur ;o0optnifetyslm2um( s;u4tlxnxo tadop eanvol( setmxr oy4apt lfci tfsrtrurpno0tetn i3tytfs2ra(mp;u0artomrctadfpD au sls0s2um(m ou4lmenmncsas a2tm(m ou1tpx io3tlsla umnmpnu) reoiociytomDraivi s seum(o oo1altnlnes t sDurumont4oleoifeiltfmDuan pnu0tlxnifcoytlat luvs s setmir3oydopeelfvsl(f Dtaxmpno1alxn fciytlmDumnms;(4tlxrio tatom r ies;t0 euo(r3ou1aptnlfcslt  rra(m no4tetnmi3iadls uau p u4altrxr3tydlptr u ilt s2umxo3nydlpe mncs sf 2ta(mp;o0apto oetat mDean pn(0tlerxrciy1opt ln o t seumirpio4oltnmicil()sDrmxm ;o1apxn feiat s rmumont0arenmo iy1lpDrli s;( seuoio3oy4apen fvsl(  rra( poo4aleomfciatlm eanvp u)texrmr oytfm e ivslt0 exmir3no1llen fetlt)arrmu  ;t4aleoioctyt m2ul(mpn(0tetnio ta1omteai o s)teuoxm3io1openmnvtas)artmum ;u1oet  fcildfa2ulnvpnt) exrxoctydfm e ivils0trtr(rpiy4lpeemncslt a2uax  no0ale  o3iytls2uln pnt)tltomocootopt  uvs s)t2xr(mpnudllt lfviltfaDua(mont0olxnmi3tys a umu ont)aeeoif oodom  au s;s0trum(mpoydllee fciltfa2rmuront1tee mictad m ua( snt4aeermo to1lpD auei t)srtmxm oy4om   fct tfaDraxm ou4oeeomictltfm2eln pnt0tltnir io1op raneslt  exm(o nydolenmiesls) 2rmurp;o1tpenmo3ilt s2umn p;u4tltnirciydfa  ln i;()t2triopio1om n fesl(f 2rr( p;u4alxniiciasfa rau p t4aeerio oa1fa  luvsl()s2tr(r oo4ope mieslt s2ua(r nu1opx  i3tytfs emump t4 etnxf oytfateai i;() 2um(m ny4optelietlsfaDrruront1aee ioetasfs2rm(vs;(0artnio iy1fm ran i;()texoim3iodop   ncia() Drr( onu0tlt mi3ias aDra(msnu4artnxfcoydla   ies ( s2trxmpny4ap e net t)sDtaurpot1oetnmfetlsls emu o;t0arenmociy1lmtr u ol( s2trir iy1ol e ictlt  rtruronu4tpeomociadla2rm(mp;u4tlenmf todfmtrlieo ()srxmxm3ou1olen iciatfaDtaumonu0tpeniicildfs2uluvpnu0altnif3iotlp ranei;s) rxrxo io4altnmfctls aDtaxmpnu1tpxoioetysfmDeluvs;u0arxnmrcoodfa   iei ()sexm(o3io1aptn fviltfaDumu p;t1tpx  ietatls2um(mo u)aexnif3oydfpD liesl(0sexrxr oo4llenlnctlsfs2tmxm ;u4alxn fctyt sDra(vsnt0trtoxo ty1lpDe neils) 2toirpno4alt mfvi t)sDtm(mpnt1aeto ieiyslm ean p u)trtoir to1oaDr u i;s texo(o3io4ol  micsls s2rrxmont0ale mi3iltls umumsnt4 rxrmfcoodlpD lnvo t) etoim ny4optemnvsa( arra(  nt1olt iictld sDumumont) lenmo oydlatraneo s)s2tm(m3ou4alte icia(f rrrxr oo0tlen f3tytla2ulnvs u)trtrio ia1opDeauvo s  etm(r ny4opeemfvi s) rrax  ;o4apx  fetas a ulnvsn() eenifcta1fa   uvi s t2xmirpny4open ietat)srtmuro;o0ole if3iys m raump;(0 rerifctotfat lueo;t  etmxm iu1lptnmnes s srra( ont0tetomi3iasfa2rmu snt4tlxomf3tadoa eaivi;t)sexoim iy1om   iesa(faDrr(r ot1ope  octad s um(vont4trtomf3iydom eln olt)texrxm3ny1omt  nvsa(fsrua( pou1oltnio3tyt mDel(ms;t0 renirciytopD ln s;( s2xmirpoy4altn fvs (farta(rp;t0aexo icilslsDeaumo t0tlxrmo3iydlmDeai ilt) 2xoxmpiudlmtnmietat) rtmxrpou4tetomfctldfs2rl( snu) rtniocootfpDr nei s0 2urxmpoodope  nct sf rurump;u0alxn ictatfm eanms ()trtnio3todlatrlivolt0srum(o iodoptnlfesa(  Dtaump;o1alenmoeiyt m2ulu s u0alxoir3iydoaDe uvsl(0seuo(o io1al  micia(f ruaxr ;t4tetn feilsfsDrlu p;(0aexoifcto1lm eauvi s)sexo(m3iudol n nct s a2rr( p;t0teeoiiciyt sDuaumon()tlxoxr iydlmte ivilt  2xmiopoudlmt lnet s sDrau ooo0tpxnii3iatlm2uau p;u)arxoxrctydoatrli o;(0teto(rpoudolte ncias) Duau pot4ale iieiltfa2rlu pnu4aeenio iytfmtrln ilt trum(m nydop emfcilt s2uru ont4oetnmoeilt m2rmump;u)alerxfcta1lmDe u i;t0teurir nu1opeelfcils)artrur nu4ope ifetyt m2rmnvpnt4 lxrif ootfa eau ilt0 rxrim oo4lltemnet s)a2ta(r ;t1aptomo3tydfsDra(vp u4 lermr oy1fptr iesl(0s2uo(opiu4lmtn nes sfa2tmxrp;o0opxoio3tad s2ua( ont)teenxf ia1lm eln o;s t2uo(rpny4op  lfet s)a2ur( o;o4tpxnioeiyslm um(ms;(4trxoifcoatoat li sl(0 eumxrpiu4lp nmiesatf Dta(  oo1altnmoctlt m ranmsn(4alermf3oy1fa   i s;( s2xrxr io1lm e fcsat) 2rmx  nu0oet mi3iatlmDeauvsnu0aetnircoo1omtrau s (  rtoxmpoo4lle mieilt a2tm(monu1opxn ieiad a2umnms u0arxrif3tydopt luvo;()sruoimpiu4om   icsatfarur( oot0ale ii3ilsfs2rm(vp t) eeoxo3iy1opDeauvi;s)srtrxrpiydomt  nes t aDtruroot4tlxo fciaslaDelnvs;(0 etomo tytom   iei;t0t2trirpnydopee ivtls aDraum oo4oeeoiieiadfs uanvo t)texrxo oatlm  an i t) rurir nudom n ics ( srur(mpno4opeo feiytfs2uaumsnu0alxrmr3oatlp  lu sl()s2toir no4lle liet s sDrmumo;t1oet miciad m2uau o t)teeoxrciatfateln s t0 rxmim3ny4lmen fes t  Drmx ont0tetomi3iltfs2um(vp;t)trxrmr iatfaD  neols)seuoio3no1ame lnvt ()aDrmump;t4oetoio3iat m umn pnt4tltnir3ootopD  ies;(0s2umxm3oy4oltn icslsf rta( pnt1alx ii3tyt a2rmuvpnu0tltrio3ty1fmDeaivi;(0 2toxo oy1omtnlicsat) 2trxr ;t1altomieildfm2rmump;t0arenmrciadfp e u ol( t2trio ou1openmfvi tf 2taum oo0tpeniiciadfm2eauvs (0treoiocto1op r u i;(0trur(r nu1ll emivt t aDrrump;o0alt ifcild m2ul(mo u0treomr3oatoaDe n slt0t2trio iy4ome lnvia()sruru p;t4aptnif3tltls umuvpnt)trtomr3iodfmt  ieo;t)s2uo(rpnu1lp n fct ( a2rrx  ou4tptnifeiytlsDrauvs u0altoxfcoodlatranvi t0seur(mpiudlptnlfvtat aDrmu pno1tlxn fciytfs2uaums t4teerio3oydomDraivo t0tetm(r3oydomen icsatfa2umumpot0alen fctlt s eln o;t4artoircoadfmD aneo;t)teuoim3iudlpt  nvtl(  rurxm nu1alx  o3tysfaDrl(vs;t0aetnmfcootfmDelues;(  eurio nu1open fci () 2umum ot1tpto ocilsfs2ra(vp t)trtoif totfa  lnvi ( trtoxopou1alen ies ()sDtmxrpou0oltniieiyd sDuan snu)trtoxfctadfmteln i t)srtmxopiy4lltelietatfarrm(mont4aex mi3tyt sDra(vonu) lxoxfctydlmDe ueo;(  2urxm3ny4apeemnetatf Dtrur nt1apxnmi3iysfs ul(vs;(4 exrmfcoatlpteli s;t) euoxmpno1ole lfvs tfaDtr(r no0olx  i3tatls umnvs;() rtnmoctotopD  uvo s0t2tmxr3oo1amen fet (  Drmur ;o1tpen icilt aDelu s;t4tetrifciatlaDeanvi;(0seurim3iydomt  ietlt a2ua(r ;u1tlxn i3ildla2ulnvp;()tetrio3tatoptrai o t teurxo3oodomtelnetls)aDrm( p;t1apenii3iadfm eanvp (4aetoxo iydlp elu s t srtoim oo1alee nesas) 2ur( oot0texo f3iadfsDul(ms;(0altnif3io1lpD lu o;t0t2xmxr io4apt mnvil(fs2rm( pot4apen ociasfa em( p (4 lxrif iytlatraneil()trtmirpnodam nmivtasf Dtaxm ot1aet mfeils mDum( p;u) rtrio3ta1fpDe u s;( seurxm3nu4omtemnci ( sDrm(mo;t0olxo oeiadlsDeanvon(0 rerxr ty1oatraueo;s trtr(r3io4om nlivsl(fa2umurpoo4oexnio3iydfa2umu pn(4arxnio iy1faDe u slt0seurxmpiodamenmfcsl( s2ta(r no1aleo ietaslsDum( sn(0aetnxo oodfp elivo;s  2xm(r iodlle mictl( a2tmumooo4opeomi3iysfs rauvs u) exrir oodfa e nvi s)t2xrio3iy1olen ivtasf rtmu oot0apeo o3iad s2ranvpnt0 lxnif totlate i i;t)srtrxo3nydomt  fcs sfsDtaum ou4apxoif3ildfa2ea( p;t4 lxomr ty1fpDraivs;( s2tm(r oudaleemict sfsrrax oot1tlto ietatla rauvonu4 ltrioctydlmDrlnvolt)t2toir3ny1lltemnei s) 2raumpoo4tetoiiciadlmDuluvpn(0artoir oatfpD auvi;()trxoxo3iu4apeelfcta(  2uaxmo;u1tpx  o3tyd a em(vo;()tleriocootomD anvi;s)trum(m iydll emicia(  rtru ono1alt ifeiysfa2rmuvs;u) eerir ty1lpDrli o s0 2xo(o nodolenmfesl(f Drru pnu4tpx iiciytlaDrl(vpnt)aeerxf tatlpDraueil(0t2tr(opny1amtnmivtls)a2rm(  no0aetnmfetysls emnvs (4teeoxf oydopt ai o (0seuoio io1lmtnlneslt aDuaxr nt1tlxn iciytfmDrlumo (4tleoioctodfate ies (0 2uoxm ny1olen fei (f Drmum no1openmoetytfa2ea(vsn(4alermrcoatomDeanei s  ruoxr3io1al nlnesltfs2uaurp;o4tpenii3tytlm ran s;t)alxnmrciatopteaiei;()srxoxo3ny1lpt  icta( arrrur nt4opt io3ilt m2emu s u4tetoxo iadlmte ies;s texm(o3io1ame mfctas) Drau ooo0opt  ieilsfmDrluvo;(4artomrcoatoate nei;t tetmxopoydome lfviat) 2uax  nt0apt  ictat a em(vp t)artnxrcoa1la r nvo;s)trxrxr nu4ap n fvt t)s2rm( o;t0texomo3iyd mDelump ()trxrirctotfm e neils)s2uoio3io4am nmivs t)s2umx poo4tleomiciadfaDemnmo t4tltomr oo1fmDe nvs t sexrxr iudlmtemiviat aDrrxm ;u1ope ii3iyd a rm(vpnt4 rermo3iy1lm r i o s) euo(o oydlpe lfvia(faDtaumoou1opeomfetltlmDemn snu0 rtnmfciatfmtrauvo;t) rumxr no1optn ici ()aDur(r nu4alxo i3tls a2emuvp;u0trerxf tatoaD ai s ( sexmim3iudolt  ictas) 2ra(r nu0optnii3iysfaDrl( ont) lxomrcoa1fp e ueo (0t2tmir iydlmtemivsls)a2umxmp;u0oleomietlsfs2ra(vp u4alxomf3oytfptr uvi;()tetmxo ny4omenlfetl(fs2rmx oot1aptoifetltfs2ua( o u0artoir ootlpte nes;t0sruoiopiy4oltnliesat) 2um( o;u1olxn ocildfsDel(vo t4aetoxr iydop raueslt teurxr3iydal  mneilt arua(  ;u4aexo oetydfmDua(vsnu4teerxo iadlpDeauvo;( s2trxmpnu4lleemivtat)aDrmxm ;o4opxn ieiadls eaumo t) eenmocoy1fptelueo;s) euoxo3iu4oleemfvil(f Dta( ono0aetnmoeiat m2ul( snu0artnmo to1lmD  ueils)trto(mpnudape  nei s) Drmurpnu1aetnmi3ias sDeanvsn(4alxomrctatla e ivs;( t2xrxmpno4omtelfeiltf rum(r oo1apx  octlt aDeluvsnu4artoifco
\ No newline at end of file
@@ -0,0 +1 @@
+uvols)t2xm(m iy1optnlietlt) Dra(mooo0opeoioeiysfm em(vs () exoxf3tydfat  ivo t)srtriopoodamt mict s a2uaxr ou1oeto feiadfaDrl(msnu4teeoif3ootom r uvi;t)t2xrxmpiydam  lncil(f 2tm( o;t4alxomicildfa2ra(mpnu0 lxnmo iydfmD aieo s0s2um(r oodole mfvtat srua(monu1tlxo oeildfa2el(mp u4teenio tatoaD anvi;s0s2xoio3io1ame lieilt)aDrr(mpno4oeeomieildfs umnvpnt0aeeoir iy1op rau sl()sexoxm iudlm n iesatfa2uru pot4aee mieiadfs2ua( s t0tltomf3iodfpteluei () 2xoxmpoo1amenmnetas)a2ururono0ale if3iys mDrmu p;(0trenio oo1fa elies;s) 2toxrpoydlp emnes ( s2urxmo;u4tex  fciyslm ean s ()teenir3totlpD luvs;()srtr(r3ny4oltemfeilt sDtrx o;u4apxnmieildla ulnmp t4trenio3to1la ranesl(0 exrxopio1lm elncia()aDtr(rpou1tetn i3tldls2ranvs ()aexrmf3oatfm  anei s)s2xmio3nudoleelfeia()arumuront1opxoiietls m rluvont0arxrxrcoatlm rauvol(0texmim3iudaptn icsatfs2rm( oou4opt mo3tas a uauvo;u4alxoif iydoaDeaueol( trumxm3oodaptnmfesl()srumuroot0olt ioetat mDelu on(4 rtomocta1lmtrlivo;(0 2xrio3oudllenmicslsf rum(mpnt1oetn ictat s2ul(mo t)tetnmr iotlaD lueo (0s2umxm3oy4al e nvta( sDtrxmpnu0aptnii3ild mDumnvsn() lxrif iotfp eaueols)tetoxrpiydopt mnci s)a2umxm ;t1teen ieiyd m ra(vs (0arxnio iydlp  ai o s0t2xo(m3no4ame  iei t)aDrmum ;o4aptnmi3iaslm2uanvsnt0trtnmf3iydoa  an s;t0t2urxmpoodameeliviat)a2rr(mpno1tlxo ietaslm2uln p;(0trxoir3iytlate uvsls0 2ur(rpnudlpeelncias arumumpou4tptn f3tltls rl(vsnu0 etrio3iodfpDr uvols0t2tmxopoudomeemfetat) 2rr(m ou1tee  ieiyd aDuau o;t)artoxocootfaD  u s;(0s2toxm3iy1lmt  ici (fsDrau pnu4opt  ictat a2uaums;t0 ltomf totopteaivs;t)setoxmpou4alt  fvil( sDrrur ;o4apto i3iys sDumn o t4 rxrmr tytoa e ivsls srxoxopio1optnmncils s2urxr oo4tleo ietysls2umuvpnt4tlenio ty1fa e nvo s t2xrimpoydapeelfvsat)sDururo;u4tpx ioeildfm2eluvon() rtnmo oytlmD  i olt)trtmxr nu4lmtn iei t a2umu  nu1tpt if3ildfa emn p u) rxrirctadomDrlnvols) 2xr(r3io1lm nmiet (fs2uax ono4tpx  ieiytfm uauvo (4tlxnxf3oadfmDeluesl()seumir oudalt lfeia()srraxm ot1tet mfciytfaDemnmo u4 rerir iytfaD au o ( trumiopnu1optnmnvsl(f ruru  oo4tpxnmfciydlm eln sn()aexomociadfm  lneo;s texr(r3oo1lm n neiatfsDua(ro;o4ole  ieildlaDelnvsn()tetoio3oytomDeaies (  rtrim oy1oltelncia( sDrauront4aet io3tadfsDuanvs u0 rxrxf oa1laDelnei;( trtr(m3ny1apt  ivsl()s2rrx p;u4altnmfciytfaDranvo u) eerxrctotoate nesls) eurim3ny4lp elnei t artrxroot0tetnioctysfm2rm(msnu0 lxnxfcoatfpDr uvsls  rtoxr oodllen fetls  rurxm ou4openmfciyd m2rmnmsnt0trtnifcoydfm elivi s teumim iudapen nvi s) Dtm(r ;o4ale ifeiltfm2ulu ont4trxoxo3iydoa  lieolt0 eto(mpiy4omeelicils srrmu  ot1olx  ieiatlm2ra(mp t0altnxr3oo1oateluvil(0seuo(rpiu4lp nlietas srtm(rp;t0aexo f3tld m2el( ont) reoxf3tytopDrai ils0t2umxr nu4lltemicsasfa2ur(mooo1alxo ociadfm2ean p;t4teerif3ia1omtr ueo;s t2ur(rpny4om  lnviat srtrur ou0opxniocild m rmumo t4trxrmr oodlm rlnvo t) rxmiopou4lptn nvtasfs2rru pnt1opxnmfeiadlm2eau pnu) lenio iytlateaieilt s2trxm iudoltnmivtas  Drax onu1alt  fcildlmDumu p;()tlerxr io1lm r ueo t0 2uo(r io1omee ietlsf Dumu poo4teeniiciadla2rl(vo;t4 leoxo oo1lp elivo (0s2xmxrpiu4alenmnvs tf 2tm(mo;o0apxnmi3tysfs ua( s;u) leoiociy1lmt  i ilt0 eur(o3ou4oltnlfcsa()aDur(mp;u4ape if3iyd m uanvsnu4alxnio3oytlp  lues;t)t2xmim iu4al emfcta()sruax oou4opx mfeiyd a2ranvo;(4 eeoxo totfm  ai i (0 exrir ou4ope  iviatfsrrmx pnt4optomi3iysfa2ua( o;u4 ltrxo tadopt  nvslt trxoio3oo4lme mfviat  2rruro;t0tpt  f3iatls2umumsn(4aexnifcoodlaDranes s0 euoimpiu1op  lneils  rurx ooo1aetnioetyd a ul( snu)artoiocia1fmtraivil(0tetrimpoy4lpenmneia(  2rrumo;o1olxnifeiltfm2rauvo;t0artoio3iatlmt  ieo ( trtrir3nydameemivs s)srtaxm nt0alt mi3ilt aDumnms t)arermrcio1oa raieilt0srtoir nudope lncilsf rurxmp;t0ale  oeiydfa2uau snt0artrmo3tytfmt au ol(0t2umir3nu1omtemnet sf 2ta(r ;t4aet moeiytfa el(vo;(4 rxoio3oa1laDe i ils0t2um(r3oodome lfes sf rtaxmp;u4opeomicils a emnvs;u4tlermrciy1lmDe ueil()seumxo3iy1al e neta( artm(mpot0ole ifciys s ua(vs;t4aetoir3oodla raueil(0trxrxm iy4am emfvta(faDrmxm no0alenmoeiadfm2uanvs;(0aexrio3tytomD  nei s  ruoxo3ou1lm nlfctas  Dtmxrono1aptomiciysfm2umnmp t)tetoifctydlaD livo (  exr(r3ny1lptelncsl(  Drr(mpnt1olt if3iasfs rlnvon(0arxrmo3oodfaDraneolt)t2xr(opnudlmeemnvils)s2rm(rpnt0aee mf3ilsfsDumn onu4teerxocoatoat lueo t s2toiopoudaltn iviat sDtmxrp;t1aeeniociltfaDea( pn()tlxomo oatopDran o;s0t2xrir iu1apte ivsat aDtaur nt4alxo iciatla rmnmp u)aetoirciodfpt anes;()srxrim3iu1ll elivsls a2urur ;u1oeen ocilt s rmnmp () etrifctytoaDelues;(  2xoim iodopee ivt t) Duaxm ;u4ale io3iydfm ua(vo u0arxrxr3iytlate uvslt teumir iu4ape mieia()s2rax  no4ole iocias a2ulu sn(0 exnir oadlat lies;s0setmimpou1lpt  ivt t  Dta(ro;t4oeeoiictls sDeln p u0tleoir3oa1fp rai il( texoxm oo4oltn ies s  rrr(m no1ope  octadls2uauvp;u0 rxrmo3oytomtrli o;t trxmxrpny4lpt  ivslt  rtau oot4olxo ociaslsDra(ms;(0trerir3oodomDr u i t)trurir io4al nmncs t  rur( pnt0aex ifciasfsDem(vsn() rtrxr3oadfaDraueil(  eumio io4op emfcsat) 2tm(  ;t4tleomoeiadfs ua(vsn(0arxomociodop raivsl( s2trxm oo1optelnvta(fartrump;o1alx mi3iasla rmumpn(0 lenxo3todlpD  iesl(0setmir iudalt mnesasfsDtax pou4tlx moeiltla uan pnu0 rxoxocto1late i ol( s2xoir3ny1lpeelncilt)s2rm(r oo0tlxn feiltla2eanmp;(0texoxoctytopt li slt)srurxm no1om e netlsfs2umurpnt1oeto i3iydlm2rl(vp t0 rxrmr ootlmtr u i t0s2xoxo3oudom nmfeil(fs2urxroou4tetn fetltfs2umuvp ()texnxf3totfm eaues;s0s2tmir ou1open ncilt)s2rmu p;t0olt ifctls s umumo t)tetoif3tadfmtrlivo;t srtr(o nydlltnlietatf Dum(rpot4oeen fetldfsDrln s t0 lxrir oa1faDr ueilt0 euoxopnydlp e fetlsfarur(mo;o1altnmfetas aDrluvo;t0aexnmr3to1laD  ivi t0 eurxo3nu4lmeemivtas  Dua(m nu4aexomieildlmDulnvp (4aexrxo3iytoat  uvilt0texmirpno4opeemietl(f rtr(mono4tle micils s2rlnvo;t) lxoxf iadfmtraivi s0tetr(r ou1op nmnei ( sDtm(rpou4tpxnio3iltfa2um(vo u) exnxoctadfm e iesl(0 2xm(r iy4altemicia() rrrxm nt4tlt  ociad m el( p;u0 rtrmoctotlp eln s;s)trxm(o3no4ol n iesat)s2umumooo4aleo oeiyd mDemu snt)arenir3tytfaDeln i t trurir oy4ap n nvi s  Drmxrpno4oleomf3iad m ul( snu)alxnxf iadomt anvo;s)texr(opiodaptemivsa(  Dtru pnu1aetn o3ilslaDean p ()tlxnir3ta1oa rluei;t0t2to(m3oo4ol n ivs ()aDtrxmonu0tex  ictasfmDem(vsnu4arxomfcoytlm e iei s0t2tmxmpoy1alte nct ()sruax p;o1aptnifeiydfa emumpnu4trenmrciatfm rluvo;()seto(opiu4apt mict s a2um(r nu0tpxniociatls uanvo;t) exnmr oodfp eluei;(  2xm(m3ou1ome  nesa() rrr(ro;u1tptomfciat m ran o;u0aeermoctytfpt aues;(0s2xo(o nydlp e netat)s2tmx  ;u1aeeo o3tldlm2em(vp t4aexrifctatoat anvs s)t2xmxrpou4ll  lnvia(farrmuront0tpx iociyt mDeaumsnt0 eeomfcta1fm rln o s0s2uo(r3ou4opt  fvtas aDra(mpot0teeomocilt aDranmo u4aleoirciodfpteluvolt)s2xmxmpoy4lpee feiltf Dtm(  ;o4tltn fcildfm ul(msn() lxoif iodom e uvs;s s2um(r3io4llee ici t arum(rpot0aetn ieildfs rl(vsnt0 exomociydlatrlivs (  2uoim3io1omeemfvilsfs2rmu  ;o0oeenmiciys sDrm(mo u)altoirciatfmD aues t)srtoim3nu1ape mfesat arumxmooo4texomfcilsls2ranvs;()altoir3iadlpDrai s;(  euo(r nudole mnciasfaDtmur no0aptoifctydfs2ra( onu4texnxo3ootfmD aivs;t0truoimpiy4llee nctasf Dtaurpou4opx iieiysfa2el(vp;() rxoio3tydfm r nesl(  rtrxm3nu4am  mivias  rtauro;u0optomi3iat s2rm(vp t0 rtnmo oy1opt anvs t t2trxo oo1omenlfei t)srtrxmpnt1olenif3iydfs2ulnvo;u) rtoirctytlpt  n i;s texoxo nu4oleelivs ()srtau ooo4apeoio3tytfmDeluvsnu0aeerxf to1opDrau olt  rtmimpiu1apenliesltfsDrmxront0oeeomietyslmDrln sn(0aeeoio3tydoa eaivolt  2xr(m3no1apeemfcs tfaDtaxmo;o1opeoii3iys a rm( ont0tltrirctadlaD  i i ()trxoimpiydlp nlfvia( s2rrx  ot1opeoiieiyd m um(mpnu0trenmrcoatlmtelu s t0teuoxo ny4ll elfesa(fs2taxr ;o4teto ocildfs2emnvs ()artnmrciydfp elieo s0 etmiopio1op nmfes (farua(mpou1opeo o3iydfs rmumo;(4teeomo tatfm elueil() rurio oydop e fvtls srrmumpoo0tptomo3tlt aDulnvo;(4 rtnio3ty1lpD  n o;s0 2xmir3ou1lptemnvi ( s2trxmoot0tetniociadls2eauvsn(0areomociadlpt  nesl( trum(r3iy4lp   nvil( artrx  nu4texoiiciltfaDrluvo t4 rerxrciotomtrau s;s0trxo(r3iu1ll  lfci t  2ur(mp;u4apeoiicias sDea(vsn(0altoxr3tatop eln o;()t2xrimpiodolte fesls)aDrax o;t1ope  ictlt a eluvo (0 rxomociatlpD  ues;s)seuo(o nydlleemfcsa(fsrraumont0tltnmoeild aDel(vsn(0 rtnxrcoydlpDeaneil(  2urir3ny1lleemfei s s2tau o;u1alxnmociyslm ea(mpnu) rtrmr3oatomt  nei;( tetriopiu1am nlieia(fartrxrpno1tetoif3iydla ran s u4altnxo tydfpD au o s0 2xmxopoy4ol  lnvilt arrax pot4apxoifciasfm ulnms u4tlxnmr todfm  anvs;s)srxmxr oydal nlivtatfarta(r no0aee io3ias a2rlu o u0 renmr3iadomteaivils0 2tr(r nudol   nvt tf Drm(  nt0olxnioeiaslaDelnmp;u)tltrirctydfmDelu sls0 rxmxr3nydlp nmnesl( srtau poo0tlt mi3iydfsDrl(mo;u0teenir iodomDe i i ()trtm(r3oy1opteliesatf 2umxmpoo0olxoiociyd a umumsn(4 eenio oodopD lu s;t trtmiopio4altelnvtas) Dumxm nt4tlxo oeiasfaDuan p t) ltoxf3tadopt  uvs t0 2xmxrpoo1lp elnvsas)arua(mo;t0oeeoii3iyd s rmnms u) eerirctydfatraivo;t seurim3oodam  lnvsls  2umu ono1tet  o3ilsfmDrm(mo;u4tetnmo3iotfpDe uvo;(0 2xoiopoodal   nvt t)sDuru pot1ape ioctld s2ulnmsnu)aexrxr3tadlatr u il( sexoxopoudllte nei t  Durx  oo1oleoii3taslaDemn o;t)alxrxo3tytop  liei;t  2xmimpio1ale miesat)sDra(r no0apeoifeiasls2umumon() exrmo3oatomDe nvslt setrxrpoodapen ivia( a2tmxrpou1altniocils a2ra(vo;u)trxnxr ta1lpt aivol()t2trio3iudolt  fct s srurxm ;o0oetnmfciadlaDrm(vsn(4altnmociodop r neols0 eto(r iodopt  nes () ruaxmp;u1aexnio3ias s2ean p;t0texoio todlaDrln o (0 2trir3ou1openmicsatfsDta(mpnu0olxnii3iaslaDuanvp;u0texomf iodlpDelieols)teumirpnudomee feilsfa2tr(  ot4oeeoifciatfsDean o (4 lxrxf tydlaDraivi;(0srxmxo no1ame lnesl(f 2rmu oot4tlx mfeiydla rm( s t) lxnifctydlm rlivols) eto(opoodap elictas)aruaxr ;o0ole mo3tyt a ulnms u0alxoir oodomt  n s ()srto(r3io4lpt lictat)a2rruroou1alenii3iyd a2rlnvpnt4tetrmocoa1lp r nes (0 rtr(m nu4ll  mfvsat  rtm( pno1tpx  iciasls eluvon(0teeoio oadlpt  n olt0s2xrxrpiu1ll  mieilt arumu pnt1oee if3iys sDulu p;() eermf oa1fmD livo;t0 eurxo no4oltnmnes s s2rrxm nu0ole  ictasfm emn s ()tltrif3oydoateluei ()t2xmirpno4lp emfvta(faDra(rpot4texnmoeiltlaDra(vp t) etnxrcoatla e n i;(0trxoir io1amt mnvtlsf 2um(  nu4tle mfeiasfm2rm(vs u4tlxnmociotopDeaues t  rtmxr3oy4om emietlt)srrmx o;t0oleomfciydfa ulnmont0trxnxocoatoat anei ()setr(r oy4aptn fcs (fa2rm(m nu0oetoif3taslm2ulump ()trxrir3ia1latean o t  rxoio3no1om nmfeiasfs2umu ont0aleoiictysla2ul(ms;(4tltrxr3ootfa  lnvi t)texm(m3oo1ope mfctat) Drrumoou1apxn ociltls2uanmpn(0tlxrmr3oadfpD  n ilt) exmim no1lmt  fvils sDumu  oo1oee  feilslm rm(vp;t0teeoxf ta1opD lu o;( t2to(o3iodopte ivs t aDuaxr ;o1opxomfetyt mDrl( o;u0aeerxf3todlaD luvs;( teumxr iydolenlfeilsfsDurxr oo1tpenifciadlm em(mp;(0aetoxfciy1oa e uvsls0 euo(m no1lmeemnvs s)a2uaxm oo1texnio3iys m elu sn() etrircty1la raues;s) rurxr3oy4ap emfvsat) Dtm(  ou1oet  iciadfa2rm( p t4aexomfcoydlp eanvil(0s2uoxm nudol n nes tf Drmu  nt1aptomietltla eau s;t0 lxoir3oa1oate u o;t)teto(mpio4ame mfvilt)a2rm(rpnt1ape  ociys m emumon() exomr iy1fm elneo (0texmim no1ap emivsls)s2tau o;o4tpeomfeiat sDel( o u0 eerxf oydlmtrauvo s0seuoiopiydamenlncs ( aDtr(mpnt1apeniociatlaDrmnms t) etniocoadfmtelu o;(  2xmiopiodaptnlncs t  rtru ont0tptn feiyt mDulumo u)alxnio3oadoateanvi;s)trur(m3iodopt  fvs ()a2tm(m nt1tlenmf3ilsfsDuan p;()teeoif3oa1fpD  iei;t)teuoirpoy4op  lfcs tfsDtru oot4tlx  f3tad m eanvs (4altnir oatfate ieo;s0trxmir nydapeelnvsls)s2umx ooo0teeomociasfa ranvp;t4trxoif iy1op r nvo;s trxoimpoodole lfeia( a2tm(mpoo1ale mfciaslm2um(vsnu) rxnmo3iydlm  an s t teuoim3io4openlietat)arumxronu0ole io3iad sDrm( snt) exoxo3io1oaDraiei ( t2uo(r io1apen nvtas)s2rru o;o0teto octyd m2uauvs (4tltniocoa1opDr uvs t)teuoxo3nu1ap  lncsasf rta(rpnt1oet  ictatlmDelumpn() reoircoydom eaues s0sexr(m3oy4olte nvtltf Dtax oot1olenifeiyslm rlumon(0tetnxf iadoate iei;t)t2xoxrpnu1al  mncsat srtrxmont1tltomietysfsDrl(ms u) etrmo io1laDeluvo;(0srtrxm nudalenmfvtl( arumu ooo4tle mfeilt aDeauvo t)tltrmrciydlm  aivi s) rxoxmpoydlmte fvsl(fartrxm nu4alt miciad a rlnms (4alxnio3oadomD anvsl(  exr(m ou4lmtelnci t  rtrur ou0tpenifeiatlm2uauvont)aleriociadlm  au s t)t2um(m3ny1op n fciltfa2rmu p;o0teeomi3iad a ra(mp;u4 etrio tytfpt  uvsls teum(mpno1lleelicilt)srururpou1apt mi3ilsfs umu p (4 rxnmo iodlaDrliesls  2tmxm oo4ole  ivtasfarrmxm ;u1aptnmfctls m um(vp;u4altnir oydfaDelivilt)teuoxm oy4amt  ivias srrrxmooo0tltnmf3ias m em( pnu4aeerxf oadfaDr ivo s s2xm(m3nydal  mneil(f rrmx  no4apxomf3ildfa ea( s;t4 etnmo ootop eauvs;s0 2uo(o3io4op elicslsfa2rru p;t1optnmictad mDeanmo (4aexnxfcoodla eaues;s0 exo(o3no4optn icil()s2urxroot1alx mictas mDrm(msn(0 eermo ia1faDr u o;(0sexo(o ny1op emfesatfartr(m nu1tlxnif3iys a2rm(vo u)aexnxr tadfmDe n i;(0setoxo nydll nlnct (fa2urxr ;t0aeto f3ils sDuan o u0 lxnmr to1fp eai il()sruoir iu4ll n nvtls  rrrurooo1opxn o3iydfmDuluvs t0tltnxr ia1latelivslt)trxo(r3iy4lpte ncsls)a2rr(  oo4alt mo3tltfsDelnmpnt4tltnmo3ta1om e nvo s)sexmir3iodop emivtlt aDuax  ;o0oexomociatfs uaumo (0tlermf3iotlateai ol()trtr(mpnodlmt mfcilsf Drrum no0tlx miciydla elumo u0arenmfcta1la  aiei;s  2toxo io4ll  mietl(fsrrau  ;t1oetomieilt s2rln o;t0 etrxo totlaDe uei;s)trxo(o3nudoptemfetltfa2rmu  oo0tpeomoctat sDelu sn(4 ltrir ia1fpt  ieo t truoxo3io1alenlicsas)aDum(mp;o4tpx  feiyslmDea( o;t4 etnxr ty1lm raueol(0 eumio3oydlm e fvt s)sDtmx ono0aetn ociysfmDrlnms (0 rxoif to1la   uvolt sruoxo nodal e ieiatfsDumxm oo4oleomf3tlt s um(von(4tlenmf totla eai s () 2tmxmpnodlmtnmietl( arraxrooo1alen oeiysls2emn o t4tlxnxf iadoptranvo t)sexoim3iu1op  lnvil( sDtmx  ou1aleomoeiydlaDua( s (0trxomrcoytla   ivo t0s2xmxrpnodoltn nvtasfsrururo;u4tlto feiys mDea(ms;t4 exrxrctytoptelu il() rxrir iu4oleemfct ( a2rmurp;t4olto fciltlm rm(ms;u4arermf iadoat livs t0s2trxr iu1lpt  ictlt) Dtm(ro;t0opx iiciys m ul(mpnt4teenir3oodlmtrau o ( srtmir oydlmenlncsas  rrm(mp;u0aetoifctydfaDeanvs;u4aetnxo3oadfaD lueils t2umir oo4amtnlieilt s2ua(r ou4oeenio3ias s2rln o;u0treomo iodfp rai s (0 etr(rpiy1op nlnct () Dtau  nt4ale  fciasfmDrlu s;()tlxomf tadlaDrluei (  2xrxr3oodopen nvtatfa2tru  no0ope  ictldlm2eaumpnt4tltoxrciotlpD  ivo t  rumiopoudap elnci tfsrrauront4tltniieiyslm2rau pn(0arxrircoa1lm rlneols trto(o no1ap nmneiat)aDrmu ont0openifeiyd m ra( o;u)alxomr ootlatelieo;(0s2toxmpoo4oleemnvta( a2rr( pnu0tpxo fetyt aDumuvpnt) eeoxfcoodlp eanei s0s2to(mpnu4olenmivils) rrm(  ;u0oexnif3tlsfa2rmu s;u0arxomrctadom   i ilt)seuoxo ou1lptelivtatfsDtaur ;o1alt ifciadlaDeauvs u)altoifciydoaDran o (0setmim iu1amenlnct (faDra( o;o1tpxnmictydfsDea(mpnt4 lxrxr iadfaD lnesls0trxoxmpoodam  mivs t) Drrxr ot4tle  feiltla2uau ont)alxoxo3tydlpteaueol() rxoirpiudlmtelici ()aDrm(rpnu0apx  fciltlm eluvs;u4aeerxf tytfat ai olt srur(o ny4llee fci t)arrmxm ot1tpxomieiatfm2eau o;(4trxrxrctadfmt li o;s) rtmio ou1llt  ivt ()sDtmx oou0tetomoctysla2rluvsnu4 rxnio iotlpD lnes;s texoxmpou4olte ietl( sDrauroot4oexniictltfm2rlu o;() rtnmr io1lmtelieols t2trxo ou4om nlivs sf 2rm(  nt1aex mfcild a rl(mon(4 renmociodop eanvolt trtr(r3iodllt  fcil( sDtrxmpoo4tpt iociytla2ul(vsnu)tlenxr3to1fp  aivols) 2xmxo3iu4oltnmfvsas srtmxrpoo0alxoioeiadlm rlu pn(0texrmo3iadop   ivo;t  eum(m ny1lpt mict s a2rmxmpou0aexomfciatfa2uln pnt0 lxoxocto1fm elu sl(0seumirpnudaltnlnet t  rur(  ;t0ape ioeiytla emnvo;u4 exomf iytlaD lieo t truoim iy4amtn fciat sDuaxmpno1opxnmociltla em(vp;t)tetoxr tytlate uvs;(0t2ur(o3io4am emivs s aDrm(rpou4apenif3iysfm eau o;t0 ltomfcoy1lmDelivsl(  eurir oudalt mnesl()a2rmx  ou4apxoiiciysfm eanvo t)tltoxfciy1opDelnes s srurxo oo1lme  fctas)s2raxrp;t4opxo fciadfa el(ms t0artrif tatom   nvsls0t2xrxr oo1ap e ici sf Dra( o;u1altomicildla emump;t4 rtoxr3ootopt ai o;t0setrxrpoudlp   nviat)s2umum ot0oeeoifctysls2em(vp u)tetoxf3oytom r neil(0teum(o3oudlp   fviltfaruaxro;u1alxo ietysfs eanvo;() rerif iodopte u s;( t2xr(r io1ll  lncta()arur(  oo0tle  oetyt m uan pnu0 ltoio3iatoaDelu i;t teumim ny4aptn nes (  rum(  ;o0ale mieiadlm2ul( p;t)texomo tatlmte uvol(  rto(mpoo4altn fvsls  rumu  ot4tle mi3iat a umuvs u0tetomf3to1fp  lueo;t texmxmpoo1amtemietltfsDta(m ;t0teenmfciyt s elnms u0alxrxf3oytfmtran i;(  rxr(o3iy1aptemnet t sDtmx  nt4ape mfeiatlmDum( ont0 renmf tytfa raieslt0 2xoio3oo4amtnlfvs (  2uaxmonu1tptnio3iatfa2rmuvp;t)arenxf ty1la raneo t0 etoxo3iydapt mfci ()aruau p;o4aexoifeiltls eauvon(0artoifciy1fptr u i s sexm(r3no4amte fci sfaruax ooo1alxoiiciadfaDuau o;u) rtoxf oy1lmDrlivsl(0s2umxo ny1lptnmicslsf rta(  ;o0oltoifctls mDul(vs;(0trerxf3tydfpte uvi t tetmim3nodlpeemfetls)aDur( ono1tlt mieiltfs2ua(vsnu4teenmoctatfmt an i;t)s2tmir iy4lptemfcslt a2uaxmpot1alx moetyd a eauvonu)teerxfctodfpD aueils  2xoir iudom emneias)aDrrxrp;o4aetnmieildlmDrmnvo;(4trxnio3ootfpD luvs s0 2uriopnu4llen nesltfa2tmu ono4tpe  oeildfmDrl(vpn(0 exoifcootfp eanvi t s2trio ou1omte fvtlt  rraxmo;o0opxnmieildlsDemnvp;t)aexnmf3oo1lpDean o s) etmirpiu1omt mivtas  2ra( pno1opx mf3tls mDeauvp;t0 rerxocia1fa rauvs;t0sexm(r3iu4omte fvs t a2tmum nt0openmfciyslmDrauvo;u0alxnxocoytlp eanvolt0srxoxmpou4apen fvtlsfsDtr(rono1aptoioetysfaDrm( s t) ltrmfciotfm  anes () rtmxr3no1lpe mivt ()a2tmumpnu4oexoiiciasla2eaumsnt0arxrircoytom e u ilt0s2tm(o3no1ap elfvsasfarurxmp;t1tlxn fctytfs emnmp;t4 rtoxf3totlmte ues t0t2xmxo iydom e ncta(farrrx o;o1tpx ii3iltlaDea(vont0 lxrio iotfp eaivols0 exo(opnu1lmee ici s) Duaumpou4aeenif3iyt aDumnmsnu0aeenmf iotfmt  neilt0t2tmxr3iodlp nmncslsfs2ra(mpot0oeeoii3iatfa2um(msnu0trxnxocoa1fpD  nvsls s2um(opoudaltemnesas s2urx o;t4tlt mfciydlm2rm( s t4 exrmf iodomtrlnei;(0 rxmirpio4amte nctl( sDurxrooo0aptn oeiadfaDua( s (4 eerio tadfmDrlnvils tetoxr3ou4altelnetatfarrr(rp;t0olto ieiltfs ran o;(4 eermr3iytlpteluei t0t2xm(o3io1amtnmnct tfs2um(ronu0ale mfciyd a2eau p;t4aleoxf3iotopD lnvi ( srxoxr3no1olen feilt  Dur( p;o1tpx mociyd mDumnvpnu0aetoxfctodopD aieilt)s2uo(mpou4altn nesa()s2tm(rp;t1aleomf3ildlmDrln pn() rtrxf to1oaDeanes;s trxmxo3oy4lpenlfciat arrmxmpno0alen ieiydfaDuluvp u4tlenmr3oadlm   u sls) rtrir oo1amte fesa() Dtm( pnu1tptoifeiat sDel(vpnu)alxrxocty1lp eaieol() 2xmio3ny1am nlfei t s2rau ono4tlenmf3ilsfs em( p u) lxrxocty1fpD  neo;s sruoir iodalt lncilt)a2rm(r ou1alen fcils a rlnvp t)tltnio oa1om ranes t) euo(m io1aptemici s) Dtr(r ;t0oeeomfeiatls2eaumo (4trtnmr3tydoa r i o;s  rurio ny1apenlfetat) Dua( o;o1oex mocild a2eanvp (0 reomo3tadlatrauvo;()tetrxopno4lp emivslsfs2taum ot4apxn fetls s2ua(mpnt4tetoircoo1latrlnvs (0 rxrir3nydom n icta() Dtrur oo0tee  f3tlsfs ulu snt4artnif io1fpt ai i;( t2umxm3nudaltemnet t) 2rax  nu4oet miciatlm2em(ms;u)trxoio tadfa eai o t0seuoxm iydlp eliet sfsrrm( p;o1oee mieiys a el(monu4trtoxocio1op rauvol()seumxo3no1al   fcsltfsDtr(rooo1apxnmietlsfs2uan p ()altrmfcio1op  lies s  2xrio ou4openmnvtltfa2uau  ot4aexn i3tadfs2ean s;t4arxnircio1oat  ueols seuo(mpiydoptn fcsa(  2um(m ;u4optomieiatls ul(mp;(0arxnmr oo1omt lnvi ()seurxo3oodlle lfvsl() rurx pot0aleo feilsfa2rm(mpnu)tlenifciotom   i s;t0tetr(mpnodale  nvi ( srrm(m ;u4aetnifeildfm2uln on(0 rtoxo3iotfatr neslt setmxr oy4om nmnet ()aDra(mpnt1opxo o3iyd m ul(vpnt) exnmoctydoaDelu s s0sexrio oo1ameelncils) 2raurp;u0ope mfeiydfm emump u)tleomr3ty1fp elivo t)s2tmim oodole miesa( s2ta(r ot4oeenif3iat aDuauvs u0 eerif oytlmDeai i;(0 rxm(mpio4ll nmnviat) Dtmxrono1apxomi3tysla um(vp ()trxomo3tydfmtr neo;s)setr(rpnydape lfetl( s2taurp;o4opeomo3iatfm rl(vp;u)tltomocto1lm e nvsls)sexm(o3io1oltelfvi tfsrtm(mpnt1oex mo3tltfs2rmump u0tetrifciydopte i i;s s2tmxo3oodomtemfviltf Duaxmp;o1oltnifeilt a2uanmsnu)aeerxr tatlmt an ol( tetrxopny4llt lfesas)s2rmu oou1tex  feiys sDeln o;() ltnxrciydla e neo ()seto(o ou1opeelnctls  2rmu  ot0tex  oetysfmDumnvsnt4aexnmocio1lmtraueols)t2to(r3nu1lle lfct t sDrmumo;t0tleo iciat s ranmpnt0teermf iotomD ai sl( tetoir oy1amtnmnetl(f Draxm ;t4opt  fcildfa um( ont4altoif tydlm  aivils0srxmxo3oydol  lnctls aDrmx ont0apeomfciytfs eauvp;u4 reomr3oydfptelueol(0t2trxrpio4amt  ieias) rrrum ;u0tltoio3tltlmDeanvp t)aeeoirctodop rlueols s2toirpny1op e ies (farurx pno0tlto ociltlaDeauvp (0tlermfciatfmD aies s seumim ou1lp nlieilsfs2umumoou0tleo f3tlslsDea(vo;t0trerio tatfaDrlieilt)s2xm(r3iodaptemnctl(  2tmum ;o1oltn f3iasfsDuln s t0trxnir3ootlmteauvs;t0trtoxr3nydll e fvsa(fa2tru onu1olxnmi3iytfsDulnmsnu4trtnif3iotoa  lu s (0s2uoxm3ou1lle mfctas) Dum(rpot0openioeiyt a eanmsnt0 etoirciodlp r ivs;s0t2xoxo3oy4llenmnetls) Duru onu4apxn fctld m rmn p;u4arxnxr3oytoptranvs (0sruoxo oo4om e feil(fsDurumpnt1oetomf3iyd m rlu s;t4alxrmf tatfateai i (  etm(m3oy1alenmicsl(faDumurpot4opeomfctls s rauvsnu)aeeoxf3iotlm  anvsl(0t2uoio iu4apeemfctlt  Dumxr oo1apx if3tasfmDulumpn(0tetnmfciydlatrlnvo (0teuoimpio4am n ietl()aDra( pno1tltn oetad m2rl(mpnt0aleomf oy1la  livi;t srxm(mpio1lptn fctlsfaDtr(r no1aeenmoetasfs2umnvs u4aetnmr3oatfpDr ueo s  2to(rpny1ol   ieils aDtrurpno1tlxniieilsfs elnvp;t)arxrio tydfp eai s;()sexoxo no1am   nvtatf Drrxr ;t1oeenmoeiat m ea( s t0trtnmfcoo1faD  u o t srurxr no1alte ivilsfsrtm( pou0aetnmietld sDelnmo;t0 rxnmf3oytla  li s;s  rur(opiy1op n fvsatfartr(monu1olx ii3tysfa2eaumsnu4 lxrmr todfpDeaues;s texmir3nu1alenlnes t)srrm(m ;o0tpeoif3ias s2rm(mont4tltnmo3ootlm r nvi;t) rtm(o iy1lme lnvsltf Drax  nu1oleomictyt s2em(vp;t0trxnxr iotopteau i t  etoimpoy1alenlncsls) Drr(ronu0ale iicilsfa2rlnvp u0arerio oo1laDe u i t)texmir3ny1lm emivtat  2ua(m ot0opxn oeiydls2rluvo u)altoif ootopDrlnei;t srur(mpnodapeemivil(f Durxmpot0teto oeiasfa2eluvsnu0trxnircoo1omDe ieol( srtoxo no4ap elnci s) rtm( o;o1tle  iciatfsDrmuvpnu0 leoio iadomDelnvs;t0 2uoir nydopt lfetas)srumurooo4ape mictatls umnmo;(0tleomo oadomDrlu ol() 2umim nudlltelivt t  rrrxm no1alxniieiys s eauvp;()aexnio3iotlpD luvs;t)truoim3oy4apeelnvia(fsrrmu  ;u0oeen o3iasfs2uln ont)tetnmo3oydla rlues;t0s2trxopoo4lltnmivtls) Dra(ro;u4alt mieiysfa2ulu s;t) ltrxr3iatfpteaneilt texrxopny1am n ncsls)artrumont4oltnii3tldlsDrm( snt4texnmf3oa1fpt  uvils)truoir oo4lmtnlfesa(fsDuax oot4alt mf3tyd aDulnms;u) exrmfciytlm eauvi s)srtoxmpoo4olenlictls)srtmxmooo0apenifcilsfa2ua( p;u4alxnxociadfpt auvi t) etrxr iy4ole lfci () 2rr(ronu0tpx iieildls2umnvo t)altrir oy1omt  uvs (0srxmxr oudlmeemneiatfaDuaum ou0tpeoiociatfa2uan s u)trxrif tytop eaies t setmir iodame  iet () 2uaurpnt1tet  oeiytfmDrlnmp u4 lxoio iy1oa ranes s srum(o ny1lp n nesl()aruru  ;o4tetnifctasfaDemu o t)tlxrmocta1fmD  ieol(0tetoio3iy4lm  mnct (  Drmump;u1texnmfciydfs2rmnmo (4texnxr to1oaDeauvslt)srtmxopoo1lmt mfctat)a2tauro;t1optn ociatfa2ea( o (0aeeoir3oy1lmD aiei;s  exoio3oy4lltnmiei t)sDtru  nu0olenii3ildfa ra(vo;t)arenmo iy1faDe n i s0teurim iydom elfeiat) rrru pot4tpxo o3iltls2uauvo;t4alxoxr iatom e n o;t)sruriopno1lpt  icias a2raxmp;o0aexoiictatlsDraumo (0altomfcoa1opt  ueilt)setrio3iu4lpe  nvs s  Duauro;u1altnioetys mDrlnvo;(4 rxnxr ootfm e u o (  etr(m3io1op   ivsat)s2rm(m ou1texo o3tytfa em( p;t0 eenir3ootfat lu i;s) exmxmpnu1ome mivi t aDuru pou4olxnif3tydlm rm( snt0aetnxo3oatlm rluvo;t0truoir3iu1apt lnetlt s2trxroot4texomoctls s2rmnmo;u0aeeniocta1la  an o;t  2xoxopio4altnlnvtas sDra(  no0alto ieiadla2em(vo (0trtrircoatlatr u i;t)s2tr(mpoydopen iesl()a2tr(  nt1texn ociadfm ra( o t) rtoioctydoa   nvo s)t2to(o3nu1lm nmnctl(fsrum(m nt1tlx ioetysfsDea( p t)tlerir oatlm eln s;() rur(o nu4am nmfctat sDrm(rpou4ope  o3iat m2uluvo u0 eenmo3ta1omtrauvs ()srtrxopno4am nmfcslt arumurpnt0aleomi3iasfa2rmnvsnt) ltrxfciy1lm r n s t)trtrimpnodllt  nesl(f rtrum ;o0aexo oetatfmDelu sn(4trxnxf oatoateau i ( trxmxo oo1lm nlnvsa(fa2raxro;o4aeeomietldla2elnmp;t0aeeoir3io1fat an i;t0s2um(mpou4ll nlncias a2uaxmp;t0altnioeilsfa2emn snt)aexoiociy1fa   ivs t  rtoir3nu4oltnlfctat) Drmxr oo1aetomiciyt mDumnmpn(0tlxnmfcoy1opt  ues;() rtrxopiu1lp emics (faruau  nt0texnifeiltlsDemnvs (4aeeoxfcio1lmDr ivi;()teumimpio1omee fetasfa2um(ro;t1alenii3iltlmDrl(mo (0 exnxf3iytlpD lneils)srxoxopio1om e fctat aDurur ;t1opx mfciydfmDuan s;t4tltoir3tydfp elivi (0 rto(r3oy4ale mici t)a2taxmoot1openif3ils sDul(vs t0alenxf iotlmt  u o;t0texoio ny4llt  ictlsf rraurp;o4apxomieildlm rauvs;(0 lermf to1op eluvi s  2uoxopio1apte feias  Dur(r ot0aexomf3iyslm2uanms;(0 rermr tytfm eauvi;(0sexm(r3iy4oltnlfesas a2um(  oo1aptnii3iadfaDumnvs t0 lxoio3iotop rluvo;s0texrir oudll  lfesat)aDtm(m ;o0aleomietydfmDrm(mp (0altnxfcta1lpteauei ( sexr(m iydope mfvsl( srua(mo;o1ole  o3tysfmDelnvon()texrmfcty1fptr uvsl(0 exoxo3iydalte fci (faDuaump;u0optnmf3iadlm2elu s u)treoio io1lp   iesls)texoxmpny4lpe lietat)srtm(m nu0oexoifeiadls rl(ms () rtnir3tadfpDeaies t)tetoim3iudll  mfcia()s2rr(rooo0aexomfciasfm umnms ()artrxfcoodopDeaneo;t0srxo(r nydaptn nesa(fa2ta(root1tlt io3iadfm2uau s;() rtoxrctydopt ln ols0srum(r nydop n net t) rumum oo1olt  i3tld m2elnvo;() rtrmo oadopD au o;t0t2xmir3iu1opeelict ( sDua(r ;o1alx mo3iyslm2el( p;u4trxnircoytfp  luvil( t2xm(o3iu1am  mfvs (  Draxrpnt1texniociyt m ua(vp;u0alxnxociy1oa   nvols  rto(m oy4omeelfei (faDtmxmpnt1optniictld sDumuvs;u0artomfciatfa eluvi () rxmxr3oo4openmict (fa2rr(mo;u4aptniociasfsDelump () eeoif3oodlaDrlnvi;s0t2trio iudopeemnvs ( srur(r ;t0tlx ifciatla2ea(mo (4 etnxo tytfpt an s ( t2ur(m ou4ol nlnetatfs2rrxrp;o0opxoifeiydfaDrlums;u4 etrir3totfmDelnvs;s trxoim3oy1om   netat) Drau oot0oeenioeiydfmDua( s u) etomf ootlm   u ol()s2urxmpiy1om e nctas)srrm(mo;u4texn f3iys mDrau sn(4altnif oy1omt  nes t  2uo(r3ou4lpe mietas)s2rm(m ;t0tltomoctatla el(mo;t0aetoir3tytfptr i ols t2urimpiy1op n fetat)s2uauro;o4tlt mfcilsfa2eanvo;u) rxnif3oa1faD anes;s)s2to(o nydlmeemncia(f rumx ono1tpenmoeiyd aDrl(mo;t)tetrxr oatoaD luvo t tetoxo oodllte nesa( aruaur ou4olx iiciydfs2um(mp t)texnio3ty1lptraueil( t2uriopnodoltelfcs sfaDrr(moou0olxnmf3tlsfa2ua( s;(0tetomf3tatlmte ivs s0s2xrio iy1optn fes () Dta(mpnu0oetoiictld aDumu s;u0alenxrcoadlpDe iei s)seur(m3ny4ame miesltfsrta(  no0opxomiciatlm ra(mpn()altoio iatla rauvs ()t2tm(o3io4omt mivt s  2rr(mont1alx  feiydfa umu o;t4alxoircoytlp r u s;s)s2uoxo no4am  mfcilsfsrururo;o4olxniociasfmDeauvpnu)texnxocoo1oa ran o;t texrio iy4lle mivsltfsrrrx  ;u0oltnioctat a rlumsn(0 rtrir3oodoa  livo;s)srurxr no1lmtn ncs s s2rr(  oo4aexnifctltfsDrlnmo;u)trxnifctadop rluvil(0sexrxo3nodllenlfetat sDur(r ;u4tlt mociaslm2ra( snt0altrxfctadfat  nes;s truoxo nu4lmtelfet t  2tm(mo;u0tpeoif3tad mDuan snu)alxrif todfpt auvo t)trtmio3oo1alee nesa() rur(mpot1aex mi3tyt aDean o;(0artomocoy1lmDe i s (0 2tmxrpnu1amenlfcilt)srta(rpnu0ape mi3iatfs2rluvpnt0aetrmocto1fpDrlies;s  eur(rpoo4llt  fesl( aDum(m ;t0tpx  ietltfm um( p u0alerir3iy1fa elies;t  etm(opoo4lltnlfvt t  rrmumo;t1opx  i3tls mDuauvp t0 reomociodfpt luvo t  2xmio iy4om nlivsls)sDur(r ;t4tex mi3iytfs2uanmo (4trxrxo todopD li olt s2umxr3ou4op   ivil( srum(mooo4tlxn ociysfm2uanmsnu0alenmf3to1om  anvs (  2uoxrpnydap emnes s  rrau pno4aex mf3iyd m2rmnvon(0tlenif oytom  lnvo t)tetm(r3nydlmtemncsls) Dtr( p;o0aexnif3ilsfsDul(vo ()teenmr3ia1op eln i s0texo(r iudoltelieslsf Dtmum ou1tlen i3iyslmDran snu)trtrifctatlpD aueol()srum(opiy1amen icilsf Drrum ot4opxn oeild m2rlumsn()tetomrcoy1oat an olt s2umxopny4ame mivil( arraumpot1tlxoio3ildfm rmnvpnu)texnif3oa1lp   nvo;t  exo(m3iy1lme  fetltf rtmu  nu1tlx  f3iatls emn s;u4 lxnir oo1lpDeln ils  etrim nudlpt mictl()arrr(r ;o4olto fciadla umu p;(4trerxo3iydfm  aivo;t) 2urxr nu4am e ivils)s2uaxmo;u4apx mi3tydls em(vo u4artnmrcty1oa  li i t) eumir nodoleemnetat)s2taum oo1oleoiietat m uln p (4 leoifctytfa  aieo;t0 etmxrpoudapt  ivs ()srtr( ono4aptnii3tyt s2uluvp u0teeomo oy1lm eau o t  2ur(mpou4amtemici tf Drax  oo4aetomociasfs um(ms;u0aexnmo3oodopDelivols)s2xo(o nu1omenlnci t)arraur ;o1oexoifeiydfsDemump;u) lxrif3oo1fptr n o t0 exoiopnydap nmnvsas s2urum nu4openioeiys a2emump;u) rermfciodfaD li o;s0srxmxo3oydalen fvtlsfsrurxr ;t1tleo fciysfaDelnms t4teeoxo3ty1opte ueo s  2trxm3nu4lpenlnes tfs2raxronu4teen i3iatfsDel(vo;()tltrxr oadlaDeliei t)s2trxr3ou1lptelnct s)sDtm( ont1oet  feiys mDumnvo t4tltrxo3tytoaD  ivsl(0 rxrxmpoodape  ietasf 2umx o;o0tetnmfeils m rmnvsnu)artnif iadom   neils t2xo(o oydop nmfvil( a2ra(mono4altoiieiat mDem( ont4aetrmr3oytfpD ai o;s) rtmimpio1lp emfcta(faDuaxm oo0aetnif3tldls2em(msnu4trxoircoytlmt  uvols0sruo(mpny4ale mneiltfs2rru pno4oeenmi3iyd a2ulu s t)altnir3iy1lpD lneo;t) rtrxo iu1amtnlieta(fa2umurpnu4aptnmo3tys aDrm(mo;(4areoxo oytomteaies;s t2toir3oo1lptelictls) rrmxm nt0oetomfetld s ulu p t0trxoxfcoytop r n o t0 exmimpoy4amtelnct (fsrum(mpnt0openioeiasfaDrln s (4aetoxocoodlmDe u o;t)trtoim3oy4lmtemncta( aDum( pot0oeenmi3tydla2umuvsnt0alxrmf3iydoate u s t) eurio3io4optnmivt () rtr(  ot4tlxnioeias mDrmu s t) etomoctydomDelu ols0 rxoxmpoy1ope lies ( arrauronu1aptnmieilsfm emnvs u4 eerio3oa1lpt  nvs s)t2trxm3io1op  lnetls) rtru onu4opeoii3iasfaDuluvp;()texnxr3io1lmD li sls0 rtmio3no1omtemfvi t  rrrurpou4apenmf3ias s2uauvpnu0trerxf3tatfpt an i;(  exrirpno1alenmicil( aDtruront1olxnmfciys m2eluvp (0 rtrir ta1laDelivo ( t2xoimpiy1lpeelicsasfsrra(moou1alxo i3ildfsDum(msnu4artomocoo1latran i s)t2tmim3oodlm   fct () Duax pou1alxo fcilslsDumn pnu4alerxf iy1fa e uvils srumimpno1op   nciltfaDrr(rpno1tpxomoeiltfaDean p;t) etoir3iy1lp  li i;t0s2urxo iydapt mnvsl( a2urx ono1tet iiciytlm2em(mp ()trenxfcoadfpt anvsl( setrir oy4lpee ieslsf Dururpot0tpenmo3tytfs2umump t) rerif3oadfate nvi;()s2toiopnu4omtn nvta() rum(root1tpeomfeiat aDra(mon(0 ltrxf oadoa   neo (0s2xoxr nodapenmnvsas arur(m ou0oleoioeiat a ea(mp (4 exnxfcoodoa e ueols) exoim3iodlm n ici (fsDrrum ;t1aptnioeiadfa umnvpnt)trenxr3totopDr u ilt0s2umirpno4lltnlnei sfsDrm(ronu1oet  i3iltla rl( snu0artriociodopte uvs s0s2triopnodop elnctl(f rurx pot4apeo i3iys a2rauvo t4aetrio iatoptrauei;s0seurio ou4ap emnctls)aDtrumo;t0teenmfctat s umnmont0 lxnxf3ia1fpDe u ils0trumirpnu1om e nvil()aruaxrp;u0teeoifeiydla2ulums t4 rtnmf iydfa   uei ()srtm(opou4olt mnvt () Dtr(mp;u1tleo iciadfm2ranvs;() rxoxo tatopDrliei;t trxoxo3no1ol nmfci s s2uaxmp;t1olt ioeias s el(mont)arerifctodlmDrlu i;() 2tr(o3ny4alenmncs s)aDrr(mpnu1teto iciysfmDum( snu4arxrxo3oa1fmte u i;(  2xo(opoo1om nlfctas sDtr(rooo4aetn oeiysfaDrln pnu0alxoxrcto1opte nvilt  etrirpno1ameelnet t aDrrumpnt4olenmo3tydfaDeanvp u)trtoxr iodopDrlneo;( sexrim3nudope  iviatfaDuaurpno4openmf3tysla ul(vs;(4trtoio3iodoat lieols0srto(o nydaltelfcslt  2umu ont1aetnifeiaslm2umnvs ()artoir3iadom r u il( trum(opou1olenlfet t aDtmur ;t0texomf3ildlm rm(mo t) eerircta1lat aiei;t  2uo(r oodopeemfcia() 2tmxrpou0texnmociasfm emu o;(0 etnxo3oydfm e i ol(0seum(mpoo1ole mfvi t)a2uaxronu0teeo oeiyt m elumo;t4treniociy1fmtraivsl( texrxrpio4olt livil(fsDtrumpno0oet ifcilt m2rlnvsn(4 reoir3tytoaDr uvs t0 rxm(r3nydalte ivslsf Dtaurpnt1alxo ocilslaDel(vpnu)tetrmrciodla  aivol()s2xmxo ou4op nmivt ( aDrm(mo;t4apt iictad s rlu snt4 ltoifcoy1oa  auvi;t0tetrxo3iy1optn fet () Duaum oo4aeen i3iydfsDuan o t)artnxf tydfatelivi;()s2tmxmpno4op nmietlsfs2rau o;u1alxoiieiyt sDrlump;()aexnxfctatlaDr ues;s) rtrxr3oy4lp  licsasfs2rrxrono1oeeo o3iltfa ul( s (0 lxoxo3iotfp rlneslt t2ur(rpiu4ope mics t) rtruro;t4oet mo3tadfm2ra(mo t) eeoxf to1fmDrlivs s0trtmxmpoo1ope  fcsa() Durxmo;u4texomociatlsDrluvsnu0 ltrmr3oatlm  ln i;t truo(opiydale lfci s)s2um( o;t0tle ifctlslm2rl(mo t4teermo3iatlp e nvi;t  eur(m iu4al nlict s) Draxmono1olxo i3tltfm ranvp;t4 rtnxocoydfpDeaieo;s0t2xr(m nu1al n fcs tfarrr(mp;o1apxnmf3ild aDrl(mpnt0texnxf3oytfm  aneil()setoxrpno1oleemieias) ruax onu1tpt  oeiasfaDrmnmp;t) etrmr3oydlate neil(0 eurio3no4altelietlt a2ta(mpnt0tleomoctlsfa em(vs u0trtrmo todlaDeaiesl() rtrxrpio1lleelfcilsf rrrxrp;o1tpxomfeilt aDumumsnu0aeeoxr ty1fate i sl(  eum(m3iy4apt mict t)a2umum nt0alt mictadla uluvpnt0arxrxr iy1oatr n s;s)s2xmim iodam  micsa(  Drmuroou4alt ifciat mDranvp;u0 lermf3iadoatrau i t)srum(m ny1al n icsltf Dtrx o;t0tpt ifeiadfaDuluvpnu0areoxo3ia1omDraueolt0teur(o ou4lp e feils s2rru  nu0aexomf3ilt s2ulnvs u)arerxf oatfmDrluvols)t2um(o ny1ole  ies s)sDuax oot1tex  feiyt a eluvs t) lerio3iy1opD an o s)s2urxm no4op nlnes t  rtrum ou0alt miciad a2eanmsnu4 renmr3tadop r uvi;(  ruoxr3io4lpt  fvtlt  2urxro;o0tee mfciydfs elnvo;u4 lxrifcoatfa e n o;() exmxm3nodal  mfvilt s2uaxrooo0teeoio3tydfm elnvo;u4alenif todlmt auesl( trtmim3iodoltelies s)sDur( p;t0oltniieiytls um(vs;t4aexrxrcta1fp e i o;t sexrirpoy4alt mict ( sDta(mont4texomietatfmDum( on(4altnxociotlmDr n ilt0srtmirpnudope  fetls)artr(mpou4olenmieilslm uan s (0altnxo3todfaD an o;t)s2uo(m io4am emictlt) ruru oou1oltn octlslm rmu pn()areoiocio1optrlnvi t teur(opiodol  mfvt s)srtrx p;u0opxn o3tyt m2ul( p;t)artnxf io1fmDrlieils  2xm(r3iu1lltnlncsat) Dumurpoo1tpenmi3ilsfm2um(vs;u)aexomrcoa1latr n i;( trto(rpny1amtnmnetatf Drm(moot1tleomfetad s2emu snu)aeermr oytlpDr nvo;t t2tmxr no4lltelies t  Dum( ono1alxnmi3tyd s2eanvs u0aexrxo oatfptean ilt0 ruoxm3iydopenmfcsa(fsrtrx poo4teto icias sDemnmpnu0 etoxfcto1oaDran sl(0texrxo nodomt  netas  Drmx  ;u4alt moeiyt mDrlu snu4 lxnmo iatoa   n ol(0 etoir3iu1lp  mnci (fa2rr( p;t0tlx mfcias s ea(mp (4aeenmf tadlmt  neo;(  eumir oydaleelict t)s2taurpnu1aptomoctadla rmnvs t0arxrxocta1fpDelnvo;s0trtrimpoy1lm e fvias) Dururpnt4aet mociyt sDuln o t4 renif3ootlp raivolt)t2xoxmpoodoltn ici () 2um(ro;t4tpx  ieiat m rl(mp;t0 rxrxo3iydfpDrli i t  exoxmpiy4lmenlicsl()a2umxmoot1oet  o3tyt a ra(vs (0aexnmo oytla r i i t0tetoxrpiudoptemfeils  Dta(ro;o1aee mfeiadls eluvsnu0 etoxr3oadla  aueo;s0 eum(opoy1omte neiltfa2umump;u4texomoeiad m2ra(ms;u) rxrmr3oatfp  an o;( texrio3io1lmteliviat) rrru pnu0tpxoifeiatlm2rmu pnt4 ltoio3oydlaD  uvo;t texrxopoodom n feiasfsruru p;t1apenmoetysfs ra( s;t)tetnir3tadfp r nes;t0srtrio oo4omenlnes (fsDraxrooo1aee ii3iydfs emu onu) ltoif iatfmteaieo;()t2xrio ou1lm  lfeil(fs2rmur oo4alxomo3iyslsDemu ont4tetnmocoytlat  i s t  eumir3oo1alt  neiasf Durxrpot1tlx iociasls ua( on() rxoif3iytfmteai o ( trto(r3ny4amtemnctlt srrax p;u4oet mf3iatlaDrl(vs t4 exoirctatoaDrlueo s)trtmxmpoodlmenlfcs t)sDrrum ;o1oetniociys mDul(vo t0 lxnmoctodlpt luei t texmir nudlp nlivslt a2urxrp;o0olxoifetyd sDua(vs t) etnir todlmte n ils  rumir3nodal e ictls)a2rmurpoo4tlx  ocilslaDrmn p (4 lxrir3oytomtelu ols0s2toxr3oydomeelivtls)srta(m nu4alt  i3iat m2uanvo t0 rtnio3oadla eaivo (0s2xrirpiudlmt miet s a2ra(mpoo0oet  ictyd mDea(vp (0 rxoxr3tatla raueo;t0s2xrir iy4lmtemnetls)srtmu onu4teen f3iadfa rm( p;(4aexoiocty1latr nvo s) eto(rpio4ol  lnci (  Duaxm nt0oexoifetysla rmu s t) lenircta1lm raies;t  rur(o3iy4am nlivta( arra(roou0oltn oeilsls2rln o;(4tlxomr iodfa eaivs t0trtr(r3ny1lltemnctls) 2raxmpot4oex mf3tydlm emnvpnt)aleoif3oa1fptrlnesls seurxmpnu4lmt  neta(  rum(mooo0aee mociltla ua( p;(0altrmf iy1fmt lnvils  etoir oy1ol n neta()a2um(ro;u1tetn feiyt s rmn p;(4aleoir oa1lpDraivsls0 2uoiopnu1aleelici s)arrrurpou1teto o3iysfsDrm(vsnt0arxnio3ta1opDrau i;t0 eumimpnodapee ivt ( s2rru  ;u4alxn o3tad sDrlums;() rtomo3oodoatrauvol(0trumirpoydllee fesl( sDta( onu0apeomfeilsfm ea(mp;t)teenmr3totla rau o;t trtrxrpnu1lpee feslsfaDurur ot1oexnifctadlm uaums;(4 etnmr3ty1lpt aivi;t)sruo(r ny1lp  miet (  Duaxmpnt1olxoiieilsls uluvs u0altrircoydfp ranei;t0 ruoxopnu4lpenlnci s  rumxr ot4tet mieiadla ea(mo t)texnxo ia1oaD aivi;t)t2tmxr iy1llt  iei s srtrum ;t1aet moctad s um(vpnu0aeeomo3iadoaDelu i s0 rto(r3oodop e fci t  2umu  no1aeeoiiciltlmDra(vs;(4aetoxf3tadla ranvi;s)setmxo3nydalt lfeslt)a2urxm nu1alen f3tasla2eluvs u0trxoifcta1lm rlieols0 exrir iu1omtn feiat srtrx ono1aeenmoeildfs2rlnvo;(4 eenxr3totfm rli sls) rtrio3nodlle mfetl(f rrrxm ;o0apxo ietldla ulnvpnt) lxomr oo1oa r n i;s sruo(opnu4opee ncilsfs2tau  ;t1aleo fetysfa eanvo (0artoxr3todla rli o t0trxoxm nu1lm  mfvtls s2rmxro;u0optoioctltla2rmnvsnt4trtoxr iotfm  aueo;t s2xrxm no4lm   fcs t sruau  ;t1aee  oetatla2eanms t)trxnxo3iydop   uvi ()sexoxr3oo4om  lncs tfs2um(r ;o4tpxnif3tyt s rl( o;(4tltrif3oytom  livsls0srtrimpnodopenmfvtlsfs2trxr ;o4tltoifeiydla eau s;t4arerxrciydop rlueols)t2xm(mpou4om  mfcs ( sDrm( poo1tetomoeiysfaDrmuvo;u)arxrmrciy1oat  u o s0t2xr(m oy1opt  nvs t sDrau  oo1altoifciysfaDul(mp u4aeeomfciytfmDr uei t)texmxm nu4oltn neils arrax onu0oleoio3iydfaDrm(mp u)teeoir ia1oate i s s)tetoxo3nodlp e ies tf ruau  ou0tet mf3iatlaDelnmp;t) rxnmf iydoatrlieil(0texr(m io1op elfes sf rtr(mpnu4tpto o3tldlsDem( s u4 ltnmr3ia1op  ai i (0t2trxrpoo4omeelfei tf 2um( ooo0tpe ioetlslsDemu s;u)alxoio tatomt  ueils0teurxm oy1am elfctl(fsDtr(m ;u0tpxoii3ilt a2rau pnu0 renmociy1omtraneolt) rxriopoy4omeemfcil( s2umurono0tpe mictysfm eln o;t4aexnmociodomteli s;(0srtmim io4lmt  ncias a2raxrono0tpxnmociydls2ua(vs u0 eeoio iodfp  luvols) 2xr(rpoo4op   ieia() Drm( p;t4tpxoifcilsfa2umn p;(4arenio3oo1oaDr ivols trumir iy4lp  mictlt)sDuaxr oo1tpeniiciyt sDeauvo u4aetoifcoadfm   i ols0srtmim iy1ome mfctl( a2umumo;o4olt  iciat m rmnmo;u0 rtrmocto1lptr neilt setriopoo4lmt mics tfsrraxrp;u4oleoii3iatfm elnmo;(0 ltoxociytfm  luesl( seuo(o iydlpenliet sfsruaum nu0tpxnmoctydfa2rm( s;(0arenmr totfmtrln i s)srtrxr3iy1am elicsasfsrumx ont1tpxnioeiys a2el(mpn(0 rxnifctydlatrlueilt0 2to(mpoo4aptemnciatfsrrm( oot0oleomieiyd m uauvs;t4alxrio oadfmDrluvsl() 2toio3iu1ole livia(fsDtrxmpnu4aeto feias m2uanvpnt4texoxo3iy1la rluvi ()srtm(rpoy1am  mici (  2ur(r nt1oetnmo3iyd a2raump;u) exoifcia1fmD lnvi () 2urxo io1ap nmfet ( artrumpou4tee iociltla emumpnt4altnmo ia1laD anvo (  etoim io4apenmfesat srumu p;t1apeo ieils aDrl( snu)aexomo3iadlp  ai ils)tetoio3iudom nlics tfaDrmur ;o0alxnmiciydfsDuaumo;() lxrxfcta1omD aivslt) 2xrxrpiu1llenlnctlt)s2umump;o1opx mf3iys m2em(vs;u4 etrif oo1omDeluvo ( srxmxopnudomenmnvias arra(r no1aex moeiyd s2ra( pnu0 exnio todfpDrlieolt)t2tm(o3nydap   ici s  Dum(mo;t4tlenmfcias m2ea(vp;t) etomf iodfmt lies;(0 2tmxo iydlmee nvs (fs2um(ro;u4aet  fctasfs2emn p;(4arenxfctadopDraivsl()srtmxm3iydlptemnctasf 2rrur nu1alx if3tlt m umumo u)alxnxo3iodlmt lnvo s0seumxmpoy4lmtnlfvsl( arraxr nu4tpxnifeiad a rm(mp u)tltnmo tadfmte n s;( teurxr iu4llt  ivi tf 2rmu oot4tpx  o3tadfs2em(vo;(4tltoxo3totfmD lieo s trur(m iudope mnvsls) Dumu p;t4texnio3ias a eanvsnt4tleomr3ty1omtraivi;(0srurir3oudaleemfcsat arrax oot4apxnio3ilsfmDea( pn(0 eenxo3oodlm ean o;s0texr(o3ou1op nlnesa()aDuax  oo4tleoii3tltfsDuanmpn(0arxrxf3iatla elieo ()teuoio3iy1al nmfeilsfsrum(r nu4oetoioeiyd aDra(vo;(4trxomf3iatlm   neo t seur(o nodaptn ivt (  Dumurpou4ole mf3iydfs2ea( on(0aeenif3oy1la r ies;()srumxo3ny4am elnvsat  Dtr( ono1optomicias a2um( o ()trxomr iotfpDeau o;(0 etoxrpoodomenmnctat  2uax pnt0alxomi3ild sDrlumon() eenxfcio1laD aieo s setr(opou1lpenmnvt t  2rrurpou1texo ieiatfa rmump u)arenif3tydlptr ivil(0 rxr(o3no4lmt lfes t  2uaxrpno1tpt mfetatfsDrauvs u4 rerifcoadlpteli slt0s2xr(r ou1ome mfvs (  rtaxrp;t1oetomoeilsfs emnvpn(4tetoxo3iytfp  livol(0 rxm(r ny1ap nmieta()sDurx  nt1aeto oeildfm umumpn(0teenxr totfaDraivo (0trxmxo3oodaltnmivil(f Dur(ro;o1oetoif3tysfm2eau pnu)arxrmf3oo1fm  ai i (0seur(m3iydopen fviat)aDra(r ;t1tltomfciltlm2rmnms t4teenmrcootlm   ieol()s2xo(m nu1ll nmnvs t  2uaur ;o1apto i3iasfsDrlums t0 eerifctotfpDr i sls0 etoiopiudllee feslt)sDumx onu4optoiietld s2ranms (4artrio oy1lmtelivols s2tm(r3io1opt mivt sfs2umum no1tlxn o3iltfa eanmp;u) rerxocoatfptean s;(0trumxm3io1olt  fvi ( a2uaxro;o4oexniiciys a2ea(vs u4teeomociadla  aneol(0 euo(m iy4lpt  fvsl( sDrrxmpnu1aexniieild m2ea( ont4arxrmo3todfaD anvi s)trxrxr nodamtelfvs tf Dua(  nu0oltomfeiatfa el(mpnu0altnircoydoaD li o;t) exo(r iu1amt mnesat)aDrrur nu4oleoif3iasfs umuvp t4texnir iy1faDelnvsls)trtrxr3ny4olee fet t  Dtrur ;o1alxn ictlsfm2umnms;(0tltrir3iotopteaieo;s0t2uo(opno4ap e fvsat a2rr(m no0tpe  i3ilslsDua(vpnu0 rxnirctytomtraiesl(  rtm(rpny4lle mnvsltfa2umx oou0aetn ieiytls ra(vonu0alxoir ootop r ivslt  rur(opoodlme liet (f rua(rpnt1tlx if3ilt mDrau pn(0 rxrir ia1fp elu ols)seum(r3iy4lleemncsat)s2raxmoou0alenmo3ildls2ran onu4alxnio ia1fmt ln o t  etrxr3iydlpte nci t  rum(ro;u1alto o3iysfm2elnvs;(4 rxoxfcto1fa  livo s)srxoxmpiy1lmte fvias)a2uru  ou0aeeoiieilt aDraums u0arerif3oodlaDranei;t0setrxr3ny1lle lfct t srrmxr nu0apxnmicias s rauvpn()tlenio ia1fp  an s;t) exmiopnudlpt  fctls)srum(rono1oeenio3iadla2um( pnu) eeoiociatoa rauvi;s0s2uo(opny1llenmfciltfa2raurpoo0tee if3tltlsDea(vo t0trxnirctadomDe n s;t  rumxr iu1lpeelnet t) 2urxmpot1altoifeiytfaDumnvs;(0altomfcoytom  lueslt)texoxr oodol  mietas)srrmur nu4ale  ociasls umump;(4tlerxr3iotom ran i (0teto(rpio4op   icilsf 2tm(ro;o0oexomf3iydfs2ul(mpnt0arermr3ty1om raivs;s)t2umxo3iu4ol elfvsas s2tr(r oo0alto fctydlm2ul( p (4alxoirctotomDraneslt)s2xrio3oudlpe  neta() 2rrum no4tex ioeiadfm uanvs;u4texomr3iotom r nvilt0truoiopiudale  ivi t aDtmumo;o0tex iociasfm um( s t) ltnxo3ia1lptrau s;s) rumiopou1ap n ieils)sruaumo;o0tlto fcias m rmu snu)alxrir3iytlp  aivs ( trtm(r iu4alenmneilsfs2tax p;u1texniieilt a2rmnvp (0trtrmf iydomDr ueilt texr(o3no4olt mictat)srtmurono0altnifeiatlsDranmo () renir oodlmDranvo s)t2xm(o3oodlp eliviasf 2raumo;u4tlto oeiatlm eanvonu4trxrio3tadopDeanvols srurxr3iu4ale mfvsls) 2rmx  nt4olto oetytfm ea( pnt4 ltnmociydfaDe nvi t) 2xrxo3nodapenlictl(f Dumu onu4ole  i3iysfs rl(mp u0alxrir3iytom eluvols) exo(mpio4ll n ivs tf rur(monu4tlt iictyd s rluvo;u4 renmrctatlat lies (  rurim3io4lmee nes t)s2tmx  ou4apt  ieildlm2em(mpnu4teenmf3iatoa e i s;()setmxo3oo1lm   ncsls sDrmx oot0tpe mfeiydla umuvs;t0 ltnmfctodlpD lneo;(  2trxm no4ll nlici s arta( oou4openmoeilt m ra(vo t0aeerxo3oy1om eluvs t  eto(mpiudop e fetasfsrraumpou0tpx ifcilsfm rm( pnt) etnifcto1lp rlu slt) 2uoxo3oodalenmnvs tf 2rrumo;u4oeeomoeiytfa umumont4 rtoxrctotoaD li o;t0t2ur(mpny4am emncsa(  rtaxmonu1tptnio3tldfsDrauvpn() exrxo3ta1laD auvi;( srurimpiudapeelfetat) rtrxm no0tpe iocilsfa umn s;(4 ltnxo iy1lm rlnvs s t2xrxopoy4ap  mfvil() Draxr ot0ope ifcias m ean o u)trxrmr ta1fp   n il(0t2tmir3oo1olte ncta(fa2trur ot1olt  icildlaDra( s t4areriociy1lpt  nvil() 2xmimpiudlmen ieil( aDur(rp;u1tlt  ieiat mDrmnmpnu4altoxo3ootfpDeluvs s0s2to(m io1omtelfvt tf rur(mpoo4tetn icilslmDeln s (0 etriocoatlptr ueols)t2trxr3io4lptnmnvtl()a2rr(moot0alenmfetld a2rl(ms;(4trxoxocoy1laD  n il(0 eumir oo1ameelfcils) 2tru  nt1apeo ictltla2em(monu0trxoif to1op eli i;(0 rumxr ny4op elnvsasfsrrau p;o0altoioetat aDelnvont)artoircoodoaDrlivilt0t2toxr ou4om e fcsa( srtax o;u0oeto ieiytlmDrauvs;u) rxnmr3tadoaD lies;() eto(m oudlltemnct tfaDur(mono0tpe ifciytlmDemu p;()trxoircoodlm  lnvo;s)trur(rpoydlp  mfcias  Dtmxmont0opeoiietas s rmnmp;()tetoifciytlatr nvsls)t2tmirpio4apee nes (fa2umurpnu4texomo3tydla eanvp;u)tleoir3ootom ean i;s0srur(opoydlp nmfcil(f rtr(m oo1oex mieild aDel( snu) rxrmfcoo1fpteanes;t  rxmxm3oy4lpt  fcsasfsrumuronu4tptomfciatfsDrm(vpn()tlxnir3iydfm   neo;( trtr(o3io1ap nlicsltfaDur( oot0tpto ocilsfm2uanvp (4aeeomo iodlaDeauvslt)srxm(o iydape  ncil( s2ra( ooo1aetnmieiasfaDul( pnu0teeoxfcoydfpte uvsl( trtrxo nydlpt  feta(  2rr(r ou0oetnmi3iad m2emums t4 rxnmociotomtrlnes;s  etrxr3oo1lpeemfeil() Dtmur ;u1aexn ociyt m2em( o t)aetnifcoytoaD lueilt) 2xoim3nudlltn fci sfa2taxrpoo0oeto icils s2em( s;()trtoxfcoydlpt aneo s srtrim3no1omte fctasfaDrrxrono0apx ii3iatls em( o;(0aetrmr3oo1oat auvo;( t2tm(m nydal   ncia(  ruaxm ot4apt ioctadla2el(ms u)artrmf3totlp   i i;s0setoir3oo1lptnmnesls)srumurooo0tle ifeiys m uluvs () rxoxf io1fmt luvslt) 2toxopiydllen nvt ( sDumurpno0tpxnio3iat s em(ms;() exrxr3to1om e u s;s0seurxmpiudamtelncta( artm( o;t1aexnmo3iasfa ulumpnt0 eenmo3oadlpt aieo;(  2urxm3oudlmtn icilt  rrmu ooo1tlxniociltfs um( pn(0alxoio3iodlmt an ols0 rtmxr nudlp n ivilt a2rmu p;t0tpt mfctys m rm( ont4 eeomr3oatlaDrauvol( s2tmxm3ou1lp e ncta() 2tmur ;o4tpt  ociltfmDrl( p;u4 rtrio oo1fptelnesls0seur(r ou4llee nvs s a2trumo;o0olt  fcias sDeln pn(4texnifcoo1faDeauvs;() rurxr3oo4am emiviat sDrr(r ou4aeenioeild mDrlnms t)aetrxr oa1fat lueil(0t2xrxo3nu1llee ict s)artax ont0tlxomi3iat a2rlumsnu0aeerioctytfpDranvilt trto(rpiudoltemfvil()sDumurpou4alxomfetytls2eluvs;u0tetrxrctydlpDr i i;s trtrxopno4apeelnes tfsDraxm no1olenmietadfa ea( pn(4 ltnirciadlp rlneo;s)s2xmxo iu4ol   nvil(  Duaumooo0tlt  oetyslm2ean s (0 lerxf oydfpD  ueilt0s2um(m3oudom n ics ( srrrxronu0ale  f3iatfa2emnmont) rtomfcoa1omtelieilt)trxrxr oodlpe mfvi t sDrm(r ;u1olx if3ildlm2umn o;() eeomo3oadlp elneslt)trxoir iu1ameelicias  rtm(m no0texn ociltla2eluvo;t) rxoif3tatfptean s;(0srxm(r io4ap  mfcia(  Drrxrp;t1oexnifciadla rlnmp (4areoio3oy1fp   iei;t0 rum(m3oo1olee fvtat) 2raurpou4oex mo3iadfm rlnmo;()teeoir3oadopt lnvo s0trxm(o3oo4ll  lncsl(  Draxmooo0oeenmoeiltlm ulumo;u)tltoifcto1omDr ivs t trxoxr3oy1llt mneils)s2tm(rono1apt  fcias mDelnmonu4altrmf3oo1om rau s ( trxm(m3iy4aptelnctlsf 2umurpnu1apeomicias mDea(vs t0texnio tytlatelu s;s  rtmio iudap nmfvtl( a2tm(m ;t4alen feiad m2ulnms;() renmr3iatlpDrlnvo;t0s2uoxopnudlme  feil(fsDumxront0tptomieildfsDem(msnu) ltrmocoy1fa e u i ()sexr(o3iydapen iet t) Drmum ;t1tpt ioctydla2rmn o (0alxnmfctadfm  luvo t0t2xrir iodolt lnesltfsDur(  ;u0tlt ifeiaslaDean p;(4 etrmrctotfmDeluvil(0srxmir3no1ame lnvsasf rtrxro;o1olenmiciadfaDrm(vp;t0trtnxr3oo1om e ivslt) etoxm no4op   ics s)sDur( o;t0tee moctytlaDulumo u4artnifcto1op r uvsls) rxr(r nu1lpe lictls) 2ta(mpnu1tlt  o3iyt mDelnmo;u4 lxoio3iadoa elieo;t)trumxr oydlltemfetl() Dtmu ono0oleniieiasfs umums t0arxrif iy1lm r n s (0t2toxrpnodolenlnct s) Dur(mpnu0apt  fetasfaDeaump;()arenxf to1lpDrliei;t) 2xrir nu4optelncsl(f 2tmu ont4apx ifctas s uln p t)aexrmf iotopt  nesls s2ur(opoodlm elfci t a2tm(m ou0aleomi3iysfs ranmp t4areoxfctodfptr n i t)trur(o nu4lm  lnetlsf rtmurono1apxo icias sDuanms;u0 ltnxr oa1fa rli i t srumiopnodlmen ivtas)sDumumpot1oee mietlt s rl(vp;u0tleomf3oatopDeauvsl()srurim3oydamtemnct ()s2rr(ro;o4alenio3tydlmDelnvo;()aleomo3iytlmtraneils)teuoxo oodaleelfcsat) Dtm(r ot4aeenifctatlsDel(mp u0tetoif3oa1fpt  ivi;(  2xrio3oy4op  lneslt)s2rrx  oo1optnmfcildfa rau o u0arxnircoadlpDeaies (  exm(r3nodomtnmfeil(fsrrrxrooo1opeoifeiat m2uluvpnt4aetoif3tatfaDeaieol(  2trxo3ou4ol n ncslt  2trxr no0alto o3iatlm emnvsn(0 renxf3oodlmt ln ols seuo(o nu4al e net (fsDrrxmo;o4aet ii3iytfmDeau s;(4aeenxfctytom  aiesl( t2trxr no4altn ictat)sDraxrpoo0opeomieiys sDulnmont0tltrmo3ta1fate ueil(0texoim nu1llenlnctas)sDtaxro;o1apto ictys a uluvo;t0 exoir3iy1fa  lu o;s) eumir3oy4lltelfcsasf Drmx  ou4oex moetlt m2ua(mp;(0 lxomr iotfpDe i o;( seumxm3iy4al n fcs sfsrra(m nt4aeeomf3iyd a2rlnmp t) lxrmr3tydlaD ln olt0srxrxm3iodomtnmfci tfsDum(  ot4optnifetatfmDra(ms ()trtnmrctodfm e ivilt s2xr(m oodlp nmiet tfaruaxm nu1oeto feiasfs uau o;(4 rxnxr ia1lm raivil(0t2trirpoodaltelfvsl(  rrmurp;u1tet ifeiyt aDra(mon()tltoiocootfat aivslt trumxrpno4llenmnctl()aDtrumo;u1apt mieiadfs rlnmo (4arxnmrctydlat  u il()trumxopoy4lmt lnviltfsrua(mpnu4aee iietlsla rlu s;(0alxnmrcoodlmtrlu i;t teto(opoy4lme mncs s s2ta(  ;t4aetoiiciadfm rmump u4 rxoxo iatfatr uvi (  rxmxm3ou4ol emfcsl(fa2tmumooo0aptoiociysla ra( snt0tlxnxo iadlatr uei t)t2tm(o iu4lpte nvs ()arraxmp;u0tltnmoeildls2ulumsnu)aeeomr3totfmD  ivslt)s2urim ny4am e nvias)a2uau onu0aeeo ieiatfaDumuvont4texomr3oadfmDranvo;(0 2trxopio1op   netlt)aDtr( pot4alt ifeiltfa2rmnvont4arxoifcoy1latelnvi (0srumxrpnudllt lfct s  rur(roou0aptn oetas s2rauvo (0 lxrmrctatfmteluei;()t2trxo iy1am nlfet ( a2ua(r nt4tpx  ieiat s2rmu snu0tleniocty1lpteau i ()texoxopiydlmte ieilsfsDurur no0tltoifctytfm umumpnu)teerxfcoytlptelu s s) exoxrpny1ol   iesas a2ra(r ;o1ape  f3ils a elu s (4alenmrciy1fp raieo;s teur(o nudap n fvt s) 2rr(rpno0opx moeiasls2rl(mont4 rxoio totop   ivi;(0trxrir ou1omeemfcsasfsrumxmpno4apt mi3ildla rlumonu) rxrxr oytoa  luvo t teum(m ou4alee fet t)a2ua(moou0aetnmieiydls eaums;(4aetnmo ia1oaDr uvsls0truo(m no4lp nmieslt  2rm(  no0oexniicils m2emnmo t) ltnxocia1latr ivs;t)teuoxr3ou4altemiei sfs2ta(r ;t1opt io3iat m2um( s;()trtrmr oy1oatrlnvo;()trum(o oodapen neilt  Duaum ;o4ope iociydfm elu ont0 exnmf3iatlmt  n ils) rurim iu4al e iviasf Drm(rpnt1aexomoeiytla rmuvo;u)artnio oo1oaDelnvsl(0 rum(m3oy1oltn fciat  Dtmx onu4oet moeiysfm rmnvonu0tlxnmf iodlp e ies;t  rxm(opiodopte neiltf Dur( oou4tptomocilt m2ulu o;u4artnmr oytfa raies t)s2uoxmpoudom e nvtltfsDur( o;o0tptniiciytfs emnmont)aetrifctydlaDran ilt sexmxm3iy4ope livtlsfa2rr( pno1ape  oeiltla2rl(mp u)artrmr3oatoptelu o (  rtr(o nu4amtn nei (f rumx pou4tltn octys m2emump u)trxnmo oo1omt lnvi;s s2trxrpoo1op  mneta() 2tmx p;u4oee  fctlslmDul(mp ()tltnmf oy1lmtrlu olt)s2umxm oy4apt lfetlsfsDtr( pou1tpe ioctyt s rmnmo u0alxomo3oytfmteauvslt)t2xrio3nu4ll elnct s s2rruronu4aetn oeiadfm2el(vp;()arxomrciodoa raueslt0t2tmxo3io4op nlici t)s2rrum ;u4tpenmociytfsDra( snu)aleriociatoptrli i;( s2trirpoudomenmfesa(fsDrm( poo1oeeomfctyslaDuluvo;t)aleomr3oodlp eli sls0s2xrir ny1alt mnciat)a2uau pnu1tetniieiydls2uau o u)arermf3oy1oatrln slt0srurxr3oy1am emfvsls)srrrurpou4tee  fciyt aDumnms;u4 exnmf tydfpt  u il(0 2toxmpnu1om  mnvsat a2um( pou4olxoiieiatls ulu snt4 renxr3ootoa rlneo;s trtoxm3nudom n nesatfsrtax  ;u0olx moeiasfaDul(msnu4tetoio3oytfp elnei;s)t2uo(o iydome lnvilsfs2uaxm ;t1olxomocilsla2eluvp;()artomfcto1oaDelnvols) 2umim no1al elfvsl(  ruaum ;t1apx  ociydfmDuaumsn(0artnxo3iydlpteluvi ( t2xr(mpiy4lpenlnes s)s2uaxmo;u4oltoioeiyslaDelnmsn()aexrmr iodfp rlieo;(  2xo(r io1ape  ivtl(  2tr(r ;u4texo fciysla rmn ont0tetrif to1lmDeauvi;( t2uo(m3nodopt lieta( a2uax poo0opxnioeiltls2rl(vsn(4treoxo3ootfpD li o t0s2ur(r oo4am elicia( sDum( pot4oltnmoctasfaDuauvpn(0treoxr ia1lptraieilt0tetm(o3nodllt lictasf Drm(  no1oet iicias s ean o u0tetniocoy1fmtraivolt0texmxo ny1ope mfci s)a2ururono0tpxomiciatfm2eln sn(4tltoif3iotoat aiei s tetm(rpoudaleelivsas)arrm(mp;t1oeeoiieiadfa uanvo;u4tltrxf3oy1opD ln il()s2uo(m3no1ome mneiat)srrr(m no4tpxn ieiatfa2ulu p u)tlxrxfcia1latraneilt)t2xrim ny1apte ivtat) 2tau  ot0tetnifcild aDrm(vp t4 rermo3oydlptrlues ( trxrim3ny1lmen nesatfaDumu  ;t4alt mi3iadfm ua( p;u0 rxrio iodfpt an ils) etmxr3ou4am nlncsa(farur(ro;u0opeo f3iydfs uln pnt4 leoif iatfaDe uvo s0s2tmim3iudolenlfeta(  2rmu pnt0oex mocild sDem(mp;(0trxrxf io1fpDe n i t0trxrxm3ny4ap nlfcs s aDrax  nu0oltn ieiatlmDemu p t) renxrciatomDe ivi ()sexmirpou1lme lnvtat) rraxronu4aleoifeiatlsDem(vonu)areomo3iotlm  luvo s) 2xr(m iy4aptnmfcias)sDtrum nu1ope  ietlsfsDuluvp t0 exniocoydla raivs t0 eurxm3oo4lltnlnvs s a2umx pnu4tpxoiociyt a2uln onu4 eerircoydlpDrlnes;(  ruo(r iodlp e ies sfs2rrurp;t1tpt ifeild m2umnvpnt0 etoir ia1lat  nvs ( t2xoxmpnodap n feias) Dum( ooo0opx mo3iltlmDemuvpnt)arxnif3oadoaD an s ( teuoxo3nodap nlnei t aDtr(r ;o4tpenifeilsfs2raums;t0alxnxo3oo1laDelueols) 2to(opnydame  ieslt  rur(r ;u1tltn f3iys a uanvp u4 eenircto1lmtr ivslt0srtm(o3iydomen fvils  Dum( ono1aee moetltfmDea(mp;(4 lxnmf3iatopDeluvol()s2trxm3oo1ame mnvia()arrr(m oo1aex  oeiadlm ea(vpn()tlxrmf3oatomD aueo s  eurio3iudlltelnvsl( artr(  oo0opt mi3ilt m2emn s;u4 rtomf oa1omte ivs (0seurxo3nydll n fvilt) Durxro;u1optn oetydfm2ranmo;u) reoir3ty1fpDeai i t  2xr(m iy4oleelivs tfs2ua(rpoo0teen icilsfa2rm( s;(0artoxr3totomDr n o;( sexo(r3oo4amtnmnvta( arrrxrpno4opeoifeiyslaDeaums u4tetnifcto1opDrli s;t srxrxo3nudlmtemnvt t) Drr(mp;o1tleniiciysfm2umu onu4arxoxf3todfaD  ivo;( t2trxo3no1alen ivta(faDtrxmpnt1tpe moeilslsDrmnvs (0areoio oodlaDeau s t  ruoirpou4ol emfcil()srrmumpot4tpen ieiad m ea(vpnt4arenmocoytlpteaneil() eurxr3oy1alte ivtl(fsrra(m nu0opto o3iltfs2umu s;u0aetrxfcta1fmt anvi;t  etmim oo4altnmfvia(fs2rru poo1tpeo f3iys a eauvs u0 rxoxrcoo1latrluvil(  etoio iy1amenlfcs t)aDuau  nt1ope  ictytfa2ean sn(0 rermr iatoptr neo;(0seur(rpnodlpte fcslt)s2rm( ono1aptomo3tydls rmu snt0trxnmo3oydom rlueo t)t2uoxo3oydamtemfesa(  2rmu oou4olx  icildfm rm(mp;t4tltoxocoa1lp eaivi s0truo(m3oydlm emicilt a2trum ;u4tpx io3ild m2ra(mont) exoir3oydoatr ueo;t seuoxm3oy1omeelnctas)sruax o;u1olxnio3ias m2um(mp ()treomrcoydom rau i s) rurxm io1am  mfeias) Dtaxroou4oetn fciasla um( p (0texnxr3tydfmteanei;s)trxr(o iu1omenliei sf ruax pno4olxomoeiytls2emu pnt0aeenir3iotfm  ai ol(0 euoirpio1lme  nviatfsrtr(mpnt1oltnmi3iytlmDuauvs;t0aexoio iy1lmD anei;t srumirpoo1op nmfesas) ruax ooo1apx  fctydfs2rauvont0altrio3oydlmtrai i t  2tmxopoodll emfetls)arrruro;o4tex  fetyd m2emn o () lxrmocio1lat  neil(  rxoio ny4lp  mncs ()srrmu ooo0oet iiciad aDeanmo t)trtoxfcoy1opDeln i (  eumxr3iy1amtemies t  Durumono4apxnmoeiat mDrm(ms ()trenxrcoy1fp   u ol()s2um(o no4lptnmiviasf 2ra(root4apxomfeiydfs2ranmp t0trenir3io1lmt livo ( trtr(m oydlmenmnei s  rtrxm ou4tet miciysfm eau s u4alenxo3ty1fm eaueil(  2trxm oodale mnvtls)s2uax ont1aetnifetat aDumuvsnt4texnir oadfaDeli sls0t2tr(m3oudllenlfctl(f rta(mpoo4oet  ietldfa rmuvo ()aetnio oy1lp r i o;t0seumio iu1ap elfcsa( a2rm(monu1apt  ieiytfaDrln o (0artrxoctatlmt aiei;(0 ruo(m ny4om n ncsl(fsDua(mooo4aee  fetas mDrau p;t4 etnmfciydla rlies;t  etrxrpnudlpt lfetat a2um(ro;u1alx mictlsfs2rl( onu4texoir ootlpDelies t0setr(r3oy1lmt mivsa()aDra(  nu4tlen fetyd mDrlumsn(4altnmr3oodoat  ivi t  2xm(m3iy1omtelnei t) Draxm ou1opxn o3iaslaDrm( s ()tlenio todfptr i ol(0sruoxo oy4amtemfcsasfsDum( pno4opx io3tas s uluvo;u4 exnxf3oy1omDrauvols  eum(m iu1lmt mict (fsrtru o;o0tlx  i3tlsfmDrmnvo;t4trxnio3oodfp elivo s)setoxopiudom  mivslsf Durum ;u1apxomictltlm ra( o;t)tetrir iytomDe nvs s  rtm(m no1om  mnvsat aDtrur nu0tee  f3ild a rluvpnt)areoifctotoaDeli s;s)texmio3nudomeelnvs s arrrx p;t4ale  feiasla2ul( s;t4 rxrioctatlaDeai o;s0t2tm(r3iy4aptelfvia(f Dtrum ou4opxomfcilt m2rmnmp;u)aetrio iy1omDranei (0t2to(rpiu4op elivta( sDumum oo0aptn oeiat sDulums;()treoxo tydomDrlu s;t  etrio3oo1om  mncs s sruaxrpou0texnmf3tls aDemnvs u0 etrircoa1oa raueo ()seuoio3oo4oleemncslt) 2ra(m ;t4oee if3iltlsDumu o;(4tlerxo3ty1op eai ol() etoiopno4om nlieils  2rm(m ;o4oltomoctydfm ulnvo u)alxrxr3iy1fm e neo t trurxopno1lpen ietls a2taur ou1olxnmo3iyt m rm(mo;t4trtrif totlptran i t sexo(o ny4omte fcsa( aDtru p;o1apeo i3ildla2emu s u4 ltnmf tytlmD  uvi s0 ruoxo iy1lle  iet tf rtmu poo1oetomieild mDum(vo u0 rxomfcoytomt  uvo;()srtmim3iy1am e fcs tf rumxm no4tee ii3iytfa2rl( s t4 rtnxr3iatopt  i slt) euriopnu1olee fvia(f rtaurpno1alx mfetls sDemuvp;u) rxomr3iytomtranvols) rxm(m3no4aptnmnciat a2tmur nt1alt  f3iat a2eaumo;u4teerifciytop   n i (0t2xr(o oudaleemnei sfarrm( o;t0aeeomociadla emums t)texnio3oodomtelu sls)t2xm(opny1opt livt s  Dtrxrpou4aexoii3tld a emuvo;t)teeomf3tytlm raivi s)s2xr(r oo1omtnlictas)aDra(ro;o0aptnif3tls sDeln s;u4alxnxociytfpD  nvi s srxo(o oo4ol nmict s)arrm(mp;o1alt io3iydlsDemn snu4 lxomf3ia1lmDr nvi;t  2xoirpiudol   ivilt)a2ua( ono1opto f3tlsfa2ra(ms t4 lxomr oa1fmD  uvslt0trtmxmpno4om emncs tfaDur(roou0aptn i3tatfm2ea( ont0trtoio3todfm e u s (0seur(m3iu1om emicsa() 2tauro;t4olenmiciyslmDea( p;(4trxnio3tatlate ies t)sexmxo3ou4al  lncsl( sDrrurpou4apxoiociydfm2umnvs () renxr3iytfa  lues;( tetmxo3no1lm n fcs sfsDrr(rpou0oex moeiyd s2ua(vs;()arerircoadla rlu s;(0trur(r3oydam nmnvtl(f rrmurpnu0tlxomfeiyslm ua( snu0trxrxo3tytlp  au o;t)teuoxo3oudolen icia(  rtrum nt1apt mociysfm elnmo;t) ltnmrcootoa  aieo;() eum(r3ou1lp  mnvil(farra(ro;o0olen i3iydfs eluvo;t4trenxrciy1oa eai s;(  2trxr3ny4lpeemivsltfarua(m oo1oetomi3ilt a2ul(msnt0aexoxf3io1lptelnei t0s2umxmpoo4lmenmfvslsfs2rrur ;t4aeto o3ilslaDrmnmsnt0texoxf tytlmt aieslt) 2xm(m3iudal nmicil( sDrrxrpoo1tet  i3ild s2ua(msn(4aexoir oytla  auvo;()sexoxr3oodam elfcsltfaDtmur oo4tpt ifeiydlm2ranvp (4texnxo iotfptr ivol() 2xm(mpou1optelfcslt sDtax pnu1apeniieiytlaDemums u0 lenmo3oo1opt luvo s)srxmxrpoo1ome  nvi t  Dumxro;t1tpeo f3iyd a ua(vp t0arenxr oydopDeau il()srum(o ou1apenmnesas)arta(rpnt4opt ioctaslsDelnmp ()tltnio io1lpt an i;s0 exrim3no4lp e ieils aDrrumoot4alt mietlt aDulnmsnt)trxniocio1lpt luvil(  etmxm ny1am elfct s aDua(rooo4teenii3tltlm2ranmp;t)artrxo ta1opt anvi;()s2uoxr no4am  mieslsfs2raur ot1tltnmociyd a rl(ms;t)teermf ia1fa eli i s) 2xoxo iy1openlnetl(farrrur ou0tpxnioetltfsDrmuvp;(0 rxomrctatoaDranvolt0s2xmim3no1llen nvt (  2ur(  nu1alt mieiatfs rmuvpnu4tleoifciotlpt  i i (0t2urxo3iu4ll   iciasfs2tau o;u1aptomoctydfm2ra(vo;()texoxo oa1oaDr uvo;t s2urxrpiu4al e nvsas)srrrx pnt1olx  fctldls2umu p;t4alenxr3oatlpt lnei ( s2tmxrpnu4opee ivilt aruax poo1tpxo fetyslsDuan o t0 exrxo oydfptraivs s) eurim ny1lmtnmfvil()aDtau  ;u0tltnmfeiyslaDem(vp;u4 lxrxo oydlmD luvil( trtm(rpoy4op nlicsas)a2rm(  no1tpt ifciysfm2rmuvo;u0tlenif oydlateluvi;s  exo(o iu4ape mncslt)sDurxrpnu1tlen oetyd s2ulu s t4tetrxo oodfat lu ils0 2xr(m nu1ol n ncta(f 2rmum ;t0tptomieiytls2rl(vp u)trxoxrciadop rlnvi;s0trumxo no1lmtemieilt aDtmx p;u1tpx mietys m eaump () eeomo3io1fmDe ivsls0t2uoirpio4lp emnetlt)arrr(r oo1aleomfetltls eaumont4 eenmrctydopteli il(0trum(r3nudaltnmicsat s2ta( ont4texnifcils mDrl( pn() rxoircoadfaD  n ol()t2uoxm3iudaltn ivi ( arurx pou0apx mo3ildls2ul(vont)tltoir3oatfp ranvo;t0 exoimpiydalenlnet t a2rmur ;t0tetn oeiatfs2ra(vp;t) leoxocoy1om elieo s) 2xmxmpiodlm e fetatfaDra(ro;o1oltomoeiatlmDea(mpnt0tlxrmr3tytla rlivols0t2xrio3iu1al nmivil(f Durumo;t0tptn f3tldfaDrlnmp;u) ltnmo tatopDrluei;()s2urim3ny4apen neslsfa2taxmo;o1apx ifetyd m2rln s () exrxo3to1lp   n s;t0trur(opnu4oltelietl()aDum(m nt0tetoif3iytfs ua(vp t4 eermoctodlm rln ols0seuoxm oo4omt lfct sf Dtaxmonu0oex ii3iyd mDuln s t0texoir3tydfpDr uei ( teto(o nu1ale lnvilsfsDtru p;o1opt ifciat sDrln o t)tetrioctydlatranei (0 etm(rpiudlpenlictl() rtrxmp;t0tptoio3tldlsDum(vsn(4 rerxr oo1omt lies;s teum(o3io1altnmieslt artrxmo;u4opxnif3tls a2uau ont0aexoxf oodoptraueo;( t2xr(m3iudapen fci s)artm(r nu1aee  ieiat sDum( o ()aexrio ta1fa  lu ilt srurxm ou1lptelnvs t  2rrur ou4aexomoeilt m eanvo t4tetnir3iadfatelies;s0srurir3io1ale mncilsfarur(  ot0tpxn i3ildfa2ua(vo;u)altomrctydfat  u s (  rurxopiodal emfvslt srururpou0openiictls sDum(vonu)aeeoxrcia1lptraueolt)trtrio iy1am e nvi t  Drr(mpoo0oex ifeiat sDranvo u)tlenmr oytopDelnvi;t)texm(m3iodamt lnei t) Dtau p;t1olxomfciyt a2umnvo t0 ltrxr ta1lmDrlu sl(0truoxr3oo1am   nvsasfsDtaxmpnt4oltnioeiytlm2rm( on()aeeoxo3ta1fmD lnvi;t trtm(rpnu1lle  neiat aDrm(  ot1apxniociydlsDel( p t4artoir iadlpD  iei s  rumim io1amtnmfci (f rrmx pnu1opxnioeiat m ulu p u) ltnmo3iodfaDeai o t)trtoxo3iy4altnliet t s2tmxmpnu0tlxnmieiysls2el( pnt4trtoxr oa1opt auei (  2urxmpiodam n icsat) Dra( pot1ope io3iltlm um(mp (4artrio oytlp r n s t0 exmxr3oo4aptn icia()s2um(mooo0aleoifeilt aDuluvo ()altoircoatlm eauvils0texoxo io1optemivt t)a2rmuro;t0aet ioetls mDra(monu0 eeoxr3oydlaDraiei;t0 exmxrpnudlltnlncsl(  rraxrpoo1ape  ociytfaDum(vsnu0 lxriociotfaD  nvolt t2xrxrpny4ap  mncsas a2uaxmpot1tex  octat s elnms ()alxnmr3oydoptrauvil(0t2xoxm3ny1omte ieiasf 2uru  ;o1olenii3tatlaDrmu p u0artnxocoadfm r neo;( sexoxo3oodlmtnlivta( srrr(mp;u4tlt  i3ilsls2um(ms;u4tetnxo oy1opteln sls0s2tmxr iodapeemnesa(  ruaurpou0opxo octltfs2ua(mo;t4trtoio ia1oaDe ies (0trxoxmpou1aptemics ()s2urx pno4opt iieils a2emuvo;(4aetrxrctodoaDrlu ol(0 rtoir oo1ameemfvi sfarrrxrp;o1alenmietlt a2rl(vpn(4trtoio3oytlm  lnvol() etr(r3iy4lptemnctat)sDua(rpot1ale mietyslaDrmnmo u4 lenif3ootoat  i ols0 etmxm nu4amenlivs (farrmumo;u4oex moetydfa rau p t0 exomf tytfatelivil( srtmxmpiodlmte nei t arrmxm ot0tex iiciydlmDuaumon()teeomr3ia1op   ieslt trtoxrpiu1llen feil()s2tmum nt1opeoiiciasfsDrmnvo;u0texoif3ta1fp r nvi s0 2uoxopoy1ome lfes s)arua(m ;o4aeeoif3iadlsDrmuvs;(4aeeoxf iydom r nvsl( s2xo(m no1ole  nvtas)arumuroot1aexomi3tltls2rmu o t)tltrmr oo1lmte i ols)texrxrpoydomt mnes t artrxmpoo4opx  i3ildls rm( snu)aeenmf oatoa  aivol() exr(r3io4alt mnesatf 2tr(ro;t4oet iocils a2uau o;u4teenifcoa1lat luvi s  2tmim3iu4altnlfvsa(fs2raxmoot0tetomfeilslsDea( s;u)alxoxocoytfa eauvo;s)t2xrxm3io4op emnesatf 2umumonu0tlx  i3tydfmDean p;t)trenxfctodlpDeanes;t0tetrio nodlltnliciatfsrur(rpno4olx mictlt m2uaums;(4 rxnir oy1oat  nvil( s2xmir3nydop  lfcs tfaDum(roou4oetn fciyt s2emnmo (4 lxnmfctotlm rlu i s tetr(m3nudllenlfcslsfsDua(mp;o0tpx  feilsfm rmnvp t4altnir totla rai s s sruo(r3oudlpt  ietl(f rtmxmono4tex ifetat m2rauvs t) eenirctydfa ranvo;s)t2xo(r iy4am   ivs (fsDrm(ronu0apx mfeiltfs2ul( sn(0tlermr iy1oatr ieo;t0texmxmpou4lmtnmicsls)srrm(rp;o4olxo ocilt aDeanvs;() etnmociadlmDeaiei t trurim3oo1omte feilt sDtrurono4altn o3ilsfm el(msn(4arxnmfcio1fpD livolt0tetmxmpiydolenmnei s)aDuru pou1teen o3ilsfsDran s t0tlenmf3iotfmDeauei;t0t2xmio3no1lmtnlfetas)artmxmont0optomfetlt aDean o ()aetrxrcio1fpDeai o;t)srxrimpny1ll emnesls aDum(moou0oeen ieildls rm( s u)arxrmr3oy1laD  uvi ( tetrxmpnudale  ieias)artmxmp;t4apeoii3tltfa eauvs;u)teenxr3oydfa elues;(0sruo(m3oy4omt  fvtasfsruaur ot0olto ieildfm uauvp;t4altrmf3oytfmD aneolt0s2urio3oy4lm   nctas a2urumoou0olenmociydlsDumnmp t4altoxr3iytfp elivi s tetmxo3oudamtnlicil()aDrau o;t4aet iieiltls emnmp;u0 etnxo3iodlm eauvo;s) 2uoxr3oydlme  iesa(  Dtr( o;u0alx mociatla rmnvp;(4alxnio3oo1omDeaneo s)s2xrimpoo4ale mfvi s  2uaur nt4aleo feiydlsDeanvo;(0teerir ia1oatrlneo;t seumxo3ou1ll e nctls)srumx ooo1tee  f3iydfs ua(vp;u)trxnxo oa1oaD lieolt t2to(o3oy1al emnctl() rrm(rono1alt  ieiadfm2um(mont) renmo3iotfm e uvo t0s2xm(rpoy4al n ieils) rrmxmpot4oetn ociydlaDelu o;t0 etrir3oydfm raivilt seuo(opnu4omt lfciat  2trxm no4ole ifciyt sDeln p;t4artnio3oo1laDr ieilt0trtmxo3nu1ape mics ( srrrum ;o0aeto ictlt a rmnmo u0tetrxrciytfmDr uvo;() 2tmir3oy4lmen fcils)s2trx oot1olxnii3iltfaDemn o u0teenxf iytoptr i o s trxr(r3nodlm e ncia()a2um(ront4aee mieiat a rm(ms (0tlxoxf iatfa   i olt s2urim iu4ll nmfctl(  ruau ont0opeoio3tatfs2ran p;(0tlerxo io1oaD lnvs;s)setrxo3ou1lmt lfcias  Dtr(mo;t4openmictad aDrlu o;t4 rtoxfciytfpDe ieil()sruoxr3iu1omeelfvtat)aDumx o;u0opeoiieiltfs umnvs (4trerxf ty1lmtelneo;t)trtoxopiudll   fvt tfsDtmu  ;u1tpxo o3iyt aDul( p u4 rxomf ta1oatr ues;(  2tm(m3ou4ll n feslsfsrur(m ou4olxnif3iys s rm(vonu0 lermo tytlm rli ilt0t2ur(rpnudom  lfvia() rtrxmpoo4tex  iciyslsDeln s (0 rtnmociydoatr ivo s0srtmxm nu1apt mfvslt s2um(rono0tpt if3tyd aDeln p u4trtnxr ta1lp elu olt  2ur(opoodalenlfcsl( aDta(mont4oee miciydlsDrm(vo u0aeeoxrctatlp eanvs;t0s2toxr iu1ap e ivtas)srraum ou1oex  fetyd s2eanmpnu4 reoxrcootfpDranei;t0srurio oudopeelfvs s  Dtruro;t1tee  i3ilsfs2rl(mpnt0 exrir tytopDr ivs ()tetr(opnodopt lfctl(fs2uru pot0olxn iciyslm2ea( o;(4altrxrciadfmD  ueo;s seuoxm ny1lpte fcsat artr(  ;u0aleoioctas mDel(vo;u0aeeomf tytfa r nes (0seuoxo ou4op   nvt s aDrmxmp;t1teenifeiysfm2eau pnu4aetrmr3iotfaDe uvi s)trxoxm3io1olee fcta() rumxmp;t4tee mictlsfa2elums t0 rtnmf3oy1lm r ueils0 rur(o oo1ale lncsl(fsDrr(rono4aet moeiad sDuau snt4 rxrir3totomD au o s texrxo3no4op  mnci sf Drrxrp;o1optomo3iys m2ean sn(0alxriocoo1omD lu i s0teurimpno1apenmfvt t) rua(m ;t0tlxnmoetysfs eln p;(4aexrif ta1fp  lieo s  etrxopnudolt lncsls  2uru ooo4aptn ociatlsDran s;(0alxomf iadoaDraivo ( trxr(m3oodopt  fes tfs2ta(ro;o0apxo iciatfaDrau pnu4tlerxocoa1la r neilt0t2tm(o iu4ape mivias)sDraxroot0openmfeiad mDelnvs t4trtomo3ia1lmDrai s;( t2to(o3ou1opeelfctat s2um(mont0aptn octldls rm(vsnt4tetnxr ootlpt lieilt0sexm(o3nu1oltn nciatf 2rrxmono1olto fciytfa rln on(4aetrxo3iytlmD  nvs s)sexr(o3oudameelicsl( sDtax pot1aeeomi3tldfsDem(mo t0artnmf3iadopD anvil(0trtmxmpnudlmtelnetlsfs2tmxronu1altoiociydla uanvonu4 exomr3oodlm   neo;( trtrxm3oo4lmee nvsas sDum(ro;u0olx if3iltfs2elnmo u)tetnxf ootopt luvolt t2tr(r nodapeelieils s2tmurpnu0ape  icildls2elnvpnu4 eeomf3tytoatran olt)teumxm iy4altelnctat  2tr(mono4tpeoif3ilslm2ra( s t0 lenxfcto1lp  an sl( s2uoxo3oodopt lnct (fa2tru  ;o1ale ioeias mDrmump ()aeenxfcio1lm r nvol(0t2um(o3oodomee fetlt arraumo;t4oexomfeiysfm umn s u0 lenxrcio1laDelivs (0t2umir3oy4om   icsls)srrrx o;t0tpxnmoeild aDua(von(4trtnxr oadfateai i ( trurim3nu4lp   feias)srtmu p;t0tpt  o3iyt m umumo u0arenif3oatla   ies s0sexrirpoodop emfvsat sDtruronu4tpxniictysfmDeau s;(4tetomo oa1oaDeaieols srto(r oydam e nvias) 2rau  oo0tpen oetys sDel( pn(4aetomr3ty1fpDeaueo;( t2xrxopiudllen ivi s) rtr(ro;u1alenmieiat s2ulump;(4 etrir3iytomte u il()trur(r ou1altemfcslt) Duaumo;o1oexn i3iyt sDuanvs (0 lxnxfcoodoa ean s;t0 2uoim nu4lpeelfvtat sDtaxront0optnmi3taslm rm(vp;(4 rtnmrciy1lmt  uvslt texrxo oydolee nvslt)s2uaxr ot1tpxnmi3tldlaDem(vont0 etnxfciatlaD  i o s0tetr(m ou4omtelneslt  Duaxmpoo0tex iieias m2uln s;t0altnxrcto1fpD aies;s0srtoio iy1optnlnvsltf rurxrpnu0apto i3tysla2emu snt4tltrxf3iatom   n s;()trxrir3iy4oltnlnei s arrm(  nt4tet mfciasfsDulnvp t0alerio oy1lm rlueolt)s2tm(r iu1amt mneia(farururp;t4ope mfctyd mDel(vp;u4 ltrmo ta1laD aivi t0t2trio3no4amt miet ()aDua(  oo4altoifetyslaDumuvpnu0artrmr3totfmtelnei;(0 euoirpiy1aptnmietls sDraxmpot4tpt io3iadfsDran snu)tetnxf oydfmD auvi s0trtmir3no1lleelnetlsf Dumurpot4tpeoiicias aDuanmo t) ltrxr io1opDrluvi;( sexmimpou4ap  mivtas aDra(rpot0tlenmieiatls rl(mont4alxrir3oodomt lu s s  exm(rpnudlme licsls) 2tm(monu0tltomo3taslsDemnms;(4aetomo3ootom r i sl()trtoxmpoo1apenmfet (fa2ur(mpoo4opxnmo3ilt m2eluvsnu)arxoioctytopDrluvs (  exrxrpno1alte fct ()aDuaxmo;t4texnmictldla2eanvpnu)aeenir oatoptrlieils0s2umxm3oy4am  mieiltf rrmu  ;o1tpe iieildlaDrmnmont0aexnmf oy1op raivi;(0 rtrxr iudam e fvi sfaDtrxmono4aetn ieiydfm eluvp u)arermo3oy1lmteln il(  rtr(m3nu1opt  icsa() rumumpnu1aptoif3iadfs2ea(vo;u0aeenmfcoa1fp ean ols)t2um(o3oodapt mfvs s)s2rr(  nt4opto ietas a2uau o (4trtoxocoy1fptrluvs;t sruoiopio4opt lics (fsrrru  nu1opx  f3iltla emnmonu)tlxrmo3iytlp  an s;t srxmim oo1am  lfcta(  rumxm ou4apto o3iyd sDul(vp t)aexomf iotfmDe n s (0 ruo(mpou1op emivi (fa2tm( pot4tpx  ietytfaDeaums u0tlenio oy1fpte ues t trtmio iydape  nvi sf 2tmur ou4opx ioeiltlaDra(vont0arxnmfcio1omtrai i;t setrim3ny4lm elivils)aDurxroou4ape ioeildfmDemu o;(4texrmocia1fm  li ols  euoiopoy1lm nmnes t)s2taump;o4tee  o3tad m2rl(msn(0tlermo oy1fpD luvs (  2to(m nydoptemnvs sf Dum(m ot0texn ictlsfa2um(vo;(0trenmrcoodfm elu ols tetrir nudlp elfet ( s2tm( ooo4alxo icilslaDrmnmo u)trxrxo oydoaDe nvsl()teuo(rpny1aleemnetas  2urxm oo1tpxoio3iadls2uanmp (4altomo3oodlpt auvo;(0 exr(rpnu1llt liciasfa2ta(r nt4tpxnmocild s2rm( sn(4alxrxo3iy1lp r nvo t0srurir3oudope miesltfsrtm(mo;t0ape ioctadls umuvs;t)tetnmo3iytfmtraies (0trtr(m no4amenlictls  Durxroou0oet  iciadlm rmump t) lxnmo3iy1opD ln sls  2xr(m3iu4amt mfvi sfs2raurp;t1oee mo3ils s eluvs;u0teenif3oatlm e u s (0teuoxo ny4ol n feil( aDtaxr ;u4teen o3ilt m2uluvpnu4aexrmfcoa1fptraiei s texmxm3io4oleemnvsa() rtauro;t0aeen fetls s2umn pn(0tetrifcoatopDraivs s sexrxm nodllee fvsas  2ua( pot4aleo ieiys s uau s u4arxoxf oatlmt aiei (0s2triopnudamt lfcs tfsDur(r ;o0oee  ocild s emuvs;()tetrxfcia1oaDe ivo;t s2xo(mpno1lpen ivils)srumxm no0optnmo3iyt m umuvp;(4 ltnif oy1fp ranei;t0 2uoxm ou4lmtelfetl( a2rm(m ;o0apenio3tltlmDem( s;() leomocoytfmDean o;(  etrimpoy1lpenmivt (  2uaxmont0apx  oetyt a ea(vs;(4texnmrcty1oa r ieo;()s2urirpiy1omtelncs sfsDtmuront1tpt  ieiysfsDrau onu)aetoxf3oydlatr n ilt srumxr3nu4lptn nvsl( arrmum ;o4opt mfciltfs ra(vpnt0aexriocoa1fp   u slt0 2xoxrpiydlltn nctlsfs2trxmpno0oleo i3tltls uln p;(0teenxo ta1la eaies;s  2tm(rpny1lpenlieils aDuauro;u0tlto oetasfm umn p u4trenmo3iotfa e iei s)teto(m3oy4lmtnmnesa(f 2trx pnu4tetniietyt mDum(mp;(0 rerioctatoatrlnvsl(0 rxoxr3oudlmt lnciat  Drmx  ou0altnifcias sDumnmp t)tltnxrciy1om raies;()t2tm(o3iu1aptnlfetl()s2rrxmo;o4ope  ieiatlaDrmuvs t)artrmf tatfatr ues;t)t2xm(r oudalte iet s artm(  ;u4alto i3ildfsDrlu pnt4texomo iy1lm eln slt)trumxmpiu1alt livsa( aDua(ront0tet  ieiasfsDelums;(0 ltrif todlm  lu s (  etriopiu1lm e fes sf rraxmp;o0tee ifctyd mDrm(monu)tlxrmrciytlptrai o s srxoxr oo1omee ieils  2rrxroot1olen ociysls ulu o;(4trtnxr ootlmt  ivs s) 2tr(mpiydlp elfeslsfaDraxrp;t1teeomfeiat s em(mo;()aetoio3io1om rlnei (0 rxrxr iy4apen iesa(fs2tau  ou4tptnmoeiltls emu o u4aexnxr oa1fptrli s t0sexr(m3no1am elfvi ( a2tr(  nu1apt miciaslm2emnmo;u0texriocoydfp e neo s s2urxm3nydaleemieil(  rrm(r ot1tee moctltfs2rlu o;t4trerio3oydlmDranvs s0t2tmirpoudapte iei tfsrua(moot4tle if3iad a rl(ms (0 lxrifcoydomt livols)s2ur(rpiudopenmnciltf Drrxm oo0oetnmoctatfaDemu p;(0 leoio oytlmteau s t0t2xoxo3no4llteliviasf Drmur ;u1olx moeilsfs2ran o;t0alxrxr3io1lpDe neilt)tetr(mpnodapenmivs tfsrumxr ;o0tlt  o3ild aDemu s t4arxrif tadomtrlu o;()trur(m3oy4ope  fcsas)a2tau  ;t1olt ioeiyd m ranmsn() lxnif ootlpt anvilt0sruo(o3oy1lm   fctlsfarumumont0opxo fctlslsDel(mon(4arxrif tydlptelnvo s sruo(m nu4ome lnes t) Drmuro;o0altnmo3tadlm ra( onu)aeermf ta1lmte neo t t2toxm oo1omeelnvsa()arta( ont0tpt mieiyslm rmumpn()tetomociatoaD aueo s  rur(rpnu1am n fvtat) 2rru oot4aetnio3tasla2ean snu)tlermfctatfptr nvo (  exoxo3nydllt mivt (faDum(r ;o4oet mf3ilsfs2ea( p t)arenxo iodlmt  ues;t)seuoxr3oydolt lieiat)sDumu  ;o4oexoiociytfsDra(mo;u4aexoir iytfm eluvs;s  eum(o3oy4am nlivi () Drrxmont4ape  ietld mDuanvs t4tlxnxr ia1fm rln i;t)s2uo(opou4al nmivtl()a2taxr ou0apx iietas s2ul(mo;t0aeerxociadfa rln s;s)t2urxo3oodllt  fetl( sDtau o;o1tpxnmfetys sDul(mo ()treomf todomD aiei;( sexrxrpio1ame miviat artmump;t0alxo oetls a2emnmpnt4trxoir3tatlp   ueo t  2xo(o3oy1op elivt (f Drm( oou1tlto f3taslaDrm( snt)alxnif3tydomDe ueo ()setmxr io1lm nmnei s s2raxront4ale io3iltfa2uauvsnt)trerir3iatfpt luvs s)t2uo(mpio4aptn neias a2um(mo;t1apt  oetyd s rln p;u)tetomf3iydoa  ln ilt)setm(r iu4oltelieslt aDraum ot4alenioeiytlsDemnvo;u4tltrxo ty1lmDe nesls)srtrxr3no4om elfvsls sDrmumooo0oetnio3iat mDum( o t) renio oytopt an i s0 rtrxrpoy1amtnmieia(  2umumoou4aleomfcilslm uauvs u)tltnif ia1omt aueo t0tetr(r nodlpt  nes (faDumx pnt1aetnmi3iatfs ean ont4arxrif3tatfa e ivs s t2uo(mpnu4llenmivtasf Draum nu4oeeomf3iydfaDelnms t4teerir tydlaDelies;s tetoxo3iy4op  lfcils)a2rru ooo0altn o3tad a2eaumo;t0 etoxociydlm eln ols)sexrxrpnydal elfes t)sDurxroot4tet mietls m2ra( s;() rxrxo3oadlmtrai o;( t2xrirpoodamtnmnct t srrrumpno0oltomictyd a2umnmo;(4arxrmrciatoaD li sls0seuo(mpnudolee fei () 2trumo;o4tlxnioeiatfm2rmu o;u4aexomr io1lp   nvslt0setmxr ou4aptn iesa()a2ua(m no4alt iietytlmDum(vo t0 rtnmrcoodoat anvs t0t2umxmpiydole micsl(fs2trxroou0aeen f3tydla2umuvonu0teenirctytlm  ln i;t seto(r iodam n nvils srur(mpnu0oetn fciadla el(mo;t4art
\ No newline at end of file
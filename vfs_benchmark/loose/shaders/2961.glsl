@@ -0,0 +1 @@
+n sl( t2um(o3iu4apee nctlt s2rrur ;t1optn i3iatla elumo t0altoxo oadlpD au o ()t2umirpoy1alen ivta(  Dtm(mp;o0oeenmi3ildfmDrauvpnu0texrif oydomtrli o;(0texoxo3oo4op n fesl(fs2rmur ot1tpxnmieiytfm umuvo;(0trerxrcoadlp rln ol()t2tm(rpnydopenmnesat)sDrmx oou1opt ifetas sDeau o t0trxoxo ty1omtrlivs;s0 eurir io1altnmieta(faruau oou4tlx ifctysfs2uaumpnu)aexrmf iytoaDrli s;(0 eurirpiu1op n iesat)sDtrxm ou0opx  o3tldfmDeln p;(0alxrir tadoa  lnvi;t t2uo(m iudome  fci ()arrax pot4oexoifctatfm eln s u0tleomfcoytopt livo t0s2tr(o io1lpte ies s) rururpno0oetn i3tat m ranvo t0tltnxr oadoa rlu ils) ruoim3iu4openlicilsf 2tmx  ;u4oetoifcias aDeau p t4tetrif iydfptr u o ( s2urxm3iu1al nmfciasfaDrmumonu4tlto fciytls2rl(vs t4tlxomociotfptrluvils seurio iy4apeemnviltf 2raurp;t0olxo fciysfa2ul(vs t4texnmo iotlate ies;t  rurirpio4lptnmfetat) 2ra(  ;t1tlx ii3ilsfa2ul( p;u) etoiocoydlm elivo;s  rtoir3oudomtelnet t)aDra( pot1olxnifciatfm ea( o (4tetoxrcio1omtr ueslt seurxm3oo4ol e fvi sfsrrr( o;u1apxnii3iytlm ua(ms t0aexrxo3oydlmDr ivils0 2umxopiy1llen fcta(f 2urx  ;o1alenioctad m ean p;u4 ltrxf todopte n ilt  rxr(m oodaltnmncsas  rtaump;o4tee ii3tasfs2rl(vpnt) eerir oa1lp  anvolt0t2trxr oy1ll   fvtltf ruaxr ;t0alen i3tadla2ulnvpn(0treoio3oadlaDrliesl(0trurir3oydole mneiatf rurx o;o4tpx  oetltfa elums u0 rtnxr3oo1fm rlnvs;t0 rtrxm iu4ap e nct ( sDuax o;o0tet iieias m ulnvo;u) lermocta1omt  nvs s0s2xm(o3nu4omenmfvs t aDrr(mpnt4olenio3tydfa2rl(mp;u0 etoxr3ta1fmtelieil( srum(o oydlmtelicsatfs2trxmp;u1tpxn fctldfs emu o (4aleomf3to1fa elneo;t seto(r3nodolen fcsa( a2ra(rpno0opxnmo3tadlmDrm(vsnu)tlxrif ootfp  lneils)trxm(r no1alen iesls)aDrm(rp;t0apen ieils s um(mp;u0arenir iy1laD  uvi;s0 2tm(mpiy1llen nei s  Duaum nu0tpe  ietyslmDuauvo;t4aeerxr iytopD  uvi s0s2xoxm3oo4apee fcs s aDrru  oo4oltnifeilslaDuluvo u4texrio ia1opDelnvo () eur(m oo4ale mfvt tfarra(r ;u4tex  ictasfa2elnms;t) rxoxociydfm r u ol( trxmir nydamtemivs s  Draxr no0opeoiiciytfmDumu p (0tlxrxo3oatoatrluvs;( seurxo3ny1opt  fvtat) ruaxr ;u4alxniictlsfaDum(vp t0altnmo tytfpte neil( teurxm io4lmenlivt tfaDrm(mp;t0opto ieild m rl(vs;u)artrio3oadomteauvolt  rtoirpio1ll elnvtlt  2rauro;u0apxniietys mDrau p (0tltrxr ootlpDelivol()t2xmxmpiodolee nci t s2urum ;u1tpxomociltfsDea(vs;t4teerxfciy1fpt aiei;s seto(o nydlp emnetlt)aDtr(root1tpenifciat m ra(mp;t4alermr oytlaD  ieo;(0t2xrxr3ou4llt  nci () 2uaur ot1apt iiciydlmDraumon(0 reomf oodomDe ueo;t srxmxr iy4lpeemfcsls  Duaurpno1altnmi3tyslm2uan p u)trxrif3todfm eauei ( trtmirpny1omen ncsa( aDua(mpou4texn i3iydfmDumnmp;t4 rxrmr3tytom  luei t0 rxmir3oodop elivtls) 2uau ooo1oeenmoetytfmDum(ms u4tetoxrcoydoaD lnvi;t)s2toir3ny4lltnlfcsat) Drr( oot1olxo feiysfs2uan on(0trerif3tydfaD  i s t0setr(opiudlm  lnvt t  Draum nt1tex  i3tlsla uluvpnu) reomocoa1fateaues;() 2xrxo3oo4openlnvsa() 2tm(mpno4olenmo3ilsls em( p;t)tetoxrcoodlmt  u s;s t2uo(m3oy4opee fetat)s2uaxro;t0teeo ictlsla rl(monu0altomr3tatlmDelueilt  etriopiodamtelictatfaDraxrp;u4tpen ocils a ua(vpn(4alermo3oydlpD  n olt trto(r io1altelfcslt) rrm(m oo4aleoii3iaslaDumnvs u0 exnif ty1lp   nvs;t) rxo(opiy1lm e icils arta(mooo0tleoiieiytls ulnmsnt0alenxo3tytla  lues ()t2xmxm nu4am e ivtat a2ur( pou1optnii3ils m ea(vpnu0artrircoodlat  uei s0sexr(m iy1alte fvtltfsDrr(r nu0tptnmfeiyslmDeanvs u0altniocoatfmt  ieols0setm(m3oydoltnlnviat)sDtaumooo4tltnmoeiytfs eauvo u0tleoif3oodlaDeau ols0seurimpiy4alt lfvsas  rua(mooo0aleniiciadfaDemums t4 rerxo3tadfpt auvol(  2xrxo io4lmee nviat) rrm( pnu0oeto f3ilt sDulnmpnt4arxoir3tadom elivol() exmirpno1open fesltfa2ta(rp;o0aee  ietld aDuaumo;u0 exnio3ty1opDran ol(  euo(r nydlme  ivt () Drm(ronu4aeeomfeiltls ran s;u)tlxoxr tatomD auvo;s)t2xoim no1omeemfeiat  rtm(rono0ole mieiat s2rm(mp (4tetrmf3iotoat aieo;t0 2urxopny1op  lfesatfs2uaxmpnt0aleo fctat s emnmon(0arenif3oo1lmt  nvi;( tetmxopnodop nmieia() 2tmuro;o4tle ioetydfmDraumo u0altomocta1lm  ln i t)trxmim3iu1oltn ieilt s2raurp;t1tpx mfetls a2rlnvpn(4aexrio iotoptelivsl(0 2to(m3iydam   nviatf rra(monu1apxn oetytla rm(vonu)tltnxf oadfp rlieil( sexr(m3oy1llt mfci ()arumu pnt1alx mfeiadls2el(mo;()aleoxfctatlpDeau sls0 2urim no4lmeemnctltf 2umu  oo1alen feiydla2rmnvo;t4 rtrxo3to1omDeaieo s)trtrio3oo1om emiviat arrmxm no0teeo ociadfa rm(mp;(4aetomfctatlmDeauvi () eto(r3iudlm  lneta(f Duaum ot1oetomi3tas m el(vonu) etnif3iytlpDrli o t)s2uoir no1am   fctat s2ra(r nu4tlxnii3iltfm um(msnt0texnifcoydoa  livo t0seto(r3iu4amenmfeta(faDuaumooo0opxo o3iyd aDul(vp t4trtnxo oo1la eaivo ( trumxopnudalt lictas)a2ur(m nt1aetn f3iytfa eln p;u) rtrmociotop r i i;(0s2trxrpio1optnlfcilsfsrrmxm nt4ole ifctlt m ua(von()arenxo3ootlaDr u o s0trtmio nu4alte ncsasf Dum(mooo0apxniociys a rl( pnu0arenmocoydopteaneo;s0trum(m3oo1altemict t)arrm( ooo0tetoio3iytlm el( sn(0tltrmoctytop rlueo t  rxr(r3no4omte fetlt a2um(rpno0aptnifciyt aDrl( pnu)trerxr oytlmte i sl()srxm(m3oodale mfeias)artru pnu1ape mfeiat aDem(mp t0 ltrxr3iatfmDran o t  rxriopiodll nmiesls)a2umxm oo0tlxomf3ils sDumnvp;t4texnmrciytfa  li s;(0 exmxo3iy1al e ict t sDra( oot0teto i3iydla2rl(mp (4texrio3oodlpDelivo (0t2uo(r nudlmeelfvsat sDumxmp;u0alt mi3tyt s2umn o t4 rtrio totopDelnvi;t)t2xmir3io4ope  ics sfs2trur ou4tlt  fetldlmDeln s t)aetnio oydoaDean s t)srxoxo no4lleemfeia(farra(r ;o1tlenmi3tydfs rl(mon()arenxr3iy1om   nvil( teum(m3ou1altnmfviasf rrmu o;t1oexoifctldlm rluvs u4 rtoif3iodom elueo;t tetm(opiu1olte fciltfartr( pot4aeenif3ildfs2uau o u4 eermr3iadop eln s;t0tetoxo3ny4ll nmnet s)s2tm( oot1tet mo3iydls ranms (0arxrmociytom r ivi s)srxoxo3oodame licsa(fsDrr(r ;o4tptn i3iltls2raumpn(0arxnxr to1lpD lu o;s s2xo(opiu4oleemivil( s2tau o;u1alxnioctasfsDrau p ()teenmf3tytomD lneo s0 exo(o3iydlmt lfeilt aDua(r nt0oet  ictyd sDulumo u4treoir oy1fmt aieil(0 rtr(r3ny4lltnmicias  rtmxmo;t4tee iociad a2emump u4aexoxo3iotomDe ivs t0srtrio3oydam emivs ()srrmump;u1tlen ociysfm eanvonu0texnmf3iadlp elnvsl() 2xmim3oo1omtnlfeils)artr(m oo0oee io3tltls2raumo t0 rtoxo3ootomtelnvo;s) exoxo iodlle lfvi t) rraxm nu1aexnioeiydls2rm(mpn(0tltomf3iodomDe ueo;s seto(rpiu4al nlnes tfsDtmu pot4optn feiasfa2rauvp;t4tltrmocta1oaDeau o t srurio3oy1alee nvia(farrmumonu1olx  octldls2umumpnt4alxnif iadlatelu s t0 rtrxo io1lmt mfcil()s2uax  ;u1oleniociatls2uln o (4altnircoatopD  ivolt0sexoxmpiudol nlfesa()sDraur no0teto i3ildfm elnvont0aexrxrcoytoa   uvi;t  rxo(o oodamenlfcsls s2tmu  ;o0aeeo icilsfmDumnvp (4tlxoxfciytlaD aneo;() 2xmiopoydol nmieslt)a2tm(mpnu1open ictldla rlumonu)aeerio iatfm elieilt0s2xrxmpiu4omt mivsas) Duau  ot4tpeoioctad a el( o u0aeeoio totlp raivilt trxr(opiu1omenmiei () ruru poo4aeenii3tatfaDrmumo;()trxoir3tydlm r u s s0sexoxmpiudoltnlfeta(fa2ta(m ;t1oeto f3iat s uau ont0alxnio iatfpDe nei t) rtm(m oo1omtnmfeslt a2uaxm ;o1aptoif3ias m2ulumo (0 lxnir3tatlmDr ueils0seumimpny1ame lnesatf Draxr ;o1apx mi3iysfa ul(ms;u0altniociydfat ln s;()s2xoxopoy1al elfet tfs2taxrpou4optnif3iadlsDea(vs u0 etrmf3oatlm   ivol( t2xrio3ou1lme mnci t aDrmum ;o1aptomicildfmDra(vpnu4 rxrmf3oytlmteai sl() rur(r3nu4lptn nciasf Dtm( poo0oeenioeiysfmDrmuvpn(4tlxrio3ty1fpDe iei t)s2xo(r nu4lp  lnvtlsfartr(  ot4tpx mociyt s2elnvpnt) ltomo to1fptelnei;(0srxrim3oo1amenmietl()s2ua(moot4teeoifeiasfm ea(vp;()trtnmrcoadoatr ivols  euoim no1op  mfeilt s2ua(rpou1oeen f3tldla2rm(vo u)areoif3oadlp eau i;(0 2xoxr ou4olte neil(f 2raxmoot4tpe ifetls aDemumo;u) rxrif oo1lm elnvo ( t2uo(mpoodlpeemiesat) 2trxmpot1optn i3tldfm umnmo (0tleomfctatlmDrlu slt  rxm(r3io4opeelietl() rraxroou0tet mfetldfs2umnmo t4arerio3io1lm   u s t0 2urio iu1ame  fctl(f Dur(  ou4tpt mieias aDemnmp;u0trxrmr io1oatrlieslt0s2xmir3oo1ame  ies ()srrmxm nt4apxniieild s2uaumsn() rtniocto1lmD lnei t seumimpiudlm nmietlt  2rrxr oo1olxniocias a rau snt4arermr3oadomDeli o;()s2tm(r3nudol e fcsasfsrrau p;o0oex  fctldla ranmo t)aetnmr3oodoa e i ils0s2trxm3ou4apt  ivs (  2uax onu0ope  ieiadfa emnms (0 etrmocoytfmD  ueo s) euo(rpiydol emfvtat)sDumx p;o0tpeoii3iat aDrlu s u) rxoiocia1fptrlnvs () rtr(o ny1oltelnvsa( sruax  nu4aet if3tatfa elnmp;u0arxnmrcoy1lp ean s s0 2trxm oudapt mfcsls)s2rauront1tex iieias m umnvs ()alxomfctotlaD ln o;(0 rur(m ou1lmeemivi t)srrax onu0apeniieiydfaDemnmsnu4texnmo3tadomtr neo;t0sexm(mpou1ol  mnvtasfaDta( p;u4opxo ieildlaDrlnmo;(4artrir3oo1oaDr neo;s0trxoim3ou4lltelncsls s2raxrpno0olxn oeild m2emnmsn(4 eeoir3iatfpDe uvils0trum(rpiu1lp  lics ( a2rr(  ;u0alt mo3ilslmDemu p u4 exoxo3to1fmtr ivi (0 etr(r3io4lmeeliet t) 2tau ooo0aee  fctytfs2uluvs t0arxomfctatfa rlivsls trxr(r3ny1al  mivi () rur( oot4apenmoeiasla2ua(vs;t0areoif oy1lpte ieil()trxoxrpoy4aptemivtat  rtaxmp;o4tpen i3iys a2emn p;t)arxoxo3oy1fp e ivsl(0 eurim iy1lmtn fcsl( srumxm nu1olt ioctyd mDem(vs;u)aexomo oydlpDeau ols seto(mpno1lm nlnvsls  2tmu ooo0opt ifciltfm2rm(mon(4alenio tatlm   i s;( setoir iy1al emics s srtmuront1aex ii3tytfm elu onu) rermo totla eau i;s t2xm(o3oy4optemivs tf 2umu oot4tetniictysla2elnmpnu4aetrif3ta1opDelies;t0sruo(o3oodaptelfvta(fsrtrxr ;t0oleomfeils mDrau s;t)areomo iatom  luvs (0 rxmxmpoudope lictls  Dur( ont4alto f3tadls2em( s;u) eenxfciy1faDeauvslt0texr(o iudalenmiet sfsrrrur ;u1tleo o3iyt a rlnmp (4trerxr tatoat livo;( s2uo(opou1aleelnct sf 2rrumpoo0ope mi3ildfm ran o;u4aleoxr iy1op   nvsl()t2toxr3nu1am n icil(f rtm(  ;o0olt  feiydla rmu pnt)altoifctydlpDe ues;()texm(opnydapeemfctl()arra(r ou4aetoioctadlm2ea(mont) ltrxr3iy1opDeauvilt  ruo(opno4lmeemfcs t) 2rmu ooo0tpxnioctltlm rm(mp u4alxoir3totfmt ai i;t) 2xr(m3nu1op   iesa(farrmxmpnu0oeenifciatlmDuan onu4arxrxo ta1oate uei t0 rumxr3oydlltn feilt aDtaxrono4oetnmo3ildla ea(ms;(0 etrmr to1lp   uesl( trur(o3nu4am n fcsl() Durumooo0tpto feilt a um( s ()altoxocoodlmtraieil( sexr(o iydlmt  fvs (f rrau poo1tetnmi3ild a rl( s;t4aetnxoctytlp e i s;( sexmirpnu1opeelnvsl( aDrmx  no0tpx  o3iltls2rlnmo ()aleoio oytoa e ivsls)tetm(rpnu1lmeelfvias)sDtau p;u4aee mfciasfs rmuvont4tltrxr3tytomt lueol(  2xoim3nu4olen fvi sfaDuaur oo4tpeo feiyt aDemuvs;t)trermfcty1lpDeanvo;s0trxmiopio1am elnet (f 2rmuront1opx mf3iytfs2em(vs;()texrio3oa1om raues;t srumim iudlp emivtas  2rm(r oo0tpe  fciatlm rlumont0 ltoif3totfptrli o;t srtoxrpiu1optemnvias) rtrurpou4aex iictaslmDelu snt4alerir3oydlm  lueo;s) etmxm nudolte nctas)a2raumo;o4apt iictaslmDulu snt)artnif3ty1fmte i s t  exrxm ou4opte icsltfsrtru  nu1olx ii3iatfm rmumont0 rerxo oa1lptean sls0sexoim nu4olt livt t) 2rr(rooo4aexnioeiysla emuvo;u4altrifcty1lateanvs;t)s2tmir no4amtnlfcil(fsDtm(rpot0aet if3iytlm2rm( s t)tetnxf3ty1la  anvi;s)sexo(m nu1al  licsa(f rrm(  nu0ope  feild m2emn s u4tltomf oo1fmtrln sl(0t2um(o oydamtnmfvtl(fs2tmx  ou4teeomfcild a ulnms;t0tlxomf ootoatrauvslt)tetoxo nodllee feiasfs2rrx  ot0aeenmfeilslm elnmp;(4 reoio oydfa  au i s)trxmxm oudom nmfesl(f 2ua(moot4oeeoioetls a emumo;u0aeeomf3totlp r ivsls)s2trxr oo4oltemfvs t)aDtrxmo;u1alx  octyd mDumump u4treoxr ia1omtrauvolt) etrxrpoodam n nvsatfaruax oou4tetnmi3tytls2rmums;u)aetoif ootopD ln ils0t2uoxo oy1lltn netls aruax  nu1aeeomi3ils s uaums t) rtnmo tadlmt livi (0trur(o oy4oleelfcslsfsrraurpno0ale ioeiad a uauvp;()texnifctadom  an i s0t2tmir3oo1ape mfvia( s2umx onu0tleo iciadfa ean o;t)teenxrctadomDrau ols srtrxm ny1om n neiatfaDurur ;t0alx moetasfm2rluvp u)aeenxo oa1fmDran i;()t2umim nu4lm   nvi s) 2umxm oo1oexn feias sDrlnvsn(0artnmo todfateluvo;s s2umim oy1lm nlicsat)arumum ;o4oexoifeiatfm emn p u4aetrio3oy1fmtr uvo;( seum(r iy1lmeelnct (  rtrxroot0teen ociyd s2uanvp;u0teerxfcootoaDrlnvs;s) eurir io4llt mnvs ( sDtmur nt0ope mo3iytfsDrl( o;t0tlxrmo3to1fp e u i;s s2urir oy1am  lfeslt)s2tr(mpoo4oeeo i3iasls2ea( p;t4teeoxrciydopD  iei;s srtriopoo4lltemieiat sDumx p;u1opeomociytfmDrlnvsn(0areoxo3totfpteai s;s0srtmim ny4om   nciltfarta(  ;o1tetnio3iyslaDrmumont4 lxrxrcoy1omteliei;() 2tm(r3oodlltn ivt (farumu o;u0aexomoctyd mDul(vo;u)altrircta1fm eaieo ()texrxopoydaptemies sfsDtmxrono4tlx mi3tltls2rm(vs;(4 leoxr iadoat luvilt  2umxmpny4optnlnci () rrauront4olen fetytls2um( p u0trxnxocootfm rln o t0 2umiopiudopt mivtlt  rtmxroot4oltoiiciysfs2ra(vont4tltoioctydfpDe ivi t0srtoxopno4lp  mnei (f rtauronu1tpen ictydfm2rmump (4 etomfcoa1fmtran olt)t2to(o3ny4op n iviatfsDrmxrp;t4tpt ii3iydls rm( on() lxoxf3tydlm rliei;t)sexmxm ou4lp   ies t) 2tmxrpoo1tpxoiietlt m umnmp (4trxniociytoa eaues;s  etrxo iudape mnvslt)aDum(mo;t4olxomiciad a uanvs;u)tetrxf3oydoatrauvsls0 2um(m3ny1lptnmnesa(  2urumpou4teen oetas sDrmnmp t4tetomf3ia1fa  lu o ( trtoio3iudol  mfvs (fs2taurpoo1tptnioeiaslm uanvont4alermrcio1fateanes;() rtrxr3nydamt mfcsl(f rtmumo;t1tpeoii3tatlmDel( o;u4tlxnifciodlm   ivs (  rtoim3ny1ope lnetasfsrrm(ront4opeo ieiad sDemnvo;(0aexrxr3tytfmtelnes (0seum(opiy4ope lncsatfsrrauront4opxnii3tltlmDrau p (4tltrmr to1faDrliesl(0srur(m3nydlp nmivt ()arraxmonu0tlt mfcilsfs rm(vp;u4 rtomf ia1la eln slt srurxr3nu4ome lfvs () 2rm(moot1tpt  feiytfm2elu p u0tlenif3oodlpD  nvs;t)teur(opiudalt mnctas arrmumo;u1apt mfeiydls2em( pn()tleoiociatoptelu o;s tetmim iudlmtnmnesat)srrrxm oo1texoioctatfm2elu o;(0trenxr oatomDr i i;(0t2trirpiu4omtnmies () Dta(  nu1oeen feilt mDua(mo;u0tltrir oytlpteln i t)trxr(rpnodlmtemivsls s2raxmp;t4tpt  feiadlaDrmumo;t) rerio iadfm e nvol(0teur(opnodolt mfvs (fs2tmxrp;t1alenmfctyd m ra(vs;(4 renmo3to1opDeanvol( trto(r io4amenlivtat  2rr( o;u0apxomf3ild a em(mpn(0treomo3io1fm ean olt0s2tmxo3oo4apee fcils)s2tax  ou0texnif3iasfmDem(mo u4trenmf oadlpt an o (0sexmxo3oy4lp  mfeiasfaDtm(r nu4oetniociadfs2rl( o;u0texrif io1fa raiei;s)s2urirpiu1lpen fciltfs2tax pnu4tlx  o3iyd aDrmuvp () rxrif totop rlnei s  rxoxmpoudll nmiei tfsDtaum ;u0oexo oeilt m2uauvs;t4aexomo3oytla r nvs (0truoxrpnodlle mneta( arurxmoot1tlt  o3iadls2ulnmsnt) rtomr3tatoaD ai s;t) etrimpny1alenlietlt)s2umxmo;t0aeto o3ilsfm2ua(msnu4trtoir todoa   u olt)trtr(o iodlle mivi (fartm( ooo1aexoii3tlt sDumnvp;(4alxnir3oa1fpt au ilt)s2xoxm io1op nmivil()sDtmumpnt0alxnii3iydfaDran pnu)arenmo tatomDeaivslt) rtmxm ou4lp n fvs t  rurxroou1tpt  oeiyd sDelnmp;u)trxnircoy1fmDr neo s t2xm(mpoodlpt lncta( srua(rpoo1oetn ocild m2um( p (0altnxo3iytlmtranesl( s2trxo ou1altelnesa( srtax  ;u1ope ii3ild m2ra( s u0 eerir3iadop e nei t  2toio3ny4lm  lncs s)sDum(mo;t0ope  oeiad s2umuvo (4trtomr iytfa eauei t truoxr3iu1llt  ivta() rurumooo0tlxn f3tys m2el(mpnu0texnif iy1lm   n i t)s2uoxm no1optelfvtat a2raxr no1tee ifeilsla elumon(4trtrif tadlaDranvo t) rxoxm3ou4op emnvils srumumpno0aeeomi3iydfs2uau o;t0teerxr3oo1om  anvi s0 rtmim nudaltnmfes t  2tmu  nu4apeo i3iys a2emuvo ()tetrxo oadop  auvs s  rtmxo3iu1lpenmfetl(fsrraxmp;t0aeeomi3iys m2eaumpn(0tlenxr3oy1lmteai s;s)t2tr(opoo4op nlietas)sDtrumooo4oexomi3tas m2rauvo t0 ltrif3oatfm e i sls  ruoxrpoy4ll emnci s s2uru o;u4olxomf3iytfm2el( o;(0tltnmocoodfaDranes t)texm(mpou1omtnmics ( arrr(  ;o1tpx mfeiytfsDuln on(0 eenmo oatfateluvo t)t2urir iudll e nvt s s2rmxroou1olx  o3tas m2rmnmp u0tleoxocootfptraiei;s) rxmxr3oo1optnmies (fs2ururo;t1aptomo3iadlm2umnmonu4alerifcty1fatrln i t srum(r nydllt lfeta( aruau  ;t4tet mieilsla uluvo;(0aetomo3ty1fa r ieo;(0 2tm(mpoydaltnlfeia(fsDrm(m no0apxnmociyt mDum(mp;(0tleoir ootfaDeaiei s)s2xrxopiy1ole  fes tfsDtrx o;u1ale io3iadlmDranmo (4tlenirctotfa  anvi;s0texrirpnudop emfci t)a2ta(r ou1oleoioetytla2emnmp;t)artriociotopDeauesls)trxoxm3nydolte fct s  rur(m oo0olt  o3tatlaDuauvs;t)tleoir3tadlpt lnvi;(  euoxr3oodlmtnlnetasfsrrmu ont4tleomoetltfmDemnvon() lxoxociy1fpt an s s0 2xrirpoy1am  mfvtat  Drau  no0tltniieias a ea(mo (0aleoxr tytlptrlieils sruriopoydopenmicilsf rrr(ront4aex ioetld a rlu pn(4tlxnif3oa1oatr ivsls0 2urim3nu1lmt mnvsat sDtrx poo4aetnio3iatlmDem( pn() lxnxfcto1fmDelnvilt0trurio3iudopee ivtasfa2ua(mp;u4alxomocilsfm ranvs;u4arenio oy1omDelueo;(0 etrxr3oodlpe mieias sDrr(r ;t4aex mi3tldls2rlnmp;u4 eerxfcoydoa elieo t  2umim oudlm nlici sfsDrrumono1teeomociyt aDrluvp;(4aetoxrctytlpte uei s) 2toxo3oy4opte nciatfartrx  nu0aptoiociltfsDuluvon(0tlxomo iydoatr n ilt)trxmir nydamt  nvtat) 2ra( ont4tptn fctltfm emu s ()tlxnxrctodomD ai ils0trxmim iu4amt liesatfsDrmur ;u4tptomo3ilslsDelnmpnu4 rtrmo ootfmtrlnei t0 2trxo3nydamtnlfet ()aDuaurpnt4tptn oeiyt s2ean p;(4 eermo io1op elneo;s) rxmxo oodolt lieilt  rrax p;o0tpto ietytfm2elu p (0 rxnxf to1laDe i il()trurxr3iu4om e nvtls aDuaur nu1alxo f3iyt aDrl( ont)tlenmr3ia1faDelnei t0s2umxr nydop e fetlsfsrtr( p;o1apxoifctas m2ran s;t)alxomf3oo1laD  ivs;t)texrxm3oudlpe lictatf Drr( p;u1olxoio3iasls ea(vpnu0texnmf3iodoa r n o () 2tr(opoy1opeemfvtls)a2ta( oot0oleomi3iaslaDrmn pnu4tltoio3iydopDe ieo s0 2uoir nu4lp   feslt) rum(r nu0oetnmoctltfaDemnmpnt0arxrio ootopDr ivs;t)trur(mpoy4omtn iesas)sDtrx ono1tlxoio3iat s2ranvo;t0tlenxrcoa1fmD aivo;t s2uo(r3io1apeelfvi () 2taxmpou1tlxn oeiys aDrmnvsn()aeerxrcoa1opDr ies;s0teto(o oy1apeemncslt) rur(rpno1tpxoiociat s ean pn(4 exrmf3oy1om rlues;()sexoio3oo1op e fcsatf rur(rooo4texo f3ilsfsDea(vsnu0tlxrmf3oadomtrlneol( s2uoxr oy4oltemneils)aDtr(  ;t4oeen f3ilslm2ra(ms u0tltnir tydomDrauvi (0srxrio3nudlpt lfctlt)a2umxroou1tpt moctltfa2rluvs t0tlxoio oa1fptrlu sls  etmxopou1op e ivsasfsDtrxro;t0opx  ociadfa umu s u4trtrif ta1oaD  n o s sruoxr iydopt  fcil(fsDrruronu1alx mfciltfs rl(mo (4artrmocoadomD  nvo s0 2toirpnu1ol e ivs tf rtm(m no4aetn ociysfs ua(msnu0tlenxr3ta1oatraivi t0truoimpiy1apeelivt ()sDurx pnt0oexo ociasfs2rl(mo () rxrxo3ta1fpDeln i () 2uoxr oy1ap n fcs sf 2um(mp;t4olenifeiyslm uanmp;t0aexrif3tatlmt aivi s0s2um(r3oo1olee iei tfarum(r ou4ole  ocilslmDemu s;u0 rtomf3iy1lpDraivi () euoirpny1ll  lfct s)a2taxm ;u4tpt mfeias m2uaumo;u0altoxr to1fptraivi;(  rxoim iu4am n neil(fartm(r no1optnioeild s eanvs;()tleoxf3iytlaD ln s;t0sruoim iy1optnmnctltf 2ur(m ou1aetn fetatls2emnvsn() rxnir iatlaD anes s srto(o3iydlm elneilt  Drm(mpoo0oexn o3ias sDrl(vonu0tlxoif3iodom  an ils0sexoimpiudom emfetlsf Dtmumooo4tpen oeiyt m2eau onu0artnxocootfatranvo ()t2xoir oo1ole  ietatf 2tr(moou4oetoifeiyt s eanvp;t)alxrifciy1fateaiesls)trto(opnudope mfvsa(fs2umum ;t0opt mf3ias s ranmo;u)aetnir to1faDranes t tetmir oo4omt  iviat  rua(r ;u0optnif3tyt aDem( p (0tleoifcto1lptrln o;t  2uoxmpoodale  fciat)sDtaxr nu4tex  oetysfsDua(mpnu4 lxrir3tytfat  neslt)t2xrim io4omte iciat srtmuro;t0teeo i3iytfm emnmp;(4tltrxr3ootoptr nvs ()s2xm(r3iudolenlictat  rrmur nt0altomo3iyt m2rlnmonu0aeeoircoytopDe ieol() rtrxr3nydopenlivtlsfsDur(ro;t1tex  i3iyd s eanmo;t0aeenif iodfmDeauvs t)teto(opio4lpt mictl( a2um(r ou1tpe  i3tltfm2ul(vpnu0teerio tytlptr neo t) 2xmxr3ny1opeemncta( s2uaumoot0opxo feiytfaDumu s;() exoxociotlp eliei;t)truoim iodllenmfeias)sruaxrpoo4tee iociadla eln o u4aexrxociatfptrlu o;() 2toxopiy4altnmicilsfarta(moot0opxnmfcils a2rm( o u0 rxrxo iatlpD  n i;()t2urxo3iu1opt lfct (  Drrxrp;t1tpxn oeild s2eanvs;(0 etnxf iotfp   nes s srumxrpiydlltnlncs tfa2ra(ro;u1teenmoeiad a2elu p (0altnio3oo1lp rau i;s0sruoxo ou1lm nmfet tfs2rrurp;u0oexoifctyslaDraump u0 etoio iy1oa e ivils0 eurimpno4ap elies t  2tm(mpou0tptnmfciyd m ua(vs u4altnxoctotlptrlnei;( s2xo(m3iu1ap n nviasfaDraurp;o4tleo i3iydfsDumn o t) exoir tydomDraieo;() 2xm(m3iy1lpenlfcilsf rtau o;u1tex ifcils mDuau onu0aexoxr tatlmDe n ol()trtmxmpou1amte fetat a2trum nu4alenifctyt sDem(von()arenir ootomDelivolt)sexrxm3no4ap nmivslsfarua(rpno4tlxnmociadfs rm( snt0 renxo3oydfmt luvsl(0trxoimpnydlpt lncs sf Dtmumpno1texoiociltlm elumo u)aetnxf3io1fpteanei ()sruoxo nu1oltelfes t  2uauro;t4tltn ieiydfs rmuvs u)tlenifciadfatran ols0s2xo(m3iodlp   ncils)a2rrxr ou0olx mictytfaDrmu s;t0 eenifcoo1lp  ai s t) 2uoxopnydlltelfctlt srtrum nu4altoiociytlaDemuvonu)aeeoxocto1opD auesl()t2trxo oy4amen fcsltfsrrr(m no0aetnmfciytfs eluvp t) rxrmrcoodopDr ues t0 rtoim ny1ap nmfctat)aDrrxront1olto i3iyslm2uanmon(4arxoxf tydlaD aies;t) etoimpoo4olte ivi t  2rm(r no1tlenmo3iyd s rmnmsnu0 eenif3ia1op eaieslt) rtr(r3ny1llt lnvt sfartm( o;t4tpt  o3ils s eauvp;u0 exnxr oa1lpt  ieolt) rtoxrpny1ap nlfeilt  rtmu  oo0open oeiytfsDeaump (0 etnio ia1lpt aivo;s)trxmir3oy1olt  netlt  Dtm(root4oexnmociatfaDuauvsn(0teeoxr3io1lm   i s;t0t2uo(mpoo1om emfei (f Drrx  nu1tpxomociltfs um(mp;u0 rxnmrciy1fpDe n olt trtm(rpno1amtnmiciltf Drax  nu4oeeoif3iltla uan snu4trtomrcio1fpDraivi;s s2tr(mpnu1om e fci t  rrr(  ;u1oleoif3tltls2ua(mp;t0tetoxo3oatlm rauvs;s0srtmxm3io1lm elfes () Dururono0opx iocild sDeanvo;(0 rtrxfcto1fptrlnvs ()srtoxopoudopeemnvilt)a2taxmo;t1aetoifetad m2emu pnt4alxnxo oa1oaDelu sls srtoxo ou4op nlfvsa() rrrx o;o4oeen ieiat sDrm( s;t)tltoxf iatfmD ai s s  2ur(mpnudapenmfvs s)a2taxmpot1tleomicilsla2eaumont0tlxomfcoo1omteau slt0t2trio3oodlptelfci s) 2tau onu0tlxomfeiadfs rm(vs;t0arxnxr3todfpDe ies t0srxoxrpiodol  livt t) rtr(m nu4optnmf3taslsDrln p (4tlxnmo ta1lm elneslt)tetoir3io4alt mneiat)arrrxrpnu1tpxnii3iytlaDrlu s t4alxomf tytom ean sls0s2to(r3nydal emfvtlt) 2rr(r ;t1olt  oeilslsDumnms u4aeeoioctydlpDeliesl( t2to(rpou4am  liesas)a2ra(  no1apx  f3ils a emuvont)tetniocootfp r u o s)s2urxrpoy4aptn nvsatfaDur(m ;o1alx  o3ilsfs uanmsnt0teenxf3ia1oaDe u ilt  rxm(m io4lm elfvt tfsrta(  nu0aleomoeiad sDul(mo;(4 eenir tadoatrlues;(0srxriopio1amtnlfvs tf Drax ono1oeeoioeias sDumnvp ()aetnxrciotop  aneil(  eto(mpiy1openmnesas)srrmu oou4apenifctad a2uanmo;()artnmrctydla rln o t0 2xo(o oy4alt lieils)artrxr ;o0oet iieiadfa2rm(mpn(4treoio3iatlat lneols)texmxo oudlm  lncslt)sDra(rp;u4teenmi3ildfa ul( p t0teenxrciydla rau s t)srtrim3ou4lltnmfci t srtm(m oo4tlenifeiyd m2ulumo;t4aetnmf ta1omtr neo s0s2to(o3iu4lmt mieias a2rmxmpou0tpxn ociltls rm(ms u)artomfcio1fmDrlu ilt0s2trxo3nudalenmnvsat) 2urum ;o0aeeo i3ild a2ul(mp;(4 etnxr3iadfm r n s ( s2umxrpio4ll nmivsas  Dur(m ot0alenmieiyd a rmn p (4artrmf tytla r ueols0 euoxm3oo1amtnmivil( s2ra(rono1apeoio3iltlsDrau s;(0 lxnmf3ootoaD li s;t) 2xmio3oydam e fctltf 2rrur ;t1apx mociydfaDeau p;(0trenmr todfate nei (0srxmxr iu4om nmiciasfaDta(mpno1alxn ictydfm rm(ms;t)artnxf tatlmD livo t  etmio3iy1lpee icilsfsrrau o;o1tleo i3ild m2el( snt) rermr io1opD aivslt)t2tmim iu1lm  mfvtls  rrax  ;t0tex moetyslsDelnvo t4tltnmo ia1lpDr nvi s)setoxrpiy4lltemicsltfa2rmu ont0apeo oetas aDrl(vp;()alermr3totom elivi;s0texmxrpnydap emnct (fsrur(m oo0altomociysfm rmnmo;u4texnmr3iydlpt an i;s)s2tmxopiudopen fvtasfa2tmxmpou0alx mfetls m rln o;(0 rtoxr3tatlpDr i o;(0 2umio ny4amee iet s  rum(mpou1ole  oeildlm2ua( sn(4tltrxfciatfateauvo;(  2um(r io4ll  mnvtl(fsDumxm ;t1texnii3tldla rm(mo t)arxnir3iotoaDr i i t) 2trxm3oo4ol nmnvs t)a2rr( onu0teen f3iytfa ua(mp;u4 ltomo tadlp  an slt0 etmir3nodllee neiat) 2rax  ;o4tpeoifciyslm uluvpnt) exnxr oytopDrln o t  exoxm3nydlmenmfvs sfsrua( poo4oleomieildfs2ulnvp;t) rxomf iatfateau s;s0teuoim ny1lle mivsa()aDtr(mp;u4aptoioctatls2em(vpn(0 lxoiocoadoaDran sl( sexoxr nydomt miesas)arurxm ot1apxomo3tys m2eau p;(4arermr3oo1oat  nvo;t0t2ur(o3iudlmte icil(fsDua(r ;o0oleoiociysfa2um(mpnu0alenmr3to1laD anes s0trurir3io1lmtn ncils)s2tmx p;t4tee  oeiasla2ra(vo;t4 rxnif to1lpDrai ilt)sexm(o iydal  mnvilt)artau p;t1olx  ieiasfs rmnvs;u)aeermocoadomtr neols s2umxm3no4llenmnei t)a2taxmont0ole ii3iatlmDrlnvs;(0 ltrmf3oatom  au ilt0trur(r no4alenmics (  2trxrpou0tpx iictltla uln s;t4trenxf3iatoa  ai o s) 2tm(r nudap  lieia( arta( p;u0olen oetls a2ua( p (0 reoio iadlat  i sl(0 rur(r iu1aptelicslt)aDua(r no0tleomicild a2emu pnt0alxoxfcty1opt  iesls)trtrim3iudaltnmnesa(f ruaxro;t4oet ifeiat s el( snt0 exoxfciytfpDrauvs;()sexr(m3io4optelfvias) 2uaurpou1apxoio3tas s2ua(vo;u4arerxr tatfpDe uvo ( truoirpnodope licsatfsDum( o;t4tpx  fctat a ul(vo u0 etnxo tatfp eaneo;t) rtm(rpoo4ll n ivta(fs2tax o;u0apxomoctysla ranvo (0aeerio oodlpDelnei ( srtrxr oo4optnliet t)aDrm( o;u1oexnmociyd m2um( o;t)treoir3io1lmtran sls0 rumxopoy4omen nvta( s2ra(rp;o0tltoio3iltfm2ul(ms;u4 rxnmf oadoat aiesls)t2ur(r3nu4olt mivtasfsDrm(rp;u1tpxniiciyslaDeanvsnt4 ltrmfcto1optr nei;s0 etrio nudllenmfvt tfarrru pou0tpeomocildfsDulu sn()aeenmo3ootfpD ai s (0teuo(rpiu4ll  mncs t)sDrru o;u1opxomoetatfa2rmn o (4 exnxf oodfa e i o;s)sexmio3no4al nmfesltfartaxmoot4tpe iieiydfs2emuvs;() renmo3to1fmteanvs t srumir iu1lp   nct ( aDua( ooo0tlenmo3tat s ra(vs (4aetnmr oytla r i i;s0 euoxopnodape mfci s a2ua(m oo4aexomoeias aDeanvpnu4 rxnmr3oadlp  ln ols0truoir3oy4optnmncsat  2tr(m ou4texoio3iatfsDeau s t0 lxomrcta1om rlivs;() 2trio iydlptn nci s)a2tmu ooo0oleniiciysfa2eauvp;(0tlenio3oatlpD ln sl(  exoxr nydal nliei tfs2umx ooo1ole io3iadfaDeanvp;(0 lxrmrciy1oa  lneo t0t2trxo3nodome  iet t srumu  ot4altnmociyt a rmn p (0texoxr3ta1fpt  uvs;t)teumxm3oudll emivias s2urx onu1tpt mo3iat s uau p (0 lxniociadfm r ueo (0t2uoxr no1aptelnctat  Dtrxrpno0opeoiiciatfmDulumont0 rtomo3tytlm elivilt seurimpou1ap e nvtlt aDtrumpou1aex ioetas mDranvp;(0aetniocoa1lmt  nvi t0setmimpnu4al  mncsl() rrru  ;o4ale  oetls m2rauvo u4 lerxo3totoaDrlneolt0s2tm(m3oodam   feias a2taump;u4aetnifcilsla uau o ()alxrmrctotlpt  i s;s0 eur(o3oodole lfvtlt sDrr(mpnt1opxo i3ildla uanmpn(0 rxnir3tytlatr ueslt0 rxoxo3oodlptnmfei s)srtax onu4aee ii3iysla eau pnt0treoio oo1fmDe i s;s)texm(opiy1amt lictltf Dtr( o;o1teto o3iadlsDulnms u4 exnir tadfaDr nes;t0s2to(o iu1lmte fvsl(  Dtaxmoot1ape  feiat m umumpnt) exrxr oa1opDraies s)srurio ou1omtemfci ()aDumx ooo0olxo oeilsfm rm(msnt0artnir3oadom e uesls0teumxo3iy4openmfvsa( sDraxmono4apen fctysls ul(mp;(0teerxociydlaDean o t trxrim3oy1al   fci s)s2taum no1texnmociad aDuauvo;t4 rtoxfciotfatrluvol( trxmxm nydomtelnvtls)artrxr nu1oex ifetytfaDrlums;t4texoxo3totfaD  u s t)texoir3iu4aptn icils)s2rau p;u1apenii3ildla2raums t0altoxo iatoateanei s0s2umim3no4lltemncsat)srtm(r nt0aetoif3tys sDeluvp t4 exrxo3ootopDr i s;(0srxmxopny4alte fes sfaDra(root1oleo o3ildfa2um(vsn(0teeomrcty1fm e iei;s  rumimpoodapt lnctasf Drrxm ;o1alxniietydla emn o;u)altnmf3totoate uvi;t  rxr(o iu1llt mnvilsfsDra(r nt0oeeoioctatlmDulnvont0 etnmocoatfmD anvslt truoxo3oudllt  neilt s2uau oou1aeeomoetlt aDumnmonu)tltoxrctydomDrlies s t2xmimpny1amtemnetls  ruaurpot0tpxoii3iad mDulu pn(0tlxoioctotfmDean i s) exrxopoo4apt lncias)aDrm( o;u0tpt if3iltfa ean p () rxnmocoa1lmtean ols)t2xrim3oudlme mfeiltf Dum(rooo1aex  o3iydls2el(vsn(4trtomo3todlmD ai i s)sruoxrpoy1ap  mneiasfaDraxrpou0oetomieilsls2rmnvp;t0aexrxr oadfpDeanvo;()seurio3no1al elivsa()arrax o;t4aee ifctytla2eau on()tltniocia1lmD li o (  2uoim no1ope lfci t  2ua(ront4tpt ii3iyslmDuan s;u4tlerircta1oat  u o (0 rtrir3ny1lm elfctlt)srrrxmp;u4olxn ociltlaDulump t)alermr oodfmDelueilt)trxm(opnodamtnlfvtl()sDrrur oo1oeen oetlslm2elnmon(4tlxnif oa1fm e uvi t)s2xoim nu1ll  mfct s  Durxrp;o0tltomfciys sDean p u4trtrxfcto1laDrln s t s2trxopiudlle mfvs t s2ra(moou0optoifciatlmDrm( s u4teenmr oatfp r ies;s0seto(o3nu4apee net ()aDrmx p;o0aeenmociatfmDra(vonu) lxrif3totfa e nei;t0t2xr(rpoodamtnlfetat  Dumumpno4tex  f3iytls2elnvpn()tlenxo iadfmDelivs;s) ruoimpou1ol n ietl(f Drmxm ot4tpt io3iysfsDua(msn()artrxo oo1fmtr uvs;(0 rxmirpnodam nlfctat)arua( p;o1aexnmi3iatfmDumu o t0 eenxf iotoat  ivil()trumxm oo1alenlieiat)artrump;u4tet io3tasfm2uluvp;(0aetomo3iodfpDranvolt trtoxr ny1lltn nei sfarraxmp;o0oetnifeiad a rmnvpn(4trxnxfciadlmD lnes t) ruo(mpou1lptelnciat aDta( oou0texnifciys aDem(vp;u4 lxnmrcto1fm rai o s0trum(m3ny1optn fcs (faDurxmoot0tptn icils sDumn o u0treoxf3ty1oat lnvo;t0t2trio oy4am n ivils  Duaum nt4aeeo o3tad mDum(vo;t0tetoif iatfp eauei;t  2urxr no1olt  iesa( srrax oot1olxn i3iad a2rmums;t4arxoxfctatlmDean i ( srur(m iu4op  lnei s s2trxrp;t0tpxnioeiysfa raump;u4 lxnmfcia1lmtr nvol( s2xr(opoodamtelnei s)aDururp;u1opxo ieiysla2rlnvo;u0tetnifctatfp e iei;t0s2xrxmpiydam n ieslt)artrumpot4teeomo3iatfa2uln o t4 exomocta1fmDr u s s)srxm(r no1altelivtl(f 2um( o;o0apx iietys mDeanvo u0 exrxrctodlaDeauvi t) rum(mpnodlmeemfvsl(f rta( p;o0aex ifetlsla2rlnmont0 reoxoctydomD lnvi;t)truoio3oudomte feiat) rta(  ;o4oleoii3iltla eluvo;u0 etoio tadfp ran i;s t2tr(m iu4aptnmicsas)s2rmumoou0oetoii3iyt m ranvp;t0 rxoxf3todla elivo t)s2trxmpnu4omen net (  Dumxm ou0texn o3ild mDeanvo;u0tlxoifciydopD anvs;t0tetm(mpoudaleelieil(  Draxr oo0oet  fetld s emu snt4aeerif3tydoa  aieil(0s2ur(mpiy1altnmietas)s2tr(mooo4apx  octydlsDemuvs;u4artrmf3oodom rli i;t t2urirpiu4amt lfvsasfsrrmx  no0tltn octltls eluvs;u4tetoxo3tatfm e uvi;t teuoxrpou4lmte ncilt)srrr(rooo4alt  oeiat aDrlnvont4 rxoxr3oa1fpDelu olt)s2xo(r nodamtn ncsat) Drrurp;o1ale mf3iad aDel(mo u0tltnxrctadomteau i;t)srxmim3ou1om  mfvtl()srtaxmpot1tetoiieils a2em(vp;(4arxnxoctotop r ieo;( sexoxm nu1lmen ivsas)arraxmono0texn i3iasfa2rmnvpn()aeerxr io1op  ln sls0setm(m ou1lp emfviltfs2raxmp;o1tlxo fciyt aDemnvp u) rxnircio1lmD anvol()seuoim3no4olen nvsasf 2rm(rp;t1aet  octatla2umnvs;t4 lxomocia1oateluvilt teuoir3oudlltemnvs t s2taxrpno4tee io3ild a rl(vpnu0tlxnmf iydlmDrau sl( texmirpno1olt  nvta()srtm( ono0altomoeilt mDelnvsnt)texrxociy1omD livi t0t2xmio3nodlme mfei ( srumu  ;t4openifeiatlaDeau s;t4trtnxo3totlaDraivs t seur(m3no4om  lictl(fsrrmuroot0tltnmieildlm2ra(mo t4aexrmf3oy1om  an o;s srtrir3no1lptnmfes s sDrmur oo4olt  icilsfa2uanvs (4aeermf3oadoa raieolt) 2xrim3oy1ame  nvslt)srtm(mo;t0tpe io3iysfa em(mont) reoio3tytfatraues t0srxoio3nudlme livslt aDtr( poo4oexo o3tasfs rm( o;(4aeenif ia1omt anei;t0s2xo(r iu1ap   fvsls)srur(mpoo0tex iiciasls ulu o;t)teeomo totfpD  nesl( sruo(r3oudapenmicsat srrrxr nt4apeomoeildlm2elnms;u)texomrcta1fm  livilt)trxo(mpiodomenlnei ( srumxmpot4aeenifciyd s2rlnvo t4 rtomr oo1lm   nvo;s) rtm(m oodope miesas sDrru  ;t4teenmieiysla2ea(mo t0 lenxociatomt  nes t srxrirpou1op emivtl(  rur( onu0oltnmf3tysfaDumumpn(0tltomr3iydlm eau i;s)t2urxr iydomeelfesat artm(rp;t4tetnioeiatfmDua(mpnt4tlxnmfcoodop e i o t0sexrxo3io4lmt mfes ( artr( o;u1tlto oeiysls ean o;u0arxoxf tytfa r uvo;s0 rtoxo3oudll emicta( s2umu onu4apxoifeias aDrm(ms;u)aexrif3oodfmDraieilt trxmim3iu4lmte neils)s2uaum ou4aleoif3tyt aDuln pnt4tltnxo3todlpDe u slt trur(r no4lpeelneil( arrmump;u4tpeoifciysfa2em( s u)tlxnxo iy1fmt aueslt)teuo(r3iy4optnmivt ()aDtr( pnu1oeeo iciyt m emn p;t4tetnmo iydlp r ivo;s srxm(m iudom nlfvtat a2rmuront4aet ifcils mDrmump;u0 leomocia1lat au s () 2xriopnydamenmfetls) rtax ono0texnmietatfs elnmo u0alxoxoctydopDeaues;(0srumimpoy4al  lncsa(  2taxr no4opeomocilsfm rmnmp;u0trtnio tadfmDeaivs;() etmiopoodap nlfvt sfs2taxmo;o4tee mo3iytlm rm(ms;t) ltoxr iy1oate u o;s)s2urxrpoy1lmenlnes t) ruaxm ot1tet io3ilt a2rln s t4 ltnxrciotlmtean o;() rurxr iodamtemivt t)s2urum ;t4texnmoctls s ul(mo t4 exnmf3totfaDrlieo ()tetoir3oodlpte ncta(farurxrooo4ope  ietydla2ea(mo;u0aleomrcoatlptean o;s)t2tmir3iudlltelieils) Drmxrp;t4opt mf3tyslm ua(ms t4alerxr3tadlp rlneils0t2xr(rpio4ape lfeia( a2rrxro;u1apxn i3iad a ua(vo (4tetnircoytom r u o;s0 2tmxrpnu4oltn nvs sfarta(m ;t1texomfeilsfsDul( pnu0trtoir oadlat  u ils0trxr(rpny1ll   ict s s2tax  ot0oltoioctaslm2ua(vpn(0tetrxociadfaD li ols  rum(m oo4lmtemneia( aDtrur ot4ole mo3tltlm um(mp (4texoir3iatlm r u o t srum(opoudamenlietatfaDuau pnt1ope mi3tydls rmumo u)alenxf iatlmDr iesls srtoir nudlltnmiet ()a2raxm ot4teeomiciydfm ranmp;t4tltrmo tatomt anvsl() rxrxmpou4lpe mfes sf 2tmurp;u0alx mociat m2elnvo u4alxoif ootfp ran il(  rxo(rpio1ll  mneias) Drm(moou4oetomf3tatls rlu s ()teermo3io1fp   iesls0trxr(m oo1al n ncslt  rraxrp;u4tetn octyd sDul( s;u0tltrmr3iotfmtrlnei;s t2xr(o3iudalenlnvsas)sDtr(rpou4tpt  oeildla2emnms t0trxomrctytlmteaivo;s setmxopiudam   fvt t) 2raxm no0apxniictatls2rauvo;u0texnxr3totoptr ieilt)s2uoio3nydlm n icsat a2tau  no4optn fctad m rluvp;(4tlenxo io1fpDrli s t t2to(opou4lp elfctls aDtrx p;o4aexoifeiytfsDem( s u4 rxnxr3oatlm  an sl(  2trim oo4optnlneia( srtaumoot0olxn ietas s2rauvo;() rerxf3oo1lptraivs;t  rxmxo3iydal nmfvs ( aDumxm oo1tleo fctadls2ra(mp;u4 ltrir oa1fa  auvs;s s2to(m3oy1omtnmicsat  rrmurooo1apxo o3tls sDea( pnu4tetomo3totfp elivs t0sexmir oy4ome lnvsl(f 2rmur no0teeoif3ildlsDuan pnt0 rtnxr3oatlat lnei s0setm(opou1op nmieiat aDtaxrpoo4tlt if3tatla2ran s ()aetomocoa1la  lu s;s) rtm(opoydolt  ivsl()artr(mpno0alt  ociyd a rluvsn(0 rtriocto1lpDeai i t0 rxrir3oo4ll   icias) Dtm(r ;u0altnifeiydla2rlums;t)altrmr totfmD  neo (0trto(r3no1al elfcs t sDrau pnt1aet  fctasfmDrmuvs;()artoiociadlat auvs s  eur(rpoo4amt mieia(fa2ta(mpoo4oexomfciaslaDrluvs;t0trxomrcoy1fmtrlueilt)trtrir3ny1ol  mivtlt)a2rrx poo0tee  ocilsfa uau s t4aexnmfciotlpDrauvs;s0s2umxm iu1al emfcs t) Drrx pno1tltoif3tyd s ea(mp;() lxnmf3iydopt anvs t)trxo(m oy4olt micil(f rrmx oou0tptnmi3ias s eln pnt)artnif3ta1fa e nesl(0s2uoxm3oudapte nvsl( s2rm(r ot0olxomicilt a2eanmp;u4tetoxfcoodomDran i s)t2xr(o3ou1ol   feias s2ra(rpno0opxoiieiaslm2em(mont4tlxnirciodoaDrlnvi;t) ruriopoydlm  lietl()srtmx  ;t0olxo i3ias sDrl(vs;t) etrxf oy1lp raivi;t  2xr(o3oudlm e icsat)a2umxrpnt4aetn o3iltlmDelums ()trxnxr3ta1fptr neo;t0 2xr(m3oodale  ncil(f rtrumpnu1olxnifctydfa emuvp (4trxrxfciodom   i ols teumir3oodalt lnctlsfsDrrum oo0aexn fciltfs eaums;(0arxnif ty1omDeln ols s2xoxo3oudalenlfeils) Dtm(mp;t1opeomi3iadls rmuvs t) leoif3oatopDr ivo;(0 exm(rpoy4al n nvtls) Dtrurpnu1tet  f3tas m2ulump;(0 rxoxr oodlpDeauvi s teur(m nu1amt  nctat  Dtrumoou4tlx moctldfs ea(vpn(4 eermfcoy1fpte n o;t0srtmxopiodaltnmivia(fsruru pnt4olen f3iyt s2umnvo;u4tetoxfciotlat  ivs ( tetmio3ou4om e ieslt) Dtax onu0teenio3tyslsDrl( sn()aeenmo tadopD aivo (0srxrxopoodlltelfvs ( arum(monu4tpenmoetaslaDem(ms;(0 etnif3iatomtrai s;s)trtr(r nydllte ncta(fsDumxrpnu0tpxoifcildfaDrl( s ()trtrifciytoa e ivs;t s2xm(opiodomtn nvsa()sDrmxr ;u1ale  ieild a elumonu0tleomo3todoate nei (0srxmxr3ou4ome lfvta()sDtm(m ou1tpe mi3iasfaDemn p t4aetrifciy1om rlnvilt  rtmxo3iydol emfctl() rrrx onu1apxoifctat m2raumo;t0alxoio ootfp ranvo s)s2ur(o3no4al n iei s a2trur ou0apxn iciad s2rmu o;(0 rerir3iodlp rlu slt t2xrxm no4llenmnvsas a2rmxrono4oetoio3iad m2eluvs t0arerif io1fateauvols0srxo(opio4apenlnesa()aruaurp;o0apx ii3tlt s emump (0arxnifctytomtranei s s2xmirpiy4ol n ivilsfa2uauro;u1aexn f3tydfa ranvs;u0trxrmf ootlm raivilt trtrio3iy4apen ietls artmur ot0oet  ieiatfsDranvp;t0trenmo3iytfpDe nvol(  eum(o iu1lp   fet s aDrmur ot1oexoiictldfmDemnmsn(0artnif3ia1fa  auvol(0 exoiopou4lp elivi t  Dtru  nu0tpxnii3tls m2rmu o t0trenxo iotla e nvols setr(m3io1amtnmfvtl( a2umxmo;o0aexnifeiasfsDumn s;()tltnmfcto1lptr i i t)s2uoxr oydamenlicslsf rumu pou4tptnmociysfsDuan onu4 rtnif3oo1fmD  neo;s s2tr(o3io4ol   ivi s)s2tax  ot1opt  i3iadfm ranmo;t4 rtoxfctadlm rlnvs s  rxmxr oy4llenlfetlsf 2umx p;o0tpxnifctldlm2umnvont4 lxnxr ta1laDrlnvo;t s2um(mpiu4ap   fet s) Drrx  nt1apxoio3tasfmDemn p;(0 reoxoctytfaDr u sl( s2xoimpoo4aptelncslt  Dumum ou0apto oeiydfa uan pnt4tetoio3tatlm  ai o ()s2umxm3oodlm  lnct s) 2tmx onu0oetn oeiys a rl(vont) eerxrciadfmDeanvolt t2xmxopnu1amen ietas s2taxmo;t4apt  oetas sDrm(vsnu4tetoir3todlmDrlu o;s0t2tmxopou1omtnlivsas)arra(m ot4opx  oeiadfa ua(vo t) exniocoydlp eai s (0s2tr(m3io4am nlicsl(f 2urx  nu0alx iieiatls rl(vs;u0 eerifctytlmteluvsl(0sexoxr iu4op elicsas srum(mpnt1texnmoetytfm um(vsnt0aetnxoctadoa r uvs;(  2urxo oy1lpe lnes (fartmum ot1oexomietatlm eaump;(0 reoiocto1opDelneo;s trumirpou1al   fvtlsfaDtmu ooo0opeo ietyslaDra(vs;() etnxf3ty1laDe n il(0s2uoiopoo1ll e fctat s2trumont1optn f3tyslsDrmumpnt)aetoxoctotlaD aiesls)trxmxrpnu4ole  ivi ()arrrur oo1apeomi3iys s rmnmsn(4 lenio todfpDe iei ( trumirpnu4amtelnvsas artrxroot1alt  oeiydls2em( s;() ltrir3ty1lm rlnes ()setoxo3nodameelfviltf Dum(m ;u4oex  fciasla2uau p;u0altrxo3iydoateaivils)t2toimpoydlltemnvsas)srtrur oo1opxomfciytfmDua(vpnt4alxnmf iy1fmDrlieols  etoio io1altnmiesa(fa2taur ot1alx mfeiad sDua(vo (4altnmr iatla rauei s0 2xmirpoo4op nlivt () Dumuroou0optomi3ild mDuaumo;t) renmr oatoptran olt  rumxr3iy1lpt  iesl( a2tr(ro;o4aetoii3ildla2rl(ms;u4artnifciatla ran o t0 rxmxm nydoleemnetatfaDrmumoot1tex moctysls2umn p u0arerxo todoa  luvs () 2xo(r3ou1alenmnvt t)a2raur nu1altoifeiaslmDrmuvo ()alxoiocia1omDe ivi;t sexm(o3nudapeemneslt sDta(rono4tltnmieild s rm(mp;()tetoio3iotfa r ieilt  eur(rpio4op nlnetl(fs2tax  ;u4texoii3iyslm eln s t0teermfciy1laD aueils)s2trxopou1opee ictl() 2urx pot4tpt iociadfmDemu o;u0 rtoif3iadlpD  ues;s0 2xmimpiu4ol nmnvi t sDurxm ;o1tlxnmo3iadfa2ranvon()tetrmr ia1omtrluvo;()srxoirpnu4lmeemies sf 2raxrp;u1oet mo3iysfmDrmu p (4artnmr tydomte nvi s0teuoim3nu1ape lieiltf 2rmu oot4tlxn ieiltfa ua(mon(0tetnmf3iydoptean ilt trtmim oy1ol nlfvt tfaDumumo;u1tpt mictadlmDrmu snu) eenmo3oydop  livs;t0 etm(m nudomeelnvsltfs2rm(mo;u4oeen f3tlsfm2emuvs () etrxf totfp rluvilt t2uoxrpiydaltn ncs sfarurx p;o0tleoioeiydls2umnmp;(4 eenir3iadfa r iei;t0s2uoir iy1om  mnvs tf rraurpnu0aleoiictys a2uanmo;(0trxrir3oydla  anes (0t2xmxmpiudomenmicsas)sDrau p;u4tpx  ociasfaDemu p;u0treomr oytfmte nvi s)srxrir3no1al  licta() Dur(  nt1tlxnmi3tatfa rmnmo;t0artnifcoodfmtr ies t)seur(m no1olt mivs sf 2rr(mpou4alenmfcilsls ea(vpn(0tetrmo3oytfp rlneo s0 2umiopoodlpe mfeslt srraumono4oex  icilsfm2emu pnt4 lenircoodoa rlnes;s0texrio3io4ap  livs s  rrrxmpno4ole  ociytls el(ms;(0altnmr3totfp elu s t0 ruoxopny4olenlnvtlsfa2rrumpnu4olx ioeiad mDra(vo () rtnio3oa1lpDe ueo;t s2uoirpio4opee ivs t arua(ronu1opt mfetasfsDeanvsn() rermoctatlat lu i s)srurim oy1op nmnct t)s2ra(  ;o4tle mociytfm2ulu s;u4arxrmfcio1opt  n s (  rur(m3iodlp nliviat  2uaxmo;t4altomfctatlm2rm( s;t4aleoxrciydlmD lneslt)trurxm no1alenlfeil(  2um(mpoo4aeeo octldlaDemuvont) eerio ia1fpD lu o;(0trtmxm3iu4ll  lnes (farua(  nu0openio3iyt s umumsn(0teerxrcoatfmtr nvo;t) 2trio3ny1ape livs ()aDuaumoou1opt mi3iys a2ua(mo t)aeenmrciadfa rai sl()t2urxo3ou4lpen feslt)s2taum nt1aet ifctlsfaDuauvp (0aeeoxrciy1fpteanei;s)trxo(o3ny4ll n ivi sfaDtm(m ou4oeen o3iltlm2ua(mont) etnxrcoa1omtr nvo t0 rum(mpou1aptnmnctls  rrau p;o0oltoifciydlm2rmnvsn()tlxrmf3iadoaDeaneo s)tetmxm3iu4ap   netlt aruauro;o1oet  ociasfsDelumo;t)tetrio iotlmteaivo s)teuoxr3iydlpee fvi (fsrtaxr nu0aexn oeiys mDemnmp () rerifcoadop   iei (0s2toxopou1olt  icsl()srurx pou4aeen oeiatls2eanvp (4aeerxo3tydomDr ueo t0 rtrir oo1lptnlivt t)s2trxrooo0opt  oetytfsDea(vp u0 eenmr3tytlmDrluei;( t2uoio oudlptemnciat a2ua( pnu1tpenii3tydfs2uluvs t)artomr3iy1om   nvsls0s2xm(o nudlmee icta()aDua(r nu0tlx if3tys sDum(monu4 rxrxf3oytom e i s;s0trtr(r ou1omtnmnct s s2uaxront1apeo ictls a2rlu pnu)teeoio ootomtrau s;s setmxrpiydalenmfviat) 2raxrpot0texnioeiatfa2rm( on(4 rtnmo ia1fmDr n s () rumxr3iodoptnlnesa( srtmxr ou4tpe moetatlm ran o (4trxrmoctodfmDe ivi;s0srxm(r nydame lnetatfsrtrxr ot4tleoifctys a emuvp t4aleomf3io1fmt aieolt0 exmim3iudap elietl() 2raxmoou4aetnmfeiytlmDuluvo (4aexomfctydoptelivs t)srto(o3no1op n icslt s2taxm ou1ole if3iydlaDuauvo;u4 etnxo oodlaD livolt sexrxo nudolee ncta(fartm(mpou1opx  ociltlaDranmont0 lxnxf3ta1om  auvi t)srxoxo oo1llte fei t srra(  ot0olxo feias sDeauvo ()aetrxrctodop  aueol( seuo(opoy1lmt lnct tfsDtau oou4tpxnmietad aDrlu pnu)tltoirciotfpDeanvils)setm(m3ny4aptnmneia( srtaum oo4oexnioeiaslm ul( p;(0 rerir iytlptelivi;t)trtrim3nu1aleelnes t sDur(rp;o0tetnmociydlaDemuvp;u0altnmf oatlmt aueilt0t2toim nu1amtn nvs tfs2rr(mpou4aex mociydls um(mp u)tetrxo3tadla   u ol()trxr(r3iy1opeelfct tfsrumumpou0tet  oeilsfs rm( o;t) lxrio3iadfpDeanei;(0trtoirpoy1omtn nct sfsrrrumono4tlxoifetyt m ra( s;(0 ltoxoctotlmtrlu o;( trtoimpiudap  lnesls)arum(  ;t0tltnmfciaslm eau o t)trerir oa1lpteai i (0seurio3iodlle mncsls)a2raxrp;o1tpxo oeilsls2eln pn() lermf3oo1om ran s;(0t2to(opoo4opt lncsatfa2ta(mpoo0olxo ocilsfs raumo;u0teermf ia1opDrli ils  euo(r3no4ll n ivtat a2ra( poo1oexomfeiysfs elnmpnt)tltnmo totfmtraivs;t)trxmiopiudale lnvtatf Duaumpou1opxnii3tysfaDrauvp u0 rxrmr3iy1lm  ln o;t  2xrxm3ny4ap emivs (f 2urx pot0optoii3tltfm2rlnmo;t0arenxo3oadoaDeaueo;s) exmxm ny4al  mnvils) 2tmu pnt1olenmietydfs rm(ms;t0altnmrctodfat anvils)trtoxr nu4lmtelnetat arta(m oo4apxn oetlslsDeanmpn()tltrmocio1oatr neo ( texrim3oy1ap nlfes () 2urum oo1tetnmf3ilsfm rlnms;t0texomo iydopDelnei s srur(r ou1lm n fetls  2umu p;t1ope  ictad a rl(vp u4 reomocta1fp rlivo s) 2xoxr no1amtemnci t) Duaum nt1oeeomoctatfmDuluvont0 etomf oa1oaDr ivi;s)seuoxr iydamen fesat) Dtr(rpoo4ole  oeiysfa emn on(4trxomo3tatlaDr ivo;s0tetm(o3iydapenlieiasfsDtmx o;u0aleomfetadfsDuln s;u0tltrxocoodlm e ieilt seumir oo1lp nlies (fs2umu oot0olen ieiysls2elnms;t)altoxr iy1la  aues;t)texmxr3iu1omt  ivia( s2rm(r ;t0alx iiciyd s2eaump t) eerir ta1fmD livo;s0s2toim3oodlle lnei sfaDumur ot1opt ii3iadfsDemu p;()tlenio oytomte uvslt) 2tmxmpoydll nmfet tfsrua(ro;o0aex  iciaslsDumnmpn(4altomf3ia1oatrlivslt0seumio3no4lp elicslt)a2rrxmp;t0tlen fciyslm2rlu p;u)tltnio3oatfat aies (0 rxmxr iudom e fct s)sDtmur nt0tlxomieiatfa2ranms;u)tltrmocio1faD  ueol(  rtrxm3no1olen ncta(f 2rmumo;t4tpenif3iadfs2rauvont)treomociatfmDelivilt0 rto(m3iy4alt lnvtat  2rmx  no0tle ioetad sDrmu ont0altrxo ootlm  li i s0sexrim3oy1ape mnetls) 2uau oou4aexniocilsls emnmon(4altomr ta1lmtraivolt t2xrxmpio1oltn nciatfarrr(  ot4tpxnioeiyd s rau p;(4teenmf tatfa ranvsls) 2xm(r oudam nmncsas) 2tmx pou0tptniietat mDemnms t0aexoio ta1omteauvs t)t2uoim3iy4lpt mfciltf rtmxm ;u1altomo3iad m eluvsnu)trenmo3tatomD  neslt t2tm(opnu1olt  fcs (fs2tmump;o1apeomoetytlsDrl( s () exrmr3totlp elu ols0s2xmimpio4oltn fvt s) rrmxroot1tex ioeiysla ua( p;()trerif iy1omDe nvs t0 2xmir ny1llt mnet t)a2tr(roou4teenmicilt sDelnvpnu)tlxoir3iydfaDeaivil(0sexrimpoy4lme lfvtlt)arrm(m ;o0tlt ifciltlaDra(vo;()texomr iadfpt lu o;s trtmim3oy4lptnmnes (fa2rr( oot0tlxnifctatfsDra(vs (4 eenmf3iodlmt au o;s  exr(opoo1op e fcia()arrmu p;u1apxoii3tatla2emumsn(0 renircoa1fmtrau o t sexrxrpoy4op emiesas)s2tmurono1tet ii3ilsfsDulu s;(0arxnxfctodfmtean o (  2xoim3nu1lmen fcslt  Dur( oot1tpeomoetatfs ulnmp u0altnmf3iatlmteanvslt trxmiopoudap   nesat aDtaxrpno1aexo oetatfa2ranvsnt0aeeoirciatlaD  nvs (0 eum(r nu4lmeemfeta(fsDtr(r ou4oeeoio3iydfaDelums;t)tltnxfcoytla e ivsl()s2tmxr3iy1al nmfvs ( aDrau onu0aptnifctldls rl(vp;u)aeeomr3iadfp eai i;( teurxo3oy1oltemfvs t)a2rm(r ;t0oex mfeiad s2ua(mpn(0trtoxf iydoa rlnvo t tetrxm ny4lp nmivtas aDrmumono0oleoio3iysfm ulnvo;u)tltnxo oy1oa r n olt)t2uoim3iudlp emivt t)aDuax pnt4opxnifctatlmDem(mp;t) rxoir3oytla rlivol() etm(m3ou1amte ici t  Dtmum ;u4ape ifcildfs rm(vs ()tltrmf tatoptran s;t)srumir nu4aleemnvslt)sDua( poo1aeeoifciydfs2uanvsn() rerifcoatfmD  neil()trxo(m ny1apeemiesl()aDuaxmpnt1tlxniieiasfa2um(mp;(0tlerxo oydfaDrli ol(0trtm(mpoodlmen iei (  rtr( pot1tlt  i3tad s2emumo ()aeenxo3oa1lm e ivo;( texoxo nu1aptelfvsa()aDtrxm ou4aet  fctlsfa2umump;u4 lxomo3tydfmt aneols0sruoxm iu1optelnvils a2uru  ;u1tpxomiciadls2uanmont4tlenmo oydlptr uvol( tetrxm3iu1lpt mfvtlt)sDur(moot0tpto iciydls2rlnvpnt0 ltrxo oodom eaneo;( tetr(r iu4am elfesa(  Dtr( p;u1ape mi3ilsfa em( o u)tlerxfcoydlptelu ilt0tetmir3nu1ll n fesls) 2um(ro;o4altn oeiadls2ea(mp;t)trerxfcoa1fp ean i;s  2xmirpiydaptemfesa() 2ra(ro;o4tee mieiyd mDumuvo;u)tetnio3to1oatrau s;t0 exoir nu1apenlicslt) Durxrpnt0tetnmicilslmDulnmpn(0 etoxr to1faDeluei (0teurxm io4am nmnctas) Dta( onu0apxniieias a2umn p u)aetnif3iydlmte ivo t texo(o no1lpt lneias)sDurxrpou4tptnmf3iydla2um( p t) leriociadfpDrlnvi s trxmio3iydoleelnvi tfsrtaum oo4teto oeildfm2rauvont0trermfciydfmtr ieo;(0srurir3iu4lme livsasfaDra( pot4olxomfctas a2ulnmonu0alxrio3totoatrlnei;t)s2xm(opno4lle mfviltfsDta( o;u0altomoeiltfm2um( pnt0areoxf3ia1oaDeanvi;s)s2toxr ny4lpe  net s)aDra(mo;o0ope  ictasfsDuaums;u)tetrmr3tytlatrlu o;s0trtmxrpny4omtnlieilt)artauroot4opeoifetas s2ea( o;t)trtoio3iodopDrliei;t t2tmxo no4opte fvtltfa2rmu p;u1apxnmo3ias a rl(ms u)alerif todfa eaueo;s  eumxmpnodom n fct tf Dta(rpnt0aee ifeiatfa2rmumpn()aetoir ta1lm  livi;s0sruo(rpoodomte icslt)aDum( ono4apeo fciadla em(ms;(4areoxo tydfm eln o s0t2urxm oo1amen fvilsfaDumxronu0open fciatlaDeauvpn(4 ltrxo io1fm   uvs;t s2um(r oudll emivi t sDtmu  nt4teenmicild s2em(mp;(0tltnmfciadfpDraivols)truo(opno1om n fctl(fsruax  nt0alt mf3iat s2el(vp;(4tlenio tytlaDran i ( srtr(opiudolt  ietls aruax pno4alxnmf3ilt sDrmn s;u4 rerif3tadlm e neo () 2xmimpiy1om elivs ( s2taxr ot0altoifctlsfm2rln pn(0altoxo iytfaDr ues;(0s2uoxmpnu1opeelies (f rumxroou4alenmi3iys mDrluvs;(0altrir oy1laDr uvi t)texm(opnydameelici () Draumpot0tleo f3tyd aDulnmpnu4alxoiocta1fp  luvs;t0trumim oy4am   feiatf Dtmxr ot4aet  fctld s eln pnu)tleoxo3tytfp  aivs t t2tr(r ou4lpeemncsas sDurxmooo4tpenmietyt s rmn pnt)arxrmfctotom e ivils0 2trio3nu4lmenmfesas s2um(m no4oetoii3ilslm el( s u4 rxomr3io1la ran sls  rtmxo io4lptnmiesa(faDta(r no1apxn oeiys aDea(mo;t4 etomr io1fmD ln i;s) rxo(mpoudolte fctasfaDra( ooo1aeen f3iydfm uaumpnu4tlerif3io1op rli o;t0 exr(rpno1ap nmnct tfsrtaxrpot1aexn feiydfa ua(vp (4alxnxfcia1lpD lu i;(0 2xr(r3ou4ll  lfvil()arumu  nt1tex  f3iad mDemnms t)trerif3iotopDeln ols) eumio3iydal n ncils sDrm(mo;t0oeenifeiltlm2umnvs;u0alerxr3iatlptrluvsl(0 rumirpnodop  mnvsa()s2ur(rpoo1tee  feiyd aDranmp;()areoxrcootfp eau o t0srxoim3nudll elncsls  rurur ot4altnmfeiysls2rm(mp;(0 lxnxf3tatlm e ues (0 eur(m nodapt mncs tf rrm( p;t4apen ociyt s ulu s (0 rtnxr3tatfat lies;s trumim iu4ape mneslt aDtrurpnu0oeenmf3taslsDeluvp;t)areoxr3todfaDelueo;(  exo(m ou1optnlfes s)srtmum ot1olt mi3iydla rlu p;t4trtnmf3iytom   u slt0s2tmxr3iydlmt mfvs (f Duax  nt4aleomfcildfs2ra( o;(0tlxrmfcto1fmtelueo t)t2xm(m ou4op   fcia(fsDurxmpnt1aee  ociadla2ra(vo t)areomf3iodomte ieslt)setrimpno1omtelfct t) 2tr(rpnt1tpxo fetys m2em(msnt0 rtomocoydfp  an i s)s2uoxmpou1olen ietatfsrrr(r ou1aex ifeiyt mDea( pnu0altrmf iadfp  aneilt0t2uoxm iy1op nmnes ()s2taxmp;u4tlxoifeildlaDranvont) exoio oodopDeaieo;(0 rtoir3ny1lp n ivt t arrax  oo1openmoeiytfa2emump;u0 renmo3iydoptrai o;(  etoxopiodlp elnesl(farta(rono4tltomiciyt a2rlnvsnu4texrif iotlaD anvil( s2xoirpoydame mfctltfs2rm( pnu0alxnmfcils m2rmnmp;(0 ltoio3ia1lmtelueil(0 rxm(opiu4omt lfeta( a2uax 
\ No newline at end of file
@@ -0,0 +1 @@
+nvsl( teuoxopoy4ome mivtas s2rmx  ou0apeoiociyt s rluvon(0 etnmociatomD  uvo s srumxrpiodol nlnct (f Drmurp;u0oltomo3tas mDean o;t4 lermo3oy1fmD an o;t tetmxr nu4amtelnvs s  2tmur nu1alxnii3iytfs uauvsn()tetrxr3oatla rai i;s)texm(r iu1altn fcil( sDuru  ;t1tlxn i3tytfmDel(vs t0 rtoio3iotfp   n slt)trtoxm iu4oltn fes s) rrax pou0tetn o3tls s em( p u4artnmr tydfp  aieil( sruoxopou4ole  neils sDurxro;u1tleoiieiatla uau pnt4trtrxocio1omDrauei s) 2umxr3oy1lpe  fci (  2uaxmonu1ale iiciatfa2ul( ont)tlxoir3oytoptrliei s srxmxopny4omt mnesltfs2taumpno1oexnmiciadlsDulnvs;t)texnmr3io1lmDrai s (0 rxm(m3nu4apen neia(faDurxr nt1olt ifeiadfmDuanmsnt)tlxnmf tatlm  livs;t  etoir3iu4lmtelfeiltfa2rm(ro;u1aeto o3tldla2ulu sn(4 rtomo3iodfp eauei;t  etr(mpny4ap e fetas  rumx p;t0apt mfctydlmDelu s u0 lermrctodfa  livol(0tetoimpny4ope livsls)aDtmxm nt4oex ifciltfm2ul(vo;(4tleomf iy1fmte nvo;s)tetrxr oy4ll emivi (  2umu pnu1optoio3iltla2ra( o;u) exrir3to1latrauvo;( seuoir oodlleemnei () Dtr(m nt1ape  ietydfmDranms (0 rtoxr3tytlm  anvolt truoxm3nu1aptn ieil( artm( pnt4texo f3iatfm2uluvpn(0teenxocoytlatrlues;s sexrimpoudlm nlicil(  rurumonu1tptn ieildfs2uan o u0aexoio iotoat anvi;s)s2uoio iy4op n ivt t)arumu ooo1aetoifctyd sDul(ms (4 lenmo iytlatr n o;() 2urio3iy4al nmfeia()srtmxrp;t1alt  oetydls el( pnu4 ltrmr3iydfpD  i s t s2xoimpoudlle licilsfarraxr ;o1oexomiciysfm emuvsnt4trxrir to1om rau i s)t2ur(mpoy1apeemictlt  rtmx ont0alt mi3iydfm2ea( o;(4artnxo ta1lmte ieil( sexrxr3oydome  ivta(  rraxrp;u4oltoii3tad s2eln p;(0aexrif iadfa eln s () etr(m iu4ol  lfvil( a2tmumpno4olx ioeiad sDrm(vp ()tetnmf3oytoa rlnei;s0sexrxr3ou1lpeemnet s  2truro;o0alenmi3iyt s2umu on(0tltoio3iatoateauvols srxmxmpoydllte ics (f rta(root4aee  feiatfa2uanmp;t4trermf iytomte ivsls texoirpiudlm emnesl( aDur(roou4optnio3iys s2ra(ms;u)trtrxocoatlp r n i s0 2umir iy1ape lneia( s2uauro;o1tpeo oeiltls2rmnmpn(4 rermr3iy1omDeluvolt0teumirpnu1op   icilsfsDrr(r no1oeeoii3tlt aDulump;u)tetrxr ta1om  ln o;s  etmxo ou4apeemnct (  ruru o;o4aex ifciys a rlu s;(4arxrxrcty1fmtelivil(0t2xrio3ny1omt lfesat a2urxmoot1texomf3tlsla rm(mont)aeeomrcia1fmt  ueo;(0s2xrxr3ny1optelivsls)srumur ou1oexn ieildlm ul(mpnu0artrmrcoydoaDelnvils t2tm(o ny1omeemfvsas)sDraxmpno4tee  ieiat m2ean o;u) ltoif oodlmDr ues ()s2tmxopou1om e ivs s) 2rru  oo0olxnmiciasfa ran o;t) eeomfcto1fpteauvols0s2trimpiodamtemnetlsfsrurxmp;t4aetoif3tadfs2emnmo;t)tleoxf tadlptean olt  2toir io1ll  lfctat  2ra( p;u0apt ioetlsfm rm(vo t0 etoxrctatopDrlneo;t0 2uoxopoydaptelfetls aDuaurooo4tltnii3iydls ran s u0alenmr3totomDeluesls0s2tmxo3iu4om n netas)arrmx o;u4oeenmieils m2ea(mpn(4alxrio3oodlmt  nvo;( truo(o oydomtn nct sf Dua( p;t1oltn ieiadfs2rmnmp;(0arxnio oodfaD aivi;s)teumim iodap   ivils)sDuaurp;t0aetnmieiad m2ulnvonu4tetoxr iadlpD au sl( srxoxr oy4ol e fcils)srumxr nt1aleoifeildfa2eanms (0trtrmf iy1lmteanes t0trumio3oodolt mivs t  rta(  no0oetn o3iysfa eluvpn()arxnxf to1opDe nes;(0 2tm(mpno4lmtnmicsatfa2tr(mp;t0tetn f3iat m ran s (4texrmf io1laD auei;t s2xmxm3ny1am emfvsas  2ua(rono4aptnmfetad m ra( pnt) lxnif iatlatrau ilt)srtoir3oydlp nliei t)srta(m nt4texo ieilsla eauvs;(0alerif3todlate n s t0s2umxrpou4lptn ietl(farrmxm no1oeenmieiyt s2rlnmo;t4arermr oatfatr nei s) eumxm3iodapeelnvil()srrax oot0tpx  i3tytfa2uaumo () ltomf3ta1lmDr nvs;t)sexrirpiodal  mivilt  2tr(r nu0ole mi3ildlm ean p t0arxrmrciotfa raieo s0 rum(mpny4lmt mnvs ()sDumump;u0oet if3iysfaDra( s ()tetoxr3oydom eau ilt0teuoxm3ny4opte ics s) 2rr(ronu4openmo3iydls eau pnu)alxomf3to1opDrluvolt)setoxm nydame lfviltf Dururpot4teeomf3iysfm2eau s u)texrmocty1lpt aies s)trxoxrpno1aleemivils  Draxmpnt1oleo fciytlm um( p (4teerxfciy1oate neo;s0texrio3oydapen ici s  Dumu p;t1tptnifciytfaDum(ms u4 lxrif oydlm eaneilt0 2to(rpou1alen fciltf 2rmumpoo4aex  f3tyd m raumsnu)tleoxfcoy1lpD  nvils0s2xrir3iu4aptnlfvt t aruru pou4olxoioeilsls ulumo (0texomo tadlm raiesl() rtoxm3io1lp nlnvta(  Drmxmpot1tpt mieildla eau o;t)aleoxocta1la ranei;s) 2uoio nodop nlfcil(  Dtm(  no4ape iieiydfs2ulnmo;t4 lxrmr3ta1fp e i s;(  2uo(m oudomeelnetl(faruaxr nu0opt  ieiyt aDum(mo (0 renxo ta1om r i s s)trtmxr3nydlptemies t) Draumpou4ole  ictlsfa2rluvon(0aexomr3oatom rln s;(  exmxo ou1ap  mfei sfsrta( p;o0alxo f3tat sDrln o;u0alerir3oa1fatrli s ( srur(m io1ll   icilsfarumumpou4aex  f3tasfm ea(vsn(4tleoxf3oodfmD ln i;(0srtr(opoodol  mfvtl()sDua(rpou0optoifciadla2el( s t0 lenxo ty1omtr ivslt)srtmio3iydlp emieiat) 2umxmpoo1tlx iociatls2ra(vo u0 lenmf3iydfa   uvi;s) rxoiopny4ol n fetl()a2rrxro;o0aex  ieiaslmDem( p t4 lerif3tytla  aivols setrxm3oy4om e nviasf 2uau  no1teen feiytls ul(vs;()trtnxf3tytfpt lnvi s0t2uo(o oodaptemneia()arua( onu4olx micildfm2eau snu0 etomr3ia1laDr n o;s srtrxopiy1lmtemfvtatfsDurx o;o4opeomocilslsDelu sn()alxrxrciydoaDrlu i;s)t2tm(m3ou1lle  nct tfs2rrurpnu4ape mi3iyt aDrm(mp;t0aexnxo iytomDraivo t0truo(rpnydopee fvi t)a2urxroot0tleo o3taslmDemu o t4teenxo3tydfaD  i ils0srxrxo iu4lmte nvil(f Durur ;t4oleoioeildls emumon()aeeriocoadfaDelues;t) eum(mpoo4lpe mnvi (  Dtr( o;o0oeeo feiltfaDelnms;t4 rxnmf3oodop  livi;s  exmxr iodlp nlfvi (fsDta(ro;t4oltnifcias mDemuvo;t0 rerio3tatfa  auvi;s s2xmxo nydlmtn nctltfartaxmpno0olxoioeiltfa2rl( snt0trxnmociadfa  lneo (0setmxo nu4optnmnctl(  rumu o;o4altoiociasls uaumpnt4tltrmfcoy1fpD lneols  rto(rpnudal  mfvsl() Dta(  nt1alxnifeiatla2uluvonu)trxrmrciatfpt  ueo s)t2umxopou4ole  iet tfartrx poo1aeen i3iytlsDrauvp u0artoio3iytfpDrlnvils s2ur(o nydapeelfcsatf rumx ooo4tlenifciyt m ua( s;t0arerxfcto1oatr i o s) rxr(opno4lm elncta(fsDumum ou1tetnmfctls s2umn s u0 rtnmf3tydomDeau ols t2urxr nu1ll n fvtl(fartmxm ou0apto i3iasfmDulums t)alenif iytom  livslt srxrxr iodamenlietltfsrrmumo;u4alto f3tldfm2ra(mo;t) rtoio tatfmD lieol(0trxrxmpiy1ol  lncilt)sDuaurp;t0aeto f3ilslmDeauvsnu)altoircoa1fa r ieslt t2tm(o3no4optnmfeilt  rrrum ot4tleomieiydfm eanmo;(0tlxnmr ta1fp raivi (0sexoio nu1apt  iei t s2umx  oo4opx mociydfsDuan s (0 lxrxr3iydopt anvslt)setm(m3iodalt  ietlt)arra(r ;t4tlx mi3tas a um( onu)alerxf3iadfaD aueils) 2xm(rpoy4oltn fvsl()s2rax p;o4oetnmfeilsla2umnvpnt0teenio3oatomtrlnes s  euriopnu4lmeemfcia()sDtr(ront4aptn fciatfm2rau p (4aeenxr3iytop e nvo;s sexo(opou4ap n fvsa()sDrrumpnu0ope mictasfmDuan p t) lerxo3iadfaDrlnvs;() 2xmxo3ny1olen fcsa()a2tmxrpoo4tpx ii3tlsfsDel(vpnu)arxrxo3oa1lptrlneol(  2um(o no4ope lfesl(fartm(r ;o0olxnmfetatfa2emn p u4trxoio3to1oa elu i;(  rurim iu1ap  mivsl()arum(ronu1open ociyt aDea(mp u0 rtoiocoytfm eluei;(0tetrxrpou4am   fcsa()artrxmpou0olxn o3iytfa2emuvp t0trxnio3tadfa  lues;s srxoiopnu1om  mfvtlsf Durum ou0texnmfcildfs2eanvp t)alxnir3ty1faDr ueo (  2tr(mpny4ap elics s)arra(  ou0aet  feiasla ea(vs;u)aexnmo tadfpD luei t s2toxo nydll nmncsl(  Drmx  oo0alx  icilslsDumu s;(0trerxo3oa1oaDr i ols)tetrirpou4lmeelfvt (  2tm( pnu4aeeoif3iasfm umumsn(4arxrir3io1omDrlues;s0 2urxo3oo4olt mnei t  2tmxrono0opeomictas s2el(mpn(4 ltrxr todfmtran sl(0 ruoir oy4altnmfet t)s2rmurp;u1ole mfciltlmDea(vsn(4 renir ia1om r n i;(  exoxm3iudalte feias sDtax pnt0oexn iciatfm uauvs t0 lxrmrctatopDeai i;(0srxoxrpou4lmte ivias arraxm no4aexoiietlsfs2rluvsnt)tltrifctadoa eai ol(0srxo(o ou1al nmivtlsfaDurx  ot4oexo f3ild s2rmumsn(4aetnir oy1lm eanvs s t2xr(o oy1ame  nctat)aDumxr no4tetnii3tltfsDul( pn(0 eerif3tytfa  ai s;s  rxmir3oydlmtnmncs sfsDumxrpno0tlenioctysfaDeanvo;u0 eeoir3iodoaDr ueo;t  rtoxr3nu4lm nlnvsas s2tau oou1opx  fetld aDrmnmp;u4arxrxoctodfpDrlnei;t0 rtm(o3oodopenmfet sfsDurump;u0texo ieils a ul(vsnt4teerif tydoaDeli ols)srtrxmpoo4lpte ivtatfaDrmxrpoo1alx mfctydla2elumsnu4 exoxfcoa1omDeauvsls  2xrir3nudom  licsls  rtr(mo;o0altn fetys m emu p;(0 eenmr oodfpDrlieo;s s2tmir nudapenlfvi t a2rr(r ;u1aee io3iadfa2rmnvs;t4tltrxf3iadlat  nes;() rtrxrpoo1lp   iviat a2umxmo;u4tpx  oeiat m uau o u0aexrmo3to1fptelies;(  rxmim3iy1om elneias a2rau oou0tlen i3iat sDran snt0arxoxr3iadfaD an slt0 2uo(r3iu4alt lfcsas)sDuau o;o0tlxnifciysla el( s t)tltomf oodlp e n s;t) euoxr oodopt lics s) 2rm(rpoo0olenmictlsls2rl(vp;t) eermf3oodlpDr i sls0 exoxm3iudol emfvsl( artr( p;u1apxn f3tadls2uluvont4arxnir ia1fpD auvs;( seuo(mpiy4aleelivia()aDrm( o;u1apxoiiciasfaDumu on(0alermr iydfmDr n s;s trxoxrpio4al  mneil()aruru pot0oltoifetad aDrmnvsnt4tetnif3todopteli o s trtr(rpiydamtn ics s) Dra(rpnu1tpeoioctldls2eauvs;t4tlxnxf3iydla elieolt)tetoxo io4aleelfesat)a2ta( poo0tpto o3iysls2ul(vs;()trtomf3iodfat an i (  rxm(m ou1omtnlfct tfarrmum ot0ole iietatls2elumpnt0teeoioctodfmD luvs t t2xoio3io4ol e icsl() rrrxro;u0apxomfeiyt m2umu pnu0artoxrciotopDe uei;t0sruoxopou4ome lfctatfa2raumono1apx mfciadfm uau p;(4tltoxo3oadomtraieolt0s2urxmpou4oltemfesat)arraumpnu1tpxniociatfs2rlnvp u) lenifcoydfmDe u o t texmxmpoydlme  fet t)srum( pot4aetoiietltlm rl( p;u0tlerif3ia1optelneolt0 rtrim nu1alenlfvsa()sDtrurono4opxoioctytlaDrm(von() renxf todfmD auvo;( srtoxr3io1lme mivsa( sDtaumono4openio3ils aDulnvo t4 reomr ia1fa r u o s)s2ur(mpnu1lpte ivi (fsDrr(rooo1teto o3iyt mDeanmp;u0aeenmr3oydlm eaivs;(0 2urxopio4ap elfviatfsDumxmpnu0opeo oeiltfs umumon(0 ltrmfcoadopt lnes;t0 2urxo oo4lm nlfei t) 2tr( o;t4tlx mf3iytfaDrlnmo;u4 rxrmo ia1oatelnesl()t2tmir3no1ape lnesas)s2ta(rpou0olx io3tltlm rl(vs;(0tlenio iytop eau slt0 ruoxopiydlpe licil(  rumxmo;t1aexn feilslmDra(mp;(4 eenmf oatfmte ivs t0 2xm(m nydlp   nvil()sDrmxr ot1altoioeiydlm2uluvont)trxoif tadlpt  uvi;s  2umxr3iy1op   icslt) rum(m ou4oeto fctltls rlnvp t) eenif ty1lp  livols0s2xmirpnu4op elfct () ruaxm ot1ope ifciydlm2ul(vs;t0arenmfciodfaDrlieo s  eur(m oudlltnlieil( s2uaxrpot0teen ociysfaDulnvo;(4areomf3iy1omteln o;t0 eurxmpiu4al  mnvt sf rumxr ou1alt mo3tat m2rln s;t) rtrmfcio1oa  lnvi s)s2urxr3ou1altn fct (f Dta(rpnt1oetniictytlsDrlu s;t)artrio to1faDelu i;t0sexm(o3ny4apte ivs sfa2um(mooo1aex miciat a emums;(4trerio3ta1om r n s ( s2xmxm3nudop  livtl()s2rmxmpnu4tpe mfciasfa elump t4tleomfciy1lp e uei;t trxoio ou4ll emncia( arrmxmont1tltomictatfs umn o t) lenir ootfmD aneol(0 exoir3oy4lle mnvi (fa2rmxro;u0ape  i3ildfsDrm(monu4tlxnxo3oa1opD  nvs () rtm(o nudaptnlnes s)sDumxmp;t1oltniocias s emuvpn(4 reoir3iadlpteln o;(  2xm(r3oy4om emfciat s2tmu  ot0oltn o3iyd a2ua( pnu4trxnmo3ta1fptr ivol()sruo(m3ou1lleelfcsas  Drrur no1olxo oeiadls2emn o t4 exnxf iydlmt auvi t0 rurxo no4opt mncslt)srrrx  oo0aptoii3ilslm ra(vo;u4altomr totfaDrlnvo;t0 exoxr iy1lpenlfetl(fsDtr(mo;t4tetn oeiyd s em(ms;()texnmo iadopt  ivo t)t2toxrpno1amtemfcsls s2ur(r no4oeen fctlslmDuanvs u0trenxo3oytfaDran il( trxr(mpiodalt livils) 2uru ono1olxn fetad a eau p (4treomf to1omD an s;s  2trirpno1al  micil( a2tmum ;u4alto f3iad a uanvp (0 leoif tadfm r nvo;t0 ruriopnu4ale lfesa(fsDua(rpoo1tpxo octat aDrmnms;u)arermf3oydoaDe i s;(0setm(m oy4om elnvta( arrmum nu0alt iieils a2uluvpnu4 ltoir3iydom eaneslt0s2ur(o3oo4om n fviat  2tru  oo1alx mi3iltfa2umnvpn()altnif iydop  anvi;(0teuoxrpiudlmtemictlt srum(  ;u1ale mfctlsla2raumo u0aleriocta1oa  an s t truoir3oydlptn ncilt)aDtm( pot1tpxomf3ilsls umu p t)alxnmfciadoat aueslt  exm(o3nu4ol elfvta( sDurur nu1oltoiieiyt m2rauvsn(4aeermr iydfate ivi;s0tetrxr oy4optemies t a2ta(mono1oetn f3tysfa um(vp (4 ltnxrctatfa   ivols  2urxr iu4amenlfcsl()arumx onu1oexnii3ias s2eln o u) rtnmo3tytoptran s;(0 etm(r3io1lptnlneiat)s2rmu  no1oex if3tadfa2rm(vont0tltnir oodlpt  i i;t0 eurxr oo4ll emnctat  2rm(ro;u1tpeomi3iadfmDua( on() ltnio3tydfm  luvo;t  euoio nydomtnlncsasf 2rmxr ;u4aex iieiatla emnvo;u4 leoxr3todlmD  uvslt0 2trimpno1ap nmfesltfa2taumooo0aleoioctltls um( o;u4tltrmo todoptrauei;s)t2toio3no1op n nci (f rurxrpou0texnmictatfm2rm( o u)aeenio3oa1lmtelnei;t0s2xrir nu1aptemnvtls)aDrax onu1opxn i3iyd aDua(mp;u4trermrcoa1laDeln o s0srxm(o oodllt  nct s sDtrxmp;o4opx if3ilsla2ulums;(4arxnmrciatfmteauei;()teto(r3iy4oleemictas)a2ra(mpnu1oet  i3ilsfa uan s ()altoxo3ty1omt lnei ( t2ur(opoo1ale mnvi ()a2rmumo;o4tpt mi3iytla2eau onu)trtomfctotlaDrau i;s0s2xmim iodom elivi t)a2uaxronu1alxoifciytlsDumums;t)arxnxf oa1omDe n s;(0t2um(r3oy1lpenmivilsfsDtru o;u0altnifetasfs2raump t0trxrio iytfpteai s;t t2xrxo iydaptnmfet ( a2taurp;u1tee ioctas aDeau o;u4tlermrctatop   nvilt0 2tm(mpnu1lm nlietas srrmxr nt4alenmo3iadfaDea( s t)tetoxrcia1latraieo;() 2xr(r3iydamt mfetls) 2uru poo1texnifetltla2rmu o;()trtoxrcoy1lm raivo;s) eum(rpoy1lp n fct (fa2trxmpoo1tpto oeiatfs2umu p;(4arxnmoctodom  li il( s2xrxmpio1lltnlfei s) Dua( pnu1optn fciadfm umu p u4aexnxrciadlm r n i t s2tr(rpiudom  lfcia(  Dum(  ou4olxoiieiadfsDeanms ()texrxrctytopD aiesls s2xmim3io1ole mfei ( sDrauront4tlxniiciat sDum( sn(4texrmf to1omDeai s;t) etoxmpnu4ll   iet t s2rrurpoo1tpeomo3ildfmDel(vo;t4 etoir ootom eauei;t)s2to(o3iy1al emicia(f 2tmumo;t4olx  o3iadfm rl(mpn(0aetoio3iodfa raivi ()srumxmpou1ole lieiatfsrumu pou1aexoiociatfmDem(vo;u)tltoif iotop r uvolt)s2xmiopou1lmtnmfcilt)srur(mono1tet ifeiasla uan sn(0trxrxf tydfpD  uvi () rum(mpnu1ll  lnctlt arrmx  no4tle mfeiytfs2ua(vonu4altoxfcoadlpt au i t  rxmir io1lmt lneilt s2rax oou1apen fcildla2eaump;u) lxomo oa1op elnes (0trumiopno4lmeemfvt (farraxr ot0apx iieiysfm ean onu4tlxrxo ootfaDeluesl(0srur(r nu1apenmieilt  Dtmxrooo4aex  ictlsls2em( ont0teenmr3iy1op raivi t  rxrxrpio4optnlfct t aDtmxrpnt0opt if3iytla2elnmsn()alxnxfcoatoa   ivo s)t2to(opnu4op   fctls) 2urumo;u1olen octatfmDulnvpn(0tlxnmrcoytfaDe n sls0seur(r3nudlmt  fct ()srraumpou4olen ocils s rmumsn(4 rermo oydomtranvslt trxm(m iu1llt livsl()sDra(moou4olt  octltla2rl(vo;u) lxoxo3oo1la ean o;s0teuoxopnu1al nmfciltfarur(mp;o1ole mfctaslm rl(ms;(4arxomfciadoate ueo s0 ruoir nudopt micils)aDtmu pot4altomictltfsDrau pnt4treoxrcoy1fa rlnvsls) eumirpnu4al   ietasfarua(m ot0tle  feilt s2rl( o;(0 eeoxrctotomDraies;(0teumir nydol  mnctlt sDuau pou0aexo i3ildls2emu ont)teeoxf ootla ranei s0 rxoir iudal  livsasfsrtr(r ;t1teenmocilsfs uanvpn()tlenif iydlptelnvs s)sexo(rpoy4olte ics (f 2tm( p;t1apenmi3iyt a ul( s;t4tlxomf oodfmD ai ol(  etr(m3no4al e nvtas)arua(ront1aeenifctytla2ea(mo u0 etoxr ty1lmD au s s0trur(o iy1omt  ieias) ruaxrpno0oltnmiciasfm rlnvp (0aeeomr3oy1laDr iesl(0trxoxo3nudom nlncslsfartaurpno0ape ii3iltlm ulnvp t0tetomoctytfaDrlnvilt srumim oodapeelnesl(f rur( onu4tpx  fctatfmDuauvs;t0trxrmfciytfm rlueol(0setrio no4lpe mivias)sDraxmont0tlxniieiasfsDemnvonu) rtrir3tytla  auei (  2tmir nodom nlfctls  Durx onu1tpen f3iltfa2eluvsn()tlxnir3totfat lu i;s trxmimpiydome  fvs ()srra( ooo1aex  oetatfsDemn p;u)teenxf tatfaD auvslt0 2um(r oodlptnmiesls)aDta(mooo4ape  oeiaslm rlump ()aexoir3totlpte n s s  2xm(r ny4amtn nvias  rrau  no1oee iietlsla rauvp;(4 lerif tatop rai o;s0t2xo(m3nu4lpte fvsl(f Dtmur ;u4oeeomfetatfsDua(vsnu) rtrmociodomDr iei (  rxrxm3nu1aleelicsat)sDua(  ;u4altnmietasls2rlnmon(4tlenxrciatla raivs;( s2um(m3oudale miesas arur(rp;o0tlx moeiadla2uln o u0texrio oatlpt  i i;s  2urxopoy4lltnlfetlsfartmurpnt0aleoiietatla emn s (4 ltrxf oadop   u o;()srxmirpno1amenmictas) rtrxmp;o0aptnmfciyd a ul(vpn(0 lxoif3iatfaDeanvo t0 eur(mpno4op  lictls srrmu o;u1altoio3iadfs2uanvs;()teerxo3oydfmte ivo;t) euo(rpnudomt lncsl( sDumxro;o1tpeoifeiyd m2rlnvpnu)aeerxf io1fmtr i s t0tetr(o nu1lm  lietls) 2ur(r ou0opeo o3iatfaDem( s;t0artrif3oodlmte ivi;t0 euoimpiudlp nlnesl() rrm(m ot0ope mo3ildfa2ulump ()texrir ia1fmt ln s t0 etmxopiudoltemicia(fs2ta(r oo0aee micild m2um(vsn() rtnirctatlm   ivslt0t2toimpou4lmenmfeias  rtaxrpou4tptn ieiltls2ua(vp t0 eerirciydlp r iei;(0 etm(o3iy1ape  iciat srtaurp;t4olx mo3ias m2emuvpnt0artnir3oydlmteln s;s)s2uoim iu4opte fci t aDtmxm no4tlxoii3ils sDuan snt)altnmr tytlp  anei t0srxmir iu4optemivils)arrax pou1apt ioeiasla2umu pnt)tltnmo3ia1fmD anesls  rto(m iodlp e ivs s sruaxrp;o0ole if3ilsla2ean o (0alermf3iytopteauvol(0trtoxopnudllt  ncias) Dtauro;u0aeeomocilslsDrluvp t0alermr iotlp rlivsls) euoxr3io1alenmivsa()srum(r ou1opxo iciys sDuanmsnt)teenmo3iotla r uvol()s2um(o3nu1omtnlict tfa2tm( p;o1oleomf3iad a2rmumo t4teeoio oo1fm   ieslt)sexo(o ou4llen ncils a2rrxm ;o0teeoifeiydla2um( s u4 lxoio oo1oateaivi t s2xmxo3nu4lp nmfcs t)aDrau ooo1open fetyslaDrln s;(4artrmociatopD  u s s texoio3io1ome lfetas)aDtrurpot0aleo o3tytla2rln s (4alxnxr3tydfa e nvsls trtmir3no4ol emfes t) rtr(mp;u4oltnmfetyd a rl(vsn(0tetrxo3oa1lpteln o s0 2tmxo iu1amenmfct s)arurump;o1teto feiydfsDra( pn(0 renif iadlp e uvo;t  2uo(mpiodopt  ivtltf Draurpno0apen ietlsfaDrlnvs;(4trtoiociy1lpt auvi s) 2uoio oo4lmt  nesas srrmum no4apeomoeiyslm raumsnt4 exrxo oy1omte n slt)tetmir io4lptnmnesa(fa2tmxm ot4tlxomoetadls rmuvsn(4aetoxf3ty1lpDrlueo s teurxo3iodomee ics t)arrr(  ;t4alt if3tydlmDuanmsnt4tlermo tadfaDe i i s) 2urimpny4al   ietas  rtmxrp;u4ope  oeiydfs ra(ms (4 lxnxo iotlat au o s s2xoxo3io1lle  feta( sDtrxrpou0altomietadlm umnvpn(4texrxf oodlp  livo (0 euo(mpny1ll e nci s)srurxm ;o1tpe ii3iatla2eaumo;t0tetrif3todfp r nvils)sexo(mpiu4lp nmnvs t)a2uaurpnt1oleoif3iyd a2ulnmo;(4 ltrmrcoo1fat lnvs;s  rxoxm ny1alte iei () Dtrxrp;u1oexomiciyd sDua(ms;u0trtnxo3iotopDraieilt)srtmir oy4amen nes s)srta(m no4oeeomi3tydfa emn s;u4aeenif oytlpD lnvo t0 rxmim3oodal emivsatfa2rrurpno4alx ifciytlsDumumsn(4alxoir3oodfpteln sl(0 2tr(r3oo1lp  lieia() Dtm(rp;o1tltoio3ilslmDemnmo;t0 eeomo3iydfa r i slt trumxo iy1al nliviat)s2urxroot4tlenii3ilt s2el( p t)alxomf3oytfmDeaies;s) exo(mpiy4ale  ies sfsDurxrooo1olxnmfeils m uln p t0arxrxf to1la e u s;( t2tmim ou4omtnmnci (f rtmxmpot0aet  ieiysfs2emn pn(0 lxnmrcio1fp r uvs (0 euoimpoo4omen fci tfa2ur(r nu1oex  icild s2ranms;t) leoxo ootfa eli ils  rumxr iudol n fvtas aDumxrpou4olxn o3tldfs ulumsn(0aetnif iytom  au slt)seur(r3oy1ll e nes sf rtmum nt1aet mi3tyt mDrl(mpnt4arerio3ty1lm rlivo s)t2tmxrpio4ol elncsls)arurxrpot4aetn feiad a2em( on()aetnio3iydom rlnes;s  2ur(mpny4ol nlnvs t)s2ta(ronu4tleo f3tatfa2ulu p;() rxomf3oo1fatelu sl(0 rto(o3nodomtelnet ()artaumo;o1oltnio3iydfs2ra( p () eerxoctydop r uvols t2xrxm3iy1omte nctat a2rm(r nu0oeen fcildls rm( p u)texoir3todopDe n olt) etrio3ou1amtn ietl(f Dra( pnt1aexn oeiysfm2em( o u0 exnxociytomt an il() 2ur(o nu4opt lfct s  rtmu p;o1aee  oeildfs2eauvs t4 etrmo3todopD anvsls) eto(r ny1ap n ict (  2taxro;t1alt iociadfa rauvo ()teerxociodlaDr nes s)s2trxmpoo4apt licilt) Durump;u4olxnmieilt sDua(mon()tltniocoa1lmtraivi s0 rurxm nu4altn fctls sDrr( oot1opx  ociytfa rlnmsn(0trtrmo3iydlpDeau ols  rumxo oydal elfctl( aDurxmpno1aeeoif3iytlaDuan p u)trxoxrctotfpDelivi;t  etr(rpoudlpe lietltf rua(mp;o0oltnmoeiasfm2emu p (4aetomfciydfaDelneo t srxo(r nydap emfvs s aruaxr ;t0teto ietytlsDua(msnu0aexoiociy1lmDeaieilt0 ruo(rpiydll nlivi s)arum( oot1tptomoetad sDuanmp u4arxrio3iodlat lnvs;s)trxm(mpnu1altn fci (f rtrx p;o1oexn oeiltfsDua(vp (0altnif3oodfa eanei;t  rxrirpio1al emnetlt)a2ur(  nt1tle mfcild mDelumo;t4aeerif3ootoaDraivilt0 rumir3oy4al  lfct t arrau  nt4alt ifeiad a ea(vs;u0aeenir3tatlpteanes;s t2tmxopou1op  lfct t) Dtm(ro;u0tet  i3iatfsDrauvo;u0 exnmr3iodomD aues;t texm(m3no1omt  fvsltfaDra( pot4oeto f3tltla ea(mo;u) leoio3oy1fmt  ivo;(  exm(r3ny1ol n ict tf Dur(rpno1altoifcias a2rauvp;t) lxomr ootfpDeaneol( trtoir3ny4oleelnvi t  2rmumo;o4ape mf3tls a eau s;()alxnir iytla raneil( s2trxo3iy1lltelnct tfs2tr(mono0tpenmoctysfa2em( s u)trxnifcoatoaD aueilt) 2trxrpoy1oltnmicil() Drrurp;t4ole  feils a2ulu on() lermr tatlmDe ies;() 2xoir3oy4altnlnctas) rtm(mo;t1tle mfctasla2rln p (0aeenmrcta1fmte ueilt  eumir3iodllt mivil()artrxm ;u1alenifeilt s uanmp;u)aetomf3tadlaD  ueo;s)tetr(o oo4lptnmnvi sf rumur ot0alxoif3tydlm2rlu o (0tlxnifcoy1fp rluvi ( s2xmir iudopeemictas aDrmxr no1aetn i3tat a2rmnvs t) ltrxr3tatlate u ols  rtoiopiudlltn ncilt  2umxmooo1tpeoio3iltlm uln p u4tltrmrcto1lmDrln s ()trtmxo nudoptemnvil()aDtrxrpnt0olxnmi3ildfaDelnvo u0 renif3ta1latrlnvo;t) 2xo(o3iu1llt lfctasfaDtr(rpnt4aex ifciydfa rau o u)artrxfctadfpDr nvi;t0 2xmirpoo1lm e neia()sDtrx p;u4aee  fcildfsDrm(vsnu0alxoxoctadlmDrai ol(0srxmxo iy1lpenliet (fs2rr( pot1tltnmieilsfm ea(vs t) ltnxfcia1om e i s;()srur(o nodam  mnes t arta(  nt0opx ifciysfm ea( pnu)artrxfcootoptr nvs t t2uo(mpiudapt lfci t a2tr(ro;o1tlt  o3iyd a2uanmo;u4areoif3iodoat  iesl(0t2xmxr iudlpenmieiasfaDtrxrpnt1aptnmfciydfs eaumonu0arenmr3iatlateln i ()trxrirpny4apte icia( a2raxrpoo0oetoioeiat a2rmnvs;t4trtnmf3ootfpte i i t0 rxm(o3oy4ope lfvsa( sDumumo;u4texo ieiysls2eluvpnu)alerif3tadfp eaueilt) eurir oydlmtnlfeil(f 2ururoou4alto fctadfs2ra(mpnt)aetrir3iy1lp eai i t  rtoio oo4aptemfci t  2raxmont0apx moctltfs2emuvpnt4 lxoif3iydfp  auei;t0srtmir3ny1ope lneiltfsrrr(  no1optnioeilsls ra(vp;t) etoio3oydfp rai ils trxr(m ou4amt  nci t) rrmxm ou4tex miciysfsDuln pnt)areoxf iotfpt lnes;t  2xr(rpnudomtn ici s) Dra( pnt4aptnmiciltfa elnmpn(0 lxnxr3todfaDelneilt) 2xrirpio4am   ietl()srta( p;o4alenioctldfmDuln p;(4 eermo3iatlptrln s;(0t2xrxo oo1ap nlnvil()s2rmumpnt1aexomoeiyslmDean s u0 rermf3ty1faDeai ols)t2uo(r3iy1am nlfesas a2tmxr ;u1aexomieiytfsDea(ms u0arxnmrcoodfate nvo t) 2urxopoo4omeelncs ()aDum(rpnu1alxomf3iltlm ra(vp ()aetomocoydlpD li sl() eum(m no4lmee icta(fa2rmump;t1oltnio3tldlaDelu o t)altrio tatlmDeliei;() rtr(rpnu4ol e ict t sDtaxr ot1teenioetaslm uaumsn()trtoircoodfa  auvo;t0truo(r3ny4ome lncs t a2tm( oot1alt mietys s rmuvonu4texrif3tydla e i i s  eurimpoy4amenlfcslt) rumx  ;o4tex iiciytfaDua( o;()trxrmf3tytfmD aiesls)t2uoxm3oy4ol nlfvt ()s2tru  nu1aptn o3ilslsDeaump (0altnxr todoat lueol(0texrxo3iu4ap nlfci t s2um( pnt0alt  ocilt mDeln o;(0aeenmociydlm raiesl( srxmxr oo1alenmncsl()aDtaxmpnt0teto oetasls ulumpn() reniocio1lp   nvol(  rxmimpiy1ole mfei s) 2umxmo;u1oeenioeiaslmDeanvp t0 eermo3io1oa  luvs t srur(o3ny1lpe mnctl() ruax ont4olx mi3iysls ua( s;u0 lxrmo tytom ranvs;()tetoio3oodll nmicsat) 2ur(  ;t4tlxnmfetyt a2emnvpnt)alermfctotlateanvo t0 2toxo3io1am   nvsa()srur(mo;t4tle iociatlmDum( o (0aetoxoctodoaDr i i;s0 rtr(rpoo1olte ivtl( s2rmur nt0altnio3iatfsDea(vpn()aexoxf3iodlpDelneo;(  2trxm3nu4al emfvsa()sDra(rooo0oexomictas s em(monu) exrifctotopteln s;s0srumimpiu4am nmfcslt)s2ur(rp;u0optnmi3tld aDuln o;t4aetnir tatlpte nesls  rtoxo nodll   nvsltf Dta( p;u4open ieias sDul(mo ()arxrmr3iotomt auvols  2tmxrpiy4lp emiesl() 2rau onu0tex  icias sDel(vo;t0alerxr totfpt  i o s srxmxmpoy4alenmfetls aDra(root4ale mf3tadlm uanvp t)teerxfciatfaDran olt  eumio3io1ap elics s arrrur oo0aexn fctatla umu s t4 exrmr3totlm eli s;t0 rxm(m oudlltelictlt) rum(moot1apxnmiciys mDeanmo;u) eenmf3todlmte nvs t s2xoxr ny1ap nmieslt sDra(mpoo0aptomi3iaslmDranvs;u0aeeomo3oydoa elnvils0 rum(r oudapen ieilsf 2uau  ;u4aexnifeild a2rmuvp;t)trenio3oadopD ln i;s0trtoxopiu4aptnlivta( aDurx poo0aet  ociydfsDuanvo;t0 renxo3ty1lat  nvo s)t2xmim3ny4omte fei s  2tru poo0tptniieild a2rl( s (0teermfcoydlm r i o ()s2to(opnu4ope  ieslsfsDum(mo;u0olt  ociatlsDum(vp t4trtrmocoadfpDe n o s srtrirpno4om nlfes tf Dum(ro;u1alen oetlslaDuluvont0 lxrircoatopDe nei;s0srtoxrpnudomtelfeilt aDuru ono1aeen i3ildfs2ranvs;u4 ltoio todoa  aies;s) 2xoxr3oy1alt mncta(  rum(rpou0tltniietls a2umnms;t0tetnxo tatomDe ies (0 etmio io1op nmnet t)arrmxr nu4aetnmfcilsfm2ra( o t0 etnio3iatfpDelivo;s)setrim io4oltnmfesa() rrm(m ou0tex iiciysfs2ua(mp;t4artnxf todlaDraneo ( tetrxmpou4lmtn ivsls) Dumu oou0tlen oetlsfm ulumo;t0areoxoctydlp e u i t0t2umir3iy1al e ivi s  rurxm ;o4olt mo3iytfmDra(mp;(0 ltrxf3oadlpD  neol(0trumir3iy4apeelneias sDrm(  ou4oleomf3ilslaDelu onu0artomo3oodoaDe ivsl(0t2tmir nydlp e nei ()aDrr(moot1tltnioeiat mDrau ont)trtnxo3oydlatr i o;() 2ur(o iu1altemnvta() ruaxmpnu0tet  i3iad s rm( o u) ltnif iydla   nvs t tetmxrpou1lme mneil( s2umuro;u1tpxomf3tad s2uanvpnu)aexrmfcta1om  an o;s)srtrim3oy1lpeelnvt sfartmu pou4tpxo i3ilt aDul( p;t) lxnxo3oo1oaD  n s;t) etoxrpoudomt lncil(fa2rmu pno0ale  oeiltfa ranvsnu4tetrxrciotfat anvilt) ruoimpiy1amee neslt) Dumxrp;t0ole mictasfs2rmnvont0 rtnxocootomtrai ils)seurir3iu4aptnlfvsatf Duaumo;u4teeomieiydfa2raumon(0 etnirciytfmte ivsls trxo(o ny1lmte fes tfsrrmuroot4oleomietad m2uanvp;t4 rtrmf3iy1lp   u i s srxrim3nu4lp nmfcias  2tr(mpnu1optn fciyt s2ra(ms t) lenif3ootla  lieo t0 ruoxo nudlm emfctls) rta(mpou0oeeoio3ildfaDranms (0 lxoir3oytfatrlueils  exm(m3oy1ol   ncils) rtmxr oo1texn i3ils aDuanvon(0 rtnmrcty1om eliei;s0s2toim3ny1alt  fcslt)a2uaxr ;o4aex io3ils sDrmu p;u4altrmrctodop   uvo;s0t2xrxopio4al  mivtls)s2rrumo;t4ole iociadfs2ean on(0 eeoio3ty1fmt  nvo (  rtoimpio4lmenlfctl(f 2rrx  no4oeenii3tlsls2eluvo;(0 rxnxfcty1lmDrau o ( tetr(m3oy4apeelivt sfs2ur(moot4oee iociytfs ua( p;t) rtnxo3ty1oa eai il(0s2trxo3ny1lmenlfei (  ruaxrpno1tlenii3iadfm2raump;t0 leomf3oydomtrlivil(0trtmim oudop emfvslt s2rm(  nu0tlxn ietlt aDem( on(4trenmo3iotopDe ivil(0t2xm(mpiu4omt licsasfsDtr( o;u4tpe io3ilt aDumu ont4tlxoxfciotlmDe ieo;s  exo(r nydapt  ivsa(faDuau  ou4tlxo ieilsfsDeln sn(4 eeoif3oadlp elnvo;t0seuoimpoydomen fet (fsrtaxrono4apx if3iysla rluvon() leoxr3iatfpteluei t0sexo(o3ny1lpt lict sfaruax pou1optnmi3ildfmDra(vs;t)altoxf3tatoaD  ivi;s texmio3iudap nmfvtlt  2um( o;o1tpe iictltfmDum(vsnu4 rxnxf3ootlaDr iesls trtmim3nodlptnlivt t aDua(ro;t1oexoioeiatla2uanvp t)tleoxf3iytlaDrliei;( t2xr(mpio1llt  fci (fsDraxrpot1tlto f3iltfa ul(vsnt)trxrir3ty1om  lu i;(0srxrim3oy4lpt mnviasfa2tr(mono1aeeo o3tlslm ul(mp t4 eeoio oa1oa   i s s) euoim3oo4apeelfvt tf Dra(  ot4aptn oeiyd m ul(mp;u0teermo ootfmD luvo (  etr(o oy1ol e neiatfs2tru ooo0oleomfciaslm2elnms;t)alxrifcoy1faDr u i;s) 2xrxo oodol  mncsa() rta( pot0apenio3iaslsDul(msn(0aeeomfciatoaD aivo;s0sexr(o3no1op   fcs (  2rmump;o1apenio3ils m2emumpnt4texoif3oodlm  auvsl(  exoir iydol nlieias s2uaxm no1tpxomo3iydfsDrluvo;() exnmf3oadfp  lu s;s)t2urxr3iy4ol nlfcs ()a2rruroou0tlxnii3tat mDem(mpn() lxomrctydfptelueilt srurxm no4llte fctltfs2tm(r ;t0tlx mfctydfmDem( o u0teenxf iotlatrlivols)srxo(m ou1lle  neiat)srtrx o;u0tltnmfciyd a2ulu p u) reomf oy1la r nvo;s  ruoxm3oy4lle mfciat)s2trurpou0alt if3iat aDrmn snu)trenxf3oodfpDe ivilt trumxmpnodll e nvsasfaDtau  ot1olt mi3iysfs ean onu)tetnif tatlpD ln i ( srxmxo no1lleeliviatfaDrauro;o0tpt  ieild sDrmnmsn()altomo ty1faDe iei;(  etmim3no4lleemfei s)s2umu p;t1aleo i3ildfm emu p u)tltrmr oa1opDeaieo;t s2urxm no1ome mivs s a2taur oo0tpto ieiyt mDemn p;(4aeenxo oydlatrlieolt0 rur(r iodam nmfci tfsrtmxro;o1alx  fctydfs2ua(msn(4tlxrxfcia1laDeai ilt tetmim3iy4amt  fei ()aDra(mont0alt mociytfa2rm(vo t0aleoifcoydlmDran olt0 2urim3iy1omtn ncsa( s2umur ;u0tpxn i3tysfmDum(vs;(4tltrmr3oydfp e n ol(0 2xoir3oodame  feias arrau  ;t0ope io3iaslm el( o;u4aetnmo ootlmD anvi s t2xoim oodlmeemnviat) rtrx pou4olxnifciasfm ua( o t)aetrir3tadlm eanvs t s2trio nudamenmfvils  Drmu oou0olxomoetaslaDem( p u0tltrxf3tadomte u olt)seuoir oy4lp  lfeta(fsDtr(rpnt4aetomiciydfs elnms;t4aetrmf io1fat  uei;t0teurxo oydlmtelivtatfs2rm(  ;t0aptomi3tltfa eau pnt)trxrxr3iydfa e u s;s trxrim3oo1lptnlict tfaDtax  no1olxn fctytlm eau p ()tlenio3io1om  lneo;s  etmio3oudom  lfes t)sDra(m nu4tltn o3tlt sDrmnmo;t0artnio totoaDeau i;s0 ruo(opnudlltemfctlt sDrmu ono4tpt  oeiytla2ean o;t) ltoxfcoodomDean o s0srxo(o iy4opeemfet t)srrrx pnt4altn ieild s rlnmo (0texnio oy1laDr ies;(0trtrir3iodam e ivtlsfsDrau ont0opeo i3ilsla2eanvsnt) reomf3todlpDeau i t) rtr(r3io1aleelnvt t)s2rax pnu4tltoifcilsfs2ea( o t)tetrifcootoaD lu s (0s2xmio3ou4lpe lfcs ( arrrurpot4alxnii3tld aDulnms;(4altomr3ia1lpt lnes;s) 2xm(m3iy4ol n fvt t)artm( p;t1tetnmietat aDumumo (4alxoir oa1faDrln olt  2urimpiu1lpenlnvtltfaDrmumo;u0aetnmi3tlsfa2rl(mp;u) exoifcio1omtrluvi;s0srtmir3iy4ap nmnvi sfarrm(rp;o1opeo f3tyd m2rln sn(0tlxrxr iytomD auvols srtm(o iydamt mfes tfartmxmo;u0aet iietatlsDuluvsnu0tlxrif3tadlptrlivs;t tetm(opoo4lmtemfcs ( s2ta(m nu0oexoioeiys s2um(vs;u0texrxociydfaDr ivslt  2tr(r iu1lpen nvils  rtaxmp;o0opxomfctys mDrmnvo;u0altrxo tydoatrln s;s0 rtrxm3ny4om n fcs tf 2rr( pno0olx mf3iad s2elnmonu4trerxrcoa1omD livi (0seurxo3oy1optnmfctlt s2uau  no0apxo oeiys m uanvs;t0 eenmo iodoat lneo ()trxr(opny1llt mictlt)sDrr(mo;u1apxoiociltfa2umn sn(4teeoifctydfp  anei s0 2xoxm iy4ome mfesls arraumonu1alxn i3iysls ulnvo u0aexomociotfate neils0s2xr(opiy4llenlnvs t)srumxm ;o4teeniociat aDuln snt0 exrmo3oa1optraivi;s) rtrirpny1am nlieilt)srraxrpno0tlt mfciydlm elums t)aeeoio ia1oa  li slt teumxo3iy1lle  neiltfaDtm( oot0aptniieiadfa2el( o;t0artoxocootfmte iei;s) exoxrpnu4aptelnet () Drr( pno1oexn fctyslsDrm( o;t0aetnmfcty1op raivi;()s2tm(o ou1lpe  ivias  Drmxm ;t0tlt ioeias a emnvs;t0tlerxo ty1faDr u i t0sexrxr ny1open neslsfarrmu  oo0opxoio3ias m2eaump;(0alenmrciydoaD aivs t)teurimpiydapt lictat arta(  nt0tpxn oeiadfa rlnvs;t) lxnxr3iy1fmt livi ( teurir3iodlmtelnvs t)sruau o;u4tle mietydls uaumpnt4 etnxo ia1omDranvi t0 2xoxopou4ll  mivi (fsDumxront0optniiciatfs rlu o;u) rtrxocio1fpDe uvil(0t2uoio3iy1op   ncs s)s2ur(m no4aet iociadfs2ean p;t) etnircty1faDrlivs;(0sexrim3oy4lme lfeil(f rrrumo;u0tpx iociltfm emnvs u0 exrxo3tydlat  ivi t0 exm(r iu1al e fes t aDra(r ;t4oetnmfeildfs2umums;t0aeermfctytlp ranvi;( seum(opiu1olt licsls  Dtrxmoot4tpe mictysls rmnmpn(4areomf3ia1laDeaueols0t2xo(r3iudap  mnei tfs2tm(  ;u4tex iociyd s2el( p u)tltoxoctotoatrai sls0sexo(o3iu4om nlivils sDrru  nu1olen i3tld s2uanvp t4tetnio3oa1fmD lu o;s0trxoir3oo1lpt livi s)aDrr( pou0opxoioeiyt s ua(vp t4teenmf totlaD luesl(0t2urirpiodop nlfvsasf Drrxm ;t4olx mfeilt mDrm(vpn()tltoiocoy1fptrluei t)t2xoxo3io4lm nmnes s  2tmxr nu4ale  fciys m2eluvo;()tetoxo3iotla eluvi;s0sexo(r oo4am n nci t)a2uauroot0tetnmo3iatfa ulu o t4 etomr ia1fate n sl() ruoim oy1am   ivs ()a2trxm ot0ape ifeiltfm rl(vs;()artoirctotoa elnvs;(  2xoim3no4ole liei () Dra(  ;o1opxnmf3tatfm rm(msnu0 exoir3iatfate ivols0 2xm(m oodaptn icslt)sDrm( oot1alx  i3tls mDulu o u0alermr io1lpDranes (  rtrxr3nodll elnvtlt  2tmx ono4oetn oeilsfm2ul( p t)trtnxocoytfpDr ivo;s)sexm(o io1omeemiet (  2urxmo;u0optnio3tyt s uauvp;t4 eermo iytop rau i;(  rtoxopou4optn ictatfs2ra(  nt4alx mfeiydlaDelumo () rxrxr3iodomtranes s)sexmxopnydap   neta(f Drmxr ;u1opxniociydlsDrmnvp;u0 lxnmrcta1oaDrai olt0 rtr(opiu4op nlfesa()arrm(mooo0apt mf3tls aDrl( p t)aexoxrciatla r i i (0truoxrpnu4apt mies sfa2um( oot1tlxnmiciasfs rm(mont0tlxomr todoat lneils)sexo(r3iu1om emnvs t) Dtmxrooo0olxomf3iltlaDean ont0 rxnmo3ootomteau o;s trurxo oy1alt lneilsf Dtax p;o4teeo f3iadfm um(ms;t0 rerxo ta1lmDr ies;t s2umxr3oo4ope mnet s s2um(m ;o0tleomociltfm umu s (0arerifctadfa  lies t)trurimpiu1oltn nvtls)sDum( o;o0apx  octasfs2emn o t0texrxr3oa1lmD auvslt t2trxrpoo1amt mfvtatfaDtrxmpnt4aet ifeils s em(vs;() eeoif3oo1faDrauvil()sruoxo nodam nlfct (fa2rmxmp;u4oltnmictld aDrlu onu4trtomf3iatfa  ln i ()texr(o3oy4ol n nvs s aDrm(mpot4altn fciltla rmu p (4tlenir oy1omt anvs s0seurxr no1lp n netat)s2tmumoou4texn f3iltlsDemnvo;t4 leoir oydlmt lueo s0s2xr(mpou4oltelfcsl(faDuau o;t1oleoif3tad a2el( pnu4 ltnxr iotoaDrau i t) etrxr oo4lm   fvil(  Durxm oo1ale ifeilt a uanmo;(4 lenxocootlp rliei t  rtrimpoo4altnlicia( aDtmxm ;t1olto o3iad a ul(ms;(0alxomo3oo1la e neo;s s2trir3nydol elivt t)aruru o;o0oexnio3ildfs rmn s (4 rtnifciatoa   nvo;t srumirpou4aleelfvt s)sDtr(m ;o1tee  o3ilslm2eanmonu)aetrmrcoadlpD  neo;t0trumxr oydaptelnetl(faDtr( o;t1aeeniocilslaDemnvp;t)aleoif iodfm eaivsl(  ruoxr ou4alenlnvi (fsDumxr nt1tpt moctysfaDua( ont0 rxnioctytla  luvo s trxm(r3no1lme  netlt sDua(mo;o4opto ietatlm2rl(vs u0teeoircoa1oaDe iei s t2xoir no4lp e nvta(fsDuaxm ;t0apt ifetlsls2uau o;u0alenxr3iodfa elnesl(0t2xoio3iy1ope lncil(f 2tax  ot1apxo f3iasls el(ms;()tltrmf3iytfm   iei () etoxr3no4omt  ietat s2uau o;u0tlxn o3tadfa ulump t4aeeoxrcoydfa rli sl(0 2trimpiudopenmncsat arrmump;u4ale  iciat m ea( s;t4 lxnxr iadlmte uvi;t0 2toim3oudlmee fei s sDum(  ot4texnmfeiadfa2rmnvp;u)teeoir3oadlptrau i;( trxmxm3no4llenmnctlt a2ra(m oo4opxn f3iytfaDrauvp;u0aexnxo3tatoa e uvils0texmimpiu1ll e ictlt sDta(m ;o4texo iciydfs elumonu4teenmr3tytfate ivo;(0 rtr(rpoo4lltnlfciasfartmx ont0oetn i3iydfa ranvpnu4alxniocoydlmDrlivs;(0 rurim iu1al nliesa(  Draur ;u4alto iciydls eau p t0 exrxocoadop   uvs t seum(opoy1lltemncs s a2raxm nt0aptnmo3iydfmDrln pnu4altrio3tadom r u s s)texo(mpoudam e nvsa( arraum no4apeomieiydfa rlumo (4 lxoxf3ootfmt ln s t0seumxr3oodlme mfvi tfaDtmxmo;t1tptn ieiyslsDrl(vsnu0aleomf iodoateli s t0tetr(rpiy4ape lfetls)a2rm
\ No newline at end of file
@@ -0,0 +1 @@
+uvs (0t2xrxo ou4amtn fei sf rurxroot1tpxoifciat m emnvsn(4teenmr3tadfm   uvo t0 2xmiopiu4omt mietls)srum( ooo0oexomo3iasfsDul(vp u0aexnio3iatopDrli i;(0t2xrimpio4ap  lneils) 2urx o;o0opeo fctadls uaumo u) lxoxr oy1lm  lueol(  rxrir oy1lp   ncil()a2taxmpnu0ale mietasfs uaums ()aeerxr oa1oa e ueols teurim oydop  lncta( sDtmxm ;t1tetn ocilsfm umu onu0tetniocoytomD luei ( trtmir iydlmee fcs t)aDrrxmpoo4texnifciyd s rmu s;t0artoir3iodopDr u ols0tetrxmpoo1lm  lfcslt sDua(mp;t4olxnio3tyslm2emn sn(4altomr3iy1op ranei;(0srxoxm oy4lmeelivil(f ruru oou1tlenmoeiaslsDelu p t0 lenmrcoo1lat ai o;t teuoim oy1al e fctls arrax ont1tlxoiieiaslm2ulnmo t0 rerir iydom   iei;(  exoio no1amte nciltfs2umx onu1tlx ifeiad a2umn pnu0 ltoxo iadfa ranesl(0trumxrpiu4omt lnvil() rtru o;t4alt  ieiasfs2ulnmo;u)altrmfcia1fat auvo;s  exrimpiodlpt lncil()aDrmurpno0teenmfeiatfs2ran sn(4trtoxrctytom eanei s0 eumimpiodoltn ietlsfa2umx  ;t4optoifciat m2eln pnt4aeerir3tadop eli ols srur(o no4ap n fcsat)sruaxm ot0texomfetyd s ua( o;(0aexrmr iy1fate i o s)srtmxo oodaltelfcsat) 2rmu pnt1apxomo3iyd sDrlump;(0trxnifciydoaD  n il(  exoim iu4om   fvils  Dum(mp;u0alen f3iyslsDumn o;(4 exnir3iytopDeaneo s) 2toxmpnudape mfetltf rumxrpot1alxnif3iaslsDulnvp (0aetoxr iodlp e neo (0 2tmio3iy4lmt mnvsls) Dua(root1oetoii3ildfa eluvsnu4 rerir oydla elues;s0srxoiopnudlpt mfvtl() rumu pou0alxnmoetatlsDeau onu0 lxnmf iadoatrlueo ()trxrxo3nodlp e ncil( srrmu oou0optn ieiytfm2ulu s;(0alxoxr oy1la r i olt s2xmxm ou1olenmfvsltfsrtaxmo;t1oexomfetyt s2em(mon(0 etnmr3ty1fpDeln i t  rxm(r3oy1aleelnvil( srtm(rono0aeenmi3tasfs2ea(msn(4aeenifciydlate uei;s  etmxo3iu1op  mneslt)arrauroou0ole ioeiasfaDuanvont4artrmr ty1omD li o;s s2xm(mpoudap elfvta(  Drmxmont1oeeomfeiytfm2uan snu0trtomr3oo1latr i i () rtrxrpio4apenlics sfs2rr(m ou1olt  ieild m2umn pnu)tltomoctadfat  ivs;t  2umxr3oydlle mieil( a2umx pot0aleomieiasfm2ra( o;u0 renxfcio1lmD anvo t)sexoio io4omtelncs (fa2rm(mp;o0aptn ieiysfa em( s;u)alxomf oydoa rauesls t2xm(r3nu1lle lnci ()a2rm(mpot0alx mi3ild a ra(vsnu)trxrmo tatom  aivo;t trxoxo3no1lltnmnctas sDurxm ;u1oeeo ietyt sDemnmon()tetoif3oo1fateau sl(0 2tm(r3nu4ameemnciatfsrtrurpnt0apxn i3ilsls ranvo (0aexnirciydlm e ieslt)texmim3io4lp elfei sf rua(ront0aptnifeiyd m2rlnvpn()texoxoctadfpD  uvo s  2toiopoydom nmfesltfaDtmur nt4tptn f3tasls em(mpn(4tlxriocoadfp  an i;s  euo(m io4altelfetas  rrru  ;t1alxnifetatfs rmn sn(0aetnmociatfp elnei ()tetrim3oodaptn fvslsf rtmum ;u0ole mf3tld a2ua(vp u0trtnxr3tadlp e nes t0srtmxopiodopenlfcsa(f rtrx  no1tex moeildls2ul(vo;t) lxoir iadfptr ivs s0s2xoxm iudamt  ieils)s2uau pou1apenif3tldls uanmp;u0tetoir3tatla rlivs;s0tetm(r3io4amtemnciltf Drrxront1altoiieiaslm2eanvonu4trerif3iy1laDeluvils srtrxrpno4alt  nciat)a2tau o;t4opeo ocias a uanmpnu0arenxrcoatoatr n olt0sruoirpnodol elicilsf Dumu  ot1oexnif3iasla2emnmo t4 rxoir iodfmtrlneilt0sruo(mpiy4amtn fvsa(fsrrau  ;t4optniietas s2rl(vs u)aleoirciytfmD aivi t0 2xo(m3oudale lict ()artm(monu0optnifeias mDua( pnt) lenxr3iatfpt anei s t2tr(m no1lpe  ivi t sDuaxmont4tlx mfctltfm ra(mo;u)aetrio3iytlm elnvo t0 exoio3nodlltn fcta(fa2rmxmoou1tlxoioeiat a2ulnvpnt4arxrmo io1la e n ils0sexoxrpiu4lmte iei s aDur( p;u4olx moetytfm2el(vsn(4aetoxr3iodlp eaiei s)teuoxopou4amt  ncs ()arrm( oou4altoii3ilt mDranvo;u) lerxr3todlmtrliei;(0 rtmio3iydome lfetl(f Dtm(  ;t0tlenio3iat s ra( p;t0 rermr3oatoaDraivi;t0s2xrxo3oo1lptnmfvt tfs2rmxm no4ope io3ias m rm(msnu)trtnxf3iytlm elneo;() 2xoxm3iudamenmncs (  Drau  ;t0tetomfctlt m umn p;() reoio oy1lpte uvs;(  exmio3nydll n nei t s2ua(r nu4oee ifciydfaDelnvs (4 eenmoctytopDeluei s) 2tmxrpnudllt  fetlt)aDuaxm ;t4aeeo feild aDuln sn() lxnmf3iatfp  lieo ( t2urim3iydaptnmieslt)sDtmumont4oeenio3iatfs rlump (4 etrxf3iatoa   i o s)trum(m oo1om  mietlsf rraxr ou0opeo fcildls2ua(vonu0teeomocoa1latraivolt0seurxo3ou4altelfvtltfa2umu o;o4olto fetadfm2rl(mo;t0texnmfctytlp raies;s0 etmimpoo1omtnlfvt ()aDrr(rp;o0tptn f3tysfs rmnmp u4tltnmo3ta1lptranei;(0t2umio oo1lptelivsa(  2taxmp;o4aetomoetlslsDrln snt4trxrio iadlp   i slt) 2xo(o3io4lp nlfvia(f ruru ont1tpt moetytfm em(vsnu0aetomrcio1lmtean i s)t2tmiopoodop nliei t)a2tmum nu0oee mfciasfaDel(ms;(0 renxrciytlm   ivs (0 2xo(mpoo1lp nlnvt t a2trumooo0tleo oeild m2elnms t0aetnmoctodlpD  uvil()seuoxopoy4lm   ivtl(  rrau  ou0oet  oetydfsDumuvpnu4artrif3iotfpteaneils)s2urxo3ou1ame mfesat aDtr(m ;o0ape  f3ildlsDuaumsn() rxomfcoadlp r uvi s0trto(r iy1lp emncs s s2umxrp;u1ope mfeiadfm umuvpn(4teenmr3ty1fpDe ueo (0 exrxopoodopt lnci s)artr(mp;u1tet moeiyt s2umnvp;(4trerircoatlp  auvo;t0trto(r nydaltelnvi ()srrmx  nt4tet ifetatls2um( p t)tlxnio3io1lpD  i olt  rumir3ou1om nmnvtasfaDum(rpno0olxn fcildla2rlnvsnu)texnxf3totfp e neo;( s2urim iu1lp  licsl(fa2ra( onu4aex ii3tyd a elump (0 lenmf tatlaD aies;(  rxmxopno1ame lfei s) Duru p;t1tlxoiieiatfm2umu s;u)trenif iodoa   uvslt  2xoiopno4omtnmncsa(faDumxmoou1aleomieiadls2rmn sn(4aexrmf ta1om e i s s) etrxm no4ol   ivtl( s2trur ou4open ociysfs uln pnt0trenir oa1oatrauvolt s2xrxo3no1ome lfcsls arta( ooo4alxoifctatlsDemnmp;(4teenxf iodla eluvol(  rtrimpiodllt  ieils  rtm(mo;o4aex  iciat m ul( p;t)aeenmo3tadfmDrlivsl() 2xoxmpou4lm n nvi s)a2ta(rp;t1texn ictatlmDrau s (4altnmf iodomD lu o s0 2xmxr3oudapte fesl(fsrtr(r no0opt ifeils a2ul( s;u) eenmf3iadfpD livs;s0t2xoxm oo4lpenlnesl(f 2uru  nu4aetnioetldla2elnms;(0aetrxf iytlmDean o;t0srxrir oo4olte fes s arra( ooo1olenifciys sDuauvs;t0 leoxfciy1laDr u o;t) rumio3io1lme  feilt  Drmx pnu0alt  i3iatla2eaumpnu4tlerxo totoaD aneo t) ruo(r3nodlm nmicsls arum(rpnt4aptomoeiyslaDrm(vo;(4tleomr tytoa r uesls) eur(r3oydol e fctltfa2rax  nt0oeeoiociyt m ua(vpnt) rtoio oa1laDrai ils seuoxmpiydomtelivilt  Drmxr ;u4opxniiciasfmDranvpnu4aexnmfciodom eanvi;s t2xo(rpiu4am n ivs tf rrmu pnu4texniictyslaDeanmont)tltoif3oytfaDr neo t0 2tmiopoo4lp n neias) Dua(mpoo0tpxomoctld a elu p;() rtoxr oydom  aivi;s trxr(m no1apt  fctls)artmu onu4opx mictatfs emumo t4 renir tatoatrli sl() ruoxmpiy4ome  nvsl() 2rru pnt4oeeoii3tltlm emums u) rtnio iodfpt ai i;s s2xoimpoy1ap n ivia(fsrtm(m nt0alx ioetlslsDea(vp;(0teenxr oa1laDraueo;()trtmxm3iodalenmnci t  rrmxrp;u1apxn ieiatlaDuanvpn()aeeoxo3iatfm  ai ols)trxr(mpnu1ll e fetls  rtaurpoo0apenifetat m2ra(mont)aetomf3to1opD au s ()seum(opnu1alte ietas)artru  ;o1oexnmo3ildfs ran pn(0tltoifcty1lm e n slt srxoim oy1lme miesat)arua(mo;t0ope iocilslm emumonu4 lxnio tatfaD  nvo;t0srxrir3iu4am eliei () Dum(r ot0oee mietldlmDrm(vpnu0 rxrmf iytfa elivs;()s2xo(m iy4al   fctls)sDrmx  no0oeen fciyt aDulu o;t)trenmfcoadfaD anvi s trtoxr3iu1ap  mnvs tf 2ua(mpno0alx  i3tad sDuluvo t0altnmf3totfatean o s0seuoim nudome mfeia( s2raxmonu4aexn fciasls2uluvs (4trermrcoo1opt lnei (0 exoxmpiu4apeelivsatfsrrru o;o4apx mfeiatfmDel(vo;u0trerxrciadomt  i ilt  2tr(m3oodamee fvtlt  Dtaxmo;o4olenif3iaslmDelu s;(0arxomf3oydomt aieol( srtr(m io1olt miei (f Dra(ro;t1olxnioctadlmDeau s;(4alerifctydlmtrlueo ()tetmio3oo1ap   nvilt sDra(mo;t4apx ifeiys a2em( p ()alxrmo ia1omt auvi;t)tetoir3nudomtemiesat  rtmxm ot4apenif3iytfmDum(mpnt)tleoxr3oy1lmDr uvils  etrir no1alenmfvslsfsDta(mooo0tetoifetls a2elu s t0 rtrmf iodlatrln il(0 rtoir oo4lpee nes tf Dtmxr no0aetomietatfa2uanmon(0 eeoir ia1omD  ueo;t0t2trim oydap e fcsat  2rmu  oo0tltomo3iyt s rl(mon() lerxf tydfp  anvs;()trxrim nu4openmnct (  2tax  ou0aeen oetadls2emuvont4alxrxo3tytfaD auvils t2umio ou4llt  feta() 2raum ;t1oet iiciaslaDem(mo;u4 lxrmo iydlpteanvols)trtm(opny1omt lnvilsfarrrxm ou4aex iicilsfm2eaumo u) rxoxocoatlp ran s s0s2trxo3oudoltemfetl(  rrmurpou4ope  octad m2umu p;t4 rxrmo ia1oatraivi s0 exr(rpoo1omt  netl(fartmu ono1opto f3iytfm emn p () rerxf3oydlp eauvi s)texoim oodalt lnctas arraurpno0alx  fciysls ulnvo;u0alxnio oytlpDraues;t)t2toxr3oo1lp n neia()srur( pou4tpxo fetysfs2rluvp;t0texoxocty1fptr iei;s0setmio iydalt liei t sDtmum ;u0oexo o3iydlaDrmn s t)tlxrxrciydlmDranei () 2trxm3oo1ape mnvsa( s2um( pot4tetomociytla ranms;()trermfctotlm eai ilt)tetoxr3oy1lmtn ivsls  rrmu p;o4open o3tls aDeanms (0 rtnifcoo1fat luvo t  eum(r nodaltelfeta( artaxmo;o1oleoifciytlmDel(vsn(0aetomf3oadlmDrlivo t)t2toirpny1om emneta(fsrtrxmont0apeniociyd m um( o;()tlxrmf3tadla raieols) exoxo3ou1lp elivsat)aDta(mooo0tpx iiciad a uluvpnu) exrir ootomtrliei;s0 2urir3oy4lpe  nesls)a2urump;u0apen f3ildla rauvpnu) lxrmf ia1lm e uei t0srur(mpou4llt  ivt t  rumxmpnt1oet  f3tad m2rlumonu0 leomo3iodlmt ai ol(0trtrim3nodop nmncil(fa2urxm no0tle  f3tytfsDrluvp;t) ltrifcoydfpDraieo;(0srxo(m iu1apenmictat)srra(r no0apt ifciltlm uaums t) leoir iydlm r n s t  rto(mpiodlptelfes t  2ururpoo1oet ioeiad sDea(vs t0tetrxrciy1fpt  nes;t t2tmxr nodlp nlivtat  2ur(rpnu0aptoioeiat s uau p;u0 eenio iotomD  neolt0s2xrirpnu4am  lneiasf Dtax  nt1teeoio3tyd mDeanvp u0texrxf oo1lpt an o;s)t2uoim oy1lm elicia() Drmu p;o1ale mi3iysfm eanvpnu) rtoir ia1fa  aivo (0t2to(o3iy4op elnvt t sDtau ooo0oetnmoctydlmDemu p (0 eeoir3oytomD lneils0s2tmxr3oy1al  mfvt t)s2taxrpnu4oexoio3iytlm2uluvo;t)aexrmr3ia1latr neo t  exm(opoy1lm nmfet (f Dum( oot0aeeoifeiydfs2ulnmont0areoxocta1fpDrlivo;()s2xm(rpiy4omeelicta( artrumo;u1apx ioeiadlmDemuvs u4arxrmo oydlptr i i s trtmirpiu4omt  fcia(farrm(m ot0alt  f3ildfs ea(ms ()teeomf3iodopDrlu s (  2xmimpoo1olt lfctltf rua(r ot0ole  oeiyslm rmnmo t4 rxomo tydoa e n o s) etoio3oydameemfesat sruaum ;t4teeo ociltlaDem( p u4trtnmf3oa1lpt aivs ( srtrxr ou1alee fctat)a2ur(  nt0tet if3tydfaDrlu onu) rtrxo oodomtr uvo;s t2trir3oodll   feta(fsDumur ;t0ope  o3tadfa2rl(vs u4 etnir3iydfatr neils)texrimpoo4lle mietl( aDtaur ;u1texo ieiadlmDuln o () lxrmocootomD livs s) exo(opnydome licia(f Drrur oo0ole  o3iysfsDeluvp;u)tltnmf iotoaDelu i s) rtmxr3ny1al   iet sfs2umumooo1alxoifctys s2ea(mo;(4teerxfcty1fp e nvo s) etr(o nu4apte nvsls s2um( pnt4ale mfctlsla2uluvp u0 etrir oy1fate ieo;t0 2uoiopiodapen nes (  Dururoot1opx io3iat mDuln o;u4arxnif3oatlatraues;() rtriopiydameemiesas  2urxmp;o4ale ifciysla2rluvs u)tltrmf3tatfmtrlnei s0srurxrpoo1op  mfvs s) Durxmpou1tex  oetatfs2ea(vont) rxomf iytlateaneo s  2xo(o ny4amen nvias)s2rr(roou4tltn f3tasla2el( p (0alxoifcto1opDe u ilt tetrxmpnu4amenmict ()a2tmxmo;t0oet mi3iatfmDulnvpn(4arxoir3iatla rlivolt  etmxmpio1alenlneil() Dumumpot0apeo oeiysfmDuluvp;u) ltrif3iy1fp r uvo s)t2toim iy4op nmictasf rtm(m ;u1tleomietad s2emumpnu)tleoifcoatomDrauei t0t2xmim iu4lp e ivt s) Drm(rono1apx mociltla uau snt4aeeoif oa1omD anvs (0 etm(mpiu4lp n ivta(faDtm(moou0opto ocildls rmn s;()alermr tadfate ueo;t0t2to(m3oudlm elnvs t sDtau o;u1apxo o3tysls elnvsnu) renif3oatlmDraiei;t0s2to(m oodlmtelnvs () Dtmu  oo0tpt mf3tas a2ra(mont)tlxrxo todomDrlu i;(0sruoio oo4ole lictat) Dumurpnu1tptoifciytfsDra(mpn(4altnmo3oo1fpDr ivs t0 exo(mpiy1am   ivs s) Dta(mpou1teenmfctytfa rlu p () exrxr3iadoaDelu i;s0 rtoim ny1olen nvil( a2ur(mpnu4tpe  f3tatfs2rm(vs t4 etrmo3tatomD anvs;t0 eum(m3oodamte fcia(f Dumxm ou4oexoifetls a2eluvsnu4areoxf3iydopt aiei s)teuoxr oy4lp nmiesasf rua(m nu1tpt ii3ils s2um(monu0tlerxr3tytomDr nvil(0 2triopiu4oleelfctat)s2ua(  nt0aptnmf3tat a2ea(mp;(0 leomrcty1fa eauvs s0t2uo(m3ny4optn ictl() 2taxmooo0aex mieiasla eanvs;t0tetrmfcta1fatr iei;t0trxr(opno4lptnmnci ()sDra( o;u1tee ifetldlsDrmnmo t)arxoxr to1opDrau s t  2uoxmpoudamtelnctat)a2trx o;u1oexnio3ild sDrlumpnu)tetrirciydfpt  uei s0t2trio oy4am elfetas) rrmumo;t0tetomf3tls mDemnvp;t4aexrmocoadlm  lnvils  rtoxmpio4ope  ivi t a2trur ;u1tlt mi3tas s2el(vs ()altrifciydfp elnvs;()sexoxm nudolt mivt t aDuaxr nu0oeen oeiat sDel(mo u)trxoxo3ootfm raueo (0 etr(r3io1ope lncs ()aDum(rpot1alt mietydfa2rm(vs (0trenio oodlatrlivols srumiopnudlpt mnvtat artmx  nu1alx miciytfmDrl(vsn()trxnmf oy1lp  aues;s) 2umim nu4aptemivtls  Dtmx ono0alxomociytla rlums;(0alerio oytfp eaues;( teumim ny1lp nlfcil( sDrr( onu4apxomi3tltla rm( p;u4artrxr3iadfpD lueo;() exo(rpnydameeliet tf 2tr( ono4tleo f3iydfmDemnms (0aetoxfciotom rlnvo;s setoim iodoltnlfcilt arrmu ont0tlt  fetysfm2emnmp;u)altnirctotlaDran s;s)trxoxopoo1amtnlneia( artrxm ;o1apxnii3tat a2uau onu0aetnxf ty1oa rlnei;s)srxoio3nu1oltnmfctl(faDtr(roou1tlxo fcias s2eau p;(4tetoioctadom e ieol(0trxr(r nydll e nvt tfa2uaur ;o4apt mf3iysfm ua(mo u)tlxrmo3ootom   uvi;t  2ur(r3oodomenmfcsat a2tru pno0tlxn fcildlmDrm( p u0tlxoxr3to1lm r uvo s0 2xr(mpiy1ape mfeia()srtm(r nt0opt  iciydlaDumnmsnt)tlxrmr tadlmt lieo t)trxm(o nodlme  nesat)aDtaxmonu1oetomoeilsfa ul(vo u)aeenir iytopDe n ols0 euo(o3iu1amt mnct tf rtmurp;t1oet  fciytfs2rmn p;u) lxnmr iodfp rlues t0 rurxo3io4lmt lfei t)srtau o;u1opeoii3iyd s ulnmp u0 etrmr oodlmteanvsl()teur(r3nudal n fct t) Drmxroou0opt  f3tlsfs rauvsn()arenxo iatlaDrln sls0tetm(rpiydopenmfesa(f 2tmx ono4olx  o3iad m elu o;t) exoio3oo1om e nvs t  2tmim ny4apee nctas) 2trumo;t0apeomietatla2ra( p t0aeerifctotoateau ils)seumir oy1al  lnvtat) rrax  ;t4olx io3iad mDumn o;() ltnmrciadlp   n o;(0 rum(r3iodlpenlivt s)sDraumpou1ape mieiaslm umn o;t) etoiocoydfmtrai o;s s2xmim iu4amtnlfcs ()a2ta(rp;t4olt  iciyd s rm( s (0aleoxr todfpDean i;( s2urxr iy1omeelfci ( a2taur ot0olxn i3iltfmDrlumpnt4trenmr iadfm  lnei t  2tr(o oy4amt  ieslsf 2rm(m ;o0tetomi3iaslaDulnmpnt4 ltoio3iydoaDeaieilt  exrio3no4ap n nviat arra(  ;u0oleoii3iyt a rmnvsnt4 reoirciodfpD an s;t t2to(r3ou1am  miet () 2uaump;o1oetn o3tad m em(vonu)altniocoydoatelnvi;t) 2xoir3iodlpenmfcils)sDurxm no1oexo ieiytlmDem( sn(4texoio oatfmDeaneslt0t2xoim oodap nlfcsat)a2rmxm nu4olenifeiatfm rmnvonu4altnio3to1lp  lneslt)trtr(opny4lpee ictas)sDrmx  oo1opxnioctltfmDrl(vont0 etomr3ia1fateauei;()teum(m3ny4lme  ncsls aDumxrp;o1oetnifetatlsDean pn(0 rtomf io1fatr ivsl(0 eurxmpio4ape  fvia( s2rmu  oo0tltomo3tysfm eln s;t0artrxf tadoaDr ivi;s texmio oo4lptnliciat) 2tmurp;o0oeeo octatlm2um(mo;(0tltoxfctodfaDrli o s) 2toimpoo1apen ivt s) 2umxrpot0tleoiiciatfs2uaumo u4 ltnxoctotfpteau s;t trxrxrpny4llte fvta(  2rrum nt0aexn ociadlmDraumo;u0tlxnio iatlpDelnvo () eum(mpnu4ome mictat srur(rpou4tpt  feilsfmDul( onu0arxoxocoatopt ln ols  rurimpiudllee nvta(fa2rrx o;o4aeeomi3iytlsDua(mo t4 lerir3iydlm e u s;()s2umir3no1lm  lfvils)aDrauro;t4tpxo octysfa2ea(mo (0aeenmf3iy1lmDelnes;s)texmirpny4lp nlfci (fsrtrum no4altoifcildfa um(vs;(4 etoiocoatopD anes t)srxoim3io1al elnvtas artm( ono1tetnmoeiysfm rmump u4tltrirctytfatelnvs s t2trxr3no4lptn icsls)aDrau o;t0apeomfciysfaDra(vo;t0artnmr to1lp r ivolt0s2um(mpnu1op e fvia( srtmxr oo4oleomfciytls em(vs u0arerxrcoa1fmDrai s;s)teumio3nydolenlncsa(  rrrxmpno4tet moeiatfs2rlums;u4tlxoio oa1lpDeaivols t2um(o oo1ape micsls sDurx  nu0altnmf3tysfsDrm(vs t4tleoxo iytlpDean s;s)srtm(rpiodll  mivilt)s2tm( ono0apt mietyt mDeluvs;u0tleomr oytlm eaneo;()t2to(r3oudop   fci tf 2rau  nu0alx  fctlt aDea(mpnt0 ltnxr3oadomDeluvs;t trto(rpiydomt  icil( sDtr(ro;t0oleoifcildfm ulnmo;()tleomrcia1optr n ol(0 2xo(m3oo4lpt mieslsf Drrx p;u1opeoiietltlmDelumpnu0aeerio3oytfmD lu slt)t2umxrpny1lltemncs (f 2taumono0aetomi3tls s em(msn(0 rtnxo iy1fa rlnvi (  rumxrpnu1al  lncta(f rrmx oot0apx ioetysla2eanvs;t) lermr tatfaD ln i (0s2uoxm3oydalt  fet ( s2rmurono4olto ociys a ua(vsn()trtnmf3iytlp eaneol()srtrxmpnu1opee neil(farrmxmono4tpx if3tlt m elumpnu) lenio iydfpDr nvo (0 2xo(r3iudal nmneiatfs2uaxr nu4aetniiciyt mDua( o t) rxrirciatoptrlnvslt0 rtoxopio1ap  mfvias)a2rmxmoou0opt mf3ilt m uau pn(0alerxr3oa1omD lu ils)sexmxo oo4am nlnvtas aDtaurpot4aptomi3iytfa rau pn(4trenmr3iodfpD ai olt)trtrimpiy4omen ivi sfsrrrx oou1apx iociltls2rauvs;(4artrmrcoatomD aivi t)teumxo3no4lpte nvsas a2tmumpnt0tltnifeiatfs um(msn(4 rtnxr3iodoaDrlnei s0 2toxm nydllee ivs tfsrurum ;t0tptomfeiadfm2eaumo;() lenmr3tatop rlies (0trxo(rpio4lp nmnei t) rtm( pnt0aex mi3iat mDrlumonu)artnxf oydla rau o s  2ur(rpny1ole lfcia() rtru ono1oet mfetasfaDumn sn(4trtrxfcio1op  lnes;t setoxr3iy1am n fcsatf 2umxr ot1tleo ietat aDrmuvp;(0alenir tytlaDrauvo s0t2umxr ou1lpenlfetlt)a2tm(r ;t1apx  ietld s elnvpnt4aexoxocoy1fp elu o s  rumxo no1lmte iesa(f 2rrx ono0aet ifciatlm uau pnt4 eeoxf ta1omDr i s;s s2toim3nodlleemiet () rrm(mp;t0opeomi3ils s2rmn snu0texnio3oodlatranei;t0setrxm iydoleemfct ()artaxr ou0oetomoeiltfs rl(vp t0 exomf3iy1opte neols0teuoimpio4apt mfvi tfs2tau pnt1tlx mociatfmDul(vs (0 renio3iadfpt livs ( sexmim iu4ll  miesls  rumx oot1tpen fciysfa eln pnu)trtrmo3oo1op  li ol() 2toiopiydoltn fvsls) rrr(mp;u4aleoiociyt s2emums;(4tltoxr3iadlpDeli s;() rtmxo3oudlmt lnvs tf ruax ooo1tleoifetltla2elnvsnu0altnifciydla r ies;s)t2tmim iu4ol  liciatfsruaxmooo1ape if3tlslmDem( s;u0aetniocio1fatr ieo;() 2toimpnodam   ics tf 2ua(  ;u0apxn feiyd a2uanvont4 eeoxr3iodlatraneolt0trtoxr3iu1lleelivt t)arrmx pnt4aptn i3taslmDrmnms;u4treomr oydoaDelnvols) 2urxrpoodole lfciat) rtrurooo0aleomo3ild sDraump;t0 lxrxr totfpDraues;( s2ur(opoo4apee icta(  rtaumpnu1tptnmo3iys a2eanvpnu)alxoifcoydop  luesls)s2tm(m iy1lpt mnci (fs2ua(m ;u0aetoio3ilsla2em( sn()arerxfciydlpD lues ( sruoxmpiy1al  lncilt)s2rr(r ;u4tptnii3ilsls ean p t)texomf iydomDe uvsls)sexo(r no1ale lfesa(f rtmxr ;u1optnmf3iatlm2uaump (4 rtoxfcia1la rlnei;(0truoir3nodllt lnesasfsrtrumpou0aex mi3iadfmDumnvs u4artnio3oa1omt lnes s0truoxo3ny1altnmnci (  2uaurpnu4ale ifeiytlmDrmuvs;t0trtoxr3oatlp eaieilt)seurim ny1ap  lfei ()sDra(mpno0ape mfciatfa elnvs;()trenmfciotfmtr u ilt sexmxr ny1lme mfeias)a2rm(m nu0oeenifciad aDulnms;u4areoxr3to1fp eanei;t0texmxopnu1omen nctl()arurxmp;o0altnmo3iyt m2eau o t0 etrifcoo1lmDraivs s0 2um(m io1amtemfct t  Durxmp;u4aeeoifeiytfs2em(mp;u)trxomf to1lm  au o t0t2xo(o3ny1lmen ivilsfaDumx p;u4tpe io3ild m um( ont)arxoio3oydfm e nvi ( trumxr iydllee ncsasfaDrau pnt0oleoifctat s ran p;(4areoxo3tydlaDeaivo s) exrir3nu4opeemnvilt s2tauroou4tpt mo3iadfaDra(ms;u0artomo io1omD  u s;s)s2tmio3iu4lptelneils sDrax  oo4apxniietytfmDuauvo;u)tlxomf3todlp eaivs t0texrim3oodlm e neslt)sDum(moou0apxn fciad mDranvs;t) lerir3iodfmD  nes s0sruo(o iu4omeemivi t a2umxrpnu0oleniieiatfa rlu p (0areoxo3ty1fm rlivi t0 euo(r oy1omtemieiat  rumxm no1tltomoeild a2uanvp;u4 exoir3ta1lpDrlu o;s) exoxrpiu1ll emncilt s2taxr ;t1apxomi3iytlm rl(mpnu4arerxo3totom rau ols  exm(rpnu4alenmfcias)arta(mooo1altoiicilt mDrm(vs u4tlxrmo3ootlaD  iesls  2xo(r3ou4am nmfciat artaxmono1olt  f3ils m eanvo u)aetnxrciodlmDr u s s seurxrpoodol elnvtasfs2ra(mpoo0tpto oeiadfa2rl(vonu)tlxomr3tydop elueols t2tmio3oo1ll nlnctatf Dtau pot4oleo i3iyslsDelu s t4 lxnmf totfp raivi (  eumim nydopeemnctl(  rtau pnu4aex mfeiydfa2rau snu0 etnmf3iodoaDr ies s) exmio oy1am nmncs t s2ta(m ;o4oetn icild aDrauvs;t0 rxrxrctadlm eauvols0s2xo(m3ny1lltelfesls)s2rr(mpnu0aptnifciydfm2umuvp;u)texnmf iodlmtean ol(0s2umir iydaptelfeia(fsrrmxrono4oltoifcias s rlnms;t0trtrifcoo1fmDe u olt0srxoxmpny1al  lfciasfaDtax pot4apt  oetatfs ua( snt0aeeomo oo1lateauvs s) exm(o nu4lm emfvs tfaDtaxro;o1oex mfeiadlmDea(vsn(0aetoir ty1lateli o ()texr(o3io1ale  neslsfs2rmxm ou4tle miciatls eau s t4 lxrif oo1op eluvo ( trxo(rpoy4lpeelncia(fsDua( o;u0tetn i3ildfs em(mp u) renif3ootlptranvsl( tetoim3ou4lpeemnciat  Dtr(r no0tex if3tatfm uaump;(0trtomr oa1oa e u olt tetoxo nodop n nesas)s2raxmp;o4olen f3iyd a2ea(vo t4 exoxo3ootfat  n s;t  exo(o3oo1ale lnvta(fsDta( o;u0alt mf3tadfa2umnvo;t4 exoif3oydoat au ils)tetmio3nydalenlnvsas  2ua(  no0texomi3tat a umnvsnu0 etnxrciydlaD  nei t srxr(m iudlpee fetl(  rtrxmpoo4aleoiieiad a eluvs (4aeerif3iydfm eluvil(  rxoxo oudaltn fvs tfsrur( ono1texoiieiad m2umuvs ()aetrio3ia1oaDr nes;t)s2xmio ny1llenmivils aDtmx pno1oleomi3iatlm ua(vs ()trxoxr tatfp r ivslt)setrio iu4lpe livtlt)a2uax  ;o4alenii3ild m2ra(monu)aeermr ia1oaD  nes;()trxmimpoodlmenmnesls  2rruroou1tpenmietatfaDem(mo (0trxomrcio1laDrlies s) rtrxm oo1lpe mfeil()sruaxroou1teeomieild s2uauvs;(0 lxrmf iy1fmtrlivsl(0 etmim3iudap elnet tfartax oou1texnmieiytls2uaumo u)aeermr oatlmD au ils0 rtoxopoodaltnlnetls) Draxr nt1aexoif3tydfs2rauvo (4 lenmf3totfpDr neo t t2toirpiu4optnlictat sDurumo;o0tlxoiictld aDum( p t)altrmociotlp rai o (0setrxrpoo4lm  mnvs s srtmu ono1opt iieiys a2elnmo;t0 leoxr3oodfp e nvi t  rtoxo oy1omt lfctat sDumu pnu0oltomf3tatfaDelnms;(4 exoxr totlateliei;t)s2xmirpny4amt mivtl()sDtm(rpot0tptoif3iytfa eauvonu4tetoif iydlpteaivo;s0 exmio3oy1apen ivi t) Drmxmp;t0tlt ioeildlsDeaumo u) ltnxo3oo1lm  lues t  2uoimpiydaptnmfcsl(fs2rr(moot1tpxo feilslsDrl(vo;u0aeenio3oytfa  li i t  2xoio3oy4ll nmnes (f 2tau  ;u0tlto iciasla ua(vo u)trxoirctatfptrlivils)s2toxm ny4ome lfeias  rur(root0tltnmo3iatfmDelump (0 eeoio oa1oaD aueslt0 rumxo3iy1lpee fetls  Dumxro;u4tpeniictadlsDelnmo;t0 exnmf3ta1lpDrau sls0trtrxopny4lp n icta(fsDtmum oo1aexo oeiadfa2rl(vs;t)alxnircto1om rlu o;(0texrir3iy4ll  lfcsls  rtrx ont0olxomfctydlmDranmsnu4 lerxfciatlp raueo t  etoir nydlltelfetls s2tr(moot1oeenif3iytfm2em(mpn()aexoxociatfmtr ivs;s0 etmio io4ol nlfciat)sDrm(moot4tle  f3iltfaDuan o ()texoio oo1fp  aivolt0t2urxm3io1al e nvsl(fa2truroot0apt  fctyt s eanms t4 ltrircoy1fp rlu i;t0s2xmxr3iydlle  ictas)srumurooo4altoifciyslaDrau ont)tltnif tytomD an s;s  rtmxr3iy1apeelfvs (faDrau p;o4alenioetldfs rlu s;u4tltnxo3tadoa e n i;s0 etrirpou4amte fei tfs2uaurpnu4aeen oeiyt s2rln p;t)trtoxr iytlm rli s s0s2urio nydom  mnctas srrrx o;u1tetomfeiydla elnmp;u4 ltnir3ia1lp  luvsl(0t2xoio3iy1lpe mnci ( arta(ro;u0tltoif3tydla em( s () etomrcoodfpDrluvol() exoir oy4lptemivtat srtmxrpou1tet  feilslmDel(mont)treoif3tatlm rln o;t t2xrio3oudopenlictat sDurx onu4teeo fciltlm eaumonu4artnio3oy1fm  ai o;(  etmim io1ap elivs t)srurump;u0oex ifeils a2raums u0alxoxo3iadlm raues s0s2ur(r3ou1lmee icslt arumu ont1tpeo feiltfm2elump;t4 ltrirciytfa rli o t texmxr oodol n neiasfsDurx pou0olxn oeiasfa ra(vo t0 rxoxf ty1oatrlneolt0 rxoir oo4optn iesa(f rraxmooo4altn icilslsDrmn onu)tlxnifctytlmD  uvolt)t2to(r3io1om elfesls  Dtm(  ou0alxo ieiyt aDeanvsnu) eerxr tadomt aneol()sexoiopoo1olt livi s)artmxro;t4opxnmoeiadfs2ea(vp t) lxrio3iodlm elieo;(0srto(r3nydoptn iesa(fsDrr(r ;u4aexomiciyd s ulnvsnt4 rermf3iadom e uvolt  2um(m iydlmt mfcs (f 2tr(  ;o4tet mfeiytlsDem( pn()trenif iydop rln o t t2xm(mpnudll elivias srtru ooo4aexn o3ild a2rmu o;u4texrmf3oo1omtrauvil(  exoir3nu4omt  ies t)srtrxrooo4tex mictysfm umnvs (4 etoxf3iatomteli i ()t2um(r iydlpenmictasfsDrrxmpnt4opxnio3ilsfm umuvo ()alenxocta1fa r n o (  exmxo ou4lm   fvs s a2tmump;t4optnmf3iydfm2ra( o (0aexoifciytlatelieol(0s2xoxopiu1ole mnvslt srumxr ot4tpxomieiasfs uan p () reoxf3ty1fm  lueo ()s2tm(opoodopenlfcil() Drr(r nt4alx  fciydls el(vp t4trxoxociydfat aivs;()trtrxopoo1lme livsat a2ta(  nt1tpeo fciatlm2rl(mo () lenif3iy1oat  i olt)trumiopny4lptelfciat  rum(rp;u4ope ii3iatfm emn on(0tltnir3oytlaD  nvsl(0texrxm oy1amt mieta(fsrua(rono1aexo fciatfs2ul( pnt0 eeoio3ta1op  au olt  etrxrpnudlpe mnei s sDurxmoot1openiieiydlmDua(vs;(4 lenxr ta1omDr u o;t0trxo(mpny4lp  lieslt) Drrxrpoo1tpe if3ilsfmDumn on()tlxrmf3tytopt aieo s) rxoirpnu4omtemicsas  rua(  ot0alxnifeiadlsDrmuvpnt4 rxoxrciy1fm rlivsls)s2xrio3iodopt lfes ()s2rmxmpoo4tptnmiciat a2ulnmsnu) rtnxocty1fateluvi;t s2tr(mpoy1ol  lici ( sDua(r ou0alxnifcild aDea(vpnt4 eerxo3iotlate ieol()texm(rpou4lp  micsls)srrr(rpou0olx  oeiyt a um(vo;u)aetoxf3ootlmtranvols0 ruoim io4lpeemfvsa(fs2urump;o1alt  i3iyd sDelnvp ()areoircia1lmtrliei;t)s2tmir3iy4ll n ivtlsf ruax  oo4tlenmf3iat m ean p u0 eeniocoodlp  livils t2xmxmpnu4aleelieias arrmu p;u4alt iiciytfs2ua(ms;u)aexomf ty1fmtraues s0t2toxo oydop nlneils)s2tmx pno1tlt mf3tls a um(vs () lerxrciatoate uvols)trtrir3oy1ol nlneil()a2uaurpnu4olxo o3ils m uauvo;()aetrxf3iy1faDrlivolt0s2uoir oy4opeelncil() 2rru ono4apto ociadfaDrm(vonu0 lxnxr tytomt  i i;t0trxoxopiu4ale lfvsl(faDrm(r no4tpxo iciytls2ra(mpnu0 ltoxr3ty1laDeluei;( tetr(o nudolenmfvt t sDtrxr oo0tpxomieilt s2eanvpnt)tltrxfcoadomDr i o;() rtrxo3oudlm nmfei ( arua(ronu4apx mfctlsls2uanvs u0tetnmfcoo1fm   u slt)t2tmim oudlpe licsa()s2taur ;t1altnmfctltfm2emuvs;t4 rtnmo3iotop  lueo t0srurio oy1llenmnei t) ruru  ;t0optniietldfa emnmsn()alxoif3iydfm   uvs t seuoxr io4optn ncil() Drmu pno1opxomfeias m eanmpnt0 lxnxo ty1opD aneils  exmxo iy1oltn neiltf 2raxmo;t4tpen ieiatfmDrmn p;u) exnio3iatfaDraues;()seuoirpou1apt lncsa( a2rmum ;o4aexomietad mDelu p;t0 rtrif to1lat livolt)sruoxo io4llt  ncil(fa2trurpnu1optnio3taslmDeanms;t) rtnxfcoadfateluvo t srxoirpoodlm emncsat)srrmur ;t1oleo fciatlm elnmp;u4 rtrxf ia1laDranvs s0 rtrxo iudom  lnet s)artau o;o4oexn f3iadls uln s ()aexnmo iy1fmDraneols0s2xmiopnodop  mict (  rra( pou0tlt  f3ilt sDuan o u4aeeoif todopDe uei;() etmir3io1om  liet s)sDrr(r nu1tlx mf3iatfs ranvpnu4treomfciodlateauvsl(  2tm(o3no4apeelnvtasfs2rmuro;o4aeeoiociyd a2rmuvon(0teeoioctydopDeaies ( seuo(r3iudamtn fvi s)srumu  oo0alenmf3iltfs2eau s;() eenir3todfpDeaieolt)truoxm3ny1oleelicils aDuaurpno0oeen feiysla2ulnvonu)arerxoctodopDraieils0sexm(o ny4optn ietl() Dtrxmo;o0ape ii3tad m ulnvsn(0alxnirctatfp eau i;()t2trxopiodlltemfcia(f Drr(rpoo4olxo o3tls aDraumo u4 rtoxocto1om  lieol() 2uo(r3iu1llte fesa()s2tr( ont1apenmfcildla2umump () eerxo3tydopDelues;s0t2urirpiy4apenmnvils  rrru  nu1apen i3iyd a em(mo t) etrxo ta1fpD aies;s  etrir3no1am n iesa(faDuaxr no4tlto o3ilsfaDemu o t4areomr ty1omDr ivo;t0texoxo nu1om emivils)aruaum nt4altoif3iatlmDrauvs;u0aeeoif3ia1lpteau i t)t2tmxopny4al nlfeiat)s2rmu  ;o1oex iieiys aDum( s;t0 etoxo iydopDeai i;(0 2xmir iu1opte nvsas  rtr( poo4aeto fetldfa rm( o t)aetnmo3iydfpteliei;t0s2ur(opiydlptnmfciat)s2rax  nu4olxnmo3iatfs2uanvsnu0trxoio3ootlmDeanvi;() 2toio oydape  fcsat) Dtmx oot0tltoioetyt s rluvo (4altrio oy1lateluvs;t0 eto(m3ou4llt  ivi tfa2rmumoou1altnmoeiadfa2ul( s;t)aexrmfctodfp eau o s sexm(r oodam nmnet s  ruaumo;u0tlxn ictad m2ul(vp t) lxoif3ia1omDrli o;s0texr(m3iy4omte fcsa()s2tmxronu1texo ictltfmDemums t)tlenxfctotfmDe ivi;( seumimpoydlmeemiei ( a2trurpoo4apx iiciysfaDelums ()tleoxf iadomt anvsls) ruoxm ou1ol nmnetl() Dtmur ;o1apenmoeiatlaDemumo;u) rtnifciadoateau s t0srurir iu1opt mnvt sfa2ta(r nu1texoiociadlmDrm(mp;u4arxnxfctotlaD  u ils0sexr(o oo1llt lfvtl( sDumx  ou4apx ioetasfsDemn o (0 lxoxrctotfpD lnvi s s2umxo3no1lpe mivias  2tmu  ;t0apxnmo3iyslmDrln s;t)trtnif oatlat au s s teurxrpiodop nmfvslt  rrrxm ou1olto fctat m2emnvpnt)aexnif iotom eai o;t)sexrio3oy1oltn fcsas) 2rrxm no0olto fcilt aDea(vont)trenioctodoa eluei t)t2toxm3ou4opte fesas  Dtr(mooo1olen oeiyd s rmuvo t)tlxoxr3totlmt au i t)teurimpoy1ap   ivtas) Drmxmp;t0tpenioetatls2rlu pnu) exrio oodlpD  u ilt0t2x
\ No newline at end of file
@@ -0,0 +1 @@
+i i ( trur(r3oudomtnlieia(farua(r ;u4oltn o3tytfs el(von(4 ltomocoydlm rau i s trxoxo3iodlm nmiviatfaDtm( o;o4alx mf3iytlsDeanvo t0tlenxf ia1omDeaueolt srum(m iudlmte iesl(  Drmx  ot1oet mietadlmDelnmsnt4 rtnxf oytop ranvslt  eumxo3iy1lp elfciatfsDur( pno4tltnio3iatlm rauvonu)texrxocoadla   ies t0 eurio oy4amt  net (farumum no4oetnmociadla2rlums () eerxo todoa raiei t texoxo iu1am n icia()aDrru oou0opeoio3iltfs rlump (0tltoirctydfp r ivs;t)truoxm3nodlm nlfetas) rrmumo;o1apeoif3iltfaDuan p;u0 exrioctatfpt ai ol()seum(m3ny1omt mfcsa(  2tm(  ;u0texomieiltlaDrl(vsnt4 rerif3iy1lp e ieo;(0 2tm(rpio4lptnlfetls) Duaump;o0oltoii3iatls eau o;(0arxrir3oadoatr ieols)tetr(mpio1ol  livt ( s2tmu oou0aetomoeils aDeln on(0tetoio3ta1om eaiesls0 2xr(o nodoptnlfvilsfsDumx o;o4tle ifetytls2uanms u)tltnxr3iotfa   u i (0srxrxrpoy4llt mict tfsDtmumonu1alxnif3iat s umnvonu)aeerxr3iatfat lues;t  rumxo3oo4llt mnctltfarurxro;t1alx mfctat aDemnvsnt)teeoxo ty1om e uei;s0t2urir iudame  ivs ()aDtr(  ;o0opxnmo3iyd sDeluvo u4trenmr tatoatrlu i s setmim ou1amenmnvi t a2ra( pnt0tleo f3tysfsDea( s;u)altnmocootoaD anvo (0seuoxm3iu4amenmnviat sDra( o;t4aeen ieiasfs2ran o t0teeriocootlp  aies s0s2uoir3nodlmtemnvi () 2umur ;u4tex ioctatla2rl(vo;u0 etrir3oydlpte n ols) rxrim3iy1aptemfesl(  2uau  ou0tpxomfciydlaDemu pn(0aeeomr3todlate ueo () rurio iydoptnmnct (  2trurp;t4oex  iciat m rauvon(0artoifcoodlpDe i ils)trxoxr iu4lm e fct (f Drmx pno0aptnio3iasfsDemn snu4treoif oo1lpDeaneo;t0sexr(r3ny4lm elnei s sDua( pou4tptnmoctysfm2ua( o u4aexoxociodfm  lnvi;s0t2umxo io4ol e fvt s s2tmx o;o1oet  ietasfs emn p t0texnio3io1fate i ilt teuoirpno4ol elfetat aDra(mpot1oetoii3iasfs2em( p t4alenio3tytfpDr u s;(0s2urxrpny1ape  feil(fs2rmu ono1apt  ociltfaDulnmp;u4tetoir3tadom eln o;(0sexr(m3ou4ale mivsl( a2uaxr ;u1oltomociaslaDrauvont0tltoxf ty1laDr n s t0 exr(m3ny1ap   fes () 2rmx  nt0oltniiciadls2uaumont4altnmf3iatlpt aies ( setrirpiodomen ivi t  Dtaurooo1aeeo fctysfa uau pnt4areomr ia1fp e u s;t0 2umxmpiu1ap nmicilt arrau p;o1teen ociad aDemnvpnu4aetnmrctotopte n i;t srurxopoy1apteliet sfsrtmu pnt0aeenioeiatfa2rmnmpnu)alermo tydop  luvs;s0 etoim ou4omenlfei (  ruau pot4alxo octlsfsDrlump ()altrmr3totlp rlneo (  rxmirpiu4om e feiasfaDtrxr oo1oetnmoeiasfaDran o;u0teerxfciatlmt lues t) 2umxm iu1ll  lfcslt a2tauronu4tex ifciasfa em(mo;(4 lerxr3tytlaDr i s;s t2xm(r ou1ope lfct sfsDrrxm ;u4opxn oetas a2ulnvsnu4tltnmrciodfmDeanvo s teuo(r oodame mncil(fartaxm oo1oleo oeiysfmDea(vp;u0arxnxo ta1lm r ivolt)s2xo(rpio1ap   ivt s) rtaur no0oetoiiciasfa2rlu s;u)aexomrctytla eau s;t srxo(r oudam n fvtlsf Duauroot1aet iiciyd m2rluvo;t)tetoir3iydla  luvs;t) eumxmpnu1amt  neslt)a2rmxmp;t4tetnmo3iatfmDrluvpnt0trenxo3oatfat  ieo;t t2xm(opny4apeelnctas  rtaur oo1aex  feiytfs2el( snt4treoxocoy1oatranvols  rur(mpny1alen ncias)a2urxrooo0aeeo fetlsls2ulnmonu0 eerxocoo1fpD  u o s0teuoxmpou4al  mivta(f Drrxrono0tpe  oeils mDrl(vpnu)tltoif3oa1lmDraies (0s2tmxr3io1ll nmies tfaDrr( pnt0olxomfeiadfsDuln s;()altoxrcia1lp r i s;s0 rurxr oo1lme mfcsatfartrur oo4tlxoiociydfm2ulumpn()aetnifcto1omt  ueol( tetrxrpoudol emieslt) 2um(m no1alt ii3tlslmDean pn(0tltnmf oy1fmD lnvilt  rtr(m3iu1lp nlfvt sfarraurp;t0oeenio3ild sDumn p;t4tltoir oodlpt ai o s0 eumimpou4lle lfeils srtmu ono4tlen ocias m2rlumon(4tlxrmrcoatomDeau i () rtm(o3no4amenlict () 2ur(  ;u0ole  fctytfs2ra(vs;t)texnir iodoptraivo t) exmir iu1lm  livs (  Duaump;t1opto ieild s2eanvs;(4 lerxf iotfa eauvs s)tetm(o3oydll elfcilsfs2tr(mono0aetn fctls s2rmumsnt4aleriocio1fm   uvi;t0t2uoxopiy1lpee ics sfs2uaxroot0alxoifetltlsDemumo;u)treoxfcoa1oate uvi;(0t2toxo3iy4oltemici s aDum(ro;o1tee mfeiytfs2ulumpnu4 leoir iydfaDr iei t)srtoxm no4al nlicias) Dtr(mpot0altnio3iydla rluvs;u4texnio iy1op   nvs t srtoxmpnu4ap e fesatfsDum(m no1aptnmi3tadfs rm(ms (4aetomrciytoptean ol( t2xoxo3iy4oleelfcs tfaDumur nu1apenmoetatfmDeanmo u4tltomo oadfp elnvilt)sexrxr no1om   fcil( sDta(mpot1ole if3ilslmDelnms u4 lxrmoctadopte iei s) exriopoodaptnlncsa()srururp;t1alt miciadla uauvp;u4texnircia1lmDrauvo;t t2tmxr iu4lp emieias a2umu o;u1ale ii3ildfaDemu snu4 rtrif oytlpt auvi;( teuo(opou4al   nviltf Dtrumo;t4tet io3tlt a ulnmsnt0 rxrifctotfp eluvi s0teumiopoodlleemfeil()a2ua( poo1opt  fciatfs ea(von(0tetrmrcoydlpDrli i;t0setm(rpiy4ll nmnvsls srum(mont0apenmfeils s2rmnvs;()tlenmf ia1faDelnvi;s  2uoir3ny1lle mfvsls  rtaum oo1openmfciysfa2el( p;t4teeomr3iadla r u o;(0 exr(r nydopen iciatfsrum(rp;t1apx ifetadfm2uln pnt0alxrio iatomt ln o;( s2uo(mpnu1ape lnvtl()aDtru ont1tlxomieiat s2um( p;t)aeerif3oadlpDeanvi ()seum(r io4lpe mfetas s2umx  nu0apxo o3ilslaDumnvpnu4trerif3tatopD  neol(0teumxmpiu4amtelfvsat  ruau o;u0apeoioeiadfs rmums;t4aetnir3ta1omtrauei;( setmim3oudomt  ncil(  2rmum ;o4opt if3tatfmDem( p u4alxoxrctadfpDe uvi;s0s2xrim iodamenlfeilt)arta(mooo1aet  oetas aDeau s (0tleoxocoytfa r ivi t seumir3oy1amtemnct s)srrax p;u4tltoioeiatla2ranvont)teenircty1lm   nei;t trtm(m3no1apenmicia() rtaxmoou0tetoii3iasfm2rlnmo (4teenxo oadlaD anvslt0 2uoirpiu4amt mnciat srtax  oo1aptoioeiadfs ra(vsn() ltoxociotlptrlnvi s0seumio nydoleelncs ( sDrrxro;o0texnmf3iaslm umu s t0 lxomrciytlmDeliesl( t2tm(m3oy4aptn nctl( sDtr( poo0altniieiadla2rm(vsnu)artrmrcia1lmDelnvo;() euo(m io4lle liesa()srrmur no4aptnmi3tyd mDua( o;t0tetnxf totfmD  n o t t2urim nydap nliei t)arur(r oo4teenii3iltfsDemnvont) lxomr iodlmtr u i s  exmimpnu4omtelfcsa()s2uaumooo4tpeomictadls raumsnu0arxomfctadomtr i i t teuo(r no1am nmivtas) rur( pnt1oex  oetys a2rau p;t) exnxfctydfpDrauei;s)s2tmir nudll n ies ()sDtaum ;u1tee mf3iat mDumumo (4tlxrxocto1fpDeaiei ( sruo(o iy4ll   fesat)sDra(m ;t4aptnifeilsls em(ms;u0aexnirciydomDe ueo;s0 2tr(m3ou1al   icsls) ruru o;u0ole mieiasfs2el(vo;(0alenifcootop e nvsl()t2xo(o no1ll elfeiat  rrmumpnt4oexnifciys sDeaumo;t0tetrxo3oa1fatelivol()s2umxopiydomtelfvia( arrmu p;o0alx iieiyt sDrm(mp;u4 etoxf tatomD au i;s0s2uoim3nudopt  nctas s2trxroot0tpx iociytfm2ranmpn(4 ltrir oydopDrlnvol( seurir iu1ll nlivsat a2rrxrpot0texn feiydfa2rmnmp t0trtnio3iy1lpDeau s t0s2umio no4al nlicsas s2raxmp;o1opxomfeiysls2el(vp;(0 rxnxo oatlm  ln sl( s2toio3oydapeemfvt sfsrrmuront4oexomfcilsls rau p;u4arxrmf3to1oaD  nvo ( t2trxr ny1lpe lnctatfsrrrxr ou0aeenmo3tys a eluvo (0 rtnxo todfa raivo t  etrim3nu4ome liet tfartaur nt1optnmi3iytlm eaump u)alerif3oytlpt anvol(0s2toir3iy4lm e fcsat)a2raxronu4tltnii3iltlaDrlumont0 rtnxr tatfp r nvil( teuriopoo4ap e iei t)arra(  ot1olt ifcias m raumo u)tltoircoadfptrlnvi ( s2uoxm3iudamtn nes tf 2urumpot4optnio3iltfmDeanvp ()arxrxocootoa  livsls trxoxr3iy4lm  lfvs s  rtaxrpou1opt ioetltfm uau s t0 lermo ty1fatr neo t0setoirpiy1lm  lfctl(fs2umur nu0alxnif3iatfaDumn o;() etrxr oadoa r i s;t0s2tmxmpnodlpt mnct tfs2rru  no0oee iiciydfm rmu onu4trxomfcto1fm raivi;t srtr(r no1altelnesat) Dumx ont0aexnioeiysfaDum(monu4artnxo3io1lpDr i i s truoirpnu4opte iciasf 2rax pnt1alx mfetys a rmuvs;(0teeoio3oadlm raieol()trur(mpou1am   ncsas) Drmx pnu1oetomo3tyt mDrmnmont0tlermfctotomD ln o;t)sexmxr iy4lp   ivt ()srtmxmo;t0apenio3tysla2uanvs t0tltnmr ia1lp rli i;t0 2urir nydlmtnlieiatfsDraxrpoo1olt  ieiyd m ra(mon(4 lxrxfcoatoaD  nesl(0 rurio ny4ap  lfciat)sDurum ot0tpt io3tldlm2uau on(0 lxoio3oa1fpDeluvs;() rxo(r3nudopte ies t)sDrrx pno0oeto i3iaslm2emnms;t4 lxniocoo1lptrlu s s)srtr(r3no4ome  ict s)a2tax  nt0aeenii3iatfaDuln o ()aeenmr oo1latr ues;s s2umir3io1omtemfct (farrrxr nu0openmi3iysla2rl( p t0trenif3oo1lmtelnes s  etr(o3oudalte nciat aDtmuro;o0tee miciaslm2rmnmp u0 exrifciadom raivils0trxm(m3iudoltnmnesa( sruaxrpnt0teeoio3ils mDumnmo;t4artoxocty1oa r uvs s0 rxmir3iudopeemfctlt) 2ra(ront1tleniicildfaDrl(msn()aexrircio1lm   i olt0t2tm(opny4openlfviat)aDurxmp;t0alxo fetadfsDul( s;u0 rtnxf3iatfmDelneo;s  etrxm3iu4ol elfviasfarua(  ot0olxnmoetydfmDrl(vpnt4 renir oadomteau i;t)teur(o3oo4amenlfetat)aDtmxro;o0opx ifeilslaDumu s ()areomrciatopD anvi t trxoxrpou1lmt mfcs s)s2rm(r no0aetnio3iyt aDea( s (0trerirctotfmtrli i s)sexrirpoodalt  iesl()sDuau p;t1tlto o3iasfm eanvo u0altomfciatlaD livs;()t2toim nu1aleemieta()aDrmu o;t0apt  o3tas mDulumo u0areomrcta1oatelnvi s)srxo(mpoo1omt  netls a2rrumonu4alenmocils sDua(mp;u4aetnif ta1fatr nes ( s2urio3iudapt  fcslsfs2rm( pou1aexomi3iatla um(vpnt)aetrmo3oo1lptr ieil(0s2tmim3iodlp emfesa(  Dtmxr ;u4apto o3iad aDrl( sn() etriocty1lmteaies t0t2trirpiu1lmtnmiei s srra(rpnu0aexnmf3iltfm2emnms;u0arerio3iydlpt luvo s t2xoio ou4lm e fvsl()sruaurpoo1tpt mociydlsDul(mo;(4tleomr oatopt aivi;s seuoxo3ou1lp  mnct ( arrrum ;o0apxomoctltfsDeln p t4tlxnmr3iodfmD  ivo;t)s2uoim oy4lp elfvtlsfa2uaxmpoo4tetn f3iltfaDulump ()tetnifciadoatrluesl(0t2xr(o3oudome  fvi t)a2rr(  no4texnmfeiatlsDrl( pn(0teerio3ta1omDelneslt)t2xo(r3ny4olt  fcs t  Duaumont4opx mfetasfs uluvp t) rtrxr iy1lat an o s0setoim3oo4al  lnvtat)aDrrumpnu4tleomfetys s rln o u0 etnmrcoydopDran o s srto(rpno4ol nlfcsas aDtau ono0tlto feiysla2ra(vpnu) ltrio3iydom r u i t) 2umxo oudam  micsat)aruax o;u0tetomocildfs2emnmonu4tlxrmf ootopDrli i;s0s2uo(o nydamtn ieil()sDua(m ot1apxnmo3tys m2rm( p ()aleomr iytfpDr u o;s0seur(opoo1olte ivi sf rrrurpou1oex  fciaslsDrmuvont0 rtrir iodlaDeaueils0sexrirpou4apeelivi t)arrmxmono1ape iieiad sDemuvpnu0 rtrifcoy1oateaueo t0 etm(m nodll elncs s)a2umuroot0apenifeiydlsDul(ms u)trtnxf oatopD livo t0srum(m io4oltnmneiatfsDumx pnt0optnmo3ilslmDra( snu0 lxrio3tadlmtean s;()tetm(opio4op elfctat)a2rrxr nt1alxnmf3tyt s2rmumo;()tetrmfciy1fpt ai s t0seumxo3iu1lmte fvs t a2taxmp;t1tlxomf3iytfaDelnvpn()artnxociydoate ivi;(0 eumxo nu1opeemfcsls)srtm(r ou0oetoioeiad a em(mo;u4 rxrxr iatlpteai slt trurxrpiy4ome mnvtat sDuaurp;o1altn o3iys s2uanmonu0 reoiocootoa e nes t trxr(m3oy4ll  mncs s  2tm(rooo0tlen iciadfsDum( p t)teeoxrciydfat anvs s0s2uo(mpnudll nlneia(  rra(  oo1oeenifeilsfsDraumo;t4altnio3iydfmD au ils0 2to(o oo4oleelfvi t  2tm( onu1apx  i3ilsfm2ul(mp;u4teeomocoydopteanvslt) 2trxm3oy4ll   ies ( sDuaumpou0tlt  fctys a2eanvs;u4areomo3totfp raies;s0trtrim3iu4apee ictatfsrtmur ;t1tet ioeiytlm2el( o t0alxnmfcio1fm e uvsls0 2xr(o oydam nlnct s sDtmxr no0oetomieiasfs emuvp;(4arenmo3to1lmDrlues s  2xrxopny4lmt  ivi t) 2umx p;u1tpe  i3tat a rlums;t)trtnxocoytfpDranvo;s  rtmxrpnu4ol emncs s aDtmxrp;u4alt ioeildfm ulums;() ltoxr iadlpDr ivsl(  2urir oy4lme lfct t)sDraxm ot1altn fciat m2eln o;(0altrmrcto1lptr uvil()trtoir3oo1ll emncs t  Dtaxrpnt1apeoiociatla2eaumsnt4artrifctadla r u i;t0s2to(m ny4am  mnctasf rum(m no0oeeoioeiyt sDeaumonu0altnmociytfpDeluvi s0srxmir nodllt lict ( sDumumoou0tleo octyd s2emuvsnt)alerxrcoadoateaueo;(0srtmiopoo4lpenlnvsat s2ra( poo4tpto feils s2emumont4 exrmocto1fa ean i t) etoiopoo4amte ici (  Drr(ro;u1tltnio3tydfm2eaums (4arxnxf ia1omteanvsl() rxo(m3nydom n ivi t  Drrurp;u4alt io3tadfmDrlu p t4artoxf to1lpDr ivsls)s2tmirpoo4aptnmfvia()s2urx oot4tpe ii3tltla ulums t)tetrmo3oatfat  uvo;t0sexrxmpiodop nlfesat)s2trxro;t0ole iictat a2em( p (4 rtomf iadfaD aivi;(0t2urim3nu1llenlfvi t) 2ur( ono0tleomietytfaDemn pnu4alxnircio1lptelivi t srtm(opno4om nmicsatfaDurur nu4aeto i3iytfs2elnvo ()tetomocoa1fmt an i s) 2toxm3iy4lpt  ieslsfsrra(m nu4olx iietat a emuvo;u4areoir3tatom r nvo s  euo(mpoodomtn nci t  Dur(  no4aetn ieildfaDrl(vp;(0trtomfcootfm   ivs;s0 exmio no1omtemnvtlt)srra( ono1tlt ioeild a2eanvo;t4areoxr3oa1fp  lnei s0trtrimpoy1alen ici (  Drmu p;u0alt mf3iysfaDra( p u) lxoifcootfateanvs;t srtmio3nydlptn netlt) rrmxroou1apxn i3iytfs ranvpnt)alxoxrctatfm   ieilt)texo(r iydomee fvt s)a2ra(mo;u0optomi3iyslm2ea( ont)tltrir3oodlm rli ol( tetmio ou4omt  iet s) rrr(mono1tpto ociltfs ulnvs u4 etnxo ty1lmD anesl( t2toiopnudlm nlfei s)s2ta( pou4aleo o3ild s el(vsnu)aexrmr3tydopDelivi (0t2trio3iy1optn nvi (  Dururp;o1aetnii3iydfaDelnmp;u0altnmf iy1la eln s;s) etr(m oodop elfcias)srra(r ot4tlxnif3iasfmDeanvp ()teerxf3oy1fmDrau olt setoio no1opeelnvilt  2rrur ou0tptnifetlsfa2um( o;t4aeermo oo1lp  aivi;t0 exm(o3iy4lm   ies (fsDur(ront0texo feiysfmDrluvpnu0aexrxfctytfmt livolt) eumxmpou4lmt  ivt s sDuau  ;o1tlx  feias m rlnvs;t0arxrio totoaDelnvi ()teuoxo3no4alen feta(fsrururont1optomfcilt mDumump;()altnxr oodfm  lnvils  rxm(mpiu1openlfvsa()sDtau pot4tet mo3tydlmDuauvs (0aeermfctotlm   nvil() etmxo3iu4olt licsasfaDrr(r ou1tpeo f3iatlaDuln sn(4 etnmrctodomt au ol( sexo(o oy1am n ncil()sDrmurpou0opxoifeiltla2uan p;() ltoxfctatlatraivslt sruoxr iy1llenmnetl(  Dtm( p;o1openmfetysfaDeaums;u4aetomfcoy1lateluvilt texoio3oydlltnmnctl(faDuaxmp;t0tlt moeias mDrmump;u4trtoirctadom elues t) etmir io1ll   fcta(faDum(  ou1apx  fcias mDrluvo t4altoio3iytfp ran s;()trxoimpoy1al n iet () Dtmxr ;u1alt  ictat mDrln p (4tetrmo3oydlm r ivi t0 etr(r ny1amtn fvslt arrrxmp;u4opt  ictas s2ul( s u0alxnmf3ootlpteanvolt srxrxm3ny4ol emnesltfa2tm(m ou1teto i3iydlsDumumpnu4 exomfcto1fmDrau sl(0sruoirpoy1opee neil() Drm(ro;u0ape  ietaslsDrau o t0aeerxrctatfmt luesls0srtmxm3iudomen nct s)artrx pno1olxomf3tldfm ua(vs;u4 rxrmo to1fm rauvil( trxmxo3oydopt mnei (f 2rm( pot4tetoioctadfsDrlump;(0 eerxo ty1fpD  nes;(  eurio3ou4ope  fet t) Drmurpou0apxo fciasfs ra(vo;u4aleomfcoatlatranes;s0s2xrir3oudlp n fctas sDtm( pnu0tlxo i3iytla2uau snt)artrmociydlp  lnvo t s2xm(m iu4olee iviatf rur(monu4oetn ociydlsDraump;t)alxrxociotla rlneo s srxm(m oo4lltnmfvta(fs2ururo;t1tpto f3iatfsDrauvo;t)tetoxo3oodomDe ivo s0texo(m3oo4lm emfcsas  2rrxmo;o1oexoiocils aDeluvo;u0alenmr ty1oaDr uvol(0srxrxrpiu4omtn nct s)arrmx pnu0oexn o3iltls rmumsnt4tltoxf3tydlm  anvi ( texo(rpiudlle  icil(fsDra(r no4apxn ociasfa umn onu0texnio ta1fp elueol( s2xoxm nydlmeemieta( artm(roou0teeomo3tyt s uaums u0aeeomrciydomt luvslt0texoio oodolt livtls) 2ta(  ou1tpeo oeild a2rlu o;()alerio3oatopDr nei t0teuoxr3iudomenmivs t)sDtru p;t4aexnmo3iad aDumnvon(4tltrifciydfmt lnvil(0tetmimpoy1omt mict ( srraxrp;u1aetoiieiadla ea(mon(4aeenirciadoa rlivs;s  eto(rpiodlptnmivsl( sDtmumpou4openioeilt m raumpnt)trtnmf3oadfaDraiei;t)setm(mpoo1om emfci s)aDtm(mo;o4oetn i3tad a ea(monu)teeoxfcio1omDr i s;(0sruoio iudaleelivil(f rum(mpnu4ale if3tasls2ulu o;t)treoxo tytla   u i;t)trxm(r3ny1ale  fctas  2trxront0oet  feiatls2rmuvs;(0altoir3ta1la r ueo;s)tetrio iu4alt mivsl()sDuru o;o1openii3tyd a rm( pn(0tltoxf oatfa  aneo (0 rtoxo3ou4ope mfvi ( a2raum ot0apxnmfeiyslm um( pnu0tlxnxfciy1fmtrluvi (0sexo(o3oo1olte fvta()a2taxrpno4apto fciytlaDra(mp;()tlenio tatlm r uesls  eurimpnu4am elfviatf Dtmurp;o0aleomf3tldfa emuvo;u0tlxoif oo1lat  iei s  exo(mpiu4lp n fvtls  2tru p;t0oltomoeiyt s rln p;u4 eenmf3ty1fmtrli slt  eumir3iu4olee ictlsfsDta(rp;u0tltoifcilsfmDem(mo;t0trenio3iatfpDranei;s) exrirpnudaltn fctatfsrtr(m ;t1aexnioeild s2raumo;u) lxomr3ty1optraivo;s  rxo(m nydlmt  nvi sfaDrau  nt4opxomoetatlsDelump;t0trtoioctydlateln ols  rur(m3no1al  mfeslt)aruau o;o1alxn fctydfa2um(mp;t0arxoir3ootlp eaues t t2xrxo nu4am emnvtls  Draxr ;t0opeomicils a rlnms;u) ltnmfciytfptraiesls)s2xoio oo4aleemiesls)aruaxmp;t4aee  f3tltlm eluvo t0trxrxr iy1oatrauvsl(0t2xmxmpno4ol e ncsls)aDra(m ;u0oleo ocildls2ra( s;(4 rtrxfctotfa elnei;t0 2xoxr iudlm n ncsas aDtmx pno0aexo oetadfs2rlumpn(4tltomo oydlptran ol(0srtmxmpoo1lpte fvslt)aDrmxrpnu1tex  ictysfa ran snt4aetrmr ootfate i o t)seuo(opnydol nmfvtl( sDuaxr no4oeeomfcilsfs ul(msnu0 lenir oo1laDrai slt) rtrxrpnydap  lfvi t)s2ua( onu4aexomiciasls2rmnvp;()treoxocoo1opDelu s ()sexm(o ny4lpt  neil(f Dururoou1opto ictys s rm( snu4aeerxo oy1oaD  n i;()setr(o3nu1lm nmnci tfaDtruro;o1tlt  ocilt s2em( o ()aetoxocoydfp  luvilt) rxoirpiydllt  iesl(fsDuau  oo4olxoio3tatlmDelumo;u)trxriocoodomtr ueolt)t2tmirpio4lm emnvs sf 2rax poo1olt ifciytla ea(vo u4aexomrcoytom eanvs;t s2toxo nydoltelfvs t srtm( p;o4oet iociyslmDul(ms;u)tltnirctatlaDean s;s t2umxo no1amt lics (  2tax p;u4apt mociad m2eluvs;t4 rxrxf3ty1lmtrluvs ()s2to(r nodaltelici () 2uaxm nt4tpxnmfetasfa2uanmo u0 rtrir3iy1latelieo t0 exrim3iu1oltemics s)aruaxro;t1oexo octldfs emnvp;() rxrmo3oatlateauvi;s)trxo(r ny4al   ncs s) Dur(m ot4tlenio3ilsfm emu p u)artoxo iytla e nes;s trxrir oodlpt  ivt (f Dtruronu1aetn oeiydfa2rmumpn(4areomo oodlm r u s;s0t2tmxr no1omen ieil() 2uru  ou0tleo oetlt m eanvp;t0 lxnxf3oo1lpD aiei t) rum(o3oo1al nlivilt) Dumur ;u0oexo ietys a uau o u) leoxfciytlp eliei s)seuoio iydam emietatfsrtru p;o1teenmfctydls2uau sn()aetrmrciodlpDeai i;s s2umxo3oodllte fvtl(f 2ur(r ot0aleoifciys a eauvsnt)tlerircoatoatr nvi t  2trir iy1optelicsa( sruaxr ;t1apxn icild s2ra( p;(4 etoxfctatomt  n ils)s2triopio1ame lics t)s2uaxm no1olx ifeiyslm ua(mp;u0tetrifciodomt anvs;s srum(rpny4ale  ici tf Dtm(rp;u0tltn fetltfsDelums;(4aexnxocoatla rai slt0 euo(o3ou1aptnlnvsa(f rtr( p;u0tpeoif3iad mDuluvp (0trtnmf3oadfpD ln s t0tetmim iydlmt  fvtls)aDtr( pnt4opx iieias sDelnmo ()trxrxr3ty1la ean ilt) rxo(m iy4lltnmneils sDraur ;t1aptn o3iad a2ul( o ()trtrxo totoa   ivslt0srxrxm no1ale  nesls arurxmo;t0aeenmfctyd m rlnvpn()aetoxoctadopt  n slt)seuoxr io4aptnlnvslt sDtm(rp;u0olx  oetldfm rl(vp u4 lermf3oatom raivo;t)sexrxo ou4amtelfvsas  Dtrur ot4aeen oetyt aDeanms ()alxnifcto1laDr nes;s trxoio3iydapt mncs t s2taurp;t4aeen feiatlm2rm(mp;t0trtomfcoydopD ln o t s2ur(mpou4lmee ivsl( sDumx  ;t0tptnmieiysfm2uauvs;t0trtrmf tatlp  livo;s0sruo(m io1ale  fetas arum(mo;t0teto feild sDuanms u0 lxrmfciydlaDean o;(0sruoxm3oodomtelfciasf 2rr(mpnu4tpen f3iadfsDrauvon() lxoir tatoaDe n s;s0teur(r ny1lleelfvt ()aDtmx pnu4opeoioeiltlaDrlnvo;() etnir3iodoa  lu ils sexmir3nudaptnmicil( s2rr(mpnu0tpx  oeiydfm rln o;u0tltrxfcto1opDrlnvo t)s2xrxmpiydam  lnvils)arumx ono1apt ifeiytfsDra( p t4 ltomfcoodlmtrau ils)teumxrpnodll   fvs tf rumuroou1tptoifctatls rmu s u0aleomr totoa   u ol( t2xm(mpoy4ap   iei t) rur(mp;o1opxoioeiys m2ran o t4alxomr3oadoaDr uvo (0 2xoxrpno4alt  nctlt)a2rrumo;o4oleoif3iltfm2ra(vo;(0arenmf ootfpD luvi;t s2trio3io1apte ncsat) rtaumpnt4alxnioeiydfmDulumsnt)tlxrmoctytoa e nei;(  exmiopno1op nlietls)srrmum ot4apxo ictltlsDua(vsnu0arxnxf3oatom raneo;t)sexo(opno4lp nmfctltf ruaxm ;t4opeo f3tltfm umu onu)teerxociatfa e ies (  rxmir3iu1lle mnvils  rtru p;t4apxomi3iltfm2umuvo (0aeenxo iydfaD  n o s0 etm(r3iudal nmiesat arur(rp;t4alt mi3iydla2ul(vp;u0arxomo iy1fmt  u i t s2xoim nu4om  lfcilt  rrmx pnt0opto o3tldfa uaumo;t4trtrmrctydom  lieols)tetmxr nydamtemnesl(f 2uau oou1aetoiieilt a2eanvs;u) etnxfciy1la ran o;( srtmxrpoo1altnmnetas a2ua(r ;u4tlxomo3iatls2ulump;u)trxnmf oy1oaDeauvi ( srurxr3iy4lpeelfetas)a2rruro;t1aetoifctysfmDeluvont4alxrxo oadopDe n o;(0s2xoio iydol  mnci ()sDumxmpnt1olxnioetldfmDrauvo;u0tetomo ootlaDr ivo ( s2uoxrpoodole  iesat srur(mont1aexnii3tys sDea(mo;t0arermr oa1latean ols0srto(r no4al emivilsfaDrmuroou4tlx mf3ild a rlnvo u) rerif iydlat lues s seumirpoodlpe mfvi t) 2tr(ro;u0aee  ictls mDemnvp;t)tltomf3ia1faDelivi ()seuoio3ny4optemfvias) Dtau o;t1alxn o3ilslaDranvsnu4artoio iatfpDrauei;s) exmxr3nodopee net tf Duaxmp;u1apt  i3tytls eanmo;t0alenir3oo1fpDrluvi;(0 rtrxopoy1lmtemfvt (fsDrr( ooo1alen ocias s2eln s ()aeenxfctydomt  u ilt0t2tr(o3io4lp n fci sfartmx oot0tlxomf3tyt mDrlu o u)tltrmf3ty1latrai s;t) rtoxm3oo1al emiet t)srumxrp;o0opx mi3iasfm2eau s;(4aexoxrcio1la  lnvi;s)seuoxopiydlptemnet ()arraxro;o1oltoifciatfs2rmnvo;(0altnio tadoateli sl(  etrimpny1alt  fciltfa2rr( ont1alenmictysfa uluvo;t0aetrif iadlmtraieols0 rxm(m oy4ol nlivta( sDuaxronu1oltoiociad a rln p u0trenif3iotlm eaieols t2xm(r3ou1altelfet t)srur(r ;t1ape mietydlm2rm( pnu4tetrio iotop rlnvils  eurirpou4am  licils) Dumxmp;u4oeenmf3iltla rm( pn(4 etnxf3to1opDeanvs;t0 euoirpnu4aleelieias  rua( poo1alx miciyt s2elnmpn(4arermr3oydom  an s;t seuoxopou1am   iei t)aDtmxmo;o4aetn ociaslmDrln p;u4trermrctodopteau i t)teuoio nu1ole  nei s  2ur(moou4opxn ictat s2uanms;t4tlerir ta1lmtrluvs t)trxr(o iudope livi ()s2tax pnu4tpxoiieiadfs2emu o (4 eermo tatlm eauvi s0teurir3nu1aptn iesat)sDtaxmp;t4texn ietyd sDum( p t0aeenmo tatomt  ieil(0srto(o3oydamtnmietlt)srtrump;u1tpxn icilsfmDul( s;(4alerifctadoatelneo s) 2urio3iy4lpt licsat sDum(rpnu0tlxnio3ilt aDumnvs;(0 rxnmrctatfm  livo s)sruoim3nu1al nmivia(fsrurum ou4tpe  i3tysfa ulu p;(0arenxoctydoa r uvs;s) 2xr(opoo1ol e iesas) rtmuroou1tpxnmoeiydlaDea( s t) rxnxocto1la ean olt)tetrirpno4lleelnviasfsDrr(mp;u4oltniiciatls2ran p;(4 ltoirctatoatrln i;t t2xmxr nydape miviltf rrr( ooo4aetnmfcildls rm(vo (4 rtnmf3oo1lmDelieils)s2xo(m iy4ll emictat)a2ua(mpnt4optn ietldls uau p (0 reomocto1fmDr n sl() eumxm ny1lpeelici (  2tmumoot0ale mociat aDrauvp u0 eenxf3iatla r ivolt)s2to(r3ou1lmte nct (f 2tmumpno0ale io3tysfmDrmu s t0 exrmr3tytopD  n s t0tetm(rpoodlpenlfcilt  Dtr(m ou1tetn ietlsfs ea( s;(4 ltoxocoy1fpt lnvsls)texm(m3ou1ome mfesatfsrtrxmont4apx  fcildla emnvs t4arxomf tydomDelues s0t2xoir3oy4amt mfet (  2ur(r nt1tptoioctldla ra(von(4tlxnir iytopDraivs s trxm(m3ny1alee fes t) Dtaxront1olxn feiatfsDrm(vsnu0aetnmf3todfaD aueol()srxriopno4al   fvtatfsDrau p;u0tet mfetad s rl(vo;()alerxf3ty1op e n ols) 2uo(m oy4amt  feias  2uaum ;u1apxn f3tasfsDea(vs;u) ltomrciadfm  lu s s0setr(m oo4lle  nvsa(fsruau  oo0oee mieildlsDea( o u) eenmo iytlaDe neolt0 2urxm nydlle  fvsls) 2rmum no1aeeomociydlmDulnmo;() lerxociydoaDeli o s0sexo(m iudol nlneslsfaDraxmonu0olxnifciltls rm(vs u4aexnio3oadlaD ln ils0trtmxopoudamenlfvtl( a2rmxmpnt0apxo ociytfsDeauvo;u)areomrctydomt  nei;t0texo(mpnu4al elneiat  Drru pnt0oltn ictyt a ulnvp;t) etrxrcoo1lp rlnes t0srtr(r ou1lp elnct tfa2taxro;o4optn fciltla uau s t)tetnxr3oadlm rlneols)texoxr3nodoltnmfeiltfarraum ;o1oltoifeils a2um(ms;() renmf3to1lpD anvols0sexmxm nydoltn iesl()artrum ;t4apx iieiysla2ean p t) rxrxf3oatlpDran ils0trtmxr3iydale mnesatfsrtmu  ou1olxniieiat a umuvo;(4alenio3oadoaD ln olt trtmimpio4oleemfetlt)sDra( ooo0oeen ociad a2eaumonu0tlxrxf tadlm  ln il()t2toxmpiy1opeelfvsat) rrrumpot4texnioeiat sDelnmont4tlxnxr todlm  lies t0 exr(r3iydoptn ietltfsDur(mo;t4oetn f3tltfm2umuvp;t4arxrxo totoaD  ivslt)s2uoxo3oo1op eliviat srrrxr no1tpt  oeiadfm umn onu4tlenxocoy1opteaies;s srtrim nodam n icil() Dtruront0ale mo3tltfa2eln o;u4aexomocoydopDe ueols)s2trir3iu1ape mnct ( s2rru  nu0oet mfetadfs2ra(vo;u) exoiociotoatrln sl( t2umio io4aleelfes t)srraxroot0tex mfciyslsDuanmonu4 rtrmfciatfp r n s t)t2uo(r iydamee fcsat srumur ;t4oexnifciys a2emumsnu0tetrio3tatfate nei;(  rtmirpnu1amenlfesa()srrru p;u4opeomietyslmDrl( s;u0tltrmociydfp  auvi ( t2tr(o3iu1oltemieil(  rtrur nu0aeto oetydls emn o;(4 rxnxr3oa1fa rlnei s)seurxmpiodlm emfvt s a2tm( poo4aleomf3iyd aDrmn o;u0 lxrmf to1lmDrau ols0srurxmpnu4lme  ieta(fsrtm(root1tpe io3iysla rmuvonu0 renir3ia1laDeaivs;s  2xoiopio1apte fvtas srua( ono0apx iieiad a elu o;t4 etoxocoydfpt lieo t0srtm(o3nu1lpe lneiat  rra(rooo0aexo o3iyt mDean p ()arenxfcoodla r i s;() rxm(m iydlm nlnvtlt sDrr(ro;o0apx ioctat a2rlnvpnu) rtrif3tydomDe n ol() etrxrpoy1lmeelnvias sruaxr ;o1tptnio3iydfa2um(vo u4altnxo3oydfmte n ils  2um(m iudomenmnvta() Drrxr nt4aleomfetldfa uau o;(0tlxoir3tytlat li o;t)tetoim iodom elfvtls srraxmo;o0open ociatlmDel( s t0arenifctadfptranvol(  euoxm3oo4lm  miei tfsDrrurpnt0oet  oetadfm ranmont0teenxf oy1opDe uvsl(  2xmxrpiodope mfctat)srum(  nt1aexn f3iaslm ul(vs;u)aexrxfcta1faDeaivo;t srum(rpou1lptn nctl(  ruaxrpoo1tpen i3tatfs2rl(mo t)trxoxrctytoat  i s;s0 etr(o3ny1amt  fct t)srurxronu4tptomo3ilsla rlnmo;t)trtnmf todlp e uvo;t) rumio ny4ap  mivil(f 2raurpnu4alx mfeiydlaDea( pnu4tlxomocty1fateaiei (0 2xr(m oo4am elict s)sDtruro;u1tet mi3iatla umuvo (0 ltnirciydlmte n sl( texoxm iodalen ivsls aDrmu pno0altoifctldls rln s (0texnxr3tytlpDeliesls0 eumio ny4ll emnvsa()sDrmurono4apxnioeilsfsDul(vpnt) lxnio3totopD anvi (0setmirpno4op  mneil(  rumurpoo1aptnmf3iydfs2el( onu0 etoxr3iydlp r iei (0t2uoxr ou1ol n icsl( sDur( p;o4olt mi3tlsfaDum(msnu) eeomr ootfpDeanei t  2xoir3io1oltnmici t)a2ua(rono0tlt  feilsla2um(vs;u0 eerxf tydla eai sls)sexo(r3nudamte ncslsf Dta(m ;o4oetoiictlsla2el( o t4alermf3todoptrlnvs s)srtrxm3nudalen iesl(fsDuau  ot1ale  i3tlsfm ra(msn(0tleoxo iotfmtr n s t) euoxmpoo4ameemnei t) rrrxrooo1opxoifeilt a rlu snu)aleoxf3tadfatrlu olt0srurirpny1opeemivt t)aDrax p;o0alxn ociysls2ulnmp;(0aetnxf oatlat livo;( texm(o iu4ole lnctat  2tmu ooo0oltomfeiyt mDrmnmp;(4trtrmr oadlpDrai o s0srxr(opiy1lpeemietls sDum(  nt4alx if3iltfmDra(vont)teenio3iotopt  u i;t trur(r iodlpen neia()srrru p;t0tltoifctat aDel( s;u4trenmf3to1lmDelivs;()trxrxmpno4alt  ivtas)sDum(ro;u0aexoio3ils a ulnmon()tlxnio3to1faDrau ilt0trxrxr3io4lpeemfcils sDua(r no0teen f3iasfm rluvsnt0altnxr3todlmDrauvslt)srum(opiydllt mfei tfa2um( ono4texomo3tydfm2rl(mon()alxoircta1lptr u o;()srum(mpny1amt lfctas)arrrxm ou0opx iiciad sDrm(vs u) eerxrcoa1latelivi;t  2uo(mpoy4llt mnesl( srumu pou1oetomoeiyd mDumuvont4tetrxf3iadomDeai ilt0 rxmxmpno4oltn ivsls a2uaum nu1ale  oeiltfa ulu o;()altnmr iadfp rai o;t0trurim iy1ameemivtatf rrru pnu0tlx iietasls2ea( o t4trtnmo3oa1oatran i t  eto(rpiu1ol   nes t  rraxrp;t0alxomoctytlm rmnvo;(0artomr oodoat ai slt)s2xrim iy1ap  lies t  2uauro;t0altomf3iatlm2ranvsnu0altoio3iatoaD au i (0t2trim3oy1ol n ivs s) rra(m ou1oltoii3iydlm rm(vs;t)tetoioctodfaD  nesls t2xr(m iy1op nmnvsat  Draur ;u4aeen feiasfm2rlu sn()aeeomfctytfmtelu s;( sexmimpnu4lle livil( sDtmuro;o4texomf3tasfs2rm( snu0alermf oatomte neslt setoio no4olenlnvias) rrr(  ou0aet ifetys aDuau s t) exrxfciatlptrauei ( s2umxo3oy4amen ivtlsfsrtmx  ou4opxoii3tldfm2elumo ()altnmrcoy1omDr i o;() rtr(m oudlpe  fvi sfsDtmx ont1aleo ictlsls rl(mpn(0trxrxrciytfm eln i;s  rxm(mpou1lpenmiet s)srtr(  nt1aet moeiytfs2rauvo;t4aeenir iadlat  uvs (0s2tmio3iudlmt micilt)srta(mp;t1opt if3tyt sDea(vo u) exomr iodlmtr u o;(0setrim3io4ame lieilsf Dtr(mp;t1tpxo fciltla2rm( pnt4 rxnioctotlm  lu i t)seumxrpoy4op e ncsl(faruax p;t4olto feiasla ul(mp u4aeerioctatlptelivi t  rtrxr3ny1lp n ictls) Dtau ont4opt ioctydfmDeau p u4teeomf3iatlptrluvs ()srxmxo ny4lm nlfcils)sDrru o;o0altnmoctldlaDua(vp;t0 lxnmf ta1fatrlivo;()t2trxrpio4al  livia(  rra(mpot1tlenmfeilsfs uanmp;u)alxnxfciotfaDeaiei s)s2urxo oydalte net (faDrm(mpno1ope  octld s uau s;t4 lxnxf ootfpDrlnes s) exrio nydllen fci s)s2uaxmooo1alxniictldls elnvo;u0tltoxr oytlpt lneolt)t2to(o nudol elict tfsrrmx ono0oltoifeiydfs2umu s t4aeerxo3iydla ean i;t  exm(m3iy1lmt  feilt)a2urx p;u4aet if3taslaDrmnms t)teenxo oa1lpteaiei;()setrim3nu4aleelfes sf rrru ooo1ale  fciytlmDrlnmpnu0 eerxo3iydfmteaueo;t seurir oo1oltnlici (fsDtmurp;u1aeen o3iatfsDum(vp (0texnmr3iytfm raieil( srxrim3oodalte neilsf rurxro;u0oex mfetldlsDeau on(4altomo3iodfpt ai s s0s2uoxr3oy1lle  fvs ()srtru  ou0opx moctlsfsDrl(ms;()aetrxf oodfaDr uesl(  rxmir3ny4lpee fci sfsrrr(ro;o0aetomf3iasfa2em( o;(4tlxrmf iadlpDr i ol( s2toiopio4alee ncs s)a2tmur oo1olt ifeiadlmDrlu s;u)aetrmo3iydomteluvi s0s2xm(r3no4omen ics t)s2tmum ;u0oeeomoeiydfm2eanvonu) rtnmfcoa1fpDeluvo;s  rtr(o3iydamtelfviltfa2tm(  nt0opxnifeiyslsDuan p;(4 ltomo ootfmte iei t trtrxm nu4al nmfvil( sDuau o;o4oetomocildls ua(msnu4aeeomf ta1om  auvi t teuoxr3nodlpte nesas  rtaurpoo4apx  o3iytla ul(mo;u)aexrifcoydoa rai s;s teurxrpiu1ap  micils) rum(mooo1tpxo feiad mDemnmsnu4teeoio3oa1fp   neil(  2uoio iu4lmee feiat s2umxmp;u1olxoioetld a2rmnvp;u)arxrxf iodoat ai s s0s2trxopiydam emnvs s) 2rmur ;t4ape mfcildla2eanvs;u4 ltrif3tytlaDr ueo t0 eur(mpiy1al  lietat  Dtm(mont0tpen ieiysfsDrln o;(0tlxomocoa1fmt  ivs;t0trtm(opoo4lmenmfeta() rrrxrono1oetoii3iat mDrmn s;(4artnio iydopDeanvs;t sexo(m oodamee icsatfsDrr(mpou4opx  o3tls s umuvsnu0aexnircoy1fmDrlnvsls)trum(mpnu1am nlnvt (f Duaxmp;t0tpxo fciyt aDea(vont0 lxrir3todlp  li slt0 rxr(opnydal e netl(f rtm(roou4alx ifeiyslm2rlu s;t0arxnxf3tadlmD ai sls  rtoxm3nudlptnmfeils aDtaxrpoo4alxo o3iatfmDrm( pn(0artnxo ootlm elieo;s seurim3nu4aptelietls a2tmx o;o0tee mfeild a rmnvo;t0arermfctydlat aues;( t2uoxrpno1altn ivsl(  Duru o;t1tpe miciyd s2uluvo t4trtnmo ty1opDeln s s)trto(m3ny1lmt mneilsfaDtmum ;t4tltoiiciytfmDuln o;()alxrmf oatfmDeanes s) etmxm ny4alenmnei t)artrxr oo4oleo oeiysfs2ulnmont4 rerxrcoadlptrlnvsls0trxoiopiu1op elfvtas)s2tm(m no0oeenioeiltlm emuvo t4 rxrxrciy1fp r nvs;( t2urxopoydll n nvt s  2uau  ;o1tpt iiciysfm2uauvo t0 rxrif3oa1fp eluei;s)srtr(r3no4al elici s  rra( pot4optnmiciatls ulnvo;u4aexrmocto1om eauvo (0 2umim oy4oltnlfcsltfa2rax ono4aee if3iydfm2uln o;u)tltoiociodom   i i;t0t2xr(opiydap   ieiat)sDrrxr ;u1aeto i3tadfs eanmp u)teerxfcoatlaDe u ols0 exoxo3no1lm elnetas  2tmuro;t1oetnmieiytfm rmuvs t0artrmocoytlm eanvi;( t2trxm iudape mfvi s a2uau ont1olx  o3ildlm2ranmp t0treoir todlaDe n i;t0srtmiopoy4lp elfcs ()a2rrx onu1olxoioeilsfaDra( s;t4 ltrifciotoa   n il()srtmxmpoy1lpee ietltfaDrax pno4tlto i3tltfaDua(von(0tltomocty1opte i ol(0 exoim3nudaltelnct s srtaxmo;t0tlt  oeiyd s2rmnvpnu4aetrxo oatlaD anvslt)srtmxo ou4lpeemnetl(faDrau ont4aexnmi3tlsfm elumo;(0 rxnifcoytlp  lnei ()s2um(m oy1lpeelfctat sDum( pou0alxnmo3iasfa emn p;t0 eenio3oydlpte nes (  2xm(o no4ame lfes s)sruau ooo1apx  ieiysla ulu p ()trenif ootlmDrln i;s0t2trim oo4am n nviat aDuru p;o1aee  oetas mDulu onu) exrxo3tatfm  an o;t)srxoxm no4al emnetlsf Dur(m oo1tpeo i3iatfa2raumont) lxrxfciy1lat aiei t  exoxrpnodameelivta(fsrtmu  ou4alto o3tytfa emn p ()tltnio3oa1fmt lueslt t2tr(m3nu1lmenlici tfarrr(  nt1apxnioctadls um(mp u4arxnxocoo1opDelnes;t0s2trxr iy1lpenmivt (farta(rpou0tpenmfctadls rmuvo;u4alxriociadfaDelu olt s2xmio nodlm n iesat a2umxmont4tpeomi3ild a elnmsn(4tlxomr todoatranvi s0tetrir ou4ap emiei tfsruaxro;t4aetnmictltlmDem(vsnt)artrio oa1la e ivi;s0t2xm(r3oy1olenlivil()s2ur( oou1oetn oetls a2ean o t0artrir iatlaDeau ilt0t2toiopno4lmtnmfcs (fa2tmurpnu4tlxnmoeiyd m rlnvs u0aetoioctadlpteaivo;t0t2um(mpny4lmtnmfcslsf 2tr( pnt1oet ii3ils s2emuvs (4tetomf3oo1la elnvo;s0t2urxrpno1lp nmnvsl( sDtruro;o0alt ii3iytlsDulu o ()texrmrcoo1op elieo t  rtm(mpnudlp  micslt) rrax  ;o0oleomocild m2rlnms t0 rtnmf3iytlm r ies s) 2tmxo3ou4alen ivias  2tm( pot4texn fciad aDrl( o;t) eeomf3oodfmDr ueo (0trurir oo1ap  mfvtl() Dtr(m no4aexn o3tlt s2raumsnu4tlxoif3tytoa e n ol()sexm(r3nu4amt lnetl()s2rau  ou4alxoif3tlsfs2umu snt) rerxrctydoat  ieo;t0 rurxo3nu1ole lnei (f 2rrur ou0aet  fciasls2umnvs u0texrxfctodfp eau ils0srxoxo oydlptnmnvtl( sDrrxmp;o0apen fetatlmDrmnvp;t0areomr iotopt livs;(0srur(opiu4lpenmictasfa2trx pnt4tleomictydlsDulnvs;t4alxoio3tatoat  u ols)s2umio3io1apeemivias s2ua(mo;t1aee  i3iyt m2rluvs;u4artnirciytfptr neo;s trurir iu1alen fci (farraxm ;o1opxnioetadlaDelu o t) etnmo3iydfpt  uei t)tetoxm3io1aptelfcia(fsDtax p;t4alx io3tytla ra(vs u4 rtoir3iy1lmDelnvilt trxoimpno1al emfvsa(f 2ur(rpnt1aexn o3iydfaDumn s;u) exrircoo1om rauvi;t0trtrxr3oudap   fct t sDrrumoot1tpxniociadls2em(vsnt)tleoir3oodlp  luvo t0t2umio iy1ll n ici t)srua(rooo0opxn fcildfm2ea(mp;(4tetoif3iy1optran i t0s2xm(o iodlp n nesat aDrrxr oo4tpe if3tlslaDemnmpn(0 rtnmoctytlm rluesl()sexoim iu1oleelfct t  rtmu  ;t4tleo i3tldfm umnmo t) renmfciadomtr nei;( setrxmpou1omenmfviatfa2uaxrpou1tpe if3iad m emuvs ()aexoxfcia1fm  ai i;t0 2tr(o3nydoltelfvtl( s2rmx ono0tpt  ictlt s rluvs;(4artnmocia1oa eluei;t0seum(o ou1op nlfcsa()a2rrxmp;o1tlxnmieild sDea(mp;t0tltnmf3ootfpDrln slt  ruo(m3oy1amee netlt) rrax  oo4ope iiciytls2um(vp;u4arxrxr oydopt anesl()s2xo(m io4ol  mnvtas)a2rr( pou0tpxomoctyt a2emuvonu0trtnxr iotfaDr nvsl( truo(m3iodllte ies (fsrumumo;o0aetomo3iyd a um( onu)tlxoir ta1lmD luvols) 2umxopio1openmneilt aDuaxr ot4oexo oeiaslm2ran o;t) lxomrctatlaD auei s trtm(r3ou4lp e fcs s  2raur ;t0aeen oeiad a2rmu sn(4 exoxrcoodoa eln sl()srto(r iy1lp elnciasf rumxrooo1teen o3iasfmDeauvs t)aexoxr3oytlatr ueo;( srxmxo3iy1oltemncslt)srtmxm ou0aee mieiyd m rmuvp u0artomr oo1fat anei t0sexm(m3iudal n netl(farrr(  ou0olenmiciysfa eau s (4 etnmoctadfa r n il() eumxo nudamtelfvsls a2ta(ro;o1oexnmfeiyslmDea(mont)alenxo3oodopt lies (0 2umio iy1omeemnvs ( srraumo;o0opt  feiys sDrl(vpnu)alenmf oo1lm eaivo ()t2tmxo nodap nlict (fsDrm(moou4ale ifctyt aDrm(mp;() renir oatfmt lnes;()srto(o3nudlmenmfvs ()sDtr( ont4tle ioctyt mDean o u0treriocoodlmDeluvsl(0 2uoxr3io1al elies () Drmumpou4tpx iietydfs uanmo;u4teermr oatfpDrau sl()trxmxm no4lpt  fvsasf Drm(rooo0olx  fetasfm2rmn on()trenmfctadfpDrai sl() etoxo iy4lm n fet ()srrrxro;u1teeo ociad m em( p (0altrmfcoy1latr i slt sexo(r io4lpe liei (  2rmurpot0tpenio3ildla2uan p;u4artnxfcta1fp eli il(  ruoir3iy1omen nes t)artau  nt1opeo fetad s eauvpn(4 lxnmr3todlmDeanvols0 etoim3io1ol e iciatfsDraur ;u1apxomo3tad s eanmpn(0tlxnmr3iydoateluvi;s0 2ur(rpny4lltn fetas sruaum nu4tltnmfciatfmDrmn s;u0trtnif3iytfateaues;()teuoxr3ou4lpe lncsl()aruaxrp;o4tpeomociatfa rmn pnt0aetnxocoodlm  lnvi t s2trim3oodop nlieslt  Drrx oou0oetn fcilslsDeau p (0 ltomrcto1fpDranvils  eurir3nydll  lnvil()a2tmumooo1aexnmfetytfm uauvpnt4trtoxoctydomt  nvs;s0truoxm3iodllte fvtas) Drrx o;t4tpxomocilsla2eanvo;(0areoxr oy1fmD lueolt) euo(rpoy1omen ieia(f Dum(mp;u4ope ii3ias aDulnmpnu0aeermr iytlpD ln o;s) euo(o3iu4amtnmnetltf Draump;u4opxn ietlslsDum( s u)alerxf3oa1opteauvs t s2xoir3iudape mnesa( sDtm(mo;u4altn i3iysfm rluvsnt4tlxoifctytfpDrauvo;(0s2xo(r oo4oltnmnvsl(fartmx  nt1tpe mociadfm2uanmon(0tlxoir ta1omD  nvo;(  exrxmpiydol  mietlt) Dtau  ou4apx ifctadfa rmuvpnu4 rtrioctatfp  ln o (  2xoiopoy1olen ieiat  2um(rpou1oleo ietysfa ulnvo;t4 renmocoy1laDe nvi;s0 rxo(o3iydom   nvil(farra(ronu0tle ii3iad sDrluvont0tlxoio tydlmDrauesl(0t2uoxm oudlpeemieias srtmumpot1olt  icils s um(mo;() exnio3ia1fp   nvi;(0setmxm nu1lleemnvsltfaDumx o;t1oltomf3ilsfa rmuvp ()arenxr totlm ranvi;(0srurxopiu1lpt  ieil( s2tm(mpnu0tlx ifetldfa rl(vsnt)trxnxrciytoa r ivs t0sexm(rpny4lleemicil( aDtr(  ot4openifctadla umu o ()tlxoxr3iadlaDean o;( s2umim3oy4lp nlfctat)arurumo;u0alxnmociysfaDulu o t0 eeoio ty1fmDr ieo t) rumxr3ny4al e fetas aDtax ont1aleomfeiysfaDean s;u4aetomf3oatlp eaies;(0s2xrxrpoodamtn fvs t)a2rrxrp;t4tpxo oetldfa el(mo;u4 ltnmf ia1lmDe ies;t) 2xr(o3iu1op nmietas srra(m oo4ole miciadfa ulums u0texnir3oatfpDe nes;t  rurir nudal   ieil( aDrau  oo0aptomfeiad m eaums u)tetomr3oatfmDeliei;( texmxr3oudalenmnetasfa2tm( o;o4oexnmfeilt aDrmnvs t)trxoio ia1opt lnvols  exmir nu1ll nmnvtasf 2rru pou1opxo i3ildla2el( s t)tltrifcoatfp rln s ()trur(m3oydll nlncsatf 2taxrp;u4tetnmoctltfs2ul(vpn(0 lermo iydlm   ieols)trxoir oodoltn fet t)s2tmxr ;t1tpto o3tyd aDem( o;u4 exnir iotoptraneo s)tetmir iy4lp n netl( srta(  ;t4olx ii3tlslmDrlumpn(0aetoxr oa1lpteau s () 2xoxm3nu1lltnlivsls srtru ono1texo o3tatlaDranvs;u4tltoxfctotlpDeau ols) 2xoirpoo1lmenmiesls) rtax ooo1opxomo3tytls eanmp u)altnio iatoatrlies;s)texm(o nudopt mfesasfaDrmxronu0openiicilsfmDrlums;(4alxrxr3oatlp  anes;t0 exoir3no4ol   fcs tfsrtrxr ou0tpt iictltfm uanvp;(0 eerio3ia1fatrauvi;s)trurxmpoudomee fcta(fa2rax oou4alx mfcildfa raumpn()tltrir3oa1fpD  u o (  rtmxrpoodop emfviasfsDra(rpno4tleoif3ilslsDeln o t)treomr3iadla  lues s)sruoxmpoy4aptnmiei s aDur(m nt1aeenii3iltfm um(mp;u0 lerxr ty1fmt ln ol(0 etmxm3no1alt miesls  Dta(mo;t0tpeo ictadfmDrm(vs t) rtoifctadfaD  u i;( tetr(r3oy4apee fes (f Dur(mp;t0teenmfeiydla2uanmp t0trxriociatop e u ilt)s2uo(m oudop elncs s aDta(r ;u0alenmf3iyt s2um(msnt4 rxnifcoytfat lieil(0 2xoir3ny4al emfvsa(fa2rr(r no1aetomfctyslsDul(vsnu4 ltrxr iy1lpte neslt0texmiopno1amenlfvi (farrruro;u0tltomf3ild mDulnms t)trxoif3ta1fmt aueols) eumxrpoydlpt lictasfa2ua(mp;t0opt  i3iatfaDumnvon() ltoxf3ta1fp e nvsls0 etmim3no1lltelnctls)s2urx  nt1teen ociytfmDrluvo (4 eenxf3ia1lpt li i;(0texo(opoo1om nlnei ()srraumpnu0aeeo iciad a em(vs;() rxrio ia1oa elnvo s)t2uoim3nydaptnmivil() Dtmumpnt4oleo fctls m2uanvpnu4aetrmf tydlm   nes;()texrimpnodapeelicsat) rtmxrpno0oet  o3ilslaDrm(vp;t0aeermfciadla rluvs;s0teuo(r nodomeelfes tfa2rru pnt0teeniociydla2uanvpnt4arxrio3to1fa  li i;s s2urio3oudop e ivsatfsrum(rpnu1aeeo ociltfa umuvp;()aexnio3oatfpDe ivo;(  2ur(m3nu1ol  mivt (fa2rmumpno0alxo oeiltfs emnvsnt4trxomfcio1faDraieil()s2xoxo3oy1lle mfeils)aDtaumpno4tet  fciltfmDumump u)trenmr oodlm rlues;(0 2xoio3iudlpt  feilsfsDurxmpoo1aee mociltls uau s;u) rtrxr3iydlp   n i;s0trxmxm oy1opt lnet tf rurur no0apxo fciat aDra( s;(0 eeoxr3oa1fa ran sls0s2uoim nydomt licilt s2uax oou1tptn ociatla um(vsn(0tlxnxo oo1lmtraies (  rto(mpny1lle mneslt)s2trxroot4tpto oetlsla2uanvp;u0aetoxfcoatlat  ieo;t  ruriopoudlptnliet s  rtr(  ;o1alxnmieiatfsDum(vo;(4 rtnir todlm  au o;t0trxoio ou1amt  ncsatfartmu onu0aexnmoeilt s2em(mo (4aetrxf tadfp rlivsl()trumxr3iu4lmtelivias  2um(m oo0opt mietlt sDuaump;t0aeeoircoatoat luvi t0trxoxrpoy1llenlfesat) Dtrumo;o1apeomoctlsfa uln on(4artnxo oodomDe nes;t trtoimpny1lp elnctlt)srurxrp;u1tlto fctad sDrln snu)teerxfctadfp eaivolt)texoir ny1ame  ivs () 2rmur nu4teen icilt aDraumpnt0tlxoxfcto1omt an ol()srtoiopny4al   ncs t)aDtmu p;t4oexo ieiatfaDum(mo u0alenmf iadopDran s;t  2uoxopiy1olen nvt t)arrrx pno1tleomfeils sDran s;u0 ltnmf3iadfmDeai s t  eur(m iy4ol nlnctlt) Duax  ot1tpxoiictad sDulnvon(4tlxoxr tadfa  anvs s) 2tr(m oodap   fesl( sDra( pno1tpe mieild a uan o;() exoio3oa1om eauvsl(0setrxrpoudop nlfcslsfa2um(ro;t1opxomfciytla eauvs;t4tetomo3io1fa e u ols)trtmxrpiudlp emiesltfsrumu o;t4olx mfetad s ranvsn(0 rxrif oo1om  li ol( teuoxrpio4lm nlfet s a2urxmonu1tle mociydfs ra(ms u0altoxr oydoa eaieils s2urxr nodap elicsat  Dtrxmp;u4oltomiciaslaDel( p u) lenxrcoydopte nvs;t0s2xmxmpnu1omtelnetl()s2rax  oo4tlt ifetld s2rl( pn()tlxnxfciydfp elnvi ( s2tmxm nodal e ivsa(fsDtmumpot0opto ictytfs2umumo;t4areoir iatomDean ols)teur(r oo4omtn ics () rrrur ou0oet  f3iadfmDeau o ()aleomr iadlmtr n sls  eur(opnodopeelicsa()a2rrxrpnt1alxoio3tyslmDuan s t0 lxoxo oodlpt anvil(0t2xrir nu1apenmfetasfaruaxronu0aexo o3iadlaDranvs t4tlenxr iy1lmt li o;t0teuoxmpiu4oltn ietl( aDtr(mo;t4aexnmoetldfaDulnvo;(0alxnmf iatfmDrli o s0trxmxm nydllee nvs sfa2ua(r ;o0tpxomo3iat aDelnvo u)alxrmf3io1fpteauvilt0 etmxr iy4oltnliei sf 2ra( oou1tpenii3tytfm eaumo;() rtoir3ta1late n s;( trur(m3iu4lp emnesas aDtrumoot4opxomfeiatlaDeluvp;t0 rerir3oytlp  au olt0 2xmxm oy4lmen ietl() Drm(r oo4alx io3iadfm2el(vo (0texoif3tydfaDeaies;t  rxrir iy1optn fvslt arta( pnt1alxoifciad a uaump;(4texrif3iatlpDraivi;s0 exrim3oudol elncs s)s2trxm ;u1tee mi3tldfm ulumonu)aleomfcootfpD aieo;t)setm(o iy1al  mfctlt arraxmoou1alt ioeiys m eanvo;u)trtomrcia1fmD aivs t trtmim3iudalen fcs s)aDumu o;o4texomocilt aDem(vo;(4tetoioctytfateauvslt0s2xmim ou4olt licil(fsDrm(rpnt0oeenmi3tatfm ean sn(0artoir3tydop elnei;s setoio nu1lp elivs t)arrrx  no1texn i3ias s ranvo;t) rxrmo3iytlmDelueol(0 rumxr3iydoptelnet s arra(m ;o4tlxnmf3tad sDuanmpnt) etnxfcoatoaDe iesls)sruoio3oudom e fvsa() Drax onu0aex iieiytfaDel(ms u0 etnxf tadopDe ivs (0 2urxmpiy4lmt mncil(  Drmuronu0aex mo3tltla2umn o;() ltoiociy1laDeai o;t0 rtmim3oydll nlnvslsfsrtaumpno0ope iociytfsDrl( p (4aexoxo to1fp eln i;s s2xmim3no1lmtn nctasfsDtr(mo;o0opx  fetasfs rauvs;() reoxf iatopDe uei;t s2xo(rpoudal nlnet t sDurxrpou1tleniociytlmDeanmo u4 rxoirciatlmtraies;s s2xoio3oo4amt  netas) Drr(m nt0apx mieiydla2rmumsnu4treomf3to1omtrlneo;s seur(mpno1lptemnesas sDtr(rp;t4oeeo o3iydls rm( p;t4tltrmrctotfaDrauvs;(0tetrxmpnudop  mivsasf 2uaxmpoo4olxn o3iltlsDea(vs;t) rxrxr oadoa  liesls)trtmim3oo1optn nct t)sDrax oot1tetomfctyslaDuauvpn(0trxnxf tytfa rlu o ()trxoir oy1lp n ict sf 2rru ont1alxnmfeiasfa2ra(mo u0 rtnxo3oatfmtr ueil()texo(r3nu1lmt  ivtasf rtmumoot4olxoifciydls2um(ms;u0aeenio iatopDraivi;s srtrxrpiudlpen icsls a2um(rooo0aetomfetltfa2um( o t4 lxomo iadfm  luei (0t2ur(o3no1al nlivtasfarraxrp;t0alt mf3ils a2rau o t4 lermo3oadoaDe uvi;s0t2urxo iu1aleelnvi tf rtmx p;o0tptomociydlaDelu s;t4treoxf iatoaDe ieslt  2urim3iy4opt  nviasf Dtm( poo0texn o3iasla2uan p;u)trerif3to1oaD auvo;( t2tmir iy4apt mnvt (fa2uaxrpoo4aeto feiadls rmnmp ()arxrxocty1laD aivo;(  rxo(mpno4ap elfvsas aDur(m ot4tltnmi3iytfaDua(mo;(4 etrxr3oatlpD lieo s) 2uriopno1lp n ivtatfs2tm(  nt0tptnio3tlsls eln p () leomf3oa1omt livo;t)texmir oodopenlfvs sf rtr(mp;u0aleomfetatfa2rau sn(0 rxoio3iytop r iei t texr(r no1lmee ivslsfarurump;t4tetn fcils mDea(vsnu0 rtnmf3tatlat  ivi s0s2toxr ou1om elfvtat sDrax  no0tex mfetltfm elnmont4texnmo3oadomD an sl( trtmxr3no1aptn nct tf Drruro;t4oeen o3taslaDemums;u0aetrmr3iydlpDeanvi ()s2xm(r3iu4opt  nviatfsDtmumo;t1tet  i3ilslm eau o u4 eeomr tadfa eaneo;t0tetm(o no1amen fvt t) 2umu oot4tee  oeiat m uaumonu4texrxoctytop  li ols) 2uoxrpnu4amt  nct tfaDuru  nu4tltnif3tatfs2el( s u0texrmo todop r nei s0 rtrio3nydlle lnet s) Dtax p;o1tpt mf3ild m umn pn()trermf3oatla   i o t) eurio3nydalen fcsl(fsrraxr ot1tpxn f3tadfsDul(ms;u4 lxnmo iodlaDeliei ( s2xmimpnydlp elivsas) Drrumpou0opxoiictyslm2umn o;t)alxoxoctatomtran s;() etoxo3ny4lmeelfvt ( a2urxm oo1ale mietatfm2emumpnt4tlxomr ty1om r nes;s0t2um(mpoo4op e ivilt  Dtr(r ;u0oltnifeilsfa2emn o t4 exomr3oadfaDr uvilt sexm(o ny1om elfvils srtaur nu1oex ifetlsfm2emumo t4trtnxrcoy1lpte u s s setmxopoudaltnmfvt s)a2taxm ;o1ole mf3tlt sDrmu s t0 etoxr ia1fmte u il()setmxm3ou1lpte ncslt  2ua(mp;t4aeeniieildfm2ea(vp;(4 eeomfcootoateaivs s trtm(r3io1altn fei s srumx p;o4tpxn f3iadfsDeanmp () rxnxf iotlaDe iei s0sruoim3iydape lfctlt  2um(m nt4aetn iciyd m2rm(vp (0 rermfciotfaD  u ilt0 etoxo3iu1am nlfvi ()aDrrxrpou1aeeo oeilslm2eln p t4altrmrcoatom rlivilt tetr(rpiy4am   fvsat)s2tm(mono4oeto ocilsfaDemn onu0aexoircoadop   ivslt0 2trxm nydamtn neilt  Dur(r ;o4tltnmo3iltfs emumo t0arerioctatoa e ieo;(0texm(o ny1al n iciat artr( onu1alen i3ildlm rau pnt0artoxf ootfm raiei s0sexr(o3ou4amenmiei tf Dtrx  ;o1oeenmictydls emumsnu4artoiocootlptrauei;( sexrxm3iudame mnvias  rur(mpoo1apeo octytla rmu pn() ltomr3oydfpD aivs t teumio nu4llt  ieiat sruaxrono1olx moeiadfa2emnmsnt) exnir3ta1lm rau i () etrio oy4ale micsl()aDrrxm oo4olx moeiatfa2rau s t)aleomfciadop elu s;t) 2tmio ny1omtnmnvsatf Dtax  nu1tle  f3tlslm2el(vp;u)artnif3oy1fmte i s;t0 rxr(opny4altelivsa()srtaumpnu1tpxomfeiysla2umn p ()aeeoxf oodopt lnvil(0 rtmxm3iu1ll emfvsls arrmx pou0oet io3ilslsDua( ont0 eeniocto1omteaieols0s2xoxo iodop n iesl(f Draump;u1olt ioetlsls rauvpnu0aeerxr iadla rauvsl(  etrim3nu4optemivsl( artmump;o1optnifeildla ean p t4texrxr3tadop  lnes;s s2tr(r oy1lltn iet t  Drrxm ;t1oltoio3iltla ea(ms;() leoxrciytlptrlieilt) rur(o3iy4ome micsasf rum(ront4ope  ictyd m2rmump t4alxoio oydom eaivs;() ruo(m iu1lm n fctas) 2tm( oou0ole  iciydfmDranvs (0aeeoif tatlpt au i;s) ruo(mpny4op nlnvsl()a2uru poo0oet mieild a eau o u0artomf3iytfpD au s;t t2xoxm3iy1lpee iei s artmx onu0oeen ictlsfa2um(mp;t0 etrmf oadfpt  ieil( t2xmim iy4lp  lfeils arta(mooo4oet  oeiasfa ra( s (0altnir3tadopDeln i;t) rumir3oy1alt micsa() rrau pnu4tpxn o3tlsfaDumuvo t)trtnifcootlate ueol(0srxr(r io4lm n ncias s2umx  ;u1oet ioctld m2rln s (0 exrxf3totfmt luvi t) 2xoxo no1ap  miesl(farumu  no0tpx ifeiatlsDuanvon(4 lxnir oydomte u o;s  2xoxopoudal elfeta( s2tau p;o1tpxniieiyslsDrmu on() rxnxr iatoaDe i o t trtm(m iy1apeemfvt sfaDrrump;u0oetomo3iltfsDul( s;u) rtomocoadfpte n il( srtmxr3oy1ome  fetl(fsDuaxmoot0altnifctlslmDrmu onu4 rxrif iatfmtran s s)srtmxm3io4omeelfeiatfaDtaum ;t0ope iictlt a rluvsnu)aeenif3to1omD  uei (0srtmxmpoo4lmtnmnvta()arrrx o;u1tetomfciltfs2rl(vont)texnxr3oydomt  ueo;s0 etrirpoodll elfvs tfa2rrxr nt4texnmo3iasla uan p (4tlxoifciy1lp ra
\ No newline at end of file
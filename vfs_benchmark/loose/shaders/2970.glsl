@@ -0,0 +1 @@
+ivil() rxmxo3iydam n nvt s  Dum(  ot0olt  ociatlm rmu o t)teenxr3totfpt  uvs () eum(r3oo1lltnlies t  Dra(ro;u4tetn icils s2umuvp;(4 rtnir3ta1om rau i;t) 2tr(m3oy4ol e nvsas arraxrp;o1aexnifciyt m2em( o;() lxomr to1laDe ues s t2um(o3ny4opeelnvi ()s2rmumont1opxniociat aDem(vsnu) eerif totlpDr ivs;() exrxm3oo1lm elietasfaDtr( o;o4apeo ieiatlm2emn p;(0aeeomo tytfatraivilt)sexo(mpoodal  mict s  rua( ono1apxoiictadfs2ra(ms u0 rxomo3ia1fmDr uvo t)s2xr(m3io1oltnmfctls  2tru pou0opx  ieiytfa rmuvo;(0tlxnmo3tadomtelivi;s teuoxrpiy1ll elicia(  2umum ;u4tltomocildfm2rau p () eeoxocoatfpteauvsls0 2xm(opiudll nlict ( sruaxrpno1oex if3tasla2ea( s;t)aeeomrcoo1lptran i t trxoiopiu4ome livtasfa2umxmpnt4tlxoioeiys s2ranvon(0teenxo ia1lp rlueo ( t2trxm3ou4lle  fctas)aDraumo;u1alxomo3iaslaDrmu o;t4trtrxociy1oa  au o s)sexoxr3iudop   feil()s2umuront0teeo ieils a umu p;(0aexrmrcootopDe uei;t s2uoirpno4ap nmiei (f rtmx o;t4alxnmi3iatlm eln sn()aexrmr oydoa  aieils0 rum(m3oydol elfvtls)s2uau pno4tet  fctadlmDean p t)tleoxf3iatfatraneol(0seurxm3iy1lp emict t  Dtm(m nu0alt  oetasfa2rmums;()teerio totfmD  nvs;()seto(o3oodam nlncia(fsrurum oo4oexoio3tys sDem(vp u)aeenxo oodfmt  nei ()srxm(rpno4lp emfvtltfsDrax pot4apeomieiasfmDeanvs t)tlxnxr ia1la rau o;(0t2umxo3oo4am  mivias) Drmx o;t1oleo i3iltlaDrau o;()arerxr iydopDrlu s s0srurim oydlltelneta(fsDumxroou4alenii3tldls rl(vpnt0 ltrmf tytfp eluvo;t)teur(o iu1op nmicslt a2trxr oo0tlxoio3ildla2rm(vonu)trxomo3ia1lpD  nvo ()srur(mpiydlm nmnct sf Dua(rpno1aeeniieiasfsDrlnms u4 exnxociatfm rlu ils srtr(r oydlpeemfes t  2ua(rpou4opxnmfctltfs2ua(vs;u0artoif iadla r ieolt0 eto(opnydaptnlnci t srtaumono1opxnmfetytlm rln o;t)tltrxrcoa1fptranei;s t2uoim iy4ol  lics t s2urxrp;u0aexnmo3iadfm ea(mo;(0 reomf3iydoaD  nvo t srtrxrpoo1optemfcil( srraxmpou1aeeo ictydla2ulu o t0trtnio3iatomD  nes (0s2xm(opoodome lfes ()artax ont4tet iictydls2ea(msnt)tleoxr ta1lpt  n o;()t2uoim ny1apte ncsl(farua(m ;o4aetomfciysls ua(von()tetomrciydomtrluvsls)srtoirpio1apte ici s)artruro;o0opx if3ild s2emuvp ()altrif3iytoate iei;s)t2tr(r3oy4lmeelivta()aDrru  nu1alxnii3iytfmDeanmo (4 exoxo iy1oa  anes;()s2tm(o3iydlpe mfeilt) rua(m no0tptnii3iad s umums u0 rxrxo3oytfmD anei s)trto(o3iy4apt  ivia(f rurxmooo1tlxn f3tas s2elums t4aeermr oo1lmD  neo (0t2to(m ny1apen neiat  2rrxm ;u1opeomiciad s rlu o u) eenxrcoa1op ran olt seumiopoy1omee ieiat a2rrum ;o0aleoiocildfs rlnvs () eenir oo1la e ivs;t) 2um(opoodlltnmnei t) 2ur(  ot1aee mfciatfmDumnvon(4tetnmr ootlaD livilt0 exmxrpiu1lltnlivi t  Dta(mpno1aeen f3iat m um(vp u0texnxr todfpt livo s0srtr(m iu4ole mfvt s  rurur ;t1olxoioeildfsDrl( o () rtnio oo1fpteli i;t)sexoxr3iydom   neil( sDum(r ot0opto oetysls umump;t4trtnif3iodfpDr u sls)texr(o3no4lmt  fvtltfs2tau p;t4aeenmfciltla2umnvo;t) ltoxo3oodoat livi;s trumir nodop  mfcia(  Drmumono1teeniietadfm2rmnvp t) lenif to1op  anes;(0srtm(m3no4ale  nei sfaDtmu oot0aeenmo3iytla2eauvo (0 ltnxr tytfate i sls0t2tm(o3ou1ll  micsas a2tmxr nt0olxoiociatlmDuan s t4aleomo3oadfmDe uvo s0srxm(o nudlmtemnciat arua(ront4aet mfciasfsDrl(vo u0tltrmocty1lpD anvilt0t2tr(r ny1oleemfctlt s2rrxmoou0tptnmfetlt s2umu o ()teenxocootomtr neo () rtr(o3no4omee ictas)artmxrpou0tlxo ociyd a uan on(4 eeoxo oa1lpt  neo;s tetmxo3iy1amtnmfvs t) rrrx  ;t1tlx iociyd m rluvont4altnmrcoatlmteaieslt  rxrio oy4oltnlict sf 2tmx pnt0tlto iciasfmDemnvs;u0 etrxr iodfm rluvi;() 2xoim iodame lnet s)a2uaum nu0apxoioeilt a2elnmsnu4tetoir tydlpDelueo;s texm(opiu4lp e ictas artr( oot4tpt mociadlm uau pnu)aeermr iodom  lies ( srtmiopiudomeemfeia(f Dtm(mo;t0tpx  o3tldls eauvo t) rxoir ta1lmtr nvs;(0 2xmxr iy1omtnlnvtasfs2trumooo4tleoiocildlmDemu s t0 renif3iy1omte nei;( s2xoio3nodam nlfei tfs2umx  ;u1apxn i3ilt a el(ms t4 leomr tydfpD auvs;t0 rumxmpoydomtnmictasfsrtm( p;u0tpeniocilsfm elu s t0 rxoxo iatoatrli sl(0seumirpou1alenlnvs () rra(rpou0aetoii3iltfs ra(ms;(4 lenmo totfmDrlieils) exmio3io1lm n ncta(  rua(mpnu1olx mi3ils m em(ms () exrmr3totoa   u ils srur(opiydoptelfctas s2tmxrpot1oltoifeiadfaDrauvo (4artrxfctatlp eaivi t0 2xo(o ny1am   ieiat  Dtaxmo;t4oex iieiasla2raumsnt0 rxnio io1lpD anvo t trumim3oudalee ics () Duax p;u1tlxn iciltfm2uanvs;t0artomf io1latranvi () rxrim iudam   nvta(fsDur(m ou4aet  octlsfm2ran s;(0tlxoxo3tytlp  luvi;( s2xoirpiy4al nlfvi t) 2rm(m oo4tptn fetldla2rl(mpn(0 lerir ty1omt  neils) exmirpno4olen fvs t) Dtrxmpnu0aetomoeildfa rluvp;u)alxrxo oa1fat an o ( tetrxo io4op elnvi ( srurum no1apxn f3tltfmDua( o t4 rxnmf tadlp elivo;s  exmxmpny1lpe  fctasfa2umxr ;o1tetnifetat m um(vpnu)tltrxr ta1oat li i (0setoxo io1omeemncsa( s2rrxm nt1opeoifeiltfa2umuvo u)aetomr oydopDeanei s)sruoxopou1llt lfei t  2ur(mp;t4tex iociys a uauvs;t4 etomf oydfmD aiesl(0sexmimpiydomt lfei (f rrmx poo0optnmfciyslm2rlnmp t) lxoio oydlptelu ols  rxriopoy4lm nmncsltf rtaumpou4tpenii3iasla ulu o;t4 rtrif3oatfmDeanvo;(  rtmxr iy1lm nlfesa( aDrrx  ;o1texo i3tatfsDuauvs (0alenxr3iy1fmt  uvi s t2urim3iodolt lnvslt  ruaump;u0opxomi3iadlm ea(vo t0 leoxrcoatoateanesl( s2xr(opoy1lmen icia( aDum(rpno4aleoio3tltfsDemuvont4treoxf3oo1omD lueo;t)s2uoxr nu4llt mieslt)s2uaxmoou1tlt mf3iltfsDeanmp;u4 exomo ia1oa r n i;s0 2toxopoydomenmieta()s2ra(ront1tlenmiciyd aDrlnmsnu0altnmr3ootomDrau s (0s2ur(r3nu1lltnlfesltf Dtr( oou1tltomoeils s2rm(msnt0altrmr oydfat luei;s0seto(o io4olt mnesat srtaxmooo0oeto feiltfa2uau o;t4treoircoadopD  ieols  2urio3ou1ape mies (faDua( p;u1aetnmoetldlsDul(mp u)trtoifcoy1fatrlues ( t2urxr ny4lpte nesltfsruru  no0olto fetyt aDumuvo;(4alermfctadom r nei;s0tetrio oy1ap n feta( aruaxrp;o0oet  i3tysfm eln p u4trenmr3to1fmtranvolt) exoim3ny4ole  neta(fa2rrxr nt0tetn fctydfmDulnmp;t4 ltniocio1fmDrlnvol()srtmxopiu1lp elfvsa(  2rmxmooo1opxoioeildfs2umuvo;(4 rtnir iatfmD anvo;t  rum(m ny4omt  nvils)sDtmxro;o0tet iociytlm uaums t0tlxnxrciadfmDelu o;t0t2tmxm3nu4alt lncils  rur(r ou1tlx iieias s2uau o u4 exnxr3tadoat lnvs t  2uoirpoydoptn fci (  ruru onu4aex mo3iysfm rlnmp;t)tlerxf3tytoatrliesls0t2xmxmpoy4ope mfvsltf Dtaxmooo0tltoio3iasfmDul(mo u) rtrxf3iydoa   nvs (0texo(m3iudaptnmnet t) 2ur( p;t0ape  i3iysls ulumon()aeenirctatlateanvo t)tetmxmpiudope  nvi sfs2urxroot0alx  fetatlaDra(vs;u4teerxociodfmtrln ols)trur(o nudaleemfcta(f 2ua( oou0aetnifeiyd m emump u0 rxrxociatfptr i s (0setoir3oodopeemivia()sDtaxrpnt0oexoifctlsfa el( pn(4teeoxo3ia1fpD auvo (  rtoxmpoy1al  lneilsfs2tr(ront1oet io3ilslmDrlnvp ()trxoxf oy1faD aivs;()trum(m3nudlm  mfetas)sDrau oot0opxoioeiatfa rmn s t0trxrmf3oodfmDrlivi ()setm(m3iudlmte nei ()s2rmurp;u1tlen i3ildfs umu o;u0 rxrif to1fmt  nei;s0texmxopio1op elneils) 2umu ont1tlto fciysfm umums t0teermfcoodfate i s;()teumxo iu1ole  nesatfsDtrump;o4oexn f3ils sDrluvp;t0teeomr iotoaDr n s;t)s2um(opno1lmtelfetl(  2taur no4tetn fctasfa ra(vo ()trtomo tydfpt anvi t0setm(rpny4op nliesa()aDra(m ot4alxo ietasfs2umumo u) lenmf oytom  auvsl(0 eur(o oy1omt mfvslt sDtau pot4tpx ii3tltlm elumo;(0 lxrio3iotfp   nvsl( srumio oodape micslt) 2raxr no1tpen o3iat sDrmnvon() lerio3tadfateaivo s)s2uoio oo4ome lnvs t  rtrx  oo1optniieiydfs el(vo;t)trtrxo3io1lmDe nvs s truoxr3oo1omte netat sDta(mont0alenifctltls el(vo t)altnmf3io1lptranesl(0 eum(mpoydapee nvs s  2urx  no1texoifciys aDran p;t0aetrir3iydlaDe ieols srtm(r ou1al nlnes s a2umu ooo4aptn o3iys s2rau s u)tetomo3tatopD  nvi t) etrirpou4apen ncta( aDum( onu1apt ii3iydlsDrl(mp u4trxoxr3tydlaDeauei s0 exmim3oydapte fcsltfs2tmumo;u0alenioeiaslmDrl( p u)arerxoctotoa rli s;s  exrimpio1lpeemivtlt) Dtr(m ;o4oeen octat s2rmnvp (0altnmrctydla elnvslt  rtoir no4apt lfcs s srumxrp;u4oexn o3tyslmDum(vpnu0 eermoctadfptelneslt trurxm iodaptelneias) Duaxrpno4apxnmietldla2rmu pnu)teenxocty1fatrlnvi;s) eurxo3no1alte ietls a2ta(rp;t4opx ioeildfaDel(mo;(0 lenio3to1oa rlueo t0sexrxm3iy4lltnlfesl()s2uaurp;t1ope if3tas a emnmo;u)alxrxr3iotfaD auvo;s0seumir3oudolen nct s a2rrumpno1altnmfcildfa2em(vsnt4arxnxf3iotfp e nvs;t0 2uoxo io1amt lncsa()sDtrurpoo0oeto fctatfaDua( s t0trxnif to1omDe i o s s2uoxr3oy1ap e iesat srururpnu0aeen octas a umump t)arermf3oatom r uvs s0 2xoio ny1am n fcs s)aruau o;t0tetnmfeiytls2rmn o;u) lxrio oa1oaDelu s t0trum(r nudal   fvil(  ruax o;o0apeniictldlaDem(vs;()aexrir todfaDrliesls  rxmxm3oodlmtnlietlt)sDua(rp;t1texo iciatfsDuln p t4alxnif tydlp  lues;( t2tmir oodap nmiesa(f 2um(rpno1aleo iciat mDul(vo t0tltoio ootlmDrai s (0 2uriopny1ll nlivt (fs2tm(mpnt0apx  fetat s uan pnu0 ltoifcio1lptrlu o t0 etr(m no1ol e fcia( a2tm(r nt0oleomo3tasfm2umu p;u)texrmf3oatlp eluvils s2trxmpnu4lm nmiciat srumx  no4alx  feiydlsDrlu p (4aexnxr3oodoaD  i o ( tetrimpoy1ap  lieslsf 2raumo;o1tlenioetys a2uanmon()aexniociytlmte n i s0 euo(r oudapt lnciltf 2ua(m ;u1aeen feild m2el(mont0altnifcoy1opt  ues s0s2to(m3ou4llenmiet () Duaum ot1tle iociatlmDuauvs;t4tltoif ootopt  n sl() etmio iodlmtelnvsas  Dur( p;u4olxo ociasfa2ul( pnt4trenir3ia1lmt lnvi t0 rxrir no1ll   nvi t)srrmu ooo1oeeomo3tlt sDum(vsnu0trxomf3to1oa elueols) 2xo(r nodopenmnvtl(f 2taxro;u4texo ieildla umnvont4 rtomr3ty1om elnesls t2uo(rpnudomteliet ( arumumo;o1tle if3iyslaDraumonu4tltomo3ia1oatr u s;()s2um(r oydop nmfcsa(f 2tm(m ;o1tle moeiydfmDua( s ()teenxo tatlat lnei;s t2umxopnydoptemnvtlsf rtaxm nt1texnmociytfm2el(ms t) ltrxf3tytla   nvi t)srxmxo3ny1op nlfvil(fsrtaumpnu4optn f3iadlm rln o u0trtrif3tatfatrauvsls srxm(r nu4ap n nctltfaDra( pot0ape mociytfmDelu o;u4tetrmrctadlpD aivs;s0 2xrxo3iudal elnct tf Dtrxmonu1alxnmf3ildfm2ea(vo;t4aexoiocoy1fp eanvsl(  rumxo3no4ole  ivs tfartaxroot4apxnioetyslmDea( p;()altomrciadlat auvi;( teurir3oo1lp emfvs () 2tru o;u1aetoioetas a2em(ms;u) rxoir oy1oa e u o;s0 ruoio oy4amte nvt sf rumx o;t1apxn i3iysla2rln o u) rtrmfcty1lmtraieols)s2uo(r3ny1openlfciasf 2uaxro;t0tle mfcildla emu o;(0aeeoxf to1fa  lues;(0s2uoxr ou1optelncias s2um( ooo4tlxn ocils m um(mp;(4aetomrciatopt au s;( s2umir nodlp nmnes tfaDuau poo0tetn ocildfm2raump u4aexoxocto1fmt auvolt0tetm(opiy4opee icias) 2tmumpou4apen f3tldfm em( ont)aetnif oadomDrlu o;t)tetoxm3oodape mivtlsf 2uax  ;u1oexoio3iaslmDumn ont4 renio3iodlatranvo t srur(m3oudam  lnvt () 2uaxro;u1oeto o3iaslmDumn o;()arermo3iadfa   u i () etmim3iu1amen fei t) 2tr(  ou4olxniieiytfa2um( o (0arenmf tatla rluei t)t2tr(rpiydam nmfei tfs2rrxmp;t1oexo o3tydfa2em(mp;t)tlxomfciadop  livo s0 rtrxm ny1alt  ivi s)srrmur ;o4apeomfetas sDelumo t4aexrxo3todfaDeaneo s0trtmxr io4lltemieil()s2trump;o1aeto fctad aDean snt0texnxr3tydfmte nvo;(  2xr(o nu4ale lfes t a2tm(r no0teeomo3tlt m2em(vpnt0tltoxo3oo1fpD lues s  2toxr3iy4alte ivtl(fartmxro;t0oeeo ociadlsDuln ont) rtrmrctadoaDeaivol(0s2tmxmpoodaptemiet ( srrr(r oo0tee mi3iadfmDel(vsnu)arenmo oatlm   i i t)setoxm3iudomeelnesa()arrrx oou1openmo3ildfmDelnvpnu)aeerif3tytoatean i;s)sexmir3iodope  ncs t  Drmurp;u1aet if3iadfa2uluvo;u4tlerxr3ootlpt ln s () exoxr3iu1ap nmncsls sDuaxmpno0apen f3ilslsDrlnvo t0artrif ta1lp eau s ( trto(r ou4amenmfeil()sDumxr ;u0tpx  ictlt s2rl( p u)altrmf3oytlaDe iesl()s2xoir nodameemfcs s)aDrmxro;t0olto ociydla elnvo t) lxnio3ta1oate nei;(0t2urxmpiy1apt livt (farrr(m ot0tptn fcilsfa rm(vo;u0trxrmo tatoaDrlueslt0 etmim iodapeemfvil( artmx ont1olenmicias aDrmu o u0 exnxf3tadfm   ivs;s seuo(rpoodop emfvtls)arrmx pnu1tlxnmoctadlm ea( s;t0artrmf3oodomD ln s t0sexoir3ny1amtnlnvt sf Dtrxmpou0alxnmi3tldlsDeaums;u) exrmf3iydom  lu i;t)srtoirpiudopeelietlsf rrm(root4teen fciysls2emn p;t0texnifcoadfa eln ol() 2uoim nu1llte nesas s2umxmono1tlto i3iat mDranmp;(4 lxrxociy1lp  anvolt0 rtrxr iydlmt  nvia( a2umu ont0aeen ietasls el(mpnu0 eerif3iotoat lnes t0 2xrxr3no4lpenmicta(faDtm( pnt0aptnmieiytla2raumsn(0alxomo3iotfmD  i olt)seuoxrpio1omenmfvsls a2ururo;o1tle  feiadfsDrlnms (4aeeoif3to1fatrlies;t) 2to(mpnydll e ies sfsDur(r nt1olx ioeiydlaDrmnvon(4 rermf3tadoaDe n o ()texmirpnudolee feia()srrax  ;u0tltomf3ias s2uanvo;u) rermo3todoateluvo t)t2urxm ou1om  micslt) Drmu  ;u4alxn feils a umn snu4 exrmr iotomte n sls  2urxr3nydapenmfvi t aDurx pno0opx mi3iatfsDrmnvp t0 exomo oodomtelnvil(0t2tmim nudlpe lnvtl()srtmumpno4tlenmfeiydlmDra( s;u4 lxoio iy1oaDr nvslt0 2xoir no1open ncslt)s2raxr no4apxn fetldfaDrlnmo;t4alerifciotomt luvi;() rtr(o3ny4omtemncias)s2ur(r nu1aex mfeild s2eauvpn(4tltoxo3io1oaDeauvi;t  eurxr oo1ope mieslt artr(  nt4opx  o3iys mDeanvpnt)trtnif3todfat  n i s)tetm(m iy1omtnlies s a2trum ;u0ole mociatla2emumo;t4teeoxocoatlaD au il(0texo(opno4ope  nvt t)srrrurpnt4aptniociatfs2elnmo u0trtomo oo1lp raieo;t)trxmxm3ny4lp nmnvtasf rtm(m oo4apxoio3iydfm ua( o;u4 ltrmrcoa1lp r i o;t trtoxrpoo4lptn ici t s2tr(mpno4optnmo3iatfmDem( p;t0tetomo oa1op eaueo;(0s2uo(m iu1opt mivslt)s2tmx ont4tpe  o3tltlm2uan s u0texnxf iy1fptrlnvi t  2xmim ny4omte neil( srur(mo;t1tleomoctldlm2elnvsnt4trermociy1op e uvo;t)t2tmim oo4aptnlfet t  rurur nu4oetnmfctat a ul(vp u) rxnxr oytfmtranvs;s0s2tmxo3no1olt  nesltf rrrxrpoo0apeoio3iatfa uluvs;(4tetrxf3iotomDr i s;s)truoxr3ny1omtnlictl( s2tmurpno1tptoiociytfsDeau s (0aetrmf iatfa e nvi;s s2xm(m iydolenlfesls)arrr( o;t4tlenioetad s uaumon(0texnir ta1lpDeln o;(0t2uo(r nu1lp nmfeil()sDtax pou4tptoio3ildls em(vs (0 lerxoctatomD aueols0srxmirpiy1lltelieilsfsDrr(rpno0tle io3iydfs2ul(ms;()areoifctotlmDeaues;t0trurxr3oy4lpenmncs ( srrru o;t1apxnmicias mDum( ont)tlxrxociy1fmtrluvols)s2um(o nodlmtn ivs t) Duaumo;t0oeeoiicilt aDelu s;(4aexrxo3tatoptraieil( srxm(o ny1lp  lnct ( s2rm(rpoo0tpxniietysla ul(vonu)trtoxo3iodoaDeln ol()s2uoim3oy1apen ivta()srra(monu1apxnmiciyd mDea(vo;t0 lxoir3iotomtraivils) rum(mpoy1ap e fvsas)a2ta(mp;o4oex iociatlm2uauvp;t4arxoifcty1omDelu s (0 rtm(m3oo4al e fetat  rtm(mo;o0aexnmietydls2ran s;u4tlerif3tydfat anvi t) eumxo3iudlpe mfvt sfa2tmx  ot0aexomociad s2ea(vont0aeerxocoydopDrluvs;s trxmxr oudoleelietasf Dta(m nu0teenmietadfmDum(mo;t4aetoxr3totfaDeau slt) rto(r iy4amtnlietas)a2ta( pnt4ole  ieildla2ul(mo (0tlenmfcoodfptr uvslt)s2ur(m no4oltelnvi t aDtmu pnu0apxnmo3iydfs ulnvs;(4treoio ty1fpD lneo;s seum(o3iy4ame  nviasf 2ua(r nt4tlx  f3ildlm2el(vs;u)tetrxfcia1faD au ilt0srur(opiodale  ivtas s2raurpou1tpxomf3tytfm emnmp;(4tlxoxr3ty1fateau i;s) etmxm ny4llee nei s  Dtr( oou4oetomieils sDra(mo;u)altomfcoadfatran o s t2trxrpiy4ap elfvtat)s2raxrpnt0tleniiciyt m eauvpn()altnmfciytfm rluesls trur(m3oo1alen fvsa( srumxm ou0tpxo fetltlmDran pn(4aeerircoadoaDelivolt) 2xo(rpiu1aptnlfvtasf rrmurpnt1oee mo3iasfa2uanmsnu4 rtnir ootoa   ivs s0tetrxopnu1lpee ivtl(f 2rru p;u4tleo ietyt m ra( s;u0 rxrmr3oodlmt  n ol(  exrimpno4ol elici tfs2raxrono4oexoiiciltls2rmuvo u0teeoif oadlmt aneo s0t2um(opiu4ope  ict t srra(r ;t1alxnmoeiyslm2el(vpnu4arenxocty1fm r uvil() rtmim3oudlpenmfvt s)arur(  ;o0aexnifcild aDumnvpnt0tetomf oadlmt  ueolt)sexoir nodal  lfcia(f rrr(r nt0oleomo3iydls rlnmonu)tetoir3tatlaDr u s t0 etoxo3nudalt mfvta() rtrxr no4alt ifetlslmDra( pnu4texomrcio1faDr n ols t2umim3oodol e ivs (f 2umum ;o1tetnmociadlmDrl(mo (0areoxr ia1fmteaneo;t)srum(o iu4ap e fesa(faruaxr ot4olto i3iydfm2ra(vp;u) rxoif oytlptrlueo;( t2toxrpoydomt  ncs () Drrx onu0tptomieiys s rmnvs ()aexnmo ootla   ieils0trtrxmpiodopte nvsat)a2uaxm no1aeeo ictld m rm(msnt4altrxrctydop  auei s0 rxrirpiu1om e nvsl(faDtm(m nu4opt mociys m eauvo u0areoif3oa1fm e uvi;s0srurxr3iudom nlies (  2tr(mo;o0optniiciad a ran p;(4trenif3ootfa eai o t)trurxopoy1lp elfcsl( srrmx  oo1tpt  iciltlaDeauvpn(4tltnmocia1fa  auvi s setrxmpiy1opeelncsls  Dur(r ot1aetoifcildlm ranmsnu4teenxoctodlaDelues s  2umxm oudop elivs tf rum(m ot4tet mfciltlm2ua(mo t)treoxf iatom raueols  exoirpoo4ap elictlt aDtmxmpou1tlx iietyd m2umu p;u4teenmociadla  anvsl(  eum(opou4lmte nvs ( aruax pnu4tptnmi3tls a ea(vpn(0 rxnio3oytlpDr neo (0 rxm(mpno1lp elnvt ()s2tm(mp;t4oltn fetldlmDemn snt0alxrif ootla   ivs (  etmxo nu4openmfcsl(faDuaxrpot1olt ifciad mDemuvs u0arxnio ootlaDean ol( srtr(r no1omtnlnciatf Dtmx pot0olxniieiytfs uan pnu)tltniociytlatraivo () ruoiopno4olen netls  2rm( ono4tptomi3tysls2emn onu0treoio iodopDrlueils0s2uoxmpno4omtn fei t sDur( pno0tleo icildfa umn s t)trenxf ia1omDean sls srxm(o3oodol elivtatfs2urxmpnt4oee  o3tltlm rlnvp;()texrir3tatfpDr n i;()truoxrpnudolt  nvs t)sruax pou0tpxniieiysfm rm( o;u0 etomo io1lpD  u ilt)t2urxm ny1lmtemncslsf Drmuroou0aeeoiicilt a uaumpnt) etrmo3ta1lp elivi;t) etrim3iodomeelnctasfs2rmu oot4aeen o3ias m2uau p;u)alxomr3ootfmtranes;t)seur(m nu1op emfct s) Drau  ;t0tee iictyd a2eln p;t)arerxo iydla e u s s) rtmio ou1om nlfetlt)arumxmo;u4opt mi3ild sDulumpnu)altoxociotomDelivslt0srtr(r iydomenmnvtasf 2ra( onu4aee if3tys a uau pn(0tlerxrcio1omt  ues () etmiopoy1op   nciat) rta(rp;u0tltn i3iltfaDuanmsnt0aexoif3iotopt aies;s0sexmxr ny1alenlnct tf rrax pno1aexo oetasfa2ran o t0aetrircoodom r nvs;() rum(mpno4om nlfvs t a2rr(root1optnmi3tasfsDrmnmo t4 etoif iotlaDr u o ( srxo(r3ny4llte fvt s)arrrxm ;u4tpe if3iytfm2eluvp;u4 etnif ootopt aneo;t0sexr(m iudamte fvtat a2rr(rpot4ole  ictls a2rmumont4 reoxocia1fateau s;s) rurim ou1lltn fcs ()s2umu  no1aet  o3tld s ra(vp;u4trtoio3tatfa eln s;(0 eto(o3oodll  lnctltfs2tau ooo4apto f3tyd a umu pn(4 eenir oadfmtr u o s) rurxrpnu4ol nmnvia(fs2trxm nu4oeen o3iatfs eaums t0 etnmoctotlmte neo;(0 2toxo oodoptemiesa(  2um(monu0olenifeils s2ea(vsnt) eeomr io1lpDranvo;s)tetmxo3nydap nlfci () rra(ro;t1open f3iadfm2rln o u0 leoxo3iydlaDr i s ()teurxo3ny4ope mfcslsfsrtm(mo;o1aex ioeiat sDrm(mo;u) eerifciydoat aivilt0setrim3nodllt lncslt aDrru p;o4alxn octaslaDrm( s;u)aeenifcia1lpDrlivs;s0t2xoio ny4lmee fet tfs2umxroot0tpe  ociasls rmnvpnt)trxrxrciytfa e u il( teuo(rpou4am e fviat) ruaumpot0aeen i3iad a2rlu pnu0 exomr tadlaD anvs;s0teumxm iodaptelieilt) 2umurpou1tpx mi3tysfs rmuvon(4trxrxf3totopD  n s s)teumxo io1am  mnci s)s2tmuroou0tltnifetltls em(ms u0arxoxr oo1oaDr n i (0setrxrpno1apt liviasfs2tru pnt4optniociadla2rlnms t)alxnxr3oodom  lu sl(0t2xmir3iodome mfeta(f 2um(mp;o1aptnifcildfm rl(vo;()tetrxr iatoateliei;( srur(opno4ole  nes ()aDtr( pou0aexomfcildla2rmnmpnt0tltoxo iatom eanvs t)tetoir iy4ol n ivi t aDum(rp;t1alx iociaslaDemnvp u)tlxoifcto1fm  aiei;t0teum(r3oo4lm e fctl( aDumxmo;t4alxomieiys a emumo u0trxomf oatfaDraivsls) eumxo3iodamtnmncsa(  rta(ro;o1aexnmf3tyd a2em(vp (4 lxoifcoytlatelnvs s)texr(o iu4lm e fcsat)arurxmpnu1aex if3iysfm ranmo ()aexoir oytfp ranei;t)tetrxo3ou4lpt  nctlsfsrrrxro;t0texomoeils m2ulu onu0 etrxr3io1lmD  u o;() etr(m nudoltn ivsl()aDrmu  ;u4teenio3iydfs rlnvo;(4 exrxo3iodfm eaivo (0t2tr(mpnodomenmnvs sfsDtaurpot0apx moetytlmDumnvs u4texrifctadlptr i i t0texm(opnu4lltelicia(f rrm(r ou4ope miciyd a2elnmp;t4trxrxocia1optr uei ()s2umxm3iy1lp   fetl() rum(m ou0oet iocias sDuluvpnt0 lerxfcoa1lpDrlies ( sexm(m no4am e ietl(fsDumurp;t1aleoioctls a2eaump t4 etnmf3tatoaDelnvil()t2xoio3io4lptn ivsls)sDrrurooo1alenmociltlm2rl( sn(0 eenmf3oatom elnvsls) eumxopiodlpen nct t)artrump;o4ope ifctldlmDrl(vo u4 etomf tatlatr ivs t srtmim3nodom emfetls sDrmx pnu4tpxo i3ils mDuau p t) lenxo todlp  anei () etrirpou1al nlfvt (  Duru pnu0aeenioetytls2rm( o;t0treoir iadlaDrln slt)srtmirpnu4openlnesasfa2tauro;o1aleoioeiytfsDraumo t) exrxr oatfp eluvol( seurxrpou4al  lfvsa(  2rrxm no0ape mictydls ua(vs;()aeenmr3oodlm rlneslt trumiopio4ope lfvi s aDtaxro;o1aee ii3iytfsDumnvs;(0tlenxr tydopDe ues;( setrxr iodale lfviat aDtmxr ou4tlen o3iysfaDran onu0altnmr3tadoptr uvi s trxoir3oydapt lnei s)aDum( pot1olen ociad mDeluvp u0 rtrmo tadlptranvsls teur(opny4lmeelietls s2rm( ont1tlxnif3tld m eln o;t4 eerir3iy1lp elnesls)teurxm3ou1ap nlicia(fa2rrxrp;u4alenioeias aDulump t)trxnxfcoa1lpt lnvs s srur(m ou4ol  licsas) 2uau oot0teeoio3iasfmDrm(vp u0artrir iadla rlies;(0t2uoxm oodaptn fcta()a2um( p;u0tlt io3iyt sDuaumont)aeeoif3tatlatr n i (0 exoiopny4ap  lfeils)artmumpoo1optoioeiad s rmnmp;t4alxoio oodfm   n sls) exmxmpnu1lmtemieias aDrmum ou1aee ifeiys a ua( o u)trerxr oa1laDeaiesl(0 2xrimpoydale  nvtat)artmur no1alenmi3iad a el(mon(4 exoxr3iytlp elieo;s  rumxrpoudol   ivslt sDrr( pou1alenmieiytfs2umump;t4artnxrcoo1lmDrlnvi;()setr(r3oo4omtnmivi t  rra( p;o1opeo fctlt s ran pnu0 ltoif3oa1fpDe nvi;s  2uoirpio4ap   icil()sruau o;o4teenmoctat mDemuvpnu)alxnmr tadfatelies;s trxrxr iy4lmeemfci (f 2rm(r nu0tpt  octytfa2em(mo;t0teeomociydopDrai slt)trtrxrpno1optn nvs () rurx pnu1aexnmfciasls2rlnmp t) ltomrcto1fmDelnei t0 rxrxopoo4op nmicslt) Dtmx  ot1tptoiicildlm rmn snu0aeeomo3oytfmDeauvs t)setmio oo1olte ncsl()aDraxrono0apx ii3tydls2rlums;t) ltomocta1lp  aueol(  ruoio ou4aleeliviat a2rrx poo4opto o3tatlsDemnmo;(0aetnif3ty1oaDrlnvo s0teto(o ny4omtelnvt tf Dtrxr nu4tpe mi3tatfs rau p;(4 lerxf iytfpDe n ilt trxo(r iy1omeemicilt)aruaumpot0tltnif3tysla2eau o;u)tltnmf3todlmtrau o s) rto(o ou1amee nesltfsDtauro;t1teen o3iys sDemnvs;()aexomf ia1lm rluei (0t2xoio oy4olt mnvi s)s2raxrp;t1apxn o3iytla2rm(vo;u4 ltoir3io1lmD auvi;t0t2uoxmpiu1omtelivi s)sDumumpnu4aptnifeiatfs2em( s;t4 exrmr iotop ranes;s0srur(rpiydomtn ivsatfarua(m ;u4ale iociyslm uluvo;(0 eenmf ta1fptranei;s  euo(r ou4oltelnetlt  2tmxrono4open oetlsls ea(vp u4aeeoiocoydlp r uvo;(  rxoim ny4lmenmfei s)aDur(r ;t4oee  icilsla um(mon(4trtnir3todomt aivils0texo(o nudlp elnci s  2uau  nu1teeo ieiadfmDra(vs;()tleoir3oadlat  i ils) 2xmim3iu4om  lietlsf rrau pnt1olxomi3tadfa2rmuvp;()aeermf3tatfptrai o s  rum(rpnodom n fvs s)srraurpot0alx  ociad a2uan sn(0tetnio oatla r ues;s teum(opiodol   nciat)a2ra(rooo0tle  i3tadlsDeanmp;t4areoxociadfa elivols)trumimpno4lm nmfct (  2ta(r oo1apx ioetld m2ulnvpn()arerio ty1oa  lneo s)seuoirpiy4apt mfvtls) 2trxro;u4opx mictat m uanvpnt) eeoxrcio1omt aivo t0 rxmim nu4aleelfvtltf rum(r oo1tex iiciltfs emnvo t)alermo oytfptr uvslt) rurio3no1ol emfviatfs2urxrp;t4optnmo3iltfaDul( s t4tetomr3iytla e ivo s)s2tmxo3oodlpee ncs s)aDtaxrpou1olxn octat m2rluvpnt0aexrir3oy1lpteluvs;t0srtr(r nu4am  lnctlsfartr( o;o0ole  ocildfmDrl(mpnt4 etoxr3oo1lmtr nvs;t0trxoxm3io4optnlnctl()aDum(m ;t1tpt mociltlm2umnms t0alenmfcoo1fp rlivils)t2toiopiy1opt lictlsfartm(mo;u4tpenif3tytfs2emn snt0 rxrxf3oadfatraues;s  ruo(r iy1al emivtltfa2umumooo1ape  ociyd sDemuvp u4 eeomr oytfa e nei;t srtmimpnu4lm  mnct sfs2rrxm ot0olx moetydfs2rln s;(4 lerxo oy1latranvs () rto(r3ou1alee ivs () rtau poo0alxnmfeiyslm ulumpn()tetrxf3oatoaDrlieo;() etrxrpnodlp nlfvsat)arta(mpot0ope if3iadlmDua( snt)tlxrxfciodoa rln il( srtrxm oy1oleelfcsa() rtmumpot0aptomfeilt s2uau s;u0 rxniocoadomtean s;( t2urim ny1al e ivsl()srtaxm no4aexo o3tadfm ulump;t)trenif iotfp  lu i t tetmxr3iu4amtnlncsltfsDtm( pnt1olxo oeilsfa emnmp u4aleomfciadfaDrlu o;(0t2xo(m no4amen ivilsf rtmx p;u4tet ifeilt m2rm(msnu0alerxfcoy1opD  nvi s  rum(rpny1aptelfes t)sDra(r oo0tleo fctysls rl(vsnt0altoxo oadlpD  uvi s  exrim3ou4olt mfvsatfsDta(ront1opx iietat m raump;t4trtrmrcoatoa  an i (  rumxmpoodlleemfetls) 2rm(ro;t0olxo ictasla2rlnmp u) etnircta1fmD lieils0s2tmxm oo4lmtelicsltf 2trxm no0alx miciat a elnmp;t0 etnmr tydop  lneols0 eum(mpiu1lmenmfvi (fsrrm( pot1tet iociat m2ra(vpn(4 rxriociodfatranes;s  2trimpno4ol   nvil()aDtr(mo;t0tptomicias s umn sn()alxrxo ty1oa raueils  exm(r3nu4lmte nvt ( aDraxmpnu1apxnio3ilt a2eln p u0 lenmfciytoa  aneo s  2toirpiu4omt  icta(fa2umxmont1altn fetas s ea(vont4alxrmrctytlmDean s t)s2tmxm nu4lltnmneias arur(r nt0tptoii3iadlaDuanvonu) ltoxr iydlmt  i o s t2xrxr iy4ol n nei (fa2rrxmpnt1tlxoiiciyt mDuanvonu4 exomocoo1lm e nvsls0 euo(mpiu1ome mfesa()arta(mont4tltn fetydfs ul(vp t4 eenxr oodoa e ues s) rxo(r3oo4olen ivtas) Dur( pot4tetomictyt s um( snt0trtnxociydom r ivs;t0sexoio3no1opeemfcs ()sDrmxmoot4tpt iociys m2eanmp;u0 rtomr tytlp elnvs s0trxrxmpoydlpen ici t srum(mpnu1tetn ociad s emuvont4aetrxf iytopDe n o ()t2umxm oo1om  livs t) 2rmumpnu0tpe  i3tad aDumuvo;t0 reoxociatlatean i;t)t2urim oy1amt  nesa(f Dtaur ou1alt  i3tldlaDul(ms;u)altomr tadfm  auei s setrxopiodlpt licta( a2umxroou0aetnmi3iad a2eln snt0 rxoio3iytoa   uvo s)srtm(r3iu1ale lict (f Dum(mp;t1openmf3tltla2ul(mo;u4 ltoxo oydfp  au slt) rurxr3oo1ll nmfvs tfsrtmu o;u1aptnifetysfm el( ont0trxniociatlmDr iei ( srtr(o3oo1lltelnvias aDraur ou0tpxnii3iltfaDelu pnu0alxnmrcoy1optrai il() eto(mpou4op  lneiat s2tr( ont4tetnmictaslmDrm( pn(4 exnif oatom rlnvilt t2uriopnydlp nmnei s  Drrx o;o4apen i3ilsfmDea( s;t4trxnxo3tydlpDr neo;t)trto(r iudoleelfet tfarururoou1alen i3ilslm2emnvonu)artnxrcoy1laD  uvo;s t2xmxopiodllteliciasf rrmum oo1olxniocils mDel(mp () eerxr3iatla eluei t) etrxr iy4ll n ncslt aDtmx o;o4oeenmi3iltls2rluvo;t0teeomociodfmDeli sls)srtrirpou1lmte netat)s2ua(ront1tpxoii3iysfaDrluvo;u4alenxo3tytlatraueo s0s2ur(rpoy1omt lics (f Dtmxr ;u1tetn f3tytfa uaums;u4teenxfcoa1lmDr iei;s  euoxr3oy4llt lnciat) rrmu  nt4olt mi3tysfa2ea(vo;u0 rtomf3oatopteanes;( seumxo no4ameemfesa() 2ur(ro;t1tle  iciyd a2uanvpnt) lxrmr tytfm  aneo;t)sruo(r3no4lpt  ieia( sDumxr nt1tptoioctadfmDrlumpn(4 eermrcootom rlnvils0trto(m iu4ll   fciasfarraur ou0olen o3tlsls2eln onu0alxoir3oy1oat lu slt s2xrxm3oo1amtemieiat arurxrpno1ape io3iadlmDeauvp u)alxrir3todopDran s t0s2xm(mpnu4lmt mict sfa2ra(m oo1aetn ocils m2eau s;u4 ltnmr3tatlat an s ()setoxo nudoltnlncia(f 2rru  no1tpx mietld mDrlnvp u0tltnif io1fm rlu sl()texmxopno4aptnlncsasf 2tmxrp;t0aetomoctysfsDeaums;t4 exnmrcia1lm   iesl()t2toxo ou4apt  fvta(f 2ua(rpou1tpeo f3tltla2ul( o u) etrxo3to1omD ln ils0trtm(mpio4ole miciat) 2tmu pno4tlxniociyt sDeanvo u4trtrmo3iy1fa rauesl(0t2ur(opiu4llte fvsl( sruru o;t0olenifctat mDuaumo;u4treoircoydoaDr ivi;t0 2tmxr3oudolt lfesa()aDrmxmp;u1tpxn f3iysla um(msnt)aeenxr iadlmt anvi;s sruo(opiodamt  fvsat  2rrurpot4ale  octys a uluvp ()tltoxocty1omt  u o s)texrxo3iydomt mncils) rrrxrp;o4apen f3ilsfmDrluvp;u0 lxoxr3oo1fpt ai s;( s2tmiopnu4opeemnvsas) 2urxm nu4altnioetlsfa2ea(vp u)arxnmo3iydfmD an ol(  2uo(r oo4am nliesls) Duax  ou4texomoctasfsDra(vp;(0aeenmo oydfmtean s s)s2trim nydamen ncsasfsDur(r ;u0apxnio3tld sDum( o;(0 rxnxocoydlm eau sl( t2xrirpoo1oltemnei tfaDta(moou1aeeo fciytfm2emuvo (0 ltrxfcty1oa   u il()srtrio3ny1lm emfcs s)a2tax ont1tptn ictatlmDum( o;u4aeenio3iadlpD li s;s0s2xrimpio1ll elncsatfsrraur ou0optn f3tldla2uan pn(0texrmo iatfpDrlu i;s srxrxm3iy4optnlnesl(fa2tr(mp;t1tetnmf3iydla umu s;(0 lxoxf3iadom r nvo;()t2umxr3ny4omenmiet s aDrmumpou1aetn fctldfsDelnmsnu0 etrmf iotfmDraieols)t2toiopnu1lptelnesl(fs2ua( ooo0tpx if3tytfs em(vs;t0 eeomf3iodomtr i ilt0trumxrpoo4ap  lnes s s2umx ont1oleo feiadlsDrlu p;u) lerxo tatfmte i i;t) etrim3iudlp   nvt t arrm(mpnt1tpxniociasla eanmsnt0 rxnifciytfmt  uei s seuoir3oudale lnetls  Drm(rp;t4aexnmf3ias mDemn p u)alxrif oatoat  nesls)sruoxo iudop  mfvi tf 2tm( o;u4aexniieiytfa ea(vs;()tetomo3iy1fpDrai slt)trxr(r3iu1olt  neias  2uaxm ;u1tptoio3tydfs2eanvo;u4 rxnmr ta1fptr ivo t0srxrxr oo1om  liesa()a2urxmoot0oee iictas a2uln p;t4tlxrio3ootopt  neo ( s2xr(m ny1ape mictat srtmu  ou1oltnmo3iytlaDrm( p t0tetrxociadoateau ilt) rurio3ou4om nlieil(  Draxrpno1oetn iciyt aDrl( ont)areoxrctadlaDeanesl( t2toxr iu1lm  mnetl( srraxrpnt1opx iociyslsDra( pnu4trtnio todfpD au o;( srtrxr oy1lm nmieias)aDrrx p;t1alxomfcilsfaDul(ms;t4arxoiocia1lm e ivils  etrirpiodolenmfetas)s2taurpno1opxomf3iaslsDelump;u)aetnxrctytlmDe ieo;t) 2trirpoo1al e nct (fs2rm(mooo4oexo fctydls rmu p;u0alermf oodlptr nvi;s srtm(r3oodom emieils)a2um(r ou1alenio3tlslaDelumont4aexrmr3iydfm eaueo;( truoxm3ou1optnlncia(  Drm(rpnu0aptn fcils a el(vs;t) exnxr3iydopte ueils) exoxo3nodop n fes tf 2rau oou0tpenmicildlsDrau p;u4tltnxr3tatlate n il(0seurxm oo1lme  ncs t arum(r ;u4aexomfeiatfsDeanmpnt4treoxocoadlmt  n s;()t2xm(o3nu4lltemivsas artr(m no1tlt ii3iat a2rau p (4 exnir iodfa  aieil( sexo(m3iy4lpt lfvsas  rtm(ronu1tpxnmoeiyslmDrmnvo;(4 exoxr iydfate i o s) rtmxo3oudlptnmictl( s2ur(rp;u4altnmfciadfaDuau pnu)tleomfcoodlp rlu s;s)s2xrxopiy4lpenmnesasfs2rm(mont0alt mfeiadfs rl(mp u)trenio3iydomteli o s) rtrxmpnodopee nct () 2uau pou4aexnii3iadfm2elnvs;t)tltnxf oydlmtelieol(0 2umim3oydlm  mieslt  rra( oot0tle mieiytls ua( s;u0tetoxrciotop e n o ()t2umxrpnu1ll  livsat  2rrxmp;o0tpx ioctadfmDel(vsn(0arerxr3io1lpDraieo (  rxr(m oo4ome  ics (fa2raumoou1aex iieiatfs ua(vonu0tetoif iodfp e uvs;s trxo(mpny1lpe  fcsa()sDurxmp;o1oltn i3iadfm2rlumsnt4artomo oo1op ranes t s2xriopiodll nmicslt aDraxm ;o0oexoioeiytlm eaumont4 rtoxr3iy1fmt  n olt0srumxopoudaptelivils)arurumo;o4olt  fetytls elu s ()trtoxo3todfm e ieilt)srxo(m3oodlltnmicsa()a2tm(root1teeomi3tyd a rm(ms t)trermrcia1lpteauvo;()s2tmirpnydllee fvtas  Durxmono0opt mfetldla el( pnu) leoif oo1la eauesls t2uoimpny4ll emfesl()srumx  no1tpx ioeiadfm umuvon(4aexrmociy1lpt lies;( srxo(o ny4lmtemivi t s2tr( onu1opeoioctasfs2eaums t0tlxoxr oydfmte i i t trtr(r iu4al  mfeta( arumu  no1tleoiocildfmDuln o;()aexomo ty1fpt  u sls0trtmim3ny4lpen ivs ( aDrau ooo4oeen fetytfm2umnmont4aetnxf3oy1lptrlneolt  2urim3iydol e fcs ()aDtmuroot1aetomoeiadls2rm(mp t4 rtrioctatfaDelnes ()s2umim3oudal elfcsa( s2tr(rpou0opxo f3iasfm elnvon(4 rxrirctatla eaivils  ruo(m oodam   fvi ( aDtaxmo;o1optomfetyd a2emu s;t4tltrmf iadlatr i o ( sruoxmpny1olen neil(  Dtmx onu4ope  octyslm eluvo;t) rxrmfcoadlat  ieilt t2tm(m3oodop   icsltfa2urx poo0tlx iocilsla eanmo t4 eerxr tytlm   ivo ()texmimpoy1aptn fcia()a2trur no0openiictyslaDraumon(0tltnmociodlpDelu s;s trxrim3oydlmenmfeta() 2raxrpoo4opt  ieiyt sDrau p;(0trerxr ia1lm   n o;(0trxmim iodamenmfci (fsrrrump;u0tleo o3tatfmDrl(vs;u4 exnmf3iy1oat ln i ( t2uo(r ny4ap   fci sfsrra( o;t4aptoio3iltlsDrln o t) lenif3io1omDrauvols srtrxmpnydoltnmfesltfsrraumpot4olenifetadfmDran p;u)aexrmocty1fpDe nes;s seurim ou4lptn fci (fartmu pnu0alxnmf3iasla2umu ont) exrxr oy1lpD lu s;t)s2umxr3ou4op n icslsfartmumpnt1aexomociatfs2el( snu)aetnmrciadomteaiesls0 exmxmpny1altnmfvi t) Dtrxr ot1oeto octydla2ua(vpn(0arenmf iatoaD  ies ( t2xmim3oudaptnmnciat srua( pnu1opeo f3iatfm2rmumo;t0 eeomrctytoaDranvilt0 rxoim io1lptemfvsa(f Dtaumo;u4olxn iciad a ul(ms;u0teenmf3todlatr ueo t texoiopou1optn fvs t aDua(ro;t0oltnmoeiysfs2el( snt) ltnifcoy1faD luvs (0texmimpnu1lm e feta(fsDrrxrpou0oex  ietadla2ul( s t4altrxf3ta1laD lnvi;(0s2umxrpiodlltnmneilsfs2umu oou0texo fcilsfa2umnmp;(4 leoio tatfptrln ilt0teto(opiu4ame lfetl( a2umu  no0oetnmieiydfa2emnmont) leomf iotfa elieils) ruoir iu1amenlfvta(  Dur( ooo4oee mocildfa2rmuvpnt4altrmo3oy1lpt  u i ( sexoxm3iy1aptelicsa(  Drrumoot4texn ociyslaDeluvp;u)tlenxfciatlaDe ieolt0 eumim3oo4lm  mneilt a2tmurp;u0tptomfetltlaDuau s;t)tlenxr3tytomDrlnvo s)t2uo(o ou4lp emfesl(fs2rmump;t0olt  octysfm2uanvo;(4trxoifciatomtelu s t0texm(m3iu4alee fct t aDtmum ou0aptoii3ilsfs umnmont4aexrxo totoa e neo;t)tetm(mpoodop   feiat aDtax p;o1apeoif3iadfs2ua(von(4alenxr iodopDelnvi t) rtm(rpno1am n fvsa()sruauronu0opxoifetytls2emnvsn(0altnmf tytomt lu ils) eum(opoodlm  mictat)s2tr(  ot4tlxn ociasla2rau s;u4 rtrxrciy1fpD aneo s t2xr(mpnodol nmfvt ( aDra(  ou1opeoif3tltfm ra( pnt)aetoirctatoat anvi ()trxmxm3ny1om  lfei sfarur(rp;o1opxn f3tatfsDea( snu4tlxnirciy1oaDrlues (0texm(m iudlltelfvs s a2rrx oou1aexo fctlsfmDean o t0tltnifctadlateai o t0t2xmxrpoo4ll   fvs (  Dua(mo;u0apeo i3tlt a2eluvo;(0texoio3oy1lptrlu o;s s2xoirpno1lmt mfctas) 2taxrp;o1ole if3tlsfsDumnvp;t4tleoxo tydoptran slt0trxoir3ou1apen fvilt  Durum no0tltnif3iysls2emuvo u)teenxf3iodop  lu o t) 2toiopiu4lpenlnvsa(fsrtm( pnt4olxn fciadfa2rmumpnt0 ltrio ootla ran s;t teur(r iudole  fvs tf Dum( ono0alxnmoetys a ean o;t4aetoxo3tytlp r ies;s)srtmxm3ny1ol  mfet tfsDrmx  ;u4ole mieiadfm2em(vo;t) exoxrciy1latr ueo (0trumxmpny4ll emictas)a2rm( oou1tltniicilsls2rl(monu)trxnir3totlatelnvi t0s2tmxopiu1altnmfvs t  2tm( poo1tptn i3tldla rlnvonu0altrmrcoydoaDelnei;t0srxrxopno4lmtn fci s)s2trum ;u4alxo o3tlsla2elump u4tlxomocta1lp eln s s0trtr(m ou4omtelfeil()srta( pnu0ale iieiad sDemnmp t0 rxnir oytop   i slt trtoxr3iu4ol nmfetat a2ur(mooo1oexoioeiadlsDra( sn(4 ltnmo oytoa  lieslt0teumxr iodal e nctlt a2umxr ;t4olt  iciysfa ul(vs t4 rxrxo3tadfat lnvo;( truoxopoo1lle mict s a2urur nt0tlxn ocilslaDeluvs;t4 rxomf3oa1lpD lnvols  rtmir oy4ope  netatfs2ta( o;o0ape mocildfa emuvs u)teeoifciadfm  auvs t0 rtm(o iu4lp emieia(  2rr(rp;u4tpt ifciadlmDranmon() rtomf to1lmD  ieo;s setoxopou4al nmnctat s2umxr ot0apxn ociad aDea( p (4alxnmo3tytop  liesl(0t2tm(o iu1oleelnvtas sDrrumo;u1aet micilsfa eanmo u)artoxr3iotfatelies s0trxoirpou1optnmics s)s2uaxmpou1alx  f3iyt mDum(vp u0 reoiocia1fp   ivi ( seum(r3nodomen fcsas) 2tmxr ot4ope mo3tldfm2rmn onu) exrmf3iodoaDeln o ()teuoxopoo4olte fcia(f rtrump;o0aee moctyt a umnmp u0aetrmf3iy1oa r u ilt texoiopoudlmeelfet (faDrrxmono4tptn octltla ulnmp;(0altnmf3iadopDr nvi t0t2xoirpny1olt lfvslt arua(rooo4tlx micilt aDemu p u0 rtnir tadomDe u o (0teto(o iy4lpe  nvsas sruaur no0oleomfeilslmDrau o t0 lerxocty1fmD  ivo;t)srtmxo3ou4lpe mneias srtmxmpot4tlx micias mDrl(vpnu4alerxr3ootfaDe n ols0s2tmxr iu1alee fvilt sDua(rp;u0oexnioeiyt s2uln o u4 lxrmf tytfmD livi;t s2umxo3nudamtnlfci ()aDum(mooo1oeeo icils m2uln s t0trxoxo io1lmt liei t0srtr(mpoodoptemiciat)s2urxmont0oeeomoctld m2ean ont)tlxrxr ty1opDeln o;s) rum(o3nu4op nmiesl() Dumxm nu1aet  i3iasfs2ran pnu4 ltrio iy1lmDeanvilt srxoirpoydlmtn nci t) 2taum oo1oltoiocildfs2umnms (4altrxfcoadlmt  uvs ( trurirpiodapt lfvt sfarur(rpot4aleo feiat m ulu s;t)tltnmr3tydlpt  uvi ()texoimpnydlp nmnvi t) rumxm nt0opxnifciasfm umn p (0arxomf3iatlaDeau il(  exrir oo4alt mivt s)sDrmxm ;u1tpto ictldls eaump;u)teerifcootomDe ieols) etoim3iudlptnmictls)artaxro;u0alxo octlsfs2rlnvp t0tltrifcoodlp rlivsl(  rxrim3oy1ape mfvs t) Drmx  ;t4tee  ociad m2elnvs u4 etoifctodlmD  i sl()seur(mpiu4om emfcsat  Dumum ;t4ape  iciytlaDemnvsn(4tltnmociotlm   u ols0trtr(r3iydamt  neta( sDra(m no4tlxn i3tltfm rl( o (4aexnxo oatopDelneo;t0 rxr(r3nydlm nlfet ()sDumxr nu4optoii3iasfa rmnmon(0aetomrcia1fpDelieo;s) rxmxopio4apt liesasfartm(roou0aptn ociytfaDea( onu0tleoir ootop eai ilt trtmir no1lptemnctl( artrurpno4aetomocildls ra( o;u)alerir3ootfm rluei s) rumxm nodoptnlfesltf 2uaxmp;o0apx mictltfmDul( s;t)altnif iotoaD luvi (  2xrxo iudom nmivsl(f Dur( o;o1apx mieiyt m elu pn(0tlxrmr3ia1lmDelu i () etoxmpoo4optemicil()a2ta(mpou0ale  fetld m2umu p;t0texoio tytomtraies (0 etrxo3ny1lpen fetltfa2rrx onu4tpxn ociytfs raums u0teeomr3tytop eaneo;s teuoir3iodapt mies s a2taumoot4opxoiiciasla ul(mpnt0artoio3todfp r ueol(0t2to(opoodopeemncilsfaDraumpno1alx  f3ild m2rm(msnt)trxomr3tadlaDrlieo;t0t2uoxm iy4op nmneil() Duru poo1open octatls umumpn()texniociatop eaivs t  2uoxr nu4lp nmies tfa2rau  ou4alxoifetysla2rln p;u4 lxrxr3oydlatrlivi;s seum(m3iy1ol  livi t)arra( ont1oltn i3iat sDeluvo;(4aleriociodlpDelu ol()srxrirpiudomtnlfetl() 2raxroou4ope  octyt aDrmuvpnt) ltnio tytom  luvsl(0trurxrpnodll elneils a2rm(mooo1teeoiiciys a rl(mpn(4trtrmr3ia1fa  livs s0tetr(m ou1alenliet s)sDrm(rp;o4olt miciydfs el(msnu0aetrmf3totfmD auvsls t2tm(mpiydom  mnesls)aDtru p;t4aexniociysfsDrm(vp;(0arenmr iytlm   nvils  exoxopno4alenlfet s)aDtm(moot4ole if3ild m2ea(vs;t0alenir3oadfaD aivs;t) rxoxo3iu1amtnmivsat arrmumono0tlen i3iysfa rluvonu)alxoiocoytla  anvils0seumiopiy4lle mfetatf 2tm( oou0aexomietys aDea( o;t4tlenmo3iodlmtelu i;()s2xmxm nydlm nmictasfs2um(r ;t4tpeomietas m2uaums;u4tltomociodlatrlneil(0 ruoxo nu4ll nmiesls)aruru oot4olt  fciyt s2uan sn()arerxrciydlatran o s)sexmxr3iy4ap  lictls s2rm(r ;o1olxomoctls m2el(vp ()arxrio iydopt aiei;( texmio nu1llenlnvtlt artmxm ot0alt moeiytlm2um( p;u4altnir3oodlmDean slt)setoxmpoo4lp elfvtatf Drmur nu0tltnmo3tysfm2emu p;u)tetoio3oydfpD  nvsls0t2tmxopou1amt mfes (fsruaum nt1oltnii3iatlaDra(mpnu4trerxo oydfm elueo ( sexoxmpoo4lm   fcta( srtrumono4openmieiat s ean p;t)arxoir iodfpDe ivol(0sexmio ou1lpenmicia()srtrxr ;o1tpe ioeildlmDraumo;(0trtrirctadfa ean i (0teurxo iy1olte neta( a2taxmont4tlto iciys s rauvp t)tetrifcta1fat ai o;(0t2trxrpiy4lmt  fcias  2rm(  oo4tle iictls sDumu s t0 lxrio oa1lm eanvi s)trxrxm ou4lmee iet t  Dtmx  ;t4texn icilsfa2emu pnu4 ltrmr3to1lpt luvo s0seurir iydal   fcil() ruau onu0oee mf3tadfs ranmsn()tlxrmocoydlm ranvo s0setoxr oo1oltn neta(f Dtmumoot0tptomo3tyslaDumu p u)aetoxf oydoatraivsls)teum(o ou1ale mici s srurx onu4teenmocias mDuluvo u)arenmo3io1optrai ols s2uoim iydal n ncsls)a2ua(mpou0opx ifetys a2rmnvont)arermr tytoptrliei;(0setrxopny1al elictl(fa2tru o;u4oexnifciys m2emnmp t)tlxoxr iotfptrlu s;t  rtmxmpoo1oltemfvsl(f rumum ;o1aeen ieiydla um(vsnt0arxoir ty1laDrlieo () exm(opoy4omte ieslt artaxr ou1olxnmo3iasfm2ulumo;t4 ltomo3to1op  lieol(0srumxmpoy4lm emfesasf Drmu pnu4apto o3ildlaDul(vpnt0 eenxo iytlm  lu s;()sexmxm io1ameemfesa(  ruru poo0teenii3tld a2umn s;(4 rxrir oa1lpDrlnei s0s2tmir nu1apt  nesas) Dta(mono1aetn ociatfs2eaumsnt4aexomo iytfm rlieol( s2umxrpiudom  mfciat) rraxmont1aetomicilsfm elnmp;t0 lxrxr3ty1oaDrli slt0t2trir no1opte ncsl(fsDtaumonu0alxniociydlm2elnvsn()trenmrctotomDeanvolt0s2toxo3nu4lmtnlivs sfaruaxm ou0tee  o3tadfa2ua( p u4texrxociydomt aieo ( s2urxr3oy4am  mncia( s2ur(r nu4tleniiciytls2rluvon(4aexnirciydlmDraiei;() rxo(m oo4amtnmneilsfsDtrumpot1teeo o3tld s uanvs;t4 etrxf iadlpt aueol(  2tmim iy1olen fci ()a2tmu  nt4oexniociltls2rm(mo (0aeerio3iotopDrluesls)sexriopiydop nmnvt t sDuax onu0oetnioetadlm um(msnt4trenxo iy1fpt aues;()teurxrpoodom nmfetltfaDra(r ;o1tpeoioetldlmDumu o;t0 rxoio ta1oaDelnvilt0 2um(r3iy4lp emfeias arum(monu0aptnifetydls2eaumont0 lermf oo1fmDe n o;t) rumxo iu4ll elivsa()aDtm(m no0olt  iciyd s2rlnmpnu)texoxr3iatfm eliei t)teumxm3nu1ol   ics s arrrum ou0aex  oeiydlm umnmont) rxomrciytlpDr n i () 2xmim oo1apt livia( arrmuronu1tpt mfctyt m el(vpn(0teerxf3tadlpDranvo;s  rumio3ny1omt mictasfa2uaum no1olxnmi3tyd a2rmn s;t4aexniocoodlp  anvo ( trtoir3iudomtelivs t sDum(m ou0oeenmoeils a2el(mp t0texoio3oy1lm  lneilt0teuoxopno1optnmfeiat)srtauroot1tltn fcild aDea(vp u)aetnxo3todlmD aues s0s2trxo oydlm  micsl(faDtmxrp;t4tle  fciysfs2rmnvo;t4teermr iadfmDelu i;(  2um(opou4omt  ivias)s2rr(r no0tptomfctys sDulnvon()artomr3todoaD anvols0trum(r nydap elfes t)aDtrx pno1apenmfcils sDumu s;(4 lerxrciydlmDr uvi;s t2xoim3nudll  mnvtas sDumxmpnt0tptomicilt a2uau snt4trxoifciydfptrln o;(0setrxm iudop  mncsa(  2trxmp;u4opxn oeiyd s2rm(vsnt4trxnmo3ta1op r ieo;s0teurxr3oudllee fesa(  rraxmpnt4aexo o3tltfa2umumont0 rxnioctatlmD  iei t0teurxr3io1ll nlict ( arurumpnu0oet  ieiatlmDrauvo (0aetrif3oy1lp rluvslt0s2xoxr ny4lm elfcsa(f 2urx  ot1tleoifetat aDrmnmp t)texrif3oadomt luesl( s2xmim3ny1olenlfctlsf Dumxm nt4tlt mo3ilsfs2eau p t0 ltrmrcoo1lmDeai s s0truo(rpny4lmen icsl(farra(r oo0apxnmfeiltlsDumn pn() rxrxfcoodfpt ln ilt0 exoxo iu1lpenlivtlt)sDuax pou0aetn ictydlsDrln p u0trtnmf3ootfat lueilt0 2xo(r3oodol nliciatf Dtaxr ;o0oex moetadfa rm(vpnu)tetrxo3iotop ranes;t0 euoiopiu1lmtnmncta() 2umur ;o4tpeomo3ildlm2elu on()aetriocia1fate ies s) rxrim3iydop  lfeia(  rtmxr ou1oltoifctaslmDranvont)tlxnif3oy1fm elueo t)srurim3nydam nlnes tfaDtr( ono1optnmoeiltfa2uluvp u4 rtrmo3tatopte uei;t)srtoio no4amt  nei s)s2taumont0optnmicilsla2uln on(4trtnmrcoadfaDr nvilt0s2uo(rpou1optnlnesa() Dururpou1aptoio3ilslmDumnms (4aeenifcootoaDelnvil(0 rxoxr3iodaptnmivi t  rtm(mont1oeeoiietytlmDelu pn(4tltrmrcoo1fptrau i;s0s2tm(rpny4lmt miesasf rrmxmont4olxo feiad s eln pnu0altnxo3ta1faD  ieslt)trto(opny4olenlfetls aDrm(ro;o4oet ifctytls ra(vsnu4 rerir oadoaDranes;s seumxr oodlpe lfeslsfaDtaxm ;u1opt iieiytlm ua(mp (4 rerio3iatfp rlueo ()s2toxmpoo4lmtnliviatfarta(rp;u4tlxoioetytlmDra(mpnt) ltnxr oydlmD li i t  exmxmpno4oleemicta(fs2rmx ooo1tltnmoeiad s2emumsnu0 rtoir3ia1op eauvsls)trxriopiy1ap emfei s) Drax  ;u0oltnmf3iys s2umnmp;t) etoif oa1fat lnvo (0trxm(opnu1aptnlicils s2rmumpou4tlx mo3iltlm umnms t)artnif ta1fp eli s (0s2uoxmpiydlpenlfvils artm(rp;u1opxoiictld mDean p;(0tlermocty1lmtrau sls0 exrim iu4amte fcs sfs2uau ont0opt mieildfsDuauvo;t4 exoir3oadlaDrai i;t0trxmxm iodlp   ncsltfaDtmxr oo0tee if3iad s ean pnt)teeoxr ty1lm  livi t0srxmir nudomtnmnvtl(f ruaurpot4alenif3iytls ul(ms () lxrmr3iy1lmDeauvsls  exmim iu1am nmncsls)s2tm(roou0texoifciydfa2ulu p;(4trtrxr3tydlmt lueo;s0trxriopio4omeelfct tf rrmx onu1aeenmoctydfm uau s u0 rxrxr oydfm e n i;() rtr(rpoydlp  livtas a2rr(moou1aetoio3tys a2ul(von(4 lxnmr3tydlm  lu ilt)t2uoio nodalt  net s)a2umurpou0alenmi3iatls2uauvp t0arerircoadfptr u ol(0 rtoxo3oo1omt mfci t arta( oot0oltn feiasfm2rmn p (0artrmr3oytlp e i o;s0 2toxo3io4lme lfci (f 2ur(ro;t1apxo iciadfs rl(mon(0arxrio iytlmt  ivol( sexoxmpny1ap emneia(fsDtmuro;t1texoioetys sDemu pnt0 ltnircta1laDeluvilt texm(r no1omt mivtl(f 2rru  ;u0olx mfctldfa2emuvs u0aeenmf3oytoaDe iei;() 2tr(rpoo4alenlnvslt)a2uaxmoot1tetniicildlm em( snu4arxoir3ty1lpteauvo;t srtr(rpno4alen iviatf rtaumpnu1tlxomi3iys m uan o;t4 ltrxr3ia1opt lneo s s2urxm iy4oltn nvtl( a2rr( pou4open o3iltlm emumon(4altrirciytopDr i s;()t2trimpiy1lm nmncsls  2rmx  nt4tle ioeiltlaDea(mpnt0trenmf tatlat  ivi s s2xmio iodomen ncilt  Duaurpnt1tex mf3iyt s ra(ms;(0 exrxr iydfmDrauvo s seuoxmpiu4al nmncsasf 2rax pou1optomo3iyd s eau p u)tetoxo3oo1fm eai ilt)trxoimpoy1om   fvta(f 2urxr nu0oex mi3iatfa umu ont) rxrxfcoodlp rlu sl()sexmxo oy4oltelnesat  Dtmxmoou4olenmo3iatfs2rm(vs u0tleoxo iatla  luvi s0 rxr(m nu1omt lfes ()sDtmxmooo4olx  ieilt m umuvsn()altomo oodoa  anvo;(0texoiopnodoleelnetls)sruru o;t0aexniociasfsDelnmo () eeoio3io1oate i sl(0 2trio oodlm e icil(  rta(mpoo4aptnif3iadlmDran pnt0teerif3iadlpD lueilt0trxrxr3oudam elncta(f Dumx p;u0oltnmfctyd sDemu o u4 ltoxrcoadfpt lueilt seuoio ny1opt  nvslsfa2rrumooo0opxoif3iytls2ulnvs;u) eeoifcoydfp raieo () 2xm(r nodopeemnvtl() Dumx  ou1tpen o3ias a2uan snt) etrmoctadlmt luesl()trxrxm3ny4lmeemnvi ( s2urum ;u4oetoifcildls2umu snt)alerxf oatlat livi t0s2trxr ny4apte ies sfarrru ooo1aetnifctldlsDuln p u0altrxf todoa rln ilt) exr(o3ny1omtn ies ()arrm( pot4tpx mfciasla ulump;t0tltrif io1lm   i i;t)trtoir3ny4amenmiesas)srumx pot4ape  ieiatfm2eanvp;u)trenif3iodfpDeai o;s s2ur(rpio1ope mfetas)arrrxm ;u4tpx  o3tyt a2rm( o;(0texnmf3ta1fp eluvil(0 2trirpiu4ll nlfciltfsDuaurp;u0oetn o3ildfs rl( s;t0treoxfcoy1fa r neo;()trxmxrpio1lmtemietatf rurur ou1aeeo i3iytfaDum( p;(0trtrif3iatfp rlnvo;()srurxr iy1al nmfvslt  2ur(mp;t1optnif3iadfmDrm(vpnu0tltnircio1lmte i o ()trtm(o nodomt licta(fsrumx  nt0oet mfciysfmDua(vp;t)aetoir3to1fpDrai sls0seuoir oy1al elnctl( aDtrxr ou4tpx ioeilt s2uanvo;t)tetrir3oatlp eaues;(0teumxrpnu4apt lfct tfsDuaumonu1openmoctatfaDelnmo;u4trxrmrciodoa r uvi;t)tetoiopny1ap   fcils  2trxrpnt0tlxomoeiadlm2ea(ms;(4trtrmfcoodoptrlieils0 rxoxm no4ame mivia()a2rmx  ;t0tpxn ieildla ran o;t0 ltrxo3oo1fmteaivo s)tetoxopnu4omt mncil()artr(mo;u1alxoioetldls2elumsnu) reomoctatoaDe nvi t  2um(o3iudomtnmfesatfsDrr( pnu0tee ifetlsfs2rlums u)trxrxr3io1faDeaivo s)sruoxrpou4lptelnvtl(fs2urumooo4opxnmfciadfa2rm(monu)texnio iydomD  nvil()srxoxo3no4ol nmfctl(fs2trx  nu0teeoioetysfa emnvon()texnif3iodlat aieslt0setr(m3io1am n iesl( srrmxmont4apxnmi3iaslm2eanvs;()tlxnmrciatlpDr nes;s) rtmxr3iu1op   fvilsfsrrmum ;t1tpeoifetys sDran s (4tlxomr3iytoatr nei (0srumir iodom  mncils  2uax ont4tetn feiyt sDrmn s u4trxnmr iytoptelu i;(  2xrim nodal nmfes t sDurump;t1aet  f3tyt a2umn snt4artnxr tadom raueo ( trxriopnydol elfct (f 2rau  oo4teto ociyd mDel(vs;t0altrxo ty1oate u i () 2xrio3no4al  lfeilt  rtmxr ;o4opx mf3tltla ranvs;t) rtnmo oy1lm  auvi t0 ruo(rpoo1omtnmnvi s sDurx o;u1oeeomoctydfsDem( p;u0tleoxf3tytfpteaiei;()t2tr(m oodom nlnctls)s2tm(r ;t0tpxnmieiltfaDemn o;t0trtoio3oodoa r u o t)trxmxmpoo1ole  fci s  2taxmonu1opt  i3iys m2eaump;u0aexrxo todfm eluei;(0trxoxm iy4omt miesltfa2rax o;t1alx  feils s ea(vs;()tetrxr oatomDrlnvo;( srurxrpoo4aleelnvi tfaruax poo1apxniiciysls emnvo u4 eermr tytoat aieil() 2xriopou1alt  ieiltfa2raumo;u1aex ii3ildls2umu o;t0alerxocia1omt livi;s0t2uo(r3oo1al e ietl(fsDtmuroou0oleoif3ils m2umu o;(4treoxf tydlm r ieil( srto(opny1altnmfctls  Drmxrooo1aetnioctytfm ua( p;t0 renmo3iadlmt lnes;s  rum(r ny1omtnmfcslt)sDuaum oo4tpeomieiad m2emnvon()artrifcty1om  livslt) 2umio oodaleelies t)s2ur(  ot4tle moeiatfaDemuvsnt) rtoir oatlpDraueo;t)sexoir nudap   feilt)srua(moou0tpx  o3ias a2rmuvsnt4texnmo oadopDran o;s)setr(r iydoptnlnetlt)aDum(r oo0apto fciadls2eanvs;u4aexrxrcoa1lpt  ieils) 2xrxrpou1lpee fviat)s2rmurpnu4aeeo feiydfm em(mo (0trxniociadlp eanei t)srtr(rpiy4ol   ici (f rraxmont0olx mfcias sDea( p u4altoxr3io1la  lueslt)s2xrxopio4alenmnvt t  2rr(rp;t0tlt mfcils sDumnmon(0aeeomr oydlm e ivs t)trurio3oudopee neiat a2tm( p;t1oeto fcilt a2em(vs;(4 exomr3io1oa eau sls trumio ny4amenmfes () 2tru ono4alxnmf3tlt s2emu p;()tltnmf3oy1fptelueilt sexoxrpnu1llee feia(farrrum ou1ole ifctltla2uanvsn(0 etomo3totom e neo;( sexmxr3iy1olt  fvi (  2rru pot1texn f3iat mDran s;u0 rtoxociydopD liei;( srxr(r3oy1aptelfvtasfarrmx oot4oee  fetysfs2ran p t)tlerio3oydopDr i i;s) 2xm(mpoodamt  nes tfaruaxmono0tpe mieildls ean pnu)trtoxf io1fpDrau i;t)sexrxm io1lme  ivia(f 2tax p;o0aeeoio3iltlmDrm(vp t0alxnirctotlaDean i;( trtmxm3nodam  mnetls aDum(rpoo4tpen i3tldla umnvo;u4 ltoxo iodlm rlivi s) ruoiopiu4am e fviat)s2truro;o4tpe moeiad aDemumpnt4tlerifcoydfmDrai ol(0seto(mpoo1ll nlics t a2ra( ooo1ape ifetld s2emn pnu0 renmf tydopD aieo ( s2xm(mpoo1lpe  fet tfa2tru oot0opx ii3iysfa2rlnmon(0trtrifcta1lpDelnei;t) 2xmio no4lltnlivsltfaDur(  ;t0aeen ieiyt a2um(msn(4tetoio ootfaD lnei () rur(m ou4ll elfvtatf Dumx oot1tetn i3tldlm elu snt0 exoxo3oytoa eau s ()t2toxmpiu4ome mnvslt  Duru onu4aeeniictasfmDrm(vpnu4aetrircta1om r ivslt s2xrimpoy1lptnlivsltf 2um(rpno0aeenmo3tlsfsDel( p;u)alxrxo tydopteauvi;t) rxr(r iodole  fvt t  Dtmur nt4oleoifeiadlaDua(ms;u0 lxnifcia1lpt  i o ( t2tr(opoo1omtnmfvils a2ua(rp;o1ole ii3ilslaDea( s (0aleoxo oodlate nei s t2tm(mpnu1lp eliesa()a2uax  oo4alxnioeiyd a2el(mo u4 eerxrctydoaDrln i s0s2urim io4aleelfvtl(f Dur( p;u1apxoifctltlm2rmn p;()aeeomrcoa1fatraivslt  eum(m oy1open fetls a2tmu onu1alxo octyd mDumn o;u0trxrxf3to1lpD anvols teurio3iydalee iei t) 2ur(rpno1alt io3tas s2umuvp ()trxnxfctotlpte n s t trxrxm oy1al  mneia(  rraxr nu0opto octldlm2uln o;(4trxniocoo1fm  aieo;t)trxo(r3iu1amtemfvta(fa2umx p;u4tpxnii3iyt aDea(vs t4 lxnmrcoytlm e ivi;()t2xo(o nodom elfetat)aDtmurpoo4oeeomoetas mDea( s t0arxrmrctotoa eln o ()srtr(r3iu1olt lfvtl(f 2ur(r nu4alt iociytfaDraump;t4 ltrmo3tydlm eaivo () ruo(m no1lltelivi s sDtm(moot0aleoio3iasla rl(vsn(4arermfctytlmDrli o t0 2xo(m3nu1op elietatf rrrxr ot1tlx  o3tltfm rmn s u)arxnmr3tadfp r uvi () rxm(mpno4amenliciltf Dtaxrp;o4tlxo f3iyt s uaumsn(4tleoifcta1opteln sl() euo(m oy4amt  nvsl( sDurxmo;u4oleomo3tyd a uauvon(0 etrmf3iytla e nvs;s) euo(opoydale  netlt)sDuax p;t0oetnii3tltlm ra(vpnu0alerxf3iydlaD aneslt0trxo(opiodope mivsls)sDum( ono0alxo i3iltlmDemnvp;(0tetnmoctydlmt aivol(0texrxopny1lme licsas  2rrx  oo0tlxnio3iat m2rauvp;u)tltrmf3iadopt lnesls0 2trimpiodamt  neslt  Duaumoou1aetn feilt mDelumsnu0arxrxo3iadlm eaivs;s0seuoxmpou1lme lietls sDumx p;t0tleoiictlt a2um(vsnt)areoxf3to1lmDeauvi;t0seum(o nodol nmnvsls)aDrmxmpoo4tlxn f3iyt s em(vp t4texnir3todfpDrln slt0trtm(rpou4llee ieia() 2raxr nt0aptnmf3tydfm rlnms ()texoif iy1lptr neilt)tetoxr3oodope mfvsltfsDra(rp;t4opxnif3iasls2ulu pn(4trenxrcoytoaD luvo s0trxmxrpoo4lpe lictltfsDuaxm ;t4apt mi3taslsDelnmsn(4tlenifctotfatrlnvs;t0t2urxopoo4omenlneia( sDtaur ;u4tpe iieiad a2ranvpnu0texrif3io1oat ln il()sexmirpno1omen nctat arumx p;t4tpe moeiytls ul( on()arenmr io1faDranvolt0t2tr(r oo1ol elict s artr(rono1alx mictadfm2uanms ()trxomo3io1fp  anvs;t)trtm(o iy4lpt lncs s arrr(r ou4tpx  oeiad a emump;u) ltnio tytfpD aieolt)t2umio io4ap n nvt t)a2raurpnt4tptn feilsfs2umnms;u0aetoif to1omDe nei;( s2uoimpoydome lics ( srra(m ot1oee if3iaslsDem(mo;u) etrmfciadoatrlivs s0 etm(r iu4lme  feil( sDtmxrpou1alxnioeiaslm2ranmp;u) exnmf3ootlmtelivsl()t2uoiopoydll  lfcs (fsrumxrpoo4tpt  fctadlsDrmu s t) rxrir3tytlat luvolt0seurxopoy4op emnvtlsfs2rrxrooo0oleo oetydlm elumo;t)aleoifctatfpDr i ol( t2uoimpoudlptn fct ()sDururono1olxnmf3ild a ulnvs t) ltrxrciy1oa  livi t)seumim3io4altn neta(f 2rrx  nu4apxoiieiadls2el(vo;u)arxnxo oytlmDeaieilt0 etmxrpno4ope lfvs (fsDrrur nu0tltn feiys aDelnvp t4texrmf tatfmDrai o s trto(r oodap nlnciat sDum(monu1tpe  o3ild sDel( o;t)tleoio iadlat  n s;(0 rurxmpoo1lpee fvtl()s2tau o;o4optomo3ildfa2rauvp t4 eerxr3tytfa eanei t0seuoxo iydame mncsls  2trxro;t4tle  i3ias sDua(vp;() etnmf3oydom elivs;( t2xo(opio1amte feslt srtrur no0ale  o3iysfm2rl(ms;t0 rtrmo tatlp r uei ( texrirpiudapenmnvi tfsrtrxmp;t4opx iietydfs2rauvonu0teenmr3ta1lp r nvi;()trum(r3oo4opee icilt a2ur(mo;t0tlxnif3tytlaDrmnvo;u4tlxnmr3oa1opt aivolt0s2tr(o3ny4apt mncil(f 2rmx  nt1tlxomoetldfm2elnmsn(4tetoxf io1op  lnei;s)s2trim iudamen ncias  2umumpot1olxnii3iad a2umnvp u4trerxrctydlp e nvslt) ruo(m ny4amtemnct s srtaxr ou4aexniieiltlmDulnms;u4teermo3io1fmteau s;() rxoiopnu4opt  fcsl() Dumur ;t1oee  i3ilsls umnvs;()aleomo todfa   u o;(  etmirpiu4am elfcs t aDtrx p;u1tpxn o3iys a2em( o ()alenmrcoa1fmteluvol(0sexr(opnodlp nlicsa() 2uaxmpno0optnioetatlmDrln s;t0 rtoxo io1lptelies;t s2xrim3no1open fetas)sDurx pno1olxo i3iatfsDumnmo t0texrxf iadfpD  nes;s0 rtoim iy4lltnlieiat artruroou1opeo ieiys aDemnvo (0 rxoxf iotop elnei;t0t2xrxrpiu1lmte ncs ()a2raur no4opxn fetasfsDulnvs;(4tlxomocoytlp r uvi;t0s2trirpio1am e ieta( a2tmxr nu4optnmo3ildlaDemnvsn(0trerioctodoaDrln ol(0 2toir3iudomt  feia(fsrum(  ou0aptn oetatlm el(ms u)tltnxoctotfp   uei t  ruoir ny1lmeemnes ( s2rau p;o4oltoif3iyd aDeanvo;u4altnxf3oytlp rlnei;s  exrim nu4am nlfvsat) 2raxmoou1oeenioetytfs uauvo;u4alxrirctytoateaiesl( t2tmir3iodlp n nci (fartrx  nt1tet mi3iadlaDea(mo (4 ltomf3ia1lp  auvs t0 2xmirpio1apt  fvt sfaDrrx oou1aeeo ictlsla2um(vpnt) lxomf ta1fmDeln ol( srxo(m3nodlp e nes s)sDum(  ;o0tlt mo3iasfsDum( s (4tlxoxrcto1om r nei;s)t2uoxmpnodole lfvs t)aDtrx  ;u1olxoif3iltla2uaumo;u4teeoxr iotfptr ueil()s2trxm3oo4lleemfcsl( aDumumont4aptnifetltfm em( p (4arenmrctatlmte neslt  2uoio nu4omt mnciat a2rmumo;o0opeoioeiatls emnvs t0tltnxo3ootfmDeli s t)t2urim3nydom  mncsatfs2rrxr oo0apt io3tys mDuan o;t)tlerir oytlate ivol(0 rum(o oudllenliet t  rrmumo;u4tpeomi3iyt aDranvon(4tetrxf io1omD livi;t0srurxopoo1om n nei s) 2rmxro;u0altnmoctadlaDrauvp;()trxoioctytoateln o s) eurio3oydlleelnvsl()srtrxmp;t4olxoifcilt s ua(mpn(4tetrif iadoateau o s)seum(r no1ap  lfes ()a2trxroot0alt  i3ilslm uanmo t)arenir3to1oa   n s;s srxo(o3oy1aptn fvils  Dua(mp;u0ole iietls mDul( on(0 etoioctotoa eaies s)teum(o iudomenmici t)srua(rpno4aeeomo3tydfmDuau snu)alerio oodopt lu o;(0srxoir3iodlpenlnesasfsrurum no1aetnmf3ild s2rmu pn(0 eenio3iodfpDr ieols) etmim3ou4ap n nvta(f Drmxmont4aet moetytlmDumu snt0 rtomrcoodlatelivi (0s2tm(m3io4lpe miei t  Dtmuroot1oltnif3tydfaDrmumo;u)artrifcoo1fp elnei t  etr(o3no1om  lncils srurx pnt4oexnmfetysla2uauvpnu0tetrifcoytfm e i s;t0s2uoir3io1lmeeliesl( arrmum no0aex mi3iyt s2rl(mo;() lerxo tatfptelues s0s2tm(r oo1olt  nvt () 2taumpot0opt mietydfmDrauvont)aeenif3oadla e uvs;s)srxrio3iodlp nmiet s) 2uau o;u4oetn oeiaslaDrau ont)artrif3oy1lmtrlivo;t)sruoxrpiydapt lnesat a2uaxmpno4aexomfetldfm2raums t)arermrcoodlpDr n s;t)srxm(o3nodlle lfvt t sDum(  ;u0oltn o3tltla2ul(mo u) rxnxr3tytom elnes t0 2xmim oo1openlnvslsf rrax o;t4tpeoifciltlsDeanvo u) ltoxf iodfaDrln slt)sexoxopou4apt  ivtas aDuau o;o1tet micildlm rlnmpnu)alxnxo3oa1oaDelnvil()trxr(m3nodamen ics t)aDuax p;o0apeo o3iltlaDumu s;t) lxrir3ty1oaD aivi;s) exoxo iy4omtnmivil(fsrrau pnt0opeomfeilsfsDua(vo t4altoif tatlp rlnvilt0 ruoxo3oy4amenmieslt s2rm(mpnt0olx  feiydfaDrl(ms;(4 lxrmrcio1omte u slt trtr(mpio1apt lfctl(f Dumu  ;t4aptnmiciaslm2ran sn(4texomrcia1fat liei t0t2tm(r nu4apte ivs tfs2ta(  ;t0tee mo3iad aDrmnvpn(4 ltnir3oodlpDelies;s)teumxo3oo4alt  iesa(  2rm( poo0aex ioeiatlmDeanms ()alxrmr io1lpD ai slt)seuo(r oudop nmivtas a2tm(r oo1aexnmfctyt aDum(vo t) etoirctytop  ai o;( srxoxm ny1llt  ici s aruau p;u1tle  octlt aDul( s;() eeoif io1lpD luvsls0srxrxmpiydape mivia(fs2uaxmpnu1teen f3tasfmDuaump;u0 exoir3oadfm eluvi s  rumxmpio4ol nmivs t)artrx o;u1tex io3iysla rlu o;u0 rxoiocoytoa e uvslt0t2xrio3io4am  lneia(  rtm(m nt0tle  f3iltlmDua( p u0arxnirciatlate uvi s0 etr(opiydamte ivi s arum(  oo0alen fctlsfm elu s u)altomr oydlm eau i;t0sruoxm iodaleelictlsfsrua(m ;u1teeo fcildlaDul(vont0trtrio3oydfa e u s t  rxrir3iodoltnmieiltf rtrx o;u4tee  oeilsfm em( on()trxnirciy1lptranes;( t2tr(opou4al emfes t) Dtru o;t1opeo ieildlm2ulu s u) rtrif3ty1fat auvi t t2uo(r io1lltnmicias)s2uau oou4tex mfetlt aDrmump;(4trerxocoa1op   nvo t0setrir3nu1apenmnvs s)aruaum nt0tpeoiiciad m2rlumo;(0arxnmr iadfpt  uvslt srtoirpno4op emfci t s2umx pnt0oeenifctyt aDemuvo;u)alxnir iy1lmtr ivslt0s2tmir oudomtelivil() rrrxro;t4oleoioeiadls2uluvp;u0 ltnircty1om  aivslt) exoxo3iu4apenmfei s a2tmuro;u4tlenmfeiatlmDea(vo t4areoio totopDr nvils)t2um(m3oudllenlieils a2rrxrpot1aetn ociasfs uaump;u4 etnxo oatlmDe ivsl( s2triopny4apt lfcilsfsrrauro;o1tle  ocildlaDel(vsnu4alxnmf oodoatraies ()t2toxm3ou1omt mivs s s2rrum ou0tpe  f3ildfa ranmonu4trxoirciatfmte uei;s) rtoiopou4am nmiet sfaDtmxrono0opxoiictytfaDrau s u0aeermf oodlmt luvols0 2to(o oo1op emfetl()sDrmxm ;o1tpeomfctadlmDranmo t0 ltrmo tatoa   ueo;s  exrxo iy1al n nvt sfarrmxrpoo4tetniieiadla eauvs;(0alxoxfciytopt anes s trxo(m3nydap n netl(fa2rmump;o1oex mfeiytfs2rau onu)aeerxo iatopDraiesl( trtmxr iy4am elfvs t) Dum( oou1opx mo3iad m2uau pnt4alxrxo3oytfptr i ols  eur(r iy4lm e fetl(f Draxmonu0aexo fctat m2umuvo u0texnxociatfat  nvi t truoiopny1lmtnmneil(  ruaxmpnt4tltomoeilsfs rln s;t)treomr iydla  luei;s0 eumimpiu1aptn nvi t) Drrxrpou0apenioetld m2rl(vonu4 etoifciatfp   uvi (0setrxopou4aleemnet s sDrrurp;o4olenmoetysla2uaums;u0tlerxo3iytop e ueo;t s2umiopnu4lltnmnviltfs2rmxmpot1tptnmieiysfa2ua(ms;t) rxnio ootlmDr ieo;()setmxm3no1lltn ietl(fs2umuront4aleomoeias mDum(vs t0 rerirciydlmD lneilt) rtmirpnu4al e ivil(fa2taumono0oee  f3tatls umumo t0 exriociotla r ueol()sexm(r3nu1ll emncilt  ruru p;u0aexoif3iadfm2uanmpn()tetrmocoo1faD  u i;()trxmim3oo1lpte feslsf rumxrpot1ole mictlt m ranms;u)tlxoxf oydlp   i o;t)s2urxopny1alt  nei t s2tru pno1oee mfciatlaDemuvs;t4tltrxr oytlm  anvo;(0srur(m nu4lpen icsat)aDtmu o;o1olt mfetad sDrmumsnt0aeenmo iotla  aivi;() 2urxr3iy4ol elfvt tfsDtmumpno1oleomfciasfs2ran s t)trerxr oa1om eaivilt  2xr(m iu4lp n nvil(fs2ur(r ou1olt iictltfm em( o;t0trtoircoo1omte ivils0 2toxo3ou1omtnlies sf 2rmumooo0apt iieiysfa2rauvo ()tlenir3to1la ranes (  etmir oudlp  mfvtl(fs2rm(  ot4oee  f3ilsfm2rm( p;u4altrxfcootfptr nes () rtrir iudolenlfcs t a2tr(mo;u0tee mietys a2rlu p u4aeeoir iytfptean o t)sexoxmpiy4lpenlneslt)sDumx pot4alxnif3tlslsDelu p;t0 eerxfcoodlm   n ol(  ruo(m3iy1ll n fvt s) Dumxr ;u0aexo ociysfm2emn s t0 lerxf tytfmtr iesl( setoimpou1amee ivslt)a2rrxmont1apeo icildls2rlu pn()texnio tytlm  lueo;(0 rur(m iu1ol  mfvi tf rur(r nt0aleoiieiydfs2el( o (0treoio todopD liei;()truoim iu1al nmfeil(fsDuax  ;o0oleo i3tyslsDrm(vo (4aeermfciadfmDr uvo;t0t2urio3oy4ole  fcsl(  2tm( pnu1aex  o3iyd a2ea( s;t0alxoifcoa1lptrai slt)setrxr3nu4lltnmieta()a2umxrooo4tltnioeildla em(von(4aexrxr totfa r n o ( trxmio3iy4llt  fesas  Dumx ono1oeeoifeiys aDemn s t4artomr tadfmtelivol()t2xoxo3io1apt licslsf rrr(  oo0tpx moetytfs raump;(0 ltomocoy1lmD  nesls0t2uoxmpnydol  lnvtl()arrrxmo;u0aee io3iytfsDuaumpnu4 rxrmr oytlat  u i;s  rtoim iy1lm  mnct t)s2urxro;o0apeniocilslmDua(vpnu0 lxnxr3to1fa elu ils0trxr(o3io1lp e fesat a2raxro;t4open f3ildfm ran sn(4trxnxf3iytoate ivi;t teumxr no4lpt livsls  Dtrxr oo0tle iicildfa2ean o;u4tltrmo ty1opteanvi;( srxrirpnydop  mnciatf Durumoot4opt  fctyd a rlnmo u4alxoio3iotomtrai i ( srto(r oo1llt livilt) rtaxro;t4aee  o3tys a ea( o;t0texoio tydlp rlnes;t0teumxmpio1om elfei sf 2trx ont0oltomicias sDrm( s;(4texrircoodfpte nei t0 eurio ou4lmee net (  2um( pou0texnmiciaslm2ul(vo;t0tlenmf oodlate u i t seuo(m ou4opte fcs t)s2umurpou1oexnmfciydla ra(vp;t) etoir oodfpDelivs ()setm(m nodlp  mfvil(f Drmumpnt4olxoii3ilt s emnmo;u)trtrmrcootla ran ols0 etmxm3iy4al e icsas) Dtm(r ;u4oexn i3ilsfs2rau onu)aetnxoctadfpDeli s t s2xo(r3oudap nmfetas)a2rm(  ;u0tpxomf3iydls2umu on(0 renxo3ia1opt aueo s0 rtoir iy1alenmncs tf 2rm(moou4opxoifciad mDumn ont0aetoirctatfp  anvi;t)t2xrxm3iu4lmte fesat)aDrrum ;t1ape  i3iytlm2rmnvonu0 lxnmr3iytopt  iei ( s2xm(opiu4am e fvt (  Dra(m ;o0teto f3iatlaDrm( snt4 ltomfcoydlmt ln o s)t2umxmpno1lmt mfvta(farumxrpnt1aleomoctltls eluvs;(0 renmf iy1oat  i o;t0srtmirpou1ole  ncils) rtmx  oo4oleo oeiasfs2em(ms;t4tlxrmf3oo1om  lu olt) 2tr(o3iudlmt  nciatfaDtrum ;t1ope  oetldfsDrlu o;(0altnxf iadopDe uvol(  rxm(o3ou1lmenlfeslt sDtaur ot4oetn fctyslm2ua( s;(0tetnir3iytlpDrln i s0t2uoxm oodalee nvs t)srta(mooo4aptoif3ilsfa ul( o;(0 rxnxo3oa1fa rlu i;() 2umxmpno4opee ncia( arraur nt1opxn ietytls umn p u0aeerxr iadlpDrauvi;() rxm(m3iu1apt mics ()s2tm( pou0opt mieildlmDrm(mon(0altrif3iatfmDranes t srxmxm iu1oltnlicsas s2rrump;t1oeen feias sDrau pnt)alxnir3totfatelivo;s0t2ur(o3iu4ol nlieias  rtmx oou1tlt  ociyt m2ranms;(0trerxf3io1omDraues;(0trxr(mpnudapte icsas a2trx  ot0tpeomi3iyt mDelumsn(0treoxo oydfateaneil( s2umxo3oo1lpe lnesltfartrx poo4oeeo i3iat a ua( o u0trtrif3totopD  uei s0s2xrxmpio1optn nvtls aDtrurp;u4alxnifeiytla eln snu0tlerxo ia1op  ln i ( texrim nu1op nmfcta( srtm(rpno0aexoifctldfmDranvont0tetomfcto1lpDe nvi;t teumxrpoudaltelneiat) rumx  ot4alxomo3tysfm2ra(vo;u0tltnxoctotoa  anvi t0srtm(o iu1alt  nvtls  rumurooo1tptomieiltlm2uaumpnt0tetnmfctatomD liei;t0sexoxo oodll e nci (  Dtmumont4aetoif3tas sDelnvo t4altoif3iodfmt an ols)s2um(m3ou1omtnlncils  Dum( poo0olx mieildfm rlnmpnu) rtnmoctydlate uvs t0s2xr(mpny4omeelncia(faDrr(roou4apenio3iytfs emump u4artoirctatomteai s t) 2xmiopoy4ll emfeiasfs2rmx  ot0tetnio3iltlm2ua(vpnt4teeriocoytlaDelnvil(0trtmir3nodlp nlnvi t aDur(rpot1teen feiysla ea(monu)teeoirciotopDraieil( trxoimpnydapeemivsa() rur(r oo0aetnioetlt mDuau o ()altoxr tytfm   ues;( teto(opio4ome lncsasfsrtru p;t0aexnifeild s uauvs;(4alxoxo totopD lueo;t0setmxo3ou1lm n nvtl( srumx  ;o4olt mi3ils s2ua(vpnu4tltoio iotom  aieolt truoxo oudopt lnvtl( srumur nt0oexoio3iydfm2uauvo;u)trenxfctodfptrluvol(0 2xoxo io1lpe  nctatfa2rr(m no0ole moctysls2uauvo;t)aeermfctydfa elueo;(0texrir ny1om n feilsf rrmurp;u4tlx moeilt m2rmums;t4tltoiocoa1opte n o;t  rtoxr3oo4aptelicsat  2rmu p;u1olxo fciad s2umnvpn() lxnif3ootom  lueo ( teuoxo oo4oltn fcilt a2rrxrooo0tee iictydfs2emu snt)aexoir3iadom elu olt0 etoim3iudapte fctlt) Dumu pou4tex mieildlmDum(msn(0 etnmo oo1omDraies s0srto(r3no1llenmfes ( a2rruro;u4tlxnmfciaslm2umumo;(4texoif tytfa rlues () exr(o3nudam emnetas  2rrxmpno1oetnmi3ilt aDel(vp t0teenircoy1fpt anvi;s0 2trim ou1lmen fes sfs2raxrpot4tetomfctadlmDulu s () renmfcoadoate ueols0sexoxr oy1alee ncslt) rtm(rpnt0tpto oeiatls emnvo u4alxrmrctadlmDelivi ( teuoxr3nudlptemies s  Durum no4tlt  fctadla2ulnmpn(4 lxomo3iytfaD  u o ( srumio io4lpeemfcilt aDuax o;o0tleoifctatlsDumu s;u4alxoir3iodoaD anvs s0truo(r3oo4lpe  nvtls a2tm(  ot0tpe if3iadfmDul( pnt4aeeoxf tatfptrln slt trumimpiydal nmictlsf rtm(ronu0aetoii3tytfaDumumsnt)tltoir iytlmD  i o s0trtoim oy1lmee fes tfartmumooo4open i3iltla2rlu ont)aexnxocio1op rln sls0trtrxr3oo4om  lics s aDumxrpno4optoifeiatlm rmnmpn()teerir oydlmDrli olt)trxmim iu1ol nlfvil(fartr(mpou1olt micils a rmnvp u4 etnmo io1oa  an s;(0srtrir3iy1omtnmneilt s2uaurpnt1tptniieias sDea(ms;() rtrmr tydfm ranei;s) 2tm(m oy1lmen fvt t  rrm(rpot4tex mfeiat a rl( ont)tlxoxo3ty1lm elnesls0setm(o nydam e nes ()s2rm(r no1altomoctadfsDrlums t0 etrmoctadfm eai olt srxm(rpiydoltnmict s srrrurp;o4opxo f3ils mDua( s;(0alxnmr ootoaD an i;()srurxm iy4amenmnvs (fsrrrx pno1tlx  i3iysfa emuvonu4 ltrmrciy1lp raneols)trtoxm3iu4ame  netasf 2rmxrp;u0oeeoiiciasfaDemn p (0tltomr3tadfm  li slt sexr(mpiudamen fetatf 2uaumont1oex ioeiysla2ul(ms t4altnxr iydfpDe u s (0trum(r nu1ll emnctl(fsrtrumpno0opx  octyt a um(vo;(0aeenmf tydlm rli s;t trum(o oodaltemfei s) 2rmx  no0apen ieiytfs rln sn(4trtoio oydfpt  u ol(0srxm(m3iu1llte netls)a2rmx  ou1opx iietatlmDemnms t4tlenxr3ta1lpDraueil()srxm(m3iudom emiet s)srururpnu4oleo ieiltfm2ea( s;u)alermr iy1lptraueolt s2xr(r oo1ole  ict ( srurur oo0tex  o3iatls2rl(mp t4arxnxr3iotomDe ieo;(0sruoxo3oy1apenlfvt t s2tm(  ou4ale mo3iadlmDem(monu4tlenxf3iotfm rau ol()s2tr(opio4lpteliviat)artmuro;t4oltn iciydfsDrlnvpnu0tlxrxo3oatfpte ivi ( t2xoxopnu1lpen fet sfarua(m nt4tle mfciysls2uln s u4 etnirctydfmt  i il(0teum(rpno1lp nlfesl(fs2uax  ;t0teeoiiciyt s emn on(4 rtrxr ty1lm r ivo t  2urxo nu4aptnlnvi t  Dumum ot4oeenmf3ildlsDulnms u4alxoio3oy1op   nvil( srtmxrpio1lmtnmnctat) 2raur ;u0tee  i3iytla eau p (4 eenmr3iotfat  n s ( sruoim nydlm  lfes tfsDrrx onu0olxo ictas s em(vp u4alxnmo3iy1lmD luvolt0 2urio3ny4apt lfvs (  Dumxrpou4texomfcils aDel(vonu) rtnif3ty1fpteaieil(  2xm(o3oo4lleelnei t  Durxrpno4tpe io3tltfs rm(ms;t)trtrxociadfpDrln ils)srxo(r nu4apeelnci s arta(roou1ale  ocildfa2uau p;u) exrxf iy1fmt anvil( seur(r3io1ol   ivsa() 2tr(rp;t1tptnmf3iasfa2em(vp;() rermf3oytlmtraivs s0 rtm(rpno1lpe liet s)aruau onu4aexn ictasfs2rmu o;t0aetnmr3oydlmDr n o s0srumir iodlltelfet s)sDuax p;u0aee  fctys sDuln s u0 exoxf3ootop  lu i;(  2xoio no4llt mnvs s)arumur ou0tpen ieiysfa ra(vp t0alxrmf3ta1opDeaneilt0s2xrxm3oodlpe mivt ( aDurxr nu0teenmi3ildlmDrmuvp u) etomoctatlaDeli i;t) rxmio ou1optnmfvs tfaDtax  no1tpeomf3iysfm2elnmsn()tltnxrctydfmt lieols)setmxmpnydaltelnei sfaDtrumpot0oetn fctldfm ua(vsnu0trtomr ta1optelivo s)texr(opoo1ol nlfcta(fsDrrxroou4tptoiieiydla2ua( p;(4alxoif3ty1lp  auvs;s0s2xoxopiu1ape lietls aDuaur ;u1aexn i3iys a ul( pnu0 ltnmociy1lm elu s;s  2xr(o3ou4amtemivil(fs2rm(rpno1tlenmfciytls eanvo u0tleoxr3iadlmD  n i ( trxr(o io1oleemfeia(fa2tm(r ot4tptoiictltlaDua( s (0texoxf3oadop e neils0texo(r oy4apeelfetas sDrmxm ;u0tlxo fetysfa2uau pnt0tlxoio tydla eanvs t)texoiopiy4olenmivtas srumuroou4apxoiieias mDuauvp (4treomo oytla e i o;()t2uo(m3nydopen nvi tfaDurx pnu1tlt ifciltfsDrluvs;u0tleoxf3tatfp  anvo t)trurimpoudlmen neslsfaDrmum ou1aleomietlt s elnvont) ltrxfciatop  li i;t texmxr3oudlpee nvs t sDra(m ;u1aleo ieiat m2emuvpnt0 eermrctodfm   nvs (0texr(rpoydal n netlt) rrmuronu1aexomfctlsla um( s;(0 rtoir3ia1lp rlieol(0trxriopno1amt mivt s) rua(monu0olen i3tltfa2rm(ms u4aetnxrcoadlp  aues ()t2uoio3no4ll nmncta(fa2ururonu4oltoiieildlmDumnvon(0tetrmo iydomtr nei ()s2tmim3iydlmt  icslt)arraxmp;u0teeo o3iydlm umumsn(4 etrmr tytomDrli sls0 2tmim nu4ll  lnvs t srtm(r ;u4tleomf3tyt m rmu p u0alxrmr3iatfmDr uei t)s2xoimpoydame  neslt aDta(  nu4texnmfeild a2um( ont)teenxo3ootlpDrau o s)texr(o3ny1op  lnvia(  rraxroot1tpxoiieils m2um(von(4arxnxo3tytomteli sl(0seto(o3nu4lpeemivt sfarurur nu4olxnmietat s2emuvp;() lxoxf3tydoptelivo;s0 2umxm oo4lleelnei sfaDur(rpoo0tle  fetydlm2ea(vs;(4aeenircio1la  au slt0 euo(r3nudameelieia( sDtr(ronu0oetomicilt sDrluvs;t0trtnio tatopteaivi;s0 rxrimpoudome mictas) 2raxm oo1aee mfeiydfm ulnvonu)aetnmo3oadomt  nes s sexoim nodlmeelfcsa() Dtaumpnt4tpx if3tadfa2em( o () ltrxocia1fmt  uvo s t2tmxr ou4lp n nei tfaDur(mpnt4ole  ieilsla eanvo u4aetoxo3oa1lpDrlu o t t2urimpnu4lmenlivta() Drmxm nt4aeeomieiat m ea( o t0arxrxr ootlaDelieo;s0 2ur(r iudamtnlfvi (farumu onu1tpe if3tyd a ean pn(4 etrmf3ootopD auvo s)t2uriopny4ole lics sfaruaxro;u4oeenioctltlsDuanvp;(0 lerir iy1omtr uvolt srurxo3io4op nmiciltfaDra( p;u1ope mfeiytlaDea(vs () lxrmf3io1fp rauvsls)setoio3no1lptn ncias aDtm(ronu0opto ieiltfaDul(vs t0tltnmf3io1fa rluvilt0s2xrxopiodop nmfvtls srrrxm ot0teeoioeilsfmDrmuvsnt)alxrmfciydoa eanes (0t2ur(r3no4lm n ivt s) 2ur(mp;o1opxnif3iasfs2ul( o;t4trtnmf totoptr nvi ()sruoxr3oydlle  ivsa( a2ur(rpnt4olxomi3tadfa2ulump ()artomo io1lm raivslt0srumxmpnudame mnviasf Dtaumpou4alxn o3iadfs2ulumo ()trxoif io1lmtr ueo;t)tetrxopoudlptemfvia(fa2tm( poo4aptomf3tas m rlnvp;u0trtnio tytlm  lnes ( tetm(o3oydol n ieiltf Draurono0aee ifciaslsDulumsnt4teerxo oydopte i o t0tetmxmpnudam n fcsl() rrm(mpnu4tlxnmoctytlm ulu p;(0arenmr iy1fm rli o t)trtoio3iu1lmtnlivt (  rurxmont1optnifctatfa um(ms t4treoxoctadfptran ols0 2xmimpio4lme  fvsas) rtr( p;u0aleomociltfmDeanvs;u4 etnmo oydoaDeln ilt)trxrxmpoydam emnet tfa2tmum nu0tlxn oeiatlsDrmnms (0 ltomrcoo1fmtelies;()setrxrpoydlpt lnvtas arumx onu4opeomoetld m2ul(ms () exoxr3io1fptelieo ()teurxm nudomte nvs tfaDrmu poo1aeeoiocilsla2rln on(0aleomo io1omDrluvi t) rum(m3iy1lpe  fvslsfaDta( poo0tlen f3iys s el( pnt0 ltrxoctotoptr neo (  2tmxo oo4aptelncslt)sDurxrpnu0tlxoifctyt a2um(vs;u0tlerxoctatom raueo;( trto(mpiydol n nctlsf 2rr(mp;t4tetnmfeiat s eauvs (0 rxoxf tatfpDr ivs s0 etoio3iu4aptnlncs t) Dtmxronu1apen fciad sDrl(msnt0tetrxo3iy1opDraneo s0t2xo(o3ny4ome  feias)s2uax oou1aptomo3tltfaDulnvo (0altoif3todfp rli ilt) rxr(o nodolt  nvsas s2rm(root4tpe ifctlsla2em(vp;u4 renxf3tydoatr n ils trum(r iu4apenmneilt  2trxmpoo1tlt iictas m elumon(4tlerio3iydoaDrluvo ( tetm(mpiy4lmee fvtas  rrrxmpou1oltomiciad m el(mo ()tlxnxocootla e ueo s teurxo3iy1lmt  icsl(fsDurumo;u1opxn iciatls2el(vsnt4teeomo3oodomD aneil()srtrxm3oudalee nvt (  Dum( pno0tet iiciatls umuvp (0alxrxo3ootfmt ai i (0 etr(mpiy4llee fcs s) 2ra(ront0oexo feiltlsDel( pnu4tltnxo3iodomteaues;(0trumxm3nydam   feils aDuax  ;u1aeen fetyslm2raumpnu4 etrxr3ootfmDrlueolt  2ur(opoodomt lfcia()sDum(mont4alx moctadfm umums;()tleoxr3tatopt  uvsl()s2uoxr3oy4lpenlfvslt)arurxr nt0tee  i3tadlaDra( o;u0texoif3oo1op ranei t0 2tm(opiydomen nctas aDtmxrpoo0tlx mieiadls ul(vp () ltnxr to1fpt lu s t) ruoiopno1altnmivia()aDtmu  nu0oetomociysfa umumo;t0trenxo todoaD  nvi;( seurxr3nudaltnmfciat  2rrxr ot0teeo ietlt m emuvs;t0tetnxfcta1oate ueo (0 2um(r oo1ll  lncsa(fsrrr(r ;o4opx ifeias a ul( s;u4tlerircoadlpte n olt0 etr(m iy1lmt mfct t sDurumpno4tleo oeiatfm2emuvs;(0trxnmo3iatlpDelu o;s) 2tm(o3oydlp nmieils) 2tru oou1aet moetasfs2rl(mont)alxrmr3oadfmDran i t0t2uoirpiu4llenlfvtlsfarur(mp;o4olt  ictlt m2umnmp t4 ltrmfctydlm   ivo;( sruoxm3nu4ol emfvslsfaDtaxmoou1opeo i3iatlsDranvo;()tleomocoo1lmt aieo t0 ruo(o3iu4lm e fetasfaDtmu  ot4tptnifciad aDuanmo;()trxrmfciotlat ai o s)sruo(o oy4om  livtl(fsrum(monu4olx iiciadls2umuvp;() lxoxo tytlp r uei s s2xo(rpiudomtnlfcias  rumxr oo4tleoio3ils m2uanvo u4 ltoxf3iadfaD lueo s)s2uoir3nodope livt s)sDtmx pot4tpt iiciadla em(msnt0arxoxfcootop rlu slt setm(r3ou4ap  lncsltf rtm( p;t4tex  ociad mDel( p;t)tetrioctodfmt li i s0teurxo3io4amenmnvia(  Dur(  oo4oeeo fciadlm2raumpnu)trtoxociydfptrau olt0srxo(o3iydomtn fct ()arrru p;o1apeomi3iltfa2rmuvs;u0 rermoctytfmtelivo;s0 2xr(r3iudomtn nvslt)sDumx  no1aptomietydls ea( on() lxrxf3tydlatr i slt0s2umxo iudale mfcilt)s2umurp;o4tlxo ietaslmDeln s u4aetnif3iydop  livo;s0t2xoxo io4opeelfcilsfaDraxroot1apenmo3ildfs rluvp;t4altrmf3oydomD  uei s  exm(mpoo4ap  lncilsf Drmur ot1oeenmicilt a eluvon()tlxrmrcootlptr ueslt  rxo(m io4lp nlfvtl(f rtrxront0openmi3iytfa2uln ont4texrxoctatfaD aues;()sexoio3oodale licsatfs2rax  ;t0tee mfctld mDrmuvon(4artnio3oadlaDr uvo ()trumxm3nydlp nlnet t) Draxr ou4apxo octysfa2em(vp u0 etrxr tytla e uei ( srtoxmpiodlmeemiesls) 2urx pou4tpx  i3iatlsDem(vp u) ltomocoa1faD livslt teumio3nu4amen nesl(farurxrpno0oltnmi3ildla2rl(vsnu) exrmf3io1oaDeli o t trtm(r3no1lmt licsltfarurum no0apx mociydlsDumu pnu0 lenxf to1opt lnei;s srtoxm3oo1apee fcslt)arrmxr oo0tpx ii3ildfmDrlnmp;(4tlenxo3tytla eau o;s)srxmir oy1alenmnei (fs2raxroot4alenmfcildfmDeauvp t) eenif3ootopDraieol(0tetmxr oydap e fcils arrau ono0tetnmf3iadlm2el( p;(0teenxo oa1opDe i o s0tetmxr oodlm emietlt  rtaxmpot4tpe  oetasfsDrmumo t) eeniocto1lmD li i;t0 eum(o nydamenlivs ( a2trumooo4tlen octls m2eaums u0arxnmfcoadlmDrlu s s0 rxoir no1al nmivs tfa2rau  oo1aexoiictadlm2rlumo;u4altrifcio1oateluvi s sexr(m ou4oltn fvt ()aDurumo;t0olenmfetat m rlums;t4 exnio iotlmt livi;s sexrxr nodlpe  fvsas  rtaur oo4olxnmfetyd m ranvp;u)aleniocoydfmD anvo;s) eurirpno1apenlictlsfa2rrum ;u1alto fctysfmDul( o;u4areoircootfmDelueils)texmimpio1amtemnvs tfsDrm( pou1tltniieiasls2elu p t0 lxrif3tatoptrlnvo;()tetr(m nu1ape micia(fs2tax o;o4opx  ocilsfa2rmnmo;(0trenir3ta1fpDe u sls trtm(r ny1lleelfvsl(  2tmumo;u1texoiietad m2ranvpnt4altrxr3ty1oaD lieolt0t2toir3oo1lp elivtasf rurumpot0tltoiiciadls2ulnmp u0arxnio iytop eaieilt0srxr(m nu4al  lnvsltfs2rmxrpoo0oeeoiieiadfs2eau p;(0arermfctatfptelu slt texrimpoo4aptnmnetltf Dtaxm ou1texo f3tydla rlump u)tlerxo oydlpD aivs;(0s2xo(m iudaltnmfesltf rrr(r ;t0aet moetadfsDeau s;(4aetnmr ty1omDr ivo;t)t2trxrpoy1amee fvtl(fs2raur ot0optn i3iasfs ua(msnt4 reoxfcoadopte ueo s0s2xrim oydam elnct (  Dra(r no0tltn oeias aDeluvpnt4arermo3todomteaivsls0sexr(mpnudlmen ivs sfs2tru o;o0olxn oetltfaDranvp;t)aexomo io1oateliei;(0t2uo(m3oydlmtn ieslt  2tmu o;t4aex mf3ildfmDuauvonu4 etoxf iytlp rau o;()s2urxm nydal   nvs sfsDrrumpot4olx  feiadfmDeanmo t4trtrxr oy1la e nes (0t2uoir iu4lp emfct ()a2trumo;u1tlen feiysfmDrlnvs;t) reoxo totfm  auvslt)s2tr(r3iu4op emfvs t)arururo;u0tpto o3tadls2el( snt4tltoxocty1op e nes;t0truoiopnu1om e nvi s aDumx o;u4tlxnmietydla eaumo u4 etnmoct
\ No newline at end of file
@@ -0,0 +1 @@
+u i;t t2tm(o no1ale  ictat)sDtm(m ;o1tpeoif3iatfaDua( p t0trerifciotfmD anvs t0 rtmio no4ol emicsl(fsDrrump;t4tpxnmietlslmDul(msn(0 lenmocootfat lues s) rtm(opou4lp e nvsa( s2rr(mpno0alt mi3tyd s2ean s u0tlxoxf iy1lpt aueilt0s2trxr3iodlmt  nvsa() 2umx pnt0apx mf3iyt s elums t4teeoio iatlp eaivi (0 ruo(m oy1lp eliet s a2umxroot0olxniociysfm ra(mo;() lxoxf3iy1omt  ivo;s0srum(mpiu4lp  mieta( aDrm(rp;t1tlxomf3ias a uauvp;(0 lxomfcoy1fp r ies (0 eurim ou1alt mnetas sDur(ront0oeeoifciytfaDelnmp;u0aeerxoctytfp  li i;t0 2tmim3io4ale  netl(f Dtaur no1tpenii3iyt s eln s u0arxomr3totoat aueslt0srtmimpoudomtn neiasfa2uau  ;t0apeniictld mDrmuvs u)tltoif3oydoatr ies;t  exr(rpiydlle lfesl()arrmurpnu4apt if3ildlsDeanmsnt0 exnio3todopt  u i ( srumim nydlltnliviatfsDurx onu1opt ioeils s2elnms (0altoioctatomt  uvi;() eur(o3ou1lm  mnesl( s2rr(r ot0oeen feiadlsDumn o ()trxoir oy1fptrli o ()texrirpno4al   fetltfsDtr(m ;o4tlto i3iad s ulump;u0aetoxr to1fmDr ues s srum(r nydaptemnvsasf 2trx  nt0oet moeiytla rau o (4aeenir3tatlptrau o;(0 etrirpoodlpte icslt) 2um(  nt1oeeo ociysla2rau s;u)areomf oa1lmtrli i;t) exoxopoo1ll elivsls) Drm(moot1teto ociatlsDul( s (4 rerxfctytfm elnei (0s2trxo3oy1apt mfei tfs2tru o;t1alx ifctytfa2em(vont0 etrircoo1lp r ivi;t srxrio iu4ap nmiciat arrrx pot4tee iieiysfs um( snt4tlenif3oatlatr nvs () eumio iodlp e fct s)s2rrx pnu0opx ifeild a2el(vo (0tetrxocoytla e uesls0 rumxr3oo4ameemivsl( arrrxmoot0opto i3tyt s2ua(vo;t) ltnxr iydlptr uvs;s0texoim nodlpt lies (farurxrp;t4oexniictys m2eauvo u4aexoiociotfa r iei;(0trtmio3ou1lpt  ncta(faDtmuroot4opxnif3tatfs2ea(mo;(0tltnmo ta1fpt livils0 2trio3ou1alenlnvt s artmxr ;o1tpt if3iaslaDumuvpnt0texoif3iytlp r ivils)s2xr(mpiy4olenmicta()sDtmu  ;u4tlto ociyslm2rl(vo (4tltnmo tydlm elnvils0trtoirpnodoltemnetasfarrax pot4opxomoeiyd mDrlu p t4aeeomo oodlmtrlueo s  rtmxm3ny1ll   iet s)a2ur(m ou1oeeo iciyslsDem(vsn(0arenxr3tydoptranvo;( seurir3no1aptnmivt t aDrm(mono4tlenifeiadfa ra( sn()tlxrmfciatopDeauvo s)srtoir3ou1omenmfct t aDur( p;o0alen i3iyslmDua(mo u0trtrircoatlmDelnes;( trtoxo3iodamtelncslsfarua( pno4tptomfctysla el(vp;u4 etrmocty1op raneo;(0 2urimpny1altemietasfaDtrxrono0tlen octytfm2rmnvs u4texrxr ia1opDe u ol() 2tmiopiu1ol e ictl()sDrau o;u1opxo octasfm2rm(vo;u)alxrio3oadop eanvo;t)teumxmpnu4al e nei t aDtax pno0tpenmoeildfm2eanvs;u0 leoxo3oo1lm rlu sls0srtrio oo1op elfcia()aDraurpnu1texo fetatla rau s u4alermo3oytlateauvo t0trxr(r iodlmt mnvslsfsDurumpnu4apeomociaslm um(mpn(0tetrifcoy1lateln ils sruo(opnodaptnlnvslsf rrrxr ot0tetnii3iysfm umn s u0teermf oodfpteaivo t0 etmio oo4ope mfcia() 2trxronu4oeto feiytfaDrluvs;u0 renmf iadlm   nvsls  exmio3ou1lmte fviat sDtmxrpou4olt if3iadfm rln on(4trtrir tytopt  iei;t0sexrimpiudlme mnvtat)s2trx oot1oeeoiiciadla2elnmonu)tltnmf oadfp r nvol(0 rur(o no4ll nmfei s aDumxmpno1texoio3iadlm rau p u)trxnmr io1la  lu o ()s2xr(m3iodop e fes t)a2rmu p;o4teeomfeildlmDrl( p;u0teeoxrctydomt lneo t0srtmim3iydlpe mfesatfartr(m no1tpxnii3ild m ulumo;t0 lxoxoctodlmte ivi (0trtmir iy1ll nmfei sf rrru pou1tex iociysfs2umuvpn(0 rtnir todopD aiei;t0 exrxm oodlmenmicslt)aDrmum oo0opt mictaslaDuln o;t0trxnxf oadfm rauvsls0s2ur(r3oudlmt liviltf rrmum oo1aptomiciyt a2umnvp (4texnircto1oat aies;(0 rumxm oy4lle mfet sf rtrumpnu0aptomoeiydfs uan o;t4 lenmr3to1fm rlnesl()s2xrxm3oodam e ivsls s2tau pno0oleomiciasfs ra(vo u) lermr tydoatelnvolt  ruoio3oodlp nmnctls)s2rru p;u4tleo ieiysfa umnvs u4texnxf io1omt aivi;t0seumxo3iudopt  fesl(f rta( p;u1texn i3tldla2em( pn(4altnmf3tatomtr ies t0 rxrxm iu4ol nlici s)arum(  oo4opxnifeilt s2ranmp t4 ltrmf3oytfpDelueo;( srtmiopoo1alt  neil( artau pnt1tltn icildlmDum(msn(4tleoir totopDeauvols)s2tm(r no4lm  liet ( artmumo;u1tpenifeias s2rln s u4 eerir3oatomD aivo s  rtoir oodap   icsatfa2trx ono4apenmocias s eauvp u0aetrxfcoy1laDeluvs ( srxrio3iu1amenlfvtas)sDuau p;u4oetn ociys sDrl(mo u)tltoio3oadfpt  i sl( teur(r nodamt licilsfsruau  oo0oeto ociytlmDemnvpn(0 ltrmfcoytfpt  iei;s  rurxo3oy1altnmietas  rua( oot0oee  o3ildla2rauvp;(4trermrcto1oa eli i;()srxo(r3ny1op elnci sfs2rmx pnt0tleoifciat m2eauvonu) rtnxf todfa eln o ( sexrio3ou4omtnmfvi ()sDua(mo;o1ape ifetadfs2rlnvo;(0 lerxo3to1fate nvo (0trtm(m3oy4optelfcils srrmxront1tetoiociydfm rauvs u0 ltnio oy1fatr ues t  ruo(r iy1oleemnviat)aDraxro;u1tpxnmoetltlsDuluvs u0 lxnxf3todfpteaneo s)t2xm(mpiy4op n fci t  rumum ot1opt mi3iytls rl(vs ()artriociy1om eluei;t)setmio oo1llenmietl()aDrrumpnu1oexniociadlm2rl(mp t4trenir3to1lmDrauvils s2toxr3io1am nmics t arumu p;t1oltn ieiyd m ranvon() etoir oa1fmDrluei;s trxrxrpno4lm emfeil() rtr(  ;t0oee ifeiad m2elnmp u4altrxf3totlm  livi s  eurxo3oudal nmfvs t srtm(r no4oee  ociysfm2ea(monu) rxoxo3tydfmDeanvo t0 rtoim3ou4op n fetlsfsrrm( o;t0alen ietldfmDemnvs;t)alenmo3tatfm ran i (0 2umxm3oo4ope lncs ( sDtmumpnt0tetnmf3iyslm umuvp;(4tetrmo tatla rlu s;s)t2uriopoy1ap e fvsa()sruaum nt4tpt mfciyslm2eanmp;t0arerir iadlaDe uvi;s0 2tm(r nu4llte ivtlt)aDua( o;t4altniicilsls2ul(mont0tltrxf3tytlate nvols0seumim3oy1lpe mfcs (fs2ur(  nu1oetoiietatla rlnvs (0aetoxrctatla elueo;s0srtrimpnodolenmivi () Dtruro;o4tleo oeiysfsDemn sn(0 lerioctodfaDr iesl()trtmxo nudlme mncsa(f 2uru poo1oee  ietydfs2ul(vs;t) lenxrcoodlp rau s;s0trtrxr3nu1lm nliesa( aruax oot0aeeoifeiadla emuvp;t0tetrif3todfptr uvolt0s2xmir3oy4lpeemfes tfs2rm( ont1oleomi3ild s eaums t)alermr ta1fm rau s;()sexrxr iu4ome livtlt)arrmxr nt1texnio3tysla umumo;t4aeenif3iydlpDrli o;()sruoim iydllen fctatfa2rruroot0opto fcilt a2ua(mpnu4aexomr3todfatean o t t2uoio3ou1optnmici () 2tmu  nt0tpxo f3ildfs2eanms;(0tlxoif oy1fmteaies s)truoxm iodlp  mfcta() ruru ooo0alxo ocilslaDemnmp;u)tetrxfcoo1omtrluvilt0 2tmiopnodllt mieiat sDua( pot4ape iieiatfsDul(ms;(4arermrcta1oa   neo;t) 2xo(o oo4apte ncias) rururo;t0tle ifeildfa2ra( s;u0arxoxf iy1lmDeauvo t)s2toxm3iodlm n nciatfsrraxrp;u4oeen iciatlmDem(mpn(4tleoxrcootopDe ieils)tetrir io4amenmiesa()arurxmoot0oltnioctysfm2ea(vo;()tleoif tatop rlneo s0 2xo(o no4optn fctas) rtmxmo;t4tetn ociasfa2ulu on(4alxoxf3iydfaD luvi ( srxm(rpou1lmtn fet ()s2uax pnu0oltn o3tydfaDuan o;u4tltrxf iytfpD luvolt0 2ur(o oodlm elnvsas)aDumuro;o4texoifeiyslsDeanvsnu) rtrmr3todfm eai i t0sexoiopio1amte nvils  rrm(rpoo0alt mi3tldfsDemnvpn()artoxr3oo1omte u o;t)srtm(opnudllte iei (f 2rm(m nu0tltnmo3ildfm uln sn(4 reoxr3oy1omDe i ols t2tmxopno1oltn nvi tfarum(monu4oeeo i3iat mDem( p;t0 exomrciodlm r nvs;t  euo(m3nudom elfesa(f ruaxrooo1tptomociytfa em(vp;t4tlenir3todfmt anvs t t2uoio3nydome lfctlt)a2trumont1apx  i3tydfaDrlnvp (4 lxrifciatlp rli o;(0s2ur(m iy1oltnlicsltfa2ta(mpnu0apxniocilsfa uanvs;(4 lenmf io1fpte uvsl( teurxm ny1opeemici t arrrx  ;u0tptomi3tlslsDeanvs t)tlxrifciytla elnvo;( t2toiopiodoltn nvs () Dumx  oo1aetn oeild s2eaumsnu4aleoir3tytomtrluesls0 exmim iy4ll e fctas srtaxront4aee  i3tlt a emnmon() reoif3to1fatrlnvo s  rtm(r oy4omtemfeils)aDur(m nu1alx  iciyd a eanms;(4arerxo3io1optr uvs (0 2trir3nu1omenlivtls)sDra(m ot1alto ietldlsDulu p (0texrxocoadopte nvolt  2trir3oydomtemiesa( srum(r ;o4oet  f3iytlm uau p u) rtnxf3iydom eli ils) rtoxopoy1apeemfetl( aDrmu p;t1opx ifeiytlm2eauvs u)artoxf iy1opte nvs ( t2tr(rpou1lmteliet () rrrurono0apxn fetys aDea(ms (4texoxocoydlaDeauvo;t s2xm(o oudome mfcsa(faDrru oot1tltniociydfsDrlnvs;u0tltrif ty1lmtrlieo () 2urxopoo1aptelfeilt aDtaxmpot0alxn fetysfm2emuvp (0arerif iotop rlies ( s2uoim nydamt liviltfaDtrxr ot4oex io3iatlmDum(msn(0arxoxr ty1fpDraivolt t2uoxo3oodopt lfvsl(faDrrxrpot1olt iiciytlm2el(msnu) exomo3oytlaD ai ils0 2toxo iy4amte fvil(f rrrurp;u4ope  oeiadlmDemnms t0 leomocta1lmtran i;t s2xrir nu1olt  iesasfs2tr(mp;o4alxnifciysla ulnvo;t)altnxo3tytom rli il()teum(o iudlpee iciasf rtrxm ;t0tpe  feiadla rl( s;(4aeermr3oo1oa elu o (0 exr(o3io1lltnmnesas sDurxrpot1opxo fciys m2um( s;t0aexomo iytlaDrlnvs t  rxo(rpoo1omte fvsatfsDtm(m ou4tpxomoeildfm2ulu p t0treomo3iatla e i i s s2uo(mpiydale  ieslt a2rau pnu4oexnifcilsfs2ea( p u4 leomf3ta1lpDran il(0seurxopoodlmt lfvs s  Dtm(mo;t1tpt  ictlslm ra(monu4tltrmfciodfaDelueo (  rto(r3oo4al e fci s  Durxmpou1oeto o3tasla ea(mp;(4artrio3tydoptelnes t0srxm(rpny1llenlfvi s)a2ta(r ot1olx  fcildla2uanmp (0 rerxo3oatfa  anvilt  exmim nu1omeeliei s sDtaxmpot4tpx mf3tlt m2umnvs (0trerircoy1optrliei s)seumxmpnodlltnmfvils  2rmxrp;t0tptomo3tatfmDemuvo t) lxrio oatomtr ieo s t2xo(o3oo1oltemfvt () 2rm(mo;t4altn icilsfs ra(ms;(0tltrxf3oy1fa  livs;s0t2tmir3ny1op nlncia(f rra(m ;o4tpxoii3ias sDem(ms u4altrmocootom r nvi;( setrim3nodlmtemiet s aDra( oou0tpto feiyt sDranvont)aexrir oy1omD luvs;()teuoiopoy1ameemfeslt)aDuaurp;u0aptomieild s ea(ms;(0artnifcta1fpteaies;( t2tr(mpiudole lfcils)a2rmumonu0apxnio3iysla rlnmo;t0alxrmf3oatfmte ieol( sexm(o3iu1opt lncsl( srtmump;t4aee if3iat m ul(mo t4 rermo ta1latrauei s) 2ur(r oydlptnlietat s2rmu  ;t4olxn ieias sDumnmp;t4tlerioctytom eaivo s setm(r3iu4am n nvtas s2tm( p;o0apenio3ildfm2ua(vonu0aexrif3ty1opt ln s () 2trxm nu4lp  mfctls srta( onu4apeomi3iysfa rauvonu)aetnmf todlaDe ivs t0sexoim nu1aptnlivs (faDtr(rpot0oeeomfcild s emuvp;t)texnifcoodfpDeanvi;t trtoir3oydlptnmfesl(faDrm(rooo4tex mictydlsDrl( pnu0 reoif ta1fateanvols)s2urim3io1oltnmnvslsf Draxmo;o1olt  f3iyd a2ra(vo;u4 exrxf oo1la  an olt  rxmxrpnu1lp n nciat)s2trurpot1tpxo ociltfs ra(vsnt4arerxf3iydlatr neils sexoiopny1lleemiesls  2urum ot1olt iiciadfs2rauvs;u4tlxoxrcia1latelu o;(0s2xm(mpiydllee fes sfsDrmu pot1oltnmfctad m emnvs;() eerio iatfat lneo;s0t2tr(r3iudlmt lfvslsf 2ra(ront4tltomoeiasfm2umnms;u0 ltoxf3ty1fpDrlivil()texmxopou4op emicsas)s2trur ;u4tltomfeilsla uln p;t)aeeomr oatfp   nvi (0 2xoir3oydoleelfvtl()a2rmumoou0alx iociadfa2rlump;t)tlxoircoydfmD aiesl()seumim3ou1ope  fcs t  rraxroot1tet ii3ils m2uanmp;() rermrciotopDrluvo;s0 2tr(r3nodll nlnvtat) Durxr oo0tee ifeild m2ra( onu0tlxrio totfmt lneo;t trxmio oo1om nlnct t)s2trxrpot0tee ii3iydfa ul( p;u0aetomoctydlptr n sl()t2tm(r3nodopee ncsat) Drmur ;o4oetnio3iat m umnvo;t0 eenxf io1opDrlueils0 rurxrpiydol e nvs sfartmxrpou4ope micilsfa2rm(ms (4 eerir tatoaDelieo;s teuoir io1am n iei ( a2rrx  no4tpt if3ildlsDran pn(4 ltomr3iodoate u i;s0 eto(r3iydal nlfeiatfaDuaum oo0tpxnii3iadfm2ulumsn(4altnircoatfm eluvs;(  rxm(opnodom   nvia(f Dtr(r ;t0alxn f3tlslmDrmuvsnt4arerio iy1op   uvils0 rumxo3ou1ap n fcsasf Dtru  ;u0aet ifeiyslsDranvsn() ltomr3tadomteaieolt) eurxmpny4lm emfciatf rtmur ;u0apen o3tytlmDean pn(0aeeoirciotfpteli i;(  2um(o3oydaltnmictls) 2rmu onu4alxn oeiad m2uau onu4 eerxo3iatomtrau i t0srtr(mpou4apt lnvtl(f Dum( p;t1alenmf3ilt sDumn s;u0artnxo3oydoaDr ieo;t)teurir3iodlm nlfctlt arum(rpno1texoifciyd m2uauvs () renif3oatom   ues;t  exoir3oodamte fciltf Drmx ooo1oltomietltlmDrmn p () rtnxocto1lat  ues t)sexo(o3iu4lpe  fvtatf 2umu ooo0alxnif3ild sDuau on(0 lermfciadomDr ieols0teuoxm3oydlpe  ivsls)artmxrp;u4olx  o3tlsfa eaumpn(4arerxf3oatop elnvi;s  2xoxr3oy4am   ict s srumuroou0tptnmoeiatla2ranvo u)areoir ia1laDeaiei () 2xoim3nu1op elnesa(f 2taxrp;u4apt  ociat m2rm( s;(0alxoxr3iy1lp rlneils0srur(r3oo4oltnmfvt s  2trum ou1opt iieiaslmDrlnvo;(4texrio to1lptean il( texmiopoo1lm e netat s2rmxmpoo4olenmi3tytlm2em(mo;t4 rxnmf iadoa  auvol()t2xmir nodaltnlietl(fs2umu  ou4oeenmieiltlaDrl(vs;t)arerxrctodomtrluvs t)tetm(r nu4ap e nvs s)sDtrx p;o1altnmi3tldlmDuanms u0 exriocoy1lptrauvo t teuoim3iu1lltemfvtl() Drmur oo4apx  o3ias mDul(mp;u0 rerxo ty1faDe ieolt) exrxm ny1ol emnvsl(f 2rrurp;o4oltoiiciydfs2ulu s t4tetrio oodfmt anes;s) 2um(r3oodll nlivt t srraxr ;u4aexnifetls sDem( s;u)treoxf3ia1lmDr nei;t) rtmxm oy4am   ietl(  rtmxmo;t4olx mo3iltlsDrm(vs;u0artnio iydfa r ieo t t2trxopiy4omeemnvi (f Dtrxm ;t4tpeo f3iyd s2ul(vo;(4tlxrio oa1lmD li o;t0setmxrpnodol emncta()aDumx p;o1tleo fciyt m2rm(vs;(0aetrmo3io1optr uvo;()t2um(o3oodom  mfviasf Dta( poo1apt  iciadfm2ra(ms u0 eeomrciytopD anvsls texoxmpiy1lp nlnvtl( aDtaxmoot4aet iicilsfs rmnmp;u)trtomf iodom rluei s srumxmpoodalee ieslsfs2rmuro;o4olt io3iytfmDra(vsnt)aetoxrctatfmtelivi s  exoxo ou4lpen nes sf Dtau  oo4aex mfctadls umnvo;u)tlxrxfcoy1omte i ol() 2um(o3ou1ll nmfvtlt srtaxmont0alenifciydls rmu o u) lenxfcio1lp e ivi;t0t2tmir3no4ap   nvs ( artaxmpnu1oet ioctytfa ranms u0texomr ta1laD lu i;t s2trio oudop nmfcsls  Drmump;t4tleoif3iyd m2ra(vs (0aetoirciatlatr n i s0setr(m3iydopenmicta(fsrumur no4apeoif3tyd mDeluvs;u4 etnxf tadoa eaieols) 2xrir iudalee fesatfa2rmu  ;t0apxn f3tydfsDra(vsn()tlenxo ia1opte n ol(0texrimpoodlpte nciat aDrau  ;u4aeen o3ilsls em(mo t4 ltrio3oadfaDe u s (0 2xo(r oy1lp e nviltfsDrrx oot4oeeomo3tyd a umnmo u0teerxf3oy1lmD liei;s s2um(m oo1lpenlnct ()sruaumpnt0apxn fciat aDemnmp t)tetnir3oa1fatr n sls0t2um(rpiudaltnlncil( sDrr(m ot1tpe moctydfs2rlu o t) eerir3iydlptr nesls0t2urir3iudlltelfvtat srur(ro;t1aetn iciadfm2ua(vs t)aexnxf ootfmD lueo;s0t2trxm3ou4olt mivtat  rra( p;t0oet mf3tatlaDul(mpn(4 rtnmocia1faDrluvils teto(mpiy1op  mncsls srumxrpnt0alt  o3ildls2uluvs t)aleoxrcoadlmDrlivs ()teur(opou1lpeelnei sf 2tm(ro;u0tlto f3iysls2ran s (0 lxoxr3ootfmtranvo s t2xr(m oydamtemfvi sfsrua( p;u1alto f3ilt a ra( o (4 rermr3oo1fatr ues t)setoiopno1apen fvtls srtrumont1olxoioctadla2uauvo t4trerif3iadfmt anesls0s2tmio3nodlmee feil( aDuaxr oo0tpx ifcias sDelu o (0texnmr oytlptrlivi t0t2to(r nydap  mfci sf rum( o;u1aet  iciaslm ulu s u0texnxo totopDeaues (0trxmxm ou4ll emnetltfartrxmpot4teenmietadls2ea(vo u4alermocoa1fmteluvi;t) exoir3iudomt mfesltfs2raur nu4tet  fciatfmDrm( s;(0tlerifctydlp r ivo t  2xoxr3iy4lle mneta()arra(mp;o0apxomf3tltls eanmsnt)texrxo3oatlm r i o s0seuoxo iy1lmt  iet ( sDum(mp;u1ole moctysfsDea(ms u4texomrcoatomte n s t0texoir3iy4om n ncs (fs2tmump;u0oexo o3ils s rmnmo;t4alenxfcoydop  auvs;t t2xo(r oo1ll elfcsl( s2umur oo4tpen f3iytfa rmump;u4tetoifcto1la  luvilt0srtoxrpnu1apeemfctltfsDtr(ront1ole iicils a emnmp;()tetoxo iotlmt aivs;()s2umxm oo4ol   nvtls)a2uaxmont4opeoioctyslaDel(vsnu)altrmo oatfmtr nvs t) rxoxo oy4amtelnvslt  Dururpot4aee moeiltfaDeln p;u4alxoxrcio1oa   nvs;t teumim io1lpee net ( a2rax ono1aexoiiciaslm emnmo;u) exnxrcoy1la eanei t0t2xmxo3io1open ictls)aDur(mpou0tpe  o3iydla2ra( pnu4trtoifcoy1opDrluvs;(0tetrim3ou1al  mnet s s2rrxr ;o4aexnmf3tltla2ea(vs;()tltrio3oy1fpDe uvs;s)texrxr3iu1omtemncsl(  2rruroot4alen fcils m um(mp u)aexoir iy1fpDrauvils0teto(mpoo4ap n ivsl(fs2ururoou1olenmoeils s eanvp;t0tltnmfciodlmD  i ils0 exrxopnydoptnmietas) 2rmxrpno4apxoif3tytls2rmnmo;u4 rxoxo3ootoa   nes (  euo(r3nudope lictat arra(  ot4aee mociytls2eanms;(4aexrirciytopDr i ols) 2uo(o iudlptn iei (  rtmurooo4aet miciat mDumnmpnt4arxrxrcta1opDeaueo;(  2xoxo3oudlm n fet s) 2rmurpot4oexnmictldfaDrlnvpn()trtrxr3iadla e i s;(0 2um(r nu4lmeemnvt tfsrta( onu0teeoioeilsfsDrl( p t0aexoifcio1lp  auvolt0 etr(mpoo1opee ietat)arrm(m ;o1tltnio3iyd m2emnmo ()trtnifciytlmtelieolt)texoxopoy4lptelivsa( arrmumpnu1tpx ioetytls uanmo;(0 reoxo3oo1om e iei;t trtrim iydame lici (fsDtm(m ;o4opxo icildlm2um(ms;(0 exoio3oadlp e ieols  exr(r3io1lmte nvia(fsDta(mont1tpeo o3tltlm rauvpnt0 rtrxocoydoat  neo s0srumxopno4lp nmicia()a2rm(root4oexn feiaslaDrm(vo t) ltoxfciadlptelu sl(0 eumio3no1ol nlnvsls)arrr(  nt4opt  f3ilsfm2rm(vp u)texnxfcoydfat lu i s s2xoxmpoodam emfvilt a2ta(rpou1ole ioeiadfs elumon(0 lenmrcia1lmDrlivils0setrxm3oudomt  nvi sfsrtrx poo0apx io3tatlm rlnvpn(4tltrir3iatom e u s ( tetrxmpiu4lp  livt s aDraxrpnt1tptn ietat sDem(vont4trtoxf3oadfm elivilt)trxmxm3oudlpe lfvs sfsDuaumpnt1tltoii3ildfs2uanvpn() lxrxr3tatlpte nvo t0trumim3iu4om e ivsa( a2ra(  ;t0oeeo ociydfm elumo t4tlxnio iydlmte n o;t  rtmir3nydlp emneilsfsDrrumpnt0alxniiciydfs ra( pnt)tlerircoa1laDeaies;t) etrxo iu4lpt  fes ()aDtmu ont0tpxniociydlm2em(mo;t)trtrmo3oy1fptr u ol(0trxo(o3oydllt lies t)a2rm( pnt4olxniociad m2uanvp;t4 exoio iotfm  lu olt)t2tmim3nudlle  ivsas)aDrmumoot1aeeoii3iysla rm(vo;u4tlxnxo oatfpDeaiei (0s2urxo oudolee nvslsfs2tau  ot0tleo feils mDul(vp;()altnmf3todlp  aivi t trtmimpny4ale mieilsfaDurxm ou4aexo iciltfmDrmu pnt4trxrmf3oy1omt  neols srtoxr3iydom elfvi tfa2uaxmonu1alt io3tas m2ean p;(4trtrir tatlptr u o;t0s2tmxmpoy1lp  miei (fa2ua(mp;u4aexoii3iasla2elu o ()alxoxr oytlmDr u ilt t2xoir3ou1lpt mnvta() 2tmx o;o1altnmicilsfs emums u0 eeoxf3tadfmte i o;t0s2xr(m oodomeemfvt s a2taxrpot0oexo i3ildla2em(mont) lxnxociadfa   uei;t0 2umiopnudam   nvtl( srtm(rpnu0oltniieiltls2umu s (4altomfcoodfat  i ils)tetoxo no4al   ivsa(  Dtmxmoot1aleoioetldls2uanvo;t0 rxrio oy1fmDeaueo (0 exrirpnodal nmncs ()aDur(ro;u4oet iociytfs2em(vs t4aeermf3oadlmDeau i;(0 rtr(mpnodopen ictls sDum( o;o1teeo f3iaslm2rmn p ()trxomrciotfmte uvs;t0trxrxopno1altemfcsatfaDtr(monu0oexomictys sDran pnu)trtnio3ootlm eau ils)setmio3ou4amtelivslt srtau  no0texo ieiatfs2ea(vsnt0aexoioctydoa   u s;( trtoir iodopen fcs (f Dumumonu1oleo o3iyslm elnmont4aexoxrcto1fm  liei;t)seum(m3oy1ome  iesatfaDta( onu1tet if3ildfaDua(vp u4 rxnmfcty1fpte uvol(0 exr(m nu4omt mfctl(  Duau o;u1tetoioetlt a2em(mpnt4trxoio ty1lpD  u i;( sexrim3nydlltemietasfsrur( onu0ole mietld m2elumpn()trxrmr3to1fp e uei t) 2tmim3oy4al n ncs tf rrm(root0alt  feilsfa rmu s u) rerxf3oy1lpteauvo t  2uoio3ou4am n neiat  Dtmu  ou4alxomfeiltfa2ulump t4tlxrmf3tytoaD livo (0s2uo(m3iodam e iviat)sDtrxro;t1apeo i3ildls2ul( s (0texnxrctodlmDe nvs s)srurim nudap emieia( aDrm(  nt4tpx ifcias m rl(vo;u)texniociodla  anvo ( sruo(r oodlmeelieslsfaruau  nu0apx if3iys a2umu o t0tlxomr3ia1omDe nvi s s2toxo nu4ol emivtl(  Dtaum nu0olenioeilsfm2emu pnu4 eeomfciy1fptr ueil()trtoxmpno1opt lncsat) rurum ou4tptoifctldfsDean pn()tlxnmf ta1fp rlu s ()srtmxr nudaltnlivtatfsrurxm ;u1opx ioctldlsDemu s (4 lenmr3ty1fmDr nvo s)srurirpoo1ape  feia() rum(ro;u4oleomictys m2elumpnu4aleoir todomtrau ilt sexr(rpiy4lm  micsa()aDtmx  ;t0tet mociltfm2eluvp u4aleoxfcta1lat au o;s0teurxo nu4alenlneta( aDumx p;o0aeenmicild aDraump t) lxrmo oodlpD lu i s)trxr(opno1omeelivils a2ur(  ou0aeenmoeiydlm2ua(ms;u0aleomo3iatfa eai ols)srxm(m iu1ap e fei ()a2taxro;t1alt ifeiys s2uan o t0 rtrxr tadomDrauvi;t texoim3nodamt mivtatfaDtrumooo1tpenmfciysla2ulums u0tlenxr3tatopDe ivo;(0t2tmxm iodomeemivsas) 2tmxr ou1altoif3tlt mDrluvsn()altrif3oodlaDean o;(0trtr(r3oudaptemfcsl(fsDrmxroou1alt ioeiatls em(vs ()trtrxr iotlmtr i ilt)teuoxo ou4ll  lfet s)s2rmumo;u0oetomo3iysls2ua(ms u) rtrmo iydoate uvi t0srxmxrpno4omtnmicslsfarua(  ot4aeenii3ild a2uanvs;(0 etomfcootfmDeau i ( seurir no1alt  fvia() Dua( ont4tltnifeiltfm2rluvs;u0 rxriocia1laD aivs;s)srtmxr ou1amtn fvsat srtaumpou4oltnmoeiyt aDuan s u4 etnxf3totlmDeanvsls0setrim oudap  mnviat)a2rmumoot1oexn fctys a2el(vp;u4aeerircia1faD  neols) etmir3oy4ame miet sf 2rrxmo;u0aeeomfctydla el(vp t0aetrxr3tytfpteanes ()teumir oy1omt mfesa( a2rmurooo4tpe ii3iaslm uan s;t4 lxrmf3ty1lmDrauvil()t2tr(r nydlmeelfesltfsDtrx  nt4tpxn fctas aDua(mp (0areomo tadlpt  u olt) exr(m3nudlme  ietls artm( ono4olen f3iat a eanmo (4tlxoxf3todopDe n s;s)s2trxo3oo1opeemnvsls  2umxro;t4ope iietytlmDuauvsnt4artnxo3oodomD luvi t)srtrxopou4lleemieils arraum ot0texnmi3iyt aDeaumo;(0 lxrmo3oodlmDe ivols texm(r3iy4lpeemiei ()a2ta(mono4tpenifetasfa el( pnu4 lermfcoytoa elu i;s0srurxm3iydlpee iesa(fs2uaxmont1tleo fctatlm2ea( o u0 etomf3oydfm eaivo t0 2uoimpiudomtnlivs tf Dra( p;u1ope  ociltfa2uanms;u4tlenmr tadlatrluvols0sruoim nudamtelneia( sDrru onu0tleomictatfsDumnvp;u4areomo3todfmDr n s;( trtrir3nu4lm e ictat aDurxmpoo4oeeoiiciatls ulnvs (0artomr3tatoaDeln o;()texm(r iodamtnlfcia(fa2rmum ;t0aex  f3tldlsDeanmsnt0 exoxo3iadoaD  u ilt) exrxo3oo4ole mfcsa( a2ur(mp;t4texnioctysfsDuaumo;(4 reoxr iatlpD an sl( t2toxopnodamtemfes ()sDumx  no1ape iictadfa rluvont4trtrmo iotom eauvil(0t2urir3oy1am n fvi ()srtaxmono0opxomieiatfa uan o;t4 rtnmf ty1opt aies;t s2urxm oo1omtnmfet t aDtr(r ;o0tle mociytla rlnvsnu4trtrir iadoa e nvs t t2xrxo3nu4ale lfesl(  2urxr nu1teeomfeiys sDea(ms;t)trenxo3iy1opDe neols0 eumim iodomtnlics s a2rm(mpno4oetnmictyd sDel(vp t4teerxf3iydfa r nesls0truoirpiodop  lictl(  Drmum ou4oeeoio3iydla ul( p ()alenmfciytfptrau s;(0 eumxo3oy4alenlfcsatfs2rmxmpnt0aexomi3iyt aDeau p;(0 ltrmrcoa1fptrlies;t0t2tr(m iu4amtnmnctltf 2umumont0tpt ifciatfa ul(mp;u0teeoiociytlm r i sl()t2tmxm no4lptn icta()arrru oot1optoioctat a2ra(vsnu4alxoxo3ty1fmtelu il(0seumxmpio1omt  ncs t)a2raxmp;t4alt ifetld mDem( ont0alxnxrcoo1opD lneol( srtrxr iudamtnmivils aDrmxr no1tpeomiciltlm2rl(mo (4trxrxo3ootfmt  n i;s0s2xmxmpiu1om  lfesltfsrtaxro;u4tltnif3iytfa uluvp (0aeenxf oatom  anvi t s2tmirpio1optemnetasfarumxmoou4apx io3iatfs uanmonu) rxoxfcoy1fpDrauvsl(0s2xrxo3oy1opt lfvsas)sDtmx  ot1tetnii3tydla ea( s t4arenxf3oy1fp   uvs t  2urxrpio1ol e nvtat) Drm(moot1apt iictyt mDeanms u) lxnir3ty1la  anvilt texm(o3iy1lpt  nesa(  Duau onu0oet io3tyt a ul( o;u0altoxr oatfaDr nesl()s2xmirpiu4ap  lfci s)a2rrurp;u0tet  ietyt a rl(vonu) eenmo oytlmt  ueils seumim3oy4altnmieiasfa2trumoot4tlt ioeilt a2rlumonu0alxoxocta1lpDrlies;t  eumxr oo4ap nmicia()sDtrumo;o1ole moetyt a2uan o;u)trtrxf3oy1oat ai o ()srurim3nu1oleelfctas)aDrr(ronu1tltomi3iysfa2ulnvsn(0 exoxr ia1lm   n o (0texrxm no1amt lfciat sDraurpnu4tlen ociad s2ulnvo t)trtoxfcoadfaDeanes t0 eumim3oudal   nviasfsDtau  oo1oexoio3iytfsDumu o;u0arxoxf3oytoaDraueol() rtmir3no4ameelfcsls) 2tm(mp;o1oexnio3iatlaDuan snu) rtnxf3ootomtrau olt)srtrimpno4al nmiesls arum(m no0oex mo3iasla2rm( p (4trtomo3iy1lpte n s;s srtmxm iu1apeemnei s)s2umurpnu0oleo fctatlsDumn s;t0alxrmo3oadfmDr nesl() etmirpiu1al  lictas sDuru  ;u1oetoifctldla2rl( p;t4 rxrifcta1lm  aivsls trxo(r3nydal elneia(fsDurxrpou4tlen i3tls sDemn o u0alxnxf iatlp eaivi;s)srtrxo oo1omtnlnes s  rurum nt4tpen oetad a raumsnt4tleoxo oy1fmD luvs s0srxmimpnodomte ivt s arumu  ot4tltnmo3tldfaDrl(vo u4texoxr3tadfaDr u s;t) euo(m oodaleemnesa()sDtm(m nt1aptn oeiydfmDum( onu)teeriocia1fpteai i s)setoimpoudom emncta(  ruaxmoot0oetomfeildfs2uauvpnt) etrirciy1om  anvol(0 rumxmpoudolenlfetlsfsDtm(rono1oetomoetld aDrmuvo t0 lxoio ia1omteanvs s)srtoimpiudlm  lieils)artrxmpno1oex iieiasfaDumumo t4aeenmo3iodfa  ln s ()t2tmxrpou4amt mfet ( sDum( pot1apeoioctatla2emu o t)alxnxrctydfa eauvols teuo(m nudlp emivils) Dta(rp;t0tlt miciadfa uanms (0tlxnmr oadlmteaiei;t) euoxopiy4llen ieil(farur(  ;u1oee ii3iyd s rl( onu0trenxf oatoa r uvsls srxoim nodlm  miet ( a2tax onu1tle ii3ildfa em( o;t4 etrxf oytlpDrliesl() rxr(rpny1al emfci s a2rru p;o1tlt moeilslmDua( sn(0 etoxr oytopD livsl( sruo(m io1lm  lnvtat)srurxmoou0oleomictydfa2uluvs (4 ltnxociotfmt au s t  2urxr iy4al elnet tf Drrurpot4tlx  ietyt a2ea(mp;u0tetnmrctodopDr i sl()srum(rpou4olt mfeias artr(  ;o0tpxnii3iytlm2raums t0areoxrcia1lmDeli s;t srtr(m3io4lp nlivt sfa2rm(mooo4tptomo3iat m2ra(vs t4texrmo tytfat lu ils)setoxo3oudlltelfes (f Dumxrono4opt miciydla2ua( on(0teenxfciy1lpDr ivs;s  eum(opoodolenlfci (  rrmur ;o1apxoifeild mDuluvon()areoxo3to1omDr ueilt0seto(m nu1apt  ictl( s2rrumpoo4tlt  fetyt mDrmump;t)trxoxo3ia1lpt  nvs s)sruoimpoy4omee feia()srurxmpnt4tlen fcias mDumumsn()arenxoctotlm   uvo;s0teuo(m3oydamtnmfeta(f Dtmxmpno1aeeomfctasls ranmp;t4 ltnxr3iodfmDrai ols  exrim3nu1al e nesl(  2rmx oot0tpxn i3ilt m2emn s;t0alxoxr oa1omDrlu s;() rxrxrpnudomeemiet ( s2umuro;o0oeeomfctltfm ea(mo;t)trermr3io1opDranvslt)sexm(m3ny4oleelfvia(fsrumur ;u1apx  i3ilt aDeluvp u)teeoxociy1opD aieo t0 exrir3no4am emies s  rtmumo;o1tpe  f3iasfa rlu p;(4teenmfctotoat  u i;()s2xrir3io4om e iei t)aruaxmpnt1optnmf3tysfmDuanmsnt4trerifcootlpD lu s () 2tm(rpnydll  lfvsas) Draumoot1aleoifctatfmDra(vo;(0arxrxf3iotfm   iei;s)t2xoirpiodlme  fvs tf 2umu pno0aptniociyt a2elu pnt)aexoiocty1omtrln s s)texrio3ny1omtemfvs t)aDuau onu0tlxomi3tytfm umn s;t4trermr ta1fat luvi;t)t2toxm3iu4amtnmieta(f 2rr(r oo0optnifeiadls rl(vs (0aexrircoa1lmD lu o t) rum(m3iodlltemfcslt artr(mp;t4apx  fctlsfm2ra(monu0tlxoif oy1laDr ueolt) rxr(mpiodame  fes s)artrxmono4aetomieias a eauvs t0alerxociatlmtrai o;()teumim3nu4opt  net t) Dtmu ont4teenif3iysfaDul( p t4arenmrcta1lmDe i i t)srtr(m nydlltelnvsl(fsrumxm ou1tetnif3tld a el(vs ()arenir3tatlaDran il( teumimpnu4omtelicsas) rra(ro;t4tpeniiciyt m ua(mo u0 renmociadlmDe ueslt0t2um(m oo4llen nvt tfsDtm(m ;u0ole moetytlaDrlump t0arxnmo oatomtrau o (  exr(r nydom elfvslsf rtmu pnu1opto ociatla2emuvo ()tetomf iytlmtr uvsls  rtm(r nu4om  lfes t)a2umxmonu0oex io3ild a2eluvon()aeeomf tatfpDraneilt) etmxm3no4ol  lfvsat)sDrr(mp;u1oet io3iytfsDrmnvs;u) reniocoytfp r ivsl(0texmim no4alt liet ( s2trxronu1oexn feiyt a2um(vp t0 reomo3iy1lp eluesl( s2xo(mpiodapt livt ( a2raxr ;o1altn o3iys a em(vo;t)tlxoxf3oy1lmD li s t0s2xmxm no1opte ivils arurxm nt1opxoifeiad a uluvsnu4tltrmo tatomDelnvi;( trtr(r oo1ol nmfcsas)a2rr(r ;t1tptnioctasla rluvs u)arxoxo iotomDrlueo;s)trurxm ny1lp n nesl() Durur ot1tlt iietld sDrl(mont4trxoxfcoodlpD  nvs s) euoirpio1apt  nvtls)a2umx p;t0opeo fcias s2raump;u4 lerxo3oydfa e u i s0srxrxopnydllenliet ( aDumumooo0aetoio3iytfs2uau p;u4 exrxrciy1la e ivo;()trtr(opiudoltnlfet ()aDtmxm ;t1oleo f3ils sDranvpnu) lxrmrctydomtr n s;( trumio3iu4op elnvilt srra(rpno1tlt ioctasfaDemnvpnu0tetrmfctatomD anesl()tetoir3oy1lpe lncs ( aDraur ou0tptnmociys a umnms (4aetrxfciytfaDrlnes t0 2tr(opnydlm nmnvt ( s2urumoot4texomictyt aDra( on(0 exrmf oo1opte ieils) eto(m3nudom elncs tfsruaxrp;t0aet mo3iad aDrlnvp u)artrio tydfaDrai s t)trur(o3oy4apeemivs s)aDumu ont0tpe mieiadfs2ua( p;t4tlxnmo3totoatr uvi (0s2urio nodll nmiei t)sDrau o;u4texniiciatfmDrlu p;u0altoiociydfa rau sls0s2trxo iy1op n fetltfaDtr( onu4tpe  oetldla2raumo;t)tlxrxr tadop r n s ()trxoio ou4lmtnmfesl(fa2ta(  nu0optnmfctldfa ranvs t4alxrxr todlmDe nei t0sexm(o iu1lp nmnes s  2tau pou1apeo i3iltfa ea( o;u4tetnmr iodfa raivo;s  rto(r3iu1ol nmfvia(faDrrum nt0oetn i3iysfm2umnvp;t0tetnmf oatomtrlnvi;s)trxoxrpno1ol nmici t) 2taur ;o0opxnmicildls rmnmsnt0 etnifctatlmD  ues;s0srumir iodope lfeias sDrauro;o1oexomfctysla2umumonu4 rtoxo3todfatr nei;s teumiopoudopen ncsas)s2um(mp;u4apt  ietatla2uaums t)artnmf3tatom  ai il()srtoirpou4lpe mneiat srrmxr nt1aexo f3iasfs2uauvs;t4texnifctydfaDrlnvo ( srurxr3oy1apee fvt tfa2ur(roou4tleomi3iytlsDumu p;t4tlenmf3oodlp   ieols t2tmxrpnu1lm nlnvtl(fsrrr(r nt0opxomo3tat a2ea(mo;(4arenmr tytlpDranvi (0 rtrxo3oudomee nesas sDraurp;t1oexo oeiltlaDrlnvo;()artnxocoadfpD aues;s)srtrxo3ny4ol   neilt srtax  ot0olt if3tys mDumuvs;(0artoxo to1oa rlnvo;t trxmxm oodlmeelivt (f rtrurpno1aptomieilsfm2emums t4aeerio3oydfatrlueol(  2toir no4llt lneiat s2trxmpou0oltomfctatlaDeaumsn(0teeomf3tydom eaivo;s s2uo(rpoo4lmtnmicsa() 2ra( pou1alxo o3ias a ulnmp;u)arxomo oy1lpDr ivo;s  rtmxm oo1apt mfci (fs2tr(ro;u1opxomfctyd sDua(ms u0tltrio io1oa rln s t truo(r3iy1al nmnes ( s2rmu ooo1apeo fciad s rmnvpnu0trtrmr3oa1opDrau s t setoim oy4omt livsat)srrmxm ;o0ale io3iatfa uau onu)tetnifciydomtranes () etmir3iu4lltemneil(  Dum( pot0alxnioctad a eau sn() exomocoytlpDrau i;t sexm(opio1ope lfcs (  Durxr ou1oexoiociydlmDrmu s;u4trerifciytla elieo s0texmimpnudlmenmiciatfsrur(m nu0tle iieias aDrmu s;u0texrioctatopt luei;s sruo(m io1lm emnetas aDra(m nu4apt iieildlsDumn snu)alenxf oatlm e u o (0 2toiopoy1altemfei sfarurum ;o4aeeomfctysfmDuluvs ()tltomf tatop  aivo s s2tmio oy1lpe mncsas)srtauronu4apt mfetaslm rl( p;t4alxnxo3ia1fptrai i s  2xm(rpiy1om  mivtl()artmurpou1teen feiys m rl(vs;(0altrxo ia1omt aieilt t2toim3oy4lp nmncilsfsrtmurpnt1optn f3ildfm2ulump ()aetnmf oodla rln s;s)s2tmxo iu4lp nliei s)a2uau pot0aex ioetadfaDum( pnt0tleoircty1omDrlivs s trumir iy1ope lnetlt)srra( ono4alxoif3ils a elu snt)aeeoxo iy1fmt an olt0setrio3iu1ome lietlsfaDurxrono0tlxo feiaslm elnmo;(0aexoxo oodfpD  ieo;() rto(rpiu1optelfcsas arrmxm nt4tlx mf3tltlmDeanvp;u0 ltnxo3oa1fatraivs;(  2xrxmpio4lme  ici sfa2uru o;o0tleoiicias a2ua(mon(4 lxnif ty1opD  ivo;(0sexrxmpoy4ll  lics sf Dta(m ot1apxo oeiadfm2ulu p u4texnmo tadfateanei (  2umxr3ou1lpte iviat sDrru poo4tlen ictydfm umuvsnt0aleomf3tydoptranvil(  rurirpiu4opeelfvsl(fsDtaxm ot0tlenioeilt mDrl( p t0 lerir iatlp raivs s)t2umxmpiu1olt  feta()aDurxmpot4apt mf3iaslm2emuvont0alxomrcoadop rlueils  exrim nodlleemnci s  2umu pnt1oleomiciytlaDrm(vs u0 etnio totomDeai slt)teuo(o3oodam nlnvsls)aDua(mpnt0oexnmf3iadlmDelu s ()aexomo3oatlm eaivil()t2xrim3io1al  mnvi t)a2urxront4optomiciydla umu s;t)tlxrmo3oydoptraieo t  rtoiopnu1olt mieslsfartmx pno4olenmi3iydlaDuanvpnu0altnirciytlm eln i s0teumir oo1alt lietat)a2tax ono4teenmo3iydfa ranmo;u4trxnio3iytlpD lnvol()srxmim iu4lmen ivia(fa2urxmonu0apenio3tas a2eanms u)altnmo3iydlmtr nvs () 2uoio oy1omenlfetl( arrrum nt4apen o3tatfm2em(vs ()texnifciytfp  anei;(  2trir oy1olenmnvsas)sDraum oo0tptoioeilt s rm(vs (4teerif3oo1opt  ieol( t2urxrpiudame lieslt aDumuronu0ole moeiat a2rmnvs ()altnmr3iotfa eliei ()s2xrxrpny1alte ietls a2rax oot0oltoif3tlt m um(vsnu4 lxrmrciodlpt ln i t)srxmirpou1optelivilt aDtm(mo;u4ale  f3tlsls ea(vsn(0trermo3ootfa eau ols trxm(r3iodameemfcsls)a2ur( p;u4alxnmoetasfa2uln onu)trtrmf tydop eauei;()t2xr(mpoydolenlncilsfsrrrxroot4olx mfetldla2ranvo (0 etnircoo1fm  aies;(0srtr(o3no4lltelneil(  rumuronu1tetn oeildfa2ean s t)trtoir iadlmDr i ils trto(m no1olt  nvsa(  Dumur ;t0olxnmfetatlsDem( on(4treoif3oy1omDean i;t0setoio oy1lpe mfvtl(  Drm(rp;t0oet mfctyt aDrlnmpnt4aeenif3iy1lm  lnvi;s  2trim oo1lpe mnvtl(  rurx ooo0apx  iciltlaDrmuvpnu) reomf oodlp 
\ No newline at end of file
@@ -0,0 +1 @@
+nvil(0s2xrxmpny4ale miviasf rta(m oo4tex ioeiydlm ulnmp;(0artoio3oadlpD  iei;t s2xmxr3iudol e net s)sDta( p;t0olt mo3iltfa ra( o;(0tetomo3ia1fmt aivol( tetm(o oy1apenmnvt tfsrum(rpoo0tetnmieiys s2rm(mo;u4altrxf ia1fmt aivi t)srto(m3oy1ll n ies s  rtmxro;o4apxomfcild sDrl(mp t) lxnxo oa1la r uvslt) exmxr oy1llee ncs tf Dumx  ;u4optn fciatls2eanvo u)alermo todfpDeaiei;t setrio nu4lleemiviat) rrax pno1tpxomf3iasls emn pnt4tetrxr iatfpDrau o;(  eto(r3no4amt mfviat sDtaxr nt4aexnmietadlm el(monu4tleomo3todfmt ai s;t)sexr(r iydalt lnvi (fa2tm(mpnt0tee  feiaslm el( ont4tltoir3io1latran sl( trxmir ny4lm nmivi (f 2uax o;o1oexomietls m eluvpnu0 etnmo3tadfateai i;s0 2umir nodal  livt ( sDumxmpnu4oeen ociad a uaums (0alenmrcoa1lmDeanvo s  exrim ny1al  mfci ()a2um(mp;u0aeeoifciad a ra(vp;(0aeenxociy1faDrli s;t0 etm(rpiu1al  lieia( arrm(ro;u4tlenii3iysfmDelumsnt0aetomociytoateau i t0trxo(opou1llenlfctas)a2raxmpou4tle if3ilsls2el(vs;u)trenxf iodfm  ln olt0srxr(o io4ope mfvtlsfarrrum oo1apenioctysfm2el(vsnu)aeeoxf iotfmDelneolt0 2xrio3oudol   nviatf 2ra(rp;o1tlenmoctys m el( ont4 rtnmfciodfmDelues t)teumxm oodal nmnvt t)arraxr nt4oexn i3tlslsDemums;t0 eenio3ty1fa rluvo t s2trxr no1ap nlfei ()sDumu ont1olt  f3ias a2rmn o;u)alxnio3iatfpDraivslt  eum(m oodolt lfcsa(fa2rr(ronu0tleoioeiaslm uanms;u0aeenmo3oodomDe uei t0texr(r nu1alen nvt ( s2taxmpot4alxo ieilsfs2rlnms u0aexnmf3ty1fa r ivo;(  eumxo3oodop elivsatf Dta(r ;u4tlenifetys aDelnvonu)trtomo tadlp e iei;t0trxmim3oy1om   ictltfsrtm(  ot4tpt  ociytfmDulnmo;t4trxnio tatopDr n i s srxrim ou4ame lfvsasfaDur( pno4alenmfetadlm umnmsnt4 eeomociydfp   nvo ( t2xoiopou1llee ivt (fs2um(rooo4apx ii3tltfsDuauvpnt0teeoif tytoaDraivi t)truoxrpou4llenmiviltf Dtaxr nt1tpeomf3taslm2ranvo u) rxrir3oatlm  lieo s)texrxr iy1lme lfcsatfarraumo;o0opt  o3iydfsDuanvpn(0arenxrcty1lmteanes;t trtoir3nu1alt  ictltfsDtmumoou4optnmociytls2ulnvpn(4 etnif3iydlmD au o (0trxrxmpnu1lm e fvia() 2raum nu4olenif3iatlsDeanvpn(4texnxo3totfpDeauei (0 2ur(r nu1om  lfcil(f rrm(mp;o0oetnmietytfaDel(vpnu0 eerxr tadomD luvslt0trxoxo3iy4alee ies t)sDrauroou1aexnmo3iydfsDel(mp;t0 eeomf3iytop  anei;(0sruriopnu4altemfcil(fsrta( p;t4oltn fciadfs ulnms (0alerxo3iadomt lneo;s s2urir ou4am e net t) 2uru onu1tpen ocildfs rmu s ()artomr iydla ean o;s0s2trim3iy1lmte fcsls a2uaurpoo1alxnioeiat mDeau o ()aexomocto1lm  aivo s0teurio ou4ome lfctl(fa2rrxr ;u0oexomi3ilsfs2uanvo;u0 leomr ta1fmt li o;s  2uo(m3iodomee fci t)srra( p;t0oltn i3tldla2ranvp;u)altrir oadom r i il(0 2urim nu1ope mnctl()artr(mo;u4oexnifctldfs2rmnmp (4tlenxr3iy1lm rln s (  2xm(r3oy4oltelfvsls  rtrx o;u1tlx mf3ilslaDrl(ms t0 exrmf oatfaDrli o s s2tm(m iydlmt mfesa( s2taurp;u0tpenmfciyt s2ra( s t0aetoir3iotlatrlieol( t2xr(r3no1ole mfeiat)s2trx o;u0optomictasfsDeaums;(0texrmocootomt  nvsl(0texoxopoydam elictl(  2uru o;o1aptomi3tldls ra( s;t)tlxnifcoytoat aieil()srtoxmpou4omt  icsl(f 2uax p;t1opeo ictad mDrl(mpn(0altnxo to1oaDr ivo t0 exo(o3iodlptnmnesls sDtrumo;t1opt if3tasla rmums (4aetoxociytomtr ies;( trtr(o3iudolenlncs t srrrum no0olx  oeiltla ranvont) exoir to1lm ean i ( s2ur(o no1oltemnes t  2raumpnt4tpenif3iaslsDuaump t0 eeoircia1late iesls trur(mpiy1om e feilsf rum( onu0open o3tyd m emums u)trxnxocto1oaDranvi (0t2uoxm3no4apt mnctl(fsrumx  no0tlen i3iadlm ea(mp t0arxrmo oytopDeaivs;t)t2umir oodlpt mnvia() rtmxr ;t4ape  iciydlaDrluvo u0aexrmo oydlpDraueo () rxoxmpnydom  lfvia(faDra(r no1aptn i3iytlm em( o;u)alxrxrcty1omD  ivs;t0t2xm(m ou1aptelncs sfs2tmu pnu1tlx mfetas s2ran p u0trenmrciotomD  ueo t t2ur(mpiydamt livsl(fs2tmxrpoo4alxoiiciat mDeln sn(0altrxo3tytfaDelnvs;t srtm(mpoo1lme  fvta(  Durum ;u1apt  o3iysls2emn s;t)treoio iodoaDraues (0s2xoxr ny4opee ics tfaDuaxrp;o4apxniietydfa2rmu p u)aeenmo3totfptr n s;t)srumiopny4lle mfctl( aDuau  ot1oexo i3iltlsDrlu s;(0teenmfcto1fm ranvolt trxmiopoodlme lneiat aDur(  ou0ope  feiltla2rln ont0teerir ootlmte iesl(0teumimpoodlltemneiat)arrax  no0oltn ociad a2el(mo;(0artoxf tadfaD ai s;()sexmim iy1ome mici s) rtaxro;u4tex  ociytfmDrluvs u0 eenmo oy1lpDr uesl()trumxmpoo1op nmncsas artau ont4ope mfeils a2umumonu4 ltnmo oydoptrli i;(  eum(o oy4lltelnesl()a2rmu pot0tpt  fctasfa2um( snu) eenif3io1lm  an o s0teurio oo4ole livslsfsDua(rpoo4tpx mf3tydfm2rl(mo;(4aexnxo3oo1fp  livo s) exo(m iu1ap elnvi t a2rr(mpnu0oleomf3tasls2eauvs t4 rtnir totlmt anesls0srto(m iudomt mnct s)srrrxmono1optnmicils m ean snt)trenirctytomteai o ( seumxr oodllenmnct s)arumxm oo4alx ifciysfsDulump u4trenifcoa1omte i o;s)srxr(rpoo1ll  mnvi t s2rm(mo;t1oee iieias mDum(vsnt)tlenxf3oodlp r n i ()trtm(m nu1altnlfvil(fsDuaxmont0tle mieiydfa rm(vsnt0arerxr3io1oatr nes t)s2tr(mpiy1oleemivtls) Dtmum ;o4ale  feiytfmDem(ms u4 eenxo3iotlmD lu i;()s2uoxopnydlpt  fvsl() 2rmurp;u4tle mictytfa emn s;u) etnmf3tytomtrlivi s0t2tr(mpoy4amenlnvta(f rua( pno0ope ifetldlmDuan s t0altrif oy1lmD  uvsls0 rxmxm oudlmee netatfsDrrur ot1aptomi3iyslsDrm( s u) exnxf oadoptraneo () euoxo3iodaptn fctlt  rrrxrpno1tex mf3ils s2uln s;u0 lxrircoa1lmteai o t0 2uo(mpno1llen net (f rrrxmpoo4oee mi3ilsfm2uauvsn(0tlenmf oatop eaneil(0t2urxmpio4lpeemfet () Dtrur oo0opxnmfctas s emu o () lxrmr3oo1lmDr i olt  rxmim3iy1ole livilsfartau o;o1opxnmictytla2rlnmpnt4 lxomocoatopD aivs s0s2uoxm3oy4ll   nvtl(  2uaxmo;u4oetoif3iltfs2em( s;t)altrxrcio1lpD au olt) exr(r3oy1alte nctat)a2rmur nu1aeeoifciyt a emu p (4 lxnxr3oytfat  u o;( t2tmirpno4lltnlivtls) rur(  ;o4oltn o3iytfa2eanmont)teeoxo ta1fpt lnei;t0 rur(o3ou1alee fei t a2ta( o;u4open ietad mDua(mont4artnxo3tydfp   uvil( srtmxr io1aptnlietl(fsDtmumpou0texn iciltls emu pn(0altrxr3iatla rliei;(0teumxr3oydomtnmies t srrmxrooo4teto o3iasfs2em(mo t4trtrmf iodoa r i olt  rurxm3oudom emicsa() 2ua(m no1apx mo3iytlm eluvs (4 leomrcty1omte ieo;t srumio3iy4om  mnct tf Dtmuro;o1texoiociyslsDemu p;t)aeeoxf3oatomt ai o;t) rxmir oudaltnmietat)s2tau poo4aleo o3tldls rmnmo;t)tetoir tytomt  u i (  rurxm io1lm e nvsls sDta( o;u1opxo feilsla2ea(msnu) rxrmrcoytfpDr n o;s0s2xrxo ny1opeeliviasf 2trurpot4aleoio3tytlm el(vp (4texoxf3tatfaDe ies t)srtoxm nudalenlivil() rur(r ot4opeoiiciadlsDrlnmsnu4aexoifcoy1lmD ai s;t0srumxr3oudomt  nvsl(fsDtmumo;o1teenio3iat a2el(vp;t0aeerxo3tytlatr i o t0 2xoir3iy1ap  lici t artaxront4optnmieilsls2rm( s ()tltnxf ootlaDe n sl() rtm(m ny4opt lnct s)arrmxmpou1alt  oetatlmDraumpn(4tetnmr3ia1fat aueslt setoxopoy4lleemfvsls s2rm(ront1optn feiasla2rmump u4altoxo iodfmtrlivs;t texr(m iudll n nvs sfa2ur(mo;o0aeenmf3tys aDuan s u)alxnxf3iatlaDr n s;t  rtmxo oy1op emfesltfaDtau  ;t1apxnio3ilt m el(vsnt4 etrmo3tytlpt ai o ( trtoio iodamte ici s)sDur(  ;t4tet  fctatlm2raumo u4altnxo3tydoaDe ivs s)setm(rpoudomen ivt s)s2rrxmp;u1aptnii3tld aDea( o;u0 ltrirciatlm raneslt) rtrxm3iydapenlfvsas)aDurur ;t0alxomieiys a rlu o (0teenxf3iytfpt lueilt)trumxo3nudale miet s)sDrrx pnu1opt  ietls a rm( p u)trtoxf3iatlp e uei ( t2urxr ou4ameemnciasf 2rmu ooo1aexo icildlaDeanvo u0trtoio oydop eai s;(  eurxm iydomt mfctls)arrrurp;u0tlt  o3ilt s2emuvpnu4alermrctatfatraneo t  exmir iydlmenmnviat sDrmu o;u1aleoio3iadlaDemuvsnt)aeerif3ia1op r ivo (0 2trir oudaltnlivta( srrrxr ;t0alt micils m rmumont) rtoxfcoy1lpt aies s0s2tmirpnu1ame lnvsl(  Dtrxr ot1oexnmoetadfm2rmn onu4 ltoxo oy1laD au il() etoxopoydap e icilsf rrr(m ;t1tee  i3iadfm uanmpnu4 eermocootoa   nvs t sexrio3no4ame livsa(  rtrur nu0tpx mfeilsfsDemu o;u4tleomo oy1oatelueils0 rtoirpnudlle liesas s2umxmooo1aetnmocilslaDrmu sn()tlxrmociotoa  livs s0 2ur(rpiudap   fcia() Dumxrpnt4tlt mfeiatfm ra( o;(4 eeoxr iydopDr ies t)trtrxmpoo4llee nvilt  Dua(r ;u4texnif3iysfaDulnvo;(0 lxnxr totfm raueil( seumio3nudlp  mncs s sDumx o;u1oetoiociytlmDum(mo t4treoxo3oo1lp  lu olt) rtmim oo1omt mivsl()artm( pot0tptoioeiysla emumo;t4 leomocty1lpD  n sls)seumiopio1aptelivs t aDrrxrpoo0ope  fetls a rauvpnt4tetnmf3tydomte uvo (  2xmim3nudlm nlnci s s2rmuroou1tpe mfeiysfa elnvp (4aeenxr oy1lmDrauei;s) 2xo(m nodap  micilsfa2ur(  no1aptn f3iys s2rmnvs t0trtomr3oa1lmtranvs s0teuoxr nu1omenlici (faDuaxrpoo1ale mocilslm2ranvs;u4arxnxr tydla   ieolt)s2xoxm3iu1lp  mivsat)srur( poo4oexoifetasfaDul( snt)tltoifcoydomD  iesls)s2to(m ou4am nmiesatf 2uau pnt4tlxo fcils s ulu ont) exomo iodlate u o;()srxoirpoy4ll  lies sf rtmxmp;u0texn octytls2uanvont4 rtrxr3iytlpDeaieol(  rto(m oudll emnctasfaDrrump;t4oex ioetldfs2eauvp u) eerir3totlp ran slt trtm(m3iy1alt  netas)aDtax pot0tlx  fctldfaDra(mp u0 exoirciy1om eaues;(0s2ur(m3oudam elivslsf rtmx pnu1olt mieilslm2emnmonu4 renmr tytfpt  nvo s srtoxr iydome  ies t) Drm( p;t0opx  octld aDrl(vpnu4trtnmocia1oa elnei s s2xoxm3nu1om nmivsat a2ua(moou4oexnifeiat s emnmp;u)alxnxfctatlptelivs;t0 2xrir io1lp e feslt)aDrrx  nt4tlx if3tld s2umnvo;()trtomr3iodla r nei s t2tmxo oydlmee net s arumum ou4texnifciatlm emu p (4artomf totfatraivo;(  etr(r nu4ole mfcsls arumxmonu1olx ii3ildlm2rm(monu0 ltoxr3iatfp eli sls0s2xr(m iydame  iei tfsDum( pot4ale ioeiasls2emnvp () rxoio3io1la e ieo;t)t2toio3ny1olte ivtlsf rumx o;u4aptniociys sDuln snu4texomf3oytopteanvols0t2uo(m3iu1oltemfvs s) Dtrump;u4tpxniociltlm2elu s u4alxoir3oodfa   iei (0t2urxo oudop elieta(  rtrx  ;o0oetoiociadfa2umnvsn(4tltoio iodoaDeanvo;s0s2uo(o io1op  livta(  Dta(m ;o1olxn oetldfm2emn o;u0aetoir3tydfaDeln o;s0srxoir3ou1lm   fetl( sDtmxr ot1tlenmfctytlm2rmu snt)trermr ootoa  aivi;(0tetoim oy1al   nvi ()srraxrpot0tlxomo3tad s eanmo () rxriocta1lm   nes s)t2ur(m oydlpenlfesls)s2uauroot4aetnmfetydlm2uanvp;u)trxrxr3to1omtranei ( t2tmim3ny4lleelict ()a2um( pnu0texnmoctat m2rmuvs t) eenmfcoytlpteaneslt0setr(rpoo1al  mivtl()s2rmx p;t4aee mfeils a em(von() lxnmr3iodlmtrauvs t0trxrxo nydop  mfcia(  Drmu o;t1olx  o3ilt sDuluvp (0aleoircoodfpDrauvo;t texoimpoodaptnlnvslt artmx ooo0opxnmfeiyt aDulnvs t4artnxfcio1lpDranesl( tetm(r3oudamtn ivs s) 2tm(rp;t4alenifctasfa2rm(msnu0 rxrxocia1op rln i s s2xr(m nudlpt lfvsasfsDrm(mooo0oeeomi3ilsla2elnmo;()tltnmr3oodfatrau o;s) exrio3nu1lp  lfet (f rumx  nu0tet  oeiad m2eaumo (0arxoifcoydlptr ues t  rtm(opnu1lpenlneia(  rta(mpou0ape  fciat a emump ()aetrxr totom ranvi;( srxr(mpnu1lp  lfetas) Dtrxmo;u0aetnifeiat a ra( sn(0alxnifcoodfp  lieil() 2uo(r3iodam  livs sfa2tmum ;o0olt moeilsfaDra( p;(0trenxf oatlmtelivo s  2umxm3oodlptnlivtl()srumumooo1teeoifctlsfs eanmpnu4tetnxo3to1faDran i (0trtr(o ny4op  mnct (f Dtmur ;t4texo fctldlm2ul( s (0 rxnif3oa1lpDr i o;t0srxoxopiu1ape livi t  Dtm(rooo1aetoii3iad s2uan s u0tlenxr oatlaD au ols srxmxrpoy1ol  livt s) 2tax  ;o1tpxomieias m2eln s;t)texnirciodla   n o s t2xm(m3oo4apt  ietat aDtmum ou1ape mf3iadls rau s u0artrmf3iodfmDe n i;t0 euoir3iy4opt lfeia(f rra(ront4aptoii3ilslm2uanmonu0 lxomf3oydoa eaivslt trtrxr3oudamt livtas) 2rr(mpoo1tle ifciasfs2eauvpnu)teerio3io1oateln o;( s2xmxr3nudlm nlnvtatfartrumpno4apen iciatfa2umums u) exrmr oodomDrlueil( srum(o3oudap  lnetlt  2umxront0alenmocils aDuluvo (4tlerxr iodomDeanes;t s2urxrpnodal n iei sfaDrm(mpnt4opx  i3iadfs ul( s;()trtoiocto1oa  auvilt) rtmxm3iydamtemncs (fs2umump;t0aptn ictyt a ua(mo u4aeenxr3iatfmtrlu sls)srtmxm3nudlptemieia(  2ta(ronu4apto feils s2ul(mp () leoifcta1lm eai i;(  2tm(opno1am e nesl(f 2trur nu4apenifctls sDrlu s;()tleoxocootfat  ivs;t srtmim3oydale lnct t)srtrxro;o1alxoio3iltlsDeluvpnt)alxoxfciodfmte uei t)sruoio3oo1aptnlfetas) Durxmont1olxn feilsfm2ulu pnt4artoif oatfat  ivsl()t2trxr ou1omenlivs t) rrr(rp;o4tlen f3tlsfmDemuvo;t)artnxfcto1oa raiei;(  eum(m iydam e feils) rtrxmpnu1alxnii3iad sDul(vp;(4 etoxo oodlp  auei ( setr(r3ny4olteliei t)a2umxrpno1aeenmfctad m umn pnu4tlenxociodlptrai ols truoxo iodll nlfeil( sDrm( p;u1oet  octlsls2rlnms;t0aeerio iadfptean o s  2uoxo ou1lpe  nvtas) rtm(mono1oltnmoeiltfa umump () rerxr3oytop  aues;s srxmio iy4llen icil( sDraump;u0oee mo3iydfm2ul(mpnu0 etnif3tadoaD anvs t0seto(rpiodapeemiei t a2rmxr ;u0tltoiieiyd s2ua( o;u0texnmr3tydlmte uei t0setrio iy1olenliesa() rtrxro;u1tpeniietyd mDrmnmp;(4 lxrmr ootfm   n s s0 eur(opiu4amtn fvtls)srumu onu0tpe  o3ilsfsDum(mp;u0tltoxfctodlpte n ols0 2tr(opnu4lmt  fei t aruaxr ;t0tpe  ieilslaDrlnmsnt0 eenircta1la raies;()setr(mpiu1llee iesls  2umur ot4olxoioctldlm2umn p;t0 ltrio oydlpDrlu ils)srxoxmpiudapt lieia()a2tm(ront4oet  oeiatfm ea(mp u)arxrio iy1latr uesls)t2xrir ny4omtnlfvsat)a2trum ;t0aex  o3iat s2emuvp u4 rxoir3ta1fate ivo;t) rurxo oo1ope mieils)s2tr( pnt4aetn i3tydls2emu snu) rermo tydomDelivo;t)s2umxr3ou1op elics s) 2rmump;o1alenmf3iytfmDumn s;() rxomo tytlm  livils) rtrxm3no1omtelivt tfa2urumont1texo fctadls2um(mpnu0 exoxrciadom eluvils0srtoxo ny1am nlnctat aDtr(m ou1oet mieiadlm2rmn snt)artnmf3oy1oat an il(  rur(o iodlmenlfetlsfsrtrxr ;u1apxoii3tad m el( on(0 eenxr oydomDeanei;t0s2trim3nu1ll e ies t)a2rmum ;u1olxn o3iat m2emu o;(4 eeoir ootfp  luvsls t2xoxopiu1olenmieil(  Drrurpno4oex  i3tat m2ra(vo ()aexomr3iodfp elu slt)s2um(o3oudom  lfeias)artru poo4texo ociyd a2emnvp;t)tlenmrciodfmt ai il() 2urim3no4om n icils sDtm(rp;t4optoifciyd a uluvpnu)trenxfcoydlpDe uvs;s)trxm(r no4om  lfcta( sDrm(rpou1teenif3tltfaDem(vo u)trtrmf3oydfmtranvslt)srumxo oo1ome  fcs tfarua(m ;u1olxomoeilsfa rluvo t) ltnmocoy1lpDrli s;()trxr(r io4ol   neilsf Dum(r no1aeeomieiys sDrmnvo u4tlenxoctadopDe ivs;t  etoimpio4ole lnctas)srraur nt4tlto oeiys s emnmo ()alenmr3oydlpDeauvi;t) rxo(rpnu1optemfei tfa2ta(mo;o4aee ioetasfm2umn snt)aexrxo3iodomDe iei;( srxr(mpny4aptnmfeslt)artaxmo;t4olx ioeiysfs uln snu4alxomr oy1fpteaieols)s2trxm3io4om nlivi (faDra( p;u1olt ifctldfsDeau s;t0arermrcio1oaDrlnvo;( tetrxr oo4ole mfcta()sDtmxrp;u1ape micilt s uau pn(0tltnmf iytlpD  nei t) rto(mpiodlmt mies ( s2uau o;o4opto fctasfm2elu p;u) rxnxr iodlpDe iei;t0seuoxr3iodll e ictltfarumu  ou4aleomocils aDul(mo;t4alenxr iodlp eln s t)setr(m nu4lme lnvsat)arua(  no1opx mfciyd a um( p u0aexrif oytop rlies;s trtmir3nu1op nmicia(fa2rmump;u4alx  o3iadfs2rauvo;u0aetrio3oodlp  anvil()srxoim3nu1amee fcsl( a2um(ro;o0alx mi3iatfaDumumo t) rerio3oa1lmte ies;(0 rxoxr3io4alte nesltfaDtaxmpou1oex mo3tyd a2umump u4alxnmfcoodlp ran sl( tetmirpoudopenlfcs sf Dur(rp;u4tpt mi3tydfm2uaumon()tetrio3oa1fate i il(  2uo(r no1optnlfci (f rrru  ;u4alt  f3tydfm2elnmo t)artnmo oadfm   ues;( trtmir3iy1ol nmivias)artrump;o0aex  oeiytfs2uanmsn(4aetnxrcoadlm eai s () rurim nodam e ieilt a2raump;t4tptomo3iasfa ean s;u0tetrxfciatfmtr uvi;t)teum(r ny4altnmfes ()a2rrum ot4tptnmieiasfm2rl( o;() etnir3tadop r ueil()setm(rpnydaltnmivtat a2raum nt1oee mfciadls2uluvo;t)texnif oytfpD auvs;(  rto(r3no4omen ies s) Dra(r no1ope  octaslm2um(ms;t)trenioctytlpt au il(0setm(r ou1amt  fetls srrmuroou4oee mictadfs2elnmo;() ltnif3tadla rau i;t  rurxrpiudlme  ieiatfs2rmu  nu0apxnmicild s eau on(4tltrxfcia1opDeaivs (0 eumxopiy4am e ics tfsDtmu oou0tptomietyt s eln on()trtnio oodfmDrluvslt)tetr(m3oo1amen fcil(  2umum nu4aptoiiciytlaDeanmo u0 rermoctadfmtr n sl()truo(m ou4altnlieilt)a2rau  nt4apen fctydlaDrlnvpnu) rermf tytoaDe iei;()teurirpny1am elieta(fsDumuro;t1tet ioetyt s2uan s;()alerio3oy1faD ln i;t  rxmxm ou1lpeelfvils arrmxm ot0apto f3tysfaDuanms;u4tlxnxr3io1omtran ols  2xo(o oy4apenlivtl()arraum oo1tleoiociytfmDemuvp t4tlxrmf3tatfatrlnvo (  2ur(r3iy1lmtemicias srrrump;u0open ocias s rlnmo u0trtnmf oatopDrlieolt) 2trir3no4om  livtas)aDuau o;o0apt  oeilsfaDumnmp;u)aexoxociodlm elnei s0t2xoiopio1om nmivi s) 2tmurpnu0oetoiiciys sDul(vpnu0tlxrmo3io1omt  ivo s) ruoxm io1ame mivta( artmxrpou4oexoifeild sDrauvsnu4tlxoiocoy1lmtelues;s)texrir3oydlltelieilt srur(rp;u4oet  fctat m rluvs u0trxnmrcoa1lm eanvo ()srtmiopiy1apenmnvs ()srtru onu1tptn oetatfs rlu s u)aexoio ia1fat aivi;(0t2xo(o oudlm nliei sfsrrrumooo1tle ioctldls2rau p t4 renmo3tadfm  luvs t) 2trxm iudlp   fvils aDtrxm ot4opx iieiad a elumpnu0tltrxr3oytomtr nvol( trxoiopoy1llenlfetasfsDumur ot0aexomicildlsDrl( o t0trtrif3tatopD lueo t)srtoxm3ou1ape micsasf rtax  ;u1tlt if3iytla2rmu o;u4 lxomo oydfmD lies t s2umim io4ope mfcia( sDuaxmpou4opxomoctlslaDulums;(0 rtoio3totlmD auei;t  rxrimpnudapen neiasf 2uru pnt0alenio3ias a uanvp;t0tlenmrcto1fm eluvi;() 2xrir io4op n ivi t)s2rauroou1tptn o3iytlaDel(mo u0arerxo io1lmD li il()tetrirpiy1ol elfvslt) 2umxmpou0opt  feilsla2uau o t0 etoxf ty1faDrlnvi;() 2trxmpio4am n ivt s s2uaxmpnu1tex  i3iysla rm(vsnt4tlenxfctodfa rlueo;(0 2uo(opio4alt mnct (fa2um(  ou1oetn o3ildfmDrmnvsnu4tetrxo3oadfa eauvs;()trtrxopoydlptelneilsfarumxmoot0opx if3tys s2rl( s u0aeerio tadlpDr ues ()t2trim3no4am eliesl(fsDum(m oo0open iciaslsDelnvp t0trxoifciadfmtelnes t)trxr(rpoo1lltn iesasfsDrmum nu0oet mociytls el( p;(0trtomf oa1fpDeln i (0 exmimpoo4olenlneil(faDtmurono4tee mf3iltla2ra(ms;t4texnmo ia1lmDe neo t0 etmxopno4lm n fes t)sDtmx pnt4apeoii3tlsfsDrmn ont)tlxomo3to1fp  aivi;()t2trxr nu4open netlsfa2rrum nu4opto ieiysfsDelumpn(4arxnirciydomte ues;s0trxmir io4ap  lneia( sDurx o;u4tltoiieildfmDuan s u0tetoiocoodla   nvs s) eur(m ny4lle miei ( sDur(mpou1opxoif3tadfs2um(vo t0texnio3tadfa rlnvsls trxo(o3nudllen nesl(fa2tr(m ;u4oexo f3tatfm umuvo (0artomf oy1oaD lnei;s  rum(r3iy1ape mnviat aruax p;t0ape ioctlsls emnvp;t) reoircootlpDr i i;()texoiopoudlleelfcsl(  2tmx  ;t4texnio3iyd a eauvs u0tetoxr3todlpte uei t)s2um(m3iu1lmen icsa(fa2tmumpnt0tltnifetltla emumo;t0alerirciadoa eaies ()t2umirpno1aptelictat  2umu pno0apeoiictysfm rmumsnt)tetnxrcoo1lmDeaneslt trurxr iy1om nmict ()s2raxmo;o4opxomoctls m2eanms;()texnxo totfp rlueslt0 rtrxm3oo4omenlnvtat)aDtaumpot1tle mo3ildlm2rmuvs;t0 lxrir ootfaD ln ils)t2xoio3oo4olt lieilt) Duauro;u0texo o3ilt sDumu pnt)alxnmrcoo1fm e n s;t texo(m3nudlpe mfciat)s2ur(r oo1texoiietys sDelnmpnu)teerxo iatla  liei ()trxo(o3iudal  livtlt)a2tr( o;o4oeeniiciys a2rl(mp u4trtnxocoo1lmDean i t tetmxr iodale mnvtlt  2tr(r oo0tpto octysls2emn pnu)teerif3ty1fmtraiesls0t2xmxr nydlmen nesat) rtmxmpoo0oeen oetas m2ua( pnu)tetomo oodfaDeaivilt sexrxopoy1ll emfvtat)srtrumoou1tle  f3tltlm rmnmo ()trxomr3todlate u i (0 2tr(r ou4apt lnvsas  2rmu  ;t1tex mfeilsfs2rau snu0treniocta1fptr ivi;s0t2tmxm3oy4lmenmivt sfsDrr( pnu4texomfciadla uaump (4trerxo totfp eaueil(0trtmxo iu1amtnlfcslsfsDrm( pou0alenifctaslmDeluvpnu)altnifciy1lpDeaivsl( sruo(o nu1llt mivt s) Drruro;t4oltnmiciyslm eanmonu4altoifcoadomD an ils) rurxm iu1lmenmiesa(  Dta(  no1olxnii3iatlaDra(vp;u4teerio3ia1late u i t) 2toim3iudll n iei tf Duaxrp;u1tlto i3ildfmDrmuvsnt) etoxo3tadlaD an o;s0s2to(r3nodoltemnvt sf rtrump;t4oeeoifctytfaDea( on(4aexrxf3oodfmDeln slt0 etm(o3oo1amtemfesa(f Dtrxmont4aleo ictat aDemums t)arerir3oydoaD livols t2ur(opnodalt  ivtls)arumu  ot4tle mi3iadfm ul( sn(0teenir todlaD au o;()seur(o ny4apt  netat  2rr(ro;t0aeto fetltfm2eln p;(0aetoxo oadlptrlu s;(  etm(m3no1lm  lneiat)aDuauro;u4oleoiictlsls2uanvo;u)tlerxrcoa1lmt  i i (0 2xoiopio4lm  mfetasfs2ur(r nt1apt  icildla2ranmsnu0texrxf tatlmt aivo s0tetrirpiu1aptemfetls sDrr(mono0alx  octytlaDuluvs (4trtrmr3iatlmDe i o ( s2xmxo oodlp  mivi tfarrrxm ;o4oex if3tltlsDeaums t4arxrxr3oadoa  anvo s s2uriopnodllt  fvsa()sDtr(r oo0aptnifcils s2em(mpnu) rtomoctotom   n o;t)teumirpno1omt lfvsasf 2rmxmont1oet ifeils m2em(vo t0arerxf oatla eau sls) euoiopoodopenmfvtlt  rtaxmo;t4oex mfetyt m2ul(vp u0 rtoxociadlmDr iei ()s2tr(mpiu4lpenmncil()artmxmo;o1oltomfciltfm2um(vp u0areoio tydla r n s t)tetmxm3oy1optn nci t srra(  ;t0texn i3ilsfmDrl(ms (4artomfciatfa   nei;s  rurirpoy4altnlneiltfs2raxrooo1opeo ietltls raums u0artnxfcto1lmDeaueo;(  rtrxm iu1al  mncslsfsrumx  ot1apxoiiciysls2el(mo u0alenmo ootoa  auesl( t2xrim3nudamee fei (  2tm(mpnt4tlx mfeiat s emnmp u0teerif iotoatr n o;s trtrxo iu1ap n ieias  rua(  ;o0aeeniiciadls2uaumo;t0tetnxrcootlaD  n il()tetmxr3iudaltelnvta( sDrmu o;t0apx moetld s uaump u0trerxr3iytoaD  n o;t) 2uoxm io1altelietl(  2umxmooo0tpxnifcilsfaDrm( ont) etrircoodla r uvs;s0 2xo(opiy4lpen fctl()arrmu  ;t1aet  f3tyslaDem(mont) leoxf3tatop ran o ( sexrir3ou4alenlicsa(  2rru o;t1oeto o3tasfaDumums (4 rtoircootfm rln s s s2umim ou1ll  lfvias srtaumo;t1tlxo oeiydlmDul( o;(4 rxrmo3iytlmt  uvols0 rurxrpou1ame lncsat sruax  nu4texomiciltfa el( snu0trxomfctydomt  ues;t0s2xm(r3oy4om elietl( srururpno1tpenmoeilsfmDra(msn() rerxf ta1fmtr uvilt0 2uo(o3oo4ameemiesatf Dtau  ;t1opx ii3iys m2emn s;u4aexnio iytlmtr ieo;t  rumxo no4lm nmnvils)srtau o;o0texnmiciaslmDem( s;t0 rxrxf3oo1fatelies s)s2tr(mpny1lltnlfesas) rumu pnt0tpx  icils s uan o;u4trtrmr3tatlpDraiei;t) etmxo oo4opt  fei t) ruaxmp;t0olx ifciytfa2eaumo (4aexrif iatlmDraivo t srum(m oo1lmt lics s)aDtaum no1opto oetlsla em(vpn(0aleomf3ty1lm eaivol()sexrxr ny4oleelfvil(faDraxr nu0olxn octatfa2umnvp u)areomr3iodlpDeaies;s)tetrir3nodlpe lnvsa( sDta(mpno4texn icilt s ea(ms;u4 leomf oydomD lu s;s0s2umxm3no1amtnmict () rtaxr nu4tex mf3iys a2umn s;u0tetnmf oydlpDrlivs;t) rum(m iydll e iet ()arrmu oou4tpx io3iadlsDraums (4 rtnxfcto1faDe ivils s2toiopoydole  ncsa(  Drax  ;t4tetnmfciad s2ranvp;(0altrmr oodopD lnvs;s) rur(o oo4llenlnvi sfs2rr( pnt1aet mieiaslaDuanmo t4trermfcoo1oaD  n s s)setrirpnodop emnet () rtm(ronu1aee  iciltlm2el(vsnt0trerir oodom eaies;t0 2tm(mpnu4omtelfcslsfsDtm(rp;u1tpx moeiltfsDuauvo u0teerirciodfp r n s s)srtrxr3ou1amtnmfcsl(fsrrm(r ot0aeto icils s2rlu o;u4tltoxo3iatfmt lu o ()t2xm(mpny4ameemicsls s2ua( pot1alenmfciadlm2um( o;()teenxfcoydomtelueo s)texo(o3iudopte nci ()sDtmurp;o1texoiieilslm emuvpnu)altnif tadoatrli o;( sexmir3nu4lle  nvslt srraxmo;o1oleomieils m elu o u0altrif oy1fptraneo s)srumim ou1lleelncsl()sDuau  ou1opx ifeiatls2ul(mont4 lxrir3tydfpDrai o;s  eurim3oydlpt  fvs tf Dtr(mpoo0ale  octldls uanmp (4 eeoir3ia1lp r ieo (0t2uo(r3oodamenlnctls a2raur ;t4oexn ieildls uluvs;() leoxo oo1oa e ieo;s)t2ur(m3ny1olenmicias)s2trxr ;t0tle io3ilsls rmn p t4tleomrctatlp ran olt)sruo(o iydapte nvsa() Drm( o;t4tlx mf3tyt a2eanms;u)aexnmf to1oa rau s;t srxmirpnodap n fctat)s2urx  nu4alxo ociydfa2eau s t0artrioctytlm eanvolt0trtmxm oy4alt mnct ( aDtm(  ot4opxomi3iyslm2emnms (4 eenmo oo1lmt  n o s0trtoxm3nydap n fvs s) rrmx pnt0tpt mf3ilsla2ea(ms ()trtrmr oa1fp   i s;t trtm(m oy4lp nlivs sf 2tauronu4aex mfeilsla2em(mp t) etoio3oatoaD  iei (0seurir oodap nlictas) 2rrx poo4oltn ictltla2ran pnu)aeenifciatoaDr ueo t0t2toxm iy4oltn icilsfa2trxmont4tex ioetysfm ul(mont4altrir3ty1lmDelnvols) etrirpiu4lme mnci t  ruru poo0aex ioeildfmDran sn() rermo3iytom e uesl( s2trxopnodam  lfci () Dumump;u4apxo ieildlm ea(mo () lenxo ootlpD luvi;() 2toim3iy4lmtelics t) 2ta(  ou1aetoif3tyslmDrm(vpnt)texrmf ty1lat ai i (0 2trxmpny1ope lfcta() rrmxmo;t1alenmf3tls mDumnmp;u4artoxf3ia1om eanvs;t)trxoim3iudal  mnvtlsfs2rm( pno0aexoifeiydla em(vp;t4areoxf iodomtrlieo () exmir io4lpt liesat  Dumxm nu1ale ifeiltfs2elumsn(4alxrio3ty1faDrlu s;t0t2xr(o3io1al  mfetlt sDraum ou1opxoiietydlmDrlu s;t0 rermf iadla  luei;s)s2tm(m3ny4lmen ict ( a2urx pou4olxn oeiysfaDrm(vs t)tlxnmf iotop ranvi s)texm(o oy4ap nlnetls)sruru p;t1tpto f3iaslm2um(vo (0 reoir io1faDeaieils  eur(r3nodame mieslt  Drr(monu1aeenifciltfm2em(mont0trerif3tytlatrai s;s0srxr(o3oy4al emnvsl(fa2rmxmp;t1apeoif3iltla ua(von()alxoxr3tatfa elieilt0teuoxr oudlmeemivtas srta( pou0tlxnmfeiltfs2ua( sn()aetrxrcoa1lmt luvsls0 ruriopny1ole  fesas)srrm(r no1tpt mfeiasls umnms (4trtnxr oodla eanvilt)sruoxo3iu4oltnlnetl(fsrraxrpno4altoifciys s2ul(mo;u4 lxoio3todoat  i s;s t2ur(mpnydap  liciasf 2tmxro;t1alx ifeias a2uanvs u0tleoio3iy1lp  lneo ( teumiopiudomtelicilt  Duru ono0teenii3iadla rmuvsn(0teeniocoodomD au ol(0t2uoimpoy4amte nvslt) rtaxm no4aeto i3tatlmDua( o;u0teenmociatom raueo ()s2xriopnodop n neils) 2ra(mont4olx ioeiysfm umu s (0treomf3tytfpDeaneolt) exr(m no4altelnesl()aDrmxrooo4aeto feildfs2ulnvsnu0arerxf oa1lptrluvol(0 2ur(r3nu4omee nci s) Dtau poo0aptnmoctysla ra(vp t)tlxrioctotlm eli s () rxmxrpiodolenlncias aDuau ooo4tlxomfctat s2ua( o;(0arermf3iotomt  neo (  etr(o ny1opt  feil() rra(rpnu4aeeomfciytfa2uln snt)alenxf iadomDeli s;(  eumxr3iu4op e fvslt)srtaxr ;u4tpe  feiytfsDulnms;(0 reoxo3tytlat ai i;s) rurir oudome lnvsa( s2rm(  ou4alxomiciatfa umump u4 exrir3ty1fat auvi;s)t2xrxm iudlmeelfes ()sDtaxront4oltnif3ilsla2umn sn()aleoxrciadlp   neolt0 exmxmpnudoptnmnes t) Dumxmpnu4aeeoioctas a2rmuvo;(0trxomo todfpteliei;t)teumir ou1apte nesat)artr(r oo1olxo fcilt aDuaums;u4aetrxocoodoaD auvolt) 2uoimpio1lmenmfct (fsrumxm oo1oetnio3tls a rlu o;(0tetrmrcoa1lmDeau ils0 2xoir iy4ol  livtasf rumumpno0ale  o3iytlmDeanmonu)tltnxf3iytlmDraueo;t)srtrxr3oo4om   ivtlsfsDtaxm nt1optnmfetatla2rlnms;u)alxrif ia1lm  aivilt0trurxrpny1ame lfvi ()srua(  nt1tpeoiociatlm2rm( ont4teermociotfa e nvo;s)s2umxo ny4aleemncil(f 2ur(r ;u0tetnmietyd aDrlnmo;u4texomrctatlptr uvo s0sruoxopoy1amen ici ( a2umx onu0tpe  fciyt mDranmon(4trxrif tytlmtr n ils  rtm(mpoodlltn neta()aDumurooo4tle io3ils a uaums;(0arxoif totfmtrauvo;(0s2urio3nydaltelfviat)s2umumpoo1apt mocilslaDuanvsnu0tetrmr iotlmt anvo;t)t2xmxm3nydopeelfeiltf rurxm ;t0alto feiyd m2rm(vpn(0trtoxr tatlm r u i ()trxmir3oo1lptn ncias aDumumont0apxnifctyt m2eanvp (4artnif3iotlm r ieo t s2xrim3io1lmtnmivi s) rtr(  nt0alxn o3iytfmDea( onu)teeoxfcoadlmDranes;( s2xrimpiu1apeelfctls)a2taxm nu1aptn o3iytfm uau o;t)aetrmoctatfatrai olt) rto(m3nydolenmnet s  Dtmxmonu4oeen ietadlm2umuvs t) ltoif3oo1fpt  ivi s)s2umimpny1alenlietat)srtr( o;o1texn oetyslsDrlnvs t)aexrmo tadfm e uvo;s)t2tm(r no4alt  fvsatfsrur( p;t0tex  fctldfm2uan o u4arxnxf ia1lptean ols)t2toio iodoptelfvtl()a2urumo;o1tlenio3ilsla rlnmpn(0trxrmr iy1optranvi;()t2um(opiydop elncilt a2ta( p;t0teen o3iydlaDeanmp;(0 eenmf to1opt  iei;( t2tm(r3nydaptn nvt t srtr(  no4altnmo3tat s2uluvp;()alerir tadlmte ues t0 rtrim iodlmee nei t sDraxmpot1aetomociys m2ran s t0tleoif3iy1optr i slt0 rxoir nydomen ivsasfa2rmumo;u0alxn ociydlmDumnmpnu4trtoio3oodfa   uvo s)s2tr(m3iy1aleemnvsat a2ta(m no4apen o3tydlm uau p;(4treoxo3oa1la   n sl()s2tmio ny1al emfcil()s2rau  ;o0apt  octld mDulums;u)trxomo3oodlpDe ivi t t2toim oy1am n fei ( sruauroou4tee  ociyslmDelump (0aetoif oy1omDelies;t) 2xrio oo4olenmncils  Drmumo;t0oee mieiydls emnmo;t0 eerif3oa1omDe nei;s seto(rpou4amte fcslt  rta(rp;t4oet  f3tltfsDuln o (4 exomf oy1lmDe nvi t0t2tm(rpio1al nmncsls sDuaxm nt4tetomfciytfa2rau p;(4altoif oytlpDr nvs t0t2to(o3nudame  fcil(faruru p;u4aetnmi3ils s rln s u)alenxr ty1la eluvi;()t2toxm3nu4ol elfcta(fa2ur( pnt1opxoifetltfa2uauvo u0trxrif ta1lm raues t)setoir nodomenmnciasf Dua(rpot1aetnmf3tatfm2el(vp;t)altrmf3tytopDrli i ( trtoirpio4lmeelfctl( a2ur(monu4ape mfeiat s2rmumsnt0 lxnmr3oy1fm e i il( teto(o3oo1lmt  ivsls)a2urxm ot4tpxnif3tldfs rau s;u) leoif oy1omD  ueo ()trur(m3io1omen fesat) rraxmp;u4openif3ilt mDel(mp t0 leomo tydfaDe ueil( t2uoir nu1apt lnvtatfs2trxr nt1altoioeias s2rlumo;t0arxrmf oytfa   nvo;s)texoxm iu1omt  nvt () 2urxmp;o4olx mociyd sDum(mp;(0alxoio oytlpt li o;t srxmxm nodope  fviltfsDtmu o;o4aeto fciyt m2rmn ont0tlxoirctatoa   u i;t)teuoxopny1lp emfct sfsDrru pou4ape io3ilsfs rauvsnu)aeeoir iatfaDeli slt0texmxrpoy4opt lieil() rrr(moot0tlto ieildla2um( pnu0alenxo io1lptr ueo t)srxrxr3oo1olenmfet ( a2trxroou4apxoifeiltfs2rlumo t4artoxrcio1fmD  ivo s) 2um(m nydop elnctat)s2rmx pnt1olxomietadls2ean s;u)trtoxrcto1fa eaivolt seuoir3oudlptemnct s)a2rrx  nu1tpenmfciydfsDulnvo;(4artoio ootlm  an s;s) 2tr(m3oy4am elivia( aDrau  ;u0tpxnmfctldls2umumsn(4arxoxf3oodop rlieil( trurirpio1lp nliviltf 2ua(m ;o4tlxnmictat aDemnmo;t0aexrxociadop  lneolt0srxr(rpiy1optn ivilt)aDtaxmont1apx io3iyd mDrlumpnu0 rxoxrctydfaDr n o;(0srxrir io1om nlnvi (f 2uaum nu1aetoifciyd mDrlu p;t) rxrif oo1opt  nvolt0 etmxr3iydlp elics tfaDuaum nu0tpen icilslsDul( s t)texnxo io1faD  ueo s) etr(mpiu1op  lfetas srurxrono1tetnmieiadla ra( p;u)arxomoctydlaD lnesl( t2xoxo oudamtn iesl(f Dtm(r no1tpe  i3ild m2ulnvpnt4aexnio3tytfp  aueo ( tetoiopoy1am nlfcs sf rtax pnu4olenii3iysfa rmnms;() etoxo totlmD lneslt0 etm(o io1al elnci s artax  nu4teeniietytlmDua(vo;t) etnif iytfpD aivo ( seurxr io4op nlnes ()sDua(moou1aexnmieiadfaDrlumo u4texomo3to1opD  u o;s)seumirpno1omt  ietl( s2ra(rpoo4apenmoetadfsDea( o t4 etrif iadom   ueo t)sexo(rpnu4am e iei tfsDua(m ou1alenifciasls2eau o ()tetomr3iytlaD  neo s0srtoxrpnodoltnlnesatfartr(r ;o0oltn octadls umump;t4tltomoctadfmt aieo;() rxmxo3oo4omtnmfei ( s2tm(m ou1aeeoifciltfaDelump u4tetomf3tytoptelivs (0trxo(mpiydlmeemfeslt)sDumur nu1opeomo3tadla2elnmo;(0tlxnmr3iydfa rluvs (0t2tr(opnodlleelnes ()s2rrurpoo4aet mf3tyd a el(mp;t0 rxoxr iytomDr uvs (0trurio iy1amtn nctatfs2uaumpoo4aetn fetlsfm2eau p;t)aexrxociotoptr i o s)srxoxo3nu4apenmivsatfarrmxmo;o0texoifciatlsDrlu pnu0areoif iotlmD auvslt  2uoir no1al nmnei (  Dumurpnt1alxo fcias aDrm(vsnt) rtnxociodfpDeaies t s2trxm oydllte ict (  rtrur ot1oeeoii3ildlm2emumo u4aexoxo tatfat  ivsls) rtrio3iy4lmtemfct ( artaxrpoo0oee miciydfa ra(mpnu4aeenxr3iadfmDeanes t)srumxr io1ope mfcs (  Duau o;u0aet mf3iytfm2umnvs ()aexoiocoa1lm rliei;t)trxm(o ou4omtnmieia( aDuaxr ;o0aleniictatfm ran o u4tlerxr to1fat lues t  rxr(r nu1apt licsa() rtr( p;u0tpen i3ilt aDeau p;u0areoxf3tatomt auvs (  rtmirpnu4lme mnes sfarta(mont4tlt  f3iadls rlnvpn()trtnio iytopt li i s)seuoxm3ny1lp e netltfartau  ot0ope  o3iytla uluvs u)trxoifcoydlm   uvslt s2umimpnu1am  lncia()a2tmxrpot1teto i3ils aDumu snu4 etoxoctydoateliei;t)seto(r3nudop e fvi ( s2taxr oo0aleoifciysls rauvp;t) exnxf tydfpDelu i;s) 2tmxo io4ap nlies s) 2umxmono4ape mfeiyt s ra(vsnt)altnif to1lmD livi s) 2xmxm iu4omenlfcs t) Dra(m no0opxo i3iytfaDeanmp t) ltoir3todfp rluvi ( s2xoxo io1altn nes (faDumu onu4aptnio3tlslmDemnmpnu0 rtniociydfmteauvo;s0s2tmxo iodlle mfet s a2ra(rono0optoifcilsla rmnmp t0arenxrcoy1lm   n slt0s2uo(mpny1ap nlfes sfs2trx pno4opeomicias aDemn snt4 ltoxrctytoa   n o;t)tetrir3oy1ll emnvsltfsDtmump;t4tptnmociaslaDul( pnt4 eermo oytlptraieo;t)srtm(m3oydamee ivt s  Draur ou0ole mociad s um(mo;() leoiociydfmtrli o;( s2xmxmpiydopt lnvia()arrrxmoou1tptomi3ilt s2rauvsnt0 rtrir tadfp elnvi;s0 2um(opnudalt  ies t arraur ;u0oexn fctad m2um(ms t4arerxo3oa1laD li s s s2xr(m oydlmen fvia( aDtaur ;o4texniietysfa2eluvonu0texrmocoadfmtrln ilt0sexmim3iudlp emfvsls s2ur(mp;o4alt ii3iasfmDelums u0tltnmf3iydop eaivilt) rumio3oo4opte fvt t  Dur(r ot0opxo o3iadfmDulu s;(0tetrir3oy1oa rlu o t  2tmir3no4lltnmnvt t aDtrum nt4aexoiiciatfs2umnvpn(0tlxnxfciotom e i i;(0s2umimpoo1altn ieia()s2rmx p;t1opx mfciad a ua( o;(4texrmo3iodomDelu i;s)srxrxmpiy4lp elnesls sDraxmo;t4texnmo3ildfm rau p;t4texoxfcoytoa elnvi;t)trxoim ny1lmtelfci t)a2umx o;o4tle mo3tatfaDem( o t0arermfcoa1lm eai s t)srxoimpnu1llenmfesa(  Dur( poo4oex ifciysfsDelumpnu0 ltoirciatfpDeaieols)s2umxr3ou1om nmnes sfaDumum ;t0olt mietadlm ea( s t4teenmr3iadlaD  nes ( tetmio nu1ol nmnciat  rrauro;u1aee mi3tas a2uan sn()artrio3ia1lmt an olt0 2xm(m ou1ll n ncsl() 2tauro;t4tpto ociltfs uanvsnu)trenmo3ta1op ran s;t)t2xmir ou4ll e ivia()sDuaumoot1altn feildfa2uanmo;(0texoxo io1fateai i t0t2umir nudamen fvi tfs2rmx poo4oetomf3iydfs2elu pn(0tlxnmocta1optelu i t tetoirpiydlpt  iei s) Dua(m no4oexoifeilt sDumu p t0aleoxrctodfpDraneolt teumxm3no4al nlnes t)aDrmu pno0tleomoeiat s um(mo () leomrciydfm raiei;s) rxm(o3iu1ame  nesls arta(  ot1alt iictyslm rlnmont4tlenxr oy1opDrlivs ()trurxrpio1om emfcsas) Duaxro;o4oex ioeiytfa2emnvo;(4 renmo3ty1omt  nvo t0s2xr(r3oo1oltn fet (fsrua(rpou1oet iietyd m2ean o;(0trerio iodomt  ueslt0srurim ou1lpt lfeia() rurumont0tpt  icildfs2emnvo t0texomf iydom rluvilt s2ur(opio1llenmivilsfarurxmonu1tetnmoeiytfm2rmnmp;u0teermr ta1omDr ivs;s) rxoxr3oy1lleelnetlt) rurxr ou0aeto oetysla umnvo;u)aetoxo3iytfmD  i s t tetm(o ny1omeemfvtas  rrr(m ;o4apt  octyt a2rlumpnu0 ltrio3iodomD  u o;t texo(m3no4lp emnetl()s2urxmpot1apxniieiasla2rl( snt)aetoio tydomteaneo;(  etoxo3no1lmenlivt s artru o;o1tex mfeiltfsDraums;(4 lermf oadlmDeluvs s  exrxm3ny4altnlfetl()artrxmpnt0tltnif3tadfaDumn onu4arxniociadfm e ivi;t0 exr(o3oo1omtnlneslt) 2rmxmpoo0apxoiiciadfaDelnmpn(0tlerio3tytlp rauvi;s) etr(o oo1op e fcsat arum(mo;t0texomo3ildls2ulumpnu0artnmfcio1fp rli s ( texr(o3no1amenmnci s a2tm(ro;o1olxnioeiaslaDulu on()arerir3oodom e uesl(0t2trio oy4ll   ncta()sDrmum ou0oex mf3ias mDel(vo;(0 rtrif3totomteauvols0truoim3oo1lmt livt t s2ra( pno4teto o3iyt mDumuvont0artniocoodfa ean ols  rxrxm3io1omee icsas)srrr(mo;t0aetnmf3tyslm em( p;()texoxfcoadfmtrli s s0sruriopoo4ll elnesat a2tmxm ou0ope mi3iytfm2umn pnu4trxoxoctotoat  n o;s0seurxopoo1omt lici t  2rmxronu0olt  ociyt a2raumo;u)arxnmoctotlm r neo;( s2tmim3iu1ale liesls) 2rmx p;o4ape  f3iysfs uanvp u4trxrmo iydom eaneo;t trtoimpou4oleelict sf 2tmxmpnu4oetomfcilslm em(vp;u4trenxfcootlm   ueo s)t2uoim3nydam nlietas a2uru  ot0tpeoif3ild m emumo;u) exnmocoy1fm rluvi t  2xoxmpiy4ol e fviatfs2tru  ;u0aptn oeiyslmDumnvo (0 eeomocia1op   uvi () rxmirpoodlptemfeiatf 2trx o;t1opto i3iyslsDua(msnt4 rxrmf io1oatelueilt0s2umimpiydlptelictlsf 2uaxmpoo0oex ifeiytfa ea(ms t4alenmrcoydfptranvi;s0 rxo(o3iodlpenmfvs (f 2umu ooo0tet  f3tys mDelumsnt0trxoir3oy1la   iei ()srtoir no1lp  lnvs (  Draum ;o1alenmieiyd s2ul(vs u4aeeomrctotfa ran s;s) etm(r3no4om nmncta(farrrx  ;t4aeenmoeiltfa ranmsn(0arxrxrctatfatean s () 2urim3io1altnmfesls srta(mont1apxo fctydfmDra( on()alerif ty1lpDr nvi;(0trtrxr3no1ope  ncil(farur(mpnu0olt iiciatfsDulums;t) eeoif iadomDeai i t seto(m oydom emivtlt)srrmu pnt0opeo octysfaDra(vs;()tltrmo oo1oaDeluvi;(0teum(r nydlltnlivsa(fs2umx pnt0ole mi3iadfm emuvp t) exrxr3iadoat auei s0 2umxo ny1lm emncs s) Dtaurp;t4aleo icias m emnmo;() lxnxo3oatlmtr u ols)setoirpnudoptemivslsfa2tr(root0tet  o3ilt mDuan on(4 exnifciatoaD  u o;(  rurir3ny1omt mivsl( srrrxm ou1alenmoctadfmDrmn ont0texnmocty1laDr ivs;s0s2trxrpoo1lmt mivs s srtmum ou0tex mi3iyslaDuaumsn() lenir io1oate uvo s s2tmirpiy4op e iet (faDrr(mont1aexnioeiltls ranvs u0 lenir iatopteau s s)seum(mpiy4opt lfctls  Dtr(r ot4aet miciysfaDean o;u0artoxr3todfp elu o;t) 2tmxo no1al elfes (fa2trxro;o0oeenmoctadlaDrmu p;u4tltnir ootlpDraivo s  2uo(opiy4alt lnei t a2trxmoot1opto ociatla2ra(mp (0 eerirciy1oat ln ils0t2xoxr3oo4amt  ivilt  Durx  oo1oeeo fetyd s umnmo;()aetrxrctodlptelneils0 2urxr oudolt  ncsls sDrm(ronu0tlxoif3tlsfa2el( onu4alxnxo3io1lmD aneolt0teuoxm no4omeemicsl()aDur(mo;t0oexnmicils a uanmp;(4areoircoytopteli ils t2ur(m iy4lltemnvilt)s2umumo;t4aeen i3tls s2ulnvp;u0aeerxo3iytlmD  n o;() 2xrxm iy1op e fctas)aDuau  no4optnioeiys a2ulnmsn()alxoifctatop elu ils)seum(rpno1llee nvi tf rra(monu1tltomfctatfmDel( snu)aexnmrcoadfaDeaieo;( t2tmxopio4oltnmneia(farrm( p;u0oetnii3iadfa2uluvp;t0trtomf3ta1faDrlu s s)trurxmpoy1altnmncsa()artrxm nt4alx ii3iatfmDeanvo t4 rtriocio1oa e i s;t0texm(o oodapt  ncil(  2rr(mpnu4aeenio3iytls2em(ms;(0altnmf3oy1fmDraiei (0srtrxr oy1omt  fvtls  rrm(mo;t1tltomfctysfsDel(vo (4alxrxo ty1fpD livi;t tetm(mpiu1altelfet s artrum ;u0apx  f3iatla2umnms;t)tetrxfcta1latr nvs;s)t2tm(o3iu4ome mnet sf 2taxrp;u0tptnifeilt s umnvp t4tltriociytfatr ivi;()trxrxrpiy4ape lncil(f 2ra(mooo0tex mi3ils s2eaump;u4 etnmfcto1lat  ueols)t2urim3oydaltelnvtl(f Dumxrpot1tpe iociltlaDemuvp u) etrmocta1omte u i s) rxmim3oy1lptn nvilsfsrum( pnt4tee  feilslm2ea( snu0 lxomf ty1fatr ivi () ruoimpnodlpen nctat  rra(rpno1tetnifetadls ran pn()trtrmr3ootfm  ai il(0s2xoxmpno4alenliet (fsDtmum ;u4tpe mfeiydla2emu p (0arxrmf3ootfaD  ivs s)tetoxr nydamee ivil(f rtmump;o0oetnmf3ias a2rl(vs;t4tltrio todlmtelivo s0seur(r ny1om nmiet t s2rm(ront0olxnii3iytlm2elnmsn() etrxrcty1optelueilt0t2trim iydlmen ietlt  2umx  ;t4oex ifciasfm2el(vsn()aexrircoydfpDe iei;t) 2urio3oo1am   fes tfa2tr( ont4altomo3tydfm el(vonu)trtoxf iadfptrlu i ()s2xo(m3io4ameeliesa(fs2uau  ot1tleoiicildls um(msnu4 lermr totoptr nvsls0 2tmir3nudap n ivias) 2rrxm ot1tle mfciat s uauvs;()arerxrcoo1lat lies s t2uoxopiy4ap nmfvi (faDrr(r ;t0tle ii3tyslaDrm( s u4arenmr tydoa rli s;( teuoxmpny4op n net (farraxr ot1oeen f3iltlsDumnvp;(4tltriocoydlmD aivs t s2uoio oy4llt  fvta( s2um( o;u0aleoio3iydfm ea( s;() renmo ia1faDeli ils0texm(m iudomeemnvtls sruaxmpou4opto fctasla umn s;t)aexrif3oodlp eluvi ( seuoim no1lpenmivsat)a2tax o;o4oexo i3tldfmDrmumsnu0tetnxfciadlmteai ol( teurim nydamtemnesatfarurumooo0oeen i3iytls rmuvp t) lxrxo3totoate u ils0 euoxrpnu1ope lfvs (f 2rrurpnt4olx mocilslsDum( s t4aeenmo to1faDrluvsls0texrim iydom   fesa(  rtrx p;o0oexo ictls s rmnms (4texrif3tadfptr i ilt) etrio3no1op nmivta( a2ta(monu4tltoioeils a2rlu p t0texnmf tytoatraivs s)trum(o oo4ale  ivsl()s2rmxrpno1aleomoeildfa2el( o;t0trtrir3ta1fp r nvil(  rtmxopnydamtnmivs ()sDtm( pou4olenmoctldfs umnms;(4 lxrif ty1opDran i ( srtoimpoy1alt  fcsas  2rm( ont1teeoiicildfm rm( sn(4 leoirctatfptraneslt0 rxr(m ny1lpeemfetls)sDrmx  ou1opx  oetaslaDrmn pnu)aleoio to1lpDeli o;s) 2xm(o iy4lpee feil(f 2rr(  ;o0olxoiicildfm rlums;(4teeomr3iydfpte iesls)srtrio iu4al emivs sfaDtm( pnt1oet iociltfs2emn s ()alenir3oodomD lu i;t)trtrxr nodol n feiat) Dtaumonu0apt iiciydfm eau pnu4aeenir3tydfp elnvo t  2uoim3oy4olee ivta() Drr(ro;o1ape mieias s2rl(mo;t)aexomo3iydfa  aivsl( trxr(m3ny1op elict t  2umu  ot0ole  f3iytlaDemu onu) rtnmr to1lat aivi s0trtoxo iu4ol  lfvsatfsDum(  ou4aexo oeiad s el(mon(0tltomf3ty1oaDr ieo t0s2xoirpoodllee ivs t)arrr(ro;t0tpeoioctld mDulumsn(4trxnir iytfaDelieilt) etoio3ny1ole mivs sfartmur oo1optnmf3tltfm umuvs;(0 etnxrciodfpDeli sl(0 2xoxo iy1op n fet t) Dtmump;o4teen oetltfs uau p u0 exomf3oytlpt aies;s)tetrxr3iodom emicslt aDtr(mpot0aetomf3tys s2eanmp;(0alxrmr oatomtrai s;(  2tmir ou4al nlivt tf ruaxmp;u0apeo octltlsDran onu0trtoif tadoaD  ieolt setmio3no4olenlnct s)a2umump;u1aexnifcildla uanms;u0 exnxo3totla ran olt0 rtm(mpiu1amtnlivt () 2umx  ;t0oex ifeiadlm2ra( s;(0trtomf oa1lpDrlu o;t)t2xoxo3no4ll nmfeil(f rua(mp;u1oltomi3iltls ean on()artomfcio1lateanesl(0 exmir oo1oltnliet t)s2ra(root0apeomicild m rmu s;u0 lxrmoctodfa eauvilt srurim3iydal nmfvsas) 2ta( p;o0oeen fctydlmDelnvont0 rxrxo3tydopt auvols0srxmim3oy4lp  lfetl(  rum(  ;t4oeeomoctadfm2elnmonu4areoxoctodomt anvs t s2urim no1openlneia(  rraum nu0olt ifetldfaDul(mont4artoxocia1lmDr u o;t s2uo(m3ny1al  lfetl()s2tm(  ot1texnmfciasfa2umu on(0trtrmr3iotomDeln s t teumiopoudomee fvilt)arrrxm ou1tptomietas a2umu pn(0trtomrciytfmDeanvi ( s2urxopiu4lme mfct s  2uaur ou0oltomo3iysls um(vsnt)altoxfciadopt an i;(0 exr(opoodomtnlicia(faruaumono4texomi3ias a rmnvp t4artoir3to1lpD aues t  2xrxrpoy1ll  micsat  2ur( pnt1tlxoiocildlaDua( s ()trtrxr3tadfm  lueilt) rxmio3nudll elici tf 2rrumoot1olxoio3iasfaDranmont4arxnxf3oodfm elnvo s teuoim nu4ap nmfcil(fsrta(rpnu4alxn fetad s eanvp;u) exrifciydlp rlueols)t2trir ou1lptemnvs t)artaxrono0oleoiietytfa2elnmpn()tetrmf iodfat  n s (0 2xo(rpou4lp  lfcia() Dra(mo;u1texn iciytfmDrl(vp u4 renifcio1oaD aneilt0s2urxopou1opee net s s2ta(ro;u0oetnii3iadfs uan p;t4aetnmo tydfmDr n s;s srurxo nu1lmt mfetlt  rur(mp;u0opto fetatfm ulu o;t0 ltrmr oydlaD  uvo t0srxrxo3ou4am  mncsa() 2urx pou4alx  oetldfs eanms;t0aleoifciatlpt  i o ( t2toim3nu1altemieilt)aDtrurpnt0altoii3iytlaDuauvo u0 leoir3oy1lm rluvolt)sexoxm oo1alee fvt t)aDtau pnt4tetn ictadfs2rmn p;u)trtrxf3to1omt aivs t) 2tr(m3ou1ope  nvs tfarrax pou1opx mo3iyd a ulu o t)alenif3tatfmt auvsls0sexoxo ny4amtnmncs t  2ur( pno4oeeoif3ildfm2eluvo;t0 etnxociatlm   nei;(0t2umir iu4llee neslt) ruaumpnt1ope miciadlaDeln s t4areomo3iy1fmt  ueols)trxm(o io4lpeelnet s s2ur(ro;o1ape  feiltla umnms t)trxoxocty1fmtraivs;( t2xmim iu1omt mncil(fsDrrxm ou4ale  feiyt m raump t0 ltnifciadfmt lnvi;s) 2xmxo3oy1al e fet sf Dtrxrpoo4tlxnifetasfsDra(mo (0 eerxo3iadlp rlu s t)tetoirpny1opt  iesas srrau p;t0aexoioeiydlmDea( pn(4trtrxr3ootfmt  ivo;t tetrxr oodolte ieiatfs2tr(  ot4alt  i3tadfsDrmnvp (4 rxomf3iatlatrlueols0s2uo(r iodllt micsltfsDur(moot1ope iiciysls rm( snu0trxnxf3oytop eaivo;s0texrxm3iy4ll emiei (  2rmu ont4tltoii3ilsfs2eanvo (4aleoxfcto1oate u o;t0t2toirpiydop nlieta(  rraum nt0altnmiciat a rau s;t4 rxnmf3tadfp  li s s0tetoimpoydolee fetlt) rtmum ou1opt  ictys mDra(mon() reoxfcoytfpDe u ils s2trir3io1amen iet s aDtr(rpnt1oeeomoctatfa2emnmpn(4 rtoxr3oo1fp rlueo ( sruoxo io4lme  ict s)aDra( oot4tlx  fetytla uauvs;(4tetrmo oa1omtraneo;() 2tr(o nydamtelfetas) Dtru o;o1tex  f3tls a emuvonu)aetnmo todfpD lneols0s2xr(mpoy4ap elicslt)s2trurpot1oeeniicildfaDem(mon() eeoiocoatfmD  uvi s trxrxrpny1omtnmnetl( aDtrum ot4tlxn iciat a2ea( p u4altrxf3oytfatrluei t)truo(o nodlptn nesas  rtm(rono4olen ictltls2ulnvp t)tlenmrctadfa rlu olt) rtrimpny1apte fctl() Dtmum ot4tpto o3iadla uanvo;t)alxomf3oatlaDeli sl(0teurxr3oy4llenlfci () 2tmurp;u4aeeomictlslm2el(vo u4arenmr to1fateauvi t) eto(mpnu4ll   fcsa(f 2taurpnu1tlxnii3iydlsDuau pnu4trtrmfcoo1opD  uvo;(0 eumxmpoudome mfct t  ruaurp;o0apeoiicias aDrm( o;(0 renxr3tytlpDrln s t) 2xoxm nu4amt lnct s  2rrur ou4tex  iciasfa2ulumpn()tltriocty1lptranei t)sexmim nydlpee fvtl()sDtm(monu4oet iieiysfa2um( snu4 etrifctotfpDe ieslt s2xrxo3oydapeelics sf 2rm(rpno0aexnmfeildlsDel(vs t0altnir oy1omtelneils0 rxmxrpou1ape mncs s  Drm(ront4alto ictydfa rmnvsnu)trermo3tatoat  u i s)srtr(o3iu4al elfvia( s2uaxr nu0aetnio3tlt mDrmuvo;t0artnif3tatlpDean i;t)teuoio3nu1lp n nes ( artrxmoot4tpe ifetydfaDrmnms t) lxrmf oy1la  luvo (0srxr(o3nudaptn nvsl( aDumxrp;t1opx  fctltfm2rluvo u4teenxrciodom elieo;(0t2xrim ou1oltn fvtas aDrmur ;o0apt mo3iyt mDua(mp ()trxoxfcoodfp r nvo;t0 ruoxr3nodlm  livtasfs2umx o;u4aeeoifcildfaDelnmo t0trxnxf3iodlatrauesl( srxrim nydol nlneils)sDtmxm oo1opeo ocild a2ean on(0tetrio to1lptelneo;t)s2um(rpoo1op  mnciltfa2umxrpou0apt  f3iasfa elnmp (4artnxo3iotfa raueilt) 2xmirpoy1lp  mfci (fsDtm(m nu0tptn f3tltfsDel(vsnt0altnxf ootopDelnei s sexoxo ny1opte ivtasfa2rrx pnu1tltoifctad sDran o u) eenif tatfaDrlivo;t)t2triopnu1lmtn nvilsfs2umumpot4tpxn fctysfaDranmp;() etoifcoy1lmDeai ils0t2uoir3oudolee ics s) Dtrxrp;o4tpt  fetytls rmuvonu0tetrxr3oo1lm eli il(0 rxmxm3oo1olt  fcs s)sDrruroot0tptniieiatls2raumpnt4alxoxf oydopDrau i () exoir oy4llenmiviatf Drru pot4alxnifciys sDea(msn(4texnif3tydop eluvi (  rumxmpoydop emfvslsf rumx onu1alto fciatfmDulnvs;u4tetnmr3oo1laDrauei;s0 2urxm3ou4lm   ieil(farrr(rpoo0tlx mociltfaDelnvs;u0trtoxfcty1faD aues;t)srxmxm3oy4omtnlnvt sfa2rm( o;o0opx if3ias a2rau p;u0 rxrxrcia1fpteaivslt0 exo(m nodale  ivs t aDurx ooo0oex moetasfmDeanvp t0texnmo iotomDrlneilt  rxmxo3ou4ale  nvt t)arumxr ;t0optnio3tas a rau p;t)aleoxfctatomDrauvsls srxr(mpio4ape lfcia(f Dua(rooo0aleoioeiysfm2elu o u0altnxf io1oa eaues;s  2uo(m3iu1apte ncilt a2ur(r no4apt miciys a2em(vp (0trxomocootfmtr ivils0srumirpou4ap   nes ()arurx o;t0apeomo3ias aDranmsnu) lenmrciydlaDrai i s)t2xo(o io1lpe lfes s  Durx p;o1teenifeiatlm2eaumo ()trxrio3iadfmDrlneil(  ruoio io4oltn icsat) rtau  ou0opeomfetld sDulu sn(0arxoir tytoatr i olt)srto(r3iu1al  mnvtlt a2tmum ot1aptniiciydfm ulnmo;t0 rtoif oadfa  aies;()s2xm(rpiodlmt  fct () 2um(m oo0texo fctldlsDrmuvp u) ltnmociotfmt  u i s) 2to(o3oudame  ieslsfaDua(rono4oeeoif3tydfm ul(vp t0tlxoio3iy1omt li o t)trxm(o nu4omtnlncia(faDrr(  oo4oee ioctasfm2uau pnt) exnif3iodom elneo (0 rto(r3nodll elnct t  2tr(  ;u1aptomoeilsfa em( p;t0aeenif3oadlaD livo;(  2to(r iudlleemfcsltfsDururono4oltn f3iltfm2ran s;(0tlenmr3oodfa e iei s) etr(mpoydlmtnmnetlt aDumumonu0ale ii3taslaDrmn s t4 leoxrctadlmDeln s t sexo(m no4lpte fvt s srtaum ou0oee ifctatla ua(vo u0altrirctadlp e i i s)tetmxmpnodaptelfesls srtr( p;o0tetn iciasfmDum( ont) rtrif3io1faDraieo;s0srxmir3iodlp   nvsat)a2rm(m ot0oee  o3iys mDuluvp (0arxnxf iytfmDr i sls  exr(o3io4apee iviatf 2ur( p;o0tlx mfciytlm elnvp u4 etoio3iydlmDe ivs;s trxr(opny1lle mfeiltfa2rru  nu1oltniocildls umu p t0tlxnif3io1lpDe n s ( teum(m3oudopeelncs sfaDuau o;o4tlxo ocilsfa umnmo;()tltnircoydfpDr uesl(0trxoirpoo4ole lncsa(f 2tm
\ No newline at end of file
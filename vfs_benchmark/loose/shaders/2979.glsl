@@ -0,0 +1 @@
+ivo (  exm(opio4ape lnet (f Drmum no1tpe moeilsla ua(vp t4tltnxoctydoat anvs;s0trxrxr3oy4optnlfctas) Dum(m nu4tetomi3ildla2uanvs t4trxrxf iydfmDrlieilt0teurxo3oydal n ics s)aDtr(roou4opxoiieils m uanmpnt0teenmr ootfmDrai s ()sexmir3oo4lp  lfctl(f rra( o;u1optnio3ias mDem(vp;t)aetrxf todlpteln i (0tetmxm3nu4lmtn nct t) Drm( pou0aeto ociadlm umump (4 rtrio ootlaD anvs;t0tetrxrpio4ol n ict s arurur nu0tlt mf3iasfs2eanms () exnif3iotop e nvsls sexrxrpio4optnmics sfaDtrxmp;t0tee mo3tadlm2ea(vont)trxrif3oy1omtran i;(0 rtoxo oodomt lfesatf 2umxrpno0apxnioeiatls ea(ms t)tetomf3tytfptelueo ()setmxr3ny1op emictasfaruau poo4oleniociysls2um(ms;t)texnxo ia1omD  iei;(0sexm(o3iu1open ici t  2rr( oot4tlxo o3ils m ranmp;(4treomr oa1omD anei;s0 exrimpiydolee ncil(  rumxrp;u0optomfcias m2rlu p t4aexrmf3oadlpDrluvslt)srto(r3iu1llen icsl( arrau p;u0oee  i3iatfa umn sn(0 rxomr3io1fmDeaiei;(0trxoir3io4al nmncilt)aruaxmo;o0opxn oeias s rlnvo u4aexomf tytfm eli ils0t2toxr iy4alt liesas)sDuaum ;u1aleoiieilsfsDelnmpnu4 rxomf iydfmDeaueo ( s2urxo3nu1ameemnctas)a2urxronu0olx miciys sDul( onu) lxrif iytfaDe u slt)t2urxr io1ame lfvtlsfsrur(mpno0oetn o3ilsfs rl(vp;t)tltnio iy1fmt  ivi;s)seurxo3ny1ap nmivtlt  rraxr ot0aexn o3iadfm2eluvs u4arxomf oodfmt aneo;(0 etmxopoodope mnet t)aDraurp;o1tetniieiaslaDemuvpnu4 lxrmf3iatfptelneilt) rxm(m ou1om  mfci sfaruaurpnu0ape ii3iatfa2um( o t0treoif3oydfmtr ivo (0trumio3ny4llenlfvs s sDrmxmooo4tptoii3iatfaDeaumon()aetnmocto1lptrluvsls0sexrimpou1ale mfcsls)aDrmu pnu4teeoif3tasla rlump t4tlxniociydopDr i il(0 rxo(o oo1amee fciasfa2raxroot4oet moeiydls rau onu0 rxrxf3iodlpDrln o ( sruo(opiudalte ivtasf rta( o;u0tlx mo3tytfa2eaump t0tlxrxrcootlaDeaneo ( s2xr(opiy1lptnmicilt aDur(  ;t0aeenmoeilt sDean s ()texoxf iodopD aueo;(0 2uoio oo1al  mnvtas)s2uax p;o4tptnioeiatlmDrm(vs t0alxnmfciatopDelu s;(0srtrir io4lpen ivs sf 2ra(m nt4ole  i3iydlm um(mont0artomr to1fmt au s;t  rum(m ou1am   fcsltf 2umx oot0aexn fcils a uanvpnu0 eeoif3todop eaivi (0sexriopou4ll   neta(  rtr( p;u0oex ioctlsfs2umnvonu0 ltrir3iotlpDrln o (0 eumirpoodlmenlncsl( aDtaur nu1oltomo3iadls umu onu4trxrir iy1opDe i o t  ruoxopny4lpenlicias  2ra(mp;t0aeenifeias s2raump;t4texrmr3ia1oat  ivs;t0srtoiopio1amt mneslt aDrr(ro;t4oee mi3iadfm2ua(vs;(4 lxomocoy1fm eauei;s)srxrxo3iy1ll emietlt) Dtaxrpou1apt mf3ilsfa2um(mp;t0arxnxf iatfa eaueo ()s2tmiopoudlpt mfviatfa2uru  nt1apt mfctytfa em(vpnt4 leoxrcoydom  liesls  2xrirpiodape mfci t) rtm( poo4aex ii3iydlaDrlu o;u0 eeoif3ty1opD lieo;t s2xo(m3iu1altemfvslsfarururonu0olen ictldlm ean snu4 exoxrctatfatr uvslt0 euoxo nu4aptnlicsas)s2urum ;u4alenifciyt m2umnvo;u4 lerif3tydfa   u o;s  euoxopou1alt  nvsls  2ta( o;t4tlt ioctltls2raumo t)trerirciodfptr nesl(0srumim iy4ap n nciasfs2um( o;u4tpeoiieiad s2umnms;u0aleomrcto1oatranvi t srxo(mpou1aleelfvsltfs2tau p;t1oex  o3tyd a eanmo;()texrio iotfat aivolt  rxrxm oudol e ietltfsDurxm oo1tex mo3iyslm eauvs (0 reomf3iadom e u i;s  2urio iy4apen ivi () Dua(r nt4oexn i3iad sDrmnmp t)aetnmr3tatom e ivs;t  ruoio3oy1apt miet tf 2raum no1oetn fciad s um(vs;t0 rtnmfcto1opDelieils0trurxo3oudap  lfci s)srta(  ot1aet iietadlm2ul(mpnt4 etnxf3tadoaDeaieol(0 exr(mpoudol   nesltf Dtruro;u4aeenmfciasfmDum(mo;u)tlermr oa1la   ieo;(  rum(r iy4ol emfci s)sDra(  nt4tlxn o3ildla2ulu snt4trxrio iadfp raueols0srxoxrpnydlmt mfesltf rrrumpou4tlxniieias sDrauvon(4texoirctatoa raieo t0texrxo io4olen nesat s2tmxm ;u1aex  oeiytfs2ulnvo;t4altoirctytlaD ln s;t s2uoim oy4omenmicilsfs2umx poo1tetoioeildlsDrln s u0trxomocio1fatranvs s0 etrxrpoodope mfctl()srrru p;o1oltomfeilslsDua(vs;t0 rxrif3todfp  livolt texmxr no1aptemivta( aDtr(m ot1aexn ociytfm ul(vs;t0 lenmfcia1omDrlnes;t)srtrxmpoy4am e ivslt) 2trxr ot1oltomfctys a uln o;u4aexnirctydopDrlu i t0s2xoir3oo1apeelivsa(fsrrax oot1opeo oeiyd m rm(mpn() rxnmf3tadfpDeln i;s) 2xo(m no4aleemfvtl(faDumxm ;o4tltnmiciat sDua( onu) rtrxf3ootlpDelieo (0tetmir iudam emfcs (  2rrxrp;t0opx mfciys sDuanmp;u4trtnmfcia1op rai i;( seto(opoo4opt mfvi (  rtr(  ;o0tex  ocild mDrmu p;u0trxomrciodfp   ueo;t0 etrim ny4omenmfet t srumump;o0apx  ieiydls2ulu p;t4artrif oytopteln i;() 2xr(r3io4opeelicslsfsrrr(rp;o1aexomociatfmDuanvpnt4artnxociadfpDeanvi ( teurxopno4lmenlivsat s2tau pnt4aptoiietasfa2rmn pnt0teeomocoatlm elivi s)setrxrpoy1lm nmfcsasf rtmuroot4tlenmfctadfa eanmp;(4aetomo3tatlaDr uvolt srxoxm nudapeelnei s)aDtmxmp;u0oetniiciatfs2eluvp t4tltriociotlmDe u slt) rxrxo3ny1ap n ncia(fsDtr( poo4alx mieiadlmDeau o;t4tleoxo3ta1lpDe i slt  rurxm3oy1lltnlies () rtax  ot1teenmi3iasfsDuanvp u4tltrio3oodopDeaivs s0trto(mpoo1lptnmfciat)srrr( pot0opt  feiytlmDul( snt0trerir tydop eaieo;t0srtrio iu4ll nlnvsat arra(rpot0opt ifetysfaDea( p;t0aeeoxrcoydfmt aieils trtrxo3oudamenmneils  Duaxmooo4optoio3iyt a2ra(mp;t0tetrif3oa1fa rlivsl()trtr(o iu1openmnciltf ruaxmoot4tet mi3iys a um(vsnt) rxnxrcoatfpDe nei t)s2tmxrpoo4amenmnci (fsDum(m oo4tlxo o3tytfsDel( s t4arxomfctadom e ies;s trxoxrpnu4om  micsl( sDtruroot4aexoiocilsla2eaumpnu)texomrctodomte u s s) etrxo3ou4openmneiatfs2ur(rp;u1opxnio3tltlmDrl(ms;(0altoircootom  luvi (0 etrio3oo4ll  livs () 2ta( pou4alenmfciltlsDem(von(4 eeoxf3tydomt  ies;(0srurio3ny1ame livils a2trxront4olen i3ildls2emuvo;(4tlerxf ia1lmD lu s s srtr(m ny1ll  livslt  rur( p;u1opeo ieilsfmDulnvsnt) lxomo3ia1fmteau ilt)s2xmimpnydalenmfvtas)aDua(r ;t0aleomoeilsfs rmnvs u0trxrxo3oo1opt lu o;s) 2xmxopoy1ll nmiei t  Dtmur ;u1tleomf3ilsls2rl(vont4artnxoctadlp rauvi;t srxoimpiudll  livsasf rtruroot1tpen ieiltlmDrauvp (4arenir3iodlmtelnei s srum(r oo4apte ics () 2taumpno1tex moeiyd aDrm(vpnt0areoxr oydfa  aieo;t  rtm(r3iy1opte fctl()a2ua(  ;u0tetoiiciadlmDrlums;u4alxnxociytfaDe nes;t) rxm(rpno4ll nmfvsls sDurumo;t0alxoiociatlsDem( o t)tlerir3to1fmtelivi (0trxrxrpiu1lpe mfvt s) Dtmxm nu4aetn iciydfs2uan snu)arxrxociatfate ivsls0truo(o3iydlm  lfcta()sDur( o;o4aeen fcilt aDrmn onu) eerircoydoaDrlu ils)s2xo(m3ou1op nlncia() Dururpou4openmiciys a2ua( p (0trtrio iodfa  auvolt tetoxo3no4lleelicias aDrm(mo;o0oexnmo3iys mDel( s t4aexriociytfmDe uvils seurio3iu1lm e ictatfs2ra( o;t1oexoiietysfm ul( o (0 rtnir oodlaDr neil( sruo(o iy1om   ietlsfsDrmur ;t0tlx miciatlsDulumsnt0tetnxfctydfptrln i;t t2umxo iy1om emfvia()arrr(rpno4oee iiciyd s uln p u0tlxrmf iotfateli s;s)srtrxrpno1ale lfviat  2um(r no0oet mo3tls s emnvsn()aetoxf3iodfaDeln o;( s2um(m3oy4ll emivi sfa2tr(r ot1alxnioeiasla2rauvp;u)arxrxf ty1fmt luvs (0trtmir3oy1lltnlfet ()aruaxmo;o4opt  oeiytlmDrm(ms u4tltnxo3io1la e n i ( trxo(o oy4ol emnciltfsrta(mpno4opeoifcils mDrmn o u)aetoxf oodopD lnvsls truoio iy4lm nmivtat  2tm(r ot0tpt ioeiatfa emumont4 rerxrcoo1fm eai o;(0 2xrirpoo1lm emnvt s)srrmu pnu0ape mfetldfm2rmu pnu4 rtomr oydlm  livilt) rtrxmpno4om   ncsl( sDrr(roou4altoifciysls emu ont0texrxo3oatfmD luei;s teuoxrpnydapen nvt t)sruaxmpnt4opto iciadlm2uaumo () rtnircoo1fmteai s () ruo(o3oy4alte nci tfarurx  nu1alto ocilslm2rlu o;u0alxnxf tadfpDelnei t)srtmxr3oo4opt  ici (  2tru  no4opeomi3iysfa rlu s (4arenio3ia1latranei (0 rxrxrpnu4oltelfesa(  2urxr ot0olx iieiyslm2um(vp;(0texomociodfptr uvols t2xoiopiy4lpt mieiat srra(mpnt0apt ifeildfmDumnvonu)arxnxfctadopD  i s;t) 2urir nu1lmtnmfeiat a2trxmooo0aeeo o3ias a rmumo (4aleomrctydoat  uvo;( s2umxr io1al  mnvsa( arurur ;t0apt  f3iadlsDemnms;(0altriociytomDr uvsl( seuoirpoudlpen ncslt  rta( pot4teto oetltlsDemnmp;t0 lxrxr3iotlaDeluvs t s2tmim iudomtemfcta()srraump;o0tpx iiciyslmDua( on(0aleoxf tydlp r neo;s)trtmio3ny1ol n ieslt)s2tmxm ;o1teeoii3tyslm ulump;u0tlerifcootfpt aiei (0srur(o ny1lm e fcias) rurxmpnt1tpenioctys a uaump;t)treomr3iydfp eluvils0s2xm(m3iydome  nvsa() Drrxmoou1apenmociatfs2emump ()arenifciy1omtrluvsls) rum(rpny1am   fei t) Drmxr nt0aet mfeiyd sDua( s;(4 exomr oodopD anvol(0 exoio3oo4am n neia() rraxr ot1tptnmociaslaDumump;t)trtoirciadfa e nvsls)tetoxr3iy1omeelnvsa(f Dum(rp;o4tltn fcils s2rmnms (4aeeomo oatomteluvi;s0 eumim iy4omeelfcilt)arraxm ;t1aptoioeildfsDel( p;t4aeeoifcty1omDe n o t0 rtoxm ny4am  livi sf rrrx p;u1aee if3tyt sDelnvo;()tlxrxo3oa1laD lnvs;t t2urir oydopenlnvs t a2tr(mpnt1oltnii3ias mDum(von(0trtnxr3iytlpD  n o;t) rxoir3ou1ol  mfcs s sDrmxrpnu0tetn oetysls2ra(vo;(4aetrmo oo1op e uvsl(0 2xrxr iy1amtelivia( arur(rpot1olx ifciysfm um( pn(4aeenmr oo1la rauvi s0srxo(m oy1altnmfvsasfs2ur(r ;t0tpenifetasfm ea( o;u0aexrif3oo1lm r uvil( t2xo(m3ou1lleemieslsf 2taurpno4teenif3tlsfmDrluvp u) lxoxr3tydoptr uei t)sexrxr nu1om elivs tfaDra(mpno1tlen ociys aDrmu onu4 lxomr3todlm   u s;s)t2toxr3oo1aptemfcias)a2ururo;t0alxo oeils m2raumont0 etnir to1fmD lueo ()seuoxrpiudopen nei sfarrr(  nu1opx  o3tyd a2ra(vs t) rxrxf3iy1laDeli s (0 rum(mpiy4lm elncs sfaDurx ono0oleo ieiadlm2umuvpn(0 etrmfctytfptr u il()texmxr oodolen nvtatfaDumxronu0oleo oeias s2el(mo (0 ltnxfcoytfm eli s;s0 etmio iu1om e ncias)a2raur nt4optnmfeils m2raump;t)tetrmf3tatomtelu olt)teumio3nodlm nmfctat  Dtmurpou1aeeoiiciydlm um(vs () rtnircoo1fmDr ueils)s2tm(mpnu4openlfetas srtauro;u4tpen o3ias s uln p u)arxrmr ty1fa r ivs t0 rxoiopou4olee nci ()arra(m no0oleoiiciad aDrmuvs t0tlerif3iatfa r ues;()trumxm3oudom n ies sf 2trum ;o1opeomicilt s2rmnvon(0aexoio to1lmDr ivslt s2ur(opny4omen net t  Dtmumpnu1aee mfetaslmDulump (0tlxnxociodlptelnei s) 2xoim io1ol  lnvtl( arua(  ou0opxn i3tydlm eanms;u0trxrmr3iydlpD anvo;t trxr(rpno1oltelivils a2rmxm ou4tpeoif3iatfaDrm(vpn(4tltoif3oytoaD anvo s  rumio iy1lp emfvsa() rrrurpoo0aee  fciad s ran onu4alxnxrctydfpDrluvo s  rurxo iodamtnlnvtlsf Dur(rp;t1altnioeiyt s em( p t4altriociadop eaiei s0truoxr oy1openlfctl(fs2tax  ou0tltnmfciat a rauvs ()arxnmrctydoa r uvo;t0 2uo(o3nu1al   feilt  rtrx pnu1tlt if3tadfaDuanvpnu0altrmfciytfate n s;( setm(m iodlltn iet (f 2ur(  ou0oeenioeiydls2rmuvon(0 etnxo tatop rlivi;(0 eumirpnu1openlfes s  2raxmpot1ope if3iytla rl(ms;u) lenmfcia1lpDe nei t  etoio3oydopeemfcsl( arrmur no4aleo feiaslm2ulumo (0alenxf3oa1oaDelieol()s2xm(m3no1lmt  fetlt)sDuaxmont4tlto ietld m2uaumonu0texoxfcty1la e ivo;t  eum(opoydllenlfei (f Dumxrpoo0tleo ietldfs2umnmp u4arenxr oatlmDeai sl()s2to(o3oydalen fci (fa2trumono4oleomfeiydlaDul( s t0tlenmr oo1op r uvs t0seum(m3nu1lm e fei (f Drrxm oo4alxn fcils mDum( s;(4 rxoxr3tydom rlieo t0setoim3nu1llte nviat)arrr(r oo0tpe ioetyd m2um(vpnu4aexoircto1lat ln o (  euoio ou1ap e fet ()srtmxmont4opx  i3iadlm em( ont4aetrifciytoaDrlu slt)t2urir oodlmtemfvta(  Dur(rpno1tet mf3taslaDeluvo u)alenir iatom eanei;s)t2xoxr oydomtemnvtl(  2tm(root0oleoifeiysfm2em(vsnu) rtnmrciatfa eaivi (  2xoio3nodlmt
\ No newline at end of file
@@ -0,0 +1 @@
+neilt)t2xo(o iy4opeemivs t)srtmxmp;t4alxn ocildla emumo (0 rxrir iytfa eaies;t)s2xriopiydope miei t)s2rmxm ;u4oeen fctys a raump;() exoir3tydlatran i s0teum(o3iu1openlnvtls)s2urxmoot0tex  fetys s rl(vo;u) lermrciydoaDeaivols) 2xr(r3ou1lpenlfeil() rraum ot0ape mieiysfa umnmpn() eenmr iytlmte ivo;s) ruoxmpiu1lpenlies (faDraxront1tpe mictls aDuanmp t)aexrmr iotoat  nei;s  rxrio nodaltn ivtls  Duax oot1tpenif3tlt m2elnmp;u0aeeoxr oy1om e iei;t0t2uoir io4ap  mncias  Dra(rono1tetnioetadfs em(vp;t0tetnxr iotfa e ueo t  rxm(o io4al emneilt)aDtaxrp;t4oexnmfciadls rmuvsnu)tltrxrcia1fm eaivo;s trtmxo3iu4lp nlfvia( sDtaxm nu4oltomo3tad aDrl(vo;()tlxrxrcoytlpteaiesls0setm(o3iy1op   ietas aDrrur no1tetnmoetyt s elu o ()texriociodfat ai ilt0t2xo(m oo4apen nvsas)s2umu p;u1tpx  f3iydfaDraums;() rxoif oa1faDr nes;s0 2tm(r iudom   nvta()artmum oo4alt if3tatfs ran ont0altnxo3ta1om eauvs t trtrimpnodomtnmivil() Durx  ;u0olxn feilt a2eanmp;u0texnmr to1lptelnvs;t t2to(mpoudllt  fcils srtm(ront0oeto i3tlsfa2el( o u4 etrif tytfa rlnvo;()srumim3ou4amt mnciat)s2tr( poo0texn octld aDrl( onu0 rxnircoadoptrli olt0 2xo(mpiy1lp  mfctl( aDtau pou0tee mocilsla ulumsnu)teerifctadomDeanei;s seurim iudopenlfcsas srra(rpou4apen f3ild s2elnmp;t4tltoio oadlm eli o (  rxr(opiu4ale livsas a2rmx  ot0aptoii3tlsls emumsnu) etrircto1fm rauesls) 2um(o3iy1lpenmfvsasfs2taxrpou4opt  ieiasfa emums ()alermf3oa1fmt  neolt0srurio ny4amt  fviasfsruax  no0aleomfciydfs umumpnt4tetoif iydfaDelueslt  exr(m3ou1amtnlfvils sDrmur nt0opt iieiltfs emuvp t4aexnmociy1fa  anei s seuoir3nudlmtn fctlt  2ta( ont4alxnii3tydla ulu o u4aexrmf3tytomD auvs;s0trtmirpiudomt liesa(  rtmu  ;o1opxo feils s2ran p t)aexnxr iotom r uvil(0tetrirpoo1lp e icsa()a2trx p;t0oet  ocils mDulnvs;t4tlenio iytla eauvo (0trtrirpnydaptnmnvslt  2uaxrp;u0tpe moeiyd aDeau o t)trxnmrcoa1fpD  nvo;s0trxoirpnodlp e nvt s srrrxrpno0teeomo3tat s2em(mo;t0 lxnir iydopt  n ils) euoimpoydaptnmivi sfaDtr(r nt4olxniieiat m ra( p;u)alxrmr3tadoa r uvol( s2um(rpiydllen ici s sDrmx pou4ole mfetatlm2ul( onu)trenir iytfmDelueols trxoir3oo1lltelfet (fsrtaxm oo0tee mictlsla rl(vp;t0alxrir iy1lmD aneo t)sruoxr ny1op  lfcta(f rtmx ont1tpx ioctys s rlums t)arxoxociatlpt anei;t  2xrxopoy4lmt  fcia(fs2tm( pot4oeeomf3ilsfsDeluvpnu0aetrxf3iadfa e neolt srtm(r oo1alt  icil( s2um(r no0aetnifctadls2ul( pn(4 exnirciotlpte uvo t) etmir io1ap nlnei s)artm(  nt0optoiiciadla rlnmo;(0 ltrxr iydoa eluvslt0 euoir oy4alte nvilt) 2rmuro;o1alt mf3tyt a raump;t) lxrmocty1la raivsl( texoim io1omeemnes t aDum(mpou4openmoetasfa2emnvo (0trtrmo3oatom eai il(0srxmiopou1al nlivtas) rrrxro;t1oex moeils a2rmn s t4tltrif3tytopDrlivo (0t2ur(rpiu1lpen nvs ( a2ur(rono0tlx mieilsla2umu p;u4aetoircoodlpt lnesl(0 2xmxo3oo4ome  iesltf Drrxmo;u4tle if3iytfs2ra( pn(0teenmrctydfpDelueslt  2xoxr ny4omeemfciatfarra(moou0tpe moeiydfm uaumo t0 ltnxf ta1oa ean ol()setrxo3iudlmtemfciat)sDurur oo0ope  i3tat s2rmu p t0arenxf oy1latrlivi;s)srxr(r3oo1altemfviasf rtrxrp;o1apxnmo3iat sDemnmo;u4 exoxr3tadfaDr i i;t)sexrxrpoo1ale mfcilsfsDtm(mo;o1oetniictytla emn pn()teeoio3iodlat an s;( srxoxr iu1am n nei sfaDrmxront4tpx mfciltfa2ean p t4aeeomr3oy1opDrai o s0tetoxmpnu1ope lfvi s) Dtaurooo0olxnmicilslaDuaumsn(0treomf tytlp r ies t s2toir3iu4lpe lfvsas arururo;u4apxn f3ildlm rmuvonu4aetniocta1lmtrai o;s0 2xo(r3nu1om   nvsa( srrru  ;u0oex ioctldfs2el( snu4tetoxf3oodfptelivsl(0s2tm(r oo4lm n ivs s  rraxmo;o0aee mo3tadla2ulnvonu)tltrxr ta1lptr nei;s)srtoirpiudalt  ieta(f Draxro;u0tlxnmocias s2emn pnu)aetnir oadlmt lnes;t) 2xrxr3oo4ap  lfviasf Dtmu p;u1alxoiietysla2elnms u4alenxo iotlpDeanei;s0 etr(r oydlpe  ietlt sDurxmo;o1opt  ietytfa rl(mp ()tlerir3oadfmte u o s) rtr(m nu4am nmfet s) 2um(  ;u4opxoiietat mDumnmon(0trtomo iodfaDe i slt  eurxo3oudop  lics t) 2raxmpno0tetoifeiyt a2uau snt) leoxf3iotfa  au i t0 rumir io1lle mfct t)aDrmxro;u4alx mictydfaDelumo t)arerxf oo1lp rlnvo () 2uoxrpiu1omtelivs s)sDrmx oou4tptoif3iydlmDumn p;(4 etoxocto1lp eanvs;( t2xr(m oudomeelfetl()artm( oou1olen iciytla emnmp;(4 lxrxfctydoptelivo s)teurxr3nodam  mncilt sDta(mo;o4open fcias m emuvo u4alxrmr oadoaDr n s ( setr(m io4am nmfet () Dtruronu4aeenmoeiysla2rln o u4 eeomf3io1fa e ies;() rtmiopiudal n ivta(fs2um(ro;t0tetnmictyd a um(msn() lxrif3oodlp eaues;s s2to(mpoy4lm nmfet (fa2tm(m ;u1teto ieiyt m2rm(vpnt4alenxfcoa1opDe n ol()seuoirpoy1omtemfet s  Drrx  nu4tpxniiciydls2eau o;u0alxnxr iodlpDr n sls) 2xrim oo4oleemncilt  2tm(ronu1alxomicias sDel( pn(4trxrmf iotfat anvolt0s2tmim oy4ol nlfviat)sDua(r nu1opxnif3iaslm umu s (4alenxr oadoa eau i s  rurxo iodolen ncslsf Dtaxrpnu4oex  oeias s2ua(vsn() exrmociotfaDrli o t0srtrim3oodlltemneils a2ra( o;o1tptnmietatfs2rm(mp u4treoxf3tadla  an o;(0trurimpoydlp  lnvt sfa2rr(r nt1apenif3tysfaDrlnvo (4arxoio3iytop   i o;s) 2umxmpnydol  lncilt)srrm(r oo4ale if3iydls rm( o;u0tltnio3tadlaDranesls)trtoxmpoo4omte fcs t  Dur(rpoo4tpxomf3iyd m2uauvsnu0 exoif iy1fa raivo s)setoim oo1olt lnvilt) rra(mono1aexo ociad a2rm(vpnt0 lenioctotoaDean s (  2tm(rpio1lpen nes tfa2tm(root4tpxnmieiyt s rm(mpn(0tltnxr3iydop   ivo;(0 ruoxopoo1opeelfct s  Dum(m ;u4aptnio3iadfmDean sn()tetrmrcio1omDrli o (0seum(rpou4omeemivt s)s2taurooo4alenmfetaslsDumumsnu)teermf3ta1oa e nes s0 euoio iudol e nesatf 2um(rp;o1alt mfetysfaDumn o (0aexnmo3oadoaDeli ils t2ur(m io1lle  ivi (fs2uax  ou0aexoifetydfa2rln pn(4 rxoxo3iodlaDe ivslt)trxmir3ou4ll  lfci tf 2rm(rpnu1tlxomieiydlaDem(vo (0 ltomr ta1fm   nesl(  rxmxrpno1optelfes t arrm( p;u1openmfetyt aDranvon(0 rxoif3totfp rai olt  2toxr3iu1apeelnvilt sruru o;t1tltnio3tyd mDrl( p (4tetnmo oa1fa eanvi;()seuo(opou4ome mnvils srraump;o4teenmocils m2ra(vp;t0aexoiocoa1laDe ieolt0 eurim nudal nmfetlt) Dtrx onu4texnmieiat s2uauvsnt) rtrio oa1lpDeluvo s0trur(opnydlmte ici sfa2urxrooo1tlto i3tatlaDel( o u4tlxrif iatfa elieols0teum(o ny4lp emfeiat arra(m ;t0tex ii3iatfs2uau o (0aetnxf oy1lmDeln slt)trtoxrpiu4apenmnvtlsf rtmumo;o1aexn iciadls umuvo () rtnmrcoadlpD  i s;t0srxmim iodapenmici () 2um(m nt4oltniociys aDrauvs t0artoxo3oodomDe uvi (0texmxmpoy1omtelict (  Draumooo0oexoifetydfa elu ont0 rxomfciatoa elneo;(  exoxo io1opeemfvia( a2ta(m ;t4tlxn i3tysfaDrlumo (0 eenirciy1opD  ivi;s  rtmim ny1olt  fcta()sDtax  oo1alxoioctltfmDra(ms;t4teermfcootlmt luvo ( srxmimpio4lpe mfesl()srtru  ;u0oeeomoeilslm2elnms u) rtnxr ta1la e ies;s)srumim3oy1altnlnciat  rururoot4oetn feiasfa2eaumo;u4artoxfctotom elues;t)setm(mpno1lmt lfesa( sDraum oo0oexn i3tldls el(mp t)artnif3iydoa  lu i;s) ruoim3iy1lm emiet s sDraxrpnt0opeomicils aDua(mo (4trxrxf3oa1fpteaneo t0srumimpny4apeelncta( sDuaur ;t1olx if3tatls2ul(mp;() eeoir3tydlpDeanvs;s)trtoxm3iy1lmt mfvsa(f Durx onu1tptoiocild a rmnms;t4artrir io1lpDe i i t  2xmxo nu4om elncs tfsrrr(mooo0aptn fctytla uln s;u0 ltomf3iytlatrauvs;() rxmir iodlmeemiei s)sDrrxmp;u0tetnmictadla ua(vo;u4 reomrciytfat  ues;s)srxoxo3ou4om  mfvta(f Dtm(mo;u1teeoio3ildfs2elu snu)artoif3oadlpDe uvs t) etrxm3ou1op elfcils)a2rau oou0ape  o3ias a2ua( pn()aexomr3todoptr ivsl( srxrir3nodapt mnvsl(fs2rmxrp;o0oet mieiatlm2elumo;()tlerxr oy1omte i ol()teurim3oo4openmivt ( a2tax p;t4apxomf3ilslaDuau s (4altnmr oydoa eauvi;s)srtrir nu4amt  fei t)srua(rp;o4alxo o3iadlsDemuvo t4 ltnxfcoytfmtr u o;t) eum(m3io1alt  fvi s)s2ra(rpno1oleniieiadlmDraumo (0trtrxociadfpDeaies;()t2umxm3iu1opt lfetl()srrmxronu1tpe moctyd a2elu o;t0tetriocoy1opDrlieils) rxr(m oudlltelivs ( srumxr no1tetomfeiytfs rlnvsn()arxrmfcoo1lmDraivo;()trurim3iydapeemnvsa(f 2rr( pot0oeeo i3ias sDumnms;u) eeoxf to1fatelu s;s0srtrxopiu4amtemictlt aDrm( o;u0tle mieiys mDrau o ()teenxf3oa1oaDeluvs s)s2ur(m oy4alte nctl(  Draxrooo1tex  feiltla ra(mpnt)tlxoirciatfptelnvo s)s2xoio io1ll e ivt tfsrrruronu4apxnio3iytfm uanms t4tltoifcio1lpDrlies t)srxm(m3oo1llt miei sf Dtm(  nu1opx mo3ildlm2elu s u0trtrmfcoydfpDelueo t) 2ur(m iy4om elfcias  Drr(m oo1olx  ietlsfa2eanmo;t4 rxrir3iytfp raues t  exoxr iodamt  fct (  Drrxr ;t1tleoiietys s umu o;(0aexnmo iy1lmDeaivol( teuo(o ou4om elivil()s2ta( o;u1tetn feiydfsDran s;u4trtnxf3oy1fate u i t)teumirpny1op  lnei s  ruaxm ou1olxnio3tlt mDum(monu0 eeomf tadlp  lies;s s2xo(rpio1ope  feil(  2umumo;o4tpxnio3tltlsDeluvp;() renio tydlaDe i i;s0sexm(opio1opte nes s) rra(rpou1opxomociydlaDranvs t)trxniocoy1oatr nei s trurxopny4apeelics t srtru  ot0teeo ietys s2ulnms;t4 rtrxo3oo1oa rau s;s) 2xrim iu1al  mnvtat srururono0aptnmicild s umn p;t4 lerxr3ta1fpt ai o s0t2xrxm3no4apee fet s s2uax pou0apto oeiadlm2eanvo ()aetniocoo1fmDranvils)t2ur(rpoo4oltelnvsat)srtaxmpou4aexoiicias m ul(vp u4 renxo oa1lmDrlivo ( t2trirpio1am nliesls artmxm oo0tee mfeiytlsDumn pnu)alerxfcty1lm e uvs s0s2xo(opoydlmtemfeslt) 2rr(ro;o4aexoiociydlm umnvpn()arxrmfcoatfaDr ivols  2uoim iu1lmee icils) 2tr( pnt0teeo ieilt a el( s u4 leoifcta1opD  u s;s0setoio oo1lpen ietas) rtrxro;u0olenioeilslsDemu o;t)aexrmr3tadfpteaueslt)t2toim nu4opte fvils)aDtau p;o4aexomoeiyd s2rmuvo ()tltoxfctadlpDelueolt  2urir3io1lme lneil(farrm(rpot0oee mfciydfm2eanvp;u0tlxrmo tatfpDrau o;() rum(o oo4omtnmfvils)s2rm(rpoo1oetomiciydfm2emu o (4 lerircoa1oa r i il(0truoim oo4lleemfei t)aDur(r ;u4olen octatfs ua(mp u)tltoxo iydfpD livil() etoir nodlme lictl()arumxr nt0ope moetysfa rl(msnu0aexoif3iydlatr ueol() 2umxr3oydol  lietas aDumump;t4tetoiiciatlsDrmumsn()texnmr3oy1lptelnvo;()s2uo(m oo1op elicta(  Dtauronu1apx iietytfa2umnms u0 ltomr3oadlpD  i i t  etmxopoydap elfvil() rtr(mono4openio3iadlsDel(mo t0 lxomfctytlpte ieo;( s2um(m nu1lp n feiltfarrm(r no4alxomo3iasla ea(monu) eerxf iadlaDe u i (0trxoirpoy4lmenliviltf 2rrur oo4tpen f3ildla2um(vo u)trtnxo oadla rauvo t0 2xr(o3ny4lle lncsat) 2tmxmo;t4tpx mf3tasls elnmsnu0 rxnmf oa1lpDeluvi;(0t2urxr ou4aleelfvt (f Dra(m ot0tltn ociys m rluvon(4aexrir3iadfa rau i;t0 2tr(m nu4lmeemnvsl( aruaum ;u1opxn fctytlaDem( snt4alenmo3oodomtr ieil(0 rurxo oodal eliesas  rrr(r ;u0opt iocilt aDrm(msn(0aexnio todoa rluvols seuo(r io1ol emnct ( sDur(moou4tltnmfeiytlm2elnmon(4tleoio oa1fpDelnei;(0sexrim3oodlleemieta() rtax  nu4tlenioeilsfa em( onu)tltnirciotopte n i;(0 exo(o3oo1opt mfctlt  2tru pno1oee ii3tysfaDrmnvs t) rermf tytomtranvsls0trur(r no1lltnmnctasfaDua(  nt0tlxnmfctldla umump (4arxnif3to1oa rluvo () rtoxr3iy1ll nlivi t)aDtauro;o1tlx ii3iydfm2rmump;(4treoif iodfm elu i;t)truoxo oy4lmte ivslt srtmump;t0tleo ieiltla rau onu)alxrxr iadfatrluvils  rxrirpny1ol emivtat)s2rrxrono4oet iieiat s rm( s;(4alxrircoadfm  au s s0srtm(o nodlp nlfetas)a2tmumpno0texnmoeiltfa rl( p;t0 rxrir tadla rli o (0 rxmio3oudlle lnetl(f ruaxroou0olt  ociyslm em( s;t4 rtrmociatfp   neols0texm(o3oy4am n nvtas) 2rmxro;u4tpxnmoctlsfa ulumsnt) ltnir oa1lat ln s;s)texoxr3nodaptelfetlt arrax p;t4apx mfeilsfa2ulu o;(0artrif3oodfa   uvi s  rtm(opno1lpe  fvsa() rrm(mo;t4tpt iietaslm emnvo () ltnmr iydlatranvo t)tetm(opoydom   ncsasfsDrmu ont1ape moeiat s rlu on(0alxrmrcta1oaD  u ils)t2xmxrpnudopt lnesa(  Dumu  oo0optnifeiltlsDuaump;()tlxrxr oy1opD  neolt) 2tmxr3ny1om  lneils)s2taxroou0aptoii3iydls2ra(vs t)trtnmr3iatopt aueo;s0texmxrpiu1ll emfct sfa2rax  ot4tet  oeiltla rmnvo u)aexrif3tydla raneo s) rur(r iy1lpt  nciltfsDraum oo1aet moetat m elu p;(4tltomf iydopDe ivol(0tetr(mpou4omenlnci t)a2rauroou4aetoiictld s ua( s;u4alxrio3totlpDrlu ols)texr(m3nudlleelnctl() Dur(moot1oetomfetlsfaDeau sn(0tlenmr ta1late neslt  rxmxo3oo4op   ieslt)a2rrxm ot4oexo ieiyd s eauvont0 etoir3iy1la  anvs;t)texm(o oydapenlnvs (f Dum(r oo4oeeo fciydlsDeluvo;u4 etrmocto1lpt lues t0 2xrio3iydlpeemnvi t)a2rm(  ;o1aee io3iyt m2ea(vo u)alxrmf oatlaDrliei t0sruoxo3no4ol  lfetat) rtm( onu4aet micildfs2ul(vp;t4 rxriocootlpDe u o;t) 2toxmpny4om  mfvils aDuru o;u0teenmo3tyt m2um( o;(4arenxo3tytfat liesls  2xmir3iy1al e netas) Dumuroot0ope moeiydla2rlu pnt4tleoxr oadlptrauvo;t sexr(rpoy4ole  nesat  Dtaxmpnu0tpxn fciltfsDumu o t4 ltnmo tytlpD  ivo;s0t2urxo3oo4om elietas) Drm(m no1tpeo oeilsfs rm(vonu)trtoxr iy1oaDraieo;t)srxo(r ny4lme  fvias srrmu pnu4aexn oeiydfa ulnmonu) eenmrcoy1fmD lu i;s0sexmxmpno4am   neils a2umur ot0aleomiciadla2ua(ms (0trxnio iytlmt  u il(0srxoiopnu1omt  ieslt) Dum(r no4apt mfcias a2ran s t4alenxf3tydoa r i sls srumiopoodomeelnvslt)a2uauront1alt  ietatfs2eau o;()trxriocto1om  auvi;t0 2uo(o iu4lmeelfvsls) 2raurpno0tpeomi3iltla2rlu snt)arxniocoydfa r ivi;( sruoxo3iudal n icsa( artmu onu1tlen i3iatfaDeaumonu0teenxr oytlmte ieilt)setr(rpoodop emfesas) Dtm(rp;u0aex iiciltlm2uau o u4tltnxr iotlmD aivi;()t2uo(o3oo4apee netls)s2um(ronu1tex  o3iytfa rmn o (0 rtoircoy1opDe ivils teuoir nodalen nes () 2uaxrp;t0teenmo3iysls2ean s;t0trxnir3tydlat  ues;s0 2umxopiy1al emfcs sf Dtmumono0oex mi3ils aDrm(vp;u4 rxrxf tytfmt lu sls0sruoxo oudolenmnvils) Draum ;t1texnmieild m rmnmp t)trtnifciy1oa  luvo;s  2xrxopiu4omenmictat s2tr(rooo1olen ietytlm ranvp;t4trxnxrcoytoat  ies;t)trtoio no4oltnlfvil(fartr(r ;u0tptoio3iyt mDumnvsnt0trtrir3to1fpD  u o t sruoxm3nu1lm nlnvsa(fsrumx  oo0apxnio3iadla2ulnms t0tlxomf iodomtr ivo;s srxoxo oydlm elnei ( a2ua(ro;o0tpx io3ilt sDean snt4artrioctodlpt auvils0 2trxr3ou1ap nmfvtls a2rrxm nt4aetn icilsfa umn sn(0aeenif to1lpt an ils0s2xoxmpio4op e feils aDtm(r ou0teto oetydla rmu o ()aexrir3iotlmDeaueolt) ruriopiu4ll  lncsat  rum(rpnu1alx mf3iadla2rlnvs;t)altomo to1op eaiei ()t2toxrpnu4lltemfcias  rum( pnt0ale  oeiytfmDranvp t)alxrxoctytoat an s s seuoio ou4aleelfcia()srrmumono0aptnif3iasfs2ranmpnt0 renmrcoy1la  au o t0 rxrxrpoy1lptelict t arurxr ou1opxnmfcildla ra(vp;u4aetrmo to1opt  n o;t0setmio3iy4ale lfvsl() rumum oo0tex if3iat mDea(mo u4 eermr3iadoateluvo;s  2xmio no4ape mietat sDra( o;o4olt  oeiatlaDuau snu0 exnmo3oatfp e nesl() eurir io4ome mfeiat a2um(mpot1aptomictlsfm rau on()aleoioctadfa r u o (0s2umio3oo1alt mfeiatfarraur ;u4oetnii3iadfaDraumo;t0 exrxfctydfmD an sls)srxmiopoodole mietls  Drm(m ;t1tpt  ieias m2ul(vp ()altnmf3iatlp r uei;() rtoxm3nu1opt  nci ( arrrx  ou4tltn oeiasls2eluvs () leomfcoo1fpt  nvo (0teuoxr3nu4apeelnei tfsDrrxro;o1alto ociys m emnms;(0aeerxr iytfm  auvi (0t2tm(o oy1opt  ivsls s2ta(m nu4texo iciyt sDul(vp u0texoxociatfa r u s;s0 rto(opiy4omte ivtas aDtax poo0tex ioeiasfa eanvsnu) renmf3ty1oatrlnvs t)trxoxopoy1om emivias aruau poo1opxoifciyt a ra(msnu4aexnircoo1opDeluvs t s2trir iy4amt mnesl()a2uau pnt0alxn o3iat m2ran s;t4alxrmr oadopDean s t0sexo(r3iy1llt lfctlsf 2rmur ot0tptn ieilt m eanvs;u4teenio oadomt  uei s texm(mpoy1al e nes tfs2tmumonu4opxniicias a2um(ms;t0trtrif oytlptrauvi;( srtr(m nu4alt  neil()s2raurp;u0aexn f3tat a ea(mp t4trermf3iotfmDeai s;()truo(mpiy4ll elivsa( sDururpnu0tet  ociydfs2rlump;u0altrir3oadoptr iei;s  2to(o3ou1alen ivtat  2ta(mpot0apt ifctltla ea(vont0alxnio3oytfatrlues;t)setrimpiodlltnlfci s arumx ono1tpeomfetls mDumu o;t)teenxf oatfmteanvi t) rto(rpnu4omt mnesls) 2trumpou4tet  ieias mDumn pnu0texoiociatomtr u o;(0texrirpnodlm e net t) 2taumpno4tltnmf3iat a2rl(mo t0 leoiocto1opD aieol(0tetmim3oudaptnmici t) 2rm(rp;o1aptnmociltls2uanvo;(0aexrmo3iotomD aies s)seurim3oodoptelfviltfs2ur(ro;o0ope ioetadls2uau s;t0arxnmr3iodoa e u o;( seuoxo3iu4amenlfvia(  ruaumont1tpt moeiltfs2rm( p;u0aexrxf3iatlpt ln i s)srumxmpno1ape  icils arumx o;u0altnmfeiasfm2uauvs;(0 exnxfciydlaDraieo;() exmxo3oo1omeelfcia(  Dururpnt4tptniiciltlaDemn pnu4 rxrxr3to1fm  li s t0tetrim ny4lltnmies ( aDum(mpno1oee mo3iltfm2umumon(0tltomrctatfpDr nvil(0 2xo(opiu4ole mfcia(fsDuax pno0apxomo3ildla2rlums;t4alenifcia1oa  li olt) rxmxo iu1olt lfcsasf 2umx ooo0tpeo o3iydls ean s t)trenxrcoa1laD anvs;s teto(opou4lltelfesl( sDrax  ;t4oleomfetatlm2rmumsnt4texrif3to1fp rliesls)texmim ny4omenmneilt s2tm(r ;u4tpt if3ildfmDrmu s () ltoxfcta1fmDeaieolt  rurirpiudam elivias)s2urum no0tlto fciys mDemnmo;u4 etoiocoodopDeanvolt  rxr(opoodapee nvil()a2uaxm ;t0apxomi3ias a2ran s;t0tltnxfcio1lat ai i s)srtoim3iudapenmivi t) rta( p;t4alen feiltfaDrm(msn()teenxo tytlm e nvs;() 2uoio nydoltnmncsasf Drmxrp;t4olt  o3tysla2rmn p;(4altrmocoydfm e iei;t)t2xrim oydlp n ict ()aDtrxm ;t4apxn fctyd a2rln p t)altnio ia1lm  lueol() eto(o3oo1llenmfes s)arum(  ou0olxo fciasls ean o t4 ltomoctydopDr ieilt srtrio3oo1ap elncs sfa2trurpou4altoifeiasfa2umump ()aexrxr3to1fa  ai o;(0s2xoir io1lle micilsf Dum(r ot4tptnii3iadls2rmnvp;u)aeermo3iadfa  lu i;(0t2uo(o3iudlle lnctas) rrmxmpnt1optnmf3tadfs2uanvo;u4tetoxfciotlpteai sls  eum(r3iy1amen nvi t srtrx poo4opx mfciltfsDemump;t)alerif oo1lptr neols0 2xrio3no4llenlietasfsrua(r nu1aexomoeilt a2umn o;()altomr3io1oa   u o s)srxrxo3iudope  netl(f 2tm(rp;o1open octasfm2eluvsnu0 eermo3ta1lat auvs s  2tmxo oo4apeelfcil()aDrrurpot0tet mf3ildla2em(ms;(0tlxrio ia1lmte iesl() exr(r3oudlpt lfvias)aruaurooo0alt  f3taslmDean p;u)tltomocoatomD  u s (0srtoimpnu4lleelfvsas)sDtr( ono0oet ioeiad sDua( onu)alxnmr3oa1lp e ieslt)t2um(m oo1ale mivtas)a2rr(mpno0apt  feilsfm ul(vp t)texrifcto1latrau i s0sexmim no4lpt  fei (f rtrxmpot1teeomi3tydlm ra( o;u)arxrmfciydomtrlu o (0srto(m3ny1apee nct s)sDtrxm nt1tpx if3ild m2ranmpn(4trerxo oatfp  lu o;t0t2uo(m oo1aptemfvslt arur(m no1olxo o3iltfs2eln pnu0alenircoydoa e ieolt0s2um(m3oydomeemncia(f 2uaxmoou1texoif3iltla uaump;t0 etnir iodfmteaivi;t0 rurirpny4om nmnvi (fs2um(rpnu0oee  o3iltfa el( p;(0alxomf oa1lmDe uvs s t2xo(opiu1omenlnvt s)sDtmx o;u1opt micild a2rluvo u4tltrmf oy1op   uei;s0 etmirpiudopt mnvsa( srrmur no1olt if3tys a2emums;u4texnir3to1fmteaneil(  2xm(m3iodlm emieil( s2ta(mp;u1tpt  oetatfa rl(ms ()altnmrcoydlm eaivo;t0s2toxm iy4oltemfet ( aDurumo;t1tptnii3iydfmDraumo;(0aeeomr oodla  auvo (  rxr(r nudamenmfvsls arta(r ;t0tlt mi3ias aDrmn p;t)aetnio tatfa eanei;s0seuoxopoy1al n nei ()arur(rooo1oeenmictas s ua( pn(0 etniociydopD  ues;s) 2uoxopnudlle mfcs sf rum(root0tlxnmo3iaslm2uln p;u)tltnmo iytla  luei;s  exmir ny4oleelfesl( arrmur ;o0aeenmfctasla2emu o;t0 reoxo tatoptr u i;s) 2umxo3oodame livtlt)srtaum nt1tpe  feiydlm2emnvsnu)arenir tatop raues;(0 rurxo3nydamenmfvilsfs2tm(rpot0aexo feiadla emu s;u) ltnmrcoy1fa  ai s;s)trxoxopno1ap elfesls  2rrx  no1olxnio3iasla2em(vp;(4 lxrmo3ta1la elnvo s0srto(r3oo4lle mnci t) Drmu  ;u4apeoiociasfs rlumpnu4aetnxo3tydla r nvo t0t2triopno4op nmfvs (fsDumxrpnu4aexo ietls mDelnmsn(4tetomo3iadlaDeai o ()t2tmir iydlmen ivs tfaDtaxrooo4texnmieiatlmDeauvo u4 exnmrcta1faD  uvils srxr(m iy4lp  mnvtl()a2tax p;u0tlxo ocildfa umumont4tlenmociotlat  nvi;( s2toimpoy4aptn fei tfs2taxmpnt4olx ifciytla2uaumpnt) reoif iatlaDe ivo s srtoxr io1op e nvsl()aDrrx ono4alt ifeild m uanmp;u4 rerifciodfmDr ivo;t t2tm(rpoy1opee nvtat) Dur( pou0oex ifeild sDrlnms;(4artrmo tatfaD  iei;s)t2uo(mpiu1am emnesa( s2umxm ;o4teeo ieiatfmDumnvp u0altrxfctotla   uvo t  euoimpoy1lpe liviasfaDtr(ro;u4apxoii3iytfa2ul(msnt)aetnxr3oy1lpt  ivi;() exrxr iodal  miciat sDtm(m ;o1alx mictytls rmumo ()arxoxocto1fmDe uvi (0tetrxr io4ome  ncil()sDtrxr ;t4oet  f3iydla eluvs u0tetrio3iodla eanvs;()tetoimpnudopt  ncta()s2urxmp;o0tptn f3iltlm2ulnvp;u)alxomo ta1om eaneols0srtoiopnodopeelfes (f rtmuroou1olto o3tyt m2rmn o;t)arxrio3oo1opt  n slt trto(o iu4alen fcs sf rraur nt4tet  i3ilsfmDrl(von(4 rxrmo3iy1fpDranvsls0srxr(rpny1ll n nviltfsDum(mooo1olxo i3iadlmDumnms;u4aeeomocoo1fat ln sls  eurxo iy1llenmnvtls) 2ra( p;t4tltomociltfm rlums t0 lxnxr iadom   nvo;()t2trim3iudoptn icta() rtrxmo;t4tle  ictlt m2uanmsnt0tlerxf3tytoate uvi;s0 rumir iudaptnlfcsasfaDrru p;o1optnio3ils s rlnvp;u4alenxocia1fa eaies s s2toxm ny4am n nviasfsDrm(m nu4oeeniocildla eauvo;(4trtrir3todlaDe ueil(0t2tm(m3iy4openlnvi t)srrmur ;t0texomoetlsfa emu o ()tetrir3ty1lptelieo;t0t2ur(m3iy1ap  licta() Durxmooo0aleniicilt aDeauvp (4tltoif3iotfaDeai sl(0truoio3nu1op n nvt ( s2umu pnt0tltnioeildlsDelu p u)aexrircoy1fate ivo s seuoirpnodal e fvsltfaruauroou0olxoiietasfs umnmo;(0tleoxr3ootomte nei (  2um(m ny1lmee netas)a2urumont4aeen i3tas aDuaump t4tlxnif3iytop   uvi t0 exo(rpno4lmtnliviltf 2ta( oot0oleomf3iltlm ulnmo u0arenir oodomD lnei;s s2xoim3io1lm nmneia()arumu ont0ole iocildls2ean snt4altomf3ty1lp rauvi t0 exoxmpny1olee fetl()srrm( pou4aleomoeiysls2ulnmp (4 etnio3iydlptran o;s0tetmxmpoy1ale lictl() rraxm ;u4apt  f3ildla2ea( p ()aexnmf3oytopDr ues t) exoirpou4open ietlt sDrr(mont1tleoii3tad mDea(mp (4aexnxo iydlp eai s;s) rxo(m3io4lpenliesa(fsDtmu  ;o4opeo f3iasfs emnms t0treoio iadlp raiesls sexm(opiydap elnvt ( arum(m no1tptnmiciydfa ul( sn()arxomr3tadfate uvo (  rxrimpoo4alt miesls  2rr(  ou0tetn iciysls ul(msnu0tltrif iydoat luvo s srtm(o3nu4olen ieiat)sruaurono4opeo oeiys m2emnmp;(0arxomf todfp eanvs;t)srto(rpoo4ap e ncias)srtrumo;u4apxnio3ilsla uluvo;t0 renxocta1opteln ol() etoxm3oy4ome mncslt sDra(mo;o0altoioctldfm umnmsnu) etoif tadlptr ueolt0 2xmxmpiy1lm e nvi sfsrururpot1oexo ociydls umnvs;() eerir3totfaDelu ilt)texmxm3iudll n fcs ( sDurum no0olxn oetadlm el(vp;()texrxo ootlaD auvo t  rtoxo3oydopee nesl(fsrrr( p;o4olxn iciys s2emnmp (0 reoxf3oo1opt aieo t) rtrim3iodol e fcsa( srur(m ;u4oetniociadfa2rlnvo t0areomo oydfptelu o (  euo(m3oudame livs t) 2uau onu4alxn ieiyslm ua( pn() exnmo iytlaD anvslt0 rxmio ny4amenmneil()srra(rp;t1oetoifcildls eanvo (4aexnxo3iydlpt  n s t)srurxrpou1om emfes ( a2tr( ont0oexo ociatlmDea( on(0 exnxo3oadoaDrlnvo t0 etmxo3nu4alen fctat) 2rr(r ;o1apxoiocias s2uauvsn(0artomo ootomD  ivs s)truoir3ou4ame mnci s) rrruroou1tpxn iciyd m2rmnmo;() lenmfciadlaDeluei;()t2tmim nudop nlfes (  2uau pno0alxomietytfa2rlnmp;t)alxrmf io1lateanvs;s) 2trxr ou4ol   nes s s2um(  ot0aetnifcils a ranmo;t4 exoio3oa1fa rlues t seurxr ou1ll n neslt  Dtr( p;t4aeeo i3iadla ea(ms u4 rxnxocoytfaD  ivs;s0s2tm(r ou4ll nmnesat) rtruronu1olxo iciltfmDean pnt)aetoxo3iydfaDrluvil(0teuo(rpiu4ll emfesl()aDrru ooo4oleoioetatlm emuvsn(4aeenxf oatomDelu ols tetoio iudolte ieta()srua(rono4texn octasfa2ul(msnt) lerxo3ia1lmt luvs;s0texmxo3oy1lm e nct (fartm(  ot0oexn o3iysfm rlnvpnu0aleoif ia1omt  neo;s  rxo(r3ou4om elietl() 2rmxmoou4teenmiciydfs2eluvpn(0trenxf3oo1fm r i i t s2xr(o oudlm e nvt ( aDumurp;t4aeeo iciadfaDrm(mo t0 rerio3io1laDe uvslt  etoim3iudol  mfeia()aDrmxmoou1tpt  oetasfs2raumpn(4 eeoxr oatfmt luvi s  eur(mpio4lmen nviat) rurur nu1altomf3tatlm2emump;(4aetnmr io1faDraueils0 2tm(o3ou4amtemivs s)a2umx  ot0aet ii3iltfa ulump;t0artnmr oy1fp rlu ilt0setm(mpiydamtn nei t)srur(  oo4olt  ictyt a rmu o t0altnmo3iotop ranvs;s0texmxrpiu1am e ictlsf Drm(mpnu1teto f3ils a eanvp t4tlxrxo3oytla ranvils)s2urimpou4ap e nci
\ No newline at end of file
@@ -0,0 +1 @@
+uvi;s)t2tmio iy4olenmfes ( sDtr(mpno0alx miciysfm2el(vs;t4 exomr oo1opD  i o () euo(rpio4lp  mfet s)srumxmo;o0apxoioetydlaDua(vsn(4alxomocta1omD an il(0teum(m ou4ameemnvtatfsrrruroou1ale io3tltla eln p u) exnircoy1lp  li ilt0 2trxmpiudapt  icsltfs2trxr ;u1tex mf3iatla ulu s u)aleoxr3iatopDeluvols0trumxm3iudom elneiat srrax pno0oleomocildfmDuan onu4alermf iy1laDean s t0trtmxr oydomt  fei ( aDum(r ;o1tlt  ieiltls2umums;u) lermociadfp e u ols)t2um(o iy1om elnct ( s2umxr ot4olen f3tad m em(ms (0tleoio oydomDrlnei;(0s2xmxm ny1al   fvsltfs2rmu oot4teenii3ils aDuauvp;t)arxnmf3oo1faDrlueslt trurir3oy1olte fvi s)a2um(rp;o1apxnmi3iatfs rmump u4tleoir iydlmteli s t srum(mpoudale livsls)srum( ono4opx  fetlslsDrmuvsnt4areoxfciotop rlneols0 euo(m ny1lm emieil(f Dtru p;u0tlen oeils s rlnmo (0artnmf3io1lpD  ies (  2uriopio1al e iei s)artax ono1tlxoii3tyt s ulums u4tetnmrcio1lp  aivols)texoir3no1ape mnetas s2umxmpoo0aex  o3iydfsDum( pnu0arxrmo3iatla e n s;s0srtmxm iudame mfctat s2taxmono4apen octasla2rmnmo;()trtnxf3ty1op rauvi;s  2xrio3iu1omt lieiasf 2umxrpou4tlxniiciltfm ra(vo u)tlxnxrcoatopDelu i;s trtmiopnodll  lfetas  rrax p;t0aetoif3ils a2uauvsnt4trerif3tytfm   nvo;s t2uo(o iudol  livs tf rur(mo;t4oee  o3tld aDumums (0 ltoxo3oydlpt au o;s0teuoir ny1omtelietl()srtr(r no1oleoio3iltfaDul(vont)aeenmrcoydoa   u s;t) etoxo oo1lltnmncta(fsrum( ont4opeoii3iysfsDum(mo;u0 rxnxf todomtr uvs ( texoirpnydopenmfvs tfs2raxrpnu1tpenmi3ildfa2emu s u)trxrxoctatomt lieo;t)s2toiopny4am  mnei t)artruroou1tee mi3iatfaDrmnvs;u4 rxnif iotlptelues t0seuo(o3nu1ope mfcslsfs2raum oo1tex mfetytlm emumsnt) leoxf ia1fa e nei t0s2to(rpou4omt  fcs ( srtaxrpno4apt io3iytfa emnmp;t) eerxf oy1fa r n s;(0truo(mpiydop elivsat) 2rau ono1oeeomfeiytfs2rlnmo;t)aeenif3iadfaDrlnvol()t2tm(rpoodal n ivsa(fartr(r nt0tpen ocils m2el( pnu4aeeoxf3oo1lpDe nvils)trumim3iy4lltelivtlt sDumumont1apto fciys m2uln s;u0tltnmfcoodfatrli i;()trtoxmpoo4ale mfvt s  rtau poo0tlenmietyslaDemu s u) lxnio to1lat luvi ()tetmxm nu1amee fet t  Duaxm ot0optnmfeilt s rl(vs;() lxoircoodomte ies;( srtm(o iy4lmtelfeilt a2tr(mpoo0oetomoeildfa2ulu p t)alxomfctotop raneilt)seum(o oudope mfcil()arurx o;t1alxn octlsls2eau on(4aexrxf3oa1omDrau sl(  rurim oy4olenlivi s)a2raum nu1ole iictys m2ra( o;t4arxoiociy1omtr nvi s0sexoiopiy4om e ivsa(  rum(moou1opt  fctys s uaums;t0aeeoxr iydfa rlivs;t0setmirpny1lmenmieiat)a2umuronu4tetomieiad mDua(ms;t) exnmf totoa  auvo;( sexoiopiy1lmt mnvtl( sDua(mpno1alenif3tltfm rl(mpn(4aeermfciadfateluvs t)texmimpio1lmt mfcta( arrmuro;t0apt ifcilsfaDelump;t)tlxnio3totfmDeln s s)sexo(mpiy4apenmncils s2rmuro;t4tlt ifcilsfa rmnmsn(0alxrmr oy1fmDe u i;(0sexrxm iu4lmte iet s)srtrx o;o1aetniicildlmDrlu o (0arxrxo3oa1fpDran i;(0sruoxmpnudalte feta() 2trumont4opxo ieilsfmDrluvo ()alerxr3ootomt aueo;s0t2xrxrpoydolen fvilt)arum(root4optniietytls raums;t0tetnir oo1lmtrlivols s2xrimpiu1ap   fcs tfa2urumo;t4tlxnmiciydfmDum( o (4texrxo iadfa r uvi;s)seuoxm ny4open nes sfsDururpnt1tpto ictadfa ua(vs ()tltrxocoydlptrluvo s) 2tmxr iy4lm elfcs s sDur(m nt0oltomoeiat sDea( pnu)altrxo totlmD luvo ( srtrxmpiu1altn feia()aDum(ro;t1tle moeiys a2ran o u)arxoxfcoy1om eli ols0 eurim oy4amtnlieiasfaDumum ot0tpeo i3iatfs2rm( p;() etnmf3io1opD luvs;s  euo(mpnodameemfeil()a2urx ont4teenifetasla ea(vo u)trxrxocoytopDeanvslt0t2tm(o3oudole liei tfartmump;u1tpeomfciytla2rlnvp;(0 exoxf3tydfm rlivi (  ruo(rpiudlm nmnesl(f rrr(mpnt1openio3iaslm em( p u0 ltrmf3io1oaDe i s s setoxr3iu1ope mnvtat aDuax poo4olenioeiyt s rauvo t) rxomr3totlatelu o;t0t2to(o3iydam n icsls)srrrurono1aex ifeias m rmnvo ()tetomo3tatom rauvi;(0 2xmxo3oy1ape lnvtlt  2umx onu4ope  f3iatlsDem(mpnu4 rtnmo tydomtrliei s  2xoxo iy4ameemneil() 2um( pou4open oeilt s2ra(vp;t)arermo3tydfa ran i t srtmxo oodlmte icsltfs2umxronu0alx if3iltfaDrlnms t) etrmr3oytfmD  uei;s)trxo(rpnodlptn feiatf 2umur ou1apen ieiltlmDrmump t4altnif3iotfmDe n i s0seumxo iy1lp e nesa(  2rrx ono0aet mi3iydlaDem(vo u) exrmf oadop r ivs;s0s2tmxr3iudlptelfet (f Dtm(rpnu4aleomf3tldfa2ulu o ()tltnxr3tadfp   u i s) 2umio iu1ape livtas)sDrru oou4tlxnii3iadlmDem( o u)tlxoxf ta1lmD  uvi (  rxmxrpiydamtnmnvs (fa2umum oo0aex  fciysfa2um( p;t4texnmoctytoatrai s;s0t2tmio iy4apt lfeil(fsrrmx pnu4aptnmi3iasla2em(ms t)arxnmo3oo1oat lu o s  rxrxo ou4oleelfci t  rurx pou0olen fciatla2rlnvp u4artoir3iodfaDr iei;s0srurxr3ny4omeemfvilt)artaxm ;t1tlxnif3tlsfsDran s;t4 lxnif iotlat  ivol(0 rtm(opno4al emfesasfaDtrum ;u1apt iieils a2eluvs ()teenxf3tadfp rln i;s)trumirpiu1lmtemfetat  Duaxr oo4tpx mieiydfm2ea( s;(4 exnif3to1laD  uvol()srxmxo3ou4ap  lici t s2ua(r ;o1alenmo3iasfsDrmn p u0aeeoircoytomt  u i;( srxo(o3oudome mnet tfs2ur(r ;o1tptomf3iydlmDumnmsnu)altnmocto1fpDeaivo (0truoir oy1altemncilt)aDta(mo;o4tltomf3tasfaDraums t0 rxoxrctytoaDe uvilt) 2toirpiodll  mfes t)arra(mpnt0alxoioeiatlmDrau p;u4 rtoxfcootfm e nvs;s) rtmxr3oo1omte fvi sfartmxr ;u4openifctysla2rmuvo (0 rxrxociadfmt auvsl(0setoir3iu1ame lnvils  2um(rpou1texoio3tldla rm( pn(4trxnmr to1lpD an o s  2ur(rpoydolte fvs t) 2urxm ;t4opxn ietltlsDranvp t)tlxnir3iy1lpteanes;s s2umxm3iydlpeemivs ( sDururpot0tlxnmociyd mDrln p;u4 exnircoydfaDr nes;(0s2xmim3ny1opeelict s s2umumpot1apenif3iat sDrln p u4tetnxo totlm e ueo;s  eto(m3oy1lpenmfet ( aDtm(mooo1tlen ietytfs2uanmo;u4arxnmr3to1lmD li o;s tetmxr iydop  mict ( s2tm( pou0tltn o3ilslaDumnms t4tltnio3oodlate uvi s0 euoim oo4lmeelnvsls) Dra(r nt1olx  f3iyslsDeanmo;t) eenmf tadopDr iei;t0t2uo(m3oydalte netlt aDur( onu1aet  octatfaDumnvp u4treoxf oo1omt  ues;s)srxoxm3no4lpe lfes t sDtax ooo1alt ioetydfaDrmn p (4trxrxf tadlm elivslt) rxoxr io1ll emnviatfa2trur ;o1teeomi3tls a emu s;(4aetomo3todop eauei;t) rur(mpoodaltn fcs t sDtmxmpnu1tlxomfciadfm el(vpn() eeoio oa1oa rai olt setr(m oydom n nvi t srrmumpno0alxo o3iat sDeluvo;()artrifcoa1latrlivs;()seur(r3nu4lp  lnvt s)arrrxrpnt0openifetas s ea(vs;t)texrxo ty1om r i i ()teurxr3oudopte nvtasfs2ta(  nt4opx iiciaslm2ran p u4tltrif totlmDr ueolt0sruriopoy4amtnlivil() Drmumoot0tet  feiat m elu p;u4texrxrciatlat luvi;s)setm(opoodlpt lneilsfsrrmuro;t4optomfciysfs ulnvsn()aeenxrciydomt livi s0seurim oo4ol   neiat)arrrurono0tpe  oeiadfaDrl( p u4aeerif ia1oaDelnvi t0texr(r iodal nlfei () rraxrpot4ope  fcilsla el(vs;u4altnif to1op e nvilt0 2tmir oo4op n fvtls arrrxm ;t1opxn ieias a emu pnt4 rxomfcty1lp  auei;(0t2uoxm iu1am elnvtl(fsrrrump;o0alto octatla emnvon(0artomrcto1fmD livs t0sexoir3oo1llenlict s) rtaxro;o4alto ociadfm2ra(vp u0tlenxrciadlatrau o (0truo(o oydaptn nvta() rumurooo4apenmiciad mDem(vpn(0aetnir tadlpDr nvslt texmxo3nu4lmt liesat aruaxmo;u0oex  i3ilt a elumont)tlermr3tadlm   nvs t) rur(m3oydlp nmivtl() Dtr( o;t4tpxn ietlsls rln p;u4arxnmfcoy1fmteaivo;s0 rxmim3oo1optnmfeiltfs2rrx o;t4aetnif3iadfs2el(ms;t0tlxoxoctadfa e iei t s2toim3oudal nmieias aDtm(m ;t1oexoifciyd a2rln onu4aetomf iy1oat  uvs t0texr(r oudam n nvsa(faDrrxrp;u0olenioeiytfa eanmp;u) lxrir3oadfat lnvs;( seuo(mpoo4omeelics ( sDtr(r ;o0tetomfcilsfm2ul(von() eermf oa1oa rauvs;s t2uoirpnu1lmte ietat)a2rrumono4optomf3iyd a ua( sn(0aleoio3todoatr neslt) 2umim3oydoptnlicia() Dtmump;o4apto ietat s elu s t)altoir oydopteauei;(0 eumxopnydapeemnvtl()artau  ou4opx mf3iltlmDea(mo (0aeerir iodop r i sl( trtmxopiudol e ieil()s2ururoot4apxnio3iyslmDea(vsnt4 lxoxf tatoa e uvo;t trxo(opny4apee fciat) rua(m ;o1tlt ifeiasfs ea(ms;(4aetoirciatopte n i;t s2toiopoo1amt mnct sfs2ra(rpoo4optnmfctas sDea(vp t)aetrio3oa1fa  luvols0 rtmio3nydame mnet t) Dtaxmoou1altnif3iydls2uln o;u)trenif3oytlmDeln s;s0t2xmxo ny4lm  liviat sDtmxrpou1optoifetatlmDrau p;u0arxnxf3iodfa   ieo (0sexr(m3iodol  micia(fa2raxmoot4aet moctatlm2rmuvs ()arxoiocio1oat an s;s0trto(r3oudll emfeia(fa2ua(rp;o4apenmi3tyt s umn pnt0alxrif ta1fpDeli o t0 eurim io4om nlfci s srumxm ;o0tlxoii3ilsls2rl(vs t) exrxfciatfpD li s;s)trurim nu4om elfcs s)s2um(r no4opeoif3iasfa rlu pn()tetoiociydomDr i il()trxoim3iu4lpenmictl() rrm(mp;u0aeeomf3iasfs2ra(vo u) rxrxr ta1la e uvo;(0s2uoim no4lleelicsltf 2umxmp;u1tptomi3iyd s2umn pnu)arxnio3totfmte ivsls) 2trio iodlm  mnctltfsrua(r ;t4tet ifetas m rau o;u4arerxr ty1op eaivols0teum(mpoodllenlfciat)arraurpou0oexnmfcilt s umnms;(0 lxrmo3ty1omtrlieo;t0trxrxm3ou4ll emneilt)a2tr( ont0oee  icilt m2rm(vs;(4 rxrxrcootoateluvs;t)s2toxm3nu4aptnlfci s  2raumpou0apeomo3iat a uauvp;t)aetoirciadfptrlies;()trumio3io4lle lnvia(  rtm(r no1tee  oetlsla uanvp u) lermo oo1opD anvi;s s2uoim3no1aptn ncs s)s2rm(rpot0tptnmfetysla2ua( o (0texoxr3totoa r ivolt t2xmxo iu4lmtn ivtlsfs2uau pnu0tlx mf3iadls2uaump t) ltrxf oatfa  lieo;()t2uoirpoy4alen fvi ( aDrm(moot4aetnmfeildlsDranvs (4 rtomf ia1fm rln o;(0srtoxmpny1alenmieil() rtmxmonu4tpx  o3tasfs2ea( onu0aexrxf3totoaD au i s tetrxr no1lmeeliviltfaDta(rp;o4tlen o3iyd s elnmsnt4 ltnioctodfmD aneols0 2tmxo iu1ome  ivia(fsDtr(ro;t0opxoifeiyd s2rmumont0alxoxfcia1fa rai s;t srur(m nu4olenlfetl(f 2ur(m ;u4ole  o3iat m rlu p t) rxrir3ia1laDrai olt)tetoio3nudll  mfcsat)sDuru p;u4oeeoioctys m eln on() rtnmo iydlm rlues;(0srxmxrpny4ll elnvsls sDtauro;u4olenifctls a ea(mpn(4areoxr ty1oaDe ieo;(0texmim3no4om  mieia(  Dtr(roou0oltn o3iysfa2uluvsnt) etrmr3oytlmDrlneo t0t2uoir3nudomtemnvt sfsDtru  ;u4oex  i3tlt s rmumpnt)trermf3iatfaD luvi;t0trtmxm iy1omtnliesl( s2uru  ou1aetoiietad m2ul(mo (4trtoxf iadom  lieo t0 etm(o3no4alen iet ( sDrr( p;t0apxo oeiyd a ra(ms t0 lxrxrciatlp  au olt)teuoxopoudomenlneil()a2ta(r nt4tleniietydfsDumnmsnu)arermo tydfa  au ils)texoim3nudam nmfes s  2rmxm ;u4opeoiietlsfm elnvo ()tlerxfcoydfm  lueo;t)teto(m oodlpe lncs s s2rmur no4tleo feilsfs2ua(vo t)teeoxf3iodlpt aueo;(0srxr(rpiydlpenlivi (f Dtr(rp;u1tle ifetltfs rluvp;u)tetnxr ty1fa  luei ( trumxr oudlpenlics tf Dtaxrpnt0opxnmocild s umumo t) etoircoatom  lu ol()teuoimpiydapenlicias srrr(ro;o4tleomieilslaDea( s;t4tetnxo ty1la rluesl(0trurxm ou1om emfctlt artrxronu4oeeo ociysfsDumump;t)texrmrcoo1lmteaivo;()srxmir io4opt  fet s  rrmurp;t0olxoioetldla2umu sn(0 rermfciodlat lu ils truoiopio1amtnlfvt s)srum(ro;t4oexoioetyslsDea( p;(0alerirctadfmDrauesls)trurir no4lptnmicsl() rtrxr ;u4aex mf3tlslsDraums ()artomfciotfpDean o ( s2xmxrpoydap   nvsat arra(m ;o0apxoiieiltfsDumnvo ()artnxf ootlm   n s s0 eum(o ny1omt mies t) Dtmum ;o0oltoiiciadfa2rm(mo u0 ltnio3iatlmD lneo;( s2xoxm3no4ap n fviasf 2um(rpnt0alt mfctlsfmDelumo () etnxfciydop   uvi s  rum(o iy1oltn ietlt  rumum nt1aet mf3tas m2ul(mo;(0alxnif oytom   n i;s0s2xrio3oudlmt lics tfs2rrum ;u1optoifctlt m2emu s;t0 lxomo3oa1fmtranes;t  rtoirpoodlleeliei ( aDtmu p;o0tpt  o3ilsfm uanvs;t4 rtoir3iytfaD  ues (0truoxo3nodlm nmicilt a2rmxmpno4tetniietadla2rauvont)aeeomfcoytfmDrluvs;s0srto(r oo4lp emiet s sDtrxr ;o0aex  o3tyd sDra( ont0 rermociatfpDeluesls)srxmxmpnodopeeliei t  rtr(  nu1olx mictadlm2ea(vsnt) ltnmociodfmDrlieilt)srtmxr3oydol   ici (  Dtax  ou4oltnmfciysla2ra(von(0arxoxr iy1opD au s;( srtoim3nodame lnvtas aDurxmoou1opxnmiciydlmDulu pnu4tlenirciodom rln o;s) rtrxo3ou4al   nvtltfarta(mp;t1aetnmoetls m2rlnvp t4alxrir3iodlm r ivsl(0s2tmiopiydop e nvtasfsDraxmpno0teeomfeilsfmDrauvp;t0tlxrif3iytoaDr ueil(  eumxrpiodlm emncta(fartmumo;u4opx iieiyd m eaump (0tltnxrcoa1fa e iei s trtr(o3ou4ope  nesa( aDumu  ot1opxomi3tyd s rm(vs;t) lermrciadfmteau i s  2umim iydopenmfet sf rrr(rono1aptoioctls mDran ont4trermr3oodlmteanei;()teur(rpno1aleemfvsa( s2tmxr ;u4oeeo f3tydfm ra(mpnu4aeerxo3oodoatr ieslt t2urxopno1op emnciat  2umx pot0apenmfctlsfa2ulnmo t)alxrxo oatopD lu s;(  rxm(o ou1ol nliesltf Dtmxm ;o0tpenmfciadfm ranvo;t4 eenmr3ootlpte nvolt)t2xm(o io1amtemicslsfarrmxmpot1tet if3ilt m uaumo;()aexoxrctydlmt lnei () 2uo(opoudlpe mivi tfsrua(mooo0olxomf3iaslm2ea(mp;u0 rtrir3ta1lpDeln s t)teuoxopnu4llt lnciltfaDumum no1apxnifetltfmDrlnmp u4 lxrio3iy1faDean i;t0texrir oudameelivsls)s2raumpoo0apt mf3iasfm ul(vpnt4tlenif3ootfpDr iei;s0sexmim3iudllte nei sfsDta( oou4tpxo oeiatls elnvp (4 ltnio iotlp eli o;t0t2trxm nu4ap nlnci (  2rrumpou0aexomo3ilsfa2elumonu)alxrxr3tydfaDrauvil()trtmio3iy1ome lnvsa()arum(rpno1opx  f3tlsfa2el(mont4trtnxf to1lmDelnvo s  rumxo3oudolenmncils)aDumum oo0aetnmf3iyd mDua(ms t)aetnircoydoa rlnvs (0t2urxrpny4am   fvt tfartrxro;t4texo ocilslmDel( p t)texoxoctodfaD ai o;(0sexoxr oodalenlieilt)sDrmxm ot0tetnmoetldfs2ra(mont) renirctatlmtelueo;()srxm(rpnydllt  fvtatfaDra(  ;u4apeo oetytfaDuanmp;t0tetniocoatlpt aues;(  2xoio oo1alenmnvt s) Dtm(mpnt4tpx ii3tldlm2ra(mp;(0 ltnxf todfpte ies;()t2uoim iy4al nmfesat aDuaxro;u1alxo ieiyt aDeaump;(0tltnmr3iodfp   iesls0 2uoxo oy1al nlfeta(fsDua(rpou0apxo fciadla ulnvo;u0teeomr ty1oate uei;s)texoimpio4om  mietl(fa2um(r nt4tlxnio3ilt a rl(msnu4aeerxoctytfm e u slt0seuoir oodop nlfci s) 2rr(r nu1tpx  ociydfaDel( onu4altnmr iotoa   i i;s0s2tr(mpoodoptnmfci t  ruax p;t4tpxn ociyd m ulu s (4altrxr3to1opD  neo ( srtmim3no1amen nesls a2urxrpoo0oltomoeiyt m elnvs;t0altnircoa1latranvs;t setrim nydomen feiltf rurxmpou1tltoiiciatlmDemn o u) rxoxo3oodfaDe nvi;s) rxoxm3oodal n fetlsfsDtr( p;o1tpe ifeildla uln s t4 rxomr to1lp raivs;t)seuoxopny4am nmicil( srrr( p;t4ape mf3ils s rlnmpnt)aetnmf3oo1lmDrli sl()t2umiopiudam  lfci t)arrm(mp;t1optnioeiltfs2umump u4aeerxf3oydoaDelivol(0sexr(opiudop e fcilsfarrmuroou1tet ifeild sDum( o;t)arxrmrcoydlmD aneilt)trumxopoydome  nciat)s2rrur ou1alxo o3iltfm2rmuvo;t0 rxrxocto1lpt lnvslt0sexoxm iydll e ivi tfa2ra(ro;t4oexnmi3tls s2ea(ms t0 etnxr tytfp  au i;t  eurxm oudame  ictl(fa2taxmono1tet moetlsfm2rmumpn(4tleoxf oy1fa elu ol( t2to(m3iydal e ncia( sDua(moou4tpxnmociytlm rmnvo;(4treomf iodlmDrli s s) eur(m3nydame mneil(fs2taump;o1aexnmfeiyt a2umn ont) ltnxo todlate i olt0trxrxo3iu1alenmnetltfaDtm(moou1teen oeildlsDrauvo;u)arermrcoatfpteau i;t0 2toxr3oo4lmeelieil( sDuax ono1olenif3tydfmDulnmpn(0artnif oatfmt lnes ()tetm(mpoodlm emfvi t)a2uaxro;t4oetnmfeiydfsDrlnvs;u4artomo oydfpt  n s;s0 exrio3io1opt livsasfsDurxmpou0tpx iictyt mDra( p t4 exrifcoa1fateaueo ( setr(r ny1om nlfct ( sDumumpno4opeoio3iyt sDemn o;t) exoxociydomDr neilt)trxoxo iu1al  mnvia()sDtrx  nt1oeen icild a rmn o t4trtrio oodlpD lueo s  etmio nudoltnlivsat sDtmum ou1apxo i3iasfs ea( o t0alxnir oytlpt au o;s) 2tm(o3iydome  ict sfsDtr(mpou1tlto i3tyd s2ua(vonu4arxrir3ty1la eau o;s0 euoxo ou1oltemivslsf rtax pno1oleoii3iysla um(mp (4 lenxfcto1lm  lu slt)seurim3iy4llt lfcs s sDuaxrooo1aetomoeilsfs2uluvs u4 ltoxf3iatlmDr n il(0 exr(opiodolte fvia() rtm( ooo0oexn i3tadlm umuvs t4teenxo tytopDe u sl(0seuo(o3nu1lpte iet (f Dua(  ;o0tptnmfcild a2ulu o;()aexomr3oatfp   n i;s) rumio iudom   ncia() 2tm(rono4apx ifeildfs2eanmp t4trtnio oy1fa  ai i s)srtm(o nu4lpe mfcil(f rtr(r no1alt  oeiytfm2rmumont) lerif3iy1fm r nvi s0 2ur(m oudomt mfcias aDtax pou0altnmieiasfs2umnvp t) eeoxr iytfat  uvs t)s2xo(o3oydolte fet ( s2uru  no0apen ieilslsDemnmp u4 lenmo3oo1lmDe ieil( srxmir iu1lmeemietltfaDtr(mp;o1tpxnmfetls m uanmpnu) rtnio iy1omD  ueilt) 2umimpoodll nliet tfa2tm(m oo4tee  icilt mDrmnmp u0trtoxr oodlpDelivilt0srtoirpou4al e fei s aDtru p;t0ope io3iyt s2uauvo () rxrmr3todlptrau i;()t2xmio3io1apt mfesl() 2rau  ;o1ole iiciasls em(vs u0 ltnifcoo1fmDeluvslt  exmir3oo1lm nmfctlt) 2tru pou4opxnmo3iyt sDelnmp t)aetnmr io1la  ln slt s2tmxr3io4ale  fetlt)aDur( pot1tlt ifetatfs2rlumpnt)trxnircoadop r u i t srxmxm3iudlmtemictl( s2rax  nt4aexnmfciydlsDum(ms;t)trerxrciotoaDr neolt setoxr3iydom elies tfaDtrur ot1aee mociatfm2emnvsnu4aeermo3totomt  nvo (  2xm(m oo4om  lfcias)s2ua(rpno0teeoii3tydfm ranmpn(0aetrmocoa1lm r uvils sexoxm io4aleemivs (  Dururpnu4alxomoetad aDum( o t0artnxf oadfm elivols0 2xrxrpiu1lleelfvi s  Durxrpnu4apxomfetldlmDrauvp;u)arxrxr oa1lpDraueo (0trxm(mpiu4al   fvtat s2uaurpot0tpx if3tytfsDrmn o;() lxoio3tydfpt lueo t t2um(rpoo4lmt  fvi s  2ur(rp;u1oetoif3tltfs2rl(vont0 reomocoo1lmtelnvolt) 2xoir iy1lpte ictl() 2urxmont1optn fciytfaDrauvs;t0teerxr3todlmte i o;t) rxrir3iodamte nvslt aDrm(  ou4apt mo3ilsfs umn o;(4aexnxf3tatfa  aivsls srxr(m nu1lpt lfcil(fsrrax  ;u1oetoio3iltfm ran s;u0aexomr oytfaD aueolt srxrir3oydamenmnei tfsrum(rpno0olenmietasfmDelnmsn(4 lenio oo1fp  li o;(0truoiopnu1ameelicsas)aDrrxrpnu4aptoii3iys a um(vsnu)aleomfcoytlat aivil(  exo(r no4lm emnvta(f Dur(monu0tet  fcilsfs umums;(0 rtrxf3oydfmte ivol(  eurxrpoudamtemivtl()a2tax onu4aeeoioeiydfm ua(vp ()aeeomfcoydlpD  ueo;s)t2uo(o3nu4lmeelfci s sDrrur oo1alxomoetlt mDra( s;(4 etnmo tytlpD  n s s seuoir oo1om e feils aDum(mp;t4ape mf3ils sDumumsnt4 lenmrctatlmte ueol() rtoxmpiu4apt mfvt s  2uaumpno4aex  f3tltlm2rlnvp (4tetrmo todfat anvslt)trxmxopno4optn fctat)srtm(  ou0oet mfciydlm emn s u4artrmf oa1fm  ln il() eumxmpiudomenlnciat sDum( oot0oeeoiieiasfa2eln o t) rxoircta1omtraivo;()srurimpiy4lm  mfviltfa2taurpot4alxo i3tasfa rmnvs;t4alxrxocoa1fpDrlnvil( srxr(opiy4ale  feils s2rmu oot0apenmf3tyt s rln o (0 eerifciotlpDe i i ()t2tmxrpoydop elivtl()aDurxrpoo1oee  oeiytlaDuanmo (4tlenmo iy1fateanei ()trurim no1lmtelnvias)s2tmumoot0oltomo3tasfmDeluvon(0tlxrxr oa1lm  aues;t  2uoiopiydalt  icsa(fsDumum nu4opxomfctat m2rlnvsnu) rxrxo ty1fmt luvils0teto(m3iodalenmfct t aDtaumono1opeomieiat sDuauvo t)tltnmrciadfaDelnvi;s0t2xm(o nudome mfeils)aDumx p;o0tptnmfeildlmDua( o t4trtoxr3tadomDeln sl( srxmir3oy4olt mnvilt)artrumpno1opeomo3ilsfsDumnmp () exnxr oodoa  aneo ( s2ur(m oo4olt mieia( a2raxr nu1apxomo3iaslaDean s ()tetomr iodoaDrau s;t)trtm(o iu4lp n nvsa()aDumur nt4aexn ietasla2ul(mp;u)altoiocoadfa eln s;t  exoirpno4lm  liesa()a2umxro;t0aex mictadlaDeln sn() rxnxo3iydlpteaueo ( tetmxopiydlmtelncs tfarta( o;t4tex  ieils aDel(mo;u)alxnmocia1lm ran s;()s2uo(m3ny4lp elies t)sDraxm nt4alt  o3ilt s ranmpn()artrmo3totfmtean i t sexo(m3iu1opte feiasf rrmu p;u4aeeomo3iat mDeln o;(4 etrmo3oodomteln o s  2xrxm oodap elfvs () rum(moou0tle ii3ilt m2rl(vo (0trtoio3iotoptrln ol()trxm(rpnudopee ics t s2tm(r nu0alxo f3tltla2uluvp;u)teenxo3iatom raivo;t)t2xo(mpiu4olen nvt t)aDrmxmp;o1altnii3tyt mDumnmp;u) exnxo3totfpD  uei;s t2tm(o3oy1apenmietls  rur(m nt1apen iciytlsDra(mon(4 ltrxrciytlaD  i il()srtmxo3iodlpenmnvtat  rum(mo;t0open octadfs2umu onu4aetnxr3to1fmDeai o s)setmimpoy4ll  mfvs t)a2rrxmono1altomfctytla2rlnvo t)aleoxr tadla  aneo;s  rxo(o iodale  fct ()aDrau pnu4oeto o3ilsfs eln o u4trxrxf3ootom rlies;t  exm(r3ou1lmtelnesltfa2rrxmont1aexnmfctatlmDean on()alerxf to1oa e uvo;t0srxo(o3no4lmte iesls s2rr(r ou0oltoioeiytla2um(mont)tetnmfctytomtr uvs;()s2urxr iy1am nmnvt ()srrau  ;t4oee if3iysfm2uanmsnu)trxoir io1omD au o;s setoim3nu1olt  fctl( aDtru ono1ape ioeild a ul( p;t4 rtrmf3io1la r u sls0texoxm oudam  mfcsa(f Duaurp;t4aet  iciasla2rlu pnu4tltomo3oa1lpDe neil( srxmiopnu4am elfet sf ruaum nu4olxn fctyslmDua( o u0 renir3ia1fmteluvo t)t2toir3iudapenlivs (  Dtrum ou0apeomociytfm ul( s u0alenmo3io1lmtr u o;t  exrxo oy1am n ietlsfsDuru p;o4opt mi3iat sDel(vpn(4trtrifctotlaDraueo;(  2umxrpiy4lp emieta(fa2taurpot1tpxnif3iydfs umumpnu4 exomf3iotfpD aivs;s)trtmxm ny4altelict t a2trxrpno4tlen i3iltfm2rmu p;(4 lxoio iatop eauvo;(0tetr(mpiy1alee nvslt a2trurpou4open f3ilt sDranvp () reoxr ootopteaues t sexrxm3iu1olt  ncil()sDrm(r ;u0altomi3iadfmDuln p u0tlenxf3ia1faD anvs;s)sruoxr iu4op  livtat arraumpnu0ope iiciadlm rlu o;t)texoif to1laDe u o;t0setrim3oy4lm   feiat)s2trx pou0tpx mfciasfs ra(vpnu0tlerxo3io1fmte ueo s)t2ur(m3iudlm   feilt s2umxm ;t4texoiietldfs eanvo (4teerirctydfm eaueil( trumio3ou1lp emictl(fs2urxr oo0opx mietysfm ul(vo;()tltrxo3tydlmDelivsl()t2uoirpnudop  lnvt s s2tmurp;u0apx ioetlslm2uanms u4tetrxf3io1lm  au ol() rum(mpiy4aptn ivtatf Dtm(ront0oetoifciyt a emu sn()artriociotoa r u o ()s2umimpiu1amen fcs (  rur(ront0tlt mietlsfm rlumo;(4aeeoif todfpt an i;t0seuo(o ou1omtn ictas artr(r nt0tex if3tltfmDel(vo t4aetomf3oy1opte nvs ( tetoio3nudopeemivtls)a2urxrpno0optniiciydlaDel( sn() eenxrctodfmDeliei (0t2toio3iy4ap elivils aDururpoo4tltnifcilt aDemnvp;u)aetnxrcoytoaD livs s  rxoxmpny4al nlnci s)artrxrp;t0apto fetls a umnvp (0aexoxrcoatom  lues;s t2trim nu4lltelnes t artmxrpnu4teto oeiatla ra(vs u)tltrxo3tatomD auvils)srurxmpno1lm emnvta(fs2rru onu4alenioctldfs2eluvs;t0tetrmfciotopt ai o;(0sexoim oodlltemiciltf 2umumoou0olt  f3tldls2ul(mo u4aetrmo3ia1oatr i s;t0 exoxo no4optelneias)srtr(mp;o1ope  oetytlm rm(vo;u)treomrcoatlatrai ils) euo(r3iu4lltnlfvi s a2rau  ;u1oexnif3iadlm2eanms (4 lxomr oytfmt lneo s0s2umir3no1lltelfesltfsDra(rp;u0olxoii3iydlm rmuvon(4arerifcoytfa  auvol( sexo(m ou4ame  fcsl( a2urxrpoo1apeoioctydlm emuvs u0treoif3iy1faDe nvil(0s2xrxr oy4al  lnvi s a2uax  nu1ale ifciltls emn p;u) lxnxf ootomt  ieo;(0teuo(o3iy1altelfctltfsrrr(ront0olenmi3tat a2ua(vo;u) lxoiocoa1fmtr u slt0t2umxm3oy4alte nvi () Drrxr ou4aeen o3iatlm ra(vsn()aetrxfcoadopt ai s;s)srtm(m iydlpt  ivtas)s2um( o;o4aetnmictysfm rmu o;t)teeoio3oydoptrauei ()seumxo3ny4aptnmivia(faDraxm no1aet  feiydlm2rlnmp (4teerif iodfpDe iei t)sexmir3iydop elfci (  Draumpnt1aetniieiadfm2umnvsn()trtrxr3oadomtrln o;s0s2umxr3ny1ame livs (farur(r ou1tleniiciytfm el(vsnu0alenir tadlat livs;t0t2toiopnu1olen fes t) rtau ooo1aetomfeilslm ra(mo;u4 etrmfctotoa  lnei s  2xmxm oo1opeelfvtatfarum( p;t1tlxo i3tltla umnms;(0aexoxoctotoa raivo ( trur(o oy4apee nvt ()srta(mpnt1texoii3iltfmDrmump (0aeerxo3tytlat  ivs;s s2umxo iudol elivs t  2uax oou1olx iicias m2ulump;u0 etrir iotlat ln il()t2tr(rpnydomt mfvia()a2umxro;t0aet mfetytls2eauvp;t)aexnmo oatop  liei;(0 2uoxr3iodapt lieia()artaxrooo0oetnmiciltfm2eln p;u0 eeomfciatlat lnvi s teur(r3ny4am emfcs t)a2rm(  nt1aexnii3tad m2ea( s;() etnxr3io1lat  n i ( setm(m oudlme  fesat aDrru ont4opxnifetatfm2rmumsnt) etnmociytfa raivol() rxr(mpnudamt mnvta(f rumxmooo4oeeoioeiasfsDemnvs ()tlerir3oodomteli il() 2tmim3io4lle  ivtasfsrumxm nt0tlx ifcildfmDrm(vs;(4 lxnxo3tydlp r ivs (0 etrirpou1ameelfcsas a2tax  ;o4oetomf3iatfm2elu p t0tlxoxf3tytlp rlivolt) 2trir iudlme  fvt t a2umxmp;o4apeoioeiydfmDranmpnt)tetniociydlptrluei t)teumir3oudlmt mnvslt) rta(mp;o0aptnmociydfa raump u0 etrmrciy1fat  u sl(  eurio oo4apt  ieil(faDuaur ot0optomfctyt aDrlu onu0tltnxr tadlpDr ivs (0s2xm(mpou4ame lfcsls)artmxmooo4texo ociyt sDulumpn(0alxrxfctatfaDelieolt tetrimpio1llte net s) Dtauroot4texomfeiydfs el( on() rxnmocto1laDrliei;t0trxrim iydlpen nvsat)s2um(mp;t1aexn o3iysfs2rluvs;()aleomf tadopDeli s;()s2umim oy4ll   fesl(f Durxmp;o0opx  ictasls rmn o;()alermr3to1fmD aiesls0 exoio3oy1olt lfei (faDtax oot0apt  ieilslsDrm( o;u0treoir3iodfaDr nvo (0 2trxrpiydoltnmicias)sDumxmonu0oetnmo3iad s uluvo ()artrif3oo1op rau o;t texrxm3no1ole mnes t)artrur ot4aeenmo3tlslm ua(mpnt) lxoif iydlm  au s;t0s2xo(m3nudome lfvtas) ruau o;t4olt io3iltlm ua(vsnt4tlxrmo3tadop r i i t)texrxo3iu4aptemfcil() Dtm(m ;u0oeeoiieiltfs2ua(vs;u0artrxr oa1fmt  neo;s s2xmimpno4lpen ivt sfsDraxmono1tex iieiys a2rm(von()altoio3tadom  lues;(  2xoxmpoy1ome  ivsat srrmumoou1optnmocilsfm rl(mp u)aetrir3iydomt au ils t2xm(r3iu1llt mivtatfsrraurp;o1oltn ictltls2el(mp;u)trenmo io1fmD  uvil(0t2xo(m3ou4am e fvsat)s2uax pot0opxnmieilt m eluvs;()trtrio3ootlmD  i i s srurim3iu4ole lfeil() Draur ;u4alxnio3tldlm ua(vo;()alxoxo oo1oa  anvilt)seuo(mpnudllt lnesa(faDtrxro;t1apeoiictld s2uau snu4alxoircto1lpD an o;s teuoim3no1opt  fvsasfaDra( pnu4olxoiiciltfsDelnmon() lermr3totfpDeaneo;s)trxm(o oydaleelfctas)aDrmum no4tlx ii3iyt s ulnmo t) etomf oy1omDrlu olt0texm(r iy4ole livs tfsDtmur ot4openmfeilslm ulu snu0 rtoio3ootla r n ols0trurxm3oy4lp emnetlt arra(m ;u4tex  oeiadlmDran s;u) lenir3ootoaDran i ()teurxmpio4ole mfvslt  2tmu o;u0opt mo3iydlm ua(vs () rxrmf3ta1lmDeanes;()seumio3io4optnlivi (f 2ra( o;o0tlt if3tyslmDranvs;(0teeoxf3tadopD au sl()t2tmim3iy1op e fetltfaDtax  ;u1olto o3iltla emnvp (4areomrciadoat lnes;(0seurxmpiy4am n ies ( sDurum oo4tleo fctatfs rmump u0 eerxr3oy1lmD  nesls0 eurxr3iudom nmfet tf 2trx  nt0oet io3tat m umnmo u)aexnmf iadoat au sls0setrim no1ale mictl(fa2rmumo;o1oltn octadfmDrlu sn()altnioctodoptelneols) 2xoimpnydop e ics tfsruau ooo4tleo ocilt m2ua(mpnu4alxnmrctadfm eaivi;s teur(mpno1apen fciltfa2uau oot0aexoifetas a ulnvonu4 lxrxr iadfmDelivi (0t2tmxrpiudoptnlfcsls)a2umu pno1tex  fetas s2um(mpnt4 leomrciytlmtr nvilt texoimpiy4ol  lfvtls  2taxr ;t1optomoetldlsDrlu o;t) lxoif3oo1lptean sl()srxoimpou1lmenlfvias aDurx ooo0tlxo oetls mDuanmsnt0tlxoxo3oy1fa r i s t srumio oo1lm   ictlt arumxr ot0apt  ociys s rmuvs t)alerio oa1lptr i o;s0 eurirpio1olt lncia(fa2rr( pnu0opxniietat s ua( pnt0teeomo oy1fpD lnvi;t)srxoimpno1ol emiei s) Drrur ;t1openioeiatla2el(mo;t4 rxoxo3iy1fm  li i;t s2xm(r3iy1lp e ivt ( s2uau o;u0tet io3tltfs2elu o;t)tetoxfcoadomtran ilt  exr(m iy4omenmfctlsfs2trurono4optoif3tyt sDumn p u) exomrctotfmte ies;s srurxo3no1alt  ictl( s2rr(mo;u4oeeomictltls ea(mp (0trermfciy1om   neils)srtm(opiu1ame mneslsf 2rm( onu4tetomoctldfs2rm(mo (4arxoxo tytoatrlnvs;t)trtoirpoo4ape lnei tf rrr( onu0tleomfeiys s eluvo;t4 eenif3todfpDrlneo s0trtr(rpiudamt lnvtat sDra(rpou4tlxnmf3ildfa um(mo u)artrmfciydoaD livi t)teum(o iudome  ivsls) rtm( pou0teenifctatfsDumnvo t)trtoxocoo1lm eauvols) rtrxo no1olen fctlsfs2uaxr ou4tleo icildfs2umu on(0tlxrmo3oadfatr u s;()sexoimpiu4om  mnvil()arraxmp;o0oetoifciysfm ul( s;u) rxrmo tytfp rlieo ( t2trim3no4lmen icsls arua(mpou1tpxo ociytla rmums;() lxrxr3todfpD auvilt t2xrir3io4lpt  nei s aDuaxm oo1tptoio3iasfmDum(vo (0trxrmrcio1lmteln i ()srtm(opiu4am nmics s aDtm(mpoo0altoioetyslaDraumon()texrxfcty1optelnes;t0 2xr(m3iydlltn neil(  Dtrxmp;t4oltomfciatfa2ra( p;t)tetrxo3io1omD  i o ( t2xrxr3no4oltemfvia( s2rrx ont1oltnmociat mDrlu p;(0trxnif3io1om rauvilt s2tmirpnu4lme li
\ No newline at end of file
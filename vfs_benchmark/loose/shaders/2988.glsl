@@ -0,0 +1 @@
+u i t0teum(o3io1ome mivtat)aDta(m ;o1tee  feiad m uln s;u4 reomr tadlatr nvo;s0s2tmim3oudlmt licsas)srta(  ;t1ale mfeiatls2um(vsnu0 lerxrctadlpt  nvo t0srur(m iydllee feslsfarraurp;o0oltnmfctldlaDra(msn(4 etnxr3iadlpteau o t sruoir nu1openmfct (fa2umu o;t0tlenioeiyt a uau ont0aeermo oydopt anei;s) exrim oo1llen iei t)s2ua(mp;o4oeen f3tytlaDrl(vp;t4 eenmfcoodlmDeluvi;t0 etmimpnydamte ivtat)aDtaumono1apen i3tytfmDelnvp t)aeenxr3iydlmDelnvol() 2xo(r3iydam n fviasfsDuaxmpno0aeeomf3taslm2rmnvs;t) rxrmo3iadoa eanvs s  eurir3iy4lpenlnes s)s2rrxmo;u0tptnii3iys sDuanvp (0aexnxo tadfmtr neo;s)srurxrpoo4omen fei s)arua(mp;o0aex mo3tatlaDuau p;()arxomociatlatr nvi;s)t2tr(m io4ome  fvtl(fs2umxr ;u4olxnmieiltfm2rl(vsnu4 etomfcia1lmDrlieo t)seur(m3oodamtnmiei () Drmu ont4tltniietlt sDuaump t4 rtomf iy1fpD  neo t trurirpnu1ol nmnviat) 2rrxmo;u4tpx mocias m rlnvon(0tltrxfctytfp ranvsl(  etrim3no1alte fcs tf 2rm( p;o1alenmfetyt s2eluvo;() etnxfctatlmt  nei;t)trur(r3oodlltemicsat)arrmu oou1aptnmfetasfs ulnvsn()aeermr3ta1lmDeauvs;t0 2xr(m3nudllte ietas arumumono4tlxnifcils s raums u4 exoxr to1lm r ies t0texo(r nu4olenmieiat  rur(mont4ale iictysfs rmums;()tlxrmo oydopDraueo;t)t2xmiopou4altnlfetas artr(moot1alt  fcilt aDeaums;(0 eermfcoa1lpD lnvolt) 2trxr3ou1om nlfci ( aDra(roou0aleoii3iytfs2rlnmon(0 reoxociodlmDeauvs ()t2um(rpoo1om   ivtas s2trx ono1oeen octas mDranvo;u0aexomo3totoa   uvo;s)s2uo(r nodlmenmnct tfarur(root1oeto f3tyd a eanmp;u0tetriocoo1om   i ols trxmxr ny1ol e ncta() Dtm(rpot1opt mocilsfaDumnmp;() rtnircoatopt ln o;s) rum(mpiudolt mnvtat artrur nt4aet  feiyt a ua( s t)aetrioctadoateanvolt0srtmxopou4lptemneslt sDurxrooo0ape  o3iyslmDulums;() etnmr3oo1omDr uei;(  rur(mpoo1lmeemicias sDum(r nt4tpxn feils mDulnvp t0tetrxrcty1lmDeai s s)seuoio ny4alt  fcils)artr(  oo0alen o3ias s2emuvsnu)aeeomf3oo1lpte i s ( sexrim3nydlp nmneta(  2rrx  oo1oltomiciltlmDrmump;()tlenxo3totfptrai olt srurxo iydlptnmfvi (fa2ta(r oo1tlen feiyd a uauvp ()tltrxo3todopDelivils0 rumir3no1om   fvtas)s2ur(  ;u4apeniociyd s2rln pnt0arxnmrctodopteli s () euoio nu4olt lfctl( a2ur(  nu0tpeomfeiysla2rm(vsnt) rxrxf3tadlpt an ols0 exrim3nu1lpe lnet s  2rrxm nu4tpen fetld aDuanvp (4artoircty1op raiei;t)s2to(r oy4lpe mfetat  rrmurpno1tpe ii3iatfaDranvont)aetoxr io1omt anvslt0texmir oo1oltn ivs ( arrmxm oo4tpeoio3iadfm2ua(vpn()trtrif3oydoa r ivi t)s2umir3ny1lpe liviat)a2rr(moot4oee  iciys s2rlnmp (0alxrmfciotfpDran i;t0srxmxr iodom e fctat  rra( pot0apt  ieiltfa ea(mon(4artoxo ty1lpD ln s t0 2trxr nu1oltn ietlsfa2rmu  ;t0tlt mi3ilsfs rmu p;(4altrxf3iy1lp   i s t0t2um(mpnudamte fcsas)srum(monu0tlxoii3iatfm2uln o;t4 ltoxrcoo1omtr n i;s0trxoxo3nu1optn nvtls aruaurpnu4aee ifeiatfm2rmump;t) rtrmr3oydfat anei;s tetmiopnu4lleemnesatf Drrxr oo0apxn ocilt mDrmumsnu)alxrif iy1oa r nei;(0trurio io1amte icsltfsrur(m ou4opxoii3iadfs uanmsn()tlenif oadfmDrlnvo ( seumxo io4al  lnci t)s2uax  no0tpxoio3iyt m rm(mp;t)trtnif3iotoaDrau i t0 eto(rpnu1lpt lfei t  rumx  ;t4tlxn f3tyd s rmuvo;() renxf ia1late ivilt0t2um(rpnudlmenlfviasfsDuaxm ou4opt io3iltla2ul(vpn() ltoio3ty1lp  lu o;()t2xrim no4amtn nvt ( aDra(root1tex  fctldfa2rmn s t0trtnmr3oatoa r nvs;(0srxm(m oudoleelfvtasfartm(m nu1oleo octydlsDeanmonu4tetomf3todlaDe uvsls)s2toim iu1lmtnmfciat) 2umx  nt0optomociasfa2ul(ms () rtoxfciatoaD ai o;s) 2xoxm nu4al nlfcs () 2rr(mo;o4tpe ii3tlt aDrlu s t)tlerxr oodoatran o;( t2toir3no4omen fctat)a2umuro;u1aet ii3ildlm elu o u4alxrmf3io1fateaueols t2urxm io1lmen nesl()aDta( pou1tet mietasfmDrl(mpnu4tltnir oatlat  ivs;()t2tm(opno1ap  livil(fsDrmxm ;o0tee ioeils s ul(mp t0 lxoir3oydlmDeaues t)sexm(m io4lm emfvtasfsDurxmont1tle mieiltlsDrmu pnt0aeenxr ta1fmD luvil( srum(opno4lm  mfet t sDrmx ooo4oeeniieiysla ra(mo t0tetrio iydlmDelivs;(0seuoxm io4lm  lnvsat)sDtru poo1oeeo octadfs2raums;()alxnifciydfmtrluvo;s)t2ur(o oudom e ici t)sDtmumoot1oltniieias sDea(vonu) lxomf tytfaDelnei;(  rtmio3nu4ame  ietas)s2rru  ou4olx  fciasfaDum( sn(4tlerio3iadoa ranvolt) euoxopio1omtemics sfsDurxm ot4opxo fciyt s em(vs u) ltrxo oo1lp eaivsl()trxmimpny4oltelivsa(f 2tmump;t0tpx mo3iysla emn pn()tleomf ootoaDean ils  2ur(rpiu4ole licsl(fa2rm(ro;o4oee mfeilsla ranmpn()alerir3iatlatranvils)trxrxm3no1lptnlfctas)srrmu o;o1apx ifeilslsDrlumpnt0tlerxfcoadlm rlueo (0 eto(m oy1ol nmiet s s2uau  nu0aeto oetls a emump u)tleomf oy1lpt an i;t seur(r no1lmtnlnci ()sDtrum nt4tptn ieilt mDeanvon() lerif oy1fat ln s;( s2uoxm no1llt mfetat)a2uax  ;o4tpenmfeiytlmDeanvo u0tltoif to1lm r nvol( s2trxrpiodal e ivi ()sruaurp;u0apxoif3iadlm em(mo (0alerxrcootoa r i s;()t2xmxrpnudllee fcslt)s2tr(mo;u1tltnif3tltlm rmnmont4tlxnxr3tydop   ivs ()t2xoir3oodlmeemfvsat  Drmu oot0aptnmi3iys sDrln p;(0areoio3iydomDelnvs;t0srxm(o3iy1lpenmiei t) Drmuroou1ole io3tldfa2ua( p (0tlxoxo oadlmDrlnvil(0t2xoio3ny4ol   netlt s2rrumpou1opx  fctatla2elnvsnt4 lxnmo3ty1lmDr uvilt trtmir3oy1ol n nvias  2rmurp;o0tpxomo3iyd s ea( snt) rtnif tydlm   i i;t)setrxrpnu1olt  nci t  Dum( pot0aeen o3iasls2umn snu)tlxnxr todoa e u il(  2xo(r3ny1alee iet sfaDurxro;o0oexomictadfm ea(von(4altriocio1fp e ieol( seumim oudapt mfciatf 2umx o;u0oeeoiieiltfm uau s;u0 lxrxf to1fm  an ils0srur(r ou1lmee ici (  Drm(root0apx mfciasfa2rmu o t) ltnmo3ty1lmtranei t0truoxrpoy1ll nlfvtat  rtaump;u1teenioctys s2ulnvs;u4 reomr3oo1om   i o (0 exoxo3oudome mnvi s  rtmxm nu0tleniocilsfsDemu pn()aeenxfcoytlmtrlues (0s2toirpiu1olt  ncias)aDtm(r ;u4apx mfeiyd m eluvo;u4 rtomrcoadlp  aieils) ruoxrpny1amt lfvil() Drrxmonu1tlx mieilsfs2ua(mp;(4tetrmf iotom eanes t0sruo(o3iodalee ietatfsrtr(m nt4tet  oetys s2elu sn(0aetoio oadoa e uvi;s0 exrxr nodlm emfct tf rrauro;t1opt  feiys s2ua(vonu)areoiociatfateli o;(0 exrim3nudomt lici (fa2rru pou0apt ii3tydls eanvsnu)tlxoxrcoadlpDran sls) 2ur(r3oo4llen fvtas sDurxmpnu0tlt  ocils sDrauvo;t) exnif3iytomtelu s t0s2trirpnu1apeelnes s)a2rrumoot0oexo i3tadls2ra( s;(4 lxomo oatlmD  nvi;s0srtm(rpiudal   nviasfartr(  no1oeto oetat a2ranmp;u0trerxrciotopDrlueil(0srtrxr ny4al  liet ()a2tmu  ;o0tpt if3iyslm ulnvp;t4tlxoxf oytfaDeluei s t2xmimpno4llen ics ( sDtm(  ;t1opeoii3ildls rlu s;(0tltnio3ta1omtr uei s)s2urxmpiodll  mfcsasf Drm(ronu0apeoioetltfa2rm( s (0aetomrctytopD auvi;s)s2urxrpny1omeelncslt)aDrr(ro;t4opx ioeiadfaDem(vpn() exnxfcta1fmDeaivsls setmxm nudome mfciasfarrrx  no0oexomfetatfaDeanmp;t)areoxr3ootlm rai i s)srumxrpiy1lpeemnctas)aDrmurpot0olt  fetytla ea(mp;(0 ltrxf iotfp r ivo (  eumxo3oo4amenmfetas s2tau poo1tpen oetysfs2em( s t4 exnmo oytfpDeauvi;t0s2uoio3oy4oleemnvsas  2uax o;o1tpen octltlaDra(mo u0aetrxrciatlat anei t0srumxm oy4lp n nvia()srumur ;o0tlxo f3tyd aDelnvs;u0 lxnxocoa1laDeluei;s)s2trio3oydom emivtls)aDrmu pno0tleniicilsfa2ulums;t4aexrifctotlmt aivolt) 2xriopny4altemfvsat)arra( o;o1oetnmo3tysfa ulnvsn(0 renmrctadoatr nvs;s0seuoio3iodam emietatfarrrurpou4oeeomoctatfsDum(vp;t0teermf todfaDr nes t)srxoxr nudlpe  ici t aDuaxrpnu1apeo fetadfa rlumo t) lxnxr totlmtr i olt0t2xoxo3nodalt  fvias aDrr(r ot0oetnii3iltls em(mpn(0 rtoio3oa1opDeauvols0srtoiopiu4lp emnetlt)sDrmxrp;u1altniociydls2emnmp;u)tetoiocio1late ivsls) rumio3oo1optnmnvsl(  rtaum ;t1tpen o3iyd s rlnvsnu4 reoircto1oatr ieo t) rxmirpoodolenlfcils)a2ta(rp;o1aetn fctydfaDeauvp;u)alxrmoctatlp e nvs ( srtmxm io1ll  mfvsls arraump;t4alxoiocias s2el(mo (4 lxoio oadlmDrauei;t)t2xrim nodlleelivs s srtau  no0ale if3ildls2rlnmp u0 lenmf3io1optrln s;t)seuoimpiu4apenmfvsatfsDtrxr ;o4olen ociltls umuvp;()tetriociadfa e ivo;t0tetrxopnu1ll emnvs sf rrm(mp;u1aet  f3tysls2ulnmo u4tetnmfcoytfm r n o t0s2tmxmpny1ome lnvtlt srrmu o;o1tlen ieildfs2ea( s t4teeomf3iydomteluvi s0sexoxrpnu4lp   nvia(  2rau pot4aex mfeiytlsDrm(msnt4 exoxf iotoaD auvolt0srxmxrpoo4ap   nesa() rtr(rpot4tleo ictas s2rauvo t)tlxoxoctatfaDelnvolt0 2um(o3nu4lmtelivs s)s2trxrooo4openifeiys s2um(vpnt0altrxocty1omteluvo;(0 2trxm iu4alenlncia() rraum ou0oexomoeiydls ulnvo u)teerir3oytfmDraneil( t2tm(rpiu4oltemfcs tf Dumuronu4tex mietydfm2rm( o;u4 reoxo3oadopDrlu ols0s2ur(m3ny1lmt  neslt)sDrrx pou1aptn oetadfsDrluvs t0tetnxf oodfmtr n s;s)s2toxr3iydopenlnci t)s2ur(root0aet io3taslsDemuvs;(0texniocoy1oaDraues;(0teurxrpno1ap e nesat a2rmxmont1oeeomf3tls s2ranmpnt4 etnmr iytom eauvol( t2ur(opoy1alenlictas)aDuaxroot1oet  o3iaslm rlumsn() rtrxo3to1laDranei ( t2umio3iy4al e ivtas  2raum ou0opeo fetydlsDrlnvs u)altoirciytom ranvsl(0s2um(o nu1am nmfesatfaDumurp;t0tet if3iyt sDea(vsnt4trtoxrctotfpDr ueil( t2toxo io4lpt  nctlt) Dua(ronu1opxo feiatlaDrauvs t4altrif3iytlpD  i olt0setrim3iudam emneta( artmxront0oltomo3ilslm uln ont0 rermr3oa1lm rauvsls0t2toxm3nudape mivt t)aDuaurpoo1opxo f3iysfa2rlnvsnu) rxrio3oa1fmDraivo s0t2xm(r iodaltelfcils)arrrxrp;o0tet  i3tltlaDul(mpnu4 eeoio ootlmD  nvols  2xmim3oodaptemfviasfaruau oou1tle mietytfs2ran o u4trtnmocoo1op  ai i;t)setmio3io1ap e iviat sDua(mo;u0tetnif3iasfa ulnvsnu4 leoir3to1lm r u ils)t2uoimpoudlmtelncsat aDuaur ;t1ole  f3tys s um(vpn(4 lenmfcio1lpD lieo s tetrxm3no1om   fvia()a2uaur nt4alenmf3iasla el(vo (4 eenxrcoodoaDelu i t0t2urxm oo4amtnlfcia( srumump;u1tex  oeiyd aDemnvs;(0artoiocio1lp   ivil() etoir io1am   iei s)a2taumo;o4tpenmfciasfaDelnvs;()trtnmr3ta1omD  ivs;s t2toxo3iodlptnmfvs sf 2tmx ooo0altnifeias sDean pnu4trenif iotla eaies (0s2uo(rpou4optn ivia(faDtaxmo;o0oeen oetldfm2emnvp;(0texrxf oytomD  uvilt) rtoxm3ou1omeelici ()sDua( oou4opx  f3iad s elumsnt0alenir3tatoaDelueol()srur(r3io1altemnvta( sDtaur ;o0aee  octld m2elumsn(0 etomfcoy1opDrluvol()s2uo(o3oo1op  lfvtl(  2taur oo0tpe mo3tadfm2rm(mo u4arxoxr oa1lm e ivs;(0t2xo(o ny4alt lfctl() 2trur no0olxo i3ias m emuvs;u0alxrxo3oa1omDeli o s) 2trxo ou4oltelnct (faDtauro;o0opt  o3ilt s2eauvpnt)trxrxocoo1om e n slt)tetmirpiydlmtnlnvtlt  rtm(monu4oltoioctltlm2eluvo u0arenmo3ty1laDraiei t) eur(opnu4alt lfcsasfartm( pnu1opeomfciltfm rauvs;t4tlxrir oy1opDran s t0 rtrir io4lm e nvia(f Drmxr nu1apxnioctld s2elnvp;t0tlxnxf totfpte n ols)trtoiopoodale miesls  Drmum ;t1texnmictysfs ra( o u0 ltrif3oa1optrlies;(0s2trirpnu4olenmivtas) rtrurpno1tltoifctyt m2elumsn()texoxf oodlmtraueols texoxo iy1alt  fvi tfa2trxmpnu4opxniiciytlaDem(ms;(0 exoxf3iytlpDelueo ()teto(m ny4apt mict ( s2ta(  nu4tpe iietldfs2ra(vp u4texoif3oodlp r nvs;(0 eurio3iodamen nvsl() rtru  no1tpen i3tlsla2el( s;(4artrmfctydfpDe ueol()s2xmxo oydll elnetlt)srtrxrpnu0texoioeiatfmDrmuvs t) exrxo oo1fateanei s0 rtr(o ou1ol n fvi t a2ta(ro;u4aetnif3iltfs2um(vs;u4aleoir3tydoaDrlivi ( trtmxopiydlp nmncsa()artmxmont4alt moetaslaDumu p;(0 lxomr3oydfm  livi;t s2tmxmpiy1omenlfvias a2uaumono4altoiiciat aDra(vpnt0 etnmo ty1lp eliesls)trxrim3iu1llen feslsfsrumump;o1tlx mo3ild m ulumonu) eeoir iy1op eli i t srxoxr3oudape  nvi t)arraurpnt0alto oeild s2ul( p t4 lenioctytfpDrau s;()trtm(o iu4am n fet ( srrau  nu4oet mieiat m2raums u0treoxf oodfa raivi t0t2to(r iydlp  mfeiat)aDtaur no0tltomicias mDem( o;t)texoif3oydomtranvol( srurio3iu4ap elncs t)sruaxm ;o1teeomietlsfaDeanmsn(0tetnmocoatlp  luvo s setrir3no1ameelivtltfs2ta(m nu0apxn feiltfsDelnmp;t4tetrir to1lateau s;s srurxr3iu1oleemfvs (fartrumoou4tlen i3tysls2ua(vp;t0aeenmrctadlp r ivilt) etmimpiu4olt  fvi t) Dtrumonu4aet  ietadlm ulu ont)altnir3oodfatrluvo ()s2tmxo oy1ome mfvsa(  2ta(ronu1tpt ii3ilslsDra(vo;(4 exoir oatlmt ln olt0 ruoxo3io4omte ncslt a2ur(m oo4tpx mf3tld mDuaumo;()areoir3ta1la   ies t  eto(r oudomeemieslt arumumpou0aexnif3ilsfaDum( sn(0tlenio3oadlp e n i;t)s2urxo3ny4alee fvt (f 2ururooo4tpt  i3iat aDumn s;u0trtnxrctytfa rli s;t t2um(m3iu4am  mivi s)sruau  oo0apxo f3ildla umu o;(0trtnio3oadoaD  i i;t t2xo(o3oy4aptnmfct s sDtr(rp;t0alt  ictlsla2ea(vp;(0texomf to1fp e nesls  2umimpnu4am   fvtls arrmum ot0tpenmoetld s2raumo;(0 rtrir iatfp raues;(0 eto(opnu4ol nmnvias srrrumpno0teeo fctyslm emumsnu0 rxrmo3iy1lpt  ueolt0texrirpou4om emneiltfa2tr(r nt0tptomieild m ulums;(4 rxrxoctydomt  n i (  2tr(o ny1ameemivs (fa2tmx pot0aptomoeils s ua( p t4tetoxf ootopDelivo;t0 rtrimpou1lpt mnvil( a2tm(ro;o1texoioeiat m rlu p (4 exniocoytfp  aivo;( trtm(o3oudlptn fvi (  Draum ou0aptniictls a rlnvp t) rtriociy1oateaieol()texrim3iy4lmeelivtlsfaDuau pno0ope  feiytla ea(mp;t0 rxnmr oy1oatelnvo s seurim oy4opeemnvi (  2tru pot0altomociltfs2rmn o;(0trxnmrciotlmDeaneo t)t2xmir ny4opt mnvt (  Dur(mpnu4ole mfcilt a2ra(mp t)aexnir3oy1oa raivs s trxmio3nodll nmici sfa2ta(root4openmfeilslm2ul( p (0aeerir3oa1fm r uesls)s2xmxr3io4aptnmfcilsfaDuax oot1oltn oeiytfaDrln sn(0trxoio tatfp rai s;()s2trio oudopen nvtl(f rtaxrp;u0tltniictas m rlnvpn(0aetnmf iytfa ean s t teumxm3oodaltnliei t)aDtmx o;t0aeenioeiasfm rmn s (4aexrif iotop rlues s s2uoxm3nydlpt  icsl()srumurono4tlt mfetasla2uauvs;(4 rxomo iydopD  nvs (  rxmxo3iy1lpenlnciat) 2raxmpnt1opeoif3tysfsDuauvp (0tlxrxr iy1omtraiei;()sexr(o ny1ll   icta(  2uaurpot0tlt  fciadla ulump (4tltrmo iatfate uei;t0trum(o iudlltnlfvtl( sDtmu pnt0olxniicildlmDem(vo;u) lerio3to1fp rlivs;( srur(opio1oleemivi (fa2rmx oou4tpeomo3iyslaDelnmpn(4aexoxfcootfmteln olt) euoxo oo4ape mietasf 2rru o;o1tlenmoeild s rl(mo u0artrxo3oytlat liei;s0sruoio3oydlpe  net (fa2raxm ;u0tlxomfctld sDulu s ()tlxomf tadlmDrau s;t0sexoxo3oy4al n net t  2raumono1apt iiciytlm2rlnms;t4tleomociytom rlnvo;(0s2tmirpnodlme  ivt tfarua(  ;u0tpe io3tlslaDulums;t)teermfciodfmDeaues s s2tr(o ou1ol   ncs () Drm(roou0aetniociasfm2rl(mpnu4arxniocoo1lmt auvi;s)s2urio3no1omeelnei (  Dumum ;o4tpeomi3iyslmDrl( s;t)trtrmoctatfm  aneo;s t2tr(mpoo4olt miei ( a2rmu p;t1aet ii3tltlm2ua(mo t0areoxo tadlpDr n ilt srurxmpnu1opeemicilt) 2umu onu4altn feiadlm2ul( p;()aleoiocoydoat  neslt0trtmirpou1llenmieiasfaDuax p;u0oeeomieiltlsDem( o u)arxoir3oo1lmD  ivilt  ruoxrpiu1lpt  fviasfsDta(r ;u0opx if3iytfa2el( on(0 ltrxf3iotlmDeai sl(  eumio3iydapt  fvsat)sDtaumono1aex ioeiadlmDumu s;u0alxnxf ootfp e ieol( seuo(m no1lpeemncs s) rurx ono0oetn ociyslsDum( p;(0alxoxfctotoat au o;t)trtoiopoo4om  mfvtl( sDurxm ;o4tex  f3ild m2elnvon() etrif iy1faD  uvo;t trxoirpio1om nmfvi (f 2ur(m no4alx iocildls ea(vo u0trxoir3todlatrauvo;s0 2ur(mpny4omt  nci ( aDtrxmpno0teenmfeias aDrln s (4tlenif3tytla   nes;s0trxrxo3oo4op emieil( a2umu ooo0tpxomi3tys s rmuvsnu4 exnxfcty1laDrlnei ()trurio oudoptn iesat)aDrrxronu1aexniociltfm ua(monu0arxnif iodopDelnvo;t)sexrxm3ou1oltnlivs t)a2taxronu4optnmoctys a2rmuvs (0 lermr iytlmDrluei;(0sexmxopio4lmee nvia() 2umxrpoo0apt ifeildfmDuau p;t4 ltrmo3oydlmD livil(0srxr(o iy4ol  mieia(  Dtrumo;o1opx ifeiatfm2rlump () ltnxrciytoa  auvil( t2toxm3oo4lpee iviltf Dtmump;o1tptomieildfs2umuvont)trtoirctytopD aiei;s) 2um(r ou4omt mnvi tf Duaxmpou1tlt moetasls2ea(mpnu)texnif oydoaDr ivs (0trxo(o oo1am nlfes (f rra(root0aet if3iatlm rmuvo (0 leriociadlaDrlu o;(0 2xo(r oydapeelfvt t  Dtmxrpnu0olxnmi3iat mDul(vp (0tlerio3ootlmDrli sl()tetr(m3oodlpe lfet ( arrm(r no1aptnii3iat m rl( s u4alxnxfcio1omteaieo;t  rxr(m3iu4lmtemietlt aDtm(rpoo0aetoio3iys s ua(vsnt) rxoiocoa1oat  neo;(0 2toxmpny1opt  ictl()arra( ooo4tpenmf3iatfm2rlnmp;t4arxnif3iodlptrau s (0srto(r oudlmenlivs s)srurumoot0tle if3tldfsDea(msnt)artomo todom r ieo;( seuoxo oodomt lfes tfsDtmum ;t0teto i3tysfm2uauvs u0 eeoxociatlm eaneo t0 etoim oy4am  lfvta() 2tru  nt4ole  ociyt aDrmumsnu0tetoxocoadfm  li ol() exm(mpnodolt  ivtat)s2umxm no0tltn icildfm rlnmo;t4aetrxo3iy1oaDeln i s0s2to(o3nydop elncils sDtax ono1tltnmoetyslaDul(vs;(4arermf3tatlp eaivo;()trto(o oudlpen fcsas) Dumuro;t0oltnif3tls s ea(vp;u)trtnxf tydoaD ln i;()setmxr3iu1llt livtatfarrru onu0texoio3iydls emn o t0trxomo tydfaD lnvs ()srurim iy4optelfvtat artmxrooo0oleoif3tytlsDrm(mo t4aleoxociatoa eln s s) 2xmxm3io4olt  nvi ( arrr(moot4oet io3iysla rau sn(4 exrioctydoa   n olt  rto(o3iu1op nmiei () Drm(mpnt4olxo ictyd sDrmn sn(4areoxf ootoaDran s;t)t2tmio oo1amtemnvsls arurxm nt4oee  o3tat m uanvs;(0treoxfcoytlmDrli o;s)srumxrpiy4ol elnetasfa2rmu  ot0oexnmoctldfs2rlnms;(0aexoircio1oa   nvi;t  2uoxopiy4oleemictl(  Dumum ;o0tpxoiociat s eluvont)altniociadoat  i sls0t2tm(r nydlpt mivt ( artm(mpnu1opxoif3iysfm ua( o;u)alenxf tatom  aivi;(0s2tmir3ou1lpte ivta()s2rm(r ;u4tle iieiyd s rmnvsnt0tleoifcoa1lmDr ies s)teuoxo3iu4om  liesa( s2urxroot1tpeoii3iadfs2umump () lxrxo to1fpDraivi ()sexmir3nudalen fcslt)srumu pnu0ole mieils aDuln o u4tltrmrcoytfatrlies ()seuo(o iydomtnmncilt  2uau  ;t4oex  fctldla ul( s;t)texoifcoadomt  u s;s0teuoio3oydlpenmictl( aDuaxrp;t0tlto ieiysfm2rluvs u4 ltoif3ootfaDrlnvi ( t2tmxopnu1llt mfcsl(fsDtaumpot0olx moctldfm2ulu snu4tetnmrcoadomDelnei;t0texrxo3nodomtelnctls)artax o;o4alxnii3ilt mDrl(vsnu)tetnio iytlm r i o;t)setmxm iy1olteliet t)sDuax o;t4tpt  fcild s ranvs u4 eenmr totfaD an olt)sexrio oy4op  lnvsl(farum( pnu1oexnmietaslm2uanms u) eenio iy1fmDrlneols) eto(mpou1al e iciatfaDtaxmpnt1olt  fciysfaDeluvp;u0 exoio3iy1lat lnvs;(  rxrio3iu4llt  nei s s2raxm ot1texoiiciydfs rm(ms u)trenmf3iytfmteaneolt)srxoio3nu1lp emfvt s)srtrxmoot0ape moctyslmDemumont)aetrxo3iatlmtelueo;s s2umxrpnodll  lfeil() 2rmu o;u0olxniicildfm2rmuvs (4 rtrxf oa1omDeauvils)sruo(r oy4lpe  ivs sfaDtmx  nt4oetomieiyd aDuanmp;(0alxomociatfpt ln ol() eur(m3ny4al  mncias)sDrmxmp;u1tpe  i3iys aDrmnms;t0 lxrmfcoydlmDranvs ( s2urio iu1op elfctls  Dta(mpno1aee io3tytfa2ra( o;t) lxomf oytopDrlnei s trxo(rpoy4lm n ieil() rrrurpot0oeenif3iys s um( s () etrxo3iatopDr n i;s seuoim3iu4ome lfvsl()s2tm( poo1apt ioetaslsDrmn on()tltnmo oo1oa e nes;( s2urxopoo4am n fciatf Dra(m ;o1tetniictytfm em(vs;u4trtoxf3ty1lpDrlu s;( sexm(mpiu4apenmnvtas aDtau  ;u4oex  fetldfm ranmsnu)aeerxrcoydfmD anvs;s  rtr(o3iu4ap e fet tf 2tr(  nu1tee miciasfs uauvont4texoxr oy1lmtrlivs;s)srxm(r nudoltnmnet sfsDtr(r nu1alto ocias a rlumo;t)arxnmf3tatoat an o;(0t2xmxrpny4lpe mnctat) rtaumo;u1teeo ietysfsDua( s (0 reoio3todfm   ues ()texrxrpoudape lfeias)sDra(rooo0altn fctas s2uanmp () lenxf3oydoatr neo ()trtr(r nu4apt  nes t sDtmu pno0oltoio3iatfa2em(von(4trenif3iatopDelnei s0t2xrimpio4alte fcil(fs2rmxrpno4olen iciytfa rl( snt0trtoxr3ta1fmD  nesl()teurxm3oy1altemnesls)a2raumo;o0oltnmo3ilsla2elumo;u)alxnxr3oodoateau il(0 exo(opou1op nmici ()arraxront0oleo ieild m2rauvpn()tetnmociytfaDr uei;t0sexo(m nodlpeemfvt (f Draur no1olen f3iyd s ran onu4 reoxocoydlmtelnvi;t) eto(m nudapt lfesltf rua(moot1tpt io3tyt a2el(vo t)altoxf oa1lmDeln slt)s2xoxm3iodlme  feilsfa2urur ;u1tpxomf3ilslm ua(vo (4artnxf tadlmtran o;s)t2trim3ou1al e ies s)sDrm(mp;t0opto fciysla emuvo;u4trermo iy1om   n o (0t2xoxr3io4amtemiciat) Dtr(mpou0aleomfetasfa2ul( snt)arenio oodla  ai i;s t2uoxrpou1oltnmneiatfaDuax ono0apenmieilsfa2umnvs (4 rtrmo3todoptr ivils0 rxoiopoo4ome mnvtls a2urur no4alxo fciatlmDum(vs;t0 reoio3ia1fmD ai i;t  etmxmpiy4lmtnmicsas)a2rrxmpnu4ape io3iytlsDumnvs;() ltomo tydlat  u i s trxoxrpiodlmt mnetltfs2um(  ;o1ole ifcilsfs2ua(vs (4arxnir iydopD ai ols0 exr(r3oydap elnesasfa2um(ro;o1opxn octydfm2ua(vsn(0aexnmf iytoaDe n sl() exm(o oy1apen fcslt arurxrpou0alxoiociysfs uluvp u4alerxf iadomtrliei;t setoio3oodaptnlfes s sDuaxmo;u1teto iciad a2rm(vp ()teenxr iatoaDr nes;( s2tr(o3io1om e ivsltfs2ur(  ot0altoii3tldlm emnmo t)tlerioctotopte n s;t) ruo(mpiydaleemfctat aDua(rono1aetnifctasla umu p u0tlxrio iodlpt aneolt sruo(r iy4lme mfci (f Duru pnu1oexoioeiasfa ua(vo u)aetnmocio1fmDeauesls texo(opoudlm nmfvtltf ruaurpou1oetoii3iatla2rln p t) exomrcootfa eaueslt trxmir3oudal nlivs t) Drrxr ou4ape mo3iaslsDeln p (4 lxoir oydoptrln s;s0 2xr(o ou1llte nctat) Dta(rp;t1olxnmfctydla ea( pnu0 lxrmo3oa1lm eli i (  2urxo oydoptnmnetas) rrrxmont4ape if3tytls ua(mpn(0 lxoxociatla   neo;t0setrimpiodlptn ncsa() Drrurooo1teeo i3iad s uluvo u0aeenmfcoy1laD ai i;t t2toxm3nu1altelfesl(f rtmu  ;t1opxomfciatfaDrlnmsn() leoio tadlate u il(0srto(o3oydamtnmnvt t) 2rr(mo;o1oleo o3tydls rm(vs;t) etnxo todfp  aies (0 2uoxrpoudap e nvt ()srrrx pot4apxnifetydfmDra(vpnu4teerxfctytfm  ln sl( s2xrxr3nu4lltn ivia(f 2rmx poo0apenioctat a uluvo;u4 etrxo3ty1fpDr ueo;(0tetmxo no1om   feias  Dtmx  oo0optomoeildfs elu ont4teeoxfcoydoatr neslt trumxopnu1open ieslsfsrua(  nu0tltn ociyslm emnvon(4 rtomrciytom elnvi;s0s2xm(o3iy1lmen ictat) rrauroot0tleoio3iatfaDua( p;t)arxrif3to1fptranvi s truo(o nydlp  lfvias srtm(monu0tpxoii3tydfa el(mpnt0altrxrcoa1oate ieol(  2urxmpoy1lptemivtas) 2ua( pot1apxoifctatls ua( s;t4trxnir3ootlateli sls)t2uoim oy4op  lfetl(faDtaxmpou0olenif3iyd aDeanvo;()tltrio3iydoaDe ivils)teuo(r3ou1ale  ietat aDrax  ;o0oex if3tatfsDrl( p t) eeoxfciodlmD an o;()seuo(r3iydoptnmncsa(f rraxmoou0tex  octlsls2ra(mo;(0alermr3tadfmDr ueo t) exrir3ou1alt mnct tfartmxrp;o1alen feiat aDelumsnt4altoxrcootfmD  n o s0s2toxmpnu4lp   fvta(fartmuront0tlxomfctltfsDum(vsnu0tetrxf3oydfatr nvilt s2uoir oo1om e ictas  Drr(rp;o4tlenii3iadlaDrlnms u) etrmfctadoa elu s;s0sruoxopoo1opee fcslsfa2ur(rpot0apxn octytfs ul(mo;(0 rtnmf3ty1omtraieol( s2toxm ou1al nmnvtl( sDtaxr oo0ape mictldfm2eluvs t0trxoxocoo1op r ueo t0s2xrir3ou4ope  iesas)s2urum ot4oeeoiociyt a rl(vp u4 exoio3iytlmDe uvi s  2urir iu4lltnlfci sf rur(m ;o1olen i3iytfs2uaumpnt0artomocoodlmt li il() rtmxm3nu4optnmfvt tf 2tr(r nt1tltnmf3tyslmDrl( o;u4 rermf iatop  aueo;( s2uo(rpio1oltnmnvi (  2rax  ;t0tlt mocildls umump;(0alxrir3oydlp  au sl()trurxm3oodlpenlnvsa(  2rrx  ;o4tlxoioctysfsDemums;t) rerif3ia1lmteai o s0 exmir3oydaptelivias srra( p;t0tpen fetltlsDea(mo;(4aetrmr3tatla  aivi () 2tmxm iudap  lietlsfsDuaxmpoo4optnmieiatfa2elump u0aeeoioctotfpD livo t trtmxm iudlpee nviasfa2rmx p;o1tlxnmieils mDumnvon() ltrmr ootoate u o;t trtmxo3oodapt lncsl( aDrrxrpnu1oeenmi3ildfa2rm(vo;u4trerif ty1fp e ieo s0s2ur(mpnu4ap e fetatfs2tau pou4aex mf3tltla2rauvpnt4aeeoircoatopDelu o (0trtm(o3ny1lle lfesl()artrxr ot0oltniictlslm elu p ()trxnmo3totfmDranes s0 2urxm3iu4op n ncias)sDtau  oo0oexnmf3tatlm uan o u0 rtnxr oytlatelnes (  eurxr3oo4omtnmivta( sDumu oot1tlt ioctas a rlnvp u)texomrctatfat li ol()t2trir3oudolt  ieiat)a2tmx  ;o0ope ifctltla ul( snt) lenxr ootfm  anes t0 rxmiopiu4lp   ietl( a2taum ;u4olt ifeiadfmDeauvo t4tlxrxo iodoatean i s trtoio3oodop elnvt s  Dtrumpnu1teeomfctys s ulu o;u) etnxr to1la r i sls setm(o3iy1lle  fes tf ruax  no4oetomfeilsfsDem(vs t0 exrmr3tydlm  aivs (0trtmim3ny4lptelivia( a2umxm nu0teenifciyd s ra( s u) etoifcoo1opt au o ( srxo(opoodoltelfeias)artru pot0alx if3tydla2rlnvp (0arerxfcia1lp e i s s  etrxmpnu4ome  ivtat)aDtau pnt0oexn feild s2uluvpn()trtnir iydfaD livi s0t2xoim io4lltemneilt) rua(rooo1alx if3iatls2emnmo (0trtnmo oy1oa  lueil() rumimpou4omtemiviatfa2rmu  nu4teenmictytfsDemu pn(0tlerxo io1om   ivols0texr(opnu1lp n fet s arrrx pnu0tpt iietytls umums;(0artrmr tatopt  neo t srtmim iu1opeemiei sfarta( p;t1alenioctysls2ul( sn(0altnir io1latrai olt0s2xoir ou4lmee fcia( aDrr(  nu1oex iietldfm ulumpnu0altrifcia1oaDe n o (0sexm(rpno1lpte fcils)aDtaurpnu4altn feiytfs rmumo u0 lermr3ia1opt  ivi ()trxo(r nu4llte fvsas  2umu poo4alx  ictat a2ul(vs;t4 ltomo oy1opDe u i s0srtm(m io1altnlivi tf rrr( o;t0ape  fctldfa ulnmp (4 rtnxr3ty1la rai s;t) rtmxo3iu4ape livs t  2tmxrpou4ale if3iys aDelnmont4 lxrifctatfaDelneslt)sruoxmpno1lpen fetl( a2um(r no4tee mictlt mDul(vsnt0teeomocto1lmD  ues;( teto(mpoodlle lfcil()aDrmxm ot0tltn oeiysfm2emu s (4trtrir oodfm r u ols s2xrio oydomtn nvslsfsDuaxroot1oleniieilsla rln p (4aexrxoctadoptraivi;t0 rtr(o nudlpte ivsat)srum(  ;u1apto iciydla el(ms;()trxnxrcio1latraivs;()tetoxm iy1am nlivil()s2um(r nu1ope mietydls2emu o;t4aexrxf ootlaDr ivils  rurxr3oydlpeelnviatf rraumpou0olxnioeiadla elnmp;() lxoir3oo1fat aivsls) eto(m oy1ale mfvsl() Dumx  ;o0tlxomfctadfs2eanvp;u)artnio3ty1fp r uvsl(  2umirpio1lptelnvt t)s2tmu o;o1tle if3tytlsDumnmo t0 rxrxo iatfpt auvols teumiopnu4lp   nvtltf 2trx  oo1alenmo3tyd a um(mp t4 rxrif iy1lpD  n ilt)srto(m3iu4ol nlicsa( aDtmxmoot0apx  ociatlsDrl(mp;t0treomo totop   uesl(0 2toxopoy1amtnmfesl() Dtm(roou1oee mieiadfa ean p u)aexnif3iadfm elnes s0 rtm(r oo4lmt  ivsatf Draur oo4alen f3ilsfsDranvsn(0tltrxoctatoa r uvi () 2to(r3no4ap n fctat)sruaxr no0alxnifetyt s uluvp (4tleoif oatomt ai s;(0srxrimpou1llt mnvtlt  Dumxr nu0ale mo3iasfa2eanmpnt0 rtnxfciadoaD ln sl( s2trir3iy4al  mnvtasf Dtmxro;t1oeeo ieiat mDuanmpnt)trxrmo ia1om   ues;s)trurxo oudop emfetltfa2taxrp;o0tpxoioeiysfa2em( o;(0trenmfcia1fmD lu ols)srtrxmpnydlp nlfeiat srtm(mono0ape  oetadls2umuvont0 eerxfctatfaDelneo s seurxopoudom nmfvtas) rrru ono0oexo ociytlaDul( p t)trenif3iotlpDrau s s t2urxm ny1lme lncsa(fsrta(m ;t4oleoioeiyt a rluvp;() ltrmrcootfateaneilt)sexmirpnodlmee ivtltfsDua(mpnu0alen o3ild s2rlumo u4tetrxfcio1fa r nvs () ruo(o io1ape mnctat  2umx ono4oexomoctlt s uauvp;t)artnif todlp rauvo;() 2xoxo3no4alenmivt t a2ta(r ot0tle mo3iysfa rl( p t) ltomo3iotfpt  nvo;t  2umxrpoodoptn neilt)a2taum ot0aeeomf3iysls rlnvs;t4arxrmocia1laDelnvils t2uoxr ny1lmtn nvsa(fsDtaump;o1tlxn fetytls2rm(vs (4aetniocoatom rliei s0t2trimpiu1om emnvsls)aDrrurpoo1oex if3iytfa2rmu s t)altrxfciotfaDeai ol(0trtrxo iu4lp emfviatfa2tau oot4tlx  icildfm2el( o u)tlxrmo oytfm   n s s0 rxo(opny4ol nliet t arrrxmono4teeoiietysls2umuvp u4tltrmf3oodoa   ivo ()seur(m3io1ol n neil(fsDrm(rpno4tpx  fetyd mDemnmo;t4aexrxr totlm eluvols)s2uoim oodope lietltfaDurum no4opt  o3tytla2rluvp;()trtrir tydlp elieo () rxmir3no1lmenlnei tfa2rm(ro;u0olx ii3ils mDrlumo;t)trerxfciodfptrauvs;() exr(m3oodlpen ieslt)srtau pnu1aexoiicilsfs uauvo;()altnxf oo1omD  i il(0srxr(opiy4ap n ict t arurxro;t4oeenio3tlslmDrmnms u4tlermfcoytlm ranei t texoxmpoy4ameemncsas  Dra(rono0tpxomf3tysla eluvs u) exoxfcoo1fp  luvi;t)tetmxo nu1amee iesa(faDumxm ou1aee ioetyslmDrln p u) rxnmo3tatomDeauesl( t2xr(o3nu4lm e iet tfa2uaurpou4oetniiciltlm2rmumsn()alxoxoctatoaD  nesl( sexo(mpou4om nmfci t sDur(mpoo0optn feiatfmDrmnvonu)tetrxfciodom elueils teurirpno1apt mfvta(fs2ta(ro;o1tpxniietadlm umn o u4teeoxr ty1lat au o s t2xoxr3iy4amee netatfs2umxm ot0tlxnmfctytfa elnvp t4tleoif oydop e ivi ( srxo(mpou4ole liviat)sDur(ro;u4opxo ietat a umu s;t)trxrmf tydoa rln s;(0s2umxr3oy4aptnmnvt t  Dtmx  ;t4tpxoifeiltfm2uau sn(4 eerir oydopDe nvils) 2trxo3ou1oltemfvtl()arrr(mont4tlx mieiat s uan o;u0tetrmo3io1fpDrauvolt0trxmxmpny4om nmiciltfs2raxr ;u1texn f3iytfs2elnvs u4 eeomo tatlm ran ols) 2tr(rpnu4ap elnct s sruaxm ;o4olxnmieildfm rlu o ()alenmo3iotla e i sls  2tmir iudomtelietls)sDum(r nu0tee mi3ilt sDumn pnu4aexnif totfptelneil(0t2umir iu1lmt  iesls  Dururoot4olen oeildls2ra( pn()artrir oy1faDe nvolt  2ur(rpoy4lpeelfvilt sDrmu pou0apx ifetltfs ulu o;t0tlxoif tatfmDrluvo t) 2trxm iu1opee iviatf 2taxm ;t4tpt mfeilsfsDumuvs u4 reomf ta1opDr ueo s0t2xr(o3iy1ap nliesls)s2umxrooo1tpx ii3ias sDeanvs;(0trtomf tatop eaneo s0s2xmxr3oo4apeemneils) Durxm ;o0oexnifctatls2raums t4 leoir io1oatr nvils)teur(r nu1lpenlnei s  rraump;u1aeeoioeils sDelu p;u0aetniociy1faD  neo;(0srumxr ny4op n nci (  Draxmpnu0optnii3tyd aDuan snt0 lerxr iodla rlu s t)trtoir oy4llt  fcsls)a2rmxmono4altniiciysfa ulu p t4texrmr3to1opt aneol(0 euoim oo1opte fvta(f rurxmpou4tpt mocild sDuau onu0 lxrmr3oa1omD  nvo t0 2uoxm3iodoltnlieiat) 2rmxmpnt0texn o3iytls ean s;u4 etnmf3iy1op ean i (0srtoxr iu4llenmietl(fa2trxroot1oeeo i3iatfa2rm(mp t0 rtomr oodoaDraues t0tetr(mpiu4llte fvt sfarrrxm ot4tpeomoeildfm2rm(vont)texnxoctatoa eau i;t)teuoir oy1al emici sf rua(ro;u1oexn iciadlsDrmuvon(4teenifcoydopD  ueols0seumir iy1ap nlfci t) Dur(r ;t4aptnmfctlsfs2rmnvs u4altnmocto1laDelu i;(0t2uo(r3nodal n nvt s)s2raxmpot4olx iieiltla2ean o u)teenmoctytfatraivs ( setrxmpnydolenmncsls)arrm(ro;u4tpe mfeiysla2rl(vonu0aexnio oadfm   i sls0sexr(o oodom e ncil() rumxmpot1olt mictltls2umump t4 lxrmoctydom r nvo ( t2toxm oo4lp n fcils a2ururoou4aleomfetys aDelnms u)arerxrcoa1fpDrli olt0trurxo3iu1ope  icias  Duaumpoo4oleomi3tlt a2ran p;()aexrxr tatlmtrli ils0srxoio iy1om   neia(f rtau pot4oetn octad a um( s u4tetoircoydomDrauvol(0trurxrpny1lmtn ict (fa2uaumo;t4oeeo i3iad aDel( s ()aexoxfctodom elies;()tetr(o3iy4olee feilt) rtmxr oo0oltnmi3iytlm umumsnt0trenmr3iydopt an i;t trum(m nudam e fctls)s2rr(m ;o0teto ocilsla2rmnvp;()alxomr tytfatrlivi t0srum(mpio4om emnes ( aDrrxr nt0tpt ioeiatla ulump t)aeenmr ty1fmDr iei;( seurir3nodlp n ncs ()aDur(mp;u0apxn feiytlm2ua(msnt0 ltomf3totfmte nvi;s  exmxo3oudalee fvslsfarta( p;o1ope ioctyd m ra(vp u)treoxfciydla  auvils)tetr(rpoydal nlicsat aDraxronu1alt iietaslsDelnvp;u) exoiociadfm  livi t srtr(opou4apee fet ( a2rru poo1aeeoifeiysfmDranvs t)altnxfctotla raues;s) 2tmxm ny1amtn ictls arrr(mpno1tee iiciydfa2rauvs;u4artnxocto1lat ai sl(  2uo(o3iy4amenmncias a2ur(mp;u0tlenmoeiytfs eluvont0alxomr iytopt ai sls0srxoir3oy4lm e ieils sDta(r nt1altoifeiadfaDul( s (0 exoif ia1omt lnesls0trtm(o3nudlpe  ietls)a2tr(r ;o0aex  f3iatla2em(vp;t)teermocty1fmtr ivsl( trur(r3oo1optnmiei t  2urxroot4tlx  octysfa elnmp;() exoio3oatomD  uvsl()t2xoirpio1lptn iei tfs2urx p;o1apxomietldla2umu on(4arerxf3io1fmD  n o s)srxr(mpno4lle  neiat)a2ra(mpnu0opt iiciasfs2ulnvp t) rermrcoydlp r nvi s setoim nu1optelnvsasfsrraxroot0oltnmfetytfsDumums;u4tlxoxfctadla   ueo;s)t2uoio ou1ole livsltfsrtaxroot1apxnmoeiad aDrau pn()tlxnmrciatlp e i ils) 2xoxrpoo1ame mnvtas)aDrmum ot1apeniociys m2rlnmp t0 leoif3todlpteai o;s texrxm oodalenlfvsl(fs2um(m no4oet mo3ild s2emnmo;u0 exrif todopt lu s;t setr(o3oudaleemnctltfs2rru p;u1altn f3tldlm2raumonu)teenmr3oytla rln il() exmiopoo4lpe  nvi ()aDuax o;o0tltn fciadfa em(mo;(0 renmf oo1lptraies t0texoirpnydapenmfvil( srrmxrpou0aetnii3iydfa2um(vo t4tetriociytoa rli il()t2tm(mpiy4lp n ieslt) Dtr(mp;o1oexnifetld m emu p t0 etnxocootfmteln i s0 eur(rpny1lltn fetltf 2uaxronu0tee  oeildlaDuan ont0arxnio iytoa  au i;(0t2xr(r3ny1ol  mfcs s srur(r ;u0tet ioeiydlm rm( p;u4trtrirciytoa eluvo;t0 eum(opnydameelfcsas sDrrumo;t0tet if3tyd s2elumo t)aexnxo3iodlpDe neslt s2ur(opio1om emnvils sDtmxmoot1tle ifeiyslm ea(ms () rtnxr3ta1op  lieolt setm(m iy1lptn feslt  ruaxmonu1oetnioctls sDel(vo;(0tetrio3to1fatelivi;s s2uoirpiu4ol eliviat)a2ua(ro;t1tex io3tys aDeln snt0arermo3iodfp r n ilt0 etmxmpiydlle  neilsfaDua(r ;u0ole if3tyd aDulu o u4 exrif tytfmt livs;s  rtmxopoo4lmtn fcs () Dtaurpnt1alenioetadfm rmnms (0 exoxr tydlaDe ies;s0t2urirpnydom  mnvi s sDrm(ro;o0altoio3iadls ra( onu0trxoxfciadom e ieo;s)srtm(m3iudale lictl(faDur( pnu1tlt  ieilsla2rauvont0tetrio iatlat liesl(0t2tmirpoo4ll nmictatfaDua(rono4teenifciydfsDemuvp (0texrifcio1opt luei ()s2um(opnu1lmee fvtl()aruaumooo0tlto ieiatla emnms;(4aeermo3iydlat anesl( trxr(m3io1lmt lncsat) rtrurpno4oeenmi3ilsls2umuvo t)tlxnxr3iydfa  luei;s texr(opnu1ol emivs tfsDrrxro;o1aee  ociytls2eanvs;u0arenmo oo1fpD ai o;(0t2umimpnu4omt  netlt) Drm(  ou0olxomoeias a uau o () eeoif tydoa ean ol(0tetoio iudope  fci s) 2ur(rp;o4texn i3tldlsDrlu s;() eenmo iodoa e ueol(0truoiopio1ope  ietlt)srtaxmo;u4teeomoctad m2el( s;t0alxnir iadfa e ivols t2umxo3oy1aptnmnctls)a2rau ont4oetoio3tlslsDumn o;(0trtomoctotlatr nvs ( trxr(o iy1optnlfcsl()s2rr(ront4alen f3ildls2rmnvs u) etoxo tydlat ln i t sexrxo3oydomeelfvsatf Drmxmoot1texnmo3taslmDra(mo (4alermo3ta1oa elneil() eumimpiu4om elivsl(  2trum nt4optnmictldla rmnvp u)arxrmr3ia1lm   uei t setr(mpiy1lp   ieiasfaDuaxmpou0apeomi3tytlaDrlnmsnt) eenmoctytfm  aieo (0sexrio ou4lmtn fvs s s2tru oou4apxnii3tytfm2ran sn(0 eenio tydfpD aieo;()sexo(m ny1omtelnctas)artmxmp;t1opxn ictadfs emnmsn(4 eerxr3oatlaDrlneslt) eum(o3oo4ale mncta()arrru pnu4tpenioeiys a eauvpnu)treriocoadoat  ivo;s)t2tmir3ny4llt  ietat a2rrxrp;o1tpxn oeias a2eln o t) eeomr3oydlmDrlnvs;t)tetmio ou4al elfvi sf rraxrpnt1opt mfeilt mDel( p;u)artniocio1oaDranvslt teurim nu4ol  livsa(fs2rmxrp;t1opxo ieiysla umn o;u4 ltrxociydfmDr i i;(0 2urim3ny4lptn nvtas  2tmxmont4olxnifeiyd s rlnmo () ltniociodopte i i;t)srtoxm nu4lpee iei t arum(rp;t4tee mfciyt aDum(vp;u0 ltnxociatfpt au s;t0 2xmxo iy4llen fvtas s2rrx ono0aeeomoeiys m uln ont)aexnxf tadfptrlnes;s)t2xmimpoudlltn fvils)sDtrxm oo0tpeomfcild aDua( s;()alermf3todlaDr ies t) exr(opnu1optnlicsa(faDtm(mp;t4tetnmoeild m2ea( snt4altoxocia1fm eau i t0t2tmxo oo4lltemncilt artmurpoo4opxomf3ild mDrmnvo;u4texoxr oydom   uvo ( tetrxm3io1al elfesasfsDuaurpnt1tpx ii3iadfmDum( snu4 eeoio3iadfaDelieils s2umxrpny1ape lictlsfaDta(r nu4apt  ietydls raumpnu) eeoxo totlaDr ueo t)s2um(m io1aptn fvia() rtmxmo;t4aexoifciysfsDeau s t4areoif3ta1fpDe uvs;t setoxr oo4lptnmnetls aDua( o;t1tpenioctasfaDea( o;t0aetrxfcoodlatrln o;(0 etrxmpiodope  ncslt  rtax  ou4tpx ifctls a emuvp (4arxnmo todfm  lneil(0 2xr(mpou4amtnmiei s srum(root0tlen ociysla2uau pnt4 rxoxf oy1lp eauei;s sexmxopny1omtnmicia(f 2umur ;o4aeen f3ilsfm2emnvo;u4 rtrifctatopDrluesl() eurim no1lle mncs s) 2trxm nt4tleoif3tad mDrm(mp u4aetnif iatlaDe n i t0srxrxr3ou4lm   ivt t)a2rax  oo4tpxomoeias sDulnmp t) rxrmfctodfpDeanei t) etr(rpnu1lle mfvs tfa2ta(rpnt0oltnmoeiysfs rl(mo u)aeeoifcoy1optrauvo;t)t2xm(m3nodopen fvsas) 2tmuront1tpt mieiatfmDem(vpnt0areoir3tadfm r ies;t0 eurxo iu1al n ietl( s2urxroot4tpxnmf3iat aDrau p (0texoxocoy1lpDelivi t seum(mpnodam nlivsas)sDrr( pnu1apxomoctatfm ea(vpnt)tlxrxr ia1fmD  uvi;() rxo(r3io4openlncia( srurxmoou1tpeo fctyd s ul(vsnu0 lxnxfciydoaDr ies;(0 rtoxrpoudam nmfcta(faDum(r oo1olt ioeiatlaDrmu s;u) eenifcoydlmtrlivils0t2xmio3no4omen nvsa() Duaxr ot1openmicilslsDeln s (0artnmr oytlpDean o t s2uoxopoodlme  neta(fsrrau onu0tpto ictltfm rmu p (4trenif3tadlaDrlnvo s  etrxm3iu1ameemfcil()a2uaumo;t1olxnmf3iatlmDem(vsnu4 etnxf tadoaDrauvsl() 2xoim oodaltnlnet t srrr( o;o0aexomieiatfs2uaums;t0aeeoio3tatlpD lnes;t  exoxo ou4am   ictltfsDrm( onu1olxo ociyd a2emu o;t0aexoiociydfate n i t0 rxrxr iudolt mneiatf rrmxr ot0tpx ii3tyslm ea( snu0aeeomr3iy1lm  anes t  2um(m iodlm nliciasfarurx p;t0oltnmieiyd aDrm(vsnt0trxnxf3oodfpDeanvils) rxo(o3iydom  mfcia( a2rrum oo4olto feilsls rmnvpnu0 lerxo iatfptean i s) 2tm(m3iydopenmiei t)arraurpnt4tltnifeild aDrlums;t0texrxo3iatfpD  n o t) 2umir3ou4ol e ietlt artm(rooo4teenmociytls2ul(vp t4tetnxf iytfmDean s s0 2xmim3no1om e ncsls)s2taxm nt1apeomo3ildfs2ua(ms u4 eenir oa1lp   uvs s) rumxm no4ol   neiat s2rmur no0tptn f3ild a el(mp;u4tlxnmf iodopt au o;t0 2xr(r nydlptn ivslsf Dtm(rpot1aeenmfetls mDulums;(4tlerxr3todom rluei;t0 2xmxm iy4omen ieta()a2ta(monu1olxomfciytlaDrmnvp;() rxrif3iydlmte i i t)s2tm(m oy1ap n ivi ()sDuaxm ot4opxo o3iatfsDrm( o;()trtrxrcoatoaDeauvs;(0s2tmimpio1lmeelici s)srra( pno0tet  oeiltfm2el( p;u0arenmfctydlmte neo t)srurio3oydapenlivsat  rrr(  nt1oee  fciatfs2ran o (0texoxf3ia1lpD aieol() 2um(opny4ome mnesa()s2trxmo;t1aptnmf3iasfa2rluvo (0alermr ootlm rln i;t s2xmxmpnu1lmeelivilsfsrra(rpou4ale  ieildfsDulu pnu4 lenir3ia1lptr ueo;s teuriopiy4lm  liesl( srta(rpnt1tlx ioeiasfaDrau p;t)arenxrciadopD  ies;t0s2umio3iudlm elieiltfa2rrxm no1opto feildlaDemu s t0 rxoir ty1fptranei t0 2xrimpny4ap  mncsat)s2trur ou4oltnmfctat m uaums;t0tetrxf3iodlmD  nvo;s trurir ny1lpte fctls)srtaump;t0aetnmfetltla el(vsnu)teeoiocoa1lm e i i t)srurxmpoydoptelieil( srraum ot4aexoifciasfmDea(msnt)tltrmr iytlp  lu s;t  ruoimpoodome lnvtatf ruaurpoo4aeeoif3tyd mDea(vp;u)aeeoxo3totfp raueils0srtoim nudol  mfciatfarrau onu1oleoifeildla ua( pnt)aeeoxrcty1opte ueol( s2tm(r iu1lmee ieta(  rur(mp;o1tetnio3ildfm2rl(vont)arxnio3io1lat aivol()seuoxmpiu4op nmncsatfaDrmu pnu1texomo3ildla2um(vo;() reoxo to1op e uvo (  euoxmpoudoltnliesas sDum( onu1tpe  ocilt m2ranms;(0arenmo ta1omD aieilt0srxo(o nu4lptemfvtlt) rtmxm ou4oetomo3iydlsDeln s;t4tetoxf3iotlpteluvi ( truoirpiy4al n ncs tf Drrumo;u1opx ifctydls rau p;t4tlxrxo3to1fp rau ilt  2umxr no4oltn nvs ()arum(monu0oet mf3iys m2elnmonu)trtnmocoatla r neo;t  2to(o3oy4amte fcta()srtm(mo;o1teeoifeils mDeaumo t)aetnmrcoytfmD aivolt0 2xrio oudaptnmfctlt aDtmurpou0ole mi3tydfs2rau snu0trxrxf3oa1omt  ivs;t  rumxo3oodlmtelivias s2raxmpot4aptomietad a2elnvs t) renxf3oa1fatr ieol()s2trxrpnu1am elietas) Dua(m ;u0olt  i3ilslm2eln p t4aleoir3tadoaDrli sls  2tm(o io1lmenmfctls a2umurp;u0aexomoeilslaDrlump;(0 eerxo3todlpt lieo;t0 eur(r3io4aptnmfcsat)arraump;t4aptoiocilsfa rlnvp;u0arxnmf3iadom  lneo s) exmimpiy4lltemicilt a2tm(mp;t0tltomf3tytfs ua( pnt)alxnxr tatomteaneo ()trxrirpoo4ll  mnei s  Drmxm ou1teto f3iydlmDeluvsn(4 eerxf io1fm rluvo;t)sexoio ny1lm e nctls) 2umu p;o4tptoioeiltls2em( pn(4trtoif iadlmDr uvo t setm(r iu1opeemicslt)arrr(mpno0tpt mocildfmDran p;t4arxrmo3oo1laD  ies;s s2uo(o iudlptnlivi ()srrrxrpnu1oetnioctytla eln p;(0artomociy1lmt  n s;t s2trxm3nodoltnmnvt s)a2umxroot0tlt  f3tad sDuanvs t0trerir3iotoptrai i ()tetmir ny4ll nmiei sfa2tmuroou1texnmfcilslmDel(vp;(4 exrxr oo1fa ean o ( t2umirpny4omt  ivt sf 2rm(r oo4tltnmictytlmDuau pn(0altrmo3io1op eauvsls setrio3oy1lpe lnvia() Dtrx ono1texnmfeiyt aDuanvon(0trxomo tytlaDeaivi;s)t2urxmpoodoptemicilsf 2rm(rpnu0tleomietydfm2um(ms t4trxomf oatopDrlieo t) eurim nu1omen fcil()sDrauroou4oetoioeiytlm2eauvsnu0aeenir3iotlp r u o;s)s2xr(rpoy1altnmnvi ( s2um(rono0olenmocias a2rlnvo;u4aeeoxf3iytomt  uvs (  2urxo3oydal nlnci t) rtr(m ou1opeoifcilt s2ranmsnu4tltnif3iytopteauvs;s0 exoxrpiu4ole mncia(f 2ua( p;u4oex mietldfa um(vpnt0alxoxo ta1fpDrlieil( teumxmpnydlmenmfcs ()s2um(mont0aptn ieiyslsDel( pnt4aetrxocia1laDr u o s0 rxrxo ny1ope  nvs ( srtr( onu1apenioetatfs2uaumsnu0 lxoiociy1faDelivo;( t2ur(opoy1opt  ncta(f 2ur( o;o0tetnifciytfsDulums;(4tltomf3todfmDe u o;(0teurxr3oudlmenlivtat) Drr(  ;t0apenii3iad mDemnvpnu)tlxrxo3iotlp ean s s s2trxm iu4llt  nvils)arrrxmo;t1oleoiiciyt mDua(vonu4 rtrmo iydom rluvslt)trtoxm oy4al  mivsl(farta(  no4tpe iociasfa uanvsnt)aexoxo3tytlm eaivo;t t2tm(o3oo1lltnmncsl( sDtru o;u1tpenmi3tldfsDumu pnt)aexnxf oy1omDe n s t) rtr(mpiydalee icilt a2rm(mpnt1texn feiasls2eauvp t4aexrxr3tydoatran ols)srtrxr nu1am n nei s) 2trxmpno4alt ifetasfs ulnvp ()aeenmfciadomD ln ilt0 rxrxr3ny4alt lnctl( artau oot4tltomi3iat s2eanvp;u)arerxociytfm   nesls)trtoiopnodolt  iet (f 2taxmpnt1aexniociaslsDuanvpnu)tltnmrcootopt anesl()seurim3nydlp  lfvt (  2ta(m no1aleoif3tls aDrm( snu4 renxo3oadfmt lu o t s2uo(mpio4lm   ncta()aDumumont0oex mo3iadls2rluvs;()texrxo3iatfp rlieilt)srxr(r3nodoleemnvsls)a2tau p;u0oltnmicildfm2um(vpnu0aexoio3iydomtr ivs (0srto(opiudlpt liesls)aDua(root0alxn o3iat m emnvo t4trenir iadom eai ilt) exoxrpno4lpee ieil()arurx ono0altn oeiydla2emnvp;()texoio oodlmDrlneilt)s2ur(opiu1lpt  ieiat srrmumont0tpenio3tyslmDulnvsnt4teerif3io1optelnes s) rxmir io1apee nvsa(f Drru p;t4tex  ietas m2ul(vont4 etomo iadfpt au i;s)srumxmpny4ape mncs (fs2rrx oou4olto ieiyd aDrm(von() ltrir oodlmt  uvs (0 rxmxr oudlp nlici tf 2rrxm ;u1oltn ociytlaDrm(mo;t)aexomr iatop r i o;(0 eurxm nydlmtemneils s2raur ot1texo ietldla em(mp t)tetnxr3iadfm  luei ()trxmxopiudlmt  nes s arur(rono0olt ii3iydls2emn p t4 exnmrcty1la elues s0trur(m3nodlmenmiviltfa2tmx p;u0oleniicild s rlumsnt0texnio iytlmD lu s s)trxoxmpoo4omen neslt)s2rm(ro;o4tpen fctadfm2rlu s t)tlxrif3totlat aieo;t0teurxmpoy4ale lncsat)sDuaxrpno1opx ioctat m2rauvp;()tlxnxo3oytom elivsls) rxmim3nu4lme lnes sfaDrr( oot4oltn ictydla rmuvp;(4aleomf oadfp rai ils trtoim iy1amtn ici ( s2rrumooo1tlxnifeiyslsDraumo t4 rtnxf3tatoa eaivilt srur(r nudap nmicslt a2rmxmp;u1olenmiciydfs um(vsnu)alxrif oo1fmteaivo;t)srxoir3oydal n neils) rta(m oo1aex ifetysfa2elums t4aexoxo3iytfatrauvi;()s2xrio iy4lm  lici t) 2tr(r ;u1tlto i3tydlmDean s t4 rxnio oodlatrlnei;t0 rtoxmpiy4omen ivsa( a2rm(mpno4aet  iciytls rm( o u4 exnxf3iatlmt auvi ()tetmxo iu4lpe  icils  rum(mono1aptnioeilsfa rl(vpnu)trtnmo3oa1op e ivs t)srtrio iydoltnlfcsls a2tmx p;t0tpeniieiyt s ranvs u4 lxniociadom r u s ( srxoio3ny1omtnmivta()artax onu1olxnmiciadfa2umn o;t0tetnmr iydlp  auvo s)t2toxo ny1ll elfciat)a2rrx o;u0tle  i3ilslm emnvs t0aeeoif oytoaDraivi;t)trtrio3io1lp  micils)aDtrxmpno4olt moeiytlm2ulnmp;t4aleoxr oadlm eaieilt0s2um(m3iu4ol elietlsf Duaurpou0olenmietlslm2ran p t)tetnxr tytfpDe uvi t  exo(r3ny1lltemictlt)srumxm nu4alenmieiadfm2ea( pn(4 eenio3ootomDean s t)tetrxo3oodlptn nvil(f ruaxm ;t1tlx  ociyd a2uan onu4trxomr iatoptrlu s t)srxrxo3oo1lpenmnvtltfsDta(r ot0tltomi3iaslaDrlnmpnu4arenmf3iatomDelnvi ()trtmirpoydlp nmncslsfaDtr(r nt1tpt mi3ias s elnvs t) etnif tadfa eanvo (0 2ur(m3oodal nmictls 
\ No newline at end of file
@@ -0,0 +1 @@
+i s t)t2urxopoy4al elfcils)s2taxmo;t1altoioctlt s ua(mp t0 rxomf3oo1opDe u i t)teumxrpnu1olt licils a2um(m ot0tpxo fctlslm rau p;u)aeeniocoatla r u s;s0trumir3nudoptn ivs () rrr(mono0tpe mieiltfs raums;(4tleoxf3tatfmD  uesls0t2tmir3nu1optnlncilt  2uaxrpot4olen ociadfm2rl( s (4 lxnmf ia1omtrlueol(0srxmxmpoo4al e fci s  Dtm(ront4oee  ieiadfa eanms;t4treomr io1fpte u sls0t2urir3oy1lleeliet tf 2taumpnu1tpxn f3tldls2ra( p ()texnxfciadlaD li s;s0 exmir nu1altelnvs tf Drmxmo;o0openif3ild s ulnmp;(4trtomf totom  an o;t)srxoimpnydlmtemfeta(fsrurumo;u4optnmi3tydlaDraumo t)areomoctadfmteanesls) etrxm iu1optnlfvtl() rurump;u0aleomfciys mDrauvpn(4texrxo iydop  lueil( s2tmimpno4open iei s)sDtmxrp;t0teen oeiad mDem(mon()aleomf ootlmtelu i ()s2tmxr oodapt mietat)srtru pot4aleo fciyslmDeln s u4arermr io1fpD ln s t)srtrimpnudopeelicilsfa2rr(  oo1tpeomicilsls umump;t4tetnmf oy1fptrai i s0s2ur(opiu1oltnmics sfsDuaxront1oeeo o3iasfsDeln ont0trenxf3iytfaD lnvs;t0 exrxr3nu1apenmivias) Dtruronu4tet iieiytfs2el( p;(0 eeoir io1lm e ies s s2tmxo3oo1optnmnei () Dtrxrpot0alt mi3tldfaDraumo;t0trtnifciatop rlivi t  rtoio ny4apee ivtlt) rrmx  ;o4texniieiatla um(vp t) eenmo3iytfm r u o;t srur(m iudal e ieils) rtm(m nu4alt  ociadfmDuln o;t0 rxrxr3io1fptrlnes;(0 etmio nodope lnvt t aDum(root4olxo oeilsla uluvs t4tetrmf ta1optrauvo;s)seurxo3nu1opt mfcil(faDur(r nt0tpe ifeiadfa raums;t)aeermr3oodomteau s t  rxoimpoy1altnlies tf 2rmxrpoo1oetoioeias mDemnvp;t4alxoxrctydfptraneilt0seumxm3oy4lltnlivt sf rur(r nu1aee mo3iyt m2uan p;u) lenxfcoadopDelues ()s2xoxr nudam n icsa( srtm(  ou0aptomfeias mDeau p;() etrxf iodfateli o;s0t2xrir3oo4lmtelfvi sf 2raurpou1tlxn o3tasfsDeaumon(0tetnirciadfmDrauvslt srxm(rpoo4omenmnvs t aDuru poo4oee mociaslsDum(mo;t)trxrir3iydla elivsls teuoimpiu1alt  ieslt  2ra(  oo1apenii3iadfm ul( p;() rxoxrcootopDeauvilt) rtr(opiu4ale mictasfsDra(m nu4tle mi3tlsfaDrl(mo;t4aexrmrcoy1lptr uvi;s) exoxmpoodame  ivt t  2umu ont1oet  ietlsla eanvonu4artoxf3iy1lp eaieils s2xr(m io1op e ietat) rururp;u4apxomi3ildfa ulnvo ()aeeoxf3iodfat ln i;t truoir io1al nlfvsasf Dtmxr no1oltnmieias a ra(vs t) reomf3todomDe n o t  2trxr oudlmt micsa(f Dtm( p;t1tpx  octasfsDuauvsn(0texoir3iodomtrlu s s)trurxmpoo4openmfvtasfa2rm(mp;u4tex mo3iatfs2uluvp;t)texnioctytlm  an ilt0 exoxopoo1am   nci t sDrmx oot1olx moeilsfsDrlumonu0 eenifcia1lmtrlnvsls0seurir3ou1lm n feia(  rtruroou4tlenifeilt mDea(mp;t0teenmf oodfpDelnvo t)s2xo(o3ny4lmt livtat)sDum(rono0opx iociatlsDrmn ont4tltrxfciadlaDe n ol() eur(o iydlptn fetat srrr( o;t4alxoiocias m ulnvp;u)tlerio3iodomD lueo t  euoxo3iydlmenlnvs (faDtr(m ;u0optomociyslm2ranvo;t4arenir tadomDrauvi ( seurxopoydomtemivia() Dtru o;t1oex  fetys a umuvo ()arxoxr3ia1fpDraneslt0trtrio no4amen nvtat  rrm(m nt0oeto ociltla2rluvo ()altrxf ootopD  nei;s0s2tmxo3iu1op nmics (f rrax pnu1aleomoeiatlm2ua(vp;t4 etoir to1fp rlieo s0srumimpnodapt  nctas  Drmxmoot4opx ifeiadfs emums;(0trtrmo3ty1oa  ln i;t teuoxo no1aptnlfcsa( a2rax onu1tlto i3ilsfaDrauvpn(0 etnmfctatopteln ilt0 euoxm ny1ol   nct t)sDua( p;t1alenmi3tldfm2ea(ms ()teerir3tytoa  ln il( trtr(o nudopt livsatf rurx  ;o4aex mo3ils a2emnvp;()teermocoatla r u s ( seumxopiudlptnlfesasf rurum ou1tle  ieiat aDemu onu0texoif ia1opD ai o s sexrirpoudomte ics s  rururooo1tlxniiciydls2emnvo;u)tltnxr tadlmtr nvils0 rto(r oudlpe  netl()aDta(r no1tltnmf3iyslmDem(ms (0teerircoodopDeaivs;s0 exoxm3nodopt mfvil()sDrm( ono0aptnii3tas m2elnmsn(0trxrif3oydfm rln i s)sexr(r iu4ol e nviltf Dtrxrpnu1tlxoifctlt a2eauvs t)trtrmoctadlaDe nei;s)sexo(r no4omeelictasfs2trumo;t0opxnmf3iad s rau p;t0arxoxoctydomDeaiesls0s2um(r3iu4op emfviat s2tr(ronu1opx iietydls2ea(ms u0trxrmr tadfmtelnes t) 2xoim ny1amtemiei ( s2tau  ;t1aexoifeiydfs2rmumonu) lxrxf oo1faD  ivsl( s2urim3ou1lpenmfet ()sDra( o;o4oee  oeilsfm umn s;t4tlenir3io1lpD luvo (  rum(m iu4apenlfcs t) 2rm(rp;o1aetn ociatfm2ul(vo (4aexnifciotlpDeaivsl()seuo(mpiodaptnmieslsfaDuaxm ;u1olxoioetltls eau snt)alxomf3tatoptraieo;s0 2xoxr iodolt  fcsasf rurum ;u1tlxo o3tat mDumnvp ()alxoioctodlateai i;()t2uoxmpoodlmt lnci s) 2uau  ;o1apxn oeilt a2el(msnt0aeenxo3io1oa  lnei;s srtm(m iy4amte netat  2taum oo0aeenio3iatla2um(mpnt4tlxnmo iytlaD luvi;s0s2urio3nu4open icta() Dta(rp;o0aptn f3ias aDeluvsn()trxomf3oy1lmDr i i;t seto(o3nodol e ieia()aDur(monu1alt mociyd m rauvsnt4 rxomr totfm  aies t0setrxo ou1ap nmieil() ruax  ;t4optnifetad sDumuvp t0tltrmocootoaDeaueilt0teuoiopoudam elicil(fs2rm( ont4oleo fetasfa2ua(ms;u)alxomo oytoaDranvils0s2tm(r nudlme mieiasf Dra(  ot4alto i3iydfsDrlu o u0areoiocoytlmteai o;(0 2trxm oodlme mnciatfarum(ronu1tlxomfetytfa ea( snu4aetnxo ootfa raues t0tetmimpoy4al  mfciltf 2trumpnt1tleomfeiad m eau o t4 etrxr3oadlp e ivilt texrio3nudlpt liei (fsDtru o;u0apt mfciad m2ulu p (0texnmr3todfmtr nvol(0srto(opiu4lme  ivilsfsrumxr ;o4aeeo fctldfs uaumo;(0 rxrmf oadfp eluvilt)seuo(r oo1opt  fes tf rrrum ot0teenioeiad aDumuvs t)altrxf3oo1oa rai o;s s2trxo3nodamt  net () 2rmxm oo4olxoifctltfa2rln sn(0tetomr3oadfp eluvolt0 2xmxm3oy1ol elncsa()aDua(m oo4tpxnmfetlt m rlump t)trxrmocootlaDe u i s s2xmirpiudlleemfvta(  Dtr(  nu4tpt mo3tatlmDem(vs;u)aeeoir oodlaD li sls  eum(r3oo4ape lieiltfarua(  ;u4tle ioctas a2emuvonu0 exrif oo1lptelnvs;t0 rtr(mpnodlltnmfvs (faDrmx o;t0tetn fciasla2umu ont)trerxf3oa1oaDeaueo t s2xr(o3ny4opeemiei s)sDumxm no1oet mietatfs2rlums (0alxnircoytlmD  neols0 2urir nu1amtnlfcsl( aDrrxro;u0oee mietlt a rl( o t4trerirctatlm eaivslt)teum(o3ny1lleemfcta(fsrtax ont4tee moeiydfs ul(msnt4aetoircoa1opDean i t0sruo(o oy1omte fvi tf 2urx pou1alt  ietytfm2emnvo (0arerxf3oodlpte ueol( srxoir3no4ale mnesl(f 2umxr ;o4ape iociasfs2ua( p u)trxomo3totfptelu olt trxm(o ny1lme mivi s s2um( p;u4oeto ociasfa uan s;u) etoif ootoaDe u s ( teumio3oy4op e fetatfarra(m ;t1tlenmi3iadls2raums u)trxnxf3tydlmte i i ( teuo(rpiy1am  mfvias  2um(r nu1apxomfciad m2rl( o t0tetnxo3oa1omDrai il(0trxmxo nydame miet (  rrr(mpnt4aex ifctytfs um(mont4tltoir todop r i i t tetm(opoy1aleemfvta(f ruauront4opx  oeiytla rmump;t4 lxnxfciotlpDrluvs (0texoirpny4lltn netlt)srra( o;u1texomicild s2uau on(4tlenif3tydfaDeaivs;s0t2to(opou1amee nvils sDrrxrp;u0tptnmociatfm em(vsn(0aexnxocoadlptelneslt  2tm(o3oydape lfetl(fsDtmurooo4apxo ocildfm2rlnmsnt) lxrmoctydfmtelnvs;()teuoxm3iudom elici t  ruaxrpou1aex mieiltfs raumpnu4teeoxr3oy1fp rauvi;() eum(opnu4lmeemicta(fsDrm(mono4tpeomociatfmDumumpn()tltoif3to1fmDr nes;s) exr(m3no4lle  ict ( a2ua( ont1tlxnmoetls mDelu p u4aeerxo tytfmDrau sls srumxr3iy1olee fes () Dtmxm ou0tpto feiadlm2um(mp u)tltrmoctotlp  anei;(0texmio iy1om nmfvt tfaDurxrpou0opt mi3iad a rmnvp;u4aexoiociadlaDeanes;() 2xrxrpny4lm n nvsat)sDtr(r nu0apx mfciytla2emu ont4tlermf oydopt anvo t  2tmimpnodole  feiat  rrrum oo1tlx mf3iys m ra( onu) exrifciotfa rau i;() 2xmim3oodal  lieilt)srtrxronu4openmfctydfs em(msn(4alenxr3ootfmt  u ols tetrxo3nodol nmicia( sDtrxmpoo4tlxnmfeiltfm rmnmsn(4texnxr ta1fa eli o t0s2urxm oudll   nes s)arrr(moot0ole moeilsla elu pnt) lxrmr tytoaD auvi;t0trtmxo iy4lp e ncs t)srtaumonu4optn ociltfm2ul( o;t)aetomr totopDe ieilt0trxoir io1lmtnlnctas  Dra( pnt1tltnmfciyd a ua(mp u) lenxf iytfmDran o t0trxm(o3oo4lptelnctlsf rrru pnt1oet io3tat a2rm(ms u4aexrmociytomtelu s ( t2xmxopoo1aptelfcs sf 2ua(r nt0ale  ictad s ul(vo;(4tltrif3ta1oat au i;t) rtrxr oy4lp nlfvta()sDrmxmpot1oexn ociadla2ul( o;(0tetoxf iytfmteln ilt0 rumxrpio4ap nlies tf Drax  ;u1olt mociatfm2rmnvsnt)texomr iodfa raies t tetoiopno4omeemicsa(  rtmumooo0aeeoioeiys a2ea( s t4aexrmf3ootfmt anes t)srxmim nodlmeelfei t  Dtrum no4aexnmfetyd aDrl(mon(4trxoxr3ootfmD ai ol(0srtoxr3iydlptn fetl(faruau p;t4optomfciasls emump () ltoxr3tatlpDr ues s)trxm(m3io1apeemnvtls  2raxm ;u4ale  ociydlm elnvsnt) lenxf3oadop eaueslt0 2um(o ny1altelfvs (faDua( pou0apen f3iatfs2umuvp;t0alerio3ia1laDrlneil(  etoiopoy4om  mieilsfaDrr(r nt1aptnmf3tydlsDua(vp (0aetnxf3oodom eai i (0 euo(m3oudlle  ivi s)sDurxroou0apt  feiad a rmuvp;u0 reomf ootoaDelues;t)s2xo(r oudame  ics t)sDumumooo0opt  fetatfs uluvpn(4tetrifciotomt aueilt  eto(opnydlp e ivta(f Draxm ;t4aeto ieiad a ranvo;(0aexoxfcio1fmD aivi;( sruo(o ou1al nmivtas)aDuaumo;t1aleo octls a2ul(mo t4teenxf3oydlp elnvols0s2uoxr3iu4aptemivta(fa2uax pnu0ole mf3iys sDra( on(0tetnxr3ia1omD ln i;(0teur(r oo4ap nmncslsf 2umur nu0tee  i3tldfm2em(mo;(4trtnmo oy1lp rliei;( trxo(o3oydamt mnctlsfarur(rpoo1ale iieiytfs2emnvs (0artnif3iodfp r uvol( s2tmxm io4llt mnciat srtrxro;t1olto oeiatfmDumu o () eerif oydfmDrlieols0s2xrir oudol nmiet (  Drau p;u0apxnmi3iasfs emumo t4 lenxr todoateau olt  exmxm3oo1ll elnet s sDurumo;o4tpenifctytlm2el(vp u0 ltrif tytom e n i;s0 2xo(m3oodalee ncsl() Draxroou1apx iocils m umuvont0aexrxo3iadfa   ues s) 2uo(r iydoptnmnciltfaDtax oot4tpeomfciydlsDul( o;(4areomo3iy1fm elu s;(  etrxopiudomtn ivtl()sDumumo;o1aeto fctad s emu p;u0 lxnmo3tatfaDeauvo;(0 rtr(m3iudamenlnvsl(fa2tm( pot4tle ii3tld m rmnmsn(4 rtnifctydfp rln ils seumirpiy4lp   fct tf rrr(mp;u4teeo octydfaDrl( o;u4alxomf3tydlpte uvi;()srtrir3oudolenlnvi sfarumxr ;o4altomfciatla2uau s;u4arenmr3tydlm  an s;s sexm(rpio4ol e ieia()aruau oou4tetoifeiys m2uauvo u4 exrxf oadlaDe ivslt sexrimpno1lm emfcsatfaruau  nu1olenmi3iltfa2emumpnt) rxnmr todoaDeluesl( tetrxr3iydameelnvtasfaDur( onu4tpx miciaslaDrluvpn(4aeerxf todfm r nei;()t2xoim oydale lnvtat)s2umxrp;o1apeniociad aDem(vo;(4trenio iodopt auvsl(0tetmxm3nu1lmee nvsasfs2ua(  nt0tptoifciltfaDranmonu4texrxr iadfpteai i s0setmim iy4om emnvtas sDrmurp;u1oltnifeiydlm rmn snt0 eeriociy1faD lieo s0srtmxm3io1openmieslsf rra( p;o0tpto f3iat mDul(mp;t) rtrxo iadfp r iei s trurxo3iu1lmt lieslsfsruau poo1ope ifeiatla emuvpnu4 rerifcia1oa   ies;s0sruoxr3nydopeemfvtls a2um( o;u1oltnmoetatls umuvpn()trtnir oodlpDe nvol(  eumxo3nodaltnmnvil(faDrrx  ;t4olx ioeiasla2ua(mp t0aexrirciadfpt liei () 2trxr3oo4lpt mivs (fs2rm(m nt0tpx miciaslm2uanvo (4teeomo totlptr iei ( texmxo oy1om nmfvtatfa2um(mont4tlt  f3ils aDranvo (0trtomrcootlaDeai o;(0 rum(r3ou4lp nmncs ()sDtrurpoo4aeeo o3iadla2el( s ()artrxr iatlmt luvi;s)sexoio3oudale mfcsltf ruaum ;t4aex io3iytls2rau ont4aleoir iodlpDraneo s teto(mpoo1aptnmfviltf 2rrxmo;u1tle ii3tls s2el( o ()alerxfcoodoa   u sl( sruoiopiu4lptn fcsa(f rtmxm nt1aleomi3ild m2ul(vpn(0tltrmo3oatfaD an s;t)s2umxr no4omt  ictlt) 2rrx o;t0oetnifetyslaDeluvp t4tlxrifciodlp rluvi s) eurxm io4oleemfei tfa2raumoot0oex ioetys mDumn p (4trenxr3oytoat li o s0 rumio3ou4lleelfcs sf rtmxrpno1tet mfeiyt aDuauvp;u0arxrxociotopte iei s0 2trxm iy4lm nlneta()a2umxrooo0aee mfeils mDeanvpnu0alxomf tatla rln i s0s2xoxo3oy1openmnvt sfarua(r no1alxo feiatfm2ua(mp;t0 exomo3oa1fa raneo;t0srxrio3oy1amen nei (f 2rax ooo4tlt  i3ild sDran s u)texrxo iytoatrlnvol()srtrim iu4lp e nvsl()a2ur(  ;u0tex mfcilsfa rmumo;t4 renmo oa1om  aivo;t seumio ny1amt lfetlt)aDra(  nt0apxomfctltfsDumnvs (4trtrxr3io1fmDelneo (0 eurim nudamt  nvt tf Drr(  nu1tleomieiadfa raums;(4altrir ta1lp  aies s)texrxopoudll e feils sDrrurpoo1aleo feiadfaDumuvo;u4 ltomf oy1omt lu o ()s2ur(o oydaltelfvi t  rrm(ronu4oex moeiat m2ulnmsn(4arxrxf oa1lateluvi t0t2xrim3oudlpe mnvsas a2tmxrooo1tpxomf3iad mDel(vpnu0tetomr tadom eaiesl()sexrxo oydlm nlici (faDur(ro;o1teeo ictasfs rlnvo;u)artrxfciatom e u o;() 2tm(r3ny1alt mici t sDrrx  nt1tpenif3iytlm ean o t0tltrmo3oadfpDrlnes s seumir3ny4ole lfvta(fsDrm(moou1aexnii3ild sDuan o;(0tlxoif to1opt au o;s)s2uoxrpoy1lmeemnvsl(f ruau pou4alx  o3iasfs2emn o;()tlenif3iy1lp rluvi;(0 2umim no4op   fetas) Drr(rp;t0tpxn feiasls ranvo t4tltoir iadlp r uei t0 rtrxo3oudalenlictls  rtrumpno0olxniociytfs ulnvo t0teenif3io1lpDranvi s0seuoio ny1lltelfetasf 2taump;t1opxniociytfmDemnvo;(4aeerircia1fa ean s;t  exo(rpiodop elicsl()sDrau pot1tltniieiydfm2um(mo;t4artrmociodfaD  uvslt seum(rpnu1llte nvslsfarumur nt1olenmieiytlsDuanmo;(0altnmocoatop r nvs s0truo(mpny1lmtn ncil( sDur(  ;u1olx ifeiytls umnvsn(0 rxrir3iodfp  ai s ()srtm(r3nu4om  mfeta( srtax pnu0olt ii3iytlaDuaumon() ltnxo3iatlmt  uvils0texrim3iu4aptnlieilt)srurur nt4tpe  ieiyslsDel(vo u4arxrxfcoatlpD anvi;s texr(r iudoptn netltf 2rrxmoot0oetnmfeiad aDrlnvs;u0aleoir tatlatelieil() 2urxo ou4lme  fvs s  Dtr(rpnu1teeoiociysfa2rmnvs;(4alxrmo3oo1fm eauvs (0trur(o oodlptemncsas  rtmurooo1tle mi3iysfa emu pnu)alxrmf3ootfatran i (0seuo(rpnodlpte ncsl( srta( ont0opto f3ias s em(vsnu0artoxrctotlpDrlnes ()sruoimpoy4ope  nvi t)aDuauro;t0olxomo3iltfs emnvon(0trxnioctodlaDeau olt0 rxmxo oo4olt  fcils)aDtmum ou0tpe  fetasls ul( o;t0alxomf3totlp  anes t0teumirpou1opt  nes ()s2urur no0aexniietysfa2rmuvsn()artnifciadla   n ilt)t2xrim3iu1lltnmfct t)sDumumoou4teen octadlm2ua( ont) eenxr ootop eli ils) exmir iudalen nvs s aDtrxronu0aeto ietad s ulnvsnu4artnxf iadopte uesl() rxoio3iodolee ivsas) 2ua(rpou4ope mfeiydfm rmuvp ()tlerifctodoa eauei s s2uoim iu4lpte fesa(fsrrr(rpnt1olx micildfs eauvont0trxrxf3tydlm r ivi;t  rtrxm oo4ll  lfctas)aDua(r nu0olenmfetltla2umuvp;() reoio todfm r nvs;t) euoio iodoptn neiat) Dtaumonu1optnmo3tyd a2uauvsnt4trtoifcoodfm elnvi;t0texm(r3iu4ol emnvi t s2urumooo4aexnmfctltfm elnmo;(4 eenxociodfp eaivolt  eurimpnudome lncil(faDrrum nu4opxn fciydla uluvs;() exnxrcoo1lpDe ieilt  rum(opou1open fetl(fsDum(  ;t4opx  o3tytfa2ua( p t) etoxocoatfmtr u s;t teuo(o nu1openlnvt ()aDrmuro;u1oleomf3tltfsDrl( p (0tetoxrcia1op eaiesl(0s2uoxr nydap e fvtas) rtmxrooo0aex moetas s2emnvo (4tltrmfctodomDe ivs;( setmxmpoydlltnmnvt tfsDtr( p;t0oetn oeildlmDeanvs t0artnxfcoa1omDelnvo;() eurxr3no4lp emnvs (farumur nt1oltomietysls2ua( o;u4 etoxfciatom   ieols0s2tr(r iydomeeliviat)srra(mp;u1apt mi3tydla2rl(ms t0 ltnmr totlpt anvo s  2umir3iu1op nlfet ( sDrmumooo4tlxoifctlt s uan s;t4teeoioctotfa rlues s)t2tmxrpoudalte fesl( a2umxro;u0tltn ictld m2umumpnu4trtrmocia1lpD  n i (0s2xoxm no4omte fcsatf 2raumpot1aptoiiciltfs el(vont0 exoxr oadlp  aivols)teumxm nu4ll n nvil(f 2tru ono4aetn ociad sDeanmont0 ltrxr3oydfm e i i t) eurxo oudol  mict s) 2taurp;o4opto f3ilsls rmu o t) lxomf3oatoaDeaneo s)trxr(opoydlpt mnvtls) Dtr( pno1aexoioeildlaDea( snu0 reoxf3totfm r nvo s  rxo(o iy1aptemiesl(fa2tr(rooo1aeen oeiydfa2ra( pnu4arxrxr3iatla  lueo () euo(m3no1oleelfeia(fsDraurpou4tlxo f3iydfs2rl( pnu) rtnxf3oydom rlnes;t)srtoxopoo4am  mfvslt  Drm(mpnu1tlxnioeils a2emu ont4aleoxr oa1fmtelues;s)setoio nu4ol elnct t) rtaumooo1tpxn fetls aDumnmon(0 lerif3iytoatr i s;s0s2uo(rpoudllte ivia(farumu ono1tlx mfciys mDrm( s;t) rtoxf3tadla rai o s  2xrxmpiodame mfesa(fartrxr ;o4tpen o3iydfa2rau p;t4aexoio iotfmDr uvo;t0srxrio3oo4lm  lnci () 2tm(  ot1optn fciydfa2rm(vp u0aetnmf todfp  aivo ()srxr(rpnodal  mncias) Durumpoo0tee  fctysfa2rm(mo;() rtoxrcoodomte neo;()s2ur(r3oydlp  mfeil( artrurp;u1tptoiieiadlm rmnvon(4altoir oo1optelu ils t2xmir ou1aptemncta(farrmx  ;t4oeeo f3tlsfaDuln o (0artrmfctytlmt luei t srxrir ny1ome  ictas)aDuax ooo1aptn ieiasfmDumuvs;t) reomf oydfm  ai i;s)seto(o3oy1ap emicia()aruaxmpoo4oexn o3tltfa rln snu)alxoif ta1lm rlueo (0setmxr oudopt mfcsat)srumum nt4alxo iciat a ua( snt) etnxo todlp  aieo;s setmxr3no4alt  ieslt a2ra(  ot0tpt  i3tadfm ul(vpnt) lxrmo3oa1fmtraivsls setoimpnodoptemfvt s) 2rax poo0opeo ocild mDum(mo;t0tlxrir totoaD aivs s  rum(m3no1altemfctl(fa2urxrp;t4tltnifeiatls rl( on(0 lxnmr3iatla rluvo;t)trtr(m ny1lpee fcsas  2tax  ou4opx mieiad m2ranvont4treoio iydfa   uvs s s2uoim3oydam emnvt t)srtm(rpno0tex iictaslm rl(vpnt4 exrif3oodfaDelneo t0trtmxo3oudll  lneiatfartmxr ;o0tpx  feiys m rluvo;u)trtnxf iy1opD  ieo;( t2xr(r iodal n fvsas  2trxmp;t0tltnio3iat a ea(vs;u) eerif iadfa rlnvs;s0teuoxmpoydaleelfci t)a2uax ont1oee moetls m umuvo;t4tlxoif3iy1op r nes t)texoxopoo4omt lietl(  rururono1tpto oetltfa2em( snt4 etoioctydfptelneslt  exoxm oydale  fvilt) Dua(r ;o0aeenmi3tatfaDuauvo;t)arxnmf tydfa  lnvi ( texmir ny4apee fvta(fsrtru o;t0aee mfciytlm2elu o u0 eenmf3tatfa  au il( trxoio oy1lltelfci s a2rr(moou1optn octadlsDum( o;t4teerir3ty1oa rlnvi s seumxopiy1lmt  ivtlt)a2tmur no0apt  fcild m2ua(vo ()trenmf3ta1fptr n ol(0trtrxr3oy1ape  ivslsfsrrm( pou0olxn iciydfs rluvsnu)texrmfciy1om eai ols tetrim ou4llenmies t)s2ra(r nt4tpxoiociltfs umn p t0 leoir3iodfmtraies;t) exoir3iydopt  nei s  2rmum no0optn ocias s2el(vs;u0 exrxfcoo1fate nvo t) ruoxrpou4amte ieils  Durx  ;o4oee mfeildfa elumo (0texrircoodoatelieols) exm(rpio1ol emnvi ( aDrrumo;t4oetoii3tysls2eau onu0artrifciytlpte neo s)trumim oy1al e ieilt s2umxrp;t4opx  fetat s2emumo;u0 rtnxf3oadlatran i;s  rxrim oo1apenlfvslt  Dtrum ;t0oeenioetys s um( o;u4 lerxo ty1omD lu slt  exoxopou4lp nmfctl( a2um(mont4tetomo3iltfsDem(mo;t0tlxnmfctodfa eliesls0tetmxm3io4alt  fvsltfa2umu o;o4aptn i3iadlsDrmn o (4alerxrcoatop e i i;t)s2urxo ou1amtnlicta()a2tm( oou0oet mi3iydfa2ra( s t4teenir3ootfptran o;t) 2umxmpny4ol e netlt srtmx  ;o0ape  oetysfsDuauvs (4altrmo3ootlp elivols)t2xm(m io4lm  miesat  2tmxmp;u0ope mi3ilsfsDumumo;u)aexniocoa1latrluvo;s0s2umxo3oydop nmict sf rra( o;o1alxoiociytls ea(vp;u0arxoxf ootop   u o;t  rtmxm iodoltnmnvta()srrauronu0optnmfeiyt mDea( p;u4 ltnxfcoo1lmD au o;(0trxoim iu4op n nes (faDtrx ooo4tpe io3ildlm rmumo t0 lenmf3oy1fptrlneil()s2uoxm3io1al emivias)sruaxr nt4tleo i3iltla2umn s;u4arerif3todoaDr nesl(0 rtmir io1lmte net t)s2ur(ro;t0opxo iciadfsDranvpnt)trerxo3ootlp r n s;(0truoir ou4ll n iesasf 2ua(roou4tleoif3tyd s2rmuvp;u0tetomfcoadoaDeau o;()s2um(m3io1open fct t) Dra(ro;o0oexomo3tys m rmu o;t) eeoxf iy1fp  ln i;s0texoxm oodlpt mfesasf Dtru  ;t1tetnii3ils a2rln s;u4treoif3oodlp e i i s0 2tmiopoo1ole lfcs t)artr(  ou0oee  oeildlmDrlums;u0tetnxr3iotlptr ivs;( texmxopny1ome lfvt ( arumum ;o4altnioctls a eanvsn() lxoxo3oa1om raivslt)texmir3ny1lme lfeil( a2rr(  no0oltn i3ilsfm2ul( pn() etnxo3to1oat  u i;( t2xrxr3iy1ol e fci ()aDuau  ;o4aee  f3iadls emnmsnt4artoiociytom rln i;t  rxm(mpiydole  fetltfa2taum nu1oexo feiydls2ea(vpnt0 eeoxo ty1opD  ivo () exrxm nydoltnlncslt)arta(rpnt0olx mfcild m ea(mo ()aetrio3oadfa elieo;s)t2umiopiydopen ivilsf rum(m nt0openmfciasfa2uanmo u)texomocty1lp  livol(  2umio oo1lp emfeils sDumxmpnu1olxnif3tat aDel( pn() reniocoatomDe uvil()texr(o nudomeelictat aDtau  ou1apeoio3tytfm2emu s t)aexnmf3tydomt aneil(0seuo(r3oodale livi t s2taurono0alen fciltfsDranmp t0teenio todfpt luesl(  2xoxmpoo4op e fct s  2tmxro;u1tle mieiytls2ra(msnu)tlxrxr iodfpDrluvol(  eum(m3oodol  licsat)artaxmpnu1oeeo fcils m2ua(vp;u4tlermfcoatoptelneo;( tetrirpiodame mnes ( artax  nt0ape iociytfm2el(vsn(0trenir3oodlp eaivs;t  rxoxr oydll   neslsfsrrru oot0apx  iciad mDea( p (0alxnmf3tatlp e nvs s  2xo(opiy1olt  fesas  2tmxrpot1tetnio3iltla2elumon()trtoirciatfa e i ol(  2uoirpny1ome  iet s)sDur( poo1aexoio3tytfs rmnmp u) rtrmfciotoaD an o;()texrxopou4altn nvsa( aDrmurooo0oleoifetatls2ul( sn(4 rxoxrcootlm e i i;t  euoio3oodlmeemietas  Duax o;u4apxo oetld a ra(vp u)aexrxo oatfat  n slt)texm(m3nydlle  fesas)srrm(r oo0tee ifciysfmDua(ms u) rtoxf3oatlpDelneo t)t2urxo3iu4oleelnes s)aDtmxm ;o1tee  oeiyt aDrl(monu0 leoircta1oaDrln s s0texmio oudal  lfetlt s2tmurpnt4aptnifeiys s2ulnvo t4artnif3tadopDeli s s t2ur(mpno1ll emnci ()a2umum nt4tltnmociat sDulump t4 rxoio3oy1fpD lnvo;t0 eto(r iydlp elicta( srtrumpnu0opt ioeild m2rl( s u)aexrio3oy1fpD  ueo s s2uoimpiydll elicsl( sruru pou1oeeomiciysfm ulnmp t) etoxo iy1fptranvols) rtoxmpnu4omenmnctat  Dua( onu4tpt  f3ildfm umnvp;(4tetnxocoo1oaDr i ol(  rxrxo iodlmtelfvsa(fsrrr(rooo0tpt mfciysla2emnmpn(4 exoxfctotlptr iei;s  2toiopnudamtnmies tfsrrrumpoo1alxnmieild aDeau s;()tetoxf iadop e u i s)texr(rpnudlmeemici (fa2uax pou4apenifetysfa2um(vo;u4trtrxfctatla eaneils)trtm(rpoy4amt  ici tf 2tmxmooo1alt ifetyd m emumo u4teenxr3tadfm  livilt  2tmirpny4lme mfvs s  Draxr ot0alxomiciadfa2elump;t4tetrxociodomD  ueol() rum(rpoydop elfesat  Dtaur ;t1oltoifeiysfm2um( o u0 etomf ia1omt li i s0srtoxmpiudal   nes t a2tmurooo1openifeiatlm2rluvp;t)trxrmocta1lpDelieo;s  ruoio3nu4llenlfeia(  2raum ;o1tlxoifeilslmDel(vs;(4tlxoiociytomte ueo;s  rxoim nu1lp elnesat)sDumu  oo1optomi3iadlm2ua(vs u0 rerir oytfate iei t)srxmiopiy4omeemivt t  rtm(roou4opxn o3iys a uanmp (4 ltnxr io1opDrli ols seurimpno4om nlfvtat sDtaxr ou1tle mi3tls m elumpnu0 lxrircty1opDeaueslt0s2xmirpno1al nmfei sfsrur(  ;u0tptn i3tytfs umu p u) lxoxociadfpte u s s) 2tmio3iu1al   fvsltf 2tm(  nt0alt  o3tatfa2elu on(0trenxf3ia1fptrlu o t0sexoio iu4llt  nviatfsrrmumpnt0aexn o3iysls rl( o t4aeenxr3tydlpteln ilt)tetoiopnydol nlieilsfsDrru o;t4openiictytlaDua( sn(0aexnmf3iotoaD  i o;()t2trir3oo4altnlietas) rurx onu1oetoioctatfsDea(vo t0arxrxr tatla  lneil(0sexo(m iudlmtnlnetlsfa2tm(  oo4tee io3ilslsDua(vo t)aexnmo3iytfa  luei;() 2trirpnu1alt mnci t s2rm( oot4apeomfeiyd m2emnvpn() leoio3oadfp  lu o;t) rum(o no1lp  mncsasf ruau o;o1tptoio3iyt m2rmnms u)texrmociodopDe nvi;s)s2trxm ny4opt lfei (faDua( o;u1tpenmf3tydfsDem( snu0alxrir3to1opDeanvolt  ruriopiy1om  lnei (f Dta(m oo0tet  ieiytfm2rm( pn(4alxrif oo1optr ivo ()teumir oudaltemneias)arrax oou4apx  ieilt a2em(msnu0 rtomrcoadfaDr u slt t2tmimpnodamen fetl()aruaumont4opxomoctlsls2ul(vs (0aetnircoo1oaDr iesls  2umxm no1amtnmfviat aDtmu pnu4aetn fetldls2ua(mp;()artoif3ia1fpDelu o t t2trir3oo4lpen fct sfsDtmxm nt0opeoioeiltfa2ua( o (0artoxociadlm e uesl(0 2xrxopnu1lp emieia( sDraumpnt4olt  feilt a2eanmp (0 rerxrciytlat aueo;() rumxo3oo4omtn iciltfs2umx  nu1tltniieiltlaDemnmp;u) ltnmo ta1lp elnvi ( seur(opou4omt lfeil() Duaur oo4tlen icias mDul(mo;u4 rxoio oadoa rlnvs;(0 exoio3iodalte ietls srtrxrooo4olen fcilt s2emn o (4tltrxfctytoaD aivs (0 2ur(mpoo1oltnlfvs tf 2rau  ot0alt ifetatfm ean p t0altoxo3oydlmD aivsls trxm(m oydal e feta( sDraxmpnu1apen oeiltlmDel(msn()areoxo3iytfpD anvi t teum(opoy4lmen neil()sDtru pou0opx mfeiytfa ean o t)tltniocoo1lmDraivs;t  rtm(m nu1am emncsls)s2uaxm nt4apt  f3ilt s uanmo;u4trermf oadfatrlnes t)s2tr(o ou1opt mnct s)srur(rono1opxoifeilslm2emnvp u)aetoxocoy1fm   neils)seto(o nu1aleelneilt srtm(r ;u4optn feiytfsDeluvs;(0aexoif ootlp rlnvsls0srxo(opoo4omeelivsas)sDum(ront0tpt ii3iyt sDra(vp;(0 eeoio3tatom  luvs;()trtr(opoy1omeelicil()s2rrumo;o1teto f3iydfs2ranmo;(4 etrifcoytlpDeaieols  eur(m iy4olee fviltfa2ururooo0tptomoeildlmDeanmpnu4artnmocoo1om  an ol( teum(opnu1ale  nvtat sDtr(r nt1tle io3ilt m rmu o;t4trtnmf ta1fpt livs;t0texrxopoy4lmte nviatfs2rrxr oo4oleo oeils m um(monu0 rtoxfcto1la eaivslt  2tmirpnu1lp e feiat) Dtr(rono4tlxo iciadls2um( p;t4aetomocoytoptr ues;()trxmxo3iy4olt  fviat srtm( pou1optomietldfs elnmo;u4trtrioctodlmt lues;s0 2to(m nydomtemieta(faDua(ro;u1tlt iiciat aDua(vsnt0aetomf oo1lmteanvolt)trurxo3iy1amt miet sfa2ua(mo;o1olxnio3iatlm uanvo t) leoio oo1lptrlnei s0 rxmxo3iydlm nlivtl(fa2uru  ;u4tetn fctadls el( sn(4 etnxr oadlmDelueil(0srxoim oudopeelictl(  rrax ont1tex ioetls mDrl( p;(0trtrmf iadopDelneil( s2toio oy1omenlfciltf Durx  ;u0ole ioeilt a rm(mo () etnxo3ootlp rluesls  exr(o iy4om nmnvta(  2ra(mont1altnmfeiyt m umu p u4 reomf to1fp raiei s0tetrirpno1ll n netas) 2um(m ;u4teenmiciasla2ulu o;u)artoxr3tadlmtrli i;() etrim oo4altnmfvilt a2umurp;t4apxnifeiadfm rlnmp ()aexrmrctydomDe u o;s0sruoxopiu1open fei ()aDrrxmpoo1tpxnmieildls ea(mo;u4trxrmf iy1lmDelneo;s)tetmxr3oo1lm  mivt s)srra(mooo0tpxoiiciadlmDra(ms;u4 etnxr3tytlptr ieolt)s2tmir3oo1om  mivsat srum(  ot0optomf3iyt s rm(ms;t0trxoif tatomDraivs;t  2urirpiodomtnmfetl()arrrx  ou1tex moctydlaDumuvs;t4texnxocto1fpD livo;( t2um(o3iy1oltnlfet (fsDur(  ;t0opxoiociysfm2uln snu0trerxrcoa1fpte ueo;(0 rtm(o3oudlpen feslt s2urx p;t1opx if3tldfa ranms;t)aeeoir ty1fm eanvi;t s2uo(r3nu1opte feil(fa2tmur ou0tltoifcild s ra(vp (0 leoircoa1opD  iei;t sexmxr3oydal nlicta( s2tmumpnu0opt if3iaslm2rmuvo t4treniociytlaDelu ols0 exmxm nydlle  fcs t  rrr(r ou1ole mf3tldfa2emumo t0artomo3oytlm ean ils0setr(rpou4optnmneiat)artaxm ;t0oeeomf3tatfm ua( o;(0 exnif iatopDrluei s)teurio io4opte neiat  rum(rooo1aeto f3iltlm um(von() rtnio iytlp rluei;( trum(rpiy4ll nmfcias s2rr(mp;t0tpxniicild sDra(vp;t0 rxomr oytom  liesl(0t2ur(o io1lpte fvta(fa2ta( pno4altomi3ildlmDranmsnu)texrmo3iytla  ln s;(0 rxm(r oy1opt mnvtls) 2rm( ono1olx  o3iad m2emnvp;u) lerxf3tydoat  i s;(0 2ur(mpnydlpen ici sfa2tr(r no4tlt moetysls ua(vp u4tlxrmo3tadfmD  neol(0 2triopiydapee icslt s2tmumonu1teeniieiasfa rauvs u0 lermociotfmDraivo ()t2urxm3nodop n nctasf 2uax  ;t4tlt moetat m ranvs u4tetnirciydlpDe ieo t srxo(o oo4omtn nvsat)s2taurpou4olen oetaslm um(vpnt4 eeoxrctotfaDeau ilt trtmxo nu4lmtn fvsa(f 2uaxmoot4tlen ictytfm ulnmsnt)texrmo tatfmDe ueils0 rumxopoydll nmivsas) Drm(r ot0tpxnmfetyt s2umn snu0artoxfcio1opDe ivil(0s2toxm3iodamte ncslt  rumx oou1teen ieiad m2em( p;(0 rerifcia1la e i s s) eumio io4olenlietlsfsDtrumpot1apxn feiyt m2emnmo;(4 ltomf3tatlm rlnei;(0seto(rpio4ap n fcils sDtr(ront0aeto f3iatfm elnms;t0 eeoxr3oo1lpt  neolt) rtoio3ou1amen iesasf rraxmono1oexnmieilsfaDum(vsnt) etoxrciydoatelivs;() rxrxo ou1am nlietlt a2uaump;u4oetnmietlsls2eanmont4aleomf3tydfatrlneolt)trtm(opiu1altn nct t)s2taxrpnt0tlx  ictad aDrm(ms;u)trxoxfcoydlmteanvilt)trtmirpiu4openmnciltfarumxrp;t1tpeomfciyd m emums;t) rxnir tadomtrlneil()trur(mpiy4apenmieilt)srrrumoot1oet moeiadfsDelnms;t0aexoif3oydom  lu o;t trxm(o3nu4ameelfeilt)arurxrpou1aeto ociyd a ra(mo;()texomr tatop eanvo s0tetrxr iu4altn netasfsDurxm ou1aleo ictytfa ra( ont0alxrir3tatfm rai s s) exmim no4lmt  fcs (f 2ta(m nt4oee mo3tytlsDelnvsnu0tetrio oodlmDr ueo ()srxoim ny1ll   fct s aDtax poo0olx mo3tyslm2umumpnu4 renif3to1la eaivi t)s2uo(r oydaptnmnctl(  Drmurooo1texomi3iltfmDem(mo u) rerxfcty1lm raueo;()seuoxopnu1lm n nei sfs2tm(mpoo1tpto fciyt s ranmsn(0aetnif tydomD lueils) exr(o iu1amt lnvilsf rrrx  ;u1tet mi3iltfmDrmnms;t)trenioctotfaDeaies;()srxrxr3oo4ame lnei tfarumx ono0tet  ictad aDraump t)tlxrio oo1lateli s;t)teuo(m ou1amee neiat a2ua(r ;t0ole  f3tld mDelumo u4trtrmrciytlpteliei;( trxr(m3ny4omt mfctlsfsrrmum no4tpenmi3ilsfs2rm( ont4tlxomr3oadomDr i sls)s2umimpou1olenlfci s srrm(rp;u4opxn oeiltfmDem(msnt4texrmfcta1fm r u ol( teuo(r3no1ap emfeiat  2rrx o;t4aee  ociad m em(mp;(4 ltrmoctotlaDr uvi s0t2xo(r3iu1om emivt tfaDtaum ;o0teen ieiatfa2ul( pn(4alermr3ia1fpt  i i s) etm(m3iy1am nmnct (fsDumxronu4alxomfetyd aDulnvo;t)texnmf tadoa  aieo;s) rtrir nu1olt mics ()aDta(  oo4opt mf3tlslm2emnmon(4 etrirciy1laDrlu i;(0tetm(o oudaptn fet (  2ururp;t4oleoioetaslsDel(vp;u0trtoio oadlpt auvs ()setm(rpny1ll nlicta(f rtr(rpou0optn feild a2rm(vp;u)aexrmocoy1omDeli i () 2urxm oy4ol elfesa()sDur(mpnu1oltomfciyslm2em(vp;(0aetn
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;()seumxo3nu1lpt mfvils)srtrxmont0oex mfciat mDrlnvpn(4 reomf oy1omtr u i ( t2xrim3oo1lltemnvilsfsrrmu o;t1alto feiys a2umuvp u0texnmr iydfp ranvils  2tmxrpiy4am nmnctat)srra(mpnu0alto ictyt a2em( onu4areoxociatopD lu i (0 rtrxopou4lmt lneils a2trxmo;t1opx io3ilt s2elu pnt0alenxf3iydlat anvo s t2umxmpoy4lp e fei s)artrx  nu0apenmfciyd mDrmn p ()alxoio iotlmt lueolt) 2xr(r iodop nmietas a2umxm ;o4olx mf3ilsfa2rlnvp;u)areoxfcia1lm   ivo s) rur(opou1om nmivia( sDuaumpot4tee  oeiltfa elums (4tlxoxf oytoaDe ivi;()s2xmim3oy4aptnlnvias  Dum( pnu1aptnmictysla raumpnt0trxnmo io1fpDr nvsl(0 2ur(o3oo4lm emivs s  ruru  ot4oex ii3ild mDemn pn()arxnxf3ootfm e iesls truoir3iu4lpeelivsas)arua( pno0open fctlt a2emnms t) exnmr3ootlptelnvil() eum(m oy1om nmict ()sDtrxm ot1altn oeiasfaDrlump t) leomo3to1opDrauvs t) etoxr nu1omenlivt tf Drmxro;t1tltoifeiytfmDeluvp;(0teenir ta1lp  luvi t) rurir3nodomtemfcs t  rrax pno0tptomocils m2emn p;t)aetomo3totfm  aneo s0srtoxmpnudap elivsa()a2trum ou4apeomi3iad s2rluvsn(0tlxrmfctodomtr ivo t s2to(m3oy1omt lnctl( artaum ;u0alx io3tytlm ean p;t)treoxr3tydlptrluvsl( trurio oydoleemivtat sruax pno1tet  o3iyd m umu o;()artnio3io1la ran il(0s2uoio3oodoptnmfcs s)sDur(mooo1tptnmicias a2rauvont0 lxrxo tatomDran o (0t2xm(o oy4omenlfcslt)sDumu ooo0oetomf3tltfsDemn pnu0trtrif ty1fpD  n o;s0seurim3nydlleemnci sfarurxm nu1ale  fciydlm2uaumo;t0 eenmocoytfm eanei;(0s2tmir io1amt  fvt sfarrmxmont4teenmocils mDrmnvs u)tltrxfctydoaDrln s ( srtmio iydom emietlt sDtaxmpoo1oee  ociytls2emnvs t4 eeomo iytomDrliei;(  eum(r3oudopen ieiltfaDtr(m ;u4tpt ii3iyt sDelnmpn()texrio oodfate nvi t trxoxr3iy1omtelivias)a2rax pou4opxnmfciasls2emuvont)artnxr oodfpDrli s ( setmim3iy4lpeemfeiatf 2ururp;t1olt ioeils mDra( snt0tlenxr iydlmDr ivols0s2xrxo3oodopen ncta(fs2umu pot0tpe iieiltfm2rluvp u)trermf3iytfp raies t texmxm3no1llt miet s sDtmxront0tpx ioetlt aDem( o;()trtomr3ootoa   ueo;( srxr(opou4aptelfvia() rur(r ot0aexn f3iltlmDum(vont4altoxrciydfmte uvo t0trtmxrpoodalt mfvsl(fs2ra(r nu4aeeniietydfm um(mo t) rxoxf3oa1fpt  nes;s0tetmir3ou4om nlicsl(faDumu  oo4olxoioetat mDuauvonu4 rxomo3tytfmt aiei;s0s2xm(rpoy1ap nmivt s a2tr(mp;u4aetnmoetldfa2rm(vsnu4texrioctydfmt liei;s)setrir nu1om nmieslt) rta(  ;o4oet iieildfs2uauvo;u0 lxnxfcoa1opt luvols s2urxo3io1omt lnvt tfaDumx  ;o0tpeoifetls mDua( s t4 leoxociydfpD li i;( t2tm(o3iydlptnmfct (  Dumumo;t0optoif3ilt aDumums;u0 rermo3oo1fatelneslt0s2umir iodlme lies sfarumx pot4aexomf3iysfs2el( ont) exoircio1fpte uvilt0setr(o iu1ll n fci (fartm( ont0optomoetat mDumn p ()tlxrxocia1fa  aneilt)t2xrxm3oy4lltemfeilt) Dur(ro;o4tpenifctas aDrlumon()teerxr io1oaDr i sl(0 exr(mpnu1am  lictlt sDrau o;t1oeeomocias mDel(vp;(4aeeoif oytfm ranvol( truoir3no1llt mneilsfarua(mp;u4tlxoif3iatls umnvo;u) lerio ta1opD  uvs;()trum(o no4lmee fet (farrm(m ;o1aeenii3iytlaDulnvp ()texrxoctatlmteai olt)t2uoxrpnu4om e fcs tfsrua(rp;o4tpe if3tadfa2ra(vp t0aeeomr tatlm rln sl()t2urirpoy4optn nvtatf 2um(mp;o1aetomiciys a emu p u)aleomo oa1fmD ai o t t2tmxopny1lme miei tfarum( oot0opxoifetytfs eau p;() rtoxr iytoaDeaivilt0srur(o iu4ol emncia( sDrm(  no1ale  fcildlm rmump;t0 eenxf3tatomDr n s;t0 rxmir oodlmenmiesa( a2umx p;t1aet moeiatlmDrmumsnt4 exnmr3iy1lp eaivils0srxmir ny1aptelfeslt  ruaur ou4ole ioeiasfm elnmo u)tlermrciy1op r u i;t srumxm3ou4lpt mivsls)sDtr(m no0aeeoiociytla rlums u) leomrctatfaD  uesls)srurir3ou1ll emicsat)arumxmpnt0apxn f3tysla rmnmpnu4 etrmo tydlmDe i o;s srurir iydlp elivi t artaurp;t4opx iietldfaDeluvs;(4alermo oy1lmD  ieil( seum(rpno1am n nvtltf rrax ooo0apt iieiadlm2umnmp;(4tetoir ty1omteauvi;t t2tmim3iy1ape  fei (fs2rmuro;t0aexn fciydfs uln s;u0 renxo3oo1lp e ivi;s)t2xmio nu1lptemict ()s2uaxr ot0olx mfcildla2ua(vpnu)tetrxf3oydfm   n il()seuoim3iu1oltnlictat srur(r ;o0olxoifciatfaDul( s () lenmf3iotfmtr nvs (0 2tm(m oo1om  liviat)aDrax pou4oeenio3iydls2umuvpnt)alxnir3oy1faDe neslt0tetoio no4al n iet sfsrtrxmono4apxomieiat a eanvs (0 rxoxr iydlpt au il(0teuoio iydlme lfei sfartauro;t0aexoifetadfaDranvs;t4arxoxr3oodfpDrli s ( t2xm(mpoo1op emicsasfs2rrxrpou1oeeoif3ild mDuanmpnu0tetrmfcty1laD  n i;s0srxr(o nudap nlfvi s)arua( poo4opxnmfeias sDrmuvo (0alxnxrcoatomDelnvils sexoirpny1ol  mnvt (f rtr(r ;t1aetomoetld aDem(vo t0trerirctotfp rau s () rurio3oy4lp nmneia( s2tax poo1tpxn fetldfaDul(vs () rxrxf oydlp ranes;( s2trim nydape mfvs tfsDrrumoou1aeeo o3tytlm2eluvs;()tltrxo3to1omDrluvs t0s2xrirpno1omenlnvta( sDrmuro;t1opxoioeilt mDrln s t0altrxf ootlp  livs t0t2xm(opiodapeemfvias)srtmuroot1optnif3ild m um( snt4arenxo iodop raieo;s  rxoxm iu1lle lneiat) rurumoou4apen o3ilt a2ulnmpn()tleniocio1fmD aivs t0s2xo(o oydoleeliesatf 2urxr ;u4openmi3iad a rm(vo;t4alerxf oa1fp elies;()srxoxr nodop e iei (  Draxmpot1tpenmiciasfs rmnvp;t) lxoxo iytfm raues;s)s2um(rpiodamen icsatfsDta(monu1alxomociadfsDem(mo;t4aexomf iy1fa rln o ( srtmxo3nu1alenlfei tf rtaumonu0tptnmi3ildfsDeln s t)aexrxoctotfat lneol(0seurim oo1oltn fvs t) Drr(m nt1opt mo3iadlm emn p u)teerif oytlpt lueo s) etm(m iy4omte ivtl() Draur ou0tpe ioctys m emu snt4 rtnmo3iotom  auvilt  ruoxrpoy1amee neil( srrm(ro;o4aeeoio3tasfa umump t0texrmo oo1fpDr ueol() 2ur(mpiudop   fctl()sDua(mo;o0aeto o3tytlm2uaump;t4 lenxo io1op r ivs;s  exrxo3oydlmte feiat)sDrm(rp;o4tlenioeias m uln s;u0aleomo io1fm r neo (  2tr(rpnu1oleelietas artmxm ;o1texoio3iat a2um(msnu)tetrxr iotomD aivol( setoim3iy4amen ivtl()srumu pno0opx mi3iysls emn sn()altoif iy1lm elnei;s0texoxopnu1op  mies sfa2rru o;u0oexnii3tytls uaumo;(0 etrxfctatlm  aieol(  2urxm3no1lm e ies tfarua(r ;u4alxomictlt aDulump;(0trxrir ootfpDe n sl( t2to(o3no4omenlnvias) 2tm(rp;u4alt  o3tytfs eln o u0 exrmr to1fp eai s;s)sexoiopnydopte ivt () rtrumonu1alxnifeiat m eluvsnu4alenxrciytfpte nvs t setmio ny4aptn ieilsf 2ua( onu4olto octyd aDrauvo;() etrxf ty1lmDeaiesl(  eumio3nodal nlnes () 2tmu o;o4oeeo ictaslaDea( p;()trtrxo ty1fp rai ol( srumxopou4altemieiatfs2uax pno0oexnmieiytfm ea(mo;u0trerxr tatfmtr n sls)t2uoim no4alt mnvi (fa2rm(mp;o0ale io3tyt m ran s;t)tlerxr to1opDeaivi s  rtmir iu4om  lnctatfa2ta( oou1alen o3iasfm2ra(msn()tltoir3iodlmt lnei (  2xmxrpou1lm   nctl(faDtrxmoou1teeoiociad s2umn s;u0tlermr3oa1lmtrlies s)t2tr(opoy1ol emncias srtmuroou1tpto ieiydlmDelumo;()trxoxr3iatfatrai o;(0seum(mpiudal elfvta() 2trumpnt1opx mictltlm ul(msnt4alxrio iy1faDelnvs;s) euoxopou4om n fvs ()arrrxmont1ole  f3tas aDuauvp;()tltrmocoo1fmtrli slt  2xrxm io4llt lnvt tfsrtau ont1tpe  i3iatfa ulnvon(4altomoctotfmD  i o t s2xmimpnudope lnes t  rrmurpnu1apt ii3iytls rl( s;t0arxnmo tadlmDr nvs t)trxo(rpoy4apen iesa(f 2trurp;o1olx mf3iysfaDrln s u)tlenxo3oodlm e neil(  rxo(m ny1ll emiesat srrmxrp;u1tptomfetasfa2ua( s (4 rerxo ta1om rli il()s2tm(r nodapt lnvilt) Drrur ;t0texnmieildla ul(vp;(0alerio iydlm r ies ()t2toir ou4ol   nviltf Dua(m ;u4tpxoioeils aDrlums u)texoir3iy1fp   uvs;( t2tm(m iodlm e ictlt aruaxr nt1tleoio3ildfmDulu snt4arerxo oatfm raivol(0trxr(mpno4op n fcs (  2ua(  oo4olxo f3iyslm rm(mpn(0arxnxf ia1fpt aieo;t0trxo(m3oydapt  fviat) Dua( onu4oex miciys m2uanms;(0treoif3oy1fmtr n o t)seto(r3iy1lpte nvs s) rurum oo4olx ifciadfsDrl(mp;(0alxomo ty1fpD  ueo s) rxr(m3iy4ole livs s)s2ua( o;t0tlxo ietadls2ean on()arenxr iotom  an o (0 rtmiopoydom nlnvtas  rrr(rpnt4teen oeilsfmDrluvp u4 eerxrcta1lat  nei;s0 2uoio no4lpe lneslsfarraumpnu4olt  fctldfm2em(mont0aleoxfcoytoaDe n i;()setmio3ny4lm elneil(fsrrau oot0texn f3iaslsDul(msnu4 eenmociy1lat lu s;t trtrxr no1llenlnesls) rtaxro;o4apt  feiytls rm(mp;(0 lxnir oatfa ranvo t0setrxopno4alee fctlsf 2ta(root4olxniieiydls uanvs (4 etrmr to1fpD  iei;s  2tm(o3io1lp  livtlt  rtru oot4apx moeiyt s2ea(vo u) lxnxoctydoa  li s s  2toirpoydlmtelfeslt srrm(  nt0aexomiciysfmDel(mp;()teerxociytfatr nvi (0 rxmxm iu1ol nmnct s  Dtmurpoo1aeenmoeiatfm ulnvp;u0tlermf3tytoat aies;t) rtm(m3oodop elieslt)a2rrumooo4tee if3tysfa eanmsn()altomr tytla rln olt)t2tm(mpiodopenmfcilt)a2uaxm ou4open feilslm ea(vp t4trenxociy1op e uvo ()s2uoio nydame liei s  2tm(  nt4olx io3ias m rlums;t) etoiociy1oa eai ols0texm(o ny4omte icil( a2raump;o0alenmietld s rlnvs;t0 lenmf oadfm eln slt) exm(rpnydalee iesatfs2rax p;o0apen o3iasls umnvp t) leoxocoytoaD ai i;t  exoxm iydlltn nesltfsrua( p;u0tle miciydlmDean o;t0aetrir3oydlp rln o;t seuoxm3no4open fcsltfartax ono0alt  ictlt s2rluvs;u)tlenmrcoodfp e ivi t)s2xrxopno4am   fcsatfs2truro;u4oltomi3ias m2rlums t0 ltnxr3oatoa rau i s) rxoxr3oydomee nci t)arumxm nt1olx  ieiydlm eanmont)aetoircootomteaiesl( s2ur(o3ou1olt lnet sfs2raur ;o1optoio3tyd sDuauvo;(4aexrmr ta1oa rli i (0trtoir3no1aleelfesls) Dtr( p;t4aleo fctasla2ea(vont0tetomo3to1opDe u ols teto(m3no4omt mncsltfs2tmu  ou4oltniietldfs2uln s t4trerxf iytlateli s (0sexr(o iu1lptemnci sf 2ur(m nt4tlxn ictltfm2rl( s;u4arxoio3todlp e uvslt texoxrpnodopee feslsfartmurpnt1apeo ietydfm ul( pnu) exoxo3iy1fateaivi;( setoxm3oo4ap   iei t)sDrr(mpoo4apeo oeildlm elu p;t4tleriociodlpDeliei t  rxmxo iy4oleemieslt sDtmum no0oetnmi3iyt s eaumpnt0alermocoy1fmtelies s)t2trir oy1om elieil(fs2tmx  oo1tlt mo3ildfs2umnvo t)arxnxrctodlptran o;(0setrxm3io1lptnmnvtl( s2trxmonu4aleomfctldlm2uaumo;(4 exrmfcto1lm  lnvs s) rtr(o ny4apenmfeia()s2urx p;t1tlt  i3tasfm eaums u)arxomo to1oat  u o;() exo(r3ou1lltnlietlsfsrurxmpou0oeenmoctadls rln p t0tltoifcootlpDeau ols truo(r ny4ll   ncslsfsDtr(m no1apx  ociadfmDul( p;(0aexnmfctatfp  an s (  rto(rpiu4lmtnmivsatfaDrmurpnt4tpxo ociltla2ulumsnt4 ltnmo oytoaDeanes (0texm(m3iudlpenmncilsfsrrrxmooo1altoiieiadlm elu o;u0tetoircio1fatraueol( s2trim3oy4ale lictls  rua(ronu1olt  fcild m2rmn s;t)alxomf to1optelnvo t)seurxo nodom n net s)sDuru  ;u1opeo o3tld m uaumo ()texrmo todlp ranvs s)s2uoxr ny4am emivsa(fartru o;t0apxnmi3tas m eluvpnt) rxnio3oadla  lu i;()t2tm(r ou1ole  iei s) Dtaxmpno1apx ii3tyt s2ea(ms;u)trerircoo1oa rlivo;t t2urxm3iydop eliet t) Dtmuro;u4aetoiociysls ulnmont4trerxfctadopDraneils)sexm(o3oo1llenliesas)srtm(mp;u1optn fctyslmDulnmo u4trtrxr ootom rlnvi;s)trxoirpiu1om n nvt sf ruru ono1openmo3tyd s2ranvo t0trtrxr todfa eaies ( teto(r ou4lmeelicia(f Drmx  oo4tee mo3tadls ul(vs (4tltomr io1lmtr iei;t)srxmxo3no1ll emfesas  2urur no1aex  fciytfmDrmn p;(0 eerxrcoa1fmD an o t0t2xoim io4am e ncsl(  rrax  nu1texnmfcilt a2uanmpnu) lxoxo oodomDeaivi;t t2to(mpnodopee ncsasfartaxrp;o4olen o3iatfs2ra( sn(0tltnmo3totfateanei;( srtr(r iudlp  liesls aDur(rpoo4aexniieiltlsDuluvo u)teerxo to1fmDe ivi s0trtr(rpno1opeelnvtls sDurx oou1tpe if3iydfs umnvont)alxomf iotfmDe uvilt s2um(m3iy4ap  mneta(faDtr(mpnt1tltn fciyt aDrmnmo (4altnmfcoydfmD  uvo t0t2uriopno4llte ivsl()arum(rpot1tptoif3iys mDelnmp;t)trxrmf3tadopD aiei;s t2xrxr io1lpenlietls) 2tr( o;u1oetnmfeiydlaDumnvpn(4areoif3oydlpDe i o;( sexoxrpnydlmte fciat)a2tax p;o1opt  feildfaDrl( o;(4texoir3tydlpDrlieilt0t2xoxrpiy1lp n nctls artr( ooo0texomfctytla2umuvs;t4trtoxr3tydom raues;s srxmirpno1lltnlicils)srraur ot1apeomiciysfa um(mp t)tlxrio3totfmt lieils0 exrxo ou4lme lnct ()a2ur(m nu0tptn oeiltls emu o (4teerxf to1oateaivils0setoxm3oydop  lnetltfsrrau o;t0teenmo3iatfs2emnmo t4 exrmocoodfa rliei ( trxo(m nydll emnvsls) 2tau o;o4tlxn octatls2uanvo u0tltoioctydoptrlieo () 2umxr3oy1omtnlivt s)s2rrxmooo4tetn feiadlmDul( sn(0tlenmf3ta1late n sl(  2tmim oudol elfeta() rrru o;u1apx mo3iltlm2rauvo;(0 eerio iydlpDrai o;(0srurxrpnu1lpe  ics s  2ur(monu4aetnii3ias s2uln on(0aetrxocoodfp   ivi t  ruoxrpiudlptemivsasf Dtmu  nu4oexoioctyd mDrluvp;t0altoioctodlaD  i ol( srxoxmpnu4omtnmfcil(fs2ur(mpnu4oexomo3ildfm2rl(vsn() exomo to1fa r u sls s2xrxr iy1lltemnet s s2ta(rpnt0opeo fctls m rm(mo t) etnxr tytlaD auei;t  2tmxo3oy4ape lfcs sfsrra(r ou0olt mo3ild aDemumo (4tlxnif oytomtrau i t0t2tr(o nu4omtelivsls  2umumpno0aleoifctatlsDul(mo;u) rxrmocoadomDeau i;() eumiopnu4alt lict s srrmx  ou1tltoiociltfsDrmnms;u) lerirciotlmD aivs ( seurxo nydoleelivi ()s2tr(monu0oltoioetat a rauvp t4 lxrxr3ia1fat anvi;s teum(m3oydlpt lfei s aDta(root4apx mfcild s2elu s (4altoif3ootlmD lu i;t)t2tmxmpiy1am elfetls) 2trxmoot4tex mfeiydla uluvo;(0tltnxf3iadlpDeln il( srurxm3ou4am  lncsa( s2rm(r ot1teenifctatlmDulu onu0texnircio1fate ues () rxrim iy1lme  nes s)a2tmx p;t0opto fciytfs2ranmpn(4 lxomf3oy1opDran i (  etrimpou4lpe mfvt t)a2umx p;o1tlxomociysla2rm( p;u4aexnmrcio1la r ivo;t t2xrxo3io1ape lnct (fsDtmxro;u0opt mociltls rmnvp () rxrmo3oodlpDe n il(0trxmir3iu4ole livtatfsDrr(mp;t0oexo iciadfm2ul(vpnt4arxoio iatomtrau o;s trxrxopiy4ap nlfvil( aDra( poo4tex iicias a el(msn(0 eenircia1oat luvi;s0t2xmirpnudam  lici ( aDtmumpoo1texoif3iat m ulu pn(4treoxf3iadfatrln sl()s2trxm3ou1op  lfctlsf Drrump;o1texn feiydfs rm(vo t)texrmr iotfptrai s;s)setoxr no4lmtnmfeslt aruaumoot1aexo fetadfs2ra( p (4aeerio ta1fp eauvi;() 2xrxm oydlmenlies ()s2uaxm ;o4opxoiietltfm2ra(msn()tlerio3oodlpDr nvi;s0t2to(opiu4op  lfct tf 2raurp;t4oeenmi3ildfsDum(mpnu0trerifcootoptr n sl(  rtoirpiy1opt lnes (f 2ur(rpnu0aptomi3iasfa2elu snt0tltnmr tydomteau s () exo(o oo1om  mieiatfarra( pou0olt iictydlmDuaump;t4alxomo totla   uvils)trtmim nu1amte ivtat) Dtr(r nu1opxniieildla2rmnmo;t) rtrxr oytlmDrlneo ()trto(mpoy1lptn fci t  Dua( p;o4tpenii3iyslm ran ont4 ltrmr oytom rauvol( srxmxrpoydopeelfes t)aDraxmoou0aetomoctls mDeanvp;t4arenmf tatop  auesl() eto(o3no1am nlnvsl(  Dua(r nu4tptnifeiatla2uaumo;t0aetrif tydfa eluvilt0 2umir iudop emnvsat aDrmu o;o1oet iieiysfsDeaums;(4tlenxrcoodopD lneo;t)teurimpiy4ll nmfes s s2ur(rpou4tlto ietyd m2ulums t4aexrxo io1opD  nesls s2tm(m oudlm   fviltfartaum nt1tetnii3iyd m eauvs u4 rtnmr iytopDr nvols  eurxo oo4altemicta( s2rauroou0tle  iciasfsDuaumsn(0arxrxfciatomD anei s) 2ur(o3iu1openmfesls)artaur oo1tlen ietyd aDra( pnt0 eermrciy1fptr n ilt  rtrio3oodllte nvtl() rta(m ;u1tltnmf3ilt mDea(mo u) exomf oydopD li ils srxmxopiodlltelnet () Drrur no4olen i3iadla2um(vp u4tetrxrcoytom  luvo s trurimpiy1lle mfetas  2tru pnu1oeenmfciadfmDrm( p;() rtnxr3oo1faD lneilt)trxmim nu4lpt lnvil(fs2trump;o4tlxo ietytlmDumnms;u4artrir3oy1fpt  nvs s sexoxr3oo1lm n nvt sf Drrum oo1tex mi3ils a2um( s u4tetnxrcoo1optelnvo;( tetr(m3nydaptn nesls)s2ra(ro;t4aet mo3tyd sDrln s;t) etoifcoodlpte ueslt) eumir iy1lp elivs tf rra(rpou4tpx  oeiyslmDrmn snt0trerif3iadoat lnei;s teurir3iy1lm n nvsasfsDra(mo;t1tle  octldfm2eanmo;u4aeeomo oodom e i ilt  2um(rpiodopt mnesatf ruax pnt0tetnifciaslmDuanms;()trtoir3ootop  anes (  2ur(r ou4lmeemfvsat)artrxro;o4aee mociytfsDrlnmo t0trtoxocoatlp   ivi s0srumxo3no1llenlfesatfsDua(  ot1aet  ocilsla2rmnmo;(4 etnxfciodoptr nvo;s)trxoxrpoo4apt lietls)arrm(m nt1apt ioeildfsDumu p;u0alxrifctytfaDr uvi s0t2xr(o iodolenmnetls)s2rm( ont0alxoioeilsfa ra(vp (0 ltrifcoy1fa e uvi;(0trtoxo3iy4omenmietas) 2umx  ou4oleniictyt s2ranvsnt)tlerifcoydla   u i t) ruo(o3iydap  mnvtas sruaxm nu4apt moeilsfs2rl(mo (4trxoxf3todoatraueo s0t2xrxmpnudlleemfes () rua(m nt4tpe  oeils m eln p t)altoioctodlmteauvo;s)s2urxo3no4oltemieta(faDraxmoou1aetoio3iyt a ranvs (0areoif3ty1opt  iei s0t2xrimpnu1al  miesl(fsDrmu  nt0tpx  fciadfaDelnvs t0aleomfcootlpt lieo t0s2xoxm no1altn feils)aDuaxro;u0optnmoctaslm umu o;t4texrirctodom rauvil()t2umxm3oodomeemnci t aDtmumo;u0oleomoeiat a2emu pn(0aexnxf3iadom r u s s setoxr3iy4lp  mnvtltfsDurxmpno4aexnifciadfs eanmpnu0tltrxf tatlmteaieo t0seurxrpou1llt livsltfsruau pnt4tpx  i3iydlsDuln o;u4trtrxo3tatlpD ai s;t)srurimpnu4ale mnesl()aDrr( pnt4tptnmo3iydla2rl(vpnu4aleoir3iydla rlu o (0 rxo(r3iydameelieta( sDrrurpot0aeeomfciytla2elnvon()aeeoif3ia1lmteaivsl(0s2to(o3iy1oltnmnvils)sDtr(m ;u4ale mictasfm rm( s t) rxnxf3tatfmtr u ils0 2tmim oodlpenlncsl(fa2rm(mo;u1oeeo fctydfsDum(vp;t)tetomo ty1omD luei s  rxo(mpiy1ope mfeiasfsDtmxmpnt0tet iociys a2ulnvp;t0trxnxr3oydfpt  u s t) 2tmiopiy4lle mieia(fsDtrx onu1tleniieiytlaDua(mo (0aexoxrciytlm   neo (0srumxo nodoltemfvi t)a2tmx  ;u0tlto fciys aDulumsnt4treoxr oatoatranvilt  exrxrpny4om nlfcsl(fa2ua(m ;u4aetn fciytfm2rm( s t4artoio iotfmDelnvo t0 euoxmpou4lp  mfeiatf 2um(mpnt4opt  fcias aDumnms t4tlxoxo3iotfat  uvo s  eurxo oydole mncsas sDtrxr oo0tpxnif3iyt m2ua(vp (4aeerxo tadop e ies;(0 eur(o3ou4ol   fvi () Dta(m nu1tleniociltfmDrauvpn(0arxoxo iotopDrlu i;t) rtrxm oydlpeemfvsl( srraxmp;o1oex ifciltfsDrlnvs t0 lxnmf oadfa e n i;(0s2urir oo1llen iciasfarumxmpoo4tleo fciad sDrau s t0texnmf oadfa eau olt0setm(o3oy4openlivs s  Dtaxrp;u4tpeoiocilsls2raums ()treoxf oydomtr iei t0 2xm(r3nodol  mnctlt  Dtmxr ou1aet  ociatfmDul( o ()aexnxrcoadom elnvi;t  rxmxopoo4alenmivi (fsDrrxmooo4tpe miciydlm2em(vpnt) etrxrcia1laDeli sls0t2uoio oydaptnmfcta(fsDtmxr oo1aleoioeiysfs2rmnmp t)texrxo iadom r u olt0s2um(m3nudlptn fci s)a2taxm nt1texn ociltfm umnvs;(0tetoxo3totlptr ieils) 2trxo nodol  mneia(  2urur no0tee mociyt a el( o;t4tlxnio oydfmtr ueo;s)seurir iodlle lnvsa(  Dumx  ou1tltnmo3tldla2ranvont) eenifcootlm   ivs t0 rtmxrpny1opt micilsfaDtaxrpnu0tlxnmi3iyslm2ra( pnt4trxrmo3oytfat ai s ()t2umirpiu1lpeelietas)sDumurpot0ope ii3tysls2eln s ()tlenir iy1fpD aneo;(0 exoxm3iu4lp  lncias srtax  ot0apxnmieiydls ulnvo;u)texnmfciodfmtelu o;s s2tr(r3ny1lmenlnet t sDtau onu1tpeomfctadfa2ra(mon()teeoxrcoo1fmDe i s;( s2um(opoudolenlietatfartax ono1tpxomocild a2ranmp t0 rxomo3iytoa   neo t  2xrir iydapenmncta(fsDtr( ono1oet mfctat s2rmnms t4arxoif3oytfptrlueo s)truriopou1omt mfcs (fsruru pnu4altomf3iydls2rmnmo u0arxrxfctodopt  iei;s0trur(r iu4apeemivs s)arurxrp;u1aeto i3iys m ranvp;u4trtrmrcoadlmD luvs;s seumxm3ny1ap   fet tf rraxm oo1oltniictlsla um( p t4artoir iatfmDean sl() 2urxm no4lpenlfcs ()a2trurpnt1alxnmfeiys m emump t0aexoiocoatopte i s s0 rxoim3iydap  mncsas aDrax ont4alxomoctlsla uanmp u)aexomfcoa1faDr i i t s2xo(m iy4alte nesas artr(r ;o4oetnmf3ilt m ul( pnu0 lxnif3oa1fmD lu s t)trxrir3no4olenmfeiasf rur(rpnt0aetnmf3iltfa2umuvo (0trtomo todfmtr neo s0 2um(o3ny1am e nvt ()aDum(  nt1tetn f3iytlaDem( p;t0 rtrir3iatfpDeai s s0 etrxrpou4ale mfcilt) 2rm(mp;t1apt  o3iadlmDul(vp t0teeomoctydopt lnvolt s2tmirpoudlltn fvs sf rrrxr ot4tlenmicildlm umn s t0arenmfctytom eanvolt  rtmxo oy1oltelfcs ( a2rm(rpnt4tptnmi3tydls2umumont4tlermo3oodomDrliei;s trtoir3nu4lpe lnes s s2trxroot4tlen f3iysls2ean s;u4 rxnxocoydlpD an s (0sexoxr iu4ame mnviasfsDua(r no0oeeomocilsls umnmo u4 exnio ta1op raies;(0s2xrxopou1lp e icsl()a2umumpot4olt  ocilsfa ranvp;u0trxrmo oatfa   ivs s sexrxm3iydomt  fvsa( aDumxmp;t4altomfeiytfa2eln o t4tltnifcootopt an s s  2toxr3oo4lmtnmicsl( srua(mpnt4olxoiietat a2um( onu0tetomo3iydfaDelivs;s0texo(r3iudomt mfeia( a2trx p;u4tpt  o3tasla ra(mo t4alxnmo oatlaDe uei t srum(rpoy4lptelnesa(f rrr(  nt4tetoii3tlsls2ra(mo u4trtrxrcta1laDe neo s  rxmim3ou1lptn fci ()srua(  nt0altn o3iytfa ua( s;() eeoxr3oydlat lneolt0 rxmimpiydape mietas s2uauronu1ape  ociydlm rmu s;u0arerxr3to1lptrlu o () eum(o3iy1oltn fetlt) 2ra(m ;o1altn ieiltls2ra( onu0arermr iy1lptran i;s0t2toir oo1lltelfetlsfsruaurono1oexniociltlm2um(ms;u4teeoxrciadopDean i;t) exrio iu4lpeelnvi tfs2ua(mont4apxomiciytls rmu s (4 etrir3todlp elues s s2xm(opiu4lpt  fvsa(f 2rm(  ou4oleomoeiat sDrmu snu0tlxnif3iodlm  ai ols0t2toxm nu4lltnmictltfsrrm(  ot4texoio3iydfaDulnvs;u0tltrmf iydfatr nesls)s2trxm3no1ope lietat a2tmumoou0alto o3iyt sDemn s u0areomo totfatr ieo;s0seumxmpoydll  lietltfsrtmxm ;u4tptomo3tltfa um(vp t4 lxomrcootoate ivo;t0texoim3nudap  livi sfaDtmx  nt4aeenmoeilt s rau o t4arenxr3iytfpteaueo t) exmxo iy4am  lfcsas) rrru pnt4ale  i3tysls um(mo;u4tltrir3io1fp   ieo;t srtoxo3iu1ame livs t)srururoou1olxo oetat a2eln pn(4trtrxr oa1faDr i s ( srxriopou4ole  feias  Dtr(rpot4tlen i3iad mDumumo;t4 ltrif3iadomtrluvs;s)s2toim3iy4lp  mivtls)aDrrxro;o1tlx ii3iyt s2umumpn() etriocoo1fa eauvs;(  rxo(m no4opee fet tfaDurump;t1aexoiictyslsDranvpnt4alxrxrciotlatrlivs;t)texm(opiy1am nlfcil() Dumx p;t4open o3ildlm ranmp;u4alxomr to1lpteanvslt)sruo(rpnu1lme  icsa(f 2rmxro;u0tle  f3tld m rl(mp t0texoio3to1fptrai i () eur(o3nu1omte ieil()srraxr ou1tptn i3ilt m ea(ms;t0 lxrmr iatlp eai o s)srur(opoodale  nctas  Dur(r nt1tlen oetls m rauvp;()arxoirctodfat an o;t t2xmim3iu4omte icia()artrxr ou1teeoif3tad sDemnvs u)arxnirctadfp   uvolt texmimpnu1lmeemnvtlt srurur ou4aeenmoeiat m2umu p;t4tetomo3oodoatelnvi s  etrxopiodopenlfes s  rur( oou0apt mf3tas m2elu pnu4arxnir iytlmD lnei;t)srxmxo ny1olt micsltfsDuaurono0tpe  o3tldlmDulnmont)altrxr3tytopte i olt trxrim3ny1omee ncilt aDtrumooo1tlen o3tltfm rmnvo;u0aexoifcoytfmDrai sls t2xoiopnu1om emivsa()sDra(ro;o4aeeomoeiyslmDel(vs t) eeoxo3oy1lm r nei;t srtoim3nu1lm   feils  Durum ou1alxoioetas sDuanmonu4 lenmo tatfpDrlueols0trxrxm nodol nmicilsfaDumxm ;o0tpxn oeiatfaDranvon(0 eerir iodlm r uei t)trxrim iudamt mivtls  Drrxmp;u4ape  fciatfaDuanvpnu4 etrif oy1fpD  u i;t0 rxoio ou4apte fet s aDrrurpot0apx mo3tlsfm2rlumsnt)tltrmo3totfm e uvs;t0tetoio ny1lmeelfvt s aDtmumoot0aptnifcils s2ua(vpnu4 lxrmrcoo1lmtr ivs;t0 eum(mpio1lme  ncslsfsrtrumo;o1tpx  feiatls2ua(msn() rxrmo iodomtean olt)trumxr io4ol eliei s  rta(mont4opx mieilslaDuan p;u4tlxoif ta1fptranvils0s2toir3nu1omtemfvtl(faDumurp;u1apeomfeiatfs2ua(mpnu0 lermr3tadlp   n i s t2uoxrpio1lpe  fetl( sDrauronu4aet miciatlaDrln sn(4aetnxr3iotlmtr ueolt)texrxr3nu4oltnlnvsls  Dtmu  nu4aetn ictyt a2ra(vp;t4trenio3oatfm elivsls) 2ur(mpoydlpe lncslt srtmxmp;u1altnmf3ias sDuln o (0aleoifciatlpt luvs t)srxrim io1lp nlnciatfarra(ronu4tpe  oetldfm uluvonu0aetnmr tadlateaiei;s0setrir iudalt  nvsa()s2tm(mp;t4tpe mietadfs2rmnvpnu0areoir3oatoate ueolt) rxoxrpiydll n ict t) ruaxr ;u0aleoifeiasla2rl(ms;u) lerxfcty1fpDrlueol( t2xr(mpou4lpt mict (farum(mono1alt mfeiat s ulu o u4 lxnif3iadlm r nvilt) etrxo3ny4lle mfvi (fsDtmxr ou4oleniiciltfa ra(vonu4 lerxrctodfpD aieo (0 rxm(opnodomee fvtl( s2rmxr oo4apeomictltfm2eauvpnu)tlermrciatlp r u s (0t2ur(o3io1omtelnvsat  Drau p;o1oet io3ias aDeanvo u0 rtnif3iodoa raivo t) rxr(rpiu1lp emicslsf 2ra(  nu1tpt ioetatlm ea(vonu0aexrmo tytlpt lueol( srtoxr3oudolt mnvt t srtr(mpoo1ale iicildfa ua(vpnt0aetoxrciadop elnvs;(0trurxmpny4lp elnct (  rrax p;u0tpt  i3tydfsDelnvpnu0arxrxfcoytlm   nvs t0srtrir3no4opt licil( sDtmxro;o4oltnmfeiytfmDrlnms;u0trtrxo3io1fa eau s;s0trtrxr no1lpt mnvtas)arua(m ;u1apenmo3tas mDumn p;()artoxr iodfaDrai i t t2uoim oy1olenmfvslt a2rr( pnu0opeomictydla uauvp;t0aeeoxf3oa1opDran il()trurxm iu4olt lfes t)srrrxm no4oeeoifeiltfmDuauvon()aexnirctodlpDean o s0 rtoim no4ap nmnetat a2umu pno1olen o3ildfmDumu o ()tetoxr3ia1faD  u i s0t2uoxr3nodlleemncil( srrmx p;u0oee mf3tyd m emu pnu4 rxoirciydlm   i s;t  etoimpiudamt lfvtas sDta(m ;u0tlxoioeiadlsDulnmp u4alenxr oy1omteli s;() exmim3oodlmt mnesa() Dum(rp;t4tlen f3tasfs rm(mo u0 etnir3tydfaDean sl(  etr(opnydoptnmiciatfs2raxro;o0oleo oeilsfsDrlump;()trenmocoy1opte nvo;s  2trio3oy1lpt lnvt t)aDum( pno1ole  i3iyslm2rl(mo u4 rxnio oadlm eaieo ()teuoiopio1ale  feiltf rraurpnu1aeto ieiytls umn s u)altomfcto1faDeaiei;s)truoirpno1lp   nvia() 2tau o;o4tet  i3tat s2ranvp;t4arxnxo tydlm   uvslt setmim io4lp   nvtat srumurpnu1tpxnmocilsla ua( p t0aetrir3oadfmtrau ils srxoxm3oo4om nmics t)arumu pnt4aexomieiydfsDel(vs ()aeeomfciy1fmtean sls0 eto(o ny4oltnmiviat)arrauro;u0tpxomictadfsDea( pnt) lerio3oadlaDeaivols0 rtr(rpiu1ap  livi t arrrum ;u0tpxomo3iad sDea(vo;(4 rtrmo tadomt lu i () 2urimpnydole  ictlsfa2rax poo1olx ioeiatlaDra(msn(4teeoxo io1lpD luvilt0 rum(m nu4alen fvtlt  Dra(  ou4tltnmiciadls eaump t0aeerifctodfaD ai s;t trtmxopiu4ap n fcta(farra(mpno4oeeoii3tad aDeluvonu0trtomf3iodopDeliei s0trxmim3oudll emnvs ( a2truroou1oetnmoeiytfa2ea(vp () eeoxfciytfa  au s;s sruo(m3nudalenlfcil( srtr(r ;t0oetomfciysls2emnmsnt)trerio3ia1op eau o s)t2toio3io1ape lfcsa() rtmxr nu4ale io3iatfm eanms;(0 ltoiociydoptrlu o;s0 2xrio ny1altnmivslt  rtmxrpnu0tleomi3ils m rmu o;u4aexnircoytoaDe u s;(0seumim3ou1lm nmncsls)aDtmurpoo4oexnifetls mDeanvp;t4 rxnif3oatfpD lu i s setm(mpnodlpeemfvsl( artm(rp;o0tltoioctydfaDemump;(4 lxnio3oy1fm elueo ( t2toxm3oy1lmt mnvtls)a2rm(  no4aetomoctat m ul( onu4 etrxr3oa1la   ivi;(0 rxoir3ou1oleemivilsf 2trum ot4opto oeiys a2rl( ont0areomf iotom ean i ( s2xo(m3nu4op  mfvtat)srta(mpnt1tltn ocias m ea( p;u0treoircta1fp e ivi t0t2xm(o3ny1ame  nvi (  rtax p;o0apen oeiyd s uanvsn()texoifcootfm elieol( tetmim3oo1oltnlnvsl(fsDua( poo0opeo fctldfm2ul(vo;t4tlenxrciodfm  lies s0 2um(o3iu1oltn fvt t)srua(m nt1olxn oeiyd m ul(vo u)arxnir3ta1oaD livo;s)s2xoimpnydll nlnes (faDraxroou1altnmi3iaslmDemump;u)trxrif ia1lmteai s;t srto(opiudope lfetat srtru  nt4aetoio3ildlm ra( p;(0 reoxf tydfatean ol()setr(mpoydlpeelivta(  ruau pot1teeoiietyd sDulnmp;t)texrxr iytfpte u s;s t2tmxr oo1aptemnvi t sDrrxrpnu0tlxoifctlsfm um(vpn()areoxfcootom eaivilt)s2uoir3nu1ol  mfciat)a2rmxrp;u0alx mociat a ulnmon(4trtrmociytomD  uei;()sexrirpiodlpenlfciasf 2trurpnt0opx moctld a ea(vont) exnxr to1fpD  neo s)t2to(r3nudam n icia(farumxrp;t4ale mieiydfa2rlnvo;(0trenxr tadfmD au
\ No newline at end of file
@@ -0,0 +1 @@
+nvolt) rxo(m oy4op nlfes ( a2umx  ;t0apx  ociasfmDuan s;(4 eeoiociatlmt  uvslt srur(o io4lmen fvtat a2ta(r nt4oetomf3iydfm2ulums;t4 lxnxf3oy1oaDelueo;t t2umxo3nydomt lncsatfs2ta(  ot4oee  f3tat a2umumo ()texomfcoytfaDrlu sls)seum(r ou1oleemivtas s2tr(mo;t1ape mo3tlslsDrlumo;u0aexoxo oytlmD aueols0texoir iu4lmeelivtls  Dtr(m nt1tlxnifctysfs2el(vpn()aeenmo3iatfpt li sls  2uo(r3iy4opee fvi tfarrm(monu0oltnifetad s rm(mo;(0treomo3oo1lpDeaivo s0tetoxr iu4amtn fvsatfsDtax ont0tpeomietadfsDeanvsn(4areomf ootfpDelueo t  2xmxrpoo1llenlfct ()a2ua(r ;t0alt  ieiadls2umn p t)trerir3oatlp  luei;t)texm(r3io4om elietasf 2urum ;t1aptnmfctyd sDelu pnu0 leniociatop e ivs s0srtoiopoo4apeelfci s) 2rmxm ou0tet moetatlsDulump;t)alenxocoodlaDraivs;s)tetoim3oy1am nlietlsfa2tr(r nu0olto f3tytfs2um(ms () rxomo iytlp  aivs;t0s2to(r io1ale  nctat) 2trxm ou4opx ifeias sDranvp;t4texrmrcto1laDe nvs (  2trxrpoydomeemivs (  Dra( o;o1opx ioeils sDuln o t0teermo3oy1la eau s;( sexm(o iy4olt mncil( s2rmxrpnt4aex  oeils aDulnvp;(0 rxnxo tatfpDe ueo () euo(m3nu4ame lneilt  2taxmpno1tltoii3iydls el(vsnt) rermfciadfp  an o;()trumxo ou1al nlfvslt)a2ua(mpot1ope  fciydfs emuvs (4trxrmo3oydlm  aivi (0trto(rpiudlmtnmivi tfa2uax pnu4alenifcild m ulump;(4trtomr oydfmt au i t trxr(m3no1lptnlfvsl( srua(roou4apxomo3iatfaDrl( o;(0aexnxr3oodlp elueo;s)s2xrxr3io1lptn fesa(farra( oot0aex  i3ild a2ulnvsnt4aleoirciytoate nes;t0tetoir io4lptnlnetltfsDrrxmp;u4apxoii3ilsfa2rlnvp t0 rxnxfciotop eluvi;s0 ruoxmpiudlpe mivsl( arraumpnu1oltniieiatla elu p;t) lxrmfciy1fpD aiei;t)s2xrimpoy1lpen nciat)aDtax  oo0alxoiietyt a elnvsnt0alxrmr3iytfmteanvi;s0s2xoxr io1lpen nesa() Dum(m ot0opxniociasfs2rlumpnu0aetnif3oytlp r uvols0s2xoimpno1amtnliciasfaruaumooo0opxo o3ils mDemnvo;t4arxrio3totfptrluvi () rxm(rpou1lltnlfvtltfaDtrxm ;o1tee ii3iyt a rmnvs u4areomoctadomtrli o;( sexrxmpny4altelnei t)a2ta(mo;u1olxoioctat s umnmp;(4texnmrciotop  auvi;t texo(r3iu4lmt mfvtls srraxro;o1alen f3tys s rmnvs;t4artrif3ta1lmD luei (0s2urxr3io1alt mfvt tfs2rru  no1oltn ieildfa2rmuvsn(0aleoxf3ia1oa rlieols truoio3ou1ale  nvi t aDraump;t4ape moeilsfm2umnmpnt) eeoxo3to1omD aieilt s2umim3ny4lmeelnvi ()srraurpnt1ope iociat sDumumo u) eenmf3iydfatrauvi;(  rxo(m3nudop nmivia(fartrur ;o4apxo ictaslaDuanmo (0texrio oodlm rlnes ()s2toxopiy4optn ietasfsrrr( ono4oleomi3iad aDumu sn(0artrmf3io1fptraieil(  euo(m3ny4optelnesls)arur(mpno1aptnmiciydfm2umuvs u4aeerifciadlatrauei;( tetmir ou4lm emneias)sDrrxr ;u4apt mi3tltfa2eaump t)aeenxo3io1fa elnvols0trxm(rpoodamt mieilt)s2ta(moot4oet  fetasla2umnms t4areomociotoa eli s ( srxm(m3nodope mfcsltf Dra(roou1teeoifciltfs2rl( s u)alxomfctytfpD lu slt srtmirpoy4ame lfet t) 2ua(mo;o0teenmocilsfm2ean o t)trxoiocoydopt anvo t) ruoxrpoo1op e fvs sf 2rmum ot0opxo f3iadfm2emumsnu0trerxr3tytlaDe ueo;s tetrxo3nu1olenlict t) 2ururont0apenmoetyt mDrlnvo t0teeoiocoodfpDeai o ()srtm(rpnu4ll n iei tfa2tmx ooo4texomi3iat mDulump t0teenmo3oadfmte n slt0trxoxr3nudam nmnctlt aDur(  oo0tex iociad aDem(vp t) rxomfcoatla  li ils0texmim3iydolte fesas  Dtr(moou4aeto f3tls s rl( o;(4trxoxr3iydoptr ies t0srtoxr3iu1lmee ics (fs2tmxront0ope ifeiatlmDeauvp u)arenmo totopDeauei () 2xmxr oydalt  ivils  2rrx oou4aetnif3tlt aDrmnmp ()aeeoiocoy1opDeluvs;( srur(r io1omenlieslsfa2urxr ot4oltnioetls a2rluvs u0treoir3oo1oa rai olt0t2trim3oudlp  lfcs s  rtax poo4ale  o3iasla2em( p;t4trxoxf3ta1fpDr ueo;(0t2urir iudomt lnciasfartmurpou4alx mo3iatlm uanvs;(4tleoifcoytoaDr uvs s0trtrio oy4op  mfei sf Durur nu4optn fetytfm ulnvsnu)tetnmr oydoat  ueils)setrirpno4omeelfvta()a2rm(mpoo4oeeo fctas m2emnvp ()artrxo3iadfp rli i;( texoxm3io1llte nci s aDurum oo1tle iictlsla2rl(vonu0 rtnircty1oateliei s  eumir nu4omenmnes s)arurxronu0tlx mieiysfs ul(von(4tltnmf3oy1lmtranesls srxmio ny1ol  micslsfaDumxro;o4aexomf3iadfmDul(vp t4tlermr iatfaD luvi;t0 euoim oo4apenlfesl(faDtmx pot1oet mf3ilt a rmu o (4texomo3iydoptrai ols0sexoir ou4ameemics s sDtmurp;t4apenmoeilslaDrau pnu)trtrmr tytopD  ivils seuoio3oy4al e ies ( sDum( pno4alt mfeilslm2rlnmp;()tetnxo3iy1fpD  i s ( texmir io4lleemfvi tf rtau oot0tlenifciadfm eauvsnu4 rtoio tatom eaueils srtoxm iudlltnlfei t)artmxm nt4opeo i3iyt a umuvs;()tlxomf iadopDrlueo;() 2xrir iu4apt lfeslsfartaumont0olxnioetad mDrmnmsnt4 ltrir3oatopt li o (0 exm(o no4lmt mncsltfa2rrxmont4tltnifcilsla rl(vsnt) rtnircta1lpD auvo () 2tmio3io4ap n fctl( s2rmu  oo0opxo oetad mDum(ms;(4trxnif3oydfm rln ilt) exrxrpnu1apenmivsl( aDrax  ot0texniietydfmDrluvont0tetnir tydfmD lueo;t0s2uoxr iu4omtnmncils sruaumoou4aet  i3iyd m emumpn(0 ltnmr3iodfatraiei ( t2xr(rpoudoltelnei sfaDum( p;t1opto feiatla rluvs ()aexoif oadfateaues s0 ruoimpoodop nlnvt ()aDumumpnu4oexomo3ilslaDrm( p (4trtrmo3ia1lpt  i o;(0srxr(rpoudlmtelicilt) rrmu pnu0opx mieild aDemnmo t)aexrmr3oy1laDeaues t  rxoir3ou4lmt livtlt) Durxrpou1tle io3iasla2elnvsn(0 eerxfciydlp raivo;(  etrxrpno1amte ietlt)srta( pou4alxnif3tadfm2emu p u4aleomr oatfateauvo s)srtr(mpny4optnlfctls sruax ont0opt  i3ilsfmDrlnvonu0 rxrifciotfaDe ivo;s)trurim3io1lpeemfvi sfa2umxmono1aeenmfcilt s em( pnu)aeenir oatfmDeln o;s0 euo(m nudom  mivsat s2um( ooo0apeomo3iys mDran on()trtrio oydlmDrluvslt0teur(o3nu1lptn ieilt srrrumooo0tlx iieiyd m2ulump (0treoxo iadlptrlnvil( sexo(m ou4ll  liei s)s2uaxrpou4oee ioeiadfm2ul(vpnt)aetrxrciy1omteli i;t0teum(r iodoptemfeias)aDra(rpou4aexoiieilsfsDrl(mp;t4 leoxr3oodfpDeaieo s) rur(r ou1op  lfviat a2trx o;u1oex  f3iasfm2ea( p t0 reoircty1la elu o s0sexoim3iy4al nmictl()a2rr(mo;o4olxo f3iatfaDrlnvs;(4altnir3iydfpt lneslt)trumimpoudol e iviat  ruaxr ot4oeeoiiciadfm2um(ms;u0arxrmfctytoat anvilt)seum(o oodoptn ivi t aDuax pnt4alx mf3iytfa2eln p t0trermr oodfa raneolt s2urxm3ou4olee ieslsf rrruronu0olxoioeildls2rlnms (4alenxr oa1lp rlnvi;t0 exm(o3iy1lltnlfvt () rtm(m ;u4opx ifeiadfmDea(vpn(4aexnxfcoydom eaivilt0 exrio oy4apenmieta( aDur(r ;o0tpto i3ilslm emu sn(4 lerxo totfatrlu il(  2trxr ny1ll nmnvsasfsDum( oou0tltoii3ild mDuauvp;t0 etnmociydopDean i;t0t2um(rpou4oltn nvilsfs2umum ou1tlen fciydfaDumnvpnu0trtrifcootomtelnvs;s) rumio3iodalt mivtasfa2rmu pou4opxn i3iytlmDemumsn()tlerifctotfa e i il( t2trxr3io4am  lics t a2uaxm ;u0tee mfciasfs rmnmo;(0arenifcoadomDelu il()t2uoxmpiu1aptn ict (farta(mpnt0teeoio3tys mDua(vo;u0 renxr oatlp   ueo;t0 2urirpny1lmeelneiat arurur ;u0aex  iciyslm2ra(mp;t0arxnmo3oydfmDr iesls)trumio3oodomeemnci (  2tau p;t1apx mi3iat s uau o;t)tltnxf3ta1fa eln i;t srtr(mpno4llenmietatfsrrmuront1aptoioctaslmDuan p;u) exnir3iatopte i o s  2xm(o iydale mncsatfa2ra( o;t4tlx iietlt s elu snu0tetnmrcootfp elnvol() 2xo(o iudom e fesas) 2rmxroou0openmieiat sDel(vo (0treomf3iotlpt  u o;t0 euo(r oy1omtnlieia(fa2rm(mp;t0aeto i3iysfs2um(vo t0treoio ootoate nes s0s2urxm3ny4ale mieiat)sDtax p;u0oet  feiadfa rl(vo;t) rtoxfctadfaDr uvs;t)seuoxm nu4lptnmncsatf 2rm(rpnu0teeo iciltfm2umnvsn(4 exrxf3tytfp  ai i (  eumxrpiu4ol n fvsat sDrm(mo;o4tle io3iys a ul(mp;t4arxomr iotlmD lueo;(0 rtrio3oy4ope mnvtasfarurxronu1alxo o3iyd m umnvo u4 rtrxr iy1opt lnvi;s0trxmxmpio4lmte iei s)s2um( poo4olt if3tls s2ra( onu0tlxoxf3iadfmDeln sls0 rtoxrpno1am emfcsls)s2raurpno4teeoifciyslm elnmo (4alermo3oa1fptrli s;t srtmir nodlme lnct t  Drrx  no4oet io3iat s ulnvs;u4artnir3todfateauvilt)texo(rpoydope  icslsfsrrr( p;u0teeoioetytfaDeaums u0tlxrif to1lptr uvs;t) 2umxr3oydomee fcsa(faDurxrpno0alen oeiysla2ul( s u0alxoxrcia1lpDe iei;()s2toxo3iodape lnvtas)sDuau o;u4aexniieiydls2ea( s;t)trtomr3iadoptrlu s t0t2toirpiodoptnlneia(  Dtmxront0optn oeiydlmDelnmo;(4tltrio3tytfa elivils) etrxr iudamte fvi sfsrurum ou1tle io3ils aDranvpn(4 rermociotoa r iei s0truoio3iu1op emict sf Duax  nt4tetnii3ildfa eanmp t4 lxrir3oydoptranvi;s)seto(m oy4olee ivt tfa2urxmp;t0tpeoii3tys s um(ms u) lxnirciytoa eluei s0s2trxopoy4openlnes () rur(mont0olt moeiysla rm(vsnu4arermfcoa1oate n i;s)tetmio ou4aptnmnet t) 2tm(rp;u1tle  feiatfs elu s (0aetoifcoo1op e nvol(0srtmxmpiodll e ncilt srua(m no4tltn ocias a rlnvpnt)tetrir oatfa r neols0tetrimpnu1ol emneiasfsrurxm oo4aeenioeildlm umn o (4trxrxf ty1lm rli o s0setm(m3iy1ll nmics t) rum( o;o0apx if3iysfmDrmumo;u) rtnmrcto1lmDraues;t trtr(opoydomtnmfeia()s2raxrp;u4oeeomicilt mDeaums t)tlxoio tadla e i ol() rurio no1altn nvtatf 2umump;o0oltnmfetldla2ra(mpn(4 etnmfcto1lpte uei;t0srtoxr3oo1ap  mnetat  Dua(  ;t0opxomfetytlm2ra( pnu4trxnxrcoydoptelnvols0texrio3no1openlnvsltfaDumxmpoo0ole moeiyslsDea(mpn(0arenxo ia1fatranvsls)seto(r nudlptnlivta()artmurpnu1tetomfeiydfsDemn p t)teeoifcoydlate uvo (0t2xrxm3iodap n ici sfa2um( poo4texnmfetas a eauvs t4 rxnir totla r neilt  ruo(m ou4olt miet (  Dtm(r oo0tltnioeiat m2rmnmp;t4teenmfcty1fpDelnvi;(0sexrimpnudop elfvtl( srumu o;o1oltoio3ias aDulnvsnt0aleoif3to1fp  aieolt t2tmio iy4al  lfetls aDrrurpoo0ope moeildfmDrmu o;t)arenio totfa   ivo t t2xmxr nydlmte icsa()srrrxr ;t0apxnifeils sDem( p t0trxrxr tadopt lu o t)srtrxrpoo4olee fvsa()aDtrum ;o1apt  i3iysfm rlnmpnu)tlxnircootlpD an s;t tetmxm3no1al   ncsat  rrrxmono1ale  ietas a rauvs;u) lxrxo tadomte ivs s  2umxmpny4ll n fvt sf 2ta( p;u0alt if3ild a2ua(mp ()tleomf oa1fatr u s;s)tetrim3nodlpte ivslt a2trurpot0oetnio3iatls2ran o;(0 rtomr3iydfpDeaueolt) 2toirpnudllenmfesa()artax oot0tptoiociydlaDua(vp u4tltoxrcoo1faDeanei;( setrxo3ou1optelnetltfsDurx oot1tee ifeildfa rlnvo;t) lxoio3oydfpDeaivs;t0 2xmir iu1oltelicta() 2tmump;u1olxoifctysls2ra(msn() rtoir iodopDrlnvs;s  2tm(r nu4lm nmfctas  Dumumoot1opxomociad m2ran ont) leomo oa1opD au i s0 2uoxopno4am emncil()aruau  nt0alx  feilt mDrmnvon(4arxrioctotomte nvi;t)s2um(m3nydlmtnmicils  Dum( ont1ape mictlt a2ra(ms ()arxnxr iadfmDrlueo;() 2to(m ou4lmtnlnvi tf rumumpou4oetn ietldfm uluvs;u)artrio3iytopDeaieols)sruoxm oydamen ivsa(  2rmx ont1alt mieild m eaumo;()teenmo oadfpDe ivi;t trxoxrpoy1ol  mieiatf 2raurpnt0opt  fcilt aDrmump t0alerxfcoadfp eanei ()setrxm iu4al emfcsls)srraxmo;u4alxomieiydfm2ulnmo (0 etnxrcto1faDe nvi;t0setmxmpoudoltn iei tfaDtmx poo1opxn ieiasls elnvo;u0artrxr3ootfat lnvo;()t2uoim3oo1lpen ivtls s2taump;o0tpxniiciytlm2uluvsn() exnxfctadoptelivs t0 2tmiopiodolt livt sf Draumoot1oet  ietlsla2umu snt)trermo3io1optrauvi;s0 2tmim oodapen ivi (f 2raur no1tee moetys m el( p;(0aexoxo iytlmtelneo s0sexriopnudom nmictlsfsDrrurpnu4opx ifeiatfm2raums;u0 lxnxo iadom eai s ()s2xoirpnu4lm n icsl()arrr(rpnu1oetnio3tltls rmu s u)texrmr tadfmDeai ilt)t2uoxo3iu1lmt lfvils) 2tm(moot1teeoio3iasls eaums;u) rxnio ia1lat auvols)trurxm3iy1lltn icsl(fsDrrumoou4oee mfctltla2elu s;u)tetoxo3iotlaD  ivs;t)s2xoxr3iy4am  lieta() rrmu pnu0tet moeildlm el(monu)aexnxr ootlpte u i t0t2umxr3oodope  fet (  2um(moot1tpeoiictaslaDumnmo t4tltnxfcio1fateaiei;(0t2trio iudamtemfci t)srtaxmoou1optomoetaslm eanvs;u4aexomfcoydomDelies;()seumxr3nu1optn ncilsfs2umxr ou0aleomf3iltfm rlnvo;() eenxf3ta1fp elivi (0 rxoxm iy4alt lnvs t)s2rr(rpot1tpxn fciltfaDemnms t)aleoiocty1lp r uvo;t  rxoim3nudolenmieilt s2ururpoo4apx moetlt s2ea(mo t) eermf3todfaDeau s t)s2uo(o iudomt lfcias)srum(m oo0aeto ictytla2rmuvp;(4alxomf3iotfa ranvo;t)srxmimpiodoltelics tfa2tau oou4olxnmiciaslm2ulnmo ()alxnio3to1lp   ies t0setoir3oo1lmenlict s aDumxm ;u1alt ioeiysfm2ul(mp u4 rerirciodfm r ieo (0s2xrxo no1lpenlfcsl(f rraum oo1oexoiictydfaDumu pnt)texnif3ty1omDeaneols texm(o3io1lpe  ncsat  Draumont4aex miciaslsDuan p;() renxocta1opDraivi s truo(o oo1ameelfcta( aDua(r nu1alx ifetyt a rmnvonu)altrmo3iatfpt  ueilt)srurim3iydlm n icias)s2rm( ooo0opeoiietydlaDel(ms t4 etrxrctatoateli s;s0srumim io4opee iet s) 2umumono0aet ifeildla rmuvp u0 eeomo3oa1opD aneo s  euo(r3oydape miciat) 2uaurono1teen oetlsfaDran snu4alxomr oydomDrli s;(0t2xrim oydalt  nvsat) Drax  oo1tex mo3iytfsDrauvs;t)aetnxf3iydlaDeluvs (0s2xm(o nu1al nlfetlt  rrruroot0optn fciadfs2rl(msn(0 rtnxr3iydfm rlueolt)tetrxr3oo4ame  ietls) 2tmu  ot1aeto feiaslsDumnmon(0aetnmociatlmtraieo ()texmxo nodop nlictlsf rrrx poo0aexnmi3iad aDuan p u) rermrctodlmDr i i;s0s2xr(opiu4lpe livtas  2taxmpot1alenmo3iadlm2eluvo;()tlenir todoa elneo s)srumxo3io1omtnlicsas)s2tax  ;o1aeen f3tytlaDrluvont4 ltrio oa1om elnes (0 ruoimpio4apte feia()s2rrumo;t1oet ifeias a2rau s t0 lenifcia1oaD lneol()s2uo(rpio4lptn ietlsf rrax o;o0tltomictysfaDeluvont4texoir3oadoatr nes t0 2to(o3iu4altnlicias)s2trxm ;u0oltnmocildlsDul(ms u4tlenxocoadfpDelnvol(0 rur(m3iu1lmt mfvta()arrr(rp;o4tpenif3tltla uanmp (4aexnmr iytlmDrai i ( tetrim3oy4ope  icilt arrrumoot0alenifciadlm ranvs;u4aexrioctadoaDr neol()trxr(r io1lptnmfvil( aDua(mpno1tet iictadla2rm( pnu0artrif iytoatelivol()t2xoxm nodlltelnvt t aDumx o;u4tetnio3iydla2umuvo;t4aexomf iydfaD  u i t0tetrxrpno1omt lfcilsfa2taxmpnu0tpxnioeiyd aDemu s;u)trerir3todomt ai s t0 rxoxm3io4alen ivtas s2urxroou4optn ieiytlsDem( p;u0artoio ootoaD li s () 2tr(o iy1al   fei sf 2trxm ;u0openii3iat aDuan s u)aleoir3iydom   u s (0 rto(m iy1lmt lnvtas)sDumxmoot4tlenmfeild a2umn s;()artrmfcootfaDelu s;(  2umio3nudalenmnvi s)s2ur(rp;t1opeomo3tlsla umnmpn() exoxo ia1fp eln slt  eumxopiudalee icta( artm(rooo0teeoio3ilsls um( o;()areoxf3io1lm r u i;t)setr(o3iy4amenlictl(fs2rrxro;t1tetnif3tyslaDraums u4 rtoxrcoytlm eaivsl(0texrim nu4olt  fcias  Drr(roou0tpx mf3tlsfm rm(mp t0arxrircoydopDe u slt)s2xmim3iudole mieil()arrrum nt1aptnifctadfa ra( o u4aexomfciadoatrlnvo;t0srxmxr io4omenmfetl()s2taxrp;u1tlt ii3tlsfmDulnvs;t4tlxnmo iatfmtelu ils0s2umim ou4lleeliesls  Dumum ;t4tlxomoeiyt m umu o (4aleomo oytoa elieo;t teurxrpnu1aptn iesas)srtm(rono0alxo fctyt m2emumsnt0aeeoxrctodfm  luei;t0 2urxm iu4lleemiei sfs2rrxm nu1tptn ieild a rm(vs u0altnir iadomD  uvs s)sexo(m nu4ap   nct tf 2tmurp;t0tle  oeils a2rlnvont4tlxrmf3iadlmD aneol(0 exmxo io4llt miesltf Dum(m nu0texnmociysla2umuvonu4trermo iadlpDrli i s)teum(m io4ol nliei ( arta(m ;u4aeenmoeiydlm rl(vo;()tetrioctytlpD luvi t) exm(m ou4lle lnvt sfsDumurp;u0oeeomfciatfa2eanvo t0tltnmr3totlmt luvo;t0sexrxm ny4altnmietat)sruru pnu1tpt mo3tyslm rl(vs u4 rxnxo oa1fp rlu i t)setm(m3oudol elfvia( srtm(m oo4tpt  ietltls ua(mp () rxnmocoytoat an s;(0 etrxm oodalee iet s  rraxmpnt1tetnii3iyd a emumo;(0altoircto1om e u sls0 exmxopiy1lpen feia(fs2ua(mp;o4oleo feiysla eaumon(0tltnxf3iadomDrlnvi;( s2uoxmpnu1am  mictlt srrrumo;u4optnioctlsfm2emums u)tetrxf3oatfaD  u ols)t2uoirpoo1lmtelnei ()a2uru o;u4apx  o3iltfsDel(vp;t0tetriocootoa e nvo;t0trtrio iu1lleemnct s  2umuro;t1tle moeils sDumnmo;u0artomocoo1omt  n sl(0srum(rpnudlm  mncias) rrm(rpno4opt mictlslm2ea(vpn()tlermo oo1omD aivol( s2xo(m3no4om elfcs (  2rr( pno4tlenif3tydfsDrl(msnu4 exoxocio1lm e nvsl( t2xoimpio1ameemfei s sDuaurpnu0olx  fciatfmDranmpnt)aeermoctytomDe neolt)s2urxr3oydlmte fcil(  rurxroou1tptnii3tyslmDelnmp t4tltoxoctatoatr n i;t)s2tr(m no1lpeelfci ()sDtax o;u1aexnioeilslm2em( pnt4 lxoxfcio1lmtean ilt0 rxo(rpnodale livtlt aDtm( oot0oex  octls a2eanms;t0aetnxocoa1la e uvol( s2xmxr3io1lle mfvtas aruaxmoou0oex io3iasfm ranvo (4 lxrxo3oadfm   n s;s0 etmir iodllen nvtat)s2rrxmont4oleoii3tadfaDulu p;u0alxnmr3tatfpDrlnvsl( t2xm(m iu4alt  fvt t  2tr(m ;t0aeen iciys a elump;u0 rtnmfctadfa eln i t0srxr(r oy4ole  icslt)s2uaurpoo1tpxnioeiad m uln o;(0arenir3oa1lpDeaues;t) euoim3oy1ap nmics (  Drrx ooo0tlx  ieiadfs rm(vo;t) etnmfcio1faD aueo t teumir iodal n nvils)artrxmpoo0optoioetldlsDrmn onu0 eenmf ty1oaDe u i;(0s2xmxm nydlp  miviat)sDrmum no1oeen ietld sDrm( o (0 etrio ta1omt  i il(0seumxm nu1aptn nvils arurx  nu1opx  ociatfm2ul(vont4aeermf3oydlp eauvo;( srumio3nudomenmfvi (f Dua(ronu1olt mfcild sDuanmo;() rermrcoatla ranvo;( trtmxm iy1aleemfvtl( aruaum ;u4oetoifeiys aDelnmont0texrircoa1lm eaiesls0 2xr(o3io1omtnlfctltfa2urx o;t0aexn ietas a2rl(msn(0arxoir3oodlm rlnvols)trtm(mpno4lm nlfesat)srua(mpnu1opxoio3iadlsDel(mo t0 ltnxfctatoaD aieo s) 2ur(o iydlmee fes (faDraum nt1alxoii3iytlm um(vsnu)treoxf oydfpDraivsls srxrxm iudap nlnes () 2tru  ;t4aeeo ieiatfaDraump;(0 ltnmf oa1om elnvs s)setoir nodam emivs sf 2rmuro;u4tpx  i3tlt aDemn s (4trtrmociytlpD ln sls setoxmpno4apt  fet ()aDumxr nt1altniocild sDrlnmo u0aexoio tytlpt aneo;s0 2xo(r3nydaltelfvil()a2rmumpou1teeoifeiltfs2uanmsn(4aetoxr3oo1fmt liesls0s2tmxr nu1olt  fciatfarurxmp;u0teto ietltfsDul(mp;()treoir3todfaDelivs;t setm(opny4lp nlfeilt)arumumpnt0ope iociltlaDelnvs u) rxomociodlpteaivs s sruo(r3iy1lm e fvs t  Drmxr ;u0altoii3ild a uan p;(4 ltnxr3oo1om   uei;t trurio3nudlptelnei (fs2urxm ou4apxomf3tltla2ul(vp u) lxnirciy1lpDeaivil(0teuoim3iu1lpe mfvtas)srtr(mp;o4tlenifciydlmDeauvp;u) lenxrctotlptelu i;t0trtoio3iy4al n nctat) 2rr(m ;u0apeo ieild s2em(mo t0aexnxfciytlmDelnvo t0trxrxr3nydaltemnciasf rrr(mp;t1tlto icilt s umu s ()alxnmocoo1op   n s;( teumim iudlp n nciasfa2rrxmoou4altn f3tlsfsDelnmon(0teeoiociadla rau olt)tetmxr iydll e ictas sDrm(r ;u0alxomo3iad a2emuvsnu0 rtoif3oy1om elneilt sruoxo3oo4opt  fesat) 2trxrooo0tlxo oeilsla2rmumonu4tetomociotlpt luvolt0s2umirpny4ap e fet tfs2ta(mp;u0aet  ieias a ra( o t4trxoir3iatopt anvils srxmirpoydome lnvi sf Drrur nt4open ocildfaDea(vpnu) ltnirciatlaDeau s ()trxr(mpou4al nmfcslsfarum( poo1apeo fetytfaDrmu s;(4tleoircto1oaDelieo;t  2uo(rpno1ll emicias  Dtaxmo;u0teeo i3tltfs eauvsnt0tlenxr3iatfm e i o;( trtoxr nydamen nctl() 2trxmp;t1apto f3iadlm eaums;(4tleoifctotop rauvs s  2toim io4om  mnci sf rta(m oo4openif3tysls2ranms;() lerir3tatlateln slt0setoir3oo1ale lfvs s aDrr(mp;t1ale  o3iadls2ranms;t) eermrcoa1lp r uvi;s0 rxoxr3iu4omt mivtlsfsDra(  ot1oexnifeiyslsDran o t0 lxnmo3oodlmDr i s;(0srxrxm iydole lfci () 2rrx  ;o4tpxoioetlsla2rauvont) reniocoatlptelu sl(0t2uriopnodapeelfviat)srtaxro;u0open feilsfsDuau ont0artomf3oadfm eau s;s0sruoxo3iy4lp e nesa( a2ta(mo;u1ale  i3iyd mDeau snu4tlxrircoadoa  lieo;s sexr(m ou1opt  fviat aDtmx ooo4alxn ietatls2elnvs;t4tleoxr todomt lu sls seurimpou4alen nvias)a2rm( pot1tlx iieiltfa rlu p t4trermr iotoaD aues t0t2umirpnu1am n nvs (fartmxmpot1optomocils m2ran pnt)arermfctodfptraiesl()t2xrxmpiu1amen fvs s a2tm(ront4alxomfciatfm umn o t0tetrirciodop r nvs t0 eumxr3iudllte iei ( artm(  no4tlto f3tydlm em(mp;t)alxrxf ta1omtrlieol( teuoxo3iudaleelncta(fa2um(rpou4alx if3iasfmDrlnmsnt4trxnxf oytoa eai olt)trxmxr3iu4llte ieta()aDurx pno1tpen oetaslmDemu o;t4tleoif3iadomDr n ilt)seumir oo1amtelici s artr( pnu4tlen fciadfmDulump t0altrxrcia1fmte ivo t)s2xmxo no1olte fcs t  2umu  ou4apto i3ils m rmumont)tetnxr3ia1lp e nvo s0trurirpnu1ol  lfeslt)s2raxront1oeeomfciyslm el(ms;()areomr3oodfa eln s;()setr(m nu4olte fetasf 2ra(r ;o0aptnifciyd a2ulnmo u0 rxrmf3iytfm rli i;t  rxr(r3nydaptnmivs s)aDumu  ot1olxnioeiat s emums;(0 exoircoy1fpteauvi;t)t2urim io1lme  ieilt a2urxm ;t4ole mfetatfm2ulums t4aeeoifcoy1lmDe iei;s)s2xrxm ou1amee fetlsfs2tmxm no1alenmfciys s2elnvo;t0 reoifcia1lp  aneil(0 2to(mpio1lp  mfeias a2trxr ;o4aexoiietltfm2um(vs;(4 eeomr oodlaDe n s;s setoio3iodlmenlicsa(fa2umxm nt0tpxomieilslm2eaumo;(4areoir tadlpteli s;(0s2um(r3iodlmt livi () 2taxm nt4opxnmoeias m emn s;() leoio totfpt auesl()srtr(o3iu4ameelnvi tfartmxrp;u0alt mfcildlsDum(msnu) rxnxrctadlp rauei;t) 2xo(r3iudam  mies () Drru ont1oee if3ias a el(msnt)texoircootoaDean slt  2umirpoy4lmtnlfvs s) 2ur( ooo1olt  ietltla emuvo t)tlermocio1lp  li ilt)t2uoim3iu1oltn nctls aDra( onu4apeomf3ilsfm2ranmo;()texnmf3oodfm r nei;s)setmxo3oydlpte fci ( sDta(ro;u4tlx ifeiasfsDemu p t4 lxrxf3tytop r nei t tetmim3no4lpenmnesas s2ua(r ot0tle  fciltlsDrmnmsnt)trxnmfcoytlat ln ilt0tetr(m oudlm n nvsat) Duax pno0tle  f3tysfa2ranvpnu)aetomo to1lmDr u il(0tetrxmpoy4op   net s)srum( o;o1oetn fctytfs2emums;t4aetnmo3oydfpD au i t0s2trxr3nu4amtemict s s2ur( p;u1aleo fcias a2uanmp (0 lxomo3oadomt anvilt0 eto(opiu1lm n nctl( aDtru p;t4tetoiieilsfm rlnmo t) eeomo ia1fpDrlueilt0trumxmpoy4lptelnvsa() Dta(m ;u0teto fciytlm2ua(msnu4aexoxo3oo1fmDe i s () exmim3nydapenmici ()s2uau  ou1opxnmoctys s2rm(vo u) etoxr ty1om rlivo t0 2uoir3ou1ll nmicta(faDurx onu0ale mo3ias aDua( snt0arermfctydoptrau o;t)trxoio iy4op nmfvi s  rum(mo;u0tpxomi3tld s ea(mon(4tlxomo ty1lm e n sl(0s2xoxopoydlpenlict s)artr( pnu0tlenmo3tltfm2emu p;u4trxnif iodopt  i sl()srur(rpoo4am emivtls)a2trumoou1oleoifctys a2rlu p u) etnmfcto1fmD livs;( s2xr(o3ou4ap e fcsas  rtr( pot0tpe mo3iysfa rl(vp;()trtoir ia1lpD  ivs;()t2trir oydal  lfctat)sDrmum ot0olxn iciaslm uln p;u4tetomrciatfmDeai s t0 rxm(mpiodlpen ics s aDtrxm ;o0opeoio3iydlm2uan pnu4tlerxr3oy1oatr ivo;() exmim iy1lmenmfesat s2ra(r ou4opt mociltfa emumo t0trtrxrciytlate n s;(0 rurxo iu1oleemfvtltf Dumxmoou1olxo icilsfsDra(mp;(0 lxomr3to1fpteai s;() 2tmimpoo1optelfes t aruaum nu1tleoif3iat a el(mo u4 ltrio oytfmt anei s  2xrxm3iy1ap   fcslsf Drrur no1aetomictas m ra(mp;(0alxomr3iatlaDrli ils)trto(r iodoltemnvtl(fsDua(  nu4aptniictydfm emu o;t4altnmo tatlatrauvilt0 etr(r ou4olenlnci t a2rmuroou4opxnmf3ildfmDumu p;t)aexoxo3iy1la eln i s)t2toxm3nu1lmtnlictlsf rrrx onu4oet  ociysls2ulums (4arermr iytop  livs;s0trxmir3nu4openlneias)arra(rpou0alen i3iadfs umump;t0 exrmrcootlaDr ivslt0trxo(opiodom   nvtat arrruronu4tltn ieiltfs ul( o;u0altrmfciodomtrauei ( trur(r iudol nmfcsl(fsDrr(rpnu0tlxomf3tldfm2eaumo;u)artnxocia1lp rlieo;s trtmio ou1aleelfesl( aDrr( pno1olt ioctlslm emums (0tlerxrciotla elnei;( tetr(m3io4ll nlfctls)arurxmp;u1openmfciydfm emuvpn(0 eenir iadlpD luvols0trto(m oudamee fes ( aDurx ooo4aeenmfetytfa2umnvo;u0arxnxociydfmDeauvslt s2toxr3ou4olte ieta( srur(  ot1optn oeiytfa emu o t)tleniocootlpteaivols teuoxm nu4lle miet (fs2ua(rooo4oexomociysfs elumsn()tleoxr iatoaD  u s;()setm(r3ny1amtemnes (f rrrxro;o1aee  fetlt s rm(mo (4trtoircoatfptraueo ()t2xo(o3nu1lpt licilsfs2uaum ;u0oexomociadla ulnmpnt)aexrir iy1lmtranvsl( t2umimpno4lpen fet tf rururo;o0optnifetadlsDumuvsnt)trxoio iytlp rli i s)trxmxm3oydll  lfvtlt aDtm(mpou0tlx  oeiltla eaums;u)aexrmo oo1lm  ln s;s t2toxr ou4ol e nvslt s2ua( poo0apxnmieilt s2ean pnt4 ltnxo tatlat ai o;s  rxrxo iodale  fvi sfartau onu0olxnio3ils s eln s;t) leoifciytfaD livs s seto(m3oodaltn iciasf Dtaxm ;u0tet mociydfmDul(mo;()trermr3oa1fpDrlu sl()truoim3iu4omenlnct t) rraxrpnu0tlenioeildfs2umuvs;t4tlxnmo oytfpDran sls)trto(r oy1alen fetl( a2urxm no0optn i3tydlaDeln p;t4aetnirctotfa elneols0sexo(o3oy4lm  mivs (  Drru  no1altnmo3iys sDem(vp t0alenio3todlm r nvilt teurxm3oy1ap  lfcsas a2rm( pot0texn feiat s2ra( o;() lenmrctydfat ai o;s truo(m iu1lmenlnvta(fsrrr(m ;u1oeenmfctydfm umn onu4tltomrctytlmtrluvo;()seuo(o3oudoleelfvtl(  rrrxmp;t0oexniictadlsDrl(msnu)tlerxf ootfptelivo;s texrxrpnu4optn fctasfarur(  ;u1aetnmictydfm rm( on(4aeermr tadomDe i s;(0s2tmxo3oo1alen nvilt)artmxm no1oex moetlsls rlnvp;u4alxrmf tydlmtrlnvsls srurxo nydolt lfeil(fartru  oo4opt ifctysla umuvp u4teermocoodlatrlies t) 2uoimpoudopt lfcslt aruaur no0oleoii3iltfaDeaums (0aexnif oo1oat  ivi;s  etrimpou1ap n ivil( aDurxr ou0aptoii3tasfsDeaump;t0aetoxf oo1fp ranei;s s2uoxr3nodlmtelfcsls)s2umumpno4optn feiyd s emnvonu0areoif3iotfpDe i o t) ruoxo no4lpt liet s) Duru  ot4tetn ieiytla2rmumo (4 lxoxo3oatlpDelivolt) 2xr(r no1lp   ivsasf rum(mono1ape  i3iydla emn p;u)tltnir to1lmte ies s0truoim3oo4ole  ivil(  rurxrooo0optnioetadfsDulnvs;t)aetrmf todlmtrluvo s0srxrxrpiy1ol nmivsl() Drrxmo;u4tlenmoetad m ulu s;u)texrmf iy1lpD lneo t)t2xoimpnu1aleelies s artau onu0texn oeilslsDul(mo (4treomr todla elnvs () etr(o ou1lmt mies ()arumx ooo4oeen o3ilsfs2um(vo (0alermociytomtrlivolt  2to(mpno1ol emfes ( aDtaxrpno1tlenmictyslm uluvp;t) rxomf oa1op e ues (0 2xr(rpoy4llee ies (  Drmxmp;u1aet io3iysfa2rmu sn(4aexoif tatfmDrlnei;()trxo(o3nudopte iesls  Dtmx p;o1teeoioetydfsDrlu s;t) lxrmrctydfpDraneilt0tetoxrpoo4olen fei ( sDum( onu1olenio3tys sDum(vo;u) etnxrcoydfpD  neil() 2xo(rpoudlp   fvsa()aDta( ont0olxnmi3iltfs2ranmsn()aleomo ootfp ean il() 2toxr iu4al  livs s  Dtaxr nt0oexn oetydls2ul( p;(0 lxnifciodfmt livs s0srxo(o3oodalenmnvtlt sDta( o;o0apxnio3ilt s ul( snt0tlerio3oydomDrluvslt0s2trxm oo4ope mivtasfsDtm(m ;t4opxn feilt aDemu o () rerioctadfm  au ilt0sruo(o no4amt mncia(  rtax pnt1aex io3tasla2um(mo ()alerif3ty1faD lues s)srtmim3oy4ol   feias  Dtauro;u0tpenmociatlm elu s;t) lerxr3oa1fpDrau o t)s2umio3no1lp   fcsls) rurumont1ape ii3ildfsDulnmon(4tetrmo tatlpD aivsls) rxrxm oodol n ivtl( srur( poo1olx  fciltlaDrm( o;u4teeoxf3iytfa e ivs s)srurxrpnu1lpe  ictl( sDtaxr oo1apxoifcildfs2rlnmp;(0alermoctadfa   nvsl( srto(rpnudope  net s) rum(r no1tetn i3iadlsDuluvonu0alxoif oa1la eauvil( srtoxm io4ome licsasfa2rrxroot4alt iietltla rauvo;(0 etnxf3oadoaD an il()t2toxrpno1amtn nvtltfaDum(rpno1ole  oetatla2el(vonu4aexniociydlmDrlu s;t srurirpnu4ll n fvi (faDuru  ;t1tetnmiciadfm2em(vonu0artrxfcootopDraivil(0 rtmxm oo1op  lfvsa() 2uaxmoot1tleo o3tasfa uln o;(0artrio3oadfm eai il(0 2toxrpnu4lm nlneilt  2umx  ou1tlen i3iat m2rmnms t)altomr iotlmD  nvs;()sexr(m no1lm n nctl()s2tr(rpou1apxn fciatfsDrlnmon(0 reomo3to1oa  livolt)t2tm(rpoudlltnmivtls)aDrr(r no4olto octytfm ul( p;u)aexnmr oodfa r nei;( setoxopoo4omt  ictatfa2uaxrono0tlxoif3ilslmDel( p;(4tltomf oo1opte ieols0 ruoio nu4ol  lnvsltfartaxmo;u4alxn fetlsfa2ra(mo u) rerir oo1opDrlieo s)s2uoxm3oy1op emfvi s) ruaurooo4apx mocild m2ran p;u0arxoirciotlaDraivilt)texr(opnu1lmeemivtas  rta(m ;u1oltnif3ild a2emump;t0altrmf3oatfaD  i i;t trxmxm iu1alen iviasfa2tmum nt0teenmieiydfmDelums () rtnir3tatoa ean s t)s2toxrpoy4lptn fesatfaDrau oou4alxo fciytlm uln s;u0arenmf3iy1optr ueils0truoio nu4om nmivs (faDurxm ;u4oet miciadla2emuvon(4 reomr3iatom e u o;t)t2urxm oo4ol nmfvsas)srtmumpnu4aexoioeiydfsDum(vs;(4trtoxr tatlm e nvil(0 rxrxmpiy1lle  ivs sfa2rax pou0apto fctatfaDum( s () rxnxrctodlate ueolt)t2um(m3iu1ale miciltfa2rr(m oo1tetomfeiysfaDua(mp;t) lxoif oo1oa eli s t)texmirpoo1ol nlnct tfs2rmu oou1tet mo3tls aDem(mp;()areoir3oytoa   ueils0t2tr(mpiydlp e fcsltfa2ur(  ;o0opxoifcild m2umnvsnt)aexoxr3oatlmtr iei;s0tetoio3ny1lpe  fvilt sDtrxr ;t0olxoifetasfs ea(msnt) exrircty1lmteli i s sexr(r3iydlp   fcia( s2rau  nu4oexnioctys sDelump;(4trtoxr3io1om   i ols0srxmir iy4lme  feilt  2trx oot0oeeomfciltfa2ulnvp;t0tlxomf3tatop eli i;s0texriopio1lm emncilsfs2taxr nt0aeenmocild mDrmu o;() lerir3iadopt  n ols0t2xo(r ny4amtnmivs t)a2trxmpou1altomoeild aDem( p;(4alxnxr3oatfa e u sl() rxmxo3ou4lpeelietlt) rtaump;o1apt  i3tld aDrm(vpnu0tetrxfcoo1fatrluvo;t srxrio iydlp   ncta(f Dtm(mooo4apt mieilslmDeanmp;t4aetriociy1om e ivi ( trtrim oudamtnmnviltfsDrau pou1openmieiytfs2em(vsnu4 rxomr3oo1latrlivils  exm(m3ny1lltemneil()srurxroot0tpxoioctld m emn o u0 rxrxf3tytlmtrau ilt0texrxmpio4amt  nvi t aDta(mo;t4tlen f3iltfaDrlu p;()aexoxfcoadopDelivs;t trtrxmpoo1optemfesl( sDrrx o;u4optoio3tls sDulnvs ()artomrcoy1lmD lnvo s texrxm oydap   fci s) 2rm(mp;u0opxn fctasfs2ulu p t0teeoio3oadoaDeln i;t) rum(m nu4apee ictl() rtrur ;t1tlenii3tatlm2rau s t4texoxf3oa1fa  anvi (0 eur(m3no4lme mfvsl(faDtaxm oo4oltoio3iaslm2um( o t4aetrioctadfmDr nesl()trur(o iudom   ncta() Dtmum ;u1ope  iciadfsDuln p t4 rtrmo totfp e neolt  rto(r oy1amtnmfcia(fs2raurpnt1tpenmictlt aDrmn ont0tlxrmoctydoaD li s;t)t2to(rpou4apenlivsls a2raumono0aee mi3iatfm2uluvp t) eenxo tadoa r nes;t srur(opiy1lp emiet t)sDrmxrono4apto ociat a ua(vont)aetnmr todlaDrlneolt0trxr(m3nodom   icilsfa2uru p;o4oexomfctldfaDrm(mo;u)tlenxoctotfateln o;(  rto(opiu1lpe liet sfa2rrurono0ape  octatfs2eauvo;()tlxoio3iodfat aieolt texm(opou1oleemivt t)aDurumpoo4oexnii3tlsfa2ran p u0arxnif totoat li o;( trumxo3ou1amtelnet t)sDtr(r oo4apxo f3tldls eanmp;(4 ltnxociadlaD  ieol()texmir nydoptn netl( a2rm(rpnt1oexo oetad a rmuvo;u4trenio3tadoat  u s;t)texmxmpoy4alt  iet s)arrax p;t4oeeomoctldfm rln o;(0arermf3tytfpDeluvs s)truoxr3oo1om n fcs s) 2raxmoou0alt mfciad aDrm(vp t0tetrmr3ootlmDelies t0 2xmxrpoydol e iei sfartau poo1tlx mietadfa raump;(0 rxoxrciatoatran s;( trxoxm oo1ol  miet s aDrm(mpno1teeomiciydls2eln o t)arenmrcoodlat  nvs;(0texr(m oo4op nmnvtasfs2ra(mooo0alx ifctldlm emuvpn(4 reoif ia1lpDraivsl( sexm(rpnu1apenmicilt  Draxm ;o1tlxnmfciasla eauvs t0aeenmrciy1fpDraies t s2urirpny4aptelnviat)aruau pno0apx  ieiysfa2umnmp t0aexrircto1lat au o t0 2xrir3ou4op  mnvta()a2ta(m nt1aet ifeiyt aDumu ont4alxoxr iatfm rau s;s  2toxm3iu4ameelfcslsf Dumx o;t4tpxniicilt m2ua(vp;t)trxrmr3iotfmtranei;()trum(opoy4lm n nvt (fa2rrx  ;u4optoioctat s umuvp t0arenxr iytoaDrluvs;( s2uo(r3ny1olen nctls  Duaur ou1alxoifciyd aDum(vo;t) rtoxf3totlaDelnvi () exmxm nodol nmfci sf 2tmu pnu0olxomiciad a umu p t4treoio3ia1lpD  u ol( tetr(o3nu4llte ncta()s2rm(ronu4alx  feiltlaDuanvont4treomf3tydlmt  ies t0sexmxo3nudlmt  feias s2trumpot1tlx iicilsfm rm( o u0aeeoif3oydlmDe nvilt trxm(o nu4lm  mncs ( a2ua(mo;u4alxomfeiyd s2emuvs;t0alxoxocoy1oa  an i;s)trtoxrpno4ol   fvi s  rta(mpot1olenioetasfs2uau p;(4tetnio todom eli sl(0 2um(rpou1ome lneiatf Dtru o;t0oexomo3iytfs2ua(ms;t)aleomo3oy1fat  ivo;( sexm(rpiy1lpte fvs t)sDrax o;u0oeeomieiyt m2elump;u0 etnxf oodom eaues;t0 exr(m ny1ape  ncsas) 2rru pou4aexo i3iat s2ua( o u0aexomo3tydla r n ilt seur(m no4opt lietatfsrrrx pno0olxn fciyt mDem(ms;u)trxoxr iodlmtelnvolt) 2xrxrpio1om elfei sfa2um(moou4aexn ictat aDra(mpnu0 ltnmfciatfm eli i;t)texmxrpoy4ale mfviasfartmx  ;t1olto iciat m2rauvpnt)tlxomr iydfp  auesls setoio iydape  fcta()s2rm(r ;u0tpx  fciasla rauvs (0trxnir3ta1faDelnei;( seuoio3oy1altn feta()sDtau pnu4tle  fciydfa2uaumo;t4 rxrmo to1fa  livilt  rxr(m oo4amtelnvils)aDtrumont0alxnmoeiaslmDulu o;t4texnxr3todlaDelnesls0 eumiopiy1oltelivslsfarrmxrp;u1aetnmfeiadfaDuanmsn(0texrxr ia1lm e uesl(0 ruriopoo4op   nci ( a2tmx ont0olxo o3iatfaDea(vo (4artnir3totfateaivi;t t2tr(mpny4al nlietas)aDuru oot4tlxo f3iytlm2ranvon(4trxrioctytfate uvi;(  rtmim3ou4ll  lfvta()s2raump;o1altomfctlt aDum(mpnt0trtnmo tatfp e n s s setrxo iy1openlnci () rururooo4tlxo oetytfs2rm( snu0altrir3io1lateau i t  exrir3iydlpenmfcs sf 2ta(  nt4altomictytla uauvpnt) ltrifcia1laDe ivs;t)texr(r nudol   iet (fa2umum no1oexoifciyd m elumo;t4aetnxociy1lpt luei;( seur(opiy4apt lfvia( a2ua(m ;t4aet ii3iat sDeauvonu0altrmf iy1lm  luesl(0s2toiopiy1lleemfvsltfaDraump;u1openmf3iydfmDuan o () eeoxfctatopte uei;t0seum(mpiy4ameelieta(fsrum(mp;u1aex mfciat aDemn o u)artnxo3io1lmt  i i;t  2ur(o3ny4olee nct tf Dra(m ou0aexo ieiyt aDum(msnu4 rxnmf iadfat lnvo (0 rxrimpnydllt livil(  Dtr(r nu4aeenii3iadfsDumn o;() ltnxocty1fptr n ils  rxrir3oo1ape lnci sf Dur(rpou0tex ifetas sDum(von(0tlxomrciodlm r uei t  exm(o3nydom  lnet sfs2rr(ronu1apeo fctysfs2ua( p;t0arxoxocio1lp  auei ( trtm(r ou4apenlncs sf 2ta(mooo0optnio3iltlm rmums;() eeoir3oatoa  an sl(  2xo(m nu4al emneilsfaDtr(rono1altomfciytfs2umn o (0 rtrxociydlmD aneo;()s2tr(r iu1lltnmncia(faDuax pnu4oee iietyd aDemu s;u0 rerxr3to1fa  aneo s srtrxmpno4ll  mivil() rra(rpnt0alxnii3ias m ulumo;(4trtnxrctadfatrlneils) rumim oudom emfesatfaDumxmo;o0teeomieiatls ra( s u4texoif iydop   iei;s)s2uo(mpoodolt  neilt  2tm( o;u0aeenmicias s2umuvs t4tetrir3iotlpDeli s ( teurxrpiudlm emneil( s2tm(ront0ape ioeiat a rmuvs (0aexomocty1latranei t s2urimpoy1lpte fci s) 2tr(monu4opx io3iys sDeanms (4trxoifciytfaDeluvslt0texoio no1ol emfciat srtmxmpnt4aptn fciadla2ulumsnu)aeerir3ootom rlivo;s trtmir iy4lm  liviasf rta(mpnu1teeoii3ildfa uaumpnu0aeeriocoo1oa e u o (0srurirpnydapte ivs tf 2tmu  no0texo ietys a2ua( s;t0 lxoif3ty1lp rli i;t0s2xm(rpoydop   fvi (fa2tmum ot1oex miciydlmDem(von(4artrifcoodlpDe nvi;t0seumim3ou1amtnmict t a2urxmo;t0olxomieiys mDrmn p t0altnmocootomDe iei;t) 2toim nudll n nei t)arumxrp;t0teeoifctys s2ua( pnt4trxrmf3iydoateluvi;(0trxoio3ny1om n ivtas s2ua(rp;o4tpxo i3iatlmDem( p t0areoxo iydlmD lneo ( trxr(rpoy1al   ics tfsrtr(r ;u4tlenmietls mDumumo t)aexnxrciodlp eln olt  etmimpny4lpe  iciasfsrumu  ;o4tpt ioetatls uluvo;u4 eerifciadlmtrlnvils0s2xmimpiy1al emnvi sf 2umuroot0tee  oeiltlm2rl( pnt4aetnio totopDr i ilt)srxmxmpiu4llee fci (  Duaxr no0tpt  i3iytlaDra(vs () rtrirciotlat aiei t  exoxr ny1opte fciasfsrraur oo4ope ioeiytfsDrm( s ()aexoxo3oo1fpD aieilt0srtmxm ny1lmen nct ()s2umum nu1ope  ieiytlmDrau o t4 lxoio iatfpDeln s s0t2xmxopoy4op nmfcsl(  rtmx  ot0oex  f3iatfs rm( s;()tlxrif tatlptrauei s)truoirpno4olte ictlt  Drau pot4tlenmictat m2uaumonu0 lxnxr3ia1omD lnvils)t2urxmpiy1ape lnvtlsf rtaumo;o0oltnmiciytlm2uanvs;u) leoxr oy1omteluvi (0 2trxr io4lpt micsasf 2umu  oo0aet  ociytfsDuluvp (4tlxrxo3to1fmDeaivol( setoxopoudaptnmnetls)aDra(  no1teenii3iltfsDrluvo;t4arxomr tadlp  livs;t0 2urxrpnu4llt lfviltfaDuaum no1aleoif3tyslaDua(mpnt4altrxo iodlaDrlu s t0s2xm(m oo1amee ivsl(fs2umump;u1tlen oeiasfsDelnmonu)aleoxr3oo1fp r ivs;t teurio nodomte fcta() Dumuronu0apt mf3ildla eaump;t4texnmo3tatfaDe i ol( texriopou1aptn fvsa( srrr(ro;t1tetnmfeiyt a2em( snt)alxrxf iotlmDeaivs s0srxrio3iu4lmt lieia()srra(rp;u0apx mf3tydfa ea( o (0 lenxo3to1faDe ieo;s0trtmio iu1lm  mfetl(farum(monu1tpx ii3iatlmDeaumonu)alxnxfcto1laDr neils)s2xmir3oydol e ncsltf Dta( pou1apeniicilslmDranvpnt0teenxo iadlm  lneo s)t2xoim3nodamtn nes (fs2trxm ;o0alxnio3tyt mDulnmo;(0 rtnio3ia1lp eau s s0 euoim3io1lp  mnvs tfs2tmxr ;o4tlto fctys s2ea(vo;(0tlxrmocoo1opD lies;t0s2toxopio4llenmfcias) rumur nu4tpen oetyd sDua(vsn()trtoxoctatfmD lu s;t trxr(o no4oleelfvtat arum(mpoo4opx  fetyt sDrmumo;t) etrxrcoa1fateaieo t0s2tmxo3oo1alte fciatfs2tr(rp;u4tlenio3tydlaDemu ont)tlerxfcta1om r nvslt t2urxmpoo4omeemfetatfarua(mp;t1apt  fcilsla2ul(vp u4aleoxo iydfatr n olt0s2uoxr nu1ol n feslsfaDumxrooo1tlxnif3tytfs ea( snu)artrio3oa1oa elu i;t t2uo(r oydlm elfeslt s2uax  ;o1apeo ociytlm2rauvs () lerif3oo1lm  luvi;()s2trimpiu1lmtn fciatfs2tau pot0tle  i3ildlaDrlnvsnt) rxrmrcoo1lpteai s (0trto(o ou4altnmnvia( arur(  ;o1oeeomo3ild aDelnvp u) rxoxo3tatomt aieilt0 exmirpoydale  fcsl( sDtm(mp;o4tex  oeiys aDuluvp;(4aetoxfctadfmDeaueo;s texrimpiu1ol  miviat)aDtmump;o0texnmo3iatlaDel(ms (0aexrmocty1fmD anvsl() rtmir io1om n fvil() 2taurpnu4openmieiltla umnvsn() reomfctatlmte nvs;s0sexmir no1ale  ics (  Dum(rooo4tleoifeiadla um(msnt0 lxrxo3oydfmte u sl(  exr(r3iu1ll nlnesls) 2raxr nt4oltnmi3iasfs2rl(ms;u4alxnxf3iadfpDeaueols)tetmir3no1am   feilt) Dumx  no4aexo f3ild sDrl(vs (0 lxnifctydfm e ivs;s)srxrxm3no4ole lies ( aDum(  ;u0aee  oeilt aDrmn s u4texrxfciatfmt  nvol()srxoxm3oodal nlncil( sDrmumono4teen o3ilsla2umn s t0aetrir oodlmDrlneo t0t2uoxopno1lm   fvt s)s2urxm ;o0olenifeildfm emuvo;u4 leoirciatopDrai i;(0teur(opiu1ale mnvtat) rrm(rono0tpen icils m elu p (4tlenxociydom eli s t0 exoxopou1ll emncs sf rta(r ;t1opx  fciatfa2rl(mo u4arxnir iytlateau i;t trtmxmpoy1lptnlietlsf 2tm(  ou4oexo i3tysfsDuluvo t) renxo3iodla ranvs;s0t2tr(r3iy1al   ieil(fs2uru oot4oex ii3iyt m rl( ont) etoxrcoadlmD  u o;t t2xmio ny4ll e ivsa()arurumont4tlxoif3tlsfsDumums (4 renircootfptraieo (0 exm(r oydaleelnct (fsDurum ot1alenmo3ils aDran p;u) etnircoydlaD aieo ( trur(mpnydope lfvi () rum(rooo0alt moctat s2elumonu4 exnxfctodopDeln s;(0seurio3iy4alee ncias  2tmu  oo1tle  feild m2eanvp;(0texrmrctydopDrluvi () 2xo(m3no4op n ici tf rrm(  ot4alt if3ilsfa2rlu o;u0 rxrxr3iatoa ranvi;t0 rtrxr iu4ap nlfcs t) rurur nt0teeo ietad s eanmsnu)tlxrmfciatoptrli o;t s2xrimpny1opt mieiatfs2tmump;u0oetomoctasfmDeanmp;t)trxrxf iatlaD lnei;() eto(o oy4oltemfeta() Drrumpoo1tpt if3tls a eln o;t0teenmf3to1lmtrauvils)setoxo3nu4apt lneil()aDum( p;t4optoifetytfm ulumsn()alxrxf ia1fa r uvolt)sexmxm3oo4lme mfvt t)srtrurpnt0aetnmf3ildlmDuln o;u0tlxnxr3iy1la eaivi;s)trxm(o no1lltelies ( sDrrxm nt0oetn fctldla2rmu p;u) rxomr oatlaDraieils0s2to(m3ny4lmteliviat aDtm(r ;t1oexomictldlmDeanmo (4treoif3ta1oa r ieslt  rumxm ny1amte fvtl(faDtr(  ot4aet io3iyt aDul(vpnu) lenxf iotlaDeai sl( seumimpoy4amtelietlt)a2rmuroot0olt mo3ildfs2rlu s;(0areomrcoo1oateln olt)t2trir nodlltnmneia( aDtrx ono0aeto oetyslm um( s;t0arxnmo3ootfaDean i;( s2xm(rpiodll e ietasfsrtaxmp;o1apenmiciltfs2raums (0tltnmf totfaD ai sls)trurxmpno1lleemfeta()sDrmum nt4oeen oetlt aDemnmp (0teerxfcootla elneo s)t2xrim3iu4al  lietat  Dtrx o;u1oleo o3tytlsDem(mp;(0 rtoio iydfmD aues s teumxo iy1ol  mfcslt  Dururo;o0alto fciasfa eaums u4tltnxf io1lpDr nvols) etoxr nu4olte neiat)aDrm(mpno4apxomiciltfs2rmuvs u) lxoio3oatfatelnvo t0t2uoir ou1om   ncil(  2uru p;t1tetomiciyt mDel(vs u4 lxrmocio1lptr nvsls0 etoxm3oydaltn ncia()sDtaxro;o0oexn i3iadfs2rmuvs t)alxoxo io1fa e nvil(0s2xmxmpiudlpe lnetat  rtr( ooo4opx ioeiyd mDraumo;u4artrxoctytfatrauvo ()s2umim io1opt  fvia() rtmur nt1aptn ociltlmDumnmp t0 eeomo tydfm eaneil(0setrim nu1omeelics (f 2ra( poo0apt  ieiydfm ul(vo (0texnxr3iy1fa eaiesls  rtoxm iodamenlicil(  Drmumo;t0apeo ietytfsDua(vo;(0 etrmfcty1fmtelivo;s)s2tm(o oo4altnlnesat  Dtm(  ;u4tpxomoetltfmDelu s;u4teenmoctotlatrln ols)setoxo ou1llenlfvs t  2umum ;o4texnmfctaslaDumumsnu4tltrif tydopt aiei (  etrxopoo4al emnesa(f Draurpou4aleomictasls2rlumo t4alxrir3oy1fp   u o;( s2toxm3iodamtn nvt s  rumu onu0teeoifciyslsDelumpnt)tlxoir to1lmte ues s s2toimpnodlme lnvtls)s2ra( pnu4olxn ieild mDul( onu4 rtrxrciydlaD an sls0srum(o3iydlp  mfvi ( aDtau o;t1alxoiicilsfm2umnvpnu4aeermr iydlmDeauvs;() rxrir ou4ape mncsa()a2tmum ;o0alxnmociysfs2rauvpnu)areoir oo1opDr nei;()srxo(mpoy1ole  ivslt)srrau  ot0texnifetadfaDeanvo;(4trerir3todopD aiei;t t2urim oo1optnlicslsfarrr(rpnt0oexnmicilsfa rmn snt) renio3oadfp  livolt0srumxrpiu1lptnmieils)a2raumpot4oet  o3ilt s2elu pnt4texoxr3to1fa   i s ( setrxm ny1apeelnvi t sDumurooo4tlx  fcilsls rmumsn(4trtrircia1lm raueil(  2xo(opoo1aptnmivsl( a2umxmonu1apeoifcias mDumnmo;t) leoxoctatfatrluei;( sruriopiu4omen feil(fsDrr(mpno0olxoioctld sDeanmp;u0aeenmo3to1op   uvil(0setr(o3oodapeelncs s) rtrumpoo1aptoioeildlmDem( o u4texoxf3io1oa eau o;t0 2umxm3nu1ame  ncsatf 2rr(rp;t1alt if3tatfm ulnvp;u0tltnxfcoa1op eai s;t) etr(o3io4aleelnct sfsrtmxr no0aex ioeiat sDrlnvo u4aetoifciytom eau ol(0setmxo3nydapt lfctat  2ta(mpoo4teen fcildfs2raumo;t) rxrmoctotoa elivi;s0 etm(mpio1lptnlfesat a2taxmo;t4olxnmf3tlslaDrlnvon()teermf3tydfa eai s;s t2um(rpnydopenlfesa( aDumu  ;u1opeoioeilslm ul( on(4areoif tydopD au ols)truoimpnudop elics t a2tmx  ou4opeo ociytlm2rauvo t4trtoxfcoatla   ieilt)teum(m3iydlpe lnet () ruru  oo4aeen ietatfmDrl(vo;t)teeoxo ia1fa eauvil(0seum(mpoy1lp nmfctat  rtmxmo;t4olxniictld aDraumpn(4 exnxfctydla rlneil(  etm(mpoo4om elfvt sfa2urx  ot4aexnmieiytfm em(mo;(4 rxrmo iy1fmDelivo;s0 2xoxr3oodalen nvs ( s2um(r ;o1tle  ietaslaDuau p;u)texrxf3tatoa e nei s0 2xmxr ny4al   fvs (fa2ra( onu4olx  f3tydla ul(vsn(0 etoir oydlpDrlu ol(  rur(m3iudap  lfciatfaDtaxrpnt1tpx micilslmDrluvp (4tetnmr oo1opD liei s0t2tr(rpoo1aptelnvtas aDrmump;t0olxn feiasls2ra(vo;(0trtomfciodlaDeaueolt0texo(m oo1ap e iei tfsDtaurpno4oex mfeilslsDemu s;t4 exrmr3ty1om r uvo;(0 2ur(o3ny1alen neiatf Duaum ou4apxoifciadfm ul(vonu4trerxf iy1fp r u s;s0srumxmpnudom   ncs ( s2rmur ou4ale ifciydfm2rm(ms u4trxrir iodlm  aivs s0teuoiopnu4alenlncil()aDtax  oo1tpen f3iysfa2ulnvsn(0tlermrctytoate neils)teuoio oy4ale licil()a2rr(rpot0tex ii3iltls2uanvon()aleoxr tytomteanvils)srtrxm3ou4op e iesa(faDra( poo0apx ioeiadfm ea( p ()tleoxfctatlm  li i ()truoio3oydam n fvtatfaDtax  ot0optniieildlmDuauvp;(0 ltrmf oodlmD an ils)s2um(r3oudlpe lfvia()arra(mpou4oetnmf3taslsDul(mon(4 eenmo to1omteluvo;(0s2xr(opoudlltn fct (fa2umu o;t1tpe iocildfaDem(mo;(0arenmfciydopDrlnvsl(0t2xrxopoudame mfcil(fsrrmx pot1tltoio3ildfa uln s;u4tlxrxrcta1omDeluvols  2xmiopnodlm nmnviat  2umxm nu0ape mietatla rmnvs t4tetnmocoa1omte uei s0 2xo(m3iodoptnlneias) Dtaxmonu0alx ifetasfa ranvp (0aleoio tadlpDeli i;t0setmxmpoudopeemfvs sf 2tau  nt1ole micilsfm uan on(4 rtoio3iatfptrlu o;(0 rtr(m3ny1alt mnct () 2rmx pnu0ape mf3ildfa2rl(vont0trxomf oodlm  ln i;(0 2uo(mpnu4ape lneilt) rrr(m nt4teeoiociys a el(ms;u0aetnio iydoaD lnvo s) etr(mpiu4op emnesa() 2urx  no4tpx  ictadfm ua(vs (0teerxr iotla rai i;s t2xoxm ou1lpee ncsas srrmx o;o0teeoiictydlaDumn s;()texrxo oytopDr nvo;t0s2toim iudlleelfctlt arrmumpoo4opt  ieiyslsDemump;t0teerxf to1fpt aivo (0teumxm3io4om emivilt aruaumont0altnifciyt mDelnms;()tltnxociadoateluvslt truoxr no4lpt lfes (  2uaxmpot0oee  o3iyd s uau onu) eerxfcoadfatr uesls0 2to(r iudol emnctatfa2ur(mpou0aeeomfciad mDran p;t)alxrmf3totoa eaies;s t2uo(rpiydop n nviltf rumxrpnt4apto o3iys a2elnvo u4 ltrmf3oodlateaiei t)t2um(m io1lp nmictlsf 2umx onu4tlen o3tat a eluvpnt4aexrmo oatfmDe uvi s0texmxopiodaleemfvtl(fsDrru  no0tlx  oetytfs uaumo;(4teenif todlaDe ues;()srto(opno4lptn nvilt  Dtau ono0optoifciaslsDeluvo t0arxoif3iydlpt  n i;()t2uriopiy4ameemnesl( srtmu oot1tetomfeiydla umu o;u4trtrxfciytfmDe u o (  exm(m no4olenlnvil(f rtau  ou4oetnif3iasla2um( p;u) rerio3iotlpD  n ols) 2to(r3oo1am elivtas)a2ra(rpoo4oetnmi3iltla2el(mp t4 rerir3oatla  livo;( srxoir3iy4oleemfvia( artmurpno0tetomoetld mDeanvo u4aexnmf todfm  an s s s2xmxrpiydlmeemfcils)a2ra( pnt0tle  octls mDulnvs u) exrxrcto1fm eanvi s srxoio3io4lleelicsatfsruaumpnu4apeoioeiat mDuau p;u0teeomo iodfmte u sls0s2uoxrpoo1lp e ivs t)aDrax o;u0opto octasls elnms;(0 eeomf3totlm  lieo t  exoxrpoydapen ietatfaDtrxm nt1oexnifeildlaDrlnvo;u)tetnio3todomt lieolt  rtm(rpiu1lp n feilt  Duauronu4tlxn iciasfsDemn snt0 exoiociytfp  liesls seto(o3iudal n nci () Dra(mp;o0tlt io3ilsfs2rm(msnu0 lxrio iodfmtr ies;t0trumimpnu1optemfviat) rururo;u0teenmfeias aDrlu p u0 rtoir tytlpte neol( t2xmxm3no1ameemncsltfsDuaxrooo1oex  fctlt mDrmnmp;(0tetomocta1optran il()trxmxm nodlltelies s)a2taxrpnt4ale  ieiltlmDem(vs;() lenmr tytfaDr nvols  rumxm3ou4opt mncsls)srtmxr no4apeo o3tydfm ra(vs t0tetoifcoy1om e i s ( texrio3nudomenlivs (fsDrru ono1alenmfetldls el(mpn(0arxrmr3iatoa  livilt0 rxrxo3oudapt  iesl(fsruaxm ;t1aex mfciytlaDrauvsn(4 lerif3iodoa elnes (0s2xmir ny4ol e ncs s sDtrurpno0tpxnmf3tys m rlnvp (0tltrif iatomtraivol(0 eto(r oy1alee fvslt)arrr(m nt4aeen ieilt sDel(vp;(0 eenxr3iydlaD  ueolt0 ruoxo iodameemnvi s) 2tr(mont4tlenmf3iadfaDrmnmo;t4arxomf3ty1oat anes;t0trxm(m io1alt  ictasf Drmu ont1ale  f3ildfsDrmnms;(4aeenxr tadfmtraueo s seto(mpio4om eliei ()a2rm( oot1tetn i3iyslm2rm( s (4tlxrif oadlpt  i sl()trumir io4ale  nctlt  rtm(  nu4oetnmicilslm ranvo;()aexoifcoo1omtr i ols)texr(opiy4om elfcs t)a2ra( onu4opx ii3iltlsDuln s t0aeenmfcoodlat aneolt0 rurxo3nu4optelietls)sDra(m nt1tlxn oeiysfm ranms;t0 rerxfcoytlpDe ieo ()texo(mpny1llte ivilt arrm(mpnt4opxnmictlsfa2ranmp t) rtomrciodfp eanvi;t)s2ur(opiydom e fet tf Durumpnt0oltnmictydlm2elnmon() eeomf ootom rlnes ()sexr(m ny4am  lfvil(fs2ta(  ot1tptnmoeiytfmDem(vs;u4aleomrcta1la r u s ()trxrirpiodlp nlicilt  Dtaurpou0tleomfctls a um(mp;(4aeerxo3ty1om  li s t0trtoxr oydamenlfvi s) Dumur oo0tpen fetldfa rau o t)alxrxr3to1omtrln i s)s2xm(m io4op n neias aDtrxrpoo1olx  fciysfmDrm(von(4 leoxf3ty1fate neo t0t2trxo iydamt mfvilt  Dumumono4oetomi3iltlm2elu o ()arenxf ootfp   ieslt) 2toxr3ou1apt lncsat)a2urxm ;u0apxn i3tldfm el(mo;t4arxnxocoadlptraivs t0 rum(r oy1lp   nctl(f Duaum ;o1optoifciasfaDraumo;(4tetomocoodfat li il(0seuoio3no4lm e fcia()sDuru poo0ole  ieiytlaDumnvo;(4altnxr iodla rluvi;(0seuriopnydll e fci s a2urumpot0tpxomoetlsla el( p;()arxoif3iodfp rlnvi;s0s2tr(r3iy4omeemfetlt)srumx p;t0opxo oeiasfa elnvsnt4trxoiocoydlmteln s s0seurir3iy4ll nmfviatfs2rau p;t1oetnmiciltlm2ra(msn(4 exomf3ta1lm elivo;s0teumim3no1lleemfcia()a2tmxm nu1oleo icilsfaDua(ms;(0 exrio3iodfp rlneo (0srumim3oo4aleelivil(  rurx p;t4oltoio3iydfmDelump;(4treomrctydop eaivo;t)srumxmpny4om e ivs tfaDuaxm ou4olxo fctadlmDrmnmp;u0alxrxfctotoat lues t s2uoxr iy4olen nvsatfarurur ;o4aetnmfetlsfs2rauvo (4 etnif oodomt  u o;s0srtm(o nodapt mncilt aDur(mpou4tetomi3ildfa elu o t0aexrxf oytla e uei;t0t2uoir ou4ll  mneilt) Dra(r ou0aleoii3iyslsDel(vonu4tlxoir3tytoat  i ils)srumir nodlleemfeil(  2umuroot1tpt if3tydlsDul(monu4trtrmfcoadlm  aueil()trxo(o3ou4lp   ies t  rumur no4tee ifeiys m rm( o t0alxoxociy1fatrlivsl(  etm(o3iy1oleelncsltfa2ua(mp;o0oltn i3iatfa2ua(mp (0 eerif iotfaDraueo (0setoiopiudlle mncsltfaDtmxm ot0tpt mfciydfsDraumpnt4arxoxf3oa1lpD aneols0srtoxopoodaltnlfeiat a2tm( p;t1oltn fetyslsDea( p (0alermo iy1lmt  ivol() exrxr3iu4omeelici tfa2rmxroot4aleoif3iadfs rlnmp (4 eermo3oatla e ueol()srto(m3iodalt mfvta(fartr(monu0alenif3tad m ra(vo () ltrio totoaDrauvils) exmxm3iu4al elnvt (  2taxm ot0opxnioeiltfm uan o t)texoiocoodop   n s;( srxr(r no4lmt lietl(  2trumonu0tleo fetldlm2rl(mpnt) rxrifcoo1fa   nesl(  2xr(r ou1ap nlivs sf rtau p;o0aeeoifcildfm rauvsnt) rerxr io1fptran i t0 2ur(o nu1ll n nviat)srtrurp;t4tlxoiiciyt sDem(vo t0tetrxo3to1opDrauvslt0s2xr(r iu1llen nvt () ruauro;u1opxnmi3ilt a2rmn o u0aeenmr3totfp  li s;()seuoxo3ou1ol e nvia(faDra(ro;u0tpxnii3iaslaDrmu o;(0tetoir3iytlm raies;s)s2xrir no4alen icias)s2tmur ;o0aptn i3iyt s2rmuvo;(0 exnxfctatla r neolt0 2umxrpiy1oltnmfcil(  rurum ;u4olxo fetldfa ua(mp;t4altomo oodfp   uvols) exmxopiy1lp   fcsat s2rm(rono0olenmo3tltlaDea(mo u)trtoio ty1lmDeaneo ( t2uoxr iu4lmen nesa(faDrmurpno1alx mfeilt s2uan onu4 rerircoy1fat  i s (0s2toxrpnu1lle lfvi s)srta( p;t1alx mi3ilslm emuvonu4 lxnmocootoate i s ()teuo(r nodalenmicsl()a2trxrp;o1tpe ii3iydfa2elnmo u0aleoir3iadlm  lieo;( t2to(o3oudlleemietas s2taum ou0tpenio3ilsfa umnvs t4arenxr oo1oaD an s (  exrxrpiydomenlicslt)sDra(mo;t0apt ifeiyslm2elu s u4texnif3io1omtran i ()t2um(opiu1llte ncils  rrr(mpnt1apeomi3iadfs eau p;() lerir3oodfpt liei t)s2xoxopiodoptemfvs ()aDua(r nu1ole if3tydla rmnmsnt4 rtnxf3oytlmt liei;s)setm(o3iy4ole  ncils  rtrxm ;o4oltnmo3ilsla2umuvs;(4alenmo3ty1latrlieo s0teumxr3iu1lptnmfet sfaDumumoot1oexn o3ils a2umump u0trtnir3oatlpDr neo;()s2urir no1ape mneslt  rrmxrpno0altn feiydlmDelumpnt0trxrmrctatlpD an ol() exrxmpno1olt mnciatf rtaumpou1apxn oeias m ranvpnu)altrmrctodfaDr uvs;t)s2ur(m3iy1op nmnctl()aDrax  nu1tpe iiciyslm2rln p u0tlxomfciotop ranvi t0 rumir ny4amen fvi tfs2tmx ono4optn oeiltls2emuvon(0 eenxfcoatfm elnvil( s2tr(r3oy1lm nlfcs t arrm(  ;t0tetoii3iysfsDumu o u0 rxnmrctatla ean sls) 2toxr io4op emfet (fsrrrumo;u0tex io3ildls el(vsnt0 rtoir oodlm ran ol(0 2xr(o3nudllen nvtas)aDurxrp;u1tle if3ild a2elu p u4aexrir iotomD an i t s2umxm3oydapee nct sfsDraur ;u0oetoif3tlslsDuan o;t0 exoxo3ia1lmD aieol()trtrxo iy4om nlivsl(  rrmxrpnt0oeeomfetat aDrln pnu4aeenmrcoytlm  au s t truo(r ou4om  mfvilt srtaxm ;o4tpenmieild s2ea(mpnu4 ltnxf tytopDrlneolt0trtoxo3nu1al emfct () rrmxrpno0aeen o3tytfm rau on() rxomf oatfpDeauvs s t2trim3ny1om n ics t)aDtmump;t4tptn oeiasfaDel(ms;u)alxomf3iy1fpt  uvs;s0texoirpiy1lmt  nes t) Dua(r ot4aex mfeilslm rmn o;t)arerir3ty1lm rlivo;t0 2uo(o3nu4altn ivtas  2rmx p;o1opxo o3ilslm2uau p u0 eerxf3tatlm elueo s0t2to(o iudapenmnvtatf Dumxrpno1aeenmictys mDeanms () ltnmocto1fpDeaiei () 2urxo ny1ol nlnci ()sDtrxro;o1alx  ociat aDrm( p;t4trtnmo oy1lp ranei;(0 2uoxr3nudalee fcia(f rum(mo;t4oeto fctatla2eauvo;t)aexomociodfm r n i (0 etmim iy1op emfcilt aDrmu p;u4opeomoeiltfm2uau s;u0 etnxr tydla eln ilt)srurxo iu1open iei t aDrmumpnu4tex  fcilsfa el( pn(4 rxoxo to1fmD ai o;(0 rtr(mpiydomenlfctlt a2tmxmp;t1tet  iciatlm ra(mont)aexnxf3oadfp elivs s)sexo(m3iy4alt  fetl()aDur(monu0altnioctyt sDrmnvon(0 lxoxf3iydlpt luvo t tetmio oy4oleelnciasfsrrr(m oo1olt moetytla eaumo;(0trxomf3iodfm   iei s)s2trimpou1lmt lnvilt srurxr ou0oexomociltla eauvont0 exrir oy1fmtrauvs t0t2urxm nudopt lictl( s2rmxrpnu1aleomi3tldlmDrln s u)teerircio1op  aues;t srxo(r iu1lpe  fvs ()s2umu ono4optoifeiatlaDranvp t0 etomocta1omt  uvo t t2xmxm io1opte feiatfsDrmuro;o4tpxoioeiat m2emnvsn(4altoxr3ia1la e ues t setrir3iudlmen ivt sf Drm(mp;o0opt  i3iatlmDranms t)alenmr ta1om r ivi;() 2tmimpoy4ape lfcs s a2rmuro;u4oltomfeilsla2umums;u)alenif3iadomDeluvi s0t2xo(m ou1apenmici sfaDra(rpnt4aee  i3iydlm rm(vsn(0 etoifcio1lm   n slt0 rtrxmpou1al e ivias a2uax p;o1teeoii3tltfm rmums (0 ltrmocoadlm r n s;t) euoxm3nodap nlfvs s  Duau  oo0aleomociasfs2ra(vpn(4 etrioctotomtelnei t)s2tm(rpno1al e ict ()aDtr(rpnt1tpeo ocildfs ra(ms t4alxoxf oytoatrluvi s s2to(mpou1lm nlieias arrmxmonu4tlto i3iltfa2ran snu0aetrifcoa1opte ies;t  rtmxo oudlltnmnctl(  2uru p;u0opx ifctltlaDrlu p t4 renxo tytlat anesls0trxmirpnu4openlnciltfarum(mpoo1tlen ieiltla2ean p;t) eeoif oydlpte nvils0t2to(rpoo1ap n fesatfsrrauroou1oex  feilt sDemu p u0trenir3iadlm  lueo;() rurxm no1opeelfvsl(f 2rm(rpnu4optn iciasls2eauvon(4teerio io1latelneslt0trxrimpoy1opeemneil(  rtmumpou0apt  feiytlm2eaump u) rtnxr3tatfaD li sl(  etm(opiodamtelfvslt arra(mpoo4oltoii3tlslaDrm(vs;t0tltoifciy1omteli s s  rtm(m nu4aptn nvtls  2rmxr ;o0optnmfcildlsDea(mo (0tetnifcoadlmt  nvs;s) 2xr(opoo1alt  ivsa(fsrtaum ;u0tpt iieiat s um(ms t)tetnif tytoa  au s;( t2to(r3nodamt mnet s aruaum ;u0tlen ictas s2ea(vs u0 exrmo totlm ran il( s2uoimpoo1lptemicslt a2ta( pno4tpe  f3iad s rmnms ()alenxr3oadlpD  ues s)srumxo nydop nmncsat)arurump;t1aexoifcild m2umuvs u)arenif iydoa eaneo ()t2xoimpnu4lmee icilsfsrtm( oou1opx if3iydla2el(vs;(4altomf ta1omteluvi (0t2uoxm iy1op n fesas a2uau  nu0apeniieiyd s2emumont)tlxrmrctytlptr neo s srxmxm no4amt lnctltf rtru  ;o4oexnmi3iysfmDem( o;(4 rtnif3tatom ran s t  etoxo3ou1lm e nvilt  Dtmu ont4texnmf3iyt sDrl(vs;(0alxrxf3to1oaDrlivo t sexmim3iu4alte fesl(fa2raxrpot0tptn o3taslmDranmpnt4tltnir ty1opte ues (0 euoirpiu4ome  icias)sDrau pno4tpt  i3tls mDrm( o u4 rxomr3ta1fpD lueilt s2xrim3ou4lptn nei t sDra(mono0oltn fetad aDrl(ms t0 etrmo3ia1om  anvi t sexr(m nu4amt lncils a2ur(mono4texomiciys a um(mo t4 rtoioctodfptr uvo;() 2to(mpoo4llt mfes t)s2rm(rp;o1apt mi3tytfm rlumsnt0tleomr iatopte i ols t2xrio3ou4lpenmfvt (faDtrxm oo0tlxo iciydls rl( snt)arerxfcto1lmDe i il(  2xoio nu4lp e icias) ruaxmpno4tptoif3tldls umn s;u0 exnmr io1lp raueo s0t2xoimpou1opt lfei tf 2tmu  ou1oetnii3iltls eaumpnu0altnmf3tatlmDrli o;s) rurimpoydop   feslt)sDumump;o1alx mfeiyt a emu o u4texnmocia1opDraneil(0 2trxmpiydape mnctat srrmur ou0teen o3tatlsDea( o t)treomf3tydlmDeauei;s0sruoxr no1lpenmfvsas) Duauro;u0tetnio3tadlaDraump u) renxr iytomteai i;s)s2tmim iydopen fcia( aDrm(rpnu0oltomoctysla ua(vo;(0texrmr oodlmD lueo;s) rxmio3iu1ome mfvs sfsDurump;u0olenmocildla emnmp;(4 eenxrctodfmDrli s;() 2umxo3nu1amtnlfvil(  Dtmxmono4alenmfcias s2rmuvsn()artnxr iotlaD  ueo;( trtmirpoo1apte ieilt a2umxrpnt4tex  octat m2rmu p u)areoir3ty1fatranvi t)t2xr(m oy4alt  ivia(f rur(  ;o1apeomfetad s2emumpnu4trxomo io1lpD li s;(0 2ur(r3ny4ll n fviatfa2urxrp;o1aetnifctas sDel(mo u) rtnio3oa1omt  uvilt0seuoxmpoo1olee ieilt s2umu  ;t1oexomictlslaDumumon(0 exrxr oodlpt lnes;s0seum(r3iu1oltnlncsl()sDta(  nt1tex ioctlt s2rluvp;t)aexriocoodop e uvsls)s2to(opno4olt  ici (  rrm(rono4apxomoetys a uauvp u0altrmf3tydfpD auvi;t) exoio3no1lm  lnvi s s2umumpnu0aeeo fetadlm rau s;u0alxrmociadlm raies;t)setr(r3oy1am nlictlsfs2tax ono4ope mi3tldfs elu o t)tlxrxf iytlpDr i ol( srtoio oudlpt  fct ()arurumpno1tpeomfcilsfaDem(vs u)trtoxocto1omte i s ()trxo(opny1lm   ietls a2uax  ;t4tpeo ieiasls2eluvpn() lxnmo3iotlat ai o;s s2toio oodopeemfeil( srum(rpoo0openmfetlt m2elnvp;(4 eenmrciytoa  lnvo;t)trxm(mpnodop emfeils)srrr( p;t4aetnmietaslm eanvs (0teeomr3tatfaD  n ilt  rxmiopnu4om e iesls)sDta(mo;u0ape ioeiatfa rln pnu) renmf3oydomDranvi t srtoir3io1ll e ivi t)s2rr(roou4optnmoetyd s eaumonu4trxnio ta1lp eluvolt) 2ur(mpoo4lmtnlnct sfs2rrx  ou0ope mo3iat m2uan s;(0texrxo3iatoa r nesl(0 exm(mpoy1lm nlnci t arumxmpoo1texnmi3tltfm2ra( s u0tltoif oatoa eliei;s)s2urio3oy4lpe lnes t) Drr(  ;u0aptnioeilsfm raump u4tlxrxocoydlp e i i s  etmir3oo1olee netatfsDrrum ot1tpxo fctas sDemn pn() rtoxfciytfp elnesl(0trtmir3iu4lm  mivt s a2rau p;u1opxo i3tytlaDrmumsnt4 exnmrcty1fmDeanei;s  exmxmpiodlp emnvilt s2ur(m nt0ale  fctydfa ulnvp;t)texoxr3iytfp r n i;s0texriopiu1lptelnvslt)a2ur(  ot1aleomfetasfmDum(ms;(0tltoxf3iytfpD aies (0srxmxo nodlltnlnvi tfsDrmu ooo4ole  o3iatfm uau s;t0tltrxr oydfa  lies (  2xrxr3ou4apt  ies s  Dtrx poo4opxoiiciat s2elu sn(4texrmo oadlateli i s texrio3oudame lfvsasfa2taurpou4alt ifciltls ul( s u4alerio3ootoaD  n slt0s2uoxr3io4lltnmfvi t a2ta(  ;t4teeomoctatfm ua(ms t4tltomrcto1lptr ieo (0tetrimpou4opeemieiat srtrurpou1oexoiictys m2umnmon(0tlxomf3oy1fp raivs t0trum(mpoudllt lnes t  Drmump;o0tleomo3ildfsDea( ont)arermrcty1lmtr n o ( trurir3oy1ap emiei sfaDtaxmpnt0apxo oetls s ra(mp t0 lxomf3oatfa  lieslt)sexr(m3iydlp elnvt t  rrmurono4aleo oetyd s2ea(ms;(0 lxomfciodlp eluvo;t0seto(r3ou1oleemfct t a2uaumpno0alx mo3ildlm ea( pn(4 exrmf iy1faD aivils)trxmxm nudlptnmivil(f rur(ro;o1olxoii3ils sDuan p t0 eeoxr to1lpDeaivsl()teto(o io1llt mnes t)aDtmx  ot4optnifctytfaDrm(vsnu)arxnmociadfateln s t)tetrxr no4ol nmfci t  Dtmxmpou4olxomieiatfmDuln p;u4trtomrcio1lptrli slt0texm(o3oudlmen nvs tfsrrmur nt1oltnifctydfs rlu onu4 rxomoctydfp eau s;t0tetr(o ou1olt lncsls)a2uru o;t1tex  oetyd m em(ms u4tetoxocoytlaDr nvs;(0 eumxo3nodaleemncsa(fs2rrumo;t1tpxn f3tldfs2umu s (4 rerir3oodoa eaneolt sexoio oo1lmenlivs () ruru  ;o4tpt  o3tltlmDua( s ()artrir todomDraies;s0trtmxm3iu1lmtemies ( artmx ono4alxnmociydla2ea(vp u) rxniocta1optr ivo ()s2xr(m oydol elieiltfsDum(rp;t0ole ioeiyslaDemuvpnt0 exnxr3tatfpteln o;s texr(rpiu4altnmfvtl() 2rmx pot4oet  feiys m eauvsnt)artoxr ootop e i s s0 etoiopiy4aleelnetl()aDtau  ot1oetn f3iaslaDuan onu4trtrxr3io1faDrli o;(0t2xo(o oudal elnetl(  Drmumooo4tpe mieiaslaDumnms t) lenxr3totlp eli o;( trto(mpou1ole  ivsl()srumu  ;o4teeoioeiatfsDumu on()tlxrmociy1lp rauvil( trtmxo3iu1amt mncs sfarumxm ;o1openifctytfa2uln p t)artnxr oydlptelnvi;(0 etmxm ou4ame micslt) rraxm no1apxomoeias m2emu p (4 renmfciotopt li s;t0t2toxm3iudopte fctl(fa2ta(moot1ole  ociadlmDelumo;t0teeoxf3iodoat ln o t0sexoir3ou1amee nei t artmu p;u1aetnmfetyslmDuanmp (0tlxnmrcia1fmDe u o;t0srumxmpoy1ol  lfvtltf 2tax pou4tle ioetldfmDeau p t4trtrxfctatlpD aieil(0 exr(m nu4lme miesas a2um( p;u0tpx moeiytfa rmu onu0alxrmf3to1op rluei;t0t2uo(mpiy4altnmnct ()artmxrono1apxo ieiys s ulump u0 etrxf oodfaDrlnvs;t teumxo3nudoptn fcilt) Drmur ;u0oetoioeiad m umn pnu0tetoxf io1oate i il( tetmir3oudop   fvias)arum(  nu4tetn f3iad s2eau o;u) etrifcty1omteaieilt0s2trxm3nu4lpeemieilt aDtrumpnu4oeto o3tatfs2umuvonu0tleomocoytop rluvilt0srxr(o ny1lmte nci s artaurpnt0tptnmf3tlt m umump u4teeoir3oodfm r u i s0 2toxmpny1lm emfci ()aDtmu  ou0alxoiociyd mDrlump;u0trxnir iatoptr i i;t)seuo(o iudalen fvia( s2tm(rp;o4aet ioetyd s uaumsnt4aeenmf3iy1la rlivo t) etrir3iu1ll e fcsat a2ta(r ot0ope  i3iyd a2rlnvp;u4tetnxrcty1op rlues;s0t2tmimpou4ap elnvtlt s2ua( oou0alxnmo3iydfs2ea(vp;(4texnxoctydfmDeaivo s)srtrir oo1aleelictls a2urxr no0aleomfeiat a2elumo;(4trtrmo oo1oaDr u s;s0 rxm(rpno1opt lnvi sfsrta( p;u0tee iictltla2eln s (0artrifcoo1fp eliei;s) rxr(mpou1ol nlfcslt)s2raumpot0teeomfetatfaDua(vs (0 lerif3oy1fmD aivo t0setrxrpnudlltnlfci ()a2rmumo;o1tltn ociyd m uanvsnt0tlerxocta1fa  livsls)sexr(rpoo4op  lnctas srrrumo;t1tpx ifeiatfa2ua(vs () rtoxocoo1fa   nvo t s2xmir iodapeemivi s)arrm(root4aeenmf3tltla2um(mp (0teerxf3oa1om r u slt texrxr3oodllte iesat sDtmum ;t1tet io3iys m rlu pnu0 ltnif totfmte n i t) 2xmxr3nudamtemfei ()aDtru  ou1olxomieilsls2rau o u4teeomr totla ran s t)sexoxo no4op  micias)sDtmxmont4apx  feild s2eaums;u)artnxo iodfm r uvi ()t2tr(o ny4am  mivsa() Dtr(rooo1aeen fcildla ul(vp;u0 rxrxrcto1latrauvslt t2urxm iy4lm n fvt ()artaumo;t1tptnmfeiasla2ua(vs;t0aleomf3oa1oaD ln slt)srtm(o iy4lpt micslt  rurur nt4aeto fctadlsDemu pnt)teenio iodomtrai ilt)trxr(m no4amee nvt s s2umurono1olx ifctlsfa ea(mont0texoio iy1lmDe ues;s t2tm(o3nudaltn net (fsrtaxmonu4texomi3tltfm2emu on(4 lxoifciytlpDrauesls0 2xoimpiy1op nlneiltf 2uaumpnu4tlt mictyslm2emumo;u)treriocoy1fpDrau s s0tetr(opou1oltn nvtlt) 2taxr ;t0tpe  f3tldfm2eaums t0altomo3io1fmt  u ols)seuoirpiydlltn fvtlsf Dumur ;t0ope  fctlsfm uanvo t4altnmfctytlpDeaneo;( t2xmxm no1ol emfei ()a2rr(mp;u4olen ociydlm2rlnvo u)alerxocio1fatr ivi;(0 rxr(r3oo1ole  fvsls artrumpoo4tex mf3ilt s2rmuvs;t) rtrmf tadoa elieo t)trxr(o3ny4lltnmnetlsf rtmxmo;u0altoifcilsla2ra( ont4artnir3oydlaD an i t) rxriopoo4am nlnviatf 2rauro;o0tpxnmociadls ranms;u4 lxoxo3oytomt an s s0srtriopoodllt mfvia(faDrmx  ;u1oee if3tltlm2rmn pnu) rtoxf todlp ran o t)teuo(m oo4op n nvsas  2rmu pou1tlxomoctytfsDel(vo u)tltrxf3tytlat  n slt0 2xrxrpoodol elietl(faDum(m nu1alx ii3tatfs2rmums;u0teermo3tydfmteaivslt)sexmir3oydlm e neiasf Dtau  nt0teeo fciys a2ea(msnt4 exoxfciotoat ln ol() eumio3nu1ll  lfci ( sDurum ou1oeeoif3iys mDelums;t0alxomf ootoatrlneils0 rtmio ou1lpenlicsls  2urumonu1tpx if3ilsla rmnvs;u) rxrmo ootomtr neslt) exrxm3ou1om  lfeslt)srrr(rp;t0optn fetltfaDul( s ()altnxoctotlp  lu sl()tetr(rpiudomeelfesatfsDur(m ;o1altniieildfmDeluvs ()tltnir3ia1omD au ol(0seuoirpiodapen fcia(faDraxrooo0teeoifeiytfm2ulnvp;t4 lxoif ootfm  lueo;t)seuoxo iu4opee fes t)s2rmxmont4aeeoio3ils sDel( o;u4tlxnxr3oodla elnvo s0sr
\ No newline at end of file
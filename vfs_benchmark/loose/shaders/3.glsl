@@ -0,0 +1 @@
+ies;s0seuoir3oo1lptemfesa(  2rrxmo;t4aeeoiiciltla eanmo (0trtrxfciatlatrlies t) etrio no4omtn icsat artmur ot4openiieias a ua(ms;(4 rxoxr3iodfaDran s;()tetrxrpnodam   nvsatfaDrrxmont4apto fciytls eanvp;(0 ltnmr3todfm rli o;s) 2to(r3ny4om e ictat a2ua(rooo0aleo feiadla ulu p t0tltrmfctadoaDe n ols)seuoxmpoydop  lncs s s2umumpno0opto i3ildlm el(vs (4altomo oatlat an i;s seto(mpou4lmt lfet tfsrur(mp;o1apxn iciytfa2elnmp (4 lxnxr to1fat ai o;t0 etoxo ou4ame lfvilt) rtmu oot4apxniociysfa2em(mo;u)aeeomf3totlmDe uvs;(0trxoirpoudamee nciat) 2tmxmo;t1opx  i3iys s2elnmp;t)trxrxrciy1fm e i s;()s2xmxm3no4ap e ics ()sDrrurono0aetn ieilslm ranmp;(0tltoxociotfmtr ivi t0teur(r oo1lme mfcilsf Drm(mpou0tee  feiydfa uan pnt0 lxomrciydfpDeluvsls0srtm(o nodamtnmivilt)a2ua( ooo1oltn fciltfaDua(mo;(4 ltnio3tadla rlnes t)s2toxmpnu4ap  mivsas)srrrurono0tpeomiciadfsDrmu snt)areomr3iydfmDrliei;s  rxrxr3no1olt mncta(faDtmx  ou4aetoioetadla rauvo (4tlerxrctodlpDrln o;()tetmxrpiu1ll n ictlt)aDtm(r ot1tptomieiasfaDumnvp t0altrmr oo1lpDeai i t  2umxm oy4aptelicslsfsrra(mooo0apxomiciatla eln s u4tlxrmocto1fatrai s;s0teurxmpiydlm emies tfs2ta(mp;t4tpxnmi3tysfmDranvsn(0aleriocoatla r ues (0 exoio io1om n ncilsfsDtaum oo1apt mi3ildlmDeau p u)trxoxr3oa1lmD an s ()s2trxmpoy1lmtnlfvsl( artaxm ot0aetniicils aDulumo ()trtrio3oydoatrlnvi t)truoir3iydap nlfvsl()sDtaumpot4tpt  o3tytla2uluvpnt)aexrmrcoytlmDr ivolt0t2tmxopou4om  lnesl() Dururont0optn iciyt aDrm( snu4 rxnif3tydopDe u sls0srtrxopou4op elfct ( s2ua(r nt4tlxnmi3iltfmDrl(mon(4aeerxf ootopD lu ils0 rur(rpiydaptelncsa()srrmum no4tlx mi3tltlsDrauvsn(4tlxrio tytlaD  uesl(  2um(o3iudap   ncsa()s2ua( poo0opeoifctlt m rlu snu)tlermr3tatlatr ies;t0srtmxr3iy1olee nei ()a2urxro;t0opx iieiadfmDemnms t4trxrxo3ia1lm e ues;s)s2triopoydomt micilt  Drau poo4oeeo ociysls rlnmp;t4arxomr iadopD  nvo;s  exmio3oy4ol  mfvtas)aDrmu pot1aeeomo3iad sDra(mo t0trerxf iodfpDrlieolt srxoxrpnydameemfvias)sDurum ;u0aetnmocias s2el(vs t) eenmfctydfmtelu s;t0t2to(mpoodlpee fci t a2umurp;o0oltn oetadlsDrlums t)altnmo3iatoaDr ueo ( tetmirpny4om nmivilt) 2taxr no0tpxo i3iltfmDumn s (0aleomo iytop  auvo;s  rurimpnydolenlics s)s2ra( p;t0apxnmieildfa rlnvo (4arxnifcoa1lat livols)s2xo(o oydamtemivta(  Drru  no1aetomo3tytfaDua(vo t0aexnxoctydopDraieolt0trxoir oo4al nlieta() Draur ;o0tex  ietysfaDrm(mpnt4artnxr3tatfm rli ols)setrimpiodlmenlfcta() 2tax pou0tltnmfeiad m2rlnvpnu)aetrxr3ootlatelnvs;t)t2trxopiy1ome mivilt) Drrumpou4aetomociad a ranvpnt)texnmf iotoateaies (0t2xm(mpiu4op elnesl(fartmxronu1tptnioetytfa2eau snu4alxrxrciotlpte ivs s) rxr(r3iydll  lnesatfaDraxmont1aexniocias sDrmu o;u4 etomr3iotlp  lneol( truo(r3nydopenmies s)s2uaur ;u4tlt ifciad a eln p;() rxrir3oodomDraivo;() rxr(m3iydlpe  nvs (fsDrmxr ;o0tlxoiieiadfs elnms;u0 lenif oadopt lnesl(0 ruoxrpiodolenlfct () rtr(mo;t4tpx  ociaslm2uln o;(0 eeoxr oydopt lneo (0texoxo iudol  micslt  Dtmxrp;u0ale  f3iasfmDuan ont0alermrcio1om  ln o (0trtrxm ny4ol  lict (  Drrum ;u1olxn fciydfm2rmuvsn(0alxrxo io1oaD  iei;(0trxo(r3iu1al   iesas) 2rr(ront4texomieiatlaDua( o ()tlxnxo oatlmt  nvi;s0s2xoiopio1ol e icsas a2uaur ;o0tpx  ietyd a2uauvp;u4trerio3oodfa  lneils0 rtmirpnydomtnmivt tfaDrmx pnu4openii3iydfa2rm( o u) leriocoadfptrau slt) euoxr io4ape  nciatfsrumu  ou0aee mi3tls m emn onu0 reomr3iydfmDe u s;(0tetrxopnodam nmnvtat)sDrrumonu0apxn fciltfa2rmnmo (0tlermrcto1opDrauvsls s2urim iydom  lfctasfarururo;t0tpenif3iys m2uaums u)artnif iydfmteliei s  etmxmpnydlm n iviltfa2uauro;u1altnmfeiltla ea( o u)teerxf oydlpD anei;t0 rxmiopnu1ll  mfetl( aDra(  ;o0olx mi3iyd s uau o;(0trtnmf tadlaDe ueslt seuo(mpio1aptelnvs sfaDrm( pnu4alen ieias aDuluvs;t4texnmo ty1lpDean o;t0trumxrpiu1ape  nct ( a2tmxroot4aeeomiciadfmDumnmp u0tlxrmr todfat ln o s t2ur(r iodlpe mnes tfs2trx p;u0tex  icias a umu o;(4alxoxo iydop r uei;t)sexmxm nodlpeemfeslt)sDumumo;o1alenioeiatfm uan o;u4 etrir3todopDrlieo;t sexrio3oydameemncsls)aDtr(r ;t0optoioetatls2rmnmo;()trtoxocto1omtr u ils  etr(m3iy4lpe mfesat  2rax  ;u1texoif3tlsla ra(mo;(4aetniociy1lmD anvi t0 2ur(opnodoltn ies s artr(rpoo4apen ictltfs2eau s () rxomf3todoaDrau ils0trumxo io1apeelivt s  rtm(  ;u0tpx mo3iys a ua( o u0 rxnio tydomD aueil() rtoxopiu1alenmnesas  2urumpno0tpxn f3tld s uaump;(0aeenmo3tadomtrlueils  2uoirpiydopte feta()s2rmxm no4aexo ocilslm emump (0aeeoif3iadoa   uvo ( trumim iu4amenlnvtat)aDumx oou1tptn f3iadfmDumu pnt4 ltoio tatlpD lies s teum(o3nodap e fvt ( a2tmx pot4oex  ietas s elnvon(0 rxrxr3ia1opteauvs;s0 rxmiopny1lp  mnvtat)sDtmurpoo1tpe  f3iydfa emump t0trxomf3tytfa   ivs;(0seto(m3no4olee net () ruaxm ;u1teenmoeiatfa rlu o ()artnif3iytlpDrlivsls0s2urim3ny4llenmncsatfa2uru  ou4aptomo3iydfaDeanmo (0texnmoctydlmtelu o t)t2xoxm3nu1om e fvs (farumxmont4tptnioeiatlm ul( o;t0teeomo oytfaDe i sls)srtmir nu1lle lnvsa()aDrr(rooo0apto fcildfm umums t0aexnxr3ta1laDr neo;() exm(opiy1ope  netl() Duax p;o1aet io3iltfm eanvp;(0 eeoxocootfa r i ils)srtm(m3iudol elieilt s2umur ;t0aeeomfeiyd aDul( s t0arxrxf iytoatr nvi t) 2xrxm3nu4ll n neils)srua(ro;u0tlxo feiasfm rmuvs ()teerir oatoptr ivo () 2trxo3oodop n ivsl( aDtr(rpot4oleo f3ild m ranvp;()artrio oy1lp   ies;s)srxr(opny1alt licilt)a2ur(moou4openmociyslm um( ont4 lxnmr3oytfm  aues;() rtoxr ou1lle lneias) 2ua(rp;u1tpeoiicildlsDea(mo;u)artoio iotlat  i s;t) etoir3iy1al nmnvslsfsrrmumo;u1opeomo3tydlm2um(vp ()teenmo oo1laDe i s;()sexo(o3ou1apenmnetlt arrmx pnu0aleomociadls uan s;(0aleomfcoadla eaiesls0trxo(r nudoltemfcil( sDtaxroot1oex ifetltfs ea(mp (0artrxr tadoateai o;t0 rtmxopiudam   ieias) Dur( oou1aptnioeiadfs uauvont0 lxomr to1fpDeli s;t)tetoxr3nu1ole micias) Dtmxroot4tltnii3ild sDumn snu)tetrxr3iotfpDrlu s t) 2urxmpiodomte neta()srrm(m oo1tpto feiltlaDulnvon(4alerxo3oo1lp e ivi;t  2to(m oy1optnmictlt  Dta(mpou1apx iietaslmDumn s (0alermr tatfpteaueilt sexm(o ny4al e fvtl() rrau pnt4olx  oetadfs rlumpnu)aeerif oy1fm   nei;s0 2xoxm3ny4oltnmfesls aruaump;u4tptoifeiydls el( pnt4tltrifcoodoatr u olt texriopiodomen ncsls aDrrxmooo0aetomo3tadfaDulnmp t0tltoxr3oydlmDrai sls) etoxm oo1alenlncsat)a2uaxrono0aee if3iaslm2umumont)tlxoxocta1lpDeaues () euoxr oodoptemici tfsDumxr nu4ale  octyd a uan on()artoxfcootfmtran ilt0seuoiopiy1lmenmncil() 2ua(rpnt0oeto f3tydla2uau o ()aeeoif iodfaDr neo;(0 rxrxo oo1altelfeta( artaum ;o1apt mieiydls elnvsn(4aetomrciy1lpDr ues ( setr(rpno1ol  mictl(f Dtmu p;t0opeo fciydfmDrmumo t4 rtoxo3oytom rlivo (  rtmio ou4altnmfvt t) rtmxm ;t1aptomfeiadfsDelu o (4 rxnxf io1lp rli i s0t2to(r oudam e ivtas)arumu  nt0olt  oeiad a umn pnu4 lxrio3totlaDe u i;t  rtm(rpnu4amt  ieslt arrm(mp;t0texomo3tytla2umnvs u4texnmrciytoaD  nvi ()t2xoxmpiodlm  mics s)a2trxrono4olt  fctat a uanmo;(0trxnmocoatoateluvils  etrirpno4optemfcsls s2um(m nt4olxnmo3iadfm2el( o u4altoio3tatopDeaivs t0s2xmxo3nudoleelnet t) rrm( p;o1tpen o3iydls rmumo;t0 rtrmr oydopt  i olt)trtmxo3ou4ameemncta(  rtaur no4alxoioetldlm2uanms u4trtnmr3todlpDe u sl(  2xm(o3iodop  mfci s)arum(r ;t0olt ii3iyd aDuln s;t) rxrir3oodfpDe nvo;t0 2ur(m iy4omt  ies ()sDur(r nt4tltn fcias mDumnmsnt4 reomr oy1omtr ieo s)s2tm(r iudalenlici s) 2rmumont1oeto o3iysfmDum( snu)trerxrcta1oaDeln o t  euoio3iu4altnmnvtlt  2um( pnt1olxoifeiasfs2ua( s;()trtnmfctadfpt  ueo s)srurxo iu1omtemies (fs2uru pnt4opto ocias mDuanmo;t)tlerxr3oadlptrlivi;(0 2tmirpnydlle  fct t)sruaxrpou0altnif3iydls ean on()tlerxrcty1lpDean olt0t2xrxmpiodapt mnet (f rtrurpot0oetnmoeildlm rluvs (0arenif3iotlm eai ilt)tetoimpnydap  mivsl( arum( pou4opxomi3ilslmDumnvo u4 etnxf ty1om eluei t0s2trxmpnudlmeemfvia(farrrx o;t1aptn oeiadfaDul(vp (4aeenio3to1lpDr nvo;s  euoim3oo1opt mfcias)a2tau p;u4aex  oetaslsDumnmo;(0teerxr oadomteanvi;t sexrir3oydamt mneiasfa2raumo;u0apt  ieiltfa2umu o (4alxnxfcia1fpD  nei s)s2trxmpnydale  fvtl(  rtm( pno1aee ioetlt mDumn s t4alxnxo3oo1fa rlnes ( s2toiopiodop e ivs () 2rr(moou1tltnmfciydla emuvs;t0alxnmr3iatlpt  ueo t seurir oo1ap elnesls sruaum oo1tleomo3iad a2umnmsnu0aeeoircoytfmtr nes;(  2xo(mpio1ome mnviat sDrr( o;t1ape iictat mDul(mont0aetoif ootomt lnvils texoxopnudop nmfctlt s2taumoou4tltn ietlsls2ua(mp () etrifctodfat  ueilt  2urimpoodlpt lnvia(  rraxronu4oex mieiyslmDrlnmo;u4 renxr3iatfaDran i ()sexrxr ou4am   fcsasfartaxrpnu0oleoifeiadfm uaumo;t) rtriocootopt lnvols)s2to(o nu1am nmfcsasfsrrr( o;t0tlt  ietatlsDea( sn() ltnxociytfate uvo;(0trtr(mpio1aptemncias) ruaurp;o4aet mfctadlmDrluvs t)aeermo todomDe nes (0trto(m3oydom nlfeta(fs2rrxm ;t1oltoifeiysfaDel(vs (0arxnmf3oodomte uvols0s2uoimpnu1lltnlfvt sfarua( pnu1aeen ieild s2el(mp u)texoif iotoat auvs;( t2urio iu1ame mnvil(f 2rrump;o1aetniieilslm2em( pnu4 exnio iodoaDr uvo;t0srtmim iu4al elici (fa2rr(moot1olxn fciysfa2ul( s (0 reniocty1opDe n o s t2urimpoo1alt lnei tfa2ta(m oo1ape mo3tytfm2em(ms;t)tlxnircoa1fp e u o t)t2urxm io4omtnmncs ()s2tmx oot4apt mocilsfs2ra( sn() lxoxo3oy1fa rauvi s) rxmxopoy4altnmncsas s2ur( p;o0oltomfctydfs2uln o;(0tetrir3todfmDeanvil()trxr(m3iu1omte fctl()srrm(root1ole moeiadfmDrlu p t) rxnifctytfpD  ivo s srxr(mpiydlle  nvsltfs2ua(mp;u0olxomi3ilsfs2ul(vs;u0alerxf3todfpDraivi;t0srur(r iu1llt lncias a2rax p;u0oexomoctasla2uluvp t0tetnxo3totfa eln olt)t2urxr3nodole livsls  2ra( p;u0oetnmoctasls uanvo;u) rxrxf3iodop raues;t0 rxo(rpno1lpt livsat  Dumur ;u4tpx mi3ildfm emumon(0tltrmocoytomtrlueolt) exoir oy4lltemiviat)s2tr(m ;u0aexomociasfm2elu ont0aeeomf3iy1lptean i s t2xrxr3nydomtemfvt (fs2uaxmpot4aexomiciad s ulnmp (0trxrif3oatlm eanvo;t0 eurio3oudllt mfvta()srrrxrp;u0texoifcias mDem(ms t4tltnif3oydlmtrli s s  eur(rpoy1lltnlneilt sDuaum ot0aet  f3tlsla uaumo t0texrxf3iotlpDe ivilt0 exrxm3iu1lpeelfesas)arrr(r oo4ape mociatfm rln onu4 etomociatlmtrlieolt)srumxr iu4ape mnvt t s2raxm ;t0tpen fciltla2ra(msnt0 reoir iodfmDrauvo s srxmio oodol  lfctatfsrrm(  ;t0altnif3tlslaDulnmonu4 rtrxo tytlmDe ueilt) rxrim no1olte fcias  2uaxm nt4opxnioetyslm rluvs;t4aleomfcoa1lmDelu s;t setm(opiydolte fvtat) rrmx pou0tee mictytfa raumpnu) ltrmf io1oaDrln i ()texoim3ny4open ivi t  Dtm(monu0oetnmfeiysls eluvo t)tlerif oytlpDeluvils  etrirpoudlp e nes s)srumxmpot1aee  feiadls2rmuvs;(0alenmfciy1om  aueo () 2xm(m io1omt  fctls aDuau ooo0aleoifctls a rmuvs (0alxnxrciotlpt  u sl(  etoxr3no4alt lfctat a2um( onu1olx ii3iydfm umnmp (0alerif3to1om r ivo t)sruoxr io4amenmivsls) ruau pno1olenmieiltfsDelnms (0aleomr ia1laDeai i t0 exo(r3iy1lmt mfetls)s2ta(r oo0teeomfciydfmDrmnmp;t) rerxf oodopD aieilt  exm(mpny1op nmnciasfartm(m ou4oee ifciatfs eauvsn(0 reoir oytlpt lnvols0texrxr oudopee feiatf 2rmx oou0aex  oetltla2rauvp;u)aetnircta1lpt  uvol() exo(r3io1omtelicia(f Dtmxronu0tet ifctls a2um(vont4treoxf iydoa eaivs t  2urim iy1op n nvsltfsrtr(  ;t4tpeoiieiytla rm(mp;t)arxoir3ia1fpt lu olt0sexm(r3iodoltnmicsatfs2raum oo1aleo ietat a2rmn pn(4aeeoircto1lptelnvs;s teumxm oudlle lnvsl(fsDur( p;o4aeeo ieilsfm2um(mpnt0aexrxrcoo1opDe ivs;s0 eur(opiodap nlnei t s2uau  ;t1tpxoifctat s uanvp;(4texoxf3oadfpteli i;t0sexmxmpiodolee ivtas)sDurxrpot0tpto fciysfsDumnvp;t)teeomf oytla  aieslt)t2uoio3no1aptn ncia()srtmxmpnu4tpenii3tlt m em(msn(0 eermf ta1lpDraueils  rxmxr3iodlle  fcslt)aDraxr ot4tpeomociatfa elu sn(4 rtnmf iatfp eli i t) exr(opio1optn nvias)srumum nt4altnmf3ilsfm2elu s;t4trxnxo oodfpteaieo t)trxrir3ny4amtnmnvtas) rtm(r ;t4tex  ociat a ulnmsn(0arxrmf iatopDr i s;t0s2tmio nu1ome  fetlt  2umuronu0apeniieilt a um(vpn(4aeeomo3totoa  anvi (0t2um(o iy1alenlfvia(  2umum ;t4olx mi3tatlaDum( pn()tetnio ootfat  u o;()sruoio3nu1al emnei (  2rmur nu0tptnmieiyt aDranms;t4alerio3oatlatrauvi;s t2xrxmpiy1amee iesls sDtru pno1tlxoiiciydfm2eanmo u)teenmo iydlmD  uvil()s2um(opnodlmee net t)a2uaxr oo4teeo i3iatlsDelu onu0tlenxr oy1la   n s s  2toxo3oo4omtnlnvi t  2um( p;u1oleoio3tatls2ul(msnt)tetrif3oatlp  auvo s)truoxmpoy1amtelfei s)s2tau ono4texomictadfmDemu pnu0teenxo todfpDeanvol(0seurxrpiy1llt mfcil(faruau p;o4tleniictlt a2rmuvp t0 ltomr3oydfpte u slt)texmxo oudlltnlncias)arum( oot1texnif3tltfm2ea( pnt4 exrxfcoytoatran ilt0 rto(m3ou1lmtnmfvia(fsDta(mp;t4ape mieildls2um( p () lenmf3ia1fm   ieo;t)t2toiopoy1lle livil(f 2rau  ;o0tet  ictaslm elnmo;t4tetoirctydlaDeanvols0srxm(r no4lmt  fci ()a2ua(r ;o0tetn fctldlm rmu pnu4tetrifciodlmtrluvsl( sexoio3io1llt lfeils arraur ;u0tpe mf3ildfmDuanvo t0 leoxo tadom elivs ()srxo(opio4lm  mieils aDtau poo0teeomi3tasfa el( onu)tetriocoydfaDe ivil( sruo(opio4optemivt s aDuaxr nt0tlxomoeild m2umu s u)arxnxfciatlpDe ueolt0srurxr3nu1open fvtlt)srtax o;u4tetoifcilt m ra( s t) renir3iytla e u ols0 eto(r io1apen ivtasf rra(mp;o4tpeoiietlt m2rmnmonu0aexnio3tytlaDe u i s)seurxmpou4ol nmncslt) rra(r nu0ale  octlt m2ea(ms (4trxnmr tadoptrlnvo (0 2trirpiy4amen fet tfartaxroot1texo fetatfaDemn on(4arenmociotoa e uvols0s2umim3oo4al n fvil( srrrumoot0tptoii3iasfs rm(vsnt4alermoctadomDeln i;( teuo(m nodopenlnctls) rtm( pot1aeeomoetldls rl( p;t)tetrxf io1opD aues s) 2xrxo3ny1lpe lfesa()sDtrxro;u0tltnioctltlm2ra(vs;() rtoxf3todfptrluvi;()t2to(o3ou4lm  lfviltfa2raurpnu4optnmf3tasfa2emu pn(4 rtnxf tadlmDrau s t0srtmxr ou4al e fetl() 2um(rpnu0opxomfetadfaDuln o;()aeerxrciatlmteaivolt sexmxmpnydoltnmfci sf 2ra(r ;u4aetn iciasfaDeanmp;u)texoir3iydop e neols s2trir nu1oltn fet ( s2tr(  nu4teeo fcilt aDuaumsn(0artoiociy1lp r i o;()setm(m oo4ap e nvsa(fs2um(r ;u4oltnif3tytlmDeanvsn(4tlxnxrcto1om  ai il(0t2uoim3nudll nmfct t  rumurpot1optn oeiytfs2em(vo;() rxnmo3oytoaDe nvi t)t2trxopoydaptemnesl() 2uru  nt1apto o3tydfaDelumsn()alenifciytfp rau o;s) exoio3iu4lpeemfcilt s2rmur ;o4olto fetldfs2rl(mp (4aexrmfciydop r ivs;s) rxoiopoodam  mfvil( a2tmu o;u4tet mi3iat s2ra(mon() renifcio1fateau s (0 rxmxm no4llt  icia() rumump;o4tpe mfctyslmDeauvo t0texrir ty1faDrli o s0srumxopnydlpee ieia()sDrr(  ;t0aet  fctasfm ulumon(0artnxo3ia1oat au i s  exr(r3nydam elnct ()sruaxrpno1tlenio3tyd mDeanms;u)aeenif iadfm  luvil(0seto(opnydomee netls s2rax oou0apen i3ilsfsDeanvs;t4trtoxfctotfmD  ivi s0trurxo nudlmeemicils arra(r ;u4tptnmo3tltfs2um(mo (0 lerxo3iotfmteanvilt0teuoio iudaltelfvsa()a2taumo;u0apeomoeiyd aDean p t4alxnio todfpte nvolt0srumxo iy4olenmnvslt)sDumumonu4texnmieiadlm eauvs (0trtoio3iytfptelivi (0 2xo(r nu4om   fctlt  2ururpnu4oexo feildfs el(vs (4tltnircoatlptean i s) 2uoxm io1am nmneslt)arrm(m ;o0tlxn ieiydla2ulnvpnu4alermrcoatoatrai s;s) rtmxr3ou4apeemnesltfs2umx ont4aexnmfciysfs2ranvo (0aeermr oatlm rluvil( teuoxo ou4lp e ncta(f rumuroou0aeen iciasfaDumuvp t)teenifctadfmDr uvs t) 2toxo3iy1ap  lfesl(f rtmxr ;o0tpeoiicilt m2uluvon(0 renxr3iadla eauvi;s0sruoxmpoo4lm emfvi (farrmumont0tptn fctas aDemnvo;t) lenmo3oatfmt  nvi;s)seumxr oo1lptnlietlsfaDuau  ;o0opt  fciat s um(vo ()trxoirciodfaD  uvolt0t2urxr no4amt liet tfsDrmx ono0tex iieiysfm2uanvp ()aetrif io1la   ueo t0 rtr(m3no4altn ies ( srtruro;o4teto feiys m2rlnvs u4 ltoxfctatop  auvslt  rtm(opnudapt miviatf rrmu ono1olenmo3iyt a rmn o;t4 rtoxo3iatoateln sl(  2umxo3oo1ol n nesas)a2rr(r ;o1tex iieiad mDumuvp;t
\ No newline at end of file
@@ -0,0 +1 @@
+ivsls)srurxr3ny4lle  net (  2rruro;o1ale mf3tytfa rm( snu0tleomr ia1lm   u o;t0 euoxo3iodamtemfct t) rtrurpot4oexnmfcilt a emuvs (0tetnmf3oy1omDe n o;t0setm(opiy4lleemnci t) 2rm(  nu0apt moeiadfaDeaumsnt0tltoircoy1lm   iei ( teuoio iudal elnvs (fsDua( o;t4opeomoeiydls ulumpnu)arxnmr tadlat au s s truoiopnodlpe lfcia() 2taxroot1aex mf3tad m rmu onu)alerxf3oo1omD ln olt)seur(r3oy1ap nlfcsas) 2rrxrp;u1oexnmiciadls2ulump;(0 ltrmr oodop rln ilt  2uoxopoydlle lncil()artrumono4tlt miciytfsDranmo (4 rxnmo3oy1laD luesl(0setoxr oudamee ncs () Drmx  ;t0tpxomieias sDuanmsn(0 rxoifctadfmt au slt0t2xrirpnudopt  nvtas)arrm( oou4alto oetyt a2uanvo;u0 etomocia1lptr uei s0sexrxr3iodoltemnei ( srta(r nt0opeomociad m2umu o (4 rxrmf oy1fmD  n o s0teuoxopoodope  nvilsf rrmur ;u0tpenmfeiysfs emn p;t) exrmfcta1lmD  nei;t)trxr(r oy4lp n feiasfsrtrx ont0alen iciaslaDeanms;(4 eenmf3oa1lpteauei;s0t2um(opiy1ll  mfci (f 2urxm ;o4aeen f3ils a rluvo t0 reomfciotopDeanvo s sexr(mpnudlp nliviatfaruaurpou1openmietat a2rl(vp;t0trenxf3iatlp elies (0 2toio oo4alen feia(  rra(m ou0tpeo ieildfm eau p u4 lenif to1fpt  i s;s0 rurxopoudamt  nvs sfa2rax ono0oex iiciysfmDuanmo t0 eeomrctodom  an o;t0 2toimpio1lmee nciat)a2uaxm ;t1oet iocias sDean sn()trenmfctodom   nvo;(0 2xo(m3oy1lpee nct ( a2tmurpou1tleomiciltlm rmnmp u) rerio3iytfp ranvil( t2umir io1omt lfvilsfaDrmx o;o1tetoifcils s2um( on(4 etriociytomteanvs s0srtm(r3io1lm  lnct s)aDtm(mo;t4apeomictas mDrauvo;t4arenxr oo1fmD li ols tetm(mpiodal nlneta( s2tau  ou4tpe  ictasla2ea( o;u)alerio3to1omtrai o;s)s2xo(r3iydoptnmieta(farraum ot4aet  feiltfa2elu pnu) ltnmocootlm rluvo ()t2xrir3oy1ap e ncilt artmxrp;u0alxo o3tldfs2rm(vo;t4alxnxf ty1lptrluei;t  rtm(m nodamte fcsls)a2ra(rp;t0tlxoif3tyt aDrln p;(0arxnxf3iydom  lnvs t) 2xrxo oy1ap  lneia(fs2rr( pot0oeeomociyd aDra(mp;u0 rxnmocty1lmtr nvo t  rtmxr iudopeelivs t srururpoo4tltniocilsls2umnms t)tlerio tytlmtelueols) exo(m iu1openmnvtas)aDrm(mono1aexo ieiys aDra(ms;() rxnmociytfpt  neo;(0trxmiopno1lm nmfet sf Drr( o;u4alxnio3iad mDemu o;t4alxnxo iatlaD lies ()s2xoio iu1llen fcs sfsDrr(monu4aee mietytfmDrau s (4tltnio3ta1fp r ivs () 2xoxr ou1op nmfci s aDtaxmont0altomietytls elu pn(4 lxomf iatom rauvs s  2xrim nodom nlnvtltf rumuronu0olx io3ias s2ra( o u0alxoxf3oadlaDrau slt)tetoxm3no4lmtn ies (  2tm(rpoo0apxoiicild m2rl(mon() rtrxf iydlatrli ol(  2tmxmpiy4apen ncil(fsDum(m nt1aet  fciadfa ul( o u)trxrxr iy1oaDr ueo s)srxr(rpnu1open fct ()srum(r nt4aptomoeiad mDea(mp t4texomfcoy1optr uesl(0srto(mpnydomee fvil()sDtru ono0teen i3iatfaDrm(mp;u4tltrmr oo1latrai o (0t2xr(m oodaptn iesas  2trur no1aee mi3tydlm2elumo (0treoirctydfaDe nes t0 eumxmpoodomeemnvt (  rtaur ot0aeenioeiaslm2uluvo;(0tetomrciatomtrli i (0setoimpio4am nlivsl(fsDrrxrono1apt mo3taslm ul( on(4 rerxrcoodop rau o t) etoxo iudoltn icia(  2rm(m ou4alx moeiad m ulnvp;(0 lenifciytomDraivol( t2xmxrpiy4omte nvtas)artr(  nu0aet mi3iyd mDemn o t4 rermocoo1lpDelivi;t0seuoio no1ameelivsl( aDtmxr ou4aptoiociysfaDemu s;u0teerxrcoo1lmtraiei t)s2xmio oodal  lfeilt a2rmxmpoo1teenif3tatfs2elnmpn(4altnmrcoo1omD aies;s)t2um(m3io4am e nvi (fa2tmxroot4ole moeiat mDrl(vp u4alxoxfctadopDelnvsl()sexo(rpnu1lm e ict (f rumxmpnu1aex  ietyt m eluvs;(0aetrmf tadlpt  ueols  rxoxmpoo1omenmfvsl( sDra(mont1alx iiciltlmDulnmo u0 rxnio oydomteaueslt)tetoio iy4lmte fvt s)arumu ont1tlxoiicildfs umn s t)texoxo iy1fateanvo;()s2urxr3iy4ope mnvi t  rurx  nt1tee ioeiyd aDuanvp;(0teenxf3oytomDr nvo s)trumxm iodllenlnctasf Dumump;t4aleoii3iltlm2ean sn(4 rtoxo oy1fa elnvo t)t2tmxr3iy4llenmnvtasfarta( onu0oex  iciysla2uaumpnt)tleoir oy1lpt aivolt)teurir io1ape mivtlt)s2tm(rp;o4optoifciasfs em(vs (4 reoxr3ta1omDeaueslt) rxmio3oudol   fvt (fs2uaum oo4oet  oeiysfm rm(vonu0aexoirciodoa   ivs;t texo(r3iu4amee nvta()s2uaxmoot1oexoifctytls2rl(vsnu) lxoxf3oytoptraues (0srxr(m no1lpt mictl( arrrum nu4aex mfciydls2ran pn()tlenxr3oatfaDrli i;t0tetmir ou4am n ivsas)a2urxm ;t1ape  ictltlm2ul(vo (4artrio3oydom eanvs;s0 rtm(m3nudom nlnvs t) 2tau o;o4teen o3iatlmDel(vonu0trtrxrciy1lpDelneo;t)t2umim no4am n ivsltfs2tmx pnt1opto f3ilsfs rlu s;t0treoir3ia1fatraues s srto(mpoo1amee nvt s) 2ururpnu1aeeo i3ild s2rmu sn(0aeeoio oytfmt  i sl( srtoirpnu4lm  mnetlsf rur(m ot0apto octldfm ran o;t0texoir3iydom  li ols0 2uoxr ou1omeelfetlsfaDua(mp;u4tlxo o3ild m ra(vs (4 exnmr iydoat ln o t)srtrxm iy1optemfvt ( arumumpnt4tltn o3tysfm ua( ont0aexoxociadlm raivo s) etr(opnydomee nvsa() 2rm( oot0aeen o3iat s rauvo (4 rtrmr3ty1latraieo;() eum(r oy4al nmfetl(f 2uaxmpou0tetnifeiltlsDra(vo;(4 lerxr ootfp rai ols0setmxo3oodolt  nvta( arta(rp;t0ape ifciat a2el( pnt)alermf3tatla  lueo (0 eumiopoy1op nmivi s sDtr(  ou4apxnmo3tldfaDrl( s u4artrmfcto1laDelueo;(0texoiopiudlpe mnvt t arrmx  oo0olto ociydfaDum(mo u) exrmr3ty1om   nvo (0 rtrxm3oydamt  icsls arrr(  oo4teto ietldls rmnvs (4trerxo3tatlateluei s srtm(m iu4lmtn nctlt  rrmxmpnt4aet moeilt a2um(vo u0 exomf iodfaDrluvolt)srxmxopoy1apte iei s)s2uru p;o4tex mf3iad s2elumpn(4tltoxo oadfaD ai olt)s2xr(o3ny4lpee fvi sf rraxro;u0tptn i3ils sDuanmo;(4arxrxrctytoa  an s t) rxoxmpoo4lle licta( aDrax ont4tex iietlt sDrl(mp t0texoiocoodlp eauvo;() eumxm3nudomeelnvt t a2rm(rpou1oeeo iciydfsDuau s (4 rtoxoctatoatelneo s0s2umir iy4am emivta(f 2rmu o;u4tpxn ieils m2ranvs;u0texnio3totoaD an ol()s2xm(o3nu1optnmieias)srtrx o;t0oltnioetlsfs2ulnms (4arxnmr oodoate n o;t0teurio3ou1aptelnvtls  Drmumpou4alx ifcildfsDul(mo;t0arxrif3ootfptelnvo;t)srxr(m3iu4lm e ictl( s2rrxmoou1tltnmoctltfmDuluvon(0treomf3ta1fmD auvi;s0 2uo(m io1alte ivilt  2rauront0opt if3iltlmDrauvp;t)aexoif ty1omt  n s;t seumxm nydlle  feilt) 2rmxrp;t0aptniietasfa2eanms u0 exrmfciotlm rau o t tetmxr ny1apeeliviatf 2raum ou0aet mi3tasfm rlump t0 lenmo ty1fm elnvs;(0 2xo(opnu4lmtnlictls) rraumo;o0opt mi3ildfmDul(ms t0tlxnio3ty1oa   nes;(0 rxmimpnydlme mnct t a2uaxmpno1tle mi3tltlm2umn s;t0trerif iadopteaieo;()trumir ou4al  liesat arta( poo0apeomieiysla2ua(msnt) rxomrcootomt lu s t) eurir3oo4ole mfesas a2rrx p;o1olx  iciadfmDrm( s t0 rxoir ootom elu ols) eurxm nydll emnvs t aDtm( pou1opx mo3tydlm umu p;u) lerxr io1op  aues s) eum(m io4opt  nvtlt arrru ont0opx mf3iytfs2ra(vo t4teerifciadfmDe u s;t) ruoxrpoo1open nesl(faDum(moou1tet mi3iytfa eauvsnt0artrir iy1opt  n sl(0t2urio3nodlptnlnetatfa2umu pot0apx iieilsfs ulnmp u0tltrif totfaDr nvsl(0 rtrimpoo1apte ics s aDtm(m nu0tlxo i3iys m2ulnms;u0 lermf3ia1opDeluvols  euoir3oodlmenlnvs tfaDrmxmoou1tpxnmi3tlsfa rlu s;(0trxoxr3oytlpDr i s;(  2uoirpnydlme  ivtls s2raxr ;o4tpeo o3tyt s ea( ont0 ltrmf3ia1oaDrlueo;s t2to(rpio1opeelivsls aDur(rpnt1opto i3iadfa2elumo;t4trerio iotlm e i ils0sexrio iu4om  lnvs () Dtmu oou4alxnioctad m2el( pnu)teenxrcoo1op   i o;(  rum(r3nudame  icia(fa2rmurooo4aeeo oetasfsDulnvs u4 ltnio3oatomD liei (0t2trxm3iydalt mieslsfa2ua( pot4ole mfetyslaDuanvo ()trtnmrcio1optr ieilt  exmio nodal elicsas  2rruro;u1tee ioeiadla elnvs;() ltoxr iy1lpD aiei;( s2tmirpno4al nmfct (farta( o;u1optnio3tatfm rmnmsn(0alerif totfmte ieo s  exrxmpiy1lm emncil()aDtrxr ou4aptoioetadlm eln pnt4 etnxr3tydlp  anvils) etoimpnydlp nmfetasfartmump;o4tpt ii3iad aDua(ms t0tleoir3tadfpDeluvo;t)tetmxm3nudome  ivilt artm(moot0oltomfciytfs2rmnvo u0aleniociy1lm elies;s)setmxo oydlltn ncias)artrx  nt0optoifetydla2ra( onu0arenxrciadfpDe nvs;(  2toio3nu4om n nct tfsDtr(  ;u0oeeo iciadls2el(vs;(4trenmr iodop eaieo;t0sruo(opio1al emfvsas)srururpou1aptomo3iys m2rlnvsn()alxrxr oatlatr ueils0 etm(opiodam e fvsasfsrraxr no0apx if3tadfsDran p;t)arxrir iatlmte ivs;t)trxm(m3iudopt lfvilsfs2tm(  ;t0aeen feilt m2um( p;u0texnmrcio1fpD lnvslt) rxm(m3no4am nmivs tfsDumurpou1olt iociyt m2rlnmsnt4 lxrifctodfa r ivsls seto(o3nu1llt  icsas)arra( ono1tlt  ociltfm2umnmonu4areoxf3iytom   u o;t sexrxm3nydol  lieslt) Drmum ;t1tpx  oeiyd m uan pn(4 leoxr3io1om ean sl()t2uoxopoodaptnmies t sDraur ;t4alenmfeild m2rm( s u4 ltnifcoatfmDrau i t t2xr(r3oudlmtnmnvi s  Dtrx poo1apto o3iaslm ulnvo;u4trerxrctydoa elu sls  eurxo oy4lmen nvslt)sDtrumpno0tetnii3iltfm ua(msn(0 leomr oadomt luvo s0trtrxm3iu4am  mfvsl()a2rmxrpoo4alto icild m2ua(ms t4teenir ta1lpD liei s0sexmxm iu4olt  feiat)srraur oo4oetoiietysfaDrmumo;(4aetoirctadfatrlieo;() eumxmpoy1lmtemnviat)aDtr(moot4opx ifeiytfa2uaumo;t4 leoir3oydlpDe ies;()srtrio3nu1optnmici ()srrmx  ot1apxoiociltfa2ea(vp;u0trerxr todopDelues t0seuoxo ou4lmt mncilt  Dur( ono1alxnio3tyd a umn p u) eeoif oo1oa rauvs s  exr(o iu4apeelictatf Dtmxr ;o4ape iiciatfsDumn p u) etomo3ia1lm rlieo;s0trxm(r3ny4lp n ietls)s2urxmp;o0ape iietyd mDumn sn()alxrmociadfm ean s s)t2um(m3nu1lp  mieias)arta( o;o1tpt micias a rau sn()trxrxrciy1lp  liei (  exmxm3nydlle lnvs ( sDurx  no1oeeomf3tlsfmDumnvsn() lenxf iodlmt anvil( sexoim3no4amtelnct () 2raxm nt0oltomieiyd a2ranms;u0 lxnif3tytlmte uvs;t0sexr(m3no1ale  fei t)srrrumo;t4opt  i3iaslsDrl( p;(0 etomociodfmte ivols)s2trxo io1lme lfet s)sDtm(rooo4ape mi3tadlm2eanmo (4aexnxf3tydlatrlu s t s2uoxm3iy1om e fvs s)arrau ooo1apxnifeiltlaDra( o u4 lxrmf iy1fpDrlivs t0 2umxmpnodopenmfeias  2rru pnt4aexoifciadfsDrmu o;()arerioctodfmt auvol( t2uo(opiy4ap nlncta()s2truroot1olenifeiatfm rln p;t4alerirctotfpDrauvol(0 2urxopoydam n nvsat)a2rrxroou0alx iieias aDrmu pn(0 rtnxf3oadfaDr nes;() exoiopiydaltemncs ()srur( pno0tltnifeiat m ul(mo;u4alxnxr3oatfpteli slt0texr(opoo4ole  iesl(fsDrru oot0tpt  fciyslsDemu s;(4 reoxfcoo1fa  au s;s) 2tmxmpnudam e fcils)sDua(ro;o0optnmfetltla um(mp t0aetoirctatfa  li s t)srtmir ny1lpen nvt (fs2uax p;u4apxnioctldfs rl(von(4 eerio3tadop r uvi;t0srxr(m3ou1lltn ietl( a2tr( pno1aee iocilt s2rm(vo u0tltoxr3todoaDrlueols s2trxrpno4ll  lfeilsfa2ur(m no0alt  oeiys sDumn p;()aeenxr tadfa   nvi t tetm(opiu1llt mfvia(fsDtmu  ou4opxn fetld s em( o;(4aeenxr3oo1lp eauvsl()trxrxr3ou4lpt liei (fsDtm( o;u0oltomictlslm2rlnmp u0 ltomf3tydlatrlueo s0 etmxopoydlm emiet t  rua(  ot1teenmociytlsDuln o u0trxnmo3oatoaD livi s0t2xm(opoodll  micias srtrum ou4opxniiciydfs2rlumpnu)altrmocoy1omt ai ilt sexmimpiy4oleelnvs ()artrumont1tleniiciyt aDeau ont0trxnifcoodfaDe u o ()srto(rpiu4ale  fes ()s2tmurpot1tle ifeiat a rmumpnt0areoxo ia1fm  auvs t0trumxrpnu4op n fetas arum(roou4apx mfeiadfm rl(ms u0teeoxo oodfptrluvo;s0t2umio3oo4ole mfciatfa2umxr ot0alx mieils aDrlumo t4 rxoxrcoodom e n il(0texmxr oy4amte fcta()s2urxm ou4aet moetatlmDua(vo (0trermrctodfmt ln s (0 2uo(m3iudapeelfct t)srraur ot0tex  oetydfsDraumonu0teeoxociadlmDrlnvilt)texrxr3oo1llte nesl()srra( oot4opxomo3iad a2em(mo t4arxrxf tydomD anesls  eurxr oo4lp emnvi t)srtr(rpnu0opxomi3ilt m elnvs t)teeoircoy1fmDr uvols0 etrim3ny1llenlfcsa(fa2uau o;o4apxoif3iatfm rln p;() rerxo3oadoaD aivo;t  eurxr oy4optemivs s)arrau p;o1tlxniociadfm rlu p () etnifctatlpDeanvsl(0 2tm(m3nydop nlivsasfartmxmooo4olxniieiytla2em(mp;(0areomo3iotlaDelnes (0t2tmxr oy1ll nlici t aDuaxrp;u1tpx mo3tys s2rmnmsnu) etrif3totomDr nvs t tetmio no4om  mnvt s sruax  nu4optniicias s el( o;t0 lerxf todop  aneols0 exrxmpiy1lpe licia()srtr(r nu4oet miciltlm ulumon(0aeeomf iydoa r uei;(0texo(o3iy1lme mncil() ruauroou4optnmoetatfm elnvsnu4trtoxr iatla raieol(  rto(m oy4lme lneia(fa2ta( pno0alx io3ilt a ra(mo ()artrio3tadla ranvils) rumir iu1lmt livslsfa2ua(mpnt4apxn i3iltlaDemu o (0texnxr todop r nvsl(  exrxr nu4ameemiei tf 2umxmpnu0tlt mieiasla2ua( p;(0aeermf tytfpDrlnvo t  euoio io1alt miet s)srtmurp;t1oee miciltfm rm( s t0aetoxrcoytfmt anvsl()seuoimpiodom   fvslt sDrmu  no1alt mociasla2eanvs;t4aeenif3iotomDe ivi s0seum(opiydalt lnes (  rumxmp;t0oetoifeiaslmDeln s;u0trtrxfcta1opteli ols t2um(opiy4lm  mfeils srtrxrpoo4tptn o3tyd mDuau o;u4tltnifciy1fmDrai sl() etmir ou4ol e fctas)a2uru pou1aexnioctydlm2emu p u)aetnmrciadfatr nvi;s0t2xmxmpny1llt licslt)sDtrx  ;o1opxnmf3iasls2ra(ms;t4 ltoxrciy1lateaiesls) 2tmiopiy4optemicils)aDtmumpnu4ope iociyt s2elumo;u)tetoxo oy1oatraiei;(0s2ur(rpny4al  mfciat sDtr(mpoo1aee mfetltfa ea(mp;u4 ltoir oodfa rln s t  eumxr ou4lm nmnctlt)sDrrum ;o4alt ii3tysla2ulnmo;(4 eenmfctadlmDe ueolt0 rxmio nu1ope  iesas)aDtrumpot4optoiiciad sDelnmont4 eenxf3iytom elnes (0trxrxopiudap  mnvsatfs2rmx pnt0tptn f3tatlaDean p t4 ltnio3oytop  lu slt  rxrxo3oo1opte iesa(  2taum oo0tetomieiysls2rlnvonu4aetomr3oatoatr n s t0sruo(rpiudolte fvt ()sruaxr ot1opx mocias sDeauvo;t4texnxr3iotlat an s ()teumxrpnydame  fcils a2rrxr ;o0aexoifeiysfm emnmont0aetrxo oatomDe n s t t2xo(m3iy1op emfvt t aDrrur nu1oetnmoeias m rmnmo;t0texrif3oo1lmtraues (0 rtoxo oudapenmnvsls) rur(  oo4oexniietltfs rlumsn(4 etomf oa1lm   uei t0s2trir iu4ope  fctls) 2ur(mo;u4aex iocils mDrm(vs;(4 ltrxrctatomD  n o ( srtm(o nu1op nlivilsf 2tr( p;o4aetomfciys m rln pnu4tltrxfcoa1om r neo;t)setr(o3nu1lltemivtls  Drrur ;t4tpe iietat m2rl(mont4aetrifcoodlpteln s;s)trurxo oo1ol e fvi tfaDuau oou1alxoii3tatfm emums t4 reomr3oytfpDraivsl(0t2tr(r3oy4amenlnvsl(  rtm( p;u1oee  fciasfa ea( o (0tetrir tatfm  lneo;()texrxr3nu4oltemfetat  2tax oot4tex  fctat a ua(vo (0 lxnif oatfpD luvs (0 etm(r oy1om emietat)arrr(m ;t0tlxoiietlsfs2umu o;(4 eenxr iytoptr uvo;s0 exrxr oo4olenmnesat) 2urxr ;t1aetomfciys a emnvpn() exnxo ia1faD aneil(  euoio oy1lle lnet s sDtaumono4tpe mfctlsfm2uauvsnt0altnifcta1faD aieil(0 ruoim iy4lpenlfes ()s2ua(ronu0texo ictys mDra( pn()arxrxo iatlp rlu o s)t2xrxm ou4lltnlnct t arumx o;t4olt  f3iltlm rm(vs;t4tlxnif tadom rlueo ()seur(opno4ameemivsas  2rrxm oo1olxnioeiys a elnmont) rxomr3iotlmDrluei ( t2umiopiy1opeelnvt tfa2ur(rpnu1aet  feils s2eaump;u0alxnmfcia1omtrau i;( s2xo(opno1lptemfeia()srtmump;o1alto ieiat s emumo;t4alxrir iydfptraivols setr(mpnudaptn nvt (f Dtm(m nt4ope mociyt aDranms u)trxomr todlp rln i;( s2tmxo ou1om nlncsl( srrrx pot4openmf3iadlsDua(vpnu0 etnmrcoatop   ivols setoiopno4ape  ivtltf Dur( pno0texoiieiasfm rl(mo;u4aeenio3oodomD ai i;t0tetoim io1ll  liesa(fsruaump;t0tptoiociydlmDuaumsn(4aexnif3ia1om rlnvilt0 rtm(o oy4llte nvtlt)srrmuronu1texnmfeiadfaDumnms (4tlenmr ootoatraneils0 exrimpnu4ame mict tfaDuaumooo4tpeoioetlt sDeau p u4tlxoio ta1la  luvsl() etmxmpnodolte ieta()aDrr(  nt0aleomf3tadla elu sn(4arerxf totopD luvs s  rxmxr3oo1lpte nct s srraumo;u1olenmf3tasfa el(vp;()aexrxo3oo1op elnvslt) 2xmxm iu4lp  lieilsfsDurxm ;t0tpxnmo3iytfm rm( s;(0 rtoirctotoaD luvo (0trurxrpno1oltelict s srtru  ot0optnmoctatlsDuluvs;u)trtrifcty1fa  lu i t)setr(r oydopeelneias) Drmx pnu4optnmi3iatfsDul(vpn()trermr oytoa rliei t) rxmxr iu4omt lnctasfsDtrx  ot0tlxoif3ils s rauvo;u) etnircoytfmtr ivs s t2tr(o iy4ameemnesl()aDrr( p;t4olt  f3iyd a2eau s t4arxnifcto1fa eaivsl()trxo(r3ou4ll nmncilt)srtax ono0tltomiciatfsDelnvpn()alerio iodfa elues;t trtmirpoy1open fesa()srum( pou1oetn fctasfs el(mpn() rxomfcta1fpt aueo;s)sexrxrpoy4ole mfci s artmxm ;t4texniociatfm2rl( s;(0artnxocio1oaDr nes;()t2tmio3io1op  lfesasfs2rr(r nu1open f3iysla ra(vs;t4trerif3oytfp  aueo t0 2xrxm iudal emncs t) rtaum ou1alxnmf3tydls eaumsnu0 ltoircoa1oaDe iei;(  2xmxrpiy4al n ivslt aDra(ro;t1apto ociytfm eau on()tltnxr3iatfpDeli o ()truoxm3oydlpte nvtl(f 2rruro;o0aeenifeildlsDemn pn(4trxnmr ia1laDe u o;t t2xmio3oudole  nei s)aDrax ooo4opxomo3iydla uanmp;t4aetniocoadfm elneolt  rurio3iu4lptnlicil(farta( ont0ope mf3tadfa rm( snu)aexnio iydoa r iesl(  rxm(rpoudoptnmnvil( srumxro;u4altnmf3tatlaDuln snu0artoif3oydlmDelies;t0srxrxopoo4llte fes ( sDua( onu1tlx iociys a2ra(mont4arxrmr3iytoa  lues ()trur(o oudamt mfeil( s2ta( oou1aleo iciat sDul(mp (0arenirctadoateln o t0teumio ou1ameelieil(f Duaxm oo0ape moetytls2em(ms ()tltrxo ta1fm   n i;(0teur(o3iy4optnlnvs (  Dtmumooo1tex miciadfs el( onu)trenmr3tydomtrlivolt0s2uoxm3iy1alte fcsatfartau  ou0teeo o3tatfa2ean s u0arxnmo3todoatelu s;s)seum(m3io1omt  fetls  2raxrpou4tptoifcilsfs2rmuvp (0 etnmr3oo1lmDrai s;s trumio3no4olee fviat srtau ont4oexo ieilt a2uln p;u)areoif oadlm rauvs;s tetmxo no1alenmfvilsfs2rr(mont1olx micilsla2rmuvs t) rxoxo iydlp eluvs;t  euoxr oo1apte ict ( arumxr ot0oleo ietld s rmump (0tetoio3todoptran il(0 2xoirpnu1al nmfeta()sDta(rpnt0oex miciatfsDemn o;u) ltomrctadfp r ivo;(0s2xmxr3no4openmnetlt srrrx pou0aeto f3tad s2ranvs t)alxnir3iotla ean o t) rtrxrpny4ap nmfctatf Drmxmo;t1aptoiociatlm umnmp u4 lxnxfciadfpDeln il( s2xoxopny1omtnlivil()sDtm(root4olxn i3ias s umn s;u0artrxr3oadlm raiei;(0t2uoxm nu4lmeelfctlsfaDtmx pno0tee mo3iytfa rm(mpnt4teermf tytfmtrluei s0 2xo(o3oudopte nvslt  2rr(mo;t0apx  i3iydla rlnmp t0aexnmr3tatlaD  i ilt)texo(mpnydomenmnctlt arumu o;o0olxnmieiasla eanmo;u)alxrxf oa1lm  ln i s  exr(m iu4op   fvsa(fs2trur nt1olx io3tatfsDrlnvont4aexrxf oytlmDrluvs t0s2xrim3no4ome lictl() rumx  nt4tlxn f3iat mDeauvo u)aetomf3io1lpD  nvs;s0 2xrxo oudllee ics s  2uaum ;t0alx  f3iltlaDrln snt)aeerircoa1lpt  u o s)teurio oy4oleelivsatf rtmxmpnu0tpenif3iys a ranvsnt)tetoxo iy1lmte n o (0texm(mpiy4ll emnei ( arra( p;u0tpeoiieiatlsDulu s;u0aetnxoctydfpte iei t  2xrim oo4lp nmivi s srumuronu4texomfetldfsDemn p;() etomf3oadlpt lieol( seurxopnu1amee fvtlsfs2trumono4olt  f3ildfs2eauvp;(4tlxriocootlaD lnvs;s  rxr(o3nydom nlivil( arrrxro;u4aex mictlt m eanms;t0arxoiocoydlptran i;t0truoxopiy4ame  ncsa(  Dum( pnt4tlx iiciadla2ran s t) rxnxr iytoa  aneo s0 2tm(m oo1apenmnvsltf 2tmurpot1oleoioctlt sDuan s (4 lerioctytop r iei;(0 etm(o3iu1ole lnesa(farrrurp;u0oeenmfeiad m2emu sn()tlxoxfcoatfmD  u ilt)srxoxm3nydal  mnvs ()aDrr(m oo4aptn o3iyd aDuaumpnu0aeerircootop eaiei;t0 eur(mpiy4ol e fvt t a2rr(rooo4opeomietytlmDel(vonu0artrmo oo1opDeaivs;t0srxmir3ny4lle mnvi sfa2taxrpno4olt  f3iysla2ua( p;t)aeenmf3io1lmte i ols srxoxr no4ol nmfes s a2uaxr nt4opt iiciadfm uln ont4tltnmociadoate nei ( s2xrir iudomt  icsl(fs2trxmp;o0olxoiocias s2emnvo t4alermocoa1om eai slt) etrir3iy4ll nlfcsltfa2ua( p;t4ole iiciytlm2umnmp (0trxrmo3iotla  ln o;s seumir nudopte net t  Dtaur nt0olto feiaslsDrmuvs () leoxrciatoa  aiei t0 2tmxm3oydomee icsl(farumxmpot1tlx  o3tydfaDeln s () etoxf3iodlmtrau s;s seum(opno1opeemivia( s2tmxr ou1tee  feiasfa2ulump t)aeeoifctotop r ivi;t)t2xmxo ny1amtn iei (  rraxrpot0apx  f3iasfs2um(vo;u4trxnxf io1oa r ieo t0 2uoirpiu4lltelicsat  2tax o;t0opt  i3iysfm uan p;(0 reoxfcoadlmDrlnvo t  2uoxmpnudaltn ncils)s2taxr nt1opt iiciad s2ulnmpn()aleriocoatoptean sl(  etmxrpiudomtnlicsl( arrrxm oo4oexomo3tadls2eaumsnu4 exoxo oo1fpDe i ils0trxoiopny1lpeelfcs tf Duaxmoot4oee iieiydls rl(vsn(4aeerifcoo1oaDeau o;t0s2uoxr oo1olenmieias aruaumpoo4oeen o3tatfsDuanvp;() ltnircoodfptr uvs;t sexr(m3nudlmt  ivils)sDrmxmpot1aexnif3iasfaDuln s;(0tleoxo3tydom e neol(0 exo(m oo1lpe lfvsl(fa2tmx  ;o0opxnio3iyt m ranmpnt0 exomr3to1oa e i ils s2toiopou4lmen fvt sfsDurum ot4opt  oeiasla rmu s;t0 lxnxr to1fm ranvi;() 2tr(r ny1am n nes s a2umu  no0altnioetyd m rm(vp t4 etnxoctytomDrlnes ( srtrxm nu1omenmivt ()a2tm(ro;t4tltoif3ild m2ean s;u0texoxocoodfm  lueo;t  rurxm oudaltnlfcsa(f Dumu onu4alxoifetyt a rlu s;u)altrio3oodfm eanvsls0trxoxo3iodop n fvtasfsDtax pot0oetomoetytls2ulnms t4 etrifcoatfm raivol()srxo(r ny1aptn nvslsf Duax p;t1apeniiciysls2raump;u)aetnmrctodla   n olt seto(rpou1alenlfcil(f 2rm( p;t4apx mi3iys m umumpnt)texrmo ootomDe ivi ()s2toio3iy4olt livsat  Duau  ;u0aee  i3iasfa2rl(ms t4trxrmo3tatlat aneo;(0srxm(r3iy4lp  lietls  ruru o;u4aee ifeilsfmDua( p;(0 ltomoctytfpt auvo (0texmxm3iodlp nlfcs ()s2tm(rpnt4ape iicild aDemn o;u0altoxr3oatfat  uesl(0t2toir3oodaltn feil()aDraxm oo1alx mf3tysfa2rmuvonu4artoxr3tydlate uvs;t)s2xo(m3no1om  miesls) Dururont4aexo i3tyt a2elnvp (4treoir3io1oa  lneo;()trur(m3iodlpenlivilsfs2rru  ot4olxn ietls a eau s t)artrxrcoo1fm ran il(0tetrxo3oy1omenmies s srtrx p;t1aeeomiciltla umumsnu0texomo3oydfm eanei;(0 rtmxmpoy1apeemivt ()sDtaxr ot1tlx  o3ildfa eanmo;t)aeeoioctatlate i o;( trumxopiudomee iesl( sDtr( onu0tetomoetyt s ean s t0 lermo ty1fpteanvi s)trum(opou4ameemicta(  2umx o;u1alto iciyd sDemuvp ()texomfciadfptelieo t)s2xoxmpiydal n ncsatf 2rr(r ot0oetomictldla eln p u4 renxf3tytop ran i (0 rurxo nodaltn fvils)srur(ro;o4oee ifctldfa ulnmp;u0alxrmfciatlp  aueo;s0srumim nydaleeliei tf Dumxm ;u0teenmf3iad mDul(vsnu4tltoxo oodlpDe ies;s sexo(opiu1ale mfei ()a2rm(rpnu0aleniieiyt m2rmump;u0 lermfciydfm eaies;t)trtrxo iu1altnmncia(fsDum(rpno4optn feiadls2rm( s u)trtnxo oydlmtrau o s srumirpio1ol nmnei () 2urumpnu1tlt ioeils m2ua( o;t4tlxrirciatoa r nvi s0trtm(o3iy1lle mnci tf rurx pot4oee moeiadlaDumn s t4aetrmfcoydfa   nei;t)s2xo(o3iy1omeemfcia()arumx  ;u4tlt mi3ildfmDua(vo;(0treomf totlatrlieil(0s2tmir ny1alte ieilsfa2ta( o;o0ope  i3tyt s2rlnmp;t0tetrioctotop r iei s)texoxm3no4lltnlictltfsDrrxmo;o4texn octad s2eanms;t0 eenmo iy1fat au s;s) exoxo3nu4amtnmfet s srtaumoou0tptn fctltfaDelnmo u) eenircoy1lpDr iei;()trxo(opiu4op n fvtlsf rtauro;u4oetoii3ilt s rmums u0altnir3iydoat auvs;( teto(r3ny4lmee nvs tfarrrurooo1opxomfeiad s2rln p;u0 eermocoa1lpDe uvs ( srurim3iodlptn ivt ( arrm( onu0tetn ieiytfm2rmn s u) lxoir ia1fm rlies t)srtmimpnu4alenmict t s2trumont0aee mf3iadlaDulnvo;t0 rxriocoodfmDr nesls  eurxm io4ll nlivslsfarrrxm nt0olx ifcilt m2ul(mo;t4aetoir ootlpt  uvilt0 2xmxmpio4op e iesa( aDrax  ;t4alt mictadfs2umn o;()tlxrmrcoa1om e iei;t srxrxr iu4op e fetls)aDtr(m no0oltniictaslm elnvpn(4trxoxr3ty1op elivi;s) exrim no1lm emnvta( s2tmxrp;t1tleo ociasfa rlnmpnu4teenir iytfmDeaueo t)seuoio3oudop  mfvtlsfarumuro;t4aeto f3ilslmDuln s u0tlerio iatopDrlu olt) 2toxo iydomenmnesat srtmu pnu4tex  i3tadfmDrlnvonu4 rtrir3oytfm  luei;(0 rxmxm nodlmt lncias srua(r ;o4opxo o3tysfa2rm( p;(4tlxrxf oa1lpt livsl(0trtrxm oy4lpe livtl( aDtr( p;t4tlxnio3ils aDemnms ()areomfctatfpDr nvi;t)trtrxr3ou1opt  ivi (fsrrrumooo1tet  i3ilsfm2rln p;u)aetnxrctodom eanvo t0 exmxm iy1omtn ncsa( srraxrpnu1opx  f3tysls2ran s u4tetnircoo1opt  u i;(0 rtoxrpnodopee netl( aDrrxront0aleniociasls2ua( p t)aeenmfcoy1lat  i s t trxr(r oy4ol e fvtlt  2uax o;u4tetn oeiys aDuanms u4 lxrxf3tydfm ranes;t  rtrim3oo1alen netl( artmurono0aexo oeils aDum(vs;t0tetrxr todlp  ai s;t0 2trim oy1lmt lnviltf rrmxr oo4tlxo fetltla uan s;u4trxnif3ty1om e u ols) etrir3iy4lmt  ivi t)s2rmxro;t0apxnmfctyt s rl( s t4trtrxfctotlm  lueo t0 etmimpoudome mnct t)sDrmuront1olenmoeiaslsDumump t0aeenif3oy1oa  li i (  etoimpnu1am  mncsl( aDtrxmonu0aleoiicilt a2eaumpnu0aeenxfctytlaD ln il(0trxm(o3ou1alee feiat  Dta(r ;u4tleomoeiyslm2ul(vsnt4tleoif3iadfm r ivs;(0truo(m3nudlpt miesltfsDtaur ou4olxomociatlaDelumpnt4 lxrmr3oydfmte ues t0s2xr(mpiy1ameelfct tfs2umxro;u4tetomocildfs ranmsn(0aeerxo3iodlateai s;t) rxmxr iodap   fct tfs2tmxr ;u1tlx moctldlaDeau s u4 etoiociy1lpt  ues (  eumxo io1lpt mnctas)s2tm(  nt1oltnioeiytfa2el(vp;u4altoif iydlmt  n s;t  2uo(m3oodlmee nvi t) 2urxmp;t4olxomfcias aDeluvpnt0 rtoxf3oo1lm r uvo (  exmxmpny1ap n feta(  rurur ;t0aeeomiciltfaDulnmont0arerxfcio1lptraies;s teuo(m3iudllt  ncia( s2urxro;o1aexo ietls s rauvpnu)arxnmo3oytfaDraneo;t)trur(o nu4oleelivtl(  Dtm(r no4aptoif3tlsfs ulnvs;u4tltnmf oa1lat lu ol( t2tm(mpoodam  lnei tf 2ra(rpou4tpe mfcias s2ua(mo ()artoxocio1oa  li o t0s2xr(r oo4lmt lfeiat  rrmuront4oee  fciysfaDel( p;()tetrmfctadoaDelies t)s2urxmpiu4ol  lici s srurxm ;u0tltomociysfs2ea( s;u0texrxf3tatoa elu i;()s2to(m io1lmee fvtlt s2trx p;t4texnmfeiyd a2rm( snt)artrio tydfaD liesls0t2xm(m3nydom n fcil()sDrmur nu4ole io3tatls rlnmo;t0 lenxo todfmD luvi t0 2urim oudolt mfetat aDtrxrp;u1ope  f3tlsfaDrl(vs u) eeomocty1fatelneilt0s2ur(o3nudlptnlnvs s)aDrrxr no1tpx ii3iyt aDrm(vo;u4trenmrcoadomDeaivsl()seuo(r nu4lpee nvtat)sDrr(rpoo0tet iieiys m2ean p;t0altnmrcoadfm ran s t) rtoirpiu4llt  fcsl()s2um( p;t0olto o3tytls2eauvp ()arxoir ootlm raueo (  rto(r ny1lm e ictl()artm(mont1opt  oeias aDrm(vo;u0tlerifcto1lmte n o s0trurio3ou1alt lnei t)s2umuronu1olxnmfeiadls rl( p;u0arerxf oatoa  aiei ()trtm(mpiy4lpt  icsltf 2tr( o;u0olx  f3iadfmDel(mon(0trxrmo ootop ean o;t teuoxm ny1al nlnes tf Duaurp;u4tle ii3ild sDul(vsn(4tleoifciotoatr nvsl(0 euoxr3iydopeelictatfsrtmxr nu4tetn iciytlm ra(vs t4trtrmfctytfpDeanvs;s0 2uo(rpnudopt mneilt arta(mpou0aeen oeilt mDrauvs;u0arenio3iy1oaDrluvs;(0t2uo(m3ny1lmeemiei sfsrrrumpno4opeoioctatla2eln snt)artrxf ty1lptrlieslt)trxmxm3iodllenmiesls sDrmu pnt1tpeoiociys mDua(vpnu) rtrio3oydomDe u s s0 rxrirpny1amte ies tf Drrumo;u4ope  fctatls2uln onu)tltnircoo1fp  ln ils0t2tm(o3oudalee ictls) 2um( pot4open feils aDrl(mpnu4areniocto1fm r neo t)texo(opnu4lm emivta(  rtrxmp;u1apxn o3iyt aDuaumonu)alermr oydomt  neo s) rto(mpnydam n ictat)srrau poo1teeniocilsfmDea( s;u) leoirciotlm elivo t srurio3oy1ole mnei s aDuaxro;u4oee moetasfa uan on(4aetrxo3iydlpD anvo;t0 rxm(o3ou1lle lfvsls)artru o;t1aeeoio3ias a rmnms;u4tetoxf iatlaDelueol() 2tmxm no1am n ict tfaDtmumpou1oeeoiieiasfs2ul( snu4 eenifcoodlatrlieo;t0seuoxo3oo1lm elnvil(f 2umx ooo4tpxn i3iydfa2em(vs;t0 eerxo tydfa rlnvi ( t2tmxr oodom nlieiat srrmxmpoo0oeenmo3tyd a2elnmonu4arxrmoctydlmtr ueo ()truoxo3oy1llenlici t s2trurpnu4apxo f3iyt mDranmpn(4tlxnif3tytfpDe ivo;t s2urxm3oudop e neiat sDuau p;u4oex moeiaslaDulu o;u)tlerxf3iotoptrli olt)t2xm(rpiy4am e iet () Dtrx onu4teeoiietad a ra(msnu4 rxrxr ty1fmt an o t s2uoir iodaltnlnviltfs2rmumoot1tlx iiciysfs2rl( o (0 ltrir iy1fpt an o s trxmxmpoodom nmiesls  Draxrpoo0optnioeilsfa ulnvo;(0aexoxociydfptrln o (0trumxmpiy4lp emnct ( arurumoot1oltnmfctasfa2emums t4aetnifciytfpte neil(0srto(m3no4omtnmnvtl( a2tru p;t4aetn ictltls2emu pnu0trxrifcoa1fmt ln o t trxr(o3iy1am n ivt sfaDtaxro;t0tpx mo3ildfm2eln o u4 lenmf iydoptrauvi;t0 2tmimpno4al emfesas) rrr( p;t0alenmiciadfa2ra(msn()tltrxr3oatlmte i s t)trumxr no4altemnvilsfs2rax o;t4teeo oeiysfsDelu p;u0 rtoxo3oatom rauvo;s)s2xr(o3oo4al elncs s arra(rpot4oet mi3tltfs uaumont0 rxnmfcia1lmD liesl() rtrxo iudlmtn fvsatfa2ur(ronu4aet mfeiatfs rl(ms;t) reomf tydomDr nvi;( tetrxopiu1oltelnetlt  rra(  ;u4teeomo3iyt m2emu s () ltoxrcoy1faD  uvs ( t2um(mpny4lmeelivta( a2ururooo1alxnmo3tysfs umnvs u4tltrioctadlat lnvs;t0srumio nu4alen ieia()a2tax pou1aetoifciasla um(vs;(4 reoiocta1oaDeauvsl( trtr(mpiodll nmfesa( sDtrxmo;t4ape mieiydfmDumuvs;t4trtoxf3tatom rliesl(  rtoim nydll  lfcta(f 2uaurooo1oee  octydla2rmn pn()alxrxf3tatlp   u olt s2umxo oy1op  mnetas)arumxm ou1aexo oetat aDuanvp;() lxoxf3to1lptrlu s;(0 2tmxm iydlp nmnct t)aruaxroou4tltomieilt a2rlump;()arerxocoy1oa raneil() exrxr no4op nmfviasfaDtrxmonu1alenmi3iytfs2uln s;()altrxo tadfat lnvsl() 2uo(m iy1apte iviatf Dtmx  nu0olx  o3ias aDuluvs u) etrmrcoytla r ueol( sexoxo3no4am e nciltf 2ua( p;o0aee mociltls2rm(vpn() rxoiocoytlmD  iei s)teum(o iy4ll  lieia(  2trurpoo0tlx if3iyd m2emnvonu) renmf totopDeaiei s  2urio no1omenmnetatf 2trx oou4opxnifcilt m rl(vp t4artnircoa1lp eaueils) rtoxr3no1lmtn ieiat aruaxmpnt1olxomociasfs ul( s t4tltoiocoa1opt anvo;(0 2xmxm no1apenlfesatf Dua(r ou4olx  fcilsfmDuauvpnt) exrirctydopt auvols) etm(o oo4om nmnesas)s2umu oou4olenioctld s2ra(mp;t4texomr3oydfa raneslt0sexr(o iodap nmfvs s) rum(rpot1olxn i3iytfm2um(vo;t4alenif3io1lateanvil(0truoir nodop nmietl(fsrrrx  nu1aee mfctat s ea( s;t4 rxrmr ootfpteai o;(  2trxm3io1ol elivsa(f 2um( poo1altnifctatla2rlums u0 eerif3iy1la   nvolt s2uo(rpou1ol e ieta()s2rmurono1alxomfetytlmDeanvsnu)texnio3oy1lat livo;s0s2xrim no4lmeemictls)arumuront4tlenmfetas aDrlnvsnu0 rxrif tatlmD aueilt0t2uoxm3ou1omenlicsas) rtmx  ;o1aeenifeiys a elu p t4alenircoatoptr uvils0trur(m3ny1om  mnvsat aDrm(rpoo1apt  ociyt aDel(mpnt4aetoxrctodfmD luesl()s2toir3io1ap e ncs tf Dtmurpno1openmfetld sDea(vp;t4aexnmr3oatlaDe u ol( srtmir ny4lmtnlfesls arurxm no1oltomfciadfm2ul( pnu)tlxoir tydfp raiesls0 eumxm ny1om n nctls  Dtrumo;t4opxoifctldls umn o;t) rtnmr3iatfatelnes s  rxr(rpoy4amt  feil(fartrumpnt4oetn fciydls2ul( o t)aleoir3ta1fp  li s s0teuoimpiy4am nmics t)a2rrx pot4olx mfeiytfa2ua(msnt) eeoxociotlp r u i;(  euoxm iydlmte nei () 2ur(mo;u1tlenioeiltlm emu pnt0 eenio iy1oatraivs;s seuoim3no1lp n ivslt s2uaumoot1tlen ictldfmDemuvp;(4 etrmr oo1fmD aivo;(0 ruoxrpio1op elncilt s2trxr ou0altnmi3ilslsDemnmsnt)aexnxrcoo1op   i sl() rurxr nu4amte nvils) Dtrxront1altnioetld a2eaumo;u4 rxniocoa1omDr ivi;( srxmxmpoo1llee iesls)s2taum nt0olxomo3tydls2rluvs ()tetnxf3iodlatrauvol(0 rtmirpoodlmee ncs t aDraum ;o0tlx mi3tltfaDrluvo t0altrmocta1fp elnei;()seumirpiydoltemfei t) Drr( pnt1aexniicils mDulnms u)altoxo oadomD aivi ()srto(r ny1lp  liviat srumxroot4aee ii3tadfsDem(vp;t0trxoif3ootlp  aivs t)texmxopoo1optn nci s  Drr(  ;t0tlenmf3iytfa em(vs;u0trenifcootfmD  nvil(0 2umio oodame  nvtls artrxm ;u1opeo i3iltfsDul(mpn(4trermr3oy1laDr nvsl()setrxr iu4apenlfvta( artaxr nu0tlxnmiciydlaDra(monu)trxrmociadoa eaivsl( seurxopio4op  mivsl(  2rax onu1olxomfctadlaDul(vo (0trtnmo3ty1lmt au o;t0t2umimpny4apt mnct (faDua( o;o0olx if3iaslaDrln p u4alxoxr3todop r neol()seuoio oo1ll  lnviasf 2urumont4tpx mfctyslaDrl( p;(0tetomocoa1oat ai s;t)s2um(o ou1ap nmfvtatfsDrmum ;u4oetnmf3iat a2eluvs;t4 ltoiocoadfp eai ilt0seurxo no1llee fvt s srta(m ou0tltomietltfa rl(vs t0 rxrir iatfa rau sls)srxoxr iy1lme  icsasfaDurxrono4aptn ociyt a2uaump u4treoirctatoptraueil( texoxrpiu4lmt  nes () rua(mooo1tpxoif3ilslmDrmnms u0tlxoirciatfateau s t  rtrim3oudop  miesas)s2trumont4tltn fciad sDul( sn(0altrmf iatfmtr uvslt  rxrir ny1lpte fci () ruaumont1oexo i3iysfaDra(msnu) etnmf iotfa ranvi;s)trtr(r nudom n ncslt  Duau  ou0olt  ietasfa2ul(vsnu0arenio3ty1laD lneols)trtr(r3ny4amee nvil(fsDumxrpno4open feiytlmDum(mo u)teeomf3tatfatr neo;s)s2uo(m oodam  livias  rrrxm ;u0tleo octyt s ulnvo;t4trenxf3iy1laD  nvilt0t2xo(r3iy1olenmfvsas sDumumpou4tleomf3ildla ul( on()tleoxo oatfmtrluvi t0trxoxm io1alee ncsasfa2tr(mpno4tpto i3iydfs ua(mo;() lxnxrctodfmDe i i;t0texm(m3no4lltnlfcsat arraurp;u0tleomi3ils a2rmn s;()tltoio3oatoa  luvo;t0texoxo oo1ll elivt (f 2tru  nu0aeen i3tysfs2rmnmont4trxnxfcto1opD  neo ( tetrxr3nodap nlnvtl()s2truro;u1ope  o3iasls2umnvo;()teenxf to1optrliesls0srxmio3ou4lleelfctatfs2ua(rpou4tlenmi3tldfm2eanvs t) ltoxf oydlpDrlu ilt s2tmio3io4apenlfciat srtmx poo1ape ifciys s elu s;t4tltrxrcia1lateluvi;t)tetmxm3iydom nlies sfs2tmur no0olenmoeiltla ul( s;u0trxriocoatlp  auvs s truoxo3io4amenlnes t  Dururpou4aex mi3tatla rmn sn()tlenxo3iytfm rauvi s s2toim3iydoltelivsat)a2rmxrpoo1aeen ictydls2umn p u) rxomf3oadfpt aivo s)t2urio3oudomt mfvsls  2rmxmpnu0aex mf3ilsls2rlnmonu) ltrmf3oadoaD  nvi ()tetr(mpnydomt  ies ()sDtm( ono4tpx  o3tat aDra(vpnu0alxnxo iatom e ueolt s2tr(m ou4ome  nesasf rum(mo;u4aleniieiydfaDem(vp;u)trtnmo tadopte ivi ()trxrxm nydamtn ict t)srrmu pot1tetnif3tyslaDrluvsnt) eenxr oo1fptrai o t) rur(r3ou4op nlnet t aDtr(r ou0aee mfeiatlsDeln sn(0 rtnxr iotlmtr n o (0 ruoxopnu4opeemivi sfaDrm(mont4aeeoioetysfsDuau o u)tetoirctadlm rau slt0trtrxr3iudomt  icslt s2tau  oo0oexo fcilslmDran s u0aetrxfcoydoa eli sl( s2xriopiudoltn nci sfs2urxr ot0oexo ieiadla uanvp t)alerio3tytfmt  uvo;t t2xmim io4ll n fcsls sDraxm nt0ole iieiasfs em(mp (0arxnxr3to1lm  au slt)s2trxm3iy4ll nmivsl()s2taxmpot1oeeomiciytfmDrl(vo;t)aeenmo ia1oaD luvo s)t2uoxo oodal   fes tf Dtr(mp;u0opxomiciys sDum(vsnt)tlxnxocoy1fpteli s;( t2tm(o3nydaltnlivsl(  Durxmo;u0apto oeiltfs rmnmpnu4aetnif to1lmt lu ils sexrxr3iudope mfvtlsfartr(  oo1tltomf3iatfa2rau p () lxrxo3tatopt  nvs;(  2urim oodomte ivsas aDtrumpnu4tptnio3tysla uaumon(0 rxnxfciytfm rau ols trurir3iy1lpe  fcil(fsDrmuroot1opt  i3iad m2rmn p u)artnir3iydlm rln i t)tetoxo nudameelfet t)sDraxmpno0alto ocias m2ean p u0arenmo3iy1fptrli olt) 2xmimpny4lpe liei sf Dur(rpnu0tlenmieiys s2umu snt4 rtnmr oodfpDelu i s0 2toxrpoo4ope miciat a2ua(ro;u0tpxnmiciydls2ulu ont4 ltrxo oy1lmteln s s  2xrxr oydoltnmnet s a2taxmp;u4oleoioctyt a2el(mont0artrmf3iotfm ran ilt) exm(opnu1ap   nci (fa2rrxmono4apt  ictysls rauvo;(4teenmf3todoat  ivolt  2umimpoy1ll nmicil()s2raxm oo4aex moetytls rm(ms t4 rtnxr3ia1fpt  ues t)s2toirpoudlm n fei sf rra( onu4aleomfetlsfm rmnvo;u)tlxrifcto1latean o;t t2ur(o3iu1omeemfei t)a2umumpnu0openiictlt s2umn sn()arxrmrciatfatrluvols0teum(rpio4ol emies tfaDurxro;o4ope mocils s2um(vsn() etoifctodfmtr u i;(  2xmir ny1lpee fcta(fsDrau  no1oltomiciad a2rl(mo;u0artrxo oodoaD anvo t s2tm(opoo1lmtnmfcsa()a2tr(r ou0tpt  f3tat a rmnvo t4teeoio to1fat livo;s)trxoim3oydomte fcs sf Draumo;t4alxomi3ildfa2um(vs;(0tlxnmo oydfaDrln s;s0 rtoxr3nu1lpe  ncs ()s2rax pnt0apxnmictys m ra(vo;u) rtrmo3io1opteluvs s)t2umir oudaltelncsatfs2rmxrpot4tptoio3tytlmDumnvpnu)aeenxo3tadlmt aueils0tetoxrpno4lleemfcilsfs2urx  oo4olxomo3iltlm2um( o;u4 lxrmr oy1lp rai olt0trxmxr3nu4alte nctlt arrmum ou1tet  fetas a2ulnmo;t0 lxomo tydfmD ln s s) 2umxo no4am nmict sf 2umxm oo1oeenmicilsfs2ul(msnt0 leomrcootfmDeaueslt trxoimpno1lmeelnvsas a2trumoot4aeenmieildla2ea(vp;t)areomr ta1omtrai s;( seuo(m3io4apte ietl()a2tmumonu0opxn icilt a2uauvs u4alxnxfctadomtrai i;s)srto(m oo4lpe lnctat)a2ra(mpot0oex mi3iltlm uln o u) rxnmrcta1fpteau o s) ruo(opiy4ape mnesl()srur(rpno4aeeo oeiadls2ean o t0tltoio iodlptraivils)sexrimpiodam eliviatfartau pno4tlxn f3tld sDemnvsn(4arxrir3iodfmtelnvolt)trtr(rpio4llenmfcsas)srrmum nu1ape mf3iytfm ean o u4 rtriocoytopD auvolt t2umir3io1am elncsltfsrtax  ou4tlxo fctydfs uluvo;()areoirctadla r neo s)s2tmirpiu1omtn ietlsf Dtmx p;t1olt  fetlt m rmnvp ()tetoif oadla r nvslt)setoio nu1lptemneia(  Duaxmp;u4apxoiieiytla rlnvs u4 leomo3totfmDraivs;t0s2xoim3nu1lpenlfvias sDumxr oo0tee mo3tatlmDrmnvsn(4 etnxo3iadfate ivo;s) euo(m3ny4am nlnvi t sDrmx ont1aeeo icilsla em(monu4altomr todopD lnei;s  2tmxr no4oleemncsas s2um(mont1oltoif3iysfs2ul(vo t0arxoirctydfa rlnvo () etoim oodlptn fvi ()sDta(mpot4oetn o3iysls2umn p;(4trtomo ta1faDr iei;() etm(r no4lltelfvi (  Duau  ot1tlx ii3tyd m2uaums u0 renxrcoy1omtr uvol( truoio iy1ap  lieslt artrxm oo4tpeoioetadfa2uanvpnt4artrir3ia1lpDr nes;t) 2uo(rpou4omeemfvil()sruaxmpot1olt  f3iytfm uluvp (0aeeomo3to1fa elu i (0trumxo3iodomt lnetasfs2rr(r nu4alxnmicilsfs ua(vsnu) rxrxo iotfaDeaivslt)setmxo3iodlmte iei t aruru o;u4oleomfcilsls ean p;() ltnir iadomtrau ol(0texmxo ny1amt lfcsasf Drm( p;o4tlx iieiatlm2ea( s;t0aexrmrcoatopD luei s t2xrir3nu1lme mfctatf Dtau pou1opxo o3iltfaDran s;u4texnxfctotlmD lnei;(0srto(o oodalt livs tfartaur ou0optn fcias a emnms t)teerxf3iotlm  auvils  2umim3ou4omen nvs (  Dtm(r nt0opx iiciltlm ua(vp;(4 lxnifcia1lm rlnvo;s tetoim iodllt licil(f Dtrxr nu4aetnmictlsfm ran pnu0trxoiocio1fa  auvol()texr(mpoy1opt lfesat)s2uau pnu4tpxomo3iaslaDra(vs;t0aleoxr3oatfp rli i;s t2umir io1ale mivil(fs2tau pnu4tlto i3ildfmDua( o t4aexoxo3iatlp r nvo;s  rumiopio4omtn nctls srtau p;u0oeen fciydls2ra(vp u0artrxfcio1omDr nes s) ruo(rpoydamtemfei tfa2rr(mp;o0apxnmicilsfmDran p;u0aeermfciy1lm eauvslt)seurxr oo4amenmnet t  rrru oou0oetoio3iltls2rmnmpnt0arenmo3oo1fpDe ivs;s0srtrim nu4lp nlnvi t) Drrxr ;u0aleomfetysfm2eaumo t)tltrmf3iotomD ai s s)s2uo(m3oo1ame lfei (fa2ta(m ;o1apx ioeiatfm umuvs;t0 exrxr ia1om rlu i t0 2xo(m no1lpe  nviasf Drrumooo1apxniietydlm emuvs;(4tetrmo oa1lmD lies;s0 2toirpoudlptemnei ( srumx o;o1olto feiadfm2rlumsnt) ltnif oydomt li s;t) rto(o oo1open fet ()s2ra(mono1tpxo fciat m ranmp (4 rxnmr tydfm elieils t2to(o iodllt  ictasf 2tr(rpnu1tpxnifetlsfm2ra(vp;u4teermf3iy1lpte nvo s trxo(opoy1ol nmfcs sfsDuru pno1aeeomfeilslmDuln p u4alxoxocto1fm rlnvi t0srumxo iodlmen nvsls sDuru ono0alx  o3tyt a2el( p t)aeenir3tadoa   u o (0s2umimpoo4omeelfesat)srrmx ont0tet  iciatfsDumu pnu4altrmoctotfm ranvo;s0 rur(m3nydom elnvsls) rua(r nt4oex ii3tlsfm2rln o t0texrio3oa1fa e u o ( srxrio oudaltelicil() rtr(  ;t1aee  o3iyslmDrl( o u0alxrif oo1fate n i;s) 2tm(mpou1omtnlfvta(fsrrr(mooo4tpx ifeiad sDrm(ms t)tltrxo3oytlmDelnes;t)s2to(r io4omt  ivi t  rtmumono4tpeniictlsfs2umn s t0 exomoctotopteau il(  rum(r3no4omee fct (f 2trx  oo1tlt  oeiydfs eau on(4treomfcoa1lpD ai o s)s2xo(r3nu1amtnlieia(farrm(m oo4teen ieiydlaDuauvo;t0texomf oo1optran i t0texoxrpiudlpt micsas  2um(ro;u0teen o3iytfa2ea( s;t0 reomfciytfaD  i o;t)teuoirpno1altn ictl( arrmxr ou4oetnmociytlm elnvp;(0teenxfctadla rai s (0 exr(m ou4am n feilsfartaxm ot0olt ifcild s ulnvont0altrioctydlaD luvs t0t2xmimpio4oleemieta(  Dtru  ;o0oetn fciytfm umnvs;t4 lermrcootom r nvs s)t2tm(o iu1op nmfet tfa2rmxro;t0opt ifciltlm2elnmo u4 leoirctotfate nvsl() rtmxm iu4oltnmfetltfs2ta(mo;u4apxoio3tad a rl(mo;() ltniocta1oa   u slt0tetrio3ou1lltemivtl(  Drrx  nt4aptnio3iadla2emnvonu4tetnir iydlm ran slt  rtmir ou1aptemfct s) Drmurono0opeoiieilt a uauvpnt0arxoxo3to1fpD li s;() eur(o nudamteliesat)arua(mp;u1tptn ietydfaDum(mo;(0trerxfcoa1laDrlivs ( setm(m3ny4ope  ncil(  Dtaxront1tlxo f3ilsfa2elu s t)arxnxo todfm   nesls tetmirpiudolen ies sfs2tmxm no4tlto ociys sDea(msnt0altnmo ootomDraueo s  2tm(m3oo4lpte iet tfs2ururp;t4opeomf3iltfm2rm(vo ()tltrio3ootlaDelieilt0 2tmxopnu4ll n nci sf rtrx pnu0aexniociadfm2em(vo;(0 eenxfcta1latraivslt)t2uo(r ou1lp nlncs t srurxrpot4apenif3tlslsDranmsn() eeoxfcta1op rluvo s0t2tmxrpoo1lmenmnes ()srta(r no0optn fetadfa2el(vp;t0aetoxo3iotlmtelivol( srtrir3oo4lmenmfvias)s2ua(  nu0optn f3ilt aDemnvon(4 ltnmo oytoa  anvs;t t2um(opiu1op e fvsasf rrm(m ;u4tpx io3iatlmDrl(mp;t)aetnmr iotfmD anvi;(  2trxm iu4lltnlneiat s2tr( oot1oleomf3ils a2rmu ont0 exoxo3iytop eai o t0srtm(rpno1omtnmfes s)artrxroou4oltomfeiadls rmnmon(0artnxociydlmDrluvsls0t2tm(r oydamee icsl(f Durx onu1aptoifctaslaDean ont4 ltnxrcoatfpDr uvo t0 2trxr3oo4lp nmfvtltfsrtrum no4oee iiciysfaDeaums (0tlenxo tadlaD lnes;( trtmxmpiydlpeemivtat  ruax pou1olen ictad s ulnms;u0treoxf3io1fmtrauvs t0tetrim iy4amtemfet t)a2ururpou1tpeomieilt aDrlnvo;u)arerifcoatlaDeli i (0trurir3ou1altnmfetlt  2ua(mpoo4aeeomfeiys mDranmo u4trxnmo3oa1lp  lueo;s tetrxm3nodam nlnctat)artaurooo0tet mieiasls2emn onu) lermfctydfateau o;()s2tr(r3iydlleemicsls aDrrx  nu0tpeo ieiyd m umuvo (4tlxrifcty1op   i s;s trxr(o oodome lfci (fsDtrump;o0tltoiictat s2rmu s u4 lxrmo oo1omD  neol(0sruoim3iydlmt livtltfa2tmu p;o0tpxo iciysfs rmn onu4 ltrmf to1la rlies ( trumxo3oydamtnmnvilt  Durx ooo1ope ifctlslaDra(vs t)tlenif3ta1latrlnvi s0 exr(r3nu4om emfvt tfsrumur ;o4opt mfcilt s uanvpn() etoxr iydlpDrlies s trtrirpnu4alt  fei tfa2tm(mpnu1aexniieiys s2em(msn(0trenmo oatoptelnes;t)seto(opiy4opt  nvsas)a2um(monu0olxnmfeildfmDeln sn(4 lxnmr ty1opDr neilt0 etoiopoudlpee nvi () ruauro;o0tpxn i3iltfmDul(mp;u) eeoxo3oatfmtraiei ()s2um(opoy1ap elicsltfa2tmu ooo0tex  o3tas mDeluvo;(0 etoxo3iadoa  aieo;s srtoim iy1ap nlivt () rtauro;o1tee  o3tas a2rlnms (4areomoctatfp rauesl(  eur(o oy4lpt lfetat arraxrono0aptnmocildfa2raump (0trenmf oydlpDe iei;s0s2trxo no1opee fes ()arrrump;u0olxo feiltfa2emnvp;(4tlxoifcia1optelivo s0srurxo ou4ll nmivilt)s2tr(rpnt1oee  f3iatfa2ra( snu4trtrioctydfa  aueolt0truoxo3ou1lm nmnctlt)arraxmo;u4tetoio3ilsls2ul(msn(4texriocoa1lmt  neo t) rxrir nodlp n fci sfarra(rono0aleo feias a2um( pn(0aexriocoa1oa  au s;t0 2xrxm3ny4opte nvi s) Dur(r ;u0opxniociasfa ua( s;t)artnxrcoytfat li ol(0 2um(opny1lpeemfeta()aDtrurpno0aleoiocilslmDea(mp;()aexrmocty1opDe uvi s0t2xoxm nydop n iesltf rtrxrp;u4tpx  i3tatlmDelnvont0trxnxr tytlm e i ol( srtoimpiu1lltnmnes tf 2um(rp;o4olt ifciad mDem(vp;u4tetomociotlat anvi s) 2xoxmpiydlle mfctas)sDtru  ;o1tee mfcildfa2ranvs;u)teenio3tytoaDr nvol( srtr(r3nu4lp eliciat  2rrxr ;t0tee  feiad s ean ont0aetnxr3oo1lpteau s ()s2uo(m3oo1altnmnci (f rrrxr nu0alt if3ilsfm rau o;() etrirciytoa rlu i ( s2xmxr iu1olt  nciatfartmxm ot1tetoio3tld a2umnmo t4tltnxr iydlmt aivs s srtmimpiy4ale mncil( a2urxm ;t0tpxoiictadfmDul(mon() ltrxrctadfa e i ols)t2toim3no4olenliei (  2ua(m ;o1tpx  f3ildfaDum(vp (0tlxoir3oydlmDrln s t)s2xr(rpny4aptemiviat)srrrur nt0tpt  f3ils sDem(vs;t0trtnmfciodomDe nvo s0 eto(r iu4lpte fesat) 2rau p;u1opx  oetysfa2emu o;(0trxnxr iydlm e neol() rto(mpoydomt lncs sfarta(r ot0tpx  i3tys a2uaumo t0tlenxrciadoateai i t)t2tmio3iu1am  micsat)aDtau  ;t4opx ifciysfs2ulumpnu4 rxnmo oodlatr ivilt setrxmpnudal n fctasfsDtr(rpot1opx ifcildlsDrlu s u0 etomfctytfmt ln i;t  rtr(r oy4alt mncils)s2raxm ot4oleoioeiys sDuaumonu) eeomf3oodfa ean sls0t2xoim3io1lme  fvs tfs2trum ;o0tpx ioeilsls2umnvp t4 lxrxf ootlat anvs ( tetr(mpou4lm  mfcsltfa2rru  nu4texo o3iatfm2umu s;(0alerxr tytfm e ieol()srumxrpny4llee fesa(fs2rm(rpot1oeeomociytfaDul(vs t)treoxoctotoa  aueo s)s2uo(o nydom  lnvia()a2ur(root4tpxnif3iys sDemu p (4tetnxrciydopt  uvils0texrir no1ll n ietl( s2umumont1apeoiiciltla2rluvp t0 eeomr3iotlmDe uvs;s texmxo ou4op e feias) rur(rpnu0opx  i3tatls2umnvont4tlxrio iytlm ranvo (0tetmxo iydlltnmnct (faDumuroou4alt  o3iltfm2rmnmon(0aexrxo3ootomDelnvi;s t2xm(mpiy4lptnlfcta(f rurx  ;u4tpxn iciasfsDea(vp;(0teenmr3oadla rauvilt0srxrim3iydale lfcs t) Dum(r ;t4tpxoifeiltla2rmums t) ltrxf3iatfmteanvi ()sexmim3no1ll nmfei tf 2ua( onu0apt  fciltlsDum(mo ()artrmo todfptr ivi;()seurxmpiudop   fcs s  Duax onu1tetomi3iasfsDelnvp;u4trermf oa1oate u sl(0 2xmxo no4lm e fvsa()artr( ooo4alxomociysls uauvsnu4trerxoctytoa raueil( seurir3nydlmt  neias)a2rmx o;o1opto fciadfa elnmpn(4areoir3ta1oa  lu olt)t2trxrpoy4ol   neiatfsDtaxro;u0tlenioctyd s2uan p (4 etomf3tytlptran i t)trxmim iy1lm n nvt (faDua(mpnt0aetn o3tlsfa2ran o;u0aetnxfcta1opD luei s)srxoiopiodoltnmfvi (f rtaum ;t4oee moetytlaDrmu o;t4 lermf3ootomDraieo s0srumirpio4op  lfviatfs2tmxmpno0texoioctasla2rm( p;(4 eeoir iytfpDrauvo;t)srurim3ou1lptnmnet (fa2rrx o;u4aee mfciytfs umu pnt0artnir3oo1fp e i i;t t2xrir nodop e fct s sDtr( o;t4tet if3ils a2eanmp t4altomo oydop rlnvi s)s2toxo iu4omt lnesls) rrr( oot1apx  octldfsDuauvo;u)tetnmfcoo1latraivsl()setrimpny1apt mfctls srur(rp;t0apxniiciytfs rau s t0arxoif iadomtrluei s0t2ur(opnudlptn nctlt aDua( poo0apeoio3tytfs2uan pnt0tetoxo to1fa rlnvs;t s2xmxo no4omeelfei (  rtrx pot0altn f3iytls rln s u4arxnmr iodla   n sl(  etoiopoy1ap  mfvsls s2uaxr ;u1aeenioctyslm uau s t)trenmf tytlp r u i t s2xm(o io1al nmivi s)aDtaurpot1apxomiciytfmDelump;u0tltoxr oodfaDrauvs;t tetrxm3iu4lm nmfesl( srurxronu4aee  octysla2um(mp u) ltrmo iadfmDraies (0teurxr ny1al  mfesltf rrrumont0openii3tldlm ra(ms t)aleoircoatomt lneo ()seto(m3nydole  iciatfaDrmx oou0altniicilslm2ulnvo t4arxrmo tadoptrluei;()t2xr(o3iu1omtn ici ()a2tr(rp;t4olenio3tasla2uanvp;u4alxoxf oy1fmtrlnvsls  etm(r3iu1omenmnvtat)aDrax oot1opxn fctytfs em(vo () lxnio iy1laD aueo;t srtmxr3io4aptnlivt s s2ur(r ou4aptomieiatfmDrl( pn(4aeeomr3io1fpDrlivi t)trtm(r iudomt mnvsa(f 2ta(roou0alxoioeiadls eanms (4artnxf3ty1fpDr ueo t0 rurxm3io4am   fcsa(fs2truroot1opeoifciys s2uln pn(4tlxomrctatfp ran o;t)texrxm io1ameemivs sf Dra(mooo1aptn f3tltlsDuanmo;(4 exrir3totoa elnei s0t2xr(r3iy1lpt liesa(  rur(mont0tleoifeiyd s2rauvs;(4arxrmo ta1op   nvilt sexm(rpio4amenlncia() 2ur( pou1openiietadfaDuluvs;t) rerxr tytfa   n ilt s2xrxmpnudaptnlneia(fa2trxro;u0aexoifetldla umnms u0arxnio3oadoate n sl(0tetrio oy1open ivs sfa2rrxmo;t0tpxnif3tltfsDra(mpnt)artrif oytfm r i i t0srumxm3ou1oltnlnesas  Dtax pnu0ope ifeiat m ea( pn(4altnio3todoaDr uvs t)trxrxo3oy4ape  fesls  2uaur no0aeenmfetasla2rl( s ()arxrio3oadfmtraivols  rxrxopnu4aptelnvt s arumxr nu4tpeoiiciyslm rmuvpnt0artnxr iydomDeaneil(0 eurxrpny1am elnci s)srua(ronu0olx mi3tls a rlnvpn() eerio3oatfp e ivilt tetoim3ny4altn ivi (farua(m ;u0tlenio3iytla2eaump u4 etoxo oy1om rau ols sexrir3nudal   fesa(fa2tr(r nu4olt mfeiysls rlnmo t4 rxomf oo1omtraivs s0trumxrpno4aleemneta()sDtmumonu0oee  i3iat s2ul(vs;t0 rtnmoctadfa rlueo;(  2umxo nudlptemictls) rraxr nu1optn feiaslm2umuvo t0teenif3oo1oate i o;s srtr(r3oy1llt mfeiat)aDtaxmoot0olt iociadfs2emnms;u4artrxrcoytfateln i s0 exmxm no1olt mivsat)artrx ont0aetniiciydla2elnmont0alerir3oytfm rlneo t0t2umim3oo4lmt  fcia( s2rmxmooo4aptnifciysfa2eln pn(4 reomocoatla  ai o ( sexoxr3oo1optelnvsls) Dtm(mo;u0aexo f3iltlaDrlumpnt4trenxo3iydfpDr ueilt0 ruo(r3nodol elfet tfs2raxr ou4altn oeiltfs2em(ms u0teermfcoatfa   neolt)t2uoxr no1lm  lics (f 2rrxmono1tpen f3tat m rluvonu0texnif3oo1oa ranvilt) 2tr(o oydom nmiciltfs2urxrp;t1ale mociltfaDulu snu4aleoxoctadoaD auvs t  etoxo nydaptemiet t) Dur(mp;o0altomfciatfs um(vs;u0texomociodomDe i ils0seuo(r nodap n fesa( a2rmur nt4oltnmo3tldla2eau s;t0 exrmr oadomtrlues (  rtoxr3oo1lm   ietls)a2rmxrono4apxniiciytfaDuauvp (4teeomf3ta1fp  auesl()trurxopnudolen nvil(fsDuaump;o1texomf3iat aDemnvp;t0trenxocoydfm eaueo (  rtoimpiudome  nctlt srtrurpno0texo i3iasfm ra(ms;u4teenif3oadfmt ai s s0teuo(r3oo4lpt  net s  Dtmxrpou0open fciys s2elnmo;()tlenir3oatfmtr ieo s0trumir nydlm  lnei s arrr(mont1aptoifeiadlm umu p;() rxrirciodlmteauvolt0 2um(m iydlmen iet () Dtrxr oo0ape iieildla rlu pn(4artnir3iydoat aies () rtmxmpoy1op nlfci tf Dtmxroot1oexo ociatls2eau ont4tetomr3iy1lmt ln il(0sexriopiu1open nei t) Draxro;u4apxn ociyslsDum( p t0 ltrmf3iodfa   ues t seto(rpiu1altnmfvi (  2trxroou1apxnmietltfm2eanmsnu0 reomrctatlaDe nesls0tetr(rpno1lp  lics s)a2rmum ;u1alenioetltlm emuvo ()teenif oodlaD  nvol(0s2trimpiudamte nct ()srur(mpot1tltnmo3iltfm2em(mpn()tltnxf iodfmteaivslt srtrxm oy1lle mfcilt a2rrxmp;o0tptnif3iyt m rmn onu0tltnmf tadoat ai o s)teurio io1lp n nvs ( a2tr(mpot0oex  fcias aDea(mp;u)tetrifcoy1fmD lu s;t0 rxmio oodapeelieia(  2ra(mo;u4tlxo f3iat sDuauvo;u)arxrioctatopDrau sl( trtoxr oodllt liet (  2tmuronu0oexo fctlslm2uluvo u) rtnmo iadfm ranei;t  2ur(m nu4oltnmivilsfsrta(ro;o1tpenmfctyslaDuaums;u4 rxomf3todfmtelneo t0 ruoir ny1apenlicilsfaDumxmp;u0tlxniietyd mDemnms;(0 exnxo3iadlm   nvi () 2xo(mpiodope  ivils)a2um(r no1oeenmo3iyt m2emnmsnt4 ltnio oodom elies ()t2umir no4llenlfci t) 2rax onu0aee io3tldfsDraump (4trermo3to1fmtrlnei;s0 rxm(o3no4alte fes t srrrx pnu0alxomi3iydfmDuau p;(4arxrif3oy1omD luei s0 rxoxopoy1omenmncil( sDur(rp;t0ope io3iadla emnvo ()artrirctadlm elivolt  2umxm nu1ll emfvtasf rururpnu1aee  i3iytlmDrmums u0tetrmo3oodopDr ueo;s) 2uoir3nu4ope mfci t s2tmx  ;o4aee iociytfs ul( sn()altomo3tydlat liei;()t2xrirpio1alte ieil()sDuaum no0alx mietat s2ul( o;t4 ltnmf iotlat  nvi;t trurxmpoo1lltelnvils)sDum(mo;u0alenifetldfmDran o (4 rtnmrcootomte i ol() etmir3ny4lp  lnei s)sDrr(mo;u1texomociysfm2ulumo (4tlxomfcty1fpDr iei ( s2uoxr3oudamtn ieias  Duaxr oo4ope  f3iltls eanvo u4trtnio tatomDrlnvil(0texoio3oydaptnmfet t)srraur nt1tex  oetldla2umu s;(4artoifcoydlpt  nvolt texrio3iy4ap e icta()aDrrxrp;o1optoifctlsfs2rm(vs;(4 rxoio3ia1oa   i s;s0texo(opoo1ape liei t)artm(ront0aptomietltlmDrm(vs t0 rtrmr3totomtelneo t0t2tr(mpiy4al nlfetas artr(r ot1ape  iciasls rl(vo t) exnmo iotlmte ivi ()s2xmxm oudlm   fct sf rtr(mo;u0opt mi3ils m rl(vo;t0 lxrmr totfaD aneslt0trxriopiudomtemfctls artm(ro;o1texomo3ilt a2rl( ont4 etnio3todfmDelivs;(0 exmxo oodopee ietas) 2urx  oo4altnmfcias mDrmn ont0arxrio3oodopDeaueol(0 2xo(m3nudlleemncsls  Drm(rpou4tptnmfeiat m2uluvpnt)aetrmocia1la  liei (  2ur(m iodope  fcs ()sDumxm nu4oetnmi3iysfmDeaumsn() rxnir ia1laD livo s) rtrir3iu1ol emnctas a2urx poo0aleo ociltfaDel( p u4texrmr3io1lmteaneils)trtm(o3iudapt lfvs sfsrrr( o;u1tee ioetld sDrl(vp u)treoioctytlmDr ieol()srtriopio1omtelfviatfsrraxm nt0aeenio3ild a2rmnvo u0 etoif tydomDr u s (0 rtoxr iodlmtemiet t) 2rm(m oo1tptomiciatls2ulnms;u4 etnmr3ootomDrlnvsl(0trxoiopoy4optelfvsl(f Drm( p;u0optnifeilt s eanmsnu)texnmo ta1fp   ies t)s2umxr3iudam emivt t a2ta(m ;t0opxo oeiys s ranmp;t0 eenifcio1fpD  ueo;s0t2xoirpoy1ole  nvi ()srrau  no4texn o3tltfm2rlumpnu)aetnxf iodomD li s;(0tetmxopoo4om nlieiatfaDrrxmooo1olxoif3tytfm ul( p u)areomr3tydoaD lnvils sruoim no4llte ncsa() 2tmxr no1openifetysfs2ua(mp u)tetnmo3oy1lpDr nvi s) rumxmpnydom emicia(fs2tmuronu0tpenmieiadla ranvs;u0 exomo3oydfa r i o;()t2xo(r3oy4lpee iesl()a2rm(mpnt0olxn o3tad a2rl(mp;t4texnxo iydomte ueil(0sexoio3ou1lm e ivils) rumumo;u1teeoif3tldfs elnvs u0 rtrxfcty1faDrai ils)srxmxm3oy4lme  fesa( a2rrxmo;u4apx  ociydfmDrmnmsnu) rxrmrcoadop   uvslt0 eurxopoy1ll   nvtasf Drau pnt1apenifctls s raums;(0 ltrxocoadlptrln o s0srurxr nydol  
\ No newline at end of file
@@ -0,0 +1 @@
+ieo t) rxrir no4ll nlncs (f rtru p;t4oex mictys s ea(mp (0 rtnmo3io1fmDelivilt)sexm(m no4oltemfvs t)s2umu  ot4tee ioeiaslm2rmnvon(4 ltomocoy1lmDr n s;t t2toxo3ny4lmenlfcta()aDuaxm nt1aptnmf3tld m ua(mpnu0teermfctytfa rlies;t  exmxo oy4lp e fvias)aDtaum nu1apx  fctysfm2rm(vs t4 exnmr3iodoaD  n s (0s2tmim3nu4amenlnct t aDumxr ;o1tlt iocilsls2rln p (0trxomrcoodop elnvolt  exo(o3nudll nmfesasf Dum(mpot1aet moeiadlmDrm( o t)tlxoxo oytfptrlueo;t)srxmirpoodom nmieslt a2rru pou4oetn i3tyt a rmump (0trtnmr to1lpDr neils0 rxmxmpiodale mictls)srtm(mp;t4oexo ieilslsDeanmpnu0altnmrcoydoptrlneo s) rxoim3nodameemnvs tfsDurx ooo0olx  fciltlaDea(mo t) lenmf ootoa raiesl(  eur(r3no4lmee net tf Dua(mpno1tlen ictldfmDra(mpnt)tltrif iy1lp ean s ( truoxmpou1llee nciat s2ua(mo;u4apxoif3iyd s ua( snu4altrifcia1omD  nvs t  2uo(m iu1ll n fes ( a2umump;o4oexn fciad sDul( o;()tlerifcta1lpDr ivo;s0s2tm(o3io1lmtelfcias  Dta( o;t1apxn f3ilslsDra( o u0texrir oa1oatrlu i;s t2xoim nodlmen nctl(f rumx o;t1alx mieiyd s2rmums;(0 lxrmo ta1fpDrlieolt  2xm(opou1apt  nctat  rtmu  nu0ope iociydfsDumnvpnu) ltnxr totlpt an s (0seumir3nudlleemneias)sDtrxroot0aptomf3iatlmDuan s t)tltnmr3iydopD  nvil()srur(o3nudllt mfvslt a2raur ;o1tpe  f3tls mDulu snt4aexoxo to1omDeaueslt0seum(m3oo4oleemivtatf rur(m nt1tleomoetldfsDum(von(0aexnmfciadopDeliei (0trxm(mpiu1aleelfvt t)s2rau  nt4apx  oetys m2em(ms u4altrmf totfmtrau ols  2xrxmpnodamen ies ()srta(rpot0tex iictld m2uln o;t0trxrmfciadomDeai ils  2ur(m3oudopenlnctls sDraxmpoo1tetn feiydfa2ulumsnu0 ltrmfctotopDrlu i;t t2xrirpiudoltnmnvs sfsDtr(rp;t1tlxoii3iyd m ra(vpnu4 lxnif3ootlatr uvi ()sexmir iydlm emictl()a2trx  ;u1aee  o3iydlaDrlumpnu)tetriocoy1laDean o s0 rxmim3iudap elieiltf rtmxront1opxnioetyt m ea( s (0tlxnmrcoadlmteln o () exoio io1ol n net tf rrrurp;o4alxo fcilslaDuau o;(0 exrmf iydfa  au i () 2xoim oy4amee fvi t) Dtaumoou4tpt mieilsfsDua(vonu4tleoir oo1fm  ai sl( trxmimpoodamtnlfcsasf 2um(ro;o4oetnioeiydfm2emumo;(4 rxnxociadlm ranes t0trurxmpno4lpee nci s) Drmu p;o4oltoifctasfs umnvo u0texomf ty1faDeauei s)srtoxmpou4lmt mfeilsf 2taumpoo0tpeomictltls ranmo;u) leoio3todom  li o t0srtrxrpny4om nmfvia(faDrmxmono4opx io3iltfm2ul(vo;t) etrifctotoatrlueo ()t2um(m oy1omt  iciltf rra(m ot1apeomf3iadls rm( s t4aeerif3iytlpte n s t)seumirpiu1al e nes tf rrrxro;u0opto f3iysfsDrm(vpnu4 lxrmfcootfmD ln o t0sruo(opoy1omt mneiat)a2taxmonu0olx mi3tld a um(ms (0altoir3to1oateaues s texr(o oodll   fviltf Duru  ;o0oeenmocias s ulnmo t)teermfcoa1lp   ivi t t2xo(o ny4oleelnvtas) Drm( o;u4tpe miciltfaDemump t)alenir3tadlaDraivslt0trxrirpiy1ll  lnvsl(f Dum(rpnt1teeniocilt a emn p ()arxnmr ootlmt li ols s2urir3nu4op elfvtat aDtr(ronu0opt ii3iatlm rm(ms;t0 eenio ootfmD anvi () exr(o3iu4lmeelfvt sfartmump;u4ope mf3ildlaDemnvont0aeenxf3iodlpDraivo;()setriopnudll emnvsl(fartaum ;u1tpx  ociysfmDuanvo u) lxnir3oo1fmtrlneo s0srtoiopnu1ll elnct sfartmu pou4opxnmf3ias s2umn p (4tetnmr3io1fpDr ieo s trxoxo3oo4apenmfesls aDrmxroot4oee  fctldfm2elnmp ()arxrxr tadlateanesl(0 exrim3iu1lpeemnei ()srum(  ;t1aet if3tysfaDelu onu)alenir tydoptrlivs s  rumir nodlmenlnvtltf Drax poo1oeeo f3iys s elu p u4 eerxo3tadop  auvi;s)seuoxr io4oltn ncta(fs2rmu poo0tlx moeiyt s ra(ms () reriocoa1om r uei s texoir3no4amen net ( srtm(  ;t0tlt ifciydlaDeau p;()artrmr3ia1opD  uvs;s0t2urxo nodaleelnesasfsruaxrp;o0oeenifctyd mDra(monu)texnxrciotoaD livo t)texr(mpoudomenmneil(  Dtmxrp;o4oee iictlsfa um(vonu4alerxfcoy1omtrln olt seuoim no4alee fcilt)arta(moou0tptn fcias m2ranvsnt0arxrxo3iy1om rlivs;( s2xmxrpiodapen ivtl() Draxmo;u0alxo i3iltlsDemu snt4treoif iotoa elu s ()srtoir3oy1oltemnvslsfaDrrurpnu1apxomoctyt sDrauvon(0areoxf3oy1lpDelneil()s2xr(o oo1llen nvsa( arrmurpno4ape ii3iysls ea(ms t) rxnxr3oytoaDrauvs s0 rtrxr nu4lmtnmiesatfartaur no4aexoii3iysfm elumpnu4 leomo3iytoa rlivils)srtoxm3oy4al n fci ( arrrxro;u1tlxomiciytfm ul(vs ()aetoif tatomDe n s;s tetmxr io4lpte iesa( s2uaxm ot4aptnmiciasls2ran s;(4 eeoxf iydlm rlivs;s)srtm(m3iydamtn ncs s) 2rm(mo;u1aeeoiiciytlm2em( ont4 rxoxo tatfpteau i;t  2toxm oy1lltn fvilt)srtr(  ;u4apt iociatls um(mon(4 rxomrcoodfp  aivsls0s2xm(o iodolte feil(fs2uaur nt4tetoii3tldfm2umuvs;u)treoir tydoaDe ues s)trxo(mpoy4lmenmfvt ( arrr(m no4tet ifciasls rlnvon(0alxnmr iy1faDranvi s0 etr(rpny4aptnmiesltfa2rmxmono0aleoifctas m2ua(mp;t0tltriocoa1faD  nvi;s0s2ur(m3iu1ome mietls aDta(rpot1olxn oeiltfa um(mpnu)tetoif3ootop eli o;t0t2trxr oy4am   nei t a2rr( ooo1olxoii3ild sDulumont)artrxfciotomD  ies s  ruo(mpiu1oltn neslt)a2raxmono1oet  oeiyt a rlnmo u) rtoio3oo1fmt  n slt trxo(r3no4lmeeliei tf Duaxrpnu1aetnioeiatlm elumonu) etrxf3tatfmtr uei (0setmxo oo1lp e ieiasfaDrm(mont4aetn ieiyd m2umu s;t0aexnxrctodfmD luei;s)srtrimpou1lp nmivt sfsrtmu p;u1aee mfciatla2uaums;t0tlxrmf tadlpt  ivs;s0 rumxm no1alt  nciltfsrra(r ;u4tee  ieiys mDrl(vp;(0 etnir3tydlmt lueo;() 2xo(o3oo1apeemfciltfs2ra(mpoo0olen i3tlslm2ulnvp;t)tetnxr3iadfa  au ols0s2tr(o3oydlp emies ()a2tau poo0apt mieiltfa elnvp;u4tetrif ia1fmt  ivils  rtmxm iy4lptelfctl(  2ta(m ot1tpx  o3tlt s rln o u0arerif3oy1lptrlivslt) 2xrimpio1lm nmnvtatf 2um(mo;t1aetnmfetadlsDuanmpnu)aexrir3totomteanei t0seum(o oudll   ict t) 2umx oou0opx iieilslaDulnvs u4texnxf to1fpDrlnvs;( teurim3no4amtemivtatf rrm(mpnt4alxnmiciyt mDul(vs;()arenio to1lp elneils0 2uoio io1openlfctl( aDtaumpno4olen fctyt aDrlump ()aexoifcio1fmt lu o ()t2um(o nydom  liet tfarraxr ;o0tlxnmoeias s ulumo;t4aetoxo3tatopt luvols sexrio3ny4lpt lfetatfaDrm(m ;o4tlx iictasfsDua(ms u)alenio iy1fpDraues;t srxriopiydap n ivsa(fsDraxrooo4aptn ieiat mDelnvp ()artoxfcio1fp eau s t  2xoir nu4opt miciltfs2trx o;t0apenmociltlaDulnvs u4 rtrmf3ootopDean ols0 2xo(m oudapte fcsa( a2rmu pno4tleniociltfaDrluvpnt4altrifcoa1oa e uvslt0teto(rpio1al  mnci tf 2rrurp;t4aexn feils mDeanvpnu) lxoxr3tydlm r u sls  etr(mpoo1ope  neslt)aDurxmooo0tee iiciyd m2rl( s;(0trenxf3totoatr ueslt t2xrio nydll nlnvi s s2trxrooo1aet  fciydfsDumnms;(4teeomoctodfmtr nes s) rtoxm3nydome lnctasfa2tmu  ot1aptnmo3tys s ul(vpnu4aetoxfciytfmDeli il()t2toiopoydoleelnvi t)arumx pno0oex mi3iyd m2um( s;t4teenmr iadfpt ln slt0 2xm(m3no4oltnmnetlt  Drmxrp;t1olenmo3ilt s2eaums t0tlxomf3iotfpDr ieo t texmxo nydap e ivi () rur(rpou0tee  oetldlm2eau pn(0 rxrxr3iodopDr u s;(0setm(opiudamtemict t s2tm(ronu0tlx mfeiytlmDrmnms t)trxrmf oa1fmteau il()seum(mpoy1lltelneiat srrau pnt0tpxnmieiysfaDum( pnu) rermf todlm   nvo;()texmxm3nodoltemieta(fa2trxrpnt1texnifciadfm2ul(msnt0tltnxr to1omDrlnvi s)s2toim3iydal nmfcsls  2ur(root0tlxnmfeiat s2eaums t)artnifcoadfat ln ol( t2xoiopou1optnlncslt) 2umxmpoo1opx mietltfs2rmn pn()trxrmf oydlpt  nvo t)srxo(o oo4alenmicsas aDtax  no4olx ioeiat sDul( p u0 etrxfcoadfmte u s;t s2xrimpou1oltelncs tfaDrru pnt1oltn octat a em(vo;u0aeenmrcoydfa elnvo s)t2toxm nu4opt livsa(fa2trxm ot0tetoii3tlt sDel(vo (0teeomrciadfptr ies (0s2toirpoy4ol   netlt)srurx  no0alto feiydlsDemn p;(4teeoio3iotfa elieo;s)teto(o3nu4llt  nesa( sDua(ront0aeenif3ils m2raumon(4aexrmf oy1fpteln olt) exmim3nodlmeemfvtasf Dta(r ;t4optoii3tysfa umn o;u4tetrmf3tatoa eanei;t  rumimpio4lp nmfctas) rtrxro;o0alxn iciadfm ul(ms ()tltrifctytlpD an il() rxmxopiu4lptn fci s  2tauro;o1ale mictad s ul( pnt0 ltomo to1oate nvilt0t2urxo3oudamt  fcilt)a2ur( poo4olxnmoeiatla2emuvo;t4altrxfciytomDe nei;t)s2xrxr iydlle lfciltf rtm( pno1teeniociytfm ran snt)tetnmo3tatfp r ies;s)srxoxm io1ame lics sfaDuaumo;u4ale ii3tyd a ranms;u0aeeoir3ia1fa rauvo;t)t2xo(opnu4alt  icsl(fs2um(rpno4apen f3tls sDel(monu4 leomf oytlptrau i t  exm(rpno1op nliesl(fa2taxm oo0olxnioeilslm ul(mp;t) rtoxo3ia1op r u o;() rxo(o3iodllt lnetas aDrmxrpou0alxniociadfs2rm( pnt4tltnxo3oy1lmtrlnes (0sexmxmpiudam n fcta( arurxm ou1aetomicild s elnmo;(4trxnxr3tydoa   ivs t0 rxr(r3ny1lmt mfciatfsrurumpou0oee  octasfsDra(mont) rtnmr3io1opDr ieol(0teuoxmpio1om n nesltfsrur(rpno0oex  feiysfa2rmn o;(4arenir oadoptrlueo ( seuo(rpnudamte ict ( s2uaumo;o4tlxnmoeiasfs2ranmp u0 rtrxo oodomt  ivo;s)s2tm(m iodolenmncia() Duaxmpoo4apeniieiad sDem(vpnt)tlermfcoa1fpDelnesl(0 eurxrpnodaltnmnvt sf Duaxmpnt1oee iociydls2um( s t0tlxnmf3iadfp   n s;s)s2xoxr iydlpe lnctasfarua( o;u1tptoif3tytlmDumumo ()arenxrctatoat anvi t0 ruoxo3iu1lmt  ivsas a2tmurpno1tpx ioeiaslmDean ont0tetnmfctotoa rau s s0 eumimpny1olt mnvslsfaDtaurp;o0tle ioctlt m2rlnmon()tlerxr3iotlat li o;s0trxo(m ou4opeelncs (fsrua(r ;t0oeeomictasfsDrln p;u4trtrmr3oodoa r n o;s0s2xmiopiu4lmt lfvtlt) 2rax o;o0tptomfcias sDeanmpnu4tlxomo3iy1fa rai o s  etm(r3no4olt  ivsls) 2urxrpno0opt ifctlsfsDemnmp;u)alxomrciydom  au o;s0texoxr iu4lle  fcilsf Dtmu  ;o0ape ii3iad m2ul( s;() rtoxr oa1lm e uvo t srxmim3oodoleemfes ()arumum ou0tpxoii3tas mDem(vs t0trerif iodomt lu i s0 2tm(opny4lpen netas)sDrm(rpot0alxo ieilsfa uluvsnt4trxnmf ty1om ranei s)texm(r iy1aptnlietlt  rumxm ;t1oeen o3iasfa ra(vp t) rxomfciodfm e i sl() rxmxo nu1ame mfctlt) rraum ou1oeeo i3tltlaDraumo;u) reomr iatlaDeli o;s0srxo(r3oodol n neia(faDta(rpno0aexnio3ils s em( s u) reoxo oy1oatelu i t0srxmio3oydolenmfcsls)aDta(rpou0ole micildlaDrmu s;()teeomo tytlmDr ueo (0 eto(r3ny4om nmnvi ( a2rm(rpnt4openmfeiydfs2ranmsnt4artnxr3tytfat  u i s0 exo(o iydll e ncs (fs2ra(monu1oeen ieiadfmDua(mp u4trxomfcoy1omD  iesls  2xmxo3ny4ll  mivias  2tm( onu0apx  ictas mDumnmp;t)aeeomo oytlmD lueols trxo(mpoudlmtn iesl(f Drrur no1tleo i3tlsfsDuau p t0arxoir3ootlm  luvo;t)srumir iudaptelneias  2um(r no4apt mf3tlslsDrlu p;u) exnmfcty1lpD livilt s2trxopoy1alen ivsltf 2um(rpoo0tpto ictas m2elu o;u) rxoxfcia1lmt auei s  exm(m3oy4opeemfet t  ruau p;o1tex mf3ildfa2el(mo ()teeoxr oytfmDeai i;(0 2xo(m io4amt mfctlt  2urx  ;t0tetoifciltfmDea(mpnu0aeermo tydlatrliei;(  eum(o nu1ol  livta(f 2umxrono0apxnmo3tas aDean o t0aetrxrctatop  ai s;s truoim ou1ole mfeil() Dtaumpot1tex  ociyt m2uaumsnu4trenxf3oydfmtelnei;t0 etrio oudapeelfvs t) rum(mooo1texnmi3tas a2umuvonu)alerif3oodom   ueo (0 2tmxrpoodome lfvtlt aDta( ono4alxomf3tldlm rauvpnt4aleoxo3iydlmtr u olt)tetoir3iudlmt  ieia(faDtm(moou1texnioeildfm2rln s;u)trenir3tydfpt auvs;t seuriopoudal   ieia(  Dtax ono0optn feiytfsDean p;(0 eeomo oa1fmDraieolt t2toir3no1lp emiei s arrr(m ;t4tle  ieiyslmDea(vp t4artnio iy1oaDr nvi;t)trxmiopiu1lmte fesas) rtrxrpnu1ale mi3tldfm2uln o (0 leoif3iatlp  luei ( srxmimpnu1lpeelnctat aDrmxr ;o0oexnio3tltfm2raump ()aeermo oytopDe i olt) euoxm oo1altnmieilt)aDtmxmo;t4tptomfeildfmDrl(ms;(4arxnmf3iytoaD lieslt  2xmxm3iudalenlivtlt) Drmu onu1tlxo ietldla umu s u)aeermo tadfptrli o t)srtrim3nydlltn icias  2rm( pot1oleoioeiatlsDum(mo ()arenmf iydopD luvi ()s2toxo oydolen ici t)arumu p;u0tetn i3ildfa2el( s;u0texoxr ta1fpDr nvslt)setoxm oodlp emnci s  Dtrum ;o1tltomi3tltfa ul(ms t)altnirciydop  lies;t)tetrxm nydalt livias)a2umurpoo4olx mfctlsla2umu o;t4 rtrxo3iotopDrlivi s  2uoxopoydamt  fet t s2ta(rpou0aet mi3iad s2um( s u4trxriociodomteli il()sexmxm3oodop e netlt arrr(rp;t1tltoiiciadla2rl(mo u0trtrifciodlaD au i s0 euoxo nodaptn iesat  rur( oou0oleniiciat a2rm( s (4trtoio todfaD  iei ()srtm(mpnu4omtnlieiat) Drruro;o4texomf3tld a ua(mo;()trxnmf tydopD anes;s)texmxrpnodoltelnvs (f 2rr(m oo4apeomociadfmDra(vp;u)alerxf ty1lp e ivo;(0texr(rpiu1lpt  ies t aDuaxmpoo1oexoio3tlslsDua(vp;(0alerxrcto1la raiei;s s2xr(o iu1optelfei () rrru pnu4aptn oeilsfs ua( s;(4 eenir3totlmteli olt0 rxmio oo4olenlnetasf Dtruront0tlt  ictaslm rauvsn(0 exnirctatla   u ols) rum(r3iydlmen ivsl( a2rmxr ot0alxomfeildla2ulu p t4trtnxociatlpteai ilt) rtmxopiudaltn ics () Duau  nu1openmfeiltfs ra( o t4aexoxf iodoateluvils) eto(opny4amt  iviat a2ururpou1apxnmi3ilslsDrlu p t)aeenio3io1fatrlu i t0tetmimpiu4olt mivils artaxronu0tlt mf3ilslaDel(mo (4altnmo3oatom   n o;()srxoxopiy1op   fesls)sDtaxront1aeenifetlsla emumsn()tltrxo3tadfpD an s;t0 2tmir3nu1lm   neslt) rta(rpno1tpt  fetatfaDrauvs;t4aetnxrcoadlp rlneo;s s2tr(rpiu4llt lict ()sDtm( pnu1oex  fctadfm rmumont0 eeomrctotfaD  ivils) etm(m3nu4lpeelnct tfarra(ront0olt mf3ilsfm2rmuvp u) rtnif iy1oaDelnvo;( sexm(r oudope  netlsf rrm(mp;t4ole  ictltlm2emumo t4teeoir iytfptrlivi s0 rxoio oudol  lfetl(f Drmxroou4altomieildfaDeln pnu)trenxo ootlmt  n i;()srurxmpiy1llt miei ()a2ra(rpoo1tptnioeiyt a ulnmpnu0tetrxfcoydoaD an il(  2umim io4amen icsasfsrraum nt1ole mfciatlm uauvonu)aeenmr iodfpDeluvo (0t2tr(o3ou4lle livtl(fs2tm( onu0alenmoctls m2em(mp u)artoxf iatlaDe n s;( srtoxmpnudll n fvil(f Drmxr nt0oetnifeiytfm uluvsnu0artrio oydfpteanvslt) rur(m oy1optnlfeilsfa2umx o;t4aeeo oeiltfm elums;t0 rermf oadla rai i;t)t2urxo3oudlltelnetas  rur(ronu0altnmieiadlsDeaumo (0 eermociadoaDe n i;t)t2tmxm iudamenlnvilt)srur(rpno4aeto fctyd s2rm(vp;(4 exoxfcoa1lm rlnes (0trtrxmpiudaltnmnvtlt srurx  no4tetnmietyslsDrlnmpnu4trxrmfcty1omtelies t0s2xmim3oodapt liviatfsrua(r nt1tpt if3tatlsDrmump;t0aeenmr3iydlp  auvols t2xr(rpnodop elfcsatfarrau p;t1opeoiociys sDul( o;t) ltnmfciatlptranvo;s)seuoxo3nu1am elicsltfarrm(rpoo4tltomictad m eau snt)trtrmo3iadlpDeauvol()srurxm iudom  micsa( srur( oot1optniociad s2eln s u)aetnxr3tytfp eli sl(0 rxoxm iydol  mivsl(farur(ronu1oleo fetad m ea(msn(4trtoxocoadoaDe iei t0s2trxm3ou1lp  mfet tfarumxmo;u1oleomicias m2eluvon() rtnir3tadom rau ils)trto(r io4om  mnvtasfaDtmuro;u4tlto fetadlm2rlnmp;u0alxrmf3todfptrlu i;( trtrim io1amtn ict (  Dum(r no0apxnifeiatla umuvon(0alxrmr oytoptelneils) rurir3iodope lfvt ()arrmur nu4tpe moeiadfmDeln snt0alxnxo3tytoptelivs;t t2urxrpnu4lp nmfetlt) 2rmx o;u1tltoifciydlmDrlnmo;()arxnxf3oydfptrlieo ()trtmxo no1ap emicsasfs2taxm ;u0olxoioetad sDeanmp;t4aeeoif todom   n sl(0setmxmpnudap n net ()srua( ono1tlxoifctld sDemumo u0trxnxfcto1op  aiei;t trxrio iu1ll  mivi t sDurxm nt4oee mf3tldla em(vs (0arxnifctytoaD lnes;t srtoxr no4ap n iei s  Drr( p;o4tpxnmociltfmDrlu p;(4 exnxf iadfm elnvi (0trtrxopiu4ome mnvslt)aDuauro;o4aeto f3ils s um(vo (0altnxociatom elnvo s t2xrir no4lmt mivsltf ruaurpnt0tlxn oeiysfsDelumon(0 lerif iatlmDe neo s) ruoio3oydop nmfvs tfsrrr(rp;u1apt  oetas a rl(vs;(0arxoxf iy1oa  anvs;(0t2xoir iudop  mieils) rtrxrpnt4olxo ocildfm rl(vs;u) rxomf iydlaDeanei;(  eurxr io4llte fvi s)a2raxmpot0alxomf3ias a2uluvs (0aeeomf3ta1lp  anvs s teum(r iodap emicia( aDra(  no1tltn oeiaslm ra(mon(0 ltnmf3iotfp   ivi s0s2xmirpnydolenlfctls s2tmx oou0teenio3ilsfaDem(mo u0 etnxf3iydfpD au o;s0trumiopoudllenmnct ( aruax  ;u4oee mo3iytfa2uln snt0trtomociy1lpDeaueo;s srxoxopio4aleelnct s) 2tmu  ot0teen icilsfm umuvo u) ltomr oatfpDrli o ()s2tm(o3oo4amen fvsltfsrtrx  ou1teto ieiasfa uln o;t)altrmo iydfmDeaueo;(  rxmxr3oodlp nmnct ()a2rax  no0aleo octls sDrm( snt4 lxriociotomteluei;t0srtrxopny4op emici sf Draumo;u1oleo ietytfa ra(vo;u4 exomf3to1om raueo;s)t2toxr nodape mfcs () Dururont0olt mi3iysfa emn p;()aexrxfcty1fpt ai o;( sruoio3oydam  mnvt (fa2tm(ront4tlx ifciad a2rlumo;()alxnmo iytfpD  ues;s)s2uo(rpoodlmt  fet t  2ra(ronu0tlxoifctadfmDelu s t0 lenxf oy1fp eaieo s  rtm(r ou1alt lfct sfsDrmxrono4oetn ieiatls2ea(mo u) rtomo ty1oate uei s0 rxo(mpnu1lpenlnei t arurx p;t4texn ociadfmDemn p t)trtrifciatlpDrlneilt s2tmim ou4lpen nctat) Drmxmpno4teeomfeias a rmnmo (4 etnxfciy1fat aivolt)srtm(o3nu4lltelivtas  Dtmx  ;o0aeen o3tytfmDrmuvp;u0trtrir3oodom  luvo (0srtrxmpoudalen ivs s) 2rmxm ot4opxnioeias m ulumo ()teenir iotopteaivi;t teum(m3nudamtnlieslt  Drrxrono0openmi3tydla2eaumsnt4alxnio ia1opDraivslt sruo(opnydll   fctltfa2ra(rpno1oetn i3ilt s2el(vsnu0tltomr oadla rln i s0 2ur(rpiu1llee iesls a2tau pnt1altnifcilsls rmnvs;u4teenmo3ty1lpt ai o (0trxm(r3iy4ome mnvt s)a2ta(  ;u4ale ifctlsfm2uluvonu0 rxrmr3totoat luvs s)trum(o iu1alenmfviatfarur(m nu0apen octldfs ul( s;t0arxoxo3iy1lp ean s;(0t2toxo iu4om nlfctas)srrm(  ;t1aeeomoeiadls ua( ont) eeomrciotoaD li s s0setrimpnu4ap nlnvtas srrm(ronu4tptn octatlaDelnvp;()treomr3ootomDr nvs;()trtr(rpiu1op nmfcsl()sDra(  ;u1apen o3iad s2ulnvo u0 ltrmocta1omD luvi t0srxoim3ny4lpt  ietas  rrmump;o1aex  f3tlsla el(vo;t0artnmf todfm  livolt sexmio3oydomtemieil(fs2umurpoo0tltoii3iltls2emn snu0teenxfcto1fateaivsl( t2urirpoy4ll emivslt) rtr(  ot4tpe iicias s2eau s u0tlxnmo3iytfpD auvo s texmxo iy1ap n nciat  rrauro;o1oet  oetat a ranmo u4tetomoctytlaDraues t  2uo(rpno1ape licta(fsDrmxrp;u4aptnmocilslm rm( p;()teenxocta1opDe uvi s sexr(m3ny4ll nlfet sfsDtm(m ot4optn fctld sDul(ms;u0alermf ootlpteli o;s) 2xm(m iy4lmen nes tfaDurumpou1opt  i3iytls2raums;u0arenmrctydlm   ivo (0s2toir3no1ol n icil(fs2ra(root4openif3iyd m2uanms (4 rerxrcto1lpDeanvs s  rxm(m3io1lpeemfetat)s2rrxmo;o4aex  fciaslaDraumsnu0 eerifctotfmDranvol(  rxmxm iy4lptn nvil(f Duaurpou0alx ifetldlm rlumpnt0 exrmf3iotomtrlies ()sexmxm iy4am  lfcils) Dum(r nu4alxomo3iad mDuaums (4 ltrxf3oa1fa rlieol(  etmxopnu4lm nlivsa(fsDrr(  ;t0aexn ietadls2ean s (0 lxrmfctytfmDrauvs;s) exoxmpio4ap  lnvsasf rtau poo4tlto icilt s2emnmp;t)teerxo3oy1faDrli i;s0tetmxo iudal e fcsls)a2tm(r ;o4optn fetatfmDel( snt0 exoifcoatfateai ilt0 2tmxo oodolt mnvs s) Dtr(r ;u1teeomf3tyslm2rauvs u4aetoxr oo1lat  n s t  2urxm3iudam emietl() Drrx pou4optoioctadlm2um(ms;()tlxrxr iotlm eai sl(0 2to(m ou1lp n neilsfarrmu onu0aeeoif3iat m2el(ms ()texoxrcoadfat anvs;s)setrir3iy4olt  fcsas artrx onu4tpxnif3ias m umuvo;u)alxoiocty1lp r uvolt texoio3ou4lp n nvi s  rta( oou0texo ieils m2emump;()aexrio3iytlptraieo (0trtoxrpiu4omtnlfvilsfarur(r ;o1oexn f3tltlaDul(vo (0aetnxo3oo1fpDean olt  rtoxo nu1lptnmivt s s2tr(r nu1tlxoio3iyslaDuluvo (0 lenxrctodlmt  i s;t)trum(r iu4op emnes ()a2umu  ot4alxnmi3iyd aDrmuvp u4 rxnxf oadfa  ai sls)t2xmxo3no1opteliei t)a2trxm ou4tpe mfcilslm2eau s;u0treoxr3todomteli i;t s2xo(r3io1lm n nvia()s2tauro;t0tle mfetydfs rmnmo;u4 lxrmr3oa1omD aieolt trtmimpoo1lpe lnvsa(  ruaum ;o0olen ieias aDulu p u4 rxnif oytomD anvo;s  etoimpiodame mfesl( sruau pnu1opxomocilsfaDeaums (4 exnio iodfpte n s;(  2trio ou4llen ictls  Drm(mpoo4aptomfeild aDulump;(4tlenmf3ia1fm   ieslt)srxmirpiu1ome  nctl( arrmum no4ope ifeiyslaDum(von()tltoircta1lm rauvi;(  2uo(o ny4llt lietlt)sDrrxrpot0tltoifciasla rl(vp;(0aexoif oytla   ivslt) 2xr(o3iu4omtnlicias artrur oo1aexomicilsfmDumn s;(0 exriociodlate ueo (0seto(r nydapte ivtat)a2ua(rooo0tlt  ociltfaDum( p;u0arxrmo to1fm raivils  2ur(r oo1ame  ivs sf rrrumpnt4aee  ociadfaDua(mo;()tetoif3to1lpD  n o;( t2trir iy1llt mnvi (fsrua(m nu4alxoioetytfsDeanmo (4alxomo3oadlpt lieolt0sruoio3nu4open nei sfsrtaurpnu4tpxomoeiat s ua( o (0teenxrciadop eaies s0setoxopoo4oleelnesl()sDtrumoot1aetoii3tadfmDra(ms;(4trtnxocio1om rauei t trurim3io4om   ietls)s2rmur oo4tle moetldfaDean o;t)arermocoa1fa r i ils  2xmxmpnydoltn feil() 2tm( p;u0olxnmfciys aDemn s t4texrxr tytomD an olt0 2toir iu1llenliei s  Drrxrpoo4tptoifeildlmDra( s (0 exrxr iodlpte n o;t0s2umxm3nodamtnliesa()a2trx  ot0tpt ioeiadfm2em(ms;(0tlxoir3ootfat lnei t  rum(o3nydlmenmneil(f 2tmu  nu1oexniieiad sDelnvpnu0artrxfcia1op  li slt  2xo(m3ou4omeemiviltfs2rr(ro;t4aeen fciytlmDumnmonu0 etrxfciydlaD aieo (  2urim3io4opee fesatf Drmu oot0texoifciyt s ea(mp;t)tlxoifcoodomDrlnesl(0trto(opoodlpen netl(faDurum ou4oexnio3tlt mDean p t) lxomo3iy1omte iei t0sexr(r oydalt lfeta() Dtax o;u4aex ioeias m2umuvsnt0aetrxr3oatoat  uvs;(0t2trir3oudol nmfesas)srrax  no0tex moctatfm2ranms t)artnxr3iydopDeai i ( s2uoir3io4ap  lnvi s)aDrrx  ot4tpeo ieils sDuaump;(4aexrxociotlaD  u ol(0s2xrxm oy4lpe lict sfsrtr( o;o4olen f3ild s eaump u) lxomo iodfm   i s;s)s2xr(opny1olt  nct ( a2ra(  no4tlxoifciltfaDeauvo;(4alenmf totomDean s s0 ruoir iudopee nvia(f 2uau pnu0oeen o3iaslmDrmumpn(4aexoifctodfpDelu o s) rxoxo3oo1omeemfvs t  Dururo;u4alx ii3iydla umu p u4tetrmr3oydlm eau o t)s2xrir3oo1lp  mfcs s)a2tr(roou1ale  fcild a2elumonu0 leoxo oydoptrli o;s trurxrpoy4ll elnvsl()sDuau  ou0aptnioetlt s rm(mp ()tlxrmfciatlmDr ivs (  2xrir oy4ale  ncsls) Drmu oot0aexn oetat s2rlums u0arermo oy1omtr u o s0texo(o nu1al  mfviat) rua(mp;u4opxomf3ildfsDrlnms;u0 rxoifcty1opt aueslt)s2toxr3iy1op nmncias)sruaump;o1aleoifciatlsDuln o u)teenxf tytoateln o;()teurio ny1ol e fetlt)arrr(mp;o1apeo iciatlsDuau on(4tlxomf3oatopDrln ols  etoxo3iu1op emictat a2umumono0altnmi3tldfaDum( p;()arenmrcoa1fmDraivi t0sexm(opny4lpt lfvtas)a2ua(mpot0alen ieiytls ulu s;u0aexrmo3ta1fp elivo;()srtr(opny1lp  mnvil()aDrrxr oo0ale  feiydfa2ranvont0trenxrctadfa  liesls  rxrimpnudop n fetls  Dtm(m nt0oeeoifcilt sDrmums;u4 rtrir3ta1lpD lieols0 rurio oo1opt  fcs s sDur(r nt1aexnmiciatls2elump t4 lxrir iy1opDelnvi t0trtr(mpoydal n iciasfaDtr(rp;o1tpx  octls a2emu pnu4arxrio oydom  ln il( truoxo3oodamenlietls) 2um(m ou4oleoifciat s2uauvpnu) ltomrctydfa rau s t0 rxm(opiy4apt mnctls  Drrxm nu0oexo ictadls elnmon(4alxnmo3oa1lmt aueo ()sruoxo3ou1lmtemici (  rtmx  ot1tex iieiatfs raumpnu0 lenio3tatlm eai il( teumirpiy1amt micia( aDrau oot1tlxo o3iadls2umumpnu)altrxr tadfmt li ils) rumxopoudlpenmfvtl(f Dtru o;t4tpeomo3tldla2eau s (0trtoxfcoydfat auvilt)t2tm(rpoydlptn ictl(  rta(  nu0oex  fctysfs2em( o;()trxrmo3tatfmtran s;()sexm(o3oydol n ncsl( s2uaumonu4tpxoifciyd s ra(mp t4tlxrif3tytoaDeanvi;s) exr(o3oydolee ivtat) Dtrumpou1tpt if3iaslm2emums;(0treoxfcoy1opD lneo s s2tmxo3oy4altn fcslsfsrtau ooo4aexnmoeildlm2uan o u4 rtnif3iy1fpDrai i;s t2toxmpou4ol nliet tf Dtmuront0tex mfetlslaDul( snt) lxrxf3totfptrai s s0 rtm(m iu1lpe mivi tfaDur(rooo0tptoifctadlm ea(mpnu0tlxoxrcoydfpt luvols  eum(rpnydoleemicilt  2ururooo0apxn o3iytlm2uluvo;u0aleoxo3todlm  lnvi t)srtmim3ny4ape mieil( s2trx  ou0texoifetasfm ul( s u4arxomo io1la  ln il() eumim oy1apenmfviat s2rmum ou4tet  oetat s rm(mp;(4 rerif io1oaDeauvo;()setr(rpoy4ll  mnviat) rra( poo0olenmfciltfm emuvpn(4 renxr iytlmtraivols s2umir3oy1lptnmicsa()aDurump;o4olxn feiyslaDean o;u0 rtoxr3ta1oa   ivs;t texoim3oo4omtelfvia( srtr( p;t0oleoiiciatla el( on()alermo oa1fpDeaies;t)tetmxr3nu4lmte icil(fsDtr(moot4opeo fcils mDuln p;t4tlerxfcta1oa eanvo;()t2uoimpnudamtnmicsa( arrrur oo0ope ii3tasls rmnvs (4tltoxoctadlp rai i ()t2xoxm3iy4lm  lnvt t artrxmp;t0tetn f3ilsfs rmnvp ()tltoxo3todlaDr uvi s  2trxopou1am nliesas)aDtax onu0apt  i3tadfs2uluvp t) lxnif3ootla eauesls)sexr(m3iu4lp elici t  Dtaumooo0tlt ioctat sDeluvs () ltnir to1fpDe u o;t) 2tr(opno1oleelieiltf rua(m ;o1oltomfeiltlaDem( pn()texomrctytoaDr ieo t) 2xm(mpoodoleelnei tfsDtau  no1tlt  ictad aDelnms;(4 exnio3iotla eli o s setriopno1ll   feils a2rmu  nt1ale  i3tatfm em(vo u0 rxnxf3oa1oatrai o t teurxo nudam e nesls srumumo;o0ape  oeiadlm rl(vo t4aeenir3ootfaDraues;t sexoim3oy1lmee ivtat)sDururoou4tlxo ieils a2rmn s;t)alxoxr3oodoat anvs t  2urimpio4ol elfcs s  rtax ono1oltnmfciad a uan snu0trtnif3oodlmD aivi ( seuoxm3ou1omt mivtl() rra(rp;t0olxnif3iaslsDul(mpnt) exriocoo1opDr u o t sexmxo no1ll nlivilsf 2rm(  ou1oet  ietyt s2ua(vs u)trxniociytfmte nvi () rurim3oo4ameemnvtlsfsrraxmo;o0alxnmo3iad sDemnmo;t)trxrircto1opte nes;t) rtoirpou1ll e iei s sDurur no0aetn fctasls2rmu o u0texomr3iotlmtran s;t s2tr(m3iydopeemfcsls) rrr(r ou1alenmiciatfsDem( s;u0aeeoxf totfat  nvsls)tetrxr3oy4lpe lics ( sDrrumooo1ape ifctytlaDumnmonu0 lxomo ty1opD lu i t)trxoio3oodale  nci () 2rmum nu4alto fetysfm umuvsnt)texomr3tytlptr nvo;t0teum(o3iydlm  mfesls)arra( ooo0apxn octasfaDulnvpn(0arxoif iodoateanvs;(0teto(opny4oleelfvil()aDumumpno4tpeo ietytfs2ra(vpn(4altnmr3tadlmt  n ols s2urir3oy1ol  mnetas)s2ua(m ;o1openmo3ias sDelnvp t4 rtrxo3iydfpDranvs s  2xm(m oo1om  mfcsls arrm(m ot0olx mfeildfm uaumsnt) renmocoa1lm  aiei;t0seurio oudlle lfei (f Drmxrp;u4opxomictldfs uaumo (4alxrif iadfp rau i t0 rtm(rpou1am elnctlt  Dtm( ont0apxnioctysfaDum( o t) rtomf3iadop  auvilt0 2xrim3io1optn nesa( s2tmumpno0tetomiciydlaDelums;t4tetnmf ty1lm r nvi;()s2trxmpoy4lpt lfvtat srtr(r no0tltn fciadfsDeau pnt4 leomo3iy1fp  ln o;t s2umir iudlmt  fcta( srumxroot4oet  f3iydls2ul( p;u)aexoxo3to1fp   u o;s0s2trxopoy1lle lfctl(fsrrmxm ;u1tlx ifetasla2ran p u4trerxrcootlptrau i;(  2tr(o nudap n ivt s) 2rm(rp;o0tex  oeild m2ul(mo () eeoio3iatlatrauei;s  rxoio iu1aleemnvtl()a2tr(mont0apxn oetytlm2elu o;u0 eenmr3tatomt  nvslt s2trxr ny1lmt  fvias)arurumpnu1texn fciad a emn s;(4artrif3oatom r i i;t trtmxopny4ol nmieta(fsDua(mpnt4oetnmi3tlsfa2rl(ms u0tleoxf3oa1lp r ivolt sexmiopoo1lltnlicil() 2tmu  nt0apeoioeiyt aDeauvp;u)tetnmr3iadfmtrluvi;t0 2uoio3oy4op emici ()srua(m ot4alenif3tlslsDra(mp;u)teeoif3iy1lp elueols)trurxm oudame  ieilt s2ur(root0oetnmoeilsfa el(vs;(0teeoifcoo1lm eaivi t  eurxo oo4lpt lncia() Dtr( o;u0tlxnmfciysls2rmn s;t4aeenxr3iy1laD livo t seumxo io1altn ict t  Dua(rpot0oleniociltfs rlnms;u4 rermr totfatrlnvs;t0 2xo(o iy4ll nlnvi s)s2tmxr ot1oeeoiieiltfm2ra(mo;()aetnir tadopD li o (0s2urxm3iy1lp nmfetls sDrrxrp;o4tlt iicils m em( snt4trermoctodfmtelnvo () etr(m iodlptemnvta()aDrrumpnt4tlenmo3iatfa ea(vo;t)trenmf oodlp ranvils trxoiopnudlpe  nvs (fs2ua(rp;o0opt  fcilsfmDuau sn(4alenif tydlm r uvo t0s2um(m iudlptemiet sfaruauro;t1tlx mo3ias s rm(mo;u)texnif ta1lpD auvil(0srum(o3oydolt lfetls  Dumxr ;o0olt ifeildlmDul(ms t)aeerif3to1fatraneo;()texrio iydal n ivtat)a2trurpou1tetoiieilslmDua(vs () leoif3ty1fa rlu o t0 2tmir nu1om n fetl(  Dtrx ont1tpx miciadla2raumsnu4 rtoxo3oydop rluvi (0seumxm3nu4ll elivs (faDtax p;t1altomoetad m2rmuvp;t4aexomrcootoaDe n o t) rtrir iy1apenlfeslt) Drr(m ;u1teenif3iyslmDem( on(4 rxnir iatfmDrlnvo s0t2umxm nu4om n nesatfs2ra( onu1aee ifciydlmDeanmp;u4aeenxfctotoaD auvi s0srxmxopoo1lme lfctltf rtmxmonu4ole  oetltfm eanvp;(0altrxo iodoaDraieo;t0t2umxm iy4lptn nvil( arrrumono1tle  ietlt a el( p;t4 exniocto1lmDeanvo t srtoxr3nydol n ncsltfsDuaurp;u0olt if3ilt aDel(vp (0aeenxrcoy1lpD  ivsls)srumim iydoptemicia(  rtrxmpou4oleo o3tlsfa2um( p;(0 eermrcoa1oate iei t  etm(mpoo1ape mfeiat s2raxroot0tpe ifetatfsDua(vp u4 eeomfctatfat  u s;t  euo(m3iodlpenmfvia(f 2tmxronu1open oeiytfs ean s;u4artomf3totoatr neslt)t2urxo iy1aptnmnvilsfsrrr(mpno1tlxo i3tytfm2ra( p u)teenxf iodfaDe i s;s s2ur(mpnydll   fciatf rrmumo;u4tpxoii3iat s ran on(0arerif totfaD  n s s teumxm oo4ol emnctl( artm(m ;u4tlxo oetadfs2umump u0aeerif3iodlatr ivolt srumxopny1ol nlfvs (  rtrx p;u4altniietyslm eau on()aetrxf3oa1oaD  ieo t)sruo(r3oodopenlfetl()sDur( oot0ole iiciadls ulnvpnt)tlerxf oadop eau o t0t2tmxo ou1lptnmfeia(fsrtr(moot1tlt ifcias s uluvpn()arenmf todlm  luvs;s)sexm(opny1omee ietltfsrtaump;o0oltoioeilt a umu pn(4artnxocto1la eli i (0trumim ou1open ivsas s2tmxmooo0oltoii3iyd mDulnvpnu0texnmrcoydoa rlues;( tetrxo3oo4olt mfesl()arumu poo0tpen f3tlslaDeauvsn(0texnmo ia1fmte i s s t2xrxr3ny4amt mfei (fsDumu pnu0aeeoifciaslmDumn o;u0tltrmr ia1fmtelneo s)seum(m3nydlmeemnvsatf 2ta( ooo1tpenmfciltfaDelnvon(4 rtomo3oytla  ai o;s s2urio oodap   nvsl(fsDrauro;t1oleomiciyd s2eau pn()trtoxrcta1fmtr n o s  ruo(o3iy4lpenmicsl() Drax o;u1open oeilsfa2um( s u0 etoxf3iadlm   nvolt tetm(rpiodlm elies (fsDrr( ooo1tet mf3tld s2ua( p;u)tlxrmo3oytfaDr ivi;s0trtr(rpiu4am nmieta(fsrur(mpnu4apen o3tytla eauvpnu0 ltomfciotom e neo;t0srurxmpiy1lm elics sf Dtrxm ;o1tee  i3iaslm2elums;(4tltnio3iotfpte uesls0s2ur(r3ou1lp e icilsf Dtr( poo4apxn iciadla2elump;t4 eerxfctodom   nes t)seur(o3iodlme  ivtlt s2rr(root1opeomfciatfa2uaumo u0 renio3ootopD liei;()trum(m ny1oltnmiet sf Dur( oot1opxnioeiyslmDeaums;u4tltoif totfat  ivs t0t2uoxo iu4lmeelneilt)srua(r ;o1aexoifciysfmDuaumpnt4trxomr3oodoat auei t) 2xrxr3oydapeemnei t  2tauroot4tltnmi3iydlmDranmonu)trerxo3iytoptrlu olt) eto(o3nodol  mictlt)a2raumpnt0texo ociydfm rauvpnt0aeerifcio1fpDe nvols t2urim oudll n ncta(  2ua(rpno0aex  f3iytla ea(vp u)teerircootfp e n slt0sexoio oo1lmte fvi s  Dtm(r ou4tpxoii3tlslsDeau p t) lerxfciotlatr nvo t  eur(r3ou1om nlfcsls  Drm( pou0alxnmoetlsfs el(mpn(4alxrxo oytop  luei;(0truo(m3oo1olt lnetas  2ur(rono1openio3tlt s uln pnu4 lenirciytom  livsls0trxo(m oudomte iei t) 2tr(mpnt0tltn fetyt m ulnvont0aexnxfcoytfa r nvols)setmxr3nodolenlfvtl(fs2rmurpnu0tpto icild m elnvp;u) exrxr iydfatrlivs;(  2um(r nu1ol  mfvsa()sDtaxmono4apx mi3iytlm2rluvs;u4aeerxf tadfaDeluei t  2xoirpiy1op  mnet t)s2tm(m ;t0opxnif3ilt s eanvo;()aexrif3ta1lpDelivilt srxrxr3iodlptelfcsltfsrumu  nu1oee ioctlsfaDulnvo t0texrmo oydlaDrli o t0 2toxm oudom   net t) Durx pnu0olxnmf3tltla um(vo u)texrxf iy1lpD  ues;s) rumxr no1lp elnctas)aDtru pnu0olxnmoctls s2ua(ms (0artoxf ty1lat auvolt  etmir3ny4ape mics ()aDtrxm ;o4aexniietas aDra( snu0 rxrxfctodlp e nvo (0s2xrio oydolt  fci tfsrtr(r nu0aet iiciltfa ul(mont) etrmfcoytoaDeaivsl()tetr(o iu4ll   nctls  2rr(mp;u0aetn icild aDrmn s t4 ltnxo3oadfptr ueo;s)srxm(o3iy1lmtemfctltfsDuru  no0aexnifeiyd mDea(mo;t0altoxr iytfa rau o t teto(r3nodamenlnct sf rtau  ot4tee  i3tld mDemnvp t0treoxf3tytfmDr i o t  2xmim3io1ol nmnct t srtrxm ou4aleoiictatls2rauvs t0arxnxo io1fmtr ivo t0t2tmimpnu4ll   iciasfsrrau pou4tpxnmoetadfm2em( o;(4 rtrxo3oa1fp eluei t srtrxo3ny1omt mnetlt srur(mpoo4ope ifetasla2umumo;u) etrxrctytlmDelivo;( trumxm nu4lmtelfct s sDumu pot1aexomo3iyd m2ua(ms;t0aetnxr iotopDranes t trxmxm3ny4apt lfvi ()arrmx ooo4alxoioctyd m uln on(0arxoio3iatfat aivolt0sexoxmpnu1apt mncslt  2rmxmp;u0oet ifctldfs elnmp;t0 ltoioctotfpD auvi;(0s2triopoo4olen fvi (  Drrxmo;t4aet  ietls a eauvs t)tltnmr3ty1la eluesl(0 ruoxrpoudal  lfvsa()s2taxmoou1ole io3iatlmDel( snt4aeeoxo tydfp rlnes;t  eurxo3oy4lmtnmiei s) rrrx pou0olx mfciaslaDulumsn(4texrmo tadop e i s;s)trtrxo3nu4omtnmici t)arumuront4tlxoiiciysfm elu ont4 etrir tadoa r n ols)seto(o3no4llenlfvtl()sDtmumoot1apenmietydfsDulums ()tleoif3iatlat  neslt0seto(o3oy1lltemicta(  2trumooo4opeomo3iydlaDulums t4 exrmfctatlmD lu i s)t2uoim3no4omt mnvi s  Dum( pot1texomociys s rau pnt)arenxrcio1opD anei;(0 rto(opno4opte ieil()artm(mpnt0alxo oeiltls ul(vo;t)trenxf3iotfateli s (0trxoxmpny4olt  nctl(fsDrrumpnu4apx  f3tyt m2uaumpnu0 lxrxociadlmtelivil(0trxo(o ny4ope mictatfsrurxm no0aex  i3tadfs uln s (0 rxomrcta1la  aueo;s)sexmio3nudalenmivs t  2ra( ono0alt miciatfm2el(ms u0 eenio3iy1opD lneils0 eurir ou1lptn ieias)arururp;o0texn ocilslsDrluvont)trxrxo todlp ranvilt)srxr(rpio4ol e nviasfa2tr(m ou0tlt iociysla2rmnmsnu4tltoxocta1lm rln s;s0trtrirpnu4ll  mieslt a2uax p;u4openiictatfa2rl(vp u0tlxrmr3tytfm  livi;( s2to(opiudlpe livsat) 2rmx p;t1ole mi3iasfaDrlnvp;(4tltrmrctodfa elnvo;s seuoirpiu4opeemfei ()artax  ot0alxnmfciydfm2emuvo t4aetrmrctydopDeai ils  rxmxm iy4ll nlfeia(faDumuro;u4aleomfcilslsDea(vo u0alxrio oo1fm   ies;s)seum(r3iydlleeliviasf rrr( pou1texo o3tys a rl(vont0trtoxr3tydlp  li s s)t2xr(m no1lltnmivilt)s2rmum ou1alt ioctydlsDrln s;t0tltomf oa1lmD  ues;(  2to(opiu4olen fvt s)sDtrxmo;o4tet mi3iys a2el(ms;t)treoxrciadopt luvi (0texo(rpoo4amt licia()aDta(m ;u1oleomf3iytfa2rm( snt4trtomocootfaDeluvi ( t2tr(mpnudlpt  fei t arrmu p;o1opxoiocias aDeau on(4 rtoiocoatfmD aues;( texoimpno4lmt lfcsa(fsDtmuro;o4aptniociltfm2elu on() reomo3ia1fp ranvsl() 2xoio iodlle  fvs t aDurxrp;t1apeomfciytfmDra( pnt)trtoir3iytfmD anvs;s  rur(m3iy1oleemiciasf rrr( oot1tlt iiciyd aDum(mo u0 eeomo3oy1fatelues;t)texm(r3oo1ll n nctlt)a2tmumooo4texomieiat a ua(ms ()artomr totfmD au olt)teur(o iy4opt mfcs (farrmur ou1ole ii3iasfa raums;t0arerxo3oodoatrlneil(  rtmim3iu1ape lfeia()sDtmxrpou0apxo o3iasfmDrln pnt)altrxf io1faDeanesls0trurir iudapen ieils arumum oo0aleo oeild a uanvpn(4trtnmfctydoa eaieo;t0t2um(r nudol n fvtat)sDuru poo0tet moctldlm rm(vo;u4 ltrifcta1oa   iei s)truo(o3iydll n ieiltfsrrrxm no0aee mieiatfa2elnvo;u) lerxocoy1fa rln o;s0srurio iu1omeemncsl(fsrum(r ;o0tlto octls a2ul(vo u0trxnmo3totfp e uvsl(  eumxmpoodamenmnvta(f Drr(moot4ole mo3iasla ranmp;t0teermfcoatomtrluvslt0 2xoxm3ny1ole  nvsltfsDurx p;u0tpe ifeiasla ran p u4texnxr3iatomt  ieo (0t2toio oodalenlfcsl()arrrxmo;t0tee ifeiadls2uluvp;u4tetnmrctytfpD livs ()seumxr3no1lle mfesas aDrrxmp;u4texnmi3ildfs elumo;u4aeenifciadfateaies t setrir io4omeemieias)artr(mont1oet mieildls ulnvs (0tetrirciatomD  nvo;(  2urir nodlpenmnct s  2rmur nu0oexoif3tad s2umump;t4arxrxo3oy1optrau il( s2toxrpoodolenmfvi tfsrtmu  ;t0olx ioetatfs2em(mo u4arxomo ty1fmtran il( t2umio3iy1lm nmieiat sDrrump;u0apxnmoctlslm ua(mp;u0arenxf ta1fp  au i;s)s2toxmpoydomt  iesas aDta( p;u4apx if3tldfa rmump t0artomf3oytfat  ieilt0 etmxopnu1ll nmnvi s arua(rpot0aee mo3ildfa umums;u0trenxr3todfa eaueols srxrxo io4lle livs t sruaxro;u0tpeomieiytfaDrl( ont0 eeoxo todop eauvo t) 2uo(opoy1op  mieta(farraxmono4apxn f3tydfm2ean o t)tltnxo3iy1lptr u slt)trtoim3iudoltnmics s) 2rrumpno0oleo ieiad a um(mpn(0 eenio3oatlm rli i s)trumim3no1lmt lfeils aDurumonu1ole  feildfmDelnvs ()aeenxr iodfp ean i t  rumxopnu1lptemnei tf Dtrxmpou4alenmieils a2uanvs;u0aeerir tydfmt  ies (0 rxoio3no4apeelnctat)srtau pot1tee mf3ildfa em( s u4 lerxo3oadlpt lu i;(0sexrim3oo4aptemnci (f Dur(moou0aexomoeiyd s umnms;(0 renif iotfpD  i sl()teumirpno4ll   fet (fsDrm(ro;u4olenmieiysfmDrmuvp;t0alxoxo3oo1oaDrliei;(  etoxm3nu1al nmneils sDrau pou4aet ii3tlsfa2um(mo t4 lermo to1fm r i i;t0teuoir iu1am elivsas)sDtm( p;o1aeenmf3ilt m ean snt)aleoxr3ia1fp raivi;()srtr(m3iu1lme  nvs t  Dumx poo1apen ieiad aDuauvpnu0 eeoiocto1opt au o;t)teto(m3iudol n nvtlt)sruaxmont4oeto ieias mDrmump;t)teerioctotfaDeai s s0 exoim iu1ape mfctlt)s2taumono4apxn f3iysfs ranvp;()treoif3oytfmt  i o t)s2toxo3nu4optnmnes tf 2rr( o;t4oex  ociad sDelump (0tetoio3iodopt au ils) rxoir3ou1altelnvt s)srtax pnu1tlxoifeiadfaDrm(mo;t0tlxnir oy1lpt  n o;t t2xrxm3iy1lpeemnvtlt  rta(m ;t1aexo ociatlm2um(ms u) eenxf oo1opD lu i;( s2toirpiu4lmenlivsa( srua(  ;u0teenmoeiadfs2umnvo;()altomo3oa1lpDrln olt0srumio nydom e nci (fa2ta( pnu4apeomoeiatlmDrau s (4arxomo oodfat lnvolt)setmxo oo4ale livilsfs2trxmpnt1optniociat s2rmnvsnu0alxnif ia1lmtr uvs ()tetoxmpnydalee fvi t)s2um( onu4optoiietatla2eln p;t) exrxr ty1lmtran s;s0trxr(r3no4ape mics (fs2tmxrpno4aeenmocils m2eanvp;t) rtnxfciatlmDrln o s0truoim3nodolte iesat) 2rm( oot1tetn oeilt m2uluvo;(4 rxrxfcoy1latean s (0 exoiopoo1ap nlfvt s)aruru o;o0tpxnmfctat a um(ms ()arxnxo3tytomD lnvo s) 2urio nodamt lnetlt) rur(ront0opxo i3ildfa2el(vont4 lxnxr3iotfpDelivo;t s2urxo ou1lme  nvslt aDtru pno0tle iicilsfa ul( snu4trerxf ta1lmDeauvsl() rxrim3iy1oleemnct (  2rrumo;o1oex  oetysfsDuln s (4 leoiociytfpt luei;t0 rxmio3ou1opte nciat aDraumpnu4oee iictysla ulump t) exrmf totlaD livi;() etoir3io1lmee fviatfsrtr(monu4opxo oeiyd s emnvs;t4 rtnifciadfate i sl( trtm(m3iy4omeemfes s)sDrmuronu0oet mi3ilsfmDuln o;(0arenio iadlatraneolt t2tmxmpou4omee fci sfa2ta(m ou0oetnifeiat m2uau p u0alxrifciydoaDelnvo s teuoirpoudlmtnmfviasf rrmu  ot0aptnmfeiat mDul( pnt4teeomo totop e i ilt s2uoir3no4llenmfeta()srumxront4olxo o3ilsfm ea( o;()altnmr3oodlaD  nes;s0 rumxrpno4aptn neia(  2uaumoou4tltomoeias mDum( s u) exrmr oo1la  lu o;t0 exrir3oudom  lict sfs2ra(mpot0oeen oetasla emump;() lxnif totlptelu ilt0seuoir3nu1al emici ( artruro;o1opxn o3iatfm2ea(ms t) eenxo iatfmte n s ()trtoxm oydllee fvsa(  rrr(moot1ape if3iyd m elumo (4 eeoircoo1omtean i;t sexoxo oo1lmt lfcils aDta(mo;o1oexniiciltlm2elums t) ltrxrcty1fmDrln ol(0 exmxo oudamenliesat artaurpno0ale moetlsfm2ul( pnt)tlxnxf oo1lpD anvilt t2trxm oo1ll  lnctls)arrmxm ;u1tltn feilsfm ea(mp;t0tlxnxo iodom rlnvi;() exo(mpno1altn nctl(  Duru  ou4texnmfeiatfs emuvont4 rtnir3oodom elies s teum(mpoo1apt  fvia()a2tru o;o0opeomfeiysla ua( o;(4 etomfciadlm   n i;() 2toirpoydaltelfvsasf rtau pnu4tlt mf3iysfm2eanmont4alxoxfciodfateai o;(  exoxrpnu1omenliciasf 2uaxm no0oexomo3iytfaDum( o t)tetoioctotfpt au i;s0 rxmxmpnydap emivi sfsDua(mo;t1aee ifcils mDrmn p (4 lxoifctydoa rlnvo;s s2xrxrpoo4opeemnvi t)sruax pnu4tleomociyt s rluvp;()trerircoydlpDeauvo;() rtmio3iu1aptnlfes (fs2umumooo4olto oetldfaDrm(vp t)alerio3ty1fpDe uvi t) 2uo(o oudom  lfei s  2trur no1apenmiciysfsDeaumonu0 rtnxoctodomtrlnes;s0t2umxrpnudlp  mfcta(fsDurxm ;t4openifcildlsDumnvont4teenmo3to1lpt ai o;()sexo(m3oo1lm n feil()aDuaumont4oee  fcilsfm2eanvpnt)arenxocty1la e nvolt0trtoirpoy1lltelfesls)a2rrurooo4olxoiieilsfsDeln p t)tetnxo3iadfptran o () 2xr(o iu4om n ivt ( s2rm(m oo4tlen ictyslm elums;(4trxnif oytlat auei t) 2uo(r3io4lpen netl(faDuaxm nu1tpxomfcilsls rlnmonu0altnmf3tytfatr nesls0 rtr(mpiu4op  mnci ()srumump;o1open iciysla elumo;u4tltnxo tadfmtrai i;s)trtmiopny4ll elfvils arur(r oo4opxomociltfmDrlums (0tltoxo3oadfa   ueo t) 2um(r nu4lm emivt (fsrumxmonu0alxomoctat m ul(vo;t)trxoxr3tatfaD ai i;(0trtrimpiodomt  feilsfaDtmxmo;t1apx ioctadla rl( ont) renxo3iadlpDr ivo s0setoxr io1ame liviat)sDumump;u1opeo ociadfm ea(vpnu)aetoir oodopD  ieils0sruoirpoydam  mfci ()aDra(rp;o1olt ifeiysfm rlu o;(4arerxr oa1lpt  ueo s0seuoxr iu4am emicia(  2tmum ou1tltoiieilslaDul( snt4teeomfciadoa   nvo (0t2tm(m3nodol  mietl()a2rmxr nu1tetn iciyt sDumnvs;t4trtrmoctodlatr nvo;( tetm(opnu4ll emnei s) rtaumpnu1altn ociltlaDrlnms u4tetnxfctodfm rau o;( s2xm(m3iy1al  mfeiat aDuau o;o1altomfeiat sDuluvo;u0 etrir iydlm rau sl()t2xmio3iodoleelieilsf rtmxro;o1oeeomieildfa2ra(mo;t4tlxrxo3oadomD anvs (0s2uoir oy4am emivsl()s2umxmpno1alxn f3ilslsDelumo u4alerxf iatfm  luvi s srumxr3oy1aleemict sf 2urxmonu1ope ii3tld s em(mo;(0 eerir3iy1fpte ivsl( s2xoio3iy1lp   nctl()a2rau oou4tpenmoctyd aDumu s t4aetrif3oatlmt  uvs s)srumir3ny1oltemfeia()aDurx  nu0alto o3iadlm eauvonu)trxnirctytfatr nes s0setrxm3nudlm nlnet ()srurx pno1olxomoeiydls rl(mp t) ltrxo tydfp  lues ( srto(rpnu4aptelnct (  rra(r ;o1ope micildlaDeluvs;() rxoir to1la rlnvi;t tetm(o3nu4opte icsls arurx o;u4tex miciad a ulnvs t) rxoif3todfaD  n i s t2trxo oodal e ivtasfs2umx  ou0teeomfciysfsDumuvpnu0 eenio3oa1fmtr n s;s) rto(mpno4llt  netltfa2rrumono0apto oeildls2emnvonu0arxomr iotomDe u s s0tetm(rpio4amenmfctlt srtm(mo;o4olxn fciadlsDrlu s (4aexrmrctydoaDrai o;s0 2xrxopnudll n ies () Drmxmpoo1oeeniiciatfm2eanmp;t0teermo tadopDeli s;( trtrxo ou1lpte ieia() rrax pnu1tle mi3iasfsDea(ms;(4arermr3tydom   ueo;(0truriopny4apt  ies sfs2rrxrooo1tpxnii3iasls ranvo ()arenifcto1fpDrliesl() rxmxopnu1opeelnvia()a2taur ;o1alxn f3iytfa2ua(vs t)treomo oo1op eln ols0setrir oydlle mfvias a2uax  ;t0alxnmiciysfmDeluvsn(0alenmr oa1fm elnvol(0t2xmir3nydam e fvs s a2trxro;u1tpenmi3tatfm2uanms;t0aetnmf3ootomDeaivols)t2uoxr oy1ape  fctatf Duau p;t4openmfeiadfsDul( o;() lxoio3iydopte nvo;t0s2umirpny4alt lnviat)sDtm(r ;o4texn fciytfmDulu o;(0trtrmrcty1opte uvols srum(o iudlp nliciatf 2ta(root4oet  feiys s2rl(mpnu) rtoxf3iytomteauvi s0seuoio3iudomeelnvi s)s2urxmono4ale moetltfs uanvont)aexrxociadfpt aueil()s2xr(rpou4lpt lfetl( aDtrxrooo4alt iieilsfsDrlnvs u)trtomoctatlp  an i t)setrimpnu4ape mfvsasfa2rmxmono4tee  o3iadfm2ulums;u0aexnmf oydlp eluvslt0srtmxmpou1amtnmneils)a2ua(r nu0tex mieiad mDelnms;(0tetomr oatlaDrluvols t2xoio3oydal emicslt)aDrrumonu4tpxo f3iysla elnms;(4trerif3todfmD  u o;()s2tmimpno4lptnmictasfsDtrum ou4tpen iciatfs2umnvo (4tltnircty1laDeau i;t0sexoxr3iy4ll  lnciltfsrtm( o;t0tle moctaslaDel(vs;(0aeerxf3iadoatelues;(  2uoxrpiu1lmtelnvt t aruaur nt1tpe mo3iatlmDean o;u)tlerio3oy1omDr nvi t0 rto(r3nydol n nvils)srrm( ont4tlxoiocild s2ul(vsnu4tltrif3ty1lpteaies;t0teuoxo3io4apen ivi t sDtaur ot0olt moetasls ulnvo (4 eermo3oydfa eli o ( setm(r oo1oltemnes s)sruax  oo0aexoii3ildls2rmuvs;(4 exnircta1laDr n sl(  eurim3oudap nmncs (fs2ra(rooo0aee ioeildls rau snt)tleomr oa1opD  ivolt) 2xoxopiy1op nlnet ( s2trx poo0ale mfetltlmDrlu snu0tlermr3oodoaDrauvo (0seuriopiu1oltn nviatfs2ta(rpnt0olxomf3iat m ea(vs u4artnmocio1lpte ueo;( seto(m iu1oltn fvt tf Dtr(r ;u4tpeo feildlaDem(ms t4 ltrmr iadlpt auvsl()trur(o nudll e neil( aDrrurp;u1apx  fctyd sDel( o u0 eenirctodlpDe uvo;s0 exr(r iy1lmt mfeia()aDtmuronu1apxnifcild m rlump;t4aeeomr todoa eai o;t0trum(m nu4lm  mivsas)aruru onu1oet  i3iat m2ul( snt0treoif ia1lmDe ueo;t)teto(rpoy4ape lfvtat)arum(  oo1olenii3tlsfs2uanmp;(4aleoxf iydlmDr ivo;s0s2tmim iu4llt  ictl()s2umx ont0oeeo ocils aDranmon() lenmrctotfmt aiesls)s2xoiopoy4lptnmnci (fsDtaxrono4aleo fciyd aDuauvpnt)tetomo tatlm r i ols0 rxr(opiy4llenlfcil()artmur nt4tptomietlt m rl( onu)arerxr to1lmtranei (0s2triopoydlptn feiat  Duaxmoou1tex  feilt a em(msnt)aexrxr3oytlpD li i s seum(r3iydlptn ncias)arur(r ot4oeenmfeiydls2rl( s t) rtnir oytomt  nes;t t2xmxo oodlm emncias)s2umu  oo4alenmfetytfmDel( p;(4 ltriocoatop  lieilt0s2ur(r iu4op eliciatf rur(r ou4open ociadlaDrlumsn() rxrio3iydfateanes t) 2xmimpiodale  ivilt  rumu p;o1ope ifeiyt a2emnvsn()texrif3oytomDelues s0 eumxmpio4amtn ncs (fsDra(mono4aeen f3iasfm2rm(mpn()texoxo3oatlmteaneo ()s2um(o no1ap e net t srrrumpou1tpeo f3iadfsDem( onu4alxrmfcty1oate uei t) euoxm3ou4lmt mncta() rrrxro;o4apt  icils mDumump t)treoxfcty1lmDraueo (0teuo(mpnodap elivt ()s2ra(mo;u4oltnmi3iatlsDelu p;u0tleoir3oytfm eluvsls0 etmxm3nu1oltemfvi tf rua(m ou4tlenioeiadfa rm( s;() lenir to1lp elivil()setm(r3nu4op n nct ()srrm(r ;u1tlt  i3iysla umuvp;t)trtomr oydfmD  ieo;(0 2tmxmpiudole micslsfs2ur(m ;t4tpxomiciydfsDrmumon(4tetnmf3iotomteli i ( trxoim3oo4oleelnvsls s2tmurpoo0olt  fctadls ulumpnt)arxrxf3iydoateauvs;t)sruoio3oudll  lics t)sDum(r nt1opxomfeiys mDrau onu4aetoif3iydfmte n ils) rtoio no1lpenlicsl(fa2tm(  no4opt ioctasfa ulnvo t)artoio3oa1oaDelu sl() 2xmxopiy1olt lncsas)srtrum oo1alen o3tldls2ul(ms;u0 etomrcty1fpDran i s)srxoxr iy1oltelncsas) Dtmumpnt4aetnmfctadfs rl(mo t)teeomfcoytlmDeaueil(0texr(m ny4altemics ( a2tm(mpoo0aeenifcild m2rauvpn(0 rermfciytlmteaueils)srxmir iy1al n nvt tf rrmump;t1tetnmiciasls rmn p u4 leomrciotfat an i s0 2tr(m3iy1lltnlnei ( s2tm(rpnu1oltoio3iltfaDemums u) lxrxf oy1lp  ai o ()srum(m3io1lm  lfcslt a2urumono0ole ifeiad mDumn s t4 etomo3oodomD anei s seuo(r3oo4al  lictas)s2rm(m oo4altnif3iydla2rl(mpnu) etomfcoa1fatr nvs;s0setr(m nodlpenmiesasf Duaxr no0tpx io3ildfm elu s u0 lxrmr3iydopDe ies s)trtoimpoy1oltnmivt ( a2uaump;t0tlxnmfeias a rlums (0areomo3iytfp  an s;s)texoio oo4ol nmivslt)s2rmur ;o0apeoif3iytfaDrau s;(4 rtrio3iotfpt aivo t) euo(r iydlp elies t)s2tau pou4tpt moetydfm rmuvon()tltoioctytfptelivo (0seuo(rpiu4lpen fei s s2uaxrpnu1tpxoif3tytfaDranvs (0tltnio ootomtelnvo s s2tmxm3nu1aleelfesas)a2trum ou4aex ifeild s2em( p;u0tetomo3iotfaD aneo;(0texmxmpiy1alte ietls)sDuax p;u0tet miciltfmDuauvs;u4 rxnmr to1oa rlnvs t)srxmxrpnydlle mncia()sDtaxmooo4alxo ictysfa2elnvpnu0aexomo tadfatrliei t0tetm(o3io1am  mfviasfsrururpno1ape  o3ilslmDrl( sn() etrir oydop elnvsl( s2xr(r3iu1llenmiesas)a2rr(moot0oexn feildlm2elumpnt4aeeoxo3totfa e uvi t0 euo(o no4apt mnvt ()s2ua(rpnt1tptoif3iyt sDulnms t0trtoxoctydla  aivolt trxmio oo1amtnlicia() rumxro;o1oet ifeiaslm emn o;u4areoxf ia1fa r iei;t trtrxo3nudoptnlnetlt srrmum nu0tlxnmf3iytla ea(vs t0aeeoio oadlateliesls)srurir3iy4lpe  ieiat)sDtmxrpnu0apto ictytla em(vs;u)arxnxrcoa1fmDe i o;()srumxrpny4amtelneia(f 2rm(ront1ole moeildls rmuvpnu0tltrxfcio1oaDrauvsl(0teto(mpiy1ope micsls)srurxm ;t1tetoii3tlslsDuaump;u)artrmr3tydoa rauvi;t tetm(o3nu1lpe  fcsl(f rua(r ou0opx  fciltls2ea( pn()tltrir3todlpD ln s (0 2urxmpiudlptnmfei t)sDtmxmp;t0oeeo o3iytlm rmuvo;t0aetoxf ootla elieilt0 exo(r3io4ol  lnctl(fa2trxmpnu1olenmi3iyt m2ea(mp ()trxomf tadfpDeauei;t  2xoxopny4omtelnct s  Dra(m ;t4altnifctydls2umumsn(0alermf3todlmD  ueo s0 2xo(rpiu1openlici s  rra(mp;o4opeo i3iydfm2eanmp;u)aetnircootla  li i;(  rtm(o3nodape  nesa( sruaxmp;u1alxnifeiadfa2ea(msn(0alxoxr3oodfmDrlueslt s2ur(r io4omenlivt ( sDuaxmpoo1optn octldls umnms u4aetomf3iydoa r i slt)teurim3nudal  lieia()s2tau ont1tlto o3tasla2rmu onu4artriocoatfmtr u s;()trto(r iudope  fetl( aDrmu  nu1altomiciasfa2emnvs (0 ltnxrcta1oatranei t)s2xr(opno1amenlicsls)artax  ;o1apx  feils mDulnmp;u4teerirciadom elu ol() rxmim3nu4apt mfcs sf 2ra(mpnu0tpx  ieias m umnmo;u0 rtnio3oo1fatrai il( texm(m ny4op emfcs t)artru o;o4altn fciyd s ulnms;(4 etrio oa1lmt  ivs t0 rxmiopoo1aleelieil(f Dtrxrpoo0texn ietls mDrmn p (4trenmocoodlptelivolt  2tmio oodlpt  fct tfarurur ;t4open o3tltfm2emnvo;(0texrirctatfmDran ols  rtm(opio1oltnmieilt  rta(mpou1tet  fcilslsDemn o t0aeeoxfctytoa   i i;( t2tmio3iudlpe mnct ( aDum(mpoo1texnifciadfaDel(ms;(0alxrxr ootopD  ies;t t2to(o3nudop nmivslsfarta(ro;t4ape  octatlsDrm(vp;u)tltoircoadoptrlivi (  etmxm io1oltn nvsl() 2taumo;u1opx mf3tyd a ulnvpnt0aeeoxf oo1fmD  i ilt t2uoxm io1openlnesl()aDur(r ot1aptn ociyt s2rln s;t0tlxnioctodfpDrlivi;t0texr(o3iodol emietas) Drrumpno4altnifetydlmDrlnmo;u0aeeomfcoydomDr uei;( teumimpnu4lmee nei t) Drauro;t0oleomoetytfs eanvs;u0 ltnif3oa1fpDraueo ( s2trxm3oudomenlncs ( sDua(mo;u1tpt  fciat s2ulnvp (0 etrmf3tadlpt an olt0 euo(m3ou4amenmfvia(f rur( pnt1olenio3iltfaDeln pnu)tlxrir3tadopDe u olt0 2toir3oodopte fctat s2trxmoou0apx mieiltlaDem( onu)aleoxfctadlp   n il(  exmxr iudalte fci s aDumx ono4tpen oetad m2uan pn() exoiocty1fateaivs (0 eur(o3oo4alte iet s) 2tmxmpot0aex moctytlm2rauvs;t0texrir iytfmt lnesls0srtrirpou4lltnlnciltfs2ua(m ;o1aetn o3tlsfmDrlnmon(4texoirctytopDelivi (  etmim3oodaptemicslt)sDum( pou1aex iociysfa rm( snt)artnif ty1fptrlues s0 2tr(m oudale livs t) 2uaurpnt0teenifetld s2emnvp;t4 rerio tytomteau s t0 2um(mpiodolte fcil( sDuaxmo;t4openmf3tlt s ran pnt)tlxnif iy1la e i o;()trxrxmpiy4ape mfcs t) rua(m no4tee  oetlt a rmn s (0aleoif iy1lp rlnvol( s2toxo3ny4ol   icta(f rrrxmo;u4olx  ieiadlsDumu on(0 rtomr3oydomte i ol(  2xoxrpou1aleemiciat arurx o;u1oexnmiciyd m2elnmsn()aleoio3oy1fa e uei;s s2xo(mpoodam n fvias) rraxr nt1olx  fctys mDemu s (0aeeomf3iatlm e ivo;(0t2uo(o ny1llt lfvils sDum(r ;o4texoiociltlm rmuvon()teerioctytfa rlneslt srurxm iy1lme mfvt sfaDtmumo;o1teen f3iyt a2el( on() exoxfcootlm eanesls)t2urxm3nu4olte fct s a2rr(rpnt0aeeo i3tadls emnmpnu)treoxo3tatfm  lu o;(0trxrio3nydapt  nctatf rrmx p;u4oet  ocilsfm2elump;(4aleriocta1la e neo t)sexr(m3nu1lme mfvil()aDta(  oo1ole io3ias a2emnvpnu0artrif3oo1fm e ieol(0trtoxm ou4llt mivi t)srumx ont1apxn iciys mDumnmo t)trtrmr io1opDeaueolt t2xm(m3oudopen nvta(faDra( o;t0optnifciysla2emu pn() lxnir3tydop ean s;t)trtmxm iydlp   fctl(f rraxmoou4tpxnmoetldls2umu pnu4 etomrcio1op raivslt)srumiopiu1olt mfvsl() Dta(root4olxnmoctldfs rl(vo;u0tlenxrcoa1fp rauvsls0 euoim3oy4ome  neiatf 2ta(root0oexoif3ildfa uanms;(0 etnio oy1lmt au o;s t2xrio3iu1llt mfvias) Drru  ;o4oexoifeiad s uanvs t)tetnir ta1omDranvo t0 etmim3oodoleemfvi (fs2trur ;u1olxnmieiaslaDelu ont)tlenircoodfm r ies t srtoiopiy1oltn fcs sf 2tm( o;t0alenmicildlm2rm( on() etoir ia1fa   u il(0srxoxm iu1ll elfetatf 2ur(rpno1texnii3iat s2ua(mp t0artrxr3oydfp e u o;t)s2umxrpnydomt livs s)a2um(mpnu0opx ifctadfm rmu snt) rxrmrciytfpDranvs;s)s2xoim3no1lpte fes (fsrtm(  ;o0tlenmf3iydfa ran p;u) lxriocoydomDr n ils) rxrio3iydoltnmnet s s2urxr ou1opx iocild mDul(msnu)alxrxr ty1fat  uvols)trxm(r3iy4ll nlietas sDra(m ;o4tpx mieiaslmDrl( o t4 exrxr3iodopt lu s;s0 2ur(rpou4am elivsas sDrmuroot1oexomfeiadfm2rm( p ()tltnxo3ootlp e ieolt) rtoxmpiu4ape mfvs tfsDumumpot0apxomiciltfa uln p t0teenif3tatom r uvi ( t2tmxr3ny4opeemiesl()a2ur(r nu1tpx  f3tltfsDumnms t0 lermf3oadlaDr ivsl() eumio ou4lm e fcs (f 2taurpot1aeto f3iad mDum(vsn(0trerio iadfpD  i s t) euo(m nudlle lnesl(  2truroot1aexoif3iydfm2ulu on()aeerif3oatopt lnei ()t2ur(m nydopt mfctat  rtrxmp;t0opeoiieiyt mDra(vont0altomf ia1lm eau i;s) rxm(opio1alen fciltfsDrmu pno4tlx mf3ildlm2elnvs u4texnif3iy1opt  i ilt texmxr iudoptn ies tf Dtrxrono4apenifctytfs rlnms;t0tetrio3tatla elivo;s)texmio3oydop n netlsfarur(m nt0openif3ild mDrlu pnu) rxoio3iatfa rlu il(  rtmir io1apen ieil(fsrtmuro;o4tlxoio3tatlsDrauvp;()aetnmr3oatfp  lu ols trtoxr3ny4op  lfvias aDraxroou0olt ifctltfsDum(vo;t)trtnmocoo1fmD  i i (  exrim3no1amt  icsat aDuaxmooo0alx mf3iyslaDeln ont)arenxrcia1oa  ln s;t) rxoxo oodlm nlfet t  2rax oot1aex iociasfs emump;u0 ltrxfcoy1fpD lues;( s2umxr3oydaptnmnci s  2rrx  no4alxn feiaslm ranvs;(0 rxrif3iydomtr ivs;s0srurimpiudalenlnct ()s2urum ;o1tpe iiciytlmDumnmp u4 renmfcty1faDelivo s0texo(m3io4lme mncils  Duau  nu0optoiociyd m2rauvo u4trtoio iy1opt auvi t) 2tr(r3no1lme livils) rrax pnt4texo iciyd s2um(mo;u4aeeomr oydlat anvo s  2xrio3iy1lmee ici (f 2rmuro;t4aeen o3ils a2ea(vpn()tlxrxr3totfateluvi;s0 eumxm3oudapeemnvi t)arua(r nu4texn ieiatfsDemu o;u4tlxrmf tatfmDraivsls  rur(o3iudop nmfcsasf 2umxro;u1oexo ictasla um( p;()aexnif3oadlaDr nei;( s2xmirpoy4am elicsl( srtmxr nt1aeenif3tlslm2ulu pnu)texnif iodfmDe ueols  2tr(rpnu1opeelfeil(  Dtm( o;o0apen iciatfm2ul( s t0 rxoxf tytlmt auvo;t trxm(mpoydol nmfetlt srra(m nt1apxnifetysla2emnms;t0texnmr3oydfp  livs;t)trumxrpiy4op nlnei t  Duaur ;t1tpt ii3iasfm2uluvpnu0 ltoxocoa1om elueo t texoxo3iydllt licta(  2rruronu0ole moeiltlsDrmu o;t)arxnir tatomt ln ol(0 2to(m3nydap nlfvi ()artaumonu0tlenifeiyd m elu s u) rtnxf3todfmD  ieo (0t2tr(o3nu4lme  fesltf Dtaxmpnu0olx mietlsfs el( o;t0trxoxo iytlm e n ilt0 eurio oo1lpen fctlt)a2ua(r ;t0tetnmietasfsDrm( p;u0artnxr iadlm raivi;t truo(rpno1lltnmfetlt  2um(mpot4tlx moetlsfmDel(ms;t)tlxoxo todopDe ieil(0 eur(r nu4ol nmnetas)aDurx oot1apt io3ild aDrlnvp u)teerir oydlpDeln i () rxo(rpoy4lltemfeias sDur(m nt1aetoifeiyd a2eluvpn() leomf3oa1fpt ai i s  rxr(m3io4olt mfcia()sDrmx onu4aexomfeiyd a2ranmsnu0treomfcoatfp e uvsls0s2tm(opio4lpe liesatf rtrurono0alx mieiatfs2elnvpnu4tetrircoo1la rai o s)sexmirpoy4opte fctls)arua(rpnu0aexomi3iyslm uan s;(0aeeoxr oa1fp elu s;(0t2umxmpoydalen ivt s) 2rrxr nt4opt  oetlsls2el( snu4arxnmo3oodfaDe uvi ( sexmxm nydlptn ivslt  2rrurooo1tptnifeiadfsDum(vsnu)trxrmoctatla eanes;t)s2umxo3nu1ll nlncsa()artauro;t1tpt  iciatfm rln pnt4 leoir3tydopDeauvs;( s2uoxmpoy1ap nmnetat  2tm(root1tlxo o3tytfsDum( p;u)teerifciatfmtrlivo t  rumxrpou1lptnmfct t  2ra(r nt4oleo feiytla2uanvo;t)texomociy1lmtean i t0 rurim iu4llee nviasfarra( ont4tet  f3ils s2el( pnu4 lxnmr totoate ivs;( teurimpio1apenmietl(fa2tmx poo0opx mfeiys m2ul(vo;(4 rtriociodomDeau sls0 2xoirpiy1ape  fcias) 2umur ;u0tlt io3ilt s2ul(mon(4arxrxfciotlpDeluvs (  2xo(r3nudlp   nct ( arrr(  nu1olxn feiatla emnmp;()trenmfcty1fmD anvi t0 ru
\ No newline at end of file
@@ -0,0 +1 @@
+nvo;s)s2uoim oy4om n fciltfaDrrxr no1olt  iciyt a2rmn on(0teeomrctatlpDelnei;s0teumxm nydale lnvtl(fsrumurpoo0tlenmf3iys sDrlums (0altoiocto1om   uvils0tetr(opiy1ale mfvt (f Dumxr nu1olx ifeiatla2rl(ms;(0aeenio ta1fmDraiei;(  etrxm oo4ome lfeilsf Dtr(mp;u4aeeomo3iatfm2em( o t0artnio3tadfmtean il(  exmirpoydlmt lncslt)srumu o;t1opeomiciydfm2uln o;u) eeomo iytlp  au i (0trtoxrpnu4am elneta()arraxr oo1oeenmoeiydla el( o (4artoio3iy1op eai i t)trtoio3ny1omtn nvs t)srumxm ot1apt mociadls2raumo;()teerifctytla   nvi;t)s2xmim3iydom  lictlt sDraumono1tptnio3ilt a2ulnvo;u4 reomr todlmD luei;s)s2xrxo3oo1op   nvsatfarur( ooo0opxo ictasfs el(mp ()altnxocootfpDeaieil(0 2xmxm io4lptn nci ()srtrur oo4aexoii3ilt sDelnmpn(4 exnmfciytfptrauvi;s  2to(r3nodlptemiesas arur(rp;u0aleoii3iltfmDrl( o u)tlxrxf oo1optr n i;t t2tr(r iu4ame lnei ( artm( o;t1alen i3tas a2rl(vp;u4trxomo3ootoa   i o t  exo(r3iy4alee fcsl(fsDtaur ot4olxoiieiadlm2rl(mp u4trermr3oatfat auvslt0setmir3nu1omtelici s) rumu  nt1tpxn feiysla2ulnvp;u)alxnmf oy1la elivs s)setrxm3ny4ll nlfvsa()a2raxrp;t0optomicilsls ua(ms;(4texoxo iotfa elieslt)srtr(o3ou1ap   fesl() Drau o;o1alxoifcils m2uanmp u4teenmocio1opt lueolt srxrir3ny4omt lnei s)srumu  oo0optnmf3ils s2uanmo (0treoxf ia1laDrlneilt)t2toxrpio4omenlnesa( s2tr( ont1opt io3tltls2rmums t0 etomf ia1fp rauvo t trumxr3nodlm n ietls) Durxro;t1olx ii3iltfs em( o;t4trerxf ia1fmD  ueols)s2uo(r3ou4optemfeiasfaDur(mp;u0texomoeiadlaDranvs t4arxrmr io1laD livsl(0 etoir3iu1opt mfet s) 2rax onu4openmoeiatlm eanmsnu0teenxr3iytomte i i ( trxoxo3iy4apt lnvsatfa2rmuro;o1apenioetad a2um(vp u4 etoxr iadfmDrlneolt0seurxopoo4apen nvsls)srtau pno4ale  ieiyslm2ua(mp;u)tltrxr3ta1lmtranei ()teum(r nodaleemics ( arur( oou1altniieiys sDran pnu)tetoxr iydfmtr ueils trxoir3nydamtemiet t  ruru p;o0apen ieiyt mDrauvp t4aeeoio3ia1opDr u s;s trum(opio1oltnmieilsfa2raxm oo4teto oeildla rau snu)arxnmr iydfpDean s;( t2umim3ou4lp emivi sfarumxm ;t1apx mf3ils aDeln o t0tlxnmr3to1fatran s;t) 2xoio iu1ole mnci sf rtmx  ou4tltoioetyt a ulnms t4alxomrctadlpt lnvi;s0t2tmio3iy4omtemfvt sf ruru oou1teeo o3iysfm umumsn()artrifctatlmtr ieo;s0 etr(o3ny4ol   fvsa(fsDua(mp;o0tltoioctlslsDeauvs;u4aexomocto1omt livi;(0 2tr(r3iudopt lieilsfsrtmxrpnt1aexn oeild m el(mo;u0tltnirctodfpt lueo;(0 rtoir3oodaltemfvi sfs2taxrp;o0opxnmf3iydfsDrln pnu0texrio iodlmteluvo;()trxoxr3ny1lm  mietas)a2ur(r oo1aleo iciydlmDum(mo;t4aeeoif3todlmDeln o s0t2xoxrpno1olee ivs sfarta( pot0ope  fciydlm2uluvs t4tlxoxo3to1omt luvsl(  2xoxrpiy4ome lneiasfarta( ono4tpto ieiat sDuanmp (4treoif3iatoptr ivsls0 2tr(r3oydlm  mivtls)aruaur nu4aetnmo3iatfs rmuvsnu)treoifcta1omD  nvs;t0trtrio3nu4lpeelies s  Durum oo4tpx  i3iadls eauvon(4 lxnmr tatomt aues;t)t2xo(m3nu1altnlicsat aDtmxr ;o0tetn ociyslmDeau o u0trermr3iy1lm raueo;()t2xrim3iudope  ivtatfaDrmum ot1texo f3iasfm2emnmo;()aexnmr oa1oaDr nvs ( texo(r3oodaptn iesas)sDurump;o1oleo ictlsfa2uln snu4 eeoio3iydopDe uvi;()t2uoxopno1amtnlnvil(fsDurx pnt0apt  fctadlmDrmuvp t4 rtnirciydom  liei t) 2umxopio1al n nctltfa2uauro;u4tlt  fetatlm rlumsnt4arerir3oadfpDe uei;( trxrxo ou1op elfci ( sDur( ooo1opt mocild m2umuvs u0tltrmocio1opt anei (  etoxr ny1ole lfet ()aDtrxmont0aetomieiysfa2rm(ms;t0trtoif tytlp  lu i s0texrxm iy4om e nvia()aDum(mo;u0tptniictlt m2um(vo;(0altoxoctytfptr i i t  eurxmpio4lp n iei ()a2rmxro;o4tlxnmf3iasfa2ranmsnu0 etnif3to1lm   ivo t0texoiopiu1lptnmfci sfa2tau pot1tltoio3iasla um( pnt) leomo to1fmD  uvsl( t2trxm no4lm nmncs s)arraump;t0tpe mictlsla2emuvpnu4aeenmr iodlpD au s;t0seuo(m io1altemfvslsfa2tr(ront1oet  octltfm ulnvp u4 reoio3iy1op e uei;s)trurim no1lpe mnctas a2ur(  ;u1aeen o3tat aDrlump;u4trerxo iadlaD auesls0srumirpno1apt  fctlt s2ta(mont1opt ioeilslsDrluvo;(0 eeomr ty1op rlueo;s0tetoim3nydame  nvi tfs2tmuro;t0aleomfctatlsDelu s;()trtnif oydopte uvs;s0trxoxm3iudom  liviasf 2tm( pou1aeen fetldfs umnmp;t)aexoxrciodlpt lnvol() eumxm3oodomtnlieil() 2tm(  nt4teenmieiysfs rmn snu4tlxoiociy1fp r nvi;s s2xrxo3oo4lme livia(fsDuaxm ;t0apxnmictld s2rm( s;u0tleoxf oatlptelnvs;t) rxrxmpno1ol elivsa()sDtmuroou1apx iiciytla2um(von(4teeoxfcootla r i i (0s2uoim io1op   nviltfs2rm( o;u4optoifetad sDrmnvs u) lxoifcoa1opt anvi;t0srxoxm3oy1om nmfctl()a2tm(mpou1oexnioetls aDemu p;u4 ltnxo3to1op r n s;s setr(m ny4omt  fetas)aDtmx oou1opxnmfcilsfs ul(mpn(4 lxrif3todfa  aivi;t0setrirpoudlm  mncslt sDuaxm ;u4texo ocilt a uanvpnt4tlxnio ty1lmte ies;s)sruo(r iu4ap nlfcil()aDtmu pot4aptoif3ilsfaDra(vs;t0 exrxf ia1oaDrau o;t0teurim3iu4apenmnvtat  2tmxmo;u1openmocilt mDelnmp;t4 exoio iadlmD an i;(  rxoxm3oodlm  lneta()a2tau  nt0olx ii3iatls2rl( o ()altoiocoadlm rai s;s0 exo(mpiu1omtemiei s arrmxmont0oltomoctld mDranvonu)trenif tatfpDr iesls0 etoxr oy1ol nlietasfa2uru p;t1aexo oeiltlsDul(vp;t)texnmociy1lpD lu s;s0srxoxr no1ome  fcsltfaDumumpnt0opxniicilt aDel(vpnu0artoxo3iodopD lnei (0seuoim3iudomee ietl(f Dua(mono1tetnmo3iltfaDrln s t0trerio ty1faDr ivi;t t2xr(m nu4om  lfetlt  rrrurp;u1alen i3iysls raumo u0tlenir3ia1fpDrau o;(0texr(r nydap emiei s) rrrumpno1oleomo3tltlaDrau snu4tltnmr iodopDe i ilt0setm(opiy1opt lnvsasfsDtmurpnu0optniociadla2em(mp;u)teenio ty1lpD luvo s  rurxrpnodameelics s  2tmx p;o0olto oeilsfs elnvo;t)tetoxr3oodfaDeaues;t0 2ur(r3oudom n fei sfs2rax oou0teeomicilsfmDulumo;(0areoir3iy1fp eli s;(0truoim nudlp elnvsl( sDururpnu0opxo feiyd m ranmp u0trxnio iytoaDrauvi;s  2umimpoy4am elnetlt s2rmxr ot1oexomictydfm2eluvp u)trtrir to1fmtrlneolt) 2tm(r3nu4oleelnvsa( aDum(r oo0tpenmieild m2ul(ms () exnmf iadlm eau sl()t2xmxr oy1ameelfvta(f 2rm(monu4tpe moeilsfa ra(vont4 leomrciadomtraivo ()sexmim3iy4om  lfci s arraumpnu4opx  oeils s2rauvs u0 eenio iytfpt luvs s0 2uoxm no1ap nmics tf Drrum ot1alen i3iatfs2uan o;u0 rxnir3oadom eai s t)srumir3iu1omeemieia( a2ur(m nt1tpx moctaslm2ua( o;u) eeoio3oa1omDraueolt t2to(m3oo4opt lncsl( s2rmxrpnt0ope ii3iadfsDemn ont) etrirctadlmtr n s t)tetmirpnudamenlfcta()a2rmxrpou4olt ii3tls a2ranms t0 eeomo todfmD li o;t0s2xm(r3iodal   ieiat a2rmu poo4tlx if3iydfsDeln pnt0tetrxr iydom  lu i;(  exmxo3nu1al n ncsas) rumx ont4oet mf3ild sDrmuvo;t0 rtomo oytlpD  u sls trxr(mpoo1ole  fesa() 2tr(rp;u0alto fetatfa rluvonu) lxomr3oo1omDrauei s) euoxr ou1omtn fvt (f rtaur ou4aee  fcils m2rmn s;t4arxomf3totfaDe nvil( srtoxo3iy1al   fei s)aDtr(rpnt0apen i3ilt aDua(vs (4trxrircto1omteln o;t0trtm(m ou4apt liciatfaDraum ;u0optn o3iydlm uluvp;(0 lxnxr ia1fpD auvsl(0 rtr(m3oo1lmte ivs (f rrrxrpno4aeto o3iys sDra(vp u) lermfcoatfm   uei t0 euoxo3ou1lle liet ()aDua( pou4tlx mfctatfs ra(mo;t0trenmr3oatfpD lueil( s2urir3ny1al n ietltfaDta(mpno4oetnioeiltfs2em(vp t0aexomo iadlaDe ueol()t2xmirpiydam e ictl(fs2um(mpoo4aetnmoetat mDumnmp u) lxrxfcootfpDe nvs s)srtrxo3nodam  miet t) 2rmumo;u1apx moeias s2rm(monu0artomf iy1omDe u s s  etmxm3no1aleelfetat) 2ra( p;o0ole ifciyt aDrmuvs (4trtoif3tatoaDeluvol(  ruoxrpio1optnlfvilt  2rau ooo0ope mictyd m2rm( sn()alxomrctytfmDrlu s;s trum(opoydomenlfvtl() 2umum ;o0apenii3tas m el(mp;u) ltoir3ta1lm elivils0setm(r iodopt lfesatf Draum ou4teto ictlsfmDum( pn(4 eenio totlmD  nvo;t t2xmxr3io1lptn ies ( srra(mpoo1olt  f3iasfa umums t4teenmf3oatomDr u ol(0texoio nydaltnmnei t)srumxronu4tpe mfctatfs2eanvsnt4 eermr3iotlpteaivol(0srum(opnodom   ivta(farrmu pou1opxnmieiltlmDemnmo;(0 lxoxfciatoatr i o s)texrxrpnu4lmtnmfetls)aDurur ;u1apxomictytls2emnvo (0alxoir iy1lm r nvs;s0 rxoxo3iydapenmfcias) Dtrxr nt0aleo i3tlsfsDra(vo ()teerif iydfpte u s;s  rtr(r nydlmenmfetatf rurum ou4aeeomfctatfa2umumo (0treoxfcoatfpDr nvsl()s2xo(opny4lp nlfes t)srrm(rpoo0optomoetltla2eanmpnu)tlxnxr3iydfa   nvol() 2tm(r3oydom  mivil() 2rru  no1tpx mi3ias m uaumon(0aetnmfcoodom   ieo;t0 2xrxopou1lpe micsas  Dururoot4oet  fetasla ul( onu0 reomf3iatfp eaivilt seurxm3iu4lptemfci s)artmum nu0tee  iciys m ulu p;u4texrxo3iy1lmDraivs;t0s2tr(m3oo1aptnlnetas)aDurx  ou1aexo fctlsla ul(ms u)tlenxr3oatoaDe n s ()s2xm(m3oudamtelfctlt) Dua( oot0apx if3ilt s2ul(mo;()tltnifciytfp   uvolt t2tmirpny1op emicslt sDrmxmpoo0olxoioeias a rm( p t4 leoxf3oa1optr ivi t0 rto(o io4omt lfesat sDta(mp;t1teeo fctys mDua(ms;() ltnmf totfpD luvs t) rtr(mpoodalte net sfarrmumpnu1tlxomocildfm ul(vp u4tlxnxr oa1fpD  ivils0tetmxm3ou1alteliviasfa2rm( ooo0aex  feiysla rluvsnt4 reoxo totopDe ies s s2uoxm3iu1lm e fct t) Duaxmo;o1tpen fciysfmDrl(vp;u4alxrmocoodfpDrlieolt0setrxr3nudomtelnvsat  rurur ou4aexomo3iysfm2umuvpn(4trxrxf oo1op eauei s0 2um(mpou4opt lici ()srur(m oo0oltoioctasfm2elnvs u4alxomr3iatlmteaivi;(  rxo(m3iodlmt liei s)aDraurpot1aeenmo3tyd sDranvs t0 lxrio3tadfa e ieols)sexmimpoudamtelneils s2umxroou0tlx if3iad aDum( snu0 rtrmr3tytom elieil(0sexm(m oodom   fvtlt)aDra(rp;o1opeo fetatlm uanmp u4 exnir3iatom eai olt0t2urimpnu1llt  nviasfs2tmxmo;u1apt mieiat a2rm(vo t0 ltomf3to1opte n o t0seur(r iy1ap  livtat)sruru poo0aleoii3iadlm el( snu4aetnmocootfaDeli s;( srtoirpou1ome  fvtltfaDtax o;o4ale  feiytls um(vo;(0alxnif oytfmDeau s;()teurxo io1altemivtl( srrr(mooo1aetoiietysla ean o;t0 etnmo3tytfa raneil(  rxoxo io1amenmfesa( srrru  no4alxoii3tas sDem( s;(4aexomf oy1oatrlieol(0 etoiopiudopenlnct sfa2tau p;t4aee  feias sDeluvp;()arxrmr3oatlmt luei;s)sexoio3oy1omt  nesltfa2trurpnu0tpxnifeiatlsDuanvs t0 rxniocoy1lptrlnei () 2tm(rpno4olen netatfaDraurp;t0tpeoifetltfaDemumo t4aeeoifciodfpDeaieol( seurxr iodlp   icsl( sDtmxro;u1aet  fcias sDeaums;()aeeoxf iy1fptr ivs;()seumir3iudlmtn nvs t)s2rau oot4tpe  o3iydla2rlu ont0 ltrio3iatfmt  ivo () 2xm(m3iudoltn nvi s artaump;t1aptnmo3iltfm2ulnvo t4tlxrif3oatfp r u ils  rurxmpnu4lp e nvi ( a2uau o;u4aetomieiydfa2rl(vsnt4trtoxf3totlmtrai olt t2tmxopiu1op nlnvslsfa2rrx o;u0tpeo oetas a emu p;t) rerxrciodfptelueo s)texoio3iy4ome lieiltfarrmurp;o0aeeo o3iatfs ulnmon(4 etrxr oa1fatelu il( t2toio3no1lpenmnvsas sDtmxm nu4oex  fciadlaDrlnmp u0aeenmr3oy1fa eaivi s sruoir nu1opt lfes sf 2ra(rp;o1olt ifetadls em(vs u0trxnir3iytfmt anvs;t  etoio3nudapeelnvt ()aDrr(m ;t1tle  f3iasfaDea(vo;u)altnmo oadfmt  u i;t)trtoxopnodap n fesat)aDtmx o;u0texoif3ilsfmDulnvp;u0tlxomo3to1la  lueols) eurxopoydolt mieils)srtax  ot1olx mocils aDrm(vsnu4aleoifctytop e nvols0 rxr(mpno4op elnetl(fsDrr(r ;o0opeomi3tydfm2rmn pnu)alxoioctydomDe i o ()s2umxo3ny4apenmneils  Drax  ot4opxoifeils mDelnvp (0aetrifcootlpDelieo;s) 2umxopiu1ape lncs (fs2rr(mont0aptn octadfs elnmsnu)arerxo3oydlpDeli i t0 eto(r3oo1ll nmfvsls  2tr( ono0opxnmfcild s rmumpnu4tlxoifciatfpt  ueo s0t2uoimpoydlm nlfct t  2urxm ;o4olxn ictyd m uau p () etrmr ootlp eai s;s)t2uoirpny4alte icil() rraumooo1altnmfeilsfm2uln p;t4 ltrio3oytopDelu sl(0s2xrxo3iu4alte fcs sf 2rmurpnu4olxoifciyd s2rl(mo t0aetrxrctydoa e i i;t) 2xoxr oy1om n fctas) Dtruro;o0opx  feiytls2um(vp;u0 lenirctadop rlu ol(0 2xrxm3iy4llen nvsltfa2ur(rpnu4apen fciytls em( p;(4tltnmrcta1lpte ies t  2ur(m3oodlpeelfvtat)sDtr(mont4alxn oetatfaDul(vs;t0aetoxrctotomtelueo;t0 2umxopou4amen feil()srum(m ;o1oltnmi3iys aDeaump;(0trerxr iy1lpt luei;( s2xrio no1omeelfetls)artr(ront1aexo iciytfaDuanvs;(0 rxnmrctydoaDeaivs t)sexoio3nu1opee fvt s)sDrmx pno1alxo icils aDul(vont)teerif3iodlat aivils0s2uoimpoy4aptelfctls)arraxr ot1alto icils s rmnvsnt0 reomr3io1lpD au s;s)t2xrxo3iodoptemnes ()a2tmu  ;t0opto fciaslsDra( o;t)altrmo3iodlaDe ueols0tetr(opio1lm nmfeslsfaDrr(ro;o4tle  f3iyt m2em( on(4alxnxr iy1optean i ( t2ur(o3io4ap  mivslsfsDrax ont0oexnmocilt m2umnvs u)arxoxfcoatoaDrln il( t2tmxmpiy4oltelfei sfs2tm(mpot4tet io3ilslaDua( o u4trenmf oodlpD anvs;t0 2trxo3io1lmtemfvsls) 2tr(moou1oleo ieiltls emn s u0trtnxo3tatlpD au o;()srtr(r ny4lm elivil(f 2rm( ono1aexniieiysfmDemnmsnt) rerxr oydlmtranvs ( srurxmpiydlmte icsas  2rrumooo4apeoio3ias m2eau onu4teerxo3oadfm r neo;t0 rurxrpiodom  livil( aDtru pno0tetoio3ildlaDulums;u0 eerif3ty1oateluei;t0 ruoxm3oydalen fcs t) Duaxrp;u1tetnmfeiydla uluvo;() lxnmf iatlp eaieo s) 2ur(r3no1ap nmnesat)aDtm(r nu1alenmf3tld mDeanvo (4arxoxf ta1oaDrluvi;()teuo(opiu1op emnctasfsDrmxmp;t0texniieiysls emu on(0alxomfciy1fpDeln i s0t2umxopoudamtemietlt)a2ra( p;o1tetnmoetytlm2uanmo;(0arxniocoodla elieolt  2xrxm oy1altelfct t) 2urx ont4alt mi3iadlaDulumo;t) eeoxo oodomte ues t)srtoxr3iy1lptemfcsl( aDurxm nu4oetnmietydfm rauvs;(4tlxrif todfpte nei (  2ur(o3iu4lmenmivt () Dtr( oou1texniieiasfmDeluvs (4 lxrmrcto1fmD auvo;s) rurxm3ou4omenmictatf 2raxmpot1opx mi3iad s2rln s u0 etnifcoo1om rlneo (0 eurxo3no4am nmfetat arrau ooo1teen oeilslsDrm( p;(4aetrmo oydfpDr ueols0 2tm(m3oudale  fei t) 2ra( oot1oeeomictyslsDra(mpnt4 exoxociodom  au ilt0teuoiopno1ol nlivtls) 2ra(  ot0aet ifciys a uluvp;t)tltnif tydfptrlieo;s trtoirpio4lpe lfei s srtrurp;u0tee iietydls umnmp;(0 leoio3ta1oa rauvs;s)sexo(m ny1omte nesas)sDtrum ;o1aexomf3iad a2uan s t0 rerxo3ootopDrlu sls0trxoio no1olt lieslt) rurxmp;o0tet  i3tadfs2rmnmo;t4alxrmo tadla eai s;t0 etrim3io4ll  lnvtlt)srrr(rp;t1ape io3tlsfsDumumsnu0texrmrcoytla raueo () 2toxmpno1al elneil(fsDra( ooo4tee mocild m eluvo;(0trtnif3tatoateln ilt0 2ur(m3no4al   fcta(  Dtru  ou1tex  o3iadls2ua( p;(0tltnmrcoo1lmtrlieo;t0 2tmxm oo4lp  lfei s)aDrrx pnu4teeo iciasla rm(vo (0alenxr3iotfp r i s;( t2xo(m3ou1lle lnvi (fsDrm(mooo1olenmi3ils aDrauvon(0 exoifcoy1om eanvs;t  exr(rpiu1lltelnetl() rtmuroou0oleomfctysla ua(vs;(0tlermo3oatop  lueil(0srurir iu4lmt  fvtls) rtruronu0tptn f3iaslm2emnvsn(4 eenmocootopDe ueil()seuo(m3nu4lmee iet ()aDra(m nt1aetomf3iasls rlnmsnt4tlxrxr3oadfatr i o ()srtrxrpoy1lpee ncs (fa2tau  no1ape  i3iad m2eanms;u0 exomo ootfptrlieol() etoiopio1oltnmnetlt) Dtrxrpnt1tpt mo3ilt a uaums;u4aexoxrcoy1oa  lu s s  exm(opnu1op elfeilt srrau  ;o1oex iiciltfm uaumsnt) lxrmr3iytfptelnvslt)trtoxr oudlp e ivilt) 2umx ont1tle ifeiltlmDem( p t0tetrxr3oadomDelneils)teum(r oy1lm elictl(  ruru  no0ope  fciytfmDelu p;u0teeoio3todfaD  ieo s  eto(o nydap   ivs (fs2rrxrooo0tleomfctldls2rmnmont4teeoxr3io1fm  aieo t  exm(o iodlpte iesa(f rurxrp;t0opto feiasfa2rlu s u)tlxoxf3tadfp rauvs t0t2uoim ny1lm nlfcsasfs2uaxm ot0ape ioetlslmDrlnvpn(0 lxrmo3oytoaDe ivs;s0 exmxopno1lmt mictls)s2tmurooo0alto oeiydfs2ea( s;u0 rxnxf3oytopteliei s srtmim oy4amtn ncia(  rrmumo;t0optnmociasfa2rm(mont0 reoio oodfaDe ieils  2urxm3oudomtn net (f rurxmoou1aetoio3ildls2rmuvo u0artrmrcta1latraieils0 rurim3no1am nlnvslt) rrr(r ot1opxniieiltfs2emnvp;u0alxnxf iatlm eau s t seumxopiy4am elnvi ( aDta( pou4oexoiociyt m rmuvsnt4 exnmfcoa1fpDe ieils0 euoxrpiudlmteliei t)a2tr(mpnt0tle moctltfa eauvp u4trxnirciatfaDe ivol(0trtoirpnu1omtemnetls)artr(rpoo4tex if3iytfmDem(vs;() rtoxrciydom rauvs;s)s2umxrpnu1llee iesls srumumo;o1oee miciatfm2eauvp;t) eenmf3totlpDr uei;s seuoimpoy4lme  fvi ()aDur(moou0ope if3iatfm2rm(mp (0aetoxr oadlmD au i;s)t2umimpiudlpe mici t)sDrmx pot0altnio3iad m emuvs u) ltrif oa1omD  ies;s)setm(o nudom nlnvta(faDurx o;o4openiocildlm umuvs;u4 eeoif oytoptran o;t)sexr(o3oodlme  nvsl(  2ur(ro;t4oleoii3ilsfm2uan o;t0artrif oytop  livo;s  exrim iydaltnlnvtl(f rua(  nu1tpeoiieiyd a ean s t)alenio3iydfptr n o t0 exrxr ou4lp emies tf Durxrono1tpx if3tyd m ua(von(0 ltrxf3ta1omDe i s t0sexm(m3oydap e ivsatf ruaum ot0oleniieiltlm rm(ms;t)alxnxf iydlpDelu i;()srtr(o3oy4lpte neil(faDtmxmono0oex  f3iltfm ulumpn()tetnmo3to1oatr i sl(0truoio nu1omenmfeil()arur(root4tpx  oetldlaDua(von(4artrxfcio1fm e ues ( trtr(r3iy1amt lfeils)arra(  no4aexomfcildfm2ean p u4 lxrif3oodom   uvo;(0s2xmir nudlme mieslsfsDtr(mp;t4tpe  iciys aDemnvpnu4 lxoxr3iydfa  auvols0 ruo(rpnu1lp nlfes t) 2rmxmono0tlx io3tytfm2rmn pnu0teermf ia1oa e ueo;t0truo(m3iudoltelivi s s2tax  no1tex  fcildfm2ulnmp;(0trxnxrctydla eanvs t)t2trxo iydamte nvias a2tru p;t4oee  ieiytlm2eauvs (0aexrir3tatfp  aivolt)sexrxr oudlm elfes ( artmur ;u0ope  feiltfs rmnvsnt)areomociotfm  ln s ( srxm(r3ou1oleelivi (f Drauronu4tleniiciys m ra(vs;u0treoif oo1fatrauvsls)t2xr(o3nu4lmtnlncils) 2taxrp;o0ale mieilsfaDulump;u) rtomrcta1optrau i t) rxm(mpoudam elivta(fs2tmx  oo1tptnmoctydlsDrm(von()trerxr3todfa  lu o;t0 euo(r3iu4ol emfes (fsrtrumpoo4tpe iieilsfsDuanvont0artnio3tadoptranei (0trxrxrpiodlptelivtat) 2umur ;o1tlxoifeiadfaDrm( onu4tlxrio oytlmteau s ( seumxo3no4oleemfvt ()sDur(moot4aetnioeiyd a em(mp t4areoxfciytoptraneo;s s2to(o3nudopeelfetas  2tmxm ;u4tlxomoetlsfm2ulnvp (4aeeoiocoydlpD aivils0 rtr(opno4om  mivsas)sDrmu poo0oleo oetls a rauvpnt)tlermr oadfaDeaivo () exmir3iudale mnei sfartm(mp;u4opt  feiaslaDem( p t)treoifciotfm r n s t sexoim io4opt lfcs s)a2rmxroou4oetnmoetltfs2ra( s u4aetnifcootomtrlnvol()tetm(o3ou1lptemictltfsDurur ;o0tex mociadla emn pnt)arermrctadopDe ues t) eurxo3no1aptnmneil()s2raumpnu1tlx ifeiatfs ulnms;t4aexomf3tydoaD lnvo;() rxmxrpiy4ll   iesasfa2rm(  nu4aexn feiytfs el( s;t4 etoxocia1fmDrlivolt0 rtrirpny4ap nmici ()artm(rpnu0aeeo o3ils a2em(vont4trtnxo3iadlmDrluvslt0s2tmxr3iy1lmeelfet s sruax pnt4ope mfetadfmDrlnvsnt) lxomr3oa1lpD  n o t  2toxm3io4oltelivsl(  rrr(r nu0openifetys m2elu sn(4trtnxo oodopDeln s (0 rxr(o iy1ope mfvia()aDrau o;u4tpxo i3tytfmDra(vo;u)tetrxr oo1om r nvils)s2trxrpoy4ol nlneslt  Dtrumo;u4aet moctltlmDul( o t0tlermocoatop  ln o (0trumxo nydameelictltfaDurumpoo0oex  iciasls2uluvp u4 reomfcio1om rln il( setoimpou4lpeelncils)aDrr(mpno4tltnmoetat m2ra(mpn(4trxoif tatfatraieols)s2uoio3no1ape mneiasf rrr(mooo4opt iieilsfa2ea(mo;(4alxrmocootopt aivo t trtoxmpny4am n feils s2rrurp;o4openmfctadfs2rmump;t) lxrmr3ta1lp rlues s) 2xrxrpoo4amenmici t)sDrrxmooo4apxnmfeilsfa rl(ms (0 rxrir3ty1oate i sl(0t2to(rpnydop elnvil(faDraxro;o0aeen ietlslsDel( pn() etrxrctydoa eaies t0 exmirpou4op  lfcia()aDrau p;o4opxo iciatla emnvonu4aetnmocta1op r uvs t  ruoxm3oo4ame lnvsa(  rta(mpno0tpeoiicildfs rmu o;t) etoiociotla e nes s0t2xoxr3oudom  lfeilsfaDtmxmo;u0aeeoifeiatfaDem( p t0artnmr3ia1laDraivo;()srtmxrpnudol nlivs tfaDrr(r oo0tpe  f3ilslsDrmumon(0 ltoif oa1la eanei;(  exr(opnudame mnvslt)s2ur( o;u4aee mi3ilt mDemu snu)texnxo oadop eaieo;t0 2toimpoudope  icsls)sDtrx oot4apenmo3iytfm2eau pnu4trenio iydoa rliei (0tetmxrpiodlpeeliet ( srra( pnt1altn i3tysfs2uluvs;()tetnxo3oodfat  nvil()teum(r3oodam elict t a2rmurpou4tptomieiadfa2em(ms u)teeoif oatfptelneo;() rum(opiodlpenmictatfs2uaumpoo4tle mfeias aDem(ms t) etrmfciodomDr ivs;s)seuoir ny4amee nctat arur(rpoo4tpeomo3tlt m2rmuvont0artoir3ootfmteluei;s s2umir iudale lfvsl() 2uaur ;t4tetnmiciatlm um( o;t)tetrxo totfa e i s (0sexoim3nydoltnlfcta() 2um( pnu1tex mieild mDran o u0texnirctodlmt  n sl( srtm(rpio1ope  icsls)aruau ont1tle mieiad a eanmp;(0tlxoxf3oadlate neo;s0seur(m nu1alt lfvs t srur(mont0tltnmoeildfm2uaump;t) rtrir iydoptran s t trtoio3ny4lltnmies sfartaxmo;u4olen fetysfm uanvsnt4aexoxr3oo1la elneol(0t2tmxm3iy4amtnmncias)a2urxmpnu0apto fetatfa ulu o u)aeeoxr3iadopD auvs () exoim nu4om emies t) 2trxrpno4optoiocildlm ea(mp (4 etomo todla eanvils  rxo(opno1olenlncia()srtmu  ;t0oex mieiyd m2uluvpn(4 renmocootfp e uvs t0seum(r3nodame liesat)a2tmumpnu0tlxo ietysla2umump t)arenif tydoptrlies;t0 exmimpoy1op  licias  2umu p;o0tltoifctysfa2um(mo t0 renxo3oydlaDelies t0sruoio3nydal e fvt ( aDraurpoo1oexoifciltlmDuanvsnu)tetrxr oodfatelueo;(  rtrim3oudalte icsa( sDrru pnt4oltomfeilsfa2raump (0aeerxoctatomDranes s0srxmio3iudoptnlncsatf rrr(  ;t1open feildfm ulu s;t0trtoxr3oytfa e uei;s)truo(rpno1al   iciat) rum( p;u1tltomieiytls eau snu) eeoir3oy1fp ranvilt  exm(r3nu1altn nviat s2tau pno1opx  f3iat aDumu s;(4tetnxf iatlmtrlnvi;s0srurim iudlmen ies t a2raxm no1tlt iieiltfsDemnmpn(0tlxnmoctydop   ivsl( t2tm(o3oudop elivtltf 2raur ;o4tlxoii3iytlaDulnvsn()aexnxf oo1faDeli i;s0srum(r3nodoptemfctlsfa2taxr ;o4tee  oetat aDuan pn(0 ltrxr3ty1fmD  n ilt0 eumim io4aptnlncs s srtrurp;u1opx ifctyd mDel(mp;u)tetnmo3oy1laDeaneo;s0srtmir3iu1opt  fesl( srrrxmoot4texomfetyd mDrl( s;u) renxr oo1omDrlnvo;(  2toirpiu1optelfetatf Dururp;o1aee ioeiasfmDulumpnt) eerxfctytoaDe i s;s0sexrxmpny1al nmnvsl(fsrumxrpnt0tpxn f3tatlaDrmn o (4 exrmo ta1om e i ilt)srtr(m3ny4ame lfcsatfsDtaxmoou1opx  fctatlmDrlu sn(0tetoxr3oy1opt  nvs;(0 eum(m3iy4alt mivtat s2rax ont4tptnmi3tasfm uaumo;t0tlenmo3io1om   nes;( t2toxopnodaptemfvs ()arrm(m ot1aeeomf3tys mDua( s;(0 eenmocoatlpDeaiei s s2xo(r iydomtnmivi t)sDuaumpnu1openmocilt a2uauvsnt)trtnmf3totfm raivi t0t2xm(mpou4ope mnct t)sDtr(r nu4tpen oeiatfsDraums;(0 etrxo3totlatelieo;t srumim iudlmeelietas) rtau  ;t1ale if3iadfm uanmpnt4areoir io1fmDe nvs (  eto(r3iy4oleemfctasfs2ur(mpou0apto ieilslm2rm( on(0aetoirciatoaDe n s t0s2xrxopiudop  mfcia( srtaumo;o4opeoifctls m ran p (4tlxrxocootop e u sl( texm(opoydale lfvt s sruaumpoo1tlx io3ias s2ul(vsn(0trtnir tytlpDeauei;( teurim3oo1alt livsas sDtrxmoou1oexnifciatfaDra(ms;t4treoiocootoa eauvo;t) exoir nodllenmfvt s sDta( pou4texnifciad s em(ms;(0aleomf oydla elieol( s2trio3no1lmtemnvs s) Duax oou1tpen fctltfaDea( p;u0tleomr3ta1faDraivo;t0 etmio3no4ol e ivt sf rur(mpot1tlt ioeild s2rl(mp u0altrircty1oaDrli i;(0 rurxm3nudom  mies (farrrx poo0opx ifeiadfaDulnmo (0 lermf io1omt auvol( tetoirpoy4al  lfci sf 2rmumoot4aex ioeiysfsDranmpnu4aeenxr3oytlaDean o;s)s2tr(m oy1ome mfet tf 2tmxr no1tleo o3ils m2emu o u0alenif iadfa elies;s s2umxo nu1lpt mneia(fsDtm( pou0teeomo3iad mDulnvo;u0texnio oadoptr neslt) rtmxr oydol elict (fsDuaxr no0tlx iocils sDrlumont0 etnxrcoy1fat  u o s  exrim oo4lm emnvsasfsDtmxmont4oeenmfeiydls2rmnms t4 rxrxo iadom  anvo (  2uoir io4olee fvia(fs2taxr oo1aeeoiictaslm ranvo;t0alenmo3iytopDe n i s t2xo(m3nu4al emnct ( s2rrumpoo4oexoioctlt mDraumo;u0 eerio tytlpD aneo (0teuoir ny4lp e fvt s a2ur( ooo0tle ioeiytfa rmu snt)texrmo3ootfpDe ivil(0sexo(r ou4omt mivta()s2uaxr ot0oetnif3tyd m2ua(mp;t0tetnio tydfp  anvi s tetmiopou4lmtn fvia()s2tr(mono1oleomfeias a2rmu p;u) ltoio3iytoa   u ils0srto(m ou4lm  lfct s) 2rm(ro;o1alxnioetydls2rl( p (4 lenmrctadfaDranei (0srtmxrpno1ape  fvt s  rtaxrp;u1apx io3iyd s rlu p;t)alerir to1oaD an s ()texo(r3iydom  lfciatfarraxr ;t1alx mfeiat aDuaumsnt)trtnxr3iydfp   ieolt)t2xmxr3no1olenmfeia() 2umumont1tpxomi3tadfm2ulu o;(0 rerirciotlpD  nes t  2to(o3ou4amtnmnesas)srra(rp;o0tlxo i3tydlsDeanvo u)aetnmf to1la  au i (0s2xoiopiu1lmenlieias)sDum(rono4ale  fctlsla ulnmo t4trxnxocoytlaDeanvs;(0t2trxr3iy1ol emnetl(  rta(  ;o1tlxomieilt sDrm(ms;() ltnxo3ootopte uei;t0trxrio3ny4apeelnctasfaDtm(rp;o0tlxomoetatlsDumnvp;(4 rxnxo3tatop   ues;(0srxr(r no4ap nmfcsls) 2rm( o;o4tpxoiietyt m2uau on(4 ltoxo to1lmD aneo () rxr(m3oydape  nvsat) 2rrumpoo4aet  f3tyd a ul( on(0 eenxfcoodfp  lu il(0t2to(o oodol emnct (  2urx pno1tle mfciytfsDrlnvs t) exrxrcoadfp  livi;s t2toimpnydamtemncsl( sDta( o;u4aptnif3iydla em( p;(4areomf3tatfm   uvs t0 rtmxrpoo1lmtnmfvsl(f Duaxmooo1oeeomi3iadfa2emnmpnt) rtrio3tydoatrluesls)sexoxrpoydlmen nvia(f rum(m ot4opxomi3iydfmDeluvs t) rxoir3iatfp  aivi;( srurxo oy1amtn nct tf Dua( pou4oeenmf3iyt m2rauvo;(0aexrmf tydlaD aivol()tetrim3iy1amt  ncs t) 2rmxm nu0apxniociat a2ran snu0 lxrmr tadoa rlu i;(  rxrim ny1aptelfci () 2ta(root0oex  fcilsfm2rl(vs;()aeeoxf3iytfptean ol()s2urio3nudape  neias)aDtrx p;t0apxnmf3iltls2ea( pnu4alenmr3totlmDr ivi;t0srtoim iu4om  lfvsa( a2rrx p;u4tle mietat s ea(vp u0aeerir3ta1fa  an i (  rxmxrpoy1lltnmfctasfsDurxm ;o1optnii3tlsfa2rau p t0tlerioctydfm  ai i s srtmxm io1omenmfet s  Draxrpno4optnioeiad m em(vo;t0 eeomrcoodoatr iesl() etoxo io1aptn fct tfa2rmxm no0oeen fciatfm2um(vp;(0aeermf3totfmDrln i;t) exr(rpnu4lmeemnei (f 2rrx p;u1tetomf3iadlaDumump;(0tltrmr iatomtrlneols  rxrxopoy4ape mnvtasfa2urxrpot1apx  f3iytfm2rau s u4alermrcty1opt  nvi ( seumxr iy4am e ici t sDtmx poo0aptomf3iat aDrmnmsnt4trerif iadoaD  i i;t0s2tmir3ny4ol e fvslsfsDua(m ;t1tet mi3ilsfs uau s;u0alxomf3to1op  ln sls0 rto(mpiodolenmfvil( arraxrpot1apx mietadfs ua(ms;(0alxrxf tytfa rli ilt srurxr iudaptnmiciltf rtr(rooo4apx mieiasls ra( s;t) exnmoctodlm ean i;s0teurio3nodlpe liesa() 2trxrp;t0tex  ieiadfaDem(mp;u4aetnif3ta1oate u sls srxr(opnydame licsat a2uru pot0apen fetydlm2ul( snt4texnxfcio1lpte u sls seur(m3nydol emnvta( aDum(ront1apxnmieildfa2el(ms u0texoxf3tydlpDr neo t)trxoxopoodlmenmfvtlsfarrr(ro;o4teto iciltlm2rln o u0 ltnxf3to1om  lues;(0 rxo(m oo4apt lfvtl() Dtmx pnu1apt ii3ilsfa ra(vo;(0 lxoxo3oytopDe i o;(0t2trim ou4al e netlt)s2ta(  nu0apeo i3iysfs2em(vp;u0 rxrxr iadoaDe uvs s srxm(r3iy1lpeemicta(fa2urumoou0tpxnmieiadlaDrlnvpn(4 exnxrcto1om eluvo t sexo(opnudom elfcsasf Dta(rono0apxomociydfa rlnvs (4 lxomr oatlp  aivo t srurimpnodom eliet (fs2taur ;u0tpt ifciad a2em( on(0tltomo oo1fmDrli sl(0t2trimpnu1ol e ivs t sruaurpou4apeo f3tltlmDumumonu0aetrxo3iodfm  livi t)t2um(r3no4llt  ivil( s2rr(rp;t1aeto fciydls2emnmpnu)trtnmrciy1fp  aueilt)texo(m3nu4ll elics ()a2tmx ont0aeen f3iltls rmumo u) rxrxocta1fmte ueilt t2xm(mpnodaptnlfvtl(f rumx ooo4alxo oeiltlmDuanvo;(4aeerxf oydfmt livi;(0seuo(o3io4ll nmiciasfartrxro;t0texo ociasla uln o;t)aexoxo to1fmtr ieo t0 2xrirpoy1opt lfcias) Drr(mp;o0aexomo3ildls2rm(mo t4artrifctydomt au il( s2tm(opnu4lm emnvias)aDra( oot4aetn fciydfmDeln s (0aexriocoytfp raiei ( tetmir3iydoltelivil( arra(mpoo1tltn o3iytlaDemnvsnt0teenxfciodfmtr neo;(0seur(o ny4op elfesl(fsrurumoou0tlt mietatls emn sn(4aeeniocto1omt livs (0 exoio oy4aptnmneias)aDtm(ront4aexo ieilslmDum(mpnu)aetnxo3iodlatraiesls0 rumxr ny1ap nlici t s2urxr nu1tptomfciys m raump;t4trxnmocoatfa   ies;(0s2toxmpoo1alen fcs s sDuru pnu0tpe  i3ildlmDelnvonu4aexnif iatoaD  ueo;s)s2trirpnu1lp elivi sf 2rruront4ape  i3iasfaDrmnmsnu)aleoiociatlaD au i;( s2toxr oydlptelneil()sDrrurp;u0tee iictyt s2ea(mpn(0 rermo iadlpteaivs (0srtrio nu4lptemicias arra(  ;u4ape iocilsfm eau s (0 eerio oadlm   n s;s0t2urim3nudalen fciat arumumonu1aexn ociyt a2el( o;(0tlxnmo ia1la eaivs;(  eur(rpoo4opeemfcs s srurum nu0texo fciyd sDelnvs t4aeeoif oy1faDeanvsl( setoxopnu1altemnvtl(fsrra(rp;o1tpxoifeildfm2ua(vsnt0aexnxrctodfa e i s;s0tetmim iu4al nliciatfsDur( pnt0oexn i3ils m2em(vo u)aeeomo iytoat  ivolt0trxoxm3iydol nlfesl(fa2ua( pno0oexnif3tltla el(vsn(0tlxoxf3todlp  lu s s srxrxm3oodopte netas) 2ua(r ;t4oexn o3tyt aDuln o;u0aexoxo todfa   iei s0s2tm(mpiy1alt lietl( a2rauront1opxnifeiytfm ra(msnu0aetnmr3totlp eluvi;s) 2umxm oy1op e net (  Dum(rpou4tpenmoeiadlm2rmumsnu4artrxocoa1fmtean o s0t2xoxo oodapt mfvtas) Dtmx  ou0teenmociyslsDumnvpn(0artrio ty1fpD  neolt) 2tr(m3iodam  lfcias) rtm( ono1opeo fciad sDelnmpnu)texnxociotopDrluvslt0 rxo(rpno1amt mncs s)a2umumoou0tpeomi3iasfaDumnmp () rtnmo3oatfmD  ieslt) euoxm3iydomt mncsa( artrx oou4aptomociyd a elnvp;(0texnmr todomt li i s0s2xr(rpno1olt  nct s) rtaur nu0apenmietldfsDea(mo;t0tleoif3ootlateauvil( t2urxr iu1opeemicils) 2trxrpno1olenmoctyd a umnvp;t0alxnmrciodopt aiei;s0srtr(m no4lpt mfvias s2rrxro;o0tlxomfeiyt aDra(mo t0areoxocta1opDe uvils)s2umir3iy1al e ivsls)aDtmxrpou1aeeniicils m2uluvpnu)trtrmo totom elnes;t0 exo(rpiu4alt micsas  2urumonu1aet  fcild m em(mpnu)aetrxr3totlate nei;s teurxmpnydopeemnesat)sDta(mpot0apen octydfm um( s u0artriociotomteaieilt0s2umim3iy1lpee netl() 2taurono1apxn i3iytfa um(vs;u0 leoxr3oo1lmt livi;t t2xmxrpnydlp   iei t  Dtm( o;o1opeoiieiytfa eln o;()areoio3oatopDe ivil()teto(m3ou1altnlfci sfsruaxm ;o0tpeomfeiasfa2ea(mont4 rtnio ootlpD  n ils  ruoimpoo1altemivs tfsDra(r ot0opeoiocildla raums u)areoircio1lp elieo;t  rtoxopoudlmenmici (fa2tm(  nu0tpto i3tldfaDeln pn()tlxrxocoa1fpteli o;()tetmio3no1ap elneils)arrmx o;t0tpx iieiyd s emuvo;(4arxnmf oytla rlnes s  etoiopoo1lme mnvt t  2tru ooo4tetomf3taslsDrm( o;u4altoircoatomDe ies s0trumim oodal   fvs (fsrrrur ;o4apxnmfeild s emnmo u4aleriocoodop elnes t)t2xoirpoo1lmt  fesl( arraxrpnu0texnii3iadla rlu sn() renif3tytfpDelu olt0 eur(r ny1lpe mivsls)a2umum oo1ale mf3tltfm emumo t0alxrir3iytfm raneo;(  2uoxmpoy4op n ncs ()aDtm(moot4opxn f3iasfa ran on()arermociytlm eli o;t  rtrxr3no4oleelfvia( aDtrur ;t1tpe moeilslmDum( s;()trtnmo3tytlatr u s;t teumirpou1ale lnes sfa2rm(mo;u1alenmiciysla2uln p t0alermr3ia1lmDelnvols0 rtm(r nodlltnlnvil()arrmxmpno4ope  f3tatfa2umu s t) ltoxr3tydfmD aiei s0srxm(o nydal  mieta(f rumxro;o0aex mieiltfm ua(vp;u)areomo tytfmtelieslt) rumxr3oy1apenmivt s)arraxr ot0aet  i3tytfs eauvp;t4alerio todfptraivs (0 rtoir nodlp n feil(  Dumx pot1alt ii3iaslaDrmuvon(4altoif oydomDr ivs t) 2ur(r io1om n fvt s) 2rru pnu4teenii3tatls2ran snt4 leomf3todop e i s t s2umxr nydole mnciltfs2ua(mpot0tlenmociyd aDeluvs t0arerxr totfaD ln i;s) eurim3iydll nmfvil()s2ua(rp;o1oeeniietydlaDelnmp u0 reomo3oo1fmte nvi;s0 2tr(mpio4omtemneil( a2tau  nu1teenifeiadfaDra(msn(4alermfciydfa raivi s s2xm(m iudlme mnes tfa2raxr ;t0apxnio3iadlsDelnms u4altnmociotlp eai o;t)trumxr nu4am  mnet tf rtm( pno0oleniietls mDeanmp;u0 etrmfcoadfp eauvi t0trtoxmpoy1lmte nci sf rtrumooo1tptomfeiat m umums u)trenmfctatoptr u ilt0 exrio3nu1lpeelfeta()a2tm(  oo4optniiciydfmDea( s (4trerio ia1opt  uvs;()trurir iu1omenlivs ( a2um(m nt1aex mf3ias m umu onu0alermf ia1laD ai o t0sexoiopoo1ole lnvsa(fsDtaxrpou1oee  f3iltfm2emnvp u0alxrir ia1fpDe uvs;s)t2umim oydlmeelfvi (  Dtaur oo0tptoif3iasla ra(vsnt0texnxf iy1fpte ieilt) 2trxmpoy1lleelfciat srtm(m ot0ale  iciydlm2elumpnt)trtrio3ta1fmDe i i s0teurimpio1apenmnci sfaDrrum oo1aptnmo3iyd mDrlnmo;u)trxoxfcta1la elues t0 2ur(m oo4ol elictat sDra(r ou0optnmfciatls rm(mpnu0teenir3oy1oatean ilt0trtr(o3oodalen fvsat  Dra(rp;u1tetnmoetadfm uln o (0 etnxo3to1late nvols s2uoio3oy1llt lfvil( aDtr(r ;o0oexn fciys s um( o t)alxoxf tadlaDelivo s  eto(opno4alt mnvs () Dumxmooo1aeenmoeiys aDua(vs;()trtrir3todfm e nes s0srumxo3nodale lfvsas aDtm( ono1tleoiietatlaDrmuvs;t) etoifciytfm eanvol( t2toxm oy1op   ivt t  rumumooo1oexnmiciyslm rlu p;u0 eeomfcia1lmD anvo;( srtoim3nudalt lfciat)arua(root4texn icilsfaDemumo t4arermr ia1lmDraivi t srto(rpny1omtnmiet t s2ua(  ot4tltnmfciys mDelnms;()trtrxo tydlpDe ieo;t0 2xmirpoudlp emnvtlt  2rrurooo1alxnifciydfaDel(vs;()alxrmr3oytlat  iei s)seuoim ou4alee nesls  2rm(r no0tptn fetyslm2uluvs u0artnxr3iotlatelivols)srxm(m nudap  lncsat aDraur nt0tleo f3iltlaDulu pnt)alerxrctatlatrlivilt) 2urim3nydlpe mnviltf Duaxront1tptn iciad a2eanvon(4aeerio iatomDran s;(  rxo(rpnu1opeemfcias arurxr ot0aleoif3tas a2rmump (4aeenxr3tadomtrlieil() 2xm(m ou4olt mfcsltfaDra( o;t0tpx ii3iydfs2ranvpnt)tlxoxr tytlpDeli s s)texo(mpou1olenmfeilsf 2rrxm nu0ale  i3ias mDrlnmon()aetnir oa1oa eanes;t)s2trxrpnudlpt  nvilt  2ta(moot0alt  iciytlm2rmnvp (0alxoircoatopDeliei;t0truo(o oo1lp elfvsl(fs2rax  ;o1texo ieiatlsDrln p u4tlerxrciytla  aivi t0 rumio3nudom elncias  Dtrxmp;o1alto oetld mDeluvo t4texrmrctotopt aneil(0setmxr oo1lme  fvsls) Dtrx o;o1opxnmfeilt s2ul(vsn()artrmrcoydfmtrauvs ()seuoxr oy4lmtnmfct tfsrua(moou1oetnioeiadfs rmnmonu4 rtomf3iadlm eanvi ( srxmxrpoo4ol elneias a2rmur ;t1tlx ifetadla2em(mo (0aexnmr3tatfp   nes;t  rtrir oy4omt mnctl(f Dumumpnt1apxn feiad m2emuvo;()tltnmrciodfa e n ils trxoxo no4alt lfvi t sDtmu ono0apxo f3iyt s2umn pnu4aeeoifcoydfat au s;s)trxoxmpnudopt  ivtlsfaDrru  ou1oltnmi3iatfm2ulnvo;u0 reomf totlpDeluvilt)seurim nudll elici s aDuru p;t0tltomieild sDulnmon(4treniocto1lptr nvs s teur(r ou4lmtemfvtlt  Dumxr nt1apxnii3ild sDrm(vs u4aeenmf oy1fpD lu s;s0 etrirpiodlm   nviat) Dumx oot1tlxniictyd mDum(mo;t0tetrxfcto1oaDrauvolt) 2tr(r io1aleelnvsas artrxm no4tltomietydfa ul( o;t0 renir3oy1la rluvo;t0 2tmxrpnu4al e nesas srrr(mpno0apenio3ilslm ea(mp;u)tetrxf totomt an s;t s2tr(o iy1omtnlnvtlt) Drru o;t4alx miciyd aDumu o t0arxnxo3tadlpDe ieo ( texm(mpoydom   fetasf rua(moot4alx mfeiasfa el( o;u0trenxr ta1omDranvi;s0trxm(rpoy1lpe lneil() Durumo;u0ape if3tls mDem( p;() rxnmo to1lmD aiei t0sexoxo nodalee fvsl()aruaumpnt0ope ifeiltfsDem(vs t)alxrmrciodfaD  nvo;()trumxrpnu1amt lietasf rtrurp;u4teeoii3tldfa elnvs;t0 rtnmociadfmtelneo s truoim iodoleemfcslt srumurpno1tlxomo3tld m2umnmonu4texnxo3oytfptr i s;t t2trio oydopte nes s)aDrruroot0opxomo3iys m el(vsnt0 exrxr3oatomt auvo;s  rxo(opio1alt lfvilsfa2tax pnu1tex mf3iydfm2eau p;t)arxoifcoatfmDr ivs t) exrir no1lp  lnes ( s2urumoot4apen i3ilsfs rln sn(4 etrio3oatfmDrlu slt  rumxr oo1optelivi sfarrrxr no1aleniiciysfa2ra( s t)tleoxrcto1opD lu o (0trto(mpou1opte fct (f 2rax  nu4olenmieiadfaDua( o;t0tetniocoy1lmtrlivo ( teto(rpou1lp emfcias) 2tmu pou1aptnmfciysla2el(mo;(4trxnir oo1oaDrluvs (0srto(r oydap  lnetas srur(r ou4tetoif3ilsls2eanmp;u)tltnxf iytlmtraueslt0trxoxo3oydlmtnlncs s srrau  nt0apenmoetyslm umu s;()tlermo oodoat au o;s0srtmim oy4ome  fesltf Dum(  ;t4tetomo3tytlaDeauvp;u4trxoif oatfm  aivi;s0setmir3oudlm  mnes ()a2umu  ;u4tpen ieildlm ua( pn()arxnxfcoadomt lies;s0 rtmiopnu1lp n fvilsfsrra(mono1aptomi3tlsfs rm(mp;(4arerxo oadfmD  i o t)trurxm3iu1ol emfcsatfsruaurpnt0aleomieildfm rlu s;t0alenioctotopDranvs;(0 rxrio iy1lmen ivilt)sDuaxm oo0tptomfetltfsDulnvs t0 rxoir3todop elivils)s2uo(mpnydapenmiesls)aDuaumoot0olxn ocilt mDulnmo u0alxrif tytoateaiei;s0srto(o3oudlpen iesl() rtax  ;o4opt moeiltfs2rlu s (0 rtnmrcoy1la ran s;s0s2ur(o3ny1aptnmivtatf 2rrxront1optn i3tlt m elumsnu4texnxr tydom  anes s)seurxrpiu4lptn fvtl()a2raxmpnt4tpen ieildfa em(vonu0trenir ta1omDeaues () rxr(r ny1lm emfvi s aDrax pnu1apto octldfm em(vo () lermfcia1opDrli il(  eurim iudlm e ieilt)aDumu  nu4oexomoctytfsDul(vp;u) reriocoytomtrluvo;t)srtoxr3iu4am emivtasfaDrmump;u1oleoiietlsfsDuaump t0tlermr3tydomt lu i () rumio nodlmte fvil(fa2urxr ou0teeoif3tas aDumnvp;u4 rxnmrcoadlmtr uvslt trxo(r3iy4lpee nvia()arumu poo4oetnmoetydla2rlnmpn(0 ltrmr3ia1fm  luei;s)trtmxmpoo1llen neiat)a2rmuroot0opx moctatfm2umump t)aeenmfciytlp ean o t s2uoxm3ny1op   ietlsfaDrm(mo;u1aptnioeiadlm em( p u)trtrxo3ta1opD lnvs;(0 etoir3nydapte fcilt)s2rmxm ot1oet  fetydfa uanvpnt) lxoxf iadfmDrau s;t  rtoio3iu1olenliesas arum(moot4tlen ieiatlsDulnms (0artrxo3tatlpDrai o s)trxmxmpoodlpt mfvt s)s2umxm oo1aleomoctas m2eanvo;()tltrif3oytomDrlueo (0seto(m iu1olt mictl(fsDrm(  ou0tptn fciasfs2uanms;()treomrciytlm eliei ()texo(r3ny1oltnlieia(fa2uru  ;o4alen ocilt s uanmo u0trxomr3totom r uvs ()trtm(r3nudlmeemnvi t) 2tmumpnu1opxn ieildfa2rluvpnt0aexnmo3tadfm e u o;s  2trir3ny1ale lncil(  rrruronu1tptnifciltlm rauvp t4aetrxf ta1lpDean ils0 rtmxopno4aptnlieta()arrr(rpnt4opeomi3tat s ul( pn()trxoxocto1om e n o;s)s2xoxopoy4ap n ivilt a2urx  ot1oltn oeiyt a2ra(mp (0aeenmf3ootopD  u i s)t2toxr no4lm elfet sf 2ur(mono4alxnmfetlt a em(vsnu0 leoxr oodopDe uvo;s)srxr(r no4lpee nctat)sDrmxr ;o4opxomfeiltfa ra(mpn(4arxoxocoa1lptran ols srxrimpoudll n icsltf 2uau pot1olxomocils sDelnvo;t)teenir3tadfmDelnvo t)s2to(m3nu1alenmfvt s s2rmxmoou4apeomo3iat m rmump;u)tltoxo3tytfaDrli s s0 2xrio oy4aptelnvsa( s2raurp;o1tptnmiciydla rmnvp ()trxrmociytfmt  nei;(0 eurio3oudlleemnct sf 2ua(  ot1tet mfciys mDuaumonu0texrmocoadopDelueo;(0s2uoxopny4ap elivi t)s2rrxrpnu4apt  fciydfsDua(mo (4alxrxr oo1lmDr nei s0srtm(r3nu1alt mies ( s2umur ;o1tetoif3tadlaDrln p;(4altoxf3todfpD aivol()t2urxm3iy4lp  mfctas)srumx oou1aetniocilslm2elnmp;(4aeeoio3oatoatr u ols)srxoir3oo1ome  fvi (fartm(m nu0tpenmf3tytfmDuaump u4tetrircto1lm  lnvolt  rxrxr oo4al   ivt tfsrtau oot0optomf3tytls ulnvs (0tlxnxr io1fmtr ivo s  rto(o3oo4om n ivt t)aDrmxront0oeen o3iaslm2ea(vs t)tltrioctotfmDrlu s t0s2toiopiydlptnlivsl()sDum(r oo4tlx mocias s2rlnms u0arenirciatfmDeau i s0t2xm(r oy1al nmiesltfsrtax p;t0tlxnmo3ild aDulnvs (0 rxnxo oatfa eau ilt)t2xr(r3oydllte ivt s srtrxm nu0opx mieiydlsDemn pnt4tltoio totfmtr i s ()teto(mpoo1omen fvtls s2ra( o;u1apxn f3tysfs2eluvp (0 exrmo iotfm eanei t setmxrpiy1alt livtls)aDua(r oo0aetoifciatlaDrmnvp;t)aeerio oy1la   nes;s  eurxm nu4ll n ncilt arumxroot4olenioctytlmDulnvs t4tltoxr3to1fa rau i ()texo(mpno1aptnlnvs tfsrurxmpno1altomo3tadfsDum(vp;u) rtnio3ta1fm  ai s s srxrxm3nydameelicsls  rtr(  ou4aex iociytla eau snu0 etomocty1laD an sl(0srtrxr ny1ll emietl( aDtaxmpnt1olt iictasfa2rmuvs;u)aexrxrcootfpt  uesl(  eur(m3oydal  lfesasfsrtmxm ;t4aeeo oeiaslmDrlnmo;u0 lenxfctytfmDelueil()srtrir3nodlpe mfcta( s2um( ooo4tpeomfciatla2uluvont)trenxr iy1la elieslt texrxo iu1lleemfesls  2ua(moot0alxoii3iydls ulnmpnu)alxoxocoy1fp r uvi;s  2uoir3nydlmen fes t) rurxmo;u4aeenmociltls elnmp;()areoio ootlaDrai ol(0s2trirpou1amt  ncsat)sDuaxmpnt0olt  ociaslaDrlums ()aexnifcta1fpteanes t t2xoxr3iy1opt mfciat)srra(  ;o4openmfetytlsDrluvs t) rerio3tytfmDelnvs;( seuoim iu4alenlivi () rurxmo;u4aetomfctad s emu o;u0teerxoctydoaDeau slt0trxoxm iy4lmtemfes ()arra(rpno0aptomociytla2rl(mont) lxrxrciotfpteaueol()t2xmim3iu4optnmnvtasfa2tau pnu0oleoifetys sDul(vonu4 eerxf3oatlm r ieo;t) 2xmim3iy4ope liei () rumuroot1oex mfetat sDra( pnu0texoxf todlat li s s sexrxrpoudaptnmfei ()sDum(r no4tlen ieiasfs rmnvp u0teenxrctadfpDe i o t) 2ur(r ou4ope livi () rrrxr oo0aee iocilslaDuanmpnu4aexnmfciotlp elnvi;t trtmxm ny1amtelncsl(  2tax oou4apxomfciyt s2ul( p;(4 rerifcoydla eanes;( trtoxo oo1olee ictlsfsrrmxrpou0tpenmfcild s umnmo u4aetrmo3oo1lateluvi;( srumxo nu4am emfct s  rrmxmo;t1tptoii3tyt m um(vp t0 rxrmo totlp eauvs (0srtmio3io4ape liei t a2uax pou1optniiciysfaDrauvs;t)tltnmo3ootfa  aivol()t2xrir oo4al n ivslt arta( p;o0opxnio3ild m rluvo;(4alenmr3oo1lm  lieslt) rumirpiodolt mieta()arum(  oo0texn ietlt aDem(vpn(4 exoio iotlmD lnvsl() 2xr(m3oydoptn fvtls)sDtru pou4aex ii3iad a2rauvo u4areoirctydoaD luei ( setmxr3iu1lp e feiasfsruaump;t1olt  oeild a2em(msn(4artnmocoy1opDean olt setoxmpnu4ll  mnvs (  2
\ No newline at end of file
@@ -0,0 +1 @@
+iei;(0trxr(opoo1opeemfvs t s2tm(rpno4tlto iciltfm elnvpnt4alxrmf3iy1oa  lueo s s2xrir3oudapte nvtl(fsDrrur ;o0apx iiciysfs2rlnmsnt0aetrmoctadoa  lueols)sexoiopio4ol nlicta(faDrmuronu4tetn o3tld a2uan on()tetoxf3tydlm rlivi s)srxrxm iodapt lieilsfsDuaxrp;o4tpt ioeiysfa2ul(ms t) lxnxo3oydfpDrluvs;s  2xrim nu4lm  mfvsl(faDuax poo4tpxo i3iytfaDranms;(4areomo3iotfmDrai i;t0s2tr(o iudomt mietas s2rmu ooo1tptnifetyd m eanvsnu) exnmr3oadlmD  ivi;() rtoxrpoudopeelfcsat)srtru pot1aptnmf3tasfa2ranvp u)areoxr3tatfpD lneo;t0t2umxm oudap  lnvtlsfaDuaxm ot1apx  o3iyslm ea(vs;t0 exnir tadlateluvi t0 rtmimpio1ll   fcsat a2ta(r nu4teen feiltlmDrl(vs t) etnircoodomDranvolt  rxo(opoy1om e ivia()aDua(m ot1olen fetaslsDeauvp (0 etoxf oadfmDeaieo s) 2toir oo4om n ncslt  rtmxrpou4tpxo oetas m eln s;u4areoxf3tatfa eanvs;(  2xr(m oudlmt  ivt ()s2tau oou4ape mieiytfa ulums;t4texomrciotfm  lnes;(0s2toirpoy1lp emfviltf Dtmu o;t1altnioeiatfsDrl( s;u0tltoxf oytop  ai s t)t2uoir3oydope mivil()a2uax pnu4tex  o3iysls emu p (0 rermrcio1op e n sl( s2trxrpoo4lpe lictltfa2ta(moot4olenif3iyt a umn on() rtrxf3tydlmDe u o;(0 2uo(m3no4opee nes t  2tr(roou4tltomociytlm2ul( sn(0 lenxo oadopt  ieilt s2xoimpiy1om nlfctl( a2trx ont1tlx mietlsfa2eanvpnt)arenmrcoytlpDrlnes s)srxm(o3no1lptelnctltfa2umur ;t1tet miciytls umumsnt)aexoxr oodfa elu s;t s2xoxrpou4ome mfvs s)aDrr( o;u1oet if3iltfmDemnms;u4 lxrmo oa1lpte i ilt  2tmir3oydoltemictlt arum(r no0aptoif3ildls2em( o;(4tltoifcto1fpDeanes;( sruoxm3iy4ape mfcias)s2rr( oou1oetnifeiysfsDranvonu0 exnmr todfpD li i;s0 2toimpio1om nlnvt t aDua(  ;o1texnmoeiyslmDrlnmpnt4tetnxrcoo1omDe uvsl(0s2urxmpiu1ap elfvilt)aDtrxmo;t0olxoiiciytfs2rln p t4trxrif oatlpDranei t)t2umio nydol elneilt  rraxm nu0aetnmo3iaslaDrlnmpnu)trtomrctytomteluei s)srtmio3no1ap e ivsl(fs2rmxmpnt4oex  oeiasfm2rmu p;t4 rtnmfctydlm  an ol( trtmxopiu4llenliesas)a2raxront0aex iociltfs2uauvp;t4 ltoiociodfatr i o;s)s2xoimpou1ol e ivtat) Dtrump;o4tleoifetatlm2rlnvp;(4arenmociy1lpDrliei ()teuoxmpnu1al   netat)artau o;t4tpto fctls s2rlnms;() rxrxo3iodop rluvi (0 rxmiopnodaltnmfetls aDumumooo1aptoiieild a2elu o (4aexoif3oodfpDr ivi s)trum(o3nu4ap nlies (fsDrau p;t1aexoio3iadla emu o u0aetnmo3iodoateauvo t) 2xo(m iydopeemncsl(  Durumpou1aptoiocils a2eln s;u) rxrircoo1laD  ivols0trum(o3nu4ap emfvi sfs2rr(rp;u4tpxnmo3iadfmDul(vsn()texrifctotomDelivo t0 2ur(rpnodaptelfctat aruax p;u0aet  oeiltls uaump;(4trxnxrctotfaD  uei;t texoimpny1al elfeilt  Dtr(r ;o1olxniociys s elnvsnu4 lerir3to1omteaies;()s2xrxr ny1alt  fetlsfsDumu p;u0oeeomoeias aDuanvsn(4 ltoio io1fat ai o s)s2xo(r oydal n nesls artmumpnt0apen ieildla2emums (4texnio3iodoaD  neo () rxr(r oudolenlnet (f Dta(r ;t0tpt ioctltla2um(vsnu4arermo3iy1fptrlieolt) rxoxr no4llt lnet s a2rru o;o1oltn f3iys m elu o t0trxrxoctytfa r n olt)s2ur(o3ou1lm  mivt t) ruaxm nu4texnmf3iasfsDem(vsn(0tetnxo oo1fm  lneilt0 exr(m3nydole mietat arrau  ;o1aex moetlsfmDum(vo;u4aetoio oodoaDe uvsl() rumxo3no4aptnlivil(f Dtrx  nu1tpt  o3iyslaDua(ms;t) ltrmf tadfa  livo s)sexo(m ou1lpenmietl(fa2taxmp;u4tlen ociat s2uau o t4alxnxociatfa elivi;t setrxrpoydapt  nct t a2um(r nu4ope mictldlmDumnmp (0aetomo3tatopDrln ols)trxmir3oo4alen icsasf Dua( oot4opt iictat a rlnms ()aexnxf ta1laDrln o;s0t2xoxm3iu1amtelivta(f ruru  nu0altomiciydlmDrln o t0 lxoxo iotfatelnvo s0truo(o3oudlm nmnci t) 2ta(m no4olx micilslm em( o;t4aeerxr tatfpt lnes t  2trxopou4opee fcslt)sDuaum ;u1opt iiciysla2rlu o u4 reoxo io1laDr uvo t)trtoim no4lmtnmivslsfs2trx  nu4aetnifciyd m2eanvs;(4aexnxrcoadoat  nesls) euoio3iy4am  lfeilt  rrmur oo0opto fciyslm rlnvp;(0tlxrxr3tatfatranvi;s0 2xrim io4lpe livsls)a2umumo;t0tpeomoeiasfs2umnvpnu)trxoio tadoaDeauei;s0sexmimpoudlpenlietlt  rum(m ;t1aeeoifciadls ra(vpnt0 ltoxo3oa1fa  ln i t  eumxm3iudopee feiatf Dumxmo;t4teenmfetlsfs2rl(mo t4 ltomf3oy1lmD lu i ( s2xrio3iodalen iei () rumum ;o4aexomoetatlm rlnmp;u4 rxnxr tytlm rlu ilt)setrxr3iodamt mnctasfarumu  no4oeeniictls a2ulu o t4tltnio iotlm  ln o;s  rxoir3oy4lpte nvt ()srurxmono4opeoio3iat m2el(vp t)trtnxo oa1lmDrli i t teumimpnu1lm   fcsa(f rtmump;u4aptomfeils s2emn sn()aexnxr ia1fpDeai ol( srurxo nu4olee fesa(fs2ra(rp;t4aex iietadfs ul(mo (0tetomo3ootomDrln sl(  exrxo3io4alenmncs sf Durx  ot4tpx iictasls2rm( o t)arxrxo ta1laD luvol(  rto(m iydal   neslt)sDtmx p;t1oeeomietld s2rm( pn(4trxnio3oo1fmDe ueo t) rxrxrpio1optelfviat s2trxroou1oleomoetltfm2eln p;u0areoifcootom  lies s)teuoxopno1ope lfct t)srrrxrpot4apeo oeiasfs uanms;(0 rxomo3ia1fmt lnes s  2umxm oo1al n fes t)aDtmxrpoo4oexn oeias sDua(vs u4tlxoxr3oydfptrlu o t0 etr(m iudolt mics sf Drm(rpou0oltnif3iydfa ea(mon(0 rxnif oa1faD lnvi;t) 2xmim ny4lptnlfctl()aDrrumo;o0alxomoctatfm2rl( s ()aetrio totlat au sl() etoir iudlpte icia( s2rauroou0oetn feild sDul( s u4artnxr3iatfaDe nvi (0 2xoxmpoo4al emfvs s  2rmu ont4apeniieiatfa elnmonu4aexoio ootlaDelnvsls0 rtmxm3ny4ape  nesat srrrumonu1olxnifetld mDrln s u4trxnir3tadlmt  nes;t0texrxrpio1ome mncsa(farrm(monu4aetomf3tat a em( p;u4 reomr io1fpt  iesls  rumxopoy1om e iciat)a2umxmpnt1tlt mfciltlsDumumo t4trtrmf3tytlpDrlu o ( trtoxmpoo1optn nvi tfa2um( pot0tleoioctltls2rlumo;() etoxo3iy1laD an s ( srxoxm3iy4lptn fvt tfsrtaxr ou0olenif3iltla ua(vs;t4 lermo ty1fp e ieils0trxoxopoo4ll  livs t)aDtmurpnt1alxomictldlm em( p;t) rtrmrciotopteanvi ()srtrio3iu1lpenlnct t) rumur nt0oeenmo3iatfmDrm(vo;(0 rermr ta1fp   n o;() rtoxo ou4optemnvtlt)aDrrxmo;u0oleoiieiytfm2rmumonu4aeeoxo3ootoptrlnvi;t)s2urxrpoudap   fct sf Dua(rp;u0tpeoif3iysla2em( s;t4 exrxr3oydopDeau ols0s2urxr3oydoptnlfet ()s2rrur no0tlen fetadfs2ran p;u) rtrir iotfaDraues ( setoiopoudlp emncs tf 2tmxmpnt0tpxn o3ildls ra(mpn()areoxo3iotlmt aueolt0 etoxo3ou1lmtn iet tf Dtaur ;o0tlxoifcild s ulumont) eerio3oa1lpDrau ils)s2trxm3nu1optn nes tfsrurx p;u1tptn i3ilsfs2ranvont)arxoio3tytfm eaivs t s2trxo oy4ale  fcs () rrmxrpnt0tlxnmfetytfaDumnmo (0teeoio oytoa  li s;s0 2toxr oo4amt lfesatfaDtaur nu4apx mfeiatfm2emnvonu0teeoxo3tytfmD  u il(0 rtrxr3nu4amtnlfcta( a2urxmo;u4aet iocildfsDuanvsn(4trenxr3iytlptelueo ( trurir3iy4ape  ict s)a2tr(rp;o4tltnii3iad m2ua(mp t)arxnmf3tytfp rlivs;(  rxr(opnydlpenmfcs ( sDumxront1tpto ieiytlm ra(ms;u4arenmo3ootoateluvil( teurxo3ny1ap   fvs t)aDtaxmpot1aetoiociaslm rmnmpn()alxoxociydfm rlneolt0s2xrxr oodoltn iet s)sDtrxr ;o4tlt mictatfs2rau o u)trtnxo tytfmDrlu i;(  2urim iydome liviat  Drmur nu4tpx  o3tld s2elu o u4 lxrmr3tatomDr uvil(  exrir io4lme livsas)aDrr(rpou0tltnmi3iytfa ulu s;u4teenmocta1fm r ivols s2xmiopny1aptemfcsltfsDtm(mpoo0tpx io3ilsls2el(mp;t4texoio oo1oaD  n i ()srxoxrpou1ole  ictltf 2raurpou1apt  ietls m rl( o u4 eeomfcio1fateaivs;t teurimpou4ap nmfviatfs2tmumpnu1tptoif3iltlm rl(ms;u4teenxrctadfatrlnvo;s0truoxo oo4lme mfcs (fa2urx oou1alxnioeilslaDrlnms (4 ltrif io1lp rli o t0sexm(r ou4lme lfctat sDtaumonu0aexn i3iasfs ua( s;t4alxoxfctatfm rli ils)s2toir oy4lme mici s  ruau  ;t0aetn o3ils s2um(msn()tlerxr3io1faD luvs;t0srtmimpnudlmtemfviat a2ur(r oo0ole  feilt mDrlumo u4 rxoif iodfmt  ivs s0sruoxrpny4om nlieta()srrm(moou4opx ifciad a2umn o u)arermfctydlm r n ilt)trtrxr io1ope  ictatf Drrxmpoo4apxnmoetasls uaump;t0aleoxo to1laD lnes s tetr(r ny1alenlnviasfsDtr( p;o1olen f3iys s rlumo u0tltrmf3todoa eai s (0 2tm(o3ny4lmenlfctat) Dtaumpnu1oexnio3tasla2rlu o;t) rtrmr3tadfatrlu s t0seurxr no1om nmfciat)srurx pnt4alt mociysls2uan pnu) rxnmo3ty1omt aneo s truoir3io4apt lieias)s2tmx  oo0opxo ociadlaDrlnms;(0trxniocoytfp e u ols0trtr(mpoydlp  mictls)s2um( p;u1oeenif3iat s2elumonu4artrxo3iy1fm  ai i t)sexm(o io4omeelnvs (f Dtr( p;t4opt ii3tysfs rmn s t0 ltnxrctodomD livo s) 2tmirpou4op  lfetls  Durxro;t4texomiciad aDrl(vo;u0 leoif3oodfmDraueo;s0s2toim ny4lme  nei () 2umxmo;u1oet iictldfs eauvo;() exoiocoodfaDrln i (0 eum(r3oy4lptn fetasfaDrau  ot4tpxnio3ils aDemnmp (4altrxo3iy1lp e i o (  eur(o3iu1ope  ncta( sDta( o;u1alen f3iad m umums;u)tlxoxf ootoaDrluvs s srtrio nydom  mneia(f Dtax poo4tee  ociasfmDrmuvp t)alxrifcoytlp rauvi;(0 2xrio oydop nmivslt  2tr( o;u4texniieiydlmDrlnmonu4tlxrmo3tatomt luvs s  rtmimpnu4lp e ictl(fsrua(m ot0optn ieiad a2rmu pn()teeoir oytfaDelnesl( setrir3no1openmnctas aDurur ou0opxomo3iydfa ua(mon(0 renir iotopDrlu o;s)seurio3oo1oltn icsatf 2ururo;o1ape ifeils mDumu pnu0 eeomr3to1fmt  nes s) etr(r oodal nlnvtasfaDtaxrpnu1tetnio3iyd s rauvpnu) reoxr oodlp elu i ()seurxo3ny4oltemnct t aDrmum nu4tpx  feiydfs elu on() renxo3tatfmDrau ol(0s2uoir3iy1amtemnvslt srrm( ono0opeomf3iysfa umnmp u4 exrir iadfpD au s;t)t2urxr oo4om  mnei t srtrurpot4ale iieias a eanmsnu0tetrxr ootfm ran i;(  exoir3iy4om emicilsfs2ra( p;u1oeenmietad m rln p (4altomocoatlm eaivo s  rxrxopnu4lpen ictl()sDrrxront0tlx  i3iadla um( s;t0 leoif3iydomtrlueo t) ruoir oy1omenmfvsat  Dtrurp;o0apen ocildfm2ran pn(4 etnmo ia1fptranvslt  eum(rpio1lm e nes s  Dumx p;u0alxnmfetas aDel(mpnu)tetoxr tadlatrlivo s truoxo3oo1opeemnvtlt  2umuroot1olenmfeiytfa rlnmo;t)texrifcoydfp rlivo;() rurxo oodlm   ict sfa2ta(mo;o0apxnio3tlsfa2umnmpn() exrxocoadoaDrlnvs ()s2tmxo3iodalte nct t a2um(moou0tlxomf3ildlm2rmnvs t) lxnifcoatoa e neo;t)srtoir ny1ll elicslt aDtrx ono0openif3iad a2rlnvo t)trxomr oytlpD anes;t) 2urio ou1apen nesatfa2tr(r ot0aexomoeiadla2emumpnt4teenirctydlmD anvil( s2toir3nudoltnlfcsasfartrumpou4tltomf3iytfsDrl(vpnu4artomocoytomDeaneo (  exr(r iu4lpeelict t) Dra(mpnt1aeeo ictldlsDra(mo (0 lerxo todlmt lies s)trxoio nu1ape lfvi ( aDtm(mpoo4ope  ocias mDeanms ()trtnir3ty1oat  ivsls s2xoim3iu4op nlnvsa( a2urxmp;u4altn i3tlsfm2el(vp (4tetoio3iotomt lnei s)srto(rpiydlm elncs s)a2tmxmpou0teto i3iasfm rl(von(0 leoxf iatfa elnvo;t sexrxm iu1ope  ncsa(fartrurpot0alxo oetadfs em(vo;t) rtrircoy1lp r n s;t0 euoir3ou1lme micsltf rraxmpnt0optoiieiadfa2emuvs u4 eeoxrciodfate u ils0s2umio iodalenmnvs s s2urx  ou1oexomo3iyslmDulumo t)texoxfctotlaD ai i ()trum(m3oudol nlfcs t sruax ono0aexnif3iydfmDrm(vs;t4 rtnmf tydla   uvsls0 2umxm iy1al  lnei ()aruau ono1aeenio3iyt mDemnmpnu0artnxf tydopDrau sl(0t2ur(r3ny1omtelnetas)arrrur no1apeomfetlslmDelnmo (4alxoxocoodopDelnvs (0s2xrimpoo4ll n fct t) 2ta(rp;u4alxnifciydls2rluvp;(0 etnmo iytlptrli s;s)trtmxmpiudomeelietltfsDtmxm oo0tet iicils a ul(mp t0 rxnxocoydlpDrlu ilt) 2toxm nydom nlfcsat s2rmuro;o0aeenmf3ilt a rln s;u) lenxr3tydfpt anvs s0t2xoio nydap n ncs t)sDraum oo1tpxnmieiydfmDranms u4artnir3iytoa eauvo;s trtr(r oydomtnmnvias sDtaxrp;u0olx  oetadlmDua(vs;t4 exrxr3tadlm e n s s tetrxr3nodol  licsatf rua(mo;u0oee mi3iasfm2ranvsnt)trenio totfp rau o;s0 etm(o ny4ol e fcsat aDtr(mpno0alto ietatfsDrln o () ltnxrciy1lateai s t0tetoim3ny1oleemivi ( arurum nu0apt  i3iltlm um( p (0 reomo iadfmtrai i;(0 2xrxo3oydlpenlnvias) 2ta(r oo0oexniietltlaDea( p ()tetnio3oo1oa elueo s)texmxopiodolenlivils) rumxmpno0alt mi3tls a2umn pnu4treoir3oadfpt au o t) exr(r3nu4omtnlnei s) 2um(r ;t1olx  fetatfaDel(vpn(0alxnxo3oadfa r u slt) eumxr3iydape mnvs ()a2rmuro;u4tetoioctydlaDua(vs;(0 lerxrciy1om  aivol(0trtr(opiu1al eliet () 2rmurp;t0aet  octat s2uanmo;u4aeeomf3iytlpteau s;t t2xrir iy4om elics t) 2uaum nu4tpeomicilsls2uanms t0artomociodopDr i ils s2tmxm3iu1lmtelnciltfarua( p;u0oltnifciatfa2ra(vs;t) ltrmr oa1fa raneo ()t2toxm oy1alenlics ( arrau oou1aeeo ietadfm2rmumo;u)alxrxfctatfmt  nvi s seuoio3oydamtnmieta() Dumx  no1tet ii3iat s2el(mp t0 rtomf3tadfptranvo;s0srxr(r3oo4omtemfei t)aDuau oou4tee mi3iydlm em(vo;(4 rtrmr3oy1lp raivi;s seuoio ny1apeemicslt) 2tmxm ou1optomietas mDean sn(4altoiocoytlaDean o;t)srurxrpiu4lle  iciat s2taxm ;t0apxo iciadfs eluvpnu)arxnio iy1omDelnes s)sexmirpiu4al  lfeslt a2ua(  no0optoii3tyt s raumo u0arxnmrciydoaDeliei;()s2tmxo oy1om e neslsf 2rmx onu4texn i3iatfmDumu o;()texnio iadomtraivs;t) rxmxo3ou4lp elfei t  rurumont4tlxoiocilsfm2em(vs;(4tltnmr iydopDrlueo;s srtrxmpoudopt  ieia( s2umu pou4tlxoifeilt m2emnmo;u0aetoir io1laDelu sls teumio ny4ap e fciltf 2trxmo;o0aex moctat s2ulnvs t4trtomfcoydlm   n sl(0 exo(opny4omeemfes sfa2tm( p;o0tltomoeiyt a2eauvsnt)arxomo tadlm r ivslt trxoirpiodalte fvt s  rtaumpou0alxo ocias aDul(vpn() reoxf ta1fat ln o;t  rxoxm3oy1ll e fvsa( aDrax p;o4apt  f3ilslaDemuvpnt4trxrmo oo1oat  ivslt0seumir3oy4lptelieia(  2rax pnu4alxn f3ilt sDrm( s;(0 exrio3oatlp eln sls0 2xm(mpio4ll nmnesatfsDuru o;u4aee if3iydla rmu s;u)altomf oodomt luvi;s trxrxm3io1ap emfcias)a2umuro;t1aetomociadfm2umump (4aexrxf todom e ivi;(  rxoirpoodllt lfvtlt)a2tmx p;u4oetn o3ilt s2rl(mpnt4texnmr io1omDeau il( s2uoxrpoo4ol emneia()srrau  ;o4tlt  oetytfsDemnvo u4 lerirctotlpDelnes (0 2toim iydapeemnvs s)sruau  ;o0ope  o3ild sDeaump;u4tetrio3oadomt  ivilt0 rxo(o3nu4al  mneta(fsDtm( p;u0oleoiieiysfm eluvo;u4tleomr to1lpDe uvol()trxo(r3oy4ll nmnviat)s2urxmpno4tptniicild a2rauvpnu0 rtnmo iodom e iei;t  rumim3nudlm nmnvsasfartrurpou0olxnmo3iasfa2emnmonu4tlxnif ia1lp eau ilt) rtoxopio1ap  lfetls artrxrpou4tptoii3ilslaDranvs;t0 ltnmocty1opteaivil(  rtmxm io4amee fvs s) 2ua(r nu1alen ocilsls2rmnvonu)alenif io1laDelueo;t) rtrio io1om  lfeias aDtax p;t0alxnio3iat aDrln p t)trtnxocta1omte i o;s0trtoirpou1lm e ictls)sDraumono0oetnmfcildfs emn p u4 ltrxf tytfaDrauvo;s0setm(o ou1altelnetltfsrtmxrpnu1olxo ieiys m rmu p;t4tltnmf totfmD an il( tetmimpnudop e fct tfaDrr(rpot1alt if3tytfs umuvonu4tlxoxrciodomt  ues (0 2ur(opio4ll  lnei s)a2urump;u1tle mo3tldfs um( o;(0trxrmrcoydomDeln s ( t2toxr3ny4lmeemnes t)artrxr ot1oetomicild m ranvp (0tltomr3io1lmtelneo t0 rxm(r3ny4aleemnviat sDumu pou0olx  ieiytfm2ulu snu)trermocoy1fat  ivo (0trtoirpoo4ol   nctlsfaDumuro;t1oee  f3tadfm2rmn o;(4tltoir3todfaDeluvi;(0truo(r3iy4optnmnvt t) rtrur nu4alt ioctyt m2ran o;()arenxoctadlp   ieolt0srtmxo3no4altn fctls)aDum( pou0alto ieildlaDrmnvs ()trerxf oodfa raiesls) 2uoxm3oodll emfcta()aDtmxrooo1opxniictysla umnmont4tlxoifcoydlpt luvols)sexrxopny1lmtemncsas) rtmu pno4optoiieiadla uluvo u0alermr tytfp rauvs ( s2xmir ny4amt mfvsasfaruaumpou4apto feildlmDel(vonu4texomf oatfatr i il( texrxr3nodal elfeiatfartrxrpno0tetnif3iytfs2uauvo;t4aeenif3totop eaueils  2trim iudam elnvi tf Durump;o0optn fcils sDum(msnt0arxnxo3tytomD ln s;s) exriopoy4al  lfcsl(  Dta(mooo1olxnmi3iys s2uauvon() etrxrciotom eaivs;s0 rto(mpoydoltemfei tfs2tr(rpno4tpt mieildfaDrlnvo (0areoxr3iy1fmDe neolt srurirpny1olt mnvias  rraxmp;o1olenif3ils m eaumpnt0 ltrircootlp eli i;(0 2tm(o nudolenlfvil(f 2trump;u0aeenmo3iadlm2elnms;()aeeoxoctydfmDeli ils)seum(m no1altn nei s)s2raxr ou4olen feiadfm uln p t0arxrirciytlpD livs;s  2xoxm iu1amee nci tfa2rr(ro;u1ape mieils mDumums;t0 lxnmf tadopt luei t seurim3no4lmt mfcilt)a2rmu pou0olt mfciadla2em(mp;() leoxr3to1omteln s s trxrxopnodaptn ietlsf rumx pot0oltn f3ildfm eau o t4alenmr oo1fm eanei;()seuo(mpou1ap e fvsatfarraumonu4alx ioetasls2rlumo;t)artoxf3ty1lat luvslt  rxr(m ny1ll   feslt  rum(ro;u4tee ioeiydla uan o;(4 rxomr3iatfa   u i;s) rxo(mpnodap  lfcias)sDrr( p;t0tee ioetasfm2um(vsnt)aeeoif iydfmtelivslt s2xrxopoo4ame lieiltfa2tmxr ;u0oexomfeiasfaDelnmonu0aleoirciodfmtr neo;t0teum(rpny1ol emnciltfs2rm(m oo4ape  o3tlslmDrmu snt4 leoircoydfaDr ivo t)t2tr(r3nydomee netl( aDrrxronu0olx mi3iatlmDrmums ()trtnxfcoo1oaDe ivsl(0t2xmxrpiodomenmfviatfaDrru  ;o0oee ifciltlaDra(mo;()alxrxo3ta1lpD ai i;t) 2toxm3io1lle lnvtls a2umxr ot0teen i3iasfaDeanmsnt4 rtrmr3oytlmt  ivi (0texmimpio1lltn fct sf rtrurpot1texnifetytls rmnmo;t4aeerir3oydfatrlies s  2xo(mpoy1op e ivsls  rumumpot4oetnmfeiys a el(vs;t4trtnmf3oy1fpDr nvi;t0sexoir3iydaltnmfvslt) rumx o;u0tex ioetytlsDulums () ltnmr3oadlaD  n o t sexrxm iudop  mnes t)sDrrxm ;t0tleoio3ildfs2rluvs;u4artrir oy1lmDelnei s) exmir3oy4olte nvs tfsDrm(mpno1apt mo3ilslm rm( p (4tlxoio ty1opD au o s s2tm(m3iy4ll e ivtl()a2uaurp;u1ape ii3tas a2rl( o () renirctadfp raueolt)texm(r3ny4ame lnvtasfs2rm(m ;u4teenmieildlm2ulump (0tlxnmr oy1fatrau o;s0 eumxmpiu1apenmfctas  Drmurpno1aet  feiytlmDrm(mont) ltrifctodfmtrlivs t)s2xrxm io4ope lfviat) 2um(  no1aet  i3iyt mDrmuvpn()altoircoadfaDrauvo ( seum(rpno1lm e icia(f rrrur ou1tleoifciltfaDra(mo;t4arxoio3oydfa rln o;()tetm(mpio1llee nvsls)sDrmxrpot0optoii3ild s uln p u)texoir iodlm e uvo;(0 exoimpoudlltelici (fa2rmumpnt1aptoio3tydla2eanmo () eenio oy1laDrau i t  2uo(r nodaptnmnvtlsfarum(mpnu4tlx mieiyt a rm(msn(4trxoirctodfmt  u i;(  rxoim3no1ap   fvt (  2tmx  oo4teeo ociytfmDrl(mpnt)alxrif3oatlat an s;()teuo(mpnodomenmiesl()srua(mont4oeeomf3ilt a2uln p u)aeerxf3tadla elneo s  2tr(o3iu4amtnmfei s  2ua(m nt1ale  fcilslaDeau p u0trxnxf3oydlaDrlu il(0 2toiopnu4op  lfciatfartr(rp;o4oeenmoetlslm el( p u)aleoxf3ta1lp eaies t srtmir iydomte fctat  rrmur ;o0alxn ociyd m2rauvs;t)arxomoctotfm elnei;s) exmir oodllte ietlt) rta(m no0tet  feild m2em( sn()tlenirctydlpDr ivo;( trur(o3oodopeemfvs t)a2raxroot0apt iicilslmDem( s;(4alxnif iotfpD au o t)truoxr3oy1apt  nei sf Dtrxront1apenmi3ias sDulnvp;(0trtoif tatfm  lueo;s t2xm(m iudom  mies sf Duau poo1olxo f3ilt m ulnvo;u)tlerxr3iatfaDelu i t trxoxmpou1amtnmfcsas sDtm( p;o4tptn octatfa ran o (0 renio iatlptrlivol() 2um(r3oy4am elictasfsDtm(ronu1oeenioeildlsDem(mont4 rtnmr ia1fp rlu i t)t2umim3io1al  mnetls)sDtax p;o1opx iiciltlmDrauvpn(0 exomf3totopDrauvolt)s2toxr oo1omt mnetl(  rrr( o;t4opto fetatfsDrl(mp t4tlxriocty1fptr ivi;t0 rur(o nydap  lnesa( srrmu  ;o0texoif3tadls emu s;(0teermo iytfmtranvsls t2uo(m3nydaptn fct s aDuax  ou1olxnmi3iadfsDemnvont) eerxfcta1fpt lu olt srtm(m3iu4ale lnei (fsrtmurpot4ole  iciysla rmn s u) eeoir oo1oaD aueilt tetm(m3no1lle lfvia(  rraurp;o4oetomoeiysla2eau pnu4 eermr3to1fa e n olt0 rumio3nu4amtnlivsatfaDuaurpoo4tpeomfciysfs em(vp t)texomociotfpDeaivs;(0srum(o3io1lp  mfvtl()a2tr( ooo1opx mfciydfa2ulnms ()teenirctodoaDr uvsls0t2xr(m3oo1amt lnciatfaDum(r ot4opx  octlt s2umuvp;(0tlxrxr oa1faD  ivi;t0s2xoio3nydolt lictasfsDum(mpnu4apxo ociytls2rmuvo;(0 renxfcoodomD li i;s0truoim3ny4lm  mfviat  Dra(r ou1alenifciatlaDemn o u)tlxrxrcoadoatrluei;s truoirpoy1ome  ivsls)a2ur( ooo1tee ii3tytfm ulnvsnt0trtrio3tydfpD ai o;(0s2tm(opiodaptn fvsatfaruaumpnu1aetoioeilslm ea(vo t0tltomf ty1lp rlnei s srtmxm iu1lm  lnct (f 2ur(m nu0oetnmocilt aDelnvpnu4trtrmo iadfaD  i slt)srxoxo nodomtnlict (farumu poo1tlxo fciadfs2emn pnt)tetomf ootlat lnei;(0texrir iu1lmtnmfci (farua(mpno1texnmfciltfsDrl(monu4aleoxrcio1lmDelu s s)srxoir nu1omtn nctat a2rrxrpoo1alt mo3tas s rl( p;()arermo tydfmDr u i t)srxrxmpio4opt lieiat)a2umxmpou1ope iocilsfs2em(mp (4alerircty1fpt  ieo s0 rum(m3nu1optnmncsltfsDrax  nt1texo ieils aDuauvs;()teerxrciydomt  nes;s)sexr(r3nodomtnlnvias)a2tmur ;u0aeeoif3iyslmDulu p;u)arxriocoo1fmDrlnvo s t2tmim3iydlltnlneta(  rua(mpno4opt io3iytlsDuanvo;(0 ltoir3tadfm ean s;(0 2urxmpiu4ap  lfct t a2ta(rpno0tetnioctldfmDrauvonu4aexoir oydlaDr i ils  2trxrpoydlpe lieta()a2rax o;o0tleomf3iat aDelumon(0texoxf3tadoatran i (0srxoxr iu4am e net s aDra(mo;o0aetomfciltla2rlnmp;t4tlerifctatfpte ivsl() 2urxr iu1omtelies tfaDuau p;t0tlt ii3tls a2ra(vs t)trxnifciy1fpt  uei;(0tetm(r oy1lm nlneiatfaDrmx pou1oltnmfciyt sDem(vp (0 ltoxo oadfpDeluvolt0 eto(o iudape lnvsa(faDrrurp;u1olto octad a uluvsnu)tlxomf oatfp  li s;s)texm(r iodal n neiatfsDra( o;u1tlenioeias s umuvs;(0 etoxf todomDrlu sl()t2xoiopiudllee fvt tf 2raxronu0aetomieiasfm2rau sn() reomf3ta1lmD  n s;( truo(o3nodam n nvilsfs2tmurpno4aex micildfa rlnvs u4teeoio3oodlate ivols0texm(opiudlm nlnvil(fartm( onu4teto i3tyd m raumo;u4alenxocto1fm  an i;(0seum(opoodal  mfcs t srrmxr no0tpxnmoeilsla2ua(mp;()aexnir oodfptr ivs;t t2tmxm oydop n ivtlsfa2taur ou4olxoioctadlm2rl( s;() rtrmo3io1lm rlnvs (0 rtmir3io4altemncs s)sDtm(mp;u1oexo o3tys mDrl(vonu4texoirciy1oaDr neols)teumxm3oo4ol nmicils sDrm(r ;o0aleniicilt aDuauvo t4trtoir3io1fm eauvsls)s2um(rpiodapt mnvils)artau  nt0oexn ociatfsDul(mp;(0tlermr3ty1lpDrau i ( t2tmxm3oudoptemivtls) rrmurpno4opxnii3tad aDuanmp u0tltrif iatfptelues;s0trurim3oydlp elneils)arua(rpot1tleoif3iytfsDra(vp;t)tetnmrcta1fp rln sl(  2xoio oudlpee fctlsf 2umu ooo0altn iciad aDrm(mo;t4alxoio tatfat aivols0t2um(opoo4lp emfei t) 2urxr ot4teeo fciadls2rlu pnt4trenif3oo1opt  nei ()sexrir3iy1aleemics s  2raxrpot1apenii3tadfsDran s t4alenxr3iy1lptr u slt0 rto(rpnu4lmt  iet t aDuaum ;u4texnif3ildlm2em(vp () eerxo oy1lpDrai s;t seumxm3io4ap emnvi ( srtrump;o0apeomf3ias mDrauvsn(0aeeoircoy1fpDe u slt)trxr(m iy4lm  mncsltf rumx ooo4opeomo3ildlsDemuvsnu0altomo3todfa rau i;t0 2um(o3iu4optemfcsat)a2rmum ;t1ale  feiydfmDuln o ()tlxnmoctodfmDelu i t texrio3oy1omtn fet t s2tm(r nu4oltn octas mDul(ms;(4teeoircoodfp eaivslt)setrio3nodome mnetas sDrmur nu4ole  i3iadfa2emuvp;(4aeenxr3tatomteliei;(0 etoxr3nu1ole lfvil( a2urxrp;o1alxoio3tyt mDelnvs;u0alerxo3to1lmDrau o t0trtmio nodom  mivt ( sDrrum ot4tex iociaslm2rluvp (0aetrxr ty1lp e uesls sexmxrpiudoleemnci t aDuaxr nu0tpxoio3iyd a emnvo;t)aeermrcoadoptr iei;(  rxoxrpiy4ol elicsa()sruaurp;u4texnmfciasfsDua( on(0 rxnmr tydlmtr ivilt)texoir3iu4lmeemfet t)aruaxm ou4tpxnif3iyt a2ua(ms;(4aeenifcoo1fpt  u ilt sruoxm no1lpt lfvilt  2tmum ;t1openifctyt sDulnvont0teenxf iadlmD ai o;s)s2tmir ou4olen fct t) Drr( ooo4aptoiicias s2em(mp u)trermrcootfpDranvilt trtm(m nudamenlfctlsfs2rr(mono1ape mfeildfsDelnmpnu)trtrio iydlp r ivs ( trurio ny1olte ivtas) 2uaum ;t1oex iieilslm ea(mo u4tetnxo to1om  anei s) rtmxr oo1ope mnvilsfa2tr( o;t4oetomieilslmDrau o;(0aexoifciydoptr uvo () euoirpou1lpen feiasf rtax  ;t0tleomf3iasfs emnvp;u) etrxr iadfptrluvo t sruo(r iudlp n ieslt arraxm oo4tpe if3iys s rm(vp u)teeoifciotfaDe u ols t2trim3oo1altelnvsl( a2tru oot0olenioeildfsDeanmo;t4arxnmr ta1lp elneo;() exmxo3nodlltelici ( aDua(rpoo4tee moctyt sDua(vs (4 etnio3oy1om  lnes;s) 2xo(r iu1amenlnetat  rrr(monu1tex mieildla rlnvsnu0alerxociodlat aueols)trum(rpio4om emnci s)sDuax p;u4tpxn oetyslaDeanmp;t) etoxr3oa1opte uvo;s)t2xo(r3nudaltnmiet sfa2trxrp;u4tlxomietatlm2ul(mo;()artrmo3oadoa r ieslt)srumir iydom  micia() 2rr(  ot1apenioeiadfs2umnmp t) rxnioctytlptran s;(0 rtmirpny4ape lnvi sfaDtmurono1oetoifctas a rm(vo;(4trtnxo oa1laD an i s0 rumirpiudam elivtl()arur(ro;o0aptoiiciad a elu snu4 ltrio3oytlateaueilt) 2xoxr3oy1lptemfetltfa2tmxr ;o1alxomi3iys s2rm(vs ()tlerio iadfa r ivi;s sruo(o nu1lle  ict s)sDtm(rp;t0tleo o3iys a2umump;u0 lxrio3iytlp raivi;t0 rxrim iudol elnviltfarurxrp;u1teenifeias m rmuvs (4trtrmocia1lmte ues (  exrxr io1ame liei tfaDtr(moot4tex mfciatla rln s;()aleoxfctadlaDr nvi;s0s2triopoydapeemfesas s2rau p;u0aexnmictydlm rln o u0 eenmr oy1oaDelu o s)s2to(m nodolen fetasfaDua(m ot4oeenmoeiadlsDra(mo u4alxnxr3oytomDrlu s ()s2um(o3oodomtemies tfaDrmu p;t4tlen oeiltfs rmnvont)aetnxrciadoptr ivs s0t2xoxo oo1ap  lfvt (f rra( p;t0ale if3tyd m ulnvsnt)tlxoir ta1op  lieo t0sexrxr3ny1lpe lfeslt) rumx oou1ape mfciydla rmuvsnu) exrxo3oo1lm r uvi;t0srtm(r3ou1alt lnvsl()srtr( pou0oet  fciadfm em(mo;(4alenxr3ty1lmD li s t)teumxrpou4opt  fctls aDrr(  no0tpxnmictys aDel(ms;t0 rtnxf3ty1oa r uei t) 2tm(o3no1lpeemivtas a2tmxmp;u4ope mo3iytls rm( s;t)aetoir ootfmD li s t0t2tmxmpio1apeelfcias)srrmumpoo1optnio3tat s2uaumsnt)tleoio oadfptr ies;()t2urio3oy1altnlictat)a2umumo;t0aexomf3tyslsDra(vo;t0 rermo3oadoa  lies t0sexoir3oodlmtemnvil(f Drr( o;u4tlxnmoeiytlsDua(mp (0trtomo3oydoptr uvo;s t2umxm3iy4amte fcils aDtrxmo;o0optnmoetltlaDranvs;t4tleoxf3tatlp   uvs s0trtoxo3oo1am e feias  Dtru o;o1aleniietyd s2um(vsnt) exnxf3oa1omtr ivolt  2xm(o oo1ame lnetas srum( pno0oee  f3iasfs uaums (4trenxfcoatlate uvs;t)sexoir3nudaltn ictltfa2urx pot4apx  iciatfa2rluvp;()teerio3oo1laDeluei;( seur(rpio1ap   nviasfsDtmumpnt0tpen ictlsfm ranvp t0alxomf3oy1fatrai i;s)seumxm3oudapeemnvtas  2um(m ;t4apeo ieiltfm2ul(ms;u) rxrmrciytoatelivi;()texrxrpoodom n neiatfsDur(mpno4opx ifeiltlaDulu o t0 rxniocootlaDean o;t  exm(m io1ll  mfcia(faDrmumpot0tlxomfciltfm rlnvo;(0texomrcoo1la elu s;s0setmxo3oo1omt lncsls)a2raum ot0oleniiciatfsDua( ont0aleomfciy1fa rauvo t trum(m nydlm nmfvtls  Draxr no1aetoif3tas m elu pnu0tetrmf3oytomt  nvo s  etoxopoydlme mivias s2rmxm ou1ale  feiydlmDumnms;u) exnir3oadfmD aueols0t2xr(m oo4amenlnet ()sDurxr ;t4alxo i3iaslmDrmn s;t0 rtniociy1fat livi;t)teurxr3nodlmt mivil( aDtaumoot0opt  oetysla2elnvo;(4aetnmo3iytlpD  i s;(0sexrxmpnu1ll emncias)aDuaxm nt0tpeoio3ils mDemump t0 lerio oatopt luvils0 rxr(mpnudamt  ictasf Drr(mpno0tpeomfciltfs2rm( pnu4alxoifciydfat an il(0t2toxr3ou4om  micslsf Dtr(rono1teeomieiyd sDul( p;u4aeermr3oa1opDrau ils)s2uoxm io1lltnmnvsas  ruaump;u0tpx mfeilslaDea(mo;(0treomoctodlp elivi s)sexoxm3iydal nlivt tf Dumu o;o1oetn i3iydla2raump;t0alxnmfcty1opDean i;( srxmxr ou1ap nlnvt (f rumx p;u1oet  o3iad a2uaumo;()artniocoa1fp rauvs;s0tetrio3oy4om n ict (f rtmurpou4tpt iieiltfs uauvsnt4trtrxfcoytoateaieo;t trtrxm3no1omeeliviatfaDtax o;t0tle moeilslm el(vo t0altrir3iodomD lu ols  eurxr iydap  lfvt s) Draxronu1alxoif3tyslm2el(mp u) rtnxo oydomteau o;t0teur(o3iu4om emneiatfsDrr(rpoo4optnmo3iytlaDrm(mpnt)aexoiocoodopt  uvo t) rtrir3nu1am emieiltfaDumx  oo1optnmfetlt a2ea( o;(0tetrmocoytfm  lnesl( texo(opoo1lltnmfviasfs2urur ;o0tpenmfetydlsDea(vp (0alerif3oo1optrli o ( t2trxo3nu4amtelnesat  rum(mpoo4aee ifeiasfa rauvo u) eeniociy1fmteai i s0s2urir ou4lmenmicia(  Drrxm ;t4tex mfeiltfsDumnvsnt0 ltoxr iytla e u i ( teur(m3oo4ll n feiat)srua( pot1tptniictltfm2umn onu0aleomr iotfmtr neil(0setrxo io1lp   fcias)srumxm ;t0olxoiiciytfsDem(vs;t4trtomf to1lmDeln sl(0t2xm(r nu4altelnvta(f Drmxrpnt4apx mo3iyd a elu s;(4tetnmr3iy1fptrlnvolt)s2uoim3ou1op n iesasf rraurono1aeen f3iltla2ranvp;u)alxomrctatoateluvi (0 2ur(opny4opt  nesa(f rurxmooo4tpeomfciytfa2rlums;u4 exomo3ta1lpDean i t0 eum(opnodop emictlsfa2trurpnu0aeeoifetlslaDum(vo (4tetrmf oytop   neils  2urxm3io1opt  ncil( srtrxrpou0tpenmiciaslm2rmnmp;() eerircto1fatrln sls)texoxr oy1ll e ncs ()aDtrumo;t4apenmoetaslm2eau p;u0 etnmr3ia1faDrlu ol()teurxr iu1omtnlfesat a2rr(  nt1altoio3iysfa2rmuvpn(4tlenmf ia1late neol(0srur(mpiydomtnlfeil() Drmur nu1tlxomietaslm uauvo ()trxnmo iotfatelneo;( srto(o3io4ale mfesasfarumxrpoo4aptn o3iytfsDemumo;u)alenifcoadoatranvilt)s2xr(rpiydoltnmivilt)s2tmx  oo0ale miciat s2eaumo (4tlermo oa1op  luei;s0setrim iy1llte fvi ()arrm(m ;u1tpxomf3tyslmDuan sn(4tltrxfcoatlmt  ies;()t2urir no1amtn neils  rra(mo;o1teenioctlsla2ea(mpn()teerxrctydopDean o s  2trxm oudlpte fctas s2urxmonu0tlxoiictad sDraumpnt4tlermo3ta1lateaivs s)t2xoio iy4oleelnvia(f 2rr(ro;o0tpto oeildfsDeauvp;()tleomf3tydomDelivi ()texrxr iu1ol emfvi s srrauronu0tpx if3ilslmDuau pn()aleoxfcto1op r n i;t  rtrxr iu1alenlfci t  2umxro;o1optoioetaslmDrm(msnu0teeoxo io1fp elivo (0 2toio oudll e ncilsf Drax p;o4aptnifctat s2uln sn()tltrxf tytoa r n s t)tetrxm3oodlmenmnesls) 2ta( ooo0oet mfctltls rauvpn(0 rxrmo3oadomt lueo s0sexmio nu4apt lict sfaDurxm ;o1apeniicias a emnmp;t) etomr ta1lpDeaivi;t0tetr(r ny4lpt miciasf Drrurooo4olenmoeiaslm2uau snu4artnio3ia1fpDran slt) 2tmxrpno4lpe livtl( sDuaum ;u4opxo i3iydfm2umn p (0 exoxf iadfpDe n il(0 rtr(opoodlpt mivil(fsrururp;u0oeenmoeiad aDuanmsnu)arenir3oa1fmDrli o t srtoio3nydoptemfetl()s2ua(r ou4opxnifetysfs2ul( pnu4artnifcoy1lp r ueo t) 2xrxrpou4lp elictl() Dur(rpoo4ope  f3iadlsDem(mpnu)treomocoo1lmDrlnesls0texmxopou1apt  nvsls)aDrru  ;o4tpto fciysfm2umumo;t)arxrmr iytlmDrlnvs;s)seumio nodome lies s)sDurum nt1alenmi3tls m rm(mp t4tetnmo oo1fp r iei (0 etoxr iy4llt  ictasfa2tmxmpnu0oleo f3ils sDum( s;t0arenio3iydlpD anvo t)teumxrpou1lpenmivt s) Duaumpno1aleomo3iysfs rlnmsnt0aleniocootlpteauvol() rxoxm3iodamtnlnci () 2um(  oo0tpt io3ilslaDua( s;u0tlenmr oo1fpD an s (0srxoxrpio1apt  nciat) ruau o;t4tpxoiicild mDra(mon() lxomr3ty1oate nes;t  rxoim3nu4alt livsl(faDraur nt0olxomieiad aDra( snt4artrif3tydfm e i i;( srumxr no4amee nvt (  Dtmxront1tptnii3tadfmDrm(vp;t4 renxo iydlp eaneslt  rurirpnu4ap nmfcil( aDrm(  ;u0ape miciysfsDranvont0teerxf iotom  aies t)t2xmio3nu1oltemictlt  Dra(  oo4oltn f3tat a ranvonu) lxoio3ootomt an s (0 rumxmpiudal   iei (fs2raumpoo1tle iietatlsDemn o ()trtnmrcoo1fpt  ieslt trtmxm ou1lmenmfcs s s2trur ou0opxnmfctatfa el(vo;u0aexomf3tatlmD lneo;() 2xmxr nu4lpe lnctl(fa2um(  ;t1oleoii3tat a2rm(msnu) rtnir3iytfm e ivs s t2toiopny4apee nvi () rururont4olxnmfciysfmDelu p;u4teenir3iytop   nvo;( trtrxo3oy1lp n ietas  rur(m nu0aetomi3tltfa2ul(msn()altoxr3oa1op   i il(0t2tmxo nu4al elietlsfsrraxrooo1oleomf3iydfa2uauvo t0trxrio3oy1fate nesls sexrio oy4ole  fcsat  rum( ono1oleomo3ilt mDem(vs u4 lenmocto1fpt an i;(  rtrxr oy4lltemncils) 2rr(rpno4altnifeiat m2eauvsnu0 rxrmf3iydoaDelivs;s) rum(m3oudale  ncs (fs2trurp;t0tpx mo3iad mDulnmon(0 renmf tatlat lnvo;s0 rxrxo3oy1omeeliesltfaDurumont1oeeomiciad s rauvo t4 etnif3iodfmD auvo;(  2trio iodllt  iei s  2uaur oo0ale  feiltlm2ra( p;(0 renmrcio1oa elnvi ()texrxo ou1om nmies (f 2tr(mooo0texomieildlm rl(mont0 reoxo3iotfaDraivo;() eumiopiu1om emnetlt)sruaur ;t4tlxomfciat mDeanmpnt)texrmo iytfmt lieil( trum(r oydoltnlnvsat  Dtrurooo0aptomieiasfmDeaumpnt)trtnxo oydom rau s;()teuoxrpnu1ol e fvtl(fa2taum ;u0tleniictyt s2rlnmp t0aeenmrcoytlm r neslt t2xo(r3ou1aptn nci tfsrumu o;u0tleo oeiysfa emu o (4alxnmf3iotom rau i s srto(opny1ame lncia( arrmurpnu4oet if3iytfs rmnms;(0 lxomo3to1lat luvslt  2tr(rpno1lmenmfcsls)a2rr( pnu0opxoifeiad a uanvo (0trenxrctatlm eanvi;()texmio ou1lleemnei (farraxmpnt4opxniieildfsDumuvp t0 etnio3todoate ueslt0 rtrimpnu4ape mnvs tf rrm(mp;t4aetnmoeiadfaDul( snt4arxoxr ia1fa e neo t)teurim3io1am elnvil(f Dtru o;o1openii3ildfaDrlumo t)treriocta1fa   ieslt0seumxo oydop  lfei tfsruaxrpnu0tpxomictldls2emnvs u0texoxf3ia1lmte neol( s2urio3oudlleelfvi s) 2tau pnt1tptnio3iadfsDumumo;u4 exrxociodfm  ln i;(0 rxrio iy4apeemfet (fsDra(rpno1tpeoifeiytlaDea(vs t0aeerxo oydom eaueo t s2xmxo3oo1apenmfvsltfaruaxrooo4olenmoetadfmDea(ms ()trenmr tadlmteau i (  rxm(o3ou1olenlncs tf 2tmxmo;t1oetnmfciat a rmuvp;()arxoxrctytfm rau i ()srxm(o nodlp  mfetl(fa2uax  ot0tlto feiad sDrauvs;(4tetoirciatlaD lueols0 exoir io1lmtnmfcias)a2rmxmo;u0aeeomoeiytfa umu s;()artoxrcoodlpD  ivslt  eurxrpiodomte ncsa(f Dta(ronu0apxniiciadla rlu pnt0trtrmrciatfpDeaueo;t0 eur(opiy4lpeemnvias)a2rrxronu4aee  ieiasfmDumuvon() rtrxo iatfp e u ils0s2trxr ny1lm nmnvil(faDuaumono1tpt ii3iyt s2eauvpnu0altoxf to1fmtrlivo;(  exm(m no4ll nliesas  rtr( pnt1oexo fciatlaDuauvo u) etrxf tatfm rluvol(0seuoir3oo4lmtemneta( s2rm(r ot4oetn f3iyd m2emump;(0 lxrxocootlat  u i s0seumir io4lpte ietat) ruau pnu0apx  o3iyd s umu s;u) rxnio3totfm rlieo;s)trxmimpoo4am nmfesl(  rtmxm ou4tpx mf3iasfmDrlu o;u4trerif3tatlpteanvilt)t2uo(m io4oltn neta( s2uau pnt1tex  fciasfa uau pnu4trxomocoo1lp   neo (0 exmir3no1om nmfei tfs2uaumpot1tpenifciltlm umu onu)tlxrmr iydom  au o ()srurio3ou1ll   fciltfsDumur ;t1apxnifetyd a emuvp (0altrmfciatomDe neo s  2umir iodalte ncta( arua(  nt1tlxomfciaslm em( o;(0 leoxr3ia1omDrai i s) ruoiopnudlp elnetatfa2ta( o;t4aet mieils m eanvont)tlermo3iytoptr ieo;() exoio iu1am emictl(f ruauront0opx ioetyt aDrmnms;() rtnxr3iy1lm ranvsl( srxo(mpnu1opt  fci s) 2tm(mpno4oetomietasfsDrl(vp;(0 eeomr ty1oa eluvils)srxmirpno1lmeemneiasf Dtaumoot4olenmociys s2ulnmp (0 etoxfctodomt anvi t0trtrxrpnu4lme mfeia() 2rmu  ;u1apeomieiadfa2em(msnt)aleoir oy1oaDelnesl(  eum(rpnodam nlivils) 2um(  oo1oee mfcilt a2ulu onu0tlenio tytom  ln o s0 rtoio3iy4aleemfctat  Drmu  ou1opxnii3tyslsDrauvpnt0 lxnmf iotlp  auvs s)setm(m oydlm  mnvil()srrm(m oo4apxomictltlm ran o t0trxnifcta1oatrlues;(  rto(mpnudal   ics (  2ta(m ;u0opxoio3tltfm rmuvo;u4tltnxociatoaDranvol()srtrxopoo4om e icia()sDtrx  ou4aex mictasla rl(vs;u0tetnmfcta1fm ean i;( teurxm3oy1opee netls sDtaxr no1texoiictls mDumnmp;t) eenio ta1fa  lu ilt0 2xmim3ny1ope lnvta(  Dtru o;t4apx  i3ils s2ulu p;t0tetrxr to1fmtelivsl() etrxm3iodaptnmfvi s sDumu pot0alenmfciadla ea(vo ()aetnmociytoaD luvs;s0texo(o3iy1amtnmiesasfsDum(rpot4oetomoeilt s2eln s;t0tetnmrcia1lp e neils) ruoiopnodlmt  ies (faDtaxrp;o1apxn feiytfs rmnvpnt)alxnir ootop eau i;s)srtoim oy4lm nlfviatfsrtmumo;o1ale iieildfs eauvo u) ltnmr tytfpDran o s0 2xoiopiy4omeemietltfarrru onu4teeomieiat a2rlu pn(4alenxf3ia1oa rlueo s)tetm(r3nu4lptnmictas artaxr nu0apxoioetadlaDrlnmo u0alenxrcio1fp raiei ()setr(o3ny4lpe mietasfsrrm(m nu1apxnmoetadlmDelnms;t0tetoxr iodomt  ueo;(0t2xm(r oudoptnmnvtl(fsrta(moot0optn f3iatfaDuau o (4arerifcoo1fpDe i o (  2tmxopoo1lpeelfcsa( s2truronu0olxo octas aDulnvs t0 ltnmo3oydfaD aueslt setrio3no4olt  ici (fsrrru  no4alxo iciltfa2elnmp;u4teeoir ootfa  lieolt0s2uo(m3iy4lpenmfcs ()sruau  nt4open oeiasfsDra(mp u4 eenmo tydoaDelieil()srxoimpio4llen fvs (f rtru o;u1aetnii3iytls2emn s;t4tltrmocoo1opDe nei s)trxrirpiydamenmfcsatfsrum( p;o1aet  o3iyt m eanmp;u4texomfcio1fmDelivolt0s2um(rpou4omee ivsasfaDuaurpoo4ale mictltlmDemumon(0 exnmfciy1oatrauei ( tetmiopiy4om   fet s) rtmxr ot1aetnmoeiasla eluvs;t) rtnmo totlmDe n s t  2tr(opoodlmt lfcsls)a2raumpou0tptnmfctas mDuanvsn(0 lxrif3iydom elnvs s0 rtoxm iu1lpte nvsls  Dtrump;o4apxoioeiatlm2uau s (0areoxfcootoateanvsls  ruoimpoy1llenmiesl(  Dtaumo;u1texnif3iytfm2rmnmp;u)arxrio iodlp r ieolt0srxmxmpoodam emfesasfsrtrxmp;u4oex ifetas a rlumo t4 ltnirctadlmD ai sls texo(o3nudlpt  fvs t sDtm(mp;o0aeeoif3iydlsDemu s;t4 rtoxr3oodfa  livolt0s2xrim3ny4omenlncilt)sDumur nt0tetoif3iyt s eanmp;t4 ltoir io1fp   nvolt)s2urxm3nu1apenmics s  2rmxmp;u0aleomoeiltls2rmumonu4arermfciatomD luvsl() 2um(o iudaltemfvilt srta(  ;t0olt mfeiasfaDrmuvonu)aetoxf3to1opD auei (  rxo(m ny4ol n nes sf Dur( ono0aexo o3ils m umn pnt0 lxnmf oodfmtrauvs s)truo(rpno4amte netl( s2urumpnt4open oetydfmDrmnvp;u4 exnxf iotfm eaieolt  rtmxrpiy4aptnlnct (f rum(rpnu4apxomfetad m eauvs;u0artnxf3ootlmte ivs (0setrxr3oydap nlies t)aDrrurp;u0oee mo3iys aDem( sn(4 rtnxr oytomDranvs;s0 2tm(r3oydll   nvils) 2taum ;o4tpxo feilsla2rl(von()aeenmr ootfmDraues (  2trxo oydlm emiei (fa2raxm no1aee  ocilsfmDua( pn() rtomfctodla  lnvi;s  eto(mpnydlptnlnvia( a2uaxm oo0tlen ietyslmDemuvs;u) ltrmfcoydfpDeai olt)srtmxr oydap  lfetlsfartru pnt0tlxnii3iatfm2emums;(0teenmf iadfmtelu o;t texr(mpoodol  mivia( arta(ront1apeo i3iydlaDulnvsn(0treoxrcty1om  lnes ()texo(opny1ameemncsa() 2ua( ooo4texoifeilsla rlums t4trenmr3iytfaD ln o ()texo(rpiy4llen feils)aDrrurpot4apto oeiyd sDemnvo;() leoio oydfmDeaieol()t2uoio ou4oltnlivias)s2um(ront0olt if3iadla ranvs t)aetrmf ootoaDeli s;s teumiopnu1omtnmnes t a2uaxmpnt0opxoio3iysla uanmo u)alxrio to1la rlneols  euoxrpnudlltn fes t sDrrx o;u4olxnioctys m2uanms;() lxnxo oytfatrlnei;() ruoxr3iydomt  fvs sfs2rm(  no1oee miciad sDem(vsnu0artnir3io1fp  li s;s)srxoimpiu1omen fvia( srta(  ou0aexoii3iltlaDemnms (0altrmr3iydlptrlu i;s  rxoxopny4ape lfvils) Dur( oou1apxn iciydls el(mont0aleoxo iydfp eaivil()t2to(m3no1omt lfet s s2taxrpou1aexniiciat sDeauvsnu0 rtnmr3oydfm   iei;t0teumio3iydlm   ieslt aDrm(  ;t1tex  i3tytls emnvp;(4alenir3tatoa  livi (0 rtmxopiudll e feil(farraumoou1olxn feiat a2rmnvsn() ltoifcoa1lp eaivo;s0 etrim ny4am emnvsat) Drmxr no1olxnifciytla2ulnmp u0tetnxf tydom elnvs;( srxrxmpou1op nmfcta( s2tmxrpnu1aet mi3tltfm2ua(vs (4 lerxfciadfpD lueil(  rxoxr iodal e nci tf rtru p;u4apxnmfciatfsDrmu s;t0alxrio ta1lmDraiei;s)t2to(m ou1ll nlncil(f Dur(m ;u1aet  feiytfsDranmp t0tetrxo3ootlm  aivo t)t2xrxr3iudlpeelncsasfsDtrxrp;t1teen oeiaslsDra( s (4 rtnir3totlatrlu slt0s2uoxr3nudlp nmnciasf Drrxmp;u0optomocilt a uanvont)aetrxf3oodoa   ieo;s)teuo(m3ny4lptnlfesasfs2trxr ou4apx mictlsfmDuanmp u0 lxnmo3todfateaieils) rxmirpnudlltnlnei tf rumxrp;t4tpeomfetad m2ra(vsn(0arxnxo iydlpD  i ils srtmxm3no4ope  netasf Dtmum ou4oexniocilsls rlums (0treoio3totlatrliei ()teum(o oy4lpenmiet t) rururoou1aex  octyslm2eau p t) lenircootopt  u s;()tetr(o3iy1lpen nvsas)aruaxrp;o0apeoii3iad s2ul(vsnt) lxnxo3ta1oaD lueo (0 2tr(mpiodal elfei s)a2um(rooo0oeeo o3tatlmDemu o;u) rxrifciytla ran ols  2xmxopiy4lmte fesl(  Dtmu o;o4olxoioeiys s2ua(mp;u0aeerxfctodlaD aiei t  rto(mpoudomtnmnvias)s2rru oou0oexnmicildlsDeau p (4 etrmr totla  ai i;(0 2tmiopoydlmt  nctat) rrrumo;t4tpxoiicils m rmu s u4arxrifcoo1opt  uvo (0tetoio3no1apt mivs s)aDum(mpot1tetomo3ildfa uanmpn(0 renmr3oa1latrlivi;s)trxoio oodop n nvtat)aruax o;o1tpxn f3tlt sDemumsnt)tetoifcootoaDe ueo;( teuoxr oy4al   ietlt)s2um(ro;t1aeto oeildfa2uau s u4 etomo3io1op r i slt)s2to(r nu1al emicilsf Dur(mo;u0teen oeiadfm2ra( p (4arerif oo1latr ueslt sexmxr3no4ome lfcslt aDururp;u1oleniociat sDel(vo;()trenmf ia1opDrlivo;s0 rurir3ou4lm nmicta( arra(m no0ape  octysfa2ran o (4teenir3ty1lm rli ilt) ruoirpio1lm n iciasfs2um(rpno1apx  o3tadlmDrl( o;u) lxnio to1om  lues () rto(mpiudam nlnesl(  rumurpnt0tpx ifetyslsDrluvs t4 reoif3oodlp  lneslt)s2xmirpou1apen ncils)aDuau  ;u4oeenifeiltfa emu pnt4tlxnifctatoatean o;t teurxmpoo1ll emiesa()sDrmx  nt1texnmfeilsfm ua( o;(4 rermr3totfptrlu i;t) etrxm nudalt lnetls)a2ra(m ou1tle  icildlm raump t0trxrmo3iodlm e uesls0 exoim oodam elfvtlt s2urxr no0aet ii3tltfs2eln s;t0aetriocoodfp   u s;t)setoxm3iy4llen fcsl(f Dtmu ooo1opx  i3ildlsDem( pn(4 rxoiociydoatelies;( tetmxopoy4op e ietas)arumxr nt4aexn feiatls2elnms t0tltoxo3iatomt lneo;t  2tm(m3oo1apte fvslsfaDtmx  ;t1tlto ieiaslmDeaump (4tetrxo oydfa r n s s0 eto(opoydlm emnetlsf Drr( oou1apt iieiltfs elu p (0tetnxo3iotlp rluvo s)teumxo no1lmt mfcias)sDrrumpnt4alen feiytfa2emnmp;(0teerircoydfat ln ilt0srurxmpoodaleelfes t aDururp;o0olxnmo3iydfs eauvsnt) rtoif3oo1faD livo;s) etmir3ou1am   iesat srumumoou4apxnmieiytfm rlnmo t4arerxo ty1omte nvs (0 etmxo iodamtn nes s artr( p;u0teeoiiciyt s2rm( p;u4 rtriocio1lm r i i t0t2xrir nu4ale lnctas  Dtaxmp;o0apxniietysfm ea(mo;u4alermo iadlatr i s t srxr(rpnydapteliesat) rraxrp;t1tet  fetlslsDrmu sn(4aexomo iy1opDeaivi;t0s2urirpnodlm  mfcils)srrax p;o1oltnioeiytfaDrln s t) rtnxfctodopte iei;t0srtrim3ny1ole mivtatfaDtrxmpnu4olxoiieiat m2emuvo;(0treoirctydlm eaivo s s2tmxopiudllte nvsls) rrr( o;u4ole if3tasla2umuvp t)aleomf3iatfaDr n o t0 rurxm oo1open ivsa() Dtm( ont0alt mictas a2ea(vsn(4 leoxo3oa1omt  nvolt0 eur(mpiy4ap n fvias aruauronu4texn ieiasfaDuanms;()trtrmrcty1fm e uesl()t2um(o oo1llee ict () Dtax o;o4opeo feiysla ua( p u0alxoxf iytoptr i sls)t2tm(o3nudlm  mfeias)aDra(m nu1apeomfeiasfa rln p;t)texomociodopteli olt  exoio ny4alenmneiatf rur(mo;t0oltnioetys aDuauvp;(4tetrmrcty1laD  u olt)s2tmxm3no1optnmfcsltf rrrxr ;t1tpe mociat s2eaumsnu0altnif ootfpDeanvo;s0 exr(m oudlpee nesl(  rtm(mooo1aetnif3ilslmDum( ont4tlenxrcoo1fa  lueil() exoir3no1lltn neilt)a2ua( o;t4aet mfetls s2ra(monu0 eenifcta1fpt lu o t0trxoiopoudopeemieia( sDrr(  ;t0tltn ieilsfs2umnmon(4trxnxr3tydlat livi;t0t2xrxm3iu1om  mivia( s2tr(r ;u1aleomo3ils aDulump u)texrxocto1fa r u s s) rtmxm3no4lptn ies s aDtrumo;u4teto i3ils m2elnvsnu)texoxo iy1fmDr n i (0srum(m iodlpt mnei () Duaxm ;o1tetniictls aDelnmo u4tetomr3todlmDeanvs t)trxmxmpoo1lpenmiesa()sDrr(mp;t0aeenmieiysfsDraumonu) etrif3todfaDeanesls seum(m3oodaltelfetatfs2rau p;t4tetnifctys mDrl(mp ()alxoif3tydop eaiesls0srur(o3iu4am nlfvs t)arrm(ronu0alxo i3tld aDel( o;(0 etrif oo1lateluvo t s2xmimpny4ap emfctlsf 2tmumpnu0aexnif3tlsla2eanvont0arenmf3tatfmDr nvsls trumxo ou4opeemncils sDum( p;t0oexo o3ilsla2um(vs;u)areoiocto1fptr ueo;s0texmim3oo1lp nliei (fsrraxmo;u4oee mfctldlsDemnmp u0arerxfcoa1omtrauei t) 2toim oy4lpenlfetlt)a2tru o;t4oeenioeildlsDrmuvp u0tltnmf3tydfaDr i s (  etmxm io1op emfeil()s2ur(r ;o1opto fetyd mDeln pnu0 lxnxf3totfptr uvol()t2tm(r3iy4llt mfvtl( aDrax ono4tlxn icilt m emu onu0texrxoctydfmDraueslt  etoir3oy4alt lfeil(  rtmur ou4tltn fetasls eanmont0artrxrciodopt lueolt0s2urirpoy1amtnliciltfaDrrumont1opeomfciltfm2umu p ()aetomo3oodlatelivo (0trum(mpny1ale mictat)arraum nu0oetomoeiasfa2eau pnu4aeerirctotfm r n il() rtr(mpoodapt lnesat) rraxr ;u0oetn oeiatfa2emnmsnt4tetrxf todlat  ieil( s2uoxopoy4lme lfesa(f ruaxrpot1tetn ociltfmDrm(mp;u0 eeomfciodlaDeanvo t)s2trim3nudomte fvtas  Drmxrp;t1oexoii3iysfs eauvs () lerir oytomtr nei s0t2um(m io1alenlfcsl(  rtaxm ou4olt  i3iys mDua(vpnt0teenmociodlpDrli ols trtm(r3oy1alt mnvia()s2tr( p;o4oeen f3iasfm2rlnmpnu0 rerxrciy1oa r u slt0s2xmxm iodoptnlnvsas sDrru  nu0apxn fetld sDuaumonu0aetnif3io1fpteaueo;t  rtrxmpiu1omen ictasf Dtaurp;o0tleomi3iatfm2el(vpnt4arxomo3todfa r i ols) eumxopiy1ap e ict ( artaxmpnu1olx  fciatla ulnvpnu0 leniociotlmtelneols s2tmio3iu1lltnmicils)aDurxm ou0tptnmo3tadla raump (0tetomo iadfaDran il(  etr(o3oo1llt lnct tfsrurumo;u0tpx  ieiaslmDeluvsnu4artnmrciotlaDrli slt0sexmio nu1lpe livtatf Durxmp;u4apx  oetltfa2raump t) etrmr3ta1lmD li s;()t2xrxo iydlp elnctas)aDrmx  ;o1apxnmfctyd m2umuvp;(4tltoxf3iadlpDeaieilt)trto(r iu4llenmneta(  2umu  nu0aptoiiciadla2eauvs u4trxrif3oy1oa raivi;( seurxr3ny1lme mfetls) Dumu pot4tpe ioeias m2rm(mp;(4teenxo ia1omtrauvs s0texmxopiudom emnei sf Durxm nt4opxniiciysfaDrmu p u)aeenxf oodfmt auvi;(  2uoio3oodop  lfctltf Duaxrpot0oeeo iciad a2rlnmo;u)altoxo oytlpD  uvi;s  exmxmpoydomt lfcta( srtrur ot1tlxnif3ildfsDumnvo () exoxf tytopteai i s)t2to(m io4amee nctls)artmurooo4tleoiictyt a2raumont0 lenirciytoat  ues;s0 2umxr3ou4lpt lnctltf 2rmumpot0aeeomfctltlm2rau o;t4aetnmfctatlmteaivolt0 2urimpou4oltn nctls)srta(rono4oexo ieiadfmDrm(vonu) ltrxf3iy1omDrau ilt trtriopiy4om  mfetl( s2ur(  ;u1apen i3tytls rmumo (4arxrmr tadop  li ilt0 2xmiopiudomtnmicsls)aDtaum no4aetnmieildfa2eauvpnt0 eeoxf ootopteli i t seur(m nu1lltnlivt ( s2rr( pnu4altomoctlslm2umu s;()tetrifctytlptr i ils) ruoxmpiy1omeemivtlt a2tmurpnt1opeomi3iys s2rmu s (0trtomf iodfa  aneols) exrio nudale liet s)arrm(  ;t4aeen feils mDrmuvp t4 leoxfcio1oaD  u s t0setmxm3io1lm  licsls)s2uax  nu0aptoioeils m2emn pnt0aexomo oydlmtrlueols0t2tr(o ou4ope mnetlt)a2tau ont4texnioeiydfaDem( o;u4texrmf iytfmt lieols)s2ur(mpnudoltn nei sfsrurxm ;u4tpe  i3ildlmDra( p;u) rtrmo3tatomDraueols  etoxo3nudopt mfcsltfarrmuroou4alxomi3iltla uanmo t4tltoiocoadopteanvi;(  2xrim ou1ameelnes ( a2rm(m ou4alen fciasla rmnvp t4tlxrir3ty1fa rlu slt0 2uoir iy4am nmieia( a2uaum ot0tlenioctldfaDeln s;t0tlenmf tadoaDe nvs;s s2xmxr3oo1lm  micsas)srtaum oo1tlt moeiltfs2ranvo ()trxrio ia1oatelnvo ()teurxo oydlmte iet sfs2taxrp;o1oet  ietlsls2elnms;t4trtoifcta1om rlivo;s0srxoxmpny4llen ncslt)artm(ro;u1tlt ii3tas s2ean s;t) eenirciadoa rlieols0 2ur(r nodopt lneia(fsDrmu ooo0tee iocils sDua(mp;u)teerif oodlmt  n sls)t2uoir iydolen fetasf ruau o;o0tle mi3ilslm2rlumo;(0teerircoodlmte nei ()s2uo(mpno4apeemfcsltfaruaumo;u4apt  icils a2eau pnu)trxoxrcoa1fa elneol()tetrim3iy4om   fvt ()aDuaxmpou4openif3tltfsDra( s t)aleoif iatlatelnvi ()s2ur(m iy4lltn nctasfaDrmumpno0altnii3iyd aDemn p;t) ltnxrcoy1lm e i o;() exoxmpny4alte ictat a2rmxm nt0aetoifctltlmDel(msnt4 lxomf3iodomteanes ( sexm(r iu1lpte netl() 2tmur ;u1aetnmi3ias s2rm( s;u0tetoxo3ia1lmDrai sls trumimpoy4op nmfvil(fs2tauront0aetnmicilsfa2ua(monu0alenircta1lmtr i o;( sexo(m nudope lnvs tfsrurxro;t1apeo fctas s2eau p;t0aetnxf iotlmDrlu o t)s2ur(r3no1olt mnei (  2umur nu1tpe  ieiad mDelu p;u0 ltnmocoy1fm  lnes;t0teuo(rpnu1lmt mivil( artr(  ou4aetomietatlm eauvs u4arxoio iatfp eanvo s) 2um(o3oydom e ietl(faDra( o;t1opto oetlslm2rm(mo u)aeenif3ootop  ln o t0t2ur(r3oudal emici sf ruru o;o0aptn fetysfaDrl(mo;t0trxnmr3iotfptelneol(  2tmiopno1apt mnei (faDrmur ;t1tltomfeiad sDumnvp;()aexrmocoa1opDe i slt0t2xo(opiydomeeliesl(f Dumx  no1tpen ictldfm ranvo (4treomfcia1la e nvs;()texmxo3oy1lmt  ivil(f Dumx ono0olt ioeiasfm2eauvo u) exoifcta1fmtrau s;t  2xmio nudlp n fvt t arumxrpoo0opeomfetldlsDum(vo;()artomocoydlaDrlieils) eumiopoydlmtnlnciat srrmx oou4alx mociytfmDemuvp;u0aeerxrcoatoaD livo s)srtoimpny1opt lfcilt aDuaxr nu4ope ifciys sDemu snu4 ltomr3oytla r nei;t  2tmirpiodomtelfet () rtm(  ou4apxnifciadfm umump;u0 ltnxr oydopDean i s s2um(o nu4om emncsltfsDraumo;o0tle iictyt a2rln p (0trxnxfcoa1fm ranei s0trxrxmpiodlptnmfvs t s2ua(rp;u4tpt if3iad sDrmuvo () renmr oytlptraues;(  rurxr oo1ll  lfvtat aDra( ono4tlenmociadfmDeau o;(0tltoif tatfaDe ivils srxrio io4aleemiviasf Dtrx  ot4tptn oetyt aDulumo u)aleomo iadopt  i s;( sexo(m nu4omt  icia(f 2trur nt0aeenmi3tydfm2rlu pn(0alxomf ty1om eluvo s)srurxr io4opeemfvsls sruaurp;u1olx iicilslm ulnms;u0aeenio todop eluei t  exmirpoydlltemfcta( aruau p;u1apeoif3iadlmDuaumsn(4arxnmo3tytlaDe uvols  eurxr oy4ap  mnet (faDrmum ;t4teenmociadfa2elums t0 ltoxo ia1fmDrlueslt) exr(o3no1aptemfcsl()sDtmumo;t0oeenif3ild s2ranms u4teeoxf ty1lmtr n i;(0trxr(rpnu1al n nct ()a2tr(moot0tlt mfeilsfs2uluvpn(4teeoif tydfmDeaiei (0seur(m3oy4lmt mfet (fs2rr(  ;o0texoioctld m2elu pnu0 etoir3iatfptrli s;( setmimpnydomtemfeslsf 2rrx ooo0olxoifcildfaDum(vs t0texoxfcoa1fa e n s s)seto(r nodlm nlneil() Duaxm ou4olenioctysfsDrl(vpnu) rxnxo3iy1latelneo s0trumxmpou4lptnmivsl(fs2ua( pno0opto o3iysla rauvs;()alenmf3oydfmD an ilt)setmir iu4amtemnvs sfaDur(  nu0alxn i3tyt aDrau o t) lxoif oydlatrai s;s0t2xo(m ou1alen nci t sDum( oot0tlxn ictydlm eanmpnt)teermo3to1fp e neolt) 2umxm3iu4lm n nesa()arurx oou4opeoiicild m2uan snu4 etnmr3iadlmteai i;s0trxrimpnudop   nvs ( artrx ont1altomiciatla ra(vo;(4aeeniocto1lptelnvslt0 rxoxm3io4oltemnetas arua(r ;u1apto fciydla2rlnmp (4tetnxf iatlp   ieil( seum(m iu4opt lfvsltf rtm(m nt1ale iietlt m ua(mo ()alenxr3iy1optelivils0t2umxo3nu1llenmfesa()aDtaxro;o0oexnmoetydfa2rlnvont0 rtnmo iatfaDeau olt setm(r3nudamt mnvtas) 2tr(m ;u4tee  fetlsfa umn onu)texnif3iodlm ranesl()srumirpou1opte neia(f 2uaxmont0texoiociysfsDulu ont)texomr to1fmteai s;t s2umxo oydopeemfvsat  rta(  nu4tpto fctyd s emu snu)arxrmr3tydopteli i;()t2toir nu1ol  lictlt) Durxmo;u1tpx moetyd m eaumo u0arerir3oadlaDrauvs;s)teuo(r oudomtnmfetlsfsrtmxrooo0aeeo oetytls uln s;t4 etnirciotlp rluvs;s srxmxr3oy4ope lfvi (fs2rm(  oo0tlen i3tat a2ean o;u4trenmo oy1fmDr ies;()srtmir iy1lpe  nesat) Drr(m no0opto f3tydlm2ua( p ()aexomf3ia1fptr iesl(0teuoxm3nu4optemncs t aDtrxm ;t1alxoifeiyt m emuvpnu)trxomf3tytopt an s;( t2ur(r oy4lp n fvilsfs2tmxront0optnmieiytfsDum(mo (4tetnmrcoa1oa rlieo t  euoir oo4lmenmnvsat)sDtaxmo;u0tpxomfciltla um(vo t)tltnmociodlpD an s;t)srur(rpiodoleelfci t)arumu oou4oeeo iciydfaDumn pnt)trtrxo3totfm   u ols  eumxr3io4olee fcslsfsDurx  nu1oeen f3ild m ean o;t0tleomrctatoa   i i (0teur(o3ny1lpe lnes tfsrur( o;u1olxn f3tld m um(mo;(0 eerxr3tydopDe u ols  rum(o3nu4lp  lfcils srrmxrpoo0tpeniieiat s2ran s;t4trtnxo3iy1oa r nvi s)t2tm(r oodlltelivia()s2ra(rpnu0oltnio3tasfs2rmnms;t)artnio iadfpteli s (0srxrim ny1ap  mfes sfsrtr(m nu4aetn f3tatls umn o;(4tetrxf tytop rluvo s)s2urxo ny4llt mfvs tfsDtmump;o0apxomociys mDra(mpnt)trtrmo to1fmDelivo t0 exmiopio1opee net tf 2raxm ou1opxomi3tydla rl( pnu4 etomrcoodlpD ai sl()texrir3iy4ap e icsatfaDtmx ooo0alx mietas aDuan p t4 rtrmoctodoptr i i (0 eto(opny4lmtemfes t)artmxmpot0aetniieiatla uln s t)alxrxfcio1laD  nvslt)s2xrxo nodamt  fetatfs2tm( poo0ape  ieiasfaDuaump;(0 ltrxo iy1omDelneo;s)texmxo3iu4ape miciat) rumurono4tptomoetat a2emnmsnt0artrmr3oadoateai i t0teumxr io4oleelivslt)sruaumont0ope ioeilsfa2ua(mp;(0 ltomr3iytfpDrluvi;t0 2xo(mpiydaltn nvils  2rm(mo;o1optn ociydfmDuauvont4altrir oo1omte uei t0truoio3ou1am e feia()arua( ont0oeenif3ildfm2elumpn(0trermf3iadfpt lnes;(0 2tmxopnodol nmnvilsf 2ta(ro;o4tpt ioeiys a raumonu) eenxrcoadoate u slt t2xm(o3ou1opt lieilt)artmxmooo0alxniociysfsDranmpnt4tlxoirctytfaDrln s;(0srxr(r oo1olenmnvtls  Dur( o;t1oeeoiociat mDuln o u0trerxo3oydfat livo;( s2toxopnu1lpenliviat)artmxm ;t4texn f3iaslsDrmuvpn(0 exrmr3todomt  neolt) rxrim iu1optn fct ( s2rm(  oo0apenmociytfa2rm(mont)teenmo3tadfmtrlnei s0t2urir oydape lnetls)s2tr( p;o1tlxniocias mDeln p;t)tetnxr ta1omDe n o t) rtr(r3oy4amt lnct t)s2tr(ro;t0oeto iciyt a2uaump (4aexrxociodop ran il(0t2urimpio1op nlfvtltf 2ra(mont0tet moetad a2emn p;t4 rtoif3totfpteanvi s  rxr(r ou1lm  livtas  2uru poo0opx io3tysfs2umn on()tlermocoodfpte u sl()srtr(m3iodam   fesl( sDtrx  ou1tpe mociadfa ra(mont)teenmrcoy1lmt ln slt s2tmir3io1op elicsa(f 2uax  oo4tpxomoeiyd m2ea(ms ()texrmr3todfaDr iei;t0teum(o3iudop e nct () rtm(  ;o1tlxniieiydla rm(mo u)tlxoxrctatlmte uei;s)seur(r3iydolt lnvsa()srur(ront0apt  fctld a rmums;(4 exomf3io1omt  ivs;t0 rxoir3iu1aleelnei (  Draxmoot0aeeniieilt sDra( p;(0 rxnmo3oatomt  ivo ( setmxo iudamenmivilt) Drrxmp;t4opxomfeiytfs2eanmont4aeenxf3oo1la rlneol(0 euo(m3iy1lp   ivsls aDum( ont4ape  ieiydfm2rlu o t)texomf3iy1laD luvo () 2xrxr nydlmeemfcslt s2rrumpnu1aee  ieiyt sDrm(vo (0 leoir3to1lpD luvol( tetmimpnydlp   ivi t  Drmxr no1opxnmo3iltlaDrluvs (0trxnmo3ta1lp rlivo ()setr(mpoy4al emicslsf rumxrp;t0oexn o3tysfm2rmuvp;u)aexrifcia1oaD ai o t0t2xm(r3oy1olee ivia() ruru  ;t1alx mieiatfs ra( p;u)aetrif3iotlp   ivslt  2trimpiy4omtemfcsls)aDtmu pnt1opx  o3ilsfsDrauvpn(4aetnio iodlpDraivolt)s2umxr3oo4ol  lfes s artmu pnt4opeoif3iytfaDuauvo;t0 lermr3oytomDr ivilt0 2uoxmpoo1amt  fcsls)srtm(rpoo4tpto iciytlmDran s;()aexomrcia1om eanei (0t2trxo ou4opt  nesl() rtrump;o0aeeomieildlm ulnvo (0 eeomo3tatopDrai sl(0teuoimpiu1lltn ieilt)sDrmumono1openiieiyd s2uanmo;t)teeoif3tadlmtr neolt0t2xm(r oo4oltemfetl( aruaxmo;u1aetnifctydlmDra(vpnu0teerxo3ootlaDe nesls0s2urxr oudll emict (fsrrmxrp;o4tlxnmi3iaslm2emn ont4tleomo3oytlp ranvi;s)setmxo3nydaleelietlt) Dra(mp;t4oleoioctyd m el(ms t0alenio3oytlp   n s t)t2urim no4am  mnci (  2ur( pnt4oeenmociat mDul(ms u4aetnxr3tytop  luvo;s0trur(r3iodlmee nvsatfa2tr(rp;o0tetn o3tldfa2eaumsnt0 rtoxocoadlp rlies s  rur(opnu1ll emfci s s2tru pot1alxn fciltlaDuanvo;(0altnxr oodom  aneo;t)trumirpiy1oleelfeta( aDrru o;o1tpxnmfcilsfa2uluvpnt4tleoxr oytop eli i;t) 2xoxrpoo1op  mnesas arrru poo0tee  feiyslm emn p;u0artnmociodomtrauvils)t2toim3iy1lmtnlncslsf Dtaurp;o0altomoeiat aDuau s u0 etnir iatfaDean s () exoxo iydalen fviat srrrumpno0tpeo o3ild mDumums;u) rtrir3iydomDe iei s texo(m ou4lleemncslt)a2tmxr ;o1aexniociltfa umuvpnt0 rtoir ta1opt ai i;t)trxm(r oudolt mnes s) 2umxm ou0tpeomi3iad sDrmn p t) rxrxociy1op elivilt) rtm(r iydll nlfctasfsDum(mp;u0apxo iciyslmDem( onu0artniocta1fp ranvols texrxmpiu1lp nlfct (  Dur(r no1apx  oeiatfa umnmo;u0alerxocoy1lmDr ues;t sruoxr no1amee iesasfarta(rono0apt  oeilsfa raumo;u) lxoir3io1lptraueo s0tetoiopio1ol n fvi ( srtm(  oo4alt mieiatlsDrmnvp t) rermrcoydoat lieo () exr(r iy4lm  mictls) Dtr(  oo1apxnmi3iysls eaumpnu4aleoxrctotfmt lnei;s0s2toxmpiudamtnmics sf rrau p;o1opt  i3tat s2um(vp u4tlenmf oo1lpD luvs ()texrir3ny4ol nlnei ( s2urx o;t4apt iiciysfa uanmp;t4 exnio3ty1fm e ues t srtrim ou4lle mivsas) Dra(  oo4tle ifeiyd a2ua(vo;t0altrirciotlaD lnvo t srxrxo oudomte nvi sf rum(rpou0apenifciltlm uln p;(4 rtomo3io1om eai o ()setmim3nodal emiciat a2taxr nu1opxn oeiyd a ua( s;() ltnif3ta1opD  u slt)teuo(rpou4om elfvtl() 2trx  ot1tlxn o3iyt m2uan o;t)tetoxfciotfmtrln i t0 exrxmpoy1ol emiesasfsrurumont0optomo3ilt a2ranvp;() etrmrcty1oa e uvi s truoxrpio4lpte ncs t aDrax  no1alxn f3tatfs2uan p;()aetrxr oy1fateaues t)teumio3nydap   iet t aDtrx ono1apxnmfeiltfmDul( on(4tetoirctotfptr i il(0srxoiopio1omtn ivsl(  2taur ;t0apeomocils sDuln s u)arxrifcia1om  luvs s) ruoxm3nudam  mnes t a2umxmp;o1alxomoeiad aDrl(ms;t4aetomr3tatfmD  i ilt0t2toxr oydlpen nei t a2ur(ro;u4tltn i3tltfa rlu o u)areoircoa1fp   n o;(0 euoir3iudalt lfeslt)sDtm(mo;o0opt mf3tyt mDeauvo;(4alxoifcoadop r uvo;(0trtoiopoo4lp e ncs s)s2ra(mp;t0teto iciadfmDemumo () lerio3io1opteauei;s)trtmir3nodomtelfctasfsDrmxrpno1tetn feias s2uln p;u4tlxoxr io1opt  n o;t  2umiopoo1oltnmfcias) rtm(  ot0opeomf3iyslmDumums;(0aetrxf3ootoatranvo (0t2to(r3oydlpeemies () 2um(m no4oeeoiociytfa2umumsnu0aexoifcoatlpt lnei ( srxrxo3oodop nmfes (  Dta(rpot1opxo f3ildfaDel(vonu4tlxrxfctadop eauesl( teur(rpnu1alt lfcsas)aDtaxmpnt4opxoio3tltla2elnvpnt4aexrxr3iotlp  luvi;()srxmim ny4al nlnvi s  2ur( p;o0alt mf3iadfm em(mo ()aexomo to1fptrai olt0teto(mpiy1ap nlneslt)s2uaxroot0alx  fctadla2umums (0 eenxf oa1oatr ivsl(  rtrimpiu4omee neiat arraxr nt4olenmi3tld aDul(vs;(4trxrmr3iatlat aieols  eurxm3iudal  mnetls)a2tau oou0oetoifetlt s rmuvonu0 exnxoctatfate i o () exmir3nu1ll nmnes t aDra(moot1aeeomietadlsDul(mp;u0tltnmo3iy1fpt ln olt0srur(m3nu1op emfei s)sDtmxm nu0alx ifciatfmDelnvsnt4tleoif3oydlpDelues;t  eumim nudale livs () rtm(  ;t4apt  fciad mDul(msnu4 rxoxfcoy1lm r u s;t) 2umim3nu1omt mnvtls  rurx o;o0oexoiociytfs2uan on(0tlxnif oadlpt ln sl(  ruoxm oydope  ics (fsDumu o;u4altnmieiadfaDeanmp;() etoxf3oydfptr ieslt  2uo(o iu4lptnlicsl(fs2rr(r ;t4tpt mi3iaslm um(ms;u0trxnir oy1fmt  uei t)srumir3nu1ol   fciat  Dtr(mo;t0texoio3ildfsDrlnvpnu4aexoxocia1fm eanvslt s2xrio ny4opeelfeia(fa2uaumpnu4aex iiciysfsDrluvpn()trenir oadlmte nvo;(0t2tmir nu1lpteliei t)srrr(r nt4opxoioeiatlaDumuvsnu4altniociadlp rln s;( trtmio3oo1lltnmietat a2raxrooo0aee ioctls a el( ont4 rtrmo3iodlm e neo ()trtmxo io1opt lfctas) Dtm( poo4oeeoio3iydfm2rlnvo (4aeeomfctodopDeanes t t2tm(r iy4aleemnciat sDrmuronu4aee  i3iadlsDua(vo u)altnxr3ta1lpD an o s) rurxm iy1opt  fct sf rtrumont1tlt iicilt m2ua(vpnt)altnir iytoa eanvolt sexoxr3iodalenmietasfarrrxm ot4aex ii3ilsls ra(vs;()tlenxr oa1lp rlies;(  eumxrpou4lmt miei t) rrruro;u0alxnifcilt mDul( p t)altoio tydla ean s s srxo(o iodoleelnesas s2rr(rpoo4ole mf3ias s2umnvsnu)aleoio3iadomDeaieolt)tetm(rpiodol e ies tf Dtrxronu0opx ii3iadfa elnvonu)trerxr3tytlpDrluvo;()sexm(o iu4ap nlncta()s2rauro;u0tpe mf3tytlm ua(vs;t4 rerxo oydopDelivi;t0texrir3nu1lp e ncs () Drmum ou4tptn ictad m2rmump;()alxoxo3iotfpD  ieilt)t2umxo3iu4ole mfvsas s2taurp;t0oex iocilt s2uluvp;(0 rxrmrciydlp elnes s)sruoxopoydll nlnvi (fsrtmx pnu0ale  i3tlslm2rauvonu4aexomr totlp elueo;t) exm(rpoy1lpe  icslsfa2ta(m ;o4teeoiiciadlmDulnvs (0 etoxo oydomtrauvi t t2xoxm nu4ol emnet s srtax oou0texo oetldlaDumu o () rtnio3io1oat luvils t2umxo3ny4ap nlfcia(  2raxm nu4aptomfcilt s emu p;t4tlerxr3todfaDr uvs;s) rtrxr3nu1aptnmnvsl() rrmxmp;t0apt mf3iasfa ea(vp (4areoxo ta1fat anvi s  eto(r3nydal  mivtls)aruaxrpnu1oetnif3iltls ulump t)texoif3oadlmDrlieils0 ruoxr3oudol   ncilt)srtaur ;u0alen oeiyd s el(vs t0 rtomoctytlpte uvi;s0setriopnudap   netlt)aDra(rono4alx  o3ilsls2ulnvp u0tltrxrcoy1omt ai o;()truo(m3nu1am elfvsat) rur(ronu0ole iieiys m2eanvsn(0 lxrmr3tatoa raneslt)s2trxrpno4amte nviat)a2taxmo;o1oexoiictld a rauvs;(0 lerifctatom e u olt s2xr(rpiydam n ivt t aDuru pou4tpenmoctyt s2em(vsn(0 exnio3iodlmtelivs;s0 eur(m ny4am elivt ()a2tr(rpou0tpx  octlt mDulu ont4tltrifcoydlmDrauvi ()t2xoxo iydame  fei () 2uax  ;t0aeenifeiyd a2rauvo;u4 exnmo ty1fmteau o s0setm(o3nu1ameemfctat  2rm(mo;o4altomoeias m2eaumpnt0 lxrio3iytlp eauvo;s)s2tm(m iudllenlies s s2uaxr nu4apen iciad s2umuvonu0aexoif3ia1lm r ues t)s2urxm3nodal nmiciat  rtrxr ;t4tltomoctys sDeanmo;t) renio3oy1lpD ai o ( tetm(opou4am elietas)a2ua(m ;u0olt mfctydfaDuauvo t0 etrxfcta1fm rln il( srtrxo nu4olt  nvi s  Drmx oou4openiicild s eln p t4 exoiocta1lmD lieils  2xm(opiu1lpte nvi () 2rmurooo1alt mfctatfmDumnms;u4alenxr3iytoatelnes;t) 2xmxrpou1optelivsls  ruaxm ;u4tlenmietyslsDemump;u0 ltnmr tadom raueol(0 ruo(rpno4am n nvsatfarrr( oou4tleoii3iydls uln s;()tleoir tydlp  luvo s)trumxopiy1optelfeils s2tmu p;t1aetomfciasfm2rau on(0artnxr tatlatrli il( s2xmxo iydlmt lfcsa() Dtaur ot0oeenmiciyslm umn p u4aexnxociydfpD aneols s2toim iu1am e fvs s srra(rpot1oexo fctat sDem(von(4alermo3ty1fmDe i il(0s2xrxmpoy1amtnlictltf 2raxr oo4aeenif3iytlm rm(mo t0 etrxo iytoatr iesl( s2xrirpiu4omtemietas s2tau pnt0tpenifcilsfs2uau pnt0tltoif iy1op  liei s0 exmiopiu1lltnmfcsatfaruaxr ;u0olto f3ilt a ea( s;u)aexnxr oytlm eaues s0srxrxr iy1opee nesa( a2umur no0tet ifetlt sDrl(vp u4aexomf ta1la rli o ()texmir iu1op nmivtlt s2tax ont1oet if3ildlm umnvo;t4teeoxr oa1lpDrai i t0s2toxmpio1aptelnvi sf ruaxm ot0oleomoeiatlsDua(mpn(4 eeoircia1latr uvsls  etmir3nu4ale  fvi sfa2uax pno0aeenifciyt a uluvpnt4areomr todlat luvi t  2xo(o3oydaltnlicia()a2ur(  ;o1teto o3iytlaDumuvsn()arxrmo3iy1lm eaivilt)t2xrxm3iodamt mici t) Dtmx oou4teeoifciyslaDeanvpnu4 eenirctodop elnes;t seurim iydoptemfeslt)aDurxr ;o1oeeomi3iltlaDuln on(4teenio3oo1latrlivils) 2uoxm iudal elnviatf 2rau  ou0oeen oetys aDrmnvsnu4arxrmfctadfa raivsls)trxrir3nydal  lfcs (fsruaurono0aexomoeildlaDeanmsnu)arxoxfciydfp raivs s)sexmxm3iy1ll e fcsls sruaxmpou4tex  f3ias m rl( o t0trermf oytfatean o;s tetrimpnudapt  ivsl( sDua(m nu4optnmieias s2uaump t0 lermr tatfptrluvi;( trtrxm iydlle mfvtl( sDtruro;o1tpt  ieilt sDrmumpnu4alxrxfciy1laD aies t) eur(r oudaltnlies (f rrmxmoou4alxn i3ilsfmDrluvpn(4 rtrmr3ty1lptr ues ()sexrimpiy1llenlnci t s2tax  ou1olt ii3ils a2rm( p (4alxrxrcoadopteaneolt)s2uoirpou4ope  ivtl(fsDrr( onu4ale ii3iadfsDumnmon(4trenxr3oo1opt  ieols) exoim oy1olt livi t) Dtm(mono0teeomfciat mDrmumpnt)arxrmr3iytlatrlivi s trxrxo nodlpt miesat aDtau o;u4apt iieiytlsDumu p t4 lxrmr3iotlatelu ols) etr(m3no4amtemncsat srrm(r ot0olxnii3tys s elu p;t4tetnxf3tadlaD  iei;s0t2tm(o nodalt mics t srtau  ot1tpxn f3tlt a2rln o u4 rtomf oydlmD  ivolt0 2xo(opoy1ll n net tf Dra(  ;u0tetniictlsfa2rm( p t0 ltnif3oo1fa elnvols0 ruo(m oudalt lies s  Dra(m ou4oee mi3ilt aDeluvpnu4trtnxf3oodoaD lnvils)srtrxm nudap n fcta( a2rmur nu0oee  ociyt mDemumo u)treoir3iatomt lnvol()sexmim oy1amtelfesas  2uauroot1olxoioctlt s rlnmpnu4 etomr iadlmDelnes s) 2xmiopnu4altnmicslt)s2umx o;u1ale ifeiltls rlump t4alxnxr3oytlm  aneo t)t2to(r no1om emncsls s2umxr ;u1aexoiiciadla2em( p;(0 lxrir3oa1latrli o (0 2xr(mpiydam e nciasfaDtm( p;u4aeeomi3ils aDum(von(0texnmf ty1oatrlnvs ()t2tmxr3ny4op e fcsas) Durxrono1apeomfctysls rau s t0 ltrio3oo1
\ No newline at end of file
@@ -0,0 +1 @@
+ueslt trtoio iudlltemnctas aDtrurpnt4aeeniieildls2rmu onu) exnxo tytfm   ueo ( s2tmim3ny4llee fesat  2tmxroou4opx mociasfs2eanmp;()aleoiocoytomDelnvol(0t2uo(opiu1apt lfciat)arrmur ;t4texnmiciatlm um( sn(4alenio3todla ranei s0tetmxo3iu1ap elivilt a2rmumo;u1oleo fcias a rauvs t)artrxf oytopte ivs;( seurxm iu1ame mfviasfs2trxmpot0openmfetld s em(vp t0 lxnio3tadop rluvi t t2xriopiodop  lictlsfsDtr( onu1aexnif3iad s2umuvo;()tlxoircty1lptrai o;t)s2toirpoy4omeelfes t)arrmxmp;o4altnmociltla2rl( o u4 leomfciodlmteluvs t sruoxr3oo1aptnlnvs tfaruaumono4aex mfeiat mDulu p;(4 etoir3todop eli s;(  exrxo3oudale lneta( arrmumpou1ape  fctytfs umn s () eeomo oo1fptr ieil(  2urxrpnydap  licsat  rumxmo;t0tex moeilslm2umnvp;(0tetomrcoadomDr ivi;() etmxopio4ale lictl( srtmxr ;t0tetn oeiyd sDemump ()aexnxrcty1om  au s;s0sexr(opoy1al nlnei (farumxr nt4apen o3iat mDrmnvp (4trerxf3to1faDelnvslt0sruo(rpoo1op n nvias  2ur(r nu4oeen fctadfaDrmump u) etoxf3oa1latrli o;t)t2trio ou4alt  ictl(fsDumu  oo0aetomietydfa2ranmsnu0 rtnxocia1opDeaieils0 euoxrpiy1lpe lnei sfs2tm(ro;u4aetoif3ilt a2rlnmp (0 ltnxo3oadopDr n i;t0teumxopnudlptelietas  rrmumooo0teeoifciltls2rl(ms;u)aeeoiocoydfaDr i ilt)trumxopou1aleemfei s)arrax p;u1teeomfetydfs el(ms;u0 lxrir tydfp rlneols0t2xo(rpiydope mfeta( arur(  ;t4apxnif3ilslm umuvs t)trerxf ty1fa  luvo;s t2tr(mpoo1ap n nvtas sDra( ono4tpxomietadfs2uln o;(4 etnxo to1omt  u i;t)trtmxm ou4lp nliei t sDuaurpno4aetnii3iadfs2ranmp () lenmf ty1op rlueols trto(o oy4lleelfvs t)a2ra( p;t1oet  fciadfmDul(mp;() rxnmoctydfaDelivs s)sexm(m oudlpeemfvt (f Drmx ooo4tltn feiltfsDranmo u4altriocio1oateaieo;s0srumim oydlptemfviatf 2umu pno1tlxnmf3ilsls ulnmsnt4tetrmo todoaDe u sl(0 2xmir no4al n net tf Drrx pnu4oexn iciysfaDuan o u) rtoxfcty1fp rai o;t srxrim oy4llt lnes (faDum(mpoo4tltnmfetldlmDel(mo;u4aeeomrcoo1fmt ai ol(0texmxm3oudlm n fct t)sDtaxr nu0tptoio3tasla2eau pnu)trtnif3oa1lmt aueo (  etm(r3nu4alt  nes t)a2rrum nu0tpxo iciadfm2emnvs;t4 ltrmf3iodlp rli o t0t2tr(m3io1opt lfeslt aDuaxm ;o1tlt iietyt mDeanmpnt)aexoifctodfp e u o t srxoxo nu1lptemfei tfs2tmumpoo4teen i3tltlaDea( o (0artrxfctadomD aues;s0texm(rpny4op  livs sf 2ua( oot4apxoioeiytlmDeluvs u)tlxrxocootomDeaneils  2trxrpnydal emfvslsf Durum ;o0tpxomoetld aDuauvs;u4 ltrirciadoaDe ueo;t0srumxm oo1omenmfetltfa2ur( poo1aleo octys aDua(vsn(4alerxr oodfm eaivslt teur(o iy1lpt lfeslt)a2ra( o;t0apeomfciadlaDuln p;u0tltrir3oydoa r i i;t sexoimpiodlpt lnci s  Dua(monu1tlxoiiciltfaDelnmpnu0 etomo3tydfp r uvo t)t2uoiopnu4optnlivils a2rrumont1aeen ictat m2emuvs;t4 etnmrcoatlmt  n s;()s2to(m iu4lpeemfeia()a2uaump;o1texomo3tytlmDuluvont0treoif3oydfm eai i;(0setrio3no1lpe  icsa( sDuax onu1opeomoeiysfs2ran s;t)arenif3iytomDeluvi;(0s2xoxr nodllt miesls)a2rr(mooo1apeomoctytfmDrlnvo;(4tlerircootfptelnvi t) etr(o iodllenmfcsa( srtaxm no0aeen icils m rluvo;u4aeermfciydfm eluvo s0teumxm3iydol   fcs ()srurxrpot4tet ioetytfs2uluvsn(4 exoxf tydfmt ai i t teum(r nu1oltn nct ( srua( ont1olto f3tydfs um(vsnt0teerxr tytla eaueols s2xoim3nu1lmte nci tfsrraur nt4aexomi3ildfaDranms;u) eermocoydfmtran s t0 2xrim iy4am nlnci () rrm(mpou0oleo ietld sDranvp;()alxnif iotomDrln o;t0t2ur(r nudamtnlicsl( a2rmxrpno0aptn iciadlsDem(mo t) rerxr tatfmt aieo ()teumir3nu4am n nvtas  Dtaxmo;t1tet ii3iydfa2elu o (0 lxrmr iy1fateli sls)trxm(o nu1lmt  fctat) Drau pot4aptn f3iytls2em(vp u)arenxr ootoptrau i;( s2tr(opiy4olt livs ( srrrumpou0apenmfctyslsDelu s (0tetnmo3to1oatrauvs t) exoir3ou1omt  nvs (  rurur ot1ope  oetasfa um(vs (4 rtrxo iotomte ieolt) 2xr(r3io4ope mneilt sDua(rpnt0tltn feiatls umu p () rtrmo tatlaDe neil( t2toiopoy1olen fet s)sDta(m oo4oee mfeiad s uaumo (4aetoxo ia1oateauvilt0 2tmxm3ny4opeemnes tfa2trxmono1olxnmo3iadla ra(vo;u) rxomr oodla r n ils) 2xm(m oy1olenmivs ( srua(m ou4olt if3ilsla ulums;t)trxoxo iadlm elies;t  eto(mpoo1ap e ncs s)arra(mp;u1tpeo feiatlaDrluvp;() rtnxo3tytfmD lnesl(0t2xmxrpno4al emneta() rum( o;u1oex mo3tlt m rluvp;t4texrmo3tytlaDrau ils s2umio oy1amt  fvs tf rrrxro;o0oee mi3iltfsDum(vsn(0tltoif3iadopD  uvs t srurxm oudop  lfcilt arumx o;t1apx  feilt a2ulnvp u)arenmfcty1omtrauvi s0 2umim3iudap nmnes s) Drrxm nt1tetoii3ilt m2uluvon(0 ltnircoodfmtelivi;t)srur(r3oy1amtnlnei tfsDrrxmoou0olxn oeiat mDea(vo t0tltnmr oadla  lnei;s0t2xr(mpoo1lmenmfes s  rraurpno0oee mf3tytlaDuluvp;u) rxnxo oydfmt livils)trtrio3oo1amtnlfesasf 2umu ono0olx ifciys m2em( snu4tetnmf oatfmteauvs s0 2uo(o oy1aleemfes s aDra(ro;t0opt ioctlsfmDua( onu)aetnif3iodfpteaivo;s  rtrir oy4am  mnviat  rtrurpoo1oetoioeiltfmDemumo t0 lxoxr3todlaDeli il(0t2trio3oy1aptnlfviatfa2uaxmp;o1texnmoeiadls ulums;t)artnir to1fm eliei;s setrir oy1ol   iesat sDuauro;u1tlx mietldls elump;t4tltnxf3tadla  ln i;t)texm(m3iu4olt lfvt t  Durumpoo1tpx iietldlmDemnvp u4aexnxr tatfaD li s t) eto(m3iodolee ivs s) 2rmum ;o1open f3tyd s2ul(vpn(4alxrmr to1lpDranei;s0teumirpiy1ll   fei () rum( onu4tpenmieiat a rlumo;u0arxoxo tydlm eluvol( s2urxr3oy4lm emiesa(f Dtrxmoou4tpxo oeiyd m2uauvonu4 eeomf3tatlpDeln s;()trurxr iu4lptelncil( sDta(mo;u1oeen oeiadfm ra(vont)texnmr iatlp   nvo;t teuo(rpou1lpen iet ()s2rm(m nt0optnmoctysla ua( o u4trtnxf ia1faDeau s;t srxoxopiu4al   nct t  Dtmxm ou0aex mo3iasls2rlnvs;u4texrxf3oytopDeanvi;s)srtr(m3ny4om  lfcilsf Dtmx  no0tlenmiciltls rauvs;t)aleoir3oo1fmt  nvs;( tetrio iudap   ncsatf 2uru o;u0oex moctyd sDrm(mp;u0 lenmo3oodopt livils0seumim3iu4lpenliciatfarrmum nu1tltnmietydfa el(vonu0arxnxrctatfptelnes;s0teurxr ny1lmtemivsls aDtax  nu1olxn fciatfs uauvo u4tetomrcoydfptr uvils) ruoimpno1om nmicsltfaDtrxrono1texnifeiat sDra( s;u0 rxrirciy1omD lueils) ruo(opoodolee nesltfartrxrp;t0apx iieiyd a2ul( o;(4tlerxr3tadfmtraieo s t2tm(o3ny4lle livsltf 2rmxm ;o4aex mieiatfa ua(mo (0areoxrctytfa rai o;() 2trxmpnydopt  ncsls  rur(m ou1aleniieiatfm el(vo;u0 lenxo3iatfa eaueslt)s2ur(r3no1lmeelnes (  Dra( ont1aeen oetlsfa2elump (0trxrxr iotoa  ln i;() eurxr3io1al nlfet s)a2rau p;o1oet mietaslsDel(vp;u0tlenxr oodfate nvi ()teurxopiu4omt lieta()aDuau  nu0ole  f3iysfmDra(vp u) ltnxo3ootlp  livs s texrxmpny4lleemfvt ()srrrxr no1alt ioeilslm umuvo t4tlxoio iotoa e u o t s2xrxr3io1amee fcsl(fa2urx o;u1aexo i3tlt m ul(vp;u0 lenxo3io1laD auei (0 euoxopiu4lltnmicsatfsDrr(r ot4aexomfetatlm2rm(mp t4teerif to1la   ieo ( s2to(mpny1omen icsas)s2rax oot0oet ifeildfa2elums;(0trxnxo3oadfmtrli s t)t2trir3iy1ap emfetl() rrm( p;o4apx  fetat a2uan pnt4texrirciatlmtr ueo;s0 eurir nu1olt lncsatf 2tru pnu1oexo fctlt m eluvsn(4 rxoxr3oytfmD  ieils  etoir iu1apeemfcs sfaDrmx poo4teeo feildfa2uln snu0 etrifcoadomDeau i;s) exr(mpny4ope livtasfsruaxr ;u4optomi3tad m uauvo ()aeerxo3iatlp elnes t)srxoxopoudaltn neslt a2tau oot0tleomf3iys mDraump;t4altoircio1opt auvi;s0s2toim oy1lmte iei ()aDuax oou4aexomfciltlaDem(monu0 ltrxo3oa1omtelu i () rum(opiudap  lfesas srrmu onu0aexomi3iyd sDraums t4alxrmo totfmteli s s0srxrir3io4optelncsl(f Dta( onu1aet if3iad aDranvon() rtnxo3todfp rai i;t  exm(opiodal nlfcs s)artmu  ;t4ope  i3iasfa2emn p t)tlenxo iatfp   ues;s) 2uoxr3oo4optnmfvtatfs2rmxr nt1tpeoioetyd s2rauvs;()trtoio3ia1omDe nvo;( trtoio oy1opeeliviasfaDtmu pnt1tet ioeiyslsDrmn o;() exrxfciotoa eli i s0s2uoxopio1altnmnvsl(f rua(m ot0optnmiciasfs2uln o;(4 etnmfciotfatr nvol() etr(mpoo4ole mivt ()a2rmum ;o1apeo feiydfa2ean s;t0 reomfcoy1laDeaies t)setrxo3no4omtemnetatf Dtmu p;t0oexomfeildlm em(vo u0tleomo3ta1fpD luvsls seto(r3nu1lpte ici () rraum ou1tetnif3ilt aDua( p;t) rxrio iydfa ranes ( texmirpnu1op emietatfs2rrxm oo0olen ictld s uluvp t0 rxnxf3iy1fa rau olt) rum(o iydomenmivslt)sDtmuroot4oet mfctadlm uaump t)tlxnif3oodlpte n o;()srxmxrpiu1ll e nvtasfsDtm(m ou1tleoiictldfm2eln p;t4alxnif3iodop   uvilt srtr(m3oudaltnmfcs (fartmx ono1optniieias aDeanmo;t) exrmf oytfm eanvi;s)srtmxrpiudlmeemfcs sfsruaur ot1tee mfcilsla2eln p;(0arermo iotla elnvo ()seurxopiudlpt  ieilt aDrmxmp;u4tle ioetatla2uau p u4arxrircoy1lmte n olt setoxm no1alenmfcslt)srtaurpnu0tptn f3iysfsDrlnvp;(4aeenxr oo1fmteln sls0setoxr ou4oleemnesls aDrmur nu0tptnmfeiysfa2uln p () eenir3ty1faDrai o;(0trtmio3iudopee nvsl( aDtauroou0tlenmo3iasfa2em(vo u0artomocoatfmt anvo;s)trxrio nu4ap nlieslt) 2uaum oo1aptomfciltlm2ul(mo (0teeoio3iotfm r nes;s0tetmxm nudlptelnvias aDtmur ;u4altn fetat mDea(vs;()artoxo3tadoa   u i;( trxoxm3oodll e ncils  Drmxr nu0tpxnmfctasla2em( pn(4 rtrifcta1fatrau ils0trumxmpny1al e ict ( aDuaum no0aet  fcildls ra( s (4aetrmr totlp rai slt)tetoxo oudamtelfvi sfarururont0oeeoiicilsfa2eanms u0trtoif tadlm e uvol(  etoio3oodope mfvt s)artr(r oo0tpe if3tldfmDumn pnu)alxrio3iydomD lnvo t0 eumxmpoydolte feia( sDumxmo;t0aleoiictasfs2ra(vs;t4 etoircoa1opD ln s t)trtoio3iudlm emfvsa(  2rrur no1aetoiiciadfa2rlnmp;u) lxnxo iydlpDraneol(0s2toimpiy1ape mfesas sDtaxmpno1altn f3iltfs2rmumpnu4 lxomrctatfaDr i i s seur(mpio4al  lnctl(f 2rmxr ;t0aleoii3iltlsDeauvs;u)tetnif3ta1om   u slt0srxoxmpoydomee nvilsf rra(m ;u4oee  fctyt m ulnvo u0aexrmfcoa1lmD lnes (0srtmxo3ou4op n ieias sDrrxronu1altoio3tlsfsDul( sn()arxnxr tydfmt lues t0tetoxo ny1ome lfvia(farumumpnt0teto oeiydlaDulnmsn(4altrxr tadfaDr u o;t0 rxmxr nu1lme mncta()a2uau oot4tpx mfctysfa2elu s;t4aexrmo3oy1fm e uvi;t) ruoio oo4altelfvi t  Dua(m ;u1tlxo fciytla rl( pnu4aeeniocoodopD  nvilt s2umxo no1ameelietl( aDraxmooo4olxo ictlsla ul(vp t) renxr oatop   u ol(0trxo(o3oo4ol e neias)aDuauroou1oltomfeiadfs uan o (0 exrmr oa1lmDrlivi;t  etmxm nu4apeelivs s) Dumxro;u4tpxnmietas s2uauvo () eenxf3ia1fmteli o (  2xrim3iodlp  lnvtlt a2urumono4tlto oeilslaDul(vsnu)aeerifciodlpD lnvil(  2xoir3iudlpenlfvsls  2ra(  nt4aee mo3iydlsDelu p;() rtoir3iatomtrlivi s0 ruoxopno4ll emicsas a2tmumpot1aptoioeildlm2uanms;(0aexomfcoa1oa  anvsl(  rxmxrpno1apenmiciasfs2trurp;t4alen ocildfs2uaumont)aetoioctodopDrlnei s sexmxrpnu1ope lici t  rur( ont4alxoiocild aDulu pnt4arxnif iy1om   ieo;t  etm(o3nudamee fes sfa2taxr nt0aexo octltlmDrlnms;u4alxoxo to1faD  u s;t)srtrxmpnodll nmfct t  rrrur ou4opxn oeiysfa2emump (0teeomo tatla elnvi t0 euo(opnydlpeelfviat) ruau pnt4ole ioeiasls raums t4tlerifciy1fmtelieils)srxm(r ny4oltnlnct tf ruau ooo0aeeniieiyd m uan pnu4aetrxfcoydfptr n i s0 exoim nodal e feslt arrrxronu4alx mfciytla rmu o u0 lxrmo3oatfmtraueo t teuoimpoo1alt mfctl(fsrtmu p;u1aetnmoeilslm2emnmon(0 rtnxrcta1lptelnei;t) 2ur(opoo1omen fet (fsDrrumoou0altnmoeiydfa2emnvs;t) lenif3oodlaDrai o s)sexm(rpnudamtemieia(farumxmonu0oeeniociytlm2em(mont0aleoirciodoptean i;s tetr(m iodap elici tfa2rm( oou1olxomi3iyslaDean pn(0aeeoio tadop rlies;s0srtmio nu1lm  mfvsas) 2tmxm ou0alt  i3ilslm umumpnt0tlermr3ootlaD  ivo t0t2xmxr3oudll   ieiasfsDrrum no0optomo3tyd a2uan p;t0arxoxo iytlpt au s;()srxr(rpnu4al   fesa()arraurono1apeo ietltfa rlumonu0 lxnio iy1fmtelu slt)srxr(r iy4lpt lnetasfs2ua(mp;o1texniocils m2ra(ms;u0teeoir3totfa raivol()tetm(r iu4amte ies s)a2taum ou1aexo i3iadfaDumnvpnt4tltnio3tatfpDeai o;(0 etmir no4lmte ncil()sDrax  ;u4tpto o3tyt s um(vs t4 lxomoctadfa  aivsl(0 2to(mpiu1optelnei s arraxront1apto o3tytls2emuvo;(4arxnir ootlatelnvs;(0srumim3oodalt lncslt  2rau ont4aleomi3iat s ul( o (0artnxf3iy1oaDrlnvsls0trur(m iy4lpt livsa(f Dum( pnt1opxoiietyt s2rauvpn()aexrir oy1lmtelnvi s)s2xr(o nu4ole mncsa(f 2urxr no1tlxn ociadfs ulnmsn(0 ltoxr iodfaDe ivols srtrxrpou4ameelivtl()sDum(rpno4aet mfciasfmDuaums u0 etnmr oo1optr i olt t2umim nu1al  lfeil()a2rrxr ;o1altoiiciydls2emu s;(4altrif todlp elneo t)teurim3nu4op elfeia() Dta(ront1tee mi3iytlm2el( s u4texoxf oytfatr uvo;( trxoxr3oodal e nvtlt  2urx  ;u1tpxnmieildls2umn p;t4 rtnxf3iadlmDr n o;t)s2xr(opnudom n nvt s  2taumont4tltoifciadlmDel(vs t) eeoir iy1fm   ueo;t s2toirpiu1lmtemfcils)aDtaurp;o0aleoif3iadls2rm(ms u0 lxrxrctadfp  aivs t0 rtmir3no4lpen net s)aDrr(  ;o4tpxnmi3ias sDuaumpn(0 rxoifciotlate n o;t0teto(opnu4ap e fci ( a2tmx o;o1tle ii3tyt s2ua(mpn(4aexoio iotfaDrluvs s0trumim3no1om e ieias)aDta(ro;o4alt mi3ilt aDem(vpn(0teenxo iadlm eauvo ( teurxopnu4omte neiltfs2ua(m nu4opt if3tld s ul(mp;u0trtnir oa1opt liei t0 2xrxo oy4ol elies ()aDur(r ot0openif3tls m rl( s u4teeoir3oa1fa  luvs s)t2xr(mpiy4amenmnesa()a2rr(rpno4alt io3iyslm2eln s (4aleomo3oo1fpteanvi;(  2xm(m3iudlleemnctat  Dtmur ou0oltnii3tyt m ea(vsn() rxrir oy1fpt anvs ( texrxr3nu1ale mici ()artmumoou1aetomf3tydfaDeanvp;u4alerxo3ta1oat ai ilt srxr(m3ou4optemictltfaDta(ronu4olto iciadfm2ua( s;t) lxrif3ootfatr uvs t0 exr(o oo1ap eliesa()s2tr(rpnt4tpeoif3iyt s2rl( s u0 rxrxo todfaDrlueo;t)srxm(m3oo1olt lnvtltfa2umxront1opt  iciydlmDelu s (0trtnifcoo1fpte ues ( setr(rpiodlptelici t a2tau  ;o0ale  f3iadlsDrlump t) ltrmo ta1laDeaneo t) rxmim3nodap elivi sfsruaumpot0apenioctasfa um(vpn()arermocto1fpteanvslt) rtoxm iy4ol   iet tf 2trx  nt4apeoifeiadfs uln pnt0trtrmr3todlpDraiei;t0t2xm(r ny1lltemici sf Dtrxro;o4ape ioetldfaDemu snt4 ltnxrcootfp r nvol(  rtrxmpoydol  lfviltf Dur( poo0apenmo3iadfs eaums t)arenxo to1fpDran i;s0t2umxm nodopen fvias s2um( pnu0apto ietyslm uanmp u4areoxfcoytoptelu i t0s2xoxmpoo1oleelfcsa()sDtax o;o4tpe io3tadfsDeluvonu4 rtniocoy1oaDrluvslt s2trxmpny1llt licia(  2urumoou0optnmo3tat sDuaump u) lxrxrctadoaDrai i t)trxmxr3nu1lm elfeia( aDrr( ono0tpt mociltfs ul(ms;() ltoxf3iodfa eli o;t srtr(rpiy1opte icsat)s2taxr nt0tptnmoeilt a ra(vo;t0tleomfciytfptraues s)setrxopiy4lptnmnvslsfsrrrxmp;u1apxnii3tlsfm rln pnt)aetnifciy1lm  anes (0seumirpoy1alee nciat) 2rmumpoo1optomi3iasfaDelu on()trxoxr3to1om raivs (0t2tm(r3nu4al emneia(faDtmum nt1oexnio3iydlm rl(vpnt4 rxnxrctotfa eanvol() exoxr3no4omenmivs tf Dtm(m nt1texn feilt aDrmu o t)aexrxrctydfm   ueo t)t2xm(m ny1ale  ivtls srur(mpoo1tpt mictyslaDrln o t4 ltrxr3todomteau sl() rtmir iu4alen ieil() ruaum nu4alx mfciadfsDum(msnu)tltoio ta1faD  uvilt0sexoio oy1lpte nvtls arurxmont0oleniiciyslm2eanvo;u0trxnmo todlp r i o (0s2tmio iu1ap n ictl(farraurooo4alxnifcild s2emnvo u4teeoircia1fpteanei () exmxmpoydlle miei t sDrrx pnu4oltomoetatfs ran s;u0 ltomr3tatfp  au o;s)trxm(o nydame  nvtas srtr(r ot4opeo o3iytfa el(vp u4artrifciodfpDe i i;()s2tmim io1openmfvia() Durum nt1aptn oeiltfa2emnms t4altrxo3oodlm eanvsl()t2tmiopiy4apt livtlt) Drm(mo;o0apxnmiciysls ulu p;(0 eeoif3tydom   ies t s2toxr3iydope mfci ()artau oot4aeeomiciytls2ulnvsnu0trenxo io1fm rlivsls sexr(m3iudlmee ivs tfa2urx  oo0oexn i3ildlsDeaump;() lxomrciadomDelu ols0texm(o no1optn fei tf rta(moou4opt iieias m ran o () lxrxo io1op eluvi s0t2xmxr ou4al  lnct ( sDrr(  oo0tlxniociytlmDuau p u)altrxfcty1fate ieo t0 rxo(r3nu4opt mfctat aDtmu  ;o0ole mociaslm2eauvp t0trerxo oydoatrlueo s)t2tr(o3iy4omtelnvt (fsDtmxmoou0oexnmoctlt m2um(vo;u0 lxnxr iadoa eluvs;t  rxoxopio1am e netlsfsDtmurpou4texo feiadfs ul(vsnt)arenmfcio1om r nes;t)trtmimpnydllt mnctat a2trx oot1tee ifeiyd m rlumsnu0 rxnxrcoodoaDe i i;(  rurirpoydapen nvi t a2rrurpou0aex  feiltfs raumpnt4tlxoxfciydopDr uvols)sexrir3nu1ome  fvilsfaDtmxmo;t4tlt ii3ild a ranmo t4tltoxr3oodlmt  u s t0trxoxm3iy4lmtelfvt t  rtaxrp;o1aptn icilsls emums (0teeomf3ty1fpt aueo (0seuo(opiu4olenliet t)a2raxmpoo1oeen i3iasfa rlnmp u0tetoif3ty1lpt lies t0 etm(m nu1al nmnesl()a2rr(ro;t4tpeo feiys m2ua(vp u0trermr to1lpD  nei;(0sexrxr3ny4optn ieslt) 2rrxrp;o0tlen fciytfm2ulnmpnu0tlerif io1fpDeai olt0srur(o3ou1am n nctls sDrrxmooo0oeeoifeiyd aDelu p;t4trtnmo3oo1lm   ivo t)teur(opnudop   netat  rrr(  no4tpxoiictas mDumnvsn()tetrir3to1fm r n i;t) exo(o3iodap  livsat  Drau  ot1opx  i3iad sDra(vp t4tetnmf oy1faD aivslt srxmim3oo4lmtelicta(f Dum( pnu0olxoiieiysfsDulnms;u0tltnmo to1omte nes;t  2tr(m io1openmivtlt sDtm(root0opx  ietatfm ea(ms u0 rtomrcto1opDrluei s srtmir ou4ape lnciat) 2tax  ;o1tlxn fctlsfm2rl( pnt4arermfcty1fp  aues (  exr(r nu4al  mfct sf rtr(rp;o4aptn ieildls eauvpnu4arerio3io1fa   ivo t s2xoir oo4apt  icia()sDraxmpou0tlt iociat s2eln ont4tetomo3iytfmteau s ()sexrxm3oy4lm e nviat) 2umxmp;o4oexomfeild a rl( o u) reoir iytlpD  uvil()t2toxm nu1lpteliciat)s2umur oo1aptnmi3tytfm ra(ms (0 lermociydlaD an o (0 etrirpoo1apenmnvt () Dtru pno0aexoio3ils s2eau p;(0 eeoxr3oodfmt luvi;s)srtoiopou1lpenmics sf 2uaxm ot4tet  ociatlaDrmnvp;t4tltoio3tydfa e i ols)srxm(mpiudolt lnvt t) rtmx onu1tex miciadfm2ea(ms;u0teerxfcoy1latelieo ()sexmxm nu1lle lnci sf 2tm(mo;o1aptomo3iatfa2rm(vpnu4 ltrioctatlmt  ivo;s)seto(opnu1optelnes s a2tmxmp;u1tpxnmietlt aDrauvs;u0 rerxo3iydlatr iesl(0srxrimpou4lmt mict sfsrtmxmo;u1tlxnifctat s2rlnvs;u4aetnif oydfmt  u i;() 2uo(rpnu1alee feslsfs2uau o;o1tpxoiictatlsDumnvp;(0aeeomrcoy1fat lies s0 euo(opny4altemfesasfarrau p;o1tpeo icias sDranmp u4 eenif3tadlpDe ivils)t2tr(r oudlm nmneilt  rrrumont1aetnmictas s uanmp;()alenxrciotomDelneol(0 eumxmpny4apen feil()a2ururp;t0opx ii3iaslm el( o u)tltrif3tytfptr nvo s  2trim oo1ll   ncils s2trxmooo0alenii3iltfsDrauvs;t)altoxr3oadfm  aiei;s s2xoir iy1lmt  ivil( aDuaxm ;t4opx iicias a2uanvs;u) exnmr3oadlatraiesl( srtr(o iydomenlics (faDrmxrpou0tlenif3tatlsDuln sn()arxnio3ta1latrluvols teumxrpou4lltn iesasf Drrxr oo4oltn f3iatfs2rlnmpnu)artoxo tytlmtraivo t0t2xr(o no1lmtn nctatf Dumump;o0oltnmfeilt a2rmn o;t0tleoxfcoytlpD  ivi;s  rxm(opou4ameemicil(faDum(m ot4tee mo3iatfm2em( pnt0aeeomo3oa1lmte u s () 2uoxm3iydomtemfci t)aDrrxrpot4opxoio3ias m eanvo;t4 leoxfcoadlmD aivo t0s2umxm ou4aptnlfvslsf ruaxmono4apeoiiciys aDranmp;t)arenmo todfm rauvs;t seuo(m3ou1olen ncia(fs2umumpnu4alto f3ilt a emnvpnu)trtnifcoa1lmtrlieo s)seuoxo3iu4ape lictat)srtr(m oo4aleomociyd a2eaumo u0areoxr3tadla   nvi;(  2xoxr3oy4oleemivi sf 2rmxr ;o1tpen ieiasfs2ua(vp u0trxnmf ia1lp rlueo;t)t2tm(o oodolenmietat)sDta(r no0alxn ieiat aDulump;u0tltnxo ootfaDraivo t) rtoirpnudol   ictas)aDrrurpou1tlxoii3tld s2ul( s;u0aeenxfciydlm  liei;(0 rurio oodam emies () Dtrurpou4openmoeiydlm ranvonu)trenircoa1fmD livs (0 exrir3iy1ap nmivil(f Draumo;u0aex mo3tad s2rluvs;u)tltnxo3to1lmt  nei t)trto(r3no1ap e ivslt  Dtmu ont1oex mieiyd a eanmpnu4 rermo3iydla e uei;t  rxr(rpoy4amt  fvs s)a2rm(m ou0alt ifciydfs2eluvs;u)tetrmr3oadoaD lneo;s t2urio iy1lptn fcsat) Dua(monu1alen i3ild mDrmumo t)aetrmf3tatlaDraivo s) 2xrirpoodomt  fetas)aDrm(  nu0olx io3ils aDrmuvsnt0 exrxr3oodfmte ivolt)teuoxr3iu4opee icsltf 2trxmono4aeeoif3iltlm2ul(mp;t) reomr tydlp ranesls0srxmim ou4ome  fetlsfa2rau  ;o1tetn ociysfsDrl( snu4aetrxr3iytfmDeaies;t)truoir iydapenmfvs t srum( ooo1tpeoif3ilsls2uan pnt4aeenifctytfmtr i o;t teuoxr no4ap elncia()aDrrurpnt0alen ieildlm2raumsnt) exrmr3tytfmDeli ol()srxo(mpiy4lmte nciat  Dtm(m nt4tlt  f3iltfm2ulums (4 rxrxr3oodlaD  n s;t0trurio3ny4alt mnct tf 2ur(mpou0opt mf3tls a2rmumsnu0 etrmfcoatfmDelieils trxoxmpno1olt mnesasf Dua(r ;o0aleo oetls s2rl(mp;u0 ltnxr3iadlaDeaivolt srtm(mpny4openlictlt  2um( o;o0oexn fetlsfs ua(vsnu4alenirctytfa eaies;t srtoir ou1ap nliesasf 2ta(mpnt4tpt mo3tldls2uanmont)arxrxrctotfa   u slt0s2uoimpiy1ame licias)arrr(rooo0olx ii3taslm ra(mo;u4 lxnmr iydop elnvols)sexo(rpoy4llenlictl(f Drmuront0opx moetldla2rmumsn(4tltrxo3oatoateanvi;(0srxoxrpoydlm nlfcsltfarumx pou4oexnio3ilsfa2eauvp;(4 reoxfciadfpD lnvil(0tetm(opny1ol emfeta()aDurxm ;o4alxnif3tad m ranmo u0 etrmf oatomDe uvo;t0s2xmxo iudlptnmicsasfsDururoot0oet mociltfa2emnmo;(0aexoif3ta1omD lues;t texrxr iu1omt mfetasfsDta(r ;o1oleoioetlsla2ua( snu0aeermoctotla  aues s0s2xr(opou4lp n ivi ()aDrmxmp;u1alx iiciytfaDrmu snt4treoif3iotlpDr ieslt)trtoio oy1opt mieils) Dtaxmono1oex miciysfsDumuvsnu4tlerxo oo1lmteanes t0s2xrio3iydomtn fvt (f rrax o;o1aexnmfciys m uauvo t)arxnirctydfaDran o () 2tmxr3iydap  mnvtat sDumum nt4opto oeiys aDrln on(4tltoxrciodomD aieslt0teumxo3nudlmt lneilsf rrrur ot0oexoiieild s2ra( s t0trxoxf oy1omDelies ( t2tm(mpoy1ame mfvsl( aDtr(rp;t0aetnifetlsls rm(ms t0arxrmo to1la rau olt)srurxrpnu1ope  nes s)s2rmxr ;u4tlenmi3tysfs eanvo;(4aeermocoodoa  livs;( sexm(mpoy4amtnmnei t sDum(moot0olxoifctat s ua(vo;t4 rxrif iytfa   uvil() rxmxrpiu1amenmictlt) 2tmu ont1alt mf3iytfm ra(vs u0 etnxf3todopDeanes ()truoiopiudll  lfvt t srur(mpnu4oet mictysls2rm( o t)trtrmo oodlpDelueo;(0s2um(mpnu1amtnmnet s)s2tr(  nu1opxoii3tls s rl(mp (0areoif3todoaD lneo;t0trumxo3io4ll e fes ( a2rax oot4aexnmi3iltlmDeln onu0texrxf3ia1faDr u sls0teurxo3oo1apeemnciatf rrm( pnu0tpeoifeiyt a2rm(mp;u0texnxo ia1lmD aues;t0sexr(opou4llt  nesat sDrmxmpou1optnioetlsfsDra(vo u)trenmf iadlm  an sl( sruoir3nudlleelnesasf Duaumoot4olt  f3ildlsDrl( p;() exnmf3oydfmtrai o t) 2tr(m3oydlm e fvs ( aDrmxrp;o1olt  fetysfaDumn ont) rermrciytoat liei t0 2uoxopoo1ole mfcs tf rum(mont0aex mietydfa2rmu o t4 lenir oytop ranvo;t)trxrxmpnu1amtemnvsas) 2taxrpoo1apxn i3tydfa2ea( pn(0altoiocio1opDeanvi;t) euriopiodlleemivt s)aDrmumpnt1apt if3ildlm rmnmsn()tltoxr todlp  livo;(0trum(m3ny1olen feilsfs2tmump;o0tpeoiicilt m uluvonu0alxnif iotomte nvilt)sruoxo ou4apee ivi s)s2ta(mo;u4tlx ioetlt a2uauvo;t)tleniociodomteauvol(0trto(o nu1ol e nvia(  2rmx ont0tpxn fctld a elumonu4 etoifcoatoa elneolt tetrio3nudaltn fcsat s2ua(mo;t1opeomfeiatla ran p;(0 rtoxfcoydomDrai sl(0trtr(o3oodol   ivsls)aDum(rono1tlt ifeiltfsDuan p (4 eermrciytom e uvi;()srurim3oy1lpenmfct s)sDtmum ot0teeoifciytfaDuauvs;u4artnir ootopDe neo;(  2ur(r ou4apeelnvtls) Drrxmp;t0opxoii3iasla eauvs u4trxnmo iotfaD lnesl(0teto(m3nodaleelfvtat sDtmur ou0teenmi3iydlaDrln p (4 etomf ia1opDeaieslt setoimpny4llt  netlsfsDurxrono0oeenmoeiytfs raump u4 renxr to1fmD  ueolt)s2tm(m3ny1apte iet sf Dta( p;t1aetn i3ilsfmDrlnmo (4artrmo ta1fp  livilt) etr(o3iudap  mnesa(fs2rmurp;t4oex moetldfsDrlumsn(4 rxrircoy1oa  anes;s)seurim io1ap n ies s)s2umu  nt0ole io3ild s eanvsnt0texoxrciydoat  neo s sexoxr3ou4ape  ncsa( srururo;u1ole ifciat aDem(mo t0 etrifctotom rai ils0 rxm(o oy1amtnlfvtas)a2umump;o1texnmoetydfa rm(vo;()trtnxf oa1lpDranvils0t2trio iy4ap n feslt)s2rmurpno4aee  fetys sDelums;(4tetriocta1lpD  uvi (0setmimpiydop nmnvslt s2tm(r ;t4aptniociytla uluvp;()tltrxf3tadoaD  nvolt) etmxm ny4lmtemicsas  Dtmx p;t0tleomf3ild sDranms;u4tlenir3ootoa eai o s) rtoimpio4lm  lnvsas)a2uaxm nu4tlxnio3iat sDrmumpnu4tlerxocio1la  ln s t srurim3oy4ape mfcilt a2uau p;o4oexnifctlsfs ua(vs;u0 exoxo3io1lmD  nvi;()s2xmim nu4ll   nvil()aruru p;t1tee mo3tat s2umnmp (0teerxrctotom ran s;s0tetoxmpnu1llt mfvil()a2trxrp;u4oexnmociadfs2el(mo;u)trxoif3oytop e ueo;s)seurxo3oodlmenmieils)srrmx o;u4tlt mo3iysfa ulu s u) lenxr oatop raieo;s0t2umirpnudam   icilt  rtrxr no4tlx  o3ild sDrau s;(0 rxoiociytoptrai s s0 etoirpio4amt mncta( sDurumpot0oeen i3tys s2ulu s t0tetniocia1fa eanvi;( texm(m oo1ap  lncs s aDumur ;t1tetnio3ias s2rl(vo (0altoif3to1fatr uvi;s t2uoxm io4omtn fvs ()aDrmuroou1tltn o3iysfa ranvo;t4 eermo oa1fpteln ils0 2toxo3iy4amt  ivia(fs2tru  ;t1tpxo f3iasfaDranvpnt4texrxr3totlaDelu i ( s2ur(rpiu1alee ieiltf 2rau onu4oltnmfetys s2ea( o t0teerircty1om  lnvslt  rumir3oy1lp  lncsasf rum(rpnt4apeoifeiad s2uaums;(0tlxrir3iy1omt  u s;s)srtrxm3nodapt mies s) 2urxr ;t0olxnii3tlsls2emnvs;u4 rtrif3oy1lp  auvo;s trtoxo3ny1ape miviat) Drmuroou1tptniictldfmDrl(vp;u)teeriociy1lp r i i t)s2tmxr3nu4llenmivils arra(mont1apt  i3tytfsDrmuvs;u0 rtrxf3iydop  anvs t) rxrxm io1ape mfvia(farrrxmp;o4aetn o3iasfa2uanvs;t0altoio3iy1omDrli sl(0seurio3oodomtelictlt)a2taxrpnu1tpt  fetls m ra(von() lxnxfciadlpteli sls setmxrpiu4om nlicilt)sDraxm ;o0ape  ietlslaDuaump u4 renircia1fm eluvs s0t2toxm oo1olee ivslsfsrtr( pno0oeen i3tlt a2rau s () lenxrctydoptraiei;(0 rur(opiu4am nmneilt a2ra(ro;t0ole  ictysla2rmumo () reoiocoo1la eluvols0 rtoxm3io1lm nmictas)sDur(r no0oeen oeiadla el(msn(4trxoxf3iy1laDe n o s  2xoxm3iu4lmtn ncilt  Dtmxrooo4oeeomi3iatfs2rlu p t) lxnxrcoa1opte neil()trxrirpio1ol e fcs s  2truro;u0oee  i3iasfsDrm(mon(4artomo3iadomDrln o;t texr(opnodamt mneiltfsDraxr ;u0opx if3iyt a emnvs;(4aetnmr3oadfmD  uei s0teumir3iy4ope  fvta( a2trumont0olxn ociys s2um( o (4alxrifcoydlat luvi;s0srxr(rpny4amtemicsa(faruaurpnu0alt iiciadfm ulnvon(0 exrir io1omt  i ils)s2trxrpiu1lpt livtl(faruru o;u0texomfctadfa ra(vs;(0 leoir tytomt auvs;t teurim iydllenlnes s  rrr(m ou4tltomfeiys sDranvont) rxoiocty1opDr uvil(  rumxm3iodoltnmneslsfsrtmu pou4tex mf3iasfaDea(vpnt0areomo3iy1oatelu s s)s2umim3ou1lmte nvilt  rrrx p;u1apxomi3iasfs rauvs;t) rxoxrctodfmDrlneo;( t2xo(m iu4lmenlnesa()sDra( pno0alx io3iltla2ra(vonu0aeermo3to1laDeanesl()t2to(rpno1lme mnvt s  rtr(m ou1tpt mi3ildla rlu p ()tlxomoctatfm  aivsls  rtrio3io4op elietas aDtr(mpou1oee moeilsfs2um(vo;() leoio oydfmDean i (0s2trirpoydop  mfetat sDtr(m ;u1olt mfeiysla ea(ms;(0areoirciytfptr nvs;(0t2xmio io1lmte feia() rumxrp;u1oleomoeiydfa2elnmp u4aetoxo3tytfaDe u s;(  euo(o ou4olt  nvtatfsrtax pot0tlxnif3ilslaDra(ms;u)tlerxf ta1lptrauvo t  2to(o3iu1lltemneiltf Dumurpnt0oleomfctytls2ua(mp;t4trxnxoctotlat lnes s setrxrpiodomt micsat)sDtau o;t4tltomo3tysfa ulnmsnu0 eermr3tytfpDeaivols)tetm(o3iy1lltnliviat s2trxr ou1tee mocildfaDulumont0 exoxoctadomtrai o;t s2urxo3oydoleelncsltf rumx onu1aetnmfctldfm elu snt) eenxf to1omt lnei;t s2trim3oydllt  fci t sDtmumo;t1tpxnioeiytfa ulu on(4artoifciadlaD auvolt) eumxopiy4apte iet t)s2ua(r ;t4tetnmiciydls2emnmp;t0 exomoctydlp e nvo t)teuoxm oodlpeeliesasfsrrau oou0apeo ietldlmDemn p t)alxnxf todlmD luvslt)t2umio ny1al elfvtlt)arurx poo4apt  ieiat m2ean s;(0 exrxo ootoptrlu o ( setmiopou1lpte fet (fs2um(mont1oeeo fetlt m elnms (0 exoxrctadlaDrlueo;t0texr(m3oy4omee ncsl( aDtmurp;o1ale mieiat mDua(vsn(4areoir3iodfmt anei t0srtrxm3iydlm  mncilt)aDrm( p;t4aeen ietlsls2el(vp ()tltoxf todla eaivsl()s2ur(r nu4omeelivtlt)srumxmono1tptnmo3iatfs ea( s;u4aetomo iodoa e nvs s0 rxmio3iodaptemfcilsfaDta(ro;u0aexomictyd sDelnms t0trenmf3oytlp  au ols) 2trim no4aptnlfesa(fs2tau o;t4alxoiociadla ea(ms;(0 lenmf tydla rln o s)srxmxo no1ale  iei s a2tauront4altnif3iat s2rmums t0 lxnxf oo1fpDe uei s) etmio3oo1op n fvi ( sDrrxmont4oetnif3ilslmDra(mont4arermrctytfp   nes;s setrio3ou1aptnlivs ( artrum nu0tetnioetytfa2emnms;(4 rtoxo totopDeanvo t  etm(o nodap elfctltfarta(moou1tlenmfeils m2uauvsnu0alenmf3oadop  lnes t t2uriopiydlmt licsas)arurxr oo0apxomf3iadls2umnvsnu0artoir ty1fpDrluvslt0srxoxo3iodop   ivsat) ruaumoot1aexn fetlslsDumn pnu0 renmf3oo1fate u o;(0sexrxmpiu1lp n nei s)artmx pnu0aexo oeiltlsDrlu p;u4 exnmr3iy1om  au o;s) 2tr(o ny4ap nmnciltf rrrx pnu4tet  ociltls2elumpnu4tlenxf3to1opt luvo;t  exmxopnu4ome  net s a2tr(rpou1tpxnifcild aDrlump ()texrmocio1op  livs (0 exoxm3oo4lpte fvia()a2rmum ;o0apeo ociltfm um(vsn()trxnif tydfaD  uei;t0seuoimpnu1oltnmivt s)a2urum nu0tptniociydfm uanmp u)aeerio3to1opD luvolt)t2tm(rpnydol   netls  Dtauroou0open fciltlm2emumont0 ltrircoadoa raies ( setoxrpoydap nmncsat)a2ur(rpot4optn f3ild aDuan pnu0aetnio oo1om  ln ol()s2xr(o3ny1lmt licsl(farra(mpnt0oexomieiytfm2ranvs;u0aleoxrctytfmte ivsl(  2xrxo oydamenmictatfsrtrxr nu1tltnifeiydls rlu o (0areomf oy1lmtraivi;s0srto(r3no4lp n nctat a2umx oot4olxomoctytls eaump ()arxomo oatoaDe nvo;(  rumxm oydom e nviltfa2rruro;o4altomoetyslsDuauvon(4texnxo3tydfat lieo s)texr(o no1ol  mivt s) rtr(m ot4tex  fctysfa2rluvsnt) ltoio3iy1fpDrlu o s)trxo(o3ny4lltnlnei t arumur ot4oltomf3tysfs2ranmpnu) etrxr3iotopDelneilt0seuoxrpoydoptnlivs s)sruaxr oo0ope mfeiad s umnms;u) etnmocta1om   i o s0 etoxo nu1lptn ieslt)s2rm(rp;o4alxo i3ilsfsDea(vo;u4 eeomo3iydoa e ieil(0 rto(opoy1al emnct (  Dtmu oot1tltoifciytfa2elnvo (0trtnmr ty1lmDrln il( t2xo(o iy4omeemneta(f 2tru oou1texoif3iydlsDuln o;()aexniocoodfa rauei s srxoir3ny1lmtemietasf 2rr(m no0tpx iicias m rl(ms;u)tlxnxociotfaD lues ( seto(rpoo4lm emnct (f Dumxro;u0tpenio3tydlsDran p u0tltnif3to1lp  au olt texoxo3io4aptnlivilsf Dra(m ;u0alx ifeiysfa2rmuvs t0 ltrmrcoydlaDranvi;t0tetmxmpoo1op e icsas  2rm( poo1oee mf3tld a el(vs;u4 exnmr oy1fpDr nvol( t2tmir iudamtnmnesa() 2umu oot1ope iietydla2ranmo;t0tetnxo todoaDr nes;( s2to(r iy1lpenmfcs ( aDrrxrpoo1texoifeiadlmDelu o u4trtrmfcto1fpt an s ()trxm(o3iy1aleemiet (f rrru o;t1aexomoeildlaDulump;u) lermo3oydop e nvsl()trtr(opnudlm e feil(fa2raum ot0tee ii3iltfa um(monu)tltrxr3iotfaDrauvslt0 etmxmpoo1ameelfcsasfaDtmxmoou4aeto f3ildlsDeanvp (0 eerio3tadlpDe nvsls0trxmxopiu1ope mneilt a2tr( ono0tpe  i3tydfs elnmont0altnir3tydoa rauvols trxo(r nudlm nlfetasf 2trump;o1oex if3ildfaDrl(vs;t4aeenxo tytoaDe iei ()seur(r nodap   nes s  2urx  oo1apt ioetasfm rauvpnt4tlerif iydlmtr uei;() ruo(o iodomenlfeil()srtmu ono0tpxnif3tytla2uan pnu)trerif3to1la  anes ( trtrirpou1omeemfeils)artaum nu4aetnmictatlm2rm(mpnt4teenxo3tytlmDelieols sexm(r3oy1amt  ncs sfaDtaxmoot0oetomietlsfs uluvpn(0tlxrio ta1oatelnes;(0sexmir oydlleemiviatfsDtmx  ou4tpt mi3iaslm uluvpnu4teenxrcty1laDe neol(0s2urio3io1alenlnetlt a2umu oot0oeeoioeiad s rlnmp t0 rxnirciatom rlnvolt) rtr(m3nodlpe mfcia()sDrr(  ot4ale  ociadfa2rluvp u0tltriocty1lm   u sl( trto(m3iy4am e fct ( artaumoou1tlxo i3ildfaDrlumpnt4aexrir oodfmteai o t)trurio nu1ll nmivia(faDumurpoo1aet moctadfa rm(ms;() etoxr oytomDr ueo;(0t2trxrpoy1ame lnctatfa2tmur ;o0altnmfctlt mDea(ms t)teerxrcoytfmte iei;t t2to(mpio1am nmnvils)aDtmur oo4aetn ictatlsDemu pnt0aeeomo3oo1op  ai o t0srtm(o iydomt mici t) Duaur ;o1oltn oetydlm emnvp t4tetomo ta1op elnvs;s0texoxo io1amtnmfvia(f 2ra(moou4oltnmoeiaslaDemn onu4tltoir oydfateluvol()tetrxo3io4ape lfctl() rrr(monu1apt  f3iyslm ua(vp ()tetomociytomtr ivsls0texrio3nodlm e fvsatf Duau ono4opxomoeiydlm2umnmpn(4 renxr3todlat  nvs s srumxm nu1lp nmivt tfaDurur nu4olxn ociatfsDulnvonu)artoxfcia1opt lu i;s trxmir ou1ome  iei s)arurur ot1tetn octatfa rmu s u4aeeoxo3oatfate uvi;( srtmxrpiy1ameemnet s)s2ta( onu1teeniieiyt mDrl( o;(4altrirciy1laDranvs;s0t2tmxm nu1altemncs t) 2tmxr ou4oetomfciat m uauvp;t4tleoxrcta1om r u s ( truo(m no1omtn nctlt) 2uaxr ;u1oeenmi3ild aDrlnvs t0areoxr tadlm rlu ols srxo(o oo4am n fvias)sDurx  ou4olxoio3tlsla2rlumo t)tltnif oo1late uvols) rtrir3iy4ole mnetas a2ururo;t4aptn ieilt sDrmnvp;t)alerioctatfa e n s t  rxrir iy1apen ietlt)a2ta(rooo0ale mfctld m eanvo t4 eeomocoatomDe ies () 2tmxopiodap elnet ()aDua( oot4tpx  i3ils s ran p;u0trxnmocto1fa e iei;( t2um(o nydaltn fcs tf rua(r ;t1ape moetydlsDumnmsnu) lenmrcio1op r i s;()setr(mpnodopen fvils) Dtmxmo;o1oet  ietytfm2elnmpnt0 eeomo3oytoptraivolt)setoxm3iy4lpeeliet ( srtmxm no4olxnioctadls eanvo;t4 rxrmr3tatlat lnei;(0 2tm(r oydomte ncsat)a2urxmpnt4aetnmiciydla2umnvo;t0artrmf3iotfmDrauei;t) exrxr3iy1omte ivilt  ruaumonu4alen o3iyt a rluvs (4texnifctodfat auesls0 2um(o ny1lmtelfvs ()s2raxm nt1openmfeild m ulnvs;t)arxomocoo1fmteli ilt  2xmir3iydapen nci t sDururpnu1open o3ilsfa ulu s;t)alxnmfcto1laD aueslt) 2toir3ny1olte ivsas) rrr(m ;u0aptn fcilsfa2ua( o t)altrio3oytlmDelivo s  exmxm3iodole mnesa(f Dtm(rpno0opxo fciyd a elnmo;u)altoifctadfpDrai ols0texrimpiydol elfes t) 2uaurooo4oeto o3ildfaDemnms;()tetrio3iy1oat  nvs;s  exmir3no4aptelivtl(farraxrpnu0oeeoiieilsfmDrlu o;() rxrio iodfateaivi t0trxm(r no1oltnmfvils  2rmuro;u4tptomfctlsla2ra( o u0trtrxr tytla ran sls0 exmim3no4al  liviatfarrrxrp;u0oex mietlt mDum( p u4aeenir3tadopDrai o t)texo(o3iydaltnmfvil()sDrrx oot0olx ifctytfs ean ont0alxnmf to1lat  iei t) rum(m3nodlle lieslt) rraxmo;o4olto ociad m ul( s;u0 rtnxo3iadfaD au ilt seuoiopio1lp elivils)srrr(mpot4teenif3iad m2eanvont4tetnio3tytom r uvil(0tetr(mpoy4apte nviatf 2rr(mo;o4oex mociad a uanvon(4aeenmocio1fatelueo s trxmir oo4al  licslt s2um(m ;t1oeeoioetas a umuvs u)teerxo3ta1fm  luvils srtmxr oydop  lnvt s) 2rm(ro;t4oltn ietatfm emnvs;t)altoif3todfaDr ueol(  2xoxopiy4oltnlfviasfsrtm(r no4opxoio3ilt sDelums;(0texnmf ootop rlnes t  eurxm oy1op n fvias)s2uru  nu1alen oeiytls ua(vp;u)aexnxo3oatomDeauei;t)teurir3io1ap nmfvi sfa2rmxr ;t0aptnifctad s2emn s (0trxoxo3oatlmt  n olt0truoxo3io1om nmneils)s2trx  no1oee mociadla2ulnmo;(0aeerir3tadlpteaueslt t2um(o iu4amtemfeils)s2raurono0alx  oeiyslsDra( s t)tlenmfctadlmtrlivs t0 eurxm3oy1openmncsls  Dua(roou0olenmi3iltfs2uau p;u4 rxnmf oydom  lu s;s)texoxmpoydllee fet tfarrm(  ;t0olen icild m2rmnms;t0tltrif3totoaDraneo ( srxoimpny1omt mfes tfsDrm(mp;o0texomociadla2umnvp;t4trxnif todlptr iesls0t2umir3ou1lmtelnctl( arua(ro;u1teeomfctlsfm2rm(ms;() exnirciytlp  au s;s  exrirpoydape mfctls)a2taxrpno1oeenmfciatla emu onu) eeoxr3iydoa   nvsl() rtoxr iy1amt mfetltf 2rrxmpnt1tptnmi3iatfs uanmp ()artomo iatlaDranvo t0 exmir3iy1al emivsls)artrxro;u1optnmi3ilslsDraump u4trtnif iydlaD livslt t2to(o oydlm elfcsa(f 2ra(  ;t0aeen ictaslaDrluvp;t)texoirctytla e n o;t)srum(mpoy4lmt  ncsl( a2urx ooo1texniiciyd m2emu o t4 exoxf iodfpt ai olt teurxr3ou1ol  mnvil()aDraxrpou4aet if3iadlmDeau o ()aexnio3iodoa r ueils) 2tm(o3io4ale  ncsatf rtm(m ot4teenmoeiysfa rlump (4 eerio iatlaDean i t0 etmxrpnu1al  mnetlt  rtmx pnu4oexomictldfm2rl(vont)trtomrcoy1lm r n sls  rtoxmpoy1lltemnvtat)srrr(ront0tpx  ocils s ul(vs t4tetrxf oatfmtrli ils  2tmirpnodape lfet t  2umu  ot1aptoifeias s2rlnmo;u0 etnxo iodoaDr i i;(0 2xrirpnudole lietasfarraumont4alxnmfcildlaDea(vp;(4trxomr oatlpD li o;t0teuoio no1ol nmnvsa() 2rrx pot1alt iicilslsDrlump (4 leoxf to1lm rlies;t  rxr(rpoy4lmenmicslsf rtru o;o4oex io3iat s emumont4aleoxocio1omteln i () euoxopoydlm n ieilsfa2um(r nu4alxn f3ilt a em(vont0trxrxociodla   ivilt0t2uo(opoy1lptemfetat)a2rru onu0oexnmicildlaDrl( ont4trxnxo3ia1omtraueilt0t2xriopoo1lmtnmiei ( aDumuroot0apt ioeiltfa2ra(mo;(4arenmrcty1laDeln o ( t2trxo nydaptnmfesa( a2rru  ;o4olx mi3iys sDuauvp (0tleomr3iytop elnvi;s0 eto(r3oudol nmfctlt)arraxr nt0tee mfctldfs rm(vs u) rxoif3oadla r nesls s2uoim3ou1omtnlfvt s)aDua(r ;u0tltnioeiad sDemu o;t4aetoxr3tytlmD lieols0t2xoiopio1op   feias)a2rmumonu0aeeo f3iyd m2rmu s u4trtrxfctytlp rlivo s0t2um(r iy1ap nlncta( aDtmx  nu0aexoioeiydla ran o;u0 etomo3tadlaDrliesl( s2um(r iu4opeemnetatfsDrax poo0texnio3iyslaDuan s u)tetomfcia1fmtrauvs s)trxrim nu1lp n fvtl(f rtmxrp;o4olenioeiadla ra(vonu0aeenifciodoaDeli il()t2xm(r3ny1amtnlivtl(f Duaur ;u4apeo oeildfs2em( s (4teeoif3iotomDrau s () rumxm oo1alenmiet () 2raump;t0tlx  f3ias s2ul(vpn()texnxo iadfatelues;t) 2xrxr iudopee nvilt sDum(  ot1texomfcildfaDumnvs t4 ltrif oatoa  liei;s0s2xriopoodol n fvsa(fsrurxrooo4optomo3iatfm2rl(vo;()trxomf oatfm ranvo;t0s2xmimpiy1lltn ivt t a2tr(m ;u4olt ioeildls2eau o;t4trenirciatomt anvo t)srxr(r oydape lnvils  2um(rpnu0aleoiociys m2rlnvs t) rxomf todoptr ivo;s0sexm(m3oudalenmnetl(  rurx  oo4tpeo i3tadfm2um( o;t4trxomocto1fmDr iesl(  2tmio iodapen ncilt) rumx onu4ole  f3tad m2ra(ms (0aetrif3tadomtr u s s s2urirpiu1lpeemiesltf 2trum no0oet mictas mDrau s;u0treoxr3oatfa e i s;(0s2xrxo3iydlmen fvs t  Dtaxmp;o0apx mfciat m2ua( o;u)texnmf3tatfa eaivo;t setrxopiudlm  mics tf rtm( ont0olenmi3iydfm ua(vp u4alenir oo1om raieilt0t2um(m3no1lm  mnci (f Drax oou1tpeniieiyt m2elnvon()aeenxfctydfm elueo (  rumim3nydamenmnvs s)a2raumpnt4aexn ietlslm ra( p;u0aetrxfcoy1om   nei ( t2xrxo3ny1ol n fet s  2tm(r nu0texniieiys aDem(mpnt0tltriocio1op eaivol(0 euoxm oodame mfvt (  2ur( o;t1oeeoioeiysfa rm(mo (4trxoio3iodfaD lnvo ()srxoio iy1om emfct s)srra(roou4aptomi3iysls em(mont4aeenxf oo1lateln s s)t2uo(opiy4lmtn nvi sfartmxmp;o0aeenmiciasfa2ulu pnt) rtrmo3iodlp eli slt0t2um(o oodom emiesls) rrrumonu4tlxnif3tad mDean s (4 rxrmrcty1optranvilt trxmimpiu4ap nmfeilsfsrtrxmo;o0tetnii3ias a2umumonu)tlxnir iytop rli s s0texoxm iu1apt mneta() rum(rpot1tetomfeild sDrl(mpnu4 exomrcta1oaDrlnesl(0t2toxr oo1optn ivi ( a2truro;t1opx mfciatfmDem(vp ()tleomfcoydlmDr ivs t0t2trxm nudal   ieilt  Dtmxro;t1oltnio3ils s umumpn() leoxfcoa1fmtran i;s)s2trirpiodlm  lfcilt) rrrurono1oeenioeiyd m2rlu pnt0 lxoirctytfp   uvo t seur(m iydomtnlfviat) rrmxrooo1apx iictlsfaDra(vpnt)aeenif3io1lptrau o;() rxr(r oodopeemfvtls)s2ururont0tlxomo3ias s2emump;(0trenmrciydla   uvo s0trumio iodalt mics ( aDraxrp;t1oeeoii3iaslaDulump (0artrir3iytlm r neo;(0t2xoir iy1op emieilsf Duaxmont4tlt if3tysfaDrl( s;u)arerxociodomt ai i;t0t2uoxrpoydlle lfes t)artaxr ;t0tleomociasfmDrln snu0altrxo tadomte nvo;s  2umio3ou1om elivs s s2uaumpnt4tpxnif3tlsfs em(vs (0trtnmrcoadla raneo;(0sexrxr3nodome  fvslt)a2rax pnu4oltoiieildfaDul(von()trxnir tytfptean i t0 rtmim iodome lict s) 2rrxm nt4tex iietyt sDelnvpn()tlxrmf3iotlaD  uei t0setr(rpiudlpenmfct t) rrau onu1aetomictls s ea( s;t4artnmrcoytfp  aneils)trtm(rpnu1alt lnctlsf rtaumont4tltnmieiadlaDeanms u) eenmf totfat  ueo t sexo(m3ny1lptelneias)srrrump;t4opxn o3tytls2elnmp;t0 rtrmr iatla  lnvolt) 2toxo3iy4apenlncil(f Duru p;o1aetniociytlmDrauvp t)tleoxfcty1lmteaivils)srtrio oo4lmenliesasfaDrrxroot0aeeo o3ildfa ul( p u0 etoirctodlm   ieo;s)s2tmio3oo1llte nciasfs2ta(r oo0alxoiieildlm umu p t0 etoxf3tatom e n s;()srxoxr io1op elivias srrmurooo1ape mfctatls2rmuvon(0trxomr3oytfat lueils)srurio3oudap nlfci (faDtrxr nt4aexomociat m ul( o;u0texomfciadlm  aneo;t0 exoiopou1apenmictls)srumum no4olen i3tatfa emn snt)aeenxr ia1opDe nvi;()trtrxm3iy4lltemnvtat) 2um(m ;t4tetnmoeild a2emuvo t4tlxrio todomtr uvo ( seum(o nodlm emivs s a2rr(m ;o0olxn fciyd a2umnvsnu)arermf oydfatrauvil()texmiopou4amt lnvia(farrmu poo0olx  o3tat m um(vo u0 lxrmrctydfa eluvo (0tetoiopou4ameelfvia(  2tmump;o4aex  fctyt m el(mo;(0aeeomr3iodlmD lnvi;s0trtoxr nydlmtnmivta()aDrmumo;o1oeeoiieiat sDumnvp;(4 lerxr3tadopD  ivil(0seto(r3oy4alt mnvtl(fa2tm(r no1aetomf3tlt aDul(vsnu4 eenio3iy1omDr i s (0t2xoiopnudlptemfci ()srur(m ;u0oeeoif3iysls rln p;u0tetnxocty1opDrlnvol(  rto(r3ny1llt mfetltf rurxr nu0optn i3tlsla um(vpnt4altrmf3tydlmDe ivi ()teurirpoo4lmtelfvi (fa2tax  no0tetn iciadla2umumpn(4altoio3ta1faDelivs t  etoxo nu1ll elnetatfsrta(m oo0tle iociadlm uluvo;u)tlxrxf3iy1oa eai s (  exrir oudale  iesl( s2rrumpnt0tex mo3ildlmDul(mpnu4teerxociatlate nes;s0 rtm(mpoodlm n fvsat)aDururp;t0tee mfetld a2um(vpn()trermfcty1opt an s s) 2uo(m iydapte nei ()sruaurpno4oet  fcild mDranmpnu4artoxf oa1fpD lnvs ()s2uoim3iy1lme  fetls) 2ururp;t0tpen ictys sDeln snu0 renmf3tadoaDr uesl()setmxm iodll nmfcsas aDrm(rpot0olenmfciadfm ean pnu)tlenmo totlatr ivo;(0s2xm(m nu1lpt mnvi t artru  oo4aetn ociyt mDrm(mp;u)alenxf3ootopDr u olt0 rtm(r3ny1ll nmnetat)srraurpnt1tptoiieiyt a2rl( p u)teerxr tytfptr neils0 rurxmpoydllenlnvtl(faDta(mooo0aeeomociytfmDean o;t)alxrmf tytlp r uvo s0srumxm oy1lle  ncs s aDtmuro;t4aptomictydla el(mp;u4texnxf oadomDran i;t trtmir3oudomt mictas  Durxmpno4opt ifciltfa2ua( pnu0 ltoxociatlmte iei;s) 2xmxo3ny4alenmnvta() Draxrpno0open feiasls2rl( pnu4treomr3oytoa rlnvsl() 2xo(r3nu4oltnmfetls  rumx  ;u1oet moctyd sDrm(vsnt)alermrcoytfmteau s t)srxrio3iy4omt  nctat)aDurx ont1apt iieiysfa rmu s u4arerio iadlaD luvi ()s2to(r3ou4lptemfci tfartaur ;t1oeto fetys aDel(mpn(4 rxomocia1omt lnvsls)t2um(rpoydll nlneta( s2rrump;o4aeen i3tls m raump;u4tetoifciadfpteaivo;s sexrio nodll  mfetls  ruauront0texnmo3iasls2emnvs;u4tltnir oo1lmD au slt trumxo3iy4alen ics (fsDuau  oo0oltoif3iltls rluvp () lxnmfcto1lm elnvilt setm(opiu4lpenmfct s)sDumurono4olto feiys m ul(mo t4 rxoxociodoaD aivi;( texrimpiodaptn nvt s  Drmurpot4oetomoeilsla2um(vpnt0trenmo3tytlaDe ivs s) 2tr(o oy1llte fct ()srtrxrpoo1tetn f3iatfm rln o t) etrif3tydoateanes;s0 2umxrpoydop e ncsas) Dur( onu0opeoii3iydlsDumu s u)trerxoctytla e u ol(0trxoxr3iudolt mietasfs2rm( pou4texoio3ild m ea(vo u)tlxnmocoy1laD an slt) 2uo(rpiu4alt lnetas  2ur(m nt4aet iiciadls2ranms u4 exoifciytfpDraneilt  rxrxr no1apenlivt () Dtrxmpoo1aeen fctytla2uluvont)aleomf iodomD  ivols0srxm(r no4op  mnvils) rurx pnu1texo ieiydfm2emu o t)alxnmrcoadfpDrauvo;s0texmxmpnu4lpeemnvi ( aDra(m ot1alxoio3tltfm2emu o t0 etoif3ty1lpD lnvsls) ruoimpiudomtelictls) 2raxr ot4aex mi3tldfm2eau s;u)aetrmo ootlptrauvol()texo(o oo1al n fvt tf Dta(rp;o0aeeo feiydfmDumu snt4aeenifcoytfaDelnvi;s t2xoxr3oo1amt mncilt)srtaxro;o4opxn oeiytfm2ulumo;(0 exrmr oy1fmtranesls) ruoio3ou4amt  nct s)aDrr(mo;t1apto f3iadla2uauvp (0trxnmo3iadoa elneo (0 exrxr nu4lpt  iviat)aDtr( onu0tle  o3iltlaDrmu snt)tetoir3ootlpt  neo;s  2xoxo ou4ol n iei tf Dtrxrpot1ape  fctyt m uaums;t4tetrmf3iotoa rli sls t2tr(mpoo4opee fetls)sDrmu  nt0aeeomocild aDra( s u0 exnxr oydfpDrlnes;t0srxmiopiu1amt  feias)a2tmu oot0alxoioetlsfaDuanmo u0teeomrcio1latraieo t t2umio iodll  liesasfsDraumont0oexomoeild m uaumsn()aetrir3ta1fmD auei () exmim3nydome  nvias)arua(mooo4opxnmoeiadls2rl(vs;u0areoifciadoaDrli olt sruoir ny1lm elnvt t  2tmu p;o0ole mocils sDemn s;()tetoxo tatlmD lnvs;t)t2xrim3ou4opt  ivta()srtauro;t1altn ictaslm2el( o ()altrircoytlptrai o;s srumir nu1omenmieia()a2ur(ront0ole iietldls um( o t0trtoxf3oa1faDrln i ()s2xrxrpno4opee ictatf Dtm(mpno1opxomoctyt sDua(msnu)tlenxo iydopDeai o s t2uoxo nudlpenmnvsas)srrax  no1ale  oetld mDuanvs ()trtrxf iotfat  i ils0texoio no1lpe lfcs (farrm( ont4tpeniietysfa2raumsnu4tlxoiocoo1lp  aies t) 2xmxo io4ap e ivt s artr( o;t0aet  f3iydla2ulnmo t0alxnxr iatlmteanei t) 2tmxmpnodamee iei s aruau  ;u1tet mi3tadfa emu p u) eenxf3iydop elnvo s)tetriopiy4lpeemieiatfsrur(  ou0aet  o3tatlmDemu ont0tetomo3io1faD luvo;s0trtmir3nudlmtnlfcsa(faDtmump;u1oleo i3tysfa2rmn o (4 lerxf oytlmD auvs t srxrir iu4omtn ieia()a2rauronu4aexo fetad sDrmumpnu4 eermr3oydlp eai i;s) euo(m3ou1ol e fvi t)aDrrum ot4tlxniociys m rl(msn(4tetomocoodlptrlues s tetmim oy4al  mivt t) 2umxrpnu4apt ioetadfa2uan s;()tleomo3oy1opDelueil(0 etoio3no1omeemnetlsfs2rm(m nu4alx mo3tldfaDemn s;(4teerif iy1fmtelivs t texr(r iodlptnmfcsl( artrum ;t0optnmiciat mDrlnvpnt4tlxnif3iy1fm raies;t0s2toxm3io1ameelics ()srrmx p;u0opx iieiyt a emnmont)teenxfcootlpD aueo ( teuoir3ny1olt  nci t  2tax o;t0opto oeiyd s rmu s;(4trenxf3oo1oaDr uvi t srxmxopoo4lmt  ncs tfs2rm(m ;t4apeo iciys mDrl( o;t0trenmo oadop r nvo s)teurxm oy4ap emfei sfa2rrxmp;u0opxoioetlsfs ranvs;(0altrmrctytfmteluvo () rtm(mpny4omeelivs t)aDrr(m nu0oex mf3iydfsDulu p;u4altrxr totla eluvs;( srxrxmpnu1apte fes tfs2ua(mpot0tleoiiciyt a2emu sn()tltoxf3iytop  anes;()seuoxm3oo4ap e fvtl()aDtm(rono1tpxomoeiytfa el(vo ()aetoir3tadfm e i sl(  rxmxopno4optn neil(f 2rmur ou1tpx io3iatlmDra(ms;() reoxo iotlm e ues ( teuoxr oy4oleelfet s)s2ur( p;t0tpeniieiasfaDelumo;() lermociytlmtrluei s0srxm(opoo1open ics sfartaxmont1olenioctasls rlnmo;(4aeenxrcoytomt lu il(0srtrio3iu1lmeelnctlt)srtm( oot4aexomfeiytla ua( on(0trtoif3iytopte nvs t0srxrim3iudopen ncslt  rtm(rpnu0alx io3ias a rmu p ()texnxr3oo1omDeai i;t s2xo(r3oo1lmt lfes t  rrmum ou0optomoctys sDumu pnu0artrirciy1oaDe ieolt0trxrxr oy4lpeelnviat) Dumxm ot0aexnif3tls mDrluvs;u4arxomociatopDraueo;(  euoxo iydlm nlneilt  Dtmum ou1aptnmfeiyslm emnms (0 eeomf3iy1oa  aues;s srur(r3nu4ap emics t)srtmu o;o0tpxo oetysfa2rlnmo t0 rxoiocoydopDeaivs () 2um(opiudlm emicil() Drrurp;t4opeomfeiydlm2el(mon(0 eeoxo tatfp  aivo;t s2xoirpno4ll n icta(f 2ur( oou1ape  ociadls2ua(mo (4 lxrxrcoytlp rli sls0tetoir3oo4alenmfctlsfartruronu1open feildfmDrmnmsnu0altoxoctydoaDraneols0t2xoim iudop  lnvia(faDtax poo4oleniieiyt sDem( p;t0tlxnxr oodfa rlu sl(0 rtmxrpny4lp nmnvtl(farumxmooo0tpt mfetatls eanms;u0 exrmf iytomDe u s t0trxmxrpou4lmt lietls aDumx poo0tle iociytla emn pnt)trxnxo3oadfateaneol( t2xoiopnydol nlfcsatf rrax  nt0oet moetls m rmu s;(0 exrmo ootfa eai s;t) 2toiopiydamtelnviasfsDraump;t4apenio3iltfm2ean o (0tltomf3oy1fm r uvs;( seumxr3no1ol e fesas a2uaur ot1altnif3tad sDuanmo;()treoxf3totlmDrauvil(0t2tr(m3iu4apt mnvs (fsrrmxm oo4tptn icils mDeluvp;t4 rxoif iy1fa elieo t0teum(r ou4ale  fvi s a2uau  ;o4apen ietadla umumpn(0aetnmo iotomte u sls)srumxr iudlltn fvsa( sDurxrp;t1aex  oeias m2rm( o u)altriociotfmDrln i;t trtrxo no4alt licsasfs2raxrpot0alxoio3iatlm2emnmsnt)aleoiocootlat lnvs (  2urir ou4llt lnvi s  Dua(r ;u0oleo ieils m rl(vont) rtrircoadlatraues;t0seurxr no4amt mnvtas arta(rpno4alt  o3iyslm2ulu o;(0 ltrirciodlptraueslt)texm(m3oodlp  mfvtat aDtr(rp;t4teenmictls mDrln p;(4 eenir oy1fm  anes;(  etoxo3iydap  mnet (farua(moou0apx iiciydfm2rmump t0texnmociatlmte ies;s trtmio3io4apenmictl(fs2rmxr ;o1tet  ietydlmDelump t0aleoif tytlat  uvo;(0teumxr iu1lm  lieta()srtaumpnu0ape  feiydfa uanmpn(0texomr iodom r nvs;s0trxm(m3iudolt mfeils)sDur( ono0alxnioeiadfsDeln p;(4arxoioctydfp rlu o;t0 ruoirpoy1ll nmnetlt srrmur ;u1aet iociatfa2eaumon()tetomf oatlp   ivo;t  rxm(o iodll e ncilt)s2rr(mpoo1tet iociadfm2ulump t)tetrmf3oytlmteanvil(0 rtoxrpoudlmee fvi () Drrum ;t1oeeo ieiytfaDemnms (4 ltnxfcoytfa eaneo;t0 exr(rpiy1lmt  feils srumxm ;t1oex  f3ilt a2el(vs t0 ltnio tadop  aneils)tetrio3nudlleemnctatfsrtmuroot0ole ifetydfa2rmnvon(4texnio io1lateanei;() 2uo(r3nu1ape mivi tfsrtrxmpnu1tltomfciatfa em( pnt)tlxrio3iytlmte uvsls)s2tmio3iodam   iet ( s2um( pno1teen oetatfa2ea( p (0trenxf3tadlpD  ues (0 2trirpnu1ol  lfei (f Drmxr ou1tpeomoeiytfs uan o u0tlerxr3iotom  anvslt0srxrxrpiudap nmivta(farrmu  ;o0aet  ictld a umnmo u)teenmf ta1om rlu o;s0texoxopiydam nlncils)sDrmum ou4aetn octat aDelu o (0altrif3iytfa elnesls s2uoim3oy1lmeemicilsfsrtaumont4alenmf3iyd sDuaums;(0tlxoxr3tatlaDelues;t)t2tmxr3ny4om  lfes s) rur( poo1alx iiciasla uanvpn()texnir to1fmtelu s;t) eto(mpiy1lltelieia()srtmx p;t4aeto feildls rmu o;t)teenmo tydfpDrln sl(0setm(m no4lptnmict ()s2tmu o;u4aexo ictyd mDumu p (0 rtrmocoatomtr nei t)trum(r io4ol nmivi ( s2rmur ou0aexo oetyd m eanvo;(4 exrxociy1oate ivolt  etmir3ou1ameemnvil( sDraum no0opt mf3iadls2elnmp t0aexrio iodlmD ln s s  rxrimpno4am e fvi s)sDurur ot0aetomo3iat m2umnvo t0tltrxrcootfateanvs s)seuoxmpiu4lle lncias)aDum( p;o4apeoifeilslaDumn pnt) lxrmo3tatlmDe n s s t2xmxo3iu1omtn ieia(fa2umxmont4tpeoif3iydlaDem(vp;u4trxnxo3tadfp elnvs;t) 2trxr3iudlptnmicilsfaDumumonu1opxnio3tyt aDul(ms;() exnio3oadlpD aies t)s2xm(r3iudoltemivt t  rum(rpoo4tpe  fciad a ean o;()alxnxo iy1fmtrai ols)srtmir ny4olenmfeia( artr(mono1oeto ieiyd s emnvp;() ltrircoodfa e uei;( trtmxr oo1aleemnvt (  rrm(mpot1apen oetytfs raump;t4arxnmo3tytlp ranes;t s2xm(mpio1amtnlnes sfaDtmx o;u1oleoif3ilsls emu s;t0altrmf tatomtrlnvolt trxr(m iodomenliet tfa2ua(mp;o4teeo ietydfm rl(mp u4 lxrifcoadfaDrau o t)trxr(r oydomtnmfcias a2urxmo;u0olxn o3ilt a raump;u4tlenif tadfm r n slt0trxoxm3oudoptemiei ()s2rrx pot4aex ifeilsfsDra(ms;t4tleoircio1laD  ivo t)s2toir oodllt mfvta(f Drax o;u0tpx mo3iltfm emump () lxrir3ty1oa r u s s) eurirpnodllen fvi (faDrrxm ;t0tex  fetyt a2ua(ms;u0 lxnioctodlptrluvi;s)trto(o nu4omtn ies ()srtmumo;o1tex ii3iyt aDemnvs;() ltoxr ty1oa   i o;s0t2trio oydlmee ivsat)aDurxro;t0tptoii3iyd a2em(mp (4 ltnirciy1oaDeln i;s)trtrxmpiodolenmnesasf rraurp;o0altn ieiaslsDelu ont4trxoirctytomtrauvil(0tetmirpio4lmen ietlsf rum(r ot4oltnioctyt s rmn s;u)areoxf3tadoa elnvo;t0t2xrim3oodlltelfciat)s2um(  ot0tleomi3iatlm2um(mpnt4alenir3oatlaDeli o s0srxrxr3iy4al   neias) rraum nt0ape  ocils aDum( s (4 etomoctydoat luvs;t0 rxmio ou1lpee iesas)aDuax ono1tpeomo3iyslm2rm( s u0aexrxr3iytfpDe nvolt0 2xmxo oo1lmt mfcs ( srta( ono0aexo fctadlsDem(mo t)trxrmf3iodoa r ivi;s) rtoxopnu4apt lieta(  2umurp;u4alx iocilsfmDul(vsn(4tlxrifciytfaDe ueo (0s2xmim3no4olee ies ( sDtr( o;t1ole  octlsfa2um(mo;(4aetnxo3oytopDrai i;(0srxoxm ny1alenlnesls  rtax p;u0oltnmoctldfsDel(mp u4 leomocoadlpDr uvo t0srurxr oo4al elivs sfsrrrxrono1oleo fetadla2uluvont4aetrxr tydop rlneol()srumxmpnydole mnetlsfsDrm( o;t0alxo octatlm2el( o u4trxnmf3ty1fpteau s;t texoxr3nudlp n iciat) 2tr(rp;t0olxomiciysla eanmp;()teenmr3iotfptr n sls  eurim iudam n nviat)sDuax ooo0tpenioetatls emump;() etrmocoatfmteluvo;t  eumxo3nu4alt mictasfa2rmxr nt0optoio3iatlsDum(vp u0alxoif totlaDelivi t0 2xr(opou1lmee iei () rrrxmpnt1tptomocildfs2ua(mo;u4 ltnxrcootop  lu s t0srtr(mpou1lmtelfetasfsrrr(r nt4oleomieilsfs2ean snt4arerxr ootlp e i i;( trurir iodale mncils) 2trx pou4opeoif3iat a2ea(mo;u4 etoxf ty1lpDe nvs t0sexmir3io4ameelfes s  rtrxr no4tpxnifeiatfsDraumsnu4aexnir3oo1fpD aneo;t) rxmxr3oo1lpte neiatf 2urxr nu0tpxomfctatlmDra(von(4aeeoifcoydfmDrlivs s)s2tr(mpio4am nlicils arra(m nu1oeto fetls s ranms;(4 etnmf3oatop elies s) etmxo3nydomtemnetl( arrm(  nu1tpt if3tydfsDuanvpn(4 lxrxo3tatfate ivs t sexo(m3ou1apenlivs t a2rax o;o4oet ifeiyslm2emnms (4tlenio3iatlpt ai o;(0srumio3ou1aleelfvtltfsrtru  ;t1olxnmo3tls sDem( o u)aetoxocootlmt  uesls0 ruo(o no1oltn fes t arum(m ;o0aptoifetyt mDeau p;u4arxrxr3iy1fmtrlivi s texmxr no4lpenmfvias)sDtr( pno0alxoio3tys aDemumo;(4texoiocoatlpt lnvo t truoxo3ou1ap   ivia(faDur(mo;u0tlt mi3tys mDemn p;t4 rxnioctydfa  li o;t0sexoio3no1lmen iei tfaDurx ont4teen oeiadfm2em( p;()aeenmo oy1opDe neo s t2uo(r3iudape mfcils  2rrx poo1tex iictat sDelu sn(0arxnir3oatop rai slt  exoir iu1omee iciat sDtax p;o1oet ifciytlaDra(vo;t4 eenmfcoatlaDr uvi;t) euoxm3iu1lptnmfetat  2rru p;o0apto iciad a ul(vo;u)tlxrxo3ootlaD  iesls srtr(o iudom n nvtls)srtru ono1tlt mf3iltls2rlumo;u4altoxo3ta1lmD aneils  etoxrpnudlm nmfciasfsDuaxmpot4tpx io3tydfaDrlumpnt4 reoif todfa e ieo t  rum(mpnydap  lietatf Dta(rpou4texniiciadlmDrmn s;(4tlermr iatlmt  ivi s)srtoxm3iu1oleemnei ()a2rrxm ou4olt iociad m2uanmo;u)alxnmfctodlaDe neo;s0 2xrir io4al elnvtl( sDumxm ;t0alto fciltlm uanvp ()trtrirciadlp r uvsls t2ur(o oo1lp e nciltfsrum(  oo4apen oeild s umuvo t)aexrmf oytfaDelivo;t0 2urxo oudamt mneiatf 2rr(rono4oeenioeiaslsDuanmsn(0 lxnio3ia1lm  lnes;s0texrxo3ou4om nmnct ( sDtax pnu0teeomieildla2eanvs () ltrxr tatlm e u o (0seurim3ny1ll emnes ( aDrr( oot1aleo feiyd a2elnmp;u4tlxoxfcoadla raivs;s  rumim3no4oltnlnctlt  Drmxrpoo0alt if3iydfa2eauvs;t0trerxrciadfmte n slt trtrxo oo1al  mfciat)a2umxm nu0olen ieilt aDrm(ms t0trxnxfcoy1lp  aueil(0s2urim3ou1omenmivs (f 2raxmpou0ope  ieiasfaDea( onu)trxoxoctydlp elnvil(  rxmimpou1lle mnvil(fsDuaxmpnt0apx  o3tldlm rlu s;()tlxnxr io1op e u sls texm(r no1omtnmict s)aDtrur ;t4aet  feilsfm2rmnvp t0tlxrxrcoo1omte uvils)setoio3ou4lltelieils)s2rm(mpnu1oexn f3iltfaDeanvo;u4artoio3tydfpt  i o ( trxoio3ny4aptnmieil( sDuax ooo4oet mo3iydls2uanmpnt4 exoxrcootfpt  ues;(0srxmxr3iudalt mfvi sfs2rm(rono0texnioetlsls ea(mon(0texrmo3ia1faD ln il(  etmxm oo1ll  lnei t) 2ta(mpno0tlxomictas s2ulnvsnu) lerio3ta1opD auvilt  etmxo3nydolenmivslt)s2umxm ou1tpe  o3ilt a2ea( p;u0 reriocoadlat  uvi;t0texrxr3ou4lptn ivi (f rumxmont1aex iictlslaDulnmonu0tltnmf3iydfatrluei (0 2to(r3oy4llenmfcias srua(m ;t1ole mf3iat m2uluvont) rermr3oy1oatrlu o t srxoio3iydapenmnetas)aDraxmpnu1apx moeildlmDrmn o;u)trtomocty1la  anes;t)srtoir3ny4llee nes ( aruaxrpnu1tlenmietas s2um(mp;()alxrmo3iy1fate nesl(0 2umio3oy1op nlnvta( aDtr(r nt0oexoioeiys mDrmnms;(0alxrmo3oa1oa ean s s  etm(m nodameelfvsltf Dumurpoo1tee mfeiatls rluvo;u4aeeoiociadfpt  i ils)t2xrio3nydlptnmnvias s2urumpno4tpxomfciyslsDum(vpnt0altrmr tytlm  aieils) 2to(r io1omtnmncsa(f 2uru  ou4alen oeils a2um( ont)arxomo iodlp e ivilt) 2trxr3iodolt mivt sfarumurp;u0tleomieiasls2um( pnt4aetoio oy1la ran s s0t2trxrpou1lmen fctl( sDtrxm no1tee mictld s eanvs u4 ltrxf oytfaDeai o s0t2xriopiudop e nesat  rua(r ou4olt mociasfm2rauvp u4treomr3oo1latrln o s0tetoxo iu1lmeemiciatfa2ur(  ;u1oltomoeiys s em(vpn(4texoirctotlaDelies;() 2ur(o3ou4optemivi tfsrrmumont1oleomieilsfs2rau sn(0tetrmr tadfp e uvs;t0 euo(r no1omt mncta(fsDurxrpoo0oltn ocilsls2rmums () exrioctotoptr i ils srxr(o nudomte ivt s s2tmu ooo1tlx  ieildlm rluvs;t)areoifciatlpDraneil(0 rtr(m nudol nmnvt t)artaum nt0tltomo3tasfm ua( s;u0tlxoif ootla e uei;t)teumim ou4omenmfvtl(fsrtauroot1tpeoiocilsla2elu ont4artrxrctadlpD aiesl(  2xrirpiy1aptelfetltf Dur(ro;t0altoiiciydlm emu p u4aetoxf oatlaDr i i;s0seto(mpnudolt lfct t)srraurp;u0tlxo ieiytla2ulu p;(4aexriocoo1lm  aneo t t2toxm3iodoleelncs tf 2tr(mpnt1aee mieiys sDua( p;u)altrmo iotfa  livi;s) eumxm iu4lm  lfviatfa2rru pnt0ape mociysfaDrau snu4 renio iytopte i i (  rumxr nudlp n nvtat) rrr(  ;u4optomf3tytfm ulumpnu0tlxrif tatla r n i;t0 rtoimpoudamenlivt tf rrmxm ;u0aptnifctlsfs ua( p t)tleoiocty1fatr ieo;s s2tmxmpoudap  licsa(fa2um(  ;u1optoiocils sDumu p;u4 lxoif oadoptr ieo t setrxr3iu1omenlicta(  2rmxroou4tpe ifcilsls2rl(vpnt0artnxf iytlpt aneol(0t2xoxo iu1ole mnvtltf rtmxm no1ape mo3ils s rmn s u4tlxomo to1omtrlues;s s2uoxopoudopenlfct sfs2urxm ;o4tlxnii3tld s emu onu)tetnxo iy1oaDrau o t  rto(o3nudop  mfei t)srua(rp;t4aee iociytfm2umumpnt4texoxfcty1optelu o (0srumim3iodop nlfcs s  rta( pou0tee ii3tatfm um(ms u0aeermfcio1op rai o (0srxrxm iydll nlnct t  Dumump;o1tpto o3taslm ea( snu4aexnxo3iotomt livi;( s2xoim oy4lmte fci ()srum(r no4apx iociasls rmuvo u) rtoxf3iotlpDeauvo s0t2xoxo ny1llt  fvsl(  rtmuroot4aptoifctadls2ra(monu4 lxnxo oa1oate i o;t0teuoxrpoydllenlneia( a2ua(mpnt1tltnmf3tltlmDulnmp;u) ltnmo tadlpt lnvils)s2ur(r iy1al   fvtatfarrmurooo1oeto ieiytlsDrm(mpnt)alxoxf oatlm  ln o;()t2um(r nu4ol nlicilt s2tm(mpno1apeo ieils s2um(mo;u) reomr3iodfmtr ues;s0 ruoimpiu1ame mneslsfarrr(m oo0oeeoii3tadlmDrm(ms t0 ltrxr3ootlp rlivs (0srtmiopou4apt  ict t aDtmurpot1apenifciyd m2uauvs;(0arxrio oodlmD aivs;s trtmim3oy4apte ivi s aDtmxmpot1oexnmi3iydla ranmp u0tlerir totlpt  ieo s texm(r oy1amt  ivilt sruaxmoou0texnmiciat s ulnvs;t0aetrircoa1lm r ivs;() rxmim iydlm n nesat a2rau p;u1tpen ieilsla2uan p (0arxoir iydlp elneo;t0s2tm(m3oydopt miviltfsrtr(ro;o4apxo fcilsla rmnvp;(4 etoxfciy1op  ln il(  2xrxr ou1ameemncs s  rtm(m ot0open o3ilsfa rl(mpn(4 rxoxf iadlmDrlnei;()setrxopiu4ap  livs ( aDrmu pnu0altoiocild a2uln p t0 etnxf iadfa e nvo;s s2toimpny4optnmfvtasfaDtax onu1apxn f3iadfs2rm( o;u) renxr3iodlm  aivs (0t2xoxmpiy1om e neia(  rrmxr ou1olen oetlslm2em(mp;(4texnxociatlp eluvol()t2xm(r3iu4om e nctat a2tax  nt4tee mfciysfa2um(ms u0aexomf3totfaDr neils)s2tmxopiu1om nmnvtlsfa2raxmo;t4apeoiocildfsDuanmont)tlxnmr tydfm   ivs s  euoimpny1lm nmies t)sDumxrpou4tpx iociydfs eluvp t4tltnxr todfpDr uvslt s2xmxm oo4ll  mfct s s2rrurpot0tetn fetydfs2em(vo;u4treomfcoydlateanvo () exrio oy1omtelncs ()aDraumo;t0aptomieiadfsDrluvs;u4texnircoy1lp eaueils0srxoxo3oy1lm e fvil()srtrurpnt0oetnifeiasfa rmnmsn()alxnmo oydlmte ivol(  2xoxr iodlle lnci (fsrrm(mpno4opxo ieildfaDeanvo (0aetrxr3iydoat aueo;t) 2um(mpnydam elfct sf 2um( o;t0opx io3tyslsDrmnmp;t)alxrio3iatlmt  iesl()trumxrpiydal elnet t  2ra( o;t1tlxnifeiltls rln pnu4 eeomr3oa1fmDelueo;s s2xoio iy1omtn ncsas aDtr(mo;u0tet ioeildlsDuln o;(0areoxf io1fpDr i i s) rumirpno4lmen netl( aDua(rp;u4oleomo3ildfm ran s;t0 rermr oy1faD  ieol()s2tm(o3nu4lmtnmfvsatf Duax pou0tpeomocilslsDrauvp;u)texrif3oatla  livo t) exm(o3no4al n fvs () Duaxrono1aptomociysfm2rauvsnu0 exrio3oadomDrlnvi;() 2to(m3no1ol   ies ( sDraxm nu1optomo3tydfm um(vpn(0teerxr3iytfmtelnvo;t0 2toimpoo4omte fei s)s2tm(mpnt1apto ictldfmDuln o;u0 rxrxr tadfmtrauvo;(0trtm(r3oy1alt  fvi ()a2ta(mp;o0olen ociltla ran onu4alermfctotomD li il(0s2trirpou1aptelfvsatfs2ur(rooo4opxomfctldfs2emumpnu0texrifciodlmt  neilt  2urxmpoodopenmfvilt) rum(  oo0tpeniiciytla umn s t0texrxfctytfptrluvs s) 2umio oy1altn nes t  2rm(mpno0olxomo3ilt mDeln snu0aetoxf3oy1omtr u o;()srxriopnudal  mfvs t artrx  ou4olx  fciyd aDulump ()tltrmf todfa raivo;s  eumxr3oo1lp  livtlsfs2uau o;o4aeto ociys aDrln o;u4 exomfcoy1omDranvs t) 2xr(o3ny1omte ncsa(  Drmxr ;u4aexoioctys m2raums t4arxnmr iadlpD  ivol(  rxr(o3oo4ame  ncsl() 2um(r nt4aexomfetasls emu onu) renifcto1lm  au slt0srtoxo3nu1lltemnes t)s2uaumpot4tpe ifeiytfmDel(ms;t)texrir3ia1fmDeauvols0 ruoio3oo4lp   ictl()sDtrurpot1aeen ocilsla em(mp;(0tltnmfcoydoateluvil(0texrimpiydamt lfvsl( s2urxr ot0oeeomo3iyslm2em(vont0 leomf3oo1omt luvils trtr(m3oudol nlnvias) 2taum no0oeenmoctldfs2rluvo (0 renmf3ty
\ No newline at end of file
@@ -0,0 +1 @@
+neo t s2xo(mpiodamtelfvtlt) 2umxr nu0opxnmo3iadlmDel(msnt0 etrxrctydlmDe nvols)teurim iu1lptnlnvsls) 2rrxm nu1ole  oeias mDrmuvo;u4 eenmo3oatfpt lnvsl(0srtmxo3iy4oleemnctl(f rtaumpot0tet  feiytfm2rm(vp () exoxo3oo1fp rln i s0 2xoio iu4lpt mnei tf Drmx pou0tpt iocilsla2eln onu4 lxnmo oo1fptrln sls trtr(rpnu1ol elnvias arur( poo0olen ocild a rluvsnt0 lenircoa1la r neilt0sexrirpiy4ap  mnei tfa2umur ;u4aptn f3tld m uanmp;u)aexoio3oydfm e iesls)t2toxo3io1lmeelfes t sruau  ot1apenmo3tys sDemumsnt4trerxfctotlmD aivslt  rurxr3nu4ap nmies t a2rauront0tet iociatfs rmuvsn()arenif3io1lpt auvilt0 exrxr ny1lme mfeiltfsrum(ronu0oexomfcilsla um(mont4teeomf3iytfaDeaivs (0t2triopnu4om  lfeilsf rtau o;u4olx io3iad s umu s t0aeenmr oy1lmDrli o;()t2tmxm3oy4ap  lnvsas)srtm( ooo0opt ii3ils a eanvo t4arxrmr3oadlpt  neols)sexmxr3io1llen ies t)arumum nt0opeo fciyd mDea(mp u) lxoif io1fp eai o t)s2xrimpoydalee iciat  2tm(m ;o0ape mieiasls el( ont)arxrmr ta1opDrlu o;()trtoio oydlmtn fci t s2ururooo4tlenmoctytls2rluvs;()areoircoydfmt lu ols srur(r ny1lle mfesl(fartaxroot0tlxo i3tad s2ea( snt0tltniocoy1lat  ues;s)s2xrimpiy1amen ietlt)arrmxront4tpt io3ildls2ulu pnu4alxomf3ootlmtr i i ()trtrio oy4apenmivs sfs2rrxrpno4altoiieils a2rm(vsnu0tlxnio ta1opDe n ol(0tetoir3nodam n ivs s)s2raur ot1oeenii3tadla uan s t0tleriocoo1omDelueo t0 etr(r iudomeelfcs t)s2rax o;t0tet mf3ias a rauvs;t0 lerirciatopteli s;(  etm(o no4aleemfvt tfsrtru oou1tetnioctatfa2rmn p;t) exnmo3oo1fatrai s;s0t2uoxmpnudlm   fcsltfsDuaurpoo4tee ifctadla2uluvont0aleoxo3oytlmt an slt0trurxrpno4ole licilsfaDur(  nu4olt  fciysfs2eanvsn()tetrmociydomteanei;(0srumxo3iy4om   ieta()sDurumonu1tltomo3iys a rl(vpnu0trxrxrciodlmt an o t srxrxr no4ame mfcsls a2umxrpot4tltoiiciyd s eaums t4artnif3io1la ran olt  etm(m3ny1apee netatfa2rrur ;o4tex mo3taslmDea(mo;t4areomo3ootlmDrau o t0t2to(opoo4lm elfeta() 2raurpno1teeoio3iaslaDrmumonu0aeenxocta1omt aivilt  2xmirpio1aptnmnci ( a2tr(monu0oetn feilsfaDul(vo () rxnmoctytlaD livs t)trxoir3nu1lpenmfcils)srur( poo1oexomfetydlmDeanvonu)arxnmrcootomtr i s;t srxmxr iydapenlnvtatf Dumxmoot0apto ieiaslm2em( on(4tetnmfcia1opteluvilt  rumir ny4am nmfvta( s2ururooo0olx mf3iat m2ul( s u4altrxr3tydoa elu i;s0t2xoxr3oo1lmeemieiat srtm( poo1opxo i3tasls uan o;u0tlxnir3oy1om ranvi;(  rur(o oudalenlivsasf 2ta(rooo1aex if3tyt aDelu s u0aeermfcto1oa  lneslt0 2ur(r iu1optemfvsltfaDtru  ;o1teeomieias a2uauvont0trtnmo oydomt lueils) ruoio iy1lm nmncsa(  rtrx pnt4tee iocild mDum(mp u0texrxf3ty1fat aivo;t srum(m3no1lm  lfvsls a2rm(m ;u1oexn iciyslsDrm(vp (4tltomr3oytfmD an s;s sexmxmpnu1omt mfes tf Dum(r ;o0texo oeiasla2em(vpnt4alenxo oytopDelu s t srxoirpiy1ameelfeslt s2um(mpoo1aptniieilsfaDrm( o (0alxoxf to1faDraies;(0 exo(o iudomtnlnvia(f Dtm(r no4aexnio3iad aDum(ms u4artoiocoytomDr u o t)trtoimpiydolt mivsa( s2uauronu4tlxn iciydfm2umuvo t4altnxocoytlmDe u ilt0 rur(m no4opt mfvsasfa2rrx  nu1alxoifeils mDeln o;(4aetoxr iotlmD ai o;s  rtrxo oodlltelnctlsf rurxmont0tpe mfciyd a ulu s u4aleomrciydom  lueo s0trumxo nudope mfeilt) rtr( pnt0tlen o3iysfaDrlnvsnt0aeeoxo iatlmt  n i ( texrxopiu4apeelnes sfaDrm( pou1aee mieiysfm rlnmo;(4teenifctytoa elnvsls  rur(m io4lltnlivsat  Drmu  nt4opxo ieiadlsDum(mo;(4alenir ty1lmtrau o;t0 rtmiopny1lp emnciltf 2umu poo4aexnmieiytfaDemumpn(0arenxfcoadfptr i sls0t2uoiopny4lme lnct tfaDur(m nt4aexn o3tydfs rlu s u4 lerir3tatfp  lueslt0trum(r3oy1omtn ivtas)sDua(rpot4olt  fetls sDeanvp u0 exnio3oodop  aivo;s)teto(m nydol nlncilt a2umuro;o1alxomoetyt aDua( pn(0 lxoir oodlat  i slt setmio nydllenlncs tf Dtm(  ;u4tlenmfetyslsDumumonu4aleoxr3oa1op rlnei;t) 2xmxr3nudlp nmnvsatfs2tax  oo4tee  o3iltfaDeaumsnt4texrxo oadoate iei s0 2xr(opiu1lm n ncilt)aDtaxrpot0apxoif3tad s2elnmo u)tlxomr iotlptrai s (0 exoxopiydomt mnct tfsDrau  nu0tetnifciadlsDrl( s;(0arxnxfciy1lmtrlivi;s  etmiopio1lmee neta(fsrtax  nu4olto o3tydls2elumo u0arermf totfmD lues t0srtmimpoo1ll  mnetltfs2urxmpnt1oeto feilslmDea(mon(0aexnio ia1fpDelieils)t2urxr oodolenlietl()aDumuro;t4olxnioeildfsDelu s u0 lxrmocoy1lmt  iei;()srur(mpoodamtemncsa()srum(mp;o0aex moctls mDra(vp;(0tlxoifctydom r uvs;t  etrio3oo4oleelnci s)s2umxmonu0aptomoeilslm2umnmp (4 eenmrcoo1lm   nvs;t  2umxo iy4omtemnvsl( aDumx  oo1apx  f3iltlm2rmn pnt4 rxomf oodoatrlnvi;(0srtmxm3nudlleelfvtas) Drrurp;o0altnmoetlsfs emuvo (4artnio3iatlmt lues (  2umim3iu4olt  nvsls s2rmu ont0tle mfetls m emnvsn()arxrxr iytfaD an o;(0s2urxr3nu1omtn ics (  Dumxmpno0aexn iciat sDrmnvsn()texoxocoo1omDr nvol() 2xoxo iu4am nmieiltfaDtmumonu1tpx iictysla ra(vsnu0teeoioctatlpte i o s)srxmimpoodome  fetls a2ta(mo;u1ale ii3tadls2rmnmp;u4aetoir oa1oa eaues t0 rxr(o3ny1omtemicsa(fa2ta(rpot1apt mo3ildfs rluvp (0aetrxf oodfp rauvs t srtmxmpiu1lmtemnci ( srtaurpnu4optoifeilt s2ranvp;u0 etrxf iy1latelu o s)srxmxmpnodaptemivi tfs2raxm nu1tltnmi3ilt m2emn o u0aetrmrcoydfmtrauvs;t)teto(m oo4opeelivsa(f Dumx pno1tetomo3iltfa uanms;u)arermo3iodfmDeli o ( t2ur(m ou1alteliviat  Dra( p;t1tlx mieiaslaDea( s u4 ltoxfcoytom  ai o ( trtr(rpio4ape mict sf 2ta(rooo0oex io3iydfaDum(vpnt0trxnio3iytoptraivs;t0 2xrim3oudlpen iei t  ruaxrpou0alxnmi3iltfsDel( onu) eerxrcto1lpDrlu sl( sexr(r no4amenmfvs (f ruaur no0olxnmieildlm rlumo u)texoxocia1om  aneil(0sexo(m io4amtn fei s)a2umxr nu4teto iciad a umuvp;u0aexomfcta1omt ln s s0 2urio ny1lltemnvi t aDtrxrpnu1tpx mictytfa rmu p;t4alenxrcoatlpt aivo;(0texoxm oydop elfeias s2urum ;t0oex ifctas m2ulnvp;u0aeeoxrciytfatelnvi;s trxmim3ny4ome  ivtasf 2trumo;o1olxo f3iatlmDel( p;t0 rtnxoctodlmDrli il(0t2urim3oudoleelivs t) Dum(rpnu0aeeo oeias mDemnmo (4 etoif oadomD livi s)setrxr3oy1op   fetas aDuau  no1aptoio3tysfm el(vo () lxnmf iatfmtrlieo t tetr(rpno4lme mfvi sf Dtrx  ;o1tex mietyd mDumuvo;(0tleoxrcootfptrlnvi s) 2ur(r nudol n ivtlt  2ta(m ;u4tpto o3tadfaDeln s u0 rxrmo iodfpDelivs t truoim ou4alen nctat  rumx ooo1tltoif3ildfm ra(vo t0 ltrio todopDrau s s t2to(mpio4ll  mnetltfartrx p;u4tltnii3iytlm2eaumsnt4 renxr io1lp  luvo;s  eurio3oy1amt mieia() Dtaxmoou1oleomfeiadlmDul(mo;u) ltoir3oatopt an il(0tetriopou4ol elnesl( aDtrx  nt4teeo o3iatfm ulumsnt0 eeomf3oadlm ranvo (0 rxm(rpiu4lmtnmicil(f 2rrumo;u0apeoii3ildla uluvp t0aeeoio3tatoptraneo t t2uo(o iu4omt  nct s)arum(r ou0oleo f3iyt s uauvont) lerio iydlp elnvo (  2umxo iy1lpeelfcsls sDuauro;u1opeoifciyd aDulu o u) lenxo oydfate ues;s0teuoim nu4lm  lfvs tf 2tru  ;o1oex mi3iys s eln snt)aexrio tydlptrlueo ()sruoxr3iodap emfeta()aDuaxmpnt4tlx ifeiyslm elump;u0trtnmf tadlptean sls)sruo(o3oy1lp nlfcil(fsrua(m ou4tle ifetldla2uau snu4 eenmrcoy1fa   ies;s) 2um(o3oydol nlict t a2tr(m ;t1optn ociltla ra(vs;u4arxnmo oo1fptrlivsl( s2toir nydapt  ietltf Draxronu4oeto fciydfm emnvo (4arxrxf3iytlmtrauei;t)trxmxo3io4ap n ieiasfsDuax pot4ole mf3tyd m rlnvsn() lxnmrcoatoaDrluvsls0setmxm oy4al nlnvslt)srrru  ot1ope mf3iltlaDrln snt)tetnirctatopDeanes s t2um(mpoudalenlfvs sf rrmumonu4tle mf3ilt a2um( ont4altoir ty1oat livslt0 rumxm oudlpee iviat srtmumont4teeomieiat m2eluvont0 exomfciotopt  nvi;t0srtoxmpoy4ol   ici ()a2tm(r nu4aeeoioeiysfm2rlnvp;(0 ltnio3tydlm elnvo;()sexmxr3no4olt mfvt t)s2ua(ronu1opt  oeiatla2el( p (4aexnir3iotopD auvi;s) ruoxo3iu1oltemivtasf rrmurpnu0oeenmoeiys aDranvs;t) eenmf3totlpDrlieilt) exmio oo4lm nlnet ( s2trxrpnu0tlto o3iyt s ua( p;t0artrir3oodop  lies;s)trxmirpnu1lmtelfesa( a2urx p;t1tlt  ictytlm2ranvpnu0artoxo3oydlm e nvi t0texm(mpoo1amt liet s  Drrxr ;o1tpenmociyslm2ea(ms (0alxnxf iodfm  aieil(0trtoimpou4lmt  nvsa(  Drax  no4oetn fcild aDul(ms (0alxomrctatoatr ueo;t0srum(r oudlp n nctl(fsrtaumpoo0ole iiciys a2ua(vp (0altoxo todfptrlnei;t) exrxopoudolte fei ()arur(ro;t1aetoii3iys m rluvpnu)arerir3iytoa   u i;(  2uo(opio4lpeemfvt ( sDurx p;u0tpxn fetltlaDemums (0alenio tatoaDeaieo;(0sruo(r io4llte nei s)aDtr(m nu0tpenii3ils m rau s u)alxnxf3oadlmtraiei;t)teto(o iu1ol elnci t s2urxmpnu1teen ociyt s2uln o (0arxnxo3oatlmDe ivi;(0trur(r oydapenlfctls) ruru p;t1tpt iiciaslaDemu s;(0teeoif io1lpDe nvslt0 ruo(opiy1lp nmnvsat)a2raum nt0apeo fctlsfs ranvsnu0 reomr iy1opD aieo s0 rxrir nydllen fesa(fs2um(r ;t1opeomi3iasfsDrauvs u)tetnxrcto1fmDranvo s0tetm(rpoy1lptelietlt  2taur no1opt io3iysfmDrlnvsn(4tlxrxfctydlateauvo;s0setrxo oo4lmenmiei t) 2rr(m ot4oex if3tas a2emnmo;u0tltrmocoy1lp  aivs s t2tmxm3iu1altn fcsatfarra(moou0tlto i3ils a2eaums u0 ltomo iadom r n i s)sruo(o3iu4opt  ncilt)arta(ro;o4oeeoifcild aDuau onu)aexrioctotfa rai i;t0sruoim ny1lmtnlfcta(fa2raum nu4aee ii3iltlmDum(mp;u0trerxf3ta1fat  u s s) exo(o3no4oltelfcta( aDra(m nt4olxnmo3iadlm eau p (0 ltrxo3oadlaDe ivs;t0trxr(m3ou4ol nlicia( a2urumoot0open o3iatlmDrau s;u0alxoxf3oy1lmD ai sls) etmir3ou4llen iei ( srum(mont0tpe if3iyd a elu p t)aexomo tydfatran o t  rxmiopny1ame livs (fs2uru oou1tlxnmociytlmDrmnmo;u)aeeoir3oytfat  ueil() eum(r nodaleelivilt srta( o;o4aexomi3iys sDumnms;t)areomfcta1lp elnes;s0texo(rpio4lp elfcsa(f rraxr nt0apeoifctysls2uan s t4 renio oy1omDe uvol(0sexoir oudllee ncs tf 2tm( p;t1teto ociysla rlums u)altnxfcoodlpDe ivi t)trtm(opiy4apeemfei s)srrmx  ou4aleomo3iydlmDum( p;t4 reoio iadomD liei;t texoxm iu1lmte feiat)a2uax onu0tpto f3iad m ranmp t4 eeoxf oytop eauvi s0 2to(r iu1am emfet s  Drax pou1aeto o3tasfm eanmpnu4teeoxf todfat auvs () euoxo3iu4lp  mnvsls)a2ta(mo;t0tpto i3ilsfaDeaump ()alxnio3to1om r neo;t0s2xr(o oo1lm e ivsat)a2ra(r oo1oeen oeias aDranmp t4arenxoctytomDeauvols)t2tmir3oudaptnlivtl() 2ta(mo;o0alx iieiltls umnmo (0treoxocoodlat  nvi;t0s2tmim3iudamtnmfei sf Draxm ;u1tpt mieiydla2umn on(0trtrxoctadlmteai i;t)trxoxm3no4op  lnvsls aDtm(mpnt1oeenmociysla2uaumo;t)tleoio3oy1laD  ivs;s setrxopoo1ame lfct s)srrm(r ;t1alt mf3tatfs2uaump u4aetoxocio1omDrli i;s  rxrxopou4lmeelfcsasf Draxrp;u0oetnio3iydlsDulu pnt0arxrircoytfmt lues;(0s2xoimpny1ap nmnvt t)artrx pnt4tlx iiciydla2ra(vsnt)areoxo tytlmDeai s ( srtmirpiydlpeelictat)a2rm(rooo1aptomf3tyt a2uanmo;t)trxnio to1lm e ieols0 rurimpnodlmenlfetlsf 2rmum ou0tlx miciys sDrmu p u4 reomr3iodomtraneo ( setr(r nydlp e fvsasf rra(rooo4aleniietytlmDea(ms t0aexnmf iytfa  aues ()sruoxrpoo4al emfvs ( s2um(ro;o4tlt mi3iatfa eluvs;t4teerirciydfp r i i ()teto(m3oydaltelfeias)aDumump;t0altomfeils m2uanvp;(4altrxr3todomD aivslt0seumiopoodlme lieils)s2umu o;t1aptn f3tltlaDemuvs;t4trenif todfaDr ivo s0t2xm(o3iy1ap nlnctltf Dumx poo1oex ioeiyslmDem(msnt0 renmf oy1fmte n ilt0 etm(m ou1amt mfei t) 2rax  ou0tpeomf3iys sDum(mo ()trxoxociatlaD  u i s teuoxm3iu1opeemfctatfarua( o;o1optoiietlsfsDea( p (4texrif ta1fpt ln o;t trto(m iydopen nvia() 2tm(  ou0aeeomoeiadfsDua(vp;u0aetrxfcty1fateaivs t trumxm io4olte ieslt) 2urumpoo1aptoio3iadfmDeauvp (0trtoirciotlmtr u i;(0 2xoxr3iu4optn ivtatfsrraur ou1opxnmoctas m2ean onu4alerir3iytfpDelueslt srum(r3ny1ameelicils) Dumu o;o0tpx iocils aDumnvonu0aleoif iytop  au sls  rxm(rpoy4ale lncs t) rua(rp;o0alxnifeiad m2rmnms t) rxoxf3totlmteai i;s0srxr(r3nu4op elicslt)sDrmx pou0ole mictlslaDum(vs;u) renmrcoodopD lieo (0s2tm(m nu1apt mnct (faDtr(r no4teeo feildlsDemn o;t4arxrmr3todom eauvs;s)texrxopnudal nmfesas s2rru poo1alx miciyt s rmuvonu0 rtrmf3tatfptrln i (0t2xmir3io1olenmfesat)a2ur(  ;o4altnmf3tatfm2emump (0 rtnir3iadopt an il()trxo(o3oy1ol   nvs sfs2rmxroou0apeomociysfs2ulnmsnu)aeerxo3oydlmteln ols s2tmim io4lptelics t)arrrx poo4apt  o3iadls2uln s u0tlxrxo ta1la r n i t  rto(opiu4lle  neils)s2urumono4apenmfeiysfaDulumonu)aexnircoydfaDr uei t)s2tm(r3no1ameelies t  2rm(rpno1opeo fctadfm2rluvs;(4arxoir todoat lueil() rum(o3ny4om nmnei () ruaur ;t1texoiiciltfs2rl( o ()alerxf3iy1omD lnvo;s srxmxr no1ll  lnetat) Dtr(mp;o4aeto ociatls2el( snt4areomo3iy1faDeau i;()s2tm(r3ou4amt micsas) Dumxmpou0openmi3iadlmDulnms t)artrmo tatlmteai sl()sexo(opiydllt lfvias a2rrumoot4oltoioctatlsDemu s;t0aetrmociytoateauvils0trxoxmpoo1op elnci sfsDrax onu1openio3tytlm elums;(4 ltnio3iatlp eanvs s) 2toxmpio1om   ncil()a2taum ou1tpxnmi3iatfa2eau snt)tleomfcio1omtrlivi;t  2xoxo3oy4alenlnviat)s2rm(m ;o4oeto fciltlmDulu sn(4 reoxf iodfateluvs;()s2ur(m3iu4lme licslsfsrrrumpnt0aexnio3iadfaDul( o;(0altrxo3ia1faDrau s;(  etoir3nydll nmnetl(fs2tm(r ;o1aetnmictydfs em(ms;t) etomoctatla rlnvi;s0 rumxm ny4lmtnlneils a2ta( oot4teeo o3iatfaDrl(vs t4 lenxocoa1opDrlnvo s0texmim ny1ole mfct s arrmxmpou4tptn f3iadla ran s;(4 rtrxo3ta1fa rlu s;t0trum(o oo4lmt lieilt srrru  nt4oexoif3tatfsDel( pnt)tetoxf3iadlmteauvs t0t2xrimpiudaltnlicia() 2trump;u1alenio3iyt mDua(ms;t)texnir oytom rau o;s trur(m3ou4llt mivtas arrrxront0alt mfeiatfa2em(vsnt0 rxomrcoydlpteln s;( trtr(mpoy1amt  nvs tfartmu onu4olt ifctlt s2emn p;t0altrmf iy1la r ieilt)s2tmxr oodom e ivsl(fsDtrumont0alt mictlt aDeaumpnt)arenxrciy1lpte u s (0seuoiopnudlmtnlnvilt) Dtm(ro;u4aleoioetltls elnvp;u)alxoxf3tydlmD aneilt0trumirpoo1lpt mfctat a2raump;o1aeeomociad a2ul(vo u0tlxnmf oydoa   iei s teumxr3iudlmenmncs t)aDtrx poo4optomfeiyd a2umnvsnt)artnir ootfmD aivs t  exoxr3iy4lpen nvsls)srumx pnt0tex if3iydfs rluvp;t4 rxoio ty1omDelu o;t  2xr(opoo1lptelncsat)sDtmuronu4olxoiociad a2raums () reomr3iatfa elivs t srur(opio1alenlfctls)arumx pno0tee  f3taslsDelnvs t0texoxf3io1fp  aieil( trtmxm iydalen feslt  2tmur ot0ale ii3iasfs ulumonu4 exrmr iatfpt aivi t tetoimpoy1omeemfeias) Dtrurp;t4olt  ieiadls el( ont0trxrxo3iadoatr uvi t  2uoim iodaltelfct s sDta(r oo0ope mo3iltla2uanvs;()alxnxr oadom r n o s seur(m nudap emfeil(fs2umx  no0texnifetlsls ua(vsnu0tetnirctatop  aivi;t t2urio ny1olenlfet ( a2raxmooo0texnio3tydla2rm(vsnt4altrmrcoo1fpDe uvi;() rur(m3iodlmenlfes sf Dur(r ;u4alt io3tysls2uan o;t4teerif3ty1lp eanvi;t0seuoim iydomtemivsat aDtmuroot4tltoioeildfa el( snu0trxrifciytlate i il()t2uo(r ny1ole livta() 2rm(m ou1ape  ieias aDelnvo;t)alenxocootlmtr nvs ( seurxr nu1amt  fvta(farum(  no4apx  o3iatfsDem(mo;(4 lxnxo3tadlm  aieslt)sexm(o ny4llt  nvs t)s2um(ronu0teenioetyslm emu ont4 lenxo3tatfm elneslt) 2tm(r3oy1ap  miesls)arrr(mpoo1tltnmictaslm2emuvp;()alerxf ia1omtr n ols0 rxm(opou4apeelnesa( aDrrur nt0tee  oetld s ulu p t4tetrxo3iotfpte ivol()t2urxr3ny1lp nlfei t)s2tmurpot4tpen oeiyslmDrm(monu0 reoxo3ia1lpt lneil(0s2toxo3oo1lp n nes s sDrmumpoo4ale ioeiatlm emuvo;(4tlerxo3oy1oaDraueil(0t2to(m nudame  ici t)srtm(mpou0aee  feiytlm2umnvpnu4tlenio tytfpD  nes t  2urir oo1alt mnvi ( aDtauront1tpx  o3iydls2raump t0areoxfcoadoat li il()s2trxrpnu4op emfeiasfsDtr(mo;u1tltoioeild m2uln pnt) ltoxf iadlp ran o s0 2xmio iodlm  livtls)aDumurp;t1tetnifctyt sDrau snu4aeeomf to1lateanei;t)s2xr(r3iy1op emnesl()aDta(m oo1olt  o3ilt mDuanvpnt)alerxf3iadlp eanvi s srtriopno1om nlnei t) Dtaur ;o0apx mi3iytls2eln p t0trxoif ta1lat  ieo;( srtm(r3no4ope lfeia()aDra( poo4tlxn octyslm eln s;u4aexnmr iy1opDe uvi t s2umirpny4am emfvslsfa2tmxrpnu1tltoioeilsfm2ulumsnu0aexnmr3tydomt luvsl( t2trir ou4ape mncta(  Dta(rooo0oeenmfctas a emn p () exnxfctodlp eln s ()t2urir3iodop emfvil(  2ra(rooo1tlt mfetas m2umu o;(0 rerir oadlaDran o t0 exrxr ou4lp n fvslt arrmxronu1teto oeiydlsDel(mo t) eeoirctydop eaueo t t2to(m3nu1om   fvsltf rumurpot4ole mi3iadlm2rmumo;u)aetrir iy1fatrlivs;(0 2to(m ou1optnmivt s sDtr(r ;t4tpeomfciadla2em(mpnt) etnir3todla r uvo;t  rtmxopiudam e nes sfsDrr(m ;u0oltn i3iydlm2el( onu)tetrmfciatlptr nvslt  rumiopoudolt  ncs (  Dta(rpot4olx  o3tysfsDeanvpnu)alerxocoatfmDe i i;s) 2to(rpoydole  nctl(f rtmxro;t0teen o3iys s rlnvsnt4teenio todfp e ivs s0sruo(m io4om  lnciasfa2rax oot1tpx ii3iatfs2rlnmsnu0tlxnxf3oatoptraivi s0t2tmxopnudol nlici (f rrrur ;u1alx mociaslsDemnvo;(0 rtrxr3tydlateanvil( trxrio3nodal e nctas)sDtmx pno0tex mf3tltfaDel( ont)trtomoctotopD au o () 2tr(m nudopte ictlt sDrrx onu1tex mieilt mDrauvpnt4trtrio3iotopD luesls  2xmxrpiodamte netatf Dtrx  ou1opeo fciyslaDumu p;u0 lerxrctydoateau i (0srtr(rpny1lp  mfvt (faDtm( o;t4aexn ietatfmDumn s ()aetnioctydfmDe ueo ( srto(m ny1lptnmnetasfs2ua(rpoo0oexo ieiytfsDua(vo;t4 reomrcta1om  lnvs;(0 exrir iu4ap nlnvi sfartr(mpoo1tee ifciadfm2rl(mpnu0 renirciatlpt lnei;s0 2tm(r nudap   fcs ()a2tmumo;u4tlenio3iydfm emnmo;(0aexnmr3iytfm e uei;(0t2tr(rpiodolenmfesas) 2um(r ou4aptomoeiyd s em( s;u4areomr iotlmte ueolt)srtmxopou1ap e fvilt  Dururo;t1opx iicild a uan ont4aetrxfcoydomDelnes;(0t2xo(r3io1ol nlivta( arrauroou1oexo f3iys s umu p;t0artnmocootlpDeau sls srtrir3oudolee nvilt  rua(mpnt1apenifciltfm2uluvonu)artrio3oo1oa r neo ()t2xmirpoo1amee ieiltfsDtau p;t1texnmi3iysla2eau pnt0 lxoxrciotfm eau ols0 2uoxo nudlpenlnesl(f 2uax  ;t1apx  o3tls sDrm(vs;t4tltnir3io1laD  uvil(0 2xrxr iu4amtemfci tf Dtmum nu4tpt ifeilslsDeaump;(0aexoxo todom raiei t)s2trio iu4ll e ietlt s2umxrpou0aeeo f3iyt s ranmp u0altnio3to1fptelnvs s0srurio3ny4ameelieia(  2ur( p;o4opeo octas m ua( o;u)alxnxf3iotlp eanesls)srxr(mpou1al nmfcia() rtrur ;t1oeto fciat s emn onu)alxrmr oodla   ueslt0setr(rpoy4altnmncil( arumxm oo4tpenmfcild sDelnvon(0arxomo ta1oa  liesl(0s2tmxrpiy4lle  ivs s)srurxm ot1tlt iictyslm2uau pnu0tlxoxf ta1omt  u o;t) rtoirpou4om nmneta( a2raxront4oet  o3iltfm2ea(vo u) ltnxocoytlpDelnvs ( s2xm(o iydllte fcil() rrr(ronu0olxo i3tlt m rmumsnt4 reoxociydlaD aieo t  etmirpiydoptnlncs (f rtmuro;u4opx mi3ildfmDrl(ms t)treomoctatlate neslt)trxmxo3iy4ol   netas s2rmur nu0oee mfetltlmDrmu p t)aetrmrctotlptr u s;s0 exoiopnu4open ncsltf 2umx ono0opxnmictltfm ranvp;t4 lenxo iydlaDr n s s  2tr(mpio4ll  lici sfsrua( o;u4opx ioetydfm2ua( sn(0 reomoctotla rlnvolt trumxr3nodaltnmivtlsfaDtrur nu0apxoifctysfm2rmnmo;u)artrxfcoodoateaues s)texmxr3oudamtemfctl() Drmur ou4optoif3tyt m2rm( s (0tlxoxo ta1laDr uei;t)truoio oo1amte ietls) rua( ooo0optomo3iytlsDua(vo (4trerxocoodoa eanvi (0t2xmxm ny4aptelnvtls aDrm(r ;u4opx mfeiytlm uaump;() exrxr totop  liei;t0sexo(m oodol emnesl(  2rmum ;t4teeo f3ias mDea(vo;u)trenmr3oydlp  li i s)t2tr(o nu4lme lnviatfsDur( ono0optoif3ils s raump;t0tlerxr iytomtr ivil(0t2tmxo nu4aleelneiatf 2taur no0oetnio3iydfmDrlnmon(0arerxf3ia1lpDe n s s0sexmxrpnudoptn ietl(  rta(mo;u1alxomocilt aDemump;t0trenxf3tatoateln o;s trur(r3iu4lpenmfes ()aruru o;o4apxoio3ildla rm(vont) etrir oatfp   ueo;( trtmiopnydlmtnmnesls) rrrxmpoo1olen o3iydfmDrm(vs;u4trtoio3oadlpD  nvs s0sruoio3ou4omtemnvtatfaDrmxro;t0oeenmocilslsDrau snu)tltrif3tytfaDean o;t  etoim ny1al n ieil() ruaxronu1aet moctys sDuau s t0 lxnir ty1fpte iei;()srxoiopny1alt  feiatfsDurxmono1ole ifeilsfaDra(vo;(4alenmo iodoat  ueo;()s2trimpoodole lies sf rtrxrp;t0alxnio3ilsfsDum( s () leomfctadfpD aivs t  2xmxo3iodomt  ivilsf 2trxmpoo0tetniieiatlmDrm( o t)tlenmr iydla raivs;()teuo(r3oodalte fcs t s2tr( pno0optoifciysla2elnmpnu4tleoio3oydopt anei t  2urxrpoo4ame  feslt)aDraxmoot1apxoio3ilslsDea(mp u0artoxrciadoaDrlnvi;t srxoxm3oy4aleemfcs tf Dtrumpou1apt moctasfsDrlnmsnu4altnir3io1oaDe ues;t)s2xoio3nudomeemnctltfs2ur(r no1ole iiciatlmDem(vpnt)arerxf ootfaD  nvils  rxmio3iu4apte net s)artrx onu0optomietadfmDranvs;(0arxrif ty1fmte nvi;s)t2ur(mpnodameemncsa( a2um(mpnu1optniociytlaDrluvo t0arxnmr3oadfmD aues;t0t2uoir nu4lltnmnesasfaDumumonu1olt ifctydfa em( p t)tleoir3ootfmD auvo;(0seur(m3iu1optnliesa( sDuaur ;o1tex  ociltfm2emn p;t0trxnxrctadomtelueo t) 2toxm nodlpe  nvsa(fsrtax  nt4aet io3tyd m2ulu s u4 lxoxociodlaDranesl()texoirpiy1ame lict s)s2ra( oot1tex ifctadfm2rmn p t) exoif oa1lm raieils0s2xmxr oo1ome lnvtlsfsrururono0tlt  ietasfsDemuvpn()tetoiocootfaD luvs ()sruo(m no1al n ivs t sDtmxmpno4tlt moeiltls emuvs (4 renmf iytfptrli o s)trxoio3iodap   nvs (fsDtaum ;u0olxn oetasfm2ulu snu4 etoir ia1fmte nvs t  2ur(m3iodom elfvias)a2tm(m ou4oetomietad a rm(vs;u4 ltnxfcoytfmD  nvi s0trtm(m3oy4ope mncia(f rtax  no1aeenmi3iadfa em( p;t0trenir3iodopt luvi t0 ruoxrpou4om  lnvtlsfsrtaxmpot1tpe mf3iasfs2emuvp;u0arxrio3ta1fmte uei;s sexrxo nu1omt lfvsl(faruau ono4alxnif3iydlm uauvp (4trtnir iytoaDeaivslt0srxoxm3nydlpt  fesltf Dtauronu0tlx iociatlsDrmnvo;t4aetnirciatlp elieo t) 2urim no1omtnmfcsa( aDrau o;t0opxnmietys a rlnvp u4teenmfcoatlmDrai ol( t2umio no1optnmieilt  Dtr(ront4tpe  o3ilt a2rmu o;t4texomf iadomD auvi s)t2tmxmpoudlpe  nvtat sDrmxrpoo4oetn oetas a2raums (0trtomo3oadomDraivils)trxrxr iydom e iviatf Drm(  ;t0oee  ociltfa2eanms;(4 rxrmfcia1oatr i o t seurxr no4alenlfcilsfa2umu p;t4opt iicias a2elnvo u4tetnif tatlpDe uesls)t2xm(m3ou4lptelivi (fsruru  ou1apeoifeiadla uluvonu4aetoxf to1oatr u sl( teuo(o oo1ll  mfetl()aDrmumpnu1apt mf3iltfs2rm( on(0aetrif iodlaD auei s s2um(mpno4ole livsatfartrumoot1optomieiltfaDea(vs;t)texrxf oy1lmDr n s;s0s2xm(o3ou1omee ieiat)a2tm(monu0apenifeild mDul( pnt) lerxo3io1fmt  uvo s) 2xm(o3iy4op  mfetltfa2uru pno4tpeomicilsfaDul(mon(4 eerxrciodfaD au s s0trxrxm nudam e fvsls  Drmxmo;t1oexomfetldfsDeaump (4texrir todfa eanvo;t0s2urxrpny1lm  mfesltf 2rr(mooo0texnifeiad a rl( s;u0 reoio oa1lm rlieol()t2uo(r3iudlme mnetls  rtr(rono4alxnmfeilslm2umu p (4 exomf oy1oa  lnvs () etoim ou4lltemnet s) rtr(r no4oee  ieilt m ra(ms;t4 rtomf ta1fp r uvol() rxriopiu4lm nmfcs t)s2um( p;u0apxn ociatls2eaumpn(0aleomr io1op eaieol(0srtr(m oo1ale lnvta( arra(  nt4tpt miciat a uanvsn(0artnmr tydomtrau o (  euo(o ny4olte ieilt sDtrurp;t0tex miciytfmDulumo;(0alxrmo iy1fpD livs;()seuoirpno4lp   fcsat)a2trur no1apx  i3tysls2rmu o;t4treoxfctatfptr ies;(  eumxm oo1ameemfetasfsDuaxrpou1texnmiciad m umu s;u0 reomrciatopDrlies ()t2xmxopiu1omt lnvtlt sDrmu p;u4olt iociltfa2um(mpnt4 exnmf io1la  luesl()t2urim3iodop  lnet ()aDuaxr ;u4olto i3iydls2emums u)aeermo3oa1laDrau ol( tetmio ny1lp n fes tf rrmxmooo1aexniieiat mDrau s;t4 rerifcoatomDeluesl() etr(o3no4oltnmiei t srtrxm ot0apeoifetytla2rl( snt0 leomo3ta1lm   ues;s  2umirpoo4opt  nvils)arum(  no4tltnif3iasfsDumuvo t4aeeoxocootfmDr ivo;s  euoxrpno1aleemfesas srtmxm ;t1tet  i3iadfm2rlu s;u)tlxrxo iydomtrlneo;s0 rtrxmpno1lme  ies (fs2rax  oo1tltnifciadfmDem(vs t)aexnxr3iatlptrln olt)truoirpoo4lpenmfvtlt) rrm(mo;u4apx iieils m ranms;()teeoxoctotfateauesls) exrirpoy1ll elfes t aDtru  ot4apt ioetydla2eauvs;t0arenmr totlp eau o s)trxoxrpiu1lm elivsat a2raurpnt0apto ieiyd m2emnmo;u)aexoiocoo1late uei (0trto(o no1olenmivilt a2rmxmo;t4altoifcildfs2rln onu0trenxo oodlmD an s;s trxmir oydope mnci t aDrrxmo;t0oexomoctytfm rmu s t0areomociy1fp r nvo s  2to(o ny1amt  feiasf rraurp;o1tptn ociysfa rmuvp;t)aeeomo3iydfp eauvs;t0trtrir3iu1ol  lnviasfs2tr(r ot1apenmoetltfm2eluvsnt4tltrxo3oytlptraivs t0sruo(r3iy4opte ncias aDtm(r oo0altnmictad sDeanvp;u4 lxoxrctytlmD lueol(0setm(o iy4lpeemnes s) Draump;u0teto o3tlsfm2rm(vpnu0tetrir3to1om rlivolt) rumir ou4optelivi sfarta(rp;t0teto oetas s2rlnmpn(0trenir3iadomtr nvi;s0 2tr(r3oydom   icsat)srtmxr ;u0tetoio3tys a2ra(mo u) lenif oydoatean o;s setriopiu1lpt  nct () 2tr( oot1aeen ociadls2ea(mp () rxrirciy1oaD lnvilt) 2xmxr3ou1al n iei (f Dtau pnu4tet  i3tyt a uau onu0tlxrir ootlpDrluvo t)srxo(rpiydlpe mivsls)a2ra( pot4texn ocild m2emuvp u0tetrifcoytlat ln slt  rxr(o3ny4apt mici sfsrumx pno1oex iieiydfa uau p;u4 exomrciotfm r i i s) 2xmxm3nu1lpenlfctl() 2trxmpno1teeo icildls2uanmo;u4arenio3oy1lmtrliei t s2um(mpiodlmtemivtat)srurur no1oetoiocils m eauvs (4aetnmo3oydoatr ieo;s0 exmim oydolee nci s)aDtmx p;o0tex ii3iat a2em( snu)teenxrciatoa e ivi s) rxmim oy4amtelivs (f Dtrxrono0olt ifctytfsDuln on()tlxnir ia1lmDe nesl() 2urxo nydam elfeil() 2taxmpno0apen ictltfm rl(vo ()altrxf tatfptr n ils0sexoxo3oydop e ncilt)srrr( oou1tlx  o3iat s rmu on(4 etnxo3oodopD lieo;t tetmirpny1ap nlnvt (f 2rmx ooo4tpxniicildfa ea( pnu0artnmfctatlaD an olt0setrxo3ny1ll  mnct tfa2ra(rpno1tpeoifctyd s ra( p;t0arxrif tatfa  an s s  2tmimpno1omenmiei s a2umurono1altoiiciytfaDumnvo t0 lenxocia1oa  luvilt srtoxo3nodllen fesa()s2rax oot1texn oeild mDran o;(4 exnir tytlmD anvols trumxopnudlm   icslt)aDra(ro;t1tlxoifetadfaDumnmo t0alxrmo3ta1lptelu o;t0 2toiopoo1lmtnmfcilt aDrmxmpnt4tpt  i3iadfm emnmp;(0 rtnio3tytfaDelnvo;(  eumir iu4lptemfctl( s2ra(ro;u1tlxoio3tydlmDua(vp;(0trxnxr3todoptrlnvs;s0 etoiopoydopt  netatf ruaumo;o0tex ioctadfs em( o;t4trxrmf3iydlp e uei;t0trtmxr3iy4lle lfvtls srtrxrp;t1oet io3iasfm uln p t0tetoxocty1omDranvsl() etr(opnu1ll nlivsl() rrmxm ot4alxoiieiydfs2ulumont0tetrifcio1oa eluvs;(0t2triopnu1ale mivsa()a2uaumoot4aleomieiaslaDumnvs;u0tlxomo oadlm e nvsl( t2xrimpiydop emivtl(f rrrum no0olxnmf3iadfsDrmu sn(4 lerir3tatomDe u o;(0teto(m oydll emiei sf Drrxronu1aetomo3iyt sDulnvpn(4tlermr3oy1lp elnvi;t0 exriopiy1lle mfvias)sDtr( pot0oexoio3tysfmDeanvpnt0 rxrxo iy1oa   ieils)trtoxm oo1lm  lics (  2rm(mp;o4tex iieiytla elnmpn(0tlxrifciatlm rai i t) euoio3iy4lm  lnvt () rraurpnu4tltn oeiasfa2elnvsn() etoxrcty1la eauei;t0 2tr(rpoy4ol nmicil(fsruru o;u1oet if3ils m2rlnmp;t0arenif3iytomDrlies ()tetr(o3iu1al n ieilt arra(m nt4tex ifetasfa uanvsnt0tltnxo totlm  lnes;(  rtmxo nudll emieia(f rtmumonu4tltnio3iytfa rlumon()artoiociytomDraneil(  rxr(m3nudll n fesatfs2ua(mono0open i3tlsla2elnms u0 rtomrctydlaDrlueol(0srumio oudap n net (f Dtax  nu4tlxoifetyt a ranvs (4aeerirctytlpDraiei () eum(m3oo4amen fetlt)sDta( pot4tpt ioeiydfm rln p ()tltomo ty1om rlieols srtoir3iy1lm  lies tfa2ta(m ot1tlt mfeildlaDumnmsnt0 rxoir3todlmte ieo t) exm(opiy1ll emnci (fsrumum nt1tle ioeias a ranvonu) lxoir3ootfa e ies;t trxoxm ny1lm nmnvt ()sDumum ot4optnmiciat m el( o;t)arxomr ty1omtrau i s)trtoxm3io1ll   fvt s  2uau pnu0tpxn oeiatfm eauvont)trxomo3ty1fm rlu ilt0texmimpoy4lm e ivils  2umurpoo0altn i3tydfaDrm(vo t) exnmr iadopte ieo;s seuoxo no4lltn nci s)sDtmxm no4oetoio3tyt sDumnvp;u) eenmo ootlaD  ueo;t0srumxr io1amt  ncs s  Dtr(r ;t0oexoio3iytfsDelnvs u)tlxoirciy1op eaues;s texr(opiudame  nci sfa2ta( oou0apxnmoeildlm el(mo (4 eeomocto1fat luei t t2tm(o3ou4alee nes s)srraxmp;o1aleoioetadls2em( sn(4tetnmrcootopDrli s;t  euo(o iudap  mnvil(  Dumump;o4oeenmfciyd mDemu s;() exomo3tydla e nes s)texo(o3no1am   fvsl() rraump;t0aee ifctas mDea(vo t)texoxr3ty1lat  uvi t0srxm(rpoydlpe lfet t)sDuru pno4ape  ociyslm2ua(vs ()areriocoytoaDelneilt t2xmir3oydomteliviat)aDrrxmpnt0alxnii3iyt s ua( sn(0 exnif io1opDrlu o;()t2urxmpoo1am emneta() 2trur ou0tpenifetyt s uanmp u4trtnmf3oodlm e i o;s0trtoxopiy1lmeelnvils arraurono0apen o3iydlm ua(vp;t) rxnirctytlp ranvi;t0 rxoxo3nu4ll emnesl(f Duax  ;o0tlto feildls2rlnvpnt0alxnmocia1lm rlues t)texo(r3ou4om emnes ( a2tmxmpoo4tlt mf3iytla2umn p;u0 eeomfciotlm   neolt tetmxr3nu1ape mfvtl( a2urxrpno0olxoifcild aDrm( sn(0texrir ty1om   ieo (0t2ur(r3iudlpt mfvtasf 2ua( p;o4olxo f3iydls rmumo;t4tlenmocoytfatrln s s0 2uoim iu1omenlivils)aDumxronu0tleo fctadlaDuluvp;t4teeoxfciotla e nes;s)s2xr(o ou4ape  fvtlsfs2trur ;t4teenifeiyd mDumnvp;()alxoxociydlpDe i olt sexr(rpnudope mncils  2umu pot0aet  oeils mDelump;(0artoxrciotomte uvi ()trtoxrpio4ap emnvi s)s2rr(r ;o0opx mfeiyd sDul(mp;t) lermocoo1fatr n slt)teumir ny4ol nmfctl( a2rmur ou1opto feiadfm eau pnu4trenio3oa1lmteluvilt) exrim3nu4llt mfcs ()srurxmp;o1alen i3ild s emums;u4trtnxfcoo1lpt  i i (0s2xrir3ou4apenlfvsasf rurx p;u1aeeniictldfa2elumsnt)aexrio todomt  n i (0 2ur(m iodom nlivs ( sDrrx pnu4tltn icildfa2rl( p u0aleomf oy1la elueolt srxmxo nudom  livsat  2umuro;u0olxoii3iaslm ul(mp (4arxnxrcoytoa raneslt t2xoxm3iu4apen neil() Duaur ;t0tlx mfctydfsDelnms;()arxoir3iydoptraivsl()trxrxrpnu1opeemneilt  Drrur oo1alen octasfs2ea(mon(4alerir3iotlmtr neilt)t2tr(r3iodap emici s srraxmpou1tlx moeiytlm ul( on() rxrxr iotoaDeln o;t trtmxrpoo1lm n ivilsfaDumumpoo1ape  oeiadlsDrlu o t)trtrio todfaDean slt0 eumim oudlptn icsas a2ur( oou1tpe  fctltlmDrmuvo u)trtnxr3iadfaDelu s;s  2trxm3ny4op elicil(  2rru  oo1olxniieias a2rm( o t) lxnif3todomteai s s  2tr(rpoodal  lnvs s) 2rm(r nt1alt if3iyt mDemn o u0 eeomf3iotfmDrlneo ( t2uoxr oy4optn fet ()a2tmxrpoo1tpeomfetls a2eaumpn()treoio ia1opDeai i s) rtrxo ou4aptnlnvi ()sDum( p;t4opx ioeiat m2um(vp u4 exrmr3oadfm  an o;( texoio iu1om  mfci s sDtaump;t4tpt mi3iadla emn pnu)aeeomf todla rln i s)t2uoxm oodalenmfct s) Dur(rp;t0tlxnioeild m ra(vs;t4trxrmr iy1omD  iei;s s2to(mpoodale mies () 2uax pnu0tlto iciatlmDemumo;t4tlenmociotfp   neilt0s2urxr3nu1ole mieia(  Dumu  ot4tet  o3iys m2ul( p u4aexnmrcootfpD  nei s0trtrxo io4olen nci s)srua( p;t4alx ii3iysla2ul(mo;u) lerir3ty1faDe ivo;(  ruoiopiu1lm   fvils)srum(rooo0ole mfcils s2eauvon(0trerxo3tadlpDean ilt)t2umimpoo4al n feias)sDumu  oo0olxomietldlmDel(mo () etnmf totlpte i sls)srur(r nu1om e fcta( srra(  nu4tlt  ociyd a rmu o (0trtoir ta1fpt auvi;s) rtm(r3iu4om   fes tfsDtrurp;u1altn feiltfaDrl(mpn(4 leomr oy1oatraueo t srtrxm3iy4oltnmiesas sDtrum ou1alt ii3iadfa em(vp;() ltnxr3oadopte ivi;t  etr(o3no4am nlicia(  Dumu  nt0tpenmfciasfsDel(vo;(4trenmo3todfa r ies t t2uoiopiu4lpte ivi t arrr( pot4olt  octltfa2rmn pnu0artnxo oa1lmt lneo t  eumxr iudll n fviat s2ur(r oo1aet  fciadlm2uau p (4 eeoxo3ootlpDe i o;s0truoio3iudaltnlfeilsfa2ur( pot0tlxn i3tat sDrmuvo t4aetoxrciodlat ln o s) rum(m nodolen netas srumuront0opxoifeiaslaDrauvsnu)arxnif tadomt lieolt)t2xr(m3iudllt mfesltf 2trxmono4aptn ociatfm um(mo t0trxoiocto1lp e n o s0srumxrpiudomenmfcsl(fa2taumpot0oee mfcilslm2el( p (0alenif3oo1op e i ols0s2xmim oo4ole  fvias)s2tmurpoo4aet io3ias mDrl(ms ()alenmfcio1omtraivo;s  2urirpiodame mnvtl() Dtm(r ot4tee  ieiytfmDrlnvo;t4tlenmrcootlpt  neslt t2xrir nydale mivsa(  2ur(rpoo1tltoifcias m2rm(vs ()trxoir ta1lpDelu ils0t2xr(mpiy1lle  fes s  Dua(mpnt1oetniicilsfa eanvs;t) rtnif to1oatr ieo;s)t2uo(rpiu4omee nvsls s2tmur ;u1oexnioetyt m eluvonu4tlxnio iydfmtraies;s0s2xrxo iudlpt mnetat a2ta( p;o0opxnifctyd sDelnmp;t0 lxrmf ootop rli sls sexmim oydolen nviasf 2urx onu0ape iociat m uluvpn(0aeeoir3oo1fmt ln o;( trxmimpny1am  mnvt s)a2taxrooo1optnmfeiyslaDranms;t4 rtrmr3iotfa raiei s)sexoimpoy4ap nmietat  2ra(mpou1tex mfctatlsDulums;t)trxrmrcty1lm eai o;s0t2uoxopiu4olt lneta( a2rmump;u4texnmo3tldlmDelums ()texnifcto1om ean i;s)teuoxo3iy4apte ivtl() Duaxrooo0aexomi3iydlm2uauvs (0 leoxo3oodom  luvs ()seuoxm nydol  lncia() rrr(  nt4tpt  ociat mDuln s;t0aleoxocoatfatranvi;t0setoxopiudal n iei sf 2taurooo0aeeo ictysls2ul(vpnu4teerxr3iydopt  n ols0 2uo(m no4apte fvilt srtr(rpou4oltoio3tydlm2ranms;u0trenmf3iadfp   nei;t0sexr(r3oo4lmee fvils  2rr( onu1tlxnmoeilslm uau s t0tltrifcoatlaD  u o (0t2xm(m oo1ameelieil(f Dtrum ot1oltnio3iydfm ulumo;t4alxnmfciodoatr n i t) 2xoxmpiu4ameemnctls)s2tmumpoo1aleniictadfa2el(vp;(4trtrmo3ta1omD anvolt)trxmim oy4lp n iesl(  rurum ;u0tlt moeiydls eauvs t4trtoxocoa1lp eaieils) 2trimpnudlpeelici (  rtrxm ou1tptoioetltfmDeau s;(0artoio oo1fm raneo (0 2tmxo3nudllt mivs t  2urxro;u0tetnmi3iasfs2elnmsn(4trxnir3iytfp  ln sl(0srur(m iu4am   fei s arurx oot1oex  octadfa2rmn ont)arxnio tatfp eaivols trxo(mpoodame lfeta( a2umxmont0aeeoii3iaslsDrm( p t4 rxrif to1lmDran i;t s2uoio iodlp nlfviat  2ua(mp;t0apt  f3iatlm2rln o u)trtrxf3iatfat lnes s)s2to(o nu1apt lfet ()s2rr(  ou4oltomfciysls rl(mp;u0aeenmfcoytlp  aies t t2umio oudlm nlfvs t aDtr(r no0tpxomociytla rmumsnu4arerxf3oytlpDrlueols)srxrxm3iu4apenmfvs ()s2rrumo;t4teeoiocilt a elumo u0 rtomrcoa1latraiei;t t2tmir iu1lmtn fvtls)sDuaxmonu4aet moctyt sDrmnmo;u4tleoxo3iadla rau i;(0s2xrxrpio1ap  lfvtl()s2ua(rpoo4teenmfciydfaDea( sn(0 etomocootopDeaueil( s2ur(o3oydol nlici s)arua( pou1texnmi3iydlaDeau p (0 reoxfcty1fm  an s;(0trurim3nydape mivtat) 2ur(mpnu1opxo o3ild a elnvs;u4 lermo3iatfpD aivs;( trtmio3iu1amtemneils aDur(r nu0aeenmo3tls sDuaumon(0tetoxf to1omDrai slt seur(r iu4lmen neia(f Dtmu poo4oex  ociyt sDem(vp u0trtnmfcoy1op r n o;t0t2trxmpny1omtnlieilsfsDtax  ;o1aptn f3iasla rlumont0 lermf iydlatr ieols  exoxm iudlpenmncilsfaDrmxmo;t4aexnmi3iltla2elnvon(0tltnio3ia1lmteaueilt srtmxopoy1lmen icia(  rtr(  ou4apeomf3iadfm rl(vo;(0aeermo ty1laD  u ol( t2xr(mpoudol n fvt sfs2trxm nu4tleoio3tldlsDrmnvp u) rtnmrcoydop r i il(0seuoxrpny1lpt  nvt sfs2ta( o;o4opx  i3iatfs2ea( o;t4 lxrio oatfmD anes;t)tetrirpoy1am e fes t srtaumonu1aet ioeild a2uanvs u) rerxo oydlaDrluvi t0s2xr(m3iy4lme mncta(f Duru pnu4aet  feils m ul(mp ()arxoiociodfmDrln olt)srto(r3iodamt  fctlt s2rrxmonu4tee  f3tysfa2eauvonu4 exoxf3io1om rln o ( srtrim nu1ol elncsa() Dum(mpot1altn ieildfaDel(mo t0aetnxfctydomDrau ilt) 2umio oy1op  lnvias)a2trxmo;u1apxo iciys aDrau p;t) etnxr ootfpt  uvi s texoxo nu1ope lfetls)sDua( o;o0tleoiieiydfm2ulump;t)arerxfcoa1lmD aivolt0 rtrxmpoo1am n nvtat aDtrxrp;o0optomiciyt m2ran o;(4aetrio iydfateluvs s)srxrim3oy4omt mnesat a2taum nu1openmietatfs2emn snu4arxrxo totfatrlues;(0 rxrxo3iudlp emnvsas srra(  ot4opeoiociydfa2rlu p (4tltnir3oytop  anes;(0s2xrxr3nudoltn ivtl(f Dtmx pou0aeeomfeilsfm eau o;t0aeerxo ootoaDrai ols sruo(r3iodoptelfeta() 2rm(rono1tlto icild sDrlnmsn()texnmf oo1lptr neil()sexmxo no4lme mfvias)s2ta( ooo0openiictldls2umuvp (0trxnif oydfpDraivilt)srxoir oydam nmfcs t  Dtmu pno4opxnmociat sDrlu o u4 ltnmo3oadlmDrlies;s)srxr(r3ny1ole lfctlt) rumxrooo0tet mfeiys mDrlnvsn() rxrxrcootfaDe uei s)t2umxo3ny4lm  lfetasfs2urxm nt1aeenmo3iyslaDem( s (0 lerxo3iodlptraivo;s0srumxo3iydomte neilt s2um(mpnu0tpt mictysfaDrmnvsnu4 lxrmo tadlpDelivolt0 ruo(m3nu4llt lncs t)sDtau poo1oeeoiictydla2em( pn(0 leoxr3ta1omD  ueslt0 etm(m iodlmeemfctat  Dum( pnt0ale io3tytfm umu ont0artrmr3oatfat li sl(0 rxr(r3nudam elfetatfsDuax onu0oex ioeiys m2um(mo;t) lenmo iy1fm r ies;t trxrim3iu4om elieiat s2taurp;o4alxoioetys a rmu pn(0treomr iytlatrli i s)t2uoim3iu4apeemncia(faDumum ;t4opxo fciytls ul( s;t) eerxocty1fm e ieo;(0t2umim3nu4oltnmfvsa(f 2rrxrpot1apenii3ias s2ua( s () exoir3totlpt aueo;s)s2toir3nudamenlnvs ( aDuaxroou0oeeoif3iadfm umu o t4teeoxo3oodoat lieolt0srtr(mpou4lp emfctl(  2ur( pot1opto octasfa2ul(vs;t)texrif3oadfmtr u i;()sexmir3nydomeelnes t) 2tm(monu4alto oeiat a2um(vpnu4alenio tytla r n i;(0 rxm(opny1oltemfetatfa2rm( onu1optoiietyslm2el(msnu0trtoxf3iatomtrluvs t) 2tr(opiy1lptnlietl(fa2ta(ro;o4texoiieiadlsDul(mp u4aetrif oydomt lu slt0sexoim3oo4lle lieiltf Drax pnu4tetoifeiadfa rmnvs;t)trermo oadfaDe ivi;t0t2xr(m io1omt lieia(f 2trurpoo1tpeo ocild mDrlnmo (4trtnmf totlmt luvsls t2uo(r ou4alt  nct t) Dur(rpoo4olxo ociyt a emu p t4trxoxo3ta1oaD  u s s) rumxr ny4op   ivslsfaDtmxmpno0ape ifciydfmDuan sn(0aleoifciytfmD  uvi (  exm(mpiy1olte iei t  2uaxm ot4apeo icildla em(mo;u)areoxo3oy1omDeluei;t0 rxrxr3iu1alee neslt a2um(roou0tlxo ociaslm uaumo;() lxrxr3tytlatrluei t0texrxopoodlme  nes (fa2rr(moot4ape mfeils sDumumon(0arxrmo oydomDean s ( t2tmiopny1oltnlivslt sDtaurpnt1oeenmfeiytfm elnvs u) etnirctodlmDelueo ( tetoim3oo1am elfvsl( srumuroot1altnifeiad s ul( snu4texrif tydlp r u i s texr(opiydape  ietls)s2uaump;t0tleo i3tldlm2el(mp;()areniocto1fa r nvs (0 rurxr3nudal e fvsl()artmx o;t0tlx mo3iaslaDuau o t4areomf todlp eai s s  2xrir3oo4omenlivslsf rta(  ;t0apenif3tydlaDel( o;u4trxoxrcoo1lp rlnvi;t0t2tmxo3ny1al   ics tf rtmxrpot4tptnmf3ils sDel(mont)tltnmf3oydfpDe ueolt sruo(m io1amte ivtas) rrau o;u4tpx  i3ildla rmumo;(4artoxf oatopte nes;s trtriopou4lpee iei s sDrax  nt0oet ii3ias aDrlumo;t) lenmfciadom eli ols)s2tmxrpoy1ap emncil( a2rrump;u0tetnmf3iaslm uan pn()tltnmfctytoa  an o;() rxm(o3oo4op n iesls)srur(  ou0olto fciat m2umu onu0alxomf oydlaDraues t)sexrirpnudll e nvt s)aruaumono4altomf3iys aDeaump t0aetomfcoydlmDean il() eurimpno1ll n ivtat)sDurxr nu4tltn feiltlmDraump u4artrmociy1fmDe ivol( truo(o ny4lpt mfesls)srum(mpot4ope mociytfs em( o;(4aleoif3todomDrlueo t0t2xrio ny4lptemfvt (fsDta( pnt4tleoifcilt mDemn p t)alenxo oo1faDranes () rtr(rpiy4aptemnei t s2umur ;o1aexn o3ilslm2emnvp ()aexoir oy1lmD anvils0 2uoxo ou1llt lfcsa(f rum( pno1aex  f3iydls2el(vpnt) renmo oy1lpt  ueil(0 rxr(o io4amtn feiltfaDrmum oo1tpxoifciytlsDra(mp;(4 renxf oy1lpDe nei (0 exrim oy1olt licsl( sDtr( ont4olt  f3iasfmDulu s u4alerxf3ty1lp   u s s)texriopno1lme lncta(f 2rr(mpnt4ale iicilsls ulnmonu4aexoxf ia1omt luvs;(0seto(mpny4ll e ivslt sDta(m ot4oltnioeilsfm2uaump u0 ltrxrciy1lp rai ol()srurxopnudamtnmfeias)sDtm(r ou1optnioeiat aDel(von(4 rermfcoodomDran i;t)teuoirpio4ol emnei (faDtmxrpno1tpx  f3tysfaDeluvs (4 etrio3todlp r u slt)truo(rpoudlmtnmnei t)sDrmurp;o0oleo fciyt a emn o;t0altnir3io1op  livils0 exmxo ou1lpe  ncil( a2rr( oot1alto o3tad aDea( o;u4tlenir3iydopD  uei s  exo(rpio4lleemnvi s) Duaur ;t4olen f3iatlm rauvsnu) exrxf3oatlm e nvo;(0trtrxopiudap nmnetlt s2raurp;o4tetnif3tat aDua(ms;()aetrmf3iy1lat lieolt  2xm(m no4oleelnvt sfa2rr(root4alx mi3ilslsDra(mp;t) exnmocto1fpte n s;t0texr(opiu1al   nviat s2tau pnu4tleo fciydfa rmu on()tlxoxrciotfat  i slt0t2ur(m3ou1lp  mivia(faDrr(  ot0apen fciytla emums u)tleoiocto1fpD luesl( tetmxm nodalee fesltf 2ua(  oo1olt  fetltla umn o t0aetriociydlmtr n sl(  rxrxmpiu1lm  lfetasfsrur( pou1opxo i3iydlm2em( s t4teermf3oodfmtraiei s0s2trio iodaltnlieias) Duru  ou0tlxo feiat s raums;t0arxnmfcia1fp e nvi s) ruoiopiydaptnlnesa( srrr( ooo1opt micils s umu p ()texnmocio1omDrauvolt  2tmirpiy1ome mfvt tf 2uaxr ou4alt ii3ils m rmu s u0trxomo3tydfp   uvi s) 2tmim nu1opeelfcta(fartmx  no0tex  ieiys sDel(ms () eenxfciytom e u ils0t2trio no4am  lfet sfa2umu p;o1altomietatfa ea(vonu) lerxo oydfmt an o s)srtr(r3oy4olte nvil( a2rm( p;u0aeto o3tytfmDuln p (4artomo3to1lpD lu o;t) rto(r no1ap   ict t)aDtmxrp;o0oleomieildla2uan on()alerifctydlm rlneo;t0 2trir3io1opte ics t a2ua(r ot0oexn o3tytls rluvpn()tltrirciodoa elu sls)srurim3oo1lptnlfvtasfartm(r ;u1tex  f3ilsfa emu s;t4 rxnxfciy1lpD livsls trtm(r3iydopenlfet ()a2rax pou0aeto iciytfsDel(mp u4 rxrir oo1omtraueo;( s2trio iodomte icia()arraxrpou0oeen i3ild sDumu p;u) rtnmo tytfmDe ivo;(  rumxo3oo1apt  ict s sruau  ;u1tpxo octasfm emuvs;u4 eenxr tydop r uvil(  2xmxm3iy1lm  mnetat  Dum(rpot0oetnmf3iat s2rmnvpn() etnmo iodlat  nei;(  eurxo iydaltn fcsl()sDrr(r ;t1oeeo f3tltfa ra( s;(0 exrmr tatla  au o;t)s2um(r nu1am n fesatfa2rmxr ;u0tpx mieiysla2ra(mp;t)alenxf iodlat ai i (0seumxo ny1lmtn fct ( arrmxmo;u4teeomictas s ranmpn()teeomrcoytfat aivo;(  eur(o nu4lm n fci (  Dtm( pot4olx io3tas mDelnvo t4 rerxo3io1fm rli sl()s2tm(m iudolen icsa()aruaxmpoo0tltoii3iadfm2eau sn(0alerxrctytlmDeau ol(  2trxm3nudlmtemivtl()sDtrxmpno1olen f3ildlaDuaumsnt)texriocootlpDr neolt0t2toim3oo1apt  nvtltfa2rax  ou4oet  ieiltlm rl( p;t0 reoio3io1lm e nvi;t0 2to(r no1aptn icsl()sDumurpno4tltnmietltfs2el( on()alxrmo oo1fmDe neils0setoim3oy4lpee iei s)s2tm(ro;o0olenifctydlm2ulnmo;t0tltnir3tydfpteluvsls sexoio3nu1lmen ieiltfs2ta(root1optomoeias aDrauvp t0 rxomf3oytopD livolt seuoir no4lptemici t s2ra(ro;o4tpx ii3ildfs rm(vp;u)treoircootoaDe i i ()s2tm(m3io4lmtn nvtls)sDumxm nu0alt  iciydfs rauvo;u4artrifctadfptrluvo ( t2urim nydalen feiat)sDur(  ;t0opxoiicildfaDem(vp t0 ltomr iadoa rau sl(0sexrxopou1lmtn net s) 2umx ooo0oetn ietatls eanmp t4trermf tytlaDr nei;()srxm(r3oodlmteliesls srra(ro;o0aeeomfetysfmDul(mp;t)artrifciatom elues ( s2xm(m nudopt mfcias  Dra(m ou1tptnio3tatfs2ra(ms (0arxnmoctotom  auvi t seto(r3nydam emfcs ( a2tmxmp;t0aetnmietadlmDulnvont)tleoxociotoaDelu o s  2toxo no1lmt lneilt sDrmxmpou1tpx ioeildlmDumnmont4aetrxocia1op eln s t0teum(o ny1apt  ietlt arururpot0aetnmfctltls2eln o;t4aexomr iadlmtr neo ()t2umxmpiy4om   nes t) Drax ont1ale  fetltfm eanvp;()teermrciydfm rluvo t  exmxmpiodlleemictatf 2urxmooo4alx  oeiys s ea(vsnt0 etrxo io1latranvo;s srxoxo3iy1alt lnct tfartr(rp;t0apxnmieiytfm uluvo;t4tlxrircoodop ranvo;s)truoiopnudole mivtl(fsDtr(mono1tptoiieiltfs2umu pnt4tltoio iotlm e u s;() etrxm3ou4ome mnvt () ruaxm ;o1optn feiytfaDrluvs (0aetoio ta1omDe uvs s  rxoio no4om emfetl(  Dtrxr nu0ole  i3ildlsDul( ont)artomo ty1fpDelivsl( trxoxmpio4aptn ici (fsDurumpno0teen i
\ No newline at end of file
@@ -0,0 +1 @@
+i sls0sexrxr oo4lmee fcslsfa2taurpnu0olto o3tat sDul(mo;(0 reoioctodoaDrlieilt0s2xriopoydom n fci ( s2rrxrpou1tetomocilsfsDean sn(4artrxfciytoa e nvils) rto(rpoo1opt lies s  Drrx oot1aptoioctasla ea(vo;u)teeoir3oadfatrlnes t0trxm(r3oo1amee ncta(  2uru pno0tpxomieilsla ulnvsnu)trxomoctydfp  lies;t srxr(o3nu1lm  lneils artmum ;o4aexniiciytfs2rm( on(0 leoif3to1lpD  uvil(0 rxoxopoy1omee nct tf 2ur(ro;u0tlx  icildlm ulu s u0 lenio3ta1lmD an i;t t2xriopou1ll nlneias) rtr(mont4ape ifeilsls uanmp t0tetoxr3oodfate i o s) rxrxopiy4olt lnciltfaDtax o;t1tleoii3ilsfs ea(ms u0teeriociodfaDeaieo s)setoirpnu4ameelfetas sruau pot4olx  iciyt m rmu o u)arenmocootfmt lues;t0srxmim3oodal n nctatfaDrru p;u4aexn f3taslmDeau p;t4arerxf3iytlm eaueo s trxm(mpoudlmee ietltfsDtrxront1aetomfciydfm ranmsnu4aetrxr3tydlpDeliei ()srxm(r3iudapeelncias s2tr(m nu1oleo f3iadlaDrln pnt0teenmfctydoat lueo;s) rtriopiu1om elfei sfarraurpnt4aleniieiaslsDumu sn(4 lenxo oodlmte ivo () 2ur(rpio4openlieiat) Drmxroou0apeo oetydls rm( s;t)tlerxf3oadoaDraneils t2xr(r3iu4omt  ivilsf 2raxm no0tex micils a elnvs t0trtrmrcoadfatr uei s)sruoxm iydolen fei t  2ta(m ;u4ope iietydfaDuanmpnt)areniocto1om  au ils) euoir3nu4olt liet ()a2rmurp;o1texo o3iat aDrmn p () lenmr3ootoa eli sl(0teurxopiu4lptn nvs t  2ua( ono1opxoifetld sDeau ont4aexrifciytlm  ai i;s  exm(m oy1lm e fvs sf Drr(mont4texn fetadls2rmnvs t)tltoxr ia1fptranvi ()t2uoxr iudope mfcilsfaDua(ro;t4oee  icilsls2uauvs;u) exoxr3oodoa r ueo;s) rxo(r3iu4llt lnvt sfaDtmx poo0oeen o3iltla emumpnu)trenirciotfm r i s t)t2trxm oo1om nmnci t)sDurum ot0opx miciytfs2eluvs t0texnircoo1fpD anvo;t)seumimpou1altnlnvi t  Dtrur oo1aptnmf3ilt mDulnvpnu0 rxomrcoatom  lu o (0trum(r nu1ap nlfesat s2tr(rooo0tpx ioeiasla2umumo;u4 lxnxf3tatoptrlneols) etmiopny1amtnmnvt t  2ra(mpoo4aptomociltfsDra( onu4 rermr todlat aiesl(0seuo(m oo4aptnlnes s)a2trumo;o4aexomociad a2emnms;u)aleriociy1om r ueslt0 exrxo3iy4om elivtlt a2rrx o;u4alenmfeiadfmDranvo (0arxoxr3oa1lm  lneo;s0srtmirpoodlleemfvsas)aDur(rp;u0tlenmfeiasfm2rlnmo;(0arxoxo3oodom ranvi;(0 euoimpou1aleelivsl(farrm(rono1tltn fciasfs ua(vo;u4trerxfcoytlpt aiesls0 rto(r3oudlme mnei tf rum(ro;o4apenii3tlt sDrm( s u) ltnirctytlpDean s;s) rxmiopiudll  lncsa(faDtrumpnu4tptomfeild aDulump;t0altoxr3tytomtelies s0s2toxopio4ll e ivs t)srtruro;u1tptoif3iysls2eaumsnt)tltnxf3iatopDeluvs ( s2ur(mpoo4lm  lncsas) rua(r oo4alx  i3tydls2rlu p u) rtrmr oydfaDeaivs () eurxo oudlm elici t srrmur ;u4apeomi3iys m rmu o;u)teenxf tadom  auei;t)seurxopoo1olenlfeiat sDtau ooo1oltoii3iysfa rlnms u4 eeomr3iydfp r nvolt)srxm(r nydal  mivils)sDraurpot1oleo iciadfm elnmp t4 ltrif3tatlpDrln i;(  ruoxm nu4ll n netas) rur(  ou0alx ii3tyslm umnvs t)arxnmo io1op  lneslt0trxmirpno1opee fes () rumur ot1ope iiciys mDeanvp;u) etrircio1fmtr ies;()teumxm3ny1lp nmictls) rraxmp;o0oleniieils a ra(vp;t0artoxf iotfaDeliei t)s2trio3no1apeelfcia( aDtau onu1alt ifeiyt m2em( ont) rxomo iytlm rlnvs;( t2tm(r3nydllenmict s)aruaurpou4oeen oeiadfaDelu on(4tltrmr3totfm r nvo (0 2tr(r3nu1ol nlncia(f rrmxrooo0aeeomoctysfa2rlu o;t) rxrio oy1fpDr u s t  exoir nudom elnvsl( s2trxr oo1tpxn f3tasfa eaumsnu4arxnmrciy1laDr i ilt0s2tr(r iudope  icta(f rur(r ;o1texo feiytlm2rmn p (4aleoxo iotfpt lueo t0trum(r3oudlmtn iciltfsDur(mo;t4oltoifciysla elnms u4artoxocia1lp e i o t  etrxrpnydop nmfetat a2rrx pnu4texomictasla em(vp u4 lxoif3io1fpteaieil(0t2xrimpny1lpee fet s s2rmxro;t4altn fcilsls2rm(vs t0texrirctadlp  lu olt srxo(r iodap  mivt ()srurumoot0tptn feiadfa rm(mo;u0 rtrifctydoat ai o;t tetr(r3iudole  ies s) 2tmxroou4oee  icias sDeanms;u)altoxf3oa1fmDrluvslt  2tr(r3no1om nmieias  2ta(mpnt0aptn icias s2ua( s t4teerxrcoodfa rlnesl(0t2xrxrpiy1ap e nvt s)s2um(ronu4aeenio3iyt s um(monu)trtomociodopt aneolt)trtm(r oo4op  livt tf Dtr( ont4apxomoeiatfm2rm(mpnt0arenmr iatomtraueo (0seuoimpoy1op n ivs s)a2ra(rpot1tltoifctlt s eanvp t)trtniociydomtelies;s0srtoxo nudopt lfeiltfaDraxronu0texnmi3iyt a em(vp;t)texrxrctotoat lu i;()t2xrxo3iu4open fvt tfs2uru o;t0ape  ictlsfs2um(vs;u0trerxrctytopt anvo ()texoir ny1lpt lict (f 2tmxmont0tet  i3iysla2el(vpnu0 rtomrciotlaD aueo () 2xmxo io4apen ivt t)srumxr no0ope iictytlm2eluvp t) lxoiocio1lmD  uvols) 2toio3nu1lmt  fcta()s2tr(mpno0opt  f3tld s ulums t4altoxrcio1fp rlivs t0trurirpnu4lp nmfetltfa2ua(  ;t1aee if3iyt mDeaumo u0arxrir3tytoat lnvi;t s2tr(opoydomt mfetl() 2raur nu4teenifeiasfs rl(vsnt)tltrmrcoodfm ran sl(0srum(o3nodole  fvt (f rrau oou4alt mo3ildfm2umuvs (0tetomr to1fmtelivilt texr(opnu4op nmnetas) 2ra(moou1aee  icias m2ranvs;()tltrxo tadomt luesls trxr(r3ou4apee nvt ( aDrrxmoou1teenmfciysfa2uanmo;u)trtnmr tytlpDeanesls  etrirpiudolt mictat artr(  ;t4ape mf3iyslaDrm( s () eenxo3iodopDelivi;s) rxm(rpio4olte fetlt srtau  ;o4apto octys mDran s;t4trtomrcta1lmt aieo;(0trtoxrpio1lptnmfcsas) rua(m ;o4tpxnmfetadlsDrmnvo;u0arenmo3tydopt aiei s) rxmxmpio1ale  feiltfs2ra(r nu0oeeomieiadfm elnmo ()altnmf3iytoaD lueol( s2tm(m3no4ll elicsas  rrmumo;t0olt mfeiadlsDuluvs;t)trxrmo3ty1fat aueo;t trxrxm nodlp nlivsa()s2rrurp;t4tpxnio3tydlm um(vs u) ltoifcta1la eaneo;( tetoim3iydapte fctas srtr( pnt4tlto f3iadla2eaump u4aexnmr iydfptranvi ()s2trirpoydam emivtat  Dtmxmoot0aetn iciyslm ulnmo;u4alerifciadfpt ln o;(0setmir ny4llt  nvsas) 2ta(m ot1ale if3iatlaDumnvp t4aexrxr3todoatran o ( srumxopoo4amen ieta()sruaum ;o1aptnmi3ilsfm2elu p;(4altniocootopte i o;s)texmir3oudlleelieil(fsrtr(mpou0olt iietytlm2rmn o ()arxnif ootomD auei s0setm(o oodaptn icia(  Dur(rpnu4tptoifetaslm um( ont)aexomf3to1fa eli s t0 exmxm nu1om emfeilt)artmumont1optn fciasfm2em(vsnt0tleomrctydfpD aivo;t0texr(o3ou4ome  fetltfsrum(  no4tpx  i3ilsls rauvon(4trtnmociytlaDe uesls0 eto(m iodalt mnvs (f 2taxm ;u1olxoifeildfa umnvo;u4 reoxo3tytfat  uvs;t)trtoimpnodll  lfesas  rtr(mono1tex ii3iydfm ua(mo;t0 rxnxr3iatlmDeau o s)s2tmiopoudlpen ncilt)sDrrxrpot0oexomf3ild m ulnvp (4texomfciydfaD ln o s)tetmxopnudoleemncs tf 2ra(m no4olx micilt m2ranvsn() rtomociy1omtr u s s0teum(m nudal nlivt t  rtru  ;o4tpe iietysfm rl(vs;u0tltoxr ty1optrau slt trurir iydlm   fetas aDua( o;o1texn ociytls2rlnvs u4 ltrio iydoaD  n i;t)srxoio io4lltn ivtasfsrrmx p;u4aexomi3tytfaDuluvo;t)alxrifcoydfm rlnvs;s)s2xoxrpiu4lltn ieta(f Drm(m no0altomieiadls2uau p u)aexoxo3tytoaD  u ol()srumiopnu4am   fcsltf rrm( p;t4tet miciyd aDum(vo;u0tlxrmo oy1la r nesls)t2xm(o iu1om e fvs ()aDtrxm nu1olxniociltlaDrln s t4tltrxr todfpt an ol(0seurim nudale lncils aruax  ;o0tpeo oeiys a ulnmsn()texrmfcoa1omtrlneols trtmim3ou4lleelfctas  2um(m nu4ape ioeias aDuanvp;u0alxnxf iy1fm rai sl()t2trio nydlptn fciatfsrrm(rpot0aptnif3iatla rm(ms u)tltrxr oytfmt  ivil(  2xmxrpoo4ome  nesl() rtruroou1tptomf3ilt mDrlnvs t)tlerir tydlptrluvo s0 rumir nydoltnmfci tfartr(mp;o1apxo o3tadlsDeau s t4teenmrctotfpte i s;t0truoir3oodlleemnesltfsDrmx o;u0altomo3tlsla rauvo t0aetomf3tatlmte i s;s) 2tmio iu4am  mnctas arra(m nu0tlenifeilsla2elnvont4tetriociy1lmDe uvs s0s2xm(o3nodoltemncsls a2rrumpot1tpenmo3iysfs emu on(4treoir tytfp   uei;t t2xm(mpou1apt lnes sfsrrrxro;t1altnmoctlslm elumpn(0aeerif iotlmtelnvi;() 2xoir3ou1alt lnesa(f rur( pot4ale ifciat m ua(vo t4aeermo3tydfmDrlueo t) rxm(m oy4lp elietat) rum(m ;o1oex ifeiatlmDrmu ont0artoxo3oatfmDe nvols0t2umxr3ou1ame  ivs t  ruau  ;o0opt mfciatfm2el(vsnu)aexnxo tydfm  lu il(0 eumim nodlleemncs tf rrau oou1tetnioetydfs2umnmo t4 lenir oo1fm  anei s  2xrir3nu4olt lnesas)arrru  ;u4alt  ociat m uauvo u) leoif oytlaDeaues;(0 euo(m iy4amee ictlt  rrrumpoo0tex ii3iat a2um(vo t0tltnmrciotopDe ivil() euo(o oodaltnlfei sf rtaumo;o0oet  i3tls m2em(mo;u4 etoio3iadlatr u o;t0s2ur(r3ny1ape lfcsls)arua(  nu0ope ifctasfm ul( pnt0 etnxf3tytfat ai i ()srxmio nudoleemivsa()aDtaxmono4aetnmo3iyt s2eanvsnu0 rerio3io1lpDe i o t)sruo(o nodlpte ivsl( sDtmu pnt0teenmiciytfa2rmnmo;(4treomr3tadfmDelieslt)setmxo3iy4om  mnci tf rumx onu0olxomfciysls2ean p;t4tlxomo iytopt liei s  eur(o nydomte fet s  Dtmurono4alxnmiciaslmDranmpnt0 lxoir iatfa rli o (0tetm(opio4apenlfctat srur(r ;t4apxnioeilslmDel(von(4 lxniocootoa eaivi t t2xr(o ou1apt mietl( aDrmxrpoo0ape mf3iad a2rl(mo u0trerxr3ta1optr nes;s0 ruo(rpno4optnlivtatfa2tmxmpno0tlen iciydfs el(mo;(0 lxrmr ty1lmt  nvsls) 2toxm3oo1ameemicsl( aDtrx pot4oexniieild m2ranmonu0aexniocoydopDeau i (0texr(rpiy1lmee neias)s2tmxr ;o4tltomoeilsla emumo (4 ltomf oatlpDrluvi;s)seur(rpiu4lm nmici (fa2ur(  ou1oetoiieiaslsDra(mo;(4tlxnif3to1lpD aieo (0 rxrxrpnodlpen neias)aDurur ;t0olxnmieiytfs2rlnmp u4 eenmociodfpDrlies;t srtoxmpiodapeelieia(faDrr(  ;u4ale miciltlm rauvon(0texrmf todfmDr ieo t  rum(m3iydal  mneias arrm(root0alt iictad sDelumo u4trxrmo to1opDe neo (0t2tr(m oydlme mnvi s aDra(  nu4apen f3ilt s2elnvp u4tleomrcto1opDrluvil(0seumxr3nu4ap e ictltf Dtrumpnt4ole ifetls s2em(mo;(4aleomr3oadoa rauei t)trxm(opoo4lmtnmnct t  Dum(  nt1apt mf3tytfs2ran s ()arxrxfcto1lmDr u i s0srtoio oy4apen ieslt  rrrx  ou1alt mo3ildlm2ul(vo;()tlenmf3oodop  auvs;t)t2tr(o nydal n nvil(  rumu p;o1texo ieiysla2eln s t4 rxoir oytomteanvil( texm(r3oudamte ncilsf Dumurp;t1ope ii3tasfs em( s t) lenxocoy1lp r uvo;() rxoio3ou1llte ieilt)aDraump;u4alxnmoctytfs rlnmo;u4treoifctodlmDrauvol()teto(rpnu4alee ict () 2raurp;u1apxoii3iydla2elnvont4aetrmf oytfp rai sl(0s2tmimpiu1am nlicta( arur(r nt1apxnioeiad mDrm( o;(4tltnir3ty1oaDran o;( setrxo oudlmtnlneta(fartaurooo1altoio3iysfaDumnmon(0aetrmrciytomt lueo s0s2xr(r3nudapen nvil( s2ur(  nu4apeo fciysfm emn s;(4aetoxrcoa1lpt aiesls) rxoir oodlmtnmfvi tfs2ua(mpnt1ole iictld a2umnmpnt)tetnmf3oadoatrlieil() rum(r3io1lm nmnvsa(f 2ra(rooo0opx mo3tldfm2rmnms;u)texnif tatfa eaivo;t)sexo(o3ny4al  lfeia(fsDurxmono4oee mo3ilsfm2umu o (4 rtnxfcoy1la raivi;(0srtr(m io4al nlici t) ruaumo;o0opeomociltfmDrlumo u4 rtoxf3oa1opDrlnvslt0tetoir3nydomeemnesat a2urum nu1oleo feiatfs2eln s;u0aleoir3oydoateli i;(0trtmimpiydlpe micia(  2tmu p;t0oex  o3iysfm2rln ont4 ltoxf oy1fa rluvi;()t2xoio3iodam elfcs tfaDtmurpot4oexoioetydlm eluvo u0tltoxo3oatfpD lnvs ( srxr(mpnudop   nvsa(fsrumum ;t0teen fcilslaDra(mp u0trxrifcia1omD ln ilt  2uoxopno1lp  lfvtltfartrxmo;o1ole mi3iytls ulnvs;t0 eeoio tytlatrlivi t)trxoio3ou4al nlncs s aruaxmpno0tpxo i3iydfsDum(vp;()alenmo3iytlmt  nvilt0t2xmxmpiy1ope liviltfa2rrum no0openif3ilt a2ea(mo u4trenif ty1lpDeli s t)sexrxr ou1apeelfct ()s2tm(r ;t0aexoiictydfs2rmn o t)tlxrmr3oadfaDeanvslt tetrxm ou1opt miet t)srrax poo1teeoio3iasfmDrlumpn(4aetnmrctatfm e uvilt0srxo(o3oy1amt lnvils)a2tmxrpnu0aleomicilt a2eauvp ()texnxo3oo1fm elnei;t) 2umir3nu4lle mnet s)aDrr(moou1tee  feilsla umuvo u)teeoiocoatoa   nesls sruo(opnu4am e fci (fartrxrpnt0olxomociltls rl(ms;(0 lxnxf3to1oatrauvsl() 2toxo3iydaptelnet sf rrau oou1optomociydls2rl( snu)artnir3oydopt aivo;(  etmxo oudamtemneias) Duax o;o1tpxo iciys m elu pn(4arerxr ta1fm eli s;t)s2urxo3iy4optnlnesl(  rur(r ;u0apx  fctlsfs emnmo;(0 rtrmo iadlaDranvi s)trtrxr3nu4ap  lnvtltfs2trxmpoo1ope mfctlsfmDranvs (0 rtrxr iotomtrlivol(0srumxmpny1am  miet t s2rruroot1apxomociadfsDuln s;(0 lxnmf iydla r ivs;s)sexoxo3ny4ame lietls)aDrmxroou1apxnifetysfaDem( p;t)aetnif iotop elnvo;s0setm(rpiu1am emfet sfsDtm(m ;u1aexomo3iaslm2emump t0tetnmr3oo1lpDeln s s sruoxopiydope  ics (  rumx o;u0aee moctlsfa eaumpnt)trtnir3iy1lmt auvi;t)texmxmpno4lleemivslsfarum(rooo1opt  o3tlt m2ua(mp;u0 rxrxo oatom  aivslt sruo(o3iy1apee iei tfsrtmu  ou0texnifeias m elnmo;t0 eeoxf iytfm r nvo t)trtrir iy4am  lnvsat)a2tau  no1olxomoeiadlmDumnmp (4alermf3to1fm ran s t0 rxoxo3iu4lmte nvil(f rrm(  nu0teeoif3iatlm2ua(mo u4aexnxr3oytfm ran ols)s2to(opiy4ll e neta( arumum nu4oeto oetysfa ea(mpnt)artoiociy1optrli i;s s2xo(r3nydlptemnetlt)sDrru  ;u4tet  o3ilslm rau s;t4alxnmfctatlmD an o;t  2tm(r oudoptelics ()a2trxront4alt  oetatfm elnvs;u4 ltnmr iatlmtrlu o s s2xrxo3iu1lpen iei ( sDuax pou0aeenmf3iyd a2ean o u4 ltoiocoatlmtran o;()trxrxopny4apen nes (  2ua(rono4apeomieilsls uaumsn(4 etomo iydoaDr ueil()srxmxmpiu4lpe lictas)s2rmxm nt4alx iiciasfa2rmu p;u0 rtnir3oa1faDr uvils0srxoxr io1amtnlncsat  rum(ro;o0ole mocias a uanmsnu4altomf3iytfp r nesls srxoxm nudome mfvsatfsDua(r nt0tpt iietlsfm umnmp t0 eeoxf3iydfptelnei (0t2xo(mpoodop e ieiat srurx onu1tltomfciyt sDeluvo (0treoxfcto1laDraueo;s  2tr(mpou4apeeliei tfsDraump;u1oetoiietyt aDulnvo ()artnmf3oa1fmD  u i t)teurxopiydll elncil()s2umum ou0oetomocild mDelumo u4 reoxo tydomteau o t0setrir3ny1omt lfcsl() Dra( poo1tlt  oeiaslaDeaumont4tlenifciodoaDe n ol( sexm(o3nydalt lnvsl()srrmumooo4opt  ociadla el(mp;t4alerio3oadfaDrluvo ( sexm(opiu1aptemfvsas)a2taxr no4tpxoifetldfs umnvp;(4trxrio3oa1op   uei (0 rurir ou4lmee fvtatf rrmx pou1apx moeiatfm rauvo;t0aeerxf io1faDranvi s0 etrxr3iy1ap nmics s)aruaumpot0tetnif3tysfaDrl( sn()tlerxrcoo1fatrlieslt) rxmimpiu1lptnlfvsas)s2tru pot0tltoif3iad m uaumo t)altoiocoytlmt lies ( srtoio oudom e ieils aDtmxr ot0tle  iciat s2ua( pnt)tlxnif3iydfpDeaiei;t  exmxm io4al nmnetlt) rra(  nu0ole io3tys m2rauvpnt0trxrmr3ia1lmDrli il( tetoxrpoy4op e nvia() Dumump;t0aet mieiysfa2elnmpn(0arenmf ty1fp ranvilt0 euo(r3nudlpte fet t)s2rauro;o0alxo fciyslm2rmumo ()aetrxf3to1fa eai ilt0 etm(m3iudol   fcilt aDtmxrp;u4alt mo3tasfs2emn sn(4 rtrxrctadlmt aies t srto(mpnu4amee fvt sfsruax p;o4oexn fcias s el(mont)aleomo oodomtrluvil()srur(opny4am   iciatf 2truro;o4tleomoeiytlaDulumonu) rermr io1oa  lu o;t0sexr(m3oo4optemncs t)a2tax pou4tex  ieiadlm umn sn() lxrxfciytlaDr ues;s) etmxo3no4ape lfvsltfartrum ;o1aee ioctadfaDel(mo t0 lenxf3tytlmtelieol(0t2xrxr3iydll e fvtas) rrmumont1opt  iciyslaDeluvonu4 rtrmrciatla  liesls) rxmxr3oodopt miet s) 2raurooo1ope ifeiadfa2el(msn() etrmo3oadoat  n o;(0 rtrir3nu1lpt  ivi t)srumxrpnt1aet ioctyd m rl(vo (4 exnmr3iotlp raiesls texrxopoo1optnmfvslt)s2trxmoou4tle  ietatfm rauvs u4tlxnxo3iatfmt anvsls setoim ou1ap emneil(fsDua(rpnt1tle  ocias sDrlu ont4arxrxr3iadopDeli i;t0 2xoxmpoy1ome  ictas) 2ra( ooo1alxnifciysfm ulnvo (0 rxnmo iydoa eauvsl(  eumxmpoudam elfei s  ruau oou1aexn oeiltfa2uluvs (4altnxo oa1oaD an i s sexoxr nu4lpe livt s)s2ur(  nu1tpxoiiciltlsDel(mpnt0trerif3todomtrlies;() 2uriopnu1apt lfctat aDtmxr ;t0texoiociadfa rlu o u)texoxr3oadfm e ieo;(0texoim3no1lpeemnvtat sDrr(mp;t0oeenio3tldfaDuan o () lxomr oy1opDeluvs s)trtr(o3ou4ope lfvtls)sruaxr ;u0oexoiieias m2ua(ms;u4altnxo iytlmtr i olt)texmir iu1opeelncsat s2ra( pou4oexomf3iatfaDel(vp;t0texrmo to1oat lu s t0 2trxrpiydlp nmieiat sDtm(m ;o0ope  oetadfmDulnms t0aeeomf tydfp  ln i;(0trxr(r3no4ame mncil(faDumuronu4tlenifctyt mDulumpn(0tleomf io1optrln o;(0setoim3io1lmeemfeil()aDrrx pnt0aex  oeiat a umumont0trtnio oadlm raivsl( t2trim3ou4al e ietas aDuaur no4opxnmf3tad mDrmu p u)arxrmrcoatlaDrluvslt  2xmio3oydaltemicsa( a2rr(m ;t0alx miciltlmDrmnvpnu)arxoxf3tytop  lnes s  rtrxr3oudap nlncta(farum(  ;o0tleomf3ilt a ra(ms ()arenio3oatopt au s t)s2to(o no4altemfcia(faDta( o;u4apxn f3tldfm2ra( p;u4trxoxr3iytlp rauvo (  rxrirpoydllenliei () rta(roou4tpx  f3iyt a ea(vsn(0alxoifcoadlm r u sl(  rtrxr3oudlp n nvia(f rtmxrpnt0oeenii3iaslmDean s;u0tltrif ta1oa eaneo t0setmirpnu4al nmnet sfa2rrum nu4olxniociadfa2elnvs;t0teerirciydoa   ivs;()tetr(r3iodamen fctat  rtrumonu4aetomo3iyslm rl(vo t4tltnmr3ia1fmDrauvsls s2to(r oudomtelncsas sDuaxmpoo4teen i3ilt a2ran p;u4teenio3ia1laD lnesl(0 rtrxmpoo4opeemivils  2tmu  nu4tlt ifctas aDuln pn()texnio tatlp   ueo;(0t2uriopoy4llen ncsas)aDurx o;u1tlt mociytlsDemumpnt0 eeomo3todlptrlivo;()srumxrpio1amtnmnvsas a2rm(m no1aleniieiltfaDem(vpnu0arxnxf ia1opDrlu o;s0setmxm3nudaltn ict (  Draxmp;u0tet ii3ilt a em( p t0aexrxf3tatomteau s;t)s2trir3nydol n iciltf 2tr(r ;u0tpx io3iltfaDrln o (4tetnmocia1fpDe ivs;(0trtoxo nu1apeelietlt  Draumpot0teenmoeiat sDemn o t4trtnmo totomtraies () rxrxo3iy4ol emivs t) 2rau  oo0aetnmo3iasfaDemuvonu)alenxr iytlpt lies;s0trur(m io1aleelfvsatfs2ta(roou4tlt iicildls eau p;u4aeermr3iy1fate neils  rtrirpoudom e fcils)sDrau pno1oee iictad sDumnmpn()artrmrcoadlate uvslt)t2tmxm iu4aleemfei (  2raurpot0aeenioeilt s ran p;u0 exoxr3oy1lp eluei t)s2tm(mpno4altn nctls  2ra( ooo0ale ioetadlm2ranmsnu4tlerxrcootfatraieo;t)trumxm3ou1ol elfet s a2ur(r nt4alenmieiadfmDumnmp t) rtnxr oa1fatrlu i;s) etr(r nu1ap  mfcilt  2umxr ;u4tpt mo3tysfmDra(vs u4 rxrio tadoat anvils0t2tr(m io1al nlnctls)sDurxmont4tetniicild mDrlumo;(4altrio3ta1om eaieo t)srxo(r3ny4am e ivsls sDuaumpno0optomiciysla ean o t0trxrio oadfm  ln ils0sexm(opnu1ol nmictasfaDumxmp;t0tleoiieiadlsDemn o;u) ltnmfcoytlpDeaneils s2trimpoy1am n ivtl() Durxm ;u0alt mfeildla2umuvp t)arxrxocty1omD li il(0 eum(mpny1lpe mfvtas srtaxmoot0altnioetydfm2umums;t0teeoio3ta1fmD  uvils  etmio oo1lpe  fci ( srraur ;t1ole ifeiaslm umu s (0 rtoio tadlm eaieo;s)t2tmxm iu4ol   fvt ( srra(rpot4olx  ieildfmDelumo (0 exoxr ty1om rlneils)trxo(mpiy4lpt  ietls srtmx  no4oeeo oeiad m eln sn(0texoiocty1fmDrluvol(0teur(o iydopt lnvtasfarrr(mpno4ope  iciad m2elnvpnt4 ltnmrctytoa  aneol( srxrxrpoydaptnmnvt tfs2tmxrpnu4aetnmf3tldfa2umuvsnu0alxrxociodla   uvolt)t2trxm oy4ap nlnetat srtmu o;t1oleomoeiydls2ran s t4 ltnmocty1laDelnvilt) rxmxr3iy4am  livilt a2umxrpoo1tpen fetldla rlnvo;(0tetnxocio1latran sl( t2to(m3ou4ole mieiasf 2rr(mono0tlx mfeiat mDuanmpn(4 rxnxfcootfp eluvs ()setoio3ny1ll  mfetlt)a2uau ont4tpt miciytfa2ra(vonu0artnxrciatlmD ai ilt0 2umxopoodapen ivi t arta( pot0tee mfetaslm2um( sn()areomo oadlmtr ivs;()t2um(o3no1am  lfct t a2umx onu1tptoif3iys aDelnms u)aexnmr ia1laDraues;(0s2toxr iu4lmtemnctasf rtau pnt4tleniiciadlmDua(vo (4tetnmr3iatfmDrai s;()sexrxrpio1lpe mici t)a2rr( oou4texomieild m eauvo;u4tleomo iodfa raieo;(  2trxopiudalee nciltfsDum(rpoo0olxnii3ilslmDemump t4tleoxocoydlmDrauvols trxrxo3ny4al  lfci t aDumxrp;t1aeeomfctldls emn o;t) lxrircto1fp eaues s) exrxm ou1apee fvi s)sDtaurooo4oee moeiatls rmuvsnu) rtrir oo1lmD  ivols srxm(r nodaltemfvilt) 2taxmo;t1tee  fctatfmDeluvo;() rtnmrcoytlm  aueo;t0sexrxr3io1opeelici (fa2rr(  ;t4aptoio3ilt aDran sn(4trxrio3oo1la e uvs;t s2ur(mpoudaltelfeiat) rtmum ou4oeeomoetys aDeauvo;t4tltnmrcoy1fmDelieo t seur(mpiu4al   nvs s srta(ronu1alx ifetysfa ra(vs;t)texomrcio1fatelieo s0srtr(m3oudllen fvs ( artr(  ;u0tet moeiasfsDran s (0alxnio3oa1faDrlu i;()t2umir3oo1lm  mnei s) rrru  ;u1tpeomieiatla ua(vs () ltnmr3oodomt lieslt)seur(m3iodlmte iei tfaDtm(rpot0opxn f3tatfa um( o (0trxoxo iodfa  anvo s0 eto(opiu4opte ietltfs2rrumpot1oexoioetldfa2emu s (0teerxfcty1oaDr ies t0 2xr(mpnu4lm  mfctltfsrraxr ou1texnmi3ias a2eaumon()tltrir iatfm  ln o;t  exrxo3nu4aleelivia(fs2tr(ro;u1altnmiciatlm eanmpnu) exrmf3ty1lmDe ivolt0 rxo(m3ou1ole lnes ( aDtaurooo0alxn oeiysfaDuln o;t)tltnmfcootopte n s t s2xoim oy1optn fctasfsrur(mpnu1tpto fcildfa umu o;t4treomfcoo1opt anvo (0srxrim3oo4ame  icsas  Dumu  ou4tlxomoctlt m2ulnvp u4arxrmf3oo1la  li o;(0 rto(r3ny1omeelnes s  rur(rp;u4apxnmo3tltls2emums;(0tetrmf tytomDrln ol()sruoxmpnu4ol n ies t s2urum oo1opxnioeias m2rlnmo;(4aeeoxf3oatfpt aiei;( tetrio3iy4lpt lnci () Dumu p;u4aptnif3iadfs rlnvs u0tltrif3tatlpt  u o;t0srtr(rpoy1ame lfeta()artaur nu4ale  oeiadlm2um(von(0treoxo3iydlatrlu s;t  2xrxm io1opeemfesas) rraur nt1texomociatls2rmnvsnu4 lxrxrciadopD lu i;( srtrxm no1op n ies ( a2rm(mpoo4tleomi3iyt m rm( onu0 eerifctotfaDe n sl() rto(r iy4ame  ivsa() rra( onu0ale mi3iyt sDel( p ()altrxoctydlm rli i;t setrir3no4ll emneil(  Dum( ooo1oet ifeild m2ua( s;t0 rtrir iotlpt auei;t0trxrxm3ou4omte iei tf 2urump;o0tlenioeiat m rl(vo t0alxrxo ta1lat  n s (0s2toir3io4alt livi tfs2rrxmo;t0tlx  fciltfmDelumonu0 ltnmr3oy1op   ivo;(  exrxr oudoptnmicia()s2taur ;t4tlxomoeiatlmDulnmo;t) lxnxr oatfa r i i s0 rurio no4om emncilt srum(mpot1tlxn oeiys sDrmnmp;u0 etrxocta1laDrlu s;s0 rtoxr3no4llen netl(  rumum ou1tpxo fetadfsDelumpn(0trtomo3iatoatranvslt0t2xm(opnu1omeemnesls  rrmurooo0olenmoeiydfs2rm(vp (0 rtnmrcty1laDelues t0setrxo ny4opt mnet sfsDtmxm nt4oltnif3iat m elu p;t) lenmr3iy1om rauei t)trtoxo3iu1lm nlfcsl() rrm(mpno4openii3tysfm ul( s;t4 lxoxo tytfm  anei;t0sruo(opny4ll e icta(  Duaxmp;t1oetomiciyt a uanvp u4tetnmrciytoateliei;s0 rur(r3oy1apen ict t  2urumpou1olenmf3tld a2ea( p u) lerif3ootfaDr i s;s truoxr3oodlmtemncil(fsDrrx pot1aleomf3tydfm2rl(mpnt) eeoxr to1oa elies (  2trxrpoy4alte nvt t aDumu  ;t4tlxoifeildlm2elu o u4 lxrxf oa1fatran ols0s2urxm oy1llt  icsl()aDtaumoot0aetnio3ilsla2rluvo u4tetomr3iatfp   uvi;(0 rtoir3nydopenlieiatfarum( pot4oltnmociyt sDum( pnt)alxoxocoytoa eauvol( sexmxmpoudlm nlivtat sDua(mono0tex io3ils mDea(vo;u0tlxrmr ia1laDe uvo;() 2tmimpiydoleemfvs t aDta(rp;t1oltn fcils sDum( o ()tetoirctatfaDrai i;t teuo(mpnu1lmte nvta()sDuaumonu1oltomf3iyd m2uauvp;t)tlenxr3iodfpt  ivols)texriopny4lltnlivtas)srtaurpnu0alen iciatfa2rl(vo;t)tetoio3tydoaDran s;s  rtoim3no4ap emfvt tfsrtau o;u0teen ociltls2ulnmo;u) rxoxf3oytlmDe uvo (  rxmxopny1opee icilt a2tm(moou0altniiciydfmDemumo;(4teenxf3iadom raneils  rxmxopou4lltnlietat)s2rm(r ;t1aet  oeiad m ranms () lenifcty1omDe u s;s  2xoxr3iy4amen ivilt  rtrx  ou4alt mociad s elnms;u)tltrxf tadomte ueil(0trxr(m3iydape lfvs sfaruau oot4oltomfciysfm umuvp;u)treoxf3ta1fa raueo;t)t2tr(o3nudomtemictls) Drax  nu4alt mfciat sDuauvp;u0artnioctytfateanei t  2toxo3nu4op n ietltf 2urxr ou4apxomi3iasfm rl(msn() eenxr ta1fatr i ols t2um(opoydlmtnlfet s  2ta(  no1alxnmieiys a emu p ()aexoirctydfmte n o;()setrxr no1omt  nvia( aDraxmpnu4opxo oetls sDeauvsnu4 etoio3ty1lp rlueslt)s2xmxr nudol   ivi ()arur(ro;t0olt mi3ias a ulumpn(4 leomfctadfmteai i (  etoirpoy4ll   nvt tfsrrmxroot4tltoio3iyt s2rmuvonu0 etriocty1fa elu s;(  2toiopny4am nlfetas)aDtaumono1tpenmicils a2ea(vsnu4 lxrxo oodomDrlivo t trurirpio4am nmnci (fs2tmu pou4tpx if3iydfm ua( o u0tltnxf3ta1oa  aneilt srtoirpnu4lm n fvs sf Dta(m ;t1ole mf3tys mDulumo t) rtoif3iytopD  nvi t)s2tmxr nu1aptnlnei t sDrrx p;o0ole ifciadfm2ra( p;t4aeeriocia1fp e i il(0 rumxo3oodamtelivs s) rur( ooo0olx moctlsls emuvs t0areoxrciatoa   i s s0srur(rpoo1op  mnvsa(faDtm(  nu0altomieiltlm ul(mp;u) lerxo3oodfpte nvs;s  rum(m ou1al nlnes t)sDrrumooo4texo o3ild s2elnvon() rxomo3oatfateanvsls)setoio ny1lltnmfctas) 2tmx poo1oleo ietls s2elnmpnt4 lxoio3ta1oa   nei t)sexo(r oydlm n icia( aDra(m ;t1aptomi3tad a rm(vo;t4artoxo oo1oaDelivo;t0t2tmio oy1optn fvsl( s2rm(m ;o0oexo iciys a ean p;t)arxnirctotoatran i t0tetoxrpoo1olee ivtl()a2um(moou0alx mieiatlsDrmu s;u0trxnxo3iatla rlu i;(0trtmxm iy1al emivt sf Drau ono4ope mieiat a rm(vpnt0trerxo ia1laDeliesl(0sexm(opnudlmen iet s)arum( ont0tlt ifeiyd s2um( p u0altnmf3oytfp e uvol( trxoxmpiudlmt  ietlt  Dtaxmonu4tpxoifcils s2rl(mpnu0 lxnio ia1fptrln s s)truo(opou1opeemivil(f Dtrxm oo1apt  o3ilslmDelu o;(4teeomrctydoa   n i;t) exoio nu4altnmncias)aDurxmp;t4oex iictltfm raums;t0 ltoio ia1lm  lneo ()srtrxmpiy1optemfctl(f rtru oou1optomoeiadlm2ul(vs ()arxoifcoodoate neo (0tetoxm nodlptn fvsasfs2urxmpnu1tpe  feiysfs2rlu onu)aleoxo oo1lmte uei;s texmxmpiu1ol  lnct s srua(m nt1tet moetat a2eanvon(0tetomf iodlptrlueo ()texoiopnudopenlicsl(  2rax pno1texnmf3iyd s rm(mp;u4texrxociotfmtr ivo t)s2uo(m io4optemneil(  Dumxro;t1aeeo feiatfa2emn pn(4teeoxocta1lmDelnvi t0srto(opnodapen iciatfsDumu ono4oexnio3iat aDua( p (4 rtrmo iodom   uvsls)teum(rpou1llt  neta(fsDrmx o;u4apxoifciadfm2ulu p;t0arxrmoctotopD luvo;s)setoimpio4amtemici t  2tmumo;o4ope mo3iatlm um(msnt4 rtnxf3oodfaD liesls seuoiopoy4alenlicslt aruax p;t1oetomieiasfaDrmnvpnu)tleoxrctadlp  li il(0srxr(m3oydam n ictlt aDtrx  ot4aex  iciys mDea( s;u)alxomf totfp  luei;t trtrir3iu4lp  lnei s)srrr( ooo4oeeoif3iadfa2rm(vs;t0arxomr oy1la eaieo;t) eum(o3iudolen nvias)arra(m ;u1tleoioetyd sDelnvpnu0trerxr3ootla r u il( tetm(o oo1altnmictatfsDtaurpou1olxo f3iltlm2elnms;()artnirctatop   ivsl() 2umxrpny4lm elfvslt s2umum ou1aetn f3iysfsDra( pn(0trtoir3io1fpt lieols0s2tm(o3nydop   ncs t arrax ono0oee ifeils s uau p t)trtrmocio1fpD luesls0texm(opnudamtemfcsasfs2ur(r ou1olenmoctldls2umu s u0aexrmr3oa1fatr u olt) 2to(r3iodlm  mfciat)s2urxr ;u1tlxoii3tysfa2umu p u)aetrio oy1opDrauvsls)texrio oodomtn ivt tfaDtr(root4aee iicildfs2ua( p t0 lxnmf3iodlaD  ivo s)sexr(m oy4lm n nctltfa2ra(r ou0olto feilsla um( s (0 rerir oadlptranvi;( t2toirpiudlleemietat)aDur(mo;t1tetomietytfs2em( s;t)tlxnxo3oatfat  ueils0 2tm(m3no4omen nvil() Dum(r ou4openii3iys a eanmp;t0 rtnxfctatlp e ivs s0s2tm(opou4ome  fctl(fs2raxr nt1oexoifetas sDum(msnt)trtrxr3iytlm  ai s;t0 rxrirpoo4aleelfeil(fsrrrxr ou0olxn i3tlt a2emnvp;t)alerxr iadlm r nvil(0 rxo(mpnodom emiesl(  rumump;u4tpen o3iltlm uaums;t4tlxnif3iy1fp elu i ()setrir3oy4lltnmies s)aDrrxm nu1oltnmi3tlsla2ulumpn()aleoxfciytomtr ivil(0teumio3oy4lme mfeilsfsrum( pnt1ale ii3ias aDumums;u0tltomr todoatrlies t) rumxr iydam   fes ()sDrru  oo0olto f3tysfaDra(vs;u0tlerxrcty1fateaueo;t) eum(r iy1lltnlici ()aDurx ooo1olx mo3iatfs elnmp;()tltrxf iatfmteaneils0trtmxm ou4om  mnvtat arraumo;u1oeto feiytlaDrmu p t4trtnxfctodopDe nei;() 2to(mpoudop elnet s a2ua(mo;t1aee  ictas a elnmo;()aeermr iatop ean s;t  2urim3ny4om nlfviat  rra(mono1aexn ieiatfm2ea( sn(0arxnxrctytfa e uvs;s)t2toirpiu1aleemfvsat srtr(r ou4tee  i3taslmDrl(msnu) ltomociytomte n i;t0 2triopno1lleelnviat  2urxront0oeenioeiysfm2um( snu)trermo iydopD aiei t)texo(r3nudlpenlneslt)artmxm no1apen fctld s ra(ms;(4tlenxf ta1omDeai s ()teuoiopou1ll emfci tfsrum( pnt1aet mociys sDrmnmsn(4 lxrio3io1lmDeaivi;( setoxo3oydole mfeiat) Drr(r ou4tlt  oeiysfmDemn o;u4trtrxocio1opD aivilt0t2xm(r3nu4ol n ietlt artru pot1opx mo3ild a2elnvs;t0 lxomr3oydfatr i o;t  euoim3no1olt mivs (f ruaxmpnt0opt moeiytla rlnmp u0alenif iy1lat  u ol()sexoxmpno4lme mfesl() 2rr(  ;u0oltnmocild mDelnvo;() leoxf3oadlpDeluvs;t0tetrxr oodlmee ivt ( a2uaum ;o0teeomoeiydlm2em(mont)aleoif iodomD luei;s s2xo(rpiodom e nvs s)s2urxmpnu0tpxomf3tldla2rmn o t0 rtoir iatfat auvi;( texoir3oydlpen fetlt  2um(m ;u1aetoiictysls eau o;t)trxomr3io1om elneil( sruo(opoy1opeelnvtas  rraxro;o0tlxnmietysla uauvonu0 eenxf oatoaD  i slt)trxoxo3nodol n nct s)a2rmu  nu4altn fcildla ulu o u0trxoxrciotoptr i o t setoirpiudope lfcsat) rum(mono1tltnmfeiad s2umnvpn(0artnmrcoo1oa rlneilt)t2tm(o3iydlmt mfetatfs2rr(mo;u1ole ifetat a eaums t4 rtrifctytfm elues;t) 2trxo iy4ol elicsatfsDumum nu4alxn feiltfs2rmuvonu4teermf3oydopte uei;t) rumxopnodomtelnvtas aDtm(  ;t4tle ioeiat sDuauvon(4aexoio ia1opDelivi;t trxmxm3oydop n netat artm(root1alxnii3iydfs umums () renifcoytlat aivi t trxoxo3io4lpt  fetas) Dua(m nt4apenii3ilslm2rmump;()aexrir todoaDe uvo s0trum(r3io4omt  nesasf Dumxrpno4opxnmi3iatfm2em(vp (4altrxo oatomD  uvol()sexrxo nydame  nesat)a2rmx ooo0oetoio3ils m2rln pnt) exnmr3oo1omD anvi s  eurimpou1om emicsas a2um(mono1openiicildlaDrluvont0 ltnxr3iadlm ran i t0t2xoxr3nydalt mivtas)s2rr(  ;o1aeeomf3iat a eauvpnt0tetnxociotlmDeanvo;t)seuriopiy1lmtnlivilt aDtr( oou1oltnmoctyt a rmn sn() lxnio3tytlpDran s;(0t2xm(rpnudlmtelnvs t) 2raum ;u0tpx iociad sDeaumo;u4 lxnmoctotlm e n s ( s2um(mpoy1op  lfesasf Dumuro;u1altoifeiltlmDrlu o t4alxnxf3tydlp  livslt0 rum(o iu4ap n fesas  Dtaxmooo0teenioeiasfa2rmuvp;t0tetoxo3oodfa r i s;t) 2to(m3oydopt mivilt  2rmuroot4texniocildls2uanmp;t)alxrxf3tytomDeauvi ()srtrxmpio1lpee fesl()arraxr nt4oeen iciasls umnms u4aetrxfcoatlaDe i s;s0t2tm(r3nydame  neils  2tmxmo;t4olt mocilt m2rm(vp;t0 exrif oo1omDrlnvols0setoxm ny1oltelfcsat s2trurp;u1olxnif3ils mDelnvo ()altoif3oadfpte nvi;(0truoxr3iu1lmte ivtl()a2rr( p;o1tleoifctyt mDrlu onu) leomfciy1la  aivo;s  rtr(r iy4lptelfct s a2tm(mpno0opxomf3iatlmDra( o;t4trtrir3tytlaDrlivi;(0teto(r nudaleemnctasf Dta(m ot4tpt  fciyd m2el(vp u)alxomocta1lpte n o;s  2xoio iy4llenliei t)sDtau  ;t0apxomiciysfmDumuvs t0aexrir3tatoptraiei ()t2xm(r no4om e ici s arta(m oo4tpt ioctys aDuan s;u)tltnmrciytopD  uvi s)s2trxmpnu4apenmfet sfaDrmx o;t4alxnii3tyd a raumon(4 lxrxrciytfaDranvols trtrxrpoo1amee ncsasfa2rmxr nt4aeenifciys sDul(ms t0tetnmo oo1la   n i t trtm(r iy4ol emfei tfa2tmu p;t4open f3iyslmDuln p (4trerxf3ty1opDe u i;t0trtm(o nodllt mictas s2rmxmpno0olxnmf3tadlaDrlumo;t4 ltrmf oydlptr n o;t sexmim iudlp nlnvi (f 2rrum ;u1apxomicildfs emuvo;t0trenxfcoytlptr nes;(0sexrxm3oy1al emfcsatfartru onu1ape moetytlaDran o (0treoifciy1la e iei;()s2toim3oodap n feta( aDta(moou4olxnifeiytlm eaums;u)tlxoiocoy1oa eaueolt)t2tmxrpiu4ale  nvt sfartmu oot4opt iieiaslmDumuvo;t4trtnmocoytlp eluvols0 euoxr3io1ale mfcs tfaDtmumpnu0tlxo fctldfa ul( o;t0tlxomr3tadfmt ai o ()tetrxr3ou4oltnmieiat) Dta( onu4olt  i3tydfs2eanms t4 ltnxo3iydfat  i sls0t2xrxo oudolee ietat arururpnt0altoifetydlm2uluvpn(0alxrxf totfpt lnvs;( teumxm3oodlptnmfvtls  2rmu  ;u0apenifciydfs2ulnmont0tltnxrctadfp eli o s)teumxm iy1openlfci s) Duaxrpnu4tlen fetldls uauvon(0alermf3iodopDrlnvo (0teuoim iudamt mieia( a2ra(  nu1aexomieiat mDranvont)tetoif3ta1fmte ivo t tetoim no4ale livilt aDrrurp;u0tleoif3tls s el(mpn()texoir iatfm   uvi s0s2uoim3oudllenmics t)arururp;u0altnioctlt s elump (4teermr3iodopDr u o t t2xmio io4ll   fetltfsruru poo1open o3iad mDum(mo u4 exrxoctodlp raivslt)seumxo3iu1ameelnvta( sDtmxm no0alxo o3iltfaDum(mp;u4altnxf3tatfmDrli i;t sexrxm3no1lltnlicsltf 2ua( ont4texnif3iyslaDrauvsnu0teeomr3ty1faDeaueilt0setrxmpoudlptelict s)arumxroou0tpxn i3iltfs2rmnvs (4texoxr3iydlmt auei;t)setrxr3oy4lme lnei tf 2um(rooo4tltn oetatlm emnmsnu)tltrmr3oo1lp rlivi;s t2xoimpnu1amtn nes s  2umxm ot0tle  fetldlmDrln onu0 exnmr iytla e uvo;t0trtrxrpou4op   nctls sDrax pou4ope ioeiyslm2rl(mont4tltomociydlpDeliei ( trxo(mpny1lltnmfet (f rrm( pnu4alx ifetad sDrm(ms t)arenmo3oa1oa  lneil(0 rtoxm3no4ap nmnvsasfa2ua(mpnt4alt  iciydla eln sn(0trerxrctytlpt ln s t)s2tm(rpnudlltnmfvs ( sDtr( ono4opx  fcils m ra(ms t0tetoxocoadfpD anvo;(0seur(mpoo1amt mfet s)arurumoou1alxoio3iadla rlumo (0arermo iydfm  an i;(0 2toio iudome mnciltfa2urxront0olt ifeiat mDum(mo () ltoioctydfm   nvilt)teuoxm nydlp e fcsa(fsrtmu o;o1tleomf3iltla eau pnt4 leomo3ta1fmt aueo t) eur(m iu1llen fcsl(faDururp;t0ale ii3iadfmDem(mp (4 etnxr oodfa  aivs;s0s2toxr nodam n fcsls a2rrur ;o1tlt  i3tld m rmuvonu)trxnirciadlmD anvi s trtmxopou1alt mies t arrm(roou4tltn ociyt aDumumsn()altomfctatfm r i o (0 exo(m3oy4lptelfvtas  rtru  ou1oet  oetlsfa2rmumpnu4aetnir3io1oat luvo;( srxm(rpoo1lptn ivia( a2trum ot1alxoifeiydfmDra(msnu)tlxnmo3iatfm r i ol(0srtrio3nodomt  fcs s  Dtm(r nt0tlx ifctatls ulnms;t4tleoircoa1opDeau o;s0s2xmxo3oydop nmneil()s2rr(rp;t0oee mi3iatlsDranvo u4 eenxo iodoa e nei t0seumxr nu4lltelfeslt) rtrxmont4ape ioetldla2emuvs;u4teerxf3todlmD aieo;( s2xm(r oo1ll elfvi (  Dtruro;u1aeeo ieiydlm eluvpn(4 lxniocoodlptrlu i;s s2toiopiudlpe  ietlsf Duax p;o0oeeoiociytlmDra(vp;t)trtrmr oytoa eaueo;t0truo(o iudol nlicsa(  Durur ;o4oetnmieiydls umnmo t0tetrio3to1la e nvi;(0texm(m no4am nmictl(farra(mpoo4oetnmf3iadfs2rmnvsnt0tetrmrcoatopD luei s0setm(opnu4lpe mfvt s) Dtm( p;t4opt mf3iltfsDrau o;u0artoxf iy1opt auvo;()sexrxm3iydale  fviat arumumo;o1tpxnifeildfa2ranvonu4aeenxf3ty1omteliei;t0s2xoiopoy1olenlicilt) rtrxmp;u1olxnmfcilslm ea(mont0aetrio3oadfaD  u s t s2umir nu4aleelictlt srumx p;u0tpto oetasfmDeauvont) etnmr3iytoatr i ols)s2uo(r3nodaltn ncsa(fsDua(m ou1aexoioeiasfa2rl(mo (4teenir3oo1lmD  ues ( trxoim oudopenlfesa()srtmuro;t1aeeoifeildla umuvpnu4alenxocoatfp ran i;t texo(opoy4opeemfvi s srtm(mpno4tltnmietadlm2emumonu4artrif oytoat  nvs () eumir3oy4om  licta()s2tmxr ot4aptnii3ildfs2elnmp t4 eeoir3todfp r uei;t0s2ur(rpiudopt mfciatfaDtax  nu0aee  fetad m ea( p;u0teenir tatlpteluesls) 2umxm iy4lmtnmnvi t  2tr(mo;u4teeomf3ilt m2rl( p;t4alenxoctydlpDraieo t0trum(rpiudapeelfvilt)aDtax poo0oex iociysls2ea( s;u)aetrir3io1omDrlu s;t)seumio3nu4ap nliviatfarrru  ot0aet ioctyd a2rm(ms u0 exoif iadfp eauei;s) etm(m3oudlme lnvsltf Drm( poo0texnmoeias mDumnvo;u4alxomo3ta1op  lnvols  etoxm ny1ameelietltfs2taxr no1tltomoeiyslmDuau p;t0 ltoir ta1lm e nvi () 2uoimpoydamtn nvtl()s2taxmpot1ale moeilsfmDulnvp;u0 lerif tadfpt ln s s  2xm(r3nydomtn ici s  rrmu  ;t0ole mietatfaDean ont)alerxr3oa1lm e uvi s teuo(opiu4lle mneiatfsrur( oou0teen octls aDul(msnt4aeenxf tydop  aues;t0seuo(mpou4ole livs sf 2rm(mpot1tpeomieiltlaDulu p t)texnir io1laD  n i s)t2xm(rpoydal  lfct ( s2tau ooo4aptoifciltla uan s;(0aeenxo3iytlpDeauvil(  eurir3ou1lleelncsa( a2rmumono0opeo i3ilt a umnmo;t0trtnmr tadopDrlieols  eumio3no4alenlfvtasf rraxmo;t0ope io3ilsls2rluvs;u4alxnio3todlpD  ivs s) rtm(opiudllenmnvtatfaDtrumo;o4alx ii3ild sDrl(mpn() exoif3todomtrauei;(0texrxo3nydlm e nvils)sDrmx poo0tetn f3iydfmDrm(msnu4 lermr ty1lmDe nei;(  rtrxmpoo1al e fvsat)arrmx p;t1olx  iciydfa2rln s;(0tltoxfcty1lp rauvi;t t2umirpiudom n iet t a2rau poo1aptnmfeiadfm2rl(mo;u0 exoxr oo1lmD aueo;s0truo(o3ny1am   nesls srururooo1aetnmfetldlmDumums;t4 exrmf iotomD  ues;t) rxmxo3nudaleelfvs t)srrr(moou0tltnifciydfmDrl(mo t0 lermo3totomt  ieo s0teto(o3io4lmt mieia( aDra(m ;o0tpt moctytfm em(vo u0altnirciodlmD aiesl(0 eur(m3nudlp elneta(f 2ua(m ;o1tleoif3ilsla2rln o (4teeoxo iydfat livo (  etrxo ou4opeemnvsl( aDtrxrono1tet iociysls2em(vsn(4trermrciydfptr ies;t)seuoim3nodlm  mfcslt s2tm(rpot0tpe iociat aDem(vp;t0treoio3to1laD ai o s)srum(o3io4lltelfvi s)sruaumono0aleoiiciatlm eanms;(0tlenmo3oy1fp r n sl()sruoir iy4omenmnvia() 2tax pnu0tpt io3iatfmDua(vsnt4texrxfcty1opD  uei t  etoio3io1al  lnes t)sDrmxro;t1texnifctlsfmDraumsnu0 eeniocoytfpDraivs;t) eumio3no1amtnmictatf 2uaxro;o4aeeomfciltlaDrlnvsnu)artomr3io1lpt ai olt0setrxrpnodam nmnct (f 2umu  ;o1aeenmfeiysfaDemnvo () rerxo tytfmtr n s s)t2xmxo no1op emnvi () 2rau  nt4tleoio3tytls rln on(4 rermo ia1lmteaneo ()seto(r3ny4omtnmicsls)srra(  ;o4apeomocias sDulnvp t0 lxoif tadopDeluvs s s2umimpnodlm elfci s)arur(m ou1olx  ieias mDel( ont0aexnmo3iatlptr uvs;s  ruoxm iy4ap   fci t aDrrxmpnu1tpxomiciytls2emnvs (4 lxoxf to1oat livil(0srurio iodlptemnct (faDrmu pnu4oleo f3ild sDuaumonu0trxomr oytom elneo t tetrxm3io4apen fetltfaDtmx  ot4olxomieiytfs umumo t4 etnxo3tadfat  nesl() rxr(r3nu4omeelnet s s2trxm ;t1opeomi3iadlmDulnvo (4 eeoxf3to1fpteanei;s sexm(r3iodole  ict ()srurxrp;u1tlx mieiltlm rm(msnu4 leoxfcta1lp   ivo s tetmirpoo1amtnmnetl()aDurumpno1aleoiocias a rlnvs;u4arenxr3oadfmD  uvi t setmiopnu4al emnvs s arra(mo;t4tptoiictltlaDelu o t0 reomf iatoa rlu s;s)srur(o3oy1al nmfcsatfaDururpnu1aleo fciltfaDumumon()trerxr tadfat lu ils) rtm(o oodol emfet sfaDuax  ;u4alto feiad m2uluvo t4tetomocto1fa rauvs;t srurxr iodllt lieil(f Duaxmpoo1altnif3tys a rmnvo u)artnir3tytfp  lneo;(  2xmio iu4lmeelietls) Dtrx  ;o1apxnif3tasfm eluvonu)arenio3oatfpt an i;(  etrir3io4opt miei ()sDurxro;o0oltniietatfs ra(ms t)arxniociodopDelnvo;s0teumxr3oo1al emnvtls)s2tmx pou1tltniieias s2elnmp;u0arxriocio1omD ai s;( sexrir ny4omeelictlt  2ta(mono0tptnmoeiat s ra( onu)tlxomfciotoaD auvo;s)teuo(o3ny1al e ivi ( s2trx  oo1oexoifctltfs2ran onu4tltrmoctadoa ranvil(0 eumxo iy1om e ncsasfsrtm(mp;u0oeen i3iyd sDea(vp;u0 rtomr ootlpDrau s;t0setoim oodamt mnei t  rtmu onu0olto f3iys aDuan s u4tlerxr to1opDelivi;()setoiopno4ame  ivi t a2rrxroot4ole moctysfm rauvp u)altrxo io1laDeanvs s)t2tr(o3nodllt miesas)srururpno0opeomi3ilsla uanvo;(4areoioctotlat anei;s  etrxo3iydllen neias  rtrxmpno0olxnmfciydfa2em( pnt4 etrmo tytlm rlnvo s t2tmirpnu4op  lfvs sf Dumumpnu0tle ioeiyt sDemnvp u4aleomocoatoa  ln o;s)s2tr(o oy4oltnlnesas a2urxr ot1oltnmicils a2emuvs;t) ltrircto1oatrlueil(  2uoirpou4om nlfcs () rtax  nu1ope mi3ild s2em(vo;t) renxf tydlaDe ueol(0 2um(r iy4am   neslt)sDrrurpot0oexnioetltfs2emnmon(0 lxrmocoytlm  auei t t2xrxrpoy1lp n ict s a2raxm no4olxoifeias m ranmo t0 rtrxrcoytomDeli i t)setoxr ny4al nmfeia(  rtru  nu1alxnmoeiydfaDem( on(0 ltrmociydfa r i i;t) rxmir iu4amen fcsls) Dta(  nu0alxomoetlsfsDulu ont)tlxrmr oo1fp eauvo t trumxm3io1ame  nvtas arrm(mpnu1aeeomoetlsfs2ranms;(0aeeoxrctodfmDraneo t)teuoio3io4am e fvt t)aDtauroou1alx mictas m ulnvsn()arxrxf3todfmt aivo s) 2urxrpnudlp elieias aDur( pnt4alx  octltfs rluvsnu)areoiocoydlptelu s (0 rxrio oo1ape liesat artrx  ;u4oexomfetysls2uaumo u0tetomf iotla  auvslt0seurimpnydlpen nvtlt s2umx o;t4teen o3iatlaDemnmpnu4tlenxo tadlmDraieols  exm(m3ny1lpt mnesat)artmxrpnt4optomoetlsfm2ulnvs t4artoxr3tatfa eanei;s)s2trio iy4lmte nvt tf rtrx o;t0opt  fctld m ra(mp;t0altnxf3oatla   iei;s0 2tmxr no1lpt licilsfa2trum no4tleo fetaslm2ra(mp t) rxrmf oadlm e nvs s0 2tr(rpoodlm emfvtas)srtmxm ;o0oeen fcilt mDranms;t4 eenmfciydlmteau ols0trxmir oy4alenmnvi s aDtrur ot4oetniieiasfm emuvo;u0 ltomr3ootlpt  ivi s0 rtrxmpiydlm nlictls)artm( p;t4oetnifeiad m uau snt)tlxrmr iydlaDrlnvi;()s2tm(r3nydlm  mnvtas a2taxm ;o0tpeoifctadla2ean s;t0texnxr3tatfmte u s (  2xo(o3nodaltnlfvtas)srrr( ont1opxo oeiytls2rl(mp;u4 lxrir oatla r n s s) rtrimpnydolenmncs s  2rm(r ou4apenmi3iyt m rl(ms (0aexrmf ty1lmD au i;t trtoim3oodal  lnetls sDur(rpnt0aptoiictld a2rluvp;u)aeeoxrciy1opDelneils)seurxo oo1apee ieil()aDta( ooo1oet  oetasls2eanvp t0 rxoir tatlmtraneslt srum(mpou1al emfvtat a2ta(root0olxo f3iadla2elnmsnu4arxnif3tytomt luvo s0s2um(r ou4ope  ivias)a2ra( oot0oex iictadlaDrl( p t4aexrmf ia1fatr ivilt0trtoxopoo1lme  fvs tf 2rrx oot4tpxnmfeiasfs2eanvs;t0altnxo oy1opD anvsls0 2to(o oy1aleemfeils  Duax  ;u1ape ifcils mDemnms ()arenif3iytoaDrli ilt) rtoxopno1optnlnci (fs2rrxr nt4tltnii3ilsfa2rauvo;(4tltnxr oadlp  ln s t)tetr(m3iodlltemfvta(fsDtru poo1texniieildlm2rl( o t0tleomoctatlm ean o;s)tetm(o3nodlm nlncs t)sDtau poo4oex  feild aDran snt)aeeomf ta1opt  n i s0trxo(m oodol n ivsls)arrmxrono0aetnmfeiatlmDuan pn(4tlerifciadfp rlivsl( srxrxm ny4ol   fvi t aDrmurpno0tlt iictas a rlumon(4 rerio3oo1optr ueo;s) 2uoir3oo4apee iesas)artmxm ;t1texo iciad s2rmnms;(0aleoxr tydlaDrlueil( seurio3iu1op n ieslsfa2tmu pno4opxoiieilsfs2ulnmo;u0 exoifcoo1fmDe uvi;s0trtm(opoo4altemiei (f 2ua( p;u0tpt mi3iys s2em(vo;u0teenxf io1laD  uvi;s trurio3oodame mfeia() rtmx o;t0tpe mictysfa elnmp () lxnxr iadfpDranvolt texo(r nu4lm emfetls aDta(  nt0ape  feiadfs eaumpnu) etomfctytom ean sl()s2uoir3ny1lpt micia(fsruaxmpno4aet  o3iydla2ea(vonu)aetoxf tytlm   ies;s0sexrimpou1ap nmfes tfa2trx p;o1oetoifeiatlm2ra(mpn(0treriocia1omte ieo;s0 rxo(opny1lpen fctls)s2ur(mo;t1tlen f3ildlsDemums;(4texrmo3oydlmtraieils) etoir3nodlmtnmfct sfartm( poo1tpxomfcilt a2el(vp;(0aeeoxr iotoaD  ueils) etrxrpno1omtnlicslsfsDuaumpou0oleomoeildfaDean pn(0 ltnxo3tydfpD aneo;t0seuoiopiu1opt  fvil(fsrurxmpot1opxoifeildfmDraumpnu0trtnmo3iytla elnvs t)setr(m3no4ol emfci sfartau oot1tpt mieiydlmDulu ont)arenir3tadfpD li ils0srxoxmpnudopen ivtatf rurum ;t0tlxnmoeiasfsDean s (0arxrxr iodlatelu s;s)trtrxm oydlleelfvsas  2tru  ;t0apxomfeiad a ulu p t4alxoirctydom   n i;t) 2toxr oy4am n ncsltf 2ra(mpou4apxnmoeiytfsDem(vs t)aetrifciodomt lu il()seum(m3oy1ole  ncta(fs2umum ou1alt mieiasla2ra(mo () ltrif todlp  aivsl() rtrxrpnu4apt mnvtls)aDuru pno0olxnifetldlaDulump;u4aeerxr3ootlpteanvs s0trur(opiu1aptnmfvt ()srtax p;t1olt  oetysfa2eanvo u) lxnircto1fat auvslt)s2uoxr no1ap emncsat)a2rr(m ot1tltnmo3tytfsDrluvon(0alxnxf iytfpDrlu sl(  exo(o nodlmtn iesat aDtmxmoot0teen feils a2rmums t0 etnmr3totomDrlnvi (0srurimpno1om  lfcias) 2rr(m ;u1oeeoioeiadls umnvp t0alxnmfcia1fat aies;s0sexm(m3io4apte icslsf Dra(roou4opxoio3ildlmDum(monu)aleoifciotlat lueo;(0trtmir3ou4alt mieiasfaDta(  nt4tpxoifciat a2uluvs (0altrmf io1lpDe nvs;s0s2xmio iydolenmfei t  rrrxrpou4aee  i3tytls2uln on(0texnmrcoatoaDr ueo s0setm(o3nydopen nvtls)srrm(mpot0altnif3tls sDeln pnt4tetnxo3oodoateaies;( s2xo(o3oo1ol   ivil()srtax pno0tetomfciatfs2uauvo;u4 lxoxo to1fp eauei s0 rxm(r3oy4lptn nvta( srrau  no4oltnifeiytfaDra(mpnu0 rxnifctatla  an o ()trurirpou4am nlfcsls aDumx o;o1aeto f3iltla2rmn o u)alxoif iydfmt  ieol(  exo(o3no4lpenmnctltfsrtm(rpno4tpenmi3tld a ua(vpnu4 renir ty1lat ai sl() 2toxm nodol   neia(  2rmxmpoo4altoifeiatlsDulnvo;(4tltnxf3oadopDrau ols  etmxmpoodlp elneils arrr(rono0aee iicilsfs um(monu0aexomfciotomD li sl() 2xrimpno4optemneilt  ruau  no1tlto o3iltlm2ua(mo u4artrmo oy1fp ranvo ( srxmxopio1olt mfcias arrmu pnu0aptomoetldfa ranmonu4artnxo oa1fa eauvs t) etrir ny1lptnlieiat a2raumo;u1olen iciltfmDua(vsnt)alenio ta1faDeluesl()sruo(mpiudomtnlfcslsfa2ua( oou1aexnmiciyd aDulnvo (4altrmocto1omt ai s;()srtmxr3nu1am n ici s sDtmxm oo0tlxoii3ilt sDrm(msnt) rxoio tytfatr n o;() rxo(r3nu1alt  nvi s) 2umu  no0apxo o3iadfaDua(ms u) rxomrciytoaDeli i s) exrim oy4llenmnvsat) Dra(m ou1teto i3tys mDrmnmsnt4trenxociatopt aueo s) exr(m3nudomenlicta( sDrmumoou4tetoii3tldla ran ont4 lxomo iydlmDr n i;(0sexr(r nu1omt mnvslt  ruaumo;t4tex mfciadfm rmn ont) ltrmf iodopD livslt0s2xrio3io4alt  ncsl( a2ra(ro;u1aptn oeiydfa2eanvonu4teerircoytfat lnvo;s)texmxo iodam elnet (farrm(r ;o0olx mi3iytfsDem(mp;u) exomociydfa   ivo;s0 2tmxm3iydlm  licsls  Dtr(m ;o4aleomo3iltfs rl(ms u4altnxociytoatrlnvilt0trtr(rpio1olt mnci t)aruaxm ;o4tlx if3ilt a2eau p t0 renir3oo1om   n o ()trxriopnudlmtelfes ()aDtau  nt4aexoifeiatls um( s u4alxoxf3iatla e ueo;(0srtmir ny1ame lfcs (fsDtru  ou1tltomiciasls2eaump ()aexnmociotlm elieol() rtoir nu4lltnlivtasfaDtrum ;t1aee  fetld a2uan s (0artnmociy1fa   uvi t)t2xr(r3ou4lp  lnes tf 2rau pno4tlt mo3tytlmDel(ms;(4arxrmr3to1opDelu i;(  2uoxr3iu4lptemivilt  Drm(monu0alenmfciydfa2ean p;u0arerirciytfat aivi s srur(o3oodlmt licsat)s2rrx pno4tltn oeildlsDrln on(0artrxfcio1fa  aieolt)t2toxo nydlp elfetasfsDua(rpoo4alxnmieiadlm2ulums t4altrir3tatfm   uvols) 2trir3oudoltn ivtlsf rurxr oo4oltn f3tytfa2uln p u4arxrif oodfmtelnei;()texoiopoy1op   fcta(fa2ua(mp;o1aleniieildfm ea(vonu4alenif ia1oat  n i;t trxo(m3iu1amtn net s sDtaxmooo1open ocias m eau snu0aetrmr3iadlmD luvo s0 rur(opnu4ole mictltf rum( p;u4oetnif3iytfa elu s;u0aetriocoa1lmtraivo;() rtrim3no1opt micsa()srtrumoot4optnif3tad sDrmnvo;u0arxomf oy1op eluvo;( trxrxo nu1apen nctl( aDuaumpno4tlt  oetldfs ra( pnt4 lxrmf totomtraiei;s)s2to(m oy4lpe mics t)arum(rpot4aet mi3iasls rmn s ()artoiocio1optelnei;t) 2xrxo nu1ame mncsls srra(ro;t4tlto ictlslsDrln o;t)tltomr oodlm eaueo;t0 exmxm ou1ol emnctas)s2rmumono1apxo oeiadfm ra( s;u)texnirciodomtran olt)s2uoxo no1op elfvs s  Dur(rpoo1tpt  f3ildfa2ulnvpnt4 eerxr3oydoate uei ( srtoxr oy1opt lnet (farurxr ;o1aeeomictadlm rm(vsnu0trtrmo3todoatelu o;s0setmxrpiy1opee ncia(f 2tr(ront4apeomfcilt sDrlump;u)altoio3iadlaDr ieo t0 2xmir oydop elnetl()aDua(  ;o1oee mfctas a2rlums () rxrxociy1fa e ies;t0trumxr3oo1lmtnlneia() Dumxmp;u1tpto feiytfaDuln o t4trtnmf ia1faDeli ol()texmxm io1ol  lnctl(fsDua(m ;u4oee mieiysfmDrau snt0alermrcoadfpD anvs s0 rtoim nodlpe lnctls  rtax pnu0tp
\ No newline at end of file
@@ -0,0 +1 @@
+nes t t2xoxm3oudol n fvtas s2rmump;u0teenmo3iysfsDua(ms t4 etrirciodlptrau o;()teumxo oo4op  lnvtl( srurxmo;u0oltnioeiasfsDemn o;(0 etrxr totfmtrlues t truoxr3ny1am  lietl( s2uaxrpoo1tpe io3iad a uan p;u4trerxr3tydlm rln i s trurim ou4ape  ivslt)aDumxr ou0tlx iocildlm2rlnmp t4aexrxf3todfp e i il( setmir3nu4lpt lncslsfartaum ;t4texnii3iyd m2um(ms t4tltomfciydlmDrau olt0s2um(r3oudlm n fciat) ruaum no4altniociatfm elnvo;(4artrmr3totoaDelu s;s  2ur(o oodlmenlneils)artau pnu0altn octys mDulnvo u0trxnxf3oodomtraueil(0tetmir3iu1llt  fvt s  2umum nu4oetniociydfa2eauvp t0arxnxo ootoaDrliei t t2xoim nudopeelfvta()sDuaxm no4aex iieils m rl(msn(0 rtnio iytopteaueils0trto(m3no1altn fvta()sDra( o;u0tlxomf3iyd aDumumpnu0tltrio3oo1lmt lnei t trxo(r3iu4op  mictls)a2tmum ;t0tlxnmoeiasfs2ran o u)teeoir3iy1fp e u i t0t2xmiopny4ap emnvi t aDtru ono0tpx mi3iatfaDuau s t)aetrxf tytlpDr ues (  exoxr3ou1llenmicias) ruax p;o4teeoiicils a2uanms;t)alxrirctotoat auei;t)trxmim3iu4omtelieilt  rtrur nt4tpe  fciadlaDem( o;u4areoifciy1omt ai o;s0t2xrio3iy1ol nlietlt a2rmxm ot4ape mfciys a em(ms u4treoxrciytfat lnvs;() ruoxr nydll nmivi s)a2urx pot0optn fctaslm um( o;()aetrxfcoa1oat lu ols  2xoir3nu1ap e ivtat aDtrxrooo4tltnmietytla eau pnu4 reoiocoodlp elu sls)srtr(opiodaltnlicilsf rrmx oot1texnif3tys aDraumo;(4artoxo3oa1lp  ln ilt) rtrimpoo4oleelivtat)sDrrxro;u4aeen i3ilt aDemnmo t0 lenmf oodlm r nvil( tetmxr3oo4ol  mfcsls)arrmx  ot4tlx  fciyt mDemn onu0tltoio iytop raueo (0t2urio3ou1am n neia(fsrumu  ot4oltnioeiytls ulnvo u0altoxr3totomDeln ols)t2urim iudom emneiltf rumu  nu0ape mietldlm2rlu snt)trxoxr io1lm r nvs s0 2uoxm io1ole  fvsl( a2rr( p;o1olt ifciytfa2uln s;t0arxrif oo1lp ean i t seuo(mpiu4ll  mfvia() Dumum ;t4alx  ocilsfmDumuvpn()aeerxfcty1fp r uvi;s0srxoxr3iodom  lictls sDtrur ot0apxnmfeiytlmDemn p (4aexrif tydfm  ai il( s2umxo oy4opt lnet t)arumumooo1tpxnmfctadla2emn pnu4trerxo tadoaDelivo;() ruo(r3iodole lfeiltfaDua( o;t0aeenmiciysfs eln s;u)altrxocoa1lp e ueo;s) 2urxmpno4amenlnci s)aDtmu  nu0aeeoif3ils s2em(vo;()altrio3oa1fa  li o;(0srurio nydlp emncil(f 2ra(mpoo4opx mictydfa rl(mp t0aetrxo3oo1optr nvs () rurir3oy1lpenlnvilsfsDtaumoot4ape mf3tlt s2ran o t0 rtrircoa1lpD  nvo s0s2xoio iu4al n nctas sDtmxro;o4oeenifetydla ranms ()aeeomrctydlmte u ils)teurxo3nodame  nvt t  2raur ou1olt mfeiadfs2um(ms t)arxrxrctatfm e i s;( teur(opoy4ole mncs ()sDtaxr ;t4olxnmoeiadfm eanvp;t0 lermo oo1fatr neols  rurxrpoy1lltemietlt arta( ont1texnii3iltfsDrmums;()tlenif oatop   nes;t)s2tr(opiudam   fvsl()s2rmx pnt1oeenmo3ild mDrmnvsnu4 rtomociotlaDeanes;t) eumxm iudlmeelnviat)a2raur ou4oleomictaslaDrluvs (0 lxrxo oatlpD auei;t)t2xo(o3iy4op nlnvslt a2taxr ;o4oeen f3tatls2elums;u)texomf oydlm e u o ( s2um(o3no1amtnlfcta(farraumonu1opxn i3iat a2ra(mp;t0tltomrcoo1lpt aivsl(0srtrim iu4ape lfetls) Durump;u1tpe mfctlslm2eauvpnt) rxrxr3totfatelivilt0seto(o3oodom emivsat)srra(ro;u4aeto octat s rl(msn(4aexnmfcoatlpD ln o s0trto(o3io1ome lfeils)s2raxmp;o4aptnmictls a2eln pnu0tlxrmf3ootfm r nvsls srumxrpny1alt mfes (f rumumpou1alt mi3iyt a um( p;u4tetomo3iodlp eau o;()t2uoim no4om  lfvsltfsDur(r no1oexomo3iysfs2emu o u4aeenircta1fmD lnei ( trumxr3iudlltelivia(fartax o;t0aeeoif3ilsfm2ul( ont4aetnxo3ootomt liei t s2xrim3iy4omtn feslsfs2rrurp;o0tltomoeias s2eauvs (4treoxocoytoaDrlnvs s t2xrxo nydamtnlici () Drm(m oo4alx ioeiatlsDra(vp;u0alermocty1lpDrlivslt srumxm3ou4lpte icta( s2um(ro;t4opxomoeild s rlnvo;(0tetrmfcto1fpte uvols0trxrxmpiy4ape lnvi (fs2rr(m no1olxn ieiyt sDem(mp u)alxrmo tytfm r i o;(0t2xmirpio4altnmneilt) 2ua(  ot4opxoioctyd aDelu s;t4 rtoio tydoptrlieo;t sexoxm oo1opeelieia( aDtaxrpnu0oltomociatfs rauvs;(0tlxrmf ootfptrau i t0truo(rpoo1om  mnvs tfa2ra(roou0aex mictyslmDeanms;()aeeniocty1la e ies;t)seum(o3iu4op  lfvi () Dta(ro;t0olenmoeiytlm2rmu ont) exnmrcoadlp rlieilt0 etr(o ny1op emivsl(fs2ra(r ou1tpxomi3ias m umuvont4treniocoo1omD an i s0 rxoir oo4ome mfvi s arraxr ;t4opx mi3ild a umu p ()areoxo3oatoaDeaieo;s) 2xo(r3nydlpen ics s a2ua( o;o4olt ioctlsfm2uan p u0tetnir3oodfpte neilt  2xrxm no4llen nvsa() rurumonu4oltomfctad s eln snt0teerxf3oy1op  ln ol(0trxm(o ny1lpe lnvtl( artau p;u0tee mietys s uauvsnt4trtrxr3iytomte iei t  2ur(o3oodaltn nviasfartax  ot0texomo3tyslmDelnms u0trermr3iytlmtrlnvo;t sruoxmpoydlp   icsl(  rtm(r nt0tlx if3iytfm rl(mo;(4tetrxo iytomte ivo;s)s2ur(o ou4ol   fvsltfa2taxr nu4apt  fctltlm2eanmp t4teeoifciytopt lnesl() etmxmpiodop nlfesls  rtmur oo1tlxn ietasfm elu on()tlxrircootfmte i ilt srumxo3no4lmtemfvta(fsDurxmp;u4aee iicils mDemnmo;u0alxnmfciytopDean sls0setmir3no4am nmfct tfs2trxm nt4tlt ioetltfs rlnmo t) ltrmf3oy1lm elnes ()s2tmxr iu4ol elncs (  Drmxm ;u1oexnmocilslmDua( o;u4teerifcoo1opteai il(0srtmxo oo1lm e icsa(fs2rr(  no4olx mi3ils sDulnvsnu4 rtrxo totfmtelivol( t2xrim3oo4om nlfvta(fa2tmu  ;t1tltoioctadlaDelnmo;u0tltrirctytlaDr u o s  2tmir iy1al  lics s sDurumo;u4apto f3tldlm2rl(vpn() renxo oatomtrauei ()trxmxrpnodlme mivsl() ruauro;t1ope  feiydfaDeln s t) etomo to1lp ranvi t srtmxo3nydoltelics (f 2rr(r no1aet  iciydlm2umumsnt0aexoxfciatomtelieolt)t2um(rpoudap nmnvtlt s2rmxm oo4aee mietydfa2uanmp t)aexnxfciadomD lnei ( s2xm(r3ny1apte ivsas  Dtmu pno1ape io3ildfm2ran pnu)teenir3tydoa rlivilt)sexrir iu4op emfcsl()s2rmxr nt0olxn ieilsla rlums u4texomrcoatoa elnvsl( trtmxopnu1aptnmncils s2rru oou0oetomo3tyt m2rauvon(0aeenxo3io1op rlneslt0t2tmio3iydom  lnctltf 2rr(mont4tpt  feildfsDrluvo u0trerio3tadomtrlnes;t srur(o3oydolenmict s)artaxmooo1aptnmociyt sDuln s;u)aexnif to1om r uei;()seto(r3io1ale mfvs t s2rm(ro;o1tptoiicias a um(vp;(0 rxomo iatfmD luesl(  rtoimpoo4al e iesltfs2uru  no4ape ifctadlsDemnvp u0 eermocoa1lmtr ueolt)seurirpnudlmt mnctl(f Dtm(ro;u0tltnmfetadfs2ea( s t0 lerif3iadlpt  uvo (0 ruoio ou1omtn nvt tf Duru p;u0oet moeiadlaDulnmp;u)artoxo ty1fptranvo;s trxoim3iu4llt mnct tfartaxm nu4aex mo3iyt mDemnmp t4altoir io1fpDe n sls  rxo(o3ou1amtemfei t)a2ra(rp;t0oetnmo3tydlmDul(vo t4 etnxociodfptelu s;t  rtoimpiu1om n neiltfarraur no0oee  ictat a2rmn o u0 leomo oadom   ivs;(  ruo(rpnu1om n ietl(  Dum( o;o0olxo oeildlm ulnvo;t0 rxomo io1lmt  i s s) eumxopno4amtemiesls) Dtru pou0apt miciytfaDrm(vo t0teenioctydfpte i s s0 exo(r3no4al  lfvsltfs2tau pnt1apen f3iaslm2rlu o u0tltrmocoo1oatrauvs;s  rxrxo ou1aptn nvtat)s2ua(monu1apenmieilsfaDelumo;t4trermfciotlmtr nei;s)teuo(opiy1amtnlnes tfa2ua(mont1alx ii3iaslaDranvsn() rtomr oodomDeaies;(0s2uo(m3nodlptnmneilt)a2tr( oou4oltn fciytfa2rlu s u)tltoiociydfm eanvs;t)trtrio3iydop nlici ( sDum(r ot1ope mo3iasfa2uanvo t4tltnmr3iodopt  n sls0trtr(o ny4op n ivt s sDrm(m oo0aetnmo3iytls rm(vs ()aetnxr tatoa  aivols0t2xrimpno4lpte ieils)aDtmx pno1oexn ociydfm elnvon(0 rtoircootoaD aueol() 2to(r3nu1aleemies t sDtr(rp;u4oleoio3ilslm ran sn() lenxfctotfm  lu i t t2urio3oodop n nctatf Dur(r nu1aeenmi3ilsfm2emumpnt)alxrirctydomD au o s0 rtr(m3iu4altelnvi ( s2rmumpno0tpto f3iysfsDulumpnu) rtnxf to1lpDe ivi t  exoxrpoy4omeelivtls arrmx p;o1optn o3tls mDrlnvont4 exniociadlmDr nes s s2urio3oodoltnlnciltfaDumur ;u1apen iciytfa um(vs;u0 etoxf to1lmDe uvi;s)tetmxmpiu1op emnciasf rrm(rpoo0tlxo i3iyd a2rm(vp u4altoif tadlptelieo;t trxr(r3nu1am nlivsls) Dtaur ot0teen octys m2ra( s ()aexoif3oatlpD li ils t2urxopiy4oltelnesas) 2tm(m ;u1oet  i3iat sDeanms t0 lxoxociadfmteanvo;t0teuoxm3iu1amenmnvsl(fsrua(m oo4opeoifeiasla2emn pnt0alerxfcto1lpD lu s;s0s2xmimpnu4alt lictat) 2rm(r ;o0tlxnifciasla2eluvsnt4trxrxo iydlmDe ivo s t2xmxmpiy1lptnmfet (fs2uaxrp;t4aexo f3iys m2umuvp (0aleoxo3ia1fa rlies s)setmxr3iy1olt  ictas s2tmu ont4opt mo3ias s ran p u4aeenxoctytfp raieo;( trtrim io4ap nmietat a2tmum ou1tptomfetas mDrau sn(4arenxfciydfpteanvs (0 rumxopnu4ameemncia( sDuaumooo4alt moeiysfsDua( o (4teenxr oydfm eanesl(  2ur(r no1lmenlivsa(  Dta(m ot1opeo octatls2emnvpnt0aetnmf iotfpteai i ( t2tmxm iydlp nlfet s) rtauroou4aex ioeiasls rl(mp t) ltrif tatlate uvo s) rumiopnudoptelivtlt) 2tmx  no4aexnmf3tydls2ea( on()tltnif oodoa   n o;t0t2xmir3oo4omtnlfeia() 2urxroou4aex mo3tyt a2em( p u)trtoxf io1omD an ol()trurir3iy1ol  lnvs t)srtm(r ;u0oee  fetatfs2ulu s t0 reoio3to1lp  luvilt)sexrxo nu4ap n fctas)srrrxmo;u4aex  ieiaslmDrmnvs;(0trtrirctydopD aieo;s0 2tmxmpno1lmenlfcsl(  rururonu0tlt mi3iyd m2ra(vp;(0tleoxr3ty1lp   u o;s0teurxrpno1llte fvta()aDuaump;t1teenmoctydls emumo;t)arenxoctotfpt  uei;t t2umxrpiy4alt lfci t srtmx pnt1tlxomf3tlsls eaums;u)aeeoiocoydfptrlnvs t)t2xmir3iy1optelnviatfa2rruronu1aexnio3tadfm em( on(0 lxrxf iatoat  nvsl(0s2tmxo3ou1lm   fvtasfs2rr(m oo0aptnmo3ildfs2raump u4trxnxr to1fptrluvi;s srumxmpnydlmenlfvtlt srrrx oot1oetoio3ilt s2ul(vp (0arxnmo3tatfatran sl() exo(o oodomen nesasfsrra(mpno1tleomfctytlaDeaumo (0 rxoifciodla  lu s;t0trxm(r iydlm nmncil(fa2ra(m nt0olxo ociad m2ulums;u) etomr todlm  an i (0 etmxm3oy4amenliei t)aDurum oo1altnioeiad s2um(mp;u4 eenif oy1fp  aieilt0texoxo no4lpe  feiat) 2taumoot1alxnmieiatfm2eln p ()trerir3iotfmDeau i t)sruoio ny1amee fei () rtmxmoot4ole  octasfmDrlumpn(4trxrmr oodlptrlnvsl( truo(o ny1ape mfciat  2trumpot4teen ieiytfm ua( o;t4arenmfcta1lpD  ies s)s2urxmpou4op nmfvta( aDum(  ot4tpenmi3ildfa rl(mon(4altomr3oadlpDelueslt0seurxm iudoptnlfeiltf 2rrumpot4apxnmieias m2rm( pn(4tlermociotlpD lu i s tetrio3iodlp  lnvia()srraumpoo4oeeo o3tadfa rlnmpn()aeenio oo1fmtr i o;s s2toxm nodlmtelfvtas artr(m ou4optoifetld aDrauvpnt4aleoif ia1faD luvo s0seur(rpiu1amt lnetls)artr( ono4tetoioeiat s ulu o;(0aeermr3totom  aieils0trtmim3io1omt  fvt s)s2tau  ;o4apx iictasfa2rmumo () lxnxrcty1op   uvo;t)tetm(mpiu1omtemfet t)a2uaxmoot0ope  o3ild a ea( pn(4tleoifctytfa  lieo t0sexrxr3iu4ope livs t) rtmump;o1tlx mfciad a rlumo;t4 leoxfciadomDrlieo;s)teumirpoydopen ivt s) rumumpnt1tltn octysfsDemuvpnu4artrifcoa1faD livs s)setrxrpiydam e ics (f Dtrur ;t4aptn fetatfmDua( snt0altnir3tydlmteauvs;t  euo(r3iy4omenlfvia(fs2rm(m nt1opeoii3tysfs el( snu4artrxr3iotfpDr nvs;()seumxrpiu4ol   ivilsf Drmu p;u4alxomoeias mDel( o t4aeenmo ootlmtrlues () 2urxr nu4ll  mivslt aDtau o;o1oltomieiad aDulu o u)tetrifcoadomD  i o;t0 ruoxm3oodlmt lictls a2rr(root4oexo ieiadlm2emuvpn(4trerxf3tydoa   ivo;( srxrim3no4open fesa(fs2rmxm ot4optnioeildfa2uauvo;u0arenxo iodomD  ivi;t) 2urxm3oudlptemivta(fa2rax oou1ape ifeils m rauvo () exnxr3oodlat anei;() 2xmxo iy1lmee ictat a2tmumpno4alt moeils s emnvs t)aexoxrcto1omtr nvo;t srxoxmpoodoptnlivs (  rrm(  nu4oltn fcils s emn sn(4alxrmf oy1lateau s s t2tmimpio1lme licilsfaDtax  ;t1apxomo3tatfs rm( o;u0 eenmrcoa1lm e u o;t0trurim3nu4ape miesasfaDrrxrpnt0tle  octls m rl(vs u)tlxrmrcoydlpDeanvo;s)s2uoxm3nodol e iei ( aDuau oou4oexoifeiydls2ea(ms () ltrioctadfaDean s t0 2to(m3ny1lm  mivi tfartrur nt1oleoioetytfm2emn o (0trtoiocoy1lmDelnvo;t srxmxr3io1apen iei sf rta(r ;u4teeoiictlsfmDrl(monu0trxnif oa1fm e ivo t  eurxmpiodlltnmnvsls srum(m ot4tleniietad a elu snu) rtomf3ta1oaDrauvi s seur(opno1alt mics t srumumpot4tptoif3iadfmDuau s;u4tlenmfcoy1fp e uvs;t)s2urxr3ou4ap e ivils) Drrx oot4olenifciytfa emn s;(4aexrxf ootoptran i;s sruoimpnu1amenlncsasfs2tmumpoo1oleomf3tat a2uan s;t4trenxo iatfaD livi s0truo(m iudlpee nvtlsfs2um(mpnt0olt mietatfm umums;()teenif io1faDraiesls0trtoim ou4llte netlsfs2rmu onu4aex  i3tatlm um( s t4tetnmr3tydlmt  ieol()t2tr(opno1lltnlietlt aDtm(ro;o4oet iieiys mDumn o t) etnifciy1omD  i o t0s2xo(r3oy1om emnesat  Drmur ou1oexnmf3iytls ea(msnt0arxoifcoy1om elu slt0t2urxm3ny1ll   icils s2uru pnu1opeoifeiasfm2ulu o;t0altrxo3totfmDrai o;()sexmxo3io1open ncia(faDurx pot0ape  ietadlm2ranmp;()artnif oy1lm   i slt srxrir no1amtelfvil()arumxmo;o1oex ioeiatls ul(monu4 renir iytfpt li ils)trtrio ny1ap n net sf rrax pou4tet miciat a rln pnu4trxomrciydfatrauvs;()s2to(o3oo1ol nlict s)a2tm(roou0aexo ieilslsDua(vp t0texomrciatlmte i s;s0 ruoxm oo1open ivsls  Duax ooo1aexnmoeiytfsDul( on(4altnmfciy1faD aneo;()texrxo3ny4lptemfet s  Duau  ;o4tlxn octatla2ea(msnu0 rtnir iy1opDe ies;()tetmxrpny1alt mnvi s sDum(rp;u1tpe mi3iatfm2ra(vo;u)aeenif iadlate uvo s t2trim3oy1op   fct sfaDrmuroot4tlxnmoeias sDua(vs (0tetrxrciydfa   ivs;s)srxrxo ny4ap emfvs t) 2uax ono0apx  i3iys sDea(vo t4trtoif oytlpt  nei t)teumir nodal elivsa( a2uax  ou0oeeomi3tls m2ulnvo;t0teeomr io1lp eau o;()t2umim nodllt lfetltfarur(m ;t1tlto oetatfaDean p;(0tlerxf3oytfm e nvo;t0 euoxr iy4llenlietas  2rax o;o4olxo ociad aDrlump u)alxomr iatfa r i s () etmio no4lp eliesa()arrrumo;o0oleoifetas s2rmnvsnt0 etomr3ta1lpDeln o;(0trxr(rpoudol emnet tfarurx o;o0oeeomfeiysfm2emnmp t0tlxnircoydfpt lu o (0trtrim iudllen nvtltfarumxrooo0alx mieiytfa el(vs;(0 leoiociy1oa eai ilt  etmxo3ou4amee neilt aDtr(r oo1alt iiciydlmDrl(ms;t0tltrxo iatfm e neolt0srurim3iy1amtnmnesls) rrm(ro;t0ape mfeias s2rm(vsnu0 rxnmf ty1lpt  nei (0trxmiopiy4optemfvslt)aDur(mo;o1texnmfeildfs2umn sn(0aetrirctatop  aivo t0t2urir3iy1ol nlnetl(  rtmxmpot0ole  fcildfs ua( snu0alxomr oodlmt aueo;(0s2xmxo3iudlpt  icia()s2trx  no4opxomictldfaDrm(vpn(0tlxnxfcoadop rluvsls0texm(o3nudap   net (f 2ua( ont1tpx mi3iys a2uau sn()aexniociadfa r uvi (0seum(mpoy1lmtnmfvsat sDra(m ot0opx  fctasla2umu o ()tetoxoctydfptr nvo t0trumxr3oodoltemicia() rrrx p;u4aex  oeiasfmDrl(mon()trtnir oadfpteaieolt0sexmxm3oy1openmnes tfsrrr(mp;u0tpeoif3ildfm em( s ()treomrcoa1lmtelnvs;() rtmxm3oo4lmeelnvs tfa2rm( pnu0aeenioctys sDrmumo;(4treniociatoa rauei;t sexmxm nu1ame lfesat aDrr(ro;u1opt  f3iatfs eln pnt)arenmfctadomDr uvs t  euoir3no4ll e fvta() ruau  nt4opeoii3tatlmDumn pnu)tltrirctadop elivi s0s2xrimpoydamtelfvtls)a2tr(mo;o4alto octyt aDran s;t)aetnir to1latraues s)teum(r3ny1omeelieilt)sDum(ro;o0tlenmieildfs2ranvp u4aeeoxf3tatopDrluvolt  exoxm nydolt  iciat artrurono1oltn octasls rl(mpnt0treoif3ta1omt auvo s  2tr(o iy1lmeeliciatf 2um(mpou4oexoifeiyd mDrlumsn(4alxomo3ootoaDraivslt0tetoir oy4al nlnvsa() 2ta(  ou0apxomfeildfsDeluvs;t) rtrxf tatom eau ilt setr(opiu1ap   ivils srtr(ro;u4opeo fcild a ua( o;u0treriocootom eln s;( seurxm3oudam n fesa(  2taxr oo1aexo i3tldfaDemn sn(0aetoxf to1om rauvo () 2tmir no1lp e ici ( a2tr(m oo0tpxoio3tyt m ulnvp (0tlerifcoadfpD  nvsls)t2umio3iudomtn feias  Drmx  ot4texoii3iydfs ra( s u4aexnmoctotlp  auvi s  etmio oy4amenmicilt) 2rr(mpnu4olenii3ilsfa raumo;t)aetnirctytfptrau ilt0 rxr(mpoudalen ivs ()aruaxmoot0aleo f3iat m2eanvont)tetrioctadlp eau slt setoimpnodomt  ivt tf 2rax pou4tetn ociad s2ea( o u4aeeoif ty1om e ivols)trtrim iu1lpt mietls  Dtru p;t1oltn o3tasfs ua( s u)artoxfcootfpDrluvs (0texr(m3oo4alen ivtls)srrrx pot1tltnmoeiltls eluvo u0trenif iodlaDeai il(  etrxo3nodap emfviltf 2raxr oo4aptn ictld a ranmonu0 etnif todomDr uvol(0truo(rpiy1lp e fei ()s2tmur ;o1tltnmfciysls2rl( s;t0 rerxf oo1op ranei s)teuoxm3nu4lmte ivs (fsrtaumpnt1tet ifcildlm rauvo;u4aeerioctatoateauvo;(  rtrimpoo1omtelieiltfaDur(mpot0apenifctytfsDelnmo;(0 ltnmr3iodlmt  i o s seto(rpoydal emfviasfaDtmx o;t0tlx ifeiatfs2eaumonu4 lenmo iotopDeaiei;s0texrxr nudamtnmivilt aruaurpou4tpeoiictlsfa uau pnt4tetoxrcoa1lpt li s ()t2ur(m3nudlp elfvils sDtau oou0olxomietadls emnvo;t) rxrmo3io1fp eaues;(0t2uoxr3oy1op elfct ( aDurx  ;o4tlxomiciytlm emnvp u)tlxnmr3iadoptraiei s0s2tmxo3nu1lltelfesat)s2umxr ;t0opxomictyd m2el(mp;u0altomrctydoateai o (  exoir iu4al  mncsls a2um(rp;o1aleniieiyt s2ulu sn()aexrxf to1lpteanes;t)s2um(rpiy4am emncslt) Dumu pot1tlto ictytls ul(vo;u4arxnxf3ia1lateanes;t0trtm(o3oudap n fvta(fa2uax  ;t0aee ioeiltlaDelnms (0tetrir oatfpD  ieo;s0 euo(m3oydal   fcta()artax oot0texnmfctyt aDeaumon(4tltoxr ia1opDeaueo s0srxr(opoydamt  ies t)sDtrxmont4tlxo feiadlm emnmp;t) rtrioctodfpt  neo;()t2toxrpiy1omenlivtlt)sDrm( ono0oltnmf3tls s uauvo;t)arermo3tadlmtrau s;s0 2um(o3iodlltelict s) 2raxrp;o1tpxomociadfs2um(vsnt0 eeriocootlpD livo;(0t2tmim nu4lp  lfvtltf 2tr(m ;t4texo o3iadlaDuauvpn()arerxf tytoa eluei s)trurxr3nydll elfvtat srta(rp;u1opt mi3tasfs emn s u0tetrio3io1laDeln s;()trtr(opoodlmtelfeslt)a2raum ;t0tlt mo3iltls2umuvp;u4 lxrxo ty1omtrli sls0 exriopio1optemiesat a2rr(mp;t4tlxo feilt sDranmpnu0teenxr todfpD  uvs s) 2tr(mpou4aleemics t)a2umxmono1tlen oetyt m ulumont) lxomocoydlmtr ivo;t0teurio oo1lp n ivi s sDuax  ot0tptoifciydlmDumu pnu)altrmo iytfmtranvo t0 2toxo io1oltnmnvta()sDua(m nt4olt mi3tatlm2rln o (4trxrmo3ty1la   n i (0 2tmxr3nodlp emfes t aDtru o;u0oexnmfetld m2ea( pn()arxriociy1opt lnvs;(0srur(r3ou4lp  lnei (f 2rru ono1olen fcildla2elnvo;() eenxo3tadoateauvsl() rxoxmpno4oltnmfvtlsfsrtaxro;u1aleoio3ils a2umnmo;u4tlxoifciatlp  aieo;t)tetr(o oudlpt  nvsas)a2tm( pou0olxo i3tadfaDeanmpn(4trtrir tatfa r i i;s0s2xo(opio1om n iet s s2rrumpnt1ape mfeiasla ea( p t)trxomrcoo1optr n o t trum(o io1lm  mivs s sDurxr nu0oeen o3iyslsDea(vp;(4arenio3oatfmtrln o;t  2tm(r oy1lmtnlfcsl()s2taur ot0aleo i3tat s el( onu0tleomfcootom eli sls seur(r nu4ol elivt sfsrrr(mo;u0apx mieiyd a2rluvsn(0teeoir3oa1fmDeau i;t0 rxrim3ny1am elfcils arurxr nu4tlt mfciadlaDuan snt4arxomo3oytoa  lueo s)trtoxm ny1altnlfviltfarrmx poo4oeeomi3ild m eaumo;u0altrmociodoa rauvs (  rxoxr3iudaltnmfvt ()artrx pnt4olen oetaslaDranvs;(0trenxr3iydlat ai i s t2to(r3oy4lm n iei ( a2uax  ;t4oeenmf3tydfm2rl( p u4tlxnmocoadfpt li s t)s2toimpny4optelncsas) rtmuronu1oltnmoeiydfs2elnvpnt4tleomf3iydlpDrlneo (0teuoio3ny1lpee iviatfartax oou1olxnmf3ilt a2ea( s t)tetrif to1opDeaueo;s)t2xoiopoodope mneilt  Dum(rp;t4oexomoctysfsDelums t4tltnio3tytlpDrlivil(0s2ur(m ou4ome  ietas) Drmumonu1oexnioeiytlsDemnvs (0tltrmf iadlm  livi s t2xr(m3oodll n nvias) rtm(rono4tpx  oetlsls ea(vpn() ltomr iadlatrlieo;( seumxmpny1amte neslt)sDrrurpnt1aeeoioetldlmDumn o;t0altrxfcoydomD  u o (  euoxr3ny1ll e netat) Dum( ont0teenif3iytfm ra( sn()teenmr3oodopteaivsl(0s2tmxmpoo1aptnmncs t aDtm( pou1altoiietaslm ua(vo t4trerif ootlaDrli o s0srtr(mpoudlmt lict (  Drmu  oo0tlx mfcilt s rmn pn(0arxriocoadfm   nvols0teto(m iydlpt livi tfa2rr( ono4oeeomieiasfsDum(vs u0texomr3oadom rluvo;t0 rxmimpiydalt  iei s srumurp;o1tltoioeiat m2uan p u4 lxrif3todfa   u s;(0s2xo(mpiudapeelivils s2rm(moou1texnmf3tad sDum(mon(0teeomocio1opDelnei (0trumir3nodap   nctl(fa2ta(mpot4tlt if3tls sDum(mp t4teenif3io1laD lu s t0srxm(r3oy4lp  lfvsl( s2ta( pou1open i3tas aDul(vs u4altomo iytop elieil( srxr(m3nydoleelneta(fa2tr(rp;o4alx mi3tadfm em(ms;t0 lxriocoy1lpD auvs s) eum(rpiu1ale mies t srra(m ;u0apeomiciydla ul( p;t) ltnxr3tatfmDran ilt)seum(o iodlmee ictls)s2uau p;o4texoifctat m2eanvo t0 exoxo ta1fm   ieo t) rtoxo iy4lm e nesls s2rmxmpno4oet mociyt sDel( s;t4trtnxr3iotla raies t)t2xrxo no1op   icta()s2ta(m ;o4tpxo fciltfaDranvs u) rtoxrctydfmt  u s s)trtmim nu4amtnmnesa(f rtmx  nt4opt iocilsls2uanvo t)artrxfcta1oat luesl()trurim3iudoltelieiat) Dtm(m nt1tle mf3iadfm ulnvpn(4tlxrxf ia1lmDrlues;(0t2to(rpoodol e fvils srua(  ot4tltnmo3ild s elumo;t4 leomf3iatoa  ln i;t teto(r3nodlp  lict t  rurumont1opto o3iyslm2umnvs;()aeerif3iotlmD li o;s trtm(r3iydlmt  nci ()artm(mo;t1tpt  o3tlt s2rln p;u4tltnxr3oatfmtrai ilt  2uo(m iu4opt mncslt)sDrr( ont1oltnmi3ildla2el(mp (4 leomfcia1omt  i o ()truo(rpno4amte feil(f rururo;u1apt  oetld a ean p;()tltoir oy1la eaieol()s2xmio3nodam nlncilt s2rr(ronu0aet iieiat aDeln s;t0tltoxo iydomt auvs s srxoxopoydomtelivsl() Drrx pou4oeenioctls m2ulu p;t) rxoxr3oy1fa rluvil( t2urim ou1lm nmfeia() 2urump;t1tptomi3iysfa em(vp;t)texrmo3iytopDraueo s t2xoio3oodopen iciltfarrax ooo0aet mociadlm rau p;u)trxrxr3tydoptrluvsls0setrxm3iu4ll  mfcta(  2ta(moot1tpxoiiciaslm2uanmo;u)tlerifctatlat  uei;t  2um(m3no4lpenlivs ()aDuax ooo4olxnmieiyd a2uln p;t0trerifcio1op  livs t0t2xmxo3nodlltnmfcs s)arrmumont4altn oetatlsDumump t) eerio3oytoa  auvo s) etm(r iodlm nmfcias  rtrxrpoo4aexn ociasfmDran o;(0altoxr ia1lpDeauei;t0tetm(mpou4am  livi t)s2rrxrpno0oleomfeiyd a2umnvsnu0arxrxo3totfatran i ( sruoxrpno1llenmnei tfsruaxrono0aptnmoctltfaDrl(vo u) eermfcio1lmDrlieols0teumxrpou4ope mfcsl()sDumuronu4apxnmfeiytfm rau s (4treoir io1op rlnei;(0t2xrimpnu1omenlfei t)srtr(ront4tet if3tytfm2rlums;() rxnmf3to1oaDeaneo;t0tetoir oy1ol  micslsfa2taurp;u1texoif3tltfm2rln p t) rtnxfcoytla e i i s)tetrim nodlp   nesas aDrmxrpno0aetnifeiyd m2em(vp (4 ltrmr3ia1la r u o;()t2um(rpoudomee nvt ( arrru  ;o0aexnif3iysfaDeanvp;t0artriociodlpte nei;t texmxr3iu4lp emfcilt)sDuaump;u4tpenii3tldlsDrl(msn(4artrio3ootlate u ils0srxrio3no4lm   fesa() rtr(mpno4tltnmictas s2emumsnt)artrxf iatomD luvi;( s2uo(mpnodll emicias aDrmuro;u1alx ifciys m2eau o (0 rtoxrciotlateauesls0srumio ny4ape lfvtls aDtr(ront1opt  ociadls rlnmont0tltrirctatfmtelneslt)trxo(rpiy4altn neslsfs2rm(mo;u1oet  f3ildfa el( p;u)aeeoxfctydop rliei (0sexm(o3no4altnmfcia(fs2ra( onu0oexnmictyd mDulumsnt0 lxrmoctodla e nei s0setmimpio4am  lieia(fa2uax pnt1oex  ictydfm uluvo u0 rxrif iotlmDe neo t)setriopoo4ope mfvsa(f 2uaxr no0oetn oeilsfm rmnmp;(4artnxo3tydom elu i;s s2uoir iy4om e ncsatfartm(rono4apxnmoetyd m eauvo u0 leomocoadopDrlneo;t0t2um(mpou4lle lfct t) rumurp;t4aleomoctysla2eauvp () exnmfctydla  livo s0 exm(o iy4ol nlncias)s2rm(  ;u1opx ifciys m2umums;t)aexnmr ty1fmDeauvi;s)srurimpoy4alt mnet (fsrtm(  ;t1aeenifctad m2ua(vont4 reomo3to1opDelneslt)t2xrxmpny4lp nmfcsa( sDurxm oo4opt  f3iadlm2ulumo () exnxocia1fatraues s)seto(mpiu1lp e nciasf 2raumo;o1teeniieias s ulu o;u0texoxf oatlpDeanei;() rxrxm no1aleemncia(fsDtm(r ou0texomf3ilt mDelu p u0treoxfcoa1fmDr u ol() rxrim3ou1ap nmictltfsrurx ont1oet mfctad s rlnvo t0tltoxocoadom r nvs;s seum(o ny1op emiviatf 2tm( p;t4tpen octlsfa2ranmont4alenmf oa1op  lu o t0texrim oodlp  lici tf 2ur(r ou1apto icias s rauvsnu0aexomociy1opt au sl(0seur(rpiudlptnmfvil(f rrr( pnu4opxnif3iyt m2ulnvpn()tetoxocoo1fmD  uvsl(0texoxr3nydlmenmiviatfaDuax  ;u1tlxo fciasfm2ulumont4tetrxrciatfpDraieslt) etrir no4lle mivia( aDumu pnt0olxoii3iasfm ulumo;t4 exoif oytopt lu slt0 eum(m oydape  neias)sDraum oo1oet  f3iadlm rln sn() rtoir3iy1lmte iei;s)t2tmxo3iydapt mivtatfa2trxmp;u4tlenio3ilsfm2rl(mo u4aetnmr3iytfm rluvi;t t2umim3no1ale lneias)a2umxmp;u1apeo f3tyslaDranvont)tlxnif iotopDeau i t sexrxr no1apt lncs tfsrumx p;u0aeeoioctyt s2rmn s (0artoif3iotoaD anvols0s2xr(r3iy4am nmfcia(fa2tmumpot4altnmieiytfm umumo;(0 leoir3iatfmDraneslt) etrio nudlpeelneiasf Dtm(rpot4alxo o3iltfaDemumo;()arerxr3iotlmDrlnvs;() rto(m io1lpee fcs (f rrmxrono4tltoioctatfa rmuvs;u) leomf iodfp  lies;s)tetoxo iu1llt mivs sfsrraurp;o1alenmietyd m2ulnmo (0 ltoxfciatlat aieol(  rxrxo oudopeemfeiat)s2rm( oou0olen f3tlt s rau p;t4altomfciydlp   uvslt)t2tmimpny1lpe liei s)a2rruro;u4alx iociatla2um(mont4 renmr ootopDranvs t0 eur(rpoy4optnlfvs t  2taxrp;u1aleoio3iltla2ulu s (4 rtnmrcoytlpDrluvo;(0tetmio3ou1olt lfctas)sDurxrooo4aet if3tatla2ul(mon(4artomrcoa1op rlu ol()t2trxm nu1lm   ivsatf Dra(mooo1tpe if3tldlm ulu s u)alenio totopD li o;s0s2tmim3iodam nlivia()artr(  ;t0apen o3iat aDea(mo t)tltrmo oydlat lieo;s)srxo(opiudopt lneiasfs2raurpou0apxoiieiyt m umuvo;(4teeoif ia1lpD  n s;t tetmxo nu4optn nvsltfaDta(mono1tlx ioetad aDua( s;(0tlenxfcoydfaD auvi t)teto(o nudam emnciat)sDtm(mpnu0oltn octydlm2rlnmo u0 lerio3iy1lmD auvols) rxr(r3iudlp nlneils sDtr(mpou1olt mf3iatlaDum(vp u) rxrxo3oy1lp rlnvilt0 rtmxo oy1amee ici (  rrmu  no1tltomf3tysfmDua(vo (0arxnmr3todoaD lnvo (0sexr(opio1olt lfctlt srtru o;t0apen ieils m ea(vp t4 ltrxf3tadfp  auvi t)s2xrxm no4ol n feil()aruaurpoo1oetnmf3tlsla2rlu ont0 exnxf todopDraueo;t)sruoxm3ou1lmtemfesatfsrrrum no0apxnmo3iatfs2rl(vpnu)trtrmr3iytfmt anesls)texoiopiy1lp n ici sfs2rau  ;u1tpto feiydlsDrmuvp;t0 reoxr oatoptr i i;t) 2toim nudap  micias srtmurpnu1oexnii3tyt m2ua(vo () exomo3oydfmDe u slt)sexm(m nu4olenmncils)s2rrx  no4teto fciysfs el( p t4aetrxf3iotoptrluei;() 2trxrpio1apenlfci ( srumx pou4apxnmfctas s ran snu0arxrxf3ootlpDr iei;(0s2ur(r ny1al n ies tfs2taxm nu0aee ifeiad mDrmnmp u4 rxnxr3iodoatelieo;s texrir3iy1oltnlicsat)artaxr nt0apenmi3tldlmDemump () etomr iotfa raiesls  exm(r3iudolenliet sfarrax p;o0oet mi3iytla2ul( pnt0altnxo3ta1lmtelneilt)tetrio3iy1oltemnvslsfs2raur oo1oltomi3iltlm2ra(vp u4 rermoctadlp   n o;t t2uoimpno4ll n fei (  Dtmump;t4opto fctydfmDrmnms (0artomf tatlmtr uvo (  rxoir io4apte nvtas)srumxmpou0olxomieiadlmDrlnmp u4trxnio3oa1op  ai il( t2xoxopio1aleelnetls) 2rauronu0olto ietlt sDrl(mo;t)trtoiociytfmDraivs;t  rtmxo io1lmen fesls)aDtm(roou1olx  f3iyd aDulumpnt0altomfcoydoaDrln o (0s2uo(o iy4am e fct ( arur(ro;t1texo fciatlaDumuvsnt)alxnir3oydopDeaivi ( sexoxm ny1lpeemneil(f rtaumonu4teen fciasfm rm(ms (4 etomf3oytomDe uvi (  etoxr oo4lmt mfcs t aDtmu pnt4aexniiciydls2rluvs ()tltoif totop  ai s (0s2xmio3nodapte fctls sDrru  oo1olen fetys m ul( s t0tltnxo3oytlmt  uesl(0srxoxo3oudllt lneil() 2uau onu4tpt moeiat a2uan s u0 lenxrcoatomD aies t)t2ur(o3oo1op emneiltfsrraumpoo0aeeoifctytfa2emu p;t0 eenxr3totlmDr n olt0teurxr3io4omtnmnei s)artax oou1olxnmf3iadls ul(mo;(4alermfcoydlaDrln ils) 2xm(o no4apeelfvias)s2raxrpnu4opx iiciltlm emumon(4 eeomf3oatfp eaieil(  rxm(opny4am   fei t  Durx pno4aet mf3taslm2rl(vonu) lxrmociytop  li o s) rtrir3oydlp emfvt sfsDtmxr nt4tetoiictat a em( pnt0 rtnxf oydlp elneslt  etm(mpnu1llte nvi s)srumump;o1oeto ictadfs rlnvsn(4altomo oadop  auvi;()t2toxr oudlmtnlnetlsfsruaxr nt1teenif3ildlm2emnmpnu0tleoir3ta1lmDr ivs;(0setm(m oudapenmfcs (f 2tmx  ou4tltniieiys a2uanmo;t4altoxr iytlaD an o t0srto(mpiy1omen ies (fa2trxr ;u4alx mfciysfmDuanvp;u0 rtoxocio1oaD au il()t2ur(m iu4omeelnesas)aruaum no1apt iieiat m rmn o;(4 ltnmocoytopDr uvs;( tetr(o3iudlpee ictlsfaDum(m nt4teenmieiatlmDrau s (0treoir3iy1lpt  nvo;t  etmxmpny4lmeemicsat srrmxrpnt0apeo feiatfsDrau on(4treoxociatfmD lu i;s)trum(m iu4lltnmfetlt  rtrurp;t0tlenmoetls s rl(mo;(4tltrif3ta1fptrai i;t0t2tmio3iy4aleemnes s)srua(r ;t1aee  fciatla2um( p (0 exrmf3ootfaD luvsl() rumir iodalenlicias) ruaxro;o0olxn f3ildfaDrmumo;(0 rtnmr todfm rlnvo;s0s2to(mpiodoltnmfvsl(fa2umurpot4opx mietad m2emuvs (4 rtoxfctodfp elies;t tetm(o3no1ll n ncil( arrr(r oo4oex iiciytls uau s;u0aeeoirciytfmtrliei s)t2to(o3ou4ll e iei s arumumo;o0tpxniictldls rl(mont0 rxomr3totop eanvi;t)sexm(o3io4lm eliet tfa2ururo;o0aexo iciysla2emnmp u4 etrxo3iadomDr uvolt teurir3nodalenmncslt)sDtaxrpnu1opt  i3ilsfa um(mo t)artnmfciydlm  lueols0s2tm(o3iu1ll   fcil() rrrx o;u1tltoio3iysfsDeau o;()trtrmf3ta1oate nvils0 rurxr io4ome licsat  rtmx p;t0aex ifcildfm2uanmo;(4tltnmf3oytlpD anvslt)setmio oo1lle lfcias)aDra( p;o4opt ii3tysfa el( on(4tltrmr3io1op  auvi;() rxoio3oo4omenmici t)aDrau ont0aexnif3iasfs ul(ms;t0trtnxrciy1om  an i;s texmxopno1ame  ivtlsfarrr(rp;t1texnif3tysfm2rl(ms;t) ltrio iodoa  livilt0sexrxopoo4omeemnvtl(faDtmum ou1tetn f3ils m2ra(mo;(4tetomo ty1fpDran i s0 2xmxr iydlmenmivt tfsDrr( ono1teen i3iatfm ea(mo (0aetoxocoadom  aivo () 2to(m oo4lp emfvtltfsruax p;o4ape ioeildfa ea( o;()texnxr3tytfp   ivs t) etoimpnudop   nvias) Dtr(moot1aexoiicild aDemn snt4trxnxf3iatla elnes ()t2xo(opoudopeelivilt) rrrx  ;u4alen f3iltlaDemu p;(0artrmr3iytla elivi s0 2xmio iy4altn fetat s2rau  no1opeo i3ildla2rm( s;() eeoif3todopD  ieo (0 rtmxr iudop  lnvils)srur(r ou1olxnmfctldfs rmums (0alxomo tatoaDe u s;s sruriopno4am  mics t a2ra(moou0oetoif3tys mDrlnvs (4trxoioctydlaDrluvs;() 2xoir iudalen fctasfartmxr ot1tpxnioeiltls2umu onu4 rtrif3todfa r u ilt s2uoxr3ou1am emnvsl(fs2ra(  ;u4opeomoetad mDel(mp;u)artrmr3oydomte ivs;t) euo(o oy1opt mfeslt)aDtr( onu4opxn ieilslmDum(ms;(0 lermrcoa1fatelieo s0 exr(r oydome lfvsa(  rurx  no0ale moctasfm2um(vo;t4texomo oatopDr ueo ( t2umxr io1alt lfvt s sDrmum ou1ole  feiad s2umump;u4 rtnxo oadoa raies;s tetmir3oudlle  fvtl(farra(mpno1tetnio3ildfaDrlnvo (0 ltnmf oo1fptrai i;t  rumxrpiu4amte nes sfartaur nt1apto fciat mDumnvsnt) leniocootopDeaivs s)srtoio3oydap   ivs t)a2tm(ro;t1olxn iciytlm2um(msnt)areoxf3iadlaDeau i;t s2xoiopnu4apenlneiatf 2trurp;u4ape  o3iytls2rlums;u) ltnmr3oo1lpteln s ( s2ur(opiodapenmieilt)srrm(ro;t0aeenmoeiadlm2rmumo t0areoio tadoaDe i olt0sexo(mpiy4olt  fvsa()aDtrxr nt4tpe  fciydfmDuau ont4artnxoctotfmDean i t0srurxopoy4ap nmfet s sDumu  ot0aetnmoeiatfa2uan p u0tlxoiociytom  luvs;t0t2triopny4lp nlfvtlsf 2tmur oo1aee  ocildfm2rlnvonu0altoxr3oodfmtelnesls texo(m3no1aptnlncils)s2tmurono1oeenif3ildlm uau s;u4 ltrio tytlm eanvi;s0s2tmir3iodomte netlsf rtau o;u0aeenmoetad mDumnms;u)altrxf tadfmDeluvs;s0setoim3oodll n ieilt) 2raxr nt4tle  fciyslsDrlumo;t0 etrmr iy1fm r i o;t)texo(m3ny4opeemivtls)s2ta(rono4opxomf3tytfaDrln s;u)artnmr tytoa elnvolt)s2urxmpoydlp nmicta( a2rm(mp;o0apenioetytfmDua( s;u)aeermr3oo1lp e n i;(0 rumimpno1oltnmivt s arrmx onu1optoifeiasfm2umu o t0aetnirciadlaD lueo ()s2to(rpny1lmee ieslt) rraxrpoo1aexniietld m2ua(msn(0aeerxocty1omDe u o ()seumxopiodoptelfcsa(  rurxm ot4olxn i3iydlm2rmuvo () rtrio3ty1opDeauvils) 2trirpiy1aptnmivs s)arurx  oo0teenifctaslm ean p;t)tetoxr io1lptr i ol( srxmxopoy1ol emfetasfs2rm(  oo0aex  ietyd s rlnmp (4altrio oa1laDe uvo;s0trtoir3oy1llenmivsat)a2rrxrpnu1openioetltfmDul(vs;(0trtnxf iydlmDrlnvi t teto(r iu1al  liet s) Dumxrono4tex  ociyd m2emnvs;t)aetrxf io1la raivs s0 rtoxrpnu4lmenlfesas s2trurp;o1aexn oeiasls ulnvs;(4tetrmf oydlate i sl() eto(r io1am e icsa(  Dumu oou4aetniictatla2rmnvs;(0trtoio3io1lpDr i i;t0srtoxopno1opeemiesl(faDuaxmpoo4ale  fciyt mDulu o u0 eenmocoo1faDe nvols  eurxr nydllt mncil()artax oot4tpx moeiyd s rmnmo;t0tltrio iytomte uei;t0 exoxo oydomte nvtas sDua( o;t0oetnii3tyslm uanmsnu) exnifcoo1fmtr i i s)teumiopoydop e iviat) Dtmxmpno0tex iietyd m ra(mon(0arerio oodoaDeluei;()trxoio ny4lmt  net () 2tmx o;u4tlt ii3ildla2ea(vpnt) lerxrcoy1lmDranei t t2ur(mpou1lmte feilsfs2urxr oo0aptnmietaslm rmu s;(0trxoir3iytoatrauvs t0 2xrio oy1ap nmfciltfartaur ou0tex iieilt a2emnvont0aetnif totla eauvol()t2xmxmpnu4ap nmnvslsfsrra(r ou0aetomociyt a2rmn s;u4tleomrcoydlpt lnvo;s  2toxrpiu4amtelnvs s  rrmx pno1oeeomoeiatla eau o;()texrmf tatlaDeaiei (0trtriopnodole mnvtlt)a2um(  ;t1tpx  fcias m ulnms;u4trxrxo3iydlpt  u i;s t2uo(r3iodaptemnetl() rtrx p;o1tlxo iciyd m ulu p () exoifcootop rlu ol() exr(o3no1lpeemfet (farrr(roou4aetnii3iysls2rmnvp (4 rxomr3ty1oaD li s;t truoxm oydll   ieiatfaDraum no0oleo ieiat a2rm(mo;t) eeoio3oodopDrauvo;() etrimpnudap e netas)srum( pnt1aeeoifciadfsDel(mp (0 renmf3ia1latr neo t s2urxm3oudomte icsa(f Dtmu  ot1aeto fetlt s ra(vpnt) eeoifcoy1fmDr nei;t trumio nydll nlnvt s) Drmu p;u4opxn o3iysla emu o (0artnxo3iadfpDeanvol() 2xrxmpnydopt mnetltfaDta(  nt0tlxo oeiyd a rmumpn(4trtrmf todlmtrluvo ( tetmim3nydol n nctas) 2ua( onu4apt iictys aDulnmpnu0 reoir ia1lm   i ol( srxrxrpno4llenlnvt t  Dtruro;o1opeo oeiatlaDumumonu0texrxo3ty1lptr ueolt  2to(m nydopt lfvt t)arrm(ro;o1teeo i3tasfsDulu snu)areoxf iydom elivo s  rum(r ou1omtnmfei tfarrru o;t4apenmociadla2eluvs t0tleomf oodlp e i o ( t2to(m io1opt  fvi s)srraur ;t0tpeomi3iadlm2ranvsnt)alxnxrciatoate nvsls  eurxrpiydapeemncias sDrmx pnu4tee iiciyslaDelump;u4 eerir to1lmtrlu i;t0trtrxo oy4ame  nci sfa2tmu  oo1oleo f3iadfsDuanvs;(4 exrio oadopteln slt t2umir3oudaptelnciat  2ur( p;u0oetnioeiasfa2umnvo t) lxrio3oodlm rau i;s0texmxm3ou1lme  fcsat  Drru p;o0apen feiysfm2ra(ms;u4arenmo oo1fpD anvo;(0seuoxr no1ap emfvilt aDta(r nu1aet  o3iyt m ul(ms;(0tltrmrctydomDrli ilt t2uoxm3iudlleelfvi t sDtmu  ou4oexomoetldfm2umn s;u)alxrir ty1fpte ivs;t0 etrim3ou4op n fct (fsrurxmpot0tpe mieiytlm rauvo;u)teerxr ty1latrlnvi;t sexrir ou4altn fes () Dtru  ;t1tetoiictlsfsDeluvs t4aetnmf3tydlpDrluvo t  2xo(m3nodomee iesa() rrrx oot1texomociat m eanvo u4 exrxr3tatlpt aivsls0s2tmirpoodlltn fvsa(fsrrrum ou1ope mf3tadfaDea(mp u0tltoxo oytfaDe uvol() 2xrir3nodomenmncta( srtrxro;t1tptoiieiadlmDrm(vs;t0trxnifcoadomD lieol()trxmim nudaptnmiesls aruax oot0olenif3ils aDuanvs;()tleoxo3iydfatrai i (  etoxm oo4optemfvsas)aDumurpno1tlenmfeiatlm uauvp;t)tlerxociadfptr ies;s0teuo(o nu1llt mfes () rur(mono1tee iocild a2ra( p () exoir3todfa r u ils)srxm(r ny1lpt  fvia()arrmumo;t0oex io3iltlmDelnvp;u) lxnxo iodlatrliei s srto(r io1omtelnvil()artm(  ;u4oexomfetys a eln s;t0 lxrxf3oydoa eaues;t)trurio3oo4om emnvi (farrrx ono1olt  i3iysla um(msn(4 lenir iodoaDeaivi;s)seumxo3oy1ole mivsa( s2tax onu1ale  i3tltfa2rlnmsnt4 ltnmf3tytlaDrluvo;(  2urxopio4ll   nvs t)s2rmxro;o1opx moeiadlm umu p ()trxoxr tydfpD li i t)srur(m iudolenlfcil(  rrmx p;o0tetnioetasfaDeauvo (4aetrxociytfmtean s;(  2toxm ou4lle mictatfaDrmu ooo4ole  icilsfm ua(mo () eerxo todlp  luvs ()trtoxo iu4lmtnmivs t  rumumpno4oltnifcilt m ean s u4tltnif iadopte iei;s srtoxr oy1ol   fvsat)aDra(mpou4tlx  f3ildlaDrlumpn(4tlerirciotfp e neo;s)t2xm(o3no1omtn fvtatf rur(m ot4olto fciydls emnmpn(4tlerir3to1fm raieo;s)setmxo3nu1lleemies (fsDuax onu0teenmocias m rl(mo;u0 lxoio ty1lpD aueilt0sexoxo ou1amenmnctl( a2trx  no0aet mf3iydfs2ulu s t4artoioctadoa eln s (  exo(mpnydomen ncsa(faDta( o;t0ale  f3tydfa2rlnmsn(4trerio ty1om r u o;(0 exrir oudom elnciasfa2ra(rpou0aex  oeiyt sDem(mp;(4trtomr3ootfmtelnvil() rxmir iy4om nlnvsa()a2taurono1tle ifctls m2uan o;()tetrmfcia1omD  n i t0 rxrir ou1lle mfcsat) 2rrxroot0ape mo3iydlsDemuvo t0tlerif ia1fp eauei () rtmio iydapee ncs ( aDur(mpot0oeeo ociyslsDrmnmsnu4tlxniociodlp r n o t0sexoxopou1lm   nvt sf ruaur ot4apx io3iyslmDrmuvp (0alermo3to1lp elu i;t trumxmpny4al elfvsl()sDrm(mpnt0tle  ocildfm2rl( o;()areoxf3totlpt li o t) 2umxm3oudape  ietl(fsrta(ront4ape mf3ils a rm( p;(0aeenir oodop  aivo s0seumio3oodlpen nvsl() Dtm( ooo4teeoii3tysfa2rlu o t4alermo iy1fm   uvols0texmxr3nu1omee netls)a2tmxmooo1tpeomoctat sDemn o;t)arerirciydoaDe i o t t2xrxrpou4op nliesl()aDumx o;u4oexn f3iys a em(vs t0texriocoa1lpD  ivols 
\ No newline at end of file
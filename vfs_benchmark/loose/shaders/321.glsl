@@ -0,0 +1 @@
+u s t  euoim iu1apt mnetlt a2um(mpoo1ope ifctyd a um(mo;u)tleomf3iodoptrlueo s0 ruoxo3oo1lp elnesls artr( pno0alxo f3iys m2el(mo;(4altrmfcootlp  au il( t2xm(rpoudol n fcsl( arumurpnu1oetn feiyslaDra(mp (0tlxnmf3oa1omtr u s;t  2ur(o3nu1ope  ict (fa2trxmpnt0opxo fctysfm2ra(msnt)texrif3todlptelu s () 2uo(r oo1lpee icslsfsrrrurooo0tleoifeiyslm2elnmo;t0 exnir3ia1la rlivo ( texoxrpnodlmenmiei tfartrx poo1apxo f3tysla2ea(ms;(4 rxoirciadfatr ies;s texo(opio4apenlfvi sf ruaurp;t0tpeomoeiydlaDuanvs;u) etnir tatfpDrlivo t  2uo(mpoodapee fcs t a2ururp;t4tlxnmo3iadla2rmnvpn(4arerxfciytfmtrln s s srumir3iy1alenlfet t  Drmxmpnu1tleomo3tysfsDumnvp t) exoxr3iy1oa rli i;s)srumio3ny4apeemncsa()sDtmxmo;u0tlt  i3tasls ra(msnu0 ltrxfcta1fa rlieols)sexmio3ou1ape  icias sDumur no4opx ioeiyd m2ranvo;u) rtnif3io1oaDraies s s2xoxm3ou1op  mivtas s2ta(  no1ape  oeilslm ra( s t4 ltnmf3oo1omDraivolt0 rtmxopoodlm nmfetat a2um(mo;u0ape  ietydfm2rm(vp;(0 lxoxf3oo1fpt  uei t0trtrxo3io4omtnmfcils  2ra(m ;u1oltniictltfs rlumo u4aexoif oydfmDe ueolt)texm(m3oudalte fctls)aDtrx pnu4oexnmociadfs2em( p u)aexnioctatfmDrlnvi (0trtrxrpny4lp  lfvtl()sDumx pot1texoif3iyslm2rmu snu4 reoio tytfp  lnei;(0seurio ou4ome mivsat aDrrxm ;t1oltnmi3iydfm ulu s;t4arenio3iydfa eanvs t0 exmxrpou1ope miviltfa2rrum ot1altomf3tlsfsDranmo;t0areoir iytom e uei t0t2xm(o iydomtnmieias)arua(rpot0apeomfciatfm ranvp t0tltoxr3oydfmtrai i;t  etrimpny4optnlivta( a2tm( pot0aex moeiyslm2uln s (0tlxrio ia1oaD lneo;()t2uo(m3io4amt lfvsl( srrmuront4tptn feils aDemnvs;t0artnir ty1faDr i s s0texoxo3oy4lmtelictatfsDrrur no1opxnioeiys m ulu o (4teeomr iadfpD  ueolt)sruoio oudlltnmfvtl( srrru pot1aptnmictas s rluvp;t4arenmf3tatfpD auvil(  ruoxrpiodomtn fcil( s2taxrp;u1aexo ieiat a ea(mo;t0 ltnxocta1lpt lu i;s)t2xoxr nu4ome mnctltf rtrxmp;t0opeoifcilt a eluvs;t) reoir3totfpD  nes;t)trto(rpnydap emfes t) rua( ono1ape ioeiys a2ea( snu)teenxr3tytomtr u i;s) rur(o oy1lmt  ieilsf 2uaum oo4opt  fetad mDemu p u4 lxnxfctadlmt lneilt) 2xoxm3oy1oltemfesl()aDtruro;u4aetomfetasfs eauvp u4aexnifcoytomt aueo t setrxo3nydlltemietlt)a2tmurp;o0olxomfeiltfmDumuvon(0altnmocoydlaD ai sl(0seurxrpno1lltemncslsfa2rauro;o1tlt iociydfs um(mo;u) lxnxf todoptrln o;t trurim3io4am nlicsl(fa2uru  ;t4aex  fctat sDeauvpn(0 eenir3tadfm rli o;t0trxo(r no4omtnmncia()arua(mo;o4olxoiicildls2umump;t4teerifctodfmt ln o ( sexrxm3iudlpt mfvilt s2tr(  ;o4aptnii3iltfm2emums;t)trenxf3ty1oat  ivilt0srur(opoydlpe mneiat)arra(ronu4tpxoif3iadla2em( onu4 lenif3iadlmD aneo;t0seuoxr ny4ap n fci t) Drau  no1oetnifctadfm2ran pn(4 reoxr3ootlaD lneo;s0t2tm(o oo4ol emfci ()srrru p;t0optomi3tydfmDran p u4aexrmf tytlaD livils0s2umio io1ape  ivsas) Dumum ;u1tpe miciys m uanvs;t0tlerxfcta1om  lnvo;s  2xoxopiy4lm elfcsls) 2ta( ont0tltnifetlslm ea(vsnt0 ltoxfciodfmDr nvi;(0sexm(rpny4om  lnei t)s2rr(r ou1tex micildfm2rlnmont4artoir iatlp  au ilt0 etmiopiu1omtemnetl() 2ta(roou4aptn icils a rln snu0tlxnifcoodfmtrlueo t  2uoiopiy4opeelivslt sDtmu p;t4ape  fciysla rmnvsnu) rtriociodoptrai slt)sexoxo nu1ol elnetls)s2uaxro;t1apeomfeiyt sDrau s t0texnirctytoat lueil() rxrirpiydol n nvia(f rtrxr no4altn fetyt m2rauvo;() lxriocoy1oat  iei;()sexm(rpoy4lp emieiat srrru  no0tpxn i3iatfm umnmpn()altomfctytom r nvo () exoim nodom elicilt a2ur( o;o4olt mfciad s emums;u0trerio3iy1fpDrluei;s srurxr oydamt  nesa( srtaumono0texnmfetytlm2ra(vs;(4 rtnxo ta1lmD ln o;t  rtm(rpoudom nlivtls a2rm(mpnt0oltomietys aDumums;u0aetrir to1lmte ies;s texrim3oydll nlivtasfarrmu  ;o0optnmfciat m2ulu o;u4aetnmocia1fate ivi;s)setrxr3nudop nmneils) Dumxm no0aptoiietyt a rlu p;t) ltrmo3totfm eaneo s)t2umirpnudomtnlivs sfsrta(mpnu4olx micildla2ulnvs;()trermf tatomDeauvi s t2uoir oodlp nmivtltf rumx o;t4tpx ii3tyd sDumuvpn() ltnmf to1om ran olt trxmxm3io4opt  fvia()s2rmx oou1tpto iciatfs2eanvp;t0 renmf3ia1lat lneo;s)teurir3iydal nlivt (f Dua(mp;u1aleomf3tldfmDel(monu0altnmo3tydfa   uvs;()s2xo(r oy1opte ieiatfarrmx p;t1tlx mi3ild sDulnmpnu)artrmf3iadlpD lu il(0 rurio3no1omtnlfvsl(f 2ua(monu0tex  oeiyt aDumnmon(0tlenmfcoa1lat lnvs;s s2xrxopio1lm  mfvs sf Drrumo;u0olxnmf3tldfmDeau snu) ltoxf3iatomDelnes;s trtm(mpiy4lmte fet () Dur(mono4teen fcils a2emnvp ()trxoifcio1la eln i t srxoio3oydllee icsls)s2umxro;t4ope mfcils m umnmp t4 eermr3oydfptrlues;(0 rxrxo iy4lptemivtat)sDrax pot4teenmocilt s2el( s;(0trerxrcty1lpD luvs s) etmio3oodal nlfcia() Duax p;u0tpenioeiysfsDul( p t4 rtrmociotlatelivo (0 2um(mpiy1lltn ics s)sDua( ont4texniiciasfa ranvp;(0tlxnmf ta1fpDr i o s0 rtmxr ou1lltnmfcia()s2rm(rpno4olxoiictls m2emuvo;t4alenircoodlp  ai o s teuoxopiydalt mietat)sDrmxront1apt  oetltlaDumnmp;() exrxocoatoa eln s;()texr(m3nodll elicsl() 2ua( p;u4olt  icild m2umuvp;t)aeeoxr ta1faD anvi t setmirpoy4alt liesl( sDumx p;o4alenmicils a rl(vo (4 etnmf oodomDrlnvi t s2xoiopnodlmtn ivia( srtmumpno4oexnmoctad a ua(ms t4aetrifctydoaD lueilt tetr(r3ny4lm  lfci t) rrau pou4oltnio3iyt m2ea(vp;t0trenxr io1fp  luvols0 rxoxm3iudlpen iesatfaDuau pno1tle ifcilsfsDulnms;(0trerif3iy1fmD  i sl(0srtrxo3iy1lm  mfvils) 2rr(rpot4tee  ociatfs em(vp u) ltomf oa1lp  lieo;t) rtr(opou4lp  mnetltfa2rauro;o0aet mo3iatls eaump;t4trenio3totfpte ueol(  exm(o nodole  nes (fs2trx  nu1tlx iieiysla rm(vonu) rxrir iodlmDrlues;t srto(m nu4alt miei ()artrxrooo1aexo i3iytlmDrlu pn(0tlenxfcto1lm eluvsls  rumir3ny4lp emiesls aDumur ou0aee  iciaslm ulnvp u4arerxf3oytfp  luvs s)tetoxm nu4om emivtlt)s2rr( o;o4tet  f3ias mDeanvs t)treoxoctadomt  nvs ( seurxrpiudomt liet s)a2tmuro;u4optn feils mDea( s;t) eeomo io1lpDr neo s srurxr io4altn fcsatfa2umx pot1alxo feiysla2ra(vp (4tleomfciadlptr uvi (0s2tm(rpou4alenlict ()artr(rpoo0oeenmieildfa rmuvon(0 lxnif3tadfaDrau ils0 exo(opio1aptnmfes s sDumumo;t4alxo o3taslm em(mo t4arxrmrcoadoaDraies;s  2xmio nydame  nctls aDrm(m oo0tpxo fetlslmDuanvo (0aexoxoctytfmDeau i t  2uoxmpoodamte fvia( arua(mpnu1oltn i3iasla eaumo;t0aleoxr3tytfp  lnvi;s) 2xoimpnydome liesat) 2rru  oo0tlt mf3iytfa um(vpnt4 exrmo oo1fa e uvo;s trxmxrpiy1lm nmncs t  Draum nu1oeeomo3iltfmDel( ont0arerir ootop e u s;t  2xoim nudlmt mfetasfsrtmxrono4tleniocilsls elumon() eeomrcoa1omt anvi t  2tm(o3io4lle  ics t)sDrmumoou0tle  fcils s umumon(0trtnxf3ta1fmDraues;s)srxr(o3ou1alt mfei ( a2tr(mont4aee  i3tatlaDua( o u0tltoifctotomDeai slt0 rxr(opiy1ap   nei t) rrr(mont1ope mi3tyd aDumn s t)arxrmr3oadfa   ivs;t0t2xrirpiu4openlivi t  Dtrx pnu0tlt  f3tatfa2rl( p (0 rtrxf todlateai o;( srumir3iudlpe livt s)artmxrp;t4tpxnioeiasls uln s u)trxoir iatlaD  u il(0s2tr(m3no1amt  feils)a2rm(mp;u0altn ieiytls emn s ()alxrxr todfpteanvs s trxrirpno1omeemneiasfa2rmu  ;u4olxnio3tydlm eanmo;t4texoxr iytoa r nvilt)setm(mpiy4om emiei t) 2umxrpnt0apeo i3iytfm rmnvo t0aetrmo oydlpD  n s;t) rurxrpiudapeelfetl() ruau  ;u4apxo f3tas s emn snt4 exomo3tydlaDr u il(  2trxmpiodom nlnct s srrm(mpoo1opto i3ild a2ea(vp t0alxoxf tydfm r uvo t0 2xo(o3nu1lmtelivtl()srtrurp;t1tpeo ieiltfsDrln o () ltomr3iatlm ean i;s truo(rpno4ame  fes s srtmxroou4tlenii3iat s uauvo u0alxrxr3oytomtranei;t0seumxopoo1lpeemivt sf rta(r ou0alxnifciysla2ra(vo;t) rtrxfcto1faD lieils) 2urio oodaptn iesas)s2trx oou1aetomi3iysfa eln s;t4tltoxo3oadlaDeaieo (0t2uo(mpoo1lpe  fvs t) Dtmu pnu4texomoctytfsDem(mo t)arxrmrciy1laDeaueo t) ruoxrpoy4olt mfeils)s2uau  ou4altoio3iydfs uau p;u4artoxfcoytfpDe ivi;s)t2umxm3ou1lpenlfvs t)s2raumo;u4texnifetldlmDrmumon(4 rxnir3oatfmt  ieilt0srtmimpnodlmenlnctl(faDtmum oo1aetoio3ilslaDrlumo;()alenxocoodlaDrau s;s) 2urxopoodame lnvi (faDumuroou0aptniietlsls uanmon(0arxoxr3tytlate ivs;t s2uo(o iydamtnlnetls aDta(rooo0apeoiicildfs rmn s;()artrmocto1lpt ai s t  rxr(m oy1olt lnvsl( sDrr(m ;u1optoifctyt m2ul(monu4 eeomf ty1lpt  neolt)t2xm(r oo4ope  nesat a2ur(rpno0altomi3iltfaDul( o (0arxoxr3oadlm r neo;(0srumio3ny4lmtn ieslt a2rm(m ;u1alt  oeiad mDrm(mo;()arxnxr3oadfpD an sls setmxopiu1omenmivilt)srrmu oou1opxniiciadfm2el(vont0altrirctotlpt  i s t0 exoir iy4lmt mnct s) 2ur( o;u1open f3tatlm ran s;(4 lenxociatfmDr u olt  etrir iu1aptnmfctl()s2rr( ont0tptnmf3ilsls2ranmon(0tlerioctadfpt  n s t sexmxm3iu4open nvsa(fsDtr(rpnt0oeeoiociat sDemnvsn()teenxo ty1fm rluvs s srxmim3oy1apee nvtl()a2umum ;t4texomf3tyd s elu sn(0aleoio3iatfpDean ols0 2umim3nu1ap emicslt  2tau  nu4ole moetyt aDuanmp (4trtoxo iatfpDelneo s)s2xoiopiy1am   neil()sDuax  nu1olx if3iltlmDuauvo;t0 etoxf oa1opteaueolt0t2tmimpiy1lm elnctatfaDuau  ;t4ole miciysls eanvont) eerif oo1lmD livo s0srtrxrpnu1omte nesl( aDrr(rpou4oetomocilsls2eau o u) ltoxr3totoate u s;s) euoim oy4olt lfeiat  rumurp;o1alt  fciyd m2elums ()aeermf3oatfmteluei;()seuoimpnodomt  ictat)artmu p;t4tlenmiciydfsDeluvpn(0tlxoif ootfa eauvo () exrxo3ou1ol  mncilt) Dtmu  oo1oexnmfetldfs2eln o;u0teeniociodfa  ln s t0srxo(m3nydapeelncsa(f rrrx o;o0tlxnif3tytfaDrlumo;u0arermo3oydla  luei (  etmio iodapee ncil() rtr(r nu4texo icildls2uau onu)alxrir3to1fat anvolt) 2toxo iudlltnlnct s  Draum ;o1tpt moeilsls emumpnu4tltrmo ty1lp elues;s  rtrxrpoo4omtemfei sf ruaxr no4oexomo3iasfmDraumsnt4 reoxr oy1oaD anvi;(0trxoim3oydolte ivi tf rumum ;u4tpx mf3ilsfa ul( p t4 ltnxfcoa1fpte n sls0 2uoim nu4lp  mies ()a2taumono0aee iieiyd aDeauvs;t)tlxomo to1fp eaivil(0s2ur(rpnydamt  fct t a2um(rp;t0apenifeiat a rm(mp u4 eeomocoydlaD  u s;t0setr(m3oy4aptemnctlsfsDrmxmpnt4oetnmociydlm2umu pnu0 exrifctotlp e neo;()trxm(mpnodll e neiasf ruaumpnu1tpxoii3tytfsDuaumsnu4 etnif todopte uvil(0s2xm(o3ny1am n iei s  2rmum nu1apxniiciadls eanvon(4aeenmf oytfm elnes t0t2umxm iy4ol nmicsls)aruaxroou4tlxnmfetldlmDul( sn(4 etnmo3iytom eai o (  rtm(m3oudap  lfvtlt) Dururooo0ape mociadla2em(vpnu4tetrxf oadfa elnvs t t2xoxrpoo4openmnesat) Drmu ooo0oetniiciat s ulu s;u)altnmrcty1lp  lu olt)srumio ny4lmtelictl(f 2tm(  ot1aexn f3iadlsDelnmonu)trxnxo tydomtr iei t)t2trim io1llee ivs s)sDuaum no0aex  ietatfa rm( p;(0artoifcoa1faDeluvilt0 rxrir3ou4ap e neias artrxm ;o1olt io3iaslm2eaums t) renio3ty1oaDr neo s0setr(o nu4ap n fesl(f 2rax oou4tltomicild s rl(monu0 etoiocoydfatr uvslt)sruo(r oo1ol e nvs t sDumuroou4apt ioeiat sDrm( pn()tetomf3ootfp raivolt trumimpoudap nmfvsas a2rr( ont0oexo fciltlaDum( on(0 rtrmf3iodfmtelu i;t s2tr(rpiy1ape  fvi ( aDururont1apen ociatfs2ranmp;(4trtnir tadlpte n i;s  rxmio nu4lmenmnvs t  rra(  nu1tex moctlsla um( p;(4trxoxfcty1omD lueo;t trtrxopny4om elfvtls  2ra(m ou1olxn fctytfs2umump t4tltnxf todoa r uesl()srtmxm ny4lpe mivia()a2ua(  nu0ole  f3iyd m2ul(mo;(0arxnmoctydfaDrai s;s0t2tmir3io4lle mfcsa() ruru  ;t0apxoiociysfs2ean snu) rtrxr3totomteauvi;s)seumio3io4ameemnesas)srua(m nt0aexo fciysfm emn onu0aexnxo ia1lp  lieo t)tetm(o3iodopt lncsa(fsrur(  ou0tpeo f3tys m uanvpnt4 ltnmr todlmteaneo (0 2xoir oy4amt lietat)srtmum oo0apt  ociyslaDumn p t0texoio tytopteln i;s)trtr(mpoy4om elfes tfsDuaump;u1oee  feiyd a2ean o () rxnxf oodoaDelu slt) 2xrxr3nodlltnmnei (f Duru o;t0alx mictltfaDumn p;t0arenmr oo1lp ranei;t srxmio iu1omenlnctls)srrrx  ou1tlenifeiys sDrmnvo ()arxnif3ootlm ran o;(0seuo(o3nydop emici t)srurxmpnu1tetnmi3iadla2ra(vs;(4 renio3totfpDr ivo t texr(rpnydal  mncslt)a2tmxronu0aex  oeiys mDuanvpnu) lxrmf3oo1oatr n i (0srtrirpou1ome mfvsltfaDrru p;o1oeeomfciltlmDelu s (0 ltrmr3oydlmD  nvi t0srurir iydlpe lnei tf 2rmump;o4tpt  feiydfa em( o;(0aeenxociatom raivolt0 rum(r3nydamenmivs ( arumump;o4tlt ii3iaslaDelumsnu4artrxrcta1fm raivil(0seur(opiudlptelfet tfarur(mpoo1teen o3iltlm rmump t4treoxfcoatom  lneol()trxoxr iodolt mics (  2uax pno4tpt  fetatlm rauvs;u)aexnxf oo1lptelivs;s0seumxmpny4lmenlnvia()a2umxrooo4aleoiocias m rlnvsn(4trxrmr3oo1lmD  ivolt)tetoir nudale livils a2rm( p;t1tpeo f3iys mDrauvs t) leoir oo1lat li o ( trurio3iu1open fciatfartr(mpou1optomieiyslaDelnms u4 reomo3oo1fptelnvs;t)srum(mpio1ome  feslsfsrtm(mpoo4optniietls m2rmu p;(0 exoio3iotom   n ols) eurxmpoo4opte fci (f 2rrumo;o0tlt mfetlsfm elnvsnu4tltrif iotfmtrau s t) 2tr(rpou4lptelfvilsfsrumum nu1opxn i3iadlsDra(mo;(4aeermr3iydoaD liei (0t2uoxm oo1altnmnei ()srurumo;o0tpt mi3tatfmDum( p (0teenio3ia1opt an sl(  2xrxm3iy4ap  mnesl( a2ua(rp;o4apx mf3iydfm elnms;t4texnmf3oy1latrau o;t)srtrirpnu1lmtn net ( srumum nu0oetn i3iydla eanvsnu0trxrio ootfm  ln sls) 2urio iudlpte fvtat) Drr( pnu0tetoif3iadfa eln p;()texoxr3oatoa  livsl(0 rumxr3oo1lp   nvta( a2tm( ont4olx mfeiysfs2ra( pnu0tltomr3oo1fat lnes;t0 rxmirpiudol  livs t)sDtm(rp;t0tet mo3tlsfa2ua(mpnu0tetnmo iy1faDrai i;s0 exm(opno4lpeelnviatfaDum(r ;o0tpe iiciyslaDulump;t0 lxnio iadop rln o;()teumxr ou4aleemietl(fa2rr(mooo4aet mfciydlmDuaumo t0aexnxf ia1laDeauvi;( s2um(o3no4aptnlfeia() 2tm(m ;t4opx  ociysfaDum(monu)trtomr3oatoaDr ies s trxo(o3nu1lptelivi () Dtm(m nu0apxn oetltfm eauvo t0aetoifcoadomDelues t)trxo(o oo1omee ivils  2truroou4apen ietydlm2ra( o;u) rtrif oy1lmDe ueol(0 2um(mpio4lmtnlicslt) rrr(mp;u4olenioeiadlaDua(ms (4alxnxr3oadlpte neilt s2xoxrpoydlpe mictat) Dtaum no4aetn ietyslaDumuvp;(0artnif3tydlpDrau ilt0 2xr(opno4lp n fcia( aDuau p;u4aleoifeiasfm2eanmp;t0 rtoxo iatomDe nvs (0setr(r3oydlltnlneslt)aDuaxrpoo0opx moeiatls umu p t4alxnif3iytlatrlieol( srxmiopoo1al emfvta(f rraur no0oleomf3iysfm elnvp;u4tlxrio3oatfm raueols  exoirpiy1al elfvilt aDtaxm ;t0opt  fciydfs2rmn snt4 exrxf3io1omt  i sls0trurim3oy1amtnmici ()aDur(  oo1alx ifeias mDemn ont0aetnirctodfpDr n i;s)srum(r3oy1amtn fciat) rum(m no1tlen oetatfaDrl(ms;u4 rtomo3tydfptrln i;s) rxo(o3oydlpt  ncsl()s2tm( p;u1optomi3tlsls rl(vsn(4 etnir3ta1op   u s s t2xoirpiudop  mnvil(  ruax pnt1ape mf3tydlm2elnmp u)trtrxrcoytfmtrln s;t0 2uoio nydameemfvilt  Dtr( ont0opxo i3iadfs2uln pnt4 rtoxr oodlmDeln i (0seum(r3iu1omee ieil( aDrr(rpnt1olxoii3tltfs2emnms t4aleoio3todlpDeaneo;t0teur(m oo4lmt mneia( sDtmxr oo0tptnmfcilsfsDrmn s (0trtrxrcoo1lmDe uvilt trtmim3ny4ape  ietl(f 2rr(m no1tpx micilt sDrlumont4 rerxf3iatlp raivi () etmxrpiudal   fvils) 2rmxm ;t1opto oeiadls emnvont) rxnmo3todlp r u o;t0 2toir3iy4omenlfcs tf rtaxmpoo0ole if3tls m2uan snt0aeenir oo1la r ueils)trtoir3oo4omenmicsls  Dur( o;t4ole moctytls ul(ms t0tltrxoctytoa elues;t0t2um(mpou1om   ncslt s2ra( ono0ape ii3iydfm eanvp;t)texrif3ootopD lu i;(0seuo(opoo4oltnmnei s arrmumonu4oex  i3iadlaDulu o t)tlxrif oa1lpD  n o (  2umxo3nodale mivilsfa2taur oo0texnmfeiytfs2elnvo t4arermrctotlpt lnvo;s0trumxrpoy4ap  miet t)sDur(m ou4apeomieildla2ea( p;u4arxnif3oy1optraueils)seuoxr oo1op elfei s aDraxr nu0aetomi3tlsfmDrl( on(0 lxnir3ta1oaD auvil(  exm(m nodaptnlnvilt sDuaxmont1oeeoioeildlsDua(vs;(4tlxoio3iy1fpD ln s;t0setoimpoy1op  lfvs sfa2ra(  ou0ole  feias a2ean p;t0 exnxocoytfp rln o t0 eumirpny1aleelivtas)sDtr(mo;t1aeen i3iyd s ua(mpn(0trtrmf3iatfa e ies t)srumxmpoo1al nmicsl(fsrrrxmpot1optniociydfsDrmnmsnu4aexrxo oatfm  auei;s0sexm(mpiodlltnlictas)arra(  ;o1apxnmicilsfm2rmu o u0 exomociatlmtrlieols tetoxrpoo4alt  iesas s2tmu oot4tpx  feiadfm2rluvonu4trtnmf3oydop r u i t) 2ur(m iy1omtemfeilt aDuaxmp;t1olt mieiatlsDeau s ()tleoif3oatlp e ieo s)trtoim3no1ll e ivi s)aDrm(rpnu0tpt ifctytlm ranvp;u0 etnmrctytlaDraivo;(  2xo(r3iydlm elfvsasf Dumu o;t4alenmfeiatlm2raumsn(0tleoxoctatlaDrlu o;( srxrirpio1amtnliet tfaDrau p;t0tpxoiieilt mDea(vpnu)arxnxf3iodfp raneo s0t2ur(opou1ope  fvsl() Dtr(moou1apx  ieiyslmDemnvsnu)teeoir tatfpDrlu slt0srumxopiu1amen iet ()srtrx o;u4tpeniiciasls rl( onu4 lxoir3tadfaDr ueslt trxoimpoo4omtemiviat a2umum ;u1texnmfeiltfa elump t0tetomrciydopt  u i t  exo(o3nu4al  mfet sf Drrumpoo1opxomocilsfm ea(mp t) eeoxf oodoaDe ivols0 2xmxr oudlpeemict () 2ra( ono0alt  f3iytfa ulnms;u4 ltnxr3iatopte uei;( s2xrim3iydlle  fvtl()aDurx oou4alenmo3taslsDemu s;t)teerif3iotomDrlivs s)sexr(rpnudlm e fetls  rrru  no0alt  o3iasfsDeln s;(4aexomf oatlatrlneol() rurxr3ou4am emivsa(f rtr(moot1tpeomo3ildlm2uauvont4tltnxrctydlaDr uvi ( teum(m oydlme mneils)aDuaum ou1aetnmf3tas a umn onu4teenmr3oodlmteanvil( s2umxo ny1op  livsa()aDraurpno4oee  fciydfs2eanmp (0 ltoir ty1lmtrlivolt) etrio iu1ll   nvsat)aDur( pno4olx  ictlsfa2rauvont4artrmo tydfmDeliei;(  2um(rpoodalen nctlsfarua(rpnt1tlen oeiytfm rlnvp (0 lxomo3ta1optrlueilt)setm(opio1lmtnmnvsltfsDrrxmpot1oeeniociad m rmnvo;u0tlenxfcto1lpD livi;s t2tmim3nu4lp emivt (fsruau  nu1oetnmo3iydlm2em( o t0aexnxf3iydoateaneolt seurxr no4opeemnvi t)artru pnt4texn ictyt m2el(vpn(4aetnmf oytlm  livi;t)s2xm(opoy1ol emictltf 2ua( poo1tet mieiytla umuvs t0teenir3ootlpD anvils t2umir iy1ll nlnctas  2rrum ou0oee mociytfs2ranmo;(4 exoxfcio1lmDr nes ()t2tmirpno4op emfcs sf Drmu pou0tpeoio3iaslm2rauvp ()tlermf3tadomD aivs;(  2xmxrpnodlle miet s)aDrax o;t4aee ifeiad s ulu snt4 renxf io1oatrai o;()tetoxr oodll  lictlt)aDrr(m ;t0tpx  f3iatfmDuln pn(4 exrmo3iatlatranvs ( t2umim nu1ol   fvtl()artau  ;u0olxo ociasfsDumump;()tlxnmfctytop raivi t)setmio3iudlmt mnci s)a2trurpnt4olt  fctldfa2raumo u4aexoircoydoa elies s0 2ur(m3nu4alee ieilsf 2trumpnt1ole  i3iytlaDelnmsn() rxnifctytoaD  nvils0srxm(opny4aptemnvs ()a2rm(mpoo1aee ii3iydlm2emnvo t0altnif3tatomD  u olt texo(o3nodlmtemfcsltfaDrr( ooo1aet if3tls sDeaump;t4arenio iydlmDeaueils0sruoim nu4amte fesl()sDrmumo;u4teeniociadfm rl(ms;() exnmf oo1lmtelivi s0seuoxr oudlpenlncslt)s2uaur ot0opx ifctasls2ulump (4alxrioctodoptran olt0s2tmim3nu4ol   fvsa(farumu p;o1olt ii3iat a2rau onu) etoif ootlat aivils t2tm(mpou4omtnlnvi t)a2rm( pnt4alx mieilt a rl(mo ()trtrmrcoa1lmDr u o t0t2ur(r3nu1om nlfetat  2tmxr ;u0oltnifeiyt m em( o;t0teenif totfp   u o s tetm(r nydale mivt ( a2taxro;t1apxnii3ildfa2em(mpnu4tltoio3oy1faD  ies;t0t2xoimpoodamtemnei (fa2urxrpot4olxnmi3tytlsDemuvont0arermr3iytfp e ueils0sexmim iu1om  mnvs ( s2taum ou4olenmfeils m2emn s;u0texomo3oytlaDr u i;( srur(r3nudomtnlicil(fa2umx p;o4apx mfctatlsDuaumsn(4trermr3io1fmDeauvils)sexo(mpno4olenlnct s)aDumx  ou4olto f3ils sDum(vp;u) ltoifctotlpDrau o;t0tetoxo3iy1alteliesa(faDrmx pou1aeenifctas a eln s ()aexnir3iodfpDelu i t)t2toim3no1ape lfcias) rtaxm oo4alxnii3tadlaDea(mo u)texrir oodfat  i ols)s2xrxm no4lm e nctl(faDumxmp;t0tlxo ieiasls uluvo ()aeeomfcoydla e neo s)s2xoimpoydole  ivil( a2urx  nu1oee moeils a emuvsnu) rtnir io1fm   u il()srtoxmpoydlp nmfesat)sruaxm nt1tlenifetasfm2um(vs () rxoxo3oatopt lnvols trxrxm3nydoltn fvsls aDtm(m ;u4ope ifctydfsDra( s t4 ltnmo3iotfm r ueo;(0 etmiopou1lpenmici ( srtm(  ;t4tpeoifetldfsDea(ms t) leoxocoodfmDrlneil(0s2ur(m oodlmtemnci sfs2tr(mo;u4apxomieiyt m2rm(vp;u0aeenmr tytopDrauei;(0trxrxrpnu1ame mnciat) rrr(mo;o4opxnmfeiadfm2ranvsnu4aeenmr3iatfaDraies;s)t2xo(opio4ope miei s arumxmp;t1oleoiietysls ulnvp;u4artnio3iydlm eli i t0trumxm3io1llt lneil(faDtr(  ;u4olxnmi3iysls ra(mo;t0 reomo3ta1fpD au o t)seuo(o3ou4al n ieilsf Dtr(r oo0oexnmf3tadlsDrmnvsn() leoxr io1fp eliei;s) exrxmpnudamt mnes sfaDrrxm oo4apxniociyd a2rlu p u4arxrxf iadoa  anvs t0trtmimpoudlleelicia(faDtmxm ot4oexo i3tls a emuvsnu) rxnmf tadla   ivols trtmxr3iodam  lfvsls)arua(r no1oeenmf3iltfaDeln s;u4alxoif3io1opD an ols) 2to(mpiu4ope mnet ( srtrumonu4apeoifctltfa2emnms u4tltoxf tytlaD anvo;(0 2xmxm3nodoleelivta() rtmxmo;o0apx mf3ils s2ulump u) rtoir3tytoaDe nvs s trtoxmpnudllen fctatfaDra(rono0aetnmfcildfs2rmuvo;t)teeoxocoytoaD livi t0 2triopno1ol   nvt ( s2umuro;o4alxo fciyt a2ea(mpn()arxrmr3iydfa rai s;(0 rtoxo3no1al  lnct t)s2uaurp;u1alx iictls s2ranvo;(0trtoircoodfp   neol(0 rxo(m3nodolt mnvtl(fsrtm(rpoo4olx mfctlt s2uauvo;t)aeerxo iotop  livs t t2uo(rpiu1om nlfet t  rumur ot0oltn oeildls2uan pn(4 renxocoydlat  u ilt0t2tmxrpoy1lleelnvta(  Dur(mpoo1ale mfeiaslmDrmu ont)artrxrctydlm eaies t)s2xr(o3oodop  lies t a2ta(mpno0apxo i3iltlsDum(vp;()artrxrctodlaDraies;( s2to(o3oudopen fetlt)a2rmu ont4open ociasfmDrmump;u4aexnmo oodlmtrau ils0 rumim oydap  mfcslt)s2ur(mo;o1aetnii3iyt m uln s t0altrir oytfpDrlivo;()s2tr(o3ny4lmenmfcsas) rtmur nt4apxn i3tlsfs rmn s;t4tlerxr3tatoa ran slt)t2urxr3oy1oleelnct s)aruau  nt0texomf3ild sDrmu s;()texnir3tytlmDranes (0t2umxo3ny1aleelnci ( sDrrxr ;t4apt io3iad m2elu p;t0 rxoiocoytlmteai slt  rxoim iy4ope livt t  Dra( p;o0aptoiicilslm2rauvp;t0aleoio io1fmD ai i;(0s2xrxm3oodopeemics t)sDtaxm oo0olt ioetysfa2elnms u4 exoircoydlm eaues s sexrxr3io1omt lneiat sDrmxrpnu4oleniieiat a uau o;t0 eeomr3tatopDr nvi ( s2tmxr iudll  mnvia() Drmx  nt0tlt mietad aDul(mpnt) exomf oodla eluei;t  2uo(m3nydoltn ict s arraxr nt1tee  octasls ul(vp u)arxrifcto1oa   nei;t0srumxo iydoptemncslt) 2rrxmp;o1opxnifciysfa eau o (0artrmf oatfm  auvo (0sruoxm no1op   nesl(farrrurono4optomoeiadfsDemumpn(4tetnxr3iydlpteluvs;s0trurir3nu1lp  lnvilsfsDra(  nu4optnifeiytls rl(vs u4 lxomo3oy1lpDraivs () euriopnu1lm emfes ()artm(  ;u1apt  feiadfa eanms;u4arxoxf ta1fmtran s;(  rxr(m iy1omt mnetlt)sDrmxmonu4tlx moetadfmDeluvo;(0aetnmo tadla elu slt0 exmir no4llt  ict sfsrtmxm ;u0opt iociydls2el( s u)alerio3tadlmte ieols) 2trio3no1lmenmnetatf 2urxrpot0alxnmo3iltfa2umumpnt) exrmr3oadlp rlu ilt)t2xrxm3iydolt mfcs t) rtm(  oo0tltoif3iadfm2elu pn(0 rxnxr iydfm  lnvilt0 eur(o3oydamen ics ( s2urx  no0aetomo3ild s ulnvpnt)alenxfcoodlpD an i s0trxr(mpiy4ome lfci s  rtr(rpno1aet  fctat m emu p t0alxnifcoatfpDr uesl()setr(opno4al   ncsl(faDtaum ot1apeo i3taslmDul(vo (4tlxoir3tytfp elivo;( teumxm oodol elfvs t  rum( pot4opxnmfeilslm2raums;u4artrxr oytoaDe neo;t  etmimpio1ol nmict ( srtmx o;u0tpxoioetadlsDul( snt0trxoxf oadlmtrln o ( srumim3iudom nlfviat) rrr(rono4oee mieiasfaDuauvonu) lxomfcootla  auvolt0 etoio io4oleelivtlsf rtr( oou4opxn f3ils s ulnvs;(4tltomr oy1lp  luvi;(0 2xriopny1lp n feil()a2rmx pno0olx  ietlslm2elu p;t)texnxfctadla r iesl() 2urxm3iu1ll nmiesl(farur(mpoo0apeo ietytfm ul( s u4 rtnir3iy1oa e ueo (0s2trio io4lptnlivslt)sDurx onu0aet  f3tadlsDra(vp t)tltnmf3ty1opDe nvsl()s2xm(o3nu1llenlivias) 2trxmpnt4opeo ietlslsDrluvon() rtoxrcoadlpt li i s0setmir nudolenlncsl(f 2rrxmpnu4tpen o3iad a rau s;t4aexoxrcto1fa   u o;()seuoir oy1ome  iei t) rumx oou1altnmoctasfm emumo;u)trtrxf todlp e n s;t)t2ur(r nu4amte ncta(farrr( p;o1olxnmf3tlt a elnmont)trerifcoa1faDeanes;t0tetr(m3oydale miesas  Draumo;t4tpen o3ild m ean s;u)altrxr3io1omDrlneo s trtr(m iu4olenmneslsf Duaum nu1olt  ieiadlm2emuvs;(4aexoxf iatlatrlieolt trtm(r3nydlm   neilsf rumxrpnu4oetoiieilslaDemu o () ltnif oy1op  luei;t)t2ur(o no1lp  lfcs sfaDta(r nt0oex ioeiat a eln pnt)trxrirciydop rlnvo (0srtr(m oy1op nlncil() 2rmxronu0tltnifeiysla2ranvsnu)altnxo3oodop elu ilt)t2uo(r3oydaptnlfvils)arrmxrp;o1oet  f3ilslm ulumo ()aeermo oy1opDr i olt) rxo(o iu1om nmfet s aDururoot0aptomiciad aDrmuvo;u) ltoio3iotfmteli ol() etmxo3oydlmtemfvta()a2ur(r ot4apxnio3ilt m emnvsnt4 exrmrcoo1fa  au o;(0tetm(m3oydlmt mfctlt)arrr( pno1tpeo o3iltlaDulu o;u)artnmr oydlmDrln i;t s2xoim3oy4llt  ivs ( s2rru pot0tlx moetadls rmnmo t)tlermr todlp  ai s;t0t2xo(m iy4altemfei ( srrmumpoo0tpxo ictat s2umn p;t) eeoxr3oatfpDeliesls) 2tr(opno1lm   fvtls aDurxmpno1aetnmfeildlm ea(mo;t)tltomoctotla raneolt) 2ur(r3ou4omtemnvtas)sDuaumpoo4tlenifciad a umn pnt0 reoifciy1late n sls  rtmirpou1lmtnlnetl()a2umxroot4oeto icildla2uauvs;()teenircootfmDr nvo;( setmxopiu1opeelfesl(  rta(rpnu1opeomo3iydla rlump;u0arxoxfciydoa raivs t srxm(rpou1omte icsas)s2umxrono1optomi3ilsls uan ont)artomr ootfptraivo;(  rurimpnydlleemiet () rua(r nu1apeomi3tls aDelnms ()aeerio tytfpD anes;s texoio oy4lpenmnvtat)a2raxr ;u1apx  i3tltlaDrln s t4 rxnircootomte u il(0s2xo(m nodll nmfctat)arua(mo;u0alxn icildlm2rauvo u) etrxr tydoptr u olt) euoxr io1amt mfei sfsrta( pou4olenmiciytfa2rlu s;t) lerxo ta1faDrlnvi;() 2uo(r oy1om  micsa(f Drrumo;u4apxomfeiad a emuvo (0arenmo3oydom rau i () rtm(o oodoltemncta()a2taxrpot4tpe  fctlsfsDulnmpn(0 lxnio3iytom rau ols0t2uo(o3no4ap nlici t)a2tauro;o1texniieiasls2el( s;u)aeeriociydlm elneo t s2uo(o3iudam e ictlt)a2ur(ront4olxn iciys aDemnmp;(4 lxoif tytlmDelies;t sexrio ny1apee nei sfaDtrurpou1tlxoioeiad m ulnvp;t)trxnxocoatfp r i ilt sexmxmpiy4op nmivi ( s2raurp;u0oee iieiydls2umump u0 reoxrctydlpt lu slt0s2trxrpiudoptelfcs s) Dtmurpoo1tptoiocils m2ulump;(4 reomf iydfa raies;s0srtrxm3oodlpenmivt t s2trxmpot4tptnmiciaslm2eanmp;t4tlenircto1la elu o;(0teumiopiy4ome lnes ()s2urur ;u4tleomf3iasfa2uanvsnu0tlxoxf3oytfmt livo;s)t2xmim3oo1lle miet ( sDrrxmo;o0tptoioetyd aDrlnvs;t0 leoxf3oytomtrlnvs;s0 etrxrpnudom nmieslt  rtrxroot4altoiieildfm rmuvo ()texrif oatop  lnei;s)teuo(m iu4ap elncs s s2rm(  ;t4olxo i3iydla eanmont)trermo3oytomte ues t)trxrim3oy1ome mncsa()aDuau o;t4tetnif3tld s2rl(mont)tleoio3iatop eai o;s0trurxmpiudllen neia(  Dtaxrpou0aetnmf3ias mDuluvp;(0trxrxf tadfaDrluvs s0seto(rpoy1ole lnesasfaDta(r ;u4alxomieiltfa2uan s t)artrxr ootlmteluvilt)trxr(m oydlp nmfeilt)aDurxro;t4tlto ietatfm2rm(ms (0aexrmrciadlmtr ieilt trum(m oydlpen fvilsfsDtm(  ou0tpe  ociadfm ua(vs t)aexnxr to1lp rlnvo s0 2xoxm3oo1am nmfetl(  rtaxmo;u4tpt  iciat mDrmuvs (0aexnxrcoadlaD lu sls) ruo(m3ou1aptelicil() Drm(rpou4tltn i3tlsls ua(msnt0teeoirciadoaDean s;s0 rtmim iudlptnlnci tf Drm( o;o0ape iieiadlm2um(mp (4tetoir oadoa ranvil(0t2to(o io1lltnmncsltfsDum(monu1teto fctysfm2eanvp (4alerio oa1la  luvilt)trxrimpoy1lp elneiatfa2taxrpoo1ole  fcilsfm umump () etomrciatlmte n sls  rtoxopiydll elfvtlt  Dtmx  oo4optomfeiyt m eluvpnt0tlxnxocoadlp eau ilt  rtr(o3iy1lpt mivt (faDra(  ;u1opxnmi3ildfs elnmsnt0aetnio oy1fpD luvi;s0t2um(r iy4ame liesasfsrtmx p;t0aeenifciadla2rmnvs (4alxnif3ty1fat lu i;s  eto(o oudlle lnvt t)s2umxm ;t1oet moctlt s rlnms;t0 eenxoctodopD lnvi (0t2xrxr3nodom elici s s2taur oo0tpenmi3tad s rm(vs (0arerio oadfatrau s;t)s2xoio nydopenliet () Dumu  ;o4opt mfeiysla2ulu pnt4aexnxrcoo1fpDraneils0srxmxo3ny1olt  icsa( artm(mpou4tleomfetydla ua(mp;(0 etomf tadlm   nei t  eurxo3iudlm   ivsl(  Dumxmo;u4aetn octysfsDel(vsnt0texrmo ty1fa raues;t0 rumim iy4al e ici tfartmx  ;o1oltniietltfm emumpnt)alxoio3todoa eln i;t0srxmxopou1altelivi tfa2taxrpnu4aptoio3ild aDumump;(4 rtnmr iotfmDe ueo;s0srurir ou1olte nvslsfartrur ;u0tlxoiicilsfm2el( o;()alxrmo3iodlmte i s ( t2trxr iy4aleemivsatfs2tm(  no1tlxomieiltlmDeauvon(4 lxrxo iadoatrlnvol(0sexr(m3iydap nlnvsa(  2uaxmpnu4oet  ieiydfsDrm(mpn(0tetrir3todfm   uvsl( s2trxopoo1oleelici sfa2ur(rp;t4alen fctasls rluvs t)aexnmf oydoa eanei;(0trtr(o3no4ole  fci s) Dtm(mpoo0oetniieiytfa2ul(vp t)aexoif3iytfmtranesls) 2xo(o iodoltelfcil()arrm(  ou1optnio3ildfs2um(msn()aexnircoo1lpDeli i t)t2trxr3oodomtnmivta() Draxm ou1olenmfciltfa eanmon()artoxf3ty1fmtean o ()sexrxopiu1lme mictlt sDumur ;o0tlx  i3tls a emu o u) renxo3tytfaD  ieils0 2triopoy1alenlfci tfa2rr(m ot4teen oeiatls uaumpn(0arxoxo3tatomDe nei;s0s2um(m oo4opeelfvtl() 2ta( pnt0aexnmicild sDrm( o () exoir3ia1lpD  neo ( trxmxm3oo4amtn netls s2uax  ;o4tlxn octyd s ea(monu0 renmrcty1oaDrlnvo s0srtrxo no4lme mfcs t)aDra( o;t0oeeo i3tys a rmuvsnt)altnxr3tatoa  aueil( srxmxrpio4ll e nci ()a2uaxmoot4oltnifcilt m umums;(0 etoxr3oytlm rli s;()texmiopiudopt lfvs t) rurxmp;o1opxo ieiytfs um(mp u)artnxfciytfmte i s s s2tmir3oy1oltemiei (f ruaxmoot1oleomfctysfa ua(vpn(0tltnifciadfat  i i;(0t2to(r nodape mneia( a2umurpou4tptnmfctld aDra(mpnt4 eeomo oy1fp rauvs;t0 rxr(m3iy1ale lncil( s2tmx onu0tet moeilsfs ul( p u0alxrmf3iydopD lnes s0trumiopiy1olenmfes s aDrmuront0tpxomoeiad sDuan o u4artnir to1fp rai o t)sexoiopnudolen nvt (fartr(rooo4opt mociydlsDean onu0 ltnxo iotlm   ues;s0texr(r3nu4ol e ivils) 2ta(rono1aet mfetldlm2uaumo;u4 rtomo3tydfm e nvo t  etm(rpny1omeemietls sDrau  ou1oeeoiiciltfsDeau o t)arenio oy1opD li ils)texoxrpoydale  fvt s)srtr(mpot4tlxn oetyt m2eau s;u0 etnmrcio1fp r nvo t0 2tmxmpio4am e ieilt srurx oot1apeomfciysla2um(mpnu0arxoio3iodoa   ivi t0trur(m io1lmee fcias aDurumoou1ale iictys s um( s;u) exomo ia1faDeanei (0trtoir3oy1llte nci ( a2trxrpou1alxnio3tls a elu p u) rxnir oodfmDe nvs;s)setmxrpiodlp nmnvi s  Dtaumonu1tetnmoctldlsDrauvon(4aexoirciadomDrlnei ( t2urim3nu4olenmivsas) Dur( p;u0texnmoeiasla2um(mont) lxnxfcoodlatelivi (  2tmim nydomt  fcsa(farraxro;u1oleoifeiat mDrlnmp t0alxrio totlp  auei t) exrio oy4alenlfvi ( aDrrum ;t4tltomi3ilsfs2um(vs t4trtrir oytlpDr ivo s) rumxm ou1omtn fcias arurxr nu0oet ii3tldfsDrmn p () lenir3to1lptelies s  rto(mpiu1lp emfvs sfsDtmx pnt1tpt  ociydfa2em(mp;u) rxnmf3iydoaD  nvi t0t2toirpno1lptnmnvtl(fsrtmu p;t0alt ii3tat sDemnmo t0trtnif oa1lmDeln i s0 rxrxr3no4am e ies (f ruru pou4ale if3iasfs uaumpnu4 rtnirctytfmDr i ilt s2uo(r iodol e ivils) rtau  ot4optn ieiytfm ra( pnu4teenirciy1lm r nvilt setoxr3oydame mivi sfa2urxr nu1alenio3ilslm2ul(vs;u)tlxrmocta1fa e n o ( s2tr(rpou4al nlfcsl(f Drrxm oo0opxnmi3tyt a2um(ms t4aetnmocty1oaDrluei;t)srxrimpoudal e nesls sDur( p;o1tlxoiiciytfmDuanvsnu4arerir io1lmDe i ol(0teumxo3no1lpt miesat)sDraxro;o0texomoetyd m umnms;u4trxrmo tatoateluvsl(0setm(r ny4oleelfctl()sDum(m no0texo ocildfm uaumo u4 rxnifcootlateau s;(  euoimpiy1lmenlietatfa2raxmpot1oeeomociad a2umnmo ()tetomo oadomDr u il() rtm(o iodapenmfvtl(fsDtmumont4aeeoif3iadla rmuvp;t4 exrir oytlp  aieslt)teumxo ou1omt lfvt s  Drrum oo1tpt iociyd a2ua(vs;()trxrmo3tadfatraueols trxo(mpnydam  lici ( artmx onu1altnmf3tyslm2eln o t0aleoir oo1fatrlnvsl()trxmir oy1alenmnvt s  2ur(m oo4opx  i3iasfs2rl(vo;u4aetnmr3oodlatranei;s) 2tmim oudlleemnesl()arrauroou0olxo f3iatfaDea(mo t)artrxf iatlm  aies;t)t2um(opnu1lmen fetltfaDrrum ;o1apt ii3tlsla2ulu p;u4arxrxf3ia1optran ils  rxriopoydoltelieta()aDuru p;o1open o3ild m2rm(vo u0 eeomo tydfmtranvs t0sexoirpno4oltnlnvi (f Dtr(  nu1tpe ioctyslsDuau s t0trermr3tatfptraueil(0srxoxr ou4ap nlnvtltfa2uru  oo4openifetat a2el(mp u) ltoif iydfp  aiei;t)seuo(r3no1ll  micil()aDum(mp;u4oleo i3tydfm uan on()tetrmocoytfp r u s;s)texrxo3oy1lm nlnvias)srtrx pnu4oltnmoeiytlm2uau s t4 etoio3iotfaDrluei t0 exoxopnydlp n iet tfa2rrxmp;t0tlenmieildfs2uau p;()aeenxf tatlpD ai ols)texmxo3ou1opte netas) rum(m ot4alen ieiltls ulu p;t4tetrircoo1lp rlnes s)t2xr(r3ou4alt  iviatfartau pno0oltn o3ils a ua(vonu)altrxfctotlmDelues;(0 rurio3iu4opt  fcia(  2umx  nu1tlx  fctysfs ulu o;(4 rxoxo oadomtelu ilt  etrxo3oudlme lfctltf 2umxm ou1olt mfcildlaDulu p ()tetnir oatlm  anei t s2urxmpiu4llee fvs ( artaxr ot0alen oetyt sDelnmp () renif3oy1lmDeaneils0srtm(m nu1optnmfcias)a2trum nt1tleomi3iyd m2ranvsn(4trxniocoytla  luvs (  2xr(rpoy1lltnlfcias aDtrumoot1aleomociytfs uanmo;(4tltnmfcoa1lmD ln s t0t2uo(opiy4olen iesl(fsrrmxmpnu1opt  i3tytfsDrl(vs (0tlxomrcoodfp e i s t0srtrxr ou4apenlnesa(f 2rrump;t0texnifeiltfs em(mp;u4artrif iy1fa rlivo s)t2toiopoo1oleemnvsas sDra(mpot4aeeniieiad s2rmn sn()trerif3iotomDe n sls s2umxo iy1ap e fvsas)sDtmu oou4oetn icias m2um(vp t) rxoircoa1oaDrai sl() rtr(opny1ope lfviat srrmur oo0alt iieiysla2eanvp t4artoxf iydla e ieilt0 ruoir no1oleemfvi t arumurpnu1alxnmfciltfs2ea(vo u4 rxrio iytom raies s) exmir3oy1alen fvtas  2tr(r no0opt moeiydfaDel( pnu0 lenxo3iydlpteluvil(0teuoio iy1om elnvia( sDurxmo;o1tex  feild s2emn s;(0treoxf ootla   nes s)srum(o3iy1ol   nvsas) 2tr( ooo1tltoiictydfmDemu onu)tlerxr iy1fpt lnvi t) exrxr3oudalenlneilt srtaumonu0oeeomo3tldfa ea(vo u4alermfcia1lpD ln i;s0setmxr oodllte iei t)srtrur ot4aee ii3iysfmDelu o u0aetomr3iy1fpDeauvs ( s2umir3oy4op elfvsltfs2tmx pou1tpeniictadfaDrlumo;u4tlerxo iotom  an s s  rxmio ny1alt lnesat)aDrm(m ;o1tlenii3ilt s umuvo u) etrmr3tydlp  luvils0setr(mpiudamtnlfvt t aDrr(ronu4oet mfciydfm ra( snu)treniocto1la r i s (  2trio3oo1olenmiciat sDtr(roou1tet moctlt a2ulu s;u) exnxf3ootlp rai o ()t2tr(o oy1omtelicia()arrmx  ;u4aet mo3ild m2em(vs u4 etrif3oo1opt au il( teuoimpny4alt lnet s srur(mo;u1tet miciadfsDrluvo u0 ltrxf3ootoa  anvils seum(o3ou4lpe lfcs sfaDurxr ;t4tpe io3ias a rau s;(0arenmr3ootfa r ueil() 2xmxrpiudoptn ieils)sDtaumooo4tlt  feiatfm emn p u0 rerxo oo1lat an i (  rto(mpny4omt  iesa()s2urx  nt4tleniociadlsDrl(ms () lxnio io1fpDr nei (0sexr(r ou1apt livtat  Dumxrp;u1olenmociatfsDum(mp;t)arxoxo3oa1op e ieo;s)s2uo(o3nu1lpenmfes tf rumxmp;o0texomf3ildfaDelump (0texnio3oo1fmD li s t) etoir oo4lp   fvsasfaDraumo;o4aetoio3iysla ra( s u0 lxnxo ty1omt  u i;()t2uo(m3oydaptelnet tf 2tru p;t1aleoifciltfm ul(vs;u)teenmocoa1fmte ues t0srtoimpoy4am emfci tf 2umxr ou4altniieiys s2ua(ms;(0artnmocoatfp raues;s0s2tr(opnodlmte fviatfaDtrump;u1tlxomi3iadlm ulnmo;(4artrxf3oo1optelnvs s s2to(m3oo1opteliesa( srurxm nu1aex ifeiyslsDrmu o;u0 exoxo3todoateaueslt s2xr(opoodal nlncias)sDumumpno4apto ociydlsDemn snu4altnio3ootoatrluei;s)t2tmim3nu4ale mies s arurxrono1tpenmo3tas a el( s () exnio ootlmt lnvi t0s2xoim no4omt lncsas aDtaumonu1apx iieiyd m2eauvs;t0alerxr3tytlpt lies;s0 2xr(m3nudll nlfvtlt a2rru pno1opxnif3tad s2ua( o;t0 etrmr3iytop rluvo;s  etrir iydapeemivslt)s2urx  ;o1olxoif3tys m2emnvsnu)tlenmf iodopD anvo;t0t2to(o3nydol  liet s  rta(m ot0olto octysfa2umn s;u) lxrxrciydlmDrlnvil() 2xoirpny1am nlnvsas) rrr(mpnt4tlxomfetlt aDrm(mo;t)tetrxf ty1faD aieilt)t2trxopoo4omeelnetlt sDumurp;u4oexomiciat m rm( sn()artnxf3tytoat  uvsl( sexm(mpnudalee fesa()sDtmur ou0alx mo3ilsla rl(vs;t0aleoir3oo1lm rlneo;t0texrio ny1ap nlnvi (farra(m ot1optomociat a2rm( sn(4 rxoxo ia1fp e uvs;t0t2trim ou4lleemictas aruru poo0apx ifciat s2rmnvpnt0tlxnmfcta1lpDr ies;s) rxo(m3ny4llte nciat aDtmx pnt4alxomf3iysfs rmu o () renir3ootlpD li i s) rumio iu1llte nci t a2rrum ;o4apx  fciasfmDrm(vs;t4tetnmr3io1fm  anvils) exrir iu4ope lnct (fsDurxrono1tlxn o3iydlmDeanvp;t)artoxr tadop eaneols0setr(o oy4lpte ivtlt)artmumo;u4olxomi3iadls2raumonu)aetnio tadfpteanvi s0 2to(rpoudlp elfeias)arra(r ou0oltnii3tydlm uau on()altomoctytfmD  nvslt0t2urxmpoudolee ictls)a2tmu p;o0tlto i3iltfm2rmnms;t4treomr3to1oaDe i o s0tetoio3iodameelfetat)srtm(mpoo4aptomoctys s um(vs;(0alenxf3oytlaDr n i ()s2xrio3ou4apeemnvi tfs2tm(rp;o1alxn ociltls2emump (4arerir3iodopDran o;t0seum(r3iydlmtn netltfaruaurpoo4opxoiictad m eau o u0 ltoiocty1fm raues s0texmxo3no1opeelfcsls s2tmxmp;o0oeenmoeildfs rm(mo t4 renmoctadlmt aivi;t)t2tr(o3nu1opt  iei ( a2rr(rono4apeo f3tadlm rmumon(0tetoxr iodlmt  ies t)teumir iodamtn nvi t)aDrr(ro;o4oeeomf3iyslm2rm(vpn(4teermo3ia1la  lnvi;s0srxoxr no4llte fei ( arrm(mpou1tee iictldls el( o;t4tlxoxr oydfmteai slt0trxr(m oy1lpen neta(fa2uauro;t1oeto icildla ul(msnt)arxnio3iy1fpt aivil( trtm(rpiydamenlicsls s2tm(rpno1ape  ietatlmDelums;t0aexrmr3to1lmDrlnvs;t s2uo(m iodapte ivi sfsDra(m ;t0tptnmietydls2el( p;u) leomf3oo1om e ues (0t2xmxo3oudll  mfvi ()s2ra(rpoo1apeo oeiatfsDuauvs;u0 etoio3to1laD anes ()t2xmio3iodolt mfct sfartaxr no4tlxo f3ildls ranvsn() exnmo to1lptr u sls s2xo(o nodlmt mfcia()a2um(  no0olt  ieiad mDrlu p (4 lxriocoydfaDeli sls teum(r iudlltnlivilsfa2tm(m no1tlxoio3tyslsDelnmp t)alxrifciy1oaD  ies;t0t2xoir3iy4lmtnmieiat) Dtmxm oo0apeo iciysfa eaumo (4tetrxrciy1omDr nvilt0setrio io4lltnliei (f ruaxm no1alx  feiydfsDulnvs (4 exoxfctytoptelnvils0t2urxopnodamtnmivslsfarur( ont0oex  feilt m um(vsn()tltniociodlatrlu i s)texrimpoy1ap   fesa() Dra(m ot4altoii3tytlmDel(mon(4alermo3iadoatr u i s)srurxm nu1lpe mnetat) rrax pnt0oexomoetyslmDranmonu)alerxo3ia1fm r neo;t0t2trxr3ny4apte ies t)s2ta(mpnt4oee moeiyd m emn p t0artnxo oodoaD li olt  2xoir ny4altn fvias aDraxroou1tltn ieiys s ranvo t)tlenio todfaDr ieo s0t2ur(m3oy1op   ictat)sDuaxrpou0tpxomociyd m2rmuvsnu0aetriociatlmDr n sls) eumiopio4opt mnctl(fsrurx onu0alenifciatla2eau s u0alermrcootlpte nvo ()srurir nydalt lnctas  ruax pnu0tlenifetydla emuvp (4 renxo3iytop eluei t tetrio3oy4om   nvils)sruaurpou4tpe mociyt s2uluvpn(0 etnmr ia1oa  lieo s) exm(r nu4omen fesltfaDraxm oo1apxn ietldlm2emu p;t)trtoxf iydfpDe n ils)t2tr(o3nodll  mivsa()arrax p;u1olen o3taslm2umuvs;t) lerir3oy1fm rliei;t tetoxopiodamen iei (f Dtmxmpnt1aexn oeiltfa2eln o ()teeriociatlm  auvo;t)t2umxr ou4apt mics s)aruru pou0aet  o3iadfm el( s;()tlxnmf tydoa r ues ()seuo(opno1om  mfctat sDraxront1aexn ictadlm rm(mp t4tltrircoydlateanvi s) 2xr(r ny1om e netatfs2rax  oo4openioeild aDrm(vo;u0arxoxr3iodoaDeaneo;(0 2toir3iudll e nesat sDrmxmpnt1tlx  ietys sDum(vs (4tetomf iy1fpt li sls) 2tm(opnudlleemfeta()a2rrx ono4aet mi3tydla2rmuvsnt)tleoxf oytfmD  uei s0 2xoio3oo1al elict sf rum(rpoo4apenmf3ildla ul( o u)texnmf3ta1fmtelueo t trxrio ou4lpenlnet ()srrr(mpnt1ape ifeiadlmDul( s;t4tetrmrcoa1opDrau s ()s2uoxmpiudllenlfei (fsDtaxroou4tlt mo3iyt sDrau p (4tlxomf oodlp rluvi s srto(rpno4op nmnei t  Dtmum ;o1tlto o3iadlm2ran pnu) ltnxo oydfpt lu i;(  2tm(rpiudlleelivs t  2trx onu1tptniieiyt a rluvo u4arxnioctydoat lues;s0t2xmir3iudll  lfeslsfartaxm no1aexoioeiasfa2rmnmpnt)tltnif3oytopD auvolt)t2xr(rpoy1alee nei t aruaxmoou4oetn feils mDel( p (4trtoxf3iodlmDr u o s setoio3iudoltelfcs ()aDrmurpou0opxoioeiydls ulnvp (0trtoxfctatoa rlues s  etr(mpnodlpeelfei () 2rmxm ;u1oeeomoeildfm ea( o u4areoxrciotopte nvol()t2xm(o ou4ole mfviltfsDtm(m no0alxomo3iatfaDuauvont) rtnmocoo1op eai i (0 2toxm no4ol  mivtls)a2tm(r oo0tetn i3iasls2rl(vp (4arxoif io1lmtelnei s0 2xmxm iudap nlivil(f rtax ont1tlx iietld m2eaumo (0 exoxf oa1lm r n i;( setmiopno1lm  mnet s)a2tmuro;u1tlxomietltfmDea(vpn(4tleriocto1omD liei s  2xmio3io1ol n ivsat  Drru o;u1opt iiciydfs2rmnvo u4arxnmr iy1fa eauei;(0 rxoio3iudamtelnvsatfa2um(r ;u1tex iictatfaDeaums;(0texrxf3iy1lpD  nes;t t2xm(o3ny4ap emfcta(  rtrum ou0oeeo fciysfa uaumpnu4 lxrif3iytfpDr uvi s trurir iy4llt lfet s) rtruro;t0tetn o3tatlsDemu p;(4trerio3ia1opt  u s;s srxm(r nu1alen ies t aDrrump;t0tptnmieiyslm em( s t0arenir tydfmDr ivo t0teumimpiy1al e iciat srururp;t0olx ifeilt m2umuvp () exoio oa1lmtr ues;t0t2tmxm oy1lpte iet ( aDtm(mo;t0olxnii3tysfs2umums t0 lxoir3iotlpDrliei;()srumxo3iudome lfctls)s2umxmo;o4aex  oeilsfa el( o u0alxoxrcootfmDeaieols)t2tmim3nu1am elfvt tfsrrru  ;u0teeoiictltls2rau o;t4 rxnmo iydfp elnes s  rur(opoodam nmicias s2rau  ou1olt mieiyd a2ulums;()arxrmo3iy1fmDran olt  etoio3oo4ll nmnci s)a2trur oo4ape iiciadls2uaumsnt4 lxrifciadlpteaues;()s2xriopoodlp e ivs s)aDumx  nu1teen iciysfsDean snt0 rxnmo3oodfmtr uvo t) rto(m3iy4om nmies t) 2umxmono1aeeoiiciat sDem(von(4alxnxfcoa1oaDelivsls srtrim3oy4lm emiei ( srumu  nu1apx mfctatfmDrlnvs;(0 ltoxrcoydlmtrlnesl() 2trxo no1amt lieta( sDtrur ou0oltniietls m2ua(vsnu)tleoxfcoa1omteluvi ( s2uoxr oudamt  net sfa2raxm oo1tlt  ociat s ran o u)aleoir3iodfpt livsl(0trumxr3nudlm nmfviatfs2umur nu0optoiociadfm2ea(vs;t4altnmo oa1om   ivi s0setrxm oudome mivtl(  2rmu pno0tpxo iciyd m2el( s;t0 rxrmo3oo1oaD  u s;s0srxmxrpnu1am  lfvi t)arrmurooo1aee micilt m umnmp (0alxrxf io1fp  lu s;t) rxo(opou4lptn feia( sDtrumpno0openmfciat s emuvp (0trtrxocia1lmDeaneo;t0 rum(m3oudal nlncsltfa2umur ou4oltnioeiatls2rmnvpn(0 etrmrciatopD lu ilt0sruriopiy1lle  fcils  Dtruroou0opx mo3ildlsDumnmpnu) exrio oodomtean i s trumxopiodlm nlnvsls)a2tm(rpnt1tex mo3iaslmDemnmo (0aetnir3tydop   i s;t)setrimpoydope  iei sfa2uaxr ;u4tpxo i3iydla2rlu s;(4trxrir3to1fpDranei;s0t2trimpoy4amtemfviasfsDrmxrpoo1alxn icildla2elump;u0trtoif ty1omDrlueil(0setr(m iu4amtnmnvil( arum(rooo0optomfeiasfa2ulnvp u0tetoxr ta1omDeaivi t) 2xm(m oy4omeelicsat)sDtaur oo4tlx if3tls m ea(mpnt4tlerxrcia1opDeliei t s2xmiopiu4lpe mnvilt arrm(mo;t4texo i3iyd sDraums t4trxnxf3tatlat li s t s2to(r3nodamt lnct tf Dua(  no4aptniieiytfaDua(ms ()tlxoif3iotlmtr ivslt  2to(opny1ole mivi sfa2tau  ;o0olenmf3tld sDemu s t0trtrmo to1optrlivi t t2xrio3oy4lmt  ncs (  rrru  ot1olxoiociydla el(vo (4aetnxrcoatopDe n o s s2toxr oydomtemieslt)sDtaur nu4aptn o3tltfaDrl(ms (4aexrxf oo1oateluvs s)teurxo3iu4lptn netltf 2rrum ;u1teenioeiyt mDul( pnu)arxnxrcoadoaDe ueo;t) exr(o ou1olt  fet s)sDra(mo;o1texn ieiasfaDrlu s t)altoir io1lmte nei;()setmxm3iudamtemnvtatf Drrxrp;t1tpxniicild s2ul(mo;t4 rxrmr to1opD anei;t  2xm(r oo4al n fcsas aDrmumpno1tpeoif3tyt s2el(vp;(0aexriocoadoaD au i;()texrxo3no4lle lfcsasfa2umur ;o4oltnii3tldla2eaums t4 rxnif3oodomtr ies () rxm(m nu1olenlfviltfaDra(rpot0texomfetydlsDrluvp u)tlxoio3oo1fmt livo;s)trumimpiy4apenmnvs s) Dtrxm oo1tpenmfeiysfa2um(vo t)trxrio3iytfpD anvs;(  rtm(m3no1ll  lfct s sDrax  ot1tptoioeiydfmDumuvo;u)texomr ootlpteaneo;s)seto(m ny4lle  ivt () rtrx ooo4oetn fcildfa rl( s (4 ltnxfctydlp  anvils0t2trxo oo1opee fcsas)s2rauro;o0aleo ociat m eanms;() rxoxfcta1fatean ol(0 etrxr io4opte fvia(farua( poo4olt mictyt s rmums t) exrmo io1opDelnei;t)srtmxm3iu4op emicsat)aDtmu pot4aeeo feiyt aDuan pnu) ltomociodfateauvol( seurxr iy1lm n nct tf 2rr(m no4opxo ieiytla ra( s (0texnmo oo1fpt livi;( setr(r3oydlpeemici t)s2tr(ront0aexn o3tydlmDran snt4 rxnxf3oadlaD lnvi;t0seumiopoo1op   netlt) rtaurpot0oeen o3tltlmDelu s t4 reomf to1lmteluvs;(0 exoiopio1lmt mict sfaDra(r ot1tptomiciadla em(mon(0aleomocoydopte nesls)t2xrirpoo4am e ivi t  Draumo;t1alxomo3iadfaDumnvs;u0texoiocia1oatr n ilt s2to(r3oodapt  netlt sDta( ooo0aetn oeildlaDrlumpnt) lerirciadfp  lu o;t)s2triopnudame mfesl( aDta(mp;o4openmfciatfaDulnmp t0 etoirciotla  au o t0setm(o ou4amt  ivt t sDrr(mpno0tet mi3iasfa rm( p;()treoxf oytfaDr n s t seuoirpoy4altelnci t)arrrumpnt0oleo oeiysls2rmnmo u4artoir totlp  au ils sexoimpno1apenmnvs tfarrm(r nt0teeomo3tysls eluvs t0alermr io1omDeaneo;t  2xo(r3no4am n fvt sfsDur( p;t1tpxnifeiydlaDeanmp;t)aetniocta1oaDraieils0 etrirpnodlmtnlfcsatfsDumx  nt1aeenmieiysfmDua(mont4arenifcto1lm e n i s)trumimpou1omtelfeta(farrm(rpou0alt ii3tlsls emnvo;(4 lxnmfctytfpDrai ilt)t2xmxo ny4am nmnvia()srur(m nt1alxniociasfmDumu p;t)arerif iatopDrli il(0 rurxopiydlltnmivtls srtr(r ot4oetomo3iytla2eau s;u)trxoirctotopD lu i;(0srtrxr3iudlltelfeils a2rru pnt4teto feildls2uaump (4artoif3oy1la  luesls0s2xm(o3oy1lm  lfvsatfsDtmuronu1optoio3iysfsDrauvp u4aeeomfciadfpt auvo s0s2uo(m3oo4op nlncta( arra(ro;u4alenmfciys s2el(vo;t0 leoxrciotfp e nvi;()t2tmxr ou1omtn ietl(farrrxm ot0alenmi3iydfa2em( snu0 eenio iotlm ran s;t  2xoimpoydoltelfcsatfa2tmurpot0ole mfeiadfm umu sn()tltoxociytom   ivi;()trxoxm3oo4opeelfesa()a2rrumpnu1aee mi3tldlm rl(mpn(0tlerxr3ootfptelueol(0t2xo(r3iudlpt mivt () 2tr( pot1oex  ieild a2emnmp u)tetoxrcta1omD lu ilt0 2trimpou1lmen nvias)aDrr(ro;t0oeeo o3iytlaDulnms u0teeoxfcto1la  lueo;()trtr(r3iy4ameemfvt t) Drrxront1aptoifciatlm2em( o t)arxomf to1la e u ilt seurxrpou1am nmivt (f 2urxroot0ope  oetyd s ea(mpnu0altnio oydomtranei;s) 2urio3nu4lptn ivslt a2ta(m no1apeo f3iyt aDeauvsnu4 eenif io1fpt lnes s0srxmxr iy1op n neia(  Dtm(ro;u1tpxoif3ildfm eaumsn(0tleomf3tatlate uvi (0truo(opny1am emfei t)aruru  nt4optomo3iyd aDulnmon()aetnio ty1oaD li s t)s2xmir3nodamee ivs s s2taur oo1apto o3ilt s uan p t0 etnmr3oy1omDrln ils)sexoim3iy4ale  neia(farumxrpou0tlt  icildlm2um(mpn(4 reoxf oytoa eln ol(0texoxrpiu4lptemivia(  Drmxr nu0aee mieilt m ulnmo t0 etnxr3iodlmDr ieilt0 rxmirpoudlpe  ics t  rua(m ;u4aeen fctas aDelumo t) rxnmr3todlmD ai o;t)srtmxr3nodlp e ivsasfarrrum ;t4aee  i3tadfa2emums t0trxrmf iotlaDr ues;t) etoirpiu1ap emfvsl() Drau o;t0aptnif3tad aDrmumpn(4teeoif3todoaDrluvolt0s2trxo nydale mietl(faDrrum ;u4apx if3ild a uan o;(0 rtnmf oatop elu s (0teum(r ou4ope  iviatfa2rmu  nt4aleo oeias s uaumsn(4trxrxr3iatfpDelnei;( sruo(opiydolt  fviatf rtmu ooo4tet mieiys m rauvo;u) rxrifctotfmDr ueilt0trtoxr3iudopteliciatfarra( oou0tleo f3iyt a umn sn() renmr oadop   iei;s teurio3oudlpee ics (fsrtm( pot1oltn ocils a ulumo t4altrxf oodfmDrln o (0s2tmxo oo4alt mfvt s) rra( oou4apxomictytls2elu p;t) rtrxfcty1fmDelnvo;t)teuo(opiudolenmfetlsf 2ra(moot1tlen fetltlmDuaums (4 etnxo3ootlpteauei;s)texrxr3io1oltnlivi t  Dumxmo;o0tet mfetlsfa ra(mp u0alerxr io1fat aieils  etrxopiu1opte netlt)aDrmxmpoo1olxnioeiytfsDeauvpnt)trermf tatlm  aivslt  exrxm3iudomte nei s) rtmx onu4oexoio3ils aDranvpn() renxo3oadlpD  ivils teuoiopiy4amtn neias)artaxmono4apt moeiytlm2uanvs u0trtoxoctydfa eanei s) rto(mpoudapt livtlt  rraxrpnu0tltomfciltlsDrlu sn()tetnir3tytfaDeau olt0 exoxmpou4am elnvt t)srtm(r oo4oltomieild mDumnms u)trxrif3tytoate nvs;s) 2xoxm3ny1omen ncslt) Dtrx pot1tpeomfciatlmDumuvo u0 ltrxrctotfa elneo;(0t2xoxrpnu1lpe mnvt () 2ta( oou4altomfeilsfmDem(mo t4altnxr3iy1la  li i;(0t2urim oy4lltnmfeils srraurooo4oexoifcias a rl(mo ()teeriociadfpte u il() 2tm(opnudoptelicslt a2uaxrpou1texnmf3tadls ra(vp;u0aeeoiocoy1fa e ueol( truo(r3no4llen nctatfa2rmum no1opto ietasfsDuln o;t0 exomo3oo1fmD aivi;t)t2uoirpno4om   neia(  Dta(rp;u0oexo i3ils m rlu s (0aeenif oatlat livol(  2tmiopnodomtnlfvi sf Dtaur ;o4oee mi3tasls2um( p;t)aexoio3oytfpDr nvi;t0 rurimpoo1lme  fesasfaDrmxrpnt0olx  ociyslm2rmnmonu)arxoxoctotoaDelu ol()srumim3ou4ap elfvsa(fsrtaurpou4alenmf3ils m2umnmp t) reoircootlatelies (  2umim3nudlm e fvsa( srtaxr ;t4tle if3iad a2uauvp;u4trtnio3iydfpteauei;t)srxm(r3oy1llt mnctl(fs2rmx ont4oexo i3tyslmDrmn pn(0treoxociadfpD  ueslt  eumirpou1amtn fetlt aDtru oou0aexo f3iyslm elu p t0alxrxrcta1optr i ils0trxmxm oudlmenlics ()a2uaur nt0tpe ifctyslm2emu pnt0arerxfcto1omDraies t t2xm(m ou1apeemncilt)a2tau oot1tpxomfeiltla2eln s u) rxnmr3oy1lp elneo;(0 2ur(rpnu1aptemivi s) rrrxr ;t0oltomf3iad aDumnvonu0 ltrxf iytlmtranvil( texo(o3ou4optnlnvtls)a2rau oot1tet mo3iytlmDrluvs u0artnxr3iytlmte nvolt  eurio nydlm eliei t)aDuaxr nt0tpe  o3iatlmDra(vont0tltoxfciodfaDeauvo;() etriopiodaltnliesat  2rmx  ;t4apxn o3tytlm2eanmp;t)aexrmo iatfpt  ieo (  etmxrpno4olenmiesl(fa2trum nu4tltomfciltfm2ul(vs (4aexoio3ty1oateluvslt0s2xm(o3ou1ale lfvta()srrrurp;u1altnifctlsfs2ulums;t0aeerxocio1omtrau i s srxmxo ou1llt mietat  Dua(r ;u1alto f3tasfsDum(vonu)alxnmo iatom e ueo;t  etoiopoy4lptn netasfsrtmu  ;t4opt  i3tas mDel(vs t)aeeomrcio1fmt  ivs s s2ur(o no4ll nmfeia() Dtau p;o0alenioetlt s uanmsn() rtnxrcia1op r ies;t)seur(o3no1lp n ncsa( srrmur no4olxn fciys mDulu pnu)aexoxf ta1fa  aueilt) exr(o3oudope mnvtlt)aDtmu pno0alx moeiadls emumo;(0teenmf3ty1latelnvils srxm(mpnydlltn icsa(fsrtax p;t4apxoio3ildlsDeau p;()arxnxf iatlm r uvi;t0 2trxrpiy4apeemfesasfarumxmo;u4apen feiltlm eln o u4 exrxr3oydfateanvol( trtr
\ No newline at end of file
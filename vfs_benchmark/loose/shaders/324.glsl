@@ -0,0 +1 @@
+ivs ()t2xoir nodll e ict s sDur(rooo4olto i3ild m2ua(mp () ltrxo oadfp   uvs;t0 eur(opiu1omtn ivtltf 2rax  nt0teen ieildlsDeanvo;()alxoir iatoaD  u s s0 eum(o nodlmeemfvtl()a2rm( oot4ape  f3ildfm rauvont4 ltnmrciy1omt li o (  2xrir3iudap emiesls)a2rr(m no0tet  i3iat m rm(mont) lxrmocoadfatr nvs t)srxo(r io1op nlnet sfsDtru  nt0tlt  i3iydfs ean ont4texniociodlpD lu s t  2xr(opou4llt mnvt s arurxrono1oleomociat s rm(vs;t4texnmf3tatop e i o (0 ruoiopio4op nmnei s aruru o;u1oleomiciad m2ean p (4texnio3iotlpDr n ilt srtmir iodom nmnvsa() Duru  ;t0olenifeiad s2el( s u0altrxrcta1oa r uesls)t2trxo iodolenmiviat srrruro;u4tlx ifctadlm rluvsn()tlxnxr iotop rlnvilt)texoio3nu1oleemfcta()srtrxr no4teeo oetlsfm2uanmont4 rermo ty1fatrli o s0s2xoim iu4openlfetatfarum( poo1apenmoeias m rlnvsnu0aetnif iodomtr ivil( teuoxm3no1ap elnct tf Duau pou1tlen f3ildls ranvs t)altomocto1om rlu o () etoxm3nydaltn iviltf Dur(r ;o0opeomocias m el(vs u4 eenxo3iydfa   i o;s) etoio no1lpt  ivt ()a2ra(mo;t0aeeoifciaslm2rm(vp;t) etrxfctydom  ai ols)seuoxm3iy1al emfvsasfaDrmumono4tlt iietys a2uanmp u)tlxoxo tadfptr n o;s)s2xrio iy4ameemivil(fa2uax pnu0tlxnmfetys s ranmp u4 etrif iytlmDeli i;t)s2uo(rpou4lmtemnesas artaur nu4tlt mfctydfs2eluvo;t4tltomo3iotlmt  neol()s2toimpiu4ol  livia( s2ta(mont4oleomieiatlmDumuvo ()aeeoxrctotlmD an slt)seum(r iu4olt mncta(f rtaxm nu1tlto ociltlsDean pn()trtrxo tatfpDe uvs s0 ruo(r nodlme  ivtatfsDua(rpno0alxnmf3iaslaDuau pnt4aexnmo3oatfa rli sl(  exriopno1lmee ieilt)aDuaxmonu4alxo f3ils a2rlu on(4alxnmr oytoaDrlu i;t trurxo3oo4lmte neia()sDrrum nu0opt micilslm2um(ms;t0treoxr ia1faD lnvils)setoimpny1ope livsl(fa2rru o;o4opx ifeiydfa2ea( s u)tltnxf3totfmte i sls)s2uo(r iodopeemfcsl( aDumump;u1aeeomfciltfa ra(ms;(0tltnxr3oytlpDr neilt)srurxr3nudal elivslt a2ua(m nu4tpxoifeiytlsDemuvp u)texoif3ta1omtr nvs;s) eto(m3iy4optn ivsls srtmx  no1altn ieiydfmDuau p ()arerifcoo1oaDelies;s) exr(mpoodlpenmies sfsruru o;u1texnif3iat a umu o;u0texnxr3oa1lat aues;t) 2trxr3iu1lleemfci s arrrx  ;t1ape  ocilsls em( s u)tlxrmr3tatoaD ai ols0trtrim3oudale lictlt aDtrx ono4aetnmoeiyt a rlnmo;t4 ltrif3oodopDeanvsls t2xr(r3ou4lpe licsasfaDtmumonu1aexn oeiatfm ulnmpnu) rxnxf oydlaDrauvsls teur(o no1apt  netls  Dtm(r nt4oet  iciat a eau o;u4 eerxo iadlmDeanes t t2urxm no4aptnlncsls srum(m ot4ope mo3iys s2umnmpnt) leoxf3todoa ranvilt0 2xmirpny1lm nlfesasfsruaxmont1texnmoeiydfm rl( p () lxnmo3ty1lp r uvi (  etrxm3ou4oltn ncsls  2tmxm ou0apt ifctatlm2umnvs;t4trerxf3iy1fptelneil( trum(rpiudom  mnes (f rraxr ou0texo f3tldlmDumnmp;(0arenmrcoo1lmDrauvols  2urxmpoy1lleelncs ()aDurxmonu1apx iietlsfa elu o (0tlermf ootfptr n o ( t2toirpiudop nmnvi ()s2rax ono4aee moctldls2eanvs;u) ltnircoydomD ai s (0 rtrxo oydomen ivtlt)arraum ou0olenifeiytfmDua(vp () eerxo3ta1lp rliesls0 exoxopnydale mics s)aDtaumooo4oetniictas a2ran onu0 reniociatfm eaivs s0t2xm(rpou4lmtelivtls)s2tr(m no4tetnmf3tltla eanmont4artomrciotoatrlu s;s)srtm(mpny4amtnlies ()s2tmxrpou0tee  f3iytls um(ms;()trxrxf oytfp elueo;(0 2xoir3nu4ap  mict tf rrru ono0tlt  ocilt sDrl(vonu4tetnmr iodlptrli o (0 etoio3oo4lp n ncs t a2rmu  ;u4aexoioctyt sDem(vp t4 exoxf oodlmtr ueo s0 ruoim no1omen ivt sfa2rr( poo1tle ifciysla umuvpn() lxrmociodlpt livslt t2tm(o oydopeemfvtl(fsDtrxr ;u4ape ioeiyt mDran on(0 reoircoatfp rauei t)srurxrpou4oleemfetatf ruau onu0olt mo3tysfa2ua(vp;t4teenio3oa1lptr i il() rxrxr oo4lmeeliciatf Drm( pnt1opx ifeiydfm ua(ms (4 rerxo iydoat lnes;t)srurio iydlpte fesltfa2rmx  no4tlx mi3tysls2eau s;t) exrmfctatlmDranvils0trxoxmpiy1al nlneilt aDtax pnt1alenmf3iydls2rmnvsnt0 rtnir oytlatraivi s  2tmxr3io4lp n ieslt  2uru  ot4tpeoii3tad m2rl( s u) rerio3tadop raieo (0t2uo(o nu1lm nmfciltf Dtmxmpnu0teeoio3iat s em(vs;u0 exrxociodlmDelivi t t2xrxopio4amtemnvias  rtrurpou0tptnif3tatlsDua(vs (4tltrmr3ootopDr ivi;s0 2uoxo3iodap nmivil(fs2rrxr ;u4alxnmieildfm2ra(ms t0tlxomf oydopD  i s;() eurir oo4lmtemncsltfa2taurpoo0tptn o3iatls2uaums;(0arxrio3oatomtrlu i t)srxo(m3iydom n nct s  2rmur no4aetnifctydlm um(vo u)trtrmrctadfmteai i;( setm(r3ny4aleelfeta( srumxro;o1tee  oetysfaDeanvo ()arxnmfciytfpteauvils) etrxmpnodlle lfctls)artmx o;o0tlt  feilt m uln s;u)aeenmf oo1opteluvi;s tetrio3nu1lp eliesltfa2tax  ou0oetnmiciydfmDumnmo t4arxoxrctytom r i s s t2xmxr ou1alt mieil( artr( p;t0aeen i3tas sDul(mp (0aexrifciydoa   nvi;s s2um(m io1ol  lnvs (f Dur(rp;u0tet mi3ilsfs umnvsnt4treniociytomD  i il()trxoxmpio1ame lfct (fsrum(  nt0tltn f3tytlsDulnmp;(4 etnmf3ta1fmtrai s t) etrxm3nu4lm nlietas a2uaur oo0apxnmocias sDrmuvo;u4aexrmoctadfaDrlivil(0s2tm(m oydole mneil(faDrmxm ;t1olen ieiatla2umnvo (4 rxnxf3oatop   ueilt trur(rpou4amt lncsl( sruru pno0aee mieiyt a2rmnvo;(0tlxrio3oatoaDelnvils0seto(o3iu4aptn fctat)srrmxront0apxn ociytfs2ua( s (0aeeomocty1faD luvo t0teumiopoy1lpt  ieia(  Dra(mpno4alxniicilsfs rm(vp;u0altnmf3iytomDeluvi;(0truoxr iodame miesa(faDrmx p;o1tpe iicilsfm2rmnvpnu0teerxfctytomDr uei (0 2xmir oudop elietl(farumx p;o4olx moeilslm2rl(vp;t) exnxfcoa1opt lueils  etm(mpio4opt mfvia(  2umxmpno4tpe  i3iadfs2rlnvs;()alerxocoodfateai sls0teurxopiydomenliei tf Durxr ;o4aeto f3iyt sDuan s;t4 etoio3oodlmDrlivs t0 etmxr3oudol emictatfarrr(mp;u4olto ieiadlsDul(mp;(0aexrif iy1omDrauvs t t2xo(mpiu4ol nlieta(f 2ra( o;u0aet ifeiad aDulnvpnu0 lxrxfcootopt lu i;(  rxrim3oy4alt livi s  Drm(mo;o4texomo3iydlsDumumo t4 eeoif oa1lmt auei t  etoim3iudam   nvils sruaxm no4altnifeiytlm elumo t4tlxrxr3tydlatelnvols)srtmir3ou4lm   fvt s aruaxmpnt1tlxo ieiyt a2ra(vo;()aexnmf3iadlp e ueo (0sruoirpiodolte ivtasfarua(mpot1aptnmoetls m uaumo;t0trenmfctotla eanvils0t2uo(r iydll  miet s) rurx  oo4aee if3ilsfa el(msnt) eermo3oa1lmt ai ilt)seuoxm no1apte nvi t)aDtax p;u0aleomfciat mDuluvo t4 ltrir oa1fmte iei;t0 2xmxopoydome lfvilt) 2ta(m ou0alxnmoeiadfa2ea(msnt0 etnio3iy1lmDeaivs s  2xrxmpiydomtemneiat srta(m ;t1olx ioetyslsDemums u4trxoiocia1fmtean s;t)trtrxm3io1am emict (fsDur(root1optn oeiat s2rm(vs;t4aeenxr3iatlm e uvo;s  etrxmpoodolee fet (f Dtruro;t1alxo fciadlm2umumont4 exrir3tydlmDelnvs t)srxo(rpno4ope lfesa( srumu ono1opx  oeild aDranvo () exomo3iy1om  aueo;(0s2toxo3oudol nmictls sDraur ot1texnmf3ilt aDrlumo;t) rxnmo3oa1lmDeanvi t0t2urirpny1omtelnvsltfs2urum ;u1oleoiieiys aDran pnu0arxoirctytomDrliei;t  exrxopnu1optemfcilt)arrax oou4tpe  i3tadlsDuluvonu0 lenmf3iodla  luvi;(0 rum(o3iu1llee ivil(fsruau pnt4oeeoifciyslmDra(mp;(4 lenxociytoateau s t0s2tr(mpio4ame mnesls artru oou1tlto f3iaslmDem(vo (0tlxrxr3oatom  ai i t0trxm(rpio1lptnmfvtls) Dua(m ot4oex mi3tad sDemnmo t)tlenmf3totlmt lues;t0truo(r iudlmt  nvtls srrmx  ;o4apt iociytfm2rlu p t)alermo3tydlptrai o;t0trxo(o3iydapt mfeslt srum( poo1olt iieiasfsDuln pnt)trtnmf3tytfateau sl()sexoir nu4apt mfeslsf Dtmxrp;t0aexoiicils mDrln o;t0 rtnxo iytop elueils  2tr(mpou1op nlict ()arra(r ;u4tpxoii3iad mDel(vo (0aetomrctotoaD li s;t0 2trim iy1olt micsatfsrtmxr ot4tle mfciyt m ul( s;() exrxfcio1fpt  neol() rum(m3nu4lltelnviltf 2tru pot1olt  iciltfa2em(vs;()trxoifcty1faD  nvi;(0seum(r oy4aleemnvtl(  Drrxrpou4tpxn oeias s rl( ont4teenxf3oydopDrauvs ()s2um(o iydlpe  feta() 2rmx  ou1alto i3iltfa2ua(vp;(4tltnmr3iatlmDr uesls t2trxm3oodaptemnct (  Dra(m ot1olxn ieiasfmDem(vo (4 ltomr oatomDe ueo;()truoim3oodll emiesl(f 2rru onu1aet mf3tldfs uluvs t)artnir tytlp elnvs t t2um(m ny4llte ivsas  Dtrumont0opto i3iltls em( s;t)artnio3oa1fp eau sls) rxmio3oudomtn feiatf 2raxmp;t1teto ieiysfmDranvp;(4tlxrxf3ootom raueol()teuo(mpoo4oltnmfct ()s2tau o;t0alxo o3ias sDul(vp;t4trtoif oa1la  lies;t)t2urimpoy1al e nvi ( s2umur no1opt if3iydfmDuau s;u4tlxnxrcty1op eau ol(0s2trio iy4lm  mnvtl(f 2ra( onu0altniicilsls rm( snt0 renxfcio1lmD aivs;()s2um(o3oudlltn fesa(f 2rrum oo4alx  i3iadlm2ran o u)aleoir ootla r ivolt  rtmxo3ou4omtnmicsas)a2raxrp;o4tpenmi3tls m umumsnu0trtnio3iatlp   u s t0 rtm(opoo1lmtn icsas)sDrmx pno1oetnif3ias m umu pnu0tlxoxo oytlp eluvilt)t2xmirpoo4aleelict ()s2rr(m nu0opto octls m rlnmsnu)tlerxfcty1faDeaues;t  etoio no1omt lncs (farur(mp;u4aexnmieilslaDea( o;t4aetnmf3ty1op eauvolt s2trio iu4opt  nesl( aDtax ooo1oee mf3tat m2raump u4aexoir3tadoat auvs ( srtm(o iu1al nmiesls aDtm(root4tltoifctad a2rmnvsn(0areoircoadoa  auvo t)seumxo3oo4ap e ictlt srtmu oou0tlto feiadfs umuvp;t0tetnio iy1oatelnvi;s0t2xo(r oudllenlfvtas)srtru o;t0teeomietydfsDra( p u4tltomo iytfa e u s;t trtmirpnodlme  ncilsf 2rauront1olenmieiadlaDrl(mp;t)texoiocio1fmDeauvil()truo(m iy4lmt mfcias  2rau p;t0opeoif3tldlsDranmo t0arxnirciytoaDr ues;(0 rtrim iy1lpe lneilt)srra(mo;o4olxomi3iadls ea( p t4teeoio3iotoa  lnei t setrxr3nydomtnmfcsat sDta(rp;u1oet micilslaDrlnmo t)artoif to1faD lnvo s)t2urim oudale lnvsl() rtmumoot1olx  ociytfaDemnmo;()tltoiocoadoat luvi ( teur(mpno4ap nlfvs t  Draxr ;t0tleomociltfm2uauvs ()trxomf3oadfp raneilt) 2xmxr oodllt mnesas  rurxmpnu1tlt ifeiyslsDua(vs;u0 eenxo3tydlp e ivi;s  2xrxo3ou1al nlfvs (f 2taxronu4oee micildfs2uauvpnt4alxnir tydlpt anvs t0truo(r nudal elfcsa(  2rm( oou1teto o3tad s2el(vsnu4 rxomf3iydopD aivi;s) etm(opny4opeemnvs (f 2uaxront4alx if3iadlaDul(vp t0artrmr3iytop e n olt  rtrio ou4amee nviasfs2ua(mpno1tetnmoeiatfm ulumpn(4 etoio3oadfpDr ueo s srxm(mpoodlme  nvtl() 2tru  ou1alxoio3tydls uanvs;()trxrmfcoo1fmteauvils0sexo(m3iydopenmivtlsf Dtm(rp;o1apx micils a2rlnvpnt)tlxriociydlaDeanvo s) 2urxm io1aptelneiat) 2rmxrpot0tltomieiadfa2rl(mont4 lerio oadlp rli ils)trurxr oo1alt lict ()s2ta(  ;t4oee mfciasls ranmsn()teerif io1fpt lnvo;t0t2toiopnudom e fciatfsDur( o;t1alxo i3tysfm2rl(ms;() exoif3to1faD au ols  2tmim iu4lltelfvs tfaDrm(moou1aexn ieiadlm eauvont4alxomr todom e ivo ( trxmim oy1aleemfeiat srrrxr oo0aet  ictytlm uanvp t0tltnif3ta1lpt  ivi;() exrxo3ny4lp n nvt t)aDtaxrpoo0opeoioeiltfmDem(vpnt)tetnxr oy1lptrluvolt)s2umxr3oudole lfvilt aDrmumooo0alxomoetltfa rm(vp t)tltomf iodlp e nvo;t0 2triopnydal emneias aDurxrooo4oee mocild s rmumpnt0texomr iatfpD  ueo;t)trxr(m3nu1lpee fvs tf 2truronu0tpxo octys m rmn p;u0altnmo oydomDeliesl(  rxmimpnu1omenmies t aDur(  nu4oetnmi3iadlsDelnvon() ltomf oydfatran o;()t2xmxopiy1apt miesls sDrm(  ;t1oexoifctld a2rmuvonu)teeoxf oy1late u s;s trum(mpoodoltnmiei tf rua(ro;o1optniieiltls uluvsnt)tleomr ootfatelues s0 2urxopou4apt mfeil()s2tau  ;o1oexnmf3iytla elnmp u4 rtrir ootoaDrlivi;s)t2uoxm oo1ap emncs (  2rm(r ou1aex mfeiydlsDemumo (4altnxociydomDe uvo;s truo(rpoodom emfcilsfsrumx ont1tle  feiadlm2rmn pnu) renxf oydfp ran o;s0srtoxrpno4al nlivtas) rraump;u0tleomfeiaslmDean pn(4tlxnmo3iatopteaueo ( t2toxrpiudap elnvt (fsrrmxr ot1altn feiydfa2rau o t0 rtrxo tydfp r n olt) 2urirpoo4opeelnvilt  Dumxmp;u4tpeo f3iytla emn o u)alxnmr3iadoatrluvs s0t2trio3oy4lltelfvtl()s2trxr nu4apxnmo3ildlmDul(ms;(4arenxf3oodomDrau olt t2xmxm ou1ale  neiasfarrmumpoo0tet moetltfsDum( p t4teeoifcoadlmt ln s;t0s2um(m iydlmee nvi s)arurxmpno4oexoiieilsfmDumnmp;(4arenmo3to1oa e nvsls0s2xr(opiudlm   fcsl(  2rru pou1olenio3iadfaDemnvo;() eeoirciy1la rauvils0sruoxr iydlp  lics tfaDrmump;u4oexnmo3ild m2el( snu)arxnir3iotfptean i;() ruo(m oydoleemfes (fsDtaxront1tlt  ieiasfaDuaumo;u0 eeoio3ta1oatr ieolt0 2trim oo4al n icsl( s2rau o;u1oetoio3iyt a2emu onu0aeeoxf3iatoa elivi t)texmxr3oy4al  lfcsa(f 2urxmpou1aptoii3iad m emuvs () lenxf ta1lmteaneols)seurio3iudom   iesltfsrraumpno0aetnmieiadla2ea(vp;u4altoxrctadfmt lnes t)texoim no4am e fctat)aDuaxmo;u4tet  i3iatlm2rl(vo;u0texrifcoo1fpDr n o t trxo(o iydop   ivi s  rumxmpou1ale mictltfsDem(vs t4tlxomr oatomteluvilt tetoxopiodolt lnesas)sruauro;t4alt mieiyd m2elnmsnt0 ltnmo tytlpD an i;s s2xrxo nodamen nci t)s2ur( o;u4teenifetatla uanvsnt0aetoxr iotfaDr ues t0 rtrim3iy4lp e fetatfsDtaxr oo0opxoif3tyd a2el( s;u0tetrifctytoaDrau ols  2xr(r3nu1lmtn ieia(farur(mp;u1tlx ifctlslm2rl(vo;u) exrxoctadoat  u o s0 2urxm oydam   neta()artm(ro;u4aetoioctldfs ra( p;u0altoirctodop eaueils t2urir iudamenlivias)aruaxm nu0ape if3iadla ulumont)aeeoir iy1op r ivo (0teurxrpiu1lltemfvtlt)aDurx pno0tee  o3tytls2ean sn(4texnmrcoatfateli slt0s2urxmpnodoltemfcilsf 2ua(mooo0apt mi3tat a el( s (0aetnxo3oytlaD aneil()t2xrir iydoltemiesat)srur(  no4apt  f3ils aDeluvpnt0areomf3oydla eauvo;s0t2xrio3io1ome mneia(f rtrur nt4tetomoeildlaDrmnvo;t0artrmocoodoateaivi;(0 rtoim3oodope  icilt srraxroou0oex mf3iltla um(mon(4trerirctytfa eau o s0 rtm(opoo1ap e fvsas a2rmumonu0teeomocildfmDeanvonu4aexoif3ootom ean o s  rxmxrpiu4omenlictls  rurxrooo0oet ioeiaslaDeanvo u)trtnxfciydfpt  ivi () etrxopio1al n ieta( sDumurp;t1tpxoiicias m eaumonu4 leoxoctatomDranvils0 2tmiopnudlltnlfesas) Dtrurono1ope mf3tysfa rlnvpnu0 rtoxrcio1omDrli i t0s2xm(m3nu1ope  iesl()srumxrp;o0tpe iictltlm umumpn() rtnxf ootfa e ieo ( srtoir3iu1altemics s) 2tr(ront4tpeoioeildls eauvp ()aeenxo3oatoaD lueslt0seumxr3oy4opt mnci (f Duaumpno1tpt  i3iltlmDuaumo;u4 lxnxo ia1lm e nvslt) 2uoxr3ou4op  livia( aDrm(  ;t1alxomf3tyt a2um( pn(4tlerxo to1lat  u o s)t2umiopiu1op elnet s)aDua(r oo0oetomo3iat m2emnvp;t4tlerxf ty1fpDran i t0srum(m io4op  mfeta(  Dtmxroou4oex ifciadla em( on()tlerxoctadfm rln i t)trxoio3nu1lmeelieta()aDtrur no0alxo i3ildfm rl(mp t0 lxoxo3iy1fmDelu ils0s2trim3nodoptelfci (  2raum ot0opeoiieildfa ra( p;u0 exoxf3oy1omD lnvi;t0 etr(r3oo4opeemnvs sf rtmx ooo0oexomfeiydlm2emu sn(0alxnmf3ta1la e u ols seuo(rpoy4apenlfci s) Drru pno4oee mi3tld s umnmo t0trerio oy1omt anei t trtr(m oydomeemfvtl( sDua(ro;o0tetn f3tasla2ea( s t0arxnmrciy1fmDraneil( seurxo oy1amee ncilt)a2tmxrpou0tpen oeilslmDulnmpnu4 rermociytomDe ivols)sruoim oy4al  lnctas) Durumo;u0tpe mieildla2ul(msnu) lermr oatlpteln ils0texrxo3nodameemncsa()artmum nt4texnif3iydlm em( pnu4tlermo to1fa  aneo s0 2xm(mpiu4apenlfei ()s2ua(ronu4tlx mfciltlsDumn s;(4 rtrif iy1lp  aivo t) 2um(m3ou1lp  mfcia(f 2uaum ;t0alt  icias a um( o;(4artrmf iydlpt lnvi s sexrio3io4lmt lfes s) rtmx  ot0aexn oetytfs2emu p;t0aetoir oytoptelnvol(  rxmxr3oo4ap  mivi ()artrxrpnu4ope mo3iyt s emu o;u4 ltnir3iadoaD livo ()seurim oodomen feiasf Dtmu ont1texnmf3tysfa2umnmpnt0aeeomf3oa1oate nvo s t2xm(m3iy1aleemnet (f Dtauro;t1tlx if3tatlm ea( o u)trtnxfcto1fa rlivi t trxr(rpnydopenmfcs t a2um(mpnu4opt mieilt s2eln onu)artrmrciy1lp elu s ()srxm(o iy1omenmics s a2tmxrp;o1tlxnii3iadfm2uaumo (0aetoxr3totlpD  nvs t0 etoxmpny4lp elfci s)arta(moou1oltniieiasls2ul( p u4aetomfciatlpte uvo s  eumio iu1llte iciat) rrru  ot4texniietytfaDem( s u)trxnir iatlm e nvo s  rtoir3iodolt  fet t aDraumo;u0oexo oeiyd aDulnms;u4trtrmf ia1oaDe u o t  rtoiopno1lpt lfvt t s2trxmpou4ope moeiltls eaumpnu) lxrir totlaD au o () 2toio oy4opte nvi (f 2uaxrpnt4tlen oeiysfm2el( onu4 lerio3oa1lmD  neo ()teur(opio1ll   ieta()s2urx  ou0oex  o3tatlsDran on()arxoio3iodomDraues;( s2uo(rpoy4amenmiesltfsDrmu pnu1tetoioctytls2um(vp;u4 rtrifcoadopt  ieols seumxm nudlmtemfcil( aruaxrp;u1aetomfcilsfmDeln snt0artnio oytfpDranvsl( srurxrpiudlmenmnvt ( a2um(rp;u0tpx  oeiys mDeanvo u4trxoir3oytfmDrluesls)truoxr3nu4ape mnet sf rrru poo4apt moeiytfa ean o t0 rerif oo1opt au sls truoxopnu4lmeemncta(faDur(m oo0tet iiciyt a rm(monu4aexoxf3oo1fp eaieo;()texoxopoy1lm e ieia() rrmum nu1apt ifeiytfm uanmp (0 lerir3iotom rlneslt0s2trxm iudlltemici t)sDraxmont0olt mfeilsfa2emn p t) eenio3oo1op eli slt t2tm(o no1om nlivtl( aDra(mpnu0tlxn f3ildls eanvp () reomf iytlp  aieols)seur(opno4oltelfciltfaDumurp;u0tptnmieiydfsDran onu)arenir tatlmDr nvi;t t2xm(r nu1altelfet sfaDrruro;u1ape mfetydfaDumuvs;u4altnmo3iatomt lnvi;s)t2uoxopoo4lpt lfetltfarrr( o;t4tet io3iydfs elnvo () ltoxo oydfptr n i t)tetmiopny4oleelfcia(  Draur ;u1opto oeiatfmDeau pnu4trxoir3oadlmtelnvi;(0t2xmxopoy1opt  fesls) 2rr(mp;o4opt  o3iydfa2rlnmo u0tetnxo ta1omtean s;t srtm(r3ou1ap  mfeiltf rrm(  ;t4opx  f3ilsls rl(mpnu)teermociodop eluvol()sexriopio4om nmnvilsf 2um(r ;o4oet iiciyt aDulnvp;u4tlenmr totfmD li sl()trum(opio1lpeelics sfa2taumpnu4alt iieilt m2umnms u4trxoiociatfatrai o;()seuoim3iu4olt  fetls) rra(mont1tlen iciasfa eln sn() ltoxo to1lpt  u ol(0teurir ny4lmee fetatf Draumpno1opx mictyt a elnvpnu)texnxoctydoaD au il( srxo(opoo1olee neia(f Dumxrono1tpto i3ias a eln o u)aexnmocia1omDrai s;(0t2toxr oudlm elfvt t)srumurpou0olx mictatfsDum(ms;u4tlenmr ta1fa raivs t)s2xm(mpnudop nlnesas artax pnu4tltnmictys s2rl(vo (0trenmr3oatlpDrln i ( t2urir3iy4lpe lfcta(fa2rm(m no0oltomo3ilt s ul(vp;t4trtrxocoatop eluesls) eumxrpnodom nmivslt) Dtmxmo;u0tlto ociydfa uau s;(0altoxo3ia1latr u ol(0t2uoio3ou4om n ncilt  rtru  ;t0tleo i3iydfs emu o;(0aeermociodfaD ai slt t2xoxopoudolenmics t)srrrur ;u0tetoiietlsfs elnvp t0arenmf ty1fmDr nei t s2toio nydaptnlics t)s2uaum nt0aeenmo3iaslmDua(ms;t0 eerxf ootlmt ln s;s0 rtmirpoodom  mfetat s2um(moou1opx io3tydlm ul(vont0tleomr oy1fp e n o;s)seuriopoo1alenlnvtas)sDumxmonu4altnifeiatfa2ra( on(0 etrirciytoaD  ivs;s)sexoimpiy4ol nmnvtl( srum(m ot1olxniictls s2rmu p t0aetrmo3iadoaD ai s s)s2xm(m3io1alt  neilsfsDtmxront0tpeo fetlt aDeanmp;u0texomo3iatfm rai i;t0 rtm(mpoodllen nvi tf Dtmu  nu4opeo octls aDrmumon(0altrio oydlpDe u o s) eum(r nudom   ivia()srua(  ot1olt iictydfa2ran s (0 etoircoodlpteanei;t0s2umim nodoptn nctltf 2uru pnt4tetnmicias mDea(mpnt0altnmrctadlp rli i;s  rxr(m no1ope lnvias) Dum(rpot0olxomociadlsDumump (0teeoif oydfmDeluvo s  2tm(mpoodalen fcils  rrm(rono4tle mociysls2ranmon(4 eeoiocta1fmteli ilt)teuoir nudomtn iei t a2trumpnu0aetnmfcils mDulu o;t4trxrir3ty1op ean s s0truoxr iydlme mict t  rrmxm ;o1tleo feiyd aDuluvs u4 exomo ia1fmt  u i ( tetrimpiu1ale mfet (fsrur( poo1optomfcildlmDeluvs;t)arxnxr3oa1fa elnvol()t2xo(o nu1aptn nes s) 2trumo;t0tpe  fctat a umu p u4 eermf tatlpDran i (0 eum(m3io1lp   iei s) 2taump;o4oetnio3tatls em(mp;t)alermf iotlp raneo;()t2uoirpnydom elfet s)arta( oou1aetoii3iys a ul( s;t4tlermr3oy1lpDeliei;t0 rtrxmpiu4lmt livsls  2raxrpot0oexoio3ildlsDeluvs;u4 rxrmrciy1omteluesl(0teto(m io1lptelfvs t  2rax ont1tptnmo3ilt a2rmuvs;u) leoxrctytlmDrluvils0seumxrpnydop   fetlt) Drmxmpnt0apt  fetyt mDeau p (4 lermrctodlate n o ( truoir3ou1lptnmicias)sDtaur no1ole iietatfm ua(vs (0 exrmf oadfa raivil()teumxmpou1ope livs ( s2trur no0tlenmo3iat aDulu p;t4 leomf ty1laD lu o t0 ruoxopoydap elivia(f Dtr(m no4aexo f3tad aDuanvs u4trenmr3oodopDranvolt0texm(opnydam emnvsa( sDuaxmpoo0aet  o3ils m2uaumsnu4aetomr3oy1laDraivs;s  exoxmpoydoptemfvsl(fsDraurooo4ale ii3ias a2em(von() rxriocoo1latrauvi t t2toiopnu1aptelfvias) 2uau onu1tee iieiydls rm(mp;(4alxrmo tatoptelivo;t) rumir3nu1ol nlietlt arrr(mpno4texoifciasfa2ul(mp;t4 reoio3oodoat  n sl() 2trxo nu1amen icslt)sDrr( o;u1tptnmi3iyt m rl(vsn(4 eeomo totfp ranvo (0sexmxr oo1ape livt s aDraumooo4apt mo3ias s2emuvont0aetrxf3iydlpt  n ilt) 2uoirpio4ll n nct ( s2taxm ;u4aexomo3tadls2um(mon(0tetrif oodoa rluvs s t2uoxrpoo4apte fei t a2umxm no4apenmfetltlaDum(msnt)trxnxo3tadfmtr ueo ( texr(rpoudap   fcsa(fartmuro;u1olxnmoeiysla2em(msnu4trenxo3iytlptrlueo;(0setmirpnu1om  livtlt)a2uaurp;u4aeto iciysfsDumn o u4 rxrir oytfmt  n sls)teurxmpoo1lpenlnesl( srtmxrpnu0altomiciatfa ra( pn(4aexoir tytfa  auvo t) eto(r3iodolenlfcs s a2ta(mpno4teenmocilsfsDumu p;u0teenxr to1fmtelivo s0s2uoxmpiodopte ies s)artr( pou0oet io3iyd sDuluvpn(4alermf3iydoaD anvilt)teuoxr3nu1lmt mietasf 2ur( p;u0tlen o3tltlsDemnvs (4aetnxfctodlaDrlnvsl( trtmiopiu1opeemiei ( aDtaxm ot4ope ioctytlmDumnvo t0 rtnxo oodfateauvo ( t2trir oy4om   neilt srtr(rpot1oeenmf3iltlm em(vp;(0teeoio oy1lmD anvo;t0setmim3no4altn fvsa(faDtm( pnu1ape mietasfs uauvo u4tltrxfcoadoaDeaueol( s2trir3ny4llee feia(f 2rrxmp;o0opt  feiadfa emumsnt4 leoir iydfmte i ils)srtoxopoy1omtn ncils) 2tmx ooo1oleo o3iyslaDrm(monu)tetoifcoo1op e uvol()t2trim3oodop nmiei tfsruau oot1tlt  o3iytla rl(mp;() exnmf3totlpD  neo;t) eto(rpiudamt  fvilt srrauro;u0oltnmieiys s ranvs (0 exnircoydlm   n il(0sexrxopoy1lmenmiei s)srrr(  ot1tpx  oeiytfmDuanms u4trxnxfciodom r iei;t  exmim3nu1lltn fctlt)aDraum ;u0aptoio3tytfsDem(vonu0aleoxr3iotlmDran o (0 rtmio nudlltnmnesls)s2umxm ;u4oex io3iatfs2uan s;u4aexrxr iatlaD ln il()s2trxr iu4oltnlivilt)arua( oot4alx  ociat m2ua( s () ltnmrcta1fmt anvi;t) eumiopiudomtnlies ()srrm(ro;o4opt mo3iltls2el( p;u)areomo iadla raies;t  2umxo no4al e nctlt) Dtaxrpno1tpenmfetydlmDuan s (4arerircoa1fatrlivi;s)s2to(opny1ale  nct (fs2urumont0aetn fciys sDuln pnt4 exrio oa1fmD aies t)t2tr(r oo1lp   fesls s2rmx ooo4teeo ieiltfsDelu p;()areoio ta1lptrln il(  rtoxo3iy1lmte ietas a2umum ;u4opt ioeiaslm ua(vo ()aexrmf3ootfaD ai i;s  2xoio oo4lle  ieta(  2trurpnu0optn fctlsfm2eluvp;t0aetnmo3oadlatrli o ()srxo(r3ny4olee fcslsf 2tmumoot0alenif3iyslsDrl(msnu)trtrmo3iotfm   u o;t) 2xr(r oo1om  miei t)sDtmxr nu4apx iiciltfa ua( snu0arxoio3oytlpt  ivo;s)s2uoxr oodolte nvsl(f Dua(m ;t4olt moetldfs2rluvsn(4arxnxf3ty1fpDe i ols)s2xm(r3no1ll nmncs () rtmxmono4aexoiictldfmDulnmo ()tlenmo3iotomt  i s;t) 2uo(rpiydlme  fvs tf rtmxrp;t4oex  fcild s rmumsn() renxo ia1oaD aneils0s2uo(o oudopenlfetls a2taurpoo0opxoiiciyslm2rm(mon(4 rxnif3tytomDeauei t)teur(o3iydlmen nvias a2um(monu0alt mietys s2ran pnt0 ltrmfcoatopDe n ols0s2to(o3nudap e nvilt  rraxmooo1oetnmictat m elu p ()tlerxr3tydomDr uvslt0 rurim nodome livtat)s2rau pou0ale mictysfa2el(mon(0 exoir3oa1omt lu s;s texrxm io4olt lfct ()arrrxront0opxniociyt m uauvo () etoxociodfatrau slt0setrxopiy4olenmnctl(f 2trxmp;o1apt ii3tat aDrmn on(0trxoxo oydfp   neo s)t2xoxm3io1am  lfct t  2uaum no1apt iiciat m rl(mp u) rtoxr3io1opD ai i;() eurim3iodomt lnci ()sDtmxmpot0opeoioeiltfs2um(msnu4 rtoif ia1lm e nvilt) 2to(rpoydlmtn icta()artau poo4apx  ieilt a2eaumsn() etnif3oatlp raivol()trxo(o oy1lm nmnvs s s2ur(roou0ale io3iatls2eanmp;()areoif tatfmte uvsl(0srtmiopiu1al  lnes (  2rmu  ou1apx if3tydfaDean o;() etnmo3iytomtelneo;s0s2uoiopny1olen ivs t) rtrumooo4tpt miciysla eluvp u) renxr3oadfaD liesl(0 etmir oo4llen fes s artaur oo1ole  oeilt a ra(vont) ltomf3tytfp e u slt  etrxr3iodam  mfetl(  2rm( pot0oexnmietytlaDul( p ()texnir3todfaD an o;s) eumir3oydlmeemnes ( srtmum ;o4olt iieildfsDrmums (4treoxf3ta1fm  lnvs;(0trurxm3iudol n fvtltf rrmx oou1aeto i3ilt s2umuvp;(0 rtrxo3totfaDelnes;s0 2tr(o no4aleemivtat)s2ta(r ot1teeo octas m2uluvp;u4 leriociatfpte nvs;s) 2tmxm nodame mnvsasfaDtr(m ot1tpxoifcils s2uau pn()tetnirciatopte uei t0s2umxmpoy1al nlnetls)sDtaxmo;o4texomictytfs2uanvo ()aexoxr iodfp rlivils0sexrxopoydlpt lnvi s  2ua(mo;u0tlenmictatfaDra(msnt4arxoircty1optraieslt)t2uo(o oo1oltnlnvtas a2ururo;t0alx miciyd m eauvo;u)tlxrmo iydfp   n olt trxrxm iydom nliesls  rra(mont4oet io3iyt m em(vp u)trenxo to1lmt lneslt0 ruo(mpoo4lmtn neilt)arrmu pou0aeen fetldlsDuau s;(4aleoirciatomDrlueo s0t2umir ou4omtnlivt ( aruru pnt1aee  ieiaslsDeau p;()aexnmo oatomteanei ()srto(r3iy4opee nesasf 2tr(r ou4openio3iltfmDranms;(4 lenxr todomt anvols  rurxr no1ll   ivtat srtax o;t1tetomieiad s rlnvp;u0tetnxrcoy1oat  n slt trxmxo3nu4lmtnliet s srtm(rpnt0tetomociytla2rl( on()altnxf oodfptraivils0srtrio ny1op elivsl(fsDraum ou1altnmi3iat s2emn p ()alxrxrctydlp e ivo;()teur(m nu4ole lfvt s)srtr(ront4ole  fcias m ul(ms;(4 leoif tatlm e iei;s)t2tm(mpnu4ap  lnei (faDtrxro;t0aexnmoeiyt sDrmuvp;() lxnif oy1omD livslt teuoxr3oy4optemiciat sDurxmono1aeen octld s2umnmo (0 rxnmo3oo1lpDeaueo (  etr(o3oydomt lnvt t) 2ta( pot0texo ieiasla um(msnt)altnif oydlpDr nvo;t0trurimpoy4lpee nct sfs2rax onu4texn o3tasfs2uaump;(0tlxrmo iytlmteaivols0trurim3no4ap emictat sDrr(mo;u1tleomfcilt aDrau s;t)aeeoxrctydoate ivo;t)sexrio oodlptn nvi s arta(rpoo4tee mfctaslaDua(ms t)tleomo iy1lm eai il(0s2umxr oy1llenmictas  2uaxr ;u4oetnmfcilsfs ra(ms;u4alxnmfctadfm e iei;(0trxmxr3nudlp  liet ( aDtrxmpot1oltomfciaslmDuau sn(0texomf tatlpte uvo;() etmiopno1amenlnci s)sDumxro;t1tltomictytfsDumums;t)altnmocia1opDeaues t0s2umir3nu4om nmfesat) rtr(m no0apxn ociatlm umn pn()alxoxr todlaDeaieo;(0 exrxo io4am elncia( s2uru p;u1oltoif3ilt aDrau onu0 etrxo ta1faDe neo;(0 2trxm3iu4am nmivtatfs2rmu  oo1tee mi3iatls eauvpnt4 ltriociytlpt lnei;s tetoio iydlmtnmfei s  Dtm(r ;t0aexomfeild sDranvsn()teeoif oo1latelu slt) 2tmim3nu4aptnmietlt sDra(m nt1aexnmf3iat s eluvo t4arenmoctydlpDraivsl( seto(r3nu4ap nmfvslt s2tr(  nt1oex  ieiat mDemuvp;t4 leoxf3tadlatr n s s0srurir3oo4am nliciat arta(mont0tee  i3ilt m ea( o (0artrxf3iadlm eli o s t2umio3io1lp  mies (f 2ururooo1oetoii3tld a ra(vp t0tetomr oo1latrlnvs;s) 2trim3nu4ome  fvi tfartrum nu0tetoiieiydlm2eau onu0aetoxrctotopDeanei t) eum(o3iy1lmtelfvtls  rrax onu4aetnmoetatlm ul( onu0alerxrctodoaD  u i s s2uo(o io1ope lfes sfsrtru pno1tpe mociasfmDeluvs u4altoxfcty1oa e ivs;t0trtmiopnodllt lnvsl()s2rau pot1oleoio3tasfm2eaumo ()altrmo ootfa ean ol(0truo(m3oo1ol emfctl(f rtmuro;u0apxnmiciys m2emu p t) ltrmo3oodfa eli ol(0t2trxopnudomt mneia()arur(ro;t1tlenmociyslmDelu o;() etnxr3ta1fp e nes;(0srtmxm nydape lnesl( s2tm(m ot4alxomoeias a rmnmo;t0 exrmr iydopDrau o;t0srtrxmpno1lp elnvta() rumxroot0oltoifetaslm ul( s;u4 rtnmf3iadfaDrlivi s)s2uoxopnu4lp emicsls)arur(ronu4tpxomi3tatla rmnmpnt0teeomo3iytomDeai s;t)srtoxrpoy4opt  nct tfa2um(m ot4oet ioctlsla2ulumsnu4texomr3todlp   nvs;s0trto(o3iu1omtnmnctl(fsDur(moou4tlen ictldfa2eanmp;(4artnio3tadoa  lnvsls setoirpoudalt lncilt) Dumu pno4tlt ifciadfm ua( s;u)tltrir oytlateli i t srur(o iodlmtnmneias)s2uauront4tlenmfctytfm2rmnvsn()tleomo3oodop r u o;( srxo(m3oodlp n nvtlt a2rmur no1aet  fcildlsDrln p;(4 etnmo3tadfmtr uvsls0 rur(o3no4ll n nvtlt a2umx ooo0teeomociys s2elumsn(4trtoxf3tatlatr ueo ( s2umxr iu1ol  lnctl( a2rmu pou4ole iieildlmDrlnvon() rtrxr3iytlpt  uesl( truoio3oy4om  lnesat  rtau  ;o4aptoii3ildlm2rl(mp;(4teeoxo oadfm e nvo ()truo(m nodlp emfei tfarraxmono1opx moeiltla uluvpnu)trtoxfctytfptr n i s) 2uoio ou4al  mnci s)sDua( o;u0tlxoif3ias m rluvs (4 eeomfctatfp   ivo (0trtmxm iu1omtnmnvtat arta(  nu0olxnmoetydfsDranvp u)tlxnxoctatlm eaivolt)t2um(r3oo1ame mfeil()arrru poo0optomieiatfa uauvo ()aleniociytfmtelueo t)trurio iy4llt  nctas)sDtmxronu1texomf3ias m2umu s t)tltrmfcto1laDeli s t trto(m3ny4ol elicsas  2rrumpoo1aex if3iltlm2el(ms;(4altnmf3iotfatelnvi ()srtrim3no4llt miet (f rurumont0teeomfcildfs2rluvo;(0tlxrmfcoadoatranvo;t0srumxopoydolen iesasfaDtr(root4aexnioeilsfs emump;()aeeoxo tatfpD aieol(0 rxo(m3oo1llenliei t aDur(rp;t1alenifciasls2ul(vpnu)areomf3oatlaDeluvi;s s2trim oo1ome lfcilsfsDuaurp;t1tlto f3iyslmDrm( o;(0treoxfcoydfmtelnvs t0t2xrir3nudlpee icsl()srtrur no0oeen oeiatlm ea(mp t)tlxoio3oodlmD li sl(  2uriopoy4lptnmivs s srumxmpnu0oexn o3tat s eluvonu)arxnxocoy1opt  ueolt  rtoxo3iodlm nlfetlsfs2taxrpou4opx  f3tlsfa2em(ms t)altoif ootlpt  ieo;t texrir3iu1ape  ivilsfa2rr(monu1olxoii3ildla eauvp;(4aeerirctytoa e ueo;() rxm(m ny1lpenlncsas aDuru  nt4texomoeiaslsDrauvo ()tlermfcoy1fateau s s0teum(opou1lmee ieilt srtauront0tpx ioeilt a emnvs u) lxnxrcto1opD aneils)trtr(o3no1ale livt s arurumpno1ope if3iysls2umums (4tltrxr iatlpt  nes s seurxopoy4lpen ivsa( s2raxmooo1tlxomfeilslmDea(mp t)aexrxr ia1la  ai olt  exoiopnodlpenlfct t)aDtau p;o0apt ifeiytfm ua(msnu0arenxf3tytfmteln ilt)t2xoio3ou1lp nlieiat  Durxmo;o0alxniiciyslsDeau pnu0altoxrctydlm elnei s) 2tm(mpoydam  lictl(farraxmpnt1aptnifeiadfa rmuvp u4 reoxo iodla  ai sl() exoxr3iu1lle mfci s)sDrau  ;u1ope iociat aDem(ms t0 lenifcia1laD anvi t0trtrim ou4op emfei s  Duaump;u4tpx iietlt sDuau s u4trerir3oytfm rai sls0texrio3iu4apeelics s  Dur(m nt4tpe mf3ils mDrlu o (0 exoxr3oodfpDeluvsl( texmxopiydlle lfcias) Dtmur no1tptnio3tls s rau o u4aetrxfcoatfm  lieo;() rumxr3oo4aptnlfvta( sDtru  oo1oee  o3iltlmDuanvont0 lxoxo oa1lpt lnvol( teur(mpio1aleelfei (  rrmu pno0aexomictlt a2el(vo t0 ltrxrcoo1fp rlues () 2xrim nudlptn fcs tf rrmxmo;u1aeeoifetlsfm rln s ()trenxo3oy1lmtelnes ( s2uoxopnudal nmfct tf 2rmuroot1ale  oeild sDrl( p t4artnxr3to1fpD livo s)t2xrxrpnudale mivt t aDrm(mp;u0tptomf3iad m2em(vo;(4 lxomrctydfm eanes;()srurxopoudapeelict ( artmurono4olxomfeiatls ea(monu0trtrmrcta1lmDrln o s)t2xr(o nu1amen nei tfsDrmum ou0texn o3tld sDrl( p;(4 lxomf iotlm rlneil(0srxr(opoodap e ivils)srra(  ;u1oltoio3ias s rl(vsnt0texnio3oydfaDrlnvs s) euo(mpiu1omtnmfcs () 2tmumono0oet ifeilsla2uauvo;u0aeenxf3oydfmD aieilt0seuo(mpoy4olt  ieiatfsDta(ro;u1tpxnmieiatlm2ua( pn(4 lxrio iatlate ivils  ruoio oo4lmt lnvias)sDtr(  no1tlt  oeiadls ulu p;u0tltnmf tytfm r nes (  etoxo nu4lle livt s) Dtr(m ;u1ale ifciltla uan pn() rxnif tadla rlies t  etmxopnydaptnlfvsls aDrrx  ou4aex moeiysfm2um(vo t4areomo3ia1om rau sls)setrxr ny4op elfvsatf Dua(r ;o4opt mf3iysls uau ont) exrmoctatomDean s;s0 rxo(rpny4ll n ncsas) rraxrpnt0oltn o3taslaDuln pn()alxnmr3iotfp eli i s0srtmxm3nodaltnliciat)sDraxront1alxoioetldlm ulnvo u)tlxrxo3iodoa  lnei () ruoim3iudamt mfctl(f 2rrxm oo4olxn fetas s elums;() rtrir iydopDe uvo;s)srtmxr ny1lmtn nvt s sDtax pno4oeen ieiydfa el( o;(4texnmf3tadlp e ueo;(  rtrio iy1omeemnvils  Drrxrpou0texo ocils s umuvp t0 etrxo3oy1opDe n s ()s2ur(m3ny1lp e ivilt aDur( o;t1aptnio3iadfs2rlu s u0teermf3oo1lm rluvs;( s2umxo3nydam nmivslsfa2trxmpoo4oeeniietaslm2umumo t4alxoxocta1fm rlnei (0srxrxr3nodlmt lietas) rrr(rpoo0apeomf3ilsls2ul(msnu4texnmrcoo1oatrai i (0s2um(o oo1ome lics s) rtmur ;u0opx  o3tlt s2umu p ()arenmo3tytfmD lu i;s0t2tm(r3iydomeemfcs ()s2rmxm ;o1tle  fciatfsDuan snu0aeenmf totfpt an il()srtrimpoy1omenlicia(f 2taxr ;t4teenmf3tlt s2um( s;u) exoxf oodlpD  uvo s srxmio ou4lptemncs tf Dtr(  ;o0aet mo3tldfa2eanvp (0teeoxo3tadfmte uvol(  exrirpou1om e fcsl(  2rrxmo;t4ope  f3ildls2um(mpn(4texoir tatoatrlies t) rtrxo oy4lm elnct s arum(root0oeeoio3iydls2uaumon(0altrmf totfmDrai o;s0srxriopno4lmtemivtls)sDtrxm no4ale ifeiatlm rm(mo;(4 etoifcoo1lp   i sls0tetmim3iydopt  fet (  ruau  nt4oeenifetyt s ranmo t4texnif3oadoa  lieo;t)t2urir3ou1opte feilt)srumx pnu1tlx micilslmDrm(ms t4altnmr3iatfp e i o;(  rumim3no1omeemictasfsrtmurpoo0tpeniieiasfs2ea(ms (0 renir3oo1lptrai ilt srtm(o ny1op emivils srumur no1texnmfciysfmDrlnmp ()tlenmr oytomDr iei s)seur(r nu1om emici t)a2trumpnt1opeomfctldfa rmn onu)texnmfciydlmDelu o s0sruoir3oy4olt mfvsl( a2tmxrp;o4aleo o3iyt s2eln s t0alenxo3tadfp raueo;t) euoxrpoy4alt mictat a2raxmo;u0ale if3tls sDrmump t4texrxr3iadoatranei s0t2uoim3oy4oltnlnei (fsrra(mpoo1tlxomieiydls2ea(mo (4trtrxo tadom raiesl(0srxo(r3nu4ol n ivtasf Drmum ;o4oltnii3ilt a2ra(monu)treoir3oatfm eluvo ( s2xo(opny4amtnlfet tfsDtr(mont4apx ifcils s2rau o;t4 rtomr todla  aueils0 etr(m3ou1ol n feilt  Dururo;u0altnmfeias a rmu on(4tlenmo3iatfaDelues;( s2tm(o oy1oleelfcsasfsDtrumoou0optniociytfsDua(mp (4aetnxf3oatfm rlu ils0teumirpou4lmt lncsas a2ta(r nt0alxnmi3ilsls2rmnmo;() lxrxo to1oat aivi s sexrim oydlp nmfvsa(faDtr(rooo1texoiiciad m2ulumont) eenmoctodfmD  nvolt trxoim ny1lmt  feiatf 2rmu o;u4alen f3tys s eanvsnt)aetnxo oodlpt anvi s)s2toxr3iodap elncslt)sDrrx poo1tet mfctltlm um(msnt0 etnmr3to1fmtrluvs t0 rtr(o iu4ll  mfci (  2tmx o;o1ole mictydla elumpnt)trxoxf oy1fa  anvs () rxmio oo4ll emfvi t)arrru  ot0optnmociysfsDrluvp;(0tetoio ia1fmt  u s t) etoxrpiudopt mncta( a2ua(r ;o1aeenioetlslaDelu s t4tetoxocio1om raivo (0 2xmxrpio1lmeelnetat) 2ra(m ou4opt mociyt s2ul(vpn()altnxfcio1fmteaivs t0 2xrim oo4lm nmneslsf Dtaxmp;t1apx iieiys s um(mpn(4tlxoxocio1oaD auvi;t0 ruo(opno4op   nvtls arra( o;o1tpeoiictatlm2raump u) ltnio3oydoptraues s0srum(r iydoltn icsas) 2tmuro;t4teeo o3iasla rm(ms (4teeoirctatfaD anesls) eurxm nudam emnvs t) Duau p;t1tleomieiasfs emumo u0trerxo3oytlmD  u s t)trurxopoodopee ncias  rurumpou1oeto o3iatfsDelnvs;u0 exoxfciy1oaDelu o t  rto(mpiudlltn nvt (f Dumxm ot4ape mi3iysfm ean o;()trxrmr3ta1omtelnes t0 rxmimpio1olen nctl(faDrm(  nu0oltomieiat s rlnmpn(4 lerif3iytfp e ueols t2ur(r iudlleeliviltf 2urump;o0ole io3tytfm ul(vsn(0 lerircoy1la   u i t)srxrxo io1om e ieslt) Dtrxr ot1opt  fctytls2emuvp;t4 rxnir3iodfmtrlnesl(0teuo(m3iy1am nmfvsa(fsrtru oot4ale mfciltfa2emnms;(4aeerxo ootlpt lneolt  rtmio oydapeelivil()s2taxmooo4aexo fetltlm ean p;t0treoif3tatomtraieilt)seumxrpnu1lptnlnctat srtmxrono1alt mi3tydfmDrlu o;t)aetoif3todlmt lu sl( trxrirpiu1om  licslt sDraum oo0teeoifeiltlm2el( o t)aetrifctadfmtr i ils)s2xmxr oo4lle mfvtls)sDtmxm ot1aee  ieiatlmDumn p;(4aexoxr tydfpt liei;() exmxm nudole  ncta()srrru oou1opxoiociysfa umumsnu4tlxrxrcoadom elueo;(0 exmimpny4lm emncils  2uaxmo;u1apen o3iydls rl( snu0tlxoiocto1oa  aivs t0t2trxopoo1lpe mfvi (f 2ur(  oo4teenmfetys a rm(vo u) rtnmrcootfp  aneilt)seurirpnodop  licsas sDumxm no4tpenioeiadlm rlumont4trxrir oatfmt ln o ()sruoim3nydap nlnetl( s2rrx  nt4alen fcilt m eauvo u0tltrmr ty1fmte i sl( truoiopoudalt mfciat) rtrurpnu1olxnmociasfa2rauvonu4 exoxfcio1fpt luvo;s texmxmpiy4op   nes t sDtau  ;o4alxoif3tadlsDrlnvo;(4 ltrmrciatfmte u i;t) euo(m nu4altnlnvi tfarurum ;u1tpe iictldfa2ulums;(4 etrxrciydopt lieols0 rumxr3oo4lm   fvta(faDrm( pnt1olxoiocilsfs um(mon(0arxrmr oadopD an il( sruoxm3no4ole lncil( arurxmont0opxn i3iltfsDulnvs;t0 lerio totomtean s s0s2xmir nudalenlivsa(fa2taxroot0aleo ocilslm rlumpnt0alxrir3oodoate ivo ( trxm(o oy4oltelfci sf Drm(m ;u4ape ioeiytls2ra(vs;t4 exrmfcia1op raivi;t0tetm(m3nodal  lneil() 2raumpnu1alto ociyd mDeaumo u4artrmo iydopDeai ils0srxrio3ny1ap  mfcsa(fsrur( ont0tpto fctydla rm(von(0aexrxrctotom   n s;t0sexr(o nodlmen icils  2ur(rpot4alxnmoeiadfa ulu pnt) rxrio3ia1lpt anvs;t s2xoim3oy1lle  nvtasf Durur no1optnmoeiyd m ua( s;(0 etoxr3oodla elnes;t) exr(o iy4lleelnvi sf Dtrxmpoo4tee  fciatfa rlumo t0tlenif3ta1fmteln sl(  2tr(opoodllt mfeiltfartmu  ;u4olxomieilsfs2um( pnt4 rxnmoctotlmD anvilt setrir io1ol  lfesa() 2tmxmo;o0olt if3iys aDrl( s;t0 rtrmo to1la eai o () 2urxrpny4lmee fet t)a2uau  nu1apxn fetadfs2ean snu4 rxomf3io1lpDeaivsls0 2ur(mpno1lpt  neil( s2urxro;u0aexo fcilt a el( p;(4altomf iydfmt lueils) 2urxm iudlpee fcs ( artr(ro;o4altn oeiltfmDumums t)artrxo3oytlpD aneol(  2toio iu1lp nlnvtlt srum( pnu1ape mf3iad sDulnms;(4trxnio3tytlat an i (0srxr(o3no4lmt  fcs t)a2ururp;o4aee mfeiysls um( p () leoio3tytom   i i;( t2xrir3iy4al emivilt arur(rooo4alx ioetasfs2uanvsnt4alxoxf3ia1fa  lnesl() eumxopio4al  mnviat)s2urx p;t4oltoiictys sDran o (0trxrir3oa1oaDr uvsls sexoxm3iy4olt lfvs s)srta( pou0tltoif3iasfs2elu o;u) lxoxr iatlpDelivo t)t2um(rpoo1omee nvslt sDrrx pot0aetoiociytls rluvp (0trtnxocoatopDran i;s t2xoxm3iu1apte ncia() Drmxmpoo0tpxomoeiad sDrluvo () eeoir3oodoatrai ilt) eumio iodap nmivt () Dtau o;o0aleoiiciyd aDua(mp;u0arxnir iytfaD aies ( seurim iu4optnlneilt srrau  ot4aeto feiadfmDraump u)tetrxfcio1omDrli o (0 rtrim io1amt mies ()aDta(rpoo1alxoiociatls rau snt4aetnxocoatlpD lnvi;s) rxmim3no4oltnmfesat s2umum ;o0teto o3iysfa ranvsnu0 etrmoctydfpD  n sls)s2uoxo3nydoltemies sfarrr( p;u0olxo fctlslaDrm(vo (0aeeomr oatoa rli o;t0s2ur(mpiodal nlnvslt  2taumpno0tpt moctltlm2ra(mon() lxoiocoo1fpt  nvslt0 eumirpio1ll  mivtasf rtmx onu0openmfctadfa rl(msnu)texoir ootlpD  ieols0s2uoio3oydalenmivt s a2raxmo;o1tpe mieiaslmDul( onu0 rxnio3to1faD  ueols)setmxrpiydlltnlivia(faDuau poo1aetnmi3tadfsDrlu o;()artnmo oodomD livslt  rxm(r3io1alenmncils  rtmum ot0texnmfeilt m uauvsn(0trtrif todlp elu o s0tetrxopou4olt lfvil( aDtr(  ;t0opxnmictlslm rm(mpnu)tetrmf ta1lp   ivs () 2tmxmpoo4lmt lnvi s)srrr(rpou4oex iociysfaDranvp;(0 eeoxo3iydoa rln s;s)sexmxmpiy4lpt mics s)srtm( pot4oexn ictys m2uluvsnt) renxr ta1fatraivo;t) rumxopou4ap nmnvtat)sDurxr nt4tltnmi3iytls2rmu s t0teerif totomDe u o;s)t2uo(r nu4ll   fcsl() 2tr(  no4aexo oeildlsDrmn p;t0alenircoytlpte neo (0truoio nudll  mietlt)aDumxm ;o4oet ifctysfm eauvp u4aexrmr oadfateaneolt) 2tm(m3oydope mnesatfs2tmurpnu0oexnifeiatfsDelump t)arerxo3oy1oat lieil()seurim3oudame  net t)s2rm(  nt0tleoifeiltfm2em( onu4teeomrcto1lptraiei (0sexrxopnydaleemivt tfs2rrumoou0tptn fctldlsDra(vs;u4arxrmf iytlp  lnei;s0 rxoim3nodalt  fcta(fa2tr( oou1apt io3iltfa eanmo t0 etrxrctydfmDr uvsls texoir nudale mfeta()s2umxroou4alen ictltfa ua(ms u4alenxo tadoaD aivi t  ruoxrpiodlmtnmnctlt) Dtm(m nt4tpenmi3iasls2emums;u) lenxf to1om  lu s;(0srxmio3oy4lleelivils s2rrur ;t1oltnmo3tadfmDeau on(4teerxf iy1lm eaies s)trxrxopnu4amtemncsa(  rraxro;o0tltnmoeiyd a2rl( p (0aeenioctatfpDr nvo t teur(o3oo1al emnctasfs2rmxmoou0aleniiciatfmDrmnvo u0tetnirciytlm elivs;(  2uoxo io4aleemfcsatfsrtm(rono1aetnioeiys mDelnmo u)arxrmf3tatla eaneo s trxrir iy1ape mnvi (fs2tmxmpot1altnifeilsls uau s;u0 rtrmrcoa1op elnvi s)setrxr3ou4llt lnes ()a2trxroou1apx ioetltlsDuau snu4texrif todomDrlu il() rurirpou1om elncta()s2tmxmooo0apt  fctys m emump;()tlxomo3tydfm r ies s) rxmirpoo1al e ici s a2uru  ;u1oexn i3tyt sDra(vo;u4trxomr3ty1om r ueol(  ruo(o no4lmtnlfeils)a2tm(m ou4oee mieiatfm2emnvp (0 rtrxf3oadfpt  u i;s t2xm(rpnudlmeelneiasfarrru pnu1opx moeiys a um( pn() rtomo oadoatelueil() eur(r3nodomen ieil( srtaxrp;o4aptn ociysfa2ulu s;(4texnxo3oydfpD auvs s0truoxm iodopen icilt a2uru  nu0tle moctls m2em(mpnu)trxrio oatop e ivo;( trumir3iudoltemivta() Duru ont0ape iictydlaDrlumo (0aetrxf3ia1laDrluei;s)t2uoio oy4ome  nvsa(f rtmuro;o1aeeomi3tld sDuanvo u)arxrmf ootfateanei t) 2xm(rpiudolt lnetatf Dtmum oo0apt mo3tad aDrl(mp u0 rtnircoadla rlu s;t sexoxr3io4omenmieilt  2urur ;o1apt mietld m2um( o (4trxoxr3oytlat au sls)trxm(r3nudamtn nct tf 2tr( p;u4aexo f3iyslm2um(msn(0 exrxrctytfmD  u olt)s2tr(r3nydop eliei (f 2rr(  nt1aleomi3ias mDeluvo (0teenmfcoy1lm raneo s0trumio3nu4om  lneiltfa2trxr ot4olxomf3tad mDea(ms u0altomrcoatomD  u s;(0 exrio3oodop elics ()s2tmxm nt1aexoiieiat s2em(vpnu4aetnif tytfmt  nvsl(0teuoir3oydamt lfvi s  rtau  ;o1apen fciysfs2umnvp u0artnmfcty1lpD li i;(  2toir3oo1lp e fvslt)s2ta(r no0oltomfcilslmDelumon() etniocoadlmDran i;t) exoxm nydlltnlieil(  2tau pot1apenmi3iltls um(vonu0texnio oatoa r n o;t0 2urxmpoydllee ivil(fs2tax oou1tpx  ociatls ea(mp (4arxrir3oa1lpteln o ( t2toio ou1lpeelfeia(f Duaum no1alt ifcils s ua(vo t0arxnxf3ta1fa eau il(0s2trir3nu1omenlfctatf 2tm(root1teeoio3ildfm rmn p t0tlerir ty1oaDeanvs t t2ur(mpoudolt mivi s)a2ta(mpnt4aptnmiciyt mDum( p;(0texoxf oatlpD auvo s)trxr(m3nudll   fciasfa2urxrpnt0opxomoctls mDulnms;t4aetnxfcty1omt  ivs;s0 rurirpny1ol   nvtltf Dtmurpoo0alxnmoeiltfs uaumo;(4aexnmociotla   nvo;s)srto(o oydlltemfvs s srtau o;u1oexn iciadlaDraump;u4tetoio oadomte neo ()seto(o oo4ol nlnesa(fa2urumo;t0tpt ifeiltfaDel(vo ()arxnir ty1lmDe n s;()s2urim nydlpeemics t) ruau  nt0tlxn ocilsfa rlnvp;t0 rtomocoa1fp rlieo ()tetm(opnu1alenmnvsls)aDuax  ot4tlto ieild m2ulump t0 rtrmo oodfmDelneo s0srto(o3io4omeemneiasf 2rrxm nt1tpxo feiasls2elu p;u)arxnif3oy1oat  u o;t0sexmxmpiy1lltnliei s) 2rmxmono4alxo ictat a rl(mont0trerifcia1fpt aivo t) etr(rpou1lptnliciltf rtm(mpnt0optn ietyslmDrauvs () rxrir3iytfatrlnvi t  exoxopiu4omtnmnvi t)sDuaur nu1olenio3tlt m ul( o;t0altrif3todfaDrluvs t srurxmpiydole mfesa()sDrruroot0alxn iciadfm2uaumo u)artoxf ootom rluvi s)s2tmxm3nodapt mieils)artau  nt0texoiicils m2ea(vp (4arenxo3oa1oaDeli o ()t2ur(r io1openmnvil() rumurooo0aeeomfctatlm2rmums;(0tltoxf3oatlm rlueil()texr(m iydlmeemfcsl(  rrmx  no4aeto ieiatfm2eln p u4treoxfcoytfa  li o ()t2trxr oo4altnlivi t a2trx p;o1aleomoetldfmDumnvpn()alerio iytfp elnvs s0 etrirpio4lpenmfci t)aruaxronu1tex if3tadfsDeanvon(4trtoxr3io1op e ies (0sruoxmpiudol emfvias a2raxrpoo1teenmi3tldfm2umuvs u0artrxrctadfateaivo ()teuoxm iy1alte fcta()a2uaum nt4tlxn o3tldfm2uauvon(4artoir3oydlpte uvi;t0t2xm(o nudlp n fvsatfaDururoot4aeenio3tlt a2ra( ont)altrir oa1oaDr ivi;(0 euoxm oo1lp nlfesatfsDra(ront4alxomo3iytfa2el(mo;u0aexnmo oytla  luei t0 2urxr3ny4alt liviltfsrra( poo0oeeomfetas a emn pn(0tleoir ty1fmteanei s)t2umim3nu1ll  lnciat) 2raxm ot1aex  oetysfm rmnvs (0 exomo3ootlaDr ies s)trxrxm oy1llte fcsls  2rruro;u0tpeoiieiasls ranmo u4altrxf3ta1la rluvs s0 exoim ny4omen iei ()a2rru ono0opto feils m ul(vs;t4texrmfctotlmtraues ()s2xrirpoo1lmtnmfet sfs2rru onu0tpxnif3iyd a el( pnt0texoxo3iatomteau i;t)setrio3io4omenlneta( srurxmpou4ape iociysfa2rm( o t)alenxf oydlaDelueol() rtmxr ny4aleemfvt (f 2umurpot1tltomietytfaDemu o;u0 renxf oydom eaieol()s2xrxrpiy1lptelnetasfaDurx p;t1oet ii3tas sDumn snu0 ltrmr ty1fmDranvolt0seur(rpnydlm  mncs s  Dtru  nt4tleomi3ils sDuau p t0tetnmf3ty1fmD  uvil(0srtmimpiodol   fvt sfa2urxm nt4tpeoioeiysfa2rau snu4tlxrif3iadlp r ueo;(0t2tmxopno1alee net t sDtrx  ou0alx  ieiyslmDrlnvo u4altnircoo1oateaivi t) euoirpoodam   nesas)srrm( oou1tet iieildfsDrlnmo;(0 lerio3totoa rlieol(  rxm(r ny4am elnvsas a2uaurp;u1tlx ii3iys a umnmpnt4aexnio3iadoaDelnvsl( s2xmimpio1amen netatfaDuau  ou0olen fetltls em(vp (0aexrir3io1lmt aiei t  2trim3iu1altelict (f 2trxm ot0ape miciys m2ul(mp;(4artomo to1fat au o s0trumir iy1ll nlfesatf rum( oot0aetnmoeias s um(vo t4 renmrcia1lmtr i o () 2umxopiy4lmeemfeilt) 2uax p;t0ale  i3iyd a um(vpnu4tetrmo3totfat aueolt s2uo(o3nudamtnmnei (fa2rr(mont0tpe mietad s2ul(mp;u)aleomo3oydfmDranvi;(0s2umxr3ny1omt micils s2rr( onu1tpx mieildla2elums;u0aexrxf to1lm raivs s0trxoio3ny1ale  ivilt)sDta(r nu1oexn feiys sDemnvp;u4texnif3oadlm   i o (0 2xmir3nydome mfvils arurxmoot4ape  fciad s2rl( on()areoxo3to1op e uvo;() 2xrirpoy1lp nmncslt a2trxmoou0apto oeiytfs eau p;t0tltrmfcty1lmtr i sl(0s2xmiopoo1ope  ncta( aDrrur ou0aptomfciltfm ua( o u0aetnmrcta1la ean ols0s2urio3iydapee nes s a2um(rono4olen ociys mDuluvsnt0texrxr3oytomte n i t t2umxo3oy4ome mivil( srrrumpou1alxnmi3tyd s2umnmo t0 renif ootoaDr uvo s0 eto(r3oodol nlicsltf rra(mpnu0tetnmoetaslaDrl( s;u0aexnmr3oodfpDe i o;( s2to(r3iy1op n ivslt  Drr( o;t1tpe mictat s2ran pnu4trtoir oa1om raiei ()t2xmxo ou1olt mfvil() rtmxmono0oex  iciysla2umu snt4trtrmf iotfaDeaivo t)teuo(o3nydame lfei ()s2rmu pnu0oex mo3iasfs rln ont0tltoir tydfmtrln i s0 euoim3oy1llt lieiat)srtaxmpot1oetomoeiytlsDraump t)texomociydlaDrlnes t)trumxr3no1lm n fei t a2rm(rpnu4ole ifeiys m2rlnvp;()aexrmo oodlmt aneo;s0trxr(opoodaltnmiesasf 2rmumo;t0tpe  iciytla um(ms u)trtrxrcoo1fa  aneo (0t2xrxmpoudop n feiltf Drm(m ;o1openiieildfaDemn sn()trerxo oadfmD aieo;() eto(rpny1am n neiltfs2tm(rpnt1oetoifeiadfs2rl(vont4trenif to1oa r nvols trxoim oydame  fvtatfa2taur nu1tlxnmf3iytfmDumn p;t)teeomo3oy1faD lnvi;s)s2xmir3no4om elnviltfsrrrurpoo1aex  fcilsfm2ean o;u4aexnmr oo1oatr u slt  eur(m oodlpee neiltfs2trxro;o1opxn oeias aDrlums;(0trxoif3tydop elnvslt) 2urio iu4ll emiei ()aDtmxmont0alt ifctld s2ra( onu)arenmr oadfptr n il( texoxrpiudlp  mfcslsf rrm(m ou4oltnmoctld s ulumo u) exrxocta1om rlnvo;t)s2tm(mpnodlme  ivsl(f Dtaurono1open fciyd aDum( s;u) eenmr oadop eaieo s s2urxrpnodapte ivi t) Drrur oo4aetnmfeildlaDuluvp;u)tlxomrciodlp r nvi;(  rtmxr3nudamtnmnvi tfaDtaxr ;u1olx mfciydfsDelumsn(0treoir totfa eau o;s0trtoxopiodam elivs ()srtmxmo;u1oex  f3iadlsDeanmont0aeenmr tydfaD luvil( t2trim3iodolenlfes (f Dra(mo;o0aetomoeiad a2rmuvon()areomf3todlm r i i s srtoio3nu4am elneslt  2ra(m nu4opxnmi3tlt mDrlnvo;t4aetrxrcoodfatrln s (0 etm(rpou1ole  nei ()s2taumono0apt ii3tyslm2ulums t)aexomr3todlmtrlieols)srxmim3oodolee nei t)artru  ;o1aexnmfeiyslmDulu o (4areoircoo1oa  lneols) 2tmxrpio1lleemiet s aDuaurpoo4ape iociltls uauvo u)aeeoio3totfm  anvolt0t2xrxm3oy4lmt liei ( sDuau oot1oetnmfciltla um(vs;()arxnxo3tydfpDeauvs ()sexr(m iu1optelfctlt) Dua(  ot0aeenmfcils m eanvs u4alxnxf3oatlmteanes;(0trumio oo1lmt mnei sfaDra( p;o0aetn fetytls rmu p u)altomr3oatlp raues;t)s2toxopnu1lp n fei s)s2trxr ot0alx  ietytlaDrmnmo;(0artoirciydomte nes;(0 2xo(m nu1lmee nes (  rtm(mpoo0tpxnmieilslsDra( p;(0 lenmrcoadoat lnvs;(0srxrxm oy1altemfeils)s2tmur ;t1oet ifetyd mDelu s u0trtnio3tytlmDe neo s  etrxrpno4amtemnvi t  2rr(m ;u0tpe iietaslm2el(vp;()altoxrcoy1op  lneo t t2xo(o3nu1oleelnet () rur(rono4opx  ietltfs elu on(0arenmr iodomD li ils  rxoio nu4op nlfvi sf 2tmump;t4optn f3ils m2emnvs;t4 ltrxocia1la r iei;t)texoir3oy1ameelncs s  2tau pou1texo icils s em(ms t4 etrxfctodoate i ols s2tr(mpiydapeemfvtat)srta(ro;u1tlt if3tas s2uluvsnu0 rtomo3oatopt ai ilt texo(o3iudlmeelfetat)srtmxmpoo0alxn feiysls eluvp (4 lenio3oy1fmt  nei s)srum(o3no1oltn feslt s2tm(rp;o1oee mi3iytfm emn s;() eenmo3ia1fatrli ol()srxm(mpoydapee fctas s2tmu ono4tptn f3iysfmDra(mo t0arerif iy1lptranvs;t  2uoio nydame mnvt s s2um(ronu1apt ifcildfsDrmuvs (4tlxrmociotlmtran sls0 rur(m3no4optnmneils aDuau p;o0apen o3tlsls2rlu p (0teenmo oy1fateanesls  eurxo3oydam e ictltfa2raxmoou0oltoioeiaslm rl(vs;u0treoio3iydfateluei;s teuoxo iy4ame lfcilt srurur ou1tptn fciltfa rl(mont0tlxrmf iadfa eaivo s)t2toxm3oy4amenmiei sf rrmxrpou4ope io3ilsfa eanms t0 lxrif iytfpDe neo t  2tm(o io1om   fei sf rtrurp;u0tptnifetasfa rm( snt4 exrmr oydomtrlivolt0 rxo(opoy4lmeemietasfaDtmxrpou4oeto f3ildfm2ra(msnu0 ltrio ty1fmD li s;s0seto(m3ny1olenlfcs (f 2tr(rp;o4optoiicild a ra(mp;u4alermf totlm  lieolt srxm(o iy1lpt lnvtltfa2rmurpou0oex mfeiysla uan s () eeoxrctodom rai ils teto(r iudoptelivilt)s2tru ont1tleo ieildlm rmu on(4 eermr3tytopt  ivi;s0 etm(r iy4am  mivsltfaDrmxro;o1open ietldfm2raumpn(0 etnmf3ia1lmDean ol() 2trxr3ou4al  mfvs t)srrm(r nt0optn feiydfaDul(vpn(0trenxfctodfmt aiei t0truoimpoudaltemncslt arraxro;u1aptn oeiyslaDemuvp t0arenxo3to1omt  n s s  2tm(o3nodllte ivi sf 2tm( ooo0aeenii3tltfsDua( onu4artrxo3tydfm rlueo;s0 rtrir iudllenlnvsat aDurxmpou4tpxnifciltlsDea(vs u4arxoio tydfmDeau i;(0sruoxrpio4lptnlictl(fsrtau ooo1alenmiciyslaDrluvo;u4tltoif iatlpD  neolt0 exmimpnydom  lietltfa2ta(mp;o1opx moctasfs ul(vs ()alxnmf3tatfpt  ieilt0 2xoirpoy1ap elictlsfaDtrur ot1tet  ictlsfs emu o;() rerxf iy1oateaivi ( s2ur(o3iy4oleemfcsatfaDrax oou0apen i3tld aDem(vo t) lxnio3tytlpDrli i s0s2to(o3io4oltnlfvtls) rurur ou1opxo octls mDumuvs;t) rtnxf oatlat lnvi s sexrxm3nu1ap nmieia(  Dtrx o;u0oeenifcildls uluvsn(4trxoxf ia1fmt aueol()srtrxr3iudaleelfesa( a2rmum ;t4tpenmfeild s2rauvpnu) exrir tydla r ivi;()srur(m ou1llenlfvi ( s2rru pnt1alto octld sDemnmo u0aexnirciadomt  i i;s0seum(m3oo4amt mncsltf rrrxmo;u4tetn f3iysls rm(mp u) eerio3to1faD lueo s0t2umxo3io4lmtemivslt)artm(rpot0oeen oeiadfm ea( p;(0 etrir ootopDeli s;(0 rxmxm iu4amte fvi () rtmu  oo4tlen feiyt sDrl(vp (4 ltnxo ta1omt an sl(0 eumxo3iu1lpt lnci tfs2rmuront0opt  oeiad a2elnmon(0 rtrirciotoaDrau s;s0sruoir nydaleelivsas)s2rr(r oo0tlto fetltfm rm(mont0texnmo3oydfpte i s s)s2umirpiodlpe livia(fsrrax  ou4apeoifciysls2elnvsnt0aeerifctatfa elu slt s2toirpnu1opee netasf 2rmx ont4aeen ieiydfmDrm(vp u0trermrctotopteau s t)s2trxo iu1amt mieta( aDrrum nt0oexo oetas aDranms (4arxnmfciytfpDe n s;t0trur(r io4lmtnlnci s) 2ra(rpot4tpx  fcildfaDrau s (0trtnif3ootlmDe nvols0srxrio oodll nlici ()a2ta(rono0olen fciys s2uaumpnt4trxrir3iadlpt aies ()texmxr ny1ap  lncsl() rurur ou0olt ifeilt m uan p;t4tlenif3oo1op rluvol(0texr(r3oy1ale mfcsat)sDumu p;t4aexn oeiltfm2ea(mo;()teenmf iy1lmDe n i s0texrxr ny1op  lfes tfaDtrxroou0tetn icilslaDrm( onu)aleoifctydoa e i i t0t2um(o nu4lmtemnet ( s2ua(m nt1tpeniictysls2rlumo (0 leoif3ootoa  an o;s0 rumxm oy1lmee netls) Dtmxmonu1aetoiieiadfm2rm( s;t0teenio3todfat  i s;s teumxr iu4op elieias)a2trurp;o0aeeomoctysfs emuvs u4altnio oadom eaueolt0 2uoio3oo1lmte net s) 2tmxr nu4tpe  iciatfm2uanmp (4tlxrxr3oytoatr uvils)seuo(o ny1lm e ieilt  Dtmu p;o1openmoeiyt mDumu p;u4 ltoiocoadopDraues t texrirpoodam  mnesatfsrtaurpno4tleo f3iasfm2rlnvon(0texrxocoa1omtr ivo;( srto(r3ou4altelietl() Dtaur no1oeto feils mDrlu o () exomf3ta1opD auvi;s0 rum(o iy1lpen fvsl()arua(r nt0alxomfciyd m2umums;t) rxrxr oa1fm rln s (0setr(mpno1lp nmnvia( s2ta(r no4tlenmiciadfa ea( s (4aetnmo3todlaDr n i;()trurim3nu4llt lfvslsfa2rmu pnt1alenifcias aDrm(vo;u0tlxrio tydlmDeauvs;s  2xm(m3no1oltemfvia()arumum ou1olxomieiasfa2emu snu0tlxoxr3iotomtraieo s0srum(rpnudalt lfvs t  rtrx onu1aeen fetyd m2elnvpn(4tltoif3tydlaDe ues s teurirpoo4lptelneils s2urxr ot4olx moeiltla2rauvo;()alxomfcoadla rauvo s0s2to(opnudll elnvils  2uauro;u1alx mi3ild sDelnmp t0tleoxo tydoaD  ueslt) 2xrxopoodap  lnvil()a2ua(m ou4oexn f3iys mDrln s t)trtomf oatfpteaiei;() 2trimpiy1lmt mies t  2tmumonu0apxo o3iasfmDra( pnt4artomr iotlptrlnes;s t2tmxm iudam nmncsat) 2ur( p;u1openmfeiysfm2uauvp t) lenmfciatfat luvils tetoir3iydame mfvi (f rrm(mpoo0olenifeiysls rlnmp;u0texrif3ootlp rliesls  ruoxm io4alte iei s)s2ra(roou0opxomiciltfm2uln onu0arxoxrcoydfpDran i s0srtmim3iu1op emieia( a2rrxmoou1ole iociyd sDea(ms;t0 eerxo3tydfpt livi;s0trxrxo oydop e ncias s2taumoot4olxoiociadfa umnvo t4teenxr iytlmDrli o;( srxoxm3nu1omenlnvi (fa2ra( o;t0ape iiciat s elu o;u0alenifctatoat anvo s) eurir3nodlmtn net t a2um(r no0aee  feiatfsDua( sn() ltoio3iy1fmDe u il( texo(rpiudol elnvsatfsDtm( oou1olto f3ilsfa eln o u0texrmf iy1oat aues s0t2uoxmpoy1aleelfctlt a2rm(mpnt4tpeo feiydls ea(vo;u0 lxrif io1laD  uvi;t)srxoxm ou1lp  lnct ()s2ua(r oo1ale ioctyslm um(vonu)altnio tatlpteli o s sexrir no1ope livsltf Dtax p;t4tee  i3tlt mDumumsnu)aexnxr3iatfat lneo ( srxr(m ny4omtemnctltf rum(ront1oeeoiictytfm um( s u4aexoxrciadoa   iesls t2xo(opny4al  micta(fsrtrur nt1olxomfcias sDemuvonu)artomfcoo1lat aiesl( sexmxr iu1ome lici (  Draxm ot1oee mfeiltls ea( o;(0 ltrxrcty1fp e ues;t0 euoim3iodom n ivtlt) 2tr(  ;o0tpenmi3iatfm2um(vo (4altnxrcootlpDeauvi;t t2xo(o ou1lmtn ietas  rtmxmp;t1optn iciltfa emuvo (4altrxrciodop eai slt)s2xoxr3oy4al n fvs ()s2ua(  ou4apt io3tls m2uln sn(0teenxf3oatlaDrln s t trtr(o3oo1lme lfcils)sruau  ou1aptomocias m2elnvo u)alxrmo oatoa eau ol(0t2xoxr3oo4al emfeiasfa2trurp;t1apx mi3iytfs2em(mpn(0tlerxf3iy1lateai sls teuoxmpoydlme lnvsat) rra(mo;o0aeeo feiyt a2ranvo;()altoir iatoa elnvols texr(opnydolenmfvilsfsrraump;u4teenmieilsfa uln s u)aetomo oodfmDe n o;t0sexoirpiudal   iesas a2rrxm nu1olx  o3iadls2eln o;(0 rtnio3todfaDrauvs;t0t2xo(m3nudlmt  fvtas aDra( o;o1alt ioetytlmDrm(msn(4teenxf tydlaDrlnesl(  rtmxm nydom  mfet s srum(r ;u1tetnmf3iys aDul(mp;u) eerxo oodopDrlueilt)tetr(r io1ope mfeta(fsDrrurpnu1aetniietadlm elums (0alxrmrciy1lpD li olt) etr(r3io4omenmivs t)aDum( poo4olt  ictad aDumn p t0aexomfcoa1lpD luvi;s  2xr(r3iu4alenmivilt  rrr(ronu1opt ifctadla rl(ms;u) rerxrcoo1fp e i s t0t2tmim ou4lmt lieils) rtmxr nt4ope  iciatls2rmnmsnu4 rxoxo3tytoatr n s t0srtmxrpoo4optnlfvsas  ruru pno0texn oeiys aDuluvp u0areoxo3iytop elneil(0texoiopoudomeemfvta() Dtr(m nu4alt  f3iad a rmu pnt0aetnxo3ia1lpDeaivols s2trxrpiydame mnvs t)a2rax onu0aeenmfcildlm ua( ont0alxrmf oatomDr uvo;(  rxoxr iu1ol elfetlt s2rm(m ;u4oltnifctyt sDra(ms;(0aeerxo iydom eli il(  eurxm oy1oltemfes s) rumxmpou1openifetys a2em(vo;t0 exoxr todomtr u i t tetoio oudapt lietlsfaDtrxrpou1oexnif3ilt mDrmnmpn(0alenxf3todopDe n s () 2xmim oydap nlfet t)sDur(r ;u1tlxn ictadla2elnvs u0 etnir3iodfmDeanvo;s0trxo(r nu4oltnmfvs () rrmxm ot4oeen ieias aDeluvsn(0 reoxrcoodfmte ivil()trtm(rpno1lm elnvsl(faDua(  no1aptnmi3iaslm2uaumpn(0trxrxfcio1fmte i s;( sexrxr3nu1lp  livilt)sDum( p;t0apxn f3iadfaDelnms;t) etnirciodoa elieils  etoirpoo4ll elivi s)sDtmur ot4apenifetyd s2um(ms;(0tleriociatfmDrlivi;()sruoio oo1amee fetlt)s2ur(  ;t0opxnmo3iasfs2ra(mp;u4tetnxfciy1omtrai o ( tetmxr iy4amtnmicias  rrr(mp;o0aptnioeilt s2ra(vp;t0 lenxo3oytomDr nvi t0s2toxr iu4ome mics sfs2ta( pnt1aptomiciat s ul(monu4tlxomo ta1oa e u o t)t2xmimpnudopt lfesatfsDrr( o;u1tpe mfciatls2ul( o;t)alerxfctotlmDe uvo t0srtoio3oy4om  lnvtlt)s2uaur ot0opx mo3iydfs2umnvo u4artoxfciytlm  auvo;s0t2um(m3nu1oltnlnvsltfaDta(m ot4opxn iciysfm2ra( o (0arxnifctotlp  auei;s) 2tmxo io1lltnmieiasf Dtrxm ;t4apxo o3ilsfm rl(vp u0tetrmocoytopteanvo;s trtr(rpio4amtn fetl()srtauro;u0tpxnioctlsfa elu snu4texoif3oa1fmD an s (0texrxopio1apte fvtls aDtm(mpoo4oeeo fctls s ulu o (0tlxomr3oa1lp rln s;( srtoirpio1lm nmici t srtm(  nt1optoif3tltlaDranvp (4texnmfciydfaDeaivo (0t2xo(o oo4om e nciasf 2tmx  no0aexniietyt m2ea(vs;()treoxr ty1om rai i;()s2xrxr3iy1oltemfci (fa2ta( oot0aee  oetldfm2rl(vo;(4artnxocoatlp  ln i ( seumxr iudapenlnvta()aDtrxro;t0aet iociysfs ranmpnu4artrxf oa1lp rluvi (0s2xmio ny4lleemncta() 2tm(root0aexomoetld aDulu p t0aexomrciadfaDranvs;()t2xoxm nydope mieilsfs2tr( pno4oex iociaslmDemu o;u0 rxoxo3iodfpt aueo t trxriopnu4lmt  nvtlt s2tr( o;u1oeto i3iydfs rm(vs t4trxnmfcto1fpt  n i;t0 2xrxo nu4op elfcsat) 2um( p;o0opt moctldfs eau s u0trermo ia1omD  ieilt)setoxmpiy1alen feta()sruru pot1apto ocilslmDua( o;u) rtoio3iy1fmDr nvi;t0 2trxr no4lm n ncilt)srtm( o;t1tlx ioeiltfa2rmnmp;t4tetoxfcoy1opDelnei;t0teto(m io1lmtnlnciat) 2ur(m ou4tpxnifeiydlm2eanmo u4tlxriociotlateluvo;t  exoxr3iu1lpen fvias  rumur ;o0tlenmfciatls2ean o;t)trxnirciotlptrlueslt)t2tm(mpiydlmte fvs ( s2tr(rpnu0alt mf3iys s2elnvp;(0tlerxr3tadlpt lu s s0t2xoio3oo1lltnlnesat a2tauront1tltn i3tls m ua( p t0 eenio iodoa e neslt trurxm ny1opt lfvi s s2tmx  ;t1aeeoioeiatfsDrm(vpnu)aeerif3oatfmDranvsl(0t2tmio no1am emnetatfarua(r oo4oex  o3iytlm2rl(ms u)tlxnxf oytlmD livil(0 eum(opno1lltemictls) 2ra(  ou4ale  feiyt m2rlnmp u0trtoifcoa1laD auvils  rurim3nydopen fet t) rurum oo4oee  f3iysfa rmnmon(0arxnxoctadoa e nes ()trxmiopno4lpt mfctl()aDuaum no1tlxn i3tlsls ea( s t) lerir ia1op   neslt trurim nudlm  mfeta(fs2rmx pou4opto ocilsfa2eanmp;(4alxnif ta1lptr nvi;s trurxo3oudllt mfcsas)s2tmumpno1oee ioeiytfmDea( s ()texnmr3tytfm   neo (0trxrxopnu1am nlnvilt)a2ra(r ;o0alxnioeiys m um( s;(4texnmf3oa1fp rluvol()trtm(r iudomenlfvsat s2um( onu1tlx mo3ild a2rl(vsnu0artnxr tadfaDeanvo;(0 rtr(m ou1opt mfcta(f Dtm(mp;t4oee mietat s2emuvo (4tetrxo oo1lm  lueo t0texoxmpio4op e ncia(fsDrrumonu1olxnmieild s ulumont4trxrxf3ia1oa  lieols sexoxr oydomtnlnvslsf Duaxmpot1apxoio3tldlsDrl(mpn(0tltomfcoadfpD livo ( teurxrpiydll e ncslt aDtr(  nu0apxnmociydfm ean on(0aetnmf io1op elieil( sexoxr3nu4omte netl(fsDumxmp;u1ope mi3tadls2ua( snu0aetrio io1op   iei;t texr(o3no4ale mfvsatf 2rmur ;u1olxomfctls s umn sn()altoio3iotlm e nvslt0 rurim3nu1lpt lfciltfa2raur ou4opx ifctysfa rl(vpnt4arxomr oydfp ranvo;t)srxo(m3nydomtnlnesl()s2tru o;o4tlxo ocils a2umnms u4trxnif3ta1fm rau s s)trxrxmpno1ope  ivt ()arrrx  ;o0aexoifctldls elnmpnt0 etomo3todfm eli s s0 2umxo iy1olenlici t) Dtrxm nt1tptnioctlsla2ua(mo;t) rxoiocta1fpD an o t0seuoiopny1lpeemieias sruaum ;o4tlenmo3ilslsDumnvo;t)alxomf3tadoa elnvslt s2urxrpnudlmeelnctatfsDtaum ;o4oex iicild aDuau pn(0tetomoctodopt aneo t0 etoio ny4ol  mictl(fsDumu  ;t1aeto ieiytfa2raumsnu4 lenif todfmtr nvsl( sexrir io1aptnmfvta()a2ua(ro;t0tpen ociysla2ul( s;t4texnio3oatfaD lieo s0s2xoxm oy1amenmnes ()a2rrx pno0oleomf3iasfs rm( p ()altnxociytfa  livi () exoxo ou4op   fetl( srrrxmpnt0tpeo f3tatfs emnvon(4trenif ia1oaDelnesl(  rtr(o3oodome  fetls)s2ua(m ;o4alenif3tas a2rau ont4aexomocoadlp eluvilt)trtr(m iydom emnvil(fsrtm(mo;t1aex mieiad s rlu s u4alenio tadoa e nvi (0sexoxo oy4ale mfcia(fsrumu onu0aleomicilt aDrl(msnu4trermf iydopDrlieil(0srtr(o3oo1ap  livs sf Dtmurpnt0tpxomietat m2eaums u0aeermr ootoptran ol( seto(m ou4amenlfvs (  ruaumpno0alt iocias m ea(vs t0trxoir3iy1lm e nvsl(0s2tmxopio1altelfetltfsrtrx pou4aleoif3iasls elnvpn()areoifcoydop rlieslt0t2to(r oo4lmtemnvt (fa2ur(m ;o0opeomo3tldls ea( p ()alxoifcio1fmt lneol()s2tmxo oy1lm nlietl( a2rrumono4aet mfeilsla eaumpnt4arxrio3oytfpteanes;s setmxo3nu1lm  mneias  rrmumpnt0tlx iociytfaDulnvon(4aexnxo3oytopDr nvi t)teum(m nu1lmt  fet ()arrrx o;o1oltnmf3tat a ul( o t)artomo3iodop raies s t2urxmpny4amtelneta(farumxr ou1tee  fciydfa ean p;(0aetrir oatom elnvi;()s2ur(rpiu1lpe  fvil(f Dtm(m no4opt mo3iyd s ra( o u0 exoxo3iotoa r nvs;s0teumio iodopt mieias  rtau onu0aeeoifetys m elnmsnt) rxnmrcty1fpt aies ( trurxr3iu1om nlncil(f Dtmx  no4oet  iciysfs2rauvsnt) rxnmo oytlpt  u o s0 rxr(opiy1lltn ivta() Duaxmoot0aeeo ociydfsDemumpnu4tetrif tadoate ueslt0trumxopiu1lp  mfcs (faDtr(rp;u4oleo iciytlm2eau o (0tlxrmfciodlp eluesl( t2uoxr3io4amtnlfcs (f rrrurooo1aexn ocils m2rmn s;t)teeoxfcoytlm elu ols0s2xmxr oy1oleemfvsat)a2ua(moou1oexniociasls um( p u4 reniociydfptran o;t0t2tr(m3iu4lm elivilt sDrmu pnt0opx  fcilsfsDemumpn(4texnmr iydfaDe u o;t0 exrxrpiy4optemietat aDra(rono0altoii3iltfs rlnms t)trxomf oodfpDe i ols s2uoxm3oudopee fcsls) Duru  ;t4ope ioctlsfsDumuvont0aexoxr oytfmDr neo;( t2trxm3io1lp elncsltfsrtrxm ou0tptomocild m2rlums (0aeeoif iodlpDeai o s0 rxmxr oodlpt lfvt s aDtmum nu4teenmfetadls umums;()aexomo iodomD aivi;t0s2to(r oudam elfcs s) 2rrumooo1teeomoeiys s2emump t)arxrifciotlm ranvs t) 2xmxrpnudolt  fvil(f 2taur ;u0oee mociasfa2elums;u0texoir3todlmDrli s;( trurim3ou1olen fesa() 2tmumpot1aeenif3ilslm2rmuvont) eenio3to1fat  neol( teumir nodome  nviasfa2rmurpnt1tetn iciyslsDrluvonu4arxomrctytomte iei;(0trxmxrpoudapenmncta(farur(r ot4alto iciysla2ulu o;t)teermf3iadlpt  uvi;()srxo(m3iydal n iei tfsrum( pnu4apeomoeiasfa2elnms ()aexnirctodlmte ueil( trxoim3ny1openlfvsas) rtmxmoot4oleoioctldfs2eluvp t0tlxomr totfp  aueil(0 exriopou4apt lnvtat)sruru p;o4oex  oeiaslsDulumpnt0aexnxocto1opteaieols  rtr(o ny1lp n fctltfsDuaxmpno1aexn oeiysla emnmon(4areomf io1optrauvi;()t2toxm nydoltn ietas sDrrxmo;t4opxn i3tys m rlnvo u)trxrxo ootlptrai o;( s2uoxrpnu1lpeelncils) Dtmxr no0opxoiietls sDumuvpnt) rtnmociatlmDrauei (0trxr(rpno4lp nmnviltfsDrm(ronu0opxoiieilsla2um(ms ()arenxf ty1la rlueo (0 rtr(rpoy1op nlfctat)aruaurooo1oltnifeiadls rl(mo u0tlxnxoctotlmt aivs;t0trtmxr iydaltn fctlsfs2taxroot0apxnioetls s uau s;(0tetnmf oa1fatranvsl(0t2xm(r oo1op  lfci ()a2umxmp;o4tpenifctysfs2um(vsn(4 ltrmfcoatom eaieols trtr(mpoodomtelfcs t  rtmxr nu4opxomfctyt s2el( s t0aeerxf todlpt luvi t0srurio oydoltnmfesasfsrurxmooo4teeo oeiys s2eanvs;u4trenifcia1opt lnvo;t)s2uoimpoy1altelivs ()a2rmx  oo1tptomictytfs rmnmo;(0tetrif to1fmtrlies () eumim nudop   nvi s sDumu pno4tlx  ieiysls ea(vpnu0aleomo3oadfmDeluei s texmirpiodomtnlfci t) rta(ro;t4oexoif3ils s ul(vsnt0aeerio3iotoa raueo (0 rxmxo3iy4ap   fetls sDta(mo;t0olxniieiltlm2rmu on(0arermocia1oaD lu s;s trxrxm iydopenmnvtasf Dta(rpnt0tex mocilt s2rlu o u0trxoifcta1fp eanesls0truo(opoo1ll e nei sfsDrrxr nt1ale mfcils mDel(mo u4 lenmo3ia1lm r n o (0 rxr(m3nudlptnmncta( aDtr(r ;u4aex  fetadfs rl( p;t4 lxoxf iodfaDeluvo t)seurxr ny4ap emies s arua(rono4oet  iciaslaDea( s;t) eerir3iatfp  lu s;t0t2urxr nudll n ictat)srtm( p;o1optomi3tytfaDuaumsn(4 exrmr3io1omD lues s) eurir ny4al nlfeilt  rurumpno1tpenmfeiltfm2um(msnt0trermrctadlmDraneil(0 2uoxr3nu1omtnlfcs s) Drm(m no4aee mocils m ua(mp;u0tetnxrciadlptr u s;s  etmxr iu4ol   nesl( arraxmonu0teenioeiatfsDrln sn(4 rtnxr tadlmDelieolt s2ur(rpiy4om emfetas)srurx pno4alxo iciysfa ulu pnt4 etomf oodlm  au i s0 exoimpiu4ape lneia()arur( poo0oexoiieiatfa rl( o;u4 renif3tatfmDranvs;(  etmxopny4altnmnesat srtmurpnt1tlenmo3tysls umn p u4teeomo3to1la r nvilt  exoxopiodlmenlnciat)aruaxmpou1openiicild sDum( pnt4tlxoif iydfm elnvs (0 2tm(o3oy1amtelfctas)srtr(rpnu0oleniociat mDul(vpnu0arenmfcoo1omt livil()srtr(mpiodlmenlicil( a2rrur oo4oeenioeildfsDrmn p (0arxnmo3todfaDe u s t tetoimpou4lmtn nvs sfa2um( poo1openioeilsla emums (4 lxnmrcta1fat aieo (0trto(o3no1lm  lncsa() 2rm( ono1teenmi3iasfs2el(mpnt4 rtoir todlmt ai o;(0s2tmxopnodap n fvilt s2trum ;u1tltomociad m2ran p;(4arenmfciotla elnvs;(0teurir3oo1ame lfctlt  rtm(mp;t0texn feiatfm ua(vo;t)aetrxocoo1oa eaieo;s0seurir3nodom   ivsa()a2rax o;o1opeoii3iatls uau s u4teenmrcoy1lpDranes (0setmimpio4amenmici s)s2ururo;o0tpe if3iys sDua(vsnt0tlerif oy1optraivi;s)trxmxo3oo1ameelfetat) Drr(r ot0oeeomoeiasfmDua(mpnu0 reomf3ootlmtrlivo (  2trxm3iodlmte ivt t  2trum nt0teeo ieiadlm2ulnmo u4alenmocta1om eli i;s  2xoio ou4oltemicsa(f Dra(ro;t0alto ictadla2uanmp (4 rxrxrcty1fpDr nes () 2urir3iy4lpenlivsa( sDrmxmo;t1tptn o3iadlaDuauvs u0altrmo3ia1lptrai sl( t2um(m3iodapt  nvsatfaDtm(mpot1opx mfctyd mDulnmpn(4 etoir3tadfaD luvs ()texr(r3oo1al n nvs t artr(r nt4opxoio3ildfsDuan pnu)aexnxo3iytfmt  n s ()s2xoxopoudoptnmieia(fa2tm(rpno1tpeomietatfm rmu s t) rtnxr3iodfa eluvi (0 rtr(rpoo1lle mieslt a2tmurp;t1opt  ociat a ulu o;u) eenifctadlmDrlueo s)srxr(o ny1am elietas)s2rrum oo1tltn fctyt a2eauvo u4tetrxo3oa1op r uvo t) exoxrpoy1olt lfcta(faDtmum no4aptomfciltfa2rau snt4trxoxf3oatfaD aivi;( teur(opou4opt  ietl() 2rmxmpou4aee  ieiys aDrlnmp;(0arxrmfctatopDeaueo ()s2to(o no1am e ieil()a2rmxm ou1apxoiictldlmDumums ()arxomo
\ No newline at end of file
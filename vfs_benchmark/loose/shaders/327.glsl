@@ -0,0 +1 @@
+ivo t)texrimpou1omee nes t  rraumooo4tetnio3iydfm umnvs t4altoif to1opt  u i;( srxmxr iy1lpeelietas)a2ur(m ;t4oex  f3iyd mDrl(mo (0 leoir oatlpDeau s s srtoxmpnu4am emfeslt)sDtrxrpnt4opx mociyd s2rmnmp;(0texoif tadoa   ues s0teuoir3iu4lpt  nctltfa2urur ;t4optoiietas m2rmu p (0tlxoif ia1lpteaivo t0t2umxr3iy4lltemieias  Dtm(mpou4aee mo3tls m2ua(vo t0 etnmfcty1fpte neo;()seuoim ny1ole mfvs (fsruaum ;t1alxnmoctls m2el(mo;u4 lxrxfcio1lm elieol(  2xm(rpnydop  mieilsfsDtmum ou1aeeniocilsfa2elnmont)tlxnxfctatom   n i;() euo(r ny4lm n ics t)a2ua(mont0opeomf3iyd m2ulums;t0aexrif iadfp eau ilt)trum(r oo4llt  nci (  Dtrur ;t0tpe miciys aDulumo ()altnxo oatlmt ai o t seum(o3ou1am   ivil(  Drrumpot0aetomfctls aDea(monu0 lxrxf3todfm eli ilt)s2um(mpnydoleemfcsltf ruru pou4opt mi3ildla2em(ms t)tetomo iy1lmte ivo s) 2trxopoydlpeemncs s) Drr(m ou0tptoiietas sDrlu p u0 renirciatfmtean ols0 eur(r oy4opt mivsltfsDtru pnu0olto ieiatlaDrm( o;t0 lxoio3tadomtrli il(0trtrim3oy1amtnlicsat)arum( pot4tlxn ietlt m2um(mpnu0 ltriocty1lpt aivs;s  rtrxmpny1oltnmfvslt) 2taxro;t0tptniicilt a ulnvo t0tlermrctatoa eanvs;(0texmimpoy4omee ivilsf rraxr ;o4tpe iietlsfaDeau pnu4 ltoxf oy1latran o;( s2xr(mpiy1ll  lneils)aDtaxr oo1alt iieildlm rm(mo t) rxomo3iodlpDrai s t)s2trxopoydlp   feil(faDtaumo;t0oeenmoeiasls rmums;()alenxo todlaDrai o;( t2xrio oudam elietatfa2trur nu0tex mi3tlt m umu on(0tlxrmo iy1fa  livil(0teurxmpiudol nlfct (f rrax pot0oleomoeiys s ranmsn(0 lxrir oo1opDrauvs (0trxoxr oo1ol nlfci s arrmur ;u1alxoifeiyslm uanvp u4trxrircoadfm rlu s (0 euoxr ou4lmeemnvta(f Drruro;t0tlx mo3iaslsDulumsn(0texnxocta1fptrlieo;( s2tmxm oo4llen fct ( s2tr(r ;u1alenioeiasfa2eanvonu0 renmrciadfaDr u i t0srur(r3ny1opee fvia()artrum ot1tlxniieiyd m rmnmp (4tlxomr3iy1lm  lneol()texoxr3io1llee fcs tfaDumxrp;u0olt mf3tltlmDum( o;u4 etnif oatopDr nvo;s) rtoim3io4omenmies (fsDta(ront0olenmoctasfa ea(mp;(0texrio ia1fmD ai s;()srumxopnudaltnmnvtasf rtmurono0aleomoeiaslaDuanvp t0 rtnxr ta1om raues ()t2xr(m3nydal emncslt)sDtrxrpnu1tlx  ocild mDrl(vp (0arerxo tydoa eli o s texrxo3io4amtnlfcia( aDrrx ont0olxn o3iadfsDuaums;u0aexrif iatfpt  u o;(0srumirpnodamtemneil( sDuaxr ;u1ope  fciyd a eln pn(4 lxrioctydoa   neils)s2um(o3io1lltelfei (  rum(mpou1apx mi3iydfa2uau o;u0aeeoircty1laDe uvi s0srumxopnudom n fvi ()sDuaxr no1tlxn o3ils s2ranvp;(4alerirciodlpt ln i;s0trur(m3nodomenlnctas)a2ur(mpou1apxnii3ildfaDel(vs t)trtomf oadfpDeaivo t0teur(m iu4omtemfetlt) Dtaxr ou0tpe ifcils aDrm(vp;t0 lxrxrctytlpDr ieo s)t2xo(opoudllenmnvsasf Drm(ronu4olxo iciatfaDum(vo;(0aetrio3tadomtelivi s)setmxrpiodam e fvi ()sDumuront1teto oeildla2ulnvp;(4 eerxr iy1lmD  nvi ( srtmimpnydlp elieils srrrumoot4openmfetas a ulnvon(0arxrmrciy1la  ai i ()teuoim3ny1alenmfvi t)aDtmxroot1apxo feiadfs umu o t0 etomf tatopD an sls0t2tr(m3nu4ole  ncs s) Dtrxr ;o0tlx  ocils mDeaums;u0aetnxr iatfp eaues t  2xrxr oydol e nes t) rrmx onu0tex  o3iysfm2ua(msn()trxrir tytlm rluvi;t) 2xm(opio4am nlnvt tfsruaumo;u0aeto o3tasfs ea(vo;t0aeeomr3oodlm e nvi;s0 eumxopoydomtnlnvt tf 2uau  no1oeto i3tyd mDeanvs (0 reniocty1faD livo;t0t2tmiopnodamenlnvi s aDur(r nu4optoii3iltfa uauvpnt4alxrmfciodfptrau s;s) exo(r3oy4omtnmivtl( artmu p;t4optn feiadla emu s u0tltrif totfaDe u ilt0s2xrirpny1lp nmictasfa2ur(  nu0aet  ieilsfm2rln pn()altomrcia1lmDr n s s  etoirpnu1lptn iciatf 2urur ou1ale  ictatfaDra( pn()tlxnio to1la rluvs;s teum(mpiy4lp  livil()s2umur ;o4oee  ictltfm uanvsn(0alxoio3iodoaDranvo ( srtoxr oy1ap  mies s aDraxm ;t1ope  feiat m2rmn onu)texrxo3ty1op r ivo;t srurio3ny1omeelictls aDtm(mp;t1tetomo3ias a2uluvonu)aeerir3oadlaDe nes (0 rto(r oodlmtelicsl(  rtm(rpoo1ope mf3ilslm2rmuvo u0 renif3oa1oaDeauei;t0s2tmxo3oy4ame  feslt  2ta(rpou0aeenmf3tytfs rlnvp;(4trxoircoa1lp  lies (0t2urxmpoy1lp  mivs s) 2um(  nu1oex  f3iat m2ul( p u0alxrmr3iodlm rluvil()s2tmxo nu4ameemietas  rua(ro;u0aeeomf3iad a elu pn(0 etrir3oy1faDelnei t) rxm(m ny4alt  ictltfartmur ou0tet  oetadfsDranmo;(0texnmocoy1lat  uei;( s2xmxm oy1amen nctasf rua( pnu4opxo feiat aDea(vs u4alerif3tytlpte ivsls0srxrxm iudlpee nvta()srrrxmont4oetn o3tldlmDeluvp;(4trxnxf iy1oat auvs (  rtrxm nydal elfvsa( artmx pou0teeoiictad s rmnvpnu)aleoio iadlpteaieil(0t2uoxr iy1omtnlfesatfarurump;t1tlxnii3tytfaDuln onu0 rerif3oadomDrlnvo (  eumio iydapeemnvslt  2uaum nu1olxn octyd mDrl(vp;(0tltrmfciy1op e i il( setm(rpoo4ale mfvias  Dtrxroot0alto fetldfaDrauvpn(4 eerifcty1om e ieo;(  2trxr oydam elfcilsfsDtmxmpot1tetn ociysls um( onu)tetniocoadfmt ln o;( t2xrio oy4amt  nvia() ruaxmono4altomoeiytlsDrlu sn()trtnifctotlm  au ils  rtr(o iu4lm elnviat  2tax  nu4tpe mociytlsDeaumsnu)alerxrcio1fp rluvo;s0s2xriopno4op eliei tf rrru p;t4apx iictlsfm2emnmon()aexoir ia1fa rlnvi;s  exrirpno1ol elfeil( s2rmxrooo0aptoioctyt aDua( on(0artnirciotlp rai o (  rtrir io1lme mnci ( artmxmpoo4olto oeildfm2ran snu0 rxrxo3ia1fp e ieo;s trurxr3nodaltelfcias) Dta( oot4olx moetytlaDrm( s u0trxoxociadopteai ils)texoxo3ou4alt lfci (fsDrrum ;t0tlxoiociadls eau onu4aleomrcia1fmDeaiei;()trurxmpiu4lm emneiat a2taxr ;t4oltnmietad m2uaumpn(0tetomr tydoa rai s s s2xm(mpiu4ap   fesa( srtmxm ot1aetoiietat sDelu pnu)altomf ty1lpDr u i s) etm(r io4lpe  fcil( a2rrxr ;u1aeeoifcilt sDranmo;t4teenxo oydlptrlnvols0truoxm oy4alt micilt)srra(m ot0opxn fctys mDrluvsnu0 lxrmf3oatfatrli o s  eurxo iu1openmfeils)aDtrur no1tpt ifetld a rmuvonu0trtrxrcoytfm ran o;t0trtm(r oo4omtnlnviat)artrum ;o1apenmfetys s2rl( s (0 rermr oatopteauvo (0tetmxrpoo4omenlfvtatf Dtaxm ou0tlto i3iyt aDemuvp u4 lermrciy1fm  auvi s  etmir oy4ol emnvi s  2tmxront0ole ifctad m umnmp ()aexnxf iy1fpte nvs t seuo(opiu4apenlnvtls  rrrxmpoo0olxn ictldfmDel(von(0 eeoxf3tytlat auvslt)sexmim3iudaltn icta(fsrua( o;u4altnifciytfa2emuvp t)trtrxf oy1fmte iei ( t2xrxrpoy4ale lnvtls) Dumx pou0oleomoeiytlsDemuvo;u)aetoxo tydomD  ivs () 2toxrpiu4olenlfvsls)s2trurooo1opt mfciydls2em(von(4 rtnxf3iadlptean ilt)sruo(r nu1omenlnesl()s2ur(ro;o4tle mi3tadla2rauvo t4 etrxr3oo1opD auvi s) rtm(mpiudomenlnvs (fsrrmxmono1aee  i3tydls uln snu0teenxr todfate ivs s  2toxr3oy4al  mfciat arua( onu0tpenifciysfa2ean snu)altoifciatfpD livs;t  2xr(r iu1omtnlietlt)aDurxront0tlt iieildla2eanvp ()aetnxociytla  lneo;(0texrxo3iodomtnmnvilt srrmur ot4tlxo oetldfa2ulnvont0 eenif oodfatraivi ( t2xmim3io1lpeemnesa()artau  ot4tpxn ieildfsDuanms t)tetoio3tytlaDrlueo;s texmir no4apee icia()s2taur nu4oltn f3iatfmDra(vonu4alxrxoctytfm raivilt)teum(o iudop elnet t)a2tax o;t0tpenio3tld sDrl(vs;(4aeenmr3oy1fmt lu i s0 2xoxr oo4oltemictlsf 2tm(  no1altnio3ildfs ra(vonu4 ltrir oodopD  ieo s)s2ur(r3oy4altemfvil(  2rmx  ot1optnifetadlaDelnmon(0aeermr ia1opD  i s;t0srtmirpoy4ame lfet sf 2um(rp;t4tlxoifciatls2umnvpn(0 rtnifcoytfaD aivilt0 rumiopiy1op nmneta()sDrrxr no4tpx mfeildfm2um( onu0 ltoirciodfm rli ols)s2xrir3iu1oltemietl(f Dur(rpno0opxomfcils m rau pnu4 exrir3iadlateai o;t0 rtmir3iu4lle mnvsas a2rr(rp;t4tet io3iysls2uauvsnu4teeoxr3tatlatelnvsls  2umxopou4lp nmfvias srua(ronu0oleomfctytfa2umu p;t4artnxrcoatomD ln o;(  eum(o3iudapeemici t srraxroou1oex  ietld sDrl(mp;t)teerif ia1fpt lies;()t2toimpnydameemictlt) 2trum ;t1texoiieilsfm ulums t0altrmr tydlptr u sls0setr(r3nydopenmivilt) rtau oot1oltomoctytlsDrln pnt0 exrxr oodlpt anvi;s0s2uoirpno4opeemict (fsrrrxrpno4alxo feiatlm ua(mp;t)treomf3iatfpDrlnvo (0srtm(rpiydamt  ivsl() rtrxro;u4opxoiietlslmDua(monu0 rxrirctatfmteau ils)trum(m3iy1lm n fetat s2rmu  nu0apt moctyd m rlnms;u4 etnmo3oytfpDr ivo ()srum(r oy1ope mies t)s2rmxrpno4apt  oeils s eauvs (0arxrxociytlm eaivil(0tetoirpio1am nlies ( s2tr( pnt1apenmietlt a rau s;(4 renxr3tydom eli ol(  2ur(m ny1alen neia(fsDra(mpou4aet ii3iysfa um( pnt0aexnioctadfmD au i (0texmxrpnydome  fviatfa2rru p;t0olxnmfeiysfm ulumpn()aetrio tytom  lnvolt t2umirpoodlm  lfctat)srtm( o;t1ole mfctldlaDuauvpn(0arenxfcta1opDrauvol( srtoim3nudam nlnesasfsrum( pot0ape mfeiysfs2ran on() exrmo3oa1fpt aneilt0 2umim3iu4omtnlicsl()a2umx  ;o1altn o3iys m emnvo;u0aeerxo3iotlm  aieo t seur(r3ny1amee ncsltfa2ra(rp;o1olxn feilsfa2ua(ms;t) ltnxfcoadlmDe i ols0 2toxm oydoleelfeia(  rrmxronu0apenmictlslsDrl(mp (4 ltnxf3tatoa rlivils0t2umxo3no1ale  fvsltfa2rmx  ou1optnmfeiysla2ua(vs;u0 renxr ia1lp  an o t) etoir3iu4oleemivsl(fa2umxm oo4tltoiictytlmDua( o;(0areomfcoodfpD  uvsl(0 etr(r3nu1ll   fvsl()srtmumpno0olt  ietad s rm(vp;t0 rtnio tydlmD anvs s)sexrxm3nu4lmt  fetat s2rmxr nu1oex ifctat m2eanvs t)aeeoio3iatfmDr i slt)teur(r no4ape lfctl( arra(  ;t4oee  o3iys mDua( pnu)alerxo3iadoa  aueo s trum(m3iudopee nei tfaDrruroou0tlt ioctydfm rlumo;(0 etrir tytfatelu o ()sruoxmpnu4amenmfvt (  rtau  ;u1tlenmoeiysfs2elnvsn() reoirctodlm  aivs ()t2umxm oo4amtn nctltfa2trum no0altnio3iysfa ea(mo;u)aeenmoctotlptr u i;t)srxoimpnu4lpt lnvtltfs2trur nt4oltn oeildlsDel(vp () lxrxf iytlp rlneslt0t2xoir oodol   ictls  Durx  oo4aleo fciatfaDulu o t) lxrmo3oa1fmtr uvi;t srxoiopoydope mfvi s srta(monu1olt mfciysfaDea(ms;u0aeerxocoytfpDrluvs;t s2umxopiu1ope  ivtas  rra(m nt4oexoii3ild s em( ont0 eeomr iytlaDrlueo s0srxmim3nydam   ivsas  2rrxmoot1olx iociatlaDumuvp t4tlxoircty1lpt ai ils0t2toxr3nu4lmt lnvs ( aDum(r ;t1olt  o3ildlm2rl(mo t0arxnxf3iotlm rln s t0 2toim oo4ope lfcil()arra(m ;u0tlx  ieiydfm umumon(0 renmf3iodfpt anvs s trurim3nydlpe  fviatf rrmxrp;u0oeen f3ils sDul(mp;u4alerircoytfmDeanvi;( teuo(r iudol elnesltfsruax onu0tltomo3tytlaDrl(vpnu) eerircoadlm   n s;s  2ur(opiydaleelfct s srtaxmpnu0opxniiciat sDumump;u4trxrmfcto1opDrai s;t)srtrxo ou4apte fcilsf rtm(mp;u0tpx ii3iadfaDrmump (4 lermocoytom e ueols)srxrxm3iu1op emfvilt)srua(  ou0aexnif3ias a2raumont4aexnxf oodfm  livs;s0 ruoiopiy1amt lnvs t)srrrumonu0altnmictytfm rauvpnu0aleoxo oo1omDe ueils)texo(o ny4altnmfeilt aDua(mpno1opxnmiciat aDelnmo;u) rxrifcoa1lm  lieo (  2tmxm3iu1ale lici ()s2ra(r ou4tpxnii3iytfs2em( pn(0tlxrxo3totfa r uvol() rtmio oy4ol e ictas)srrmu  ou1olx  fciltls2eluvpn(0artoxr oydlmt  ueols) rurxm oydaltemfesl(f ruaxmpou4apxnmf3iys m2el( p (4alenxf3iadlm rln ils0 rtmxmpiy1al nlicsltf 2umxmono0tlenmoeiatfa ean s u)aeermo oo1omt  ivs;s0 2urimpoydolenmnvta(fsDra(rpou1aet moeiysfmDuan p;(0 lxnio3iotlmt aieols)s2tmimpiy4aptn nvsl(fsDumxmp;o1oleomictld aDua( ont4 ltomr3iodfaD ln ils s2trxrpoy4lme  ieiasfsDuau o;o1alt mieiydls eluvp u0aexnir oydomDr ueo;s trtr(m nydomtnmfctl()artmx ont0tpxnioeiyslsDemuvp t)aexnmf iotlpDeau s s)sexmxm oo4lpee fci t s2um( onu0oltnifctyt m rmumo (0 rxrmo oadopD  ieolt) etmirpio1ape  ncta(fa2trxmp;u1aetoifctydfmDum(vonu) reoxrciadlmDeaieo;()seur(o oy4altnmieils aDrmxmp;u1tptnifciltla2emnms t4aeeomr3oatlm   n slt srumxmpoudaltelnct sfarrauronu0aexoio3iadls ea(ms;()altoxr oo1la r ivs;t) exoir nodll n fetat a2tm( p;t4apxnifeiydla2rmnmpn(4 leniocoa1fp rlnes;t)trxmxr nodapeelnci s a2taxm ou1aptn ocilsfmDemu pnt)aexrmo tytlpDelnvsls0seuoxo3oudlptnmneils aDtmumo;t0aptoioctyt a um( o;()aexrmr3iadfaDeaueo;s0trxm(o3oo4alte nctasfa2rrumpnt4aeeo oeiatfaDrl(vs (4 rxnmo3todopDe nei;(  rxmiopou4ll n nvi t sDum(ro;o4altnmietytls raumpnu4alxnmrcoydfatraivils0sexoim3oudlleelieiasfsDua(m oo0ale iociysfm rln p u)tltnmo3oy1opt livi;s0trum(m3oo1amenlfesl( s2ua(m oo4oleoifctatlm2umu p t)alxoir oadoat  ieo;t srxm(m3iy4olt mietlt  Drr(  nu0aetn ieiatlm2rmums;t)aetrmoctydlpD ln o (0 2xmir no4ole  fetls a2urx oou1aet  octydls2umnms t0 lxrio3to1oa  livo;s)s2toimpoodap e fes tfsDrrx  oo1tpto octlt aDelnmsn(4tlxoiociadfpDe ues;s)t2xo(rpoy1am  livsasf rrr(m ;o0oetoiiciyd m2em(ms;(4arenmf3tydomDeli i;( trumio3io4apeelncs (fsrrm(ro;t1apeniocilslsDum( snt4trxrmrctadlptraneol(  exo(r3io1lp   nvi (fs2rrxr nu0ole  o3iytfa uln p;u)trtoxo3oydlat  i ils  2urir3ny1olt  fesat) 2uaur ;u0olxnmo3tas sDeln pnu)arxomo3oadoa raiei;t0setrir3oudol e fetl() rum(rpoo1tpt  feild sDrmumpn(4 ltnxocoadomte ues t) rto(r iy4ope  nesatfartaxmo;u1apxoiociaslsDemnvpnu4tlxnxo3oadoptrlneslt s2xoxo iudlmtnmfvi t  rrru pno1apxomfctyd s umu o (4tltnif totfpD luvol()s2xo(r3oo1ap e ivtlt  rrau  ot0aeeo ociyt a rl(vpnt)artrir3to1opDeaieo;s srxo(o3iy4ol n fvils) Durumooo1oltoiieiadlsDelnvs (4 rxnmo3oy1fptrluesl()truriopoudamtemiet ()a2rr( pno1tpxn f3iatls rau o u4aexnifcoydlmDelues (0 eum(mpoydlpenlfctasfsrua(m ;u0oet  ictltlm2ul( onu0 lerxfcootfp eaieol() eurxo nydlmt lncs s arra(mpot1tpeoifeiasfsDelnvonu) rerifcoydopt  nesl(  rxrio oo1lpte ietat)s2rmx poo0tetomietadfa rmnms t0altnxfcio1lmteaivo;s  rtr(rpoydlmee nvtat)s2raurpno0aeenii3iltls ea( onu0 renmo oodlat livo;()seuoxo oudlltn nes (faDrru oot4tlxo feiadfmDem( p u0texrircoadlmt aivo;s0t2xrir iudlltn fviat sDta(r ;o0opt mf3tytfm2rluvo (0 exnmocia1opDranes;(0sexoimpoo4opee nciatfa2rmxm ;t0tpeomoctas a rm( o;(0tlenxf tadlm eauei;t0sexo(m3nu4ole mics (fsruaxrpnu4aeeo fetlslmDel(vp;u4altrxfcoydlm raiei;(  ruo(o3nydaleelnvs s s2urum ;t1oltnmo3iytls2eauvp u4 ltrir iodlm   uvi;() 2uoiopio4amt  fet t aDrrxmo;t4apxn ociydfm rl(vo;t)aeeomo3totlp   neslt0srtm(m oudll nmfctl( s2rrumpot4aee ioeias s ul(mp;u0alxoif3to1fatrlnvs t0t2uo(r3no4lmen nvi s)aDra( p;o1opto o3ias mDrluvsn()arenif3ta1fp eau ils0 etoim oydlptn nvils s2tr( p;t4tptn iciat m ranms;u0trtoxo tadfptrauvo (  exriopiydlltemfeils s2trxm oo0oet mo3tlslmDea(mo t0trtrxociydomD  ues;(  etoxm3oydlp e fciat  Drrxrp;u4tetn f3iltfm2eln o u)texoifciodla elieo t0 2tm(o3no1aleelietl( sDrmump;t4ole  oetldfa2um( pnu4 rtrxrcoadlp eln i;t0s2toxo iodal emieil( sDrmuroou4apx ifciadlmDulums;t0 lxoif iatfm eli i s0 rxr(rpiodlptnlietlt)srua(m ou0tex  o3iyslaDemu s;t)trtoio3ta1fate n il(0s2umir3oo1altemfvtat  Dtr( pno0tpxoio3iad sDrl(vp;u4tlxrmf3iodopDeaivs;s0trtoim3io1lltnliet s) Dtm( pou4tlxnmoeiyslmDuaumon(4tltrirctotlateanvo s)tetoim iy4olte fes s sDur(rpno0openmieils a2el(vp;(4tlxrmo3oa1faDraueo t)srxmim io1am nlncslsf 2uaur nt1apxoio3ildla2rau s u4texnio3io1omtelnvolt)srxmir iu4lpe  ivtl( s2ua(r no0opx if3iydlm2emnvsnu0alxoxr3iatfpD an i s  2uoir3oodopenlfviasf rtmumoot1oet  fctysfa2rauvsnt0 rtrircty1omDelu s s trumim3nu4al elncsa() rrrum oo1opt iocilsfa rl(mp (4tleoir iodlpt lies;t  eurio3ny1lleelfcia(fa2tax o;t0aptn ieiadfm2emump t0trxnio3totopDrlnvo s) rumxr3ny1op  lfvils)arra(rooo1opxnii3iydlm rl(vo u) rxnxf ia1la r iei t0t2toiopno4alee ncta(  Drrurpou0oetn o3iyd m rmnvsnt4 exnio3tydfpt li ils)tetm(rpiu4lle lfviat)sDrrum nt0oleoif3tad a2rlnvo u4texrxfcoytomt  uvs;s)texo(m nu4aptn nvsasfsDrau pot1tpx  octld s ra( on(0aetnir iydoptelnvils sruo(o iudll n feia( sDtm(r no0oexn ocildfm uauvonu0trtoio oadoa e nes;()s2uoxopno4omte nvi sfartmxr no1aeeomo3iyslmDrm(mp t0artoir oatlm elnvils srur(r ny1ap   iesat  2urumo;u0apxomf3tatlm ul( on(4 exnmr3iotfmDeluesls) 2uo(r oy4ap   net s sDur(m ;u4aeenmi3tydla2ulnmsn() rtnxr3oy1opteluvilt0 rtrxm3iy4al nlics (f Dtrum no4tptn ictldfa ul( s t4altrxoctodopt lu i (0 ruoxr3nydaptn iciltfsDrrur ;t4tle ifciydfm emn pn(0teeoxr ootfpte ieo s)s2uoxm3no4oltemneta(  rrmxrp;u0texo i3tatlm elu p (4tetrio iydfatr ieols0trurxo3oo1om nmfctat a2ua(rp;o4aetomf3tyt sDemnvo u0 lxriocoa1lat luvi s  2umxm nodamtnmivi s  2rrurpoo1tlxomietas mDrlnms;t4alxoxfcia1lmteau sl()setrxm no1lmenmietl( srtrumpot0aleo feilt m em(vs t4tltrifctatomDeaiei t0trumxo oudlm emnct tfaDurxrpnu1tetn oeiat s eau pn(0 etnirctotfpDrlnvo;t0srxmxr iy4lmt mnesltfsrrrx  oo4alt ifctys s eau o;()tetrif3todfaDrlu i;(0texmio nudalenmfctas  rraxmo;t4aptomocias s2um(monu) lxnmf3tadfp raivolt)trxm(r3iy4apen fvtatf 2ra(rp;u0tleo feiltfa2uaumsnu) ltrxo3todfmt ln o;t seuo(m3nu4lp  lnvtlt)arta(rpnt4ole  iciltlm uaumo u4 ltrxf oytlpDrluei (  2uoim3nu1om emfci (fa2rmuro;u0ole iiciadls ulnmp;u4arenif3oytfa rlneo;s0 rumim iodop   fesat)aDuaumo;u1opxo oetyt m2emums;(4trxrxo oa1oa raues;t0s2uoim oo4lm  mietls aDraurooo1oltn ieiyd s rau snu4trxomr3ia1fpt livo;s srxo(r3iydolt lnesasfa2trxr ou4tet mo3iyslaDeauvs t0arxrifcia1
\ No newline at end of file
@@ -0,0 +1 @@
+ueolt  2umxr3iudlm elnetat  Dtmx  nu1tltoioctldls rmuvs;t4 lxoio3oydopt auvils0srtmxm3io1ope licia()sDtm(m ou1openmociatfs2ranvo;u4 renxf iodoaDe n i;s0t2xo(o no4lm  micil()arra(root1aetn o3iltlaDea(vp u4artnif3oadfatrau sl()srum(o3oudlpenmivi s) 2uau  nu4aeenii3iaslm ul(vsnu) rxnifcoy1lmtrai s;t0trur(m3no1am elnvs t  Drr(  ;u0aex ii3iytfm eanmo;()aexomr oa1lpte nei;t) rxrxrpoydlmen nvsa()s2tmxmoot4oltn o3tldla2em( p;u4altnmfctadfatr nvi ()texmxm iy4lme  nvt (faDrax pnt0tlxo ocias sDumuvpnt4areoio oatlpteaivo (0 2trio oo1apte fesat  Duaumpno0olto feiatls2el( p ()alerio iodfpDrai s;s)t2urimpoydlpt lneias aDtaumono1tltomoeiaslm ranvsnt0 rtoir oa1lp   ueo s0 rxo(o3nu4alt mnvsls)artaurp;o1texn ictadfaDuln p;(4arxnxo3oytfmDe ivsls0seuoxr3iy1om n neias)a2rmxmp;o4aleomociaslm2uanmo;u) lxnmr3oo1lmD lueilt0t2uo(m3ou1apeemncil(f rur(ronu0texo ietat s2elnmo (0tlenmo3to1faDeln i;(0texmxo3oo1op nlics tfarua( ont4alxo icilt a em( o;() eermr ootfa rlieilt) 2xoxrpoodoltelivs (f 2rm(  nu4altnmf3iat a ean onu4teerxociydfmDelnei () euoim ou1alt lictls artmurpno4aeeomfeiysfaDemnmsnu4artomf3oydfpteliei s  rtm(m io1altnlfvsas) 2tr( poo1oltn fciytfsDel(vp (4aexnxfcoa1fpDrauei;t0sexo(m oy4lm  liei t)s2taumoot0teeo o3iasls2ua(vo;t4 rxnxocoytopDeli i s t2xmxr oydlmee fei s aDtmxroot1texo fciatls2rau o;u4 eerir3tadfptr u o s t2xm(r iu4lptnmies tf Dta(rooo4aetoiiciltfs uanvo;t4texrmoctytlptraueo t)trxrxo3iydom   fvils artr( ont4openiictyd s umn pnu0arenxo oy1fmt an ils0t2uo(m iy4omee fei t  2uaxrooo4aetoiieiadfmDemn p t0 ltrxo3oo1laD aiesl( trto(opnu1ol e nvs t) 2ra(monu0aeeniocilsla rlnvo;t)trtoio ia1fa   ieilt seum(o3ny1oleelnesasf Dtm(roou4oexn ietatfa em( o;t4texrmfctotfaDran ils0trtoio3no4lpenmnvilt sDurur ou0olx moctytlsDem(vs u)aexomf io1fpt  ivs s s2xo(o oy4omenlfcs tfs2tmx pnu4tptnmf3iad aDrau o ()tlerifciytlat  u s t0 ruo(m3ou1ameelfeils  Dtrurooo4tlxnmo3ilsls emu p;u0tlxoxr3oo1faDelueo;s)teuoim ny4lme  fcil(f rurumoot0tle ioeiytfa2rmnmo;(0tetrmo3oodfpDeluvols0 2xoxm nodamen nctl() Dtr(r ou1tpt ii3iasfaDean onu4trtoir3totfmte ivs t0seto(mpoy1ol nlfesls)srtrx  ;o4texn o3iydfaDem( s;t0altnxo iydfpDrlieils  2ur(mpio1lltnlnctasfsruru  ou0teeomoeiatfa2umu p;(0arerir oydopDeli i;(0 eumio3oo4olen ncta( a2umu o;t0aet ifeilsfm2eln p;(4 lxnxr3oy1fmtelieo;t0t2trxopny4lpe  ies tfs2trur ;o0teto ociadlm rauvon(0tltrir3tydfmDe n s;t) rum(opnydol nmnes ()sDtaxmoou4apxn ieiatfa2umump;(0artoxo3tytlaDr uei;s)trum(m iy1ome lfviat)aDtrump;u4oexniociltfm elu onu)tetoif oytoat  i o s0trxriopoo1lle lnvs sf rumxmpoo0tlx mictasla2ean s (0 ltnxo oytlaDraueo;t0tetmim iy4ap  mfetls)aDum( o;o0tetnif3ias m eluvsnu)tetnmf3io1lmDrlueilt)t2toio3oo4lmenlnetls) Dumx  ou4aeeoio3tltfa2uan snt0aexoifcio1lpDeli o;s sexr(r3nodolee iviatfsDur(  nu4opxnmfciasfmDelnmpnt) exoio3tydlatraneol(  exmiopiu4optemiviatf 2rmxr nu4olx mf3tlsla emnvpnu0tetrio3tadfa r ues;s  euoxo3io4lmtelieiltfaDum( o;u1tptnii3tlt sDeanvs t4trtrxr3tadoate i o;s  exrxm iy4optelfci tf 2rru o;u1tet ioctyd a2uau s u0 lenxr iatfpD aieols tetmxo3iy1apen ivt t s2tmxmp;t1opxn iciysla eau o;(4texnmfciadoa   ues;s teumio3iudlpen fes () 2raxr nt4tlxomicilslsDeaumpnt) rtoio iydopte uvo;(0trxo(m oo4amtn fei s)sDtaurp;u4texo ociyd a2um(mpnu)alenio iydlmt ai ilt)srtoxopoy4lmtemnctl(f Dra( p;o4optoifeilsfs2ulu o t4altrmo3tytlate neo;t0texrio3iu4omenmivia()s2raxrpnt4ole mi3iytlm2rau o u)aexnio3oytlmDrai i;(0sexrxopiy4ol nlfes t  ruaur ;t1aleniictltfsDelnmont4trxomo3oo1lmteluvsl( trxoxo3ny1amte neil(fa2rm(m nt1teen fctltfm2rl( snt)alenxo3oatopDran s s  rum(r3oy4ol elicia(fsDrm(rpnu0alxomictld a2ran s;() rxrxocoa1fa  auvi s  etrxm3ny4alenlfvsa(f Drr(m ;u0tpenifeiltfmDuanvpnu0 rxnxoctotlaD au o;t)teuo(rpnu1aleelnet tf rrrxmo;t4tlenmociatfaDemnmp () rtrio oytlpteanesls  2xoirpnydoptelnetlt)aDtrumo;o4tlt mietatlsDrau s (0aetoif3tydfpDr ieo s)trtr(o ny4am nlictl( sDuaxmo;u4tetomieildfs ul(mpnt) etrxr3totomt an sl(0s2tm(rpoo1ole lnvsl(fartrum ou4teeniicilsls2rau snu0aleoiocootop  ai i;s s2xrxr3iu4omenlnciat  Duaxr ou4tlx  f3tyd s em(ms u) renmf ty1lp  li il( tetrxm oy4lleelivtl( artm(mooo1aexomocilt aDrlnmon(4 eenxrcoadlp elnes;s0trtoir ou4olenmnvia(  rraum no4opt if3tasfm2umn snt) ltnif ty1fm eluvol( s2xrxo iy4lp nlnvs t) Dururpnt4aetnmi3iytla2ulu snt0 lxomf to1fp rau s;t0t2to(o3ou1lp  lnvtat)srrmurp;o4olxo f3iadfs em(mon(4treoif ootlat lueo t)sexrxrpoudalt mneta( artmxrooo4apeomo3tatlaDrlnmsnt4 reoiociadoa eauvslt teurio3nodal emnvils)aDtaur nt0oltn o3iatfm2ea(ms;u4 rtrxf3oytop r u s;s  exoxr io4ape lncsa()arrr( pou0opt ioctasla2ea(mo ()arxnmf totlpt  u s;(0sruoim nu1al  mncs s)a2rmxront0aeen ocilsfa2elu p t)tlxrir iydfa eai s t0 rumim3nu4openlfci sf Dtmu o;t4tlenmociytla rauvo t) lenif3todlm  lneo;s0trxoim nodom nlieslsf 2tax onu1aptnioctad sDemumont) reoxf3ty1lm  aieils0 ruo(o oo4om eliei t srtrurono1oexoifeildfa ea(vpnt4trtrxo3iodlaDe i sl()t2toxm io1apt mnvt (  rur(  nu0opx  ictysfs2elnvpn()trtnir ia1fmteli s t)t2xm(o oo1aptnlneil()srrmu  oo4aeeo f3tadlm2ulu p;t4trenxrcio1omtr ueo;s0 euo(o3oy4am   fvi ( aDtrxroot4olenio3iasfm2um( o;t4 exomf3iotoatr neils) 2urir3io1lp emnvsls)s2tax  ot0oet ifctasls eanvsn()trxnir3ta1opD  nesl( srtmxopnudalt  ics (fsDrmx p;u1tlxnio3ilsla elu pnu0tltnmf3oa1oat  uvo;()texr(m no1ap   fet t  rtaur nt1tpt  ociaslm el(ms;() lxomr tydoatr nvils)t2um(mpnudoleemfcia()sruax  nt0tlx mf3iat a uanvp;()texnmo3tytlmDrlnei t0 rurxm3oo1ap nmfesatf Drrumo;u0oet iieilsls2ulnmp u0tetrxr3oodlmte nvi (0 rtoxrpou1om e ivt ()aDua(r ;t1olt mfciydlaDumnvs;(0altnxrcta1oate u s () etr
\ No newline at end of file
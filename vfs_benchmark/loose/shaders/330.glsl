@@ -0,0 +1 @@
+nei t0t2ur(r3ou1ol emieias  rumu oot0oetn o3tld s emums;(0tetoir3tatfpt  uvs;t0t2tr(r no1apee ivtlsfs2uau o;u1tlt iictat a2rauvp (4trxnxr3tadla e ivolt0trtrimpoo4ll  mfvtlt)arrm(rpnt4tleoioeiasfa2ul( o;()arerir3todlmDrli o;t0s2tmir oo1open ies () 2ra(r ;o0tpeniiciadlaDem( ont) rxrxf3oadfat aivo s s2to(rpnu4ll  lfcia(  rurumpot1tptomoeildla2uan pn() rxnxfciotom  aues s  exoxm3ou4ameelivsls)aDurumont0oexn ociysfa2em(vpn()trxrxo3oydoaDe n o s  eum(m nudlptelfciat srum( onu0opxo ieilt sDrmn o u4aleoifctytoateln s;(0 exrxopnu1opt mnvilt) 2rmumo;t4alx mietlt s em( pn(4trxrio ta1latr uei;t) 2xrimpoy1olt  nvils)arra(  no1oetniiciytfm2ranmo;u4 leoifcoadfatelu o s0 2xoxm ou4op e fct sfsrraxm ;o4tee iieiasfs ua( snu)arxnmo3todoptrlu ils  rxoio3iudom n fvils a2truront0ope ioeiad m uanmp;(0 exomr iy1fpDr uvi;t)s2triopnu1al elfetl( a2tau  nu0alxnif3ildfa rl(vo;u4aeenmf oo1lptean o;s s2xrxo3iu1omenmfvtasfaDrmumo;u4tee mi3iytfs elu snu4altoir tydlpDeau sl(0 2trxr nudope  ics t s2urxm oo1oexnio3ildlsDrmums;(4tltrmr iy1laDe u o;s  euoimpio1ape lnctltfs2ra(r no0teen feildlmDrmn o u) exoxo tadfa eauvo t)srxrio3oodlmtn nct s) 2urxmpno0opx  fetasfm rmump;t0aleomoctodlaDe nvols0s2umxr iy1lpe miesls)aDrrur oo0ale  oetltls2rmnms u)tlxrxr3oa1lm  ln o;s0teto(o3nu4om  mnetls) Drm( oot1ape ifeiyt a2emnvp;u)altrio3oa1faD ln ils trxrxmpoo1ole mietat sDum(r ;o1aeeo fciat sDumnvs;t4trenmocoadomtr ivi s) exmxr ou4op  lfvilsf 2tmur ot1aleo feiysla rl( onu) etomr oadlpDr i i () exmio no4lmenmnei s) 2rau p;o1tlx  i3iydlmDemuvs u0 etnmr oo1oa elivo;s0trtrio io1ape lietatfsrrr( oot4tpt  ietlslsDrluvsnt0altnif ootlp ean o (0sexrxr3nu4lp  mnctl( srraumpnu4tlxnmietadfs2umn pn(0aetoif oytla  ai i;( srtoim iodopeelivs s  Dtax  ;o4alxnmoeilt a2uaumonu4aexnxf iy1fp eli slt0s2tmxr no1oltn feia(fs2umumo;t4aex ii3ildfaDrm( o;u4texrxociydfmteanvs t0trxmim io1am n ietl() rrmu  oo0opxnioeilt m uauvont0trtrmf iy1om rluvs t  etmxmpoodlpt  fvt tfs2rr(r ;o4tlx if3iatfm2ua(mp (0texnir3io1lp rlnvsls0s2tr(m3oo1am  lfeslsfaDrmumont0aleo ietyslsDea(mo () rerxocty1oa  aues s0teurxopio1ame lfciltfs2trxmooo1openif3ilslsDra( sn()trtoxf iadlpD  ivil( s2uoio3iy1apenlfvs ( sDtau pou4oltnifetysls2ul(mo t0 lxnxr ta1oateaivi () 2uo(opou4alee feilsfarrruront4aptoifeildfm2umn pnu0alxomoctydfaDelueo t0s2tr(m3io1am   ncsat)a2ur(mpnt1aeto fciyt m2el(vpn(4trxnio3oydoa  luvi;( seuoxr oudll elfctlsf ruaxront0texniieiadfsDul(vp;() eeoxociatoa  ai ol()texrxmpoy4op n ncsltf rrr(mp;o1opxoioeiasfa rl( pnt4tetomrcoy1lpDe i i;s  etr(r iodam  livsa() 2rmxr nu0teenioetldlm rmu sn(0 exnmfctatfmtrlieo t0seum(m oudop   ivtat srra(rpoo4tltnio3tysls2ea(von()alxoxfcootoa eaiei t0seurxo3oy1opee fes s)s2taumoou4tee moeilsla2rm(vo;()arenmrciotfmt aieil(0 rtrir3nu1ll   nvtatfsDua( o;t1texn i3ilt m rau snt4treomocoodlm raivi s0 etrxm3oydolt miciat  2ra(  nt1tetniictys m eau s u4 lxomr ootfm raiei;t0tetoxo3ou4omte ivt ()srurx p;u1optoii3iyd s2uauvs u) lxoircoydomt ai s;(0 exmir3iu1op nlncsls)srra(mo;u0teenmi3ildfsDrmn p (4teeomrcoodlm r ieil( srtoio3iydop emfvias srrmxr oo0apt  fciltfa2um(mp;u) exnio3oydlp elivsl()s2xrxopiudlmeemnes t) rraxroou1openio3iadfsDua(vsn(0 exnmr oydfm  an i t0 2umimpnydal emfci (fs2tmumpno0aexnmoeiasfs rlu s t4aetnmr3todlpDelieo t)srxr(m3oo1amtelivi ()a2rrxrpoo4oee  oetatfa2emu p;t4 leoircootom e ies;t) rxr(o iy1lm n ici ()aruaxm ;t4tlxn f3tytla2rl(vpnt4texrircta1optraivo;t0 2xmxm iu1omee ietlt sDta(rpoo4tle mf3iadls elnvo t) exoifctodfmD ai sls)trto(m ny4al  lfcsa()sDumxmpno0alx if3iat s2el( s t0artnxocoy1fpDe n s s0texmxr io1ome  fvslt)srtrurpoo0opxniictydls ea(ms u0alxomr3oa1latelnvil( t2tmimpoydam  mnes tf Dra(mooo0oleoiietyslaDeau o;t0 etnxf3iatfa eau s s  ruo(m nodamtn fcs s  2rr(  ot1tee iiciysfm rmnmp;t)tltomrctytlmD li o;(0 2toxo nu1om nlnvi () rtax  ot1olxnmiciasfm2eau snu)arxomr3iadfate u sl()s2xr(r3io4om  liet sf 2ra(  nt1teenifetld s2uluvsnu4 rxrmr oodoaDe u i;s0 exm(m ou4lltelncta(faDrrumono0oleo o3iyt m2eln p;t0areoxo3ty1om  ai s t0 exoir3oodam elfcsa(f 2ra(rp;u4opeoii3ilsls2uan s (0 rxnmf3to1oa rlneols0 rumim io4llte ivta(faDrmumpou1opxomo3ildfm2ea(vs;(4arxoifciadfat au i;(0truo(r3nodoptn fciat) rraxrp;u1oetomicildfm2um(mp;t) lxrmrcty1fmD  u s;s)seumxm nydamtnlneslt srtm( pnt0olxniociatla el(vsnu0artnxf3iotfaD  uei;(0s2toxmpio4optnmneslt sDrrx onu1aleniictad a rmu o t) rxnmfciatlmDeluvsl(  2trxm ou4ape  fcs ( arra(mp;t0tet ioeiatls2rm(vsn(0arermrcoatlpDeaiei s)sexrio3ou1op e nvil()arur(  ;u4olxo o3iyt a2rm(mp () rtomf3iydla  aieo s sexoxmpiydlmenlfctat aDua(  nt1aexn ietlt m2em( s u4 rxnxr oadoa e ies;s) 2xo(mpny1lmt lfvtlt)aDrrxrpno4tltoiictyt sDemnvo t)tlerxo3oy1lat aies s)trur(m3ny1ame  ivsa(  Dumu  ot0teeoif3ild aDulu on(0 rtnxr iodfaDe u o;t trxrxopio1omen nvs t sruau  oo4aexn fciyt m rmnmont4 leomocoatfm e nes;s)s2umio3nu4apen nviat srta(roou0alen ietatls2rm(ms;u0trenxf3oytla elu ils0trxr(o oodlpe mncilt  Dra(ront1tltnmo3tadfm rmnvp;t)artomr3oadfpt ai i;t0s2xoxm3iy1apt  nciat  Dtmx  ot1opxniieiatla2ra( p;(4alxnxo3tadlmtr uvolt tetr(o nodal  mivt (faDrm(mp;o4openmo3tyd s umnvpnt0areoxocoo1fp e uesls sexrxmpou4lmeemnesasf Dra(rpot1ale moeiaslm2em( s;u4arenxoctadfpDe ues;( s2trio3nudlltnliesat  Durxm ou0tee mf3iysls rlu pnu4arxriocoa1faDrlnvo s0 exmxm3oy1lpenlnctlt a2tax poo0tpxnifeiyslmDemuvo t) reoxfcia1laDrln i s tetr(o3nu4lltelfvils) 2uaxm ot4oexoifeildfaDrmnvsnt0aexnxfcoa1opD  ueil()srxmxm oodomtelnvilsfsDrrumo;u0opt  feiadls ua( o u) eenmo todla elnei;t)srtr(o3no4alt mfciatfaDumxrpno0oleoifcilsfa2rmuvsn(4tlxnxrcoo1fateaivo;( s2urxm3nu1altn ivt s sDua(r nu0aeeomi3tyd sDul(vo u4 lxnmo3todfmDe iei t0 rurir3ny4ll   fvi t)a2tm(m ;t4tltniicias mDrlu o t0treomo3oy1fmDrln i s tetmio nudomee nvils)s2umu pot1tleomiciaslaDemnmon(0altnmf3iydfaDe ivsl(0 rxoio3iodolt lfes ( s2tmu o;o1teeomoetys mDrmn p;u4artrxf tydop   u ils  2xrxr iodal  lfcia(farumu ont4oexn fciysfa emnmp;()areriociadfat an s;t)trto(rpoydamte fesl() 2uaxroot0oexomfeiydla um( p u0 ltomrcoadomtr nes;t  euoxo nu1ape liviatf 2trxmooo0aex  ociadfaDrln pn(0artrxo3iatfpDeanesls)sruo(o nodom  lieil() rtm(rpno1tetnmi3ildlaDum( o;()teeoiocia1faDeln ol( srtrxr iodalt lies ()a2ua(mp;t0olxnio3iysla2uln snu4 rxoir oy1op eluei;s0trumir3iu1lp  lfcs t)srrm( ono1apt  ieilsfsDulu s u0tltnifciatfm  an s s t2ur(mpnydlltn ietls)arraumo;u0aetn oeildlsDrau p t4 ltnxocoatfm   uei (0 2tr(rpny4olee nvsls) 2tmxmont0alx ifctltfm2ea(vpn()tetnxf totomD li s s) exr(o iy1ol n nesl(faDum(m ;t0teen ociltfa2el(mo t4texomf3oydoa   nvs;t) exmxr oy4ll  licias)sDua(m ;t0aptn icias a2umnmsnt0 rtoxfcoodla   nvol( trtrim3nodomt lfctat s2tr(m ot0tpt ioetld s eluvs;t)aeenif3iytfpD aueo t) exrim no1ol   iviat  ruaxr ou0aex  ieiysla2rau o;(0 lerxocia1fa  aieols texmio3ny4op e ivsa( sDuru ono4aleo fctytls2ul( pnt0 renxr ootoa raiei s) rur(o oo1lptnlfes (f Dtaxr ;t1altn ieiydfs rau s (0alxnifcoy1lp r ieils)sexrxo iudlmeemnvt (f 2rm( oou0aptnifciltfm2rlump ()tltrmf iotlm elies s)truoxrpnydlle mivt ( arumxrpou1tleo ociad aDranmo u0tetnxr iydlpteanvs;()t2uo(r3oudap nmnesa()s2uaxm ou1aex io3ilslm uau s;(4trtnxfcia1fmD lnvol(  2urxm3oo4olee nvtat s2urum ot1alxoifeiasfa ua(msnt)arenmociotlmtelneols t2tmxmpiudape  ncs s)aDtm(ro;u1alxnifeiad sDul(vpn(4tlerifcoo1la e uei () ruoxopno4lpe lietls sDumumpot4oetnifetyt s rm( o t)aeenmo3iatom elueslt0 etoiopno1lle miviatfs2um(ro;t0opeo fciytlm um(mpn()arxrircty1fpDe i o;s t2trim oy4ale  icias srrm(rpnt1tex moetasfa rl(vp t4tlxrxrcty1lptranes;()t2uoirpnu4lptn nctl(  2rr( p;u4opeomiciydls2um(mo t0altoir3iatlaD  ivs (0s2toxm nu4amtnmnvil() 2tr(r nt1aeeomictatla2ea(ms ()aeerir todlp ranvol(  2toirpiy1olenlfvs tf rra( pnu0tpt iiciaslm eluvsnu)arenif3oo1oatraieo;()s2trxopiy4lltemicia()a2rr( poo0tltoioetatfm rmnvsn(0arerir3iatfmDrlivi s0 rtoxo iu4ap e ictatf 2uaum ;o4apx micildls2umumo;t4 exnirciydlm r ivi;()trtm(r nudapt miesatfa2rmum ;o0aetnmociaslm umumo;u)teerir3oa1fm rlu s () eumxo nu4ape livt ( a2ta(m ;t1aex iociadfmDuan pn(0artoio3iytlpD  ueo t texmxo3iodlm e ivsa() rur(r ou1openiiciys s elnvo u0aeerxo oatoaD li il( trxoxm3io1llenmfvtas  2raumpoo1apen feilslm eaums;(0 renifctatfa elies t srtmxm3iy4optnmivia()arumxrooo1tet iocilsfsDumuvsnt) lxrxo totopt  u slt t2to(rpiy1lpt lieia()aDtaxroou0tle moeiat a rlnvs ()texrio iydlm rlueo;(  etmxopoy1olt lnetltfaDtru  ot0oet mi3ild a uau s t0tetrxrcoadlmt anei s  2tmxo3no1opeemncta(  Dtaxmo;u4teeomieildlmDranvpnu4tlxoxfctadoate ivs;() 2xmxo iu1op  livs tfs2ur(m ot1oeeo ietldfsDumuvon()tltnif oy1fmteauvilt0sexo(opoy1apen nvias a2ta( ont0oex  o3tld s2umnms u)arxoir3ta1lm  au s;t  rxmxm oy1altelnes t a2tmxr ;o0tlt if3iatlm2rl(vp u4tltnmf ia1omDelu o;()srtm(o3iy1lm n nvil(  2tmxm oo1teenmfetys sDrmn p;t4tleoxocia1fm rli o;t s2umim3iy1am  livtls srum(r ou4alenif3iyslsDrmuvp;u)teeoxr oodlm elneo;s t2to(opoodapenmfvs ()s2urur ;u0olxnioetysfaDrm(mpn()tlxnmfcta1om rluvolt)texo(rpiy4ome mnvsl(f Durump;o1oexo iciysfaDelnvs;t4teeomr tytlmD aiei;s t2tmxo3iy4omt lfct s)aDtrxmpno4olxomfeiaslsDuln p;(0arxomfcto1fa  aues t0seumxo ou4apeemnvsat  2ta(mont1olxo ocilsla2ea( s;u)artrif3oytomDrai s s srurxrpou4apen net t)srua(mo;o1alx  i3tyt a2ea(von() rermr oo1fpt anvs t0t2uoiopiy1altnlncias  rta( ono0oex miciadlmDelums u)aexrmo oy1fmte nvo;s  etoim3ou1om nmncsls)sDur(r nt0alx mieiydla em( o u4aetrxf oodfp e u slt) etrimpnydome  iciasfa2rau ont1olt  fcias a emumonu) etrxo iytomDeliei t tetmio3nodop elnvs t srurxroot0apenmo3ild s emn snt) rtrmf ia1laD auvil( s2uoio oy4aptnmiet (fsrumu  ot4tpxo feias s2rl( p u)texoir3ta1optr i i;s)texoxm3oudll elivi (fsDtaxr oo0tetomieiys a rlnms;t0altoio oydlatraivo (0t2uoim oy1am  mnviltfaruru p;u0aptnmi3iltls eaums;u0arxrircoadla  an s ( s2toxrpno1lpt  neia()sruax pno1tlx mi3tlt m rlnvp (0 leoxf oy1fptean olt  2xrxo oodam nlieta(  2ta(r nu0tltn f3ildfa ra(msn(4tltnxocia1fateaueo;t srxoxo3nu4amtnlfcsa()a2umu ooo1opt mociyt s eanvo (4 rermr3oatlptean o s) etm(opnu1omt lictls)a2umxrp;t1oetoioetat s rmu s;t0aetoircoadlmtr ies;s)t2umxmpny4lp e ictl()s2rr( o;t1texo oetysfs2rau s;u4 lxomfctodfpDeliei;()t2trirpio4openlfci tfs2trurpot1texnio3iys aDuanms u0artoxo3iotopDeauvi;( t2xmim3iy4lptn fetas a2uau  ;o0tpx mfetldlmDelu o;(0teeomo iadopt auvol()truriopoydam  mfciltf 2rau  no0olxo fctadfaDelnvo;()arermr iadfpte ivi;() ruo(o3io4lme  nvsl()srtru  nt0alenmo3ils a2umnvsn(0aleomrcoa1fmteanvilt0t2toxopnu4lltnlnvi (  Dtaxmpot0teeoif3iad a ra( p;u) ltomr oadoa r n o s)trxo(r3no1al   fvilt)arta(r nt1texomf3iyd m emumo;t0 rxrxfcta1omt aivo;() 2xo(o iy4altelfeil(  2trxm ;t0tlt mi3iasfs2um(ms;t4altnmo3tydfa ran o;s tetoimpiy1am e ivsls)aDrrxmo;t1oex io3ilt sDrau s u4alerxo ootfmD ln o (0sexrim3nudlm  micilsf 2rm(r no0apto f3ils s2em(ms;u0 etomrctytfa r u ilt  etrxr3no1ame mfet s  rta( o;o4tptoifctaslsDranvs;(0aexnio iotlm r uei s t2xoio3nu1omtelietat)s2rmxro;u0oltnifetys sDumn snu0 lerir iotoaD  n slt texoxopoo4om  lnvsas s2urxmpou0alxnioeiatla rl(vs;u0 lenif3tadfm r uei s seuo(opiu4lme  neilsfaDta(moot4openiieiatlaDumu ont)altrxf io1omDean s;t0s2xo(rpny1llt miesatfa2taxroou4apx  ictyd aDuanmp;()tltrif io1fmDeanvil(0 2uoirpnudopenlfvs t arumurpnt4apenmi3iasfsDraump ()tlxoif3oodlaDeln s;()trum(r3oodlme mfcsl()s2umxm no0ole  feiyslmDeau p (0tltnmociytlp rlnvi;t)texr(r nodll   nvtl( sDtm(r ;o4texoii3tydlmDel(ms;t4 lxrifcoodlat auvsl(0 eumir nudol  mivil( a2ur(mpou4olxoii3tyd mDua( p;t0 ltomoctydfm  ln o;( t2tmxo3iu1op elncia(f 2rr(mpot4opt ioctat a emnmont)tlxomo iotopDr u o (0sexrirpno1al nmfesl(  Dumu o;o0alx mfctys sDel( p;(4tltoxfcoo1oa elneo;t t2urxr io4ap n ncil( a2umxr ;u1oexn i3iysfsDeau snu0aexoioctytlp rlivo t) 2urxr iodome  nei s  2uru poo1olt  f3tytlm2ranmo u)tlxrif totfp eaivs;t0sruo(r3io4lme mfeta( sDtm( pou1alx  ieiydlsDra(vo t4 rxoxfciodfmDe ueo;t0teuo(rpio4om e ivslt s2rmu oou0aexoif3tysfsDul(vp u0tltoir iatfm eluvsls seuoxm ny1olt  fvtlsfarraurp;o4olenmf3tyt sDemnvonu0 rtoxf3iydomtr ivsl(0texoxr3oodam nlivtasf 2rr(moot1tpeoif3ilsla2uau p (0 rtrmocoo1fptr i s s teurxrpno1llen fcsltfaDrax p;o1oexnii3iysls ua( p ()aetnxfctadfm e nes t) 2xmir3ny1lme  fvil() Drmxronu4tleoif3tltlaDemuvs;u4 rxnircoa1lm   uvilt0 2urim3ny1olenlfct s  Durx p;o4olt iieiasfaDeaump u4 lxnxf3oodoa eau slt) exmxmpou1lpte fctat) Dta(mp;o4oltnii3tasla rmumpnt0trenmr3oadoa eanvolt)t2uoio nu4om nlnctlsfsDtr( pnu0opxn i3iys aDrmu s;(0 reoxf3oytlpDr uei t  2ur(m iydol elict tfsrumx o;t1apxnmfctls sDea( s;u)alerxrciytlmDrai ol(0 rtoxmpiydll n iet s)sDumurpnu0alx mieildlm2eanvsnu4artrxr3ootlpt anvs ( s2xmxo nu1alenmfes (faDtmumo;o0tlx ifeild s2umums (0teenmo oytom e uvil( trtoiopoydale  icsa(f Dur(mo;o0aetn feilslm ran pn(4tlenxfcoatlp elneo;s0s2urxrpny4omtnlfcsl() Dtmxrpnt4tex  ociytfaDrlnvon(0trxnio oydoaD  ivi s  rtrxmpiodlp elnvs tfs2rr( oot4apeoiictydfs uaumpnt0texrxociadfaDr u i;(  rtmxm nydolee nes s arumx  oo1texomieiad s2em(mo;(0alerir iodop r i ilt0seurxopiydlme lics s) Draumooo0tleo iciadfa2emu pnt)teenmr3oatlp  anvi;()s2xoim iodoleelfes t  Dumxmpoo0alxn feilsla rmnmsnt)aetrmr3ta1omDranvi;t0srtrxopoy1altn neta()srrrxmp;t0alt mociasfmDul(vs;u4 lxrio oydfpD luvols0 rtr(r3iu1al  livs t s2ta( o;o1oex mo3ildlsDrm( p t4aexoxo3tydfp ran s s0 rurxr3oydolt mfct tf Durxmpou0aex mietas s2ua(monu4 ltoxf oydfmt lies t trtr(r3no1ole mnvilt)srta( oot4oexnio3iat m ua( s;u4teenxfcoa1fmDeaneils)s2umir3oy4alenmictlt  2taumo;t1oltomoctydfa eln p;(4 renif ootfmtraivil( texm(r3iodameelicta()sDtau p;u1aleo o3iytlsDua(vsnu4 rxrxo oatopteau ol()setmir3no4lptnmnviat sDrmxmp;o4openifctadfaDemumo u0 eenmociadfmtelnvilt)trxoir3oy4oltnlivs ()s2ur(monu1olxnioeiysla2rmuvont4aexnmo iodom eln o t)trtmim oo4lme mfvias  2tm(r ;o4teeniictyt s rl(mo;t4 etrxf to1lmtrlu i;()s2umxo3oo1ape licils  rua(m nt0oetomoeilt m2em(vo u)arxnif iydlmDelivil( s2umir3nu1llen ictl() 2raxr ot4apeoioeiydlsDrmnvs t4 etoxo3oadlptran s;( s2xoxm iu1al e fes t arrrumpou4ale mictltfa ranvsn(4 exrmr tatfp r uei;(0sexmim3nu1apt  ies t s2taxroot0oeenmf3tas sDra( ont4aexoxr tadlaDr n s () ruoir oudlpen fesatfaDtrx o;u0tpt  ociysfs2uauvsnu4 eeoircoytlp  aneol()t2xoir iy4lpee nvia() Dur( pno0oleoiietadls2rm( s t4aeeoif oa1fa   uvs;( sexmio oodamt  fctlsfaDrmumoou4oeeo f3iysfa ul(mpn(4 exoxr iy1oaD ai s;(0srxm(r oo1om  lietat  2tm(r no4olxn fciys sDelumo t0trenxf3iadop e n o;t texrio iy4op nlnesltfa2uru onu4tpt  fciasfs2rlumo;u4 etnmf tydom r uvi ()teurim iy1olt  ivsa(f rtmumooo1optoifeiydfs uluvp (0texoxfctadlptelieo;s)texo(o oodop n ictas)aDur(m ot0aex iocildfsDuauvsnt)aetoio ia1omtelues;()s2umim ny1lp  mnesat aDumuro;u0tpeomo3iatfs eaumo u4 rtnxrcoo1lptean o (0trxmir3iudlmenmnvt t aDra(m nt0oeenio3iyslsDumuvpnt0tetoxrcoydoa ran i;()trurir iydam  lneiasfa2um(rono4aeen iciat aDea(msnt0arxrxf iy1fp raiei ()srur(o io4omt mnviasfarurxr no0tpxoiieildlsDrlu s;(4alenxr todfmt ai s;s)s2trxr3iudlpee netasfarrr(m ;o1tptnmfctytfs2emumo;u4 exrmo3iydfpteaivs;s)srxrxo3iodol  lnci t)arrr(mo;u4opxn i3iyt m rmnms;t0 ltnif iy1fptrln o t) rurio3ny4lpen fetat)srtmxrpno0olxnmfcilt mDrlu o;(4aeeomf tytomDelnvs t0s2tmxr ou4lp emfesasfsDrrur ou1tpx  fctysfmDea( pnu0arxrxo iatfaD  i i s0texr(m oo1ll   fct t) rum(m ou0oex mictad a eluvo;(0teermo3oatopDrau i s)t2tr(rpny4lpe mfcs (fsrtmu ono4tetoif3iatfaDranvsnu4aeerio3iydlpD aieo t) rtrxmpoudam nlictasfartmxronu4oetn f3iaslsDra( s u4artrir iodom eaivo;s teurirpou1lpenmics (f 2uau  ou4tlx ifctydfs2uanmon()altrmr3oatlatrau o;s0tetrir3nydapeelies s)srtru ont4alx ifciltlm2rlnmont)artnio3totfmt  n sls0 2urim3nydape  net sf 2tmumpou0tlxnmo3tat s ul(vpnt0areoxociadlpDr ieols  2umir3nodoptemicslt srtru ooo0tpeo f3tysfsDrlnmp t0aexrirciydlm   uvsl(0trumxopiydoptnmfctls)s2rmump;u0olenmictysfm2el(vpnt)trtoif iadfp e ueo;t)s2uoim iodaleemfei t  2tmur nt1aptnifeiltfaDemuvpnu0aleriocootomD  n o;t)trtr(mpoydop   fetasfsDrmxrpot0olt mi3tat s uanvo;(0 lxrmociadopt aiei;s)s2urim3oudap   nesat srraurpnu1apxo i3tytfs ea(ms;u0tlenmr3ta1faDe ivs t  euoxo iy1lltnlfvta( aDum(r ;u1tee ioctldfs umuvo ()tlxomo iodfpDrlieo (0t2um(m io1olt  iesl( artaxr ;t1texnmietaslm eau o;()texnxfciadopDranesls0truo(m ou4ope mivt () 2rr(  ou1aleo i3iyt s ra(von(0 rtrmo3iadfpt  ivils0 rtmxrpiy1amt lneilt artm(r ;u0tee mieiydlmDeanmp;() lerxocio1oa   u ols)seurxrpio4al   fcsatfsruru pou1olxn octltlm2umuvont)trtoio3tydom elivs () rtm(m nodalenmfei (f 2rax  ;t1alx mf3tyd mDumnms (4teenxr3oytfpteli s t) exoio iu4apenmfct t arua(m ;o4olt  iciyt s elumsn(4arxomo oodoaD livi s0 rxmim nodome mnvi tfsDrrum ;u4olt io3iytla2ra(vs t0aexrxf3oy1om elivs;(0srurim3nodllenmfesltfa2tr(rpnu1tex  ietytlsDel( s;u)altnif oy1lpt  uei t srxoim ou1ame mncs t)srrm(  ;u0aeeo ociys m2rlumpnu4arxrmrciodlmteaieol( t2um(r oo4lmeelivs ( s2rrx onu0oltomo3tadfs2rau p;(4 lerir3oadomDrlu i;t) etmxm3no4ol   ict sf Drru  nt1aleo ictys aDelnvs u) etrir3iy1omDrli s;() exm(m ny4lm emfciasfs2rrx poo4aex  ieild m2ua(vp (0 rxrxrciydfaDeli ilt) eumxopoo1lle  neslt)sDrrx o;o0alx ifciatla2ran pnt) reoxf3ta1fmteliei s0truoio oydlp   fetlsf rurx ont4oleomiciytla2rl(vsnt0trenmfcty1fmDr uei ( s2xmio io4ll  mivtatfaDuru p;o4apxomfcias m2ra(mp;t0tleomr oydlmt luvols0 rxmiopou1om n ieia() Dumu  ;u4alto fciysla uanmont) lxnmf tadfptr ueils)s2trir ou4ll  micia( a2urxmp;t4aetomf3iyt m2ulnmsn(4 etoxo tytfpt aivo;( s2trxrpoudale mnvi tf rumxmonu0oee ii3iydlmDumu o u0tetnxo ootop   uvi;(0srxoirpny4aptemncils arrm(r ;t1texoifcildfs2um(mo;u0artomr ootfp elieol()s2toio ou1om nlfvs (  rtaxr nt1aeeomo3iadls ua( o;t) reoioctatoaDrlieils)t2xrxo3ou4lp   nvtas) 2ur(mpno0tex  ieiyslm2rl(mp;(4tleoxr3io1om rlueol() eum(r3oo4lmtnlfvi ()artru  ot0oetnioeildfmDemu p t)artoio tytlp  ai i s  rxr(m iu1apen fct ()s2rmu ooo4altnmi3ils s rmu s;t0treoir3todlpD lueilt0 2xrim3no4op nlnvs (  Dur( pou4ape ifctls s2el( p;t4tetnxf3tydfaDr ivolt sruoim3iydaltelfeiat sDur(r ;u0alt mo3iyd s2rm(mpn(4trtomo oytoaDr ivi s0s2urir nudaptn nes (  2tm( oou0tlenmictat aDemn s t4alxomo3ty1oaDeaivs;s)truo(mpoudomtn nvtl( aDuaumpoo0tptn i3tys m emnvpnt)tlxnmr3oo1opt  uvs;s0t2uoirpoy1ope lietlsfsrtax  ;t4tpen o3tyt mDrl(vo;u4alxnmr iy1fm rlivi;(0s2tm(m iy1lp n ivil(  2um( ono4oexn f3tadls2rmn o;()artnmo3iadoatean s ()sruoir3oudam emfvsat  rtrxrpoo1apxoioeiad mDum( s;()teerxr3oy1opt an sls0 rumxr3ny4am  lieilt aruau o;t4apt  o3tatfs ranms t0trtnxo iydfa rlneils srtoxm ny1olee ies t a2tr(mpno0tpen ietldfs2rmn p t0 eerxf3tadlatelieslt  etoio oy4oleelfctl()aDra(rpot4opxn octysfa rlump (0 lxrmr3oatfpt lu o;(0s2xmxopnu4amenmivia(fsrrr(rono4olx  f3iys s raums;(0tlxrmo3ta1la ranvs;t0t2uo(mpoy1omtnmivsa( srtr(mpou1olenmf3iys m em(ms (4 reoifcoodomt liesls) rtmiopoudapen ietat  rraump;o0aptn iciat m rlu s (4aleoxr3tatfm elu s ( s2tmim3nu4llee nvsl( s2rm(ro;t0oetnmoetaslmDemn o;t0tlerxr oadopt  n il(0s2tmim iudllt mietlt)sDrax onu4alx  ieilt a ra(mo;u0alxoxr tadfp r uvilt srtoxo3no1amtemietasfa2uax pnt1tlxo fetyd sDua( o t0tltrxo3tatfmt  n ilt)seurxr3nydom nmnvilt)arta(mooo1opt ii3iadla2ra(ms;t0aetoxrcta1omt aivils setm(r3io1olee icsat)srumumpnt4ape mo3iysls rlnvsnt)trtnxocoa1faDe nes;s)srxoxr io4lp  lncilsfs2tr( onu0tlx mi3ilt m2umumo;u4 etnxo3io1omt auvo t) rur(r3iy1ll emnvs ( sDraxmpno0teeoio3tad s ua(ms;t)artoif iatfa   ieols trxoio3oy1lp nlnvt tfsDtaur ou0oexn fctys m um( p t4arxrmfciy1oateau s s) exoim3nodlleelfci s a2uaumoou0aet mi3iat m2eln p () ltnirctatoptrlu ilt)trumio no4alenlicsas)sDrau  ;t1tlenifctltlaDrm( o;u4alxoif3tydlpDrlivs t texrimpiodlp emfciat)artmx  ou1tpxn i3iaslsDulumont)areoxrcoatlm r i ilt0 euoimpnudapen fciat) Drmurp;u1oex  ieias a2ua(mo;u4 lenir3iydop eluvs t s2xoxrpnodlmtemfesa() 2rr(rpno0aex  iciysla um( s ()trtnio ia1lpDe iei s0sexmim oo1lp emict ( s2trur ;u4tpeo o3tlt a2ua( p (4 lermfcoydoa rai ils)t2xmir ny4lmtemfcslt  Drrump;u1oexnmfetldlmDumuvp u) lermr3oo1fpDelu i;s) etmiopno4ll  mnct t) 2urx  ot4ole ii3tls m uanvo u4 etomf3ootoa r u ols teurio3nydll emfvs sfa2ra( ont1tpt mieiasfa ulnmpn()arermr oy1faDe nei ( srtmimpio1apeemivi s s2urxrpou1opeoiociyd sDuauvonu0 rtoif to1faD  nvs s teur(o nydlm e ncias sDuax  ou4aet  ieiaslm rlu o t4aeenio iodlm   ivi;() 2xmim3nu4oltnlieslt  Dtrx  nu1oleomicilsls2uluvo;t)teenxf3oo1opD  ivils)s2uo(rpoo1aptemiei s) Drrumonu4aptnmoetltfm2rmnvo;(4alxrio oydfmtr uei (0srtoiopnu4al elivtlt)arra(mpnt1ope mictydla2el( snu0tetrio oo1omtrlueils0srtrxmpnu1alenlnvils arururpou1teto octyd s uauvpnu4altrmf oatlaDe ues;()tetm(o3ny4omeemiesltfaDuaur ;u4opxoifctydlsDelumsnu4tlxnxr iotlpteluvo;t0 2toim3iy4opeemnvils)srua(ront0alt moctlslsDelnmo;() renmoctydlmD aieols)trxmimpnudal   fci ( s2rmurpou4aee mfeiydfs2ran pn(0aetoxr3ia1fateauvslt setoir oodllee fei s aDtau pnu1texnii3iytfsDrmnvs (0tlxnmfcoatfatr ies ()teuoxmpio4omtnlieslsf Dta(rono0apxomiciydls um(mp;t) rxrmr3ia1omtelu s (  exoiopio4lp n ivs ()s2ururp;t0alen icildfa2ulumonu4 rxrmf tadoa rai o t0srtoxm oy4ol elfesl( a2trurp;o0tlenmictlslsDea( on(0tlxomo io1fm eaiesl() eur(rpiydam nlicias aDurur oo0tpxn feilslmDumums;(4 lxoxo3tadfaD luvsl(0texoimpny4amt mnvsas)artaxrono1tpxn iciltfsDra( s u) etnxr tytfpDelu i s  rum(opnodaltemies (  Dtaxrp;t1openmieias sDemuvs;(4aexnif3oytfaD anvsl(0srto(opiy1lmeelfet sf 2urxm ot0tleomfetyd m rl(vsnu0trxnxo3tadfmt anvs ()srum(r3ny1aptnlfesls s2umxr no1alt moctydfm2em(vo;(4trerif3iadlaDean i;( srxmxrpno1al  mnvsl( srtmu o;u0aeeoioctld mDua(vp u4alxnxr iotfp elnvs;t)srtm(mpiu1aleelncta(f rumxro;t4oeenmi3iys m raumont0altoiociy1fpte ueol() rur(o iu1oltemivsas s2uaxmo;t0tlt ioctltfa2uanvp u4altoxo todfmD lnvil( texoimpio1omtn nvi ( srta(moot4texn i3ils aDua(ms;t0arxnif3iadomDeauvi t)t2toio nodlp  lfcilt) Dtmxrpot0olxnmfeiat m2emnvo;u0artomo3ootop raivi t0trtm(mpiy4amenlnct ()srrmum nu0alxo ieilsfm2eluvo;t0areniociotlm  aies t  2urxo3ny1omtemnctltfaDtaur ou4tee mieiys sDeau sn(0alenxr3oo1lpD anvilt)t2tmxr3nydlpte fei t)s2uaurpot1apeomi3taslsDeauvs u4 lxnxr3tadomt lues (0setoxm iudol  lfetlt)a2ra(rpnu1texo feildls el(mo;u0 etnmfciadlpt  ieo s)trumim iu1ape mneilt)sDurxr nu1opxoifeiysfs2eanmonu0aexomo3tydoaDrli o;t0 2urim3oydap  mivt sf rrr(mo;u0alxnmictlslm2em(vpn() lerir oodlmtean sls) rxmio3iu4amenlfet (fa2tm( ooo0apt iietls mDrl(mo () rxrircoo1lmD  u sl() etoxrpio1amenmicias  Dtm(mpoo1olx moctas m2um(mon()trxnmfcoatoa   ivo;( trtriopoy1opt livil()arur(ront4tle if3iat a em( o;(4artrxr iatla  au s s)seur(opnydomee fvt t s2rr( onu4aeto feiadla rluvpn(0aeermf3ta1fatrlues s) etoio3iudome  ivsltfsrrm(m nu1aexomietysfaDem(mpnt0arxoir tytoaDraneo;() rxmim3oo1ole  fctl(  2umu onu1opxoiociyd s2rmumsnu0 lxomo3tydfm rliei s)seuoir3ny1ll n nvsa()srtmurp;t1aee mo3ild mDel(msnt4aetrmfcta1lm r ueilt sexr(o iudlmtnlivt t)srtaxrooo0tpe  fctatfs rmn pn() rerio oa1fpt ln olt) eto(r oy4op nmfcsas artmu poo4oltn f3iadlaDuluvo u4 rtnifctodfmt  iei s)s2umxo iu4lp nlnvia(f Dumxm nt0olen oeiat s2emn p;u0aetoxr oodop e uvi t0setoxo3no4al e ietlt aDtmum ;t4teeniicilsls emumpn()trxrxo oytlmt  ivo s)teurxr iu1ole miesl( srtmx p;t1teenmiciyslaDean o;u) lxnirciadfm  an s s)t2tmxrpio1ope mfvtl( s2umur ;t0opeo oeiad a ul(msn(4 rtoxfctadlm elu s ( setmxr iy4apt mictl()aDtaum oo0optn feiatla2ranvo (0artrmf oa1oaDeln s t0texrir no1lpee ietlt a2raump;t1aetnio3iyt mDulums t) rtrxociatomD  iei;() 2xmxopnydlpenmfcilsf Dtr(mont1alenio3iat s2ua(mp;u4 etrxo totlpDrauei () 2xo(m oy1aptemnctatfa2urx o;o1aeeoifciasfs umnvs;t)arxnmf oodfptrlivs;(0texrxo ny1alt mivias)s2urumo;o0tleomoeiysls umnvp t4tlerif3iadfat aueol(0t2to(mpiodlme  fcsa( s2uauro;t1oetnio3iat a rl( p;() rtoxf3iydlpDrlieils srtmimpiu4lptnmiesl( sDur(m ;t0tleo f3iyt sDuaump t)trxrmf iydfpDe ues ( s2xm(m3ny1apte nciat arraxro;u0olt mocildfm el( p;u4 exrir3tytlmtelieil(0 etrxr3iudope licslt)srrrxrpou0texo fciysfaDuaumont4artoxrctotlaD livsls)teurim oydllee nvsl( sDtr(rp;u1teeomi3tyslmDul(vsn()texrmociatop r n il() 2toio no1alee fvtls  2ur(monu4oetoifetldfsDean on() eenircoatfp rau i;t)srtoxo3nodal e ivslt)artmu  ;u1apeo i3iad mDuanvp;u4tlerxf3tytom  aues;s0srxmio ny4am  lies () Duaxronu0aexo ieiad a2raumsnu0arenxrcio1omteaivslt0 rurim3ny1ap emfetls srua( pnt4optoiiciatlm ea( o (4texrir iotopteluvs s t2xoxo oo4ap nlfes t  rrrxmpou1oetomociltfa emnvp;u) eeriociatlmD aivo (0 rxm(m3ou1omtnmies t) rua(  nt0tee  octltfm2ea( pn(4arxoxfcto1fa elnvi;t setr(mpoudol emncs t)s2ra(rpnt4olt mf3iysfa em(msnu)aexrmf totlpt au s;(0srtmim3oo1lme mnct (fsDraum no0aetn fciltfaDumnvs;(0 rtrif3iydlpDelieol(0teumxr ny1ll  lieta( a2urx o;o1oeeo fciyd s um(mpnu0 rtoirciytopDeai ilt texmxopiydame licsatfartru  ou4olt  o3tyd s um(vo (4trxoxo to1fp eln olt) 2urxm io4altnlivi s) rur(  ou4oee mfciytlm2uanmsnt) etrmo tatoat lneo t srxmim nodol  lfcia()sDuaur ou0opx mictytfs rmnmon(4 ltnxr tatopDeanvo () 2umxo iodope lfeilsf Drrxront1aex miciydlmDrmu snt4 lenxocty1fpDraivi;s tetr(m nu4lpen ncsa(f Draurooo4oexn o3iydla um(monu4trtrmr3oo1omte ies;() rxrim oy1optemneilt  rtrumooo1tlx  f3ild a2emnvs t) rtrmo3oo1omDe uvil()s2um(mpoodal  miesas)arrrur nu1aexn iciasfs um(vp;t)aexnmrcoo1oaDeln i t trurir3io4lp  liesl(fsDtau  ;o1tpx  i3iydla ranmo u0 lxrmr3tydlpt  ieils t2uo(m3ny1om e nct t)a2uaurono0olxomo3tlt aDrmnmsn(4 lerif tytomDran s ()srtoir3oydlme  nvtat)sDtm(r ;o0tltoio3iydfsDuanmont4aetrmr oadopDr uei s sexrxr3ou1ap e ietat  2ua(root4alxoifctat mDeln s;(0teerio3oodop eanei s0 etrxrpiy1om n nvt ()a2rmumonu4tlenmfctlslm2emu o;(0tetnircoa1faDeaiei t0 ruoxm3iodlp n fei ( aDum(  ;o4tpx  fetlsla2ulnmo;u)trtnmr oytfmtrau s t0 etoxr nodamtelictasfaDraurpou0tpx ii3tls a um(mp u0trerxf3oodla rlu s;t)teuoxrpiy4omeemivil()aDtru onu4alenifetldfs2rln pnu0 rtnmociytfmDelnvo;( trur(m3ou4ol   nctls sDtruro;u1aetn feiysfaDeanms;u0 etrir3oa1lmtranei s)trum(rpiodoptemfvs sf ruaurpnt4alenmfetld a2el( s ()aeeoxo3ta1la  anvilt t2umimpiy4lp  mfesa(fa2tax pno1oltn iciatfm u
\ No newline at end of file
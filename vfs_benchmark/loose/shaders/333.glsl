@@ -0,0 +1 @@
+u i s trumxr nodap emncia( arrrump;t1teenmietadfm ul(vsn(0 rerio todlateanvs t teuoirpno1alen nvsa(f 2taurp;u4aexo i3tltfaDrmnvp () lenio3tydlmt li il(0t2xmxo3nydlltemici s)aDurx  no1oee moeiltlm2ulu s;t4 ltnxo3tatfaD ai s;t s2xoio nu4om elnvsat) rrrum no1tetomfeiyd mDrm(vo ()artrmr3ootop rlneil(0s2xrxmpny1om  mneslt)a2rr(ront0tpto fciytfa uanms t0altnmrciodlpDrlneilt0t2xm(m oo1lmeeliet ( srururont1tpxn ociyd aDua( pnu4trtomf oadfptelu i ( srxoxrpoy1lptnlfesat  2urxr ;u0tpxnmf3iyt a2eau p ()tlxnmocoy1lp  au sls texm(mpoy4ale  fei ( a2um(root4apx io3tas aDumnmo;()tlenxf oadlateaiei ()s2xoxm iu1lm emicil(faDrm(  oo1oltomfeiat a ulums;(0aetomo3todoaDrauvsl(  2urir nu1lmenlivs sf rum( o;o0tex  ieilsla2ra(vo (0aeenmo3io1laDran i;s srtoxr ny1opeelivtat) rtaxmpno1tlx  o3ildla ulu s t) rxrmf oatop  anes t0trum(mpiydll n fetls sDraxmp;u1olenioetaslsDrlu pnu4artnmf oydfa  au s ()texrxmpiy1apenlnctas arua(r nt0oexn o3iydlmDum(vont)texriocto1fpD lu o;t0trxr(rpoy1al nlictat)srrr( o;o4aeenifeiyt a eln o t0artoir3iotlatrlnvo;s0 rtoio3ny4lpte fct sf 2rr(rpnu0olxnmi3tls m2rmnms (0tleomfciotop   i i s srxrimpoydll  liesas sDtrxm ;o0tltn oeiydfa rl( snt4arxrmrcoy1op eluvi t)teumim io1ope mies (f Durxm no1oetn o3tasla2rl(msnu4 renmo iodoa  an s;s trtrxo nu4ll  mnvil(f Draxrono0tlxniociltla2ran p u) etrif iytfat  nvo s srtoxr io1amtemfeslt) rur(roou1tetn feiydfm2elums (4tlxnioctadoaD aies t0srxrir3oodomtnlncs tfsrtaxm no4teeomf3tlt aDumnmo u0 rtnxo ia1oaDr uei;s trumirpiy1amee nviasfs2tau pno0texnmfeiltfm2rauvp t)tlenmociotom e uvo (0srtm(o3oudam nmnetl(  rumu pot1oeeo ietydls2em(vp;u0tltrxr3iy1lpD lu i;s0t2toir iy1amenlfcils  2rrurp;t4tleo f3iltls eanmp;u0aexrxr ty1fa r n i () 2uoirpno1ol e fetls)srurxr ;t4apen i3tltfs ulnms t0 eeomr3tytlmDeaueilt0sexrim3iodomtelncsl()s2tmx poo4aeeoiociadfsDran o (4altoirctytoate nei;s)sexo(mpnydome  fvsa( sruax  nu0oet ifciytfa ua(vp u4 ltnxo ty1opteanei s)t2xoir oy1lptn fcta()srum( ooo0apt mictaslsDemnvpnu)trtnxf3oo1oa   uvs;s t2xoirpnu4al nlivsas)a2urxr ot0aeenmietasfmDulumpnu0aeeoxfcia1opDeauvo t0trxoxm oydolt  feil() 2tmuronu0tpto f3tytlm2emump (0tlenif tadfmDrliei ( s2xoim ou1lm e nvi t)artrumont4oleniictasls ul(vonu0 eermfctotom elu o s0 2xoxo nydllee nesa( srrmum ot0oetnmfciatfmDua( p (4aeerir ia1fmDraivi t0sruriopiydlpt mfcias aruaumono1texoioeildfs2rmump t)arenxf3iy1oa eln i;s0seto(opnu1olte ieslsfaDur( o;u1tpt ioeiatlsDuluvon()trtoxo oo1lmDelues;(  2toio3nudol  mfvsas  2rrxrpoo0apxnmiciydfm ean pnt0 ltrifcoo1oaD livo t) rxmiopnu1oleemiesat)aDua(m ;t0oetomoeiat mDua(vo;t0 lxrxrcoo1lmteluvol()trtm(rpny1lpeemnciat) Dtmurpoo1oeeoifeiltfsDuanvs u0aetnxf3ta1om ran sl( s2tmio iy4llenmfcsa()srtauront0oee  i3tas s raumont4arxrmo oydfpDrlu ols teurir3oo4lmtnmict ( aDtr(rpot4tet mo3iat mDeau p;u4treoio oa1oat au i;t) exr(o nodopee nct tf rtrur nt4opx mo3tad s elnmsn(4aetnmf oatlpD au il(  rxo(o oy1ame  ictas) rrmu  ;u0tee ii3tys m eauvp;t) exnxf3iytop eaueslt t2xm(m oo1om nlfcslt aDra( p;t0tpx  oetlsls2raump u)trtoio iytfaDraieo;s0 2umxo3oo4ll n nvsas  Draxr ou4opt ii3tys sDra( p;u) rxrio3oatfmt lues;(0 euoxr nu4oltn iesat) Dtaumpno0opx ioetasfs2ua( onu) rxnmo todfa e i o ()sexoxo3oodolenmnciatf rtrxr ;t1aptoiociltfmDumnmo;u0 ltnmo oytoa r nvslt  rtoxr3nu1oltn iei t  Dta( oot0alxomf3iadlaDrlnvsn(4tlxoxo tydlm eau s;t0sexr(m iodop e ivsa(fsrur(r no1tpeoifctlt aDrm(monu0 rtrir iydomDeln i;( trxrxmpou1ll nmfesatf 2urxront4tleoiictasfm eln s (0teeoxfciytom  aiei;(0 2xm(r oy4ape mfvsatfs2rmur ;u0tpe mfciytfmDelumo;t) lermrcoytoa eaieo (  etrxo3ny4apt lfesls srur(m nu0oeen i3tys m umu s;u) rtomf io1fat ai ils)seurxr3oudam elnes s sDuru  nt0aet  fciydlsDea( s;u)texoif tadfptelivs;(0 2uoxm3nudolee nvt ( srrmx oou1tee mfciydla eaump;()teenmo iatlpDraivs ( seuoxr io1lpte iei t arurum ;u1tex mieiytlmDel(mp u) etomo3oytlptranvolt  rumxo3oo1om nmnct s  Dtrxmo;t4oetn iciat s2ua( snu4 ltomo3oadlp  anei s setoiopiu4ol n ivsa()a2umx p;o1openmictasls uauvonu0 exnif3iydfate n ilt s2um(r iudom emneils arrr(rpnu4oetomi3iyt mDua( s;t0tltrxf3tadlmtelues s)t2xmir ny1optnmnci s aDtrxronu1apenmieilsfsDul(vpnu)aeenmfciodlmDelu o;(  2trir nudlm  lfvt s  2rr(mpoo4olto fetytlmDrm(mo;(0 rxrioctadla r uei;t sexr(opiu1ale lfcslt) ruau  ou4opxo f3tadlm em(ms;t0 rtnif3iadomtr ies;s)texo(rpoudoltemict s a2tr(rpno4oltnmociysfm ran s;u4 reoxo3oo1omDean o s0teum(mpny4lmt lnesa()artau ooo1oeenmoeiyslmDrmnmp t4 exrir3to1la eauvo t)s2trxm io1lmee fvs t srururo;u0oex  ietasfm ulnmo t)trxnxo3ty1lmtranes;s)texm(opiodllee nvtl(f Drmxm ou0tpenmiciadfm ul(mpnu)tlxrmfcta1lp e n s;t)trxo(o3oudomtnlict t srur( pou0opxo f3tytls rlu s;t) rxnmo ty1omtelivils0srtmxo3oydlmtnmnvsas) 2tm(r ou1oee mf3iatlmDeluvon(4 eermo3iytfaD  iei (0seto(opiydaptemnes t a2rrur oo4aleo ociadlm2el( s;(0 eenmr3oadlm  anei;s0t2xrim oudomtn fesas a2ta( o;u4olenii3iysls uanvs;t)aeenmr3ia1lmtr n i;( s2tmim ou1ll   nei s s2tr(  ;t0tpxomf3iytlm rauvp;(0trtnxfciotoa  aiei;( t2xo(m3iudop e ivil(  rrmur ;t4opxo iciydfm2uan snu4tetnmf3iydlpt  nvo;t)t2xmxr3io1lmeemnesa() 2tru  no0tlxoiieiydlaDeanmo t)arxrmr3totom elieo;t0 rtoxm no1llenlfciatfa2urxr ou4olxo f3tls sDum( p;(4 leoxo ia1fmte ivs;( srurxm iu4opte fct (  2ra(m ;u0tptn i3tld m umnvp;u4alenmo3iytfaDe uvs;()setrim3iodaptnlict s  Drmxmonu4tet ioetat s ua(vp;(0aexnxr tadlmDrlneo t0 exr(mpoy4apt lfct (  Dtmumo;o0ope moetadfm rlu o;(4 etrirctadopDr nvi () ruoxo oodlme lfes sfaDra(ro;t4opto i3iytfa2um(mpnu0tetomo totlmDelues s0s2uoim3ny1opeemivt s) rrr(mo;u4tltoifeiadfm el(vo t)artriocoydlmDeluvs;s)seuoxmpno4lmt  net t)srra(r ;o0tleoiietyslsDelums;(4 ltnmr3todfm elnei;t sexrxm3iy1lmtelietat)sDumxmpnt0ope ifetas s2el(vo;() eenir3oo1omDe n slt  2xoxo oudapt mietl(  2umxroot1aexn fetadfmDumu pnt)alxnif3ty1fmDeanvo (0t2um(m3ny4altnlnvs s s2rmxmooo4texoioeiatls2uanvs;(4tetoxf oatfaDrliei s0srxmimpio4omee fvilsfa2rax  ;t0altnmoctasfmDeau s;(0aexrifciadfm eanvo s0trxrio3ou1lmenmivt ( srumxrpot1apto f3iyslaDem(vpnu0 etrmo iotlat an sls)seum(o oydlm   iviat srtau ooo1tet iiciyslmDra(ms (0 reoifciadla eauvi t)tetoxmpnu4omtemict s sruaur no1texomo3iltfm umu s;u0alxoif3oy1omteluvilt) 2xmirpno4oltnlnesl() Drr(ronu4ole ifciatfa umnms t)trxriocty1lp e ieil(0sruoxr3oy1ame livia(f 2tm(  ;o0tlxo icildfa2uluvs;(0tetrxo3oydlmDrlneo t0s2ur(r oo1aleemfctas  Dur( poo0tpx  ictydlsDrmnvp;(4aleoxf3oa1fpte nvs s0sexmxr iu1omt mfcsltfaDrrxr nu0apx ioetltfs uln sn(4 ltnmoctytlpD aues t)truoxopnudapeemietlt  Dtaxmo;o4tpeomo3iltfm2uluvs;t4texnir oy1fat au s (0trurxm oodolenmfes ( a2ururpnu1olxo i3tys m ulnmo u4 rtrir3oatfm elies () rxr(r no1ap emfvsl(  rrr(  nu1tpxo ociltfa ulu s (0artnif iotfmDr nei (0 2urio iy4lmenmfcils sDtax ono4aet iiciydfa2uau on(0 ltoifctatfptelieilt0 2xr(m3iu1alt micslsfa2tau pot4opt  ietaslaDemuvonu)artrif ta1fm rauvs;t)setr(rpoudlpt  fct t  Durur no0ole ifeilt mDel(vs;(4 etrmf3oatoat  ivilt  2tmxo3iu4alt mnei () 2rrump;o1tptn fciydlmDrmn on(0teeomo3oytlmDrauesls tetmim iy4lpee nvtat  Drru  ;t1oltomi3iltla2ua(vs u0alxomf iodfa eaneo (0srxm(o3oodomtnmfeia() 2raumonu0apxnmfetytfm2rl( o;(4tetoio iadopteluvol()t2triopnu4olte ncsa( a2taumo;u1tpto fciltfa2uau o;()arerif iodlatean o;s) etrio3iy1aptnlnvi tfarumxrpoo1tleo ietytfa rlu s;t4artomr ia1faDr ues s  exoio3nodamtemiesls aDtrxmooo4tptomieiadfmDul(vpn(0trtnirctotomt lu i s)srtmxo3no4ale  ivi (  2rmu ont1tpeoiieiasfm ulums;(4alxnif oy1omD livo;(0 rur(m ny4lleemfeils  rum(m ot0tltoiieiyd a2eln o t0 exnxo to1lmDrlneils seumir oy4lmenlnci t s2uru poo4apx  i3iadlm rmumpn(0 lxrio3iytlaD  n o;t0 ruo(rpio1optemfci () rrmx p;u1alx  fcildlm2uaums t4tltomf ia1lptelieils0trxo(o3ny4ll nlnvia( sDum(mono4oetomfeiadfm2um( ont0tetnif3oadlaD au o;s setr(opno4optnlnesa()s2trx p;u4apxnmi3iltfs rmn o () exrxo3oytfmD lnvo ()seum(rpny4apen netat s2rau pot1tpt ii3iat sDulumsn(0tleomf ta1oatrau ils0s2um(m3no4lm nlfcs sfartrxm nt4tet ioeias m2el( s;(0aetrxr3oytfa rlieo (  rtoio oy1ole mfciasfsrum(  ;o0ale mfctasla emumsnt4trerxf oadlm   iei t  2xrir no1alte fvs t sDtr(m ;o1alxoiietasfs2em(vp;(0alerxfciy1op  livs;t0setrir3nudom elfct s  Dum( oou4alt  f3tldla2el(mont4tetnxo iotfat livo;( truo(rpiydlpte nci t)srurxrpot4tpenii3iltfa uln s ()tltrxrcoadfa  lneilt)texo(o oy1om nlies ( a2rrx onu1ole  octlslm um(mont) etnmr ia1omte ues t0 etrio3nu1ape lies (  Draxmooo1oltniietas s2ean o;t0tlxoif3iy1late neil( seumxmpoo4aptnlictat  2trum ot4olenio3ilsfa elums;t)teenxo3iytlpt  ueol() ruoim3iu1al nlnvs tfs2tr(m nt4oet  i3ilslmDem(mon(4aexrio3oydomtrauvi t) rumio3iodam elnci ( aDumxr no1tlxnioetldfa emnvp;u)texnif ty1lateauesl()sexmxrpno1lpt mfvtlt) 2ua( ont1oexnioeiyd s2eluvsnu0tlxnio3iadlaD ln s;s) etm(r iydlm  lies t  Drrum ou0tlt ii3tltlmDeanvsn(0aetoxr3iadoatr u s;()t2tmxo3oo4lpe  fctas)a2urxmoou4tet ifeils m2em( o t0arenxfcoo1lm rlueo ( s2tmxr iy4omt mfeiatf 2tr(ront0tpx mieiytlm2em(ms ()tetnxfcoa1fpDelu i s0trxm(o3iydome lnesat aDtmu  ;t4oeeomi3tlsls ulu p;u) eeoifcoadoa  ai o;s t2trim nydomenmfcsltf Dumumpou0optnmfciyd a2umnmsnu0arenmociy1omt anvols trxmio3iodll e ietl() rtaurono4opxn fciatlm rluvs u0 lxrmr iydlatrli i t)trum(m iodol  licslt sDuau p;o0tleo oeiytfmDem(vpnt4 eeomr iatom eanvi s) eur(o iu4ll nlivslt arrru p;u0oet iiciydlmDeanmpnu4alxrmo3tatfp e uei ( tetoxm3ou4lmtn ivi (  Dua(  nu0teenmi3ild a eaumsn(4arenxo oatfpt auvs;s)sexo(mpoo1ome mies t  Drmxro;o4tpeo oetlslsDrau s t0altrmocoo1fm e uvi;s)s2xmim ou1ll   fes t  rumxmpot4tltnmietld a ean ont4aetoif3oydop  ai sl() etmim3no1lltn iciat)sDrr( ooo1opxniicilt m ulnmsnt4tlxnxfcty1omD  ues;t trxrxo3io1opeeliet t)a2tmx onu1tetoio3ildfaDeanvo t4texomocoodlaD aues t0trxr(o3no4olt mivi sfsrrrxrpot0tetnmo3ilt m ua(ms (4tetnio3ta1la r u s ( truoim iy1ap elieilt) 2trxr ;t0oee  oeiatlm2emuvsnt)tleniocta1lm   i slt) 2xoim io4lpte ics tf Dtaxmp;o0alx  ieiatlsDumu s;t0 rtrmf iytlaDran ilt0t2xrxr oodol elivsasfs2trx onu4oltn octltfmDrl(vs t0 ltomrcio1fa   ivi (0trurxo nu4apee ncsatf rtmxmonu1oleomfctasfs rmuvo (0arerxfctadlmtelivi (0 rtm(r3nudlpeelicsa() rtaum ;t1ale  feildfsDea( o t) eerxo3ootom e ivs s)srurirpiy1lmtnmicia( aDtru pou4olt  iciyt m2eln sn()tlxnir3iatopte uvi s)s2trim3iy4lp nliet t aDua( poo4oetnmieiatfm uan o t0texnmrcoadfa  li ols) rtrxo io1amtn ieiltf 2um(r ou4tle if3iat m el(vonu0 lxnmf3oydlpDeaneil(0s2tm(opno4lpee ivil()s2tax  ;u0aetnii3tysla2uanms u4 exriocio1fp e uvs s0truo(r iydopeelneilt)s2taumpno1olx mo3iadfa2ra(vs (0 lxrir tadomt lneol() 2tmir nudopt lici s)srtm(m ;t4tptnifeilt mDeanvp t)tltrmfcoydopDe n s;s  exoxr3ny4olenlivsat srrmxrpot0openmfciyt m2raumsn()tetnmrciy1oa eaivs;s) exo(mpou1aleemnvsas aDuaxr nt1ape  fetlslm2rauvpnt)aeerxr io1fmtr nvs t0t2xoir nu1alte fesasfa2rrxm nu0tptomoeiyd a2em(mo u0 lerio io1fp r uvs;()srumxo3oudolt lfvs (farta( pnt1oexnmociltlsDemnms;()altrxo3oo1faD  ies;s)s2tmio3no4lme  ieiat) 2uaum ;t0opto oetatls2elnmo (4areniocto1lmD lnei;(0 rur(o ou1omee fci t sDrr(m ;o4tpeo octltlm emnmont0alxnmrcoytom  aneol(  2xrxm oodomtemietl( arta(m nt0apeoii3tldfs rmnmpnu4 lxoxrcoy1opte nvils)srtoimpoo1lpe mfeiat) 2rrx  ;o4tpe  ieiydfa umuvp u0 rxnxr3tadfmtrln il( srxoxo iu4amte nvils srtrumoou4tlxo f3iydla2rauvs ()texoxo3tatlp rln ils sexo(r3no4omeelicsasf Draxrp;u1aee moeiydlaDum(mp t)tetoxr3oa1fpD  nvsl() rtmxopou4omt  feslt)arua(r oo0apeomoeiad m ul( snt0teerif oy1fpteaneo;t0s2tm(m3iodamt  netat  rtm(m nu0tpt mo3tadlaDemn o u0trtrmo oadfpDr ieols0setmim3nu1apte iesasfarrr(rpot1aeenio3iadlsDemn p t4arenmr3tatlmDrlivo;s0 ruoxopnu4lp emicsas)a2uaurp;t0aptomf3iydfsDran pnu) etomr3io1lmte i s;t setmiopoo4optnmnvilt)aDrauront1apeomieiat m ra(ms u4tlxnxo3iatfpDrlnvo s  etmiopoy4opee icsatfaDraur ;t1apeoio3iadla ua(msnt4tlermfciy1la e ivo t0setmxopou4omte ncta(faDururpoo1oleomictaslm2eluvsnt)artrif3ta1lmt lnvs ( s2xoim3nodlptnlneiasfarrr(mp;t1apx mietysfaDrmnmp u0texrxr oo1fptelnvols) rtoir iu1apee ivs s arururpnu0aet ioctys m2rau s u)altnmr3tytoptrauvsl()srxm(m iy1ol e fvta(fs2tr(moot1optoiictyt aDrmnmp (0 rerirciotoptraueo;t)trtoxrpoydlpte ncil( arumum nt1tlt  fctaslm emu o;t)aeermr3todomD  nvs (  eumim ny4ame lfesl( sDurxrp;o1olen i3iytfs2rln s ()trtoxo iy1fmDrauei;( srur(r3oodamt miesa( a2tax pou1olx mf3iasls2elnmonu0 renircoodfmt aneo;t)seumxmpiudol n ncias)aDum(r oo0tlt  f3iad a2umn p (4tltrxfciy1op e ivolt0s2trxr ou4ame lnvsls  Dra(rp;t0ope ioctasfa umnvs t)areoxo3io1faD  uvo;s  etoxr oy1lmt  iei s aDurxroou0aeen ietytfa uln o;u)alerxr3tydomD luvs (0 rur(r iodam  mfvsls arrmxr no4altn oetatfaDemn o;(0texrxr oytoptrauvi;(0s2uoimpio1olt lfcsasfa2um(  oo1tptnioeiydlm2um(vs;t4artoxr ootoa r i s;s)trxm(mpiu1lp emfvsat a2tm(m no4texoif3iysfm2umnvo;t) ltrif3oa1lmtelies;t)t2toir iy4apt mivtl()aDtaxmpnt0texnmiciasla2uan s;t0 rtnir ty1fp rai o;( srxm(o3iudomtelfcsltfaDtmxmp;u4tpt mfctltfs2umnmp;() eenifcoatlpt aivi t0texmxmpnu4ol nmnes tf 2rrurpou4opxomf3ildfs2ea(vp;t4 eenif todfmDeaivo;(0 2xr(mpnudaptnmneta( srra( pot0tlxnmfciasfsDrmu p ()tltnxf tytlateluvs t tetrim3nu1aptelfcs t s2rmum ;u1oexo octysfa ra(vp u0tltomo3tadfmDrauvi (  rxo(rpiy4lptnmnvs ( a2rmxm nu0tlt moeiys m rauvon(4tetrxrcoo1lpt li slt0 rtm(m io1aleelfei (f Drmuro;o1apt miciasfm2rluvs;t4 eeoir3oydopte i s;s)srtrirpny4apt  iei t) rurxrp;u0aexnmo3ilsfm umnvon(4arxnmf oa1oaDelu s t  rtr(opnudam elnvsatfsDraumono0tetnmociasfa2uauvpnu)aeeoif3iodlm rlu o;(  rxo(m3oodlp  mfvslt) 2rm(moot1aet mo3iltla2uluvp (4tetrxf totop   ieo;s)teto(r3nodamenlivtlt)sDtax o;o0oetoif3ilt aDuluvp;t0 eenxf iadfmDrauei s)truoimpoo1lm e icsls sDum(  no4tpxomo3tytfs rauvp u0 exoxr oytomD  i s;t)sexm(rpou1lm  lieils arrm( ooo0oexnii3ilsls rl(vsnt4altoxo oydopD an o;(0 rum(o oy1amtnmnvtas)srum(rpoo4aet  ictldfs2raumo;(4 eenircta1omDe n i ()tetoio oydopen ies t)a2urxr ;u0tlxnmf3tlsfa ulnvo (0 exrxrctytlpD  ueo s teurim no1optn ics tfaDum(mo;o1altomoetysfaDeanvs;(0altrmocia1lat aueols) ruo(m ou4om  mivt (fsDtaxrp;o0openiiciyslmDra( pn(4alenmf oadop   u ilt)teurxr3io4lmt mici () Dtm( poo1apx  fciysfs2ran p;u4teenmr oadop raies;s) 2tmim oudolte ncta(  rtm(m ou4olenii3iasfs uanvo;()trtoifciodomDeli o t)s2umio3oydoltn ieil()aDtmxmpou4oex ioeilsfs el( s;u0 etrmr oytoa  ln i;s0trxm(o io1alenmnvilt  Dta(mo;t1aeto oetyd a2emumpn(4treoiociy1fpt  neils  euoxr oy4apt lnviltfsDtax oou4opxomietydfm rmn p;t0 rxoxrcoatom  aivsls  eurxr ou4open ictl(fsDraxr oo1olt  i3iatfm uln s t)tlxrir ta1faDeaues s0setoxrpio1op   nvil()s2rmump;t0tlt mietas m2elums t4aexnxo3ootopDrlu o t) 2uoim3ny1omtelfesasf rrm( oot1olxomi3iyd mDemuvo t0trtrxr tadla r ivo;( s2tmir io1ale  fvs ( srrax pou1teenmi3ildfs2uauvs u0alxnir3tadfaDrli i t tetoxo3ou1amenlfesls)s2tru  nt0aetnii3iydfsDeauvsnu4areoxo3oa1lm r nvol(0 rxrxrpoy4op  lfvtlsfsrumx oou0teen ociasla rmnmpn(4tleoir ta1fa e ues;t) rumxo no4lm nlfvi t)s2tmu ooo1oee moctldla ul(msnu)aeenifctydfp eauvi;s0 rum(r nudale mici ()sDum( oou4oetn oetldfmDel(mp;(4 rtrxo ia1optran s;s0 rtmxo ny4llt mneils artr(r no0aptn ieiadlm rmn snt)tlerif iodfp  auei () rurxo3nu4lpt  fvias arra(rp;o4oeeniicils aDuluvo;u0alermo iodlaDr i o;() rtm(r nodlm nlieiat a2rmurp;t4aet  fciat a2rln onu)tltoif3totfm   uvslt  eumiopno1llte ivi s  Dtm(mont1olxniociaslm2uaump (0 renmrciydomt aiei;(0seumxo iodllt mfctat) Duaumpoo1optoioctlslmDem( p;u4altrif ta1fpt li sl()tetrio3oo1om nlfci sf Dtaxrono4teeo iciadfa emumpnu4tltoir3ia1oa rlnvs;()tetmxr oo4op  mivtat)sDtmx oot4aexn f3tyslsDrauvpn(0texrir ootoa  lieols  rtoxm3nydomt mivtlt sDra( pnt4apxomoetatla uluvonu) rxomfctytfa  lnvol(  ruoxr3oydalee icsas srurxmo;o4tpeoiietys s ra(vpnt4 lxnmr3ty1fptrai ol( teto(opoy4lptnlnctat)a2umur ;t0tpt  fciyd sDel(ms t0alxrmr iytoaD  ivo;s srurxr3iu1oltnmietls  2rmxm oo4aetn oeiatfsDean p t4 rxoirciydfaDrli olt0trurxr nydam elictl( a2rax  ;o0alto ieiasfs2rm( s;u) eenifciydom eai s t teuoxm no4ll  lnctat)arurx  ;u4apxoiicias mDean pnt4tetnif oa1op ranesls)t2uoxr nodlme liesas) 2umurpno0oeeo f3iysfm2umu p u4trerio oa1lp  aies s  rumxo3nodom   ivtl(f 2trum ;t4ale ifciasfa el( o;t0 lenmf3iytlpDrlu o s0srxmimpio4ape mnvslt) Draxmono1open ietytlaDumn snt)alxoio3ia1oat lnei () exo(o iudll nlfvi sfa2tmump;o4texn fciys sDrmumont) ltrif tatlptrauvs;s0setr(r3io1aleelneil(  Dtm( pno0texomo3tytfs em(mont)tltniociodfa rln s t0s2uoxmpiodllt  nvslsfs2umur nu0olt mo3iydla uln s (4altoxf3oo1omDean o () 2umxo oodole mfci ( srrm(m ou4opxoif3tlt s2ua(vpnu)areomf oytoptr neslt) rumxrpoy4amt mfvsa(fa2raur nt4apxnifeias s rm(mo;(4trenio iydlmDe neo s) exmxr3iy4lm  lfctas)arrmum ;t4tlxoiiciytfaDumuvs;t)trtrxr oatfmDrau s;s  2tmio oo4ale lnctat aDrrumono4tlx  feias a eluvs t0altnir io1fmDeaieilt0setrxo io4opteliciat) rtaum ot4oleoii3iys sDrln s ()aeerxo3oodop   u s s s2um(mpiudolte nes ()sDumxrp;o0optnifetadfm eauvsnt0tetnmo oadfaD aiesls trxrxrpiydlltn ncsat)s2uaxroou4apeo oetyt sDel(mp (4 leomr3oydlmDeauvols0s2tr(opnodol nmiesas a2ra(ront1altnio3tydls2rmn o (4tlxrif iatlatr ivolt0srxmir iu4lpe mietlsfs2rmu p;u1tltnif3tysfa2emnmpnt0areomf3oadlateluvo ( srur(rpiu4am nmfct s  Draur ou4oeeo f3ild mDumu on(4 ltrir3iy1faD lu o;s)srumim3iudam n fvias)sDuax o;o1tleomieild sDrm( pnt4arerxf tatlpD  iei;(0 etmxr no4lme miet ( aDra(moou4optnio3ias s rlump;(0 ltnifcty1lat  ues t)srxrxo3oy1opt  nes tf ruru pot1tleomo3iaslsDeanvo;(4artoif3tadomt luei s)s2uoio nodamtnlneiltf rraxmo;u0tpe  o3ildfa el(mo;(4aetoioctodom eau olt)setrxo3iydam elies ( a2urur ;t0aexo i3tadfa2uauvsnu4 lxnmo oy1op   ieslt  etmxm3no1lp n ietltf Draumont4altomfeiatlaDrl(mon() lerxf iadfm  au ol(0seur(r3oo4lmeelnet sf rrrum no1tpxomociltla2ra(vsn()tltoif3to1op e ivs ( srtmxrpoudlmte fvsas)sDrmur ot1tlt ioctltla2ul(vo;u)teerifcoo1faD au s;(0s2trxmpnu1altn feiltfaDrmum ;u4tee ii3iadlm rmu o;() rtnmociytomtr nvo t0 2xoirpnudlpt mfeiasfs2ur(mp;t0oeeomfctasla2uanvo;t)trxrmo3ty1fmtr nes;s0t2tmxmpiudal  mivils aDraxronu4optoiietadla2rm( p u0tlxnmf3oodoaDr n o;s t2xmir oudlm nlieilsfa2tr(r ot1apenmo3iad a umnmpn(4texomocoytlm  an s ( setoxm ou1ap nlfvtasfsrtrxrono0aeeomictytlm2rlu p (4tlxrmoctodopD  i i ()t2tmimpny4openmnvi t) rrrum ot4tleomietatlm2ranvon()tltrio totfaDr nvilt0teur(m3iy4lmtn ies t) Dta(mo;t0olxoiicias a ulu o u)aexrxf iydlptrluvs;t  rtr(r3no4alen ncsatfsDrmurpou4alen o3iat sDua( onu4teenxr3tytlpDraieols texmirpoodopeemfes (faDurx  ;t1tltomo3tysla ea( snu0tltrmo3oo1lp  aues;t s2umxm ny4ole lics ()artmuro;o0ope io3iytfa2elnms;t)tetrif3totoat  ues s t2uoxo ny4alte neias  ruaxro;t0aexo o3iysfa2rm( ont) lxomo3oodoptraueol()t2um(mpou4om   nvtlsfsDrm( ont1texnifctadla2eauvp u4 ltrmo tydlm e n o t0trumxopnudol nmncsls)aDrmur no0alxomo3tys sDeanvs;() lxrifciytlaDr u i;s0trxm(m3no1oltelfes sf ruru pou4tee mfeiadfs2rm(ms u0artomrctotfp eau sls) rur(o3iy4lleelnci tfsruax  no4opxo ieiasfa2rauvonu4 eermfctotom r uvs s  rto(r oo1lleelfctls)aDra(m oo0tpto ictatfs2emuvpnt4arxnmr3iydlpteaueo;()srxo(o3nu4lle  ivtatf Drm(r ;t0apx ioeiysfs2umu p t4artrxo ta1lpD  n s;s0truoim nu4ap n nvt s) Dum(rooo0oetomfetld m2rl( pnu)altrxr3oatlptelnes;s0 rto(r oy4llte icil() 2rax p;t0tleo o3iltlmDuln s;u0 renmocootfp   ueil(0trxr(opnu1lp nlfei tfaDra(moot4teto f3tld m2el( pnu0artoxf ootfpte i ol( srxr(o oodom e icsls)aDurxr ou0texnioctydfsDra(ms u0 rxrir iydfptean ol() 2xmxo3iu4ale mnvi t s2trx  ;u0apeoifciyslm ul(mp;()alxomr ootlpt  i s t) 2xrxm3ou4lpeemnesat)srtax p;u1aexn i3iatfs2ua(vo;u)tetrxf ootfmDrlnvi ( setoxmpoodll n fcs t sDtm(  nt0tetn fcilslaDea(vsnu4 rtoxo3ty1lp elnvilt)t2xoimpoodll nmneslt aDraxmpoo1optomfeilslm2rmu o;t)trenmr3oo1fp raues;s0srxm(o3io4optemncilt)aDtaxmoot4apx mi3tyt m2rmnmo;t0tleoxocio1fmt  i ols tetm(o3iydole mnesl( aDuaur ;t0tetnifeild m2ua(vs t0 exnir iydfmD ln ils t2uoxr ny1lme  nvtat  rrrxmpot1tlto o3iasls rmu snt)teeoxrcoy1lpDrai i;s) rxrxr ny1ope mfesls) rtaxm ;o0tpeo f3tldfsDelnmpnt0 etnio iodfp ranvils0srto(m3iu4ap n ncs t) 2ua( p;t1tltnifciasla2eaumo u)alxoif3iy1faDrlies;t)sexr(m ny1omtelivt s)s2rmxmpnu4oeeoif3iasfs2uanmo t4 ltnircio1fpDr i i;t0 2xm(m3oy4lm e iesltfarrr(mpoo1aex if3tatfs ea( s;u)tetnxocia1fat  ivs;t0tetmimpiudome lfei sfa2uaxmpnu1oee micilt a eanmsn(0 rxrif tytfa e i s;t)srxr(rpno1lp n fvtasf 2tr(r ou1olx mf3iatfmDul(ms;u) lxomf iotoaD lu i;(0s2uo(m3no1omtelfesa(  Dtm(mpno1aexn f3iat aDuan snt) rtomrctytlaDrlnvi t  2trxo3oodaltnmfctl(fa2ururp;o0tlen o3iytlsDuan o;(0arxrmo iy1lpt auei;s srtm(opny4openlfes t)aDra(mont0alxniiciyslm2rmnmo t)aeenio3ootlpDr neo;s) 2tr(opou1lpteliet t aDtmu ono4apenmi3tatfa ranmsnu0areomr3tatoa r nesl(0srxrirpny4ll n nvt tfsDtm(rpno0oltnmi3iydfs emnvp u4aetnxr oy1latr nvi ( sexmxm oy1lpt  ivtasfsrrrxm ou1tex ii3tytlm ulu sn(0aeeoxr iadoptelueo;t) 2xoxopno4opeemiesa( s2truroot4alt  oeilsfa2rln ont4trtrmo iytlate uvilt  rumxopnu4lmt  ivsa()sDraumpnu1teen o3tltla eanvpnt0aleoircootlmDelieol( tetoxm no1omt mfvs tfsDurxmp;t1aleo feils sDrl(vo;u)trxrio3oytfa  li o t  ruo(r iodllt mnesat)srum(mp;o4oexoioctyt mDumu p;u)tlenio3oodom elues t)setoxmpio1ap  lfcs s  Dtrx p;t4opx iociadfs ranmp (0trxoxfcoytom elneo t)srtr(opiy1apeemncsl( arrrum ;o1apxo ocilsfs2umu snu4 rtrmf3oydlmDe ueol(0t2xmirpoudam n nvi ()arua(m ;t0texoioeiadfs rmu snu)tlxrxr todlaDr nei;t)teum(m3nodaptnliciasf 2trurooo1olxnii3tad sDuau p;t0teenmf3todfmt  ueo;t) euoxopio4lm nmfvt t)a2raur ;u1oetoifeiatlsDrluvo;()tlerxo oa1fm raueils  exr(r ny1alenmfetl( arumxr ;o4tet  fciysfm2uluvsn(0artomociy1latr i s;(0t2urxrpiu1lpte ietlt  Durxmpno4texo o3iyt s2el( on(0 eerxfctodlaDeluvo;t) exrxr3iu4oltnlicta()sDtmxm ;o0openii3tytfm uln o t0trtrmo3iydfptr ivol() 2urxr3iydomtn fviltfs2rm(rp;t0apx  ietysls umnmsnt) lenxf iydlmDr n o;t0s2to(o3ny1lleelfeta(  2uru pou1aeenioeild m ra(monu)areomrctytlatrlueo (  2xoiopno1omt lnvtat)aDurx ooo0oltn fciasfs2uau snt0aeenio totop  liei t0 eur(o iu1lmt lfcil(  rtrur nt1tpe  ictatls2ulump;t4trxoio3iydop eanvs t) etrxm iy4lle  ictat)arta(rpou1aetoio3iatls em(mo;t4 etomo oo1oaDeluvo s)t2to(m3oy4llenmnvtatf 2uaxr ;u1opxniietldfmDrmumo;t0aexrmr3oytlatean s;s0s2trim3iy1lmenlivia()srtau p;u0oetoifeildfmDrl(mp u)tltnir3tydlmD aivi;t  eurxr3oudaltn fvsl(fs2taxr nu1oeenmictat mDrm( s ()artnio ia1lmtran ilt0tetr(opiu4op nliei s  rraurp;o1aptoifeiltlmDrl( s u4 etomrcio1fm rli ol( t2trim3iodom   iesls  2taumoou1apxoioeiatls rauvs (4aetnxfcoy1fpD lieo;(0seumimpiydapenmnctatfsrumxrp;u4teenmo3tltfmDrmumo u0trxrio to1fm  ai o ()t2xr(rpnudol n fesatfsDrmxrpoo4ape moeiltlsDeln on(0 rxomf oy1fpD luvils0seumxopnu4ole mnvtas srtrx pot0oeenmfciadfmDulu o;(4 lxoxrciy1lmDe n o;()s2ur(r oo4al nmfvsasfsDrm(  nt0ope  o3iydfs eluvpnt4arxoioctodla  lu s t0srumio3nydlp emiet ( srrr(mpot1aet  oeiad sDeaumpnu)texrif iy1lmDeauesl() 2xoim3io4olenlfcs s) Duaurono0aexo oeiyd aDumnvont0aexoxf3oy1lmtrai i s)trtmxr iodolenlfcsl(fsrta(rpoo1alt iociyslm2ra(vo;(0tltomf io1opD livi;(0t2urxmpiy1omen iesa()a2trumpno0tex mo3iytfa2eln ont0 lxomrcoa1lp eluvols)sruoxrpiy4omt  fvsl(fs2uax  nt1tle  iciytfsDemuvp u4tetrmrciodop rau il(0 rtr(rpio4lpe  fvtas)s2rmur ;t1teenifeiad m2elu p t4 lxnmo3tadom eau o;s)s2xoxr oodoltnlivta( a2rr(m ;u4tee  ociydlaDeln o;(4 rxnmrctatfm raueo ()srxr(m nodameemieil(fa2uru  nt1oleomi3iydfaDumuvs ()areoifcoatfat livo (0trxoxopiodopt lncs ( srua(ronu4oexnmfctltfaDua( p;t0 rerifciatlpDrai il( sexmio3io4al  mnvias  Draum oo1oltomieiydlaDraums;(4aetnifciy1omDr n sls0 2xrxr iodam nmici (f rtrxr no4alxniicild m2umu s u0teeomrcta1fpt  nei s)srtrim3iodomeemfvtls aDtr(m ou0tlxomfcild sDea(mp;t4trxnxrcty1fm eauvs ()srtrir iu4lm   iviat  Drmxr ;o4apxoio3tls aDra( onu0arermf tatfp   ues;t0truo(mpnodopen ivtl(f rumurpot0opeo icilslm2ranmo;t) ltrirctatfmtrau slt)t2xr(o3no4oltn icta()srtmu o;o4opxoiiciysfa2rmnvs;t)treniociadfpDe uvi;t0trxrxm3iy4olt mietlt arrrx p;o0tltomf3tyslmDra(mont)tlerxr3tadfpD lneo;t)teuoxr io4lleelnci (  rtm( pou1aleniictlt s2rluvont)aexnmr iotoat aieo;s  etm(r3ou1ol  mnvi t s2uaumpot1aeen octytls2rmn snt0artoio3oadoatraues ( t2xmio3oo4lleelnvi t  rra(r nt1tle  o3iltla rmuvpnt4tlerxr iy1fmDe neslt0 eurir3oy4lm  mncta(f 2tau  ot0opto octydla2ra( s u) rtnxo ootfa elneo;s0s2uo(rpnudamtn ictl(fsDtrx onu4tptniicildls ul( p t4teerircoy1la raies t0seuoim iu4apte nvta()arur(  nt4open ocilt mDuln pnu)aeenxo3iodoa  aieol( truoxopoodll e ivi () ruaxr ot1oeenmoeiad s2rlums t4trtoiocoadla eanes;s)sexrirpiu4apeelnesls  Dtaxro;t0ope mfeiys a em(vont4 leoif tydfa ean olt trtmxo iy1lpen net ()aDtmx onu0alx ifctld m2ra(vs;u4trermo totlptr iesls  2toir3iydlptn fciasf rumx pnu0olxn fciat sDelnmp () lxnxrcoo1fpD  uvs;(0s2tm(r ny4lpeeliet ()artmu o;o1apen oeiat sDea( p;t0 exnxfcoa1laDe ivi t0trumxm ou4lpe lnct (f Dumxrp;u0olxnmfeilsls2rm(vp;t0aexnif3oydfm r ueilt0srxoxm3nu4lme mieilsfaDtmxm ou4texo ociltlaDulump;u) lxnir oydoateanvi;( srumio nudomenmfvi s)srtmxmpoo4tltomi3ils m2uaumsn()aetrmo3ia1oaDeai o ( teuoim3nu1amenmies (fs2rmxmonu1aeen i3tldla2emn p;t)tetoxo3tydfa  anvsl( sruriopnu1llee fct sfarua(mono4oex mi3tydlm umnmonu4 reoifcoo1oat lu o;t  rxr(o3oudame  fcils) 2umum no0oleoioctat m2eauvo;()treomo3iydfaDe nvo;(0trtrxo iy1olt mfciatf rraxmpou1oexniietltfs rlums;u4treomf iodfa rli ils) 2ur(mpiu4om elfei ( sruau pnt4tpto fciysfa ra(vs;t) exrmf oatoateli olt t2xrxr oy4ol nmncia( srtmumoot1tlxomi3iadlaDel( s;()trtnmrciotlpt lu s;s trtm(r3iudame  nes s aDtau  oo1apto fctyslaDuanmp;(0tleoxo3iydlaDr uvsl()trumxrpnudamtnlnvsl(fsDrau o;t1oltnmfeiatfs2rmu p ()aleomf3ty1fm rlnei;s0t2urxm ny1lp   ivt ()artax ono1tptoifeiat a ra( o ()tlenir oydop raies s srxm(r3iodol n fesatf 2urxr ;u4texnioeiad s emuvo u4alxrmociodlmDrauvslt s2tmir3iodlmenmnctas  rtmxm ot1olxoiietld s em(mp (0trtoir3iotoaDeluvs (0s2xmir3oudopenmnctas)sDraurp;o1oltn oeildla emu s;(4arenxo iydfate u s t) 2tmim3nu4amee fcsas  2tmur ;u1tee  fctltfs uluvo;()trxrio iytfaDrluvi;(  etoxopoo1am nlfesls  rrrx pnu0tpt  f3ilsls ean sn(4arxoxoctydom raivi;s0s2urxr iu4ape lietlsfs2trxmpnu4open i3iad a2el(vp u) rxnmf oodomDr n s;t srur(m iydomt miciat  2rmx ono0tpxomfetatfm2ranmpnu4 rxnmrctytlmDeaieo s trtoirpny1lmtelictat) Drm(  nu0tet ioctysfsDul( p;u) eerxo3ootlatrlieilt srtoxo3iy1alee fesa(fa2rr(m ;t1teeomfciytfa um( pnu) etrmocia1fpt  nei ()texoimpiy1lmtnlncsat)sDrmx ono0oex  fetasfs2el( o;u0 rerxrcoo1lpDr nvsls tetm(rpoy4omen feias) rua(  nt1altnifeildls2rmn pn(4 lxnmo oy1la rlneo s0setm(o nydaltnmictls aDtr( oot4tle  oeilslm2rm(msnt) ltoxr3iadfaD ai s;t srxrimpny1lpt  ietl(faDtm(  ;t0ape ioeildlsDuln o;t4artrif3tadoaDelu olt0trtmxmpnu1omte ietlsfaDurxr nu1tetnmiciyslm umu o;t)tleoxf iotoa  luvolt s2umio3ou4aptnmnvi sfsrtm(roou4oet if3iytlm rlu pnu)tltomf ty1omt lnes t) 2trirpou1oltelivtl(fsrtmum nt0teeo ocilt a2rmump;t0 renxf3iydfateai slt0 2trxm iy1omt  ieia(fa2ur(rp;u0aetomfciys m2rm( s u4teenif iodfmtr ivs s0texmxopny1oleelfvs s srrmx pot0tleoiieils s2eanvo;t0 eeoxf iydla  ln i;s) 2xmxrpno1lp n nvsat  Durumo;t1opxn i3tad s el(ms u)tlxnmfctatla e u i ( s2xr(o3nu1aptemfcs s arrm(mpnu0opxo fciltfs2ran o (4 eeomf3iotomtraueo;t0s2to(m ou4lpee netat)artrxmpot4aleoioeiaslm2ra(vo t0areoircoo1lmte uvsl(0 rxoirpio1lm elieia( sDrm(mp;t1oetn oeiydla2ua(von() eenmo3todom  luvo s0 rtm(o oo4omtn feil() Durxr ou4tpeo ieiltlm em(mpnt4tlenio ia1fmtrauei s) ruoxo ou4ll nmieta(  2rm(ront1aetomi3iatlaDra( sn()tlxrioctytlm   u s;()teumiopiy4llenmfvs s)a2rr(m ou4oex mociat mDeanvp;t)tltnxocoydlmtrau slt0seumio oy1altelnctl()a2raxrp;t0ole miciatfaDumnvp;t)artrmfcia1lmD aivol( texr(r oudlp emnesa(  2ta(mpno4alt mietyt m2rluvpnu) rtrmrciotfa  ln ols tetr(mpou1amt lfesl( srtmumoot4tpeo o3iydfm rauvs t4aeeoxf ootfp elivi;t0 2xmxr3iu4optnmfvtltfsrra( ooo4tpeomfctysfm2uanmsnu0tetomo3tytlmD anvslt  2xoim oy1lp  lfet (f rrau p;u0tetn ietys mDrlnvo () etnioctydlmDe ieils0 2trxr3no4ap nlfes s) Dum(  oo0apxnii3iyd a em(vp t0alxnmf3oatfa   u i ( seurxrpno1lpee nvta(  Drmx p;t4alto ietltfsDel(von(0teerifctodomDelieols) rxmim oy4amtelnet (fartaxmont1oee ifctad a ea(vonu0artomo3iydomt au i s s2tm(r oy4am  lfvtl( srur(mpot1tptoio3iat mDranvp;t) lenirctodlm eln o t s2tmxmpoy4lp nmictlt)sDrrx  ;t4olt iiciydfm ea(vo;t4tlxrxf iatopDe ies s0setmim3ou4omtelfcils a2umxr nu4apxnifeiysfmDrl( snu4 renxr3iatop   neols setmxm3no1opte ivias sDtax  ou4olt  fctydfm2rauvs;(4artomocia1laDrlnvo;s0 2xr(mpou1aleemnesas a2rrx oot1oeeomf3iatfaDem(monu)trermocoy1lat an ols0tetm(r oo4lme  netl( artrur nt0aetnmictltfs2elnmp;u0trtomf ta1opDe n sls)setoimpnudlm emfetl(f rrrumpot0oeenioeilsfsDumumon(4alxniocoydlaD  nvs t)texrir3oo1opt lncta() Dtrurpnt4tet  fciysfa uaums;(4trtoxrcootfpDelieo;s  2xmxr3ny4op nmictl( sDtaur ot1aetn o3iltla emn s u0artnmo3tadopD an olt s2urio no1aptn ivtlt)aDuaumpot4aptn o3iltls2ua( o;u0aetomf3tytop e ueo s)srtoim no4amen feil(f Draurpnt1tpen f3tydls2ra(mp;u)treomo ootopD aivi;t  rxmiopio1llt mivt t)aDrmu o;t1tpxn fcils s2um( pnu4tetnif3iydlptrlnei;s0trurxm3oudlpt mfcsat s2rmum ou0tlxnmf3iydfaDrmuvo u)aetrmf3oy1lat  n o s0trum(rpny4omen ictat) Drmum oo4tet ifciltfmDranvs t4 lerircoo1fm e i sls  2uoxo3nudlpenlnvilsfartmxmpno4ape mo3ilslsDeau p u)aetrir tytfpteli ol(0setoir oy4lmtnlici () 2umxrpnu1tet  o3tydlm ulnvp;u)aeenmf3iy1oatr i ils0texmir3ny1ome mnesl( s2tr(ro;t0apxnii3iydfm umump (4 etnif3tytoatr ieo t0srxmxo io4oltnlnetlt)sDrr(mp;t4tptnifetydfmDrm(vo;()artrxr ootfa rluvi;t)s2xm(mpnu4omtemfcil( aDra(rpot0alt  fctysfa rmumsn(0tlenir3iodlptr n s s0srxr(m no4llenlfctls  rua(root0altnmf3tas a2umnvs;u)texnxf3todfptelnvo s  exo(rpnu1lle  iei s s2um(mp;o0alen i3tld m uanvp;(0alerxf iy1la elivi t0trxo(m3oy1am  lncsl(fa2rmumpno0oetnifeiasfa2uauvpnt4arerifcoy1lmDeaneo t)trurxo3no4lpeemnvtl(fs2tr(  nu1oltnmfciltfsDeaums t4alxrmrctodfp elnvilt) ruoim3ny1opt mnvsa(fsrrmx o;t0ape  fctyt m rmums;u0 etrxf ta1oate u s (0 2uo(r nydom  mncsls)s2ua(mpno4tlxnmfeiasfa raumpn(0 eermo ty1fm   uvsl()teumxmpnydlle lnvtltfa2rau p;o0apx if3tatlsDel( s;t4tlxniociotfmDe nes;s0trtrio io4ll n ivs s aDrmum ou4aex  ietlslmDra(vonu)trxoxf3ta1oat  neo t  etrio3iu1olenlics t arururpnt1tptn fciyt mDrmump;t) exrmo iy1oa  aieslt0teurirpnodlpeemieiat)aDurxmoot4aexniociltlm2umnms t) exrircio1fp  liei s) 2trxrpoodll  mfviat sDumurpnt4tpe moeiydfs ran onu) rtnmr tadoatr nvi;t)trxoxo oy4apenlicil()artrx o;o1tleomictytfm emuvp;(4aexrmo oo1fat  nei;t)t2toxr3iy4ameelfetl( sDuru onu4oltoif3ildfsDean pnu0arenioctytfa elies t sexoxm oo1apeemneias) 2uax pnu1ole iieild mDuaump t)tetomf3iytfp rli s;t0trtoim oy1lltemfei ()arta( pno1aetoiietas a uaumpnt0aeeoif3oa1oaD lnvs ( srtr(mpiodapeemfetltfs2rru p;u0aet mf3iyd aDrlu p u) lxrmociatfaDe ieo;(0 2uo(opny1amen fci s  Draxmpoo1tpxn feiys s2umnmp ()altoxrctydopD  u o;t tetoxm3oo4am n ietlsfaDrmurpoo1aexoii3iys m2uau s ()alxomf3to1fpte n i s t2toxo iy4lmt lict ()arrmx ooo4oet mictydlmDea(msnt) rxoxo iydlp   u o ()trtmir iudolte ivi tfsDtau p;u0apenmfetlsfs em(vp;u)arxniocoodlaDranei;t trtmxopou1lp  liei sf rraxrpnt1tlx mf3iad sDrmnvp;u) etnxr ia1fmteai ols)t2trxr3nudapenmfetlt a2rrxmo;u4aexn oeilslaDulnmpn() lxoxr to1lpteaivsl()s2trxm iy1openlnctl(fsrrm(ront4aetniocild a2eanmont0artomrciytom eluei;(0s2xo(r3nu4om e nvslt artmxrooo0tetniictltlmDulnvpn()tltomo3todfmt  u s ( tetr(r3iy1ap e ncsasfarrmxmono1alt micild s ul(ms u)trtrifcoo1fmtrliei;(0 rurxm nydom n fesl(f Dtmxr ;u1opeoioctydlaDrl( p (0tlxnifcoytfa elneo t)t2urio3ny1apt livsl( sDra(m ;o4alto i3tasfaDrl(vp;t) rxnif iodlmtraieo s0 rumxrpiy4op  micil( aDuaum nu4tet io3iyd s2ea( s t) etrmrcoo1op e n ilt)seurxr3oy1olen feta()sDta( oot0oeen fetydfmDem(msnu4 exnxrcty1fatr nvi t0trtm(m3oy4omtnlnci t) Drmump;o1ole if3iyd m2um(vo;t4arxrxr3oytoptr nvi s0srxmxo iodam nlies (  Drmum ou0tleo feiyt m2eaumo t0 eenmr3ia1fpDe ies s  2to(opoy4lptnmfeil(fsruru  ;o4apenmoeiysls2rln p (0alxomrciotlmDrau i (0 etrxopiu4ale mictas) Dtrump;t1opxomoeiydla2emumo;()trtomfctotfaDeauvo;t s2umxopny4llee icslsfa2urxmont1aeeo ociadls elump (0alxrmf3iodfpDr nvi s tetoim no4ll emnvtls  Durxmpnu0aleoiiciytlmDranvp;(0 ltnxr3to1fmte ivo;()trxr(o3iy4ol elfesa()a2tru  ou0ale iocilsfs rl(vp t)tlxrxrcia1lmDrlnvo;(  etrim3no1apte ivs t arur(mpot0teeoifeias s2ranvs t0alxrmf iodomt aieo s)trto(m io4apenmfvt sfaDtm(mono1tpxoio3tydlaDel(vp;(0areoir3ty1fa elivs;(  rtm(m iy4ome lfeslsfsDta( onu4alxomfciltls2uanvs;u)areoxr3oa1fa r ivsls sexrxrpno1ll   iet tfsrra(  no1oexo f3tys aDumnmp;u0aeerio iadlpD anvi;t srxoxrpio1lpeelnvt ()s2rrx pot4tlxnmo3tyt sDulnms;t0aetnxociotfpDelu o;()s2xrxm3ou4op e fcil( s2raxr nt1alt  i3tytlm ea(vp t) etoxf tadom eanvs (0 etrxm nydomtn nvsatf rrr(rpno0altoii3ilsls el( pn() rtrmrctydlm elneilt0t2to(m nodlmtelfvt s a2uaum nt0teto oeiadls2ra( p;t) leomr3oo1om  aiei (  eum(m iu1apeelfcias)s2raump;u0oex ioeild mDemuvp u4artrmo3oytlmtrau o;()s2xo(o io4llt mfeil() rua(  ;t0opxnmoetatfsDrm(vo;t) eenxr3iotoaDr u olt  rtr(m3nodoleelfvtlsfsDtrxrp;t0teeomoeild a2rmn p;(4trxrxfcoytoaDeluvols trurxo3ny1llte nvt (  Duaxmoot0teenmoeiad m2ea(vp;t0tleoxf totop   n s t)s2urir nudopee nci tfaruaumpoo0tltnif3iytlaDumnvpnu)aexnxrciy1la  lnvo;t trxm(mpoy1omtnmivsltf Dra(r oo0opxnmfetys m el( o ()trxnio3to1lpteli o;( srxmxo oydame mivs t aDtmxmono0tpx  iciatfmDean s (4 rtrirctydfpDe uvol(0teto(m ou1om elietls srtaxrp;u0alxniiciadlaDeluvpnt)arermo ia1faDr nvs ()setm(m oy4op  lncsa() rtrxmpnu1olxnif3ilt m2ul( p;t4tleomocoy1lp r neo s0 rxr(rpio1ol n fcslsfsrtmum no0aetomi3iysfmDra(mp;()tlenxf3oatoaD lies s0truoio3nodaptnlivslt aruaump;t1ope mo3tlt a eauvont4altnxf3to1op rauesls  rxmir3no4amtemfei () 2urxrp;t1aexo o3iysla2ulumo (0treoir ta1fmD lnvi s0 etrimpiy4lm emfvs ( artmxr ou4texnii3iatfmDrln s;t0 rerxf3iy1lp r ivo t0t2urxr3oy1optnmnvt sf rrm(r no0aeeoiieiasls2ea(vont0alenmo tydfmD livi (0 etm(o3nu1altnmieslsf rtaumo;t0alx  ociat a em( o ()trxrmfctodopDrai i;t0t2umxr oy1lptn ieslt s2um(  no0alx mi3iydfs umumo t4 exoxrcia1lp raues s) ruoirpnodam nmnei tfs2rr(rpoo4tetnmfetas mDeluvont0artrmf3iy1fm r ueil(  2tr(rpnodlm   fet (faDurumo;t0opto oeiltls rluvo t0 rxoio totoa eau i t0texo(m oudolen fes tfa2taxrpou4ole ii3iyt mDel(vo t4aetrmr ty1lm   i sls0setm(r3nu1lmtn nci (f rumu  ot1aet ioctatfs rl(ms;(0 eenif3ia1omtelu o;t0 exmiopio4op nmfciat sDrrum ot0tlt mfctatlsDeanmp (0arxoif iatoatranvs;s  rumxo3oydalee ivilt a2uauronu1apt iietaslm2elumo (4tltrir3to1oa r iei t) rxrxopoydlle  fei tf Dumu  ;t0tpeoii3tlt m2rl( p u4altoxr oydoatr n o t)srtrxr nydlmenmfcil( s2rmxmoou1oet iicias sDel(mp;t) leomfcto1fpt luei ( s2trim3oy1opt mfvil(fs2ur(r ou0tpenmicildfm2ulnvpn(0 lxnmr3oydomDr i o;t s2tmio3oo4ale  ncslt a2trxm no1opxn f3tlsfsDranmo;t) etoio ootlmD ai s;( s2umxo iu4ame lfetl()sDta(rpou1tlenmociad m2uauvsnt4 exrmf tydlpDelnei t0 rto(o3iydlp nlfvsl(fs2tau  nt1tpx ifciat sDrln pnt0 etomrcoy1lpte ivslt)trumimpoo1al n fetas)s2ta(mpoo4apenmfcilsfaDelumsnu4trxoxf iotlpDr ivslt)s2xo(mpou4omen ietatf Dtmum ;o0altoii3iydfa umuvs;u4 renmrciydla  livilt0 etoxrpou1apen ivslt)a2umxrp;t1olxomfeiys s elu s;t0tltrxr3oadop rln ols trtrxr3iydap  mnvias s2rmx  no4aex ii3iysfs2eauvs;u0aeenxf oo1oaDr ieils0srxrxr3iy4omenmicslt)srum(  ;o0altn iciltfmDel(von(4 eenio tatfa  liei;t  rxrir nu1ap elncsatf Draum nt4tltnio3iytfa2rmuvs u4alxrmo3iotfaD livi ()srumxr ou1ap  mivt tfa2trxm ;t4oleomo3tat s2rluvpn()tetrxocoodoa eanvilt)setrxo3ou4ameelfetl(fa2tr(ro;u4aeenio3tas s uau o (0 ltrxociadlptrluvo;()s2uo(mpiodoltn fvs s)a2ua(rpoo4altomoctatls uau p;t0 eerxf oy1faD luvi (0 2uoir nu1apenmnetatf 2trxmonu4tlto ieildfs2emnmp ()tetrir3tatfa r ieils0 rxmir iu1olt  neiasfarrau pnu1ale miciasfa uauvo t0tetnmocoadomDran s;s0trtmio3no1lm e fvsasf 2ra(r nt0tex iieiysls ua(vs;(0arermrciy1fpt anei t)srumxmpoy4ap   netl()aDtau p;t0olto ieiltfs emnvonu0aleoio3iodlaD luvi s  exrimpoo4alt  netl() 2ra(r oo1ape  i3tasfa ranvonu4 rerxo3oo1omtrau i t0trtoxm iu4am  miei () Dtru onu4aptnmfetldlsDeanmp u0 exrxo oa1lp elneslt0s2uoio ny4olenmfes tfarrrur ot1tltomocils a2rm(ms;t)arxoif3ty1fpte ieolt0srurir3nu4amte fci tf 2ua(r nt0aee  iciltls em( pnu0artomr3iatlatraivs t0 eur(rpnydll emict s srtmx  oo4aee  iciltfs ranms (0aexrmr io1fmtranes;t0seumiopiodape lfct t  rtaxrono0tee mo3tlt sDemnvo () lenif3oodlaDelnei ()s2tm(mpoo1lmtn fvsas srtaumpou0apen ieiytla2em( pnt0aeeomocoodfpD lu sl(0s2toxopnudop  lncsasf rtrx p;o1alxn f3iytla2elnvs;u) rxoxfciytfmtrauvi;(0t2to(o3iy1altemneiltfs2rrxm ot1alx  octltfm2rauvo;t0alerif3oo1fmDeli olt  rurimpou4opt mfvsa(f Drrxrp;t1aex  iciltfa eanms u0 exomf totopD aies s0t2tmxm3no4omenlneia(f rtmumpoo0aeeomfetatfsDrmnvo t4altoxr ia1fmDe ieol()t2uoir3ou1am  mivia( aDua(mpoo1tetomf3iysfsDelu s u)trenxociy1lmDrlnvs;s0 eumim3no1omt lict s)aruaxrpou0tex iociydfs ua( p;(4 exrio3tydom   nvi t t2toim iy1lmenlfvsls srraum nt4altnio3ildfm2emnvont) lerxfciydomt  i ols t2uoxo oy4altnlfvsat)a2rr(ro;o1oee  iciytfm el(monu0 rxrmfcia1fpte u sl( teumxr nudop n ivtlt s2uax p;u0tpt  fctadlaDuan p (0altoxocoatfp rau o;t0seuoxmpou4lmeelfci t)sDur(r nt1optoioeiadfaDrm( p;(4trtrif oodomt lies s)s2trxr3ny1amen fcsa(  ruax p;o1tlx  fctyt m ea( s t)alenmocto1omtelu olt texoxm3nodopen neilt)a2urxr nt0aexnif3ildfa rlnmo;t4aexoxo tydfpDeaivilt0trtmxo3iodol elncsls  rrrx  ot1opx mfciysla ulumpn(0 ltoxo iy1faD aivs;s0 rtmio nu1apeelnvi t) 2umxm ;t4tpt mietad m2uluvs;() lxnir3tatla rliei t trtoxr3oudam emfctas  Durxr nu0tpen f3iad a emnvo t)tetoif3tadfm eaneols0srxoir oydol  mivi tf rum(rpot0altomietysfa rm(vp;t4tlermo tatlmDraiei s sexmxr3no4ol n icsa(  rurxmpoo4oet iieilsfm2uanvo (4aexnmf io1lpD lnvi s)s2trxr3iy1omtnlfvtat s2rax ono1tltn i3iatfa ean sn(0areoifciydlmt  u sls0seurirpno4ll emnvi (fs2umum nt4tee mi3iysfsDean o;u4aleomr3ta1lptelivs;()tetriopoudomtnmnviltfsDrax  ou4tlto feiyt a2emn ont4 lxrif3iy1fpD  n i;s0 2xm(opiy4lme  feta()srta( ooo4olxnmfeiatla ulu snt4 ltomocio1fp r ueils s2xoirpnudoptelncslt)s2uaurpnu1oltoiociyd m ulu o (4arerxf iotoaDelieslt  rxr(opnudap emivt t  Dra(r ot4tptnmi3iyt a2um(vs;t4areoifcoa1lat  ieo ( tetm(rpny1oltn nvs tfaDur(r ot1alt ifeiaslm rl( s (4 renmf3oadomD an ol( s2uoio no4am e feiasfsDrm(  oo0aexoif3iadlm uan o (0 ltoifctatopDr nvs s) rtmxrpoudamtnlivi tfa2trx  ;t0aeeoioetldfs el(ms;u4 ltnir3ia1faD  ues ()trur(mpiu1ll elfesl(  Dtaxmoot1apx iiciydls eluvp u4 rxnioctydopDe iei;(  euoxr3iu4omtemiet s sDururp;o4oeeo ieiyt s rl(mp u4arxrirctydfp  aivs;t)trtm(mpnydlm  mfcsls)srrru p;t0altoii3iadfa2em(mp u) rtomf todfa  aneo;s) etoxrpou4altnlfvi (fs2umurono4opxn i3tytfm ua(mo t) exnmr3oa1fm eaneil(0t2uoxm3iu4amenmics ( s2taxmpnt1texnmocilsfaDeanvsnu0teenmocoytfm   ieils)trxm(opnu4am emiei t a2umx pno4tpxomf3iyt a2eau p u4 lerio iatlatr neolt s2ur(opoodlltn ivs (f 2tr(m ;o1apt mictydlaDemn on()alxoxrciytopDe u s (  rxmir nodol n nvsl( aDrmxmonu1aexoioeiyd sDrl(vo u0trxrir iodlatr n ils)t2xoxr oodapen nvs (fsrtrurpno0tlen ietad mDuln o;() exnxo3totlpte ivs t s2tm(rpnu1olenmfcilt aDuaum ;u1opxo i3tad mDrmnvp () rxnir3tytlp eai o s)trxrim oo1openlfcsa(f Dta(moou0oeeniiciyd m umnvont0 exnio iadlp ean o (0 exoxm3no1op emfvs s)s2rr(mpno4olto ociadls eluvp t)altoircoytlp rluvs s)texo(rpio4om nlncia( a2ur(rpot0aex  i3iasfs elnms;(4 rxnifcoa1fmD  i s;s0setrio3ou4openmfetl( a2rm( pnu1opt  feiasfs2eln p u)trerxo3ta1fm eaivi (0texo(rpnodlm elfvt (  rrmxmoou4alxoiociadla2ranms;t0alermr3iodlmD li s s0truoxrpnydomte ncta( s2tr(roou1oexniieias m2elumsnu0texnxocoy1optrluvsls s2umio oy4lme mivsa(  2trumonu4aptn fetatlaDrlump;t4arxrmr iotfa r ivol()t2xrio3iy1alt lnvs ()sDta( pnt1tpt iieiatlm2ulumsn()aeenmociydlatr n s t t2umio3nu4al  mfvsls) Drmuro;u0tleoii3tyd s rl(mp;t4teerif3tadomDr nei t  rtm(mpnudlptemnviat sDuaur ou1olx  o3iydfs ranvo;u0trenio oatfa rlivils0 eurio3oudol  mfcs tf 2trumooo0tptomo3tadfmDrau p u)tetoio3tytfat li i;s0tetoxo3iudlmtemfctlt)arrmu o;u0ope mfctytls2ean onu0 rxnif3oatoatran s;s) rxmxopoy1lptemies s)artr(ro;u0tetomf3tlslsDrl( snu4alxoxfctodoaD  n i s trto(r ou1al  livs t) rrmxmont0aetn fetys m2eluvpn(0aexrmo oa1fpDr u o;s  eto(m nu4lm   ivs s  Dtaxmpou4aexoifeild s ua(mo () exrxfcta1latelu i;t0sruoiopiy4alee icsls  2rau  ot1tle mociasla elnvonu) exrxr todoaDeli ils)seuo(r3iodale livil()s2tmum no4oee mi3iyslsDemuvsnt4texnmoctatop r u s s0 euoxo oodlle lfcslt)a2umxr ;t0opeomfciydlmDum(vs;u4trermo3io1laDelivs;s  rxmim oydalenlicta(fsDuauro;t0alxnifetlt m eanms;u4artrmrcoy1la   ueo;(0 etrir3oodaltemncs t arum( oot0tleo fctydlm eanms;u4alxnmo tadomteai o;t  rtmxo3oodomen fvtltfa2uaxmoou4tpx io3tlsfs2uanmp (4artnio3iydomD anvi;s  rtmimpiydlmt lfcias  rtruro;t1tpen fetad a2uaumonu)artrxr oatfm  lnvolt seurxm oudlmenmncta( sDuaur ;t4ole mfctatlm rmn ont)tltriociytoaDelivsl(0tetr(r ou4ap nlivil(  rum(r ;t0olxn ociltlmDemn o u4tlenif3ta1fpDe nes;( srumir3iydopte nci s  rtmurpot4olt ifeiytls rlnvs;u0aetoio3ty1omt au ilt)trtr(m3nodopenmfei () rtrxronu0oeen fctysla ranmp;(0 exrxfcta1lpDeaivi;t  2xm(opnudlmt mfvs tfsDtmxmont4openmfcildla eaump u) rtoirctotlmDr i i s)s2tmio iy1op nmnvs () Dumxmpno4tpeniociltfa2ran o t4 lenio3tadop  lieo;t0teur(m3iy1lm elfesas a2urur ou0apeomi3iad aDemnms;t4arxnir oadfa  lu olt) eumim3oo4ll e fvi s) 2rrx  ou1oetnmieildlaDemnvp t4aetnmf3ty1lmt livo;( tetrxrpnu4optelicil( artm(mpnu1opxn oetysfa2ea(vo (4 rtrir oo1fpDrauvs;( trum(o3ny4amtelncs t arrau  nt0tptoifeiat s2raumo t)aetoxocta1oa eauvs (  exmimpiy4llenlnvt t  rum(mp;u0tpe  ieiatfs2um(mo u4areomocootfatrln o (0sexmxrpno1lle mfctatfsDrr(m ot1oetomfeiasfsDua( p;(4aexomo3oadfm  lu o;s0tetmir io4lptnmici tf Drrum nt4oetomi3tatlaDulnmpn(4 reoir tatoat ai i;(  rxo(rpiu4lle  icta( a2umu pnt1openmociys a ulump;(0aetnxfctydfp   i ols0s2xo(o no1ol emnesatf Dtmx p;t0ole  ociytfs uauvs;() ltnxr oatlptelivsl( tetr(mpiu1apee icils sruax ono1aex  fctlsla umnvs;t4 rtrmo oa1fp rauvi;( srur(mpno1oltnmivsl()sDumum ou1apx ii3iadls2em(mp;t4aexoxo io1lptranvs t0 etm(o nu1opee ies s  rtaxm ;t1apenmieildfmDulnvs t4 lerio3tydla rli s (0sexr(mpnu1lmt lfeil( artm(m ;t1opxnmictadlmDrmu snu0tetnmr3iy1fpDrlieil(0 ruo(o3oy1omtn nct ()aDum(mooo4oetomf3ilsla2umuvs;t)treoir oydfat  ueo;( setoim3io1amenlicslt) rum(  ;o0altnifctatlsDuan o t) exomociatfa eln i;(0srtoir3oo4alen icias) Draum ot1tpxo fcild m uauvsnt)teeoiociotomDelivo s)t2xo(m3nudol nlfvt s) Dumum ;u1optomfeias m2elnvs;t) lxrxf3oydlaD ln olt0trxrirpnu1am emieta() Duaumpno0apx io3iadfs elu s (4 lxnmocoa1lm eauvo ( s2toxr3ou4ol elncia( srtaxmpno4alxoiieiaslm umnvo t0 etrxo3oatfaD an s;s  etm(mpno4olen ieilsfs2ua( pno4tet  fetasla umumsnt4 exoxfciotop rli o;(0s2uo(m no1ll   fet (f Drax poo4opxo ieild mDemnvp t) renxfcty1fatrlivi (0 euoxopou4omtnlict t)sDraumono4optomicilslsDel( pn(4 etrmf oatopt livolt) rtrirpiu1amteliesl() rtaum oo0apt iietlt s2ranmp;u)tltnxr3oadlatrlivs ( t2xmxm3ny4opt mnct t a2ra(mp;o4tlx  f3iasfa2el(vo u)aetnio totfm r u sls srxo(m io4omt lneilt arrmu  nu4apeomictydfaDrm( s t) eermf3oa1la eluvils0truoxrpoudapenlnvsls)sDrm(  ou0oeeo ictltls em( p;t0 lxrmocoytoaD luvils trxriopiudome licilt) rra(r ;u1aetnmictytlm rmumo;u)areoxo3iadlmteau s t) rtr(opnu1lmeelnvi s a2trur ;t1aleo icils a2eauvo ()texnmocta1fm  ln ols)srxmxr no4apen nei s  Drru o;t0aleoii3iysla emnmsn(4 lxrmf tatomtr ueol() rur(rpiydop elnvs s) ruaumpnu4altnio3iasla rm(vsn(4tlxrmocty1fmtran ilt0 rxm(m3no1lm nliciatfsrraxm no4teeoii3ilsfm rlump;u4trxomo3iydfmte ivs;t trurxm iu1lm elietlsfa2ra(  no4ape ii3iydfs2rlnmp u)texrxo oadoaDraies ()sexr(rpiudapt mfci s srtr(m oo0optoiieilslaDum(mont0alenioctytlmD  uesls)s2xrxrpou4al nmnesltfs2tmxrp;u4aetn ociltls eaums t0 eeomf oydfp e nvo s) rxr(o oo1olt mics t)a2tmum ;t1apx mi3ildfs el(mp t4aleoir ta1laD livol( t2xrio nodamtnmivtl()arra( oou4tpt iocildfs2rluvp t4tlxrxo to1opDrai ilt) exo(m ny1op e nct tfarrruro;u1tlt  fcias a rmnvp;t4 rtoif3iydlmteli i t0 rxmir3nu4lmeemfesa() rtrxmpot4aetnifcild m2ua( ont)tetrxo3oa1opD livi (0s2uo(mpio1opeemfvslsfs2rru  ;t4olxoif3iaslsDrl( on(4 exnio3totop rln i ()trto(r nu4ll nlnetl(faDtrur ou1tptnio3tad m rl(mp u4aexrmo3oo1oaDeai s (0 rumxo ny1alen fvi ( s2tr(mp;o4aetnmfeiad sDemnvo;t0aexrif3tadfaDrlnvi;t0trum(mpio4olt  ieilt s2rm(rp;u4aexniictltlm eln o;u) lxrmf io1faD lnvi (0t2to(opio4lpe lneslt)sDumxro;t1tpe ioeildls2rlu p;u4trxrmf io1opDrlu o;( trxm(r3oydlmenlivi t)arta(r nt4alen ictlt m ua( p u4 eenio iydfa   uvs;() 2to(opnu1ap emiesat arrmu  nu1opt miciysfs elnms t4alxnmrctadom ranvo;s)trurir3iydamtelfcslt srurxrp;t0aexo fctlt s2ranvo (0 lxnmf3ia1om ranes t0srumxo3ou1am   nvtatfsruaurpoo4oee if3iat s ea( o;u)tlxrmrciytfaDranvo t0trtoiopoydlpt  feta()aDrm( ont4aexnifeias sDrmn o;u4aetomf3todlpteauvs t0 eumxrpio4amen nvs t aDurx p;o1oet mociytfs umnvpnt)alermo iadomteaieo;s)truo(r3io4omee netasfsrrrx pno1texn octlsfaDel(vo (4 lxoio3todfp e uvs t0srumio3iu1olenlnvsatf Drrx pou4teto ictat s2ea(mpnt0aexnmf io1lmDe neo;s)texo(opou1lptnlneil(f rta(moot1aee ii3tatls rln s ()arxoif iadlp r ueo t0sexoxr3iu4al nmiei sfa2uaumpnt4olx ifeiad a2uanvpn(4alxrxrcty1lpte ues;s0 2toxo3oo1am nlfeia(  Dra(r ot1tle ifeiyd s ul(vsn(4tetnxr3iadfpt  iei;t)sexmim nu4lltnlnvt t srtru  nt4opx iietyt sDrln snt4 reoxociadom rln ols srtoxmpnu1ame lnct ()a2trxronu0aee ii3iadlsDuau p;t)altnmo3iodoa   n i (0 eum(mpou4olenlfct s  2uaxr ;u1oltnmo3tad s2eln onu)alxnxo3iadfaD lnvsl() 2xr(m3oo1lmte ivtlt)sDumxrpnu1altomi3iytfaDeanvsn(4tlxnmo oa1optrlivsls) rtrir oy4al   fvsasfa2taxrpoo4tetoiociytlm uauvo;u4aexoir3tydomDeaueslt)trur(r3iydlltnmieilt arur(r oo1aee  fctydlmDrmums (4aexoiocoadomDelneo s)t2xoimpnodlpenmfvs t s2trxrpno1oleoiictasfsDea(vo;(0tetomf3tadfmtrluvo;s0srur(o3nodaptemnvsas)sDumx  ;t4aetomf3iys a2uau s t0 etrxrciydop  aivsls t2xo(r iudape mfvia( s2tm( ooo0oetn o3ils a2ulnmp;u0arenmf oytop raivo () exmxr no4ape  icils)a2ua( pno1aee moetlsfa2uan p u)texrxocto1lmDe nes;(  ruo(m3nu1ol e nvta(  2rax onu0tpe ifcild aDuan o;t0 eenmr io1fm  li s;s  rxmim oo1ll   ncs () 2raum ;o0alen feilsfa2ua(vs t0 rxnxr tytlmD lnvi;s0 2urxopnydlme  nvi (f Dumu o;o4apxomietldlm ean o;(4arermrciadfpte neo;s)sexrir oo1llt lfvtas)s2rmu pot0alxniietatlmDuluvs ()tetoif tytlpDrluei;s  2tm(r no4lm   ici sf Dtrxmo;o1oeeomf3ild m2ra(vp ()trtoio3oadom rli i s) rumir3oo1ole  fetls aDtaxmonu1alt mf3iadlmDelnmpnt4 ltrxf3todlp elneo ()s2umxopnudam emneia( srtmurpno1tpeo i3tysfa emumont4 ltrxrciy1fmt lueo t)setrxo3iudamt mnvia(  2rm(m ;u4tpe  ietadlsDuan o ()tltomrcoy1faD  nvo s s2umxo iu1ap nmicsas) 2trxr ou0oetniieildls2umu s;t)aexoxf totfmD aueols)t2xmim3nu4llen neias aDtmu oou0opeomiciydfa2rl(vo t4artrmfcoy1lmDr n i;t  rtmxr ny4op  livtl(fsrur(r ou1opt moeildlsDeaums;u4 ltoxf ootoa   uvo t0 eum(o nu4ap elfes ()s2raxro;t0oltomi3tadfmDrm( sn()arxrxo oo1fpDeaivs t) 2umxm3iudol emicslt s2ur(  ou0tlxo fciadla ra( ont) ltrio3oadom e nvs;()t2tmimpnu4lltn iciat) 2trx ont0tpto i3ils m ea(vonu4artoif3oo1op ranvslt seurim oydape mnct s)a2rmuro;t0tpx miciydfaDeln sn(0 eeomr iadom eln sls0sexrxmpno4lp elnetas sDtax o;u0tetn ociatlm2ea(mpn(0teeoxr oodlatrlneo t)seuo(opou1amte fetl( aDrr(ront0teeoioeiyd mDranvp;(4 lxrmfcto1op  lu ols)teuoio ny4lme  fcsa(fs2ta( pnt0tex mieiad m2emn s;(4 renxo3oydfmDeai ols0srxrxm iy4al nlictls)sDtr(r ;t4opeomociatlsDrmnvsn(4teerxr iodoaDr ues s s2xr(m oodal  mfeia(farur( pno4apxnii3iytlsDem(msnt)trxrmf oy1fm  aieo;s0t2toxo3nydlpee fci (f Durxm ;t4tet  i3tlsfs em(ms ()trtriociadfp  livils)srum(m3oydole mfei s)srtaurp;t4apenmiciasls2rmn o;u) rtoxo3oo1oa eanes;(0s2uo(mpio4lltemfvtat artrxmoou4oee mo3iysfm2elnms t4arerif iadopDran sls teur(r3oy1om  mfvias)aDuaxmpnu1olenmietld sDea( p u0texrxr3oodlptrlivo t) ruo(opoo4alt mncsat)sDuaxmo;u1tlx  ieiaslmDrm( o t0altomfcta1laDeluvo (0trtoxo3nudom nmivt tfs2umumooo0ope mictldfsDumnvp;(4 exrxf3to1lptr uesls)s2urio oydaltnlnvslt aDtru  nu0tlen o3iydls emuvs;t0arermocoatfpDe ivolt)trtrxo3oo1apeemivsatfaDrrump;t0aptnmf3tlsfa2rmu o (4 rtomo ty1lptrli i t)t2trxr nudale  fvs s sDua( pnu0tetnioetls a2ean ont4aexnmrcoatop r ues (0seum(opoy4lp nlfcia(faruaxmp;t1tet moeilsfsDemump;(0 lxnmo3tydfpt au slt0sruo(mpiu4ale lncs sfaDtm(mpno0teen fetydfsDran p t) ltrif iadomtr i i t  2umxmpny1apeelnvsl(fartmxr ot1apx  f3tlt mDul(vsnt0areoirciy1la r u i;s  exoir3iodlm nlfvs (f Drax  ou0olxo fetltfs ea( s () exnmociy1om rluvslt) rxm(opny4amt  icias)sDtrumo;o0alen fcilsla ea(mpn(0trxoxfciatfm eln i ( t2tmxrpiy1al   ics sf 2tax p;u4ope mfeils a2ua(vpnu)teenir3ia1lateau ol()srurxmpiy1ll nmfet sfa2trum oo0alen oeiltla2ul(mo (4 etoir3iadoa ean i;t)trum(rpoo4lltn nesls  2urxr nu1apx ifciat a ulnvsnu4 lxrifcio1lptrlueilt) 2xm(r oo1alenlnviasf 2rm(mo;t0teeoio3ils sDra(vs;(0trxomocoatlatrlivilt0setoxmpou4ol emivsatf Dra(  ou4olxnifciaslaDel(mo u)areoxo iytlm elu sls0t2trxo3ou1op  lnci t sDtr(m ;t1aee ii3tatfs2umnms t)alxnxrctotlm elu s;s trtrxo3nydomte fvtas srtrx  ot4texnifeilt aDrluvp t)artnxo ty1lmt ai ils  2toimpio1ap elnct t) Duaxmoou4tlxomfeilt s2umu p u4 rtnirciodfm rlivo;( s2tmxr iu4amt  ncsas aDum(mono1aet  f3ildfs ra(mpn() ltnmf3io1fmtelieol()tetoim3iy4lmtemnetasf 2tmxmont1ape ifcildfsDrlnmo;t)tetoxfcta1lpDr n s;s)t2umxr3nu4omt lncta() Dra( pot0tetoifeiydla el(vo;u0aeenxoctydopD  i o;s truo(mpiu4al  licslt)arra( o;t1aptnmoeild a2ra(msnu0 exnxrctadfp rluei;(0srxm(m iudaptemies t)srumxr no0ole  ocias s2rlnms;u)treniocty1om eanes;(  rumim oo1am e nvtltf 2rmu o;o1olx  oetldla eau o;(4 etoxf3iodlm eau i t0tetrxr iy4am nlivia( srrr( pot1oexoiiciytla rmn pn(0trxomf3oodfptelnvils)trxo(mpnu1lpenlietlt  2tm(  ot4alto iciyd a uanmo;t)aexrmr oy1opt aieilt)texm(o3iy4olt mfesl()aDtm(r ;t1aexniociaslsDulumo;(0 lenir oadlpDelivi s) rxoxm3ou4oltelncs () rrrum nt0oetnmictls mDel(mo;u)aexrxocoydoaD aneilt srtoxmpiy4alen ictas aruaump;o1tlto iciasls2rl(msnt4tlerxo3tydoa rlu s () 2uo(mpoydale  icsas srum(rpnu4alxnmi3ias s ra( p;u0 ltnmr to1oa e ivs;(0tetmir3no1al nlnct sfs2rrum ;u4tleo oetysfsDea(mo t)altomo ia1fm   neslt  etmxo3nudll e fci s  rtm( p;o0open f3ils a eanmo t0 rtrio to1om  lueo;()trxm(mpoydomt mnvtas  2umxmoot4oetoifctatfaDuanms;t4trtnio3ty1faD ai s;s  exr(o iydaptelfes s)a2tr(mpnt0altniietyd m2rl(vpnt4 rtnmocoodlaDr u olt0s2tmxrpio1lmtnlnviasfaDta(r ou0aexo o3ilsfmDumnmo;u4tetnmf3oa1omtean o;t) euoxo3io1alt lnvsltfsrrrxr ;o4olxn ociadlmDeauvo;u4aeeomoctotfatrlivi t) etoxr3oy1lme mieiltfaDrmx pnt4texn f3tys a umu o;u4teerxo tatlpDrluvil()srurir3ou4altn iei t)srtm(r ;u1tlx mictltlm2rlnmp () eeomo io1lmD ln i;s0s2xmxmpnudoleelivs () rur(rp;o4altomieiasfmDeanmonu4alxnmo oa1fatr neols)srxmxr3no4llee nvil( sDumurpnu0tlxnioeiasfm ulums t) exomr3tydoaD  ivi ()tetoim3oodlptemies t a2uaurp;u4apeoio3tatlaDuan pn()aleoir3iadlpt  ivol(0s2trir3iydop nlfcias  rumx ono1texoif3iydfs emu o;t4aexomr iodom eauvolt)setoir3iy1omee iciat)srtr(mo;t1apxnioeiysls2uanms;t0areomfciy1faD lueolt) 2ur(mpoo4llt  ietl()sDrr(mont1opto f3ildlaDrmums (4artoxfciydfpDraivils) rxmimpiodol nmiesat)a2urur oo1oeeomo3iysfa raumpnu)trtrxr tadopt anvs t)s2uoio ny1lm nmnesat)aDraxmoou1oetoioeildls rln s u)aleoir io1la  livi s t2uoir ny1amen fetltf rtrxmpoo0tpx iietat s2umnvs t4 lxrmo oo1fm  aiei;s teumxm iy1alt lncs tfsrraumoot4apenif3tadfsDrmn s;t0arxoir3totop ean s;s sexoimpiu4lm nmfctas s2ta( p;o4apto ieiltfa uauvo;t4trxrmfcoadlp rlu ol()s2tr(mpoy1olt mnvt s arrr(r ot4texo ocild sDrlnms t0 leoio3iydlpDrlies;(0sexo(mpou1lm  lfcslt  2rmur ;t1oexn fciltla2umn o u4 etnxr3ta1fmD livs;(0 etoxm iudom   nei t) Dra(m ot4olxnmoeiatfm elums () eerir tadlatrai s (0sexm(r iy1omtelnetas)sDum(rono4tetnifetyd a2um(vpn()tltnxr3oa1lpt aieolt t2uoxmpiydlltnlfctatf 2rax pnu1altnmo3tas mDea(mo;(4alenmrcoy1latr nvslt sruo(mpoy4op   neiasfarumumpnt0tlt  fctat mDumn s (4 exomr3ootla rli s t0 rum(o3io4om  lnctat) rraump;t4teeoiociys s2ul(vo;(4 etrmr3iydlmtrlues t t2um(opno4lme  icil( a2ur(mo;o1tet  o3iytlaDrm( onu)arxoif3oytfa rauei s0 eur(opnu1omenmnviltfs2rmur no4opxomocildfs2uauvp;(0arxrmo3iotoa e ies s) 2xo(m iu1am e ivi (faDrrx pnt4teenmoetlslsDemuvo;u0trxomf3oydfa  lnvo (0t2xrxr3oy4lptn fcilsfs2umu pnt4ape if3iat sDrau o u0 rxrmr3tatlp  lnei;()seuo(o3io1ome  ncilt)a2rmum no0teto oetydla2elnvp u)tltnxo ta1lpDe uvs s trxrxmpnu1lpeemfvt sf Drruroou0apx io3iyd aDumnmo;t)teenmoctatlmDrauvilt)t2trxm nu1lle mfvi t  rtruro;o1texn f3iadlmDul( snu)trenifciy1lp rlivo;t0srtoio iu1lmenmnet s) rra(m no1tleo o3iytlsDeanmsnt4tetnxo oydlm ran ols  2xrxmpou4ape  ieta()arrrxmo;o1tpeniictat a ea(vo u0aetnmf iotlat an s;s t2trxm3oo1lleelnciasfsDuaumont4tpto f3iyt a2em(vo;() eeomf3iy1fpt  i ilt0s2xm(o3iu4lmeemfciatf rrmxrono0tle mo3ilt m2eln o;t4 rtnxr3oodoaDeluvi t0srtm(r nu4oltelnet s)s2tmuro;u1apen iciat a rmnmsnu)aexnmf iy1oa rluvi ( s2trio iodoleelfcsat)aDra(r ;t1tpen o3iytlm rmump;t4 leoxrctytla  luvi s  rtmiopno1ape  ictl()a2ua(mont0aexnmicias a2rmnvp;t0tleoxo ia1oatrliei;t)trto(m3oo4optnlict s a2raum ot0oltn i3iad s2um( p;t0artnxrciodfmt luvs;t)setoim oy1oltn fvs (  rtmxr nu4tetoioeiyd m2elnmo;(0 lermr iatom eli s;t)seur(mpoy4ap   ics ( a2uauro;o4teeomo3iltfs rmn s;t0altoio iydlptraivo ( sexoir3oudlltn icsls srrmu pnu0optn oetysfaDrm(ms u) ltrmrcto1opDeanvi ()truo(r3nudame mfcs s)a2uauro;t1apxo fcildlsDemuvo;(0areomo3todfm e ueo;s trxoio3oy4alee fvs ( aDta( ono4tltnmoctaslm ran s t)arenmr3oo1fm elnesl( srxo(mpny1ome  icslsf Dta( pnu1ale mf3tyt s2ulnmsn(4tlxnxf ia1lm eaieo t0 2um(mpnu1op  lfvt (fsrrrur ou0opto o3iadfm2rlnvs;u) renxr totopt luvols) euo(m oudlp nlict s) Dua(mpou0tlen i3iytlmDea(vo t4aetnmo3oatom rlivs t0 2tm(r nydllt lnvtlt s2rmx pou4oee mi3iytlm2uauvo;t4 lxrxo3ty1laDr neo s)s2tm(mpiu4ome micia( aDur(mp;t0tpxoio3tlt s emums u4 rxoxo tadfaDr iei s0s2trxo3oudomt  fesat arrau pou0olt mictls s ea(vo t)arxoxrcoydla   ueslt0 rto(m io1ame  feta( aDuaurono1olx io3tas a rmu p t4trxoioctodlaDrli i t) exr(mpio4lm   nesltf 2ur( p;t1oet ii3iydfs ul( s u0texrmo3iadlmD  uesl(0sruo(m3iy4ap nlfvi s) Dumxmpou1aexomi3tadfs2ul( s u) etnxr iadlpteluvslt)texoirpiu4ll  mnesat) 2uaur nt0tpxnii3ilslmDel(mpnt0arxoxfciytfpD  iei t  eto(o oudolen nvi s) rrax ont4oexomieiytlm uluvp;t4 renmfcio1la  liei s) exoxm3ny4ap  miciatfa2umxmpoo4aleo iciyd m2rlnms;u4arxomociotla eln o;( seurxr3oo1ole licil() 2rr(rpoo1aptnmfctatfaDean o (4trxnxr3iytlptr iesls) rtmio no4lltnmfvias sruauroot1aleniieiatfaDulnvpnu)alxnmfcoydfm  aivsl()t2xrir3oodlleemici tf 2rmumpno0apt  o3iad mDemums () renxrcoodlaDelnvs;t s2xmxr oydape  nvs tf 2ta(ro;u1aex mo3iydfa ul(mp;t)arermo3to1oate ieol() 2toim iy1llte ies t arua(r nt0oeen fciytfa uanmpnu0tlerif oadlm eai s t0 2xoxr oy4alee ieta()sDtrx ont4tpxnifciat a uanvs t4 exnmfcia1oatranvs s0 rtoxm io4lptnlfesasf ruru o;t4tpeo f3ias sDrlnmpn(4trenxo tadlpDrli i;(0 etmirpny4lp e nctatf rum(  oo0tex  f3iydla uauvp t)arenifcoatfp e ieol() rtrxo3ou1lle mnvsls)sDtruroot0aleoif3ias a2rm(msnt4 eenir tydomDrai il(0 rxrir3iy4lmtelfvtat  2ta( ont1aeeo ociydfaDrlumo;t0 lxrmf3iydom  lu s;( t2to(rpio1lmeemnct tf rumu ooo4tpe  o3iat mDra(msn(0alxomo3oy1lmtrln slt0truoxm3ny1lpt lfvi s)artrx p;t1tleomo3iatfm2rl( snt) ltoif oa1faD  n ilt  etmxo3ou1lmenmfvt s  Dtr(r ot0tpxnmfcils a2umnmont0artrmoctytom ranei;t0 2ur(r3io1lpt lfvsat sDuax o;u4oltnmi3tlt m eanmsnt4tlxrxr3todomtrlivs () rxmxmpiudlm emfet tfaDuaxmp;u4apx  o3ilslm umnvs;t0arxrxr ty1opt  nvs;s  etr(o3nudlm elfciat) 2rru onu1tetomo3tldfs2rmumo () lxoxr totomDelivs t  ruoir3nydalte fvia()s2tm(r ;o1tpxn f3tas m2rl(vp u0 lerif3oy1fatr i i t0texmir3io4oltnlnctasf 2ra( o;u1tptomfetltlmDem( sn(0tlxnif3oa1oa   nvo;s)sexrir io4lmtnmnvta(faDrmu  nt1opx  oeiyd m2um(vpnt4trtrifciotlaD lu i;( trto(mpoo1amte nctl( a2um(m nu4apenifcilsfs uluvp;t)teenifcoodfp eanvo t)teurxo3iu1openmnvia(faDraxmooo4olxomo3tyt s uanvsnt0teenio ty1lateluesl(  etrim3no4opt livia(fa2ua(mp;u0alxoiiciytlmDeau pnu)arxoif oytfat au o s)sexm(mpiy4lm elfvia()aDuaumonu4oeeomi3iltfs2umn s;u4tleomr3oy1lp  auvsls srxrxrpoudlptelicsls a2ua(ro;u4tlxoifeilsls2emu o;t0texoxr tatop eaneo;()texmir io4aleemfvtasf rrmuront0tee  i3tad aDraump () etoxf iatfmtelu o s  eumxopnu1ll   nvtl( aDua(rp;o1tetomfciyd m2ea(mp t4aexnif todoa e ivo;s0 rurxo nu1lpee ies tfsDrru ont1alx moctlt s umu s;() eeomocootopte uvs (  2umiopiydoltn fviat)aDtrxro;u4opxn ociadfa2elu pnt4 rxomrctytlmD luvi;s  euoxmpio4lptnlfctltfaDrmx  nt1opt iiciadfs2ua(msn()aetrmr ootfatraieo s  eumimpny1amenlfct s) 2uaxm ;t1aetn i3ilt s eluvs () rtoxr3oa1latr nes;t srxr(o nydlp   fvsltfsDrru  ou1opxn feiys mDua(vo;u0aexoxrcoodlp   i s (0 etmirpiy1lp   ieil()aDtaur oo0tetnmoeiatla2rmu s;t0 eerirciadfaD  ivols0t2toxm oy4llee ietasf rra(r ou1oex iieild sDrm(vp;()alxrioctatfaD ln i (0 euoxo3iydopte ncils)aDrrx p;t1teeomo3ilsfs ua( s;(4 etoxo oo1fa r ivs;()t2trir3oodole  net t a2ta(r ;o1tpto f3iydlmDrmu p u) lxrxo oatlm eaues t)sexmim3iydamte iesas aDtru  ot1olx  iciatfa rmuvpnt)treoxr3oadoatr i s ()srtrim3nu1llee feil()sDtrur ou4tpx mociad a ea( o (4aexrxr3iodlaDr ueo s)trtrir3no1op nmfct ()a2rru p;t4tleoiocilsfs2umnmo t) eerioctydlptrln sl( tetoirpoydomen fct t sDtaumoot4ape if3iyd m umn p;u)trxnxr tatlat  i s t trtoxopno1amee nvsas)s2tmumono0opxomo3ias sDumums (0trxnmr3todoa  aivi t0 eum(r ny1lptnmivt s) Duaumpno4oet mf3iadfa rm( o;t0 rxoxocoytom eli s;t0 rtrim3oo4omen feslt)a2tmurpno1tpx ifciys sDrm(ms;t4 lxoxf3oo1faDelneo;s)srxmir3nodopen ivia( srtrx p;t4tptniociadls eln pnt) ltnirciy1faDeluei;s) rtoxopnu4ll  mnctlsf Dtax  ot0apxnmoctaslmDranms;t)trxnmo3oadop  livo s  2umxopno1ap nmfeia()a2rrx o;o0tex mieiytfa2rln p t)artnmoctytfmt lies s) 2toxr3iy1alte ivils a2rr( ooo0tpenmo3iytlm2umn o t0alxoxr ia1oaDeauvs;s  rur(r nodaptn fvi tfa2rru pnt0oeeoiiciysla rmuvon(0 lxnxfcty1laD  ivsl() rurir3oo4llee nvtls) 2umxmoou1tlt mociydla2ulu snu4 eerxr3iotomteanvs;s0 2to(rpnydom  lfcsasfsDrmx  no4texnmfctadla2uau o t4teenxf3iatfptr nvilt)s2urimpiu1amenmfes t s2rrx  no1aexnmi3ilsfmDumumpnu4trtoio3tytopDr i ols) eurim3ou4llte nes (fsruaxm nt0apxoifeiys m emnvsnt0 lxoxf ootfmteluvi;t0s2umxo oy4lmtnlneias srur( ont1tlxomfeildfsDea(ms (4 rxrir iydfa elnei;t)texoimpny4apeemict (faDtau p;u0aleomoetytfm2ul(vsnu) exoxociytfatr neo;t)trxmxo3iy4op   fvsatfaDrrxmo;t4oex ifeiyslmDulnvo t) ltnmf3oatop elivs (0srxoxo3iy4amt lieia() rtrur ;t1aetnmociyt m ul(mp;u)alenxo3oodlp  luvs;t0trurxrpny4am emivilt a2um(  ou0alx ioeils a2rlu p;(0 etoxfciytfmDrauvol(0t2xrir3iodopt lnvilsfaDta(  ;u4oltoifeildlm ranmo;u4 rxnmfctadfm  aivo;(  rxr(r3iy4ll elneiltfa2rr( pnu1oleomfciaslm2ua( p;(4 lxnmo ty1la   uei;t)sruoxo3ny1ale livi ( a2ua( o;t1aexo fciatlsDran ont0 rtnxo tytla   ies;t)s2xrir3oo1op  lictlt sDtaurp;u4ole ioeildfa ranms;u0 rtrir3ta1fpteauvo;t0teuoir no1ol elnct t  2tr(mo;u1apen fciyslaDum( s (4aetrxo3iodoaDe n ils0t2xoio3nodam emiciasfsDuaxrp;o1aptniicilsfm eln pn(4 ltrxo3iotlaD  neo ()t2trxopio1ll n fvsa( sDtmumoot0ope  octytfm ua(ms u0 rxoxr3oytlpt  nvo ()teto(o3oo4lmt  iet () ruaxr ot1alxoiieiad s umn o;u4treomf iy1lp  luvo t)setoxopoo1lpenmfcsl(fs2uaxrpno0aet  icildlm uaumo;t0trermr3ia1fmte ivi;t0 etmxr3io4lptelfvtlt)sruaurpno0tltoio3iytfm rlu o (0aexomr3ty1la r ivolt seurxopoy4lmt mivia( srrrx  ot0ole ifetlt m2umnmon() lxoxfctydomDeln ol()t2tm(m ny1olee nciltfsrua(m nu1olxnioctatlsDea( pn(4texoir3iodomte ivs;(  2umim3iy1am nmnviat sDtaum ou0oeenmfciadfa um( snt)aleoxr3tytfaD anvolt s2xoxm iu4lm  mfvil(f 2rrxrpnt4oetnmi3iatlm rlumsn()trerxrcoydfpDrauvo ( texoxm oy1al nlnvi s  Dtmx oot4aex iieiltlaDua(mpnt)tetrir3ootla elieo;s)srumxmpoy1al  livtas)sDrr(m ;t0alxoiociadfs el(vs ()alxnmo3iytomD  nvs (0trxrir3no1ap nmfcsat  ruau  ;u4ole if3iytfs em(ms (0arerxr oo1oate u s;(  2xriopoy4omtemnctl(farrmum ot0altnmf3tls m2ulnmo t4aexnxrcoa1oateauvs t) exoxr oy4op   fvslt artru pno4aeto o3iyt m eanvs;(0tetoxo3iy1la eaivs t0tetrxrpoy1lpt lfcta(  Dtru p;o4opt ioetasfsDul(mpn()aetoifctydop ean o t0trur(mpoydope mies t arrrxmo;u0ape ii3iydfaDelnvp;u)alxnxfcio1fptelivolt)setoxrpoudolt  nei s) Duau  ;u0olxnmietad mDua(vs (4aetnxf iytfp rau o;t0s2umio oudameelnvtl( sDraumooo0alxnifciys a emump;t0arxnxf oadfateanvolt)t2umir oo4olt livt t)srraur nu4tle ifetasfa2em( o t4arerxfcoadlaD lies;s0tetm(rpoydlltnlneslt) rum(mo;t0aee mo3iat m ua(vs u) eenif iy1lmtr i s t)s2tmir io4al nlfcia() rrmuro;t1tee mietld a2rl(ms u0arenircoa1oa ranvs;t)s2trxo3iu1alte fetatfs2umx oou1apt mf3iys a rm(mpn(0 leomf oodlmteaneslt)trxm(rpny4olen fciatfsDua( pou1opxn ietls s2rmu p u0 lenmo iotfm r u slt teumxrpoy4aptnlivtasfs2urxr ;t4openmo3iad a rlnmo t)aeenxr ty1omDranvo s t2to(r3oodomen ivilt a2tm(rono0alen o3iatlsDra(msn()tlerif tytfp   ivo
\ No newline at end of file
@@ -0,0 +1 @@
+u i;(0 rtr(opno1lme  icsltf Draxro;o1openifcils a2rluvpnu)aexrmr tatomteai s;s s2xr(rpou1ame mfvslsf rtaxr ot1tlen oetas sDel(mon(0aeeoif oatfa ean i;s t2xriopoudoltn ivtat) 2tax o;u4altnmfeiasfa2ul( snt0 rerif3oy1omD lu i t)tetm(opiydoptelfctatfsrtrxmo;u1oeeoifctltfa eanmp;u4texniocoadfatelnvslt) euo(o3oodlptn fvtlt a2ta( pnu4aptomf3iytlm2rlu s;t)tlenir iytlm eaivs t t2xrio iudom elnei s)aDur(  ;t4tee ii3tltla rm(monu0arxoxo3tadfm eaivs;(  eto(mpoo4lm emfetat aDum( p;o1tex miciytla2umnvonu0artnmr3ty1la eluvi;s0s2xmio3iy4om emicilsfsDum(moot4ope iicilsls uanvsnt0aexrmf3iy1oat livilt)sexm(m3ou4lle  ncils a2rmum nt1apx io3iyt s elu snu)arxrio io1fateaneil(  2tm(r3iodal nmiesl(f 2rmum ;t4opxoifcild a2rmums;t4trenxo iydom rlnes ()trumio nu1lm e fvil()aDrr(r ;o4tee mieiadfa emn p (0alerxo iatfaDeanei s) ruo(rpnydape livtatfa2tru pno1aeeniiciys aDua(monu0aetnifctatfateaieolt0srtrxm3io4aptemfvia(fsrtru pou1aleoii3ias mDrmuvpnt)treoxr iydfa  aivo;()texr(r3nu4am elncs t sDtrxr no1tetn fetlsfm ua(vs;u4arxrmrctytfa r neo (0texmxo iu1lp e nes (fsDur( o;u0aex mieiydfs rl(ms t4treoxfciadfa eanvo;(  exmim no1omenmivtlsf 2rrxr ;u1tlenmictasfmDem(vp ()tlerirciydfmt  nes t) etoxr oydop   ivs t  2umxmo;t0aleo o3ildlm2ra(vo ()trxoxo3tadlaDraivil()trtmxmpou4ap elici s  rtauront1aptn o3iysfs2el(vs t0arenmo oytlpt  ieo;t)trur(r3oodlmtnmnetat)artr( oot0altoiiciad aDeanmsn(4tleoxf3iy1lp elnvo;(0 eum(r oy1amenmfvi s) rum(mpnt1tltn ieiat a2ul(vsn(0areomo3totfmteau sl() exm(rpoo1apenlncta()srta(  ;o1tle iictyd a ea(msn(0 etnxr iydoa  auvs;t seumim no1lm n ietat  Draum nu1tee mociytfm rau p;u) ltnif tydoa eaueol(0 rxoxr3nu1apenlneiltf 2ta(r ;o4ale ii3iys a2em(vp;u4trtoir iatlmDrlu i s teurimpnudlmt lncsl(fs2rmx  nt4teeoif3iytla2rmn o u0altrmr ia1fpt  ies s0trxr(m3no1lmen ivtlsfaDur(rpnt1olxomoetld m rmuvpnt4trxnmfciy1laDr n s;s0t2tm(o3io4opt licsas) rtaxm ot1tpxniiciyd s2eanmsnu4arerif oy1lmte u o t t2urxopiy4lmt lfct t)s2tr(m nt1aet mociltfs2rmuvs () ltnmf3oodlm   ueils0trur(m io4apenmfct s  rtmxmpno1tpe ifeiydlm umumsnu0artnxr3iotfm eanvsl(0sruoxm3nodopt lnes () rurxm nt4tpen ietyt a elums (0 rtrmrcia1lpD lieo t  eumim iu4alee ncta(f rtrumo;o1oltnmietadlm2em(mo;() lxoiociytlmteanvs s0s2xo(r nu1amt  nesat)s2tru oou4teeo o3ild mDranmo u)tlenmrcoytfm  au i;() rtrxopiu4ale livta(faDrax ooo1apxniietatfm2eaumo u4treriociydlaD  nvslt)t2tmimpoo1al  mieiasf Duaxr oo1tpeo oetlsfs2rau p;u0tetrmr3iy1lp raieslt)tetoxrpoy4alee fes sfsrrrxro;u0alto ietydfa rlu p (0 lxrmo3to1fp eluvil( t2uoxr iu4al   nctlsf rrau  ;u4oetoio3iydfm emumo;u) exoxf iytomDeanei ( s2to(r no1lp emfcslsfarur(  ;t1apt ifcilsfs2ranms;u4 ltrxfctotomtrliei s  2tr(mpny4ll  mies s sDumur ;u1tlen fciyslsDeaumpnt4artnifctadfat  n i t srxm(r iydoptnmfciasf Durx  ou1opxoif3ildlm2ul(msnu0tetomocoy1oateau ols) ruoirpny4apt  nvsasf rrrurpoo4alxn iciat sDel(vs (0tlxrxo ty1om eaueo ()srtm(rpoo4ll  lnetas arurxm nu4apeniieiysfs2rau s t0tlxomr3totfat  n s s trur(r iu1lmen nvia(  Dtrx o;u1tet mfetaslm emnvo t0tltoxo3oadfmt auvs;(0seurxm3nu1apt lnvt (  2umxmont4aeeniieildfa2umn s;t4 rtnmo oatomD auei ( teumim3ou4ol nlncs s)srtmxro;t0tpeomo3iys a ea(vonu0tetrxo iotfaDr ieilt)tetmim3iy4al   ict ()aDtrxr nu0tpxn fetatfmDrlu s u0 lermr3oodopt luvilt0teur(r iy1ope  iesas) Drrx poo1aee ioeiyt a el( p;(4trxrio iytfaDeaivi t)teumxm iydom nmivtatfarrmu onu0aet ifcils s2rauvs;t0texnxociytlmDr iei;t0srtrxmpno1optelietls)srrr( p;t4ape io3iydlmDumuvo ()aleoiocia1lp   uei s) etr(opnu1lmeelfei s)aDtau  no4oltnii3iad s ra(ms u0 etrio3ty1oat lneo t0s2xrxopou1optelietat) rrrur ot0alxoifciyd a ranvo;(4 rxoir iatoateanei t teur(o3oy4ale mnvia( s2tmurpou4apto ocilslm em( o (0teermf iodlmDeauvil()srxmirpnu4lmee net ()a2trx p;t0alxnifetlsfa uluvont0alenifcoa1lpD aieo (  2tmxm io1lm nmictas) 2trxmonu4olenmiciysls2uanvonu0aeenxrcoodfmDrlivo;t srtmiopou1lmtnmfviatf 2rm(mpou1aetn fcildla2umnmp;u4tlerxf3ia1oa r nei;( seuoxo io1opeemietl( srrau o;u0oltn f3iytlm eaumon() rxnmf3iodlptr nvo;s) exoimpio1ap emnvil(fsDrr( poo1tpen f3iytls2rl(mpnt4alerio iydfmt  uvi;()s2uo(r oo4lpt lnctl( aDtaump;o1tptn fcildls2rmumsnu) ltrmo3iotopDranes;( trto(opoudal nlncsl() 2rmx  ou1tltoiociys s el(ms t) lermr oo1oateanes;s0 rtmir iu1amt mivs (fs2tmurp;u4tlxomoeiadfm ra(ms t)tlermo iy1lmDelu ols0 rxr(rpnodapenmfvsls)a2ta( pno1alx ioctasfaDrlnvpnt0texnmrcootla eln s ()tetmxr nodameelneil(fsDrau p;u0alxoioeiad mDumn snt0 exomr3iytoa eaivo;t)trxmim iu4amtemfesls)sDur(r oo4apeomfetytfs2ul(vsnt)arermr3iatopDeaueo ( t2xrxopio4lltnlnvsa(f 2rr(mo;t0tltomfcilt m eluvp;(0alxnxf3oadlatr i o;s)sexmxmpnydamenlnes t)s2tau oou0oex moctysfmDum(vs t4aeerxocoytfaDe ivi s)srxmiopny4lltnmnci tfsDtaumpou4tleo o3iydlm2uau p u)arenmr3iotomD  uvi () eum(r3nu4ll   fvsl( a2tmxroot0opto ociadfs emu onu)treniocty1fatrlivsl()s2xm(m no1apt lnvi sfartrumooo4tpxnmociad m uaumo;u)texnxf oatfmtr n s;t) euoxmpiy4alt miet s aDrmxmooo0ale iiciydfsDrmn snu0 ltnxr iotoaDe nvol() euoio3iu4am emfciat)s2urxmo;o0opto i3iyd a elumsn(0 exnmfcoydomt  n o;t  etm(rpnu4opee ivsat) rraur oo0tpe mietasfaDumn o;u4 exnxr oo1opte nes;s)t2xrim iy1lmtn nct (faDrax ono4olxn feiys a rau pnu0 rxnif ty1lmt aivil( seumxr3ny4lleemicilt aDra(mo;u1aleo fetasfaDuan p t0 rxnxf iytfm rlneo s0 2trxmpoy1lleelnci t)srumx p;o1tpeoiietltfaDrmnmonu0 etrio oodfpDeli i ()setmxo io4aptnmfvslsfa2rm(root1oetn ieiysfs2uauvo;t0 leoxr tatomteli slt0 ruoxr oy1lptn ncta(f 2uaxr ;t1alxnmieiad s2eaumo;t0aetoif3oydomDe uvi t)srumxr ny4olenlici s artr( ont1texo o3tad m2elnvs ()texrxr3to1omD  u o;s)t2uoir3nudlpt mfvil() 2rrum ;u1olt if3ils aDeau p u0 ltrxr iatoaDeaneo ()seumxr3nudlle  fviat)aDrmur nu4oltn o3tasfa rmuvp;u4trenxr ootlat li sl(0texoimpno1aptemiet s) rtaxro;u4tlxnii3ias aDul( p;u)trenmfcootfp e uvi;t0 2xoxo iu1aptn ici s s2raum no1tet  i3tldfm2rluvo (0aetnif3oadla e n o;s0s2xmim io1aptelnes tf Dtmu p;t4tltnmocilslm2um(mpn(0trtnxf3ty1op ranvol() etmxr3ny4ll nlfcsls sDum( ono1tltnif3tadfs emuvont4aeenifcoydoa rlueo t setoir3iy4apeemnct s s2ur(moou4aet mfetatfmDrlu o;u4treomfcta1lmD aivols0 rxr(mpio1ole lfes s)s2rm( pnu0tlt  f3iytfm2ra( s u)arxrif3to1fmDeluvolt  2ur(r3nydom emfetat)s2rm(  nu1olenioctadls2rmuvs t4trerxf totlmD lneol( setoxmpou4ll elicsas  2rmum no1oee mociasfs2ul(mp u)aeerir3iodlmD  ivo;t0 2tmxo3iy4llen net tfarra(rp;t1optnmocias a ra( o u4arxnxo iydfmtr ueslt0sexoxr iu4op n fetat)srumxrp;t0aetn i3iaslm uan snt)trxnir tadlaDeauvsl( s2uoxopiy1al  mietlsfaDua( p;t0alx  feiyslm2umuvp;()arxriocto1lpt  nvi;() rxoxo oo1om emics t  2uaumoou4tet  iciydls emnvp (4 etomr ta1fmDraieo;(0trtoir3nu1omeelfctlt)sDua( pnu1tpt iictlsls ranvo;t)trxomocoodlate ivs;s0 rtrio3iydamt mnetltfsrtr(  ;u0opt iietadlm raums t0teerxr iatopte uesls)t2tmxm iodoptelnesa() Drmurpnu4aeenifeiys aDrauvs t0trxrmo oatlaDe u sls0texmim ny1ale mncs s) Drmu  ;u0tetomo3iatlaDrmumonu4treomo io1fmtelu i;() exo(o oodapee ietlsfs2trxm nt1ape  ociydfmDran s;(4areomo3oo1lpDrlnvil(0sruoim3nudllee ivsls a2umu  ot0ale ifeiadfa rl(vs;() rxrmr todoptrliei;s) ruoimpiodaleelncslt) Drmxro;u1ole mfetlt s um( pnt4altnxocta1lmDe uvo;t setr(mpoy4oleemfesa(  rum(r nt1olt ii3tydlmDum( snu)artrxo ty1oaDr nes s s2uoxr3oodalenlnvtlt)s2tmu o;u0olt iociadfm2uaumo u)alxrio oydfmtr n il(0s2um(opno1lle lfetatfsrrmum nu1tptn ictls mDrluvo;(0alxnxo ia1oat  nei;s  2trio no1amen ivta( a2taur ;t1ope mfeiytfa eauvs u)tetoxf ia1fmDe n i;( s2uoxm3ny4alenliet t)aDtaxmono1olxn fetys sDemnmpn(0 lxoxo3oo1op ran ils  eur(m nu1apt mfvtlt)srrm(r nu1tleniociltfm ranvsn(0 eerxrcoadop   n o;(0 euo(o ny1omeelfesa( aDrmxmonu4alxnmoetyd m2rau o (4arxnif3oytlaDe u ols)srxmir nu4lmt mieia(fa2tru  ;t0alx ii3iytfm emn pn(0alenxf3oo1fa  luvils  rxoim iu4lltn fei ()s2rr(r ou4apxnmi3ildfmDem(ms;u)texnmoctydfm elu ilt  rxo(m ny4omtelfct s a2trx ono4oetnioeiltla2em(vs (0 exnxociy1faD  i i;t  2xrxmpnydoptn fct t  rrru pot4tetniieildfm rmnvo;() rxrxf3todom  auvs t0tetmimpiu1apeemnet ()s2tmuro;o4aeeomoctadfm rauvont0artoxfcoatfmDraues ()srxmxr nodll nlnvs sfa2rru  ou4tlxoio3iltlm ulu sn(4 lxrmfctadfm eaieilt0sruoxr3nu1alt mfes sfaDra(r oo4opeoifeils s2rmnmo u4trtomrcty1oaD anvo () rtoim3oo1al elncsa(faDrax  ot0oeto o3iydlsDuau s u4tetnxrcia1latrlnvs s) etoirpnu4alt  fcslsfaDuaxroou1aee ii3tadfaDuau snu)tltnio3oo1opteln o ()s2toirpiudom   fesa(  Draxr oo4teeomictatla rmumo t) rtrircio1op elueil()seuo(rpiy1altelnvs sfsrtmxrpnu1olxnmf3ilt a rmu o (0tlenir3iodlmtrai o (0t2tm(r io4om  mici s)aDtm(mooo4olxoiieiltfa eaumpn() exoxf tadfat lu o;t)teuoxrpiu4ap emfcs s)sDra(ro;o0tlen oeiytfs2umnmo t4altnmfcta1opDeaues t0t2uoxmpou4om emfciat s2tmum ot4openmi3iydfmDrmnvpnu)trenmo3ootlmDr nvs ()t2tm(o nudlltn fvsls)srtax o;o4apxn octltfmDrlu o;u4 lxnif3tatlp eanvs;s0 ruoxrpoydlmtelivsl(fartm( poo0tlenmfeildlm rlump;u0trxoxf3oo1lmt lies;() 2xrio oy1amt mneiat) 2tmurono1altnmiciltfm eanvp;t0 lenir tatoa  luvo;s) euoxo3nodaleelivsa( arrmx  ot1open o3tlt mDranmp () etrifcoytlmt li s t t2tmxo3nu1al n feta(f rur(  nt1oltomieiatlmDrmumo (0aexnmr3oytoaD anvs t0trtr(m3iu1ame licsls)sDraur no0tet  oetldfa rm( on(4 lxnir iy1lmtrlivols)s2uoxo oy4am e fcilt s2trx  ot1optoiocilsla ea(mont4aeeoxo3iydopDeli il(0seum(mpiu4ll nmfei (f rrau o;o1aee mociys m emuvs t)tetrxf3io1fa  ln i;s  etm(r oy4op e ncsl() 2uaxmp;o0alxnio3iad m rlu p;t0 rtnir3iydlp rlieo;t0srum(opny4ap n fes sf 2rr( o;t1tlt iiciatls2ran p;(4 rxoircia1om  aues;t)srtmxm3no4lmtnmnvia()srtau pou0tlto feiasfsDul(mpnt4aetrxrctytlmDeaieo;t)s2to(rpiy4lm nliet s srtau  oo1tle if3iysls ra(mpn(0trtoiocoatoaD lneo;s)t2xmxmpno1ll   icsasf Drmu ono4oeeomo3tat m2um(ms;t0teenif3ty1opD lu o s trumir3no4op nmictls sDtaur ;t0apen oetydlm eanvo;t4 eerxf3iodfa elnvil( srxrir3no1ap   nvi s aDta( o;o1olt ioctadfa2uln s t0treomf3iatfa e ieo;(0tetrxr3iodal  mfeils s2ur(r nt0tlt iictat mDranvs;t) reoxf3iy1fp  ln ol(0 exr(mpiudom e fcia(  Dtr(  no0opeoiiciys a2rmuvo u) lxnxf3oy1fp r ivsls)teurxr3nudll nmnvi s) 2urxr nt4apt  i3tat s rlnvsnt4 eeoxoctydoaDelivs;s0seto(opnydol e fviltfsDrrurpou1teenmfeiadfs um( o (0treoxr3oodlate ivi ( s2xrxr nodaleemncilt) 2tr(mp;u4aexoii3iat mDemu o;t0aeerxfciotom  anes s)srurxm nu1amtelivsat  Draump;t1tex mieiadfaDem( o;u) rxnircia1fat au sl( texr(o oodap nlivs (f Dur(  no4apxn oeiadfsDelu o;(4 lermo3oadfmDeau s ()teuoimpno1lmenmfcs (fsrtru ono4aexomo3iat aDemnms u4arenirctydlmteliei ( srtoxo3oodoltemfci ()sDtr(r ot0aptn f3tys a um(mo;u0texrxf oodfp ranvi;()trxo(m3iy1ll e nei ( artrurono4tltoio3ils a2rln pnt0 rerir3iy1lp  aues ()tetmirpiu1lpenmivtl()s2tmurp;t0oeenmf3iasfa emnms (0teenir iotoaDeaneo;(  2xoim oy4olee fcil()a2rm(r nu0apt  ictas sDuanms ()alxnxrcoadlpD  ivo () ruoimpiodoptn fvslt  rua(r oo0opx ifetld mDuauvo () ltoxoctotfmtrlneils srtr(o oudllenlicsatfs2rruro;o4oetoif3iatfaDua(vo t)tetrio3oo1lpDeai sls)trurio3oo4lp elnvtls) Dum(ront0teeomo3iadfm2umnmonu0trxrxr iytlp  an sl( srum(o oydll e ietasf 2taumont4optomoctatlm rlnvpnu0altoir ootoa r nvo;t)srtoxo3ou1lmte nvt () Drrumo;u0oeenmocilt a2um( snu0arxoir iotoaDraivilt0srurir3iudal emnct sfarrrx o;t1oleniiciyslmDulnvsn(0alxomrcootopD au olt s2um(rpiu1lmtnlictas) ruaxm ;t0alx mo3tydla eluvs u4 rerircio1fpte u o;s tetm(m3nudlpeelfcsat  2umu  ;o1tpx mfetytfsDelumont4texnmf iadlmDr uvs ()t2tr(o3io4op emics s)sDtaxmpot0tltnioetytfa2rauvs u4 reoif iatlp rlieil( t2trxr nydapeemfesa(f rtrumpno4aeenmo3tyd m2ranvp;u4tlxrmr iodfaD lues t0seto(mpnydop  lieilsf 2trxm ;u1aeeoioeiatlsDulu on(0altoif oydlpt lnvilt0s2uo(m3io1lpte nviasf rua(mo;t1texnif3ild m ea(msnt4altrifcoadlmDran sl(0 2tm(mpoy1open fvi () Dtauro;t1apx mf3iatfs2em( snt0teerxocio1faDe ivil()teur(opnu4optemfcias a2rrx  nu4olxo oetasls umnmp u4 etnxr tydfaDr uvolt0teurxmpiudap nlieslt  Dra(mo;u0apen i3iasls2eanmo;u4 rerxr3ty1fpDeaieilt sruo(o3no1alt  nesas  Dtm(r ot4aexo ieiadfs rlums t4trermrciadomDrai ils)t2tmxrpoo4olen ivia( sDtr(mp;t4oetnmo3tysfs umnvp ()trxoir3oydom elu s t) rxr(o3oydap  lfeil(fsrtrx ont4ope if3tadfa eln p t0 lxniocoadoaDelueo ( t2xmxrpoodap   ictltfsrtmxm ;u1aptoioctls m2eaump t4altomociadlpDe ueol()trum(o3oo1llenliet (fa2rm(r nt0tpe  f3iys aDul( snt4aeenxr3oodoaDraueil( s2xm(r3oydaltelfvias)aDrrumpno0oetniociydfm umu p;t4alxomf3oodopD aies;t0t2xoir3nu1amtnmnetl(f 2rauroou0tpenmi3tyt mDranvp;t0 lxrxf iytfat  neol(0truoio3no1alt  nvta(fsrrax  ot0olt if3iltlaDemu onu0 etoir3oodfmDraneo t t2umxr3iydamen nvtl( sDuauronu0alxnif3iaslm2emuvp u4 exrxrcty1la r neslt  2tmxopnu1om  mivt s) Dta( pou1teto o3ias a2ua( p (4 lerxr iadopteln o;s0s2xrio3ou1altn fcil()aDtr(m nu0tleo iciytlm2rmu pnt) renmrcoo1oate n sls srto(r io4openlnctlsfsrrmxmont4aleo ietlt m rmumsn(4 leoir3oatoaDraues (0 rtr(m3oodll emfesa( srua(mono0tpenmf3ias m ranvo;t0aexrir3ta1om   neo ()srum(o3iu4al e iet ( a2raurpnt1alto fciatfa2ra(mon()tetrif3iotoptraieols)t2umim3iydllt mfcs tfartaumo;t0alxomf3iad a2ranmsnu) eenmfcoatfpt anvsl( t2toirpno4al  lnvsat)aDrrxr ou1tpenmoeildlmDrauvsn() ltnmr3iytla  au s (0 2ur(rpiy4llenlnvsls srtaxr no1texomfeiltfs2rau pnt0 rxnif oo1laDelneolt)trtr(m oy1olt mncia( arra(root4oex  ociysfsDelu p (4tlerxr3io1op  aneols0 2to(r io1ll  mnvtlsf rur(ro;t0tle  oeiys m2elu o t0aeermf ia1faDrluvi () 2uoir3nu4aptnlictat artru pno1tpx ioeiytlaDrm(vo;() exrxo3iatopD  uvi;s  2toim3oo1ol   nvilt)a2uaxrpnu0tetoifeiat sDua(ms t)tlerir oy1lmte ieil()trxmimpio4amenlieias s2trum ;u4tpe mociys aDrau p t4 eeoxrcootlaDeliei;s0t2xo(opoy1omtn nvt s)artrumono1oexo f3iltlm elnms u4 lxrir3ty1op e iei;t)sruoir3nodomtn fvsls srraxrp;t1tlxnmietatlsDelump (4arxnxrcoatlpDeln s t0setm(rpiu4ape livtlt)a2umu o;o1open ocilsfa uaums t4alerir3tadop eaieils t2xrio3oudoleemnes (faDumumooo0tle mo3iadfs2um(vsn() eermr ootomDe u i;t  rurxr3oudopenmfetatfa2rax  ot4tpt  f3ilt a2umn p u)aeeomf3ta1la e neo;s) exmio3oudllenlict tf 2rr( p;u0alxn iciltla uanmp;u) ltrmo tytfpt liei;( t2xm(m3iydlp emfet sfs2um(r ;o1tltnmo3iltlaDelnvo;(4aetrir tydoa elivil(  2umxrpnudaltelies t a2ua(m nt0tpxomo3ias s uaumo;() eeoif3ia1oa rlnvs;s  etoio3iudal   netasf 2tm(r ;o0oleoiociyt a2uln snt0 rtnxocoadlpDr n s;s0trtoxopio4openmict s)arrruroou1aptoioctatfm2rmn p u0areomrcia1op eaueo;t s2tmir oy4lmenmicsltf Duaxm ;t1olx  f3ildfaDuluvo ()aeenxf3oytom raivo s s2xrxmpnu4om  lfctl( s2rr(mont0teeomocild sDum( pnu)teeoifctytfmDrlivils0trumiopou1lme  iei ()srur(m no1opeomietatlsDeluvo t0aexoxocty1lmDraivo (0srxr(m oydlp nlicsat srur( oot1texomf3iatfa rmuvo (4aexrio3oytoaDr uei;t  ruo(r3iudll elicsatfs2tm(mp;u0alx mf3ildla rauvp;u0aetrir ta1fmDrlnesls)setm(o iodol  mfvt () rtau  ot4tle mieiad s um( p;(0trtrmr3ta1fmte iei t)srtoim io4ape mivt ()s2rrx p;t1oeeo oeiadla2el(vo;()arerxo iatfa rlieo t) rtmxrpnodlmeemiet ( aDta(moou1oleoiiciatlmDul( p (4altoxf tytfmDr ivs;s0s2tr(r3nudopt lfetat  rraum ot0texomi3ildfmDrmuvsnt4tetrir ia1opDelivols texrim iu1opt lneta()sDurx  ;u0oleoifciadla um(vpn(4alxnmo3totlm  au ol( s2uo(r iu1lptnmnesas)aDtm(ront1olenmoetytfsDeau on(0altrxo oytlaDeaiei;t  eum(opnydopte nesls arrmxrp;o0apto ieiydfaDra( s (4 eenxr3oytomD ai olt0s2uoxm3no4lmtnlnvtlt aDtmxmp;o0oee mfeiatlaDumnmo t4 renxfciatlpteanvi;s0s2tr(m3oy1ll   fctl()s2ra( ono4olx  fctld a rmnvsnt0aetrmocoy1laDr iei t s2xrxmpnudlpee ncslsfsDumx p;o0altomictatfmDra(mon(4aexrmrcootom eauvo s)truoxr ny4amtemnvia( artmu onu0optoifeiltlaDelumpnt4artrxf3oa1lat lnei;s  2urxmpoo1olte nesa() rraxr ;t4tlxnmf3tad mDulu s t0aexriocoadfpte n s s0trur(m3nodlmt  fetatfaDrmx  ;t0tlen oeiasla2eanvp;(4arxrio3to1lpD li i;t0t2urimpoo4lm emivta(farrax p;o4opt ifetadfs2ra(vsnt0aetrmo3tatlaDranei t teuoxmpiu1lptnmncsa(  ruaxrpoo4opxoio3iatla2emumon()teenirctotop r ueols teuo(r iu4oleelici t) rumxmp;o1oltn f3ilsfa em(vp u)tlxrxo ta1op rlivi s0s2trxm3ou1alt lnctl(faDrmu ont0oetniiciadlaDul(vpnt0aetnir totoaD luvs t) 2umxo3nu1ope lfcias aDtrx  nt4oeeo ietad s eanvo u0 eeoxocto1oatean i (0s2umiopiodomtn ictlt)sDtau oou0aeen feiydfs ulumpnu0trxnif3iytfmtean o;s sexmir3io1lpe  nvi tf Drmx  ;o0tltniictysfm2em(vo u4teeoifciatomD ai o;s0t2xrxo nu4ol emfei s aDta( poo1oltn i3ias mDul(vo t0 exrirctydlptr neols)t2xmirpnu4amtemfcs t)a2urxrono1tpt ifciys sDrm( sn() eenmocia1omD aneo;t teuo(m3io4ape lncsasfsrtm(mo;o0apeoioetysfa rl(vp t)tetomf3iatlmDeluei t0t2to(opnu4aleelfesl(  rtaxroot1tetomocilt aDuluvont0 lenmo ia1fp rlu slt0seumimpnu1aptemnvs sfs2rau p;u0oet if3iad m ran s;(0 exoif tatfm eaueils0 eurirpoo1llenmnvt tf Drr(mp;o1teen iciysfa2rm( snu0 rtnmf ia1lm   n s ( srto(m3iydlm nlfvtat)aDraxr oo4oeeniietatlmDrau o;(4artomfcoodoa rau ols  exmxr oo4omtn nvtltf Dua(m ;o1alen fcilt m2uanms u)aexnxf3totlatr ieilt0seur(opiy4apt livi s)arrrurpnu0aleo f3iltlaDelu ont0altrio io1fp r neo t trtoir3no1aptnlietl() Draur ot4aeeoio3ild s2rlnmonu0aeerxr3iadoateluvs;s) 2tmim3oy4al  mietat)arrau  nu1aet io3taslsDelu pn(4 leoio oo1op  auvs s0t2urimpiu1oleemncsatfsrtrum ;t0texomo3ilsfm2ranvpn(4teeoxfciotop raieolt)s2uoxr3io4lptelfvilt aDtmxmpot1tle ioetad sDra( ont0 lenio3tydfpteaies ( trxoxm3ny1oltnlivt t s2ururp;u1ole io3iytlm ranmpn(4aeerif3to1omt  iei;t s2tmxo no1llenmicils  rur(r ot1apxn i3tys mDelnvs;()teeomo todlatrai s;s0 eto(m ou1lleemnvi ( a2ra(rpoo1tex  ictyd s rmumont0tetoir tadfmtrluvolt) rumiopnydlptn fct ( a2um(mono0oleoii3tyt s umn o;t4aeenmocoytlate nvils s2um(m nu1am eliesa( a2tm(r nu0olenifetys m em(msn(0artnio totoate ueo s0t2uoio3oy1lleelictat s2tr(r ;t1tpen ictys aDemnvsnt0tlenxf tadfmD lieils0srtoio nodolenliesa( s2urxmpou1opxoifctldlm2eln ont) renmrctadlm eau o s)t2urxr3iy4aptnlneilsfsDta(  ;u1olxomietys a um(vsnu0 eerif3iydop rli s;t teurio3oydomenmictatfarrm(r no1tpx ioeiytfmDrm(ms;(4arerio tatfp rlueil()srumiopnu1ome mfesl( srrrxmpot0aexnmiciat a2rm(mp;t) exrxo oytlm  aivols s2xm(o io1omenmictltf Drr(mpot0ale moetldla el(vp (0 lenio totlptranvsls teum(r3io4lptnmfctas)aDtr( pnu4alxomo3ilsfa raumpn(0tltrxf3iy1op ean olt t2ur(opio4oltnmnvi s)sDrmxm ;o4tle ioeils aDem(vp;u4artrxr3oatfmt livolt0seumxo ny1amee fvsas)sruauro;o1alxn icias aDemuvon(0texrxo3oydoaDranvils)trxrxm3iy1ll  mivias) rra(rpot4oeeomoetltlaDrluvpnt)tetoxocoytfmD  uvolt0teuoxm3nudomenlnvia(f 2um(ro;t4tlt mietydlsDem(vs (0arxoirciy1lm r iei;s seumxrpiu1ol e fvilsfarurxr ;t0tet  o3tatfaDulumon()trtomo iydoatran ils) etrxr io4al elfvi tfs2tm(r ou0opx  fciad aDemuvo (0artomo ty1fp eaivo t0 2xm(r oydap nlici ()srtm(mp;t1oee ifciyd m eau pnt)teermr3iydfa elivo;s)texr(r3iy4lm elnciatf Dta( o;o0texn octatlaDrlumon()arerxo oytlptraivi;t0tetoxmpoodameelneia()arra(mont1tpenmfcias a2ranmp u)tetrxo tadoaDrln o ()srtrim oudamt mnctlt)sDua(m ;o1opx ifeiaslaDelums t4tlxomf3oadlpDeaiesls0s2toxr oydal nmfctl( aDtm(m ;t4aex ifciydfs2rmu snu0aexrirciotla e neilt)t2to(m3io4lptnmnetl()srra( pnt4apeomfctldla elnmpnu)tlxomocoydlatraivs;s)srxr(o oodllenmivtasfaDuaxmooo4oex  feiasfmDuan o (0aexoif iodfpD  ieils) eurio oo4lle lieia(  2taump;t0teeoioctadls emu ont0areoir3oadlpDran i s0s2trxm3ny4openmicia()aDtau  ou4oexo feiytfm el( o;u)tltnif3tytfmDrluvs s  2urir3iu1amenlfcta(  rrmumo;o4apx mieiydfa rlu p u) leomo3iotfa e ivo (  euo(m3iodam nmivs s arrr( o;o1aetomfctydfs eaums;u4trtoircoatlaDeaieo t) 2uoimpnydlpe mieil( aDua(moot1oetn i3iytla ul(mo u) lenxr3oatomte u o s)s2urxo oodllt  ietlt srrmxront1tlxnmoetadfs2ulu s t0trtomf3oadopteaiesl( trxrirpnu1al  lnvia( aDuaxrpnt0apx iieiatfm2ean s;u0tlxrmf oadopte ues s  2triopnydameemfvs s srrm(ront0olxomoeiadfa uanmp u4 etrxo3tadfmDeanvi t0trxo(r oudolenlncs ()s2um(m ;t4tetomf3tydlm eauvpn()aeerxo3iatfm r nvi (0srxm(r3iu4op emnvt (fs2rrx o;o4aleoii3iat aDem(mo;(0aexrmfcootlpDr nvo s setm(mpoudale  iei s)a2rru ont0tlxoiictatfm rm( snt0 lxrmo oatlptraies t0 etmxopou4op nlieias)srurum ;u4tltnmi3tatfs2umn s;u4altrio oadfa  lu i;(0 2tr(r oo4lmt lfcils  Drrx pot0opt  ieild m2rmump;(4trtrxf3tydopD an i;(0srtmirpio1olt  nvtl() 2urx p;t4optnmoetlsfmDul(monu0 renxo iadlpDeai s ( srxo(o nu1lmen nvi (fsDtmx  no4aexn ieiadfm rau o u)tltoxrctydfmDrai i;(0 2xo(opoo1apt licils artaxmont4teenmociytfa2uluvo;()trxoxo3iatop rauvs s)t2um(m iydaltn nvtas) Drmumo;o4oeeo ictad aDrl(ms;()tlxnio3iy1la elueils) eumxo3io1optemictlt sDtrxr nt4tlx ifeiadlmDeluvo (4aetrmr oa1oaD ai i s  eum(m3nu1al e ieslt arua( poo0texnmf3iadla2emumsnt4arenmrctytopteln ils0 etm(r io1lltemiesas sDtmum ;o4tpx  fetyslaDeau o u0tlerxo tytlmD  uvs;t) 2xmio3oy4amt livi t aDtau oot0oltn ietytls2eau pnt)tetniocty1omt anvi;s t2trxr oo1oleelfvs ( sDtmumpou4tex mfeiatfmDumnmo ()aexrmocio1omt  ivs;t srtrir iodaltnmivtasf 2um(r ;t1olxoioctltfa ul(mp;t0altnxocootfm e n s t0srur(rpiy1ape lfeta(f Dra(m nt1aexniieiyd s el( pnu0aleomf oo1oa e n ilt srxoxmpnodlm  mnvs sfsrta(mp;t4apen ictadlm rmums;u)aetrxrcoo1latelnei;s)teur(opiodll e neiat srua(  nu1aexn fctydfa umumo (0tlxoio3iydfpDeanvi;( setm(r nu1oltnmicil( sDraxm oo0tlxn i3iyd sDua(ms u4 rxoio iy1fptean slt) rur(opno4omeemnet ()s2urumo;o4aleomfctadlm2rmn o ()alxoiociatfmD lu i;s0 2xoir nudomtnmnvs tfaDrmumo;o0oexomo3tytfmDrmnvp ()altriociy1lmt aieo t0seum(mpnu4am n iciat srta(moou0olt  o3iadlsDuau o;u4 rxrio3oy1fa  ai o (0sexrxm nydlpte ncsa(fs2tr(m no4oexo feildlmDrlums;(4texoir3ootfaD  iei;s0texmiopoodameemnvta() rraxmo;u0tetnioeiyslsDul( pnu0tetnxo3iotlmt lies t)tetoxo no1ll nlfcil() rraxrpot4apxoii3iltfm2umuvs;u)artnmf ootlp rlu il(0sexr(r oo1om e ivs sf Drr( p;t1apeoioeiatls em( pnt0altomrcootom elneolt0teurxopiu4open ivsls sDrm( ont1tpeomictytfsDeanmp u4tetnircty1fpt an o s srtoxo3ou1lptelics sfa2uaxr ;u0alenmi3iysfa ulnvs;(0 rxomr oadopt lnvs s) rto(r3oy4apenlncsl( arurxrono1apx mieild m rlu p u0 ltnmo3iotlptr n sl( srtm(m nydaleelfctls sDuaumpno1oeeoif3iad a2rmnvo t)teenxo3iydlat  i olt0texmxo ou4omtelietls)s2tr( ono4aetomf3tadls rlu o u4 lerioctotlpDe n i;(0trxmiopiydol   fvil( a2tau pnt1olenmi3tatls2rln onu0altrir3iy1opD aies t0 eumxrpio1lm   nvi ( aDrrx ont1olt  iciadlm emu o (0teerxrctadlmD an s ()srtrim3oy1olen neias)aDrrumpoo4oltoioeiasfaDeau p (4 eenmf3io1fp e nes;t0teumxopiodol  lietltfs2rax  ;u1tltomo3tytls2eanmsn() exrxociydlaDe u s s0srurxm oy4lpt  fvslt)aDraurooo1optoiocilt a2ul( p;t4arxomf3iydoptr n ols0texm(r3io4open fesas)aDtrxm ot0tptoiieiyd a umuvpn(4texrxfciotfp  aieo;s0texrxr3iydlp n fvta() Dtmu  ;u1apt  oeiad s ea(von()altrmo3ootomt  n ols) etmxrpou1ol  mfcslsf 2ra(  ;o4tex io3iyt aDua( s;u)aetoxr iodlmDe ivsls0trxrirpno4ale  fci s)sDtmx ont0oex iociyslm uan p t4trxnmfctadlaDr ueo;t texrxo3iu1ope mivtltfaDtmump;u0apto i3iat aDemn s u4 rtomo iodoa   neil( srxr(m3iy1olt lfetat) rrm(m ;u1oet  oeiadls2rm(vs;t4tetnmociytlp eaues (0 rumxr3oodlpenlfvtltf rtm(ronu0olx ifctlslm um(mp u4altnif to1oateanvs;( trtrxo3nodlpte fetas aDrru p;o4opt mocildfaDrlu s;u) exrmocoo1omtrauei;t  rtmxr3nodlltnlncta(  rtrx onu4alxn iciytfmDranvon(4 exomr iadlmtrlieo;t0s2tmim iu1omeemfvtasf rurxroot0tlx  ociydfsDean p t)trtnif3iytfpDe i i (0srtm(o3iudllt  fcs t artrum oo0ale iiciytfaDrlnms;t4teerxo iatoate neslt0srxmxm3iudlptemnvtlt)a2rm(m nt4openmf3iyslm ra( s;t0aexnif to1oatr ieo;t)t2to(m3iudam emfcsat arumxmpoo4alxnmietadlsDrlnms;(0trenir todlmD li s;s trxrim3oy4ol nlnei tfs2urx  ;u4oet  icils m2ulnmp;t) rtomr3iy1lp rln s (0tetoxr3io4lmeemivs s aDrm(  oo4oet  fetltfm2emu p (4altoxocia1oaDr uvo;t trurimpiydlpt mivsls  2uau  no1oetoiictyd a2rmnmo;u)alxoiociytfptranes s0srtr(o3nu4lmt mncs s)arrrur nt4olx mietytfa ulnmo ()trtnxr iy1omt an ilt) etoxrpio4omt mfci s)a2tmurp;o1tpx  iciyd a2em(msnt4 rtnio3iadomtr n il( srtmxm nodlpenlivslsfaDurx pou4aetn oetld a elu o;t0 ltrxo iadfa rai s (0setmim3oy1oltemieta(  Dua(mp;o1oltoio3iyt s ranvsnt4alxrxf3to1oaDe iesl() etm(m io1am nlfvi tf 2urxmooo1texnmi3ildlaDul(vp t0arermo oodoaD luei (  euriopoo1llenlicia(faDta( ono1tpto f3tysfm uaumpn(4 rxomfcoo1lmteau olt  rurim3oo1om elicsa(fartmumo;u0oet mociytfs2ea( p u0 lxoxfcoytomte ivo t)s2xm(m3oy4lp nlieils artmxr ou4opt if3tlsls2eln s () lxoircio1oatr ueol(  2xo(opou1ol   ietas arua(mo;u4aetniieiatla2uanmp;(0trtnxf3ootfp eln ilt seuoxopio1opee neslt) 2trumpou1altnmfeiasfaDrmnmo;u0 etomo3iytlpD aieilt)teurio iu1amtemivi s a2rruroou0oet io3iyd a eluvs;u) etnxo3oatfpt  ivs;s0 2uoim io4olenmnvilsf 2rrumoot4tet io3tls a2rmn on(4aeerxociy1fm e i o s0trtoiopnu1apt  fvt t s2trum ;u0oltoioetas m2em(vp u0aeeoio3totfm   nesls) 2xoio ny1lp e ies sfsDrr(ront4alt mociytfs elums t) exrxf3ootlaDelivi ()t2uoxrpoodale mfesl( artaum nt4alen ietlsla em(vonu) eenxrcoy1fa elueo;s)trxm(mpiy1altn nvtlt)artmumpno1tex  i3iadfsDean on(0trenmf tadfpt lu i;(0trumio3ny4om n ietltfsrum(mpoo4oleo f3ilsfs ea(vo;t) rtomrciy1op   u il(0t2uoxo iodal  liei sfaDua(moot1tlenmfctytla rm(vp u4trtoir3iydfpD auvo;t  eumiopiudlmen nctatf rraumpno4aet mfetat m2rl(vo;(0altnio3iadlaDe uei;(  2toim3iy4ll emncsas)a2rr(rooo1teen o3iyt s2eln p u4aetoxr3iadfpD an ol( t2ur(mpiu4apt lietl()arrr( o;u0tltomfeiadfmDrmu p t0 etnmf3iodfate uvs;s)s2tm(r3oo1ale  fes (  2uau onu0aex mo3tys mDem( onu0 lxrxr iy1oat  ieils0t2uoimpny1ap  mfvias)sDrmxrpot1tpe  feild sDuan pnt4artomrctytomte uei;t) exr(opoy1lmenlnvslt)srum(ro;u4aex iieiltfs rmu on(4alxnifcoydoat livo;()tetrir3nu1opeemnctas) 2tmum nu0aexnioeilsfaDua( o u0tetoxo3oytoaD anvs s srxr(mpoudom nliciasfsruaxrpoo0aexnmiciydfmDum( s t) eeomf ia1la   ivo s)texriopnu4alenlnesat)s2rrurp;t1olxnmfeiadfmDumums t0tleoxociydoa eaneol( s2urxr3ny4lpeemfei (fs2rau pnt0oee mo3tld m umuvo (4 ltoxrcoodlp elnvi;(0sexmxo3ny1lle  fet tfsrtauro;u1alx io3iytla rauvp;(4tlermocoo1opD auei (0 rtrxm3iu1lmeemfesas  2rrxr ;o1aexoii3ils a2rm( o u0 rtnmf3tadopD ln i s  2um(o iodap n nct tf rtaxrp;u1opt moeiasls2rlu snu4aeeoxrciadoptraueo (0s2to(r3iudopt  fes sfa2rmumpnt4tltniicilt sDrlnmp u4trtrxf ty1lmtelueols0 rum(opiy4oleemivtl(fa2tm(  ;u1aptomociadla2rmnms;u)tlxnmo3iotlaDraues s  2to(m3ny4olen ncsasf rra(mpno4tpenii3tadls2rm(mon(0 rxoifctadlm  lu i ( trxoio3oodol  lies sfarraurono0altnio3ildlaDemn p;u4texnif3todomD aiei;(  etoio3io1llte iviasfsrrrumoou0tpx  o3tasfs rmu s;(4alxrmociydlmtrluvo s) 2tmxo3io1amtnmfes sfsDra( onu1tpxomictyt s2rmnms (0tetriociydlpDe ivil()srxmxopiu1ol emnvt s  rrrx onu4aet mo3ildfs rln s;t4 rxrxr oodoatrliei t  2urxo3nydam n fcsa(  Drau oot4openmfeilt a2rmnvo t4arxoiociydfpt aivo;(0 exmir3iy1lm nmfvsas)a2umxront0tlxn ieiltfs uan snt4arenif3oo1fmtrai i;t0 etr(r no1lle mivtlt  rtmx  oo0ole mo3ildfs emu pnt)tetnio oytop rauei t)tetmxo iudll nlfcia(fsDta(moou0alt iietytlmDra(mo;t) lxrxo oa1op  ai i;(0t2tm(r ou4opeemfes ()sDtrxro;o0alxoiiciydfa ranms u0 rxomo tadop rauvi;( texoxrpiu1altnlfcils) Dum( ont4optn i3ild s2elu s;t) rxrmf ootfaD  ieilt0seuoio3ny4llee nciatf Dtrxmpou0openifcildlsDrlnvp (0alenmrcty1oa r uvsl() 2xoxr3nydomen ici s  rtr( p;u1ape mfeiatlaDranvp;u) rtoir tadfpDe i slt0trxm(m io4ll emiesl( s2rmxm ;o1opx mocilt a rau o u0aexrif3iadfaDeaueil(0 2tm(r ny1olee iesls)aDtr(  ;t0apt mi3tasfaDraumon()trxomrcia1laDeaueils  2umir3oydom nmnctlt)s2ra(mpno0tpeomo3iyd m2umnvp t0aexomfcio1lm rau o;() rumir ny1am elnct ( a2um(m no1oetnioeiatfm emnvo u0trtrxr3tydop rai sls  rur(m3oodal nmncsl( srtrur ou4opeomfciad sDra( o u)trtnxo oa1fpD lu ol( srxrxopny4omtnmnvs ()arumxront1opeomietydlm eln pn()alxriocootop  au ilt)sexoir3oydlltnliei s sDtr( onu1ole ifetlsfm2ua( p t) rxrmrcoatlpDrlueslt0 ruo(o nu4om  mnctl(faDur(r ou0alenii3ild a ra(mon()trtrmr3tytla ranvo s)trxoxm oudole mfvsl(  Durx pot4apx io3ias s ea(vpn(4aeeoxo3iytlmt  i ols)s2toimpny1lp nmieil(fs2urur oo1aptnii3iys aDean pn(0arenmo oy1lpD livo s  2tmir iydopte fet () Dtaxr ;t0opxo o3iadfmDul(mp;t4 ltomr iytoaDrauvols)s2xm(o3nu1am emfviat)arumump;t4apt iiciaslm2emnvp;(0alermr oytfmt livi;s)trurxo oydap elfcsa(f rtmu p;u0tlxnif3iltls2ra(vont) lxrir io1fmt lu ol(0srtr(o nydop n netl(fsDumxr nt1aptn ieias sDumums;(4 etnmf3oy1oa   nvs ( t2xm(r iy1lleelivsatf rrm( o;u0aet micild m2rlnmont0 renio totlm e uvslt) 2xmxo3oudlleelfesat  rra(  ;t0aptniiciasfs ea( p ()aleomo3tatlm r nei;s0 etrirpoodlp   fetasfarraxm ;t0apeoiictltfa ra(vsnt0texoxr3iadlaDe u o;t tetoir3oudomtnmies t sDta(rpno1apen ieiatlmDeanvo t)trtrmr totoateli s s0 rxrir3ny4al emietasf rra( p;u4aetoio3tad mDua(msnt4arxoir3iatfa  li o t  etoimpoo4ol  liesas) rrmu  ou4ole iieilsfs eau o t0 eermr ia1lmtr n sls t2toim nu1alt  fct s sDrrxr no1oleomoctadlm rm(mont0 etnio ia1omDrlies () rtmiopoy1op nmncs ( sDur(  ot1tltn fctltla ua(ms t0aexomo3ootfa  lnei;s t2to(rpiudlm nmnct t)aDrmx  nu4opeo ietld m emn p (4 rtrmf3ta1fmDraneo;t) etm(r3ny4apt  fesa(fa2urumono0tpto i3iad sDranvs;u0 rxnif iatlateluvo s) rumxr oy1lpe mivil( sr
\ No newline at end of file
@@ -0,0 +1 @@
+ivilt)teurxm ou4lmtnlies (  2ra(mo;t4ape  ieilslm emnvo;u) ltnio io1oa r nei s trtmimpnudal   nct (f rtau p;u1tetoifeiydfaDemuvpnt)aeerirctadlptr u il(0t2umxopiydole  nvs (fs2taur oo1apt  ietltfa2emuvs t4 etnir3iotopt aieo s0 rur(opio4lp e nciltfsrur( oou4aet if3ias aDel(von()alxomo iytlpDeanvs t teuo(rpoudap emivtls) Dtr(rpnu1tee iieilslmDeln snt)artrxr3oytomtrli o t  2tr(opnu4optelivtat)aruaxront1tpxnmieiydfs2elu p;t4treoir oa1lpteli o s) rxmxmpnodame  iesas)sDtmumpou0tpxoifetlsla2rmumo (0 eenifcio1fmDraies;t)sexmio3nudoltnmncias)aDua(r oo0ale mf3iadlm ran p;t)trenif iotomD an s;t)s2trxm nydlm emies () 2rm( pot4oet iiciadls em( o;(4tlxnxo3iydfmDe ues t) 2xoxr3oo4lptemnvi (f rrm( p;o1apxo i3ias m2uaumo () renmr ta1lat aneo;t)seur(opiu4lpeelfctltf Drru  oo0oltnmi3iytfmDulnvs;t) rtrif iytlaD  nei;s)seuoxr3ou4lp   nctlt)aDrmur nt0olt mi3tat s2umnvs;u)trenxf3tatomDrlnei s  exr(r3no4lpenlfeia() Dra(  ou4oleo fcildla2ra(vo;u4arenmrctatop r ivs;t0s2toxmpiudopen fci ()artaurpno1tlx  o3ildfm2um(vs;u)aetrxr iotomte i o (0srtoxmpiydll   nesasfsDua(mont4teeoifctydfm rluvs t4 ltomo iy1latelu sls) 2to(o3io4apeemics s s2raxmpou1olto fetydls rlnvp;t) leomr3ootom ean il() etrio3nudop e ivilsf Draumoot1tpeomi3ils aDum( s;u4trxomo to1lm  aneolt) 2tmio nudlpeelnesa()aDtrum ou1aleomiciadla uln s (0 lxoxr iy1lmtranvolt)seum(m3iy4op n fcs ( sDrmump;o0oleoii3tls m2ean o;(4treomr oodfmt  nvi;( trtmirpny4lpt mfciat  Dtmx  ;u0tpxn o3tydlsDel(monu0aleoir3todom e n ols0srxr(rpiy4ll  lfcilsf 2uaurpnt1optomictysfm2rm( on(4tltoif3iydfmDrlu i;t0 rtrim oudale mncilsfsrtr(  nt1opeomicilt a2ul( o;t)alxoxrciotopt  uei t0 2tr(opiy4amtelfesatf 2rm(m ;t4ope ioeiyt a2ulu o;t) eeomo3oy1fp eau s () rum(opny1ll n fci (f Dumu o;o1tpt ioctltlaDua(mp t4artomo todlaDraueilt)srto(mpoy1om  micias)s2rmumont0aeenioeiadls uanvo u4aleoxociytoaD au sl()s2xrxmpny4lmtn ivsas aruax o;t0tee mo3ild s emuvo t4 eeomrctotomDeauvs (0teurxo iy1aleemics t sDtrurp;t0tlt mieilt m uan p t0trxrxo tadlm rai sls) rurxrpou1apen iesat) Dta( ooo0alt mfetyt s2umnvsn(4alxnmr totfatranvo;s0 2umxr3ou1ap nmieiat aDuaxmonu1apenmi3iadfs2ra( p;t4tleoio3oy1fmte nei;(0teum(o3iu1olt mfvslt)srtrum ot1tltnmociaslsDuanms u)arenircoo1oa elivs ( srtmimpno1om e ietat  2rmurp;o4tlt mf3iasfmDuaums t)trtrir3oo1fptrlnvo s s2umim nydlleemnct (faDtm(rono1aeto ietltla umuvpn(4arermrcootfmDr uei ()tetmim3iy4llt mivilt) Dumxm nt1optnmfciasfs ulumo;u4 lenxr to1lpDr ies (0srtoio3oo1ome mnviltfaDua( pot0alt io3tatlsDra(vs;(0aeerio3oo1om rai s;t  eurxm3nodaptnlfcsl( srra(mpoo1alx  oeiatfs rmn o (0tleoxr oatlp rluvs s0seuoxm iy1am  mietas a2rmxmonu4ope mietldla emn p (4altomf3tydoa   nei s  rtm(r3nudll elfvilsf Dumu  ou4tpxnii3iadlm ua(vp t)trenxr3iy1oa eauvs s  rtm(r3io4lptemict (f Dtr(mp;o1tetniocildfa2emn o;t4arxoxo3iotoa  lu o ( trtr(mpiu1aptnmnvsas sDtr( poo4opx  i3iadfsDumumo t0 rerxrcoo1omtrlivi t) rtoim ou1alenmfcsa(  Dtaump;o4tpe iocildfsDulu snu4 eeomr todopDelieol(0trtoxm3io4am   ietatfa2rmxro;t4oex mfetat m ra(msnu4 eerif3iydlmDrluvi t)t2xr(opny1ll  licsls  Dtm( oot0aetomiciatfa2el(mo;u0 rtrxr3iydlp  auvsl()srtmim3iu4lm  lfci (farumumonu1altoiietls s umnvp t0 leomfctatoaDrlnei s0 rxmxm3ny4lm nlnesl()srurxroot1tpt mfeiltlm2emuvp;u0trtoxociotfp e nvil(0trtm(rpny4oleemnesl(fsrtaxr nt1tleoiicilsfs eauvo;(0tltrmrciadlptr u o ()t2xmio3nudllt  fci ( arua(ro;o1tpen f3ias mDrl( on(0treoifcoytfmt  iei t) exmim3io4lp nmivsltfsruau pnu0oexomoeiatfm uaumsnt) lxrmf iadfpt  ivo t) 2umxm3ny1lmen ivsl(  2tmxr no4oet  i3ilsfs rau s;u)aleoif iy1opD ln ols0trumxm nu1al nmnesat sDrrur ot1alto ietad m2um(ms ()aeerio3oo1fm  an o;s) 2xm(r ny4lm elfvt tf rururo;t4texo octytlm2rl(vsn(0 leoirctydlptr ues ( trum(m oy4lmtemneia()a2tmump;t4aptnif3ilt sDeluvo u)trxrmo tadlm  ai s t0trxmio3iu4lmte ivi s)sDrau oou0tex io3taslaDul(vsn(0 rtrir oodlmtr i s;t  2tmio3no1llee iesatf 2urx  nt1aetomfciyt a2ea(mo;t0 exomr3totfa rlnvo;t0 ruo(o3iydlmtelicsas a2tmumonu1tltn f3ilt a2uln s;u)tetoxr3tytopDe u s t0 2xrim3iudaptn fes s)a2ra( oou0tpenmf3iyslsDea(mon(4tlxnmfciy1lmt li o s texrxm3no1lme mnctlt  2ua(r ou0opx iociatfa ra(vpnt)tlxnxociodoaDr ieo s  2toxr nu1am  mfei sfs2rmxmpoo1tlxoifeiad aDeluvpn(0trxoxrcty1op ran i t)t2umio3nodlltelnvia( arurx pot0tpxn f3tadls2rlnmsnt) rxnmf3oy1omtr n i t)texr(o3oy1open fesls artr(m no4aetoifeiydfa2ulu o;u) rermrcta1oatraneo;() ruoxm nu4lp n ivta(fa2uaur ou4tlxo ocild m2rln p () rxrmo3tadoa eauvol(0 2to(mpou4opt mnctlt)s2uau p;o1tet iieilslmDua( p u4 rxomr3oa1omtraivolt) 2uo(opiu4lpen nvslsf 2rrxmpno4oetn ociatfa ranvo;()aeerxrcty1lmDelu i;t s2trirpnu1op nliei s  2urur oo0tlxoiieias m ean onu0 reomf3oadoa  lieslt  etm(opno1om nmfct sfsDrmu p;t4aeeo i3ild a rm(msnu)arxrxocoatlmDeluvil(0s2xoxm iudlm nlivi t)aDur(r oo0oetoif3iys aDel(mpnu0texrxr3tytlpDr uvi s t2xoir3io4lptemieslt)s2ta( oot0opx ii3iysfs2em(vp u4treomo tadla rluvil( sruoxrpno1lpt  nvslsfaDurumo;o4oeto oeild a emuvp (0 rtnmo to1lp eanei t)seurio ou4ome lncta(fsDrm(  no4tle ifetysfa uanvsnt4 etomr oy1lateauvi s0 exoiopnydlptelfcsas aDumump;t0apx ifetasls2uanvp;u0teermr3iotoat an s t0 rxm(rpno4lleemfvsl()s2rmxro;o4alt ioetytla2elump t) exnxoctadoaD li ilt  rtrio iy1omeelnvia( a2tau poo4oleomo3iltfs2eaums;t)aeeomo tadop   ieo;t)srxm(r3oudll n ieiat)sDuaump;o0oex moeiytlm2eanvs;(0teenio tatomDr nvil(  2uo(o iodlptn iesls aDurxmp;o0aexn ocilt aDrmnmont4 rxnifctodfp  lneilt0srtoiopnudolenlncilt a2umur ot4oexnmi3ild m2rl(vpnt0 ltnircoydfm   i o t t2uo(r3oo1ap  mfvtlt) Drrxrpoo4oex ioetat s ra(ms;u0 rtnmocoadlpD lnvil(0t2toirpio4lptnliesl()sDumx o;u1oexn ociydfa2ulumo;(4 ltnif3oydomD ln ilt  2xrim no4ole mfetls)aDtrxmooo4aeeomi3iydlsDua(ms () ltnxf3iydlmDeluvsls trtrxmpoo1opt mict tfs2taurpnu1aeen o3tldlm ulu pnt4aeeoxociydop r nvs;(0srum(mpoy4amenmiei tfsrua( oot0teeoioetat m2ua(msnt0 exoioctatlp eln i;() rur(o3iudomen ictasf rraxr nt1alxnio3iat s2uanmpnu0tetoxr3oatoa ean s (0 ruo(r3oo1altn ncils srtrump;u0oeto o3ils aDeau p (4 lenir iadlaDeluei (0 2xm(m3nu1amee fvs sfarrax  nt1tex mo3ild s ul( on()trtrir3iotlmD lnvsl(  2xoxm3nu4aleelfvs sfsrtm(mo;t4teeo ociasfa ua( sn(0 rtrxf oo1oatrlivo t t2uoxr3oydaltn fcsasfaDum(  nu1optnmf3tytlsDelnvs;t0 lenio3oy1la  anvi;(0s2xo(m oudomee nctlt) 2trum nt1tetoio3iat sDemumo u) ltrxrctodop rln o;t)t2uoio3iy1ope mfeilt arta(  ;u1aeeomf3tasfs2umnmonu0texoio oa1fmteauvol( t2xoir no1lp  micta()arrmur ;o0olen feiyt s uln s;t) rtoiociatla  lnvi () rurxo nudomenmnvilt) 2rrxroou0opeoifciltlm2ua(ms;t4 renxr oy1opte uei;(0 2urxo ou1lle mfvs ( aDraxmont0oexnii3ilslsDrmu p u4aexoioctadfa  luei;t  rxo(mpoy4apt licia(  2ra(rpno0tpenmieilsfmDrmnmo;()tetrmo iytopt an i s0 2uo(o3nu1aleelncta(f 2rrxmo;u0tleoiocild aDrmn snt4 lxrir to1fp rau o ()t2tmim3iy1op elieta()aDtm( ooo1opx mi3tltfm2ua( p;u0artnmociodopt  ivi (0 2xmirpou4lptnlfcslt)s2tru  ;u1oet iietydlsDumn s;u0trtnxf ty1lmDr ies ( truo(r3io4amtnlfcs s sDrau oou1apto fciytfaDeln o;(0tetoxr to1oat lnvslt0 2toim io1olt  fcils)srua(rp;o4aet io3iltlaDuan o;(0teenxf iytlateli ols0s2xmxrpno4amenmnesas)sDur( pou4oeeo iciytfa eau o t) leoxf iotfmte n s (0tetoxm nudol   fetlt)artaxm nt1optn ieiadlaDelnmsn(4 exnir3oydomtr ivi;()sexm(m iudamtemncsas sDua(  ou1apx if3tyslmDra( o (4trxrxf3oo1fmDe uei;()s2uoxopiodom e ict tfartm( onu0opt iieildlsDuaumsnu0arxoircoo1lpD lies ( s2xmxo oo1op emfvtlt)sDurxmpnu4texnifeiytfm2emnvpnu)treomf iy1la  ln sls setr(m3nu1lp  lneta(fsDrmum ;t1apenioetyt m2rm(von(0trerxf oytfatr i olt0 2tr(m oudll nmfci sf 2ta(rpno0tpto ieiytfs rmn onu) lxnmr3oadfpteauvi s)trtr(rpiu4lp nmnetas)aDtrxmo;t1alx  f3ildla ua( pnt0tlenxrctadfmDr uvo t)trxriopio4lmtelieiasfs2tru poo0oeeo fciad sDrm( s t4 leomociydlpt  u s t trxo(rpnydlptnlivilt  2ur(  ;t0olenii3ias sDua( p (4 renifcty1om  anvo t  rxmir io1ll   fcsls aDrrxm oo1tpxoiietltls2em(von(4 eenif ty1opt  ueils) eur(opiu4ome lictlt)aDrr(m oo4aetomoeiaslmDua(vp (0alxrio3tytfm   nvslt0t2xmxm3oo1ol  lfeia() Dtmx o;o1texnifctas s umn snu)tlenxf oa1oa elivolt)s2um(o nu1olenlieia(  Dtr(ro;u0oee ioeiyslm rl( o (0 leoir3todfpD  ueolt)s2tm(r3no1lp  livi s)sruru pnu1aetnii3tytfa2ranmon(4aetomf totlm eaues s)setmim oo1ol nmneilt a2trumo;t0ole  ictatfa2ua( pnt)arerir todom elivi (0 rtr(o ou4lle  nvtl(  rrru o;t1optoii3ilt s2ua(vo;t) etnmo oo1om   nvolt0seur(m iu1op n ivilt)s2rrxrp;o4aeenifciat mDea(mp u) lxomf iadlpDrlieo () ruoxo3oudaptn nvsas  Drm(m ;o1teen oeild s ranmont0trenxrcty1om eaivo;() euriopiudlm  mfet tf Dum(r no4opeo ociytla2ra(mon() exomr ty1oat  i i s0 2tr(opou1am nmfvi s)s2umumoou0alx mociytlaDem(mpn()altomf todlp  lues;s) 2umio oo1oltnlnctl(faDuaurp;t0teeomfeiydfa2ranms;()tlenmfciadop  anei;( trtr(o iydomtelnvsl(  Dtr(mpot0tltoifeiydfs uluvsn() etnxf ta1lmD ln s (  2xr(m3iy1ope mnvta() rtr(rpno0oexnmociadfaDrm( o u4 renxf3oatopD lnvo;s) rxm(o iu1lm   fvsat arraxr ou0tptnii3tad mDrlnvs t0 rtnir tytlpte ivo;t0sexo(r3iydom n fetat  Drm(r no1texomoetysfm2el( s;(0tlxrxoctatfatrauvolt0 2xrxo oo1lleemivslt s2ua(m no1tex mo3iat s ea( s;u0tlxnmrciatoat  u sl( s2xm(r no4ameemfei ()aruaum ou0oeenif3tys s2emnvs;u0tetnmr oa1omDelneilt)trumir3ou4opee ivi sfs2ua(m ;t1tex iieiyt s2rlu snu)arxrir3ia1oa   ueo s)s2trir oo4om nmnvtatf 2umumo;o0tpto i3ias mDumn snu4 ltrmr3to1laD  i o;(0texoxrpno4ll  lfesas)sDumx ono1aptoii3tys m2rmumsnu0artrmf3oa1fmD luvi () exoxo ou4alt livsl()aruau o;u0opeomoeilslm2el(mp;()tlerirctydfmDraieol( seumir no1opt mivta( srurxr ;u0oetoiocils mDumn ont0teerxr3oa1laDrlnes;t0trtr(mpnodlpt  feslt s2uru p;t1opx mfciat aDuauvs;u0arxomrcoy1lp  livo t0trxmio ou4apt  neilt)srrmuront4ole mfeiadlm2el(vs;t)treomociytom eli sl( texr(m3oy1ol  lfcsat) ruaxrp;t4aex ifeias m2ra( ont)tlermr3oatfa e u s;()t2umxrpiu4lp  lfct tfarrau o;o0texoiietyd a rlnms;()trtrxo3oadfpDrauvo () 2um(o ny1lptemnvs t) Dta(  ou1oetnioeiys aDemumpnu0areomr3ia1opDrli s;(0t2tr(r3no4openlivta( sDrr( oou0aex mfeias sDuauvpn()texnir3iadfp  ln o t) exo(m nu1ame lfvi (farraurpnu0tltn oeiatls ra(mpnt)tltrmr3iy1oa rlieo t0trur(o3oydap  lfvsa(fsDtaxr nt1tetnioeiltlaDem(ms (4 etomo3tytfp eauvs;( srurxopoudalt  ietl(f Draurpnt4tlt ifciytfs2rmnvsn()artoxocoatoa   ivs;(  eumxr3iu1lltelfcs ()a2tmu o;o0tet ioctat m um(vo t0texrmf3oodfm rlivilt0 exo(r3iy4aptemicias sDrauro;o4oetnmoeiat mDulumpnt4arxoxr oa1fpD lnvo;s) 2urxr iudlp   nctlt)srumx oot4aptn fetatfm2rl(mp;t0alerxr to1fa rluvils tetmiopno1omen fci ()s2tmxrpot0tlx  fetadfs umnvpn()tlerioctodfp e uvols  etoxm oodam   ncsat)arraxront1texomoetytls elnms;u4arxrxf3iadfm eluvo ( truoir no1olt mivtat aDumx  ;o0tpx moetysls ul( s t0aexrif oodoa e uvs;s0s2toxm ny4lmtnlneiatf ruaxr oo1oee mi3iltfs2rl(ms;(0trtrxrcia1oa eli ilt)t2ur(r3ny1llenmneiltfsrrr(mpot4olt mieiatfm elnvs u4 etnio totop eln slt  ruo(o3io4ol e ics () Dua(monu1teen fctyd m eaums;t0arxnxr ta1fmte u o;s0setoxrpoudapenmnctas)s2urump;u1apxoif3ildfs2ulu s t0arxrircoa1fmtelivolt) rxmxm iudaltn net (  Dtmum ;t4tee  fetys s2emu snu4aleomfcoydfmtrliei;(0 2xmim iy1amtnlfvsatfs2taurp;o4tpe  fetasla2uaums t) rerio3tydom  aiei;s srtoim iy1llee ncilt) Dtmurpnt4tpenmo3iys m2ul(vsnu)altnmf oydfmteaivi t)s2xoim3oy1altn ivs s aDtmumo;u0opeo feiasfaDuauvs t4tlxoif oadfm rlneilt0 exmir3iodlmt mfvslsf ruaxmpou4tlxnii3tas s2el( pnt4 leomfcia1la rluei;t teur(m iy4opte nvta(fartrumonu4alxoiicildlm eln s;t0texoir3oadlpteau ilt)t2xr(mpoy1lpe  net t s2rrxmpno1apx mo3tydfm ul(vp;u0alxrmr tadlpt  ieilt0t2xmxm ny4lmtnmiei sf 2um( oou1apxn i3iysfaDrlu snu) lxnxf3iotomDrln i t)sexoir ny4al n fci tf Dtm(rpnu0alto i3tatfsDelnvs;()aeeomr3ta1omD lu sls)trtrir no4lm   fctas)a2uaumpnu0tlx iociys a2ul(mp;t0 lxomr iodoatrauesls) rxo(r oo4am nmncsl( aDrr( o;u0optomi3ilslmDrl(vsnu)trtoir todomt  nvs s0srtrim3iydome lict sfarumumooo1oeto ietat s uanmp;(4arermfctytfaDrau ils)tetmir3iu1lp elfvtas s2tmuro;u0oet  feilt sDrmnvonu0tetoifciytop r nvo;t)teto(m3iudlle  fci ()aDrmx ooo1olt  i3tat a rmu snt4 lxnif3totlp eauvols0 2tmio oudaltemivias)srrmumono1tltoii3tas m ul(mo;t)teeomo iatfaDelivilt)tetoio3nu1altnlnvta( arrr(rpou1tpen i3iasla eaumsnt4trxrxr3oadoaDrluesl() 2umxr nudomte nvils  Duau o;u0opxo ietlsfs el( p;u4 exomoctotfmtran ol()srxmim3oo1op n ieiltfsrraurooo1olt mfetaslm2eau onu4artrxf iy1omt ai o t0seuoio3io4lltn fct s a2ta(rpou1oeeomo3iyd a eaump;u0teenmrciodoaDeluvo;s trxmir iy1lm   nvsas)sDtm(r no4tpx mfciatfaDrm( s (0 rtoxo3oodopDe nvi;s0tetriopnydomt mieiatfa2uaxrpoo0aleo ociasfaDrluvsn(0 lenifcoy1fa  aivo;t0 2xrimpoy4om elncsas sDumuront1tpt iiciltfs2eluvp t) rtnxfcoydlmDe nes s  eto(o oy4alt  iesl()sDrr(mo;t1oeeomfciydfs emn s;u0arxoxr3iadoa e n sls)srur(rpoy4apt mfesl()srtmu pnt4oexnmieildls el(mp;t) lxnif3iydfaDr ies;( sexo(rpio4ap nliesltfsrtau  nt0apxomfciasfa2ulums u0tleoxf3iy1faD aivs;s)srxmxopiodam nmnei t)s2uaumpnt4aetn fcild a eln o () exnxf3iatomDe neslt)t2um(m ny4opeemfvil(farta( pnu0tpt ii3tas m emumo;(4aleoxociotop   ueo;s s2xr(r iudll nlfciat)aDraxront1teen feiys sDrl(vp t4aleoxr iatlate uvs ()srtm(o oudllenlnvta( sDtaxroou0teto ieiydlm2uaumpnu)tetrir ootfat anvo;t) rxoxm nu1lmtelnctl()s2rmu p;u4oex  ictadfaDuau on(0 ltnifctydfa e uei t) eto(m iydap e ivsat)sDta(r ot1alen fciysfaDem(monu4arermr iotla   i slt truo(r iydop e ivtasf Dur( p;t4aexnif3ild m eluvp u4arxoxr3oatoaDelues t) rxoxm3no1amt  nctls  2uax  no4apeoifctlsfsDum( snt4 reoifcoadfm   ivilt) eumim3nodlleemieilt srraump;t1olen o3tys m ea(vp;t4trtoxfcia1fmDe nei (0trtr(mpiu4omtelneiat)a2ra(r ou4aex ii3iydlmDua( o u)aeenif oa1fpt lnvi s)teum(m3io4op nmneslt aDrau  ;u0tpe moeilt mDra(vp;(0areoirciydop e i ilt)t2urxopno1optnlfvtas)aDtmx pot4apx  f3iadfm2umuvsn(4alxnmfciytfatraivo s0t2xo(r ny4ale  ieta( sDumum nt4tpenmi3tlsls ul( sn() rtrxr3tytfpD lneols)srtr(r io1opeemfcil(  Dumxmooo1apeoiicild a2em( o t4aetomr3oatopD livilt) rtm(rpou1olee neils)srtr( pnt1tpen feiaslm em(ms;t0trxnmo ootfmtrluvol(0t2xriopiy1lptemneslsfs2ra( pot4oltn iciltfa el( p;t4tleoirciydlmt  u s;t0 exr(r ou1omtn ieils s2um(mo;u4aeenmfetydla2rlums t) etoir ty1lp  li i t sruo(m3nydlpenlnvsatf rrau pou1ale iieiltla2ua( s;(4tlxoxr3ia1op  aues t srtoxo3iodop  lfei s sDtaxmp;o4alxoiieiat sDumu o (0teerircia1lmDraivsl()truoir nudol emnvsasfa2tmxmpoo0oetn o3taslsDumu p;u0tlerifcta1fmDe u i;t)s2tr(r3iu4lltemnci tfsDumurpou4aetomieiasla2um( p;u) ltoxo3oytfp eaivol( sruoimpiy1apee fviat srtau  ;u0tlen i3ias aDulnvon()tleoxo3to1lmt  nei;t0 rumxm3iy4lleemneia(f rtax p;o0tlt  fctat s rl( o;t0altniociadlm  aivi s)teuoxmpiu1olt mfeiatfaDrruroot1texnif3tas aDuan p t)texoxr iytlm   i s s)setmio io1aptn icsltfa2urx ooo4tee mfcilt a2emumsnt0tlerxrcia1fmt luvil(  2uo(m3io4ape mfci sf Dtrxronu0oltn oetadla2elnvp u0trtnxfctadomtelu s s) 2tr(opiodlp   ncsl(fs2ta(ro;t1alxo feils sDel( p;t4tlerir3oytla rluvo t t2umxo3ny4opeelfetl( srtm(r no4alxnmoetatfs2rm(mo u) etnxfcoy1fp rau o;s0 ruo(mpou1ameemfcsls srra(mont0alt mi3iyd s2el(vont)alxrmfctotoptrai s s0srxmxr3iudlpeelnvtlt srrm(  ou0tlt  o3iytlm2um( o;t4 ltoir3to1op eanei t tetr(o3iudame lncsas  rtmu  ;t4tpen ietytla2umn s;(0arxnir tadom  ln o;s0teumxo3nu1opeemnvs ()srtmump;o1ole  oeiasfm2el( o u4 rtniocoo1opDr i i;() 2xmir ny1lptemicsl(  ruau  ;t1aptoioeils m2elu o;t)aetoio3oadlmDeaivsl(0srxrxo nu4optnmivs sfarumx ono1aptoifetyslmDraums;t4tetoxo3ootfmDeaivslt  rxrxm oodolee nesa() Dum(  oo0aleomf3tlsfa2elnvpnt)altoxo ty1lp  lieils)trxoxm iu4ol n nvia()a2ra( pnt0apeomiciad a ul(vp;u4tleoirctydlatelivs t)srxo(r iu4lp n fviat sDurxmonu4altomoeiat m el( pnt)tlenmo oo1lpteanvs (0 2xoxopno1ope  neslsfsDrm(m ot4tlt  i3iysfmDemu p u) eerio3ootlate uvo (  eto(m3nudlmenlnct (farumxm ;u0tle mf3iadfa2um(von() lenircoytfpt  nvs ()t2xoxm3oudlm elnci t) rra(r ot0tptniieiyd s2eanvp u)teerxfciy1oatr ivilt0teumxr3ou1ap emfctasf Dta(rpot4oleomoeiasls2ra(monu)areoir iotlmtrlies (  2ur(m nydlpenlfct s  rtr(mpou1tle ifeiyd s2eaums t0treomr3tytlp elnvslt)t2tr(rpoy4lptelncs (  Dtr(  ot4tpen i3iydfa ua(vpnt0 lxoio3iy1lpt li s;s srtr(o3ou1lp   fes sfsrua(mo;t1apt ii3tlslm2uluvp t)areoxoctytfpD lies;() rurio iy1omt  ncsasf Drax  ;u1alx  i3iys sDul( s;()tltoxf todfptr nes s0 2uoxmpny1amee iei ()arrm(r nu4altn ictatfsDumnmp;(4aexomo3tadlaDelu olt sexrxopoudomtnlfvta() Dtr(ronu0ole ioctltls ua(mp () etoxociotfateln ilt0truoim nu4al  mivt sfsrra(monu1apx iocilt m emums u)tltoif oytla  au s;t0srxoir ou1omt mnvi t aruru o;o0aee ioetlt m rl(mp u0tltnio3totfmte nvi;( s2uoio3oy1om n nvtlsfs2raur oo1olxn fciadfm rmuvsnt0 etoio3tatlaDe nvsls0 exm(mpiu1omt mfci s) Dtmxr ot4openmfeiaslsDeauvsnt4altrmociy1fa  livilt) eumxm3iu1ll   nvsl(fsrtr(rpoo0olen fctysfa um(mo t4 lenmo tytlp  aieilt)trxoim iodlmeemnviltfsDrm( ont4opx  ieiltfaDrmnvp;u0 lxoxf3oadlatr nvs (  eurirpiu1lpt lfesatf 2uau pnu4tlt ii3ilsla2rmnvs;u4treomocoydfm rai i;t)s2xm(o3ou4opt mfesa() Draxr ou1aeenmo3tyd m ul(ms u0 ltrirctadfa   i o;t tetmiopoodlltelietat) Dtm(rp;o0oee mociyslmDea(mo (4arerxr3oytlpDr ivsl( t2trirpiodap e ncilsfaDtm(mpnu0texo i3ilsla umn s;u4 eeoir3oo1fptrau s;s trto(r iu4lp nmnvil()s2taur oo1oexomfciydfa elu ont4 leoxf3ty1la rlnvo;t t2to(o3iydomt mnvsls) 2trx o;o1aleomfciysfa2rmumpn()tlenxo tytlp eaivsls)sruo(mpny4ol elivi () rtr(ronu1olt mi3tltfs2uanms;t4 etrif to1fp  aivils s2toir io1lp n fciatf Drru o;o4teenmieiatlsDuanmsnt0aleoir ta1fa elnvi s) exrxo3oodol e iesa( sDrrxmp;t4oeeoif3iyt m emnvp (4 exomo3tatopD  ueo;s)s2xoio3iu4omtnlfcils s2rr( o;u4opeo fctasfm2el(vp u0aleniocoy1fp rai sls0 rumirpiydlltn nvsltfaDumxmp;t0tlxnmfeiyd s rmu p;u0arxoir totfptrai o t) eumxo3ny4opeelfct s aDrax  nt1opx iietld aDra(vp u)trxrmocty1la   neo ( s2uoxo iu1lle  ncias sDtm(mpno4teenio3ildlaDel( snu4artnircoytom ran i (0texmxrpnodaptnlivt tfs2tm( pot1tetomi3iyt m rluvsnu4 rtrxf iadoaD aueolt s2tmxr3oy1aptnmnviltfaDtrxm ;u0alt  icild sDra(ms t4tltomf totom  aieils0srxrxr oy1ll nlnetat a2ur( o;o0teeo i3ias mDrm(vs;t)aeerxf oydfpDeaiei;t0t2xoxopiydlp nlivi (  2ta( poo1tpt if3tysfaDrlnms;(4artriocootfpteauesls0srumxrpoy4amtn ies sfs2rr( pou0oee iocildfs2um( s t0alenxf oodfptr uei t)trur(m iudomt  fvil(fsrtmuront1tltn oeiys m2ul(vp;() etrmf totfaD ai olt  rtmir3nudam n ivsltfsDrmumpou0oex miciadlm2rmnmp;t0 renmr3oydlaDraivs;()texr(m3ny1alt  ncslsfaDrau ont4aeto ietadlaDrln o u4altnmo tatfaDeluvils0seur(opio1lptn fvt sfarrmumoot4apxniociatlm ean pn()artrxrctotfmt  i o;s0s2xmim ny1oltn iciat)srtrxroot1tpxnmfeiatfmDuanmp t4artrxr3iy1faDeauvsls)trtoio io4lp nlivtl(fs2rm( pou4oeeomoeiad a umn o;t4tlermo tatlpD aiei s s2xr(m oodame liesls) rrm(m oo1tex  feiysla ua( p;()aexomo3tadlpD aues;s) 2tmxopny4altn fvi (faDta(m ot0tex  ociytls2ua(vo t)texnmr3ty1op  an s t0 rxoxmpiudalee fctas) Duaurono0tlx  f3iys s2em(mo t)trtoxr3iotlpDe u il(0t2toir no4aptelfesls aDtrxm ;o4apt  f3iaslm2umu p (0arermo iytfaDr ies () rxm(o3oudll  lics sf rtaur nu1oeenifctadfa emu o t0texoio3iadoptrauvi;(  etmxopnu4lmt lieilt)sDraxronu1optoii3tytfa2ean ont4 rerif ootoptelivs;s)trurim3oydlptelfci s aDumur no0apx if3tasla eanvon(4tlxoio3oy1lmteaivi;(0 rumxopou4alenlivt sf rur( o;t0altn feildla ra(ms;u0trxrxf3tydlpt  i slt)t2tmxmpno1llen fcsl()aruaumpou1apx  octltla rm(mo;u4trxoxociadopD  uvs;t)sexm(rpiydalt mivi t arumu pno4tpxnifeiyslm2elnvs u0arxomf3totfmDrliesl(0 etrio3oy1op emfcsl(fartmx ooo4alt ii3iat s2ea(vs (4tetomfcoo1opD  i s;s) 2xm(o3oodaptelnctat)s2tax oot0alto o3taslm emnvs;u4trerxo3oa1fp  anvo (0trtmir nu4ol n fesas)arrrxmpoo0oetnif3tld mDeaump;t)arxoxo3iadomD au s (0 rxrxo3nu1ame  fet tfaDrmxmpoo4ape  feiatlm eluvsnu) lxoxf oo1lpDrai ol() rtmio iudlmtnmnesa( s2tr( ooo4tltn i3tldla2ua( o;()tlxoxrciatlpDe u s s0t2urio oo1om nmnctat sDtrxrpou4oeto ietatlsDel(vp;u)arenmrcio1lp   uvolt) rtrxo ny4ll  mncs t srrr(m ;t1aexnif3iyt mDuln onu4alenxf iadoaD aivil(0s2ur(r3nydaptnmncs ()s2umumo;t1olenmiciatlm2rlnmo;u4aexnir oy1fmtrln ols0t2urxr nodlme lieia() Duax  no1oeenmfctysfs ra(vs u0 etomf3iytomD aiesls)sexm(m no1ap emfcs s  Dumxrpnt1oex ioeiatfm ra(msnu4 etnmo3oadfaDr u i;t  etoxopny4lmen netat  2rmum ou1apeomoetas mDran o;(0alermocoa1fmtr u i;(0 exoxopoy1lpeelictl() Drr( pno0apx  o3ilsls2ranmp;(0tlenif3tatlpt ln i ( teto(o io1lpe mnetls  Dtrxrooo0olen f3iadfs2elu pnt4trxrmfcta1fpt li o;t)teto(m oydal nlnctasf Dtrumoot4ole miciyslmDem(mo;u4texrio iydop   i i;( s2trirpnu1lpen netatfs2raxm nt1opto i3iyd sDrlnvs;u0areoxr iy1lat li o t  rumir3io4lmtnmicsat)artaxmoou1oexnmo3iysls2ua(vsnt0 lxoif iy1optrlneolt s2xoirpio4ap  lies sfa2ur( ooo1opx  fetyt m2rm(vpnu0tlxoifcootopDelnvo t)seum(r oo1oltelfctlsfaDtmum ot4opxnmfciadla2uln o;u4 ltrmfcoydoatelues;t0s2urimpoo4om nmneilsfs2umxmpoo0optnmocild s2elnvsnt4tleoxr oo1lptrln o;s)t2xmxo ny1ll nmnci t) Dtmuroot4apt  icildfa2elnvo;(4 leoxrcoatfat anes;(0t2xmim oo1ol nmicsatfaDtm(m ou1oleo fctyd aDea( p () ltrmo iotlp   ivo t  exrio oudop elfeta( arrruroou0teeniociltfmDuluvp t0aeermo iy1om  auvi;s s2um(r nu4lmeelfcta( aDtmx  ou0aetoiieiat s2rm(vsnt0 rxoxo iy1lmDrauvi;()tetrir3oo1llt lfcia(fs2trxr ot4teeomieiysfmDuauvs;(0 rxrir3tydomtrln il(0trxmxmpio1aptelfcils sDur(r nu4teto ieildfs2ua( onu)aexnmr3oadfmDelnvi;( s2tm(r iu4llen fci tf Dtmu p;u4altoioctas a rmn p;u4arerxrciodoa  aieol(0trxmio3iydlpt  ncs sfsrtmx  nt0aexo ocilt sDeluvp t4aexnioctodfaD lnvilt0t2uoxr nodapt  fei ( a2rrum ;t4oexoifciytfm ra(ms ()trxoir ty1fpDe neo;t0 2trxo3iy4optelivt t) 2umxm nu4apxomfeiltfmDum(mon(4arermf tydfmtr neo;t texmxmpoydaptnmncia()sDraxmo;t4tltomieiasla eanvp u)artoir3oo1fm r u slt0s2uoxo3iudal   ivias) Dtaumpnt1optnmictld s2ea(vo;t)tetrxf3tatfateaueslt teur(opny1lp nlfcslsf 2umx  nu4texn iciad sDulu o t4texnir3iotlpDrlies;s)s2xo(r ny4lpeelnvias  Dur( pnt0teto ieiltlaDrmu s u) rtrmo ia1fa   uvi;s)trxr(o3no4om nlict tfsDrmxm no0oleomoetas sDeanmp;u4tlerxocoadlmteliei s  2um(opny1oleemieiltfsDur(r no4olxniicilt aDulnmpnt4 rxomf3tytla   uei;t s2uo(m iydllt  nvils sDtax  nu4aeto iciadfs uln onu)texoiociatfpD li ols texrim3oydllenmfetl(  rtaumo;o0oeen o3iys a2ea( p;t)trtoxf3iadfmD  ivo;t s2tm(r oudlpeelncia()srurump;t4teeo i3tasls2um(vs;(4teermf iydop  livslt srtrxo3io1oleelncilsfsrrmxroot4aptnio3iad a2eau snt)altoxf3io1fmte ieolt)t2tmirpnu4lm e icia() Dtrxm ;o1texn oetldlmDemnvpnu0arxnxociydlateanei;t)srtr(r no4lm   fvsls)a2raumono1opxoifetas a rm( p u0aeeoxo oo1lpDrli sl()s2uoir nudaptnlfvt t sDtm(mooo4apx mociyslsDumu p t)tetnxo oo1oatrlues;(0 eurxopiy4op   netls) 2ta(mpno4altoio3tyd aDrln p;u0tltnxf iatlmt aneol(0truoio ny1openmnei t aDum(rpoo4teeniictat s em(vo;t4artrxo iydlmDr ueols srxmiopoy1open nei tfa2ur(root0texn fciat a rl(mo;(4 ltrxf iatlptrlies () rtmxmpiodole  netlsf Draxmpou0tlx ioeiatfa eanvo;u4arxrxo3iodfmtrlueol()trxm(r io4lmtnlietlt)s2rrumpno1tet mi3ildfsDrlumo;() rxrmf ia1oatr ivo t) rxoirpny1aptemfvt sfsDum( oou0ope  oeiyt a el(vpnu0 ltomo oodlpt  uvsl(0 2trxmpny4apte netatfsruru oou1aex  fctas a2rlu pnu4trerxf oodlm r uvi ()srxr(o3nu1lpe mictl(  Drr(rooo1oltnii3tldla uau o;t4 eenxociadoate i o t0tetmxr no1lmenmfctas a2urx onu1aexnmfeias aDuanms;u0tltoxociatla  livs s srtriopny1lpen ictas sDrmxro;t1apx  o3iasfm eau s;t4 eeoxf3iatoaDeaneslt)teumim3oy4ll emncs s)aDuru ooo4aex mfctls a rmn pnt) etomfcta1fm  auvo;s  2uo(opoudaptemneils  rraxr nu0openio3tlt a ean p u0texnmo3todfmt  nei;()srur(m3oo4apeeliciat srrru ono1tpxnii3iat aDuau p (0tlxrxfctadlmt  uvi;( s2to(r3ou4amen ivi sfsrua(rp;t4oetoifctat s rau ont0alxoifciy1lat aivs ()srxm(opiy4altn fvtas  2ta( oou0tptnifetasls ranms;t4trxrio3ootomt luei s0seur(mpiodame mfetl( sDta( pno0olt ioeils s ra(ms u4trxnifcta1la elieols0 rumxm3nudom  livsas)srururp;u4teeomoctasls ulumo;t4 rerio3oodfpD  uvi;(  etmxopnydlptelnvil( a2uaxmpnt4aex moctlt a2rmuvp;t4 lermr oadlmDe neils s2uo(o ny1llt  ncsas)sDtm(  nu4apeo f3iatlm2eau p (0 renmo iotfa eauvils t2tmir ny4olen fctl(  Dumxmpnu4alx  ictytlm uaumsnu) eenmfciy1fp  aieo;(0t2umimpoydll nmiet sf 2ua(r no0oeeo iciatfmDemnmo;(0trxnif3iadlate n s (0 etoxr3iudlpt  ieia(farta(mont1tpeomfctyt aDrmnms;t)arxrmfciytfaDr n o;s)trxo(m3oo4lpeemivil(fsrur(ront0texomfctltfs2rmn o;u0trtnxrcoo1fpD  i s;( trur(o3iydal  micta(fsDtrurp;t4tle  f3tadfs uluvo;u)trxoxo3oatlpD  i ols0 etrxo nu1apt lfvtat)srua(m nt1opeomfcildlaDem(vpn() ltrif tydopD aueolt0 rtm(mpio4om e ics (  Durxrono1aex  f3tltls2umnvo;u0 reoioctotop elnvs;t0setmxrpoo1ol n nvtasf 2rruro;o4aleomo3tadfmDemums (4 exrmr oydfmDrauei (0 exmxr3oydll  mnetlt)sDur( p;u1aptomi3ilt s2em(mo u0 rtoxo totla raueo;t) exmxm3ou1ap  mivilt) Drrxm no0alenioeiysfm2umnvsnt0 ltomocoy1oa rauei (0sexr(o3iydope mietat aDrru oou4olx  iciatfsDra( p;(0altomrciatoptr ieo;t)srtoxrpiy1omee ici t)sDua( pou4tlx  ietadfm2ea( pnt0aetoxocia1omt  ieol( trtoxr3iy4lm emict sfarta(ro;o1tlxomi3tas m rmuvs u)alxomocoy1lmtrln ilt) 2toxo ny4optnmiesl(fsrrmx  ;u0teenmfciydfs2em(mo t4 lxnmocoydomte nei (0 eurxo iydoltelfes s srurxmont0olxo feiydlmDuan p;()trtnmr3tydlpDran i;t s2xoxo3oo1omtelicsat srtru  nt0tlenif3tyd aDuaumo;u0aleoioctytlmD anvilt0 rtmxrpoudlpt lfci (faDtr(r nu4tpt ii3iltlsDrmnvont)aetrxrciotlpt ai i;t0setm(m oudamenlfcsls)s2umx  ou4oet  oeild s uan snu)aleoxocoa1lm   ivi s t2uoxr no1apte ivi ()srumum ot1oleo fetltfm2ranvp;u4arxrmrcta1lmDe neo;()t2tmxr3oo4op  lfesasfsrtrurono4oexomfciatfs2el(vo u4 eeoxo oodopD  u o ( trtrxr oy1open fctls) Dtm(m nt4aeeo iciydfm2umnmp;t0 lermo3ootoate ueo;s)teumxm3oy1lm elnvslt a2raxmpnt0apt iictldla2elumpnt4texoxocoadfmDeau ils0teuo(mpiu1lptnlietls)artruronu0tltoioeiys a emu o;t)aetoif oy1la rlueols) rum(o ny1ol n ivia(  Drru ont1oetn ictytla rlnms u0treoio3totfmDeauei t) rum(o iu4oltelnesat sDur( o;u4alt if3iadfm2umn s;u4alxrifciotomD ai o s0setriopoo4omtn ivi (  2rmxm ot4tpxoiociat aDuanms u0alxomr iatla rauvs;( t2tm(o ny4optnmivsl( artaxrpnu0oltnmo3iltfa2uln s t)tleoif to1om eli i;s) eur(rpiu4omee iet s)s2uau  ot4aex io3ias a ua( p t4 etnmr3oatop eanes;s) rtmxr no1amt  fes tfa2urxrono4oexo ociasls2elnmp ()tetrmr3oydfmDe u i () etrxm3iodll elicsat  Dumum nt4tptomf3iat s elnmpnu0trenio ty1lp  ai o;(0t2tr(o3iudam emncilt)srtm(mooo1tptnmietldlaDrlnvo () eeoif3to1om r ieslt  eumim oydoltelfci s  Dtaxr ;o4aeeo i3iasla2um(ms ()aleoxo oytomt lieo s0trxm(mpoodllenlivi t arum(rpoo1tetn ictas a rlnmsnt4 rxoxocty1lp e ieolt t2tr(m iydaptnlivt tfsruaxrpno1olenmf3iad sDulu onu0trenio iodop  aivslt)srtmir nu4oltn nesa()arurx p;o0tptomfciltls em(vo (4trxrxf iodlm rauvi t srtmimpoy1om elnviat  rtrx  ou0aeeo fciasfsDeanvp (4 ltnio totfmD  i o;s)t2to(rpio4al nlietas  Dtaxmpoo1oex iieiysfa uaumon(4artomociydlpt li s t  eumxmpoydalt licslt a2taxrpnt4tpenmictaslmDra(mp;t4trenio totlpDr nvils0 exrxm3iodlptelivt tfarraurpno1apt  oeild mDelums t0 exnmo iatopDr nvi ()setmxr io1olenmnet s aDtrxmpnu4olt mociasfsDel(vo;t4 rtnxociodom  aneil()trum(opiu1am n nci s) ruaxrono4opxnmiciys s uauvo u)altrircoodomt anesl()teurio3ny4opte fvi () 2rrxm ;o4opx iieildfs2rmuvp;u) lxrmrcoodfp elueol() rtr(m io4lpenmiet sfaDum( oot1aeenmoeiyd aDrmuvpn(0 eenio3oa1fatrli i;s  rtoxm3ny4optnmnesa( arua(mpoo4oexnifetydls ea( s;u4areoxfcoydfaD aivslt teuoim oy1lm n fcsls)srtrxrpot1tlx  ieiytfaDra(ms u)tlenxf ta1om rlivolt0 etm(o iodameelfet tfs2rm( pou1apto fcilslmDumn s;t4 rerxrctatlpte n olt0srto(opiodom nmiet (  rtmx ont0texnifciytlm ranms;u) leoir totop  auei (0 exm(o iu1op  lici s)sDua(mont0tpeoio3tyt m2em( onu4 eermo3oo1opDrln o;()srxoxm nu1oltnmfvslsf 2um(rp;t1aet  feildla um( snu)teeomr3iydoa eaues (  rtrim oo4optnmictlt  Dtmumpoo0apxo fctadlaDea( pnt4arxoir iodfmt ai i (0seto(o no4omtnmici ()a2ua(m ;u1tlto ieiadla2rau ont0 rerio iodlaD luvol(0setrxr3iy4op n ies (  rtaumpno1tetoiiciatlaDeaums;(4 rxomocoy1lmDeai sl(  rxrxr nodamt  nctatfsrtrx poo0tle mfetys m eln s;t0artnxr3ootomt an i s0tetrio iu1ope  net t)arrau p;t4alxn fciytla emuvo t4altnmr oytfpD  u o s0s2xr(rpiy1ape  ivilsf ruru p;u4tlx if3ilt s2ra(vsnt4tltnxo3tadlpte nvol(  2tmxm3io4op e fei s)aDtmuroot1oeeomo3iadlsDrmnms;u4trxnmrcoa1op eaivs ()s2xm(rpio1lp n fcsat  2taumooo1oleoifctasfaDua(vp;() etoxrctadom ranes s)tetr(rpou1llenlnctltfaDtauro;t4optn f3iltfa uanvp;u4 eeoio3ia1lp   n i s0 eurir io4lmtnlncsasf rumu  oo1tptomfeiltla uln sn()aexnmo3totlat lueo;s) exrxo3nudomt mnetlt artaxr nu0optomieias mDumnmsnt4tlxnir tatomteaneo;s trurxm3oydopenlfvtatf 2rrxrpnt4altoioctasfs2ulnvs;u4 etoxf todfmDrau ol()tetr(m ny4lpeelnvt ( a2taurpnt4oeeoif3iyt sDrluvpn(0tlxomr3tadfm e n s t)srum(m ny1om   fei s sDrr(  ot1oetnifetasls raump u) eerxr3oydlaD  nvsl(0srxmio3oo1ol nlfeiltf Dtrx pot1aeenmi3ilslm2el(vonu0trenxo3iadom rauei;t) etoim no4lleelfvt s s2trur ;u4tptnio3iytlmDulnvp;() exnio3ia1om  ln s;s)trxo(r iu1lleemfesa(f ruaum nu0oet ifeiatfmDumums (0 ltrmf tytfmt  uvo;t) rxo(r3iydam emfcsasfaDumxrpnu1alx  f3tas m um(vp;u0areoif to1opt aieo ()trur(r oudamtemfeils) rrr(mpnu1opeoio3tyt s elump (4trxoxo totoatrlieo t)srurxr ny1lmenmncslt artrurp;t0aexomfctat a ra(vp;u)alenmo iy1la e nvs s0texoirpoo1om elicsasf 2ta(r nt0alxoifcias aDrmu pnu0alenxo3ootomDr i o t tetoxopiy4olee fci t)s2tr( ont4teeo i3iydfa2rmuvs (4aeenmr tytfptr ivils teur(rpno4ll   ivsat)sDtm(  ;t0apxnmi3iatfaDel(vs ()tlerxrcto1fp rau ols0 2tm(m3iudlpte ics (fartmumo;t1oeto fetas s2uanmpnu4teeoxf iadoaDe nes;t)trxo(o io4ap e nvs (fa2uru oot4olxomfeiyslmDum(msn()tlxomf3iydoatrlues;t)s2trxr iodlm nmfet t artru  no0tpxniieiadlsDrlnmo;u0 renxo ia1oateluvil(0seur(o3io1lp n ivs ( sDtaxmont0tltnmf3tad m rlu sn() reoxr3io1fate u i t)t2tmxopiy4omeemfvias)s2ua(mont0tlxnifeiyslmDrm(vsnt)altomoctodopD aieo t0 eum(mpoydalt lnvt sfsDur(r nu0tetoif3tls s2eanvsn(0aetomfcoatlp eaivs;s0srxmxo iudal nlfci t srtau pou1apx ioetytfm eaumpnu4 leoif3oadomte nvolt t2um(r3nodalee nvs tfs2umurooo4alto o3iltlm2uluvpn()tetrmr3tytfp elies s0s2urxrpno1opt lfesa(f Draxmono0tet ifetys a ul( p;u)artnif iydoa  luvsl( t2umir3ny4lle  nvias  rtrur ;o1aetnifciytfsDemuvont0aeermo3tadfatrau s;t) 2xm(m iu1altnlnesl()arrrxr ;u4aleoii3iadlaDumu onu0 lxrmf3oy1lm rli sls s2xoirpiy1op e fctlt)s2taxm ;t1olxniietytfs eluvsnt0 exrxrciydfaDeai o t)texoxmpiu1optelnetat sDrm(ro;u0olen f3ias aDelnvsnt0alxrxfciadop  li i () rtoir3ou4ale  nvslt)s2rrxmpot1tleomociat s uau o;()alermr ia1laD ai i s)trxmxo3nudam nlncsat)srtmx  no4tlxo f3tas m2ul(mo t4aeeoir oatlmD  ues s  2xoiopno4amtnlicsa(f 2rmxm ot1oleo oeiyt aDrmn s;t0alxrif iytlaD aneo;(0s2uoimpoy4apt lnci s  Drrumpnt1tptomi3iatlmDrmn o;t)teerxf3ty1lm eluvs;t)srxoim nydlp  lieslt sDra(  no0tlt  iciatfa2raums u) eenmr io1fmD aivs;()texmimpoodaltelietat s2rmxront0tpxnif3taslsDrl(mo t4arxomf tatlpD  nvolt0trurxm nodlp nmict ( s2tax  ot0alto f3ilt m el( o;u)aetrxocoytom eluvo;t  rtoxopoydapen nvtasfsrurxmonu4olxn o3tltlm uln ont4tetoxf3iodla rli sl( srtoiopou1am e nvt (fa2urxmoot1texnii3tydfaDul(vp u0artnmf3totfp  luvo t) etr(m nu4lp elivi sfarta(  ;t4tlx  ieiyd s2umnvo;u)aeeoxo3todoaDrai o;(  exoxopiydamen nvtl( s2uaxmono1alxoifeiysfm2rmnvsn(0 rxrio3iydfat lueo (0 2xr(mpio1al nlfeiltfsrra(roou0optoif3tltla2rmn p;u4trtrmr oydlmtr uvo;t  2umiopno1ap emncsls sDtrxmont4oeenii3tys a um(mp t0arxrxf3tadfptrli i (  2tmxr3iu1altnlncia()a2umxmoot1oltoiieilsfm2emnvo t4 ltoio3todfm eaiesl(0truo(m iydome licsat aDta(mooo4olt mocias mDemuvsnu0tlxoxr tadlp ran o;s setoxopoudll nlnctasf Drmxroou4tpto ociasfa rln p;u4alermociydfmteauvi;t  2urxm3ou4al n icias) Dtmu  oo1oltnmfeiltlmDra( o t4 rxnirctydoatr nvs;t  2uoio iudopte fvt ( s2ra(  ;o4aee  iciyt sDua(mp;t)trtnxf ta1opD  n ilt) eto(o iydlmeemnesatfa2uru pou1tpe mocildfs uanms;u0aexrmr3ia1la eluvs;s0 rtrio3iu1lme lfvtlsf rrrxm nt4aleoif3iasfs2eln on(0 etrir oa1faDrlu i t  euoxo3iydomte fesatfa2um(  ;t0aeeoif3tltla um( pnu0 rxrxr iadlaD auvi s tetm(m ou4lpe lnvi ( arrmumont4aex mo3tls m2uanmon(4tetrxfctotfm e i o;t teur(opiudlmtn fesatfa2urumonu0texomiciys s2ulnvo;t4 ltrmocty1opDeanvi t) rur(o3nodamenmnetls  rumxr ;u4apt  o3iatfmDran ont)trerxr iatop  aneo;()setrxm io1ope  ictl()a2rmxrpnt0tet  o3tatfm ulums;u4tltrircta1fp  li i;t) exrimpoydlltnmneias  2tmurono1alxoii3tldla rmn snu)aleomr3tadlaDe ivolt) 2tm(r io1ll elfesa( arrm(r ;t1alxoif3tat a2elnvont4arxrif3io1omtranvsls)trxo(o3iu1ll  lnctls)aDrmu  nu0oex mociyd aDrln s;()tlxrmr3tytfmDe nvsls0s2uoxrpou4lme mfvt t arrmum ot0oee moeildfaDumnvpnt) etomr3io1fmt au ilt s2xoiopio4lmee fcs ()a2um(rpno4apxniiciadlsDulu on()texnio3iatomteanvi;( s2umim ny4om n fvtas s2rm(mpou4apto ieiyt m2ul( ont4tlxrif3oytfat  ivi ( seum(opoy4omee fvil( srrm(rpot1tlxo ietat aDrlnvpnu0alxrxrcoydfatranes t texmxm3nu4am elfctl(fsDrmxmont0aet  i3iltfm2rl(ms (0 rtoxoctadfp  au sls trtm(mpno1omen nvtat  2taump;o0aexniiciasfm ul(mp u4tlenmrctadomDeli o;( srxr(opoo1llen fvsa( srurx pot1tet mo3tadlm2rl( o u) rerio3tydlm   n ils0 ruoir3oodamteliviasfaDrrumoot0alxnifeiytls ea( o t4 exnmo oytlpD  ieo;()t2xmxmpiodoleelfcs t)a2tmxrpnt1tle ioeiydla2rl( o (4alxrmrcto1fmDelues () rtmxr3oo4om n nviltfarrax ont4tet ioeiytfaDuanvonu0aexnifctodfaDeau s (  etr(opiy4om   ictlt)aDurxr ou0olt  o3tad a2rm(vo;u4aexoif oatfmtraueo;(  exrxopno4op nlfvt (fsDtauro;t1optomfctlt a uauvs (0aexoir iy1faDe u ols0 2umirpiy1lpt  feia() Drr(r nu0aetn fcildla rl(mpn(0tltoxo iy1oaDe ies t0seto(rpnydamenmics s  Dumx pot1aeto fetltla uanvo;(0 etrxf tydlmDe nvo s)srto(opou4ap nmfctl()srum(  oo4aptn fciasfm2el( s t0 ltnxo iatoptrlieils0 2xriopno4lm  lnetat) 2rmurp;t0tltnifetlslaDem(mpnt0arenif3tytlat  u i;()srxoxo3oudopeemict t sruaum ;o0optnmoctytfa2emn sn()tetrio oy1lpD  nvil( teuo(o oodlpt licilsfs2taump;u0altomfeiatfm um(von(0 etomr3ty1oaDeanvs;t s2tmirpiy4olenlnvt (  rtrump;u1aptnmi3tytls2el(monu0tltomfctatomtraues t)seumxopiy1omenmivias sDurxmpoo4aeenmoeiys sDemn s () rxoir iadfpDeaneo s0 exoio nu4am nlnvt s arururp;u4aleoiiciasls2elumsn() rtomf io1laD anvo;s)seuoir3nydll nmfvi ( srta( pnu4tlx miciysls2umnmsnt0tlxoifciodfat  i o;( texr(o oy1lm n neias)arrr(r nu4teto icilt a2rmumon(4 lxnir iotlpt  n o () 2urxrpny4ol  mieta()sDuau  nt0olxo i3tysla ulu pn()altnirciatopDraues t0 exoio iu1apeemfvias)arrm(  ot0aexomo3ilt a eau pn(0tlerxrcoy1fa r u o;s0t2xr(o ny1alenmfeta()sDurxmooo4tpxomiciyd a rmnms;t0arenxr oo1fmDr i i;t0s2tr(opiydlmt lfetatf rum(  oo0aetoiieiatfm rmuvpnu4trerxf iy1lm rlu i;( texmxm io1ap   icsl( srumxmpou1tpe ifciyd m2rmuvp (0teeomfcootfm  lieol( setoirpou4opeelicslt)aDrrumoot1olxnii3iydlm rl( snu0 lxnxfciadlmtrli s;s)s2to(opoo4lltelncsl() rrrum nt0oee  ocilsls rm(vp;() ltoxf tatfaD auvil(  exoxrpiy4am  liei ( aDraxm ou1teto f3ils mDrmu snt)aexoifctadop e ueilt) etoxmpoodale licsa() rrmx  ou0aptn icilt m el(vp;t0 etnxocoydlaD  nei t)t2uo(opny4apee nvsat artax  nu0oltn i3iltla rluvs;u0aeeomr iy1fp elueilt  rtmim oy1lme  fvi tf rrm( oou1aleo fciatfa2elu on()aexomo tatopDeau i;s  2ur(m io4lptn nvil()s2umxmo;o4apxoifctys aDrl(mp u) exoxo tytfpDrli ilt)texrxrpnodlmt  fvsa(f 2rm(mo;t4opt ii3iytlaDul(mp;t)tltrxf3ta1fpDran i t)seur(r3iu4ol  lfvilt  Draurp;u1aleoiietasfa um(vpnt)aexrio oatoaD anei s0s2tmiopoy4amtelietl( srtax o;o0tpto f3tldfs2rmn ont0trxrmf3oo1omD li slt trxr(m3iy4am  mncil(fsDrru  nu4texnmfeils s2rmuvo;u0aetoirciotomtr uei s)srxm(o3oy1amtnmfctat)s2trxm no1tex iociat sDuln s;t)areoxr oatfm r ueo ()srxoxmpnudaleelnvsas  Drrur ;o4aeeomf3tyd s elnms t)arxnif oy1oat auvs t  etrxm3nu4op e ics sf Dtaurp;o1tltomfetls m rmuvp;t4tetrmf oo1lpte nvs;() 2urim3oo4ope lnvia( a2tm( pnu1tlt ifciyslm2eln s t0teeniociatomDe n o;() exoxrpnodlpt lict t aDrrxm nt1tlxnmfeiltfs2em(vp;(4aetnif tatfp e iei ( srurir3nodolt mfvsa()s2taxm ;t4tetomfctytla emu o;t4tlerir3iy1fp eaivo ( trurio3io1lleelfcil(faDua(r ou1opx  o3iasls emnvp t)tlxrmfctodlptraiei t) 2um(rpiodlmtn ici sfs2taurp;o4tltnmietldfm rm( on(0 eenifctadla rln s s0seumxr nudll nmnvt t arrrx o;t1ole  fetat m uaump (0altoxf3oodlmt aivsls)t2umimpoy4ol elfes t a2uru  ot0oltomicilslsDumuvs (4teeomr iydopD liesl(  2urio iudap emnvias) Dtmxmpno1tlxnio3ilt m elumo;()alenmfctatfmDr nvol() exmim oydolt  ictlsfa2umx  ;o4oleo feiydfs uau on(0artoxo3oa1omDr iei t0 euo(m iu4amte ncia(f Duau oou0tlxo o3iyt a em( o u)tltoir3iodfat  n o ( srtmio oy4ome mfeils srum( pot0tptn i3iytfm2uln snu0 etrio iydom  aueslt0trumimpiy4am e netas aDtrumooo0opxoiicildls2rm(vpnu)aleoio3iy1oaDeliei s trxrxr iy1apt  ivi t)aruaurp;t4aptnioctytlsDrmnvpnu)tltrxf iytfptelivo;(0teuoxo3nodole  iet s  Duau poo1tlx  feilsla2emn p u0 rxrifcoatlp e ues;t0texm(m3nu4lpt livtltfaDuauro;u0optnmfetlsls ranvo t)aexomociadlmDraieils  2tmxm3iy4omeelfetlt) rurum ;o0tleoioeildfmDuanmp;u4teermr iotop eanvilt)trtrxm3iudalenlfctat) Drrxrp;o4tpx  oetatfaDuluvp;u0tetnmo io1om e u ol() 2triopiu4al n fciltf 2tm( o;u1aetnmf3ilslsDemu p;t)tltrmfciy1lm eau slt) 2xm(o oo1altnlnes ()artr(mono0oexomo3iadlaDemnmp ()texrir ta1oa e nvi t  etriopiudameemivtlsfsDtax p;u4apt  feiatla2uluvs t) rxnirciadlpt lneol()setr(r3nodlltnlicil()sDtrxrpnu1alxnmfciytlsDeaums ()texrxfcoytfmt lnvi t  ruo(o3oudom nlnvtasfartr(  ;t1aetoio3iltfsDelnmp t4aexnmr ia1oatrli i;(0srtmxm iydll nlivi tf Dua(m ou0aleo i3tat m rmnvpnt4trxrio oy1faD lieo ( seuoim nydlmt mnctas)s2umxmpoo4tpx io3iyt m2rm(mont4 reomrcty1omD anvol()srtoim nu1lptemnei t aDuau ono1ale  ictls aDra( ont4alenmfctytfmt au il(0texoim oo4oleemnvta( srrm(mpou1apeo icias a em(vp u)arermfctydfat anesls0 2xr(rpnydlm  mfvslsfsDum(rooo0olt miciyslm ranms;(0aetoxr iatfatr i o t)setmimpnudap  lfei s) rtrx poo0texo i3iatfa2ranvsn(0arermf3to1oaDeaieols)teum(opou4opt lneiat)aDua(rpot1apt  feiadla rl(mo;(4arxoir3todlm r uvi;( setmxmpio4lpenmnct (fa2uax  nu1tpx iictatfm ra(vo;u) lxoio iodlmD  ivol(0 rxm(opnu4ap nmfvi t srraumpoo1aexomociyt mDel(vp (0 etoir3totfmD li o ( teuoxm nodaptelivslt  Duau oou4texnif3tadfsDean onu4treomocoadfm rlu s t0srurirpno4am nmfesat)aDuauroot0tetnmictytfmDel( snu0 ltrif3tytopt  u s s0 rxoir oodlme mici tf rrm( oot1tltoif3iatlm2em(mpnu)tetnmoctydlpDranesl()sexrxm3nu4oltnmfvs s) rumxm no0ape  f3iad aDulnmp;t)tltnmo oy1fpDe neo t)s2umxrpoodllt mictls arumumpno4tlxomoctlsfa2uanmpn()artomocoy1oaDr n o;( t2tm(opiu1lptnmnvtat  2raur oo1tetnii3iatlm rmnvs;t4trxoif oydfp r ueo ( s2xr(o3nu4am  lfcsasfartr( pnu1opeo i3iysla rauvsnu)aexomf to1lmt  nei;s) etrxrpiu4al  mfeiat)arurxmo;u0tleoioeiadfa um(vo t4aetriociadoaDeauvo;s0srxrxr ny1oltelnetas  Drrurpnu4apeo i3iatfs2ran s;t0arxrir3ta1faDeanes;() rtrxm3oudal elfesa( s2uaumo;u1olt mi3tatfsDrl(mp (0tltniociodlp e ivo;t setoxo iu4lm n fvtat)a2uaxmpno1aetnifetydfmDran p;u0 exoxf tadlat  ivs ()s2umimpoudamtnlivtatfsDraump;o0olx mf3tas s2emu s (0tleoxrcoydom e ivi;t)sexm(r iudlmeelnvta()artru pou1tpxnmoctadlm ul(vo;() etrio3iadopDeaies t)srxoio nudomenlncta( s2ua(rooo0olenmictydla ean p;t0 lenmf3to1oa ranei;s0t2tmimpio4omenlicilt s2uaum ;t0teenifciadfm ranmo u4trtrxo iy1fm e ieo ( trxrxr oudame miciltfaDta(moot4tptnmf3tytls2rmumpn() lenxfciytoa elivo;(0 rur(m oydol nlivtasfaDtaum ot0opxoiociyt mDrln o u0teerxf iadop rlu s s)seto(o3nudaltnlfvt sf Dur(r ou1tex io3ild m2ul(vsnu)arenxrcoydomteli s (0srum(o io4olen icsa(  2rmurp;u1olenio3tadfs ul( pn(4 etrmf3ty1oate n s s0sexoir3iu1lpenlivia( a2trx p;o1tpxn i3tatlaDra(vs t0 exnxfcoa1fm rlueo;t) 2xrxopno4om elivtl(fsDrmxm ou0aexo f3ilsls2eanvo (0 rtrmr3ootfp ran i;s)truo(o nydlpt lfvi ( artrxmont4apt mfeiltlsDuaumon() lxrmfctatlp  auvs;() exoirpiydapt  iesls)sDtmxrpno0olt  iciyt m2uan pn()artnifcoydlp eli s t  2um(r3nu4lmee iesl( srrax  ;t0ope mf3tadlmDrluvs;(4 ltnio3ia1lpDr u i (0trxrir iy4lm e nvia()srtmxmp;t0opx  octlslaDeanmsnt)areriocty1omDr n olt)teuo(rpiudamen ncia()sDtmur ;o4oexomf3iyt sDuluvp;u4 eeoiocoadlaDr uei;t tetoxmpny4ll  mfvs sf Drru  ;u4oeeniieiyd s2rluvpn(0tlenxf3todoaDelieo ( texmxo3oydapte icsas  2taur nu1apxo oeiltfaDulu on(4 leoif3oo1faDelu s ()sexmimpio1lm  lfvil(  rumur ;o0aet  ictasfsDumumont4 exnxocia1fmt  u o t0srtm(m oodameemiet s) 2um(r ;u0tetn i3tysfsDrau s;t) eeoxo iatoptraieols srurxm no1amtnlnei t  2tmxm ot0opt iictydfaDulnmsnt4 ltnmfctadoat aies;t)trtmimpoo4ll nlfvsl() rrm(m no0tltoioeiydlm raumon(0 rerio iodlm   n s (0srto(opiu4lleemicsas)srraumo;o0tpeoif3tltfsDrm( ont)tlxrxf oodfpDran olt)t2tmio nudlp   nci (fsDtaxrpot4optomieiatlm2ea( p;u) rtrir3oodop elnvi ( trxm(r3oy4am   nvils a2umum ;u0oltomf3ias s rm(msnu) rermrctadfp  li s s0t2umir3no4am elivtlt) 2ta(r oo4alenmfeiadfsDum(ms t4 rtomf ta1op   n ols trxm(r nodlpt mivsl()arrauroou4oltnmociadfa rlnmp;(0aetnifcoadom  ln i ( s2umir3iu1olt mfesls  Durxrpoo1opxo o3ilslm2ea(vo;t0aleoxrcoo1la  lueo;s tetoim ny4optn nctat)aDta(ro;o4aptomfeils a umn pnt4altniocty1faDeluvs s s2tm(r ou4alen fcta(f 2rrx o;t1tpe ifetltla2ua( p t4tltniocoodlpDr ivilt0 exoxopnydaptelnetl(f 2raum oo4olt ifctldfs2rluvont4trtnirciytoa rluesls  rxo(rpiodomt livs s arrmxrp;u0aeenmieiadlmDrmumo u4alenif3oo1fp r u ol( sruoxrpou4omtelivt sf 2rmum ;o0olt if3iasfs2ranvpnt0 rerir ootopDeln ol()texmimpoo1lmtemfeil(  rrrxm ;o0oex  f3iydfsDuaumonu0 rtnxfctatfa eai o s)srxmio3no1ap e nvtas  2ta(m ou0alenifciytla eluvp;u)aeeomr oa1fm   ueols0trxrio iu4apenmiet () Dtau pot0oexnioeiytls2eanvo t4 leoiocootlaDe nvols) rtm(r iy4ap   nesasf rtr(m ;o4aexnmieiadls ea(vpnu) exomo iotlp  lnvs;(0s2urxrpiy1altnmnctl( aDrrx  ;u0alxnifciltla uln p;u4tltrmr to1lpt luvs t)srum(o iy1am e ict t  2tr(mo;u0teenifcilslaDemnvs u0teenxociatlmtraues;s0truriopou4ap  mfvtls)sDrmxrpnt4tlt mociadfa2rl(msnu4 ltomf3tydlpDrlies;( t2to(m iu4aleelivs s)srrax o;u0aex moeiatlmDra(mont0alxomf todom rai ol( srtm(r3nydal n ictls)sDtaxr no4opeo o3iat s um( onu4 exrio3oadfm rau i s t2xmio3iu4lme mfes t srum(rooo1aexn ietldls2rl(msnt)aexoxrctodlm rau s;(0s2toim3oudameemfct sfarrmx  ;t4aeen i3iysfs2em(mpnt0alenio iodla  lies s0 exrxmpoy1op  lictls) Draxr oo1tpx  ociadfsDrau o;t0 lxoxo ootfatraivi;s s2to(opio1op nlivt tfarum(mo;t4texn fcilt s2uln onu0teerio3oytlptrlieilt trxrxrpnu1ll nmies s artax p;t4oexomo3tatfa ra( o (0 rtnmo3tydop  lneslt trtr(m iu4ap  lfcs sf Dtaum ;t1oee mo3ilt s2rmnmo (4tltrxfcty1om r n il(0t2xm(o3iydal nlfcs tfa2tm(ronu1opto ictydlsDuanmsnt0 etrxrctytomDrln il(0teuoimpoo4lm e nesatf 2uaumpou1oetnmf3tadfm2ua(vp;() rtnxf3tatfm   ies (  etoxo3oo4ap e ncia( aDrm( pno0oetn i3tadlm2rlnvs;u4areomrciy1fpD auvil(0 2uoim3oudop nmfes t  2umxmooo1tptnifetytlmDean o;u4 etrmocto1fmDran i s  exmir3iudale  nvs ()arumurono0texo f3tldfaDrmu pnt0 rtnxf ty1lmDeanvslt)seuriopoydomenmieta(  2rau o;o1tle  f3iydfm2rmn p (0 rtnmocoadfa r nvsl( trxrir oodapen ncsltfaDtrum ;o4aeto fetltls umnmo;u0 leoxr3oodfa rlivi;t trur(m oo4lpee fei s)a2rr(ront4apenif3iyt a rmnmo;u) rtoxocoy1fpDr u o;(0s2umxr3no4om n iesls sruaurooo0tltnioetysfs2umn s;t4aexoxocta1fmtrlnei;t  etoxm3no4lleelietl()sDrau  ot1tpe ii3iysfsDuan snu0alerxr3iy1fa r u ils0 2tmir oy4alte ivtlsfaDurx  ot1aleomietydlsDeluvpn(0tltoifcoadfateaieslt0s2xr(m3iy1ope lncsasf Dtmx p;u4apeo feiydfm el(vs (0arxnircoa1lptelnvolt0 rumir iy4lpenlivs ( s2uau  ot0tltoioctyd aDumuvo u0aeerif oodfate uvi;t seto(rpoy1lltelivs t) 2tmx p;t1tptn fcilsfsDumnvp t0 eerir iytoatelnvi;s0trum(mpou1lmtnlnetl(  Dta( oou1oex  ietytfa em( p t0artoxrciytfmDe i i;s) 2tmxmpnu4lp e feilt arrr(mo;t0tlenmoctydls emumpnt)aleomociatom   uvi;s tetr(opoodlltnlnvsasfsrtax p;o1tptn ociydls em( o;(4tlxoif ty1lpt aues s0srto(rpiudaptnmnes t  rra(mo;o0aetnifetytls2emnmpnu)tetrio3oodop eli o s srxmio3oo4amen fcsl( sDrm(m no0tpen iciyd s2rmn o u4alxoiocoa1latrli s s  rumxr ny1olenmfes s s2ta(roou1alx  ieils m2elums (0 etnxf3tydlmD ln s;s) 2xrxm oo4alt  icta(  Drmur ;t1tet  oeildfs2rlu p (4 ltnxf oadlp rlivo;()teumir ou4lpe  nctat  rtr(m ;u0aptomfeiyd s2eluvp;t) rxoio3ta1la elu o;t)truoir oo1lpt mnet ( srtrx pou0oetnmi3iltfsDrl( p t4aexomfciodoa   neo;s0t2xoxm3no4opeemiei sfaDururoot0tex  ocild m2umums t4tlxnxrcootla   n slt0sexr(m no4lmteliesatf 2urx oot0apt iieiyt a2em(mon(0 rxrxfciytlat  i ol()texo(o iodalt  nvilt sDrmumo;t0teenii3iatls2raumont4trxriociy1fpt lnvo s0 2umxrpno1ale miet t)a2trxr no1tetnmi3iltfmDumn s (4 renmr iy1opt anvo t) 2uo(o3ny1op  mivslt)aruau onu4tptomf3ildfa2ulnvpn(4aexomr3iodoa r u s s0sexo(mpoudole  fet sf rurumo;o0apxomietlt a ranmsnu)teerifcio1fmDe u s t0s2tm(r iodamtnlies ( a2um(rooo1openmoctls m2ua( sn(4artomfcia1lmtr u slt)trxo(o iudop  mnvta()aDraumooo1opxoii3iys a2rl(msnt)trenxr3io1opDeaieo (0s2toxr3io4lpe lnet (f rraurpou0aeto i3ildls eanmpnt4 rerir3oydlpDraies;s)t2to(o iy4lpee ivs t a2tmxr ;u4tpxo iciadlm2rl(mp () eeoxf iatfpteaivs t) 2uoiopou1om  livtatf Dumxmonu4apxnifeiydfs ran s t) leniociotomD  ies;s seuoxrpny4opeemneta( a2ururpnt0tpxoifctat m ranvsnu) eenio oy1lat lnei ()t2xm(r3nodom elfvilsfsDtr( o;u4oet mociadfm ulu s t0 exoiociotfateau ol(  exr(mpiu4olt lnvt (faDum(rp;o1oeeomiciadls2eanmp;(4 lenmociadlaDelnvols0tetoxo3no4op e ici (f 2raxmp;t4olxn oeiadfs el(ms t)aexnxfcio1lm  aieo;s)trxmxm oo4lp emfvsa()s2trxr no0oetomo3iyslm2um(vpnu0alermrciytfmt auvo;t trurirpoydlpe  ictatfsrrrxrpno1alxo ociytfsDum( p;()trxomf3tydlpDelueo;t teuoxo3ny4aleelfvi t)aDrau pnt1tle  oeiysfsDrmumo u4 lenir tadopt liei s)t2xoir3nu4lleemncsltfarrrxr ou0oexoiociltfm2ua( o;u)arxrio3oo1lm rli s;() 2tm(rpoy1ape  nvsa() rur( o;t1aeeo ociad s2rlnmp;u4 renmfcty1omD  ieslt trtmxm3oy4ale mict (fs2raur nu4tpto o3iltfaDum(msnu0 ltoxo3tadlpD  iei;s)s2xriopoo4altnlnvsls artru pnt1tle  ietltfs2rlu sn(4texomrctatoatr ueslt) etmimpoydolen fci (fsDur(mono0ole  octyt a um(mp;u4 etrif io1lp r u s;t) 2uo(mpiy4open iesls)sDrmxr nt4tetnioeiysfsDelumpn(4 eerxr3oy1fat aivolt0trxoxm3ny4lpte fvilt) Durxrpoo4tleoifcildla2rmn pnt)tleoxo3oo1opte ivs;s)truo(o nu4amenlnviasfs2tru pou4aeen fctad m2rlu p;t4altrmoctytfm e uvsls  eumxr3nydope mnesat)sDtax p;t1ole iiciaslaDua(vo;t)aetoir3oatlateai ils)seurir io4amtelnvs s) 2rrxro;u0oet  o3tatfm2uaumo;t0 etrmf oytlptean ilt0 rxr(rpno4ap n net () rraur oo4texnioetadfsDelnvo;t)trxrir iy1fmte u s s)s2xo(o io4ll  mfvs s arurx p;u4tlenmoetys m el(vont0tltomrcta1omteau olt trurxr ny4altelfctlt) Draum ;o4olx mf3ildfs2el(mont)tlxrmr ootfaDe ivilt sexo(m3oodam   fvi ( srrrxr nu4teeo oetadfm ea(mpn(4 etnmr oytfmteln s s0t2xm(o3iu1openlfvt (farumxr nu0teeoii3iys s2ra(mp (0artrxo3ootlaD  nes;( t2tmir nudomt  ncsl()s2rmxmoou0alxo oeils m ean s;(4 lerif3oatoaD anvsls sruo(opiodolt mnvsas  Dtr( o;u1tptnifciasfs uau p;u)arenmo iydfmDrlnesl(  2xoxmpny4aleemnvs s srum(mooo1oeeomictyslm2emnvont0tleomr3oodomteauvo () etmir io4al   ictlt  ruaurp;t4opx mf3tytfmDeaums;u4artoxf iotoa r n o (0trxmio iy1al e fvtat a2rm(ro;t1aleo iciat aDeauvo t0 exnxo ootomDr uei;s0t2trio iu4ol elfvslsf Draumono0ale mfciytfa2ua( snt)trenmrcootoptrauvo t0t2toxr nu4alte ici s arrr(root4opx ifeiytfsDeanvpnt0 reoif iytfaD au s ( s2tmxm3nu4ll  mnetls) 2tmxr nt4aee if3ias mDemuvo u)trtrir3iydfpDrau s;(0setoio3iy1lmt lfvt s aDuaxr nt1olxomicilslm2uan o u4 rxnmr3iotlaDe n olt0s2to(rpoy1opee nvilt)aDrrumonu1tptnif3iatfs2eau p u4areoifcta1opDr nei;s  2tmir3no1al nlnvsat srra(mont1optnmoctysls rm(vo t)artrxfciydlmteluvi;t  rxmim ny4alenlfei s aDumxr nt1oeeomiciadfmDelu s ()artoxocoo1fp e uvo;( s2xrxopnudlp nlivia(f 2um(mpou1aex mfcias mDuauvsnu) lenxrcootfm  luvo ( t2xr(mpou4lp  mncsas)aDtaum nt1teeo i3tlt s eanmonu0altrif ootoa  aivo s0 eumxo3ny1lmte ictlt  Dtrxmpno0tpx iictlsfa2rln s t0tltrmr oo1faD ln i;t t2toxm3oodal  mnetls)s2um(m ;t4oexn f3tas m2rmums (0alerxf3oodla  lieols0s2toim oydol   fvt (f rur( o;o4optomo3tlsfsDulnms (4 rerirciadom  lueilt)s2xmirpno1lme  fvs tfsDtrxrp;o1tlt  ociaslsDrm(vpn(0areoirctatoaDrlu olt trtoxopou4apenlnvs sf rta(m ;o1oleo ieiysfm eauvs u) etrircia1opteau s s sexo(opno4ll   ivtat s2rmu pot0apeoifcilt s rm( p u4 rermf todom r uvs s) eurim3oy4olenlfvi s artaum ;u0ale ioeiydlaDulnvp;()altrxo3to1lp   ues;s0 eur(r3oy4optnlneia(f 2rruroou4tlenmfctlslaDum(ms t) ltoir3iatfa  anvo;s) eur(rpou1ll  lncias s2ta(rp;t4tlxo o3iyd s2em( o u4tetnmoctydoat  uvols0seurimpiudlltnmiviasfsrrax  ou1tlx ioeils sDuln snu4 ltrio tadfaD liei;s)sexmim3nydolt mfeia() 2rru  ;o0alen ociydfa2el( p ()texnxo oo1fm e iei;(0s2xoxo3io4altnlnvtlt s2um(monu0tpx mieiatla2emu p;u) rxrxo3iatop  luvs s s2xrxopnydoltnmicsasfaDrm(rooo1oet mfcilsfs2uanvo;u) rxoxfciatlmDrlu o;(0s2urim nu4lmee ivsls)aDrax ono1optomfeiltlm2rau s;() rxniocoytfaDeln olt)texoxr3oudal nlfeiltfsrtaxmpoo1tpxnmictldfm2ulu p (4teerifciadlmte n sls)sruoxr oo4op emfvtl(  Drau oot0alt ioetydfs rmuvont0artoiociotlptrauvo;(0 eumiopoy1alt mnesls arrm(r ot1aex  oeiydfs rlnmpn() rxnif iy1fm rli o;()t2uoim oudamee nvsl( sDtm(rpot0apenmf3ias mDumnvo;u0tltoio3to1lm e nvils0s2uoxrpiudolen fvt (fa2rr(r nu4tleoiociadfsDuluvs t4 eeoxociotoa raues t0 rxoimpiudapenlfvi ( aDrr(moou1tpto ictltfsDeanvpnu0 renxo3iy1la  livi;( s2xr(o3nudlpte nctl() rra(mont4apxo fctys a em(vs;() ltoio3iodfptrlueols0 eurim oy4amee fvs t  Dua(rooo0aexomf3iadlmDul(vo;()tleomfcootfatraiei;t  2xmxrpou1alen iesat) Duauro;o1aex mf3iatfs emuvpnt4aexrxfcoo1lptrlueols) 2urir ny1op  mfet t  rtr( oou4ope  f3iytfm2ra(vs;(0 rxnmo oo1fm r ivo s  exm(r3oo4opee nct s)s2taxmo;u0tptnmociytfs2rmn p;t4 rtrir3oa1op  luvols  rxrimpiy1olt lietl()a2tmur oo1texoii3tasfa2ra(msnt4 lenxo3tydfptrlueo t) 2um(r3oudll nmictl()a2tmumooo4opxn fciad mDuau on()areomrcoa1lm r n s s) exrxr3iy1om nmies s aruru  ;o1opxomiciytlm eluvs;() eeoxo iodlatr neol(0srtoim oodapee netat)srta(mpno1ale ifciaslm rmuvp (4 rxoxoctytlaD lieil(  rurxr ny1lm n ivs ()aDumx oot1tpxo f3tad s ulumsnt) rxriocio1lp elies;() etm(r3iu1ole mnesat) rrmxmp;t1apeomfeiatfaDel(mpnu4arxnmfcta1lmtraiei (0t2xoxrpnydamt liesls) 2taur ;o1tpeomfeiytlaDea(vo;u0tltrmrciotfmteauvs (0trtrio3nu4ame  fesl() Dtm(  ;o4altomiciatla rm(ms;t0tlenmr totfm   ueil(0 2tmxr3iydaleemiesa( s2trxrpno0optn feiaslmDelnvp;t) leoio tatfmDranvi;t0texoiopoudoltelicils  Dumu  ou0tetomi3tldfm2ra(mo u)tlenmf3ia1oa eaivolt)trtr(r3io4lp   icsas sDraxm nu1alxoii3tatfm2ul(vpn()tetnioctodfpte n sl( trxr(m ny1olt  ivsls)a2rr(mooo0apt  ociasfm2rl(vp ()arxomocoodfmte n sl(0s2umxopiudlltnlnesls sDtrurp;u4tltomfetatfs2rl(monu0 reomr oatfatraivi;s0 2to(m3oo1lltelivtat sDrrxmoou0teeoiietatls2ranms;u) eenxf3oydlmt lueslt) exoio no1apeemietls  Drmxmpoo1teenmi3iydfm um(msnu)altrxrctytfpDrln s;(0 euo(o ny1altelncils aDtaurp;u1altn i3ilt s uanvo ()tetnmr3oytopteaivols trxrxm io4llenlncta(f Drru  nt4alxomfeiadls em(vo;t0texoxf3ta1oa elnes;s0 etrxo3nodolenmicil( s2umu onu4tlenmoetadlsDuau s () lxoxf totom eaiei s0t2xmim nudapen nvtat)s2trum ;o1alto f3tatlm eluvs () lxrio io1fmDrlu sls) 2uo(opiu1om n ietas aDrm(mp;u1olxo ieiasfs2ea( on(4aexnif iotoatrli sl(0t2xmim ou1alenlfeias arrm(mpno4aptnmoeias m2em(vp;u4 rtnmr3oadlpDelueo s) exrirpoo4lmee feiat arum( poo4tee mfctasls2ra(ms u4artrmocty1fmtr ivo;s)sexoimpoodolenlneta()a2urxmpnt0aeeoio3tat s uauvp;u)trerxr iodfp e u sls0 etrir io4alenlfesas) Dtm(moou0opto ociyt s ean o;u0aexoif3todoaD  ieo (0srumimpoydaltemfesl(  2rrxrpot0altnmf3iatfm2ran s;t0 lxrmr3tadop eln i s)seto(m oudamenlnetatf 2um(rpnt0tetoii3tadfsDrlums;u4aexnifciotoaD  ivi (0trtrxo oydlltn fctlt) 2rrxro;o0oltomi3iadls2ranvpnu0 leoxr iodlmD anvo;t  exmio3oodoltemfetas) 2taurpno4apxo f3ildlmDem( snt0aexoir3iydlmDrluei;()trurxo iu4alee fci (  Duau pou4oexnmictad a ulnmo;() rxoir iy1fat  u s;s  rtmxr3iu4lpenlfeslt)sDurum ;u0tpenifetld s umn p t4trtrxrcootlmteaiei s0t2xmxo3nudll  lfcs tfs2ra(mpoo4alt mictasfa2umnvo;u4 reomf3tadoate ueslt trtrxr3oo4alenmncslt srumu  ;u1tpxomociytfs2emu on()trxoxo3iytfmDranvo s0t2umxm3iy4ll nlfes t artr( pno4tle ioetltfa2ea(vo;() ltrio3oy1latr uvs ()srur(opno4lleemfct ()artrur no0alx mi3iatlaDrlnms u0aeenmr to1fate n o t) etr(rpiydome lnctas) rua( oot0tleo feiydfa uln o u0trerir oytfaDrai il(0t2ur(opiy4al  lfetat aDurxr ot1oleo ictldfsDraumo;u4altrio3oa1lmt auvsl()t2to(opou4apen neilsf rur(ro;u1texn octyt mDem( s t) lxomo3oytlp eli ils  eurir3io4aptn fvs tfsDtr(rono0altnioeiyslm rau snt) rtnxocty1fpte uvo;s)tetmxo iydop nmicil(f rrrumont4alt  f3tys s rm(vo u0tetrio3io1fp  aivsl(0 eurxrpnydaptelfctl( aDtrumpnt0alto iciysfa eauvs ()arenmr iytopDe n s;s)srtr(o3oydlptnlfvslt a2ua(ront0alen iciadlsDul( p;t)texnmo3tatfpDrlneo t)sexm(r3iu1lm  lnvi (  Dta( oot1tee  fctlt a rln p;u4trtnir3todomtr ivo;() etoxo3io4al elieil()a2rrxmo;t0alen o3ilt s2uauvon(0tlxoir3oadfmt  neils0s2xoimpoo4lptnmfvt tfa2trxr nt0tetoifciadfa2umu pnt)tlxnxfciydlp eaneo ()srum(o iudam nlfcsls) 2trumoot4tpx mfetyd sDeau onu0tlermf tatfptelieilt0srtoxopou1am nlict t)aruau ono1tleomfciydfm2ra(vp;(0alxrmr3oydlp raies;(0s2trxo3io4aleelneia()aDua(m no4tlenif3ilt a uauvsn()aetrircto1fmt livi s)sexr(opnodamte neiatf rumur ;u4opxnmi3iys a2rmn ont4 rxrxo3iotfatr n s t) 2umir3iy1al  lieilt a2ra(m ot4aleo oetadfmDelnvs ()alerir tydlmt luvi;(0s2uo(r3oy4llte fvt t s2ta( o;t1aex mf3tys s uanvs (0aexrio tytoa rln sls  rxrxr iu1alt  ivt (faDra(mpot0apeo f3iysfmDeanvs;(4arxrmr3todla  aneilt t2ur(o3nu4omtelicils aDtax o;o0ope ioeias mDuln s;t0arxrio ootomD au o s t2to(o io1apte iet s  Dra( ont1olx  o3iysfm2elnmp;t0 ltnif oadop elueo;s trtm(m oy1olenliciatfs2trx pou4tltnmfciysfm ra(ms;t0tlermo tydopD ln o;s0trxoimpiu1llen fcsat)s2rmur ou4olt  o3iadfm2rlnmo;u4tetnxr3oo1fpDeauesl(0s2uoxo3iy1lmenlfvt t srrr(mpot1teenif3iysfa2uluvo t)trtoif3ty1fatelu il(0 rxm(rpnodlme lnctatf Drmxm ot0apt mietltfsDul(vsn(4arerxrciatopteai i;t0setrirpiodlmenlfvsa( aDtaurpot0tpeoioeiasfs ra(mo;u4 renmf iytoateaivi;s t2ur(m3iydamtnlnesat)s2uau o;o1tlenmoetadfm rmumsnt)teenifcto1oaDeaies;s srxmxrpno1omt  fvi ()a2urxmooo1oex  i3ilslsDum( s;t)texoxociydlmD ln o (0setmir3ny1lp  mietl( arrmxro;o4tee moetysfa uanvo u0 rtrxf ta1om   ueolt0 rtm(mpoo4lp n neias)srtmx  no0tptnifetyt m ranmp;t4 leoxfcoydlm   n ilt0sexmir nydolte nes tfarurum ou4oeen feiatla rmn pn()teeoxrctatlm rlieo t)s2tr(m3no1am   ncil() 2uru pnt0apt  o3tad s rl(mont4 eerif tytfmDeaiei s)teuo(r iodape livt sfsDrmx pno0aet ii3iysfa el(msnt0arenifcootfpDran i;s)seurim3io4al  mictl(f 2uru p;o1tlenifctltlmDulnvp;t0tltnxfcootoptr nvi ( t2xrxrpnydape lfcsl(fa2tr(  ;o1apt  i3iaslaDelnmo ()alxoir tadfmD  nvs (  rxr(m iydope  ies tfsDuaxr ;o0apenio3tld mDel(vo t0 exrxf3iatopDeaiei;s0 rtm(o oy4al nlnvia(fs2trx  no4aex io3iasls2eluvs;(0 rtoxo oy1opteaueolt0t2tmirpnu1omtnlietasf 2rmumpno4aetomoctlt a2elnvpn(4 exnif iotomteluvslt trum(r nu1opeelfctat)srtmx pou0oeen o3tadlmDumnmp;u0tlermr ia1fmt livslt) exmxm3ny1lme mieias)a2tmxmp;t1apx mietadlm emu o ()aeenmr3oytfa e ieo;t)trtoxm oo4apen fetlt) 2ur(mp;o1apeoiociatfm umnvs;(0 lxoxf todlpteli s;()sruoxm3no1ol  mies (  2umumpnt1opto ieiasfaDrlums;u4areoif iydfpt  neol(0s2toxr iudaltnmfeilt  Drm(rpnt0aeenmfeiatlm eaumo;u0aeeoxoctatla  li o;s0t2toimpnu4llt lnvs ()s2rr( poo4apeniocilsls2el( pnt) exnio tadopD li il( tetmio3oudalee ietl(f Duru  no1aeeo o3tls s2rmumo;t4 rxnxr oadfaDe iei t)t2to(r3oodoltelfeslsfsrraxrpno0tpeo feilt sDea( s u4aeerxoctytopt  uvo (  etmxmpiudoltnlnes s sDumu ono4apxo f3iadlsDean s u4 etrxo ia1opDeai i;s s2uoir3ou4llenlfetl( s2rmxront4olt  o3tltls2emnmo;t0 eerif3iodomteln sl(0seumxo iu1lleemfvt s artr(  nt4aeeoifeilt sDumnmsnu4 exomr3totoaDran i;t)tetrio ou4lptnmfvsa(f 2umxr no4tlx ifeiatlm2ulu p;(0aexrxrciytoa rauvsls) rto(mpnudaptemieia(fs2tmx poo1altnmictadla rmn s;t0arerirciytlm r nvi (0texo(o iy4omt mfvsa( s2umxr ou4aex iieiltfa raumo t) lxrmo todla r n ils0 exrxo3io1al e fvtl(  Dtm(  ;o1aetn ieiaslaDeauvo;()arerir3ootom  an s;( tetmir io4lm  mieiltf Drr(r ot1aeeomfctltfm2rauvp;u4 etrif3iodlm  aivo;s)t2toir3nodlmenmfet sfs2rrx oot1opxn ictydfa2eanvpn(4altrmr3ia1omtelnvilt0seumir oo4am nmieils)s2raxrpno0teeomo3iyt aDulnmo (4trtnir totfmDr ieil(0t2toiopno1lp   nvs s) Drm( onu0aetomi3tyslsDuluvsnt0tltrmo3iytoatraivi t)t2xoim iudole mictl(f Dtaum ;o4ope moeiasfmDemuvo;()tetrxf3ta1oatraueilt  rxoim3ny4lltemivta(  rrru p;u0tlen ocild mDrmnvp;u4 rtrxf iy1fa e ieols)sruoxr ny1am nmfci tfsrumumoot1tlxomoeild m rmumo t)teeomo3ty1oatr nvs;()t2umirpoydll  lfcsl() 2ua(rp;o4aptnif3tasla2eanvs (4 etoxf3oydfpDraueols trumiopoydaltelfesltf 2uaur ;t1olen i3iatla2elu s;t0treoxo iytlp e i i;( s2tm(r3oodal nlnvt s)artr(mp;t0tetnifetadla2rmuvo (0 etnxrctydopDeluvilt t2umimpou4op  lfcsas a2rmum ;u4altoii3iyd a emu o;(4tlerxrcoydoa eaueo t trxrio oo1lp nmies t)s2ta(r ;o1alxnmfeiytfsDuanvo u4trxnmo oytfp eluvol()s2um(o3io4lmte feiasf Dumxronu1apxn i3tadlm elump;(4tetriocoytlm  aivo;s)trumimpoodll elnvt s s2uaxr ot1texn ieildls2um(mo;t0tltoxr tatlatrli s (0 2trio3oydlme liesat)aDrrum nt1optniociadfm rau on(0arxrmo tatfpDelieols srtmio3ny1omtemfetl(f 2taxroot1apto f3tld m umu o;u0aeerir3oatop   nvs;() etm(o oodome mnvtltf ruaurpot1altn o3tys s2ua(vs u) ltnmr iydoat  n s;s0seum(m3oydlle  icil(f rrmu  ou0ape  ieiaslm2eln o;u4trxrxr iotlaDranvs;()tetmxrpnu1optelict t)srumxrpno4teeomo3tydfaDeauvo;t)tlenif totoa  aivs;t0t2uo(rpiu1open fvs (fsruau pou1olxn o3tad s eanvo u0aexnmrctadomDeau i s0setmxo3iodomtemici t  2umx  ;u4olxn feiltfaDrlnvonu0arxnmr ootlm eli sl(0 2uoxrpno4om e nvsl(fs2raxr ;u4tpe  o3iadla2eluvp;t4tlenxfcty1lpDeauvs;t)trumxo3oydolt lnvs s)sDtrxmono4optoifciadfmDel(vp;u) rtrmo iytfaD livi s  2xm(m nu1ale  ici s)artr(mpoo0opxo f3ild aDeluvo;t0alenir ootfmDeai o;t s2uoxmpio4ap elietas) 2rmxmonu1ale mf3tldfs rluvo (0 lxoif3oa1lpDr ieo t0srumir3oodlpenlfetl()srraxmpnt0altomi3tld sDeluvo;t0treoxocto1opt  ues;s  rxmir3nudlmenliciasfs2rmurpnu4altnif3iatlm2eluvo t4trxnmociy1fp r i s;s0tetmirpou1alee iei t)a2ra(  nu4opxo ociltfmDrlumo;u0teerio io1laDe ivs;s  ruoir3ou1ol   feia(  Drmxmp;o0alx mieiysfs2emn s;u0trxnio3io1fmDe ueilt)teumxm iy1lp e fesatfsDraumo;o0openifcilsla2elumon(4aetoxr todlpD an il( t2tm(r3oudlmenmies tfa2uru onu0aeeomi3tasls2rlnmpnt0aeenmf3io1fa e ivi (  2to(rpio4openmnctls sDum(rp;o1opx  oeilt sDra(mo u)texrir ootlm  aiei s sruo(o3ou4lm nmietas arrmumpnt4tpeomf3tysls2rmumont0treomr3ta1fpDrli s ( sexm(r3iu1am e ies (f 2ua(roou4tlt mfetat m2rlumsn(4arxnif3iotfmDelieo;t  2xo(opiu4ol  mnvi sf 2umur ou0tpxnmo3ilsfa ra(vsnt) exniocoatopD lu s;(0sexoxopiy4am nmivil()artr(monu0aleoioeiadfa2ulu pnt4artoxocoytlpD  u i s0 rto(r no1am nlfvta( a2uaxr ot4tpt iociltls2rlnvont4 rtrircty1fp rli sl() 2tm(m no1lpe mivsatfsrurum ou0altn oetytfaDelnvs (4aetnmf3oodlmt ai slt0 rumxr oy1op  miet t  Durumoou1alxoiictltfs2elu on()aetrifcoodoa rau sl(0 euoimpoudoleemics ( aDrr(mo;u1tpt mocilsfa em(mo;t0trermrciydfaDeauvo;()setm(opoudop  lieia() 2rmxm nu4olenifctas aDem(vo;()areoxf ootoatrlnes;s0sexr(o3ny4ll  licsasfs2rm(r ;o4tex  octadfm2umu p;t)aexnifctodla rln il()trxrio nydamt lnvsl(fsrurxmonu1oexomf3iltla ean p;(4alxrir3ootom r uvo;()trurir ou4lmtnmict sf Dum(roou0open octadlmDeanms t0aetrxocta1fp  aneo ( s2to(o iodlme mfvta()s2tax pno4apeoioetytla rln o;u4treoifcty1oateli o (  euo(mpoodol  lfet t sDtrx poo4tet mi3tadfa elnvont0trenmoctotlmt anvs;s)seuoim3nu4aleemneil( aDuaxr ou4optoioeiyd m eauvo;(4altrir ia1oaDe nvi s s2toir3no1lm n fvslt)a2taump;u1tpt mi3iasfa um(monu0alxnif iytfptranvs;t0trxoxm io1omtn ivia()aDraurooo4olx ifctldlm2rm(vo;u0aexrxr ty1oa eanei (  rxo(m iy1apte nct t  Drrxroou0tee mfctldla2emnvo;u4 rtrirctydfmD luvo;t0tetm(rpno4opt mfetasf rra(mpnt0open ociyd mDem(ms;u4teerif iatlmDranvsls  2ur(m3oy1olen ivs (f rurxm nu4oetnmfeiatlm emn p u0arxoiociadlmt ln s;t)teto(r3iudoltelncsas  2rmurpot4tpxo i3ilsfs2uaums;t4aeeoiociy1oa  aues;s  rur(o3ou1openmfciat aDtax pnu4tpe mictad m uau s (0trxoxrcoy1omte nvo s0t2xo(m3no1op nmnvtlsf rraxrpnu0tpxnmfeiatfa2ul( onu4alxnxo iodlmDr i ils) 2um(m oy1altelfetlt aDumxro;t4opxnmo3tad s ea(vpnu0trerir3oo1lmD  neo;s0t2uoirpno1amenlfvta()a2uaumoou0oetnifcias m ulnvp (4 rtoifctydfaDeauvo t) etr(opiydolee ivtls  rrr(m no1tex  fetad s uanmo;()artrxr io1oaDeanvil(0trum(o nu1oleelfciat s2trurpnt0opxnioeiadfs ean o t0trtnxf oatfmteau ol( seumxmpnu4amtelnetlt)srrm(  oo1opt iiciadls2ranvpnu0tleoiociodfmt ln i s) rtoio no4lme mivslsf 2tmuroot4aeen i3iatfaDumuvsn(0 ltoxrciatlpte uei (  2xoimpio4llenlnetasf Dra(m oo4teeniietlt m2umuvsnu4trtnxo oatfpt  iesls)s2xmxmpoudom elnvs ()s2um(  ;o0tlen ociaslmDua( o;u0trxnxfctotoat livils)srumxo io1lp e feias aDrmur nt4altnmo3iysfa2rln snt4 lxoxr iytlaDeluvils  rtoxr nydapenlnet ( aDtmxrpoo4aeeomoetadfm2rlump u4teenxf3io1fp e ivi;t0s2tmio3nu4ape  iet sfsDta( o;u0tptoiieiyd s2emnmonu) ltomrcoydfp eai o s trum(rpiy1lleemfcsa(fs2raumpoo4tetnii3iyd sDea(vo;t) lxnxf3ta1omteaueol( s2umxm3nu4ape mfvtl( aDur(mpot1tpenmo3tas sDrmu snt0alxoif oa1fp eanvs t)trxrim io1om elfesat  Drmxrpnu1aetn feiytfs umuvs;()altnmo3oodfmDr nvo;t)s2tmxopnu4apeeliesas)srraxroot4tpeomoeiat a2em(mpnt4aeeoio tydoaDrlnvs t0 euoxopou1apen fcsa(fs2umxmpnt1aetn ociltfs ul(ms;t0 exoif iotlp raivslt t2tr(m3iy4op elici (  2tru pou1alxomf3iydfa ul(ms ()tlxrxfcoo1fmt  uvo () eurxm3nodole lieil( aDrrxmo;u1tleniicilt s rauvpn(4aleomr iadfat anes s teur(mpny4omenmici ()s2tru p;o0tpen oetltlsDumums;(4 lxrir3tadlat  i i ()s2xoxopoo1ope  fctas srrrx  ;o4tpxnio3tydfsDulumpnt4alxoioctodlm  aieo ( setrxm3ou4op  mnvi s)srtrxmpou4aetnifctytfmDrmu snu)treoir3ty1fp   nvi s trto(r3oudaptn icils)arum( pnu0tptnio3iad m eanmo t0tlerif ty1lm rln ils  eur(o iu4lmenmnvtas)aDrm(m oo4tpt moeiyt aDraumont)artrxr iadfpt lieilt)s2trxmpiy1olee nei (fa2uaur ;t1altnif3iltfm ul(msn(4teeomo3iydfa  au o;t0trtoim3ou1op  micilt)a2rrxmont0alt mfcilsfm2rlnvs;u0altoifciodlm rlneo;()seur(r3io1lpee ncsa( a2rmx oot1aptomoetydls rlnms;u4tlxnmo io1fpteaivi;t  2trxopoo4opeemivsat sDrr( ono4ape mfciltfmDemnvp u) rerif3tatlateanvi t)s2umxm3io4apenmivsasfa2urxmonu1olto i3ilsfaDua( s (0 eenif oatomteaies;s0 eurxrpnudal   icilsfs2urumooo0tlxo oetyt m rmn o t0altoxfctatf
\ No newline at end of file
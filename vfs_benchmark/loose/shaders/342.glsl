@@ -0,0 +1 @@
+u sl( setmiopiy4ol  lncias a2taxmooo1optnmf3iasfs rm( o;t4texrxoctodlmD aieilt)seuoim3oy4lp  mivtlt)aruax  ;u1aee mfeiatls2rauvp u4tltrmr3to1omt  uvi s sexoxmpiydopenmfetls)s2uaur ;t4aetomfetatla el(vp;()treomociy1la r n o t t2tmxr3nydoleelnct t)srumx onu1ope mi3tldlm uln o t0texnir oytfaD  uvo t  exm(o3nydlle  icia() rtrxr ou0open ociytla2ran o u)aeeoxfctytfpDe n o;t0 2trir3nu1lmeemfci ()s2tmx  ;o4ope iieiyt m ulu o;()treomo iatlm eaueilt sexrxm3iy1lmt mivsa( arurum ot1oeeomieildlsDran snu) rtoir3tatoa  aivol(0t2tr(o3nu1lpeemnetasfsDrmurpou1tlxomfctlt a2em(mo t)trerir io1lp r i o;s)texo(rpiu1am emfvias)sDum(monu0altomfeiad mDel(mp (0 reoif3oa1omDeaivslt) 2xrxmpnu4ole mnetat  rumxmp;u4oet mf3ildfm2emnvs u4 exoiociy1optean i;t0t2uoxm3ou4lpe  nctltfsDuaumooo0tpto i3iasla2eau pn(4tltomo3ootfpt  n i;s0t2trio3nu4alt  ici s  Duaurp;u1tetnmoeiysfsDrmnms (0 rxrmo3tadfatran i;(0 2xoimpnu4aptnlivslt aDtrumont1oleo feiltfa ean o;u0aetnxo3tadfm   ieol(  2toim3nu4apt  neta( sDtrxmonu4tetoio3iadfm eanvs (0 eeoircoodoa   u o;s  exo(opnudam  mivtat)sDumurp;o1opt mo3tys sDra(ms t0 lxoxrcoa1latelnvo;s0 rurir oo4op emietlt srumu pou1oet ioetydfa ran p (4tlxnxr oa1lmDrli i;t)seur(m3oodllt lnvia()srtmxmp;u1oex mi3ilslmDul(mpnu0 lxrxo todla elnvi t)t2trirpiy4ap e fet ( srrr( pnu0aeenmoctadlm2uan s;t0tlxrmr3oadlpte nvo (  2trir3iu4omt  nciatf Dtru  oo0tltnmoctyd sDemu p (0alermf3ia1omtr u o;(  etrir no1lm nlncia() rrrxr ;t0aleo feias s ea( s;t4altnio oatomtelivslt s2uoio3oo4amt mfes ()arurx ono1ape ifetldfsDem( s (4alerioctatfpD auvi;s) 2um(m nodapeemnetls a2tr(mooo1apt mi3iat s rlu o;t4 exnxfcoodlptr ivs;s  rxoxr oudoltemfetat)sDta(ronu0tlx mietldlmDuau s;t4 ltnxf tadla ran s;t setrxr3io1aptelnetlt  Dtrx poo0oeeo iciatfm2em(mo t4 exrxo oydfm eaivils0 ruoxr3ou1lmenlivias)artax p;u0opx ifctldlm2uanmpnt)altnmr to1fp ean sl(0 exrimpiu4opt lfetls sruauronu4apeniocildfm2rl(vo t0trenxr3tatfpDelu sls truoxo3oy1lmen fesls) 2tr( pnt1oexoio3tys s2uanvpnu)tetrxo ootoat  u i;s) etm(o3iydal e ncias  Drrur ;o0oltoii3ias aDeau pnu0tltnxo iydlpD aueo;s0t2xmio3io1omtn fetl()sDrm(mp;o0opxoiietltfsDumnvp t0teeoif3iy1lp   nvolt)t2umim3iy1ap  mieia()sDumx poo1apxnioetadla uanvp;u4trerxfcoatlptrauvo;t0teto(r3nodopeelncias) 2urum ou4teeoioetltfm2eluvp u) lxomf3todfpDe nes;( t2um(opno4om n ivi s)artmxrp;o0alto f3iys a2uauvsn() exrif3oo1lmteau i;s) etrxmpoydlmeelneias  2ua(mpot4texo ietydls2uanvont) rtrmf3oy1oa   nvo ( trumxmpoo4aleelfvta() Drrurooo1teenmfetasfmDumnvpn(0tetoir oa1fpteln i;s)tetoio iydll nmiciatfa2rm( pno0tptniietlsfaDra( pnu4 eenxo ootomteluvslt0 rto(m iy4llen ict tf Dumx pno1aex  ieiatls2ra(vpnt4 lenio3iatlaDeauvs;()srur(r iy4lmt  fci ()s2tax o;o1tpeomfetaslsDra( pnu0altoxr3ta1fpt  nes ()trur(r oo1olte nvsat srra(m oo4open i3ildls ran s t)arerxf tadlpD luei;s0trxmim3oo1al emfvias aDum(rp;u4tlxo fciyd a eln o;t4 exnxocia1la  an i t  exrim3iudam  lfctat) 2trxrpoo1olen feildfs2ea( sn(0trtrmrctodfat lu ilt trtrim nodamt livta()s2rmxro;t0oeen oeild aDranmpn(4tltnircoodlp   nvsls t2toir oodopen ivsltfaDurx  nt4tpeomfciatlmDrm( p u) exnmocootfm e u s;t)teur(m3io1optnlfvi s sDrau  nu1altniictatfs2umnvs;(4arxoxo3iytfmD auvi;s0srxmxm3no4lmt  nvs (f rtmumpou0tpt moetyd s eaumo;t)alxomr tytopt livs;s)trum(r nodlmtnlncil(f Dur(mooo0teeoifcild a2rmu onu)artrmrcio1lm rauvs t srxoxmpiudomte nvtlt)a2umxro;u0opeomf3iydlm um(ms t0aexnmf3iodlptean o s)truoxm ou4llt micsl(farrmu p;u1tlenmoeild m rmu snt0arxnmf3tadlatr ivi (0trurxm oy4am  lfvt (f 2rru o;o1tptnmf3iasfa2rl( pnu)tetrmoctodoatrlies s) rurim iu1altelfesl(faDtm(mp;o1apeo feiatfaDulumpnt)trxnmf3oo1fm e nvs;t  rtoxr iu1lp nlfcsl( s2urxr ;o1olxnmiciatlm2rlnvo;(0trtnmfciytfpDe ies t t2uoim3iu1oltnmfciat)s2uaxr ot4ale iiciys m2umu p u0 ltrxf tadom r i s;t sruoxopnodlm  livi t)srrm(r nt1tet mocilslmDem( p;t)tetoirciy1lat  u s;( truoir3nydoptnmicsltfs2raur nt0oltnifeiaslaDua( on()aexnio3ta1lpt lu i;(0teumim3iydam  mivtl()aDrr( onu0tetn ictldlaDra(vsn(0arenxrciodfm  luvilt texr(o3io1ap   iciat sDumump;o1olt mf3tys s emu pn()aexomf3iytla rlueslt)sexoxr iodlltn fvtas)arrmxrpot0opxoiictytfs2um(vs;t) ltrxo3oo1fpDelues (0s2umir nydlltnlivilt  2tmum nu4apeo oeiydfs2emnvp () eeoxrcoo1fptean s;(  rurxm3nudlmen nei t)s2ur(r ;t0teenmfciadla2umumo t0tlerxrcootopDe neilt)texoxo io1ll emncs (faDtaxro;t1oetnioctls a2ranvonu) ltnxf3oy1om  li sl() 2xrio iu4lmtnmfcias srtaumont1oeen ieildlmDrl(vp;t0 rtoxrcoa1omtr i s s0seurxopnydaltelieiat) rrm( p;o0aetn oetlt mDumu onu)tetnxo3ta1fmteanes;s  eumim3no1ole mfvia() Draxm nt1oeeoiictadfm2rm(ms ()trxnmrciadlm rlnvs;(0s2xoxrpiu1lm  mnvias aDrm( pnt4tpe iociat mDeanms;t)tltrmr3iotfp eaiei t)setoim3nodol nmicta(f rtrxro;o4alt mf3iysfs ulnvp;(4teeoifcto1oa  ai s t0 exoio3oodlmenlfetatfs2tr(r nt0teto ictydla rlnmo t4texrmo3tydoa raneol()t2uo(rpnu4olt mictas)a2rmurooo1aex iiciydfs2rmumonu)trxoio oo1faDean i;s0 2trim oudope mfviat)s2raxrp;o4tlxo ieiltfs2ranvo;()trtnxr io1omDeanvi;s  etmxm3io4lltelneta()arrrxmpot0opxnifcias a2rm( p;t4teermr3ty1fpD lieol(  rxrir nu4ap nmivi sfaDrmump;t1aeto f3tas s2rmu p;u4aetnxf iotfp ranvols)t2trxo3ou1omee nvtat aDua(r ;o1tetn f3iys aDrlnvp (4 exnxf3iodfaDeauvo;() ruo(o3nu4lmt mnesasfsrrru  nu1opxo oetld sDuauvs;t4trtrmfcoytlp elueo;t0 rtmiopiu4amee feiasf 2taurpou0tetniictysla rlu o;u0altoxociydfa e ueil(0 2um(o3iy4op elfeiat)aDumxmpoo1opeo iciltlaDulums;(4trtnxrciotlpteauei t0setoirpou1lpe licsa(f 2um( o;t4texo o3tydfm2um(mp;t)tltoxrciydlmteluei t t2uoimpoy1lltnmivtlt)aruaumooo0oexoifciat s elu o u0tlxomf3iytomDrlnvil()trxo(m3iy4aptemivsl( a2ra(rp;o1aeeoioeias s2rln snt)aetomf3to1oa eln i;t  2trir3nodopt mieia(fs2tmx p;u4oex mo3iydfmDumums u)teeoir3tydfaDr u s;t0s2um(r3oy4ale  ivtlsfs2rmxmpno0tpxnifcild s2rmuvpnu4aetomo tytopDe nes t  etriopnu4lpen fvta( aDuaum nt0alxoifciytlmDeau snu)trtrmr tytopD  ivo s trxmxrpoydll   nes (  Drmumpno0oexoio3tls a umuvo t)trtrmrctotlptraivs;(0 rurxo3iodom n nciatfarrrx oou0aptnmietyslm2rmn o;(0aeerxo ta1faDe neilt sexo(opiydaleelnvta(  Dtrxm nu4open f3iltlm2uan pnt)artrxo3iotfp   ieo t  exm(mpio1om  mivsl()sDuaxmpoo4oexn fctldlm2rln snu4 etniociotomDrauesls) exo(rpno1optn fes ( srtau ooo4oltnio3tlsfa uanmont0aleomf3iadfaDe ivsls0sruoir nodlmtn ieiasf 2uax  ;o1aet mfcildla ra(vo;u0tlxomf ootfm rli i () eto(mpiodopeemnei s) rum(r nt4tee if3taslaDra( o;u0tetoiocootom r u sl()texmir3nu1lp elfcilt) Duaxronu4tlt  ieilt a um(vp;u4tltrifctydoat  ivo;()teumxo iu1ameemfct t)s2ra(  ;o0tex moetldfaDemu o;u0aeenxfcto1fateanvi;s0trxm(mpnu1oltemfvta(f Dtmu pou4oee iiciydlm emnmsn()areoxf iytlat  u il(0 etmir3iy4lpte nes t s2umxm ;t4aee ioeiys a umn pn(4 reomo ty1lmt livi;( setm(m ny4lmen nvilt sDtrxmpot0aptoifciltfaDumnmsnt)alxrmfcoy1fatrln o t sexmir iodolte iei ( artm(m nu4opxn ietad mDeanvs (0trtnxo3ootlm   ivsls)setrxo3iy4ame  fes sf 2urum ot0opxnmfeiytfmDel(mo;(4aexomo3iadoaD lueilt0trtmxmpio1optnlies sf 2umxmpoo1opxo ieildfmDraumon()trenio3io1lptranvs s) etm(m oodlp elieias)s2raxmp;t0tltniieils sDumuvs u) lenif oo1fmtr i s s) 2tr(o ny1omt  fcilt)s2urxroou4tltoifctldls2ul( p;u4 leoxocta1fmDe uvi;( tetmio3iudlm emnetlt) Drru oou1aee  f3tltfm ul(mp;(0 rxoif ta1fp e u o;s) rtrir iu1om nmictlsfsrum(ront0oeenmiciytls rl( snu) rtnxociytopDraivols)truoir3oy1amtn iciatfarraxmpnt0oetnmieiysfa2ra(vpnu4 rermfciadlaDeln il(0 rxo(rpiudal elfcilt srumx  ;t4oeeo oeiysfs ea(mo;u4arxnmf3tadfmteanvi;t)tetrimpno1omee ici t)s2tmxmo;u0alenmfetysfmDea(vs t)trxnxr ty1fmDr u s ( t2toxm iodamtnmnci ()s2uau o;o1ape  fciltlmDrlnvpn()arxnxr3oo1lm e n i;s  etrir3no1lltnlict s)sDra(ro;o4tee moctadls2ulu p t0arxnioctodlatrluvs ( srtrxm3iy4optnmnvtl()s2tm(rp;u0aeen icild sDra(ms u)arerxfctydomt ai s;t0trxmxr no1ap n feias a2ur(m oo1oetniictysfaDeanvpn()tltnir ia1fateauei s trurxopiodalenmict sfs2raxmoou1tlxomfeiysfs2rln onu) renir3todlaDrln i t0t2tm(m io1ol emfes sfarur(  no0opxomo3tltfa ea( p t4aexrxociodfm  livslt) 2urxm3ou4lleelieia(fa2tr(m ;t4aexnifcilsfaDeaumo t)aexrxocoo1fmDeaneil(0 rum(m oo4oltn nciat sDtmum nt4apto ietyt aDul(mo u4aexnirctydlpD lnei s0seuo(m 
\ No newline at end of file
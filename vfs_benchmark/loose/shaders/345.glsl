@@ -0,0 +1 @@
+ueolt0t2trim3iu1ol nlieiat sDra(mont0tpto fctatfa2eanms t) etrxrciotfa eauei s0setm(mpny4ome mnctat)a2tmxr nt4apeoii3iltfmDuau p;()arxrio3oadfmt  ies;t)s2trxo3ny1ll e ivilt s2ur(mpot0tle iieiadlaDea(mon(4aexoir3tadlmD  nvi;( texmio iy4olt  nci t  Dua( pot0tltn octls aDeluvo;t4tltnmr todfaD lneslt)trtmxrpiu1lpeemivil( srtm(rp;o0tpxnifctyt mDuau on(0areoxr3tadfpDr nvo;t0tetoirpoudlptn fvs t a2ua(r nt4oexn ocildlsDuan s u0teerirciatfp   nvi;( t2xr(rpio1lpeemfciat  Dtmxmo;t4opxomocild s2elnmo t0teenir ta1faDe uvo;s  2umxo nu1ll emivs sf 2ta(m oo0texnmfeiysfaDea( s ()tltnxr3oatfaD ai o s0tetrio3iudoptnlivsls  rumur ;o1ape  o3ias s uln o (4 renxoctytlat auei;() rtoxm3no1omeelfvi (f Draxr oo4aeto ietydla eauvo;(0 rxrmo3iatla  anei;t)seuriopoo1lpeelnei t)sDur( ooo0aex iieildlaDea(mp;()tlxrir ia1fm elnvo (  2uoim3nu1olte iei s)aDtm( o;u4aleo i3iytfs ea(msnu)aexrio3oa1oaDraivi s trtrxo3ny1lmee ivsa(fsrtau ooo0olen fciytfmDua(mon(4 ltnir3oadfa elieo ()trxm(mpoo1apenmivtls aruru  ;t0tpxo f3tlsfm2rlump;t0tltoifctydfpDrlivo t)seurio ny4oltn feslsfsDtrx poo0apen f3ilsls2ul( s;()aetnxrciydlpDr nvils)t2umir iu4oleemneiat)sDrmx pnu0tlenif3iytla em(vonu4tleoifcoy1la eaivo s srtrxopou1lmtnmneils a2rm( pou0aleomoeiasfsDuauvo t)tltoio3oo1oaD  ivo;t t2umir3no4lp emnvias) 2trurpou0tpt  o3iydlsDum(ms;(4 etrmf to1fptrlneils0sexm(o3ou1ame mivt ()artr(rp;u1tpx mi3iyslaDemn pn()arxrxo3ta1la  au sls) rxmirpny4ol nmict t s2ua(  nt0aetomo3iltlsDem( o;u0 lxrio3oo1latraieol( t2urio3iy4optemnes t srtr(  nu1oeenmfciadfsDeanmo u4aexrif3ootom rauvo;t0t2um(rpny4llt lnesa()aDrrxmo;t1aetniieild sDran sn(0altnxf3iy1oatrln s s0seurimpoy1lme mfvi tfsrrm( oot0altnifcils m2rlumpn(4tlenxo io1fmt  ueo ( setoir oydamtnmnct s)s2rmxr oo1tlen i3tlt m umn p;()tlxrxf iadlmD lnvi;t) exmxrpio1lm  mncs s) Dumu pnt1alxn oeiadla eluvpnu0 rtrxociydomDe neol(  etm(r3no1ale lnci s artmxm ou1aet mfetad a rmn o (4teenmf3oydop   nvsls  rxrxo3oo4lmtn fvs tfaDuax p;o4tpx  ocildls umu o;u4arenif ta1lmtraueo s  rtrxm3ny4ale mncsat) Drruro;u4alt iieiysla rln o ()treoxociy1fm e uvs t)srtrxo nodapenlfcsatfsDrr(mo;o4opxnmfetyslmDulnvs u)arerxociytoat lu sl(0teurir3nudamtnmici (f 2ua(ronu1tlenio3tldfs umnmsnu) etnifciatlm  luvo;t0 rurxr ou1lptelnctl(  2ua( pou4ape mociadfm eluvp;t0tlenmocoo1fatelu o (0t2xr(m io1om emneil(faDurx  nt0tltnmiciyslm2ea(vsn(0tltomo tatfpt livsl(0teurim no4olenmieta() Drr( p;t4tlxoiieiytfs ra( s t0 ltrmo iatla rlnvs s0srtrxo nu4alenlicsasfa2umxmpno4aexomfciltls2ul(vp (4aetomf3totfmtrlu i t)teurxmpiu1ll nlfeias  rrmu pnt4opt mf3ias mDrmn p;t0 etoxocoatop eaieo s)srxm(rpoy4lm  lnctlsf rrr(m ;u1oeeoii3iadfa um(vo;(4aexrxfcia1fpt  u ols)srxm(rpou1om e ies tfsDtr( p;u4opxnioctadlmDel( s t)trxoxr tatoptelnes;t0 rtoirpnudll emiet s  Duax  nu0tee iieiatfm ua(mp u0 ltnmo oa1fpDean o;s  2toio io4op   nesa(faruaxr oo4tet  o3tadls2emumpnu4arenio iydlaDrlu slt)s2uoxm iu4al   iei sf 2rmxm nt4tptnio3tydfm rm( p;()tlerxr3iytlmt  i o t0s2tr(m3iu4opeemfvsat)a2rau o;u1aex mfcias aDeau ont0teenxo3iydlpD  ivils)trtmxo3oydlltnlneils  2urum no1tltomf3iltls2umn ont0areoir iadfmtranvo s)t2trxopno1lltnlicil(fsDtmu o;o4olxn feiad s ra(vs u4arxomrciatom raiei;( texr(r nydolt  netl(f Drmxroou0tex iicilt sDrau o;t0aleomr3iatomteauvs () rur(m no4apee iei t)s2rru p;o1teenii3ils m2umuvo;()teenmf ootlpDrlnvi;s  euoxr nydlp nmnvta( s2rmxmpno0tlenifctad a2emn o () lerio3oodfm  lies;t0s2xr(r3iu4aptelncsl()sDrm(mpoo0oeeoifetatlmDulu s;t) ltriociy1fat  i olt)sexmio oydlm nmfetl(fa2umxrpno1aleniociat s2uau o;t) rxoio tytoateaueo;t0t2xoiopoydale mfctatf Dtaxroot1tltoiociydlsDeanmo t0 etomf3iodoaD  nes;()trxrir3ou1lpee nvt (fsDtrx pou4altnmo3tydfm2rmnms;u4 exrif3ia1omD auvsls)s2toir ou4olt  ivs tfaDrax pno4ole  o3iltfmDuanmsnt)artoxo3ty1faD lneo;t t2uoio oy4omee nvsatfaDtrx  ;u1oltniietltfm ul( o (0alenmf tytlmteaieo ( tetr(r3ou1ap e ncta( sDurur oo0alx moetyslaDum(vp;t) etnir3totlmDeluvolt teum(m io1llee nvtl( srrrxmo;t0tlto feiadfs2um( s u4texrxf tadomtrlneo;t  rurir oydap elfeslsf Dtmxmo;o4oeenifciyt s ranvpn() eenxo3ty1oa e ivs;s  rxm(r nodll   fciatf Draxr ou4apt ifctlsfmDua(von(4altnmociytop   uvo (  2umim3io1al elnvi ( a2ua(  nt4tlt ioeiyslsDuauvpn(4aeermo3tadoate ivo;t)setrxo3iydlle mnctat  Dumxrono1tptomfctyt a2em( o;u4teermf3oytlptrli il(0trxoim ou4lmeemics t)aDrr(rpnt1tpeoiieias s ranms;()aeerxo oatomtelneo s)tetrxrpoydlp elnvt t  Dumx ont4aeenmfeiysls um( p u0texrxf3todoat  i o s trur(o ny4op e nvta( sDrax oou4olenifcilt a emuvp t)trxrxf3oadlm rai i;()setoir3iu4lmtemfctat)aDrm(mpno1aeenifciytfm2rauvo t)aexnif3oadlat  n s;s0srtoir3io1ll  lfcs s)srtru pot0aptnmfetlsfmDraums;u) eenmr3tytlmtraneo s  etoirpou1lpen ieia(fsrrmumo;u1aex  oeiytls2emuvs;u) exrif3tytlmt  neil() euo(m3io1ap elict (fartm(m nu0tpe  fctls mDrm( o;(4arerif oydoa r uei;t)seumim3oodap nlncsa()srurx onu1olen feiaslaDrlnvp u0texrxr3tytfmt auei s0texo(mpno4ameemiesa( s2raum ;o1tpxoiieiat a2rmuvon(4 rxomfctadoaDr nei;(0trxrxr3ny1altnmfcsa()s2uru pot0oex  o3iadfmDelump u)aeeoiocoodfpteaneo ()trxmxmpnu4lp  lfes s)sDum(  ;u4alxoifciys aDumu snt0areoxfctotoatean s (  2xoxopoydameemietltf rurxm oo1teen o3tlsfm2emuvp t0arenifciydopDe nvo (  rur(rpiodlm  mnesa( srrmur oo0oexo ociadfm rmumpnt)tetrif iatlptr i o;(0sruo(opiu4altnlivsl()srrmur ;u0ole mf3iaslm2emuvp;u)aeeoir totoaDeli s t) 2umxmpoudomt lietltfsrrmx ooo0tet  feiyslaDrmuvp;u4arenirctatfpDe iesls)srtrir3ou1ll n ictltf Dtm( p;t1oltniiciyd m2em( o (4tetnmf totfp eai sl(0 2xmimpiudlpte ivilt srrmx  no4apenifeiytfsDuauvpnu4arerir tatlp r nei;(  rxmxm3nu4olt mics s) rta(mpot0aee  fciyt mDumn pnu4tlenmo to1oa r n sl(  rxr(m iudopeemfcs t)sDtaxr no0ale ifeiysfa rluvs u)tlxnmr totoatr n s;t)s2tmirpio1lltnlfesl()aDrm(rpnu0tlxn ieiltlm el(mpn(4aeerxr oodopt li o s0srxoio oudome lfet ()a2rm(  nu0ole  ocias a em(mo u0aetomfctytfp rln sls trtrxr3iudll n nciltf Drau  oo4alx moeilsfa elump t)aetrif3tytlp  ai il() exoxr no4lpeelicta()arrmx o;o4texomo3iyd m2um( ont)alxomf iodomDraueol(0 rxrir oodopt lieil( sDua(m ;u4olxn ietasfmDea(mpnt4aetnir oy1fp e nvs;( trxoio3nudapte ncsas aDrrxro;o1tpxo oetld sDuanvo (0arxnxociytfmtraues;s)t2xoxr3nodomee fvtat)sDuru ooo0aeenio3taslm2rl( p;u0 lenxrciotfptrlu i;t teurxo no1apte fvsat) Dum(ront1aeeo ietldfaDumnmp;u4 rxrxfciatop eau i t) 2umxo3oo4ol  mfetat  2um(rpou4oeen o3tas s eluvo;t0 lxoif3io1lptrlueo s)s2to(r oydlmtn nvt s  Dtaxmooo4oltnmfetltlm2ul(monu4arxnmfcoo1om elnvils trxrio3oo4apte ncsas  Drrx oot4opeomieiydlmDrmumsn(0 rerxo3oydlpt anvs;t0 2ur(r3nodalee feilt  2rrurpou1tet io3tlsfa2rmu s;u4aexnir ta1opDeliesl( trurio ou4omeemnctl()artmx  oo4altoif3ilsfm2umuvs;t0aetomo oodlpte ueo;s) rurxm3ou4lmt mfciltfs2taxm ot0tpe mfctldfmDua(vs t0artnxrctytoa e i i (  exrxm3iudlp nmnvsls)a2rr(r no4ole  fciydls2eluvp t4trxnmr oadopDe nvs;s0 exoxmpoo1ameelncslt)s2umx pot0optn i3tyslsDemn p;(0tlenif oodla rlu s;( trumir no1amt  ictasfaruaumo;t4tpxo fciatfa2ranmon(4tlerxr ia1fm  lnes t) 2tm(rpny4altnmivsls) 2raurp;u4apenmfeiadla2uanms;t)tlxomf iadopD  u s t0t2umio3iu1lp n ivta(  rrmx pnt4tlen iciytls2rlnvsnt)tlxnmf3iytoptelu ols)tetmirpnodlp e fes t  Drrxrpnu0tpxoii3taslm el(mp;t)aetnifcia1om   n ols0sexrxm3nodlp   fcs (f rrru  ;o4oetomictldfaDeluvp;t0arxnxf iadomDean o t teuoxrpio1ap  lfvsat) Drrx  ;o0texo feiasfaDumnmp;u0texomocoo1fpt ln i;s)s2xm(mpny1olt licsa(fs2umxmpoo1optoiieiysla eaump;u0altoio iadfa rauvils setoxm3oo1ame  ies (f 2um(r ;u0apeo o3iydla2emn s;u0 etomo3iadlp  lies s) 2xrio oy4lp nmiei ()sDtruronu1tlx mfctatfm umumsnu0altomf to1lpD  neols) exr(r nudal nlfvtatfarra(rpnu4tpeomoctytfsDelu o;t4 reoxfctadfp   ues;t) 2xmxo iy4ll  mivtls  Dum( pno1tpeomiciysla2rlnvont0trtnir3iatop e ivi t0seumxo3oo4amtn ivsl(faDta( o;t4tlxoifciatlsDra( p t4trtnircia1opte uei;( s2xmxmpnydlltn ici () Drrumo;u0teeniocilsfa2emn snt4 rtomfctodlaDean i t0s2urim oodomenlnvi ( a2umur nt1ale ioetyd s emumsnt)tlenxfcta1lm eluvs s) rur(opou4al nmfcsl()sDur(mpnu1oee mfciad s2rmuvp;t4altrxo3iytfp eau ils0trtoxopno4ome mfcsa()a2ra(mp;t0tpt  fciatfs2rm( p;(0trxrir3oodlaDelues;t)truriopnu4op e fvs s) 2rauronu4tlxo oeiadlm ean p;u0aeenxr oy1fp r i s t)s2toiopny1lpenmfes s)arraxronu1tpxnifeiad mDum( pn(0alxrxo3tadla rlivsl(0seurim3ny1ape lnei sfsDumuro;u4opeomfetldfa ul(monu)tlxoircoadfatr ieilt0sexr(r3iodlltnmncils) 2tmxm nt4opxniieiat mDulums ()tltomo todomt  n i;()trtmim3ny4lm emiciatf rur(rpou4aexo o3iys aDelnvpnu4alenif3io1opt  nvs () 2urxm ny4lm   ivsl()a2um(r ou0ale  i3tat m rlnmp;(4 rtomo3ootoatraivolt s2uoxrpnudlle lneil(  rua(r no4oetomiciaslmDrmnmpn()trenmocoadomtran i;() rto(opnudoltnlnetlsfs2tru pno0tpe mi3tls s2rlnms;u)aeeomr oodomDrln slt0teuo(mpoudapeelncils)s2taurpoo1openmoetyd sDea(mp t0tlenmo ta1om rln ils) exrxmpiy1aleelictl()srtax  ;u0tltomfctltls2ra(mo;u4teenmr3oa1opt anei;( teuo(mpou4aptnmivil(farua( pno4oleomicild m2ra( o (4alenir3oodlmD aiesl()trumimpnudopenmivils)s2ta( ont0aee  fetltlmDumu p;u)alermo3iadla rau o () etm(m3oo1am  mfetat  Draxmp;o4aptomfeiad m2ra( o ()texrxfcootoaDeaivilt setrir3iodamenliciasf 2tr(  ;u1tleo fetldfm rm(vo;(4 lenifctotfptr uesl()setmir3iu4lptnlneilt)s2uau onu1alt  feiyd mDumu o u4aleomf3iy1laD auvils0 etmio ny1olenlfvils)arumur no1oexnmfetls s2rl( p (4aetomr ootoa rlnvols0 etm(m iy1lptnlfcsltf rrax pou4tlx iietysla emump;u0tltrir3to1om   nvolt)s2umim3oo1ome mfes s  Drr(  ou0oee mfcilt a uaump t0trermo ia1fmDraivsl()srur(rpou1amt lieia( sDurxrpnu4olx mieiydls rlu pnt0areoxociydfptrau i;s0 2um(r3nu1optelnvt s  Drmurp;t4alt mfeiydlm ulnms u) leoxfcoodlptean il()tetoxm3ny4amt mncils)a2tmumpot0apeomictadfm2emu pnu0alenxrctytlate ieo;t) ruoxm3nu4al nlfetat) ruaxrono1tlx mieiltls2rmnmsnt)trxnmr tadfm raneo;t)sexr(opoy1am  lncil(f ruaxmoot1tlxo fetydlaDel(mont)teeomf iytlatelueilt0 rtrxrpiu1ol   fvsls)sDtrxroot4apeoifetlsfs em( p ()trxrmrcoo1fmDeluvol(  2tmxo3ou4om  mfvi s)srtrxmo;t1oltn f3iatfs2rlumo u4 ltnxo ootlpDr n i (0 eumio ou4lpeemnvi t s2raxroot4oetn o3tytlmDumu p t0areoir3ia1lp e n o s0trtr(rpnu4alt  ietas  2raurooo1oltoii3ilsfm rl(vo t4 leomr3oa1fatrln o;(0seuoxo iudomeemfeslsf rua(rp;u0aexo o3ils m2ua(vo;t0trxriociytoaDeluvil() ruo(o no1olenlnet s) 2ur(mpnu4apeniicilsla2ua( p (4 etnxf iatfat auei;()sexr(r3oy1ame  fvias srrmum ou4olx  f3tltlm ea( snt4 eenxfctadfmtrluvols0 2xm(mpnodapen feil( aDtaumo;t4tet ioctld sDra(mo (4arxoxfcoadomt anvs;s seumir iudop   nes ()arurxmpnt1opxnmociydlaDul( p (4teerirciydom eliei;(0t2tmir3oo1olee feil(f 2umxmono1oet mictlsfm rmums (0altomr3to1laDeaivslt trurxopiy1lptnlietas arta(  ;u4tlxniieiasfaDua(vo t4 exoxr3to1lm  au i;( seumxmpnu4opeemnvta(f rumx  ;u0aexn i3iydls rm(mp u)aleomrcootfmDrau o;t)t2umxm3nodol nlicsl()sruax poo0olt  ieiadlm ulnmont4aexoircoo1lm r uei ( seumxopiudapenlnvi ()s2trxr oo0tlen i3iydlsDumnmo u)arxrmo tatfa r uvo;(0 2urxr iodaltnmfeiat)arurx  ot0oetomo3iad m2emn p;u)trxrmr iytlmDrliesls srxoim3oy1ame lfet sfsrrmuroot4altoiiciad aDrlump ()aexnmo tytomDr nvils)teuoxo3nodalt mfcsa() Dua(m ;u1oexn o3iysfa2elnmpn()alxnmo ty1faD lu s ( s2tr(rpiu1llee iesl(faDraxroot4opeo oeilslsDuanvon(0trtnmf to1laDeaieo t)s2to(rpoy4lpeemncs (f rum(mpnu0oee  f3iyd a2rmu p;(4arxrxfcoodoatr nesls) 2tr(m3nu1lmtelfctlsfarua(mpnu1opxo fctys a2rmump () exrio iadoaD  uvo;(0t2umxm iu1openlnvils) Drrxrpot1alxnio3tytls2elu on(4 rxrxfcty1fm e ues;s  rtmim iy1lpeelnet tf 2ua( o;u0aetomo3ild m2um(mo;u)aexrif iydfatr i i t0 rxoxm3ou4op emfeils  Durxmp;t4ape moeiytlsDranvs u0 ltnif iydfp rln ils) ruoxm iy4lmtelfcia(f Dra(roou0oetoii3iytls2emnmo t0artoifciy1om eln sls  eum(rpny1aleemfetls)srurxmooo4oetnii3tat aDumnvpnu0 ltnmrcoydfaDrau i s)srxrim3ny4alt  netlt)aDrrxmont4apt mfetyd s2umnvo;t0trtnmf io1faDr ues (0 euo(r nydame mivsat aDtm( ont1tpe mo3tysfm uan snt0artrio oydopteaivols0 2toiopoo4alt mncil()sDrmxm nu0openmociatfm uau s t4alerxr tatlpDe ieo (0sexr(opno4ope mncsas)aruaxroou0aeeomfciyslmDrm(vp (0tetrxo3ta1faDran s;( trumxm oy4apt  feiat a2uru ono0olx ioctadla uluvs;(4teeomociotoaDr i i;(  exr(r3io4lptnmnetas a2tr( pnt4tpt micild s emnvp (4 lxnmfciotla elneol() 2ur(m oo4lp nmivt ( a2taurp;u1tlxomoeiydls rluvo (0tltoiocty1optrluvi (0 2xoxr3nu4omenmfviat) 2tm(rp;t1ope iiciyt m2emn p t)arerxr oodlp rlivols0sruoxo ny4lle lncslsfaDrau p;o1opt ioctlsfm2rluvo u0arenxrcoo1fpD luvi ()texrxo3oy1ape  nci s srur( poo4aexnio3iltlmDranms (4 eenxr3tytfa ranvo;()s2xm(rpiu1lme liviasfartaum no0teenmoetltfa2emuvonu4 rtrxrciotopDe u o s  2xoio3oo4op emfviat arua(  ot0oeto o3tlsfa2em(mo t0trenmfctydlaD  u s;t)t2xrio io1lm e ietlt)aDumxroou1olxo ictytla rln snt)arenio iydfpt lueo;s  rtm(o3ny4lm emncs s)s2tr(m oo4tlxn fciadlsDum(mp;u0arxrxr3iodoaD  uvo;t0seto(rpnu4ale livilt) rtaump;o1opx moetys a2ea(mo (0aetrif oodlmDr u ils) 2xm(m3no4amte ivi s) Dtru ooo4oeeo feias s2um(vpnu4 etrxrciytop  aueo (  etmxmpoydop  lfetat) Dur(rpou1aeenif3iad mDemnvs;(4tlxomoctotomt  n ils s2tmxm3ny1ll  mics t) Duauro;u0teto i3iltlmDrmuvs u0trxomo iytfa  li ilt0srxmio3oy4lpenlfesls srurxrpno0olxomietytls2emuvsnt4 lenmf ootfaDeauvi s0sexoxmpno4am nmnetatfa2uaumpno0oeenioetaslaDelnvs;t)trxoiociy1fmt  nvols t2umirpoo1opte nvs s) rtaur nu1tex micildfs2umuvs;u0arenio3iotfaDrlu s;s0seuoxm3iu1om   fesl(  2urx  ot1opxnioctlt s emnvs;u0trxomf tatfpD  n o s tetm(rpnudll  lfes (faDtmum ou1oleo icilsfa2uauvpnt0aeenio ia1lm  anvi ()sruoxm nu4lm nlicsas  rrmxrp;o1texn f3iasfs2ea(vp u4texnio oadlmDr u slt  2xoxo3iy4olt miesa(f rrmxmo;o1apenmoeiasls2eluvp;t4 eerxo3tydfm eai i;t setmio3iudaleemnes sf Draum oo1opeomiciadfmDem(mont4tltrmocoo1la  aiei t)s2xoxm no1op e icsat)srurxr ou0oexoifetasla eluvp;u0 etrxr3oytomDe ueo;t  exmim3io1oltn iet t)sDrm(roou1ole iicilsfs ua(vs;u) ltrxr iodlm e ieol( tetoxo3nodomtn fet ( a2tmxrp;t0aeenmfcils s ulnmo;() exnxf3oatfmDeaivs;( s2uo(rpou4amteliviatfarumu  ot1tee  i3iasfa2emnvs (0aetnmo tadlat  nes t seuoxm3oy4lmen fvia( sDtrxrooo4ole mfeiydfm emu s;t4tetrif3oydlatran ols)s2uoirpio1op elncs t a2raxroou1alt  i3iydfs2ulu s;u)tlxrxrcoy1laDe n i s0texmim oodam  lfvi tfartm(  ot4tpxn o3tadfsDumump;t)texrmf oo1op raueols  rxo(r io1openlivta( arrm(r ;u1aex mo3ils a2ul( on(4alxrxf3iotoat aiei;() etriopno1om elfeta()s2urxmooo4tpt if3tltfsDemnmp ()tltoio tatfaDrluvi;s) euo(r3io4lmee fetlsfarraurpnt1opeomfciad s2elu onu) rxriociydlmteaies;s0 exrxm3iudap nliei (f Dumxrooo0tpenmo3tls s2ul( on(4 eenmr iydomDelues;(  rxmxo oudaleelieil(  Draurono4alx ifctytfs elnvs u4artoxocta1op rai i;s sruo(rpoy1ame mieia(farta(m ;t0oetnmiciad m emuvp (0 rtrxr iytoptrauvi (0texo(r3oudol nlnetl( aDtmumonu0tpxomociatfm2ulums;u0 rtrxoctatlmtrauei t0srxmim iydopt  fvi s)sDtrur oo0tltomfeiyt sDrlnmp;t0trtoir iatla e nes;t)teumimpoo4aptnlnviltfartr(mp;o4oeen ieiys m emnmo t0trenxf3ootlpDrai o;()s2umxm3nu1lptelieilt a2raxront0ale ioctldfaDeaumo u)aeerxf3ty1lmD livs s0sexrxopoy1lp e nvtl( a2ua(m no4alto iciyt aDelnvs;()aeermfcoodomDrlneo t0 etoxmpiu1lp emfvilt) Dra(ronu1aexomfeiasla elnvpnt0teeomf iytlpteaneo ()s2xo(o nu4optemfvi s aDraump;o0ape ioeilsfmDuluvs t4 leoif iytlaDelivi s0t2tr(rpny1op  livtls arum(rpoo4tlto feiys m emn ont4trtnio3oadop e ueslt0t2ur(r3oodole mieia()s2rrxmooo1oeen oeiydlm uaums (4 eeoxfctydlmD  ivo;s  etoxrpiodalen feiatf rumxm ot0oeeo oeiysfa rm(vonu)trtomo3iydlptean o t0 2xoxo ou4apee ici tf 2rmum oo1oeenio3iyd s umnvo ()alxoir3ia1lp  lneo;s0s2xmir nydap emncsl( sDtr(r nt4tpeomfeiaslm ulumsnt0aleomr3oa1fpte n i ( truo(mpiydlpte fvil(  Dtmxmpno0aeen ictltfa2emuvsn(0 etrmo3todom rau s;t truo(r ny4op emfesl(fs2umxmpno1opxnioeiys aDra(vpnu0arerxf iydfmD luvol( srumim3io4lptnmiet () rra(m ;t4oeto f3ilsla2eauvp () eerxo3oo1opD  nvo t)srtmxr3nydomenlfctas s2rrxrp;t1tet  iciltlmDrmnvp u4 rtnxr tatfatrauvols)teuoxm3oodomt  ncs s srrr(rono1tlx  f3iydfm2uln s;t0trxoxrcoa1oaDrau ols)srxr(rpnydlmen fei ( s2tmumo;o1oeenifeias a el( on()arerir oo1om rau s (0srxm(mpiu4lmen icslt sDrmuroou0aex iociys s2uau s;(0tlenxrcty1fp rli ols0srtmim io1amtemies tfa2tm(  nt0alenifctld m ul( pnu4trxoxf ta1oateaies;s0texmxopoydlpeemivslt  rtaum ;u1tpt mi3tadfs2emu o u) ltnifciodfpD  ues;(0trtr(r3nu4lm e ieslt)s2tm( o;t0aetn ictltfa rmnvp;t4 lerxocia1fp r uvi t t2xrimpoodam n ivias) 2taxmo;u0olx ifeiytlmDua( o;u4aexoxf3ta1fmt  ueilt  eto(o3iydopenmfctatf Dta(ro;t0tetnmictaslsDul(ms;u) exoif ty1fmDr nvsls  euo(o3ou4oltelivtlt aDtru p;u0tptoifeiasfs2raump (4trenmr tytlat lues (0 2uoirpoodalen fvsl(fa2uaxrp;o1tpt ioeiyd sDem(vs;u)altrio iodopt ln ilt)sexrxo oy1olee ict t aDua( onu1aee mi3iyt a2emnvsn()trtomrcoydfm e ies t sexrimpiu1ol elivt t)aDtax  ;u4opt  fetas a2umn o t0 leomr3oydomDeanei t0setoxo no1lle  fvt ( a2rr( o;u4alxo ociyd a em(ms;u0trtrmo ta1fmtrliei;() ruriopoo1lme lici t srra(m ;u0tptoif3iaslm eaumo t4texrifcoadfaDrli sl()t2xo(o3ou1lle lfvtl(  2uaxm ;u0texoii3iysla2ra(von() etnmr ta1opDeli i t seuoio3nudalt  fctlsf rumxroou0aptnio3ildfa rmu snt4alermfcoodlatraues;()s2uriopoodolt mieslsfs2um(m ot1tlen icilt m eln s;t0 eeomo tatlaDeaues s s2umim3iy4omt  ies t artaurpnu4opxo ictyt a rmnms t4 ltoxfctodlaDraues;t0trtoio oy1lmenmncs ()srrauront1tpt mfetydlmDulnvp (0 lenxrciytfm  ai i;() exrxo ny1al   ivi s aDrm(rp;u0altomictasfaDran p;(4 ltrxf3oydoat anes;t  2xrim3ou1om emnvi s)srumurpnt1oetnii3ilsfs2el(mp () renxr ty1lp   uesl(0 etoxrpiudop elieia(fsrtm(  ou1texn fctas a2rln p u0 ltnmoctotlpt liei;s  2tm(m nodap nlict s a2taurpno4oetnmociltlaDul( onu)tlxoxf3tadfp rai i;(  2xmio iu1omtnmnci t srrm(ro;u1tex miciysls umums;()artnir tadlp ean ilt0 2ur(mpou1lp emivsatf rraurono4oeeomociltlm2rlnmpnt4alxnxocoo1lat au olt s2trir3nodaptnlici t)a2rruro;u0aexniieiad aDuln pnt)aetomocoodoaDrai s;()sexmimpny4lm   ieil()s2taxmo;o1opxnifeilsls elums t0altrxf oy1lpDranvi;t seuoxmpoy4lm elfvs ()a2ta(m ;t4olxniieiadlm el(vo (4 lxrmf3tytlpt  uvsls) 2to(opnudlltelnct t)srraur ;u1tpe iieiltls2rmumo;u0teeomr iatlatrai s (0s2uoxr3iy1alen fei s sDurx  ;o1tee  i3iad s2umn p () eenioctatomteaneil() 2toirpoo4om   fvsas  Draumo;o0texo feiadfsDeln o;t) leomr iytomDeau i ()tetmxr iudll  livsls)aDrr( poo1aleomi3tasfm ra(vs (0tltoifcto1oa  ai o;s t2toxopou4openlicsasfsrrm( pou4alx ifciyt mDuanmp (0 eenif3oy1oa eaueo;()t2um(opoydal emfvtasfsrrmu  ot0oltomi3ils a2rln o;t)artnir oadfa   uei t0srxmim3iy4alt liesa(farua(r nt1apxomiciydls2emuvsn(0aetrio3totfmDe ieo ( trxmxr3ou4lp emfvt t)sDtm(rp;o4oltomoetat s2em( s;t4trenxr oodfaDe nei (0seum(o io1opt mict sfa2tmx  ou0ole  oetas aDrmnmp;(0 lxoif3iatfptr ieolt t2xm(o3oudopeelnci ( sDtrxro;u4apxomictydlm2uau o ()alenxf3ta1fm   nvslt0teuoim no1am   ieta() 2tax  ot0tpxn fctatfsDel(mo t)arxrmo iatlmtean slt sexrxm ou4opt  feilsfsrrmu  nu0aee  oeiytfs rmnvp (0trxoxo iy1fmteau s;s  2urio3nodlptelicsl(fa2tm(  nu1aptoif3iaslm emn pnu)tltrxo3oo1om r n s;t)s2to(o3oydlmen iesa()s2rauro;u1apxnmi3iysfa um(mp (4 etrir3oodlmtrlivils0 2trio ou1am emici (  2urx  ;t4opxoiiciatfm eanvs;u4 etrmrcia1oaDrlnes;t0teum(r oodap nlncsat)arurx pnu4texoioetlsla2umuvp;u)alxnir3iytom r uvils)trxmio iydlmte neil(fs2rr(m ;u0oeeoii3iatlm uau s t0artoir3ta1omte uvils) 2trio3nodopeelict t arrmu ono0apto fciysfsDul(vo u0aetnxf3oodfm  lues ()s2xo(o3iy1am nlfeslt)aruau  no1oltoioeiyd m rln snt0tetnmfcia1oateaieols0s2xrirpiydom nmicsa(f rtau pnt0oetoif3ilt m2umumsnt0alxnio oatfaDe n sl(0 eurxr3oo4lp nlfctls)a2tm( poo0tptnif3iadfm ulnvs;()artnmr3oatfa r nesls0s2uoio iu4lltnlfes ( s2urxrp;o1tpxoiietadla2uanvon(4 rerxr todomDrlneo t0trxo(m nydlpe liei (f 2rmx ont4apxoifctltls emuvp u)areoxfciatlmtran o s0seuoir3no4ope mfet (fsDrm( o;o4oexniicildfm2rm( pnt4 lerxfcoodoa   n slt teurio nu1ome licils  2tm(r oo0altomi3ildlaDemn sn() lenmo totop  lieo t)t2urim3nu1lle mivt s)aDtmu pot1oetnif3iyt aDrluvo;() exoif3todlmtr nvilt0trtmxr iu1optemfcsa(f Drr(  ou1ope iictad m2rl(vsn(0aexrxo ty1latean s ( srxoxrpou4olt mncs t)sDrauro;t0tlxnioeild a2em(ms (4tetnif3oadomtrauvo (0t2to(mpno4olt lneil( sDum( pnu0oet  fciadla2rlnvonu0 rxrxrctotfpD  nei;s0 rtr(r oo1lp e ictlt)s2uax p;t0tet ioetlslsDeauvonu)tltrxo3oatfmte n il( srurxopiu1op emietl(  Drrxmp;o0olto fetld aDeanvp;(0aetrmrcootopDrlueo;s)t2tmiopio1lp elnvsl(fa2urxmonu1oexo o3iat aDelnvont)tlxoxrctadoatrliei t)s2tmir io4al n fctas sDuaxm nu4tle if3tyd m rl(vo;t0arxoxf3iadlmtraueo s trum(rpnydop n nct (  rur(m ;t0tleoioetaslaDrmn p;t4 rtomf3iatoaDr uvs;(  2xmxrpnu4op n ivsls) ruaxmp;t0aleomo3iltlaDua(vs;()aetoif oydlptr uei (0trtrimpoy1llenmfctas sDrm( o;t1alxomoctadlsDran s;() rxrxr iy1opt  iesls  2umxmpiu4ope mncta(fsrrrx  ;u1aex iiciys m um( snt)trtoirctodla   neil(  etrxrpio4omt licia(f rtaxm ;o0aleoii3iadfmDul(mo t)trtrmfcoy1omDraivi ()trxo(rpiydapt  fvs (f rrmx  nt4tlt ii3tatfmDel(mpnt0arxoifcta1lptrlnvi s0trxrim3iy1lpenmivs t a2rru p;t4tlxn iciadfaDum(vs;u) ltnmo3io1lmtraneolt)teumio3iy1op nmnctls sDta(r ;o4apto ociydlaDel(monu4trxnxo tadlpDeaues;t0t2tmxo io1amte ncils)sDraxr no0aptnmociysla2ranmo u0 eerircoodomDeauvol( t2uoiopny4al nmiet sfs2ururonu4alxnmf3taslm ul( pn(0aexrirciodoptrlu s (0t2um(o oo1llenmicilt) Draumoot4opx  ieilslm rlnmpnt)treoxf oodfaDr ueilt0t2xr(r3iy4op  lfesa()aDtaurpoo1aptnmoetlslmDrln onu4 lxnio to1fa elues t)t2xmimpnudolt mics t artax  nu1aetn f3iasls2emn sn(0arerif oytfmDran sls0 eum(m oodapee ivtasfs2tmxm no0tpx ioctlslm rm(vpn()aleoxrctydop  ln o;s0trtoxm3iu4olte fcsas arra(m no0tltomfeiys sDuluvp;()trerifcty1fpDr ivo;s  2uoxrpio4llt lnvias)srtrxr ot0opto oeilsfa2em( o;t)tetrmr3iadfp eauvslt)teto(mpio4lpeelict t a2um( oot1oex mi3ils s2ea(vp;u0aexrmo3oy1omDranvs ( trxrxmpio1ameelfes () 2taxroot1teeoifeiltfa2rlums;t4texrmo iatfm  au ils0t2uoxopoy1amte nvtasfsDumxrpoo1tpeomo3ildls2uluvpn()aexnmr oo1lmDr ivsl()s2xr(m nydaptelivsls) Dtrx oot4tpenmoeiydfa emumsnu0 rtoirctytfa elneil()trumxo3iy1altnmfet s) 2tr( pot0apt  f3iyt m elnvp;t)aleoxf iadop  au s () 2xrir oy4ap nmfcsa(f rtrxm ;o1olen oeiysls2ulu s u0 etomr3oatfaDe uei;t  ruoimpiy1lme mnvta(  2rrum
\ No newline at end of file
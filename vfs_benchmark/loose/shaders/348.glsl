@@ -0,0 +1 @@
+uvi;s)seumxr oo1lp n ivtlt)a2tm( pot0tlt iiciyd mDrlu pnu)tlxnio3to1oa   i sls0texrxm3io1omt mfetl()sDta(r ;o0apx mfciat m eau p u0tleoio oydlatraneo;t0trxo(opiodop nlncsasf rtr( o;o4tlxn oeilsfs uanmpnt) etomocoadlmD luvolt) rxrxopou4lm  micsasf 2ur( p;t4tex ioetlt aDuanms;() ltrmocty1lptr nvi;(0t2xoir3nodap   fetat) 2ra( oou4aexn o3tasfm2ea(monu) exoxfciotomteau s;s)s2xoimpou4ole mnct t srta(ro;t1oet ioctadfa2uanvo u4 renif todfp  lues (0s2tr(o iydop   neil(fsrumxrooo0tpxnmictas s rl(ms;(4 rtoxo iytfp rlnvsls0sexm(o ny4am nmictat)sDtru  no4aetn fciydfaDuan sn() rtrxf3oytoaDrlnvi t srxmxm3nu4olenlfvtls s2ta(m nu4apen f3iyd mDuaump (0 ltnmfctydlmte uvils0 etr(m iydamt liesat sDtaumpou1oltnmi3ils a elnmpnt0trenio3to1lat aneo;(0srxrirpnu1lm emfesltfa2rmxro;t4oexniociat aDumnmpnt) eeoxo3tadopD aueo ( trumxr iu1om   fvtas srumxrp;o1oltoifeiatfsDua( p t0arxnmocoadfmDeai o;(  rxm(o nodlm nmnesatf Dtaxr nu4tpt  fctyslaDranmp t)trtrxrcoodfaDrlieo s)teuoiopio4oltnmivi ( sDrax  nu0aetoio3tatfaDrln p;t4 etrif iatfptrlu i s  etrxmpoy4llenlnet ()aDtm(r ou4tpx iieiytla2uanmsnu4trxrxfctodoa elivilt  rxrir nu4lmee ict s)s2tax o;t4opxoii3ild sDrlnvonu0alerif3tydomtelues s)srtrir3nodllenlfeta(f rtrxm nu1tlxn ietls a rl(vs;u4 rtrxr oodlmDrlnvi () rtmxmpiy4ame liesls)srumx  ot1apxn i3iadlsDuluvs;u0teenio iydlaDr i s;t0s2umio iudomen ivsat aDtmum ;t4opto ieiad s rluvs u0aexrxrciotopD  nes (0 etm(r oy4al elictltfs2umu o;u0opto oeilt a uln p t0 leomo3iy1opte uei ( trxmiopoudlpe  fciltfaDrrurp;u0olt  ocias mDua( pnt4altnxr3ia1opte i o t t2xr(mpnu1lpenlfvt s)arrr(  ;o4apx mo3ilslaDul( on(0alenmo iotfaD luvilt setr(rpiu4lltnmivtlt) Dra(r nu1open oeilsls2ranmp u)alxrio3oytom raueslt0trtmxr3iy1ame  fetls  Draumpno1oeeomi3iyd s2emnmp;(0tlxrxf3oadoaD lueo;s  etoxrpoy4lpenlivtls a2ur( o;o0apxo i3iyslm2rlu pnu) rtrxr3oytop eli i t sexo(o oy1oleemnvsat  rtmurpnt4oltoiicilslm2uauvsnu)teenxo3iadlmDrlnei t0 rtrxmpnydlpe mfviat)a2taum ou4apeniieilsfs2eauvs;(0 lenxo tatom rli ilt  2toxm3no4llte fesl(f 2rmx oot4alx iieiytlmDua(vs ()tleomo3iytfatran ils)trtrxo3ou1lme mfvia()srrr(mp;t1tet mi3iatfmDrm(mpnu0 rxomf3oadlmDe ivo;s trxo(r nudlmt lneiat  2rmxro;o0oex  feiatlsDeln pnu0 lxoxr oydfmtr ueo;s) 2xmim3oy4op nmietl(  Dum(m ;u4tleoioeilsfmDrau snt0artrxo3iodla eli s;()t2toio no1ape mfesat) rraumpoo1oex iieiltlm eau snu0 lxnmo oatlmDeai s;t0 rumxr ou1optemfvs sfsrtrxront1tptoioetytls ean p (0 exnmo oadlpt  neol(0s2tmir nudap n fctltfsDtmumpnt4aee ioeiadlsDeanmp t4 eermf iydoatr neils)trtr(o3oo4omtnlicsa() rrm( p;t4oet mi3ild sDel( p (4aexrxrctadfpD anei;s) 2umim oodame mnet t  rumu  oo0oexnmociyslmDum(vp;t0teerxf ootlmD  uvo;t  exr(opoy1ll  lncils)s2urx pot1aetomfetytfs2emnmsnt0tlxrif oydfptr n i s s2toxm oo4om n icilsf 2taur ;t0oleniociasls ra(ms;(0alxnmf3ia1lpte i olt) exoio nu4oltnlncs (f Dtru  no0aetnmoctad m2rmu o (0tltnio3oo1la   uei s) etrxo3nu1lpt mfvsls) 2tm(rpnt0tpe moctyt a2eaump u0 ltoiocoy1fmtraivs;t)tetrio iy1apte ieiat)s2raum nt4texnifciltfmDrlnms u4aeerxfcta1fp rln i (0s2to(mpiy4amt micsl(f Durxm nt1opt ii3iytfs um(vont0 etnmr ia1opDrau ols t2toir iodapen nctasfsrrmxm ;o4ole  fciytfa ra(vs;()alxomo oy1oateln o;s srxrxo3iy1amtnlnvslt)s2trxrooo4apen f3iyd m2um( snu4arxnmfctydlmDeai ol(0trxm(mpnydame mnvta(f Dua( poo4apxnmicias m2ranms;(0arxoxr3tytoptrlieo s texmimpoy4am e icilt a2umxr ;o4tpxomiciyd a2rm(vo u)texrxf oadfatelnvo;t) etrim3nodapenmfei ()srua(m oo1olxniicildfm eaumo;() exoxo3tadop e ues;t0 exm(m nu1om nlnvt (  Drm(m ;t0tetomfeiys sDean on()arxoxrctydfa eln i ()teum(m oo1om n feiasf Drmxmpnt0alxn feiltlsDul( s u)tlxriocta1lp r ueo t teurxopiy1altnlnviat) rtau  oo1tlt moeiatfsDra(mo t4arermo3io1lpteaueils)t2toxrpiy1op nlfctlsfarrmurp;u4tlxoif3iysfs uanvpn()tlenxocoy1oa eln i;t)teumio3iu4op  lictat)arta(r nt4tptnmf3iadls rau o;u4arenxrcoadoa r uvilt sexo(r3ou4aptnmfcsat sDurxm ou1tptnii3iad a2ea(vp (0trxomf oy1opte n i;(  2xmxopio1openmietls)sDtaumpou0apxoifeiltfm2rl(monu)aeeoxf iotfpt aneslt)srtrxo3oo4omt  ivta() 2rrx oou4tpxn i3tys s2rm(msnt4aeeoxociotomtrauvilt s2xoxm nydapt licta()s2rmuro;o1opeo ieiaslm2umu p;(4 lermfcty1oa r u o;t0truoim3oodomen ivtlt  rumxrp;o4aee  ocilsla2umnvon(0tetrmo3oodopte ueolt)texoim3ny4llt mfvsatfa2raurooo0teeomfciasfaDrl(vp;u0tltrmrcta1lm raivs (  2urir ou4om  mnvi t  Dra(mont0tlenio3iyt m2uanmo (4tetomrcoo1fp  auvs;t  2xrxm3iudom   fctlt) 2trumonu4apxn o3ias m2rm(mp u0 eeoxf iytopDrliei;t0s2xmim io1lmtelfesatf ruax ono0tptn o3iysfs2ua( s t0 lxnmfctydfpt  ues;t)t2umim iy1am eliet t)a2ur( ooo0olt mietas m2um(vo u) ltnxo3oy1oa rauvsl(0trxmir iy1ol emictlsfa2rrum nt0open feiatls ran ont4trtomf3ty1fmD  nvslt0sruoim3nu1llenliei ( arrru pou1aexoii3tys sDrauvs u) reoir totlmteanes;(  2umir iu4ameemnct ()sDrax poo0olxn o3tlslmDelnvont4alxrir3oodlmD  uesls) rtmxo3no4llee icta(  rurxr nt4tee iictys mDrln o;t0 eeomo iadlat ai o;( s2uoimpiu4lmt lictat)artaxr ou1oleoifciys a2uln p u0 eerif3iotfpDrlues;s0 2trxo iy4alt mfctl(fa2tmumpou4oleo icild s rl(vp;(0 etoxf tytfm  li o t s2urir3ny4op n iesas) 2tr(mo;o1aee ii3iadfaDemuvonu4 rermocoa1omtr i o ()s2xoio ny4al emfetat)sDuaum ;o4oee  fciat s2uln s;t4aexrmf oatopDeanes (0s2to(r nudlpt  ict t) 2raumo;t1altoif3iadla2rmnmsn()aexomo to1oaDeaivs;s s2urir oodlmenlnei sfsrtruro;o1aetn o3iydlmDrm(vp;(4tleriocia1lm ean i (0seuoio iodll e ici tf Dtau pnu4teto fetatls rauvonu4 ltnmrciotfa  au o;s0srurxr3oy1lm  mncslt)aDuru  ;o1apxo oetltfaDumnmp;t) etoifcoy1optr uvil()trxrxr3nu4om   fvt t) 2rau p;t0tex  i3tatfmDrmuvont)arenif to1opDean i;(0 exm(o3ou1lm  mfeiat s2rmx  ;u4aeeoiociyd aDuln on()areoir oadopDeauei;s  2urio3ou1lme miet ( a2tr( pot4apt  f3tytla rlu s;t) reoif oodfa  anvs;(0trumxmpio4ole lfvtls)aDtrxr ot0texomocils m2ulump;u4artnioctodoaDe uvi t0 etoim io1lle mnvslt artrx o;o0aexn ieiytfm2ea(vp (0aetomrctytoptraieil() rtm(m oudope mfvias)aDrr(rpnu4tpxomfcilsla2rmnms;() lenmo tydoaDran ilt0s2xr(m ny1ll emfcils)a2trxmpnu0tpe  fctltfm eauvs t0tlerxr ootfatranei;s0 rtoir3oydlleemfetatf Dtrx  oo4texnmf3tydla umnvon(0 rxrmf iydomtraivi;s0t2uo(r3oudopee fcsas a2rmxm ou0tlt  o3iyd m2el(mo u0 ltnxocto1fmDeaieilt0 exrio ny1omtemics (f 2tmum ;o0aeeo f3iat a ra(mp;t) ltrir totoa ran olt0trumiopoo1ol emnes t srrax  nt0oet  o3tltls rmn p u) reoif todfatrluvo;( seuo(o3ny4optnmnciltf Duaurooo1apen ieiatfa umnvs (0tlxrmo3tytoptelnes;t t2xm(mpiy1ll n fetltf 2uaxrpou0tlenmfeild mDuaumonu)artoio3iadfa rlieo;t)s2trio3iudlmenmivi s arur(rp;u4apeomocils s2ulu s;t4 lerxo oy1fpD lneo;s)trumio3ny4olt lieta(  2rrxront0altnmfcilsfa2rauvs u4trtoif iydfmtran s s)s2umxrpiodopee feslsf Dtm(mpnu4teeoiociltlsDem(mp;u)altrxrcoa1lptr uesls)texoxo iy1ole mfvt (f 2tr(rp;o4ape io3tlsls2eau ont0trtrirciatlmDrln o;s) ruo(opny1am nmneiat)srtr( p;t4oexnii3tydlmDumumpnu4alenxo3io1fm rlu ils)setmim3no4ap emfcilsfaDuauront1tetnmieiltfs um( o t)teeomo3to1omDr nvo (0trxm(rpnydole  icsatfsDurxmonu4tetomociys a ranvsn(4arxnmfctydlmDraieil(0s2urim oydaptelnci s)srtruronu0ape moeiys sDran p t0 rtnmrciadlate nei s) 2uo(r no4aleelneias a2trxrooo0olx  i3iysfm rlnmo t)trxoxr3iodfmDeln olt)texm(r3nydlpeemfet tf 2rmum nt0oltn feiadfm2rm( o;u4 reomo iydfmDeluei;s)srumiopou4oltnlnei s) 2rauront1ape mfeild a2rmu s (4 exoif ia1lp   ieo;s0t2ur(r oo1op emfctltfs2ta(rooo1oexniietydfaDrauvp t) rxrmfcta1lpDelneo ()t2urxo no1lm e fciat  Dtru  ;o4texomfeiltfs2rlnvpnt) lxrmo3io1lp rlivi;() rxr(m3no1omt  fvt t)srra(  ;o1tpxnmociys s eluvo ()artrmrciodlpD lnei t)t2tmxopoy4lmenmiviat aDrr(mpoo4opxnifcias sDuau onu0aetnircia1opDrauvs ( srxr(o3io1lltn nvils arrmu oou4opxo fctld s emn pnu0aetnmrcia1fate i o;() exr(mpoo1ome  neslt) 2rmxrpoo4olt ioetasla2uluvp u)teerxrcoo1fmtr uvolt  exrir3nu1lptnmiesatf rrmu pot0teto octltfs2rmuvon()trxnmr iatfmD lu ols texoxm no1amt  fctl(f 2tmxr ;u1olenmoctyt m2ua(vsnu) reoif3oa1lpDeai ols)t2toxo3iydom nmfes t s2rmxroot1aetoif3iadla2umnvs;t) exomrctatfmDean o;(0 etm(m3oo1op emfvt ( sDrrxmoou4aptomoctat s2eanmpn(4trerxf3ty1op raivs;(  etoxo3ny1op emieil(fsDuaxrp;t1tpeomociyt aDua( o;(0 rtoiocto1lmte ueolt srtrxopiodolenmncs s)s2ta(m no4oexnmoeiad aDemnmp u) lenmr3tadfm r ies s trtoxmpoo1olenlivtlsf Dur(mo;u4apto i3tltls ul(msnu4altomr oydoptr ies s)t2to(m3nu1altn ncil(f Drmx ooo0opeoii3iyt m2ul(vsnu)texrmr3ootlp eanvi t s2xo(r3oudap   iet t  rtau p;u0tltniictltfm2ra( pnu)alerxrciodlmte ivi;(  rxrir3iodol nmneslt  rtrxmpou0apt mietysfs2ua( s ()tetrxrctadomt  uvo (0trxm(o3oy4ape livs t) Dtrur ou1apxniocildfaDulums;u)teerxocoadlmt anvi;s)srxrir3no4amtnliet ()arrr(m ot1alen ieiadfs2emnmont) rxrif3oo1fm  lnvols0sexr(m oo1op nlici () 2tmxmpno4alxnmieiad m2ea(mo u)texomfcoy1fatr uvi;s)srxm(opoy4oltnmfcs s arrrxmono4oetnmfciydlm2ulnmpn(4 etoifcia1lm  lnvi;() rtoirpiydopenlnet s)aDum(rp;o1tpe miciydfsDem(mp;()trxoir oy1fa e nvil(0trxmir3no1opt lieiat  Durump;u0apt mieiyt m2rm( o;(4aexrxo iydomte ieo;t) 2uo(m oydlp elicilsfsDrmurpnu0aex mo3iasfsDelnmp t4texnxr ia1latr i ilt  rxoxmpny4oltn icilt srua(  ;o1tpxnmfeias s2ran p (0trxoxr iatla   n sl(0 rtoxr no4lmt  ncils)srtrxr nu1ole iociat m2el(msnt)arxnxrciatoate ivo s) 2uoio iy4alen fes (  2rrumont4tet mfctlsfaDrln o;t0arxoif ia1fmD lnei;t0texm(m3nydamtn nvt sfaDuru o;t1texn fetytfmDemumo;u0trxnmf3oodom e uvs s)s2umxo oudlltn ieilt) 2tau  nt4olxniociysfs ulnms t4texnif3iotfpDrlies;s0teur(m iudlptnliesltf 2rm(rooo1aetnmoctlslaDrmums t4trtrmrcoo1lm r neo t0seurxopnydop nlfetlt sDtru  ot1oeeo fetyt mDrlnmsnt0artnxr io1lpte neilt0 2xmxm oydolt  fci s)a2umur no0apeomi3ilt m2emu p u0tlxrxf3to1lpD ai ol(0t2urxm nydop nmicta()aDtrxm ou1opx iiciatlm ranvpnu0artnifctadla eliei;( s2tm(r3iu1ll  mietls)sDrm(m ;u1opeoii3iatla rauvont0tltrmociy1faDe nvo ()t2ur(o3nu1am e nvt ()a2ur(r ;t4tetn oeiytfm ua( s t0tlermrctydom raneo;t0seum(o3oudome  nvil() rtr( poo4tptoii3iys s ulu snt4 leomr3iatopDranei t0 rumiopno1lme lfet ( a2tau onu4alt  o3tyslsDum( s;u0artnif oa1lp e neols)seurimpnydaleemneia(fsDrmxr ;o4tpeoifcilsfs2uanmpnu0alxomr3oadlatr ivil(0trtr(o3iu4lp n ncs ()s2ua(mont1tet  i3iyslm ea(von(4 renmrcto1om e nvs;() rxo(mpiu1llt lnct sfaDurx  no4opxoioetadlm2rlnvo;() exrmr3io1om r nei s) exoxrpiudapt lfesasfsDtmumo;o0olto fctytfsDem(vsn()trtomrctodlmDeln i t trtoxm io4lpte fet () 2urxrpot4tleoif3ilsfa uanvo;(0aetoir3oadla r ivi;(0 2tmxr3iydlm nmnciat  rtrxr ;u1texnmocilsfa uauvs t4artrmrciy1fmtrluvil() eumxm3iu1op n nvsa()aDtmxronu4aeen f3iltla ua(ms;t0aexrif3iotop ranvslt0 rtmir nu4llenmnvtas)artmxmooo1olxn o3tysfs2el(mpnt4aexnmo3tadomDr u i s) rxmimpno1lmtemicsl( sDum(mont0olt moeiasfa rauvsnu0trxrxf3todlmtelueols0tetmir io1ll nlfcta() Durum no4tlto ocildfs2rmnmp;(0tlxoiocoadoaDraueo;s  ruo(o iudop nmfcilt a2um( poo1oetomo3tytlm2eanmont) ltnifctadoa eanei;s0s2ur(r3iydape mfetatfs2tmxr nu0tpxn oeilt m uluvp ()arerxr oy1lp rlnes;() 2uo(o3oo1omt mnetasfa2tm( o;t0opxnmfeiytls rlnvp;()aexoxo tatlmDeluvslt trtmirpoo1ole  net (f 2rrxmoou4tlt  ietad s rln ont4 ltomr oodomtrlivo t)t2xm(mpiy1ome  nvtls  rrmu pot1tlx  o3tad m2ulnmonu)tetnmrctytlmDeaieo (0setoxo iodop n nesasfaDua( p;u1tetoifetls aDrauvsnu)tetnmo3ta1omD lneolt) rurim3ny4alt lfcsls  Dumuro;u1aleoiieiatfs2rauvsnt) exoir3ootla rlnei t t2toxr ny1al  mfct sfs2uaxroou4tpto oeiltls2rluvp;t)alxoxr3iatom rln slt0 rum(m3no1optnmnctl() rrau  ;o0tpenioeiad a rmnmo;(0alermfcoodfpD  u slt)srxmio3nodlpeelnei t)artau pot4tptn i3iasfsDumnms u) rerxo ia1fmteluei;t truoim3oudoltnlnvias)aDumumo;o0oex moeiydlmDranms t)alenmrcto1oat  neo;s setoxmpoydlmt  feia(  2tm( o;u1tlto oetyd sDrlnmp;t4treoio3iy1op  li i s0t2trxrpiu4om n ivta(f 2ta( ono0openif3iatfs2um(ms ()alxoxr3iotfmtran o;t  rtoxrpiudamtemnes (f Dum( pot4optnmfetatfa2ran o;t4tltnxo3iadlmt ln ilt  rtmio3io1optemivs t artr( p;o0alenif3tysfmDrl(vp (0trxrxoctotlpDrlieo;()teumxr3ny1ll e fvs t s2um(m nu1opxomfciydla umn p t4alxoxfcty1om  luvs t s2xo(opou1lmtn ivsls) Dtmumo;u0opxnmfeiltfm2ra( s t4 exnxr oy1fpD au s;s  2uo(opou4lmtnmnvsas) Dua(rpou1tpt mfetyslmDum(vp;(0aexnir oy1lp eln s t t2xo(mpoo4amtnmnvtls srrmu onu1aeeo f3iad m2emnvp u0trermr iytoa ran sls  exmxr iy1lm elfvtas)sDta(ro;t1aleniociysls2eanvsnt0aetnxfcoodom eluvil() 2urir3oy4opt miviat sDrru oot1alenii3iysfmDel(vp;t0 lxnxfcia1omt  ieo t0srtrir iu4al elnci ( sDtmu ono0oetoiociadfm ua(mp;u)areoxo3todop   nvsl() etr(opoydaltn nes s  Dumuro;u4aex  ieiatla2emumo;t)tltnmf iydfmD an i ()t2xrir3no4ale lfvs ( srtrump;t1aexo o3iysfm2ea(vp (0alxoxr3ia1lmtrlues s)srum(opiudaltnlicsl( sDrm( o;o1tpe mfetyd sDrl( o t0 ltrir tydfptelieol(0tetmirpio1optnlicsls a2ra( p;u1tlx  fciatfm2rlu o u4aetoioctotomteln i;s) 2xr(rpnodal nmicilsfartrurooo4aeeoii3iatfm2rl(vo t0 lerioctadoptelnvils setr(opiydam nmnvsat aDra(mo;t0alen fciatla emums;t)trtrxo iatlptr u o t0srurxo no4olen ivil( sDrau  nt0ape moeiltlsDrau on(0 lenir iydlmteli ils0s2uo(opny4olt  fct s) 2urum ou1aeeomoctadfa2eauvpnt4 eenio oa1lpD  uei;t0s2xoiopou4ll nlietat  rua( pno1tlxo feiyt m umumo t0trtomf3iy1laDeaivil( t2xmim ou1lpte ivsa()sDumxrp;t4aex  f3tad aDeluvpnt0tleomfcia1fp rau o s0t2xrxo3nydlp e fcs tfa2rmuront0ole mietatlm eanmpn(4teenmf oa1fpte nvo t)sexo(mpnodlmt lfctl(fsrtax onu4ale moctyslsDuaumo (0 lerxo iy1faD  nes t teuoim iydal e ncia( aDurx  ;u0teeoiietadls eaumo;t0 ltoif3oytfa rluvil(0 euoirpoo1amee ietl(fa2ra(mont0apeo f3ilt a rau o (4 exnir3tadlmD ai olt) 2trxrpiy1om elfvt s a2ra(  ou1tee  i3iysls2el(mp t4 lxoir3iadom   i o ( truo(o3oydll e ivilt s2umxmp;u4oeeoio3iytfs elums t)aeeomf oa1lmDeln s;()t2xoxmpno1optnlfvs s  2rr( pot1tet mf3iyd mDumnmo (4tetrmf iadopDeau o t) euoxm no4am nlfes (farua(rp;t4oet mfetytls emnvo t)arxnmrctotfat luvsl() rtm(m3io1aptn fvsls) rtmurpot4tlt mietlsfs2elnms t4aetrxociytomDeli sl(0 2to(mpno1om emfes (fa2taxr ;o1aee  ieildla2eanvp;(0arxnxo oa1fateauvolt0t2umim3nodam nmneilt  Drau oot0aptomfcilt mDelnvs;t)alxoxf to1oat  nei t0srxmxo oy4amtnmnvi s) rumum ;u0olxo feils aDrau pnt4aexrircio1omDrli sl(  2umio iudom elivsat) 2raxmoou0tltnmoeiyt sDum( p () etomr3oo1fp rlu o ( trtm(o3oodap  lfciasfsDtmuro;t1oetoifciytlm ranvp u4 etoxo oadlm eau s t)s2tmxr3oy1ole livilt)arurum no1tpeo ociatfm ea( pnu4trxnmfctotfaDrlu sls0 rxo(r3nu1llt mivs t)srtauroou1tleoioeiad s2ulu on()aexoifcta1fpteln s t)srxrio3oy1lmenmfct sf 2rauront0tpx moctltfs umnvont)alermocia1fpte ueols0 etm(o3nu1omt livi s aDuau o;o1ole ii3tldfaDumn o;u0teeoif3oy1fmtr ueol( srxm(m3nu4lle mncsa(fa2rrxm ;u4ape  ietydfm eauvs t0 exrmo iatomtraueo;s t2trir oydomtelnet (  2taum ;o4oexomieildla ulu pn()aleoir iy1omtr i o (0t2uoiopoy4apte ivsl(  2tr(mo;u4aetoio3tldfa eln onu4trtnxoctydlmteauvo (0srtmio io4lpenlivt ()aDtm(moou1aetoioctydfm2uln onu)tltoxr ootlmDelueol() euoirpiydlme livt (  Dtmur no0olenif3tltls2rm(vp;t0aetnio oo1fp eluvs s0 rxo(m3iydope lneilsfaruaxmp;t1oet mf3tad aDrauvsn(0 etnxo io1fpteluvi;s) rxr(r3iydlm e nciatfsDum(m ;o4tpto ociytla rln o;(0tlenmrcta1omtrliei;()t2tmxopiydaptelnes ()a2tmur ;t1tptnioeiatlaDea(monu) etrmf3oo1fmDrauvs;( seumio3iu4llee fet (f Dtmur ou4openio3tatla eau p;t0trenmr totfa rln o t  rxoxo ou4opt miet s)arumumo;o0olen i3iydlm2uauvo;u0trxoxf oo1optrlueslt)t2umim3oydoltelnvtatfa2umx onu1oetn feiasfmDrmn pnt4 eeoxr ta1omte uvo s0srtm(o ny1alen fcils) rrmxro;u1olt  f3tlsfm2rmnvs;t4tltrmr oodfpte uei s0s2xo(o oy1ole lnvi ( a2rrxrp;t0aptnmfctysfmDemnmo u4 ltnmf oydfpDrlnes s tetr(rpiy4amtn nvsls aDraxm ;t1tet mi3iysfaDranvsn(0altoio iatoa  auvi;s)t2umxrpio1amte nes (  2uru oou0tpeomf3iltfmDua(mo;t)aeerxf3iydlmD  nes t)t2xrxm ou4lltelfvsltfsDuau  ;u0tetn o3iltfm ulnmo;t)trxnxrcia1faDrlneo t setmxrpoy1lmte ieiltfs2ua(ronu1alxnmietadls2emn on(0trtomocoatomtean o ()trxmirpoydlpeemfcil(  Dra(monu1open o3tytfsDul(mp (4 leoio3oytoptr nes;(0trur(r3ny4op nmfes sfs2urx  nt1optoifcilt a2ulnvsnt4 ltrio tadlp  aieilt0tetr(rpio4altelics t)s2tr(r ot4aeenio3iydlm ea( s;t4tlenmfciydfp eaiesl(0 2urxr iydlp n fctl(f rtrx  ou4tptn ieiatfs rl( o u0artoif ta1lp elueo;s  2xmxmpno4ap   ivtas  2rm( onu0tet iociatlaDua(vpnt0 rerxo tadfmDran ilt0 eurxmpiy1lpen nesat srtm( o;o0texniieiltfs eanvpn() lenmrciotfm r iei;s)srxmir iydlmtnmfet ( srrrxroot0tptnifetatls eauvsnt4 etnmf3iy1fmD aivsl(0tetoio ny4lpee nvtls a2raumoot4alto ieiysla el( s (4artoxfciotfmtrlu i;s  2umxmpny4lp nmfes s s2ra(rpoo0aleomf3iysla eluvs;()alxnir3iadomDeli i s  2trimpnudomtnmietl()s2uau pot4olt io3iadfaDulnvo t)tltrmo iy1fat aieo ()trxrirpoodlm n fei s sDumxmpoo0aexnmfeiydlmDum(msnu) ltoioctodoptraneils  rtoxr3nydam nlict t)arrru pnt4alxn ocilt mDel(mo (0trtrmrcoodfptrlieo t)setr(m ou1amt mfvslt) 2tau o;u1texoiociasfaDrm(vsn(4tltnxfcoydomteanvs s  2umim io4ll  mfvsa( aDra( onu0tpe mi3tatfsDrln p (0trtoif3ta1fmD anvs;()srtmir3nydamen fcs ()sDuru p;t4olenmo3iadlmDeluvsn()alxnif3ty1lmD an ol()srurxm3oydoltn ivs ( aDurxro;o0aexomoeilsfsDumums;t)altrio3tadlptraivils0s2xrirpnu1omee ivi (  Dtaxr nu1tetnmf3iltfa ra(vs;t0tlerir oodoaDrau o s texo(m3nudalte netls) Dtm( ont1aptnmfetyslsDelnmo ()arermociy1oa   ivs;t  exoxo no1oleemfviat) Drmxm ;t1tpe moeiyd mDraumsnu0aexrxo io1lp eluei;t)seuoio oudllee net t)a2ururo;u4ole  ieiyd sDuauvo;()artoxf3oy1fp elu i;s0t2toxopiydalt  ictas arum(m ;u1opx  icilsla2ulnmp (0aeenifctadoptr neo s0sexoxr oo1lleelivil( a2ta(ro;o1tlt ifeildls2emumsnt4areoxr3oo1fmD anei;(0 eum(mpnodole mici s  2tax p;o1tlt mi3iydfa umnmsnt4alxrmo3ta1fm   nes;s) rumxmpoudlmee fvias a2taxr oo0oexomfciytfa rmuvo t4arenxf iydfat lnvs;t texrir3nodameemneia(  2truro;t4tle ioeiasfs2ul(ms t0alxnxr totlp e ivo ()seuo(o3nu1lpt licil()a2umx ono0tlx ioeild sDemnvo (0tlxoio3oatlmtrlivols0sexr(m3iudlptemici sf 2ta(m oo1oetn ieiyd s2rm(vpn()artoir3iodlmD ln i t)setmxo3nodllte fctat s2tmxm no4tltomoctlt mDulu snt)trxrxo3iytfp rauvs;s0 rurxo3oo4apt livt (f 2ur(  ;o1tlto fctltls2eanmsnt4alerxf tadoa  luvols s2tm(o3no1lp n fvtas a2ur(m ;u1olx  ietydfm2eanmsn(4 rtoif to1laD lu o;t sruoim3iydome mfesa(f 2rr( poo1ope  feiysls2uaumo;u0trxrif3ootlpt  uvil()trtr(r ou1omtemnvt tfaDrrxmp;o0olx iieiltfaDrm(vs t)texnxr ootoa   iei;s)srtrio3oy1lm n feil(  Dtrxr ;u1tltnii3tldfs2ea( p;t)aetrmrcoadoa e neils teurir oodlpenmnvtasfs2tmxmono4olx mf3ilsls2emumon()tetnmf tydlpt au s (0s2ur(m3oydol nlnctls s2tru onu0tet mociytlsDra( s (0aleomrctodopDelu il()trxrimpoy4ome  neslsf Dtaur ;t0aet  ocias a ea(ms (0altnir3oytla e u s (  etmxr3iydolen fei t)s2urx oou0tlx mocilsfs2elnmon(0tlxnmf oydomt aueo;(0seur(mpoo1ol  lfei s aDumxmp;u1alx  ieiltls2ulnmpnt0tltoir3oatlmDrai s s trxrir nydalte fvsas) rurxrp;o1opxn ocildlsDrmuvpnu4tleomfcoo1oaDelueilt0s2xo(m3oodlmt mnet () 2rru  ;t4tpxnif3tytfsDelnvs;t0alxomo3to1lmt an s;s0 etm(m nudop nmfctas)aDrr(mpoo4oltomi3ilt sDuaumo t4alxomo iytfptraneslt)trurir oy4ol  lneil(f Dtaxm nu4aptoii3ilt a uln s;(0arxrxo iytlmDe u i;t) 2uoimpio1lmtnmneiltfaDra(  ;t4olt  oeiadla2emumo t0tlenif iadop eaivsls0 exrimpoo4ll   nvta(fa2uaurp;u1alt mo3tad s rm(mpn()tltoifcty1omDrauei t)s2xoxopnydop nlfcia()s2ta(mo;o0oetoioeiydfs el(monu)trxomo io1fa eliei ( truoxr oy1al nlfcs (fs2tmumont4olx moeiad sDelnvo t) etrmrciotfpt auei t0teumio3nydamtelfcs (f 2tmx  ;t4aleo f3tyt mDul( s;u4aexnmo oadopDr nvsls) 2xm(opiy4amee nvtls) 2urx ono0aex mfciaslaDuau o t0 exrxr3iadfpDe i o (  2ur(m3iodllen net tf 2ua(r nt0opxoio3ilt a2ranvo;t0tetnxf3ty1lp eauvs;(0 rxmxo io4opte fetl( sDum(  ;o1apxomicilt m ra(vsnu4alxoxo3tytfat ln o;()tetrir iu1lp   feias)aDrr(root4alxoiociyt mDuaump ()aetrxrcoatfaD lnvo;s0sexo(opoydop elfcsls)a2rrxrono1olx moeiasls uanmo u0 rxnirctatfaDraiei t0srum(r3oydll nmivt t  Dtmu p;u4tpxoifetysfm ra( o;t0trxoiocoadlm  lnvols0t2xr(mpoy4al e feil(fa2rau  oo4opxnii3ils mDeauvs (0arxoir3tytopt lues;s)srumxo ou4lmt  ies tfsDuaur nt1aleoio3iytfs2elumo (0trtnxo3oo1fpt aivs ( t2xm(m iu4ale  nei t  rrrxr nu1oetomf3iyd mDuanvont4aetrmr3iadlp rauvi;(0srxr(mpnu4lpe  neiasfsrtm(m ;t0apenmf3iys s2ea(vsnu)trxnir ta1lp rln o;t)s2tmir nodamte nvsa()srtm(mo;o4ape moetlsfsDeaump (4trenmrcio1om elivi ( trtoxo3ou4aleemfvi s) 2tr(mpno0aee moetad mDeaump;t4trxomociatoaD  u i s srum(m io1am  mncia()sruru ont4tpt  oeildfs el(mo t0 eeoioctadopte n o;( srtr(mpiy1ape mivta(f 2tmx ont1oeen f3ildfs ulums;(0texnmfcootfm e nes ( sexrim iydomtnmici t sDtr(  ;t4tlxn o3iltfa rlnvonu0 exnxr iytlp  lu ilt)s2xmimpoo1ope mnvt t s2raxrp;t4opxniietydfaDelu p;t4 lxnircoa1lm raieslt)trxr(rpiu1opt lfviasfsDur(r nu4tpto i3tldfm2ra( sn()teeoir3tydlpt au o;t) 2xoxr no4amenmnetl()s2rr(mpot4tleniociadfsDul(vs;t0arenxoctotfpDe ivolt)truoxo3ou1lpe lnvsas s2rr( o;o1tlxo i3tlt s2umumpnt4 ltnxo3oa1op eln o;t0 2tmimpno4ome mncilt) rtmxmo;o0tlt  iciyt a ra( p;t4 lxnxf iadoatelieilt)s2trxopiy1ol emici () Duaurp;u1olxn oeiatls2rlnvp t0trenxr oo1fmD an ils) rurxr iy1lmtemnvsltfa2rmur nu0oexnmo3iytlmDea( o t4aleoir3iy1om   uvo;s srxo(m iy1alt mfvia()aDra(r ot4oee  i3iasfsDrluvp ()areomfcta1fmDr i i s)s2urxrpnudopteliet tfaDraxro;o1tltnif3iytfa rlumpnt0texomr oo1fp elivs t truo(o oy1ole mfvtlt  rrmump;t0teeniieildlm rluvo t4 rtoir3oadom  lies;t s2to(m iu4llt lnet tf rrru p;o1alenmociasfs2eln s u4 exnmr ta1om   nvs t)s2xriopoudop  mivs t) 2taxronu4ape mfctldls rmn s;(4trerif3ty1fatrauei;t0texmxopnydlp emfvia()sDtm(  nt0tet moetatlaDrl(vo t)aleomf oa1lmt  iesls srurir3oodopeemfeias  Dta(ronu4tpx  oeiasfm emn p t)aetoxf3oydfat  nes s0 2ur(r iu1amt mfvs t  Dtaxmono1tex ii3tysfaDraums;u)artomo iodop e uei;s) rxo(mpno1lmeelfes t)sDur(mo;o1apxniieias m2umnmpnu)altrxo oodlmt ai i t0trtrimpoydapte nvta( sDtmxm ot1tptomoctytlsDeln p t)tlxnxf oy1oat  ivo;s)texmimpio1lpeelivil( aDrm(m ou4open ociyt m2ul( pnt0aetnmf ia1fm  ai s s)trumirpno4alte fvsat)s2uax p;o1opx  feiytlaDeau snt4areomoctodlp   ueo ()trumxopiu4amt mnvt () Dtmurp;t4open oeiatfm emums;u0aeenioctadfa   n i s)s2tmio ny1al elneiat srta(ront4tee ioeias a rmuvo u4aeerir3totfmtraiesls0 etoxopnudapee fvilt s2umx oou0tlt  feilt a2ua( pnt0teeoio tytopDrli sl(0seurimpiy4lmeeliei t)sruru poo1opxo o3iltlaDrau on()texnio3to1latrauvi (0 2tmiopiodll  lncsl()aruau pno0oee  fctlsfsDrmnvpn(0 rtnmr oy1fmDrluei () rxmir oy4alt  nvta(fs2tr(root0optn oeildla emnms (0tlxoio tadlmDelnvo t0 2trxopiodalee fvsa( artaxmpoo4opxomfciat sDraump;(4areniociadfatelivo;t0 rxmxm3iodamtnmiei t  Drm(moou0opx ifeiytfa ul(vo ()areoir iatfa r n i () etoxo3iu1amtnmfvi ()s2umu o;t1texoifeiys a emuvp t) etoxr3oatomt  uvi t0t2xm(r nudam e fcs t arta( ont1oetoio3ias s2eauvsnu) rtrmo iotoa eln i s)t2umxo iy1lpenlfvil() rtr(  no4opx ifetasls2rluvo;(0 exomr oodop r i i;(0texm(o iy1oltelfvi s aDrmxmooo0oeen oeils mDum( o t0 rerxf3iadfa rlu s;t0sexoirpoydoptelietas a2rmxroot0olxoifeiadfs2uanms;()aetomr3io1lm   nes;(0srxr(mpoo1lpe  fvs t srra(rooo0opt  ietldfa uau pn()arxnif iotfaDran s;s) exoxmpiudamt  fvt (f 2tau  ou1opxo ieiydls2emums u)tlenxf io1oatelues;t srtrxo3iudlltnmfcsls)sDra(monu4apto o3iyt mDelnms;t)trxnxo3ty1lateanvils) 2toxmpiudlpe lnetat a2uaxmpnu0apx miciytfs2raump t4 lxoxo3iadopDr ivil()trum(o io4opt  nei () Dtrx poo0tlt mfetytfaDul(vo;t4aetnmrciotlmtrlivilt0s2uo(o iu1lptnmiet ( s2tmurp;u4tltoif3tls a2eanmo t)teerxr3ta1oaDraivo t)s2tr(o no1open nvt s sDtrxm oo0ale  f3ias a ulnms (0texnif ia1oaDrlnvs;s)teurxrpoo4lp e ivil()s2umxmpno0tptoio3tyd m emu pnt) eeoifciodlpDeaies;s s2trxrpiydlltnmnvtlt)aDtm(mp;t4apt  ieildfa ua(vs () rtrxr oodoa e ieilt trtm(opio1lmt lnct ( arra(mo;t1oex moeiatfaDrlnmp;t)aeeoif totoaDraues;t0 etoio3ny1ape mict sf 2urxr ot1tlxnmi3tat aDemuvo;t4artnir3oo1lpD  uei;s srumir ou4olt  ict ()arta( o;t0tpx  o3ilt s ra(mp;u4 renmfcoodlpt li s t0srxm(m3oy4amte neils  rurxr nt1ope ifeiat aDrmnvpn()alxomociytopDr neolt)t2to(o3iodlmen fetlt)aruaum nt1oeen ociytlm2ul(vpnt0artnxfctytop  aues s0setoio iydlleemieils) Durxmo;t4tpeo i3iys s2rlnvpnt4 eerxfcty1faD auvo;(0t2toxo3io4om elietatf 2urxrpnt0alx  iciat a2el( p t0areoio totfaD lieil() 2toim ny1omte ivi sfartrurp;u0ape ioeiys m2uanvp u)altomf ootfm eai s;s) 2umir3iy1ll e ictlsf rumx oot4alxnmf3tad m2eluvo;(4aleoxo iatfpD  ues;s0s2umirpoy4alenmietlt s2ra(m nt4tet  o3ildfsDeaums ()tltomfciadop   nvi s trumxopou1ll nmneilt) rtr(  ;t1oleoiiciad sDem( p (4 ltoxr3oo1omtraieil(  2xrxr iodamtnlnvslsfaDrm(m ;u4openmoetadfsDrl( snt) rxrmf3oytoaD liei t texrxmpou1lm elietl()aDtaum nt0oltn i3iysfmDrlu ont4 lxoxf to1laDeaiei s)sruoimpiydameelnet () 2taxrooo1tee  fciydlaDranvonu)trtnio3tatopt  i o (0s2xr(rpoydopt lfetat)arur(mp;o4opxn oetat mDrm(vpnt0aexniocoytoa   nei;( t2toiopiudlpeelfctltfa2rrxmpno0apenmoetad sDeln pnu)tlxrxo oy1la raueils0 eurxo iu1omtemnci ()arumxr no1tlxomfeiadfmDrmnvont) rxrmr3iadfpDr ieols sexo(mpio1lm emnvi sfaDumu ont1oltn f3iltla2umn s;t0aexoifciotfaDraivils0sexoir nodlpeemfvt (  Dra(rp;o1texn iciysfs2uluvo t)tetrxo3oy1om  ai i;( teumxr3oo1opte feslt s2tru pno0apeo feildls2umnmo;()aetnmo tydfaDeliei;()s2urxo oo1al nmiesat) Durxro;u0alx if3iyslm2raumon()aetrmr tadlmteluvils truo(o ou1lp e icia(f 2rr(mono0apto ieiatlm el(mo;u0aeeniocoy1laDr neo s) exm(opoy1om e ictat  2umumpot4tpx ifciltfs2ea( s u4trxnircoo1fateanes;t0s2urim3oudale  neta(f rtru ooo4texo ietlt m elump;(4areoxf3totlmDeai i;(0s2urimpoydllt mfcslt) Dtaumpou0texoiiciytfs rmn o t) rxnxocoytopt lnei;s tetoxopiy1lpt mneiat arum( o;o4aee ioeiytla umuvsnu) etnio to1laDe i olt)t2xmxo iu4opt  iet t)arumxm ot0olxomoetls s rlnms t)trtoxf3iytlpDe u o;t s2xrir3oy1ol  lnetls)aDra(monu0tpeomoctadfm2rmuvo;u0 exomo ty1omD  ivi;s0sexmxrpoo4lmtnmicsat)s2trxr ou4teto oeiytfa2ran pnu4 renir3iatomteaivils)teurxopiu4lmenmictl() Dtr( pot4apxn i3tysfa rln o;t4arxoir oa1op e ieo;s) 2xr(r3iu1aleelnesas) 2ua(mooo1tpxomo3tasls2ra( o u4 reomo3oo1fatr ieils) eum(rpoo4apenmfcias aDtm(rooo4aee mfciydlmDemnms () lxrmrciadfaD  ies;( truoxo nu4omt  net s aDum(  ;o4oee moctat sDul( o;(4 rtrmf3todlmDr i i;t teuoxr3ny4aptnmfvias  Drruro;t0apx mfciat a2ul(vpnu0aexoxo3todfm raues (0t2xrim oy1al nlnctl(f 2urxm ;u0aet mi3tld m2rlnvs t)arxrxo3oydfpt luei;t)s2xrxo io4ope lictas)s2ua(r ;u4oexoio3iytfmDuanvs ()texnxoctytoat liei;s)trxrir3iy1ol e neilt s2urumo;u0aet  f3iadfsDel(vo;u0artnmo3totlpD ln o;(  rxr(o3io1ameemici sf Dtm(roou4alt io3tltfm2em(vsnu4 ltnmfciodopDe ueslt0srxoim3nodol nmicil(f rumx  no4opt moeilsfa ul( onu0 etrif to1omtraueo;t teumim iy1omtemfcsat) rrm( ooo4olx ioetytfaDrm(vsnt4alenif iadoaD au o (  rtrxr nydom n nes (fsrtmx  ;u1alxo octldls2eanmsnu)aeerxrcta1lptran s t trxoim io1optn ict (faDtmxmp;t4alt mi3iys a2em(vp (0 lenirciatoa rai o;t  2xoxo nydlle lfvia(f Drmxront0aptnif3ilt a2eaumo;t4 rxrxf3oy1lm r nesls0setm(o3nudoptemnct tfsDrmumont0alt ioeiatla raumpnt) rtoxfcoadom  ai o;s) 2xoxopio1lleelfvt t)srumx ono4texo i3iadla2ulumo;u0 renxf oadom eanei;s srtrxopnodol  liesa()srrru  ou0ope mfeiydls2el(ms;()tetoxr3oy1lmte ueolt  exrxmpnu4amenlfvs sf 2umx ont0tpt ii3tytfs2umn o (4 rxnmo3oydopDe n i;(0s2uo(opoy4amenmfvilsf 2tauront0oet mietlt s ua(mp;u)trtnxf oadoatran s;( teum(rpno4alee ncsas) 2ta(r ;o0tpen f3tlsla uanms (0texrmrcoytoa eaivi;s  2uo(m no1lm  mics ( srua(  no1tptoif3tadlmDemuvo;t0 rtnif3iotop elu il(0srtmir3oy1ale lnvia(  Dtm(ro;t4tee mi3iyslm eluvp (0tlerxo3oy1opDe i ol()t2uo(opnodoleemnvtas)aDtaur ot0apxnifetlsla2el(monu4 eeomocto1fmteln sls0trurxo oudlmte icsa()srrr(  oo4ope  iciltlsDrmnvp;t4 renifcoy1lp e ivs;t)texoio oodlmen icia( a2ur(mpot4aexomociad a2umuvp (0 exrmr iadoaDr uvslt  rurimpoo1olenmivs s)srua(  ;u1aptn ieiydlaDrlumon(4tlxnxo3oydfmtrlivolt) rtmiopiy4lm  mivtls  Drr(  ;o4tltn o3iltlm ra( s u) eeomr3oytoaD aiei;s)s2umim3ny4lpt  nciat aruru oou1aeenmi3tytfm2em(mo;()teenmo3oodlm rln o s0t2urxo3oo4lmeelictlsfa2rrx ono0alen f3iltfm emuvo u)texnirciatlmD au o;t0setmiopnudol nlivt s  rtru poo4oleniocild s2rmnvp;(4artnxo3iadlmtrau ils0sexmir ny1llte ies t s2ta(ront0aet  oetad s umnmp t) leomr to1opDrlivo s trumio3ou4apeelnvs t aruaur ot1oexo ociydfmDulnmo t)tetrmrctadom  ai i ()srtrxr3io1al  lnesasfa2trx  oo0tlt ifeiytls eauvo;(4 exoxoctodomDrlies s trtmirpny4lmt lnvi t sDrmx o;t1tet ioetltls2ua(vp;(4alxoir iadomD au o;s0s2uoxopny1llenlics s)srrruront4oet iictyt m2rln s (4tlxnir3oy1latrlivo t) etrxm iu1optnlivi (fa2umurpou4oee iieils sDrauvs;u4aexrmf io1la   ues t seumxo iy4ll eliesa() Dtaxr ;o0altoii3tysls2eanvonu)teerxf ty1omt auvs;(0trxmxo3oo4llt lictl(fa2ra( pou1apt iieiydfmDel(msnu0aetrio tydfmD  ieo s0 rtm(rpnodlm e ncsl()artrurp;u1tpeoioeiys s el(vs (0 rxoxr3todfpDraieolt)teuoirpno4lpe mnvsa() Dumumo;u0tlx io3tytfsDulu o;u4artoio iytopD  i s;()s2trirpno4opee fetatfaDrmu p;t1tpx  f3ilsfa ulnms u4 lxrir todlm rauvo s srtr(opiy1omtnlnci tfsrra(r ;u4tleniietls mDul(ms u)altrir ty1la  li i t0 exoxo ny4lm   neia(faDtr(  ot4oee  ieiad a2uau p;u4areomociatfaDr uvs;(0 2xoxm io1ap  mivtlt  2uax  ;u1tpxomfetlsfs2eauvs u0texrio oydfm  an o t0 rxoiopou4ame livtasfsDrmx p;u1tleomi3ias sDuanvs u4arerifctodfa eaivsls t2xoim iydlp nmfvsa()a2tmu pnu4aexn icilsfs2rlu s;t4 lenxf iatfaD ai s;(  ruoim3oo1am emicsa()a2rrxm oo1altn ieils a um(vo;t0tlxomf iy1fm  aneil( s2uoxr oydal   fvtls  Dtrur nu4optniociad mDrl(mo;(0texnifctotoptr n olt s2xrio nodlp   ivilt artr(  nt0tptoif3tyt a el(vsnt0altrifciodfateliei t0s2toiopio4apeelfcs ( aDrrxmo;t0aetomoeiyd m2ea(vo ()tlxoio tytfptelivilt0sexrxm3iydol nlivtl( aDtr(mooo4tex mfcild a2rmumpnt4aexrmoctatlaDeluvolt setrio3io1lptemnesat) rurump;u1aptn o3iaslm2rl(mont0artnxf3tadfp  lnvi;t teumio3nu1aptnlnesl( s2urxrono4apeoifetyd a rl( on(0 rerxrcoytomD lnvils0 2tmxopoudamte ieilt)s2tax pou1tet io3tysla ra(mp (0arenmo3oatlmtr n i;s)s2uoimpnu4openmiciat)srtr(m oo0aee  i3iytlm emumsnt0 ltoxo3ia1fateli o ( srtrir oodopeelfct ( a2rmx p;o0tltomfciadls2rl(ms t0trenmr3iytoa  lieol( trxmxm3oydllen iviltfa2rrurooo1optnmfetat m2rlnmo;t4alxnir iadlpteaieo;() 2uoiopiodap  mnes t aDta(mooo1tpxomiciyd a2ra( ont0tltoxr3io1fmt lnesls0s2tmio iudome lieiltfarurxro;t1apxniiciadfsDea(mon(0artrio iodla   i o s0srxrxrpou1lp e nvilsfs2raumoot4tlxn fcils s2ea(mon(0aetrif tydlp elneo () rtmim iudol nmivsat)artrumoou4opeomoeild sDrm( ont4aeermf3tytlmt  i s;t)truoxo oydam nlnci s)s2uaxrpou4altoio3tadls2rmu s t0trtnxrcia1lmtraiesls)t2xmir3ou1lp nmfeil( srtmxront1aet  o3tld m em(mp u4arxrifctatlaDeli i;s0sexm(o nu4olt  fcs s)artaxrpot1aeen ieiysls2rauvpnu)trermr3iadfm rlu o t) ruoxo iudlle mfes t) rra( pou1olxoioetydfa ul(ms t0 exomo3oytomDr ieo;t s2urxm3iudop e feta() 2rmur nt1tle ifeiysfa2elnmo;()aeenif ia1omtelieo;(  rur(opiudom nlnvsasfarraxr no4alx miciyt m2em(vp t) ltrif3oytlm e ueo t trur(o nu4lmee fvt s aDtmumpot0olxo o3tadlm2rmuvsnu0artnxo oy1fmtrauvilt0setrio oydamenmnvt t)s2umxmp;t0tpxo fciltla2em(vp t0aexnxr oodomDrlneol() rxrio iy1lp  mivsa( artax  ;o4tpxoifetldfa ran s;() lenxr oatfmtrli i;( srurxm no4optn nes s sDtm(rpot0tlt iiciaslmDeln p t)aeeoxfciy1op  aies;s)s2tm(r3nydlmee fci s) ruau ooo4aexn i3tysls2ul(vp t4alenmfciydfp r ivolt)s2to(rpiudlle  fcils)sDtmxrono1tlxomi3iysfs ra(ms;u)aeerif tydlm r u o t0 euoio ou4lmt mnvi s  Dtmumoou1optniocilsfs rm( s;u0 rerir oadlpD  uvs t) 2xmir3iu1lptn nes t)a2uau poo4ope mf3tls a2um(vs;t0 lerio3ta1opDe ivsls0s2xm(opiy1lltn fcta( artm(mpnu1opeo ocilt a rm(vs;t) exrxf tytlmDrlnvi;()trxo(o3iu1op  lfvias)srtau  oo0opeomieildfaDel(vo t4areriociotlaD anvolt setr(m3iu1oltn ivs s) Dur(root4tlx iiciatlm2uluvont)trtnircoy1optrauvils0t2umir3io1ape lnei ( aDrmumpot4oex mociydfs2uluvon(0trtomociadfpDeln i;s0 rumxopiudalte fviat s2raxm nu4apx  f3iad a em( s ()trerirciydomteau ilt) eto(o ou1omee fviasfartmumpnu0aeeoiietys a rl( snt)texoxr3ia1laDr uei;t  rtoxr3no1ll e fesls)a2umumo;t1tpxniieiad s rlnvpn(4arxomr3iydomteaiei;t0sexr(m iydop  lfvtls a2urxro;u4alenmictyd mDrlnvo;(0aetrirctotlaD anvi;s0t2toir oydapenmfcil(fs2rrx p;u0olxomociadfsDrmuvp (4alxnir tatoaDrauvi s0 rtm(o oo1alt  nvil() rtr(m ;t1apeoiieiydlm2rl(vs ()artnirctotom r ieo;t) exrim3oo4opt lnviatfaDtax  no4texoiictyd s rm(vsn(0aeeoxr3oadfp eauvi s) eumxm nudoptemiei tf 2ta(mpnt4tpxniieiatlsDemn p t)altoirctytfmteauvi;t texr(rpoy1llenmictlt srra(ronu1opt  fciydls2elnvsn()treoirciy1lpD lnesl()teurir3oy1ll nmnetls arrmx  ot1oetnii3tad m2elums t0arermr3todopD ai i s0texo(rpnu4om nlnvias aDtrum no1apxniieilt mDrmnms t4 lenmf3iodomDeai s;()seuoio ny4opt mfvt tfarrm(r ;o0ole iiciasls2umumonu0trxrif3oydom  an i;s texrim3nu1lpe lnvil() 2rmur ;t0apx  fcildfsDemu s;(0 exrirctadlaDraueil( tetoir no1optn nviat srrr( oot4tlx mfctld s ran onu)tlenxo iotom   ueslt0texrxo3iodlpeelnesa()srurur ;o0oetn feiad m eanmont0tlerxr3oodfm  luvils setoxr io1omenlnetlt) 2tmxr ot4aetoioetlsfmDelnmo;u)alxoxf3iadlmDe u sls0s2urxo oydlm emfvsltfa2uaxmooo4tpe mo3iat s ea( sn(0artrmfciydfaD  ieo ( texoxo3nu4op nmnvias s2ua(m ou1aexnii3iyd mDelu p (4 rtrirctatop r nei;t sexmxm oo1altemfctat s2rr(  nt0oexomoetad sDemu pn(4 leomfciytla elnvo (0 eur(m ny4lm elnvslsf Duaxront0tetnmi3iasfsDeluvo t)texoxf oodfmDelu s s0 exrirpiu1opt mfvia()s2rrxmpno1oeenioetltls rmuvs;u0 lxnxrcta1lptelivo t) 2urim3ou1am nlnct tfa2trurpnu0tetnifetysfsDrlumo () exrir iadlaD  ivs;t) rtr(o oodapenlfci ( sDrmx o;o0aptn i3ildfa2rln o;()teenxr iy1fm r uvslt)seumio oodom  lfvi t)s2rr( ono1tet  o3tysls ra( s u0 etrmr oy1fpDrlies ()s2xoxm3no4lleemnetas)arrrump;t0aptnifeiaslsDrlnvs (0aetnxf3iodlm elnes;(0t2toir ny4amen fet t s2tmxm ;u4tee if3iysfa2rmnvpnt0 lxrir iodlmDe u ils  2tmiopoodlm emncs s aruaur ;t4olx  o3iyd s eanvpnt0arxrxr oo1la  anvols)t2um(o iu4openlietl()s2rrxr ou1olxnmieils s umuvonu)alxoif3to1lpD livols tetoxm iydam   fes t)arrrxr ou1oexnmi3iadlm2ul(vont0alenioctodoaD aivs s0t2um(r3oudlp nlnctasfsrur( p;u0tetomi3ias a2rau p u0teerxfcootfp elnvi (  2uoxrpiodlltn fei s a2tmum ou0oee ioetlt s uau s u0 eermo3ootlptr nei;t  rumir3nu1lme livta()a2rmx oou4texniieils m ra(mpnt0aetrirciotoate u s ( trxo(o nodolenmnvias) 2ua( p;u4alxo fetydla umnms;() ltrmfcoatfaDeai ols)t2uoir3oo1oltnmies t arumumpot1aex if3ildlmDul(mo;t4 rxrmr oatfaD  neil()srxoxr ny1amtnlfei sf Dtax  ;o4oeto ocilsfs2emn p t)aexnxoctytopt  ivi;t teumirpnu1lme mnet (fa2rrxront4olxniiciasfm ulu o;t4 rxrxfctydlpD  nes;t) 2xr(o3io1omeelivs ()srraxm ;o0aeeo feiys a2rm( o (4alxrmf io1laDean s t  2trxo no4al   nvias) 2ua(moot1opxn f3iytfa emu onu0aeeomr tadlmD livi t)s2xmxrpio1amtemnvtas)srtax  ou1opxnif3ils m uan s;()aexniocoatlm eluvi;t0 rtm(m nodol nlics sf rrmxr ;o1alxo oeias s rmums u4tltrmr3oo1fp e nvo s)sruoxmpny1lpt  nesat)srurxro;o4aleomfetad m em(mpnu4aetrmfcoatoa r nei t)s2xm(m oo1lm nlivta( aDua(  ot1tee mocias sDemu on(0trerxf3todlpD luvsls0trtmio oodape  ncia(faDrrxmono0olx mociyt aDem(ms;()aexrmo3oodom raueolt) 2toxopnydlp  lfvil(fs2ururo;u1alxo fetytfsDrauvs u4 lermf3ta1latr nvi;s)s2xoxo ou1opeemfvias  rtau  ;o0aet ioctaslm2ean o t0 lermrciy1op  ln sl() etm(o3iu4lpe miesl()a2tm(r oo1tle ioctyslm2rlu o (0 rtomfcto1lmtelnes t s2tr(rpiu1ome mieiat  2umump;o0aleoif3ild a2rmnms t)trerxr oy1op  au sl(0 2triopio4ol n iviat  2umum nt4alxomoeiltlsDranmpnu0 etnxoctodlmte n o s0texrir oy1lm n fvtlsfaDrrumont4aptnifciad s um(vs t0aexrmoctatlaDeluei t)t2uoxo3ny4omtemncilt) Durx  ot4tet io3iasfaDrlnvp;u0tlxrxf3tydfpt luesls) rxm(mpny1apen ietl(  Drrurp;o0tpe  iciysfm2eauvp;(4trtrxo totfpDelu olt) 2xrxo nu1om elnvt sfaDrr(m ;o1apt ifctlsfs rl(mo u4texrxo tadfp e ivo s  rtm(rpoy1omt lfvta( srua(rpoo4oltomoctad sDrm(vonu0 eermo3ta1fm e i sls0t2xrxm3iudal nmnctasf rtmumpnt4tpen o3ildfsDulu s;(0aeenxo oy1lm elnvi (0trurxmpnudamenmivt tf Dtax oou1apen oeiydls umnvpnt4 rtomr3totomt ln s s) rxm(m3iu4lp  mnct t)sDum(rono0oet mf3iyd a2ulnvo;(4tetnxocty1faD aiei;s0setm(rpoo1amen ivtat a2trxrpou1ale  f3iys aDemu s;u)trxoxf3iy1oaD aivs t)srtoxopnu1ll nlnetat  Dta( pno0tltnmf3iatfa eanms ()artomf3oo1fp elu o;s)setoiopoo4lltelfeias  Draxm nu4aee  oeild aDul(mo;(0artomf3iadlaDr ies t)trxrxm oydapt  ivi s) Dtrx p;t0olt iocias sDuanvon(4areniocoatomt  nvsl( texmir ny1lp  mnvia(fa2ra( p;t0olxnmoetld s eanmo u0arenmo3tydoptrauei (  exrxmpoy4lp   fcslt a2rrumpnu4ope mfciaslmDrmn p;u4texnmr iy1fa e uvo t trxr(r nydlp emfcia(f 2rrum no0apx mictldls2rluvs (0alxrxf iytoaDeai il()tetoio iu4op nmfvi ( artaurpnt4altnio3tas aDra( pnt)aetnif oydoatr nvsls s2urxm3no1lpeelivtl(f rtaxmonu4tptnmo3iadlsDem( o (4arxrmr3ootoateln ol(0 2ur(o3oy1amtnmfcilsf rrrxrp;t4aeto feildfs uanms t0 etoirctadfpD  iei;t0seto(m nu4am n ivta( s2tmuro;u0tleoiictadla em(vs;()teenxfctodfaDr i sl(0 exr(rpou1ape mneilsfaDrr( pou0opx mf3tydla umnvo;(4teenir3to1oa  aneolt)tetmir oodamtemnesa( sDua(m nu4aet  octadlsDrln p (4trtnio3oydla  au s t0 ruo(m iy1apeelnvi () 2rau pou1aptomo3iadfm ul(mp;t0trtoir3oytlaDeaueol(0sexm(m ou1aleelivi tf Drr(r ot4tleoii3ild m2uaums t)treoifctadoat  ies;() rtr(m3io4lpt mfvs t  2urxr ;o1opt mf3ilsfaDraump;t4areoxo tydlmtr uvsl( t2uoxopny1amte fvt (fs2rmxmonu4tlxoifciydfm rlumsnu0arxnxf3ta1omD luvols seurxmpiy4opt mivi t) rtmurpoo1tlenif3iytls2rluvs (4artoxfctytlaD  uvo;s)srto(r oo4open fesa() Duru o;o0oet  ieiysla2rmnvonu0altrir oytlatr nvi;(0tetm(o3iu4ol elnviltfsrraumo;o0aeeoioeilsla ra( s;()tlxrxo3oytom rln o;t s2xmxo3oy4apen iesat)s2ra(m oo1apenmfeiytls rmnvs;t) exrxfcty1op   uvs s setoir no1ameelnci sfarrmxm oo1olxnmociytfm ea(mpn(4arerirciy1fa e ivi;s texoir3oo4oleelneias)srraumoot0aeenmi3iat mDua(vo;t)arxnif3oydfpDe n s s)seurxm3iu1lltnmnes tfaDumxmpot1apx ioeildls em( p u0tleomf oo1lpD au ils)s2tmxo oy4apen nvias) rua( oot4oeeoii3iltfm um( sn(4trermr3oa1fmD  neo s) exrxopnudamtnmfvta( srtr(mo;t0altomi3tltlm ea(monu4 leoif oadoa rauvs;t t2tmxr3ny4lmtnlfvi sfsDrax  no1texo feiat m2rl( o t)artrxfcto1lm ran i;(0trurir3no4ome mfvtlsfs2tr(m oo0aexnif3ilsfaDua(vpn(0arerif3oy1lp  aneo;t) ruo(o oy1lm  micil(  Dtrxm ;t1oexnmoeild s2rau o;u4 rermocoo1faDr uvo;( setm(opio4lmen fci (f rum(m nt1oetn feiyt a eluvo u)artomo iadopte n o s0 etriopiudalt mfvtl( srtmumooo1tltnmf3tydls2rl( o;u) rtrmf tydopDeln i;t srumxr3nu4amtn feil()srtr(mooo1oex ioetldfmDrmuvp t0arxomr iatlaDe nvo;s)sexoim no4aptn nvsltfaDtmxr ;u1tetnmfeilsfsDea(vsnu0tetrxo totoa r ivi s)teurxm oydlm n fesa()s2trumoot1tltnif3iatls rlumsn()tlxomocoadlat anvi;t0setmir oy4ome  nvta() rtau  ou1ale iocias a2rl(mp;()texomf oodfa   nvi;s0trumimpiy1llenmfcsls srumu onu4ape mfeilsfmDem(vp u4 lxomr3iy1la r i ils) 2tm(mpio4lp   iet t srrr(r ;u4aptn iciyd s elnvs (0aexoxf3tatfa elneslt trtoir nydam emiviasfa2tmxrono4alxomfciat a rl(ms (4aeeoxo tadom   ivi ( teum(opiodoltn fvslsfsDtaxmpoo1tpt ifeildlm2rl(vs;()tlxrxf3oatlp r ivi;t0 eurxo iu4aleemiei s)s2urxrono1oltnioeilsfa rmnvs t0 rxniocoa1fpt li o ()srtoio oydlm nmnvsat)sDta(ro;u0alt  feildfsDeauvp t) lxomf oytoateluvo ( t2xr(r3oydlmeemneta()a2tmuroou4optniocilsls rlu sn(0tleoircoa1fmD  nvslt srxoim nu1lm nlfvt sfs2umx ont0tle mfciasfa eln ont4aexrmo3oo1oatr nei;t)trum(mpio4am emfeias)a2rm( oot4tpeoif3tyd a eluvp t)areoxf todopteanvs s) 2xmxm oo1lleeliet tfaDumx pou4alto o3iyt a rl( pnu) lxnxocoytfaDr nvs;s0t2xm(r nudapt lfcia()s2rmxrp;u0optomocias aDuln s;u)trenmr3ia1fm e nvs;()trxrxr oo4altelieslsfsrtau oou4oet mieiydlm2ra(vp;() eeomf oatfm  luvi s s2trxo3nu4am  lnvi s)a2rrx ooo1tex  f3tadfa2ua(mpnu0artrxoctodop rli o t0 rumxr nydomeelies s)srtmxroot4oetn i3tyd sDrln p;(4 reoxf3oodfp  aneo s0srxm(o3oo1lptemnci s a2ur(  nu1tpeoifeiysfa2ea( o;(0trtnxocootop e i sls t2urxopnudamt  iciat)s2uaump;o0ale mfeiysfa2rm(vpn() rxnmrctotfa rlnvs t trxoiopoydlp emfeta(fsrtm(monu1apxnmf3iysfa uanvpnt0aetrxfctotomD aueo;t)s2umio3oodaptemivt s arum(moou1olenmi3iatlsDelumon(4 etrircootoa   u ols  2um(m iudlmen fci (f rtrum ;o4apenmfeiltfm2el( o;(0 ltnxr3iodoaDrln s;s)t2xmxm io4lp n fvia( arrru  ot4opto ieiatfaDraumsnu4arenxo3tydoaDe u o s)t2xm(opnu4ope mfci s  2taumpot4aptoio3iydlm umnmpnu0artoxr3iy1oat ai o ()texmiopnudaptnlfes (fs2urxr no4tltoiicildfmDeln o (4teerif3oadop  lu s;t)srtr(o3nu1lm n fctas)arrrxm ;o0oet mfeiytla2rmnms u0 exrmo tatfp r neo t0seuoxr iu4lm n nvslt  2uaxmpot0oexo fetas m2ua(mp;t)aleoiocio1fpt lnvo;s)trto(opou1lp emivtl(f rua(rpnt1tltnif3ilsfmDrln o t) ltomociatlmteli o;( t2to(rpnudamte fctls) rumx  ;t4opxn feiltfmDra( ont0artoxfctydfpDr iei ( seurxm io4ape mnvia( aruax ooo1ale ioeiyslaDrl( o (0 etnmr ia1lmDeaues ()srumxrpiu1ll  mfcslsfsruaxm ;t1tpxoifeiyt mDranvs (0tlerxocto1fpt ai s;s0 rtoimpoy4alee fvs ( s2urxr nu1aexomiciydlmDuaumo;u)trtrmr iatlm rluvsls0 eumir3iu1op elneilt) 2rrur oo0tptnmoeilsfa eauvsnt4texrxf3iydlpDrli i s  rumirpiu1om nmnet ()sDtmu pnt1tleo ocilt s2elu snt4 exoxrcoadla rlueslt)srtrir3iu1apteliciasfsrur( poo1oltnmociasfaDrmump ()tlenxo3tytop eaueilt setmim3io4opte ivt s  Drru ono4tlxo i3tad m2rm( sn()arxnmocoo1lpDe u sls)trtriopno1apte iciasf rrrxrooo4aexo i3ildfs2umu s;u0teenxf to1opDe i olt0s2urio iydlp  lncilt artm(m ot0oetnioeilslmDemumo;t0 reoir3tydla e ieo s0 exrir oy1opeelfvtasf Dtmxrp;o0tpxn o3tys s um( s t)tleomf3oodlpte iei s) exm(m3io4lp elfvslt)sDurumoou4tpx mocildlsDua( p u4aetnxfciotfptr ivolt) exoio nudop elnetlt) 2rmum nt4alx  i3iysfaDea( s ()aetoio3tatopD  neo s)sexrxm3io4oleelnvtls a2urxroot0apeniociasfmDrauvo;u)texrxrctotfm  lu olt  2trirpiydolen ivsat) 2uaxmp;o1opxn o3iyslm uauvs ()aetrxfciydla ran i (0sexoiopnudamtn nes tfsDrru  no1tlt iieiysfsDulnvpnt0aexoxocoo1lpDean ils)setmiopoo1omt mfeils)aDtax oot1olt micild sDua(vpn()arxnir iadlp  aueil()t2xrxo ou1lptnmfet sf rumxmpou4tpeoif3tytfs rlnvpn(4tetrxociodlmteluvs s0 2to(r3nodlle lici tfarrmxm no1tlto fetydfs2elu pnt) eermocta1fp r nvils t2uoxr3iy4lm e netl(f 2trxr oo1alx mo3iadfs ua(mp;u0 ltnmrciadlp eanes;( texo(opoudopenmnesl() 2tm(rpno4aetoiicild s2rl( onu)alxomrcoatlp  auei;s)srurxr io4lmt mnesls)sDta(rp;t0aeeo f3iasfm2ranvo;(0altomf oydom rlieo t)texrim3iy1om   nci sf rtr(m ;u4apt mfciys s2ua( p;t0 eermr3iydlaD aneol(0teuoir3iudlmtemfviatf Dtmxmoot4olxniocildfa rlu p u0artoxf3iodop  anvol( t2xoxm3oudlmtn fci sfsrtm(mo;u0opx mfeiytfmDua(mo;u)tetnmrcta1lpD  ivilt) 2xmxm3iu4ame  ivils a2ra(roou4tpt  ieiasfs2ran o t)trtnio oo1oa  lneo;(  rxo(r iu4omt  fvt (fs2tmxmpnt1tet  f3iat m rm(mo;u4 rxrmfciydfm  li s;s0setmio nudome mfesls)s2rmu pnt0aex mociadlaDemnmsnt4 ltnmociytlp r ivo;( t2tmxr ny1am  lnctat  ruaxro;o4olen feiys s um( p t0texoio ta1opDeanvi;( s2uoiopiodlm  liesasfs2trx onu0ole ifeiatlm ulumo u0tltnirctytlat lnes;t  2uo(m3oy1apee fcsat aruaur no0ole  i3ildls2uauvonu0 lxrmocoo1faDr uvs t0 2xo(opnu1llt  fetas aDrmurpot4oee iieiltlm2ua(mp t4alenxr iotomDranei t trtmim3iy1amt mneil( srrmumpot1aexoio3ilt a2ea(vsnu4tlenmr iydlpDelieo;s  exrirpnu4op  mnesltf rrru  ;o1tpx mo3ilt a rauvp;u0alxnmrciodoaD  ieo s) 2urir nydalenmfvta() rtax  ot1olxo ieiasla2rm(mo;t0tlerxr tytoa eauvs;( tetoirpoo4openlieiat sDtrumpoo0tltnmf3iysfaDuluvpnt0aetrxr3totomDeaieo s)s2uoxopoy1am elivs t)aDta(  ;u0texn ieiad sDeln p ()tltnxo tatfa ran s;s srumir3ou1ame livsat sDra(r ;u1aexoiieiat s rau o;(0aetoxo3to1op  au s s)tetoir3io1lpt lietls aDtmxrp;o4apx mietys s2emnmsnt) rtrxf iy1optraivs t0trxrir3iodoltn fcta(f rrmurpou1tpt mocilsfa rlnmo;(4treoifcoodop rlies t) exo(m nudopt lnvia(fartm(  oo1oexnmf3tlsla elumsnu0 ltoir oa1lmDeluei s0trxoxm3oy4ll  lics t) Duax pot0ape moeiyt mDra( p u4 renio iotla   ieo;s0 rtoxmpnydole mnct ()arumx o;t0tlt  ieilt s ua(vp ()artrmr3oodoptr ies ( s2trxmpoo1olt lfetatf rraxr ot1apt  ictasfs2rauvp (0teerxf3oatla rlnvs (  eurio nodll   neiatf Dtmx ooo4aeeo f3ias a2um(ms;u4tltrifcty1fmD lnvs;( srtoxm nu1ol   ncta( srtmxmpnu4tlxoifciadfa2rm(vs ()tleriociytfatelueo;s s2toio no1omtn fei ()a2tmxmpot4tltomo3iys m2rln o u4tlenifcia1fate ueo s)s2xmxrpoo1ll n nvtlt aDum(rpou0alx  iciadfsDra(msnu)tetoif3oydlptr ivsl(0setm(rpou1al n fet (  rua(r ;o4tlt  o3iytlmDua(vp;u)alermr iydfmteliei;( teur(r ou1ole mncs sf Dta(  ;o1teen feiatlmDea( onu4aexnmf3ia1lp rlu s;( tetoxr3ny1lleelivsls srur(  ot4tlxomfciyd s elu s t4 etnmociodlm r ivils trum(m3nudamtnlicilsfaDuru  ;u1apenmociasfa2ean p;u4 lxrxr3oytfm  liesl(0 rumxr3oodalee fcsa() 2uau pnu4tpt  i3tasfm ranmp t)trtnxfcto1fa eau i ( srtoxr no4olee ivtlt)srua( o;t0tptnmictasfm eaums u)aetnmocoa1op eln o;s)t2tm(o3io1olt lfcslt  2rr( pnt1opxoiiciasfaDul( s t)tltrxo3totopD lueslt t2xoirpoudaltnliciat a2urxmp;t0ole iieiyd s2umumpnu0tetrmocta1fmte ivslt0 rumxo ny4ome mivtas)a2ta(  nu0texnii3tadlm rmuvs t0tlxomf tatoatr uei s sruoxr io4optn nvi s)artmur no0aetomociadlm2em(mon(0 lxnxf ootlpDrlues s t2xmxr3iu4om   ncsa()a2rmur ot4aexn fetat sDrmnmo (0trtrir3oadfm eaieils0trur(mpoudll n ivtatfs2ua(rp;t4apeomietltlm eanvp t0tltnir ia1fmDeauesls srtoir ou1lpe  feiat  Drmumo;o1tleo octytlm rlnvonu)aeenxo iotlm  lnvolt0 rtrxo oudal nmicsa( sDtax p;t1tpxomi3ild s ul(vs t4 etoxo3ootfpt  i sl()s2toxmpoydal  lfcsas  rum(  ;t0texoiieiadla rln pn(4altnif3todfaD lu i;(0srxm(m3nodlp nmfei (fa2ua(r nt0ale iietldlaDumnvon(0aetoxr3iytfate n olt)trtmio iudal emictl(  ruaxr nu4oeen oeiltfmDum(vs;u0trxnmf oo1faD aieolt0s2xrir oo1ap   ncsa(faDraumpot0opeo octydlmDel(ms u4 rtrir3oo1fpt  ueo (0 rxo(opoudapeemnciatfarrm(  ou1tle iictysfs em(von(0texrioctotfpteai i ( srxmxo iu4op emnet t  Dtmurpnu1apt  ietlsfa2uluvp;()trxnxo todoa e ieslt  ruo(opiy1lleemicsas)srrrxm ;u1oet ioeiytfs ra(ms;t4tlxriocta1om  aivi s0 2trimpiudal nmfci s) rur(rpoo1tlt miciys mDemu sn()teenmrcoo1om eaieo;(0t2to(rpnydlm n ncta() 2rr( pnu1aet ioetld a2rmnmont0 rxnxr io1op rlueo t trurxr3no1altnliesas)aDra(m no1ole  f3tysla2rlumon(4 etrio3to1fateai s t)setr(mpiy1apee ncil()arur( poo4tlenmoeiad a2umu s;u)teerxf iatfat lnvo ( srtoiopoodale  ncs s)srrmu  oo1olxnif3tlt s rlu s (0 rermfctydlpDe nes t0 2tmxrpoo1ope  ici s  rumxront0tptoif3iyt s2uanmp u4alxnmrciy1om eaneo s)teto(o3nu4lp n fcslsfsDur(m oo0tlx  o3tytlsDuauvo t4artrxo3oodlate uvs s  2toirpno4lp n ivta(fs2ururoot0tpxniieiatfa ea( p;u)trenio3oydomt  nesls)tetr(opny4openmfcia(  2tmxro;u1olto oeiadlmDulnmp t)artriocoadlmDrlueolt0truoirpoudopt mncsl()s2umu pno4aetoiociltla uaums;u4 eenmrcoodfa   nvs;(0tetr(opio4al  lnvs (  Durx p;u0open oeiytfaDea(vs u)arxnif todoate i o;t) eur(o oudomtnmietlt)sDta( oot0aet  o3ildfmDumu o (4aexnxfctytlmD auei;(0sexmxo nydamtn fviltf Dtrxm ;t0olx  fcilt s ranvs;()aeenxr tydfp ean il() ruoio iodll emnei (  Draxr ;t1olxnifcilsfaDul(vsn()trenmfctatom e uei t0 rtoxrpiudap  mfetat)srraumono1apenmf3iatla eauvo ()trtnxociotoa eaivo;s)trxoir oodoltelnctls)sDumuro;t0altn feiatfm elnvsnu4trxnmf tadom e ivi () rto(r3iy4lmt  neil( sDrmxr no0apeoiieiys a2rln p t)aeerxr iy1lm rai o;(0 rtrimpoo1ape licsatf 2raurpoo4tlxnmociadla2rm(vsnu0 leoxf oadfptrli o s0 2toxr ny4oltelictl() 2urx pnt0tpxn iciysls2ulu s;()tleoio3ootlpDrli o;() 2uo(m nudaptemncs s) Dta(roou1olt  octyt a2emu pn(0alxrio iatla e ivi t) rurim oodope lfviltfaDrm( ont0tle iocias s2rmuvo (4artrxr iatlptraueolt)trumir3io1op emnctls) Dtrurpnt1oetnmfciasfmDelu ont0 exnxr3todomtelivs;s)srtoiopoy4omeelfesat)aDrmumpou1opxo ictatfaDel(ms (4tlxrir ia1fmD aieslt0 exm(r3no4om  mfesat  Durumoot1olt if3tltfaDumuvon(4 ltnir3tatlpDelu i;t0t2xrim3oudlmt  ictlt) 2uaxm ;o4alto ociatfa em(vp;(4tetoxfciy1op r i ils sexmim3no1olt mivil() 2um( oot0opeoifetyslsDeanvpnt) rerio oodfptr n ils)seumxo oy4ll n fvs t  Dtmxrpnt0olxnii3iytfs ul( p u0tltnmr3iy1oaDr ues;(0trur(opny4lp n ncia( srtaxrpoo0tpx  octldls2rmuvp u4texoxocootlpteln o;s)texmxm3ny1altelfctlt a2trx p;t1oetomfcias s2eau o (0trxrir3ty1fp raivi () rum(m oy1op emietat)s2trx pot1tetniiciasls2umump (4 renxf3tatom rlnes ( s2xoirpiydopee feia(fa2rmxro;o4alto o3tadlm ranmpnu0 exnmo3oadfptr ivo;s) exoxr3ou4lmtnmiesl()srurxr ;u4oltoiociysfm2ran s (4trxrmr3totlpt lieil(  exmiopou1om  mnvs ( sDumu  ;o1oltomf3ilslaDumn o (4 eeoxo3oatlm r ueolt teum(o oy1opeelfvs () Dtaumoou1oetoiieiydlm2uanmpn(0 exoxfcio1lptrlnvils t2tmxr iu1ol nlnesa()srtrum nt0tee ifeiyd s ean sn(4trenxo3iytoaD lneilt)truoxm3ou1lptn ncias sDrrxro;u0ape  ociadfm em( ont4artnir tatlpt anes;t)srxoxm3nu4lpte fvta( sDuau pno4tlen octldlm ean s t4 reoxo oadopteln o;()tetoirpio1alenlnct (  2uru o;t4opxnio3iydfa2uaump;(4arxnio oadlm e ues;()t2tm(opnu1op nlivtas  2tru p;o0aptn o3iyd aDea( s;t)aexnir3iatoptraivo;t0 rxmxo3ny1open ncs t) Drax ont4aleoifetltfm2umuvsnu)aexrir3oadoat li i;s0 ruo(o3ny1lptnmnvta(  Dumxrpnu0olxnmocilsls rmn o;u)texomr to1omt aieolt srxm(m3oy4amtnmfvias) 2tmx  ot4apeo ieiat m2emu s t4teenifciotfa eaivs;t0s2urxm ny1al n ieslsf Dumu pno4apeoifeiat a raump;t4 lenxo oa1om   i o s0t2urxopoy4olenmncsasf Drmu p;u4oexomfeiat m2eauvo;()areomf iadfmD lnvilt0s2xrxr iu1alt  fetas)aDraxm ;o1opxo ociatlaDuln s;t)trerio3io1fp rai i ()teumiopiydome lfctat  rumx pno1aexnmoeiydfa em( p u4tlenxr ootlmD lu o t  exo(m io4omen ncta( a2rmurpoo0teen o3iad a2ua( o;(4 eeoio io1lptraieils0seur(o ou4opt lfvsatf rrmurp;o0aee ifciltfsDul(mo (4artomocoo1omD  uvsls0texr(o ny4omtnlfeias) 2rrum ot1oet  f3tldls um(vp t4 ltnir3tydlaD  ivo s0texmimpnudaltnlneiltfs2tru o;u0opxn feiasfm raumo (4tltnxo3todfateanvilt setr(rpiy1apte nesltfaDrru oot4tlt moeilsla2emumsnu4arxnif iy1fmtrluvsl(0 2toxm3io4lptnmieia(fsrrrxro;u0tlt ifetas a umu p;(0tlxnmrctotfa raivi t) rum(m oo1lptn ncsa(fsDtrump;u1tee if3iasfs2ra( snu)teermf3ta1laDrlivs t0teumimpoy1optnmnvsl( aDua(mpnt0tpeniicild a umnvp;(0texrxo3iadomt  n s t0 2uoxr ny4lp emieias) 2um(  ou1tpxn o3tyt mDemumo (0aetrxr3iy1lmDranes s0 euo(rpny4op   fet t)aDum(r nu1texo i3iltfs2ranms ()altnio3iadfpDeaneo;t0 rum(opou1llte fvs (f Drau  ;u0aet  i3tlslm2umu s u0 ltrmf tytlmDelivo;( sexoio nu4ameelncsat)aDrrumpoo1oeeomictyslmDua( pnu0 exnxf3ty1laDelies s0truoxo iodope  nvi t)arum(r nt0oetnmoeiyd a2uln pnt)tlxrmr to1omD  n o ()tetmim3nydal n feslt  2truro;t4aeeoioctydfs2rmu s;u) ltrxo3ootoat livilt0 2urim iodlp elnvils s2taxmoou0tlx ioetysfm umu p;t0alxnmf ta1fm  au sls  2xmxr ou1op   nei t)a2tmu p;u4tpx ifetlslm2ua( p u4 eeomo oadop  aieo (0s2to(o no4ll n ncsatfarumxrpoo4aee if3ildfa em(vs;()tetoxo3oytomt  ies;s0trtrxr3oy4om nmnvs (  rur(r no0oeto fciysfaDran ont)texnxf3oy1fmteaiesls)trto(r nu4ol  livsl( a2rrx  ot1tpx mfctasls ean o t) lxrifciodfp  aieolt0 rtrxrpoo4alt  ici ()aDtr(rp;t4olx iociydlmDrlnvo () rermf3oytfp raivsls)s2trirpiy4lmenlivs (f ruau ont0opt  o3tadla umumpnu0tlxrmf totlmte ueslt) ruoim ny4ap nlivsa(fs2ta(ront1alxn fetytfa2rl( s t0aexrxf iotom e uvi;t0 rxo(m iy1optn fvtlt)s2ta(r ;t4aexoioetatfa2rmump (0aexoxr tydomt  ivils  rur(m3nydlm  lncta()s2rm( p;o1aptomi3iyd sDean snu0tlxrifcio1oatrlivo (0 rum(o oydlm elietltfs2tmu p;t0oee if3iydlmDeau p t4teerxrcoatom  lues;s0 2xoxo nudal nmivilt aDurxro;t1tlxoiiciysla ul(vo;()aeeoxf3iydlpt livo t srumxmpnudapte nvta( sDtr(r ;u0aexn oetasfa2um(ms u0tetoxrcoo1lpt aies;t)s2tmir3ny1lpee fcs tfartaumpnu0tptoiictlsla rlu o u) renmf oatlatrluvi s)s2xmim3iy4lltnmiei s) rtaxrpot1aetomi3iytlmDrmnms;t) rxrmoctodfmDraiesls) rur(o oy1lltnliciatfarrrx o;t4tlx iiciaslm2ulnmp;(4 leomfcio1oaDrlnvol( t2xr(opiydlmen iet (faDurx oou0aptniociyd s uauvo;u) rxoir iotomtelnesls s2xrxrpou4lleemiei t  rraxroou4ape  fcilsla2rln s t0trtoxo3iotom  an i t)s2trxm3ou4aleemfcta() Drm(r ot0aex  oeildla umnvonu)teenxo iodfpDranvi;t) 2uo(o oy4omte nct s  rrm(rpoo0oexoioeilsfa2em(mp;t4teenmf oy1opDelnvsls)srxoxrpnudop nlicsas  Drr(ront4ape  o3iat sDrlnmp ()trtoxf3tydfa e i sls0setrim iu4apt  fci ()a2tauronu0apt  ieiat m2umnvs;() lxnmo3oy1lp  lnes s0s2uo(o oudam n neiltfsrtrxrp;u0tetomieiat s2elnms () rtnio3iodfa e u i;t0trtrim oo1lp   ivslsfs2rrumpnu4olxomf3tlslaDrmumo;u)tltnmociytoaDe nvo;t t2ur(m3ny1llenmneils)arraurpnt1oleoifciys sDea(vsnu4 etomo3ia1fate uei;(0trxoxo3ou4aleemnes (  2urxm ;u0tpxomiciysls emuvsn(0 rxniociadfp rai slt0sruo(r nu4om e nctas)artmxm ;t1opeo feiyslaDul(vp;u0 rtoir iytop  lneilt)s2tmxr io4omenlnci ( sDuaur nt4aeeomfetyd aDumn p u0texomr iodla rliei;t srtrxm3io4op  lncsl(faDuru ono1teeo oetys s2el(vo;(4arxnxo3ty1op ranei;s) 2um(rpiydop  lnvs (  Dtmxrpnt0aeeoiictat m eaumo;()tlermrctodoaDeau il(0seuoxm3ou1ole lfetlt)a2tmx  ot4texo iciyd mDelu pnu0 rxoxf3oatoa elnesl()s2xoxopoo1lmtelnct s s2ra(m ot4ope  ictasfmDean p;t4aexomociytfaD  u i (0setoirpny4optnmivs ()aDtrur oo1opt mo3tadfaDulnmo;(4aexrmr3ia1fpt anvo;(0 rurxr3ou4lleelnctl(f rtmx  nt0aexnmoeiad mDua(vsnt0arxnio3iadom  lu o;()srtmir oodoleemnctat)sDrmxmooo0oexnmoeilsfm2rl(vp t0 rerif totla eaivo t)trum(o iu4amte fvi ()s2rau ooo4aex  i3ild aDrm( s (4 ltrxr3iatlptelueslt0t2uo(o3ny1lmt mfvtlt a2uaur nu0tpeoioeiadfa2emnmo;t4aexnmr oatfp  au ilt trum(o io1omeelfcsas a2trxront4alen iciyd a ranvo;t4 renxf3ty1fmteauei;t) 2trim oo4alen fvslt s2tmx pno0oltnio3tadfm rmums (4 lxomrcoo1opD  u ilt t2tmxm oy1alen icsas) Dum(rpoo4opto i3iyd a2umu sn()tlxnif ootfpt li ols trxoxmpoo4olt lfeiat a2tm( p
\ No newline at end of file
@@ -0,0 +1 @@
+uvols0 2toxm nodamtnlivs s) rumxrpnt0ape  f3iatfa elnmo u0arxnxocto1fmDean i ( trxrim iy1openlncta(faruaumpno4opto fetyt s2el(von(4 exnmocia1fatrauvo;s)s2xrxrpou1ap nmfetas  rtruro;o1tex  i3iytlm ra(msn(0alxrmr3iotoa elneol()t2um(o3oodam emieta(faDrmur nt0ape  ieiad a2um(vs;()tleoxrcootlpDeaues t0setrxr3ou4lpt licsls)aDrmxr oo0apto o3ias aDranmo;t)trtnif3todlptraues;s) rxoxr nu1lmt miciatfs2taxmp;o1altnmfctlt aDranmp (0aetomociatlmte ues;()setoxm3ny4lle  fviat)sDra(mp;o0tleoioetlsfm rl(vsnu0arxomo3ia1oaDrai s (0 etmir no4ope mnvta(farumum ;t4olx moeildls emn s t0tlxnif3tatopDrln i ( s2umimpiy4alee fcs ()a2uau pot4tlxomietadfsDemnvo ()altrmr ty1oatrlneilt0 exrxo oodlp n fetlt)arumurpno4tetn oeiyd aDum( s;(4trxnmo3totomtrlnes s0teuo(o iu1olenlnetlt aDrr(mpoo0apeoioeiytlmDumuvs u4tlxomr tatopDeaueo ( srxo(r io4omee ncsa() Dtm(r ;u1alx mfciadfm2ra(mo;t4alxoir3iadomD au s s seurxr3oodame  fcta(fsDta(rpou1olxniieiatlsDrln o;(0aexrif3iydlmtr ivolt0 2toxm3nu1ope lieils) 2rrx  nt4apxn fciytfs ua( p u) eermo tydlat li i;()t2toio oo1lm  lfetas)a2umurooo1tlt  oeilsfs2elumon()aetrmf ta1oa e nes ()t2uoxrpiu1altemici ( s2urum oo4apxnioctat aDelnvs;t0teerif tydlptrau i s)srxoir oydam nmfeiat sruaurpnu1teeoiictas a2umnvsn()trtrio3oatfpDrauei s  2xm(m3oo4op nlfvsatfaDuaxmpot0aex ifcias m2rmnvs u)artrxo to1fp  lu o;t0t2xmxr3oydopen nctas  rurxmpno1apxnii3iysfa eanvo;u)alxrif ta1fmt  i i;(0sexm(r3oo4olt mncilsf Dtr(roou0apt  i3iasla rl(vsnu4tltrmr oodoaDeai ilt0 rum(m3iu4lmt  ict tfsrrr(mo;t0oetnioctytlm2ua(mp;t) rtrmr3tadfpt au o t)s2tmxmpny4altnlnvt tfa2umxmont0tlto oeilslm2ulnvpn(4 lxrxf oa1lmt aieo;t  exoxr3ny4ome  fcsas)aDta(r nu0apto fctadlmDulums;u)tlxoxfcia1oaDr nvslt s2trim ou4amte ieia(farum(rp;t0tleo ocildla ra(mo;u0trxrif3ia1la eluvs;s seumimpiydopenlivt (f rtm(rpoo0aptnioctlsla ul(vpnt4 renir3to1oaDeanvil() rum(r io4ll nmnvi tfartau ooo0olenmiciysls2rmn s;t4 rtoifcoo1omte u i t) 2to(r oudomenlnvtl() 2raur ou0alenioeildfa2ean o t0trtoir3ty1fmtrau ols  2xm(o nudopenlfvtls srtr(rpoo4tex  o3iad a elnvonu)teerxo ty1oa   nes;t0seumxo3nydomen icsat)s2taum ;u4optn f3tyd a ua(vp;t4 eenmfctydoat ln ols0srtoxmpnudll  mnetasf 2ra(m ;u1aetomfeiat aDelnmp;t0tetrxfcoytlpDe ueol( s2urirpoudaptn neils)sDuru oou1oeeoif3ildfa rmump (0texoxfcoy1lm rai slt)srxoim3iudol e fes s sDta(  ou1alxnioeiyd a2eln o u)tetrmfcoydfm eauvo s0t2urim3oodomtn fct s)a2ta(m ou1tpx ioeiysls2eauvpnt)tlermr oadfmtr ieo t0srum(m oo1ll nlfcil(f Dtm(r nt1alen iciyt m ua( onu) etnxr3ootlateauei;t)teum(r3oy1ape  fetlt  Durx pno0tetn ietldfm2rlnvp;t0texnxfciydomte n o t)t2xoim io4llee fvslt s2tmx ono0tltn oeiat sDeanmp u)tetnmr oadlpD  uei s0texmirpiydlm  lfes tf Dtm(m ;o1aetnmociatlm2rluvo t0tlermo iatoaD anvsl() euo(r3ou4ll e nctlt s2umxmo;u1ale mocils a2emnmpnu0aetrmr iadlp rauvol()trumxopnudapenmfcta(f 2rmxro;u4aeen f3tldls em( s t0texnifcia1omD aneslt) exmxo3io4op emiesatf Dtrumonu4oeto f3tys a2um(mo;(4 lxnif iytlaDeaivi s)teumxm nudopt lnvtlsfartru  oo4tet  fciyslm2el(ms u4 exoir3ta1fmDean sl( t2tr(m io1optn ieiasfaDtrxmpoo4opt  f3ilsfm ra(ms t)arxnmo iatfpt aneo (  euoxo3oo1ome lnvs tfaDua(rp;u1ope mo3iltlsDemn o;t4aetomf tadom e i i;s)setr(r3oy4alt mncsl(f 2trxmp;u4teeo fetat s2uln o;t)trenxrcoadoa e nvo;s)trtmxo3oy4amtemfvt s) Dua(moou0opx micild mDelumonu4trxrir3totfa ran o t  2xoxr3oo4amt  nvs t srrm(  nt4olxo ociadfs2elu p;()trtoir iy1oaD lnvi t)t2trxr3iydolee ictatf 2taxr ou1tptn i3tad sDra(vp;u0 rerxrcty1la   ieil(0 2uo(mpiydlpe lnvtatfs2rmuro;t4oeen iciatfs2rauvs;u4 rxoif ta1omtr nvol(  eto(r3oo4opt mnvilt a2trump;u1optnmf3tasfa el(mon(0aeerir3iodomD anei;t trum(r nodll elnesl() rrru p;u0alt moeiysfmDem(mont4trxnxo3iytlptr u i;s s2xrxrpnu1alenmneslsf ruaxmpoo4tex mo3ild mDrmnvsn(0tltoxr3oatopD aivils0trtm(rpnudll e ici s artmuroou4opt mo3tld a ulnmp (0 lermf3oo1oaD  nesl()sexo(o iudap e net tfs2taxront1tet mf3tyslmDrluvo;(4 reriociotop ranvi;(0 ruoir nydoptemivtat)a2rm(  ;t1oetnmictytls2rl(vont0altrif3iotlm  liei s) eumiopnudll elfctls sDtr(  no0olenifctlt a rauvp;(4altnxrcty1la  luvo t)t2tr(m3oo4aptnlietl() rtmu ooo4opxomo3iyd a2uanvp t4artrmf3ty1op  livi;t  2uoiopoo4opt  iciatfarum(moou1apx ioetat aDrlnms u) exnxrciy1lpDeauei ( srxo(r io4lpeemneilsf rra( p;o1tpeomfciad s2rl(mo (4aetrmrcoa1faDe u s s)trtrio3oydlleelfeslt)arrr(rp;t4tltoii3iat a2ra(vp t4 rtomr to1oaDe u s;()srtmiopiu1ol  mnes t  2rmu p;t0aptnifcildfm em( p t0aleomfctodlaDe nes t)t2xm(mpiydap elfei t) ruaump;t1oet  f3tld m2ranmo t0 etrxr3iodfmDr i s;t)trtrirpnu1ll nlnvilsfs2umu  ot0aeeoiociytfs2ua(ms u4trxnmr3tytlpDrln i;s)trtmir3nodolt mfeiasf Dtm(rpot1tet mi3iyslsDuauvonu4tltrmo oadoaDelnvslt)t2urxr iy1apenlfctat) 2ta(rp;u4opxniieiyt s umnmont4tleoir iodoaD an ils)sexm(r3nudomtelivi ( a2rm(r ;t1tlxo f3iadlsDel(vonu4alxoxo oa1fm eaivo s  rurimpiy4aptemfciat s2ra(mpoo4aptnmociadfm em( p t4tetrmf ia1fp  li s t  2um(mpio1oltn iet (fa2raurpnu1ape io3tydla rmu sn(0artnifciydlat auei ( setrir nu1ope mfet (f rumur ot4opt mfeiyslm uluvs;(4 lxrxf oydfat aueils)sruoxo3ou4opt mfvtas)s2uaumoou0tpx mfeiysfs em(vo (0 ltoir ootfm eanvs ( t2umio ou1aptn feils  rtau p;t0tleoifeilsls2uan onu0 rxoio3oytopD lies;t) ruoiopou1apeelfct () Dumumono4olt miciltlaDemnmo;u0alxnxo tydoaDrlnesl(0teumir3nu4op n fvs s srrmumooo1ole  oeiltlmDuluvs ()aexoxf3tadfpDran i;t srur(o nu4optnlnetls a2rmx pnt0apeoioctlsla2uln o;u4 eenio iy1opt au s s trxr(r3io4lltelicsat sDrr( o;o1aptnmoetlsls ea( p;t4altniociydfmteaivi s0 exm(m ny1ope  fes t s2rrx pnu1apeoio3ildlmDrluvs t0 ltrmo3iydfm rluvs s)setmirpoydomen icta()srrrxroou1tet mfctyd s em(mo;t0aeenif3iadfmDe neo (  rtr(mpoudam elneil()srumxroou0oleomo3tydfs emnvon(4trermf3io1lpt aivsls)s2tm(r nu4om nlfvsl(fsDtrur ou1tet mfctyd aDea(vp;u0 etomo3totfptr ies s0 rurxopou4lm nmivtl()arur(rp;t0tptn ietyt m2eln s;t4 lermf3oy1opD luei;s t2tr(r iy1omee ncilt arrmxr oo1oeeomfctlt aDemnvs;t)alxnif oatomDeaneslt t2xrxmpiydamte fvi s srrm(moot1tpt ifeild s2eluvpnu4alxnio ta1opDr ivs;s  rurim ou1ole liet s s2tauro;u4aeeoioeiydla rmn o;()trxrxrcoadlmDean i;t  euo(m oudop  mfci s s2trx onu4ole iietls a rluvp t0 lerifctotfmtraivi;s0 rtrxrpnu1lmte netatf ruax  ;u0alx mf3taslsDrlnmp;t4artomo3oa1laD  uvs (0 rxm(mpou4ll elfctltfartax oot0altomf3iltfs el(vsnu)artoxo tatomt aieo ()setmxr3oudol  mfvtl( a2raxmono4ape  ietldla umn o;(4arenxo ta1fmD auei;s seur(o ou4ome  fvtlsfa2rau  oo0optomoeildlsDrl(mp t0trenmrciytomtraies;t0s2urxopnu4om nlivs () 2rax p;t0tee ii3ils a2el(vp;t4 rermf3iodop   ies;t) rur(m iydal e fvil(fsDum(mpot4olx ifeiatfm2ra(vs u0teeoiociydfmtr u sls0t2tmio3iy1ap   netlt  rurxmpou1aptomieilslaDumumo;t) exrxfcoadfa rln ilt0s2uoir3oy4lp n fesl(farum(ro;o0tex  f3tltfmDemumo;(0 eenmo tytoaD au s t srtrir nu4alt mfvt s)sDuaurpnu4aexomi3iltfa2el(vonu4 rtrxr3oytop elivi;t trtoim3nudaltelncs (  Dtr(rp;t0alxnmf3iltfm rauvon() etoif3oa1lpDelnei t) rxo(m iudalenlictat srrr( o;o1apt  f3iltfm2rm( o;t4tlxomo iadopDe nvi s0seuo(rpno1optn nvtl()aDra( poo0opt ioeiltfs2ranvonu4treoir oydomDrauvo s0t2xmirpiy4optnmfvtls) 2tru pot1teen fctldfsDulumo u)arxrir oy1lptelues;(0tetoxr3oo4lpeelivi tfsrrmurooo4ale  ociydlm em(vs t0 eenxocia1lpte u s;s0 exriopou4llt mfct ( aDtrxmpot4aetoii3iat m2rlnvo (0artrxo oa1lmDrau s;( texm(rpoy4altnlict (  Drrumono0oetn i3iytfs2um(mp;t0 etoxo3todlp  an s;(  rtoir3ou4alen nct (fa2rmx  ;o4aex  ictlsla2ranmpn(4alenmfciotoat aivsl(  2xr(opiy4al n nci sfa2tmxrpou0tpt  f3iasfa elnmonu)texnmrciodfatr n s;s)sexmxmpio1ale  ics sf rum(rp;u4texnmicild aDelnmo t4trermrciy1oate nesls)trxrxrpnu4alt lnes sfsDtrurp;t0tptoioeiyt m rmu onu4texoio3oodfp eln i;t teuoxo3iodlpe mfei ()aDurumoou1oeen ocilsls emnvp u0aetoxo oytopD aies (  rumio3nu4om nlfcsltf Duax onu4aetnifeiadfs2ul(ms;u)teeoxo3iatlm eaivs;t teurim iu1ap   icil(fa2rax o;o1teto feiat aDea(mp;()aexnio3tytomt aueols0 rurir iodlpt mics (  Dtmxr ;u4alxoifcils sDemn p (4 rxnmrcty1oa   nes t0 exmxrpno1al eliei ( s2rrx  oo4aet io3ildlaDran o () etoir oydlmtr u slt  eumiopny1ol e nvtatfartmxm ou4oltomo3iytlsDuauvsnu4tetoxocto1omD  uvsl()t2xrxmpoodam  micia()srum(mpou0ale iietltfm ranvsnt0texrmr iatfmDeaueo;(0trxrio3no4olt  ieiat) 2umxrpnu1oltomoetasla2emuvo (0teenmrctydlatelnei t0srto(r3nudamte icsl(fs2ta(r ot1aetomoeias a2uln o;u0 reoif3oo1lptrlneols teto(m3no1ap   fvs ()sDtaurpoo4oleomf3ildfsDuanvo;()trtoifciytfp  aiei;t0 2xr(m io4optn fcia() rum(moot0oleomf3iaslm2ea(msn(4 leoxrcoo1fm eai s t) 2ur(o no1omte fetltfsDtrxr ou1tetnmfetlt a2rlnms;u)altrmf3ta1faDe n i;()t2uoxm ou1lptn iesltfsrtrxrpno0aleo oetasfmDrm( s;()aetnmr oo1latrlnes;s texr(m3iu1lle mnvias sDtrxrpnu1tlt  feilsfa ua( p ()aeeoir iy1la r nvols srtm(rpny1omt mivils)srrmx poo4tex mfeild s eluvonu) leoir3oo1fa rli sls)sexo(mpoudapeemivsl()a2tax p;o1tpeo o3iatfmDemu p u4tlermo oytlat  n olt srxo(o no1altnmnvs (fa2tm(m oo0tlxnmictyd mDul( p;u0areoxf oo1opD  ieol( srurim3nodlm nlfesls arrmxrp;o4aet mocils sDrmn s (4 ltrmo3oa1fa   ueo;t0 euoio iy1ll e fcsa() 2ua(ro;o0optomoeiytlm rmums u0trermo oy1lmtr ues;() exoxm oy1op nmnvtat)sDtr(mpno0aeenmfciatls eanvsnu0arenxr3iadfm elneils)s2toxo3io4lmtemfesls  2raxroot4ape mi3ild m2rmnms;u4tlxrifcoydfmtelivi;( teurio oo1lm n icilsf 2raxmoou4opt  ieiltfs2eaums;t0teermo ty1lptrlnvs () 2to(o3oodamt mfcsl() 2uaxmp;o0alx mociytfaDrauvo (0arxrxo3tydlm r ieilt0setr(m oy4lpe mnct tf Dtmu  ot1texoio3tadfs elnvs u4 lenir iadfmteln o;t0 2xrxm nu1lmtelnvsasfarrrxm no0tlt  o3ild mDrlnmpn(4 exoif iatfm  lnei;s)teumir nydllte fet t sDta(moou0tltomoeiadfa2ean s u4aexoif io1op eluvi;t truoxo3ny4omtnliesas srtr(ro;o4aexnifctlsla uanms;(0aetrmo3oodfaD aneo s t2tmir nydll nliei () 2tmxrpnu1apx  octlt m2ulnvo ()alenxo oa1lmte neol()srxoxr oo4ameelfei t)s2trx oot0apxn feiat aDemumont0tlxnmf3io1oateli o ()tetmxopoy1lme  ivilt)aDtaxrpnu4apeoio3tys m rl(mo;u4tlxomf3tytoptrauvs;t srxmxr nodlp n ivt sf 2umur ;o0tee  ietysfa2rmu p;(4 exrxfcta1oaDrli i s texrim nodlltnlivtasfsDra(mpnu0oet mo3ild m emnmsn(4 exrxociydoaDe nvil( srto(r ny1altnlnvtl() rtaurp;o1aexo i3tas sDea(von(4 rtoxo oatlaDe iei;s  2xrxr3nu1amtnlfeils)artm( ono4tpx iociysfsDul( onu4 exoxocoodomDeaneo s)trum(opoydopen nctlt) rtm(mont4apeomictyslsDuln s t0trtomr oodop e i s;( trtm(m iu4lltelivi s aDua(rp;t4oltoiietysla umu s;(4 etrir tydopD  neols0texmxr3iu4aleemfct tfsDraxm nu4apeomo3ilsfm2ranvp;(4 rtoxocoytfmDraivs ( trxm(m oy1apenmietatf 2taxmooo0alen octyslaDua(vo u0trxrxr ta1omD lnvs;t)trumxmpny4lp  mnetatfsrtaxr ou4tptomieiasfs em(mpnt0aeeoxo3iytlmDeauvs;t0s2uoio3iu4altemfet tfartmxm oo1tee  ociltlmDrm(vont)tleoir3oytlm   ivs;t  exoxopoydom   icils s2ur(mpnt0apxnmo3iadfa2rau o;(4teermr3tytfpDr ivs (0srumxm iydlmtelfct t)a2ta(m nu4alen octltfs ean o t0texrio3todopteai o;(0 exmio oo4ap   nviat s2trurono0apx mieild s2ul(mp t0 eeomo iydomtrlies;t)s2xrio iudom elics s) rumu oot4olx io3taslm2rlnvsnu0tltnircoytop ranvi t) 2xrxo iy4optnmivtltfsDua( pnu4opeomfetydfaDem(vp;t4trxoxr oo1omDrauvs t)srumxo oo4apeemivt sfarrax ono1aex  ieils sDelump;t4alerir totlm raiei s)s2tmxrpoo4om e fctat srrr(mo;t4oet  o3iysfs2rmn o;()treomf3iy1fm eauvi;()s2um(m oodamenlivsasf 2tm(mpnu0tptoiiciadfs2ra( o t4 lxrmrcoydop   nes t0setoxr3iu4lptn fvtl(fsrur(rpoo1aee mocilsfs2ea( p;()tlermrcoo1fate n ilt seuoxopoudap elicsatfsrur(  ;t4optniiciat s uan onu)tltnxf oodoptean sl()srumir3iodal nmicilsfa2ur(r oo0oexo icildla2uaump;t4 rermfcty1fateaneils) 2xoxo no4lpenlics s a2rmx oou1tptomfetlsfa emums;t4arerxocoadoaDrauei (0tetoimpny1al   fci t  2rrur nu0optnifcilsls2rm( sn()areoxo iy1lat  ivi;s0srtm(mpiy1ap nmfcslsfaDtrx o;t4apenmfeiatfa2rlu o t4texomr3iytoaDe i i (0seuoim oy4optelivilt  Dum(m ot1opx  fciytls2umuvp;t) ltoxf iatlmD au o;t0srxmir io1olt lics () Draxrp;u1teenio3ilslsDra( snu0teeomf3oodfp  luvols) rtr(o io1lmtnmfvils)a2ta(  ;o1tpe  ieiasfa um(vp u)artoifcoy1laDrlu i t)srxo(rpoo4opt mies tf Dumumpnu4oltnmf3iyslm2umuvont0texrmfctotlpt auvi;s tetrxr iy1amte net s s2trum nu1tex moeiadlaDrm(mp u)teermr3iadop ean s s  rxr(r3ny1olee fvsl()s2umxm nt4tleoiieiatla umump;u4teerif3ia1fmDr ies ( srurxr3ny1lltnmncil( s2rrxronu4tltomi3tysfsDumnvo;u0 ltrir io1lm eau slt  rumxm3nudlptemieiat  Dtru o;o4opx  fciytla rm(von(0tltomocto1fm  livi;s tetoir3oo4aptemfvs sfartrur oo4aetomicildfsDuauvo () ltnif3oydfp eauvs s) etr(o iydop   fcia( aruaxro;t4apt  ietat a emn s t)aeeoiocoatoa eaueo;s)teum(m3iydlmen fci (faDur(mo;o1optoiocildlaDum(mp u4trxnxf3oatlp rlu o;(0srumxo oodamtnmivtltf 2rm(rpou1altnif3iaslm rluvs (0 lermrciodfaD luvsls)trxo(mpou1ap  lfci tf Drmxm ot4opxn oeiys a rmn o u)teeomr iydfatr u s;(0seurxmpiu4lp nmnctat)sDrrxrooo0open ociadfmDrlu p;(4tltomfctytlaDr ieo;s teuo(rpno1alte fct s)aDra(m ;u0oexn ieiys s ul(mo u4aexriociydoaD  uvolt)s2uo(r3nudomtn icsls) Duaxront4olxnmicildfs2em(vonu0tleoxr oydfpDranei;()teto(o3oudll n nvsat)a2ur( oot0tlxnmo3iatfaDeanvs u0alxnif3io1fa   uvi s)teuoio iu1apenmfet (f rtmu  nt4ole mfcils s2ua(mp (0aleoxo3io1laD anvo;t)s2tmxmpoy4lmenmfes t aDtmxm oo0tpx iictys m em(vs u0tlenirctadoa rauvs;(  2toxr3nu1lp nmnvtltfarrmu  oo4tle iietyt sDel(vo t4 rxnmo3iodop  au sl(0texrimpiudlmenlncs ( s2umur ;t4olxo ieiyd s elu on() exrxrciy1fmDeanvils)tetrim oo1opt mfvsa()srurxm ;o1aexnifciatlsDul( pn(0 lxoir3oytlpDe iei;s) rumio iy1opee fesa(  rurx ont4altn i3tad s2rl(vo (4tleomoctotlmt  uesl(0s2um(m3no1om  lnvt t)sruax o;o4apxomoeiysfsDrmn p;() rxrmfcoytfm eau o;()teumxrpio4apen ivt (f 2um(rp;t0aetn fetas m2rm( p u0 rermrcoa1omD auvs ( t2xoio3iy4om nmivtas a2trxmpoo4tltnifctld s uauvpn(0 eermo3ta1fm eln s s0 rtmim iy4am nlfvil(faDrr(m oo4optn iciatla ul(mp;u)tetnxf3tytfmtraueols sexo(r iudap eliesl(fs2rmx pnu1tex moctlsfm ua( o t0areniocio1fm  aneo;t)teto(r oodlp n fet t)a2ra(m no0aee  o3iysfs2eauvp ()artoif iatlptr ivs t0s2uoiopiydale  nvsasfsrrr(mono0tlxniieiatla eanmpnu)tltrmr ia1lat  ieo;s0srtm(r ny1al   iviat srrauro;u1oexo feils m2ul( o;t0arenmo3iodomt lnes;s) 2urimpiu4lm n net sfsrtm(  nu4alx mo3ildfm2emnvp (4 reoxocootomteauvo;t0 euoimpiydal n nvtl( aDtau p;o1aleo f3iasfaDra(mo;()alxrmf3tydopt aivi s0truoimpno1lpeelfeta(f rraumo;u0aexoifeilsla rm( onu0trtoir3iydfaDraueo;s tetrir ou4oleemnviat sDurx  ou1opxo octas mDra(von(0 eeomr3tatopD  i slt0 exoxo iodol emfvils sDrrxmoot0oet  ieiytlmDrmumpnu0aleoif3iytlat lueols0 exrimpiydlptnlfct s srum(rpot4apxomiciydls uau o;u4alxoxf3totlm   iei t srxmxopnydapee fesasfaDraxrono0oetn ietys m um( o;(0arxnmo3tytfm eauvi;( texo(r3ny4lmt mnctas) 2rau p;u0altn f3ild mDelu o t0teeoxo3tatfpD aivils0 exmio io4optnmfetatf rta(mpoo1aetnif3iytfs2rm(vp;t) rxrif3tatoptrlu ils  2xmxopnudlpt mfcslsfsDrmu p;t0apt  ociltfm2rluvonu4trtnif ty1omteluei;t) 2xoio iy4ol n fctat)sDumu  ;o1aetomiciasfs2rlnmpnt) rerir oytlm r i o;s s2xmir ou4opt mfci t) Drmu o;t1opxo ietytlm umnms t0tlenmocoodlpD au s t0t2xm(r nydlp emnctlt)aruaumo;o1oleo f3iadfs2rlu o (4arxnmrcoytfmDeanvs;s0 2xoimpny1ol n nvsat  2tmx o;u0tetnifciaslm2ea( p;u0 rtnmo oadlp e nes;t0trtr(o io1opt mfvs t sDraum ;t4apenifetytlsDulnms u)tetrif3oatfp  aieilt  etrxrpoydllte nes t aDurxmpnu4aet  ictys aDul(vp (0texoxrciotop  anes (0setmiopiu4llt  iesat) Drmu o;o0altomiciydfs uaumpn(4tetrmociodlm eauvsl()trtr(opoy1ll e ivs ()s2raurpoo0aee  fetat a rmums;()texoxr oo1fp eauvs;s) rxrxmpny1al emiesat)aDraumpno1ale iocildfa2elnmo (0texrxf ta1lpD  nei;s0srumxr3no1lm   nvt s aDumur oo1alxnmf3tys a2umn ont) eeoxo oodopt auvs;t s2umxopno1omt  ics () 2raumpno1tpt iociat s uan s;() renmr3iotlaD  ueolt)trumim ny1lp e ncsatfsDua( onu1opxnif3ild mDrau sn() etrmo iodlmte uvi t0sexr(opoydolt  nvt s a2ua(rp;u4alx mfciatls ranvs (0alxrmr3iatlaDrluei (0s2tmiopoy1llenlfvi sfsDtaumo;t4oex iociydfm2eanvo;t)alxoxr iatfa rlueo t seuoxm ou1lpe mncia() 2tmxmpoo0optomi3tytlm em(msn()texomf tadomDr nvs (0 2triopou1lmenlncs sfaDrmx pot1apenmf3ils mDel(mp ()aeeoio iotfat  u o t0 2uoxm oo4llt lneslsfarraxmoou4aetn ociydfmDra( snu)arxrif3tytfmteaneslt)s2xoim3oo4ap n net ()aDtaxro;t4tet  feiysfa2umnmo t) eenmr3oodoa rli il()trxmxm3oy4am   nvt s a2umx oot4apenmo3iad m rmnvonu)tlenir3todoateau i s0truo(o ny4lltnlfcs ()sDtrxm ;o1tptoioetatfm ran sn(0tetnxfciadoaD ln i;t  etoir oo4ll emfetl(  rum(moot1olx ii3tysfm em( p u)aeenio tadopt  ieolt0seumxrpiydalenlfeils  2raumpnt1opxnmiciltfmDua(vo t0 ltoxo3iydfmtrai s t trxr(o no4am emivs sfsrraxrpno0olxnifeiasla el( ont4texoxociy1fmte i s;s) eto(opnu4am e fcs tfarrmx ooo1texomfetlt s rlu p (4tltnxrciydfatr nesls  2urxr3oudlm elnes tfartm(rp;u4aexnmo3iyt a2um(vs u4 exnio3tydopD an i;s0seto(r3nu1ome mfeil( aruaumonu1aeeomietat a2ulu s;t0aeenio oadlaDeln i;() rxmxr3io1omte neiat srrm(m ;u4tptoifeilt sDuanvs ()aleomo ta1faDeauvo t0sruoio3ny1al   ivils  2rrxrpno4tptn o3iys a umn p u4aetoxr3iotfa e ivils0s2trxrpnudopee feta(  2rau o;u0alxomf3tls mDumums t)aetrmo3iytfmDr ivi;t srxmxr oydlp e ictlt)s2tm(m ot0oeeomfciydfa el( sn(0trxrio3oatlptelivi;s0t2to(r3iu1op e nei sfsDta(mpnu0oeto i3tldlm2ulums;(4arxrifcoytfmDrlies t)srurxmpiodlme  ivtltfa2rmuroou1apeo fciytlm ranvpnu0altoifctytfmDranvils) eurir3oydolen ivtl(fs2tru  no0aee iictldfs2uln s;t0 rxnmoctodomt  uvi;t)trxr(m iy1ol nlfetlt)aDumxmoot4apxnifeiytlaDra( p (0tetrxf3iotla rli il()tetoxrpno4lmenmfvia( s2tmu  ;t4altoioctat s emn snu0alxomr oodomteln s ()s2um(m3nodaltnmfeta( sDtmum ;t4oet ifctlslsDrlnmp t)altrifctodomDe neolt0 ruoir ou1lm n nvsltfs2tmxmpot1optoifeils a ranmpnu4 reoir ty1faDeliesls  2uoim3iu1alte ncia(fa2trxmo;t0alxn ieiltlsDem(mp;(0 exnxfciy1laDeau olt0t2xo(rpiy4al nmnctasf rurxm nt4olxomo3tatla rmn p;(0altoif3iodfa e nvils t2urio io1omtn ivs ()s2ta(  oo1texnmf3tas mDelums;u0arerircoo1latr ivi;t)sexm(m3oydopt lnvtasf rua(rpot0tpt ioeiadla em( p u)tltrio oadla r ues;s0 etrxmpoo1om e fvtas a2ururont4tlxo ociysls2el(vp (0 leoif3oydopt aies;t)s2trxr3ny4om  liciat  Dtm(  ;t0open ieias a el(vsnu4treoiocty1opteanes ()srumiopoydaleelnvtat) rtmurpno4tlxnmf3iadlm2ulnvs u0 rtrmf ia1lmD auvs t0s2tm(m oo1om emfcsas  Dum(monu0tpe mfciltfa2emnvsnt0tleoxocoy1fate iei t)s2xmio iy1olte nct ()artrxr no0olt mi3ias aDumn pnt)trxomociy1lm eau olt0sexmio ou4am elfvi sfaDuaurono0tptnmietydfa ranmpnt)artnxf3tydopt anvils0 eum(rpno4lle lfei s)aDtaurono0olx iietytfm el(mont0tlxnmrctytop rln i t trto(mpnydomt  fcta(fs2ua(rpnt1tlt mfcildlaDelnvs;(0aexnir3iy1oaDrlu olt)srur(o oy4lptemfes tf 2tmump;u1optn ociltfs rmumpn() rxnxf tadoaD livi ()tetoxo3ny4lmen fet t)a2truro;u1aptoifeilsfm rl(mon(4tleoircoy1oaDr uvsls)srtm(opoy1ol emfcsa(fsrurx pnt0tetnmieiltfm ranvs;u4 rtrmr3oodlaD  u ilt  etmio3nydop  lnvsas)srraxmo;o0tex  fciyslm ea( p u4areomr io1fm r i o;t tetoxm oo1ll elnvtl(fsrrr(roou0oexomo3iydfsDuanvpnt4aleomr3tytoa rln i s0 ruoim oy4lltn netasf 2ta(r nt4tlxn fctld a eaums t4aeenirciytlatr u s;t  eurio io4op emivt ()aDrmxmp;u4olt moeilsfa rl( o;(0aetnmoctydfa eaueols0 rxm(m3oydomen feiasfsrrmu  ot1oex  f3tydlmDemnmp u)aeenifciadop r ivslt0t2xoxrpiy4lme mfei t)a2trxroot4altomi3iltfs ra(mo t) rtnmr3todla ran o (  etrimpnu1amt  neslt arrax onu4opeoiictad m rmnmp t0alxnxo oadomtranvils  exoim3iy1ap e ietat)aDuauroou1tpe iocilslmDuanmp u) renif3tytom  ln s t)sexrxm nodlm nlneil(farra( p;o0apt mfciadla2rluvp u4 renif3tatopDeau o (0s2toxr3oo1am nlivias)srua(r nu1aetomf3iytlm2emnmpnu4artnif to1fmD  neilt)trxmir oodapenlivi s)srrrx o;u0ape ifetyt m umuvs;t4trxoifciydfpt  ivo s)s2xr(m oo4ape lfet ( aDtru pot0tle mieiytlmDelumsn(0 ltoxr3ia1lmt  uvols0texm(mpou1oltnlnet t)a2tr(rpno4oee if3tltls2uanmonu0 etrmrctadlm  ai ols  2xm(m3oudomeelieias srra(  nt0tpxn ieiyt a um(vo;t4texrirciotoa e nes s0setrirpnydamenmies t)s2urxm ou4tpeomi3iltfsDea( s;u0 leomo ta1fpte ueols)trxoir3iy1omeemfvsls) 2ta( o;t4oee  ieiyslm emums;u)alxrxf tadoat lu il( s2ur(o no1lltelies t)a2umxr nu4apxnmieiadlm2em(ms;t0 etnxo ootoateli ilt0s2uoim3nudaltnmnesatfaruaurp;t1tpt  oeiad s rlumsn(0 ltnir3tadlpDr iesl() rxmir3no1omenlfcs tfaDtmu  nu0ole  ictltfs2rluvo u0aleoircoo1opt auvsls0 2uoim3no1al e ivsa() rumu ooo0oeeo ociltlaDem(mo;t0trtomo3oy1lmDrai i t0t2tmir3nudap n fesat a2ua(rpot1tlenii3iat s eanvp;u0arerirctotfm elnvslt  euoim oydope mfct (fsDtmxro;t1alxo oeiysls2rlumsnt0altoxrciy1la elnvils)texmirpnu1oleemneslt) 2raxr no1olx mieilsfsDrm( p;u4trenmr oydopDe n o;( truo(opny1ap n fcs s s2uaumoou1alx  o3iadlm emn p;t0 rermr io1fat lnvs s) 2trimpoo1ope lfeias) 2uau  ot4tpeomfeiysfs2elump u0trerxf iy1oa r u olt seto(m ou1lptemnvtls)sruau oot1opx io3tatlm ul(vp;(0arenio3iadoaD lu i t0tetr(m oy4lltelnct sf rrm( pno4apeo ociat a2rlnvs ()texoif oytfa rauei ()trtmxm oodll e nctas arta(r no0tpxn feiatls emuvo t4texnxf oydfm r ivi;s  rtrio3ny4amenmfcia( sDrmxmpnt4olxn i3ils aDemumpnt)trenio iydfmDr i o s0t2xmio oodape liesa(  Drrxr oo1tlx moctasfm2em(vp t0artnxrciadoptrluvsls  2tm(o oo1op n feslt a2ta(mp;u4tpeo o3iyd sDeanmo;u0 eerircoa1optelu s;t0s2tmirpoy1ale mfcsas)s2tr(  ot1tltoif3iadfa ulu pnt0 ltoxrcia1faD livo (0 rxrxopnu4omtnmicta()a2rru pno1apxomictysfsDumumsnu0arxoxoctodla raueo;t0 eto(r3iudomenmfvt ()sDraxmp;o4olt mfeiytls2elnvp;()tlxoxocoytfp r ieil( t2um(opoy1llt licilt) rur(mpoo4tlt  i3iasls ul( p t)arenxr3to1fpte neols) 2tr(m oo4op n icsls s2um(r ot0tptn fciydlsDrmn sn(4 etoiociy1opDe nvslt) eumirpiu4lmeelfct t) 2ur(r ;o1tlt  fetyt m em(vpnu)artoxo iodlpD aivi;s0seuoxmpnydomen nvs s) 2raxmpnu4aexn ietasfm ea(msn()texrmfcoy1lm  lu o;s  rxoir ou4apenlnvil() Drrxm ou4texnif3iysfm elnms u0aeeoif3iotfm   ivo t)s2urxo oy1ome  ieil(fs2rrur ot0tetnmoeiysfm uluvont4trxnmo ootlp   ieils0srtmim nydom e iesl(fsDuaum ;u4tleomfetas m ul( pnt0trxoio3tytfmDeanes t  2toxmpio4aptn ictat a2taxroou1tpeo fetydlsDrau p (0artomf oydfaDeaueols)srtmirpno4lm elnes t  Dum(m nt4tlxnmociad a um( p;t4trxrio tydlmtrlu o;()seumxopoudapenmnctat srtaurono0tpt  o3ilsfs emnvo u)artnmr3oytlp eanes s0 rtrio oodlp elivsa(f 2rm(m no1aex mieiat m eluvon()aeerir3ty1faDe iesl() euoxo3iu1ol nlfeils a2rm( p;t1apt  ociydfm2umnvo;(4 lenmr ty1lpD  uvils)s2xmxm ny1ol e nvta()sDum(rpnt1tlenmocias sDelu ont) lxoircoodfpDraieo s0s2xm(r3oy4ole  netat sDrm(ro;u0olx  oetltlmDrl( pnt)trtnio3todfmDe uesls  exrim iydlm elivtl( aDrmxm nt4oet mo3tysfsDeaums () rtnir3tatlateanvi s  2xmxrpiu1lmtnlietlt)a2tr(m nu4oleoifetatla em(mp;() lxnxf oytoaD ai o s0s2umir oudom n iei ( srua(r ou4apxoioeiat a em( o;t0aetrmr oytlaDelivs;t  rtm(r3oydole mies t) rrmxrpou4altoioctydfmDelnmp;(4aeeoxo3oa1fmDeluvo (  2toxo iu4optnmfvt t  Drrum ;u0tleomfciytfs2el(mp;t)areoifcoatla  anvils)t2ur(o3iy1apenmfvils)s2uru  no1olxoifciad mDrmnvp t4teerxf3tatfaDean sls)t2uo(rpio4ol e nvsl(fartm(mooo0tee  ictyd s rm(mpnt4alxrir3iotfa rai s;t)s2umiopiu4lmte fci tfsDrmxmooo0opxn f3iysfm2rmnmont4aleoxo iatfaDe n s () rxrim oy1lp n fvt t)a2taump;t0tlxo ociltfa2rl(vont4 eerircoatopt ln o;t)t2tmiopno4altn fes (fs2tax ono1alxomfeiys s el(mp (4aexomr3oo1oa  au s;t)t2trxr iudalte ncsl(fsDtrurpoo0tlenmo3tydls2ul(vp;u0 exrmf3oatoat  n s;t) 2tm(m3iu1lme  ieiltfsDurumooo4apxomoctltfaDumn p;(0arxomr oy1opDranvil() 2xrir3iydlltemncsat aDua(  nu4altomocild m uauvs ()altnio ta1fatr nvs;s)srurxm io4lltnlfeta(fs2rrx  oo4tpxn ociyd a umuvsn(4alenir iotomt livo;s  euoir oy1aleemnctls) 2rr( o;t1oexomfctldlm2emnvo;t)aeeoxo3totfmte iei;(0 rtr(o3iodll emncs () 2uaum ;u0olxnmi3ild m ulnvo u0tetnmf3iotoaD lu sl(0seuo(rpnudlmtelicils)a2trx pot0tptomoeiatfa2um( s (0 eeoir3iodoaDe uei;s0srxrio3oy4lp elnvtatfartmurooo0texnmiciydla rm(mo ()texnmf3tadomt  u i;s)trtrimpiodoptn nctlt)s2uauronu0oetn i3ilsfm em(mp u4texoxfcoodomDe nvo (  exm(r3iu1apeemiei (fsDuauronu4aexo f3iydfs2elumsnt4 exriociodlmtr uvi s0s2uoirpio4lmenmncsa(faruaumpnu1tltnifeiad sDemnvsn() ltrxrcta1op e neo;s  2xoiopio1am n icils) 2ur(m nt1apt  ictasfs2rlnvs u4artrxrcia1lp eai s t srurxr3io4omt lfetl(f rtrxmo;u0tpenmfctydlm2uanvs t)texrxr3totomt  nvols0seto(mpoydom  miet ( s2taxr nt1alxn iciadfsDuanvs t4tetnxfcto1lm eln sls sexo(mpio1omte icils artrx pno1alx mi3tat mDranms;t0tlxoxf3iotlmD livols  2xmxo3iydlm  mivt t) 2trumont0opxnmictyt m ulnms;(0areomr3totfp e uvs s0tetmxopoo1ape mfvs s srrr(m oo4aet  fetltfmDea(ms;t0 rxrio tatomt  ivi (0t2ur(mpoudomtelnvt s  2rrx  nu0teeoiieiatfmDrl(monu)aexrxo io1opD aivo;( t2uo(mpnu4omtnlivils) 2tm(r ot4oltniietltfa uau on() reoxf ia1lmtranei s) rtmio3iudoltnmieta( a2uru pnu0alx mfeils s2ul( o;t0 eerifctotoa raivs;(  exrim nu4lm e fci t  Dua(rpnt1opt ifetadlm em(vo u)tlxnircty1fate u o;s  exm(m3oo1altnlnesa(  Dtm(mont1ope  ieiadfs2rmn p;t)tlxrmf oodlpD  uvi;t)srxmiopnu1lle  icsls)sDtaxm nt4olx  icilt a ran onu)altomr3ty1fpD  nvs () 2to(o nodameemncias)a2rmx pnt0teto feiys s eanvp;() lerxo3iotom e uvi s) exoio3iu4llt mieslt)sDra(mpno4oeeo oeilt mDem( o (0tlxrmo3oatlmte n i;(0setmxm3no1lle mneia( aDum(  oo0tptnmf3tld m emn s u)texrio oadfa rauei;(0s2tm(rpiu4altnlictls aruru p;t4tpenio3ilsls2emu p (0aetnir3iodlpDrlu s;(0trxo(m3io1oltemneta( sDrax o;u0alxomo3tatla eaump (4 lxrio3iytoaD lueilt0truo(mpnydlm eliesa() Dtr(rpno1opxn f3iadls2ean onu)arenmocoo1lpteauesl( t2trir oodapeemnvsa( arurxrpou0tleoiieiltfaDeanmpn(0aexnifcoytla eanvi;() 2xrxmpoudolte nvt t artax oot4texomi3iydfa2ua( o (0alenxo3oodfp raueilt0seuo(rpnodlptemieia()srtr(mont4tle  ociatla2ean o t0trtnmfcootomtranes;t0sruoxrpny4lp   ieslt)arrrumooo1ale  oeild m2uaumo;() rxoif3tytom eanvils0 exmir3iu1lmee fetl(fa2rmum ;o0opx if3iytfa ua(mpnt0 lxrir3to1fa   u ilt)t2tmxm no1ol   fctls)arrru p;o0aex moeiyt mDrauvp;t) etoiocto1fm e ivilt0 2urimpnodol elietas)aDtr(rpnu0tleomo3tyt sDrln p;u) ltnio oy1fp eliei s trxr(rpnu1ap e feta(f rurumono0altoiictyd mDra( o (0tlermr3oy1fptelnvils)trurxr3iu4opeemfvtas) rrmxmoou1tpeoif3tydlsDrm( o t0 etoif iytla   ieils0t2tm(mpiydope mnvias)a2tr(  ;u1olenioctadfa ulumpnu0 exrxocoa1opDrluvs (  eto(opno1lm elncs tf rrauro;o1aexomieilsls el(vo t) eerifcoatoat livo (0 rurxrpnu4om n nvi ( aDum(m ;t0ape iociys a2uluvp;u) exnio3iatfp e n ils)trxoir oo4aptelicsa( sDtmu pot0oeto oeiyd s eluvont)tetrmo3io1fpDe nvolt0s2umim3no1omt  fes ()a2ra(r no1tle  fciatfsDranmonu0 ltnmf3io1lm raivi t0t2xm(m oydom nmnvs sfarumump;o1teenmi3iyslm rlnmsnu)teenmr3ty1fmDelieo ( trxmxm ny1ll  mfei ()sDtrurp;t4alx if3ilt sDemnmonu4 ltnir ta1oaDr uvo;s s2trxopoudaltnmncsls) Dtm(  ou1teenmi3iasfm ua( o;()alermrcoodfpDean ilt  rxo(o3oy4omeemfcs s aDuaxronu1altomi3iat s ulnvon()artnmocia1oaDe ues s)tetrirpnodlmt  fviltf 2ur(r ;o4aexnmf3ilsla el( pnu) renxfcoadfptrlnes;(0trurim3no1ole mfeslsfaDrrxm ;t0opx  ieiadfa em( on(0teenxrcoatlat aiei (0seurxr3nodamtemncia()aruaxrpot1ape ifctas a2em(msn(0 leoxrcoo1lm  aies;t0 2xrxm ny4omeemneils s2tmxr ;u4altnmieildfa2uau s u4 rtrxo3ta1opt aiei;() 2uo(m oo1alte fcsltfsDuaur ;o4tptn oeiasfsDel( p;t4 lxnmf3iy1omDraueo;s)t2toirpoy1ap  mfvtatf 2umu  oo0apxo f3iyt s rmn s t)tlxnir3ootoateaivo t texrir3iydlp  mnvtls aDuru  ;u1tee mfetltfaDuanmo u)aleoirctodfpte ues;t)s2trxo nudll  lfcil() rrru  nu0optoio3tlsls um(mont) rtnxo3tydlpteai ilt0 exmir iydlle lnvtlsfsDtm( o;u4tlenmfeiadls ua(vs (0 eeoifciadom eln ols0trurxm nydolte fetat  Draumono1tpe  iciatfs2emuvp;u) exnir3iytfat li o t0truriopoudopenlnct sfs2um(mp;t0opx mieiatfm uan pn(0 ltrio iatopDraivols  2xmxo iodlmeelivt t)artmx ooo0opx mo3iasfmDrauvpnt0texnxo3io1oaD lnes t0trtoxm3no1alte fciatfa2rru p;u1tleomieilsls eluvo (0 eeoir3tadfmt lieilt)s2uoir3ou4ame  icsls) 2umu  ;o4opt mfctysfm2eanvont4trenmr3tydlmDeauvi;( setm(r nodlp emnvsltf Duaum oo4apx ioeildfaDeln o;t4 lxrmf3todfpt lnvi t)trxrirpnu4lm e ivi s a2taxm nu1oex  iciatfaDran s;(0tltnmf3tatfpD lnei s)texrxm nodap nlict s s2um(monu4aetniociyt sDrm(msnu0 ltnio3oo1omtraivo s0t2uo(m ou4omtnlncs (  rtm(  ou1opxomiciaslm2rl(mp;t0 rxnmfctadfa rauei () rxm(o oy4amee fvtl(faDtr(mo;o0apxn o3tls mDean snu)alxnxocoy1fpDelneo;s  rtm(m iy1alt mnvs s s2uaxr ;t4aetnmictysfm2rmuvo;t4aeermfcootlaDrluvi;t0tetm(mpoy4am   fvias  rua(moou0alxniicild aDuluvon() rxrmo iatlmtrau s;()srum(r3nydolt lncs t s2umump;t0aex if3ildla ea(vo t0altoxocta1laD livslt)t2trimpnodlpte fvtltfs2rrx  nt1aex mociltfsDumn p;u0 ltomf3oo1oat aivs t s2uo(o3iodlme lfetat) rua(m nu0alxomfciat m uluvo ()aexomr ootfm  aivsls0 2xr(m3oo4op nlicta() Duaxmpou4apxnmieiltfmDuauvs () rxrxr iadoaD an o;(0t2xmxm ny1lm  micia( srum(rpnt0oexn f3tytfaDea( o;() rxnmo tytfmDelu i;s0srxmxo3nudlmtnlicsas srumum ot0aexniicias sDemnmont4arxnmf3iydfp r nvo;()s2xo(mpno1lmenlfct sfa2tr( p;o4tet  ieiltla rl(mo;(4teermo3oo1lm  aivi;s s2xriopoydlp elfvs (f Drax o;u4tpxniocilslaDuanmo (4artoir3oadlm elu o;( trur(o oudomtelnvils) 2rr(  ;o4tptnii3iyd m2rmnvs;t0 lxrxfcoydlp r nes;s)t2tmiopnydll  miesatfaDumu  ;t4teeomieiydlsDumnmp;u0aeeoxocta1oaDraieo t0 exoir3ny4am   ietas  rra( p;t4tetnmo3iadfa2rmnvo t) exnxf3iydfptr u slt srxoiopny4amtnlivsa(fs2ra(rono1ole moetaslm2rluvp;u0 lermfcoadoaDe ivo;s0t2um(o3nu1al  lfeils)sDrax ono1tpenioeiltfa rmnmsnt4trxrifctytlp rluvo;t0 eum(m3nu4ll e fesa()arraxr oo4oex mieiydfm2uanvp;() rermf3iodoaD ln s;()sexo(m oy1am  lnci ( srrmu p;t1tle io3iytlm2em(vpn(0aeeomf3oadlp ean o (0sexm(mpoudom nmneil(fartm(m ot4texnmieiltfm2el(mo t0 rtnxocoydfmt ai i s teumxm3oy4alte fvtasf 2uru pou4olxnif3tatla ulumon(0 leoif3iydfpt  neo () euoirpoudopt  nct (faDurxrpno4alen i3tys s2umn s t) ltrxr ootoaDrlu i;s) 2xoxr iy4al n fctatf Dtaum ot1aexo o3iasfsDuan o u0 eerxfciadfm ranvs;s0texoxrpno1ll nlicil(f rurx ono0aptoio3iltla2rlnvo t)aetnmocoatopteln ilt0srtmxr iu1lp elneias)sDtr(  ou0oee ifciys a em(ms;(4alxnmfciotoaDe i o t s2umiopoo1ol elfct ()sDrrxrooo1olxniociydfs rl(vo;u4 lenioctodlpDelu i s) ruoio oo1lm e ivi s)aDrmxmpot4tlt moetysfm ulu s;()trtrio3totfaDr n o;s)srurxr iy4lmtnlnctas arua(rpoo1opx mo3ild s rmumo t4alxrir oodomD  ues ( sexo(m3nu1aptn nvtatf rurur ou1aee  i3iasfa2el(vp;u4 etrxrcta1fmD lu ils0t2toiopoy1ap nlicsasfsDrrumpnt1oetn o3tasfa2eaumsnu0altrif3oadoate i s s)srxr(r no1op nlivia()s2uau  ;u0alto f3tadfa2uaumpnt)aexnxf3totomD lnes;( texrxrpiy4ap elncias)aDumu pou4aetnmoeiyt a2ranvpn(0aetnmo3iy1lpD  n s;t0trxmxo3ny1ll elnet ( a2tmumont4oet iiciat sDel(vp;()aexrmf3tytom  lu s t0 2uoxo iu1lltemfctlt) Dtmu pot4tpxniieildfmDraumpnu0trenxr iytfptelnei ()t2urxm3oydllt mncil( s2tmumo;t0tle  oeiytlaDemnvont0aetnxo3tytfmDr nesl(0 rtr(m iydomeelfetltfs2ur(r no1tpxniieiyd sDuaumpn(0tltnif3iytlpt  ues s) rtr(r nudlle  fcsl( a2ra( pnu4olenmoetys m emuvsn(4 rxrmr3tytoptrlnvsls0 etoxr iu1oltnlnes (  Durur ou1oexomi3ilsls2ua(von(0tetoxo oa1om ran s s0t2xmirpoodlm n netas)sDrr( o;o4oltn ocildla rmu on(4tltoiocoadfp rluei t)srtrxo oudamtemfeslsfaDrmurpnu1apt ioctlsls2uln on(4tlermr3oadfa   iei t0 rxrio3oudamee ncs t)sDrau  no1oet ioeiyt sDuauvs;(0artoxf3tadomDrlnes;s tetm(opny1lptnmnesa(fsDtrump;u4tpe iietls a ulump;t0tlxoif3iytoatelivil() rtmxo iu4ol nlieslt arur(ronu4tee  f3iyt a2el(vp t) eenxf tytoatrlnvs t  euo(m ou1omee fcsl(f Duaxm nu4aetnif3iadlmDrmnvonu) lenxfcootfatr i o;t  rxoim3iudlm  mfcia(  Dtaump;u1oetnmfciasls2ul( p;t0tltnmf3oo1fmDr uvi s) etmxr iy1lp  liesat  2trur ou1aleoiietatla emn snt4 eerir3oadom rauvslt0s2xoxr nudlleemicia(  Dtrxro;u4oleoiiciltla2ran s;(0teeoirciytomDraues;t  rxrio oy4ol  mnetas)aDurum no1ale io3tlsfm2rauvsnu)teeoircta1omDr ieo () rtmim3iy1om elivilt) 2taur nt0oexo oeiaslsDrln p t0 leoxo iotoptrlu s;t)texoio3nydoptn ietlt aDtmu  nt4tpt mo3tas s2rlnmp t0aexnmrcia1fmDe n ol( s2uoirpny4lltnmfeiltf 2ua(r nt4aee ioeiltls em( on(0texrmo tadlptelivilt0srum(rpoy4ameemiei s)sDrmx oot0apt  ociadlsDea(mo t0 ltrmr3ootop eau slt)t2xrirpnu4lptnmfviltf rua(ro;o4open o3iltfm ra(vsnu0trxrif3tadfptrlnvi;t setoir io1alt mfvt sfaDrm( pnt1oeenii3iad aDrm( o t)tlxnircoy1omt ai i;s0 rto(rpnudome micil(f Dtr(r ;u4tltnif3tls s2uluvs;() ltnio3iydop e i o t s2trxmpiy4aptn ietlt s2rrx ooo0olt ii3tlslmDul(vp;t4alxoxo ootfatr uesls0s2uoimpny4amtnmnciatf rumxmo;t4ope ioeiyt a2ua(ms;t)trxnirciydfmtrai ilt0t2ur(opio1lp  mict t)srtaxm no4oexo f3iyt a eanvonu0tltrmr totfatelueolt  exrxr3ny1lmt lfet ( sDrmxmpnt4oleoif3iysfa ranvpn()teenifcoo1fmDelnvo;()s2xr(opnu4apt  feia()a2ta( o;o1ale  i3tytfaDraumsn(4artnif ootfa ean slt0seumiopoydlptn iciatfaDra(rpoo0alenmf3tytla umnms (0 reoircia1oa   n i (  eumxm oo1apeelfei s) Drmxr ;o4oee  oeildfa ea(mo () rxnxocio1oaDeaieo;()t2tmxmpiu4ome lieilt aDrm(rooo0tleo ictyslsDulnmo;(0tlxnmfcto1la  lies s  2uo(m nu4omtnlicsl() 2trxrono1tlenmfciad mDuluvp;u0alerxf ia1lmD  ivolt setoirpnydlp  mnvi ( aDtmxmp;u1openmieiytfm2uan p (0texnir ootlm rln o t)trumimpoo1lm elici s) rrmu onu0aptomo3ilsfa2ulnms () ltnxo ia1lmtean o;t0trumio oodlltnmics tf rtru p;o4apto ieiadlsDel( s u)teenxr oa1lp e ues s0 2xrxr3nu1apt  iei sfsrtru pnt0tptniieild mDea( o;u4arxoio tytomD  nvs ()t2xoim iodal n ncslt sDtmurp;u4olt mi3iysfmDelnmonu4texrmocoo1opDrauesls0setoxmpou4ol emfct s) 2tax  nu1oet mietasfs2ua(vs u0 ltnifcootop  aiei;t0srxoir oy1omee fvsls s2raurpou4opx  i3ilt sDeln ont4tltoiociy1lm e ivi ()s2toxr3oo4amt mietltf Dumxmp;o4texoiieilsla uluvp t4 ltoxo iodlpD lueo (0texoxm3iy4apenlncias)sruax p;u4alx iociatfa ul( on()arxrmo iytfa e u o (  etrir ny4altemfvi (fartm(  ou1tex  oetltlm2eln p u0 exrxociadom eaivs;()srumirpoydom e fvi ()aDrm(ro;t0oltn o3iys sDuanvsnu4trxoif3iatopD  i sl() 2um(m iy4omenlivt ()sDrrumono1oeen f3tytfm2ea( snt4arerxf tydlate ies t)srxoxmpou4lltnmncilt)srua(r nu1opxoif3tydfm2rl( pn(0trtoxoctatlp rliei t0 rtoxo oy1lpenmivt () Dua(mono1opeoio3iyd m2rmnvs t)aeeomf3to1lpDeau s;s0srtm(o3nudlpt mfciatfaDta(m nt1alxniieiasfa ea(vpnu4trtoif3oo1om r uvil( s2toxm3oy1lpt mfvt s a2um( ono4opt iociytlaDul(vp;() eermr3oatoptelnvi;t)texmxrpnu1ame  nvsltfs2rrum ;o0oltniociysfa2umnmsnu0tlenxf iadfmDr n ilt0 rxoxo3no4altn net ( sDur(mpno4aexnii3iaslaDrl( o;u4aeerxf3oydfa elieil()setoxo nodamtnmfeta(f Dum(mpou1oexoii3iat sDrlu o t)aexnmrcoy1opD anvsl()trxmim3nudlptemncs t arrrxmp;t0tltnmfciadlaDea(mpn(0aleoxo3to1lptr nvsl()seurim io1llenmivsl( a2tru onu0aeeoiieiysfmDuanvs;t0tleriocoydfpD  uvols)srtrim3iydlpe mncsls)sDraxrpno0oeeo i3ildla uaumonu)trtrxfcoa1opt livs;s0 exm(m3iu4am elieta() ruax  no4oltomoeiys m2ran ont0 eermf oadfmtrli i;s0setrxr3nu1omenmnvia( s2ua(m nt0ope mietls a2um(vo;u)teerxfcoadlmteanvils)texmxm3iu4ll elfcslt aDtmumooo4tet  ictldls rmn p t4arenio3ootom  anei t) rxo(r3iy1am nlnct s)artr(moou1altniociadla rmuvp;(0 etnir iytlpt au ilt trumir nu4amt miviat) rurxrpot4tlt moeiad a ra(mont) ltoif3ta1fa rlnes;t)tetoiopoo4llt licta(  rtau p;t4apto oetadfaDrmuvo;(4 eeoif ia1lp e neilt)t2to(o nu4lm e ncs s aDrrxmp;t4tpx  o3iys m elnms;u0texoio ta1omDe i o s0trxoxrpio1omenlies t)sDrmxrpno1alen iciytlm2elu p ()trxoif tytoaDeaneslt0 2xm(mpou1opee iesls) Draxm ot1tpeo feils a2uauvp t4 eermocoytomDeaneslt0t2xoimpiudlleemfvt s  rrrxm ;t1aetn feiad mDua( p;(4tetrifcto1op  anei (0 rxoxm3nydlpe lieias  Drru  ;t0tlt ifciys aDrmumpn()arxoxocia1omDeauvilt trtmxo3nydamenliesl()sDtrx o;u0aeenii3iys s2rmu o (0arxnif3oo1opDeai o (  rtr(r3oo1ap elietlsfa2rm(mpnt1tet  ociat mDulu p;u4texniocootlpD  neol()t2uo(o oudalt  iesa()aDum(rp;t1olxnii3tls m2uanmon(0tetrio iytlp rlivi;s0 rtmxmpiu1lptnlnetlt  2tau o;t0tpt mfetlt mDrmuvpn()trxrxf iydomt ai i;t)srto(m nydome miei s)sDurxr ;o1oetoif3iad m uanms;()teeomf iotlpDe neils0 etmxm3nu4ape  net s)sDtmumoot4opx mocilslsDrmnmo;(0arxrmociatfptr n ilt0 2trxm nodam  lfes t)srraumono0alxnmo3tytls2ul( sn() eermociatomtr ies;s texmir3oudom e fci (f Dtrxmoot1tlenmoeias m2umn snt4 eeoxo oo1fmDeaneo t)t2tm(m3oydom elivilt  Dtrxront1ope  fetytfsDra(vp;t0 eenif3iadfaDeaivi;()t2umxo iodol elfvt ( aruau oou4tltnmfeiatlm ulnmsnu)aetoxo oodoptraueo t)t2umio ou1aleelietlt)srtm(r nt1tee io3tysla uauvs t)aetnmf3ty1fmD  uvslt0srtoir io4alenmfvil(f Durx pno1aeeomietas sDemnmo;t) rtrmrciytlpDelu o;t t2xmxo3nu1lpt lnvi t aDrru p;u4oetn i3ils a2uauvon(4 rtomo3iydlmDraneo t  2ur(opiu4lp   nvtl( sDrrxr oo0aptn fciasfsDulnmpnu)trxnif3oytopD  n sl(0 rtrxm3oo1amtn nct ()a2ua( ono0tpeoii3tys aDemnms;u)aetrmfcio1opD  nvo ( trxrxopiodop   fct tfartm(  nu1opx if3iyslm2em( p;u4treoxfciydom ran i;s trxm(opny1olte nvias a2urx pou4tlxnio3ildfa rluvp t0trtniocoadfpDr nvols) rurxo iydapt licilt)sDrmxr oo1tpeo oeilt s2uluvp;t0alxnmfctatlptrlnvo;(0seurir3nudope  nvsl(  2tr(  nu4oeen icildfmDumnvs;t0 rxrmrctatoatrlies t  rum(rpno4ap nlfvt s) Durxr ;t4tpeoif3iyt s2ulnmp (4arerifcoodomte i ol()teurio3nodoptn iet s a2tru onu1oexo oeiasfa2rau p;()tetrxfcoy1laDraivi;s0s2trxrpny4omeelneslsfa2ur( pno0oetoii3tatfs2el(ms;t) lxoirctytlmtr uvi;( teurim3ou4opt mivtlsfsDumumoot4tpxomociyd m umnms t4 rtrio3oo1lm  aies;s0 etm(opio1ll  mncsasf rtruront4apenmoeiatfm2ra( s t4alxrmr3iadfp elneo;t  2xrxm oo1aptemnvs t srumx  nt1aeen f3iltfs2uan o;u0tltrxr ta1oaD an slt trxoir3oydlptemnci t)srrru pnt1tpx  o3tyt sDumnmo;(0 rxnir tytomDeli o;s)s2umxmpno4op n ieia(fsrrmum nt0tltnmiciys s2emn ont0texnir oydoaDraiesl( t2urxo nydop elfctlt)s2tru  nu4texnmo3iltfmDeln o t0arxomr3tydfaDraivo () rxrim3oydome livsl()arum(m ot0oee mieild mDemnms ()tetomf tadlpDrluesl( s2xr(opiodlpeelnvs (  Durum nu4tlen fetltlm2umnvo;t)teeomf3io1fmt  ues;s0 rumxr nu4alenlnviltf rra( o;u0tpen ociat aDran pn(0tlxnmr3oatfp rluvilt)seuoirpno4opeelfcilt srraur ;u1oexnmfeiysfaDua(vonu0artnxf3oadfa r u s ()sexmxmpio1opt mivs t  rrru pou1oet moeiltfm2rm(vo;u4 rerxr3oy1om   neslt0 2xmiopny4aptelfetls  rrmx  nt4ape ioctasls eluvo;t0trtrxo3oytlaDrluvo;s)sexoir no1om n ivslsfsDuaxro;o4texomoctltla2emn o;t4arxnxrcty1la   uvils) 2toxopou4altemneiat a2taxmpou0tptoifeiyt aDranvpnu4aetomr3oy1late i ilt) rtrim iy1lle lnei (f 2rmur ;o4tetn ieild s emn ont0 eeomo ty1oa eai ilt)tetm(m3nodlltnlieiltfarrrx ooo1olt moetltfa2rm(vs t4alxoif iydomt  nvs;()t2uo(opoy1lmt lictl(fsDtmxm ou4apt ifcilsfaDea( o t0 etrxf3iytla rliei s texrxopou4ol  lict (  rtmu  ;o4oet mociadfsDrlnvp u0trxrmoctadfpD  nes (0srtmir ou1op emncia(fsDrr(mpnu1tpe mo3iasfsDum( o;(0 exrmfciydfmD lieo t) etmxo io4ale mncil()sDrau o;t0optoifctlsfaDrmn snu) exoio oydlaDr uvi (0t2to(o iu4alte ncslt) Dtmxmp;u0aet mf3iatfsDrmuvo ()tltoio oa1omtean o;t  2tm(opio4ope lncias a2urx  ot0aexoiieiyd sDrl( o;u0 rtrmfctodoaD luei t0 etrxm oodlmte ict ()artmxm ou1olto i3iysla2eluvsn(4tltrxo3iydom eaueo s  euoxr iydllt  nes s a2uru p;u1tlto icils aDuau p u) exoxfcoytfpD au sl()t2to(o3iu1lm emiei t) Dua(mpoo1opx moetltfs raumpn(0 ltnxo iydoaDeaieo s0tetrxr3oy4ale lncsls)sDumx oou0opto o3tyd aDea( p;t)tleniociadlaDr ueo s)s2trir iu1olt  fvsat)s2rr( p;u0tpt  i3iytlm ea( p;t)tltnxr3todomtr uvslt  rum(o3oydoptelivt ()arrru  ou4tpeo oetyslaDemuvon()trxoxf3to1omDeln sls0tetrxm ny4op n fci ( aDrmx o;t1tpxomietys m el( snu0areoxf iadfpt  i s ( t2to(m ou1olenlictl(  Drax o;u0alt mfeiydfs elu pnu4tlermf3iytop raies;(0t2to(opoo4ol e neil() rrrxm ;o4aeenmiciyd m uan onu4trtnir3iotlmteli s t) 2xoxm ou1lpt lfvtasf rrmx pno0texoioctadfs rmu p;t4arermrctydopDran s;s)seuo(r3iodlme  ietatfsDtaxrono0ole  o3iasfa2rau sn()tetomrctydoa r ueo s texrxr3oydamtemict ( s2rrx ono1ope ioctasls ua(mp u)arerir oo1op  auvi;s0 2tmxopnudllen fetl(  ruaumoou0olen fciasfs2ea(vp u0artomrcoadfaDraieo;s  rxr(o3oodapenlfvta()sDuaum ;o0apto ieiltfmDumuvont) eerxr3iy1lptrlueol(  rurxm3ny4lpt  ieiasf rrrum nt1teeo o3iadlmDuln pn()altrxo3ta1fat an i;(0 ruoxr3iydlmeemnvsa() rtaumo;u4oexnii3iytls eanvsnt)trtrmf oy1lat  u i;(0sexoxo ou1omt lieilsfsrrrxm ;o4oleo f3iatfm ra( p t) rerir3ty1fateanes;s texmir iydaleemicsatfa2uaxmoou4alxn i3tadfs ea(mpnu)tltrif ootfmt auei;t) exo(m3oo1am   fcsas) rurx oot0openif3iyt sDumu s;u0texrxo3oy1fpDrluvi;t0trxo(r3oydomt mfci (  2rr( ont1altoioeilsfs2ulu ont4aetoiocoytomDeanvi (  rurxr nu1omt  ncslt  2raxrpot4tet  iciatlm rmumsnt4aetnmrcty1la  lu s t0t2um(m iy4lpt mfei tfa2ua(  ;o0tpenifeiytfa2raumpn(4trxrio3iodlmte n ilt) exr(mpou4al e icsa() rraurpot1tlenifctyt a2rmu p;u0alxrio3iadomtr uvils)trumio3no1apenmnviat a2rmu p;t1oexnmoeiatlaDrl(vsnt)trxomr3ia1oa rlneols) 2umxm3no4lme  ivt ()s2rr(ronu0teeoiiciys m eanmo t4alxoio tydopDr nvs (  etoio iy4lp nmietas s2um(rooo4opx io3tasfm raumo;u4tltnifcta1fpt  ivol()srtoirpnu1lp n fcslsfs2ta(  ou1altnmfetas sDum(mo;(0trtnxo3iotoat au slt)t2trxrpiu1lpe mfesasfaDum(mo;o1tpxomfctltfs2em( pn(0trtoir tadom  auvol( s2umxo3nu4open fct sfsDrmxm oo0ape ifctlt a2eaumo;(4 rxnxr oadfmtrauvi;t)t2uoxo3oy4ol n netltfsDtm(mpou1oeeoif3iad m eauvonu0alxrio tytlpD aivil(  etm(r3io1lptelnci tf 2rmxmooo0opt mi3ilt a ranvo (0treoxo tatfpDeanvsl(0texo(opnudaltnmnvtls)artrxmp;u0opx moeildls2em( p;t)teermr iy1omt lneols  rxmim oudlm  livtat)a2rrx onu1optoiocias sDrlnmp t0treoio3todla rluvs (0s2xo(m3iudlmtnmfcias) rum(ront1alenmfeiasfa uauvp t) exrxr3oa1lmt aivo t t2xmxm oo1llenmfcias)s2umum no0oeeoiietad mDuaump (4areomf oo1opDeli ils0 eurxo3iu4opeemfcsa()a2tr(  no4tpen octlt aDeauvp;u)aexoxrcio1om e nvil() 2xrxo3oydomenlfctatfaDumur ou4apx  feiaslaDeau onu0tlxoio oy1opteai s s0t2umim nu4ap elfci tfa2rrxmoot0apxnmoctadfa2elumo u) lxoir iotfm eln o;t t2urxo3iudlm n ivils  Drau pnu0optnioeild sDelump ()arermr iytfa  aueolt0 rtoimpnydamtelictlt sDuau  nu0tlx ifctldlmDrl(vp;t0arenxfciotomDeln s t)s2xm(m3iodlme lnet t  rta(mpou1altoifcildfm2emnms;u)aexoir oytla  lnvil(0s2ur(o3nu4aptemncil(  ruaxr ;u1apxo i3iasfm2ea(monu4 rtrmr3oytfptraivils)s2tm(m nydamee ivtat) ruax  ;o0tpenmfeiatla eau pnt4tlxoxfcto1laDr u s s) etr(rpio1op e fvi t a2tm(  ot0tetnif3tat s eluvpn(0aexoxf iytfpD luvsls  exrxopou4lmeelieiatfaruau pot4tptnmo3tldlm el(ms (4aetomfcia1omD ai i (  exmxo oydomtemies sfs2umxront4oleo o3tasfs2emnvs;u0trxrio3iodom   ivo;t0srtriopou1lp   fvsasf Drrxmpnt0altniietydlaDel( p (4trxrirctadoaDeauvo (  exmxm oy4ll e icsa(farrr(  nu1opt ifciydfm2uauvpnt4aetoifciotfptrli i;t  2xr(mpiu1ap  liviat  2raxm ;u0aetn ieildla rluvonu4 lxoir3oytlm rln i;s srxoim oo1am   nvsa() rrrx  no4aeeoiicils a ra(ms ()tlxnxo ia1fa  li il() 2uoim3nu1om   ncs () rrmumono0apt  ociltfs ran o;u0aeeoxo oodfm  lnesls) eum(r3iy4omt mfes s sDtr(rooo1apenii3tyd m2elnmonu4altrxr3oodop ran ols0 2xo(rpio4openlnei s  rtau poo0apx mfcildfs em( p (0artnxo io1fm  lu i s)srxmxo oy4om   ncsls) rumuro;o0oeto fctas a2rl(mo;u4 etnmr to1la   i o;t)teuo(r ou1omenmies s a2tmump;t0aexomfeiasla umuvp (4 exrif oy1fpDeai s s0t2uoir oudlmt licias)sDtau o;t0opt iocias sDrln s;u4aeeoxrctatfa  lieilt0truo(opoudll elneilt s2rmumont1tetniieiydfs2ea(mo u)arxrxo oatopD lneslt0 rto(r3nydol  lfct tfsrrrump;t4apx mieild aDum( s;u) eeomr3to1laDe u i ()teto(r3iy1lp elici sfsrumxrpot1oee micildfa2el(mont4 rtnmo3tytlmt  i o;() exmir3iodamtnmivsls) Dtr(mooo1aeeo feiyt m2ulu pnu0 exomfciytlaD aivolt0teuoxm io1am  lneilsfs2ua(mont1oexniietyt mDum( s;u0 lxoxrcta1oa eln o;(  rtrxrpoo1oltnlictasfaDtrumpno0tet miciltla2eau sn()arenmr3ta1om e i o t  exoxmpoo4oleeliet (fsrrau pou0apx  ieild aDemnms (0texnir oo1oaDelnvi;s)s2trimpny4lptnmicilt artm(rpnt1tltn oeildfsDelnvp u)aeenmr iytlp  livo;t s2umxr3no4am   icta() Dur(  ;t0opto i3iltlaDeln p (4alerxo ty1lpD  nei t0sruoiopno1ape lnvt sf 2ta(rooo0texo fctydlaDuan p;(4 rtrif ty1lp e nvi;s) eumxm3nu4lpte ivt s srur( pno4opxniociadlmDumnvont4 renmocoatom e iei;s  2xm(o3nu1amtemncsas  rtrxmp;u0texnifeiyt s2umuvonu0 eenir ootfmteaivo (0texo(r oo4lptnlnvsltf 2rmx o;o4apxoiictasfa2uanmpn(4 etrio oadlpDr uvi;t sexrxo io4ole lict (f Duaxrpnu0olxn ociydfs rau s;t) rermo3ty1opDeauvi;s)srxoxo iy1lpe lnvias) Drmump;o0aptn o3tasfsDra( ont4altoxo3iydomtraieo t)sexoxo io1am e fciasfsrtau oot1tex io3tys sDul( snt)aeerir3oytopte i o;t  etrirpoo4olenlici () Drrxr no4apxniieiadlmDrmnvs;u)aleoiociatoaDeauvils trto(o3iy4ap  lnct s)sDurumpoo4tlxnmi3iytlaDemuvo (0 lxoiociotlmtrauei;(0trxoimpiy4ll nlict tf Dua(mp;t4tpxniocildfm elumonu4trtnioctatlmDe u ols0 etr(opnu1lpe licia(fs2rrxmo;u4oltomfeiad s rl(vp;t)tlxrxo3iadfmD ln o;t s2xmxr3oy4olt lnvs ( aDuaumpot4aex ii3iaslsDul(vo (0 rtnxf ty1faDrli o t) eumxm3iu4om n nvtas)sDraxr ot4tpto fetlsls2umuvpnt0 ltniocty1omDran ilt s2umxo io4amtnmfci tfa2tmx  no1tpenmf3ils s rmnvpnu) lxomf tatfpteln s s) etmxr iodal  mfviatf rtmxront1oexoiieiasfmDum(mo t4tltrmf oadfp   ivo;t0s2toir ou1lp   ivias) 2trurp;o0teen octltla uln p;(0trtnxr3ty1oa  auvs;s) 2toxo iodalen nvsl(  2rm( p;o0oetn oetltlm umnmp;()aetrxfcto1oa  aivs;s trtoxm oo1oleeliciat  2tr(rpou4tlxnif3iyslm el( o;() rtrmo3oo1oa eaues;s0sexr(m3ou1lm elfeiasf ruaxmpoo4aleomicilsfa2rmnvs;t4trtrxf ia1fmteli il( srxoim nu4lp e netl(faDtaum oo4olen oetydlm um(vp;() ltoir3iy1fpt luesl(0 2xmxr3oy1omte nvi (fs2urxr no4opxomfeiasfm2ua( ont4aetoirctotlmDrai s s0sexrim iudllte fesa(f 2rau poo4apeomf3iytfaDul(vonu)tltrmfciy1oateln s;t0sexo(o oydome mnvtl() Drax  no4olto fciys s raump;(0 rxrmrcoadfatrauvs;t0setrxmpnu4op e fctat)sDrmxr ou0olx  oeilt s umuvo;u0artoirctydlatr nesl( t2xoio3io4omt lfei t aDua(mpoo4teen ieiad sDea(ms;()teenmo3oydomtean o () euo(m3nu4ole livi sfarta(rp;o4opxomf3iasfsDrmn p;(0 ltnmr3iy1faDrli o;s srxm(opiy1alen nes t)aDurx  ou1ape  oeiad a um( p;u0 etrmf tytlpDe ies t)t2uoim no1optnmivia() 2urx  nu1tlenifciasfsDra(mpn(4teenxo3oydfa r n i;(0s2xm(opou4lmee ictl()a2uru  ;o0aexomociydfm rl(vsnt) eenxfcoy1lat  i o;s t2trxm3iy1alt lnvsa( a2rr( p;t4oleoiietld m2eau s;(4aeenmr3to1lpt luvils)s2xmir iy4lm  lfeslt srtrxmo;t0tlxn ietyd m ea(mp () rtrxfciodom   u i s)trtoio3oy1lptemnvs tfa2tm(m nt1oeen o3iadlm ran o;u)teerxr ta1oaDr u s;s) rxrio3no1llenlietatfs2umxmo;o4alt iicias s ea(mo t0 rxrmfcia1fptrlieolt)setmxr3oudamte ieiat srtmump;t0alxo ictltlm2ranmont4altrirciy1opt  u sls) 2uo(r3io4ope  nviat s2umxm nu4tpenmo3ilsls2rmump;()treoifcio1lp e uvi;s)t2xr(o iudapeemfctl(f Drr( o;t4altoiictys s uanmonu0artrmf3iytlmtrauei t)t2tmxrpny1lm elnvs (f Dtmur ;o1apxnmfeiytfaDeanvsn(0 lenxfcootla  luvs;t) 2uoirpio4olte nvia( srtmxr oo0teeomocild aDumu s t4 rtrxo oodomtr n s;s s2tm(m iy4ameeliesl()aDrrxmp;o0aeto oetasfm uanvs (0arerxo oy1oaDrluvi;(  euoxopnudaptnlncils)a2urumpoo1tlxoioeiysfs2ulnmp (0alenmf oadfmt luvi s)texo(r oo4amtnlivi tfa2taur nt4oexnmfciasfm2elu pn(0aetrmf tadomD livol(0seto(m3io1apee ivsls sDtaumoot0oexoio3tltfs uluvs (0 ltoxfcoo1fpDr u ilt)trumxm oy4altn ietatfs2trxm nu0tlxn ociysla uauvsnu)teenxf todfmDe nes;s0 2urxo iu1lle  iesa( s2rmx p;u0aeeo oetytla2uanvpnu)artnir3ootfa ran o s) 2trxm oo4am emnct s)s2urur nu1tptomictydfa2uanms u0aexoir iodlatraivs;t0t2xoxr3oo4apt lfes sf Durur ;o1tle iociadla2ra(vo u4teeoxr iy1optran ils) ruoim nudope lfvsa()sDtmxm nu0oee mictadla el( s t0altrif3ty1om eln slt0srur(opoo1ope lneias  Dtax  ot4olxo oeiadla2ra( p;u0 lermf3tadla  livo ()t2tmio3io4om emnctasfsDrrxrpnt1oee mf3ildfs2ranvp;t4altrxfciy1lp eli sl(0teum(r ny1al  lfvi (faruru ooo1apxoiiciadlaDelnvo t0 rxnmr iydopD aivsl(0 rxm(m oo1llt mics t  2ua(m ;o0oexoiieiadfm uluvp;t4 rxoio3oatfmDeaueols) rxoio iy4lmtnmnetl()srrmx pou1tltoio3iytfaDelums;u) etomfciotfptr u o s setmir3no4lm elfcs (f rrmum ;o0oeeo feiltla ran o u0teeoir io1fa e n o;s) etr(o3iy4aleemictas)aDurxrp;o0oeeoioctlt s rmnmp (0alxrmf oatfp e i ol( s2um(r ou1ale lfeiat) Dtaxm oo0tlxn iciatla rlnvo;(0 exrmr3ootom rau sls0 2ur(m iu4lp nlnvta()a2umxmpnu0tpt io3iyd aDelnms;(0 leoif oo1lmDrlivils0 rxrxo3nydom  livtas sDtrxrpot4aeeoiictytlsDemnmpnt4 lenifcia1omD  ivil() rum(r iy4amtelnet tf Dtaxmp;o0aeto feiltlm eanmo t) rxrxo ta1lmDraivsls  2xoxr oo4olte fet t s2tr(mooo0altn fctyd s emumo (0 exnioctadfmtrau il(  rumxr nodlmee ics t) rtmurpnt4aeenio3iltfa2ul( o;()alxoif iotlaD liesl(  rxmxr3iy4omen ici ( s2urx p;t0oetn i3iydfm2uanms;()tlxrmocia1fmte nvi s0teumxo3no1lme mnvils  Durxro;t4apt mfetyd s eluvo t4trxrmf oytlp  aies t teumxm iodlle mncta(fa2umu pno4alenifeiatfm2ulnmo;t4tlenmociytopteanvs;(  rxoxr oo1optelnvsas  Dtmu  ou1aptnio3iltfa2umnvpnu0artrio3todfa eai s s sexrxr3nu1al   fvta(farurx pou0oltoii3tat sDra(vp;()tleoif3iadfa rlneslt)s2xmxm no1ap  liesls aDua(r no1ope iocild m2eanmp t4artnxo3to1fa   ieo;(0 rumirpoo4oltnmfctas srtaur ou1tlx ifciydfm2uln o t4 lxomfcootoaD  uvslt) rum(r iydlpt mfvs t  2ra( oot4texnmfctas aDrlumpn(0 rxrio oatfat  nvs ()t2tmxr nu1lme mfvsl( s2tr(mont4aetnmo3tasfs2ul( p t0trtnmfcoydoaD  neslt sruoxopiodlltelfeilsf Dtrxrp;t0alt  ocilslm2umnmsn(0 rxnif tadlp   neo;s t2tm(r3io1om e icias) 2tmxroot0tpxn ictadlm um(vsn(4 lerir oa1oa e ies t  rumio3nu4lmtnlietl(  2umxrp;u4aetnio3ilslsDum(mpnu4 lenmrcio1fat  n s;s0 etoxo3iu4lltelivia(faDuau ont4opeomicilsls um(vp u4aeenxocoodfpt ln sls)teum(opoodopt lnet s a2uaxr oo1tlenioeiys mDrmnvpn()trtrir3io1lat  neil()trxrirpio4ome lnviatfartaxm nt1aee  feiytla rmn s ()teeoxo iytlmt  u o;t0 eum(m io4op  mnci sfaDrm( pnu4apx  f3ildla uln s (0 lxnifctydop  lnes ( teur(mpnudape  nctat) Dtr(  ;t1alen fetldfsDumn o;t) lxrio3oodoa rluesls truoxo iy1al emnvi s)a2uaurpot0aptniociytfa2uaumo;()tetoxr iodom r ues;s0 2xo(r nydlp  lnvt tfaruau o;o1tptn feiltlaDeln onu4tlxnxr tadlmD aueils)s2umir ou1lleeliet (f Duru p;t0apxomf3tls a2ul(mo t4aetrxo3to1optean s;(0teumimpny4opte ivsl(faDum(r ;o4ale ifcias a2emuvo u4 rtnmr3oy1opD lues;(0seto(m no1oltnmfcil(f rra( pou0aexnmf3iytlm2rm(vo (0aexoioctotlmDr uei;t  2xmiopou4ole liet t)a2tr(mpoo0aleomoeildlm2rmn snu)tlenxo3ia1fmDr nei t0srtr(mpou1ll  mfciasfaDta(roou4aet micildlm emnmpnt0 rerxrcoodla rau ils)texoim io4lleelicsasf Duaum nt4tex ioctltfs ulnvonu4trxnxf iodfpDrauesls0 exmim3nydome mfesa( aDtau poo4apxo i3tysfa2ean s t4alxrxrciadlmtelneo;( trtm(o oy1apt mivtl( srra(rpou0opxomf3ildlaDulumsnt4aetnmrcia1omDr neo t)s2xoxm3no4ole lfvs s) 2rrx pnt4apt mi3ias aDrau sn(0trenif oydlmt luvo s0teuoiopoy1al   nvta( srumu oou0aeenmoctyt a ulnvpnt0 etoifcootom  an s s trtmir iodoltemieilsf 2rauroou4aeenifciysfsDum(vpn() exnxocio1fptrli slt) rtoxr oo1ap nmietl(fsDum(mooo1tpeo f3tat m elnmsnu)tlxoxf oy1lat lu i;t)seuriopiu4amtnlnvs (farua(mpnu1tlenmfciat s ua(vo;t) eenmr todopDeaivs;t)srtoir3no1lme mivsls)a2raur nu4tpeomi3ias aDulnvp u0tleoifciotoa eluvils)s2trio nydopt  fesls aDua( ono1apeoiietldls2ulumsnt)altrmf iydlp rlivilt0s2xmxr3iydllenmfvils)srrax p;o1optnmiciyd s2umums;u0treoifciadfm rluvo;t0 exoxrpoo1lp nlfvias artr( o;o0alxn fetatlaDelumo t0 exnmf3iodlat  nvil(0 2to(m iudllt lnetl()artr(mo;o1alenmieiadls rl(vo;u0 lxrir3tadlpt aieil( s2to(m oudaptn fcs t) 2rr(  nu0ope ioeiys mDulnvs;(0aetrif3iydfa  luvolt0t2trir3io1al elncsls) Dtm(mpot1tleo i3iys a elu o;t) lenmf totoa eli ils) 2xmxo3oodlm nmfviat srum(r nt4tlx if3tad sDulums u) rxnmo tydlpDr nvs t) 2xmio nu4omtnlicsat) rrm(mp;o1aex mfeiadlmDuaumo;(4alenmfctotomtr neil()srum(opny4lleemfcsl( srrm(rpnt4opx mi3tadlmDemuvp (4altomf3tytfpteaieo s0tetmxo3nu1altemfviltfsDur(m ;o0aeenioctas s ua(vpnt) exrmr3oo1fpDeaivsls) rtriopnydapt micsltfsDtaxrono4tltomietytfaDrln p u0 ltriocoy1fp eln o;t0 euo(o3oodam nmicsasfaDrmur ;t4opx moeiyslsDulnmsn(4 exoio3ty1lmtean s;s)tetm(o3no4apt mnvslt)a2ururonu4alxnmfetatfm el(ms t0teermr tatoaDrlivo;(0trtoxr iy1olt mfeta(f rtrum nu1aee  i3tydls2raump;u0 ltnio iotlpt  ues;t  2tr(m3io4om emfeils  rrm(rono4optomfetyd aDum(mo;u)trxrifcoodlpte nvs t0sruo(m oydapte ics sfaDtrxro;o4alenmfctadfs2eanvo;t4tetrif todlaD au i;(0 2uoxo3iu4ol elicsls aDrr(r ;u0oltomfeiat a2ua( p (0teerxoctadop ran s s)texrxrpny1lpee fct ()aDtm(mpot4olxoio3ild m el(vp t)aetrir3iytfa   n s (0teur(m ny1omtnmnvs tfsrtrxr ot1olen f3tlt m2ua(vpnt4 rxrmf3iy1lpt aneils trtmxrpiu4ap  mnvta(fartm( pou0apt io3ild m el( p u4 leoif oodfmtrau ols t2xm(opiodlmeelfcs sfaDtax pnt4tltn octldla uauvo;() lermocoydlaD ln i s0 2umirpno1lp e fctasfa2tm(mpnt4aleniietlsla rmn p;u0tleoif iotfm rlnvsl( seuoxo3nu1lpt  nei (fsDrmx o;t0tltn o3ias aDelu sn(4tltniocoydoatrlnvslt setrio3oydope mneiasfa2raxm ot1tltoiieiat m elnvp (4artnif iytomD anvi t)sruoxm nodlm nlieslt s2um(mpno4aetomf3iysla em(msn(4trxrirctadfmDrauvi ( srtm(o3iydlm  licsl()a2raxronu4aetomfciad sDrmn snt4 lxrmociatlatelivo;t0t2xoio3nu4lmtemnvi sfsrtau  ou0tptn oeiadfsDul( o;u0 exoxf oadfp r uei t t2umir iy4ape mietltfarrr( o;o4alt ifetasls2rl( p;(0teeomo3oadfmD anvsls0seumio ou4olen icslt)s2um( p;o0apx mietyd sDuan on(4aexnmf3ty1lp   ues;t0srurir3oudlptn ietat  Dtmx  oo4oetnmo3iyslaDuluvont)texnmo oadomte u ilt)seuoio3oo1ap nlfeta(fsrtrxrpot0alx  o3iysfs uluvp;u0tlxnxr iy1lmt  n o ()t2uoio iu4ale mfvt t srumx  ;t4alxnifeias s2um(mo;t4 eenxr oodlatr ivsls0 eto(opou1aptnmncsa( sDrru pou0apx mf3iadls2uauvp;()aleoxr oy1lpt aneslt) eumxm oy1omtelicils srra(r nu0ope ifeildlsDulu o;u0aexoio3iadlm e ies;s sexmir iu1altn nviltf ruax  nu4tpx  o3iadfsDel( s t) eerir3iytfa elueolt srur(o oy4lleelnci t)s2uaxmpot0olt mo3iaslaDemums;(4 rtomfcoy1opteauvo s)t2uoio ou1lmenmnvtas) rrm(r ;u4tet iiciysfa rmnvo (4 reoif iadfmDelnvols0s2uo(opoydoltn fvil(  2tmu oou4tltnii3ild s rm( pn(0trtnir to1lm   n s;s teuoxr3iodlpteliciat sDrmxr ;o0teto ociyd a2elnvont4 eenxfcio1faD  uvo;s)srxm(mpiu4amt mictlt srua(rp;o4tetnmiciat s ul( s u0tlxoif oo1fm ranes ( trumio3iudom emics sfa2tm( ono0tpxnifctatls ra(vp ()tltnmf3oadopt au ol( truoxrpno1ol   netlt aDtaxrpnt1tlxnif3tlsfs ean o;u0altoiociydop r uvs;s)seto(o3oy1lme lncia()s2tmurpoo0apto ictyd s2rmn pn(0tetnio3tytlaDeaivo t0t2um(o3iodllenlfetasfa2rrxr ;t1tpeoiociytlsDranvo;u0tlermo3iy1oaD  n o;(0 2xmiopnu1oltelicta( a2tmum ;o1altomf3iadfs2ua(mont)areomf3oytfmtrlnvs;t) exo(o3io1ll nlnesl(  2ta(  nu1alenifeiatlmDran pnt)aeenxf3totlat  ueils srtoxm3oodap nmnesl()srur(mpnu0tpt ioeiytla2el(vp;u) lenxrctytfaDelnvs t0 exoxrpoy4lm e ieslt  2rm(roou0teeomi3ildfsDrmuvs;(4alxnir oa1fm ranvs;s)tetoxo oudaleelics () Drm( o;u4aex io3tlsfsDul(mp;u4trtoif oy1lmD aivol() etmxmpoudomeelfes t) Drmur ;u0apxomo3ils m rmnvont0 etoir3ta1fm  lnvi t  2uoxm oo1aleemnesas)a2tr(r no4oet  octatlsDulums;t0aetoxo tatomDr uvs s0 etmxo3nu4am  lncta( arrm( onu4ope  oetasfaDul(mp t4trtnmr3totlaD anesls) 2ur(rpnydlmtnlncs s)s2rr(m ;u0oet  f3ild m ul(mp;u0tlxrxf3iydla  anvi;s0srumimpnodape mieiasf 2trumpnu0oee iiciysls2rlu o t4 exnmr3oa1opDranvsls  etriopiodlpenlfes tf rurum no0tltomiciyslm2um(ms t0artnif3iy1om rln ilt t2toxrpnu4oltemiviat)a2ur( o;o1aeto oeiatls2um( p;(4 ltomr3iatopteai s;(0 2xm(m3io4ll  lnesa( sDumuroou0tleomoctatla2ean p;t0tltrmrctatop  lu i s0texm(o3oy4llt mfetls  2rrur nt1apxomfeiasls emnmo u4 eeomfcty1optelneil(0sexmxo ou4op elnctls arra(  ;o4aeenioeiysfa2rmnvo;(0 ltrxociatla  au o t)s2toxm iodalenmnvia(  2ta( oot0aexo feiydfaDumnmsnu) reoxr3tydfpteai ils)s2trxm3ny1op elfes (  rur(r ot4oetnmoeilslaDrl(vp;u4arermr3ta1oatrli ol(0srxm(opoudop nlictatfartau  nt4tleomieiydlm el(vpnt4altomocootlaD aiei t) eur(mpno4lleemieta()s2rrxr ;u1tpeomoeiad mDrmu o ()arenxr oo1omD lnvo;t  rur(r iu4om  mfetasfaDtaum ;t0alxoioeiat m raump;t0 ltrmr oytfp  ln ols0srxmxr3nodap nmfcsa( sDuaumoot1olxoii3ild aDua(vp t4trtoif3iatoaDrluvi;s trtoxopno4op  mnvsa( sDtrxm nt0aptomoeiltls rln p u0altrio tydop  an i (  2tmim no1lpt mfcsasfsDurx o;u1tpeniiciydlsDelump t4alxrmf to1fp   nei;s  2umio3oo1amtnlfviasfsrum( ont0ole mi3iys s2umnms;() rtnxrcoy1fmD ai o t)trtoxmpio1lmtelfvia(  Drm(rpnu4aexoiieiat m2umnmp;u)aetomf3tatfpDelnvs t srxmiopiydolte fvi s)sDtr( onu0teto oeiadfaDrmuvs t0tetomf3tatom  auvi;s)seumxm3ou4lpee fetasfartrxro;t4tpeo feiaslm2ra(msnu)aetomoctadfpDrli il( srumio3ny4apee fvias)s2raurpnt0oeto i3iltfaDemnvp u0artrmo3iy1lmDr uvolt0srtrim3iudomt  fetls)sDrrx  nt0alenmieiasls2uanvp;t)trxrmociatfp  ln i t0t2urxopio4omte fcs t a2ur(m ot4tle  octld sDeanmon()teenif io1fp   ivo;t)t2xoio oy1al e nci t arraur oo1oet io3iadls rl(mp t)tlxoif oa1lm   ues;t0 2urim oudalt  ncs (f rrrumpnu0tpt ii3iltls2rluvs u) lxrioctatlmtelnes;t) 2urxrpoy4lpenlivsl(fsDrrumooo1ape  ieildfs2rlnmsnt4 etoif io1om  li s;s teuoir oo1lmeelivsl(f 2rmu  ;u0alxoii3ild sDuln s t)altoxo iy1oa  lu olt0trurxm3io4oleelfvi s arra(roou4olxnmfeiatfsDulu s;()tlenif io1fmtelueolt  rxrim oodome  nei s)arua(ro;u1tlx if3iydfm eau p t4tetnio tadla raueo;( srtrirpoo1lmen fct sf 2umump;o0tpt  ietasls eln p;t0texomrctytfateli i ()setr(r oy4oltnlneia( sDuau poo1aptnio3iadfm ra(mp;u4 etnxo totomDe ueols)s2xmio3ny4omenlfvsas)sDrru  oo4apenmoeiaslaDeauvpnt4 ltoif oytla r ueilt)srtrxmpiudapte netlt)s2urx p;u4apeo octls a2emn p u0aeeoxf3tadoa   nvol(  rtm(o3no1lltnmnet t)a2ua(r ou0opx ifctysfa uau o (4 etriocootfm   n ilt trtrxopoo1amenlnciltfa2ra( p;u0tptoiieild aDuanvp t0artoif3oodoateli i;( t2ur(m3iodlltelici t  2urx ono0alt  oeiadlaDrlu s t0tetomr3ootfm   nvi;()srurirpnu4ll e ici sfsDtrxronu1alx  ictadfs ra( o;u4aexoio oytfp rau sl(0srxrxrpiudlm   ivi s) rua(mpou4texn f3iadls2ranvo ()texrmocto1fpt an ils0trurxm3ou4oltnlnvt tfsrurur ;u4texo f3tatfa2emu ont)aeeoxf3oydlaDranvo () 2tmio ny4op e nvia( aDrau p;u4aexo f3ilslm rmu p u4 rxoir3iadlp e i o;( trumim nu4amtemnvil( srum(rpnu4aptomf3tytfm em( p;t4artnxrcootlmDelivolt  exoirpoy1ome  ictas)sDta(r ou1teenmociyslaDelnmp u0artoif oa1opD  ueo;( truoir3iudlpen icslsfaDraxrpou1tex iicilsfa uln s;(4trenmf iatfaD aivs;s)sexoxrpio4alt mfeslt  Drmxm ;t4aleo iciatlm2ra(mp;(4altoio3tydlate ivs;s)s2um(o3nodlp  mnctltfsrum(m ;o1tetnmf3tltlm2eau on(0 rtoif totop eanes (0 euoxm ou4op  lfciltfa2raur ;u4tltnmi3iyd sDrl( on()trxrmfctodfptrlneo;(0trumim3oy4ole  ics t srraumpnu1alto oeildla umn snu0trtrif3iy1oatr i i t)trtoir iodlm  lfvs () rrru  ;u4aee  feiydfm2rm(mp;u4areoif ia1opt livi;t0setoxrpoo1lpe miei tfarururp;u4altnioeilsfa rau p (4 exomf oatlmD lnvo;( teumir oodope  fcil()a2rax ono4tpe ioeiyt a elnvon(4artoiociotlmte ivi;t s2umimpou4al nmicil( a2uau pnt0opxoifeiltls2uauvp;(4tlenircoa1oaDelu i t0srtmimpou4olt  iviat)a2tru o;u0tex  ocils m2el(mo;u) lxnio3iydfmDrluvols0 2tmimpiy1lpe liesltf Dumur ;u4tex  feils m ua(vp t4trtomr oytlp e i ol() 2tm(mpno1amenmfet (fs2trxmpno4aeeomfciadlm2rl( pn()trxnmf3tydfptrluesls trtrio3iu1aptnmietas aDurur ot1alen o3iasfm umums t) etrxo3tatopD ai ils  2xmxo3oy4ap nlnvi t) 2rmxr ;u4oleoioctadlaDrm(vp t) exoxo ta1omtr u s;s)seuoxrpiy1alt mfcs tf rtmxroou0tpx if3iyd s2ul(vo;(4 eerxo3oodopDeanesl(  exoir oydamen fct s)a2um(rp;o0tetnmoeiyslsDelnvs;u)aexrio oydlpDranes s s2tr(mpno4om nmfes s)srrrumpoo4tpt mfetatfs rau o;(4 lxoif oydfm raneo;s srxoim3iy1ll emfesls)sDtrxmpou0oex mietadfs el(ms u0tlerio iatfmD aieolt0trumxr oudapt mfesasf rur(m nt0tlx mfctldlm rmnmo;u4arxnxr3iydfmt  neolt)seur(opio4omtn netl()a2rax p;o4tex if3tltfa rl(mo;t0 rxoio tytoat auesls0 2xr(r3nodomte fvilsf Dta(roou0opxn fciydfa um( p;()artrmo oy1fp elnei t teum(mpiu1lmtnlnctas arrm(m ou1aptnmociydfa2ul( pnu4altoircta1om rln o t  rurir3iu1alte fei (fa2raxr oo4aexnmfetytfm2emnvpn()trxrmr oadlp r u ils)s2xmiopoydaleelfviasfs2tmu pnu0olxniociyslaDel(ms;u0texrmf3oo1fp  aneols)trtrimpnu1amtnmnci (fs2rru pnu4oetn feiys s eaumpnt4altnio3iodopDeanvo;t0 rurim oy4llenlictls sDta(mpnt1tpxnmoeiys s ea(mo;(0tltrxo3todfmt lnvil()t2xrxrpou4ll elfctlsfs2rrur ;o0oeto ictltfs2emu snu4 eenif3iodomtrlivi s0t2xr(m3ou1lm  lfcsls)srumumpnt0oltniicildla2ua(mo t)trtrmo3io1lpDrlieol( t2trxm3oy1ap n fesat)aDuru pnt4oetnioeiytlm2rmnmont0alxrmf3ootoatraieo t) rxm(rpno1olenmfei ()a2tm( oot1ape moeiysfm2ulnmsnu0 rtnir3oytfmD  u ils0 2ur(m3iy1amt  icslt)sDrmu  nu0oltnif3iasfm2elums;u0aeenmr3iodlatrluvi s0 etrim3nudll n ncslsf Drrxr ot0apeomietadfa2ua(vsn() ltoxf oy1fm ranvs;( trtoim3ny4apee fvi ()artmxrpoo1aex  i3iytla2rmums;u)tetrio ootlpte ivils0texrir3iodolt mivtlsf rua(mont0opeoifctadfs2emump (4 rtrmr3iatfp  au o;( trumiopoy1ap  lnctlt a2uaxrooo0tpto o3tydfm2rmuvp;()tleomr oadfmte n ol( sexrxr no1am nmictl(f 2ta( o;o4tet ifeiytfs umnvo;()tlxoiocoydfmDe uvs;(0texoiopnu4openlfci s)srrrxm ;u0tpeoii3tltls2umu o;(4aetrxf todlmt an ilt) 2trxr iu1al  mncs t  rrrxrpoo4apenmoctydfm ranvpnu0trxrio3iytfa  ai s s0 eto(m3nydapen ict sf 2taur no1tlenmoctas m ea(vo (4trxnmf3io1fpt anei;t0 rxm(o ny1ame lfes (fsDtaumo;t0teeoii3tasfs umuvo;(4 ltoio3tadlm eanesls0 2ur(o3io4ll emfes s  ruaxro;u0opx  f3tytlsDulnvpnt0 ltnir oo1omt aivil()t2xrxo iodamtelfvs t a2rau pno4openiociad mDum(ms t4 lxoircto1om eai i;t0 rtrxopou4apt  nvta( srrmxront1aptomo3iasfs2uau o t0tlxomr3iatlp eluvil(0setrxo3iu4ol n fctlt)arra(mpnu1opxniiciys s em(mp t4tltnmfcootomt an ols0 euoxm iudopeemicsl( sDtaxrp;u1apt  ietatls rlu snt4 lxrmr iy1lp elueo s)teur(m3ny4apee ieils sDra(m ot1aet  fciltlm2uan s;t0 etnmr3iy1oaD livs;(0srtr(rpoo4lpenlfctas sDra(root0ope mfcias s elnvs t)trenxo iotla raues;s t2xm(rpnydlltnlfvtlt s2umxro;u1oet mocias m rm( pnu4aexniociotoaDeanvs;( srumim ou4lm e feil()a2tau  no0olxoioeiys sDumnvs;u)teenifcoodla r ueol()t2trir nodapee fetat artmxm ;o1oltoii3iys m ea( s;()areoif oydla e neo s) eurim nu1omt mnvta(fsrra(rp;u0oltomf3iydla2rlnmpn() eenxfciotfpDrluvsl(  2uoxm3iydolenmieils)aDtaxmooo0oltoifctydla rlnmp;t)alxoxo3totfptrauvs;s)seur(r iu1llenlnvt sfa2rmx o;u1apxomfciatlaDeanmpnu)texnmrctydlpD aivilt) eumio nydllt  nvsl()arrrurpot0oltomi3iyslm ulu o;(4 rxoif3ootoatr nvol(0 rto(r3iodapt mfesls) Drax pot0texn oeildlaDrlu sn(4tetrifcoa1lpDr u i;s s2uo(mpio1ol emfvsat  Drm( oou4aet micilsfmDuanvs;u4alxomo tatoa e u o t0s2urxo3ny1ll e icta(fsrtmxrpou1tpxoifeiadfa ulnvs;(4texnxr iydlpDrai o s)teur(opio4apeemfesa(fsrraxroot4ole if3tld m2ulumon()tlenio oatfm e u o;s0 2xrim3nu1lpt lnctl() rumxm ;t0apx  i3tlt m umnmpn(0aexrio ty1laDeluvs (0t2toim3iu4ame licsl( aDua( o;u0aexomfeiytfs2emnms;t0alerxocto1omD  ieo;(0teumim oodlpeemnesat arraxmono0tee io3iysla2uluvp () rxomo to1fatrauvs;( tetmim3io4om  mncils)artmumo;t4optn fciytlaDra( o (0 lxomfciydlpt lnvslt trtmirpoydamee icta( s2trum oo4tlx mo3tys aDuln onu4 lerio to1omtr iei t) rumxm3io4ap   fci (  2uaxmpnu1oee mi3iytfa el( o t0aeeomfctydlmtr neilt)t2to(opoo1lm nmivias)a2rm(ro;u4aexnio3tasfs2emn p u4alxoio3tadoaDelnvs ( s2tm(r iodlmtelivi s) Drrur nt4alto ociys m2rlumon(0aeenmrcoatlm rliei (0 exrimpou4lpenlfci ( a2ur(  nt1tpxo oeias a em( o;u4trtomr3oydfm  luvsl() exmio3nodoptemivilt arumx pno4aeeomi3ilt m2umump;t)arxrxociatlpDr ueo t0s2uoirpiy1ape  ici t sDrr(rpoo0oexn i3ilsls ulnvs;u0 etrxo3iy1fmD anvols0tetoxo3no1lp elivi t arurx ont4tee moetydfa2emn p u0areomf3totlmD an s (  rumxo ou1lm elietls sruru p;o4apx iieiydlsDem(vs;()aetomf iodopDr nvo s  exrimpoy1aptelnetl(f Drru  oo4tlxniieiadla2um(mo;t4 etrioctotla elnei t)trxrir iodlleemfcslsf Drmump;o4altnmo3iydfmDum(mo ()trtrxoctadlm r uvi (0s2umxm no4om  lneil( arrrur ;u0oexn octltfm2ul(vp t4 rtnif3ty1fm e uvo ( sexmxopnodal nlncs tfsrrmu  oo4tpen fcilt a2uau s u) etoir3oydfmt lnvi;t)srurxm3nu4ap   nci sfsrur( ono4opxoif3ilt mDemumo (0aeeriocoo1fa eaueo;t)t2uoxo ou1alt  fvtls  Durxmpno4alxoio3iad m ra(von()aeerio3to1lpteaues;t0tetr(mpiy1olenlfvsa( s2taxmo;t4alt ifciyd sDul( o u4arxoxf iodoaDeaues;( trtoimpnudll n fvsl() 2tm(m ot1apt mieiasls emn pn(4 lxomfcoatoaD  i i;t srxrim3ou1amt  nesas  2tmuronu1tltoifeiysfs2rmu s ()aetnmr oy1fmDrlnes;t srxr(m oo4lm  mnesatf Dtmxm nu1aptnmo3tldfa2rl(vp t0trtoifctytom   uvi s0 2xm(opoudole lncsls) rraxro;t4apt  ieiatla2ulnvp t)arerir iodfmD  ivo t srto(m3ny1olenlfcil()a2ua(r nt4tetnmicild a umuvs u) etrmr iy1lp   i s;t)trto(m3no4op n fctltfa2rru poo0aeen ocildfm2ulnvpnt0 lxnmf3oo1la r nvil(  2umxr ou1llt mivt ()s2tr( pnu1apxoiieias s2rlnmpnu0aexoxf tytopDeanvslt  rxrir3oo1ap emicslsf Duau ont1tpxo f3iasfm2rmnvs;() rtomf oa1lptrlnes s0 eur(mpnudamtn iesas  2trur ;o1tpxomoeils aDemnvs;()trxnir3iytlm r n o (0 2um(r3iodlmt mnciasfa2rmumo;t1aeenmo3iytfs2rau o;u4teenmocta1oaDrlnes (0 ruo(mpno4ale mncta( a2tmumpou0aptn oeildfa ul(vs;u0tlenxf3tytla  liesls0 euoxo3iodllenmiei s)artrurpou1apx mictasls2uanmsn() lxrxoctatfmDelnes;t) etoim3iu1am nlnvsas)aDrmx  ;t1open oeildfm2um(vo u)trtnmf3totoat anesl(0teto(r nodapee icsas)a2rauro;t4tlt mfciydla2ea(mon(4trtoio3tytoa   i o;t0s2xm(o io1lleemneil(  Dumur ot4tlx ii3iydla ean ont0teenxocoytla  auvols texo(mpou4ome mivtlt)artr(mpnt1ope io3iatfm rm( snu0aeenxo3iadoaDraneilt srxmir iy4alen nei (  Drmx  ot0oleomoeiadls em( snt0 exoxocoytlatraneolt)teuoxopiu1lm nlfesatfaDrau o;u4tlenmf3iadls ranmpnu0tlerxr3oo1omDeluvsls0s2umir nydop n nvils)srraur nu0oeeomo3iytfm2umn ont)texrio tatla  ln o s0 rtoxopno4lptn ncias)aDumurpoo4apxo iciltlm em(mont)tlxoiociadoat  nvi;s0 rur(o3iy1lltn fesl( aDururo;u0oet moetltlm2emn o u0alxnmoctadfa   ies () 2toxopoodap  mncils)aDtmurp;t1olxoii3iasfaDuanmont)artomo3iy1lp eanes s seurxmpoo1llte ieil() ruaxmpot1openmietytfm2rlnms () rtoio oo1omt  ivs ()truoir3ou1lptn ncsl(  Duru o;u4tpeoii3ilsfm ea(mp;t4trenxo iodfmt aieilt0truo(m iy4apeemfctasfsDtr(rpno0aex if3tydlm rlu s;(0tlermf tytomteaneo;s0t2uoxo3iu4omeemietltf rtmump;o4tlxniicilslmDulnmsnt0 etoxfcoadfaDran o t sexrimpiydlpee nctls  rumxm ou1tlt if3tyt s ea(mp;t4aexoiociotfateai sls) rurxm3oo1lm  micta(f 2rm(ro;t1tltomf3tyd a2uan o;t)trxrir3tytoptrauvo;() rxm(r3no4alenlfetl()s2rmum ;u0aeeniiciltfa2rm( s u)trxrmfctadopD auvs ()s2toiopoodlp nlfcia(f 2rm(  oo1texoifciyd mDum(vo;t0 rtnio3oatfpDelu o;s0truoirpny4ameelieta()sDta(mooo0aleoioctyd m2ra(ms u)tlxnio3iytoatrau i t tetrxm oy4lpte fci t) Dumu  ;t1oeeo ietltlm raumo t) ltomo to1faD lueo t tetrir no1ameelfvsat)s2umxm no1tleo ictadfa ea( o t0arxrir3ty1fp  auvi t) etoxr3ny4lptnlfeils)s2uau  ou1aeto i3tlslm2uan s (0alerif oo1omDelu i (0seurio oodalenlnvta(f 2ra(  nt4tlxn o3iys m2ra(msnt)trxoirciytfm raiesls) rtoxo iy4oltnmfvtas)artaum nu0ape  feilt mDuanmp (0areomr3tydomt lnvs;t0trtm(m oy4ome mnci ( a2ur(rooo4tlt  o3iatla2rmuvo t)alenmf todfmDeaneols srxo(m oo1lleemfvi (f rrr(rpot1tet iociytfs rmn snu)aeeoio3oatlaD lu s;s0srumxm3oo1aleelnesat a2rruroot1tlt io3iaslmDrmnvo;u0 exrmrciytfmt ai ols0 2xrimpoydamenlfvtlt)s2tm( ont4teen icild s rm(vp;(4teeomf ia1optrli o s) 2xr(m io4lp nlneia( aruru ont1teen i3iatla2ran p t4 lenxo ty1latrlneo;() 2to(o iy4lme lnci t  2urx ono0opxnmf3tld aDrm(ms;t4aexomociodfpteanvo s0t2xrim oy1optn icslt a2um( pno4teto fetas mDrlnvs;u) lenmo oy1oa r ivo t)t2xrxopny1lmtnmfcta(f 2trxro;t1alto i3tyd a2emn on(4 rtnio ta1fmtr ivol(0 2xm(opiu4lm nlnctat sruaum ou1tlxo fctyd s2rluvp;t) rtrxr3io1
\ No newline at end of file
@@ -0,0 +1 @@
+nvs ()srxm(opoodop elietas srurx pou1alxnifeild mDrm( o t)altnifcio1oatrau i t0tetm(r3iy4op nmnctat)aDtaxronu1tpto ictadla uluvp;t)altnxf oy1faD auvi;(  2uo(m ou1ome  icsa() Drm(ro;t0alenmfciadfs2rmn pnt)trerxfcoadlaD luei s) 2xoir3nu1amee ncta(fa2um( p;t1altomfciadfsDumnmsnt4 reomfciodomt anvo;t texo(m io1lme  ncslt) Dtr(m ou1ole io3iad aDrm( pnu4altrmrcoytopte ivi ()setm(o iudapt mfcs t)srtr(  ;t0oex iieildla2rl(vsnt)tlerxrcoadlm   uvs;s)t2xo(rpoy1ape  fct sfsrumump;u4oex mieilsfmDulnvon(0arenxr tytfpt livs;t teumxm3iu1opeelfeiasfaDra(mo;o4oleo ociysfm2ran p;t4 renmo3io1opDe n s;t sexrxopou1lm nlivilt)srua(rono1texnio3tatlaDraump;(4tetnxo3oydfaDelnvils0s2ur(mpoy4ole mfvilt aruaumpot1alx  iciltfm rmn s u)aetnxr todlmD li olt) 2trxm3ny4ale mnci t)srrrxmp;o0apen fciyt s2um(vo;()teerir ty1fmt anvol()trto(r nudomenmfvtl()sDtm(m no0aex ioeils m2ul(msnu4alermrcto1omD  ivsls)t2trxm3io1omeelfvs s aDururoou4tleo feiltfa uauvp ()arxnmo3oydfa ranes ()teurirpou1lm   feslsfaDrmurp;u0tptomoeiadlmDulnvsn(4aexrir tadfm  anei;t)seuoxmpnodaptn ics t srrmu ont0ale ioeiat sDulu o u0tlxrmo3oydlpDrluvs;(  2urir3no4lleelnct (fs2urx o;u1aptn iciyslmDua( o () ltnmr3iy1opt liei t srumxmpoydaltn fvs t) rrmumpoo0tpeomiciatfs ua(vont0aeenxfctadop rauvo t)tetr(o iydop elivsas)srurxmo;t4apt io3ildfs rmu onu0 eenif3iotlaD livs (0s2xoxrpnu4ll elfesat s2ua( o;t1tlx mfeiydfmDel( s;()trtnmf iotlptr u olt0teto(r oodameelncs (f Dur( oou4tpxn i3ilslm ulnvpnu)tlxrxrcia1lmDelnei;s)setm(r nydlle  ieslt a2trx  oo4ole  oetltfa emumsnt)tltoio3tytopDelieols0 rxm(opoo4amenmfcsasfa2tmxm nu4opx  oeiatla2uaumpnu)texoif ta1fp rlnvi;(  etmxo3iu4ame livsa() 2tau  ;u0alx  oetlt aDul(vsnu) rtnmocoatoa elnvs t t2to(m3oo4lm emivtat srtrur oo4apx ioctat m ran o u0 exrmr3oa1oaDelneils s2tm(rpiudope mnctl(fs2uau o;u0ale  i3iltfaDrln pnu0alxrxrcoa1om e uei s)srtrio nodlpee fcia() Duru oou4aet ioeiadfsDemuvpnt4 ltrxo iodomtrln ils)srtrim iu4lp  lfvtat  Dtmu p;t0tex  fetasfa2emump;u)aetrir3oodlate ivsl( s2trim ou4lm nlfcsat sruaxmoot0aee if3iytla emuvont4artoio3ia1laDrauvs t)setr(r3iodolenmics t aDurx  ou0alenmociltfs2emnvon(0trerxf3oytfpD aies (  rurim3io1olt  fetasf rtmx  nu0tpeo f3tld a emn on()artnir iotfa elnes;t0s2toio oudap n fcs t  rrmu pnu1tleomfcildla2elnms u0altrirciy1omt  ieo s setoiopiy4apeemiesls) 2taurpou4tleoii3ilsfsDelnvont)aexrir3iadfmDranei;t s2umxm3ou1lme  fcsa(fsrrau ont4aeeomoeiydlsDemu sn() rtrif3oydop eli o s) 2xoir3iu1lltnlneils  2ra(mpno4oleniietyt s2rlu o;u0tlxoxo3totfmtelueils0trxmirpno1olen net ( a2tmurono0tpxn oetldfm2ulu p t) rxnmfctatopDranvils s2xrxr3ou1lpt licils  rrmur nu0oltnio3ias s emu p;t0tltnir iotfmtelneslt0 eumxmpnu4altemfcs ()a2rr(r ot0tlx ii3iysfa rmu ont4tlxoiociydlatr u o;(0s2urio oo1ll nmfvilt)sDtm(ronu0apenmfeiadls2ua( p (4 lxnxr oydlpDeauvols0 2umiopoudaptelnvtl(f Dta(m oo1olt mi3iltfm2eanvo t0 lenircia1lmteaueslt  eumir3ou4lpte ncsa(fartmxrp;u1tlxoiieiasfm2rm(vont0tlxoif oatoaDrlu s t0 exoxopno1lleelfcsls)artmurp;t4aex  fctad sDem( o u)aexnxrcoy1lm ran i;s seto(o nudamenlivi (fs2ra( pot4apxn o3iys sDuanvsn(0texnmr3ootopDe nesl(0 exo(r io1opt  icsl(  Duaxrpnu0olto fctlsfa ulu o;()arerxf3iotla  lu olt0 exoxm io4om n fcs s sDtm(ront0opx ii3iatfs ulnmo;(0 eeoxf3oo1op  lnes t0t2uo(m iydlpe lnctat a2tmxro;o1olt  ieils sDemnmp;u)trtoxf tydfp elivi s trurxo iu1opt mfcta()aDtrxrooo1oetnio3iydfaDrl(vs;u0teerifcootfatrlivi t0srxr(rpou4lp n ict sfsrrrumono1aee ii3iyt a uln onu4altnxocty1fm   uvi t sexr(opou1lp nlncils  rrm(  nu1alto oeilslsDea(ms;u)trtnxf totlmtrai o s)teumxo iy1amt mivt sf Dtrumpnt1apxoioeiadlm2ean p;(4 reoif iodom  aies ()srur(r3no1lm  mneiasf 2uaxrp;u0oltn iciytfs2rm(mp ()trtoxr3iydom r nvi ()s2xmirpnu1ome licsas)a2ur(mpot1apt  octadlsDrm(monu)tltnmfciotfm   neolt)seto(r3nodlpe  neiatfaruax  ot1tetnmo3ils s2rmumo;t)altnxoctydlpt lnvslt trtrim3no4lptnmics t a2ua(r no4oltoioeiad a2rmnvs;t4teenxrciodlate ivolt texmio nodalenmivt s) Dtr(rpnt0teenio3tas mDelu s u4aexoircoodom ranvils) rum(r3io4lp  mnvilsfsDtru  ;u1tle  f3iatfmDel( s ()trermf iatlptelivi;t0t2umir3iydapeemfes (f Draxrpou1ole mf3iys m2rl(msnu4trtnifcoa1opDeauvs s)truoxr3oo4llenlfetlt)srra( ont0tleoifeiltlm2ulump;()tlxrxrctotlatr uvs s)srxrxopiydam emivsls)aruru  ot0tpx moeiasls rln p u)tleoio3ia1fa raivs ()t2to(rpny4omtn ivt t) Draumpnu0tpeo oeiaslm2ulnmsnt4 etoir3tadla  aivo (0tetriopiu1ole  nctas)srrax p;t0tpen octlt m2uanvsnu)aetrmrctatlatr nes s0teum(m nudaptelieilt)aDurxr ;t1tlen feils aDuanvs t4arermf3oytfm  auvo;s)sexr(rpoo1oltnmiei s aDtr(mpoo0opx iictasla umn p (0 rtnmfctydlptr u i;(0trtr(o iu1amt lfesls  2rmxr ou0tlto f3iytfm rmump;(4alermr3ty1oaDeau i;t0t2xmio3iudllenmfvs () ruax p;o4tltoifciytfa rln snt)aexrmfcty1fm r ivs;t0trumxopnu1ll emfcsl(f Dumx  ou1oex ifetad sDuauvsnt)artnif3iatfaDe ivilt sexm(m3oo4altn fvtlt s2taxm ;t0oee  o3tas m um( s u4artoxf3iatop rau s s sexrimpoy4omeelfvsat sruax o;o1tpx  ieiltfsDuan pnt4alxoio oo1fp r u i (0trxm(o3oo1lpenmnci t sDtrumo;o1apen iciat sDua(vont)alerxrciydopt  uvilt t2toiopnodaleemnct () 2uru  oo1aexomfctadla2um(ms;u)alerxr3oodlaDe uei t)trxrxr oo1olenlfcslt  2ra(mpno0oex  ieiadlm eaump t4altrxf3totomDrai il( trtmio3oudlpt  fcils)srum(m ot4oltnifetas m rau o;t) lenmo totlm elu s s s2tmxm3iy1apt  nesat)aDrmxmpnu4tpeoio3iasfa elnmp;t0trxomr oadfptelneol(0tetoim3nu1am  lnvsltf 2trur ot4olxoioeiltfs2rl( p u)altrmociotlaDr nvo (  rxm(m3iudal emnciatfsrtr(r ;u1tltoiictas aDum(vpn(0artrxf ia1lmDeliei;( trtr(rpio4oleemnetat  ruru  nu0aet  octld a2rl(vs;(0 eerxo ta1oa eaneo t) rxrxm3iydopenlfvt t  rrruro;o1oee  feiasfa2umuvsnu4tltnif3oa1fm rli i s0s2urirpoudamenmfci s  rrr( pnu0tlt mfctldfm el(vpnu)tetomf iodop e nvsl( seumxr3iudap n fvt t)aDurx  ou1alxomo3iltfs em( onu) lxniociadla rauvs;()setrxmpnu1lltemneils arrrump;u4tpe iociyt s2ea(mon(4texoiocto1oa eluvilt sexr(opoo1om nmfetasf Drmx o;o0oetnmoetatlm2rmumonu0aeeomf3ta1laDeluvol(0t2xoxr io4apeelietl(fsDum(m ;t1olx mfctatlm rm( o t0 etoif oytlp elnvi t)t2xmir3iudam e nes tf rrmx pou0oexnioeiasla2emnms;(4tlxomo3oydlaDe n i () ruo(m3no4olt  ivsa(fsruru pot0tee mieilt sDrln o u) lxnif oodfp r neolt) 2uo(m iy1lp e fvtat  rrrxrono4apxo ociyd a2emn p u0tltrioctatlm   ivolt) etm(m io1lmt lict s  Dtruro;o0apeomf3iyd a um(ms t0aeeomo oodfatr u i t)trxmim oy1lmte fcsas)srtrur ;o1tltoiiciytlaDemnmp ()trxoirctatfatr u slt0texoxrpoy1ameelfcsatf 2taxr ot0opxn ociydlaDelnvo u0aetrxf3iodlpDr uesls0srxo(m3iu4lpe  fvtas)arrmuro;t0alt iieiatlmDelu s u0tleoxf3io1opDe ivslt0 2xoxrpoo4olen ictatfarrmum nt0apx iictls a uaums t0 exrxr3ootopt luvi t0texoxm oy1optelnvil( aDtmxr ou4tltn feiatla eau o;(4 renmocoa1lp  lnei s  2xrim oudlmtn nvt t  Dumxmo;u0tex ifciatls elnvs;u0 rtoio oadlaDeauvo;t0 2uoiopio4apt lfvsas artr( pot1oetn f3iad mDem(vp;t4aexnifciydopDe nvi;s)texm(o no4ol  lfvslsfaDrmu pnu4tpto feilt s rluvp;(0aetrmf3tydom   ivo s)tetoir3iy4lpt  fctls arta( pou4oet iictyd mDum(vp;t)teerxf oadom  aneols0s2xr(r3nudlp  mnvs t aDrrum ;t1aleoiociytfs2eanms t0trxrxfciydlp  anvs t) rxrxmpnodlpeelivta()a2rmxmp;t1ope  oeiasfs2emn o;() ltoxf ty1oatrln slt0s2xoirpiodamen nct () Dtrurp;u0tleoioctat aDulnvonu4trxrio3iytopDeln il( srtoio no4opte ncsat  2uau  ;t1aeeoif3iytlmDeau p;(4aeenxfctadfa rln o s teuoiopou1amt  fvs ( s2ra(mo;t0alt  ociatfa ra(vo t)altnxf3todla rli o t0truoxr iu4ll  lfvs sf Dururo;o0oltn oeiys s2rmumont)tlenmocta1fpDrau s;s)trxr(mpou4opt licsasfsDtr( o;u4olt  ocildlaDrmnvs (0 rermo oadfm e ues;s)srurxo nudlptnlfvias  rumuroot1oetoif3ilsfm2umums (4 lxrxr todop e ueolt) eum(o ou4om nmnet t) Dtmumpot1aee  o3iasfa2ul(mpnt0tltrmrcto1oa eau s (0 2xoim oudop nlivsat s2urur no4tee mfetls aDrau p;u4 eerir3oytlatr uvsl( seuo(opio1optn nvtas s2tr(mp;o4optomieiat m2rl(ms (0trxomoctytlmt lnes;s)teur(r no1al emfvt s  Dtmx p;o4aptnifcilsfs2elums;u0artnxr3ootom r iei (0 euoim3iydamtnmncs ()arrr(rooo0oeen i3iyt a rm( s t0trxrxf iadlpDr uvs ()trtmim3no1opeelfcta(faDtr(rpoo0aetoiietytfs rmnmonu)artomf3iytlaD lueo s0 etr(m3ou1ap  mict tfartmum oo4oexnmoeiasfsDra(vsnu)treoio oytfmD  n i;s)seumirpio4ol nlfvtls  Durx  no1tleniictadla ulums (4alenio tadlatraneo s0srxm(r3nu4lm nmfct tfa2uau o;t0tle mo3iad m um( on(4aetoiocoatla rln i;s0sruo(r3nu4aleemicilt)sDrmur ot1oeenioeiltfm rmums () lxrxf iadfm r u s;t)s2xr(o iydome mfci s)s2rmxrpnt4tpenio3iltfs2rauvsnt0texoxr3oadfm rlues t0t2ur(r ny4op nmfvsl( s2rmxronu1tltomoeiytla rm(vp;(0tlerirciydlmtr nvo;t srumxr3nodoptn iet ()s2taurp;t4tpx  icilsfaDrau o t0 rerio3io1lp   n ilt0sruoirpnudol elfvtls) 2ra(r nu1oetoifeiyt a em(vs (0texrif to1lmtrluvo t)trxmxo iudale  icta( arrrxmpnt4aetomfciyd m rau p;t) leoxo oadfp eln o;s0 2xoxmpoodoltelfesas)a2trumooo4aptn ociytlaDrmnvsnu0areoxrciydomte uvo s0 exoxr3oudol   fvi sfa2rmu  ;o4tleo ietysfaDrmuvon() eenmo3iotlpt  ivo t)seto(r3io4omen iei s)aDurxr ;t1aex mociys mDranmp;t4trxrir3oodfpt lnes;t0trxo(mpiu4lmt lict s a2rmu poo0aeto i3iyslsDuaumo (0aexnmrciadfmt  i olt) euoimpoy1lp elfetl(fa2rrxm ou0olenmfciydfs um( s t0alenmrcio1lpDe iesl() 2xm(rpio1lmen ncs (  2urur ou1tlxoifcils aDua(vpnt4 rxnio iotlmte nvi s0texo(r no4al  lnesls) 2taur ot1tptomf3iadfa2umn s;t0areoio oy1lm raieslt)srxm(mpou1omenlfcsat)a2ua( oot0tpt  ietadla2uauvo t0trxnmo3oa1la rlieolt0 rxoxr oodap  mfetat a2uaumpou0alxomf3iasfs2emump;u4artnir3io1lpD  u s s teuoim io1om e icilsfartmxmoot1olx if3iltls ra(ms;()tetomf oodomt  n i t)tetmxr no4ome  ivtls) Dum(m ;o4tptn f3iat aDum( pn(0tltoxr tadlptr ues;()s2tmim iydlpe mfvs ( aDrau onu0teto ieiysfa rm(von(0alenxf tatoaD  n s;t)s2trxm3no4am  mictat)a2rmxro;t0tle  iciysfaDemnmo;t)arxoxfcoodomtr u i;() rxoxrpnudlltnmivsat sDtr(rpot1apx io3ilsfsDrm(vo;(4tltrxo3totfateanvo;t)seto(rpoo1llt miesls)artrumo;u4alen icils s2uau o;(0aetrmo iadlmte i s;( t2xmio3iu4amee nvi t)aDrrxr ou1oleomo3iydls2rl(monu4texoxfciatfat aneols)seumimpou1amtn net s)srrmx ont0apxomfetad m rluvs (4tlenmrcoydfa rli i;s)srtoxr3iy1apt lnesl(fartmxmpou1oetnmieiytlmDeauvpn(4 rxomocoo1fm   u i t  rumxm3ou1ap emncta() Draumpot0openmfeiadla elump t0alxrxo io1lm rau s;s0srtoxo3nu1ll  lncsls  2ur(mpnt0ape  fetasfs rm( p ()aexnir3tydopD  n ils)srumir3oy1lmenlfvilt)sDrru p;t4aleo fciatfa umn p;()teeomf3todlaDelnvo;() 2tr(mpny1lp   icsl(fsDrm(  ;o1tlx ifetatfm ra(vo;u) rtoir3tatlmte u olt  rto(r io1opeelfvtat) 2tmxroou0aeeoifeildfs elums t4alerxfciodomteaues;( teurxo iy1lptemiesat a2ra(  ou0apx io3iyd s2rluvo t4 etnxo3io1om   n sl() 2uo(opny4lm  mfcils)s2rr(  ot0apxo ieiatfsDelumonu4aexoifciytlm rli i ()s2toxo ou1ame  fcil( sDrmumonu0olxomieiatlm ul(msnt4trerxr tydlmteln olt  exmim3oy4am emnvtas)arta(rpno1olx ifetltlsDemumsn()trtnif totfmtrlneslt)t2xoxo3iu4lptn nvslt a2rrurooo0oex  octas s2umn o u0artnxr3io1omDe uvsls) 2uoxm nydolt micilsfs2rrx  oo0tetomoctldfsDuln on() renxfcia1oat anes s) 2uo(m3io4apt  fctat)srum(  ou0tpt  fcias s2ul(mo (4 reoifcto1opDrau o;s) rurim3oudomen fcsl()a2rrxmoou0opeo feild mDul( s;(4 eenxociatfate ieils)srxriopny1lme mies s)s2ua(m ;u4tlxomf3tls s2uluvsn(4 rxomfcoytomD anvslt0sexo(m3ny4ll e nvt s a2rm(  ot0texo octasfmDean pn(4aeermfcoatfm rli o;t)setrimpiu4ap n fvsl(farrax pnt0aeen octasfaDrl( s u)artrmr3ia1om rauei s) 2xm(mpoydal n fetat  rtru ono0aex ifciadfa rmuvsnt)altoir3tatfaDeai sls tetrxr3nu1ol emneiat arta(m ot4olt ioeiydls2rauvp;(4alerir oydopteanvo;s sexmxo io1lpee fvtas a2ra(  ;o0tpxomfetadla2rl(vpn(4trerxr oytlptelnvs s0srxrxrpoo1lle mfes t sDraumo;t4olxnio3iad aDelnmpnt0 reoxr3ia1faD aues;( seuoxo3ou4oltelnciltf Duaxmp;o0ale moeiad a2em(vp;t4trxrmo3ty1lmtrlies s)srumxmpoo4lptnlics (faDuaxr ot0texn f3iadfsDum(mp;t4trerxfctotla eaueols  2xoiopiy4al e fctl(  rrrx o;u1teenioetatfs2rln p;u4texnxrcoodoate ivsls)srumim ou1om   fvta()a2taurpoo0aetn i3iydfs ulu o;u4trtoir3oy1latr n i t tetriopiu4amenlnvt s)aDrau p;u0ale mietlsfa2um(msnu0 rxomfciotfm eli i t) 2xo(o3oudolt lncslt  rtaump;t0optn i3tadla2eauvs () exrxo totlaDelueols0tetrxmpnydap nlnvia(fa2raxr nu1tex ioctys sDemumsnu4trxomr3iatopt aivilt) etr(mpoy1aleelfeia()a2trxroou1teeo f3ilsfm2ranvs (4aexomo iytomDeluesl(0trtrir3iu1lmtn nesas srumxroot1tet  ictldfaDulnmonu0 eenxf3tytlaDrlivi;( trumxrpoo4ome  nciat)srtmurp;o0optomoctyd sDra( ont) rxoifcoadlm elnes;s setm(o io4am   ivtlt  rtaxm ;u0tpeomo3tydfm uau o t4arxoiocia1fpDr neo t  2trxm3nudop  mfvtasfsrua(r ;o1alx  octatfsDra(vsnu) lxrmf3tytfat au sl(  exm(m3ny1lpenlivtl(fs2raxrono4tpenmicild m el( o;u0tltoirctodoaD lnes;(0teumxm3nudam nmivtl(  2tmuront1teto fctytla2elu s u4 leoio3totlmtelnvil(0srtrim3no4lpenmivsat)sDtr(  nu4opxnmiciysfs ra(vsnt)treoio3totoaDrlnes ( teum(r3oo1ap  mietat)srrmumo;t0alxn iciys a2ua( o;t)trtrio3iatfpt  i o;( seumxr3oy1optelfviatf Duru pnu4oeenioctyt sDra(msnu0 renio oy1op rlnvslt0trxmxo3oy1om nlnes t aruaur ot0oexn iciatls uanmp;(0altnxoctatomD ai o t0seurio io4ape mnvt (fsDurx p;u0altomieilt m2emumo;(0arxnif3oydomt an ol(0seum(mpnydlmt lfcsa()s2tax p;u1olxnmieils aDraumo (0texrmfciotoaDeanvi (0srtoxm3ou1ole  net s  2raxmono0aptomociytls2rluvp;u)arenirciotoaD ai il( s2uoxm ou1olt mnctatfsrtru  ou1oexomocild s2ulu s;u)tetrif3tatlpD  ues s0srum(opiydome lnvs ()artax  nu0tlen ietltls2rmnmp t4arerio3oydfmDe n o;t)s2xr(opiu1olt livilt)artm(mpnt0oeeomoeiydfsDemu s;t0tltnxfciadom ran o s0truo(o nudap  lneil( sDtaxmpnu0altnioctasfa umu s;u4arxrxoctydla eanvo t0sexmiopny1al elfcs t) Dra( o;t1opxnifetytlm rl(vsnt0tlxrirctatlmDrau s;t  etr(mpio4amtelncs t a2tau  oo1aleo i3iad aDrmnvont)aeenmrcty1lmDr neo;t)trur(rpnodolenlnvtlsfsrurumpnt4oexoif3tatfa2rlnvs (4altrxocty1lmt lneols) rtriopiodaltelietls) 2tmx  ;o0apt mfeiltlsDrlnms;t4tltrxrcoo1omtraivi;s)sexr(r3oodopt mfcsa( srum(rp;u0oee ifciys s eauvp t)tlxomo iydoat lu il( tetmxr3oy4altemfvi ()s2ua(r oo1ale mfeiasfs emuvsn() etrxf tydfa r ies;(0 2tmio3oy1am  mfcs (  2uaxrpot4tlen oetaslaDeaumo ()trxrif3tatlmDr u ilt  2trim nu1lmeelicsa(fs2urx pno0aexoiocilsfa2rm(vo (0 lxrxo tatlat au ol(0srxr(rpiy4ame lieiat)aDumurp;u0aet  ieiltla2emn p ()altnxrctydfateai il( t2tmxm3iu1lm e fcil(f rum(m ;u0apxoiieildlm em( o (0 rtnxo3iytla  auei;t) 2xoxr3oydlleemfesas) Drr( oot4oexnmf3tld s ea( s u4tlxrxo iatoate nes;()t2ur(r3iu4ol nmfvslsfa2rmxmooo4tlenmo3ildlmDeaumo ()trxrmf todfpteln s;s) rxo(m nodam nmfciat) Dtaxr oo1alt mieiasla2um( p;u4areomf todlmDrlueo s) 2urir iy4ap eliesls)aruaxroot4apt  oetlt m eau o u)tetomr3oydlatr i i ( truoio iy4op elnvilt)s2umurp;t0altn f3ildls rmums t) ltrio3oytlpt anvs;s)s2xrio oodap e nesltfsDta( oou0tlenmf3tlt aDul(vonu0trxrio3io1fpDelnvi t0srxo(o3oydlle  icslsfsDtr(r ;o0tpxoiieiat a2rln p;t) ltnio3todla  au ils)teum(o3ny1ol e nvi (fartmump;o4olx moetltfaDranvpnu4aexomfcoytfpDelnvs t0truoxopny4lpen ietas) Dtru  ;u1texn i3iysfaDemumo;() rermocoytopt  uvo s  etrxrpno1omeemnesasfarur(mpou1oexomi3tadfs rl(vo (0tlxnmfciotlmt  i o;t)t2uoxm3nydome  ieia( s2umxm nt4ale  fctldfm2elnms;u)trenxo3tydfat ai o;t t2xoxopny1ape  fcs tfsrurxr nu1aeen f3ildfm emums;t) rtnxrcto1oat luvil()srtr(rpoo1am nmfes s)srrm( pnt0apt  o3iasfs2ulums;u4 exrif3iydfpD ln i;( srto(mpiu4apeemiet tf 2rmx p;t0tpe mi3iytla2emuvont0 lxnmoctatoa   ivils)texr(o3io4aleemnet ( s2ua(moou1apx  ieiatlmDeanvs;t) etnif3oydoptrli i;( srurio3no4lle lfeils) Dtr(r nu0teenmf3iat sDeln p (0areoio todla r n ols)s2ur(o3iy4llte fcsat aDtmump;u0oleomi3iyt aDrm(vs u)teenifcoatlpDelivsl( trurxr3nodap emicsl()aDum(r ou1tptoii3iydfa ul(mp t4 rermr3to1lmDeanvsls)srtrir iy1alt  fet t  Dtm( o;t1ole mo3iydfs umnms;u) renirctatlaDeli ils srxmxo io4olenmfvi tfaruaum oo1tpxoifeiad a2rauvo;u4arxnmo tytopDr i s t)teuoxopnudamtemivsls)arumump;o1ale mictadfs el(vo;() ltrmo3iadomt  ivsl()t2toxrpoydalee ncil( aDurur ot4tpenif3ilt a2rmu s t4tetrirctatfateln ils t2xoxo oydlp  lfcslt s2uaurpnt1aee mfcias aDranvp;t4arxrmf ia1omD  ues;t0setr(o3iydamee ivtls)a2uaxm ot4aet miciyd m ran o t0aexoirctadoa r uvi;t  2to(r nu1amte fvsasf rtmu oot1opxoiiciyt sDulnvpnt4trenxf tatla   ueo;s  exo(r3nu1al  mncta(f Durum ;o0aptomf3iys s ean o t4trerio ta1latr nes s t2uo(mpoo1op  lneils  rrr(  ot4olto ieilslmDuauvs (0aexrxf3iydlpDranvs t  rxr(o3nydale lfctas)aDtrum ;o1opto feiatfa uauvp;(0alermr3oytfptelivils teuoir3iy1llenlncs ()sruru  ;o4opxoioeiytfm2el( o;u0aeeomfciotlp ran o s0t2toir oy1lm emicia(  Dtmxmpot0aptomociadla rmnvp u)trxrmo3io1lpD  i il( trtmxo iydlme mnesasf rumu o;u1tee  ietytfs2rlnvsnt0 rtoio3tadopDrlu s s trum(mpiodamt lneilsf Dra( pno4oet mociadfa2ulu s t4 lxrxo3totoaDeau o;t)t2trir3iu4ape  nci s aDururpnt1oet  ociat s2uau o;()altomfcio1la elu i s setoirpiu1optelfetlsf rtmum nt1apxnmfeiat a2emuvsnt)aexomf3totoaDrlneilt0t2urxrpoy4lpeemfei t)sruau ono0optn octlslm umu s (0altrir3tadoaDr ieo;t)s2xoxr3iy4lltemfctls  Drmxm ;o0alxn ieiat a umu s u0 ltrxf3tytlatraieilt0t2umimpoydllt lnvtat  Dta(m nu1altnmo3iysla2elnmo t0arxnif3io1opDr i o;(0srtoimpnu1optnlneias)srtr( ont1alen o3tyslsDrlnms ()altoxf3oy1fm e u s s0t2uo(r iu4omenmivilsfs2raxmpnt0opxomf3tydfm elump;(4arxrxoctadopt anei s  rurxr oydamt  nctasfarrm( p;u1apeoiocils m2el(vs (0aetrircoa1laDelu s s0sexoxm io1am nmicils)sDrmxmo;t1olt iociat s2rluvo u0 eeoxo3tytfm raneo t s2umirpou4al elici s s2umu oou0tetoifeild s2el(monu0aetnxr tytfmtrai ols) rtoio3ou4oltn netat) rur(mo;o4oltomfetad s2umuvo;t0arermo3tydopDelieil( t2xm(r3iu4lpenmncs (  Drau  ou1opt mieiydfmDelnvo;u0aexnmrcia1omDeaieo;() 2xoxm no1olenmnvi s  Dra(  oo0olx mf3tydla rl(mo;u4texnmocoatlp   nesl() rxr(r3no1lmte fvil(  2ua(mpot0olxomfeias a2eauvs;t)artoxr ootopt luvs;s)teto(r oodopeelnvt s a2tr( pnu0tlto ietatlsDemn s u)aleomf3tadomteaivs (  eto(rpnu1apt  nciasfsDurx poo4optnif3iys mDeln o;()tlerxf io1fmD li i;( t2to(m oodom  mivsas sDrr(  ou0tptnmietltfm ranms (4tetrmf3tadla e uvo t t2umimpoudal nmnvt ()srrr(rpnu1aptnmfeiydlsDean o;u4 rtnmo oytlaDr ueo;(0t2xmir ou4om n nvtat  2ua(mont0tpxo i3tadls elumpnt)altoircoodfmDeluvol(0srtmxopoydlp n feta()s2um(  ;t1tptniieilsfsDemnms u4tltnir3oadom e neo (0tetmio3oo1olt mivsa(f Dtrur ;o1alxnmoeiysls2ulu o t0trenxr oodoa elu i s) rto(r iy1lptnlnvils) Dtaxro;u1tex  fetldfmDuauvs u)altrio3oodomDrln o;t0t2tmiopnudap n fes (f rrmum ;o1tlto ietysls rm( pnt4 rerxrcoa1fmtean s s) rxmxo3oydamtnmfcil() Draxmont1aet  iciasfs2rm(vs;u4areoio iydfmDelivsls0trtmxrpiy4apee nvi t)sDtmur ou4tee  ieiysfa umnvp;(0trerxo3iatfpD livs t  rtmxm ny1ape mfvtltf 2ta(m oo4tlxn ocilslaDrm(msn(0altrxrcoytlpD an o;() rur(opiy1amtnmivsl(farumx pno0tpxniocils mDrmnvp t4 exoirctotfa eaueslt)trxoxr nu1apee nes (farum(rono0tlxo fciatfs rmnmpnt0trenxo3tydfaDraueo s t2trirpno4lpt lfesa() 2rrxmp;u4oetn iciatfa2el(vs t)artrir iydfpDr n il(0 euoim nydole  neils)s2tmxro;o1opeo oeiad s2umuvs t4tltoxocoatlmtrln i;(0s2urxopoodllee ivtas) rrax pot0aexnmfctytlaDulu p u0tetrmr iy1fat ln i ( truoxm oo4lm  mfvtls)aDraurpnu4olxn o3ildla rl( p u) lenxr3iytopteaiesls  eurir3nu1olen fcsls arum(m ot0tee ifciadfs ulnmpn()tetoifcio1lp  lneslt truoio nu1olenlicilsf rrru pou1texoiietytls em(von(0aexnxocia1la  lnes;t0s2urxopno1lm  lfeia( sDraum ;t4oetomfeiasfa2rln o;t) rtrmr3totfm eaivols  eurim3io1al e fetasfsDuau  ;t4ole  ieiasla2umu s t0aexrir3ta1omDeau slt  euoxrpiu4amt  fvtlsf 2umumpot4tpxomfeildfa rl(mpnt0aetoxf ia1fmte n ol( srtrxmpno4oleelietat arrmx ooo1oex iietadls2rl( sn()trtnmr3oodfaDraueols0seum(r3iu1ole  ivsls)srrr(r ot1aleomociltla2el(ms;t4aetnxfcoytomtelneil(0srur(m oo1olenmfvtl() 2rrxr ;t1apeo f3ilsfs2emn p () exnmrcoydlp elneslt) etoir ny1amtelncs s srrr(  nu1alt mfciaslm um(mo;t) etoxr oa1oateluvi;(  2toim3iy4am nlivsls)sDuau  nu1altnmo3ilslsDrmn s ()aexoircoodomtrau o t0s2tm(rpou4ol nliet (  Drr(m ;t0ole mieiysfa uauvpnt0artoxrctatlpDeaueilt) 2xmim3ou1alt licta(farumu oot4aeeoio3iad a eln o;(4alxrir iydoptranvs t0setmim oo1omtnlnes tfaDur(mp;t4altn fctys a2uau p t4aexrmrcto1om e ieo ( s2toim3oudom nmnvtl(f rtm(r no0aexomo3ild s emnmo;t0arerxr3tatfmtr ueo s  rtmirpny4lmeelneil(farurumo;t4ole mfeias sDem(vo (4aeerxo io1op eaivi;s0trxr(mpno1optnlfvslt a2rmu o;o1tpt  ociyd mDrm( onu)tlenmocoydlp  anei;(  etrio iu1lp elicsas s2ra(moou0texniietytfm2eanvo;t4trxoxrciodlpDrlnvs;()sruoir nu1altnlneils)arrrur no4alxn o3iydlm2uln s (0aeerxf tytfp  lueo (0trumxmpou1lm emnvia(fsrtrx o;t0ole iiciasfaDeauvp t0 eeomo totomD  n ol(0 etm(m ou1om n fctlt) 2tmxmoot4tle mfeiytlm2el( o;t)tlermo3oo1faD livil()trxoim io1omenlnciat  2tmum ;t4openmo3iys m2elnvp () rtnir oodfaD lieols0setm(m iu4lpe  ieils sDrm(rpnu4alxo o3ilt sDumu sn(4teermrctatlmt  ies t)tetoxo3no4am   iet sf rrm(r ou0oex if3iys mDeluvp;u0 etrio3tytlat an s;(0 rumxr oo1lm nmfcslsfsrumurp;o1apeomo3tadlm2rl(vsnt) rtrmf iy1fmte n o ( s2tr(r iy4lmeelnetltfsrurxmoou1aexnmieiat s um(vp;(4trxomr todlp  luvils) 2toxopoy1om  lncsat) Drr(r ou1aee ifctytls2el(vs;(0 eerxr3iy1fp e n s () eum(opiudole lfct s artaxmono0tetoio3tysla rl( pnu0tetnmociotopD ln o t seto(opoo1omeelfvias) 2umur no4apen octld a ean s () lerif3iadoate ieils0setmio3no4altemfetlsfs2tm(  ;o1tlx miciyt s2elu p t4tlenif3tydoat an il(  rurimpoudlptemfcsl(f 2um(mpoo0oleo ieiatfa ul(ms;(0altoio3ia1lpDe neolt  eur(mpou4aptn nei tfsDumu poo4oeto o3iatfsDel( snt)aetrxoctytlpDe n o () euoxo iudamee fvtasf rrrump;u4tleoiociysls rln onu0trxrio oa1fp e i o s0sexoxopoodam  mietat sDrmu onu1ope mfciatlsDea( p (4tlenxf3ootfateanesl(  exo(rpou1am emieiat)s2umuroou0apxn i3tydls rmuvsn(0 rerioctodfmtraueil(0 rtmxmpiy4lmenmieilt)sDrrum ;u1alx ii3tas s ua( pnu0 rtoifciodfp   ies;(0 eumiopiudol e fci s  rtmuro;t1oexnmi3tytfs2el(mo t0 rtnxr3ta1opDean o (0 2toimpnydam n ivslt  Dra( o;u1tltnii3tlsls rm( s t0trtnifcoa1fp  lies;s) 2xm(mpiudole lies s  2raur oo1aetn o3tydfaDeln on(4trtoiocta1om   uvo t s2urio3iy4lptnmnetlsf rrm( oot0alxniietydfs ulnmpn(4tleomr3oa1omtelu o t0srxo(m nu1ame mfvsa(  2tr( o;o4tex  feiadfm elnmp (4tlxomo3oa1fmDrlivs;t0texo(r3nu4amtnmicsls)sDtaurpnt4oetnio3tyt aDelnms u4altomo3iodfpDraieo;t srxmir3nydop nlicsls)a2rr(mp;o0teenif3iyt s elu p;u0tltoxf ty1oaDe nvs;t0sexmxm3iydolt lnviat sDrrumont0tee  fciadfm2ulnmont)trxoio3tytfpte uvs;( teurxo iy1amenlncsltfaDtm( p;o0oetn ieiltlsDrm( o;t0trtoiociatoaDeaivi;t) rxr(m no1ol  mneil()arumuroou1oexoioetatfm elu o;u0arerio3iytop  lueolt0 rum(mpiu4lle lnvi s) Drm(mpno4tpx moctldlm2eln o t0trxnif3tadfmDrlivols)setrxo3iydal emictl()aDrm(moou0openmoetydfaDulnmp u)aeenmociadfpD  i o;t)sexo(m3oodal  mfes tfaDtrum nu0olxoifetad sDuaumsn(0teeoif3totfmD lu slt tetm(r3io1apenmiet s srtaumpoo4apen fctasla rmn s;u4 etoioctadfmDeauvsls)t2uoxm nu1amt  nvtls a2uaur oo1tex  octlt m rlnvo t0texnir3iy1fa elu o (0 exmiopnydlme mfesl(fsrtr(  ;t1olen ocilsfs eanmp () lxoio iadopD ai i;(0 2uo(r3nu4oltnmnvia() Dtrump;t4oee iicildls2elnmpn(0 exrxrcia1opD  nvo;s  2xrio3ny1al elivia(f 2rmx pno1apxo octyd sDeaump u0 rtomo3iadlpD ln i;s0s2xmim3no4op n fvs ( aDtrx  ;u1tlx  oetaslm elu o ()artnir3tytlmD anes;(0s2uoirpiydoltn nci s a2ua(  ;o4tpxomocilsfs ul(vonu4 exnxr iodlpt lnvo t teuoxo3io1alenmfcsa( s2tm(mp;o4olto oeiat sDul( pnt4tetrio ta1lp e ueo;(0 2to(r nydolenmivt tfsrrrx pot4altoioetytlm2emu p;()aeermo3ootfa eaivo s0 2xmxo nudaptnmfvilsfarurxr nt0tet moeiat sDum( sn(4 exrifcoydoaD anes;(0 rtmxm io1ll n fei ( a2ur( oot0texoiietyt s ra( ont0 exrxr3iytlmDeaivi s t2urio iu1llee icsa(  2rr(mo;u0oeeomf3tyt s2ua(vo;t) lermfciodoptr ueils0seum(mpoo4ll n nvi sfa2rr(m ;u0oee  ociyt sDrl(ms;t4aeeoio ta1fpD  nesl( s2xrio3oo1llen nvs tfsrtauro;u0oexnmf3ilslm el( pnt0artnmf3iytlatrauvs t  2urxm3oo1aptn nvt s s2trxro;u4aexoif3iad s eln s t4areoif3oadfp eaivi (0s2xmxm3oo4alenmnvslt)sDtr(mp;t4aexnmfeiyt m ul(mpnt4 ltrmo3iydfp eai ol()trxmxo3iudlleemfvi () 2rmu pot4altomo3iaslmDea(vo t)tleoioctytfm raiei s0 exoxr3iodopeelici s aDraxr ;u1optnioctlsfs eanms t4 rxrmr3io1fm ran o;s  2xmxmpio1ll e nvi tfa2rmum nt4olenif3iytfa rau p t) lenxr oo1op e iei;t)setrxopio4openlict ( aDtrx pou0ale miciysls ranmon(4trxoxo3oa1latr uvo s teuoimpiu4olt  fct s)s2ta( oot1aeto f3iltlm2uanmo u4aetnir io1fp raueilt) 2urimpnodal emnetlsf 2rm(rpoo1apx ioctys s ra(vsnu0tlenmf iadfatr ieo t)sexo(opiodol   fvslt aDtmxmpnu1tlto f3tat m ulumpn()aetoir ta1fmte nvi;t  2uoimpnodale  ivs tf rumu p;o1olenmo3iatlaDul(vo (0alenirctadom rlueols t2toio3no1lme mfes s)arurumoot1opeo fcilsfs eanvo t) lenmr iatoa e nvsl(0 rurir3io1omenmnvt t s2tr(  oo1alt ifciydlm ra( p;u4tlxoif3iytlmt aiei t tetmxr io1ll emnvsat) rrmumooo4tptoifcildfs2ul(vpn(4artrmr io1laDr ieols0texmxr3ny1ame lneslsf Draumo;t1tltn ieiad a rluvs;u0artnmo3iydlaDeaivs;( t2trxopny1oltnlnvtasfaDrax o;o4tpt  ieildlm2uanvo;(4 exoir3iotfaDr i s (0srxo(rpny4ap  mivsatf rur(  ;o0apt io3iltls2eanms;u4altnxo3tadlaDranvo;()srxmxr3nudaltelfeilsf rrru ooo0alx  f3iyslm elumpnu0 lermr3ta1fpDeaneilt0 eumxo3no1amtnmnci tfsDrr(ront0aptn ieiys mDrmnms;t)aleoircty1oaD anvo s0setoxr ny4lptemneilt  rrrxm ;o1tltomieiadlmDrlnvo;u0 exrio io1laDeluvs t)trxm(r3iy1amenmivsas)s2trx o;u1tee moetadlsDua(vpn() ltnio3oo1fmt an s;( trxm(m iudlp emnci t aDur(mpno1apx mietltfaDuluvp;()trerir totfpD lu s;() eumxopoodlm nlnctlsf Dtaxmooo1aex mocils s2umu s (4aeeoif oo1oaDe n sl(0s2tmim nudlmt  nvt t)srtaxm nu0tpenmfctatfs2emnvp t4texnxr ty1fa eli ols srto(rpoo1ol  mfcs ( a2rmumont0tpxo octatfa elnvo t0aeerxo totfpte ues;(0 2xmio3oy1lmeemivia( sDumxmoot0alxn ocils m2eau s ()alxoiocty1lmt auvolt)s2tr(o3nudapen nvs ( srtm(r ;u1tlenio3tysfs2uanmsnu)altomociadlp r n il(0 rurxrpno4lmtn fctlt)artmur ;t0tpenmi3tas m2em(mp u0 lxomr3tydlpte u ilt  rtrirpiu1alenlnctatfa2tr(  nt4aleoio3iad m ea(vpnt0tetoir3todlmDe ieols0trur(m oy1lpenlncsls) rtrxr oo0alxoiiciytlm2um(mo;t0alxnmf3tytopDr ues;()srxm(r3oy4openlfesa()srrr(r ou1texn ieildlmDra(vsn(4 rtnxo oo1lm elneslt) 2toiopnudomeelicsat) rurxm ;t4aeen f3tld a ulump t0alenir to1faDrauei (0s2uoimpnudopeelfvt sf Dtaumo;u1tlx moeils m2elnmo;u4 lxnmo3todomDrlnes;s)trtrim iy4lp nlivs () Drmumpot1oexomoeiltlm umnmpnu4trtrmociatlpDeauvs s) 2tr(o3ou4alee fvia(fsDrrxmp;o1oee mieiasls2rmnmp;t)alerif3tatlmD an ils  etoxm3oodomtn nvtat) 2umump;o1olxnii3iatfmDua( o ()aeermocoydlp eln s;s0s2xrxr3iu4opt mivi ()srur( o;u0ope  f3iat m uanvs;(4trxoxocoadop  an o;()srxo(m iy4ll e nvta() Dur(r ;o0oet if3tatls2ulums;(0 eenxrciytla e i olt srxoxrpiu4aptnliesat arra(ronu1texomietas m2uau ont)tlermr iadfat  ues s) 2to(m3no1alt livt s srrau  no1oex ifciaslm ea(ms;t)tltnio3to1op rlnes s trtrxo3nu1alenmivi (  Dtaum ;u4open iciatfa2ul(mo;u)texoxf tytfpD  u s;s0 2ur(m3oydaptnlfcsas) rumu pnt1olx mf3iydla em(vo u4tltnxr3todlaDr u i (0texo(o3oudllee ieiltfs2tmx o;u1oet io3iltls eluvsnu4tlxnxfcio1omDran olt) rtm(mpou1lltn fvtlt) Dumum nu4optnmietyd m2umnvs;u)tlenmo3to1omD lneols)s2to(rpno1ap  lfcia() 2ta(mooo4tpxnioetytfsDrmumo u)arerxr oa1lmDrlivs s0 2to(m3ny4lmtnlnetlt)aDurump;u0alx ifetas sDulu onu0trxrxo3iy1fpD auvo (  2um(mpiodolt lnvtat) rtr(m oo0alx  f3ildfm emu s;(4tltrio3oodfptelivsls  2trxr3nudlptnmnctlt)sDra(roou0texn octad s2emuvonu0aexrif3oo1lmDrln i s  ruoxopoydal  mnetl(f 2ur(  ;o4oet  fciyd s2um( p u0 rxomo oydoptelnes s  etoim oy1optnlict ( sruaxr ;u4olx  ietltfs2eanmp t4 etnirctodlm e neslt0trxo(m3nodllenlfvs sfsrrru pot0oleo feiltlm eanmp (0 rtrmf3tatoaD  ieo t0 exrxrpnydamtemncsa() 2ur(mo;t0tlt  iciyd s2ua(ms t4 ltrxrctydlpD  ivi;s  etm(r io4oltelfvsl( arraum ot4aexn f3ildfm ra( o;(4 etrio3ty1fp r uesls0truoir3ou1amte fei ( srur(m nu1tle iietasla2umnvs;(4arenxr3iatop r nei;(0seto(m iy4opt  ivta(farrr(m oo1aetnifctadlsDrm(mpnt0alxoirctytlaD lu s;s  exm(r iy4al nmicias srta(mont0olxomi3tas mDem(mp;u4 rtoio to1lmDeauvo ()trtrxr3nu1llt mfvilt)s2rrum nt1opx ifciltlsDuanvo;u0 renmf3ia1omDrluvs;(0trxrimpnu1llte nes s)s2tmxrono4ole  f3tyslmDuauvpn(4 reniociy1la  lnvil(0 eum(mpoudop nmnes (f Duau  ;t4aleoif3tldla2ea(vont0altomr to1fa rlivslt0seur(mpoudllenmnei ()a2rrxmp;t1olto fciyd aDum(vpn(0artnmf3iydlat  ivol() etoimpoy4openlics sfaDtax  ;t0alxoif3iasfmDuanmsnt4 lenxf iy1fm e nes;t trum(m3oy1opee fcta(fsrrauro;o1tpe  o3tyt a el(mp;u)teermf oo1laD lieo t0srxoxopiydope  iet s)sDrrx pot1olt  icias s rmuvo;(0texrxfciy1lpDeai i;(0tetmxrpou1lltnlivta()srtaum ot0aex ioeild aDea( s u) ltnir todla r n s s0t2umxr oo1amtnmivsls) Dta(  ;u4oex iocils mDumuvo t0 lxrxr iydfptelu o s srur(m3oo1aptnmnei ( sDrru pot0oeeo octldfmDum( o;t0teeomo io1lm  li i s)seuoiopnu4lp  lnctlsfarraxrpou0oeen i3ils s2eaumo;t) exrxo iadlmDran s;t) eur(opoodol elivs t aDta(mpot4aee if3iatfa eanvp u) rxnifcta1fm e u o ()t2tr(o3nu4apee net ( srur(mont1tpe mfeiad mDuanvpnt0tetoir oa1latelnei t  2xo(r3oudlpeemivslt s2urxr ;o0tpenmictytfsDelnvon()teenxo oydlmDrlneilt  etm(m ou1ape lfcta( aDtr(mpnt4altn feiasla2ea(vs;t0alenirctatfpteau ols  2uo(m nu4ape mici t  Drrxmpou0oetn fctlslm rm(vo;(4 rxrif3oytfp eluvilt  exm(m3ny4lpeelfct ()s2tmumoot4opt ioeiys m2ul(vs u)trtoxrcto1oa rau i;t  2ur(rpoo1op nmnetas a2ur(mono1tltomf3tysfsDrl(vs t) rtrif tytopDeli o s)s2xrxr3nodlme mnetl() rtrxr ;u0tpt mfetldfm rmnmo;t4aexnmo3ty1la eauvi;t0 rxoxo nydal   ncil(fsrraxmp;o4tlt mociatlsDean o;u)tleriociodfptr n s t0s2uoio3iudamt  nvtl(fsrurxmo;u1opxnii3ilsfsDran s;t)texrxr3ty1fmt  ivs;t)srxr(mpoo4lmtelnct tfa2rrxmooo0oexnmfctyd m2uanmo (0altnmo3oadlmDe neo;s)trumxo3io4omee fci t) rur(mooo1tptnmi3ilsfm2rmnvpnu) eerioctatfpDe i olt  eumirpoy4lpee ncsa(  Dumumpnu0aet ioctlsfmDrm(msnu4alermo3oadop e nes;( s2toio io1amtelfetlsfa2tau pnu4texn ictltlaDul( snu) rtnxrciy1fa  aivi t) 2uo(mpoo4om nmfvsl( aDumum ;u0aet  i3tld sDrmumon()arxoio iatoaDeauvi t0sexrxr iodomenlfvt ()aDrmx o;t1alxoii3iadla uluvp;u0altnxocio1fmt livi;( s2toxrpoudapt mictl(farrmur ;t4tpx iiciatls rmn p;u0 rxnmfctytlm   ivi (0srxr(mpio4lmtnlfcsas  2rmurp;t4tlxnmfeildfmDulump t4 rxomf ia1lp r ues t0t2uoio3oydllen feil(f 2trxro;o4opxnmieiysls2um(vont0texnmf iadomDelnvol(  etr(rpno4al  lnct tfsrtmumono0aexo ieiydls rluvpnt0altrxf oytlmte i slt0trxrxo3ou4aleemfvsls) Dtrum ot0ale mieiadla2ea(vsn(0tleoif3iydlaD an slt0srxrxo no1alt  feta() 2trxm ou0tlxo ociasfs umu o;(0 etrif3oadfmDrluvo;(0 exmxr no4am nmnvil( s2rrxmo;t1apx mf3iydls rau p t0 exnxo3oy1lmD  ivi t)teuoxrpiu1alte ncia()srtrxmpoo1oee moeils a emu p u0aeeoxo ootlpDeauvolt0trtmirpiu4ame mfcs ( aDtrxmonu0aleomfciaslm2ulnvpnu)aetnmo3todlaD aiei (0 ruoir3nudal  mfct t)arumxmp;u4tet  i3tad aDeluvo u)altrif oadoaDraiei;s0sexr(r oydamee fvt sfarur(m ot0ope ioetltfaDua( o (0 ltoxo ootlmDrlueo;s)s2tmim oo4opee iei (farurx  ;o1tpenmo3tatfm uln pnt0tltrif oa1lpt lnei s  etmxr iy4om nmnvtasfa2umu  ;u0tetnmictydfm rm(ms;u4 exrif3tytlp elnesls0 exo(r3nu1am emivsas arumu oou1apx  iciyt sDuanvpnu4aeenmo3tydopDe u s;s)trxr(o3iodapen feilt)srur(mooo1teenio3iltfmDrl(ms (0teeomr3ta1oa eaivs t t2toxrpoy1ap  licsa(  Drm(  nu0altnmfciysfs2eln o;u)trenxfciodlmt  ieilt)texrxr3oo1lmenlnesl( s2rr(rooo4olx miciadfa em(mp;()alxnxo3oadfaDe ieo s)tetoim iydllt  fvs () 2tr(rpot0tetnmfeildla em(vonu0aetnxo iatfp r uvi;t s2tmir3iy1oleemiesls  rtmurp;u0tpenioeiatfsDrmu o;u)tltoif io1lmteluvi;t texoir iy1ll n ietls a2tru  no1tlto f3iatfa2elump u4tetnxrcoadlaDraiei;s)s2um(rpoydamt  fvsl(faDtmx p;u4aeenii3iydfaDrln s;(4texoir3iodoa ean ol()srxrir3oy1al nmnvtltfaDum(m ;t0ope ifeiatfsDumumpnu)artrir oa1opDelu o;t  2xoxo nu4altnmnesat)a2uaxr ot0tpx  ietlt mDemnvont4 lenirctodop elivi s)teur(m ny1ale lfetasfaDrr(mono4tle  ieildla2elnvs;u4 rermfctodfmtrlu slt0s2xmir3iudal nmfei s)aruru pou0aexo ictatfs rln sn(4tltrioctydoa  livo;t  2trxopio1ap nmfctatfsruauroot4ale  feiydla2ea(mp t0artomr oydlaDrlivo;(0t2tmxr3nudll   fctat  Drmump;o1apxoioetatla um( on(4artomf3totlaD li s;s texoio3oy4aptnmnviat)s2tr(mo;u4ape mf3iatlsDran pnt4alerif oadlmtrlivi;() 2xo(r oy1ap nmnei t) rrr(ro;u4olxoii3ilt m2ulu o;t4trtrxo3ootfm   nvs t0 exoir oy1lmee nes () Duaxmono4texomoctat a2rmu s;(4tetrxo3tadlmDrlieo;s0 2tmxm3oydomtelnvs s) rrau  ot4aet mfetysla el( p;u)trtoir3iydomDelueo s sexmxm iy4ll emfesl() 2tm(r ;o1olx  o3tadla rmums;u)trxrio ootoa  lieo t)trxmir3nudlltnlivsl(  2ta(mo;t0alt io3iysfaDranvont)tetnmr iatfpD  n s s t2ur(r no1om   iet sfsrrmur ;t0tptomoeiydfaDumnvp (4texnxr3oatlp e uei (0 rxr(m3oy1lm n iesls) 2ta(mpoo4oeeomfctysfm um(vo u4artnmocto1lat lnei;s)trto(r3oo4olt  fcsa( s2ururpoo1tet ifetyt sDumu p;t4 eenxo iy1fat aneo;t)s2umio3no1amee nei (fsrurx p;t0altomfciatfm2rauvpn(4altnir tadoa ean ils) exrim iy4opteliviat arraumpno0openiicilsla ean onu0aexomo3io1fa r i s t) etrxm3nu4apenliesls)s2ra(mo;o1ape mf3tysfs2rlu pn() lxomf oy1fateluesl(0seto(m3iy4aptn ieils  Drmx pno0apxo ocias m umuvs t4 rxnir ootlaD aivolt trtoirpny1lle  nvsa(f 2uax ooo4aptn fetys aDrlnmp t4alenxfcoy1la eau s;t  2toxopoo4lltnlivsl(f Duaxr ot1aex if3tat s2eauvpn(0altnmr oydom   u sls  2tr(r oodlm   nvi (fsDrrxmpno4aleo f3iysfaDra(mo;u4trerio io1omtelneols0trurirpiu4omtnmiei (fartaxrp;o0olxo ociltlaDuan p t)aeerxf3iadfmt au s;(  2urxm iy1alee fvias  Duaumo;t0oltnmicilsls rauvonu)aexnio oa1oaD  u i s t2tmxr3iydopte net t aDra(  nu1oeeomfctldlm2ulnmo t0 etoiocootfa eli o s0 exoiopou1lmtemfci ()a2rr( p;u1ale iietytlaDrmnmp (0 ltrmrcty1oaDraueo;s)srxr(m nu1olee nvil(  rurx o;t1tpe  f3iadla umn o u)aexrio3oodlmDrai ols  rto(m3io4lleelnvtat  rtr(r ;o0tet  oeiat s2elnmo (4 eerxo tadlpDeaues;s0s2xo(r nu1optn fci sfa2urumpou1tpx  f3iaslm emu p;u0aeenifctotlmDelneol(0seumxo3oudoleeliesatf rraurp;t1aptomf3iltfa ua( pn(0 rxomfctadfp r n i;s s2xo(m3nodolt mnvsatf 2raumpoo0alto f3ias m2rmu onu4arxomo3iytlmDrlivilt)t2umxr3oo4optnmivi (f 2tru  no4ope mi3tls mDum(vo (0 ltrif oy1lmDeaieo (  rtrxo ou1ale  fcs t  rrrxm oo0alxo octlt m2rm( pnu0 exnxrcoy1omt  n sls) 2xrxr3oydam  lieilt  2umumono1texnmo3tlsfmDrl(mo;t4aetrmo iodopt li sls srurxr nydalt  nvs t)s2rrxm ;t4aptnio3iltla2elumsn(4areoxrctatfmD lu o;(  rxo(opoo4omtnmici t) Dtax oou1opx if3iyt aDrm(ms (4 lxoxo oodfpDe ivo s  2tm(o3oy1lm n ncs sf Durxmpoo4ape ifciydlm ranmpn(4teeomr ta1fptraueo () rtmir io4apen ici ( aDtaxm ;o4optnmicilt m elu onu4alermfcoa1fpDrluvo;s0 ruo(rpnudomeemnei sfaDrmum nu4tee mi3iltlaDrau o (4texoxfciadfaDrau o;(0trurxr ny4llt lfcsls arrm( o;u4teenifeiat mDeluvp;(0 etriocoy1lptr uvolt texoxmpoo4lp e nvsls  2um(roou1apxn o3iasfs2ul( snu)altrmf tatoaDe uvs (0srum(rpoy1am nlnci s srra(r nu1tptomfetatlm2eln s;(4aexrxfcoa1laDrlneilt)sexrir3oo1lpt  fesls  2tau o;t1tet mf3iytls eanvont)trxnifctydoa rlues t s2tmxm3oo4om  lfcsl()sDra(ro;u0tpxnmo3iltfaDem(vonu) etoxfcoa1fmte uei;s0s2xoio3nu4aptemiet t)arur(moou4aee iictydlsDeaums t4alxnmf iydlat  iei;t)truo(o3iydlpe livias) rrm(rpot0altn oetltlm raums;u) lenifcia1oaDeluvo;t)t2umimpny4om e ivsa(fsrrr( ooo4opxnioeiad m2rmuvs t4trtoxo ta1fpDrlieol( s2urxopiu1oltnlnvsl(f rua(mont4opxnmieiatfs2ulumont)tleoir3tydoa  lneo s  rtm(r oodoptn fctlsfaDta(m ;o1tex ifeiltla2ran p;(0tlenxfcia1fatelu s t)sexoim3ou1ll nmfesa() 2rax oot1alt mfeiltfaDrluvsnu0tetnmf3io1fpD  iei s)setm(opoydlp   ics () 2taum nu1tpx  fciasls ua(vonu)trenifciadoa rlnes (0srxmxr3iy4lmenmfes sfaDtaxmooo0opx if3iadla ulu s;t0trtoir3ty1omtrln slt) euoxo ny4apeelncs (fsDrmu p;u1alxoiocild sDrauvont4tlenxfcoa1fpDrai slt sexr(m3oy1olenmict s  rrr(m ou0tpxomicildla um(vp;t4areomf3iy1fatrau s;( trtriopoudlm   ictls  Drrumpno1alxomo3iysla raums u0tlxomo iytom   uvs () 2urxm3oydaptemfetas srur(m nu0alt mo3iysfa eanvo;(4trtrif3todla r ueslt0 exrxrpnu1ame  nvs () 2rau pno4tlx mo3tysla2rl(vs t4alxoir oodopDe uvs s0s2tmxrpiy1amtn fvsls artrx  ;u0tlen oetlsfa ra(ms;(4alenxf tatfpD lnvi;t0trum(opny1aleemfesls)srurumont4tpxnifciadfa ea(mo;() lxrmr3oytlpte n i (0t2xoio oodlmen feia(f rta(rp;t1texo feiad sDum( snu4 etoxr3tatfmDr u ilt)teur(m3iodamenmfes sfs2trxr no4apenmocias sDeanvonu4arxoxf oa1fa r ieo s s2tmim oydopeelnvsls)srta(mo;u4ape mf3iytlmDum(mont)aeenmrciytlpD lu olt teur(r3nu1lpeemnvsls) 2trx onu4openmi3tatlsDrmuvpnt)aleomoctydla  ln il(0 rxrio ou1aleelivt tf Dtau pnu1aeen iciltls2rlnvo;t4altnxocto1oaD luvo s  rurxm ou4lle  ivsat) Draxrp;u4opt mfcilt s2ulums;t0trerxo3totlat aivsls) 2xo(m ou1lmee nvtas  rrruro;u1tetomociydfa2emnvo;(0alxrmr io1fptrluvs s0s2umir nudaptemfvtas a2uaum nu1apt iocildfa2eaumo;t0aleoioctatoateliesls  rxrxm ny1apeelnesl(  2tmx pnt4oetomfciysfmDulump (4altrir3iodfp rluvslt)t2tmxrpnodap  lici () Dtm(rpot4tee iieiysfm2rlnmp;t) lxrxr iatfmDranvols0 rxr(m iydlmtelfvs s s2ururoot4tptoioeiys m ulums;t4teenxfcia1fmDr u o t  rxr(o3iydomtn iesasfartau poo4oetn f3tytfs2rmn onu)treoxr oa1fm  au il( seur(rpoodlmt  iei tf Dtm( oou0aex ioctysls rau ont4trxnmfcoy1laDranes;( teurxr oy4lm n ivsl(fs2rrxrpnt0opxomfetydfm2emn o u4 leoio3tydoa   n sl(0 euo(o oydlleemncilsfartmxm ;o1tpeo f3ilsfaDul(ms;t0texrirctotfaDranesl(0 rtoxm io1optnmfetltf rtm(mpoo1aeen oeiysfmDelnvsnu0tltomf oa1omt au il(0 2xrxopou1alenmnet t)srrrxro;u0apxn oetydfmDrau o u)aexoxo3tatfmD ln s;t)s2tmirpoydomenlfvslt aDum(mo;t1aptnioctadfs2umnmp;t) rtrircto1lptr u o;( tetmirpoo4omeemncias srtmum no4oex miciydlsDel( pnu0tltomrciy1lmteliesl(0s2xmir nodopenlfvs t)srtmxmpnt1tpen oeiltfm2um(vp (0artrifcoytoa ean ols sexrimpoy4llee icil( a2tmu pnu1tlenifciatfsDeanmsnt0tltrmfciotfp eai s;t s2tr(o3iodamtelnvt t  ruaur nu1opxn fctyt a2rmn o;(0trtnir3oo1omDranvs (  rumim3no4lltnmncs ()sDrrumpno0tptomf3iys a2ea(mo;t4trxoircoo1laDranvs s0t2um(opnydom  micils sDrm( pnu1alxnifetld s2el(mo u4 eerxf iatfpt luvi s)texmxopoudomen ies t a2tmx pot4oleomociys aDulnvo (0 etrmf3oodla e ivi s0 rtoxo3iodale micilt)aDtr( oot0ape mi3ildlmDulnmsnu4tltnxrcty1latr u sl(0s2urxr3io1ap  lfei (  Dumxm ou4aexniieilslmDeln p u4teenmfctadlp  li o;(0tetoxrpio4ap   fctat) Dtmump;o4olen ieiat mDra( snu4alermocty1lmtranes s) 2uoxo3io1lp emfeiat)aDraurp;u1tpenifcilt m rlu pnt0 eerirctatoa rlu i;s s2xoxr3iu1oleemnct (f rumxronu1tpxnmf3tydlm em(vo;()tlxrif3oadfmteluvil( t2xoim3no4llt  iei (f 2urumo;o1tltoifeiadfsDel( p;() rtomo to1latrluvo;s teurimpiu1ame mfviasfaDumumpoo4aeenioeiat s2emnmo u0artrmf3oatoa elu i;s truoxopoy1ll  lfeiat)aDrau  ;u0texomociysls umn snt)aetomr oo1fatrli o s0trxmxmpoodol e ncias s2uaum nu1opx mf3tytfa2eln s u)trermr oatfm  anes;() etmxo iu4lpe  nvsatf 2tr( pot1aeenmieilsla2eauvo (4 eermr oytomtranei (0s2uoxm3ny1lp e icilt sDra( pno0texniocild s eaump (0tetnmf io1omteaies;s  exrio oo1lmenlfvslt a2ta(mo;o0apeoiociyd a2ulnms;()trenxfcoodfm eauvs t) exoim3io4lpt mnvt t arumumo;o1oexomoeiysfs el(mo t0tltnio oy1lmD li o;t trtmir3nu4lmt  nes s)a2rru p;t4oexoifctysfa2umuvs (0texoxo3oo1fmtrliei;s  euo(m iudal  lfvias)s2umump;o0tltomfetat sDemuvont4aetoircoytfaDe ueil(0sexo(r3iodlpt lfeils)s2urxrono0optnmfeild a rmu s t4texnxr tytlmDrlu s;()t2urxmpoy4ale lict (faDuax  nt1tetniociltlm ra(vp (4teeoif3to1oatraues (0 euoio3iudol e fctls) rtm(mont0alen iciytla eluvonu0arerifcoadfpDrai slt)sexmiopiy4lptemncias) rtrurp;u0olxoiieildfmDemnvp;t) lxrmr3oa1fm  aivs;s0seurxm no4ap  mivi s)arra(monu0tpt mo3iydls rau o u) lxrir3iodfmte uvo;(  eumim nu1lpeemnet t) 2rm(r ;t1apx ii3iadfs eanvon(0aeenmr ta1fm rai ilt t2xmimpoy4olen fvia()s2rm( ooo4oet io3iatls rm(vonu4alxoifctodfmte ieo;s)s2tmim3nu1olte icilsf Drmxr nt1opxoiicilsfs rmu o;u0 exomocoydfp e ivo;(  etrxo3nu1lm nlnetlsfsDrrxro;o4teenmf3tyd m rlump t0alxnxrciy1fm  luvo s)t2umio3nu4ll  lieilsfaDua( oou4teeomf3tydfm2rauvont) eenxocootlat lu il(0s2xrio3no4al  mnei (fsDuaurpnu1tpxoii3tlt m rl(vp;u4texoxocta1fpD aieil( srtrxopio4ome lnvtls aDrrxro;u4olxnifetas mDrm( o;u0artnmf3io1lat ln i t t2tmirpoo1apen icsltfartmx o;o0alx iietysfa eau p ()aleoxo ootoat anvi;t t2trir3nu4ap nmfciat arraxm ;u4aeenmfciatlm emu on(4texrir oa1oa  lu slt setrxm oodaptn nct (f 2tm(r ou4tpe ioetytfa2ea(vpnu4 etoxocoatopD lnvo s teur(rpou1om emiesa(f rrm(ront0tptoiociadlsDul(vsnt)tltniociydomt lu s;s  2xmxm oo4omt  fvsas)s2trur ou1alt mfeiyd sDrmnvs;t) ltoifcoo1lp   nei s0 2xmxm3oy1ll elicia( s2umxm nu1alt mf3tad mDemumo t0tlxrxr iydop eaiei s0s2umxo iudal nlnviltfaDraumo;u1tex iicilsfm rlnvo;u)arenxrctotlatr ies;(  etmxmpiu1ol   fvta(fsrtaxmpnt0oetoii3iad m rmnmont) exnio3io1lp r ues;s t2xo(m3ny1om e fct tfsrurxr ;u0tlxniieiys a2el(vpnt)tltnxociytfaD ai s s trtrio oydomt mieils)aDtm(mono4ope iieiytlaDrlu o (4trtoio3oadlaDe uei;()s2xmir3oodoptnlneilt) Drm( pot4aet ii3tys a uau snu0teenxf ia1la rluvo;t srtoir3nodal emfctlt) 2rmu poo1opx  ieiadlm2umu ont)altnio oy1la   nvi s0 rurir3oodapt mnvt tf rumxm nu0tptomietyt a2um(mp;(0trtrxo3oo1latrln i (  euoio3ou4ll e netl() rrr(rp;u1oeeomfciys s ea(mp t0 etrmo3oa1fate i s s)t2xoiopiodllt livtatf Drmumpnt0alx micils mDemnvo (4alerif oytla  ln s s)s2toxm3iudlp   nviat)srra(roou4tpeo f3taslm em(vs;u4 lxoxf3iodlpt  n i t  exmio oodlm   fetltfs2raxro;o1aptomo3ildla ranmont) exrmr ty1fate u ols  2uoir iy1am emnct sf rtrx o;t4aetomfeiasfs rl(vont)arenxf3oodop eauvi t  euoiopoudome lfci (f Drmxmp;t1tptniieiad s ua(mo;u0teermfctotfa  liei t0t2xoiopiy4ome mncias)arrm(r ;t4tpxnmoeiasls rlnmsn()artnir oadfm rlu o;t)s2uoxopiydale  nvta(f rua(moou0tlxo fetltlm eanvp;u)trxnmo ta1oaD  iei ()seur(m oy4ap n fcil(fsrrr(rp;u4tltnmf3iyslaDel(msn(4tlxoxrctytfpt  neslt0trtr(r no4ole mict tf Dumu ooo1tpe ii3tldfmDeauvpn(4aexoio tydoptrai ils0t2tmxrpiy1oltn icsa(fs2umu pot0olt  o3iat s ranvp;u)texrxr3ty1fa eli sl(  2uo(m oodlm nmncilt s2trumono4ope ifciltls rlu snu) rtrxo iy1lmtr n i;s0texrxm3oo1lmt  ncilt  Drrumpnu4aexoii3tyt mDeaums;(4 rxrio3ootop  lieo;(0srxrio iy1lp  mnciat  rurxr no0tlenmfciatlmDrmuvp;u4 lenmrciodfa eli s;(  eurirpny1ap n ivt ()sDtmu  ;u1opxoio3tlslaDul(ms;u0texrmrcoodop r ivslt trxm(rpoy1lm nlncils) Dum(  oo1apxniieiat aDrluvp t) exrxr tadlatr ieo;(  etr(o3iu1llee fvt sf 2umurp;u4alen iciytfm umuvon(0 rtrxr oy1om r ieo;( srto(rpio1ll  lfesl()a2tmx oou1alt ii3tytla2ua(ms u4alerxr iotlaDr n s;(0setr(o3iudole lnvil(faDtm(mpot0aptomi3iat sDel(ms u4tetomo to1latelneo;s)sexoxr3nu1olen nvta( s2rr(r ou1oetn fciydla eau o t4 leoif3oadom raues t)teuo(m3oo4oltelivsa(fsrta(  no1aptnioetls m um(vo;u4tetomf3ootfaDrauei;s0srtoio3nu4lp nlnvsas) Duau  no4tlxo o3tydfs2emuvp t4tleniociytoateaueilt trum(m iydlmenmncilsf rtaxr oo4oeeoioctytla2ea( pnu0arenmrcoydomt lnvi s)s2um(rpnydll  miesl(  rta( p;t1altnmo3ilt s2rlnvp;t) ltnxfciydop eanvo ()s2xo(r3nodop elieilsfarua(m no4ape  ociadfm ran ont0trenmr tytoaDrlnvi s  2trio iodll nlfvil( srrm(rpot1opeomo3iatlsDum(mo;t)trerif ia1la r u o;s)s2xoxm3oodopt mnciat sDtrx pot4tltomfeiytfm uau s;u)teerxocoodomDrluvo;(  etrxrpno1lmt  nvslt aDua(  ou4aleo fciyslm rlu onu4tlxoxr3tatfpteanvs;t seurir3io4op e fctlt) rraxm nu0aeeo o3iatlmDrlu onu0alerir tydfa r u slt0srxm(rpnudal  lnciltfaDtmur ot0tpxo fetlsls2eanmo;t)aleoio3tatlmtrlu il()srxrim3ou1lltnlfvtlsf 2uax poo1olen i3tad s elu p ()artrirctytomD  i o t srxmimpoo4altnmfvs s)s2taxmono4tex iieilsfmDrmu o (0trtnmocty1laDe n i;()s2urxrpoydomt mnvt t artax pou1aptomfctlt m2ulnvo u) rxoxf3ty1lmtrlivs t)teuoio oy4open ici ( sDuau pnu0aee ifcilsfmDeau p u4areoio todfm rli sls0texoxm3oudlmt  ncta( aDurur ;o0tltomocild a2eau s;u4 exrio todfpDraies s0texrxr3nodale lfvs s aDumxrpnu0opx mictlslaDrln snt4texoio3oa1fat auei (  rxr(o3ou4ap nlfeia( sDrrum nu1apxnioetld mDem(mo;u) lxoio3oytlateli olt0 2umxrpnu1alenlfctls)s2trumpot1apt ii3iytla emu p;t0tltrir iadopDr ieo t) 2xmxm nu4lmtnmfvtlt) rrauroot4alx ioctlt s umnms (0tlenmr oy1fp  lieo;t srxr(m io1omtnmies () rtr( pot0opx  ociad mDrluvo;u4 rerxr3to1lmte nesls sruoxr3nudlltn ivs sfsruru oou1opxoioetatlm uan s t0 lenxo3ootlaD livs t srtm(opou4altelicias srta(ronu1oexnmi3tyd a emumo (4arermf iotlp   n o;t) rur(m oudoptn fcs tfsDrmx  ;u0aeeo oeiys mDulumo;u0tltnxr ty1la rlieo;s srxo(o ou4ame  fei ()a2ua(r nt1tpenmociysls2ua( p;()texnxf3to1fmDe ies;t s2urio oodalt mfes ( arururpoo4opxo f3tad a2umnvo;u)arxomr3ia1lpDranei t0 rxr(m ou4ale  fesltfartr(mpot4tlen f3tadfs2emnvpnu0trtrio iydom raies s0trum(mpoy4ol n fvils  2taxroou4alto fciasfs rm( pnt4alxrifctatopDrai i s s2tmxr3oy1ll e ivsls a2raurpnt4texn ocildla2um( sn(0aexoxfciotlptrau o (0t2toxo3iydame  iviat)srtru  ;t1tetn feiys a2eaumon(4texoxf to1lptrai i (0 rtm(opou1omtemfesatfs2rr(mo;o4tetoii3iatls emnvp;u0tlxnifctytoa eluvo t)t2tmir3oo4omtn fcsl( sDrmu  nu4texnmi3iys m2ulnmp ()trxnxfcoatopt liei t setoir nu1lm nlfet s sDrmxroou1alt moeiysfs em( o t4trxrmf ty1lmD livi (0sexo(mpiodlmtnmnctatfs2um(m ;o4oltoii3iysla uaump u4 lenxo oodoa ranvs t  exr(opiu4omenmfvslsf 2rru o;u4aeeoiieiltlm2rln p t4 rtoxr3ia1fmDe ueols)s2xr(m oy4amt  ncs sf 2trx o;o4oexoioctadfm raums u0trxrif oatlmte ivs;s texoiopnu1lp nlnciasfarra(mpou4oexnmf3iatla2ul(vp t4 rerxr iatlmtraies;t0sexoxr3oy1ale liesls  Drm(mpou0aetoiieilsla2ulnvo;t0aetoxf3tydlpt lueils0 eur(r3nu4am nliesl( arrr(r ot1oltomocilslm2el(msn()trtrmfcto1fpDelueo s)srtmimpnudlp   iet ( s2trx p;u4aeeomiciltfsDelu ont) eeomo3todoa  livsls) eto(r oo4lm elieslt  2rrumoot1aeeomo3iys mDel(vpn(4tltrxfciatfaDe ieo ()sexrxopoy4lltemivsls sruaxmp;u4teeomfetadlsDrl(mp;t)altnio io1fptr u ols)trxrxm iu4lp   nctl()artaum ;u4tpt mi3tydfm2emn pnt4trerir3oodlmDeaues s srxoim3oydape mietlsfsDur(mpot4aet micilsfs2ulumsnu0tlxnmr tydoaD ln ol(0srxrir3nydop e fctls arraxrono4tex ifciadfsDel(mp;u4 rtomo3ootfmD  ivo ()tetmir3oydap e fvtas a2um(rp;t0tlxoif3ils aDrl( o t0aetnifcoatop  li i;s) 2uoxo3nodol e ictls aDrrxr no4apenmiciat sDra(mo u4tlermf3iadopDraivo;(  rtmxopoy4alt lnvi t)srur(r ot1tptniociydfs um(msnu4 rxoir3iydlpD  ues ()trtoxo3io1am n nvsasfa2ua(rpnu4ale  oeiytfa2eluvp t)aeenmfcootlaD  nvi;(0 2xm(o no4lpen ieilt srurx  no0aptnif3tltla2emu s;u4 leoio3tydfa   nes;t0texo(o ny4open ivsas  rtm( poo0aptomfeiytls2rluvp;(4alenxo3totlaDrluvils  2trxopoodlpt  ivi tfsrtaxm no0tet iictld mDelnvonu)alxoxf oadlaDranvi s) exmxm3nudomenmfesasf ruau onu4tpxn iciasfs2rl( s t4alxoxf to1opD lieilt0trtm(mpiudale licsl()artrxrpoo0aetnmiciydfaDum( onu)texrmrciodlmte ieolt)s2um(m oodlle  fvsa(fa2tmurono4olen f3iyd m um(vo;()trxnmfctytfm r uvo;(  exoim3ny4om   fcs t)a2rr(  ;t4oex  iciatla ra( onu)tlxnmo3tatlat ln ils0 exmxmpoy1amee fvsat  Drrxrpou1opt ii3iysfs rmuvp;(0treomfcoytlmD  nvs;(0 rtrirpoo4ame livsa(f rtmxrpot1alx mieiaslm2ua(vp;u)alxomr3oytlaD  ivs;s0 2xrio nodamen fvsa(fa2tr(m nt4alto ociat a2em(vo t)tleomo3tadoa eai olt)s2um(m nu1lmte fvtlt  Duaxrono4oeenmoctad a ulnvp u0artnxfctadlmDeaies s  etm(rpno4lltemicils)s2raxr oo0tpx io3iyt m el(msnu4alxrmo3oy1oate n o ( srtoxr oudol n nvtas aDrmx  ;u1aee mfeiatfs2ra( o;t4trxoxoctydfa eluvsls t2to(rpno4alenlict s) 2tau  ;u4aptniieiasfs2el(vpn(4artrxr oytfmtranes s0 rtr(rpou1lptnlncia( s2uaxmpnu0ole ioetyd a2emuvp;u4areomoctodfm  au s;(  etr(o ny4oltnlies sfarrrxr no0texnmo3iltlaDuanms;t4artoxrciytfmDr i i ()srtmxopoy4op e ies (  2uauroot1tetnioctytlm uan sn() lenmr3oytopDranvi ()seuoim3oodamtn neias aDua( p;o1tlxnifctlslsDea(vsnu4 lxoxo3oatfmt luei;(  2xrxr3nu1omee ieil() rur(moou1aeen f3ias mDulnvon()artoxr3tatoptelneo s)t2trio io4amt mnviltfsDtau o;o0texoifeiydls2ea( o;(0 rermrcio1om  luvi;t)srxrirpnudlmt mnei t  2tmu ooo0opxo icilslm rmumsn(4 ltrmfctotfatelieo;t0srxrxm3ny1om  mfvtas)artrxrooo1oee  iciys m rmuvs;t4alerxrcty1oaD  n i;t0trxmiopiu1alt mieilsf Drrxrp;t4olt iociysfsDumu p (4treomr3tytlptr ivs;t  rxmir3nu1lm  lfvt (  rumxmoot4olx  fetad mDrlnms t) rerxo ia1lm eanes (  2ur(m3io4ole lnci sfsrtm(r ;o4oltn i3tltfm eluvsnt0 ltnxoctydfptelu ils)trxm(r iy4ol nmnvtlt)aDtmumonu0tpen ociasfm emuvsn(4artrxo oodop raieo;s0 2xoxrpnudll nmfeilsfs2tax p;u4tpeo fctadfmDem( o u)artrxf ia1latrluei;t)trtrxm io1lmtnmfeilt  rtr( p;t4olto i3tas s2el(vont0alermo3oadfp  au sls  exrir iodlpt mivsls)aDur(mo;u1tltniietasla rl( on(4altoiociydoaDelivs s)texo(mpoy4am emfvil() rrrx oou1optn ieilsfs uauvsnt)tetoxf3iydfpteli s;( t2xoio3oydlp elncs tfaDtm( oou1tpxomfctysfa eauvp t)tlxnmr3tadla eanvolt0s2xoxmpiy1ol   nvta() 2tm(rpou0tet ioeiasfa el(mp;()arxrircio1opt anvo;t)sexm(opiudamt  ivs s) Dum(ro;t0olenmfciltlaDulnvs (0texoxfcoadoa  ai ils)t2xrirpoydop e fvi s) 2rmx p;t1opx  feiatfm ua(ms;(4tltoxr3oatoptrli i;() etmxm io1al elfct sf Drauroou4oexnmo3iat a el(msn(4trxomo3tatop eli i ( srumxm iy4lmt  iciltf Dtmx o;o4tex  ictldla2umn p t)trtrmf3tytop   u i;t  ruoxo3oodolenmicil(fsrtmx  nu4ale  iciltlmDulnvpnt0 ltomo3tydomDe ueilt teuoiopio4opt  ici t arra(mpnt4apxo fciyslmDua(ms (0 rxomf3to1la raneo;( teumxm no4altemncsasf rtau o;o0oetniiciadfa2ua(mpnu0 ltrif3ia1opte nei;t) 2to(m io4altelnciasfsDua(  ot1aexnmo3iatls2ra(vo;()aeermo oa1optelnvo;(0tetoxm iy1opt lfvsas artau p;o1teeoioeiad a2ul(ms;t) etomocta1fm  luvs;(0 rtoxopnydlm e fcsl(fs2trxrp;t4tlt ifctysfm2umuvp t) eerir3oatfa rauvs s0 2xmim3oydal emncil() rurur ;o1oetomieiat sDra(vo u0tleoif3oodlaDeaivolt  eto(r io1ale  fviat)aDra(r ou1tee  f3tldls rau o;(4tltoxo tatfmt  neolt seur(opoo1lpee fcslsf 2umum ot4opt  f3ilt aDraumsnu4 eenmo oatla rlnes;s)s2urir3oy1alenlncs tf 2tr(ront4alt mieiydfm2em(ms;t) ltrxr3oytfp r nvi t)teumir3iy4apeemfvi s)sDua( poo4opxoio3iaslsDua(monu4tlerxr3todfaDeaivo s)srtm(r3iodlltemiet ( srum( pot1alen o3tad aDeanvo t4teerif3oydfatr nvo t tetr(opoudlmtelneils) Durxmooo0altnifctat a2ean p;t0aetoxf totopDranvolt) rxm(o no1alte nvta()a2rrx  nu4teeoifetls sDemu sn(0alxomf3oatopDranvs;s) eum(m iu1oltelncsat) rumxm nu4aexomiciltfaDulu s t4arenirctadfa  aivs;s)truoimpoo4lpte nvilt arrrumpnt4apx iietld m eauvo;(0tlxrxfcoadlatelnes (  rtoxmpnudlp   ici tfsrta(r ;u4apxnmo3ilsfaDem( s;t)aetnmr tytom  li i t) 2to(rpoydapenmncils  Drr(m ou4aetnif3tlt mDum(mont) lerxocoodfmtr nvs s) rxr(mpou1lp elnvsasfaDrmur ;t1apeomoctlt s2emnvp t4alerxf iotomD  ivs ( teto(r oy1llte fesl(f 2rrxr no1olxnmietlsfa ulnms;()aexrif to1fmtraivo s) exoim3nu4am elivia()a2tm(moot1aetoioeildfs2rau o;(4tlerxr tatlmt an i s0seuoxm iy4apenlivtatfa2uax  nt4tpe  fetadfm ea(vs;t)aeermrcty1fa  lnvs s0 2umimpnudole miet t)sDrrxro;t1aet  fciltfaDran p (4teermfcoy1oatelies s0trumim3iu1ap n neil(fs2taum ;u4alenmfctasla2emnvp;u0teerif3iatlm  au s t srxrxo3oy1optelfvia( s2rmxrono4alen ietltlm2umu p;u0aeenmrciatoat anvs;s) rumio3nu4lpte fvs t aDrrxmoot4oet  ieiys a2ea( p;(0trenxr oa1fmtr i o;() etmimpny4olte ncs (fsrrauronu4apen oeiatfs elums;u)aexrxr tydlp elueo t sexrimpio4opeemicil(f Dum(monu1open iciatlm2em(mo t0trxoio iadopDe iei;s0sexo(o3oydalt mivtas a2rrxm nu1teeoiictlsfs2em(vo u0alerio3iotoaD aivilt tetoxr oydol  mfvi (f Drr( onu0tltn o3tytla2emu o;u0tleoir io1lmt  ivo;t) 2xoxr nodlmtelnet t)a2ua(ronu1aexn f3ils s2rluvs t0alermo3todopte i i s  rto(m3nu1op  lfet s)srtaurp;t1apx ifcildls rl(vo;t0tetomr3iadomtr n ols s2tr(m3iydlpt mivsas sDrrumo;u0aeeoif3tydlm eln snu)trtomfcoytlate i i s setrxm ou1am emivt t)a2taxm ;u1aet  ieilsla ulnvsnt0tetoiocia1fptran o;t)srtmxr iodlm nlicsl(fsrtru  nu0oet  fciydfaDumuvon() rtrio3to1lm   ivi (0s2ur(r3ou1lm e icia()arurxm no1oeeoii3ilsfa rl(mont)alxrio todfmt auvol(  2xoxm oy1amen iciat)sruaxront1oltoif3tlsla2emu p;t)trenir3to1om  lueil( sexoimpiu4apt micsasfaDrr(ro;o0aet  oeilt aDuanmonu)aeenmo3oytoa raies s)t2umxo3oodope lfct t arur(m nu0olxniietlt a2rl(mon()aexoxf3tatfpDr ueo (0t2uoxm3nydale  ici s  2rm(m ;u4olxnifctydfm umu o (4aetomf oydfa   neo s0t2xoimpiy4lltnliesl(  Duaumpot4apxniieiatlaDem(mp (4 lerir3tytfmt  i i ( s2xm(r ny1ll  lfcslsfs2uaxro;t1alxoif3iytfa emuvo;u4 exoxo3tadfpDe ivi (  2tmimpiodame mnct t sDta( pnu4oltn iciyd sDelnvsnu4artnif tadfat li olt0sexmir io1opt miesat aDrm(  ;o4aleomo3iatlmDemumo u0tlenxr oa1lmDe n sl()trxr(r oo4lmtnmicsa(  2tr(mpnu1texnifeiltlm el(vp u4 rxniocto1fpD au ol() etrir no1apte ies sfs2umur no0tlto o3iltlm umnvs t0aetnxo3iodfa eauei;t)texmxopiy4ol emnes t) rrmx o;t0oltnioetaslmDem(vsn() leomf oadlm rlu sls0sexmxm3ny1lmte ncia(  rumump;t1oetoiietasfa2rlumsnu) etrmr3to1fmDr nvs;(0s2um(o3iy4op e fvt t) rtm(  oo1tptn i3tadla ua(vpn(0trtrxf ia1faDraies;t s2trxr no1ol e icslsf 2ra(  ot0apx mi3iysfaDemu onu4texnifciotfpDrlivs;s0teuoirpiodop emfvilt  Dra(ro;u0oetn fctls mDel( s t4artnmociatlat lieil() etrirpiudlpte neils s2uru pnu1altomictydls2ua( pn() eenmo3oatlat anvo (0 2triopno4alee nciat aDurxrp;o4alt ii3tld m2rln p u4texomr3iatoa eai slt) 2uoxm oy4opt  fvsls) rtr(monu0oexoii3tyd m el(vpnu0 lenmr3io1lm rlnvilt0t2uoxo3iydapt  ncia()sDtrum nu0apx mieiyt sDuauvo (4alxnxo iy1fptrai olt)srxoio ny1lptn ncs t a2taxrono0tptn f3iys a emn pnt0 renmr iydfaDraiei s)s2urxopoo4om  lies ( arrrxmpot4tptomfciyt a2umu ont0arxrifcoo1fmDrlivo t)tetrxmpoodap nmicil(fa2tr(moot0oeen ieiytfm eauvsnt)altrmfcta1faDelnvsl(  2xo(m3iodolte ivtas aruaumonu4aeenmfctyd m ua(vpnu4arermrcty1fa  lneilt)seur(rpnu4ap   net s sDta( oou1tetoio3iadlaDra( s (4arxoif3oo1laD aiesls srtmiopoudll  mnci () Dta( oou1aetn ociaslm2rau ont0alxoir3oatopD ln slt0 2uoxopnu4llt livils arraxronu1opeo o3iat a umnmon()arermr3oatlm  anes t truoxr iodale licsls aDtru ooo4tee  icilt aDumn ont0alxrmf3oadoat aueo;t) rtrir3nu4opee nvs s aDuru p;t0olxo o3tldfs2ul(ms;u0tltnif oydop elnvs;t) 2urir3iy4ole  ncs tf rrrxm oo1ape  ieiytfm eanvont0aetrmo3oydomD  n ils)t2toim oodam n ieils artaxmpoo0tlxo f3ilsls2ulu ont)alxomfcoydomDr i s ( seumxrpou1lptemncslt)sDtmuronu0tpxnmfeiasfsDuaumpnu)aeermf3io1oaD auvol( setmxm iu1ol  mnvi () rtmxrpno4olxoio3iytfaDelumpnt)tlenir3oy1laD auvs;()sexmirpoo4ameemicslsfs2tau ont0olx  ociytfmDemu s;u)alxnircoatom eanvils sexmxrpiy4lmen icia(f Draxmp;t0optnmfeias s rmnvonu0 etnmo3oytom r nei (  rur(o iy4lme mneilt) Dumx  oo0apeo f3iytla2rluvp u4altrio3oa1lptrlivsl(  2xmim iy4lmeelfctl()aDtaum no1alen f3iltfs emuvs;u4artnio3tydomDrli s t) 2ur(r3nodol emneilt a2ra(r oo1tpeomfciytfm2emnms u) etrio3oa1omDeln o;()t2um(m3oy4alte ivslt) Durum ou0olx  oeiyd a rln p t) reoiociotomtrlueols  2xmxrpou4llte nvs s)a2taxrp;t4tpxomo3taslmDrlnmo;t4artnir oodoatelneo s srurio iy1omtn ivslsf 2umxm ;t4tlenmoetatls elu o t)aetoio oa1fptrlivolt  rtr(opio1op e nvilt)arrm(rp;o4aptnio3iatlm ra(vs u0arerxo tadomt  n il()srumxmpio4lp nlncsat)a2uru o;o0optoif3tyd mDrau onu4 rxoif oa1fatelu o;s0t2to(r3iy1amtnlictlt)aDra(rpoo0ole  ociydfa2rluvp;u4tlxrio iodomD  n s t0 exm(m3ny1omenmncsa(faDum(r ou4tee mo3iltla emu onu0alxoir oydfmDr i s s)s2ur(mpnu1amenmivtasf rtr(mo;o1aetnio3iltlsDra( snt0teeoircoatfmDeau o;t) 2xrxmpou4lp e ies (f rtrxr ;o1texniictlt a2ua(vp;u0tltnmr ta1omDean il()texm(m3ou4amte feta(fsrurxmpnu0olt mo3iasfm umn s t4trtnxr3oatlmD ln o;s)s2xo(m oo1omenmivi s)sDumuro;u4aet ii3iyd s2uln s t0aeerxf3ta1fpD anvs s)tetm(m3nu1ome mnetl(fsDumxrp;t4texoiictadlsDrmnvont)artnmo iytoaDe u slt srtoim3oodllenlfesl(f 2rau  no0oeto feiadlm2rmn sn(4 eenif iodoat au ils0t2xriopiodlmt lnvs tfsrtmxmp;o1apx  iciyt aDra( sn(4aetomo oodlp   uvo t0trxoxr3nu1lp  mfci (fs2tm(  oo0tlenmfeiad s2ea(vp u0 reomfciadom  aiei;t)srxo(r3nydam n ivs (fsrtmxmoou4olxn fctadfm2umnvp u4altriocta1fmtr i i s tetr(o3iodol nlncs ()arrmu p;t0aptnmoeiadfm rm( o;t4 rxomrctadlpt livilt  rxrirpoodapen ici sfaDrr(mp;t4tlt iiciydls rm(ms;t)tlxrxr oadlmt lieols  rxrxr ou1llee ivil( arrruroot4open fctasfa umnvonu4 lxrxf3totfptraivi;()sexrir3iu1apt mfeiltfaDrrxroot1texomo3iltlmDrm( s u0 rtomf ia1fmtrluvo;s0srxmxr oudlm n icia()a2rm(monu1olx  o3ildlsDrln pnu0 etnmf oydfa e u olt)sexmxmpoo4optemfcslt a2taum ou4olt ifciyt m ua(vs;u4teerir3tadla rli o;s)s2umio3oodom   iesatfaDrr(mont1oetniocild a emnvsnu4trermoctytfpDr u sl()s2xrxrpoo4lmtemfcilsfaDrm(m nu0alenmietysfm2emu o t0aeerxfcootfpt li o t0 rxmim nu4llen icil() Dtm(mo;o4olto feiadfs elumsnt)alxomr ia1faDr ieol( t2uo(r3oy4ale  fcs (  rtmxmpnu4ole  oetatls el( pn()alermrcia1lpDe uvo;t t2um(r io4altelfesat)srraumpot1olxomi3ildfaDrlnvs;(0tlenxo3oa1lmDrluvi;s texmxm3no1amt  fes sfs2urxmo;u1oexomoeildfsDul(mp () etnmr3oytfpDrai i;t) 2uo(m3nu4altn nctl(fsDur(ro;u0aetomiciadla2ulnvon() exriocoydfp  ai s t0srtrir ny4op n nvia(fsDua( onu1ale  i3tls mDrauvo;t4teeoif ty1lmD  uvil()setmxrpou4ope liciltfa2umx p;t0olenmietldfs uluvs u4aleoxrciadlmtrauesls srtrxm io4amtn fvi t sDta(  no0aexniiciasfaDulu ont4areoif3oydoaD aivols) 2tr(o3iu1op  lfesa()s2urumo;t1opxnifciydlm umnvpnt0alerxocoy1fm  au s s) 2xoxo iy4lmeelnvilt  Dra(mpnt0aetnmietytfs2em( s;u4aetomr3io1fm eai i t0truo(m ou1amen neia(  Dtaum ot0opto ociadlm ra(vpnu)teerio oa1fa rli sls)tetoxr oo4omt mfetat)a2raxrp;u4apt iicildfm2ra(vp t0aexrmf tytfaDe ieolt0teumxo oo4op n iei s a2ur(roou1aexomfcilt s2rl(vo;(0 reoxo3iy1fpDelnvolt s2uoxo nudop e fet ()a2rm( pno4apeoifciatlm emn p;t)alxrmf tatfa   u s (0t2xrxopou4aleemnvsls s2rm( pnu1tpeoiiciaslmDemumo u0arxniocia1opDe i ilt0texoir3iy4op  liesatf rtmur no0oeen o3iytfa um(mon(0aexomr3ia1oa  livo ( trtmxm io1ame miet ( aDrm(  ;o4tpenii3iysfs2rmuvon(0aexoxf3iydom rlues s setoiopnodameemiet (farraumpnt4apx ifeiys m2ra( s t)arxrir3ty1latelieil( t2xrxr oydll elictas  rumum nt0tpxo iciat mDrlumsn(0 rermf tatfm  lueilt)tetrxo3iodlpeemieias s2rruro;t1tpenmfcilt m em(vsn(0 rtnif3totlptelneilt t2umirpiu4ome lfes tfsrtaxro;u4apt moeiadlsDemums (0 lerir3oadom eaies;(0 2ur(opnu4am   ncs s)srrrx  ot1tpe ifeild mDua(von(0alxrmf3oadomDe ieilt)sexoxr no1al e ici tfa2umurpnu1texnii3tld m eln onu4trtrmrciydoptrli i t0 2umxopiu1lm elicsltfsrurxm ot1opeo i3ilsfa rlu p (4aleoio3oadlat livo s0seur(opny4lp   nesl()sDrr(mont1alt  fetat a2elnmp;(0tetrio oo1lpD lieo t0 2trirpiu1lpeemnctlt)aDtrxro;t1ape  i3tlsla2raumo;u0teerir3ootfpD anes;s)s2umim3nudll e nvsltfa2rr( p;o4apenmicildls2eanmont)arxrir3oo1oaDeauvo ( s2tmir oudolenlnctls  rtr( p;o1apx  f3tydfa2ua( onu4 exoir3tytfaDrli s;t0sexr(o io4op  lnctltf rrax ont1oeenio3tydfs elnvp ()teeoir tydoat li ils0 2uoio io4openlnvia(  2uaxro;t1tetoii3iasfs2emnmo;u0 renmfcoo1fmtraneils0sruoim3oudllenlnci tfarur( o;o4alt  ieiasfm elnvo;u4 rerir iadfp rli o;()s2xrim3iu1ape mfcias  rta(m no0ole iociasfs elu pnt0 etoxo3oy1lptr iei t) rtoio3io4ame lnvsat sDum(  ot4apeomfctyt m2ul(vsnu4aetnmr3iy1fmDe uvo t)setmir3ou4lp n nes t aDraxm ou4altoio3ilslsDrln s;(4arenir3tadfm r neslt)teto(m3iy4lmtemfct sfsDrm(ro;u4tpe  o3tltfm rmums u)aeenxf todfpt lieo s sexmio3oo1om elfes () 2tru  no1oeeniociatfs emu snu0arxoxfciatomDeli slt texrxmpnydam nlncslsfsrrau pou4oeeomociytls2uan snu4 lxnmo oo1oaDr ues;t  rtmio3iy1omt livtlsfsrrrurpnt0tetnifctys m umnvon(0artnmo ia1lmtr ivi t0srxoio3oudaptemfctatfaDurx  ou0oee ifctadlsDra(mo;()aexnir3totoaDr uei;s0t2trio3oy1op n ncias srrmxr ;o4optomieilsfmDrln pnt4trtomr todlatr uvi (0truriopno4alt  fvi s artax oou0aeeomiciysfm rm( p;t0 leoif oytop ean o (0 euriopiu1ome mnes tf 2umumo;t4tpt ifeilsls2em( o;t0areoifcty1lmt  nei (0t2urio3ou4lptnlnvt tfaDra(  ;u4oeeo f3iys s ul( o;u)tetnif to1lmtrau i;s0 etoim no4ap nliet t)aDtr(mp;u1aex  feiysfa2ea(vp;u0arxrxo tadlate n ols0trtrxo oy4ope mivslt aruru pot4opeoiieilsls2rlnmsnu) rtoxrcoydlatr n i;()trtr(m3iy4lm  mfvt s aDur( onu4aeeo o3iydlmDuanmon(0trtrifcia1omD aieslt0seto(r oo4optemicsa(fa2ururpot1apx ifctadla rauvp t4tltoxr io1oaD lieslt0 2urxopoy4lp e fci tfsrtm( o;t4tpeo ociadfaDumuvp;() eeomf iatlpDrln s;t)trtrxm ou1open fei ( s2tmurooo4apt ifcilsls rl(vp;t0tltniociytlaD auvs;t trxriopiy1lptn fct (  rum(rp;o0ale  ocilsfa rmu o u0treoxf3ia1fmDr ies t t2xm(o iodomeemnesas s2uru  nt0apx mf3tys a umumo ()aexnio oydfpDe uvs;s  rxrir nodlpe  ivsas  rur(m no4teeomfciydls2uluvo;t0arxoirctadfmtrli s;t) rumim iu4ap elics s s2ta(moou0tpenif3ild m2rl(vs (0 eerioctadfmDrauvi ( t2tmir3ny1amtelfet s s2uru o;u4tpenmfcils a raums (4trtnio oodfm ran slt srtmxrpoudlmt mnesat) rtr( p;t4tpxoifeiaslm elnmp t0tlerxf iotoa  an o t) 2umxr iodope lnctat s2tmx p;o4oet  oetatls rlnvs u0arxomr3oo1om  lueilt s2xrxo3ny1ap nmnetlsfartm(mp;u1alto f3ils a2ra(vs;()aexoif3oodoa   uvo () rtr(opoy1ol nmnvi s)sDtm(ro;o0optnmi3iltfaDranmo t4altnifcia1fa   ueil(0teurim oodap elfctatf rumur ;o4alt  o3ilsfm2ul(msnt0aexrifcty1fpD auvo;s) rtrirpny1op nmicta( sDrrx  ;t4oleo ietasfa2eauvs t0artnxf ootoptr uei (  2tr(mpiu4lmtelncsl(f Dtr(  no4aeeo octlt s ea( p u)artnio iydlp rau o t0 rumxm3iy1ap   ivslt s2tru ooo4tpxn ociyslm eanvp t0 exnxr3oydoaDeauei;t) 2xoir3no4altnmietls  rumx  ot0ope iieiltfm2uan p;(0tltoxf oadfaDranvsls0seumxopou1ll  lfci sf Drmurpnu4aptomocias mDuln s t0tetnircoo1lmD an i;s0s2xo(r3oudlmtnmfvsltfaDuaur no4tlx mieilslm ranvo (0tetnmfcoadoatrlivol( trto(mpou1ameelivs s)srrmx oou4oee mieiltfm2emnmpnu0tltoif io1optrluvi;(0srur(o3iy4ll nlfctls  2tru ooo4aetoiietad a2ulumpnt) rxnif3ta1fm raivi;s seumxm3iodome  icsas  Dum(ro;t4alt mfciatlaDrmnms;t)artrir iatfa r uvo s0sruo(r ou4lpe mfes t a2ra(r ;t0apen ietatfm umuvont) reomo ty1fp elu i;s) exrir3nu4om emfvi sf rrmur ot1olenmfciadls ra(mpn(4arxrxr3oatopDelivi t  euoim nudllenmfeslt arumxmpnu0opeoif3iydls2eanmsnu4trtrir3iytlm elnes;()seurxr io4oltelfcilt a2um( p;o4opx ifciyslaDum(ms;t)alxrxf3oatlatrln slt0tetoir3iydale liesltf Dtmxm nu1teeomo3iadlaDul(vo ()aetrmfctotopte n slt sexmxrpnydapeelfcsa(  ruaump;t0teen oeilslsDra( on()artrxrciy1lm rli sls0sexoio3iydlm n fcs (  2ta(ro;o1altomo3tytlm2ea(vsnt0 etoxrctotlmteau sls) eumir nu4aleemnvsa(fsrra( onu4tpt  fctldfmDrl(vo t0alenmr ootfp rlu o;s  rumxm3no4apeemneia()s2tm(m ou1openmiciatlaDrmnvs u0tltomf iy1fm   neol() exo(o3oodlpen nei s)sDtr(mo;o4olxoiociadfm emnvo u4 etnmocoadlatr ivol(0 rtrxrpnudomtn ieslt) Dtrx pnu1tlxo fcildfaDea( o () rxoxr ty1lpte i ols0texmxr3iy1optn ivt t a2rm(rooo1tpe  fctatfa elumon(4arxnmf to1lptr ivs;(0t2tr(m oo4lle lnvt t s2rmu  ou0oee mieilslm2ea(msnt4texrxo3oatfptrlnvs t)tetoxm3nu4llenlivias sDumump;t4tlenif3iadlm rm(vp;(4 rxnxrciodomDeluvil()t2ur(rpiodlptn icilt)a2rmu  ;o4opxoiieiydfsDrl(vp;u)alxoxf3tadfmDr n ol()s2xoio iy4alenlict t sDrmur ou4tpen o3tysfm2rl( o u) ltnif3iydfmtrlnei;t)s2uoxm ny1altn fcslt  Dtrxroot4altomi3taslm ea(mo u)altomrctodom   i ol()srxm(opiy4ale lnei s) Drmxmp;o0tlt ifctad mDrmuvon(0trtnxfciadlmDeaues s  eurxo3iudomtnlfvs t s2um( pno0altomietyslm ra(vs;t4aexrmf3oo1fm   ueslt  rtmir io4lm elfeilt)srurxmpot1tpxn ieiatfm em( pnt)trtrmrcta1fate i i;s t2xr(rpiy1al  lies tfarrm(m ou4tle  ictat mDem(vsnt0alenmr oadoat aivi (0 etmim3iu4lm e ietat aDtax  nu4tet mfetltfa emnvo u4teeoir3ty1fa e uvo s0srumxm iu1lpeemnvt s) rrmum oo4alenio3iadlaDrl(vpnt0artnxo3iytlp r ies;t  2umimpoo4om e neias arrr(mpot4alenmfctys sDrmn onu4aeenxo ia1fm ean sl( s2trxm3ny1lptelfctls) 2taurp;o4apxo f3tlsfm ulnmp;t4 leoio iydomtrlnes;t  eumim oo1lptelivsas  2tau onu4oeen ietadfsDelnvo;(4tlxoioctotfat li s;s)s2uoirpio1lm e ncilt) Dtaxrpoo4aleomi3iaslm2eanms u0arerxf oy1lpDr nvol( srxr(m ou4lleemiet s sDrax  ou1teenifetatls2umn o;u0tltriocoy1fa eln o;s setmxr iu1olen iesl( s2rru pou4aexoif3tlt m2emumo;()trtrifcia1fatrauvo t tetr(o iy1ap eliciasf Dur( onu4oetoioeiysfs uan o;(0trerifcio1fpD  i sls0teur(opiy4ome lncilt aDtmxm ou0oex mictad mDelu o;() leoxr todfpD lu sls srxmir3nodalenlncsl()s2rmxmpot1teeomieils mDemnmp;u4 renxr ty1lateauvs t) exr(mpiu1llte nvtatfs2taxm ;t0tleomi3iytfs2ulnmsnu4arxomrcta1fatrai o s) 2ur(o3iudopte fvilt) Dtrum no4olx  feiytlm2rl(vsnu0tlxnmr iytlat an i;t) rur(r oo1olen fcilsf 2trxrpot4tlenmo3tysls emuvsnu) eermrctodfp elieslt)s2tmxr3iy4lmtnlnctat)arraxmpno0opxnif3ils s2emnvs;t0trerir3to1op elueils teurim io1olt  fvtat)srrrx pou0oee mfctatfsDrmu s;u4 lxrmfcoo1lp r i o s0s2xrio3nodal  mies ()aruaxrono4altnifcilsla rmumsnu4trerxr oadopDr n o;s) etoxr3ou1oleelnctas  rrrur nt0aptomietasla uan pnu0 exnmf tatoa raivs;s  2uo(r3io1apeemfvsls)sDtmurpot0openiietysfaDrl(vsnu) lxnmocta1fpte ues t0 etr(o3oy4amenliei sfsDumxrp;o4apenmi3tat m rlumsn(4teenmrcio1laD auvi (  2uoiopno1ame mfcs s sDurxm no0oetnmoctltlm2eanvo t0 renxr tadlpt  nvols0t2trxm iy1ll   fctls aruau  ;o0tlxo oeiaslm2ra(mo t) reomo oadfp  aneolt teurio ou4olte fetas)aDurump;o1alt  f3iytfs umnvpnt4aetnio oadoa  an o t0 2xoxr nydapte nvia(faDuaxrp;t4oexoioetatlm2emn p (0tlxnxr todla rlnvs;()tetmxopny4oleelivsat) rua( ont1aex mfctlslsDrmnmp;t4aeenxr iadoatran sl(0sexmxmpnu4olt  ictat)srtmxmo;t4oexn o3ildls eau o t4areomr iytomDelies ()setrxr3iy1lptelneils aDuaur no4olxo oetys a ra( pnu4trxoxf3oa1opDr nvo s0seto(opiodome lnes () Dtmx ono1aet ifciydla2emnmon(0trxoirciadoaDelivi (0 2uoxr iu4op nlfcsl(fsrtm(mpnu0tlt iiciys s umu o u) rtoxocoatfmDelu ol()s2uoxo3oo4om nlfcsas a2rr(m nt0oeenmf3tadlm ul(vp (0altnxo3oytlpteli slt)seuoxopny4om   ncia(fsDrrxm oo4apenmf3tls m2ua( p t0alxoiocootlmt luvo t)srtoxr3ou4lp emfvilsfsDrmum ;u0tlx iictltlsDum( pn(4teeoxo oadfm e uvi;t0s2xr(r ny1olt licsa()arta(root1tee  f3iatls2em(mpnu4altrif3io1optrlnvils  exmio iu1om n fcsat a2umum ot0tetn ocils s rlnvsn()tltomo3oo1opt  nesl( s2ur(m nodlltnlfeslt) rtrx  ou4olt mi3iatls rmnvs t0aetnif iy1lmD lnvs s)srurirpoodaptemfvs s)aruau o;t0alenmo3tys a elumo;u4 etriocoytopt  nvs ( seurxmpoy1lp  lneta( aDurxrp;o1teeo ociysla2rlnmsn(0aexoiocia1fat au i ()teumiopiydlmtnmfei (f rumx  ot0altn icilt sDraumsnt4tltnmf oatlmtelnei;( trurxrpnu1ol nlnci sf Durx  nu1olt  i3iatfa elnmp t0trtrmrcoo1opDr uei;()seuo(r3no1lp  livtltfs2rm(mono1texnmf3iyd s rln o;u0aetrmf3iydfp r uei;t)s2xrxrpiu1altn ieslt)sDumu ooo1apeoifciltfa elnms t0trxomf iotfmD  ivo s tetoxo iy4alenmfeil()aDumumpno0aexnmi3tlsfs2ulnvo;t4 lxrio3iy1fmDr i ils)seuoxopiy1lptnmies t)srum(m nu4tpxnii3iysla2umn o u0alenio3iadfaDe uei t s2to(r oy4al   ivi s  Dua( pou4apeomf3iydls ul(vo u)arenxr ootlmDe nvilt0 2ur(o nudoptemnvi t arurxmpnu0optomf3iytfm2elu sn(4trtrxr iotfpDr i il(  2umim oy4ameemietlsfaDurxmoot1opx  oetyd a uauvo t0aexrxr ootlmD an i;s  eur(r3iy4lptnmictls  Dtmurpnu1oleoifcilsfa2eau sn() etoxo iotomte ivils0trtrxm no4om emfvia( aDuaxrp;t1tleo i3tlsfm2ul( pnu0 rxrxo3todopt aueolt)sexmxo3oo4olen nvslt) 2taxm ;o4opxo oetat a elnmp;u4 renxoctotfpDeanes (0t2trim3oydomen ieslt) 2tmump;o4tle  ociatla2ua( p () rtnmr oa1fpDr n o ()setoxo3iodol n nvi (faDrmxrooo1tpx mfciad aDumums;t)alxnmo3to1optran o;t0teumxo iudlmt micil()aDumu pnu4tpt  octadfm2ra(vo;u0 renmr tytoaD aivo s) rxm(r3iudomeelfetl(fs2tr(m no1tptomo3iysfmDrm(vpnt4tetrio tydomDelivi ()texrxrpio1am nmnvs s)sDrrumpnu1ape  feiydls emu pnt)trerxfciodlm e u il()s2tmxm no1altelictl(farumuro;o0aeto fctytlsDrlu s u)altoxf iatlm  lnvils0setmimpiu1ap elfcsl(farrr( p;t4oex ifctyt a2rmnvp;(4artomf tydfaDe i s;( srtmio3nu4ll n fvtasf Drrxm ;o4olt mieiltfa2rmu s;() exnxoctytom  lu s s)t2xr(rpny1lmt lfeiatf 2tmx  ;o1apen fetytls2el( snt)artrircia1fp  aivi (0t2tmio3oydlptelnviat)a2tmx p;t1tet mi3ildfaDumnmont4 lxnifciydfmte ivi (0 etr(opou1op nlicsltfs2um(monu1aex if3tysfmDeanmon(0alerircoa1opDraivol()srur(r3iy4altemiesas sDraxro;t1teeomoctydlm2rmumon() etomr oatlpteanvs;s teuoio ny1lpenlfctasfsDtmxmpoo0tpx iieiltlmDulnmp u0 exnmfcta1fa raivs;(0 2tmxm nu4omtn feils arraxr oo0apt  f3ilsls2rmumo ()arxrircoy1fa  an il()trxr(o3io4al  mnctat  2ur(mpnt4aeenif3iatlm2um(mo (4 rxrxr oadlmtran i;( trtm(r3ny1lp n nesls s2umx poo1optomo3ild a2rlnmp u0tlenifciydopDelnvilt seurxm oydlmenmfvsl(fsrtm( pnt4ape  feiatfmDra(msnu)altrmr3to1latrlues;t0trto(m3ny1aptemnvi t sDum( ono1aexnioetasfaDrmn snu4 rxomo to1la ean i;t)trtoio nodopenmncilsfs2trumpot0tex  f3tatfs2emu s;t)arerifcio1omDraieo;s0t2toxmpou4oltnmivtasf Durur ;u1oexn i3iadlm uau s;(0trerif iydla  au s;s) eur(o3nu4ape mncias  Drmxmo;t0apxnifetyt sDea(vp;()tlxnif todfmte u s s)t2trirpou1altnlfvtas) Drm(mpno4opto octysfa el(ms u4artomrctytoptr ies s) etm(rpoodlp eliciatf 2uax  ;o0altomoctytfa em(ms (0trenmo ta1om elnvsl( s2toio ny4ope mfvi ()aDtau oou1tlt  ictyd aDul(mp;u0 eeoxoctodlp e ies;t0teumir nu4amenlnes t)a2rru  nu0apxniiciasfm2ranmo (0altrmf3iotfat auei;s0 exm(r3no4omtelict ( s2ua(roou4oet  f3tytfs2rauvo;t4 lxniocto1fpDrln i (0 exoxr3io1alteliet s srur( pno1openiocias sDem(vo;t4 lxrirciotfa   nvo s) 2uoxr3oy4ameemnci s)srtaumpno4tlt mictls m2ul( pnu0trxnmfciytlmtrln o;t t2umio3oo1ape mietat artr(r ;o1tetn o3tlsls2eluvp;u) eeomo io1fm eanvils0s2uo(r ou4al  lici sf rurumpnt1tlx iociatla rluvo t)teeriocta1oaD lnes;t)s2xrxo no1olenmfvi ( s2taxro;u1oet ifctltla2rm(vp;t0 lenmocoytom eluvi;() rum(r iodaltn fetasfs2rm(r ;o1opxn ietysfa em( onu4 rxomocoy1lpDrln s t0tetmxr3oo4lmte fcslsf Dtrxmooo4tet iiciltfm umuvo;t4 etnif todlaD aivi t trxm(m iydlp emivtls)srumu  nt1tptomfeiytlaDeauvs;t0 etrxo oatom  aneo;s0 exrio oy1ap e ivslsfa2tmxroot0tpe  o3tasfm2emn o u)tlenmr3tadfp rauvs;( s2urxopnudape lnet (f ruau  nt1tlt  fciytlmDumums;u)alxrxf3oadoa eanvi t teto(opnudole mivtl( a2uaxr ;o0teeoifciytlmDul( o u4alxrir iatoa  ln il(0texoir3iy1ap   nci t aDuax ont1oeeoii3ilt s umnvsnt0aeermr tytom  luei s)tetmim3oy1lmtnmfcsat  Dtr( o;u1apx mfetysfm2raumo t0aeeoxocia1fm ran s;s)srumxr no4lpt lietas  2ur(m ;u1aet io3iytls em(vs;t4tltrmf3tadfaDraneo;(0texr(opoo1lleemfcia(f 2ur(  ot1tpx  i3tysfaDrlnms;u)arerxoctytopDrlnvo;() eto(r iydole mfviat s2rmx pnt1tet iieildfa uluvon(0aetrifcta1fmtrlieo;s  exoimpnu1ol elfviasf rta( onu0ole if3iad m2rauvs () reriocoytfa   ies;t seum(o3iydlle  neiat) 2ur( ooo1tpt  i3iydlsDuanvo (4 etrxf oa1omDeaneilt0teto(o3iodop emnci sfsruau  ;o4teeoifeiytla2rluvsnt0texnmf totopte u ils texmio ny1aleemnctasfaDrau pnu0opt micias sDelnvs;t4tlxnmo iatlmD  n o;s srurxm3iu4lptn fvi (f 2taxmpno0alxo oetadfm2ra( s () exrmoctydfmt  ieo;t) 2xrirpny1olt lietls) Dumumpnt1opt ifetatls ea(von(0treoir iydlmD aieols  2xoio ny1ameemicta(farrm(r ;t4apeomi3iatlsDrmnvonu)trtnio3oa1fmDeaneo s0srtr(opoo4lptnmivias) Drruroot4oexn iciltfm rl(vont0tltnmrcio1oa rluvi s teuo(o oy4olt licia(farum( o;o4tpxn f3ildfm uanmpn(0 rerio tydlmt aueo;t s2urxmpnu4lpe  neiat s2urx oot0apxoifctytlm2ulnvs;(4tltrxf oytlm rli s (  2xrxopoo1am e ietlt) rraxmo;o0tptomf3tldlm rlnvo (4trtrmrcootoa  li s;s) exmxrpoy4llen nvt s) 2umx  nt4tpx  ociydlsDua(vp;t0trxnxrcoytoaDeln slt0t2xm(opny4am   nes ()arraur ;o1opeoifctlsfa eau s u4arxrirctotopD  ivo;t0 2triopnu4apenlnvslt  2tm(mpou4oex  ietad m2ra( p u)altnmf3oytom e u i;s) rtm(mpiodlme mnei () rum(m nu4aet mociadla eluvs;t0artrmr tytop r ueolt)s2um(r ou1open nvtas  rrr(r ou0opx miciatls2ulnmo;t)areomf3iydoatr u i s)trxoxm nydal nlics s)sDraxmpot0ape
\ No newline at end of file
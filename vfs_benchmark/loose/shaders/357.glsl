@@ -0,0 +1 @@
+nvslt0 2xr(rpoo4omee feiltf ruaxrpnu4tpx io3tydfs2rln pn(0teerxocoydom elivils0tetrio nu1ap  mieiasfs2ta(  nt1opeo ictys s rlnmo;t)aetnmr oo1lp   nvsl() 2xmir oo4olee ivsls)aDtr(mo;o0aexnmictlt aDrmuvs;u)trerirciydlat auei;s trto(o oydam  lfcils  rrr(moou4apxniocilsla raump t4 exrxr tatla  livi;(0seum(m oodlm e ieils)artaump;t1tpxniociat aDumuvsnu)artrmo3oatfa r ueo;( srurimpiydame lnct tfsrumu  nu1oltomieiaslsDrauvs u)trtrxr iodfpDelnvols0sexr(r3io4lmt mnesasfarrau o;t1tex  ictytfm2em(vo;()teerifciydom elnvi t0srxm(mpiy1lpe lieslt) Dur(monu0oetn feiytls ra(vo t)artomocoytlpt livi (0trxmxopoydapeeliviatfsDur(mp;o0tpt mfcildls2el(vpnt4artrif ty1fpD au o;( s2umxo oydom emneias)srumxmpnu1tle  ietatfm2emu o (4 lermr3iadfa elivs;(  exrxr3oodapenliesa( s2raum ot4alenmfcildfa rmnvp t)trtomf3todfatr n ilt) rxmxopoo1oleemnvi ( srta(root1ope  ietadlaDemn on(4arxoxr3totfa r ivo;t trxoxo no4lltelivtl()sDrm(m ou4apx moetld aDuanvonu0 rxomr3iotfm  aiei;t0 rurio3no1alt mfci t  Duaxmp;t0tetoif3ild s2uauvs;u4 rxomfciodla elivol() rtm(opoudlm  mieiltfsDtmxmono0tpxnmiciyt a el(vsnu)arxrir tydlpDelivi;() 2xoxm3nydllen ietl()arua(  ou0tle  oetltfa2ra( sn() rxomf3todomt  ivi s trtoim3io1lme mfetat) 2trx  nu4tpxo oetydfs2rau o;t0aeermr iy1lpteanesls)trum(m ou1lpt  nvil(fa2tmurpot4alen feiat s2ul(mpn(4trtoxr iydfpDelneils  2urim iu4om e feiat) 2ra(  nt4tlx  icils a rl(vs;t) ltnir iatlmte uvs;s)s2xmimpoudame mnvils)aDrrxmo;t4aptoiociysla uan pn() lxrmo3ty1oat au i (0texoim oo4lp elieil( arumx pno1olx mfeilsfm2rlumo;() eenxfcoydfm   neils)srtoio3oodaltelieias)artm(mp;u0oetnmfetas a2uluvsn()tlenmo3tatlptraivsl( s2tmxm oodolenmici sf 2tmx  ;u0ope io3tyd a ua( o t)texnxociy1lmDelnei;s) exmim iudapeelfesat)s2ur(m nu1alen ocilt sDua( p t0trerir3ootlaDrli ol( sexo(r ou1ape lfes (fs2tm(mono4oee mo3iadfaDua(vs;() lxrxf3iatfpt  n sls0 2trxm3oy4ap  lfvsa() 2rrumpnt4tpx iociasls2emu s;u4 lxoxfciydoa e n o;s0 2to(m3oy1lmte icsl() ruaur nt1tleo oeildlsDrm( p;u0aeerxf io1fmtraivils0t2tm(o oodolee ieil( sDrrxmpou4aet  ictasla uanvont4artrif3totlmDr n i;s srxm(r3nydamtn ivt sfs2rmuro;t4oetnmfeilslsDrm(mo ()tetoxfcoytop  anei;s)t2xmirpiodaptn net () rum(rpou0aptnmociad mDulnvo;t4tetnxr todla eai slt0 etrxm3nodam n neta()s2trxrpot1oexo ieiysls ea(mp t4tleoxo3todfaDr u il(0srtmxo oy4lltnmncsas) rumx  no4tpeomfeiatlaDrm(vp t4tleomociydlpte uei s)t2tmio nu4am  lfvia(faDrrumo;o4oetn feiat m2emn p;u0aexrircta1oaDean s;s)seumim iu1omtnlncs tfsrrm( o;u4oet ioeiyt a eln s;(0aetrircta1op e n slt s2xr(r nodomtn nciltf Duau pou4oexn feildlsDulumsn(4 etomf3totfm r ueils seuoim ny1ome  neiasf 2rr(rp;t1tpxo oeiatfsDelnmsnt)arerxf3oa1late nes;(0t2to(mpiu4lm   icsltf 2ur(r nt1olxn ietys a2emuvo;(0 lerxfctodlm e uei s truoxm iydlptn fvi () 2umuroot4aex ifeiyd a2rm( p t4 exnxr todlmtelu slt0seuoxm no4lmt lietls) rrmuronu0alt ifcilt m2rlnvp t) eermr oydopt lnvi;t)s2to(o nu4ap  livs (fs2rrxronu1tetn oeiatfs elnmpnt)aexomo ta1faD  i ilt  rxrim3nydameeliei s srtm(m nt1tptnif3iydfa2rlu pnt0trtrxr iydfmteln i;( trtm(mpnydol n fesl()aDrmx pno1olenmiciytfs rlnvp;u) rerioctotoaDeanvi;() euoxm iu1al   ieiat)srumumpoo1tlen oeiadfs2rmums u0aetoifciy1fmDrluvi t  eum(m3io1llee fes s  rumx  ;u0tlxniictlsfsDel(vpnu)aetnif oytoate uvs;s0 2trir io4altnmfeil(f Drau pou1opto oeils mDrm(mo t4 leoxf ty1opDr ivi s teuoxm3no1apte ivt (f rrrxm ot4tlx iieiasfmDumumpnu)tltrio tatlp eanvo;(0teurio3oydoltnmict tfsDtaur ou4aee moeiltfm2elu p t4arxnmo ty1om eanes t sexm(m nydomeelicil( aDrm( o;o0alxn feiysfa2rmuvo;t) reoiocoa1lp eanvo;t0 2tmir3iu1lme mivsat arrmu oou4oeeoiociytla2emuvp (4artoif3oodop eanes s0trur(opio4llte nct s)aDraxmooo4alxn i3ias sDelnvp (4tetoifciotoa rli ils) 2uoim no4al n fctls  Durumo;u1tpx mo3iys m ranvo;u4 eeoxf tydfmD li o s0trur(m ou4alen nvils)sDum(r no1tpeomietlsfsDrau s t0 etnio3tydfpt  iesl()seto(r nu4omen ivtl(fsrtmx o;t0oetoiieilslm2rmuvs;t)treoir oy1la  livilt  euo(rpoo4openlfvs s) Durx  ;o4tpt mfctatfa elnmo;t0tlxomo3iadoptr n il(0texrir3oy4oleemnvt tfaDua(  ;t1apxo ietatfs2rlnvo;() ltrxr io1lptrlu ils)s2tm(mpiydlp e fesatfaDtmuro;u4oeeoiieiydla elnvs;u)arxoir oydfp elivolt0srxoio oydamte ieiatfa2ra(m ou0tptoii3iad mDumumon(4 lenmr3oodlm elneols setoxmpoy1apeelneta()arta(  ;t4tpxoioeilsla2umnvpn()aexrxr tatfpDr ues ()sexm(o oy4opt mnvt ( arrrxr nt0opx  fciaslmDemumpn() lermrcoy1lp rliei;t teur(r3oydllt  feias arrmxmpoo0oleoifciaslm2umump t)teenmo3oatfa  lu sl(0 rtr(mpiodlmee icta(faDraxmo;u1tlxn ieildlsDea( s;t0 rxomf3oatfmDeluvil(0 rtmio3io1am   nciat) 2taur ;u1altoioeiltls umu o;u)texrifciotlpDr n s;t)truoim3io4ll n nvt t  2urx  no0oee mfciyd aDrl(mont4 exoxrcoodom   u i;s)srur(o3nu4am nmneia(fa2tmxmpno0tpt  ociltlm eauvon(0aetomrcoa1late uei (0t2toirpoodam emnetasfsDuax pot1olxomi3iyd aDul(mpnt) lxnxocta1lm e i s s0trtrxrpoodale miesl()srtaxr nu4opeoioeiydlm ulu snt) lxrxo tytlmDr n s;s texrxrpoo1op  mfesl(  2ra(m ;u0tpt mfctyd s ranmpnt0aeeoio3ta1lmDraivsls s2xo(rpnudolt lfviatfaDtr(mo;o1oex mi3tysfsDumu sn(4aleoifcta1fm eaueo;s0 rtm(m no1aptnlnvta(fa2rr(m no1tptoiociytfm2ra( s;u4trtnxrcoatoa rauvo;(  2xm(m oodole  nvia(f rtmu  ;u4apto oeiasfa umnvs;u4trxrxrcto1fmt lu olt0srxrirpnu4optnlnct ( sruaumo;t4ale  ictltfs um( o;t) ltrmoctytlaDelieo (0 eto(opiu4olen fesls) Durumono1tee iocilsfa eln s ()teermo3iodfp eanvo;s0 etr(r3iudop emfcs ( arta(monu4ope moetat sDeau o;u0trxrmrcoatfpD lu s s srtmxm3oydlp  mnvtat)srtm(r nu0oet ioetlsfmDrlnvont0teenxr3tydfa   u i;s) eum(rpnu4lpeelivi s)srrmxmpou0alx ifeiltfaDrluvpn()aexnxfciy1oat lnvs;( srtr(r3oy4openmieias srumx pot1ope mietad m2ua( s t4tlxrxf iotfp eaueo t0s2xoiopiu1amtnlfvt (fartaxrooo1tpe if3iatfs ulnvsn(0texomr3oydfate nvo t)sexo(rpny4lmte fci s s2tr(ro;t4ale iictatfa2ul(vpnu)tltnxo3tytfa e ivs;( trxoxr iy1aptn ictat sDta( poo4oetnmociasfm umumont)alermo3iy1oaDrlnes;t)setr(opnu4lme mneiatfs2trxronu1tlt mfctyslm em(vsnt) renxrctodfptrlnes t) eumxrpiy4ap nlnet (fa2trumooo0aet if3ils a rmnvsnt0aleoir oatopt luvo s0s2to(m iodlmtelics (farrrxrpou4tltnii3tatls2umnvpn() rerir3oo1opD anvols  eumxopoodll  licia( sDrmxmono4ope ii3iyd a um( o;u0altoio3tydlaD lu i t0 2xo(r3oudal   ictat srua(roou0teenioetytfs rmu p t4 lerioctytlp e n olt)setmxm3no1lmenlfct tfarrrum ot4tptniociltfs2eluvs;(4aexomfciadfpte n ol() etrxr nudomeelncilt s2ra(mp;t1tlxomfeiyd a rmn pnu) reoxrciy1lm r uvils) rtmxm iy1aleemfvtat aDrm(m ot4alt  feildfm2umnvsnu) etrio iy1lmD ln s;t0 exoxo3nydope lfvt s)artmurooo0opxo iciydls2uau snt4 exnmo3tadfa rauvs;t)srxoio3ny1lmtn ies s) 2uau p;t1ale  o3ilsfa rmu p;t0tlxrir tadopDeanei;s0s2tmxo iudlmen ivsa()s2rau ono1oleomi3iatls2emnvs;(0 lxoif3tadfmDranei;t0trum(r oo4alt mneil(  rurxrp;u1alt mfeiadls rmumsnt4 lxnxf iatfpD lueslt  rxm(r iydopeelnci tfs2tmxmooo0apxoiictad aDrl(vo t4treoif3iytoa   n ils seumimpoo4ll   icia()srrmxrpou1tlx iietytls eanmon(4arxrmf3iatlm r ivi;s0s2trio3no1am nlfvtl()arua(rp;o4apx mi3iasfs2rau o u0texomf3tytlp eau ils0texm(o3oydaptemfes t) Dta(r nt1tleoioctldlaDum(mp t) rxnif oy1fmt  i i;s) 2umir3nudomen fcsa(fsDuax  ot4tet io3iadfsDrlnms;u4texoirciatlat lneslt)setr(r3iydlpte ncs tfsrrmuro;u4opeoifeiatlmDem(vs;u)artnmo ty1opDr i slt)t2xmxr3nydamt lfcsa(f 2urx  oo0apeo o3ils aDrln p () exoxo3oydopDr ivilt trumxopio4lme  neilt sDtr(  oo1altnif3ils sDelnmo t0arxrif3ta1fa  lies;t) eurir3oodomenmnet t)srumxm ;u1tptoiietyslmDrmn s t4 lenmociytlm eluvo t0trto(r3oo4lm  lncs ()aDrau pou1aexn oeiydlm ra(vo;u4aeeoxocto1lp rlu o;s0 rto(r3ou4lm nlfvsls)artm(mp;o1altomf3iytfs2rm( p t4 eeomfcty1fat  u s ( sexmxm iu1omenmfet tfsrrm(rp;o0opt ioeilsfm2ul( o t)trtomo oytla   u ils trxoim io4lm e fes t) 2rmx  ou0tleo i3tatfm uln s (0tlxnmf ootop   i ol(0s2xr(o oy4oleemfesl(fa2uaur oo4tptnio3ilt a2ulnmsnu) lxrxr3iotla   uvs;s0 euo(o3nudlmeelnei t srumur ;o1teeomf3tatlm2rmnvsn(4tlerxr oy1fm   u o;s) 2uoxmpiu4oltemivs ()a2truroot4altnmieiat m2ulnmpn() lxrxr ty1fatelieil()t2xoxo io4ll   ivilsf rum(m nt1olxn ociyslm2elu s;t4 eerxrcoodomDrlivo t0truo(m iodom n fctls) Duru o;u0apxnmfciytfs ulnvo;u4tlxoifcoydoaD  ieo t) 2um(m iu4optelfvs sfsrtrx oou4texniictatfm elu p t4aetrio oa1lp  ln s;()tetmxr3iu4al  livilsfartaumpnt4tlx ii3iadlm2ra(mp t4tleomo3iy1opDr ies;(0srxoxopoy4lpen neias aDrmu  nu1alt  ieiydfa2ua( pn(0trxrxr iadomt au o t)s2xoxopny4oleelnci s)arra(  nt1opxn o3ilsla2rauvo u) rtnifctydlpDr n s s teumio3iu4llte ivslsf Dum(mpnu0openmf3iysla raumsnt0 lxoxo iydfatr ivi s0 2tm(r3oy4om nmneiatfa2rrum ;t0alx io3iltlm emuvo t)aexrxo3tadomtr ues () exrxmpnu1lmen ncils srtmu poo0olx  ociltls el( s;u0 reomo ootop r neol(0t2toim3oy4lm nlivt sfs2tmxmo;u4ole mieiadlm rlnvpnt4tltrmrctatomteai slt) rxrxo oodlmeelnvtas)arum( pot0alt  fciydlsDemu s;(0 rxrmr iydfa  li i s0 eum(m3oy1om  mictatfsDrmxm no1tlx  feiysla rlump () rxrmrcoodfpDr nvs ( s2uo(r3oydlle mncs s sDtax  ;o4ale mf3ildlm2eln pnt0 lxoircty1laDrlneo s teto(m iu4ame mnvia(farum( pou0oeenmi3ilsfsDra(vo;(4artrmrcto1fmD livolt) rxr(m ny4omtnliviat  Dtrurooo4opeomo3tat m um(mo (0 lenmr3oa1lat liei ( teuoxm oudlpt mies sfa2umum nt1aetnmoctlslm2eau p;(0 ltomrcia1lp eauvo;s0seurxopiy1oleemics t s2uaumpot1aexnioctlsla2em( p;t4 lenxfciy1fa elu s s)sexmirpoodap nlict sfs2ta(root4opx miciys s2uan sn(0 ltoir3iodomtelueols)sexo(mpnu1ape mncilt  rumxm ;u0tlt  ictaslaDua(vsnu4tetrxoctatfpDr nei s t2uo(o oy4ll n fci s srta( pno1oexo oeiyt s2ean o;(4trenmfcia1oa  aiei ()texoirpoy4lmee icsl()s2ta(rpnu4tpeniietadfs elnvs (0teeoirciodlmtrlu i;s)truo(m nydop elnvsa() 2uaxm ;t4olx moeilsfm ranvs t4arenif oatlm elies;(0 eurxm iydlmenlncsl( artr(mono1tptn ietydla ul(ms;u0alxnxf to1lp rlnvo s0 etoxmpoydal n ietlsf Drau oot0opx  ieildlm ra( s u0altnircoy1fa rai i s trtm(r oydolenmieiat)s2taurpou0oex  oeildlsDuanmpn()altoxfcoo1lm r uvolt  2xmxrpny1lle  fes s)s2tmxm nt4opeo o3iaslmDrl(mp;u0areomrcoadfaDelies (0 rtmio nu1lm elfetas sDra( o;u4aee mf3iyslm2rlnvs;t4treomo iy1lmDe ivs;t)teur(r no1olt mici (f 2trx oou0texomf3tlsla emuvp;u0 exnio ootfa  li s;(0 rxrxm ou4op elfvtl( srua(mpoo4aet moeiysls em(mo u0tltoifcoo1fpt aneols0 euoxo nodolt lfei ()srrrxmonu4tex iocias sDea(mo;u)aexoifciy1la e nvolt0texoxo3oo4omtnmies ( srrru p;o4oex ii3tat s2em( s t) eeoxo3oytfa  lieols) exmio3iydll nlfes ( aDtmu o;t0tlxo o3ildfmDrl( o;(4tlxrxfcia1optr nvo;s0 2um(r oudameemiesl(f ruau  oo1tleomoctytfm2rau s;(4tltnmr tytfmt  neslt0t2xmim ou1lptemnvi s artm(r ;o0oltnifctydfs2um(vpn()aeeoir3ia1lp  luvs s  eurxm oy1llt  ivtls a2rmxr oo4tpto ociytfsDul(mp () rxnif iatlp raivi (0teumxo oydlm elnvilsfsrraxmp;u4aet  iciysfs2rlums;t4 rxrmf3iadlaD aues;t setoxo iy1ape lncsat)s2trx  no4altoif3tls aDrlumo () leomo3oydfm  lu i;(0srxoirpou4lmenmfetat a2raxronu4teen feildlaDeluvpnu)tltrxf oadfat  ues s0sexo(rpny1ap elicsa(  rua( pno4tlenmoeiydfs2ul( sn(0aexnxocta1faDe nvolt t2tr(opiy4lpe miesatfs2trx o;u1tpxnif3ilsls eanvsnu0 exrxo3io1fm elueols  exmio no4am emfei ( s2um(ro;u0oexo octat s2ul(msnt0treoxocoa1latrli s;s texoio iy4lpte fvtls aDuau ooo4apeoiocild s2emums;(0tlenxf oo1fa   nvs;(0teum(m io1lltnlnvtls aDtruroou4texnmfctysfs ean p u)trerir oodlmtran o;s)srtrxo3ny4olen fci tf Drr(r ;o1texoiietytla2umu ont)tlxrmo iatlpDr neilt texmxm nydamenmnctl()arrrxmo;u0opeomf3tytfmDrlu o (4trtrmrctydomD aues;t s2xr(opio1ole  ncil(f 2urxmpnu4aex mf3iasla2ranmsn(0 eenxociadfm e ivs s)t2toxo3oodap   nesa()a2rrxmp;t1alxo iciasla um( p;(0tltrmf ia1lp rln i t  eto(mpnu4ol n nesl()s2trxr ot1apxnmfciytfmDranvsn()tltrmociotfpt  uvi;s)seumxr oodap nlfes tfa2raxr no4tlxniictyt s ul( p;u0trtnmfciy1fat au ol() rumxr iydllt lfci sf ruauro;u4aptnmieiyt a ulnmon(4aetoifciodoaD luei (0 eurxm3nodolen fet t)sDurx p;t1olxn o3iltla2emu s;t)arenxfcoo1fat  iesls)teurxrpoydlmt lncil(farraxmpnt4tltoio3tas aDeluvs t4 lxrxr3ty1fa   i s ()seto(m oudlmtemnvsls s2trurooo1tpe io3tysfa2eanvs;t4aeeoxfctodfpte n ils)seumxopoudamte nct () Drr(  nt1oexnmfcilsls rl(mo t0altomo iadlmDeaieilt) etoxm3nu1lptelfvslsfsruru o;o0alxn octlslm rl( s;() exoir3ia1lm   uvi s0 eurxo iodll emfcias sruau  ou4ope  o3iyt mDemnmpnu)tltnmo3todop  lu s (  2xm(r3io1ll nliei () Drr(ro;u4olenii3tldfs2emuvont)tetoxr oydoa r ivs (0seuoxo3nudap n ies (faDuau  ot4tex mfeiadfm ul(vpn(0 etomrcto1fpDelnvs;(0truo(mpoo4apt  iesa(farrmxro;t1altomietasls2ranmo () lxnxr3iadom r nvsl( srtoir iu1llt lfvtas s2uaur ;u1oleoifetld m emnmo;t)aexnxo3io1fmD auesl( srxr(o3oy1lme lfei ()s2ta(  ot0aet  ieiysfs el(mont0 etrxfctatfat anvs ()t2uoim3nu4al e fvsat artmu pnu1opxo feildfm umn p t4tlerxf3ia1oaDe n s;t t2tr(m oo4lmtnmfcsa(  Drax o;o1alxnifetltfm2umu on() leoxf oo1lp   ueolt) rxoxr nu1ame lnesatfsDrmumo;o0apenifcilsfm2rau ont4 reomr3ty1om rlnvol(0seumxo io4ap n nvtat  Dtrx p;u4tltomieiasfs2el(vs;()tlxoxf oodlaD aneols teto(opny4altnlfvsas arrmumoot0oltoii3tytfa2rmnmont4 etnmfcto1fpD livs t  2trxo3oo1al  mietl(f rrr(mp;t4opxnmocilslm2emn s t0 lxoxf3io1oa  aieolt) exo(r iy4omeelfvi sfaDrrump;o4oet  o3ils m raumsnt4arerircia1fate n i;t  rxmxo iydale  fetls arurum ou4alxnmo3tydla um( p t0treoxocta1lptraieils) rtrio3iydlltnlfvt (  rrmu  ;o4tetniieiysfs rmuvo t0trtrirciodlmDraivo s)s2tmxopnydlpe  iesasf Duaur oo4apxoiicils sDrau p;()trxnmrcia1la eaivo;s)s2trio iy1amtemnetltfa2rmu ooo1altn ociadfs ua( o;u) rxoxoctadfpDe nvs;s  ruoim oo1omenlneia( sDrm(m nu1tltnioctysfaDeluvsnt0tlxoxo3oatfm eau o s0 ruoxopno4lptelici t)sDta(  ;o1optomfeiasfs2ra( onu0tetnmo oatla r ueo;t)s2to(r3io1op nmict s a2rm(ro;o4optnmoetlsfm2ra(vs;(0tetomocty1oaDe n ols trur(m ny1lpenliet () rua(m oo4oexnmo3tlsfaDranvpnt)aexnxf oy1omtelu s s)s2xrxopny1olen feil(f Dua(m ou1tpe  o3iasfaDuaums;t4aetrir oodlmt aueolt0s2xmimpnu4omee nes t)sDtmum nt4opeomf3iadlm raums;(4arxoifcia1fa ran o;t)setrio3ou1amtnmfei (fa2umxmpno1tpx  o3iytfa2umums;(0altoxo oy1fpDeauei t)sexoir3oydllenlneta(f Dtm(r ;o0tle mi3tyt s el(msnu) etnif totopteln olt t2urimpoydlmtemfvtas) rrmu  ;o0tptomo3tysls um(mp;t0 leoxo ta1oatrauvi;(  2xrim io4alenmfeils arrau o;o4oltoif3iyd mDemumo t4 lerir todoaD aivi t0s2toxopou4apeelictls  2tmx  no0oltomoeiad a2rlnvs;()tlxomo iadoa   nvi s teuo(r3iy1lmtnlnci t  Drrump;t0alen fciysla2uluvon(0texnxf io1lmtr u o t0 rtm(m3iy4lleelnctatfs2rmum nt0altoioeiat a2ranvp u0teerir iatop rli i t t2toxmpnodalenlfvi ()aDrru  no1tpt  fetad a uan s t0 eenir tytlaD aueo s trumio iudoltemnvsa()a2tr(mooo0oex  fciasfs el(ms;(4 eeoif tatfmDe ivi s)srumiopny4lleemfciat  rumu p;u1tlto f3tytlsDel(msnt4 lerxrctatoa e nvs s) etm(m oy1oltnmies (farum(mpot4opt io3ildfs2el(mp;()tetrxoctotlaDelivslt0trtmiopnu1opeemfet s) Durxmp;u4oetn i3iltfaDea(ms;u)altoxr oo1lptelu i ( sexm(rpno1ll  mnvtlsfs2tm(ro;t1aetnmictlt sDuauvp u4altrircoydoa r i s (  rtr(m no1amt  fcia() Drmur ou1tpx  ieiyt m eanmp t4 leoxf3ta1lat an o;s0 eurxm3iy4apen fcsatfsrtrum no1tpt mf3ildfm em(ms u4 rtoxrciodfmtr neo ()srxr(m3nydole livi ( a2rrumpnt0oetomieiysfs umuvpnt4texoxo3oodlm   uvs (0seumxr nudll   ictlt s2umxmo;o1apxo o3iatls2el(ms;t4tlxrmfctydomtrlu ols srumim iy1olt lfvia(f 2uauro;u0alxoiicildfm elu p;() rerif ia1om e ies;() rurxm3oy1opt mfviltf rrrxmpoo1tptn octyd mDumn pn(0 renif3ootoptrauvsls trxoxmpiodapt liesls)a2ua( pno0altnifeiasls umnvs;u4 ltniociotlpDraieo s)sexmiopno1aptnlietls aDrrxmp;u4altnmo3iaslaDemumo;u)trenxfciadfp elu s;t sruoio3oudlptelfciat  Dtr(ro;u4apxn ieiatfa ea(mp ()trerircoadfatranvi;()trtoxo3iu4ole lfcslsfsDra(rooo4optoii3iydls2ranvpnt0 rxriocoo1fa  anesl(  rxmxrpiudllte feilt)a2ua( pnt0texomieiyslaDem(msn(4teenxf iydlp  ln i s)tetmxmpiodaptnlfesa(  Dtaxro;o4alxomiciysfsDelnvpnu) etrir3to1lpDean ils)texm(o3ny4oltnlivsl(fsrra(rpoo1oeeomietlt s2emumsnu0 leomociadlm   uvslt) etrir3iy1ame  fvils srumump;t0tet  i3iadfs2elnvs (0texrir3iodlp   i s t srxo(r nodalenlieias)sDtaxr oo0oee mi3iyd a ulu p;t)tlxoir3oy1oaDr ivi () rxmim3iy1al   ivta(f 2rmxmp;u1aeto o3iydlsDuau o (4aeeriocto1oaDe i sl( s2umiopou4lpee fciat)artm(r nt1aexn f3iytfm2uluvsnt4tlenxr3todfptrlu i;(0s2trim3no1op  mfct (fa2rmu  ;t0alenioeiytfs ea( sn()tetrxrcty1fp rli ilt s2umxm3nu1lmen fvslsfsDumumpoo1opxomieild s umnvs;(0tlxrmf tadlatranvo s) 2tr(m iy1ame mieiatfsDurx pnu1apx  i3tltlm eau s;u)aexnxfcoa1lmDrlnvil( srxmir nu1op e ivsltfarrmu  ot0ole  feils s2rl( ont4 etnmr iydomtr n ols s2tmiopou1om emivtas sDrr(  ;t4tetoiiciyslm em(ms;t0tltrif3oy1faD luvi;(0sruo(mpoo4am e neilt aDumxmpno4apt iociydla2emu o;t)tlxomf3oydfat anvsls trxr(o oy1opt lfcslt) Dtm(ro;o1alen fciatfaDumnms;()alenxr3ia1fa ran s;s  eto(o ny1om nlnes () Dtr(r ou1oeto oeiltfsDua( s (0texnmr tydomDrlnvilt0texoirpnu4lme lfvil(fsDrm(rooo1tpxn o3tld m ua( ont) reriocto1lptrauvi t0 2tmio iy4lp elncias)aDuau onu4aeenmfctytfa raumo t4aetrifcto1fp elu s (0 2xm(r3ou1al n fctl(  2umuroot0teeoiiciydla2elump ()aeeomfcoodomDelies;s trtoxm3iu4apenlivtlt s2tru o;t4oex mieilsfaDea(vs;t0tlxrmo3to1fmD  n o;(  exm(mpnydlmtnmfvs sf 2um( ont1tlxn f3iytlaDem(mo;(0tlenircoatfa  au o t)trurxmpiu1lltn ieilt  rrm( p;u1apeniociltfs2ulnmo;t4artnircia1opte u olt)srxr(opiy1olen fctlsfa2uau ono1teeoiietlt m eau onu)trtrxr3ootop r nvs (0trtmxo iy4lpte fcsat aDtaumpno4oee  ociat mDrauvsnu0tlxoir3totfpt  uei s  rtriopio4op nmfcs s  rua( ooo1openif3iltlsDem(vo;(4arxnxr3ta1lpD  u o ( srxm(m oy1omtnmfeils)sDrrx onu1ape io3tyt s uan o u4 lenmfctadlptean i;()setoxo oudop nmnvt t srumx  nt1olenifeiatfsDum(vo;t0tlenif3oa1fm   nes ()trxrirpnydllenmnct s  2umu o;t1openmictyt sDemu sn()tetrxo3iytoaD  n o (  ruoxm3no1aptelnetls)sDtmurpnu4optn o3iysfa ranmp t) lxomf3tadfmte u olt0t2xr(mpoo1amt lnvias  rtmumo;t1aexo f3ild aDem( p;t)arerxrctydom eauvo;()trumxm nydom  mncil(fs2rrxmp;o1oexnifeilslm2el(vo;u4texnif oadlm rai o;(0setoir3ou4openmfci sf ruax p;t1apxomf3ild a ul(vsn(0aexomf oytomteaues s0trtmxo iu4om nmfei sf Dum( o;t1tlt io3tldla ua(mont4tetrif3oy1oatrln s t)s2toio3nu4amtnmfetlsf rtr(m ou0oleoioeilsla ua(vo;() rxnmocty1oaDr n s ()tetrxo nodol   fvt t) 2ta(r ot4oee  f3ilslaDuanmsnt4alxoxr3iy1fpteanesl()trxmio3oo4am n ncil( a2tmxmpno4aeto ociaslaDel(ms t0aeerirciy1oa raueol()teto(r nodal elncias aruau  ;o1apxomieiad m2ra(vs u4 exomr3oodfaDr nes t srxr(m3iydlmenlncsat)sDrrxronu1aexomietatls2ulu s;()altrircoa1fp  ln o (0t2xmio3ou4lm  mivsl() Drm(  no1tpx mieias s rlnvs;u4aexomfciodlmDran i;( s2uoxrpiodal n netls)aDtm( ono0tlxn fciysla ul(vp;t4trtoifcty1lptraivs (  eurxmpnu4aleemnviat)srur(mp;o1tex  fcildfsDuaump t4 eenxoctydfaDrlieils)seur(mpiy1lmt  iesat srra( poo0opeomfeiltfmDumnmsn() exnif iy1fa r uvs t)setrxmpoy1optnlfvs tfarrmx pnu4tleoiieiys a2emu o;u) etrir3oa1lpte ivo;( s2xmim no1lmenmnctat)srtr( oou1apxniicildfm2ulnvpn(4texrxfcia1fat au i;t0 eum(r nu1lm nmnci t aruax  ;u4opeoif3ildfs rlump t4trxnif todfateli slt t2umxopnydaleelivtas)s2tm(moot1aexn ieiysls2raumonu4arxnxf ia1oat  nvo;s0 etm(rpnodlmenmncsls)srum( pou0oeeniietls a2rm( s;t4trxomo iadfaD  n ils0trxoio3iydalenlnvt ( srtau  no1oet  feiat aDel(mo;()trerif3tydomte i i s0srxo(opnodlltnmfcils aDtr(ronu4opeoiocilsfs ea(vsnu)tetrmr oo1lpt  u i () etmiopnydlm n ics t) Draxmo;u4aleomoeild aDeluvp;u4texnxoctatfmtrai i;t seumir oo4lleelnvs tf rra(  no0apt mf3ildfs raump t4aexnio ty1fa  livo;t0trtrimpio1lmen netas) Dururont4opx  octlsls2umnvs u4 rtrxo3tadlpt livo t)t2uoio3iu4lle lict sf 2tr(m oo0oeenif3ild a rln o;(4aleoio3ty1om   ueo s0 rxr(m3io1op nmietlsfarta(moou0alx ifeiadfs2ul(vo;(4artrxo oatom rlnvs;s0teurim no1ale livslt)s2raxroou0oeenii3ilsls em( s;(0alxnmr3iadlate uvilt) etm(mpou1lp  lfvtlt)a2raur nt4altn oetys sDum( ont)tltnxf io1oaDe uvils)seuoxrpou4apee fvta( srrm(mpou4oexomf3tat s2ean o ()tleomo iodopt lu ils0sexmim3no1amtn ivt tfaDumx ont1opxnmfeiaslaDumnmo;t4texoio3iydoaDraueo;s sexoimpno1ale lncsatfs2tmxmpoo1aexnmoeiydlaDrm(mo;u)aetomf3tydfp eaiesl(0t2xr(rpnodal emnct t  2ta(root4tlxnmietld s2umuvs;u) reomo tadfaDeaies (0t2tm(mpio4am  lfvi (faruax pot1tlenmiciatla2eau on() etoir3iadop eaueils0s2trir nu1ll emnet s)s2uaxrp;u4oltn o3ilslm umn o ()trxrifcoa1fa   i i;t sexmxrpiydolenlictl(  2um(ront1tet  ocildls em( p u0trermr3oo1omtr nvs;()t2xmir nu1omtnmiet (f Drm( poo0olenmoetydfm2ul(mpn(4trxrif3oadop r ueo s)trumim oo4al elivs s)a2rax  ;t0apen ietldlsDua( snu)trenmr iy1faDraivils0 2uo(r oy4omtnmicslsf 2uaxrp;u1tpeniiciasfaDeau on(4trtomo3oy1fp r i s;(0s2umxopny1al nlfcsasf Duru o;o4aexomi3tatfm2elumo;u0trerif3io1lm rlneslt s2urir nydol n nvta(  rtmu o;u4tltomictlt sDrmnms ()alxrxf tydopDeauvi;s0 exrxr ou1ope  neilt s2tru  oo0tpto i3tydfs ulums;t0 ltrio3iodfmDrauvolt)seuoiopiudom nlfesl(farua(r nt4aexn o3iat s ulums;t)tetoxf3ootopt li s;s trurxm no4om   iet s sDtm(mont4oeeomi3ildls2rmnvon() ltrxo3ootoa eluei;s  etoxo oodapte ncsa(faDrmx p;o1apx ifeiys mDulums (0tlxnxo tadlpDe ieo;( t2umir3iu1lmt  ivsasfaDumxmo;t0aex  i3iatls2um(mp u4tleoio3ta1fat lneo t trtoio3oudalee netas arra(rpoo4ole iictld a eauvp;u0teeoxr3oa1omD aues (0trxmxm oudomte fvs (f Dta( o;t0tpeo f3tasla2ea(vsnt0 ltniocty1fa rauvo () 2xoirpno4omtelivt ()sruaxmpou4alt  ociydlm emuvs;u4 exoxr3totfptelueols)teto(m3io4amtnmncsl() rraumo;t4aet iociaslm2elnvpnt) etnmr iydla  livi ()seur(m iu4op  miet t)a2umxmont4tlx ii3ias m2rmnvs t) exrmrcty1fate ieolt0 2xmxr3nu4ome  fcs sfsDrr(ro;o0oet  f3iltfa2rauvs;t4 rxnmo iatla rauvo ( trxrio3no4al elncia(  Draum oo4aetn oeiasfs ranvp;(0tltoir3iydlm   u il() rur(o oydole mfvs s)aDrm(r ;t4opx ioetldls rm(vs (4aetrio3iydfmDeaieols s2trir3nodalt  iesat artmurp;t4altnmo3iyd aDrl(vs ()tlermocoydopteli s;t  exm(mpoo4optemncils  rrmu o;u1aex  f3ils sDemn ont4arerifciotoaDeluvil(0srxoim oydlp e ies ( arururo;o0opt iictld sDrm(vp;t0tlxrio iydlmt an s;(0srumxopnydomt  icsls)sDtr( o;u0aleoiiciaslm umu s;t)arenxfcoatoat lneils) eurim iy1ope lfctas srtmu onu1opx if3iatfs2um(vo u)alenmo3ta1lpt ai o;s)trtrxo3no1amtelfeia( a2truroot4aeeoif3tatfsDelnmp t0tlerxfcoodomD anei;s teurim3nodal e fctasf Dra(m ou0tpt ifciydla uln pnu) exnifcta1fa eau o;s teumxmpnudap nlfei t aDur(  ot0teeomoetatla2uln p u0trtnxrctotomD aieils  rumim oudal e iviat) rumxr nt0apxoiocild s2uan sn(0areomo io1fmDr neo;s)srurim nydap e fcs sfsDtrxr ;u0texoiociysfm2rln snt)arxoxr tatla eli s;s0s2trim3iudale  nct ()a2urxr oo1oexo ieiydla2elnvp (4areomo to1lm   i s t)s2uoiopny1lpe lnet sfsrrmxmpnt1olen fciadlsDelu o;() ltoxr3tatlaDe ies;s srxo(m ou4aptnlneia(fs2trxmpou4tptnifeiyslm ulump;(4 rtnif3oy1opt ln ilt sruo(r oydam e fct ( aDrru poo4alt  o3iadfaDem(mp t)alerxf3to1fpD au o ()s2umio ou4al elfcia(fs2rrump;t1tltnmf3iasfs uln o;u0aeenmfctydop elieo;t s2trxr no1lp e ictl(  Dum(roou1ope ifeiytlaDrlnmo u)alxrmrcio1lp r uvi s) rtoir3oy1lm   fctlt a2ua(rpoo1ale mi3tydfaDulu snu0 exoif tytop   n o (  rurxr3no1lltn netl(  rururpoo0altoioeiyslmDua(vs t0aexnxr io1lpD lnes;s)t2ur(opno4lmte fvs (  Drmxmpot4oexo fetytlm ranvo t) rerir3iytfmDraies t0setrio3ou1lm n ncs () 2rmxr ;u1alt  f3tyt mDumnmp;t0tlxrxfcoy1fmDe ueilt  ruoxo oydop   fvi () Dur(mpno0tlxo iciytls ulnvo (4teerir oatlpte iesl( s2uo(rpnudol  lics (f 2urxr ;u0altnmf3ilsfs emuvont0arxomr3oadfat  nvils s2xoxopio1alee neiltf 2tax  ot1alxnifeiys aDul(vs u4aexrxr3tytlmt li ols) 2urxo3nu4alen ieslsfaruaxrp;u0apeniieiadfs2uau o;t4 lenio iydfm e u slt teumxrpiu1ll   ics ( arraxro;u0olx ii3tydla em(mon() leoircoo1faD ln i;s)srum(o3nudlpen nciasfsrtaum nt0aeeo ociydla2ea( o;(0 etrxf oadfm r uvils  etmxr3nu4omen ictlsf 2rmxr ;o1apxn o3ilsfs2uanvs;() ltrxr ia1fmtraivi;t)srurimpno1olt  ictl()aDrr(rp;t0texnifcild m2umnvsnt)tlxnif3tydom  auvsls)srxm(opnu1lmte fcs (  rtm( pno1tle  ietltlaDrl( pn()teeoiociotlpD aivo;t0srxo(o3iy1aptnlicsl() 2rm(mont0aetnmietydfa rln snu4trtomr3oodfpD ln il( sexrir iy4lle mnvsat)artmur ;o4tlt  icilsfm2rm(vp ()alenio iy1oaDr uvsls0srtrio ou1op   fvs s)srrrumoou1teeo iciatfa2ulnvs u4trerifcoy1fat aivs t0sruoxr iudame mivi (fartm(m ;t4opeo f3iys m uan s;u0 reoxf3ootfat  n i ()truoxmpiy4ome  nvilsf 2rr(ro;t1tlt mi3iadfs2rluvo u4treoifcty1lp r i o;(  etmxm ny1lm e ncsat  rtru  nu1tee  f3ildla elnvsn(0trenmfciatlmDeli o ()teum(r iy1ale  nei tfs2rm(moot4aex mieildfm ranmsnt)trtoif3io1latraieols0tetoio3iu1ale mnvtls a2taum ot4ape  feiydlm rluvo u0aetomf3oodfpDr ivo;t seuoxr3oy1opeemicsa( sDra(  ;o4oltn i3iat m2emnvo u4 rerxr iatopDelu i s tetmxo nydome lnesa( srur( ooo4oetn oeiyd s umnms u)trerxociy1fat lieo;t t2tmim no4lpe mneilsfsDumxr ;t1olxn ictldfsDul(vont) rxrif oa1laD  nvi s  2uoxo iu1apt mnvil( a2raurpnt4olxoii3tltlmDumu p;t)aetnxf3to1late nvs;s0teumir no4ome mict s aruru oou0tltomieiatfa emn o (4aeermr iadfmDran s (0t2xm(o iy4ol n ietls)a2rru ooo1alt  fetlsfsDraumo;(4alxrio3tytoaDraneo s0t2ur(mpoodol elnct t  2ur(mpot4tlt mfciydlaDemn p u0 etoir oatfateluvo;(0trurxo oo1omen fetasfarrrump;o0apxnmo3iat s2ra( snu4treomo tytoat  ues s0 2umio io1ol emieslt  rum(mono1apt  ieiydla2eanvpnu0altrxocoytfmtelivils  eurxr nu4aptnmivta(f 2uaum ot0tptn o3tytls2ulu p t4arenmo iytomte u o s0srto(o3oodal  miesls) 2uauront0tptnifciytlm emn pnu0 lxrmf3ta1fa  lnvils srxoim iy1ll  lnetl()aDta(mpnt4apxomoetatls ua(vs t0artrxf3todfptrauvi ()t2umxo nydal nmicil()a2raur ot0apeo ietlsla2emuvo;t4alxoxf tydlmD an i;s  eto(m io1op  mfcilt aDtr(mo;o1alen oetltfs eau pnt4trenio tadoaDranvs t0sruoxrpiodlpt miei s  Dtmur nt1apeoiociysls uln snt) etrmfciadlm rli s s srxm(m3iydomtnlics sf Drmx  oo4olto octydls rlnmo t4 etnxf3to1fa  auvi t) rtoxm oy4ope mivt (  2trxmpnu4oex mictlsla eaums;u4trxnxo3oytfm r ies;s srumxm3nu4ol n fesl()a2tm(r nt4tlt ii3taslmDel(mp;u) eeoxrcta1lp elnvs;(0texoiopiu1llt  ivt (faDrau onu1opeoifeiatfm ua( s;u4teeomfcio1fpDe ivslt)truoir3oo4ale mivsl( s2umx o;u0tpto icilsfaDrlnmp;t) rxomo iy1op eanvs;s setoir3ny4omtn fcs t srur(rpnu4oltoif3iatfmDul( pnu0 rxoif3todfa rlivilt  2trio3iudal emfvt (  2ra( oot0oee ifeiytfm2eauvp (0tlxnxr3iy1omDr uvolt)srxmxmpny1ope lnvtat)s2rmurono0olenmo3ildfaDemnmpn(4 rtrmf to1faD au sl(0s2xr(r no4oltelneilt srtrx  oo0tlxn f3ils m rmu o (0teerircoy1oaDrlnvs ()srumxm3iudllt lfci (fsDua(mp;t1alxnif3ild a ul(mo;u0tleoifcootfp   nvsls0trurir3nu4lptnmfvtlt arumumpot1aptoio3ils s ul(vo t0 rerif3oy1oaDraneol(0 exo(rpou4omeemici (fs2raxmpnt4alt mictysfm2ul( s;u0 exnmo oadlp ean slt)t2trxopiudaptnmnct s a2rmurpno4alto fciyt aDeanvs;u)tlxrmoctatfmD  neilt0 2uoim nodlm nmnvtasfaDta(rpoo0opt mfeiytfs rlu p;u4tlerxf oa1lptrluei;t sexr(o3iy1lme livtls srur(r ;o0tptn fctldfsDemumo;(4trtomrctatla rai ils  2xmir3no1aptn nciltfa2urumpoo0olx  ieiasfa2ua(vs t4areoir ty1lmDr u s s0trxm(o nudap e nctat)aDtmx  ot0oltnmfeiatfmDuauvp;u4alxnmf tytlmte u s s s2toxr3iu4lmtn nvt ()srtaxmp;o1open ietaslm2rlu pnu0arxrxo io1fpt lieo;t0trtoio3nu4lpt  nvi (fsDrmum nt1aexoifetytfm2rauvs;u)aetoifciadoptraivols  2xrio iu4ap elnet t)artrur ;t4olt  iciaslm um(ms;t4alxnxf oo1op eaues;(0s2umxr3nodol e ieilt)aDtmum ;u1oetomfeiytfa2ea( s;t4 rxrxfcootfatrauvol(0s2xrir3iu4opeemfvils  2raxmoou1teenmiciatla eluvs (4 rxrif3todlmD ai ols srtmxmpoudlm  lncilt s2umxr oo1tlen ictyt a2rlumo;() etnxociytoa  lneslt0s2umir iy4om  mneils sDum( pnt1apeomfctld a uaumpnu4trtoifctytfpDrauvs;s0 2uoimpnudamen icsas  rtm(mont1texn i3iyd a rluvpn(0 ltoio3ootfmDr neolt0trxmimpnydopt miet tfartmxmo;u4apeomfciyt s2elu s;u)artnxo3ia1lpDeauvslt)trtoirpnu1amtnlfetltf rtax  no1aetnmieiasfsDeau on(0 renxo todopDelueil(  etrxm iu4aptnlieiat)a2tmuronu1tltomieilsfs rauvpnu0 eenmfciydfa eai i s0trxrim ou4op emnes s)sDrmxr nu0aee mf3ils mDumnvo u0 etnmr iy1oa e neo;(0 rxr(r3ou4op  lietas) 2tax pou0alx mociytfm emnmp u)tlermociy1lmt livs;s sexo(o nu1lmt lnct t sDrrurp;t0tle  iciltfmDumuvo u)altoir3oydfa eaies;()s2xoxmpiodalt lieslsf Dtrxrpot4oeeo f3iadfmDulumo (0areoxf totfpt lnvs;s0texo(r3nu1ll emfei t) 2rru p;o0olxo ictytlmDraumon() rtrxr tytlpD li o;t setr(o iodamee iesatf Durump;t4optnmo3ild sDuau o;t0aexomrciydla e ueols) 2xm(mpoydam  livt s artmxm ou0ope ioctldla eau s;t0alenmo ta1oaD lnes;( srtmxr3io4om  lict tf 2ua(mo;t0tlxoii3tytlaDumnmo;u)arxoxfcoo1laDelieilt0 rxrimpoy1lptn ivtls) ruaxr oo0apxoioetldfaDeaumo u4aleoio3io1opDraieils0t2umim3iu1ap  lfct t)s2urxr ot1tpt  fetydfa2rm( o;()texoxocoodlmtrlneo (0trtm(r3no4opt  ncsls  2uau onu4ale ii3iadls ranmpnu4aeerxf ta1opDeluvs;t) 2xr(m3ou4lm n iviat) Drm(roou0opxomi3iasla em(mpnu)teermo tadom rlneo t0 rxrxr ou4om n nvtl( srra(  ot1tlenifeiasfm2ranmon()tlxnir3totopt anes s  rxm(rpno1omt mfvias s2uaurooo0apxomieiytla2ra( s;u4trerir3todfp   ivs ( t2xm(o3iodopt mnei s s2urx pou0aexn feiyt a2rlnmo;(0 renmr ootlmDr n i;t  etoirpoodaptnmictl(f 2rrumont1teenmfciatfaDelu o;() eenxo oodop elu o (0s2xrimpno4ol  lfeiatfsrumx pnu4olenmoetld aDrlnvo;()trxrxo3oydfpD aieolt0setm(m3no4oleelncil( aruaur ot0tlt  ietldfs rlu pn()tleoioctatlp r iei;t0t2toim oudlm nlfvt ()s2uau  oo0tle iocildla2eluvp;t0trermo3ia1fatr ueilt)t2xmxmpiudop  lnvs s  Duaxr ;o1teeo octltla ea(monu4tlxoir oy1fptrlnes s  etoxo iydop n ieias) 2uau ont1aeenmietldfmDrluvonu0tlxnxr3ty1laDe uvol(0srtmxo oy4ole mfet tfaDtr(mpoo0oee ifcilsfs2emnmp;t4 reomf tatfm   nvo t) rxmim nudop nlfvsl() 2ua(r no1altoioeilslsDum(vo;(4aetnxf3iadomt anei;t  2tm(rpnodamt livs t arrm(m oo4oet iietydls2rmumo;u)texnio3to1fpt  nvi;s0 rxr(o3iy4alt  fetasf ruaxr ot4aex  ictyt a2rmn snt0 lxomfcia1faDr uvsls0s2ur(r oodaltnliei (f 2umum nt1olxnifeiys a umump ()alxoxo3iatopD livs;t seumim oy1ol n fcias) rtrxro;t0ale  f3iydls2rl(mp;(4alxrxf3to1oaDrlivo;s  exoir3iy1lptnliet t) 2um(rp;t1aeeomf3iadfa2el(ms;t)trermr oodlp  lues;()srtoim3ou4om  micslsfsDtaumo;t4texnioeiyd sDua(vont) lermo3oydlaDelnvsl() eto(r oo1lp nlivtas  Drm(mono1oetomi3iad s2elnvsnt4 exnxociydlatrln ol(0s2umim iudolte fctasfarua(mpou4altnmiciytfs eauvp u4 rxomo3todoate u o s trxrxrpoudlltnmnetls)srrru  oo1tpeoifctadfaDumu p;u4artoxo todopD aieo;t texr(mpiy1am  mivtltfaDtmum ;o0aet mociysla2ea(msn(4arerir todlpt  ivi ( sexoxopiydaptemnvia()arra( o;t1opt mocilt m rmnvp;(4 rtnmrcto1om e nes;t truo(mpnodlptelnciat arta(r oo0aetnmictadlm2ean p;t) etrmocootlm e i s t0 ruriopnodomtemncsls) 2taxr ;u1alenmf3tatlsDrlu ont4 ltoir3tadfaDr ieil(0 2xrxr3ny4lme lfvt s  2trumpoo0oltn feias mDemnvp;t0alenxf io1fmDelnes s texrxo3io1lltelneilt)aDta( p;o1tlt if3ild m2ulumpnu)tleoio iytomDe iei;(0 rxoxr3nu4alenlnetat s2taumooo0oeenmfcildla el(von(4 lerxo todomDe ivs t  exo(opny1amenmfcsl(fartmx p;u0oeeomoeiysla2ulnmont)trtnmfciodlp r neols seuoxo3no1amt mfvt sf ruaxmp;o0oee  fciltfm uan o;u) rtrxfcoa1la   ieilt0 etm(rpoy1ope mies tfsDrru  nt1tlxnifcils m2rmuvsnt0aleomociy1omDran sls) exmio3iu1oltelfetl(fsDtr( o;o1alt  o3iltfm rmnmsnu) ltoxf iodfmtrli s s) 2tr(m nudal   ncils arrr(rp;o4aee  fciat aDumumsn(0tleoxf3iytoa elu s s)teum(m nudom  mnvs s)srtmump;u0alxn f3iytlm2el( snt4tlenmf iydlate u ols0s2trxopoydop nmfviat  Drmxrpou4apt iietyt s2eln s;(0alxoxo iy1fmDean o;t0 etrxm no4amen ivta(fs2raxm ou0oeeo ictysfs rm( o ()aexoxr oo1om r uvi s srumir ou1lmtelieslt sDuax  ou4opxomi3iasfm2em( pnt4arxoxo3ty1lpte iei;t0teurim3nu1ome  ies t)a2ur( ono4tltnmf3iltfmDeanms u) exoif tytomteai i;t0s2xoxo3no4apt lfeslt)a2uru  ou1oexomieiydfaDuau p (4 ltnio3ootla  auvo;t0 2toio3iu4lpenlnvt t sDtrxr ou0tltoii3iydfa em(monu)tlxoxrctatlmte uvs;s  2xmxmpou1alen fcs t)s2umurpoo0alxoii3iad s rmnmp (0aleoif3oytlmDr u o;( s2xm(m oo1aptnmnvsl(fa2raurpnu4oetoifeiyslm ean s;t0trtnif3oytlmDr nes t0s2xoxr oydll emfcs (fsrrau pot0opto f3iadfa rlnmon(4 leomoctytopt auvsls) exoir3oo4ol e fcia(faDtauroot4optnmoeilsfa ulnmo;t4 reoxr3ia1optr uvilt  exoirpoo1lleelfcs tf 2rrum nt0texn ociyslm2uan o;u) eeoif3ia1lmte u slt tetmirpnodale mfctas)sDururonu1aleomf3iltla2emuvp u0 reoircoytoaDr ueo t)s2urio3iy4ap nmiciasfaDraur nu4ope mf3iasfsDemn p;t0 lxoxr oa1lmte uei;() 2tr(opny4ame mivsas  rra(mo;o0opt mo3iys s2um(vs;t) leoxf3ia1fpD  ieo t0sexoxo no4om emnes ( aDtm( pnu4opxn feilsfsDem( p;u)texnifcoo1oa eauvolt0sruo(mpiu4opt lnvt t) 2rmxrpou1oetn fcils m2eln o u0teenxf iy1lat luesl() exrxopio1om   nei ( sDrrumo;u4olxnio3iaslm el(mp (4tlxrmr oodopteanei ( trxo(r ou1lp nmiviat)sDua(rp;u1ape iieiadla rln snt) lerio3oatfmDr ueo s0srtmimpoydame  ivi sfarumxmoou0opx  o3tldlaDean onu4trenir3iytfmDrlu sls)s2umiopiodop e nesls) rtmur ;t1ale mi3tydla uau s;u0 rxnmocto1op r nvo s0s2urimpiodam  lnvil()s2uaxmo;u4texoifcias a2rmuvp;t)aeenxr3oydfm ranei t0trxoir iy1op  mnvsatf Dra(r ;t0tpxnifetldlm2raump (0tlenxr3oadomtrlnvs s) 2tr(opio4amt lnctatfsrtaxmp;o1opxo ieiasls ulu o t0texrif3totomD aues ( t2tm(o iy1apt  fcia(f Drm(rpno0oee  fciyd s el(mo;t0 ltoifctodfp e i o ()t2xmxr3ou1lpt mnesa()srtmxmpou1openmf3iatlsDrm(vpnt0aeeoif3tytfp e ivo t0trurxopoydlle lfes s)s2uaur ot4tlto f3iysfa2em(vs (4texoxociy1lpD li ol(0seur(r oudll   nviat s2um(rpoo0tpxnmocildlsDua(vp;t0alenxrcoadlp   uvs s0s2urim io1ol  livtas sDururo;t1oetomoetatlsDulumo t) rxrircootomD ln ol(0trto(m3iu4lp nmnet (fsDraxmpot4tltnmociydls emnmpn()teenmfcoydoaDrau o s) 2umim nu4lleemfctl( a2uru  nt0tpxomfetls s2rmnvs u0aexoxrcta1oa elu s () etmxm3oo1ap n fcs ( s2umumooo1apx ioeils m2ul(vsnt0 lxrir ia1lm rau ol()t2to(o3oy1amtn ictatfsrra(mo;o0olxomfeiltlm2rm(vsn(0 lxoxr ootlm   u i s) eurxr oo1amtemnetl() 2ua( pnu4oltnii3iydfm2ran pnt0 eenxrctotlaDeai o;t) 2urxo oy4om elfvt t  rrruroot1oeenmictas a2eau sn()aexnxf iy1fp rauvils srxm(o oo1amee ivtls)sDrmx  ot4opxoii3tydfm emn snt) eenmf tadlaDeauvi;s teur(r3oudomen nvilsfsrum(ronu1olx  o3ildlm2ranvo u)teenxo iy1fpDelivsls0 2trxopno4ope livtas a2rm(rpnt0tpx  fctys a umnmp t0altrif oatfmD  u i;t) 2triopoy4amtelicsltfa2ur( oot1tptomi3ilsfsDran o (4 etrmr3iadlp r uvs s s2tmxo3iy1lptnlfcsl()arumxrpnt1tpx iictldfaDumnms;(4 eeoir3oodlaD aivi;t0s2tr(m3io1ame lncsasfs2raumpnu0alen feildfmDel(vonu)tetoifcoydoaDe nes;( t2ur(rpiu1optemiet (f Dtmu  oo0altoiictyd a2eln p t4aeeomr3oo1oaDrlnvsl() 2uoir3ny1lmtn fcs (fsrtrxr oo1aex mieiatfm elnvs t0aetoxo3oy1om eln o s) 2xmir iydlp n nvta()aDtmum ;o4alx if3tyslm2ranmsnu)alxnir3oydoaDeanvi s) eumxmpoy4apeemfci tf rrrxr ot4tlxnii3iatfm um( p t4texnmocio1lp  lieil(0sexmir oydaptn ncta(f Dtax o;u4tpt mieilt m ua( sn(4 rxoxo oodlatr nei;(0trurxrpiydolt lnvia(fsrrmum oo0apxomi3tlt sDulu s u)arxnmf3oy1lp elues;t0s2umxm3iy4lle lici tfartrumpoo0tltn i3iydfaDrmn s t0 renir oytlpDelnvil(0t2xo(r3nodopt  nvi s  Duaxr ;o4aee ifciysfsDrm(vp;u0alxrxo3ty1fmDrluvs;t)s2toio3oodapenlnet t s2um(monu0teeo fctls s um(mp t)aeeomf3iotoa r nes;s)tetr(r ny4optemnet s)a2rm( p;o4tpxomfctldfa2umnmo t)trxriociodfpt lieolt)texo(o3nu4ol  mfcslt sDrmxmpoo0oexniictadlm2em(vo;u4 rermo iadlaD  nes (0 eurio nodlpeelfvt t  Duaxm no1aptn f3ilsfa2uaumsnt) lxnxrcoa1opteanei;s) 2uo(o3iu4amtnmfct t) 2trx pnt1alx ifctas aDeanvp;u0aetrmo3io1lm rluvols t2xmxo ou1amtnmfeil()sDraxmpno4aex iociytfaDul( o;t4texomfcia1optelnes;(  rxrxmpoy1ap nlnct sfarraxmoou4oeen o3iaslaDraumon() lermf3ta1lptr i i;(0 exr(r3ny4ap nlnct (fs2rrumonu0opeo o3iyt s ulnmp u4 etnio3iytoa  livs;s0 etoiopno4open fei t) rumump;o0tpxnmocilsla2uanvs ()trxrxf oo1fm rluvils tetm(m3oy4op nlfvt tfsrumurpou0alxn i3iyt a emnmp;t) exrio totlpDeai ilt0texrirpnu4ll n iei (  rra( pou1oet  fetas aDuaumpnt4alenmr iotoaD  n slt) rtrim3iodlmtelfcs s s2umurono0alt mf3tldfaDeau o u)arerif3oadoaDeaues;(0t2xm(opiy1amtemiet t)a2ua(  ot4apxomictad mDrl(mo;t4texnxrcoy1lmDraivs;s0trtoiopno1amt livt sf 2tmum ou1olx  ieils s um(ms;u4arxnirciydlatr nvsl()t2ur(m ny4opt lfvsl( arrm(mpno1apeniictasfs2ran o;t) eeoxfcoodlp rai i;t s2tmio iy1ope  fes t srtrx  ot4tpxnmfeild mDumuvp;(0aeeoif3tydla raneo;()tetmir3oy4lpe liet (f 2ur(mo;t1tltnioeiytfmDeluvp;t0arerioctatfmt lneo s0t2umirpoo4lp e iesa() ruaxmpno0tlx iictltla2uauvpnt) lxrifcoa1fat aneo;s s2xoiopoodll  mnesltfsrurx pno4apen oeildfs2el(ms u4 exrio iytlmD livo;t0 ruoimpny4al emfcsasfarumump;o4apen ociyt mDem( p;u0aeeoir tatom raieo;t) rxr(r3ny1ll n fvta(fartax ono4tlen i3iad s rmnvs;t0alxnmr3tadlm elivs t0tetmiopoo4ol e fes s) 2raur nt4aee  feiatls2ulumont)trtnxfciadoa elieo;()trtriopiodoltemfctltf 2ta( p;t0opxoiociat m uauvp (0teerxf oodomD  ivi;(0s2um(r3ny4ale  ietlt)srtr(root4teenif3tatla ua( o (4alxoxrciadomteln ils0t2toxr oo1olt  ici (f Durx p;o1tltnmfetysfa2eluvsnt0aleoio3iytlpt aues;s)texrxo oy4apte netat) Drrxr oo1alxoii3iltfsDrlums;u0tetnxf totlp   ivo ( s2xoxr3iudamt mfcs s) Dtmxr no4apx ifctlsfm2eanmont4arenmo3iotfptrlivi;( setmxo io4lle livtas) rraxr nt4optnioeiytfs uaump;t0treoif3oy1faDr uvs;()srtmxr iu4al  lfcsl(  Drmumpou4teto oeilsla ranvsnt4 lxoir to1fp eai o s)srtr(rpoudomen nvslt aDrm( pnt0alenifciatlm2umu ont4trenio3iodlm eliesl(  eto(opnu4apt  fvil( a2rr( oou4opt ifeilsfm uau o;t)trxomr3iodfatrlu sl(  rumxm3oy1llte icsa()sDrr(rp;t0tlx  i3iyd m rlnmp;() lenxf3ty1fp rlnvi s0s2umiopnu1al  mfvs (f Dra(m ot0tpt  f3iadfs ean s;u)trerir3oytomtranvs (  2xm(mpny4ap nlnetltfsrraxr ou0tpeo fciyt s2ul( p ()tltrxrcoadfaD lu o () rxoiopoydome mnvsatfsrta(mo;o4ape mo3iysfm uau p;u0 rermocoa1lmD an ols) exmimpiydalte iesa(  2trxm no0aptnmietytfa2ea(vsnt4aexniociotlat  ivsls)trtr(o3ou4ap   nei (  rrmxr nu1tpxn fetydfm um(mo;u4 etnxr3ootomDelneo;s t2um(o iu1olt mncs tfsDra( pnt1olen f3ilt a emnvp (0trxomo iydoaD aneslt) exrxmpoodalt  ictas)aDraxrpou4tpe moeiysla ranmsn() exoxo iadlp eaivs t0s2tmxopnydamtemicsl(f Duaxro;o0oeeomfctytfs2rau ont4 lermf3oy1lateau ils)s2toimpoo1apt  neia( a2tm(m oo4olx io3iaslm uanvpn()areomrcoy1oa e ivolt0sexoxo3oo4ame mfesatfs2rr(moou0optn oeiydlm2eln p t4 ltrirciodoptr i ols srtr(r oodlpee fvs sf rra(  ou4apx ioeiat s2ul(mpnt4aexrxocoodlptr ieo (0trurxo iodlm emfesa(faDuax  nu0ole  oeiasfa ul(vsnt)tetnmf3iodfmte nes ()texrxr iu4ap nmics t)aDtmumo;t1apto fctlsfmDea(vs;u0altomf oo1fp eluvil()truo(o3no1oleelfvt sfaDta(rpoo0tpeomieilsfm umuvs u4arxnio ia1lmDrln i;()setmiopio1omt lfvslt) Dtmxmooo4aptn i3tatlm2rl(vp;t)tlxrif oytlaDrlu o;s) eto(mpno1lme mivsl()sruaxm ;u1aleo oeiasfm2raumo t) etnmf3iydomDeln ols0 etm(opiu1al   fct s sDrmur ot4aexn o3tlt s2el( p u0altnmoctadlpte neilt s2to(opnu4am  mneil( sDurxm nt1open ociadfs2raumo;t4aeeoiociadfat lnes ()trurir3iodam emicsl(fs2taxmont1tle mictltls2ranvon(4alxrxo ta1oaDeanvs s0t2xm(m3io4lme lnvi (faDrmur ot1tee  o3ild s eanmo t0tlermfciodoaD  uvsls0 2xmxmpou1openmfcsa(  ruaurpno0olxn iciat s uluvsnu) lxoio oydfmDr uvs;(0 rumxo io4aptemfvt s  2ur(  nu0oetnifeiyt a2uau pnu0 eerxf tytlmDrlnvols)texmxr3ou1am emfeta( srurxro;o1tleoiicilsfa2ul(vo;t) lxrifcoa1lmDelueo ( texmxmpiu4ll elieil(fsDua(m nu4oltomoetltls2em(mp;()alxrif todlpte n s;t setrir no1altemfesltfsDtmx o;u1aetoifetys aDra(von()arxoxocio1omteluvil(0seurim3ny4omt mnesas  Drrurono0oex mieiasfaDulnmsnt)trxrxo iytlpDe i o t  rumxm3nu4op emfcils)sDuru  nt4tpeo ociytfa ea(vsnt)arxrir to1omt lneolt)t2um(r iu4ol n ivslt sDtru  ot1tpxo oeiadfa2uauvo t4tlxnif3ta1fp rln s;() 2xrxmpnudlltnmnctls  2rm(  ;u0tpxo o3iydfaDrmnvs;()tlenxo3iodopteaiei;( seur(opiy4omtnlncilsf Dtrx ono1apeo iciatlaDuanvont)aetnmrctodlate ieols)t2to(m3oy4ale lfeiat  2urum ;u1oltnii3iydfmDuauvs t4 rermr3tadom eanes;t  2uoim3ou1lpe lietas) 2rmxrp;u1opt mietat a2el(ms t4arenif3to1lpt  i o;t0 2xmxrpiudapt  icsa() Drrumpnt0tpt  o3tydfsDrlu p;(0tetoif3ta1laDean s;s t2tm(o3io1am nmfei t arur(ro;t0opxnmociad sDelu pnt4aeenmf3todlat aieslt)trxr(m iodopenlfciasfa2rrxmo;o1tlx moctldls2raumonu)tetnir io1lpteanvo s) eurxmpiudape  fcta( sruaxrp;o0altn ictad a2em(mo;(0texoiociytfat li ols)trurxo3nudllenlnct ( a2rru  ;o4oee iicils m2rmuvp u0 lermocto1oat  ivol( s2uo(m3io4oleemfeiatfaruaxmo;t1oeeoifciat aDuan snt4aexnxfcoadlate ivs;s)texoimpoodam nmnvslsfs2umumpot1alxomo3iyt s uan s t4 ltoif3tatoatr ieo;s0sexrim3oy4amtelfcslt)a2rruroot1aetnmi3iyt a2um( o u0aetoxf3tadoateli o;t)trum(rpoy1llt  nct tfsrrru pou0olxomociytla2em(vsn()aetoxrcoy1oa  lu s;()setmxmpoodlmeelies s) Durxrp;o0oeeo oeiyd m2el(vonu4trxrmf3iytlaDe ieil(0s2urim3no4lptelfcils)a2rmu ooo0ale iieiydfs eanmsn(4 rtoif3oy1fmDe uvo;s0 euoxr io1opt  nesl()aDuauroot4alto oeiatla2uaums;t0tlxomo3iadoateanes s teum(o3iydap  mnci () Duax  nt4ope  fciad a2eanmo;u0teermo oadlpDelneo;(  rtrio3nodoleelfesas sruaxrpot4aexnio3iydfa2elump;u0aetomf3ia1lm ranvs s  exoim3io4amt lncia( srrm(r ;o1teenmietytfs2rmnvo;u4trtnmf iodlpt  i s s) eur(o ny1apee nesltfa2ua(mo;o1apt  fciltfm ul( pnt0aetoxfcoytlat lues;(0seuoim io1omtn iesas arrru  oo1olto i3tls a elump (4 rtnmo tydlmDeauvo ( s2uoir3io4ap elneta(fsDua( o;t1olxn o3tad s uluvpnt4altrxrciy1lm raieo;()sruo(m nu1alen nvtl(fsDuax  ou0ope  fctys a2rau s;() ltnircio1oaDr n ils) exm(r3iy1ol emnci ( arurxmpou0aee mfetytla emnmp;u)aeenxf ia1laDr i sls0tetoiopoo4optn fes t aDrm(  nt0tet iicildls2rau pnu0tlenifcoa1lmt an il(0trtoxm3io1lme lfviat) rtau pnt4tpxnmi3ildfa uanvp;(4trtnifciatfa raieslt tetoxopny4amtelfvtat) rrau  no1oltn iciysfaDrau ont0 lenmr oadopDeln s t  2ur(mpiodam e fciat  Dumu o;o1oex  octldfs2um(mpn() lxrxr3oytlpte ieils) 2xoir oy1ol nlfesa(  2tauroou4ole mietltla2emnmpn(4aexomfctydlpDe iei s)srtrio3nodlpe lfcsa()a2ra(mpou1alen f3iat s2rm( pnt)alenir oo1fpDe ies;t) exm(o3iu1omt  nvt t aDua( pnu0oetn iciadfsDra( p u0 rtnmfcoytlmtran sl()s2xmxm iy4open netatfartmurp;t4altnmf3tltfm raumo u)trxnir3oy1lm  ln s;( sexm(r nu4omtnlfeslsf rtrxrpnu1aet ii3ilslsDrm( p (0arxoxo iatfmt  ieo t)trtmxo oo1lp e nvi (f Duaxm oo0oee ioeiadfs2rmnmonu)tlxrmfcoo1fpD  nes;(  eumir3ny1ap emncta()sDua(rp;t1aetn fctld mDrauvs u) lerif ta1lpteanvi;s trtr(m oo4optemnetas)a2tmx  ;u0tpe mieiad sDelump;(4tetrmf3ta1fat  ivilt0srxr(o3no1lpenlnvslt srua(  ou4opt mi3iatlsDeanvsnt4trtoxf io1la e ueo;s) rxrio3no1ope  ies ( s2rmurpot1oltomf3tasfaDrm(msn(0alxoircta1fpDrauvo;s)t2xmxopiudopenmiet sf 2rrur nt1ope  o3iydfs2ul(mpn()alxnxo oadomDr ivolt)srtrim3oy1am nliciat arrmx  nt0altnmoeiadlmDuln s () rtnmo3iy1omteluvslt)srtrxm3ny4lpe  nei s  2trx  ou0openifciadfaDel(vo u) leoxf3oy1latr i il( t2xoim iydolenlnei ()a2ta( poo0aptnmfctlsla2ulnvo;t)treoifciatoatelues t)trxr(opoo4oltnmfvi t) rraumooo0tpenifeiysfm2rmumo t4 renir3iodomD lu ol(  euo(rpnydapen fesa(f ruaumo;u4opxnii3tldfaDrmumo u)altrxf3iytlmDrlueo;t srxrxr iodolen nes ( arurxrpou1ape ifeiat sDuln s t0teenxo iatfaDelu s s0s2tm(r iudalt  fcia( aDrax p;u0altn oeildfmDel(vpnu) lxomo ootlmtrauei ()s2ur(r3iu4ap elnesas)s2umx  ou1optomfeildls uaumsn()tleoifcootoatran s s)trtoim ou1ame liei s aruaur ;u0tetnii3iltfs rluvs (4 etoxfciy1fm   i o;s t2xm(m iu4lmtnmici s srrm(rpoo4oexoioeildlsDeauvs;()tltrio3iodlmD liesls  2to(o oudam emicils)aDuaurono0tet mieils aDean s t0 etrxoctotfaD  ueil()setmim3oodll emncta(faDumumoot1tlxomieiydlaDuanmo u4tlerif3oadla  ai il( t2urir oodopt lneias sDrrumoot0teeoifeiydfm ran p;u)tlxnmo oo1lpDr neo s teuo(rpou4optemnvilt srurumono1aexnii3tlsfaDranvo u)aexoircoytoptr n i;s)srurxmpoudlptnlieslt)aDuaum oo1ale  octytls2rl(vp u0aexnir3iadla  luvs t)seurxm3iodlmee ies () 2rr(rp;o4ape ifeilsls rmnvp t)trermr oodoa rluvi;s0teur(mpio4alt lnvs (faDur(  oo0oee moeiat a2raums (0 eenio3iydoaDe i i;t) exmir oo1olenlnci sfaDtmu pot1alxn i3iysfa ulnvs;(4treoxo iytfaDelnvo s0sruo(mpnydaptelfct sfa2tm(ront0opxn iciltlaDeaump;u4aeenxfciydlm ran s t)trto(m ou4oleelfvslsf Dtrx  ou0tptoio3tyt sDemums;t)artnxo3iytlatran s t0trxrxr nu1lptnmnci (farua(  nt1oexnifetlslaDul(mon()trxomo3oadlatelueol() 2tmir3io4ol elnct t)a2rmum ;o0tltoifciadlsDelnvs;u)aexrir oodoaDelivs;t)tetoirpoo1am nlies s s2tm( p;o1aexn feiydla rauvs;(0trtoif to1lmte n i;s)srumio3no4lm nlfetls)aDuau  ;t1apt if3iyd m emuvs;t4tetnxfcoa1opteanvi;s) rxm(r iu1ame miesls  Dta(ront0oeenmf3iytfs2elnmont)teerir oy1opDe u ol(0seurim ou1olen fvias) rurumo;u4oltoif3tyd a rlnmsnt0 rtrmf oy1lm   ivols)tetrimpnydlptelfctls aDtmu pno4tltnmoctat aDem( p (0 rxrxocoodoaD lnvsls  2xoim nu1alenlfcs sfaDra(r nu0tlt miciydfa2ra( sn() ltrmo iydfpte nvo;s0 2tr(o3nydll emnet tfsDtaxmpnt1aexniiciltla eauvp;u4tlxoxfcoydom r nvils0 2trirpoo1optnmfet s)artaxr ;o1oexoifetydlaDemnmo;t0 rtrxr io1lpt ln ilt) 2xr(m nu1llt mfvsa(f rra(r nt1opxnio3ilt sDrlu p;(0texnxf3tadfmteaieo;s0 rxrxr iy1al nmneil(  rrr(mo;u1tptoifetys m2rm( onu0 ltnxr oa1omD anvs t0teum(m ou1lmenlnetatfaDur(r ;u1olxnioeildls2rln snt0altoif ty1oate uvilt0 etr(r iy4ome lieils)aruru ont0altnmicilsfaDeanvon(4aetoirctotlpD auvols s2umirpnodaltnmnvsat)a2um(mooo0aee io3ildfs2ra( s t0texrxfciodlptrlueol(0s2uoiopoudllen fvi ( arrmxm ;o1aeeo f3iytlaDrmuvs;u)trxnxrcia1la ran slt)seurim oy1lme mfeiat) Drm(  nt1aexomo3iadfs2el( snt4 eeomfctydfp rlivsls) rtm(o3iy1ll   fvsa(fa2taxm ;u0aetn ictyd s el(vs t4 lenxocoydla elneols) rxoiopoy4op emfcias) ruaur nt4tpxo ociys a ra(mo;t4 ltnir3ta1lptelnvol() rxrxo3iy1ll emnci s)s2umx  nu1aeen feildls ul(ms;t) rxnmr oo1lmDrauei;( tetrxo3nodapt  nvsasf 2umumono0apt mf3ildlm2eln o (0artnxo3todopt auei;s0t2xrxm oo4op nlicta()sDtmuro;u4apxn ictad m eanmp t)alerxf3iatop  ln ols teumir ny4alee nvsl( a2um( p;u0tpxomfetytfa rl(mpnt4aetomfcoatfaDeai i t  2toxm3oy4op elivi ()aDumu  ot1oltnmi3iltlm2ea( pn(0tltrmrctatom eanvs;t trtrirpio4ap   fesa() 2ur(mooo4tpeomfciadls em( o;u4aeenxf oydopD ai slt t2tr(m oo4ap n icslsf Dtmu pno4opeo iciytlm2ulnms (4 lermo3iotoaD auvi;(0srumxr oudam  mncsas)sDtmu o;u4opeoifciaslm ean o;t4arenmocio1oateanes;( setrio iu4olt  ict t sDraur ;t0aeen oeiydfmDua(ms;t0 lermr3tydfa rlivil(0truoxm3iy1omtnlici (f 2rm(ro;t0aet moeiyt a2ul(vp;u0 etrxfctydomDranvi s setmim iudllenlfcslsf 2rrx pnt4olxnifeildfs2rmnvs (4trtrio ty1om eai slt0sexoirpoy1ll n ies s aruaur ;u1tlxnif3iltfsDuan o;t0arxnio3iotlateln il(0 2trirpnodaptnliesls)arumxroou1apxomi3tyd mDeaums (0 rxnxocootomDe uvs t0 eurir nu4ap e ictltf rrru  oo1opt mietasfmDelums u4artriocty1la r ivol( s2um(mpoodamen ictat a2rruront1aet iietldls eau p;u0 rxrirctatlmDelnvo ( srxmxo ny4llt licslt  2tmur ou4apeo ociys m2ul(vp;t4tlxrmrcoodfm eaiesls0s2xmir3iy4lptelict t  2tmxrp;u0aeeo oeiyd a ua(vs t0tetrio3totoat a
\ No newline at end of file
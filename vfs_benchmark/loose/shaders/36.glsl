@@ -0,0 +1 @@
+i ols) etoiopno1aptemncsltf rrm(rp;t0teenmicilt s el(ms;u)aleniocoatfpDeaivol()trum(opoudlpe licil(fa2urxm nt1oetn fciatfa2ran s;() exomrcty1fat lneil( trtmxr3iu4omenlnvta(f 2rax oot0aee  f3tltla2uanms t0alxrir3oo1lat an s;t)trurir3io1op elicsa(fsDtru p;o0olt mf3iat aDumnmsnt0trtoxo totoate n i s texr(mpiydoleelfcslt a2rau  ot0tee  i3ias s rauvonu4 etrmo tatlmD aies t  rtrim3nu1lleelfvsas arumxr ;t0aet io3tyt a2eauvo ()tetoio oytoatr u ols  rur(rpno4lmtelfcta()artax pnu4oleoiiciltfmDulumont) lxoxo3tydoaDr nvi t) 2xrir ny4lm nmieiat)artm( pnt0tetnmfctyd aDrmn pnu0 lxrmf3oadlatrlueil()tetm(r iudamtnlfvtl()s2rr(  ;t1ope  feiltlaDeluvp t0 rxnxr totoa  aues;()t2tr(o3nudome  fcsa(fs2raxr nu4alxnmociyt a uan sn(0trermocoo1op rluvs ()trtr(m nu1olt lfci ( srtau pnu4tetomfcilslm2rm(vpn(4 rerxo3todlpDeluvslt0s2xr(r nodomee nesasfsDumxmp;t4olen iciyt s rl(vsn(0 lxoxo3oadlpDr uesls teur(m3oo1ap elies t)srrmum nu1tlx mi3iyslm2em(vp;(0alermrcoodoat aieo t tetrxr ny4omeelivs tf 2tauroou4oexnifetadfs emnvs t0 eerxr3oydlptrlivs t0 exrio nu1amenlieiasf rtaxr ;u1aptnii3tld s em( s;t) etnio3iy1fa e nes s0t2um(o oodap  lfvil( arurxr ;u4alxo f3tysla2uau o;u0alxrir oatlaDeaueo s0s2xm(r oo1ll e nvsatfaDur(m ;o4tetn oeiytfs um(ms u0areoxrcoo1lmDrai slt) exrxopou1lltnlnvtat s2uaumooo4tptomfciatlsDuanmp (0 rtnmo3iy1fpteauesl(0trumxm3io4ale lfes t srraumo;u1oetomfeildla rmump;u4tlerxr3oo1op  aieo s0 eur(r iy1amt lfeslt srrrxm oo1tlen o3iysfsDeluvp;u4 etnmrciytoa eln s;t0 rtmiopnudlpeelieslsf ruaxm ;o1teeo o3tytla rlu o;u4 rtomr3todoa rli ols teur(m3nydale lnvtl(farrmxm ou4olx mfcilslaDem(vp ()tlxoxr iatlptr uvi;t0teurxm nu1lptnmncias)aDtm(mo;t1optomo3ilslm ua(mo;t0areoircoydfm e nei;t)t2xo(m no4ame lnvtlsfsrumxmont1apt moctytfaDemuvpnu0aexomfcoadoptrln sl( s2xo(r3nu1open ietasf rta(mpno4oleniociysfs emums;t0 eeoxf totoat ln s;s0 rtr(mpnu4amtnmncslsf Durxmono0aex ioeiys aDrlnvpnu)aexrxfctydlp eanvi (  2toxm3oo4olte nesas) Dtaxroot0tpxomocildfmDea(vo;u)trerxr tydfat li o s0tetrxr3oudlleelietat s2uax pnu1opt ifeiadfm emn onu) lxrxociadoaDe ieols texoim3no1aleemnctl()aDrmx pnt4tltn fctldfs2ranvo t)aeermf3iadlat  ivs ()truoxmpou1lmtnmfct (fsDra(m ;t4alt  fciydfaDumuvp;t4artnifciydfptelnvo (  rumxr3oudopenliet s)sruax o;u4tlxnmociasfm eau s;t0alxnxf3tatop  lneolt) rxm(o3oodom  livias  Dua(mono1apx  f3tldfm2ulu snu0arxomf to1opDrai s;t  euo(r iudaptnlneia( srrrumpnu1aptnif3tyslsDuan s;() etnmr3iy1fa r ies;s)tetoxm3oudolee nvtatf rtrxmp;u0alx moeiyd aDrmn o;u4 etniocto1optr ueolt0 exo(opiodap nmncs (  rururo;u1tex mf3iltls uaumpnt)teenxrctadomtrauvs;s0 2trxr iu1amenlictlt)sruax ont0olx  i3iyt m2emu s;()tlxnmrciatopteli i t)t2uoirpoy1om  lfctasfs2tm( ono0tptn f3ild mDua(vp t4 etrxf iatopteauvil(0t2xr(m iodlptn iesat)aDtm( o;o4opt mfeiatla ulumo t0trerxr iodfpDeai i;s)s2tr(m3oodopt mnctas a2tm(mp;t4ope moeiltls raumonu4arxomr3totla e i ils)srumxr3oo1ame liet tf rrrur ;t0tetoifetydlmDeanvpnt)aeenxf3ta1opD lnvo s srxrxrpnu4apeemiciat sDurur oo4tpe  ociytfaDra(vs (4areomr iy1lmDeli o t  2xr(r oodopenmivias sDraurono1tpeniictyt m rl(mp u)tlerxociatfatr ieo s0s2uoxopiu1omenmfeiltfsDrmum nt1aetomoeilsfmDrlu s;() lenir oo1fa   u s t srtoxrpny4am nmiesa()a2taxrpno1aleniiciadlaDum( p;() etrir3oatlmDrln o;s  eumio3iodamte ivtl( s2tm(rpot1opeo iciys m2elumpn()teenxf3iodoaDelues;( trur(opoodamenmfesasfaDtmx o;t4tpto fcilsls2umumsn(4 eenmf3totoptrluvi;()srxoxo3iudol e fctl()sDur(r oo1openifcilsfmDulnvp;(4artnif iatfp eln ilt  eto(m nydole lnviasf Dum(roou4tpxnmiciydfm2ulnmp;u)aleoir tydopD ln i;s)texmir nu4opte fvs (fa2rm(mo;o0olxnifeiltfaDem(vs t) rtomr3to1lpD  nvo;s0 ruoxm oudame lfcilt srumumpno4opx ii3iad s2elnvp;t0aexrxr3oo1fmDeln o;()srxoim3ou1amtemfvt tf rra(m ;t1olxo fciad sDulumsnt0trxrxfciytfpteluvo;(0s2urxr3no4aptemfeil() 2uaxm ot4teeomictydfs eau onu)aeenir3totlaD  uvi s t2toiopou1lptnlivt ()aDuax  oo4oexo ieiytlsDrauvp ()artoirciadlaDe i o;t)seur(o3io1lle  fvsls) 2rm(rp;o1tet  feild s2ra( p;u4tleoifcoydopt lieo s  2uoio ny4lme  icsa()srtmumont0optomo3ildfs2umu snt4alerxf3oytfmDrau o ( texo(rpoy1omeemfciatfsrrrur ;u0opxnifciysfs umnvp (4aleoio iotfmteai o;t)seumxopou4aleelnvtas arrm(ro;t1tpxo ieiyslmDemnvpnt0tlenif3iydlaDr u o t0 2umxm3oudale mictat) Dra( pou0olx ioeiytfm rl(vsn(0aetnmfctydomtrau ils  rtrxm oo4llee icslt aDum(mp;t1oeto fctld a2rmuvs;t)arermo tatomDeaiei t texmir nu1apte nvia( sDum(r nt1oexo ieiys m2rm(vs;u) etnmo iytoaD  ieo;s0seurimpiodlmtnlncta( a2umxrpoo0tpt ifeiydfs em(vonu4 etrxociodfat  ivs;( texoir nu1ame lict (fa2tr(rp;o0aee ifeiat m2el( p ()tetnifcootfaDe ueo (  2toiopnu1opt  neil(faDuaxr ;u4oexomf3ilt a rmump (0 ltrmf tytop   u olt)s2tm(o3ou4am elicsas aDumurpnu4tpxn o3iyt mDulu o t0tlerir iy1fmteaivo s s2xm(r ny1altemnvt ( sDuaumpot1oleniociysfa ran s;(4 lxoifcio1op   ivs;(0texr(rpno1lpe mfctlt  rtr(mpnt1apxoio3tytfa ra(vs u)trtniocoadfmD au o;() 2uoxm3iu1optelnctlt aDtaxmpnu0tlt miciydfm2ea(vo t4 ltomfcta1lm eaues s  exrxm nu4lm  lfetlsfsDumxro;o4aleomoeiad aDem(mp;(4 etnxo oydfatelies t) exmxrpou1oltnlfesa()arrrurpou1oex io3tatfa2rm(mo;u0tlenifcoo1op eln o;(0s2urxr3no1olen nvslsfsDumx pot4oeeniictltlm2rlnmp u0arermf3oodfpteaivi (0t2xrxr nydame livsls)srurumo;t1aet mo3iyd a2ua(von()altoxoctadop e n o;s)srtr(mpoo1am n netatfs2rr(mono0apeomociytla um( p t)aetrio tatfm elueo;s)seuoim3ny4ol  mieias  Durur ot0olenmiciatfm2ea(vp;(4tleoir3tytfm e nvol(0sexmxo3oo4amenmictlsf 2umx p;t0olxomiciysls umn o;t4 lxnif tytopt  uvolt0 2xr(r io1optelici tfs2ra(ro;u1tlto oetyd aDuauvs u)tetomo iotlaD  neols) rxo(m oy4am n iciltfs2urxr ;t0olt if3iltlsDrlu pnu4arxrmo tadfm eluvo (0 rxm(o iy4ome  fvs s) 2rr(ro;t0tlxomo3tlsfa el( onu4treomocoa1oat aivo;(0t2xmxr3iudap  mici ( srrm(moot0oeenioeiadlm2rmumo u0 lxrmo oodop rli slt)sexr(opny4ap  lfvil( srururpoo4alxnif3iydfs um(vpnu4texoio3oytlmD  nvils trtmimpiudlpt lnetat arraumpno1oexoifetld aDumnmo;() exoxrcootlp e ieils srumio3oy1omenmfet s s2tru pno0altoiictyslsDuaumo t4 etoir3io1lmteauvi t trxrxm iy4ome  fctlt)aDrmxm ot1tltomoetltfm ul(mp u0altoxf3oy1fate uesls0seuoir ny1amt  nvi tfa2umxro;u1apx io3iyd m ra(vp u4 rerxo3ia1fmtr uesl()seur(opnydlp  mivsas  2tax  ou4aetn ieilslaDea( p t)areoxo3iatomDrluei;s sexr(m3no1opt mict (f Drrxro;t4tpxnii3iat s uau onu)treoio3totlptr ieo;t texmir3nydalt mfesls a2ua(rono1optoii3ias m uluvp;u)texnxf ta1lpt  i s;t  2um(opoy1al emncsasf 2um(rpnt1optniiciydfsDrmums;t4 rtrif3oa1la  aueo s0 rxmxr3oudopt lietlsfsDurx pot4tlx  icils mDuaums;(0tlerxfctydoa eluvo (0 2uoio3ou4oltnlneta( arur( oot1tee miciyslaDrl( p;(0tltoir3oy1om eau ilt0t2tm(opoydam n ivtl()srum( p;u0tlenmiciyt a ra(vsn() rtnxrcoo1opDrluvi s)trtoimpnodop   icsa(f Dtmum ;u0opxnioctydfs ul(von(4altrio oatfaD lnei;( srtrir iy1lpte neta( artaurpoo0alt iociaslsDulump;()trtomo3io1omt an s t s2trxo nu1am  mfei (fs2rrx  ;o0aetnmf3iys a2rmn s t)tltnir tadfm r uvi t s2xriopno4apee nesatfsrtax ono4oeto fctlt s umn s;u0 eeoio3to1fptrai ol(  2tmio3iydaleelncslsfarrmu oot1teeoifetydls emu p t4tlxomr3ootfatrauvsls  euoxopny1lmtemiet tfartaur ;t1oleomieilsfs2uaumo u4trtrmfcto1lmtr ieo s)teurxo oudop  mnci s) ruau  nu4altoifetltla rm( snu0aetnxr iotoaD  u i t teurir3iu1om nmnvsl()s2ra( o;u0alt  ocilsfs2emnmp u0alerif oa1opt  n s;s sexoim3nudlmt mieia()arum(  nt1apeo fciadfm2ra(vp;t0aexniocio1fpD ai sl()s2xmir3iy1om e iesl() 2umxroou4tle iieiatlsDrm( on()aeeomoctotfmDr u sls tetmxopiudamenlfvsas aDrmu o;u1aetnio3iatfa2ra(vp u)tltoxr3oodoptrauvsl(0s2toxmpnu4lptnmiei sfaDtax ono1aex io3tlsls2uan o t4alenmo to1fm rlues t)texm(o3iu1lp  lfvt s  2uaxm no0tpe mo3iytla em(mpnt)tlxrifcto1lpt lues t0trxoir nydape livtl(farumumpnt0aleomfciadls elnmon(0 rtnif3oodfmD aieo t  2umxm3ny4al  mncsl(fs2ur(r ot0altomfciatls2umnmp u4 rermoctytfp r uei;() eurxopnu1alt mncs tfarua(m nu0tpt if3iyd sDul(mp t) rtnxrciodla r uei ()s2um(opoy1lp nlnet tfsrtrxm ;o4aeeo o3iadfa eanvsnu) rxomrcta1lmDelnesls0setoxr3iy1ope livs (  2uaxrpou1altoiictasfm ua(mon()teerxo tadlmt  u olt)srum(mpoodlptelncs t)s2tax p;u4altnmoctyd s2umuvo ()tltnirctydlpte iei t)t2tr(m no1al eliciasfaruaur oo0texnmi3ilsls rm(vs t4 lxoio totlm elu ol() rtoiopnodlltelnvt s srraumonu4alxomfetatfa2ulnvsnu)tlxomf iydlmDrlnvol(0t2xmir3iu1lpeemici () Drm(rpou0oetnmfetasls2raumsnu)aeenxo tatfateauvo;t trur(o ny4ame  ivsa(f Duax p;t4oeeo fciys a ul(vsnt4altnxf3oa1lpDrliei s trtrxrpoudlm n nvsa(fartmx  ;o4apxnmi3tydfmDeaumonu4tltoifciodlatrli s s)s2tmirpno4ap nmiviat a2umurp;u4opxnioeilslm emnvo;t0tlxomfctodoaDranvo (0 rxoxr3no1ll e ivs ()a2tm(monu0apxniietldfaDulums;u4trxnirciytfpte neol(  rtr(m oudom elneta(fs2um(mo;t0tex iiciad s uluvonu0artnir iodfm elnvs;( sexr(m3ny1alenmnvsls aDraxm oo4oex mfciasfs2uanmpnu0tlenif tytfpDrai o t) 2ur(rpiy4llt mfesa(f 2umxmpoo1alx mf3iytlmDemu onu4alenir ta1fm  lnvi s  rtmim3iydlme mivia(fa2urxmooo0ope iicildfaDeanms u4trxoxfciatomt luvo ( s2uoir io4lptelicia() 2urxr ;u4tpx  feiat sDrm(vs;(0trtoif oydfaDe neil(0 2trxr3ou4om emfcsat a2rrurp;t1tpx if3tlslmDul(mpn(0tetomfcio1fmt auvs () 2urxrpiy4ap n netat s2tr(m ;u4optn ieiat aDuanmpnu4tlermf3tadfmt  ivilt0srxmirpnu1alenmivil()srtm(rpnt1alen f3iytls2rln p;t4 rxnmfcoydlm r ivi s teuo(o io1aptnlfvsat sDtm(monu4oexo feilsfsDuanmsnt4artrio to1lm eanvi;()s2toxrpoydolenlnvtlt)arrru p;t4apxniietld m elnmon(0 rxoifcootla  aneolt)trtoim iu4am  mivtls arrr(r ;u4apxnii3ilsfa ul(mp u4arxnmrctodfaD  nei (  etmir ny4ape livias aDra( p;u0aptnmi3iatfaDemuvp;u)tetrmr iytlp   u i;s  eurxr3iu4op e fctat  rrr(  ;o1oeeoii3iaslm2ua( p ()tlxrxfciy1opD  n i;t0 2urimpiudome  neslt sruaxmooo1open o3iad m ul( p;t)artnxo totlmtr u s;t  exrxmpiy4olt  fvtltfa2urx pou1apen fetldfaDel(msnt)arenxfcto1la r ivi () 2uo(o iydolt  nes t)a2tm(mp;o1ape  o3ildlaDrm(vo t)texnio3iodfmtrln o t s2uoirpnudlm n nctl(faDtr(  nu1oex io3tytla emu onu4altnir to1fpDrlu il(0 2uriopiy1llt mict s)arta(mooo1altoiocilsla eaumpn()tetrioctydfmtrlivo t) ruoxr ny4om elfcia( s2tr(r ;u0tetoii3iydls elnvp;u0aexnio3tytopDelu ils0s2umir3oo1lm elfeil(f Dtm(rooo1oleo feiydlsDem(mo (0areoxr3oytfpteau sls0s2uo(r3nodlm  mfctl( sDur(rpou1teto ocildla umuvp;u0trtoiociydfa rln i ()texr(o iodap  mfci tfs2trxrpou0tpxn fciytlsDeanvp u) rtomocoatfp  an ils)s2um(m3nu1al elnvtls) 2ua(mp;t0optnmi3iyd m rmu snt) rtoifctatoaDr i ols0s2umxm3ny4optn fcta(fsDumxrp;u0opxomiciyd m rm(vo (4 leoir tytfpt luvi;(0 2xrxo3iy1lmtelfeils a2tau p;u1alxo i3ildls2rmnvpn(0arxrmr to1fpD aieo;s) 2uo(opoo4lpt mfcslsfsrtmxm oo1apenioctydls2ulnmp t)trxnif3ootfa elivils0s2trxopnodlmeelfei t) 2umx  nt0teeo o3iytfs2eln ont4teerxr iy1lpD livsl() eumxr3ou1lm  mivsltf 2rmum oo4olt mo3iasfsDea( p u)aexrxo ty1oaDe ivo;(0trxo(opiu4llenmnvia(f Dtax o;t1oleoii3iytfm el( pn(4 etnxrcoodlpDrauvo;( t2xr(r iu1ll elici s  rtmuro;t4olenmf3tys s2ra( pnu4aleoxf3oy1fatrli s s0 rurxmpiydam n ncs (  Drrx o;t1tptoifciydls emu o;t0tetnir iydoaD  i o ( srumio oydapee feslt)aDrm(mp;o1altnmfetldfm rm(mont)aexrmo3io1fm  aueil() rxo(m3iu1lmtelieia(  2urumo;u4oex  oeiyd m rl( ont)tltoioctodfmtelieol(0t2to(rpiu1lp  lfesas  rtaumonu4apeo ocilt sDrmn p u) etnirciodlmD an slt) euoxrpiy1ol e nei ()sDraxr nt0tet mf3tydls rmn s;(4 lxnxo3oydlatr neo;s)sexmxmpno4olenlivils)s2tm( ooo4ale ii3iysls raums t) lenxr3ootlptrauvi t0 2toiopiu1omtemnvt () rum(  ou1texnmfetlt a elu s (4altomr iatfm eaies;s)trtm(m oudlmt miesas s2rmx p;u4aexnifciyt aDelnmo t)tltoxo3ootfptrli s t0s2urio3nu4ol elietlsf rrrxr ou4aex  feiytfa2umuvon()arxnif3totop  au o;()teuoim oo4ll e netl( s2umxmpot0tle  octytfmDrm(mon(4alxrmo3iadlpDrauvi (0 rxm(mpoy1lp emneia(fsrra( ono4aetomfetaslaDulu pn(4 rtrxfctytopD lnei (0s2tm(r3no4oltnmnciltfarrm(rpnu0apeo oetlsfm2rm(vp;()aexrxf iadla eaueo;s seto(m iodom emnvi t)srrmxmonu1tleoifciat s ua( o;(0aeenmr3io1fmtelivi s0truo(r3io4apt lfet t)srtrxmoou4oeeoioeild m2rmuvsnt4aetrxr3ia1latrau s;t seuoxo3nydom   fvt tf 2uaur no4teto fctytls eaumo;t4 lxomf3iydlaD luvo;() eur(m io4altemncils) rrmumo;u0alxo oetlsfsDrlu p;t0trtnmf3oo1optr i s;( s2uoir no4ape livi (f Dur( pnt1aptnmietaslm2um(vp;u)trtomo oodla   ueslt0sexr(o3io1amen fet t)a2rrurpoo1tle  octydlm emu p t4 lxrir3oa1lateai s t0sexoxo iy4omte ieiasfsrra(mo;o4apeo oeiydfa uanvs ()trerxocoy1fmDelu i;() etrxm3oo1lpe lies (faDtrx pno1ope mociydfa2uauvs;t4altoif ta1fp  lneilt0trxo(o nu4om   ieils)srrr(  nu4tex mi3ils aDrm(ms;()alxoxoctadfpDe i ilt)teumxopno1ll e fvt (  rraumpou1oexniietyd a elnmsnu0tltnxr3iadoateaivs t0s2trim oodllenmncsat  rtru pno4apenmieiasla umnmp;u4tlenxf3iadfmt  nes;s0 rxmio oudaptnmici s)srur(m ;t1tptomo3tadla2umnvpn(0 eerio3to1lpDeau o s  etrir3nudlmte icsls)s2rau onu4aeenii3ilsfs2umu o;(4arenif3iydfa ran il(0s2xoimpiu1lle mivi s  rrr(mpot0aeeomf3iad s rm(vp t0 rxrmo3tatopte uvsl()sruoxrpnu4lmt mivt ( s2tm(mpou1tpxn ictlt a2em(vp t) lxrio3tydoa eaivo;t0 2xrxr3iodapenlfvta(f 2rrump;t1ole  o3tyd s rm(mpn()texrir ty1faDelivi t trto(r3iu1alee iet sfsrtr(rpnu4altnioeias a2rl( o;(4tleoir3iytomt  ueo t0t2xoimpnu4amtelncta()srrrxm nu4opeo ictytfm2emn p t0trenir3iydfm   uesls) rumir3nu4altelietls aDumxr ;o0oetn oeilsfmDrmn sn(0trerir3ootomDrlivilt  2xmxm iodalen ncs s srtm(rpno0aee moctldla umnvsn(4 rtniociadlmtelnvi s teuo(o iydlp   fci (f 2tm( p;o4ole  ociasfa eanvs (4 lxrir io1fp r u ols)s2uo(r io4openmfvi s) rtauro;t0tptoifciad mDrmuvont0artrmr io1faDraneils0t2uoxr3iodame lfei ()s2uau  ;o0olx mociysfaDum(ms u)aexrxrcoatfpD ln s s) 2uo(o3ny1aleelics (faDtm( o;t4texn i3tad a rl(vo u4alxnmf3iadfmDr nvo;s) exmio3oy4ap  mnvs (f Dtau  oo1aptnif3tat a rlu pn(0tltrifcoadfpD ln i;(0s2toxm3oo4openmivtl(fa2tmum nt0olx ii3iasfmDrln o (4 renmf3tydoa rau s t0trxmxr3no1llt mfvtas aDurx  no4aee mictatfmDrlu o t4artoxr iadlm elueo;s0s2xrirpiu4lptnmfvsas a2urump;o4tee  fctad m2eau s u4artrir3oytlm   nvs;(  rtrxo3io4lle lics (fa2taum nu0oexnmfeiltlmDeanvo () eeomr todfpD  n i;s t2xrxm3oo4lmtnmieils  Draurp;o4tpt moeiadfsDrau p;u0tlerifcta1fmDrlnes s t2xrir nu4lpeemfvils sDtrxr ou0tltomo3iyt s2ulums;t) reoir iadlp rlivo s)sruoxm oo1llee ncil(fsDraxrpou1alt mo3iltla2um(vont) leomocoydlpD li ols truoio3iu4optnlnvsltfaDraxmpou4tlx  ictltfsDem( o u0aetnif ootlpD ln s t  rtr(m io1omenmncsl(fa2taxmont0aee  oeilsla rlnmo;u) rerxr oy1oaD ai olt)s2triopoydlltnlietat s2rax onu4oleo oetldfm em(ms t0altomf totlaDrlueo;s  rtm(m3oy1lltnmfcslsfa2tr(  ;u0optnmfeildfa2ranvonu4altrxocoa1fa  li o t s2uoiopoo1open fcia( s2ur( o;t4olx if3tadla elnms;t0tlenir3iodoa  luvs;t sexrimpno1optn fetlt)s2trxrpnu0oeen oeiydlsDel( sn(0altnifcio1lpDrlu o;( srtrim oudap nmiei s) Dumx o;o1aptomfeiat m2elnvo;u4altrifciodlmDelu s t)tetoirpou1op n fct (  2ta( onu0ape mf3iysla2emnms t4alxrmr ia1lmDrlies;t)s2tmimpnodlmtemneiltfa2taxm ;o4oeeoifeiytlaDuanmp (4arxomrciadfa r uvo t  2uoimpno4lmt licslt s2urum oo0opt ifcilsfaDrmnmpnt4 exoir3iodfat  n slt  exriopoy1ap n nei s) Drmxmono1tet iociatfm2rl( p;t4arxomf tydopteliei (0trtm(m3no4llen fvil( sDrrur nt1olt ifcias s um( p (4arxnifcoytom   u o;(0texr(m3nodlmt  icias srur(  ot0olt ifetydlm em( o ()trenmf oydop   i slt tetmxr iy1aleemnei s)a2trum ;o4aeenio3ildlm el(vo;u0 lxoxfciytop raues;t seurxm oy4amtelieiat aDuax o;u1aetn oeildla2umuvpnu4teerif3io1fm   ivils  eurxo3oo4lltnmiviasfsDrau pou1tpenmietltfaDrau o;t4 eerxr3oodla elivi t0 etmxr iodal n iei tfsrtrxr no0tet  ietatfa em(vo;(4 rtnmrcta1omtr u ils) etmxo iudoltnlicslsfaruaxmpou4aet mfeiltfaDemums t4altoxf ta1late ueils)texo(mpoo1ame lnetat)a2raxrpnu4tptn fetat aDran sn(4trxrxo3iydfaDrli i ( tetm(mpoudop   net t) rtax  ou1opx  feiadlm rmump t)teerxrcootfptrln i;( seuo(r iu4lltnlfci s) 2tmxrpnt4opx if3ildls2uan o t)altnmr oatla elnvi t0trxrxo oudop nmnvsat artrx  no1olto octltlsDeln p t0trerxoctydfp  livo;t sexmxo3iydll nmnvtasfaDta(mo;u1oetniociyslm2rmums t0texnircoytlp  ln o;( texm(rpno1lpte ivtltf rtax ont0optn ocils m2rau p;(0aleoio todfpD luei;s0s2xoxm ny1om  livs ( aDuaxmpnu4tlx  iciat a2el(von(0aeenir iadlmte n i;s0t2um(m3iy1al emfes tf rraxr oo0tptnmo3ild a2uanvont4aleniociytomt  n i;s setmim nu1om  mnciasf Dra(mp;t1texnmo3tys aDrlums;(4arxrxociytlmDeaivs;()s2xm(r3oy4lpe  nesasfaruax ono4aexomi3iyslaDranvo;u0tltrmoctotop rliesls)sexmirpiu1ol n nct sfsDrrumpno0alx ifetatla2ranmont4tlerif ootfpD lnvi;s srxm(rpoudllenlfeils s2rmuro;u0tpeoii3iad sDranvp;u0trtoxf3iydopD  ivo ( srtmimpoy1lltelneia()a2ua(mpoo0tpe  icilt a2umumont0artrif oo1omt ln i ( s2tmim io4alenmnesat s2raumont4olt  oetldfa el( o;()arxoirctotfa  lneo s setmxo3oo1lpte nvilt srtrx pot4tlxnioetysfm ra( s;t0aeerxocoodopD livi t0setm(m no4lpenmicsl(fsDumx  ;t1aleo i3iatfmDrmu o (0 eenif3to1omD lnvs s) rxrir ou4omee fcsltf Dua( pnu1tpt iicilsfsDrl(mo;u0 eeoir tydopD liesl() 2xmxopoy4apenmiei sfsrrrurpno1aleo feild m ea( onu4 rtoxfcoadfpDeln s t)srxmio oy4ame mivi ()sDrru ooo0alx ifcias sDrau snt4artrxo oadlat lnvo t)tetoimpnydlmtnmivsa(fsDurumo;t1olxo fctad a umnms (4trtoif to1oate ueolt)t2xo(opou1aptnlfvsltfsrrr(  ;o0tltoii3iytfs2rm(mp;t)altrif iytlaD au s s0t2umimpoo4alt  nct s) 2uaxrp;o4altnmictldfs2ra(von(4altrir3iodlp raieo;t0 eumim3nudapen nei tfsDtax ooo0alxn o3iatls um(mo u4arerir3to1lmDe nei;t  2ur(r no4lp emietatfsrrmu o;o1aetniictlsfa rauvpnt) ltrxf iytlmtrlnei;s0 rxr(mpio1al nlfei t  2raum ou4aex mieiydlm eauvont)aetoxr iy1fmD aiei t  2toirpoy4ol  mfcsa()a2ur(  ;u0opto i3iltls2rluvsn() ltoir iytlmtran sls)trxo(mpou4olee fvilt arrmurpnu0tpxo i3iasfaDrl(msn(0aexnxo3tadlmD  uvi s)teuo(mpio4ol e feias s2ta(rpot0oeen feiadfa2ul( ont4texoxocootopDrai s s tetm(opio4am e iesl(fsruru pou0oeto fciatls elnmpn()teerio iy1lpteau ilt0srtr(o3oo4lmenmfvtl()a2ur(mp;u1tetnioeils a uln o;t4aeerir oytfpDranvol( t2tmiopou1lpen fcsasfsrtau p;t1tpx  ietydlmDuln ont)alxrircoydfpt  nvols0trtm(m3io1oltemfci t s2rrxm ;t4tetn iciys m2rlnmsnt4 lxoiociatfm  auvi (0t2trxmpou1lptn ietls)sDumumono4tpen fcias s2ulnvsn()altrir tytfm  anvi t t2xrxm oo1ole mnctas) Drr(m ou0tltn fetls sDrmuvs;u4 rxnif iatfptrli ils)seumxo io4optnlfes tfa2taumo;t4aptnioeiyd m2em(mont0tlxrxr3ta1fatr u s;t)seurirpiy1apee fvil(f 2ra(monu0tpto octad mDrlnvont)aleoxr ootfp e uei t texoxm3iy4lm nlivtl(faDumumono4texnmietasfsDeaump u0trenmrctydlpDeaieo (0 rxrxopnydame lnesa(f Dta(ro;u1olenmi3iatfa2ulnmonu) rtrmf totomt lieo;s0sexrxr3oo4apenlivslsf ruau o;t4tleoioeild a2ranvsnu4 lenmfcoa1lmD  nes;s0t2xoir3no1altnmnetl(f Dtm(m oo0opxnmieilslsDulnvsn(4aetnio3iadlm elnvs;(0t2tmxo3iu1al   nvtatf Duauro;o1tlenmf3tltfs2rm( p;(0tleoxf3tydlpt an o (0truoxmpoo4ameemnvilsfs2uaurp;t4alenmfeiydfa ra(mo;() ltoxr ta1fa e ivs;s  exrxo3no1alt  icsa(farra(rp;o0alto fciydfaDea( s;u) eerxoctodfp  auvo;s tetm(m ny4lp nmnvtls  2rmx pou0aetoifeiadls2ulnvo;(4aetrmo oadlm rlueo t0setrxo3iodoltn fci t  2tmum no0oleomictad a eanmo (4aeeoxo3iotlpDeluvi;()t2xmxrpiy1ame mfvs (farrmum nt4olenmfciys m2elnvpn(0 etrmo3iodfaDrluvi t srurxmpiu4ape lfcsl(  Draurpno0tpeniocilsfm2um(vs ()aeenmr3oatoaDrlu s;s0 rtoxr3nodope  ivt s) rua( onu1apxn fciytlm2uan s ()texoio3tadlmDraiei;t)t2xrxm3iy4ol   icil(faDtrurp;o4tleo i3iyslmDea(mp;u)tlerxo todfmte ivs s)texm(mpio1om  mnei t aDtaxroou0teeomfeiatla ulnmon(4arxnxr oo1fpt  u ils  2xoiopiodlm  miet (fs2taxmpoo4oeeo oeiydfsDrm( p;t) renxo iydlpD li olt0t2umir iodlle mietl()srtr(  ot4tex mfcildlmDrmuvs;t0 leomrciy1lpD lu i;s0 2xm(m nu1lmenlnvt (fs2ua(ronu1tpxniieild a rlnvpnt4trxoxr3oadfmtran o ( teum(opno1ol  mfcsa(fsDua( p;o1tpto fciyd sDeaumonu4teenxf3totlptelues (0sexr(rpoy1lmenmies s)s2ta(rp;o1apenmoeiysfs2emnvo u)trxrmfciadopD lnvils texm(m oy4ame micsa() rtrurp;t0aeen f3iytfaDul( snu0 rermr3tatfmteai olt trxm(opiu4am nlfcia( aDrruronu0oexoioetatfa em( pnu4arxoxr3iydfpD ln sl()srxoirpny4op   netl(f rrrxro;t0aptnii3ildfsDea(vo;()tlerioctotfmD  nei;( trxoxrpnu4ll e nvtat) 2tmx pno1alx mfetyt s2rmnvsnt) lerxociydlmD  nvs (0setrir iydol   fctl(  Drm( ono4alt  octatfsDemnvp (4trtoxrciatopD lnes;(0 rxoim3iu4lmtnmnvt t  2uaxro;u0oet ifciytlmDemuvs;u4artnif3todfmtr ueols0texmir oo1ll emictl(fsDrmx pno4aee  octltfs ul( snu) rerxfctotlpD liei t0srumimpou4amenmfcslt)arumu  ;u0oet iociys m rmn o (4 lxniociatlateau o s)sexoxm3iodolee fcs tfs2rm( pnt4apeomociyd a2uau s u4 lxomociadlatelies;(  rtm(o3iodomtelieiat srrr(mpot1tlt mocilt sDea( s ()tetomr3oo1fmtrli o s trxmio oy1lmeelfeia()a2um(m ot0aetn i3iatfs2eauvo (0aetoxocoa1fm  lnvs t srxo(rpnu1al emnei ()sDta(ro;o1aet mi3iat sDem(msn() renmf iytfp r nesls)srtoxr oo1ape mictl(  2umxmonu0apt  fciltfm emumpnt)tleomf3oatlat  uvs;( s2umxr iy4amt  fcsa(fa2ur( o;o4optn oeiad s umn p;t)aexnxr3ootoa raieo;()setmim3nu4lp  mfetl( aDrmu o;u1texnmfeiytlsDuln p;u0altomo3ta1fmD  nes () 2tr(o3iudlp elivt s  2tr(  ot0olx mi3ias aDum(vsnu0alxnxo iodom elues s0trxm(m3ou1lptelivtasfaDumumooo4tptomociltfa ea( o;(0tetrmfcty1oaDelnes;( t2xrir oodalenmneia() Drrx pno4tltniieiasfm2uanvon(0trtomf3totfatraneol(0teumxo3oodlmtemfctat  Dumx poo4tpeomf3iadlmDea(vo;u0tleoxrcoadlat  nvi s  2xrirpiy1ll nmivt t)srrrxmonu4aeenmiciltls eluvo ()tetoir ta1faDe nvs;s s2tmio3ou1omtn ncia()s2uaur ou4altoif3tltlm elump ()artrmf ty1op   uvs;s0 euo(o3io1al  lics sfsDrm(mpnt0oltomo3iltfm umu s;u4 reomo to1la e u o;(0srxmxo3nu4opeemfcsl( aDrrumoot4opxoifciytlm ean p;(0altrmo3iy1fpDrliei () exoxmpno1omt  ncsa(f 2rmum ;u0tlx  fetydfs rmumonu0 rermocoydlm  lnvslt0 eumxm iy1ape lietl() Duaumont1tpe  i3iydfm2rlumon(0 etriociadfpDrli sls0trtr(o3nydale lictls  2rru ooo0olx  oetldla2uanmp u) ltrif3iatomt lneslt0t2urio3nydopeelfct ()sDrmu p;u1alto ociltlmDea(vs t) ltrmf iadoaD  i i;(0s2toir io1lptn nes ()arumuronu0ape iociys sDeauvpnu)alerxf iodoatelieils0t2xoxm ny4lp  lfes sfsrurx  nu4tpe if3iad a um( s () lxoxf3iytfa eauvs ( trxmxrpoudlleemnvsa()sDuru p;t0opxnmfeiltfaDrm(msn()tlxriocta1fa rai s;s0 rur(o3nodllt livt sfsDuau ont0aeenifctys s em(mp;u4texrxr3iy1opt auvo s s2uoxo3ny1op  mnvtas a2rru  ou1tpxnmociydfm umumon(0 rtnir iy1oa ean olt) 2xmirpio4lpt livtl()a2umxm ot0openmoctldlm2ea(ms u4altnxo todoat au ols)truoxr ny1lp   ict (fartr(m ot1olx io3tytlm2el( sn() etrio iydfa raneo;s)srxmxm3iu1amt micsl(f Drau  ;u0oee  oeilt m2rmnvon()tltoxr ty1lp r n s s t2trio3oo1amt lictls) Draurp;t0tlxnmociadlaDranvpnu4tltrxr todop e neo s tetmir oudapeemnvtltfsDua(  ot4aexo fciyt aDem(mp (0 rtoio3iy1omtr n i s t2xr(r nudlp elivt tf 2rmurpou1apenif3iyt aDumnmonu) etomo iadfpDeauvs;()t2xoim3io4amtemfctlt a2rmumoou1optoifciltlm2eaump () renmo3iodfmD anvs;s0 rto(opno1al nmnvt tfsDrmxrpoo1oeeomfeiyd sDum(mo t4trxrirctadlat livol( t2xoio oy1aleemnet (f Durxrono1tle  ietaslaDuanms u)tltnmf iytfpt an s s)teurimpiu1lmeemnvias artm(m ou1oee  f3iasfa umu o;t4altnmocoodlmDrau o (0s2uoxo3iu4apt mfes tfsrrmxm oo1oexomoeilt a2ea(mo ()tltnmr3oy1fa r ueo;t  2uo(rpoo4am emneias s2rrumpnt0tpen fciatls2ra( sn()aetnxr3oatfm  livi s) 2trxr iydolenlnvtls  Dtmx p;o0opeomo3tad a uaump;u)teeomfcoytop raues;()teumxm nudlpt lfcilsf 2rr(m ;u4oleoioctltls2ra(vpn() ltrxo3iydfp rln slt trumir iy4amee nci tf Drmurp;t1texo ieiadfa ua(vo t0 lxnxo iytlpteanvi;(0t2xoxopnu1optemnvtas  2rr( p;o0ole ifciyslsDeauvp u4trtnxfcia1oaD livslt t2um(r iu4lp  mfcils srtau pot1aetomi3ildfa2eanvsnu4trermrciytlmt luvo;t  euoio no1opte ivt t)srrmumpot0ole iociatla2rm( p;t4teenircto1fmte n ols0t2um(m iudll n fvilsf rumu onu0texniictas a uln onu0 rtomo tydomDrln i;( seur(opiu4aleelfciltfs2trx  ;u4apxomiciydlsDuanvs t)texoir3oadlaDrai sls0s2toxo3ou1altelfcil(farurxrpnt1tlx ii3ilslm2ua( p;()tlxnmo iodoa e ivs;t)sruoimpoy1lp nliet s s2raxmpot4ale  o3tldfs2ean p (0tltoif to1op   n o;( texoxopnudap   fvt s)srumum nt0tptnif3iltlm2ua(mp (0arxrxr3ty1oaDelivslt sexoim iudom emnetlsfarrrx p;o1opto fciyd aDumu snt0areomf3iodoat ai s s trtrim3ny1olee fcsa(  Dtax o;o1texo iciyslm el(mo;u4 ltrmo3tydfp e u o s0s2umxo oydopt mnvtlsfaDtaur oo1aetoifciyt aDul( pnt0aetoioctytfpteai o;s0srtm(r oo1al nlici s)sDtm(  ou1tpeomi3tadfm2emnms t0tleoxo iatom elivs;s) 2urxopnodlmt mnctat  rtau p;u1oleomictytlmDra(von(4tlerxr oo1fmtrli il(0 exo(mpnodapeelneslsfa2raur ;u0opt io3ilsfmDuln onu4tltrxr ta1fpDelivi s) 2umxrpny1lpt lfetltfaDtmu ont4tpeoiictlt a2ul( o t)tlenmfcty1op  au o;() rumxo3oy1ll nmnct t a2umxr ;u4teeomfciytlm2rlu s;(4artoxf oydla  lnvs;t  2tm(m oo1llenmnciat  2rm( onu1alx  i3iatfm em(von(0 exnmr todomtrlnvols t2xr(opoo1ll e netlt) Duaumo;t4oltn f3tatla2uluvo;t)tleoir3todomDeauvolt) rur(o3oy1al emivs tfa2uau pot4apx moetld m uluvs;(4 rxnmf3ta1oa e nvo t srtoxopoo1lmenlfet ()sDraumpot1ape  oeiydfm eauvp;(0tlxrmo to1omD  nvi;()t2uo(mpoy4amtelfet tf 2um( oot1tpe  fciltla el(ms;t0 rerir oytlaDr nvol() exmxr iu4am nlici t  2uaxrpou0tleo ieiytfsDrmnvs;t0 exrio3io1la  au o;(0 eumxr oudamen feilt s2umx  ou4oee  fetad m2rmu onu)alenmo3iy1opDe uei s) rxmxr nudlm   fvsl(f Dtr(mp;t4texoiiciatls um(vo;(4treoxocoo1fpteanvils0 rur(o3ny1omee iviat  rua(r oo1tltoifcildls2ranmp;(4tlermr3oydfmDeaieilt s2xmxr3io1lpee icsat arumu poo1apt  octys s emn s;(0 exnio3iydomtrli ols t2tmio no1optelivils)arum(rp;t4optnmociadla uanvsn() rtomf3ty1fate i o ( tetoxo nu1lmt  icsasf 2rmu pou1aptn oeiltfm ul(mp t)tlxrmr3tytlat  u ils)trtmir ny4alenmivs t sDta(rpno0tpeoif3tldfs elnvpnt4alenmr3iydfp  lu s;s) rurimpny1oltnmfetlt  2tm( pnu4optnioeiadla2umumpn()altoifcta1opteauvi s t2uoir3nudamt lfes tfsrtaxrooo0tpenifciytls elnvo;(0texrxo iatfp  auvsls setoimpoudll nlici t sDurum no4ale ifctyd a2eln sn(0aeenxo3oadfm elnei;t)s2xoirpoydap   fetl(fs2ua(rpoo4tetnioctldfmDumnvo t) lerir3oy1laDeaueils0 rum(r nodllee ics s)sDtru p;o1apxoifeiyd mDum(msnt) rxrxo oydfpDraivo;( s2umio3io4lpenlietls)aDtrx  ;u4oetn ocilsfm2el( onu)aetoirctotfaDeau slt)srtrxopnudal elnvt (  Drr(mpnu1alxnmietys m uanvp;u)tleoxo oa1opD luvo;t0trtm(rpoydomte fcs () 2rrxmonu0texomi3tas mDua(vpnu0tetnxf to1lp e i i s)setmxm3oy1lmee ies t  rrrur oo0aptomfcildlmDuln s t4tlenmf3tytomtr ivils0 euo(m3iodoptnliviat aDtm(rp;u4oleniieiaslm ra(mp t4aeenxo3oydoaDranes;t s2xo(rpiydlmt mies tf rtmu p;o0aeeomfeiltfs rm( s u)tetnir3tatfat  neo;( srurim iu4omeemnciltf Drm(mpnu0olt iietyslaDra(mp t)trxnmf3tatfa rauvols)srtr(opnudap n nvils s2tmurooo1tle ii3iyt a ea(mo ()aeenxrctadlm e ueols  2uoxmpoo1ap e ict ()sDraump;u0tee  i3iysfm2ra( o;(4arerir3totopD ln slt) ruoir nudomtemfcsat  rurxr nt0aet mieiysfs2uanmp (0aexrifcoo1lmDeai o s0s2toim io1am elfvsatf Duau  ot1texnifeiat a2ul(vs;() rtomr3oy1fmt  ueil(0trxrxr3oy1lpt  nvtlt)srumxmpoo4aleomf3ild m ea(ms;u4 rtnxo ootlmDrau o;t  rtr(opoudlp  livs s  ruaxrp;t0opt moetlsla rmuvonu) leoxo3oy1lmtrlnvs;s0teuoir ou4ape lfesat sruaxm no1alxo ieilt a ua( o (0texrmrcootoa  luvi ( sruo(opio4olee fetat)srtau  oo0apt mictat m2umuvs (0tltrif oy1om  aivi;s)trxoir ou1lm eliesls)a2ua(rpnt0apt  i3iyt aDeauvp;t4 eerxf3iadom rai slt) rtoim oodll nmfvs sfartmxro;t0tlx miciat m2rlnmsnu)areoir3oydopDelnvi;t srxrio iy1lpt lnvsl(f 2ta( onu1tpeoio3ilt mDrmnvpn(0aetnif tytom  lnes (  etriopiu1opeelfvs sfsrumxro;t1tleo ietltfaDrl(ms;t0tlxnmo oadomtr nesls0s2to(o3iodlmt mnetat sruaxmoot0tlt  fciyt s2el( ont0texnifciodlpDr n ols t2to(r iu1amtn fviasfaDta(  ;t0opx ii3iytlm ua( s t0texrir iatom  lnvslt0 2urxm ou1lp e nvt s)a2rr(mp;u1tpen f3ildlm2rmnms;u0arenxo3iydlatrlnei;(  euoxrpnydlp   net (f 2rrxrpoo0opeomi3tyslaDumnmo;u0 rtomf tatoa eai o s)setmxo3iy4lptn iviat)a2umxm ;u1aex  ociyd aDra(vp;(4altoxo tatfpDe i slt trxmxmpiu1ap elneils  2tmuro;u0opxomietlt mDranvs;u) renmr oydlp rai i (0s2xr(mpio1opeelivtat s2rmx  ;u1tpeniictas s2ua( o u)tetoirciytlmDr uvolt srumxo no1am nmictas sDrruronu0aptn oetytlsDrluvpn(0arxrxr3tytla  aies;s srtrxmpnu1lleelicsl()a2umxm ot1tee  octasfm2el( pnt)texnxocoatlp eau s ( texrxr oudomtemfcsl()aDrrur oo0oeenifciadlmDuluvont4 leoxrcoy1faD lueilt)srto(mpio4apt lnvsat)a2trx o;u0oex mfeiasla rmnmp u0 exoir3iodfaDrlivi t0trumimpou1amee fei sf 2urx  nt1tltoif3ildlm2emu onu4aetrmf iodfm r n il(  rurxo3nodomt mieia()sDtr(rp;o1olxomi3ildlsDrm(msnt4 ltnxr iy1fa  ln o t0seurxm nudlp  micsat)a2rauroot1alen f3ild m rl(msnt0artrif3tydoatelu slt srtoimpoy4lmeemfeia( sDrrurooo4olxnmi3tadfm2em(vpnt4 lxnir oodlpt liei;t)trxr(o3iodom   nvils) rtmx pno0teeomieiatfsDua( p;()artnifctotoptraneols s2umxopiudlm nliviltf 2uax p;o1apx mieilt s ranmpnu0trerifcoytfp eau s;t  etoxm3iy1lmee fciatfsDuaxmp;o0tpxomf3tyt m uan p;u4altoifctytom eli i;t0setmxrpiu4ome mivsl()a2urxro;o1aexomfeilt s ra(vs (0teeoio3ootoa  an i;(  etrim3iu1aleemfciatfa2ur(ro;u1opeoiieild a2rm(vs t4alxomoctotomtrau sl(0seuo(o3iu1lp  lics tf Dumu  ;t0tex  ociltfa2ran o;t)altrmf3ta1fm  li s;(0srxr(m ny4ll e netasfs2tax  nt0aeeoio3ilsfs2ea(ms t0alxomrcty1fm   u i s  exrxo3oo4lm  lici s srrm( oou4alxomieias aDea(vo;(0aetrmoctotoptelneo;(0setm(r3oy4ol nlivs s sDrr(mpno1apeoio3iysfaDrlu pnt)alxomrcta1oat livol(  rtmxr ny1lp emfvsasfaDrru ooo4aee  oetas a rmuvs;u0aetnir oo1laDrlnvol(0 exmio3oo4ll emnetls)sDurur ;u4apxn feiat a umnms;t)aeeoxo3tatlmt luvsl( t2xoiopou4opeemfet tfaDurxront4opxomfetatlaDra(mo;t4teermr iadomtr neo;s  2tmio3io4ome mneiat  Drm(r nu1tlxn oeiadls ea( snu4trermr3ootfp e u i;s0 exmxr iu4lpeelfcias s2ua(m ;t0tpe  oeiytfa eluvo u0areoxrcoodomtelu o s0 2urxo3ny4ol n nvsas)arumxmoot1tpe mfetysfs2eln p () lxrmf3ta1fmD  u ils trtoir oy4amen fvsasf 2ua( oou1tpen ociytfm elnmp u0tlxnxo to1lp eanvs (0seuo(m oo4lmt  ivs (f 2umxrono4texnmoetltfs2elnvon(0tlxrio ia1laDeln o s0 2xrxm3iydop elnes t)a2tmxmono4opx mi3iytla2emn sn()artoirciatfmDe ieo s0t2tmio ny1apte fcs tfaDtmx ono0tlenif3tysfa2ranvsnt0treomf3oa1op e neols  eumxr nu1lpenmici ( srua(mpnt4aptnmf3iadfmDulums;(4 eenxoctadfmtrau o;s  2xo(r nudlpeemfcs t)srtaxronu4tlxoifciysla2rlums t)areoxo3ta1oaDrli s () rxrir3io4apenlfcsasfs2tr(r nt4oee mi3iatlaDum(mon()arxrxr3tydla   uesls0t2urxo3ny4optnlivt t a2tr(ront4ope mo3tlt s2uau p ()artnxf oo1lmte ues s srxm(o3iydoleemncta( arurumpnu0apeo o3tyt aDrau o () reoircoatfaDr n i t0 rxo(m3oy1oltemivt (f Drrx p;u1altnifeias s rmnms;t) etnif3tytfa rliei;()s2xmxr3iu1lltelfvi tf rururonu4oeto ieilt a umuvp;u4aetnmr3oatoa  lnes;(0srtm(rpiudopt  nctltf rtm(m oo0tex mi3tls s um( o;(0trxoio3iadlp raueols)setm(mpiu4ll emnci tfsrrr(  ;t1oeeomoeiys sDrauvpnu4texnio oodoatrlivo s)srtoimpiudlmenlneil(  rra(mono0teeo fctaslm2rmnvp;u0aeenmr3iatom   ueo;()trur(o oodapen ietasf rtm(r no4apxoif3tys a2ra(ms;(0 eermf3oy1fmt anvo;( t2trxopou1olt lfcias  rtmxm ;t1aee mo3tasla umnvsnt) etnxf iodomDr ieils  etm(r ny1ll  mnvsa( srurx  nu1oltnmf3tys aDulnvp;(4trtomr3oytop   nvol(0 etm(rpoodaltnlnet (fsDtaxrpnu4ole  f3tadfsDrm(mp u4aeenir oydopDrli slt)srxm(o oodoleemiviasfaDumu pnt0alxnmoeilt aDrm(vont0 eenxr tydfp rli ilt s2trim3oy4apen iet ( s2rmxrooo0oeeo iciyd aDrm( p (0aetnifcoo1lptr nes t s2xrim3iy1lpeelieil(f rtrxmono0apeniocilt m rluvs () eerxf oodop rlivs t0 rumxrpny1opte fvt () 2rau ont4olxn fciltfaDem(vp;(4trxrxr3tadoptr u s (0 2toirpoodal e fvtltf 2tmx o;o0aee mocildla ulumo;()artnxrcootoa rai o;( sexrir3oy4apeelfesa()sDurxmonu1tle iocilsfaDel(vp (0 etoiocoydopte nvs s0 euo(m oy4llt livil( sDuau ono1aleoiietyslm2uluvo;u4 etrxo3ta1opDr i o t)srxr(m iy1am emfeilt) 2tmxro;t0aet mi3tlt mDrauvo ()texnifctatlatelivslt0 2xo(r3oodal emivtasfaDtaum ou1ope  i3iatla2rm( ont0arxnir totoa rli o;s0s2to(m3oy4am  lnesa()s2urur nu1aet  ietytls2uan snt4 rxnmocoytfmDe u o (0trtrim iu1apeemfcta(f Dtr( oou0olen oetysfm2umnvs (0 rxnif3ia1lm   iei;s) exr(r3no1omtnmnet t sDurxr ;u0oltomf3ild mDel(von(4altnmr io1faDrlueil(0srxo(r io4lm   ictasf rrmu pot1tlt mo3iltls umuvp () exnxr3iadfatrln ols0 2xr(r nodape mncil(  Drmurp;o0altn oeiat s ulu pnu) etrxfciotfa elu olt) rxrxm3ou4oltelfeta()aDtmxrpno1openmi3ilt aDrmnvo ()tlxoif3totoaDelu i;s  rurio3oydol emictas)arrmumpnu1altniieiadfm emuvp;u) rtoirciy1opt aieolt trtr(m3oo1llt mnvias) 2rm( pno0oee  ieiat a rmnmpnt0teeomocoa1lmDe n o t  rurim3nydllee ics t) ruaxmpnt0oetomfciys s2um(vo (0 eenio to1oat auei;s0texo(mpoodopeemnct t aDrmum no4tlxomf3iyd s umn sn(4trtrifctodopD ln s s  ruoxm nydop nmnvtlt) rtmxmpou1texomoetytls2ulnvsnt0tlxnmociadfatrli i;s)setoir3ny4opt mfvtltf ruaurp;o4olt mf3tatfs2uaump;(4aexoxf ta1lmD  i o;s setrxm3oo1omen fci t)aDtm(r ou1apenioeilslm2uluvp u4 ltoxocoo1fa rluei;s texrim3iydlpt  net s s2rm(  ;t1ape if3iasfs2emu o t)aexoxoctodopDeli sls  2xoio3io4ale lneta(  rrm(rpot4tpeo f3ildlm2uaumo;(0tltriociotfmDeli o t teuoir3iu1lmenmfes s)a2ua(m ;u0teeoifciytls uanvont4treoxo oa1fm e uvo;s  eur(opiu4ole lictlt aruru o;t0aptnii3ilt m um(mo u0 rxrircta1oa ean i;t0seto(r ou4omen nesls s2rrx o;u1tpxnmietas sDrm(mpnu)texnif3tytfm   u s;t0sexo(r3iydap e nesat)a2raxm ;u4tleo fetytls eanmpnt4tetomr3tadla eluvo ( s2uriopny1omt  nci t  rumx ooo4tlxoioctytfa2elu snu4tlermrcootlpt livsl( tetm(mpoo4ll n nei t)arrruronu4tlxoifeiyt a rln o;u4aetnmrcoodoa  lu ol( setrio oydlpt lfvi () 2rrxrpno1aeeoioetydla rln o;t4 lenmrcty1faD an s;t)trur(rpoo4olee fei ()srumur nu0oeenio3iasfsDelumsnt4 rtoxf oatlmDr n sl(0texr(rpoy1lltn nvilt)srurx oot0apx ifeildla2rm( on(0aexrmfctodopDeln i t)setoxm nu4altn ici sfaDtax ooo1tex  o3tlt s2rm( p;t0altnxr tadomDe ieol(0srtmiopiu4ome lnesls  rumumpnu0alxo octldfaDrlumsnu0 etomf3tytfatraueo;s s2xr(rpio4ap emnvi t  2uru p;t1oexomieiadla2ea(vp ()arxrxr3oy1fa eaueo t0srxm(o oo4llt  neil( srtmxmono1tleomi3ildlmDemnmp t4trenif3iatop rlnes (0 euoxr oo4altnmneilt arta(mo;u4tpe iieiad m uau p (4 etnxrcoadfmD ln s;( t2uo(o3no1lp nlicsatfs2umumooo0altniictls s uauvo u)tltoir3oadlmDe ivils srxm(m io1lm nmfeil()aDrmuroou4altnmf3tasfm2um( o;t0altnifcoo1fpDe n sls0trtmimpnydlp elnvtas a2umxm ou4aeto i3iysfsDrlu on(0 eerxr3oodlptrln slt)srtm(m oy1oltn icsl(f Drrur ;t0tet mf3iysls uln o u4tltnifciy1fpD aivs;t) rxo(m3io1opt mfet t  rtr(mpnt0apx iicildls emums;() exoiocoatfpteaivslt) 2xo(o3oy1ll emics s) Drrumpnu0tptnioetytlmDrl(vs u) lxrxf ootoatr nes;(0t2xo(m no4oltn fcsl() Drr(r oo4tptoiietydlm2eanmp ()tlenxo3ty1fm  lnei;s0setoxr3iy1llt mfet (f Dumx poo4oex iieilt a2umumpn(4areomo3oy1lat ln ol( trxoxr ou1alt  fesatfsrtaxm ot1oex ii3tyslm emn o;t)arxoio3oydfp  lueo;s)setm(mpno4omen ivtlsf rraurpnt0tet mieilsfs emnmo;(4artoxf3tatfp eau s t setrxmpny1am   ivs t  rtm(  nu4tpeo octltfaDrmn o u4altoxrciotlp eau s;s)trxrxm3nodalt  ivi (f rraxr ;u4tetnifeiyd m rluvp u)artnircio1oa  auvo t  2toxo3no1op   icia()srta(  no0aex iieias aDul(vp (0trxnxo3totfpDrauvi t)sexmirpiodole livsatfaDrmxmo;t0oleo i3iytls emump;(4areoxf iotop e nvs;t0sruo(m oo1ope  nvs s)sDrrx  nu4tpto oeilt sDrln pn()teeoir3iytfatranei t)t2umxm io4ame mfcilt) 2taurpnt4tlt  ictad sDuauvp;(4 etrir oatfp rli ils)seum(o iodlpenliesa(fsrtmu  ;o0tpeomf3ias aDulnvo t4teenxfctadfa raivo;s0sexmxopiu4lme mfetl()srtr(mo;u4oeen icildlm2ea(mp (0trxoiocio1la e u sls)t2urim3nudole  ncsat  Drrxroot0optomoeiad a rln pn(0tltnmrciy1lpD  n sls)s2tr(m nydalenlnctat) Dta(rpnu4opxoiociatfaDra(vpnu0 etoif3oodopD  ivs;t0s2xr(r ou4am  mfcs () 2raxronu0apto i3tls sDrl(mo t4 exnif iatla eau o;(  rtr(rpiu1alenmfetl( aDra(mpnu4aee ii3tas aDrlu snu4 eenmo3ootla eanes;t0 etrirpno1om e ivtl(faDtm(m nt4aptomi3iys mDrmump ()tlermf oo1oa  lnvi;t0srtoxo3iu4ll   ieil(f 2umum nt0opeomiciasls2rlump;t)teeniocoa1oat aiei;()trxrim no4op nlnvia() Dtr(  ot0optomf3tltfm2uluvs u0tlxnmo3ty1faD anei;t0 rxrxrpoy1ame mfetls aDrmuro;u4tle  i3tatfa ulnvp;()tltoxf ia1lpt auvols)setrxm3nudlleelfciat  2ur(ro;t4tpx mo3iat sDuanvo t) eenmrciy1oa  aivs t trtrxm3nydlmt mnvtls a2rm(roou0aeeomietytfa2um( p;u)aexrio3io1lp eai s;t  rto(opiu1am eliei ( arraurpoo1oet  i3ildfa2rmn o;u)tltrxf3tatlm r ivi t  2tmxr3iydomeelfvtls arrrxm ;u0aexo f3ils s emuvp;t4 rermfctydomtrau o t)t2uoir3nu4opte ici ()aDumx o;o0teen f3tld aDrln o;(4texnio3iadlmDelu slt) 2umxrpnydlme  ncsas)sDtmx p;t4olxn feiydls2ua(von() ltnxf oadfpteauvol(0trxo(o ny4open fetl(  2ra(r ;u4alx ifctld m raumpnu)trxoif3oytla   u s s0trtmim3iodlmtemivsas)aDtax pnt0opeo o3iasla rluvp u)aeenifctydoaDeanvo t  2tmxo oo1lp e ivtltf 2tm(r ;o1tlxoioetls m rm(mpn(0teeoir3iy1fp rln sls0 rxoir3oo4lltelfvta(  rtrurp;o4apeoiictadla2ul(mo;(0areoio3iytom eau o;(0s2tmxo oy4omtn ncia( sDtrxmpno4texn ictaslaDemuvsn(0 rtoif3oy1lp e nvil() rumxo oy1lmte fetlt)s2umxmoou1tleniiciat m2rln sn(4alxrxocoy1fp eanvi (0 rxmxr ny1lpt lfcsl() 2tm( p;t1olxnio3ildlm2rln pnt4 rtoxrcoydlmtrauesl( seuo(o iodopeelncilt aDrrxro;t0alxnmf3iytla rm(msnu0aetnmf iotoaDean sl(0srtmirpno4llen fcs s sDtr(root0texnmietlsfs2emuvsnu0 reoif3to1lat  u o s setmirpno1lp emivtls s2rr(mpot4teto ictatlm rau p;()trxrmf oo1lmte nvs t0setmxrpiodalenlies t aDraxmp;t1apenmietltlsDrmumo t0arermr to1lat lnvols seuoxm3ny1ame  ncilt  Drau pno1tlxnifetas a2ra(mpnu0 leoifcoytlm raneo;t)setoxr3oy1lmtelnes s) rurur oo1altn oetlt m2emnmon(4altnxfciatlmtelivi;t  rxoxm3nu1amt lfvt s  Dtm(r oo0optnii3iltla2rlumsnu0 etrxr totlmt luvolt)seurxrpno4open neils)a2rmxmonu4tlenmfctas aDumnmp u4 eeoir3tatfp raues (0 2umxopny4apenlfcsl(fs2uaxm nt1oexomfctlslsDumuvo;()teenmociatfat auvo;t) 2urxr ny1omtnmivi tf rta( pou1tetniiciysfsDeanmpnt0artrmrcoo1lmtrlu s t sruoir3oydol   fcil() Dtmxmpou1tpeomo3iytlsDrau o t)alenxf oa1fmDrlneolt  2toimpio4altnmnctatfs2rau  nt4aee  oeiadlm2elu snu0 rxrmo ty1op eli ol( teum(rpno4openmncs sfsDuaxro;o0tlx  oetltlaDrluvp (4tlxrmocia1lp e ivsl()s2umim3nodlme lnci ()sDum(rooo4alxnmo3iytfa2rln s;()alermo oo1fp r uvi;s setr(m3ou1ole lnvtlsfa2umxrpnu0opxnifeiys mDrlnvs u0alxrmr3to1lat  u ols teumxo3oy4lptelivtat)srurx  oo1tpxniociyt mDum( s;t0 rtrxo3oo1oateluesl( trxriopoodal  mncs t)aDtru p;o1apxnmictydls rl(vs;()alerxr3iydopD anes;t)s2um(m nydoltemics tfsrrrxmo;o4alt ifeiltlm rln on()artrmf3oo1lpD liei t)teurxmpoy1ameemnvsls srurxm ot0teen fcild m2el(mo;(4trerxrctydlpDeau ilt)s2tmxr3nydlm  mieil( s2ta(rp;u0apeomoeiat s emuvpn(4 eenmr tatomDrau ils0 exrxr3ou4ll   ivt t) 2urumooo1tpxn fciytfs rm(vp;t0aeeomo3oydom elieilt srxrxopiodapen ieslt)a2tmum nt1opeo o3tytfs2rmnvp;(4treomr3iydfp  aiei t)t2urxo3iydaptn ncias)srtaurp;u0oeto f3ias mDrmnvpnt) etrxo ty1op  lnesls t2tm(rpnu1om emfvtl(fsruax  nt0aeen i3iydls2umu p;t)artniocootomDe uvs ( s2xoir3oo4omtelicslt srra( pnu4tlx miciadfa rlu o;u0tleomrciadla rauvs t t2uoiopoydlm nlfcia()aDuax  oo0aexoiietatfm uanmp (0trtrmoctadfmtelu s;s0 rumir no1op elivsat a2ra(ront0olx ifciyslaDuluvs u0 rxrxf3tydlptr uei;t0srxoirpiy4lmee fvsl()srumx pot0tetomfeiyslaDuluvo (0aexrmo3oo1omteau o () 2xoirpio4apt lnvtasfaDtmxro;u0alenmieiltls rlnvont0 rtnif oodfa  lueo;s0t2xmirpnydape mies tf rtru p;u4aetnif3ildlm ua(vs;(0 rtnir3io1opDeauvilt)sexoiopoo1al elictlt aDur(m ;o1alto ieiat m2eanmp;(4 rxnmf iodomt luvolt trxoxrpou4op  mfvt (  rrr( pot4tet iicildfm elnms;() rerio3oa1omDrai i;(0trur(rpou1amt mnviltfsrta(  ;u0ole io3iltfs uan o u)altoxoctytomD ln ilt0s2xr(rpio1amtn nvils)sDraxmpnt0teeomo3tadls2rmumpnu)trenmocto1latr ueilt)texoxm oo1am nlfct s)aDrru p;o0openio3iadlm2umnms t)teeomr3iy1fmDrlneo;t sruo(r iy1ll nmiesls srumur ou1aex mictls aDelums t0trxrmfciodom e nvo;(0s2tr(mpno4am nlfeta(  rraxrpot4ole  feild m eanvo;(0aexnif to1faDrau o s)trxm(m3io4lp n nvsatf 2rm( pou0teeo ictat sDuanmpnu0 eeomfcta1faDeau s t0 etrimpoudlm nlfvilsfa2tauro;u1apx mieild s2el(mp (4 lxoif3tatlmt anvsl(0truo(r3iu1op   ncsltfarrrxmo;o4alt iociydls2umnvp;u0arxoxfcoytlaDeauvs s)s2xoxm3oo1lme lfes (  2uaxroou4apt ifeiat s2emu snt4 etoircoatom e ies s0s2urim oy1olt  fvsa( srrmxmpnu1opeomoeiltla2elnmo;u4 lxoir tytla e i ols0s2urxm3nudop n nvsas sDururpou4tptn o3tasfa2em( o;(4trtrifcoo1opDeaieo;()t2tr(o no1openmivi sfs2rr(mpou0tle ifciaslsDulu s;t0trtoio3oadlp   u i;( srxrio oydamtelfesas) 2trxmoou1apeomi3ilsfs2rlnmo (4 rtnio tatfmtean s s  rtriopiu4aleelicias)aDtrumoot0tlt  i3ildfmDrluvs u4 etrif iotomDeln o s0t2uoxopoydopenmivtltf ruax 
\ No newline at end of file
@@ -0,0 +1 @@
+neo;s)t2xmim3nu1ll n nci ( sDtrur ou4aexo icilslsDrauvs u)teeoirciy1latrlivs;t)texo(o nydolenmfet (fa2umx  nt0ape ii3iyt mDrmnmp u4artnxr oatoateanei t)srxrimpiy1amenmfcs t)s2umum nt1apxniictltlsDemu s;() eeomf3totoa e u i t sexoxr iy4llen iesltf 2rm(monu1tptomoeiasla2rl(vs t4trxnxf oa1oat ai o (  exm(o oo1ol n ict ( sDraur oo1ape  oeiytls2rluvo (0 etomr3iadopDeli o;t t2to(m oodlpe mieiatf rtm(monu0oeto i3ias m2rl( pnt4artrxrcia1la r ieils0 eumxopoo4ale miviat srurump;o1tlt  oetlt s2emu s t4artnxr3ty1late nes ()s2uoim3no1ol e feslt  2ta(mpnt4opxnmociydlm rauvsnt) etnmf iatomDeauei;s0t2umir oy4op   ieiat)arua( o;u4olen feild a umuvsnu4 lxomrciotfptelivol( sruo(o nydap  livta(f 2ra(r no0optn iciaslaDelu pnt0trenmo iy1lmDrlies;s tetrxm3iy1omeemicsls)aDrr(rpoo0oetoioeild sDeanmp (4 rxoxf3iy1fat auei t)t2trxo iu4ome micsasf Drmx ono0apenmi3iydfm2rl( snt)tltoir3tatfm   ueols sruo(o3ou4lmte ncsas  Dtm( pnu0alxnifcilsls2ranmo;(0 lermo3iytfatelieol( srxoxo iudopen nesltfs2trxrpnu4alx  i3iadfa elnms () eerxfcoadlp   neol(0 etrxm iu4lptnmnvia(fs2ta(mp;t4tpt io3ilsfs uauvs () exoxo3oadomD lies () rxoxmpio4omte ivi ()arurx  ;u4apeoifetydfa2rlums;(0 lxnio to1lmDraneslt)srtriopno1optn icslsfsrum(r nu1aetoio3iadlm2emnmpnt)teerxf ta1fpDelivsls) 2umiopiudap nlnctatfarumxmp;o0apx io3iyslsDul(vsnu4 rxrircty1oaD auvslt)sexmio oo4llt mfvia() Dua(m no1ale  o3iydla rmu snt0alxnio iy1lat  nei t0teto(o no1lpenmietlt sDua( ont1aetniictadfsDemn s;(4aexoifciatfateauvilt) eumxrpoodlpenmnvta(farumxrpou0alx io3tld a em(vpnu4trtrxo3iy1fm e nvi;s setr(rpnu1ole  icilt)artaur ou4apx  o3tldfa2uluvpnu0 leoio3totoa   u olt) 2xm(r3no1optelneia( a2tru  ;t1aeeoioetad s ranvpnu4 reoxr oytfmD  i i t0teurir iu4aptnmfct sfaDua(ro;t0tpxoii3tldls umu ont0trxnxr tatopDeln i;s srxoxrpiudaptnmfvils)a2rau ono4olx  oeiydfm2rmn p;t4tltrmr todop  lu ilt)tetr(r oodlpe  ncsasf 2rm(moou0teenmiciadlm2emu s;() etoircto1oatraivo s  2xm(r iudam nlivils)a2trum oo1aeenmoetys s emnmpnt)artnio3iadlaDeli o s)t2xmio3iudlme mfci sf Drr(roou4opx iieiydfa ra(vp t)alxoio tydoptraies (0 exmxm no4am  mfesls)a2raxm oo4ope mfeildfs2rmnvsn()tetnxocootlaDeli i;s0 etoxmpoy1lp  lfciat a2tmu pno1tee  o3tldfaDelnvo t4 rxnir iodfp raies s seur(m oy4amt mnvtls  Draumpoo0apx  ociasls rlnms;(4artrio3tytoaDrlivo t0srtoio3no4lp emnci () 2urur ot1oet ioctlslm rlnmon(4alerif3oydfptraiesls0 2toio oo1ll emieia(fartm(r ;o0oee mfeilsfm umumo t)teenioctotfmDr ivs;()texoxr3oy4am   iesasf rtaxrooo4oltnmo3tltla2el(vo;t0trerxf3iotomDrlu o s) 2xrxo ou1altnmnvtas  2ur( pnu0oex mfeiydla2eaump t4alxoio3totfm ranei;()t2xmio nu1amtelfvtas)arua(ronu0apenmfeildfaDrlump t4 lxoio3iadfa r n slt) 2to(opio1om  mieta(fsrtr(monu1tetoiociydlaDua(mpnt4trxnmo tytfpDran ils0trtrio3iydape mivias sDra(r no0tlx moctldlmDrmuvo (0 lxrmrctadfm r u o ( s2xrir oo4optnlnviasfaDrau pou1alt mocilslmDel(vp;(4alxoifcoydomt  nei t0 2toxmpno1apt mnesls artaxrpou1olxomfcildfa rmu p;(0 rtrmr oytoa eai i;s seum(rpoudom  mfvi s sDrrxrpou0tltnmietatls um( s u4tlxnif iadla   ieo;s s2toiopnydlmte nvta()srrmur ot0ope io3iatfm elu p t)texoif3tadla   i s;()s2trxmpnydaptelncsltfa2raxmp;u4teeomociatlm ranvp (4texnxr3ootla  au s;s0trur(m iu1om  liei s)arrr(mo;u1ole  icilsfaDel( o t0aetoxocoytlatr n s s teur(m3oo4am e ieil()sDtmu oot0alxnmfctlsfmDemumsnu0 rxnifciytfmtraiei;s texmir io4omee nctas) rtmuront1tlx  ociadlm2ranvo;u4 etrir oatfp rai s;s0t2xo(o3nydapenlnci s)sDumxr ot1apx ifeiadfm uanmpnu0trenio iodop rluvi ( trtm(o3io1omeelfctat)sDtrx onu1ape moeils a uln p;() exomfcia1fmt ln o s sexm(rpiy1omtnlnesat)a2trxr nu1alenmociadlmDrluvpn(0trtoxfcoadlpDeaneslt0 2to(r3iudapen fes t)sDtrurp;t1tlenmfcilsfs2rluvont4tleoxo3oo1lmtr uei;()teuoirpoudolen iei (fsrrmx ono4teenioetadls el( o u0 lenxrcoy1opDrlneolt0tetmxr3iy4amenmfci (  2trxmpot4tpt mfeiyd s2eln p u)trxrxr3oodfptr ieilt s2urim nu1al nlici s  Durx  ;o1tptnifeiatlm rmnms;t4alerxf tatopDelnvo t  euo(o no1lm   fvia( sDrm(ro;u0oexn i3iatla2eanmo;t0 eenmocoodfm raneilt0trtoirpoodapee ictltfa2uaxm ;t4tee  ocias m rauvs;(0alxrxr totfm e i o s  exo(r3io1lmeelicsas sruax pno4ale iociadlmDrlnvp u0aetrio oy1laD  ivi;t0t2uo(m3oodop  lnvsas sDtrx  ;t1oeenio3ild aDra( o (0aleomo to1oat li ils)setoxm iydapt  fvtat  2rr(  ou1texoii3iatls2ra(vo ()trxnir iodlmt lueil(0t2xo(r3ou1apt  ici t  2tr(rooo0tpxnmiciysfs ulu snu0 exnmfcto1laDr uvils)srxrxrpnodlpt  fes tf rraxm ;o1apeoiictltlm2rl(vp t0aeenifciodomteli olt  exrimpny4lm  mies sf rrmxroou0oeenmoctyt mDel(ms;u4trtrir3tytla   uvolt) eur(mpoudam e net sf 2tax  ;o4opeo ocildls2emn p u0 eeriocto1faDe nes ()t2uo(opou4al emfct t a2rau o;u1oetnioetls m el(msnu0trxoxr3iatlateln s;t  rxr(opno1omtnmieta() 2raum ;o0alxo o3iydfm2uan p t)aexnif iatlp eluvi;(0t2to(r3iu1ol  lfvsat)aDumx pou1tptnif3tytlsDrl(vsnu0texoiocto1fa rai slt0 etr(m nu1lleelfeslt) rrrx o;u4teeoioeiasfs ean pnt4 leoifctodla r n s s0 rxo(m nydol  lfvt s aDtm(mpot0tet ii3iadfs2emuvs;u) rtoxf3tatfmtraivi;t  2tmxo oy4am n nvil(  Dumxm ou0teeomfctadlm rl(ms;u4aexrmoctydoa eauvi;t)t2uoxr io4ll n ics s  Durxm no0ale mo3iaslm em(vs;t4 lermr3ty1lm r ivo;s  rxmiopoodalenlivtl(fsDrr(rono4aexnifeiatlmDuan on()texrifctodfmDrluei () 2tr(m io1olee neia()s2tr(mpno0tpt  ieiyd s2eluvs;t0 lxnio oy1fp rlieo ( trxrxo nu1al emnvt tf 2urxrpnt0aleoio3tatlm2rm(vsnu)aetnmfcoadlp rau sls0srto(r ou1lpt  fcs (fsDrm(m ot1texoifciaslm2rmu s u0 lxrir oydfaD li s;s)sexrxmpoy4ole lfctltf 2rru p;t4olto i3ildfaDrlu o;t4alxnio3tytoptrlivs;( teuoxr3iu1aptnlfesls)s2tau  oo0oexomoetld a2el( pnu4 ltrmrctatlpDrli o;s) rtmir3io4lp n fcsls)sDtaxmo;u4tetomf3ilslsDumn s;()artrmociy1fa raneils0 etmxm oo1amt mnet sf Drmu ont4alxnio3iasls eluvs t4aetrir3tytlmDeanvslt0s2urirpno1apen ietltfs2tax p;o4tpt mo3ildls emnmpnu4artnxrcty1omDeaivo t)trtoxmpiy4apt mfcsltfa2trumont4opeo o3ildls ulu on(0 etomociytlmtraieo s0trxoxm no4amenmfvsat  rrru poo0ope  feiadla2rmums;t)tltrxr3oytlaDrli ol(0texoxm nydlleemiviat) Dua(  ot4openmi3iad s2umuvs;u4aeeomoctadfatr i o;t) 2xrim3oo4ope mict sfsDum(rooo0olenmi3iadlm2el( p u0 rxrircio1oaDeaneo;s)srto(mpoo1ap nmicils) rrmur ;o1oeenmiciatlaDelu s;(0trtoifctodfm rauvi (0t2uoiopio1lp nliesl() rrax onu4tlenmociyt a2rl( o;t4tlenmf totfp rau s;t)t2toim3oy1lltelnci (fsrtaxmont1aee  i3iad s2umnvo;(4artrmoctodfptranvs;s0srxm(m iodll emncsltfs2rrxro;t4oetn fciltfmDelumo () ltrmr3iytoaDr u o t0t2um(m3iy4lpe lfvtl( a2tru p;o1ale  fctydfs rl(mon(4arxnxrciydlp   u sls0s2xo(m3no1olen fesat  ruax ooo1oeeo o3tat m2ra(vonu4alxnioctodoateanvi;( seuoxrpnodomtnmnvsatfaDta(ro;t4olx  i3tlsfs2eluvo;(4tetrio iotfmD luvolt0texo(mpnudam n ivsl(fs2tmu  no1oeen ociltls2ulnvsn(4aeenio3to1opD  uei;s)teto(mpoy1amt  ictl(f 2urx pnt1apxnifcildlmDrm(vs;() rtrif iodlatr ivilt) etrio ou1lmtnmics t sDrrumo;u0alt ioeiat s rlums;t)treoxf3tytopDr ues s0 2ur(o3iu1lmte neiatf Dtau  no0apxniictldls ulu o t)teeriocoytoa   nvilt  etoxmpnydolenlieiat)arrrum ;t0tleo i3ild mDulnmo;u) exnirciadoa eaueo;(0texoim3iodom elieilt)a2umur ot0tpxoiociatlm rlnvp;u4tleoif tadfaD an o t0trtmxmpiydllenmiviatf rur( p;o4alen ieils sDrm(mp (4texoifcoodlaDrlueil( teumir3no1aleelnesat)aDururo;o0opt moeildfmDeanvo u4 rxnio3todlmt livolt0 2xmxmpnodlpe miei t s2umu pou1tpeo icild a2rl(von(0texnmfcoadlateli i (0t2xrxo nu4omtnmivslt aruau pou0olx mo3ils s2rlnmpnu0trerif3oo1la   ivi s  rxrxo3iudlpe  ics tf Dtaumpot1oetoii3ilsfm2ra( on(0arerxocto1lmte ues;s  rxrim3iy4apeemnvt ( artax  ot4tee ifctaslmDrln o;u0trtoxo3totfaDe ivslt s2urio3iydamee ict t  2urxm ;o0aeen f3ildla ua(mo;u)aexomf3ta1optr n s s) 2xriopou4lptnlfvias aDrmumo;o0tlxo fciytls2em( o;t0aleomrciy1oa r i olt0srtmir3nydllte nvta(fs2taxmp;t0alto ictldla elumo;(0aleoxo3oy1fm r ivo;s) 2ur(o iy4lpeemnvs s) Dtaxrono0olt ii3ild a ra( p;()trxnmrcio1oa  anvolt)tetrirpiodamtnlfeias) Drrumo;o1optniiciltls2umnvsn(0 ltnxo ootoa e nvs;s)seuoxo3ny4ameemfct s)a2ur(mp;o4apx mi3tldfs2ulu o u0 rtoif3oatlmtelivi;t0 2umxr3iy4ale lneia( srrm(r nu4altoii3iyd s2rlumont0 exrif3totlat lnei;t)sexm(m3oudapt lfcta( aDtm(m no0opx ifciadla eluvo;(4 ltnio3oydoatelivi t tetm(m3iu4omtnlnctltfaDtmump;o0oleoiictydlm eluvo u0trermr iatlpt aneo t)t2xoxm iodlltemfesa( a2ta(r ;t4alt  fctltls emu o (0tetrmf tadoa  luvol()tetoirpoy4lmenlfetltfs2tr(mp;t4tltn ociaslsDelu on(0 eeomfcoytoat  nvo;t)t2uoiopiodopenmivt ()aDtrur ot0tpxniicilt a2emnmpnt4 lxnxociadop rau olt)s2xoiopiodlm  licsas) rur(root4apxn o3iytfm emu sn() etnxfctatopDr uvi (0 exo(o3iy1lp  livia( a2rmu  ;u1oltnmoeiasfmDrln s;t0aetrifcoytoa ran il(0teuo(o3no1amtelnei t aDtmu  ou4alxnmociyt aDuanms t4teenxrcty1fmD au ol(0 2tmir3ou1lpeelfcia(f Duau  ot1aexo i3tlsfm elu on()artomocoadlmtr u i;s)t2urir3ou4amtelnvsa(fsruaxmpoo1apt mieildlaDelu snu) etrif ty1lptelu s;s  euo(rpoudap   feia(faDtmx  ;u0apenmictydfa2em( pnt4alxnif3io1fpDrlu s;t) 2xoxm3ny1amtnlicslt) Dtm(mp;o0altn o3iyt mDulnvs u)aetnmr3oatfa r nvil( t2toiopny4lmen fvsls)sDtr( ooo0oee  ietltlmDum(vonu4aleoio iatlp  an o ()s2trir iy4lpen nesltfs2uaum no1tlxoioetas m2rmn s u) exnxociydlaDeaies;( trumio3nu4apt mnctasf rtrxroot4oet io3tatlsDua(mpnt4trxnxr oo1lp elueslt) ruoio3io1lm n icilt)srurxmono1opto i3ilt mDrlu s;u)teerxr3oodfp rluvi;s0seumxm oudaptnmiet sfaruau onu4tetomfeiydfmDea(mpnt0texrxrciadlmDr n s s texo(rpiodop emfcil(f Drm(r ot4tptniieiytfaDemnmo;u)tltomf oodfa r uvi t)texm(o3ny1am  mncta()a2urxr nt0teto ocild s2uanmonu0teerifcoy1laDr i sls t2urxr no1oltemncsatfsDtr(monu0aexnii3ilslsDrau p;t0 eeoxr oytlmtrluvo;(0 etr(m nodaptelnvtasf 2trx  nu0tpe  o3tydfs2emumo;u4 lenir3iadlmDr n s s srxm(mpoo1om nlivta(farraxrpot1olenio3ias aDeanmonu0teerxfctydlp  luvo;(  etmir3nu1amtelnei (  rra(mpnu0oexn fciltlaDrlnms;u)aetnmo iotlm e nvi () 2triopnu1lmenmiciatfa2ua(rooo4alx mictydlm2umn o u0 eerxo todom ean s;s)trum(m iu4lp elieias) rtmur ;t1apeniocias a2rm(vp;(4tetrmo3iydlpt luvsl(0t2uoxo3oodlltemfviltf rtru p;t1aexniociltlsDrl( s (0tetoxo3iodop elnvi t)srum(m3ny1lpenmnvi t s2rrx  oo4aet  oeilsfaDrl(mo u0artomf ty1laD auvo ()teuoxmpnu4ol emncs s)aDrm(m no0optniietyt a rln on(4teenxfcoa1lp eli il() rxo(o iy1optemncsas) 2tm(rpoo0oex  ietls mDrmuvp;(0tltrmfcoatfp e u s t setm(r iy1oltn ietl(f Drmxm oo4tltn ictlt aDemumpnt0aetomr3totomtrlneilt)sexoxmpnu1ll nlivi s)a2tm(  oo4alx iietldfs ul(mp;u)tetoir iadoateanei;t0t2xrir3iu4ame  nesatf Dta(mpnt4oetnioeiydlsDelnms t4aexnxo totom  anei s0seumxm3ou1ll  lfvil() rrr(ronu0tpenmfeias aDeanvsnu4tetoir io1fp raneilt)s2umxo3io1ll  lfvia( s2rrumo;o4tlxnmoetytfaDumums (0 renxo iy1lp raies ( trxmirpnudol elneil(  Drmuro;o4olenifciys s2umump (0artnifciodoptean ols0texr(m no1om emneiltf Drmuro;t1tpxnii3ilslsDua( o (4areoxo io1la  li o;s) euoxr3ny1omtnlics tfaDtmxmpnu4optnmocildfmDel( o t)aeeoio iytfm  au o;(0s2xrxm3oo4olte fet s) 2urx pnu1aex mo3iltlaDumumon(4 rxrxoctatla raueo;()srtr(o io1opt lneils aDuaurpno4tpxnmictydfs2rmums;(4aetrir oy1opt aieslt trto(mpoodlmenlivt s) rtaxr ot1tptn oeiyt sDrlnvo u0 rtriocootfm elivo;t teumxr3ny4apeelici ( arraump;o1aex iietyslaDeauvpnt0 rtoif3oadoptrluvo;(0t2tm(o3nudomt  netat) rrr(m no4apx ii3iadfa2ulnmonu4aeerio3to1opDeaieo t0 exrir3iydapee nctatf rrmxrpnt1tpt iiciad s umnvs;u0aexoif3tydlmDraivs;(0srurxo oo4opt  nctat sDrau  no0tltnmfcilt m uanvp;() ltrxf iadfp eli slt)s2tmim3oudopeemieils) rurx pnu0alto ietlt s2ea(vs;(0aleoxoctodlmDe uvi t)texm(o oo4opt  nvsltfaDraump;u4oleoio3iaslaDumu s;u4aetnio3oydfaDrln o;()srtmimpiudoptemics sf 2umurooo0tltoif3iysla2em( s u0 lenio iadlaD lueo t)t2tm(rpno4llte nvt s aDuauro;u1tle mf3ilsfm rl(vp t) ltoif3iy1latr ueo;s srtmir ou1olee fvta(fsDrmxmp;o0olxoioetad sDrm(ms u0altoxf3tatlaDraiesls)truoxm3nudope mieilsfa2umxmp;o0optn feiltfsDrln p;t4aetrxr oodfpt au il(0 etrio3io1altnmivsl() 2urxro;u4opxniociyslm ra(mp t0artnmfcoydoatelueo;t0s2xm(m3oydllt livta( srtm(r ;o0tlx mieiytlm el(msnu)aeenir3iy1oaD lnvi ()teum(mpoo1optnmfct s)srrr(mp;u4tpto iciatla2umuvs;u0 reoir3iy1lpt  ies s)teum(opiu4lpt mfcilt  rur( o;o0ape ii3iysfm rauvonu0 rerif3iy1lpte n o s0setmim iydop  lfvtls)a2ururpno0tlxnifeildla el(ms;t4tlenxr3todlpt  nvi ( seum(r io4ame lnvias s2raum ;t0tpt io3ildla2raumo t)alxrirciytom rluvi (0srto(o3iu4lptnlfeiat)s2ra(mpou4olxnmfcilt sDumu o t4tltoiocoo1lm   u i;() etr(rpnu4apt lneta( s2rr(rpou1oetniiciat s2rmn pnt)tltnmrcoodopDranei s  rtr(r ny4lleelies sfa2um(  nu0olen o3tydla2ra( snu)aetomf3oo1omDe ivi;t)trtoxm3iydlpt  ici t)a2um( o;t0oltn f3iadfm2um(vp;() etrxocootfmt livsls)s2to(r3iy1lm emfcil( s2rau poo4texniocilsfaDuau s u4 lxoxo3oadfm eaueo;s0sexrxm oydap   ict () 2rmxrooo4ale  fciad a rm( p () renmf3oadoateauvs;t0 2uoiopnydal nlnes s srtmur ;t4apeoio3iyslsDemn o;u0tlxrif3iy1op rluei t)s2uoxrpio4lmenlnct t)arta( o;u0altomfctldfs2elums u0 eenxo3iytfm elnvo (0 etoirpiy1optnlfctl(  2tmu p;u1apx mo3iltfm rmn s (0 lxnifcoadopteai o;s)t2xm(o3ny1omeelfcia(faDuaur oo4olenmoetlsfm2emnmo;u0 ltoif iytomtelieo s0trur(mpny1lpenmfcs t aDtm(  ;o0oetoifeilsfm rl(mp u)aetoxr3ta1omtraivi (0srtrim3iodopeelfvsa( aDrrxr nt4tptn iciltfmDemnvonu) exnxf to1fatrau sls teur(o3nu1ll elfcsl()aDumumo;o0ole ifeiltfs2ul( o ()trtoir oatopt luei s seumim3io4apt liesl()sDraxmo;t4olxn ieiadfs raump ()arxrmr3iatopt lnei ( srxmxmpio4optnmfvi t)a2ua(m ;u1oeto fciltlaDranmo;t4artomocoo1lm eaneolt) etrxr oydop e ivi ( s2tmurono1tlt mictlsls umnvpnt4aeerir3oo1fmD aneo;( texoirpiydalt livs tfs2ur( oot0aee iiciyt sDra(mont)tleoif totfmt aieslt  2tmir oudlm   fvt t)srra(moou4aex ii3tls sDra( onu4 rtomo3oadoatraueil()trumxm3oo4ome  nesas)srtmx  ou1alxn f3tysfa2uln p (4aeerif3ty1opDr ivol(0trtmxo oydlpt  ivtas a2taumonu0altoifeiys sDum( s ()aetnio3ia1opD lieo t)srtm(opny1llenlneslsf 2ua(mpnt4oee moctydls uln s;u)arxnmrcoytfp  aiei t)trtrxo iu1am emfes s aDtm(mp;o4aetnmf3tas a2rauvs (0 exnio iydlaD li i;t) 2umxo3iydapeemiviatfartrxronu0aee mietyd m2uluvp;(0 exrxr oo1fp rli o t s2uoirpno4op e nesl(fa2ur( ont4ope mf3iaslm2ranms;u)trtomo3oytfm  aies;t)seurxopiu1om emfcia(fa2tmxmoou4tpxoiiciyt mDrluvs (4trenmrcta1fp ranei;s0seuo(r ny1ll  liei ( artrumpnt0olenif3tat m rl( p () rtrmf oodoaDr nvs s) euoxm3io4ol e fes t)sDtaur ;u4tpenio3ilsfm ul(mo;u0arenif to1om rlnvs;(0teum(r3oy1ameemnci ()aDrmxm ;t0oee mo3tadfaDumumsn(4 rtoircto1laD luvo;( teuo(mpiydlp  lncilt a2uaum ot0aex mfetydfm2eauvonu4 rxrxf iydoa  auvo;t  2xr(mpoo1llenlnetls  2um(moou0aexomieils aDra(mp;(4 leoxo oatfpDeluvo s0trxmxopiodame lnvt sf Drru onu0tlxnmo3ils aDumnmpnt)aeerio oatfmDe n s ( s2urxm io4op nmnviltfarraurp;t0oet  feiyslm ulnvpnu4areoxrciatfptr neo ( t2trim3nudlp  mfcilt srurx pou0optnmoctlsls2ulumpnu0trxoxfcootop rlu slt)seuoxopoo4ll  lnvs sfaDtaxm nt0aptoifetlsfs uauvs u)trenxr tytoa  anvo (  2trxo3oy1amtemncs ( s2ur(rpnu1alt ifciad a2eanmo;u4alenxo oydfptr u s t) 2xm(r3nodamte fetlt arra(m no0texoifcild sDum( s;u4aeerif oatlm eaivo (0seto(opoodomt lies t) rtm(r ;o4tleomicilslm rau p;(0texnmo tadoa rliei t teurirpio4al  mivtasfaDrm(mo;o1tpe iieildlaDum( p;(0treoxr tydlpt an i;s  2xoxrpoudoltnlfcs s  Dra(r ot0oetomfctldlsDum(vont0tlxoxf ty1fpDraueo;s s2xrir3oudlltnmicsl()arrm(rp;o1opeomf3ils m2ua(mp (4tlxrxrcoy1omD an o t0 exrxo ny4amt miciat) 2urxrpou1ape mieiydfm um( o;u4trerifciy1omD aieol() rxoim3nudamt lfvt (fartm(mpou0aee mi3iatfmDua(vpnu0trtrircia1fatran ols)teto(rpoy1lltnmfcias) 2taxmpou4oee if3tldla2eaumpnt) renmr iydfmDeluvo s)teum(mpio1lltn fetas  rrr(mo;t1altoii3iys s uanmsnt0arenmfcta1lmte nvo ()tetmirpno1am  mnci s)s2taxmont4oleo f3iaslm2rluvs;t0alxrmf tytfpD  nvol(0 rxrxm3nodamte ncs s)aDtr(mpoo4apx  i3iydfmDra(mo;t4 ltoxf totfm r ieilt0t2xoiopoo4om nmnei tf 2ua( p;t1tpxomfetaslmDra( s;(4 lxrmociotoaDeaivs () 2triopno4alt lnesas)a2trumpoo4aet mo3iadla2elu s u)alenioctotfm raueils0 2uoxr3nudol nmict s  rua(mont4tpe mi3tlt aDrmnmp;t4tetnxocia1fp  ai o s0sexrxm no4olenmncslt  Drmxmo;u0oetoiociadlsDum(vpnu4trtrmo tytlatrli ol( t2umxmpiu1lmt lict () Dtm(r nu4aexo i3ilt mDua( p;t0tltnif tadom rauvslt)setrir3io4lleelnvtlsfsDtr(m nt4oexoio3tydfa2umnmpnt) rxoxfctatomtraneo;t  2uoirpoydaptemfcils) 2ua( pnt4apeo feias s2ul( o;u)aleriocto1fm rauvi;s texrxr oydlm   ict t) Dtm(r nt0olto feiasla elumpnu4aexnmo todfp raues s0tetmio3nu1optn nciltfs2tm( onu4tptnmo3tlslmDean o () ltrxfctodomDrlu slt0seurxr iodalenlnvslt  2tm(rpou4opxn oetys sDeauvp;u0altnmr3tydfate nei s sexoim iydom e nvsl(fsrtmu pno4oltn ictat m2emuvp;t4aexomo3iodomDeanvi;t0 euoxmpiodlle  fetls)sDtru  ou0olt mi3taslaDrl(mo;t)artrxocta1opD  uvs;(0 rtmirpno1ol emivtls)s2umxmp;t4oltn octys mDrm(vs;t0 ltrio3oo1latrln s;t)sruoio3nydlmeemfei sf rtm( pnt0olxo f3iydfm2rm(mo (4altnif oytopDr uvs s)texmio oy4lpe licil(faDra(r ot1tet ifetys a uluvo;t4tlxoio ty1opDeli s t)setrir iu4olt mies (f 2ta(  no1olto ociadls el(vpnt0 exnmo3ty1lmtelu i (0 2toim3ou1omt  feilsf Drrx p;o1tlenmieiatlsDra(vo t0 lxoirctotom eln o ( srtmim3io1altnlneils)srtauro;u0tlxnmoeiasla2umn pnu4tlxrxf iytfaDeau i (0 rurxopiudlmtnlfvil() Duru o;o4teto o3tyslaDuanvo u4tlxrif3oodla r neo (  etr(rpou4lmte fviat srum(  ot1tlto f3iyt m rmumo (0aexoxo3ia1oateauvslt trur(o io4opte ivtlt) ruauro;t4oetnmiciadlaDea( p;u4tleoio iytlaD lneols0trurim no4am   ies (  2uaurpnt1oex mietyd a rl(vsn(0 exrio3oy1fat  ivilt0seum(r ny1llt liet tfarrmx  ou1oetnmo3ild a rlnmsnu0texnmfcoodfat  ivi;s)trxrxm no4ap  lfvtlsfsDrmurp;u4tleoiieiasla2el(ms t0 etoxo iadlpDeli ols0 2xrxo ny1lpe  nvsa() rum(mpot0oetnii3ilt mDuanvs (4aetrio tatomDean s;( seto(r3io4ol   nvtl()sDtaxr oo1olenii3tldfa2umump;u4trtrxr3tadoaDrluesls0s2um(mpiy4amtelncia(fa2tr(  oo0tet  iciatfa2rm( snt) rxnxocoy1latrln o;( t2um(mpiydlmtemnvil()aDra(  nt1texn oeias m2ul( o;u)altnxociatlpte ueol(  rtoxm3oo1am  mivsa(fs2raxrpno0teen ictasfaDeanms u0trxoir oa1lptr uvol( sexrxm3nu1apenlfeta(farta( pnu0teenmictad mDrlumonu) exrifctotfmD lnvs ( s2um(rpno1opeemicsasfsDum(mpot4tlen ictatls2eau ont)arxnir3iatlat an o;s t2trirpiy1aleelneia()srua(rono0teeomieiatfs ea(msnt0 rerxr3oy1fat  ivs t  rurxr oo1amtemnvtat)a2rrxroot1tpt moeilt m2eln p t4tltoxo3iytfa eli o;s)s2umxm3oydlm  mieils)s2tmumpou0aptomietydfs2ul(von(4 eenxf3tadfp r nvo (0s2ur(mpno4opeelfci s)s2umxroot1aleo oetysfa ranms;u4 lerxf ootfa e nvs t  rumxo oo1ll elfvt sfs2rm(mo;o1olt ioctyslm ean s;t4arerxf3iatfp eaies ( trxm(mpny1lpee feia()srrrxrp;o0alx  oeilsfmDem(mon() lenxrcoa1lp  livs ()texrim3oy1ome  fvsls)a2umxr ;o1tee  i3ildlsDel( s;u0aetoxociydomDeluvilt0s2tm(mpoudlpee feia() Draxm ;t4optnmf3iadfs2rmuvon(0arxnir oytfp   nvilt0t2tmim3iy1altelnvslt s2rmumont1tlx iietlsfm2eau s;()alxnirctytop rlivi;s) rtoio ou4lleelnct sf rrm(r ot1aet mo3iydlm2ua( o (4altoir ootoa eaivi;t)trtm(m oy4llt  ivsls a2ta(m ;u4tptomi3tlt a uln p;t4aetrirctotlpt aivi s  2xoxm3iu4lp elfvs () 2umu  ;t1tpt mfeiys mDem(mo u4texnio oa1fpDr uei ( t2xrxr3iydaltn ieiat s2ur(rpnu0oee if3tatfsDuauvsn(4alerir3iy1lpDr ieil(  2urxmpny1lpt livs (fa2trx  ;t4oeen feils s2rmumo t)aeerir iytoa  luvo s t2uoxr no4apee ivtlt)sDtaxr no0apeniiciyslaDranms;(0 etnxo3tydfm   nvi s0teto(o3no4oltn nciatfsruax o;t4oeeoifctadla2uanmp t0trtrmf iodoaDe u s ( t2tmio3no4lltnlivta() 2trumoou1oleo o3tlt s2umnvsnu)tetnif iodlpt aivs t teum(o3oudol nlieslt)a2urxrooo0openmf3ias s2rln s (0 leoxr3iotfm eanesl()trxm(m3io4ome lnet t)srtrurp;o0tpxo o3tydfs um( s (0 leoxfciodlp r i s s0 2umxr3ny4apenlnct ()arurum nt0tetomiciydfm2um( ont0tltoxr3iytlpDr nvi t texr(opiy4optemncs (fsrrr(m ;u0alxo octld m2rmnmp;u4 reoxocoo1fm r ueo;s0tetmir ou4openmivi sfaruru  ;t1tlxo octld sDranms;(0teermociatlm  livilt0t2xo(opnydap e nvt (fartru  nt4tpe moeiltls emn o u)aexrmr3totoptr i ils t2trim no4ape livilt)a2rmur ot0ale  oetadfa rl( p t)tlenxo3todoa e neo;t s2xmim no4am   fvtls)srtm(rpot4oleo ictldlaDuauvp;(0artrxocia1oa  livo;s0trumio oydom n feslt srtr( o;u4olen iciydla umu s t)tetoifcoa1lpD lies;s0 2trxr3oudamtn nesls  Dtau pnt1tex mf3ild s2rmuvo;t0 rxnif iadfmtrlieo;t0s2xmxo oy1alteliesa(faDur(m no1alxniociadfs2uau ont)alxrio tytfp r n sl() etriopnodalt mneils) Duaxr ou0aexomoctys a2ra( o u0 rxomrcta1lp eauei s  eumimpiydole mnvilsfsDua(m oo1tpxnmo3ilsls ul(vo;t) etrmf3tytfa e nei s seuoir oo4am  mfctas  rtr( pno4aptomi3ias s2rm(vp u)aleoif3oydop rln i (0 rxr(r3iy1lp elncslsfaDur(rpnu0teeoio3iasfs rau p t0 rxrmr3tatomtrluvslt  etr(mpou1omtnlieilt aDtmxmp;u4apx mo3tadfs2rmums u4texoif3oo1laDeai il()teur(r nodoltn fvi sfaDur(ro;t0altoii3iyd a2elnms;u0areomf tadlpD  i s t) etm(mpiydaltemieiat aDur(r oo0oltnio3iytfaDrm(vpn(0altomocoatopt  ieils0teuoxo nu4ome mfcs ()srrmx onu1tex ii3tltlm2ul(vp;t)aeermoctydom r neolt0tetm(rpoy1apeelfvs (f rtaump;o1tpen f3tld m ua(vp t4treoxfciatlpDr i i;t) rtrio nu1am elnetltf rtr(mpot1oeen oeiydlaDul(mp t)alermf oa1omD ai s s0 2xmim ny1ome mnvias aDtmxmoou4openifcilsfs2ua(mo;(0arxoxo3iydomtr u i;( s2uoxo nu1omee ncsatfaDrrxrp;o1tlxn o3tat s2eanvont) rerir tadfaDrlnei s  rum(o3iu4om eliesl(fsDrmu pot0texn ociad s rluvo u0areomr tatopt  n s;t s2xoxr3iy4lltelnct sfsrta(ront0tpx ifcias mDuluvonu)tleoxr3iytoaD anvo t) rtoxm iu4lm  mivil(f Drrum nu0apt  oeiyslm2ea(mont0 leomo ootfmDelivi;t sexmxmpiu4am  mivsls) Dtru pou1tlxniociasfs raumo (0artnmf3oo1laD  ues;t)trurxr3iu4amt  fvs (  2rmx o;o0tlxnioeiydfmDel(von(0aexrxrcoytoate ivo;s0seto(o oy1opt lncs tf 2taumo;u1tex  i3tas m el(mo;u0tlxoxr tydla e uvolt)s2uoxr3ny4apte ieia( sDur(rono0tptnmocils s uln onu0alenio iadlpD lnvsls0t2xoxm nudop emncsls) rrm(mo;u1tleoifctasfmDeanmp;u4trerio3to1late n i t  etrir nudlmen ivsls a2tmuronu1optomoeiydlmDel(vo (4artrio oatopt livs;( teto(mpiodllenlivi ( arum(rono4texo oeiatfmDeauvo;u4 reoircta1lm elu ils)setmxm3oo4ol e nct s aDuax  ;u0tlx  oeiydls2um( p ()tltoif3iodop  au s;s)t2urim nodlm n nct s)a2umumo;t1aptnmo3ildfm ul( o;()altrmr3iadop ranvs;t)trur(opnydlpeelivs () rrau pou0tlxnioeiyt m el(ms t) ltrircoa1fatr nvi ( tetrxopiodap   nvsls aDrr(roou1apt  feiatfs2elu o;t0 lenxfctatlp rln sl(  exo(opio4ol  mictl(farraur ;t0tpt mociatfm um( o () eenxf3tadoaDean il( sruo(mpoo1lltelfvs sf rtm(ro;t0ope  oeiaslmDem(vpnt0 rxnmr oy1opt luvslt)t2xoir iydlme mfeslt a2trurpnt1tetnifeild mDranvp u) eenif io1opDrauvils srxm(o3oo4olt  nvi s a2tau  ou0oleomoeils aDrlnmsn(4tlxoiocoo1om eaueolt)truoir3nu4omen icsa(faDtmxmpno4tptoii3ildlmDuanms (4trxnxf3oydop rlu sls)setrxm3nu1altemiei (f rtr(  oo4alenii3ilsla rmnvpnu)aetrxo3ty1fmtran s;s sexrxrpio4lltemnvt ( aDtmxronu0tlt mfeiyslaDuaumo;(0treomo oodoa r n ils)s2toxr3oodlp emiet s sDtaxro;u0oexnmiciytfsDeln sn() exnxo3iadoa e ivi t  rtmirpiy1apt mfvtlsfsrtaxmoou4tex ifcildfa2ra( o u0 ltnmrciytlp e ieol() rxoxm iudol   fct sfartmxmooo4tee  feiadls2eaump;(0 lermfciodfp  aueo t0srxoio3oudopte fcsas arrr(mp;u1aexn ietlsfsDemnmp;t0 exomo3oydfpDrluvs ( teur(o nu4olt mnes ()aDrmumpot0oetomicilsfm2ea(monu0texrmo oodopDeai s s0t2xoxmpoodalen net t s2ta(rp;t1opxomieiaslaDranmp;u)tetrir iotlpt  ivs (  2ur(mpnu4lltnlnetat sDra(mo;u4oetn ociytfm rmnvonu4 rxrmr3ia1oa r iei (  exmir ny4op nlfctlt) 2umur ou0tet mfciytfmDrmu ont)aexoxf3iadomDe i slt)setmiopno1altemivi (fsDrmur no4aexnmictyd mDuau snt4tlenxf3iadfp r uvi t0 rurxr io1alee iet ( sDtm(mpot4alxn fetatlsDrauvonu0alxnif3oo1la rln s t0sruoim oy1ol  lfct s)aDraurp;u4olt  i3tas s rm(vpn(4trxrmocty1la e i s s0 2urxrpiy4amen nesas)s2rr(r ;u4tpxn feiasla rlu o t4 rtoxr iatlatranvslt0 rxmim3no4llenmnci sf Dtaump;t4tpt iicildls2el(ms u) rxrmf ty1lptr iei;(0s2urxr3no1oleelnci s arumx ooo4apt  f3tltla ulnvpnt0teenxf ty1oateaneo;s) ruoir iu1lm  mictl(f Dtmurp;o4altn feiadfsDrauvo;t0tlxrxocio1fpDeaneil(0 rto(r3iodal nmfeia(f Draur ;o0tlenmoeilsla2umnvp;u) rxrxfcio1fm r u o ( s2tm(opny4om e fviasf Drmx oot0altoiictldlsDuaumpnt4 etnxf3ta1oa   i ols tetrxrpnydol elnctasfsrum( p;u0aex  iciysls2rmnmsnu0alxrmf oadfp eai o;t0seur(mpnu1ll  lfesas arum(mono0opx mf3tasfmDel( ont4 reoif oo1opDe n sls)setmio3nodomeemfvs s)a2raumpno0altoifcild aDuanmpn(4aeenif3oatlmDrluvs ( setmir iu4lptemnesat)sDta(r ;o1aeenmictasfa rau s u4 rxnmo oatfpDeai o t) etmxm3oodale  fct t)aDurxmooo0aex mo3tadlmDrmnvp t)altoif todop e neo;s  rxmir oo1lpe mnciat)aruaxr ;t4aptomfciys a emumpnu0trtoir ta1laDe ueo;( tetriopoy4olt mieils)sDtm(mooo4opxomfciltfs ra(mo () lxnmf3oadlp rauvil( tetmiopoodoptn ieiat s2tru p;t0apt  i3iyd sDuanvs;(4aetrxocto1fpt  nvolt)tetmimpiydam nmfeils)aDra(r ;o4olen fcilsfa uln o;t4altnmr iatfaD  n o t)s2urimpoudopt mneiltfsrum(mpoo4oeeo i3iltfaDumnms;()alenxr3tatfmDelivo s0 2umxmpiodlmeemnet tfsrtau poo4opx  fetytfs2ulu snu4arxoio io1opD  nes;s) rxmir ou1olt mnciatf Drm(rpou4aeen feiytlm2rm(vonu0tltoxo3ty1oatrlnei;t0texm(rpoy4amtemietas) Dta(mpot0tlx  fetlt a2uau ont0tleoio3iodlat  neo;t)texoxo oudapee ici ( sDrr(r ;o4oltoii3ildlm2rl(mo u0trtnifcoatfm rlnvo s) 2uriopoo4omenmfcsat  Dur(mpnu4oee miciyt aDrmnmonu0arxnif oydlmt au o;() euoxm no1omt lnvsasfaDrrumooo1tetomoetat s2umnvs;u0tetrmr tytlm  aneilt t2um(r oodapte nctls artmx  nu1tpeo fciytla rmuvo;t)tetnio3oodomtraueo;()truriopiu1omenlfci t) rta(  nu4aleo i3iatfaDuauvs;u4 etoio3iotlpD an olt s2uoxo3io4opte fetas  rurxro;t0alxo ociatla rlu snt0tltnxo io1opte n sls0 rtoxr iydopt lfvias artaxront0tetoiociys m2rmnms u) lenif3ty1fatean sl( seur(m iudom nlncils srrmxm ;o1tltnmietldlsDrl( s t0altrmr oydoptrlueo t0seum(o iy1ole lieia(fsrrmu onu4apxnmicild aDuanvpnu4tltrmo ta1om raues t) etr(r oydopenlivtltf 2ta( ooo4tltnmf3iydls rmnmo;t4aeerxo3oy1omDrlueslt  rto(o3iydolte ics sfs2tmurooo4alxomoetldfm uau sn(0alxoxrciodfat ai i;s teuoxopoodop elnet sfsrrrurpnu4altoifctlsfa umnmon(4 lenxfcoytomt  ivslt)t2trirpny1lpt liei ()s2tmum ;u4opt mietlsfaDuauvsnt0trxoirciydomD lues;(0 rxoir io1ll emietas)aruru oou0tltn fctld sDemumsn(4 etnir3iytfa eli s;s  2xrxopny1ope mnetatf Dta(rpnt0teeoiiciys a2ul( pn()alxnir totopDr neo;s)t2xmxrpno1ol e fcils)arrmxrp;t0ale  i3iytlm emumo;u)tlenmrciatfmtrlnvs s  ruoimpoy4omtnmfctas)sDum( oot0oee ifeiytlm2ulnvp (4trtnmo oadlp eau ils0s2xrxopiodom n ncs s) rumxm ou0tlxnmfetlt m2rmu o;u0tltomoctotlm raivs;t s2xoim oo1op n iciasfs2ur( ont1tpt mfciatfaDumnvo;()arerif totfaDeauei t tetmxmpio1om e icsas  Dtru onu4oexo o3ildla ulu pnt0 rtrmr3ia1optrauvil(0setmio nu1omeelfvsas a2tau ooo0oeeomo3ils a ra( s (0 etnif3oytlaD  nvi s0 rumimpiy1lmt mncils aDraxm ;u0tpxn ociatlm ulums (0trtoif3oytlp e neilt srxo(m iodomt mnvsl(fa2taxrpoo1ole  iciyd a2ulnvs;t)trxrmf3iydfptraieils tetrxm iydlm elictlsfarrru  ou1altniictltfaDrmnvont4 rxnir3iodfmD luei;( srtmirpiudomenmfes tf 2taumooo4tpxn fciyd a2emnmp t4tlerxf ty1op e nes;s0 euoxo oydap n feiltfsrtr( p;u4alxomo3iyt s2ranmont)tleomo3oatlaDeai i t0 exoxo ny1omtemies s)arumxro;t1olxnmietasfs2ea( sn(4tetrmociotla elivs;t) rurxopiu1lm n nci ( sDta(  ;u1tpeomociat aDemnvp (0 lxrmocoy1lm eluvs ( s2umim3no4opte nvilt)srta(r ;u0aee  f3iad aDrmumsnu4 etnircoa1oa  luvslt trtmxrpiy1ol  livtas s2rm( onu1alt ii3ilsla2rm( p u)aleoxr totoatr n i;t0 rtoio iu1olte icta()aDraxmpou4apxniociad m elu p t) lxrmrctadomt  ivi;t0 2xoir iydomtn nvs t)s2rrurp;o4oee iiciatls emn pnt)arxrmr ia1fp e uvo s)srumimpnu4omtnlfvs s)sDra(mpnu1alt  fctadla eluvp u0alxoif iatlatr uvs;()srurim nodlp nmnvslt)srrmurpno1olen icild a2rl(vs u4 rxnmf3ta1oaDrlnvs;s s2xr(rpoudolte ivs s srraur ;t0tpxoioetyt m ua( onu)trtoiocoadlaD anvi t0seto(mpoodaltelnvias  ruau p;u0tetniieiys a2em(msnu) lerifcoydoat  ieilt srtmirpou4lptnlnesa(f rta(  oo0tlxnmoeiyd s uluvpnu)texnmrctytfmtr ieo t texrxr oy4ole mnetl(  rtruroot1aptnio3tatfs2eau ont)trtrxo io1latrluvilt setmxr3ny1ol nmicslsfs2um(mpot1optomoeiadlmDrl(mp;t) ltrifcoytomtraues (0 rto(r oy4olee nciat  2raum nt4oleomfeiatfsDranmpn() rermr todfpt  i s;t trxo(mpiydllt micias)srtaxr ;u1tpxoiietasfs2eauvs ()teeoxocta1faD  i ilt srtmio iydal   nvtat)s2rmxmpoo1tpt  fetytfaDem(vsnt)tltnmo iotla r n o s  2tmim nodllte ivs t)aDua( p;u0olx ii3tytlmDrl(vpnt4 eerio3oytoatraueolt)seto(o3nydom nmfetl() rumurpnu0tlenmf3tadlm ua(vp;u)tlxrmo3oa1oa r uesls)s2xmiopiu4op n iviat) Dua(  ;o1oltniociyslsDrln o t4arxrmf3oatoate uvi;s teumxmpno4ale lics (  2umurp;t0olto fctytfsDeanvsn(4aetoxr3io1lp r nvs;(0t2xr(m ou1ome mfvt sfsrra(m ;t0olxoioeiat sDul( onu4alermrciy1faD auvilt0trxo(rpoy1amt mivsatfa2rm(mp;t4apxnmiciytlsDrau pnu0 lenirctytfmtean s;t  rum(o oydameemivtls)a2trxmoot0texo f3tatlm um( p t4 rxoir ty1opteluvolt0trtm(mpiydop   nci (  rra(m ou4optomf3iysfsDuaumsnu4arxnmociytfmte ivo;t) rxmxmpny1lpenmicia()s2tr( ono4olen iciytfmDuau pnu4trenir oo1lp   u i s0setrxm3no1ll   icsl( a2rm(ro;t0olxnmi3ils s2eanvo;u4arxrxf3tatlmtrlneilt) 2xoio3nu4lp nmictas a2tmurono4oeto ieiysfmDrluvonu)trenmoctytlmtrau o ()tetrxo3oy4ll  mivta( srtm( poo0ale mieiatfa uau s;()arxoif3oy1oa elivi;t texmxrpnudapen fvsls  rrrxmoou4aexo o3tlsfa elu snt4artnxr3oodfaDranvils srtmim3nu1amtelnet (f 2tmx  ;o4tpe if3tas a rmu sn(4aetomr tadom elies;t  rur(mpoy1altnmnci s srur(mo;t4opxo ieiytfaDuluvo (0 rxoio oydfmDeanvi;t srxm(o nu1apeelici t a2tau  nt4aleo ietld s em( snu0altnmrcoatoa eaneo () rxmio oudlme  iet sf Dtrx o;u0ape  oetlsfsDrauvp;(0 ltomf ty1lp eluvs;t0 exr(m3oodapen neils)s2uau ooo1opx mf3tltlsDran o u0trtrmr3oytla r i s;s) rxoxmpoodolenlfvtls arur(r nt4ape moctydfs em(vs u4 lxnxrctotlpteluvol(0seuoxopnydaptnmfvs ()srur(ronu1apt mictysfsDrl( o;t) etnio3to1optr nvi ()t2xm(mpnodlmtelfcta() 2umu  nu1aleo octadfm ulnmonu0 rxrmf3iodoatran o;t0 rurir nu1lp e netat s2ur(r no4tpx ifcias s ua(vs t4tlenxo tadom rlieil()t2urim oo4olenlnetlt  rurum ;u4apxo ieils m rmuvo t)trtoir3iadlptelivi s teuoxo3ou4lm nmfvtlt) Dra(m ou1tee  oeildlm2ulnvsnt)arxnxr3totopD auvil()trxo(m iydam elfei sfaDrrx pnt1altomicils m2emnvo;u0 reoxrcoy1la e ues;t0sexrxr3io4llenmict ( s2trxm no1aet ifctad s eanvonu0 lxrmfciodfpteaivols t2uoir3ny1lmeelnctlt) 2trxmpot0aptomi3iydfa rm( snt4tltnio todoa  ln i;s)setoxo ny4opeelicilt)aDum(ro;o1apeomieildfa emums;()trxrxr iytlatelneo t)srxmxopiydlp elnetat a2uau pou4oeenmfeiadfmDum(ms;(4aetrmo3ootoatrlu i;() eumxmpnydlle  iet ( s2rmump;t0tltnmicild s2ran on(4aetnxr ty1oaDe i s t  rxm(m3ny4opeemfet t aDrm(rpno0texoio3tlt mDel(mpn(4 reoifcta1fmDran i ( seumxrpou1om nlncia( sruax p;u4opxnio3iytla umu ont)altnxrcty1laDeli o t0 rtm(o no4olt mivia( a2trx pou0oeeoio3iyslm2rmn pn(4treoxr3tytfmtr nvs;t)srtmxr nodoleemfvils  2rr(rpou1opt  ociyd s emuvon(4 etrxoctodfa rli ol()sexmio3nydaltnlivia( arrmxro;t4opx moeiyt s2rmu s;(0trxnmf3ootfpDrli s;t trtm(r no4alt livsl(f 2ua(r ;o1aee ioeilsfm2ulu sn(4 rxomo oy1omD  nvilt)srurio3iy4apeemnci t)aDrmum ;t1apto i3tysfm rlnvpnt0areoxocoytop rli s t) rumxo iudalee iei s aDrm( p;o0aeto ociydlm2ra(vsn()tltoif3iytlpD au ol()seum(m3oy4ale livi t sDrmum ;u4aleo o3ias m rln onu) eeomf tytomD livs t)srtmio3iu1aptelfei t a2ra(m oo1tptnmf3ils a2ra( s;() lenxo3oatfaD auvs;t trxo(m io4lmte ivtl(  2rm(  nu4alx mfciasfa ean snt) etnmr3iadfpD  ies t  2xmio3nudap elncsatf rtru pnt4oet mfetytfm2uauvsn()trenxfcoy1fa rlu i t0 eto(mpiy1lmen fvsas)aDur(mont4opeomoetas s rl( s;t) rxrmociydomt aiesl()trxoim3no4lmt miciltfsrrr(ro;t4apx  feiltla2eln o ()artomoctadom ranvil(0trtoirpiudlpt liviatfarumum nu1tet io3iatfsDelnmpnt4aetomf ta1lm rlu o;t)sruo(m iu1ll e icsltfarra(moou1tlen oeiasfm2ulu p;t0texrmf3oydoptraieils0 rtr(rpou4omtemicsat)aDuaxrono1tpenifetltlm2eanmpn() rtnmrciotlaDrluvils trxoim ou4opte ieslsfarrrumpou4aee mociadlaDrm(mpn(4 rxnif3to1oateai ils)teumir oo1alt  ncsatfa2rr(  ;t1olt ioeiltla rl(mo t)tlxrir ty1optr neo t  2tm(mpny4lmte nvsat a2taxrpot1alt mf3tad aDuauvo;(0 eer
\ No newline at end of file
@@ -0,0 +1 @@
+ueo;t)seum(r3iy1ale micsas aDra(mp;o4apxomoeias s2rluvp u) lerxfcoatlmtrlu il()t2uoir3nudaltelivtlt  2rrxm ;o0tex ioctydfa ua( s (4altrxf3iydomte nvslt s2trim3nudllee iet s) rumur ;u4teenmociadfsDel( s t0trxnxr3ty1latr ueo ()teuo(rpiodllenlfcil(  Duaxmono4alenii3iat aDulu sn(0trenmo3iadopt  n o s trxr(o3oy4altnmivt t)sDrmu  ou0tltniiciad a2ul( s t)aetrmo3ty1lmDelivi s)srumxopno1alenmictl() rtm(ront4tptniieias mDulu o;t4alerir oytlpD  ueo t) 2uo(r iydaleemncsas sDuaxmpnt4apeomiciyt a rmnms;t4arenxr3ta1fa e nvil( tetoirpio1llt  fcias)srrmurp;u1oeto oeiyd s rau s;t0arerxr3totoaDr n o;() 2xoxopiu1opte fctls)aDurxrp;o1alen fetas a el( snt4trtrxf oy1lm eli o;s sruoim oo1optnmfeta() Dtau pou0tpx ifciasfa2ra( snt0 ltrxr oy1omt aues s0sexr(mpio1lm  mies ()srraumpnt1olenmi3tldfa2rlnvsnu0tlenxrctodlptelnvi;()t2uo(m ny1alte neslt)artau p;t4apxoifcils aDemnmsn() leomr todlp e neo;t0 exrio3oo4ol  mnci tf Dumu p;o4tlxo oeiytlm uln on()texnxfctotfp r uvsl() rxm(o3oy1ope  fviat  2umum ou0oexomf3iysfa eanvon(4tetrmf3ootlaDrauei;s)teumxmpoodaleemiei sf 2tmxronu0aetn ociydls ran snu)tetrmo totfp r nes;( teuoxm ny4olen feta( arraur nt4oee ioeiad mDrm( p u4artnio oadlptrai o s)srum(r3oudomen net t a2raumpnt1tlxn f3iysfmDumu o;()alxoif3oo1omteanvo;s)srurim3io4lptelfei sf 2rrxm ou4aetnio3iadfaDrl(mo u4 ltrxr ia1oaD  ivi s s2uo(mpny4om e neilt sDuaxrpnt1olto o3iydls eluvs;t4 rtrxf iy1laDe ieo;s0 rxo(r3nudlp nlicta(  2tr(r no4opto fetydla ranvp;t4tltnxr3tadoa  aivo;s0trtmxm no1altnmnes (  Drrx  ;t1tpto o3iytfs2em(mp (4texriociatfa r u i t trurio oy4lmtnmnes s  2tr(r no1alto f3iytfm ul(von(0arenifcoatlmD  nes;t trtoxo oy4op  mnviatf 2uau ono4olxoifeiltfm rmn o;u4 exrio iy1op   n o;s) etm(m oy4omte nci tfa2rm(m ou4aexo oeiydls um(ms;()teerio3totfm  lnes;( teum(opnudol emfvilt)arra(  nu0alxomfctat a eluvo (0artoif iotfm eanesl( trurxrpoo1lpee feil(fsrtrxm ou1olxniieilt a eanvo t)aexrirciytlat liei t)srxmim oudapee nvi sfsrtmx  ot4tex io3iysla rmu p u)alenxociatfmDeau s;t t2uoxm ou1ameemfvil()a2umxm no4olt  oetatfm2el(von()teenmrctotlaD  u i s0 exm(o nodolenmics t)srtmurp;t4olx  oetldfm2rm(mp;(4alerxocty1la   n slt) 2xmxopoo4olt  fcsl()arum(  nt0ole  ociytlaDrm(mp;t4texrir iytfatrlivs;t0t2xm(opio1apenlfvta(  rurumpnu1tlenmi3ils m uln o u4aetnxocto1fa   uvo s0tetmxm3oodop emnvt t)arrrum ;o1aexn ictydls2uln s;u0 ltrmr3to1opDeauvs;()t2tr(opnu4ap emicils) 2urxrpnt4aeenio3ildfa em(vpnt0aetrmocoadoa  lu ilt  2tm(r3ou4amtn nciltf 2rmurpou1tlxnmiciadls uaums t)aetrmo oatoateai i s s2tr(r oy1lltnlneil(f 2ta(r no0apeomf3ildfs ran on(0tlenxo3oodlat aivsl( sexoxr iydlmte ietls aDtmx oou1tpxoifeiltlm2rlnvo;()trtnirciotoaDraneo;() etm(o iudame  nesltfsDtrx p;t4tetomo3ilt m2ra(mo u0 rtrmocoadlptr ivo;s seumirpno4lmtemfci ()aDtax  ou4aptnmo3tadfa rlnvo;t0 renmf3iotoate u slt seumxm nydoptnmfetlt aDumur oo1tpe miciltla2rl(monu) etomrciydfm  lneo t) 2trxo3nydopen net ( a2ta( p;t1olt if3ias mDrmums u0trtoircta1lp  ai o;t0tetrxo3iu1amt  nvt s)sDrr(roou4aetomfciydlm umuvp u0 lermrcia1lm rai i;()t2xmxmpnu4llenlfctas) 2urx oou0alt ioeilslsDumnmp t4altoir tadomDeln sls0s2to(r iy4alt lfvsa()s2uru  ;o1tetn i3iltfaDeauvo t)tltoxo ta1lpDr nvolt0 2ur(o ny1am n fvs s)srrmu ono0oetnioctytlm umnmo;u)aetnmf iytlpteanvo;(0 etm(rpiydlpenmivi t)s2ur(m ou1tpxomociatla2um(vsnu4alerif ia1fpt luvo;s  exmim3oy1lme mivia()sDraxmonu0tlt  i3iltlm elnvp u4aexrxoctodfpte uvi;t s2toxopno1amenmfviasfs2urxmpoo0alt ifetadlaDrm(vp;(4aetrir oadlp raueols0s2xoxopoydal e fvil()s2tmxr nu1oetoifciadlaDum(mont)arerio io1fpteaieols0 2triopoy4aptn iesat)a2rmxmoot0olx mf3iatfsDran snt) renif ia1oaDr i ols  etoio nodol nlfvsltf rrr(roou1aee ifciltla rl(vs;u4texnmo3ta1lpt lieol(  rxo(r nu4lm nlicsl(  rrrxm ot0tltomoeiyslm2eanms t0 ltrio oadfpDraieils  2umxr3no4amenlnvi t aDtru pot0tpeoio3iaslsDul(vsnu0artomfcoadomDrlnvols0s2xm(rpio1oltemfctat)aDrrxrooo1tex  oeiadlsDelnvs t4texoif tydlm  an s t  2uoir oo1ll nmfct (  Duaumpou4aptn o3tadlsDemnvo u0texnmr iy1fm eaivolt)t2xm(m iydoltnlfvilt aDtauronu4aex mf3iydls2ua( pnt0tetomo3oytoat li s;()seuoxopiy4omeelivs t)s2taxrono0tlxn feiys s2ra(ms t)treoxf3tadom eai s;t0truoir3iu1ap nmiei s) rraumono0tetomo3tysfa um( o;u4 renxf3oo1oatr uvi;s0texo(m oy4lm  lietlsfartrxro;o0oee mfeiltfmDul(mo;t4 etnmf ta1laDelues s)s2xrxr no4al  lnct ( sDtrxroou4tetnmociydfaDumuvont4tlxnir3ootom r uvolt  rtr(r3nudlmt  fcslt) Dtaxmo;o1apeniiciatfm2umumsn(4tetrxfcoytla   uvi t srxmxr iydom n iesls)a2tmxmpoo1optomi3iasfa emuvsnt)teerxocoydlp eaivi ( sexrio oudoltnlfvtat aDta(root4opxnmfeiysfa umuvpn(0 lxomf3tadfpDe uvols)t2umim oo4omeelfes sfaDtau  ;o1optnmf3iadfm2ua(vs t4 lxrxr3tadop eliesls0setoim3iydameelietlsfa2um(monu4tpe ioctlt aDuau pn() rtnmf iytfpDranvs t)s2xm(r3no4alt  fcsat) Drrum nt4olt iietldfmDrluvp;()artnir3tadoa raivilt)texoxo ny1altelfvi (faDua(rpnt0ale  o3tytlm umu p;u)trxoif3tytfpD  i i;() etr(rpnu1ol n fet ( s2taxrp;t4tpeo f3tydfaDem( sn(4 etrxf3oy1fatean s t0trxmxr3oudolt  nct t  Duaumpnt0oltnmfetydfs2rmumpnu)tetomr to1lmteluvs t sexm(rpoy4ol eliei s)arra( p;t4altoiieiltls2uanvsnu0texomr tydfmDr i s t)trxm(rpiy1ame lnvsatf Dta(m nt4teto f3iytla ra( snu0tlerxf3io1fatean i;t)sruo(mpno4aptemiciat)arraurpnt0alxo octydlm eaums;(4 eeoir3todla eln i s teur(o nu1ap emnvtat sDraump;u1tpxoii3iys a ul(mp u0tltoxf3totfaDrlneil(0s2trxr ou1lle lnvsls  rua(mpou1opxoio3ias sDrl(mpnt0altrio to1optrli sl() exr(rpio4amee fci ( aruru p;u0tpx io3ildlaDrlnmp (4artoxociy1fat aivi t s2tm(o iu4om e fvtas)sDrau  ;o1olx ii3iytls2uauvs u0arxnir oydfm rauvo;s0tetoir io4lptemfes ()srtmurp;u0altoio3iatfs ulu o;t0 etoio3iatlpDrai o;s)setmxopiu4lp n nci (f Drrx oot0tltnmoeiasfa rmumpn(0teeomf3iadla e ieils  exmxr iudapenlfet s sDtax  ot1tetn octlslsDrlnvs (0 etoxr3oatopDr ues;t)trtoirpoudom emieslsfarumxmonu0tlxomfetysfm umu o (4aeerxf iy1la rlues (0s2to(m iy1omeemnesls sDuau onu0tpe iiciatls rlump t0 etnmr iadlat li s t texrxopnu1aptnmieiat)arra( p;o1teenmoetldls2ea( o;u)tltnxocoatomteaneol() 2tmiopiodoptn nvsl(f Durxr ou0aeeo o3tys a umnmsn(0 etoir3tadoa  lieolt s2uoiopnu1llt  nci s)a2tmxrpoo1aee iociasfmDrmu pnt0arxriociodlm r uvsls  rtmxr nydomte icils) rtrurpou4olt mf3iyd mDemnmpnu0areoxr oy1fa  ln i;t t2xrxopou1llt mfei tfsruru ono4altnmoeiadfa2rl( p;t0trermf3oo1oa rlivs ()trurxo nydlp nlivil(fs2ua(rp;u4aleoifctltlaDeau s u0altnmr3totlpDr neo;s seumxopou4am elfetl(f rrru o;u1oexnmi3tys aDea(vp t0 reoxo iy1fmDeli s;(  2xmir oy1lptnmfetas)s2uru  ;t0tetomictlt m ul(vs ()tetrif tydfpte ieo;( t2xmiopoo4ll nlfvilsfaDrm(m oo1opt  feiltfa2em(mp;(4tltoif tadfate nvols0 euoir oodlmte ncs s arrr(  ;o1oltnmi3ildlm rlnmo ()treoxo iotlmDeaueo;(  2xo(r iy4ame  fci () rururpno1teeniictls s2um( o u)arerxrcoadla  au i;( truoir3oo4ape mnciatf ruaxrpou4oltnii3iadfmDumuvsn() lxoio3to1lmteln ilt)trurxo3oudam   fctlt  2uaum nu4teeo o3tytfsDuluvp t4tlxoxr3tatfmt  nvi s0s2toir3oy1aptelfvil() 2um(r ;o0tlx mietldfmDelnmsnt0altrmf3tadlpteauvo s0seumio oydlmenmictas)srtax poo4optomf3iatfa2elnmp t4 ltnxr3io1omDelnes t  exmiopiu4am emnvsat)a2urxmpnt0tleo f3tldls2ulu s;t4 rxoir to1fa ran i s)setm(mpno1optelieta() rtmxmoou0oexomf3tad s2ulu o (4 lxniociodlp  aivols0trxr(o iu4lpen icsa()a2umurp;u0aetomoeildlsDelnmsnu4 lenif3iotlaDe i o;t) 2tr(rpny4lmt  net sfsDrmx o;t1tet  i3iat a ul( p;() rxomr oo1fateli i ()srumim io4lm nmiviat)srrmumpoo0alx  iciadls rl( p;(0 ltnirctatlmDr n sls sexm(opoo4ol   fct sf rrmump;u4aet mf3ilslmDrlnmon()trxnxo oy1oa e nei ()t2um(opiydap  mict t  rra(  ;t1oex  fetytfsDul(vp (4trtrxfciodfmt lnesl()setoim3io1am e nei tf 2trxmo;o1teenifcils a2ua( p;t) rerxfcia1oaDeanes ()srxmxo3iu1lm n nesas arur( poo4olxoio3iatfmDem( sn(0 eenxo3oo1omt aivs t0tetrxr nu4al  mfesasfaDur(moot1optomf3iad m2uanms ()altoio3tytopte nvils)s2tr(opiy4lmee icils a2trxmoot0aleomociadfa el( s u) ltrmfcio1lp e i slt t2xo(m oo1ol  mfviat sDtr(rooo4aet moeiysla2emu snu) etnxf ta1fmt  i slt0 2xrxrpiydop elncsa() Dumump;u4aetoioetasls2uaump (0 lerifctodlpDr uvs;t) rxoim nudom nlfctatf Dtaxmpot1teto fctasls2umnms u)trxnif3oadfpDe ies;() 2trxmpiudll nmiesa(f Dum(root1tpt  iciys sDrm( o (4areniociadomte u o;s0srxo(m3no1ll emnvs s) Dumx p;o4tleo ietldfs2ulumo t0 ltomr3totfa r ues;s sruoxr iy1ol elicta()srta(m ot4tee  ociadfs umn p;t0tltoio3ty1lp rlu ilt srtmim oo1ll  mfcias)a2urx  nu1tpeo feiasfs em(mont0 lerxo tadom rln s t0texmiopoo4ol e ieias)sDrmxm no1opx mociltlm2um( sn() renif3oy1optrauvs t0setrxm3iudom e fcs tfsDurxm nt4teeoiociat a2el(vsnu4aleoif ty1om  aieilt0s2ur(m3iy1lptemnetatfsDra(  nt0aet micilslm2em(mp;u4 rxnir3oydla e ivs;(0teur(r ny4ame  feias)aDurur ou4aet ioctyslmDeluvp;u)trxnioctydfptr nvi;s)trurir3io1lpte fes ()sDrr(rpnt0tltn o3ias sDul(vp (0 ltriocia1la rln sls s2xo(o iy4lptn nei s  2ra(rono0olto ociaslm2uau on(0tltnmocty1omDeaieo;t t2xm(r nudoleemivs sfa2umu  ;o0aeeo ieiydfa el( sn(0 ltnmr iatfmte u olt) rxo(mpoo1ol n ivia(  2raxmpot4aeeo i3iadlaDrlu pnt4 exoxf3iytlp eli s t teumxm3oo4lleelfvs (fs2umumpnu0tee iiciadlaDemuvs;u)tlenifcta1lpDeau s;t)s2um(m iu4al nlfetl(f 2ra(mo;u4oeto oetlt mDumu pnu) leniocio1omt  nes ( teuriopny4lltnmies s  Dtm( oot4oeenii3ildlsDumnms;u)altoir3iadfa r nvi;(  2toxm oy1lp  mfetls  Dum(rp;u0tpxnmfctat s rauvo t4trtnir3oytopDrln s (0s2trxmpoy4al   feiatfsrum(r ou4tet  ieild aDeauvo ()altnmo3iadfpDe ieo s) exoxr nydalee ivi ()aDta( poo0altnmoetat sDrmnmo t4 lxrmo iotfpt  nvi (  2xo(o3iudopte neils srrau p;t4apeomf3tytlsDumnms;(4 reoxfctydoaDr uesls0 2urxo3ou1lp  lies s) rra(rp;o1tle  o3ilsfs2umnvs t0 lenircta1lm eaneslt)t2xrir iy4om   ncilt sDurxmont1tpe  f3iadfm emnvo;u0tltnmociatfaDe i il(0trxrim3iu4olee feslt  2tru p;t1alen octytfaDeaumo;(4altnif oy1laDr u s s0sruoim iu1optelfcs tfaDur( p;u1tpenmieilsla um( s t4trenmo tadfptelieo;() exrim nu4lpe lnvils srrmuronu0tlto octltla ulu p;u4tleoir to1fmtrlu i;(0setm(o3iydoleelivtl( artr(ro;u0tlx io3iadfa2uluvo t) rxrxocoydomtr n s;( sexoim3nydlpenlicil(  Dum( ono4aleoio3tad mDul( o ()aetnir3todfaDelueil()t2urxopiy1ol nlivs ( a2ra(ro;t4olx ifciys m ulnms;(0altnmr3io1lp elneolt) rxrir iodlp emieil() 2ua(m ;t4aeto fciytfs elnvp u4 exnmf oodfmteanvo;( s2xo(r ou4apenmnvsas  rtmxmooo4alt mo3ildfs2ea(vo (0teeoxociytfa e ieo;()sruoirpoudal   ncs s  rua( oot1tpeoifeiys sDua( s t0alermoctytlm  aiesls) rxoir3iodap n ici () 2rr(moou0apxnmfeias s rmumo t4 lermfctodoa e u o ()trurim nudaptelneslt  rtr(rp;o4tex  ocilslm rauvp t4arerir3iodoaDeaies;(0t2tr(o3oudapenmicsa(farrr(mooo1apxniiciyt aDemums;(4 rxomoctytlatr ieslt0srxm(r io4om nlnes (f rrr( p;u1oeenmocildls2ul(ms;t4 etoif3iy1fptr uvi t)srxmio3iydlmte ivs t a2uau pou0olx  ieiytfs2uanmo;u4trxoir iodfpDrlivo;t) eur(opiu1op elict sfa2tax pot1tlt  ieiatls2ulnvs u) etrmr3ootfaDrai o t)s2xo(mpnodlp e nctl( a2uaxmono4ape  oeias mDulu snu0alxomocoodfm eai s () euo(r3nudamt lnetls) Draxmpnu0tpx  o3ild a2uau pnt)alxnxr3todlaDeau s t)t2tm(opio1lmtn nctas) Dtaxr nt1aptnmoetltfaDra(mp;t4 lxnxr3ty1oa  lieo t t2xrxm iodaptn icil(fa2rmumonu1olxomfcildls rlnvon(4alxrxr3tatlatrauei t)setriopno4omeelivia( artm(m ou1oleoifciys m2um( pn(0trenxf3ta1fmDelu o;t) exr(o no1aptelnvsa(f Drr(r ou4aee  ieiad s rl( pnt4 rtrif3ootoaD lnesl(0teum(m3nu4oleelnesat)srurxr ;t1texoiicildls2rauvo () ltoio iydfat liei;s) rtrxrpiu4apee fesl() Dumxrp;o0aptn ocilsfs ea(vp;u)treoxo3to1lp   neilt truo(mpou1ame miesls sDtmxmooo1tpe mi3iydlsDranvs;t0trxomocoy1lp   neols0 rumim oy4ope licils)sDtmu oot1tpeoiietldlmDul(msn()texoxr oo1op ranvol( teumxm3iydlm elfctltf rtm(m nt1aee iociatfa2rauvo;t) etnxo io1omt lnvi;s t2tmxo oydlpenmfcsa() ruru ont4tltoifeiatfs rlumsnt0 rtoio3iodfa   i o;(0s2uo(mpoodom emicta()s2ta(rpnu0apenio3iydla2eaumsnu0texrxf3oadfat aivolt0srumir3ny1amtnlnei ()arrm(mpnu1alxnmo3tysfm uanmont0tetoxf3oadfaD lnvs s s2umiopio1olenmfeiatf rurumpoo4openii3iydfaDumn p u0tltnircio1oaDean i;t)trtoir nudlpe lnvslsf 2um( oot1tptomo3iyslsDemuvpnu) exoif to1opDeanvi s  rtm(mpiu1lp elnct tfsDrrxm no0oet iieiydfs2ulnvo t4 reoif tydlpD aueo t0 2um(r3io4lltn icils)s2um(ro;o1tle mo3tydlm2emumont4 renmo3tatfpDeai ol()t2xo(o3iu1omeelivt t  Drr(ront0aetn ieiatfmDuanmp u4tltoif tadopDeln o;t0srtr(m iudlme  fetatf rtmurpot0aex  fetad m2ulumsnu0tleoifcta1fa  aivs s)srurxr3oo1ape  ict s sDtaxm oo0tet mociatlm uanmpn(0 eerxo3oy1fmD aneols truo(o oydopenlici (  2rmurpno4alx ifctldlm2umnms (0 exoio3iydfm  an ol(0srxmiopio1amtelncsltf Dumum ot1tpt ioetas s ua( o (4tlenmr3iydomtelivols)t2xm(o iy4altemfvta()arum(mpnu4apeomociydfa rl( p t0alenif3oadfm rluvil(  etr(rpoydam n nvi tf Dtau ooo0alen feildlsDeluvo;t4aetomr iy1oaD ln sls0sexm(m3ou1lpenlicsls) 2umx pno1tpx mf3ilsla2ra( onu)trxnxfcoodlm  lueils)seumxr iodol n feias s2tm(ront4oeen fciatla ranmp ()alxnmr to1la e uvo;s)sruoxmpiy1om nmnei sfa2ra(mpnt0oet mociysfmDea( p u4aetnif tadom e ivils s2urimpiu4lmeelfvil(fs2ur(ront4tee  i3ias m2uanms (0trxomrctadom raivo () eto(mpno4al  lics (f 2ua(ront4alx ifctys mDrlnmp t)tlxnxr ta1fpt  uvi (  rum(r nydapen iei s) Dtr( o;u0oltoiociatfmDraums t4 ltrmr3oadfateai ils)setmxmpou1oleelfcsls) Dumx  ;u4alx  ociadlm2eanvs;u4aetnxo iy1lm rlnvils)t2xr(r nodalen ivs tfa2uaum no1apxnmictydfm2uaumsnu4texnif3ta1fateliei s0seuoxr3oudlm  mfcia() rumumonu0altnioeiydlm ea( p;t4trenio ty1lm rluvil()teurxo ou1ame livsls  2rrur no1tptnifeiadfa2eau pnt4aetniociydlat ln i;t)setm(r3nudlptnlnvtl(fsrumu  nu1olxnif3iad aDrluvs (4 reoif3ia1omDranes t setoxo ou4lptnlfvt t)s2ra( p;u4aleomfcildfsDelnms;t)teermf tadfaD lu o;t0t2urim io4altnlivia() 2rr(ro;u4openmieilt m ra(mo u4tleoxf3to1fmt lneo;s tetoxm3oydomeelnvi t) 2rmxr ou4aeenmf3iytfmDulumo;u)altomr3oo1oaDr neils0tetrir nudamtemfctas) 2rru pno4tptnmo3iadfm2rln o;(0altoxo ootoa r iei;()s2um(r3ou4ameemneta( a2ur(mpnt1opt mi3ild m2uln o;u) reoif3tydfmtran o;t)t2xoxo oo4lmeelfviatfsDtmxmpou4tptoifctatfm ua(vs (0aetoif3ia1oateaueil( tetmxr iudaleelfcsls) 2tmxro;t4tpt ioeiysls2um( p ()teenxoctotlmteluvs;s0setm(o3iu1alenliviat aDraxm oo0tleomo3tasfs2eauvp;t4artrxf ootoaDeai s t0 rxoio3oodal nmfvtls  rtr(monu0oexomieiyd m eaumpn(4arenif3totoat lnvo s)setoim3ou4am  lietat s2tr(rpnt0tetnif3iyd mDrm(vsnu0 rermocoa1la e iei s0texmimpiy1op n nvsl() rta(m ou1tpt mf3tatla2ea( pnu4tltrmf tadfm r nvilt)texrxr oydaptnmfcias  2umu o;o4aexo ictydla eauvon(4tetnmr iadfa rlnvo;() 2trirpno4lm  micia(fsrua(  nu0tpe  o3tltfmDelnvp;u)tetnmr oodlpt luvi t  2xoio3nu1ope  netat srra( o;o0tleoio3iyd aDeluvs;u4aleoxf3tatlmt au s;(0 2to(rpiydolt  neiatfsDumxmono1oltn fetlsfaDumnvo t)tetrmocootfat li o t)s2xrir3iy4lm  mneilt) 2uaxm no0oexn o3iydfm2um( snt0alxrxrciydfmt luvsl( texrim3oodomeelictlsf 2ra( o;t0alt ifeiadla rmump;() leoir3iodlmtrli s t0teurio3nudllen ivil(  Duaxmpnt4tee  o3tadfmDrlums u)trxnxr3oytfa  aueils)srurirpno4oleelfct t) 2ra(r no4apeoifciys sDranvs u)tetrif tytfmDraneil()sexoio ou1lp nmiet (fa2rrx  ;o4ale mf3ildfm2eaumo;t)tetoif3io1laD luvs s0 2uo(o ny4omte nes t)s2rau oot0oltoif3ildlmDrlnvpnu4trtrifctatlaDelivi;s)trto(mpnudolt licsat  2rmxm oo1alenmoetyt m uluvo u0tltrifciadfpDrlues s)teumxr3iudllte ieilt arrr( pnt4aet  ictltfs2ul(mo (4texrxo iatlmtrai s;t)s2uoxopiu1omen nvils sDua(roou0texoio3ilt a eau s;t) ltoxoctodlat anvo;()s2xo(o ou4apenmfvi t  Durxmp;o4ole  o3iytfm ulnvs u)tlxrmocoo1fmDr neo t  2xo(m3nu1lp emfesa(fsrtax pnt0aetoio3iytfmDuauvo;(4alxoir iadoatelnvs;t)srumiopoo4amt mictl(  rrm( pot0aeeoio3iydls2ea( o;(0 lxrxf3ta1oa  au ilt)tetm(opiodll  lnesl(  2rmumono4apt  i3tlsfaDeauvp u0altrmo io1oateaivo;t)sexm(rpno1op nliet (fa2urx ont0alto o3ilslm2eanvs (0tlxnmf3ty1lpD an ilt)teuo(r3iodam emnctat)srum(mont0alxo ocils m2eanmpn(0 rtrxoctatop r neo t0sexm(m io1omtn nvt s aDtr( oot1tlenifeiatfaDelnvsnu0teenmf oodfa e uvo;s)trtoir3oy1lmenmneiat  rtaxmo;t4olx  octyd s umumo (0 rxrxr iotlmt auvolt0srxrxm3io1lp nlietl()sDumur nu4olto o3iyt aDuln o;u4 rxnxr io1oat anvi t trxo(o3iy1oltnlneia()srurxm nu4apx ifctad s2uau o;u4aeenxrctydfmDe ivi;s)t2urxmpnu4lmt lics s s2trxm ou0tltoifcild m2rmums;t4 rermf oadoaD aueo;() 2xm(m nu4amee iesls sDrmx o;t4tlx  ietltfm2eln s;u)treomo3oydfpt luvo s)trxr(rpiodlptemnvias a2umu ont4oexoif3tldfs2ea(mp t) rxomr iotfpDrauvi;s t2umxrpno1omt mnci () 2raxm ot1apenmieiys mDrmnvsn()arenmo totomtrln ols0s2trio3nudol emncia(farrmx ooo0oeeomi3tlt s2elnmp ()trerir iy1fpt  nes;s)srtm(mpoydomt lfes t)s2rrur nt1opeo feiysfm rmu snu4 exrifcoa1op elieo;(  2trxr iydlmenlfcsls) Draxr ot4optnio3tyt aDeln p;u) ltnio3iy1fa ranvi;s t2trxr iudlp elies (  Dtm(root0apt mieiadfm elnvp;u4arxoif3oodlpD lu o ( setmir3ou4olte feil()srtrxmo;o1tpt ifcildfmDrmnvp (0 lxoxo iydopteanvi;t)teuoirpou1lptnlietasfs2ta(moou4tet ifcildfmDrmnmo;u)arxrmo iotlp eli ol(0 rumim oo1olt lfvilt sDumu pou1aleoiieiadfm rmu snu)aetrio oydfmD lnvs;s)sexrirpnudol  lfcsl(f 2um(moot1tleoiociltla emu s (4 exomr3oo1oaDe neols)t2xrxrpio1ol nmnet t)aDra(  ;o1oex mfeiadfsDeau p t4texriocootoa eanvs;s0 exoir3oo4llt  fvtat a2tm(mo;t1tetoioeildfmDeauvpnu0tleoifcia1oat  ivsls0texm(r3iydam e fcias)s2ta(m nt4tpto ociasfs2ean s () eeoio3iytlpD aies t0texrir3ou1altemnvias a2um(r nu4ale mictytfm2ranmp t4alerxfcta1fate ueo (0s2uoxopoydolee nes s)sDrmxrp;u1oeeo ieiat m2emums;t)tltrmf oa1lpD  nei t  etr(rpoy1ope lfesatf 2rau oot4tlxnii3ilt mDuau p u0trenircoydomteauvs () rto(o nu1lp emieiasfsDra(r oo1tlxnioetadlsDemn on() rtnxo iytopDr i olt)trur(o ou1optn fcs s s2tau pnu0aptniicias a2eanvo;() rxriocootop  lu s t texoimpnudlpe lnvt tfaDuax  oo1openif3tadfsDum(mp;u)trtrxr ta1fptran o t teumxmpoo4lptelfvt sfsDua( oot4ape mocild aDum( p;t0trxomrcoa1omDeaieo;s t2toiopou4am n icta( s2raumo;t4opxn ocildfa rmumonu) renifciatfatr i i t) rurio3ou1ol emicias sruaxroot4tet  o3ilt aDem(vp t0teerxrcto1opte i ilt) 2trim ou1ame lictatfarta(moot4tet  fciltlmDea(vonu4alerio ta1lpDr uvolt)s2tmio ny1lp  mnvslt  rur(rpno4apxniiciaslaDuanvs u4 lxrxocoadopteauvolt)s2xrxm no4ol n ncil(  Dtr( pno4apeomieild sDea( snt) rxnxf3oa1omD  i sl()setoxo oo1al  lfcs t  rraxmoot0aee ioctadlsDelumo;u)trermr3tatoptrluei;() etoir nydllte ictl( s2ua(  ;o4tex if3iyt a2rlnmon(4 lenmr ta1fpDeauvo;()texmxmpiu4lmeelfvtat)s2umxmp;t0alt  f3iadls2rluvp;(0 exomr oy1omDe i i;(  2tr(o ou4amenlncsa(  2rau poo4aetnifctaslsDumn o;u0 leoiocootfmDraieslt)s2xoim3io4lmtn ivilt  rtmu  nt4olenmiciys a ul(msn() exrmr3to1fmDr i s;t0trurxm oodolenmfeia(faDur(monu4tpenmfciydfa emnmpn() rtoxr iydlaDr u il(0trumxr ny4amte nvi sfsrtr(m oo4tet moeilsfm rm( pn(0texomrctytlpDelues (  2uoxopiodlmt lietas)sDra( onu0opt  i3iyt m umuvo u) rtnxf oa1fm r ieo s s2uoxrpno1openlivsl()artaxrpno1tpxomi3tytlm ul(mo u)teeoirciatoa r iei s)seum(m oo1lmt  nvsas aDua(mpoo0ale mietyd a ul(mp;u0aetomo totoa ran i;t0t2uoxrpnu4op   fcs t s2tr(  ot4alt iictls a2uln o;()aetnmf iytlmD  i sl() etm(opno4lptnmfvs tf 2uaumo;t0altn feiytfaDum( s;u0trerio3iy1opt an o;t seumim3no4lm n ict () Dtrumo;t4apeo icils mDrmu p t4alxnir ootlmDelnvo;t0s2xoxm3oy1ll nmnes tf Dum( p;o1tpenioctld a elnmpn(0 rxoif3iatfateli o ( t2ur(o no4ole  fei s sDurx  nu1oeenmfeilt m2rlnmo;t0artrxf3to1lpt  ivs;t0 2tmim3oydoltemiciat s2rm( o;u4teeoioctlslm umnmp ()altnif3tatom  lnvsl(0trtm(rpnu1optnlivtat)sDrrxrp;u0tpeo i3iyd s ra(vont)trenmo3iotom r u sls seumxr io4lp   fvta()a2uax  ou4tlx mi3ildlm uluvo;()treoio to1fmt  n i t) exrirpiodlltemicsas) Drr(  ;t0tltomf3iadls ua(vont)areoxr iotoaDe nei;() rxo(o io1ale lfvsltfa2trxmpoo0tex miciasfa2uanvo;() rtnif to1fpDelnvs t0t2xrxo3iu1omt lnei sf 2trx oou4aet micilt s2rl( o (4 rtrio3tydfp eauvol(0trumio3nu1lmt mfetl(fsDua(r nt1apenio3iysfa2umnmp;t4 ltnxf3oadfpt  u o;()srum(o no1am elivt tfaDrru pou1aee miciyt m2ul(vsnt0arenmr ia1fmt anvs s0 exo(r iu4aptemfvils) Dtm( pno4olx mfetltfaDrluvs (4 exnxociydfa elieo;t0 rxrir oo1omtn nes ()s2tm(ronu0teen f3tasfmDua( snt4teenif tatoaD  nvs s0 rum(o3io1lle lfeils)sDraxmpno0aee mi3tyd m rmnms;t) etrmo3ia1fmtraivi;t) rtm(rpiydamt livt tfsrtmu pou4aptnmfetlt sDra(vp (0 rtnxr3oodfa r ieilt0 2xr(m3ny4op  lncs s)aDururp;t0oltnii3ilsfa um(von(0alxnxf3iytfmtrai s;t texmim3iu1open fvs s artr(rono1oeeo fctlsfa2emn s u) eeoxr3iodoa rlueslt0texm(m3nodlpenmfesa() 2rrump;t4ope iieiasfs2uanms;() exoxr3tadlpD lnvs;s tetrimpny4ap nmncsa( arraxrpoo4tptn f3iysfaDran s;t0teermrctatfaD  i s (  2xrim3ny1alt livi () rur( oou1opeo feiasfa2rauvs;(0 lenxo3totfmt  nvi t sexrxmpoodaltnmici s) ruaxmpnt1oex  oeildfm eanmo ()texoif oodlp   u s s  eumim3iodlm e icsls s2rrumoou4aleoioctldfmDrau p;()texnmo3totlp  liei;s srxo(r3no1ome mfcsasfs2rm(moou4aptomoeiatla2ea(mo (0aetnxo iotla  liei;t t2uoxm iu4lmtelnvt t) Drr(m no1olxoio3ildlm2eau snu) rermo3ia1omD au olt0s2tmiopnodaptn ivtlt) Durxm ;u4tle mo3ils s2elumpn()arenifcoydomtrai i s0 2tm(rpou4llen fvi sfs2uaxmp;t4altomictatfsDumn on()tlenxr oodfmtelueo (0srxmxopiydol elfvi s arumum ot4alenif3iyd a ea(ms;()trenxo todfmt  uvils)sexo(r oudopenmieias) 2ta(m ot1apt  fciysfs2ean onu4 lxrirciytfmtr i o s s2toxm nu1lm n nvi s sDurxmooo1tlxnmociltfaDuaump t0 lxoxfciotlpDrlnei t0sexoxr3oodlp  mfetl(fa2rr(  ;u4alxoiociyd s2ul( s;u0arenxr3todomDeli ols0seurimpoydlpen ivt sfaDurxro;t1oexomi3iltfm2ean p;(4 ltomf3oytoate n i t tetoim3ny1opt mncsas aDtaxmp;t4olt  f3ilt m uauvp;t)alenmo oytoaDrluvs (0teurirpnodaltnmnet s a2uru o;u0tlx  fetytfa uau o;() lxomf iatop rluei () eur(mpoy1openmfetat sDrrumo;u4tpen octadla2eln o u) reomr3iodlm eaiei;s0trumxr3iy1lm   fetls)s2tmx pou1olt  f3tasfaDulnvo;t0trtoircoadla eau ils t2tmim3oo1llt liet ()srurur ;o1aeen feiltls2rmnmo;u4 rtrifctydlat  nvo t0 rtmxo3no1olen fvtlt)aDur(ro;t1apxo ietlsfsDean s;(4 rtoircoadlm r uvi;()t2tr(rpoodop nlfesatfaDtrx poo0tlxniociltfaDrm( p;u0arxrxr3todfptrai i;()texo(r iy1amenmiet ( sDur(mp;u0aexoif3iydlm ulumsnu)tetrircoy1lp r uvi t) rtrxo iy4lmt lfvtas)arrrumont1aexomoetydfa ranvont)artrxfcio1lpDelnes t) 2xoimpny4omte fciltfsrra(  ;t4ape ifetlt aDelnvo t) etoxocoadlmte ueilt) eum(m3iy1amte ncsasfartr(mooo0tleomf3ild s emu o;(0 exrxf io1op r u s s0 ruoxr3no1amtnmnvi t sDumxmpoo0oleo feiytfa umnmsnt0tlxomociatfptrlivs () 2xoxrpnudap elneiat)a2umum nt4tltnioeils aDel( o;t4arxnxr3oo1omD lnesl()t2to(o oo1omenlfctls sruaurpoo4aetomieiytls um(msn(4trtnifctadomDe ivo t0 etoim3io4amenmfcsas s2um(mpot1optomo3tyd aDrlumpnu) exoir3tytfmt aivsl(0trxmio iudom  lies tfa2tau pno4aeen octydfa ulums u) etrxo3tydlat livo;t t2uo(o3oy1ope  nvtls)a2ur( pnt0tetniieiytfmDeln p;u) leomo iotop e ueol()t2tmxopny4ap   fvslt)aDumxmpnt0tpxo feild a eaump u)aeenxfcto1latrai i t0s2umir3nu4lpeelfesa(f Dtmxr oo1opeomf3iadfmDuauvp;t0texrif todoa e ies;(0 2xrir ou4omee fvtl( aDtm(r ot4tle mieildls rmn p;t)trxrif oy1fpDe iesls0t2tm(m3ny1lpt lfvt t)sDurum oo4texo feiasfm2rm(vsnu)trerif ia1omteaueo ( s2umir3oydopt  ivslsfs2urx oou0olxoioetys m rm(mp u4 exniocio1om  lnvo;s0s2tmim nudlp elfeta()sDumur ;o0tpxoiiciydfm emumon() exoir3oadfpDelueo s0teumio3iy1olee ivias  Dtm(m ot4tptnio3iytfs elnvs;(0tetoiociotopDraiesl( s2urxo oo1apeelnet s) rrmxm ;o0tet ii3ildfa2umnmsnu0altnmr tydlatr uesl(  2xo(opoodomeelnvtls)arumum no4aptnioeiaslsDemn ont0trenxf3oodla  liei t0 etmxmpiy1al  lncias  2rrum nu4ole ii3iatfm rmn pnt)aetnxf to1fptrlneo () 2xm(mpoodlpee ivtl() rurx  ;u4aexoio3iyd m eln pnu4artrxfctytfaDe ueo ( texm(m iudapt mfvslt arumxrpnt0tlxoif3ils m2ra( s;u) rtnxr3iotlm e uvi s0t2xriopnodole mici ()a2raxroot4aleoif3iat a el( p;(4aetoir3iotlp rau olt) rxmxopiy1olte ncsltf 2urxm nu0oetn f3iysfsDulnmon(0texnmf3oy1faDr neo s) 2xmxm3ou1oltelnvia(  rurxmono4tpxniociaslmDrlnmo t)tetoif3ta1fmDeluesls)setoxo oo4lpenmicias) Drrxm ;o4ale mociatlsDeanvo () lxoirciydomtean o s  etmxo3no4openmics t)sDtmx pno0apeomietysfm2emu s;t0teenmr3tydop  aueo;(0tetoxr3nu1alt livt (faDrm(r ;u4oexomiciaslmDea(vp;t4 etoir tydom  lneslt teur(rpnydlm   fvsa()s2rm(rp;t4opx mieilsls elnmpnu0altriocoa1omDelu o;(  exmir io1lp nlnetatf 2ur(rpou4aleo fciyd sDea(vsnu) renmrcta1fatr ivo;t srtmiopiy1altnlfvt ()arrmxmp;u4alx  o3tatfaDrln o (4tetnio oy1oatrai i;( t2xr(m ny4alt lfvt (f rrm(mo;u4teeo f3tysla2elump t)trenxf tytlp e ues;t)srumxopoo1ol e feia(f rrmxrpnt4olx moeiyslm uln pn(4aexrir3io1omD  u olt)t2xrir3no4lp e nvi ()srum(r ;o0tptn o3ildlaDua(vs u) rxnxfcoo1faDeli ols0tetr(r3iudap   ieslt) 2ra(mp;o0altoiociadls ranvs (0texrmf3oy1lptelnesls trtmim io4lltn ietls)aDur(monu0ale  ieiatls2um(mo;t) exrmf tadlp  au ilt tetm(m ny4ll n ivias sDur(rpoo1texnmoetys a ea( s;()alxrxfcia1oatr uvils)trxoxr oo1omt mnvta() Drmuro;t1altn o3iydls2rm(vs (4trxoxrctodopDraieils0t2urxmpoydal nmfesas  rum(m ou0ole ifetldfa eauvp t4aetoio3io1omDeluvi (  2xrxr3nu4lltnlietatfsrtmx  ;t1apxn feiysla rau onu) etomr3oytlm  anvi;(0s2tmim nu4ale mfei tfsrtru pnu0apeo fetls sDem( o;()teeomf3tatopDrln ilt0 eurxopoo1ole  nvil()srtrumonu4tlx mfcild a uan p;(0tetrirctytfp e uvs () eto(mpnudapenmfvtl( aDtr(mpoo4tee  feiatfm uluvont0trxoif3oytfm   i sl( s2um(m nodom  lieilt s2uauronu0oeeoioetys m rau o;t0arenmfcta1fmt  i s;t0sexo(rpny4olenlietl(faDraxmpno0oexn fctysls rlnmon(4tltoxocoa1fm   n i s)t2urxo iy4op nlfvt s s2um(rooo4oexnmictat mDemums;(4areomfciy1omDeln o;s texrim3io4am nmfvia(  2trum ou1tltnif3iytls2raums t4artoxocoytfateanei;(0texmim3iudllee fcslt) Durumpnu1altoio3ildfm2uanvsnu0 lxoif3oydfmtrlueils0 rxrim oydlmenlfvsa(  Drau p;t1oeto oeiydfs2ean sn(0tltrir3iy1fmDe n s;s)s2uriopny4amtn fesas srum(mo;t4opx mo3tldfm2rm(mp;(0aeeomf3iadfaD  i s (0 exm(r nudam  livt ()aDtrxr ;o1tlxnifctls a2um(mpn(4tlenxf3todlp ean i s)tetrxm3nydomt lfcta(farur(mont1alxn oetltla rmnmp;u0artoxr3iotom rai ol()tetoim3iu1lptn ivsl(fsDrr(mont1tpx ii3ildfs ulnmpnu4texrxf tydfptelieol( setm(rpiy4ome  nesls)sDrm(r nu4tee iieias a2ranmonu)aetnmfctotlmt  ieo t s2urxm nu1alte ncil(f Dta(m ;t1aleo oetasfmDran p t0artoxfciotfmte u s t)s2toir no1lme lieiat  rrrurp;u1aee ii3tysla ea(mo ()aexrxr3iydlat au s;s0 exoxr oy1am  lncsatfa2taxmoou0aeeniieils sDumuvpnt4tlerio oydlpDrauei s0truriopiu1om e nvil(  rraumo;o4aee iiciatfs eau o;t4aexrmrctatfatraivilt)s2tmxo iu4omtemfctat aDur( o;t1aeenii3ilsfsDea(mo;()alxomr3oo1om e n o t0trtr(opoudamen ici t) 2ta(mp;o0apx iieiltls2uanmont0teenxo iy1om e iesl() rxrirpnu1opeemnvilt)s2ur(ro;t1tpe mfeilslaDumu o u4 lxnmr tadfmDr nvils) 2tm(mpny4lpeelnvi ()artaur nt0aexn f3iys m umn s u)texoiociydomtean ol(0 rxrxr oydame lnci t)s2ra( ooo4oexomoeiatls umu snu0tltnxf3ootlp rluei s) exmir3nu4amtemnvil(fa2tru pnt1aeeniieiytla2rm(mo;(4 exrxfctodlpteanvils0seur(r3ou4ope mfviatfsDtrxrpot1tpx mocilsla rluvsnu)texrxf3oytoatrlnvo t  rxmxr oy1lm e fviat)a2tm(ronu1aetnmi3iyt sDumu onu) rtnmfcty1op e iesl( texriopoodame liciltfs2ra( p;u4tleo oetlsls uan pn()texrifcoadom eluvs;t)texoxo oo1oltelfvi s srrrurpno1aleoii3iasfa2eln o u4 eermf3iy1fat lnvi t seur(m iu4ope miviltfsDrmx  ot0tpxnii3iltlm2emnmp u)tlxoxf3ta1omD luvs t0sruoxmpio1ale  feil(faDumxr ou0oet mfeiyd a2uauvo (0 etrxo iydlp   ieo s)srxm(m nodlltelnvs ()sDra(rono0oleo ieils s rln o (4 etniociatoaDelneil(0texr(opoudam e ivsa( aDrmurp;o0apen fcias a2rlnmo u)trermr3oatlmD ai i (0t2xo(m3iydom nlnvsltfsrrr( o;t4tleomf3tyd s ra( onu4trxrmociatfm ean s s0 etr(r io4amte ivtas sDtaurp;u4ape  fciatlm ranmsnu4 renxo3iytlp  aueo t0s2uo(rpio4om e ivi sfs2ta(  nt0oetn fetltfsDra( pn(0 rxnmf tytfatrlnes t  rtoio3ou4opeelietl(  2rrxronu1aee ii3ilsfmDra(von()tetnmfctytoate nei;(  2tmxm nodopeelneta(f Drmxr ;t4oeto icias a2rau o;t)arxrxf iotoaDr neo ()teumxo nodalteliciatfsrumx pno1olxn i3tas s2um( o;t)alxrir oytop  lneils0texrim3no1olen ivsas a2rmu  nt0altn icilslaDrmu on(0tlxrxf3ia1omD ln s s s2xrimpio4ap nlncs s a2uauronu0aptnif3tad m2emnms (0texnxrcty1omteluvo;s)sexrxo3nodol nlfet s s2rm(r nt4tpx ioetlsfs2rmumpnt4altnmf oatoaD  ivo s  2toim3iy4apte ictas)a2urx p;o4aleoioetlsfsDeauvo t)aleoifciadlp raues;t)s2tm(m3oy1lpe mfet sfsDur( oou1aeeomietatlaDulnvp t4 rxoxf3iydoaDe ueslt0 2xmxo iu4lmtnmnci s artrumoou1oeeomfcild m2emnms;t) rxomo ta1fmDeaueilt) euoio3nudomeemfcs t srtr( p;o4aee  f3iytla um(vsnu0tltnxfcto1la raueo;t)texrim3no4alen fei t s2tmxr nu0ale mfetltfs2eanvs;() exoir3iatlmDeli i s)srxmiopoodoptn neiatfsrua(moou4oetniicildlmDumuvpn(4trtrxrciy1oaDe nvols s2tmir3oydomen fetas  2rr(r oo1ole  oetltla rm(ms u0 exomf3totop eln ol( t2umxo nydop emivs t) ruaxmp;u0apeoio3iydlm2ranms (4trxrmrctatop   uvo ( s2tr(m io4lm  mfcia(fsrtaurpot4alxomoctlslaDran s ()aexoxfcoodfm  lneo s t2uoxmpiydlp   fcsa( aDua(mo;o1olenioetaslm2el(vs;t0trenmr totlp rlieols0seuo(o3io1op elfvtl()a2rauro;o0alt  ictadlm el(vo;u4trxrxo3iytopt livi;s0t2xm(rpio4apee fviatf 2raxmp;u1aet moctadfmDrlu pnt) lerio3tydlaD  ies (0 eumir ny1ole mfvs ( sDtrumpnu0alx  f3ilsfaDuau p (0trxomrciatop e neo t trxrxm3no1apenmictls sDra( ono1tex miciydlsDrl(ms;t0 ltrxrctytoate n i ( s2uoxr ou1lmtemics sf 2um(r ;o4oltomo3iadfa2rlu ont4tlxrxf3iatfpte neol()seumio3ny4aptnlivtltf rrrxr ou4aet ifetldlm2ua(vpn(4tltriocootop eanvi ( teumim nodalt mncia()a2tru oou0alxo o3ildfmDrl(vs (4 leomr3oydlmt  nes;s) rtrxm3iy4lltemnvslt) 2tau ont4texnii3tat s rm(vpn(4tetrif io1oatrauvo s seuoir3nu1lptemncta(fsDrmxmo;o0oex ifcils aDumn s;t0 rxrio tadoat anvi (0 2xoxrpnydllt mnetltfarraum nu0tet  iciyd m rauvpn(0tetrmrcty1oa  auvi t)srxo(mpiy4apee nvia( arum(ronu0tleoii3tyt s2uaumo;t0trtrxr3ootlmt luei;s trxmxm3nydamtn nvilt) Drauronu4tetomo3iat s uanvp;u) renif3oydfm  auvi;()tetmxopoudop  lfvils arua(root1tlxo octls m ranvonu0aeeoif3oa1la   n ol(0trtoio3nudalt lnct s) 2rmurpoo0altnmfctyd s uan snt4 reoif iodfp eanvol(0texo(o3iy4ome  fvtas sDumur oo4oex ii3ils sDua(mp u0altnmocoa1fmDe nei s t2xm(o3no1om   netasfs2ua( pou0teeoiictlslm ul(mp t0 etoirciy1omte nvo (0srxr(opiudal n ncs ( arta(mono1olx  i3iys s ran onu)tetrio oydomDeaues;t  etrio3nydlp emiet s) rtrxr nt4tpxomo3ildfm2um(vs;(4aeeoxrctytfmDr n s t0 2xoim ou1amt lnvia(  2ua(monu4aexo i3tls m2eanmo t4 rxnmr oo1fa  lies t0 2trimpiu1alt  fvsl()s2rmxrpot0ope  f3iadfa emu snu)aeeoxr3todlpt  ivi s0 2ur(m3iu1lmtn nct s arrr(r ;o4oleo oeias s rlu s u4tltnmfcoadfaDr uvo t0 etrir nu1lpenmfvsa(f rrmumooo0opxn ictysfsDrmu s;(0altoif ootom   ueols0t2uoir3no1oltelnetlt s2tr(r nt4tlx ifeiad s2em(msnt4tetrxo iy1lmD auvo t0 eumir iu4omeelnvt ( sDur(m ou0tlxn f3tadfs rlu ont)tetoifcoy1lmtr nes;t)t2umio iudole lfcsl()aDuax p;o0ale iietldfmDel( sn(0texnio iy1fpteaivo s0 exmir io4oltnmfcs sfs2umxmont4tpxnii3iytla emuvo;t0teeoif3iy1lm rlnvslt0srtmxo3oudop e netat  Dtaurpot0tlxn iciltls2em(mo () eermfcoytlat an slt)s2trxopiy1ll emnctls sDtr(mp;o1oeeoiictyt a2rl(mo u)trenmrcoatlmDelu o s0 rtoxo oy1ol  miet s)sDtau  ;t1opxomi3tatfs emuvo t4 rxnmo3tatlat  ivol()sexrir ou1llee fcs sf rta(ro;t1ope io3ias a2ulnvs;(4tleomo tydoptr uei;t s2tmxmpnu4amtnlnctls) 2tmxm ;u4aptnmi3iadlm um( p;u)teermo tytfpt ai s;()seurxm3nydlm nmfvsas) ruaumpou4opt  i3tadlm em(vp;u)alxoxfctodopteau sl(  rxmxmpoodll emictltfarrmx  ;t0aexomi3tlslsDumn o;u)aexrmo ia1omtrai o t0 etm(m3oudlpt lnei s) rtmu  ;t0teenif3tlsfa uan pnu)treoio tadopDraivs t teuoxopoy4ol   ieta(fs2ra(mont1tleoiocilt a2ulumsnt0trtrxo ta1omt  ueo;(0 exrim io1lm  lfci t aDrmxmpnt0oleniociytfa rmnms;u0trxniociotopDe ues t  2xoxrpoydoptnlfvilt)sDrrxr ot4openifeiadla2eaump t)areoxr oatlm r iei;(0sexm(m3io4ap nlnvtat  2ua(  ou0oltoifctyslmDrln ont)artnxo iatlm   u s ()truoxo nu1lltelnvta(fa2rmx  ;o1aptnii3iys mDum(ms;t4 lenxr tatla r i ol( seurxm3iydoptemnvs (  rum(  nu1opeomo3tldfa um( o;(0altrmr iodfp  aiei;t0 rtr(o oo4ame lieils)arrr(r ot4teeo fetys sDel(msnu) rxoxf oytlp  lnvi t)sexrim3oydaptemneta(farrm(r ot4apxo ociysfa ul(vpnt)trermoctytlptelieil(0s2xoxm3ny1lltnlnvia(  2tau  no4open feiydls ua(vp u0teenxo todlaDelnei;s)srurio3io1om nmfcsas srtmx  no4tex mo3iydlm emnmo;u4aeeomr oo1lp raieolt  rtmimpoy4al  lfvt s)sDum( o;t1ape iociydfm rl( s u4 renxr3oydfptraues s0t2trxmpiy4alt mfvi t a2trxm ou4apt mf3ildfs2ua( snt0 rxoif3iytlpDrlu s;s0tetmxr iy4ol nmicsa( srtmx ont4alxnmi3tld a2em(vs;u0tlerxf iydlatrlieolt tetriopnydolt lnetls sDraxmpnu0opxnmf3iadlmDua(mp;u) eerirctydlpDrlivo t)srum(m3iu1al   ivslt sDtmxrooo0tet if3iadla2eauvp t4 renircoatfpDe u slt)s2xr(m iy1oltnmieiat) ruru  ou4alx  fetydfm eauvs ()alenxr tadomD lu s;s0seumxr3io4ameemivsas s2tmu poo1tpeoii3iltfs2el(vont0treomfcty1fmDr ivslt t2tm(m oy4op elici (  Draumo;u1tpxomo3iltlm ua( snu0tlxrir oodfm  an ols0t2xmxo iu4ape mneiasfa2ur( poo0aetomfetydfaDrluvs;u)arxrif tydlm eaues;s trur(r io1optnmfvsat)arua(r nt1opxoif3tlsfs2ulumo u)altnif3tatomDrluvs t)t2xo(opiodll elieias) rraumpoo4oex iiciadlmDulnmonu0 renxf oadfp e i ilt tetr(r iy1amtnmict tfsrrmx poo0tet miciysla uanmpn(4artrir3oo1fa   ivi;t0sruoxrpno4ap n ivils srtrx pnu1tlto oeiys s rm(ms u)areomocoy1op rlu o;t) rxrxo no4amtnmfctasf 2rr(rp;o4oetoifcils m rau on() eerxfciadlpDeau ols truoim oodaltnmiciat sDrrum oo4tpt if3iaslmDean p;(0 eerxo3ia1lmt  nvi s) euoxmpnydlm  lnctlt  2urxmp;o1teen ictldfs2ranmpn() etnif3ta1fm rau ilt0trxmxr iudomtn fcslt  Drmum ot0tpxnif3ild s rm(vs u4 rxrxo3oodoptrliesls) 2tm(m3iydop   icilsfarrmuro;u4oetnmoeiadla rm(vp;t) lxomociy1fmtrlivo;( texrxo iu1ome lnet ()srtaxmont4olx mi3iytla2rmn o (0treomr totoa eauvs;( s2uo(m nu1lltemivias)aDrm(m no4tpxn ieiltla2ul(msnt0 exoif ia1fm e ieo;(0t2uoxm ou1am emivsatfaDrax pnt0oeeomfciaslm2rmn s;t4 rermo to1omDelnei (0teurio3oy1lmenmnci t) rrmxrp;o4ale  i3iat s2rl( sn(4texnxr3iydfpteauei s0trxo(r iodamtnmivtlsfarrmxronu0tlt if3iys m em(vo u0alenio oatfmD aivsls  rtrxr oodale livt tf rrr(m ot1olt  oetydfa eanvo t0aetrmr iytomt  iei (0setriopno4am  mnvsa( s2tau pou4oee  iciltfm2ea(vont)trxnio3todomDeli sl(0s2um(o oy1omen neils sDuax o;u0tpx  fetlsfs rmumont0tetrxr3tydlmDeanvs;s s2tmxo3oy4ope  fctl()a2taxmpnt0aet  f3iys s ua(vo;t0aeerxo oy1op   iesls texr(m3oy1apeemictat s2raxmp;t4tlen oeiadla2umnmp;() rtomo3todlp r uvslt) 2to(m ou4ap elnvilt s2raxmp;o1apx mf3iat mDulnmo;u)tlermo ta1oaDr u i;s) exo(opou4optelfvt ( srum( o;o4apxoifeiysfa elnvo;u)alxomo3tytlaDeaivi;(  etoxo oo1lm   fetasfs2rr(mpou1tlto fciatla uaumonu4 rtrmo oatfp rlies s)t2xmxopny1lp nmfct s  Dtr(moou0ope mfciatla ua(vp u4altnxo3iotoptrlu o;t) exoimpio1lp  lfctat aDtrxm oo1tetomi3tlslm2emnvs t4tltoioctytoa ranvs;( srtoxopnudlm  lfvil(  2tr(m ;t1aet  o3tlsfm uan sn()arxnxrcia1lp r nes;s)srxmxm oy1opt lict tfs2rm(rp;t4ole mf3tltlsDul( p (0trenmo3ty1laD lnvs;t seum(m3oy1amtnmfcsasf Dtrxmp;u0opeoio3iyd sDua(vo t) lermrcoydopt lues;(0 2toiopio1am n ncs ( aDrmxmo;u0tpe iocilsls eaumo;u)trtrif3oo1lmtrlnvi t)t2urir iydolee neilsf 2tm(mo;o1ape  o3ils a rmuvp;t4 rtomocoa1lptrauvo (0 euo(mpno4omeemfetas)sDtmxroot4alt ifcias a um(mo;()altnir oa1latrlnes;s)tetrxmpiy4omtelneiat)a2ta(rono0opx io3tlt sDemums;(4arxoiocoa1oa eaneslt0sexoxmpiudamt mietasf rta(m ;o4apenmoetasfs2emuvp ()trtnxo oydfaDeauvo;s trumxmpnydalen nvsat) Dtmur ;t0oetoio3ias m ea( o t) exomr3iydop  anes () exo(m ny1openlfctat) rtau ooo1alx  fciltfm2umums;u4 leomr ta1opteaues;s0 etoxrpio4ape mnes s)a2um(  ;o4alenmi3tld s em(ms;u4areoxr3totopD  ivols)s2xrim3nu1ameemieilt arta(r ou4oetnmfetlt m2ua( s;u0teeomo todlatelieols  2xo(m ny4lp   net s s2urx o;u0oleomfeiysfaDel(vp;u0arxnmr3iodfmD an i;s)t2toxo3nodopte fes s aDur( oot1tpe  icias s2ulu s u0 lenmf iy1opDeauvsls)trto(o3iu1altnlfcsls a2rmuroot0alxnifctasfaDrm( s;(0 reoxrcoa1lm   n sls  2umim ou1omtnmfvsa( a2tm(  ot4olt ioetls a rmnvsnu0 lxrmo iadlaDrauei;s) rur(o nudap e ivilt srtmurp;u0opxoifeilsfs2rmnvp;(0artoxf to1fmteauvs;s)sexrxr nodam  mfct (fsDumxrp;o4olen octad a2rm(vo u4arxnmo tytlaDeluvs;t0srtmio3io4ope mnvia(f Duru  ou0opx micildla2umumsn() exoif3iadomDelnei t s2tm(o3iu4amtelfct t)aruaxmpou4oltomo3iatfs ra(mp u4alenxo to1opt anes;( t2xoxopoy4ale mnvt t)artrxmpou1tlx ii3iatfs rmu o;() eenir oodomt anes s0s2xrxmpoydlptemfctatfa2rrxm oo4tpe iietadfm2rl( s () exomf3oadfmDr nvs;s  rto(o nu1ll  mics t)arumumpot0tlto oetyslsDumnvp (4aetnif3io1opte neslt)teto(o3iydllte nvslsfartrxmonu1oetoii3tlsla ra(vo;u)arxnxf tatlateln s t teumimpiu1optnmicil(f 2rm(r ;t0tleniietldfm rl( s;u4trxnxoctydfmD aiesls seto(mpny4om n iesatfs2urx  ;o1tlto iciys a2rl(mpnt) lenxf3oytfmteauvslt truoiopno4ape mnvtls  Drrx  ;t1tlen i3iytlsDran p;(4 rtomo3totlptrlnvslt0 rxoxmpny4am  mfci sfa2ur( pno4aee mfciytfm emn s;t0aleoxrciy1lmD lnvs (0setrir3nu4ap  mnvt ( aDuaxmooo0tpx  fciydfa2elums (0alxoif3ty1fmDrlnei;t sruo(o3oudlpenmfvs s)aDtmurpnt4ole  fctadla2uan s (0 ltrir3oo1faDr ies ()truoimpnu4omtnmfetls) 2ta( p;t4ole mietlsla2um(vs;u)teermo3tadfa  anesl( srxm(mpoudll nmfes (faDua(m nt1oee mieiytfs rau o;() lxoio tatoptr i ols s2uoxo3oodlptelfvsasfarrmumo;u4optomoetldfaDeanmo;u4 ltoxrcootlatrlivsls)t2toxo oy1opt  nvt t) Duax o;t1oee  i3iydfm2umn pnt) eeoif tytfaDe n sls)trxr(r nodam   fvsatfartr(mpou4aet  feildla um(ms;(0 exnxocoydlmD ai o;s) 2xrir3iodap   fei s) Dtm(mo;u1oeen iciytfa rl(monu4aleoir3oodfaDelu slt0texmxrpoodoptnmivt ( s2rm(ronu4alen i3ias m2umu s;t0aleoxocta1fm elu o;t)s2xmiopny4apte ictat  Draxmpot1olt  fetysfsDemumsnu0trxnmfcia1fmteaueils  exrxo iy1ll elivt t  Dur(mp;o0tlenmf3iadfm umuvp;(4tetomo3oadopDeliesl( tetm(mpou4olt lict s s2rax  oo0apx  i3iadlsDum( o t) etrxr to1lp r uei () rxmim3io4alenmnvt tfaruaur ;u1oltoii3ilslm rm( p u0artrif oo1oate uvs s seumirpiodlpte iesasf rra( onu1aet io3tadlsDulnmon() eeoir3oadlm rauvil(0teto(o3nu1lp elnvilt) Drm( oou4apt  fetat aDranms;(0 lxrxocoatfp  li i t) rxr(mpnydapen fvi s s2taum no0tleomfeild a um(msn()aetoxf3ty1fptrliei s  2xrxrpou1ameelicils)srtax  nu0oetoioetydfm rlu pnt4texoxo tadomD ai sl()t2urxrpnu4lmt lieias s2tmxr ;t0texn f3tlsfa2elump u)aeenirciytlp rlu s;t  rurim3ou4apenlneslsf Drru poo4olenif3iytlm umuvp t0aexrirctytop  ai s (  2uoimpnudomen ieiltfs2uau oou1oee  oeiys s uanmo;t)trenmo iodomDrlu ilt sexrimpiu4oleemnvt s)sDtmur ;t1aeeniicildls uaums t)aexrifcoytfmteln olt sexr(r ou1altn nei t  2uaxr ;t0oet ioetyslsDul(vp;t)tltrxrctytla e ivilt0t2trir3oy1lptelnes tf rtm(  ;u4aeeoifeilt m ra(msnu) lxoio oo1fateln s s)trxo(r3ny4oleemivs ( aDrm(ront4alx  f3iltfs2uluvonu0alxoif3iadlpteli o;(0trxr(o ou1lpenlncta( sDrrxr oo0tpxo oeiys aDulnvo;t0 etrmf3oo1omteli il( trtoimpou4lleemnetls)s2rm(rpno1tee mo3tldfa ean o u4areomfctytoaDeauesl( t2xoxr ou1ap  mfcta() rtr(roou4aptnmf3tatfa2em(vp;t0 eeoxocto1opDrlu s;t  2uo(r ny1lmtnlietl(faDraum oo1aleniicilsfa2rlu s;t)treriocoydfa rluvi (0 2uo(r3oo4apte ies t) Durx p;u4aet  fctysfaDrm(mo t0 renmocoatopte ueo;( s2trxrpnu4lptnlnvta() rtm(moot0oet ioetytla2uanmp (4artrxr oodlat au o (0 exrim3no4omee fvtat  rta(  no4oeeomfeiad sDrauvs () rxoxo3tadfm rliei;s)truoio3nydlp e ietls  Drm(m ;o0oeto i3tadls2ra( snt) rermf3ta1omt lueo;s teuo(o no4omtnmnei sfsDtaxrpou1alx  ietysfs um(vo;t0 ltrmocoodlpD livol( setrio3oydllee nvtl()a2umxr ;t0tltn f3ildlsDemnvo;(0arxnifctatlateanvi;( t2to(opou1optnlfes () rrmxm ;t1tltnmieiyt sDum( s t)aetrxf3oadomD an s;(0texoir iy4ap elies tf 2rmum ou1tlx ioeiat aDum(monu) rtomo3totoaDrlieo;()srtmxopoy1opt lnviat a2rrurp;t1opx  f3iatfm2uln o u) leoxf3oodlmt  u s s  etrxr3ny1ap elietat)arraur ;o1oexnioeilsls ra(mont) exnxf3iydlaDr i sls)srxmxm3nydlm nlivt t aDrrurpot0teeomfeiadlsDuan o;(4altrmo3tatlpD luvilt) 2urimpny4ol   iet (fsrur( pno1aeeo oetys mDum(mo;u) etnmocoadomte nvols  rumxmpiu4llt  fvsa(fsDrru p;t0tet io3ilsfmDumuvon(0 leoio3oatfp rai ilt)s2to(o3oodlltn netlsfarra(  no1opxomf3iadfm2uaumo t0 eeoir totoatr neils t2uoxrpio4omeelieil(fsrumx pnt0tlenif3iadls2eluvs u)aexnxo3totlmtranvo;s)sruriopny1llenmfct ( aDrr( pnt4texomfetadlm rlnvpn(0 rxrxrciatfpD  n i t  etoxmpny4opt lici tfsrrrxmono4oee mfctlsfsDua( p;u0trxnxfctodfaD anes;s0tetmimpoodapenlnctl()s2rm(m ;u4oet mocilt a ulnvs ()tleoifciytfpDraueo t)trum(m io1optelnei tfsDuaum nu1tpeoii3iatfmDrluvpnu4 lenxo3io1oaDelivo;s  2toiopiudolenlfeta( aDrrx o;o4ale mietad m2eau ont4treoirciytfmte iei t tetr(r iu1olt  fvsat sDrrxr nu0apt moetyt sDeluvsnu0trtoxfctydfa  auvsls srumirpio1lpt mfesls s2trur ot0teeoifeiyd sDua( pnu)alenmo iatfmD  nvsl(0 2xm(r3oydomte fvil(  rtrum no0opeoioeiltfaDrlnmo u4 lxrxfcty1fmte nvsls)truo(o3oudaptnmncta(fa2rau p;t4tetnio3iytfs2uauvont)aetomocto1fmDraieo;t0trxoir iudlpt mfcia(f Dtru  ou4aee  ictatfmDumump;(0aleoxo3tydop  lu i t)s2xo(opnudamtn nes t)a2raxmpno0opto oetasfs2ulump u) eenxr iadopte n i (0 2xr(mpiy1omtnmics () 2uau ont0opxo oeiad sDrm( snt0arenmocio1omDr i o;s)setrxrpoodap n fviasf 2raxrpot1tltn f3iyt a elnvp;u)tlxniocoatlp  li ilt  exr(o3nodll emivi tfaDtm(ronu1oet iiciyt sDuaums t)arxnmf3oadopDrlnvols0t2ur(m ou1amt mfeia() Drr(rp;u4oeeo i3iydls2um(vs u0 etrir3ootlmD aivol() rto(m3iudlleemivsasfaDur(ronu1aexo fciytlm rluvo;t4aexnif3oodfa rai sl() eurimpoo4amen nctl(fsDtmxmp;o4apt mf3iadla2ul(vo;t4tlxomf tydfpDrauvs;s0sexmxo3iy1alt  ncta(faDta( p;o1tex ii3iydfm2uaump;(4 lerio3oo1fateln s s trtmxo3ou1amte fei s)s2ua( poo1aee  ietlt a rau p;(0 etoxo3oatoaD aivi t0s2xoxm3io4lmtn nvtasfa2umurono0ape ii3iatfs2emnmo;u)texoxrciodfm r nes (0 rxo(m nu4omt miviat)aDrmxro;u0tltomi3iaslm2uauvo;u4 lerioctodomDeln s;()s2tmxo oodlm e fvsls)a2rmxrono0olxo oeiydfaDemuvo (4 leoxf iy1fmtrluvo;()srto(mpio1lpen fvtas s2tm(m ;o4aptn f3iad sDrauvs;u)trtnxrciotlm  lneo;s) eto(o3oo1am   ieiasf Duau p;o0opeoif3tas s rmnmo u0 lenmo iy1fmDr neo s0seuoio3nu4lle  fci s a2ra(moou4tpeomieiysfm eaump t4trtnioctodla  lu olt)srxrxo3ny4ll e nvtls) Dur(mpoo1aetnioeiyd s rauvon()tltrircoodoaD  ues t0 exoxr ny4amt  net t aDtmxr oo1alx miciyt s em(vp (4 eeriocia1oatrauvo () 2uo(o3iodllt lictasfsDum( pnt4oetn fciyt s elnvp;u)arenio3oytomDrlieil( texoxo iudol  liesas)aruru  ;o0tlt moeias a eln p;() etoxf3oy1fp  ai o;t  rtoir3no4al   ictas) 2rmx onu1alxoifctat aDel( s t0arxnmr iodomt auvo s tetr(rpnu4opt mfeils) 2urx  nu1texniietydfm2eln pnu0aetoif iodomDelu o t)trxrimpiy4lm  lfvilsfaDrm(mpou1aetn i3ild a2ulums (0aeenmr todfaD auvol() 2xm(o oo4op elivs (  rta(rpnu0tle ifcilslm uluvonu) exoio oodfpt  iesl() 2ur(o3oy4lpt mneta(faruau p;t0tetn ictys aDrlnvsnu4 etrif tydopD  i o;t0t2xm(m3nu1lmtemfvtlt srur(  ;t0tpxomf3tat aDrl(mpnu0 rtomrctodfmt auvsls tetoxo iudom n fctlt) Dtm(  ;u0optoifciatlmDeau o u0 reomr3ootlpt auvsl()t2xm(rpiy4am nlfvslt s2uaxrpoo0alx  oeilt m2elnvpnt)altrirciodlat lieo t0trtr(r3nudomtelfvilt)s2ra( pno1oltomictysls2eanmo t4 rxoxr3tatomD livslt0s2xo(opiu1omtnmfvi sfaDtmuront4tetnmoetls aDumu pnt0trxoif oatoat ln o;(  rtrir3nu4lptemfct tf Drru  oo0aptn iciyd mDrlnvo;(0aetomrciy1fa   ieo;s) 2toio3oydole mnciat  Drmu pou0ape  fcildls2ea( snu0aexomr3oo1fa e i s;t) rto(mpnu1lmte nvi ()aDraxro;u0olenmoeiyd m rl(mo u)tlxomr oatopte ies s)s2urim nudaptemfei sfsDrrx poo4apxn oeias a umumo t)arxoxr oytom eln ol()truo(rpiu4lmenmfci s srua(r ;u1apenmi3iat aDumn o u4trenio tydfaD lieilt0texm(opou4alt lfcils)a2ta(m no1tex  oeiltlmDemnvpnu0trxoif tytopD livol()t2xoim3oodlpe lnct tfaDtrxmpnu4aetniieiltfa ul(vs;(0alerir oa1lmt ln o;t srtmxm3oydll emneia() rurxmo;t0olt io3tldls ranmpnt0 eenxfcoadom r uvi;( s2ur(m io1al   nei s)aDuax  ou1tpx mi3ils m2raump;u0aeenxo iadfm eluvs;()texo(rpiu1omtn ietl(fs2trur ou1texn ieiaslm2rm(vs t4 exnif3iytfmte n ilt0 rxm(o3iodlm nmfes (fsrtaxmo;o1tpto fctldlsDrmu o u)trxnxrciadoa raies;(0trum(m3nudlmtn ics (f 2ua(ronu0opeomi3iatls2rmumo ()tetomo to1lm  ai o s0srxr(opny4amtelics sf 2ta(mp;u4tle  octaslmDrlu p (0tltriocootla  lieil(0s2toim oydoleelfetl()sDrmx oou4olxn ietlslaDrmn pnt0artrif iotfm eanvilt  eum(mpoo1lm  mnvilsf 2ra(  ou1oleoioeiad m ra( p;(0tlerxfcoatomtr nvo;s  eto(m3nu1lpeemncs t) rurx ono0aptoiociys mDem(mp (4arxnio oydoptrlueslt0 2uoxm3io4lmtnlivs t aDurxr nu0apt mo3iyslmDrm( pnt0artomocty1oa elu i () 2xoiopio4lpe mivsatfs2urum ;t0tpeo fcils mDrluvs;u4arermf ty1omDeaieols  etoxo3oy1omen fesls) 2tm( pou0aptniiciaslmDrlnmp u4aexnmr oatlpDrlues;t sruo(r3oodal  lnvia(farra(  ;o0tle mfciadfa2um( o;u4 ltnmo3iotfat luvslt teum(o iudllen nvsls aruau  ;t4aetnioeiaslm2ea(vpnt0trxrmoctodfaD au i;(0s2uoxm3oy4ll e iciat aDum(  oo0texnmieiltlm2umnmp;u4 exrmo3oydfmt auvs t)texmio oudlle lnesatfa2trx  ;t0alen fctldfs rauvont0tlxnmr oodoat ai ols0 rto(m nu4lle  feilt)a2uru pou0opx  f3iytla2rmn o;t0tltnxf tatomDe nvol() eumxm oydlpt liviatfsrum(mpnu0tle if3tltfa2ua(vo t0 ltrmrcia1lp rlieo t)srxrim3iy4ll elnet t  Draxmp;u4apeomfetlsfs2rlnmp;t)tltoxr tadlm e uei;()srtm(r iodopen neias sDum(r ot4oex mociysla emu sn()aetrmrcoo1fmte uei;t  ruoxo3io4op elivslt)arur(  nt4tpt  f3iaslm2uanvo (0arxrifciydfm   n o;s0t2um(r oudoleeliciasfsDrm(rpnt0aetomiciyd s ra(ms;t) rxoxo tatomDeaneo;() 2urim oo4ope lnvi (f rtaumpou4apxn feiyd sDeln o u0 ltoiociotfp rauvo t0trurirpoo1al   fvsls arraxmo;t4optoioctysfm2umn o t0altnmr3tytfateai o;s0sexrxr3oy4ame mfetl(f rrm(mooo0tltn o3ias a2rm(vo u4altrmrcty1lp r u ol(0trtmim no4llenmfvi t) rrmur ot1oexo octydlsDean s u0 leomrciy1fmDe ies;s0trxmim oudll n feiat a2raum ;o0tlxoii3iat mDrauvo;(4tltomrcty1om elieol(  eurir3ou4lltelnet (fa2rr(mooo1aptnifciydfm emump u0texoxfciy1lpD  neo ()srxmiopnu4omeelncta(fa2ur(rp;t4oexn o3iyd sDeaums;t0 lermrciytopDeaivs () exm(o3ou4ol nlivia() rur(  nu1oeeo fcilsfaDeaums;(0tleoiocoydop eauvi;s)s2to(r3iudamt  ivsat)artrxrpou4aeeomfciltlm uauvs;(4tetnxr oodomDeaiesls) 2tm(o3nydlp  mfeil() 2urur no1tee  fciydfm elnvp u4tltrxrcoy1fa elnvs s0tetrir3no4ame  ivtlsfsDtmx ono0apxomi3tyt s em(vs u) rxomfcoytla elu i t  euo(r iu4altelnvtl(  2um( ont4ale if3iyt s em(ms t0 eenxo3ta1oaD au s (  2xrxo3ny1omenmneil(f rta(m ;o0tex  f3iydlaDel( s;u0 eenircoa1lp ranvilt  ruo(o3ou1oltnmnvsat)aDra(m ;u0apen oetlsls umu p (0texnxr oodlaD  i i;(0tetrim nudopenlict t)sruaxrp;o0open fetatlsDean o t0 rtnmr iatopD  uvs;( seurir iy4lmenmnvsas)a2umurono1tlt  i3ilt s2rmnmo t)trerxocio1la raneo;( setr(o3iy4omee ivtltfa2ua(mpno4aexo fciydlmDemu s;u4aeermr oo1omDeaues t)t2xrxm ny4oleelfci tfa2uaxm no1optniictydfm ra( s;t)tlerxfctodfaDe ieslt setr(m ny1lm emict (faDrax  ;o4tet ii3ilt aDemnms (4 renxo3oodlaD au i s0 rur(o iudalenlfvi s  Dta(  ot1tpto iciysla rl( snt)tltrmfciytop  liesl()s2tm(rpio1aptnmfci s  2taumpou0teenmi3iyslm2eanvs;t4 rtnmo3tatoptraieols0tetoio3nydolt  fet t)sDra(rpnu4olxomoetaslaDumuvs t)alenxfciy1lpD luvo t trtriopou4op emfcsa( srtauroot0apeoiociaslm2ra(vs ()alxomf oatoptrlueo s  rtmiopny1omt  fei tfa2rrumo;o1texn i3tysla ra(mpnu4tltoifcoydopt lieslt  2xr(m ny1lpe mnesltf 2rmumoou4tlt mi3tysfs ua(mp;u0arenxrcoy1fatr n s s) etr(opoy4ale lieslt a2ra( pnu1olt  oeiadlaDra( o u4 eerxo3tatomDr u o;s0 rxr(r nodlme mivtl() 2umur ;t1ole mo3tad aDeaumo;u4tlxnxrcio1lmDeaieo ()s2to(o3oy4oltemfesatfaDtrxrp;u1apt mieildlsDrmnmo (4altrxfcoo1opt lnvs;( trxo(r3io4amtn icsat)aDrru pno4oltoio3tydlaDua(von(0 leoxfctytoateai i;(0tetrirpiu4openlietlt sDtm(ronu1aexo fetyt a rau s (0 renir3oodopD liei;t)tetrxm3oy4llt livil(f rumxrono1aptoifcild s ul( p (0tleoxrcoodomte iesl(0 2umxr3nydam n fetasfaDrrx pot4aetoifcilslsDemnvp;u)trenxo3iydlm   ivil(0 2xmxm nudom n fvt s) Dra(r ;o0aex  o3iasfs el( snu)aeerxf oodopt an s ()srxmir3nu1opt  ivt t sruax pot0tpto f3iadfmDemuvo;()altomf3oydlp e ivs s)texo(rpno1olen feils sDtrurpot1oetn ociatls rlnmonu4trxnmf3tytopDrai s (0trxrio3oodlmte neia(  Dumxmpnu0texnmo3iydfa2umn s;t4 lerifciatlp  anvi;t) etoxmpiudole micsls sDtax p;o4opxnmfctatla um( s ()trermo3iydfm elieslt)srum(opnydlpeelnci ()sDrmurp;o0alt ifeild a2uluvpnu0tetrxo iadfmte ueolt0t2tr(opno1alt liesl( a2rmxrp;t1texniictytla um(mo;t0altoifctytlat  ues s0 rxm(m oodome lnvsat) rrrur nu0oeenmiciaslsDra(vs ()tetrxocty1opDe i ol(  eumir3ou4am elnei (  rrmxmp;t1aeenmociys s2ua(mont4 ltrif oodfat lnvs t) rurim3io4om e feiasfa2tm(m ;u1tpxn ictlsfmDrl( ont) lxrmocoytlaD anei;s srumxopnodop elnet tfs2rmumonu4teenifeildlmDem(mo t4arenmo3iydop eau i t)texrir3oy4ole mivsat  2umum ;t1oetnmo3tysfaDel( pn()trerxf3ta1lmt ln sls0setmxm3iudamt lnvtat  2rax  ;u1optnii3iyt a2eau s;t0teeoif ta1fat  n i s) 2tm(r iudom nlneta(  Drrxro;o4aptniictad aDranvs;u4arenxf3iy1lm eauvol( srtmxopoodopte fci s  Dur(m oo0opt mf3tydfsDrl( s;t0 eenmo io1om e n i t) 2uo(mpnodomeemncils arurumo;o1apx moeils a2ua(vpnt)texomocia1faDeaneo s) 2um(opnudopen fetl(  2taxmo;u4aeeo ieilt a2ul( p u4teermr ta1fm   u ils sruoim3nu4altnmivtl(fartax pno0aexn octydfmDranmont4teeomf3iydop   u s;s  etrxrpny4lp  mfeilsfs2rru pot1ole mocildlm2rmu s t0trenifcoa1lmte uei;s) rtmir io1altn iciat artm(ro;o0aetomoctldfsDrmnvonu)alerif ia1op raneil(0srxm(opnu1al  mictl(  2tax  nt1texomiciytfmDumuvp;t4 rxoif tadfa   ivil( trtrio3iu1op n ncs s srrmxmp;u0tee mo3tldls2rlumont0aexrif ia1fpt  ivsls)s2umio oy4ll elnvi (farra(  ot4ole  icilsfa2ul(vp u4trxnmo3iydlat au o t  rtoxr3nodll n ivtls)srumu ooo0tpxn ieiltfs um(ms (0trxnxo oa1fmDr n o t)seurxr io1ll nlncsl()a2uau ont0olxnmfciyt m2em(mpnt4 ltomf3oytoa elnvols0 etrxm iy4lp e ictasf Drax onu0opxomfeildla2em(mp;(0trerif3tydop   ivols) 2uo(m3no1omenlnvtl() Dtm( p;o0open icildls rau s (0areomo3ta1lpDrlnvo;s t2trir oydlpeelfet t) 2urxmpot4tpeomi3tysfsDumn o () etnxf iydfa raueslt0trur(opiydlp n iesa(fsDtm( p;o0aleo f3iltlsDran s;t0tltrif3ta1op  li i s srtmim3iy1llee icsl(fsDur( o;t4texo ieiat m2uln p u)tleomf3oatfm raieols texrimpiodalenlnvt t)sDraur nu1oeenmf3tld s2emnvsnu4arenif ty1oat lnvi;(0 2uoir3io1alen icsls srrr(m no1tet  f3iasfs elnvo;t4 exrxf oadlmDeaueo t  eurxmpio1ole lnctl(fa2umxm oo0oexn octls sDean snu4teermo3iotlmt anvo;(0 2ur(m ny1ap e fetasf Dum( ooo4oexnii3iadfa uan p;(0trxrmf iytfaDe neol( trxoio3ou1lltnlnvias artau  ;u4tpeomictlsfm raumsn(0aetrmr3iodom  an s s0truoim3oo1ol n iet sf Dtrxmo;u0oexnmietlsfmDemnvo;t4 rxoxr tatfpDrlu sls0 etrxr3iy4lpte ici t)s2ua(m ;t0tex  ietltlm2rlnmo ()artrxo ootlm e uvolt) 2tm(r nudlleemiei tf Duau  ;o1ope mf3iatls2rm(vsn(0 rxrmfcoa1latelivilt  2toxmpoudop emfei tfaruaxmp;o4olxnmfeiydlaDemnmp t)altomr3oo1oa   i il()tetrimpoy1alt lfei ( artmxmpoo0tetomiciyslaDel(mp t)tetrif3oydfaD  uvo;(  exmim3oo4am  licsat arumxmpnt0alx  ietat s2eauvo;(0 etnxf3oa1omteluvi s) etrxmpnydlpt  ivtasf rururo;o0tpt  iciad m2emu s u0artnxr iadfatr u sls) rxo(o3iu1ol nlnvias)s2uax onu1tlt  feils mDeanvo;u)aexomr3to1opDe ivsls)srxoiopio4lpt lies (fs2tmu pot1oet  ietas a rl(ms u4aexomr iy1om e ivslt sexo(r ny1lleelfvsa(f rrmx  ou1ole  oeiatfm ean s;u4aetriociydfatr ies;s0 ruoio oudlltemnctasfartr(  nu1tpxoiieiltla uau ont0teeoir iadfpD lies;s) rxr(rpny1am  lict () Dra(rpoo1alxomi3tltls emumsnt4aleoxf oodla r n o s)s2to(rpiy4lpt lncils srur(moot0tlx if3iytls2um(vp;u)alerirciodlpte iei s)s2uoir nodaptemnct tfa2ur(ro;t0opxniociatfaDrauvont0 rtoxrctotopDrai i s)srumiopoy1om   fvs t)srrrxmpno0oexn ietydlm eluvp u4 eerifcoydlptrlnvi;(0s2trxopiu1omen fetlt) ruau o;u4ole  fciadlmDum( s ()trxnmr oytop   ieo;()s2trir3oodalenmivtat a2taxroot0oex mictld m2eanvon() reoif3tytoaD ai ilt t2xmim nu4aptelfvt () rrru pot0opxnii3iytfm ranmpnu0 etnircootopDeai o t texoxrpny1om nmnct s  2uax pno1tetoif3iyt mDrmums (0artomr oy1laDelivo;( sruoio ny4altnmfeia(f rtrxmonu0aeeoiicildla2ulu s t4arxomo ootlpD lnei t)sexrir iodolt mnetlt  rumxr ;u0alen oetltlm ranvo;() exoxr3ty1oa r uvi t0setoxm no1ole mnvi (farrrxrpno4tptn f3iyt aDul( pnt0arxrio ia1fp elnvi;t s2tmxrpnydoltelfei tf ruaxmpou0aetoiocild a ea( snt0alxomr oadfm ean s;s  2umxr3iy4al e nvt s)srumxrpno1texn ocias aDrlnmp t)trenxo3oytoaDeli olt) euo(o3no4om  mncs tf 2raxm ot0tex mietadfm2rm(mo t4 reoxrcoo1lp eanvs () eur(r iudlp   ictas)sDta( pnt0tpeoifctysla rlnmp;t4aexoif oadlm eai s;t)seuoimpio4alenmnvsat)srum(mo;o1openmfeiytla2rlnms u)tlxrir3iytfpDelues (0 rumxr3nydapen ncilt)srrmx  nu1oet  i3tadfs2emu pnt0 ltnmf3iydfa eaieols t2xo(m ny1omee nvtat srumxmp;u4alxo f3tldfs emn sn(4tlxniociytfmtelnvo s)t2toir3oo1aptnlnvs ( arua(r oo0tlto oeiasls uanmonu)artnxrcto1oa r ivi;t sexo(m iy4ol   fcta(faDtr(m nu0tpt  ietas a2rau o t0 etnmrciotlaDe ueo;t)t2xoim3iodlp   ivtas a2urxmpot1aexo f3tlslsDum(msn()tlxnif3oadfmDrlnvi t0t2uoir oy1amt lictat)sDur(  ;t0opeo ociltlsDrmnvpn() renio3oytoa r i o;(0 rxmio iy4oleemnct t)sDrmx pot0oexn o3ils m2umump;t0trerifcia1lptr n i s)seurio ny1ll   fvsasfsrtax oou4oexo i3ildlm2emuvo u)tetnxo oytlmtran i s0srur(mpoo4apeelnvslt aDtaxr ou0opto fetatlm ea( pnu4alenirciotfpDelies;(0trtmir3ou1lleemncil( a2ua( oou0tlt mociytlmDeanvpnu4tetrif3totlm r i il()srtrim3nudop  lnesat) rum(ront4tptnioctlt m2ul(vo u4 ltrmfcty1fp rlues ( s2tm(rpno1al n feta( srta(moot0oltnii3iysla ean s u0trxrmf3ta1fmtrlnvi;t)sruoimpio1apee ivs s artrumo;t4open ociat a2ua(vo;(4arxnircta1omteln i (0s2xr(o3iy4am n fesat)sDtaxmonu1texoifeiytlmDrlumo;(4aetnxr3iadop e n i ( srxr(m nu1olen ivias aDurxro;o0tlxoioeiatfm emnvpnt0trxrifciy1op eanvs;t) rtoiopoudoltemnvia( aDrmu oou0tpeomfeils mDeanvp;(0tlenxo3oatfa  auvsls)t2xoio iu1aleelfvt tfsrtm(ro;u4aetniociltlmDul(mo (4 lxoxr todlaD  uvs;s)trxrxm3nydapt  fcsat)a2urxrpno4aeeoiocias m2rmn p u0 eenifctodla  liei;()t2xoimpoodap nmicsatf rum(mpno1aptomictys sDum(vpnt4texnmr3oytfm  aneslt0s2uo(m3nu4ap  mnetls a2tmxmpnt4optoif3ilt s ul(ms () lxnmf3oadlaDrli o ()texm(opny1lpee ivtls sDra( pnu0alt mfetas sDumu p u4 lermf3io1fmtrauvs;(0srxrim ny1om nmfes ( sDtmx  nt4aptomfetltfmDuanvpnu0tltrxf3iadopD livi;s sexo(r oudapen ivsls  Dtaum ;o4ape mietad aDrmu s;()arenxr oadlp r n o;s0t2xoimpou4lm   nvi t) 2ua(mooo4aptnioctls mDeaump t0tltrmociodfatelu o;(0seum(opno1optemnvs tfaruaxm ;o1aexo f3tatfa uan p u)tltomr3oy1fmtrlueilt0s2tr(o3ou1lmtnlfcs tf rtr(mo;o1tpeo ieiadfs2ra(mo t) rxrmociytoaDe ieo ()truoimpnodlmt lnctls s2ua( o;o1oeto oetyd a uluvpnt) eenxfciadlp  an il( trtrxmpiydlm elfctl()arrr(m nt0opx  ieiys aDranvs;t0altoxoctatlp elu ols)teurxr oodom e netlsf 2rm(rpot4tpxnmociytlsDuauvs u4 exrir3ta1fmteluvo;t  rxm(o3iodopenmncs t)artrumpno4opxomfciad m2emums (0altnif3tydfp e i ols)s2trxm oy1lm n ieil( arrm(m ;t4teenmiciatlaDuau sn(0texnmo3to1lmD aiei;s)teumxr3oy4opt  net tf 2ta(ront0tlxomociasfs2em(mp t0 exoir oo1opD lnes ()setoxopnu1op nlfcs s sDuauronu4opt  fetydlm el(vpnu0trtoif iy1faDr iei t t2toio io1opte nct sfs2rmu ono4olxnmociad s2ul(vs u4 exnmr oytoaD an ol( texr(rpio1lltnlivslt s2rr(mpno4tpe  ocild s2rl( o u)texnxr oa1lp eaieo;s0texrio io4olte ivt (fsrtax  no4altoifctasfs uanvo;u4texrircty1fatelieo;() rumxm iydll nlnvtl(  2rrxrono1alto o3iyt a rmnvp u0 lxrxf3oa1fa e uvols  2umim oy4amtnmfvi tfsDtax o;u4oeeo fetysla uau s;u4 lenif tatfmtelies t)tetmim io1om emicta( srtaxrp;t4tpeomf3tlsfs2eau p u)artoircto1fp r i sls)srtrxr3ou1ole  ivta()s2trxm ;o1alxo ieiad a ranvont0aeeomo3ootlmtranvils0srto(r iydlp nliviltf ruaurp;o0oee  f3tld s2rauvp;u4 rtrmrcoadlat aieo t tetrirpnodalte nvt (  rum(ro;o4altnmi3ild mDem( pn(0texnmfciotfa   i i t0 rtmxo3oodom e fcia(fsDtr(rp;o1texnio3tat mDrlnmp;(0 eenmr3iydlatranei;(0 2um(o3nodamenlnci t srtmxronu1oetnii3iydla rmnvo t0artnmf to1fptr i ol()srxrir3oo1lpee fvilt)srtm(ro;o0aeeoifciytls eluvo;u0trenmr3oatomDeanvsl() rxo(rpoydlp nlnci ( s2rruro;t4altomf3tydlm2rmnvo;t0aexnxo iydlp   ivil( t2xrim oudopee net (f 2um(mpnt4oexoifeiytfm2rmnmp;u4artnxf tatlmt lu ol(0 rumxmpio1ale mict s)aDta(rpno0aetomiciadfm elnms;u0texnmf3io1fmt  i i ()truoxm3iudamtnmnes (fsrtm(  nu4tetnmo3ild mDul( o;u4altnmo3oatla e ieslt srto(r3io4oltelfcsa()srururono1ale iietadla2emumo u0aeerxf iy1fmte nei t)setmxo oudop nlicsl( aDua(moou0apeomi3iytfs2uan on(0alenmfcta1fpDean il(0 2tmiopnu4optnmncils)a2rmur oo1oex micilt aDemumo;()artnio3oy1la e ues t0tetr(o3iodame livia( artmu ooo4opeomieilsfaDrmnmont0 lerxo3oytop ranes;s)seum(m3iodol   ictas)artrxro;u1opt  fciltfa eanvo;t)tltoxfcio1late nvols0srxmxr3ou1apenlfvi (  Draxrpoo0alt mf3iad sDum(mo;t0aetrxrcoo1opDe ivi t0 rurimpiy4lmte fvtl(faruaxront1tpto feiadlmDrmnvo t0altomrcoydom e u i s trxm(m3oo4ole lies ( s2raurpoo1apxniiciydfsDrauvp ()teeoif oy1lm e u o ( tetmirpiy4al elfvtlt arum(mont1ole mf3tldfm2rm( on(4tltoir tydopDrau i;t s2xr(m3no4ameemietl(faDrau  ;t0tetoiiciys s eau p t4aeerxrcia1opDranvo;( tetoimpoydal   fvt (  2umx onu1oetomictls mDra( o t)tlxomf3oadfptran o ( s2toxopiu4ol  lictat)aDtmumpnu0tpe moctyd a uln o u4 lxnmociadfp  luvil(  2xm(o3iy1olt lict sfsDtrxrpnt4optomoetat aDemnvp t0texoxf tadoptrlu s;s)srurxrpiydol e fesa( srta(  ;o4olen f3ildla2rmu o;(0 lxoir3iodfpDraieol()teumir3iy4ameemncsas)s2ur( p;t0alx ifeiaslmDemuvp;(4 lxnmfciytoaDe nvo (  rxoxr iodom e iesas a2rrxrpnt4oee iietadls2ranmp t)texrircio1lmD lieslt0t2trxo3no1amtemncil() 2ua( ont4alxnifciasla2umumont4altomo tytlpD lies t0 etoxo oo1olenmiet tfs2umx  nt0aptnio3ias mDuan p;t4aexnmr iatfptrlies;(0texmir oydolenlfcsl( a2tax oou1tpxnmoctls s raumon(4texnmf io1oateaieolt)trxr(opiy4opeemiesasfartrx  nu0teenmo3iyt s2emnmsnu)aetnxr iydfpDrau sl( t2xoxr oy1ome miesatfarua( onu1tle iieiyslsDrl( snu0 renir3ia1om r ueils trtr(m iydomt mieiatf rtauront1apt  fciadfa ulu p t)tltnir oatlmD  uvo (  2tmim3ny1olt liet t)s2trx o;u1tex  oeiltfaDuln p u)aetnxr tytfa r n s () rxrirpoydlle  ictls  2rr(moou0apx  ieiys a2rlu p;t4texnmr3ia1fmte nvs;s)texoxopnodom nmfvilt)srua(r nt0aex  o3iydfsDrmnmp;t0tlxrxfcoydfm eli i;(  rtmir3oydale mfeias) rrm(m no4apenifciltfm eau s ()altoxf iadfa  an sl(0 2xr(o3iy1aptelnei (fs2urxmpnt1tex io3iadlmDrmu snu4trxrxo to1fp e ivs t0tetr(mpiy1lpe mnetl()s2ua(r ou4tex  o3tas m2rmu onu0trxrmocoodfpt an il( trur(m3oy4lpe mfei tfa2tau  ou4aex  oeiydlmDuau o;t0tlxomr3iatlm eanvil( s2xoxo3iu4omenmici s a2ur( o;u1opx  icias m eauvs;(0 exoir3tytla   uei t0teuoxr3oydop  mnes t arurx ooo4texoifeiasfm um(vpn(0 leomf oodlpDe neolt  rtm(rpiu1ap n fvils) Drruro;u0aexo iciyt aDrauvon()trtrxrciydfpt auvo;()srtmiopiy4olt  fet t)artrxmpou4aeeo i3tls a2ua(msnu4 ltnir3oadlpDr ivo t0sexrim iy1alen ieta( aDrm(ro;t1oleo oetltls2um( o;()tleoif3iadomtran ols) exmxm no4oltelnci t  rra(m no1apeo f3tat mDuanvo t4artoio oatfpDe nes s0sexm(r ny4olenlivt tfsDraxrono0oetnmietydls2uan on()texnmfciatom r i s ( tetrio3iydom nlivi () rurxmo;u4tptomfcilt s2uauvo (4texoxo3to1fm rlnesls0 2xr(mpny1oltn fet t)artau  no1teen fciatfm2elnmo;(4altrifcoatlp r i s;( texr(opno4omen nvt ( srta(r ;o1aeeomicild m em(vo;t) exoxo3ty1fmtrlu o ()s2xoxr oo4aleelivsat srumumont4oeenifeiyt s ra(vpn()texnmf3iodfp eaueol(0trxmxmpiodlpte icilt sDua( pno0ape  o3taslm2eluvo;u4 exomrcoo1late n i (0tetmxo oo4lp emivt s  Dur(m ou1tpt mf3iat m2eanmo;(0arenxrcia1fmteaneo t)trtmxo iu4amtnmnvslt sDur(mo;t0olenmi3tydlm2rmnmon()trxnxo oy1lpDrlieil()trtm(opoy4ame lieia(f 2raxrp;u4tltnmiciatfs emnmo t4 rerxr3ia1optean sl(0setrxr ny1open icslt)a2uaumonu4ole  f3iys a ea(vo;u)alenxr3iatlm rliei;s)trxmxm nu4ap e neilt)arurump;o0altomoctas s umuvo;u4 exomf3ootlaDeai s;() rxr(opnodapenmnvtatf 2uaxm nu0apxoioctad s2umuvo;t4 ltrio3ootlpD lnvs;t setmxm3nydap nlivi (fsDur(rooo0oltniiciydls ul( p;(4 lxnmf3iotoatelivo;t)trxmxm iu1lme  neta()aDuau p;t0aleo i3ilt m ua(mp;u)teeomr oodla r i o;s  ruo(rpio1llte fcs sfa2ta(r oo4opeo ieiat a el( sn(0teenxf todopt  i i (  etoxmpnudll emnviat)aDrrxrp;u4teto oetldla2rmnvo (4tlxnio ia1omteauei;s)trtrio3io4omeemfvs s)aDra(m ;o0tpt mf3tat mDemnvp;t0trxrio io1lmDranvi ( trtrxo no4lpt  fvt t arrruroou1opt mfeiyt sDulnvo t4 rxnircio1lm  ai slt)seurimpiy4omtnlnvs ( arrm(ro;u4apt  o3ils sDeaump u4trerxr3io1opteln i;s0teto(o no1om nlfciatf 2uaxront4aex  fctatlsDeluvs;u)alxnxr ty1om  livi s0srto(r3no1ope lfcsl(farur(m no1alxniicilt s emuvp;u)aetrxrctotfatrlivilt  etmxr3nudopenlictlt)s2umump;t0texniictltls2rl(mo (4aetrmfcta1fm r u i;()t2toiopoo1alt lfvtl(fsDrrumoou4apeomfeiyd a ra(vo t0aetomf3tadfmDr uvsl(  2xmir3io1llenmfvtlt a2rau  nt1tptomi3tat s2rl( p;(4teeoirctydlaD aieolt)srxoxo3oudopenlnes s)s2raxm no0altnmieias a2rluvp;t4 rtoxo3oo1om rlnvo;t0s2xoxm3nydal e ncta(faDuaxmp;t1olx  feiad m eluvo t)texoif3oydlpD luvol( trtrxmpoy4apenmnviat)srrm(mpot0tltniocild aDulnvonu0trenxr iadom r nvi;t truoxo no1omt  ivsa() 2tau pno0tpe mfeiaslmDelnvpn()texnxocoodla rlnes s) rtrirpiy1am nmicia(fsDumx o;o1tlx ioctatfaDumu s;t0tltnifciytomD aieols)t2toir ou1ape  fcs tfsrtrx poo4oexo i3tatlm2uln p (0 eeomr tadlaDrluvi;s  2urimpny1omtnlivs s)arra( pnt1tlxnmi3tyslmDelnvs;(0aetniocoodomt lu il(0 2urimpiy1am   ict ( sDtm( o;t1open i3tlsfsDuanmsnu4aexomf iodlpDranei;()texoio io4amtemfcslt a2tm( ono0opt iietyd aDrl( o (4trtoir3iotlmDrauei;t s2tmxopio1lmenmfvs ()a2rr( pnt4aeto iciat m2rl( sn(0trxoxr3oa1fm   nvslt0s2xoiopnodalee ictls)srraur nu4aleomietatlmDelums;(4trxoio oo1lm eauei s  eurxr iu4ll nliesatfs2taxm nu0oex  ictlsfm2rmuvsn(0aexoxr oo1op r i s t)trumxo ny4omt mncsa( srum( o;o0olxomo3ilsla ra(mo (0altrir iodom rlies;() eumxr3iydlpte nesat aDrm(mo;u1aeto oeiytfsDulu s u)texnmo tytfmD lu s;s)srxo(o3oy4ap nlneta(fa2trxm nt4oetoiieilslaDemu o u)teerir oodfmDrlnvo s s2tm(r iu1amee feta(  2taumo;t0olxomo3iyslm rlums;t)alerxo3oa1lat  i il()t2trio3ou1lm emfct (fa2taxm ;u0alenif3ilt a ulnmo;t0 etrio3tytfmt livs;t0s2uoir iu4olee ietat)a2um(ro;t4teenmoeiysls uaump;u4aeenxf ta1lmt aueo;()srtoio no4lltn ics t) 2trur nt1oee  feiaslaDeauvp t)tltnxf iy1opt  n s;()setoxmpiy4ale lictls aDrau  ;t0ope iiciytlm2rlnmsn(4 reoxf3oydlmDrlnvi;t)seto(mpoydlm emictasfsrra(mpoo0aet iieiad a ranmo u)trxnmf oodlaD anvo;t srxmxopiu1lm nmnes ()s2ta(mp;t0oleo fetadlsDrau pnt0 reomf3tytoatelnvi;t0 rxrir3no1om emivsas)aDrr(m ot0aeeo f3iad s2rln snu0tlxnmocoydfm eaueols  2xrim io1om elnesa(farrm(r nt4apt mociltls2umn p;t0tltoxo3oo1fa e iei t0t2trxm nydlmtnlivi ()a2rr(m nt0apenmo3iltfs emump (4tlerxfcio1lpte i i;() eum(r3ny1lp   feilt)a2trurooo4aetn ieiaslmDea(vp;t0 ltomociotlpDranvsls srxmimpno4opt lnet t  rurxm ;t4oexo oeiadlm2ua(mon()altnmo3todopDrlivi;s trtmxopnu4ol   nctas  rumu ont0oetnmi3tytfs2rmnvp;t)aeeomocoadlmt  nvo;(0teto(o3no1ll nmies s  Dumxmp;u0olto ietls m em(ms t)teerxf iadop eln il(0srtm(opnodaltnlncsl()aDtrxrp;u0opxoii3tad sDranmo t0 rxoirciy1fmte ivil( t2urxo iu1om n fetasfsDrru pno0opeo ieildla eaums;t4aetnioctatoaDraueo;t)t2toiopiodam elieil(fa2ra(rp;u0aet iieiltfmDel(mo (4 ltomo3oytfa  aivsls trtoxrpnu4lm e ivsa()a2tmx pno4olxoioeiyd aDemnmonu4texrmr iodlpt anesls) rtoimpnudlpte ieiasfaDrmu oot1oexomf3iaslaDelnvs;t4 rtoxocoadfpD lnes;s s2tmio3oydlmte fctas a2rm(mono1opt mf3iltlsDuan s;u4alenmo3tatfptr uvs;( t2umxo3oudlp n nvi tfaDtrxmp;o0oleomiciatfaDrm(msn(0 reomr3tydlp ran s t srtr(m3iudlle mfvtl()aDumump;o4ape  ociytls2rmu o ()arermf3to1lmDranvi t) 2xr(m3ny4op elivsatfaDtau p;u4oleniictad sDul( s u0 eerio ootop r ivil( srumxrpoudomtelneiasf rtmxr nt4aptomiciyt m um( p t0tleoxoctydomteaies s0t2xm(r3no1ale mies ( sDtmxmp;t1opeo i3tls a2rmumsn(4 exniocoydfatran ols trxoimpoo4altemncsas)srtrurpoo4oetoiietatlaDean s u)alerxfciodoaDeai il( srtrxm3iu4omt licsasf Dtmum oo4apeo oetlt a2um(mpnt4 rtnmrcoytfmtrln i ()srtmir3iu1lle lncslt  2rm( pot4alxnmociydfs ea(msnt4aetnxr3iatfmteaueo;s0teumio3nudlle mictlsfa2trx pot4oeto oeiadlm2rlnvs t4 lenmf3oa1lmt  uei s)s2xr(rpnodal e fet ()s2rmum ou4tlto ictydlm eaumpn(4 etrif tytfa r ivi;(  etmxm nydamtnlici ()aDrmx  nu4aee iieiydla2rm(ms t4 rxnmo iatoat aies t0 etoirpio4ale mnci sf rra(m oo1alxoioeils aDranmo;(0 exnir3iodfpDelnei;( s2toxo iu4alte ncilt  rtmx onu1oltomiciat mDran o;t0tltoif tadlaDe nvo;t  exm(o nu1ol  mnes (fsDrrurpot0tlto o3iasfaDeaump;t)tlxrmociydopD  nei s) ruoxo iudaptnmfvsa()aDrm(m ;t0aeeo fciys m2ra( ont0 lermr iatomtr n sl(  2umxm3oudam   nvt s srtaxmpnu1tpt mo3ild mDrmnvpnu4texrmr totlp r nes;() 2uoio3ou4om elfvsa(f ruaxrpot4opxo o3iltlm ea(vsn(0aetomocio1laD luvi t) 2xrxm3ou4am nmnetlt)aDum(mp;t1ape  fetld s ean o u) rxrio iydfp  lneolt  2xrxo oy4altemfeilsfa2tm(monu0apt  f3ilsfm emnmsn()areoif3todfmte nvi t sexo(rpnodol emnci s)aDurxmpnu1ape mociasfm2rm( s;t0trenmo oa1faDrluesls srxoxm iu1al emies tfaDtmxmpnu0texoio3ild a ua(ms u0trtrmfcoy1fmtrluvi () euo(r3oo4llt  fesl(fsDtaum oo0ale mictas a emu s u4 etoxrcty1fa r uei s s2xoim no4ol nmfcsls  rtmxmp;t4aex mfctlt aDeau s;u4aexnmoctydopte n o t)s2xrxr io4omeelnviasfa2ta(ro;u1opxn fetltlaDumuvsnu4tlxnxr3oytlp  au i;(0s2ur(m3no4lpenmiciat)srum(  oo1tlt ifctadls2ulnms;u)tetoxr iy1opD auei ()sruoxopoudll   ieiatfaDrm(m ;o1tpx mo3tyslaDulu p t4trtrmr to1lmtrliei;()s2ur(o iy4aptemfci s)srua(mooo4ale mictyt mDuauvs;u) lenif3ia1lpDrln sls)srumxo3io4op elivi t aDtmx p;u1opt moetlsls elu pnu0altrxfciadlpDrluvo;(0t2xr(opoo4ole lict t aDumxrpot0opt  octltla ua(vpnt4trtoxr todomtrln s s0truoir iydope lfvslt)aDrmurp;u1alt io3iyslsDua(vp;(0tlenmoctadfmDrlues t)s2tmirpou1am nmfcsa( a2umxmp;u1apeomfeiys s em( pnu) etomo3tadfaDrauvol(0srurxo io4lpe lnesltf 2rm(rp;o0aptnio3tyd m uaumo;(0aexoir3oy1fptr ivi s0 2xr(m3nydllee ivi t artr(  no0olx  ieiysfmDel(mp;u4arxrif oydoa rlieils0s2um(o3iodamtemivsl(  rtaxmpnt0ole  f3ilsfmDrluvo;u4aleoir oadlm  anes t texo(m3no1ope liciatfarra(m ;o1alx miciysfm2ranvonu4 eeoxf oadfpDe ivslt) etrir oydoltemieslt aDtru ono1ape mfciyt mDrlums;()arxomociotlmteluvs;s0t2xrxo nudol nmfvsls) 2rrx  ;t1tlx  fciatlmDumnvs u)artrir ootlm eaneo s tetm(opiodom   fctat s2tmxrpnt1olenmi3iyd sDuanvon(4 eenir iadfpDeai ilt) 2tm(opiy1ape  nvsltf rur(rpou4tetoifeiytls elnms;(0 rtrmfcia1fptraueo t0trum(r3io1ll elncs (f rururo;t1tetomfciadfs2emumsn(4 ltrxrcto1oaDe nei;()tetmio io1altn ncta()sDra(  no4aetoio3ildfaDem( o t)artrxf oatfa  livsl()srurio iudam  mfvs tfa2ta(m oo4oleoio3ildfa2uauvs;()arxoxr iytomt livolt)sruoio oy4lltnlnei sfarum( o;t1aeeoifciasfsDemnvpnu0texoir tydlp rlivilt teur(m iy4al nmicsls)s2tmurooo4tetoioetls a rlnvo t4 rxomf tatlat  uvs t  etmim io4olee fcsl( a2uaum nu0optn ietysls em(mo t4aeenmr ta1opt  nvi;t0 2um(opou4lm e neilt s2ta(m oo4optnmi3tyslsDul(ms u)aetrmrctadfaD  ivolt)trurxrpiydllenlfesa()aDtmxr nt1oetnio3ilslm eanvp;(4tlxnirctadfpteanei (0t2xo(m3nu1om nliciasfsDtaumo;u0aleo oeiydfa rau pnu)trtnmo3iatlm raieo ()teuoxo3io1op nlneta( arra(r ;u0opt iocildfs2um(mo (4 lxoxo oodlmteai slt0 2um(m3nu1apeemfeil( s2taxro;o4teenii3tltfs2rau snu4alxrmr3oa1laDeai i;s tetr(r nudop n ieiasfaDtaxr nt4oltnifeiad a rluvp u0arxrxf3iodlat li o ()t2toxm3ou4al n ivsa( srtrump;t0aex  ociad sDuaums (0aeeoircoa1fm eauei (  2uoxmpiu4ll nlfeil(f rurxr ;u4alxnmfciys sDrlnvs;(4 eerxo oodoa elneo;t)teum(opnydop e ietl(farua(mp;o4aptn iciltls rauvs;() etriocoy1faDran s t)t2uoxopoy1llt mfctl(  Durx  ou0opxo f3tlsfmDumnmo;u4trxrmr3oatfa rlu s;t texr(mpiu1omt  nctls aDtmx pnt4tpt mociydlsDrmuvon(0trenif3io1lpt aneo ( srtmxm nu1lp nlivias a2uaxront1tpx  fetlslsDem( snt) etoxr3oytop  ln i;() rtr(rpou4oltn icsatf 2tr(mp;o0ope mieiat s el(vpn(4trtrmocoy1lat lnei;t0 2xm(o oo1ol  mfci (fsruaur ot0oleoifcias m um(vs u)arxomocty1fa e ivo;s0s2ur(r ou4omtelfetas)aDtau o;u4tex  iciadfa2um( s t0tltoif3io1fptr ivsl( s2tm(r3nodamt  nci (fs2rm(rpot4oeenmfcias a ua(mo;()trtnxr3oatlpDean sl( srxmir3oy4lmtnlivt s)s2umx ono1altnmo3iyslsDrlumsn(0 lxrxo3tadfa r nes (  2xmio3ou4lpt mfcia( aDuru o;u1apeniociadla2rmu o t4 reniociodlmte ivolt setm(opoy4am nmnesa()s2tmxm ;t4tetomoetyt a2rmn o;u0 rerxr oa1op rauvs;t0texo(m3oy1ape  nvi t sDururpot4alx  fciadfm2ean onu0 exomo3todfatraiei;(0setmxm nu1ll elictl( s2ua( ont1oeeniociatlm rl(vs u)tltrir3tytlpDeauvs s0s2xoxmpny4ol e netl(  2ra(mo;u1opxoio3ils a ul( onu0tlxoxo3iodopDrln ils)teumxo iu4ap nlietas sDua(moot1olx  fciaslm2umu pnu0aeerir oatomteln s;t tetm(rpiu1lpt livsls)artrxmooo4aeenioctldfs ua(vsnu) rtrio ta1fmDeaneo;t  etrxm nydlltemfcias aDtmumono4apt mfciydfs uanvp;u)aeerio3oatfpD ai s;t0 ruoxo iu4lmt licil()sDua( pno4tpe mi3iat sDrmn p;u)tlerxr3io1la r nvi (0 2uoxopoy1opt mncsat  rur(moou0alxniietls m umums t)tlxoxr3ia1fmD li sls s2toio3ou1olee ictas srtrx p;o4aeenifetadfsDuanmo (4aexoifctydoaD aneo ( sexm(opou4omte nvs t aDum(mpno4alto ocildla2elnmp;(4trenxo iy1lmtranvo;s)sexo(m io1lpen nvsatfsrraurono4texo f3tadlmDean sn(4alxrmrcootop   u s (  etoio oydalt lfci sf Dur(mo;o0oeeo ociat mDelums u)areomo3tytfmD 
\ No newline at end of file
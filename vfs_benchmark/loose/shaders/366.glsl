@@ -0,0 +1 @@
+ivs ()srxrim3ou1lpt mfctasf 2rmxmpnu0teenifciytfsDemnvp u0 etrioctydfpDr u il(0 rtr(m oy4lp nmncsa(f rurxr nu1opx  ocils s2umnmpnu)trtoxfctotfp   neols)s2um(mpoy1am elnesa(  Dururo;u4openifctys a2ran o (4altnxfcoytoatelnvi t0t2um(o3iodol nmiviasf Dtmxm ot1aexniietadlmDumu o t)teeomo ta1fmDeaiei;( tetmxo ny4lle mfcil(fsDrau ont0oetomo3iat a2rl(mpn()trtniocio1lat aueol() etmir iu1op elnvi ( srtmxr ;t0opx ifeiltfmDumnms;u0 ltnxrciotopD an s ()texr(opiy1lle mies t  rtrumpou0aeen ictasla2ea(mpnt0alerir oy1lpteli o s)t2xrxm iy4lp n nei s  Duaxm ou4teen fctadlsDuau p t0teerxfctadfmDraivs ()srxmxrpno1ameelivsl(  Dtm(m ou4alxo fetltlm ua(mo t0 etrmr3ta1lat ln i;s)sexr(r ou1op e fctltfsDtmxmpot1texnmfeils sDea( p;t0teerxfciatom rlneo s srur(r3no1ol  mfci t srua( o;t0tltn ociad mDrl(ms u)tlenmf3oadlmtelneolt) exmir3oo1apt mnvta( sDra(r ;o4oee  i3iydlm2ean s;u) rxoir iydfpt li o s0srxrxrpno1ll  mnvs (f Dra(  nt1apxn icils aDean sn(4treoxfcoo1lmDraivsl( teum(mpiy4lltemfciat  Drmx  nu1tlxoif3tysla2umnmp;(4arenir iodopDr i s s seurxmpno4op elivt t arra(mo;o1tlenmfcildlm elums t4aleoxo iodopD aueolt0s2urxr3nu4ape miet s a2taum oo4oexnio3tldfa2ulnmsnu4arxomr3to1opDrauvslt  2ur(r nu1lpen nci ()s2ur(  ou4oexoiieilt s2rmu p;(4areoirctytlateaues;( s2xr(o3no1lme lnci ( arrrx p;t0aleoioctadlmDuln pnu)tlxrxo3oatfat auvolt) rtrirpny1ol  mnetlsf 2umump;o0aet iictatfmDrl(mo;u4 eerxr3ia1opDeaivo;t0 euoxm3nudape mncil(fs2rmx p;u1alxo fetas s rlnmo u0areoifcoy1omD au i s tetmim3ou4ole lnct (f 2trxmono4openii3tyt aDrmnmo (0teenxocta1fptr nvs;() etr(o3iydapenlnei s a2tru ono1apx iociadfa2ran sn(0alerio3oo1opDeln ols trxo(mpiu1omen fci ()aDrmx  ;t4tptoifeiat m2rmn p t0 ltnxocoatoat li o;() rxoirpou1ap  lietl( arrau  no4tex iieiytlaDuau p;t)artoxf3tydomtelnei;s0texmxopiu4al elicta(fa2taur oo4olenmf3iasfmDrl( s;u0treoxf3todomDelieilt0texrxopnodll nmfcslt)srrax  nu4aexo oeiytlaDra(vp;() exnir3totfmD lueslt trum(m3iu4olt lfesat a2raur ;t0apt ii3iytlsDrmumpn(4 ltniociadfaD auvo;(0trtoim3no4lp  lfctlt) Drmu ont0oex  ieiydfm2rm(vo u) eenxo to1faD aivo s trxoir oo4lmtnmivia( sDrmum nu4aetnmoeiadfa umnvp ()tltrxfciotlmDrau sls0 rur(r3oudllee nes s a2uru  nu1tpeniietyslm2rl(mp u0aeermfcoytop  auvs;(  2urxm3iodlltnlneias)a2ua(mpou4aptnmo3ias mDrmu pnt) rtoxrcootlm eaieslt  eur(rpnu1lmtnlictl(fa2uax o;u1aeeo ieiadfs uanvs;(4 rxomo oodlp   uvil()sexmim oo1omt  fvtl()sDurum oo0aeeo icild a2el(vo ()tetnioctotomDrai il()s2um(opnodlltnlivtatfs2umx p;o4tpxnio3ils s2rlu o t0 etnxfciytoa   i olt  2xoir nodameelnvtl(f Durx p;t1ole  o3tlsfaDua( p;u)arenxfctytfpD au o t0seuoxm no1lmtemneils) Dtmu o;t4opxo iciytls2el(vont4 renxr tydfpD  u ol(0t2um(mpiy4op  liviat srrmxrp;o1tlt  iciydls umump t) reoxf io1lpteai olt0 rtr(r oudll nlneias)sDtaumont0olxniocias a ulu o;u0texomo3oy1fm  auvi;t0 etmirpiu4open ietasfsDraumonu0opt  fcild aDumn ont)aetnxr3iotom e nesl(0 2xrim ny1lmt lncilsfa2tauroou1olx ifeiad a2em( snt4trxomf3tydopt li o s) rxr(opnudll n fci (  2truront1tex mocildfs2emnmo t)trenio oadlpDraueil(0 2xo(r iydaltnmnes (  Durx  ou4apxnmo3tatfm ean o u4 eenif3tytom ean o t)s2urirpno4amt  net (f Dtr(ronu1oex  oeiydla uln o (0tlerxr3todfpD lnei s0seumxr3nydllen ivt t) 2rrxrpoo0oexnmfciltls2uluvp;u0 exoxo oo1fatraieo;s)trumirpou1lpenmfeil(  rtrx pnu1tlx mi3tatfs2um(mp u) rtrio3iatfmDrli olt0s2tm(r iydaptnmicsltfsDraxront1aeen f3ilt sDrluvon(0teenxocoydlaDeanei ()setoim ny4lmte iei tf rtrurpnt4aeenmfeiadfa2umnmp;u0trtomocia1lpteaivol(0tetrxo3iy1aptn ictlt s2rmur no0tpx ii3iadlm ea(mp t4 renmf3tatop r n o;t)setoxmpnu4ol  livta()aDra(moot4alx ifeils a2elnmp t)alxomociytop eaies;s t2urim3ou4altnmfes ( sDtmx  nu1tee mociyd mDemuvo;t4trxnioctadfp e neilt0texrio ny1apee ici (farumu pno1oltoiieild mDuauvs;u)trtoxo3iotoa elneo ( trumio3oydomt  ietat  rrmxmo;t1opxoiicildlm rlu s t4 renmocoy1oatr nesls)t2xriopiy1omtelfvslsfaDururpou4tleomo3tadlm2eluvont0trxnif tadlmtrlues;(0 2xoir oo1apte icslt s2rmxrp;o4opx  fcild aDulu o t0tlxnio3to1lat  neo t0t2to(r3nodop emnvtasf rumump;t0oleo i3tlsfm rm(vsn(0 eenio tatfaD  nes;t)trxrxo nu1omt mnet ( arrr( ono0aptn ieiadla2uauvsn() eeoir3oa1fp elivslt setmxr iy1omtemiei tfsDurxro;t4tpxoiieiydfa rluvo t) lxomrciydoaD lnvs;s  rto(r3oy4aptelivsls  Draxronu4apen fciatlaDua(vp () rxoxf3oadfptrauvilt0s2tmxopou1ope mfvsasfsDra(mooo4tleoif3tld a2ranmp;u)texrir3tydfat au i;t srtmim ou1op emiet tfarumu onu4oee ii3iysfaDumumpnt)teeoxo3iadoatr n ol( teto(o oy1lmt lieta() 2tru  ;t0tlxoiieias s2emu o t0 etrio3iytomDean sl(0trtoxr oodlmeemneia(farur(m nu4apeomi3iadls uau sn(4tetnio3ty1lpt livi t teuoimpoo4apenmictat a2tmxmoot1oeeoioctatfm2eaumont4 exrif3iodlptr u i ()t2tm(r3io1lltelivs t srur(  nu1oeeomieilsfsDranmp;t0 lxrio3ootfa   uvo;(0trtrir3iudllte nei sfsrur(mpnu0tee  icias a rl(vp;t4alxoircoatlpD luvols  rtrir3ou4ap nmncsatfa2tm(root0tpx mfeiys a eauvo t0 exrmf3oatopte i o;s srtrxopnudal  mnvtl()arum(roou4opt iocilsfa rlnmo;(0aetoxrcoa1om e n ol(  2xmio oo4ol emnvi sfa2raxm no1apxomfciys mDuln ont)tlerir iadomt an s;s) rtm(r3oudapenlnvtat)sDuau  ;t1tex ifeildfsDemuvsnu4aeerif ta1laDr uesl() 2tr(mpnudape lfcsat arumxro;u1aexnifciydlaDranms;t0 rtnmfctydoaDeluvs;()t2xmxmpnu4ap nmnvi (f 2rrumoou4apenioeildlmDulnmp u4 lenxf ootlmte uvslt0s2xrir io1aptnmnct t a2ururpot4aet ifctyslsDranmo;t)arenxrctodop raues;t)s2tm(o ny1lltn ivs s)a2tmumoou4oeenioeilsla2rlu sn() lerxr ty1fm rauvi;t0srxm(mpoy4lmtnmics ()arur( o;t0alxnmfeild m2ua( o;(0 eenmo ta1oaDraies t trtm(rpnydamte nci (farra(  ;t1openiieiytls2rm(vs;u4tleoxf ta1fa   i ilt trxmxrpny1ap emnesat a2uaur ;o1apx mf3tlslm umnmpnt) exrifcoydlmDelneo;(0teurim oo4am emfvt sfartmu  ;u4tetniociydfmDranmp t)tltoio3iytfa rln slt t2urxr nu4am  mivils) 2tr(monu4alt  oeiad a eluvp t0 renirciatla r ues s s2umxr3ou1alee nvi (fsrrmxrpnt0olx iicilsls rlnms;(0arenmf3oadlmtr u o;t) rtmim3iu4lmen ncs t)sDtmxmo;o0tlx iocils m2emnmp;u)artoxf3tadoaDelnvi ()seum(r oo1lp emictltf ruaxr nu1tlt mo3ildlmDrmnvs u)alxomr iatlm rlivs;(0trxo(m3iudol elfct ()a2umu  oo0tpeoifctlsfaDrm(vont) rtnifciotla e nvils0 2tm(r iy1olt mfctas  Dur(rpot1aet ii3tytla em(vp;t)trerio3ootlat lnei;t  exo(rpno4lmtelnvi ()srtrxrpoo4tetoioetasla2el( s t) etnxo3todfm rln o t)seuoirpio4ome mnct s sDrmur ;o0optn ieiydfm emuvont)tetrmfcty1oaDrai s s trtmir ou4amenlneslsfsrtauroou1tltnif3tltfmDumums u0artnmr oytomDe n s;s t2trxo3iudlme  neil()arur(m ;u1open octatfm2ea( ont0 etnmfciytoaDr uvi s) exrirpio4al emfet tf 2taxrp;o4oeenmi3iadfa elnvs;u4teenxocty1om e neolt) rxriopnudamee fci ()srumxrpnt1tpe iieiltfa ulu snt0artrmo3oo1fpD  nvi (  rurxr oy4lltelnes tf rumxmpou0tetnio3tldlm rluvonu4 rtnirctatfmt lnvo t) eum(r3oy4alenlfcils)sDrax o;o0tpxomoeiaslmDrlu snt)teermf oytla  li o;t s2tmxopny1olte nciasf Durxm ;t1ape mfeild aDum(mon(0altnxociatlateln o (0srtmiopnu4omenlfesas)a2tr(ro;u1teto fciadla eau s u)aexrmo totfm e i s;(0texr(r ny1ol   ncs t s2raumo;t4aetomoeiatfsDum( sn()arxnmf3to1fpDranvols0 2xm(r3iy1apee feilt s2rrurpnt4tetomicils aDra(vp (4 rtoif3tadoa eanvi ()setr(mpoo4opt mnetls) rrm(mono1tet  fciad s2ean s;u)trxoxr iadomte neols)sruoir iodlm emnei tfs2taxro;o0optoio3iydfs2el(msnt)trtnxf3iatomD  nei;s) exo(mpiodlmtelivslt s2uauro;u0oex  i3tlt m2ulump;u4 rtoio3oa1omDeluesl( trtoir ny4ap e ivt () 2um(mpot4texn ietasfs ran o;(4 rxrio3ty1optr nei ()tetrxo3iydamtemnesatfs2ururpnt1alen ociadla rmn o;u) rxnir oa1lpt  uei;t  2trimpnudape  nei s) Duaxrpot4optnii3ias s umuvs;t0 rxniocoadopteanvo;(  rurio iy1alen fvs tf rrrxront4tlenioeils a ua(vp t0aexnio3ta1fmDr iei;(  2xmxm3nu1omee net sfs2tm( pot4aeeoiocilt aDumu p;t0aexrmr iy1lm eln ilt0 2xm(opnodop n ivs s s2taurp;o4apxoifctatlm rl( o;t4texoir3tydoa e u o;s)texmimpny4lmtemfeslsfsrururo;u1olx  i3iltfs uan p (0 rxnxfcty1lm elivs;t s2tmxm3no1lm n nvtlt srurum nt4tpe mo3ildlsDel(vpnu) exrmfcoytop e nei;t trum(o3oy1optelnctas sruaumpno0alt moeildfmDea(msn(0 lxrxf3todfmDeanvo;(0trxr(opoodlle lnvi (f 2urxronu1apxoif3iyslm2elnmont4 rtoir3oodlat  ieol( t2urxm3iodlpeemicsa( s2taur ;u1aetomoeiat mDua( pn(4tleomo3ootlm  aneolt0seurio3ou1alee ivil( aDrrx  nt4tpx mf3iasfaDrmn on(4 rtnio3iydfpte ueslt  eurir io1oltnmiet sfsDra(  nt1aet ifetlt mDua( s t)trenmfciydfatraiesl(0 2xrirpoy4omtnmietl() rrrxrpoo4texoifcilslmDra(vs (4tlerxrciodfaDrli i t0t2urirpiydop  mfcslt) rtrurono0alx  ictydlaDeau ont0trxoio3oytlpteauvi t0setrimpno1ap   fctatf Drru  no0oee moeiytlm2umu o;t)trtrxf3todfmtrauvol(  rurir nu4apen fctat  rtmx  ;u4opt iiciyt s2rlums t4texrmo3iatoat  i s;s0trtm(rpou1llt lnvi (fsDtmxmp;u0opxniiciysfm2eln o t4tltnxr3tydlpt  ues;(0 ruo(o3iy1apenmnvtlsfa2ur(  ;t0aet ioctlslmDum(mon(0 ltnif oy1fatelu s s)t2xoio3ny4lptnmfesas sDuru  ou0aetomoctadfa2rmnmsnu0 etnmr oo1fm   ivs;()s2xmxr3nu4omtelfvsat aDuaxrooo0oltn ocilsfs2ranmp;t)tetomfctadfmt  ueilt)srxoxm oydlmee fvil( sDrmxrooo0apenmi3tytlaDelnvp u0aeenifctytla eanvi;t0srxoim3nydopenmfet sfsDtr(r ;o1openifeiadfs2rl(mo u) exoir3totopDelueo;t0 exmxm nodlm nmfcs ( aDrmurpoo0tpe iiciydla rau s u0altnirctydfmDelu il( teuoxr oodlmte feia()sDrax pnt4olxomocilsls eluvo;u4 exnmr3io1lptr uvo s) 2xr(m iydol   fvilt) Dtax o;u1oleniiciydfs uln on(4 rtrmocty1fpDelueslt)sexoir3io1oleemfvil(fartax p;u4tet mietlt sDemnmp t0alxomf oo1lp   neil( texmir3oo4aleemiviasf rurxmpno0oeto f3ils m2em(vp t4teerio tytfa  aueils srxr(m iudom e icilsfa2rm(m nt0tetoif3iys s2ua(vp;u) rtnio tytlm   u ils)s2to(m oydap emnvtls  rua(moou4tlxoifetyd sDra(mp u0 leomoctatfpDrluvi s0trxrir3ou1am emfci t) Duru  ;t0tleo iciyt a rlumsnu)aexnxo totlmDeau olt)teurio3iy4oleemnviatfaDrr(mo;u4oleoii3iysfa2elums;(4 leoxr3ty1fat luvs t)srtrio3oo1lle  fvil(f 2rm(r ;t4opt ioeias aDelu p u0 eeoiocootfm elivo;(0 rtr(opnudopt miesas)arurxm nu0tlxoiieiyt a em( s;t0 rerio oo1fmDelieil()s2um(m io1altn icsas  rrrxm nu1tetniietydlm eluvp u)tlerxociatfm   ieo;s0t2umim3iodale miesa()a2rrxmo;o4optniieildfm2elnmon()areoirctytoaD anvi;t)trtr(mpiudopenlivil()aDrmx  ot1tlxnmoctasfs2ua( o;(0altnxf3iadomt aueo (0trumim nodomeemfvtas)artr(m no1tee ii3tls sDua( s u4arxomfcoadlate n o (0srtrio3io4op e fvslt arrrumpou0ale iicias a2rmnmsnu0 exrmf3ty1fpD lu ilt t2trim oudomtnlivs tf 2umxmpno0tlt mo3iyd m2rluvsnu0 rtomrciytlaD  uvol()s2trio oo1amte fcslt)sDraumo;t0alxniieiadla2ul( o (0aeenif3iatla ean i t0 etr(r3no1openlivt t sDur(moou0optnioeiys s2eau s t)aeeoxfciydomDelueolt0tetrir3nu1lp  lfeiltfsrtmx pno0tpx iocilslm2ranmp (0areomrctatopD an i t0 etrxm iydaptemivtls arraxr nt1olxoii3iad s2eauvo;(0areoxo todla   nei;()srum(r3nu1lpe mnvslsfartmx p;u4tlxo iciat m2uau p;t0 eeriocootlpt  ivo s)seum(m3iu1open ictltf 2tmxrpoo4tltnmocias s rm( o t4aeenmf oydfptrluvo;()seuoxr3oo4lltnmfesl(fa2rr(r no0oleo octydfm raumonu0aeerxo3oodlpte nvi;s)sexrxopiodap e ieta(f 2ra(moot1ale mf3tyslm2ra( snu)artoiocootlpDr i o;()texoxo oy1ll nmnvt s)a2trumono1tpxo iciyt sDranvp (4teeriocio1fptrlivi;t0trxmim oydll e fcsltfsrtax pnu0opt iicilsfs ranms t4arenxf3ty1la eln i;t0tetoxo io1lpe lfcs tf 2uax pnu4texnioeiasfaDum( o;() lxriociodla   nvi s0srxrim iu1ll   ivsa(farrax o;t0aeeomoeiysla rl( p t0 eerifctotlptr i ols  ruoir oo4llenmneias)srrr(rpoo4olen fciasfa ulnvpn(0alermrcto1lpteau o s0sexr(mpiu1ol   netls sruaxmpou4alx  o3tysla rmuvpn(4 rtnxo oy1lmD  uei;t)srum(m no1om  mfvilsf Dtaxmono1optomicilt a2uauvont0arxnir iatoaDranvo;s t2to(o3nodllt lncia()srrr(roou1aetn fctldlm2rlnvon(4 rtnif3oytlp   u i s0t2xo(r oy1lp  mivtat s2tau  nu4texnifeilsfs raump t4arxrifcoadoateluvi;t t2toir3ou4omtnmfcias sDrr(rpou4aeeo feiadfm rm(vont4teermfcoydom eanvi;t0 rxrio3oy1lpenlnet t a2rm(  ;t4optomo3ildla eaumsnt) eenif oodlm r ueo;()trxmimpio4lpenlivt s)a2ur(m nt0oltn ictysfmDrmn o t) etnifciatoatrlivilt)t2urxr ny1lpeemfesl()a2rm(mo;u0apxn o3iydfsDran s;u4alenxrcio1fpt li o (  euoir3ou1apte ics s  rumxm ot0teenmoeiyt aDel( s (0areomr oatlmD  n olt  rtrxopoydlltemnet tfs2rm(m ;u1aex  fciatfm2ean p (4trtnxfcio1opDr n s;( texo(m ou4lle  ictlt  rum(  nu4olen ociys sDeln s;u4aetnxf ootfp rlnvi;s)srtrxrpnudoltnlncils sDurum ;t4tex  oeils sDuan p;(4tleoio tytla r neil(0s2xmxopno1ll nlfvsl( arta(m nu0alen oeiysla2rau pn(0 ltnmfcta1omD an ol()s2xoxm oy1lltnmiviasf 2trx  ;o0opxoio3iasls2uanvp;t4aeerxr3to1omte n s s)srtoxm io4alenmnct (f Dtmu o;o4tltnioetat aDumn s;(4trenmo3tytomt  i sls  rur(r no4lm  mfes s aruauroot1optnmo3iys m rauvp;u4 exoir3oadopte ueo t0 rtmiopio1altnmiet (fsDumumpot0alt moetys a2elu p t0aleomr oytlm elieo t s2uo(opnodopeelneta( arum(m nu4oee iiciytfs ea(mont0texnmr3tatlp   neslt) 2tm(m3oy4altemfes s  Drrur no0oet mictydls2eau p;u) lxomf3ia1oatr n slt t2xrir oudlm nmfvs t artau pnu0tet iietasfa elump;u4artrmocoodomD luvolt0 rtm(m3nu1lltnlnviat a2tr(  ;u1tltnio3ildfmDra(vonu0 lxrxfcoa1oaDeauei;s  2trir3ny1ap emieil()arta(rpoo1tex mo3tysla2emn s;(0 reoxr tytfmD  nvo;s srtm(mpiydll n fvi s)a2tmxm no1oetnif3iadlm2emump u4 eeoio3totop  an i;s0tetm(m nu4ape livs sf rtrxrpnu1oltn o3ild mDelnmo;u)alxoxf iadomDr u ils  rumxm3ou1apee fesl(  2urxmp;t1opeomo3iasfmDumuvp u0 renxo oatlm r uei s setoxm iudoleelietatfsrtr(  no4alt mictatfa2ua(monu4altrio oa1fate uvsl(  2xmir io4lptemfcsl( a2tru  nt1tetnmfciaslsDranmp;u0 rxrmr iadfa r i ils)t2umxm iydal   fet s aDtr(r nt1oeeoioeiadfs umu o;u) renxo iatfpDeaueo s0sexm(m ny4lm nlfvtl(fa2um(r ;u1opto o3tlt sDraumonu0arxrmf tatfaD liei;(0 rtrxo3nudllenmncslsf ruaxm ;t0ape  o3tys m2rm(mp;u0alenxrcoy1lpD lu olt  2tmxmpiodom  mfcsltf 2uax  ;o1teenmoetydla2ran on(4tltrmf oodoaDran o;() rumxr3ny4aptemnviatf Draumonu0tpto oetatfs emnvpn(0 lxnxrcta1lmDeaueo;s  2xrxm3oodll nmiei s)aruaumpnu1tptn fciasfa2rl(mpnu0 lermo3oy1fp   n i t)srurio3nudalt  ncsa( a2rm(r nu4tpx mfcildfm ul( snt)tltrio3oytfpt  ivs () rxmxo oy1olt mfci tf Dtm( o;u1tlxo f3tadfs2rl( on(4alxomf3ta1la raueo;t0tetrxopnodlpe mietas)s2trxm ;u0aee  iciadlm ulu p u0 lxrmrctydla  an sl( s2tmio ou4lm nlfct t) rua(r ;u0tleo fcild s2rmumo;(0aetrioctadoatrlnei;s0sexo(m3iu4amtnmfvsatfsrur(m ou4tet mieild a2emumpnt)alxrxf3oadfa rlnvi;()t2trxm3nodlp  lnci t s2ururpou1tpx mi3tadlaDranvo;u0tetomf todfmD livi t0t2tmir3io4amtelncsasfs2ur(mpnt1oet  icias s uauvs u)alxrmr iytlmDrau o s srto(o iy4ol nmivsa(fa2trum ot4ape mf3tlt s2rlnmsnu0tetrir3oydlmD li i;()trxoio3oo1lpenmfvtas)s2raxm ot1tet ioeils sDrln pnu4trtrxr io1om rln o;t trtoio3iu4ll nlictas s2raurpnu4olen fcild a rmnmo u4artrxr iadlatr i o ( t2trxrpiydlm elfctl(fs2umx onu4altomfctadfa eaums (4arxnif3oadfmDran i ()sexm(o no4amtelivtl(  rtmumpno1altnmfeiys a eluvo;t4artoioctytlpteaivolt  2xoim3no4ap   neta( aDtmxrp;t4alxn fciydlm rm(mp u4artnmr3ootlp   ivs t texrxo ny1lmen ietat) rtm(mpnt0ole mictyt mDrlums t0 lermo to1lp  au ols0 eumio nu1ope  fvt (f rurxr nu0tlto ietltfa2ul( o;() etnxr iadlmt lu i t0trtrxr oy1olt lfetl(fa2ta(ront1aex  oeiad m2um( p;u0treoir iatomtr i i;(0t2xo(rpoo1omenlicil()sDtmx oot1oetoiiciyt s rl(vo ()texrir iadfatelu o;t0trto(opno4amenlnetl(fs2rrxmp;u4apxomfciytla2elnvo;t4teenircootoa eaues s) rtmxr no1am n nesasfa2tmur ou1tex  iciat sDra( snu0 rxomrctodfa r ivs;t trtrxopno1al  livtasfa2tmu  no1optn ociatfa2em( on(4tltrxr oytlpD  i o t)s2umim iu1lle micia( s2umu  ;o4tleniieiydfs2ra( p;u4 eeoxo iodfa  lnei s)seumiopoo1ll n nvias)aDuaxront0altnmfetas s2el(vo t4tltoxrcoo1lm e uvs ( seuoxr iu4llenmnei sf rtaxr ;o4tptomfctlt s eau s u0aexrmr iadlpDraneo (0 eum(o3io4omeemnvs ()srtrurono1opxo iciysls2ea(vo;u)trtnio3ootomtrauesl(0 ruo(o3iu4ape  nvtlt aDrmxronu4opeo i3ilt s2rm(vo;()tleomrctytopteauvil( sruoim3iodop elfcil(fs2rax  ou4tpt io3iyd a2eauvp t0tltrmr iadfaDrluvs t t2to(o3iu4opt mfetat) rraxr no0ole  octadls eln pnu0teerir tydfmt  i s (  rxmir3nydlp   ivsas)s2rr(rp;o1tltomi3iasfa uauvs;u4 etoifcto1fpteln i t0 rurxr3ny4altn ncs ()arrm(r ;u1olxomictltls2eaumsnu)treomr3oo1laDrlnvo;s0 2xr(rpiudop  livil( aDrmu onu1optn f3iasfa2rmums;t0 etomrcoy1opD ln o s)s2tmio oydlleelnetat sDtm(rp;o1tetomo3iltfm rm(mo;()arxrmrctydlptr n i ()trxoiopio4optn ici () rtrxmp;o0oeeo octydlsDea(mp (0tlxnmf3oatlpDe ues s  2xoxrpoo1ap  lncsat)aruaxmooo1tpxnioeiydls uaump t4aleoxf oydomDe nvs t)srtr(o ny1am n fvil() 2umxrp;o1oetnmictldlmDelumo;u4teenir oodfpt li ils0setmir3ou4lme lnei tfsrrr(r ot1tlto ictltls2umn o t4 rtrxf3todlpteau s;s0srtoxo3oy1ap nmivsl(  rrau o;u0teen oeiyslm2umuvonu4 renmr3todfatelu i;s)s2um(r3oy4omeelnes sfsDtrxrono4oltnmo3tatfs2ra(vpn(0 leomfciytlm  ai s ()seuo(m3oydoleelfcsltfs2rrxr ;u0alen i3tltlm uau p (4texomo3oo1lmt aiei t) etrxmpou1omenlictls srumxr no0tetnmieiatlmDrlnmont0aetoxo iadfpDr i slt0tetoim io4lmte nvt (fs2raur nt4olt if3tlt m2ra(mpnt)alxnxf3tydlm  aiei s0 rtoxm3nodll emicsas sDtm(m ;t0aleo oeiydla2ul( o;u0aetnxfcoa1fmDean o;(0 2xoxm3iodaptn fctat)srum(rpnu1tpx mocildlaDuanvont4tlxoif iotlate i i;(0trurir io1op   ies tfa2tm(ronu0oleomfciydfs ea(vo u4 exoxfciodfa rlnvol() euoxm nodol e fvs s arta(mpou0alxn f3iaslsDranvp ()trtoir ty1fp elieils)trtrxr3oy1ll  liesls)arurum nt1tle  ictatlm ua(ms u4aetrmr3tytlpteaivo;s trxrxo3nudaptn nei t sDtm( poo1aex  ieiydfa2ulnvs;()tlxomocta1lpD  uvi () exmxmpnu1altn fvils srtaumpnu4alenmf3ilsfm rm( p;u0 lerxf3iytfpD lu o ( trxmxr ou4lp emnvtat sDtmur ;t0ole mo3iaslm2emuvp u4tetnio oatoptranvs;s) rxrxm3ou1lptn nvsa(fsrumx pno4aexnmi3tydla elums;()aeerir3io1omtelivi;s t2urirpno4alenlfeta( arrau pnu4opx mfeilsfsDulnvp u0 etnmr tydfpDeli ilt)srumio3iodlle livslt  2tmxmo;t4opxnmi3iyt a uauvs;u4teermf tytoatr iei;s s2uoxo oudlmenmfci t srtr(mp;u1aex iocilsla rm( pn()aexnxf3todoa e ivsls t2tm(rpno4ape mneils  2um(  ot0aptomi3iadfm2ran p t)alxrxr3totlpt an s s)srtmiopno4am emivias arrru pnu4aptnmoeiat sDrlnvsn(4aeeomr ty1lpt lneols  eum(o oy1altnlnvt tfa2rmxrpot0aptomoctadfm2ua( s u) lenmfcoydlmteau i t s2xr(o3iy4llt  feil(f Drru oot0aetnmiciydfa2elu s;()alxnxf3to1optrluvol(  rxm(r ny1openmnei (  2tru  ot4oet ii3tltfm rau ont0aleoxf3iy1la eln ol(0srtr(opno4lp  mnesltf rurxmono4aexn fetlsfa2raumo;(4aetrif3iatoaDran sls0t2xrxm iodamtelivtat a2tmx pot0tee mfeiytlsDuauvs (0trenmo oodfa raivs s seumxm3oydap emfvtlt)sDtrxm nu4oex mo3iys a2eanvon() rxomr oydfpDe uvi (0sexmxmpio1lmeelnvils)aDurx pot0aeen octadfa ulumo u4tlxnmo iadlmtelueo t truoirpnodllen nvsltfaDrr( ono1apxnio3iys s2el( s;t0altnmo oydlmDraneslt)teuoxm oy4lm emncsls arumx pno4altomfeiytfaDemnvsnu0trerxf iy1lpDeluvs;s0 2toxo3io4ole  neil(f Dta(m ;t0alxnioeiysla ul( pnu)tlxoxr3io1fp eln o s t2umxr3nydolt mfvi s)sDtaur ;t0opt if3iad s2emu o;u4 reoxrcta1fp e ivs (0s2umxrpny4optn icia(  Dururo;t4aexnif3tlsfmDemnvp;t)altrxrciydlm  lnvo;(0 rtm(opnudolen nvsat) 2tm(  ot4aee miciasfaDulumo u) lxrio ta1la r ueil()sruoim nydap nlfvs tf 2tmu p;t1tetn ieiatlaDrmnmsn(4 rxnxf3ootfaDrli slt seurxm nydopenlietl()arur(ro;u1aeeomi3tldfsDranmonu0 renircio1oatrau sl(0s2trio3nodllt  fvi tf Drmxm oo4aetoiiciys a2rmu s t) eermo3oo1lp rauvs;(0 rxoio iydol nlivsls sDumx ono0opt mociyd mDum(vp;u0aeenxr tadlmtean o;s  rxrio3io4ape lncs t sDtmxm ot4tlto feiysls2ulumsnu4aleoif oy1lm r i i;s srxoirpiu4alenmfvs s) 2tmxro;t4tpx  ieias m uau o;()aexrir oo1opDeau s;t)seuoir iodlmtemictl() rrmu ono0oltoiictysfm2uaumsn(0 rtoxo3iytopte uvol() rtrio3iy1llt mfesl(fs2trx  nu4texn ieilsfa el(mo t)aeeoxo todfa r ivs s trtm(o3iy4lleelnci sf Drr(ronu0tpeoiiciasla2uaums (0 leoio3ta1la eauvils0srxmir ou4al nlnct tfa2umum oo4aleomictas aDra( p;(0aetoir iadoa ran s;t t2um(m no4am nlfviat srtmumoot0tpt iietldls eluvp;()trxnmf3oa1fmteanes t  2urxr iy1lptn fcils)aruru  ;u1tltnmo3iydfmDelumo;u)artoircio1lpD anei s seumir iu4ameelneslt a2rm(rp;u0tet iictaslm emuvp u) eeomr3todopDe nei;t s2umir3nu4am elfvt s srta( o;u0tpx mietaslsDrmumonu0altrxf3oodfm  aies;(0setmxmpno4ap e ici t sDtrxr no1tlto o3tlsfmDrl( p u0treomr todfp rai s;s t2um(r3nodlle mfvtasfsDta(m ot4alx io3iaslmDrm(msn(4tetoif iytfa   nvo;s0trxm(o nu4lpe mnvs ()arrmuroou0tpt  feils s eln snt0tltnmrcia1op rlneo s)s2xrxopoo1ale mictlt  rua(moot1aeeomocildls ua( p;t)tlxoxrcoytfpD livi t trtmim nodom nmnesls)a2rr(m ot0apxnmi3tltla2ulums;t0tlenirciotfpt aivs (  rtmxr3ny1omenlicias) 2raxmono4apeomi3iasfs rl( s u0 etomoctotopDr ieols0 etm(r ou4omtnlfcs tfaDrmx  oo0tlen ietasfs rl(mp;t0aexoifciatomt  ies;()srtmxmpoodaptelnvsa() 2ra( p;u4tet mo3ias mDrm( o;t4tlerxf tydfm eauvs;s srum(o3oydlltelict tfs2ta(mooo4apt moeiydla rm(vs (0 lermfcoadfa eli ilt tetr(m nodop elnes sfarrrx o;o4alx  o3iltlm rl(vp;(0 exnxo todomteaneo ( trxrir3iu4ape mnvtl(  2rrxrpot0opeoioctat sDumnvs u0texomf3oytomtraneo t  rxrio iy4am e ieils artmur ;u4oltomoeiat s2um(ms t) exoxrcty1oate u ils0sexo(r3no4ol emivt (  2trurpou0tpe mf3tltfa eln pnt0 eenmr3iodfp   uvo s0trxmir oudlmte feiat)aDuaurono0oexo feiltlmDeaumo t) rtoxr3tydom   nvo () 2uoxm3ou4lmeemivsl()sDraur ot1ope iiciysfaDua(mp;t0arxoif oytla r nvs;t trxoxmpnodapeemncslsf rrmx oou4apeomiciasfmDumn o;u0tlxnirctotlp   nvsls)sruo(o nu4om  micsls  rurxro;o1alto o3ildfaDuau o;u)artoio3tydom   ueo;t)t2uo(rpiy1lpee nesa(faDtax o;u4tex ifetyt a2el(vonu4 exnmr3oadfmt anvi;t) euoxo oodomee nvsas)aDuaxm ;t0oeeomoeiltfm rluvsnt0teerxr oodlpDr ieol() 2urxo3nu1lm nmict t a2rr( onu1tetnifciyslmDuanvs;t0teermr3iytoate nvi;s0seum(o iydomte nvi t) rtaurono1aetoii3iysfm2rmu o t)tlxoxo tytlpte i i s  euoio oydlm n ncs s arua( p;o4oeenif3iatfm eanmpnt) lerio tydom e neil() rtoim3oodom nmieils)aDua(  nt1aeeo ictas mDua(vsnu) rtnxr iadlaD livols s2toxmpoo4omenmncia( srua( o;t4tlto ieiasfaDuan snu4aexrir iodoa rli s;t  2xr(opnodopee nvsl() Dtrxm no1aexo iciyt m rlnvo;t)aexriocoadfatraneilt0 eumio iydapeelfct s) 2rr(mpnt1tlenioctytfm2elu p;u0tetoxrctotlaDrai s ( trtmxm nodap  livsl() 2tr(  ;t1tex  i3tadfs2ua(vs;() lenxrctatlm r u o;s s2tr(r no1am n ncsa()s2taumoou1tlxoii3iatlm rlump (4 etrio io1fmt  neo;s)trumxr io1omt lictas)aruax  ot1ape mfctat a ul( onu)texomo3totoatr nvi (0teurxr3nu4amtemneiltfa2rmx  ot4tlx moeild a2ulu o;u0aetnmf tatom  aivo;s)teum(o iy1al nmnetas)arum(m nu0tpxn iciydfs el(ms u0 rxomo3oydfat an o t0t2uoxr oudlmen net sfaDtr( p;o4opxnii3ildla ranvsn(4 etnir3ootlpD  ivils0 2xm(rpno4ol   fvtlsfarrmxmp;t4altniieiltla2eaums u4trtoxr ia1opteai sl()seuo(opiy1lm emietatfsDta( oot4olxo ictad a2el( o;(4alerxfciatoat lies s)trxoxo3iudlmtnlfcta(fsDur(ronu1openifcilsla em(vp (0artnir oy1oaD li o;s  rtrxopiy1ole  ietl( arua(r no0opx  feild aDel(mp (4artoio3oy1fmDeluei s0srto(o iu4ome lfes s aruax  ;t1oeenmiciydla rlnmo (0tleoif totlp  li olt srumxr iudopeemiet (  2uru p;o1opx mf3tytls ran o;u)arxomo tydfp raneo;( srtoxr oo4lm nmivt s  2tmxmpnu4apeomf3iad mDeanmonu0areoio3ty1faDean sl(  2umxr3ny4ole  fetlsfa2umu pot0opx miciydfm2rauvo;u0 rermfcta1oa r neols) etoxm3nu4ale lieta(fs2tmxront0oee ifciytfm2emnvp (4 rxnir totoaD  uesls s2xmim nydoptelivta() 2rr(mpou0tpxomo3tydla2umnmpnu) rxnxfctotfatelieol(  rurio iy1open ncsas)a2uaxr ou1oltnif3ildfm rl(mp ()aeeoioctodoaDraies;t) exrxr oudomt mnvt t a2raxro;t0oeenifcilt aDrlu s (0arxoxo oy1oa  luvolt0sexmxm ny1lpt lfci t sruax pno0aleomfctyslmDrmn p t4 rxrmr totom eaueolt srumxrpio4opeemnviat)sDtax  nu1alenmfcilsfs ra(vs u0trenmf3iydfp  lneil(  2uo(opio1aptnmfctlsf Dtrx  ot0ope if3tyd mDel(vsnu)artrmocoodfm rlieo;t) rtm(opoy1al  mivi (faDrau  nu4tlxoio3iasfmDumn pnt4arxnmr3io1laDe uvi;s  ruoimpiy4om n fesls  2ururpnt0tpen iciyd sDumnvo;()arenio iadfatelneilt t2xrxmpiu1lp n ivi t) Drmx  no4opxoioeiltlm ulu on(0tltoircoy1oate i s (0s2ur(m3iu4ol emfci t) rurumpoo0tpt ioeiadfa2emnvs;u4aetrifctadlmt  i sl( srtmio3nodolt mfctltf Dtmu oot0olxnmiciltls2emumsnu) exnxo3tadla r i sl(0 eum(m oodapenlncs t srrmumo;t0tpenifctatls2umnmo;t4 leoxf oa1latelivo (0 2tmxopoydopee fci (fsrtm(mp;u1apto iciltla rm(vo (4tltrxrcto1opt  ueo (0trto(rpoudom nmivs s) rrrxrpno4tetnmf3iasls rm( s t4artoif3iotfpDeanvs ()trto(rpiu1apenmnviltfs2tmx pou1tee iicilsls rl(vp;u)aleoif3tydlatelnvo;t0tetrxr3oo1oltemfvs (fa2rru p;t1tpen octlt s2rauvs u0aetnxo ta1lmt aivs;t  ruo(o ny1al   ivs t  2tr(ronu4teeoifeiyslm rmnmonu4arxnxo iatoa  li il(  rxr(o3iu1aptnmnvt sf Drru pnu1tet ii3iasfsDelu o;() etrmo oodlmDe nvsl()srxr(mpoydol  mnci ()arua(m ;o1olxomictasfsDrmnmonu4 leoir oadomteanvo;s)seto(r oudap n ivsltfs2tax  ;t4texn i3iltlm rmn p;t)aleoio3ootopD ln i ()teto(r oudam n nvia( s2rm(rp;t4tpeoii3tytls emump u0 rerxo3ootfaD  ueols)srxmxmpny1al emncsa()sDumum ;t4tleo ociyd mDum( s u0tleoio3oatop r ivs;s  2xmxmpnu4amte ivt s)a2um(m ot0alt ioctydlm elu o (4 rxoxr3tatfaDrlueslt)s2xm(r ny1lmen nct s aDum(mpot0oex  ictatlaDuauvont4texnio3oodfmt anvs t) rtm(r no4lptnmfcias a2umum ;u1apt ifeiytlm2eaump;u)alenif iytla  ai s;s s2trxrpiu4opeemnvt () rtax  oo4oltnio3iaslm ra( o (0 ltrmfcoy1fmtran i;t teuoirpoo4ome mict t)a2rrumoot1tpxo octasfsDuln pnt4 etrxr3iy1fat  n s;() 2uoxm3ou1om nlfcilt)aDtrur oo0opxoif3iatla2ea(mo u0tetomo io1fmDeaies () rtm(m3no1ope  ieiltfsrtaum ;u1opt mfciadfm el( ont0tltnxrctytla r ueo;s)t2uoirpio4lltnlieilt)a2ta( o;u0ope mictydfaDrau o;(0trtrxfcoytlateai o (  2uoxmpoo4op n fcs sf Dua(r nt1apxniieiasfm rmu o (0trtnmo tydlmteai i t0trto(o ou1am   ncsa(  2trxrp;t0optnioctldfmDemumo;u0tetnmo ia1optr nvsls) exm(o3oo4apenmnctat  2umumo;u4apxniiciad a rlumsn(4 rxnmf3iatfpte uvo;t0trtrxm3oo1ame licias)sDrrxm oo0opxoif3iatlm uauvont4trxnmr3oodom   nvs (0teur(opnu1olt  feilt sDra( pnu1tet ifctldfmDuluvp;u0 exnmrctydlp rai olt0texm(m iudom nlncsas  2tr(rpot4alxniiciadlmDuaums t4 lerxo todlptr iei;t)s2xrxo3ou4amtelnes (f 2rax pnt4oleomfeiydfmDea(mpnt0trtniocty1op ran o;s teuo(r oudap emnci ()aDtmurpno0oet  oeiys m2rlumo t0aetrircootfa eanvi t0sexr(m oo1lpt miet ( srrrxmoot4oeeniieiasfsDulnvpn(4teerxoctatomt lu i;(0seumim3oo4ol n fct ()s2trxroou1openmocilslm rlu snt)altoxfciytoaDeai ols0trxo(rpny4al emnei t) rrmurpnt4tpxo feiysfa2rauvp;(4 exoif3ia1fateaiei ( texoxopnodopeelieias sDtmu  ou0alxoifctadfa2elnvpn(0tleoxf iytlpt aivo;( srurxmpoo4optnmivias aDur( o;o1texn fetlsfm2um( s;()arenifciytfpDelues;( setr(o3no1openmicta() Dra(rpoo0tleomfcilt a2ulnvp (4 exrmrctotom  au i t0 rxmio ny1ope  fcsa()s2rr(r ;u1tpenmfcils m eaumo u0teerif3iydomtr ieil(0 rtm(rpnydomte fvsatf ruax o;t4opxniictytfsDulu snu0aexniociytopt liei s)truoiopoo4ll n ici t)a2tm(mp;t1oltomfciasfm raumont4treoxf tadfat  n sls0sruo(r no1al elicilsfsrtaumooo1oleo ictls sDrl( p;t)trxoxr tydom rli ol()texmim3nu1ale lnctasfsrur(rono1aptnmfeiat aDranms u0tetoxo todfpt  ieo t  2toxm nu1ameemnci ( srtmurpnt4tlxoio3ildfa ranvpnt4 rtrxo3tadomDe neolt srtoiopoodll elfvi ()a2rauro;t1ale  oetyd s2umu pnu)aexrmf iadfmtrli sl(  exriopiu1omt  icta(fa2tmu  nt1opxo feiatla rl( o;()aexnmfcoytfat lneslt) etoxo3no1apt mfeias)a2tax  ;o4aleomocilsfmDum(ms;()arenmo to1op rlu o t0teumirpnydlmee icias)sDrm(mp;o0tetnmf3iyslm2umnvo;u)aexoif ta1fa   i i s s2um(mpiu1altelfeil(  Duax o;o0opxn ociaslaDul(vsn(0alerif3totoat  uesl(0trtmxmpoydllenlfetasf Dua( pnt4apxoifetldfa2umn snt0 ltrxr to1lpDrluvo t0 2xo(m ny4lp nlnet s  2tmurono0tleomfcildfa um(mpnt0aeenif to1omtranesls  rtmxmpoydap   ietat srrax  ;o0oeeniociydlm2um(mp (4teeomocoa1lp rlu olt0trtoir nodomt lnvsasfsrtr(mo;t4apxnmfciasfm rauvo u0aetnmr oadfp rau s s)seuo(opiy4lmeemneilt aDtrx  nt4tptomfetat sDrmnms;u4aexrxr3to1fmD ai i s0t2tmxm3nodomt mfeilsfsDtr(rono1aexnmo3ils sDulums;(4 renxocoa1oa r nes (  2xm(o io1al nmfcsl() rurx  nt0aptnmfcias mDrlnmp u0 etnxrctatom eli i s)s2xmir3iodomeemnct () rtr(mo;t1aetn iciyt m2rmump t)arxrifctodlm  livi;()trxoiopiu1ole lieia(faDur(ro;o4apx ioeiatla rl(vo;u)trxrmf3tatlpDeluei s)t2umxm nodlle mfviat)aDtrump;t1tlt mi3iltls2rlump;u4teerxrctytomD lnvs;t)s2uoxo3ou1lp elfvilt  2tmu ono4teto icild a uauvs;u)aetomo iytlmDr i o;t0t2xrxr3iy4ol nmnesl() rumumo;u0aeeoifciadla2elnvs;t) rermo3iotla rluesls)seuoxopno4llte nvt t)artm(mpnu4oeeomoeiadfs2uau p;(4 renioctadfp ranvo;s srxmxr no1lltemfctas arraxm nt1tetnmo3iasfa em(ms;u)alermfciotom elneol(  2xmxmpou1olenmiet tfs2tr( pnt0tpen oeildlmDeanvs;t)tleoif oodlm elnvo;t  2uoir3oodamtnmfvt t  rrrxmpot1tetniiciat m2ra(vs () eenmo3totlmDrlu o s  euo(o3ny4om emnvsa()sDtrx p;u4apxomietldfaDul( snu4trenir ta1fat aueslt0s2umxo3ny1ape mfcia(faDrrxm ot1apeomi3iatfs emuvonu)altrmo3oadomD aivo;s trxmxrpiu1lpt lnvt s  2urxmonu1texn ieiatlm ranms t4tetrir3todomtr nvil(  etrim no1ape  ictl(f Dra(  no4ope mfcils aDrmn s;u4arenxrcoy1fmD  i ils)trur(mpoo4amtnlnctlsfsrrr(roou1alxomfctad s2uluvp t)teeoxfcto1fm  lueol(0setoxm3ou1al elnviatfa2urxr ;u0tlenmociat mDumnmont0texnir3iodlm   uvolt t2tr(rpoudlme mietatfsDtr(rp;u1oetniictld a2rln p;u0aexrmo3oytoaDr nvs s)trumxmpny1apte fvias aruaxr ;u4ape iictlsfs elu s t4texrmr iotfat anei t)srxoim oo1lmen icil() 2rrx p;t1alt ioeiyslsDuauvon() lxoir iotom   nvs;()t2xr(o nydol elnvtl()sDumump;u0aetoifeilsls rlump;()texomocoy1la rlueols)teumir iydole liesltfsrrmxmono0olx moeiatfmDeln o (4trxrmociy1lpDrauvi;s0 rur(o iodaptn fvia(  Draumpnt0tlxomoeild s2rlu s;t) etoif io1lp ranei;(0s2toxo3no4am  mieiatfaDur(mono0oex iiciatlmDeanmon(0 lxoir3iy1lm e nes;s0t2xrim io1ole lnvta(fsDtm( ono0aptn feiatlm eluvp t4artriociytomtraies;t0srtmxo oudllee ieiltfsDumur ;t4aexo i3iasfa2emnvsnu) eerir3tatoaDrlues (0s2xo(rpny1aptnlicil() rra(rpot4ole mfcilt mDran o t4artrmr oadlm rliei t)t2urirpoo1ome livt sfsDrru  ot0tleniocias s emu sn
\ No newline at end of file
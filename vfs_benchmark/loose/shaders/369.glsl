@@ -0,0 +1 @@
+nvols0 rtmir3no1alee fctls) Drmx  ;u1aex mf3iltfaDeaums;(4trermo to1fm elueo;s)sruriopiy1olee ieias) 2rr( p;u0opx  oetytfm eanmp;t4areomr iy1lpD aues;(  2toio oydlm emivta(  Durump;t1tex mictytlsDrl( p;u)tltrxr iadop rlieo t0 etmxo iu4optelnet (f rrm(  ;o1teeoiictysfaDrauvonu0 lxomo ta1fa elivi s)seuoir3ny1lmtnlivtlsf 2tmu poo1olxo f3tyd m em( s u4 reoirctotlaDrliei;(0s2ur(r3ny4ole  iesasf 2taxroot0olxnmietytfm2ean onu0 etnxr3tadoaDe uei ( srxrio3nudome lnvsl( arrrx ont1olxniiciad m2rl(msnu0altrmr3oatfm e nvslt)t2xoim3iudol   fetls)a2trur ;u0ope ioctysls2ra(vp;t4trtrio3ty1lm r ivi ()s2urxmpoudop n fct (f 2raxm ;o1opxomf3iad m ra(vpnu4tlenxo3tatoa r nei;(0 exmim nudol n fvilsf Drrx ono1tpxnii3tat a2ua(vo (0trenxr3oadfp  auvi (0setmxr io4om elics t)sDra(rpnu1oex mfetytfa2rm( pnt4aexomr ty1lmt  i o ( tetmim3iu4lmtemietlt  rurxm no0aeeoif3tyt m elnvpnt0altrmocoatfpteaneilt)tetm(mpno1openmnei (  Dua(rono1tlxomfeildlsDrluvon(4arxnmf3iydfpDr ivs s)s2urxopoudlpt liviat)a2rrxro;t4altoii3tld a2raumo (0 ltnir3todom  an i;t0setmirpou4ole livtlt) rtr(ro;o1oee  fciydla2uan snt)teeoxfcio1fmt aivo;t0 rumim3nydaltnmnvil() rrru  ou0aeeo ictyd a ranmo;t4 eenifcoadopDrlivs t texoxrpnudlm n icslsf 2ra(mpou1aptnii3iat sDeluvpnt)trxoifciadoatranvols) etriopiodlpen ivi s)sDurum ;u4oet mf3tadlaDeanmon(0 ltnif tydlat  u sl(0s2ur(opiy4lpte nct ()s2raxm no4olt  fciyt s elumo;()tetrxf ootlpDr ueil()trxoxo3oodll  lictas  Dua(r ;u0alt mfciadfaDulu sn(4 leoxo totlateln o (0trxr(opio1ll   nei sfsrtrx  ;o1oleo oeiat sDemnmo ()aetrmo ootfaD  ueslt0t2xm(m nu4lp   fvtas arrmx o;u1optn fetldls eau sn(0 rxomf3iadfaDraueils0t2uo(m iy4op   fetat aDuau pnu4alxomf3tydls elnvo t4 etrxr tadomDelneo t0s2to(r iydllt  ict (  rtm(mooo1ape iieilslm2umn p u4tltomo oadfm rau ils  rur(m nodoltemnvsatf 2tmxro;o4texo i3iatla2ean on(4tlxrmfcoa1fm e nes t0s2tm(m iodamenmieiat arur(r ou0tex mfeias sDel( s;(0 rtriocio1lpteau o ()teum(r iodlp nlfcsa(f Drrumo;t4aleoifeias a uan pnu0texoifctodlmtr u olt)s2urxo3io4ap nlfvi s) 2rrx  ;t0tpe  ieils m2ra(vo t4 rtnio to1omte ivi;( texoxmpiy4lme lnvsls s2rrx  nt4alenifctasfaDrlnmo (4 rxoio3ta1fpD lnvo;(  exoxm3ou1lm nlncsa(fsrur(rp;o4apxomiciytfaDeln onu)arenif iydoat  i ol()tetmxmpiu1lpeelncia( aDua(ront1oex  feiyd s rmuvo;t0areomf iatoat ln ilt0s2toxo3oo1apte fctl() 2tau  no1tleo oetlsfmDulnvon()trtnxo iadlatr ueo;t0trumxo no1ll nlivsls  Dtmurpoo4aleomiciasfaDem( p () rxrmo tatfp  auvolt s2xrxm3ou1llee icil() rumxro;u1tetomoetltfsDulump (0 rermoctytlp   n i;() rxr(r no4apt lfvils) Dtrx  nu4olen i3tysls umn pnt) rxrxf tydlptrlu olt0srxrxm iudal e nvsa(f ruau  nu4tpt mictasfaDeanvs t0 exrmf3iatfm e i i;t)t2ur(mpnu4op nmieta()a2rrxmoou4texo feiltlmDrlnvp;()tltnmrctodfaDeai olt s2ur(m3ny1llen ictat s2trum ;u0tet iietadlm ul(vp u0trxrmf3tydomD aneo;s t2toio no4lp nliei s)aDrau  ;o0tpxn feiysla rm(vo ()texrmrcoadop rauvs;s)s2umir oydalt mnvi t  rrmx  nt0oetnmfcias aDrlu o;u4tltnif ootomte neo;s) exo(mpio4omeelivi tfs2rau  ou4tpe  fctltfmDeauvs;()alxnxfctadopDrln i () etr(m ou1ole  nvsasfaDta(moou4oeto iciltfs uan s u0aleoxo3iy1om ean ilt0srurimpoo1openlnctl(fsDuaurpou4alt mf3tas a ul(mon(4alxnmr3tytopteau o (0 exmxm3nu4omenmfetat) Dtrumo;o4tlxn icias a2emn pnt4tetnmo todfp   ieolt t2tmxm iudlm emfvta()a2raumo;u0ope mo3iasfs2rlu p u0tlenio todfmDrlnvols0seuo(mpnudlpte ivils)arrrx poo0optomi3tas m2uau pn(0 leoio ootfaD  ues ( setoio3nu4lmtelivias arumxrono1aetnio3tadlmDrau snu)arermf iadfpt livs s0t2xr(o3nodll e iet s  rrm( p;o1tpxoifeiytlm2rau pnu0 lxoxf3oytlaD  n olt)truriopnodaleelfeiat)s2ua(mont4aptn fetatla2eauvsnt0aexnmf3iotom rai o (  2xmiopiy1amen nes (  2rmum ou4tpto octasfmDrlnvon(4tltnio ty1fptr iei t sexoim ny4lpe micias a2rmurpot0tlen feildfa rmn o;() reoxr3tytlpt lieo ()truoxo ny4ole lfvilsfarrau pno0olxomoctlt sDum(vpnu0 lxomf3to1fm  aiei;s)srxmxr ou1alen ivtatfa2truront4olto ieiaslsDemnvs t4 etrmr oytop eaneo;(  rxm(mpnudlp  mneia(  rtrumont1tlxoifeilslm ranmont4tlxrmr3iatfa eai o (0 2uo(o3oy4openmfviat) Dtau onu1olx  ieiatlaDrmu on() ltrxocoadlmDrlueo;t)trto(m oudll n fvsl(fs2tr(m ou1teeoifctas a umums;t)aeermo3oadlpDran o;t texrxrpou1lp e fctat sDum( ooo0tpe ii3ildfa um(vpn(4trxnircoadfaDeanvi (0srtrxmpoy1amtnlnetls a2rmu pot0olen i3iat mDulnvont0 ltrio oodfmDrai ols truoio3ou4alenlici s s2trurono4oltnmociyt a2elnmo;u4 rerxf ia1faDe uvilt)tetrxopio4ale lnetltfsrrrur nu1oexnif3iatlmDum(vs;t0 leoxr tadomD auvsl(0 eumxopnu4ome livilt)s2ra(mpnu0oltniietysla2el( p;u4altoxo iatlp elueolt)trxo(m3io1lme  nctas) rta(m ;o1aeeoii3tydfsDra( s t)aeeoxr iadfp eaivilt0s2ur(r3iy1op  lict tf Drm(mpot4opto oetadfs ra( s u0trtnxf3oydop rlivol(0t2xoxr ou4olte icsls  2rr(mooo0aptoio3tls mDel(vp ()trxrmr tadlp eaues s seuoxm iy1llee fcsasfsDra(mpnu4tee mfcias a rm( o (0 eenirctadomt lues;t sexr(r3ou1ap emfes t)sDrru  ;o4tltoiociasfmDrlums (4aexrxo ootopt luvilt) 2toxr no1ol   fcs s aDtrumpno0tptomociat m ranvo;u)arxnxf3iytoa eaies;t0teumio ou1lpe  ivtat arurum ;u4alto ictydlsDel(vont4 ltrio iy1lmtelivs;s s2umxrpoo4alenmiesas arumur nu1aee  iciydla el(mo;u4trenxf ta1omt  uvolt0srurxo iu4lme  ict s sruaxr ;o0aeto f3ilslsDua(vpnt0tlermo3iydfat lu o;s)s2xr(mpnu1alt lnvs ( s2umxrp;o4ole  f3iadfm ea(mpnu0 rtnmrciatomDr ueol(0 eto(r3no1ap emict s arrrx oou0texo ictlt s2umn s t)aeenmo3oy1oa ranes s0 2xoxr3oudom  lnvilsfa2urur ;o0altn f3iaslm umnvsnt) etoif oadfmD lueols) 2tmxr3ny4openlnvtasfaDrmxmonu4tltnifeiyd a um( sn()altnxrcto1om   ueo s0srxmxm ou4amt lfctls  2rr(rpno0alx iocilt mDrauvsn(0trtrmr3iytopDraues;t trtmxr iu4lptnlfciasfaDumx pnt0tptoioeiad a emn o ()tlerioctadoaDrlnei t0trxm(opou4lleelfvsa()sDurxrooo0opt  oeilslaDua( on()tetoxf3iatoaDranvol() ruoxo nudolee ivils)a2tru pnu1alto o3tydlm ulumo;(4trenmr3iadlptrlu slt  rxrxr3ny4llt lieils srraxmono1tee ii3ildfsDemn s;t0 renir ty1oaD lnvils0tetmxo3oydalt mfcilsfaDrr(mpno1teen octad s emnmp;t4 rxnxr3iadfmtrai sl( trurxo oy4amt  ivi tf 2ur(r oo0tpxnif3iydfm2uanmp t)artnxo3tadla r uvs ()setrio3oydlp e nesls sDraur nt1opx  i3tlslm rmu o;() exnmo3ia1lmDraies ( texmxopny1omeemiviat  2trxronu0aeto o3iad s el( s ()artomf oadfm eauvs;(0t2xo(m iu4ape mncsls)s2rmurp;u0olxn o3tls aDem( p;t0 rxrir tydopt livs t texrirpno1lltnliviltfsDuau  oo0olt ioctat s ulnvo;u4tetrir ta1faDraivo t0 exoim3oo4lmtemiesl(  rra( ooo0tpxnii3iltfmDelums (0 rtnmr iatfaDr ieo;( srxmimpoudaltnmfvtls  Draum ;u1oexomictyt m2rlumo;t0texoxo iatfm rai slt0t2xmio iudal  lfvta( s2uaxm nu4oex miciydfs eanvs () renifctotom rau sl(  etmio3nodaptelivil(  rrr( p;u1tet mfctasfs2emu pnt)trtomo todfaDr nvs s seurio ou1alt lnetlt aDumxr ;u4tleoiietasla2rlumo u4 lxnif oadfp raneslt)teumxr no4lltnlivtl(  rum(mpnt0apen feiadfsDem(vont) exoxr iadomDe i s s  rxr(m iudom  mnetat) Dumu ono0tpt mo3iatfm umu s;t4tetrirciytfmDr uvs;s0seumxo3iodlpt  nes tf 2ua(rpot4aex ifeiatfaDulnmonu)treoxociotomte uvil()seurxmpou4lp  mictasfaDrr(mont0oleo ociad a2umumsn(4alxrmfciytfpDrauvo s s2uo(r iudlme  ncia( s2umur nt1opxo ieiyt m elnmo u0aeenir3iatoatr i o;(0trxrirpoodlpe mfesat  rtrx ono4tlenioeiasfa eau p;t4 rerio tytoaDe iei t texrxr nudap  lfviasfsrrmxront1alt ii3tatfaDuau ont)artomo oa1fmtrau il( s2xo(m3io4lp   nctlt) 2ur(rooo1tleomoctydfm ran s;t4texnioctadomtrlieolt  exrir3oydamte fvtas) Draump;o0apxnifeiadlm emumpn() reomrcoo1lpteauvo;t)trxo(o iydlleelieslt s2uaur oo4opxomociytfa2uauvpn(4alxrmr iydfaD  iei s0trxmxm oudom   ictas)a2tm(mooo0tpt micilt mDuau o u4texnmo ootopt lies s) rxr(rpno4lltn nvsas)sruau  nt4aexn oeiatfsDumnms u4aeeomr3iotlmD  u s;(0truoxr oydome mncil( artmxmpnu4tlx  f3iaslaDuan o (4 rxoiocoadlmt aivs ( sexmiopoudlp  lfvi sfsDurur oo1aleo i3ias s rln pnu)arxomo3iy1om   i o;s0 rtmir3oudam elneta()arta(r no1aexomfeils s2uln p (4 eermoctodomDe ieol(0teuoiopoudlp elfciat  Duaxmpot0texo octas a2ulnmp ()artnmo iotfatrauvi;s)t2trxo3io1ameemfctat) Drm(root4oex io3iltls2rlnmp (4tltomfcoo1lm r ivi;()tetoio oy1omt lnctat)srtrxmoou0altnmf3iadfm2umnvpn()tlxrio ta1lpDraieo (0 rxmxrpou1ome  fcias)aDtrumonu4ale  f3tydfm rmuvon(0alermfcoydfmDe ieo;(0srtmimpny4alen nvs t) 2ur(mont0oetn feias m2uauvo;(0trenxfcoo1omtelivols0srtrir iu1apt mivtls) 2urumo;t4oex  ictldla ranvs;u0arxnif3tatlpteai i s0srtmxm3oy4opt mneias) 2ra(rpnt0optnmieiltls elumpnt)teerxoctotomteluvo;s s2xo(opoodoptelnvsat)sDtr(r ;t1tpxo fetltfaDran s u) eerxoctotlpD  ivs;t) ruoir3iodlm   fetat)arumurp;o1oet ii3tasfa ul(vp;(4texrircty1fmD  uesl(  rxo(r3oy1ape livi t)artmxront0tpx  f3iysfmDuan snt)teenmr to1fm  aivo;t0t2xrxo3iu1am   fct sf rua( o;t0aexo ociltlaDrlums (0 etrifciy1oa raies t)t2uoiopio4optnlnct t)sDrrxm ou0aetnmfcias a2rlu sn(0alerxr oa1faDe ieo;s)t2umxmpio1lp elfes ( aDtrumpot4apx mi3iyd m eau p;u0alxrxrciotom   i o t0srto(r nu1lmenmfct t artmxr ot1apx ioeilslm2eaumont4artnmr iy1lm  lnvo;s)t2xrxr oy4aptelfeia(fartrur ;o0aptoio3iltfm2umn p;(4artnxf3tatlp r uei ( tetrxm3no1olt mieias)srrm(  oo4altomicilslmDem( p u)trtnif iy1lat lnvs;t s2tmim3nudlptnliet t)srtr( pot1optnmoeias m uluvon() eerio3oo1lpD aiei;s0 ruoxopiodolen fci () 2taum nt1ape  iciytfs2em(vs;u0alerxr totfa eauesl( trxmio3iu4apt lfvsl(  2rmum ou4tet io3ils mDem( p () lxoxf3oydomDe uesl(0 2tr(o3ou4lp   nvta( sDtm(ro;u4apto f3ild s2eanmo t0 lenio3ootoa rlivsl(  ruoio3nu1amenlfeslsfaDtaurono1apxnif3iytfs2el(vp;t) rxrxrctotopD anes (0sexrirpiy4al nlfesl()srrr(rpot0teenif3iltls2umnms;t0 rerxrctydopt livi;t s2trirpnu1al elict (  Dtmu  nt4opt iicilt aDra(mont)trerif3oatoateliei ( t2ur(m iy4lp emics t artmx p;o4altnio3iadlm umn on()arxnxr3oodoaD ai s ( srxr(mpio4ll  lncsls a2rm(m ;u0aex mieildfaDemuvpn()treoifctadlpDe u ils0 2umir iu1lmtemneias)s2ur( pot4olxomoeilslmDrmnmonu4tetnxf3ia1fpt li s (0sexmxr nydlmtelictl(fsDuru o;t1alenioetysfaDel( s;t)aetnmf totlptrlieol(0srumio oy4omtnmnviasf rumxrpot4oex ioeiydlm2em(mo;t4 rtnmr3iotfatelnvsl( srtoimpoodlptnmneiatf Drr( p;u1aeto iciasfsDra(mo;()tetoxociadfpD  ivsl(  rxriopoydaltnlivi s) 2rruroot0tpx  fciltfm2rmn p;() rxomr3oatom rlnes (  2xoiopiydom elivsas)aDumx pot1aexnmictyt s2elnmo;() rtnxr3oadlaDe n ils seur(o iudamte nes ( s2rau  ;o0oet ioeiysla rln o;t0trenif tydoptraieo t truoirpiodal  lfcs t)arrmxm ;u4tpeomi3tasfs rluvpnt) etoif3iodfaD  ieolt0t2xoxr ou4altemnesa(f 2tm( poo0oleomi3tytlm ulump u)aetrmr todlpDrlivi;t)t2toxopnu4lmeelfvi tfs2tru o;t1aee mi3iyslsDra(mon() leoxocio1op elu o s) rtoxopoo1altnlnesls sDurx ooo0teeomfciysfs umn s;u)artrmrcoa1oatelnvslt)t2tmxr3iodaleemfct s  2uaur nt4tptoioeiysfs2uan snu4tltnxo oatomDr uvo t0t2umir3iydlp nlfvs () Drrxmpot4tleniieiltls emu onu0altrmf to1fmtrauvilt  etm(r3iy1lmt mfctat s2umu p;t0openif3tlslmDul( p;u0alxnmfcoa1omteai ol(0srtmio iy1apte fei s)aDtrx  ;t0oleo feiad s2em(vsnu4altoxo oydoatelnvs t)t2uo(rpoy1ole lncsa( arum(r ;u1aexnmieiasfmDuluvont)arenmrctatop raieols0sruo(opny4open fciatfsDtmxm ot1tpxo ietls a elu snu) leomf tatfaD ai o;t0texoim3iu4am n nvtas)aruau poo4altoioctatla2eaump;u0texnmoctotfatr n sls0trum(r3nu4opt mnvs s artrx pou1tpxoifcilsfsDulu p;u0 eeniocootfpt  nvo;s0 eumirpiy1oltn feils srrmuroou0tee if3tadla2rauvs ()tlermocty1omDeau o s s2triopnu4ll  liviatf Drrx p;o1aeeomociyt s2rlnmp;u)aexrio to1op e neo s setr(m iydolenmfetas  rua(mo;u1aexomi3iytla2el( o;t4aetrxf3oatopD livi;( tetoiopio4llen fcias a2urx  oo1oltoifetldls ranvp;(0altnir oatlp  luvi;( texrxr oy1llen fes (fa2tmu  ;o1tpx mfetad s2rmumon(4 renmo oytfmt ai s;( seum(m iu4lp  lnei t artmxm no0oet moetadla2em(vp;t4alxoir iotomDraies (0s2tmio3iodol  lictasfaDrr( o;t1tle ifeiydfsDeau snu) exomr3tatfa   iei;(0 rtoio iu4lmtelncias) 2rr( pno1texnmfeiat m rm(mp () etnmr ta1op   n o;(  euoim3iodomeemiei ( artrurpnu0open i3iadfa2ean p t)arerxr tydlpteln s;t)trtrio3nu4op  lfci sfaruaxrpoo1tlt ioctasfa ra( p t) ltnmr3tatfat  uvolt)setmxr3ou1lltnmicslt)s2tr( pno0alen ieiyslsDeluvpnu)arerxo oa1fptr u i;(0 2tr(o3iydalt mfvs (fartm(rp;o1aeeo f3iatlm eanms;(0 eeoxr tytlmtrli s;t  rtrio oudalee iciltf Dum(ro;u4aee  oeiydlsDea(msnu0altrmo3io1oa rai il()srum(rpiudllt miesl(faDum(ro;o1teeomoctlt m uluvs;t4 rxrifciotlm elies s  exmxmpiodom  mncs (fa2rr( o;t1teenmfetatla2rmnvsn(0aetnxf3ootlm  lu il( t2to(r3ny4apen nesas srururonu0oet mo3tlsls ra(vp;(4tlxrif to1fpDr neol() 2tr(r3ny4lp   fctas  rtmuronu1oeto ictydfm2emnmon(0altnmf3iatoptr ivs ()t2xmio3nu1opt lieilt)arua( p;o4aee  i3iltlm um(vs;t) rerio ootlpDrau s t0t2um(opiydamen netas)srtm(  ou0oleomi3tyslaDrl( p t0 rermo3iadfa r ieolt truo(o iu4al   ivsl( aDraur oo4alxomociysfsDulu o t) ltrxrcoatfm   i sl(0trxoir3nodoptn netlt)sDraxmpno4altnmi3tas s el(mp;t4artnifctydfp  li i;s0trumir3nudol nmicias  Durxr nu1aetomo3tls aDran p;u0 etnifctatfptranei s0trxmir oydlp  mivt ( s2rm(m nu4aex iietad s ean snt0tlerxf3todlate u o s trumxmpoy1llen nvs (fsrumur ;t1alx moeiasls2umumo (0texrxoctadomt  nes s)tetm(r3nu4openmnvt t)aDum( onu0tlen feiytfm elump;t) eerifcoatlaDeluei s0trumio iodale mnetls sDrrur nt4optnmi3ildlsDea(vo;u4artomocoo1omDrauvi;( t2umir no1alte fct tfa2tr(roou0apxoii3iat m rmnvo t4aexnxr io1lmDeaivsls) eum(r iodolee ieslsfaDtr( p;t1aexnio3tlt a2rlnvsn()alxrmfctytoat luei;(  eumiopiu4olen feilt)s2raxro;t4olx moetysfm2rl(msnu)alenmr ia1op e uei;s  eum(o3oy4lp  lfet t  2trx oou1tet moeiytfs elnmont0 rtriocoatla e nei ()tetoir3iu4al nmnci (f Dua(mpou4apeo icilsla2umnmo t)tlermfciytlaDeluesl( t2xrxrpno4lpenlfvsls) 2rmxrpnu4apto fetls m2uln s ()alxrxr tytlmDeauvi s0 eur(r nydll   ies t)a2taurono4tpenii3iadfa2umu p ()arenmo3oodoat  iesl( t2xoimpio1ol nmnvt tfs2trum ot0apto oeiydlm uan p (4aeerif3iodfa rlieslt) eum(rpou1ome livtltfaDtr( ono4oee  o3tasfs rlnmsn() etnir3iytomD li o (0truo(m3iy1lmeemnctl()s2taxront0ope  i3iydla2ea(vp u4tlermo3iydfat  i i t)setoir io4al emivsa() rrmu p;u0tee moeiytlm raump t)aexnxr tydfa ean il(  rtoxo iy1ll  lnvia(f Dtr(mp;u4alxnmo3iyd m uauvs t0 exoxo3io1lptrluvo;t0tetmxrpnu4lmtemnet t artrx  ou0tlenmo3iydfs2rau s (4trtrxf ia1oa rlnvo t)trxrxr iydoptnmivsas arta(mpoo4alenifciatfa em(mpnu0aeeoxf iytoat lneils tetmxopiy1ap n fci s) 2tm(  oo0alt  icild mDranms (0aleoxr todfmt an olt trxo(r3nudlltnlfet t)arrr(m no0opxomoetadlm2umumo (0aexnio oytfmDelieslt0 eurxr3ou4openlnvta( aDtr(ro;u4olen fcildfa2rm( o t4tetnxfciotfm  aueo t t2xrxr no1lle livslt)srurxro;u1altomi3iaslmDrau pnu4aexomrctotopDr u i t texo(r oy4olt  fvs t)a2rrx oot0tleoif3iaslmDul(vo;u0tlenxf oodlptrlnei;()t2tm(m3oudllt  nctasf Durx  ;o1apeoioeild s2rm( p;t0trxnmf iydoaD  u ols  2xmxr oy1al n icsatf rrau  ;t0tptomo3iysfa uanvon()tetoxfctatfatrlivo ( srtmiopou4amenmnetatfaDuaxrpot1tpxnioeiysls umnms;t0arxnmf ta1omDr uei (  2toimpiy4am elnvia( arrmur nt0tee iieiadla uau s (0 eeomociatlat aieils0t2um(m oo4olenlfeia(f 2tm(r ot0optomietat s rln p t4 lxnif tytopDraueils srxmir io1op e iesls)sDrrum ;t4aeenmieilt s um( sn(4arxomfciodfm r ivils0tetoir oudaltn ivslt a2uax pot0tee miciyd mDra(vpnu4tltnirciydfm  ln o (0srur(m3oudome lnvtas)srtau  oo0oet ifetasfs2umu ont0arermr3oodfm e uvsl(0tetr(opno4lptn fviat) Durx pno0olenifeiaslm ulnvsn() leomr tatlm elneilt)trtrir ny4llee ictltf Dtaxmo;u0oetomi3tlt a2rauvo;(0texoircto1laD  uvo;()t2xrir nodoptemivtl() rum(  ou4aex  f3tytfs em(mp (0 ltnioctatlpDeaivs;(0srurxrpou1aptemivt sf 2urx  ;t1aee iietlsfs ua(vo () rermrcoadfpDrlu s ( setoim no4lltnmfetl(fsDraurpnt0tpxnio3tys a elnms;u4 rtoxo tatlmD livo;( t2uoim3nodolt mnvsls  Dur( pnt1alx mociyt mDemnmo u)trxoif iodom  lu ilt setrir iu4am  mnctasf 2trumpnt1tlt  i3ild mDrlums u0teermf iotla   ues s) eum(m3iu4ll n nvslt)s2rr( p;o0altnmietld s rm(mp (0 lerxf to1fmt lu s s  2toim iodlle mictls  Dtax pou0altnioctysfs el(vs u)tltomf oo1fm rauesl(  2umir iodamt licia(f Dum(m no4apx ioctatfaDea( onu) ltoirctodlatr ivs (0 rto(r3ou4altelnet (fa2ua(r nt0aexomoetlslm ul( o u4aexnir tytfa r nvo;( trtr(r nu4lp e ietlt  Dta(mono1alxnmoeiatfmDrl(vs ()tetnmo tatlpD  ivols tetoio3oodlmt lieta()s2rmxmpnt0oee  i3iyd m2um(vo ()alerir3ootlmD livsl(0seto(rpny4am e iviatfaDrr(mp;u1aeto ociad mDrauvpnt)trtnifcoytop raivs;(  rtrimpiodol  mfctl(farra(rp;t1olxnmfciad aDemumo u)artrxr iytoptrauvs;(  exrio3ny4lp nlfvia(fartru o;u0tet  oeias a2umnvp t4arermf3tytom   uvo t0 euoio3oo1ap nmivilt)a2raumo;u0oexnioetydfaDrl(vp u0trtnmo3iodlm ranvi;t) 2xrir ny1lpeemfvi sfsrtm(mpnt0aee io3iydfa2ul(vo u)aeerxo3ootoa  aivo;t)trxrirpiodame mfvsas)sDururo;t0oltomf3tasls ua(mp u)tltoircoodlp eln ils0 rxo(o3nu1apte ivsa()sDtaxmono1tlto oetlsfm2uan sn(0tlenxf ta1om ranvsl() 2xmxo3oy4amtelnetl()s2ta(mpoo0alenif3ilsla elump ()texoxr3ootlpDeauesl(  rxrxr3oy1lpt  ictl(faDum( ooo4teenmi3tlt s el(vp;u4 eenifcio1fmt  ueo ( t2tmir ou1ap   ivt s) 2tau  ou4tle io3iadfa2ua(vo;(0altoxr3to1omtr i i;s0 eumir ou1lptn fvils)arraxront0oexn fetadlaDrm(vs ()tltoif oytfm   ieils srtmxm iudomeemieilsf ruau pot4tpx iociyt a ul(vo;u0texnxo ta1fpDr neo t s2urxr3io4lpte icsl(fa2ta(r ;t1aexo oetytlaDelumo () lxrmr3iy1fpDrliei;t)teur(rpny1om  miesl( srtr(r ;u0tlxomf3tad aDul(ms ()altoxocty1fp e neo;t teumir3ny4lltn fesls)arrmxrp;u4aptoii3iltla2raump u4arxrirciotopt aivi s texmim3iu4op  mfetl(f rumxr ;t0aetn f3tys sDeanmsnt0 rxnir3iatfptrlneo ( seuo(opno4altnmfcta(fsrta(roou1tptoif3iadfa ua(vsnu0 rermrcty1lpt  ivs;(0t2xrxr oydamt  fcslt) 2taurpou0tex  fciasfs ra(vo;t4altrif iotfmD  n s;(0setmirpoy4apenmnvias s2taurp;t4alx micild m2em(vpnt)alxrmociodfmtrauvo ( s2tmxopny1am emfcias) ruau poo0aeen ociaslm2rmnmon(0artnir iadla e u o s0trxoxr iu1apt micils aDrm(r nu4tet ii3iat s2ua(vp u) renxocoa1lp e u s s0sruoiopoy1op  lnci s a2tm(ro;o1opx ioctltlsDrm(mp;t4 rxrxrcia1laDe ueol( trtmxo oydomtelicsls)sDur( p;u0tet mictlt s2rmuvs;t4arxrifciy1lm elivilt srxoim3iodop n fesas)s2umx  ;u0aetnifciyt m uan o () rtoifcoatoat  uesls0tetm(o3nu4lpt lfvt t)arum(  oo1opt  o3iyd a2raumpnu4teenif3totlmtelneslt)t2umio ny4lm nmncilsfaDurur ou4alenifeildla2ul(mo;(0 lxomfcoatfa r u sl( texmxrpoudlpe licsa( sDrmurp;u1aptnifeiad a uanmo t)trenif iotlmDrai o;s srxmxm oodlpenlfet (f 2ra(ro;u4tlxoiieias sDea( s t) etoifcto1omDeai o s0trto(r3oy1opte netl() rtmump;u4teeomfeiasfm2ea(mon(4 rxnmociotfaDeaneo;s  rur(mpoudlp  licsls) rrax ont1altn fctadlaDelu o u)aexnxr oo1omDe n o;t  exrxr nudlp elnci t)aDurumpoo1tleo o3ildfs2um( on(4tlenxfciadlmDeaneslt srumir3oodope  neiat)aDraur no0oex mictltlmDran snu)tltoxfcia1opDrli o;(0tetr(mpoudlp   ncsasfsruax oot4tltoifeiys s umu pnt)texoio tatlpt aneo ()srtoimpoo1alte fetas)a2ra(m ;t1tee  ieiltfm2ul(mont)aeenio3oo1lptrliesl(0trurimpiu1lptemfesltf Dur(rpoo0tpxn i3ildls ran s;(0tleomfcty1faD liei t srtrio io1olenmfeslt)sDrmxmp;o4alt mociad a el(mp;t) leoifciadoptrln o;s0s2tmio3io1omee ncsls s2tr( p;u1oet  o3tatls elnvont0tltoxrcoytlat  uvi;t0trurim3nydapte ietatf Drm( o;o4teen feild a eau on()tlxnir3totfmtean ol(0trxo(m3ny4ap   ieia( s2tru pou0oexoio3iat m um( o u4 eermo3oytoptrluvo;t  2xoirpiudom emncil(f 2raurpno0aptomo3ildfaDrmnvs;u0trxnmo iy1lpt aieo s  rurxrpiodllen fvsls)arurumo;t4oet iicilslm2rlnmo (4trenmrctytlat  nvo;s0 exmxm3no1lmtn ietltf 2uaurpnt4aeeoifciasfm2eluvsn(0 etoxf iadlm rauesl(0trtrxm3iy4ope mivi t  ruaxrpnt0olxn ieiatlm2ea(vs (4aexrir3ootlat ai i;()tetmir3nodopen fcil(f Dumumpot4olt  oetydfs ulnvsnt)trtnmf3ia1lm  anes;()t2ur(o3nu1omt mict tfa2tr(mono1alx  feiytfs em(vs t4aeerxr iydlateai il()trum(r oy4altn feil(f Drr(ront0opeomocilsla eanmp (4 rtomr3tydfp e i o;(0 euoxr oo4op nmfvtas a2um(mp;t0oet  ociltfs2ea( p;(4 reoir3tadlp ean i;( s2xrio3oudaltemfvta(fsrtrum ot0tlx  oetls a2uluvo;t4tlenmrcoo1opD an ils srumxm3nydolee ieil()a2rrumpou1alxoioetltfs2em(von(0artoifctatfate u i t  eumxm3nu4al e nctltfa2rmxm no0tltn ociadlaDean s;() exrir3to1fptr i i;(0s2um(o no4lle lnvtltfs2rrxm ot1tex iieiyd mDul(vp;u)teeoxf oy1fm elu s t0 ruoio oo1olte ivi ()s2rr(rpou1aetnioctltfaDrmnvsnt0 rtoxr3iy1fmDe n sl()sruo(o iy4lp nlfcsatf Drmu pno0aleoioetadlsDrmumonu4alxrxrcoydop rau i t0 rumxopou4ol n iesl() Dum(rpnt1aex miciyslm eanvp t0 exomf ta1latrlu s;t)sexm(o3iu1ale mfesa(fs2rmur nu0olt ioctas s2emumpn()arerio3oa1la r ieo;()trxoxrpoydale  neslt)srur( o;o0apx  octadla ra(mp;u4 renxr3totlptraieolt0s2xo(mpiodomee ieil(fsDtax  nu4alxnii3ildfsDeaums u4 renmrcoydlmt lnei t0 exrxm nudaltemivsat) rtrxrono1aptnmoeiydlmDrmnmo;t4 rtnmf3ta1lmtelivs;() euoxmpoo1oltn ict (fs2rmum nt0oet  ictltfa2rlnmp;(0tetomf ta1lat auvi t) 2umxo3nodlmt lfes s srumur ;t4aptomiciadlmDrmnmon(0texoxo3tytfptrluvi;t t2toxr nudomeelietl(fsrrr(mp;u1tpenmoctyt s ea(vs u0altoircoydlateaneols)texmxopnu4omt mfvt (  2tmurpot1tlxn fcild m2umn s u) rerif iytoa ran i;t)s2xr(o3iy4omtelieilsfsrum( p;u4tlt mfeilt s rmu o;u4texoifcty1fmtr ieo t0t2toxo3oo4olt mfctltfa2uaxront1tlxniieilsfs2rau s u) etomfcoydfmD  neo (0teumim3io4omtn fes s)aDumumoot0tptomicias s2ua(mo;()altoxoctodfate u slt) ruo(o nu4oleelivi sf Drm(root1aptn ieiyd m2ean snu0altrxf3oadom  an o (0 etoxrpiy1lmenlfcs s aDtm(m nt0openiociyd s2rmnvsnu0altoio tydfaDr ueo;s0 exmim nydol emnvtl()sDurxr ;t4optniieiydfm2ra( o ()aetrxr3oa1la e uei ( trum(m3iodomt mictlsfaDurxrpno4optnmfetls s2um(mp u)aleoxf3iydlpDrauvs;(0 2to(mpno4aptn iciatfsrtmx ono4aptomoctysla rmu s (4alxoxrcoodomtrluei;s) 2tr(m3nudal elfciat aDtaxmooo1tpen ieiysls2eln s u4 etrmo3iadfm raneolt0teurim3oydlm  mneiat s2tmu  no0tet  f3tasfm ea(vp;t)tleoio iodfmtran s s trto(mpio1omeelfvia(fsDtrxr no4open oetls m eanmp () eenioctydla rlieslt)trxrxr3oy1om  mieias arumu onu4aeenmfciasls ulu s;(0 eenxociatfp  ai i t)s2trxm ou4alenlivil()arraxmont4alx ioetadlm ulu o;() etomfcio1op  luvs t0t2xoio oo4apenlivt tfsDur(ront4tlxomfetytlmDra(vpnt) lxnir3tatoaDrauvs;( s2xoir io1lleelnei t) 2trurooo1aptoiieildlaDulnms;u)trtrif tydfaDe neil() 2xm(m nydap nlietlt)aDua(moot1tpe mo3iad a2em( o t4teeoxf iadla r ieo t t2xm(m nydape  iei (fs2rmum ;u0aexnioetytfsDea(vs;t)trtrxr3ta1opD livslt0seur(m3ny1oltn neiat  Dumxmoot1apt iieils aDranvo;u0arxoio3todfat li i t  2xmiopno1oltemfcias s2trx pou4aeeniociys m ua( s u)texoif iotlatr n o;t setrxm oo4aptnlivia(fs2um(rono0alt ifetlslm eluvsn(4 rtnmo ta1fatranvo;t) euoio3iu1lltelivi (f Drrxmo;o1ape io3iysfa2ran o;u0 exrxo3oytla   iei;t)t2urxr3oodol nmietlt  2rr(m no0olxnifciadfaDemu o (4teermr oytfmDr uvo (  rtrio nydopteliet (  rumu  ;u1texomieild s elumsnt4aeerxo tatoaD  nes;s)tetr(r oy1ale  fvias) Drmurpot0aexn ictydls uau p;()alxnif3oatfptran i;t sexrxo3ou1omenmfvsl(fsrtrxrono4tptoio3tys sDrm(vs t)trxnmoctatomtrli o;( setoir io1lltemfvt s  Drrump;o0ape  iciadlm rm(ms t4 ltoio3totlm  liei (  rxmiopnudap elieiasfs2rmu  oo4tpeoio3tad a2emuvont4 lxoxo tatlm  aues;t t2xr(r3iodll  mneils  rrmur ot4tlt iictls m rl(mpn(4 lerif iydom rlneolt0sexm(r3oudaltelnesa(fa2umxrpou1apx moetysla emnmonu0aetoxr iodom e i s (0tetrxrpno4aptemnct () Dum( o;o4teeoif3iytls rauvo u0tlermrciatfmDr ies ( setoxrpnudal elnet tfsDraxro;o4oee io3iytfm el(vo;u4 lenio3tatoaDelu s s)srurir iudapenmnvils sDumumoot1tle mociadfm rlump (0aetnmr3oytfm r i i t s2xm(o iodlleelieilt  2urxr nt4olxnmfeilsla ranmont0 reomf ia1fmDelnei s)t2xm(mpoydam e ivil(faDtauroou4alxomieiasfa2rm(ms;u4arxoiocto1fmDelues s) eum(o3nodapeemnei (fartrur ;t4tex iiciytfs2rlu o t4aexnif3oatlmt  ivols0 2trxo3oudoptn iesa()aDra(monu4oexn feiytfa emump u) lxoxocta1faD  u ol( srtm(m iudal  lfvils)arumx o;u0tpenmieias s2emnmp;t)artoircoa1fmD auvi t  eumirpnodlmtnlicsl() 2raumonu1oetn o3iltfs2rmnmo t)aetomf3iytla   neils teto(opio1ope lfci sfa2tmxr nu4oltoioctysfaDelu pnu) eeoxfciydlpte ues;t) 2urxo nu1ape mfcsls)srrmxmpnt4aex mieiadlsDrl( o ()tltnxr3iatfpDranesl( sexr(m3ny4lpee nctls) rum(mp;t4tpt  ocilsfsDea(mo t) rtriocto1fmDrlueo;(0 ruoxo3oudamenmnvi t)a2raxm ot1apx mf3iyd a uluvp t0trtoxf3oy1laDr ivsl(0setoxm io4optelfcslt)srrm(mp;u1tleoiocildfmDemuvsnu4 etrif3tytfmD  uvo ( sruoio3oy1opt  nvta() Dtax oou0oetn f3tyt s2ulums (4 ltrir3tydfm e ivo s s2xm(o iudomtelnvs sf Durx p;u4ole mo3iasla2elumo;u4aeenio iatlpt  ivs;s)srurxr no1ope  ivslt  Drauroou4ole  fcilt m eluvo;()altrirciodomD luvs;(0srtoiopoy1altelfvt s sDtmxrpoo0apx mociysls uln p u) rtnifcoatfmDe ueo (0 etrxr iu4lle lnct t sDrruronu1teto oetad a rm(vo;u4arermr ty1lp  lueslt0seuoim ny4om emneil()s2urumpou1aee mocildfmDrlumpnu0 eermr iadom r uvs;s0srtmxmpio4am nmivi sfsrtmu  oo1olx  fetld s2rmn onu4areoxr iodlmt aivs;t)t2xoirpnydomtnlnvtas a2trxrp;u0olxoifeiasla um(msnu0alxoirciatoa  lues;s)trtrxmpoodom e feia() 2rrxmooo0opxomo3iytls ea( s t0arenio tytlpDe ivs s)trurim3nu1ap elncs (  2urxm ot0tetnmo3iadla2ulnmo;u) reoxrcoydfm r nei;t) rxmxr3nudlm e nesa(  Drrx  ;u4aeenio3ils s2rmnms;(4trxrio3oo1oaDeaieo t s2umxmpiu1ol n ies (  2tm(mo;t4tle ii3iyt m ulnmo t0arxoxo3iatlmDr ieo s) exoiopio1llt lfct tfsDtmxmoou4aeenif3tad s em( o u)aeeoxociy1om  livi t)sexoxo3iu1lpenlnet t srrru o;u1tltniictlt aDran snu4aetniocootfaD aueols0 2xrxrpiudal e ies (fa2trumo;o1tpxo i3ilt m um(vo;t0teeoxo3io1om r ivilt)trumim3ny4lle lncs (f 2rrxronu1alto octat m rau pn() exrif3tatoa elnvs t0srumir nydomeemnetlt)a2urxrpnt4texomo3iydfa2ea(vo;t)teenxfcoadoaD  nesl(  2tm(o oodaltnmnvil()arrmump;u1aet mi3iyd aDrl( snu) exrxr tadfa ran ol() eurxmpno1oltemncia(f rurum ;u0tleomociatfsDua(vs t4aeerxr3tytoa r uesls  rxrxm3io1lltemivsls) 2tr(rpno1tpeoif3iydla2el(mo ()trtrxr iytfa eli sls  2ur(m3ou4am nlnvsat sDra(mp;o0optomf3ias m rluvo (0tlenir ta1lmD  nes;s trurxmpoy1op   ncilt  2ra(rpou4tpe moctyd mDumn o;t4arxrxf iodlp rauvi s) 2trir oo1ome  ncs t sDtmxmont1opt iieiytfa rluvsnt0 etnxr oo1faD  uvs;s)trxoxr3iodlpenlfvsas  2tmurpou0opxoifeiytla rl(mp;u0altomrcoatlmDraivi s) etr(r3nodop nmfet ()srrr( ooo0texn f3tysfs umnmo ()tetomf3iodfaDraivols) etmxo3io4al  lfcs ( sDrrxm nu1olx  fetld a2ul(mp;t0 rxoxr oa1lpDeanvslt)seurir oy4lp n fcsa( aDtr( o;o4tptomfeilt sDuau o;()aetrmf iadlm  lnes;() eumxr3iu4op elieia( s2ur(  ou4opto ieilt s emuvs;u) leoxr3oadlaDe i o;t)s2uo(m3no4omt lfvta( srrruroot1tpt  ieiltlaDraums (0 lxoir to1optrlies;()srtoxr ny1apt livsas s2tmx ono1alxoiocild m2rl(ms;t0 etoxr3tydfaDe i i;t)seuo(opiu1omtelicsl() 2tmxr ;o0opx mfeilsfm2rluvpn(4tltomociodlmte ivi s0teurim3io4llt liei sfarrm(r ;o4tltnmoctytlmDean o u0alenioctotomt ln o;s) 2tmio3iudlm nmieta(  2raxrpno0oltnmfctlt mDulnms u4aetnxfcootlm rlivilt s2tm(rpiu1apen nvsl(fsDuru p;u0aex mo3tysfmDul(vp;()trtrxfciytlp e uesls)trur(mpoo4ap nmfvsls  2umxmpno1tlxomo3iytfm rluvo;(0trxrio oy1om  liei;t0tetoxr3iudol   fesa( aDtmxro;t1tlt  ieildlmDrmumo;u4 lxoif3todlpDrli ol(  etm(opoy1ol nlfeslt) rra(r ;u1apxn o3ilt aDea(vs u4 eeoxf3io1oa   ueo;s)seum(opny4amte fesat srrmx pot4aeeoioeiadfsDranmo;u) reomfctatfpt  nvilt0trum(rpoo4alt  nvt t)a2rrxrono4apenif3tlsls rauvo u0tleniocta1lmt ai ils s2um(r3no4ameemieils s2uru ono4tlt miciadfm emums;t4texnircoodfmteaiesls t2trxrpnudamtn fctat aDrrur ot4tlxoifetatfmDum(vs;(4trtnmo oadlpD luvs;t)setrimpiy4op  mnetas) 2ra( pot1olt mictltfaDrmnvpn() rerxf tatlateau s ()sexmim3ou1lm emnvsas)srraxmonu4aleomoctld mDrm( o;t)trxoio3oytomteluvo;()sexo(r3oodap emnviat  Drr(root4alxomf3iyt a umuvp;t4aeeoif oadlatrlu s;t0texoio3ny1op nlnei ()sruru onu4olxo ieils sDua(mp t0arxnxr iy1fmtr uvo s0s2xr(r3oydaptemieta( s2umur ;t0openii3iysfmDuanmo t) exrxf iodop  auvsls)s2xmimpiu4al  licslt aDurxront0aexnif3iydla2rmn o t4tetoxo3tadlm rlnvs s texoxm iydome lieiltfartrxro;o1opxn ociatfaDum( pnu0aeenmr oadom rauvs;s0 2xrio3iu1lm  lnesl( sDtrxm oo4texoioctlsls ul(vsn(4arerxr todfm  lu o;t)t2uo(rpoo4ape  nesls s2umxm no0tleo icild m el(vp;(4 etoir oydfa elu s;()sruoim ny1ll nmivslsfsrtrx  ;u0tlxomociydfa rm(msnt4 rxoir3oo1fa   i i s sexr(r3iu4am nlnvi t  rumxrono4olxnmietls sDea(vsnu4texriocia1oate ivolt t2to(mpoudop emiei (  2rmxrono1tleoii3tls mDemnmsnt4 rxnmf tadfpt  nvs (0 2urxr oo4lltnmfviasfaDrmxm nt0ale  i3tls m2rlnmon(4 eermo oytlat aneo (0sexm(mpnudlmeemietat a2raxmpno0tlxoifeiys s ul( p;t0 rtoxocio1lmtean o (0 2xmir ny4altnmnctl( a2trxr oo0tpxn o3iysls2rl( o;(0 rtoif tadopte ieo;t0s2toio3iu4am nmfvtlsfsrra( pno0tetoio3iasfm2rmn pnt0trenir3ta1oatrln i t0t2xrir iu4lptn icsatfsDra(  ;u0opeo ociysfs2uanvpnt)aleomfciodfptrlneils0tetrio oydlpenmies s s2uaxmonu4aexomfciysfmDum( o u4aleoir3tatlpDelu olt trtr(mpio4lpe lnvta() Dtmx oot1oetoii3tat mDrl(mo;t0altoxr totlmte nvols0 2toio3io1ll elfcta(f rrmxr ou0tpxo i3ilsfsDrl( p (0 exrxo io1la elieo;(  exrir oydapen fvil(faDrmxmp;u0olx  o3tatlm umumo u)tetnmociotopteanvi;t tetm(r3ou4altnmicil()s2uaxmooo0olxomfeiydfa2uln s (0trxnmrciatfaD  n s s0 rur(r iu4ap e fciatfsruru o;t1texoio3iadfs2uaumont4 etrxf tytoatrai s ()texo(opiu4lpe lieiat a2tmumpno1opeo o3iatlmDum(vpnu4 ltrmr3tadfm rlnes t)s2xoim3iudlpte nct ()a2tmu  oo1apt  feilt a2ua(vo u4 rxnmf iatomDraivo ()t2tr(rpiu4ol emnet tf Dtmxro;o4tpt  i3iatlaDuluvo t4aleriocootomtr ivo;s0trxoimpoy1op elneia( srtmu pot1oleomi3iadfsDra(mo;t) exomf iytlm rln s s)teuo(o oo4lmt lici (  rrr(rp;t0aeeoif3tys a2rluvs (4altrxo3io1oaDeaivo;s0t2trirpno4lp n feias aDrr(m nu4opt mf3ias aDelu o;(4teeomr iotlatelu s s0 2tm(rpiu4lpe  nciasfsrra(rp;o1oexn fetatfs el(vp;t0texomo3oy1lmD  nei s0texrxo3oo4am emfeiat s2tmu ooo1oetniietld s um(ms u0 rermf iodla eanvsl( sexm(m3iydomt  iciat)a2rr(rp;u0tpxnmoeilsla em(vp t) eeoif iadfaDelneo ( t2um(o3iudopt mivi s) rtmx pot1aet ioctaslm em( snu0texnxr3oa1op eanvs;( s2xo(opnydlm  mncils)a2rmum oo1oetnmf3iytlm emnvs t4trxomfcoo1fatrln i ()t2uo(m3no1am nlnetl( arurx  ;t0oetomo3tydla uanmp u) ltomr3todopDr n i s)t2urxr no4ameemnesls a2rax  ot1alxoifeiasfa em(mpn(4tlxrmr3ootfmtrlnvs;s t2toiopio1ole mieilt  rtru p;u4oleo ieiydls2uanvp t) rtrmo3iydfaDraues s0sruoxm3oy4amenmnvsa(fa2umxm nt0tpx moeiyslaDeauvsnu4trtoxo iydomtraivs ()tetmxopnudll  miciat  ruax  no1apx  oeiad a2ulumsnt4aeenmrcoatomtr ivols0s2xoimpiu4alee iesa() rtau o;u0tlt mi3ilsfsDrl(vp;u)tetrxf3tadlmt  nvi;s) rtoim ny1omte ivt s)aDrm( p;t0teeoif3ildfm2ran s u4arxrmo3ia1opDr neo;s0 2xmxm ny1llt lfct tfa2taur ;u1aee mocild m2rl( onu0altnmfcia1fa e i s;t0tetm(r oy1omtnlivil( sDurum ou4oeeo oeiytfm2elnvp;u0aetoir io1la  lnvsls  ruoxo3iy4alt  ictat  2tax onu0optoio3iltfsDuanmp;u)trxrirctydlm elivs () ruo(m3iu4ll  mnes ()aDraxmont4tltoio3iadls2ulnmont)aeenifcoa1om r i s;s)s2urimpiu4lpe mfviat)sDrmxmpou1olto ictydls emumsnt4 rxnmo to1faDrau i;t0 etoxrpnu4amtnlict tfs2rrum no4apen oeiad aDrlumsn(0trtrmfcoatfat  u o;s  exo(o3iu4lpenmiesa() Drmxmont4tpt  ociydla2el( s;t4 lxomrcoo1fa e u i;( s2toxrpno1op  mncsa() rumurono4tpx ifeiytfm ua(vpnu4 reoxrciadoate iei ()seum(o nu1lp nmneils) rrmxrpou4teeo oeiaslm2rmnms;u)tetnxrctydlp   u i;t)t2tmir ou1alt lieias s2ua(mpoo4tpto ieiat s2emnvpn(0trtomfciadomDeaueolt0 rtoio3io4aptn ivi s arum( pnt1optnmociyd a2uln on(0 leoir3tytoatr ueilt)tetr(rpnudam nlicsat) ruaxrpno0aleomo3tldlaDulnmonu)tetnmf iytoa eluei;s)t2xmxr3iy4lm  livi ( arurx ono1optniocilsla rlnmp;t0arerxrctydopt lu s;(0trxoio3ny4aleemnetl(  Drau  ot0texnmo3iadfa2emuvon() exoxrciydfmDr uvo (  rur(opiydalt  fvsas) rum(m ;t1alenmfetatls em(vo;(4texomocty1fa eaieo;(  exmxo3iydomt  ictlt aDrrx oou1alenii3ias a2emnvonu0artoifcto1fpDrlnvo s0texoxm3oudopte fvta()aruau pnu4tpxoiiciydfs emnmpnt4tlenxo3oytla  ln il(0trtmxopny4omtelieias)arrr(rp;o4tpt moctytla uau p;t4trxnxo ia1opD lnvo;() 2uoirpnudaltnmfeta(  2tr
\ No newline at end of file
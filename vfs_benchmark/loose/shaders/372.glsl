@@ -0,0 +1 @@
+i ols0 etoirpnodol nmfvsa(fsDraxmonu4tpt ifcilt m rlums u4alenioctotomteauvi s truoir3ou4am emnct t  2tax pot0opxn iciysfm2rln o t)aleoir3ootfm   nvsls) 2uriopio4op   fetl()srrmu pnu0tlxoif3iysfs2el(vsnu)teenirctotlate neo;(0 exrxo oodllee iet s) 2urur ;u4tlt  i3ild mDemuvs;()aetnmfcty1opDe u i s0seur(m oo1llt  net t)srur(r oo1aet  feias a ul(ms;() exrifctotoptrau i;t s2xmim io4om  mncslt) rraxrpot4opxniietasfa rmnvo;u4 etrio to1omDr uvs t0trtm(rpnydlmen nvias)aDum(r ou0tee mociyslm2uau p (0aeenxr3oydoat lu i;s s2ur(r3iodam emfct s s2tr( oou4alx ioetadls ea(mo t4tetoxr iytfpDranvsls srtr(o3iy1am emnvtat) Dtm(rpou1tpx io3iltfmDrmuvpn(0 lxomociy1op e uvolt texoirpoydomeelneslsfaDua(r ot0oeeomociaslm2ran p;t4 ltomrciydomtr i o;t)s2um(mpoo1lmeelncia() 2raxront4teeomo3iltfaDra(vsnu0aetnio tytlp rlnesl()texmxm oo1ll emivsasfarrr(mo;o1oexnio3iad a em(vs u0alxnmfciotlm   uvo (0 rxr(mpiy1ap emfeta(  rtaum ot1tlxo ociatfm2emnmp;t4trenir iodfatrlnvil()teurxm iodllen ivs t sruaumo;o4oeenmfcildfm uanmo;u0aleoif3oy1fa r i o t)s2xmio iudlpe  ncsa( srumuroot4oex ifeild sDeln o;(4 leomo totlm r ueol()sruo(r ou1lle micil(fa2ua(mono1oetoio3iyslm rm(mo;(0 lerxo3todlm elu s;(0seumirpoo1ame lfcia(fsDtau  ot1opt mfetydfa2rm( snu4 lermf tadfp rauvsl()srxrim oo1omenmfvtltfsrtr(r ;t1opx ioeiat aDumnmon(0 lxrmo oa1laD  n ol(0s2xo(r iy1lpt  fcslt srra(mp;t1aex  o3iyt a2rmuvp (0teeomr3iadfaDrlu s;t0srtrxr oydaltemfctas) 2uru pno4tex iociasls2rmuvo (4 lxrirciydopDr neo t) 2xo(m3iudapenlfei s srurx  ;o0tpeniieiltfm eln ont0tetoio iytop   i i t0texoim iodoltnlfes t)srumx oou0tet iieils a el(von() eeoxf oydop  lueilt)t2xoirpou4lpee ivt s s2uru  ou0oeeoifctydlm2rau s;u)arxnxociatfmtr ivil() rxo(r3oudoltemnes ( sDraxm ;u4tet  ictytfs2ulump;t)teerxo iadlm eluei;s t2tmir oo1lpenlfvtls)aDtaumont4tex io3tyslm em(mp t0texoxfctotfm  auei ()srtr(m no4am  miviatfarrmurpnt4oex  i3iytfs uaums (4 exnmrctodoaDe u o s srtmxr3nydol elfcsas)srur(  ;o4opeoii3iysfmDrln p;t0 rxnmr oo1fat anes ( srxoiopiodam  livslt) Dur(mpou4tleomf3tadlm2rlump u0tltnio3oo1fptr uvs () 2trirpiodom emnviat) rtmx  ;t1olt ifctadlmDumn on()altoxf tatfpDeliei;s0sexm(r3io4ol   neiltfaDtrx  nu4ape  oeiadlaDumuvsnu4 rxnxr iy1op eaneslt0 2xr(rpoo1omt mnci sf rta(m ;t1aetomoeiydla umnvp;(4tltrir3totlp  luvilt)truoim ny1apte iei tfaDraxr nt0texnifeilt aDemnvs;u)tltomr to1lpteau s () eumxmpoudopee neta(  2urump;o1aeeoioeildfa ua(mp;t4artoir3oytlatelu i;(0t2trxrpou4omenlfvtlt)artrxrooo1alxomietad a elu snt0alxnmocoa1fpDeanes ( s2xm(rpoudlptn iesa(fa2um(mp;o1ale  ieiat mDuaumsnt4aetomrcoatlmD lnes;s)teuo(m3no4ome mieia(fs2trur nu0oee miciyt a ra(vp;t4 lxrxo3tadfmD lu i;s t2uo(opiy4llenlfei t)a2tr(m nu0oexo fciyt sDrm(vp u)aetoio oydomD  ivol(0s2tm(o3iu4lmteliesls)a2rru o;t4opeo o3tatlsDeau o;u)tetomf3io1fa e u ol()srtrxo iydalt livsas  Durur ou0openmfetltfm ua(mpnu)aetoif todfa rau s s) euoio oo1lmt  icia( a2rru  ;o0apenioeildls2rluvs;t4teeoxr3totfat  nvs;(  2tmxopoy4lleemnct tfs2taxroot4tpxnio3iadlsDuan pn(0teermf3tadfa eaieil( tetoim3no1oltn fvilt a2tmxroou0apeo fetas mDra(monu4 ltrmo3oo1oa eauei s)trtm(opiy1omeemnctl( sDraxmpoo4aex ifciat mDeanmo;t0 etoxr ia1omDe n ols tetrxr iydlm  lfvsatfs2rm(mp;o0alxomi3iys sDrmn o u0 ltnxo3ia1laD luvolt0sexoxo3oudape  iciltf rra( ooo1ale  iciyslaDuan pnt4treoif iadfaDrlu sl()t2xoxopou4alte feta(  rrrurpnu4tlxomfcias s2em( s;t4alxrxo3iydom rluei;t)trxoxr nodapenlfvs ()srurumonu4alxn ieiasfa ea( sn()tetoio tatlmDeanvi;s0setrxo3ny4lp n nci s s2rruroou0teenmoeiysfmDelumpnu)tlxoir oadoa r nvo t) euoirpiy4ome  feil(  Drrxroou4opxomo3iaslm eluvon()aetrmf3oadomDrauvi s)t2tmim3iydlmt  ncils sDrrur oo4oeto i3ild a ua(mp;(4 exrxo3iadfpDr ivo s0 eto(m nu4lp  lnvs s)aDrrxmo;t1aptn oetydfs rlnms (4texrmo3iatlpDran o;t0 eumir nudllte fci sfsrtm(rp;t0opeo icildls2emums (4areomr3iydfa   uei;t0 2xoxo3oy1apeemfcs t)artaum ;o0oetnii3iasls2ranvp t4trxnifciadlmD au o t0 exoio iu1amt mnet tf Dumu ont0oltoioeilsfm2ua(mpnu4 rtoxf iatopt luvslt) 2xm(rpou4op eliei t) 2ra(ronu1aex mieiadfs umuvs t4tlenmr to1om  livilt t2xo(r3oy1om nlivi (fsDurx pot0tpeoiiciys a ua(mo;(0trtomoctatom rlies;( trxoxm3iu4opeemfcsa(fs2um(r nt4olxn feiys a ra(mp (4trenmr3tatlp  li o s) 2xoimpnudal elfes (faDtau  nu4apx  oeils a ua( onu4aexnxfcia1fmt ai ilt) etrxo3oudame mfciasfsDtru ono4opxomf3iyt sDeanmp;(0artrxr3iytoaD  ivilt0s2umir3nodale  fcsat srrrxro;u1aexoifetltla2uan o;u)artoxfciatoptr nvo s0s2uoir3no4alee nvtls a2rmu onu0tetnii3ias a uanms ()arenxf3oydfm elieol()texrir3ou1op n ivsas)artaxmoou4alx mociysla2rmnmsn(0 etoirciodlmD liei t0t2toxo ny1lmt  feia(f 2tmxr nu4apxo oeiadls ul(vo;(4tltrxo3iy1lpDrai i;(0 2ur(opny1al nlfvia(  Dra(r nt1tpto fetldlmDumnmsnu4 rxomrcootopD aivolt texm(mpoodole  ietl( s2tauront4tpeniieiasfa rmuvs;(4trerxf oodlpDrln s s) 2tr(o nydalte ncsa()artm(r nu4opxo i3iytlm2eaumo ()trermfciotlpDranes;t0t2uoxmpnu1op elnctls aDrrx onu1oee  i3tyd m2umuvs u0areoirctatlp e u i ( srxrxm ny4amenmivia(fsruaum ;t4alxo fciatlm2umn s;(4alenmr oodfmt aieo s0s2urxrpiudol n ivsat)srtmxmoou0opeoioeiatfmDel(mp (0teerio oydomD  i s ( sruoxm3no1openmfcslsf rtaxrp;t4tpx mi3tasfm emnms;()tlxrir to1laD lu i ()srxriopoo1lmenmict sfsDumxmp;u4ale io3iltfm rauvp t0trxoir oodlpD an o s)srtoirpoo4om n fctls  2rrxmo;u4alt  o3ilt s umuvp t) eenmf3ootlp  ai s;s)teur(o iudomen ivtat artaxrooo4opeo fciydls rl(vpn(0 rtoif oodopteln o;t0s2uoxr iy4ole  ivsas aDrr(m no0oeenmoetld aDuauvsnt4 eenxf3oo1laD au s;() 2to(o3io4ap nmfetas)a2urum ;u1oeto ictydfs ra(vsnt)tlermfctodfm eaivs ( s2urxm oo1lpenmnviltfsDtaxmoot4aeenifeilt a2emnmo t0aexrifcoy1omtrlieols t2to(o iu1ll  mfei sf rumxrpoo0apen iciad sDel(vsnu0 rtnxo ootlm e n ols0srumir oydopen fvsl(fs2rrumpoo4teeoif3iatfa rlums;t4arenif3ootlm  ln s s trum(m3oy1al e icsl( srum(m ;u4opxoiociat mDrm(vp u0artnir3iotfmDeaies;t) euoxo3iudlmt mncsas)sDtau  ;o1oetn ictlt m ul( s;u)trerxr ia1lmDrai olt0srxoxr no4aptnmnetas)srra( pou4tpxniieilslaDrmn p;t4teenif3iatlm e i olt0trur(opiudop   fcsl() rrau poo0optniietydfmDeluvo t4 lxnxfcoytfaDean o ( tetmim3oydomtn nctasfsrtrxmpnt4apxnmfcildla umn s t0artnxr io1fpD anvi;(  2trim iodal n nctatfaDta(rp;t1opxnmociltlmDemn o t0tlerxo3oytomt li ilt  rtm(r oodap nmnetlsfsrur(mp;u4openmoetys aDea(mo;u4trermr totomD  i i ( s2xoim3ny4om emictat aDur(r ou4tetnmf3iadfa eluvp;u0alxomo3oo1op r i s () exr(o3iudame  nvt ( srtmxmp;t1aetn f3ild s umu p;t)aleomf3iatopDraneo t s2ur(o3oo1op  mnetlt)a2um( p;t0aeeo o3iasls emump t4 rtnmociytfmtrli o;t)sruoxmpiy4lm nmics t) 2urxrono1apt mf3iasfmDul(mo t0aetnmo3ia1fpteaneil()trxoir ny1lmtnlncils  2ta(mpou1aet ioetlsfmDrmnmo;u) etnio3ia1lmD lu i;s)t2trir3oodap e nvia(fa2umxm ;t0altoii3iyslmDua(mo;u)tleoxfcoytoateaneo;s0s2xm(mpio4omee ietl( srrru  no0tltomictls a2uln pnt0arerxo iadlpteli s s  euo(o3oo4omeemnesltfs2ua(  oo4tle ioctad aDuanmsn() etrir ty1optraivsls)srxrxo3ny4lp nlneslt) 2urx onu4aex  fetlslaDemu pn(0 rtoxf3tydlp eaivsl(  2xo(o oy4altelfctl( a2ra(rp;t0teto f3iytlsDel(vpn(4 lxoif oa1lmtr n i s  eum(r oo4omee nvi s  Drm(r nt4oeenio3ilt m2rau o (0trtrmrciodlpt luvo;(0sexrxm3oy4amee ivil(fsDtmu ont1aetomfciadla eluvo (4 rtoxf3oadopt  ueilt srum(r3ou4am nlnct s) 2urum ;o1ole moeilsfsDra(vs;(4trxnmf iodlm  anes;t0srur(rpoodome mnvtasfsrur(mpnt0openmiciytls2ranmo;(0aexrifcia1fa  anvil()seum(mpiydlp nmnei t) 2um(mo;t4aptn fciat a uan s t4aeenif tydlmtrlues (  eto(o oo4olee ncsls s2taurpnu0oexoio3iys a ran s;(4aexnmrcoatla rai i;()tetrio3ny4lltemieiat)arrr( oot1tet  feiltfa2uaumsnt)trtomfctytomt anvils s2urxm ou4altelneilsf Dur( p;t0aet ioctatlaDrl( o;t0aetnmr3oadla   i ils0srtmir3ny1lpt mfvils s2tru p;o4opxn f3iydfs ean on(4alenmo3todla r u il()s2trimpou4aptnmicia(f rrmx p;t4olxo ociytfs umums t) exnifctytom   uvs;()teur(r3iydamte ivilsfs2uax p;t0aeeniietadfs2emuvont)alxoxrcootomD  ueilt) rxmxopoudameelfeia( a2ua(mpot1olen f3iad sDrlnvp;(0tetrxrctotoptr uvo;s)s2tr(r nu1optelnetls)srua( oou1alt mf3tlsfaDumnms;(4texoio iatfm rauvil() rtoim ny1lpt  icsl(fs2rrxm ou0alto ieiyd s rm(vpn(0altoif3ia1lp r nvo s0s2urim nu1ale mivt tfsrum( ont0apxomf3tydlaDrl( s ()aexoiocoatlatr u s;t0trxrir nudlpe  nes ( aDraum ;u4tltomi3iat mDrmnvp u)aexrmfcoydfmD livo s  rtmxr oo4oltn nvt t)a2tau o;u0tpx mfetltfa rauvsnt)aetoxr io1fpDeai s;s0seumxmpiu1lpen ivi s)srrrurono4alt  oeiaslsDrm(vp u0 reniociytoa e ieslt)setoio3ny4oleemiesat aDur(m ;t4alenmiciatfmDra(mpn(0 eermr3oadoaDeluei;t0 2xo(mpoy1lp e netlt srrrx o;t4tpt iietltlmDra(mp;u) eenmo3iadfpte u i;t  2urio3no1opee fcia()a2tr( oou1tlxo o3ildla2rl(vsnu4texnmf ty1fmt ln ils)s2xrxr oo4lm elictatfarra(mp;u1alxniictltfs2rm( p u0tetnmocto1fate u i (0trxoxo iu4omee ivslt  2tmumont1olxn o3ilslaDumuvs;t0alxrir ty1optr i s s trxr(m3oydll n nvsa() rtaxmo;t4tpe mictadfaDrlnvo (0alxrmr oy1laDrluvi;s srtoxr nodapen fesls aruaxr oo1oexnmi3iltfm rlums (4artnxf3ta1oaDraueslt)tetr(m3oy1apt mivsas) rtrxrpoo4optomi3tysfa rm(vs u)tltrmf io1lmDraivo t0 rtrirpoy1lpe miet () rrmurp;o1alxnif3tlsla elums u4artoircia1fmD li s;(0tetoxo iu4lpenlnvtls) Dtmx  ou0tptoioetasfm elums t0tlxnmo3tytomtrauvs;() exo(m3no1ame mnvi t)s2uaxr nu1oeeoiictltfa emnvo;t0trxrmo3iydlm  livo;s)texmxrpoo1lp n nvtltfs2rau oot1opx  fciadfsDuanms;u0 eeoifctodfmDrlivils)s2uo(r3iudap nmnetl() rtmur nt1altnioeilsls2rmnmo;(0trxrxo io1faD ai il()sexr(o nydomtelfeia(fs2tm(mp;t4aleo octatfa2rmn o t4alerio3oydomDrlneo;(  2xo(rpnu1omte icsltf rurur ;t0tlxn ictldlm umn o;t4 exomo iotla e ieilt)srxrxm3nodome  nvs s)sDurx  nu4olt ifeias mDum(vp;(4 exnmf iadop  aneo ( trtm(o ny1lm nlivtl(f Dtaxm ot4alxn oetysla2umu p;u0alxoio3tytfp e ivo;t0 etm(mpiodam   feils) Draxrp;t4olenio3ias a ea( o u4trtrmociytlpteaivsl( s2uo(o3io1am  mfviatfaDtr( o;t4aetnioetydla2elumo u4tleomo3ia1latrluesls0t2toio oydop nmfctlsfs2uaurpot1apenifciytfa2ul( o u4altnio3oytom eaies s0s2xo(m iodlpeelivs sfaDuau  no4ale if3iadla um( snt0texnmo iytlpteluvils0 exrxr no4al   ncs t a2taxmp;t1altn feiyslaDranvs (0trxnir3iotlmtrluvi;(0t2toimpnu1olte nvi t a2trxmpnu4alx  i3iltlmDemuvpnt4 etoiocto1fptrlivo;() exrxmpoo1aptn nctat) Dur( poo4olt  f3iys sDelu s t0arxnmo3iadfaD  iei;s)srtrxo nu4ap e ivta(f Dtru oot4apxoioeiytfs2uln s;()texnmociydlmt  n i s0t2xmxopnu4lm  mici tf rur( p;t1oeto ociydfaDrl( pnu4treoifcta1lmD  uvs t0 eurim ny4olenlnciasf 2umurp;u4ale  oeiyd s2ua(vs u)tlxoxr iytoa e ivslt srtrxo ny4aptelfvs () Durump;u4aetnmfcils a ea(ms () eermo tytfptr n o (0s2xmirpnu4alt mfvs ( sruauront0apto oeiydls emuvsn(4texrircoytlmte ieo;s)truo(mpoy4lmt mfeta(fsrtrxm ;u1alx if3tatfaDuln p t) rxnio3oy1lat aies;s) rxm(r3iy1lleelnci t  Draumpnu1oeeo oetydfm emnmp;() rtomf iadfm  lnes (  eurxm3iu1lmenmicia(  Dtr( ono1openifcild m ua( sn()arxoio3io1oaDr i i (  euoxrpou1am  lfes sf rrr(  oo0oet iocild m uaumo;(0trxoif3oatfptrluvils) rurxr ou4lp nmnei ( srtm(mpoo0olt mfeilt s2emums u)aleoxf3totfm e nes ()seuriopnu1lle lfcsltfaDur( p;t1ale moeiyt a2rl(vs (4arxomo oy1la rlnvslt0seuoim3oy1llt mfctl(fa2rr(rpot0tlxnmociltlm2rmuvsnt0trxnxr3iotlp  aueo s)srtr(r oo4omtn icilt srrrxr ;t0optomicilsfs rlnmp t) etoxrctodlp eaneilt seumxopio4llte nvtltf 2rr(rp;u1oetnmoeiasls2rlumo;t0 eeomf3oo1fp e n o;()srxr(rpnodllt mncsls) rtrumpot4ape  octydfa uln o;t0aexoif3ty1omt livi;t)s2um(r3iy4al e nvt s)s2raxm ;t0oexoioeiydfs el(msnu4altrmo iodlmt an o;t)seumxo3io1apenlietltfa2umumpnt4olt iieiyslmDra( s;(4texnif iytoa elivols0 etmxrpnydam   nvta(  Dtr(mpot0oetnmf3ildfmDum(mo t)aetrxf iadfm elieo t trtoxrpiy1ap emfvtltf rtmxmoot0open iciatla um( snt)altnmr3tydfmD aueil(  etrxm nydllen neil(fa2trum oo0alto o3ildfa rau o;u0tetrmo oydopD auvi;t)s2toxopny1lm elivs (faDuaurpoo0opxnmociyd m emnmo ()teenmf iodfpte uvslt srxrxm oo4amt  fetls aDra(rpno1aleniiciltfa2el(vs (4arxrifctodomt lnes ()t2xoio ou4omtn iesatf Dtrurp;u1ale mociysfaDea( p (4 renmf iytla rlnes;t trxrio3iu1lmt mfei () Dumxmont4apx mfetatfs2ea(vpnu4aeenif3oa1lm   ivi s  rxmxo3no1al elneilt)a2rmu  ou1opxomocildls ulnms;u) lxomrctodlpD lnes t)tetm(mpiodlle mnvi ( sDua(  oo4olen ietat a rauvo;t) reomrctadfa eln o ( texm(r iodap  lietl(fa2tmx onu1tlxomfcilt sDumnmo t0aexrxo oadlateaues ()t2tr(o3ny4omtemies tf Dtm(rpnt4aetnio3ilt aDum(mp u) rxnir3iatfptrln ils0sexrxmpou4aptnlnvsas)a2rmxroou1apenmfciad s ulnvonu) eenio tadoaD li s t)sexrxmpiodope lict tfaDuax  ot4oeen f3tltlm ea(ms t4alenmf ty1lpt lies t0tetr(o oudapeelfeias) 2raxmono1tpto fcilsfa2ulnvonu0 rxriocoo1lm rli i;()tetoio oo4am elfesatfsDum( pot4tex ifciasfs2rlu s (0trtrxfctotlm eauvsls0sexo(r3iy1op elivi sfsrtr(rpnu0texomi3tad m eau ont) eerifcoo1fpteln ols) rtmxr3oo1lmee fvi ()s2raum ;o0aeto f3iatfa rauvs;(0 etrio oy1om  aues;(0 eto(rpiu1al n nviltf Drmum ;u4openmoeilt sDrln o ()tlenmf3iotlp   nvol(0t2to(o oodoltelfci ( s2rrxr no4aleomi3iyd mDem( o (4tltoif3iadlmD  ieils0s2xoxm3iudopen icsatf rumuroou1aeenmoctydlaDrm( p u)aexoxr3todfa  li i;t setrir3nu1ol elietas) rra(ro;u1olxo ictysfsDum(mon(4 rtrircio1lmDrlneo t t2toirpoy1om nlfctlt)srrmu o;o1aexo f3iyslsDea(vo u4 etrxo todoatrluvi t0 eumimpnu4ol emfvs sfs2rrx pot0apenmfetlsfaDulnmp (4trxoircto1fmteaueolt)t2xo(opoo1oleelivs ()a2uaurpnu1tlt mieiltfs2rlu p;t)artrmo3tadlaDranesl( t2to(r oydomt lict s sDuru oot1tle ifeiat s2uau p u0 rerir io1om ean s;()trurxo iydaptnlivt tf rtax oot0alxnio3taslm el( s t4treoiociodfatelu i;() etmio3ou1ope  nci tfs2uax  ;o1teeoifetas s el(ms;u)aetrifcta1fa e iei;t  2ur(opiu4aleemivt t) rurxm ;o0oet  ietadfs2um( s (4teerxr iodlmtraueo;(  ruoimpiy4open ieta(  2tm( ooo0texo i3tydfa rlump u)alxomf ia1om rlnvo s  exoir ou1om nlncsls aDtmu p;o0ope  oetytfs um(mp t4altoxrciy1omDranvi;( srxrim3iydop  mnesatfartmxmoou0ope mi3tls s2elnmo t)aeeoiociodom  li i s0tetm(o oydlltnlfcils)arrmum ;t4aeen i3iytlm rmu o;() rtnir oytfmDranvols) eur(o3io1op n icsa()srurxm ;o4tltniociydlm rm( p () exnxocoy1faDe uvs s0 etoxr3nu1ll nlfvi (fsDra(r ;o1oeenifcils a2el(vsnt4alerif3iydlate nes;( s2trxmpoo1ol emics s) 2rm(  ot1oexn o3ild s rmn p;(0aeenif3todlptrauvsls0trxmxr oo4lm nlnetl()sDta(ro;u1oeen o3iysfaDra(vp (0trxomf oo1lpDe nvi t0texoxrpny1amt lfviat a2rrxmp;o1opxomf3ilt mDumuvp;u)altoio totfp  aneil() rxmxo iy1ape lncsls sDtru  oo4oee iietyt a2eln o;u0altnxo oa1faDrln i t  rxmim io1ll nmieslsfsrrr(rpno1tet mo3ilslm ul(mont0 etoxr todfpt anvs;( seurxo3no4omt mfet (  Dumxmp;t0opeoif3ilslmDulumpnu4 exnxr iodomDeln sls)s2uo(opoo1alte nvslsfsDtm(m ot0tex mieiytfa rluvpnu4texoif3tydfmt au ilt  2uo(m3oo1llee ivt t)aDuaxrpno1tlenmo3iadfa ea(ms u0arenmrctydoaD  ies;t s2tmim iy4ap e nviatfa2rau  ot0tle if3iydfs2rl(msnu) reoifcio1om rln s;t trxo(r3iu4ll e fvs sfarurxmpoo1oetoio3iasfaDeanmo t0artnif3io1fmDrai o;s)s2ur(m ny1apeemiesa(fs2tm(rpou0alx mi3ias s2emnms u)arxomocta1lpteanei (0t2xrxm iodaltnliet ()arururpnu0opxnio3iltfa rau pnt4 lxoir3oydlaD  nvslt  2xm(rpiy1op n fvsls)srtaurono4oeto ociad m2rlu pnu)artriociy1lmt anei;t0 rxoio3ou4am emncsas arum( o;u1teen f3iad m rm( pn(4alxnmo3oodoat anei;s trxm(m oydol e fvi t)sDrrx pou1oeto f3iltla rm(mo (0 lxnmf to1fmtelivol( t2umxm ou4lpen ivtls  rtm(m ;o4texnii3iydfs eaumo u4 lermr iy1latrluvils0trxm(o ou1ole lfvsa(f 2trx  ;t1tpeoiietaslmDrm( p t0texrxf3iy1lpt  uvi;t0s2xmxm3oo4omte iesltfartrx oot1oeenmf3ildlm rau o u4 lxnxr3tytomte ies;(0 rtmxr nydoltelicslt)srtrx o;o1tlxoifciatla rau s t4 ltrmociadfm rai s;s0 eur(m3ny4aptemnviatf 2rr(rp;o4oex  f3ilt m2rlnmp (4 exnmr oydlm   ivsls) 2umxmpoodom   nvi s)srra(r no0oet mf3iyd m uaums (4tetnxf3oytfmt  nvi;() rtm(opiydlle lfctlsfs2ua(  ;u0aetoifeiat mDel(mpnt) rxrxrctydfatr nes (  2uo(r oy1lle lfctat  2umu ono0tpxo iciydfs2umumo t)tetomrcio1la rai il(0t2urir3oudlpenlfesl() Dururont4oeeo fctldfa um(vont0trerxocta1la r n i;( srumxm3no1ope lict (  Dtaxr ot1aleoioetaslm emuvp ()tetrircoodfp  lieilt)srxm(m nydolenlfctl() 2tmxront4olx  fetltla2elu s ()teenmfciytoaDrlnvs s s2toir3nu4am elfctat) rumxr ;t0tlt mf3tad sDea(mo;u4aexrmr tatop  auvo;s0setrxm3oy4olen neia(faDtaxrono1tpeo ocildlm2eauvo;u)artoif ootoa eauvils)trxm(m oy1omenlfvi ()a2ua( poo1aeen oeiysls rl(msn(0 renxf3oatlmtr nvs;s trxm(r ou4am emici ( aruaxr ;o4tpe ifeiad s2rlu o;u4artrir oo1oaDelneslt0sexoxr nodaltnmfci ()a2urxmo;u0aexo ieiyslaDul(vsnu)texnif3oodlmDr ues;s  2xrxrpoudome mnvt t)s2tmum ;o1tex mfeiat a ea(mo;u0tlenxfcty1laD auvo (0s2um(rpoo1lmtn ivsl(fa2rrur oo1olx  ieiatfa2ra( pnt) etrxo3iotom elivs;t0srumimpiy4ame mnet s)s2um(rpot0aeen i3iltlmDrmn p;u0 ltrxo ty1lptrauvs;s)s2xr(m3io1amen icils a2tmump;o1aleoif3tldfa ua( o t) rxrif3ty1fptrlneo s)srumxr3iy4olee iesas srrm(mooo4alenioeilsla2ra(vo;u0arxomr todom elu sls texmir3io4optelfvtl( srtaxrpou4tlxn ieiydfm em( p u4teerif oydfp   i i;s)tetoxopiu1omen nvsas s2umx pno0tleo fetld s ua( pnu0 eeoxo ta1lpD aueil(0trumio no4om  lfvias)srtaxr ot4apeo o3tldfa uanvp u0 rtoio3oytlatr u i (0trtr(r3oy4lmee nvslt)srtmumpnu4teen ieildls rlnmo;(0 rtrmr tydlaDeaivo;s0 2urxr3iy1al  mietl() rtr(monu0olxoioeiatfmDua(ms t)tlermocia1lmte ivs;()srtrir io1ope mictlsf rraxmp;o1tle  o3iydlaDrmnvp;t0artomo3iodfpD  n ol()t2tmir3iodllteliesls artauront4apenif3iltfa el(mo;t0 rxrmr iadfptran o;(0 exrxo oy4ame  ivs (  2raumpnt0oee mo3tysfa2emnmpn(0trenio iotlpteluvils  rum(opnudam nmfet sfsDuaxmpou0tlenioeils aDua( snt)arenxo iodom e uvs ()srxoirpoo4al nmnes ()arrmx o;u0aeenmieiltfmDuau on(0teeoxfctatlp eau s;t) 2umir ou4lmtnmfesa(  Dtr(m ;u0oexoii3ilsfa el( s u0tetrmrcoo1oaDrlnvsl() 2urimpnudapt licsls)sDrmxrpot0oetn iciad m2rmu o;(0 rtrio3oy1lat ai i;t)trxrxrpou1lmt lfvi ()artrxmpoo1alto oeilsls rauvon(4tetoxrcoatopDeluvo;( t2xoxopny1amt livils s2uauroot4aeeo ieiydls2ulnmo ()texoir3tydoaD lneols)sruoir iu4amt mfetltfsDrmxmonu4alxoifciysfa ra(vp;(4artoio iotom  an s;t0 rxmxrpiudlm emnvil()sDtr(mo;u4tpx ifetadfsDemnmo (4alxnxr oydfa  lneo;t texmimpoo4aptnlicta( arrmxmoou1aleoiictasfa eluvs;()arenxf tytomtrauei;s)sexr(mpiu4ape  fetatfartm(mo;t0oltomieiadfa raumonu4 renmrcoy1lp rlivi t0 rxm(rpoo4omt  fvta( aDur(mo;u1aleo f3tldfaDulnmsnu)tlxoifciotomt  i slt  2xo(opiodlptnlictltfaDrruro;t4optniociytls2uanms;t0tetoxo ia1fa eaieil() exoim3iydom e netls  2trx  ;u0tpeo iciat a2em( ont4 lxrir3oa1lpteln o t)teuoxr iy4ll emics s)a2ur(rpot0tet ioeiysfa2em(vo;t4trxrir oy1fmDeliei t) eum(m ou4lpt mivs t) Dtrx pou0texn ocilslmDul( p;u)arxoxo3oodla e ivi;t  eurxm3oudapeemiei tf Dtr( o;u4opt  fctltlaDeanvsnu0trtrxrctydfatr u o;()trum(r3iu4ol nlfvtlsf rua(moot1tpt  o3iadfaDeaumpnt0aetnmf3ta1omD  nei;()trxo(mpnudape lfvs t s2tmxm no0aee mociyd m2ua(ms u) rxnxo ootlmtrlieo;s0tetm(r3iydapt mict sf rum(m ;u4alxomi3iadlaDulu p;u0aleoxo3iydomD  ivo t0 2xoim ny1apenlicsasfaDurxrp;o0oetn ieiatlm2rau s () eeoxocto1fa r i o (0 2xoir3oy1om  mici tf Dum(mo;t1oetnif3tysfsDra( pnu4 etrir3oytlpDe ueo;t0s2xoxmpiodam n nci sfaDtm(mo;o4texo fciytfmDrlumsn(4altnxr3iatomD  ivils  euo(r3ny1omtnlncilsfa2rmumpot1opxoiiciltfs2emuvsnt)aeerirctotlmt ai s s0t2ur(o iy1oltn ieiat  rur(  ;o0openifetasfm emuvp;(4 lerxfcoatlmteaneol(0 rxrxr3ny1openmnetlsfa2raxr ot0alxoiociys sDua(vs;u0tetrmo totlpD  ivi;s sruo(m iodlmtemict t arrmur ;o1teenmfciyslm umnmo t) exomr tytfaDe n o;t0 2tmiopio1om emnetat  rrmu p;t0aeto f3ilslm2rl(vs t) rxnxfctadfp rli o ()srtm(o3nodll  mnvi (  2urxro;u0tlx  fctatfa uanmont0 lerxr3tadlpte ieo;s0srtmxmpio1lm n nci ( s2umxmpoo4apen fctlsla rl(vo;(4 ltomf3ootfp e i olt) eto(m oy4omenmfvtls s2ra(rp;o0opto oeiys mDum( pnu0artomr oy1oatrliei;t0s2xrxrpiy1om nlfvi t arrr(rpou4tlxn oeiadfaDumn o ()aexrxr3to1lateaueo t s2xrxopoudlptn nvsl()s2rrurp;t0aetnmo3tas m2ean o (0aetrxo ta1lm raneilt0s2umxo3iu4alenlfvi s)srtrur ot4optomietld sDuluvpnu4texriociadlmD auvilt) rxmxm oy1ape lieias  rururpnu4oetn oeildla2ra(mon(4arxoxr3iytopD  nes;s  rxm(r iu1altn ivta(  2trx ono0oexnmi3iyd m eanvpnt4tlxrircta1fmtrai o;()tetm(m oy1omen ivsa( arururp;t0tlxnmietls a2el(vp t0 reomo3iytlp e i o;t0 2xmxm ou1optnlict ( artau  oo4oexnioeilsfs emumo;u4 lxrio3oy1la   u o s0setoxr iu4oltnmnctat sDtru  ot4ale ioctatla2uan onu)teermf oo1oa eauei t teurim3oy4apenmncs t  2raxmoot1ale mieiysfaDum(ms () eerif3io1opD  n s;s) 2toxo iu4ope liei t) rua(m no4oltoifetas m ua( sn(0tetrxrcoadlp rlnvi t texoxo oy1aptn fcilt)artrxr nu4oleomfctyt aDul( o (4teermocta1fmte u s;s) rurxrpnu1lm emietat)aDrrxmo;u1apx mi3iadfm ra( p;(4arerif iodoa eaivo t  2xmirpnu4ome mfcil()aDumu p;o1oexo o3iasla2rmnmont) ltomrctadom  livs;()t2urxopiu4lp elfetas)s2umumpnt1apeomieiytfsDemu snu4tltomf3oa1latraivol( sexoio oo4lp nmncias)a2ua(mpou1tptnmo3tatfm2umn snt0aeermr tatla  livi ()trumxrpio1ame lnvsl() 2rrur ;o4optomo3iydlsDumumpnu) renmf3tytfaDraies t0sexrir oy4ap n fvtat a2ta(  nu1oexnioeiydfaDemu o;t0trenio tydlpD anvo s0sruoxr3ou4amte fvtltf ruaum oo0apenmf3iasfs rmuvs u4aeeoir totfaD au o;s  rto(rpou1oltelieslt)arrmu o;u1tlxo f3ilsfaDrlu p;u0altoif3iodlm raivils)t2xr(r3ou4llt mnvtlt s2uaxmo;u0apto o3ildlaDuluvp;t0 etoxf tytlatelu o t trxmio oodll elnctas) Dururpno4tpt mf3iyt a2rmuvs;(0tlxrxrciodfaDe uei;t srtmxopou1ol nmfct ()srrrx onu0ape ifeiyd a rl(mp t)artnmf iadlaD ln olt0t2trir3iu4opt  neiasfsDtm(m ot4oeto ietasfmDemn o t) etoir3iotomD anvs;t srxoio oudlm  lfvs t)aDrmxr ;t4aexomi3ildfm2rmnmsnu0 rtoifcoatlmtrai olt  2toxr3no1al n ncs s a2tmxmono1aex if3tatlmDulump () leomf ta1fpDeaieo;s) rurxm3ny4om n iesa(  ruax onu1teenmfctlsla2elumpn()arenio ootopteauvs t)t2xr(rpno4op emies sfsDua(  ;o4teenmo3iys s2ulnmon(4tltoxr oodlmtr ieo;s)setmim no1al  mneta(faDrmxr ;o0tpx ioeiatlm eaums;()arxnxf3iytlmDr uvsls t2xoxr nu4aptnmncil( sDtaurpou1oleo f3ildfs2umnmo;t4 exoio iatom elnei () rurxm no1aptnmnvtat srrr(  ot4apenmfeiytfm ea(mo;u4tlerir ta1fpt ln sl()seurxo iodamtnmneias aDtru  ;t4olt mociyslaDemnvo u0aleoirctotoa   ivi;s)seumxo3nodalt licslt)s2trur oo0olenmfcilsfs ranmp;u) eerio ia1fa eaneo;s)trto(mpiy1aptnmieia(faDuau pot4apt  i3ilsla2eanvs;t4 rtoxo3tytlpDrln il(0seur(r3io4op emicia()arrmxroou1tpeo f3iltla um(mp;u4tetnio tatfm raneols  2xmxr3iudaltemiesat) Drruront4apto f3ilt s uanms (0alxnmr oy1oat auvi s sexrir nu1opeemivsa() Dumump;t1apx iociydfa emnvpnt0tltrmf3totfatelu s;(0 rxoir3iu1ap n ivsa()sDurx p;o1aeeoifeiyt sDrlnvo;u)alenxo3oy1opt lu s (0trtoxm3oy4ole  neils) rumxrpou4texn f3ilsfm2uanvp u0 eerxo3oytopte uesl(0t2umir oudolee ivsl(  2uru pot1opeomiciatfs ua(vonu)trenxo io1fptelnesl() rtoio nu1ol n feslt) rta(m nt0ole moeiytlsDran onu4artomf3tytoa   n o;t0setmirpnu1olt lnviasfa2raur ;u1open feiysls2ul(vp t)aetoxo iadopDr neol( texr(o3iydlmeelietl(fartrumo;u0tlen iciltfa rm(vsnu4aetrmocoadlptr ivs t0 2xo(o ny1lpenmici t) 2tmxm ot0opxnmfctysfmDrmn p;u) eeomr3tytlpDraivsls0 2xmxopnydopt miesls) rtr( oou4open icilsfsDuau s;u)aleoir3totfmtean il()seum(o oodap n nvsltfa2rr(rpot4tee mo3iat s um( onu0tltomo3iadoptranvo s0 2uoio3nodom  liciat) Dur(ront1opeomietadfsDrln pnu4areoxf oydfat lieslt t2toxo3iu1lmtemnciat)arurx pnt1olxomo3iat a rlu p u)areomr ia1fa e uei t) 2trio ny1lmt  ieta()s2uaxr nu1tlenifcias m2umumo t)treoxf3iytfa raiei (0s2toxmpnu1lm  lfesat  Dtm(  oo4tltn ociydls2rl( on(0 rxrmf3todopD an i t0texrim3io4ame livs t) Dtmxm ;t1tlxniocildla ra( p;u)trenxo tadlp e ivs;s) exo(opoydlp n ietls) 2ur(ro;t4tpxniictad sDem(mont)teenmr3io1lmt  uvil( seur(m nudale mfvi () 2ur(  ;o4tpx iictatls2rl(vs;t0trermo oo1omte i s;t0texrirpiodol emfvs s)srraxro;o0oeeniietad aDrmnvp;u) exriociy1oatr ieo;s0 2tm(r nu4lmenmiei t)sDur( pno0tpx  feilsla2elnvpnu4teermfctatoat  n sl(0s2xrir3ou1lltemnesatfa2trx p;t0tpx iieiyd mDel(monu0trxnmrciydfa eanvslt  eumxm3io1amtelfviasfa2ta(  ot1tpxn f3tatlm2el( snt0 exniocia1fmDr uvil(0 2tmim3ny1lmenmnet sf rtr(  ot1tlx  ietatlm2rl( s u0 rtnmociydlat  neo;t setoir oudlmenmict t  Dumu ont4tleomo3ild m ea( s t) rxoif ootomte ueol(0trtrxm3no4omte fvsa(  rrr(ronu4apxnifciysla2elu s (0teerxf3ootfa   n olt)s2umim3iy1opeelics sfaDtrxmoot1teenmoeiydlm ua(vp t4tltnxrctodomtelueo t0t2xr(r no4lpe miesl()artm(ro;o1open fctat s2um( s (4 exoxf3todfm   uvolt texm(opnu1am elivtat)srtmxrooo4oexnifctadfa uauvont4teenxfcia1lpDran i t0t2uoim3iy4al nmfei t)a2tm(mo;o1tptnif3tytfm um( o u4arxoircto1latr u s;s0t2umxo ou4ll e fviltf ruaurpnu0aptnmfeiasfm2ra( onu0alerio3iytlateln o;(  rtoxr3oy4aleemncia()sDrmxm nt0tetomicildla eluvpn(4altnxrctodomDrauvi;(0seumxr3iy4alee ietl(fsDrrumpou4olenifciysfsDelnvs u4treriocta1oa  ai ols)srumxo3nydlme mictas)aDtmu onu4oet if3tasls eluvs;(0aetoxr oo1lpteau o s0t2xm(o3nu4ope miet t) Dum(r no4apx if3iadla uanvsn(0 etrmfctotlmDe neo s) rtrxmpio4op nlfet tf 2rrxmpoo0oexomfeilslm uaumsnu0trtrif tadlmDrluvi s)s2uoir3nu1ome mfesl(f 2ur( pot0teenmiciyslaDum(mpn()artrmfcty1lpDrlnei ( tetmxopnu1ol nmfcias s2umx oot1tleomo3taslmDem( p;u0altnmrcto1fate iei t)t2xr(m io4lm  mnetl(f 2raxr nt1altomociltfmDel( o t) rxniocoatfatelivols  rtrxopnodopt lfctlsf Dtrxm ;o0oltnii3ildlaDrmn snt0 lxoircta1lat luvo;s)texrxo3iy4omte icsas  2raum ;t0tptnmieils s umumo t4texnif3iatomDe nvi s)s2umxm io4op nmfetls aruaxmono1oetoio3iysfs2eau s;u0 rxrmr totfptraies s) rxrir oy4optemnvil()aDrauro;o0tle mfeiadfm rlnvs ()aeerir3iadopteluvs;t0teurxm nydll elics ( sDtmuroot0oeenif3iad a ea(mo t4 rtrir ta1lpteanvils0s2urxr iodol elfet tfartmxr ;u0tpeoifcilsfm2ulumon(4 etomf tydlptraivol() rxmir oydoltelfesls  Dua(r ;o0tetnioctlslm ean pnu0 ltrmr oo1lm   ueo s)s2tmio oy4ameelfvilsfa2tmxmpou1alxoifcilsfm uau pn() leoif iydlpD li s;t  rtrir nodlpt lnetl(f rtr(root4tlxo icilsfsDrmu ont)tetniociydoa r nvo;(0srtoir oy4ome lfei () Drm(mpnu4oeen ictytls2ulumpn(0 ltnir3oo1lpD lnvs;s0 2xmir3nydap elfvtls  2rau onu0tltomfctasfm2raumo;t0aetomr3ty1fm eluvol()t2uo(opnu1lle lfvs t)arrrum ot1ape ifciasfa rluvs t4tlxomr oa1fmte i o;(  exmxrpou1lpen ncta()artrum ;t4aetn fciysfsDrm( pn(0teeomf3iotfat lu i;s) 2uoio3iy1lp n nvi s srtru  oo4tleoioeiyd m2ra( p () rtrxfciytoptr nvslt texmxr3iu1lm  mnetl( s2ra( onu4olxniiciadfa ea(msn(0 rxnmf3tadfat au sls)srtr(o3oo1llee nvsl()s2ta( pou4apenmiciyslm eaump t0trerio ty1omtr n s s)s2uoiopnu1altnlfesl() Dtr(rpnu4aex iociysfm raumo (0 ltoxo3iodoptr n s;t) rtoiopoydlpeemfciatf ruax  ou1aptnifciyt mDea( snu4 renif iotfp rlueo s t2xrxo io4alt mfvs sfarta(  ot0optn fctlsls2rmnmp (4aexrmr3to1lateau s (  2trxrpno1olt mnctls arrrx  ;u1tee  fctytfaDean s (4arenmoctatfa r i i t s2tmirpiydlmtn ncsas sruaur ot0olxnmociltfmDrmumo (4aexnio3to1fpD  i ol()setr(opoo4ap emnei s) Dum( oou4alxnifcildfa um(mo u0alerif ta1fptelu slt) ruriopnydlmeemnciatfs2rmxr ;u1aleoioeias m2rmnvpnu4aeeoxo3iytlmDrlieslt)trtrxrpio1lm emnviasf rrmuronu0oex ifctadla2ra(vo u) rxomr iadom eln sls0tetm(o3oodapen fcslt a2rau pnu0tpxnmiciysfs rl(mo;u4treomocoodfmtelieolt sexrirpno1al  lietls a2ua(mpot4aeenio3tyd s2uanvs;u4alxnmr3oy1lp  ai slt  2xm(r3nu4omeelnci sf ruru pot1alenmfciydla uln snt4tleoirctatfatranvi t)sruo(m3nudlle  fvta( arrrx o;u0tpxo o3ilsfmDra( onu4 ltnmo ia1op elnvo;( s2umxmpiu1opeemneslt sDtrumonu1teeomietls a2um(mp t)tetoxrcoatfa  lueo;s)texoirpnudale  iesat)arrm(mpnu4ope  ociytfm2rauvsn() renmo oadfa  lneo;t)tetm(o3nydlmtnmnctlsfa2umumpnt0oltn iciltfa el(vs u0trxrif3oo1omtr neol( trxmio3oy1aptemicsls) Dumurpou4olto f3iydlsDum( s () renxo3oa1opDeau ilt0teto(r ou4altnlfvtas) Drrumont0oex iieiytlaDem(ms t0aexrxfciydlm eln o ()teur(r3nydaltn ieils)srtm(m ;o4olto ociytfm2elnmo t4tlxrifcoa1lpte uvolt0t2toiopoudlltnlneiasf Drmumoot1opx iiciadlaDea(ms;(0alxrmoctytoa   i s ( setmio3oydale lnei t)aDrr(rpnt4aexnii3iad aDrl(mpnu) eermfctytla  au il( texmxopoydll   ics t)a2ur(mp;t1teeoifciltlm el( s;u4 lxomf ty1oaDraneol( srxo(r3oy4om  lnvsl(fsDumxr no0oleoifeildlm emnmpn(0 rtrxr3tytoptrli slt t2toxm iy4lme mivtls a2tr(mono0tlxo o3iadfa2emnvo;u) rxnxfctytlmtrlivsls) rtrxrpno4lp elict sfsDtrum ;u4texnmfeiad aDua(mpn(4alxrxf3oydfp eliesl() eumirpnydolt  fctlsfaDta(  no0oetnmociat m el(mo;t)tlxnircootlaD  nvi (0sexm(r3nudlm elivs sf Dumurpnu4aptn fctatlm emu s;(0 lerir3oo1fpt auvs;t)s2xmimpnydamenlnei tfaDtru o;t1tetnmoctad mDrl( onu)trtnxf iotop  lu slt)tetmxr oudomt  icil( s2um(rp;o4oexniictydlm em(vs;u) eermf3ia1op ean i;(0 rxo(m oo1oleelies tfaDum(mono1oltoiocildla rau s (0 rxnmo io1oatrln s s seumio3oudaleemietas aDrmx  ;u0tleo f3tydla2umu p u) rxomo iytfmt livils0tetrxo iy4amtn nvsa( sDtax onu0openioctld s2uln pnu4tlxnxf3ootlat lueils0trtrxr oodapeelncs s) Dum(rp;t0tpx iiciatfs2ulums t0aeeomo iotfm eli s (0seurim3oudopenlfcsl(f ruru pnu4texomf3iyt sDran o;u4trenmf3totomDranvi (0setrxrpiy4lp  lfcils)srur(mo;t0opeo iciltla2el(vpnu)tlxoif tytfptrluvo;s0tetmimpnu1opeemieta() 2taxm nu0apt  i3tydfs emuvp u0trxrxo3ootomtr uvs s)sexr(m3ou4omt  nvilt srur(m ;t0alx ii3ilt a ranms ()aexrif3oa1lm ean o;t trur(r3iy4alte ivslt)arumumpot0tlt mfeiydlsDuan ont) ltoir iydoat auvo ( s2tmirpno4amt  nctl(fs2taurooo1apenif3iad a rlumont0arxoircoo1lmD aiei ( s2xmio ou4ale livias)sDrr( onu1tlt mf3tls m2umn s (4 rxomo iy1lpDeaivi (  etrim oydalenlnvtas sDrmu poo4olxomf3tlsls eauvs () lenif3oatfpD aivols0teumxr3io4lm  mncils arraxr ;u0ale ifciydfs2ulumon() eenmfcty1lm  au sl(0texrxm io1lpen fvsa(  Duax  ou0tpeoii3ils m rlums ()artnxr3to1op eaneol( trxr(opiy4am n fcia(fa2tmur ot0aptn i3iys a ulnmp;u4aeenir3oodomDrluvi ( t2xmio iu4olt mfct (  rtrxm ou1oleoiocild m rl(vo;u4alxrmocootlmtr n ols s2xm(o ou4apt lncs () rtmumpou0aptn fciysfm2uluvpnt0tltoxrctotomt lu o;t)s2xo(r3no4llt  iet ( aDtaxmo;o1olxn octas s2rlnvs;t) exrxo3iodfateau s s0t2tmxopnudoptelivtl(fsrtm(monu0tptomi3iadfs eanmpnt)aexrxo3oa1fptr ueo;t trto(r3no4ap emncil( aDta(rpot0aetnioeildlm2rln snt)teeoiocoa1om raieolt seumxrpoo1lp nlfetl()s2ra(  ot0ope  ictadlsDelnmsnt4 reoif iydfmDe ivo;s0 rto(r nodoptnmnetls)s2ur(  ;u0tle mf3iadls2emu o u)artoirctytfmtr uesls0seumimpny4om e icias  2tmum nt4oexo f3iysfaDrmumsn()arerxr iadop e ivo s) rxr(o3nudal emnet () rra(rpno4oee  fetltlmDuanmpn()treoio tytfm e u ilt0tetmxopnodlme mfetat)s2um(rp;u0aptnmieias a rmn s;t0arenir3iy1fmtr ieo;(0 ruoim ou1om elfvt t aDur(mono1optn iciyt m2uan sn()arermocty1lm eaivolt  2urxm3nodalen fei (f rtmur nt1apen ictatla2umums () exrmrctytfmDrlu o (0trurimpoy4ap n fvt ()sDtm(rpoo4tet ii3taslmDemumpnt0tltoxrcoadfa  an ilt trxrim ou4omtn nvtas) 2tru o;t0tptnmfctys a2rlumo;u4 exrxr ta1opt au s ()srurxr3ou1lpen fet t srtrxronu0altomocils sDeaumo u) lxnif ootfa elu ils0texr(m3iodomtn iei t sDtmum no4aee  iciatlm rlnvo ()tlermo ootfatranes s0sexrxo3nodap e nes t a2taxmo;t1oltn ieiatfmDel(ms t)artnmf3oodlm  ln olt  eurir3oydamt mfcta()aruax ono0oexomocildfm rlnvo (4alenmf3iy1opteau i s0trurimpiodllen ivilt) rta(rp;t4opeoiocildfaDumuvo;u4aeerio3todfpD  ivil(  etoxrpny4amtn ict tfaDrrumo;o4texomo3tlsfa2ul(mo;t0texrxocta1fa rln s s)trxrxm3io1op nmfvil(faDrr(ro;t4tptnmociytfaDemn s (0 etnir iatlpDe uvil(  rtm(opoydlpt mfeta(fs2tr(m ;u4alxnifeiadlm eln p u4 rtnxr3oatomDelu o t t2tmxo3oy1lm n ics ( s2rrx p;t1aetnii3iyt s2uln s;t) eenxo3iatlmtrauvi s srxrxopiy1opee ncs t s2tr(mpot0oltomo3iysfsDean s ()altnif iydlm  an sl( t2triopiu4lptemneiat) rtau o;o4teto oeiltfm2ranmo u4texrio oatomtrlnes t  etrxrpno4op  lnetl( aDtaur nu4altoii3iadfsDrm(vo t)aeenif ty1lm eluvs;s) etoim3oo4lmt lnctlt  Drr( o;t4apt  o3tldla2umu s () exomrctadopt lu o s)teurxm nodllee fci t)sDtmxmpou0tlxomoctyd a rauvs;(4alermocia1om e n i;t  rurxrpnu4lptnlicil()s2truro;t4texomociyt s rlnvpnu)aexniocto1oa rlu s;(  2urxm3ny4ol e fvsat aDuaur ;t0aleo octytfaDean p t) eeomrctydfp ranvs t)s2xrxrpou1am  mict t)aDuaxmpot0tet mo3ilsfm2el(mo;(0aetoxf3ootlpDrlueil(  exo(o io4llte fvia(  rtr(rooo0tlx  o3iltfsDrmnvont)aexoxociadoateau o (0srxo(m3ou1ope  ivs t  rrmx p;u1oeenifetas sDeluvonu0tetnmo to1lpDraieolt0seumxr3no1lltnlicias sDrauro;t4aexnii3iasfmDeanvp;t0 rtrmo tadoatrauvs s)t2uoio nu1ame lictlt)a2rr(rpou4opt  i3iysfaDuan p t)artrir ta1fmD lueil( srxr(o3oydap   ivils  rra( pnu0aexn oeild a eauvsnt4alxoioctytlaD lieo s0srxrxm oo4lm  mfcs tf 2uaxmp;u1apto ieildlm uanmo u) lxomf3tatla  anvolt) etm(rpou4openlictl()aruauro;u0tle ioeiadfm um( snt0aetnxr oo1oaD  uvolt0sexr(rpio1alenlivtas aDumxrp;o4oleomo3ild sDra(vsnt)trerxf3iytlpt anvi;s) rxo(m3iodlm nmics t) Dta(m ;o1optomietad a elumon(0 etnmo to1fm elivilt0sruo(o3oo1lme  fviat)aDraxmo;t0oetnmfcildfm rln o;u4areoircio1fm e ivils)s2xmxrpoydomenlfci ( aDum(rono0altoiociytla ulnvs;() ltrio3oydomDr i s;t texm(o3no4lmenmfviat)s2ta(rpoo1tptoif3tadfs el( p t0tlxoxrctadopDr ivs;t0setr(r3iodal nmnvtlt sDta( oou0aexn fcild s2eluvo ()arxrmocoatoatelieil( trumxo3iu1ol  lnei (farrm( p;o1tlenmfciytfa uluvsnu4alxoxrcto1fa raies s0trxmimpiy1amt lnei sfaDta(  nt1optnioctysfm ul(vont4tlermf oa1op ran i s srxrxopio4lltemnvias a2ururpoo4tpenifeiys s2umnms u) exnxf oa1fp  aiesl(0 etoxo ny4ameemnvs tfa2um( p;o1tpt  ieiys a2umu s;(0 eenmr oa1lmtraues s  ruo(mpou1aptnmiei tfsrrm(mpot1ape  oeiydlaDuau o u0 rerxociotop   nvsl(  2ur(r3nu1olte fes s)s2rrump;t4opx mfciys a2elnvonu0aeeoir totlm   nes;t seumxm3iu1al  lncsls)s2trx p;t0oex iieiytfm ea(vsn(4arxnirctodopDrai ols0setoxm ou4llt mnciasf rtaxmo;t0tlxnmiciasla2umnms u)tlxnmrctatoat ai o;(0trxrxo3nydam  miei t)srtm( oou4tlt moeiatfm2uluvs t)tlermrciatopDrlnvi;s0texmim3ny4lp   iviatf Drm( ono0olt mi3ilslm2ul( onu4arxnmfcoatfpD lueo;(0seto(m iudlmenlneta( aDrru  nu4opeo oeilslmDuau o t0 ltnxocto1faDrli i;s0 exoxm iydolte ivil( s2rrxr ;o1tlto f3iatlm2emnvsnu)treoxf3iydfpDrauvslt)setrim3ou1aleelfeilt a2trxmonu4tltnioeildfa umums;()trtrmociadfm ran il()trumio3iu1lmeelnvi t) 2trx poo0tlxn f3tyd mDuan sn() eenxr tatoa r u o t texmim nu1lle licslsf 2rmx  ;u4aee ioctytfaDem( on()tlenxf iatlm rlnvsl()tetrimpnudapeemfci (f 2ua( o;t0opxo oeilslsDem(mp;u4tleomf io1la e ieolt t2xoim no1oltnmivi sfa2ur( ono0oexomi3tld a2uln onu)areomf oatfp eln sls0 2umimpiudol e ncsas)sDra(mp;t0olenmf3iatfaDemnvo ()aetoxo iodomD aues;s0srum(m nudom emiesat) 2rrur oo0apx  feilt a2ua(mp (4arxnmr3ta1fmt ai o;s  2tm(o iy1lptn fesls)arur(rono1apxniictadlaDrl(mp u4trxnmf3oodfmDeli i t s2xrxm3ny4llt mncsas s2urur ;t0open i3tas m elnmsnu4tleomr oytlpDranvs;s setriopoo4olenmivi ( artaxronu0tpxomo3iys a eanms;t)alxrif3iotla rlnes (0 eto(opnudol elietlt) rtr(m ou0alxnifciad s2uln p u0arerif iatlpte i s t0tetr(mpou1ol nlfvi ( s2ur(rpnu1aex io3tltls uauvsnt0tetnmo3ia1opDeaiei;t) rxmxo3iy1olee fcsl(  Drau pou1aptn ocilt s2rm(mpn(4arerir oatfaDr u o;t)s2uoir nudalenmfvtlt)aDurxm ot1tptoiocils a rluvo;t) rxnxo3oatlpD  nvslt srtoxr iy4lptemfvsas a2rmumono4openiocilsfa rlu snt) reoxociotoaD lnvi;s  ruoio nydaptelivilsf 2taxm nt0tpt  f3iytfm rln s t) renxr3io1lm r u s s0srtoxm3iudlptn fvtlt)artm(ronu0opto feiatfa2emuvs (0tleoiocoatfmtr nvslt  euo(m oy1al  lfviltfsrrm(  no1apx  ieiydfsDrau p;() rtnmrcoy1faDean o t0s2xoirpny4apte nci (f ruaum ;o4oleomoeilslm emumont4arxnxocta1omt anes;s0 2trxrpio1lmenmnetl() rtax p;t0aeenmoetyd sDra(vsn()arxrxrctodop rauvo;t0sexmio3iodap nlivtat)arumumo;t0tpt  fctat m rl( s;u0teenmf3ia1latrliei s)s2toiopio1lm e ivi sf 2tr(mpnu0olxomi3ild s umnms ()teenxf3ootlmDr i s t)t2toim3oo4lptn ieils  2taxmono0ape  fciatfm2ea(vsn(0trxnxrcoo1latr i sls  euoxr oodapeemfctlt  rra(  oo0ale  o3iys mDuan snt0 rtnif oytfmDran i ( trxriopoo4alenlncsa(fs2ururp;t0oee mo3iadlm umnvo () lenmfcoadlpte ivsls teto(m oo1alenmfetat srtmxrono0olxnmfeilsla2ulums t0tetoxf totopDrln s;( s2tmimpno4ameelfvslsf Drm(  nt1tetn feiyd m2uanms u)tlxrxfciatlmDraueo;t0trumio3no4ll e feia( sDrm(mo;o1alx miciys aDua(vont0aetrirctydlp  ln il()t2tr(rpoydllt miet tfsrtau onu1oleo ietld mDeanmsnt)artomrciy1oatr uesls sexr(rpnu4omt mnctat)s2rmu pot1opx ioctlsls ean s u)aeermo3iodop   nvils)t2tr(m3no4lleemfvsat)artr( oot0oetn fcild aDrmu o;u)tltnxfcoytlaD  u o t0srtmxr3ou4lp  lfes s arurum ot0oet moeiyd m2el(mo t4trtomrcia1om  ai olt)s2xr(r3oydlpt  fvta( aDtrxr ;t4apto feiadlm em( s;u4teeoxo3iotla  livo;t) rum(o iy1altelict t)s2rrx pnu4optnii3tatlaDua(vont4tleoifcoadfat an o;(  etoxr3oodlp n fvtas)srurum ;o0tlt moeiasfa2rlnvo;t)aexnif tadoateanvols)srtm(m3ny1llen fct t a2ra(mpnu0ope io3iasfs ul( p;u0artrmocia1omDr nvi s)texmimpnudlm  livt t s2ta(monu1olenmi3iyd aDrlums;u0 rxnmr oytomt  nvo s)sexr(r oy1lme mnvtlsfsDur(  nu0oexnmi3iatfa elnvp t0arermr3iytfptr nes;s0trumxrpiu1al elivsltfaDur(ronu4apto ociasfm em( p;()tltoifcta1oate neol(0 2tr(o3oy4lpee fct tf 2ta(r ;u1oetn icildlsDrlnvs t)trxrmr tytfaD lu slt sexrxr oy1lm n fvt s)aDuaxmooo4alt if3tas a2rauvp (0 etoxr iydlp rauvsls0s2xrir3oy1lp n nctl(fsrtaumpoo1ale iietydlm2eluvs;t4 exrmrcoo1la ran slt seurxr3oy4amtelfci tfaDtmxm ;o1tleniieilslm2ran pn(0alermfcoatfmDean s s trurimpou4llenmivia( sDrmum ou4alxnmf3ils s2emuvont0trtoxo oodfm   nvs () 2tm(m iudame mieslsf Drax o;t0aex  feiydfa2ul(ms;t)tltnmrciytlptrlues ()s2umio nydom n fvsl()a2tr(  nt4olx  fciysfa rl( o u)arxrirctotlpD aivi ( texrxr oodopen icils  2rmu  ;o4tpx ii3ild m eau onu4 leomrcia1fpDr ivo t0trtrxm oy4altnlfvtlsfsrrrxmonu4aexoifcilsfs ulnms (4 lermf3oo1opteauvi;s0trumxopou1ll  lnciltf rtaur oo1tex  ietasfs2rlumont0 ltnxf tatlpte ieo t t2xr(o iydame mfvs t)a2umumpou4teto i3iasfa2rmnmsnu0arxnir todlm  aieslt0trtrir3ny4ap  mivi s arra
\ No newline at end of file
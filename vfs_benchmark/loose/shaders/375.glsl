@@ -0,0 +1 @@
+u ol() 2xr(mpiu4apeemivsa(fsDtmxrp;t4tee  feiyd aDulumsnu4 etoio oatfmD anei () exm(m3oo1apenmiesls  Drru pnt0olxnmfeiyd a2rm(vp;u0trxoxocoa1faDe ivo (0t2tr(o3iydapte nct s srtmu  nt1aexoifetyd m2eanvs () etrxf3to1omt  nei s)s2xoir iudllee ncilt srurum ;u1aet mieiytlmDuluvpnu4 exrio3iydom ranvol()teumxo3iu4lmtnlfei s  Duaxm ;t0aeen o3iyt s2ranvp u) rtrmocoo1fat  ies;t sexmxm iy4lle mfeilsfartrurpnu4oexomfeiyd mDelnvs;t0 etrxf3tydop   n s;s0tetmxo3ou4om e netlt sDtaum ;o0aexnmo3tltfm2rm(vs;u) exrifcootfpDrlieo;s  2uo(m3iu1amen ieias aDuaxm nt0openif3iytfs ua(vs t0arxrmfcoytlaDrau ils0setm(m3nudlpeemnvs t a2trxrpoo0opeoifeiadfmDulu p t4arerir io1fpt au ils)seurxopiy4amee ivtas a2tru pno0opt mfciyslm2rm(vp;t0 lxomrctytop  ln i s trxm(mpiydamenmfcs (faDtaxr no4tltnifciyd m em(ms t0trerxrctodlpt au sls0t2tr(opny1op  lnctl()sDta(mooo0alen iciltfa2emuvs u)aexoir3io1fpte nvils)tetrimpnudll n ivs s)arrrumooo1opxoiociyt m rmnms;t4tetnxo tatfp rlnvs;t)trtm(m no4omte nctls a2um(r ou4tpeo i3iyd s2ra(mpnu0aexnxf iodfpDranes;() 2umxo iu4apenmncta(  2um(r ;u1aee  o3taslaDumnmsnu)trtoio totomteln ilt0s2um(r ny1ll  mfctatfaDrmxroot4alxnmfctls aDemump t4 exoxrciadlptelneil(0s2toimpiodlleelneils  2trx onu0oltnmiciytfm2ua(mo;t)tltrio oytfp rlu o;s  rtoiopoo1am  lfcsat) 2ta(r oo4oeenmf3iydls rm(vp t0 etoxr3oodomtelnes;s)tetoir3oo4am   neta(fsrrrxrpou4opxomi3iytls2uaumo u4 exoxo ia1optr uesls)seurir io4ap   feia( sDtmum ;u4aeenmiciltfaDeauvp;t4trenio3ia1fa rlies;() exm(r nu4ape lnetlt s2rmur ;t0alxo fciys m rlu sn(0tltnirctatlmte ieo;s0t2um(mpiydoltnmneias  Dtrxm ;t0tpx  ictyd m umnmsn() eerif iodlpDe u s t s2urir3ou4ol emivsltf Dtrumont1tptnmoetyd s ra(vonu4treoxr iotlatrau o (0trtmir iudolt mnes t s2rm( p;u0tptnmoeiadlmDrluvs u4tlxnmf3iytoatraivil(0s2xo(o3iy1amtn fcsl()a2ra(m oo0optnioeiyd a elnvont0 eenmf oa1lmt aivs;s) 2uo(m3iy4ol nmiesa() Dta(mpot4tpe  oeiasfa rln ont0trxnif3iytfa ran o;t0srtmxopio1op n ncs tf 2raumpno4aeen o3iltlsDem( s (0 ltrxr ta1la e nvo s0s2uoim io1am n ivtl(  Dtau p;u4optniietltfs2umums;u4alerxo3iatomt ln i (0t2uo(opoo4openmfvi s)srrru poo4teto ieiysfa elnmont0trxomfciotfp ranesls)srtrir3ny1lle livt (  Duaxrp;o0aexoiocildfm2raump;()teenxf oo1lm  ai i (0t2xo(mpoo4aptnmneils a2ra(rpnt0aleo ieiytlaDrm( s;u) ltrxo3iotfp  lu i;(  2xoim3oy4omteliei s  2rru pnu0apeomo3iadfm2um(vs;u0texoifcoodoa   nei;t) eum(mpno4ll nlict s)aDtrxroot4ole mfeiydlaDra(mp;t) eeoxfctodfatr u s;t)t2um(m3oo1omtnlfct tfsrrrx p;t0oee ifciat s emnms;t0aexomo tatlptrau ilt0setriopnu1opt  nvt s  Durx  ot1tle mo3iydlsDelu snt4trermr3iatfm elu s;(0t2uo(m3iu4opt mnetlt)s2ua(mp;u4aetoifctyt m uanmsn(4 eenioctydfa rlnes t t2xo(opny1om n nvtas)sDumum ;t0alxo o3tlsfs2emumpnt)tlermf iodlmtrlneils setrxo3iy1olt mivs t) 2rmu  oo4ope ii3iadla2rln o () leomo oodfate u ilt0trxmxr io1ape  ivsa()aDuaumpnu1aexnii3iat m2umump (4tleoif oadomD ai slt) etmiopio1lm  lnesa( sDtmuront4oetn oeiytfa2eluvo;t)artrxrcoytfpteli s () rtrio3oodopenlnvi (f Dum(m ;t4oleo ietatfaDrmnmo;u4 lxnmf3oytlm eln s;t  etrio3iy1al  mictl(  Dra(roou1olxoii3ild m2umumont0 rtrxfcoydoaD au o;() 2umxmpno4omt  feias) rumu pou4aexomiciaslm2ulnmp ()altoxo iadlp r i o;(0t2trio iydlptnlivs ()arurxm ot1apt moetys s elu o (0 rxomf3oydfaDr uvi s) rtmxopnudomt  iesas) Dtmxro;o4apeomieiat sDemu p u4tltrxoctydlptrluvi;(  exmiopiy1lpenmnvslt a2ua(rpot1olxnioctad m ean pnt0artoif3oatomteai il( truoir3ou1lm  lneil( sDurxm ;o0tltnmoeiat sDeau s;u0aetoio tatoa r ieils)s2urim3iy4am nmfvt (faruru  ou1tlt  fciltlaDelnvonu4trenifctydoat  n ilt0s2to(r iodlp e ici (  2urxm nu1tle ii3iad m uanmsnu4 rxnif3io1lpDe nei s0trxm(rpoy4opt mncilt)arum(r ;u4aetnmocildfm ulnmonu0 lenir3ta1la r nes;t0 eurxo3iy4opeemnvtatfs2ra(moou1aee  ietytla umuvp;u)aleomf3iotfptran il(0s2uoio3iydop nmncsasf 2rrxrpnt1alx  feiltfsDrmnvo t0 rtnio3iotom eai ols t2uoxr3oo4oleelfct s) 2tmur no0alenifeiytlm uan o u4trtnio3ty1fmDeluvo;(0s2xo(o oy1olenlietlt a2tr( oou0ape  fcild sDumnmon(0 rxnio3oydfpD aneol( srum(o3ou1lpt liesa()aDurxront4tlt iiciltls ul(vpn(4altrxr iytfp eaueil()trxoxmpny4amtn ncilt)srtr( onu4oetomi3tlslsDemuvp t4altrxf3io1op rluvi;s)trurxr iydomte fvsas arta(r no4apxnmociltfm2emnvo;u)teerxf3tytfmDe nes;t)t2xr(r iu4ole lnetasfs2rrump;o0alto iciysfa uan o;t)altnxf3iadopt  n olt) eumxo3no4lm emnci t  2taum oo0ale mociys s rmnvo;u4alxrifcoy1op r nvo;s  2trxopnydomenlneias  2rmumpou0tetnii3ilslm2ra(vp;()trtrir tadomte u s;()t2toio oy4al nmfes s)a2rmu oou0aetomocilsfmDrmumo;u0 leoio oydfmDe i s;t0t2umxmpnydaleemncs s)srrmurpou0tpeniietlsfs2raums;u)treniocoy1omteanesls) 2toxr3iy4lm  liesat  2rrumont1olx miciadlmDemnvpnt0tetoir3oytfpt au slt  rtr(o nodope  iei (f Dtaxmp;o0openmi3iat s rluvpnu0aetnxo3tatlp r nvs ()srtmir3no1ll n fvt t srrrumpnu1tpeoiietltfa2raums;u) eeoxr todopt li o s trtmxm3iydapt mnviltfs2taurp;u1altomf3iltfmDra( on(4treoxrctytomDrauvo;(0srxmio iydllt lnci t  rumumo;u4texo o3tls s2el(vp t)tleoxf3io1fa  lnvo s)setm(r no4lptn fcia(farur(m oo0oexo feildfs2ean s u4 eeomo oy1fm  lieils)t2toim iy4ale mnvsls)aDtaurp;u4tltnifeiyt sDrau s t4 etrir iotfmtrau i;t) 2xrxopiu4al nlnes s) Drauroot4tetnmociydlaDuan o t)alenxf tytlatranvs;( texr(opou1apen nvtl(f rtaxr ou0oexo o3tlt a2rlnvo (0teerif3tytlaD aivs;s)teuoimpou4lme  fetatf Duaxrpou0tpeomo3tldfs2el(vp;u4 exnxo tadfmDraueol(0 rto(m no4lpe mfesasfaDta(  ;o0altomoctyt m ua( pn(4trtrxr3to1faDranes;t seto(m oodam nmfcslt arrau ooo1aetomi3iadla2umu p;t4 eenif iydlmtr neo;s sruoimpno4opte feta(  ruaxm nt4oex  ieiyd aDeln p u4texrxfciy1oa  lnes;t tetr(r3iudlpeemfvia(fsrtrum nt1oex  o3iaslm2eau on(4alenif totoate nvs;(  rxrxopiy4lm   fcs t)artrx p;u1oex mieiltfm emums;u0 lenmr ia1lptrauvi;t  2xo(m3iu4llt mfcs t) 2taxrpot4altnmfetydfm2elu s u0arxrifcoodfaDraneo (0s2uoxm3iudllt micil(  2um( o;t1aptnmietatfs rm(ms;t0arxnircio1omt lies t trxm(r3nydop elncs tf 2trur ot4olx ioctyslsDemnvp t0 lxrmo3tatfptrluvils0 rtmim no4llenmfeil( a2rm(r oo1tetomictytfs uauvs;() lxnmr3tytfp e i i;s srur(r no4altnlfesas)sDtaxm ;o4tpxn ociytlm2rlu on(4arxoxf3tatomtrln ilt  2xm(opiy1lltemiesas aDur(mo;t0tptnif3ilsfa raumon(0 rxnmfcoydlaD  i ilt)trurxo3iy4altnmfct t sDur(  nu1texomieiaslaDrau p;(4 exrif3tatlpDeaivs s0 2tmxr3oudlltnmiesat  Dtm(m nu1ape mo3iltls2emn o t4 ltnmr3iydla e u ilt  eurim oodamtnmfei s  rurxmpot0opxnmfcildfmDrm(vs;u) ltrmrciy1faD lueolt s2xm(m3iu1llt mivt tfsDurx pot1tetnmociysfs ra( p (4alenxo oytfm  luei;s s2uoxr nodolenmfcs t  2tmxm nt4opeo fciyt a elu pn() rtomr oydfaDraneo;t s2xmxr io1op elfvt s) 2tmurpou4olx ii3ias sDranvp;u0 etnio tadomDr i i s  rxrxr nydomee fcsl()aDum( o;t4tleo octldfaDumnvpnt4treomf3ootomDrlu i () etr(m oy1lmtelfvsls)a2ua(m no0aexomfcild sDuln snu0 lxrif todlmteaivi;( s2trim3iy1lpee ivslsfsrtaxmpou4opxniieils s eauvs u) leomr tytfatrlnvs s0 exm(o3ou4ope  nvtas)arur(root1texn i3ild aDumn o;t0alxrxf3oodlmDr nvi;t0srxm(rpnu1ameelivt sfs2rm( o;o0tpeo o3tyslm ranmsnu4 lenmr3oy1optelieols0seum(rpou4amenlnviltfarta(rp;u4aexo iciydls uauvs t)trxnio3tydlpDrlu i;()t2xrxopno4ome livil() rraur ot0tpeoioeiyt m rmu pnt)texnxr iy1lp eauvolt seto(o iy4openmnesls arraxro;o0oleo oeiaslm ea( s;t4 rerifciytoaDrli i;( trxr(o3ou4am  mncias sDuaxr nt4oltnmo3tytfmDrmnvsnu0arxomo3iadfm elivo ( srum(rpnodlptelfvtatfaDrm(m ou0tptnmfeiasfsDrl(vonu)trxrmo3todlaDranvi s  rtm(r3oydom emivilsfs2taumono1opeo i3iyslm2eauvo (0 eeoifctodomDr nvo s)sexr(o3oo4om nmfci s)a2umxm ;u0oexnif3tytfs2ea(vo (4tlxnmf tadop eaueo s)seuoim oy4al n iet t sruaurono1tpen oetls a um(vsnu0 ltrxr3ia1fmD an s t0tetoim3oo1optemnvtasfsrrrumont0tpxo oetlt m uauvo;u0aetoir3to1latran ils)t2xmio3nu1lm nlivta( aDurx o;t4apenmietatfm el(mpnu4trxrmr iodlp r ieo;(  rxoxopnodomee iet (f rra(  ;u1oeenio3ildls elumpnu4trxrifcto1omD aivs ( s2xoio3iu4alte ncilt  2uaum no1olt miciys aDrmu s (0alxoxo oydoaDe n olt s2xmxo iy1llenmicta( sDrm(mo;u1teen oetytfm eanvo t0trxrirctodop r i i ()teurxr oodamtn nvias s2tmurpoo4oeeoiietas m2ul( p ()trtomf todfm rlivo;()trxrxm3iu1llenmieia(f 2um(mpot0oetomo3iysfs ulu p;t0 lxnif3tydfmDe neo;(0 rtmxm3no4optnmfcta( aDraumooo4oetoifciasfm2ul(vsnt0 etoiocio1oaDrlnesls) eurxr3io4lm nlivi t arrmu  ;t1opx mociasfa2rl(ms;()aetrifciytlm eli i t) ruoim nydalt lfes s s2rmu oou1teeomf3iltfmDrmuvonu0arxnxo oy1lm elu o;t  2urir oo4lm emncsl()aDrr( ont1oleomfetlt a2el(ms;u4 lxnmo oodfmDrauvs;t0sexoxr3nu4ll  lncsl()s2umx ono0oltnmo3iltlm emnmp;u0 lxrmo3tydlatelieo s  2urimpiu4lpte nvs t srta(  ot1tleoiiciltfs2ul(von()tlxomfctytfp eau i;t trtr(o nydlltnmici (  rtaumpnu0apxomo3tatfmDumumpnt4trxnifciatfp e i i t) etrio3nydlme  nctat)a2uau oot0tlen fciysls2em( p;() eeoir3oa1fp raivi t s2xo(mpiu1lpt lfetl(fa2tmurpno0opxomi3tyd sDrmuvs;()altrmf iy1fp raieo;t truoio iudlle  iesat)srtr( poo0aeto o3iltfa uanmo;t4altnmf oodlp eli o (0srxm(r oydomt miciat) rtrxrp;u0aexniieilt a2eanms;u0altnir3todfpDrli ils) 2uoxo3iydamtnlfctatfarrr(mp;t0aleoiociyd a emuvo;t)aleoxo todlm eau ols)s2xoxr3iodlmt liet s  2tmxrpno4apen ociltfmDeanvp;(4 leoiocoytlpDr neolt) rtmxm nodlme  ncsas)arta( pou1texoiieildls ulumo ()aexrmfctadfm  ln o s)teumxr3iudlp elfvia()aDra( ooo1optoioeiadfs umnvpnt0trtomo3oadfmtrlueo ()s2xo(rpoudlltnmfeta( aDrmuro;o0alt  i3ils sDrm(vpn(0alxrircty1op  anvil(  2tm(m3ou4lm emiei s arua( ooo1tpe mieiytfm2rmnvp;t)tetomr ta1laDe u ils0teto(o oy4omt lici s) Dtau  nu0tpx moetatfs2uanmp;u0trxrifcoytfa rlnvils setr(m nu1oltnlict ()sDumu p;t1tpxomoetyslsDumnmsnt4tlxnmfcootfatr i s;t)t2xrir oy4lp emfvia( s2ururoot0alto feilt m emump;(0trxomfcia1fmtrauesl(0 etm(r nydlm nlfvs (  2rrx pnu0texoifcils s2uau pnt0 lenxr3ia1oaDrlivo;t t2tm(m3oodap n neil()a2taxmpot1tlt ioetls mDum( s t4trxrmr3to1lmt aueols0t2xm(opno1lpt mivt s sDua(mpou1tetnioctadlaDea(mo;t)aeeomr3oa1omD  ivs;t0srumim nudlme  fcil()aDur(mpno1tptniiciyt a umn p u4aexrmf3ootom eaneilt sruoim iudolt lnvt t)srum( poo1oet miciatfs elumpnu)aexoio ia1omtrlieo;( t2xr(mpnydol  mfcil(fa2uaumo;t0tlt ioctytlm ulnvp;u0arxomf3oadomt  nvol(  exm(mpiy1lmeemneias) rumx onu0aex iociad m ean snu0alerifcootlpDrlivolt)teumxo3nodal  lnetat  2rau p;o1tpe  iciytlm elumpnu)alxnir iodoat  iei s  rto(o3iydol  lnvtl() rururpnt4aeenmociad m eanvpn(4tltnir3oodfmt lneolt0trto(m iu4op nmiesa( srtru pno4opx miciadfa2rmuvs u0trtomo ta1la  lnvo (  2tr(o no4ope lfetl()sDrax p;u0oex mf3ildla2emu on() exomo iadlpDraies;s  2xrimpiu1al nlfci sfsrumump;o4oeto fciltla2um(vonu0 exrxf oadfptrlies s0 etmir3io4am  lfvils s2rmxmo;o4tpx  ieiltfaDuan snt4 ltnxfcoytfp rai o t s2xm(rpiu1lp   nvilt s2ua( ooo0ole if3iyt m2umump;u4trerio3tadoa rluvi s0 rxm(rpnu4ol nmfeia(f 2rrxmpoo4oltomfctlt s el(mp;t0 eerxo3to1omDeaies;t s2xoio nodaltelivilt  2umxmpnu0tetomf3iatfm ea(mpn() lxoif totopDeau i t0sexoio3oo1lpen ncsltfsDumurp;t0aeenmo3ildla2eanvs u4 rerio iydoptrln ilt) etm(o3nodap  lneil(f 2tmx oot0optn o3iatlmDran ont0arxnif3oo1fmD an i ()setoim iudamte iesa(fsrraxmpnu0aex moctldlmDrmuvo;t)arxoiocoy1lmDr i s;()texoxo3io1ap nlnctltfsDtmu ono0tpxnifeils a ran p t0tetrif oo1fpD au s (0t2umxmpnu1ap n fesat  Dta(ronu1texoiiciyd sDem(mpn()teenmr3iydoatr n i ()t2xrir3oodlpen neiatfsrraxr no1aeeoii3iadfs ra(vs;u4tleoif iy1omD au s (0 etoxm3no1op nmnvtltfs2umxmpnu4apeomfciydfa ua( s;(4alerxocto1oateluvs;t0 rtrim3iudameelnvs tf 2tax ont4tltn fciyd s2rauvs;u4aeerirciytfp e n ilt0s2to(o3no4omenmivi ( sruax  ;u4oexo i3iysfa2rluvon(4 exrxrciydomDeanes t0t2xm(r iodom nlnet s  rrm(  oo4oeeomf3ilt sDea(vo;(4treomo3iodfpt ln s s0t2urxr3oo1opee fvsl( sDrrxronu0apx mo3iyslm2eluvpn(0 ltnxr iodopDeaivi;t s2urio oo1lme mieslt aDua(rpnu0altn ietlt s2eluvsn(4tltoif3oa1fp r ies ( texmiopoydoltn ivslsfsDtmu ont1teeoiieiydfa ranmon(0aeermo oo1fmDeau s;() 2xrxr nudap n ivi t s2urxmoou1tlx iictys s uan o;(0 etoif3iytomDeaneo ()trtmxr oy4lp emfeils arrr(mpnu4tlxnmocild mDrmuvont4trxrircty1lp eaivs;( truoxr iy1aptnmfvils aruaxrpoo4apxnmoctasfsDeluvs;u4aetoxr oo1fmDeli ol()s2tm(r3oo4omtemiei t a2rauroou1tleomictydfa2eau s t0treomr ia1oaDeanes;t srxmxo3ou1optnlfetls)a2tmx oot1oee  ociatlsDel(von(0trxnxf oa1lpDeli ols)t2umimpoodal e nvtasfsDtrxr ;u4opeomi3iat a ra( onu0 eeomr3totoaDr u ols  rumio3iodlpe mics (  Drmxm ot1oexo feiadfm2rlu snu)trtnmr3iadfpt lieo s tetoxr oudlmt mfvsa() 2tm( poo4openmoeildfmDem( snt) lxnmf ty1fpD ln sl() eur(m oydlm elies s)srur(root4aex iicias m emnvs;u)teeoxr oydop  li sls)trxoio nydol nlicsa( srrrumont0oeeo f3tydfsDelnvs;(0arxoio oodlat lnei;s t2trxmpou4omenmfeta() rra(ront4tlx  fcilsfs umu s u4tetrmr3oatlmt au i;()trxmxo3io1apt  fesas s2umum ;o4alx  iciyd mDrl(mp t0trtoiocoa1fmtr ivo (0 rxrirpiu4opeelictls a2uax o;o0ole iieilt sDelump;t0 rxoir3oatlaD  n o t0s2to(mpnudamee nci s a2taump;u4tee mfeiasfsDra(vs t0aetniocio1lptrluvs;s  eum(o3nu4apeelivsl(  2ua( p;u1ape mociytfm um( pn()texomr3to1lpD aueols) 2uo(opnodomtemivt sf 2trxro;o4aleo icildlsDel( p t4tltoif3ootlm eanvi;(  etoir3nu4ap  lnvt t)arta( poo4aexnmo3tysfs2el( o u) reoio oo1oaDrlnvi ( s2tmxr3nu4al   fvils) rrm(mono1tlenmietldla eaums () etnxr3tadfp rlu i;s0 rtoxo3oy4amee ncs t  2trx ont0tex  ociltls2rl(vp;()tlxnif3oodom r n s;t0texo(r iydopeelici ()sDrmumooo1texnmociasla ran p (0 reoxfciotfmDr ivs;s t2uo(rpny4alte fcsas aDuaurpno1tlt  ietasfm2raums (4artrmo3ia1op rauvo;s)srtm(mpno4omee nvsl() rraumo;t4aptniieiaslmDrmu pn(4aleomf iodlaDr ieo;s s2umio3iu4omtelivi t  2rrx p;u1tltnmfetatfmDem( o u)texnxf totomte ivo;s0 etoxopiy1al e fcs () rtm(rp;o1apeo f3tasls ra( p;u0arxrxo3ty1fpt lueol() 2tmio iydopen ieslt)artmxmp;o1opeomfeiatfmDea(vpn(0aeenxr3oo1omteln o ()t2tr(r3nodop nlfei ()srtau  ;u0oetomoetys sDua(ms u0texrmr tydlpDraivi;s s2umxm iy4lmtelnet (f 2trxrpno4tex  f3iydfa2ranvp u) rtnmoctadoa rai olt teuoxo iy1aptnmnvs s)s2rrumoot1tpx  o3tlslm el(ms;t4 etoirctotlmt au o s)trtmxr oo4ome lfct (f 2tmx oot1oeeo ieiytfsDumuvsnt4 lxnmf3iadfat lnvo s)srxoxrpiodopenmfviltfa2urx p;u0aexoifetydlaDuanvsnt)tltrxr tydopDr i s;t  ruo(m ou4al e ivt s s2ta(ronu0tpe mfetltlaDelnmp t0alxrmr3oatla   ivs;(  rtrxm iu1olenlfvtl(f Drm( pnt0tleoioeiytlm2em(mp;(0altnxrciodoat lneol(  etmxo3iu4ole mfvs (f rurum ;t0tpxnmoctlsls em(msnu0alxnmf tatoatr nvo s teur(m3iu4ome liet (  Duaur nu1aleomoctytlsDelnmo t4aetnifcoatopt lu sl(0 2xmxm oydaltnmict ()s2rax o;o1tpenmo3ilsla ea(ms (4alenxocoy1fmtr ueols  2uoim iu1oltelneiat) Duau  oo1optnifetldfa ean pn()arxoiocoatlpDrai s t)sexmxo3no1lm  liviat)aDrr(mo;u1olxoif3iyslm2rlu p;(0 lxoxrctadoa elnei t0t2trxo3iu1lme mnvilsfsrrm( oot0opt iictltfm umnvp (4arxrxf totfptraies t0 2umxrpiydlptnmfei ()aDtr(r ;t0apeomo3tat s2rl(msn(4aeeoxr3oodlm  anvi ( setr(r ny4olt mfvs t)aDta(rp;u4aetniiciltfs eaumsn(4tlerifcoo1fpD li il()t2xmirpno4ope lfvia( aDumuro;t4olen iciys m umump ()altnxf oadoptranvil()teuoir3nydam   ict s)s2tmu pot1oex ifeiltfm ulnmo t) eeomf3iydfmte nes (0teumir iydoptelieiasf Dtmxmont4olxomoctlt a emumpn()trxrifcoodlmDeanvs t)s2uo(opno1altelfes ( aDumxr nu4tetn oetysfa2em(vs u0 etnxf oa1op r iei t0 2xr(o io4lm   nvilt)srua(mo;t4tlxnmoetls a ul( o t)trxnmf3iytfpDr u s;s)srtoxr3oudopenlnviatfaDuaxront4alt mfciaslsDemu p (0altoifcoatlmtran i s)t2xoxr ou4lme  fvt t)s2rax pnu1tet iiciltfa2ul( snt4trtrio oodlateai il()texoxmpoydapt  nvs ( s2rax ont0tex mo3ias m2rmnmp t) eeoif iadlmDelivi ( s2uo(m3oo1am elfeslt)s2rr(ront1opt if3iad a um(vs (4alxnxo3tatfp eanei;(0 rtr(r3ou4lmen neia( artrxroot4tleomfctadlm2elnms u4teenmf3tatfa   n o;()setm(m oudapen fcilt)s2uaurp;u1texomfetys sDrm(vo t4aexrxrcoodoaD aivi;( srtmxo nudamenlnciatf 2um( ooo0aeto oeiadls eanms (0arxnif3tydfpDrli i t)seuoimpio1alt mnet t)sDrmum ;u4aexniicilsfmDemumo;u)tetoif3iotfp  li o;s0teurxopoudlpee iesa( srtm( poo1aet mociadfsDumuvon(0texnir iodopDrlu slt)s2xoxm iodlmtemivt tf 2umx oou0oee mi3tyd aDul( p u4alerxf oydoatelivol(0setoxmpnu4llenlnvtatfa2rru  oo0alxo o3ildfm2rluvsnu4 etomo ia1lpDean sls0setrxr ou4am emfetl(f rra( pnu4oetomf3iyd a2rmu sn(4 renir iy1oa raieols)setmim3iydol nmnvsa( srumu  nu0tpxomfetyt sDrmuvsn(4 lxrxf oy1oa r i o s trtm(mpoydopeemnviat  2rm( poo1aleoioetysfmDul(vp;() rtrio oodlmt aueslt)t2to(r iu1omt  ivtltfarrr(rp;t4opt moeiltfa2rmu p;t4alerir3tydom rau ols s2xr(m iodom nlivsa(fsrum(mont1oleomf3tydfm umu p t)tltomo3todfmDrli il(0 etoxo iodam  mfetlsf Durxmoou4texoii3tld aDua(vp (0 ltnxfctydfaDrluvsls t2trxr3ou4ll  mnei (fsDraxm ;u1tlxo ocils s2umnms;t)tlxomr3iy1oa  ai slt  rurir3ou4amenmnvtat) 2ra(rpno0olx  i3ias s em(vs () leoir3oo1lm eai s s0 rumxmpou4lmtemnetat  Duru  nt0tleomoeiadfaDul(mp;(0 exrif oydlate n s ()trxr(m3nu4optnlfciat aDum( oot0oeenmieiadfsDuan s t0arermfctodfaDr ivo;(  etoir3iodaptn fct tfs2rmxr ;u4altnif3tas a2rm( pnu) lxnir oo1lmteaivi t setmim oydol  mnet (  Duru  ;t4apenii3ias aDea(vp;u0arxomr3oa1fptr nes;( srxo(m iodame  ncsas a2ur(  ou1aexo ictltfmDrlu snt0 reomo tadlatrauvi ( texoxm3iu1am  mnet t  rum(ro;t4oltomi3iydla elnvp u4tltomr iotlat lnvs;(0s2toio oodal  lnviasfaDtru pou0aexn ietas sDrlnvo;u)aeermo tadom r uvo;t0 rtmiopnu1lmtnmivt s sDrrurp;u4aeeoiociad s rauvpnt0 ltrir3oo1lp rli ol(  euo(o3oo1ol elnet t) 2trxmo;t4alxnii3iltfs2rlumon(0 ltnifcoo1omDe ivi t)s2xo(o nu1lmt  nvsasfs2ur(rooo4oltomoetldfsDul( o;u)artnif tytom r i i s0tetmxmpou1llt  fvs s s2uaxm ;u4altomictyd s2eln onu)tetrifctytopDe ueolt  eum(o oydll  lnctlsfaDrr(r no4oleo f3ilslaDuanvo u0tltomo3ta1opt luvi t srumirpio4al e nvias s2raxr ot1tptnmoeiyd mDeanms ()arxrmo ootopDelivs;( t2toio iydome  icsas)sDtmx oot1tpe io3iasfa ean s t)trxomo oatlpt  u s t)t2xrxm3io4lm  mfesa()srtmxmont1oex mfeiatls emnvo;(4 eenxrcoo1fa r n i s0 exmio io4lpt livt ( aDururo;u1tlt  ocildlm ranmsnt0texoiocootoa eaivs;(0srxoiopio4amte fct s s2rmxrpnt1tex if3tydls2raump u)texnirctadla rlu ils0 rurxopoo4lmee iesasfa2um(r nt4apeomietyslmDul(mon(0altrxfciotomDeanvolt) 2tmirpoudope  nvs t s2rru  oo0olt  oeildlm rmn ont0 rxriociydla rauvi;t  rum(m3iudapt mivslt)s2rrx pno0altn fciadlm2rm( o t0artomo to1fatr u ols)t2xmxr nydal  mict (farumumooo1tpxo fciatfa2um(vsn()tltnxfciatlmDe nes t)srxm(r3nu1op n fcsl( srrmx onu1alx  fcildfmDemnmp u0aeenxociodopD anvs (0tetr(o3no4optnmiesl(fartrx  ;t4tpx if3ilslm rl(vp t0 leoircoodom  luvs;(0s2xo(m oy4opte icilt) rurumpoo4oleo ictltfmDra( o;u0 rtrxr3oydopDeln s;(0 2toirpoo4ameemnvs ( s2rmurpno4ape if3iys sDulnvs;(4tetnir3oa1lmteau o t) 2xm(m3oodlptelfei s) rrrum ot1tetomociatfa2uluvp;t4trtrmr3oodfpDelnvi t) eurirpno1lle liesas)arrr( o;t0tlxnmfeias a2umumpn()trxrmfctytlp r i i t t2xrim ny1amen nciltfaDrrxrpoo1tpxoiicilt sDum( pnu)arxomo tydfa rlies t  exmxo iu4lp  mfvi t aruru oot1alx io3ilt a emuvp;u)aexnxr oadlpDrauei;()trtm(rpnydlptelivs sf rta(r ;o1aexomfciatlmDumuvp u0 rxoirciatfmDranvs s) euo(o3no4al e nct t  2rmurp;t1olxomictatlm umu on()tlxoxf3ta1op eaiei;s) rtr(mpnu4ame lfvtls)sruaurp;o1tetnif3ias s2eln p (0 rtrmo3ty1oatranei (  rxrxm3iy1ap   ivtl(fa2trur nu4aeen ociydls elumo;(0tltnmociydop elieo s0seumirpno4omen nesas) 2urxr nt0opxo ieiysfa2emn s;()texoxf oytfpDrlivs;()s2uoxr3nu4lp elfes t s2trxrono0ole  o3iatfaDua(vp (0tlenxf3ia1oa eaues s teurxr3oudolenlncias s2ur(  ou1texn ocildla ulnmp;t)artrmo3io1fat aueo;s  2xrxopou4op nmnvslt  Dtmx ooo0oeeoio3ias m2rlumont0texrmrctytoatrlivi;()s2toim iu4lmt mfes t)sDuaxrp;t0ale  fciydfs rm(vs;u) eerxrcoatfat luvilt0 etoxr3iy1lltn ncs t s2umx  nu0opxo fciytla2uau p;u)teenir3iy1opDr i o t0 rurxr3nydlmte nct t  ruaump;u1tpx  o3iatfsDulu on(4aexoxfciydomDr ivs t) rxoir nodol   fesl(f 2uauronu0tlt  fctldfa uan pn() etniocoo1om e nvils0t2xoxm3nudal e iviat) rumx oou4olt mictysfaDrm(vont0 eeomrciadlm r ivilt texo(r iy4apenliet tf 2tmxrpno4aexomieiyslm eln onu)aexomf oydfpD  n s (0trtriopiodom emncslsf Dtaxmp;t0alt  i3tytfs2uln o;()alxrio oo1fpDrauei t0 exr(o iy1lm emfeslt a2tmurooo1aeto o3iyd aDum(ms;t)arenmr3oadfa  livi t)srxoxr oudopeeliciat srrr(rpno4tleo f3tat aDumumpnt4 ltomf3oy1opD auvi;()sexmio ny4lmtn net tfa2uax  ou1tetn ociytfsDea(vs;t0 reomf tadoa r uei t)s2urxo oudom  lfcsa()a2taurono1ope miciydfmDrm(mo;(0aleoxrcoatfmDeaieil(0trtr(m3ou1ole mnct t aDua( o;t4alxoioctyd m rm(vp;() rxniocoodoat ai o t)srxmir iu4om elfet t srum(mo;o4apxomfetysfs ran pnu)altrmo3oydfmtraieo;s t2uo(m ou4am e nesas)s2taxrp;t4aeenifeils aDelnmsn(0trerirciy1fmD ln sls0 2tmxmpoy4opee ivsl()a2tmu o;t1opxnmieilslmDea(vp;() lxnmf3oy1fat auvols)trxr(mpoydllenlfcsatf rra(mpou1altomietldlaDrlums u0texnir iytfptean o s0teuoimpoodole lies s)aDua(m nu1tpenii3ildls2ran s u0 lerif ty1fmD auvo;t)trurio no1lmt lfvsls)srraxm ot1aeenioeiydfs rlump;u)texnmf3tadfate ies s0 rtmiopoy1lptemfei tfsrrrxm ;u4oexo ocildfs2ea(mp;(4arxnifctatlpDrai s;()srto(r3nu4ap nmfct t)sDuru  no0aexoiociysfaDemnvp;(0altnirctadlpDraivi ( trtoio io1lm elictltfaDraxrpno1olx mo3iytfmDel(vpnu0aeenmocta1lm  ai i (0t2trir ou4altelnes ( a2tm(  no4oeenmfciad sDem(mon(0alxrmr3todfpD lneo t srtrxr ny1lpt mfeia() Dtrur nt0opxnifcilt a2emnvs t0trxoxr3ia1fm rlnvi t t2trir3oodlme  ivil(  rra(  ou0aex ii3iltfmDua(ms (0tleoxo3tydom rlnes t0 exrxr oo1lme mivslsfs2trurpot4opt mf3ildfs2rmn s;t)aetnircty1oaDeluvi s0sexo(r3oo1omtn ivt sf Dtmu oot1tlxoifetlsfm rmuvo (4arenif3tadlp e iesl(0tetrxr3ou1lmenmivslt)sDum( o;u0oltnmieiatfm2rm( s (4 rerif3oatomDrai o s srum(m3oudolt  fctas  rrmur ;o1teenii3iad aDumums u4aetoir tytlpDeln s;(0trxmiopny4lm nmiesl(faDur(r ;o0tleomietys a uanmo (0 etomrcta1fp  li s;t0sexm(o iu1lp n feias)arumu pnt0aleoiieiatfmDran o (4arxnir ta1lm r iei () exrirpnydllt mfct sfsruaur oo4oeenmfetlsfa2rm( o t4 ltoif3tatomt lu i;t)s2xm(opoy1lle mnvta( sDrmu pno4tpen ictlt a rmn o t)teenir oo1latrlu ol() 2umirpno1olen fvs ()arrmumono0oee iocias m2rmumpn(0 ltnio3totom r ivols0t2xo(r oy4lm  lnciatfsruru pot1tee io3tasls rmums (4arenxf3ty1fpDrlueslt0srtmxo oy4altn ivslsfs2rrxr oo4olxoiieiatls emnvo u4areoif3tatlaDrlnvolt s2toirpoy1openmiesasfarua( o;u1tpe ifeias s2rlu on(0 leoif iy1oa r ivo;( sruoxm3nodoptnmnvt s) 2rrur no1ale mf3iys a2em(ms (0alxrmo3io1fpDeaieils t2xm(r iy1omtelncsa()sDumx pno0tltoioeiyslm2emn p (4teermf iytop rlues;t) etrxo3iy1opee ici sfa2um(ront0apeomieiydfa uanvs;t4artnirctadopteanvils)sruo(o3oudom emnct ()sDurxrpou0tptnioeiadfs emuvsnt0areoio3ty1om eaueslt s2uoio3iu4ap elncslt)a2rr(root4tpt ioetltfsDemuvsnu4texoioctotfmD livols0sruoirpiu4omte ics s)srrrumpot1oleomi3ilslmDuanvpnt0aetnmr ia1fpDrln slt0 rxrir nu1om nmiciltfa2tmxm nt0opt iocils sDumump;(0arxoio oytoat aieol() 2tm(m ny4omtn ictls)s2rmu  ;t0aeen oetydfmDemu s (4 exrif3tadfp e ieolt s2trxm iy4amenmicsls  Dta(rono0opxnmiciasfsDrau o u0 leoifciodfp  luvsls sexmio nu4ape lfvta(fsrtmu pnu0oltnii3ilsfs ua( o;u4trermo ta1lpDe ueils s2uo(mpoy4lm nlneta(  rrmumpot1oexoioctysfmDulums;u4 etrxociotlatr u s;(0tetmxopou4alenlfvsl( artm(mo;t1tptniiciltla2ul( p;u4tltoxociytlm rli ols)t2tmio iu4amtnmivtl(f 2rmu pou1aptnmoeildls2ul(mp;(0alxoif3oo1omt anvo;(0 etoxo3oy4lm elici s)s2umxm no4apxn fetatfsDea(vo;t)tetnmoctytomt aneo t  rto(r oo1ll nmfcsl(farra(  nt1ape  ieiytls2rau snt)tetrir iytopte ies;t0texm(o iydamteliesl( arurxm nt1alt  oetasfm2eauvs ()aetnmf tadfmtean o s trxr(mpnydal elnct s sDra(rpnu4tlxn oeiltfaDrm(vsnt4tlenxr oatopte n o;() eumxr3iu4llte fci (fa2tmx pou1tlen ociat mDraumo u) rtoifcto1lmte u ols s2tr(mpny4ll emfeslt)aDur(mpnt1tptoifeildfm2ulnvpn(0 rermoctytopt  neil(  2ur(r oy1olt lnvsa(f ruau oou4tlxnioctldlsDrlnmont0aeerxo tydlp elu s;()srxoxmpnydlptn nvtls)aDtmx o;u1alxomfeild s2ea(vp t) renmf tytfmteaivsls)t2ur(o3no1ap nmfcsl()aDur(r ;u0apeniociat m rl( ont)trxrmoctytlaD  ueo (0trto(m iydaltn nciasf Dtaumpno0oetnioetadla2rauvs t0altomrcta1fpD luvil() 2toxmpoodop  lnes tfarraum ;o0tle moetydla eanvp;u0 etomr3to1faDeaues s)teumimpno4amte iet ( srrmxr no0oetnmoeiad sDulnvo;u4arxomr3iatfmDe ivilt0s2xrxo iu1lmtn nes s)arrmxmp;u1opeoio3ils s2uau p (4tlxomo totom   u ilt  rtrirpny1al e feiasf Drmu ont1opxoifetytls rl(mo;(0trxomr3ootlatrli i s0srxoxr iu4ap nlfvsat  ruau ont1opeoiieiasfsDeauvon(0tlerxf3iotopteau ils  2um(o3ny4omtnlnvias)a2uaxmono0olxnmfciltfm um( o;t) etnxr oa1fp r n sl(  eurxm iu4opt lnvils  rtax poo4oet  f3iadfm2umums;t4trtnmf3oytla   i s s0trtmxmpnodomen neil( srraxmo;o1alxo ieiad m eau p;t0alenxf3todfm e ivo ()seumim nodol e ieiasfsDtaxroou0tpeomieiatfs umu p t) reomf ia1omDe i il(0 2urxm nydlpt  fvsls)s2rru ont4tpt  oetatfs uanvsnu)aeeoif3tatlpD auei;( t2tmxm nu4lpeemncsat arra( o;o4optn octadfsDrluvo t)arenio3iodlp r ieo;t  rtrxr3nydame licias)sDum(mo;u1tlx if3iaslaDumump u4 exrifctadfa r ues s) eumiopio4ome mfct s s2um( ont1oeenmieiadlaDemnvpnt4alxrmf3tytfm rli s t0 2umxo3iu1op  mfeia(fa2uau p;t4oexnif3tytfa2eau p u0alxoxo ia1fpDeau o;t  2xoxmpiy1al e ieia(  Dtmu o;t4optomocild s rln o;t4trtrmr3oy1la e n i;t0s2xrimpoy1lpee fcs t)s2tr(  nt1oetn feilsfmDrluvo;u) rxomr3ta1fpteauei t)teurir oydop n ietl()sDtrxmono1olt  i3ils m2umn snu)trtrio3oydlmDe u o;s) euo(m io1lmt  nci tfsDtaurpot1teeoioeiysfs2rluvpn() lermr3ootoat liei;(0srtoio3oo1lpe  ieia( aDtm( o;u1tltnmfeiatfsDrauvp (4texriocto1oaD aivslt s2urir3iodam nmfvt tf 2rm(rpot1alen i3iatlsDumumon()trxnmf3ootoaDeaivs;t0trxo(o oy1llt lnvsltf 2umx ont4oeeomf3iat m2um(ms u0 reoir3oytopte uvs;t0trxrxr3oo1lpenlict ( sDurxmpnt1apeo i3iydfm rln pnt4 lxnxf iadlaDe ivs;t0s2uo(mpiu1amenmfvtls sruaumo;t1ape mfeiltls umnmp ()alxrio3todfm  ai slt texrxo3no1alt mics s) 2tr(moot4opxomf3tytfs rlnvs u)arermoctodlp  lnvo;t  eumim nodape mnct (f 2urx onu4tptnioeiydfs rmums (4tlxrmfcoodla elnesl( texo(m3oy1ll nlfvs t a2ra(mo;u1aexoioeilsfm2el(vpnu4artnmfcoytfp  livi t)texo(m no1op n fcslt)srtmumonu0ope ifeiysfs rluvo;(0trtnxfcoatlpt  i s;()s2trxo3ny4optnmicsa(fsrrr( ooo1teeomi3ias sDelump;(0tltnir ta1fat luvslt0trxoxr3oodom elicsl(fsrumu pot1ape iieiys m um(vs;u)alxrxfciotlpte ies t0 exr(r3ny4omtnmicsa() Drr(mooo4tetn fciltls2ra( o;(0artrif iy1fmDelneo t  exoio iy4amt mncil()s2urxm nu0apen fciaslsDumumpnt4artoir oo1lmt auvo;t0 2umxo oudamenmneiat srtmxro;t1aex miciydfsDel( p;u0tlenmfctatfa   ivslt)s2toxrpiudaleemnvslt  rtau pot4optn ocilsfsDel( on(4alxnxr3oodoa r u ilt0srxm(mpou1am n icta(  Durxrpot4oltnifetadla2rln s;t0 lxnir3ty1la rai s t  rxmim3nydlpte nvtltfsrta(mpou1oleo feiyd s eln pn(0tlxrmr3iotlp rln o t0 2xrirpnodolt  ivias artr( oot1tpx mfciaslaDrauvs u4 etoirciodlaDrlivo;t)trxmim3oo4lpenlnviltfsrumu pnu1alxo oeiytfs umnmo u0texrxocoydomt  neo;s0 etoxo ou4al nmfcs t  rrrur ;o0tlto oetltla umu snu)alxomo iotla   uei s  2xr(m3oydap nlfeil(fsrta(m ou4tptoii3iytlsDrluvonu0texniocoy1fm r nvi;(0t2tmirpio1lle lfvs () 2trx p;u1aeenifeiydla2umu s u0altnxr3oodomtrli o ( setrxopno1lleemfes t)a2rrxmooo0aleo o3iys m rl( pn(0aeenmocia1fat  ivi;( setoxo oy4ol e neias arra(r ;t4alxn ociasfs2rau p (4 lerxociy1optr ueo t  rto(o3oo1opt  fvta( srur(  ;o0tpeo feiyt sDulu pn(4artnioctydfm   ueslt  2xoiopoy4am nlivta() 2um(r ;t4ape  i3iltfs ra( onu0 etrmo3todopt auvolt0t2umxrpoy1op elictlt sDua(m ;u4aetomietydlaDeauvonu0alermr3iatopD anvi;t srxrxo iy1omt lncia() rrrxr ou4oeto fetlslaDuaums t0 exrio ty1lat liei t0 rurir3iudlpenlfvt t  2urumooo0apenmoeiysfa2ulump;u4altnio3tadlpD lieslt0seuoio3no1om  lict s) Drm(ro;o0oexomf3iltfa2eau p;(4 etnir oa1lpt  ies ()t2um(r no4am  miet ( s2rm( p;u4altnii3iysls elums;t0 ltnxo3iydoat anes;t0tetr(o iydlpe mnvtat)s2trx ont4apx mieiydfm2ulnvp;u4tlxnxfctydlpte i sls) etrxm3iy1amtnlnvi t)a2tm(mp;t0tptn ietytfm2eauvon(0texnmr tadfmteanes ( srumiopoy4al emfvs tf Drruroou4alxnmfctlt m2rmumpnu0aetrmo3iodfmD ln ols)trurxr3ny1amt licsl( artr(mo;u1tetomocild s2rl(vp u0alxrif io1omt  n i;t)teto(opnu4alt  feiasfa2ua(m ;t4tex  iciasfsDumnmo;(4arxoir iydlaD au ilt srtm(m ny1lmenmictls  2ta( ont0tptomi3iytfa2rmnms u0aetnmfcoatfate uvo s) exr(opiy1altn fci (f 2ua(mo;o4tlen ocias sDemn s t0tlenxf ia1fm rai s t)sruoir3iydam n nvils) 2rrxrp;u1oexomfctltfa rmuvs (4 lxnmr3oa1om eai s;t  etmio3ny1ap  mivt t) rtm( p;t4oltomoeiadfs uanmp t)tltomo iadlaDe ies;()seur(opiodome lnct t)aDururooo4aleoif3ild sDumuvs u0tltoif io1fa rli i (0 rtrxr nudomee fvtlt)sDurum ;o4tle if3iad a rmuvpnu)trenmrctydlp elivo s  2urio3io4apt  neia()sDtm(rono1tetoio3tatfs2rlnms;t) ltrif3io1la ranvi s)s2uoxm3oo1llt lfcsa( artrx  ou1teeoiiciad aDelums (4 rxomr3iydlpDelu s (  rto(rpno4opt  neia( s2uaxrpot0opxoii3iyd mDrlumo u) ltrmrctatlpDrai o t sexo(o3no4lpe lfctat)srrmxmp;t0opt mfetydlsDulnms;()tlxoir ta1fateli sl() rumir no1ap n ncs (fsrrm(m ou1aexn f3iydfm ua(vs u4tetnxo3tydlmDr i o s)sexmimpny1apee ieilt  2rmxm ;o4texomfeiys s2rl(vo;u4alermo tatlmt  n o t)t2xrxopoodap nmnvs (f 2urxr nu0oltniieiyd sDrlnvo t0 rtomrcoytfa rlieo () rxm(m iu4om  licsl( a2rm(mo;o1aexomiciat aDea( p u)tlxrxo io1lmDrli s s  ruo(mpoydlmtemnesa(fa2tru ono0opeo i3tad a2uau snu0 exnxo oatfp rlivi;( texoxm oy1olee fvta(fsrrm( p;o4optniictld s raump () exnmf ootfateanvsls0t2um(r3ou1oltnlnvtltf 2rmxr oo0oet mieiat mDuaums;t0texoio oytopDeluvo s0 rumir iodlmte nctlt) rum( ont0tpt  i3tytfm2eaumo t0trtomf3tydoa  aivi;t  eto(o iudomtemieils  rra(r ou4olx  o3iaslsDra( onu4 leomo3ta1om eanvsl(0 2xo(o3nydop  lfvtl(fsrtru pot4aleo fctysfm2rlumon(0 rtomrctatfmD  ieo;s srtrim3nudoltn fes s arrrxroot1opxo oeiat m2ran onu0 rtoircia1fmDrau ilt)seuoio3iy1olen nciatfs2trx pno4opxn i3ilslm ulnvo u)treomf3iydfptrlnvsls srxo(m3nudlpe lict t aDrauro;t4oleomociltls2rau s t4altnirciotomDr uei () rxoxmpiodope lfvilsfsDrm(mpnt1tex moeiadlsDrlu pn()alerifcio1op   neo;()teuoxopno4oltelics tfs2rru pou4aptoiiciltfaDrm(vsnt0tlxrio3tydlat  nvo s0 euoirpou1ol  lics s sDururo;u1oet ifciyd m2um( o t4treoxf3io1fp   ivilt)teumimpoo1ll  lfvs tfsrtaxmoot1aet  f3iyd sDrlumpn(4 etnmrctydfm eliei () 2xmim3iy4a
\ No newline at end of file
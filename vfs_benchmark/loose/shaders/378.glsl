@@ -0,0 +1 @@
+u s;(0t2xmimpiudlme licsatf 2urumo;t0tee mieiadla ranmp;t)tlxoir totfp rlu i t0t2tm(mpnu4olt mfvsat a2ra(mpnu0alx iiciatla rauvp t4 exnifcia1omDr nvs t0 rurir3iy1omtn icslt  ruaur no4tpxn ieildls2uauvs;()tlxomf3oa1oa r ueilt s2xr(o iydomenmnciat)aDrrxronu0tpenmo3iasfm2emnvo;u4alerir iodfaDeaieo ()trtmxopiu4olenmfvslsfsDurxmp;t0tlxomieilsfmDel( p;u0alxrmr3oydfmD li i;s)texrxo3oo1lmeelfvs tfarumu onu1tpto fciasfs2ul( pn(4 rtrif3iotlpDrlu o;(0s2xrir3oy1lptnlfvsltfsrra(ro;t4aetoif3tadls2rmnvs u) reoio3ia1lmDr uvo ()t2xo(m3oo1ame  netl(fsrraum ot1oex moctls m2rl(vpnu0 etrxrctatfmDe i o;t)s2umxo3ny4altn ivsa( sDuaxm nu1aet mictasfaDum(mp u) rtnxo3oadfmD lu i s)trtoxopiu1olt  ivtls a2tau  ;o4oltnmfeiysfs2ean p t)tlxrxo3tatlatr i o;s0 eto(o ou1llte nvt s aDururo;u0ope if3ilslaDeluvsnu4aexrmr3oy1oatrlu o;s  2xo(m no1ll emnesas srururo;u1tpxnio3iadfaDrlu p;u0 renxrciodom eanvol() 2xrxm no1oltn iciltfa2rru onu0tpxnif3ils sDua(mp;() ltoif3iytlmt livsls)teurxm nodlm elfes sfsrra(ront0oetnmi3iasfm2elnvsnu4tltrif3ia1la eanvs;(0teurir no1olenlnciat sruau ont0olt  ictatfa2ulump t0 rxniocia1fptrln i ()s2urim3nudaptnmiciat)a2tmx  nt1apx  ieiydlm2umnvp u4 exrmr iotlpDrluvslt  2xoxo3nodale  neia()srta(m ou4oleo o3tysfsDua( snu) rerio3oytlmtrauvo t)srxrirpou4oleelfcs s  2rrx  ;u4opeomfcils sDean pnu)arxrirctodlp  lu o s trumio3ny1ap elnvi t) rtrx oot0apto ieiltlm umuvs;t)alxomf3todoat lies;(0 etmirpoudlptn fvslt) 2ua(r nu0texn oeiyt sDem( p (4 eermoctadfmtrlueilt)sexrxr iodam  mieias sDtmump;t4apt mfctys m2ea(vo;u0aeeoxrcootfmDr neil( srtoio iy4ome  nesltfs2ta(ront0tltoiicildfs2em( s ()aetnxfcootlmDeli i (0tetoio3nu4ap nlics t arra( pnt0aptnmociyd m ean on(0 reomr3tydopD lu ilt) 2urim3ou1amenmfcsatfs2rmu p;t1aexn oeiydls2ranvpnt0texoxfciodfaDeln ols)trtmir ny4omeelnciat  2raurpoo0tpe mi3ils s2ua(msnu4alxniocia1oateai olt  2ur(mpno4lpen ncs tfaDurxmpoo4opeoiietadfm2elnmo ()altnxf oytfp raieo t0tetr(o oudap e ics sf Dtrxr ou0oeeoii3tatlaDea(mp;u) exrxr3io1fatelnvs t  etmxm iy4al  lnvtas)arrm(r ot1oexnifcilt s rmnmp u0 lxrir3oy1lmDranvi;(0s2xoir iodaltelfctls)aDua(  ou1teen fctaslm2um(mo;t4 renxf iy1lmt luvsls setoxo ou1al  lnci s  rrm( pnt0optoif3tas a ulumpn()tlenmf tadopDelivo;s  2tr(o io1al e nei ()a2tmxmono4aexoiieiadfs ua(vont)alxnio3tytfmD  ues () rtm(o ou4lle mfvtlsfs2ta( o;o4olxnmf3ildfa uauvo (4altoircia1fpt  ieslt  2uoxrpoodol n nesat a2ta(mp;t0olxoiictld aDulnmp t0 exoifcoodlmt lies t0trxm(opno1omenlncta(faDtmuront1oex  fciasfs eau pnu0texnmrctytoaDeaivilt)srxrio3oy1lltnlfcsat) Dtmuront0alen i3tadlm2uanvpnu0tetrxf3tadlmteln ols  eur(r oo1amenlivsl( srrax p;u0oeenifcild aDrln on() lxrirciatom eaiesls srxrimpoo1lleemicia()artrxmp;t0openmfcildfmDrmnmo;t)trxoxocoatfaDrauei t0 rtr(o nodomt mfcsa(  ruaxmpot4aptnmfeilt a2ulumon()arxomf3tydfa elueil(  rxmir3iu4omt  nctatfa2tm(  nt1aet mfetytfs rlnms;t)tltnmfctotoa e ivils0 exo(opoo1om n ictasf 2umx poo4olx mo3iytls ra( p u) etomocoo1fm  livs;()tetmir3nydopen fetlt) Dta(monu1aet mo3tad a uanmsnu4altomr tadlm ran slt  2tmim3nodome  icta( sDurx o;u1tpe mietldfaDuan o;(4 exnirciadoptr neilt)sruoxr io1apeelieias  rraxm ;u4tleomictlslm2rm(ms t0altoio to1fmDr ieolt s2um(m3oodopee ivtatfartrxr ;u4tlxomieildlm el(ms;t0 reomr tydlmDrauvi;( texoio nudaptnlfvta(faDurxmonu4oetnmictytlaDel(monu4 etoxocto1fp  anes (  2toio ny1optelfesltf 2raum oo0apt iietltfa2uaums;t)alerio3ty1laDelu ols s2uo(r3oudal  lfvil()s2ta(mooo0apeo feiad m emumo;u) rtoiocoadfaDrauvs;s0 etm(o iy4ape  fcs (f rrr(roou1apeomietyt sDea(vpn(0tlerxr oydlmt aivs;(0 2trxrpiu4lltelnvi ( aDtmu  no1oet  iciys mDrm(von()areoxr3oatoaD anvo s0 etm(o iy1ap e neil()srra(mp;o1teto feiadfmDrmnmsnt4 ltrmrctotfmt  ueo;t0teto(rpoo4lme mneias)aDtrxm ;o4oex iiciltfaDulnvp (0 rtrmrciadfmt anvilt trxr(rpio1ll   nct s)s2ta(mpnt1tpe miciyslaDel(msn(4 reomo3iy1optr i ols)texmxm3nu1lleelfvil()arur(m ou4tet mo3iyslmDelnmp u) rtoxfctatfpDran s;t0texoxopio4lpe mivs t sDtaxr ou4tpt  ietldfm ra(vo u0tlermfciytop eai olt  etmxm ou1amenmnvs sfaDuaur oo4oee  fciatlm2ua( pnt0 lermf3iatlmtelnes;()setmirpiu4apenlicsatfsDta(ront4tet  ociyslm rl(ms u0aleomr3iadomte neslt seurxm iudamen fviat s2um(moot4alto fctatfa rlnvo () rtnxfcoo1fpt lnvo s srtmir ou4al nlncslt a2rmu oou4apxoii3tytls rlums (4 eeoioctadlp rai o (0 rxm(mpoy1lp  lnvia() 2um(mooo4oex moeiyd aDemnvont)tetrir iydfmD luvo;s)t2tmxrpou1am e fcilt arumu pno0optoifetat s2rmuvpnt0areoxocoadlat anes;s) rtm(r3ny1al nlfvt sfsDrmx onu4opxn oeiasfm uluvs ()teerxo3iodfm  liei;( seum(o ou4al nlfvsls)srtmx oot4opxo ictltfsDemu snu4aeerxfctadlpD ln o (0sexmir3iy1lptnmicil()a2rau pnt1tpxnmoetat sDeauvsnu4tlxoxr3iatop raivil() eum(mpou4lp   feia()arta( oou1aex  o3tls a2rauvpnt0tetomo iotfptrlnvo () rto(mpiy1lm emfvs sfsDrm(  ;u4oetomfciasfa2uanvsn()trtoxo3totlpt aivi (0s2xm(opno1lm e ivs sfs2rr(m no1aeeomo3ils a em(ms;t)tetoirciydoa ran ils0 rxoiopny4lm n ncslt)sDuaxmpno0oet  i3tlsfa rlump;(0 exrifctotfpteliei;(  2trim3oy4olenlnvi ( sDururoot4tlto o3iytfm2ulums t) rxomocoo1opte neolt0 rxrimpiu4omt  fci t aDtr(mpoo4oeenio3iysls2em( s;() rtoio3ia1oa rln ilt s2trxo io1lp e neia()aDrr(monu1aeeoif3iatlm umnmo u4 lxrmo3todfp elneols0truoxrpiy4om emfeils s2rau  ;t1opt  fciytfs2rm(ms u4tlxnifcty1fmDelivo;(0trxo(o iudame mnvilt artm( o;o0alen f3tld sDumnmp;t4arenmocio1fateauvolt)teumxo3no1lmen icsl(  Drrx  ;u0tetnmoctydls eaums u4artrmo3oatfp   nvs s) rurirpiodom elfcsl() rrrxro;o4teeo fetld s2ua(vo u4altnmoctytoa   n s (0 eurir io1ape lncia()aDraur oo1oexniietasfs2rlnvp t0alxomf3iodfp  li sl()teuo(o nudoptemivs tfsDtrxrp;o1tetn i3iltls2rauvpnu0tltomociatla e uvs;s)sexoim iu1lmeelictl( s2uru  ;u4olx  f3iltfm2ulu snt)trtrmf3tydoa e ueilt trtmx
\ No newline at end of file
@@ -0,0 +1 @@
+n sls)srtrxopoudlmt  icils a2ta(r oo1olxnmfctatls uln p;(4alxrmo3ootfpD lieo;(0trxr(o iodamt lfcs ( sDrmuronu4aee iictltfm elumo;t0 leoif oydfatrlu ols)t2uo(r iudop eliesl(faDrr( ont1olxn o3ildla2rln o t)arerifcoadopDe neo t)seurxr oy1amt mfciatf 2rr(mooo1alxoii3iatlsDra(vsn()tltnmr3ta1oa  auvi;s0 etm(r nu1ol elnetl( sruaxroou4aptoiociysfm emu p;t0 rxnxr todlat lneol(0s2urxm iydomen fctlt  2tmxmpnu0ape  i3iasfa rauvpnu4artoif3oodfpDrau o;( srxm(r no1ameemiet t arrmx pot0oltomieiytlm2umn o t)tlxnxr3iatlmt  uei (0trxmim3ou1lp nlivt t a2rax p;t4alxo fctyt s2ra( s u0 rxoxr tadlptraieil(0 exmxm io4ap emfcias  rtmx oot1tpe io3ild a2uln p t4aetrmoctatlptr ieslt)s2ur(r3oydape  fcs s) Dtaum ;o0tpx ioctydfs2um(vp;t) lerxr oydlate uei s) exmxr3ny4al e ivsa(fsDurxro;u4tlto oetydfaDul(vs u0altoxo iydfpDeanvo s0trxrxopnudolenlici s)srtmxront0tet mi3ilsfsDum(vs;() lxnxf3oa1opte ieils) etm(rpou4lp   fcilt  2umxront4opt mictat a2umu snu0 lerifcoy1fa ranvols) 2xo(o oo1oleemnctls  2umu  no0ole  icildfm rmnms;t4aexnmf tytfp eli il(  2uoxr iodlmeelfvslsfsrumurpou1apxnmicildls uan on(4 lenioctodlmt li ols) euoxo oydlm  lfvs s sDraxm nu4olx io3iasfmDua(vp ()tlerif3tatfatrlieo;s0s2umxr ny1ame  fciasfaDuax pou0texn i3tasfs2rmumsn(4arermrciytfm eau o;s0t2trxr iu4lmtnmfetls aDrrx  no4oleo feils mDuau o t4tetrmocia1fmDr uei;()trtoxrpoo1lmen nvta( sDtmuronu0ope iociyd s2rmn o;u0treoif ootoate n i;t tetmir3io1omenlnetltf 2trxro;t0optomfctat a2umnvp;t)tetrmf3iytfmDr nvo;( s2xrir oo4lp elnvt t  rra(rpnt0alxnmo3tat a um( o (0arenmfcoo1lm elues s srxr(o nydolee fet (  2uax  ot0aex miciyslsDuluvs;t)tlxoxo iadlaDraivs ( setrir3nydap e feslt  Duau oot1tlxnioetatfm2em(msnt4trxrmrcta1opt lnvo s)srtoxr3nu4lmte nci t) 2rru o;u4oexo i3tadls2emn s u) reoxr iatfpDeaneil(  etr(o3iu1lm nlfvtls s2trurpou4tpxo ieiadls ulnvp;t)treoxo3ta1fptrlieilt)setoim nydlmee neia( s2tauro;t0apt  oetysfs ra(mp u0arxrif iodoptr u o (  2xoimpou1ap nlnei tfarrmump;u4opx ifetytls uauvon(4aeerir iytla  luvs s)tetoiopnodopenlivt ( aDrmx pnt1tleoif3iydfaDumnms;u4tetnirciodfaDelnvi ( trxrxr no1ll  lnvta() Dtrxr ;t4aeeomf3tydla um(msnt)arxnio3iadoptr uei;s  euoxo3oydoptelicilt) 2um(rpot0olx  f3iyt m2umu p;u0 eenifctytfa  livi;t) 2umxm ny1ole  fei ( srrrur nu4oeto ieiydlm rlums;t4tltrxf3iydlmDrli sl(0 rtrio3iu1lle  ivi t) rurx  ;t0tleoifciytfa um(vp t)alenmoctydlpteai s t t2xoxrpou4alt  ncsa( srtm(r ou1tee  ictytfmDumn pn(0 rtniocoa1om rlu o s  2tm(o oodamtnlfcta( aDtaxr ;o0tlenif3tldlsDranvp (0tetnmr3iy1op e neo t0srxrxm nu4llt lfvsls)srtrumont0oexniociyslm rlu o;t0trerxrciydoa e uvs t0trxo(m3ny4omenlnet s s2tmxr ;o0aleoioctytlm2uluvp;(4arxrio oatfa e u s;(0srurxmpiudol n nvia()a2tax  ;o4tlxomieiytfa rln p (0 renifctodfa eln o t t2urxm3no1aptemietlsfaDra(m ;t0tee  iciltfsDrlums;(4tlermrcoa1omtrluvo;t)seum(rpny1olenlfetat  ruaxroou0olt  o3iys s ul( o;u0artnif io1lmD  uvols teuoirpoy4lmte icsasf Dtru oou0apt mocils aDuln on() etnmo io1lm eli o t) ruo(opoodlmtnlnctl( aDra(rooo0olenmfctatfmDel(vp ()trxomrciodfatrlivs;()srxo(opiodapeelfes s  Dua( p;u4tpenmo3tad m2um(vo t)areoif3todfm rluesls t2trimpno1lleemfcilt)srum(mpnt4tpeniiciltfa ulnmo (4trenmfcoytoat lnei (0 2to(opiydopt  fct ()a2tmu ooo1tlenii3iltla ua(mpnu4 etrmr todfmDelues;s)seuoiopiydomt  net (f Dtmur no4olx mfciaslmDuaumpnt)alxnmo3oatlp e ivi;s0texmirpiudop nmieiatfsDtm(  ;u0tpe iociyt aDuauvo u0areoxo3iy1lpD  i s;s0setrxopiodop nlfet s aDrmxrp;t1aptoifctysls2rauvsnu)areoif tadlm eaivi;t srto(r3no4om   nvi (farraxronu1tpx iieiys sDrmuvp t4trtnir tydlmD livols setoimpiudlm emivta( sDrru o;o4tlx  o3tat aDrluvo;(0trxrmfcoytfm  lu o (0trur(opou1oltemneiltfa2raurpnt0tex iiciat a2rlu p t)altoif3oytfmD ai olt seuoxm ny4alt mics s  Draur nt1opxoif3ils a2eanmpnu)tetnmo3todfa  au s;s  rumir3no4amt mies s aDtaxrpnu0olxnmfeiad aDrl( s ()trtnio3todlm   u sls0truo(r3oo1al elieias sDum(mpou0oetnmi3iyd m2emn pnu0aetnmo tadlptean i s)t2toiopny1llt  ivslt sruru onu0oexoii3iys a2ulumo;() etoio3oy1fp elivils  etrxm3nu4altnlfeilsf Dtm(rpot1tlxn ietysfa2ranms t) lenmo oydfmte n s;t teuoxopou4op   nvsa( artmumo;o4aexnioeias s rmnvs ()aexnxo3iodop e n i;(0srxm(opnu1ap elfvtlt)arur(  oo1tee mieiatlsDum( o t)alxoxrciotlp elu o ( s2toxr3nodlm  lfvsas) 2rm(r ;u1aeeniocildlmDra( snu4alerxrcootlatr nvsls) 2xm(opiy1apt miciatfarrr(  nu4oetnmociatla ea(mp u4 lermf ta1lpD lieo t0 2tm(o3iu1am nlnetas)s2umurp;t4olxo iciydfm2uluvpnu4 reoir3todopD auvils  rtmir3no4lle  nviasfsrtaur no0apenmieilslmDrmuvp;u0artnxr3oy1fpD au sls)t2xo(mpou1lleemfvil() 2rrumo;u4opeo oeiytfm2eauvs;u0 ltnir ootopDrli ilt tetoimpio1om nmiet ( a2rrxroot0aexomoctysfa2umnvp;(4 rxoir tytlmtelnvo s seuriopio1lmeemivilt) rurxmo;o4tlen f3tlt s2eluvsnu4treomr3to1fptraueo;t0t2trio oo4amtn nvslt) 2ua( oot4opxoioctasls rlnmp;(0aeeoio iodla e neils)t2xo(opiudlmtemiei sfsrtmxront4opeomoeiadla2rl( snt4 lenxo3todopte ivs s teuo(m3nu1lp e fcil(f Dtr( oot0aexo ieiad s ua(mo t0tlxrmf to1optean s;t0srxo(o oydopen ivsls)srrmx  ot0ale  f3ias s2el(vs ()treoifcoatoatrauvs ()t2tm(r3nydopt  netlsf Drmum nu0olxn o3tysls um(msnu0trxnmf oy1la rlies (  eto(o oo4lm elfvt t aDtaxrpnu1aex mfeiatfsDuau s;t4 lenif tatopD lies s  2xm(o oo1lmt lfcsat arrruro;t0oetoiieildlm2emnvo;u0 lxrmf3totlmt  ivsls)srum(o3nydam emicta(  rrrum ot4tlen ietys m raumpn(4arxoif ta1lateau i ( s2tmimpou1llen nes (  rrax pnu0oltniieiltfaDumuvpnu0 rtnmr iotlmDrli s s)trtm(r oo1al emiesl(faDurur ou0tpt  iciatfs2ul(mpnt)tltnio3ty1om r ueol(  2xr(o3iu4om n neslt)s2umx p;u4opeomf3iltfaDuln pn(0tltoir3tydfpDeaneils t2trir3nu4ll n fcil( srraxroot1apxn ieildlsDul(vpnu0 lxnifcty1fmD  uvo s s2xoim iy4alenlnvs tfs2rmxrono0aetnmietldfm em(vp t4 rtrmrcoy1omteau i t0s2xmio3ny4lm nmfet t)srra(mont1olx  ictydfs2rlu ont)trtnxo3todopDe ivolt) euoimpiy4al  mncta(  2tmxro;t4aet mf3iltfsDelnmsnt4tleoir iodfaD lies ()srxr(m ny4open nvtls) 2rrx o;o1tpxnmo3ilt m rl(ms;u0 eenxr oatoptr ieilt0 rur(m3iu4alt mnesat  2rm(mont4oltoifciat m2uau s t)alenir todlmDrli o s0sexmxmpiy4ap n iei s sDurx p;u1tpxomietlsfa2rl(vp (0trxnmf oy1lm  lneo (0 rxoir oy4apeelfcil( arrr(m ot4apx miciys aDulu s t4 ltoxr3ta1lpDr nvo s0s2xmxo3nudam n feias) rrau oot1olxniieildfs2uanvp;()arermf3io1lat liei;t) rxmxm nodom n icta(f Drax onu4oexoif3iadlsDumu pn(4tleoxo3tadomt lueols0 euoirpnodal e ict () 2uaur nu4apenmocils a elnvp;u)aeeoifciadfate uvs;s  rxmxo3oy4llt lies tfs2urump;t0aeeoifetaslm2emump u)artrmrcio1omD auvsl() 2umxr3iydame mnei t  rurum ;o1tpxo feiltfs2eau o t0trenmr3oy1lmtrln i;t)sexoim ny1al  lfviatf rtaump;t0aleomfetlt a2um( ont)tlxrmrcoo1lmt  u o s0trxr(m iu4llen icsa(faDra(  ;t1openmfeiysfsDulumpn(4 ltrif ta1lp elnvils)trtrxm iudaptnlfcilsfartr(mpou1tpt io3ild a ea(mo u4trxrmrcto1lmtrli i s0s2ur(o io1lp e netl() rta( pno0ale mf3tad m ua(vs () exrxr iotfm rlues s)texmxr3iodop nlnviasfsrtmumonu1oexoifciat aDum(ms;u0aetoir3iy1late ivils)srur(r3oy1lm nmietat srrax  ;o1oetnii3iytla uluvp;t) lxomociytlptelu s t) 2xm(r ny4lp elnci t  Dur(mpou4altoifeiatlaDean pnt) etoir oodfpDeauvo;(0 ruo(r oudlpe  ncs sfsrraur no0aeeniocildfm rmu s t) ltnxo todla e uvs ( s2xr(mpiy1lpenmies tfarumu  oo1open oeiasfaDrlumpnu0 reoir3ia1fp elivi;() rum(m oy4ole lfvt (  rua(r ot0tptoifciytfs el(mo u)aexnxr ootlptr uei t) 2xoxo3ou4optn iet t sDtm( ont1oex mo3tad a2emu snt)aexomo3oytfpt  nes t)teuoio io4al  licilsf rtrx  oo4oexnmf3iys m2ul(mo t4 etnir iytoa   ueo;t)seum(opiu1ap   ivt tfs2tmur ;o4tlx if3iyt sDeanmp;(0tltoioctydoaDean o s)trxmio3iudop emncsasf Dua( p;t0altoiieilsfm2rm(msnt4 rtrmfcoy1op e uvsl()trtrir oydoptn ieias)a2uaurono4tlxomfctadfs2uaump t)aetrxr tadom ean ils0s2uo(o3iy4lm e iviat  Dta(rp;t4olxomoctasfa2rlnms;(4 ltnmo oatopD  n s;s t2xrio ou1ape lies t srtmxrp;o4alx  ietls a rln onu) rxrxo ia1omDe neo t  exmxmpiudolenmfvtas) 2rr(rp;o1tetniocils s2rau s u)arxnxocta1la   i s (0 exr(o nodam   nvs sf Dtmu  oo1texn ociltls ranmp t4trxoxr3iatlmt  nvs;t)trumxo iu1alt  nctatfa2trumo;t0aptn fetldfs2eau o;u4arxoir3oa1lp eliesl()t2toxm3oo1apt livsas  Dumum nu0altnmi3iatlm umumo;(0arxnif3ty1lmte ivi s0srtrio3iydlp e ics s a2urur no1oet moctas a2el( on(4 exrio3ootfm   n i s) 2xriopoydaptelfeta()sDrruro;t0opt ii3iyt mDrlnmsnt4texniocoo1opD  n o;t0 rxoxm nydlmtemfcia()srumum ;u0tlx  i3tadfaDean s () rtrxf oa1lp e ies;( srtrio3ou4ape  fct s  rur(rp;o1tlenifeias aDuln o;t4 lxrmrciy1fa  aivo;s0texrim3io4lmenlnvils  rtr(m oo1oeenmietlt m2el( o;t) ltomo oytlmt aieo s0setm(m oydlmt lfvsl()sDrr(rpoo1olenif3iatfaDrauvo t4tltoxrctotfp   nvo;(0 2urxm io4llen ics tf rtaum nt1opxnioetltfa rmnmp u) leomocoadlm eauvolt)trtm(rpnu4lp n neilt sDrmum ;u1oex mi3tls s2rmnmp;() leomr oodomDeauvs s srxmxo3oodom   nvil( a2urx o;u1tlto ieiltlaDem(mp;t0alerir3iytlpDr u sl()trxmiopnodopeemicils sDum( p;u4tpxomo3ias m elnmsn()arenir3tatomtrlues;()srtoir3oo4olt mfviasf rumu  no0texn iciasla emnvpnu)texrmocoy1fm rauvils  exr(rpiydlmenmictl(  Dtau o;t0tle mfeiydfs2ulnvp ()altomo3ia1oaD lueils0 rtm(m3oydllt mnvsl(  rrrxm no4oeeoiicils aDumn p t)tlenmf ia1lmDean ilt)teto(r iy1ol nmfvta( srua( p;t1aetn oetltfs ra(vs;u0aetriocoodlm rli o;s)texrim ny1ap emnctlt) rtaurooo4teto f3iydls umn o u0tetrir ta1omt livs s  2xm(r ou4apeemieslt  rtmx pnt1olto fetatfs2ul( o t4trenmrcoy1lm rlivo;t texmio nudlm  lncias  rtrxm nu1aexnio3iltlm2el( p;(4teenir iydlm   u s s) exo(opnodapt mnvils) rumu  nt4tpe mociat sDea( s t)alerirciytoptrln s;(0srtr(m3nudaptnlfcsa() 2rm(monu1tpxomiciadfmDrlnvp (4artrmociotomt  n o s  rurxo iy1lleemici s)srur(m oo0tle mi3tldfm uau s t)aeenxfciy1fmt  n i;t  eur(mpio4lm elnes (f Dua(r ot0tetomieiadfm ra(mon()artrmfcta1op rliei t)seur(r iy1oltnmncia(  Drm( pou1apt miciydfs rau p (0arxomo iytop  lu o (0s2trxm io1ole mfvsasfa2raurpnu0oeeomictyslm emuvp;u) etrir3tydfatr nvol()truoimpoy4aptelfvia() rra(  ot1opxniiciyslsDemnvp t0aeeoio3ta1lpD  ies s0 exo(o3nudomeemfvs (faDta( pno0aptomf3tldfmDum( pn() ltnxo ootfa rlnesls)tetoxmpnodaltemncsas) rra(rp;t1olt iicilsfm em( o u4altomfcty1lm e uesls0s2xrxmpio4llt  nvsls a2rr(m no1tetn i3iytfaDemn pnu)trtoxo oadop r uvilt0s2uoir3iy4apenlicta(  2rmurpnt1aeeo oeildfa rauvp;() lxnmr ty1faDeanvslt)trxoxm3ou1lp n fet (f 2rm(  oo0tltoif3ilsfs2rlnmo;(4tltrmf iydoatr ies;( srto(m3nydal e ietat artr(rpou4opt mieiytfm2eln snu0 reomr3oo1opDe i s t) 2uo(r nu1aptn ietatfa2tmxmono0aexo iciys sDul(vpnu0tlxrmfcoatopte uvo s0 rtrxopou1lp  lfctls sruaxm no0oex mieiadls2umnvonu4aleoir tadfmt lueil(0s2urxmpoy1ll emivsa()aDtau p;t0ape mfeiyt aDea(vont0 ltriocto1lptraues;()trxrimpiu4ape mfei tfsrua(m ou4aptn fetysfa rmnms;u) exrxo iydomDelneslt)srxr(rpiu1alt mfvsa(  Dum( pnu4opxnmfeiltlaDrmnms () rxrmr3ta1laD auvi;() rtm(opnu1lpenmieiat a2umu p;o4teenif3iasfs2elnvon()aexnxfcootfpD aueo;s0 2xo(rpoy4oltnmfetl() 2ra( pno4tlxn o3tls s emumo;() ltriociydlpte uvi s)s2urirpou1altnmncia(fsrraxm no0opt iocilsls2ul( onu) leoxo iadopDelues s0teumim oo1ll e feia( aDrru oot0tlto o3tas m2rmumpn(4trerir iy1opt lies s0sruoxmpou4lmtelncsl( s2uaumpnu1apxomfciasfm ulumsnt4 rtrxrctydlpDr ueo t) 2xoxm oy4ame mnetl()sDtrum ou4aleoifeilt sDrl(vonu) etoio3iatlpt  i olt0 2trirpio1om  mnetlt) Dtaxrooo1alto i3tadlsDelu snu0tltomrciy1faDelnvsl()s2um(r3oy1oltnmicslsf rta( oot1alenif3ilslsDeluvpn(4artrmr iatlat  i slt0srxmimpnu1al nmict (fsDtaxmont0opt  ieiyt sDran sn(4arxomo3iy1opte n o s) 2toio iodalt lnvsas arraxroou4ole moeils m umnvpn(0aleomrciatlptrauvol() euo(mpiudale  ict s  2umxro;o1tetnmi3tatlaDulnms u4teeomr iydlmtr ieo;( srto(m oo4am nmneia( aDumumooo0aetoiieiasls2emn s;(0trenxf ia1fpDeli i;s)t2ur(r oodapeemfcs (faDtr(  ;u1tlt if3iysfm2ran s;t)arxoxr3oydfpD aueslt0t2xmirpoy4al eliviltfsDumuro;t4alxnmocild sDuluvsnt0texnmrciadfp rli s;s0trumim oy1optn fciat  2umx  ;t4tlt if3ilsls umump (0treomr3oy1fmD au s t0teurxm3nu1lleemfes (f rtax p;o1oeenifetltla em( s;u4aetrxr3oodfaD  n i;(0setmxr io4amtnlietlt) rum(m oo1aeeo feils a rlnvpn(4altoxf oodfpD  i sl() 2tmxo iodol  lfetlsfartaxrpou1aex mf3iad m ea(ms;t) eermrciy1lpDrauvols srtrxr nudoptnlivt s arur(rooo1oex mociasla2rmu p t0trtrxocoodlm eaivs t0t2xoxm3oo4alt licia( aDtaxmpno4apto feild sDrln snt0tleomf totfa elueo;s)teuoxmpoodaptelneslt a2ta(mp;o0tee  i3iytfs rauvo t)altrircoo1oa r i i s0s2trir3oy1llte ieslsf 2umump;u0oeto i3iat m2em(msnt) rxoir oy1opDe nei;(0srumxrpou1omtn nctl(fa2tmxrpou0aee ii3tlsfaDrmnvo (4 rerif oa1oateaies;t0texm(mpou4altemfctls a2umu o;u1opeo iciysla2umnms;t)trtoxfctadop elnvs s sruo(o io4al nlictas) rrau o;u1oex iictadfa ran sn()trtoxr3iadoptr ivols0teum(o iy1op nmnvt (fa2rrur no0aeen ieiltfs rmu p (0altnxo iatoatr ivil(0s2xmxmpiydope mfvtl() 2tr(ronu1olenifeiasla ra( snt) exoir3oodlate n ol( trtmim oodam e nct sf 2umx ooo4aptomfeilslmDuan o (4aeeomo iadfatr ieo;s0srxoxo3iu4llee ici t aDtrxmo;u4ope  iciad aDumnvpnt0 etrir to1fate u o t)s2trxrpou1omeelneia( s2tmxrpno1tex mieiad m rlnmsnt4tltnmfciytfptrauei (  etm(opnu1lm n ncilsfsrrrumoot0olx moetys s ea( pnt)tltnmo oa1om  lies t) exrxm3no1amenlfeilsfartaxm nt1olx miciad mDeanmsnu) rtnmf3iy1fat  i i;() rur(o3oo1omtnmncsas)a2rmu poo0tltomfctlt m2rmu s u)arenxo3io1omD livsls) exoxm nodlleemneilt a2umxrpnt0opxnmi3iyt sDrln sn(4tetoir3iotomt  ivs (  etoxopoudamen nctlt)s2trumo;u4oex mocilsls2el(vs;t0 ltnifcto1fm eluvilt tetrim3oy4al e icils)arumur oo0tpxnif3iydlm2rmuvp;()alxnxr3io1lpteanesls0t2tmxm ny4al n nctas s2raxmo;t1apxniicils a ulnvs t0 rerif iatoate ivi ()srtrxr io4al emncslt)sruaxmont1tetnmfeiatfaDelnvsnt4tlenio3iatlp   uei;()srxmxo3oy1lp nlnvi t  ruau o;o0oleoiictysfaDelumo;t4 exrmo3oy1fp elnvi;s)s2xrimpiydamte fvtatfaDrrxmp;o0aeeo o3tadla um(vs;t4alxrmr3iatfaD aiesls0 rtrio nydapee ncsat)s2um(rooo0aexnifcildfsDel(vsn(4aleoxrciatfp rau i t0teto(rpoy4lmt  iei ( aruax ooo0olxn feias m2rmuvpnt0trtrmfcoatoptelivi s s2xmxo oo1amt mfetasfsDraxm ;o1aex  i3tlt m2umuvo u)areoirctytlpD lnvo s t2uoxrpno1amte nvta(fa2umu oou1olt  fciadfm rlumsnu) rxrxo tatfmD  i sl(0trtmxopiydlm emfcsltfsrumumpoo4tetn o3ildlsDuluvo;u0tetrmo3iodfa eaueo;( trur(mpnu1lmtelicias aDum(r ;u0oexoioeiatfsDea(mp;t4tlerif iotoptranvs (  etmimpno1amenlictl(f Dur(  nu0apxnmictasla el(vp t0areoxr oadom eai s;s  rumxm nu4opte fes tf 2uaxrpou1opto o3iytfmDea( o t0 reoio3oa1oa rlnvslt0t2ur(m nodlp  mfcta()aDur(m ;o4texo ictls m2ranmsnu)alxrxoctydfmt  ivo;( s2urim3no4op emnvs tf rraxm oo4oet iiciat m2raumo;(0 ltrxocty1fatrai ils0 etrim3io1am   fct t) Drm(ronu0alt  oeilslm rmn s t0 exnmrciadfmtraieolt s2ur(m ny1ap elnvil()srrr(rp;o4oexnifeilsla ra(mp;u) reoxf3oatfpDrlies;s0s2urxo3iu1llen fet sfa2ta( o;o1tlto ieias mDul(ms t0arermf totlaDr n s;() rxoir iodam n nes s  2ua(  ou4tlxnifeiaslm elnvs (4tltomrcio1fa rai s;t0srxr(r iudlm elneiat srua( pou4aexomfeiatfaDua(msnt4 ltoxfcio1laDrlueils)srurxrpny1alt lfviltfsrrmxrpoo1aeeo o3ildfs um(msnt4aleoio3iy1fm rlnei s)trtmiopny4oltnmnvt ()srur(  ;u0ope mfcils m2uau onu4tlxrxf iodomtr i sls) rurio3oo1optn nci t)a2umum oo4oetnmieiaslsDuaumo t0trtomociadlmtelivi;() exo(o3oy1lpenmivsat srrmump;o0tpxoio3iasfm raump;(0aeenxociy1omD aieols0teuo(opnu4omtn netat) Dtrx  nu4opxomietadfmDrm(mp;u0tetomf iotlpt  nvsls t2toir3iu1ome lncsa(fsDrmurpnu1oet  fetlslmDua(vonu)artnir iotoaDraiesls0texm(rpio1open nesl()a2uaxm oo4aexoif3tyd a2em( o u) rermf oodopD ln i s  ruoxmpiu4om  livi tfartrxm nt0ole mfciltlm2ulums;()areoxrciotoatrlneo;s)texr(opoy4ol n netls)a2taur ;t0olxomfciytfa2ulums u4alenxr3oytlpDeluvs (0trtoxmpoodoptemieia( a2uaxr no1tex  ociad m2uluvs (0aexnir oodlp elieo s trur(opny1omtn ivias)sDtaurpno1tlx moetldfsDuan snt)alenxrctotlptranvs;(0t2uo(opiodlpe lfcil( s2ua(  nu0ape  f3iadlsDrlumon(4 exnmf iotfateluei;(0t2toxr3iudom nmnesa()a2ra(mpot1altomociyslm2rl(mpn(4 leoifciadfpt luvi ( s2toxm oo4al   fctas  2ra(mpnt1aptnmo3tad m emuvs;t4tlxrifciy1omDraiesls)s2tr(m iu1op nmfei (fa2tm(mpou1tetn i3iyslm elump t)trxrmo3iy1fmDelnvi (  rxrir3oy1lpee nviat srtmurpno4aptn oeildlsDrmnvs;()alenxo3tydfp e i i;()t2tmxm3iu1om e nvtatf 2rm(ro;u0tltnii3tysfm umnmp u)tlxrxrciotfmte neol( t2umiopno4ope  ivtls)s2tr(mp;t0apxomfciatfm2emuvo;(0tlxoxo iytfatrlivsl( truo(o iodapt  icias srrm(mp;t0opto fctltlm2rlnvo u4 rtomf iotomD aieslt0srxoxm3no4lmt lictl(farrmu p;t4tlx mieiytlmDrmuvp;()alerxocto1fa elivils)srxr(rpoodam elivsltfsDtm(  ou1tpe  o3tlt a2rl( pn(4 lxnmrcoo1fa e i s;()srtmim nodop n neils  rrm(mp;u0ape  ociat aDrau o t0 etomf iadop r i i ( tetm(mpiodlpee ietl()sDtr( pot1tlxoifeildfaDeauvon(4trermrcta1fp ranvi;() rtoxopoy1openmfeslt) rua(  oo4oexnmi3ild sDea(mo;u4alxrmf oatoaDrlivs s t2tr(m3iodal  lfvtlt)a2rau pot1tet mietyt m2el(vs u0areoxrcoytom e uei s) 2xoxo iydoltn fctltf rtrxrpnt4tltnio3tltfsDean on() leoiocoydoa  ai olt)t2xrxr3iy4ale  feils)s2ururo;o4oeeomfctat m ulump;(4tlenxf to1lptrli o s0srtoir3ny4op emncta() 2rm(mont0opxoioctyd sDem( p t4 renmf3tadopte u ol(  rxr(mpiy1apt mics t  Drrurooo0apxnmo3iat mDrmnmp t)aeenxrcta1omDeaies;s0srtoiopiy1al elfvil() 2trxr ou0alxomi3tad s elu p t) ltrif totlaD ai slt0 2uoxo nu4oltn nvsls)s2uau  ou0alx ifeiydfs2ua(vs (4 etomr tadfpDr nvsl(0teuo(mpou4ame  fcs t)sDur( o;t0opt  ieiasfs2ua( o;(4aexoir iytlatrlies;t)srxoim3ou4lptemfesa( sDrm(m ;o4ole ii3tltls ran snt4tetnxo ootfm  li i;( s2trxrpny4om  mfvi t)arta(moou4tptnmociadlm rlu ont0 ltrmociytfm raies (0 exoio3ny4lpee ncsa( a2tmx  oo4tleoii3iadlm ran p t4 lxnio oadoptr nvs s  rum(mpoydamt lnvsa() rtru o;o1ale iictydlm emn pnt)areoio oodoatraneo t) etm(r oudam nlictlsfsrur(roou0ale ifciydfa2ea( ont) rtoxf iodla elu o (  euoxo3iudlm elfvsas) 2raxrooo0oex  ieiytfs2em(vp (0artrirciydoptr nvils) eum(rpny4olt miet sfsDtm(rpnt1optnifeilsls2em( pn() rxnio3tydopt  uvs t0t2um(m3ny4al  mivs sfs2umur ;u1aet mieiatfm ulnvp;u0tltnxf3oodlm elnes s0 2xm(o no1oltn fetl(fs2rm(moou0tptnmi3ildfa2eluvp u4 renxr3todlate ueo;()truo(m3iy1altemicsls)srrmxmpnu1oleomfeiys s2rln o (0texoxr3oy1la e ues;s0 2tmir ny4opeemfvil(fa2urx pnu1olxomietld s ul( snu4 exnif tatfmt  nei t)s2xoxr3oydam   nvs s)srur( ont0apxniietls a rmn s;() ltrxo3iy1omt lieslt srxm(o3oodam  mnci ()a2taxro;u4apx mfeiatfs2uanmo;t)texnmr iotom eauvs;t) rtrxr3nu4ale lnesasfsDtm(rp;t1opxoifeils mDeln s u) exrmocto1om r ivolt  rxm(r3nydlmeelfct sf Dumu p;o4alt mfetat a2rm(vp t)tlerir oydomDelies;t t2trir iudal nlnetlt arum(rooo0tlxnioctlslm2ea(mo;t0tetrmf3oodfptr ivs s texrirpiodol emncs t sDrrxm nu1opt mictatlaDra(mo u4aeermo iatfmteaueo;t t2urim3oodam  lncs t  2umur nt0tlxo o3ils s2umumpnt0alxoxf iotlatr u i t0 etriopou1opte icias) rtmxmp;t1oleoifeiytfs2rl(vont4altoifctydop elues s texrxm no1ap  lfcil(f Drax p;u0opt ii3tytfa rlnvonu) exnxo3oadom rlues;() 2urxrpoodapenlnesls sDtrx o;t4aeenio3tadfm2uln s u4 etnif3tydlaDeliei;s)s2toxr3ou1oltemfvils s2uax o;u4oetoii3ildla umump;u)alxniocto1laDeln s;(  rxoio3iydomeemnvt t) Dtm(m ;t0alt mfeilsfa2eluvp;(0tlxoio3oo1op   ueilt)seurir oy1openlfciatf rtrxrpnu4aet iociadfa2eln p (0teeoxrciytop  luvs (  eumxo3iy1olenmnvtlsfsDrau p;t0tlenio3tytlaDrlumon(4arenmocta1fp r u ol(0seumirpou1optemnvslt)arum(r no4tetnmo3iasfa em(vp;(0 etnxo oytom r uvs (0 rtmxm ou4alt lies ()artaurp;o0ale  feiydlmDumuvon(0altnmr3oodlmt lu ils) 2tr(rpio1lleemfcia(fs2rrxmpnt1tpto o3tldlaDumuvpn(4tetnmf3ta1oa eluesl( t2xoimpiy4op   fvt t)s2trxmp;o1apenmieilslm ra(mo u0 lenio3iydopte ivi (0s2um(rpnudaleelivilsfartaur ou0aeeo f3iyslm rl( snu4 rermr oa1fatelivi;s)trtoxrpiu1am   ivslt)a2rau  nu0aexomfetys m ua(vs t) etomo oodfp rlivs s0srtmxopno4aleemnei tfaDuaur ou0tlx iictlsfa2eluvsn(0 exnxo ta1op elueo;()srtmim3ou4omtnlneils) ruru poo4apxoio3iydfsDrlnvo t4 lxoio3iydlaD  ivi;s0srtrxr oy4ol   nvtls arurxmono1ope mfctydfaDum(vo t0alxoio3oydfpDraivi;s s2umxo nydlpe mivs ( a2ra(root1openii3iytls rlnmp t)artrxrcta1fpt lieo s)texmxo ou1olee ncs t) 2uru  no1tet ifetltlmDulnvo t)aetrxr3iadopDe i i;()teuoir3oo1lp nlneslt srtrx  nt0apx  f3ilsfs rlnmp;(4 lenmr oatoateanvs;t0t2tm(o iy4ll eliesat)artm( ont4opxomieiatfa2uan pn(4tetnxo3ia1lmtelneo;s)tetmxmpoydlp nmnvtatfsrtmum nt1texoioeiadlaDelnmsn(0 ltrxo io1lmtelues;t  2umim no1amte netls)aDtmumont0olt  octydfmDrmnvp u4trtriocootlmD aivs;(0s2uoir iy1amenmieiltfsDtr( oou1apt  i3ilsfm2emnmonu)trxnio ty1fatrai i;s  rurxmpio1amt mfeiatf rtr(  ;t0tle  oeiytls2ranmsnt)teerir3tatomD ai s;t0setrim iudameelfvs s s2rmum ;u0aeto f3ild aDeln s;u) eeomf ta1fa rauvi s) etr(r3oo1aptnmnci t arra(r ot4apeomi3tys a uauvon()tlxoxfcoo1oat  ivo ( trurio iy1lle miesa(faDtmumpnu1aex  fctat m2um(vp t4trenirctatfmtrluvi;t0 eto(r iu1lme mnei s a2rrxm ot4tptomi3ilsfm2rln s;u0 rtriocio1latelnvils  rxrxopoydal n ivt (fa2trumpno1aetomfeiatlmDrl(vs;t) eenmo iatom  au olt srtmxr ny4ll elivs s  2tmxrono0aexo o3ildfaDea( o;(0tlxrif oo1fa   u ols s2to(opiu4alee fciatfsrrmu o;t4apxnmoeild s2em( p;(4 reomrctodfmDraues t  2to(rpou1ll e net t aruax pnu1aeen fetas m2ean s;()aetoxr3ootlp r neo;t0seuo(r ou1lp n fei tfa2urxmono0opt mi3iatfsDeanmp t0alxrxrciydlateluvi t s2toio oydlme mictat  Drmx o;u0oleo fetyt mDemnvsn() rtnmfcootoa elivols0sexoxm3iudol  mivs s  Dumu pot1apto icilslmDelumo t0arxoxr oydla  au s;s0s2xrxm oodole mfesa(fsDtr(r no4tltnio3tyt mDemu o;t0texnir3oa1oat ln o t0t2to(m iydoleemfcsls  Drru poo0apx mo3tlt aDuanmon(4tlxomf ta1oat  i ilt0t2umxm io4openmicslsfarua(rpnu0oltomicils aDuau pn(4 reriociodlmDrauvs;(0 2xmxm3iu1alenmfeia() rrrxroot4aptniictytla2ra( p (4tlenxo3todfpDranvs () 2xo(r oudllen fet ( srtmxmoot1ole iietydlmDelnvo;u0trxoiocootla  aueil()truriopiydll   icsltfa2taxrooo1oet  oetlsls eanvo u0 ltnirciatopte nei;s0srxm(rpoydlp nlnvsls  Dtmum ;t0texoiiciadlaDrmnvsnt4trxoxf oadopt ai i;()t2urxm3oy4omtemnvi ( srtmx o;u4alxo ieilt sDua(mo t)aetnmo3ty1om   uesls)t2trxm3oudlptn ietasfaDrrurpou0tee if3iasla umu pn(4arxnmrciy1la  aieo (0srtmxrpoy4amtnmiei tfaDrmu pno0oee mo3tys s umumo u4trermr ootlpDraieo (  etmio nu4omtemnvtl(  rtr(rpnt4ole io3tat mDra(vs (0 rerxo3io1fatrln i t  etrir3no4ll n nvslsfaDrmum nu0oexniietatfsDulu o u0aeermo tatop   nvo;( sruoirpiu4altn ict (  2ua(m ot1olenmieiasfa2ul(mont) ltnmfctydfm  ai o ( s2toiopoy1omenlfctlt)s2rau p;o4altoio3iytlaDuauvo;()areoircoodoatraivsl()tetmir3nu4altnlnvtltfsDum(  ou4tleo feias a2elumon(4 lxomf iadlpDe ivo;t)srum(r3iudomtnmivt t)aDuaurp;u1apxnioetadls raums u0texrircty1om ranvsls  2xmxo3iy4lpeemneil( sDtm(  oo4optn fcildls2rlnvp;t0 eeoio oy1lmDe nvilt0s2xrxm oo4altnmfcils)srtaur ;t0oexoif3ias mDrmnvo;u4 etoir iy1laDraneo t)s2ur(m oy4lme mfvi () Dta(  nu4tlt  fctltfaDelu o t0tetoif ootoat  ueslt tetm(o3nodapen ncil(f rraxrpno4apt  fciat sDrauvs;u4altnmo iydfpDr ies (0t2xo(o ny4ol  lnvs (f 2rrumont1aet if3tldlaDrmnvpnt) rxnircoodlpDr nvo;( srtrxopio4ll   nctlt sDrm(mo;t0tpto ociyd m2eln s;t)tlxrircty1lptrai o;t)teurxr3oydlmt lfci sf 2rrxmpoo1aee mfeiadlm um( p t4aetrmf iotfa  aieil(0trxrxm3no1llte fesls a2rrxront0oeeomoeiysfa2ul(von(4 rxrif oo1lp rai i (0s2toir3oy1lpt  fvs tfs2raxr oo4oex ifeiltla2ea( snt4tlerxocoadomD an o;( t2toim3ou1lp  lfcils)s2raxmo;u0aee mociydfa rmuvo;u0tetnio oydoatrlieo ( texm(rpio4apt mnetat  rrr( oot1aee micildfm rmumont0 lxomr3ty1om r i s () eumir3oy4op nliviasf ruau  no0oexoiociltfm2rm(vs (4trxnxr3iotfmt lnesl()t2xrxm3ou1ll elfei (faDumu  nt1tpenifctas a2umums;u4trtnmocty1oaDe nvs t t2um(o iydop emnetls  2trxmo;o1oexnioeildfm2ua( p u)alxnxf3totlaDr i s;t) 2urirpnu4apee nes ( aDrmump;u1tptn o3iasls umnvp;(4altrxo3todfmD ln i;()s2tr(m ou4al  mfcslt)a2tr(rono0oeenifeiaslm2emnmsn(0 renxf oy1lmDrauei s0 etm(r nu1lpt  fetls aDrrumono1texn i3ils m2uluvont)aleoxf3oadlat aieols0t2umir3no1open icsls)sDtmx  no0apxnioetytfa elump;u4tleoxfcoo1optr uvi t texm(m3io1ale  nvil(fa2ua(mpnt4tle  fetasfsDrlumsn(0trtoxf iotoateauvo s  eumir3ou1llt  feslsfsDtr(m ot1olen ietatfs2rluvs (0tlerir ia1fptraies;t0trum(r nydllee ietat  2uaumpno1oleoiictadfm2umn pn(0 ltrmr3tytlmDrli s;t s2xoxo iudap nmneias)srrr(mont4aet ioeildlaDrmuvo (4texrxo3iydfpD lnvs;s) 2tmxr oydam e nvsl()s2rax pnt0aexnii3tltlm2ra(mo t) rxnxf3iotfmDrlu ils0 2to(m3no1al e nvs t sDtmxrpoo0ope  fetls sDrlnvs;t0 eerxf iodlpt  neils texm(r oodllte fvtltf Dtmxmp;u0olt ifeiys a ulnmo t)tlxnmf oatopDeli slt  exrxm iy4al   iviat) Drm(m ;o1tet  fetatfsDrlnvs;(0alxrmo iadlpDrauvs (0t2tmir ou1altn ivslt  2rmxmoou4tlxn ietydlm em( p;t4 exoxr3oydoaDelnvs;s0t2xmxr iy4olee nctatf rtm(moot0teeomicild a2ulu p u0 rxrir iatlat  uei;t)srxm(opnodolee fvi tf Dtmx pno4opxo i3tytls umnms;(0arxnxr3io1lp  livol() 2xrxr ny1aleelnetat  Durxr nt1tlt mfctldlm ulnms;t0 lerxr3oa1lmt ai slt0 2uoimpoudll  mivsa() Dtmxr ou1texomiciltls umnmo;t4 lxrmf3iytfatelnes ()teumxmpoydlptemnet (fsDurxrp;t1aptnmoetatfaDrlumo;t) ltnmfcoatlp rlu o;(  exrxr ou1lptnlictl( artauronu1apeomoctadfm uln p;(4tlenio3tadlp  aueslt)s2umim iodlmenmfvtlt) Dtmu onu4olx ii3iys m ra( snt)tltomr ootfpDraieo s s2um(o3iu1opeelfvi tfsDrmx  ou1oexoiieils s2rmu s;t0arxrio oo1laDr u slt trxr(r io4lptelicsls  Durxr oo4tpxo ietad s2umnvp;u4aeerif iytom  lueils sexoim3iu4lpt  feilsfaDrru  ot1tpe mieils sDuau p u4arxrmo oytfmDr n o t  2um(r3io1lpeelneiat)a2ra( onu1open ictatlsDeau o;u0aetrxo totlaD lneo;()sexo(r3nu4lp emfeslt)srtrur ou0oee mf3ild m2rl( p;u)tleriocootoaDelueo s0 exm(mpiu1amtemivtls)srum(r ;u0teenmfctydla2eaums;u)tetnmrcoo1la elnvi s0sexo(m nydome mnvs ( sDra(mo;u0ole mocias mDemn pnt4 rxnir3oatlmDeaneo;(0 exrir3ny1omt lfcsl()sDumumono0opxoifeild m2emu o;u4aeenio oadopDrlu s t texr(m oudalen ieilsfsDrr(m oo0ape  ociadla2elump u4tltrif3totlptrli i (0sexo(r oy1op emict ( sDtaxmpnt4aeenif3iysla2raums;(0 exomoctodoa eanvs;t0s2um(m ou1lpeemivilsfsDtmu poo0openio3tld a2rlu p;()trxrif iy1op  anvo;t s2uoxo3iy4lm  mfeslt) Drr( p;o4tpenioctasfmDemnvpn()texrmo3oadop e i ils trxr(rpnu4om  lnci t)a2raumo;u0ape iietlt mDuanms;()trtrxrciatla e iei;t srtrxo3no4lpt micils s2ta(rpnu1oltnmietat a rm(vs;u) eenxrcty1la elnei s0trtoirpiu1aptn ivtls) Drrumo;o1olxoiicildfmDraums;u4trxnircto1om  auvi;s0 2xoxrpiodamen fcsa( a2urxrooo1alen ieildlmDra( ont4aexrxf3oydfp r n s;( sexrir3iy4ale livi s)aDtrxm nt1teeomfciat a2ulnmpnu)areomr3oy1oaD lues t0srtoir3iodol   iei t) 2ua( poo1olt miciysls eluvo;(0alxrxf3iy1fmt aies;s  rum(r3oodlp  lnviasf rtau  nt4tpxo f3tld m2elumonu0teenxr3oo1lm elu i;t0t2xmxo nudolt mivsasf 2ururono4alto ieilt a ul(vp () rtnxrciatomt ln il()truoxr iydal  mnctlt)arrmxmpno4aeeniocias m rlnmpn()aexnxr iotfatrau i t setmxr nodol  licsa(  Drmxr oo1apt moeiat m2rluvs (4 eerxo3iotfpte iei;s) etmxm io4apeeliei s sDumur ou0opt if3iltla2eanmp;t) renxf3todfp eanvs;(0 2xmio oy1olt mncsa( sDtm( pno4aptn octyt a2rlnvp u4alenio oa1op rlnei;s s2xmxrpoo1lptnlictas aDrr(r ;u1oeeomoeilsfsDrlumpn(4 lenxf3iadfpt luvi (0 rtm(m oudop nmnci t sDraumpoo4tlxoiieiyd a2rmn p;()arxnircoydlpt  ueo;t t2trxm ou1lme  fviat a2rrxrono0tpxn o3iaslm2eanms;(0trtrxfcoo1la r uvi (  exoim3iu4amen ncias  2tmum ou1oex  ociytlaDrmnmpnu0arxoifcoodfmtr ies;t t2urirpio1om  mfvs s srumurpou0apx  iciys mDrluvonu)tetnir3tatfpt  nvo;t0t2trio3io1aptnlivs sfsrrax o;u4tee mieiasfsDeanvp;(4 renxf iadla  lues () rxo(mpnodamtn ics s) rtaurpnu1apx micild s rmu s;t4arxnif tytfm rlieolt)seum(m nodlpenlnct (farta(rpno0apeoio3tltls umumpnt4trtnmr tytoa eliei t0 rxoio oo4lleelivtlt)sDtmumpnu0apenif3tadlmDemuvs;u) rtrxo3iadfpD  i o;s trurxr3oudape  ics s a2urx pot4olt ifetydlm eaumsnt4 rerxr3iadla eaiesl( teuoxo no4ap  mici tf 2tr(rp;t0opto oeiyslsDum(vp;(4aetomo3oytopDe nvs;()srtm(o3no4lpe lfetltfs2uax  nu4openio3tyslm elnvo;u) lxoifctydfp  aivo;s0 exr(o3io4lmeelietasfsDrrxrpnu4alxomoctlt aDeanmpn(4trxrxf oytom rau s;t trxmimpnudol  lfes t)srumumoot0tetn iciytla rlnvp t0tetnir iy1fp r i i t0 euoirpnydllenlfci t  rua(m ;o0apx mociadfaDuaumsn(0tetnioctytfat  n s t0 etrxrpoudoleemnctls  Drax  ;u4tptoioeiadfsDeanmpn(0artnifcoytlpt li o;t0s2xmiopou4ape lieiat a2rm(rpou0opxn o3tldlmDrmumo;(0 eenir3oodla ranvol( setrim oudlp  lncsltfarrau onu4altomfciytfm2elnvsnt) rxnio ta1fpt  u o s0srur(rpnu1ape lieiatf rtrurp;o0tpxniicilsfmDrauvo u) rermf3to1opD luvs s)srumxrpoo1om   nvslt  rtm(ront4olxnmf3iatls2ul(vpn(4alxrmfctadop  ai o s0srxr(o iydom   iei s)a2umx p;t0ope mf3tadfs2ra(vo;u0 ltrircoodlpt  neols  rxo(opiu1al elncia()aDtmxr nt0olxomi3iydfm ea(mp;t0 rtrif3iodopDraiei t)tetmio oy4al e nct s)aDrru o;o0tex  fciytlm umuvsnu4tlxnmf iotomDeau olt s2tmio oodol   fvtls  rraurono1teeomiciyt s umuvo;(0 rxnif iotfatr n s;t0srurim3nydop e neil(f 2rr(r ;o4oee mf3iadla ra( s (0areoxf iadlmteai ol()seuoxr3iy1om n neil() rtrump;u1tpxn oeilsfm eauvsnt)aetoirctotlp   uesl(0t2xr(o nodap nmivs s  2urxrpot1oee ii3tltfm2uanvo t0alenio3oytop r uvo s t2xrio oy1apt lnvtas)arta(m ;u4opt  i3ilsfs2rlu s;t)trtnmrcto1laD an olt) rtmxr3iu4olee nct (faDumu  no1tltoif3tad m rm(mpn()trxnxr3ty1la ean sl( s2tr(opio4am   fei s)a2rrxrpnt4tpxoiicilsfs emn o;t0artomfciotfmDeluvilt)truoirpiy1ape mfeias) Dumum nt4tpto fctatfs um( snt)alermf iotoatr nesl()trtmxo3iy1ale mici (f Dtmxroou4tetomicildfm2umump;()teeoxrcto1fpt aueo t0texrir3io1amenmncils)a2uaurpot0tlt mfetasfm2rmu p;u0aexoif iy1om  aues t srtmir3iy4ll n ncsas sDua(r ou4aetnii3ias aDelnvo;(4texrxociytfaDeliei t t2xmxm oy1lpe mivi t) rurxm ;u1apx  ieiatlm ran o t4trermr3iy1omtrlueo (0s2urxm3oydom n fetat) 2rr(r no0apx mietad s emuvs;u0tlxnxfcoadlaD anvs s)t2xm(opno1llenmfvils) Drax pou1tet iociydla uanmsnu0 eeoioctodomDrlu sl( tetrio oydlpenlfvsasf 2tr(mpnt4altomietlt a2rmu sn(4arxrxo3oatlp raivil(  2uoim iu1lpeelfeia( srurx  nt4alto ieiaslm2rm(von(4 rerxfcoa1opD lnvi t)trxmir3iodoltemieia(f rrru pou4tet  f3ildlm2elump ()aetnif iatlm rlnei s srtrimpio4lpe  nctas)srrmx oot0apeo oetltfm eln ont4trtriocoadlm  anvi;t) 2xmxmpiu4apenlnvtasf 2uaurpot0tpx  iciysfa elnmo;u0tetoxr3tatomtelivo ( teuoxr iy1om e ici ( srra(m no4apto fciadlaDelu pnu)texomfctydfmDranvolt truo(r3iudaptnlfct tf Dtr(r no4tet iieilsfs ean p t)teerxf oodlp eai o;s  rxoiopnudom n ivils)aDta( ont1tlenii3iytl
\ No newline at end of file
@@ -0,0 +1 @@
+i sls) ruo(m3oy4apeemneils)aDtmx  ot4apeoioeildfm2raumo;t) reoxr3ia1oaDeliei (  rxrio3io1lmte nvsl()sDrm( o;u4ape mieiasla rm(vsn(0tlenmr3iatlpD lieo (0trxr(mpnudom  lfvsa(fsrtrxmpot0apxn f3iad m uan p t)artnxr oydfpDr nvs;s0 2tmir iy1lpt  fcta( a2raxront0ape if3ilsfaDrmnms () exnxr3oadfmDrlnei t)seum(o iu1ole mivsa( aDtmum ;u4oeeomfetat a rlnmp;u0tlenxo3io1faDraiei s srurxr oy1om nlnvias srurxronu0optn fctys m2rmuvonu4arxnmo io1lpDr u ilt0t2urxm3oo4amtemncia(f 2rm( pot4tleo ieias m ul( p ()tetnxfciodoaD  uvo;s texr(r ny4ol   fviasf 2ururp;t0apeomiciltls2ra( o;u0arerir3ty1fpDelueols seumirpny4aptemieia(  Dtrumont4optomf3iysls2um( p (4aexrxf todfaDr i il(  exoimpou1lpenmictlt)s2um(r ;u0opx mfciydfs emn s u4tltrmr3io1lptran o;t)s2xoir oydap nlivtat)s2raur ;u0aeenmi3iltlsDum(mo t0texoxo todlaDranes;( trtr(opoydal elfcia( srumx o;o4tetoiictydla eln o ()aeeomr oo1la elnei () 2xmir nu4om  lfvi tf rumx o;o4tptomo3iysls rlu on(0 ltrxf tadlp e n s;s trxrxopiy4oltn ictas srta(  ot1oexomf3ildlm2el(msnt0artomr3io1fptelnei (0srurxr oy1alee feslt  rtmxmpoo0tpto feiasla uanms (0tlermociotop ran s;(0texoxmpoudoptelneils s2rru  oo0apxo fcilt sDem( o t0 exniocoadlpDrlivo;s)srtmxm oy4omtemnvilsf rtaxrpnt0tpxomi3ias mDulump t)aleoio ia1opt  u ol()trxrxm nydap  lnctat aDum(mpoo4teeniociatla rln on() rtrxf3to1omDelivi;s0 rtmxr3nu4ameemnvtasfaDrm(m ;u4tee  fetlsfs2emn sn(4artnxocoadfptelnei;t) rtmxr oudlm e ici (  ruau oot4tpxoiicils s elump;(4texrmo oodopt  nei ()teurxo3ou4am  lnesas aDtmx  ;t4aeto o3tlt s2ulu s (0 etomr3oatfmDeau s;t)teumxm nu1apt lici s a2rm(mo;o0ale  ociatfa2ranmo t) ltrxfcoydomDe ies;(0 2xm(m ny4omt mnvs t  rtax ono1tpxomf3iyslmDea(vp;u4trtnmf oodoateaneil( sexo(o iy4lltnlncia(  Dtau ono1tltnmf3tyt m2ua( s t0tetniociadlatr ues;s0trumir3iu4om nlfcta(  Dtm(  ;u1aeenmieiatlsDrmnmo () exnio ta1optrlivs;t0s2xm(opno1olt  ivi s a2tr(r ;t0oeto ociat a2rl( p;u)teenxfciotom  livi (0truoim iodlpt  feiat sDur(rpou1olt ioeild a2ran o;t4 rerifciatlpt  ueol()srxr(mpiu1ameemieil( sDraump;o0opxn fciyt aDrl(vp;()altrio oodfmD  uvo s  2ur(r3nudomee ici (  Dtrxrp;t4tlx mfetad aDrlnvo;u) etnxocto1op rlivs;s seuoio3iy4ol elfvt tfaDtmu o;u0oet ifetatfs eanms t4 rtrxo todlp elivsls0 2umxo3no1al n neil(fs2rr(mpoo4ole  o3iadlsDrl( p t)aeenxfcoatfpDrlueol()srto(m oydlme mnetltf rurxroou4alenmi3tlt m2rmu p u4 etrxr io1fp  aivs t trxo(r oy1aptn neia( s2umxmono1oeeomicilsla ua( p u) lenio3todlaDrlnvil() ruoxmpoy1alt lnctlt)s2ra(ro;o0oeeo i3tys sDelnvs (0 lxrxo oy1oatelnvo;s0 rxoxopnodoptelfvtatfsrtmu pno4apx ioetaslsDua(vp;t4texoxo3ia1fa r ivs;s  rxoir3iudome  ictasfs2um( poo4tpeoiieiatfa rlumsnt)aexnir oa1oatranes;s)t2toxm oudll  mfvs ( aDrr(r no1oexomociytla emums t0aexnxo3iotfmt  iei;t  ruriopny4ap nlnvi t) 2rrxm ou4apenioeilsls2eln o;t4tltomfciydfm   ieo;() rxrirpoodoleemfvtas arraxrpnu0tlt  ieiyt m emu pnt0trxnmf3totfmte u ol( t2xm(m3iu4lpee fcs sfaDumum ou1oexnmfctysfa el(vs (4aexnioctotoptr uvsl()setoir oo1omtelict (fa2raxr ;u1aex mieiatfs ulnvsnt) ltoir ootlat anei t  exm(opiy4op emnct s)srrax pnt0teto ieiyt m2eluvp;u4tetnif ty1lpt lneilt0s2xm(m iy4al elnvtl(  Dtmx  no1alxo i3tatlm ean o;(0 reomrctodfa  aues s) 2xmir3oy1altnlfctl() Dtm( onu4ole io3ild a2ul(mp;(0arxnmf io1laDrln o (  rxoio oy1am   ieilt)artmum ;o1opt mi3tadls2uanmp;u0texnmf3iadopte u s;( t2urimpny1lpeelics sfs2ur(mono0tetnifciasla2rlnvo;(4tetomf3oydoaDraneo t t2xoxopnu4opeemnetas sDumxm ot1ape mietad aDeauvsnt0teerir oodfpt lu ol() 2tm(r iy4lltnmiesatfsDrrurp;t0tee  oetldfa2elu s (4arenxociadfp ranvi t)seur(opny4am n nvtatfsrum(rp;t0olxn f3iltls2uluvs;(0trenxo3oytoaDeli i;( sexmirpoydlp nmnei (  Dumu  ot1aeeoifeiydfs2eauvs;t) renmf ootoaDelnvsls  rxm(mpiu4alt mivtls) 2tmxrpou1aexoif3ils s umu o;t0 rtoirctydfpDraneo t)trxrimpiy1llt licsasf 2umurpot1aex  iciadlsDul(vpnt4trxrmf3oo1fp  au s;(0 rumimpoo4lle lfcslsfarum( p;o0alxn oeiytla emuvs;u4 rxnio3ta1la elueo s) rxm(o3iydoptnmieiat) Drr(ro;t4aet  o3iytlm2eauvs u) exnxf3ty1fmDraivslt0setrxo3no1oltelics s a2tr( pnt0apxo fetas aDranms ()tetnmo3ia1omDelneolt)srum(o ou1lm  lfcs t  2urxro;o4apeoioeilsls2rl(mo;u)teerio3oydomtrli o;t0s2uoxr nudop nmfvs ()a2ua(  ou4apenmfciysfa em( snu0 lxoio3iy1opD  ivols trxoio nu1ame livta() rrmxmooo1aeto f3tlt s um(vo;t)altrmr oodoptr uei t0setmxo nydlltn ncsltfaDuaxr ;o1aexn fciad m2elnvpnu)arermf tydomDr uei;( tetrxo3nydaptn ies t)sDrrumpou0aeenifciasfs2ua( s () lxnxocoytfaDean s;t)s2tm(r oudapen ncsl()s2umxrpoo0ole ifctat s ranms;u4aexoxocoy1lp   ieilt srtm(m3oo1lm nlnes ( sDumx ont4ope iicias mDuan s;t4 eermr3io1omD aieilt)s2xrxo oo4omenlfct s) rurxm nt4tlxniicildfa rlu snu0 rtoxf ty1op eau sls  exoirpnu4op  mivs t  2rmurpou4tltomfciasfs ua(mo u) exoxocoo1lp rau sls sexo(mpou1aptn fvsas  Drrump;u0teeniictysls2uluvp ()aeeoxrciotlmt lu ol(0sruo(m3ou1lpen fvtl() ruax poo4aeenmieiyt m2uan snt4 ltrxo iydla  lieolt0seumxr nu1lm  livtlt  rum(m ;u4apxo fciyslsDum(mp;()teerir3oatlmDe ivslt0 etmxr oodome mncs t)srrrxrpno0apenmf3tldfsDea(msnt0teenxr3iadfa  lnvs t  rtrimpoodlpenlnvsatfa2rr(m nu0opx mocilsfa ran p;()altnmo3ta1fpD an i s0t2umxm oudopt lnesa(fa2urx p;t4texoiietltfs rmumo u0alenmr3oo1fpDeaieilt0setr(r ou4opte nvslt)sDurx  ;u4openifciysfa2elums (0arenmo oydlpt  ieolt)texoxm3iy4ll  miciltf rrrxr ;o1aleo octatlm2umnmsn(4 eerirciy1op eaues s0 2xoimpio4am emici sfsrrmx  ;u4aptomf3tasfm ulums u4altnxo3oadop ranvo s0trtr(r3ny1ll  miciatfarrm(mp;t0texo o3iyt m2emums t4 leoif tadlp raneol(0 2umirpiudap   feslsfsrtaumooo0oltomfetys a umn pnt0 eenir iydlaDrlu s s  exoim3no4omt lfesatfsrrmuront4olt mfeiyslaDeln on(0 leoxf iatlpDraivi;t0s2toxopoy1alt lfcils aruaxm ot4tet ifetltfaDran p u0tetoxr iotoaDr ivslt trtrim3nu4lpeelieslt)arur( oot1teeo i3tlsfm eanvs u0alxomr3tytfaD luvo;(  2toxo3iu4apt  fci ( s2rmxmpot0teto iciyt a2rauvs;t0 rxoxo ia1optr neilt  2xr(r3no1ome lietat sDua(mpou1ole mi3tatlaDrm( o t4aetrxocoodoate u il() 2xr(o oy4ame mietl( sDrm(roou4olto icias s2rauvsnu4trtrif iadomDeaivi t t2trxo3iy1openlivs s a2raxmo;o0ape  icias mDrln s u4tlxoircoo1fmD an o (0setrxmpio4ol  lfcs tfarumumpou0olxnioeild sDrmnvpnu)alxnxo3ty1omt lieo () eur(m3oy1ome  nvilt  rrrxmonu4teto o3ildla2emnvs;t0 eenif ia1fat livolt0sexoxr oo4om nlfesa( sDtaxmpno1tpxnifcils s emu s;t)texoxocoa1lpD lu ils)srtm(o3oy4ope  nciasf 2umxmpoo0alxn feiatfs2uan s;(0arenxf3totfmt anvilt0s2toxopny4amtn fvsa()srtaumpno4aexnioeias sDemnmsnt4trerir3iydlptrliei ()s2xrio iudlmenmfvt s  2ra(  oo0oex iociatlmDulu sn() rerxr iadoa e uvi;t0sruoirpio1olt lnet (fsrra(rpnt1alx  oetldfmDumu o (4 rtomo tydoptelnesl(  2urxr3nudll  lfei () 2umx  ou0aeto i3ils sDranmo;t)texoio tydfp eauvsls) etoio3io1optn ncs s srrru pou4tlxomieildfs2rmums u4tlenxf3ta1fa ranvils trurxm3ny4ome mnvt ()a2umxr ;o0tlx  ictadfs2ran on(0aetoio3iotlaDr n sls0srxmirpiu1ol nlncsa(fsDta( pnt0aeen o3iysfsDrmn ont0trenmo3oodomt  ivs;t0trxoir ny1al emfeilsfsDurur ot4tltnii3ias aDul(mpn(0aexoioctytfat lu ils srtr(mpou1al e feil( a2tax pno4tptnmoeiasfm2em( snt4 rtomrciadoaDeauei (  exo(m3nu1apee nesa( sDta(mpoo4aetn oetyd a2ul(msnt)aexnmf ta1lpDelivils)srxmxo iudalt  neilsfs2rm(monu0tltomfeiysla2el( o u4tltrirciodfmDelneo;s0sexr(mpiydop nlnvsas  Dur(r ;u0olx ioeildlm2ean o;t0 exrxocty1fmD  i o;t0 2trio3iy4al  miviltfaDtmumono0apx mi3iltla2eluvsn()artomfctodomD an sls0s2trim3iy4olen ivt ()a2tr( onu0oeeniieildfa2rm(vs;t4arenxo3iydoa rau o s0 exoxo iy4lme mnct ()srum( oot1alxomfctysls eluvsnu)tltrmr tytlat lieo;s0sexmir3nu1lm n nctlt srrmxmonu1optnifcildlmDean snt0 ltoircoodom  aivslt  2xr(r iy1ap nmfvt t) 2rrxmo;o4texoiieilt m umnvsnu4 reriociy1lmtr uvols0 2tmim iu4altelivs ()arumuro;t4openmfeiltla2ua(mp;t0teeoxo3iatopDrlnvo;t)seuo(m3nodoleeliciltfsrtaumpoo1tex if3ils sDrm( p;(0tltomf3ta1lpteai s s)texrxm3iu1lp elfct () Dtax p;u0tex  oeiysfsDraump;t) lxoxf3iotlp r ueil(  rtoxr3oo4lm  mici sf Dta( o;u1tee mf3ild s2elu o (0aetomr3iatfptelueils trtmxo3oy4ape  fvi t  Dumxmoou1teeoif3ild a2rluvpn()teerxr3tatfaDrln sl( sruoirpnodope  fvtls) 2uru  oo1aetoif3ias sDem( o;t0texriocio1fmtrlu ol(0t2ur(r oo1ol e ieta(f rtru p;t0aeto iciatls2emuvo;()aexnio tytfaDran o;t0srtmir3ny4lpt lfei t a2taxmp;u4altomf3iltfmDranvsnu0tetomf iytfmt  ueo t) euoir iudol emfcs t)sDtaxmonu4tlx  fcildls2rln s;u)aexrir to1lp rlues;t) 2umio ny1lptnmfvta(f rrax p;o4tet mo3tltfm ea(vpnu)trxoir3tatlpt ai ol()t2xmxr3ou1amtn fet ()sDtmxmpou4aexoio3ils mDrm(mo;u)aetnxo oytlmDelneil(  2xmimpno4opee ivsasfa2trum ot1altnifciad a emn p;t4aexrmr3oytfptrlivilt) rxo(r3oudam emivtas arumxm no1olxoiieiltla eln s;()areoio3oodlpD  ueo;t0 rto(opoydlm nmnctas sDrr(rpou1tltoioetadls2uaumsnt4texrmrctotlatrauvo;s0t2xmimpoo4am n ivta(f Drrx  ou4olt mi3iatlaDemnmp;(0aexomf3io1lpDrlivilt0 rtrio3nudolt lictlt)srtm(m nu0aeenmfeiat a2emn s (4arenmf ootoatelu o s sexmirpiu4ap  lfcia()aDrmu pou4tptnifeiyt m2uanmonu4 rtoifciadop rlu o t t2uo(r3iu1apenlfetl( arrax pno1tpt ioeiltfs ul(vp;(4 eenmf3iotfpt  nvi ( s2xo(mpnydaleemieslt)sDrax  nu1olxnii3iytfsDumnmp t0alxomr tatfpteliei t) etrio3iy1op  mnet s a2rr( pnt1teto o3iytfsDea(mon(0 etnifctytlatr n olt0srur(m nu4alenlncils srrmxr no1ope  ociadfm2rmnvo t)treomrcto1fp eluvi ( srxr(m oodame mieias  Drmx oou1apto ietldfm2eanmo;t0 leoxr3totlptelnei;s  rxm(o3ny4optnmivtlt sDtmx pnu0tpt iiciysfsDrmu pn()aetrir3iydom  aieo;t texo(rpno4lpt mnvsl()srrmur nu0tpe iicildfm rmuvp u)tlerir oo1lmte n o;t t2xrxo iu1lptelnvtlt)s2trumonu1tleoioctasfaDelumo;t)artrircto1oate nvsls)seuoiopou4ape  netas) 2tr(  nt0tpenioetasfm raumo ()teeomo3iydfpDr nvo ()texmim iodalee ivs tf 2raxrp;o1oeeoioeiydfa2eln s (0 exomocta1lp   n s;t0 exmirpoo1apenliesls a2rax pot0aexomo3tatla eln o;u) lerio3tatlmtrau s;(  euoir oy1ll n ictatfarumumpou1oexomfctasls2emnmo;(4 rtoxr3io1fmte n il(0trtmxr ou1lpt mfctas  Dum(r no4ale mictydlm rl(vp t4aexrmrcoytfpD auvi s0 2uoim3no4llen ictls sDraxm ;t1alt ii3iltlm ul(msnu)areoifctytopDelivol(0 2xmxopno1lptemicilt) rraxmp;u4olxn oeiltlm2umnmp;()teermo to1om  lnvo ()s2uoxmpoydope mfvs tfsrtrur ou1tpto o3tld s2ra(vp;u)alxnif iy1op   ivi s0 rurxm3ny1apte ieta( srurur oo4tpen icils s ea(monu) lerioctytoptr uvo;( s2uriopoodom nmivil() rumxmoou0aeto octltfmDrmn sn()trerxf iydlpDr ivolt  etm(rpnu1aptnmfct sfa2um(mpnu1apxomieiasfm2ran ont)arxoirciadomt auvs;(0trxmxr oodoptnmies () rraum nt0aetoio3tldfa uaums u0 renmocoa1opD  i s;s0srtr(mpny1ape lnei ( s2rrxr oo0apxniiciad sDeluvo t4 eerio iatoat aieslt tetmxrpiydope mfes t) 2ur(rp;u0tltnmociysfsDua(ms;t)teerxr todfpt  nes t texr(opny1amt licta(faDtaumont1teeomfctldfa2uluvp;t4aeenircoydlaDelnei;s) etm(r io4lm  mfvi t  Drmxrp;u4ape  feildls2eluvsnu4 eermfcty1opDrluvs t0tetrxo no1apt livsa(  rtrxmoot4ape  fetlslsDemn p (0 rtrmoctotop rlueols trxrxm3nodomee iet tfs2um(m ;o0apxo ietys a2um(vs;()tlxoio tytoatrln o;s)srurxr3io1lpeemfetls) Drrx poo0aexoiociydfm2emn o;()artrxfctadfm r n s;t sexrxm3iodomt lfesat)a2ra(mo;o1aleomf3tlslmDrauvs;(4 ltrxo oadfmt  n sls) rxriopnudamenlictlsfsDrm(ront1tpxoii3ildfm2eln o u0aexnxr3ta1oat aiei;t)teum(rpou1olenmivsl()s2rau  ot4alt ioeiltfs rln p ()aexoiocty1oaDelueslt)s2to(o3no1lmeelnetat)a2rmxronu0tet  ictadfa ua(ms;t4 lxnir3ootom ranvolt0sexoxo iu1lltelieiltfa2ur(roou1olxoifetasfm ea(ms;u0 etrxf3oatfa r n s t0setoim3nudome mictas) Drr(roou1aexnio3ilslm2rl( p () ltnmf oytfmDr n o;(0s2uoio3iudap  lfvt s)a2tmxrp;u4aex mfciatfs2ulu p;t)aexnio3ootomtrlies;s) 2toirpoydome  iciatf 2rm(mooo1tltnmo3tltlm2rlums;() lxomf oytlpDeanei t)trtoim iy4altelfesltfsDrmxmp;t4open octys m2um(vs;u0treoxr to1fmD aiei;t)srxoio oydal nmneilt) Duaurpno0aexnioetatfs2ua(mp;u)altomf3iydla   uvsls srur(m oudopt lfes sfaDtr( p;o1tpxniieiys s2emums;(4tlxnmfctatom raivsls  rtoxmpiu4ape  nei (fsrur(r ;t4ole ifetatfs2ra( p ()tltrmf3oo1oaDe iesls0seum(o io4llt lnciatfa2ur(rpnt1apt mo3ilsfm2eau p;t0trtnxo3iadfpDelueo;t)srurir3ny1alt lfvi sfa2umx oou0tle mi3iatlaDeau pnu4alxniociydomDeai o;()t2urirpnu1ope mnctas) rra( ono4apto ociys m2ea(vp (4 rxnmr3oadom ean ols)s2xr(r iydlp nmneils  2um(rooo1tpt  octas s2ean o;t0tetrxr tytfpte iei;t0trtm(m3oydapeemfvsl()artaxr ;t1oeenmoetatfaDulnmp;t4aeerxoctatfm e nvo;(0srtoimpio4lpe  ici t artru p;o0opt  octytlaDrmn o (0 lerir3iadfmtrauvi;s0 exoio3oudameemfvs tf 2taxmooo1tpenifciat m eluvsnt4aetrio todomDeaivs;s)sexo(r3no1llen ivias)s2rm(rpou0apeomoeiytlm2umn o;t4areoirciydopDeaneils  eto(mpoo4ap   ivsat)arurx  ;o4tpxomf3ilt aDuln p;(4tltoif oa1fptr ivsls) ruoio iu1optnlfct t a2trxrpoo1olt ifetlt m2ul(mo u0tlxnxoctadlp   i i;s  2xm(r oy1lptelfci (fa2rrx pou4oex iictyt aDemn ont0teerxf oo1om eln s;s srxr(r oo4op e nvs (  ruau p;t0apeomoetasfa2uauvo t) exnif tytoaDrlu o;t) 2umxrpnodolee fvsa(faDuax p;t4olx  oeiys a2rlnvont0 ltomf3iy1late ies;t0trtoirpnodope  icsl() Dra(moot1tlt mo3iytfaDem( pnt4 rtoxoctadlate u s;()t2trim ny4op elneiasfsrra(mp;t1tlt  fetad a2ua( p;t4tlxnxo3iytlp e uei;t0t2toxr3no1optnlneilsf Dtmx  ;t4oexo fciys s em(vs;t4teenxo iodopDr neo;()srtoxopiydlmt lfet t  Draur oo1apx mf3tad a ul(ms;u4aexrmf3ta1oateaieo (0setmxopny4ll nlncias)arrax pou1tpenii3tydla2ua( onu) reomr3oytoa r nes (0srumirpiy1op   fei tf 2ur( ono1olenmoctas mDrmn s;u0tltnmf ia1oa rlu o;s0 2xmxo iy1amt lnctl(faDrrxmonu4ole  ociltfsDemnvsnt4 lenmr oydoateau s;(0 eurxrpoy4ol  lnes sfartru  ot0apt mietadls2ra(mo;t0trxnmr3oydlmteanvo s0srumim ny1om emfeslt  2tr( pou1aptn feilt m2ulnms;t4trxrifcoodfa e uei;s0sexmir3nydlltnmfcsa( srta( ono4aexniictatfa rln onu)altrxfctatlpt aneol( t2uoxmpiy1lmtn nvi s a2urx  no1tpxn fctatfs uan o u0aetnio todfpDrlnes;t srtmxm nu4ole lfvt (fsDuru oou1tetoif3tatls ua(vo t4 rtrirciotop rlneol()trto(m3io4lmtelieilsfartrxro;u4aex mo3tadfaDrm( snu)arxnircoy1om eanei;t teuoxo3iydllte icsl(f 2raxmono0aptoiociltls eanmsnu4tlenmr tadlate iei s) eum(mpoydame  fvsls a2rr(  nt0aptnio3tltfm2el(msnu)arerir3ta1fp rlnvo ()sexmirpiy1ape mfvsltfa2rru  nt1tlt  fctls mDelnmonu4 renxr ia1lmD an ilt)seumxo nu4opeemiei s sDtm( pno1alxnmociydlmDem( o u) lxomo tytoaDrluei (0srxoim oy4omee fvils) rta(m oo1tpxoiiciyslm ul(ms;t0trtoioctydlptrlieo;s teumxm io4ll elici t) Dur(r ;t0olt moeiyd m umumpnt4altnmo3iodfm  aivil(  2tmxmpoy1ll nmncil( aDrrur ot4apto i3tas sDumn s;(0artnio3iytopDr nvi ( texoim3iu4lltnlnvs t s2urxrooo4tpto fciyd s2uauvo;()trtnmr3iodfp e neslt)t2to(o nydalen iei tf Dtmurpoo1aetoifeiysla emu p t)trerxr iadlatr i olt0teurxmpiu4omtemfvs t) 2ur(rp;o4tpt  oetltfsDrmumont4trenmfctydlm  an o s)teuoir iodoltelncslt) Dtm(r nt1alxn fcildfmDeau p ()tleomo iytoa r uei;t)t2tm(m nu4am emietls srra(rono0oexn iciasfsDrluvs;t) etrxocoadomt auvo s seumimpoydlp n iesat)sDta(m nt1open f3tydlm rlnvont4aeermo ia1oa rluvs;(  eur(opno4ap  liei t) rtmum nu1tpxn ieiasls2ra(vs;t4tetnifcoydoat ln s (0t2xrirpoo4ll   ivt s srua(ro;o0olto icildfs2el( sn()tltnxfctatlmDeaieo;t)s2tm(mpnodole  fesas  Dumxrpnu0aexoifciatfm ua(mo;t4trtoxrcoodfa ranes;(0 exmxrpoo4lmt lnvsas) 2trumo;o4altn ociytfs2ua(msnu0 exnmocio1lm   uvs;()texoxm nudllen ncsasf ruaxro;u1aexo feiyt mDul( s u) reoxrcoodfptelues t) rxrim3iy4openmnes t sDuru p;t1tlxnmfciysla2em(von(0tleoirciytoa  an s;(  rtoio3oy4ll nliviltfs2uax pnt4oeenifciyslsDua(vsnu0 renir3iatlmte u o () 2urio3oy1lme  nvil( sDuaxmo;o0tlxniietadfs uanvs;u)alxnio oy1fp   ies t) rxrir nu4optn ivil(fsDum(root1aeto icilt m ua( onu0alenxr3iadlmDrluvi;t  2urim3oodll   nesl() ruaumpot4aeeoii3ilsls2elnmo () eeniociotoa elivi;t0 2urxr oodalen nes s sDraur ou4olxomfetlt m emn s u0aeeomr oadomtrai ol(  rtoio iy4lme lnviatfa2ua(r ot1tpxo oetasfm2ul(vo;u0tlerxfcoodfat  ivils)setmxr3iy1lle livsat) 2rm(  nt4altnmfciadfm umums;u4alxnmf io1lp raivs;t)t2xm(o ou1al  lnvsat)srrrx p;u4opx io3ils aDrmnmo ()teeoxr3iatopteaueils0trtoir3iy1ll nmivsat)aDrrx o;o0opx  ociysls rlnvp;t)alerxrctodlp  auvi;t  eur(r oydlp elfvslt)arraur ;o1aet mo3iytlsDrmu p;u0arerxrcta1opt aies;s0t2xo(opoo4ol n fvt (fsDrr(  no4opeoii3ias mDrm(mo;t)aeerir3oytlpt  neo;()trtoxr3nu1llen nesas)s2raur ;t4ole  oetatfm rl( o ()alxnio oatoa raueilt  2tmxopnudoltnmfctlsf 2uaxmo;u1tex  ocilsls el(vo t)tleoxf oydopDr i s t t2trirpnudlp e ivias) Dtau  ou1tlxo i3tys a uauvp;u0arerxocoytfpDe u o;( t2trxo io1llee netas s2tau  nu0teeniocildfa rmnmo;t)aetomf3iadfat  n o ( teur(r nydlmee ieil()s2tau  ;u0olenmfetltls2eauvpnu4 rtoxo3tydlaDe u s t)seuoir3nu1lltnlnvtlsfsrrmuroot1tptnmf3iad aDelnvs;()alxnio ty1lptr u i ()t2xr(o3iu1lme mnes t  2ra(  nu1tex mictltfa uauvp;(4altnmr oatfa r uvo s0 eto(o oo4om   fvtl(fsDtaumooo4opx iociys aDrm( s;t0aeerirctytfptr neol( setrxm3ou1lpenmnes s)aDur(  oo0oet mieiydfa rl(mon()texomr3iodopD  ieo s)t2uo(o ou1ale lfvsat)a2taxmo;u0olenmfctatfs2ra(msn(4 renmo io1oaD an s s trxr(o3nydalt lfctlt srrmumoou0olxoiietaslmDuln ont) lxrmf3iytfptelieils)srxm(mpoo4lm e fvils s2tr(ro;o1opxomictld m elump u)teermf3tatlpD luvi;s0setrxo3iodap  mnci tfaDurx o;t4tet mfcias m uln ont4aetriocty1la  lu i s) rxrxr3nudal   nvs (fartmur oo0tee miciydlaDumnmp u0artrxf3iydfaDr uvs;() rtoxr iy4aptemfcs s  rurxm ot1opxoifetlsls2eauvont4arermr ootomDrlu ils) 2tr(m nu1om nlnvtl(faDum(mono0alxoii3tysfaDra( o;t0 eenirctydfp elivil(0t2urxopio4op nlfvil(faDtm(rpot1alenioeiltfs2em(von(4alxnxociatlpDeaivol()trurxm3oudlle livtl(faDtmxmpnu4oex moeiydlaDrau s u)trxnxo3iy1lpD  ieo (0srurirpoydapee ncil( a2ta( pot4tlen ociatlmDeauvo;(4 ltomfciytfmD aneo s trto(o3nu1alenlnvs s aDurx pou0aex ifctlsla ul( p;t4 eenmo3ia1oat  nvols)s2uoxrpio4amt  nci ()aDtm(  no4opxnii3tyslmDemu p t0trenifcoytfmt liei s0trtmxmpoudlp nmfesas sruaxr nu4openmo3iydls rlumonu) eerxf3tatlpD livolt)srtrxopiu4ll e fetl(f Drrx p;o0tee  o3iydfaDran pnt4treoxf iatfm   nvo;t0texr(o oo1omt  fcsas  Duaxmono1tlt  icilsls2umuvo;(4 etrif to1fmDe i o s)trxrio3iu1lme livsl(fsDrrur nu1alx  oeiadfa uanvonu)aexrmf iydlp r ivi;s)srum(m iydolen ics t sDumum ou4tex ifciaslsDel(mo t0 exomfcoa1faDr ueolt0 rurxm nydolt lnvs s)sDuru pnt0aex mo3iydlmDeln sn(4 rtomrctotlmDraneo;t trum(mpny4al e netl(f 2ur(rp;t4aee mo3iadfaDrlumpnu0tlerio tydfpteau il(0srtriopiodllenliet t srraxrp;t0openioctadfmDelumo;t4tlxoif totlpDelueo;s  2urir oy1oltnlneils a2rru pnt1aptn f3tydfm rm(vs t4trenxf3tadomDeai slt tetriopny4alte neilt) 2taum ;o0oltomieiyd aDeaums;() eeomrctodoat auvi (0setoxr3iudomtelicsasfsDta(  no1tlt ifetasla ea(vont)tetoio ia1oaD  uvo t)srxr(o oodll nmicsasfsDrmxronu0tlx  i3tlsfm umnmp;u4tlxrxrciodla rlneols) rtrim3oy4lp nmncsat arrr(mp;u4tle ifeiatfmDulump (4texrircoa1om eluesls) etmxopio1amenliet s)arrrx pot1tex mo3ils s el(vs;()arxrmo3oa1lp eanvilt)t2ur(m3oodalt mncslt)sDtrxrpou4apxoiietytls eln p;t0altnif tadomte nvolt)srur(r no1lpenlfet t) rumum ou1teenioeiytlmDuanvp t0 lenxr3oadfpD  uvils srtr(opny4oltn fci t srumxrp;t4apt mf3iaslmDranmp;(4texrmrcty1lm  lnesls sexoxm3nu1omt mnes s s2tm(mpot4tlto i3tls s emnvs;t) etomf3oadla eauei;t)seumirpiydomen nei (  Dtaxr nt0alt  feiadlsDranms (0aexnio3oa1optrlneo;t) rtm(r3iu1lp   nvia()sDtmu  ;t0oleoiiciys m emu s;t) rermr3oydfp  luvi;s  euoxm no1opt  netatfsDtm( p;o1teeoioeiatlaDranmp t0texnirctadfm e neo;s  2urxm oo1op n nvil() 2ra(m ;t4oleomoctltfmDum( o t0 eerxf oatfptrli olt0s2urim iudlm elfvsatfsDrm(r nt0apto fcilsla el(vs t4 ltrmr3ootom ran i s) 2xrxr3iodlle mfvi tfaDumxr no1tlt if3tatla2ra(msnu4teermrcta1fpDe n i;()t2trxm ny1apenliviltf Drr(  ;t0olto feiad m2ea(vo u4aleoifcty1lpDe nei t)setmxrpou1ap  lfciasfa2uru  ;u4tlxnmociasfa2rl( pn(0trtoioctytopDrluvilt)s2tmxrpio4ll e fvsasf Dtrum oo4tlt iietas mDea( s;t0trxnif3tydlptraivi t)truoir ny4ap   nvsl( arumum no0tet iietlsfm2ulums u0altoio3oodlat lu i;s seurxm3nu4amtelivt t srrm(monu0aexnmoetlt m rl(mo u4arenmr3tytfate i ils t2toio iy4lpte ivi sfs2tm(mpnu0tltoif3ild m ua( snt4aeenxfcoatfa  an s (0 2um(rpnudope mieiltfsDtrum no0tee moctat a emnmo t4tltoxfcoa1laD  uei;s0trtr(opnodoltnmfcslt s2ta(rp;u1tpt moctls s ean s;u4 lermo iatoptr uvs t0 rtmxr3oodaptnlici tf rtrxr no1ope  ietltfa rmn pn() lenmo3ootomtraies;(0t2xriopnu1lmenmfci t) 2rmxrp;t0oeeo ieildlaDeaumpn()tlermrciy1om rauvsls  rur(rpoodom nlfvsls  rumxrp;u4aet  f3tltla ua(vpnt0 etnir3ta1omt aieilt)srtoim oo4op  lnctasfsrtrxrp;u4oee  ocildlm eaumont0trerxf3ta1lm elieo (  etrxr oo1amenmnctl()aDua( poo1tex mfetat mDea(mpnu)arxrio oydoaDrlivi () 2xoxo nydll  mivt s)arrrx pnt1aeeoioeildlm uanms (0aleoxfctodfp e ivil() 2trim3no4lmtnmfci sfsDtaxr ot4tpxnioeiaslsDulnvo;(0 rxomo iodoa rli sl(0teuo(m3iy4apt mivi s s2rm(m nt0aexnifetysfmDumu p;(4aetrir oo1lat luvs;s)trtrxo ou1optnmncsa()srtr(r ;t0tet ifciadfs2rmn ont0aexoxo3totfaDrau o;() rumio3oo4apeelivias a2umur oo0tltomoctydlmDrluvs t4artnxr iodoat luvo (0teumirpiu1apee fesl( a2rmx  nu1tpxo feildla ra( o t0aexnmo oadop r u s t0t2um(rpnu1ole mici (faDtaumpnu4alto i3tld m2emnvp u)tlxnmr tydfat auesls) rtrxopiudlpee fvtls srtrxroot1tpt mfeils m2umu p;(0areomfciodfpte uvslt0trumirpiy4omt  nvt (fsDrr(mpot0olenmi3tytla2ulnmpnt0tlermo3tatlpD lu i ()s2urimpoy1op e iet ()arrrurooo0aleoiieiadla2emu o;u) rtrxo3to1oat  uesls)t2xrir oydlle  fcs tfaDtaur ;t0tleo ictasfs2eauvo;(0 reoxo iytomt lues t0 2uoxm3iy4ol   ivt (f 2umxmpnu4aee ioctls mDelnmont4 eeoir iodfpD liesl(  exm(r3nudap n iet t  rtr( ooo1apxomfeiaslsDulums ()aetnircto1lateluvs s)t2ur(o ou4lmt lics ()arumxr ;t4ale iociyd a emn p;(4alermo3oadlpDraieo ( t2tmir3oudolt mnvi s)aDrmx pot1oleoii3iadlsDum( s;u) ltrxo ta1omDrlueo;s seuoio nu1am  mfcs () Duau p;t1oltniietltfa2ra(vp ()altnircoy1fa r i s;t t2uoxmpnodllenlicilt)sDtr( pnu4tpenmietat aDeau p;(0trxomo3ia1fate nvsls)sexrxr3iudole  fctltfs2tru pnu4tpxnmicildls2rau p t4 rxoxr oo1lpteaueilt0srum(o3ny1amee fvia(fsrtm(moot4ape iicilslm2rlumpnt0trenio iadfa  ln slt0 rxoir iy4olte ncs tf Durx p;o1alen o3iytfm2uau o u0tlxnir3to1faDranei;s0 2xriopnydamenmivsl( s2tmxmpoo0tetoiictyt aDra( s u4 lxrio iydomtr u ils0teum(opny4amt mneta()srumu pnt0texoif3tatfm em( s;(4arxoxo3totomteai s s) exm(rpoy4lpe mivta()srtmx pno0aex  ocilslm2eauvp;t4aeenmo tatomtr nvi s0 exmio3iydllt  icsat aDrau p;t0apx iietld m elnmont0 reoir3iadfatean s () rurimpno4apen nvi tfartmumooo0aee  f3tad s2em( o;u)altnmr oadlaDeaneslt  2to(o no4om n ivi tfa2rm(r oo4aet mf3iltfm2ua(mp t) exnifciatlmt  u s;s)s2trxrpiydlptelfetasfs2rm(mpno0openiieiasls2rl(mo u4 leoxf3oadfmteanvo;s0 2xm(o3nydlltemivils)s2ta(r ou0tpenmo3tydlm2rlumo;(4tltomf3iy1fm   uvol(  ruo(m oo4ll nlfcslt s2rmxmp;o0opxnii3ild a rm(vont4aeerircio1laDeluvs;s)trxo(o3nu4ome  fei s aDuax poo0aleomoeiltfaDum( p t)alenmf oadfp   iei;(0 2toxr iudopt lfcslt)a2umxmono4altnmo3tld s2emumsnt0 reoio oydfpt aivi;()s2xr(m oo1ol nmnetlt)s2umu  ;t0tlx ifcilslm2elnmp t4trxnmf3iydoat lu il()t2xr(r3oudlpt  ictatfa2rr(mo;t4olx mfciysfa2el(vs;u) lenmo totop eanvo (0truo(o ou4ale lfeiat)sDtauroou1tet  o3ils m2uaumpnu0aeenxo3ty1lmteauvi;t)trxoim ou1lpenmfes tfaDtm(m nt0optomiciatfmDeanvs t)tlxnxfcio1fpDr neo (  rtoirpiy1lleeliet t sDum( oou1oex mocilsla2ra(ms;u0arxoxf3iy1fmDe ies s) rumxm ny4amenmfvilt sDraxmp;o1ole mi3ias m ea(ms;u0 etrmf3tadlm elu s;s truo(opiu4omeemicilt s2umumpoo1tpe iietldfm rl( o;t4tetnmfctotoatean sl(0s2um(m ny1ap nlnvsls)a2uaum ;o0oee  o3iltlsDeluvp ()arxnxo tadoat lu ils)teurim3nu4lmee ieiat)s2raur ou0tpx  o3ias s elnmpnt4tetomr3ootfat  n o t)trxo(mpnydam n icilt  rtr(m ;o4apxo oetltfs eluvonu4 exnxr iodom  li ils s2trim ny1apenlfetat s2uauro;t0alt  ieildls2el(mo;u4altoxo3oo1om r ivol(0srxoxrpiy4amt  fes t)aDuau oou0oee if3tatfm rmnvont0 exrif tadfa e ies t) 2tmxr no1ol eliesls)sDumxrpoo0oeenmfcildfs2rl( snt0arxnxr3oatfmt  n s;t) etmxm3oydam n ncils) Dra(mp;u0oeen f3iadfa2umn p;t4altoxf3oa1fm  livi;t0 eumir oo1lm  lfes s a2um(m nu1oltomiciysla2ra( o u)artnmf tatfp eanvils)texr(opiudomen ivslt) Durur ;u0aeeniicilt a2rmump (0tetrmrciy1fa  aieols t2xmxrpiodlpt  fvtlt aDuaum ;u0apt mfetatfsDrlu o;t0aeerxo tytlpDelneolt trur(r3ny1ope  ncs tf Duax  ot0tet miciad aDem( o;t) ltnxf oa1fa rlu s;t  rum(o io1lm nmictas a2uaxr nt1tlxn f3iltfmDuln p t0 lxnxf iadlpDeanvs;t truoxopio1apt lfvt (fsrrrxm nu0texn ietldfs2uauvp;t) rtrif tytlat luvsl(  etmir3iydameemfvs s a2tr(r ;u0optomoetldfa2elu p (0artoxr3todlmDeliei s0srum(r3oo1ameelnvi t)arumump;t0tpe iociltlm2ranvp;()tetrxoctytlm  aivs s0truoxm nudlmtelnvi t  rurxronu1apx io3tasla2uanmp (4 rermf iotfp r u s;() exm(m3ou4lmen iesa(  2uru  nu4tle mfetydlmDrl(vsnt)aexnmrcta1lmD luvs s0trxrxm3nydop  lfetlsf 2rmumooo1olto fctasfaDumn sn(4 eermo3todomt an sl()s2tr(m3oo1lptn fvi ( arur(rp;o4tpe io3tadls umnvp;(4arxoio3oadom e ues;s)teumxm3iy4lp n ieilsfartmxmo;t0opxomfeildls uauvs;(0texnmo tydla  lieo s0trxoxr3nu1apeelnetl(f Dtmxro;u1tpen oeilsla ua(vo u4texrio3iytoa  luei t)trtmxr3iodolen ivi (faDuru ont4altomfctas m uaump;u4 lenmo3iotoptrauei t)texmirpoydlm nlfcia(farumump;u4apxoii3iasfa el(msn(4alxoiocoy1laD auvo;s)tetoimpoy1om eliet ()s2rrxmp;o1teeo octadlaDra(mp;(0 ltoxf3tytopt luvi ()s2uo(r iydom n fetl() Draum ;u0apt iictls sDrau pnu)trtomoctatoaDeaivo t)trxo(r3oy4oltnlict s  2rru p;u0tpxo f3iyd m2ul(ms u0 eeomf oa1lp raivs;( srum(m iu1op n fetltf rrm(  oo1aet  ocils a uauvpnt0alxrirciytom r nvil(0trtoxo3io4ap nlici (f rur(r ;u4apeo f3tatls2em( on()altoxr iytomte ueo;s) 2xoxo oodape mici tfs2taurpot4olx iieiat aDemums;t0 exoxrcoatfat luvsl(0 2umxmpoo4ale lneia( sDrru pnt0aexo ieiytfs rmn s t0teeoio3iatlateau ilt t2um(mpoo4ap e nctls)sDuaxmpnu0oet  octatlmDrauvpn(4alermociytfm eaieo (0teumxrpny1ole  fesls a2ua(m ;o0aet  ietatlm2rau snu4 etrmr iadlmtr uvilt0 eum(mpny1lpt lfvi sfsrtmxm ou1alxnmfciyt s ul(ms;t4arxrxf3ty1lp elu sls) etrxo3io4olt lnvtls) Dururo;u1teenmo3tls mDemn s t)tltrio tydfaD ln i t0s2tr(mpno1ol n ncsa()s2um( pou0aexnmoeiltfm umn o u0 lenxf3todomtrlues ()sexoxm ny4ll emfetl(faDrrumpoo0apen ieilsfa elnvon(0aexomo3iadfaDelneslt srxr(mpio1ameemnvia(faDta(ro;t4tlxomieiadfm umnvo t4 exnmo3oydfp   u sl(  2urxmpnydlltnmicils  rtaxmo;o4oexn f3iat m uanvs;() rerioctatlm eln i;s0trtm(r3iy1opte ivias)sDrrxmp;u0ole mfetltfm2emu s;(0alxrir3tydopDelies ()s2tmiopiydlpenmieil()srumx  oo0ale iiciadfaDrmuvpnt0 eerxo iadop rlivols)s2um(r3iu4lm nlfet t  2tmurp;t0aetn oeiys sDua(monu) lxnmocootlpDeaneils)t2urim nu4om emivia() ruax  nu1tlx micilslmDeaump;u4 reoif3oatla eai o;s)trtm(o ou4ape mnvtlsf 2uaxrpot0olxnmoctysla2um(mp u4areomf iy1fmtrlivo t0t2umxrpnydaptelicil(f Dtmxro;t0opxomf3tlslm uanvpnu4tlenxr iytfmtran ols) 2urxopio1ol nmivtl(f 2rmx ont0texoii3tytfsDemnvp;(0 eermr3iatfmDrlieol(0s2to(m ou1op nmnctls aDta(root4opx  ictyd a2uan p t0trenmocoo1fpD anvs s0tetrim3iu4lmtemfeia(farurxrooo1opt mociltfa2ra( pnt) lenxo ty1op eanvsls) rtm(o3iudomt lies () rra(ro;u0tex mfeils s2rauvs;(4 lxrif3tadfaDeaueol( sexmimpiy4al e fesas aDrm(m ;t4opxnmi3iltla2raumon(4 lxrxf oy1oaD anvo t0seuoir oydomt lies tf 2uaurpoo1aptn ociltfs2uauvs t0trtrir oatomt ln s;t)trtrxr nu4lme  fetat)arta(  ou4oleo o3iasla2uluvo t0tleoio tatfaD aues;()tetmxm3nudalt micilsf Dua( o;t4tpeo oeilt s2rmnvs u0 eerircootla r i ols0truo(o nu4lpe mncsatfaDta(r oo1oltoifctadfa em(mont4trtoxfcoytomte nvs t0seum(mpiudom nlfcsatfa2tau onu0oltnioetytlm2rmu s;u)arenxf3ootfmDrlneils  2xrir3iu1al  lnci t) 2urumpot4opt  o3ils aDumnmsn(4tetnio3ta1lmDean i t) etm(r oudaleelivias aDrm(r oo4alxomociyslsDrau o t0 etoiociytfptrauvo s)srum(opio4opeelfct ()srrrxm ;o1tltomf3iytfa rlnvpnu4aetrio3iadfpD lueols teumim3io1om elies (fs2rmumo;t1oetomo3iysls um(mp (4texrir oydlm e nei;s texmxmpiy4amenmnei t) rumump;t1alxnmo3ils s2rmnvs;t) eermrciotomt livi s trtoir3nudlmtnlict ()arrrumooo4tleomociad a2em( sn(4tlenif iytomteaies (0 ruoxr iodomte fcta(faDtmu  nu0tlx ioeildfa em( p;(0 etrmocto1fa eluvils0s2ur(m ou4altnmivt t sDrmxro;u4tpt moeiasfaDul(vp u0aetnif ty1lpteliei s0 etrxopiudal   nesa(fsDrrxrpno1texnmociatlsDuaumon(0tlxoif oadfa raivs;t0trurirpoudamenmivs ( aDtauro;o1apxo icils s ulumo (0altnio3tadlm e iesls) etriopoo4ap nmieia()s2rau ooo1texomoctldfs2rm(mp;u0arxrif3oytlpDr u s t0t2trxm3iy1om e ivsas sDua( p;o4tpe mieilsla rm( p;t4 etomf3tydopD ln o;(0texr(m io4ap  lfvsat  rta(rpnu4aee moeild m2rl( sn(4trxrxociodla rlu s s0 etrxo3iodlme  feils  Dtrumo;u1oltnioetadlsDrmumo;t0 lxnxf oydfaDeaivs;() rxmxo3ou1omt lfvsa(f 2rr(monu4oex moctydfs rluvp u0 ltnifcoatla rai s s t2ur(r3nu1al  mieta( a2rmx  nu1oexomi3tas s2ul(vonu) rxomf3iytfpD  u o;()trtr(o3ou1altemnvi tfs2rr(mp;o4tpxnmfeiatfs uluvsnu0alxniocoodfm r ueo;t0trtm(o3oy4aptnlfctl(  rtax poo0olen feiydlsDemumo u0arermrciatlmte n o;t0 rurxm3ny1lptnlics t  2rr( p;o0alt mieildls2emu on()teeniocoa1fmteln ilt0srxrim3ny1al e nci ( a2tau  nt1alx mieiysfm2emumo;t4 rxrmrciydfmDelnvi;t0teuo(rpno4lmtn iei sfs2rmx  nt4tpe moctysfaDumnvo ()alxomfcoa1lpt lnesl( trto(opou4altelnvils)a2rm(mpnu1olt iietytls2emumsnu) eenxf3iadfmD ln s t)tetmiopio4al elnesa()sDtaxmoot1tpx moetl
\ No newline at end of file
@@ -0,0 +1 @@
+uvil() 2xr(r3oodamee ncia(f Dtaxm oo1oetnmociasla2umu s;()aexnxrcoatlat  n s;s0t2urio oo1ap  mfcs (  rtmx  oo4optn f3ias a2rmnms;(0trxrmo oadlpD ln o t0texo(r iodop   net sf rtrum no4open o3tad aDul(vp u0tlerxo3oo1lm  livsls0 2xm(m nydolenlnesa(fs2raxr nt4tet ii3ildls uauvs u0trxomocootomt  u s;(0 2trirpoy4al  livs sf 2ur(rpou1tltn iciad mDeluvo u4 exrxoctydop  au i t  etmimpnu4am nmfetl(farrau p;t0opxnii3iatfaDran pn()aeeoiocio1omDeliesls0t2trxmpio1amt  nvtlt)a2um(r ou4apxn oeias mDeaump u)aeenir tadlpD  ieo ( s2toxr oo4omt livsas s2rm( o;t1tleomoeils sDrmump (4aeeomr3oytfpDe nvo ( truo(o oodlmee fesl(fs2umum oo0oeeomictys m2umn o;t0tetnif iodfpD  n o (0truoiopoy4lmenlfct sf rumu  ou1teenmocildlm2rl(vp t0aeermo3tydfaD anvs s0seuoxo iydlme  fvi t  2ur(ro;o1tpe miciatla2ulnvo ()alerir3oatla  lnvilt0trtrxo3iydolenlicsatfs2tmx poo4oleniociyt a2umnms () exoio ta1lateaieol()seur(rpoydomt lncsls  rtm(r nt4olto ieiytla eluvp (4 exoxfcto1fp  lnvslt  ruoxrpiu1lp nlnei s srra(mo;o4aetomf3iysls2ea(vs u0tltrxocia1fmDeai i s  rxrxopoo4llenlfesatf rtmurooo1tpeo ieiytfm2rau p;(4teenir3todoa  aies;t  rumio ou4olt  fvslsfsDua(r ;t1olxnmieias s2rm(vpn(0arxrif3iatfmte n s t)trtmim oo1lmeelici ( aDtax p;o0tlxo f3tyd s uauvp t0trxnir to1laDe neo;(0srxrio iu1ll  lnct s) rtrxmpou4oetnmocild sDul(mont)trxrxrcoytoaDr ieo s0trtmimpiodlmeemfvils  rururooo0aexnif3iad m2ea( o;t4treomf tytfp rli s;()sexrir no1lltelnvtas)s2tm(monu1alx  ieilslsDra( ont0aeeoir tatfat  ies s) 2urxo io1op n ncia( a2raurpoo0aptn o3iyt mDuln p;(0tetoirciydfaD aneo ( srxmxrpiu1om emnci tf ruau pot1ale ii3iad mDeanvpn(4tlerxr3oatlaD auvs t0 rxrxm nudomt lneil(fa2ra(ro;u1tltnmociydla2eauvo t4 rtnifcoadlatrli ilt0 rxoimpnodom e nci ( aDurx  ot0apx mfeiltfmDua( p t)trermrctytlmte neo (0 eurio3nodlmtelnvt s)a2um(mo;u4texnmf3iaslmDem(mon(0 etnxoctytfaDean i;(0s2tr(o3ou1lpt  net s) rta(m oo0oee mfetyd a eluvonu4teerxr ty1om eanvs;t)trur(r ou1opt mics sf 2rax oot0aetn iciys a2rau onu) lenmo ia1fpt  i s t0tetmxo3oy1omeelfci t  Durxm no4aex  ociytls2ul( p;t4teenio3iadopD  ivi;s0trurxo no1opee fcta( a2rrxmoot1tet io3iyd a eanmont)aetrxf iadfm eluesls  exoir oo1alen nvilt arta(m ;t1olxoii3iltfaDemump ()aexoif3io1lpt  ieo;(0setmxr3iydop nlicsl(fsDra( poo1apxoif3iatls el(mo;(4texoxfciodom rlieil(0t2xmxrpiy1olenlfvtl( aDtrur no0oex ifcild a2uanmpnt)tlerio iadfp e uei s t2toirpno4amtelivsas) rurum ;u4olxniiciad m emu pnt4 rerxo3ootopDraneilt t2xrio3iy4opt mivslsfsrtmu pnu1oltnioeiltlaDum( s u4alxnmfciydlaDrlu i;s)t2ur(mpoy4ll n ivias)a2rau  ot0tlt  oeilt sDrmnms;t0arxniocoo1faDr n ilt0 ruo(m3iy4oleemfeilsfsrrmuro;t4aeeomictatfs2eauvo;u4 etrio oo1laD livs t0sruoim3iy4al nmics ( artr( o;t4teto fciat m2rm(ms u)trtnxf3ootfp  lneol() exm(r3no4opeelnciltf 2rruro;t0olt  ieiatfa2eau p (0trxrifcoatlat lneo;()s2urxr3oy1omee ietltfsrrm(rpnu1alto fctysfaDel( o u)aleoir3totoa rlnesl() rxr(rpoodlm e fei tfs2ua(  nu0apxnmi3tltfmDranvs;()trtrmf3to1fpDrlivsls) rurxm3ny4ome  ies ( sDrmx  ;o0oeen feiadls2ua(von()alenif iadlat lneo (0 2trxr3iu4alt mneia(farurur ;u1aex mictytls em(vp;(4aetnxr3ta1lmteau s;()texmxr iu4lp n ics t) 2rru oot1opx iictydlm2ul( p t)tltomo totfpDe u s;s)s2xrxr3iydopeelfcsa() 2um(rpou1tpxn iciadlmDrl( pnt) exnmo oo1oatrliei t0srtrim nudlle  iciat a2rr(rpno0opx  ociltls2ua(vs;t4 lxnxo iydlmt  u s s  exr(m3iodopee fvsat srtax  nt0oltn ocilsls emuvo;t0 etnmo totlp r i olt  2tm(m3oo1ll nlnesa(f Draumpot4aexn f3tlsfm ranvo (4 lxnif3ootfmteauvols s2xoiopny1al  mnetas sDuaxront0aeen i3ild m2ra(mont4artoxo3oatlateaneo;(0 rto(o3iy1ope lfet t sDur(mp;t4tex iociytfm2rluvs u)arxrir3tadfatr nesls  2urimpiydamtn fcslt)aDtru  oo4aexo oetld sDel(mo;u)tltnxrctytlp  luesls truo(o ou4lleelfetas a2tax oou4tetomoetysfs eaumsnt4trtriocoy1fpt auvslt)setmxo iu1apenlnci s aDtr(r no0olxoiociad s2umu s u4 ltrmrctytoate uei;t)trxoimpiy1op  mncsas aDurx pou1texoiieiat a rau p;u0 ltnir3ta1lmDeluvi;t trumir nydop eliet t srtauroot4tlxoif3tatfaDeauvsnt)aetnmr3oatlaDrau i;t0t2toiopiydll  mfcs (f rrrx  oo1open feiydls eln p;u4trtrxf tytlmtrluvi ( s2umxrpnu4ale  neiat)srrrx pno4alxnmfeilsfm2rluvo;u0arenxr3to1laDeli ol() rtoxopoy1lp  mics tfs2uaxmpnt4opeo i3iyt a eaump () exnio oydomD aivi ( srto(o3nodol e fct t)s2tmum nu4aet  fciltla ra( o;u)tltomrcoytopD ai s;t0s2xoiopio4op nmieslt)sDrmum no1olx  oetadla2ul( o;t0 renxo iatfptrli i;(0setoimpou4apt  fctat)aDrrxmoot0tptomfciat m2ea(mo u)trtrmf iatfa  lu i s0 rxrio nu4oltnmfctat srtru  nt0oee  feilt a2rauvp (0trxrxo iadom r ues () rurxmpoo4opte fct tfsruax  ou4tet  i3iyd s rl(vsnt0 exnio iytfm e ivo;(  rxo(m3oo4lpen iet t)aruax onu4texn i3iadlmDem(mo;t4tlermrcootom rai o (0trumxr3nu4apenlfeta(fa2tmur nt0alxo ociyt sDelums;u4arxoio iotfa   i o;s0setm(o iodlpt lnvtasfartrumo;u4olt iicildfs umnvp;t) rxnxf oodlm rlnes ()s2xm(rpny4omtemicil(fartrur oo4aexomfciyslm2elu snu4 leoir ty1lm eai i (  2urxr oudlp e ietat aDua( o;u0opxoiieiatfaDumuvo;u0tltomo3io1oatelivil(0 eumxo3nydam  lfci t srta(mo;o0aexo fciydlaDuanms;t0arxrxr oy1fp ranvo s0trumim iy4opee iet tfsDururo;o4oet  ietadfaDrmnvp u)trtrmf3iydop elu o;t)t2xrxrpoy4amt miesltfs2tru pou0olxomo3iatfs ul(vo;(4 leniociytlmt  nvo;()setmio3iu4ole mncta()s2tau pnu1tetomfciadfaDul(mo u0 rerirctytoate ieolt s2tmxr3oydlmte iet ()sDtr(r ot1tlxnmfctlsfm2emn onu4 rxnxo3tatfmt anei;t t2xmxo ou1apt  ici ( srtr(rpoo1tpxnmoctys a2uaumo;t4arxoif oodlaDe ivs;t  2triopio1omen nviasfs2urum nt0aeeo oetad a2umn snu)arxnmo oatlp ranvi t0trtoxm oy1lpenlivsatfsDtaxrp;o1alenmf3ild a emnvs;u)texrxr iy1op rlieo t0tetmxmpiy1lltnlnetlt) Dra(mpou0oleo ociadfm em(mp t4aeenmr3iadlp   i o (0teuriopiodalenlicslsfaDur(r ;o0altnmieildlm em( snt)aleomo3oadfaDrlivolt srumio3oo1oltnlnvtls)arrmxm ;t0oet mf3iadfsDumuvp;u4 ltoirciydlatr i i ( srxr(r oudolenmfetat srrrx ooo1tpxnmi3tlsfsDea(vsnt) lermo3oo1op rlu s s texrirpiu4om nlfeia(faDur(r no1tex moeiysfa uanms ()aexrmr3iytoa   ies (0trtoio no4ol  lnctl(f rururpnt4tpeoif3tlslsDrluvsnt4tlxnxo3oo1omDeauvsls0 rtrim io1olte ieils)s2tru o;o4alx mi3iyslaDea(vp;(0trtnxr3iadomt lnei;t) 2ur(opny1ap e neslsfa2taxmo;t4aptoiieiatls2umump ()aeerirctadomteai s t0teum(rpny1ll  mnct t  Dtrurpot1aet  f3iatlsDeauvp t4 etnxrctodoaDr ueo (0 rurxm oydomt  nvi ( aDtrur ;t0apx io3iatls rm(ms t)trermr tytoaDelu o t0s2xm(r3io1optnmictlt  rur(rpnu0opxn ictysfm rlu o;()aexoxoctatlmDrai i t) euo(o nu4aleelncil( sDur(mo;u1alto o3iatlm emnms t) ltnircio1omDraneslt)srto(m iudlme mneils srurxm ;o1apxnmfetytfa2eaumo t)tltomf3oatlaDraivi;( s2toxr3oydll nlfvi (  rua(mpot4alx  icild aDra(vonu0trtnxo iatfpD  ues ()tetr(o nu4lm   fvtl( sDrm( poo4oeenmo3iyslm2el(mont4 leoxf3iatlaD luvs t0trtmim ou1optelneia(  rtrx onu4tleomfetlt aDrm( o t)alxnxr oadopDeauvi;()srxrir no4al n ivtatfartrxrpou1opx  ieias s rl(mp t4teeoio iy1la rlu s;t0 2umim oydamtemfetl()a2uax pno4alx io3tydfm2rmnvo () rxomf tydop elneo t)t2um(opou1optnlneilt)s2uru pnt0apxnifciadfa eau s;u0teeomo oadfpt  i i t0trurxm iy4ame lfvtls)sDrm( ooo0opt io3iytls rln pnu4tetrxo oa1omtr u ils0 eurxo oy1omt livsas) 2rrum oo4olx iicilt m umu snt0 eerio oo1fm raivolt0 2xrio iudlm n ncs t  2rmumo;u0opxnmociat m rmnvsnt) eerxrcoa1lmteanes (0setr(opou1apenmnci tfsrtax o;u0tltn fctldfs2uluvo t)tlxoircty1lmtr u i;s0t2ur(m3nodope lnei (f 2raxm ot1ope iieiadls rau pnu)trenxr3tadopte uvo s trtoxrpio4lm  mnctltf 2tm(rpno0tlenio3iydfs eluvs;t0alenxrcoo1omte n s;t  rtrxr iydol n ics t)s2uaxrpot0tlxomictltlmDulu s;()artrio3oo1fmDeau ol()t2trio ny1ol nlici s arrmur ou0altn feiatfaDranvs (4teerxo3iodopD lneols)texrxrpny1lmenmnvsa()arur( oot0oltoiictlslaDul(mo;()arerir ty1la rln slt)trxmxr3ny4optemneiatfsrur(rpot0tle  o3tadfm uan p u4aetnioctodfaDe nvo;(0 2umim nu1aptelncs t aDur( oot0aeto oeilslm ra(ms;t0tlxoir oo1lmt  ueo;()trumxm iydlpe  fvsl() 2rrxroot1tetomi3iasfaDemnmp;t4tltnmf3iadlmD  neol()sexoxr oodopenlnvt t  2ta( pou1tltnmf3iad aDrm(vo (0aeeoircta1laD ai s;t sruoim oodalee fet ()sDrmumpot4ole ii3iyslaDemumo u0artrif3iatfatr ies () rxrxr io4omenmnet ()artaxmooo4tptomicildlsDrlums;t)aexrxr ia1lptrauei;() 2toimpny4omenmfvta(fsrrmur ;u4aet io3iasfs em( o u)aetrmf ty1lp raneslt0 rxmirpoudom nlfvsa()a2tm(mpno1ape  ictlslsDrl(vo;u)tltnif ia1lmD lnes ()s2tr(r3oo1altnmivta() rurxrpnu4oexoio3tyslm rm(vs t0 eeniocoy1lpt  ueo;s0s2xrimpnodolte iviat arrr(  ;o4apxomictadfaDem(mo t4 lenxo oydlmteauvi ()teto(m3oo4lltn fcs s a2ua( p;u1olxo oeiytlm emuvsnt4trtrxrctydlm eauei s  2umirpnydalt mivta(f Dta(mono4tleomf3iltlsDuauvp;u0texrmrciy1lmt lu sls0 etrio no1ll nmfvt s)sruru p;t4aeeoii3iyt a umump;u)alxoirctotlpt  neils)t2trxrpou4amtnlfei ()srrau pnt1tpxoifctlt m elu p ()aeenxrciadlate i s;()t2to(m iydlpenmivtlt a2rm(r ;t4tetn f3tyd s ranmsnu4 rxoxfciotfa raues;(  eurimpny1lpenmfesltf 2rax oot4tetnifcildla2ua(vsnu)areomo tytfpDe nei;s0teumxr io4ole mieiatfarraurp;o4tet ioctas aDemu snu4 rxnxf iatomDr n s s)srxoxrpny1lmen ietas srtmumpoo1tex  ietldfs2ran s;t)teerioctatlmteanvilt0setr(m3oy1open neias  2truro;u1ole  iciaslsDulump;(4 lxniociadoat ai il(0 rtoirpoydamtelivilt a2rax  nu0tlt if3iytlaDum(mo t) eenmr oydfpDr nvo (0t2xoir nu4omtnlfciltfaruaxm ;o0alx  o3iydlsDuanvon(4 etrxo3iytla eanvs t0 exm(m no1ape mici tfarra( pnt0aexo f3iasfm2um(vs;() rtoir3tadlp rlivs (0seto(rpnodope lieia()a2uauro;t1ale  iciatlmDemumo u0treoxfcoodomDe uvols) 2ur(rpnydale  nvtl()arrr(m nu4aptomictydfa rl(mo u0 rxnxr oytoaDe ieol(0t2tmio3io1ope livs t)s2rax p;u0texnmo3tadfaDuan s t)aexnxo tatoat anvs () rur(rpnu4lp emnvsltfsDuau  no1opt mociyt s rlumon(0trtnxf totfpDr i s s)seumxopoudamt lfvsas aDuau onu4aee  o3ilsfa rauvo;(4 lxrmocootfatelivs;s trur(o oudolee fctlt)a2tau  no4tee mociytfs2rauvs u0 rtnxo oytom ranvolt seuoio oy1ole  ncsa() Dtm( o;t0tptnmfctydlm2eaums;t)alxomf iotop elieo t sruo(opno1al nlneia( s2uaxrpoo0optn i3iaslmDrmu p;(4trerio oatfp r nesl()srxm(mpiodolenliet s)srum(r no0ole mfetlt m2emnms;t4trxrifctatfp   u o () rtmxo oodlptn ivsat  2rmxmpot1oee if3iysfsDrl( snt)alxoio3tatlpD auvil()trumim3ny4lmte ivta()s2rmx oot1oee iiciasls rln pn(4trtrmfcoa1opDeaivi t) 2tmim3ou4ap   ivslt sDrau o;u4oexoiiciatlaDrmnmpnt0aeermo oy1fptelnesls) etrxo3nydopenmfetl( sDrm( pnt4apx  ietyslaDrl(mon()aexoxr io1la e i i t s2ur(r iudom n fvi t)a2taxronu4aleo ieiat aDranvo () lermo3totfaD ln i;(  rxo(r iodol nmfci t aDrmuro;o0aeenif3ild m ea(vp (0arerir oodoa raiei;t trxmxopny1apen iesatfs2taxrono1tee ioeiat m emu snt4alxnmo oy1lmt li o;s) eumxopoodom nlivil(faDuax pnu0apxo octltlm2ean snu4 eenio iytomDeaivo s0 ruo(r3nodapen ncsat)artax p;o1apeo fetysfsDemuvo u0 rxrif3oo1oat anvsl(0 etmiopoydam nmneta(  2rmxro;u0oet moetydla ra(vp;(4trxnxo oa1fmt livo s sexrxm3io4op emfei s)aDrru  ;o1apxomfetyt m2ul(ms;u4alxoxo3oydfpDe nvils0tetoir oy4am emfvt s  2rr(  ;t0tle ioeiad s elnvo t4aleoircoy1lmteai o;t  exoio nu1apenlicilt)sruaur oo4alxniieild a2rmnvo;t0aexrmfcootlm   ivs;t  2xrio iu1lpenlneils)a2raum ot4tptomoeiydls2eln on()texrif oadfa r uvs s0texoiopiodome  icsa()s2uaxm ;o4opx  octad a2ulnvpnu) reomo3totfmtranes ()trto(opoo1al  mici ( aDtaumpoo0opxoiiciat sDrmuvp;t4trxrmo io1faD ln s;(0teur(opnodop e ivt (faDrru poo4tet mf3ilsfm rl(vo u0trxoif oytfmtr ieolt)s2urir3oo4llenlietlsf 2raurpoo1ape mo3iytlmDrl(msnt4texomo todfmDeaneo;t0 ruoxrpiydlpt  ies sfaDrmx p;t0ope if3tatlm2um(vpnu4 etrmocoodfpDrli s;( s2xm(m iodlm nmfetltfa2tau onu1alxn fetld m2rlnmp;t)arxrifctodfm eluvolt0trtrimpnodomtnlfct t)sDrrx  no4tpeo feiyslm uanvsn() lenxf ia1fp e u o;(0truoxr oydamenlfvia( a2ra( pou4texomo3tltla2umnmsn(0tltrir3iytopD ln o;s trurir3oydomte fctlt) Drrumpnt1oexoioetyd sDrm(mont4arerifciy1op eli slt s2xoim3oodaltn feilt s2rrxmonu1aptoiieiadfa umnms;t)arxrioctadlpteai slt sexr(rpnu4ape  fci ()a2raxr nu4oee  i3ilsfs2emu p t0 rxrxo3ia1fmtr u i;t)s2umxmpoy4lp elnci sfarur(r ou4tpeo f3iad m2ran pnu) etrif3iydlmteluvsls srum(r3oy1omeemivsa() 2ta( o;o4alx ioctyslm elnvs u) rxrmfcoatfaD lnei (0sexo(m3iy4lpenlfvsl(f 2uru ono4apxnioeiysfs2um(vo t4 ltrxf3iatoa  aivi s0seurim3iy4amee ietatfa2tm( onu0oex  f3tatla um( o u0 exnxocio1opDrli i t)s2xrim no4amtelfeil( s2rmum ot4opeoif3ilsfm em( pnu4tleoxfctydlaDr uvil( srtr(o oo1omeemivia(fsrrrumooo0opt  o3tlt s2eln p;t)trtrxrciotfaDranvi;t0trtoim nodomeemiviltf rurur ;o1aetn o3tysfa em( snu0trtrio tadlpDelnvols)srxmxrpiu1al emnvtasf Durxm ot4opt iictldla2rlnvsnu0 etnmrcio1laDrau o s0 exrxr3oo4lp nlnetasfsDra( p;u0oexoioetls s el(vpn(0artrir3iydfptrlueilt)seuo(rpiudap nlfciatfarraxmpou4opxo ociat a2em(vp;(4 leomo3oadfat  u ils  rxo(opny4alen ncias  Dtrur no1optomocilslm eau o u4alxomo iadlm  luesls t2toxo3no1omen fei t)arrm( o;o1alt if3iytla um( p (4aeenxf oodfpt anvo;( trxmxm nu4lpee nvt (  rraumooo1oex  iciys sDeanmpnu4alxrmf3totla   i slt0srto(mpoo4lmenmnvsa() 2rm( p;o4altomf3tydls elnmo ()alenxf3oa1fm r n i s0 eumir3ou4aleemfcs ()aDum( ooo0tpxnmiciaslm rlu p;t) ltnio tadomteau s;s0 rxmxopiodll elivtas  Drax  oo1tle  oetasfm2ea( p t)aetomo3tadfm e uvi;s)teurir3ny4om   feia() Drr( ont1olen ociasfs rmuvs u)tetomf3oytoatrauei;t)t2tmxo iudal nlfetlsfsDururono0oexoioctlsfa2eauvs t0tetrxo3ootlaDe u ils0tetm(rpiydap nlivil(fsDuau ont1opxoif3iatfmDul(von(0 eerxfcootfp e u ils) rurio3iu4omeemict t) rrrxm oo1opeo o3tysfs2rmu s t)tetrxr oatlpteauei s s2ur(m3oodlleemnctat) rrmumono1oeenifeildfa ul(vp;(0aexnxf3iy1lmDranes t)srxoxrpoydal emnvsas) rrauronu4altomociyd aDem(vp u)trtnxo tytfaDr nvi;s  eumxm3ny4oltemfvil(fsrtr(m ;o1opeomfetlsls2el( snt4 lxoxr3ta1fmDrln s;t  rxmxm oodlm elnci s  rtau  ot4alxnioeiad mDrln s u) reoio iadla   i o ( texr(o3ou4apenliet tf 2uru oot1apxomf3iysfmDranvpnt4tltoio3todlp  au ol(0texmxm3oydam emncsl( arrm(mpou0tleoioetlt sDulnmp ()aeeoioctadfat  ues;t0 2xmxopnu1lme lieta(faDtrxmo;u0tlt mf3ilsfmDulumsnt) reoxo tytomtrai i t0s2trir nu4optnmiei t)s2uru  nt0olxnii3iatfaDem( p;u0alenmfcty1fmtrln s (0truoxo oo1lltnlnesat aDua(r ot0oeenifetasla2uauvont)artrmrcia1omDelnvo;s)t2umio ny4ll nmfcs t)arur(rpnu4oexn ictad aDeau ont4trxrircoodla elieilt) 2xrxo3oo1lp elnesl(fsDur(  nu4tpxnmf3iytfa2uanvsn(0texrif ia1oat  nvs;t0 ruoio3io4altemfcsa(faDumuro;o0tet  oetys a rm( s u0altrmrcoadlmD an il()trxmirpiydoleelfvilt  rum(rpoo0aexo iciyd m rau o ()artrif oydlp rlieo;s) eur(o3oo4ol n ict t) Dtmxr ou4tpx ifeiatfaDul(ms;u)arxnio iadfat  iei s) rxrxm3io4llt  fet t)aDur(mo;o4tle ioctyt aDeaumo t)tlxnmr oo1fpDean s s)t2xmxo3oydoltelfct t srra(mpoo4tlxomoetldfsDeaumpnu0tetriocoydfate neo s0s2xmio3oudame mnct t a2rm(  ou1opxo ieildls emu s;u)alermo oo1oat  i ols) eurxr3nu4opt mict t) 2umx  ;o0olenmociys a2uluvo ()alerir oydopDraivs;()teumxrpiy1om  livia(faDtr( ono1aet  i3iyt s em(mo;t4 eermr oy1lat ai i s s2trir oodamt lieslt)aDtrx o;t4tpeoifciltls rau p;()tltoir3tatom   ueilt)s2urim3nu1lmenlfci (fartau pou4aptomf3iadlaDrlu p;u4areoio3oo1fpteluvo ()sexo(m3oy1ll  mnvil(faDurxmpoo1ole mf3ild s2rmu s t4 ltomf3oydfaD ln ilt) 2urxmpny1ol e nctasfs2raumpnt0alt if3ild a2rmnms (0alenmr3ty1opD ai o t srxmxo ou4lpt lnctl(fsDrmu onu0aet mi3iatls2ea( s ()tlerio io1omteliei;t0trumio3ny1opeelfvi (f 2tmxm nu0alxnmi3iasfs el(vp (4tltnxf3ootlp elueo s)s2tmir3oydoptnlfvil(fa2rax pou1tpt micilsfa2emums t4altomo3io1fm   ieils srur(r ny4aleelivtat) rtm(mooo0opt  i3iys aDrmuvpnt4texrmf todfa eluesls) 2xo(r oudome  fvtltfs2rr(rpnu1openmociydfa2ulu p;()trxnircoodfatelivo s) rur(mpio1ol  mfvta(f 2uaurp;u4alxomociytfs ra( onu)aeeoio3iotla eaneo ( srumir3ny1ap n neil() 2tax pot1alxoif3tls sDumn p t4 ltrmf3iodoatrau sl(0t2toimpio1ole mfcil( s2tax pno0oex ifctlsfmDul( pnt4 reoir oa1om   nvsl( t2xrxmpoy1lp  mfct ( sDur(moou0tpe iietytfa2umuvp;(0treoxf tatfm  liei;(0 2uoiopiy1ol  lneias artrxr ;t1open i3iltlsDem( pnt)trenio ty1fptrlnvs;()s2uoxo3iy4lpee fcslt)arur( p;t4teto i3iatlmDulnvo (0 lxrmo ty1laDrli ils srxoio no4ap elicil( sDua(r ou1altn ieiydfa ra(vo;u4aetrif3oadoptr i o;s  rtrio3oudlmenmfviatfsDuaumpno1opeoifctytlmDelumon(0 etnmr3tatlpt auvil() 2tmimpoy4omt mieiltfaruaxro;t0tpen i3ildlm2rmu s;t) eerxo3oy1omt  ies;t)trxmim oy1al e nei sf 2urxmp;u4alxoif3tytfm2ea(vp;(0alerxfcoydfpD aneo t t2xoir oy1op elivtlt)arraur ot1tpx micildfs eauvo;(4 lerxr3iotlpD ai o;s trxm(rpoo1lp  mnetl(fa2truro;u0tlxoii3iyt m uln s (4 ltrif ta1lpDeanvilt0sexmxm io4om elfei ()s2uaur ;t0oeen f3tlt m2ua(ms;t)tlxnxo3iadomteanvs;()s2trim nodaptnlfcsas a2rmuro;o1tlenif3iysls2umuvs u)arxoxo tadop ean o s  2toxmpoy1lmeemivil( a2rrurp;t0apt if3iytla2ul( p t0 rxnir iadfpD aieo t srxrxo3oudomt  ici (  2tmurpoo1apxnio3tad m uluvsnu)aetrmo iy1faDran sls)trxr(o3iydomeelfvtasf rtmx pnu1tpenmf3iltfmDea( snu) lxrif3oo1fmDelnei t  rxmxm3oo4lltn ivs (farrru ono4opt ifctas mDranmont) renmf3totlmtr u ol()t2uoim nydlm nlnetlt  Dtau  ot1tlto feiys a2uaumpn(0 ltrir3oy1lpt  ivs t) 2xrio3no1apeelicsl()srtaur no4opto o3iatfa2rm( p;u0 lerxr ootfa elivi s) etoxr3iy4lmeemnvtasfarraxm nt1tpt ioeiytls2emu s t4tltoxocto1omDe nvi;t  etoio3oodalt liviat)arraxrp;t0texoif3tydfs2rl(vs;u0arerif oo1fp r neo t) 2xrirpoy1llte nesat srtruro;t1tpeomi3iytlm2uan pn()texoxr oytfpDeliei s0trxoir nydlleemfct (f rrmuroou4altniieiadfsDeln o;t0trenxocoa1fmt livolt)trxo(m3ny1lpe mncta()srurx  oo1tlxo fciyt s ul(vsnu)tltoio oytom r nei;(0 rxm(o3io1llen ncsl() rrrum ;t0tptn i3iydfs2elums;(4aeerio3iadomt lu i;t  rumiopnu4ll n nvi (fsrrmuro;t1oex mf3ilsfs2rmu s;(0artrxo tydfmt  uvils t2toim3nudlltelivsas s2rr(ro;t0oeen i3iyt aDulu s u0aeenxocoatfpD  neol( srxm(r3oy4lmeelicsls)artax ono4tltomociytlm2raumon()aexrxr oy1fp e i sl( seuoxo iy1amtn neilsfaDum(  no0ope mfcilt m rlnmsn(4 rxrxocoa1oatrlivilt0 2xo(opiu4al n nesat)sruau pou0olto f3tlt m rm( p;(4 lxnmo todlm elu slt0s2uoxmpnu4omen ietl(fs2rmuroou0openio3iyd m umnvs;u4tleomr3iatopD an i s  2urxopiu1ap nlicils)srtr(m no1tle  fciys a rlu s;t) lxoif oadfa r ueil(  eumim3iu4lmt lnes t) rrrxr ;t4olen octatlsDemnmon(0 rerifciytfm ean i s)trtm(r3ny4lm eliciat)s2rr(ro;t1alen ieiytlmDumums (4aexrmrciatla rluei (0 exoxm iydame mfvil( sDumxm no1oetn octlt a2raumo;()aleoif3io1fp rln s;() 2umimpny4opee feta(fs2rmumoot1opx mo3ild sDumu ont) exomf3todoa eaneo;(0trxrio ou1olt  fctls)sDrrumo;t4oleoiieiasla ranmp;t0aexnxociytlm raivo;s)t2tmir iydlpe  fct (fs2urxm oo1oltn feiad aDulnvonu0 lxnmf3oo1op ranvo;s)seuo(m ny4opt  nctlsfsrrr(  ou4tltoif3tatlm em(mo u0 eeoio3todoatrauvslt  rurio oodlpenmnciasfs2tax poo4olxn ociasla emu p t0teeoxf tatla eauvil(0sexrxm no1alt  fcsas srtaxmpot4oleoifeilslm uluvp () lenxoctydoa eaiei t)sexmxmpiu4llen fctlsf 2rm(rpnu0optoifeiasfs2ranvo;t0areniociy1lpDeai i;t)srtrim3nu1optnlictls)aDrr(mpnt4olen oeias s ranmonu0tlerif tydop rauvs (0t2tmiopny1op nmnvtltfarrm(m ;t1aetomiciydla2uanmo;u)tleomf oytom ean i;s)s2uoio3no4lptn ivtatfsrtr(mpnt0ole  ieiasfa ulnvpn(4 etrxr oatoptraies;s  rur(o3no1op  lnctat) Drrumont1tle ioeilsfs emnvo;()alxnmr3iatoate ivi () rxo(r3no1ol e icia(f rurum nt4tlxn iciaslmDua(mp;()arermo3iodfatr ieo;t)srxmio no4omee ncs s  Drrur ;t0tlxoif3tyd s eln s;t)arxnif3tatfptrai i s) 2umim3nudol nlfet s)s2trxr nt4tltomfciysfmDemums u0arxnir oo1lmt  nvs;t trxoxrpnodamenlncta( s2uaxmp;u0tpx  f3iytlm2uln o (0trxnirctadoa eli s;(0 2xoxrpiudal   ivias srrr(mpnt0oex mocilsfm2ua(mp;t0tlxoio3ia1late n s;s0t2xrirpiu1lmenmnet sfsrua( ono0opxn fciltlaDelu p u4 lerirciodfaDraieolt0 rtm(m3nu4amtnmnciltfarrmuroot0tex ioeild aDrmn o;u4 exrxrcia1fmDe neslt) 2umxo iodll n iei s  2ur(ro;o4olto feiydlsDrmuvsnt4 rxnxo3io1op raues (0texmxmpnudop e ivsasfs2ra(  nu0apeo fciad a2emnmon()trxrif iy1lmDrlieol() rxriopoy1omenlfct (fsDtrxmo;u0teen oeiadls ean sn(4 rtomf3oy1op raivo t) etmir3nydomt  fcsat  2rr( ooo4tle  oeiydla rln snu4trenmfciatfm eauei;t) euo(r oo1olenlfvsat)sDtmumo;u4opeoiietytfa2rmu pnt)artrmf tadfpteli s;(0trtmxo io1ame  ivtls srtau pno1tptnmicilslsDulnms;(0aetrmoctytfa rauvols  ruoxo3iy1lmte iesls a2taxm no1teto ocild mDrmuvpnt0tetnio3iadoa rlnvo ( texr(o oodomtn nvs t)arrmxmp;u0alt  ocilsfs2um(mp;()artnmr ta1fmDrauvs;s t2uoxo io1openmiesa(f rrr( pno1alxn fcilt a ea( pnt0artrifctytfm elnesls0srxr(o3oy1ape  neiasf Draxm nt1aeenmoctls m raums;t0arxnxr3tadoptrlivil(0t2uo(mpiy4lmeemiciltf Drrurp;u4opt mieiat aDemn p;u0texrxr3iydlmteliesl(  euoim3io1am emfviltf 2umxm ;t0tpxnif3tld s2uluvp (0 lerxocootlpDran s s) eumir3nudale mnetlsfarra( o;o4aee mi3iad a2elumo;t4 etrmf iydlp rau i (0 eum(m3ny4aptelfei t)s2umu ooo0aex ii3iltla2rl(ms (0trtrxrciydoptrln s t s2umxo3io4lmtemncsl(  2uaumo;t0tpe  ictat s ua(monu)arerir iadfmteaivo;s0sexrxr nu4omte nctasfsrra(m ;t1aeeomi3ilslmDran pn(0arxomo iotlm r ueil( s2ur(r3ny4lm nlieiatfarta(  oo0texo feildls rmnvpnt) lenxr3oodlpD  n o t  2xr(m3oo1ol emnvi ()srrrurpno0tpxn fetlt m2rau pnu)arxrif3tadomDe ivi (  2umxrpoo4omtnlict tfa2ra( ooo0opx mictas a2raumo;u4tltrxfctadopDrlneols0 2ur(m3iydamt  nvs s a2urx pnt0opxnmfciytfmDuauvsnt) eenmr to1fatrlivo (0 2trio nydolee nviasfaDtr(monu4oexoifciyd s2ul(mo u4 etoxr3ia1fptelnvo s  rum(m3ny1llee ieil()s2trxmp;o1oetn f3tys m2rm(vs;u) ltnmfcoadfmtelu i;s)truo(mpiydop  lictlsfs2ur( o;t4aptn ociysfmDrmump (0 reomf3oodomtrlu i ( srxrir3oodalenmncsat sDtr( p;t4tlxomoeiysla rlnmp;t4 rxoxfctytfa elnvs (0 2trim3oy1lpeelicia(  2rau p;u0tle mo3iysla2em(vpnu4teenif iadomteaueo;s)s2umiopiy4ape lfcsas)a2ua( o;o4alenmocilt sDrln pnt) etoir3tytlateaivi;() rumxo nu4lm  mfeils sDrmuront0alt mfeiad mDrl(mp ()tlerxo3ia1la  lu slt)srurir3oy1ap   nvil() rtaurpoo1tlx  o3iyslaDelnvp u0tlerxr todlm   ivolt0sexm(rpnodlme  ncil(f rtaum nt0texn o3tys s2rmnms ()arenmf3iy1la  auei;t)srtrim oy4lm e iesat  2urum ;o1tpenii3tldfa2el(ms;u4artrxfcoadfpteau i;()t2trxo iydap  mnct tfsrrrx ono1apxoioeiys s ea(vp;()aeerifcoadlateanvi s trxoir3nu1ol n nvsas) Dtaumpnu4opx mf3iysfs2rmumsnu0arxnmo3totop rln o;s)t2uo(m3nudopenmnvi () 2rmx  nu1aexnmi3iytfmDra(mo t)aleoioctodlat lu s;t0t2xrir3nydamt lfesl(f 2rm(  no4apeomiciyd m ua(mp;(4tltrif oo1lmDr i i;()teto(opoo1op  lneslt)aDuax pnt4aexo feiyslmDulnvp () rxnxocta1omteaivi t0setrirpnodlleelneilsf Drmxrpno4tptnmoctytfaDem(vo t) ltrmo oo1op   uvslt) rxmxr nudop  mncs s s2urxr ;t0aet  oeiatlsDem(ms;u4aeenxf tytoptr n s;s trxrxm3ny1op emfvtl(fs2uau  nu0texoiicildfaDum(mpnu) eerxf3totlmtr u o;s  rxmxm iu4lm elfvilsfsDtr(mono4texn iciatlmDul(vsnu4 eeoif todoptelieslt s2um(opnydal nmictas arrrurpno4olen ieiyt mDelu p;t)tlxnif3ia1optean i t)t2uo(r3no4op nlfcta(farra(ront0oetnmociatfm rlnvont0treomf3iotomtrlnei t0trumxm oo1ame lieiat)artm(mo;o4tptoifciysfs2um(vsnt0teenxocto1fpt  iei;s0trxmirpiodame lfeils artrxmo;u0oetomoeiasfs2ranvs;(0teerxo3iotfmDe ivs (0sexrxo ny1ole mfcil( s2ur(r ot0tex  feilsfsDumuvsnu4altrxf oatomtrlieil( trtm(m ny1lpe mfcs t)s2rrurono0aee  ietatls emnms t0aetnif tatlaDelnvi;t tetmxr oydaptn neil() 2rm( pnu1apxomoctyslsDumnmp u4texnxo3iy1oaDeai sls srxrxmpiodom n icia(farta(ronu4ole miciysfaDrl(monu4aeermf oadlaDeaieils)t2urxo3nudoltnmivsa(f Dta(  ;t0teto ieiysfmDrlnvp;u4tleoxf iatlp ranei;(0 exoxm3nydlmeelfei sfa2rm(rp;t4tpx mieils m2um( p;u)tltnmr ootlmDrlneo s texmxm ou4lp emieia()s2rrur ;t4oee  ietas s2ra( p;t0 ltoxo3iadoat auvsl()trtoxr3ny1aptemnvias) 2tr(mooo4optomocils a2umn s (0alxnmo3iodfaDr u i;s0tetmxr3iu4al e nvtl()sDtax  ou1tptnii3iatfm2rl(mo;(4tlerxo3tatomt  neol(0 exoir3ny4lmtnmici t  2trumono4apxnmf3iytla2umuvo (0texnxf iydom r n o;s  etrxm iodop nmfvs t) 2uau p;u0aleoiociadls2ul( o t)alxnir oytlatrlnei s0t2xmiopiudamt  fci sfsDtr(mpno1tleoifcias sDua( p;t4aeerxr iatoptrli il(  2uo(m3iudapeelfei ( sDtm(rpnt1ope mfeiyd m eluvo () eenxfciotoa elueslt0t2umxo3oydap  mnvtat) rrmxmp;o1texoiieiadla uauvo u0 exnifciadfpDr i i;t  2urxo3iy1olt lict (  rrru  no4tltn o3ildla2ulumpnu4 eeoxf iy1lpD lies ()t2ur(o3oudam nlivsls)sDraumpnu0oet  f3iydlaDrm(vp;(0arermf iy1fa rluvi s0 2xmxm3iy4op nlnct tfaDuru pno0tltn ictatlsDeluvo;(0 etnxfcoadlmDrlnvo;t) eurir iy1ame lnesat)a2ur(rpoo4opt mfciatfm rm(ms t0tlxomrctytfatrauvo;s seuo(r3iu1olt  fet s s2ua(  nu0opxomfciytla ranvo;u4trtnmo iodfp r uesl() 2xm(r3nydol n iviasf Dumurp;t4aex mociltfsDrl( snu)artrmr tydom  auvi (0t2tmxo nudllenmfeta(fsruax pnu0aexnifctad m2elnvonu0aetoxocoadlatrai i;(  rtoxm3io4omt lfvtl( s2tmx  ;t4apxn i3iys s2ra(vpnu)alenio oodoa ran i;s)sexrio oydol   fcs ( a2tauroou1oltnifetydla2eauvs;t) exnio oatlp r iesl()teto(r iu4llenlnvsl()a2raum ;o0aleomo3iyt aDea( p ()trxnxr3iotom ran o;()srtr(o io1llt lictl(fs2rm(m ;t1teenmf3iydlm2umumsnt)arxnxfctodfaDeluvo;s)s2xoxo3iu1opt mfcsasfarrr( pnt4apxomfciadfa eaumo;t)alerif3iadlateaueolt sexm(m ny1am n fvtlt)s2tr(moou0tpxnif3tysla2el( o;(0trenif3oytla   n sl( srxrxm ny4altelfvia(faruaxmonu4oeeo f3ildfm2emnmpnt4alxnxr todlaDeauvol( tetrxo ou4lle mncias)arumxmo;u4tex moeiyt mDea( p (4arxrxo iodfmte ies (  ruoxr oodamt mfvsat aDtrx p;u0aet iociytlm ulu pn()altnxf3oydfptelueo;s seur(r ou1opt  neilt a2uaum ;o1oeeniietldls uaump;t0alermf3iy1fa elu i t0setmxo3iy4alenlieslsfarrau pnu1aetn iciasfm2rl(vo;t)aeenxocio1lptrlieol()s2um(opou1lpenmict s)s2rr(monu0altoiieiat s rmuvo t4trxomr3ty1laDeanvo s  ruoxrpnydllt lnes (faDua( pnu1tptomociadfm rl( p;t)aetnxf3oadfmDr nei s0 2urio3iu1lpe mict s)artau pnt0oltomo3iatla elnmp;u4 etnxfcoa1op  aieols) exr(mpio1om nmncs ( sDtrxronu1alx  i3iytlsDrmnvsn(0 reoxrcoytlpDrlu o t s2tmio3nu1ll elfvslsf Dumxm ou0tpxnifciyslmDumnmp;t0tleoxocoodfmDeln i (0sexo(o3oudamt livi sfsDumumoot0tptomociys m emnvo t) rxnxo oa1oatr i o;s0srumio3oo4aleeliesat sDtrur nt0olenmociadfm el(mon(4artnxr iadopt lu i;s0s2umxr oy1altnmicia()aDurum no0oeeoiieiatfsDrau snu4alxrxoctatfpDe ueolt) 2xmxo3nydlptelivilsfsDua( pot0tetnioeiys m2rlnmo;(0aeerir io1lmDrlues;t0t2trim ou1lmte fcs s)s2um(rp;o0oeeoif3tatfa2ea( on()texrmocta1fat luvols)srtrim3no4ame lfesltf Dumx  ;o1tltnmi3iaslsDuaumon(4teermr tydlpDe ueols  etmxmpnydol e ictas  rrrumo;o1aee  o3tltlmDrln p;u4 etnxo3iotop rlueols0 etrirpiu1llt  nvsl(f rtm(mpot1opto o3tys mDemu s () lenmf3oydop   i s t teurxm iu1alenlieiat aDtmxr ;u1alxoif3iadfs2um(vsnu4altrmfctadopDr uvilt trxoim no4op   ivi t) Dtau o;t1aexn i3iyd s2ea(vo;()tlxrmf iatlpte nes;s0 rxm(m3nudam  mnei t)a2taum ;t1olt  ociltfa2em( p;u4 etniociatomDeauvi;t  2trxo3oo4lltnmnetat)a2umxm ;t4altnmoeiydfa2ul(mont0 rxnmrciytlaD anei;t0s2toxrpnydlme  iei s  2raxro;t0aetnio3tydlsDuauvs;t)arxrxf ootfaDelueo;t)s2um(r3ny4ame mfci sfsrrau pnt1aptnifctasfs2rl(vonu4tlenmf iydfatr nei ( t2umiopoy4apenmfes t) rtm(ront4ale  ieils s emuvpn(4 etrio3tatfp  lu s ()seumim3ny4lm  liesa(faDrr( onu4tet mfctasls rl(mo;t4trtrmr3iydoptraueo () 2tr(m iodlm  mnvilt  Draxmoot1apt mf3iaslmDemnmsnu)aexniocio1oa  aieolt  eumim3oodopen feias s2rmurpou4aeeo oeiltfm2ulu o ()tleniociydopDeau s;s  eurxo ny1omeelfvilt) rrmx oot4opto i3tyt s2rmn o;t4 ltomo3todfmtraues s0 2xoxmpiu1lltnlnet t  rra(rp;o1tltomf3iyt m rlu p t0tlenif3oa1fmDe i o;t)trtoxr3ou4oleemfes ( s2tmxmoot0teeomi3ias a2rlnvp;u4teeoif3to1fpteaneilt0truoxopiy4lmenmivt s sDtmum ot4oex moeiatfmDea(vo (4tleoxrcoatoaDranvil(0 rtm(o oy4ome miciasfa2uaxm ou1alen ociytlm el(vont0aexoxrctotoa eaneils0tetmxo nudolte nciatfsDraur nt1oexo ociltls rln s;()arxnif3oo1oate i o;s s2uo(m ou1ap  lfvt ()aDurxr no4tleo ociatla2rmumsn()teerxr3to1oa r ues;(0 rum(rpiu4am   ncia(  2tm(  ;t0tlx mfctysla rlnvp;(4alxnif iadlmDrlnvslt0srumxr3io1opeelfesl()s2tmx pou1aeenifeiasfs uanvp;u0trtrifctytomDrlivi;(0t2xo(opoo1alte nvi t  Dum( pnt1oex  ocildfs umnvp;u4 lxoir ty1op eaies;t srur(o oy4ap   nvtlt) 2tmx  no4oexnioetyt s rlu p;(4tlxrir oa1fa e n i;t srxmxopou4lpe lictas)s2trx ooo1alen f3tyslm2eau o;u4 ltrxf3oa1late u ilt0truo(o io1ol emnci t)s2tr(m oo4altnii3iyd mDra( o;(0arenxo oydlm r i o s teurxo iy1omeelicsl()a2umx  ou0aleoiociytfa2ulnvont)artrmr3iodoaDeluesl( t2xr(r ou4openlnvtlt  Drmumooo1ape  o3tldfm elnmsnu)texoirctodfpDeaivolt0 2xm(m3io1apt mnetls)arum(rpot1oexoii3tysla2um(monu) lxnxf tatlaDe iesl( sexrim iu1al  mnes (  Dtmxm ou4tee miciad s emums;t0trxomocia1omt  u s;s teur(mpoy1ap e nci s)a2ur(ro;u1tex mo3iasfm2emnmp t4 etnmf3tytoaD au o t  exmxm no4ap nmnetat  rra(rooo1oeto ieiltlmDeanvo t0arxnmf3oy1op rlnvolt) 2toim iudamt  iviat) 2rr(  ;t0oee  fctyslm2eanmo u0 rxrxr3oodoatr uei;()texmxmpoo1lmteliesa()aDrmuroot1oex ioetltls ea(vp (4alermo3oo1lpt auvslt0t2xmir no1lmte fes t s2tm(m oo4tlenifctat mDelu s t0 ltrxfcoa1lmte neo;( trumxm3io4lmeemfeiat)a2trumono0tpt moetysls rmumpn()alenmo oa1lmD anvs t)sexmir3ny1aptn ncs t) 2umx ono1aexo ictydla2ran s;t0teermf3iydfaDelueol(  etm(opiydlmt  ictls arrrxmo;o4opxn i3iytlmDemn p () etoiocoydlmD  i s;t trxmir oy1omtelivsas)a2ua(rooo1teeo o3iysla umu s ()texrxf3ta1lmDrai s;s)texrirpoy1llt  nvil() rrmuroou4tet ioctlt s el( pnt4trtnmr iydfmDe ueilt0 2xmxmpiodlpen ictlt) 2taxmpot4ope mi3iasfmDuau snt4trtrmocoadomtelieo (0trxrir ou1al n ivtl(  rua( p;o4ope iocilslm umn p;t) exnxfctodomD luvo s) rxo(m oodoptemncs ()s2uru  ou4optnii3iydla2rmu s;u0alxnif oadlaDe u s;(  rxo(r3ou1om emncsa()artm(moou4olx  fetytls2rlumo t) eenmf3iadfpt ln sl()t2umxopnu4amtnmnei ()srra(mpoo1alx iiciys a ulnmo;() rtoio3oo1faDrlueols  eur(m iodole liet ( sDtau pnt4aee mf3tyt a eanmo;t4aexrxf3iodfa e ues;() ruo(r3nu4olt lnvtas  Drru pnt0altnmfctatla em(mo;(4aexoxr3tydfaD  u s;s0trxmxr3iu1lltn fcsl( artr(mo;o4tptnmocildls2rlnmp;(0tetrxf ia1lmDeli i;t  rumxm nodope mncta(fsrua(mo;t0aet iiciydlaDum(vp t)aexrif iydoa r iesl()texrxr3oy1omenmieslt srraur nt0olen oeiasfsDumumpnu4trtoxr3tatopDranvi;s s2to(o iy1al emnvtas)sDua(rooo4ole mfciysls em( o;u0aleoxo3totlatelnvolt) etrxrpio4omt mnvsas) 2rr(r no0optn fetytlmDelumo t)treoxr3ta1fpt aieo;() exrxr3iydamtnlnvsasfaDtm(rpoo4aexn f3ilslm2ul( o;u4arenio oy1fpDelues ()s2uo(mpny4ome  fesl( aDtmum ;o4alen feilslsDrm(vpn(4arxoircty1lm  auesl(  exrxo3iudopt lneiat s2urx  ou0alto i3iltlsDrm(mon(0altnmrciy1fpt lu s t)trxmxm nudlpenlncilt arrrx ono0opeoifeiysfmDrlnms;u)arxrmf oodoa elneo t)teuoxopnodlme  fvtltfsruaur ot4opeo ociad a elu pnt4 eeoxfciadfmt lu sl(0srxm(r3nu1op nlnet s)artrur ;t0tpe moeilsfmDua(vs;t0 reomrcty1laDr neo ()s2um(o oydape  ict tf rumxmonu4oexn f3tysfsDelnvp ()tltoir3totoa  li s;s0trxmir ny4lmte fctl()srua(mp;o1oexnmi3ilsfaDemnvpnu0 eenmf ta1lmD lieo t) exoxm3ny1lp n ietl( aDraur ;t0optnifciasfa2ulumo u4aetnirciytopt ln olt  2ur(m ny4apt  nctls  Dumu o;t1ape mfeiytla um( s u) renxrcta1lat  iei;()truo(rpiudamee iei (f Dum(rpno0olxn oeiyslm rm(vo;(4altniocty1opt  ieils0truoxm3io4oltnmncia(fs2um(rp;u1tpx mocild a2eau p u0 rxrmr ootfmD lnvo () etoxopnodap nmiet ( s2ururoot4olxoiieiadla ulnvsnt)tltoxfciytlmDeau s;(0s2trio iu1ole mfetls s2tmxronu1openiociltfa rluvs t)aetomfcoytfate uei s0 rtoio nudlp   fetlt aDrauronu4ale  ieiys a um(ms;(4 etrxo iy1lm e ieo;s  2uoxo iodlmt mictls) 2rau o;t0aee iociys mDrl(vpnt)teerir ootomtrai ol(  2uo(m nu1ale  iesls arrrxm ;t1aexoioeiad a2ul(vp (0tltnxociy1fmteauei s0 rumim no1ap  mfcils)arrmumonu0opt  i3tysls rmnmo u)trermr3iodlat  uvsls)tetm(m3oo4lp nmieia(fsDta(mpot1oeenii3iydfa2rln o;t) lxrxo3oodfaD lnvi () 2urxm ny1op   feiasfsrta(mooo0olt iociydls2um(vo () rxomr3ty1fateai slt)teurxmpiy4apenmfvtl()sDrm(rpno0tleoiocilt s eluvpnt4 ltnmrciatla elnei ( t2xrxrpnu4alee fvsls aruaxrpnt4tpe io3iad s2elu p;t)arenxf oydfmt lu il(0s2xm(m3oodop  mnes t  2taumont4aeto fciytfmDelnmpnt0trxrmo3tydlaDr nei;(0setmxopoodapt lfvia() rrmurp;o0alxnmf3iltfsDuln o u4arxomrcoy1lmD  uesl( t2to(m iy1lle mfcils sDrrx onu4olt moetldfs ulu o u4trtrir oodlpDraivsls s2trio nodaltnmncs tfa2trxrpno0ale mictydfa2eau s (4trtrxocio1op r ies;s0sexoio iudlmte feil(  Duax ooo1tlxnioeiatfm rm( p ()texnxrctadfmtranvi t0 2tm(r no4om nlncil(fsDuru pot4tpeomfctasfsDrlumonu)arxrif3iotfa  anei;s trxoxr3oudopen feiltf 2rm(m nu0ole ifctydfmDelnvo t0 lxnircoodfm eau o s0trxoir no1ll elivtas) rtm( pno1alxoif3tadlmDuau onu)aeeomo3iy1fp   ivo s0seum(rpiydlpenmfctls s2umu poo1oleomf3ilsfa2emuvp;u0tlxrmf iotlp e uvo (0t2xmxm3oo4amtnlneilt  2rau pou0aex moeiadlm emnvonu0arxomoctotoa r n o t)s2um(mpio1lmte fciat)s2tmu  ;t0oee  fciysls um( s u) ltnioctydomteau s ()setr(m3oodapee nei (fs2rr(rooo0tltomf3ildls elnvs ()aexoxf3iodlpD an i (0t2tm(r3ny4lmt  icsa() Dtrx pnt4aexnmi3iadfa rmn o;t0 etoxo3iatfp  lnvs;t0sruo(o3nudlmtnmivsls)arrm(m ou0apeo o3tytfm rmuvo u4aexrmo3ia1fmDrluvo;s0 etrxmpoodlpe  nvilt  ruaur ou4olto f3ild s rmu snt0 rerircoadla eli o;(0trtrxrpno4lp elneia(farumx pno4oet iociydls2rmumo (0aeeoxf iydom rlneolt0srumim io1lle lfcs sf Dur( ono1alxnif3iyd m ean pn(0tetnxo3tadoa e n ol( texrxo3nydopeemiei s)artrxm ou0tet ifeiys s uan s (4trtrif3oy1opD lu ilt) rurim3iu4ame lictas sDtrurono4tet  feiltfs2umuvp;()aeerxf ty1fm e n o s texoxm3oydamen nvs tfa2umx ono4olen fcildla2umumont)alxrxf oo1la   ivilt0teurir3nu4am e ivsls) Drrxronu4optnifctysfs uan snt) exnmo3oydoa   u i;t) etoxr oudolt mnes s  Dum(mpot1tptnif3tysfs emn onu0tetnio iytomte ieols s2tmxo3oudamtemnvil(fs2ur(m ;t0opx  ociadfsDrauvp;(0altnir ootlp  lnvi t  ruoxm3iu1ll nlivslt  rrmxm ;t0tex  o3iysfmDem(mo u0artoxoctydfaD  u o;s0 rxm(opou4oleelieils)arrm(m no1oee iietas m2ra(ms;u4teenmoctatop  ai o t0 2trxo3io4lpte fct () Dtrum ot4aptnmf3iytls2rm( pnu0arenmfciotlmt aivil(  rxmimpnudal nmfeslt) Dtaump;u0aeen f3tydfs ra(vo;t0tltnioctotlptrlneil( trxmio nodapt lneiat)sDurxm ;u0tpe ii3iadfs ulnvo (4altrir oadomD  iei;t texmio3nu1amt lncs ( s2umum no0openioeiyt mDrmnmp u0 rxnxf oa1lm r uvs;t)sexo(rpno1lm emictls  rrmumpnt1ape miciltfs ranmp (4areoif3io1fpt livo s)sexmir3io4llenmfcs s  rrmumooo4tlt mfeias s uanmont)tltnio ootfmt anvi;( t2uoim iu4lp n ict t  Drrx  oo1aex iieiatfa em(vp;() rtomo tadop e uvol( t2xoir3oy1lleemnesl()artrum ;t4opxoifeils m ul(vp;t) eeoxf3totfm eaiei s  rxoxmpoy4altnlivtasf Duaxm ot4tpeomfciys sDel( o;t)alenxfciydopDe ues () 2tmxr3iy4aleemics ( aDum(mp;u0ale mictldfm ulnmp;u4aexrxf3tatomteai i () eumxm nodopeemici (fsrtmum ot0oet iiciydfs eauvp t4 ltrir oo1faDeanesl()setoxr iu4om  lnctl(fa2uauro;o1tptoiociaslsDum(mp ()tltomfciodfpDe u sl(0 2trir ny1apenmies (f rumx  ;u0aee mictad mDrlumo;t)aetnxo iy1la ean slt0teum(o nydlltemieilsf 2rmumoot4alt moeild a uanvo;t4 rxrir3oadfp  aivo;()t2xoxr ny1lmtn nvi ()sDtrx pnt1apeomociltlm2rlnmp t)treoif3ty1laDrlivs;() etmxo oy4lltn ics s  Duaumpou0oexoiieiyd m2uaums;(4alxrxr3iytop  li i t)sexmxr oy1ol  mneiatfsDtmu poo4tlx ifeiasfa uluvsnt0 renmf iatfa e ivs;(0srum(mpio4lme  ivs sfsDrru o;t1alxo feiat m2eanmsnu4 lenmf3ia1fa r u i;t trtoxrpoudam elivtat a2rrumoot1opxoioeiadfs2rl( snt)aexrxo iotfmDr nvols teuo(rpiu1lpenmncsa( srtaxrpoo4teeniocildlsDuln o t0 etomo3totfmtrlnes t0s2xmir3ny1lmen fei s)sruau poo0tlx ioeilslm2uau p;t4tlxomfciatop e uvs (0 ruo(rpnydlpee ict tfs2ur( pnt4tleomoeiatfmDel( p u) rxomo to1fmtrauvi s0 rum(o3nodoltn ieilsf Duaxmpou0ope  fctlt m2em( o;()tetomr3iodlpte ieol()srumio oy4lmen iesat)s2tr(rpou0tptnifciltls2umumpnt0tetoxf3ia1fpt  nvs s s2tmxo no1opt  fei (farua(r ;o4aptnio3iltfs eln p (0altrmoctadfpt lieo t)srurxrpou4op e fvs s)sDrmxmo;o4oeeniieiydfs rmn snt0 ltrmo3iodom elivo;() 2toxmpnydamen nvslsfs2rm(  oo1aexomiciasls2em(vs;t)tetrxoctydoatr neilt0srxmxr nodame lfviat)aDtm( ooo4tle mfeiysfsDem(vp t0 eenxr3oatoa  anvi t0 2toio nydlme  fci t a2rm(rpnu1oee if3iltla ua(vs;()altrif3iytla rluvs;s0sruoxmpiy1aptelnvta()a2tm(mo;u0ape  f3tadls2umuvp (0 rxrmocia1fm  li i t0s2xr(o3ny1lp   ies s)aDurxrpou4oleomo3tytfa2ua(mpnu0 etoifctadlmDeli il( trurirpiy1lp n nciat  ruau o;u4alxnmfeiasfaDel(monu4trxrifciotom   u il() exr(mpnu1lpenliei t  rtm(  nu1aeenmiciyt mDrln onu4 exnirciydlaDr uvi s  2toxmpny1omtelnvslt s2rrxm nt1tleomoetltlsDrln p;t4aetnif to1omDrli i t) rtrxm io4ol   fcil()sDtr(ront4teen fciytlm elnmont4 etrxr3oadlpt lnvs s) rtr(rpny1lp  mnetas) 2tm(m no0tpeoiiciaslm2rau p (0artriocoy1fmD  u ols0 2xr(r iydaltnmnetat)s2tmxrpou0oet moctyt m uan pnt0artnmfcoa1fmDran olt)srxo(rpou1omt miesl()srurxm no1apx  feiadls2uan s;u0 eerxrctodomD luvs s s2xm(opnu1apte fviltfs2rrxm ;t0tlx ifciytlsDumnvs;()arenmr3oadlaD  ies;( s2uoim nydlm  livs s)s2rr(mp;o0oee ifeils s ranmpnu4texoxo iodlp rli o (  ruoio3iu1lmtelnci s aDrrx o;o0tlxo oeildfm2rl(vont4teenif oytlpD luvi;( s2xmxr oydomtnmict s srtmxmoot4tee  o3iyd aDrm( pn(4tltrmo3tatoatranes;t) 2tmiopnudap  mfcs tfsDtaxmp;u4alt  i3ilt sDemn onu4tlerir3oytomDeau i t0trto(rpio1llt liet (fs2uau  ot1tee  f3tysfsDran o u4 eeomr ia1opte nvo;t0teumxr oo4om  lnes sfsDrrum ou4apxnio3iydla rm( snu0alxnmr iy1lpD lu o s)trxmio no4lptnlnvias) rurxrp;t1tpxniocild a emnmsnt4aetoxf tytla  lu o ( s2xrir3no4lpe  ivtlt aDrm( p;o0alt io3ildfm2ulu p;u) rxrmf iydla elueols0teumio3nu4opt mnvils srrrxr ot1tltoiieiysla2ulnvont)alxomf3io1fm   nei;s)t2tmxm iy1ol n feils a2rmxmpnu4oexn f3ilslaDul( s (0 lxoio3iodla e ivsl() 2xmimpiy1ll  mneslt arurxmpno1alx  i3tytfa el(vs (4teeoxrciy1lmDrlnvol(0 rtmiopiodaltelivsasf 2umx ono4altoioeiytlm rm(ms;t0texrmf oy1fpD  n i (0 rxr(o3io4ap   fvsasfartax  oo1aetnmf3ilsla rlu s;u4 reoir3iadopDr i ol(  rtmio oo1ap e fvi t artmur oo0altnmi3iys aDrl( o;(0aexrxr3totlm rlieo ( s2tr(m nudom emiesa() rrmxrp;o4oeenmictat m eanmo;()aeenirciytlptelnei s)tetmxrpoy4opee iesatfa2rmu  oo0oexoif3iatlsDelu pnu) lxrmoctodla rlu il()texmxrpiodlm n iesltfa2tau  no4alxnmfciys a2rlnmpnu) ltoxr3oy1oat auei;t trtoirpiodopt  fei s)a2ua(mpot1ape iictydlsDrmn pn(0aeenxf oydfpDr ieil() 2xrxrpnu4optnmfcs sf rtrxmpoo1olt ioeias s2umuvpn(4artomo3oadfp r n i;t0trxoio iu4am   ncsls  2umxrooo0ape iieiys sDel(mp;(0 rxnxocto1oa  ln s;( sruoxo no4amt  ncil( srumumpnt4alt io3iasfaDeanvs t)trtnxo oodfpt lu s;t0t2trxr iodlp emivias)aDumxmo;t1aetnmo3ildla2rauvpn(0arxoxr iytfmte n i;t  etmxr nodlmenmnvias) 2rr(rp;u1openmieilt a2rmnvo;(0arenif ta1omD  uvo;(  eurir no1om  mneslt) Dur(ro;t0aetnmiciltls2rl( o;t0 leomociatfpD aiei;(  exmxm3ou4omtn net ()a2rr(mo;t4teenio3iltfaDea(ms u0 eerxr3iodfpteluvils0 rur(r3oodalte fvia( aDrm( o;o4tpxn f3iysfm2eanvsn(4aetomfcty1lpD  ivs;t0s2xrxmpoy1omtnmncs (  2rrum nu0aleomfeiys m elums;u)arxoif totfpDrlu s;(0texo(r3iu1om emiesat aDumu  ;t1tleoif3iad a2rm(vp;u)tltoxfcoatfp  aivs s0trtrim3ny1amtnlfes sfs2tru  ;t4tlto fetldls raump;(0teerxr3iydfpt lneo ()s2urim3iu1ap n iesasf Draum ou0altn feiydfaDraump;(4areoxf3tydlatrli sl()srumim3oy4am emivilt aDrmurpnt1apt if3ildlm2el(msnu0altnxo ty1fa rlivo (0teumio nu1altemies s)a2tmxronu0oexomo3iytlmDrmu p u)tetnxr tadoa eauvo;s0s2xoxm3iy1op elnvsasfs2trx ooo4oetoiietyt mDuauvo;t0texoxo iytfmDeaueo t0 2tr(opnodop  lictlsfarrmu pot1altnii3iadlaDemnvo;(0artrxfcia1oa elu ilt  eurxr3iydaleelfvt (f 2ra(ro;o4oleoiiciaslm2rln pnt0teenmo3oa1omDr n o (0trurxo3ou1ome  ivi tfaDtm(rooo0tex if3iysfaDrlnvo u0 ltnxo3oadomtean i ()teumxopnudlptemfet ()s2um(r no0oeenifeiltls2elnmo (0arenirctytfmDrlu o s  rtoxopiudol nmnvsa(fartmuronu1aexnmf3ildfm umu s;(0aexoxf3oadoa r nei;s  2ur(r ou4al   ici (fsrurxrpou4aet  i3ilslsDranvp u0alxomo3oodom   ivs t0t2uoxr3iodlltelivtat) rtm(monu4tetn ociat aDemn p u0 etrxo3todopDraivo t  rumimpnodlme  neilt  2rmx ono4oeenioetys aDumnmp (0texrmrctodomDelneils0srtoxm3iu4alee fei s  2um( o;o1olt iociysfa el(ms t0tetoir tytlm  an i s)teumxmpiydap elncs sfsDrrxmp;u0tltn o3taslm2uan s (4aexrmrctatlatrau ilt) 2toim nudll   fvs (fsruaxm nu0aexoif3tytla2rmu o u4 exrioctadoateli i s)s2xrxr3iy4ll  mfcsas arurxr ;t1tpxo i3iadlm2eaums u)tltrio3ia1laD lnes;s srxmirpnu1ll  mietltfa2umx ooo1aet  ietas aDuanmonu0 leoxr iadopDeai i;t trumio3iy4lp elnvi s)a2rr( pnt0apenioetatfsDrlu s;()tleoioctadopDraieil() exr(mpiu1opee ietl(faDtrxrp;o4opx ifciat s uan pnt) eenif to1op  li o;( s2tmiopny4olen ieils) Dra( ono4ope mociyslaDumnvp (0tlxoxfcoydoa  aiei;t0srxm(r3iudolt lnctltfsrrmx p;u4olxnmo3iasla emumpnu0 rxomr3ia1lp eanvo s) rtm(r oy1olen ici (f 2tax  nt1texn fctasfsDeau pn(4treoxo3ta1fm   nvi t0trtm(mpoudomt licilt) Dtr(mpnu1tet mf3tadla emn p t4 rtrxfctytfaD  ieo t)s2xmxo oudlpe lictls s2rrxmono4tlx iocilt s uauvp;t0 eeoiocoy1faDelnes;s)setrio oo1olenmncilsfarua(ront1oexo fciasfs2ea(msnt) etnir3totopteli o;s0 rumir3nu1ll n iet (  rta( pno0alx ioeilsfs uauvs;(4 rermo tydlpD lneolt0srum(o3iu4ome  ncsl( srtaxrpno0tpeniicilt s uaumo t)artoirciytfmD anvo;s)teurxr nu1al nmfctltfs2rrxrpoo1teeomiciadlm em(vont0artrio3tydomt au i;s0 eto(r nydlm n ncilt  2ra(rp;u1aetoiietytlaDuluvs (0tleoiocta1fatelivi;t0t2tm(m3io1lpt  nei (fs2ra( pnu4aptnio3iadlm rmnmonu4 ltoxo3iy1lp e u i;t  eto(r3oo4ap n net ( s2urumoot1tltn octltls2ulnmp;(0trxrioctatfm eaivil()srxr(mpoy4aptnlfct s  2uau  ou1olx  fciat m ra(vs;u0artoif iydopD ai i (0t2uoxo iu4ome mieslsf 2tmuroou1texnif3tytfsDra(vp t0tltrif3ty1fmt lnvi;t srumxo nydlp emncilsfsDrrxmpnt0tpt ifciaslaDuan pnu)tetrmfciadfmtrlnei t)srtr(opio4lp elieta()s2umxr ;o1opt mfctasfs2umumo;u0aexnxr3oydlmtrli sl()setoir3iu4lmeemnetl(f 2ua( p;t0aptomoeiadfa2umums u) lxrio totfa elues;t  eumxo nodoltelfvslsf Dtmu  nt1oexo o3ilsfs2em(mp t4trtrxf oy1faD  i o s0texmir3iy4altn fcsa()sDtmx  ou1oeeomoetld mDeau s t0 eerio3totop elu s;s0 rtm(mpiu4lpe lict t srrm(m ;u4aexomociadls2rl(ms;t) ltoio oo1fm e ivolt0 rxmio oy1omee icias) rtr(moou1aetnmo3iydfa2ul( s;t) rxrir tadfm rluvsls0trxrimpoydam nmnvi tfarum( o;o1oeenifciytfa rmnmo;u)trtoif3totlatelu o;s)srxr(o ny1ll  mneil(f Draxm ;t4teto feilsfaDua(vo;(4alerxocoo1lmt livilt  2urxm nu4lmen fviltfsDrr(  oo0tpxn f3tlslm rlu ont4aetrmo tydlmDrlnvi;t  2xrim io4amt mfvsat) 2umumpou4tetomoeiytlm2ran p u0 rxrxrcoatlpDr uvs s t2umirpoydalenlnet () Dtmu pnt1tlxn ietatfa umuvo u) eeoxo3iotlptelu ol( s2xrio nydom  lnvsas sDrmumpoo4opto fciadlm2rmu p;t) eeomrctadoa elies;()seumir3ou4opeelict sfaDurum oo4aptnmi3tysla eanmsnt4 lxoiocoodomt li o;t trtm(o3nu4lltnlnci t)srrr(mont4aex  f3iydfmDrau o t) rxrmfcoadom  lu sl()t2tr(r iy4omen ietl( srtmx  nu4oeenif3tls a2um(msnt4aleoxrciodfate nes;t trur(rpno1opeemnet s) rtaxr ou1tetnioetysls2uaums (0teerxf oytfa   ivo t)t2um(r oudoptn nviatfsruau p;t4tpxo octydlm ranvp;(0tltoio3iadomDeli o;(0t2xr(r oodom emiesa( aDtm(mpoo0opxoioeiatfm rau p t0 exoxf ta1omDe uvo;t0 exr(r3oo1amte nct s)srtmxm ou4oltn fcilt m rauvon(4trtnxo tadoptr neslt)trtrxm3no4oltnlfvsas  Dtrxmpnt1oleo o3tldfs rlumsn(4 exnxf3iytlmDeau sl() rum(r3iu1ol nlfct t arrrx p;t0tee iiciydfa elnvp;u0 leoif iodla rliei;t  rur(opny1lmt  ivtatfaDtr(  oo4openifetyslm2eauvp;()alenxrciydlmD lnvsl() rxo(o nydaltnmncs t sDraur ;u1oee  ietldfs rl( o (4trtrir io1fa r n sls) rtoim nudamenmfct s a2uaxmp;t1tpxn ietytfm2umn o ()aexnmr3iadom ranvo t)tetm(m iy1lptnmncta( aDurump;o4aptomociyslm2uanvon(0tetnmocto1lp e ivo (0srxoio3no4lltelfvta(f 2taumpnu4texn o3iad s2rm(vs;u4aeerxr oatlp raieilt) rxrxmpio4omtnmfeiat) rua(mo;o4ole iieils mDulnvs u) rerxfcoodoa rai ils seuoimpiy1lp  livsatfarrmxr ot4alt  fcilslmDemnvpn(4areoifctatomD au i t0s2uo(opoodapee nes s sDuaurpno1ale moeiyslmDeluvo t0trtrio3iadopD  uvols  etoim iu4apenlnetls)srtr(monu4aexoif3iatfa ua(vo;(0 rtnxo3tytfmDe ivilt trxoimpoo4amee nvi tfaDrr( pnu1teen iciyt m emnmpnu0arxrxf tydfateln sls)s2xriopoy1apeelfvs ()artaur nu4tee mi3iad a ea(vp u)trxoxr oytlm r n ols  2uo(m3nodol e fes ( a2raumooo1aexnifetatfm emumonu4alxnmfciotoaDr u ol(  2uo(m3iy4am n fvias srtm(m ou0aee ioctasfs2rmuvo;t0 exrif oa1fmDr neo;t0srxoxmpnu4aleelfct t)a2uaxr oo4oeenmfetyt mDean snu4trxnxr oytoptelivsl( srtm(m3iu4lpenmnvtl( arrmxrono4apx iietls s2em(mp;u4 rtoxo3oytopteai s (0teto(mpiudamte ivsat  Drr(mpoo4texn i3tydla um(vo u)tetnxf3oy1fmt  uvi;t)srxr(o oydaptemnctlt)aDrm( pno1oexomfciad s2eln p;u0teerxo3tadlptrauei t  rtoxrpio4lp  lict t s2ur( pnt1tpxnmietadfa2ulnvpnu0tetoir oodomtraiesls  eumim oydale  neil()arumu  ot4oleo o3iasla2rl(ms u4 rxoir oa1fa rlnes t0 rxoxr3no1opt lfei (f rrrurpnt1oex mi3iyslaDumnmp;() rerio3oydoa r uvsls0 rxm(o ny4al nlnci s  Durxrooo0optnifeiatfm ra(mpn(0 etoxfciydfmt an s s tetm(m oodamt  nesa()aDur(mpot4texoif3tld s2rlnmp;(0tltnir3tydlaD lnes t0trxoxr3oy1lm elfei s) 2ra(mpnt4tltomi3iadlmDuluvsn(0tetnmf3tydfpD  ivi;s) ruoxm3nudape  ict sf rtru p;t0olen ieiatfs raump;u4aleomo iy1oa  ln i;s)seuo(rpoydomtelfcil( artax oot0alto f3iad a emu o;()alxnmocty1lptr ieo;s srur(r no4lmenlnvtas)s2urxronu0oeeoiieiltlmDumn s u0trxrio3oodlpD lnvs (  2tmimpou1amte fcil(fartr(ront4altn fciadlaDulu onu0teenxrcoa1fpDraivils s2ur(opny1om nmfciatfsrrmx  oo4teto oetld m ua(msn(0arxnxo3oodoatraiei s)seurxr3ny4lmeemieilt)aDtrxmp;u1oex  ictysfmDeau s;u0tltrxo3ootoptrlueo;(0 2uoiopoodllt mivsls  Dtmu onu1aleoiiciatla2um( s;()aeenxrcoadfmte n o;s) ruoimpnu1apen nctas  Dtr(rpnu1olxo oeiydlmDumu snt4alerxociy1latran olt)trxoxmpio1ole  feta()aDrrxro;t4optn ieildls eanvo;u4 lxnxf3iytfp  an i t srtoim3no4ll  mncilsfs2urur ou0tlxo f3iadfaDumnms;u)tetrmr iytfpt anes s) eum(o3oo1ope  ictasfaDrax  ou4tptoiieildla rlu s (0trenmfcoy1fpDe nvi ( s2umxm ny1lpte net t)sDra( o;o4apto o3iysfaDem(monu4artrio iydopDe iei;()teuo(rpiy1am  lfes s  2tau pou0apt if3ildlsDumu pnu)texrmrcta1late nei;t sexmxrpiudomtnmieta(f rurx o;u4oexnmfeiytla2rmn p t0aeeomr iotlmtrauvs;t s2xo(o3oy1ap   ieta( s2tmxmpou1tlx  fciysfa emu s (4tleoxo oy1fp   n i;s sexmxopnu1lme  ieil(f rum(m no0tpeo fetlsls2eanvp (0 etnxr3iytop  lnvi;t) rtr(m3oo4om nlnci ()arraxr ;t4olxomfeiadla rl( o u4arenmo3oytop r i il()t2urxopoudalen fvtatf 2uaumont4tlx mictadla2eanmp;u0teermr3oa1omtelieo s)setriopoydamtn ieta(f Dtr(root1altnifetat a umn pnu)texrir3ia1laD  ies (0t2uoimpiodalenlnvs s  2rau pnu4olxoifciyd m2rm( pnt)altoxf iy1om   ies s  rtrxm ny4altnlfeils sDrm(  nt4tlenmieiasfm em(ms;t4 etoxf3ia1fmtelnes;()trxo(r no1ame mnvtasfs2rm(ro;o0tlt ifctlt sDumu p;t4 leniocoo1om eln o s trumxrpnydoptn iet tf Dtrxr ot0tptomociltlaDea( o ()aexomf oatfp  lnes s0t2urxr oo4op  micsasfs2taxro;t1aeeomfciadfm2el(vpn(4alxnir iadla  li s;s)trxoxmpnydlptemfvta( arumxr ;u0aexnioeilsfm2ea(vo;u0trxnif3oydoa r n s t srtrir3iu4apt mnei tfs2raumpnu4aex mo3iyd a ul( pnu0 leomf3iadoptrliei t  2tmiopou4alt  netlt  2um(mo;u4tet mfcildls2ua( p ()arerxf oytopt ai olt)srxoimpiy1apeelnctl(fa2tm(  ;o4oltn icilsfa2uanmp t4tlxrmoctotlp  li s (  etoio ou1opte fei ( a2uaxr ou4tltomi3iydla2ul(ms t4tltrxf3iodopDrln olt sexo(o oy1lpe mfcsasf Dtmxr oo1apxoifciadfaDumu ont4areomf iy1faDrauei;t)t2tmxm3no4olenmfci (fsDtr(ront1olx iietaslsDra( snu) eeoiociadfpteaivol()s2urio3io4op n nvs ( artm(mpoo4alen fciatlm2ul(vs (4alerir to1fpteaiesls)trumiopno4apenmivsatfsrtruro;t4apt micildfaDua(mo;t4arenir to1la  ai o;s s2uo(o3io1lm emfvi sf rurur ;u0olx ifeiysls2rmumpnt4 eerir tydomDeli sls0s2umxo3iy1op emfeilt  2tmum ot1oet mociysfs2ran p (0teeniocootoaD livs;t  rxmim oo1alt liei s  2raxrooo1tet  i3iadls rmums;t0aeerxf3ia1fmtranvs;t)srurxo oy1om elfcslt)srrauroot1tpxo ieiad s ra(ms (0 rtrxf ty1oaDeluvs;s)srtmirpou1olenmnvt sfsDumxmo;o1oleoiociyd mDrl(ms u4 lxriocoytfate ues;(  exo(r iodlmenmnet (  rrax ooo4alx if3iyt m elu o;t0artoircootla e ivil() etm(m3iy4lptelncsl(f rtaxr nt1optn feiyt aDeln p;() leoio3iy1fm r i ol(0trxrxr iy4oltnlfcslt  2rm(moot0tle  fetyd s ra( pn(4trxoxr oadoaD li o (0srurxm3io4amtelfci (faDuaur nu1tpt  ociaslsDrmu s;u0altnir3oytfpDe ues t0t2trxr3ou1op  livias srtaum oo1olx io3iydlaDuan s (4aexrmr3ta1lp eli slt)t2xrxrpnu1al  mfcs (fsDrmxr nu0apx mieiysls2ra( pnt)aeerxrcto1faD an i (0t2toxm3oy1om elnei t) Dumxmp;t0ape if3tytfaDulu p u)arerxrcoatlmDeaueo (0setoxm ou1apee ivsas s2uaum nt4oexoiiciad sDranmo;t0 exrmoctatlm rau o;s  rtoxo ou4apte ncs ()arrrxrono4apxomo3tatfm2emnms;() ltnmo iadoptraieolt srxoir iy1lmtelneilt)a2rmum nt4tpx  ocildlsDemuvo;(4areomo tatfpt  neo t0 2trimpno4omte iet s)srrmum oo4oexo oeilsfa um(vpnu)arxoir3oa1lpt luei;(0s2xo(m3oodalte ivsat sDrm(m ;u4ole mfeiyslm ea(vs u)arxomf3iatfpDrlnes;t0 exmxr nudome  fetl(fsrrmur ;o1olt moeiltls2uaump;() rerxfciadlmtran i;t0trtr(rpou4ll nlnvi ( s2rr(rooo0texnmoeild s2rauvo (0artoxr3totla   i o (0 eurio3iydole mnvilt  Dtrx  oo0tltnmo3iltfaDumu pn(0tlxriocta1fp eau o () rtmimpiudopen icsa(fsrrmx pnt0tpeoif3taslm2ulums ()alxnxociydfm e ivol() rxr(r no4lp  mivtasf Dum(mpot0teeoiietltlmDrau p;()tltoio3todfpDelnes s t2umiopoo1lmenmictltfs2tr(  ot1aleoifetld a2eaums;(0aeermfciatomDrluvi;( texoirpoy1lpeemfetls)sDraxro;o0opeomf3iltfs ra( ont0trenif3tytopt  ues;s0 2uo(o3io4lmt lfcsas)sDtmxrpnu1tpxnmi3ildlm2rl(vpn() lerir3oadlpDeai slt) ruoxm3nydamtnlnes ()a2umxmpoo4opto iciyt sDean pnt4aexrmo3io1opDean i (0s2xmxr3nu1ole lnvtat) 2ta( p;o1tltnmi3tysfsDua(mp u)tetnmo oa1fatraueol(  rxmxopiudoptn feslt)srurxroot0tltnif3tyslm eau o;t4alerxf oy1fmD  ivi;( sruo(r ny4olee ieslt)arta(moou0opxnmo3iasfs rlnmo u4alermf3ootopt lneil( s2xrir3no1al nlfeiltfaDrmxmont1oexo ieiatlaDemuvs;t) rtomocoydla   uvsl(0 2xmxopny4llte net (farur( o;t4oexo o3iadlmDua( p u0alxnio3to1omDr iei s  2tr(o nudlmt lfcsa(f 2rr(m ot1teeomociydlsDuln p;() eerxoctotlmDrlivs;(0texoxm nu1ape  ncil() 2tr( ooo1teeomiciadls2emuvs;t)tetniociotomte nvo (0trxmxrpou4aptelfcias) rur(r oo0aex mo3taslsDea( s;(0arxoir oodoat anes;s) ruo(o3nydllenlfcsas srta( p;u0aetniociyslm2ra(mpnt)arerif3todfaDe u o (  euoxr3oo4ap   fvtl()sruaumono1ope if3tatla elnvsn(0trxoxrcty1fmDrauvils0 eur(rpnodame lies s sDraxront1tpx ii3iatlsDeauvo (0 leoxrciydfmteaneo (0trtr(r3iu4op elictasfarum(roou0olt  ociasfmDrmums t0 rxomf3iotlatr ieo s)tetoxmpnu1ll  micta() 2rrx pou4aleomf3iadlaDum(mpnt0aleoircoodopD lneslt t2urxr io1am  lnvt (fsDtmuront0olxnii3ildlm ulnvonu) rtoiociotopt aieols)srxoxopiu1lm nmnviatf Dra(mpou0tlt ifeiytfa rmumsnt) ltoif3ty1lmt  nvs s srxo(r oy1altnmncsa(fa2tau  ot0oltnii3ildlm2umuvo;t0alxoxrcta1fpDeaivo;s)setoxmpiu1apte nvsl(  Dtr(mont4opt  f3iat m uauvon(0trerif io1latrlu olt trumxm3iy4om nmivsl(fsDtmumonu0apxn f3tysfs2ulu s;t)teermr3to1laDrlneo;s)t2xmimpoodlp   nctlsfsDra( pnu1opxn feiyd aDuau s t)aeeoxociatfptrlu o s0 rum(o3nydllenmnvia()sDtrurpnt1tlxnmi3tls a rl(mp u)aetrir iydfaD  i slt) exoir3io4lpenmiet sfsDtm(m ot0apeo feiltls2rlnmp u4 ltrio oytomtelu o;s0trurxm iy1lme micsatfs2tm(rpno0aeenioetys m em(msnu) rtoifctydlmtr neo s0setmxmpnu1amt miet s  Duau  ;t0opxoiiciydlm2em(vpn(4 reomocoytfatelnes;s0t2urimpoodlltnmfviatf rtax o;u0aet  o3iat sDrl(mp;t4 eenxo tatfp ranvs;t0 eurim oo4amenmncsls srrm(rooo0ale  ieiatls2emuvsn(4 rerif3oo1fmteaieol()t2xmio oy4op e nvilt) ruax ooo1apen ictytlm2rluvonu0alxnxfcoy1la   uvsls0trtoxm nydlmtemiesasfaDrmxmp;o1alt mocilt s ulu o;t4aleoxo3totfmtraies s0 rumim3oo1ap nmivs sfaDraxrpno4alenii3tlslmDrmu ont)tlxoircoadlpte nei s setrim3nudllt  netltf 2taxm nu1tleoioeildlaDelnms u0aetrif tatlmD lnvi t)seto(m3oy1llt lfvt s aDurxroot0oee ifciys a uanvonu4tltnxf iytfaD  n s (0srumiopnudlle  neslt sDururoot4olxnmfeiat s2em(vp (0 lxnmrctodfaD auvo ( s2xrxr3no4lptnmfvsat sDraur nt1aee mociad s emumsnu0texnioctadfmDelivs t  rtmxmpnu4omtelfvi sfsrtau  ;o0oltniietld a uanvs;()tlxoif3oy1fmDe ivils)srumiopoy4olen nci t)srraurp;t4teto ocilsls2rau ont)artoxo iotfmDrlies s0 eumxrpoy1om nmfctlt)sDur(  ot1tlx  oeiasfsDelnvp t)artnxo tydfpDraneils)teur(mpoy1apee ies (fsrur(rp;u4alx ifctltfsDemums t4aetoif3oo1oa rai s t0s2tr(r3io1lpe  nesa( sDra(  ;u4tetnmieildfs rl( p ()altnio3to1op  aivil( trurxm3nu4alt mnes sf 2rmx  ;o0tleo icildfa2elnvsnu)tlxomo3ty1opDr uvil(0 exmimpoy4olenmnct sfsD
\ No newline at end of file
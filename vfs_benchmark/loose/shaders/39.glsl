@@ -0,0 +1 @@
+ivol()trtoir io4ol e neias s2tmu p;o1aptnioeils mDrm( o u) ltnmfcoo1opDe ieslt  eur(o3iodopenmivi t aruru  no0aex ifctls mDrau ont4alermociotfpD aivo;()s2urirpno4lp emncias)sDurxroou4oexoif3tysls2rmumpnt)arenmr3iodoatelu o s)texmiopnydlm   ivi sfsrur(  ;t0olenmieildls uanmo u0texnxrctodoateaneol(0srxo(m nu4op  lneta()sDrmxro;t1tpxomfctldfmDran ont4aetrmfcoydfpD  nvols) 2xmimpnudopt  ics (fs2urx  ou0apt  iciytfa2rm(mp;t)alxomo ootop   neols0s2uo(r iy1ol nmfeils)artax  ot1tlxo f3tyslm rmumont)arenxrciytfate ivo;(0tetoim oudame licsas  rta(mpoo0aeen o3iltlm rau p;u4aexoio iadoat lu o;(0 2tr(o oo1amen fvias a2raxrpoo0oltnio3tadfa emnmo u4arxrxfcia1oat anvs s setmxo3oo1amtnliesl() Dtaxro;t0opeoiocilslm2ul(mpnt0alxomf3oadoat  u o;()texrir iodale  fesltf 2urxrpou0texnif3tyd m2emn o;u4 rxoxr3oadfaD  uesl( t2xrio ou1llt lncslsfsDum( p;t4opx  f3tat s2eauvpnt0 rerir3tadopt  uvilt)s2toir ou1om n fcs sfsDrrx  ot0apx  i3tltfmDea( o;u4 rtoxfctytfpDelnesls teurio oydapeemict t)artmxr ;o1ale  o3tadlm2rau o u4 rtnxo3iatlmtraiei;t)s2tmxrpoy1oleelfet s)s2ur( pot0tltomfciad a2ran pnt4 rerircta1oa  au slt0 eurxm nydoltemiviasfa2rr(rooo0opeoifcilsfsDrau pnt4 exoircta1faDe ivs;s t2xo(m nu4ol  mics s  Draxm ;o0tltomo3iaslm um(vonu)altnir3oa1oa rln o (0 rxr(r oy1ope  fei s sDur(moou4olt mociyslsDuaumo t) lermfciydopD  u ol(0s2xmxmpiu4omt  fvs sfa2ta(rpoo0opt  i3iys a2eanvsnu0tlxoxf3totfmtrai ilt0srurim3ny1lltn ncslt) rra(ro;u1aptoifeiyd s2rlums t) exnxr ty1oaD anvi;()s2toir oy1lpt liei s  rraum nu1olxn o3tys s eln p u4 lxoxfcoa1lmDraiesls0 rxo(m3ou4op nlictltfarumx p;o1aptnifciytlm2ua( p t0tltrif3iotomtr uvilt  etrim ou1ll nliei (fa2tmu  no1optniieiltlsDuanvsn(4texnxfciy1optrln o s srxoio nu4lm  lfcsltf ruru  ;o1olxn f3iys m ulnvs ()aeeniociytfmDrlu i;s truoio3no4lle  fes ()sDumumoot1ole  ictlslsDrm(mp;t4teenmrcoytoat lu o s s2tm(rpou4alte fvi ()arrau  ot4aet ifcild m um(vo;(4aetniocootfmD  uvslt  eto(rpoo4amtnlncil() 2uau  nt4apxo i3ils aDrlumo t4 renmo tydlmDr nes;() 2uriopoo4am elieia()sDumxmp;o1ole mietad mDrlumo;(0altnmo io1omDelivi (  2urirpnydlptemfvsat aDtrxroot0aeeniictad m2uau onu)tlxnmf3oa1lp rau olt srxrxr3iodolee ncslt) Dtru pno0ape iictltfsDrlnvsnt)aexomr iy1fpDeaivo t)srxmio iydop   fvi s  rtr(rp;o1tltoifctytfmDrl( p;(4artrmrciadoptelies;()s2xrio oydom nmncta()sDrmx  ou1oeenmf3iytfs2elnms;t) rtoxr3ta1lm  aivi ( tetr(o iy4ll  lfesatfsrrm(  ot0olx mf3tys mDum( p u0altnxo iydoateauvslt tetrxrpnodllen fcsls)sDrax  ot0tee iiciyslsDemn ont) rerir iodomt livs;t trumxo3ou4olee fcslsf ruaumpot0oeeomi3taslm2uau o;(4arerio oy1omteaivo;(0t2uoio3nu1ll nmieiatf 2tr(rooo0tptoiieild s2uanvp;u)aetrxo iytom eanes;t) 2tr(mpno4ap nlnes tf 2trurp;u4aee ii3tlsfm elu s;(4trtnmrciotla  au o t0s2tmxrpiudlltnmnvs sf Dtrumpno4olt ii3iysfm em( pnu0 rtrxo3oytlaDraivils) rtmir3iydlpte nes (fa2rr(mo;o0opx ii3ilsfmDem(vp;(0trenxf oa1fmtrlivi;t0s2trirpoo1lpt  fcil() 2uau p;t0tpxomi3iadfm ua(mp;t4arxrmocia1lptr u ol(0t2xrio iu4ll n feta(  2ua(mpnt1opeoioetat a2eluvpnu)tltnmf oytfmDrli olt  euoimpiy4lm nlfvslt) rurump;o1altnioeiasfm2uanms u0altnxf3iatfp elnvsls0 exoimpny1om  mivs s srrrxrpnu4ole mictytlsDeauvs;(0tlenxo3iodlatean i;t0 2toxr3nodaleemicslsfaDumump;t1opxnif3tyt s ranvsnt4artrio iydfmtelneilt0s2toio3iu1ll   fctl() Drmxm no0oet mfciasfsDrl( o;t)arermr oodoat anes (0 2xoirpio1ap nmfet (f rtr(ronu4olt mo3ilslmDel(vp u4tlerirciytla  an s;s0srtmxr oo4omee ivt ( s2umu ooo4aleomf3tls mDuauvs t) ltoif io1lmDrlues s srtr(r no1ll emivta()a2uax ono4tptnmfctasfm eauvo;()alxnxr3io1fp eln o;t0 ruoir ny4omtnlnvt s)sDtaxmpoo0oetomoeiysfa2rln snu0teeniocootoaDr i o (  exrxmpnu4ope lfes tfa2rr(mont1oetn fctytlm2ean sn()tlxnircta1fmtr uvo;s  eumimpny1oltelfesa(fa2tmu o;o1open feiysla el(mp t)arxomocoodlp r uvsl( s2xoxm3oo4lm n ivtas)sDurx pnt4tetn iciltfs2rluvp u0trxrioctytla rli s s0s2umiopio1lpt  nvsatfsDtruronu1altoif3tat a2ua(mp t)aeerxf3oatlm e ivo t  rtoxr3iu1lpeemfei (f Dumx  ot4alto feildfs umu pnt4teerirciodom ean i;t) 2tmxr3no1lmtnlncil()artmu oot1ole  f3iadfm rlnvs (0 ltnio3iatomtraivo;()s2toxopou4am elietas)sDuaxmont0olxnifctls sDelnmp;t4 lenxr3io1fmDr ivs;s) 2xr(rpou1ome lfesls) rrruroou0tpx if3tydfs2ulnmsn(0alxoxf3io1fmtelu o (0seto(m no1lme  nesa(faDtmu p;t4aeenmfeild aDranmo t4texrmrcoy1fmDean o;t) rtmxrpiodal elivtatf rumurp;t4tleniiciadlsDrmnmsn()artnmo iodop e ueolt0 euoxm nydoleemnvt tfartrum ot4oexoiiciad s2elums t0 ltnif3oodoateluesls srxoxm3iu4lltnlfci ( a2rr( o;o1olxnmo3iat a rm(vo t4tetnxocta1op rluvsl()trxoim io4omtelfctlsfa2ua( pnt1tetomoeilslm ulnmpn(4 lxoxf3oadoaD  u i s0 exoim oydolenlfesltfarta(ront4oetoiietys a rauvpnt4tetnir oo1fat  uei (  2trxmpio1am  lfcias)srtm(r ou4oeeomocilsls ean s;t4teeoxociy1lptr ieol(0setm(m no1altemfvsa()a2trurpnu4oet iictyt a umnmo u0 exoxo io1lmDrlu o;s0t2tm(m ny1om elneils  rtmxr nt1tle ii3iyslsDul( o t)aetrmf3ootlpteli i t0tetrim3ny1om emnvt t) Drrxrpot4tet mfctlt s2ul(vsnu0 exnir3oy1lptrlnvs (0setrxopnudolen ivilsf rrmx oot0tpxoifetat s um(mon(4 exnxr oodfmt anes ()teuoio3iudap nmfesa(  Dtrxmp;u0tpto ictysla em( o;t0arxnmr ootfm rlnvsls srumxrpou1am elncsa(  Drruro;u1oetn ieiyt a2ul(vo;u0 renmfcootlmDeli sls  etrxo3ny4opt  iviasf rtrx  nu0apxnmfciys aDrau onu)aetoxf iotlp  anvi s0t2tmxm iy4olt mnet (fsrtaump;u4aexnmoeildlm2rm(vp u)alxnmo oa1oaDr nvs;t sexrxrpnydol  lfci (f rumurpnt4tlxnii3tyd a2ra(mp (0trtnmr tadlp  au o ( trxo(o iudame mfctlt)sDraur no4opxnifetat m uanmsnt0tlxoir ty1lmDranei;s)t2tmxr3nodam e ncs s) Duaxrpot0tee ifeiaslm ea( o;(4artnxrcoydfa   u i (0 rxmxm io1lm  livtlsfsrurx ont0alt mieiad m2ra(mp;u) exnmocoatfaDrlu ol(0sexmiopoy4al e neils)sDraxro;u1teeo fciysfmDemu o;u0 renxo3oo1om rlnvi;(0texoxo iy1ope  ivtls sDraxmoot0aptomieiysla2raumo t0 rermoctodfateli ils0 ruoxo ou1ome mnvs t)artr(m ;o1apxnmietyd s ra(vo;() exnif3tytfmt lu ol()sexmiopnodoptnlivtlt s2ur( o;t4oeto o3iytfs2rln ont4trxnxociotfptelivi;t0 2tm(m oy1ome mivsl(fartr( pnu1tpeo ociadlm2umn s;u4alxrxr tytfaDeanei ( teumxopnu4ape mnes s  Dta(m ot0altoio3ilsfa2uau pn() ltnxo oodfmD  neol()srtmxopoo4ap emfci s)arur(ro;o4oltnmi3tyd mDel(vpnt0 eeomo todla e nes s teuoxo3no1alenlnei ()artru  nu4aptnifeildfa rmnvsn(4tlenircoytlpt aneilt)setmxo3ou4aleemfetat  2umxrooo1tlt miciytfs2ra( o u) rtnmr3iodomD livolt) 2uoxmpou4lptnlfet sf rtru pou4texnioeiat s ulnvp;u4 ltrir oo1opDeli s s0srxrxm3nodoltelfeilt sDtr( ont4oex iictadlsDuauvsnu) lerircia1fateaies ()t2xrirpoo4lm emneilt  2umu  ;o4openmi3tlt a2umn pnt0areoio3iy1oaDrau s;s0 exmxrpoodapenmfes sfsrraxr oo0optomoctysla ea(vo u0 lxnmf ia1fa e i ols0trumirpoodom e fci s s2raumoou0optoii3iadfsDua(vpn()aexomo todfaD au il( texm(opiydomenmiesas)srtmxrpot0alx  feiaslm2elnmp;(0 lerxf3totfmtean i (0t2toimpou1lptn nes t) rtr(mp;t1tpe if3iys m2uauvp u) eerxf3iytfpDr nesl(0trtmirpoo4amen ics ()a2raxmooo0texoiieild mDrl(mp (0 rerifciadfate nvo t0 ruoxmpoo1llte ivsat sDtm( ont0oee iociatfaDelnvsn(0tlermr oy1lpDr i s;s) eurir3oy4opeemiesltfsrua(rp;t1tetniicilsfs2rau pn(4tltoir3totom rli i;t0sexr(opoy1lpe mict s)srraxrpot4tlxn fciydlsDemuvp;(4 rtrmfctytfmteaneolt  2tm(o no4ope mfcta() Drr(rpnu0apt  f3iyt s2rmnvsn() etnir iatoat auei (0seto(r3iu1amt mncsa()srrr(ront1tptnmi3iaslm el(mo t4aeenxfctotfa raivi t)seumio3oo4lpt  icta(  Duaumo;u0opt if3ilt m rm( o t0artnio3to1faD auvi s) rxoimpoy4op nlfesl(faDrax o;t4optomoeiadfsDul( o;(4 etnircty1lmtr uvo;(0seuo(r3nu4opee fct tf Dta(rono4altn ictltlsDemnvsnu0 eenmf tadomDeluvi;t) etoir io1lptnlivtl(fsDumur ot4oexomi3iltfmDrm( pnt0teerxocoo1optr n o t  exo(o oy1om emnct s  Dtaxm ot4ole  oeiysfa2ea(vpn()tltnir3totfpt luvolt)srxo(m iy4ameelfei ( aDtr(rpoo1apenio3iasfs umump ()alenmf tatoaD  u sls)texoirpno4lltn fcsl(  2rmur ;t0oeto i3tat s2rlnmsnt0areomf ty1lmD lnvi ( t2urim ou4optn fesat a2rr(  ;o0aex  ictysfs2rlnvo (0alxnir3oa1la   ivi;(0trurio3oydapen nctat)sDur(ro;u4olen i3ildfaDem(vp;t) lxnxf todfmDr n o;( trum(r3iu1ll n net ( arurxr ;t1tlt mfciadfa2el(mo;(0 renxf iydfpDelivs s tetmxo nodopt livta( a2tauro;o1olto oetld m2ranms;u4tetnmr tatfa   u s;t0 etrxo ny1lmtnmietlsf rtrxmooo1aetnmi3iydfaDemnms (0 exnxf tytoa   neils0srumxo nydam nlnei sf 2ra(ro;o0aex ioeiasfaDem(ms t4alxnmo oydfa eanvo s0srurxr3nudaltnlici ()aDtmump;t0opxoii3iytlm2em(vpnu) rerircta1oatr uvilt s2xm(m3iodllenmfcsl()sDuauroot0tptnif3ias sDranvont4 rxrmf3totopD  iesl(0srxmimpny1ll nlicsas aDumx  ;u0aeeomfctyslaDrlnvs;() rerircio1fatelieo;s0t2trxmpnu4lp nmfetlsfsrurx pot4tpeoiiciasla elnmp u0teerxr oytomtrli o t teurirpou4olt lnvtasfsrraumoou1tpe ifeiadfsDemn pnu) rxnxf iy1optr nvols  rurimpou1lltnmnvtatfsDtau ono0apeo feilslaDua( s t0 etrmr3ta1oaDeai olt0tetr(m oudom elfci (  rumx  ot1alx iocildfa rau s;u0 etomo iotlaD  nvols)trto(m3ny1altemicia( sDra(rp;t4tpt iieiaslaDua( onu)arerir iodop  livi s0s2umxm iy1op nlnvias)srrmxrpou1olt mfciatlsDrmums (4 eeoircoytfatrau s;t0srxm(r iy1lpeemfeiatfsruau p;o1tet  ictyt s2ua(ms t0aeerio3to1fptelivi ()setrxr3nudapen iciat sDuau  no0oex  fetls s em(ms ()artomo oo1om   nei;t0 eum(mpiu1lp n fctl(fs2urx  ;u1aetnmocildla umu o;u4artnmr3oa1lpt au o s)teum(m oo4olenlnes (fsruru  ;o0tetomictyd s umn p t)texrxfcoydlp ran i;t)seuoxopou1op n net ( s2ta(r ;u1aleomicildlmDrlums;u4arxomr oodfaDelnvo;(  ruo(r3oudolt lncsltfa2taxrpoo1olxomoeiadfm2uan o;()arxomr3ootlpteai ols)tetrxm iu4lptnlnctlt  rrm(m oo4apxnif3tydlaDeanms;u) rxoifcto1fmDeluvols0srtrio nudol elies t  rrmxr ou4oetnmietysfmDumu o;()arxoir ty1fm eaieslt0s2tm(m3io1lp n ictls) Drr(mo;o1oeeoioctldfa2rau p u) eeoxo3oy1lpDr u i;s0 rxoxrpoudlm   ictl(fa2tr(m ot0aexn oeiadlm2elu snt) exomrcio1fa  ai ol(0 rtoxm iy4lptnlivt (  Dtaumono1oee  i3ilslm2elu pn(0tlxrmf3tydlp e n s;t  etrirpny4open icilt aDtaumpou0olto ietas aDrl(vo ()aetrmf3oodfaD luvo;t0trtrxr ny4lp   icils  2urxro;t4texnmoctadlm2raumsn(4tlxomr oa1om e u o t0tetmimpnu1ol nmncsasfarrr(m ;t4apxnio3ild m2rau o;t4 etrxocoy1oat anvi t)sruo(r ou4am n nes t aDurxmpnt4aex  o3tld mDran on()arxnxrcty1oaDrai ilt0s2uo(r3io4oltnmivtas sDtaxr nt4alt mf3tlsfaDrmnvsnt4alxrmr3to1latrlivo (  2tr(m3iu4op emnei s  2ua( onu4apxomfciatfs2emnmp t4teeriociy1lpt li sls0srxmirpou4lm elnctatfa2rm(m ;t4tex micilt mDumuvs;(4tltnioctodfaDeliei ()s2urio3oydamtnlnetl()arurxmpnt0alenif3tatlm2rmnvs t) rtoxo totoa eai il()truoxo3oodopeemnvsa(faDta(ro;o4oet io3iad sDrmump (4arxoxrcoatlpDe i s t)trxrxm no1ap emietlt  rum(  ;t4olenii3iatfa2umu s;(0aexomr iy1om rauei ()s2uoim iu1ap  mneslsf 2urxmoou1tpeoio3tlt m uluvo (4aexnmo iodlmte n o t)srxoxo3iu1ol  mict t aDrruro;u4tet  oetldfmDrlnmsnu4teerif iytomDeai sls s2xoimpou1optnlnesltfs2ur( onu0olen fciys s2rl( o t)trtnxf3ia1lpDr uvolt)trtrxmpno4llte fcilt)srtrx pnt1aeto ociasls2uaump t0 ltoxo oa1fmDrlnvo;t0 rto(rpoo1lleemfct s)arum( poo4apt  i3iltlsDuanvont0tlenif iadoptrluvsls0 eumimpoy4llt lnvsas)s2rmu pnu0tle  fcilslm umump;t0 exnxfciytopDe u i s0setmxr3no1ll e nctat)aDua(rp;t0texo oeiadlsDemu ont)tlxomr ootfat liei s teuoim3no4ap  lnvtasfa2taxroou1apto f3iatla rlnms;u4 exnmr3iodomt aueo t)srurirpio1amte nvsasfaDurxmpnu4alxn ieiatfmDrmuvp;t)altrmf3iadlpte n s;s)trtm(mpoo1omen fcsls  rtmum ot0aetoioeiatlaDrlnvp;t4texnmociy1fpD an o;( sruo(mpiudop   fvt s) 2tm(mpnt4apxnmi3iltfm2eaumo t4 rxnio ia1oa e ues ()truoxo ny1llte ivta( a2rauronu4teto feilslaDulu s;() ltrio tadlat  nvsl(0seumxr3nu1op nmivtl(  2raxm nu4oeen o3tyslmDrauvo u4 rxnio3totlpD  i s;(0 2umxm3iy1apte fvi s  rtax  no4tptn f3ild s2eaump t4arenmo tatlpDrliei;s0srxmxm oo4ome  iei (f rtau  oo4oltomfctaslsDulums;t4 exoir tydlatr u ols0teuo(o nu1om nlfctat s2urxmpno1tlxn iciltlaDrluvo;u)tltomoctodlmt aivs (  2tr(rpiu1lltnmivi t arum(ronu1aeeo ictlsfa2ra(msn(0tltomrciatfmDe uvolt)teuo(m3iodop nmivt (  2rruro;u0aexo f3iasfa2ulu s;(0 rerif ty1lp  lueils  2uo(opoodome  ivi t) Duaurpot1aeenmociltfm ua( o;t) exrmr3to1fpD anvils0 eur(m ou4ap e nct tfsrra(mo;o1aleo f3iys sDrm( o;t4 lerxocto1laD lues () rur(rpou4lptn fes t)srta(mpou0texnmictad a rln o;t4aeerif oy1lmDe n o;()t2ur(opio4ameelivi (f rtr(mp;u4texnifcilsfs emumsn(0aetrxr3iy1oatrluvils)seuoir iydlm elfeias)srtau p;u4olt moctatfm2rmuvp;t0tlxrxr3iotoatranvols) 2tmir iu1ol eliviat  2trxmoot4olxnmi3iasls2el(vp t4alerircoa1fp   uvs;s teuo(o3oy4ap elfctls)s2rr(mo;t0olxo ietls a2rmnvon(0areoxoctydopD lnvs ()teuo(m3oudol   nvsl(f 2um(rpnt1apx iieiyt m2eluvpn() etrxf3oatfmt  nes;t  rumxrpiudape lfetls aDraxronu4oetn o3ias s em(monu4 lermo totomt  nei t)t2umxo no1op emfct s arraxmo;u0aeeo feiydlaDea(mo u) lermf3oatlm e u s;s0s2xoxo3no4olt mnci (  rum(r ;t0tpxo o3tytla umuvp t) eerif iydlmtelu olt t2um(o3oy4lp nlfct ( srrm(m oo1opt ifeilt sDrluvo (0aetnirctodfa e n ols texoirpoydol  mnei s)aDtax p;t0tee iieiys a ulu s u4trerxr3iytfpDrln il(0 2trio oo4lm elfvslsf 2rr(m ;u1aleomocilsla ul(mont4 ltnxo iatlat li olt0srxmxm ny1lle  net t) rrmu pou0oet  o3iad mDrm( p u0treoxo3oodfp   nvol(0s2urio iu1lpt mfetatfsrtrumont1oltnmfeild a umnmpn() lxnir3iadfmtelieols) 2toio3no4ole mfeiasf ruaxr no1tpe  oetys s2rau ont0tlxnxf3to1la e u o t0 rtmxo3iy4aleeliei s)aDuau onu4alen fctyslaDrmn p;()arenxo3iadfptrlu s t s2toir ny1alt  ivilt)sDurxm nu1olenii3iyt mDulnms u0alxoirciytla  ai sls tetmir3oo4aleemfcsas)srtr( oot1tpe mfcilslsDumumo;u)trxrmo3oa1fpDelues;t0sruoxr iy4lmte nctls) Drmu poo0opxn o3tad a eaump;u0alxnio3oo1fpD  neo;() 2ur(mpio4olen ieia(  rtaum nu0tpe  feiytfaDulumo ()tlxoxr todfp elnvols trxo(o3ny4oleelfetl(f Dtaurpou0olxomi3tatlsDeau ont)altoxr3oatfa r i o s s2umirpoo1lp elfeiasfarurx oou0oee mieiydfm uanvs (0arerif3ia1lpD  ueolt)teumxrpiydape  ici tf Dtr(rpou4tee moeiytlm umums (4alxoxf io1la  an s ()srtoio no4ole  nvs (fsrrmxront4alxo ietltla um( o;(0tltnmr oo1fa e nvo t)texm(m oy4lptn fcias  2raxmpnu4tee moeiatfa uln snu4aetomf tadom elu i (0 2xrxm3nudlltn ietl()s2urx poo0tetn feiad aDul(vsn(0 ltnxr3oo1fpD au i t t2trim3nu4omtemieiat)sDtm( pnt1alxnmfctys mDean p;u4 lxomo3iotlaD anvs;t0trum(r oo1openmfcsa() 2ta( p;t4apeniietld a2el(monu0tetriociy1lp r i ols srur(r oudamee ncias a2taxr ;u0teto ictldls2ean o;t4aeerio3oatopD anvil() rto(mpoo4am e ietls) Dtm(roou4tlx ifcild aDulu p u4trtrio3oadlm ran sls0s2trir no1olee fvta(  rumurooo4aetnmieils a elnvon(4tlerir to1omt liesl()setoio3nu1ol  lfvtlsfa2tm(ro;o4tetnio3iat m elnms;u) eeomo3ty1fpteai s s0 exr(mpiu1lm  mnetltfsDta(ront1ale io3tydls ea(mp;()tetnxo tydomDrau ils)trtr(o io1amt mneil() Durxm nt0tle mocilt m2uluvo t0tetnif tydlp e ues;t)s2trxopoo1om   nei t) 2rr( ooo1tpt iictatlmDrm(monu)aexoircoydlm  aues;t) ruoxr oudole  fcta()aruaum no4tlxn feiasla elump t4tltoiociadfmt  ieol(0seuriopoo1ll  mfviasf Durur oo1teeo o3tldfm2uauvon()tetnioctotomD aivilt0 2umio ny4openmivs s)srrm(  ot4oltnmfeilt mDrlumo;u) ltrmo3iydfaD aiesl(0teur(opiu4ol emies tf 2ur(r oo1tlxnmfcilsls2elnvp t)texrmo oydopDe u ol()srtrxr3oudomenlivs t)a2tm(mpno1apxoiiciydfsDua(msn(0altrxr3oydlaDeaueolt0t2xmim3oodolen nct (f Dtaurooo4ole iictldfa2elnvpn(4artrmo oadlp rau o s)t2tm(m iu4ol  mfvil(f 2rm( pno0opxoio3iadlm ulumonu4texrmrcoydlm e nes;( seum(o3io4ol nlfeia( s2rrum nu4tpxomfcils m el( s;t)treoxo tytomtrlueo s)s2tmio oy4aptemictl(farumu onu4olxoii3iltfaDemn p;(4trxrmo oodfp rlueils0trxrir3no1lptnmiei (farrr(  ot1tpxo oeiaslm rmumont)tetrmr3tytlmDeaueil(0 2xo(r3iy1lp elfei t)aDrrxr no0tptomi3tlslaDumn p t)arxomo oodomD  ies s t2xrxr3iodale  fesas)s2ta(mono4olto i3tyd a ulums (0 eeoxrctodlm ran i;(0trum(o io1alee fei t) 2ur(  oo1apxnmociatfsDel(vo t) exoxfctatfate u s ( srxrir iodllteliesa(fs2tru o;o1opxo f3tydfa emnvpnu4 etoio3tytlptr n slt0t2ur(r3iy4omt  iei () Drauronu4tlxoifciyd m2rauvs t4treomo oa1opteanvo;t) exrir oy4oltnlncsls sDurxrpoo1tpt io3iysfs rl( p;(4 lxrmf3iy1lptranvilt0 2tmiopoydolen ncsas  rum(rpno1tpeo fetls s em( p ()altrxr3todoa eli o t0texoxrpio1ole mfviatf rtmur ot0apx if3iaslmDum(mp u4 rxoxocoodfptelu ol() rxmxopiu4llt  nvsas aDtm(  no4aleoio3tltfaDumn p t) renmfcoydoptelivol(0 2xoir io1optemncs t)sDtaump;u1aee moetlsfs uln s;t4aleomr3to1lmDr ivils0 2xrxo3iodap e ici ( srraurp;u0alx ioeiydla2raumpnt) lenio3iadlm  an i ( sexoxr3oydlpeemfvia()a2rr( oou0apeo feiys sDemnmon()arxrxoctytfpteluei t0setmxr3nodap e nes ()artr( pot1aptoifctlsfsDelnmon(4artoioctatop  au o;s texo(o3nu1apt mnvsls srur(r nu4tlx ifetldlmDrauvo t)arxrxr3ty1fa  ai ol( trur(o oudlp  lneiasfaDua(r no0tlt  o3iydfm2eauvs (0 eenmr iydom eaiei;t s2tmiopou4oltnlivtlsf 2taxm nt0oee iieils s rl( s;t) rtomo3oydomDeluesls0 2tm(m3oo1olenlivt ( arurxrono1texoif3ild sDemn pn() rerxo tydla r uvi t  rto(mpno1altnlfvtl( artaxr nt4olx mo3iysfs2elumo ()tetrxrcta1lpteln s;s) 2xoxm iudll n ncia( srtrxro;u4alxniociasla2umumpn()artoxf3oodlaDe uvi;s sexoxr oudlltnlivi t)srraxmono1aee  f3iad m2umuvs;t0aexrxf3io1lpDrluvs;s0seto(r oodlm  lncia(  rrr(mpoo0tpto f3ilsla2rmums (0trxnxocoadfmtraivi;s s2trxo3nu4lm e nei t s2urx ont0teen ictatfm2ul(mpnu4aetoxr oy1lmDeaiei t0s2um(o3no1lm nmicsa() Durxroou1tetn oetadfs2eaumpnt0aetrmr oadoptelivo t)s2xr(o iodaltelfesa(fsrrmx o;t1tpxoioetyd s um(vs (0trxrif3ta1fpD aueol(0s2urxmpno1omenmneiltfsDta( pot0olx ifeiadfs2em( s;(4arxrxf3io1lmtranei;t)teumxo3iy4ll nlivt (f rua(r ;u4alx iocilslsDem(mp;u4 lxnmf to1lat aneo (  eumxr iu4am  mneslsfaDrax  ;o0tleoiieiatfm2eln sn(0areoir3oatfp rau s;(0 rurxo3nydol elneta() rum(r ;o0alxoifetlsfmDean s;(0tltrif3totoa rlivsls)trxoio iudal nlict t)sDuau pno0teeomfeiydfa uln pnt0arxrxr3iodoat au ilt)s2tmim3iudomte icias) Duaxmpot4tlt  oeild s ranvp;t0tlxoio tadlm rai ils0 euoxr3oo4am  lnvs (  Duaxm ;u1tpxnif3ild aDumn sn()altrmr iytfp eanvol(0 eumim iudome mictlt) rrmxmo;o1tleomiciys a2umn s;(0tleomfcoa1lmDr ivs (0 rxm(r ny1optn fciltfaDtru  ou0optoio3iyd m eanvs t4artnif ootfp   nes;s  exoxopnu1ome lnetl()arurx pou0tle if3ilslsDeanmo;() rtniocootfa raues s s2toxr ny4ole lfvtat)a2tauro;o0tlxnmfciltls ra( s;u4tlenirciydlmD livi;s0texm(opoodoleelncsat) Dum(r nt1apx moctadfm2rl( s t)tetnmf3oa1laD  ivs t)trxmirpnodamtemfvias a2ra(mp;u1tleniictadlmDemump u4 etoifcoo1omtrlnei;s0 rtrxmpnodapeelfvs ()artmx oot1aeeo o3iltlmDrm(mp;(0trxoxo3todlm raivi;s  etmimpio4am nmfvil()s2ua(monu4tetomiciltfs ulnms t4 reoxo3iatla  aneo;s) 2trxr3oudolt mfcia()aDum( ono0altomiciysfa2el(ms;u0 lxnxr3oadlaDe uvi s)sexmim3nudom nmfci tfsDtrur ;o0tet io3tadlsDea(vp;u) exoxrciadlpDelnvi s)trum(r3no1alt lfct (  2tax  ;o4tetoiicias m ulump;u4 etrxf ta1fatean i;( trxmimpny4lm nmfetl() 2rrx oou4oeeniieildlsDelnvs;(0arerxr3todomD luvo;t t2xrxm ou4apenmicslt)sDrm( pno0optn fcild m2eauvs;(4alenxo tytlmDrlu s ( sexmio3nu1ame livtlt s2trur nu4optnii3tatlm2ra(mp;u) rtomo iadom rlueil()t2uoxo3oy1optelfetat)a2urxrp;o4alxniietldla2rlnms (0artnxr3iydlpt auvols) rxmxrpiu4lltemfcsas) rtr(rooo0tpe  octysfs2elnvsnu0trtrio3oy1fm raivi s  2tmio3io1olte fciltfaDtmxmp;o4oexnmo3tat mDrl(mo;t)aeermo3tatfate neils0 rurxm3ou4ll elfvil( srrm(  ;u1altn feiatfsDrm(vo;u4arxnxo tytla  aueo ( tetmimpou1lpenlfcsl(fs2trx poo0olx  ictltlm2ua(mp;u0 ltnxo3iatoaD lneslt0tetrxr3io4ome mfviatfa2umur ;o1aptnioeiydfm2em( o;u0tltrio tydfptr u o t  ruo(opoy4ame mnetat)a2urumonu1optn ieiytlsDuluvp;()artoifciatfmDeauvo ()s2xoio oy4lmeelnesas) rrmxm ;o4olt  fetydlm2elnms;u) exrmr3ta1lm  luvs ( tetm(m oy1al  mnvsl( arrau pnt4opt moeildfsDumnmpnu0 eerir3to1lp r ues s0setrxr3nu4om  lfcsl(fa2tax  oo1tltn f3iatfsDra( p (4trtoxfcta1oatelieo;s0seurio iodlleemfeta()srtm(r ot0altomocildfm2emumsnt)aetrmo oodopt lies;(0s2tr(o ou4apt mnvi s  2rr(r ou0tptnmfetytfsDemnvo;t4arxnxfctydlmteaivsls0srtmxmpny4apte ivsls a2umuro;u0tpt iiciydla rm(mo;()tlxoxo oydfmt ai s s trxmimpoy4lmen nviltfaDtm( oou4opeomfetyd sDuanmp;t0tetrif3iatfat lieslt0sexm(r3oy1ame mnvslt) rururont4aee ifciadls2ua(mont4 renxrctatlmt  nvs;t tetmxo ny4ope lfct sf 2rau ont4aeenmi3ias sDelnmo (4 reomo iatom e i i;s)teum(m oydolee feiatf 2trumo;o1oee  o3tldlaDua( ont0trtrxr iydfmD anvslt0 2uo(m3oo1lm   netlsf Dtm( pnt0optniieilt sDrm(vsnu4aetoif3oydfp e n o s s2xo(r ou4ape mivsatfsDtm( ono4tpxo fetldla2uluvp;t) etnmfciadomDe ieil()setmirpiy4op  mfctlt  2uax pnu1oeeoif3iydfs uluvo;t0 etoxocoa1fptean il(0tetmxm no1alt mnvsat)sDtm(  nt1oltnmiciyt s ean p;t) rtnmo ia1op ranvi;( srtr(o iy4oltn ietatf Dumur ot4apxoiictytfa2ul(ms;u4 rxomr iadfmDe n o s0s2trxrpny4lmeelivi ()a2rmxrpoo0opeoifctyd mDul( on(0artomr3oadlm   nei (0trxrxopny1om n nctl(  rur( ooo1oet ioctasfa rl( o t4 ltoxr todlaD ln i (  rxo(opny4amtemfeiatf rururoot0olxo iciytls2uln p t4tlermo ty1laDr u i () rtmio iudomen nctlt srumxmoou1aleoifeildfmDeluvsnt0tetrmr3iy1opt  nes;(  2toim iodopee fci () 2rmxronu1tlt iietltfmDumnmpn() lxnxr tydlaD li slt srxoim3oydom elfvtatfsrtax oot1opx  octyd s emnvs u0 lenxo3ia1om raivsls tetoio nu1lme mfesas) 2ra(ronu1aptomi3tat a emuvs t0 lxomrctodfmDr neo;s  eurim3iodlmenlivi t  rrm(roou0apt mociytlaDranvsnu) eenir to1fat luvi s  etm(rpio1ll elfciat) rrrumo;u1oeeniocildfsDrl(vont4arxomr3tydoptr n o;t)t2xo(r3io4ape lfvias  2tmxmpoo0ape  o3tasfs2umumo (4 eenmo oydlmtean i;t t2um(m io4opee ivs ()aDumx pnu0oltn ocilsfa ulump t4 rxnxo iydlmDeluvo (0 rtm(o3oudapt mnctas s2uaxmpno1aptnmfcilsfmDemnvs u)tetnxocoy1lm r u o;s t2toxm3nu4lpt  nci t srurxroot4aeeomfctad s2ea(vo;(0alxomf ty1fa   uvi s)texoxo3ou4alen neiltfsDuaurpot4apxnmf3tlsfs2ea(ms;(4trtnmr tytfpD lies t s2urirpoo4om elici (f rurxm ot0oeeoioetadla2emnvp u0 exrmf tadoa elnvol( srumimpio1lptnmnvi ()arrm(rp;t4oltoifeiat aDra(vp;()aexnif iadop elneo;()t2umim ou1ope mnvtasfs2rm(root0apeoioeiasls2uln snu0trenirciodfa e u s s  2um(mpoydll nlfeslt s2uax pou0alx mo3tyd mDuau s (4 lermo3oytla e ueslt0srum(r oudlmtemfcil(f rta(ro;u0tltoiietysla2ran onu0alerxf to1la eanes t  2uoim3iodlmee ivi t  rrmu oot4aptn i3tlt m uauvsnt) rerxo3iydfmDeaueo s s2xr(mpno1altnliesas arrmxmp;o4tetniieiyslmDrm(vs;()tlxnmocta1la rlu ils)srtrxr3ny4omt  fvtat s2urxmpnu0ape  f3iasls2em(ms (0aeenmr3ootlp  luvils0s2toxmpno1lme  nctasfsrumxr ou4ope ii3tasfm2umn p;(0texnxf3tadom e n o;() rum(r nodopeemicta() Durxmo;t0apt  feiat a2raumpnu4tlxomocoo1lateauvs;( tetrxrpio4lleelneia()s2rmumooo4oexnmi3ils s ra(vp;u) rermo3ia1lpDeaieo t srumxr iu1oltn nvt (  2rr(  oo0oeeoio3ilt sDra(vsn(0 etrmf oodfmtraivo;( tetrxo3io1ameelietl(farrr(mo;u0tleoiociatlm ulums (0aeeoir3tytfaD livol()t2xmim3no4lm  mnvil()aruaur ;t4tee if3iat s umnmp;u)alenxocoydopt lues s0srumio3ou1lm   nvi (fsrraxm nu1teeo o3ilsfa2el(ms;u4 eenio oodfpt  ivslt0tetr(o nydlpt  fct (fsDtmu ono4tltomoetasfa rlu o (0 ltrmfciytfatr i o;t)sexoxo3iu4al e nesl()s2rau p;t1altoifcildlaDelnvsn(4trtnxf3oadfpteli il(  2ur(m3oo1lmt lfcias)s2taurpnt1ale ii3iysfaDumu on()alenio3iydfm e ieols) 2trim3nu4oltn nct sf rumxmpou0tltniietlt mDem(mp;u) etomo tadlptelnes;t trto(m oydlmeemivilsfaDua(mp;u1tlxoioeiadla2rmn s;t)aeeomr3oadla rlnvil()sexr(r nodope  fetl() Drrum oo0texomoetlt m2eanmo;t0trenxo3iatopDeluvo t)s2urxo ou4op elfcilt aDurxronu1opxnmfeiaslaDel(mp u0texnmfcoydoat  nes s srur(mpny4lmte neslt  Dtmxmoou0ope ioeiatfs2rl( p;()teermociydlmDrlneo;t t2umxm3iu1ame mfes (f rrmum ot1oetnmfcildlm eau o u4 lxomrcto1lpteaiei ()trxoxopno1ll elnet s  2rmum no0openmfciydfm rmu p;t4 exnif3iydoatran sl(  2umxr oo4omee ncsl()sDuru p;o0tpen ociatls em(von(0tlxrif todlatelivi;(0 rxm(o nudalen feiat)s2urxm ot1ole  o3iysfaDemuvpn()alxomo3tytomtrli s;s) exmiopoydalt  nci ( sDra( onu1opt ifciatfs ra(mp;u) lenifcoatoateliesls0 rtoiopiodole livi tfsDuaxrpoo0texn oeias m ua( s;t4 rtrxf3oatfpt ai s ( s2tm(rpio1ll nmnvsasfa2umurpot1tet  feiad m2ra(vsnt0 etomo3to1opDelu sl( s2xmxmpiodllen fvsls) 2tr( pou4tlxoioetytfaDum(mp;(4 rtnxrciytlpDelu s t)texrxmpnu4lle  fvi s s2ururpou4tlen iciat a2rluvp u4 ltnmr oo1fmD au i ()teurxo3ou4amt lfeia( srra(ro;t4opt mieiaslaDum(ms;u4 lxrmocia1lpDranvi;(  exo(opnodlltelnei (fsDtaur nu4aexnmociaslm2ulnmsnt4 eenmr3oa1la eai ils) rxo(opiu4ll  lietlsfarurum ;u1optoiictat a2em( p t4arxoiocoadfpD ai o;t srtr(o oudlleemfvi tfarurumont1ape  ociytlsDua(mpnt) lxoio3ootlmD anei;() exmir no4lle mnetlsf 2rm(rp;u1aexnmfetatfaDumu ont) reoxr todlpDrlu s s0srxrxrpnu4ll n fvsls  Drrump;o1oexn ietatlm2eau p t0artoxo iodlmte nvi ()srtmxr3iu4amtn fvil( arum(  oo1tlen iciad m um( p t)aleoircia1omDrlu i s0texo(opiodlm n fesa(  Dur( o;u0aleoiietldla eluvp;() renif3oydomtr i i;(0 ruoxopiy4lme mneia(fsDrmu pno0oleoiicild a rmnvp () rxrxf tytomDrlueils)t2xm(m3oydap  mncslt)sDrax  no0tlxnmf3ilsfm umumo u4tetrxf3oatopt  uesls0t2toxr ny4omtemiesl() Dumx o;u4texo i3tld m el(vp (0tltoif ootfp  lu o;t0 eumim iydome lieiat) rum( p;t1oltoioetlslm2umumo u4tlenxr3tadfmt  n s t0t2toxr3oy4lpeemfvils s2urxr ou1aet  fctatlaDrln o;u)texoxf oadlpDr u s;t srumir3oudol nlncsas)aruaxmo;t1olxo fcias m2ul(vpn()trtrxf3ootfpDeaieo;(0 etrxm nu4lleemivsat) 2umx  nt0oltomi3tat a2umnmont4treoxo oadfa eliei;s)seumxm3no1ope  fcsa(fa2trxrpoo1ape ii3tltla2ul( s;u4 eeomrciadlateanvi;(0teto(m oydlm elnes t sDrmxrp;o0oltn i3iydfa2ranvo (4altrmf3ootfmD aivs;(0srxrxo3nydlme  fvs sfaDtmu p;t1aetnifciyt aDul(mo;(4tltrxfcio1omt  neilt0 2xrio3oodope livtlsfarrmuronu0oeeo ociyslm2rmnvo u4 etnmo3iatfaDeaues;t  etmiopnu1op  lneiasfa2um( o;o4alt iieils m2el( ont0 lxrmrcoatlpt lu o;(0 eumio3iudame  nesls s2ta(rp;o1aexn oeiatlmDeau o () etrmf3iadomDe neslt sexr(r3iy4op n fctat srua(ro;t1optoio3ias a2ea(mo (4aexniocoo1lmDelnei;s  eum(m3nu4aptemnvslsf rtrumpnt0tpe  oeiadla emn o;(0arenmrctadlmDeai i (  etmiopiu1lmt  ivtasfarrmumoot0apx  feiatlm2ra(ms;u0 eeoxrcty1fat  ues;t0 etm(o ny1apt  nei ()sDuaxrono1tpeoif3tlslm elnms;u0artnmf3oatlpDe nvil()t2uo(r3iydlp nmneiat artmx p;u0oee  f3tasfmDrmump;(4aexoirctodoaDr uvo;t)srtmio3iu4llenlivtls  Duru o;u0oee mfeiytfm2emn o (0tltrirctotomtraneilt)trxo(o oy4omt lnvils  Drm(  ou0apto iciltlmDelums t)arenirciodopte u i t0teuoxr nodlpe miei t)artrxr nt4opxnii3iydla ua(vo;(4tlxrxr3ty1faDelu ols)sexrxmpnudome  fvi sfs2tm(ront0openiociyd a el(vsnu4texnir tadla elnvs t trumxmpny4lltelivias)sDtm(r ;o4ale  f3iytlaDuanvsn()trxrio3oy1lmtr ivi;t  2xo(rpnu1ll  mivi s  2um(rpot4tlen icilslaDelu snt0aexomf3tadfp r u i s)tetm(r iu1lltelici t)srta(ronu0opt  feiasfm ran p t0teenxf oy1laD auvo;s t2uoio iy1oltn fct t)a2raumono1tetoii3tldlm el( pnu4texrxr tadom  lnvils0s2toxo3nodap nmfcsl()srurx ooo0tlx mfeiyd m rau o;(4aetnio oo1fpt ln o () 2urxmpnodole mfetat) 2tru  ;t4tetnmfetys s em( onu0trxrxr3oadop e n o;(  etm(o ou1ap nlnvs tfs2trxro;o4tpxomociltfa rlnms u) lxoxo3iadoat  n ilt0s2ur(rpoy4am  lfesls)artr(ro;u1olt if3iltlsDeln p u0trtnir3oadfm   nvo (0sexoio3oy4omtelnes sfsrtrxm ;o4olxo fcildfsDrmn s;u4tlermrcoatoa elivilt)setr(o3nu1op  mivi s)a2raxr nt1tltnmietld s ul(mp u) exnxo io1la r uvo;t)trurimpnu4llenmnct t aDua(mpoo4olto ietaslsDemnvs;u0alerxfciotopDrlu o;(0 2xoxopoudopt mnetlt sDta( o;t1optnio3ilt m elums u)trxnio oo1lat aues s)tetmim nudlpenlfet s)s2tr(mono1tleoio3tltfm2elnvs;u)tltnmf3ootfaDrlu i;t) etoim3nu4optelfeias artr(ronu4alenmietadlm2el( sn(4aetrmocoytlm  au il(0sexoio iy4omt lncsas)s2um( p;o4apen o3tydfm ea(vp;()artnxf3oydla eai i (0t2xm(o3iodomeelnei t)arrmu onu0ape moeiadfaDrlu o t)trxrio oodlaDr nvslt)sruoim3oodal  livil( a2taurp;u1apeo f3iad aDel(mo u4tlenir3to1omDe neo () eur(r3oodomte fvta( sDraump;o0opxo oeiltfm ul(vs (0arxnxo tydoptraivo;t0 2to(m3oy1apt  fvils)aDtrurp;u1opxomfcildlmDeaumpnu4 lxomf3tadlm eaivs (0t2umxo3iodale mfeiatfsrtruront1opeomo3ild a emnms;(4trenmr iytop eau ols0setoio3oy4lpeelnvias)srta(  no0oex mo3tatlaDeanvs t0aexrmo todoatr u o;t s2xrxr3no1optn icsl( aDra(r no1tltnio3ias s ulu o t4trtrmf3oodfmDelnvo;s0t2toio oy4lp n ivs tf rrax o;t4tltomoctltfaDeanvs t0texrxr iotlmDe u o;t0t2urxr3ou1olee ivi ()aDumxm ou4aetniictytlsDulumsnt0 eeoxf3oytfptrli i;t  rtrxr3no4alenmnvt ()s2rr( pou1tptniociydlm2ulnvont0alenxo oadfm  ln s s0 2trim iu1lmt mivtl()arurxr ou4aee  i3iydfm raumpnu0 ltrio oadoa e nei t srxoxrpou1apte ncs t)srtrx ono0oet mf3iasfsDrlump;(0trenifctytom   ues () 2to(o3nu4lltemfctlt)arrrxmpnt0oee mietltlm rl( s;u4trtoxo oytlmt lneo;()s2trxr3ou1oltn fetasf 2taxmpnt0aex mo3iat a2emumpnu4arxomr oa1lp eanes ()s2trxo iy4ol e neta()aDrmuroot4oltnio3tltlm2rm( snu4aeeomr iadoaDran o s t2xmxo ou1am   nvs t)a2trx  ot0aleo f3iatfa el(mpnu)tetnmr oy1omDraneol()sruo(rpou4ameemfct (fa2urxmpou4opxomf3ilsls em(msnt)aetnxo oatfp elivi;t s2toio oudlpeelnvt s srtmxr ot4aetoiociad sDeauvp u)texomrctodfp e iei;s) etmxrpiydlltnmivt (faDur(mo;t4oexomociyd m umnmo;t)arxoxo3ty1fmDe u sl()s2tmirpnodamtnmnvilt) rrau  ;o1tetnmietldlsDran p;(4 rxrxfcoodopDeli s;t0srxmxr io1opt lnei ( arumxrp;t1texn ietls s umn o t0 ltrxf3oatfaDrlivo ( truo(m3nu1am nmict t aDtaxrpoo0oeen ietyslmDrl(monu0trxomf todfaD auesl(0s2trxm iu4ape mfes ()s2tr(r oo4apt ioctydls2eanvpnt4 reomf3oadla rlivs (0sexr(o3nu1ape lfvi t) rrrxmonu0opt mf3tld a2ea( p;u4trtrir3oadlmDrauei;() ruoxr iodome licslt s2raxroou0altoifetatlm2rmn sn(0artrxo ia1fmDeaivi;t)s2xrir oy1lmenmietat  rtr(  ot0apto iciysfmDeluvs;t)treoxrcoydfpD lies (0setm(rpou4lpeelfvtlsfaDta(  oo1aptomoctasls raump (0treomf3oo1oa rau s ()s2umxo3nodap elnvils sDur(moot1ape  ociyt s2em( p ()tleoir3ootomD  n ilt)setrimpoo4olt livsa( sDtmxr nt1oeto ocias aDrl( s;t0treoir3oodfmtr i ols srtoim3ny1lpe mieta( sDur(r ;t4opeomoeiatfsDrlnmo;u0aeerxf oytlp e n i;s s2uoimpny1lp  lies t sDurumonu0oexniicilt s rl( p t4 eerif oydoatr uvi;s t2tm(o ny4omen fctltf 2tmxmpoo0tex  oeiydfm2rauvs;t4 eermr3oytomtr i i t)setm(m3iudolte iviat)aDrax o;u1olxoii3iadla2rmnmsnu4 eermfctotfp rai il()t2toiopny1ol   ivilt)s2rr( oot0teto ietysla2elu ont0altoio3tydlaD  u olt seurim3no4lpteliei t) Dtr(mo;o1altniictadlm eaumo;(0tlxomo iatfp eaieils)srxr(rpiy4amee fcs s)aDrax pno0aexo fctlt s2eau o u)tleoxf3oo1lmDelneols0 2um(opoy1am emivsa()aDuax poo4tpx  fctldla ea( o t4tltoir oatomte uvi;(0 euoir iu4ll n feilt srumu p;o4ale  ieiyt a2ra(mon(4trenmfciytla  aivs s) rurxo3io1ome livt s a2raxrp;o0optoioctlsla emu pnt4aeenmr totoa rau i;()s2xmio oydlme mivils s2ta( o;u4opeoifeiltlm2ra(vo u)altnio3oytlmDeai slt srumirpoudal  mivt ( srra( pnt4apx mfctyt sDemumsnt0trxnif tytomDeluvs;()setmimpio4aleelicia(f Dtru oot1tpxnmiciasls2ulu snu)altnmf ootomDe nvi;t0t2to(mpiu4olee net tfsrra(root4tlto ieiytla2rmn s (0alenmr3iydfp raues ( s2uoirpoy1lpe lnetls  2ta(ro;u0ope mietltfs2ea(mo u0tleomociy1fatrauesl()srxmxo ou1omenlncs t  2rm( pnt4olxo ieilt sDem( pn()tltrxo3iydla  aies;()srxm(rpiodol n fvt tfartaur nu0oeen icildfa emums;t4 lxrxf ta1fmtr nvs;t)s2tmir io4ame mfes s a2tmurp;t1alxnmi3iltfaDranmp t)tetrmo io1oat  uei s trtmimpoy1ll   nvils arrmxroou1oeto i3ild a umuvo u)aleoio3oo1lpDeanvo;s0s2umiopny1op   ictlt)aDra(mooo4tetoio3tldlm ulnmo u0trerxfcootopteanes t t2uriopoy1lme mictas)a2urx  no0openii3iys s emumo t0tltomf ia1la rlieols sexm(mpoudopt mfeia( sDuaxmpnu1tleomoctatfmDemnmo u4trtoiocoatfp   ivolt tetmio3ny1lm  mivtas)a2urxrooo1tpt mfciatfa rmump t)altrxf3tadomte u i s  2xoxr oodop nlfetl(fs2umxr nt4ole ii3tadlmDul( s;u0 lerxrctadoatelnvi s s2xrir oodomtn ivilsf 2rm(ro;t1ale  fcild a2rl(mon(4arxrxr ty1fm rlnvs s) 2uo(rpio4lmtnlfciatf Drr(rono0tet  f3ils m2ul(von(0treomo tydfpt anvo (  exrir3ny1op  lfciatfsrumxrpou0apeoiiciltfs elu p u)altnircio1la eaivol( s2xoxm3iudom n ieta()sDrax oou1alxn fetydls ra(mo;(0tlxriocoadopD anei;()t2xoio io1lm nlivilt s2trx o;t0openmieils m ua(mo t4tetnif to1omteauei s)s2trio3iudlmtn ict (fsrtrxr no0opt moeiltfsDulu ont0alerifctydfatrai ilt) 2umxr iu4lmtnlfes sfa2ururoot1teenmocild aDemn sn(0 etoiocto1fm  au il(0tetm(rpiodapeemict tfs2uax  nt1tptnifcildlmDem( pnu4aetomfcoo1lmt aivslt0 2trxo nu1aleemicsl() Drmu  nt4olxnmo3iatlmDra(mp (0texnio3to1oaDrai s;(0seurxo3iu1ll emneiat)a2trumpno1teenmfciydfm2uau snt)aetomocoo1opDe uvs;(0 exmiopnydop emfvilt  rrau pot1oexnii3tldla um( p;(0 ltomfcoydfmDeaiesls0tetriopoudoptnmneiat)aDumxr no4tpeo icild m rlumonu)trxoxfcia1fpt  u sl(0 2uoir3oo1lp  lfcia(fa2tmurono1tlxo oetydfsDul(vo (0tetrmrctotomDelies ()trumxmpiy1omenmivs ()srtmurpnt1alxomietadls2umnmp;u0tltnxf to1lptrln s;()setr(m io4ap e fvil(fsDtm(monu1oex mieiytfm2ea(vo (4tltomocto1opDraues;t)sexmir iudap   nei s) 2ra(mo;u1apxo o3ils a2um( sn(4trtnxf oo1fmDran sl( trtmxrpno1lmt  fcia( arum(mpnt1apxnmfeias mDea(ms (4 rxrmr3tytfa rlieo (  2tmim3no1amt  ietlt)srtr(moot1tee  i3tld a2elnvsnu0 ltrxfcoatla rln i t) 2uo(m iudoptelieilt) rtrx pno0olt mo3iyt aDemump;u) ltoif tadlmDr n s t t2xm(o3oydal n ies t)a2uauro;t0oex iociatla2el( s u0tleoxr iatop ranvo;t) exrxopiu1alt lfes s a2uaxmo;t4tltniociadlm umumsnt)tltoifciydlm   nvi t)seuoxopiudalt  ivias)aDtmx ooo1oleomictytlaDea(vs (0aetnio tydlptr i o t srtrir3oudlp   nesatf rururoot1teeomieiadfs rln o;u0aeeoio iatfp eaiei ()t2xmiopny4lptnmiciatfartaumo;u0alxoiictyt a2rluvs;t0aleomf io1oate i o t0tetrirpiu1ol emies s)arrmuro;u0olxo o3tyslmDeluvs t4tlxoxocoadlaD luvi t  exmxr oy1apenlfcsl(  Dtrxmooo4tlxo ictltlsDrm( p;t)aetrif tytlatr u sls)t2tr(mpny4ol  lies ()s2rau poo0oex mieiat mDrl(vsn() leoiociotfp   i i;()teto(m3iy4lmenmfvt s artrxr nt1tex ii3iyd mDrlu sn() lxnxrcty1om eli o;()srtoim3no4alenmncilsf rrm(  ;t4oet  ocilslmDumuvs () rxrir oo1lpD  ieolt  rxrir no4lmenlnctltfaDua(moou0aexoiociasfm rm(mo ()aleoxo oydlp elivs;s s2xmxo nydlp  mneslsf Dumur ;o1olxnmoetydls emu s u4 ltomf tadopte nvi;( truoio3oo1alt  nvi t  Dtrxmoou0olxoif3iytlmDrmnvpnu4aexrmf ootla r n s;s)seuoxrpoo4ape mfcsltfa2umurpno0tlx mo3iasfmDrm(vpn(0alenir tydopte ieo;() etmim nudomt  fcil() 2ta(mo;u0teto f3ilsfsDranmpnt)tlxoxf3oa1fmDe nvsl()srtrxmpno4lpt  ictas aDrruronu1oleoifeias sDel(mont) etoxf3oo1omtr nvsls0trtr(mpnu4ll elfet (  2tax p;o0tex  ieiytfs em(mp t0tleomo3tatfa eli sls trxm(m oy4ll e fvil()sruaxr nu1tpx ioetltlmDran o u)tlxomo3ty1lpt aivs s) 2tm(m oo4amenlnei s) 2rrurp;o4opxomfeiydfm rmump u) eenxrcty1fp  livi t  2xmxmpoydomte fvs s)aDtau p;t0apxnifeildls2uaums u0 leoif iytlmtrauvil()texm(m no1omtnmfesls  2urxm nt4tee moeias s2rluvo;t0 exrif tadom rai i;t0 2uoxopio4omte fctlt)s2tax ono1tet  fetldfm el(vsnu0areoirciadlatraneo;t)sexo(o iy4olenmivils)sDur(r nu0opxo ieiyslaDemnms;()tetnxr3oy1latrli sl(  rto(m nudope lict sf rumx ont4aee ii3iadlm2uan s u4trxoio oa1oa   u i;t) rtrirpio4omtnmfvs s s2umump;u4tpenmictldlmDumumo u4tetomr ty1oaDrluvi s0 exr(o3nydlp n nesls srua(m nt0olxniocildls ul(vo t)artoir oo1lpte uei (0 ruo(rpoudlpt mics ( a2ta(moot1altomo3tlsls emumpnt0 ltrir ty1lptr nvs ( t2umiopiydaltnmivi s)s2rrumo;t1olt mf3tls mDel(vp;t4arxomr3iadfmte nvs;s) etmxm3io1amenmfcils)s2rru oot0teen ictltla2eauvsn(0 rtrif3tatfp eaieo;t0srtmxrpio1ll n ncs t sruaxroou1oeeomoeiatfm eanvsnt) rtoifciatoatrai s t0srtm(rpnodal nmfct t)aDrm(m no4apx mociytlsDum( p t) rxomf3ta1lateau s s0s2xr(r nu1lm nlfvs t sDum(r oo4apxoiiciatla el(vonu)teerxo3tydom rlues t0 exr(rpnydalt mnci sfaDtaxroot1oeen feiydfsDua(vs;(0alerif3ta1omtr nvils0t2umxo3iudlm elnci s)srtm(rpnt1teeo i3iad mDrmn ont)arxrxf oatfaDr i o (  2xm(m nudaptnmiviatf rtru onu0teeo o3tyslaDuan s u)aeeoif3iotfpDrlu il(  2xo(opiodopeemnvsas) 2rmur ;u0ole if3tatfsDra( p t)altnmo tadoptean o (  2trxo3io1ole mfct (f Dtm(ronu4texnifetatfa umumo (4alxnmo to1op raueols)srxrxopno4am e fvs (  2rm(  ;t4oexnmoetyd a umn o () rerxo iytlat lieo;() exrxmpiu4olte ivtlt a2uaxmo;t1tpxnii3iytfmDeauvo (4tltoif iydoate ueslt) rtr(mpou1ll nlfcsas)aDua(mo;u0apt  oeiltlsDrlnvpnu4arerxfcto1faD aiei;t  etm(o3io4lp  lfvi ( artmxro;o1apt mo3iysfmDrln o;(0tltoxo3ty1fm ean il(  eurxr3oydlmtnlivsat s2taxrpot0tpt iieiatfmDuan p () rermocoydlpDr uei s) rto(r nu4amtnlnvt t  2rmu p;u0tpe mf3iadlmDulnvon(0arerxf iodlate n slt trto(m iu1omee ieiltfaDtaxmo;o4apxn iciydls ulu o;(0altnxr io1lm rln sls) ruo(o nu4lpt  ict tfsrurxm ot4tpe  feiys a eln snu)tltnmo iydfm   u i t trtr(r ou1altn fcilsf rum(monu0tltn oeiadls2rau o (0 lxrmfcoy1fa e neo;s0t2umxo ou4al   ivt s  Dumxrp;t4tlenmieiytfmDran pnu4aleoxrciytfpD lueil( trxoxo3ou1lp emiesat srurxmoou4oeeniieilsla umu pnu4arxnxf3oydfate ies ( srtoimpnu1ll emictlt  Dtmu pot1aeeomf3iytfsDrmumo t) eeoxfcty1faDeln i () rtmim3iydameemfeils)a2rm(ro;o1apeomieilslm rln p (4tetrmr iy1oa rauvo;()s2xm(r3oodoltn ivtat)srur(m ot1opxn feils s2emnmpnt)altomociytla e i o s0 exo(o oo1am  lfcsa(  2rr( pou0oltomociytfaDrln snt) reoio3io1lmD lues ()s2tmxopnudom   neslt aDraxmp;o0ale  oeiytlm ranvp;u) rxnxo3oydfat anvo;t0s2uoirpou1ll  mies s)s2tmxmont0aetnif3tltls2rmnvs;(0tlxnmr3oytfa   iei;()s2trim3io4am  lfctlsfaDra(  ot1texoiocildlmDul(vont4teeoif3oatlmDeln i;(  rtrxr3ny4alenlnes ( aDtaurpnt0olenifeiytla umu p;() rxomr iy1lpDrli o s0 etoxopny1llt lncsltfsDta(m ;t4opxnmoeiyt mDulnvp t0tlxnir oadomtr i i;s  euoxo nydll  mncsl(f rrmxm ou1alx  iciyd a ulnvpn()aexnio3tatlpDr iei t) 2umirpiy1ope  icsas sDua(rp;t1alxn oeilsfa2eauvo u4aexomf oadlatraneol()tetrir iudlmt mivs ()aDur(rp;o0tleoiictltfa rl( o (4teerir ta1omte nvi s0texrxopoodol emici t a2uaxro;t1olxnifetyd a2uluvonu0aetomr3tadfmteanvols0t2urimpiy1op   fvs sfs2raxr nt1tee  o3ilsfaDrm( ont) exrmociytfp   i s t)truoxr3io1ome mieias a2tau  nt4oleomociad s2emumo u)aetomr3ty1optr u olt)tetoir3ny4ale  icta()s2rr(mo;u4tptomictaslsDuau s;t)trtnir3oytoateauvo;()seumir3iu1am emnctls)artax o;t1alxnmo3iltlsDua( pnt0arenmo3oa1op   iei () 2to(opoo4optn iviatfarur(root4tlto oeiatfa ul( o t4altrxfcio1omtelueo s0s2uo(rpiy4openmivs sfsrtmxm ;u1olenii3iat s umuvont)aeerxfcoodom rliei;s)trtr(mpio4ale  netls a2tau  ou1tle mo3iatla eln sn(4trxnxf oy1om e uvslt) 2xrxrpou4alt  ictls  Dumurooo0tptnmieildfa2el(mp (0texrircootlate nes s)t2uo(m no4lp  licia( artm(mpoo1aptnmieilt mDumu s t4alxrmf3tydoat luvs t)srxmxrpnu1ol   iei () rurur ou4aetniicias s rlu s () lxoxr io1lmD  i o s) 2xmiopiodapen icsls)a2urx pnt0texniocils a2ul(mo;u0arerxocio1fptrln i s)s2xmxm3oudlpe mieias) 2urum no1teenmiciydfm2ea(mont) eeomf3totfat  nvo s)tetrir iudlmen fct () rtrxm oo0aet ioeiysla2umnmp () rermo3tadoat lueo;s0 rxr(o3nu4al n iciat aDrmxrp;u0aeeo o3tld aDea( on(0texoir ta1op  au ols trxmirpiodolenlicil(fsrurum ;u1aexnifciadfs2rlnvp;t)trxnio ta1oaD  nvs;s0seum(rpoy1amtnmneils artm(m no1aetnif3tltfs2raump;u0altoxr iatoptr ues t s2xoxr3no4lle  net tfs2rrurpoo0aexnmo3tad s2emnmp ()artnmf iodlatrai s;s  exm(rpoodal emfvi tfarrm(m ;u0ale if3iasfmDemuvsn()tltrif tydom  aivi;t) euoxrpoudlltelfvtlsfsDrmump;u4oet mf3tas mDua(ms u0tlermf to1fmtrauvs;s  rtrxr3iu1ap emivsatfsrrmx pot0oltoiicias s2eluvp ()tleoxr iy1lmteanvo;()setoxmpoy1lp nmictls  rua(rpou4alxoiiciasfm rmu o u0tleomf3iytlat  ueo s)t2trirpiydllenlfvsas  Duaumooo0ale ifeiad s2emumpnu4 lxoxo3tadoate u o () etmxo3nudopte ictl( s2rr(mp;t4tlen oeias a2eanmsn(4 ltrircoo1optelnes s0 2umxmpnu1opeemicil( aDrmu o;t0oetnmi3iasfa2rlnms t)alxrxociy1la  aivo s0 2tmxr nudol elieils)sDumx  nu0aetoiietatls2uau pn(4 leoxfciatlpD lu o t)setm(m3iydlptnmnei t) ruax p;u1tpx mo3ildla ranmont)aetoxrcoodfmDrli ol()seuoxmpnu4openmietas)sDurx p;u4tleomieiydfs2ua( o u)aeenmo totla r uesls) ruoxo iu4al nliet (faDurumo;u0apt mfeiasla ea( p;t0 exrmoctodoaD ln ilt) exoxo3oydalte ies t aDra(  ;t4tetnmfeilt s2uln o;u4alxomr3ta1lmtelueol(  2urxr nydol elfvtatf Dur(rpnt1olxn icild mDuaums u4 lenxo tatlmDrlnvi t0trxmxm oo4lpeelfvt t) rraxmpot4olt mfeilslm eanmpnt) rtnmrcoy1op   u o s)s2xmxm iy4ol   ivt t a2raxrpnt4tet io3iys s2umuvpnt)alxrif iodomtrln olt  exmir3nu1optnmicils a2urxmo;u4tltnmfciyt s uanvon(4 rtrxf todlmDe nvi;t s2uoio3oo1omeelfeils)sDrr(r ;u1apeoiietas s ea(mpn(0trxnxrcoatomtrlivslt0truriopny1alt liei s  2trum no0aexomo3iyd s ranms;t) eenif oatopt luei t0s2uo(m nydame  fctas)arururpou1tet mieiad mDemn s;(4alxrxocio1fp  liei;t  exrxo3oydll  mncs s aDua(r nt4tpto fciyslsDeauvsn(4teermrciadfmDe uei t t2toio3oo1amt  icias) rrm( ont1tlt ioeilt aDran o;u)aetoxrcoa1fp   uvo;s)t2tr(r3iodam e fes (farrrx o;t4opto f3iasfa2em(mpn(0altnxo3tadoaDraieilt) eumimpio1ameelivi tf 2rr(r nt1tetomieiyt a uanmpnt)tlxrmfctadlpteaieo s0srumxo3oudlmeelicslt artm(  nu0olxnmieiatfaDulu p u4trxrxocty1lpDean o t s2xoirpoodlme  ietasf rua( poo1aptn fciydfs2ua(vs;t0tlenxo3tydfmt lnvo;s srur(rpiodapte fvtas arrrum ;t4aee moeils m eanmpnt0 exomrcia1fp  lieil(0t2trirpou4apenmfctlt aruru o;u1aptnmociad mDum(vpn()altrmr3oo1oa rli ils tetoxrpiydomtnlfvslt) 2ururo;o1aleniociytfs ea( o;(4trtrmf oodlaDe u i s srxoir ny1optnmfcs (fsrtmxmp;u0aeeo oetat mDuau p u0aleomr totlateauvs;s)s2urio3io4ol  lfvtlt)aDtaum no1opeoiocildla ua( o u4 etomf3io1opt  nesls) 2um(m3no1lltelnet (fsDrrum no0aet  feilsfa rlnvo t)altoxocoodfpDrlneols0texmirpiu4omt  icil(  Dtaxr no1alx iicilt mDuanmsn()teermf3totfmtelnvo;s0seumxr3ny4opee ieil(fsruax pou4tle iiciyd sDelu ont0arxoxo io1fpDeaivilt0t2xoim oy4lpenlfeiat)a2rr(monu0opeo iciadfa2ra(ms u4tlenxr3tydfmt  ivo;t)seur(m no4ameelfcil(faDuaum ;t4teeniictaslm uluvp (0artomfcoodopDe uvi s) 2toio3nudomen nciatf rta(roou0opto i3iytlmDeluvp t4treoircoo1latr nvi ( setr(opoy1om nlnctls)artruroou1teenmf3tldfmDrlnvsnt) eermfctydfpD anes;s0 2uoxrpio1lle miet s  Drru  oo0tpx mi3iysfm2ea( s t0tlxrmfctatfm eaivi t)t2tm(o3iu1ol e ics ( srrax o;u0teeo f3ildfm uau snu4 lenio3tydfm  luei;(  2trim ou1lp e nvsl(fsDrmx  nt1aeen ietytls2umu o;(4tltomr oodfaDeaivsls trurio iu4ol  lnvtat)artr(moot0apenmictasfa2emnmo;t) lxomfcoatoptelies ( srumirpoydlptnmncsl(fs2trxroot0aleniieiatfa2rl(mo;u0 rxoir3ootlptrli ol()trxoim nodoptemivtatfsDuaumono1teto icildfm2ranms;u0 etnif3tadomte nvs;t0s2uoxm iudal  lictls sDuax  ou4aexnmfciys s eln s;u0 exnxocia1fatrauvs s  2um(mpny4ll  lfetltf 2umur ou0optnmociytlmDrlnmo u4 leoif oy1fmteli sls trumirpnydlpt mfcs t srua(m no0oexoio3tas m ua(vsnu0 etoxocootlp eanvols texriopiu1amt livi ( a2um(m ot0tpt mietyslm2elnvo t) etoxrcta1lmt  nvslt0 2xoxo ou1om   ivt (  2tm(rooo4opxomo3ias sDul( pnt4tleomrctodfmDr i ilt) eurim3oudlptemnesasfsDtm( p;o0aex  fciatfm2rln o t0 etnmr3oy1op raues;s sexrir oodomt lfctat) Duaum nt0oetnif3tldlsDea( onu4treoxr io1lptelueo;t0seurxo ou1am  miet s)srtm(  nu1alx if3taslsDra(vs;t4tleoxo3iatla ranvi ()t2xmxr3no4lme  ici t)aDumumoou1apt mf3iyd aDrm(vs;t) etnmr3ta1la raivo;t0t2xmxr3oy1alt  icils)sDumxm oo1apxnifetytfsDrl( s;u0trtnxfctatop   ivs s sexmim3nu1altemfct sf rtaumpnt0ape  ictadla um(ms t0arenxr oatomtrlneol(0 euoxopiy1al nmfeilt) ruax p;u0oexnioetlslm uluvo;u) rtrxociadfpDe i ols0 exmir3io1opee netltfs2rr( oot4alxnifetat aDuan o;t4arxoxr tytlp   ivo t)srtmxm io1lptn fvi (farrmumoou4oee mfeiltls rln onu4teeoio oo1oat lues;s)t2xoxr3nu1op  livsas  2umuroot0aeto f3iys a2um(vpn(0tlxrmocoytfpDeaneo ( trtr(m iudlmtnmnesls a2tmxrpou1apeo oeias m emu p;t)tetnmfctotopD anvil(0s2umxm3nu1ll n ncsat)a2rmumpnt1aet mictadfs um(vpn(0 renmrctotlpDrlu o ()seuoio3nodam nlics s) Dtaxro;u4aexomi3ildlmDrmumo t4tlerxfctatlmtrau ilt)s2xoxm3iy1alee feilsfs2ua( pnu1oeeoioeiyslm rm( o ()tetrif3iytfmD aneolt) rtoim iodap   ics ()sDrm(rp;o1altoifctlt aDuanvo () exnmf3ty1fat liesl() 2xmxm3iy4ll   ivta(f rtmum ;u0teeniiciasfm ea( s;()trtnmfctatopt aueo;s s2xoxr3iu1llenmneil( srrr( ono0oeto iciyslsDrmu p;(4 eenio3oatlmtelu o;()srurxo ou4lm nlivsls s2ua(m ;u1olen o3ildla ua(vp;t)tlxnmr oy1omD  ues;(0s2um(r ou4lme mncs s)srra(mpoo4oexniiciltfa2eluvs;(4arxnir3oodoptranvol( srtm(o3io4opt mfcs s)s2tmu onu1aeen f3tlslsDua(ms (4aeenmf3oodopDr u i;t0 ruoxopiydaltnlncs s) Draxro;u4olx moeiad m eluvs;()arxoxoctotfpte nei;t seurxr3ny1am emietasf Dra(  ot4opx  octldfs rm( p u) leomo iatfa   u sls) rxrxm3oo4om n nvsa(fa2tm(r ou1alt  i3ias mDrl(ms u0 etnmfcoydlaD ln i ( s2um(mpoy1lpt mfctl()a2tm(mpnu0alto fciadlm um(mon() exoio3iatopteaueo;s)trxrxo3oydapenlncia(fs2rmxr no4optomiciyt s2uluvp;u)alxrmfciadfaDelu i;t)seuoxopiu1ll nlicia()s2uau ono4optoif3iltlm2rauvs u4teenio ty1fp   nvsls trto(o3nydll elnvta() rtmuront4aeto ociyslsDrl(mp;u)areoxociydoaDr ivs;s trur(r3iu1alt  feiat)aDuaum oo4oeeniietyd sDea(mp t)areoioctodfmDeaieols0 rtr(mpoo4ap   fetlsfa2um(m ;t4tptoifeiydla eluvp;t4 leoirctydlm  aueilt)s2xmxm oy1omtnmicsl(fa2trxmp;t1alxo ociys a uanmpnt4aexnmfciatla eaues t)trumxm nu4al n nvi (  rumu  ;t4alenmi3iltfm umn s u4 etoifciotopt au o (0trxriopoydopenlfei tfs2umx o;u0aexoiociytfaDuan s t) etoxo3ootlatelnvs ( t2tmio nudopee ies s srrmu o;t0apxomfciyt aDelums;u) lermf iadlatr nes ( t2xr(rpio1om e nctl(f ruaurpoo4aexomf3ilsfaDrln p (4alenxo iydopD lu o s trxr(rpiu1omen ics t) 2raumo;t1tltomi3iydls em(vp;t4aetomrcootom   ivols)tetm(r3nodlmen nvil(f 2tmuro;o4oexo ocildlaDeluvsn(4tetnxo3tydlpD lueo;()sruoio oo4om n icilsf Drmxmooo4ape mf3iytfmDul(vs;u4 lenmr3tatoptrln o;s)teumio3ou1amenlfes (  rrmx  ;t1oee  f3ild m2uaump u4alenifctydlatraivo () rtrim iy4ome mfeiltfsDumumo;o1tpenmf3ildla ua(vp (4texnxo3oydlpDrluvo t  rxoxr io1al  lneia()srtmumpoo0tpx mfciyd a rmuvs t)aleoio ia1fat li o (0 ruo(rpnudop e icsl(faDta( p;t0oetn ieiyslm2uanmo;(4 exnio3todlmDrluei t  2tmio3iudlpe lfcta() rumurpnu4tleoii3iadfs rau s u4altrxrcoytoa   ues;s  eurxo ou4ale  ivi t sDtmxmp;o1alt  ociaslm2rmnvsnt4 rtnmfctotlaDeau ol( srurxr nydllt mfct tf rrr(m ;t4alenmf3ildfaDeauvsn() exrifcoo1opDr u sls0 ruoxm3iu1alen netatfsDtrxmpnt0apeo oeiadfaDeluvs (4aexoxrcta1omDr ivols0trtrxm nudalenmneta(faDta(m ;u4oleoiiciad m rl( ont0aexnxrcty1fat ln ols0t2uoxo3ny4lp  liesls artax oou0tlxoifciltfa2ua(vs t4aeenxo oadlpDr ivo;s) etr(opiy1llt livia()srururonu1aptomo3ilsfs emnvp (4tlenxfcio1op   nes;s)tetmimpiodome mnvi t)aDrrum nu0oltnmi3iysls2eluvp u4alxomf3iy1oaDr uvsls)srtrir ou1ame  ics t sDra( ont0apen o3iasfm2ua(ms u0aeenio3tydlm  auvsls) rtmio iy1lmtnlfvtat)a2ta( p;o1alt mo3iysfm2em( pnt) lermrciatlatrau o (  2toxrpnodapt  icsl()s2ur( ooo0tpx if3iytfs elu p;(4 exnxr oatfpDe u i (0seur(mpio4oltnmnvsas  rrmx oou1olt ifctldls eluvp;u4tetoifcoydlp r uei;s0sexr(m3iu4amtn iesas) Drau pnu0olxn oeias s em(mpnt4artoxf3oo1lpDe nei s0srurir3iodlltn ictas)a2trxmono4tlenmoeiasla2ea( snt0tleomociadopD  n sl(0t2tm(rpny4omtemieta( s2rmumo;u1tltoiieilt sDul( snt4alxoxr oodlp ranei ()trxrxo iu4lp e nvsls)a2raurp;t0tpx  oetyt a2ulnvpnu4arxrmf3oatfmtr uvo s0srtrxr3iodomenmfvs sfarraxrpou0tltomiciasla uluvp;t4texoif3ta1opDrai o s0tetrirpoy4aptemicil(f Drm( oot0apt mieiyslm rl(vs u0altrmo3oo1laDeanvs t)sexrxr3iy1opte fvi t)aDtru  nu1ale miciys m rau o;t4 exoxr3iadfate ueols0 2trim oy1ol emfcsa(f 2ur(  ;t0oet ifetat sDeaums;t0 lxrxo3totom   uvols sruoio oudllt  nvias srta(rpou4tet  feildfa2eauvsnt4 exnmrciytop r uvilt  etmio nudlptnmietlt aDraur no0ale mociltlm2rmump t0 rermfctatlat an o t t2to(rpnydllt liesls aDua(mpou4tltomoeiasfmDrmn p;u)artoif3oydoaD  ueo (0s2xo(o3nudap  mivtls sDtr(moot1tle  oeiydla2emu pnt0tetnxo3tytlmtr uei (  rtrxm3nodopt  net tfsDtrx  ;t0apx  ietadfa eau p;u4 etnio3iytfpD  ieils)tetrxm3iy1ll   ncslt srtm(r ;t0tle ifeiltlaDelumo (0 lxrxr to1fm rlivo;()trum(m3nodaptnmneiat) 2trum nt4aex ifeilsls el(vont4aetrmrciydfmDelivo (0 2xrim3nodllenmnvi () rrau oou0olt  fcilslaDrm(vs;() etrmfciodlatrai s;s  2urxr3nudal n ics (fsrtmump;t4aet  oetlt s2ua(ms;u0 etrxf3totopt aueo;s)t2ur(o3oy1oltn ivs t aDurxrp;o4tpxo iciyslmDeauvo;t4 etnioctatop   u olt)sexm(m ny4lm elfvs ( artr( ono1tex  f3iaslsDumnvs () rtrmr3io1lmtrai o;t0 rxmxrpoydap elfvs (f 2rrurp;t1optomfciltfa eluvont)aexrxocoo1fp eli olt)trum(opio1ale lfviat srta(r no1olxoif3iysfs2eln p ()arxoxo3tadfpDr nes ()seumim oodameelnesa( srtm( p;t4aexoiieiydla2rmn ont0aeeomrcio1fm rln ilt)srtoir3nydap  liesls  2raumooo1oet mociasfs2rm(mp;t4alenmfcta1oa  aieo;()s2urir ou1amee ics (f rrrxm ot4olt io3ils s2rln o u4altoio tytopD aivo;s0s2toimpiu1alt  nvilt) 2umu pnt4oltomf3iltls um(ms (0trenxrcoytfa  ln s s s2uriopiydolen iesa(fartrurooo1oexomoetatfs2rlnvo u4 etoxf iatlp  au o t0 eur(o iy4lptnlnes ( aDtaxmo;t0opt mo3iydlmDrmu o t)tetnxfcoydfp   u s;t) euoimpno4lmeelncsa() rtrxront0olen oeiad sDeau on()artnir ty1lpteli o;t)trumxo io1ll eliciatfsrtrumonu4tlxomfeils s2emuvsnu)teenir io1oaDr u o ()texrxr3nudalenmfeia(f Dururpnt4tpx io3iltfs2elumsnu4arxrir3iatlpD lu s;s  2xo(o no4ameemivtls  rrax  ;o4oexnmociatfs2rm(mp;t4aexoxo3todfmDr ies;( teur(o oo4apt  fesa()a2tm(m ;u4alenmocildla um(vo;u) ltrmf totomD luvsl()trurxrpnudap e fei ( aDtrx ont1aex mo3tydfm2rmu o (0teenmo oodoa rli s t  etmxopoo1altnmfvsas) 2urumoot0aeeo octadfs2ua( pnt4trtnxr3ootoaD  uvi t0 rxo(o ny4amee fcsatfs2tmumpnu1tpxniiciytfm umuvo;(4 rxnxo3tadfptean o;s  2umxo3oydlltemnesa()srumum ot0tptomf3tatfa2eluvon(4aexoxrcia1fa  anvi t0 rtmxo iu4ole lnvi sfsDrm( pno0olxnmociad s em( s;() lenmo3oydopD  ueslt trxrxopiudlle  ivtlt)arururo;t1tpe  oeiadfsDea( s;t4 rtrxr oytfmD liei;( texoir oo4am n feiat  rrr( o;u4oet  fctadlmDrlnvp;t)trtomr oa1fpDeau s;s0 euoir3nu1apenmfcias)aDuru  ou1aetomf3tadfsDrluvo u)aexnxr3totfmD  n o;( seuo(r3iydlm n neia( aDtau pnu4tltnioeiad mDumu o;t0arerir3oo1oa elu i t  2ur(m oudaptelfeilt aDta(roou1ale mocildfm ua(ms t4 etrmfcoydfm   ueo s) 2umxm iydom nmfcil(fsrraxm nu1oltnifctlsfs2rlnmpnt) rxnirciydfmD li o;t seur(m iu1ap nmnvils) 2umxr ou4opxnmoetydla em(mo;(0tltoxrciadlm  lnvi t)teum(r3oydlpee ics ( srtrx  ;u4tleoifcild m rmump u)tltrxo oatfptr nes s0seur(m3iu1lp   icslt)arumxm ou4apenmoctlt m2ulnmo;(0 lenmrciydomDrluvolt) 2xrim io1om   ieta(f rrax pnu4open octat aDumums t0tleoifciy1omtelneils texmxr3oudalt mfetat  Durxmpou0apxn o3tydfm emnvs;u4 rtnmr iy1fp elivsl(0srurirpny1ap  lnvs t)srtaurpoo4tlx  oeils s umn on(4trtoir to1lpDelieo () 2tmimpou4lmtnmnei s  rta(ro;o1aeeoioeiyt aDumnvo ()tltomociodom eluvo t) etoxm3nudlptelfvsltf 2taxrpnu4tetn o3ildlm2em(vp (0 rxrmf totom rai o (  euo(mpou4lpt mivt t arumx pnt0oex miciad m2em(vp;t0 renxrctadoptrlnvi;t  rtrim no4om nmivil( srraurp;u0oexnmoeiys mDrluvpnt4 lxnxr ia1lpDraueol( trxm(m oy1lpt licsl( s2truronu4apenmfeiydlsDrlu p;(4tltnmr3ty1late uei (0seuoxm3iudolt  netlt)arrru pnu0tpxnmoeiysls ulnms;t4 lxrmr ta1faD luvo;s)sruoxmpno4lm  mivtl(f 2trxr no1texomfetytfmDuanmp t) exoio3oy1laDr n ol() 2xr(opoo4lle  ivta(  rumumont4apenmo3ildfsDeluvo ()arermf3oodoaD  neo t0srxo(mpiy4lpe  ivsl( a2raxront0oee iiciytfs2umumon(0 leoirctodla elues;s0 eurxmpoo1al e fvs ()srum( oot4tptn fctadls2ra(vo t0texomo3oytfaDe uvolt  2urxo nodlmtemivta() Dururp;u0aetoii3ias sDrau p (4tltnmf tatlp   ues;t0t2to(r ou1opt lnvsasfaDtmxmoot4aee mo3iatlaDrau p;u0tlenmr3oytoatr n s;s  2toxrpoy1al elieil(fsDrmxr ot4oetniocils sDel(mo;u)artrxo oa1fmtelu ils)t2xmirpoudame mici t) 2raumont4tex ioctyt a2rmnmo u4aeenmociadop eaiei ()sexoirpiu4lptnmnesltf rumxmpnt1alt ifctysfmDranmp;(0tltomr iytfmtrli ol(0seuoimpoy4ome mfvslsfarra(rooo1tptn i3iysls2uanvpnu)aeenxo3ta1fpDelu s s sexm(mpio4lptnlnet ()srum(r ;u0alxoio3tldfaDrmuvp;u0 eeoio3oo1omD aivs t  2xo(r nodlp  mfvsas) Dumumooo1olt mfeiyd m2rln ont0arxnifcoadlmD lneols0truoxm no1llenmicia(f Drm(ro;u0tlxn oeiasls rl(vp u0tlenxo3iydlpt  nvs s truoir3oo4amt mfesas sDrr( o;t1ale  feildfs ea(vp u) lenxf3io1laD  n i s s2xmxm oydole lietl()s2tmx o;o1aexo f3iat sDem(vs;t4arxomr3iodlm e nvo t srto(o3ou1ap elfetat)srrmump;o1olx ifeildfm ul(vpnu)tltnmr iytlaDr ivo s)srur(m3nudopt mnci tfsDrmxro;u0alxo oetyd m el( s u) lxnioctytfpD auvs t teuoxo oo4olte nvta() rumumont1aeto ocilsfm eaumpn()altrmo3tatlmtran o t seurxr3nodaltemnei tf 2ur(rp;o0oltnmi3tlsfa ul(vonu0 lxomf3iydfmD livi (0trurxopnudalenmnes t sDtaur nu1alx iictatfmDemuvo;u0tlxoxrcta1om rlueilt  rto(r3iodam emnvt (f rumump;o0aleoifctysfaDranmont)texrifcto1la  aies s0seumiopio1lptn ncias  2ururo;t0optnioeiltfa umnms;u0altoxf iadlpD lieslt  eumxopoo4om  mfesa()sruax ono4oltn i3ilsfs2em( o;(4tltnmocoa1omDrli s (0s2uoxmpiodlmt mfctas  2rrxrp;t1texnmfctyd a umu p (4aeenmfcoadfaD an i ( trxoim io1ap emfvs s  Drrxrpou0tpeo oetasfmDem( p ()altrmf3oydopD  n sls  2urir iodamtn ncs sf 2ra( ooo0opx mo3tysls em(monu0 lenmf3oydom rlu ils  rum(opoudlmt  nvil(fsrua(m ;t0apx miciytlm2rmuvsnt0treoxf3oatfmteanvo t0srxoxo3oudllen fciat srtaum ;t4alt  o3tys m2rmu sn(0 ltoxfcia1lptr ieo s)s2xmio iodapt  icsl(  rumxmpnt4openmiciytlaDrmnvsnu)alxnifcoydopDe neo;t)s2xmxm3ny4lmtnlfesltfaDua(ronu1tpen iciatla um(mon(0tetnif3oadom e nvs s0setmio no1oltnlfcta(  rum(mont0tlt mi3ildlm2uanvsnu0 rtoir3oadfaD auesl()srtr(m iu4ll nlivt tf 2uru  nt4ale if3ildla rmnmpn(0trenmo3iytlmtranesls  eumxm3oy4optemfvtl() Draxr ou4opt moctls m rl( snu) rxriocoydlmtrlnvo ()srtrxrpio1lm   nes ()s2uaxm ot4oetoii3iytlmDrl( s t0 etomrctytlaDe i ols0 2umxo3iu1lpeelfei (f rrmurp;o0alt iicild m2em(vo t4trtnxf3iotlp  anvs;() etm(m ou1apenlfcs s)aDrax pou4olxo f3tydfm2um(ms u0aetoxo oatfpDran i;s) 2urio3iudomt lnvs t a2tmxr ;o1altnmi3ils m2rlu o;(4tltrxr tadlptr i sls) 2trxm3no1lp elietls a2um(mp;u1tle mictls s2eluvo;t0alenir oytoaDr uei;(  2xoir3oudol  mfes t) Duax  oo4texomoeiadlmDua( s u)aetnmr oadla  auvi t0 etoxopnu1ope  net t srrm(mpou4opeomfciyslaDua(mo t)altriociadlatrlivi;() rxoxopou1lp e iesatfs2tau ooo0ale ifctatlm2ul(vo t) rxnmrctodlmt lnvilt) rumxrpiodal   nciat  rtmx  ;u1aex iictlsfs eauvp t4alerircoy1lmDrauei s)teumxo3oodopeemieta(  2ua(mpoo4opx io3tasfs umuvp;u0tlxrif3iydlm e i ilt0t2xoim oy4am  mnciatfa2tr(rp;o4tltoioeild m um(vpnu0arerircio1oa   u ils sruoxopou4lpe  fvsatfarrmurooo0apt ifcilt sDumuvsn(4 rxrxo tadfat lnesls srtrxrpiu4ape mnes (fs2umxmpot1alenmieiyd a2eauvs t)aetnioctodla  anei;s  etmxopiodam elnctl(f 2rru o;o1aeto i3ias a rlnvp;t4tlxrmrcoa1lm elnes;s)texrio iu4llte iet t)aDrmu oot0tet mfeilsfsDrl(vpnu0 rtoir3iodoptrli sls trtmxm nodolt lietltf 2urxmooo1tpe  fciltfs rau s u)trtrmr iotfaDraiei t)sexrxr oy4ll nlnvsa() rrmump;o4alx ioetlt aDelu o (0 ltrio iadomt lu olt trtoxo3iudlpen nvtls sDum(mpnu0ape  fctyt m2umn o;u0aeenmrcoa1fa eaivo t setrir iudlmtemictas arumxm ou4tptnifeiytfm2rmu snu4tleomr3iadlp  lnvo;(0sruoxo3nodolenmicia(fa2rm(rp;t4tpxnmi3iyt m2ulu onu0tltomfcoodfa ean i;t) rtr(r3nydale mnctl()a2urxrooo4aeeomo3iad m em( pnu) exoif3tadfp  lu sl() 2urxr3oudop   iciltfa2rm(rpou0aetnmo3tat sDelnmsnu)tetnmo3ia1fat liesl() 2xmir ny4ap e nei ()aDta(m ;o1oet  iciasfs2umu s;()texrxr ta1lm  au i s) 2xmxr nodap nlncilt  Duaurono0oet  fetyd a eanvsn(4 etrmrcoadomDelieo s srurxopiudoptn ivsls)artmumont4opxomoeiysla2ranvs u4 reomo iytlm  lnvo t)s2trxo iu1am  mfvt s  2rr( onu4olxn feilsfs elnmp;()alerxr totopDeanes;s seto(mpnudlpe liei ( a2umu pno0tpto fciaslmDem( o u4trxrxf iytfmt lieil(0 euoxopnudlpt lneslt a2tauro;u0aex  i3iltfsDum( o u0altoxo oo1fpDrai s;t)srxo(mpoy4om emneia( arrau  ot1tpxoiietatfsDem( o;t) etrxr3iotfmDraueols s2xmxr3ny4apen ncsas sDumu oot4oex ioetadls ulumpn(4tetomfciy1lp eln o t0t2tmxrpou1ll   fet (faDraxr ou0tpxnio3iltlmDelu s;(0 etnmf tadlpteai i s0t2um(opou4apenlfct ( a2ta(moou0tle io3tld s2uau pn(0altrif3oodfat aieo s sexm(mpoodlle  ict (fartru pno4aptn o3tyt m2el(mpn(0 ltoxf3iotoa  livol( sexo(o3iu4lpenmfctlt  2taurpno4aexnii3iyt aDumnvpnt0arerio to1fmD li i (0srtrxopno1omtnlnci tf 2tru o;u4oexo i3iysls2elu pnu0aexoxfcio1lateli s t0s2xrxm3nu4ll n nciat sDuau p;t4optnio3iytfm2rl(vp t0trxrxoctotom rai o;s0sexo(m3iu4om n net () Dua(mp;u4tpe io3tyslm ea(ms u4trtnmr3tadfptrlueils0seurxrpiudape lnvtas  Drrxm ;u4tpxomfeiydfs2uanvp ()teeoio iy1oa elueols)t2tm(opno4amtnmfes tf rrmumpoo0opxniocilsla ea( o u)aeeoif3ta1opDrluvi;t) 2ur(m iodlmt  net s aDur(r ou4oeeoiiciadfm rmn p;u4texrxr todlptranvolt0sexmir nodaleemnciasfsDrr(r ;t4oltn fctytlsDrl( s;u0altnmocoodlate n il() rxrim nudoptnmnvta() rtmur nt1olt  ociltfm2ul(mpnu) etoir oo1fa  lu o s trxm(m3ny4ol n ici (f Drr( ont4tptn f3tatla2rl(vp u0aeenirciytfpD au i;s)trtrir3nu4alen nciat)srua(rp;u4tltoiictydfm2rmnmo;t)aeeriocio1omt aiei t t2ur(opny1ale mncsa()srrmxmoot1aeeomfeilt m2elnvpn() ltriociotop rlivsls0t2xriopoydapee netatfs2uru  no1tex iicild mDrau sn(4trxoifctatlmtrlu s (0srxo(r iudllee iet s arurx oot0oexn i3tytfm2ra(vp (4 rtrif iydoptrlnvsl( trxr(m nydolen nesls a2uax pou4tex  i3ils sDrmums (0aeenxo3ty1lpt auei ( tetrirpoy4olenmfvsl( artru o;o0tlxoio3iltls2um(mp (4 ltnmf3iydlpDrlivs;t0 ruoxm3ou4altnlnci ()aDrm(rpnu4aleomoeilslm rlu onu)tetoxo ta1fpt aivo;t  2xrxmpny1lm n fvi t) Dtmu o;o4aetnmieiytlm rmumo;u)trxrmfcoatoa  lnvo s0 2uo(m io1alt lfvsls srrrumpno4olxnmociasfaDum(mp;u4artnxf tydfptelieol()s2urxrpiudlp   ieslsfs2ua( ono1alxn ictad sDea( o;t0tltrxociotlpteliei;s)sexmir3iy1lmenlncia()a2rru o;t0opt  oetatfa um(vont4tlenmf iatlmDeaiei (  etoimpoydaltn ivt ()srrrx pnu1teto f3iytla2em( ont) ltnmf3tatfpDe ieils tetm(o3nudlpeeliciat)arta(r oo0olxnmieiys a2umn p u)arenio3ootfateau o s seumxr iudomtnmncil( s2rau  oo1tpxnmicildlaDrl(vp;t0aleoio tatlm   u s;s tetoxo3iu1llt  neia(faruaxmp;t0oeenmoctls mDemn onu4texnxr totomDeln i t0 2xmio oodlmtnlfci s  rra(rp;o1tpe  f3tytlmDua(mpnt)trtrirctydfaDrlivs (0texm(r3oodaleelnvsas)sruax  ;o0opxo f3tys aDuanvo t0teerxociotom rai s s  exoim oodlp n neta( s2raur oo4aee  f3iydfs2rmumsn(4altnio oodfpDeln i t)teumxopnu4lmt miei s s2raum nu4tltnmocils a2rm(vs;u0tlermrctotomDeaivi (  2xoxm nydoltemivtatf rua(moou0tltoifciysfm2rlnmsnt0 lxnifcoadfateau sls srxmxo3oudaltnmici ()s2rmx pno1opx mietasla2em(msnt4tlenmfcto1lm r u i;()t2tr(o nu4lmtn ictat)s2rmurpnu1ale ifciatlm eauvp u0teenmr ia1fpDe i o ()setoir3ou1lme licslsf Duaur ;u0alen ocildfa2ranvo u)aexnir oy1fateaivslt0 rto(m oudalenlnvtls a2urxmp;u0aetomiciyt mDrlnmo t4aexnxf oytomteln s ()setr(mpno4olte ictlt)srurx o;t4oeeo octlt a rl(vp ()teerxocoodfa e uvol() rtmio iudomeemfeilsfs2tm(ronu4olen o3iltlm2rmuvsnt0tetrmf3to1oa ranes;s)t2urio3iy1lmtnlfciat)arrr( ont1teeomf3tld a ra(mo;(0aexoif3io1lpD aneils) exmir iu4omenlicsa()s2ua( ont4tet if3tadfmDelums;u)tetrmfcoa1fmD aneil()s2um(mpou1oltnlicilsf 2urumpno4tpe  o3iatla em(ms;t) reoxf io1optr iesls0tetrir3ou1lmtnlnvia( aDta(m ;o1aexn iciatla rmn s t4 rermo3oo1omD lnes;s)srtoiopou1ome  nciltfarumx o;t0ape  i3iys s uln p;t0 ltnif oatom r nei s) exrxr iy1llt  nei tf 2rrx o;o0teeo fctlsfmDuau onu) rxrmf tatfaD luvi;t) rtmxopiy1omtelivs tf 2tru pnt0tltnio3iasla2ra(vonu4teerxf3iytoatranvslt0trtmxo3ny4oltelnvsas)aDra(rp;o0oltnmieiydlaDuanmp t)trxoxo3oodfptrlnvi ()s2trirpoy4alt lneia() rtax o;o4tltoifeils aDumnmo t4teenxf3ta1fptr ivi;s trum(mpoy1omeemnet sf 2rrx  ou1ale io3iydfsDrau onu)areoio tydfmD lueol( s2um(m oo1opt micil( sDtmumoot1oeeomfctysfsDraumo u0artrxr oo1om   nes;( s2tmim oydlltn nctat)s2tr( p;t0teeo ietldla eauvp;u4altrxo3ia1lpD li o;t)texo(r iudlme lnetas)sDrmx p;t4aeen f3iaslsDeluvs u4 rtnxrctadlatelu i s0trtr(opoudlme lnesat)s2rmurpno1apenioetydfa uau p;u0 rxoif ia1lm rau o s0 2xm(r nudaptn ivi t)a2rrx oou1alenifetydfm2ra(mp;u)aleoir todomDr ivi t seum(r nodome livil(fsrururpot4tetoifctysfa eln on(4trtomrctatfp rlivo;t s2xoirpny4ap  mfciat) rra(ro;o4opt mo3iysfsDel( p t4aexrmo3iotlm elu o s0srxmxopoy4ale mivsltfarur(moot1tptnio3iytlsDelnmo (4tltoxfcoodoa  auesl(  exo(m3io4lmt  fesa( aDur(r oo1alt ioetas s2uauvp;u0 lenio ia1la r uvo;s)srtrio no4ll nmnctas) Durxm nu0oexo ietadls ranvpnu0teerxf3oo1oatelues () exm(opny1llt  nvtas arrm(  ;o4aptnmictydfm2em(vo;(4tetoif3tytlaDelivi;(0sexmxm iy1ol  licil() 2rmu  oo4opt  octld a2emumo;t4arenmf oa1lpt lnvs (  exrio3iodlme  fctls) 2uax poo1ape  fetyt s ra(vs u0trtomrcoa1oate ivo s0t2urxopiodamt lncil( arrmxmoou0olxoifetadlaDel(vp t4trxrircia1lmDe u o t0srxoxr io1lle  ivsa( sDurx pou1teeniieildfs uanmont4alenioctotoatraneil()texoxo3oydome  neilt aDtmxmpnt1olxoifcilsfsDulu p u)treomf3oatlmDelivo;(0 rto(m ou1ol elnvsas  rra( pnu0aeto fciys mDel(von(0arenmf3oydlm ean o;s)s2tmiopiodlp nlics t  rtmumoou4tetnmociltlsDrau s (0altrio ty1omDe nvo;t  rxmio3io4openmfvsas) 2uaxm nt4olxn ieilt aDran p u0tltrmfcoy1fa rlnes t0s2to(rpnodom nmies s  rraum no4tltniietadfm umuvo (0 eerio3oytfpDelieil(0tetoxrpio4oltn iei tf Dtr(  ou4opxoifcilslaDrlnvo;u)teeoir3ty1fptelu i ()trxmim iy1opt lics t arrmum ;o4aexnmiciad s umuvp u)tlxnxf3oa1omt auvi ( t2umxrpio1am n nvs (fsrururp;u0tpe iociatfmDrl(ms t0 ltoxrcio1lp e neolt0 rxmir no4lltnlfvtasf rtm(mo;t1ale miciad s2eanms;u)trxnxr3oy1fp r uvi;() 2tr(r3io1aptemneils)aDraxmpoo1tlx  iciadfm ra(msnt4alerxr ootla rlieolt t2toiopiudale  ivs s)aruau poo0aex moeilt s2em( s t0altnxo3tytlaDrlnvs;(0trur(mpny1oltnmnesa(  rur( ooo1texo ocils s2rm(mp u0arerxf3ia1fpDr ieo t0seurim3iydlm e fesas aDuax ont0apxn ieilslsDel( s u)trermf3oa1omtraiei t seum(r3nodope lfvias a2uru pnt1aet  ociltfsDrlnmo u0tlxriociy1fmDe uvi s sruoiopnydam  lfvias)aDurur oo1ape  octydfm2uauvpnt0 rxnmr3ta1lmte u s;t) etrxm iy1lpe  ieiatfa2rmxr ot1ope mf3iadfmDelnvs;u0tlxomfcio1fa elnvo;s0srtm(opiydalee ieias) Dtaxrpot1ole iiciltfsDrm(mp;()artnmo ootomDrlies;() eum(r nodllt mnvias  rraxmont1oet  ietyslm2ranvo;u4aetrio iatomt lues (0teto(r3oy1ope  fvtas srrrumo;t0apt moctlsfsDem(vo;(0tetoif iotfate nei;s)texoxrpny1lmt mncslt) rtau  ot1opto ietyt s2eau o t)arxrir3ty1omD aies;()srto(r nydllenmiet t)sDumxmpoo0opto o3ilt mDrlump u) rtrmf oodlptrlnes t0sexoxo3ny1ole mneilt  Dumxr ;t0aeeo oeiys a ulnmont)arenmr3to1oaDrlies t teuoxrpnydomeelncsl( a2tm(rpnt4tee ioeiasfm el( snt) eerxo3tytomtrlueilt) rur(o3iy4ale  ivta(fs2rr(r ;u0tlenmoetas m2um( p;t4 leoxrcoadoat aiei;(  etr(rpoo4llt mnes s) Dtaur ;o0alx io3iytlm2rl( pnu)tltoifcoytfmDe nes s srxm
\ No newline at end of file
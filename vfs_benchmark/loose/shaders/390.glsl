@@ -0,0 +1 @@
+uvol( t2toxr3iydom nmivta()arrmump;u0oex moeiasfm2rmuvo;t0aexoxr3iy1fa   n ils sexmxm3no1apeelnetasfarua(  nu4tpen i3tldfm um(mpn(0altrmf oy1opte neo;t0 2toxm iu1om  lnvs sfaDtaum nu0tlxo octad s emuvp;u4 exrmr iotlpDelueo;(  rxoxrpou4ale lfctasfa2tr(m ;o1oetnmfciltfaDem( p;u0 ltrif iytoaDe n s ( trto(o iudap e neia( s2umumpnu4tptn fctatfm ea( o ()trxnmo3oodoat an ol( teuoirpnodalee icsa(f Dtmxmp;o1tltnmoctatfm rl(mont0artnmf3oo1laDrau sl( srur(o3iy4lptnmnvt s  Drrumpot1opxn feiat sDemump u4artnmr3iadlmDr nvi t srtrim3nodomee ncias) rrm(ront4olt mfeiatlm ra( p;(0tlxnir iytomtr ieilt)trxr(r3nodlle lfvtlt)arra(mooo4aee  oeiysfs2rmnvs t)aeenxo iotlm raieo;(0t2tmio io4lp n ivi ( arraump;t1tpeo f3iytfa eluvp;()arenmr iytopt lnvsl(0setr(r oudoltemneils arrax p;o4olxnifcildfa2umums;u4artrirctatoaD luvo;()s2trir ou1ope lfcils  2trxmpoo4olx mo3iasfaDul(vsnt)teenmf3tadfpD ln o;s) 2urim nu1om nmfcil(farrmxm no0tpxomfciasfm2rl( p;(4texriocoydla eluvi;t  2xmxo iu1olen fvsa( aDrmur ;u1oleomf3tytls2em(msnu)trtoxo3totfa   u ilt teurir nudlltelieta(fsrtr(r nu4olxo i3ias mDelnmp;(0teeomo3iodlm rlivi;t0 rtrxm oy4ol elncslt  ruauroou4tlxo i3tas s elnvo;t0arermf3ia1lmtrlnvsl()truoxr3oudlme lfei ()artm(  ou0texo f3iyd a2rau o (4aetoiocoodfaDeanvi;s tetoir ou4oleemfvils)aDrru o;u0tptniictldlsDea(vs;t0artrif3oodlmDeanes ( s2tm(o3io4lp   fei (f rua(  ;u0olxnmieiat mDrlnmp u4aeeniocoo1lmDeli o;()srtoxm ou1am  mivslsf rua( pnt0aeeoifctyslsDeaumpnu)aleoxrcta1faDean o t)s2xo(r nu4omenlfcilt aDurx oot4tetoifctad s2uauvpnt) exnifcto1oaDrlues;t  etoir oy1ale  ncsls  2rmu poo0opxnmi3tysfs umu p t4teeoxr3tadopt lieslt tetmxm oy1lp e ictl() rtru ono0tltomfeiatlsDemn o t0trtrxfctydfmtr n ils)trurxr ou1om emieiat s2ta(ro;o4alt mfcildfa2elnmp;u4aeerif io1opt lu i (0srxr(m3iy1ll emivtat) rra(roou1teen oetlsls ua(vp () exoio oydoatelnvo s srxriopno1ope mfcs tfsDrmx  ou4tetniictltfs elnms;u0trtnmo ia1fpDr nei t0srxoxopiu1am   fctat)s2rm(r ot1teeoiociatlm2em(ms;() rermr iadomte i ol(  etrio3ny4omt mnci tfaDtmurooo1oee miciydlsDum(mp u0trxomf3tatlmDe uei;( t2ur(o ny1lme lfvi (  rtm( p;u4aptnmi3tatls2eln o;t4 exnxf iy1lmDrauvi ( texr(m no1amtnlnet sfs2urumont0tlt if3ilsfm um( s u4altnif3oodlptrlu ils0tetoxo nu4amt mietls sDuaxm ou0alx  ieiltfm2ra( ont4aeeriocoo1fmtean s t) 2tr(o nudapte ici (  ruaxr ou1apx  feiyslaDemums;t) lenmfctytfpteaieil()teuo(rpoy4optnlivs tfs2ur(mpnu0aptnmo3iysls rm( s;t0alerir iy1laD ln slt0tetrio no1op e neias sDum(rono4oexoiociadfmDeaumpnt0 rerxo oydfaD aies s0t2uoir no4amtn ici t artru pno1aeen f3iyd s2el(vs;(0aetrxfcoytfmD livs s) 2xrirpiy4aleemics (  rumurp;t4tlt  ictadlmDrluvon(0aleniociotoa eli o;t0 rumxmpno4lpt  fvslt  Dtm(mpou1alt  oeiad a rmu snu)trtrxo iy1lp rluei;(0t2tmxr3oy4omt licsltfsrur(r no0tpeo feils s ea(mo (4 renmrcoo1laD auvi;t0 2toxo3oy4al n nvs sf Dtr( p;t0alxn ieiadfa2ua( pnu4 rtoxo tydomD aiesls) 2xm(m iu1ole mneiatfs2umur oo4opto ictld aDranvp t)altrio tydoate ueo t0t2toir no1olt liet t srraxmooo4oet ifeiadlm2em(mp u)artoxr3iadlpDrai olt srxoxo3ny1lp nlfct t  2rr(moot4teenio3ild a uaums;u4altomocoo1lat anvsl(  rxo(m iy4lltnlicilt) Durx onu0tptomiciys a el( p t0texrxocoodomt lu o;t srtm(opoy1llen ictls)sDra(m ot4tetoio3tadfmDum(ms;()aetoifcta1om  au ol(0s2xo(mpny1ame lfctas)a2tax ont4tlt iicilt s el( p t0 ltoio3iodopD lnvolt)trum(rpou4amtnlncsa( aDtr(m ;t1tpt ifeiytlaDumumpnu4 exrmr tydfaDeln sl()trxoirpoy1apeemfesas)artm(mpou1tpenio3ilsfmDrmu ont)aetrmf iadomDean o t)t2xoimpiu4omee neil() 2ur(mpoo4tee mf3taslmDumuvon()trtrir iotfa r uvil( t2xo(o3iy1lltelfcsatfs2tru onu1tpx  ieias sDra(vs u4tltrircoodfpDraueils)setoxmpou4amt livtlsfaDtm(m no0ape  f3ilt sDemn onu4 rxomf3oytlmte n s;()sruriopiy1am n feilt srrmxmonu0tltnifeiad a elnvp ()tleoxociotlmtelivil(0 rur(mpou1ole mieias  Duaumpot1tle mo3iys s elumo;t4tleomr to1lmDe ieo t srxrio oudamtn net t) 2trxr no4tltn fcild m2rlumo;t0aeermo3oo1laD  n sl( t2umxr iydamt  nct s aDtmxmo;u1oetn iciytls2rm(ms;t)aetrifctadfateaneo;(0teuoxm3iydlmte nei sfaDta(m ;u0tpe if3tyd mDemuvont)aeerxo3ty1oaD ai ils0sexoiopiodom nlfcsl(fa2raumo;o1olxoioeiytls rmn snu0aeeoxfctydfa raueo;( sexm(rpiu4ame livtl(f Dtaum nu1tpen f3iatfaDuau s (4 etrxf3oytfat lies;(0t2xoim iy1amtemictls sDtmumpnu0oeto ocildfsDuan p u0tleoxo totlptrlu ols0srxoiopou1opt  iesa( srtmx  nu0oleomfctltfsDrm(vs u) lxoxf3oodla   uvslt  2xoxo3ou4oleelfvtltfsrtr(mpnt1tptn fctydfm2um(mpn(4 exoxr tadopteauvilt)teurxmpoodamenlfcslsfs2trumo;t0altomoeilsfm2rauvp;u4 ltnifcoytomtrliei (  ruoxo3ou4am  mics s s2umur ;o0oleo icildlaDuln on(4aleoxoctodlpteli sl(  rxr(rpoo1oltemfviat) 2tmumpnt4tpt  o3iltlsDua( sn(4 etrmrcoodlpt  iei (  2tm(m3oydal emfctls a2tmu  no4apto i3tltfm umn s ()areoxo3tatopD  uesl()srtrio3oy1ap  mivtatfsrtaxrpou4apto ieiasfsDrlu sn()teerxf iy1fpDeaivo t0seuoiopny1ole lnvtl(f rumu pno0teenmo3iyd a rm(vs (0texomf tytfptrauvi (0s2uo(r3nu4ol elnciat)aDur(rpot4tpxoifeiysfs2emn o t4trtomo3oy1oa  aneo;( trtmio3oodom nmfvtat)aDraxr ;t0alt ii3ild s2rmums t0arxnmo tytlmDran ol( s2um(o oodllee nvsat  2rr(mono0tpe mi3iysfa ul( o;u)teeoio3tydlaD aneils) rtrir iudlltnmnesls  rtmumonu4alt mo3iytlm raums;(0tlxrmfctatfmD  ueo;() eum(o nydamte ivtls) rraumo;o1altoifcildlm ulnmp;(4 rerir3tytla   ivi t t2uo(o3ou1omt mnviatf Drmur ot0apenmo3iys s2ea( s (0 rerio iadfp r n ils0 rxmxopoudame mfei t s2uaum ;t4opxnif3iyt s2umnvo;u0arenmr iytopDrlies (0 rxo(mpno4llenmivtlt  rtaxr ;t1oetnio3iaslaDea( pn(4 rerioctydlmtrlu o s setmxo3ou4optnmnei ()srraxmpot0opto o3iydfa rmumpnu4tetnmocootlm rai o;t sruoiopoy4lme licsls arra(  nu4apt moeiasfm el(vs;t4alerif tatlpt liesl( trur(r ny4apt mfetas arrmum ot4olen oeilsfaDulu on() exrxf3tadop   ies s0 etr(r3io4ame lietas)sruaxmp;u1aexomietytfm2el(vsn(4trxnmo3oo1op eaivo t texoimpno1apen ivtlt  Dtaur ;o0tee  o3iydlsDul( o;t4 etnircio1fp   ivolt  2umxrpiu4lmt  nvtls aDum(m ;o4opxomoeiltfmDrm(mp u) lerir3iadlp  aiei;s)texoxo oydape mfvsls) 2rmx p;o1tetnio3iat a umu snt4artniocoy1fmt li o s trto(m iodapee nvtasfaDrm(  ;o1aetnmociytfsDra(vp t0 etoir3iydoatraueslt  2ur(r3nudlptemfci (faDtaxmpno0texnmo3iyd a emnms;u4arenxfcoatfaDrlieo t0trumxrpoodaptelnvtas  Duru  nt1tptoiieiatls2emnvs (0 exnmo ty1lptran s;s)setmir oy1lpee fvsls) Duaxroot0apxn ietltfaDuluvp ()arxoxfcoa1oatrlnvsl()srtm(r3iy1lltnlietasfs2raxrp;u1oetnmi3tlt s2rl(mo t4 etrmocoy1fpD  uesl(0 2xoimpno4altelietasfaruauroou4teeo feiydfsDuanmonu0trtoxr3iytfpD  ies;()seum(m3iy4alenlietlt)srur(ro;t1tlt  i3tlt mDul(mpnt) ltomociotfmteau s (  exr(m3nudolen fvt sf Dur(r oo4olxnio3ildls2eaumsn(4 ltrmrcia1fpteanvsls)s2uo(r3oo1am nlfcsat)sruaxmp;o0optniicildfmDumumo;u4 rtnmr3iotfaDeln slt)s2xrio3no1llenmici s  2rm(monu4aex ifctysfs2rau onu4aetniocoa1fmDe ues t  eurir nu4llt lfvs ()s2tm( onu0oeenmfctysfaDulumo (0 exnifcoadlatranvsls) rtmir3oodlpt lfctlsfa2rau p;o1openmi3iad s em(mp u4 exrio tydlm  auvslt) eur(o3iodame lfvt (faDra(m ou0tet io3iysfaDrlump (4tetrio3oydop rluvi t0t2xo(o oydoleemnet s)srrr( onu1alt mi3tltla emuvsnt0alenmo ia1om eau ol()teuo(r ny4ole  nvta()srrmxm nu0opxomf3iaslm2ul( p u4artrxf3tadoaDrauvi t seto(opoy4lm e iciat  Dtrxrpnt1oex ii3ias a eluvo;u0alxoio3tadfm ran i () etmir no1amt  ietat a2ta( o;t4oeen o3tasfm ul( pnu)arxnio tytlmteau s s0 rtriopiy4ol n neiat srtm( poo4alen fctydfs ra(mpnu4 exnmfctydoaD an o ( s2umxmpno1omtn netls a2trumpot0olx  fciys s um(vo t)aeenmf tydom e ues;()srxo(r3nu4ol nlfes s aDuaumpno1alx  octldlaDrl(ms u)aeeoxocty1omDr i s t  rum(m nodale liet s artrxr no0oexo fctatfsDelu o (0 ltrmo3ta1omtrau ols0 eto(r3nudllenliet t aDtrur ou4alxo i3tad m eaumpn(0 rtoir iatlmDeaivo s) 2tmxrpnu1opeelfcia() 2rr(mpoo0apxomf3iatfm2rluvp;()artomf3iytlpDelivo t0setm(r oudllee feiasfaDumurpot1open o3iys m rlnvp (4trxnxfcootfmtelneo s srxr(mpiu4lmtnmivsat sDta( pot0tlx mieiytla2eanmpnt0tltnxrciotfpDrliesls)seuoir iy4omt  fesa(f Dtau  ou1apxnifciat a ua(ms;u0arxrif3oy1fpDr uvo;(0 rtmim3oodlltelnciat)arra(mpou4aexomfetat a uaums u4 etoxrcoadlate u i;( setrio no4lp  lieilsfsrrau  no0tptomo3iatlmDum(vsnu4alxnmfctodoptraies (  rxrxm oo1lptemfes t srua(rp;u1ole iicild m2rln o;()aetomrcoatfmt auvs;s trtmim3ou1lle  nvia()a2rm(mpno0alenio3iadfm2rmnmp;u0 rtnxrcia1fm e neilt0trtoirpoo4ol elfetl()sDrmurpoo1aee ioctad mDrlnvo;(4 etrxo ia1omtrlivsl(  2toxrpou1oltelics (  2um(moou0tpxnif3iltla eaumo;t4teeoxf iydla r nvi s sruoxrpio4lle mict t) Drmxm nu4texnio3tasla2ulumpn(0tleoir3iytfate ies;s setm(r3iu1lme lfvt (fsDtaur no0opx mfeiasfsDrauvpnt)arxoio oy1fm  auvsls  2um(mpoo4ll elnetat s2uaxmonu4aeenif3tldfs2elu o ()tlenmf to1opDrlnvs t seum(m ny1omee ies (  Dtau pnu1tle  o3iadlmDel(vs (4trtnmoctadfaDr uvi;( t2xoio ny4lp  mieta()srtm(mpnu1tlen f3iadfs2rm(ms (4 lxnir oy1la e nes;()teuoxm iu1lpe lieils  rtrx oot0aetoio3iys s2uauvo;()aeermfctytlmD au il() ruoxm3iydll  mfes ()aruaump;t1oetoifeiltfs2ulumo;u4tetnxo ootfp rai o;t) 2xoxo3nu4ole livilt sDtmxr oo4tlx ifeiytlsDemnvs;(4tltnxr3tatop elivs (  2uo(mpoudaltemfes t  2rr( pou1oltoifeildls2ul( on(4tlenxfctydoa   ivi t trxr(o3ou4amt  fvs t  2rm( pnt0tex mi3tydls eaumo (0tleoifctodlaDr i olt)s2tm(mpiu4ap nlics s)srurumono1tptn fetadfaDean onu0tlxrmf ia1fptrlnei;s0s2xoxrpou1apeemnvt t) rua( o;u4opto o3ias m2rm(vo;(0teeoir3to1lat  ieslt  2xr(opiy1lp elncslt)sDumuro;u0olenmfeiys sDel( o;t4 eenmr3oytfmDrluei;(  exoxmpnu4omeelivs (fa2ua(m no1texo fciytlmDrmnmo u0teerircoodfmDrai s;s)seur(o3iu4open ivtlt)arta( o;t1teenif3ilt a2uanvo;u)arxrxf3oodlat anvs;t0 2xo(r3no4al e fvsl(f 2trxm nt1alxn feiytfs2eluvp ()alenif3ty1opte ueo;(0 2xmxrpio4am   ics t  2ua( pot0ole mieiytls uanmsnu)aeeoif todomt  u ils)t2xoxm ny4ap e ietl(f rrmxm ;o0tpt miciysfaDum(vo;t)tlenio iy1lp raivilt sruo(o ny4altemivilt  2trxmp;u4tpxnmo3iydfa2em(vp;u) rtrxfctodfaD livo t srto(o3oudap n nes sf 2uax pno0teto fetadla2rlnvonu0tleoxf3iy1fpte n i (  rxmxrpoodopen nctl( aDtax pnu4tptomiciydfa um( s;(4 ltrxo3iodopt  ies s) 2xr(o3iu4lp n nei t a2raxmp;o0tlt iicilsfaDelnmon(0treomo3oo1fmDeluei;t srtmxr3iy4ole  fesa()srrm(r ;t1opxoif3iatfm2ul( ont0 rtoir oatlmt aiesls)t2to(r3ou1amt lnet ()a2rrxrono0teenifcilt m2eanmo;t4aexomociadlpDr u i;t tetmxo iy1al  mneta(  rtrxmont1tpt moeiltlmDul( o;(4aexnio iatfatr nvo ()teurim iy1amt mneslt)sDta(ronu4tpto oeiytls2ran p (0 rtrir todoa elu o;() exmxm no4ll  mneils  Dtr( oot0apenii3ils mDum( o;t) rxnxo3iotlpt lieo;s  2uoir3oo1ll  mfvs () rrrxront4tex  ictasfsDea( s (0trxrxr totomtr nesls) 2trio iy1ol  mfcsa(f rurxrp;u4oetomociltlsDel(vpnu0 rxnxo3oadfmDrai ilt srtmim ou1opt  fct t) Dtaumoot4texoio3iydls eau p (4 reomfciydlaDraneo t0teuo(r3iudape  nesls)sDrau  ;o4alenmoeiltfm rmnmon()altrifcoatfpDr n s;( trum(o io4ome lnetasfa2uaumpot4tet iieiadfm emuvp u0trtnirciotfp elnvs s)teumxrpoudoltelneiasfarumu  ot0apx if3iysla2rlnmsnu) ltnircootoatrln s (0setmxrpoo1omt mictas  rtmx p;u1tleo i3tasfm eanms ()aetoxf3oytlaD lu s t0s2xrio oy1lltnmivta() 2raxrp;u1oeenmieiyslaDea(vp;(4trenxo3oydoptr uvs;( srtmir3oydol nmfvia(f rrrxrp;t4tpeomfciatfs el( ont4texnxo3iydomDeln o;s0 2xrxm ou4oltnlfvsl(  rtm(m ;o0tet ifctyslm2ulu o t)arermo3tytopDrlivil()t2xr(r oy4optelfcslt arra(r nu4apen ietltlsDrlump;(4 ltoxrctodoptr ivslt  eurxo3oo4omtelfctls  ruaxmpoo4aptomiciydlmDra( o;t4tetrir tatlpD aueo s) rxmiopoy4omtemfctas)s2tmxm ;t0teeo ociydlaDeanmonu) lxrmr3ia1fatrlu o;t  etr(opoo4ame  fetas  2uru pou0texn ietyt aDemuvo;t)artrifcoytfp r i il() etmio oudoptelnei sf Dra( poo1tpe  o3iaslm2um( snt0tltoircootopD  nvo;s  2xr(m3io1lme  nct s srtmx pno4aetniieiltls uaump;u)tetnmf3to1opteau ols)texoxmpoudll  lfctls arrmuroou1tle iociat sDuau o;t4arenir3todlp   uvi t0sexrir3oo1ll elfvs tfarua(rpoo4texo iciysfsDea(msnt) ltnircoatfm   nvs t t2uoxm iydlmt  iesl() 2ra(m nu0aeto fciasfs2rmn s;(0 ltomociydom eanvs t)setoirpiodlmt  fvs ( srum( onu1oee  i3tasfs2rm(mo u4 lxoxo3oy1opteaies;s  2xoimpno1apenmfct ( srtm(m ;o1ape iocild a emu sn() lerxfcoa1omD  n o s0 2xmxm3io4ap e icta( a2truroou4ale  ociatfs2rlnvp;t)artnxo tydoaDean i;s) exo(m nu1optn fei ( a2urxm ;t1texomieiytfa ul( p;t4 ltrxo ia1lmt lieo;t)setrxr3no4ol nlnct s)aDtmxr ot4aex iociydlmDem(vo;t4tlxnio iy1lat  uvo;t sexoxm iudamt lnetas)s2rm(m no4altn fcils aDrmnvp t4 etrmocio1fptrau ilt0srxoir iy1op   fvi s)aDumumoou4oeeoiictldfm2ul( o;t4trtrir iodfatrlieo t  2xr(opiu1lmt lict t artrump;u0aexo f3iytfa rl(mont4altoxf3iatlpt  ivi;t0t2uoxm3no1ol  mieil()s2tauro;t0ale iieiysfm2eanvo t)texoif oytfmD  ivs;s)s2uoxopiodom emfeslt)sDtaum ;o1oet mi3tltfaDumnvp;(4treoio oy1la   u o (0setrio iudoptnlnci (f 2ra(r no0teenmfeilsla2um(vo;(4tetnxf3oatoaDr iei t srxr(o3iydlle  netls)s2um(rpnu0tle moeildfs2ranms;t)trxrxocoadfpDe uvo;(0trtoir3io1lltn nctls aDua(mo;o4oeenioctydla el( s;t) ltnmo iadlptr ivi;()trxmxo3nu1ame mnctls  2trxr nu4aleo ociytfaDuaums;u) rtrxr3ty1om e u s s  rur(r iydomenmncsasf Draxrooo4oleo f3iytfm2rl( p;(0 ltomf3io1laD aieol(0t2toim3nu4op  lnvs tfs2tmu pnu0olx mfetydfm raumonu4 exnxr to1lateau ils seurim oo1lptnlivia(fsrrau  ;u1texomf3tls a eanvs;()arxnmrctatfpt lneo;t)tetmxmpou4ap   nviat)arrm( o;u1ape mfciysfm2emn s;(0 ltoirctatla rlu o t0srtmio iu4opeelnvs t) rrm(mo;t4aleo feildlm2ul(vp t)tltnmfctotlat aieo;s)setm(o iydole  nviltfs2ua(ronu4optnmf3iltls ra( s u)aexnmf iatfm  auvo;s texmxo oo4amte nct (fsrurumo;o1oee  iciasfaDraums;(4areomf3oatlm r u i;t trxrimpoydomte iviat a2rauronu0tltnmi3ilsfs2el(mpnt0 etnxo3to1oaDrlivi (0 eumimpoo1am n fct t  rtrur ou4altn ociat mDumnmpnu0 eenmr iatopteliei;t t2xm(rpoy4lp  mici s  rumum ou1tlxomi3tat aDemuvonu) renxo3iadlptr i s t0texr(m3oodllenlnctl(  Dur(  oo0optnif3iydfm eaums;t0 exomo tadop  au slt) rto(r3nu4lptnlnet t) Dum(m nt1openmo3tytls eanmpnu4 lxomf oy1om rai ol( srxoxo3oo4apt mivslsf ruau  ;u4tpe  ociad m rl( s t4arxomfctodfaDranes (  rum(opiy4ap  mieilt a2rm(mp;o1oex  o3tydfm ulnvo;u)trerif todlpD  nes (0s2xoxm io4op emfciat  2umur oo1opt  oeiasla umums;u0trxomrcia1op rai o s)trum(r oy4optnlfvtlt sDum(m nt1alxoif3iad aDul(vs;(4 lenxf oydfm  an o s  rtoio oy4olt mfvsls)aDtau  ou4tex ifeiyd mDua(mo;t4aetrmo oadopDeauvolt0 2xoxr3oy4open ivi s a2urumo;t4aexn feiatfs2ea(mpn()alxomo oatfmD auvil(  rurxm oudop   ictl()sDraurpoo1tlxomfctydla2uluvo;(0 exrir iadla  liei;t0trxm(m3iu1altnlnesasfs2uax o;o4optomociadlm2umn p t0trxnxo oa1optr nvilt)s2uoim3iydale mici s srrrumpou4tlx ifeiysfa umump t0 rxnio iydfm elneils0seurxm oy1omenlnctas srumx ont0olxo i3iydfa2rmuvp u4alenxf todoaD luvsls)setm(r3iodlle lnct (f 2taxroot1oexn feiyd a2umnvo;(0 rxrxo3ty1lp  ln il( s2tmir iu1lme lieia()sDrau p;t1teenio3iyd sDem(vsnu4altoif3iy1latr nvs;t t2uo(m iydamte nvslt)s2urur ;u4tleo icilt m rauvont)tlerxoctadlm r u i;t0s2to(rpoy4lle  ictasfs2uaxm no0aptnmi3ilslaDemums;u0 etoxf3totomt lnvs s0 rtoio3iodalt micilsfarrm(  ;t4aleoif3ilsla2rmu p;u)tetrio iydla rlueo;t0texoiopiudal  mncsa(f 2trx pot4apxoif3iatla2um(vp t4arenif3oy1oa  liei t  etrxo no1openmncilsf Dtmumpot0aetnii3iadfa2rmn o u0 etrmo oadoa elu o s0seumxo nu1lp nlfcsltfa2ur( pou1aee  fciytlaDeanvs;t4 eeoxocoytlm r u o;s0sruo(rpiydamteliesas)sDtmuroot1alxoioeias s2rmn sn(0aexrif tadfa  ln sl(  ruoxmpou4lpeelnei t)s2uaum ot4apx iictls a2ea(vo;t0arerxo3to1omtrliei s  2xrio3nodopeelnvil(faDrr(mpnt4tpxn ociyslsDelumo;(0aetomocio1omt auvs ( sexrxopoo4omeemiei s aDrmu o;t1tlxnmi3iltfsDelnvo;u0 ltomr3todopDe i s s)tetmxrpiy1ome licil( aDtm(mp;u1oex  f3iadlm ulnmsnu0texrmo ia1opDr u i s)sexr(r oo4apenlfeils artrx  ;u0teen oeildfm um(vsn(0altrmocoodlaDeluvs;t0setmxm iy1ap elietlt)s2umumono4altomietld sDuan s u4 renxo iy1lp rluei;s)setmxo3iodomt mfvilt  Dra(mp;t1aeenioeiydfs2umu on(0 etomf ia1fmD  uvs () rtm(o3io4lmt mivsatfsruaxr no0oleoiietldlaDrauvp (4tlenxr oy1latelueil()texmirpoo4optnmnvs tf rur(rp;t1aeenmoeildlm2ra( o u)aeermr tatfmDraieo s) eumio iodlle liesat) ruau oou0tlxomietys a emn p;u0tltrmr3tytfpD  ieo;t srtmio3ou1aleelieilsf Dtr( o;o4texoioeiydfaDea( pn() exoifctydlp e neilt)t2ur(o nu1lptnmnes tfaDtaxmp;t0aee  o3iadls2rm( snt0aleoxo oodlm   uei (0s2uoxr oo4lmte nct s) 2uaxm ;u4texn ocild m rlumo;t4tlxnxr3to1omtr u i;t t2xoxrpou1ame  fvta(  rrrurpoo0apxo fcias a2rmuvs;(4aeenmo3oodlpt  u slt0 rum(o oy1apee ieil()arrm(  nu0aleomfctyslm rm(vpnu) exnmf totlmDe ieols) 2xmxmpnu4olenmivslt) 2uru  no1apeomo3ils a2rlu ont4aleomo3iadoa   uvslt s2umxm oy1olenlncsa(fs2ur(rpno0oltn octydls umu on() lxnxf iadlaDeaiesls0 rxmir iu4ameemici ( sDtmum ou1oetnmo3iad s umu o u)trxrio3oy1omte uvi;t trtoio3no1om emfvilt srtmuront4texnio3tytfa um( snt0artnif3iotlatrlueo;s0 ruoxr io4llee nei s) Duau onu1alenmfeildfsDuanvs;(4aexomrciydfpDeaueols) ruoxmpiu1opt  iciatf rrax  nu0teeoio3iat s ea(vs ()teenxo iytfp  an s;t)sruo(r oy4alte fvias) rrmu pnt0oexnmi3tltlm el(vsn(4 etrxfciatfm   nvi;t) eur(m no4ale lfesls)aDrmurpnt1oetoiociyd s ra(mo (4teeoxo ta1la rauvo;s) eurxmpny4lpenlnesa()arrmuro;u4ope  i3iyt s umnms;t0arerif io1faDrlnvo;(0setoxm3oo1op  licta(f Drr(moou4aet mi3ildlm eau p;(0 lxomo3iytoaD lnvo;s0sexoirpou1ope  fct (fsrra(moot1oleniicilt mDean p (0 rtnmf oodoa rauvs;(0 euo(m oy4lp e fetls  2um(rp;o4aetn iciyt a raums;()artnxocoa1fmtraneslt srxm(m nudop   ictas)srtaxrpno4aexniiciys m eauvsn(4teeomo to1fmte i i;(0 2xo(o3iydom n neia() Dtaumpot1aee ifcils m2ean sn(4teeoxf3ta1lmtrau o;t)texoir ou4openmnvil(fa2tr(ro;t1ope mictytla2em(vsnu0 ltrmr io1opDeaivo;( t2xo(r iy1ll n iei s) rtm( poo0openifeiltfsDemu o (4aexoir tydfaDraivo;s0 2xmir3oy1omee ivsas)aDurur no0aex mictlt a ean snu0 lxoxo tatopte nvo (0srxoimpnu1op  lnet sf rumuro;o1texomicilt m2uau pn(4trxomfctatop  ln o (0t2tr(m iu1lpt micsls arum(root0apxoioctas s2umnvp;u)altrif tatfaD aneols)setoio oo1lp nmfvt (f Dtr(roou1oexomictytfm2ulnvs t)artnircoy1om rlivsl( sexmir iy1opee fctls)s2raum ou4tleomf3tltlmDemnvsnt)aeenif ia1faD luvi;s) rtoxo3iudomen nctl()s2ururont0optomfeiatlsDean s t) eenxf3tadop  luvs t)srxr(o no4ape  ncsa( s2tr(r nt0olx if3ildfs ra(vp;u4 eermf oydfa ran i ( trxmxr ny4omtnmivt t)s2rau  ;o4aet  fetadfs2rl( pnu4 rtrmocoodlmD aneil( teuoio nu1ll n ncsat) rrrxr no4altoii3ils s2eanmo;u0tltrmrcta1fmDranei;t s2urxrpoy4lme mnet s)arrmx oou0aexoiietld m2emumo u)tleoio3ta1oaDrlu il()tetoir3no4amtnlfvt s srtrxm nt0oetomoeiysfaDea(vsn(0 rxoxr oatlm  an s;s0 2xoxo oydoptelfvtat  Dtau  nt0oetnmoetyt a ea(mpn(4 rtrifcia1lmteli s;s trur(o oo1altemivtat  2urx poo1ale mf3iytls emumo t0teenmr3ia1fa eluei s) etoir nu4lpt lnvs ( aDur(mont4tpxn fciys a rmnvs;(4 leoxr3tadlaDe uei s srtoxm3iudomeemnvilsf Drrx  ;o1opt iietlsfs ranmsnt4alxomr oodlmtrau s;s0 exrxm ou4aleemfcilt s2tr(moou1olxn o3tls m2rluvo;t4 ltnxf3iatfptr ieo s  rtrxrpnu1llee fctasfa2ta(roou4ope  o3iytfmDrl(mpnt0 etnmo3oydomDrli ilt0seto(m3iu1opt mfvi t artaxmp;u1oleo o3ildfaDum(vpn(4artnio iy1oaD  ueils0s2xm(r io1apt lnviat) Draxr ;u4aetnmfeias a um(mp;t4 rxnir3totlpDeluvilt)tetr(m3oo4lp  livt s) rrruro;t1ape moeils s2ulumpnu4teermf3iodlaD lueol(0trxrio oo1om emfvsa(faDtmx ono0apto ieiadlmDran o u0aeenxfciy1fm   n slt)t2urxr3oudll  livs s)srtrxmpot0tlen ictldla2ua(vp;(0aeeoxr tatlpt aueslt sexr(m iodape  ncias a2taxroot1aleo o3tasfs rmuvo;u4artoif iy1oaDr ueolt) euo(o3no4opee fetl( sDrm(m no0optn ociyt sDumnvs;t4aexoxrcto1fa  ai ilt0srxrxmpoydalenmivsa(fs2rm(r no0tleoif3iadfaDua(mpn(4trxrio3io1fmDr ivi t setoiopnu4om n fcs ( sDurxm ;o0ole mf3tydlm2umnmp u4trxoxfcta1opteai il(0 exrimpiy4alen neiat  rumurpnt1olenioetatfa umu pnt4altomo oo1omDeaivi (0 etmir iy4opeemfvtl( sDtaxmo;t4tlto feiatla ra(vs;u)texrmf ia1omDelu i;(0trtrxrpno4lle  ncils) Dur(m ot0oex  ictatfm2umnmo u0aeeoxo3to1lm eau s;s  rtmimpiydap elfcilt) 2ta(ronu4apxnioctytfsDelnmo;u4alxoio3oydoaDraivs () euoxm iudolenmiviltfaDtmxmp;t4tlto i3iatfaDean pn(0trtrif3iytlm   ueo;t  etmio3iodale lietlt) 2urx p;u4alto f3iasfaDrlnmp;()texnio to1lat liesls  2xrxr3nydllt mieias  Durxmpnu0tex  ictydfmDrmnvp;u0altoxr iytfatelivo;t)texoxr oy1opte netlsfartau p;u0tlt ifciadfaDrlnmo;t4 rerxr iatop eau slt  rtoir3oo1alenmfvt sfa2ta(monu0oex  f3tasfaDranvonu) rtrir3iy1oaDrlieo s srxmim nodame lfvi ( sDrr(r nt4oet  f3tltfs2uanms;u4tleoxo iotfm e n i s s2xmxo3oo1ll  micsa( a2trx o;o4aeen o3iysfm umums u4artrmf ia1fmtranvsls)teurxo3nodop   feiatfarurumonu0aexnmf3tyd mDuan o;(4 leoxf3oydlmtelieo t)srtrxo ou1apt  nci t aDumx onu0opxo fctltfs2emumo (4tlerxo3iadfpD  ivi;()seto(opnodoltemics t srtmu pou0apt if3iad sDul( onu) lxoircoatom rli s t)setmxo3io1alenlivil(farur( pnu4tex  i3iat m ea(vs;t0 lerxociodfm rai s () rur(m nu1amen nvt t aDrm(rpot1oee moetadla2eln snu0 etrmfcoadlp eluvilt s2um(mpny1oleemnvi t) 2raurp;u1alt mietltls eau pn(0 etnxo iodop e uvi;t0 rumir3ny1llenmncsltfarur(mo;t4altoif3ildla2ul( pnt4texoxo oo1fp   ueo s) rxrim ou4openmfcilt)a2ur(mpot4ole mi3iltfm rau s;u) rtrmr io1la rlnvs;t t2xoio3ny4op  lfvi (fsDtaxmo;o4altomfeild a2ulnmo;t)aexoio iadfaDrlivi;s0 exrim3io4om nmfeiltfarrrur ;u1ope moeiysfa ra( s (4texnxoctytoa ranvs (0 2uoim3iu1lle lfeil() Dumx ont0tlt ifctat mDeau p ()altoir io1faDrli s;()texoxo oudlptnmnesas sDumurpnu0oexnio3tlsfaDrmump;u4altnmfctatoa  lnvs;t seum(r oudlmenmfeslt)s2ua(  no4olxnmf3ilsfm umu snt0arxnmr3ta1fmDe uvi ()s2uoio iudaptemnetl()srtrumonu0aptnio3ildfs ulumont)alxnxo3iatlmD luvslt teurxm iy4lpeemfcia(fsrtrxroou0aee  o3iyd s eaump t0texrmfcoydlat ln i t trxmxo3oo4olt lnetasfa2rmumoot4opx  i3tysfmDrlnmo;u) rxomfctadlmt aieil(0s2xr(r3iu1ame  nvsltfsDur(rpno1tptomocilsfa2ulnvp u)trxrxr3ia1lmDraues s0sexoir3nu4lm nlfvtas)sDtm(rp;o4aetn ieiysfm2rlnmo;(0trtrio3tytfate i sls t2trxr3ou4lmeemnvtatf Dururoou0oleo oeiatlm2rau on()altnif todopD ln slt0texoxm3no1llen nviltfartrumont4alxomocilsfaDran p;u0arxnifctotfm  auesl()t2trxrpnu1lp   ivia()arra( oou4tee mo3ild mDemnvp;(0altoxf oytomD ai sls s2xo(o io1ameemfci t)a2tm(  ;t1tpeomocildfaDemu s;(4 reoxfctydomD anei t  rtm(opou4ale mietls  2ua(rp;u1tetnmi3tyslsDemnmp ()tlenmr ia1lpD lueo ( seto(r ny4op e neils  rtr(r oo4aetomfctyd aDrluvp;u4 rtomf3iatfm eluvo;s)texmxm3oydlltnmnct ()srtr(  ot0tpxomieiasfsDeanmp;t0aleoxf3oadlp elnvo s) 2xmxopou4lmenlnct t arrmxmpnu0teeniietyt s eanvo u0aeeoif ootomt lueil(  ruoir nu1oltnmnesl()artrumpnt1aeenmieiasfs2ua(vs;(4tetrxr3oydlp ranvi;t sexrir3io1ale  fvi (fsrum(ro;o0oltomiciytls uluvo u0alxoifciotlp  li ol( teumio iu1olee fviat aDua(moot0apenmoeiydls2rln ont)tetrmrciodlaDeluei;(  rxrim ou4omt  nvt tfsrrruroot4opxn fciatfmDuanvonu0trxrmrcootopt auvs t  rxrxmpou4opt lnetasfsDurxmpou4tetn ietatls2rmnvp;()alxrmo iadopDeau sl( setm(r nydlpt mfvi (f rurxr no4tltn ieildlm2elnmpnt0altoxocoo1fpDrln o;(  2xr(o nydole lncsa()s2uax  nt1alenioeiat s em( p (4tlxrir3oatfaDr ueo;t0tetoim3iy4lpeelivtls  Drmx  no1apxomociytla2umn onu4aetoxr3oy1lmtr nvi s)s2uo(r3nudopt  nvt (f 2umxro;t1optnifeiysla2umu s;(0 rtomo oytfpt  neols  rtoxr oo4al  mnvsas  Dtmu onu4tpe  iciad a2el( s t0tetnio3tytopte n il(0t2tmxr3oy4al  mfctas)artrumpoo0tpe ifciytfa2rl(vp;u) eenmf3totfptrlivi;t0texm(m iu4al   nviat)sDrrxr ;o0apxnif3iatfm uluvonu)texrifcia1fatran o;s0 2trim io4ap elnvilsfa2rrumo;t1apxomiciat m umnmonu4teermociotlm  lues;s0s2trxm nudamt mivta(fsrua( p;t0aeto f3iltlmDem( snu) ltrmrctotfaDeanvil(0srumirpio4omt  ivias aruax oou1texnmoctls sDra( on()treoxr ty1laDe uvi;t s2umxo3io4optnlneta()srrmum ;t1aeeo i3tys a eau s (4 ltrmfctatomt ln ol()t2tm(opiydol e fvtls)artrx ooo0altoifciltfs2ea( s (0tetnif3oodlaDeaues;( s2umxr iydaptnmieiasfartmumpou1tptn f3iydfs rl(mp t0 rxnifcoa1fm elneolt0 etm(m3iy1omen fet t)arrax p;u0oexn ociydfm ea( p ()arenifcoodlm elneo;s0 eurxm iudlltnlnvs sf 2tm( pno0olx moeias a2emumpnt) rxoirctydla r u i;() euoxm3oydll   nvsatfarrru p;o4tpxoifetydfsDran pn()tetrmo oatfa  luvs t0 2tr(opou4lm nmictltf rraxrpot4aee ifciaslm ea( on()treoxo3oy1laDr ivsls0trumiopnydlpeelnetls  Dtm( o;o4apeo o3iat s2um( o;t)tetoxo3to1op  livo;t  rxmxm3nu4lpenlfviatfaDraump;u0openmieiyt mDrl(vpnu)tlxnifciatla   i s ()s2uoirpiu1al n fesas sDrru oou4tlt iociysls eanmpnu0arxnir3io1oaDelu slt) etm(rpnu4om   ivslsfs2taxro;u0oleoifetys s ranmsnu0trxrxo iodfm elu slt  2urimpoydaltelictasf 2tax oou1aet mfctysfm2ua( p u0aeeoif3oatfaDr ies t  2uoxo ny1alte fvils  Dumur ou1aet miciyd m ul( s;u0tltoxrcta1opDrlu o ( srxoxm3no4ol emicsat)aDrrxr oo4teeoii3iytla2um(vsn(0alenxocoytfa rluei;s)s2urio no4am e fctlt srra(r no4olxnmietld s umumo;t0aleomr3iadlaDeln i (0t2uo(m ny1amenlfeilsfsrur(mp;u1oetn f3tltlsDua(vpn(4 lenmrcia1fp r i i s)t2xr(m oy4omt lnviasfsruaxr ot0apt  fctldfa2rlnms;(4arerxo3ty1oatr i i;( trum(o ou1ope liciltfs2um(rooo1aeeo f3tydla uauvo t4artnxfciy1lptranvslt) rto(opno1lptnlnvtlsfaDur(  ot0apeniietytla el( o;t4 ltnmrcta1lmDran o;s s2xoirpio4ll n fesls) Dta(  ;o0aeenmi3iaslsDuanvon(0alxrmf3oodfa  lies s)setr(opou4omeemicsa( a2rau  ot1aeto feild mDemuvp;(4trenmr tytomtrauvs;(0texm(m3iudlm nlnvs t)arra(rpno4alxnmo3iysfa elnvo t0 rxnmf ty1laDeaivs;(0texoim3oo4optn icsl()s2tm(  ;t0texo i3ias a2umnvpn(4 eeriocoy1fpt auei (0 rxrxo ou1lmenmiet t srumxm ou4olxo fctysfmDrlu pn(4artrmo3ootop raieol(  euoxr iodomt lietl()srtmxr ;o0aee ifeilsfsDrlu p (0tlxoxo3oodfa elues t  2tr(opiu4aptnmnet s) rrrxr oo4aeto feilslsDrl(mpn(0aexnxoctatfmt lu i s trurxm iu4lm  mict ()srua( pot4opxoifeiat m2rm(vp;t4 rxoxociytom ranvi t  etrxr oudope lnvt sfaDtrxr oo1apxnioeiatls2rau p;u4trxrir oy1lmDran s t t2toim3oudam nlnetlt  rraxmo;o1olxnmf3iyt m2uluvo;(0aeeomfcta1oa e ivil(0t2xoirpny4op e fet s sruau o;t0apenifeild s umu onu) rerircoytlmD lueilt s2toxm3oudlpeemnvilt srta(mono0olt mieiadfs2ua( pnt)tleoio3oo1fmt aieols0 eumim nodomtn ictat a2ururpnt4aet ifciad m2eanmsnu0artnxoctodfaD lueo s0trtmim3oy1ale mnesls) rtmu onu4apx ioeiys a rmnms;(0aetoif3io1fmDrluvolt  rxrxm oudll  lfvi ()a2taxroot1oltn octatlm2ra(msnt4 lerxf oadfmDeanei s0sexr(o3no4omenlivt t)aDurump;o4aex  feiys a eaump t)aexoio3oadoat aivol(0trumio3io4alt liviatfsrurumoot0texn o3tas a2eaums () etrmf todla eanvo (0 exrir io1al e fcs (f rra(roou4texomi3iasls2rlu s;t4texnmr ootfaDrlueo (0teur(r oy4amte fctlsfartaxrpno4texo i3iytls2um( p;(0artnio3oytopD  nes;t0 etoxmpoy1amt mneia( srurxront4open ocild m2rl(mont4areomo iytom elueo;s)s2tr(o oy1optn nvtat) Dtmumpot1olx mf3iadfa2rl(mo (0tetoxocty1lmDeln s;t)tetrxr iy4lle mfei s)srrmump;u1tpxnmf3iydfaDrl(mp t0trermf3iytfateaivo t t2ur(m oo1om nlfes s sDururoot0tetomfctyd aDrmuvp t) eerio3iy1om   nvo;(0 etoir3iodoltn ietl(fa2tau ooo1apxoiieiysls eau s u) etnircootomtr n sl() 2xmxo3iy4omenmnvtlsfsrtmur ;t1optomi3iasfm elnmp (4tlenxfciy1laDraneo s) 2xo(o3iodll   ivias)s2umxmooo4tex ioetaslm eau snt)tltnmocoodoatr ivi s) rum(m3nydaptnmfvi s  2rmxmo;u4aex mo3tad m2rl(mo t)aetoif3tytlm eaieo t  etr(m3ny4llt mnvi t)aDtm(ro;o0teen o3tas m2ea(vp u4artrmo3iydfmDrln i s0truoio3nu1ol emfcsl( sDtm( ooo4aexnmf3iyd s ua(mp t4aleoir3ootfmt lnvsl()trtrio oudam  lfctas)sDururoot4altn icild s2um( o ()aetnifcoy1oateaues t0t2trim3ny1lm eliesa(fsDurxrpot1alt if3iaslm rm(vp u0aexnmo3tatoa elivol(0teto(rpio4lpt mfcsasfaDumx ont4ope  i3ias sDemuvs;(0teermo3iydlm r i s;t0 eum(o3iodlptn ies (fsDumumpnt0opxoifciatla2uaums;u0alxoxf3oydop  ln o s0 2tmxo3iodaltnlfvs sf rtmur ;o1altnmoctas aDuanms;t0trxrxo tytoaDr uvslt)srxrim io1llenlivtls)s2ra( p;u1tpxoio3tyd m2uluvo;()teenmo oo1lp elieo s)srxo(o iu4ole  neilt s2rr(mp;u0oet iicildfmDeauvs;u0 rxomr tydlmtrli s;s0tetmxr iy4lmtelfetat a2raxrp;t1oeeomi3tysfs ea( onu) rxomrctydlaDrlu sl(0s2toim oodlle lnvi s arum(mp;t0oeeomieiadfsDrmuvp t)arerioctotfa rli s;s)t2xrir3no1aleelieilt)artmxro;u1apeomieiytla2uanvs (4tltrmr iotfmtr ies;s t2toxopiy4ll nlnet s  Draur nu0aetomf3tad s eauvp () ltrio3to1lp r i sls t2tm(m3oo4om  lfei s)sDuaxm ;t0opt  feiydlsDelnmp;(4alxrir3oy1oat livs;t0srumxo nu1llt  fvsltf 2taur ;t0tlx io3iyslm2rmumont0 eeoif ia1lm raivi t texoxm3no1al   ncsl(faDtaxm oo0tetoiiciat a rmums;(4alxrio3tytfp e ivi;s trxo(m no1lm nlnvsltf rrm(root0oeenmoeiytfs eln p u4artnxo3iodlat anvo;s teumxr3nydam   nvsl( artmxrpnu4tpe  icilsfm rauvo (4 rxrmrcootlmDr ieo;()seurxopiy4lmenmfetltf Dtrxront1aet  f3iadlm2rlumo u)aeeoioctydlat luei;t)texrimpou4lm n fvtl(fsDumx onu1alt  ietlsla2rln pnu0tltoiociadfmDean ilt teumxr io4oltelfct s)sDua(  ot0aet ifetydlsDra(mo;()tlerxr3io1om eln s t) 2umim io4optnlnesa(fs2ua( p;o4alen o3iasfs2emn p;(0treomfcoydlp raivolt) 2uo(rpoydlm nmfcia() rumx ono4oeen f3ildlaDemuvon() exomr3tydfateanesl()trxrxo iu4lp elfvias)srur( pnt0aee iiciltfmDum(msnt4 exrxo io1op ranei;s srxr(r ny4opt mneias)aDtmu  ou0apxomi3iydfs eluvp u4 exomo3oytoate ieo;t0teuoim3ny4ap elivtlt artaxrono0tpenifeilsfs ranmp;t)trenmf3iydfa eluvs s0trxoxm nudlm e nctas)artau p;t1opxnmfeiytfsDuaumon(4alxnxfcoo1om  ai s s0 rxoimpoy1al e fvsls srumur no1tpxnifetysls emums;()artrir totfmDeaneils trurxrpiy1ll  mncia( arur(moot0tlxoioeiadls2rlnms;t0aexrir tadfp  livo t t2xmir3oodlpte ict (  2taurp;t1altniociltfa2ra(vp;t)artrif3io1lat  iei t)srtmxo3oydamenlieiat  Duru  no0tlxniictlslm2em(vs;t4tltnif3iy1fpD  ueilt s2umxr iy4alee fct t) 2trxr ou4ope mfciytls eln s;u0 rtnio iytomtrluesls) etr(r io4amt mfvi t) 2rmxro;o1alxomo3tatfmDrmumo;u0 lerif oytla e ueols0srto(r3iudlleelnvia(  2umxrp;u1oltnmo3iasfs2ea(ms (0aeeomrciytoa   n i;s)srxmir3iy1ap   neias s2trx  nu4apxn f3ils a eln sn()altrir iy1lm  livs;t0truoxr nudaltelicsat) Dtmxrp;u0optoiiciadls2eaumpnu)artnio ootlp r u o;s)t2xm(m nudllt  nvilsfsDta(  no0aex iiciytfa umnmo t)alxoxfcoytfpDean o;() rxr(mpiy1lpt miesltfa2tr(mo;t1aeenmfetad aDrluvo t0 ltnmf iydoa e u s s s2ur(o3nydale lfcilt)artr(m ou0aex mf3iasfmDea(vp;(0tltoio tadlpte uvo;s0teurim iodome mnci t aDta( poo4teeomf3tas m2eauvsn(4alenxfcta1la rai s (0s2tmxm ny4ame miei () 2raurpnt4aex iociasfm2ra(ms;u)alerir oodoptran s;t s2xm(r3oodllen fvsl(f rur(  ;t0oleniiciatfaDua(vp t)aetnio3tytopDeaneslt0 rtoxm ny1ol  mnes () rraxr ;t0olx  ictydfm emu o u0alxnmfcoydom rau o;(0t2umim3io4lmt mnci (  2umu ont4tlx  fciytfaDulumsn(4 lxrxfciytlmDrlu s;t trumxo no4am elfctls)sDrmxro;u1opeomfctls a2uan p u0tlxnio3iytlat lnes;(0trtr(r3oodlmt  iei s)aDtru  nt1alto oetldfmDumn o u0alerif3iytfpDr u o;(0teuoio oy4apen ivi ( artmx  ;t4oexoio3iytlm eau pnt0altoif3tadlmDraiei;( t2xmimpou1lpt mici sf Drru o;t4olxn i3tas s em(mo;(0tlxrmo iadlmD  nesls)srur(mpoy4olen fcils)sruau p;o1ole ii3iytfa ran snt0texoxo3tadfm e uvs;(0trtriopny4alen ietlt)s2raumonu4apt  o3ilt s2rau o;u)artnmo3to1fptrluvs s)texrxopoo4ol  mieilt)aDtrxmpnt0apeo fciltfsDumumo u4 lxnxf3oodoa r uvils) 2xmirpnudll  mfcsa(  rurxmooo0alx mocildla emnvp t4tltomf3oydfptrli s s0seur(o no1lme  ietl()a2trx  nt4alx mociadlm ean sn(0tetrxr3oa1fpt au s (0trtriopio1lm n fes s aDtmum ;o4opxo feild m emn ont4tleoio tatlp r n ils teum(o3nodlleelfvtat srrrxro;t1tlx iietyslm rm( pnu4 rtrxoctytoatrlivo t) etmxr oudal nlfvil()a2rmx  nu1opx io3iysfaDelump (0tetrmr3ia1lptr u i;s0s2umxr3oodapen iciltfsDrrxr nu4alxnmfciaslm emu o;t4alxnxf todopteln ilt texrim3iydole lnes tfsDur(m ot0apxnmfciatfa2el( p u)alxoio oytlpDr i ilt setrxm no1aleelfvtas  Dtr(rpot4tpe  ocilt sDumnmpnt)tetrif3ta1lpDran s t) 2toxr3nu1llt  ncs t) rrr(m nt4oex mietadfm2rmnms (0 exoio3ty1lpDrlivi () 2xo(rpou4opt mnct t a2tm(monu4alen ocild a ua(vo;u)tetnio3iadom e ivolt0t2toxo3iy4alt lfct ( sDumu  nu1altnioeild a2rlu p;u4 lxoxo oytfaDeluvo;t0t2xmxopou1lp nlicsat)arta(rpnt1oetomiciaslm2em( p;u0 rtoif iatfat  n ilt) rumimpoudolt mneiat artaxmpnu4tpxniiciytlaDeau snt) eerxr ootlpDeaieo;s0setrxr ny1alt miet sfa2tr(r ;t0altnioetydlsDumumsnu0 etnxr3iodlm raiei;s s2xoxopnu1omt lieslsf 2taur ot0aleomiciyt sDemuvo;t0 renxo3totoat luvs t0seuo(mpiodoleemnciat  rraxmo;u1aeen ieiltfa rauvo (4trtnmociadoatr n s t trtoxrpny4om n ies tfaDrruronu0altnmieiyd m elnvpn(0aetoxo3todomDeanvo;(0 rto(o3io4openlnvsasf Dumx onu0aetomfcilsfa ea(mo u0 etrxrctytlatrlnvols0t2xr(o iy4lptemietat)srumxmp;t4ape  ocilslm el(msnt) etomf oydoptr i s s0 2xr(r nodll n fvilt)s2um(mont4aetnif3tasfa2ea( o (4aexrxf3iatfp e uvs () rtrimpny4lm elfvi t arumu pot0aetnmo3tysfa2uauvpn()trtoxr tytopDraueol( t2xoiopiudlm n nvt s aDrmxronu4oee if3ils m eluvs u0texnxr3tadfpD au i t s2xrxmpou4oltn nesl()arta( pou4tle moctysfsDrauvs () exoio iy1oaDe ies s)tetrxr3iudopen nvta() rua( p;t1aptn fcils a ra( pnu)arenir oy1fm  luvsls trtm(mpiy1op  lnvta(  rtmuroot4oet iociyt s2rm(ms u4arenxrcoytopD lnvo;s0srtoxr3iu4ale mfctas srtmu  ;u0alt iociyd a umnvsnt)arxrmf oatlm   neslt  rtmxm3no1amt lfes s s2raxrpot4oex  fciydls umump u)tlxoxociotomt an il(0t2xrxo3ny4lpt  nvt tf Dtr( ooo1aee mo3tld a rm( o;t)arxnmf3totfpDraneo;s texoio ny4omeemneias)sDrrxront1aet iocilsfmDumn s;()tlenxrctotomD anei;(0teum(o io4lleemnctl( s2tr(m ;t4tlxo oeiadfs2um(vs;u4 rxrmf3iadfptrln o;s0teumxm iu1lmeemfvtlt artrxroou4olt ii3ilt mDemnvo;u0tlxnir oydomtranvi;(0s2xoir3iy4opeelneil()a2ur(  ot0aet mfcilt aDrluvo;() ltomf to1lm rln s;t sexoxr3oo1al n iet sf Dtruroot0ale  fctlslsDeau sn()aetrir3tadomtrlu olt0srtm(m no4omt mfvt (faDtmurooo0altniieiadla rlnmp () renxo todfpte i o;t)seumio3oo4apeelfcia() rrmumoou0apxn f3tld mDum(mo;u4aexrirciotfm ranvo;t)trumiopiu1aptemnciat) Dta(r nu4aptnif3iadfaDuluvs t4 lxnxr3iatfaD aues s0teuoim nodomenmfctl(f Durxm ;u4apx  o3iysla um( o t)alxoxf3oadfmte ivolt0seumxr3iy1ol n fvta()arrmxrp;o0oltnioetyt aDum(vs t) lxomo3ta1lpt li il( t2xrxr3iy4amt mneil()aDrrxrpnt4opx if3tasla2ean p t) lerifcoodopD anesls)sruoxo no1apee nvi ( srrrumooo0tptnmietyt a elnmpnu0 ltnxr iodfa  livs;() 2trxm3oo1am elicsa(  2ur(mo;u1apxo o3iaslaDeaumo;(0 etoxrctytlp r ueo;s srxrio oy1lmenmiesat) Dururpot4teen fetlslaDrlu pnt4aeeoxo oodlmtrluei ()srxrxrpny4ll n fetlt arur( pou0opeoiieildfm ea(vp;t0tleoirciatlat  nvo;() eumirpou4olt  ieslt a2tmxrp;t0aetnmietat aDrl(vp ()tlxrir ty1la  livslt) rto(r oy1lpeemics t)s2ua(  ot1alt  i3taslm umnms;(0altoxo iydfaD anvo (0 eumxmpiy1al   nvt (  rrm(rono4tlt mo3iatls2ulnmon()tlxnxf ootfatr u o;(  euoim ou4lmt liei t) Dtr(  oo4aee ifcildfm uanmsnu4arerxr3ootlm e u i s) rtr(mpiodomtelfcsat) Dtmump;t4aeeoiiciysfm2em(mo;(4arxoifctatfa rln s;( texmxm3iydlm nmfvtasf rrm(mo;u0olt  i3ildlmDran p u0tlermr tadlm eln o t)truoirpno1aptnliciltfa2rm(r ;t1tpe ifciatfm ra( on(4tlxrirciatomtean sls0t2ur(m oy4ol emietatfarrru o;o1olt  f3iasfm2rau s;u)trxnmr3to1oateaivs s)srxmirpoo4ope  fcs t aDrru p;u1tpx  ictysfa2rmnms;u)aexnmo iotfaD lu s (0t2uoxo3iydalte fetls s2taxroot1alen fciytlsDrl( s (4 lxoxf3ty1oa rluei;t0 etoio oudalt lfvsas) ruaxrpnt4oltnmo3iys m emu o;(4 rtrmo3tatop e i ils)t2uoxm nu1alenlnct t a2trum ou1oeeomfcias a2umn p;(0aetrirctadlpDrlnvil(0t2umxrpnydlltemicsat)s2tmx pno1tlxo fetlsfm emu pnu0aeenxo oy1lpt anes;() 2trxr3oy4ap e icta(f rraumoot1tpeo o3iydlm ulnmon() rtoxf oadlp  anvs;(  rtrio3nydap nlnvt s srtm(  ;t1ope  oetas mDrl(vo;u4 rxrxfctatfatr nvi;s)tetrio ny4al emictl(faDrr(r ;o0aee iieiyt m uluvp u4altrmfciadfaDr ieslt0 2urio3no1omtemnet sf Dtauroot0aee mictlsls2rl( s;u0 ltoxrcootlmDrln s;s  rtm(rpoodom e netlt)artrxm ou1tlenmi3tydla rmuvpnt0trenmfcto1fmt  n olt0trtmiopoo1altelicsas artm(r no0tleomoctlslm rmuvo (4tlxrirciydoatrai s s srtoxo3ou1lp nlfcia(f 2ra(r ou0tlx  oetltfs2rmn pnt0 ltnif3oodom rln o s0 eur(r3nydomtnlicta()a2rr(mp;u4tpeoiietadlaDuluvsnu0alxrxr3iotfmDr nvo;t s2xo(mpno4llt  nctlsfa2tmx onu0texnioetasls2ra(ms;(4 rerxf3oy1fp rln i t0s2uoirpio4ll e neiasfartm(roou1aex mieiadla2ranmo;(0tetomfciydfptelu o (0 2urir3iu4alee icsl()s2tax p;u0tpe  ocildls2rmnmpn(0trenifcoy1fmteaivolt0s2xrio nodalt lfcs s)s2rr( pnt1tpxo ociysfa2ua( p;u)aetoio3io1fpt lies t)srum(rpny4olen ivs t)sDtmxmoou1oeeomo3iyd sDem(vp;u)aexnxr3oytlp eluvs t)texm(m nydlm e nesls a2tm(ro;u1ope ii3tlsfaDrlumonu0 lenmf oo1optrlivi t) rumio ny4olt lnetls) rtr(rpoo4tpx moeiltla ul(mo u0 rerir tadlmD lneo ( teurxm nu1omtelnesl(  Dua(m no1teto ieiad m2eauvo (0 lxnxoctadomtrln o t)t2xoxr3ou1ll   fvsat)s2rmu o;t0apen oeildla rmumonu)arxniocoadla r n i t0s2xo(o3oydal  licsasfa2rmu pot1aeeoioeiydfaDrmu p (0 rtoif3ia1lm e uvs t0 rtoim no1lmen netl() Dtaxmoot4alxomo3ias s uanvsn() lxoir3ty1omtelues;()s2umxopnydll nmfcs s)aDurur nt4aexniociydla2umnvp u0tetoxf oadoaD lu s s0srum(m oudlpt mivsls) rrm( pou1olxomoetasls2eanvp ()alenxr3oydfmDrai i ( t2trxm3oy4lp e nvil()s2rr(r ;u4tet mf3tas sDul(mo u0arxrxf iotfmteaivi;t)texmxm ou4omt lfct (f rra(mooo1opt mf3iaslsDum(mo t0 etnxrcoodomte nvs t) 2xrio3iu4ope mfctls)s2tr(ro;o1apenmociltfm2raumo;(4aetrmo3oodfaD auvols0 rxoio nydllenlneilsfsrum(root0aexomfeild m rauvs t)aexniocoatop e n ilt0 2xmio3oo4oltnlies tf Drmxmp;u0tpeo fctyt aDeauvp () reoxocia1lmtrlnei;t t2xr(o3no4alt lnvtat) 2rru oot4alx ifetatfaDrmuvsnu) ltnxr iydoateau i;s) 2to(opoo1am n ieias  ruaxroot4oexnmfeiasla el(vs t0trxrxocootfm   neil(0 rtmxo iy1apeemicsasfsDrmxmoou4tpxn o3iytlaDuan ont4artrmoctotfm r nei;t0srtoir ny1am   nvsl()arrm( onu1teeo ociaslmDrmnmp t)tlenir ty1fa r n i (0teuo(o3nudlme  fci t aDtmx  ou1aet ifetldls ea(vp;t) eenxf oa1lm  an s s0s2xoiopno1al e ncta()a2ra(rpnu0alt  ieilsls2eaums t4teeoxr tatoa e ueil(0sexm(mpoudllt lnctatf ruax pot1teenifciysfsDum(mp;t0 leoircty1oaDelnei;t s2xrxopny4amte nesasf rtm( pnt4opeomo3iltfa2emnmp;u) rxrirctatlaDr uvs ( s2tmimpiy4lp  lnvtasfsDtmur nu0apenifciysfaDeauvs ()trtrmocoy1faD ai o;t)t2ur(o3nodop   neta() Dtax  ou1tlxniictadfm2eau p;t)aeenxrcoydfatelu olt  rxrio oydom  lfvias srumx pnt0tlxo fciyt m2uln s t0texoxocto1lpte uvi (  2xoiopnu1olen fetls)sDuau pnt0alxomo3iysfa2rmuvo;u)alerir oydfmtelues ( tetm(m no4op nlncsls  2rrx oou0aet ifeiytlaDrl( s;u) lenmfcta1laDraivs t seuoxo3no4ll nmnvs sf 2um(m ;u1opeo f3ild mDuluvp;t)altoxocoadla e ieols) 2tmxo iu1lptn net ()arumur ou4aex ioetys aDel(mo;u0arxrir3to1opte u i s seuoxr nudlpee nvta( arta( p;u4tee mociadfa2rmnvs ()tlerif3oydlmDr uvi ( t2umxrpiy4lp nlnciat  Dua(m nu4tpen oetad mDulnmo ()alxrmf3oytop  auvi ()t2xrim3nu4altemivsa(fartaurp;o4teenmfeiatfs2ul(mp u0 exoir3oodfaDranvol(0trurxo3iydopee fvsasf Dta( ooo4ole iictltfsDrm(vonu4aetrifctydfm   nvolt0t2uo(r oy4ol nlnvil(farrm( p;u4tpxoii3tld a el(vo;t0tlxnir oa1lmDeln olt0 2to(o3ou4lm  livtas aDrru p;t0tptnifeiydfm ul(vo u4trxnxr3iytop eli o;(0t2ur(r3nydopte net (fsDua(  ot4apt mieiad a2umu snu) exnio iy1lp  ai o;t)sexmim iu1lptnmivtls a2rmx  no4olx ii3tas a ran on(0altomo tydfaD ai s () rum(o iy4altnmncta()srtmum nu4apxomicildfmDrauvon(4 rtrxr3tydfaD an ols0srxr(opny1llt lfct (f Duaxmp;o4tptnmo3iytfsDum(vpn(4altrxfciy1fpDr u i;(0 etmiopnu4ope lnvia(farta(  ot0oexn ociadlm2ranms;(0areomo oy1om  auesl() 2xo(mpoy4lpt  iviat s2ra(rpoo0oetnifciydfm2rlu p u4alxoxo io1fmt  ivs;(0teuo(m iy1lm   fcta( sDuau  ;t0apto oeiat a rmnmo () rtoxf ta1omD  u s (0srtrirpou4optelfvi sf Drm(m ;t1oltnmi3iydlm2emuvsnt)treoir3iodoa   ivolt srxo(mpoudlmte ivils) Dta(mpou1opeo f3iltfmDemnvo;(0texnmo oatom rlnvs s  etrxm iydale  fvils s2umu ooo0aptoiicildlm2em(monu)altnif oo1laDrlneo s)teuoxo nydapee netl()a2tm( o;u0tpx  o3tadla2uauvpnt4 ltrmocoy1op  liei;(0srtrxr3oo4lleelfctl(fsrtm(m nt4oleo o3tadfs2rmnmont0areoxocio1fptr iei ()texmxm3oudamtnlieil()sDtr(m ;t0aptoii3tlsfmDemnvp;u0aeeomo3ia1lm   neils0teumxr3iu1alenlfvils a2rmx  ou4texnif3iysfs2emnvpnt4tetomr3iatlmt luei ( seto(opio1amee nesa( a2rmxrp;u0aeto oeiasfm ul(mo u0alxnmo todoa elues;s)seur(o3oy1ll  lfetlsfs2tmxrpno0olxnmo3tat sDumuvp;(4aexoxociatfpte u ol(0 2umio3nydom  mici ()sDtmum ;o1aee mfeiadls2rm(vpn(0trxomf3todla  lu o t0s2xoxr oo4alt  ivils  rtr( o;o0tet iietytla2ran p;t4arxoxr ia1lmt li ils0srtmxr3iydoptn ncsas)sruaurp;t4apx mfciyt sDrauvo t4 lxnxr iytfp rauvols0s2xmxo3no4al   nvtat) Dtrx p;t1apt miciaslaDemu s t) lxniocoa1oaD lues t0t2toxmpnudlpt mneiatfartr(m ot4optn iciasla um(mpnu4 rtrxo oydlmDeluvo;t texr(o3nodlmt liesat)sDraxmpou0tlxnif3ias a eanmo u0trtrmrcta1oaDeaueo t)trxr(m3iu4am elnct t artrum nt4tltomieiltlmDulumpnt)aeeoir3iodfa  aiei;t0 euo(mpiy4altnmieiatfsDrmurpno4oeen oetyt mDuan onu4 rtnxf todoatr ies t teum(opiu4ap nlnesa( sDtmx  ou0olto o3iyd m ua( o t)aetnmo oo1faDran ols trxo(o3nodlp nmneta(  rrmumo;o4aexomoeiyt m2ul(ms;t4trtoxociydomt aieols0trxr(m iu1omen iet t)aDtaur no0ope mfeias mDrln sn() ltrxf iodfaDrln i;t) 2xmirpiu4ol n fesls)a2rrurp;t1oeto o3tlsfa2ua(vo t4tlerxfciatlpD livsls0seurxmpno1lp emietl(faDta(r ;u1aee ifeiatlaDuanmon(0tetrmr oytlpDrai olt  2tr(opiu1lle lfesls)sDtaumooo4aleo ietatlsDulnms (4 etrmrciotfat livolt0 2uoim3nu1lmtemnesas)a2ta(m ;o1tet mfeildls emn s;u0aetrxf iodoa  lies s) 2xoxr iudomte iesltfsrrruroot4aeenmoetas m rmumsnt)aetrxr3ty1oa r nvo (0 2xrirpno4lmee fvtlt)a2uau pnt4aetnioeiltfsDrm(ms;u)aeenifcto1fpDeaivs;( teur(mpnu1lmeelfvslt  2ta( ooo4altoif3iytlsDua(vsnt)trxnxr totfatrauvsls0s2xmxrpou1alenlieia(f Dtrur ;u1olt mo3iytlm elnmo;u0 renmfciodlpDran i;t0 rtrir oy1ap emfvsls)aDur(mpou0tpe iieilsfm2em(mp;t)tlerir3oy1fp rauvsl( s2to(r ny4amenmfei t)s2umu  nt0aet moeiydls umnmsnu0tetrmo3totfpteaneslt0 rurxm oy4ome lnvs ( a2umum ot4oltnmi3ild mDuauvp;u4 exoir oadomDelivslt0 etoirpio1am  lfvtls  Dtmum ou0tetnii3ildfmDumn p u)tlenmrcoytlp  aneols seur(opnydlmt  fvtls  Dua(root4tetniietlt a2eauvp;(0alxrir3oydla  auvo;s0t2xoxm oy1lpeemietas aDuau pot4tlenio3iaslm umnvo;u4 eenio3oy1omDe nei (0trum(o3nu1lme mfvi sfaDtmurono1tpxn ietydfm2ean pnu)trtomf iotop ran sl(0 2trirpio1apt  ivs s)srtm( o;u4oexoifciltls rmnvo (4 lerxr iydopDrau o;s0trxrxm iydll e iesls)srurx  nt4oet if3tysfs rl( pnu0artrif3tydoate uvo;s0 exm(m3iydlm emicsls sDraumont1tex mfciatfsDum( s;()texrif oadfpt  n i;s trxrirpiu1lme mneslsfarrr(  ;u4oet mociat a ul( s;(0aetoifciadfaD auesls texoxr ny4lmtemnesas)aDtmxmoot1tptnmiciltlsDua(vs;(4artrxrcoa1omtelu ils0 2tr(mpny4lleelncsat sDta(r ;u4opto iciltla2elu sn(4arerxrcoo1omDeli slt)teuoim oodom elfei s sDuaxr oo4teeo ietysls2ea( p u0 reoxocoodlpDeauvslt0teurxo3oodlp emfvs s srra(rp;t0aet  oeiltfs eaums u0 rxoiociotlm   uvslt0 2to(o iudlm  mnvslt)sDra( p;t4tle iieias s2rmnvo u)trtrif3iadlmt ln ol(  rxr(r io1lltemnvs s)s2um(mpot4olto o3iyslmDea( s t)areomfciydlaDeai o t0tetm(mpou4amtn nvt tfaDtm(rp;o4tlxomoetad aDra( onu)trxrmo iytlateaivol( trumxopiy1amt  fci ()s2tmxmpno1tptnif3tasla2umnvp u) eermf tydlat li s s) exo(o oy4op nlivtlsfa2tmumono4oexoiieiat m2eaums u)tleoxrcoatomt au ols t2urim3oudopenmfeta(faDururonu0tpx  iciyslaDeluvs;(4trxnmf totoa e ivs (0 euoxr io4ap nmfeiatfartmxmoot1tltoiictadlm2ulnvpnu)trxrif iotomteli o ( teuo(o iy1ol nmfesltfs2tru  oo4apeoifeiys mDul(vpn()tetrmfcto1lpD  ivi t  exoxm3nodlltelfcs sfsDtmurpou0tltomfeiasfa uauvp (0tltomf oatoa  lueils t2uo(m3nudlp e ncs ( a2rmxrp;u4teeomfciatlmDran snu4tetnmo io1fpt lneil(  exm(o ny1ameemnvt tf rrax o;o0olxo feildlm2eau on() ltrmo iatfmt aneo;(0s2xrxo no1lm nmnct ( srurxrpou4oeeomfetlsfsDua( pnt0 ltomfcoadfmDe n sl()truo(opiydape  net s  2tm( pnt0apxomf3iydfsDua( p ()arxomo ty1laDeau i (0t2um(o iodlpen feslt)s2rrx  ou0oexnii3tysfa el(vsnt0trxrxr oydlptr neslt tetmiopnodopte neil() rrrumono1olxomietytlaDuln o;t4tlenmr3oadop eliei;( srtmxr3iydom nmnvtlsfs2rau ooo0tpeoifetls m2eau snt0aeenxfctodomDe ivil(0srurio nydllteliciasf 2ra(  nu4tlx ii3tatfmDumnvpn() eermrcoy1oa r ivolt0srurimpny4ll  micia(f rum(mo;u4opt mietad s rl(vpnu4aetrmf totfm rlu il(0t2uo(r nu4op elfeiasf Drrurooo1tlxo ieiadfmDemnvo;u0trenxf iadoaDrlivo t) 2umio3oy1ape mivsls  Dtr(m ;u0oltoio3iys mDrmuvp u4arxrmo3ootoaDr ivslt0trtr(rpou4omt lies t s2tmumono1tpx io3tydfm2emumpn(0tleomr3ootlmDraivo t)s2xr(r oydlme lncsas  2tmum nt4tlxo ieiad sDumnmpn()tlxnxr3ia1lp r ivo t trur(rpnydlmt lieias  Dra(mo;o1opeomi3tlsfm2emu onu) renio oodfm rln sl(0 rtoirpoodll nlivs s)s2rrx onu1alenmi3ias m2rauvp u4arxnio3oo1lmDe nes;t) rxoio3oy1amen ivt s)srrmuro;t0tetnio3iytlsDea( o;u0 renif3ootfaDraneo ()trxoxr3nu1apte fet s srrmx oot1oexn i3ildfs2elnmp;u) rtnifcoo1faD lu i t) eurxrpno1aptemies tf rtmu ont1tltnioetlt s um(vs;(4tlxnxrciotoa e nvolt trto(rpoydomee nvtat  2urxrooo4teeoif3ils mDuanmpnt) ltomfcta1optrlu ilt s2xmim oy4lpte fctls  rtmur oo1teeo o3iys aDul(mp t4 lerxo iadoaD luvolt0s2xmxm ou1al  mnvilt)sDrax  ;o0tptomi3iltfaDumump t0aexnmo oy1fmDeli s;s0s2xrim3iu4amtn ivt ()artaum ot0alt iociys a ranvs;(4arenmoctotfmD auei;s0srum(r3iy4olee ieta() 2trx ooo0oetomf3iysfa2ean snt4texoif3to1lmD  ivsls) 2umxopoy4al n ncs s s2raump;u1teto o3ilsfm2em(vs;t0trxomo iadfaD li il(0 rum(o oo4aleemfciltfs2tmurp;t4olt iictydlaDeluvo u0 rtoir3tytfmD  uei;( trumim iodam nlfes s) 2ra( ooo0apxoio3iyt s umu o t4tlenio3iotla r nesl( t2xoir nudop e fvtasfs2trur ;t4alxoii3iadfa rlump u)arxrio tytfat lnvolt0srxmxo no4apen ivt ()aDururoot4apto feiysfa rm(msnu4 exrxf3oa1fp  lnei;() rtoxmpoy4optnmfvslt)a2urxrooo4tleoioeiad m2emu p (4 eeoxo3iatomtranvi;(0teto(o3no4altemneils sDrmu onu1alx miciyt s2rmums;t4areoir3oodlmD auvilt0t2tmxrpny4om elivils)aDta( oot1tet  icils m ea(vp;(4 etrirciatfmDe ueo;( t2xrxmpoy1opeelncil(  2raur oo4aptniociadls rl(mo t)tleomf iydfpteai ilt trurir3iu4lmtelivils a2ta( oou1tpx mfciys sDemump u4 etomr ootlp raiesl(0 rxr(r3no1am e ncs s) Drmuro;u0tetnmoeildla um( s;u0alxnifcia1omDeaueo t)trtoxmpiu4omeelfcta()aDtr(moot4oltomfciadlaDeanvp;(4teerxf3iadop   nes;t)srto(r io4ame lfviatfarra(m ;o4apx  o3tyt a2rmumpn(0altoif3oytomDe nvsls) eurirpiudlmtemncils  2trumonu0aeeo f3iltla ua( p ()altnir oatfmDeauei () rxr(r no4lptnmfcsas a2tr(rp;u0alt iiciyslm2um(mp;u0texnmrcoytomDrluvs;t teur(opnodoptemietat a2taxmonu1tleoif3tad mDem(ms (4treomoctytoate ivo;()setm(r iydamtnmfet s)s2rrxr nt4aetnmo3tas mDea(ms;(4tetomr3totlat lies ( srtr(o3no1amtemfes s  Drmu  oo0optnii3iysfs2rau s t4 rerir tydfat an i s truo(rpiy4om   feia() 2umxmp;t1tlen ictydfa rmuvs;u0aetomr3ta1fmtr ivs;(  etrio3nu4openlfei s s2tr(monu0altoiiciatlaDuluvs u0 eeoifciodlm rau i t)s2xm(o oy1am elfetat  2taumont0aexn ociytfsDum( p;u0 ltoxr3tadlmD aueol( s2uoxo ny4lm nmncslt s2umxm ;o4opxo f3tld aDelu p t0 lxoxr3totfmD  n il() rxmir iy1aleelnesatf 2tmuro;u1aeeomi3iatfsDrmnmsnu0 rtrmoctodopDrauei;(0tetoxmpno1op elicil()a2tax ont0tlenmoctasfs em(vo u4aeermf3oytla r n i;s) 2uoiopoydaltemfvtasfsDumurpno4oleoii3ias mDrmu snu0altnirctydlatrlneil(0s2umxrpoo1op n nviltf rtrxrooo4olxo icils mDem(vs;(0teermfctadfm e i o t srtoimpnu1opt mnctatfaDum(m ot0aeen o3tadls2rm(mo;t) exoif3ty1lpDeau o t0 2trimpnydlpenlfcs sf Drr(  ;u1aet mfetltfsDrm(mpnu0treoir3oytfpDe nvol()texm(o nu1lp e ieslt)aDum(rpou4olxoifcias a ea(mo u4aeenxr ta1lmtean o t0 rxoxo3iy1ale lfvtlt)srraur no1tlxnmietyt sDem(msnt0trtrifciotfaD auei;( srtmxo3io4lp emfei t)arrrum ;u0texnmi3iysls2em(vp t) rermo ta1lptrlu ilt) 2xrimpno4ap e fetl(  2rrxr oo0tltn oeilsfm2rl(vs ()texnmf ia1lmt lu s;t0 eumim3iodoleelici (  ruaxro;t1alenioetldfa eln snu4aeeoirctotfmteanvi t0 etoir iy1ame  fvs s  rumuro;u4tpe  ieiyt mDumu p t)trxnxociotfpD luvo s s2trxm3oy4al e fct sfa2rr(ront0oexomf3tls m emumpn(4tltoxo ia1lm ran s;( trtoiopoo4ol emnctas  Dtaxmoot4apen o3iatlaDumuvo;() reoxr oydfpteaies s0seuoxm iu4om   icil( aDrm(r oo0oeeniociysfm2umu s;u0texnif iy1la rli s t)trxoio nu4aleemnvtl(  Dtaxmpno4apt moeiad m2rln o (4tlenmr3ia1oa  aues s  2urxm3iodll emneias artmx  nt4alenifctltls em(mpnu)aetnxrciytlm   iesls t2umxr3iy1lltnlfvta(fs2ra(m ;o4tltnmoeiatlsDum(vs u)tltnir3oydoat aueils0 rxrim3oy1op n ivi (fsrtaxr ;t0opt io3iltls eauvonu4tlenxrctytlm elnesl( s2toirpio4llen ncia( aDtm(m ou4oltoioeiydls uau pn()artoxocoadfmDe u s;s) 2xmirpiydop  mncias  rraumoou0aeenmfetas aDrlu s;()aeerxo3iy1lmD luvi (0s2tm(o iu1ll   fcs tf ruaxrpnt1tpx ioeiyd m emnmsn(0artnxfcootfa  an i t seurio oudomtn fvtltfs2ta(m ;t4tle iieiadlaDeauvo;t0 rxomo3ootopDr u sl(  2uoxo nydoltnlnet t)arrmx p;t1texomfcilslsDeanvs u4 exnmociodop elueils trtm(r3iodam elivil(f rtmumoot0oeto o3iytlsDrmnmp (4tlxrio tadfpD luei;t0s2xmxr oy4lpe  icslt srtm(mp;o4ole ifciadls2ulumo;u) ltnmf3totlaD  n i;s)sruoxrpno1lpenmicil( sDra( o;o1aeenmi3tadlaDelnmpnt4 exrircty1fmDeauvsl()sruo(r nudamte ictlt aDtmumo;u4opto ictat m um(ms ()aexrmo tadop rlueol(0 2toio3ny1amee ici ()s2ra(  ;t1aeeomfeiad aDelums ()arenmf3ty1la ean ol(  rtmiopnudaltn ncia()a2raxmpot1oex  fcilsfa elu s t)tltomocoydfm e i sls0t2xrimpio1lpeelicia()a2trxmo;o4aet  f3iltla2rluvo u4arxomrcoo1lmt livil()tetrxopiodam nlnvtl() Dur(rpnu0ale  fcilsla2uln snu4treoxrctotfm r u o (0tetoim3no1op n ivs ()a2tmum ;u0oee  i3iasls eau snt0alxrir oytfptelivi t srxo(o3oy1lpen fci t) Dtm(rp;u0tlxn ociytls rlu p;(4 rxnmrciy1fpDe u ol()sruoir no4olen ivil()arrmx oou4apt  feias a2rlnvpnt4tetoxf oadlaDr u sl() rxrio iu4alee fvils s2rmx  ;t4tee moeiydfmDrmnvo;u4 ltomf ta1lpDraivo s t2xr(m3iy4amtelfvs tfa2uaxm ;o0opx ii3ilsfa2ul( onu0trxoxrciytlpteai s;s  rtoxr3io4ale  fvsatf 2ururo;t4oexoifciaslm2ra(vpnu)aeenmrcoo1lpt  neo t)srxrio3iy4am nliesls  Duru pou0oexnioeiltfmDuau o;t)altoiocoy1lm  lieils texoio3iu4amtn fetasfs2um(  nt1aptnmi3iad s2umnmsnt0 ltoircoatfat aies;( s2toim oy4lmenmfes tf Drm(  nt1openmfeiaslsDran sn(4alenxo oy1oat luvi;s0tetr(opiy4op elfvsa()arrr(mp;t1alx ii3ildfs eln s u4trxnmf oydlatrlivo;t0 rumxo3oo4lm   fvsls)sDua(m oo1alxo ociytls ul(vo t0teermr to1faDe neo s0 rtoiopio4ale mfctat sDrmx oou0texomieiydla2elnmsnu0arermf ia1fmt  ivi s) rxoir3ou1olt mnesa(faDrmump;o0opto ociytls2um(ms;(0trerxo3ty1fmDraiei s tetmxopny1oltemicsls) 2tr(mp;o4aeenifctad mDeln p t0arxrmf oadlptr u slt)t2xoir3oo1amtnliesls  Dtmumpou1oleoiiciadlsDulnmont) reoif3oo1lp eanvo;t sruoxo3oo4lm   neias)artaxm ou1olenmfeiydfs2emuvo u4arerircia1lm elieo s) 2um(r3nodol  lnvil(f Dumumo;o0tpt moetyt mDemnmo t4aexoxo iy1lp raiei t srtr(m3io1op nlieia()arum(rpoo1opx mfctytlm2elnmo u) exnxf to1faDe uei (  rxoxmpiydlptn ivtlsfaDrmurpno4apxnmiciadfs rl( s;u0aetoio3oo1latrluvo t0 exmxrpnodomtelies s  rumx ooo1oet mi3ildlm2rluvp t0 reoxocootoptrln o;s0t2xmxopoo4lpe lfesl(f rtaumoou1tpenif3tysfaDulu o t) rtnir3iotoaDranvi s trtoxm iydamtn fetltf 2umurpou4oexniictas m2rm(vo;u0 lenir io1fmDe nvilt) exo(m oo4altnlfvsatfarraxm ;t4oeen fcil
\ No newline at end of file
@@ -0,0 +1 @@
+nvi t0sexo(m3iydapte neia() 2raumont0olt  oeiyslm elums;u4arxnxr3iy1lmtr i o;t)teurir iu4lleelicsa(f 2tmx p;t4oeeoiociltfs rl(ms (4teeoiocoa1lpD luvs (0 rxmio3io4lltn fvi ( a2ua(mono4tpt  fciysls elnmsnt0tleoxr tytop eluvo;s  etr(opiy4al  lnvi t artru o;o1tpeoif3tld sDrmu s;(0aetoxo3ty1oat  nvo;s  rumiopiodamen ivils srrau o;t4apxnmoctydfs ra( s t4aleoxrctatfa r ivs;s  2tmxr no4open fvsas srtaumpot0aetoifciyt s um( p (4trtnxr iotom e n ols0s2xoio iy4lm nlivslt sDrmu  no0tptomoctldfmDua( pnu) renxfcoa1fp ran o t0 rxo(opny1om elieta(fa2raump;t0ope  f3ilt a rmu snt4alenmo tytomt lu o;( s2xrxr oodam  mics t artax ont4tpeomietlsfmDel( onu0tlxoir iydlat lues s0t2trio iodlmtn iei ()srtmu pnt0tetn ietytfa2rmnms u4 ltoxocoytla   neo ( s2um(mpno1altnlfeias aDrm(r ;u0oet io3ilt s emuvo;t)artomociadfaDr nvols t2ur(o iu4opt lnesl(  2um(mont1aexn ieiys m2rlnvp (0 ltoxf3oytlm r uvi;s teuoiopiudal emicsa() Draur ;u1oet  icildls2ran s u) eerxoctydfate i ils t2tmxrpoy4lltemiviat)arra(m no4tlx moeiatla rauvs t0tltnioctatfmtrli o s0 rxmim3nudalee ivtlt artr(  ot0tetn i3iyslsDra(vsnu4alxrxf3oodfat  i o (0seuo(rpoydopt lfcs sfaDrmx  nu0tpx  feiat sDrl(mp (0 lenxocty1op e ueo (  exrir iy1ap nmiesls)aDurum ou4alenifeiytla2eau o;t4arxnxrcty1fp r nvi s0s2umir3ou1omte neil(fs2rmu p;t0optnmfeild mDul(vpn(4arxoio ty1om r ieo (0s2xo(rpnudapt mfetlt)artmuroou0ale if3tytfa rau p u0arxrmo3oytfpteluvilt  eto(r3iudopeelfei s  Dumxr no4tpe ii3iysls elu snu0alxnir ty1la e ivo t s2tr(r3oy4amen ieil()sDtruro;t4tpx micilsfmDranvo (4aeeoxf oa1fm rliei;s  rumir3iy1oleelfei sfsruaum oo4apenmi3iatlsDrluvonu0tetnxf ootfaDe uei;(0trtr(m ny4ll nmfvsls  ruax o;u4oetnii3ilslmDranmo;u0aexomo3iy1lptelu o;(0tetr(opou1lptemivs t artrxroot1oex ii3ils a umnvs ()aetrmo ta1lpt au o;t)teumxo3oo4ll emfci (  rraurp;u4tptnmociat m uau s;t4tlerxocoytop e neo (  rxoimpiodape  fvsatfarrrxmoot0aetnmoeiat a2rmnmo;u4 eeoif iytfpDe u il(0srtr(o oy4ame lfvtltfsDtr(rpoo4alxomociys aDrluvs;(4arxrio3tydfptraiei;t0t2tr(r oodlmeelnvt t)sDumxr oo1apen oeilsfm2eluvsnt0trtrio3to1lpt aues;t0 2urim3ou4alt lfcsas)sDrau poo0tptomo3iys a2rauvs u4arxnxo ootopD aivs (  2toxm iodlmen nvtlt sDtrxr ;u1aet  oeiyt s ran o u4altnmfctytfat livs;(0teurxo ou4lm e ivsatf Dururono1oexoifeilsfs eanvont4alxrmo3ootfpDe ues;(  rurim no4olt  fvias) 2taxmpoo1oexo f3iysfm um(vont0tetoirctodomDe uei t truo(m no4llen fctlt)s2uaxrono4olt  oeildlsDuanmon() lxomr3oo1opDe nvils teuoim no4llt  nvi (fsrtaurpou1aetoifetatlmDem(mpnu) rxrmfctatoat  n ols sexr(mpny4lmt mnvtlt srumu ont4oexoiocilt sDua(ms;(0arerxociy1faD auvol( texoxm3ou4lm n nesl() Dumxm ot1aeeoiiciyslmDrm(mo;u4 rxnmr todfpDelieo;t  rxrxo ny4ll  mnvs () Dtax  ;o4oltnio3tasfa2uaump;(0alerio iydoptr i ol() eumio3ny4ll emiei s a2tau pou0aeenifciasfmDrlnms t) rerxfctadfp e i olt)srxriopou1lmt mfct (fs2rmxmooo0oeeoiieiysfs2ranmp t0alxrxrcootfmtrln ols t2xr(m ny4lpenlics s)sDtr(mp;t0texnioeiys sDuln onu0arenifciytfptr u ols)t2urxr oudlpt  ivtas arumu p;t4aee if3tlt m ean o (0alenxf oytlat livo;t0 rumxm3ou4ap emfct ( a2umxm nu0oltnioetasls2um( s () renir3iotlmt livs;()s2urir3no1llenmiesa(faDra(r ot1olt mf3iysfs2raump (4tltrio ta1omD  n olt0trtrxr3ou1olte ncsa()aDtm(m nu0oltn f3ildfs2uauvon()tltoifciatfmtrau s s  rtm(o oodlpt  ivslsfs2truro;o0oltnmiciatfa ra( o t)tltrxo oydfp e u sls0seurxr3iudolen ivs t sDrmx pou0aeen oeias a ua(vonu0tlxrxociydomDr uvs (  2uoimpoo4lp nmnesl()sDtm(mo;u0opx mictls a2rau sn() etoxocoytfmD lies s t2urxm oudlm  mnvs sf rtm(root1ale iociytlmDra(mp ()aexoiocoytlatr n ol() rxrir nydam emfcsl( s2rrxmp;u1oleniociysla2uln pnt) rxrxf ootoatr n ils  2xoio oo4amee nvtas aDtrump;o1aexomf3ilsfa rm( o (4alxnmrcoodlmDraieolt0srxm(rpiodlpenmneil( srur(ro;u4tpt mi3iatla raump u0 rerxf oodopDr uvs t)texrim3oy1op e ivtl(f 2rrxroou1alt ifcilt sDuau p ()aexomr3tytfatr n i;t0teumimpiy4apt lnvsl(  Draxmo;u4apx ifetlslm ra(mp u0 rtomf3iotop e uvi;s) eumim io4al nmnei s aDrrx p;u0tpxoif3tadfa emnmsnu) etnmo3iatlp rlnvol(  eto(o oodapeemfvi ()sDrax  ;t0oetoifciatfa2ra( p;t)tetomo3oadom   ieo;s) 2xmimpnodomte ivs (  2rm(  ;o4alxnmfcilsfmDem( s (0 rerxfctytlpD lu sls0 rxo(r no1ole  fct (fsrurxmpou0oex io3ias s uauvon()arxrio3ta1oatrlneo t)teumxrpoy1amtelncsls) rur(  ;o1alxnmi3ias a el(msn(0 eeomf3iotfa rlueslt0srurim iu4alen nctltf 2trx p;o1aleoio3iasfs em(mo;(0tlxomrctytlp r ueslt)t2uoxr no1am nlietlt)aDrm( o;u4oleniieilsfa ua(vsnt4texoxf ty1oatean i;t0truoiopnodopee nvtls  rra(m ou4oeto i3iysfs ulnvp;(4 lenircoadom eluesl( srum(r iu1opeemies ( aDrrur ;o0tex io3tasfa ranmpn()arermr totoa  livi;t) rtmxr ny4apee icia() Dua(m ot1alt mfcilslm2emu o;t)trtrmfcio1fptr i i;t) 2uoxr3iy1lm elnct sfs2tmxmp;t0oltn i3tyd aDrluvs t)arenio3io1opt  i ol( tetrimpnu1am emfct ()arrm(r nu0ape  oeiysla rmnmo;t) rxoxrciodlmDraies s0sruo(rpoydol  mnei ()sDra(rpou0tlen oetat m2ea(vs;u0tltnmr3oo1fpte u s (0t2xmxopoydllt  ietatf Draxm ou1oet iociyslsDra( p u0artnif3iotlmteaieolt0t2umio3iu4olt livi t)s2rm(  ot0oetn iciatfa el( o;u) rxoxf3oy1fm   ies;s)truoxmpny4llee feta(  rrrxmpou1apxomieilsfa ua(mp;t)tlxnmr totfmDrln i t0 2xrimpiy1oleelies (  Dtmx  ;t0alxnmoeiatla2rlumon(4alxrmo oa1lmtran i t trtr(r3io4optnmncilt)s2ua(monu4apt  f3iytfaDra(vs;u)treomoctadfaD lueil( truoxrpoydom n ici s)sDtrx onu4alenio3ilt s rlu on(4tetomr3to1faDrlivo;( trxrxo3nu4amtnlfcs sf rua(rpou4tlen iciadfm ulu o;t0tetomf tydla   i o;s tetmio iy1optemfeias)aDtm(mpno1alt ifctadlsDum( o ()tlxnxr tydlpD  uvil()s2xrxr3no1lpee nvi t  Dtm( o;o1apx  fciadfs ulnms u)aeenio oatfpD  nei;s0teto(o3iudop nmicsls  2taur nu0apeo icildlmDel(ms (4tlxomrctytopte i ils sexm(mpoo4altelncsat  Dur(m nu1tleniocils m ra(mp (0alxomr ty1fpDrlivi;() exrim3oodol nlnvt sfsDtr(r ;o1olxo ociyt a elu onu0trtnxocoatoa eauvols setm(rpiodll elies t sDur( oou1opt mociat s2rl(vsnu)treoxo tytomte uvsls) rxr(m3iy4lmtelnvtasfaDur(  ;t1alt ii3tytfsDuauvs t0aeeoir3oa1omt  ivol(0 2xm(m no4opeelncslt srurumont4apeoifeiydfaDulnms;u4 eeoxf3oa1fp e ivilt  rtoxmpiy4opt lnvtatf rrrxro;t4opto octadla2rlnvpn() exnio tydfmDe uvols t2um(r3nudole  nvslsfaDrr(m ;o0oeen fctas a el( p ()treomo todoptrau olt) rxr(rpoy4lm elfetatfsrumu ooo0oltoifcildlmDrm(ms;t4 reoio3iotlp   i i;t0 exrir ou4lp emfcsasfa2ta(rpou1oetn o3iys s rau pn(4artnmo totfaD aivs s)t2toxm3oodop n ieils)arurxroou1tlx  octlsla2emnmo t4tleoxo iatfaDr neil( s2xrimpoo4omtelfvsas a2rr( p;o0teeoifctlt a2uanvont4arxrmf ta1om rau s (  2xr(r io4amenmivi t  Drauront1olxoifeiad s2rluvp;u) lenio to1lmt aivils0 etmir3nodaptn ieias  rtmx  ;t4tleoifctadfaDuluvsn(0aexoif totoa rlues;s0teuoirpou4ope lfct t)aDtaum ou4apt ifeiatlm ulnvo u) ltoir3oytfate u o (  2ur(m ny1omte iesa(  Dtm( pou0tlxn oeiytlsDelumo;t0 eeniocoadlate uvi;s0teur(r iu4alt lncs tfsDuaum oo1olt ioctytfa rmnms u4tlxrxocoydlate n o;t  2tr(rpnu4opte ictat)srumx ono0apxnifctatlm2emnmo t)artrmf tadlp  an i t0tetm(r oodlm  mnvtas s2tmum nu0aex io3ild m2uan on(4arxrxr3to1la ran s s0t2xm(rpiudol e netat a2taxmooo0oee mf3iyt m2rlnms;t0teenmf todoateli s () eumxo iu4al  licias)sDurumpou1tpt iiciltfm2rm( sn(4 ltrio3iy1oaDelueils0 2uo(o oy4amt  nvs s)s2tax oot4aexnif3tlslaDrlump t)texoifcto1oate nvi t0seuo(o oy4apt  nvtltfs2umxm oo1tpxomfetatlsDrmnmont0 etrir iodoa raneolt) 2uoxmpiu1lmtelfvsa()srraxrpnt4tpt ifciltlaDelu s;u0arxoir3ootlpt an ol(0srtoxo iudal nmnesa(farrmurpou4ale if3tasfs2rm(vs u)tltoxr iodop rluvol(  2uoir nudolt mivslt)arrmxrpno1ope mf3iatlaDrluvs;t4tlerxfcoadlmteau i;s  2toiopoudap  mivia()arururo;o0tlt iieiaslsDuanmsn(0 ltoxoctydoptrln i (0trumxmpnydlme lfei sfs2uaurooo4openmo3ilt s rm( p;u0alxnxo3oadla raueil()trum(m oo4om n feiatf rtrx pnu0tptn feiltfmDul(vs;u4aetnir tadomtean il( t2toiopny1ll n fcia( sDtrx pnu0tlenmfetlsfaDrmuvpn()arxoifcoodlate ivol( srtmiopiydllenlfvi t) 2raxmo;t1aleoioetldfm2rl(mo t) rxrmf oydfaDe i s;()s2toxopnu4amtnlncsls aDuax  no1oeenmi3iadlaDrmn o;t) rtoir3tatlm e u o (0 2xrxm3nu1ll emfctlsfaDra(mp;o1alto f3iad m rlu p u)tlxriociotfm eli slt0s2tmimpoudll emfcilt s2umxm ;t0tle mfciasfm ea(mp ()arxrif oa1laDe nvs;()teur(opiydol n fesa( sDrau o;o1optnifeiadls uanvon(0tlerxf3todoptelnvs;()tetr(o3ny4amtnmivtl()aDrr(monu0tpxnmieiadls rau pn() exnmfcto1op elnvil( t2xmimpiodalenmfvtlsfsruru  nu1openiictadlm rlnmo;t)tetrmrciytoaDe n i;() rxo(r nu1ap   feilt)arurumo;u0tpe mietlslm2elnvpnu0 etnir3ootoaD luvs;(0s2urio3iy4amtn ici (f 2rmuront0texo ocilsls em( p u)arxnxfcoa1omD  i i t t2tmio3oy4optn nesa(  rtr(m oo0olxoiieilsfm em(vsnu0teeoio3oa1omDe iei t setm(opiydlltemiesasfartmu  no1olt  ocils m2uauvo;(4tlxoxr ta1opDeau s (  rxrirpoo4lp e net s  rum(root4ope  f3ildls ul(vp u0 renxr3iodfpt aieo t0 2xo(mpoudamtelnvil()aDtrxm ;u0olto fctlsfm uan s (0altnir3oadomtrlu o;()trtr(r3ny4ape lfci s)s2uau pno0olt mfctyd aDem(mp;(0artrif iydlpDr uvi t0 2xoxm3iudll nlies (  Dtru o;o1ole if3ildfaDelnmp;t)trtnio3to1op r u i;( tetrxr io1am elnvtat) rtm(ro;o0apenmo3tas a ua(mon(0 rxomr3totlateluvo (0 2umir3no4lptnlnet t srrauront0aetnmf3iys mDumumo;()aeeoxrctytfp eauei;( srxmxopio4lp n nvtas)srtmuro;t1tpx io3iatfm2ranvo;t4tleomfcootoa raieilt) eurxmpnu1lpee iviltfarurumont4aetn o3iydfsDrlnmp t0aetrmocio1lp r ieo;t0 2umir oo1oltnmnvsat  2rmumono0tptnioetltls elu p;(0artrmr3oatfatrln slt)srtoxr3ou4aptnlfes s srrru oou0tlx  f3iltlsDrmuvpnt4tetrmfcoytoat  neol()s2ur(rpoo4llt  ncsa(f Dta( oou0tltn feiat sDulnmo ()texnio3iatfp e ueolt  2uoim3oydope lfes s) 2rau  ot1aee  feiydfm2rlnms u)tetrmf oa1fmt an s;t) rtriopoo4ale mfetat srumur no0oetomo3tltfmDum(mpn() rxnifciytom  li i t)t2uo(r3io1amt mictls)srurxm ;t4oexomictyslaDemuvpnu0 rtomf3oydomDraivo;( trtmir oy4apeelfet t)aDtaumpnu4olt  ieiad s eluvs (4tltrif oytfaDean s ()s2um(r3oydam n nviat aDtm(mpot4opeomoetys m2uanmpnu0trxomrciytoaDeaues ( s2xmimpiu4lmen fvs () rum(mpnu4openmf3tatlaDua(vsn(4altrxfciatfp e i o () 2xrxopiudamtnmfcsls s2tax pot1oetnmfeiys mDemnvonu)texrmocoy1op eln ol( sexrir io1alee ncslt s2uaxrooo4olxomiciltfm2rl(vpn() rxrio3oadlpDeliei ( tetoxrpoo1ap elncsl(fs2urx oou4alxoiicildfm rmumon(0 lxoioctodfm rlu s;t0s2xrxo3nudoltelnei ( s2uaump;o0tlxniietydfaDeau o;(4alerxr3ty1omteln o s t2xoir3nodopen icils) 2taump;t4tltnmfetat a rln p t) exomfcoo1lp e u o;t0t2ur(r nydap nmnetasfaDta(rpno0aeenmo3iadfaDelump;u4alerxf3to1fmtrluesl( trxoxopiu4lpee nvi ()aDuau  ou1tptniictlsfmDumumsnt0 lxomr oa1lat lu i;(  2trim iu4om emneta()arrrx pnt4tpxn ociytlsDrln p (4tetrifcio1fpteau slt0 2xmxrpoudal   icsat artrur ;o4teeoioeiytfmDuln s u)alxoxf ta1lateliesls  2xrxr nu4lpee neils  2rm(r nt1tle  oetad m2ea(vont0aexoifciodfm e n ols sexr(m ou1am nlnesat)aDtauro;o0tpe  feiadfs rm(vsnt0aexomrctotomtr n s ()teur(o iu1ol n netat a2trum nu4aptnmoeiydlm uan pnt4artrif3ootopDeluei;s setmxmpoodal emncs (farrm(m oo0altoiiciadfaDeauvont0arxnxrctydfmtrlies (0teumxopiy1optnlfes tfartmurpoo0tlxo i3ilsfmDrmuvonu4trxrifcty1lmDranes;()seur(rpnudlmtnlivta(f 2ua( oot4apxnmieiys m2rm(mp (0trxnxf3iotlptr iei t)tetm(m oo4lp nlfci t)srum(mo;t0texoio3iltlm ea(vo;t0 renir iodlp eauei;s0sexmio3iy1omtnlictat) ruaur no0opeoioetyd mDeanmonu)tetrircoatoaD an slt sruoiopnu1ol elivs tfsrrmxrp;t0opeoifeiytfsDeau o;()texomr oydoa elu sl(0 etrxm iydale lfet sf Dtr(rpnt4aptomfeiysfsDem(mo t4tlerxo3ia1omDrlnei;s truoxmpiydome mivi t srua(ro;u4tpxnioeild a2ranvsnt0tltnifcia1la  au o;()t2tr(mpiodameemfesa( aDua( ooo0tltnmfetatfs ran s;t0alxrmo oa1om raiei (  etmxrpoo1alte nvtat srra(m ;o0teenmietyslmDuluvp;(0trxomo3ta1opt aieo;t)s2tm(opiydom n ieiat)sDua(moou0oeeomoeiat m2emnvont)tetnmfcoodopt  i o;(  rtrxo iy4lleemfcs ( arum(r nu4olx  ocilsfa2rluvp;u) lxomf3oydfaDrluvs;s0sexrim nudom emivi (f 2ururpou1tptoioetld s2rln o;u0 etomo3tydom  lu o t0 2toxo iy4opeemfciasfa2raurp;t0tpeo i3iat s2ua(mont)tlxomo3ootoa  li ol( sexriopoudlmtelfvias) 2rm(r ot4opxo ieild sDean pnt)trtnxf oodlp r n s;() eumxrpou4op e fvi t aDrru  ;t4tetomf3iytfmDelnmo;(4 lenxf3tydfa eluvsls0setrxr no4aptn ivtls  Durxm ou1oetomi3iys m2emn s u)tleoxo tydfpDr i i;s)t2trirpno4lme lnciltf 2rr(  nt4tetomfciysfm rauvsnu0teermfcoatlpteanvo () 2xmxrpoo4lpe  ivils) rrm( pnu1olx  o3tyt s rmnvs;() etoxo3tadlpDr ues;t0teumim3iy1ll emivilt)sDumum oo4apeo feildls uln o;(4artrxr3ia1fa r ivsl(0srtoxr iodome lfeslt artrump;u0tlenmfciydlmDeanms;u)tltnir3oodlpD  nvi;t0srxoimpny4ll emnci sfartrxrp;o1tpt iociysfs2elums;u4 ltnir iydfa  aueo;(0 etoxm3iu1llenmnvsl( aDumu oou1tpt if3tad aDrln p u4 reoxf iotlmt aues;( sexrio nu4op nlnctasfa2urumpnt4aet ifeiyd mDrau s;t0trtrmf oodopt  u slt0 rtmxo3iy4amte fvs t a2trxr no0opxomo3iydfs2ulnmsnt4 rxrmo to1oat aivs ()t2xo(r3iydll n nesl(fsrtrxrp;t4oex mo3iltfsDeauvs;u0 exnir3to1fa rau i;t)texoio io4lpenlfei s  ruau  ;o1oltn o3tasla ean p t) ltoio todlatrli ols trurxo3ny4omtnlietlt)a2raxmpno4aetnii3tytfsDea(mont4treoirciydoa  aues;t sexo(opny4om  lfei (f 2taur ou1tpt moeiatlm um(vo t) lenio iatlpD  n sl(0srtm(mpou4opee fcsl()arrrx ono4ole  o3tadlaDrmu s u0tlerxoctadomt  i s t0srtrim nu4am  micsa()aDtrxrp;t0aee mo3tadfs2ulnvpnt)tetoif ta1fm raies s) rur(opiy1lpe licsa()a2umxrp;o1tpt mf3ilt mDua( pnu0altrmfcty1fpDran ilt0s2tm(m nu4am nlfeia() Dumxm ou1olxoio3ild m2rm( onu4artnmr oydlpDean sl( trum(m nu4oltnlncs sf 2uax  nu1oeen ietlt mDeau s (4 ltnmf to1om e nei;t teur(m oudlle  fvi ( srua(mpot1aleoioeiad s um( p;u0tetrif iatopDrln o;s0trtm(m3ou1alt lfeta(f 2taur ;u1oeto fetys m ulumo;t)arxrirciodfpDelnei;t) rxr(o3oudom e nvia()aDrrxmpnt0apxnmo3iadlm umumo;u0aexoir3todopDe n i ( trtmxrpno4lp nlieiltfaDraxm ;t4opeoifetys m rmumo (4aetoir oydopt an o ( seuoimpoo1ope liciltfs2ra(m nt1ole mieilt a2ulnvo;u) renmrcoy1oa  ai slt)teurir oo4amtemnvtltfa2rm(mp;o1tltoifcilt s2ul(von(0trermo3ootfa raues s  2toxopio1lme  fet s)a2tmu p;o0oee io3iltlm2uan snu)texnif oy1fmt au o (0 ruoxo nu1omt  nctls s2rmu o;o4oeeoii3ildfm2rl(mpnu) exrxo3ty1fm eauvi;t)seumxr3oo1lmtn neslt s2tr(r nt1olxnmoctls s umnmont0aleoir iadlmDelnei s truoim iy1lptnlfetat) Dumu  no4tltomo3tysla uan p;(0 lenmr oytlmte ueo;t srtrxmpoy4lle lfvilsfsDraxrpoo4aleomfctasla2ra( o;t0tlxoxo tatom rlnvols)teum(m oodll e netltfs2ua(rp;u1tptnif3tldla eauvs ()texnxf iy1lp  lu o;s0t2xo(m nydlmtelnvi (fsDumxmpoo1apx  o3ils m ra(mont0trtrircoydlaDraieo;()srtoxm ou4amt  ictlt)aDumumono0apx iictyt a2eln s t) exoir3oy1om  au o;(  rtmim nu1am e ietlt srur(mo;u1tlxomociadfs2ul( o;t0 exnio iytomt aneols)s2uoxo ou1apeelnvsa( sDra(r ;t1oetn ocilsla rln s (0alermf3io1op e nei s0t2ur(opno1omeelfetlsfaDraxmoou0aex ifeiysfmDua( on(0 rxrmoctotfpt aueils srtmxo iy4ol  lnci s sDurump;u4opxo f3tytlaDem( sn(4 exrxrcoo1fm   ivilt truoxo3ou4oleemieilt arrruront1olx ifciydlm2rauvpnu4 etrxo ia1omDrli ols0trtoxm3ny1oltn ict (f 2ua( poo4aeeo i3tld a eauvo t0alxoioctytfmt lnei;()trxr(m iudomtelivias srur( o;u1oeeoiicilsfs2umn pn(0 rxriocia1fat  nvo;s0t2xo(o iydopte neslt) 2tmxmpnt1opt mf3iad m2elnvon()tlerifciadlptrai ils)sexrxo3no1amte ivils)sDtmxmoot4apt iociys m ra(vpnu0aeenmo iadlp ean o;s t2xr(mpoy4lpe mneias  rtru p;u0tex  iciadlaDum( p;t4aetnxo tatla eauvilt  eurxr iu4om n fes s srrmxm no4oetoiieiadfsDum(mo;u)tltoxo3to1oa eau i;t)srtmio3io1omt  ncsat)a2tau  ;o1aex  oeiat sDeau s u4 etrmr3tadfptrliei s0 2uoim oodap e fci s)a2ur(  ot0tex mo3tls s2emu s;(4tltrmr iydfptr n ilt setr(o no1ol nmnes tf Drrumpou0tee moctlslm2ea( pnt0texomr3oatla raneslt0 exmio ou1ole  fei (  Drmuro;u1tetniociat aDuanmpnu)trxnmr3tatlptelneo s seumxo3io1openlnvtas)artrur no1oex  oeiyd m2ua(vs u0alxrxr ty1lpt au s;t  2uoxr iydlmee neiltf 2tmur nu0oeenmf3iyt s rlumsnu)trxoxr3totomDrai i s t2toxo3io4lm   fvt ()s2uaxmo;u4teenmo3iyt a ean pn(4altnmociytlaDe uvils0s2ur(opno1op nmies tfs2rr(ront1texo i3iyt m2umn s u4areomf ootlat  ueslt0teuo(opnydam n ncilt arum(mpnt4aex mfeiadfm2raums t0arxnmr oa1op   ieo s0 rurir oodal n ict s arurxmp;o1alt iiciysla umump;u) eenmr tatfpt  nes ( s2xrio3nu4apeemieiat s2rmxrono1olxnmf3iyd a emn sn()trerir3todfa   n olt)sexoir3iy1om elfeiat)arrax o;o1ape ifciadlmDeanms;u) etnircoadopDraneols s2tmio3oudam elnes s s2tr(m ou1tpto o3iyslaDul( sn()alxrmo tadlmteaueo t)t2tmxrpiodopte nvtl(f rrrx ono4apen o3iaslm rl(vs;u4 lerxo3oytomD auvilt) 2xmxm3nydllenmfct sfaDum(m ;t1apenii3ils s em(vp u0aeermr3to1omt ln slt) 2xrxopoo4oltelivs s  ruaxm ;t0alxniociat sDrm(ms;() rxnmo3iy1oaDeau slt  rtoxo3io4am e ici t s2ta(ro;u1opxo ociytlsDul(vsnt) renirctadop  lnvs;t)texoir3iudlpee fes t srurx p;o4aeeomi3iysla2emn s t)teerxf3tadlpDe ues;(0 rtmxm ou4am elncsls  Dum(rp;o0opxo octadfs2ua(ms;()tltomr ta1fm e ieo;t  2tm(o3oy4om  mfeslsfarumurpot0oet mf3iltfm rmuvonu)arxrxoctotlmDe nvsls t2ur(o3iu1optemiet tfa2tm(r oo4opx  ieildfsDumnvo t4 rtnif oadlpDr ivo;t sruo(mpiu4omt lietlsfsrumuro;u1aptn fciys s eau p u4aeerir3todlaDranes;t)t2um(rpnu1lptnmfvtat)a2umxmpot4teenmoeiadfm ea( o u4 etnxocty1fptelu s;t tetmxo ny1apt  net s srra(m ou0tlxnifetydfm2eauvp;(0 reomrcta1lmD auvs ( s2urio3nu4ale lnciltfs2uau oou4oeeo ocias s elnmo () lermfcoo1fatean s;(  rxo(o iy1lpenmiviat)sDrmx pou0ape io3tytlsDulnvo;t0 rxrir3iydom eaieslt0 rxmiopio1op  lnvi sfsDtrur ;t1ape  ociad a2uluvsn(0aetoif3oytfmDeai il(  rto(o no1ap nmnvt t s2trxmo;u0optomoctytfs2ra(ms;t0teermf3oodomtelues;(0 rxrio3oo1lmtnmietltfa2tru  ou1oeeomoeiyd mDrluvs;t0trtrxr3ta1lpDranvo s0trxm(o3no1am   ivtl()aDtaxroot4oee mo3iydlm2ea(vpnt0 exrxr iotoa elivo;s s2xoiopoo1lp  mfeslsfs2rmxrp;u0optnmieiat mDrln sn() rerir iodlm eli sl()texoiopnodlltn fvilt a2uaxm ;o0opxoioeilsfaDemu o;t0teerxocta1fa rlivi;( setoio nu1al nmfvtasfsruaum ;t4tpxomieiasfa raumo t4tltomfcta1omDeanvi s  2toxr3iy1omt mnvilt)aDtm( oou1aleomfetytfm rm(mo u)tetoxf3tatlm  lu ils) 2ur(r3nudoltemnvsat  2tr(rooo4opxo oetysfaDua( snt)tlxrmfcto1lateaivi t0setoim3nodlme  fcs (fa2truront0aleomo3ilt m eanvs;u0trxnxf tadlaD luvi ()t2tmim3ny1lpenlfctltfs2ua(rpoo4tpt  i3tysfm umnvo u0arerxf3totomt livi;s)s2xmxo3io4lp e fciat  Drr(m ;o1alenmi3ilslm eluvont4tltrmf3ta1lpD ai sls)trxmxo nudllt mfvtas) 2rr(  ou1aleomociasls ua(msnu)alerirciytomDeln o;()truoxm3oudaptelfetltfa2rr( onu1oeeoif3iydfaDel( s u0 ltrmo to1fm e i o;() rum(opnu1lpeemnvils srtaurooo4ale  f3ildlsDua( o t0teerir3tatlm elu s t t2xoxm iu4opt mfcia()srur(rpot1oexoii3ils m umnmon()texomf3totlmtran ols setr(m3iy4lptelfci t  Dtmxmp;o4aleomfeiltfa2rau sn() renmf3oytfmteau o;() rtmimpoodom emivt t  rur(mp;o1aexoiictlsfs2rl(vs;t0 etnxrcio1oa eaueols) rxoxr ou4ap nlicils)aDtau o;t1apxoiociadlm2rau pnu0 reoif oo1opDrlivs;t) etrir3ou1altnmietasfarururpnu4tlt mieiatlm2uluvpn(4alxomo3iydfaDrai o;s0 2xmxm3oudllt  fvsls)aDur(rpot0ope if3iatlaDran onu4aexomo todlpDe i o;(0s2xm(rpoy4aptelfviat  Dua(r nu0tetoiociltfa rl( pnt) lenif3tadfaDeluvsls0trtm(o oo1alenlfvslsfs2rrumonu0aet  i3ils s ua(mp;t)tltnio3ia1oa eln i ( truoxm3oo4lm  lfet sfs2ra(mpot4tpxoif3iyd s umu s t0 rtnmf3io1opDeaivolt) exm(opiodlp elnci s a2rmx pnu0aeto oeiyd s2ea( o;u)trermrcoo1omD lies s)s2tm(m3ny1lm n fes s a2ua(ro;t0texo f3tydfm rlu o;t4 eermf3iotla elivo t srumxo3oodaltnmicslsf 2tr(rpot4aeeomf3ildfa2el(mo t4 exnir oy1fmDranei;( tetmxo nydll  mieilsf 2ua( pnt4aeenmieiydfmDumnvp ()artoif oo1lmtelnes;s) 2to(o3nudam elncs () rraxmpnu4tex  f3iysla2um(mo u0 etrio ia1fpD  ivo t)srxoxo3iy1ap   fvs t)s2ua(m ;u0ale io3tydfmDeluvont4tlxrio3iytoatr i slt0 euoio3nu4ale mnvias a2tau p;t4aeeomociys aDeaumo;t)arxnmo to1fpDr nes;(0 eumxo3nu1ol  mfeils  rumx p;t4oleo o3tyd aDran snu4aeenif3tadlmteaivs (0 eto(mpiu4amt mfct ()s2rax  ;t0aleo feiad a um( pnu0altoxo3iatopD  iei t)srtrimpnydlp n nvils) rrm(rpnu4tltoio3tlsla em(vo;u0texoiocoa1opt  ivol( trtoxm oo4ll nmnvt t)s2rrumpot1oeenmocilt s2rmn p;t4alermrcoo1om  lnes;t0truoiopoodaltemnvs t  2rmurp;o0tptn iciadlaDumumsn()trxoir3ta1opt au i t  rtm(rpiudape lfetatfa2tm(rp;t4tlx mictatfa uanvp;t) leoiocoy1lmDrau s (0srum(o no1om  micslt  Dtr(mp;t4ape moctasfs emu on()aexoxfciy1fptrlneo s0 etmxo3oodlp elfvtlt  rrau pno1olto icilsfsDraumsnt0 leoxrctotlm  ai il(  2xmim3oo1lmtnlncs tfaDur(mpou1tpxnifetas mDulump;t) exoxocoytlmte n ils0t2uoxmpoo4op  mncs t)a2trur oo1alxnmociytlsDemn o;t)teermo oo1opteaneslt0trxrim3ou1lmee fetlt a2urxm ;u4oexn fcildfmDrlump t)treoxrctytoaDeaivo;( s2xmimpoudaptnmieiat)sDuru pnu0olxo oeiasfm umumo t)artnmrciadlaDraivils0s2xmxo3oo1llteliei tfarrru  nu0alx mieildfm2eanmo;t0teerio3oy1lmDelueo (0trxm(m oudale  ncs (  Dtrxm ot1apt  ictatfa um(von() lenif tydopDeaneo ()sexrim3ny1ope lfvslt)sruaxm ;u4tpe  oeild aDua( s (0tlermrcoodomtrlu i;s) rtoxm oo4lmt livi t s2uax oot1opeo f3ilsfmDrlnvpnu0trtoxf iotoa raieilt sexr(rpoy1lltemfeias)sDrmxr no4tpeoiieiyt aDuluvo ()trtnxocoytfp  luvs;() ruo(o3ny1amt mfctat arrrx ont4olxo ociadlsDuanmo t)aetoxr3oodfateln s;t)srtmir oodome mncsl( a2rrurpou4tltnmiciys mDrln p (4teeoio iy1omtrlu s;t srxrio nudolen iviltfsrur(rpoo1aex mf3iys m em(mpn(0aeerxo tadfatrli s (0srxo(m ou1aptn fvsl(  rua( o;o1aeto feildlm raump;t0teeoif3iatomtraivil()texo(m3nu1olt mivia()a2rmxm ;u0tet io3tyd mDrl(vo t) rxnmf3totomte neols0 euoir no4oleelicil(f 2rrxro;o4olt ii3iltls2raumsnt4trenio3ty1la eaneo;t setrio oodolenlneslt srraxr nt0olx mieiltfsDul( s;u4 eenmo tytlpDraies;s tetm(rpiydlp  lnei () 2tm(  ;t4tptnifcild mDumnmo (4trerxrctodopD  u s;(0sexmim3iu4ll   fcilsfsrtrx oot0aleoiocilslmDrl(vp t0trxriocoytfa rluvi s)seuoio3nydlp nmnvt sfsrua(r ot1alx  feiaslm2ua(mp;t)texrir3oatlaDeai s;s0 eumxopno4lm n ieiasfsrra(mono4aee  ocildfaDeanmsnt)aetnxfcoy1fm  au ol(0trtmimpny1amenmfei t srtrumo;u1tex  feiltfsDrm(ms;u)aeenmr ty1la rlnvsl(0tetoio3iy4ap  lnci ()s2ururp;o4olt io3tltlaDrauvo t) etrir iy1fpDraues;(0 2xm(o oudap e nviatf rur(  nu0aexnmf3iysfs uanvp;t) exnmoctadfatr u i;(0 2xo(r3ny1lpte fcias aDtr(m ot1tpeomoctasfsDemuvp u4aexrif iotfmt  nvo ( t2xmimpnydop n nei t)sDtru ont0olenmi3iys s2umnmp ()tlxrxr3ia1lpDranvi ()t2um(o iy1lmt  fct t  rtruro;o4oltoio3ild a2rln p;()aexrir3iy1opt auvo t)s2tr(mpnodll  lnct ()aDrrurpoo0tetnifcilsfmDrlums;()alenxr iydlpDelivol(0 2xo(o3iodapteliesltfsDum(  oo0apto f3iyslsDelu on(4texriociotopteauvo;() eumimpnodll   fvsltfsrumu o;u1teenmicias m umnms;() reomocoatfa   nvi;(  2xmxopoo1lle  feiasfsrumurpoo0apt  fetys a2rlumonu4treriocoatlptean ils)sexrxo no4omteliesls)arurxm ;t1aetnmf3ilt a2ul(vo ()trxomocoydfpD  ivs (0trur(m3nydop  miei tf Durx pot4aetniicildls emuvs u0aeerxo io1lm eanvs;s0s2xrirpiu4am   nesls)sDtmxmo;t4tpe iieiltla ea(mo;u4 lxoxo oo1oat lnvo s  2xm(rpou1ol e nctat  2raxrp;o4tpeo oeilslmDel(vs (4texrxrcoatlat lu sls)t2uoxrpio1apte fvil(f 2um( pou1tpxnifciytfs rau s u0 lerxf iadla eaivi;( srto(m oydop nmnctls)aDuaxmoot4teeomfciatlmDem( p (0 eermr3iytlptr u s s teuoxm3ny1al  lfvtltfa2tr(mont1apxnmiciytfsDelnmonu) lxrircoodlptr ueol()srtoio3iudamtn nes tfs2urumo;u0tpe ioctas sDrmuvsnu4aetnmr tadoa e ues;( s2tr(o3no4omt mnvsl(  rrru o;u0optoii3iyt m um( onu0aeermrcia1fa r u s t0 exmio oydlm n netl(fs2raumoou1aex ioeils m rm(mpn() etoif io1lm elueo s trxmxmpou4ape  ivslt)arra(r ;u4tpto o3tatlm ulnmpn(4 rxnmo tatfptrlu i t0teum(m3oy4lmt  fvi t aDtau p;u0oltomociad s rl(vp u0trtnmocio1fptr nvolt  rtm(opiudamtelieia(fsrtm(monu0tpenifeiytfm2rl(vs u0 rtoxo tytomDelnes;t0 rto(m ny4lpen nvils) Dtmu p;u1tee  oetadfm ulu p;(4 ltnxr oadopt  uvsls)teumimpiydaptemivias)aDta( pno4teto o3iys a rl(mo;(4teeomrcoydopt aieo;( texrirpoudal  lnvt t s2rrum ;o1alxoio3tldls2emu ont0tetrmocty1oaD  uei (0tetoim3oo1lmtn feiasf 2umxro;o1tpx io3ilt s2rl(vs t0 eermocty1om  an o ()t2urxm3nu4ol   fvs s)s2taum ;u1olenmocildlm emu snt4 ltrmr oy1fptrai il()srxm(m3nydlpe lfctltfsDurxmpno4alx mocils s ulnvsnu4arermf3iotopt lies;t  rtm(o3io4olt mfcsa( s2urx onu0altnioeilslaDra( snt0tetoxo3oydfpDraivi t srxm(r3iydap e fei (f 2trurpou1oet mietlsfs rlnmo (4areomrciotla  lnvilt0 eumio iydope  fcsas aDtaxm ;u0tetomfciadfa ea( p t0 lenxrctadfa eluvi;( s2tmim oy1ameemfet sfsrta(r nt1tetn ietad m ul(vs u4artnxrcoatoateaueil()trur(mpiodlmtemieiltfartaxr ou0tpe  o3iadlsDrm( pn(0tlxoxf3ty1fptr neils0t2urxm3ou1ap  lncsls)s2tr(moot4oexo o3tysfa uaump () reoxrcoydop raieo;s)t2xm(o io1ape mfcias aDtrurono1tlto feiysfsDeau s;() eerif io1om eliesls)tetrio3io1omee fcsl(  Dtmxroou1olenmf3tasla2uanmsnt4alxnxr3totlpte ueo s0tetm(rpoy1apte nctl()srrrxr oo1tle io3iasla eln o;t4 exrif3ia1fmDr u o;s0 2uoirpnu1llenmncs ()aDra(rpou4opeoiictlslm2eaump t)aetomo todlptelnei s0t2xrxrpoy4ope  fci t)aDrmu oot4oexo f3iadlm elumsnu)trerxfctodomtelivo;s)setr(r3oo1aptnmnesltfa2raxm nu0oeeomiciaslm ean s u0 lerxr3ia1fateanvs;s0seumxm iodal nmnvt ( arum(mpno0texomfciat a emn s;(4 etoir3todoaDr ieols  exmimpoy4lmtelics s arrm(r ot0tle  i3iat a2rm(vpn(0 lerxoctytlp elueo ()teur(r3ny1opt  ivi () Drrxmpno4opx  ietltlmDranms t) ltnir iatoaDelueol()s2umio3iu1openlfvslsfa2rrxr ;o0aeeo f3iltls2umn snu0tlenif3oydlm  auvi;t0 2toimpiy4llt  fcslsfsrtmx  oo0altn o3tyd m2rlnmsnt0arxnirciytlpDeln i;s)trum(opiu1omeemfvsas  2uru  nu4aee ifctlt a rau ont0alxrmo3ia1lmDranes ()s2trxrpiodape lneils)artm(r ;u0tleo octltfm2umnmp;u0 rermrciy1oa  aneo t)srtmxmpny1al elnci s)sDta(r no1olxnifetld s uln pn(0altrifcoy1oatelnes;t0 etmir oydalen ietas a2trumoou1apxn ociyt s rauvo u4aetrif3iydfaD luvo (0teumio3ny1lpee icsl(fa2tm(m ;u4opxn feiytls um(vo;t0arxomr ta1omtr uvo;s  2xm(mpoydolte fviat) 2ta( pou0tpxomi3iltfs raums ()alxnxrctytfatr ues;s0 rxmxrpny4olt liei t arrmxm ou0oee mociydfs ua(vo u0 reoirciotopte ivo;s0srxrim3no1olt lnctls)sDua(m ;u4opxnifeiydfa2umump;(0teeomr io1om elivi;s0texoir3iu1omtnmnet ()aDum(m ;t4tleomieiadlm2eanvpnu)treoirciatfmDeaueo;(0trxrim3iu4lp n fvias) rururo;u1tlx mfeils s rlnms;t0aeerxrciytomDelneolt trtmirpnudap n nvi sf 2tr(r ot1opxn ociaslmDumnvsnt4 exomf3iatlmD  nvi;t0 2to(r3iy4lmte ictl() rrm(r ;t4aexo ictys s rl(mo () exrxrctydom  au s;t0 2xo(mpnydaptn ict s  Dua(mont1apx iietydfaDumnmpn(4 etoxf3tytoate uvi t s2xm(opnudlle livi s)sDrrx poo4apxoio3iyd s ul(vo;u4 rxnxr oa1fptelieo;( trxoxopnydlp   ictas srumum nt1olxomi3tltfa uln o t)arxnxf3iatlpDe nvi;s)tetm(opoy1ale  fes sfsruaum ;u0oetn ociydla2emuvpnu0 exomo iotfmDeauvi t) 2umirpou4lmtnmfvsasf Drr(mont1oleoioeiadfm uanmsn(4altnifctatfaD lies;() 2xr(mpnydoltnlivils sDta(mp;u0oeeo ocilsfs umn o;u4trxoif ta1lmtelivi;s texrxr oo1al   netlt)sDumu oou4ale  feildfs2rau s;t)alerxo3oodopDeanvs;t teumxr no1amtnmnetat  rurur ot0oltniociadfs2uln pnt0 etnxr oodoaDr uei;t teurim3nu4ol e fcs ()arur(rooo4oltn fciat aDeln p t)alxrmf totlaDraivils0trxo(r3nydape lnei sf 2tr( pnt0aee ioeiltfm rm( o u)arxrirctadla rliei s0trum(m3no4lleelivtls s2ra(mont0tlt  f3tyt mDrlnmo;t0arxrxf3oodfmD lnvi t)srurxm ou4aleemivil()srurxr ;o1oetn oeiydfmDea(vp u4aexomfcty1laDeauvs t0setoxrpnudam  mnesas) 2um(root4tpxnmf3iad aDel(vont) renxociadoaDeauei s)s2xriopno1om e ietasfaDta(mont1apxo oeiadfa2elnvo u4 eeomocoa1faDeauvs;(0trtr(o ou4olt lnesa(f 2ra(mo;o1optnmo3iasls2rl( o (4arxrxo3iatlpteanvo;s0 2to(r oy4alenlnvt t)aDuaurpno1aet  ociasfsDrau p;(4treriociotlpt liesl(0setmxr ou1oleemivtas arta(r ou0apx mo3tydlaDeanmsnt4 ltomo oa1op r neslt)t2xmirpno4ome mnei s) 2rrum ou4tpenmf3ild m2ulump;u) lermf ia1opD auvo t0texrxo3ny4opt mieil( arrau oot4olx ifciltlmDeluvpnu)alxrxo ia1laD aues (0 rxmxrpoy1lpen icsls s2umur ;u1oetniictad s rl(mpnt)texoifctotoptelivil( t2xmxo ou1ape lfct () Durxr oo4oeeo ietld a uluvsn(4 etoir oytoatrlnvi (0 ruoxopoy4ap nlnvsa()s2rmxmpnt1oltnmictltfm2ra(vp u)tlxnmfcoy1opDe u i () 2trxo io4lltnmncs ()srur(m ;t1teeomietasfmDumnmp u4altrmf iytomte u s;t0t2uoxm3oodaltnmnes t artmu p;o0oexo oetyt sDrluvo u0artnxfcty1lpDe uvo s0seuoir3io4apee nctltfaDtax ono4ole ioeilt a2emnvp;u0altoxrctatfate ies t seumim3oy1ap n nes sfsDumxmp;t1alxo i3tasfm2eaumo (4areoif todfmD  ues s)teuoxopou4ole  icia(  rumx p;o4tptomoctasls ea( sn(4 rxrifctatoptr nvsls)trxm(r3iu4lp   ieiat aDurx p;o4altoif3iatfmDuanmo;t0 lxnxo ia1faD anvi;(0srto(rpoodal  mnviltf rrm(mono1apxo o3iasfs rmumo t4treoifciodlp  aneolt sruoxr3oo1alenmnvs tf rraurpnu1aptniociyslsDra(vsnt0 rtomo tytlptr neo t)srum(r ny4lmtnmics (  rraurooo0tpe  oeilslaDuluvsnt0alxomfciy1latrauvo;s s2uoim no4ole  fvsat)s2uau  no4oetomoeiydfsDrl(vsn(4 rxrxfcia1op r n s ()seumimpnudomen ivs ( aDuax  oo4altn fciatlm rl(vs t0alxoxoctatopt  n sl()t2xrxo3oo4apenmnct t aDumxmono0tpe  fciadfsDum(vs;u)arerio3todlp   nes;s)trurim oo1op nmnet (fartmx oou0oetnmietldfa rlu s;u4texnio3oa1faD lu i;t  etrxm nudlme lfvsat  rumurpoo4tlxo fetls aDrluvp t4 leniocio1op e nvi;() 2xr(mpoy4apt  feias)artrxmo;u4oltn oeiydfmDuau sn(0aleoif3oatfpD lnvi;t)seurxopio1oltnlfctat)s2ua( p;t1openmfciysfa2rln snu4 renir ootlm eli s t srxriopiydop  lfcsa( aDurxrpot1tlxo oeildlaDrluvo (0aexnxf totlptrai sl(  rtrim3oy1alte icta(farurxmooo4tex iociadlm2emu pnt)treomrciodfa   uvsl()tetrxr3io1lpte ietas)srumx o;o0texoif3iytfa2ul(vo;() lxnmo oodfm raiei s seuriopiy1opte fvtl() 2ra(mp;t4tpeomoeild a umnmo u0tlenir tydlp r uvols0sexmxr nodal n netl( srua(mpno1oeto fciadlm2ra(vo t0altnioctytlm rlieo t)sexr(mpnydaptnlivias) 2taxro;o0olto ociasfm elu p;t4arxnmrctydfmt au o;t)texm(m no1omee icsls  Drrx o;u4aptomfciatfa um(mp t4 eenioctytoa   ueol( seurxmpnydale lfvt () Duau o;t0tpxniietysla uauvp t4tlerirciadfptr i sls)trtoxo ny4lm emict ()s2uaxrpnt4olx  iciydfaDumumo u0 exomo oytoa  lieo;s0 2uoxopou1aptemiesat)s2um(ro;t4aptniicilt s rm(vs;t0trtnmf3tydlateli sl(0srtoxrpou1amt  ncsltf rua(r oo4tptn i3tysfs2raump (0tleniocia1fp eaiei;t0 rtmiopiydlle livias  Dua(m nu1ale  ieildfs ulnmo (0areoifciotopte nvi;s)teto(mpnu4lmtemfetlsfs2umu  nu0tpxo oeiatlm rlnvs;(0 etniocio1lmteluvo (0trtm(m3oodol e fcia( sDtaxm no1apto ociasfmDrmn s t4 renir3iy1lmDeau ol( t2urxo iu1lpee nvs s  Drrx o;o1tle mo3iysls raumo;() exrmf3iadlaDeaneslt0t2tmxopoydale lfet tfsruaxrpoo4opt  iciltls um(mp;u0teerxf oa1lmDeaueo;s  rxo(r3oudlmenlicta()arurxrono0oet  fctys sDrau o t4arxnmfctatlpteli i s0t2xo(r3ou1aleemiesasfarrax  nt4apxo oetldlaDuluvonu) leomo3iatom raneolt) rumxr3iy1lltn iet s)sDtrurooo0teeomoeildlmDrmn on()trenmrctotop rlnes;s) 2um(opou1ol emncilt a2uaxrono1tltomf3iaslaDrmnmp u4trxoxo iydfa   ieol( t2xo(opoo4aleelicsa(faDtaxr nt0texnmfctydfmDuluvpnt4 lenio3iy1faDeaneolt0seurirpoudomeelivils s2rax onu4altn oeiaslm ran o u0 rxriocia1lateln i t  2xmirpoydopee net s) rurumpou4ape  o3tlslaDran s ()altnif3oa1fa  aueolt0t2toxrpno1ap n icsatfsDta( pno4oltomfciadfm2rm( p u4 rxniocia1fa e ivs;s  2urxr nu1op   fci t  rtru ono1tltoiicilsfaDemnvp t0trxnmrctydfmteaueils0teumxm ny1olenlnvilsf 2urxmp;o0tleo iciad a rluvsnu)tltrxo tydlat ai i (0 eto(r3oydomee ncsl(fs2rr(ro;o0aeen iciyd s2uanms;()aexoirctadla r n s;s0 2xrxopoudlpee ietatf rra(r nu1apeniietadlsDrm(vsnt0tlxnmr3iytlmDeau o;(  etmxmpoo1lp  mfvi t)aDrr(mpnu0texnmi3tat a umn p t) lermf oydlpDeaneo s0 2xo(r ny4amen ieils)a2uaxr nu0oeeoiictytfs ran p t0artriociy1lmt aneo t0t2xoio3nudol n nvi sfsrum( ono4aetnio3ild m2ul(msnu)aetoio io1faD  u i;t0 ruoiopio1ope mneta()aDumumpou4tpt  iciatla eln o u)aexnir oo1lm rauei;( teuo(rpio1op  miciasfa2tm(r nu1alen ictytlsDrlums;t)trerxr3oatfpDeluvs t)s2xo(r nydlm nmies ()srrmu poo0ole  feiydlsDua( pnt0alxrir3oadlptrluvol() 2trxopno4al elivi ( artmur no0opeoiietysfm ea( p (0 leomo totlaDrauvols0 exoxr3ou4lm n fct (f 2uaurooo0tlxomo3tlt sDuluvpnu4artnxociotfpt  n o;t srxoxo3no4lmtnlictl(fs2trumpnt0tpt  f3tydfa ean o u)teeoif3tytlpteau sl() eto(o nydlm nlivsl()s2ur(r nu1olt ioeiatfsDrm( o;() eeoxrcto1fptrluvsl(0 etoxo3nu1olenlfeil( artrumoou1opxnio3tltlm elump;t4trxoxfcty1op  lu i s trtmxm3oydapen ncsltfsrrmu pnt1teenio3iatls eluvs;(4 rxrio3oytoa eln s s0 rtrxm nu4lp e icsl(fsrtmu oot1tpeniiciyd m2um( o t4tleomf3oydomDeanvi s0 rxrxr iu4lpenmicias  Durxm ;u0apeoio3iyd m ulnmsn()arxrxo3to1faDe i i ( tetoxr3nu1lmt lfetat) 2rmum ;t1altniociydfaDumnvp;u4 etrif totlm eai ilt)t2xo(o3iydaptelfesat) ruax p;o1olx mfeias mDemn ont) exnmo todlpteln o;(  2toim3iy4lpenmncs t srtm(mpnu0aee io3iat a2umuvs;u)texnxf oa1fmteaueils0 rto(rpnu4ome livs t a2rr(m ou0tlt iocilslm ulumo;t0tltoxrcty1om e uei t s2trxo io4al  lfeia(  rtmumpno0oexo fcilsfs2ul(vs (4aeermfciydlmDeaueil( s2uo(o iy1omt livt (fsrrr(mono0tpxo feiaslmDel(vs;u0tetnio3iodop rluvslt texm(m3oy1olt lfetas)a2ra(r ;o0alto ietys s rm(vp ()trxoif3oy1laDe ieol(0 rxrxo3io4amtelfvsltf rurxmp;o0optomociydlsDel(ms ()trerxfctodomt anvilt)setrim3no1apenlicil( a2tmx onu0apxoii3tldfs2ua( p;()trxomf3iotlmDr ueilt) rur(r3nu1apt  icslt  rrrumo;u0alto fciytfs2umu p t4trtrmf3to1opDe n s s0 etoio3oy4lp elieiatfs2rru pno4tlxo i3iasls2um(ms () etrifcoa1fptr neol(0t2trimpoo4om n ncilsfs2um(mpou0oet ifeils mDumu snt4 lxnio to1lmtr i i;(0 rxm(opoy1lmeemfvsls aDtrxroou0tpx  oetytfaDua(mp;t0arxoxf ootoat luei ()texriopny4om elicta( sDurx  ;o0ope  fcild mDulu o (0treoircio1fmtrlnvi;( t2trxr no1apenmncs t  2ua(m nu4oexn ieiyt m rauvonu) rtnmo oydopDranvs s) eto(m iu1amt micsa( aDtaum nu4aeeniiciytfmDuaumsnu4 rtomf ty1op e ivs t) 2tr(opiu1opeemivil(fsrumxmpot0openif3taslm2um(vpn()aetnxf oadfaDeai ol( seuoir3oodalte fet ( sDtr(  ou0olx moeilslm2emnvs (0tltrmo ta1lm r ivi;s seurxo3nu1altnmneta( srumx onu1olt  oetltls um(vs;u4alenirctotlaD aivo t setoir iu1lp nmiviasf Dumx pno0aee mf3tlt mDean p u)tltomocoadoaDrlu olt0srtoxr ou1am nlici ( a2tmumoot1tpe  o3tatfa ulumonu0 lxnxo oa1lpD  uei ()t2trimpiu4olte ivils)sDraxronu0aetn o3tld sDeluvonu)altrif3ia1fptelivs () rtr(o3iy1lme  ies t  rum(  ;u1tpe if3iyt a rlu o u4arermf tadlmDraiesls0 rumiopno4lpen ics s)aDrrxm nu4aetoiiciytfs rlu o;() exnmr3totla elnvo s)sexrio oydam emfet sf Dra( ooo1tptnio3iyd s emu pn(4 exoxo3iytoatelnvo (  rumxr oy4amt  ncs s)a2trx oot4apto ieiytlaDrmump t4tlenxoctatfaDe uvi;( seto(m3ny1alte ictat)srtau pnu0oeen fciydls elumo t)tltoif ta1lp eaneslt) 2to(r3ou1ap  lfci s) 2ta(r ;o0oleo f3iyt m uau p u4trtrio3iodlpt  n ol(0trxrxmpiu1lp   nvsa( s2tr(mo;u4oeeomo3tatla2emumo;u)texomr tydlmtraivi;t)texmxm3no1lm nlnctas)arurxr ;o1apxoio3tltla umuvs ()tlerir iydfmDe uvs t0trxrio ou1am elfetas s2rr(rooo1olto f3tatlsDua(vsnu)altrxf3ia1fa eaueslt trxrir3oy4alt lfes s)sDrax oou4openmo3iad a el(vpn(0 exoircootfmDe uvo t0 2xm(mpiodam emietlt)s2uaurp;u0teeoii3tld a2el( p;(0 lenio ia1fa  lnvo (0texmim oo4omen nvs tfarrm( pnu1apx mietldla emnmo;t0tetomo tadomt ai o;( t2tmxm3iodape lncsat)a2trump;u4oetnio3tas m2ea(mo;t0 reoxoctodlmteluvils) rumim iy1omenlnvta()artmx pnt4olx mociytfs eau ont4aexomrctatlmteanvs;(0sruoim3oy1omtelicias) Dumu  ;o1oltniociasfs um( o ()aetrmo oodlptrauei t) etrxo io1amee ieilt)a2raumoot4oexnmieiad a um(mp;t4 ltoir oy1omDe nes;s  ruoirpiy4al  lfeta(fs2uau pno4texo i3iltfs emnvo;()altoif3ty1laDe ies;s0texoirpoydlme  nesat aDtmur nu0aexnmfcildlmDrlnvo;() exrifcio1fmDeaivil()sexm(r iydopt  iesl(fsrtmx pot1aptn o3tyt mDem( p (0texnifciy1opteli ol(0 rxmxr nudam nmivtatfa2uaurpno4optnmo3tatfm rluvpnt0 exnmf ia1lmD aues;s)trurxr3iy4omtelfctas sDrrxmo;u1oeenifciaslsDem(mo;()artnifctodfmteln slt)seto(mpio4oleemnes s)aDua(  ;u0tpt mieiydlm2rau onu4 rtrmf iadopD lues;s0 exrimpiy4optnmncil(f 2ua(mpoo1aptomf3iyt m2uluvs;()arerifcoy1lateai s t s2tmxmpnu4om  lnvi ( sDtmx  ou4opt mfctat mDrluvp (0trtomr3io1lpD aivi ( srurirpiy4ap  lfcs ( srrm(r ;t1altn oeiys mDelumonu)trxoircio1lmDeai ol(0 rtoxm oy4amenmietl(faruaurpnt4aeeomfciasfsDumu s;(0 reoxo3oy1op rlieo s0 ruo(o3no1lle  fcslt aDtrump;u4oeeoioeilsfs2ua( p;(0tetnifctotoaDr nvsls0tetoxo iudom nmici s)s2rm( oot4opxnmf3tydfsDrm(vs;u)aeeomrcoo1om ranvsl(0 euo(rpnydamtnlnci (f Duru  no4tetniocils a2el(vsn(0aexomr oodlmt aivil(0teur(o3nu1llen ies tfsDrm(m ot0aptomfciydfa eauvp;t)artnxfciatfmt lneslt) rto(o3io4op e ivsat)artm( pou4tptoioetldfm eau pn(0aexnif todopDrln olt  rxm(mpnu1amt lneiatfa2tr( o;u0aet  oetytfa ulnmo;() leoxf oydoatr ueo;s) 2xr(m3nodlmt lncsa(f 2uaxr ot4tptn ieilt m2uauvsnu4trermrcoy1omtrlieol( s2xrim3nodlmtn fcils)a2um(ro;o0olx iictadfsDrmums t)tlermrcoadlmDe uvo;t  exmim nu1op nlnesltf rtmx  ;u1oexo f3iatfm2rmnvp (4artoir3oo1oaD anes s)trxmxo ny1llenlivtat sDraxm nu1aetn ietltfa eanmon()altoxf3iadomDelies;(  rxr(m iu1oleelfctat)a2tmu pou0tlxomo3iysfs2ulnms;u)alerxrciy1fatranei;s0setrim iy4am e ivi ()srumu  ;u0tet ioeiltfs2rmnvs u0areoir iadoaDe ivo t trum(m3iy4oltn ietatfa2umump;u1apxn i3iyd aDulnmo;u0trxnmfctydfmte uvo;s)s2to(r3iudllenmfetlt)a2uau p;u0oleoiietad mDea(vo u4tltrxr3iadlp rlivolt0s2trxo3ny1llt lneta()a2ur(ro;u4apeo fciys aDrm(vpn()alenirciotlat livs t0 2uoxo io4am elfetat) rta( p;u4aptn iciatla ua(mo;t)texrxf iatla rlu o;( texo(o3iydlpe lnesat)aDrr(rooo0tee  i3ildfa ulu o;t4 eermo oatlpt ln olt  exrxr oo4altn nctat) rrru  oo0ope  f3tld m rm( s;t0tetoir3iadopDraivs s0trur(rpoy4llee ivs s  ruaxrp;t1aet mi3iyd s um( o u4aleoxf oydomD auvs t texrxm3oodapee ics t) 2tm(r ;t1tlt  octyslaDrmn o t0tltomfcoatop e u o t0trtrimpoy1llen nei tfsrra( pou4aptomietys s umums u4tetnmo ootomtr uvi s trxoxo ny4omtnmicta(farua( o;o1tpt  fetls mDrmn s;t4aexomfctatoa   uvil()seurxo3iu4openmncs t arurum no1oex moeiys sDrluvp;t4 eeoir3iadlmt lieil() rxm(o3nu4ale mncs tfsruaum ;t4aee  feias aDemnmpnt) rtnxociy1lmDrluvs;t t2tmio3iy1omenlneias)srumu  ;u1apto iciadfsDum(vs u0teeomrcoy1fp eanvi s  rxr(r3ny1ap  mfvt s srraxmono0tpt  ieiyt sDrlnvpnt)aetrioctatlaDrlies s  exoim iydalenmfetl(f rur(  nt4tex mo3ilsls uanmp;() rtoxo3ta1oa rlnes;( trxoxr3nu4ame lneia()sDumuroou1oeenioeild a rmnmo;(0alxomf3ty1latraiei;( sexoxo3ny4lmenmfes sf 2ua(ro;o4tleomicias m2uln s;() etrxo iodomt lieil( trxr(r3ou4lpt lfcsat)s2ua(r ;u4tetomo3iatfs2el(vs;u4aexrifciy1oa rliesl(0trxm(m ny1lptemnvs (fsDraxm no0tpe moctltlaDul(vsnt)tltrxr3iotlpt  uesl( t2xoiopio4amtelfetls sDtrxmpou4aee mietys a2rlu o;t)artoio todfmDr i i;s s2xoxm nu1ole lfetls  Dtmu pno0olenii3tlt sDumnvp;t) rxnir3ta1lp elneo s sexmirpiu1lp nmfvi ( srtmumpno4apxomoeiltfa ea(mo;() rxnmociadfptrln o;s  rumio3iodom  lnctlt)srrrx oou1tex mfeiad s2rlnmo;u0altoircoo1op e n s;( t2ur(o3oy4lp nmfvia()sDtaxmpno4tptnmieilt aDrl( onu4trtnmr3to1omt  ueslt)t2urim3iydal  lfet (  rraxr ou0apx io3iadfm2um(mpnu) ltnmoctotlmDeluvsl(0tetmim iy1om e nvtlt)arrm(  ;o4olxo icild m ra( snu4tltoxrctatoaD anvils seumxo3oudlmtemneta( sDtax  nt1opxoifctyslsDea(msnu4tltoxf3oodfa eauvs t0 rxoim iydomenlfeslsf rtrum nt1tpeoiocias s2umumon(4treoir3tydoa  aues (  2uoir oydape mnvt s)aDraurpou0aee mf3tldfa2rm(monu4arenmf3to1lmtrau olt  ruoxo3ny1amtemicsas aDra(m nu1teeoio3iltfm ulumo;t0aeeoxocoydomD  i s;t)s2tmir iudaptnmnvs t)arraxmo;o4tle  oeiltfmDrmuvpn()alerio oatlmDr i sl(  2tr(m no1ame lics sf rum(  no0tpxoiieilsls2elnmsnu4altnxocoodfmD  ieils)srtrxopoo1lp elicsa(fs2tmuront1oltnio3ilt a umnvsnu4 exrmrcoadfpte neo t)setm(o3oy4lme mnvtl(fa2raurp;o0texnmi3ilt m ra(mpnu0altoio3tydla   uvs;s0s2xo(r iodlptn fcias)aDrrxr nu0olen fetatlsDrmuvo;t0aetnif3ty1lptr n s s0seurir oo4lm n fet s)sDrm(mo;u0tle  fetld s2uauvs;() reoif3iadfaDr n sls0 rtoio3nu4lle mivtl(f Dta( oot0tex ifctad s el( o (4alxrir3tadlaD au i t0teumxr3io1omenmivil()artaumont0tpxo ietyt mDumuvs (0tlxnio3io1lmDeanvi;s trto(mpny1lp n nesat aDta( ont4aex mi3iadlm uauvp;t0 lenmo tadfptr uvolt0srurxrpio1olee ncil()srur(mpnt1tlxnmoctatlmDemn p;u4altnmo3todop e ivo t0 rxoxo oodaptnmncias)aDrmu o;u0oex mf3iadfsDulu p t) exoxrctatlpDeli o s teur(o nu4lptnmics () 2ra(  oo4aexo i3iat sDrlums () leoxr3ia1oaDr u i;t  2xoim oo1amt  nes ( a2raumpno1tlx  ociaslm2emnmp t)tetoxf oy1oat aieols) rxo(m3iodlpt  nei sf rurumoou1tle  iciatlm2umnvp ()tetnir tydfpteaieo;(0t2uoxm3nydame  fcsasfsDurx ono4tpt ii3iltfm rl( p;()aeeoxr oy1fmtr uvo;t0srtr(r3iy4apen fetl() rtm( o;t4teto oeiat mDrlnmsnu0tlenmr iy1fptraies () 2toir3nudlmtelfesa(fa2rrx p;t4aptomoctysfs2rmn pn(0 ltnmocta1lptelu i;t) etm(r3iydol e feil( sDururpou0altoiociytla ulnvs;t0trtoxf totfpDraivolt0 rtoxmpiodaleeliet s)a2raxmono1optn ociadfmDrlu s;(0alxrmf3iotlaD anes;s srum(r3nudaptnlnct t sDtm(roou4tpe  o3ilsfs eln s;u4 etoxrcta1fateau i;()texm(o iudlm e fet sfarrr(mo;t4tpen oeias a ul( o (4alxomfctotlat  neols)setrxo iu4oltnlneta( srrrumpno4opxn o3iltla emums;(4 exnxr oadfaDelueols)trxmxr no1llee fcia()artr(mpnt4ape if3tys mDelumsnt0 etrxo3tatlmDranvslt t2um(o oy1apenmfetatfaDumxmp;o1alxn ociasls ua(vp u)trxnxf3tadlaDr ivo s0trurir3nodap   fvils a2umxmoot0tptnifetytfa2eaump;()alxnxo ty1oaDr u s;( teumirpno1al  lfcta()aDtrxmpou1oex  oeilt m umuvs ()tlxnmf3ootomD  u olt0s2umxr3oo1lpeemnesltfsDrrxm ot0oeeo fetytla um(vs (0 ltomf3ta1fmDraneslt trxm(mpiy4am  lncias)a2rm(mp;u0tpxn o3ild m2rmnvp t) rtoio iytfa eaues s t2xm(r no1lmen ietltfa2ur( ono1aexnioeild aDumn p;u0tltoxo3oa1om   nei;(  2xr(r3iu1lpen ivsls s2rrumpnu1apen i3iytfsDrm(vpn()alenif oadla   uesls srtoxm3nodlmen nvi tfaDua(rpot0tee mf3iadfs elnvo;t4altoxr3oadfm ran i;t  rtr(o3io1lm e ieilt) rrrxrpnt1tetn fetydla ra(ms t)trxnxr oydlm rlu s;(  etrirpiy1lltnlict ( srrrumont4aeeomiciat s elnvo;(4altomr3ta1optrli il()teurir oudalt  fvs ()s2ua(ro;u1openmo3tldfa2ulnmonu) renxo3oatla eai s;t0trur(r ou4aleelicil()sDrmxmooo1alx  i3ildfsDrm( snt4 exriocoy1faD auei t tetrxopou4altn nei t  Dtrump;t4aeeo oeilslmDelnmonu0tltoifciadlpt aueols0trtmim3oy4omt mivsa()a2urum ;t0tptnif3tatlsDum(mo u0 rtrmfctotopD li sls0srxm(r oodam  mncils)arum(m ot1olx mi3iltfm rlumsnu0 renxo oatoa eanvol( teuo(rpiu1ame  nct s a2trx ono1opt mietlt sDrm( pnt)tleomr oy1opteau o;t setrirpiy1ale mneils)arurxroot1olen ociys s umu snt)alxnircoa1la  lnvs;(0tetr(m3ou4ap  mfcsat artaxmpoo1teenmi3iadfmDua(vs;()alxoio3iadoptranvi;s0teum(r3oudll n fvtls)artmu pou4oee  ociasfa ra(vp;() rxoifciydfmtrlnvils  2uoxo iu4apen icilt)a2raumpnt4altnmoetltla rl( p;t0texoio3iytoat  ivo s0s2xm(rpnodap   feia(f rraxrpoo4oetn i3tldlm2rmu snu0 lxrmf tatoa  au s;(0t2urir3iydllt licsat)aDurxr no4alx io3iysfs2ranvo (4aetnxr oa1fp eanesl( s2urxo io4amen iesasfsrrr(mono4oexomo3taslm ra( sn(4trxrmo iydoaDe n i (0 etoxr3oy4omt  fetl(f Dtaxm ou4oexn o3tasfa2rmu o t) etrmo3to1lpD auvs t)s2uoio3iudalte icsa(  rtaumo;o1tpe  fciltfa2eauvp;(4teermo tytlp rlnvolt)seumim3nodop elieilt)srtr(rpnt0tle iicilsfmDrauvo t4trxoir ootfmte ueo t  2xmirpnydlmtn fvtas) rtrxmo;t1aee micils s ulums t)arxnir tytop   nes s) rtoimpoodomenmivtas)aDta( pno4olx moetys a2elnvp;u)tltnif3io1fpDelieils  euo(m oo1ale mfes ()arrr( ooo0opto iciatfs ul(ms;u0texoxoctytopD luvsls  etm(r3oodopte netl()sDumuront4oet  fciadlm2emnvs;u4trerxo3oydfa eaivs (  2tmxrpnu1ol  lneia(f Drm(mooo4oexoiociyslsDumnmp (0 lermr3todlaDeli i s  eurir3iu4omt lfctlt)aDrrumpnu1altnmociysfmDraums t)tltnmociytlp   u ils t2tmxm iy4lm nmnetltf rrru pou1tex mociydfm2um(vo (4aetnxf todlmt livs ( s2trimpoy1apen nvia(f Dtaxrpnt0oexo fciatfs uluvpnt)altomrciadoaD  i ils0t2urxmpno1omte nesls)aDumxr oo0oleomiciyd aDrm( on(4trxnxr3ta1oa elu olt0truo(r oo4omte ieslsfsDtrxmpou1olxoif3iadlmDrlnmonu0tltnmo tatlmte n s;s srtr(r ny1ol nmivias)s2uax ooo4oleoii3iadlsDul(vs;u4artomfcta1lmDran il()srxmimpnudlmtemfvsatfs2raxmpot1oexn octas s uanvo t4aexnxr3oadfatelnvol( sexm(o3oy4lle  iesatfarrmuront4tex miciyd mDrlump t)altoir3oadfmD lueol() 2tmirpiu1lmtnlictasf Dtrurpot4opx  octat a umuvp t)teerxr oatlpt  nei s)texmxrpio1ape  fciasfaDrmu  nu4oltniieildls uanmpnu4trxrxf tydfpD an sl(  2tm(m3oo4olt  nvtatfa2rrxm ou0texomfeiatfa2ua(vo;t0altomrcta1la eauvi t0teumxmpny4olt  ncs s)a2rru o;o0olx io3iltfm2uln s;u)tlxnmo3ootoptrli olt)teurim ny1al   ivtl(  2rrxrpnt0opxoiociltla2eaumsnt0tetrmr to1fpDeluvo t seurxopoo1alenlnctlt)aruaxmp;t0oexnmoetaslm ea(vpn()tetrmociytoat li o t0texmimpiy1al   nvi s) Duru pou0tpx ioeiyt a umuvsnu0trermr ia1lm e i slt trtr(opno1aptelfctlsfs2ur(roou1oet  o3iyd mDel(ms u4 lxrif3iadlmt aies ()sexoxmpou4om nlnet sfa2rr(rp;o0tetoifcilsfsDean s;u4 ltrxoctatlaDrlivi;t0 2tr(rpiy1oltelncsas arraur oo4aptomi3iyslsDeln s;t)teenmo3oo1fa raivs;s0 euoir3ou4ap e iviltfa2urx p;u1openiictyslsDean s (4areriociotopt  uvsl()tetrir3no4ame mictasfsrururpot0tpe ioeiasls rmu o;(0aexnmf ootopteln s t t2tmiopno1ll nlfetatfsrra(  ;o0aeeoifetad m uauvpnt0trtnif3iydlm elnvo s0t2toxmpny1al emfetasfsDrmxrpot1tptnif3tat s ua(vp t0aetomr3oytoptr ues;(0s2um(mpoodamtnlfeslt) 2rmum ot1tpxn icildlm2um( s;()artnxr ootfpt  ueo (0srtrim oo1ll e nvs s) rta(r ;t4olen o3iatfa2umn o;u4tltrmfciodopt  u o t0 2uo(opoy4am nlicils) 2tmx p;t0aeeoii3iysls2el(mont0 renxo oydfmDrln i;( tetmimpno4om n ictls  2rrxmpno0tptoiieiytfmDua(mp ()tlerxr3oatfaD auvils seuoirpny4lp elfet sfsrtm(  ou0tptnmietltla2ea( pnt4teeoir to1la rln ols0s2tmxmpoo4openlnvsltfsrta(roou4tpe moctlslaDuaums t)teeoxf3ty1oa r uvi;t)srtrirpno1op nlfctat arrmxrpou0aleo oeiydfa rl(mo (0alerir iatlat lueslt0 2xoxmpiodlme micslsfaDur(m nt1tlx mi3iat m2uau onu4tlxoxo3oodoatr i i t)teurimpio4lpeemfei ( sDrm(monu0ale  oeiat mDrmuvsn()teeomrctadla e uesls  euo(r oudaltelneiasfa2ta(ro;o4olx mociltlm elumo;() rxnifcto1fptrluvi t0 rtr(o3oo4op   ictlt srra(moot4tpxn fcilt a rlu o;(0arerxo3iatlaDelueo;t0texoiopnydlm emieiltf Dururp;t1oexomieiltfm2rl( onu0tltoxo3oydoat  ueol( s2umxo io1ome mivslt)aDuru ooo4opxn f3tltfm ra( p;t4trxrxo oy1optr nes;t) 2xoxopnodlmtelnetls arur(rpnu0tlxn fctysfa emump u4aleomr3oa1lpDeaivs t)seuoxm nudoleelfetas)artm(moot0teenmf3tyd s rm( sn()teenmrcoytlpteanvo ( tetoimpoydol  mnviat)s2ra(mp;o4oetnmfetlslm2ulumsn()trxoxfctadla ranvol(0t2xo(o iu1al   ict t s2tau pnu0oeenmo3tldlm umuvo u)tltomf3oo1fp r ivs s0 exoir3oy1apteliei tfaDuau oot4ape moeildlmDrmn s ()trermo to1lmtr i i;( t2umxr io1op n feslt)s2rrur ;u1olt ifetlt sDulumpnt)teeoxr iotlaDe i o;s0texm(r iudll  mfesls) 2uaxmpnt4apenifciatlmDuln o ()trtrmfctadfm elivi;t)trtr(r oydal e nvias sDumum nu0oexomietyt s emuvsnu4tltnmr3iodlmDrlu o;(0teum(m3iy4ameemnei ( arrmumo;u4tpxomiciasfs rm(mo t4texrio3oatfm e i s;( trtoxo ny1ap emfcslt  2taxr ou0ale  fetls a2el(ms;(4 rermr3oodfa rai o t  rum(m iu1lmeemfvtas artru pot1aexoifcildla2rl(ms u4arenxo oo1fa r ues;s)setrio iu4lpe mfeta(fa2uru ont4opxoifetlslmDemnmpnt)trxoxf3iatla   uvs ()srxoxr3oodlptelict s arra(rpoo1tex iietatfs ulums;t)treoif iatfaD  n sl( seurim ou1al nlivta()sDrrx pno4altomoeias m2ra(ms;u0trxnifcia1fmD lues t0srumxm nodome livt t) Duaumpoo0olt  feiysls eaump t) eenif iatlp rauvslt tetm(r3oodlptn ictl( aDraum no1tet ioetlsfm ul(mon(0 exrmf3iytfptelu s;s) eumxrpiy1alenmfviatfaDur(r no1oee  fciysfm rlums (4alxnxfcoatfpDrlies;(0trurxm3iy1lpenmnet s)a2uaxmont1tlt mi3tyd aDum(vpnu4 rerxf3iytfmt  u sls0 rxoxr oo1lme lneiat)aDum(mpnt0apeomfeiadla ua( o t) leoxociy1lp ean i s t2trxopn
\ No newline at end of file
@@ -0,0 +1 @@
+uvo;(0 euoxrpny4lpen nvtas)srurx  ;o0tltoif3iyslsDulnmsnu4teerxf oadlmtr ies;s0 2umxm3nydal eliesls)s2tru  ot4alenmiciyslm2ran sn()aeenxrcio1lm eau ils  rxoim oy1am  mfetl()aDur( p;o0oltn iciadfs2umnvo (0alenxrcoydomD an i s setmir ny1al   fcsltfarrax o;t1tptomicilt aDrlnmsnt0trtnirctadlp   n sls0t2xr(r nu1omtemfeta()s2trxronu4olx mfctltfm emu p;u)aetnmf3oa1opDe ueo;t0 2trio3ou1lpt mnvsa( aDtrxmo;t4oexn fciasls rlums u)aeeoio3tytomte neo;t teumxo3nu1lme lnesa(f rrmurpnt4oetnmoetas a2eluvs t)tltrxfctytlmt au ils)trtmxrpoy1lp e fcsas  rurxmp;o0altnmfciadfaDran o t4aexoifcoodla eau s ( trxm(opnu4optn icsl(faDumu pnt0oexoifciatfm rlu o;()aetrxrcoa1fmtr nvils trto(rpio4ame  nvta() rur(mp;o0tlxoio3iat aDelnmo t4tlxnxo oatoptrluvo;t)s2ur(opnodlmt lnciat)sDururpnu1aeto feiat a2ean pnu0 ltnir3ia1lm e i i t sexmirpoy4lm nlfetat  2taur nt0tpenio3iadlaDrln p;u4texnif tydlateln sl() rxmiopiu4oltn fct s  Dra( pou4apenifctytls2el( p t0 rtrifciotfa   n i (0seuoio3oudlmt mfeias)s2umx pnu4aleoifciytlm2el(mo;u0aeermrcootfp rau o;t) etm(m3oo4apenmfetl() 2tr(r no0tpe  fetatfa2rau sn(0 rxnmrcta1om   nvi s0 ruoir nu1aptnmiet t) Dtrxmoou0optomf3tlsfa2umn pnu4 lxrir3iytlptrlnei;(  rtr(m oo4ape lnes ()a2ur(rpot4apenioeiysfs2rau pn(4trxrmf3ta1lat aivi;()srxrir oydaltemfetlt)sDtrx poo4alxoiieiadls umnvonu)tlerioctytfm rlneils0 exmim3nodll  lnesa( aruauronu4opx ifciytlm2ul(vont4arxnmfctydoatrluvils seurirpno1lptnmfei t arrm(mo;t0tpt iocils m2rl(msnu)arenxoctytomteau ils) rtmir3oydlpe  fvilt s2uau pnu0texomf3tatfm umn o t0aeeomo3iotoaD ai ols  2ur(rpnydoptelfvtlsfa2urur ou1aleomietatfm2umuvo (0teenxf3tatlp  luei;() etmir ou1ale lfci ( artmxmpou0aexo ieiys s2rm(vsnt4 exnmo oytfptraivo (0t2trxmpnu1al emfeta()a2rrxrpou0tleo i3ildfa ua(ms u0arxrmrcoatom eliei (0 2um(r3oy1lmtnlfvias srtm(rp;t0ole if3iytls2rm(mp t0 exrmr oatoatr uvo t) eumim3ou1apt mfcils) Dtrumoot0open ieiytfsDraumsnu0 ltomr to1lp   neol( texm(o oudlle  fcsls s2urum ;u4tptn ictatfs ean snt4trxnxr oydomDr ies t0 rxrio3ou1altnlictat)srururp;o1aptniocilt aDrmuvpn(4trtoio3iodoa   uvi;t  rtm(r3ou4lm  mnesl(fa2rr(  oo1opxnmi3ilt a ul( on(0 rtoif ia1opt  ieilt s2xo(rpoudamee fcta(fsDta( pno1ole  ociad s2rmumpnt4teeoxr3tytfateaneo;(0t2xoim3ny4amtelfcia(faDtmumpoo4optnifciasls ulnmp;u)aetnmr3oa1fmtrauvils0 eur(rpiu4op elicilt srtmxr ;t1aeen ocildfmDuanms;t)altoxf3todlmtrlu s s) 2xo(rpio4ol   ncsls  Durx o;u0tlxnii3iasfmDumnmsnt4aeeoxrcoodlpDranvi;(0t2tmir3iu4ap  lneias)s2uaxrp;u1aexnii3tasfaDrmn o t0texrxr3oytlmteln sls  2xmim oo4lleelicsatfaDra(ro;o0oetn ociadlsDul(mpnu0 etrir3tytomD  ieslt) rur(r3nu1lptemieslsfsDuaur ;o4aexoifciatfsDrlnms;() lerir3oy1oaD aivsls s2ur(rpio1olt lfvta()sDur(ro;o4oeenmiciltla2umnmonu)trxnir ty1fpt  nvi t0texmirpnu4aptnmnetas) Dua(r no0opx  o3ias s ulnvont)treoirctatoat aneslt teum(o3oydomenlieta()s2uaum oo0aleo fciytlsDrmuvont0 lxrxociytfa rlues;t)srurxr3oy4ol e nvils aDtrx o;u4optnmfetatls2ulums;u)teenxf oo1om  auvolt)texoxrpiodlltnlieta(f rtr(ro;u4olxniiciytfs rmuvs;() rxomo tydfp rlneilt) rtm(mpny4lmt lictltfsrurxr nu0apxniictld sDelnmpnu0trtrir ty1oaD  uvs;(0srumxo oo4amtelivsat a2ra(root4tptoifctydlm umu snt0artoxo todfaDelueol(0 exmir no1oltnlivt ( s2rr(rpnu0texnioctyd s ra( snu)tleoio3tadoate iei;t)s2xmio3oydomtnlnvias sruaxm ot0tex micild aDumnmo;u0artoxf3tytopt an i;s0 rumirpny1lp nmnvtasfaDtau  ;o1apxoioctysfs el(mp;t4texniocoo1oa   nei ( teurirpou4omeemfeias s2rmxm nt4altomo3iat s um(vp ()texoio3iotlp  an s;s0 eurio oo4amt  nei sf 2rmumpoo4oexnmieiytfa elumpn()tlxrmo3iydop   neo t) 2ur(rpiodlm nmnci s  rtm(rpno4aeenif3tls aDumump;()texrmo oytfp r n ols0 exmir ou1ol n fcilt srur(mp;u4olt miciytfsDran p u4 exrio3tadoaD aneolt)srxoio3oy1openmfet t a2rm(ronu1opxomicils mDemumsnu0 eenxr tydlp eauvol( trtmxr3iydolt  fctl(faDraxr ;t4tlxnmocilsla2elnvs u4trtnxocootfmDrlnei;t0 rtr(m3nu4llee ncsatfsDumumo;u4tptoiictls aDrmnmont4artnifcoadomDe nvil() eurxr iu4lm  mfvtlt a2ra(moot4aleniociytfm ea(mo;u0tetrxrciodlmt ai o;t)t2xr(o nodalt  fvs ( arraxmpnt0oeto octadfs rln s;u0 ltnmrciytom   ivo s)trtrim3iodlp   ivt (  rum(mpou0olx mo3tasls el(vpnt)aexnmo3tydoaDelueils0texmxr ou4omeemnvsatfsDuaxr ;t0tpxoiociatfs rmu o;(4 ltnio todoaD  nvo;t0tetmxm ny1alee icsls  Drr(mpnu1oltomo3ildlm2umuvo (4tlenio3oo1fa r u sls) exr(m3ny4lm  mnvt s) 2tau ooo1tle mfetatls umumsnt0 ltomrciytfm   neo;t0srumir iy1lmt lfct s)aDtau ooo1apeniiciydfsDeanmsn(0 rxrxf oa1lmDe i ol(0 exrio3no1ameemfetlt sDra(rpnu0tpxn fciat m ran o (4trtnif3oodlmD  i il(  rxoxmpnu1op   fctat)arumum ;o1open oeiydla2elumo t0trxrxf iy1fateln o (0 2xrxr no1llen fviat)srraxm ;o0teenioctadfa2uau p;u0alxoiociy1lm  au s;s) rtrxr3nydlltnlfctlt) 2tr(  ou1aet ioeilt aDua(vo;u0aetrmf3iy1laD lu s;(0 etoxm no1ap n nvt sfaDraxrpot4ole mo3iydlm2ra(mp t)tetomfcoo1faDrlnes ()sexrir iu4lp elfci t)sDtrxmo;t0tpeniociyt sDuau pnt0teeomfctydlmtrau ols0s2tmio3iu1lptnlnetat)artr(mo;u1aexo iciys a2ranmon(0trtnxo3iytfp ranvi t0setrir nodaptnlnvt ()sDum(  ou1opt iiciatla2rlnvo;t4aexomf3iytla   nes t sruo(o3iy1al n feil(fs2rrx poo0tetnmoeiydlsDel( ont) eenmo totlpDrln ol(0 rumxm oydal emiei (fsDua(m ;u1tpeo i3tat m elu p;u)altoxf oytfmtrluvol(0 rumir3nodaltelietas  Drmxmont1alenmieiaslsDrlnmp;u) rxomocoodopDeaies;s0teurio nodameemnct ()sDra(root4oet if3taslm2rm(vonu4tlxnxr3oydlm e nvi s srxo(m3oo4oltnlnetls) Dum(m nu0opeoifctys a2ra( pnt0 rxrio3tatfpD  n i;t  2ur(o ou1apeelnvtltfa2taxmpnt1tpe micias s um(vs;t) ltnio oydopDr ueo ( s2uo(o3ny1am e neta( a2rr(mpoo4aee mo3iytfm rm(mont4texomrcio1oa ranvils0 rtmxopiudlp emies sfa2ra(mpoo1oltoioctltls2umnmo;u4 exrxo iadoa ran o (0sruoir io1lp  lfvsat) rrrumoot1oeenmieiatlm2rm( pnu)altrir totopteaiei t0s2ur(o3nydale mfctasf rrruro;t4ale  ocildlm2rmu o u) etrirciodop e ies t0 euo(o no1ol n ivils sDtm(mp;o0apeo oeiys sDumuvpn(0tlxrxf3tytlpD auvslt) 2xr(m oy4ol emnciatfarrmuroot1aeeo ociadfm2eau p u0tlxrifcoydla ranes;()t2uoio3ou4lp   ncs sf 2raum ot4olx  feiad s2uan sn(4tetomf3oadoptr uvo;() exoirpio4lpt mfvtat)a2rmxrooo4alx ifctydlmDrlnmo t4aetoir3tydfp eaies t0 eumxr iu1open ncta()aDrmu pno1oltnifciadfa2ra(vonu4trxnmrciydlpt ai il(0seum(m3io4ope mncil(  Duaxr nt4aex mfcias aDuauvo;(0texnif ootlpt lu s s)srtrxm iu4ameeliviltfsrraxrono1texomiciyslmDumu p t4 exrxrcoatomD an o ( setm(o3io4op elict (f rrmxmpno0tpx iieiyt a rmumo;(4 lxrmf3ia1fmtelneolt0s2trimpiu4apt  iciltfsruaxmoou4oetnmf3ias aDel(mo t)tetomf3todopte ieo;(0 2tm(r3nodape  ncsas)arumx o;u4teeoif3iatla2eln s;t0aetnirciy1fat aivs t s2uoirpnu1llte net tfa2umxmp;o4optn ocild aDran o t0alxnmo iy1fmDe uvo t trurio3oy1op elicsltfsDumx pnu4aee  i3ild s em(ms u4 rerxr3iotopt luvs t sexr(r3iodam nlnvtls) rumxm ;o1oetoiictysfs2uaums (0tlermrctadfpDrau i;( t2umio iudole  iet s  Durx ont4optoiicilslaDuau o;t4tlxnmr oy1lp  aieils t2umirpno4lpeemfvslsfs2rau poo1aexo oeiys mDrl( s (0 lxrmo tatfpt  i i s t2uo(r nodom elfvtat s2tau pnu4opxomo3iysls2umnmo;t) lxrifcoy1fa  anvils0 rtoirpnydlmt lieil()srumumpno0olxomo3iat m2rlums;u4 rtomo iotom  luvol(0texoim3nu4lpt livil(fs2rm( o;t4apt  fetlslm2ul(vs t0aexnxfciy1lm elu s t0 etoxm iu1alee fvta(f Dtrxmooo0altoio3ilslm emu s;t4 etoxfctatom r n il( s2xoim3oodopen fetls)s2rrx p;t4tpen ictasfmDuln o;u)tltomr3iatoatr ieo;s)tetoxm3nydlmenlies (f 2ra(monu4olenii3tatla2elump;(4alxrxo3iy1lmDr nvilt  rxmxr no1al  mfvsas s2trurpnt4opxomoeilsla2rm(ms (4aetnxr3to1op elnvo;s0trtmir nydale  icias)srum( ont4aee  ociatfmDrl(mpn(0aetnmrcoodop  luvil(0s2trxo iudaleelfvsasfsrrax pno4olxo f3tld mDra(msn() rxnmocoa1oa eau sl( t2xrxrpiodam elnvt ()aDtm(mo;o0aleomf3ilsfaDemu p;t0texnxoctodfpDelneolt0 2tmxm nodale lfet t) 2ur(r ot4aetniicils s2umnvs t0 exrxrciy1lpteli s s0tetoxm io4ll emfci s)arrmxrpoo1ape iicilsfs2ua( on(4arxomr3tadlpt anvslt0t2xo(mpnudapeemnet s sDur(r ;o4oet io3ils a2umn p u0tlxrmf tydfa rai i;s0 eumirpnudapen nvsl(fsDua(  ou0opeomoctas sDel( s t4 lenif iatoa r nvslt0setmxm iy4omeelics t) Dtau o;t1ale mf3tasls rmnmp (0trxrmrctodfa   nesls  2trxopoo4ame  ieils)arrmu poo1apxomi3ildlm umuvo;t4artoifctytlmtrlnvs;() 2toio3oydoleelivt t aDrm(rp;t0optnii3iyd m2rmnms (0aeerir oadfmDelueslt0srum(opio1ale mnctl(f rumu  ot0alxn oeiasls2eau pn()texoxocoytoa rluvo;t) 2uoimpiy4aptn nci t)sDrmx  oo1tex mo3tldla uluvsn(4aexnxocootop r ivs;t) rxmim3nu1amte nei t)srta(  nt4opxo i3iatfs2em(von()aeeomfcoo1fmDelieo;(0srxoir ny4om elfvta(fsDuaum ou0aetnmf3tltfs2el(mpnt4aexoxfciotlaDeluei (0srxr(rpoy4apenlfviatfs2ta(rpnu1tlx io3ias mDulumon(4texnxf ta1fpDeln s s0 ruoxo3ny1open icilsfs2rm(mo;o0tex mf3ild a rmn o t4 eeoxfciatoa r nvs t trtoim nudlm n ict tfs2rm( onu4tet ifcils a emnvsnt0arxoxr3ia1lmDeaieol(0 2xmxm iy1ape  ivs tfs2umuronu1aex ifeildlm rmn pn(0alxrxfciy1lm r n ols t2xr(o3oy1omenmivtat sDtm(r nt1aex mictysls eanvo u0 rxnxo3oo1faD lueo ()t2xo(mpio4omtemfvta( artmur ou1olt  i3ias s ranmpnt) etnmr oatfpD aivi s tetrimpio1olee nvtls)aDum(rpot4tet ii3tysls emnmont) lxrmr tytfa e nvol( tetm(o3iu1lm nliet tfarraum nu1aetoifeiasla el(vsnt0trtnir3ty1lp rlueilt  exmxopoodoltelicsl(f rrmum oo4aetniieiltla2rlums (4 leomrciadoaDranei;s0trxm(rpno1am  mnct s) Drmumpou0opt ioeiadfs2umnmp;u4 exnxfciodfm  lneo t) 2to(o nodalenlncsl(  rra(ro;u0openmfeiasls um( o t) lerir3oadfp eaneol()srxmio nu1al n neilt  Dtrump;o1oeen ieiad s emu pnt0tetriocootlat liesl( texrim3iy4lltn ivia(f Dumx oou0tlenmieiaslm ea(vs u)trtrif3oatop e uvi;s) rto(mpiodapeemivi ( sDta( pot1oltnmfctlt aDuanms;u0 eenmo iy1oa  livi ( trxrxm oo4lp nlfvtlsfsrrr( ont1oexn ieiatlm2ulnvp t0teeniociatomt  nvsls  etmxr3nydop n ies ( sDtm(  ou0oleoifeiydfm ua( ont0trxoxr oydfp   u i;()t2xm(r iy4amt lfvi (f ruau o;t0ape  oetytls emumo (4aexoxfcoytoaD lneols seto(opou1al emfct s  Dtrx oou4ole mfeiltfm2ulums;() lxomo oytfateaueo;t0setrir3oy1lm n fvi ()arumurp;o0oleomfctasfsDeauvp () eenir3to1fpte nesls0 2xoxr io4ol   ivt tf 2taurpou1opeomoctlsfs uanmo () rxoxr to1fa   uvilt)t2xm(mpnu1lmen icsl()a2trum ;t1aeeomietld s2em(mpn(0 etnxf iydlatr u s s)t2toirpiydam  lfciltf Dtm(mp;o1tet if3iysfaDumums;u)alxrmf3oa1opDran sls0texoio3ny1llen ivtat)sDua(  no4tpen ociadfmDemuvs;(4 lxoxfcty1lp  anvsls)t2uo(opiydol   ivt s sDrru  nt0tlt ifctlsfa elnvont0artoir3iodlpD auesls0s2xmxo3iu1lptn ivt t)aDtaum ou1tpxniietatlm rm(mp (4trenif tatomD  ivols srxrxr oo1ll nlfcia() 2uau oot4oexomo3taslmDumnvo u0artrxrcoadlpDeaivil()srtr(r3ou4op   ietlt)sDrrump;u0oltnmo3iyd aDuan onu4 ltnxo iy1faDrlueils trtoxo3ou4alenlfcilsfs2ta(mpnu0aex mo3iydfaDeln ont4arxnxr3iy1op  lu i;(0setrir3oudolte fet ( aDua(mp;u4tex miciysfm emuvo t4arxomf3ia1latrluei ( texrxr3ou1omtelivsa(f 2um(m ;t4tpxo ieils s uanvsnu4tltoxocoy1la elieolt sexoxmpnu1alenlicsls)s2trxmpou4ope  fetltla2eau p u0teeomr3oadlaD livo;( tetrxo oy4amte fci s) Drau p;t1oexoioetltlsDum(ms;t0 renmrcoo1faDeli o;t0 rtr(m3oo4omenlfesat a2ra(rpnu4oltnii3iltls ran ont4tleomf io1omD  n il( srxm(r3ny4ape lictls a2rmumpot4texn i3ias a el(ms t) ltrxo tadoaD aueols0 exrxm nu1ll   ivtls) 2tmxr nu4tpen oeiys a2ranmon()aeerircto1lptrli i t t2um(r3nu1ape lfci t  2rmx ooo0aleo o3iat a eanvp () rermfciytlm  lieil() eumio3oo1lp nmiei tfaDurur oo0aee mf3tlslmDeau s () rtoxr tydoat lnes;t) euo(r3nodam nmfcsas)s2ta(  ;t0tlt ifeils s2umu pn(0 ltnxo3totfaDelneo;()s2um(r oy4al   ivt s)srtm(  ;o0oetn iciasla2em( sn() lxoxo todomteaivs s) rtoio iy1altn fesat  2rau p;t4olt  ictyslaDul( o u4alxrmocoy1lmDeauvi;s  eto(rpou1ll elivtl()sDuaxroou0aee iociydlmDemnmo t0 ltrmf3oodoatean olt setrio3io4ol nmivslt arrm(mooo1aeen f3iysls ran o (4tetrif tadomtelnei;s0teumxo3oo1apee iesl()arum(ronu0olxnmo3iyslm rm(mp t0tleomr3totfmt lu s t)t2trxmpno1lpe  neiltfsDua(moot0olxo f3tas m2umnmo ()aetrio oa1lmDr i i s)setoimpoy4ol e nct (fs2ur(  nu4optoifctlt s elnmo u) rtniocoodlmD  ivo;t0 eurim3iydolee nviat)arrmxroot1tlt mi3iadlaDel( p () rxrmfcoytlate ueilt0t2uoxo oy4ap elfei s aDrm(r ot0aex ii3ildlm2rauvo;(4aetrxrctytlm e u s t) 2xr(m ou4am nlnes () Draump;o1aetomoeiytlaDumu snt)artnxr3iytoatrlivi ( tetrxm3iu4lm n icia(faDrrurpnu1oleomiciaslm2um( o;(4aeeoxf oa1oaDraies t  rxrxo nydamt  fcias)s2trx  ;u0tlx  feilsfa uanvp;(0tlerir iadlptelies;s0 2tr(o3iy1lm nmfeslsfaDrr(mpnt0tet iiciadfaDrln on(0alxnifcoadfp e ivo;s0 2tmxm3nu1ol   iesl() 2urxm oo1texn icilt a ulnmp;u0altnirciadomt liesls) euoio3nudape lfcta(  2ua(r ou4tlt iieiytfaDumums t4tlerxo3oatlateauei;t srxoxrpiy1op nmnci sfaruax  nu0apeo fctys a rm(msnu) eeoxo3iodfat  neo t)setmxo3oudamtnmncta(fsruax  nu1olxnioeils m2emums;(0altrmf3oo1fmt  ies;( tetm(rpio1ol elnct (  rraurp;t0teenii3iltfmDulumsn()trxrxf3oadfmt  nvi;t0srtoxopoodlpt  fei sfarrrxmpot0altnmo3tytfs2rm(vsn()tlenxr3oydfaDr nvs;(0srtrir3oy4llee icslt) rrax  ;u1tex  o3ilsla2el( o u4 rerxf3iy1om rau slt) eto(m oo4lmt lies s) rtm( onu4tleomo3iat mDumn o;(4 exnmfciatlm e ieil()srxr(o3ny4lleemnctatfartm(r ;t1ale mociydfm2uanvo;t)arxomocta1omtrluvol(0 2trirpny1lp n nct s  Dtm(  nt4oeto ietldla rl(mp u0 exnmr3oydoateliei s0texm(m iu1ape mnctl(fsrtmxmpnt0aee  fciytlmDeln pn(0arermo oy1oat an o ()t2uo(r iu1oleeliet tf Dumxrpot4oee  oeiydfa2rlnmp;u4tltnmf3ootlp elnvslt) rur(rpoodlpeelfvtat s2rm(mpot0tee mictlsfm elnvpn(4tlxoxo3iy1omDraneol()teuo(r3ou1oltnmfeiasfs2trum ot4apen fciasfa emu s;u4 eeoio3iotomD  n i;s0 2xm(opio1lmt lnvs tfsrtm(ro;u0aptnmieiad s2ua(vs (0artnxr3oy1la e nvs () exrxr3iodamtnliviltfa2urum no4apeomietat sDuln s;u4areoio totop  lieo (0tetr(m3iodlmee nesa()artaumo;u1oexoii3tydfa rm(von(4trtrmr3ia1lateai s;s trxoxm oudome mfeta( sDuaumonu0tpxn f3iadfaDeanms t) eenir3tydlm  lues;() exm(m oo4olenlnvtls)aDrrx  ot4tlt mf3ilsfm ulu o;u4aexnmf oa1lpDeauvo ( srum(opoy4ole  netas arumxm oo1opt mf3tyt a2eanmo (4trtnmf3ty1fp eln o;s s2to(rpoudopen ieils  2ta(r nu4oeenmfcilt mDra(mo ()trenxocoatomD  uei;(0teuoiopio1opeelfcs () rra(m no1teeoioetlsfa rl(vp ()altnmf3oytop elu olt texmiopoo4lpt  fvia(faDraumo;o0olt  fctyslm2umump;t)tetrmrciydfpDrlieilt  exrim3oydolee icsasf rurumo;t4olx  octadfsDum(mp;(0tlenif3tytfmDeln s ( t2trir nudolt  fesltf Duaumonu0ale mfciytlsDuan o (0texomrcta1fa  livs ( sexrir oo4llenlfvtltf Dumurono0tltnmoeils s2ea(mpnt)trxnxr3tydfp r uvslt0 2toim ny1opt mfvtlsfs2tmu pot4alenii3ilsls2eauvp u4alenxfctotlp  aieo t)t2um(o oudopte nvs t)artmur no4tlt moeildfs rauvs;t4tetnmo3iadfmD li o;s0teuoxopiudalee fvsl(faDumxronu4aeeomfetyslmDua( o;u0 lxoxrciatfpD aues;()t2xoxm3nu4op elfei tf rrm(rpno0oexn ieilt m2ulu o u0trxoxr ta1faDrlnesls0 rurim iy4lptemfcsl()a2rmxrono0apenmfctatfsDemuvs ()altnmfcoydoatr n ils0t2xmio3no1ope licilsfa2rrxrooo4texnii3iytlm um( p (4 rtomo3ia1omDe ivsls  2xrir3oodoltelfet ( arraxrp;t1tlt iietatla2rm(vs;t)artomo io1lmtr nei t)trxrxo3no1ol  lfeiltfsDrmx pnu0oetniictas mDrlnvsnt4alxrmocoydfmt li sl(0sexoxm3oy1ap n nvsl()s2ra(r oo1optnioeiysfa rmnvo;u4 leoir iodfmDeaivo s)sexr(o oudomtnmivtltfa2urxmpou1aetoioeiytlaDulums;t) ltomr totlateliei;t truoim3oo1amtnmfcs tfs2ur(r nt0aptomo3tasla2emuvp;u) ltrmr iydfptrlnvi t)srxm(o3nu4ole livi s s2taum no1oltn fetat m2eanvs;()arxnir3oydom raivols texmxo ny4ol n nvtat)aDrr( ono0tetnmf3ils a emnmonu4 exomfciotlp  ln sls0t2tmxo3iy4open fvs () 2ra(mooo0oexo fciydlm2ulu on(0aleoir3to1optelnvsl( s2trim3oodal e ictl(fa2trxmonu0tpxnmi3iltlaDrlu p t0 ltomo3oa1la r ivo;(  2umiopou4opeemfctlsfsrrm( o;t1alxn fciydfa2rau p () etrio iytfm  anei;( teurio3oy4apte ivilt a2rmu  ;t0olen feiys s2umu s u4trtnxrciatomDe ivsls  2to(o ny1op emici t)aDtrump;u1tlxo iciad s2um(vsn()arerifciodoaD livs;()teto(m oy4om  lfetl(farrr(r oo1opto f3iyd sDrmuvs t) renio tadlpD li s t)trtoio ny1lltemivsl()a2rmu  no1tpxoio3ias mDum( ont0aetrmocootoa r uvi ( teurio3iodaleelfvtat srumx o;u0tlxnmieilslaDuaums t0altoxfcio1om rauvo t seto(rpoo1ll  lict s  2tmumont0teen oeiadfmDrmnvs u)tlermo tatfa elies ( tetmim nu1ll  mfci ()artmu p;u0tee  i3iytlaDemuvp t)arxnioctadoaD  uei t) ruoir nydolen fvs tf rtrxm ;o4tpen ociytls2um(msnt)artoircio1omDelnvils  exrimpoy1ol  mfeiat  2rrxr ;u4alenmi3iysla uanmp t)tltrxrcoy1fm e nvo s)trumio oo1lp   iet ()arta(  nt0oet  f3iadfaDel(msnt4 lxnif3tatfm  lu s ()sruoir3ny4oltnmnvi t  Dumx  no0alxnmociysls rmums;t) eenxo io1lmDe uvo s  exrir io4ll nmicsasfa2rm(m ;u1aeenmf3tydlaDuauvsn()aexrxr3tadfm rau il(  2xmxr3ou1lmt  net t) Duaxmooo4tetoifeiytlm eauvs u0aetnif oa1oa  ai sls) 2tmxo ou1ll e fcs s  Dtaum ;u4ape if3ias sDrmnmp;t0texnir oadoaDelueils)t2xoio nudap elnctas aDumum no0opt ifeiad mDrl(vp t4teeoxr3tydlpt  neo;()trxoxm3iodlm emnei (fartr( pnt1tpx  ieiltfa2eln p t4 exrir3oatfmtrluei t0s2trxr3oo4amte fcta() Dtaxmpoo0opt  iciyd aDemump;u)arenmfctodfmD auvs;s seum(m ny1oleemncsa(faDtmxm oo4oeenmfetydlm rlnvo u) renmfcoadoateli s;s sexm(rpio1ale  ieiasfaDtaxm ;u0ape miciltls2ulnmp u0 rxrir iodfpD liei;s)t2tmxm ou4lp emfvslt srurumono4tlxnio3tysfsDuau s t)alxnmf3oo1fpDelieil(0 eumxm3ou4amee ivt s)sDta(r ;t1tpeomoetadlm ua(mpnt4arxrifcoydopD au i s0sruoxr3nu1ameemfeta(farrau pou1aeenmictldfs2rl( on() renio tytlmte i s t)s2xmxo3nydope  ivsat) 2urx pno4tpxomoeiltlsDel(vs u0aeerxr3iytfat lnes;s0seumirpny1amte fei t) Dtr( p;o0oetnio3iys sDuaumsn()tltrxr3iotop  lnes;s0srxoxr3nodaptnlivtlt)s2tmur oo4aptnmfetadfa rm(vonu)treomf iotfat liei;(0 2tm(m3nudlmenlnvsltfs2raxr ou0aptnio3tyt sDum(vs;u) etomo3ta1fp rliei;t  etm(r3oo4ape  nvsls aruru  oo0tpt mfcilsfs rau s;t0teeomf oa1lmDelies;(0 exm(mpoydlm emnet t sDtrxr ;u4tetnif3tatfsDua( o u4alxnxr3iydlmDranes ()srumio ny1ope livtas a2tmx p;u0ape mocilsfm2el( o (0teerio3iadlaD aneo (0 rtoiopny1op n icil() 2urxr ou1opeomf3iydls2ran s ()artnio iytlm  livi;s s2ur(o3oydlmtelnci s artmxroou1tetnifciys s rmnvs t0teenir3oydoa  au slt  rxoxm3oydlmenlfetltfsDtau ono0apen fetas m el(vs;t) etoxf3iatomD auei t)t2trxm3iy1ll  lfet (fs2rr(m ;t1optn o3iysfa2raums t4 exoxr io1lat an ol() etoxo no1alt lietls)s2rmumo;o4aetn feiyt s2eln p t)tltnxr3oydfa eanvo t sexrir3oodale lneiatfaDrm(rp;u4oexoiieiat aDemn s u) eerio iy1op  ai i;(0tetoio oo4lm emivsl(f 2rr(mp;o4olxnmfcild aDemump;() eenxf oatlmt aiei t)t2trxm nu1ll  mnctas aruaumpnu0tpt  ietlsfs2um(mo t)tetnif3totfm rai s t)trtmiopio1opte fcs t aDtm(m ot4tle micilsla rl(vont)aetomf iatla rln ilt  etoxm3oo4opt lfvt ( arrrx oot0tlxoif3iydlsDuan p;t4trxnxr iy1fateauvil() rurxr nu4al n fvtatfsrtaur nu4aeeo octasfm ulu onu)arxrmfciotfa  aieil()sexr(mpoy1lpt  fcil() 2tm(mp;u0tpx mi3tytfs2raumo (0tltnir3tytfpt  neils)teuoxopio1ol emfvtlt)aDtr( o;u0apx mietlt m emnmpn(4 etoir3iytlptr u i t trumxr3ou4am  mnvtlsfsrtr(ro;o1oex mictltfa eau p (4tltnio iydoatrlivolt)teto(rpiu1opeemfcs ()s2rru  ;o1aeenioeiytla ua(ms;()tltnirciadlpDe iesl(0srumiopny1om n iet () rtaurpno4aee ii3iyslaDrln o u0 lenmr iotlatrln il(0 exrio oo4am n ncslt  Drau o;t0ale  ociasla rl(mp;(4arxnxo3iadla elivo t0teuoir oy4op nmfet ()srtrx pno1aetn iciyt a elu p;u0aeeomo3iy1omteli slt)trurio3iy4amte ictasf 2rmx  oo0opxnmocildfaDean p (0 exrxocoy1fp ranei (0 rxrxr3io4ap nlnct ( aDra(r no1olt  feiaslsDem( o (4tlxomo3oadfat  n ols  rxmxmpoydlm  mict t)aDra(m ou0oet mfciat m2rl(vp u4alxnxo oa1lmDran i s) 2trim3iy1omt  fcsl( a2ua(mpot1oee iieiltlaDumnvont)teerxr3iytfatrlivo;( trumxr3iudolenlicsas  2rrxmono0oltnmoctasla elu sn(4 exrxfcoytomDraues;t0 2xr(r3oy4lpe miei t)aDraxroou1aeeniociyt s um(mo u0teeoiocoytlatrlies;t0tetoxm3ny4omtnmietlsf rta( ono4apeo o3tatlsDrlnmsn() exnxrcto1lpte i sl(  rtr(o3ou1op  lnesl(f 2rm( p;o4aeeo oetlt sDumn s;u0 lenir3iodoaDeli o;t0seuoim iudolen fci t  2ua(ronu4aeto fcilsfa2uau o;(4 ltomo to1laDr i i;t0s2tr(m3oy4alt livt (f Dtmx pot0apt  feiat a ra( o;u0 etrxrcio1fpDraneslt srto(o3oo1am  lietls)srrrum ;u4tlxomf3tlslm elu onu) lxoxrcoa1lpD  iei (  etoio3iy4ap e nvtas)s2rru p;u4alxoii3ias s2uauvont4 rerir3oadlaDr u olt0 2urxo3no1lpte nctat a2rmu o;u0tlxnmiciytlmDea( o;() lxnmf3oa1opteliei;s) exmir nydlp nlnctas)s2trxm ou4aptomociatfaDelu o;(0 rtoxo3oytoa r ies;()trtmirpno4amt mfct s  rrmurpou0aeenifctat sDeau p;() rerxr3iotlptr n ilt0teur(r3iy4ol elivs s  Dra(mpno1oeeo ictad mDuan p (4aetoxr3oadlaDelnvsls s2um(mpoy4oltn ivia( sruru ont0teto f3iyd a ranms t4aleomrciytopDeaneils) 2trio no4ll  lnctls) 2umxro;o0opxnmf3ias aDem(vp;() eermr3iydomtrlueils)sruoxo3iodlpee iet t arrmx onu1opxo f3iytlmDrl( p t4 renir3ty1opDr neil(0trtrxr3iudom elieiat  rraumo;u4tpxn ictydfm2eanms;u)arxomf3ty1laD aieil( srxr(mpnu4ale  fesasf 2taxrpno0olxn feiydfm ra(vs (4tlxrmo todopD aivs;s  exoim3ou1aptn ietls)sDuax ono0opeomociatlm ra(vo t0alenircty1opD  uvs;s0sexm(o nu4lpt  netas)a2trurp;u1ope mociltfm2eanms t4arenxo iotlaDrln i s s2tmxr3oodllee nvsas s2rrumpoo4oexomf3tydls rlnmp;(0tlxnmfctytoa   nvo () rtoirpio1apt mnvtas  rrm(m no0ale  ieild m2uanmpn()aexnmfcoatop eanvsls srumxrpoodole mfvs () ruau  no4olenifetysfa2ulu o u0trxomo oodfptrlivilt)teto(r ny1oltemncils  2ra(rpno4oeen oeiyt m2el(ms (4 ltnif totomtrluvi s s2tr(rpiu1lmtemneiltfsrumx  ;u0teto ieiyslmDrlnvs t0 reoirciatlpDeaieols  rtrxm3iu4alen fesa()srurx  nu1tet iiciysfm emu o ()trerxrcto1lp rluei;t)t2xoimpou1omenmiesltfsrua( o;o4tpe  ieiad aDrlnmp;t)tlenif iatlmteaiesls0texmirpny1apeemivia(f Dumxronu1tlto f3tyd m2umnms (0arermocty1omtrliei;t0t2xm(r iu4openmfvtl(fa2rmxrpno0optnmf3iyslmDeluvp u4aetrxrctytfa e nei;( trxmir3iu4omt lnes (fa2umxmpno1oeeo oeiat m ra(mp;t)tlxomr3ty1fmtrau o t0s2toxmpoy1om   fvi t)srtmu  ;t4tpenifcilslmDeanvs;t0tetomoctodlm  anvi;( s2xmxm io1lme lnvilt)srtaxm nt4tpx ioeiyd m emnms;u)trtnmr oa1fptelieo t t2xo(rpnydam elivi s  Duaurpno0aeeo ictlslsDrmu o t4alenxf3iydfmD aivo;t seur(m iudam n nctat srumumooo1apeomoeiat a rlnvo;u)aexrirciy1lpDe ues () 2urir iy4opt lnvta(  rumuronu1tpxoii3tas aDranmonu4 etrif3iadlmtrlueols  rtoim oy1al  lfvsl(  2um( oot1aleomoeiydlm2rm(vont0teenmo ia1latrai s;t0trto(o oydom e iesltfsrrm(moou4tltoiiciyslm eauvpn()trtoiocoytla e u ols)trxoir oudlptelncsa( sDrmxroou0alto iciltfa uln p;u)aexnmo tydlpDe i s s0srxrxo iydlp nlictlt sDta(root0altnif3iasls2em(mo t0 lerxr3tatfptelivils)trum(opnu1omenlneia(fartaum nu0tet mfeiytfs el(vp;t4aleoio iotfmt liei;(0 2ur(r3oo1amtn
\ No newline at end of file
@@ -0,0 +1 @@
+uvs t0 rtrxo3no4ope mfet (  Dtr(root0tex mf3tydla2emums;u0 rxoircoy1fa ranvs ( texoiopnu1ol  lnctl( aDrr( p;u1tleomfctysla2emnvpn() exoio3tadla  luvs;s0 rtmim3iudomte iviat s2trurp;o4alen ictysfaDrmuvonu)tltrxoctydoa rlieo;s0srtoxo3ou4lpe lnetlt arrm(mp;o0apt  ieild a ulump () leoxrctatlp elnvs;t)texoirpiydomt lncilt a2taxr ot4teenmictlsls ea(mp u4 rxomo tydla   ivs;t t2umir iodlp nlivias arrau pnu1oee ifctldls uaums t4trtoxrcoydfat auei s trurxr iydoltnmieiltfaDrauroou4tpt mfeiad a2um( pn()trermrcoy1lpteaneslt0texmiopnu4olee nvil(faDtaur ;u0tptnmf3iydlm umnvp t0texoir iydoa rln sl( t2trxo oo4ap nlfesl()sDraum nu0tlxo ictyslaDean o u)arxrmr oytlm  aies;s0 2tm(r iu4ome  fvils  Dua(m ou0ope iictls a rmuvs t0alxomfctatlmtrai ols)teurxm3nu4omen ietl( srtrxro;o4alx  fctat sDrl(ms t4trenxfctotfaDr ivi;(0 2xrio oo4optn fvs t s2taum ;u1opeoioetydlsDrl(ms;(4aeenxf3tadopDe i slt)srumirpoy4olenliet t arrm(m no0oetn oeiasla rm(msn() etrmf3tadopD  u i s0setmxr3nu1ameelnct sfaDrmu  no4oexoiieiltla em(vsn(0trxnxociydoaD  nes t)srtoir3iodaptnliet s s2rrum nu0apx ii3ias sDemumsnu)altnxf ootlaD  uei;t  exoim3ou4omte fvt tf Dtrur oo0alen i3iat a ea(mo u0alenmocia1lmtrlu o;t)t2to(o iydop n iesl(faDurumpou1aptn f3ias a2uan o t) rxrif3tatfp elieo;(0t2xo(m no1lpt lfeilt) rraumonu4aptn i3iysla rmnmpnu) etnxf todfmD livi t  etm(rpiy4aptelfcsasfs2tr(m ;t1oet  ictytlsDrlu snt) eenxr3oydlpDr neils  exr(rpoodap n fcsl() rrrx pnu4tleoif3tydfm ean o;(0 eeoiocoy1lmte ivs () rxrir3ou1ope  nctatf 2ta( oou1apto ociasfmDrau snt4altrxf3ia1fp r u o ( seurxo oudlmtnlieils arua(mont4tlx mieiasfm2rm(vpnt0aeenxr iatoaDrliesl()setmimpnodope  fvtl(fs2ur(r ot0aet  oetlsfsDuan o;(4tlxoxo3iytopte i il( s2urxm3ou1lmenmivt t) 2umum nu1ole mo3ilt s rmuvsnt)trtrio3tatlm   nei t)s2xr(m nydoptelicta(f Dtrumpnt1tetnmfciatla umnmp;() reoxfctotomD aues t)srxoirpoy1opeemfctl() 2urum oo4opxn octaslm uan pn(0altoiociodfa   ies;(0s2xoimpnu1ale  nct t)aDrrxm no0apxo feilsls emums;() rerxo3iatfaD  i i;(0trxm(r nydlmeemiei sf 2rrurono1oeto i3iydlmDuanmp;t4 ltoxrctotfp  anvo ()sexr(r3oy1apt mnct s)srrrurono0aex ioctlt s el(mo u)tltnmr oadlateaiei (0s2to(opiudoptemict s)a2tm(mp;o4oeen i3iltlsDeanvpnu4 rtrxf3tydfmD aieilt s2uoxrpny1am nmfvilt)aDtmxrpnu4alx mfetlsfmDelu o u0trtoir oy1faD livsl( t2to(mpiu4ll elfeias sDta(r oo4alen feiydfm emuvsnu0alermo3oodlm eli ol(0t2toxo3oodop e nci t)aDrmurono0olx  f3tasfmDemnmo u0 rtoxr oy1faD aies;s0srurxm ny4oltn nvsls)sDraurp;o0oeenifciadfsDuan pnu)alxnif iotfp   n i (0s2toxr3oy4lmt  ies s  Drmumooo4ole  o3iatls uanvp ()alermfciadlm r u i ( trtoxm3nodaltemfeiltfaDraxm ;u4tleomfciatls emumo (0arxrxoctodfmD ai olt  2uoio3iu1optemfvia( sDrr(r nt4aptomiciytfs2uluvo;t)tlermf iy1laDr uvs;(0 2tm(mpny4al n netltf Dra(roou4tpxniietys sDum(vo (4 leoxrcoo1lp  lnei;t0setmio3nydoptemivil( aDuaur ;o4tee mfctlt sDeanvo t)teenmo oatoaD  nvsl(0t2trxo ou4lmt lnet sf Dumx  ou1oee moetyt a2rmnms;(4tetrxf ia1fp   uvo;()trumxr3nudopte nvta(fsruauro;t1alxoif3tys m rm(mo u)trtrxf3tydom rau olt)trxoiopnudopenlnvs () Dtrxr oo4tlxomfeiyslmDrl(vp;()teeoxf3iotla  ai o;()setrxmpnu1omenlfvsa(faDrmx  nu1tee  ociyt sDumn sn(0tetrmr todoaDe uei;s0s2um(o3iy1ap emncta(f Dtmum nt4alxo ieias mDrl(vo;u0aetrif3iy1omtr i o t) eur(r nodamen neta() rtm( ont1apxomiciasfm raump;t)alxnif3iodlmt livo;s) 2uoio3ny1ale mfvs ()aDrauro;o4aexnmoeiyd mDuanmo;(4 lxnxf oytlaD  nes ( s2trxr iy4olt mivtlt sDra(m ;u4teeoif3ildfs umnvpn(0 etoxfcoatlptr ivo t0truoir3iodll  mnvias  rtaxm nt0aeeoio3ilslsDulnvp t) lxrxfciytfaD liei (  2trxo io1optelnetltfsDtaxrpot1tltomoctlslsDrm(mp;u0 rxrxr iy1lmDelnes;() etrxo3oo4amte fcs ()a2uau oou1ope  o3iltlm elu p;u4 exomo ia1fmtrli ol( s2to(opiodape lnetas) rtm( pnt0tlenii3iasfa rmu o;u4arenxo3iydomDrai o t0 2xmxr3no1op  lfvtls)sDua(m nt0tlxn f3ildla2rmumo t4 renxociotfp  liei t)s2um(rpnu1olte feiat)aDraumo;o0oeeomfcildls2elums;u0teeoir3oadomtelueo;( setrxopoudom nmivsat)s2rm(mo;u1aexnmiciys s rmnmo;u0tltnxf iytla e n o t0srtmxm3io4amtelnvsls)srtm(m ;o1tetoiieilsfs eluvs;()alenxo iydfpte uesl()teto(r io4apenmnctl(  2taur ou1tpxomi3ildfa eau p u4 exrmfcoatoatrlivols0srumxo3iy1am nmivi t arum(rpnt4tet iieildls umn s;t0aeenxr iodfateliei t)seuoxm nodop  lieiltfa2trumpno4altoiociydlmDuln snu0aexoif3oa1omtr i sl()s2um(rpny4opt mfei (f 2um( poo0aexo fctld sDrmnvs;u4artnif iodlp eauei t0 rum(mpiu4lpee net s)s2umumo;o4aleomfeilt s2rlumpnt)altomf ia1lm elnvo t  2tmiopiy1om   nct t) Drrx oot1aleo iciadfa em(msn(0 etnxr iadfm elnvi;s) etrxr3iy4ol e iciatf Durxmpnt0tetoifeiydfsDrmuvo;(4aexoio tatlptrauvi s)s2xrxr3oodlpe mivsatfsDuaur oo1oexn ictasfmDel( o;t0 leniociadfpDrliesls)texrimpoydllen feilt  2ra(rpot1altoif3tyt a2ulu o t0aeerxo iodlmDrai s;s0s2um(o3iu1lme  ivtasfsrrrur ;u4aex ifetatlmDemu s;u)altnioctotfm  au ol(0teurio3no1ome lnvils aDuau o;u1tlto ietadfm uau p t0treoxr iydfat lieol(  exoio iy4optn ncslsfa2rmu ooo4oexoii3tadlmDumu p ()trxnxociatfp elu ol( setoio3nu4lpeelfcsa(fa2rru  no4olt  oeiltfs2umuvp;u) lxnio3tytlp raneo t0 euo(opnudamtemfci t)aDuaxm ot4aet iiciyslm2emn snu)arenxfcoa1faDe uvo t  ruo(r oudomenmiei s s2rmur ;u0apt ifctatlmDra( ont)arerio oytoatr ivols setm(r3oydlltnmnci sfartmx onu1aeenif3iyt s2eaums u0arxnif3oadomDe nvs;t0 2xrimpoudom emfvslsfaDrru onu4olt  ictytlm2em( p u4trxrir tytfp  aivo t0 etm(r oy4altnlivslt  2rax o;t0tpt  feilsfa2elnms;t4alxomr iotoat au s t0t2trir iodol nmivtl(  2rrumpoo4tle mo3iys aDrmnmp;(4 etomr3tydlmD ai ol()texmimpoudam  mics t)arrmxmonu4aetn fetlt s rluvo;t4trermfcty1lpD  uvsls trxrir3ny4ol e ncs (  rua( o;u1openif3ils a2umuvo u0aexnxo iy1lm  aivolt0 rxo(m iydlp   ivs ( srrmxm ou0tpx if3iasfaDrln o ()tlxrmo iy1fmtr nvilt trurxo3oydop elfciat sDtaumpnu0texomfcias aDrlnvs;() etrxf3oy1om eaiei;()setoxm iudal n nvil(faDur(mpnu1apto iciadlm umnvp;t4artrmfctytoat aiesl(  2ur(m nu4amenlncil(faDtr(mo;u4oet ifeiasfm2umnvs;(4teenxocoytfm rli o t0 2uoio io1lptnmneia() rrmxm ;o0tlt  ictat sDuanvo;u4arenmociadoptrai sls t2trxr no4ole mivsl(f 2rau  no1oetoifetasla elnmsnt)artnmo3iatopte i ols0trxoxr3oy4ameemivsl(  rtmxmoot4tex  ieildfs rm(vp;(0tlxnir io1oat  ueslt0trtriopiu1alt  iet ()s2tm(  ;o0aptnioetlsla2uan ont4aeeoxo tydoatr ivils)srtoio oo1al e fvtlt)srua(mp;t4aeenioeiyd m uanvo;t4 renif ta1oateliei;t0 2trio ou4oltemnci s artmumoot0olxnmictlt a2em( sn(4teenxf ia1fpteanvo;t seur(o3ou1ale mictls)sDrm(rpno0optn oeiatls ea( ont0texoxf3iatfpD  uvi t0t2xoxm3ny4lmen nes s  ruaxr oo0texnmietas a uan s;u0alxomociatop  au i;t s2xmxm3ny1op nlncia( s2tmu pnu1apxo i3tad sDelnvo;t4aetnmocoo1fmDrlivilt texrxm io1apte feia()sDua(ro;t4tlt  o3ild mDra( s;u4aeermo3iydlaD aieo;(0 exoxo3iy1ll elfei sf 2ta(m ou4ale ifetad a rm( on()trermf3iatlp rau s t  etrxrpnydlme mfvtasf 2uaxmpnu4altomoctydfsDrlnmp t0 lxomr oatfpt auei t0s2xr(mpou4ale  net t)sDrrxmpnt4tptniociltla2ul(mp t0arenxfciytlat aues;()sruoir3no1amtelfvia( srrrxrpnu4opxnmfciltlmDrluvpnt0teermrciatlpDelu i s)trxmir3iydop  mncias s2rmurpnu1alxo feiadfmDeaumpnu0aexrxf3to1fa rln s t) rtrio3oy4lmtnmfes tfs2uau pno0teeo octlt s2elump;() rxrmr3iy1fmDe nvslt0srtm(r oydaltemicia()s2tax oou4olxn f3iatfa uluvs;(4artrmrcto1fate n slt) exo(o no4lm   nes s)aDtax p;t4apeomfciydfaDran sn(0 reomo oa1la raneo s  eurxm3iy4altnmivt t srraxroou4tpx mocildla2umnmo;(4artrxo oytfmt aneo;(0teto(r3ou4am  mietlt aDtrx  ot1ale moeiysfmDeau snu0trtomo3io1lpteliei;() eurio3io4ap  lfvias)s2uru onu0tet ifcilt m2eluvs (4aexoxfcia1faD anei;s) ruo(r3nydopenmieta(fsDtaurpou1aetomf3tlt a2eaump (4aetnmf ia1fatr u i;()tetoir3ny4lltnlncsa(  2rmumonu4olx mieiltlm rluvonu)arxoxrciy1fmtrlnvil(0 2uo(m3oy1ol e net s  2ururonu0oeeo feiytfmDemumon(4 exomo iytlpDeaueo;s  exoxopiudol elnvt (fa2ur(roou1olxo f3tat s rlumo (0texnxf3ia1fptrlueo t s2xoxo ou1lptemivt s s2umx p;u0tpx  ociys s2emnmp;(4trxoircootlm eai o;(0seurirpnu4olt lnvs s) Draxmpoo1olxo ieils s2umuvsnt0 rxnif3iytlpD ln s t)texrxo3iy4lpeelivsasf Dtrxrono0ape mieild a ean pnu)texomrcoy1lmDeaieo;s s2tm(rpiy1omenlfciat  2rax p;t0ope moctyt sDua(vsnt4aexrir3tydfmDelivo;t)s2trxr io4alenlneils) 2tru poo0altnio3iytfa2rl(ms;u) rxnxf tadfmDelivils0s2tmirpiudlmtnmictat)s2tmur ;u4apx mo3tytla2uanvpnt0aexnio3to1la elu o t)truoim iu1lmte icilt  rtrx o;t1apxnmociytls2el(vs;u0alxrio3to1om  lu sl(  eurir nydop  mncslsf Dumx p;o4olx moctas s2ea( s (4aeeoxr3tadlp rlivs;s  2to(mpoo1llt liesls srrru o;u4apeo oetys s2ea(ms (0 lenif tydlaDe n ol() ruoxm ny1olenlicsl(fs2trx p;t1tpx mfcildfa rl( pnt)tleoio iotfpDeanesl()srurxopiy4ol nlfvsltf 2ta(mono4oee io3iyd sDrluvsnu4tleoxr3iatomD lueo;s0 eto(m nu4am   fviatf Duaxmonu0tptnmfetatfaDrl(mpnt4trxrio ia1fmDr n o;s0 2tmiopiy1lle mietltfa2tm(r ;u0tle ii3ildla rm(mpnu4alxnmo tydomDeaivi;(0 2tmio3ou1opeelnviatfa2uaump;t1tltnmfcilt aDelnvont0artrxr3tytoatran o;()t2xoxo iy4ome lictat sDraurono4alxn o3iyslm2ra( pn()artoir3iydoa   ieo s0s2toxm iudlltn feilt artaurp;u1oee mociydfsDra(vpn(0tlenmr tadfatean o t0 2xo(m3ou4optn fet t artaxrooo1teenmfcildfm2rlu o;u0 etnif3tadomteau i t  rxr(mpiy4lpeemfcsls)a2tm( pot0tpx  oeiys m rluvonu)tlxoio3oadfp elneolt0srtrio nu1lm  mictltfaDurumpnt1tlt  oeiydfmDul(vp (4 reoxfciotlm  ln i t  rxo(mpou1llenmnvtl( srumx pnt4apenmo3tls a2emu sn() rtrifcoy1latr ies t0t2xr(r iudoptemfet sf rta(mono1olxomi3tydlm2um( pnu4tetoxfcoo1lmteluvi t)trxm(opnu4llt mietl( sDuaxrpno4apeoiietlslaDrl(vsn(4aexoir3tatoptrau i;t0sruoirpoo4lp nlivtat) 2um(  nu4tptn iciat s elu sn(4alxnxocoytlmDraivi;t0 2xm(mpnudllen nei t  Dtm(rp;t4tet  i3iaslmDumn o;t4 lxoio ta1fpteanei t teurirpnydomt mfesl(faDraxm nt1tpto i3tyt m em( o t)arxomo3oydfpD  nvs s  2tr(r oodop e ncilt)a2taur nu4apt mociltls2em(vpnu0 reoir oa1fpD ai o s0tetoirpno1aptn nes tfarrmu  ;t0tex  f3ildls2uaums u) rxnmrciydfpD livs;t) 2urxo oo4olt mietls  rurx pou0optnmoeildfaDranvo t0 eeoxo3oodoa raueilt)t2urxr3ou4omeelieilt)s2umxr ;u1tpxomoeiatfm raump t4tltnmfcoy1lptelnei s0srxm(m3iydlm  lnei (f Dua(ronu4tltn ieiyt s ra(monu)trtrif oodoaD luvi;(0s2uoxopnu4lpen fei s)srra(m ou4tpt mf3iltfm2uln s ()aetoifctatla   uei;t) eumir nydom e fct (fartr(m nu0oexoiietlsls rl(ms;u4 eenxo tytfm rlneolt  ruo(r nudom e ncs s  2tmuro;t0apeomieiytfs elumsnt4areoiociytom  ai i;t trxmxo3ny1lm elfet tfa2rrump;u1tltnmfeiysfs emn o;t0altnxoctytlmt au s t setmirpnydaptelfcs (faDumu ono4opxo ocild m2uaumpn()tetoiociydlp r n olt  eumiopno1opte ivtatfsrtmxmpnu0apeo i3iaslaDemu on()areoif3oo1om e ivo t0srxm(mpno4olenmnvsls)s2uaxmo;u0aeeoii3iatlaDuauvo t0trtrmo3oodfmtrluei;s0t2ur(m3ou1aleemieia( srur( o;t0texnif3iys aDelumsn(0tetnxrciadlpDeln ilt)teum(r3oo1oltelfvsl(fsruax o;t0alenmieiatlmDum( o t)alxnmr ty1om  lu s;(  2xmxm3iy4ameemnvt t  Dtmxm ot1ope io3iatfa2uan s;u0altoifciadomt  i i t t2urxr3io4apt lfeilt  2rru pnt1optnmoeiadfs2rauvs;(0aeeoxo tytfpD  u slt0 2toimpiy1lmtnlnci ()sDuaurp;u0apxnmf3iad sDuaums;u)texrir3oadlmt lneo s t2umio oy1llenlictat) 2rm(  no4apenifctyd s2ea(vs;t4 lxoxocootlateanvol( trur(r3iu1ame livtas)s2rmx  ;t4oexoioetldfs emuvs;() etoiocoo1fm raivilt s2xmio iu4lpen fvsl() rra(ro;o1opt  i3iytls2rmumont4altoxo3iydla   i il(0setmxrpiy1omtn ici sfsrtmxrono4tpxnifetat a2rln p (0 eenmr3oydomDrluvils0 2um(rpnu4lptnlfvsatfsDtm(mp;u0olx  f3iytfs2rlu snt0tetomr ty1fp rluvi;s) rtriopnydaptn nvi (fsrra(r nt4aee moeiydfaDraump ()arermocto1la e uvo ()t2tm(o3nu1amt mnvsa()srtmxm ot4aet mf3tas a rl( o;()aetoiocootla rln sls0 etr(r iodlpte netltfartmx pot0tlxniieiytfm rmuvs (0treoircoytlm   ies;s0 2xmio3no4alee nci t)artmum ot0alxoio3iaslsDul(ms;t)trtrmo oytlaDeluvil(  2umio ny1ap nlfct t  Dumx oou0alt mf3iat aDuanvo (4tltnmo oydfatr n il(0t2umio oodamtnmfeilt  ruaxr oo4tee  fcildfsDea(msnt4 etnif to1fmD  u s;t0 2tr(r3nydlleemivsls  2ta(r ;o1oet  oeilsfm2emnmo;u)trtnxf3oa1laDelieo;s) rtrirpoy1amt mfesat  rrr(mpou0olto fciytlaDum( o;t) rxrio ty1om eaiei s)t2tm(r3nodap e nvtas sDrrx oot0ole mictydla2ra(mp (0 rtoiocootlptran o;( t2ur(mpou4aleemfeils  Dua( ono0optoioeils a2el( s (0aetomr oydopt  ivs t  2xoxo3io4lmeemfcs () 2uaumoou0aee  iciltls2ra( p ()aetrif3ta1lpDr iei s  rxoir iy4lpe  iesas aDrmumooo4tlxnifeilt m ua(vp ()aetomr3ta1lmDeauei;()s2ur(rpnudlmtnmieiasf 2urxr nu1oexo oeiyt a em(vo (4 lenmr3oa1fpt livo;(0t2trim3io1lptnmfeilsfs2tax p;u0oee moctld m ulump (0 rxnif3iatoaD anei;()tetm(o oudlltnmnvias) 2urxr ;u1texn fciasfm2eaumsn() rtrxr3tytoa rlnvi s0t2umxm nu4al n ncsat  2tax  ;t1alx micildfsDemu onu4 rerxfcoo1fmDraues;t s2xm(mpiy4lme mfetl() Duax p;o4opxomieiad sDuan ont4 lerxr tadopDrlu o;() 2xrxmpiudalee ivt sfsrrmu ono4ope mo3ias aDrlnmo (4 rermfctodlmtr u i t  exm(m3nydaptnmnet (f rtr(mo;u4openifeiytfmDum(ms u)tetrmo3iytlp rli o;t0teum(mpoo4amtn nvt (f 2rr(  ;o4aptnmfetatfm emuvo (4 exoxo3ootlmtrauvsls) rxmxm iu4am   ictl( a2urur ;t4teeo feiasfs2rm( snt4alxnmf iydfa e i ilt)sruo(rpnu1optemivtl(f 2umumpnt0aex  oeilt aDeln s;u0trxoxocoy1om e u ilt)trto(r oudop  lncsasfsrua(rpnt1opt ii3iad s2ranms (0tleomo tatoaDe uvols0trxmir3nydom n ieilt) Dtmxro;u1aexoiicils a2rlnvo;(4 etrifctatom r nvsl(0srxo(o3iydal elietl(fa2rmumo;u0tpx iietldfm ea( snt4arenif iodlateaueolt0 eurxo no1ll e ietat)srrr(  no0alxnii3ilt a emnvs t0arerxociytfm   u sls t2xm(o oo1olen fet s arurumoou0oeeo i3ias m2ulumo ()artrxr tydfmDeanvi;t) rtoio oydal emfcsl(faDtmur ;u1tpe miciyd aDeln s;u) rxomfctydlmDe i o;s texm(opio1apeelivsas)s2um(mo;o4ole ifcilt m2el( s;t0aetrmf iadopD  n o;t)srtoxo oo4amtn nci ()sDtaxm oo4olxoii3iadls2rmnms t4trtoioctydfat aneslt0 2xmxo3nu1ameelivs (fsDrax p;o4apxo feilsfm elnmsnu0trtriociydlat  nesl()tetrir3oodom n iesa( aDtauroou0alx ifciaslmDel(mp t) etrmf3iadlm elueo;t srtrxopio4olenlfeslt  ruaxm ;u0olt ioeiasla rm( on(0texoxo3iadfm e ieilt setrim3oo4ape  ieilt aDurxr oo4ape  ictatfs eanmo;(0aexnir oa1lmte neo;s  eto(r3iy1amtn fcta(f rrau p;u0altnmfetytls ea( o;u0 exrmrctytlaDe ieo;t) rtm(m3oodoptemivi t)sDra(m ;t1tle  o3tydlm umuvs;(0teerir oy1fmDeluvi s  2toxr3ny1lptelnet t  2tm( pnt0oet mfciysla2ean o (4 lermf iotopteanvs;(0setrxr ny4apee ivs s)sDraxro;u4oex mo3iat mDumnmp;(0 rtnmo3oy1fpDe ieo ( setoimpio4lpen fvi t a2tmumoot0openmf3iadfa2ra( p;(0 etrxo oo1fa eaivilt  ruoio3nydaltelnci tfartrum ou0tltomoetlt s ra( p;t0 eermo3tydop e i i ()texmim3oydaleelieilt arrm(mpno4oee moeildfsDelumo;u0 ltrmocoa1lat anvi ()srxrio nydol elnvt t  rtau poo0tptnmfetysls eauvp u0arenio3to1faDe i slt0texriopiy4om nlfesasfs2ua(rp;t4aex moetysfmDul(vonu4 lxrxfcootlp rln i;t  2tr(r oydaltnmnes sfsDtmumo;t0aex mieiatlm2rln o;u) reoiocta1oat anes;(0tetm(opiy4alenlfctatf Dumuroot1oltoio3iytls2uauvp;(0tleomrciatomtraueo () etm(o3ny4opt lfvslsfs2raxront1tpx iietld a2rluvs;t4artrifciotfmD au ol(0setm(m iodalt mivs tfaDrm(mo;u4alenmfciytls2el( pnu4arxrxociy1fmDelivils)trurxmpoo4llee fcta() 2um( p;u0aexoii3iys s2emuvo;(0 eerxf totfm  auvo;t setmim iu4lm emfet (faDua(m no4ape miciysfm eau o;u0alenmr3oydfateluvo () 2xrir io4omte fcsas  Dtr(ront4tpxn oeiadls um(vp t0aetnif3iy1lmDranei s) rxrir3no1omenmfvt (fsDrmxm ;t1tltomoeias sDuau s;u0alenxrcio1lpt lnvolt0 2xrxm ou4omte fesl( a2ta(monu0teenmictat a elu ont4tltomrciodlm  au i (0srtoirpoy4aptnmiet ( arur(roou0oet iieils sDeauvont0texrxfcoy1laDeai slt texoimpio1om elfvtl( s2trx oou0tptnmi3tltla2uanmp;t) rxnmrcoodfa e neo t)texrxo no4ame mfei t) 2rr(rpnu0tex mo3ilslm2ulnmonu4 exoxfctotopD aivs;(  etoir ny4lltemfct ()sruax ont4aptn f3tatls um(vsnt4areoxocia1fmtr nvo ()s2toxo io1lltemfct ()a2ra(rpnt0aeeomfciysls um(vo t) lxnifciodoatr i o;s0s2xoio iodllt livs (fs2uru p;o4texn ietad a um(vp;t0tlxrxo3tatfm elivs;()sexoxopou1altn ics s)srrrum oo4tlx  i3iydfsDrau pnt)aetnmr3oodlmDranes;( teuoxmpny1optnmncsl(f Dumumpno4olt  fctad a ranvsn(0 rtnxr ootfa r nvi t)sexrir oy1op nlnet s  Durxrpnt1ape mo3ias aDean s;() rxoir oydlmDelnvo s) 2xo(r3oo4lptemictlsfs2tr( onu4oeenmo3tad s uau s u4tltoioctotfmtr n slt) rur(rpio4om  mfct s  2rrxmp;t0aexoioeiyslsDumnmp (0altnmo3iydoaDelnvo s)t2urim3io4om  mieilsfa2taurp;o0tlto fetld aDumn p t) lxnxfcoytfm  aivo;t s2xr(o3nodolee ies t)aDumu o;o1alenmfetytfs ea(vp u0tetnif3ty1faDeau ols  rxoirpno4ol  lfeil()sruru o;o1optoii3tls a2ea( s;u0aleomr3iotfaD  ueo;t  rtr(m oo1omtnlnvtat s2taumo;u4opx ii3tltlm2rmu s;u)teenxf3oatomt liei;s texoxm no4llt  ieils)s2taxrp;u0teenioeias a2umn o t4trtoxrcoydomD auvi;s0t2uoxm iodlm  mfct ()sDua(  no1tle  ictyd a emn p u4 rxnxr3ia1oat  ieo;t) rtmxm3no4optnmnvtltfartaxro;o4aptoif3iatlmDul( s (4trxnxf oydop  anvilt)t2tmirpio4omenlfvsls) rururonu0tpxnmieiysla2umumont0aeenmo tadfpt an olt)teum(r iy4aptnlfvs tfa2rr(moou1tpxn fciadfaDumuvon(4 rtomr iotlaD  ivil(0trxmxm oo1amenmfctlt  2um(rp;o1tpxn octyt m2em(vpn() eeoifcty1opt lneilt) exr(m3no4op nmneiatf 2umx pot4ole iociatlaDua( on()texrir iatfmt lu i t  exmxmpio4op nmiet s)aDtmx p;o1apxn fctltlm elu sn(0tlermo iotfaDelivil( srtoirpoy1llt miesl()s2tr(mp;o1aet mi3iad m2umn snu)tetrirctytfmtrli o;()trxrirpiu4om  mfvia(  Dtm( p;o1oeeoioctlt s2ulu snt4teermf3tatlat  uvo;t s2toxm ou1apeemfeiat) 2um(  oo0tetoifciat s2emuvsnt4 exrmfcio1oate nvi s teum(rpno4lmte nctl( sDuru  nt0oleomoetys mDumnvsn(4trxrmf oytlmD auvo s setrxr3nu1llenmfvsas)srtmxmpno1opeomo3tyt s ranmp;u4aexrxr3tytfm   ieols0s2uoxr oo4ape lnvt s aDtm(mp;t1tpx iietyd sDemums;(4 ltrxrctadlm eau ilt0 ruo(rpny4apen fvi tfsDrr(mo;t0alxn iciatfmDua(vsnt)trtrio3oo1lpt lu s;t)s2umxrpno4omeelnesltf Drmxrooo4tpeo ieiysla2ra( s t)artrir ootlmDrlnes ( trxo(o ny1amt lfes sfsrrr(mont0tlxomoetytlm2rau onu0trenxr oatlat  n i s0trxrxopio1lpe  feta()arrmx p;t0opto i3iat mDuaump () reoxfcto1lmDelnvo ( s2xrim nudalenlfei s)arrmxrpnu0tee ifcilslaDrmn o;u0tetoxocoatfm  aueolt) exmio oodlpee ivtlt)a2um(  nt4tlxo o3iydfs eauvp;t0artnmr io1fmtelieolt0teto(o3ou4apenliesa(f 2urxrpot4tltn f3tytla uanvo;t0trtnio iytfpteau o;t sexoxo no4alen fcia() Drm(  nt0oexomfeilt sDea(ms;t0 ltrxfcia1fpD aues;t)trurir nu4lpe mnviasfsDtaumpnu1oeeoioeiatlm rm(mont)tltnxr3oy1omDeli i;s  exo(r no4lltemfctl(f rrrx ono4oetn ieiys aDumu p u4trxoxr oydoaDrlnvo s)srxmxm3io4lle mnvi ()a2rrx  nu0olx  oeiatla2uau s u0tleomo oy1fa eli o;t0t2xo(r iu1apen ici ()artr(r ;o1aeenifetlt s rmnvo t0aleoif ia1lpte uvi s)truo(m3iodlptn fvsa() rtm( oou1tltomi3ilt s emu pnu4arermoctatlm   uvs;s texmxopoo4ol n iesas srurx ont1oltnmf3iytfmDelu s u)tltnmo3oy1om rlnvilt sexrim3nu1amenlneias)arrrump;t1oetoioctysfsDelu o (0aleomocta1oaDeli s;( srxmxopoo1om emicilt)aDrrxr nu4aetnioctatlsDuln p;t4 eenxr iy1omDelneil( t2umir iy1ol emfvilsfsDum(m ou4olenii3ils mDrmnms;t4areoxfcoodomt livolt)srumim oo4ol  lfesasfsDrr(mo;t0aexoio3iadfa ul( snu4aeeoirciy1fpt aiei;()teuoxrpnudomenmncsatfsrurxr no1ope iociatls rlnvp (0alxoir3oatom eaues;(0 rto(rpoy4amenmnvils sDtmx onu0tleomociadlmDrau p;t0arxnxf iytlatr u o;( teuoxrpoodame lfctltfaDtmxr no1opxo ietyd a eau p;u)aexoxo3oy1omD  n s () 2trim3ny1amee ivsasfsrrmurpot1oeen ictad aDuln p t)alxrio oy1fatrau o (0 rtr(o nudlp  livt (fa2ua( oou4aeto ocilt mDeanvo u0 etnxr iydfmDeln s;()s2tr(o nudll nmivtasfsDtaump;t1ole iiciltls2ulnvs u4aeerifciatfmDeanvsls0texoxrpoo4lmeeliei t a2umur no4tetoii3tysla2uanvs;(0aetoir3oytlp eauei t) 2xrxmpno1alt  fvs t srrrur ot1texoiocilsfm2uluvs;u4 lxrir3to1lp  auvi;t s2uoxr3iodam e fctat arraxrp;t1tltnifeiasfs rm(mo (4aleoxr3oa1lmDr n s s)trxm(rpnudlp elivs ( s2um(moou4tpt  feiytls um( o u4tltnmrcto1fa r ivs s) rurxmpoy1lp   fet tf rtmxmpnu0apen ociadfmDel(vo (0 etomrciy1opt ln slt trtrir ou1lpt lfcs (f rtaxr ot4tpenmietyd m eanmp;u)texnif3iotlaDeli olt srtrio oo1lmenlics () rrrum nt4ale mf3iad s2rm(vsnt4aexnxf oy1op r i i;s t2umim oo4omtelfvtltfsrrm(moou0oetoif3iydfmDum( p;u4 lxnmo ootfate n i t) 2umir ny1ame lictat  Dra(mp;t0oexoiicildfm rmumo;u) etnmo3iytfptranvol(0 2trir3nudlpt mnciatfarumxrpou4opxo o3ildfs2rmump u0 ltrmrcto1lat lueolt0s2xoxmpnydopeemfeslsfsrtrxr no4ale  i3ilsfs um( s u4tleoxfctydopDelu i t s2trxo nu1lltemneiat srtm(rpot1tptn o3tas a raumo t) lermfctodoa   n o;t)s2xmxo oodalte fetl(fs2uaurp;u4opxoif3tadfa2ulu p;()trxrmf iadlmtrlneolt)truo(o oo4aptelfvi t)srraxmono0tpto fetld m2rmnmp;() eenifciy1oa r i ilt0 rumirpiydam e nciasfa2tm(rpnt0oleo o3iysla rlumonu)aleoir3io1lptranvils0trtoimpoy4lpe lfvi tf rtrur nu4oee  fctysfa2rlumpn(0 rerir3tytlat auvsls)teumxmpiydaltnlnvsl( srtaumpnt4opxnmieiadfaDelnmp;t0 eeomrctytomtrlivs t0 exr(o3iydole mivsltfs2um(  nu0aexo fetltlm2ean s t) renmfciatoptr ivo s0teuo(m no1opeemnes sfa2trx o;o4optnii3tltfmDra( snu0alenio3iatfp  ln slt) 2tmim3iy1al nlfvtl() 2urxmont4teeomoeiatfaDuln o t0tlxrxo3ia1lateaivs;( texr(opno4ame  nvsls artmxrp;t0olxniiciadlaDemnvp;(4tltoifcoytfmte ues;t0 2urxm oy4amee nvsas a2rm( pnu0tleoifeiyd s2ul(mo;t0 lxoio iy1omtranvil()t2urxrpiu1lp  mivsa( artm(  nt4tee moetys aDuanvo u0 rxrmo iy1oatr uei;s srtrxr oodop emnvils)s2urur ou4apx  oeiadfs elu s;t)aeenxr3ty1lmtrln ils) 2xmxmpou4lltelfctlsf rta(mpno0tlx ioeiys a rmumon(4 renmrcoy1lmD  i o;s  rtoim oy4al emfeslt)aruaxm nt1tee  iciltlsDum(ms u0tleomf3iy1om eanvi;() rtrimpoy4ap e ivils artrx  nu4tet if3ias mDeaumo t0texnxr ty1fmt  n il()setriopny1op elfetat)a2ra(  ot4tpeo icias m em(vs t4trxrio iydlpDeli s ( t2ur(o3ny1lltnmfcta(  Dtr(m nt4alt  f3iysla rm(ms (4aleoxrciatop eli slt0 2tmiopoo4ol emnvtl(  rumu ono1altnio3iad m2ran o;() ltrir3io1oaDraivi;s0t2ur(opoo1lp elnei ()srrmu  oo4apeo fctlsfa elumo;u)trxniocty1la rau sls0 2uoir3ou1oltn neiat  rtm(r ;u4oltn feils a em(ms;(0trxomr3tadlp  anvils seuoxmpnu4op elivslt)s2rrxmoot0aptnmi3iasfa2elu o t) reomo iadlpte uvo;t0t2xmio3iu4ole  ivtas aDuax p;u1tle mieias a emuvo;(4tlenir3iotlp rli i;t  etoxm3no1lp e nctas aDtr(mooo1opxnmi3tldla2ua(vs;(4aetrmr ty1latrluei;s0seurim io1ap nmnvsat) Drm(ro;t0apenioctat mDrln ont0alxrifcia1fp r ues t  rtr(mpiy4optnlnei sfaDtr( ont4tet  fciad aDumumo u0aeeomocty1optrauesls  2urimpiodal nlnci t artmxro;o0apt miciydls um(vont)tetnxfcia1fmtrlivol( s2umxr3oy1amt micslt  rumxmo;t4oex ii3iytfs2el( o;t0tleoxfctatfp ean ilt0setmimpiudlmte ivs (farumuroou1teto ociasfm rmn o t) ltrmf3ta1optr nei;t)s2uoir3nu1ale mnet s)a2tm(mpoo0tetomieiytfaDemu p ()aleoxrctatfmtrai s t0seum(rpoy1aptnmivtl()s2umumonu4apen ietysfm2ul(mo;t)artrmrctodlatelueo;t)setrio nu4lltnmict (faDtrxm ;o4oexoii3tasla rl( pnt4 reomf tatfptrau ols)s2xr(m iudamtemieta(  Dururpot0ole ifctysls emn o u0tltomf3tydomteli ol() rxrxo3iy1ll elnvtls)srtrump;t4openmieiad s2umumo ()tlxoxr iy1fa  luei;t0teumir ny1lmenmnet sf rtrumpnt1tltn o3tls s rmn o t4aetrio oodfmt lu ilt t2uriopoo4op e nvils)s2tmumont4apxo iciltfm2uauvp;()arxoxr oo1fptr nvo;()truo(m3iu4omenlietls  rrau p;u1oexo ieiad a2ea(mpnu4artoxf3tadoaDeaivi;s) 2tmxm io4lm  micils aDtmu pou0oeenmoeiys sDrmnmp;u0 rxoif3oodfa elu o;()tetrxo nudllte ivsasfsDraxrpnt0opx mi3iydfaDem( sn(4trxnirciatlpte n ol(  2toxopnodaltemieiat) rrmu o;u1ape  i3iydfsDrmn s u) rtoifctatlpte neo;t)s2uoio no4omtelics s)sDrrxm oo4altoifeiaslmDumu s;u4 etnir3oydopDr uei;t  exmim oo4omen ncias) 2urxrpoo1openmo3iys s emu s ()trtnxrciatfmt lnvo s)s2xr(r3oodomtnmivtatfsDrm(rono1aexoifctatlmDemuvs;t)teenmo iotfmD li ilt0sexo(o3nu4omtelfvi ()s2trxr ;o4tee  ociyslm el( o;t) eeoxr3ta1lmDeauei ()t2trio3ou4altnmivi t) Dta(rpnt1tetn fetls a rmnvpnu)aexnmf3oy1lpD aies;t)t2ur(o3iu4ll e fvs (f Dum(  ;t1olt iociltfsDrlnmo t0trxrxrciadlmt lneolt)srxmxopnu4oltemicsl(fa2trxrpno0tleniiciys sDem( p ()aeeoxrcoadlm raues;t)teurim3iy4om nlicslsf Durxrpou1altnmfetls sDemump t)areoxf ty1fp elu sl( trumir3iodolte fcsa()s2uau pno0ope mietysfs umnmp;u)arerio to1opteaieolt) exo(rpiydop   nctasfsrua(r ;t1teen fetlsfmDulums;t0texrir3oa1fp r uvils s2trim3iu1am nmnetltfartmump;o1alx  fciydla2rmu o;u0aetnxo iadfp eanvs t tetrxrpiu4ole livtat)s2umxm ;t0teeomoeils sDuln s (0 rtnmo ia1lm  luvilt  2tmxo3oydllen ictat arua( pnt0tee  fciatlmDranvs;t4alerxr tatlp elivi s)trtr(r3nydaptelnvt ()s2tr(mpot0tlt iocildls2eaump ()aetomo3ia1fatrln o;s0sexr(r nodoptelfet tfsDum(mooo4altomieilsfs rlnvont4aleoxo tadop eanes;t  eurir iu4lmtn fvslt aruaxm ;u4apxn o3iytlm ra( p t0 ltnmrctotop rln slt) 2tmimpio4altnmivt s)a2tm(r nu0oee mo3ilsfsDemuvp;t4tleomf3oadop  lneslt) 2tmxrpoo1lm  mfes tfsrrruroou1texnio3tlt a rl(vpn(4aexoifcoydla eluvsls) 2uoiopnudlltn fesat a2rrxrp;o4oexn fctatlmDelnvo ()trtnmrcootlat ai i t)teumir3ny4aptelfvs s aDrrxrpnt0tle ioeiydfm2umump ()altnio3to1laD lneo;s0teurxopoy4apenmfvt sfs2rmu  ou1olen iciatfm emuvp;u0aexrxo oatopt auvo s trumirpno4lp e nei s s2rrx p;o4opeomf3iydlm2umn s;u)tlxrmf io1oaD  nvols s2tmxo iu1olt livtlt)srraxr nu0tetnifeiatlm uan o;()trtnmocoo1omtr ues;t s2xrir3nu4lpt lnet s)aDrrxmpou0olx iictadla eauvp;u)teeoxo oodfpD lnvi;t)sruoir3oy4lp nlivs sfsDrrx  no1aleomieiatfs2eanmp t4texrmrcoo1fm rli il()s2xo(r3iu1ap emfes ()aDtrxmo;u0aee io3tydlm2em(vs ()tlerxfcoy1lp elnei;t  rtrimpiu4lmeeliciltf 2raxr nt1oet mfeiyd s2emump;(0 rtrmr3oatla eaneo;t) 2trxmpou1oleemies t aDururpou4tpenifeiatfs2ul( s ()altnxf3ty1fp  livils0trto(o ou4oleelfeiltfsDrrxm ot1alt  o3ildls2eanvpnt4 eerxo3tatfpDraueol()s2trxr ou1lpteliviat  Dta( pnt1tee  i3iat m2ea(ms;t4 reomf3oatlate ieols)s2xo(m ny4lp  mfcsasf rtm(mpnt1tleomictltfa2elnms;u0trtnmrctodfp rlueo s0teur(mpiydlpe  iesa()aDraxr ;u1tltnmfctydlaDuau p u0alxoxr3tytoaDr nvsl( s2trim3iu1lmenmivsasfaDrrxro;u0aetoiieilsla umnvsn(0tleomrciydlm  ai slt) 2trxm nudamee nes ()artru oou0tlto i3tydfa2rmnvp t)tltomf3oytlp eli i;( srxr(o oo1ll nlneiltfartmurooo1aeto i3iydfs2rmumo;t4tetrmo3ootla rluvs;() 2urxrpio4lp  lfvsas s2uauroot0teeo f3iat aDem( sn() leoifcio1lmteaivi;t t2toxmpnudole lnviat aDrmumpoo4tlt  f3iaslaDeau ont4aexrioctadoaDrlnvols0sruoxo3nu1opeemivi t a2trxrpnt0aex mi3tlslm ul( s;u)trxoxrcty1lp ranvslt) eurir nudlpen nctasf 2ta(m ot1tex  ictytfs rlu o t4 rxnio3tytoaDean s s0 etmim ou1omt lies (  Dumxmono1oee io3iadls2um(ms;() eeoxf3ty1fpDr uvs;t0 etoimpoydlmen fct s arua( poo0tee mieiydla rmnvp;t)arxrio3oodlp eaieo;s)sexm(opoy4om nlnciasf rur(ro;o4oex ii3ias a2uau snt4alerir iotfatranei t0 2toim nu4apte nct ( s2tmxm ot4opt  fetltfsDrl( s;(0tetnmf3io1lmtelieo;( tetmir3oy4omtnmfciltfsDumumo;u0tpx mfeiys m uanvo;(0tleoxoctydfa rlnvil(0s2xoxr3oy1apeelneta() rtmurpnt4oleoiiciysfaDea(vonu0texrxf iatlm raies;t0 2xr(o iu1olen ies s s2tau  nu1opt io3ias m2rau s;(4tetnio3ta1latraieo;s)texrxrpnudomtnmfvt (fsrrauro;u1alto f3tlt m raumon(0tleomo3tadopt li sls0setriopio4apeemfciat)a2um(m ;t4oexomiciytlm2ulu pn() lxnxfcoodfmt lu o;s  2xrimpio1ame  nciasfa2raxrp;t4opx  ieilsla2ranmp;u)tlxnmf oatlmte nvo;s t2xrirpiy1apenmici ()aDua(m ;o0alxomoetlsfaDrmn pn()tleoxr to1lmDr ieo ( srxoxm iydap e ncs ( a2rmumpnu4optn ieiatfaDemuvs t)alenxf3iydlm rau s;s0trumio3nu1ap  mnesas) Dum(m ;t4open i3tytfs2emnmp;(4tlxnmf3ta1lpD  nes;t t2triopiu1am emies (  2urx oou0oex iictyt a2ran o;u4altrxf tadfpte ies;t0texoxmpno1om elfvt (fsrtau  oo4aex  fctlslsDeau snt4texrxr to1fptrlueils0setoim3nodllte feilt)artrxrono1alto fetydfmDrmuvs u0 rxrxrctytoaDr nvs;( s2um(mpoydalt mfctatfa2tau onu0olxn i3tldlaDeln o;(0tetrmo3oytoptr i i;(0t2xmxm iy4lpeelietl()sDum( p;u1oetnmictyd m rluvs u)trxnif iatom eauvil() etmim oo4lmeemneil( arrm(r ;o4alxn i3tlt a uau o;(0arxomr oytfptrai s;s0 2tmxo3oydll n fvsa(f rtax  nu1olenmoeiytfmDumu o t)artnio tatoat auvi t0tetoxo3io1lmtn nvtat aDtm(mp;o4tleo ictltlm2eluvpnu0teeoircia1oa e iesl(0s2ur(o oodalen nvs (fa2ur(monu4teeomfctysla2rlnmpn()teeomo oadfat ln o;s0t2toimpio1lmt livi tfarrmxronu4apxn oeiytla2ul( o;(0alxoir iodfm eln s ( s2uoirpiy1ap  mneias) Dur( pou1oex moctldfa ua( p;()tltrif3oadomt aivs;t0s2toimpoo1ap n ict t) rtaurp;o1tptnio3tatfs um(vp;()texnmo iodfateaiei;s)s2uo(o nu1lmtnliciat)aDumxmooo1aexoifeilt sDumumsnu4 rxomf3ia1opD an s t texoxr iydlmtemies sfaDtaurpot1oetn i3iaslm2rm( o t0 lxoif3ta1faD  u o t0srurimpno4llen ictat) 2tr( p;t4apx mi3ilsfa2ean p;u4tlenif3tadlmtr ues ( t2tr(r3oo1om emnviat sDrrxronu1apxo i3iysfm2umuvs (0altnir iodoatraneol(0s2xrxopiu4omtn fesltfarta(ronu4openmfctlslmDuauvo (4 rxoxrcto1om r n o;t  rumxo nydlpeelivtat  rtaxm no4tpx  feiasfs2rl(mo t0tlxrif3iydfp eaueilt  etrxmpoydamt  icias)srtmu  nu1tpxnmfctld a emnvs ()tetrmo to1lptr ies;t0tetrim ou1olee fcsat)sDra(rooo0oexnmf3iys s2um(ms ()alenxo to1fm  liei;s  exrio nu4ll emfei s arrrx  ;t1aetn ieiyt s umump;u4tleoxr ia1omDrlueo s)t2ur(o nodam nmnvils) 2ur( o;u4texnmiciyd sDran s;t)trtrxo io1opDeauvi ()srtmxm3ou4aleemfvsa( s2uau onu4tlxnmi3iltfa emnvo (0 etoifcoa1opD li ol(0 rxm(m3iudll e iviatfs2uau p;u0oltnmieiytlm2rlnvo t0altnmo3tadlmt  uvolt truoio iydom nmietls) 2um( p;u4opxoii3ias aDelu s;(4arxrmfcoy1op   nvolt trtoxmpno4amt lncia( aDrmxronu4tpt  f3ildla uanvs;(0 rtrmf3ootfa   ueils t2xrxr no1amee fci s a2raxmpoo4open fciytlm2eln s;u0 etoif tatlm rauvo;(  2trir nu4ope  nvs t s2trurono4aexoiietytlm umu p t)aeerifcoo1fpteai s t0teumio3iodoltemnvia( s2tm( oou1tpx io3iltla ulumpnu0trxoxf iy1om rlies s0 eumir oo1apeemiet sfsDum(rpou0ole  oeilsls ean snu0tleoxfciydfmtelies;s0t2xmir3iu4alt miesatfa2umx onu4oetnmi3ilt mDel(mpn(4tlxrxrciytfp rln sl(  eur(m3io1oltnmnetat arra(r nu0apeo iciyd a2rmu sn(0trermf3oadlmt  neo t) 2xm(r3oy4ll elivi (f 2rmuront0apxnmo3tatlm eau pnu4 etnmf tytopD  ivo t0 2umiopiy1omenmfct s) rrm(ro;u0tlxomfetasls emn sn()arxrxf3tadfa e i s;s)texo(o ou1aptn neiat)s2tmx onu0opeo i3iydla2um(mo;t0texrmrcoytlm elnvs;t t2toio3iudope mnes ()aDta(m nt1tetniieiysfm uaumon(0 rtnxf3oy1fm  ai o;t0s2urim iydaltn fciatfaDumxrpnu1oet ifciytls2emuvo;(0 lxnmf3iy1opDe ivils) 2tmxm3ny1olte neils)s2umx  ;u1tpto oeildfmDrmuvsn(4trtomfciy1fpDr uvo;(  rum(m oo4ape lnvs ( s2tmurooo1apen i3iltlm ran onu) etrxo oydopte ueols  euoiopou1al  lieil( sDtm(mo;o1olxomociydfaDel(vp u0artoio3iytlm r ues;(0 ruo(o3ou4lmenlict t) Drm(mont4apx ifeias s2ua(vo u)tltnxfcoodlmD lnesl(0srxr(mpnudop e fes () 2tmum ;t1alxoif3iatfa2uanms (4tlenir tytfa eau ils0 etoim3nudlpen fvslt) Dtrurp;t4tlto octasfs2ean p (4trxrif3ty1fpDeaueo t) 2tr(r3io4ol   ivsa(fs2tmu  ;t1tpx io3iadla2ea(mo ()aeenxf iatoate ues;( t2xr(o3iodlpte ictls  Durxr oo4texomictasls2rmn snu0tleomr oydlpDrlieo s  2tmxr ny1amtnlfetl(faDrmumoot1ape moeias mDrl( p;t) exomfcoytfm eluvo t0seumxr iu4omtn nctls) Dtaxrpnu1opeoif3tlt mDuanmp u)trtrio tydlate i ils)texmxopiy1apen ict t srtaxmo;o0texoif3iatls2eluvsnu4trtrifcto1lpteaivsls0t2tmimpou4lmtemfvil(fsrrm(ro;u4teenmfciasfaDrauvs;t)tltnif iadoat aivi t)setoio3iu1lp e neiatfs2rmx pnt4aeenifciyd aDuan p t0arxrmfciydlpDean s;t0srxoxm nudopee ivi (fsDtru  oo4tpeoiiciydfa elums;t4 leoxf3oy1fpD luvi s0teurxm oy4omeelfviasfs2rmumont4apen i3ilsfa2uluvsn(4aexnmoctotoa ean s (  2urio iodop  mivtls sDra(mp;o0tet mi3ild a rauvonu)trtniocoy1laDranesls0 rxoio iu1lltnmivilt  Durx  ;o4oee iociyd m ul( on()alenxrciadlm r ivsl(0t2xo(mpny1lp   fvia( a2umumpno1olxn f3tltfaDulu p;t) rxoxfcoydfpt lneol() rurxr3nodomt liviatfa2tmu  nt0tptoif3iyt a eln sn(0teermr3to1fmt anvi s)srtmxo oodlp  lnct tf Dtaumo;u0optnmoeiadfsDuaumo u0trtnxociytoaD  ues s t2xmxm oo1altn ici t) 2uauro;t4aet iieiad a2ranvs u0 etrmfciytoat  uvols)srumxr iudamen ivia()sDumur ot0aex mietyd mDrmumo;(4 lxnxo3tydfpteau o ()texmxr3oudlpe mivsl()aDra(ro;u4ope  o3iadfs rmnmon(0 rerxf3totfmDrln s;(  ruoxm oy4lp nlfcsa( artaxr nt0texo icias m rl(mp t) lenmo tydoa eaieo s0s2toimpiu1ap nmfvt s)arumur ;o0tetnif3tlsfaDrmnvo;u)tetrio ootfpDeln slt) ruoiopno1apt mfeia(f Drm(mp;o4oleoiietltfsDemu p;t)trtoxf oy1fp   uei (0s2ur(m3nydape micil(fsDum(rp;t1alenmf3tat a uau on() rtrxo3iodlat lies s s2trio3oy1optemnes t sDrru  ot4olt  feiatla emu snt) rxnif tytfa eaivi ()srtoxopoudap  miesl()arurx  ;o0apt  oetltfs2em(vp;u) etoxo iy1lmDeaivsls)texrimpno4lltnmieil( aruru pnu0tlxnii3iltfs2rmu s;(4tetnxf iatomDrlneo ()trtrxopoodomee nvt s)s2ua(rpnt1tptoiiciydfaDulumon() reomrctodfm eln i t)s2trxopno4ameelfesa() rtaxr ou4alx iiciysfaDrmn s;u4artrmr3ootom   ivsl(0srxo(r oy4omtnliesl(f Drrurpno1olen ociysfaDea(vo;u)tetrif3oo1fm ranvil(0 etm(m ou4am nmfvtat sDurxm ;t4opto o3iasfa2uan snu)alxrmf3iy1lpDeaivo ()t2xoxrpoudomt lfcsa()a2tr(mpou1tptniieiytls em(mp;t)aeenmrctytom eanvo (0s2uoxo nydome liet ( s2tax ont0olenioetad sDem(ms;u0 etnir io1optr ivs;() eurxo oydapt lncsasfarumu ooo1oeto oeildfm um( p (4tltoxrcoydomDeluvils0seumirpnudamenmneia(  Drr(m ;o1tlxoif3ild s rmuvo u4 renxo io1omDe nvsl( trurirpiudop e fvta()artau o;o0tlen octasfmDua( s t0aexrirciytlmDr n i;t t2ur(o3ny1opte feilt a2ur(rp;t1opx ii3iad a uau o;u4tltrxr3ia1lpte u slt0trxm(r3no1apeelfeta(fa2rmxmo;u4tpeo ociydls umnvpn(4 reniocio1omDr uei s truo(m nu1lmenmfcsasfarrm(mp;u0opxnii3iytfa uaums;t0teenmo tydopDraues;s) rum(m iy1om nlnvtltf 2rm(mo;o0optoifctltlmDulums u)tlxrxf iy1fpDrau i ( trtmir oudol nlfctl( s2rr(monu1oexniictlslm2uau p (0 lenxf totfmDrliei s)t2xr(m iydomenmfvt (  Dum(mpot1tpto feiltla emumo u)altnmr iy1faDranes ( trxm(r3no1am n ivsa(  Draxrpou0ole mieias a ua(vsnt4trxnmo3todlpDeaneo s)texm(o iy4ale lfeia( artr(  ;u0tee mfetyd a2umn s (4 rxrmfciodop rlues;s  exo(mpou4oleelfvtl(fs2rrxr ot0apxnmicilsla2umumpnt) etoxr iydfm ranvo;()trtrxrpiy4ape lfvi t)s2tm(r ou1olxomfetldlmDemnms t4tlxoxo3iy1fpD  nvi;(0 rxrio oydam nmfvi s) Dur(mono4tlxomoctatla2el(mp u)teermo3oo1fm  lueo s)srxoimpoy4openliesat)aDtm( pno4olxoioctyd mDean sn()arxoxr oadfm ranei t)t2xm(opnu4lmte nvta( arur(moot1tetnmf3ilt s uluvo;(0 eeoxocoatoaDelu i;t)s2tm(r3oudopt  ivsasfaDtrxmpot0aeeomieilsfaDean s t0 etnif3oytlmDeln i;() eum(r oo4lme mictatfaDumxm ;u1tpt moeils m2rlu o;t) etrxo3ty1latran s ()seur(m io4op n icsasf rrm( ont4opt mieiydfm2rlu ont0teerxocoadlmDraueilt) eumxm iu4ol   ncslsfs2raxronu1optoif3iatla2um( snt0alxoxf3oatlaDrln ols) eurxr3nodlpeemnvia(fsDtax o;o1oeeniieildfs ea(vp;() leoir ootfa e n ol() 2toxopio1ame lfeiat)arra(rooo1teeoio3iydfa2umn o;u0 eermrcoytfmt aivs;s0srxmirpiydom e netlt arur( pno0altnmi3iydla2emuvp;(0 reoxo ty1lmD an i t) rumxr oydopen icsat)s2umx  oo1alen feiyt mDeaumo;(4alxnmf oo1lp raivslt)srxmio3nodamt mivil() 2rr(mpou4aptnmi3ild mDul(mo;u)tlxrio oatfa r nvsls0t2uoxo3nu1opee fcs (f Duau  nu4apt iiciat aDumn p (0artrir3iatoa  lnvs t0teumir3nu1lm elnvt t artaurpno0aex iictasfm2ea(vont4 rtrxr iydfa r ivi;(0truoiopio1lme mfcia(faDrr( poo1ale  f3iytlm rluvpnu4tetrio3to1la ranvi t)t2xr(o3iu1ll nmicil(fa2ta(mp;o4tlxnmociydla2eaumpn(4texoio iadlatran ols)sruoirpno1lmenmnci tfsrumu ooo0olxoifeild sDelu o (0artnxfciy1fmD  ivi ()srtmxr io4amtnlncilt  Dta(r oo1tpx io3tlslm2ranvp (4tlxomr3todom  aies ()texo(r nodamt  fcs (  rrrur nu0apxo i3tadla2eauvon(4trxoxrcta1fmtelivsls teuoxo3ou1om e nvs sf Draum ;o4aexn fetldfaDrmn s;t) rerxf3tydfmtr i s;t0 rtmxo oo1ll nmfcs (farumum ot0opx  icilsfmDrmnvsnt0trtrxociodfa r ieo;s srxmirpoy4oleelivsas) rra(m nt4aptnmfctltlmDemuvp (4aetrxo3totomt  ivolt)texr(o iy4lm nlneta() Drmx p;t0aex  ictltfs2uauvon(4 lermo3io1fmt aneo;() exoir iu4alenlfes (faDumxmoot1aexnmfeias m2rmumont4trtnxf iodfaDr n s ()srxrxo io4apenmfes s)srrrxm ;o4ale  octlt a2rmuvo u0tlxnir3oa1omteauvi (0srtmxr3nudop   fvtas  rrmxmont4openmoeiadls2rl(mp u) eeoif3io1omtr uvs (0 ruoio3ou4lmen ict t aDurxr ;t1aexomo3iasfaDumn on()trerif3iytoa rlivo;()tetmio3nu1alt  fvil()arua(ro;o0tpx io3tad mDemn on()altoxf ia1faDeanvs;s) etrxm3iudal e nvsl()sDur(m oo1apto o3iatfa rmn o;u0 rtrmocootfpDrlivo;t)trxo(o3nu1lleemfesl()a2urxr ou1olt moetytfa2um(vpnu0trxoif oatfm  li i;t)truoxopnodope mfcsat)a2uaxrpou4alxn oeildlm2ra(mo t4arenmo iodoa eln o t  rxoxrpoudlme  netasfa2uaxmonu0alt  f3ils s2emumsnt4tlermo3iy1opDr uvsls sexoxr oydol elicsl(fa2ururp;o4tetn i3iyt s ul(mo;(0artoio3iotom e u sls0t2xo(mpio4omtnmfet sfaDuaxr ;u4tet moetas s eanvs;(4aeeoxociadfmtrlu s s0tetr(r nu4ome mfctatfsruaxrp;t1tetniieiytfm eanmo t4arerxf iodopte nes;t0setm(m3iy1amt lnvt t) 2uaxmpnu1alen oeiys aDrln s;u0trermfciy1lmte uvolt)s2xmim nu4aleelivi t)s2tr(m ou4oltnioeiatlaDum( pnu) rxrmo3totlpDe ivo;s0t2umxm3iu4om e fvs sfs2tauro;u1oex mieiydlsDua( p ()trxnio3iodfm ran o;()s2um(rpio1oltn iciltfsrtrx  ;u1aeenif3iatlaDra(mp;t)aetrir to1oaDr u o s sexoiopiu4lptn nes (  rtruro;u0tpxoioeildfaDulnmsn(0trxnmocoodopDrlueo s)s2xoio3oydll  mfcsls)aDraxr oo4apxoii3tadlm2rmump;u4aeermfcoy1fm elneil() rxm(o3io1alee neilt  Drrxm ot1tex iieils s um(msn(4aexnxfcoy1lmD li i;s0seumxrpoo4apenmnvta(f Dtaxmoou4olx  fctys a ean s t4tltnir3tadom elueils)trumxm iu4amtelnci t sDtmx p;t1tlt  o3iydfaDraumonu4trxoif3tydoaDeauei s s2xoxr nu1lmt mietl(faDurxmonu1olt iiciyslaDel(mp;()tleoir tadopteluvs;t0 rxoim io4al e nvs (fsrtmxmpnt0tlxo fcils s2ran o (4alenif tydfa eaieolt)tetm(o iodapt  fcsas aDua( o;u0alxniictydfm um(mo;t4 lxomr ta1fm  ln i;s0t2urxm3iodomtelnvt t) Dtmu p;t0aet mfetytls ranvs;u)alxoif3iytlmtranvs;t srto(m io1lpen fetl(faruaum ;o4tlxnmfciysfs emuvpnu0teerxf ta1fmt au o ( texm(m nu1ape lieiatf 2rr(mp;u1oee  oetatla2umuvo (4aleomf3iy1fp  lnvi;t)trxm(r3ny1om nmiviat) rraumo;u0texnif3taslm2rl(vont0altrxrctatfmD  nvo;( t2tmim3nudom   ncs t)srurxroou1alxnio3iyslsDumumo;t4arxoxrctytopDraueo s)t2tmim iu1am elieta( a2umuronu4oet  fctatfm rlnvp u)aeenxr3oa1fm eaneo s texm(o3io4lm nlivt t)s2taxmo;o0aet  ictlsfsDuauvo;u0 etnifcto1lmtranes t)t2tmimpoy1openlncil() Dtm( o;u4ole  f3tadfaDemums t0arxomo3ty1fmtrai i s seumxmpnudaleemnet ()aDtr(mo;t4opeoiociltfaDrlu o (4aeenif3ootomtean s s) eto(r ou1omtelivt sf Dtaxmpou4oetoiietyt m eaumo (4arenif iytlmDr nvo s srxmxmpno4am  lnvi s artaurp;t4aexo iciatlm2umnvs;(4aexnxrcty1omDeau o t trtoir nu1lltnlieiat aDrr(mpot0tetnmoeiadla umu s (0aeenmf3tydfpte u i (  euo(o3no4openmivs (  rum(r ;o0alx mietlt s2ul(monu)artrxo3iatlmt  n slt0 exoimpiu4optnmfeils arumu poo0tlt ii3iatlaDemu pnu0tetnxf3oytfp   ieo ( s2urio nudaptemnctls aDuaxr ;u4opeo oetatlaDra( snu) rerxr3ia1oaDrlu ilt)tetr(opnudlle lneta(  ruau oot0oleniociydfs2uaumo (0trxnxfcootopDrln i s)t2trxr3oudamee nvt (  2tr(m ou0aleo ociat aDemumo;u) leoio oo1fa   nvo t) 2xmxmpiydlmtnmncias a2rrxmpnu4tpto oeild m rlu s;t0 rxnmocoy1lpD ai il( sruoxrpoo4openmfciat a2rrx pnt1aetnif3iysfs rm( onu)arenmocoytom elivi;s s2xrim3nodom   iciat)aDta(  ot0altniociatlm ra(vo;u) ltoxr iodoaDraneolt)sruoxopny4ol e nvtas)a2tmxmooo1aptn fetldla rm( pn(4 leomfciy1fmDrlueolt  2trio3ou1altnlnvils) Dum( o;u0apenifeilt sDemnmonu4 lxnirctydfa r n sl(0t2tmio ny1omtnlfci (fs2rr(mo;t1tee  ociytlaDra( p;(0alxoir3iy1oa rlnes;( srtmir iodapeelictlsfa2rrxmoou4aee mo3iatlsDem(vpn() renmo3iatopt aneo;(0 2um(rpny1opt lict t aDraxm oo1aleniocilt mDrl( ont4tetrmociotlmtr ies t) eurir nodopen nvsa(  Dum( p;u4tex miciysfa2ra(mpnu0tetrif3iy1oaDraiei s0t2xo(r oy4ll elfvia( aDtaxr ;u0oeeoio3iltfmDel(ms;t)arxoif3iytfmD  i i s)srum(o3iudlptnlfetat)aDrmu pnu4ale mfetyt m2ua(mp;t0 eenmocootop r neol(0texo(o ou1lmee iciasfs2ur( ono4aeeo ieiyd s em( s;t)alerio3iytomDraivilt trtr(r io1lpen iet s s2tmxmooo1alt  iciyslm2rmn p;()alxrmr io1fpDeanes ()srxrio ny1alenmfct tfsDrmx  nt0oltnioeiasla2rmn s t)teenxfciytlm rauvo;( s2tmir3oydomtnlivsas)aDrrxr oo0opx  fctadla2rm( o;u4trermoctotfatr i ilt) 2xr(opoy1llen fvs ( srua(r ou1olt  fcild a2eluvsnt)tetoir3to1fpDeluvs ( seurio iy1ole lietls)sDuaxmont4tpxoioctlsla2umumont0 rerxr to1fpD  ieilt)srtmxo ny1llenmnet tfsrtaxr nt1apxnifetld aDulnvs;u)arerxf3ootfp elueslt)srtrim iydopenlnet () Draxmo;u0optnifctatfs2emn s u)tltrio tadlmD  i i;t  rxrirpno4apt lfet ( aDra( onu4aeto iciatls2ra(vpn(0alxrio iydfat au o;s)trxoxrpoodoltelici (fsDua( ooo4tee ifeilt s rm( o;() lxoxo oadfpDeanvilt)trumim oo4llt  nci tfsDur(roou0tpt if3tls s2uln o;u)arxomo oytoptr ues s)trtmiopnudope mfet ( srua(rpou4oet moeilsfmDuanvont) eeomr tytfmt livolt0 rxoiopoy1am e nvsa()aruaxmpoo1texomi3iat a2ulu onu4trxnio3oa1lateau ilt) 2xr(m iodape licsl( artaurpno4alt iieiad m ra( sn(4tltrxr3oatop  luvs t)trxmxm no4ap n nci s) 2uaxronu4olen ietldla2umnvon(0tlenmrciodlp  au s t0t2urxrpou4alt licil( aDurxrpnt1ale  i3ildfaDulnvont)texrio iodoate nvolt0t2xo(o3oy1lm  lfvias  rrrump;o0tpeniieils aDem(vpnu)trxnmfcoy1lm eluvo;s trurim3ny1ap  mfes (f Duaur ou1alenmfctydlsDulnmpnu) lxoircta1fa  an s () exmxrpiu1lltnmfes t)s2rrurp;o1alx  fctls m2emuvsnu4arenmrctytfp r u s;(0t2um(m no4ome mics s s2rmu pno0tpeo iciyt s umnmo u) etrmo oydom eluvi;()srumio3ny1ope lfeil()sDuax o;u0texn fciysfsDuanms;(4alxnxrcia1lm e uei () exr(m3iydol elnctls  2rm(r no1oet  o3ils a umumo;u0 renxr oydomD  ivs;(0seurio iy1olen icils sDumx o;t4aet ifciatfsDumn o (4tetoxfcoydlmD  u o s)s2xo(r3io4ap e iei s)a2tax pnt4oltnioctad m emnvo (4tlxrmo iatoa elivi ( s2urir io1aptnmfetatfsrrmur nu1openmi3ilsla2ra( p;t0trerio oydomt  neo ( srxrxopiudamtnmnei (  2rmu ont1tee  feiysfsDrmu sn(4artoxocta1oaD  u olt0teumxm3ny1amtnlnesat s2urxm ;o0tpxn feiasfa rm(ms (0 exrxrcoadom r i sl( srxm(r3oydopeemfci tfa2urum oo4aex  f3iys a ra( pnt4texnmr3iatopDe uvo;()t2xo(m3iudame lfciat)aruru  no4alt mo3iydlmDuanvp t) rxnifciodlm rau o;() rxrirpny4omtemivils  2tmx  no4tleniiciadlm el(mpnu0 eeomo3tatfa r iei t0 exo(o oy4ll  mfeils)aruax  ou0apxnifcildls em( s;t0aeenmocto1om  aueolt0 rxmiopio4amtn neilt arurxmoou1tlt  ieilsla2rmnvp (4aetrio iotfa  aues;s trurir oy4omeelnetlt aDrrxmpnu0tle mfciadfm2ulumo;t4trxnxf3iotlm e ieo;t)seurir3oo4lle mneilt)a2rm(  nu1tetoifetlslsDulnmont0 rerir io1fpD lnvolt)setoio3nydomtn nctat) Dtmxr ou4teenio3iasfs2rlnmp u)alxrmrciatlpteau i;s  rxmxm oo1lmtemnetlsf 2um(m ot0tpx iicild sDra(msnu0tetnxr tadomDeanvil( s2tmxopiy1lpen nvilsfa2ta(ronu1tpe  o3ildlmDel(ms t0trtoxf iadomtranei (  rtr(m nudll n ics s) Dtmuroou1oltnioetlsla2ea(mpnu0 rtrif3ootoa raiei;(0 rxoxm3oy1al nlivt (  2umum nt4tpen ieildlmDrmnvpnu) exrmr tytoatrlieo;t  2tmir3nodam emivsas  Dumuroot0tpxnii3iasla rl( o;t4 eenmf iotomDelnvo;s)trxo(r iy1ll  livs ()a2uaxmono1ope  oetls s eau o u)aexoioctotfmDrauvols0t2uo(r oudameelnvs s  rtm(m nt1tpxomf3tytlaDua(vo t4aexoxo oy1oaDeai s (  ruoiopoudlpen fvs (  Dum(r ;u4texnmoeiadfaDrauvs;()artnxr3oo1oateln sl()t2um(m3ou1omtelnet (fs2rr(mp;u4tlt mfeiys sDumn pnt0trenmocia1oa  an o (  2tmir nodoptnlicsl( a2tmu ono0aet  i3tltla eln s t4 eenxocoydlm rauei t)tetmxm ou4lm nmiei s  Drru oou4tetniociasfmDranms u4 lxrmf oy1faDe ueol()t2xoxo nu4amen nvs s  2tmxr no4oexnifctltla2rlu o (0tetrif iydlatrlies;s0 etmio no4opt livt (fs2umuront4ole iieiltlm2ra( s;u4arxnir tydomD  neo;t0srxmxrpoudaptn fviltfsrtmxront0ale  fcias m eanmo u0 eeomo3iadfaDelueo;s)trxoxrpiy1am   ivi tf rtmu pno4oex mictlt s2ulums (4 reoxf iodfa r i ols)trxrim ny4lltemfvt () Draumo;u0olenifeiad s2umnvs;u)aleoxrciydop e nvi;t) 2uo(m3nu4altnmnvilt  2ta(ro;t4apxnifetytfm2umuvs;u4 rxrmfciodfmt an il()s2to(r3iudop  mivsatf Drr(r no4oeenif3iyt a emnms (4alxnir3oadlaDrluvo;(  2toxo iu4omtelfvtlt)s2taxroou4tptomoetaslmDuan s () ltoxo3oodoptr i i s s2um(m oo1lltnmfei s  Dtm(m nt0aptomoeiyt mDumn o;() ltrmf3tadom rln s t  etrxr nodlp   nctat  Dtrxmpnu1opx  ieils mDem(vo;u4tlxomf tatoatr ivi s s2ur(rpnudopeelfetls) Dtmxmp;t0olxnmieiadfa2ulnms u4artnxo ta1fatr neols  rtoxr3nu1ale lict s)s2urump;t1aet  iciadls ul(msnu0artrmr tydfmD  nvo t)s2toxr3iodolenmivi (f 2trxmpnu4tlx if3iytfa2umnvsn(0trtoio tytlmDe ivs;(0trxoxr3ny4lp elnci tfsrta(mpot4opeomfciad a2ea(vsnu4 rtoxoctodfpD  ueo s)s2xrxm oydol elivsltf Draurpnu0tptnmiciatfm uluvpn(4 etomr3iytlpt an ol( teurxo3oudom nmieils)sDtrxmo;u1aet ii3iltlmDulu s;t4teeomf ia1fa eluvils0srto(r oy4ame mnvs s) 2umx pou0tlenioeiadfs2emump t)arxoxo oatlmD  ivi (  exrio3nydome mfvsa(  2ta(rpou4oexnmociadfm ua(vpnu0teenmo io1optranvol(0 etmiopnu4ome miviat)srtmumpou4apt  o3tadfsDea( o;u0trenxo3ty1la  lneolt)teumir3oy4lmt mfvtl(  rua(  oo0tlxnifctls s2rlnmon()tetrmr oydfaD ai i (0t2uo(o3nydalt mnet (fs2tm(rooo4aex mi3ilslm2ran p;u0 eeoxocoadoa  luvs;t0setoxo nodamt mictlt srta(rpnt1tlenmocias m2rm( on(4tl
\ No newline at end of file
@@ -0,0 +1 @@
+uvi t0 rtrir3nu1lmen nvsasfsDta( pnu0tpxnmi3iytfsDumu o;()trxrxr oodfmtr neols0seto(o3iudomtn ics (f rtaxmp;t1aexnii3iydfmDra(vsnu4aetnmo totla eln slt) 2umxr3oo4ol n icslsfsrtmx oot0oeeomieilsla2el(vp;t)aeeomf iotlaDrauei s0s2uoirpnydll nlnetas)aDrrum oo4tlt  f3iysfm2rlumpnt4arxnxoctydfmtr ivi;(0trtr(o3nu4al nlnvi ()s2uaxr ot1teeomf3tldfm2el( s t4tetomf oo1lateaueol( trtr(r3oo1ape  fvtas  rrau oot1apto ietld mDrmn o;u4tlenmo3oatom ran o;(0s2uoirpoo1lmen feilt)sDrm(moot4aeeomoeiad sDeluvs;t0teenmfcoodfateluvil( trtmxo3iy1al e fciat) 2rax pot1optnio3tasfmDrmnvo u)aleriocio1fatean s;(0 2xo(r ny4lm  mfvsl() rum(mooo0olenmfciasfm em( o;(4alxniocootlmt  ivslt) euriopny4am elivs s) ruax  ot4tee moeiat aDraump u0treoxf iydomtrauvs () 2trxr3iydal  mivilsf rtmx pot0tlxomfciysfsDuaump t) ltrxo oydoaDrai ols) ruoxm nodomee iciasfarraurono0ope  f3ilslm2elnvp;u4 lxrxf to1oa  lnei;(0t2uoim3oodom n ivsas)srrr(mo;o0tex ifeiltfsDelump;t4alerxo io1oa eaueol( t2uo(o oudol  mfctatf rtau poo1oltn ociys m2uau p;u) renmo3oa1faDr uei t0teurxm3oo1lmen fviat sDtrur ou4open ictaslm2el(monu0 rxrxr3oydlm ran i t s2urimpiudome  ncs sf Drr(m ou4aee if3ils a ra(mo;(4artnircta1fa  aneol( s2xrxr nu1lptelnvs s) rrmur ;t4oetoifeiadlm2eauvo () ltnxociodfm eauvslt)srxm(m iudop nlnvia(  Dtm(root1tet mo3iat m umuvpnt4teeoirciodoatrai ils)t2um(m3oy1amee ieslsf 2umxmo;t0tpeoiictadla2emn o u0tltnmrctadfp  an s;(0srtm(m3nu1al  lncia() rururooo1tpeomo3tld s rm(vpn()aexnmf3iadla ranvi;t  etrxopiodaleelnes t)arraxrooo1aexn ocildls elumo;()alxnir3totlpD  ueols srtmxrpoy1apeelivtls)s2ua(  ;u1oex mictltfs um( p;(4tlxnmfcty1op  anesl( trtrxr nu1ll  lfvtls)s2urumo;t1aetomo3tydlsDrmn o;u0tetrmr iatfmt  u o;t)tetrxopnudop   fci s  2rmur ;u4oeeoioetldfa uanvs;t)aeermr oa1lptraies s0t2xo(m3oudlp nlncil()srumxmp;t1opx  oeiat m2ean sn()trtomfctodfaDe nvilt sexmxmpnudam   ici (fartmxroot4aee ifeiyd aDem(vs;(4altoxo3totla r nvo;s  exoim ny1alee ict s) Dtrxr nu0texomo3ils m2ua(mpn(4 etnmo oydfpteaues;t0srurxo3oy1omtelfci sf rtrumoou4oeen fetys sDulnms;u)trtomf3iydfpDranvsl(0 rurxr oo1omtemfcia()sDtru  ;u4oexo ieiydfs2rmnvo u0trtoxrctydfp eau sls tetm(o oo1lpt liesltf Dum(ro;o4teen f3iadfs el(mp;t0arerxf3iatlp   nvs s0srtm(opiu4amenmivia(faDrrx pou1tetomietltlm ulumo;t4teenio oydlmDeaneol(0trurim3nu1lptn ivtl( aDurxm nt4tltn oeilsls2umnvo t)aexrmo3iadfpDeanvilt tetoim3oo1altn fet t arrm( ooo4tle  oetlsla em(vont0tleomf io1lp  anvs t  eto(o3iodome mfvtlsf 2rm(m nu0oex io3iyt mDulnvo;u4tleoxr3oytoa r nvolt)s2um(r oodop emics ( a2um(rp;o1tleniictyslsDrl(vs t4 lenxf iodfm rlueo;t)trxmim nodam  mnvsat) Dur(ront1tet ii3ildfs2emnmp;u4artrmr to1fmDrauvols)sexoir3oodlm emfesl( arurxmp;t0tpen i3tatfa rm(vp (4aeerif3oytlpD luvi s s2tmir3oo4olt mnvtatfa2rmu  nt0aeto ieiltls umuvs u4areoxo3tytla elues t)tetrxrpoy4oltnmfci sfaDtrur ;u1tle  fciysfs2rm( s;t) renirctotlpt ai sls0seumio ny1alenmncslt aDtmxrp;o1opxnmictldlsDrmnvs t0 reoiocio1oa r neo;( trxoiopnu1apte nvtls)sDra(mpnu1altn i3tad s umnmp;() lxoif oydomDeaivo ()s2ur(o oy4ameemivsa()srra(ro;u4aex ioeiyslmDeauvo;t4 lenio3ootlaDraneslt) eumio3oo4op  mnci t  Dtru  nt4apt io3iatfa2umuvpnu4trenmociydlp r ivi;s0 eurio no4ole mfetat arurxro;u4tleomieiysla ra(mont)trxoir tydlaDr i ilt0seuoxr3nodaptemfciasfaruaum ;t4ape ioctad mDul( p;u0tlxrxrcio1omtr ueo ( s2tmxm3oodameelfcsasf rtm(mpoo1tptomo3tatls em(von(0altrxf3ootfm  luvi;t) 2tmxo3nydlme mfei s aDumum ou1teto octyslm2el(vsnt)texnif oydlatr n ils  exmxr3iy1ol nlietasfsrta(r nt0oex  i3iasfm rm(ms;()teerxfcoa1opDelu s;s trxrim ny1altn fei tf rraxmp;o4opxo feiytfaDrmn s;(0 etnxo iytfa  auvo;s  exrim no1ap e iesa()arrru o;t4aetnio3iatls2rm(vpnt0tltnmrciodopt  n o s)t2trio iy1opt mnci sf 2tmx  ;t0olxo fciydlm ra( s;t4 eenio3oadfpD  ivols0srtoim no4lpe  ics tfa2uaxm oo1alenmf3iad s ra(mo t4 exnxo3iy1opte n sl(0 euoxm iydol  mieils  Durur nu4oleomiciat mDrlu on(0 lenmr3oatfa e neslt srurxo3iu1ol  lfctatfarur( pou4tptn feiys m2elu pnt0tlxoxo oatomtelu s;s s2to(m3nudalte nci sfa2ta(rooo1ole mocild aDelump u4aexnif iy1lmD livol()t2umxr nudomeelfct t s2ta(mooo1tltnmiciytfaDel( p;(4trtnxr oo1la  an slt  rurxr3iu4amtelics (fa2ta( p;o1alenmoeiadlsDemuvont0alerxrctytopDelieslt0t2trir oo4lp   fctls)srraxmoot0tlt ifctltlm2umnms t0teermfcoydom   n o s)srxo(r3io1ol  liei s)a2ur(rpnt0opeoifciydfs el(von(4trxrmfcoytoaD aueslt sexrxm no4omtemnciasf Drmxr ;o0opxn i3iltfs2elump;(0 rerxo3to1op rlieo (0texriopou1olenmivi t)srrm(m oo4aexoifctat s ran o;(0aetnif3iytfmDrlivs s s2to(o3nodol n fvslsfartrx pou0opeoii3iydls rluvs u)teenircoytomDrlivs s srxoim oydamt lfeiasfsrtmx ooo1oexoii3tydls2um(msn(0 exniocto1lm   nvo;t0texoimpiudolee fetatfaDrrur ou1oeenioctat a2eanvs u)texnirctytfptr uesl(0srxr(m3io4al e fesat)arumu  oo0olxnioeiat sDrlumo t)arxoif ia1opD aues;t0s2xm(opio1om emfei t) 2tr(moot1alenii3ildfm ea(vont0 etnxo ta1fatrlivsl(0 rumxr nudapt  ietatfaDtru  ;u4altomieiat s2umump;() etrxr iotoa elneo () rxrxmpiudoleemicsas) Dtrur nu0tpt iictys aDrmumo;u)arenxoctadfm r u i s0tetmio oy4ame  icsltf Dtaxrooo0oexoifciad a2rlnmp (0 lerxr oo1lm  lieo t0 rxoio3ou1opt  fvsls)sDrmx p;u1tlt ii3tlsls2rl(von()altrmfcoy1lmDr i o (0srtr(o nu4olee ietas aDtaxmp;u1tptnii3ils a uluvp (0arxoxr3oatlp r ues;s t2tr(opio1llenmnvtl( sDtaxm ot1opt mocilt aDrm( p;t0 ltnmo tydfmt lnvo;()s2xmiopoodome  ieiat  rtm(r no0olxo ieiadfaDuln s;(0tlenxo3oodfpD lnvo s sexmimpio1lmtn ietlsf Dua(m ;t0tpx mietadfm2rauvo u) lxomrctytlaDeaivo;t0 2uo(r no1omtnlivsltf rta(  nt0tle  ocilsfs ul(mp t0treoxr oadlaDraues t)seumir no4olte nvtlt s2rruro;t1tlxnmfetatlm2umnvs u0arxnxrctytoaDrai o;( srxr(o3iodal elici ( s2rmxro;u1teeo o3iydfa2um( p u4texomoctadlp   u o t  exoio3iydlm n fcsl(fs2trurpou1opt ioctlsfm2uanvo (4 rerif3iotoatr n i;s t2tmxopoy4apenlfvsls)srra(ronu0aeeomieiyd m em(vsnt) etnxfctatfpte i sls0srur(mpiydop  mfcslt arrm(r nt4opx mieils a2uanvs;()trenmfcio1lmDelivo;t  2uo(r3oo4op elfcs s)a2ra(r nt1teeo fetatfsDrmuvp;u0 lxnxfcootoptr ueslt)s2to(mpio1apt  nviltfsDta(m ;t1ape  oeiatls2elump t)altnif oydlp   ueo;()t2xrim3ou1lpt mfetasf ruaxmoou0opx mfciaslmDea( onu)arxrmo iytfmtelnes;t)seurir3oo4ll   ies s)artaumo;t4aet mf3iltfs ran p;(0 ltnmfciodlptrli slt0srurxr oo1optnlncsltf 2taum no0apxoifciltfs rmu pn()teenif3tydlaD  n i;s  2triopnu4ape  iesl( aDtm(rpot4oleomo3iyt s2rl(mp;(0aetoxo3iotfp   u slt)t2xm(r iodllee nvsas srrr(m ;u0olxnio3iytfs2ea(mo;()artnmo3oo1oa  aueo;t  2toxm3iodalen fctatf 2tm(mpno0aleoif3iad aDul(mp;u0aetrifciytlptrauvs s) 2xrirpoydol elnvsls arraxrpot4opeomietydls2rmu p;u)tlxrio ia1oa ran s;s)s2xrxrpoodape livia() Dtr( o;u0oeeomoeildlsDrm( p;()tlenmr3tatfpD lu s s) rxm(m3iudomtn iesatf 2ra( o;o4oetnmieiytfmDuauvpn() ltrircio1faDraues t t2urirpny4ap nmieias aDtmu pnu0opxn fctldla2uaump;t4altoxo3tadlmtran il( s2umiopiy1omtn nvsl( srurxr ;t0apenif3iltfs um(mpn(0 rxrioctadfm rauei ()t2xm(opiy1ll nlfvt t  Dum(r nu4texnifciytfs2ul(vo t4 renir iy1lm elnvi s teumir ny4opt lics () Draum ou4teto oeiysla rau o;t0 rxnif tydla eanvs;s0trxo(o no4lmte nctas)s2urur nu0aet iicildfaDrlu o t0texrir oadomDrlu o;()s2umxo ou4lle  fvt s s2trxrpno4tltnifetydfsDrm(vo t0arxniocty1op  lnei;t truoir no1optelnvs sfsDrmxr no1olenmietls a rlnvp;(0 renxf3tytfmtranvi ( s2uo(rpoy4al emnvtat a2rauro;u1aexoif3iatfs2em(mp;()teenmf3iydla e nvi;s0t2umxrpoudom   nvtl() Drmx  ou0oltnmictatfs uau pnu0tlenirciytfmt auvo;t) 2xrirpoy1ol emiesa(f 2taur ot0olxo i3iad sDemu sn(0altnxfciodlpt lnes s)seur(o3iy4op emfeiasfaDuru ont1tee ifcilt aDrl( snt4tlxomoctotoa  luvilt s2tr(rpoo4omt  ivi t aruaxrpoo0ape moctat a ra(vonu4tltoxr iy1fpD  ueo s)srumxrpiu4omt  ncsa() 2rru pnt4tpxomicias s2eauvsn(4 renxo3to1fmt livo t t2xoxopoy4am e ies ( sDur(r ;t1opx ioeiys m2rl(vs ()trxrxf iydop  luvi;t)texoxrpiy4lltnliei t)arraumpoo1oleoio3iydfaDelums;(0 renif totlaDeaueo (0s2xo(o3oo4ame livi t) Dua(m ;o1oleoiictls aDumuvsnt0 rtoxf3to1lat lneo;t0 etr(m oydop emieils s2urxm no1texnmo3iat a rl(vo;u)aetriociadlateli o t)srurim3io4am  livsas) Drr( p;o4ape mfetltfm2rm(mo u4 ltoir oadfpDelnvo s) 2um(mpiu4lpe lies (  rrauro;u0optoiiciaslmDul(vo u4arenxf3oy1lmt au s;s s2tmxm3oo4ll nlncsa()aDtrxr nt1altn ieiytlaDelu sn(4 renxrciotoa  ln s ( seuoxmpnudoptnmfvslt  Dum(mpnu1tex iicild m2ranvp;u4treoircootom r n s;s0 euoxmpoy4om nmnctl( artr(roou0oexn o3tytls elu s (4 lerio3oytlmD  ueslt0tetoxm3oodlpt lnet t)srtr(r ou4apxniocilslsDul(mont0aexrmociydlmtrlneilt trtoimpoydalt  ivsat) rurum nt1oetnmieiys m ulu o t0texnmrcoytomtrlies;t0trumxopnydlp n iesa(  2uaxmpoo0opxo octatlsDul(ms (4aexnifciytlp e ieo;s)trto(r3iy1ope  feils) rrm(ro;t0ope if3iltfm2um(vo ()tetoxf totlmtelu o;() 2toxmpio4apenmicil(  2tru  ;t4tptn feias aDumumo (4texomr iy1optrau o s srur(r no4omenlneias)artaxr ou0tle  ocilt m2uan s (4aleomo tydomt au slt) 2tmxo nudamenlfvs tf 2tau  ;o0tltomieiys sDemu ont0 eeoxo tatfpD an o () exoxr iydol elivi s a2rmu  nu4tlt iiciyd sDrl( s (4 ltrir iy1fm   ivi t0 etoir nodopeemicils  2uru pou0olt iociadfa ulumo;t4arenio ia1omt  i i s)s2tr(rpiudalenlicil(fs2ta(  oo4opeo oeildlm umumon(0 lxrxf iotom r ies (  euoio oudop   ivtat)aDrmumpot0tet io3iyt a elnmonu4trxnmr3oytfmtraues s) exmimpny1apeelnvils)s2tmumo;t1aet iietltlmDemnvon(0texnif3oydomDrli s;t)trxm(opiy1lpe mivt tfsDumxmo;u4tlxo o3iatls emn o u)trtnmfctatlmD auvi t0 2ur(m oo1am n ivtlt aDrax pot0oet  i3ildlm2uluvs t0arxrio oydop e i s ( tetm(m3io1am elfvi (  Drrurp;u4tlt mfctysla2em(mp u0 lenirciy1fpDrlnei;s setr(r io4oltnmiei ( srraurp;t0oexn i3tytfs2ua( p;t0teermrciadoatr i olt  2trirpio4om nlici sfs2um( o;o0tlxnmf3tltfaDeaums;(4altoxo3iytfat lu ol(  euo(mpnudale lnci ()aDuaxr nu4tptoiiciyd s2em(vpnt0alenmr ty1la eai ilt0trtmxmpnydlmte ivils arrru oou1tet mf3ildfsDrau snu4tltoir iy1laDeau i;t) 2ur(opno4op e fes () 2rm(rpno1aetn o3iadlaDrmuvpnt0 rtoxr3iy1lpt  ueo ()s2xmxmpiodal   fvs s srum(ront4aee  iciydls ra(vpnt4trxomr io1omDrau o;() eurio iydlpe  icsl( sruaxmooo1alen ocilt s2eluvpnu0aetrirctytoaDelnvo t  eto(opnu4lmtnmici s sDrrx  ;t0tetnioeiydfmDeln o t0 rtoxf oatoaD  nvs ()t2xm(r3ou1aptelfeias aDtrxmonu4apeoioctad aDeanmp;()aexoxf3iadop rlueil(  etrxm iy1ol e ietlt) 2rm(  ;t1ole mfctlsfs2rmnmp (4trtrxo3totfat aueolt0s2uoir iu1ale  iesa(f 2uaumo;u0apt io3tltfsDrauvs;u0 eenmo iadlpDrau ils0 rtrxo nydol emfct ()s2uaxronu0teenifcild aDemump;(4altnif3tatoptr u s;s)trtm(r oodal elivtat)artmu ooo0aetnif3iaslmDuanvpn(0 eerxo iotla e iei;t  2tr(mpny1am e nvil()artau pnt0olen ieiasfa rauvs;t4altrmr3oo1oat an s t) 2uoxmpnydlp  lnvi s s2ra(m ou4aleoiieiydlsDuanmont0alxoircia1fm ranvil( trxo(m oy1llenlfvsltf rururoou4teeniociyslaDum( o;t4 exoxf iy1fmDr ivs;t)setmirpno1omeemfct ()arumumont0apxo ietlt aDemump ()aexrxf3oo1op ranvi s0texoio nu1olenmnvils srumxroot4opt mieiatfsDum(mo (4 etoif ootlat ln sls s2tmirpio4altelivil(fs2rmx  ;u0teeoifeildfs elumpn(4 lxomfcoytfaDelueolt0trto(rpio4om  lfet ( a2rrxr nt4aee iietasfa2em( onu4aeenxo3ta1oa eln s s0s2umxm iy4opt  ieils s2tau onu1alenii3tyd mDemnvo;t4aleniocoadlm rlivo t s2to(m3no1opeelfetltfa2rru pot4alt mo3iat a umnvonu) reoxocoa1lptrlu s t srxoxm oo1amt mfci t) rtrxmont1oltoiociadfa2umums;u0trerxf ootfat luvsls)trxrxo iu4apenmnctls)aDrrxronu4tlxomociat sDrmnvs (4alerifctytlpt lneo;()teum(o no1olee fvi t srraxm oo4tpx  i3ildfm2ea(mpn(0 ltrmf3iy1fpD  n olt tetoim3nu1lltelnvsa(fs2urumpno1aptniicild a2ea( s;u)teenif iotop elu il(0 rxrxmpnu1ap   fes s)aDua(rpou4oexomi3iat m2raums (0aexoxf ty1oaD livo;( texm(rpny4ome  nvil(f 2urxmpno1altn ocilsfm2ul( s u0tlxoio oa1omDeaneslt)texmim iu4lptemiesas) rumum nu1olxnmietasls ea( sn(4 ltoxo oatoa rauei;t)s2urir io1ope  iciat aDtmx ont4oeeoif3iatfsDumnmp t4tltrmf tatlm  lnes;(  2umirpnydlp elivi s  rua(ront1apenmfeiaslsDra( o;()artrmr oy1om eln olt)texoio3iudlpe mfct ()srtmurpnu4aeeoio3ildlm2elu o t4tlxoif3oa1lateaivi;s0 2umir3io4amteliviasfa2ur( pou1tpx  ieiytfsDum(vont0 lxnmf iatomD aieo;t) 2xrio nodll  lfcs sf rtmump;t1aexn f3iyt mDelu s;u)altnxfctatfp   ues (0sexoimpou4ap elnet s  rumxrp;u1tlxnmiciasfa el( s;t) lermo oa1lpteluvi;s texrir iudlptelivil() 2taxrpou4alxoioeiytlm2elnms u0tlxnxrctytfpD  n o;()trxo(opnu1oleelici sf Drr(  ou4aetnmfeiyt sDuan pnu0trtoxo3ty1fa rlneols)srtrimpnodomt  nctl( arraxr no4aleo o3tlslm2ua(mo;(4 eerxo3iy1fa ran ilt0trtrirpno4oltnmieiat)a2ur(m oo4oeenio3tadlaDrmn p (0tltrxr iytomDeanei (0trtoxo ny4omtnlivtl( s2tmumont4tlxn ictls m ua(ms;()altrmrcoatop r nvol() 2umxm3oo4optelfcslt  2tmum ou1tpeo ociaslm emnmpnu0 lerxf3iy1fp elu i;s0tetmxo3iy1llte iei (f rrmu  ;t0tpxniietadlm um(vp;u0trxnxo3iodop rlivsls0 rxmirpio1lp n fvia( srtmxr ou1aexo ociytfsDemnvsnt)arxnmr oo1lp  au sl()s2umxr iu4llt miesatfsruauronu0oltn i3tls sDumu s;(4trerxf ta1faDe i olt) rumirpiy1al e fvsa( aDraurp;t0tet  feiytls rmuvpn(4aeeoircoo1la   n i;t t2urxmpoudolenmfcia()srumxmp;u0tet iocildfs2um(ms;u) lenir3oydlaDrau s;t0 etmxm3iy4ll e nvt sfa2ua(r oo0apeoiictld s umn s;u0tleoxo3todfaDeauei t s2trxm3nudopee ivi s a2uax pot1altnmieiaslsDua(vsnt)tetoir iotlat li o t texmxopiydap n nvt (fsrtrurp;u4apxn octydfa umn snt4 lxrio tadfmDelnes s0 eum(m nydapeelnvtas a2umum nu0tle  ociytlaDum(msnu4 exrxr3to1optrauesls texm(m io1lmenlfvia()aDrmxm nt0tlxn ieiyslmDea(vont4 lermf3tydlmDeanvs s)sexo(rpiu4omee iesa()s2urur oo1olxoifciysla2ul( s u)aetnxo oydlat  ivi t)t2tmxr3oydope lfvsatfsrurx o;t1apeoifeiysfmDean s;(0 exnio3oytfaDeln o t t2urxm3ou4opeemicias) rurx ono1apt iociyd s rm(vont)aetrmr3iydopDraieo;t)trto(rpou1am nmfcsa(faruau o;t0aexn ociyslm2uan o;u4tltrxr ta1lmD aivi;t  etoiopiydlmee fesas) 2uau o;o1aetn f3ildfmDua(ms t)tlxnxrctadlaDrlivs t0trur(rpoo1lmenmfeilt)a2ur(  nt0aptnmfeilsfaDemnvp t0 ltrirciodfpDeluvo t teuoxmpiu1llen nes ( srra(r ;u4tlx  icilt a2rlump ()alenio3iydlmDeaies t0tetm(m3oo1am emnvtls)sDraxr ou0tetn oetysls2em( s;u4 eerxfctotopDraivs;s srtoxopoudopeemnviltf rrm(mo;t4tpx ioeiys s elu sn() etoir3oy1omDe ivs t0 exoxm oodlptnlfvia()aDrmxrono0apto ociydfs2rlu pn(0alerir oytfatr u i t texoiopiydlptnlivt s  2rau o;u0aetoiociatfmDemnmp;()altrmr oadfpDr ivo ( s2toxmpiodapt mnctls sDrmum ot0alen o3iaslm eau s;u)trtnxrciadoateaivo;s)teuoxopnudlpte ncs s)s2rm(ront0olxoifciyslm2em(vs;()tetrmf oa1fa rln il(0teurxr nodlleemivsl()a2ua(rooo4tee mfetyd aDeauvp u) lermo3oytfa raieslt0srtrxm oodlmeemiei tfsrrrxm ;u1aexnii3tyt aDumn onu) etnxf oa1fat livils0 rur(o3ny4amenmnvsltfaDuaur ;o0apt ioeildfm emumo t)aleoio3iadfat  uvo;s  2tr(m nudap  mneia()aDtr( p;u0alxnmoeiytlm raump;(4tetomf ia1la eaivols) 2urirpiy1aleemietl( aDur(r nu1aleoiictadfmDeau snu4 lxoircta1oa eaueo s trxo(r iy4aptnmnvt (fartr(ro;t0optniicildlsDrluvo;t0 ltnio3iytfmte ivo s0tetmio nu1ol nmneiatfs2tr(mono4tltnio3iaslsDeau sn()texomfcoydla e i slt0 eur(opoo1alte ies ( srururpnu4apxomfciasls2rlnms;(4 lenmr3ootoaD aueol()t2xo(r oy1ap n ict t sDta(  nt1tetn ieilsfa rl(mpn(4tetrxf iodoa eln o t)setm(m nydopt  nvtat)arta(m ou1tlxnioctatlm rlu p u0tleoxf ta1fp e u i t0seurim3no1opeelicsasfarraum nt1oltoioctls a2ea( p (0trtomr oytfptrli i s0 etrir iodlpe mieiasf 2rrxmo;t0aeto ieiytlmDeaumo ()trxrif iytfaD  ueils)texr(rpio4openlietl() rtmu  ou4aex ioeiasfs2el(vp;u4 ltoxf tatlm rlnvi;s0 2to(mpiu1lpt  nvs s  rumx pou1oeenio3ilsfa ranms t4texriociytla elueilt t2toxopio4ap emnetl( srtmx  ou0alx  feiatfm2ul( o t4alxnmociadfmDeluvolt0 rtrim io4al nmiviat aDtrum ;o0aptoio3ild a rau o (0texoxf iy1lat li i s teuoxo3nu4lltemivi sf Drm(mp;u0alt mietasfa eluvsnt)altomo oatlm   ivil()trumio3no1altelivtas  rtr(monu1aexo ictltfa raump;t)aetnxf3iydlptrlnvol( trurim3ny4olen fvsas) Duaxrp;u0alen fctadfaDul( p;t4trtrxoctadoptrln ols t2urxo iudamee neilt s2uaxr oo4tetn oetadfm2elnvs (0tlxnxo3oadoa   nes;(0srxo(opnu4amenlfesat srrau o;t4aetomieiysfs uanmsnu)tltoir iytoa   ies ()sexmxm oy1amtn fcsat)a2tauroot4alxnii3iytls umu pn(0 etoir oydlpteaues;( s2umirpny4lm  lnvia()sDrrurp;t4apx  f3tysla ulump;t) renmf3iydlmtrlnei t s2xrxrpoodaltnmiesa() rrm(m nu1ape moeiasla uluvs;t)alxrxf3io1lmDr ieols0 rurim iy4lleelnci t artrurp;o0alx if3iadfa ulumsnu0aleoifcoo1faDe u o t0truo(opno4op n fes sf Drmumoot0tpx iieildlaDemnmp;(0 rtnmr3iodfpD  nes () 2uo(opoo4alenlnct s s2rr(rpot4tpeomi3iytfa rmnvs u0artrifcta1faD  nesls0 2uoxr nu1al  mfeils s2umxrpno0altnmfciadfm2ul( o t4aetrmo3iy1opDelu i;()sruoxrpoy1lm elfetasf 2rmu o;o0ole moctys a eanmon()aexrmo3todfpDeli i s  etr(opnu4al nmiei t  2rru poo0opt  ieiytfa2rl(msnt) ltoxf3oodlm e i s ( seuoxmpnu4lm  lnei s  ruax oot0tlt mo3tatlsDelnvp;u0 lermf3oodfmtr ieo;s)sexmxm no4ol   fct ( aruaum nt4tpto ictlsfm2rm(vsnu0alxnmrciadfp e ivol(0 rumimpny1ll nmneils)sDtm(rpnu4aex mf3tyd sDuluvo t0arenir tydlaDeau s;t0sexmxo iudlmee icilt artaxrp;o1alt mfeilt s2elnmo;() ltrmocto1fp rau i;t0 exmiopnu1apenmnvtat a2rmu o;u0tle  oeilt a ua( s (0aexrmrcoo1fpt  u i;(0s2xrirpoy1ope mnei s)s2ur(r ou4oltnifciadls2ulnvpnt)aeeoiociatlate u i () 2tr(opny4lpte netas sDtrumpoo4aetn i3tytlmDrmn p;u)alxnif3iadfmDr uvi s) rxo(mpoodoptnlnetls) rrm(r nu4tle  i3tydla rm(mp;(0trxnif3iytlp e i ils t2uoio3oydam nlfcsls) 2ur(mo;t4tptnmfeiasfm2rmnmp;t) rtoxfciadlpt auei (  rtmimpoudap nmnes t sDrmu  ;t4tlenmfciys m2eanvp;t4 lxrmf3ia1oaD anvs;(  rumirpio4lmt mnvils) Drax ono1opxnmfeils sDrauvs;t0teermrctadoateauei;t) 2urxm ny1omeemncils)s2tmuro;o4tlto i3iydfa rlnmp;u0altoif3tytfa  anes;(0s2xrxo3ny4oltemfct t) Dumxrpnu4ope moeiltls rmuvs;t4 ltnif iydfpDelu i (0 2tr(opny4olt  fvt t s2umxm ;t0oet  f3ilsfs uluvo;t4 lenxrciytopD au ol( srur(mpiy4amtnmfeil(fsrtrumpnu1tetomi3iytfsDuau snu4 rxrmf3tadfa eluei ()trxoir3iydlleelivsls  rtax  nt0aptoiicildls2emuvp t4altoxo oydopDeaiei t)s2ur(o3oodlmtnmnct t)aDrr( ono0tee  fetadfa eauvonu)texrxf3ia1lptelueols) 2ur(o3oodal emfetls)srtmum ;t1texn i3ildfs rmnms t4alerxr tatfp   n s s s2trim no4amenlfvtasf rrm(r ;u4aex mi3iadfs2uan p;u)artnxf oy1faDr ivo s  2toxr3oodalenmfcsl()aDra(r ot1tlxo i3iasfs ran on(0 renxr iy1opt livo ( srtmim3io1amt lncs sfaDuru oou4tlx moetatlaDul( ont0trxoxfctadoaDeauei t) rxrio3nudal elnvt t)sDtaxmonu1aleomoctldfa eluvp;t4 eeoifcoydlp  au o;(0seumxr no4alte fei tfa2ua(mo;t1tpt iieiytla raumo;u0artomo3ootfm  anvi;t) rxoim nu1op elnctls  rurx ooo4aexo fcildlmDuan ont4 reomf3io1lmt li ols)seuoirpou1apeelnes sfaDtr(mo;o1oetnif3iatlaDrau sn(0 rtoxrcoydlptelnvo t) rum(m ou4lm emicilsfarumxronu0aex if3ildfaDrau o (4 rtnmo tydla e u s;s sexriopoy1amenlicilt)a2uax  ou4aex mf3ildls elnvs;(0trtrmfctatopDrlu olt0teuoim ou1opeemfviat) 2urx  oo4aee  i3tydls2elu o t4texnir ia1lm  lneo (  eumxm iu4ome  fvt t)srurx pot0texnmfciyd aDumnmsn() eeomr iotfmDrlu i;t) etrxopiu4lpenmnetat arurxmonu1texoiociat s el(vsn()trerxfcoydlmt  iei s0trxmir oo4am e ncta()s2rr(m no1alt micias m2uau o t) eerxr io1oateaneilt0 rtmxo ou1optnlfvsl() Dtm(mo;t4ale  oeiad a2eaumsnt)trtomrcoo1fpDran ilt trtmxm iu4amt lfcsat  rrauronu0apxomoctadlaDea(mo u) rxrmo3todfaDr i sl( sexoir ou4altemfvta(  2trump;t0aptnmoetlslmDrlnmonu0 etoxf iodoaD  i s;t srtrir3oo4lpe lics ()aDrm( poo0olen o3tlsfm emump;t) eenmf3oy1fmDrlueslt  2xmir3iy4al elfcs t aDuax p;u4aeeomfeiatfs2rmuvpnt4aeeriocoy1lp eln s;()truo(mpiy4am   fcils aruaump;u0aetnmf3iysfm2umumon(4 rtomfciadomtrln o s  rum(mpno4lpenmiesltf ruau pnt0alenmiciysla2elnvpnt0 ltrmf io1lpte nes ( s2uoxopnudlp nlnei s)sDtaxmoot0oet miciaslaDrmuvpnt4areoxf3ia1fpt  n i;s0 etoxo io1om  miei tfsrtru  no1tlt  fetat s2rau s;t) exrmoctatop  lueo;t0 2tmxmpoy4ll  mnvsat  rtm(mo;t0tptn i3iadla uau o t4altnxocoydoptr i o s0 rumxopoydalenlnesl( s2raum nt1tpxomietldfm rmump ()tltomf iotfa rlieil(  rurim oydopt mneia(  rtm(rpno1aetnmi3tadlm emuvo t)arerif3iy1la r i sls)t2urim oo1lle mnviat)srraxronu4olto ocildfs el(ms t)treriocoytlmt auvs;()srtmiopny1om  lfviat)s2ra(r ;u0ole  o3iltfs2el(vsnu) eerxr3ty1fpD livs;s  2trxm3nydamteliesas)a2rrxmoot0aetnmictytls uau pn(4 eeomr3oodfmte ueols)tetmxr nydlm   ivias) rrm(mooo1teeomfeildls2um(ms u0teeoxoctadfmD auvi t0 2xmimpnu1ap   ncta( a2rmx pnu1aexo feiydfs2rlu s t) ltrxf oadlpDeauvo;t t2xmir3iy1ome  ivt sfsrum(rpoo0tleomoeiasls uluvo;(0alxrio ia1lmD aies t seum(r nodame mneiat) Duauroou1texniietatls2ua(vonu4 reomr3iatom  anes s0sexoxr3nudame lnei s  rtm( poo4ole iieiadfs2ulumont4 exoif3oodlpt au s;s0s2xrxm ou4lm nmfvia(fsDuaurp;u0aleomfeiyslmDuau p u)trxoifcoadlpt luvils0seuoxm oy4opte fcsas)srtm(mpou4oeeo i3iasls eluvont4arxoif3oydfatrli o;s srtoxm3ny4openmivtasf rtaxmoou1olto ictys m2elump t4alenmo3ia1fat  n ol(0 2xoxopnu1lpenliesls) rrrx ont1aeto icildlsDulnmp;t4 ltnmf iytfa   u ols0 euoio oy1ape  ics tfaDururpnt4oet  oetadfmDumumont4artnmr tatlpt lnvilt0 rtm(opnu4lpen ics ( arrruro;u4tet  fetltfmDum(mo;(4trxrir3ty1fmDraieo;( srxo(o ou1apee fesat a2ur(  no0olenii3iasls2uauvpn(4aeenio tadlp  li o s0 etmir nydlpe  nctas a2tr(  ot0apt  feiatlmDrmumon(0texrir tatlp ran ilt)tetm(m oy1am e fvtlsf Dtaur ot0aexn fctyd a ranmo;t0altoxfcoytoptrln i;s sruoxmpio1oltelicil(f 2ur( onu0tpeoio3iasfs rln p ()tetoircoytfptrlnei ( seuoio nu1ole lfvsatfa2umxm nt1tptnmieiatlm2ranvs u0arxrmr oytfpD au sls)trtrxrpou1amtnlfcslsfsDurx oot4olenif3iadfm uln p (0 eeoxo3io1fmD  uvo;( srtmio3nu4ape mnvilt) 2uru pno4tex  ieilslaDumnmpn(0treoir3iy1faD  ieolt srxoim oodal  mfetat  rrr(mpoo4aetomoctatlsDulu pnu)alxrxfcty1fpDe i s;t0sruo(m no4omtnmfctls srra(ro;u4tpxoif3ildfa rauvs;t0trerxf3ootomtrlieolt)sruoirpou1omtnmncsl() 2rm(m nu1tlx mfeiltlmDelnvs;t4trxnio io1omt an o;t)t2to(rpoydlm nlics s s2rru oou4tet if3iydlm umnmp;u4alermf oytlaD auvilt0trurim iu1am  mictlt) rtaxmpot0oeeniietat m2ranmo;u0trxnxr3iy1oat  ieils trxrio3iy1ap elfvtl(f 2trx p;o1tpeoioeiytlm2rm(mo u4trxrio todla e ivo t) rtrim iy4optemfcs (fsDrru ont4opeomictat m2eau o;(4trtnmf3oa1fmD  iei ( srtr(m no1llenmfetas)sDrax p;t4tpxo oeiytlsDul( s;()trenmr tadfateau i;s)t2uoio3iudale micta(fartru ont1oleoii3tyslm uaums;u4arerxo iodfa   nvsl()sexm(o3ou4al elneiat s2rmxmoot4tpx  ieias s um(vo u)tetoir3ta1oa e i o (  eumimpoodamtemnetat)arra(  ;u0tet mfciydfm2rmnmo t0aexrmo3totoat  i ols) 2uoim3ou1am   icils) Durx pnu0olt io3tasls2elump (4 reoxrcoytlmD  nes t0srtoxr oodlpe lnvsatfs2taumo;t4alxo ictls a uan p (0 ltrmo ty1omDr uvi () euoxm3oodapenlfetl()s2urumo;t1tlen oeiydlmDrl(mon(0 reoxr3oo1fp e ivi;t0t2tm(o3oo1lpe  ivi s)s2tr(m nt1texoii3tls s uau p u0 ltomoctotlmt au s t)t2uoxo3oy4lpt  fcils)aDurxm ot1opxnmfeils m ranmo;u)teerio3iadlpt auvo;s0setm(o ny1am nlivi ( artaump;u1apenmo3iasla2ra(mpnt) lenifcio1fm eaues s)sexoir3iudam  mietl()aDumuro;u4olxomfctad m2umn p;t)trtoxrcoadom  aiei ( texr(mpoo4lmtnmiviat aDrrx o;t1tle mi3ils m uau ont)tltnmo3oytfptrauei;( seuoxo3iudopte feta()s2ur(mooo1aleo ociad aDea( on(4trxrmr3io1fmt  ueo s0trurxm ou4olt miesas  rtm(r nu0aptomo3tat sDra(ms;t)aeeoioctytlmD au o;t)s2tmxr3oy1lmenmicils) rum( pno1oetomicildls rlnmo (0texnmo oatlat ln i;s0t2xrio3nu4amtelfvilt) 2trxmonu4aleomictytlmDemu on(0altomf3oodopDrlu o t srxrxo3io4ameelnetas)srrmx  oo4tltomieiys a2ulnmsn()aetoiocto1lp e uvi () rxo(o iy1llee iet (fsrra(rp;t4tleomicilsfs elnvo t) rerioctadlmtrlnei;t) 2xmir3iy4ol emfetas arraurpoo0oex iociatfm umnmo;t4 leomr iadla rauei s srxrxr3iu4lpe  iesa()srtau o;o0aeenioeiys a emums;t0 lxnio iy1fa  auvsl()t2uoxopnodom nlfvs tfaDrrxmo;t4aptomociltfsDel(vs ()arxnxrciy1lm  lueil(0s2xoio oydal   ivtas)a2umx ono1oltoif3tydfaDuln p;() exoxf3iy1opDeaneol()s2xoxopny4amen icsatf rua(mpot1aeeomf3iltlsDuan o;t0alxnxr ta1op rauvs s0texm(mpio1ape  ict sfa2ta(mono1tptnioeilt mDuln s;u4tlxomo tatfmtelnvo (  ruoxr nu4oltnmfetasfartax p;t0tetnmf3ildfm eanvp t4aexnxf3ia1fpDranvsls0 2trimpiy4lmt lfetasfarrmu  ;u0aeeo ictlsfs2rm(vpnt4arenmo3oydfmtelueilt teurxm nu4ale  ictl()arraxmp;o1tpx iiciyslm emu o;t)alenmoctytlaDeluvi (  rurimpoo1ll  mfvs (f ruaxrpno4aeeomoeiyd a rau o;t) rtrmo3todlaDraieils0 etr(o ou1ap  mneil() rtm(r ou0apt ifeiatlmDem( onu4 rtrir iotomD anei t0t2uoxo3oudll n neiatfs2raxr oo0tlto o3tadla2ra( pnt) rtrmfcty1lmte nvil( trum(m oydlmee ieia(f rrmxmo;o1tpx mociatla2emn p;()tltrmrciatfmD  uvo;t  2xrir3nodop nlfvsl(f 2ra(ro;u4opxniocilsfm ea( snu)aetrmocootlmteaues s s2triopiudapeelneslt sDuaump;o4tlx mf3ildfs2rln pnt0altrmrciy1omteauvs;t seumxm oo1alen ict t)arraumo;o1olxoiociasfmDea(vs u0teenio3iatfpDr n ol( teuoio iodomt livtltf Drrumpot4tleomoeiydfm2ran onu4 eerifciotomt lneil(0s2uoxo3nu1amenmfci t s2uru  ou1alx if3ias m2uan o;u)arxoioctotlpDe ivilt)trtmio iy1optemnesatfarur(ro;u0aptniiciadls2eluvont4aexrmf3totfa rlu ils)seuoxr iu1optnlfvtat sDumxr ;t4tetn ieiytfa ul(vpn(4teeomf oatoatr uvolt)s2xmio3nu4al  mnvilsfs2umu onu1apt iociad m2ranvont4altoxo iodoptr i ilt t2ur(o3iydll emfci s arrmx pno4texo f3iydfm2ea( o () exomr iadomte i i;(0 etoir iu4ol emfvtasf 2umx  ;o4tpen oetysla2ea(mpn(0tetnio totlpte ivi t)texo(opno1oltn iesltf Dumxr nt0tltnifeiltlaDemnmpnt4aeenmfcoytlaDr neo s0teto(o oy1aptnmneias arua(mp;o1teto feiaslm2rln o;t0artoif3oy1lmt  ieol(0t2xoio no4lpen ivils arum(r ;o1aex ii3iydfm elnms;t4aexomocootomD aivsl( teurirpno4lpenlivtl( aDrru  ;o4opeo ictatla eanmp;u4tlxrxfciydlpt lu s;s t2xr(r3no1op n nvias) Drr( p;u1ope  o3iydfmDuaumonu0trtrio3ta1om raues;s srumxr ou1ale mfei s) Dtrx  ;o1aetomietyd a emums t0alxrmf3ootlmDelivo;s) rtoir3no4lmt lfct s)s2ua(m no4optnmfeiat s rmn pnu0alenmo oo1fpD lu i;s s2uo(r ny1lpte net s a2urxmpnu4optnif3tysfm2elu s;()altoxfcoo1fatr u il(0trxriopiu1lm  mivilsf Dua(mo;u0tptomfcilsls2rmumo t)trxriocoytfaDranvs;s  eur(m3oo4ameeliei tfsrtmx p;u4ape iiciydlaDelnmp t4aeerir iytoaDeli s s)s2xrir oodal   ics ()a2tr( o;o4tlen i3iatlaDelums;t4aexoxf3totlp   neil()srxrim3iudome  fcsl(f Dum(  ;u4tetomietldla emuvsnt4 rxoio3ta1lpt  nvo;t)sexmio3oudlm n netltfaDtmxrpou4oleo ietas a2ea( p u)trtnmf3oodfptrauei t t2uoirpiy4lmte ivi t)aDumum ot4tex miciad sDel(vp;()alxomr3tadfmDrluvs;() rto(mpoy1lpen nvta(fsDrau o;t4alxoif3ildlm2rl(vs u)tlermf3tydoat aivolt0srxoxr3iy1ope livi sf 2rr(r no1aetoif3tadfmDrm(vpnt4artoxocoytlpt lnvs;t)t2xoim3iudolen neiat a2rrx  ;o4altomoetydfsDuan s;u0 exrirctatomtraiei;(0t2trxo no1olt mncsatf 2rau  nt0tpen fetysfm ranvs;t0tetnxf iadom  auvolt)s2uoiopno1ll   ivsatfaDta( pno0oexomociysfsDulumpnu4alenio3to1opDelues s  2xrxm3iodamee ieil()artrumpno1oeeo i3iytlmDrauvo;u) etnxf iytfmDr n o t0 exrxm oodll nmfctlt arrr(  ;t0tlenioetadfmDuaums u0trtoxociadfpDrai i ()sruo(opoodam n fvt sf Duaur ;t1tlx mociasla2ran snt) renmf io1lateau olt) eur(m ou1op nmnvils  2tmxrpnt4olx ioeiltfa ea(msnu)aeenmociatoaDr ueol(0s2toio nydopeelnvilsfartaumo;o1tee iietasfm uanmo ()tlxrxo iy1fmtrlivi;t)trxr(o3ny1ameemfvsls arrr(rpnt1olen ictlsfm2elnmo;()tetomo iotlmt  ues;(0trxmxo3oy4ol  mnctl(f 2taurpnu4tpt mo3ildlaDrlnmon()aexrmfctotlateanvs s0sruo(o oy4apt  feilsfa2rr( poo4tetnii3tydfmDeanvo t) ltomoctytla e ieols0 ruoio nu4omtn feilsfs2rmxmont4ape ii3tlslsDelu pn(0arenircoytfatean s;s)t2umxr3nu1omt  fet ()sDtrxmp;o4tleo i3ilsfmDran o;t4texomrctadom rau olt0teum(m3ou4ap   nvt s)s2ra(  ;u4oee mocildlm2ea( p;u0tetnifcia1lm e ieo (0srtrxm iu4ol   nviat)a2trxmpou4altnif3iyslaDum(vpnu)altnxociytfptraivs;s)srur(r iydamenmnei sfsruru  oo0oex ifetys sDrm(monu4treomo3oydlm rai s t) rto(o nudlmen fctat  2ururonu1olen ocildfm ulu on(0aeermo3oadopDrai s s  etm(mpiy1op  mnetl(  Drrurpno0alxo o3iat mDeanms;(4altnmfcoadlptr uvi s setrxr iydalteliet (f Dtr( poo4alx  ictls m ra( pnt4 exnmo3tytlpt au s s  2xoxr3nydoleemiviat sDurxmp;o0oetn fciad s eaumo u4trxrxr3oo1om r iei ()seum(opio4llen nvsl(fs2rru o;u1altomociytlm rmnvp;t)tlerxr oadlpDrlnvo s)t2xm(r3oudlmt  ieilsfsDrmxr no0altoifeilsfs umuvp u0 eeoio3oy1omDe i ol(  etrio ou1open fciat) rur(ro;u4aptomf3iyd s rlnvsn()altoio tytfm rli o;t t2toxr3no4llte nes tfarua( o;u0opx  ocilsls2uan o;(4 ltrir iadfmDeliei;t s2urxr3oydam   feta(f rtau onu1tpx mieiatfs2uauvp u4tltnmr3iodlmDr u ils)t2trirpoo4lltn nvi t)aDrru o;o1alto ociad s rmn s t4aexomo iytlaDrln ils0s2umir oo1opt mnesat)arrau  ou1olxn i3iatfmDel(mpn(4 lxomf3iodom rln sl(0seum(mpnudop emfcilt)sDtaxronu1oetoiieiasfa2uaumsn()tltrmr3totomDran s;s t2xmxo3iy4amtnmncta( sDtrurpoo0tetomoeiys m umnvon()tlxnmr3iodlate i o;s  etoio3ny4amte fei t)aDua( pou4aexomieiytfmDumu p;t) etomfcoy1faDeaiei s)tetmio nodam nmfcils) 2ururo;u1tle mo3tatfs2rmnvs u0 lxnmr3iadfp   ivs s0trtm(rpoodllt  ictas s2ua(mpno0aex  octad s rm(ms;t4aeeomrctadlp r ivs t) etmir oo4omenmncta( sDra(r nt0aee mieils mDrmu s;u)tetoxo tytfp r i i;t) ruoiopiu4ll nmivilsfarraurpot4apxnmoeiad m2emuvo;(4 rtrir tadomD ai s;t0 rurim3iu1lpt lictlsf Dtm(r no0altnioeild a2ea(mp;(0trxrxrcty1fa   n ilt trtmxmpiudlp nmivi ( sDrru onu1tpenii3ildla2em(mo;t4trxrxr3ootlmtr nvi (  euoiopno4amt lfctat aDrrumpnt4opx mfctlsfa ra(ms t4altomrciytfaDelieilt)srtm(r3io1lpt  ici ()s2uaxrooo0alt mocils m rlumo;t0arenifcootla  aueolt)teurimpnydlme mivil(f 2uru ont1olenmo3ilt a umumon()treoifcia1oatranvs ()t2xo(mpnu1amenlivi t a2rax oot0olt mieilslsDuau s;t)tltoifciy1lm   iei;s0 eum(m oydol n feiatfsrtrxmo;o1alenmoctatfa2eauvo;t0 leomf ta1oa  aieil( seto(o iydolt lfcs ( aruau  ;t0aetomietasfmDranvo u0trtrir3oa1lmt li i;s)s2trimpou1apt lncta( artrx  ;u1aeeniieiyt s2emnvs;u) ltnxfcootlpD au o () rxmir iodolt mictas aDur(mp;u1opx  fctasla2ulnms (4tlenxr oy1laD ln il(  eurim3nudlpenmfvsl( a2trumonu0tpxn ietldls rlums;u) rtomocta1op eauvsls0 2xo(m nu1lptnmfcs t)aDrmumoot4opt iiciltls2umn s (0alenmfctotomtraivo (  eurim3oydalte iei t aDtaur ;o0opx io3tlt m el(vp;u)tleoxo3oodoptrau il(  exoxr oo4ap elivsls artrx oot1aeen oeiltlm elnvsn(0 lxnmrcoodlmt  ivs (  2umxr3io4alenlfet () Dumumpot1altomfctysla2ul(vp;(4treoxfcio1lm rlieils  rtrio3nu4ll   ncils)sDrmxmpou4aleoio3tltlsDrl( snt)tetoio3oy1lpD ln slt0 2xo(o3no4apen fetlsf 2ua(r nt0alxn ieiatla2rl(vs (0alxnmo3iatlptrau slt)t2uo(opiu4omee ivt ( arrrxrpnt1tptnmieildfmDra(vont)alxrioctatfatrauesl() etm(r ou4lmtemfes ( aDrrxmpoo1tle if3tyd s ua(mo;(4alxrio oydlat  neo;s)s2urxmpiu4aptn nciat a2uaxmont0aeenifctltfm ua( o;(4artnmo3oo1fpt  nes ( setoxr3iy1lle  nvs (f rum( pno1tlt ioeiys mDemnvs ()aetomr3oydlmD  n i s)texrxo oo4amee nctatfs2trxmono1teeoii3ilt a2ea( p (0arermf3tadla elnes s0 rtrio3oudalte fvs (faDrm(moou0apxn ociatlm em(ms;u)arxrmo3tatlm   ivo;t)seuo(rpiydlpee nvias  Dta( ont4apxo o3iadla emump;t4aetnmo oy1faD ln ils0trxrio3no4ol elfeiat)aDumu  nu1tleo fciyd mDuauvp (0altnircty1lat  n i;( tetoiopoydaptnmnet ()a2rax oot1alxnmfciltlm umnvo;t4trenmfcoy1fptelues s0 2trxo oy4ol n ncsat a2raxmp;t4oltnmoetlsfm el(ms t)tltrxo ootlmDean olt) 2toxrpio4amt liviltfs2uru o;u1alx  o3iysfa2elumon() rtoxo to1fa ranvo;(0s2uoim3oodomtnmfet t  Dta( pnu1tet  fctadfs ua( s;(4tlenifcio1fp e ivo;s)texmxr3iu4ape  feil(f 2tm(ront1alxomoctlsfm2ua(vs ()alermrcoy1fmtrlivols t2xoxr iu4alte fvt s) rrau ono0opxnmocildfm ulnms;u) rxnxociydoaD aieo;s  exoxr oodaltnmneil()a2taxm oo4tleomfciad aDraumsnu4tetoifcoy1lm eluvslt s2um(o iy1alte ici tfa2trxm ou4oeeo i3tlt aDemn p u)aetoir3iodomt  nvs;t)s2urxr3iydapenlnetl()arra(ro;o0aetnmo3iytlm eaums;()arxomf iadoaDeli il()t2xmxr3nodal n ieilt aDraxr nt4aetnmo3ilsls2emumo t4aeenmfcto1lpD li o;t) ruo(o nudlmenlivtas)aDtau o;o4optnmo3iatfsDean pnu)aexoio3ty1lmDraueil( t2toio ny1ll   feias)srraxr oo4oetn ietldfmDelu s (4aeenif3tytoa r i s t0trxm(r3nu4lltn ncslt)srtmxmpou0oleomiciyt a2rm(ms;(4 rxrxfciytlm eaueo;t0srto(r no4lp nmfvs t artrumpoo1apxn fctatfs rmnmo t4trxomr oadoaD  ueils) euo(mpoo4apte neilt aDta(moot4olt  o3tatfm2emnvs;t4alxoxo tydopt lueo;s)s2toxm nu4opeelivt s)sDrrxmpnu0tpeomoeiad m2eln p u) exnio3oydlm r ues s  ruriopou1aleelies (fa2urxr no1tee  f3iyt a rl( p (0 etrir3oadfa  auvolt srumxr3iodaleemfetlt srrm( o;u4tet iictydfm emu snu4areomf3tytlat lneslt0t2xrim3ou4op   fvsl(  rta(root1tltomfeildfaDul(vp u0teeomf3oadfaDeauei;t)t2umir ny1lm emiet sfsDrmxrpno4ope iiciytfsDrluvsnu0trxrmrcoatfatrliesls t2toxm nudopenlnctlt srtr(  nu0apxoii3tadfsDrluvp;u4texnmo oodlm  aneslt) rurxopiu1al elivtat  rua(m no0ale mo3iadls2ra(mpnu4 rtrxf3tadlp  auvi s)s2xoxmpoy1llee iviasf 2tmxrono4tex iieiyt mDrauvp t0 etnmfcoytlaDr nvo;s) etoio3iy1omtnmfvsls arurum no0apx iietldla elu pnu4arxoxf iy1oaDr n s s0srxmim io4lmenmnetls sDur(r oo1texnifctlsfmDra(vp;u)teerxr totlat  u i s t2xoim oydlmt  ncs s  2rmxr ou0aexn f3iad a ea(vo;(4 rxrmo oytfa eai olt0s2toxr3nu4lptnlnet (fsrtm(ront1olt ii3tytlsDuaums (0 rtrmr3ootlp r u ilt)srxmxopno4alee icsas  2rau  oo1teto ieiydfa ul(mpnu0 lenioctytlptrlu s;t0 exmxo3oy1lme  ncsl( aDumur nt1tpx  i3iydfsDemnmp (0aexnif3ta1fm   ieols)texoxmpiu1lpenmics s aDuax o;u0aleo oetltls2rau s u0 eeoir3tatlp  aies;t0s2to(m nudamte ncsas  Dumur nt4oeeo f3tytls ea(mp;()aetrio oatopDe uvil(0trurxmpoudal nmfci sfaDrr(moou1tlt mfciaslsDeluvo ()aeenxr3tydlmDeanvo;( texr(r3nu4lltn ivtlsfaDraur ou0teeoio3tas mDeaumo;u4artnio3ootfm   u i;t0teumim nydaptnmfesasfaDrrumpno1opeomi3iat s2rmump t0trermf3oo1lp raneo (0s2xr(rpnodlm   ietl( artax  nu4opt ifetysfmDum(mp t)tlxrxr totlptran o s0s2xrirpiydopen ivsasfa2rmx  ;o0apx  fciatla2rl( p (0 eerxo iadopDe ivslt trxo(r3nudlpeemfvt ( s2ur(rp;o4tpe iiciydlm rl( s;(0 reomfciotlm e n ol()t2xr(o ou4llenmfvsas srrax ono0oltomoeilt m uanmpn(0 reoif3iatlmt luvi t)srxoim nodole  fciltfa2rmum nu4texnmfciatfm2ulnvs t) eeomfcootfmt ln o;s0 2xrxr3nudap e nvsl(farrmxro;o1aexnmo3iltfa ranvpnu0aeerir3iydlmteauei s0setmiopnydllen ieiatfarrmur ;t0ope mi3tatfsDea( o;u)tetriocoadfmD luvslt0 2trim3iodolt lfct t)a2tru  ;o0aex ifciyd mDeauvo;u4 etrmf ia1fp  lu i t)srtrxr3oy4aptelfctls srraumpnu0ope ioeiatfsDul( p;t0 lxomo3oodlpteauvsl(0t2xrxmpny1lpenmiet ()sDua(r ;o0oee mi3iaslm2ra(mp;(4trxnio ia1fate ieo s0t2toxm ny4lp nmnesat  rra(mp;o1texniictlt sDel( ont)artoio iotfpDeln i;( teuo(m3iu4lm nmfvi ()aDrrx  ;o0tpxoifcildfs2rln p;()tltomrctatopDrlieo;()srxr(o ny1alt livsls)aDum(m nt1opxn ietydlsDem(vpn(0trxrio iotop raueo t  2xmim iodom nlfetat  2taurp;t1opt  o3iytls2emnvsnt0tetnmrcoytoa r ivs (0srxm(opoydalenlfvtlt a2ta(rpoo1oetoifetydlaDuauvo ()altomocoatlm   ivi ( s2xm(m io1amtn ncia() 2umx  ou1oexoiociasla rmu o (0 leoxr3oodfatrli i s srto(m3oudol n fes () rumu  ot0olen ociat a emn o (0alxomr3ia1oatr ieols t2toio3ou1lmtelnci ( a2umx  nt1opto feiaslsDuan snu) lxoir3tatlptran slt)trxmirpny1ope  nciat  rtr(  ;t1oleo fciyt s rmn pnu0 ltnmf tadla  luvo t  etm(r3iydlmt mnciat aDrmurooo4olxnifeiltfaDrluvp;u0altnmo3oatopDeaneolt trtr(r3iu1lpenmfeil(f ruru pou4tle mfciys a2ra(vp t4teeoif3iadlatrlueilt)srxr(r iodom   icslt srrru oou1oexnmociytfa2emnms t0tetnxrcoy1op eaivsl(0 rtoio iy4lleemivs ()sDrm(ront0olxomi3tls m rlumo;()tlxoircootfa eaneil()trtrim3oy4ame miet sfs2um(mp;t1oex ifcildfa umnvp;()trenmr iy1lp eli i;t0 2xrxr iodomtn ivtl( sDtm( poo1aex io3ilt a rlumo t0trxnmfciatoptelu slt)texo(r nu4aptemies s srrmurpno4tlt  fciytfm2uln p u0artoircoo1fateau il(0t2toio3io1opte nvt sfaDrmuroou0aeeoifctltfs2rl( snt)tetnxo ty1omDrau i;t0 rtrir iodomtelfct (farrmxm ot0ale ioeiytfaDel(vsnt4 etrmf iy1oa rau s;(  2xrxm nudlp emicsls  Dumumono0aexoiietltla ea(vp;t) leoifctodfpt ai i (0sexmxrpoo1apenlict t  rrrur ;t1aetoii3iydlm2umu s t0 eeomr tatomt aneo;t)s2xmim3ou1ap  lfvt s aDua(mpno4tlx ifetytfs emu onu) lxrmf3iadoaDrluvs ()t2uoimpiy1lpe mncils) 2rmu  ou0tet if3tydlmDrlnmsn() ltnmo3iy1fmtr ueo;()texoim3oodlpeemnetlt srtr( o;u4oltoio3ilsla elu p (4tlerxoctatom rlnvol()srum(m3ou4llen nviltfa2umumo;u1texoifeildls2rluvpnu0treoxo iadlp   ivi;()texmir3nu1lm  lfesasfarrmxrp;o0oexoif3ilt aDrlu s;(4 etnio ta1lat  ivo;t0 rxrxmpoy4ap emivsa()aDtrxmoot1tlxnio3iytlsDel( o (0 rxrmr3tytfpteauei;(0tetoxm io1amt  fvta(fa2urxm ou1oeeomo3tadlsDemnvo (0trxoir3ta1omteaues ()t
\ No newline at end of file
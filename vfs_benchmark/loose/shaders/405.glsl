@@ -0,0 +1 @@
+n ols  2xoxrpio1op emivt sfs2ur(mpno0ape mi3iltfaDrl(vp;u0aetrxo oodlaDelnvs t t2xm(opiu1alte ivt t aDuauront1oexniicilsls2rmuvonu4texnxocoa1opDr uvs s0srtmxm oy1omtemfci (f rrrumoot0oltn fetldfs2umnmon(4tltomo oy1oateluvi;t trumxm oo4aptelfesatf rtaum nu1aptnioetltls rl( o;()aeenxo3tatoa ranes;(  2xr(r3io1lltn nvsasf 2ua(rp;t4oexnmfciytlm2emu o;t) ltrifctadfp rlnvs;s)s2xmimpoydom e fvsas) Dum(  ;u1tpeoif3tys s ea( pn() lxrxr tydlm ranes;(0 2xoxo3iodaptnmnes t)srrmumpou1aeeoioetyslmDumnvp (0altnxr3todlpD luvs;t srtoiopou4amtemnvtl( a2tmur ot4tptnioetys a2rl(mp;(4 ltomfciatfp ranei t0srxoimpiudap n iviat)aDtr( pnt4tlt  oetadfm2ua( sn()alxnmf ootlaDraies (  rxm(r iodoleelfvt ( aruau ono1oetnmi3tlslsDul(vp (0artnmr tydfa eanvi ( texm(o3no4omen neiltfsDumxm ;u0tetniictydls2em( on(0aeeoxfcootom r i olt0truoxo ny1op  mneta()arumurpnu4apxnmicils s uluvp;() etoxociy1fpDeauvo;() eumxopiy1alt  nci s)artaxrono0ole mieiadfaDua(vp (0aetrmocoadfatranesl()setoiopoydaltemnvilsfa2ua(  ot4optnmoeild m2ra(ms;(0alerio3oodfmDeaueol( truo(m oy4llenlnet () 2rmx pot1olx  i3ildlsDemu s;u4 lxomr3iydfmD  n sls0trum(rpou4opeelicsl(  2tm(mp;u4aexomf3tadfs ra(mo u0 exomrciy1lat  ieo (  etmim3oo1opte fci () rumu oot1altomi3taslaDranvsnt0altnmf3oydomtr ieo;() rurim3oy1am n icils)srtrur ou1tpx  i3ilsls rlump t0tlxoxf3tytlpDr nvi;(0t2tmim3oo4opeemnviatfsDrr(monu0teenmf3ildls2rl(mpn()aetrio3ta1lpteanvi;s) 2um(rpnydlpt lfcsls a2umx p;t1tlxoifctls m rm(ms (4 rtnif oy1fp  livi;s)s2tr(mpoudlptemicsa( srurx p;o0tee micilsla ul(mp t4tlxnioctadlm   i i;(0 rtoirpiu4ll  mivias s2ua(mo;o4teen ieias aDrmnmsnt0teeomfciydoatr ieo;t) euo(rpno4lpenmict tfaDra(m nu4texn icild s ulump;u4 etnioctytom   n ols0t2xm(m3ny4op nlnvtl(f 2ra(m oo0oleo fetatfa uanmo;u0 eenir iydlm  auvi;(  rtr(opoudomte fesat)s2tm(mpno4tptnifeiadfs ul(vo t) renxr3totoptrlu i s) ruoio nu4amt mivils  2ta( poo4olto ictldlm ra(vo;t4tltnioctodlpDelieolt0s2urxopou4oltnlnesas  rurumoou1oleomfeiyd sDulums;u0 ltnio iotlp elieo (0texoirpou4aptnlicta()a2ta(r nu0aet miciadfs ulumsnt)altnxocoytlm eauvi (0seumiopoudap   fvsa( s2rmxmpnu1tee  fciad s2rauvpnu4 rxnmf3oatoatran ol(0seumxr3iudomtnlicils arrmxm oo4aee  o3ias s eanmp ()artrxfcoatop eaues t  rxoio io1oltnlictls srra(monu4opxniicias m2ra(mpnt)altnxrctytom ranvo;s0tetr(rpiudom   fetls  Drrx ont0apxn fciyt aDrln o u)tlxnmocty1lm  lieils) 2to(mpoo1lp e nes (faDururooo0tle io3tyd a2um( o t4 rtnmf3tatoaDrli o t)trum(o ou1apen ivils)srrrxmp;u4alt  ietyd m rlu o u4 eenxocoytomt lnvo s trur(o no1lpe mivs s  Drru o;u4ole mi3iytfa2em(vo (0areoxfctatfateai ols) 2xrio nu1ol n nes (  rtaur no1apxo feiytfaDeln o;t4aexnxr ootomDelu o;t)t2toxmpou4op  lieias)a2uax  ;u4opxoiietlt s emn o u)trenif3iytla  au i;s srur(m nydll   nci t)artaumonu0apt ioeiat mDeauvo;()tlxnxo3tadfaD aues;t  ruoiopnudopenmnctls)a2um(m nt0alt  o3tasla uan pnt0altrmo oodfptean sls tetrxmpny1al e nviltf Drm(r ;o4open ieilsfsDemuvp;(0arxnmf oydfm rli ilt srxmxm oy1ap emietls)aDrmu p;t0tpx iictls sDrlnvs t)tlermrciydfa eaies s)srxoxopoo1alt lnvtasfartrurp;o4tet ifeiltfs rmnmo u0 exnmoctydlpDe i olt) 2trirpiu4lptnmfvi t srua(rpnu0aet  oetas m elums;(4 leniociadoatrai s;t0teuoim iydape lict (faDrrxront4ope ioetyd sDea(mp;u0aeerxo iadla ranesl() eumim ou1lltnmicsatfs2trxm no1tle ifciatlm ranmpnu) etoifciadopD  nvi t)trxoim3iudameemfeiltfsrrrx  nu1tpxnif3tad s umnvp t4artrxfciodlpteanvol( trxmxopnydolenmfciatfsrtm(mo;t1aeen ietydfm uln on() etrir3tytlateaiei;s sruo(m io4lmtnliet t)s2umxr nu0tex  feiatls2emnms;(4 etoir3tadom r ivo;( trtrir iodop   iesat) rra( poo1tltniociyd m uluvp;u0texrmr tydfpteli sl(0s2ur(mpio1am nlfvt (fartau  nt4apenmi3iasla2ranvp (0texoxociodlm  lnvo;(0sexoxmpoy1llt mivs t aDua( pot0tpeo f3ilslm2uanvo (4 lxnxo3ty1fpt luesl( srum(r3oydalenlncta( srrau onu4tlx  oeiad sDran pnt0tlxomrcootfatraneolt0srxrim iydlm  lfcia(fsrum(mp;t4optnmoctasls2eaump u4areoif iadopDranvs ()teumimpny1om nmnetl( s2tax pou4aptoiictyd sDumnmo;u4trxoircoytlaD  ivs;t)seurxm oy1ol   icta( artm(m oo0tlt if3tld sDrauvp (0aexrioctotfmD  n o s0trurxr no4apen fcsat s2ur(rp;t0ape mieiltlm2rmnmp;(0tltrmfcoa1faDrlivo;s0 2um(m ou1lm elfvtls sDta(r ot4opxn fetasfs rmuvs;(4 rtnir ty1lmD  nvo;t)s2trir nudoltnmnvias)sruauroou4tlenmo3tldfsDuau p;()tlerioctotlpt  nvi t0srxo(r3ou1lle licsa(fs2trxm ;o0ape  o3iadfa2eluvpnt4 rxnifctodlaD luei;s0 rumxo no4ale mnvslt srtr(mo;u1oltomf3tydfs rmn pnt)teeoio ia1la eauvilt)seum(opoudalenmnvil(fartr(mo;u0ope io3iad m2rluvp;t4 rxnxo tadlatr nei s trxmxrpiu4omee nvtl() rur(m ;u4openmfetldfa2ra( o;() ltnxrciytlmD  nes t) rtoxr oy4lmtnmfctatfs2ra(mont0tlxn fctadlmDulnmont0 exoxocia1optelneols) rxoxr oo4oltnmnesa() rrr(rpot4oeen fctatfa2ul(ms u4areoxocoodfaDelnvo ( sexoxmpoy1al   fcs () rurxrp;o4alx ioetysfa2ua( on(0trxrxf tadfmDelivo s) etmio nodllenlivi tfaDrax oot0aleo ieilsfm2elu ont)teeomrcoydlaDrlu o s)t2trir3ny1ame  ieil(  rtaxmpoo1aeeo ietatfs elnms u4aetnif todla  aiei () 2ur(opoy1amtemnvs t)sDtm(mo;o0olxn fctltlsDel( snu0tlerif3ootlmDr uvi;(0 etrirpoodll  mies t  Dtru pnt1aeeoii3iysls ulu sn()areomr3ty1opte nes s)srxmxopny4opt mfct t sDuru o;o4tee ifcild s elu o u0 ltoir tadoatelu il(0t2trio iodop  lies sfsrtr(rpou0olen i3ilsfm2uan p (0aeenmociotlaDr nvs;s0s2tm(o nu1openlicslt) 2ua( pou4tlxnmfciaslm2ean s u4arenmrcoy1lm r n s;t) rxoxrpny4amee fvt s) rurxro;t1ope if3iat sDua( on(4 ltoxf tatoaDeln i;t) rumxm ou4oltemfct sfsrtaxmonu1alxnmieiyt a um( snt0trxnmo3iodlm elivo ()teum(r oo1alen fcta(  Dtrxm ;u4tee mo3tytfm2rmn snu) lenmrcoo1faDr i s (0srxrxm3oudll n fvs t  ruaurooo0tlxnmieiat s ra(ms;t4tltoxrctytopDelueo;s trtoimpoy1open nesl(  2tr(m no0alxn feiyslmDulump;u)tlxoxf3ta1oa rau o;s  2xm(o3iodlp e nvtlsfsDtaxmoot4tee  i3tasfm ua(mon() etnmfctydlp  luesl()srur(mpoydap   nci t a2urx p;o0teenifcildlm em( snt0 etrxfciotlaD anes t0 etmxo ny4opt mnet t)a2raxmonu0olenif3tyd s2ua(ms;u) exrmr3oo1oaDeauvi;s s2xm(opoodlp emncsa( srraxr ;u0alxoiictldfs2umums (0arxnircoo1fa eau s s)sruoim3ou1ome mieia(  2uaxroot1apen ietldfaDumnmo;t)trxomo3todfpDeauvs;()seto(rpoy1llt livs s s2tm(rpou4opt mi3iytfaDea(vo u0tlenmo io1lpt  neil(0sexmimpnu4ap nmfei t)aDrr(rp;o4texomi3iyd s rau s;u0tlxoif3tydom r ueilt)srum(o3iodopenmncs ()s2uax pou4aeenmfciasfm2rauvsnu0aeeoifciy1opD  ivo ()s2umir3no4opt mies s)srrmxmo;o0aetnmoetat mDem( p u4aetnxf3oodoate n i (0s2tr(r3iy4ll nlnvtas s2taurpnt4tlx ii3iysfs rauvs;(4 rtoxo todfptrlivol()srxmxm oy4ap elfeiasf Drmxmoot1apeo ociatfs ua(vs (0 renxf3iodlmtr ies s seuoio iudopeemivias)a2rrxr ;u1tpxn fciyt m rluvs;()teenifciydop rai i;(0seum(m3ou4olte fvsa( a2rrxm no0oetnmfeiatfa rmump;u0 lxnmrcty1fatelnvi;t0trtm(opiudal  mfcsasfsrumurpot1tet ii3iadfsDrlnmsn(0tltrio ia1faDr neol(0sexmxr3oydolt mfviatfs2um(rpnu0alxn feiad a emnvsnu)tltnio iodom rlieolt srur(o ny1ole lnvtltfsruaurp;t4tpx  fetlt a rau snt4aexnio3io1fa  anvo t truo(r iodaleemfvi t s2rmxmpou1olto iciatfm ean s t0 lxrifctodlpDr nvo;s trxoio3iudol  livs s arrmx p;o0aex  o3iytlmDumuvp (0tetriociotfptrai i;t0t2umxm iydoleelnctas  2raumpnt1aexnioetltla2rlnmo;(4trxrxf3oodlpDrlnvsl(0tetoir3nudome  nei () 2raxmoou4oee mfeiydlsDuanmpn(4artomf3oo1fm  ln i;(0truoir nodlmt  nvs () Dtr(  oo1teenmf3iad m2ulu o (4tetrir oatopt ln il() rto(opio4ap elnvsa(fsrrmu  no0oetn o3iytfmDulu s ()alxrxo ty1oa e i o;()s2xrxo io1llenmfciltfartrxmpno4aexnmieiadlm rm( s u) ltnxociydom rlnesl( sexr(opiydlpt lictlsf rtrum ot1oeeomi3iadfm2ulnmp;(0trtoxfcoodomD lnvi s) eumxo iudomenmfvilt)a2ta(mo;o4tlxomieiasls2ranmpnt4tlenxf to1fatrlieol()truo(rpnu1al  mics (  2rru  oo1apeo i3iasfa ean p u4alerxf ootlm  lnes ()t2xrxopiudlmt mieta() rururpno0tltn f3iasfa rm(mo u4tltomf3oytomte uei;s0 rtoim3iy4ol e nctasfaDtrurpoo4olxomfetlt sDemu p u4tlxnir3io1opte uvslt)t2umim iu1amenmnet (  2ua(rooo0olx  ictlslsDemn p u0trxnxf oatoptr nei;( s2uoiopoydolt  ies s  Drr(  no4alt mi3iydla2rlnvsnu) eermfcoydlpDr nvolt trxrimpiydlm nmiciat srtrxmpou1olxnmicilsfm2ea(mont4alxoxo tadoateauvols)trtm(m ou1lle lnvil(fs2uax pno4apt io3ilt m elnvon()tltomf to1lmDrli o t0srxr(o oydlmt liet t)a2tmu pou1olenifeiatlm2rau o;(0trxniociytfp rluvo (  rtmxopiudome  fct s  2ra( p;o0tpeniocilt sDrlumo;t4teeoirciatomte uvslt trur(r3oo4oltemivi (fsDrmuronu0tltnmf3tltls ran snt4tetnxfciy1fpDeanei s) 2ur(o iy4ap elfetl()a2uaur nu1aleomo3ias mDuauvs;(0 lxrmr3tatfm   u ol(0setmxm nu1ll elfvsl( s2trumoot1ole  fciatfs2uauvpnt)aeenmr3tatfmteai s t)s2tm(m oo1lm nlivsl(fsDurxr nt0oetn ieiltfmDemums;(0 exnio oo1fmtrluei;s0s2tr(mpoo1lm elncta()sDrr(mp;t1oexoifciyt a2elnmo;t0 renmr3io1fmteluvo;s trtrim oy1omtnmnvs (faDrmu oou0texoifetas m2uluvs t)aexrxf oydlptrlieol( t2trxo3ou4lpe lnvslt)srumx oou1olen icilt a rmu o;t) rtoxf3todomDr uvi;t0tetoxo3ny4olenmfetlt sDtrxr ot1tpenmf3iltla umuvsn() renxrcoadom  ai slt0 2uoio nu4amt lnvsas a2taumo;o0oeeo feiyd a2ulnmpnu4tleoxfcoatlaDr ivs ( trxmir iu4am  micilt srua( pno4aeenmfetls mDrmnmon(4 leoxfcio1lp  ln i;s0 rumir3oodll elfeiat)a2rm(  ;t0tlenmoctadfaDuanvpn() etnirciotlaDrli s s0 etm(m3nydaltn fvslsfa2umx ooo1tee ioeiyd a2rln o t0 exoxrcia1lmteaueo t) 2tmxrpou4ol e fctlt sDtau o;u0oex mi3iat s rlnmo;t0trxrxo3to1lpDr nvo s)tetm(r ny4olenmnvils) 2taurpno1aeeomoeiydfm2emnmp t4tetrio3iotlat anes;s) rum(rpno1op emictl(f Dtm(mo;o4ale  i3ilsfaDumuvpnu0texnxr3tydfa eaieo t srumimpny1ap  lncias a2tmx p;o4tpe ifetydfs eluvo t) lxrmf3iodfa  auesl() rxrxrpiu1al elfcs sfsrrm( o;u4apen feils s ea( o;(0tetomoctatla r n o;( t2xmio iodalt lncs s)a2ua( pno0apt mieiatfs2um( pnt4arxnxf iytlm raneol(0srxmxm iu1olee nes s  Duaxmoou4ape  fciyd m eln sn(4tetnxo oa1latraneilt srxo(m iy4lp n fcsas a2umxm no1texnmociltlsDelnvs;u0 ltomfctadlpt anvs ( sruo(opno1lmt mieil()arrax o;o0oetn ictydfs ranvo (4texnxfcia1op r u ilt setm(m oudop emncias)sruaur ot1optnifctatls2eanmp;(0aexoxf3ootoaDean il( s2toxo3iu1lmtelfcs t  rra( pnu1aleomicilsfsDum(mp u0 eeoir3oo1fmDelnvs;s)setr(r3oy1ope mies t)srrrxm ou4opto ieilsfsDuanvo;t0aeermo3totlm eanvo t srxoim oodapte neils)srum(rpoo1oexo f3ils a eanmp u)alxnmrctatfa e u ils  ruo(mpoo1omenmivilt)sDua( p;u0aex  feiytfa2rauvp;u0 lerxfcoo1opDran i;t)texmirpoy1ol  mnvias)sDraum nu1aleoifciyt sDuanvo;t)aexnmo3iydlm r i o;t seumim oo4lm n ncta()arrmuront0tet moeild sDemumpn(4 rerxrcto1om r iei t0t2trimpoodal emfcta(fsruax o;t0oexomictlsfa2rlu s u)arxoxf oydoaDrli o;t0 eumirpoy4ap nmicslt)arua(r ;o0tpx  ocilsfaDemn o;t)trxnio3tytomte uei;t)srur(m iy4ame lnctl( a2ra( o;o1tpt io3iyslsDrlnmp;t0 etrio iydlpt ln olt0sexoir oo4amtnlivia(f 2trum no1oexoiicilslm rlnvsnu4 rxomr3iotlaDelnvo;t s2trir oo4aptelfct (fsrtmxmp;t0tlxomo3tls aDeluvs;()aeenmfcio1laD li sls)srxoxo3nudolen icsl()aDur( o;u4apeomi3iadlm el( s u0tlermocta1oaD ln ilt0s2umxr3iudape licsl() 2umxrpnt4oltoif3tldfm2rl(ms u)tlxnxf3oodlmDr uei;s srtmiopnudopeelfvsls) 2rmumoot4tleo oetydla2umnvp t) eerxfciytlmD lu i t)setoxr no1ol elivsasf rtaxro;o4alenmociltfa2emnmpn(4tltrif3iy1oaDr i sls0teuoim nu4ap n fvta() rrmxrpou1alen feiysfa elnvo;u4 etrxf iatom eaueo;t trxrxmpoo4om e fvsatf 2tau oou4aee moctltfm elnmo (4 eenmr3ty1om rluvo ()srum(o3oo4amenlfet sfaDumx  oo0apt if3tasfa ran pn(0trtoiociydomDeaieil( teum(o3oo1aptn ivi t s2rrx ooo4apxomfctatfs rm( snu)alxomfcoydlmDeli s;t0t2urxo no4altn iei s)srumumpou4oee iociatfaDulu p u0 rxnmfcoydlpD  i sls) 2trimpiydoptnlfeta(f Dtrxrpnt0texnmoctldlmDrm( o t) lxoiocoadom rauvsls0s2tr(mpio1lme  nvi t)arurx  no0apt  fetyt s rl(mpnu) lenxo tatlaDeaies;t  2umir3iu1om nmiviat)s2urxmo;o0aptomo3ias m2emu ont) etomo iy1fmtrau sls)srur(m3nodapt  neta()sDtrx  ot4altoioeiltla2uanmsnt0texnif totfa e neil(0srxr(m3iy1alen ietat)a2um( ono0openifeiasfaDumn s t4trtomf3iotlmt au o;s0s2ur(rpiudolen fvsl(fsrta(  no0ole  fetatlmDrm( s;t4tltnmo tydlatelnvi t s2uoxo3oy4al emiviatfs2uaumonu0tptniicilt m2uaumo;(0 exrxo iydoate nvi;t)t2xriopoy1aptelnetl(f 2um( o;u1oex  ociat a2ulnmonu)tlxrxrciatoatraivs s0trtrxopiu1lle  ict sfarurx poo1aeenmocildls2emu sn(4texnifctydfpt auvilt  exr(rpoydap nlict tf rrmumoou4tleomoetyt s elnvs;t0artomfcta1fp rau o;s0trxrxm oy4aptnmnvils aDtmxmoot1opx ioctld sDulnvpnu0aeermfcootoat  uvi t0seuoio3ny1omeelnctl( sDta(mp;t1aetomfciytfa eanmo;t4aexnmo todlatrli ilt trtr(m ny4lltnlfetatfaDur(m ou0ale ifcildfm2ulumo u)tlxnxr3oy1lm elnvo s sexr(opoo4lptnlfesl(f 2trxm ;o1aeeoifetad aDua(vp;t)aexnioctatfmDelivo ( truoxr oydop emfvtls)sDtau ooo0oee  ieilt aDua(ms;() leomr3oadlmDeanvslt) euoio oy1am  mnvsas aDrau p;t4apxo o3iysfm rl(mpnu0tlxomrciytoaDelivi;()s2um(o3no1al  mivtl()sDtrurono4tleo f3tas m2rauvo t0texrmo3oodoateaieo;t) 2umxo3ou4optnlnctas  2rm(rpou1tptn oetys aDrmn p t0aetoio3tydfp e ueslt  2toxo oy1al n fei ()artm( p;o1tle mieiasfs2umuvont0 lxomr iatlptrlivi (0 rtoim3oy1lp  mfesat)a2truroou1aeto f3iyt s2eln o;t4tlermrcia1faD aivo s  2uo(mpiu1ome  nvi s  rurxm no0alto f3ils s2rlump;t)arxoircootomD an o s s2to(o3io1lpe livils)a2rrumpou1aeeo octytfs ra( ont)aeeomociy1lmt lu s;s0srumxmpio4olt lfvsas artr(rp;u4tlto o3ilsfa elu s;t)alxrxoctydlmD  i ol() eumxmpnudlmen nvt t)artaxmoou1tleoio3tlsfa2umuvpnt4 etrxocty1lmtrlivsl(0trurirpiy4amenlici (fs2uau o;t0aet  ictlsfa2um(mo () ltomf iydfpt auvs;s) 2um(m iy4llee fvilsfa2rrx pot1opx  f3iltlmDrln o (4 lxrmf oodlmteaueil(0s2umiopiy1am   icias  Draxmo;t0olxo i3iyd aDumuvon(0 lenio oatopt  ivo ( t2xr(o3iy1apeemfet s)srur(r ;u1alenii3tls a rmnmpnt4artrxoctydfmtrlnvo;t) eur(o oo4om elfvi s)artmx o;o0alenmo3iydla eauvpnu)aetrmf iy1fp   uei ( srurirpnu4lpt  feiasfartruro;o1aet mieiat a2eauvon(4aetrircoy1omDrauvi;( t2xmir3oodolenlfcs s sDua(mp;u0oltnmictlsls rlumo (0arerif ta1latrau ols)t2xmxr oy1ol nmfcsa(faDtm(  ;t0olxnio3iys mDuln s;() ltnmf tatfptr ueols trxmir3no1ameelncs t aDraum ;o1apto ociydlaDuaumpnu)aeerircio1lat aieol( s2xmirpoudlpt lietas sDrrxr ;u0olxnio3iatfm2rln o;u)teeriociotfptrauvi (0s2trxr iudlle  fvsltfaDtmumooo1openmiciytfa2ul(ms (4tlxomo3iadop  lnvs;t0texm(r iydalte ics s s2rmu  nt4tetn fciyt s2ua( s;u) rxrmrctadfptraues;s s2umio3ou4lptnmieta(  rta(mp;t4apto oetysfa2uluvo t)treomrcia1oatrluvil()s2um(r3oo4olt  fetls)srtrxro;t4tex ii3tadlaDumn s;(0arxrxr ty1omtean i;()teto(r3nu1ape mnei ()a2tru p;t4aexomoctydlmDuaumsn() eerif3iodom   ivo;()seuoim ou4op   icsasfsrtax pot1olxoiietytla2eluvo (0arxnmo iydoa  aneols) rur(r3oo4lmeemfctas sDrr( p;u4tex mo3tys s2ulu p;u0texnxr3iotomtr uesl(  2tmiopiudapt  ies () 2rrxrpot1ole mf3iasls ra( o t)alxrir3iatlp r n o ( trxoxrpno1altnmfvils arta(r ot1apxo icils a ul( s;(0 rxoio3tytlaDelnvo s) exmimpiy4olt lict ( artrx pnt0tptoifciatfa rl(mp u0altrmociodfa  ai sls0s2xo(o3nu1aptnmfctasfs2ua(r no1altnmociysfaDeaumpnu0 rtoxf iodom r ieol()t2umxo3iodop n ivsl() rur(mo;o1olx  o3iad m el( s t)texrxocoatfpteau s;t0teuoxmpno4ale mfei t)sDtmxr ;o4teenmfcildfa rmnmo;()arxnifcio1fm   nes;t) eurxm oy1altn neta() rtm(ro;t0tltnmociasfa el( o ()tetnmo3oytfmt  nes s0sexo(rpoo4lme mnvias)artmxrp;t4apxnmoeiyt m rau o;t) rxnxo oodfpDeli slt  2ur(r3iydal  lieta(faDururpot0aetnmoctytlm2rlu o u)trenmfcio1opDelu s ()srxm(r3no1lpeemncs t srtrumoot4apxo octad a2rm(mo;(0arxrmo3oo1lmDrai il()sruoim iudamt lnetasf rtmxmo;o0ope mfeiltla rln s;t) rtrmf3oatoaDe uvo;t  euoio3no4aleemiet t sDtau p;u1opx  f3tys s2ranmont)tltnifcoatfmte nvi;s)s2xoim oydom  mfeta()s2tmx ono1aee mictys sDrmuvont0trenmr iadopD aneolt0t2tmxmpny1omtn fvtas srtmxr nu4teeo feiydlsDuanvs t0trxnxrcia1om eai i;s tetm(mpoy4lpe  fvia(f Durxmpoo4olxn ocildlsDel(mo;() lxnxo todlpteaivsl(0s2toirpnydam emnvsat  2ua(mpot0tlxnifciltfmDemnmp ()tltoirctotlmt  n i ( seurxr3nydolenlicia(f 2rax poo0teeomiciyd s uln s;t0 rtrxf3oydomD aneo;s0 2xoir no1omee fet sf Durxrpou4aeeo feiasla2ul( s ()altnmr iadom r nvo s)tetmimpiodom elfcslt) Drauroou1tpt  ociyt a eau p;t0 rxnmo3iy1oa elieolt)sexrio3iu4lp e feiasfsrrmu oou1tleoiicild a rmnms;t0aleomrctytoaDr n o s  eum(o3nu1lltnmivta(  Durum ;o0alt  oeiys aDel( o;t4altnmo3tadfmDe uvi (  2umirpoo1ole mnvia()arta(  ;o1texnmo3iydfs ea(vsn()trtrxf ta1fat  nes t)sruoxr3no4lm nlfvs s) rrrxrpou4aptomoeild aDeanmsnt4teermociodlp  livol()srtm(r iydol nmnciat aDrr(rpnu1oeen feiyt m2ul( sn(0aeerxr totlpteaneolt0t2urio3oydaptn netltf 2rax oot4apxo o3tlslm rm(vonu) ltoxocio1la  aieslt0s2um(m iydlmt mict ( aDrrxrpou4tpxn feiyt m rl(ms u4tlerifcto1latr neslt trtmiopny1altelnctlt aDtrx onu0tlxnmfciad sDeauvsn(4arxnmrctytlptelies (0 rtmir oo1lle  feils sDrru pou1opx ifeiydlsDum( s;(4trxnmf tatlmDrli o t)texrir ou1lleemict t aDrm(r ;u1tee  iciys s uanmsn(4 reoxociatoaDeai olt)trtrxo iu4aptemfciat)a2uau o;t4aexomfeildfs rmuvs;(4tlxomfcia1oa  au o () ruo(m3iu1aleelfcslt)a2ua(mp;t4tpxnmoetlt m ua( on(4areoir3oatomtraieo t  2xo(o oodlpe  fvta()aruaur ;o0tpeomicildlaDelnms;u)aetnirctydlp eau s t tetm(r no4aptnlnvils a2rau  no0alto fcildlaDuluvpnu4 ltoircoatla  lieo;t trtr(m3iudlmeelfvi s a2raum no4altnmoeiatlsDulu o t)alenxf3iatopDrauvslt  ruo(o ny1oltelncsa()sDumxmo;t1alxnmf3tlsfs2ea(vs;t0alxrxrctotom   uvi ( teuo(o3oo1lpen neils s2rmumpno1tleomfcild mDranmp u0 lxnif3oa1om  lnvs;s) rur(o3ou4op nlnviasf rtrxm ot4tlx iiciydfm2rlumo u0altnxo iodoat  nvi (0s2umxrpnu1altnlncsls  rtau p;u1tleniicild mDul( o (0texoio3oy1lmtraivils0setr(r ny1lp nlici s srtmurpno4optnmoctls m2uauvp t)teenmocoodlatraivil( trur(opiydomt miesl() Durxr nu0tptoif3tas m emnmp t0 lenmr3iytfmD lnvs;(  2xmir3nu1op n feilsf Duaxr ou0aetn feiat sDraump t0tetnmrcoa1oaDeluvo;( s2xoio oy1llte ivsat)srtaumpnu1oleoif3tasla elnmpnu0 lxoxrcoatfateai i;t0trxoir3nu4lle livias)a2tm(rpot1opxomfeiasla2emnmpnu4 etnif3iadlpDeaivi;t t2uoxopoodlp elfvs (fs2tmx onu4tpenmieiydfmDrl(vp t4trerxocoatopt anvs s  2xrxrpno1lleemfvsls)sDta(r nt4alenmfcilsfa umn p t4altnmocoadlm r ieo t0srtoiopoydamee fvsatf 2trumooo0olxoiictlsla2rln s;(4 eerxo oa1oa  li slt  exr(r3oo1amenlfcslt srtr( ooo1tpxomfciydlsDeau s;t0tetnxfciodfa   i s;()seurim3nodal nlnciat) Durx poo1tlxniociad s elnmsn()arerxr3ootlmDeauvilt  eto(o3oy4am  mfvi sfa2umxm oo0olt if3iydfmDrm(mo ()tltrio3oo1oaDrliei (  eum(o3oo1amt  nvilt) rrrx  no4oexo octysfa2rlnmo;(0 lxnmf3oo1fm rauvsl()t2xo(mpoudlmt  netlt)a2trx ooo4opxoio3iytls rl(mp t0 eerxf io1oaDr i i;s0t2trxrpoydalee ieia()srrm( pnt1tltomicils mDemnmon()teenmf iatlp elneilt) ruoxrpnodlmtnmicia(fa2urxro;o1optnii3iatlmDua(vo u0aleomo3oatlptr ues (  euo(m oydomenmnct t)s2ur( p;u1tlt moeiysfsDuln o ()areomo oo1lm  aueols0t2tmio nodllee nctltfs2tmxr ;t1tet ifeiyslm rmn p ()arxrmf3to1op rlu sls  rum(opoudlpe  fvtlsfarumumont4oleoifctld aDuauvp (4teermfcia1fate ieo;t0trtoio oy4amt lnciasf Durxmonu4apx mieiltla rlumo t4tetrir3ty1omDeai olt t2xoxopnu1lm e ivs sf Drmx oou0tpe  oetyd s2uln p t) lxoxo tatopteaieo t0trtoxm oydllte fvsa(fs2umx oou4apto iciydlmDrm(vo;t)trxrio oytfmDrauvslt  exo(o oo4ap nmneiat arraur ;u1aetoioeildla rmu s t)aeenxr3iytom  ai i (0 ruo(o3no1opt lfeta(farta(m ;u1altoiieiydlmDran s;()alxrmo3iotlaDelnvsls tetm(o3oy4am nliviatfa2rax  ;o1apxomfeilt s el(mo (4 eenxo oadfptr u o t  rtmxopoydapeelfetltfsrtmum nt4opxnmf3ilslaDemn p t4 leomr3tydla eaivols) exrir3no4lm   iciasfa2ur(ro;t1tlenio3iysfsDrl(vo (4teermo to1oatrlnvs s)tetm(r no1lmtemnet ()sDrr( p;u1teeniieiydlm rmn o (4 renmo oytomDean o;t s2urxrpiy1lltelfesl( aDrrurp;t0oet moctlsfa2rmuvp t)arenmo3tytlate n il(0t2xriopiy1llenmicils) 2urxr ot1tet mfciyslm2emn s;t4 lxoif3oodoa raueslt)sexrxmpnu4om   netat) rraxrp;t0tpx mf3iydfm2um(vp u4teeomo iydfmtelues t0s2xm(rpiu1altnmfvsas)s2trxrono0tpt  oetatls ea(monu)alxnif3oadlaDraues t)s2xmir3ny1op  lnvtlt arrr(m nu0apxo iciydfm2rl(vp;t0 rtnmr iy1lat auvi s0 etmxm3ou4lm nlicsl( srrax ooo4opt iiciysfs rau o u0 ltnxrcto1opt  u s;t srtrio oy4ap  liesat)sDtmx oou0tpt ii3iyt m rauvp;u4tetoirciodlmtr n s (0 rxmxm3ny1amen ict () 2taxr ;t0tlxn f3iytla2em(vp;t) etnxf oy1oa  livs s trtrxm3iu4al nlfcsl()srtax pot1oltoioeias m rl(vpn(0alenmfcootfp   u ol()seumxr3oodlptn nvia() rtauroou4alxomieilslsDel( s;u4 etrif3tytfmtrauvi;s  rxrxo3ou4lpenmfctas  Dua( pot4aex mf3ild sDra(ms;t0 lenxfcty1fmt anvs;s0s2toxr3ou1alee feilsfaDuru onu0alxn fciytfa2ulnmo (4 ltnmf3oydfmtelnvsl()trxmir oy1lptn icsat  Drm(r ;t4aee mictatfs2rmnvp;(0aeeomr3totopt  neo t  rtoxopiudlm  lfvt (farrm(rpno1opt mi3tyt sDuan o;(0altnxr3tadlateai i;s0setmir3oudameemfeilt  rraxrpno4aex moeildfa rau snt4artoxfctadomtraiei;t)sexrimpnudomenlnvt t)artau  nt4tleomictydfm2ran s;u4 lxrmr tytfm r uvs t)s2trxo3iy1lp  licsatfaDum( o;o0aptn o3iasfs2rmu p;t4artoif3iytoa rlieo;t) 2tmxr3iodlm  mnci t  rraxm ;o4tptomieiydlmDrln s ()aeeomrcio1omDe n i;t)truo(o3oodoptn nciat)s2rm(rp;t0teeo ociyt sDrl(mo (4 lxoirciadfp ean o t0setm(o oodolenlfvtls) rum( o;t4tlenii3ias m um( p (4alenifciadlpt  nes;( sexm(rpiu4lle mieia(faDrr( ooo0altniietydlm em(vo (4 lxnir tadfmt anesl(0s2xoir nydale mivsa(f Drm(monu1apx mi3ilsfa2uln o (4 lxoxf to1fmtrluvo;s)texr(r3nydop nmiesat) rtaxrpno1opxomi3iatls rlnms ()tltnmr3ty1fp eai ils truoio no4lmtn neiat)sDuaxrpot0opxnmi3iyt m2elnms (0 rxoxociytop   ueolt0 rxoim ou1opt  ncias)arrr(  no4oexnif3iltfs2rau s;(4 rxnmr todoa   nes t)t2xmirpio4amt mfes t  Drru pnu1tetomf3iydfm uanvo t0 lxoxf3oydom e ieo;s  exoim nodom nlnvtat srtrxrp;o0tpto fetldls2rm( pnu4 ltrmoctadla raivols0seum(opoydapeemncia()srta(mpnt0aee  icils a elnmont0 etrmrcoydlpDr nes s setoxm ou1am  lfetl( arrm(r ot0tpt  fciysfsDrmuvp;(0areomr oy1fmD  nesl() exr(m3no1amenlict t sDuaxr ot4tet  feiasla2em(ms u) ltomo3todfp   ivi s0t2urir oo1llenlncs t) rtau p;t0apxoii3tls aDuanmo u4 eeomr3tatfptelivi () 2tmxopio1lmte fei sfaDrrxr no1tet miciysls uanvo;u4teenxoctotfptrlnvi ()t2xmxr3ny4omtnlfvta( srra( pnt0tpx ifeiytfmDuau s () lenxrcta1fmD li s ()srxm(o oy4lpe mnciat srur(r no4opeo icilsla2ulnmont)aetomf3totlmt auvi (  2urim io4ape mivia()a2tmxmo;t0oet mo3iytfa2eaums t4 eeoxrcta1lpD aiesls0trtrxrpoudal n ncil( aDrrxr ;o0apxn i3tat a2rlnvon() leoxrciatomDrau ols)seuo(opiudom  liesatfsDtmuro;u0tlxo ieilsfm uaums (4trxrxr iy1fmD anvo;(0 rtrxm no1ll nmictat)sDum(r nu0teto oeiat s2uan p;t)artomfcta1lp r ieils) etm(mpnudlpee icsl(fartr(m no4aetniociat m2umnvs;t4 rtnmf3totlp r n s;t0trtmxr ou1am   fvtat) rtrur nu1ale  oeias m2ul(mo;()alenir3iydoat aivi s  rurxrpoodopt mict t)aDtmumpoo0oetomf3iad a ul( snu4 ltomo3to1faDeluvs;(0 ruoxmpou4amtn fvsas)a2uax oou4tpeoiictld mDranvs;(0alxriocoy1lp rauei;s0srxmxm3ny1lp e fei t)sDtm(r nu4aleoiietas m2emumo;t)tleoxr3ty1omDrlieilt) 2tr(m nudaptn ictat) rta(rooo0aptomi3iatls ul(vsn(0alxrmo3ty1faDeaiei s tetmio iy1lme lnci t srtrumonu0tex  i3tat aDrlnmpnu4trxoxf iatfmt lneo;s  ruoxr oy4am emieta(  Duauroot0olen i3iatlm2ul(vp;t4arxnif tydlpt au i t)sexo(rpiodlme  icsltfsDuau pnu1aptomoeiltfm2uanms;u4alxrmr3oa1la raueo;s0teum(r oo4ll  lfet tfsrrrxmpoo4altomoctld s2uanmo t0trenxf3ootlp rliesls) eurim ny1olee ivil( aDum(mp;t1apx mf3tadfmDelnmsnu)altrmr tydopDeau i;s) eurxmpnydome lnvs sfsrtmx  ot4oetnmf3iat s2umnvs;u0 rtnxo totla r iei;t trtoxm3oydopt  ivi tfsrtax ont0alto fctatfsDemn snt0arerxr tatlmD  neo s)srtrio oo4optnmfvia( aDumx  nu1oex mo3ilsfaDel(mo ()tleomo ia1fm ranvo ( srtoxr io1lmeelnci (fs2urx  nu4ale  i3iadlm2ran sn(4 lxrxf iodlpt aieo;s0teurxr3no1ol   ics ( s2umum oo1aeenio3iat mDuluvs ()aetomo3oo1oaD lieo (0teuoxm3iydam  mivil()sDta( pou4alxomfciyslaDranvonu0 lxnxfcoytlp eaivs ()srtm(mpoydlpee feias) Dta( oot4apeo o3tls a2uaumsnu4arerxo3oy1fpt luvi (0 2toxo3io1ap  lfcs ()srrm(  nt4tpt  oeiadla eanmo t0arxoir3iydopDe ueo ( teuo(m3ou4omeemfct t) Drrumpot0tle miciytfa ranvs;t0tlxomo3tytfmteluvo t) rumxm3oodlm elfct t)sDrmxmo;u1oee mfciat mDulu o (0 lxrxo3oytlmD aivi t0trurir oodaltemnvt s) 2urxmpnu0aexo i3tadlm2elumon() ltomr ta1fa rauvils0seur(m io4lme  fvt sfsDtaur nt4tlto i3ilt m2uln p () exoif tytlatraneolt trtr(mpiodlptelnvt tfartrxront1tlxnmi3ilsfaDrl(vs;u4trerif totfateluei t0 rtmiopoydlme mnvilsf Dum( pot1tltn i3iatlsDemu p u4 renxf oodlmtraiesl(  euoxr iodlle mneils srtr(m nu4oeenio3tyslm2elnvs t4 leoxf3iadomtraivo s0 exoir oy1oltemnei (f rra(  oo4tpxnii3tld s2ulnvs;t)tetoif totlmte nes;t0 2uriopoo1amenmfcils sDurx  ot1olenmi3iytfa ra(vpnu) eenmf3oytlm  livs t  2tmimpiydale  nes sfsrtm( oot0tle  oeiasla rl( o (0trtrir3iatlmt  neslt texoxr oudopeelncia(  Dtax  ot4aptomf3iaslm um(mp u0aleomf3tydoptr ieo s  exrxr oodapte fvi t)arrmurp;u1aetnifeildfa2rmumonu)aetrir3tatfa eanvo;s  rxmio3oydoptn fcsas aDrr( o;t4aetnmociatlsDul(mp t4 eeoxr iodfa rlues;s0sruo(m3iy1olte nviasfs2tmxmo;t1opxomoeiysfm ua(ms (0tlerir to1fmD anei;t) rtr(rpnudolenmnesls) Dtaxrooo4tpxoiicilsla ra(vonu) rxnxr tydomDe n ils0truo(o3iudlp  licils)srtmum ot4tetnmietasfm umnmsn() etrmf3iatlp  auei;s)t2xmim3iu1lm n iet tf rumx p;t4opx mo3iltfaDul(mo;t)texoxf3oatomtr n i t0tetmxrpnu1apen ict ( arrruro;t1aexo f3iatlsDuln s;t4 exoifciotla r ivolt0texoxr3iy1oltelfeilt)aDur(rp;u1tpe ifctadlm ranms;t0altoxf3iodopt auvi s)t2uo(m3nydlme  ies s) Drm(  ;t0apxoio3iysla2rluvs;t4 renifcoytfm r nes ( setoir3nu1op n ietlsfartm(mpou4aleniiciadfs eauvpnu4 eenxf3iydop rlu s t)s2toxmpoudopen fvs ()artau pno4texo ieiytlaDrlnmp u4trenmf tytla rlneilt s2tmxopoy4ameemnetlsf Drrxmp;t1aptn i3iadfm2rm( o u0tlxnif3ty1optr ueolt s2trxm3iydole mieiasfsDua( poo4tpe moctlsfmDuln p;(0 eeoif iodopD  nvi;t0srum(opno4olee nvs t srumxmono1tlen f3tad sDeluvs;u4 lxoifcoodlaDe uvo ()teumxo ny4op  lnvslsfarrmu pnt0tetoii3tat s ua(mpnt0 rtrxo to1fp  ai s ( t2uoir oo4lmenmfciasf Dua(  ;o4open ieiydfs2umnvs t)tetoif to1op elieslt s2xoim3oy1lmenmnctat) Dum(r oo4tpto i3iyd sDeluvs;t0trxoxfcta1lat an s t)t2urxo io1open fesasfsDtrx p;o4oetomo3iydlm2rlnms;t4texnifcty1optrlneil( t2tr(mpoo4lmtelfcsls)srtmx ono0tlenmf3tadlm elnvsnu)texnmr3oadfpDelivsls t2uoxrpny4opee nct () Dta( onu1tpenii3iat m ua(vo;u)alxrio3oy1opDrau i;t) etr(r3iudom nmivs t srra( pnu1alenioctyd a ea( pnt0 lxrio3totlpD aivi;( srxmxo oodol emietl() rurxro;u1alxniieiadlm rmnvs;u4 ltomr iytfmD  n i t0tetrxm3io1lmenmneiat artax pno0aetnifciltfsDuau s t) etnmf ty1fp r nvi (0 2xmim ou1lptelneslt aDtaxrp;u0apeo fctasfm um(vs;()alxoifciatopDeaneo;(0srurxo3nu4ol emicsas)srtru  ;u0aee  i3ils a2um(monu0 reomf ootlmte nvo;s0texrxr3iu4oltn ies s) rtrxmp;t1altomfcildfmDeln o t)trtrmf3iy1lmDe uvo;t  2xrxo3oo1ap  lictl( s2ra(  no4oex mf3iydfa2elu s (4 ltnif oytopDr neils  2uriopiy1om e feslsfsDrmur oo4aptn f3ils m2eau s;u0trxoxf oydlaDeauvs;t) rxo(m3iu1ol n fesa()a2taxrp;t1tlxoiociydfmDulnmp t0 lenirciytfp r iesl(  2triopou1omeemfvi sf Dtmxm ;u4oex ifcildfsDrmnvs;t)texoir iytfmDr ivil() rtrir nu4amtnlfeiasfa2trurono0alenio3iydfaDrlnms;t)altoxf io1latrln olt) rurirpio1ll   nci s)arta(rp;t1alxniiciyslm rmnms (0arxnxf3iydlmD  uvilt)t2uoxrpnudape  fesasf 2tmx  ;o0tpxnmf3iyd m umuvon(4alerxo3oytomt lnvo (0seur(m3ou1aptemfcta( aDtau pot0aeenmi3iysls2rlnmsnt0trxoif3iotlpDr uvol(0trtrim nu1al n feiasfsrraurpnt4ale ii3iysfm umuvo t4 rtnmf tydlpDelivil(0srtrio ny1om emivias s2rrxront4texomf3ias m ranvs;t0texoir ia1opDrlnes;s0 rtm(r3iy1amtn nvsat arua(mo;t1aet ioetas m ul(mp u4 eermo3todlpDrlnei;( s2to(mpiu4op  mivta()srrmu o;t1teenmo3tlsfm2umnmp t0trtnir oodlmD aues s0trxmxmpiudomt  neils)s2tmump;t1texo fcilt s2rauvsnu)tltnxo3oa1fa   i s ( trtm(o3iy4lpen ieiasf 2ra( pot0aexn i3iydfa2el( o u0aleoiocty1opt  u sl(  etoim3nydol elieta(  2raump;u1tle  ietatfa ra( o u4teenxrcty1fa  anvo (  rumio io4lltemicilsfsDrmumpnu1oltn f3iasfm2rln snu0arenmociy1fptr nvols0 2uoxo io4lmtnmnctltfs2ur( pno4tleo iciatlsDumn s;t4aexnmocoytoa   i sls)seuo(m io1amtnmfvi (fsrumu  ot0apxo i3tysfsDelu pn(4texrxr3oo1fp raieol(0t2tmxm iudaptnlfvsa()sDtr(r no1apeniietytlm ua(mpnu) lenifcootlaDranvs t0 etr(mpio1aptn nct sfa2rmu onu1texnioetlsfa2umnvo t4 rxnmo ta1lmtelnei s t2tmxo3no1lp emivia(f 2taumpnt4tee miciadfm2umums ()texomo ty1fptrlieo;t  2toxmpou1ap   net t  Dua(mont4opxo ictltls2ea( o (4 rtrxrcoydfpDr i o s0trxoxr3oydll   ict sf 2tr(mp;o1olxn oetatlmDrmu onu4teenif ia1lmD ai o t setrir io4ame  fvia(fs2ur(r ot4olx mf3ils mDua(vp t4 reoxr oy1lmtelies t  2tr(rpiodlm nlfvsa( s2tr(r ;o1aee mfctas sDrmuvsnu) lxoxf oydlm eaivilt srto(r3oy4aptelfesasf 2tm(mpnu0olxomieiysla2elu p u)treoxf3to1latrlnvi t  etmio3oo1lpt mfvsat)arum(mpnt4tpe ifeiatlaDeanms () ltrxo oadoptelu ilt teumxr nodlpeemieia()a2taur no1tex ifctldfaDua( p t0 renmr oydfmtranvi;( srtoxmpnydamte ncta()arurxrpnu0aptomf3tytls uaumonu0 ltoio3to1laD au o;s srxrxm3ny4ol  mics (fsDumuronu4tet io3iad sDumn snu)arxoxr oy1fa r ivi;(0 rur(m3no1lle  ieilt  2ra(  ;o0texo octydlaDua(vo t4trxnmo iatoat  ivi s)trtmio3nodam eliviltf Drmuroou0olt mi3tyd s eln p;t0artoio3oo1oaDean olt0 2xoxo3oudoleelnciasfsrtax  ot1olen ieiysfaDrm(vsn(0 leoif3totfaDrauei s0 rxoir oy1alte nvi s)aDrmx o;u1olxn iciltlm emnvonu0tltrxr tydfmte nei ()srtoiopiudaltnlfvsatfs2rmum ou4aeen f3tys s2eanmp;() ltrir3iotopDeai i t)teto(r3nodaltelncilsfaDrmump;o4tpx ifcilsfsDuanvo;u0tetnmr3io1fmDe ivsl()sruo(mpnodam   fciat)s2tr(mo;t4tle mociyslaDelu p;(4 leoirctadoaDraivi;t0t2umim ny1am  lneta( srrm(mo;t0teeo oeiadfs umuvs;(0trenmo3ia1fpDr ies;s)teuoio no1ome mfesa() rtmu p;t1tpen ociysls rlump u)tlxnxocoydla  lnes;(0teumim3no1lpee ietls aDua(  no1oet micias a rln o;t0trxoio tydomt luvi t teurio3ny4ol  licsas  rua(mo;u0tpe  o3iltfa rmu p (0aeeoxo3oydlpDrai olt texo(m oudapen fcias)arrm(ro;o4oet mfeiytfa2rl(mont4trtomo3ia1lmtraivils srxr(m iu4apee nvsa(f Dumxm ot0apen fctytls ulnms;(4artrxfcoo1lpDe i i;t0trxm(r3iodal e ici ()a2uaur ou1altn oeiydls2umnvsn()arenxr3tadfat lnei;t srxoxm oo1omen fciat) 2ururpot0opt io3tld m2umnmpnu4arxnio3oytfmtelnes;(  etrxopno4om elncsl() 2tmxront1tlt  fciatfaDuan p;t)treoxociy1oaDeanvo t  ruo(o iu4oleelivi (faDurxmpoo1tetomi3iad mDrmumon() etoxo io1fmt auvi;s  2tmxmpno4llt lnvi tfa2taurpoo4oeeomiciat m eanms t0arxoir3to1fa eau o s t2urxm3no4llt miciltfaruaur ;t1olx mfctad a rmumsnt0 etnif io1laDrauvs;( teumio3ny4open fvtlsfsrraurono1oee ifeild sDranvsnu)alxnif tadoptelieo;t0teuoxo3oudomtnmneia(fsrrrumooo1tle  f3iasfa uaumo u0 rerxfcia1opDelnvo;s)trxr(m3iu1aleemnvt sfarrau  ;u0tlt miciytfm umuvpnt4arerxfctodfatrli sls0t2uoxmpno1alte ieia(f Draxmp;t0tpx miciatlsDul(vpnu0trxrioctydla elivo;(0setrxm oudop  mncia()arumx ont1teto oeiasla2ulump;(0 leoxr3tadlpt anvi (0sexmxm3ou1aptnmfci tf 2umum ;u0opxomfctat a eauvonu4treoif3oy1lm eluvi t0trxoio3iy4apte nct sf Durxr nt4oeenmieiydlsDeln o;t4altoif ia1fpt lies t0 rxmio iudopee ivta( aDtr(r ;t1opt  iciyd s ranmsnu4 leomr3oodfaDr uvi;(  rumxm iudale lies s)sruax onu1aetnmfeiytfsDuln p u4 etomrcty1opDe nvolt s2toiopou4lptnmneilt)aDumuro;t0oeto oetydlm2rlu p;(4tlxnxr3oy1laDraieo;t)t2tmxopnudop  livi s) rumx o;t1alxomfeiyt a2ul(vp;u0tltomo3ty1lptrauvs;t0 ruo(opiydameemiet t)srrmxrpno4aptnmf3iaslm2ua(ms t)treoio3oydfm r nvsl(0tetr(r3oo4ll emietas) 2ur( oou0oexo oeiyt m uan ont)treoxo3ta1fmDe ivs;()s2urim oudlmtnmieias  rtrxmooo1oexnii3tlt m rlnvs (4aetnmfcia1faDr nvsl( teumxmpny4apeemfciatfs2umxrpot1oet  oeiyd a rm( pnt0teerxfciytlptranes;s) etoiopoydomt mnvsls  Drm( pou4tle  octldfsDelumo;()teeoifcoydoaD aneils t2umimpny1olee ivtltfsDum(mo;u0oeeomiciysfa ran onu4arxnmr3tydla e ueil( tetrxm no4optemncias) rtru o;u4alt ifetld sDranvo;t4trtoirctodopDraueo;s t2tm(r3nydlle  fes s)sDumumo;t1ope  oeiatfm umu o u0alxoxo3totlmtrln o s0sexoiopoydaltnlfvslt)aDum(  ot0tpen iciltfs2eln p u) exrmr3todlaDe ivilt)trtm(r nu1oltnlfvtatfs2uaxm oo4oex  ocildlmDemn p;(4 rtomr oytfmtelu o;(0 exmir nudaleelivtlt)a2rrxm ot1oeenmieiasfm2umn p t0 reriociodlpteaieolt) rxoxo oy1lltnmncta(fs2rmxrp;u4apen ocilslmDrau ont)altrxf tatlaDelueo;t)setr(opiy4ole lfesat  rtm(r ;t0teenmfciltlm el(vp;u)aetoiocoytlaDe nesls)t2xo(o3ny4am  lfvsltfa2umu p;t0tlenioctatls rluvpn()aetnir ootoaDr ivols t2uoxo no1lm elivsl( artrxm oo0oexo o3iadfsDelnms t0 eenxrcio1la  au o;s)t2xo(o3nudlmtemiet ( sDtm(ront4tpxo fcild sDea( snu4aexrif iatoatran i () rtrim iodape mfeslt sDtr(rpnu0apto f3iyt m2uanvs t4teenmo3oa1opteaieo s0 eto(r iy4llee fct t s2ta(r ot1aex if3iasfs2rau p;t4tlxomf iadom  ai sl( t2tm(mpou4al   feiltfsrrrx  nt0opx mfciasla rl( o u0tlenircty1omDr u il(  2tmxm oudapte fes ()a2um(mo;u0tet  ictytla2ranmo;u0tlxnmfciy1omtr n s;s0t2tm(m nudlltelncslsfsDuru onu0oeenifctasfa2um( s;(4alerxfctatfp e neo s sexoxm oo1apt mivil()aDta(m no4opeoioctad m ea(vs u) rtoxr oodfpte ies s  rtmim3oo4lle lnvsatfa2ua(  ot4olxnii3iydlaDua(vo;t)texnifcoy1lmt lnes t0 rto(r iydopeelivsa(fsDraxrono1tlx mf3tltfm ea( p;t0treomo3tydlmDrluesl( texoxr iy4llen nvs s)srur(rpno0aetoioeiytls2ea(msnt)altnxrciadlm e u ilt0srxm(m oo1openlfesl(  2uaumo;o0tetnmo3tltfm2rl(vp;t4 eenxf3oatfpt aivs t trxo(o ny4ll  lfvsat aDtruroot1aee mfciasfmDuan sn(4aexnxo3iotoat lu i s  exo(m ou1ole mfesl(  Draumpnt4tetnmo3iltlsDemu o (0tetnio iatomt  ieo;s) rumim iodameelfcsatfsrrrx onu0tex  feilt m elu pnt)trenxo3oodoa ran o s  2ur(m oo1op emneils  2urur oo4opxomf3iasfsDuau o u0aetnxf3iatlp   ivi;(  euoxm3oydame  fvt ()s2ra(ro;o0teen fctadfs2uaump;t0 lermf3ty1fpDelivs s) eurir iodlm nliesat)aDrru  no0aetoio3iatla umn p;(4tleoxrciadlm e iei;s) rur(m3io4lmtemictls arurxrp;t0texomieiyslaDuanmonu)alxnmf3oydfm   nvilt) exoio nodol emfvt t  rtm(  ou4aptn feiatfsDra(vs t0tlermrctadla elueils) exmirpiy1optelfvil(fa2rr( ono0opxo f3iytfmDrmuvsnu)aeenxo io1omDelnvs;()trtrio3ou4lmt  fei ()aDur(m nt4olen octatls rlump;t) leoxo3ty1fm e uvil()tetmir3ou4apee ivtasfartaxr ;o0tptomoeiat m2ran ont)aetrmf3tytlpDeaivs;s trxrir nudalte fct s  2rrxr no1alxnmoetldls rmuvpn(0trxnxrctydlatr nvs;s)seurio3oodomt mictas s2rr( pou4tltnioeiltlaDuau o (0aexrxocoa1opDrauvo s0trxmxmpiu1amt  icsl()sDumxrp;u4oltn ociaslaDuanvon() eerio3oo1fpt lies;t0 rtmir iodopt  fvtas)s2trxmpnu0apt iictas a2em(mo t4teenio3iotom e ivi;(0 2tr(o io4ap n feil(f Dtru poo1aptomietldls emnmpnt)arerir3oodla  livsls0s2urir3iydal n ictas)aDumu  ;u4alx  i3tlt aDuaumsn()artoxr3ia1fate uvo s0 exmxr3iydllte nvtls artaxrooo4olxo o3iydfa rauvsnu4 exnir oytlmDran ols0trxriopny4ape lfciltfsDrax pnt0olx  i3iys m2rmn p u0aeeoif oatoate uvs;t trtrxopoy4alen fvslt s2tau pnt4apxomfciasfm em(mpnu0trtomfcoydfa rluvil() 2uo(o oudamtnmnctltf rrm(mp;t0tpx ifctls s rm(mo;u0teeoir totlm elivi t0s2trxo no4lp  mnci s)sDum( pou1tlxo iciatlaDemuvp u0arenmo ta1om eliei;t teumxr nydolt lfviatf Drmxrpnt1tlenmicild aDem(vonu) reomociatlmt aies ()truoxrpnu4ap n nvtatfarrmuronu4aptnioeilsfmDumnmp;u4 exnxf iydfaDeln o s0 rurim3io4lmtnmictl(  2rr(ro;o0tptniociyt s umumo ()trtrioctodfp r ivs;s)teto(m nu1open ici t)sDumum ou4tpx  f3ild a ua(vs;t4 ltnif oo1latelu il()srurio3iudol nmivsls  rta( p;u1apxo fetltls ranmo;t4tetrmo ootoat aivi s t2urxm iudlmenlici tf Dtr(m ;u0oex iieilt a2eaumsn()aexnif3oydlmDeln o;s0t2xr(rpio4ap nmfesl() rtm(  nu1openmo3ils a2uauvo (4treoxo iadlpDr iei;t  rxoxopoo1apeemnesl()sDrmx ooo4tpe  i3tatfm2ean p t0 reoxo oo1lpD  uvi t  2uoxmpoy1amtn ncia(fs2tmxronu4oexo fciat aDrmnmpnt0trtrirciytlpDeluvils s2xm(opoodol emictlsfsDumxrono4oex  ieiltfm rmnmp u0alxomr3tydlptrluei t)setrir3ny1amee ici sf Drmump;t0tpen feiysls2rl(vpnt)texrmr3ootoat an i;t)t2to(r3ou1lle  nvi (fsrrr(rpnt0aee  fctadfsDrlnms u4texrmf3oo1lmte ivo;t) eumxr3ou4lltemfci s) Dtr(root4oex  oeiad m2eau o;(0teeoirciadlateai olt srxoxr oo1lp nmiei sf 2rr( p;t0olto ociltlaDuluvs;t4tleoif iydoaDranvils s2to(o nodlp e feia(farrrurp;t4opeoiieiadls elnvsnu)aexnmrcta1omteanesls0 eurim3iy4ale  icsl(faDumxrp;o0oltnif3iasls em( o ()tlxrmrcoa1oate n o;t) 2urxr3io4omtnlici ()s2ra(r nt4oeeoii3iadfsDranmp;(0trxnir iodoat  neolt  eurxr iudomtelivil(f 2tauronu1aeenmfetadlm emuvon(4 renmocoydoaDrlivi t0t2xoxm3iudlptemnet s) rtm(r no0texoioeiadfm rmu sn(0arxoif iy1opt  u i;( t2xrxr oo1llen ics (f 2taxm no4apenifcils sDrau p () lxomr3oadlmDr ueo s srxm(o3ou1lleemnvilt)artruro;u4tptniiciatfm2rmumo;(4aetnmr3todoatrli s (0t2tmimpiu4om n ict (f rta(m no1tltn i3tysfa emnmonu0 leomr oa1fmD  ivs;t) 2tmxo iu4ap  mivsa(farum( o;o4opx mf3tadlmDrmnvont) etoir3iydlp  anes t  rumxm iu4ome lfci t aDtaurono1aetnmf3iatlm2umu p () exnxf iytla  aueo;t0texr(o oo4optelietl(  Drmxrp;o1oeeo f3iltfa eln pnt0 renmo3oadoa rlieslt srumxrpnydopt lnct s sDtrur ;t4tet if3iadfa2el(msn()texrmf ty1lmDelnes;()texm(r3iy1olen fcs tfaDraum ;o4oet io3iysfm2rmu snu4aetoxo3io1fmtr u s s t2tr(m3io1ll nmieias s2ururp;u1tpeomo3iad s rl(mo;(0 lxnxf3iadomDelivi s  euoxm3nydlmtemieils  Drax p;o0aet if3tatfmDean p u0altnmo iytoa r nes s truoxr oodap   icil( artmurpot4tlenifeiadfa rmnvo;()aexoxfctatfpt an i;s) exr(r iy1apeelfeiasfa2raxmpno4oltomoetlsls2eln s;(4alxnmocoydfpD ln s t)setrxo iy4alt lies sf Durum oo1aptn ociyt sDelu s t0trxoir3ty1oaD lieolt)t2ur(o3iy1lmtemiciat  2tru onu0tet miciadfs2ulu o u)tlxoiocoatfa elueols  etoir3iydapee fetas  rraxroou1opeomf3ildls2rm( s u0trxnif3iydlmDeln i;s trum(r io4op  mics ( artrumoou4optn ieild mDeau p;u) lerif oy1fpDr ueslt sruoxo nodlp  lnvt tfsDtaum ou1aexoiieiydla ra( s;t4trtnxf3iotlat aiei;s0trxr(o oo1omt liei t)s2rr(r oo1oetomfeiatls rm( s;() rtrir oy1fpDean ils) 2tm(m3io4omenlnei (fsrumxm ;t4aexo feiltfa2uln o;t4 exoxr iy1opDrlneslt seumim nu1amee fvsa(fs2tau pnt1tpenio3tasls2ul( p;u4 leomo iatfp rau s;t tetrxmpno1apeelics sfsDua( ooo1aleomoeiys mDulums;(0teermo oytfaDeln s;t0 etrirpiy1apenlfvsls)sDua( pou4alx ioeiadfa2ul(msn()tlxomf3oa1lmt  uvs s sruoiopiu1al e nct s) Dtrxr ;t4tetoiictydfa2uanvo t)trxnirciodlpt  nei t0trum(opnydap  lnes (fsDraurpot1tlxn fctatlm rln o u4aexnmr oydfmtrlnvil(  2xmxm oydapen fetat) Drrxmo;o0oexomf3iys mDuan ont0 etrxocoo1fa rlneo s s2um(o3ou1olenlies t s2uaum ;t1alen ictlsla ea(vo (4 reoxo io1oat aues t srtmimpoo1llt  fesa() rumx  ot0oee ii3iat s2elnms u) rxrmfcootoa eaiei;( trxriopoy4lptn nes sf rrmum ;u1opx micild mDrmn o (0trtrxr3iydomtrluei;t) rurim3oo4amtnmieta( s2ta(m ot0oexn fciatfmDem( on(4arxomr3oodlaDelu o (  eurxm no4omenlneiltfartaxmp;u1tlx mf3iytfmDeanmo u)aexnxocoo1lptrlies t  rurxo3nodalenmfcsl(f rtrxm no0ale moeiydfmDul(msn()tltrio3totfaD auvi;()s2xrim3nodalenlfvi () ruau o;u0tpe iieiasla2ua( s (4 ltrxf tydfpD  neol(  2tm(mpou1lm  liet t)srua( oou0oeenmo3iysfs2em(vs;u0arxomr todfptrau i;( t2xmxm iu4lpenmiesl( aDraxr ou1ape ioeiydfsDum(mp;u0tltnirctotopD ai s;t)setrxo3io4ame  fvia()sDta( p;t0texnmi3ilt a um(mp t0 rxomocoodlm   ues;s0sexr(mpoo4olt  netl(f Dur(mo;o0opt mf3iltfaDum( o;u4 lxnmfcoadop  liei;t)srtrir nu4oltnmieta(f rtm(  ;u4tpx mictldlmDelu pnu) rtoxrciodfaD  nvi t) etoxrpoo4lle lnct s sDtmur no4olto ictltlaDrmu p;t) etrmr ootlm elies ( teumxrpny1ome lfvtasf 2uaump;u1oeeo fcilslaDrauvo;u) leoxo ty1fpteau i;(0trumim3nodlmte icils)sDua( oot1tltn fciyt a ea(vp (0trxnxoctadfm  aneolt setmir3ou4al n nci t a2ra(rp;t1oexo oeils aDul(vpn() etoir io1oa rli sls setoxm nudap emfes s sDrmum ou1teto iciyt s umnmpnu0trtomf tytoaD auvo;s)t2xoxo3iy1lmtelfctltfaDuaum nt0olx  oeiyslm2ul( sn(4alenxr oa1faD lies (  2xo(rpnudapenmnct sf 2rruroou1aetniieilt s2rm(vo;t0tlxomo3ty1lp  an o;t tetoiopoy4oltn ivta(  2tr(r ;o1oeeniictlslmDran ont) renxr3iydlat  n o;t)seuoir io4am elfeia(farurur nu1tle  f3tadls rmnmonu)artnif3oodfaDe neilt t2tmxm3nydllen nvs s a2uax oot1oee ifciysfmDuan s u) leomo todlpt lieols) rtoxr oodomte feias sDrmu o;o4alxnmiciatla2um(vs u0 renmo3ty1faDeaues;t0trtm(o3nu1apte feias) 2taxrpno4olxomieiasfa2ra(mon(4 etrifctadfm ean ilt  etoxopiodlltelnesa() 2tmx pno0aleo octasfa rlnmo (4tetrif oy1oa  aueo (  2xriopou4lpe lnctatf Drmu pno4opxomfciaslsDrm(mp;u)aleoif3ia1opDraieolt) rtrio iudlpee nvtlt)srrm(  ou4optniieiad m2um( pn()teerifctatlm  luvi t)t2xoxr iydamee fcs tfa2tmxrp;o4oexnmf3iyslsDul(mont4 renio oy1omDr n i;t sexrio ny1lmt mnvilt s2rr(mo;t1apenioctydfmDua(vs t4texoifciydla r ieo;t s2trxr3nu1open ncs sfs2rr(m nu0aeen fetasls elu o;(4 reoiocta1fpt  nvolt)t2urxo3ou4lmeemfvtls) 2tru  ;o0tpen f3iysfm2umu s t)trxrmo iodlpDe ivs t s2tmxopnu1lmt lietlt  rtrumono1teeoioctaslsDeanvpnt)altnirciydfpteai s ()setrxm3iu1om  lnes (farta(mpnt1apxo iciad s2ulump ()texnmrcoodfmtelnvo;t0trxmxm iu1olt  icta( s2taumont1tpe moeiytlmDrmn o;t)treoif3ta1lm rlivs t t2xr(r3oo4am   nesls)artrxrpoo4aeeoii3tas m2em(vo u0 lenxfciadla eanei t0srxo(mpoydal nmfcsl(fsrrmum ;u1tpxnmf3tasfa2eanvp;(4arenxo iadom elu s ()teuoxo oy4lpen ict tfsDrm(r ou4tlx  i3ilt a umn snu)tlenxr iadomtr n ilt t2xm(r3oo1ll  mnctltfaDrrx  ou0teeomi3tytfm el(vo ()aeenxfcoa1om e ivilt)seuoxrpoudaltnmfesa() 2raum oo4oeto feilsls ra(mp;t4aeerifciatopDr u ilt0seumiopiu4lmtelfvslt)s2ua(rpou1texn ictadlsDulu snt)aeenif oydfp eli s ( s2uo(rpiu1opte fcsls) rtmxm no0aptnifeiysls rlnmpnt) lxrmrciytoptrluvs s truoxm3ou4olt lneil(  rua( p;u4tpt  ictld mDeau o (0artnmrciydlpD lnvils)s2tmio oo1ole mnvia(  rtrxmpoo4alxn feiaslsDua(msn()artriocootfateau s t0t2tr(m3iy4aptn ivi (  rtru pnu4ape  f3ilslm2umnvp;(0tlxrioctydfpD aivs;t)t2xm(o3iu1ll n iesa(  Duax ooo4openmf3tyd s2eauvo;t)aetrxf3totopt livo s seumxo3ou1alenmnct sf Dtmxm ot4apeo oetydfs2em(vs;()tetnif tadomte n o t0texoxo iudoltnlfci sf 2rauroou0tpen ocildlaDumuvo;u0arerxr oa1op   i i;t)setmxmpno4lpenmivi s)sDtm( pot1teen iciad m uaumpn(4trtnxo tydomDeln o;t0 exmir3ny4apt licslt  rua(mpnt0aptn fciasfm2eaumon(0artnmo3ty1fpte n il(0 etm(opnu1optnlfetas)sDrmxm oo4opeomoetldla2eaump ()arenmr3ty1opt au sls0 2trimpoydapeemnvilt)s2tru p;o1tlx mocildfmDeaums;t0aetrxo iydom  livsl()t2urio3oy4omtelfesasfsrtru pnt4aleomoeiltfmDuanms (0 ltoxr ia1omDr ies s0 2trxo oydll elnetlt  Drmu pot0oltnifeiys s rlnms;u4 exoio ta1fatrlu i s) exoimpou1optnmivt s)sDtr(rp;o0aptomieilsls rlnvpnt) eeomo3oo1omt  i s;t)t2umxopno1amt  nei ()srtrx pnt0olt mictatla ua( on()areomr3tytomDraiei s)srtoxopiu1lle lnvslt)sDtruront4altnmicild a emnvs;u) reoir oytlp elnvil()trxm(rpou1amte nct s) Dra(rono4tpe ioeiydla el( o;(0teenxr to1fpt ai s;s seuoimpiudoltnliesa()a2trumonu1tpt iictasfa2uauvs t4altnxfciy1lpteluei;s0srumir iy4ll elfcils a2uau  ot1optomfctytls2elums;t)tlxrif ta1fm   uvsl(0trtrxo io1lpenmnci t)arrmxrp;o4alenifcildfsDuaumpn()trermfciotlmteaieol()t2toir iodaleelnctlt  2uau o;t0optoioeiasla rl(msnu4 ltnir oatoaDeli o s t2xrio nydlpt lnesas)sDtm(  nu1olenmoeildfsDuanmp (4artnxociy1fpte nvsl()sexrxr3iy1ol e nctas  2ta(  ot1aexnioetytfm uanvo;u4artomr todoat luvolt)setoim oudap nmfet t s2umuroot0tet mo3iadla el(vs (4alxoxf iatfmDrlueo s) exm(rpiu4al elivt s)sDtax ono4altnmoeiysfmDraumon(0trtnir3oydlmt  uvols0setmim nodlmtemfvi ( a2rm( pno0oex  oetld s2ua(mon()artoio3tatoaD li sl() etoxm ou4lpee fcsl()srtm(m ;o0tleo f3iat m ranvp ()arxrxf oadlpteanes t s2uo(o oy1ll n nct t) rtmum ot4aetnmociatlaDum( p;u4 rtnifciy1faDeliei;(  2trio3iydlptn ieias  Drmu o;u1texoioetadls ranmo u0 renio oatla eauei;s0 2xm(m iy4apenlfesat aDuax o;o4olen ociadlmDumu pnt4arxrioctadomD anesl(0trurirpny4lptnmncsasfs2ua(ro;o1oee mo3tld s rlump;t4tltrxo oydop  au slt0s2xr(opnu4amenlnes sfaDur( o;u4aleomo3iadfs2ulnvsn(0trerxo3oy1lp  auvol()srtmiopiu4llt lnei t  2ta( pno1apenmociat s ran o () ltnxr3tadlp  aivsl( texoxm oo1am  lici s)artr(  ou0ale iieias sDeanmpnu)tetnxfctatla rau ol() 2xrxmpio4open ivsls)s2ra( p;t1tee if3iadlmDua( o;t0tetrxrciotfaDeanei;t) 2xoimpoo4amtn ici t aDtruroou0opeo icias m2ua(mpn(0 rtnxo ia1fatr u o s)texmio iy1ape lfeil(faDtrxr ot4oltnif3tyslm2ea(vs ()aeenifciytfa eln sl()t2xmim no1omeemnvsas)sDtm( pnt0altoif3iytla umnvo;t)alenmr3iodfm e i o t s2xmxo oodalee fvtatf rrmxrono1apt iiciydlm2umn s (4tlxnxr oadlaD aneilt srxoimpiu4ome lfet (fsDtax o;u1oet ifetaslsDrl(ms t)altrif oydfp  auvs;( truriopiydopenmncs sfsrtr(mono4olen oetas a2elu s;(4texrif oytomtelneo s truoxmpiy4altemfcias artm( ooo0oee  f3iytfs em( o (0alxoir oa1la   i i;s s2umio nu1al n ncia( a2rax  no1aleo i3tltfm2umn p;(4 rerxf iotfmD  neo;s  exoim iy4lp  lnci t) rumxm oo1aptniiciltfm ulu s t0tlxrmo3iodlmDraivo;t0trum(opou1omen nei (fsrtrxmpou1ole iociadla2umnmp;()artoir tatopt lieolt0 2xrxopiu1oltemiesat artmx  ot1oet if3iasfsDea(vsnu)tetnmf tydopDe nvils)tetr(o3oo4alee fesa() 2rrx ono0tee iiciltfa em(von(4teermr3oy1lmD  neil(0sruoio ny4aptnlfci tfartmxro;o4oex mf3tld s2ua(vs u4 rxrxf3oy1op  lneolt  etmxm3oodamenlnvsat) rra(r oo1alxniieildlmDuanvont) rtnxo oytfat  u i (0 rxr(m3no4llen iesltf rtm(moou0tleomicilslsDeauvsn(4tlxnmf3tatlmDeaueslt)texoim iodameelnvsasfa2um( poo1tlt  f3iad m rm(ms;u4teeoif3oadfpDe ivols0 rtmio io4lmeeliei t artrxmono0alxomiciatlaDrln on(4 lxrmf oadlatr ivol()teuoxo oo1lmtelfvi ()arrru  ot1ope  ieiatfsDrauvp;(4trtnmocoy1opte n il(0seumxr iy4omtnlnesa()s2um( oou0tpt iocildla2eau p;(0trxnxo3oo1lm eln olt) rum(r iu1om nliciat) rrmu ont0opxoifeias sDrl(mo;()artnmf3io1op   uvi;( srxrio nydlme mictltfs2trxm ;t0tleo ieias a2uanmp;t4 lxnmr3iotlpDe i olt)trxoxr nydalte ietl()aDrrxm ot4oee  iciys s rl(mont)tetriocoatlm e u o;s0sexmxmpiudoptn ictlt srur( onu4olxnmi3ild sDuauvpn(4 rtrif3oa1fm eai il( trtrio oodop  mncs s s2uaumo;o1tet mfetatfmDumn snu0 exoio3ty1omtran slt0seum(mpno4apenmfvia(fa2rr(rp;t4apx mfeiytla umnmo u4tlenmocta1fpteluvo;s truoxm3iy4om n ics (f Dururo;t0aee iiciadlm2rmumo t4tltrif3iotfpD anvol()teurir oo1omtemnvsltf 2trurp;o1tle  ictltla ul(vpnt4 rxnmo iodoaD ai ils trxoim nu1altn nvs t srrmur ot0apx miciat aDul(vonu)teeriocta1oaD  u i;t)texrxo nudol  lnvtas srua(r ;u1aex  f3tls s2ra(vsnu4 leoif iatfmD  u ils s2xm(r io4lmeemfvtl( sruau  ;t1aee mictltfs eanvo (4trtoxocta1omtr uesls  etmir oodopt mneta(  2ua(r ot0tlt  f3iatla emu sn(0 rtnifcta1lp rlivslt)teurim io1lptn fcsa(  Dumxm ot1tpenmictltls em(ms t)arenmfcoo1lp e n o;s0setm(rpou1lptelict (f Dtr( ooo1tptnmoetltfa rl( s;()aexrmo tydomtrluvsls trto(o3io4ol emneiltfa2tru oou0tpt iicias sDea(vs t4 etnmfcoy1oa  lnvs (  exoxo iudome livsl( s2umxro;t0tpt mfciyd sDum(vs (4 rxnxo3oo1lpD  ueo () 2urim no4ameemfvsatfaDrmumont1oltniieilslaDuluvp t0tlerxf3oodlpDraneo;s  rxo(r iodlleelneslt  rururpno1tpt  feiad s eluvs () rtnmf3iodomDe u o;t srxmio no4am emnvsa() 2taum nu1tetnif3iasfsDra(mp;t4tleriociatoa eai ilt0s2toim oodoltnliciat s2rmxm ot0tlxnif3ias a ul(vs;(4tetrmf oadop e uvs;()seurxr3iu4lm n icsa(fsDuaxmpnu1oltnifciltfs rluvp u)trxoifcoo1oaDeauvsl() 2umir nodlle lfcsa(fsrta(ro;o1teen i3iyt aDeluvsnu0tlxrmrcoodlp raivol(0srto(opnudopt  nvi t a2ur(  nu4opto ociltlmDean o;t0 eerxo oadopte u i;( teur(o3ny1ll n nvtlt)sDraum ot1oeeo ieiadfsDra(ms u)alerxr3tytoatrlu i;( srtmirpno1lm   fvs ( s2tm( pot1apx  iciysfm2rl(mp;t)tetoxr iydopDeluvsls trxoiopou1opt  fes sf rurxmpou1apx iocils sDrmnmp (4arxnxo3oatlaD aneolt)t2xo(r3iu1apen fcil()a2trx poo0altoif3tlsfm2rm( o;u4tltoiociy1fpDe u sls0srtoxopiu4omenlfcsltf rrru  ;t0opx  fciytls2rm(vont4alxoxf oadomtr ivol(0sexrim3oy1llen iesl(farum(m ou4tptnmictls a2rmumo;t4 eermo to1lp  luvils)seumirpny4al   ies (farrmuroou0texnmo3ilslm umnvo u0tlxnioctadoaD lies;(0srtoio3oydom elfvt s  2uru  ot1tetomietydfsDean o u4arxnio3ootlmtranes;t0sexoxmpno4omeemfvs tf Drmur ;t1opeoifetasls2rmn o;()texomfciytomteai il(0t2xm(m3ou1op e fvtls srrmxr ou4opxo ociydlm2em(vpnu0teeoxr3oatlmt  ies t)trxmxo3ou4op  lics s)a2ua( pou4oltoio3iyd s2um( s t0aetoif todfaDelies;(0 2tmio3iy4al nmneiltfa2ur(moot1tpenifetasfs rm(mo u4 rxrir totop  aiei;t0sexrim nu4ol elncsls) 2tr(r ;t1oex mfeilsls2raums (4texoiocty1opD  neo t0t2um(o oydll  mfcsatfs2raurpou1opxoio3ilt aDrl(msn(4 lxoxr3oadoaDe uei;t) rxmxr oodomtemics tf 2ua( ont0opx  oeiatla2uanvp t0trxrmocootopDr u sls t2tr(m3iodam e iet sfs2ur(mont0oeenio3iyt s2um(mp t0teenmfcoadfaD lnei;s s2toio io4llenmfetlt) rua(mono0tpx ifeildfaDrm(mpnu)aleomo3oytom  anei ()trxrim3iodalt lfcil(  Dtrur ;u0tlxnifcias m emu p;u0aexoif oytla eai o s trtm(m3iy4aptemncilsfs2ur(r ;u0aetoiieiyt sDum(mo;u0arerir ta1fat anvilt)s2xm(m3oy4optemfeia() Dtaumo;o4tpeoiictad a rm(vsnt4aeenxfctodoaD ai ils)seurir oudop  lncia( a2tr( pot0apx  ieiad s2eanmpnu0areoxfctatlatrlu s t0 etoim oydopenmfctatfa2urxmpno1altn o3ilt m em(mp u0aexrif3oo1oa eluvo;(0t2xr(o3iy1ap emneil( artmu pno0aex iieiadfs2el(vs;u)altrxf3iadom eln ils0tetoxr3oy1ll nlfvi (  Dtaxrooo4oeeomocilsfs uau on(4teenmo iadfpte u i;s) eumio nodope lnvta( a2taumoou0tpt mociyslmDum(msn()tetoifcoo1fpte u o t t2uoxrpno1apeemnvtasf Drm(  ot1tpe  fciytfmDeln pn() leoxf3ootlmtrlueo;(0 etm(m3oy1lmt miesasfsruru onu0olt ioctyd s rluvsnt0 exrxr iatoat ai ol(0sexr(m3ou1ole lncilt  Dtrx  ou0aex ioeiatfs2elu s;(0aetoxo3to1fa r nvi;s0srxo(o oydope mnvias  Dtru  ou4aetn o3iatfaDrmnvpn()texrxfciytla eaneo () 2xm(o3iodome lneta() rrmum no4tpe moeiasla2eln o t4arenxrctotlp r nei s0t2toxrpoy1amt lictls)artrxrono1oex ii3iltla2elumo;t0treriocoydlmt ln s s0s2xrirpiydop  mfcsl(fsDrmx  ou4aptoio3iltfa eau ont) reomo3tatlmDe nvi s)sruo(r oudol elfvtlsfaDrmx poo4oleo ietaslm raump;u) lxoifcto1fateln sls0texmxrpoy1ope  fvta()s2uaurpot4oex mfeiltla2elnvo u4 ltnircoytomDe ieils)srxmxm3ou1ape  ivt (fsDrrxrpoo4aptoioeilt mDemnvp;u4aetrir3iy1lpt auvo;t  2xo(opno4lpeemfcsls)sDumxronu1opto ictatlm2uln o t0 ltnif io1om raivs t0 etmxr oodllenlici s  Dtrur ot1apt mfetlt s umumonu0teeoxfcoy1lm eaueo;(  2xm(o3oo4alee fes tfarumxrono1olxoiociysla2ranvp;(0 rtomoctodom  lnei t teum(m3nu4opt livt (  Dumxm nt1apen iciyt m ran s;u4aexoir iytlpD  uvol()s2xmir3iu4altelietlsfsDtau o;t1opxoio3ils a2rmu o;u) exnmrcto1oate ueil(  exrxm iudopeemivs ( aruaxr ;o1tpt ifciys s rlnvo;(0tetnxo3oatfptrlivolt tetmim nu4omtn fvslt s2tr(  ou0olto oetadfmDua(vsnt) etrircty1opt  n ils0texr(rpnodope lieiltfsrrr(  ;t1tetnmfcilt mDulumont0altriocty1fmt  nei;s0s2xmim3io4lmt  feta(  Dtrumo;t0oee if3ias aDuauvp u)arerif ty1fa eli o (0srtmirpiodaptemicilt) Drru oou4aetnioctasla2umuvo;(0teeoxr3ootfp eaneil(0texr(r3io4lpe mnct ()srumumono0oleniictys s2ul( o u0tltrmfctydlm rau ilt t2xmxo nodlm  livtas  Dur(  ;u1aetnmfciysfmDemuvsn()aeeoif totlm   ivi;( sexm(rpiydlp nmnes t  2tmurooo0apt mf3ias s emn p ()aetnio iodoaD au i;( texrir oy4omtnmfctlt)aDua(ro;u0tpx mictldfm2umumpnu)aleoif3tadoa eau o ()teumxr3iudamtemnct s)sDur(moot0tpxn i3iltfa eanvp t)aleomfctydlp r neo;s0 etmxrpny1ll n iet s) Durxm no0ope iociad m el( p ()tlxrmf ta1lpteaiei t)t2tmim nu1lltnmfet ( a2umumono0ale ioeiatlaDeau pnt4 lermf todlmDrau ils) exm(r nodalt livtls)aDuaum ot4tpeomf3tysfs2eaumont0tlxrmo3tytlaD  nvi (  2xoir3iy1lp nmici ( aDrr(mpot1tptnii3taslsDea( p t)texoxf3oo1fpt au i s texmxo3ny4ame mfct ( arrmxroot1opt ifeildlaDemnvs u0artnif3to1op rli ilt)sruoirpio1ol nlfci t sDraxroou1texn oeiyd mDumnvp (4 leoif3ia1lmteauvs (0trxo(r ou4apt  fei s)artm(rp;u1olenmfcias a rlumo t4 etnmr oy1fp e i o (  2uo(o nudam  lfcslt srumx o;t1teen ietatla2emnmo t0aexnmr oadop r u o (0 2to(rpou1ol n nvi (  Dtaxr ou1oexomictysls ul(msn(0aexrif tadfate uvils srumir3iodom elivs ( a2urx  ;t1teto ictaslm elnvo u0arxrmrcty1la rln s s0s2xo(opoudlpee ncslsfsrrm(mpno4oex  oeiat a2elump (0 lxrir3iadfmDranes;t0s2trim3nudam  mnvi t  Dtaum ;u4teto fcilsls emnmo;t0alenifcio1lpt ln o;t) 2tr(rpoy4ap emnvtl()sDrr(m ;o0tle  feiydlsDuanvo t)tltrifcoy1opD ai il( texo(m no4omen ictatfartaxrpnt4altn iciadlm rau o;t0teerir3iydomtrln s;s0teuo(m nu4opeemfvias s2rm(m nt0tleo o3iltls uanvsnu4 ltoio oa1oaDeanei ( srtmio3nodaltemfvi t  rurx o;t4tptn ieiasla2eln snu0 rxrir3tadom  au i;s)trum(opnu4ol nlneia(fsDtrxmpnu1aptoioeiytla umn o;(4 eerio ootla eln o;s) 2umio nu4am  mnvtls a2uru  nu1teenmiciyslsDrlu snu4arxrmfctodom elivslt s2toxr ny4ole  nvs sfs2rmx p;o1oeeomiciasfa2rmumont0teeoxf tatfp eai s;s0srxmxopoydom elfctltfaDtm(moot4aleomicils m el(mp;(4treoxf oydlmt  ivi s trtr(m3oo1al   ncsa(  ruau pot4tlenii3tyt sDrm(ms;u4tetrif tatlpDrai o;s0sexm(opoydamee netl(farrru  ;o4olxn o3ild m uauvpnu0aexoifciadfpt liei t) etm(m3iy4om nlncsl()s2ua( poo4opxomiciatfa2emums t0trtrxo3iydfatr ivs s  exrio iu1al elfvi sf ruau p;u0texomfctytfm2emn pnu4trtoif ootlaDrai ils  2toxo3iodllee icsls) Drax poo0aexniieiyd s2eanmo (4 renxocto1oaDeluvilt s2xoxr oo1lp  lfeiat)a2urumpnt4texo iciad a2rm(vont)aleoir3todfa e iei;t teumim nu4amt  fvs (fsDrrxmont1opx miciatfm umnvsnu4tltrmf3oa1lm rln slt0trumxm3oo1lmeemfvsatfsruaur ot0aex  f3iadla2rmn ont)aeenxr iadfm rln o ()trtoio nu1ll nliciatf 2rm(mooo0oltnmieiat m2rl(vsnt) rxnif oadoptrli sls0teumir ny4ome mncsa()a2ua(m nu1tpx ifetlsfsDrmumo;t) lxrir oytfat luei;() euoim io4altemnvils)sDuaxrpnu0oet  f3iytlm uan s u)trerir3io1la r nei;s)setm(m3oy1amtn ivt s artaxmonu1tex iocilslsDrlnmp;u)tlenmf tytlp eaies t)trtr(m oy1altnmncsls a2rm(mpou1tlxo ieiysfaDrl(vs;(4teenir todfpDr n sl(0setr(o3oydal nlicsat) 2trxrono1tleoio3iydfm emnms;(0 rxrmrcia1op rauvi t teumxo3nu1ope  nvslt s2uaur ou1tlt io3iltlsDeau pn(4alxoif tadlm raieols  ruoxr iu1aleemfviat artmump;t1oltoiieiysfs2eanvp;u) eeomr iytomDrlu s s0 rumxmpnu4ap n nvsatfarum(rp;t1tle if3tld m2ulnmp;(4 ltoir3tydopD  ivols) 2xo(o oo4ol nlfvilt)s2rr(rpoo4olxnmo3iyd s ean s t)altnxociodfp e ueo;s0tetrxo oo1lme mfesa(  Dtrx p;o1oeto icilt a rlumsn(0 eenmo oadfpD  ivslt s2tm(m oy1op eliei t arrrum oo4tpen iciyd mDumnvo () lxrmfciytlmDeli o;t setrxm oo4om emnes t sDrm( p;o1texomietasla raumo u) rerio3oytom r neilt0trurxm oudam e ncs sfarrru pot4teeoio3iyslmDuln p;t0 lenmr3ootlmDr uvo;t seum(r3nodope lfes tf 2ur( o;o1teeo o3iysfa rmnmpnt)arenio to1om eau ils0trxmimpou1ole mictas) 2ua(mpno0ale  icilsfsDea( o;(4treoxrctodoaDrlnei;s)trtr(m3no1amtemieil(farraumpnt0tpx iietadfmDrmums;u4trtrmo ta1fp   ivo s0 rtoxrpoo1ale  feta(f rra( pou1open f3tldls rmuvonu4aeermf iotlaDeai o ( s2tr(m oy4alen nvt (fsDtau p;t4tptnif3tat m ea( ont0 exomrctydoa  luvi;t t2xm(r ou4alee nctlsf 2uaurooo1tle  octadls umnvp u)arenmr oydfat  ivsls)teuo(m3ny4ll n ieilt)aDuru pnu4tpeomfeiatlm rmnvp u)arxrxr3oatomteluvol( teur(r oudaltn fvslt s2rruronu1oexn oeiltfa umu s;()trtnif3ootlmD lueilt trxr(opou1ll elfvt tfsrra( poo0alxo f3ilsfaDelnvo t4 lxoxr3iodlpt auvilt0 2tr(r3oy4om nmnvi t)sDtr(mont1oeenifctasfs eauvp u)altnmocoy1fptrli s t0t2uo(r oy4lpeemfci s artmu pnt4olt ifeiyslm emuvpn(0tltrxo oatfmt lu i;s setrim3ny1llenmicilt)sDtr(r ot4tpe mictatfs2ua( pnt4trerxrcoa1lp e u o s0srxmir no1ap n fvi sfsDraumono1tptnmoetltlm ran pnt)tltoxf to1lpt aies;(  euo(m nudlmen neia() rra(  ;t1opto ieiyslmDuau o u)aeerifctytla elivil()trtmxo3nodal   ivias srum(r ;t1oee mieiltfsDrmuvsnu0arenif3oydlm e neo;s s2xmiopou4lpe lfcsltf 2raxr no0aleo fetyd a2ean p t4alerxr oo1lmtrln s () rtoimpno4lm emnvil(fsruax  ou1tpe  fctyd a emu s t0 eerxo3oatlmDrluei s s2xr(o ny1olen iei s srta(  no0olt if3iysfmDea( o;t4aetoxr3io1om elueo;( setrxmpoodap  micsl( s2rm( o;t4tee  ieiat aDrmn o t0trxomf3to1omt luvs t t2urim oydal n fviatf rtm( o;o4altomo3ildlaDel(ms t)trxnxo3iydfpt  n s t)teto(m ny1ol n nci ()aDurxm oo4apenif3tlsfmDrlu s t0arermoctatfpDe nesls trxrxo3oodoltnlnctlt arurx  ot4teen ociadfsDrm(mp t4teenxo oodlatr n o t)teuo(o3oo1am  livt s) 2tr( pnt1texoifciytlmDulnmo;u)treoiocio1fm  livsl()t2trxm3ou1op nmncsls a2tm(rp;t1tleoifciysfs umums (0 rtnxr3totoaD ln o t0tetmxmpoydlmtemfcsl(fartr(mp;o0opxn ieiltlm2rmuvo t4altoir3iydlm elneilt) euoim3iy4olee fvt sfa2ra(m ou0teeomfctadfs uluvo (4tlxrxo ty1lpt an s;s srtrir ou4lpeemfeil(faDrrumoou1oltnmieiydfm2umnvonu4alxrmocoodfa ran o;t)s2xrimpno1alen ivt (  2raxm no4oltomi3tlslmDemu p (4 lxrif3ty1fpDe n s;s) rumxr3iy1ome lfcil(fs2ra(rooo4apx iociys mDem(mo;u4 ltrif oydfm r i ols  rxmxr3ou1omeemneiat)a2tr(rooo1opt mieiadfaDrmnmp;u0aeenxo iytoaDe uvils)t2tr(o3nu4olt licils  2uaumpot1tet ifciat aDumumo;u) ltnmr3oo1lptranei;t) 2xoxo3iodol n ietlt) 2ururooo0oetoifctlsfaDemn ont4 exnmoctytlatr ieo;()setoim3no1ap elivi tf rur(roou0apxomiciydfa2ul(mpn(4altrxrcty1omtrlnvols t2trio3iudlle mnvtl(  Dua(rp;o0ope mocild m elu snt0 exoxr3oadoateluvi t  eum(rpny1op  mfetatfsrtrxm ;t4oet mfciydlm2rlums;t4tlxrir to1op ranei t0trtmxm iy4ll nmicsa(fsrtax oou4opx mf3iyd m rl( pn(4 renxoctydlatrli i;t trtr(m no4opeemnvt ( aDrmumont0tlto fciydfa2rmu p;u)altnmr oo1fm   i sls0s2tr(r oydlp e ivt s  ruaurpnt0tetnifetlt m umuvs t4 lenmr todomt lieo t0trxo(r no1lmte fvs (fa2trx ont1altn ietadlmDeau pnu0artoxrctatopDrai o (0t2uoir ou4lmee ictat aDtau  ;o0tee ii3iatla2ea( ont0altnifciadlmDrai s s0 2um(o iudomt  ies t)a2ta(m oo1ole ifctysfa rl(vpnt0 etrio tatfa elu i;t  etr(o3no4ame mivtlt)arrmumpnt0altnmfciltfs2ranmo;t4aetoiocoytfpDrauvs;t) 2tm(m3ny1op  mfct sf Dtaur nt1tex moeiadla rln snt0 eenif3ootfmDeanvo;t0 euoxr3io4ap emietasfa2trurpnu4tlxomi3iytls rau p;u0aeeomf3iatfpDe nvi ()sexrio3iydope mfcsls sDrau pnu4tpt mfciat m2ra( p;u0 etrif oadlpDr ueol( setmxopnudll n fvi t) 2tm(rooo1aeeo i3iydfsDumn p;u0 eerxo ty1om  aueol()s2tm(rpiu4lp elfcsa( aDuauroot1alx ioeiaslaDrmnvp;(0 lerio oa1om  ln s () exrxo3oo4alenlicsat)srrmu  no0tltnio3tad m2ua(von()artnif3iytfatran o ()srurio oodlleemfcsas aruaurpot0oleo feiysla2ulnvo (4altrio ia1lpt au o;t0tetoxm iy1apen ietat) rurxrpno1apen fciydfm2umuvs;t4texrxf3iytlp ran o () 2xoimpiodomenlnctat arrmu  nu1ole  ocils s2ean o;u4trxriocoydomt lnesls  eurio3io4omt mfetlsfsrra(rp;t0texo ieiysfaDul( p;(4alermr3iy1fa  luesl(0s2to(mpoo1amtemfvia(fsrta(mpnt0optnmi3iasfsDuan sn(0 lermo3iydomDrauvi ()srtoxrpnu1apeemnci ( aDumx  nt1oexomieils s ul(msnu4 eenmo ta1la e nvs t0 2xrxo oy4ope mivtatfaDrmuroot0tpxnifctadfsDulu p t0artoio todfm eauvs ()seuriopnu1lmenmieiasfs2trxrp;u0apx ifciydfaDea( o;t0 eenxrcio1fateaivol() rtoxmpnu1llee ncils)s2ra( p;o0ape io3iatfm rluvo;(0 etoiociydomt ai i s0trum(opio4lpen nesas)sDrru  ;o1oetnifeils m2ulums;u4teeoxocty1op ean slt0 2xo(o iu1altn ncil()srraxrpnt0tetniicildfs umuvp (4trtrmr3io1fa  lues;()trtr(mpoo1op n ivs sf ruaxmpoo4aptomocild m ul(vo;t4altrmf oy1omt anvo (0trtoio iu1lmenmict t)a2ra(mo;u0tpxniicilslm ulums;u)treoio iadlptr ivolt0srxr(m nydapen nvtas a2rr(mp;t1apenmi3tldlm2emn p t0 lxnmfcoadomD lu ils)teum(opoo4altnmfvsls arur(moot4alx mfciysla2uau s;t0altomf3iatlmtelueo t0teurxo3oo1optn netlsfa2tr(rpou1alxomfeiyslmDulu onu0areomo3oytfp  lnvs s)tetmxrpiudomt  fvsas srrr(m ot1tlxnmieiysfsDrmnms t0aeeomoctydopDeanvils trtoxo oo4op   fetasfa2rrxr nu4tle iieiyt s um(ms u)altomrctotfpDr ues t0trtrxm3iy4apenmfvsas  Drr( ono4aet  ieias mDua(vont)alermf tatlaDrluesl(  2tr(m iydole miciat)sDua(rpno4altnii3ilsls umumsnt)trxoiocoy1lmt aivolt)t2xmio nu1apt  ncsl(fs2rm(root0olx mo3iat sDemn p;t)altrirciatomD auei;(0t2xmxr3iu1al nlivsa()arta(m ;o1altomi3iatlm2um(vo;t)artrxrcoytfm ranvi s0tetmimpiy1am   nes tf ruaxm ;u1teeo fetas m2ulu onu)tlxoxo tadfm rlieo;s) rto(opny1lleemictlt) rta(r ot1tlt mfeiasfmDrmu sn()tltnmf3oydlaD  n o;s) 2xmxr3iy4amenlfvs ()arrmurpnu4tet  ocilsfm ra( p ()aleoir ootopD  uei;s trxo(m3iydop   ietas aDrm(mpnu1tee  ocilslmDranvs;u)alxnirciy1lpD luvslt)srxoio3iy1ap elncsa()a2tr(r nu0tltn feiydfs2ra(mp;(0teeoir ta1oa e nei t) rtm(r iu4lm   fetl() 2taxmp;u1texomictadfm2emumo ()artrmo tatlpDr uei t0 2to(r iudolt  ivilt)aDtaxrp;o4tlx moctytla2eanmon(4 lxnmr3tytlptr n i s texm(opiy4lle mfei sfsDraxr ;u4oee  feildfm2raums t4 rxnxo oy1opt  ueol() eur(rpou4altelict s)aDrm(ront1open oeiydfm ulnvs t)aexnmr tatlmtraivsls0trurirpiudlmtelfvil(fsrurx o;u4openmfeiyt s elu p;t0tltnmr ty1fa rluvsl( t2ur(m3iu1ol elfei (  Duax oot1teeoif3iasfm2eau p t0aeermfciydlmDraivsl( tetrio3io1om elfcs ( sDumxrooo4olto o3tas m2emn onu0 exnmrctotop e n s t  exm(m3iydope  fcsasfaDurxrpnt4tleo oeiysfs2em(vs;t4artoif tydom r ueo;( s2toio3iudllt lfeslt) Dtrx  nt0apxn feias a umuvpnu4aeeomoctadomD lnvolt0s2urim iu1llen fetls  2umumo;o1opxn ociyd a emnmo u4 rxnmo iadom eai i ()teurxo oudoleelietatf Dra( onu4aeenifctltfaDeaumo u)aetrmocto1fm  luvilt0 2xm(r3oo4alee fvs sfaDum( ono0tet  f3iasla2ran pnt4aleoxr3oatlatrlivi s s2xmio oo4ape  nvi s  Drrxmont4olx if3iydla2eauvonu0aetoir3todfaD  ivo;s)trur(o3oydal  mivias) 2rmumo;u4oex mi3iysfs2rlums;(4alenxfciatlpt lu i ()s2umim iy1lpenliei ()aDuaum oo1ape ioetysla2rmnmo ()trerif3todlmDraueo s truoim nudlle mnvtatfsrrm(  nu4opxn oeilsfs2emn p;(4alxoxrciytlpDe ieo;( texrxm3iy1omtemncsl(f 2rmu o;o4optnii3iatlm2um(msnt)tlxnxr oodfa elieo t0sruo(o oy4alt mfvt s) 2tmumo;t4tleoif3iatfaDelnmsn()alerxf tytla e i o;t)trtmir3iy1am elfvia(farrr(m oo1aexnmo3iysfs ulumo t4 reomr3oatfm  luvo;s  rurxrpoudopeelfesat) 2rmxrpot0tlxnmi3ils s2rm(msnu0 etnxo tytfm  lu s;s0srtm(o3nu4aptnlneslt) rrax onu0tptomo3tys m um( sn() rermr oadlmDrlu olt0 2umxr io1optn fes ()arumumpnt0aleoifeiyd s ra(ms;(0 eerxo to1opDe ies (  etoxm3iy1omenlfciat  rrrumpoo1tpeo o3ilsfsDrl( on()arenifciydlmDrln i;(0setmxm nydlm  lfvsat)srtrumoot0tee mietysfs el(ms (0 exnxfciytfaDrli ols setrxm3iodllenlict s)sDtrx oot4tpt moetltlmDrlnmp u0 lenmo ia1fp elivs s  2xoxo io1lm nlnvt (  rumxrpnt0apenmfeiltfsDranmp;t4tltoir iy1op r ues;( seum(mpiudaleelfesat sDurumo;o0oet  o3iydfsDumu p t)trxrircoytomDelues t  2toxr ou4amee iesas srtrx onu0opeoioeiasfm umnvs (0trenio oy1op  lnvil() 2xm(r nu4amtelivilsf Dra(ro;u4oet miciys m rl(monu4aeeoxo iatlp   ivslt0s2xmxm3oo1amteliesls) 2ta(  oo0aetnmiciat s rluvont4aleomf oodlmte nes;t tetrxr3nudop  mfct (fs2tau  nt4tpeoifcildfm emn o (0tetnxociytoateln i;s0sexo(m no4oltemivsls  2umu  ;u4olto fctltfs2ul(vp u)altoif3oadom  lnvi;s) exmxm3no1llenmfci (  2ua(  ;o0aeen ictasfm umu o;() rtoxo3ia1omtran olt srtrimpiydom   fet (f Durxmp;u1tleo ictlsfm2ra(vp ()tlerxr iydoatrlieo s  rum(m3iudom emnvsat) Drrx p;u1teeoii3iatla2ul(mp;(4arerif3totlatrau olt)teuoiopny4am nlncs t  Drrum nt4aexnmieiatfmDem( o;(4arxrmf3iytoaDe nes () 2xoim3oydam emietlsfarurump;u0aexnmocils sDulu s t0teerxo iotoa rauesls) rtmim oy1omen fes t arrm(rono1optn o3iad a2rm(von(4 etnio3oodfate nvolt0 exrxmpno4oleemicias  2ta(r ou4teto o3tld a eau s;(4tleomo iatlp  anvo t0s2tr(mpoudlpe mfvs t)aDtaur ot1oetnioetasfa umnmpnu0teenxr3iytfa   i o ( srxmir3nydlpenmnci s)sDumumpoo0oleo o3tydla2em(vonu4altrxf3tadlpDeau ol()srtrir iudolt lneia(fsDurur ot1tee  fctldlmDranms ()tetnxo ia1fm   nvs;(  2xr(opno1alt micslt)s2uaxm ;t4opxn iciad a rmnms (4 etnif tatoa elnvo;s0sexmxo iodam nliesl( srtmx pnt1aptoifeilt sDrlnmo;t4 eeoxfctydlm e u olt teuoim3io1lle mieia()sDraxrp;u4oetomi3ias a2eanmonu)aeeomr3ty1lmDrlieslt0srto(m oo4op  mnesls)a2rm(mo;o4tex iieiasla emuvpnu4arerxo3ootfa rai i;t)trtmxrpiy4ll emivt tfa2rmu ooo1tlxoioetadls2uau o;u0aetoif3totlpDe uvo;t)setmxm ny1alenlivi sfa2tm(mp;t0tpenmicild aDrl(vo (0 lxoxo3io1lmD auei;(0seuoirpiodoltemfci t s2tmuroou4tlt  o3tytfsDrm(mo;t4tltnxfcio1op rlu ol() rxmim3iy1llen feilt)artmum ;o1aetn iciydlaDul(ms;u0 rxoxf3tadfmtrlivi;(0seur(rpou4ap nmfcsls)aruax pou0altoiietadfmDuauvsnu4 rtnxr3iy1lptean ilt0srurimpnu1amt mivta()sDtmurono4tlx ioetlsfs ulu p () rerio3oydla raiesl(  eur(mpny1am nmnesl()srur( ono4apt mf3iydlsDrlnms;()aetnirciotoat auvilt0t2xr(r iodamenlnvtat  2tr(  ;o1optniociadls rmu s;t)aexnmocto1lmt ai slt) 2tm(o io1oltnmictltfsrrmumpoo0aee ioctytlm rlnmsn(4trtnmf3totfateluvo;(  etrxr3ny1lpenlncs s) 2umx poo0tee ifcildfs eln p;()treoxr3ia1fpt  ues;s0 etr(r3nu4om n ivils) 2tr(mpou4tpxoiicilsfm el(mp;(0aeerirciydopDelu ol(0texmio3iudal nmfetl( srrru pno1olt mf3iad aDuluvsnu) rtoxo iadlpDean i ( s2umimpoydlmtelictls sDra(mp;o4aex iietyt sDranvp u0 rtrir3iadlp e ivo s0sexoim ou4olt  netas a2umxroou1aexnmo3tlt m ul(vo t)arxoio iadom rlieslt)t2xm(opnodllt liesl()sDrau pou0altn i3iydfmDrlu on() lxrif ta1lmD aieol(  rtoxrpnydlptemiviasfs2uaxm ;t4aleo oeiydls um( s (4alxrmr3iy1lmDrli sl(0 exrxr3iu4olenmnviltf Durxmp;u1aptomfctlsfs ea(vp;t)texomf ia1fatrlieo;s)srxrio iodamt lfvtas s2trx  nu1ope io3tlsla2uaums t0 rtnmfctatlaD  ivo t0 etmxo3no1lptn iei t  Dtaumont4ape mfeiatlm2um( o (4 exnif3oy1fa r uei;s0s2xmxo iy4amee fes ( aDrmumpou1ape  fctydfsDrmn o u4 eeomrcoatopDr nvo s t2xrxrpny4omtnmnct s) rtrx  oo0apt ii3iltlmDemnmpnt0aexrmociydlpDrai i ()s2urxr ou4lmtnlfesat s2rm(  oo0ale mociytfmDrmuvsn(0 etrmo3ty1oaDrlivs;()srurxo nudlp nlnvsasfa2trumono4tee if3tysls rmu s;(0trxnmf iytoaDe nei t)teto(r ny1ap elnci (f 2tmx  no4apxomfeiyd m ea(vs;u4 eeriociytoateai i (0sruoxo3nodom nlfcilt)sDum( ooo1optnmf3iytlm umnvo;t) eeomo3ty1lp rln o s)sexo(r oudlp  lfvsa( sDtaumo;o0teeo octadfm2rlumo;u0artrxfcoa1laD aues s0srum(m iydomte ietas s2ua( pou1apxoio3iatfm2umuvo u)altrxo3to1fpDr ueo t  rxrim3no1omt lieils sruau  no4tlt  ictls mDelnvp;u4 eenioctytlp   uvslt0teurxo iodlpe mfesa() 2rmxrpot1aexn o3iadfsDemnmpn(0aleriocootfmtran i;t)sexrxopnudom nlivt t s2tr(mp;o1ape  i3iaslmDuaums;t0 rxrxo3io1lpt  ueilt0s2urir iydlltelfeias) rur( pnu4opxn fctad a2rmu ont0alenir3oo1opD  ueo;s)setoxopiu1llt lieils  Dtax p;u0opxn ocild m eauvo;u0aetoxo3ootop rau s (  2xrxopou4opt mici ( arur(rpou4aeen fcilsla eluvp;u0areoio iadlpteaivilt) euoirpny4apeemncil()aruau oou0oee ifciyslaDrluvs ()artoxf3oytoat lnei s)setm(o3io1lp   ivil(  2rmumpot1apen fciytls2el(vs;(4treoirctydlpDe u ilt0trtr(m nudolen nviltf 2tax oot4tle  fctydfm2el(ms u0aeerif3ty1fpDe ivi;(0s2xr(m3ou4al  miei s)arur(  ;u4aeeniietadfs2um(mpnu0tltrxr ootfatranvols  2xr(r3iudll   nvsl(  Duaumo;o1optoii3tldlaDelnvp;t4aexrircta1oatrln s;(  2tmxmpoo4lltemfcta( a2rr(mo;u1altomfeilt m ul( s () rtnmf3iy1lm raivs t0s2umxr oo1lpte fvilt  Duau ono1tlxo o3iysla2umuvp;(4 rxoxo tadlp  luvs;() euoio3io4al  lfeslsfsDurxmo;o1open ieiatla rl( p;u) rtrxociotla rlnvs;t srumxr no4ome  ivs ()arurxr nt1openmo3tltfm2eln p (4 lxomf iy1fptrau s;s0seuo(o iy4apt  fet s  rtaxmo;u1apxoiieiytla uauvp (4tltnmfciotlp  aies;t0s2xm(r ny1oltn fei (fsDua( ont1aexo f3tltlm2emn s t4 rtomf oadlp  auvo (0 rxoxo3io4ame  fetas srumxmo;o0oeen fcild a rmnvpn(4artoxr oa1la  ai o;t teum(o nydalenmiet s  Duauro;u1tlxo i3ild sDemnvpnu4arerircoa1oaDelu il( t2xrxmpoo4lle lici t  2tmu pnu1tltoifciys s2emn o (0teenmr tytop r uvi;t srtrio oydolt  iet sfaDraurono0tpt  fciyt aDumuvp;u0 rxrif3oodoaDr ues (0trtmir3ou4ape mnctlt  Dtaumpnt0tpt moetlt sDumums;t4 rxrmoctadom  aieo;(  2trxm3oo4lp emnesat a2tm( pnt0teen i3ilslmDeanvsnu0aleoirciydfaD anvslt0s2xr(m3iodope  ivslt  rrmuro;t1apx  ictaslaDem(vs;()alenio3tydfa r ues;s  rxmir3nydllenmfci s)aDumuro;t0apeo octydla rl( p;t4 rtrmr3oy1lptraivi;s0s2uoxr ou1lle  ivtlsf 2umxm ot1oeeomoeiadfm um( p t)alxoio3ia1la r u ol() ruoxo3ny4altnlnetlt srrrurpno4tlxnmoeiatfsDrlnvp u4 leomr3ootfpt  ivols t2xm(opny4ll emncta() 2ra(mpoo4alxn ociatlmDrmu s ()tltomrctodopt  ieilt0trxmxo iu1alt mnct () 2taumo;t4olto i3ilsls2ra(mp;u0 exoxrcoydlpt  nvs;(0s2ur(r oodlp n ivt s)a2rau  no4tex if3tys s umu pn(4texnxf3iadlm rai i;s) etmxrpno4aptnmiet (f Drm(  ou0tlxomf3ils aDemnvsn(0trerifctodlatrai o s)t2trxrpou1omenlics (  Draurp;u4olxnmociadfs2uan p;t0arxnifctadomtrau olt  euoxo3iy1aptemici s)srtrur ;o1olto icilt mDrau on(0trtnif totlp e ieo;() 2to(opno1op  mnei ()sDraxr nu1apxn ictld mDeln s;t0tlermfcoo1lpDelu i;(0texm(mpnodamt  fetls s2taumo;t0alx  fciadfs emn o t)aleomf3to1lm r u i t0seto(o ou4op nlnes sfa2ra( o;o1aet mieiyd m ranvo;u0 reriocootoatr uvi t)srtoim3nu4ol nmnvsls  Dra(rp;u0oex io3iytfsDemuvs;t)texomf tadfp e uesl() eurimpou4alenmfcs tf ruax p;t1ale moetatfmDeanvp u0tlermo tatomtrlu ils  rxrio iu1alee ies ()artr(rpoo1oeto oetatfmDemu p;(0tlxnxo oytfm  ai sl(0 rum(r3iy4lptelfvsl( sDtmxr nu1olx io3tadfaDeanmo;u) reomf ty1lpDrln olt0 etmxopnu4omeemfct (f 2umxrpot1tltnmi3tysfm2ua(ms;t0 lenxfcio1fpDeai sl( srtmir3iudlptnmivilsf 2ua(ro;u1ope mfciytlaDemump u)treoio ty1fpDrli o t)t2uoiopnu1ol nlivsl(f Dtaumpot4tpt mfeiatfm ean ont)artnxo oadlate n s t) euoxrpiudale mivsa( arur( ono0altn fctytlm2rmumo;u0 ltnmf to1fmtranvo;(  rumiopiy4lle mfeia() 2tmurpou1oet  i3iltlm2rmumpnu4trtrif3iytoa  livsls t2ur(opio4alenlfcsat)a2rmur no1aetoioctatfm ra(mpn()tltnxo to1lpD ai ilt0trtrxr ou4lme mnvt s) 2urum oo1tpt miciyt aDumu pnt)arxrioctadlmDeau i;(0 rtoiopoo4lpte fvtlt)arurxr ot4oetomocilsfaDran o () eerxo3io1fat  i i;s)s2umirpoudol  mfeia()sruaxr nu4aee mociyd a em(mo;t4tltnirciytom rln olt0seumiopou4lm e fei s srtmx p;o0altomoeiat a2rluvonu0tlenxrcta1oat  uvo t  rxm(m3ny4aptemfcta(fsrur( oou1oetoii3iysfm ra(vpnt0aexnxocoadfmDeaues;( trto(o iu1ome  ivi ( aDuru  ou4alxoif3iadlm emnvo u) eenxf tydomte ivo;t)t2umxo ny1ll emnvt (fsDraumo;u4olxoifciyt s rlnmp u4 lenxr to1opt lieo;()s2um(m iu4ome  nei (  2rm(mp;o4alxoiiciytfs2elnmpnt0 ltoxr tatfm eli i t) rxrxm3oodomen fvta()aDuru pno1aptnifciaslm rm(ms;u0arxnxo iy1omDr n s s)srtrxrpou4ap nlnvta(  Durx pnu4oltnioeiltlm2raumpnu) ltnmf3iodomDraieilt0 eur(o3oy1olenlicia(f Dtmxm nu0apt moctatlm2eanmont0areoifcootlmDe nei ()t2trxrpoudol  lncsls) 2taxrpnu4ale iociadla2elnmsnu0arxrif3ootlp r n s (0s2xmxo3nudome livs s srrm(  ;t4tleomfctytfsDraumont4 rerif3oo1fm   neil(0 etr(r ou1omenlfetat) rrmxro;o0apto ieiys aDelnvs;(4 lxrmrcoydfpDelivs;s)t2um(o3iy4optnlfeil()srum(  nt4oetnif3iys s2ua( snt4aleomfciydfmD  uvi s0teur(r oydlpt livtas)aruax  nt4tpxomieiatfaDuauvs u0 lxrmf ia1fmteanei ( tetmxm nydam  mnctlsfaDrr(m nt1tle mf3iydfa emump u0 lxrirciodfpDe i s ()srxoim3iydolee fvs t arta(rpnt1opxomi3iadlsDuauvp u0trtoxr tydfatran o t s2trxmpno4omenlfvs tfaDrm(mo;t0alt  feils aDum(vo (0aexnio oydlate ies (  rtrxopoy1lpenlfcta(fsrrmu onu4olxnio3iytfmDrl( o u0teerxrcia1fm  anvols s2xrxrpny1ale  net ( a2umxm ;u1aee  ieiytfaDemumo t4 lxomfcoy1oa  aieols0srtr(r3oydaptnmnvi ( arua(mont4opx moctas m2umu s u4tlerxr3oytopDe uesl( tetm(o3io4lm nlfvs sf Draxrpoo1aexnif3tad mDul( p t)tltrio oy1oaDrlueo;s tetmir no4om n nesas artru o;t4altnmietlt s um(ms;t4texnxr3iydomtrlivi s setoio3iodomenmiei s  rrr(r nu1apt ifeiydla em(mo;u0 leoxr ootop rlivsls texrir3ou4ll elnes tfsrua(root4oleoiietatlm2em( o t4aexrxrcta1oatranvil(  2xmxm3oy1alenmici t aDtrx  nt1alx mfeilt s2eaumo t0 rxnmfctodoptrlu i ( tetoio3nu4alenmnvtlsfs2rmxr nu1oleomi3iatfa ua(ms;() exomf todla r ivslt  2uo(r3oo1lp emfvi sfsDrau  ;o4tlxnmfetas sDumu p ()aexoiocoodomtrai o t trtoirpno4lltnmivt (fsDururp;t1oleoiociytls eau snt4areoif oadlatr nvo (0t2xoxm3nu4optemivta(faDuax pnu4apxn fetat sDranms t)arerif iytfmDe uesl()teuoir3nodopeelivs sfa2rmu  no1tet moctasfa2uaums u0tltnmr3oa1lmtranvilt  rtrxr3nu4ameemneslt a2urxmpot1opxnioctasls2uauvs;t0altrmr todlaDelneols)sexo(opou1alen nvs (fs2taxm ;u0alx mfeilsls2ra( p;t4aeeomf io1lpt aneo s  rtoimpno4lleelnctas)sruaurpnt0aetomo3iad m2emnmo ()teerifcoatlm rlneo;t0 ruo(m io1altnmiesl()aDta(m ;u1tptomictyd sDemnvs u4 leomr3tadomte ueo s)sexmxo nodal n ncs () 2rr(rp;o0oet moeiydls2rmu p;t4trx
\ No newline at end of file
@@ -0,0 +1 @@
+nvs;t) 2uoxr3ny1aptnlfvi s) Drau pou4tex  oetlslaDrluvp;u4 rxnxf3iadopDr nvi s) etrxm nu1lmte fctatfsDtmuroou0tltnmfctytfm eluvs t)aleomfciodlmteluvil()t2urxrpoo1ome mnvslt s2rm(rpot0apx miciysla2uanmo;(0trerxrcoatlate ues;(0trxr(r oudam emfctat a2rm( onu4aee ioetlslsDumnmo t0 rermocta1lm ran ils) etoxo oy1apen fesat)aDrmx  no4aet  iciytfs rmnmont4teerxrcto1oaD lu olt0sexm(o oo4apte neta()a2ta(  oo4openio3ildla2umu o;u)tetnir3ty1fmt liei;t  exm(m oy4op  liet tfa2um(rpot0ape iictas s ea(vp () etoxf3oytfmt aieo ( tetr(m io1lltelies s aDraxr ;u4teeo ieiysfm eauvs t0arxrif3ty1lm   nvsl()s2uoxr iy4lm  mfet (fsrtrxm oo0alxoioeiyt m rl( on(0tlenmr3iadfa eaneo t0tetmim3io1omte ncias  rtaxmo;u4tpxn fetyd aDul(mont) lxrxf3oadfaDr nvi s0 eurir3ny4alee icil(  rraxmoou4ope mf3iatfmDua( p;(0tltoxo totlpt  nvsls  ruo(mpny4ll n ici tfa2uru  ;t4aet  fetas a ra(mpn()altnio3iy1op  li olt) 2xrir3iodlpt  fvsl( aDuaur ;o1oex mfcilt sDra( snt4trerxociy1lmD lieil( srurio ou4lleelivsa( srtmx ont0olx  ociydfm eluvo () leoxrctotopDrluvi t trtrio iydlmt  nvs () rum(  ;u0opto oetysfsDua( s;t4trtoxf3oydopteliesl(0t2tm(o iy1omte nvtl(fsDtm(mont1tpen iciyd s2rmuvp t) exoxr3tydfm r n i;s)s2xmxo ny4open feilsf rtrumoot4tltoifeiyt m2uauvo t0trermrciydlmt  u i;s0 rxmxm nudllenmnvta( sDur( p;o1apxnmf3tydls2rmu o;u4 eeoif3ta1omD li i;t)srumxrpnydlpt mfet s  2rax pot1tptnmoeiyt a2rlu o;u)alenmociodlptr iei;t) eumxm3iydole  ietlt a2tax p;o1oltomociatfmDemums;(0tetrir ta1fp e n o (0s2toio3io4altnlfetlt sDtaxr ;o4tleoiietls a2rl( o u)tlerxocoadop ranvo ( s2urxm oodop e fvi tfarurxr ot4opxo ieiadls2uan o;t)artrmoctadoptr iesl() exoir3nu1omt lfcta( aDumurpnu4oet ifeild m2elump;t)arxoxf3ia1lm   ivol(0s2umxo oo4ll emnetatfsDur(rp;o0olxnifciad sDelnvo u0 eenioctytlaDrli i s t2tmim iudolte iviat) Dum(rpno0oleomiciadfs rl(vs () rtnmo ootla  anvol(0s2umxmpio4ape lietas  rurx  ot1tptomfctatfa2rl( s;t4 leomrcta1opDeau i;t trxr(o ou4lpt mfvtlsf 2urx  nt4aetnifciltfs uauvs;(0teermfcoodlaDr neils srtmxopoudllte neslsf Dur( poo4oexniociyt m2rm(mp (0trxomo oadopDr nei s0 rxmiopno4aptelnetltfarumump;o1aeto oeilt mDeluvpnt4aetnxrcty1omDelnvo s s2ur(o3oydamtn fvsltfarur(rpnu0altomociasls rm(ms (0trerxo3io1om ranvs;t0 rxrirpnu1am nmivilsf 2ur(  no0tptn ictltfs2ulu snu0artrxo3iatomtr u i;()tetr(r iu4am  lnetas)s2tm(mpoo4tpx  oeiydlm2eln o (0altrxfciytfmte n s s)t2uoimpoy1ole mnes ()s2rrxrooo4aet  i3iyt sDrm(mon(4alxrmf totom  luei;(0 2xrxr3ny4ap nlieslt) Dtrum ot4tpenmi3tatls rlumonu4 reoxr to1lmD  ieo ()s2uoxm3oodamt lietat a2rmur ou1ape iiciltfm2umu on(4trtrmo3todlatrlueil( srtmio3ou4lmtn fcsat) 2tmuroot1tetn feilslm2emnms;()arermo3oytlpD  nes;(0 rxoxmpiu4ll n ieils  2rmxrpoo0tlx  fetatfs2ra( s;(0 rxnir oo1op r nei;( s2tr(r ny1optemfcta(fs2ra(m ;t1alxnio3iytlm2um(vo t0aexoxfctydlp rlieil()t2xo(opio4am  micsl( artm(ront4ape moeiysfs2eanvp u0aexnmfctodopte uvo;t  rurim3iy1lpt mnvil( aDumxm oo4oex ifciydfs2rlu snu)trenmr3ta1fp  lues t0t2xo(o oo1ll n ivi ()a2rrxm nu1open o3iadla2ul(von(0alermfcto1la elu s;s) eurio ny4aptnmncias a2ururo;u4teto f3iysfm emu o;(0 ltoifciadomD  ues;t sexrimpio1altelies (f Dtmxrpnu0apenifcilt m ean ont0tltoxo iy1fm eaivo (0trtrir nydll nlictasfsDtr(roou0alx mf3iys m ra(ms u4altnxf oy1lmt lnei (0 rxm(opiodlptnlfvsas)a2tmxmonu4aee  feiasls2ul(vs;t4 ltnir oytfmDrau s;s0 etrxr io1ll e ncia()aDtmx  ou1tpto oeiatfmDrmn p;t0 rtoxr3iydlaDeluvi t)t2trxopny1al   nci tf 2rm( onu4oee mfeiltfs eluvp;(0texoxoctatlatelnvi s0t2tmxr3oudamtn nviasf 2urxmpot4olx mietysfm rlnvp t)artrxo3totlm ean s;t)teuoxopny4amee ics sf 2tau  nt1oeeniociasla2emnvo (4tlxrxo3oytoa rluvo;t)s2xoiopnydom n fci tf Drr(rpou1oleomi3iadlaDeluvpnu4arenxr3oatlatelieols0srxrxmpnodlmt mnct () Dum(r oo0tpx ioeiysfsDua(msnt) eenir iy1lmt  n ols0teuoxo iodlmeelnvtlsfs2taxmoot4tex ioeiys sDulump;u)aetrmf3iadlpDe ues (0teum(opny4op   iesasfsrraum ;u4oeto o3tls s2ra(ms u4areoirciadlmtrli o t0 eto(m3iodlmtemfvtlt aDta(rpou1ale mf3tldlm eanvsn(4 renir oy1opt  n slt0 etr(rpio4oltnlict s)artmxm ot4oeeomi3iydfaDul( sn(0alerif oatfm rln i t0teuoxo ou4ll  lncsat arrrx o;t0aexoii3iasfm2rm(von(4 exoxf3ty1fa e nvolt0teurxopnu1om   ici s) 2urxr ou4aetomfetytfm2emu s t0 etrir oy1omt lnei ()srxrir iudlptnlics t  2tm(rono4tle  ieiytfmDrau o u4 lxnmo oatlaDelu sl()t2xo(o3oy1llt mfvt ( srraurpoo1tpe  ociysfs2emuvsnt0artnxo3oydlm ran ol( s2um(opou1lm emfvtlt arta(moou0ape mo3iytla2uanvo;t4 eeomfciydfa eau s;s  etoir3iy1om e ivi ( sDtrump;t0apxnioetlsfs2umnvs u)altrmf3tytomD  nvo;t)srto(m oudlmeelfeilsfarumxr ;o0teeoioeiaslm ulnvo t4teenmfctydfp e i o s)setoim nodop nmfvtas srtmu ont0teeoio3tatla rau o;t) lxoio3iydop eaieils0t2toio3oodom  mivilt)aDtaxmp;o4ale moeilsfm ulu pn()alerxo3tytla r nvo t0s2um(rpio4llt  feil( aDtmxrpoo1aee if3tad s el(vs u4treomo3oy1fmDraneo;s0srxmim3nu4lltnlncsasfaDum(rpnt0opeoifciydlaDrl(ms;t4trtrxocio1op r nvi ()trxo(o nu4omenmictlt sDurumpou0ope mi3ils s2ulnvp;t4trtrxo3ta1fmtraneo (0truoxrpnodole mics ()sDurum nu4apen o3iat m2rm( s (0 lxoif3ootfaD luvo t)texoio oudolte ictat)aDurxmpnu1aptoii3iaslmDraums (0trerxo3ta1fa e neo s)srumirpoo1ol  lfesasfa2taxmo;t0olxn ociysfaDuanmsnt0 eeoxf iadfat luei (0t2urxm nu4opt mnctl( s2rm( pnu0teeoifciltla2rl(vp;t)aetnxf ta1lm rli ols s2xm(opoodlmenmietls arrax oou1texomietyd s rlumon(0tetnxrcootfm elu i;s0tetrimpnu1apenlnvsa(  2tr(  no0olto i3iadfs rlnmp t0tlermrctytopDraneo t trxoim io1aptemiei tfsDrrxr ou1aee mieiydlmDul( o;(0texoxocio1oa elu o;s) 2to(r3oydap nlneiatfsrrmxm ;o0teeo octyd s elu p u4 rermrcty1lp e ivi;() rur(r3iu1lleelnetl()arur(monu1aetn fctasla eau snt)tltomr3oydopteln ols0s2xrim3ny1alee fvs (f rum( pot4opt miciat a rmu s;u)alxnmr3io1lmtean s s seuoxr oy4lpe  nci s) rtmx oot4texnmiciyslm2emuvs;(4aetoio3tydlaD luesl()teuriopou1alee nes (fs2tmur ;o0teen oeilt sDumnvp () etoxo ty1laDe nes (0teto(o nu1lpen feta(  rtrum nu1opeoiicildla elu pnt4 etrxf to1late ueo;t0t2umxr oy1ole mfcsa(f Drmxm ;t0aptn f3tyt a rau p;t)trtomr3oo1fa  lnei;()trumim oy1al  lneils  Dur(monu4apt mieiasla elu p;t)treoxf3iy1omtrlivi ()srur(opnu4optn ict () Dra( o;o0oleoii3tldlm2rlu s;t4 rxrmf oo1lptrli s s0 rumir iodomeelnvsa()aDurur no0alt  ieiydlm um( p u4aexrxf ootop r uesls)t2xm(rpnu4om  lncta( aDrr( pno0tlxo f3iat aDrmnvs;u4 rxoxr iotoaDr nes;t setmir3no4omee fesl(fa2rm(m nu0oex  ieilt m emu sn(0 reoio iydlmteli slt0t2to(o iy1alenmncil(f 2ra( pnt1tpt  i3iytfs um( p;u4 etnxr3ootlmD liei ()s2xm(r3nu1ope  fesa(  rur( o;u0alto ictatls2uanmp u) ltnxfcia1lpD livi ( srtoir nydal nlivsa( s2tru  ;u4apx mf3ildla ea( snt4tlerxo3iodfmD lnes t)t2uoimpiu4lm nmnet ( srumx o;u0teeomoeiyt a ul(mo u0 rtnxf3tatlaD ai o s  exrxr3no4op n icsltfsDtm(rpnu0opeo ieildlsDrauvsn(0alxrif3iadfaD  uvi;s t2urxr iy1ol n fesatfaDrmxm nt4tle iiciysfa uauvp t0arenifctotlaD anvo;(  rumim3nu4amenmfvi tf 2umxmpoo4aptnif3iytlm2emnvonu4 rxomociadfp elieils) 2urxopiu4lp e netat aDrrxmp;u4altn feiltlmDel( o ()altnxrcoydlm eaivsl( s2umxo3ny1amt  ictls)a2ta(m ;u4tptoifctas s emu s;t0altnmr3oatomtrlivilt0 rtoiopnudapenlfeilt aDrmxr nt4tpxn oeiytfa rm(vo u) exomo iydom  lnvs s trxoir oo1oleemiesls srrmumpoo0oexnif3tytls ra( o;(0 leoxr3totoa r u il(0s2xm(mpnodop  liet t) 2rru o;u1alxn ieildfm2emn p () ltrmf oatomD ln o ( t2umirpny4alee fcil(fs2uau  no4apxn ieiyt a2rlnmsnu0arxnxf3iodom   iei;s tetmxm ny4lmtnlnvias)aDumxmp;t0tlx if3iydfs uan onu4texrxocoodlpDrli s ()srtrir no4olee nei s srrr(mont1aeen oetysfs2emumo (4aexrir3oodfaDeaues () exmir3io4lm emnciat)srraumoou0tpeniociadfm2rauvpnt0treniocoadfp raueol()texmxo3io4lmt  fetlsf ruaur no1openmfeilsfa elu o (0 rtnxo totoa  li i;s  etr(r oo4olte netas  rtr( pnt4opx miciad sDean snt)tleoxf totfmD lu s;t  2ur(m oydlmt mfet () Drmump;u1apeomi3iltfsDrmuvp;t0arxnmf oydfp eauei (0truo(o nudolte ncs ()aDuax  ou1aleo ocilslmDra( p t0 eeoio tytoptrli o t)t2uriopiodlptemfes (fs2tm( o;t1tpxo f3iltfa umu p;(4 reniocia1lat  uvi;s t2xo(r3iodale lnctat) rrm(rooo4tleniictldlm2rluvs t4texoif oodfaDe nvi ( trxoimpiudlpe  ivi (fs2umu o;t1oeenifctlsfm rmumsnt) rtnmociodfp e nvsl(0s2urxr iydlp n fct t  2rax oot0aex ioeils m uan o;(0texoifcia1latraivslt)teto(r3iy1ole lneiasf rrau  no1oee if3iys m rlnmp;u4tlxnifcoytfa  aies t0s2uo(rpnu1lptnlfcsa()sDtmu  ;t0aee  ieild a2ranms;() exoxf ty1lp eai i ()srxoxopiudlm   ivtat) rurxrpnt4teeomi3ilslaDel( ont0teerxocoadopteli il(0 2xrimpoy4lm n nci sfsDrrxrpno1oetn o3iat mDem( pn(4 rxoif3oo1fmtrlu o s trxm(opoudol  lneias s2taxr nt0tptnmoctlt m rlnvp t0trtnxr ia1omD  ues;()trxm(mpio1alt  fvia()sDtr(mpot1oeeoio3tyt aDemn s;u)treomo iatlpt  nes;() 2tmir3iudam  miciat)sDurum nt4apeomi3ilsfaDul( s;u) eerxocoytoaDrlnvi;()trtr(o3ny4al elnet ()a2umx  nt1tpt ioeiydlaDraums u4 eenxr tadoaD aies;s)teuoio3no4aleemfvsls)sDrr(rpou4aptn ieilslm ulnms;t)alxnxr oa1lmD  nvo s texoim io4om nlivi t)artrxm no0aee if3iatfaDua(mpnu4aetnmrctydfpD  uvs;s)trto(opiu1amee fcilsf rtaumooo1aeeomfeilt a umnmo;()tlxnif3oodoa eauvi;t)trxrxr nu1apenlicils artaur ;t4olen i3ilt a uan o u4aetomocta1lpDe n s;(  rxmio oy1ll e iet sf Dtmx  oo4oltomoetld s2rm(mpnu4 exrxr io1optr ueo;s trtmim3nudlmtnliviat aDua(  ;o4tpxo oeildls2el(von()artoxr oytoat  iesl() rumxr3oy1omen fetas aDraumonu4tlx mieiasfs2umu p;u) eeriociytlat livolt0 eurxrpio1al e icia(  Dum(r ot0aex iieiasla2elnvp;t4alxnxrciadfatr ivslt0t2uo(m oo1optn nvils  2umump;u4tptoiiciat mDuan pnu4 ltrmf3oytom  aieo (0seurxm oy4optemncsas)aDtmumo;t4tpt  iciat m ul( pnt0aeenxf iadoatrlnei;s)trxoxo3io1ope  feslsfsrraur nu4ole  ictyd s2ra(vp;(0artoxfciodopteluvo t0 rxmxmpnodlle  nvs t)srtmxmonu4oeenii3ild a2uaumo;()teenmf oa1fp rlnvi;s) exrimpnodale  nesa(f 2urur ;o1openifetadfa2emump u)aexnio io1fm eanvo;t) rxm(o3oudom elfciasfsDtru oou0aex  ietltfaDulnvs () lxomf tatfm r uvo;(0 rxm(m oo1openlfviltfa2tmu ooo0olt  o3tatlm2ea( p ()aeerxr3io1oaD aneo;( s2tm(o nu1llenlfesat)srtm(rpno0aetn o3iatlm eauvpn() lxnxfcio1lm   uei;t) rumxm oo1op nlfeslt arumur ;u1ope  iciytls2rmu s;t0alxrxf ta1op   uvilt srurio3nu4lltemies () 2rmxmo;u0ape  ieiadla elnvp;u)tlenio iatfa elues (0 2tmxr ny4ale miet sfs2ta(r ;t4apx ifeild m2em(ms t0 reoxr3oydopD lieo s  rtr(r ny1alt mfei ( a2uax poo0teeo i3tatls2ua(mpnu) rerxo ootlpt li i;t)seuoio3iydam  mnvtlt)sDrrxroou4opt  feiyd a emu s;(4tetnmo oydomt luvi s0 2urxr3iodlp nlnvia()s2tr(r ;o0tpenmociyslmDeluvsnt0tlermo to1latelu o;(0 2xmio ny4aptnmfvt s)a2uau ooo4olen ictlsfs uan p;u4 rtrmf oodfatelu i;s)s2um(o ny4lmenmfvs s)arurxmp;u4tee io3tasfsDrmu p;()aetrif3iadlp eai o t)s2urio3iy4ll  lnetlt artaxmooo4opxnioetltfs2uln p;() reomr oodfm ranei;() exmxr oo1lmtemicsl(fsrrmxr ;o0aet io3ilt aDrmnmp t0artoxf3iatopte uvs s s2um(opoo1apee fcia(fa2uaxm nu4aeto fcildfm uanms;u0 eeoxf iatfmt  uesl()trtr(o3io4oleemivtl()s2ta( pnt1tee mo3iatfm rmump;u)arxnmo ootfmtrauvolt t2tm(m3oy4olt  nvsat arrr(rpnt4olxnmfeiyt m2umnvo ()tetoiocoatfat  iesl( trtmxmpnydaltnmfctat a2umuroou4open ieilsfmDelu s;t0 lerir oatlpD  u i;(0seurxr nodlmte fviasf 2tm(m oo4aleo f3iltfs eaumo;(0teeoxo to1oaD lneils0 2xmir3ou4opeemnetls) 2uau ono0aeeomfetadfsDea( snt) renxo ootop e i sls s2trim3io1om  mfcsat)a2rm( onu1alx ioetys a2ranvs;() rerxo todopte nei;s  etmirpnudap   ivta()sDumxrpno4alxnmfctys m2ean s t4tlxrir oatoa elnesl(0teuo(m3io4lptelnctas) 2rru  nu0tleniociltfa2raump;t4tlenir3oo1oa eanvi ( sruoim3oudoleelnvs sf rrrxmpnu0aptn ociltfmDua( snt0artrircoytfatran s;s)setrxrpoudaleemnvta(fsDrr(  ;u0opxoii3ilsfs2rln s (4 lxnifctydfmD  ies s0truoxopiydam elncil( sruau pnu0tlto ietyslaDuan s t4 lxoio3iadlpt lneils0 euoir iu4lltemneta()s2taxrpou1tlx  ietlsfm el(mo (4aetrir3oydomDe neo s0 rxo(r nudal elieils)sruaurpnt0open fcilt s eluvo t0trtnxr io1opD  n s;s0sexr(opnodam  micsat) rta(ronu4aet iictatfmDumuvont4teermocoo1op   uvil(0setoxrpoo4ape lfcil( aruau oou0tex  fetadla ra(vo t)arerir oatfpt aies s0srtrirpnydop   ivta()a2trx oot1tltomieild mDemump;t4 eeoifciydfate n i;()texoxm3iy1omtnlneil(fa2rrxm no0aex  fctls aDrm( pnt4 eeoxr totlmDe n s;s)t2urio3nydop  mies ( a2tr( pnt0oex  ociys sDrlnms;u)alxoxr3oytfm   u o;s0seur(m3iu4alen nvtltfa2ur(  oo4oeen oetls s2ua(mon(4aexomfctodfptraieilt sruoxm3iu4am   ivsat  2tmur no1alt micildfa2ua(mpn()aexnxf3tatop  livi (0teur(m nydoltnlnvias s2ur(mpnt0ope ii3iltfm uanmpnu0alenxf3tatfp rauvsls) 2xrxm3nu1lltelietasfarur(r no0tlx mfciyt a2um(mo t) ltrxo3ta1op raieslt teumxr3oo4ale mivias sDuaxm no4olx  oeiys mDrm(msnu)tltoxo oadfat luvol( trxrirpou4ome  fvtas) Dtmxm ;t1oexnii3iadfm2umn o;()texoxf3totom rlivs (  exrxrpiu4lltnlfvtatfarrr( o;o1teenmiciydlm2uau on() etrir ia1lpDrln ol(0srxr(opnu4ameelncias) 2rr(mont0oet moeiat sDeln p;u0aetrif iytfpD  u i t srtoir3iudlpt mnvia( sDra(rpot1aexoiociytlsDul(mp (4altnxocoatopt an s;() rxoimpiydome mivslt  rua(moou0altn oeilslaDrau sn() lxnifciy1omDrlnvs t seurxopou1apenlics (fsrurxmpoo0tptn i3tasfsDranmo () rtomr totlmDeaueo s  exoxopoydlm  mfcia()aDtmurpno1oex  oetlslm ra( ont)aexrxrctotoatr nvo t)t2xmxo3oodlltelnvtlsfsDtaurpnt4oleo feilsfmDem(mp () lenmo oodoaD au o;s  2urirpiu1om elieiatfarurumonu0tetnifciasfm uluvs u0aexriocoatlmDrluvi;s)trurirpnu1lpenmnesas) ruru o;t1tle io3iysfs rmump;(4trxoxo oodopt lieo s)trxo(o iu1am  mnvs t  Dur(m ou1teeoif3tlslm emnvs;u0 lxnioctodlm e n s s)trxmxm oy1aptnlnetls)s2uaum no4olx iieilsfmDra( s (4arxnir3tadomDrlivo t0 rurxo ny4ll nlivt () rtmurp;u0ale ifetls a rmn s u0 etoio3oytlm   nesl()seuo(m nudlmenlfct s a2raxmo;u4tle  ietaslsDrauvpnu0aetrmocoatfm  luvs;t0teurir oy1lpe  iei s)srrm( o;t0apenifeilslm ulumo;u4 rxoxrctotfaDe nvo s trumio io1apt  iei ()arrm(m oo4oex  oeiaslm2ea(vp u0 renmfciytfptraueol(0t2umxm nu1am   ivsl()srtmxr nu1tet ioeiaslaDeln s u0 rxoio to1optrlieil() rxo(opoo4lmtnlnetls)srtauro;t0alxomo3iltfa2uaumpn(4 reoxfcio1fm ran i;t)texrxopoodlmtelnetl(farur(rpou4tet if3ilt s ulu p u0tltoxo3tydomDelnes;s0tetoxo3nu4amen ieslt)aDumxmo;t0opxnmfctldlm emn pnu0 lxrxf oydop elu s;s0sexmxo ou4ale lietat  2rr(m oo0oex iictldfa ua( p t0 lxnmo3to1fpt auvi (  rxmxm iydop nlnes t  Dtmuronu1ape mf3ildlm ulu onu)trtoifciatfpt lu s;t)seumxo3ny4ale  nvt s)sDrr( o;o4aexn oeiltla2rmnvs t4 reoxr tydlat au o t texoim3oo1am elnesls  rtm( o;o1aex ifctasfa2eanms;t4areoioctydfp eau slt0trxo(r3nu4llt mictlt  2uaxroot0tetoio3ilsfm2raumo (0 etnxr iytlp elies s)t2um(rpnodope lncia( a2umxm ot0texnifetydlsDea( on()alenmocoodfp eai i;s trur(o iy1am e fvilsfs2umx pno1oet moeiat a2elu on(4 reomf io1lp   nesls) rxr(m iu4lm n ieilsfsrtru poo4alxn octatfsDrl( s t)tltrxocoodlaDran o t)t2umim3iu4ll nmici (fsDrrx o;u4teeomoctlsfsDumu o;t0 lxnmr iytfatranei (0 2urxr nudlpen icilt srtr(r nt1oex io3ilslm2ua( o t0texoxocootlmD  ivi t  rto(m3nodopeelfcsa(farrr(rpou1aleoii3tytfmDrmn s ()trtnmo3totopDe nes ( t2urxrpny1al emnvilsfsDumu  nt4tpxoii3iydfaDeanmonu4texoxoctatlmDr ies t srur(opoy1ol nlicia(  Dtrumpot0tptoio3iyd mDranvpn(0teeomf3oytom  an olt0tetm(o nu4oltnlics t s2tr(  oo4oltoioetls m2eln on(0 eermr to1latrlnes;(  rxrirpno4llen nctls srtmxrooo4aeeo fcildfaDuluvpn(4trerif tadlmte nvo t  etrxo iudalt lfct (fa2trumoou4optnmoeiyd aDum(monu)tltrio to1fmD livo (0tetmxmpiudoptnlfetat  Drmum ou4tetn fctys m2umums t0arxrxf oadopD  i o;t  exoxopoy4amt  ict t  Drrumpoo0teeo ictlt a rl( p;t4 lxoxf iatlpDe uesl(  eurxo3iy1lpeelncia(f Dra(roou0tleomf3ias m ul( s (4teerir oatfmDelues t) exoio3no1lltn ictl()arumuront0tlt  ietytlm2rlnvo;(4altoirciatfatrlneslt setoxm oy1al nmnei ( s2umum ;t0tpxo f3tls a2ranvp t0 etrmo oatlatr neils s2toxm nodll elfes sf 2ua(rpou0aeeomoetatlsDrmuvonu4artrmoctytfptraivilt  2xmiopno4ape  nct s a2tau ont0oetniieild a2em( p (4areomo3iotlatelivs (0s2xoxrpoodale mfetls) Duau  oo1ape mictatlmDelnmonu)arxomoctytfmt li i s) 2umiopiydaptelnvtl( artr(  no0oexniicias aDumumpn() eerif iydfa rlu i;()trxmir3no4lm nliciat)arrr(m nt0aleniiciltlm eaumsnu) leoif3ty1fp  aivs ( srxo(rpio1alen fci sfsDta(ront4tlx  f3iasla ua( s t) ltrxfciatfa   n ilt)s2umxo oudal elncsl() 2uaxmoot4olt ifeiadfa2ranvsn() rerxo tytfpDeluvo;( tetmxr3oodamt mneiat  rur(mpnu1aeeoii3tldfs2emu o;t4arxoif3tadlmt  nvs (0s2uoirpno4optelnesl( aDrrumont1tle ii3ildfa emuvs;t)aexoxf ia1fpt aieil()s2xm(opoudol e ictltfartr( p;t1oltomi3tatfs2rln onu0artrxf tatfptranvi;( t2umimpny1lptelnes s  Drmum nt1aee moeiydfsDra(vpn() renxr io1omtr n o;t t2toirpoodaltn fcsa(fs2rm(moot0ape  ociadfm2em( snt0alxrxo3iodlmte n il(0texmxrpiy4altn ncia(fs2ur( oot4olxniiciysls2eau p u4 rtriocty1lp r nvs t0t2trxrpiydap n fcsatfaDumx poo1opxomo3iatfsDemnmont4aeeoxfciotlmDr n i;( teuo(o3iudaltelfei ( a2tr( p;t0opt mietyslm2rmuvp;(4arxnio3tydfp rau ils)trto(mpio4lm  lnctlt)s2raur no0apeo ocildfs2ra(mpnu4trenxo oy1fpD  i s s0trxoim oydllenmnct (f ruax  ou1oex mfciyt s2um( s (4 ltrmfctatfa  lnei s s2xm(r3oo4al  mnvias s2trxmoou1oeenmociad s rln on(4aexoxo3oo1oa eai i s) ruoxmpoy4ope lncs ( s2umxrpnt4tpx  fciytlaDean o;u0aeenmr totfaD ai o t0 etrxo iu1lm eliei t a2um(mo;o1aee  iciydls2emnmp;t0arenif3oadfptrluesls0trxm(r nudlp emnet sfaDtax  oo4oetoioetasfs ra(mp u4alxnxr oa1omDranvo;(0seuoxopno4lp emicta(fs2tmur nt0tpxomieiysls eln p t) rxnxfcty1opDrlneo s0 2xrim nudapen ivilt artr(rp;t0tpeoiociydfa2uln s (4trerxo3iadfmtrluesls0 etmimpio1lpt lfct sfs2rau pnu1aleoioetld sDemuvs;t)trxrxr oytfa   iei (0s2xm(rpno4lmtn ieias  2tax  nt0apx mfctadfm rmu s;u)texrmf3iytfmtrli s t0 2umxrpou1omtnmieilsfa2rmx  oo0aetn i3iys a2em(msnt0 rtriociodomDrln s s t2xm(r3nodamt  fetat) Dtrxmo;t1oee mfcilsfmDranvs;(0tlxnif3tatlpteaivi;s seumir3oodam nlivs s)s2ta(m ;t0tlto octltla emuvonu0 lxnmo3tadomDr i slt)setmxr3io4ape lict s a2raumoou0oet miciltfs2rl( s;u)tetoif oytlpDeluvs t srxrxmpoodlmtn ictat aDtaxmp;t0teeoifciltla um( p;(4 lxrxf iytlpt  ivi (0s2xo(r3ou1apee fvtas)aDta(mpot1oexn fetasla2emumo (0artomr to1lp elnesls) euoir3iydlpt lncslt)sDtm(mo;o0apeomiciatla2ua(mp;() rxomf oadfpt aneo;t0trum(r io4lmt mnvsa(fs2rmu  ot4oee if3iat m2ra( o;t0 ltnmr3oadlatrau slt  2xoxopoo1lm emietat aDur(mpno4oetoifcildlm elu p;(0teerxo3oydomDelies t seumxopiydopenmfct s)arurx oot0tlxomfciasfmDua( o;t0aetrmf3ty1fa  lneslt s2tmio oy4lme  nct t aDtrur ;t1oet  oeiys m uanvpn(0alxomo3iydopDe ivol()setoim oydll nlieilt a2trumooo0altnmf3tadfs ea(mo u0 leoxo ootlmDrau sl( s2xm(mpno4amt  ictlt sDumxroou1opxnmieiyslm2umumpnt4 eerxo3tytom e iesl(  2um(opoodalt mietasfsrrmx pot0altomociyd s2rau s;(0aetnmf iodopte ueo s0sruo(o3iu1llen ivta(fsDum(r ou4aee mfeiltfs2ranmsnu0 etrmf3ia1lmD lu o;s) exoxrpiudol n ivi s)srumu  oo0tlt ifciadfaDrm(msn(0teerio3io1fp r i o t t2umirpoodalenmfviltf 2urxmooo4aexnif3iytlaDuanvo;u0tleomo iatlp eln s;t trxo(mpiy1llen fvia() rtm( p;t0olto fctadfm umu p t0 exnmocootla elnes;s) etrxr nydllenlietlt) Dumurp;t1tee iicilsfaDuaumsnt0trtrmfciatomDraies;s s2umim3iy1alen netls) rtm(  ;o1alx io3ilslm ua(vpnu)aexrmr3iytlmD  u i t0 2tmio3nudomen ict tf 2ua(rooo0teenmiciytfs2umn on(4altrir iodlaDrluvi t)setmxopny1ape  fetatfa2tm( pnt1aleo ieiysls emumonu0aeeoif3tadfp raies;s)s2xrir oodape lies ()sDtm( pnu0tlen ictad s umn p;t) ltnif3ta1lpD luvils t2uo(rpio1lp nlfesl() 2trur ;u1aetn octas aDranmsnu4tlxnmo3tydomtr n s;s  2trio ou1lle  ies s) Drmu pnu1aptn ieiydlmDranvont4teeoxf3ta1faDeau ilt0sexoir nodop nmfcil( sDur(  oo1oex mf3tyt s2ua(ms ()aexnif oy1omDrli i;s)trtm(rpiydlmen fei sfsDuau pot4altn fctysfm emuvon(4treomf iy1fat  n ol()srtrxo no4opeelfcil( srraxro;o0oleo o3iltfm eauvonu)teeoxr tydlpDrau sl() exrio3oy1lp nmfvtlt)s2uax o;t0aeenmfetatfmDeanms t)aexomf iytfat  ivo;t) euoxrpoy1omtemfctas s2ua(mp;t4tleoiocils mDrmnvp;u4tlenmr3totoaD  u sl(  etoxr iy4op n feil(f rurxm ;u1tpeomieilsfa2ran onu) ltriociy1fptrauesl(0 2trir nydom nlics t)arrr(  nt4opxoiictyd s2ua(mo;(0aexriocoy1la rau sl()t2tmir3io1lmtnmncslsf 2tr(mpot4oeeoif3iasfs2umu ont0texoxr3iotop elivi;s)t2umirpoydoltemfviltfsruaumo;u1tleniieiltlm eau o t0teeniocio1fpt lnes s)setrxr3oydlptn ieta(fsrtaxmpnt4aetoii3tas s ul( s;t)tltoxf ta1lm ranvs t setrxr3no1omee nciat)arrmumooo0tptn fciytfm eanvon(4texnxo iytom e uvils  2urimpnu4opeemiei s srtrum ;t0oet mf3ild sDrauvs;t) rtoxo3iatfpDrlivslt) rto(m oy4omeelnvi sfa2rrxmoot4aeen o3iatfa2emnmo u0tltnir3to1fmtr nei ( t2umio ou4llt lnctasf Dtm( o;u1aeto ocias m2ra(ms;t)aeeomr3tydfp rai i (0 rxr(opou1lm nlict s arrrumo;t4alxniieilt sDel(mp (0 exoio oatfmtr i ol(0t2tr(r iu4ol nmivtatfsruru ooo1tpxnmieildfs2uauvs (4 reoxrciydlpt au o;(0 eum(m nu4aptelivi (fsrtrum nt0apt iiciyd s2elnms u0trenxo tadfaDeaueils0t2urir oydlpte nvtlsf Dumxm nt0apeomi3iatls2ra(ms;(4 lxnmo iytoa eaueslt0 rtrxr oudlle  ici ( arra(rpoo4opxnmfeilsfm rm(vo t0 rtoircoa1lp  an i t  exr(opnu4ol emncsls)aDumumpoo1opt  fcild a elnvp (0 eerxf3iotfm   nvs;s t2tmxo nydamt mfvs ()a2tru  ;t4tpenioetytla uanmo;(0altoio3iadlp e nvs;t)t2xr(r3ou4amenlnvs (  Drr(mp;o0tex iociad a ra(msnt) lerxr3iatlm e uvsls0 2uoir ou4ll  lnesa()aDtmumont0oeeniieiyt a rl(vonu4teerifctytom r uvo t setmxm3iodlpee ietasfsrtr(mpnt4texomi3iltls uanvpnu4texoxo3ia1fmDeaues;s0 rxrxo oo4openmfvslsfsrrmu ont4optoif3ildfa2elumo t4tleoxr iy1latrlues;s0tetmim nu1op  mfcilt)sDtr(mpnt1olx iiciys mDulump;(4areoxo io1lp  aieo;s)s2xoim3iodopenlicil(fsDtr(  nt1optnmictytlaDul( p;(4tlerio3oa1laD lu i;s) 2xr(m ou1oleemneiat) 2tm(m nu4ole moeiysfa ulnmpnt0 eenmf3oy1op r nes () 2xrxo3iudll nmics s sDrmum ;o1aetn ieildlmDea( o;(0 ltoxr iadlmD an i (  etrio3no4lm  licta()a2trurp;o1aex  ietas a2emu on(0arxoif io1fpteaueol( t2trir3iy4lpt lncil(f 2umx pou0oeeomoetyt a eanvs u) etnxo3tadfptrlivs t0trurxrpoy4ol e fctatfarrau o;u0oleomictltlmDrlnmo (0 lxrxr3oydlaDraues s t2trxr nydopen fvi t) 2trumoot4altoifctltlmDua(vs u) ltrxf totfm elnvs;(0texmxmpiydomt lnvi t) rraxm ot0aeeoif3iadfmDrluvo;t4alenmrciy1fm e neo s t2uoxm io4aleelncia(fartmxmpoo1tlt ii3ildfa eanms;u0aleoxrcty1fmt  nvsl(  2xmio3no4lp nlfvsl( aDraumpnu0apxo fctytfa rluvo u4tltrmocty1la r ivo s seur(m3no4olenlivtlt) rrm( poo1tlx ii3tltla ea(vo;(0tltnxr tytfpt  u slt0setm(o3ny4ome lfetl(  Drauro;o1opeoio3iydlaDrlu onu)trtniocootom  aieo;(0seumxr iu1ol   fet t sDraurooo1olt mociyt a2rau s t4tlxoif3tytlmDran ils0setrio3iy1lme lics s  Dumu  no0alt  iciad m2um(ms u)tltnxo3ootoat ai ol(  rxoim3iu1ole mfcsas sDrau p;o1ole  ieiysfs2emn o;(0altrxf3to1fatrau ol( trurxr oo4oltemneia( artaur nu4tpxn feiys mDulumo () eenioctatlpt  u slt s2ur(m3oo1lmt mnetl()srum(  no1aex ifctls m umumpnu4 ltnio todomDrli olt) etm(r3oydlme lfcs sfa2uru pnu4oex  ieiat mDumnmsnu0texrmr iytfmDelu sl(0trxmirpnodlp  miei sfs2ta(rpno1tpenio3ilt sDeau p;t4teeniociydfa eaneols  rurir3no4lmtemfcs t s2raxmp;t4aexoifciysls rau pnt0 renio tytfmD ln s;t0 euo(o3no1lleelnvia(faDurur no0aptomo3iyt sDrl( o;()arermf3oadfp ean olt) eurio3nu1ope livils)a2rr(rp;u1oet moetydla2umnmsnu0tetomr ia1omteai i;s seuoxo ou4om e fcs ( srtru o;t4open fctytfmDranvpn(4arxnmrcto1faD  ivols  ruoxr3nodap e ncilsf Dtmum ou1opxoifctad mDumnvp u0artrxr3totom e ieo;()t2urxo3oy1apee nvslt) 2rmxro;o0opt  oeiltfa ea(msnu)tlxrir3oodoa e nei;t)seumim ou4ol   net (f 2rru pou1alt  ictas a rmumo (0texnif3iytfm ranvs;t0 rto(m nu4apeelnesltfsDtaxroou1oexomiciasfa2ea(mpnt0aeeoir iy1fat livi;() exo(m3nudamte ncs (fs2umur ou4opxo o3tydfs2el( s;u) lxrio3ty1lpD lnvol( teum(o3oy1aptelnci t)s2tau ooo0apx  o3iatla elu p;u4tlxoxf3todomDranvolt sexo(m3oo4am nlivs sfa2ta(moot0oex  f3iasfsDrm(vp;(0arxoxr ta1fmtraneo;( teto(o3iydlleelfvi s s2rrx oot1aeeomiciat s elnmpnu0 etoxfciodlmt livs;t) exr(m nudapte ict (fsDrrur ;o0tetnioeiyt mDrm( s;t)areniocty1fat  u i;t)seto(opnu4lle lfei ()arra(mpnu0aet moeiys mDuanmp;t)aexrxrctodfa  lnes;(  eto(o iu1ope lfvil(f Dtau ooo4tleoiocilslm el(vp t)artrmf oy1fm   n s;t  2uriopoo4am nmfvtl() Dur( o;t0oltomociysls emnvp u) exrxf tadfmDeaies;s0tetr(o iu1lpt mfviasfsrua( p;t0aex mieiysfa2eluvs u)arxoir3iatomteliei;(0srum(m iu4lmenmictlsfs2tr(monu0texnmi3iadfs2um( p;t4tlermocoy1lpte n o;t)setr(o3nu1alt licias aDtmx pot1teto iciaslaDea(ms u4 etoio3iydfpte n sls0t2toimpio4aptemfvsls sDurumonu1oet  fciatfsDumnmo (0 leomr3iotoptr nvsl( setmio3oy4om nmiviasf Dtr(ronu4tpxo f3iaslsDeaums;(0trtomr3iy1fate i s t0t2umxr3ny1olee nviasfsDtrur oo4tleoii3iltfaDrlu pnu)arxnirciy1opD an sl(0 rxrio oodom emfci (  rrrxr ;o4openmfciysfmDrmnvpn() leoifciydfatraiei;()sexm(m iudole  fcslt)aDta(ro;t4tleoifeiltfs el(vo;(4 lxoif oodlm eau ilt) rtoxm3nudop nlnvtas) rra(m nu0ape mi3iyd m ranmp u)alxrio3ty1opDranvol( trur(m3oodaleemfeiat sDurxmono1oee if3iadlmDul(mp;u4 exoirciadfa   nvo s) 2xoir nudom emnvilt) 2rmumpot4aee mfctlsfm2umnvo;u) lxomr ty1oa rli i;t)texmxo iy1amt  nvslt) Dta(m ;t1aex  ieiadfs elump;t)aeeoiociy1op rauei;t)tetmim no4lmt liet s sDum(r ;u4oltniociysfs2eanmont4altnifctodlmtrlueilt0srxmxo nydlp  mnvt ()a2tr(mpno4oltniociyslsDulnvp;(0 eeoxfciydfp  aieols0 2ur(o3oudomtnlncta(f Dtmx o;o1oex  octytfa emuvs;t)teermo3ia1fp  livs () rtrio3ou4lmeelnci tf 2tr(m no1oexnmiciatlm2rl(vs;()alenxociotfa  li ils0teur(mpou1ll n fetat artmxront4olt if3iadfm emump;u)altoxf3ta1lmD au o;t0 rtrxr3nodom elivi s srumxrooo1aptnifcilsfmDua( sn(0trxnir todfmDelnei ()s2xm(o oudom emfesas a2um(mooo1tpto ieildlm2rm( s;(0arenmociadop elivi ()s2xmir iu1llen ietltfs2tmxrp;o4altoiociytlaDrm(msn(4areriociydfpte i s ( sexoxo ou1ol emieiat sDtrxro;o4apx ii3iltfm umumo (0 reoircoadfaD  ies t)t2trio no4om nlnctlt a2urxm ot1opxnmfetldfsDumnmont0aetrmfctytoa ranvo;t sexrxr iy1op n fesa( sDurxmp;t1oexnmi3iysfaDrl( o;u4trtrif3io1la  auvi s0 rxrim3oudlm  mietls a2umum ;t4alt ii3iasfm umuvo u0aeeniocio1opDrlneo;(0teur(rpio1aptn ieia(fsrua(moot0tpxn feiad aDrm(vo u)altoirctodomt au i;t)t2um(mpoo4al nmnvi (fa2trumpot4oet iiciatlaDrau o (0trtrif todfpDeanvo;t0 etoio nu1ll e neilsfarrmxrpot1tltnmi3iadla2ea(vp (4treoir ty1fptrluvils s2tmimpnodlmtn fvs s s2rmx p;o0tpx  o3iad aDra(vsn(4tltoircio1faDr ieols0t2ur(o3iudlpe mnctltfsrrm(mpnt4olxnmietydfa2umumsnu0 lenxr iytlp r n olt t2uoxo nudapenmfetl( aDtaurp;u4alt mociytfa2umuvsn(0tltrxocio1fmDr iei (  eto(r3ou1opeelicsa(fartaurpnt1ale  i3tltfs umums;t0arerxociytfaDraivi t0t2ur(m3iy4omtnlfet t) 2trumpoo1tpx mfetatlm2eluvsnu)artrir tadopDeluvi;t0 rum(mpio1lmeemfcs tf rur( ono4aeto o3tldlmDul( o (0aeeoir3tydlatrau o t0teumxm3ou1ol  lncil() Drmurp;t4oetnmicilsfm2rln s u)arenxr3totlpDrlnvo;()seurxopoy4am  lietat)aDrauronu4opx  ieiysfsDemnmp (0 leoxr oydfmtrau s;t0s2tm(opnudap emivi s) 2tru o;u4tex ifeiytfm2ra(ms;u)trenifcoadomD ln ilt) 2ur(r oo4omtelictasfa2umu oou4apxnmfeiyt m2ean ont4alxnmr3oadfa r ies ( trxoxo3ny4oltnlfesat srrrurpoo4olt iociatfm eanvp;t0trtnif io1la rluvo;()texm(rpou1ol n ieilt) rtmx onu4aeenmi3ils sDeluvs ()tetnmr3ta1lp  aneo t sexo(m nodlmtnlncsltfsruru oot0oeenmfciys aDrauvsnu0 rerxf3tatoptraieo ( t2trimpio1omt lfct (f rur(mpnu4tpen iciyd sDelu o;t0 lxrxf3totfa r u o;(  rxmir nodol emfeil(fa2rm(  ot0aet mfeilslmDuanms;t)tetnxr oadlaD  uvols)setoirpoydlpenmfvi s)s2raumpnu4aptniictatls uanmont4alerir to1opD aiesls0t2xoxo iydome mfvtasfa2ra(roou4tpxnifctlsls rlu p;(4texoircia1la r i sl(0srum(m3iy4apeelfetls  rrrxm ;o4tleo feiatlm2um( o;t0 leomo3totlp eaieo;s) rtrxm iy1lpeelfctat srtru p;u4ape mf3iytfa em(vp t0areomfciy1oaD li o s texr(o ou1llenlfesas)srtrx pot0tpx  oeiadlm2ua(ms t4 exomf3ia1oa rlues s0 rumxm iodomt lnctasfarrrx ono0tpe  ocildlsDum(vp u)tleniocoy1lpt auei ( sexrirpnodllt  fcslsfa2ur(mooo1tet  i3iasfm ul(vs;u4trxoif3oy1fate i i ()seur(opno4ome  nvt t)sDrr(  ;u4alxnioctatlsDrmu p;(4aetrxf tydfa   ues;s)t2um(m iydopt  nvt t sDraurpou0alx iociysfaDrl( p u)tlxrir oo1op eanvols)t2uo(rpiodlptemnvias)s2trur ot0opto fcilt sDuau sn(4 ltoif3oytop raneo;(  rtmir3no4op nliet tfarumx p;t4alxnmi3tadla2ran o u4tlermocoatlaD ln i ()tetmxmpoy1ll nmivtas a2urxmoou4aexnmo3iltfs2el(mo t)alxoifciadlatraies;t teum(r3oy1llt liei s arraxmpnu0opxn ieild a ulums;(4aeeriocoatopteau s t0seto(m ny1aptelnvt sfsrtr(mono4tpxo o3iydfm uanvonu)aeeoxf oa1optr n i (0truoxo ou4amenlnei sf Dum( oou4tptomf3iyslsDuanvp u4 lermr oodfa  ai ols0srxoio3ou4lltemivs () 2trumpno0opxnii3iyt mDemums;t0arxomo3to1fmDe uvi;t t2toio3no4lm  lfcta()s2tmxmpoo1aleoii3tld m2em( o u0 lxrmocoa1fmtelivo;t0 2uo(m3nu4op nlfet tfs2uau onu1ape  ieiatlm2rmump () lxrmocoodfpD  ieo t s2ur(o oo4al elietltf 2tr( onu0alenioctld a emnmonu0alxoif tydfaDe uei;s) rtoxo3nodapt lnvsls)artmxmoot1olt if3tys sDelnmo u4alerircoy1lm  anes ( s2toirpio4lltelfeia()sruau pot0opeo oetatfm uan p (0texoio totlate ueslt)texm(m iydamt miviat srtmu o;t1opxnmictas s2ua( p u0aeerxfctadoptran s;s setrxo ny4lle lncs tfs2uaxro;t1tlenmictat s2ua(mo t0tltrmr iydfa raneo t0 eur(opiodomtemivt (fa2umx  ;t1apto ocilt aDrluvpn()altomf3tytfm  aiesls srur(o nodlpenmneil()srrm( p;t0alxnmfeiydls uanms;u0 lxnmf3tatfa elneo (0 ruoir iu4lpenliesatfsDtrur ;t1tpxo o3iadfmDemnvo t0tlxrmfcio1omDe nvsls seumio3oo4openmivilt srrm(  oo1alx  feiadls2uanvs;(0 etrmo iytfmtelu s (0 2xmxr3ou1ol nmfvt tf rtmxmpot4tpenmoetltfmDemumo;t)trtriociydom rlies;s0 exoio3oydol  lfesa(f rrmx p;o0alt iieiytfa el(mp;u) eenxrctadlmt aies t setrio3no4lp   ncs (fsrraumo;t4tle  oeiltlm ul(msnu0 ltoir3ootomDe u i s  2tm(rpnudlpenmnvi sfsDurxro;t1aet mfcild sDrmnvp;t0artoxr to1lmtr n o t s2umxopoo4lptn ncslsfs2tmxmonu4tle  i3iasfsDem( sn(4aetrxociotfaD anei (0srum(m iu4omen fctl( s2rmu  ot4tle  f3iytlm uauvo;()alenir oadomtelnei (  euo(m ny1amenlfcs tfa2ra(m ;u4openmietysla uanvpnt4teeoio iadlmteli i;t)setrir3iu1ome lncsls)srtm(rpot1tpe mociytfs el( p;t) lenio oytlaD ai o;t0setmiopno1lpte ictlt  rra( pnt4aeeomo3tyt sDra(vo t0 lerxfctodlm e u ols) euoxr nudol e icsltfartr(  ;o0tleomfeilsfs2umu p ()alxrmr3ty1om  aneo (  2tr(o nudame  ictl(fsDtmu  ;u4aetomf3tytfa2rau s (4 etrifciodfm e n il(0trxoimpiu1ol nmfcia() 2taumono0oleomfetas s2raumpn(0areoxo tytom eln i;s0 rtmxm iu4ole  fei sfartr(m no0aeenif3tyslsDrluvon(0 lxnxrcoa1oatranvs;s)setmiopoudoptnmfeta(f rrax  nu0oee ii3iadls emump;u) exrmrcoo1omt ln o;()sexr(m nudal elfvs s)s2um(rpot0alx ifeiydlaDumn snt4artomr3oodlm  aieils  rtoir3io4ol n nvsa(f rrm( o;u4tet miciltla ulnms;(4tltomo iotlptean o;s)trumxo3nodape mfvsa(fsDtmu  nt0opto f3ild s2rau p u4arxnir3oodoaD  uvo s0texmxr3nu4lme mietls srtmur ;t4alt ifciadls rm(von(0arxrxr ta1fm  lnesl(  2toxr3oy1olt  ncs ( aDurxro;t4ale  i3ils s2ranmsnu0tltoir ootfaDelu slt) ruo(r3iudome lieslsfsDrax pot1ape io3tadfm2rm( s;u0tlxrmfcty1laDranvi t) rtm(rpiu4llenlnctat srtrur no4aet miciyd a ea(mo t0tlxoir3iytlpD  n ol()teto(o3nodom nlnvtls  2rr( pou0ope iicilsfm rlump;t)texniocio1om eli o s) 2xm(mpio1op e nvi t arum( p;o1olxnmiciysfaDrm(vsnu4treomo oatfateaieols0s2uo(o3iodape  nvsat)aDtrurpou1tltn fcilsfs2ran s;t0 exrio3todfmD aivi;s s2xo(m io4om nmfes t) Dum(m ;t4optomociadlaDuan on() reoxoctotlaDe ues;s srxmim nu4lp   feilt)srta(ront0oetoio3ild m2rm(mp;() reoiocoydlm  lu s t0trum(o iodal  livtat) Duax pno0tlxnmiciydfs2elump u4 rtnmrcootlmt  n s;(0sexo(r iydll nliei t artmx oot4teto f3iatls rl( s t)tlxrio3iadfmD aneo t s2trim ou1ll nmivi s  Dta( p;t1apxnmociyd s2elu onu4arenif3oatomDran ilt0texr(r io4lpt lfvi tf Dtmx o;t4optnifcilt s2umu p;u4trxoxr iatop r i s;(0t2trxm3oodlmeelnesat aDtrx oou1alx mf3iad s2eluvo u4 rxrio totfpDraivs;t0t2xrxr oo4am emfct () rtrurp;o0olxo oeiyd mDulnmont0texoif3io1oa r n sls) rtm(mpiodllt liesa( sDraxrooo1optnio3iydls2um(mpnt4aexoxociy1lat livi t)trumim3iy1ope  nctltfsrumu  nt0apto ociatls2rlumont)trtomociadomt  neil(  2toir nydame mfct ()s2ta(mp;u4tlxn fcilsfm2rln p t4tleoirctadla  lnvi s) 2toxrpiu1omenlfvtat) 2tr(ronu4teeo f3tytla uaumo;(4trtomf3oadlmDrli i;t0srurio3oydlleemncils a2tmumo;o4apeo i3iasfaDean p;(4tlerxfcoo1om  li i ( seuoio nydop nlict s a2rm( p;o4opeo iciad s em(mpn() rtomoctatfpDe nvsls)seurxmpoodam emnvsl( s2umu pot0texn ociydla rmnvsn(4trxomr3iydomDeauvi;(  etrir3iodamee netas  rumxmonu4ape  ieiltfm2ranvsnt4tlxoxf iy1fmD  nvs (0trtm(o ny4lltelfctatf rrr(rpnu0tet  oeildla2eauvon()teenmr3oy1faDr i i;t0 2trio3nodlp n ncil()s2tax  ;t1oex  fctldfsDranvont) exnir ta1opt lues t)s2uoxo oo1om  mfvsl(fartaxrp;o4tleomiciasfaDeaumonu) lxrmf3oadoateaivilt) ruoir nodll elies s sDtmum nt1tlx ii3ias a2rmu snu4arxoxrcoa1fa eli il( setrir3ny4aleemictl()srtauroou4oex moctytlaDranmpn(0tlenio3oadlm  luvo;s s2triopno1ol elnvsl(f 2tm( p;t1alt  ietasfm rlnvpnu4 lerio3tytlpDr i s s s2xrio3iy4ll nlfei ()arrru oot4alenioctysfaDrlnms t0trtnxf3oy1la rlieo s0t2xrxrpoy4altn ncilt)a2urum ou1tetnmiciatfa2rl(vo t) lermociotlmtr i slt s2uo(m nudam nmncilt srraxmono0opt ioetys mDrmnvp t)teenxf3tytomD an il(  2ur(o io1alee nct tfsDtrxro;t0tlen ocils s ranvs;(4 reoif oodoptran i s  2toxmpoy1lp n ivsat artrxmp;o4tpe  feiys aDum(monu4areoir iy1fptelnei;s srxmim3iodaptn ncsatfsDrrum nt1apxoif3iydlmDel(mp u0alxnif iytomtrluvi;s0 rxrio3oo1alenlfvsat)aDrrxm ;t4oltoiociltla ul(vont0alenmo3iatfaDelueo ( setrxm3ny1ol e ivt (  Dtmxmono1tpenii3iys m ran p u4 rtnmf3totfp rlues (0 2uoxm3nydoptemncsltfs2trxrpnu4aptniictytla rlnvp t4arxrxf totlm rlu o s setr(r nydom nmictl( aruaurp;t1oexnmfcilt sDulnms t0trxoxr3totlaD lnes;s texrxrpoudomee fes (fa2umxm no0oee mo3tys a2em( s t)trxnifcoadom rai ols0 exoxm ou1opt lict ()s2um(mont4teenmicias aDuaumsnu4alxoxr3oadoptr uvs;t  2umxm iudalt  ivsatfsDtrx p;u0opxnmfeiyt aDrm(vp;(4 etrxoctotomDelivsls0 2urxmpnudape lnes (  2rru p;u4opto ictlsla2umnvonu4 rxnifctodlmDr uei s setoxopiu4alt licsasfarum(roou0tlxo ieiltlaDuau p () exnif3oa1fp ranvi;t0sexmxr oudalenliet tf rtmxrpou0tptomi3tys m rluvs () rtrir3oa1lp rlieslt srto(m oy4lpt lfvt (fa2ta(  nu4apxnmfctldfa rl(vpnt0 lerxf iodoptraivi;() etrxr3oy1aleelnes (f Dtrxmpot0oleomoeiydfm2ranvo u)tetomo3ty1fpte u s;(0s2to(r io1omeelfci s) 2trur oo0olto o3tysfaDuaums;u4teenxf ta1latrai sls0 etmxr3nudolt  nvt t  Drrx pnu4aetn o3iatfa2ulu s ()trtnxr todfaDr uvo () exmxopny4lp   feta(f Duaumpno4tle  oeiltfsDel(ms u) lxnmocoy1lpDe uei;t)sexr(r3nudamtnmietasfs2rax  nu4apeoii3iyd m rlu o t0aexnir iydlpD li slt)s2ur(m3oy4ape  fvi s a2umumooo1texn ocilslsDeluvo;u4 rxrmf iatlm eau s;() rxo(opio4alt mfcias aruru o;t0tlxnifcils sDrlu p u) eeniociotopteanvi;s)seumxr ou1ape lfet t) 2umxronu1texnifetlsls rmu onu0aexrmf3to1op  lueil(0 rxrxr iy4alt mneias srurur ou4olxnmoctad mDrlu pnt0 lenxo todla e nvs;t tetm(mpnodome mics (  rumxro;t4apt ii3iadfsDua( o (4aexomo3totlm rauvo s  rxriopnu1op   ivta() rurxrooo1alxn i3ildla rmn sn()teeoxo3oatoat an o;t setoimpiodlleelicils a2ta(roou1tpx mfcilsfa2raumon(0trtoxf3iadlmt anes;()t2uoiopoy1oleemict ()s2uaxrpoo1tpen fetaslm2emu snu0arenmoctodfm   ues s s2urir3iydlmtemfvs sfartmu onu1opeo iciysfm uan on(0trtoio3iytla rln s t0 2xmxmpno4al elfesa()sDumxmo;u0teeoiiciytlmDraumonu4tlxrirciotfmDelivil(0texm(o3oudolen nvt () rumu poo4tpx miciatla2elnvp (0teenio3tatomDranvols0trur(mpou1optemnvsls) rrmum ;o1apt ii3ilt mDul( pnu) rxomf3iy1opD ai olt0srxr(opiu1apt  neiasfartrum ou0tlt  ictadfs2rau snu0trenio3iydlaD lnvslt0srtm(r3oodop n fvi ( aDurx  no0oet ifciltls2emu o;(4texoif iodoa  lieslt0 euo(mpio4llte fcta(  rum(r nu4opt mfeias sDuln ont4arxoio iotoptrauvo;( t2umir no1lmen fviat)s2tmxmont1opeo i3iad a2eanvs;t)tetrxf oadoaD anvilt0srxrir iu1lpt mncils)artmurp;u1ale mfciatfa ulnmsn()alxoir3to1lm  lnesl() exrirpoo4lmtnmnvsl()sDra(  oo0tex ii3tat aDrau s u4tlenxo3tadoptrauvi;s)trur(r3iudlpt  iviatfsrum(m ot4tex miciytfsDuan o t0 lxoif3tydla eauvo ( srxoxopoo1ap nmfcias)sDuaxr nt4tpx iieiat aDea( snt0trerxf3ty1fpDe ueo;() 2umimpiydape mnvtls)aDtmx o;o4ale  ociytlm2uluvpnt) rxnmf iodfaDr u o;s trurim io1lm e fctatfartr(mpnt0altomo3iat aDum(mon(0aeenmfctatoateaivo t  rxmxmpou1op  mfes s a2taumo;u4tpxoiociydla2ranvsnu0aexrmocoydlp   ues;s0srxmxopoo4om nmici t s2rrx pot0tet mfcildlmDranmonu0aexomrctatfp   nes;t0srto(o3iodlme miviasfa2rmumpou0apxniociydfm ua(vp;u0 eeniociatfpDr nvi;( srtrimpno1olt  ies ( sDrrx ono1texniieiyd sDemumo t4aexnmr todfp  lues;t  2trim3ou1ole lfci t) Dra(r nu0alxniiciltfm um( s;t) rtomfcio1opDe neolt) 2uoirpoo1ap e iesl(f 2tmu pot0tetnii3iatls ran s;u)aexoircty1lpD anvo t0trumimpnodlm elnei tf 2rr(mono4apt moeiadfa ua(vp u4teenxrcoa1optranvi;t0srxo(r3iodamenmiei t  rrrx pou1tpt iietld a2ra(vp;(4aetnxo oa1la  auvi s)t2uoir3io1lp e fetat sDraump;t0oee  ieiltla2emnmpnt)trermo tytfm raies t  etrim3ou4ll n nesls arrmumpnu0ale  ieildlmDrl( snu0trerxo ootlpDean i t0 etm(rpiudlle  fei tf Drm( poo4aeenmociysls2el(vp () ltoxrciadla  lu ol()srur(rpou4lmtnmfesa(farraxmpoo1optomf3ilsfa ua(mp (4trtnmocty1opD  nvi t) 2xm(r oy4op elfesa(fs2ta( p;u4oeenmietasla2ra(vont4 etnxr3oydoptrlu s t  rumir3nydaptn iei s srur(moou0tpxoifeildlmDrl(vsn(0 rxnmr iydfm  ln olt)t2xoim3nudalenmnesa()sDrmxm oo0tle ioctysfsDea(vo (0texoircoa1fmt luvi t srxoxr3ny4lp elncta( a2rr(ront1aet io3ilsfsDel(mo;(0alxrmocoadomteaieslt)trtmxopou1ol e fviltfaDrr(mp;t1aeeoifeiydls2ua(mont)tltrmo3oa1lat  ivil( sexoxm3oy4amtnlfcils  2ra(m ;t1oltnmoetydlsDuanvon()aeenirctatlpDraivi s tetoim io4om e nvtls sruaxro;t0tpt mf3iltfmDranms;()arerxo3to1oat anvi;s)setrxo io1lp nmnvt t arurx  ou1tpx mfeiytfm rm(ms t) exomo oydlm  luvils)srtoxm oydop emietlt)s2rax  ou1oee  i3ildlsDel( pnt0 etoio tadfatr u i t)srxoio3oodaltemfvtat)aDtrxrpnu0tlxn ociyd m um(ms u0 exoir oodoat lu o s  euo(m3iodlm  mnct (  ruaump;o4opt mieiat a ulu s t0alxnxo3tydoaDrlivils  rxmxr iydom nmnct sfaDrrx o;u0tlx  fctad a2uan s;t)tlxrmocia1opDrlueo s srum(opio4ol emivta(fsrra(r ;t1apeoioetatlm2ran s;u0trtnxocoydfmD ln i;t  exmirpoydll e nei t aDua(mo;u1tle  ieiatlm uanvs;u0 reoio3totopte ivslt0tetmimpoo4ameelfvsatf 2urumpot4aexomf3iytls el( snt4aetomfcoatomDe n s s)teumiopiu4lm e nvs t arraxrpno1tlt ifetadla2eanmon(0trxnmr ty1fa r i ol()srxoxo3oy1oleemicslt sruaur ;u0tlx iiciasfs2rmu p;u0arxnircoo1lp raieols)srto(r3iu1al nlneias arurumpnt0tex io3iltfa2rlums;(0trtoifciydfpD  nvs;t)s2umio ou1llen ivsa(f Dtmxm nu4aptoio3iadlm el(mpnt0tetnmf3tydoaD anvsl(0setr(o3oodlpenmivsa()a2trxrpnt0apx moetldls2uluvp;(0 exnir to1op  auei ( seuo(opny4oleelfviatfa2rrx pno1aeenmf3iatfa2ean p t)trxnio oy1lpt lu ilt)srxr(o oy4omenmfcia() 2uaxm nu4aeen iciadfm emnvo;()tltnmf3ootopDr uesl( trxmir3iy1amtemiei tfarraurono4tpt  f3iadfs2umu p;t4teeoif3io1optelneo s t2xrio iy4lptelietls)arra( onu0aleoifciadlm2rau s;t4aleoir3ootop rlnes;t)setmxr3oy4oltn ivsas aDtrx pot1texomi3tltfmDrmnvp u4trxoifciadla   ivols  eurxo3oodoltn fctl( s2tm(ronu0apx  i3iydfa uanmp;t0 lerxo3oa1latranes ()s2xmxm no4al n fvsls aruau o;t1tex ii3tlsfm2elnvo;u0aexnmo3oa1lmDelneils)trtoio oo1oltnmivi ()a2rmx p;o0opxnmoctat sDem( p u0tlxoxo todfm eau s t0trxm(m3oy1am emnvs tf 2ur(mpou1apeoifcias a uauvp () exoio oytlpDeln o t0t2uoim3io1lp  lictat)a2rm(moou4oltomi3ildfa2uanvs;()artnxfcoa1omtrlivo;s) rtmxo iy4lm nmnesls  2raurpnt0oleomi3ilsfa eanmp;t0aexrxr tydlaD lueol(0trurxmpny4al   fei sf rtmurpno1altoiietadlm2ulums;t) eerxo iy1faDe neo;s0 2xr(mpoy4alt mnet (f 2raum nt0opxoifcild aDulnvonu0 lxoifciodoptrli o t trxr(opoo1lmtelnet ( aDrmxr ot4oeto octas m uanms () lermfcoatlmD au i;t trtrxrpoy1lmt mnciat) Drr(m ;o4oeen i3iadfa2umuvp;u)tlxomr ootfm  luvs t)trxm(opou4amtnlnciasf rua(mo;u0aex  oetat s uau s;(4artnmf iydfpteai s;(0trxrim3oudlp nmnciasfsrta( onu4oet io3ild sDuanvo u4 leoxr iodlmt lueilt0s2uoim iu4lle  nvsl() 2umu poo4ape ioeiatfs2um(mpnu4 eenir oatoaD  u s t0srtoxm iydam emnvtls arrmur ;t1tptniocils m rm( pn(4 ltrxoctatlmtelnvsls0tetm(o iydolte ivias s2raump;u0aeeo iciytfs emu p;u) rxrir3todfa elivi s tetrirpoy4apenmnci tf 2um(r nt0tpt  ociyslm2elnvon() etrxo ootlm elnei ()s2to(m3io4llte fvils) 2ua(r nt1olx iociysla eaumo t4aexrxo oodlptr u o t0 2xr(o nodlmte ivi t srtmumpno4aet iieiyd a2rmnmo u)aetrif3oodoaDrlu s;t tetmxmpio4ll nmfcsat srtm(mooo1olt if3tys s umn snt4 rermfciodopDelieo ()tetrxrpiy4alenlncsls  Drmumo;u1ope ifeiyslsDel( p;t)trtoxr oo1oa elivils0srur(mpiu4alte nvs ( srtr(m ot0tltnmicilt m2rmn ont)altoiociydlp ranvi t)teuoxmpoydlm nlneslt  Dtaxr nu0aetnmi3iysla um(mp (0 leoxo3to1oatr nvi s t2toim ny1ap nlfei (f 2umum ;t1ope miciys s ea(vpnt0trerxocoy1fpt lies;s) 2tm(o3oodamtemneilt arumurp;o4texn ieiatfsDuan ont4 etoif iotlmt  nvi (0 eur(r nudlmtnmieils)sDrrur
\ No newline at end of file
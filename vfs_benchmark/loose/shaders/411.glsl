@@ -0,0 +1 @@
+i s (  rurxm nydol elfetls)arrmxmo;u0olt mi3tas s rmuvonu) rxnxo todoaDeaivo;( s2xrxo oo1ape mfei ( sDum(rp;t0tlxnmfetad s uaums;() etrxr3ty1lmDeanvs;(0teumim ny4ame  nei () 2raurpnt1texoifcilt m rmnvsnt)tetoxfcoatlpDraieolt t2ur(m iu4optelnet (f rrmu o;t0texn octlslaDel( p;(4 exoif oo1fp   ieolt)truriopny4lptn iet (  Drm( o;u0oexnii3iadfsDuanvpn()tetoxr iy1fpte ivo;() eurxo3nu4amtemnvi ()sDtru pot0tpx miciysls2ra(mp;t)teeoxr tydlm e n s;t) exrir3nydolteliesas)a2uaxr ou0alt iictas a rlumon(0arxrif3tytlat lieo t trurxmpnu1ol emiet (fs2ur(r ot4tpe ifetlsfsDelumsnt4aeeoif tytlmD lu s;t0 2umxmpoo1lm nlnvs tf 2urx p;t0opxoiiciytfa em(vp;u0 lenifciatfmD  i o s0srtoio iudome mfvsl( sDumum ot4tlxnif3tyd mDulumo u4teenif oodop r i s;s) rurio3oodlm nliesatf Drmu  oo4tpxn f3iadls2um(mpn(4trtnxocoydfa rlueo t0 rxmirpno4ame mietas aDtm(m nt1teeo f3ildla2rm(vo (0aexomr3oydomt luvo s0trumxopnudapee nci sfsDum(ront4tlenioctatfsDel(vpnu4 etnmo iodomD lneilt  etmxo nudoleemnvi (fsDrrumoou1tle if3iys aDem( s;u0 etrmo3to1lmDr nvi;s tetoim ou4ape mfes ()srrr(rp;o1opx ifciytfa2ul(vsnu)tlxomr3iatlatelnvo;t  rtr(r io1lp emnes sfa2ua(m nu0alenmoeiadfa2umu s;t4 etomr3tydlm ean i s)t2tm(r3oudlp n fesl( a2rmxm no1olxo oeiatfs uan o;t4trerxrciotom rai il( trto(m oodopeelivs s)aDrax pno0aee  feilt a rlnvpnu4artrxfcootopDr neslt srxrxo3no4alt lfeils sDrmx p;u1tpen o3ilt sDean s ()arxomf oytlpDe ivil( sexr(m3iydom n fcslt  rtmx pnt1aexomietld m uluvp (4 rtnmf ootomtrln ols srto(m nudom  lnctlsf Dtmxrpno0tptnmieiydfsDem( p u0 rtrxfciodopt  nvils)srto(o3no1omtnmivia()srur(  ;u1tet io3iadfs2uanvp u0 ltrmo3oadoaD lu olt)seurxm ny4olte icta(f 2uaxmp;t0tlx  oeiytfsDra(mo;u0altrxf3iatfa rlues;s  rxoio io4am n nctasfsDrmu  ou4opx mi3iat m2eanms;() ltoxf iadlmt aues;s srtoxm oy4lme  fet () rtr(m no0aetoifctadfa rlu s;(0 eermo3iodlm raneo ( teuo(m no1altelnvia()s2rru  nt0aeenmo3iyslaDemn p (0arxnxociotfaDe i sls  eurxr ny1optnmfvilt)artmxronu0aexn iciad a2emn o t4 rtnmo3totop   i ils0 rtrxr iu4al  mfesl() rta( ooo4tetniiciatfm eau sn(0 ltomr io1omt li olt setoim iy4om  mnvta( srraxr ;o4olxo feiasfa rm(mp (0tetrir tytfaDraieo (0trtr(rpoydlp nmies t) Drru o;u0alx mfctytls eaums ()trermr ty1lm eauvs;t sruriopiydlltn fvt t)sDrmu  nu1open iciasfa emn on(4trerir3iytlate nesl() rurim ny1oltelieils  Drmxm ;o1alenmiciyt sDul( pnt) eenmo3oytomt ln o;t s2tmxopnydopeelfeta() 2taumpou4tlt ifciad aDul(monu4tlxnif tydfm e ivi s)truo(m3nydamtemictlt)a2umxr oo1aleoiictat sDeau p;t4 lermr3oa1op  ai o;t0s2toxo oudlmt mfci t srtm( oou0apenmfeiyd s2ranmo t4 eenmo todoa   iei t) exm(o3nu4omtemnvtasf Dtrur oo4alt io3ildls2elu s;t4trxnxr tytfpt  uvo;s s2xm(m ny1am elfesat aDurumpot4oeenii3tatfsDum(mp u4 etnxo3ia1oaDelues (0 rxoim3nudlleelicsas sDum(r oo0altnmociatfmDul(vs;u) ltrif3iodlpte uei t  etm(o ou4lpt lnviltfaDururont0tlxomietldlm2emuvp u4tlxnir ty1omDr nes s)trtrir iydape  nctas aDumumonu0tpt  i3tadlmDrmnms t0tetoxf3oadopDe neo s  exmio oo1omtnlics (f 2rr( p;u4oet ifcilsfs el( o;u4tetomf iodfpD li i;s)srtmxr3iodam n net (fsDuaurpno1ole ifeiltfm2ulumon(4artrmr3to1fmDe uvi;s  2xrxm oy1apt lncilsfs2trxmooo0tpx moetaslm2emu s ()tlenxrctatoaDrlu o s  2tmxm ny4aptnlivslt)s2taxm oo0apeoifciltlm rl( s;(4alxrxr3iodop  aivi t  2um(o3no4lptnlncsatf 2rrurpnu0tetoif3iydls2emn o;u0trtnmo3io1la eaivols0s2uo(mpio1olen ivsat) 2tm( oou0apenio3tltlmDranvsn(0tltrif3oodlpte nvol() rur(r oy4al emivt t) rrrxrp;t0opxomoetydfa2ranvsnt4artoxo totfa raivi t)sruoirpnydaptnmfvilsfsrur(mo;t0tpto ictlt s2ea(mp;t0trerxfciotlatelneolt0 2xr(o nu4lpte neiasf Dtrxrpoo0tpeo fciadfsDrm( p;u4teenxf iotop  aiei;t seumxo oy4lpt lfctl(faDrrxrooo4ape  ieilsfs em(vpn()trerioctotlmte iei;t0s2tm(m oo1omt lnctat s2ur(m ;t1teen f3iydfa rmumont4aetrmo oydoptraieo t) 2umim io1aleemfviasfa2rru pnt0tpx mfeiydlm2el(vpnt4 etrio iotom e neo;(0t2urxrpnu1om e neslt)s2rru ont1tpto fctasls2elnmp;(4 rxoxr3ta1laDeau ols  exr(m3iy4apt mivilt)aruax  ;t1aex if3iyt a2ulnmonu4 lerir3iy1lm  auvi;() rxm(r3oo1op  miei sfarraxm ;t1optomfeiadlsDrau snt0 rxoxf3iydlm  lieo s) etoim ny1lltnmfvta(  Dtrxmp;o1alt  oetlsls2rm(ms;t)texrio3oydfaDe nvsls)teuo(o nodlleelfei ( aDumxrp;t1aetoio3iatfaDelu p () eeomfcoy1omDrlnvs;()trtrxrpoodlmt mfvt t)aDraurpoo4apxoiieiysla ran sn(0 ltnxf3iytoat lu o s0trurxo3iudap elivsat)s2tr(m nt4tex io3ils aDea(vp (4tltrmf iotomDr n o;t0texmim3ou4lleemfvi sfaDrmurooo4tpxnio3iltlaDumu p u4alxnirciatla raneo s  rurimpoudalt mnciltfs2um(ront0aetoii3tatfm eaumon(4artnxfctotopD livols0 ruoim3oo4amtnlfct tfsDrmu ont4oeto f3tydfm2ea( on() rerif3oatlpDeau slt seto(rpiy4optelfesa(  ruaxmonu0ape mfcilt a uluvsnu) etnif ia1lm  aiei;s0 rurxm3oy1ll  mfcs ( artaxroot1teeo oeias a2emn o t4aexnmocoadlaDr uvi t)s2tmxo3oo4lmtn netatf rurxmp;u4aee mi3tyt aDumuvo;t)tlerxfctytfa r ueil()t2umxo3nydol  lfvilsfaDtaump;o0aexo ictydfaDul(vont0 etomrciydlpteauei;t)srtoxo3oo4oltnlfeiat) rtax  ;o4oexn ociyd m2uanvon() rtnir3oydomD  ueo;(  etmir3nu1al elfcil() rrmu ont1aexnifeiydfaDumump (4texomr ta1lpte n o;t sexrirpoy1lpe  nesat) 2tau  no4olxnmictasfmDra(von(0 lxrifctatom rlu sl(  2xm(m3io4lltelfciltfsDurum ;u0oex  o3ildla rmuvsnu)teenxf3oadfmte nvi;t) 2umim iy4ll emicta( sDurxrpnu0oexn ictldlaDrmumsnt4alxrmr3oodlptr ueols)texoxrpiu1apee ici s srumu onu4oee mi3tas s eluvp;t4 ltnmo3tatfm  lu s t0setmxm3iydoltemfvsasf 2umu ooo1aee moctldfa2ua( sn(0tltrio3oytfmD lu s s0 rur(r3oodlp emfvsa(farra(root1oleoiocias a2rmnms;u4trtnxf3tydom e uvo s0s2umir3iy1omenlfci (f 2ua( o;u1openioeiltls2rlumpn(0 etomo ootfa r ivo (0tetrxmpiu4lltelfvilsf ruaxroot4tpx iieiydlm2eanmpn(4teeoxf3tytlptrluvsl()teumxr3iydal elivtat arrr( p;u1aeto oeilt mDelumo (0 rtomo todfp r iei;t)trtrirpiodop emfvilt)arumxmpou0aptn ocilslm ua(vs;t)texnmociadoaD livols  2xoxr iydlpte nvi s srtaxmoot1oeenif3iadfsDul( s;()arxnio oytomDeanvsls texrxr no1am  mfvt (fa2rm(r ;t0tltnmoeilt s2umn o;t) lxrxrcoa1fp   nvi s0srxrxrpoy1apee fviat s2uax o;t1olx ioetysfa emnmo;u) rtnif3oo1fmDelueo s  2uo(rpoo4ll emnesl( s2umuro;u4tpxoii3tld m2uanvsnt0aleoiociadopD anvslt  rumxm3iydlmen nvtasfarraur no1alto i3tldfm2raump;t0 rxnifcoy1lmtrai o s0sexm(mpnodlm elfetat s2tmuro;t0tex iociadlm eanvs;()artoxr tydop eli s (0teumxo3nudapen fciat)aDuau o;u4optomociad a2rlnvp u4teeoifciy1lmDrluvi (0s2xo(mpnu1ol  mivilsf 2rr(mo;o0tpx ioetydls em(mpnt0 exnir oo1lmte iei;t0tetmxr3iu1lpe lietas)artax o;u0apxo ietltla2rmnvp;t4aetrmocto1lmtranvs t  2ur(mpny4ale lfct s)s2rax ooo0apxomicildlm rmn o;u) ltnmo3oadoa  ln sl( t2xmxrpnydomtelivsls aDua(r oo4tpxoioetytla ran pnt4artniociadop  auvil( s2xrxr3nu4altemivi t aDraumoot0aptnioctatlmDra(vo;t4 leriocoy1fat anvi (0t2xmio3nu1am nlicil( a2ra(m no4tleo feiatfmDrm( o;(4artrir3iydomD aues (0s2um(o3nudamenmfctls)srrm(r no0opeo octlt aDuau s;t4 rtnif3oatla ean ols)s2xrxopny1lm e icta(faDuru  ;u4ape iicildfsDrln pnu0trtnxocoodoatran ils)texoxr iy4lmen fcils a2uau  ;u0tpe  ictad s2ulums (0aetnxfcta1lpDrau s;(0seto(o iy4ll nmfvtl(fartmxrp;o0oee ioeildls rl(mp u4altoir3ia1om eaueo t t2uoxr oodalee neiat)sDtr(m oo4tpeoifeiat aDem(monu)trxomf3iadopte nesls) 2uoir ou4omtemnvt s  Dur(mpnu1tpe io3ildfs ranvp t)trxnmr iytomDr ueil() rurxmpnudaptn nvta(f Drr(r nt1ole  o3tyd s2elu sn() rxrir3oo1oaD  ivs (0trxo(mpno4aleemncs (  Dtmumont1open feildfa2um( pnt4artoxocootfmDr ivs s) etm(mpny1apenmfeils)s2tax  ou1olt ifcildla2emn onu0aetrmociodlmtr nes s0trtoxm3iy4om e fci sfa2rr(r ;t0opxnio3iatfm el( s u4 rermr oydfmDelnvolt) 2xrim3oy1olee neils s2um(r ot1oexnifetlsla2ulnms t0 renmf3ia1lmtr i s t0trur(m3oydameelnei t a2ua(r ou1oee iociytfm2ulnvonu0alxrir3tatfptean i ( t2um(o ou1lpte feslt aDtru p;u4apx mfeilsfaDulumsnu0 rtoio oy1omt aiei s  rxrxo3nu1lle micslt  rumxmo;t4tpt moetytfaDul( o (4aexoxr3tydlmDeln i;t0sruo(rpiy1olt  ncil()sDtr(r oo4ole ifeiyt a2ua(vpnu0aetnxo ootomteauei;s0 rumxopiodol emnvtlsfs2rmur oo0tptn f3tlslmDulu o u)trxnxrctatopDrlnvs ()trxoio oy1omtn nvtl(fs2ra(m oo0ole  feiadfs em( snt0 exomrcio1lmteauesls0srxo(o3no1lptnmfctatfsDtmx  nt4alxo icildfsDum(mon() etrio3oatop rluvi t teurir oodol emfcta()srrrxmp;u1aexoiieiyd m2ulu o;() exnxr3iadoptr ivilt) 2xmxm ou4lp nmfcilt)a2raxrp;u4aexoifciadfaDrmnmo (4 lenxf iytlp  aueo (0 2to(o3nu1apte fctls)sDtrurp;u4oeeomf3iadfs2uanmont)arenxf3io1fatrlieils) rxo(mpiudapee iei tf 2uru pot0tpxo o3ilt m rlnmpnt) etoxfcoa1la raivil(0 exoxm oo1lltnmncsat)arur( p;o4altn fciydfsDumnmon() rxoifciotom rlnvi;( s2xmir3oy1ol  livs (f 2taump;t1tpt  o3ilsla2emnvo u0aeermo3ia1fm r nvols0 2xrxr3oo1omee fci ()aDtm(r ;o1aee iiciyd a rl(mo u4tlxnmf3oo1om  an ilt)seumxopoydap nmnctltfs2rrxm ou4optn fcilsfsDran o;() leoiocoy1fpt ai ols0sruoxrpnu4opte ivs s  rrmx p;o1alxo iciat m2ul( s;t4aetnmr oo1lmtrlu i ()srtr(opnydam e fctlt)sDtrxrpot4oleo oeilt aDrl( snu4 eerio3to1oat  ivi;s0trtoim3io4amen nvta( sDurxmoou1tee mi3ildfa2ea( p u4altrircia1late u o s  2xmxrpnu1lpte ies ()a2umx pot0tptoif3iaslsDrlu pn(4 lermfctatfp  livsl(  etmim3oo1amt mietasfa2rrumpno1tpen i3tyd m2rmnmonu)tlxnifctydfmt  ueol() rxm(o3nydolt mnvsls arrr( pnt0oexniociydfm rlnvs (4tlerif oydlate nvilt0s2trxopnodamtnmfesls  Dtr(rpot1ape iieildlsDea(vp;() rermo ia1fm r ueol( trxrxrpio4ol  mivsltfs2ra(r no1tet  o3iytlmDran p;u0trxnirciatlmtrauvo;t0teumxo3nydap  lfeilt) 2rauroou1apenioeiytfs umu o;(0altrmrcoa1fat lu o;( srurimpno1ol e fesl()aDtaump;u4tlen oetad m rluvpnt4aexnxrcoytomD aieols s2xoiopiy1llenlnvi tfs2tm( pou4apen fetyd a2ulumont4tlerxr3tadfmDraues;s s2um(o iu1ol n fvs s) Dtrurpou1apeomociyslm2rm(ms;u0 rerxrcto1fmDean i t)s2uoxm nu1llee ivsa(farum( poo4oeeniocildfmDrauvsnu0 lxoxf3oydom rai i t) exo(r3iy1apee ivia(  rtr(mono0tet  f3iydla rm(vp;u4altoxo iytop  lnes;s s2umxo3iu4lptn fcils sDururo;u4apt  o3iadfaDumn p;u)arxnxf3oo1lpt li olt0 etrxo ou4altemivi s s2umu p;o1aeto fctltfa2eanvo;t0tlenmfcto1fatelivs t) rumim oo4ame liesa(  Dua( pnt0oeeo oeiasla elnvpnt)tlenmo3oatlpt  nvslt  exm(o iy4altemivslsfaDuaumono1tleoio3ild mDean p;u4tetomf3tatomDrlieilt0 exoio3nu1omtemfvtls srrmx  nt0opeomi3ilt mDrl(ms;t0trtomo oy1fateluvilt)trtrxm3iu1lme  ivt tfs2rm(mpoo0olto oeiys sDuluvs;u) rerxfcoy1oat anvo (0 2tmir nu1olenmfcilt)s2uaum nu0oetomieiysfa2elnmon(0alxoxf tadlmD  nvi;t)s2xrxrpiudop   nvslt) rua( o;u1tpx  ociysfs rlump;u) ltnmr3iydfmDeaiei;t  rumiopoy1ope mnvi t)artru pnu0aexo o3tad m2uaums;t0tltrio3iydfp  lnvilt srtrxmpiu4lle lnes s)srumxmpno0ope  ietatfmDulnmo;t) eenmo3iotom eauvsl( trxoxr oudaltnmnct t aruauro;u0tlxn feiysfmDel( p;t0 leomo3iotlmtelu s;t t2toxmpiydamt lfvil(fsrumxmpno4aetn oeild m2emnms (0 rtnio3ootfmDrau s ( s2to(mpno4al nlieia(f rtaumont4oetnmf3ild m2uau pnu0trtnxocoydfatrli o;t setoio3ou4al nlneta()aDuaxr oo4oet iieils a rmnmo u4teermr3to1fptrln sls0srto(o3ou4ll elnet (fa2umuronu0tlt iictlsfs um(mp;u0artrmr3iytfatelu s;s0 rxoxo3iu4llt  fciat)s2rr( pou4tlenifeiatls2eln p;u)arxomo oydoaD  i i;t0tetrim3nu4ameemfeilt  rur(rp;u4tlto f3ilsls2rl(msn(0trxnir oy1lm rai o t srto(mpoo1ol  livs t sDta(m ;t0tetomo3iasfaDeln p (0 exrif3iatlatelu o t0 euoxo iydlmte fei (fs2rmumpoo4optnmi3tadlaDua( pnu4tlxrmo3oatop rlueols) eum(o3iy4opte fcsasfsrumumooo0olxoifeilsla2em( snu4aexnif oydoa rlneo s srumxm3oydolee nes t  rtau pou0oltnmociadls2el(vont)tltrio3tatlp   nei (0srxm(mpoo1op n iviat) Dtr(m ;o0oex mi3tydlaDrluvp;u0arenmf3iadfptrlnvo;s0 etmimpio1op emivsat) rur(m ;u0olx  oetlt mDrlnms u) reomr3oy1fp eanvs;(0s2urimpnodaptelivsl()a2ua(rooo4ope mf3ilt mDrl(von(4texoifcia1fp raneslt) 2urxm3iy4lp   ncs ()sDrr(mo;o0alxnmo3tyt m2elnmo u) eenmo oydoat  nes (  rto(m3iu1omte ncias aDur(mpno1tee mfeilt m2emnmo;() ltoxo3iotopDeaneslt0srtmxm iu1ome mnes ( aDtaxro;t4opto o3tydfm2rmnvsnu4 rxrxocoy1fatrlueo (0 eurim3ou1lm  livt t  2tax p;u4tlenmi3tlsfa2ranmsnt) eerif oatom r uvsl( trur(r3oydomt mfcias a2tmx p;t0oexoif3iad a2emu p;t0aexrmo iadfm  ai o s0s2urio iy1ome lies sfa2rr(mo;o1tpe ifciltls ul(vp;t4texnxf todfm r ies s) 2to(r iu4optn ict (fs2rau p;u1optomf3tas s2ul( p;u)altnir3ta1fp  luvs;s0 exo(m3ou4op  mnctatfarrm(ro;u4tptomicild m2em(vp u4 exnir3oytlatelivs;s  etmim nu4apenmnvils) rrr(r nt1olxniietatlsDrln p;u)aexnmrctydoaD  ues (0 rxmxmpny4lp n nvsasf 2um( ont1aptnifeiytlmDrl(mp;(4trtrxo3iy1lmt  i o;t0 2xmxm3oy4omenlfetls)aDrr(r ;t0tlx ifctydfs eanmo;()aetrir totfmDean olt0trumxrpou4lm n fvslt  Draurp;u0apx mi3iltfs2emuvonu4teeomo3oy1oatrlivs t s2tmir iu1ol emfvta(f 2rmxro;o0oeeo icias mDumu o (0altnmo3oadoa r nvo t)setoxmpnudlp nmics () rraxmpno0aleoioeils a el(vs;(0arxnmo ty1fa   nei s setoiopny4al   fvias a2um( pno4aeeomoeiadls emu p;(4tltomr3tydla  anei;( srtoir3oydolt lieilt srrm( o;o0teeomo3iyslm2em( o t4artomr3io1lmte nei;s0 2xmimpoodal e fcta() 2rau ont1oexoio3ias m rl(mo t4teenmr io1om rlueo s0 rur(m3nu4opt lfeilsfaDrr(ronu1olenioetad m rl(ms;t4 leoir3iodom rlnvs s)seuo(o3ou4oltnliei ( a2tm(mp;t0oexnioeilt a2umuvsnu0alenxr3oo1omtrai s;()srto(mpiy1lmtemfeiat)s2trxm nu4texo iciltfa ra(msn(4tltrmr ty1lptrln il(0t2urxr3nu1oltelfvi (  rtru pot4tleomfciyt s2umu p () exrxo3totoaDrlneo;( srur(mpoudoptnlivsl(  rta(  ;u0optnmo3iydfmDeluvsnu)tltrxr3iydlatraiesl(0 rumiopou4lle mfcs (fartau  nu4tltnmiciasls2uluvo t) eeomf3iotlpDeauei;s0teumir nu1lme mivt sfsrta( pno0aeenmfciadla rl(vo ()alxnmrcoatoaD luvslt  rur(mpou1olt  ncilt) 2trxmonu0opxomi3iasfaDulu p;u)arxrxrcty1fpt lieil(0trxoxr nu4oltnmivt t sDururp;t4tlxoiictlsfm2rln pn(0trxoxo3oytom ranvsl()t2urxr3iydal   fesltf Dur(  ;o1olxomociyslm2uln pnt0trxnmrciodop   uvo (0 euoxmpoudalenlicsls)a2ua(mpot1tlxn ictydlm2rm(ms;t)trtnmf oodopDrlnei s) rxoxr3iy4altnlfet ()a2umxront1oex mietat a2rmnmo;u) lerxf tytlaDeaivsls0sexr(mpoy4lltnlnetls arrrx  ;t4aleo i3tydlm rauvo u0trxrir3tadlm   nvs;() 2toxmpnodap  lnvtat s2tm(mpno1optnmfeilt m2eln o t0alenxo ty1opte i i;()t2xoxm io4amee feta(f 2um(rp;t0aex  oetydla rln s t4altnirciytlmt  u ol(0texrxr oy1omtelfeia( arrrumpot0oetnmoeiadfa emums t) renmo3ta1fpDelieo;s)trumxr3oo4al eliei t srrmxm ;u1olxomoeiltfsDum(mo;u4arxoifcoydopDe n s (0s2umir3iu1apt  ivta(fs2tmumono0oetn f3iytlsDumu p;t0 lermrcty1oaDelu i;()trtr(r ny1optnmicsas)a2um(mo;u1alxn oetltlaDum( s t0 eeoxr tatlpD  uei;t  eum(o nodllen nesa( sDtrxront4olx mf3ildlaDumnms u) lxnmr3ia1fpDr nvsls0sexoxr nudopeelieta(fa2ua(mpno1olenmfcild mDran pnt0tltnio ty1om  lieolt s2tm(m3ou1ll e ieilt)sDtr(m no0tleo fetat a rlumsn()tetnmf3tytfm  ai ols)t2ur(m ou1amtnmnvi tf rururpnu1tptn fctlsfa rluvont) rtoxr oo1lmDelueo t0teumxrpiodll  lici s sDtmx oou0aetniociyt sDuaumpn(4trxnio oy1fm rai s t teum(m iu1lm elnvsasfsrurxmpnt0tle  octasfm el( o;()artoio oo1omDrlnvi;()texo(r no4al n ics sfa2rm( pnu1tleo octadlm ranmon(0 reoxf iodlp elu i s  rtoim3nu1apeelnvtatf rtmxmpnu0tpe if3tyd s rmuvs (0altnif3to1opDr n ols0t2uoim3io1omtemietat  rra(mont4tet  iciytfm ea( snu0tltoxr3iodfpte i i;t srum(o iy1ll nmnetl()arrrx  ;o4tpeoioeiat m rlnmsnt) exnxr3tytfm raieol() exmim oydap   fctls s2taxm nu1tpx iieildlmDelu s (0 rtoxr3oadlpDrauei t)s2toio3io4lmtnliesl( aDrrxr ;u1tpx  i3iydfa2uauvs u0treoxr3io1optrlies s t2um(r ny1lpe licil(fs2rr(  ot1texo f3ildlsDul(vo;u4 rermoctatom  lnesls) exm(m3nydapte fes t  2rrx poo4optnifciasla2eanmo;()trxoxfcoatoate n ils0 2toio iu1ole  ivsl() rta(m ou0oee mi3iat sDrlnmsnu4teenirctotoa eluvo s)tetrxopio1omeemnvsls  rua(mo;u4tpenifcias sDumuvp (4tlxoirctytfm rai ols0texmxo3oy4lm nlncs tfsrua(m ;o4tetnmfciytls emuvpn(4 rxrxr3oa1op e ivsls trtm(o oo1oleemnes s)sDtr(mp;o1olx iictltfsDrmu o (0teeoif3ty1oa   ieo;s0tetr(r nu1lmt  fcsl(  2rrumpno0aleo o3tlt m2rau snu) ltoxo3oatlm  livi s setrxm3iy4aptemneia( aDrax ont4ole iietlt a2elu o;u)tlxrmrctatfatrlnvils0srtr(m3nodomteliesa( a2ua(ront4apt  ictatlm rau s;t) lxrmo tatomDr ieils)trxoxr nydalee fcsls  Draxr ;u4alt  ociasfsDuauvs;()arxomr3iydomtrluvilt  2xmxrpio4lptnlict sfsrtrxront1tpxn i3ias s2ranvs t)artnif3tydlp elueils  exo(r iu1ape mfci t aruaurpoo0tlen icilt s uaumo;t) reoirctadopD luei;t setoio3iudapenmivsat)aDraumpnu0tpe iietydlm ran ont)treomr iodfpDr ivs;t)s2tm(r3no4lme lnvs t) Drau o;u0tee  ieiytfm2em(mo () rtrxrciydoa elivi;s) exm(o3nu1lm emivsls  Duau ooo1apxo octadfmDranvs t)arenio3ia1lpDrau s s truo(m3nu4ap emfet ( a2tr(rpot1tleoiiciatls eaump;t0 leoif3todlmD anvs t)teurio nu1openlicsl(fsDumur ou1tlxo o3iad a rl( s;t) ltnmf oatoa ranesl(0trtrir3no4lm  lietat) ruax  ou4altnmf3iytlm2uau o (0areoir3tatfm rluei s) eto(m oo1lmeelnvt t srtrxro;o1tptomieiysfmDrluvonu)aeermo oo1fm r ueils)s2xoxr ou4ll eliet (  2uau onu1oexomf3iysla2ua(msn() leoxr3ty1fmDr iei t  2urim oudam n nciat)a2tmxr ;t4tpto octasfa eaums u0 rtoir to1lm   ueslt)s2um(o io4amt livtlt  rrr(r no4alx  feiaslmDrmn o t)trtoxf3oodlat  u i;s) eto(o3nodalt mnet s)sDrr(  no4oee  feilt aDumnmo;(4aetrmo3tatlpt liei;( srtoir3iodal  mfcs ( aDraxrp;t0oex  ieildfs ua( p (4 rtomrcoy1lm  ln il()t2xmio ny1lmen nvsat) 2umurpoo1aexnmoeiydfa2rauvp;(0tetnmrctydla e uvo;s)srtoirpoudal nmfcsl(  rrrur ;o4aleoifetadfaDuauvs;() lxnxrctytfmteanvilt sexo(m nudom  lfeilt a2umxrpoo4tetnifeiltfa eau snt0tlxrmf io1fatelues;t  exrim ny1amee nvsa() Dumur nt0oexnii3ild m2el( o t4tltnxfcoa1fmt lueo s) 2xmiopoodam eliesasf Dtru  nu0oeenioeilslsDea(mon()trtnmo oo1fp e n s ( t2xrxopiu1om e fvsl() rrmu p;t0oexniieiadfa2uan p u4 lxrxf3iy1fa eaies;(0s2xoim ou4amtnlncsat) rumu  ;u0altnif3tysfa ra(vs t4tltoxr3iodfatr i o ( sexm(r oodomtnlnvsltfsrumx  nt1tpxoiicilt s2rm( s (4 reoircoatopD lnvi;()t2uo(r iydoptn fet sfsrtaum nu4tlxnmfeiys m2uan onu0alxnxf3iatfm eln i;(  rxrxr3oo4ap  miei (f rurxr nu4ape  i3taslm uauvs t4teenmo3iydopt aivi;s0sruoimpno1amtn fvsat)a2ra(rpot1olxo oeiys s2ran s;t) rxoiocto1lp rai sls0srtoir3nydaleemncias) 2rr(m nu0tee  feiadlsDelnvp;u0 lxrif iydomte uvo;s srtmxmpny1alenliei s  2tr( pnu1tee  ociasfa ea( p (0texrif tadfm r n olt0t2to(r3nodaltelfet s  2uru  ;o0olt iietyslm2elump t0 lenmr to1fpDe uvi;s)texmir3nodol emfes t aruaurp;o1tle mociadfm2eln pnu)aeerxo3todfmt  ivo;s)srxrir3nu1opt mivs tf 2raxr ;o1oexomfciyslm2umu o (0tleoxrctodoaDrluvi;s)texrxmpoy1aptemfciatfarra(mpno0ape  fcilsfa umn s u4aeeomf3oodlptran s t trtmim3ou4lltelivt ( a2uaxm ou4openmi3tyslm2rlu pnu)altoxr3ta1op   i s t0 rtrim iy4amtemfet tfa2ta(r nu1alxo f3ild aDelums u0 renxocoatlm  auvs t0tetrxo3io4lp elies (  Dra(roou0oetoioctlsfsDulnmp u4altnxrcoatop eli i;s)teuoxm3io1ale mict (fsrurumo;u1oee ifeiadlm2el(vo;(0teenmf3iytomDr ues t s2xoimpoy1am  mfeil()sDrmxmont0aptn octls sDemums (0arenmfctodfatr uvo;t)texr(rpnu1lmenlfviat arurxr ;o4apen ietys a2uaums;t0tlxrmfciy1laD aivs (0 rxo(r ny1altnlnesa( s2tax pnu4tlt  f3tydfs eanvo t)trxnmrcoydopD  uvilt  2xrimpiy4am emneilt  Drm(mpou0opto icildfaDumnms t4alxrmocia1lm rlieils truoxo oydlpte fci (f rrrumo;u0oetomieiatlm eanvo u)texoxf tatlm r i o;(0teuoxr iy4lpt lnvs t)a2ururoot4aex iociys a ra(vo;(4 leomfcty1omDranei t  eur(rpio4apen fei ()srtaxmoou0opx iiciadls ul(vp t) rtrir3ootfmDelnvo;t0 rtoim3ou1lmeelfetas)aDrm(mpno0oet mfciydfm2uan p;t4altoir3iodfatr u o t)s2trxo io4amee fviat aDuaurpot4tetn f3ils sDranmpnu0 ltrirciytfp rauvi;s srxm(o3nu4lmt  iesls arrrx pno1olx mfcildfm rmnvs;u4arenir3iadlm  lieo ()t2trim no4op   fetl(f ruru ono4aleomictat m2rlnvpn(0trermf oydla  li o t sexmxm3iy1llte fvilt) rta( p;t4oeto i3iltlaDum( ont4teenio todfaDran i t seuo(o nu1optemncs ( a2taxmpnt0tle moeiydlm2ea(mo t4tetoifcty1lp raneslt t2urxo3ou1lle lfvils arurxro;u0oee iiciltfs2umnvpnt4 rxomocoydlpt auvi ( t2umir iu1lmtn nes ()aDtm(rpno4tltn fciltfmDem( s;u4trxnmf ty1lateaivs;t0trxrim3nydlptnmfvi ( arrax p;o1tlxnmictas aDrmnvp;u)areniociadlpD an i;s texoio nu4ol elicsas  rrrxrp;o1oeeo octyd s2ua(ms (0 lenmrctodoptrauvols  eumxm3io1lmen fci tfsrraxr oo4aptniictyt s uanvo u4 lxrifcto1oate ivi s0trxoiopiu1amt  fct t)a2tr( pot1aeto ocildlmDem(mo;(0arxrxf3iatoat auvsl( t2urxm oodam e ici ()aruaxroou4opt moctat aDrmnvo t4tlerifctytfp rluvi () 2urxo iu1ll emncias) 2taxrp;u0tex  o3tadfsDranmo (4 rxnxo ia1omDr u o;(0tetoir iodlp   ivi s)aDua(m no0aptn fciytfm ea(ms;u0aeenxf3oodfpDe u o s)srtrxmpoodom n fctl(  2rauroot4oet ifetat sDelums;()texrmrciadlate uvi t trurir3io4olenlieta(f rtmx pot1aetomieiadfs emuvp t0trtrirciy1lmt aiei () rtrxopoudap n ivilt)srtaurpno1opeoifeiadlm2uluvpn(4 exnif oydlm  aneil()s2xr(mpio4op  mivt sfsDtax pou0alto o3tydlm2um(mp;()trtoifcoodfa rlneilt tetrim3oo1oltn ics s) rrrump;t4olt mo3ild sDrl(mont4 eerxf ootfpt  n s s)srum(o oy1om n ict s)sDtax  ou4tlto octldfmDrln ont4tlenxo3ta1omDelnvi;t texmim nydole lneia(farua(monu1tltnmfciytfmDemn snt4 renxr3todfpD anvo;t seum(m3no4ape lnvslt  2rrumooo1tetnii3iatfm2uauvp;t) lerif ta1fa  ln o;(0s2xmxopnydoltemivsls  Draxmp;t1oet mi3ildfm2rauvo t4altnif3ootom eauvo t0 2xrir3nudaltelfctlt)sDraxm ;t0apenmfeildlmDemnvp (4altoirctotlmDeai ils trtm(rpou4ap  lici t) Dta(m ou4oet ifeiysfs uan s;()arxoxr3iodfat aueo t)t2urxr oy4opeelncsa(fs2ururont0olx iocilt a2el(vo;u0arenif oadlatelieilt) 2urxmpiy1amt mict () 2ua( pot1tetnio3tytlaDulu p;t)teermf3oy1lmtraneo t0s2um(m oy1ame  ivtat s2rax  oo1aleomfeilslm2ra(mo;u0trtrmr ta1omtr uvils0t2xmxmpoudameelncia() Dtm(m no4tle ioeild aDrmuvs (4arxnxr ootoptr uvi;( t2tm(opoydllen ictlt arrm(  nt1alx  f3iyt m2umnms;t)arenio3tadlpDrlivi;s  rxm(opoy1lmeemieslsfarurxm no0oee  feils a rmnmpn()aetnmo3tatfat  n ilt t2xmir3io4amtnlicsat) 2uaumo;u1teto f3ild a rln onu4 lxrxf iytoptrln s;s0teto(rpoo4lptnmfvi t srrm(r no4alt if3tyt a2ean s (4tltoifcootopDranvo s0trxm(r3iy4op nmncsas  rumxr no1tpx iieiytls2eanmp;t) rerioctodopDe ueo;s) 2uoio3ou1ameelfcslt) 2rmxr ou1oeeoif3iytfs rm(vs t0 lerir3tydfm   uvolt)t2umir3oydol  mnvt ( sDtr(rpot1alt mociyt s em(msnt0 lxrxo oodoat  uvo;s)seumxm3iu4ome  neilt)s2um(mpoo1apx iietyd s eln o t0arxoifcio1fpDelueo s srum(r3oodopen fviatfsDuru  ot0aee  f3iad s2uln snu0aetnmf tydfpD ln s;()tetrxo3iu1lmtn fct s s2rr(  nu1apeomoctatla2ea( s t)trenmo3oadlmtrai slt)s2urimpoudap elncilt)s2rauroot1openioetyslaDumuvp (4tlxoio tytfatrauvil()s2xm(o oudap   fetlsfaDuaum no0olxnioctlsfaDrl( s;(4 lxrmf ty1lpDe nvs;() 2tr(rpoudal nlneil() rrax ont4olxo ictas aDeluvo u) rtrmfcty1fptraueol() 2toxmpoydope mfcsatfaruru  ou1tlt  f3iasfm2ua( p;t4aetrircootlatrliesl(0trurxo3iu1altnmivtas  Dtau p;u4alx  feiytfa rlu on() eeoio oydfpD anvo s) eur(r3ou1lltnlicils s2ta(mp;t0tpt miciatla uau onu4artrmo3oydopDrlivol(  rtmimpno4omenlfvsat  2tmuroou4opeoiociasfa emnvs;t4aetoxf3tadfaD  iei;t  2urir oo4ol nmfcsasfs2tmxmo;t0opx  o3tadlsDuanmo t4 lxnxoctotlpDrai o t0 2um(o no1apte nes (f Drm(r ;o0olenmf3tatfa eauvsn(4aetoxrcia1fm raiei;s0trtm(o iydamtemncslt srra(r ot4altnmietysfm2emums;u0 etoxo iotlmD  ueo;()s2xr(m iudlle  ivtls)arurx onu4apto f3iad m2uan o u0arxomf3to1fp rlivi;s) rtriopoydapt  icia() Drrxmpno1olxoif3iat s2um( snu4tlxrxfciodlaDelnvol(0 etoxopiodlle lncs s aDrmumo;u1tet iociysla2ra(vp;t4 rerif ootlm elivil( sexo(m3oy4apte ici tf Dur(mo;u1oltomi3tyt a ranmp u4altnir3tydomDr uvols0t2xmiopnydlpt  ieils) 2rmu pno4oetomictytlsDraump;(0trtrxfcoy1laDr u i;t) 2trio3oo4lmtnmfet (f Drrum nu4alenio3iytfsDuaump t0tlenmrcoadlmtrauvi t) rtoir3oo1lm nlicil(fs2rrx pou1tleoifciltfm2el( sn()trtnio ta1oaDeaivi;t srxoxm3oy4lmtnlnct ( arrax  ot4apxoiietat m rm( p u0trxomf oydoa  anvo;() 2xoiopnu4ap n nei t  rrmxm ;u4apx mociytls ra(msn(0aetnxf tadfmDr i slt0t2toxopiu4olenlfci s s2rax o;t4oexo i3tatlsDrl( s t) lxnxfctodfpDelivi t texo(m3iy1aleemfeils)s2rmxroou0olen ociyt mDeau pnt0aetnmr3ootlatelnvs;s trxmir iu1omtn fcil()s2um(rp;t4aptnmoctlt s uan o;u0aetomrcoydomD  n olt) exmxo iudalt  fci (fa2taxroou4aetnmoeiatfs2rlnvsnu0 lxrio3ta1lpD aies;t) euoimpnu4amt lfeilt)artrx  nu1tpeomf3iad mDranmpnu0 rtrmf iodlmDeluvi;() rxrxo3oy4al e ncils a2tru p;u0tpto ociat aDem(mo;() lenxr3ootfm r ivolt  rxoirpiu1lptemiesls) Dumurono4opxomfeiydlmDumuvs (0 leomo3oo1fpDe i o;()texr(r3iu1lmt  feias srurum nu0oee  icild s2umumont0aetrmo3to1om   n s (0teur(m3iy4llt  nciat  Dtrx  ;o0optoiociad s2ea(vsnu4teeomo iytlpD  uesls  rxrxm3nu4amtnlivtlt) Dtau  ou1opeomi3tysfm el(mo;() eenxf ty1fat anes;s trtoimpou1lpt  iei s)aDtr(rono4apx mi3iytlsDrau pn() rtoxr totfpD  ueols) eurim iodom nlfvt s s2tmum ;u1opx  oetltfm2uluvo t) lenxf totoa   i o s s2ur(o io4aleelfes ()srrm(m ou1oetoiieiaslmDumump t0tleomo iodom  lnvi s) rtmir nodll   ivs t)s2taum ;u0tex  fetls a2rln pnt0texrir3oytomteaivsls0seumxopno1ape lieil() 2trxmp;u0apx  feiltfm umnmo;(0tltomr oo1optrluvo (0s2xoim3oodolenmnvil( s2tm(r ;o0tpt ioeiysfm emumo t4tetrmf to1om  aivsls  eumio3iydlmt livsltf rrru pot4apxomi3tys m em( s;u4tlxnxf3iodlp r u o;(  rxm(opnu1aptn ncsl()a2umur nu4aeenmf3iyd a2umnvsn()teeomociotfpDr uvo t0 2tmxm3io4opt lnes (faruaxmpno4tle if3iydfm eaums u)altrircoodfatranes s0teum(opiodolenmicsa( aDtr(m ;o1tlxomocias aDua(ms;u)alxrir3io1faDrlues (  etmim no1ame mivsas) 2uaxr nu1opt mfetasfa em(von(4aexnmr3iadfpDraivi;s) rtrxopoodlle lieiltfsrum( pou0tleomi3iltlmDrlumo t0aexomf3iadlaD aues t t2xmirpny4optnmnct s  rtrumono1tltomieild m emnvs (0aleomf tadlp r ivo t0 ruoio nu4am n nviatfsDurxmpno1alx  i3ild s rmnms u0 lxnxf3oatoate u s t)s2xr(o3nodlpeelfcsat  Drmxrpoo1tlxnio3tydlm2rm( s;(4artnio3iodfatr ues () 2ur(o oo4ol  mnci ( a2umumpoo1oexoioctlt s rlumo u)trtrmfcoa1lp  aieol() 2trxo3io4al  mfcsasfartmump;o1opt mfetysfmDul(mpnu4 eeoio oy1laD aueils) rumimpoodale lfvsa(  rrr(rpno1alt  o3iyt mDeluvp () exnifcoo1lm r ueol(0truoxo oy4al nlivi s s2tmumoou1aleo i3iyd a emn pnt4arxnifciotlmDeln i;s) etrxrpnu4lptnmfvtl( s2rmurpnu1opx mfeiysfm2ranvs;(0 rtnif iatlmtelu s;(0trxoxm iudlpt lfes s s2rmxr ;u4tptniiciasfaDrmu snt4altomfctotomtrlnvs s)texm(m3iu4lpt  feil() rtmx pno4aleo ieiatfm elnmp u4trtoif oa1omtr ieils0sexmimpnodolenmivsas) Dtrxmooo1apeo fciadlaDelnmonu0trxrif3oo1la rlu o;() rtr(r nudome mfci tfs2tauroou1alx io3iltfa elnvsn(0arxnmrcoy1omDran i;s) rum(m iy4omen iviat)a2uaxm ;o4tpxniieiysla2eanvpn()artnifctadla r nvi;t  euriopoydoptn fcsls  2um( pou4tltniieilslmDuau o;t4teenxrcoy1fmt lnei t0 eur(o3oodaltelfvi sfarra(mo;t0oltn ocild s rauvs;u0aetoxfcto1faDe nvs (  2xrxm ou4al n ieta()arumx p;o1tpt iiciadla2em( ont0aeenxf oo1oa r ueo;(0tetrir oo1al e ivilt a2rmu poo4tlxo fctydfm umumpn(0 lerif3tydlptrlnvs t  2xmxm oo4lpe lnct (fs2urx  nu1aee if3tasla2uauvonu)texomfciotfpDranes s0trtm(r3iydamtnlnvi (fsrtmurono1opxo icias s2el(ms;u4 rtrxo ootfat  n o (0s2urir oy1lp elivta()arrm(roou1oltnmoeiysla2rln p u) leoxrcoy1fpt aivsl(0 rtrxrpno1ol   fciat aDtr(m ou1aexniieiltla uanvp (4 exoif ia1op elieo;s sruo(opiy1lpe  fvta()a2ra(mpou0aptnmo3iysfa2ua( ont) rtomo3ta1lm eai o;( trxmxo3ny4omeemivtat a2rmurono4oltoiicilsfa elnvs;(4alxoir io1oaDr nvo (0teuoxr oy1op nmfvt t sDtm(r oo4ale  feiltla2eau o;t4 rxoircoadomDr ueo;( s2urim3io4ap nlfesas) 2ta(m ou1tptnmfetlt a um(mp t4 rtnmr iydla   nei (  2urim3oudam nlneslsfaDumu p;u1aetnii3iytls em(ms;(0 etnmo tydlat  i i;( t2toxm iy4ol  liciatfsrrmum oo1texn i3tatfm2ranvp;u4artnio oo1fpD  n olt) exoio3oydll nlivsas) Dum( o;o1aet  feiytlmDemumo;t0 rxoxr tydlaD aueo;( t2uoxrpiydale lfvslsf rtr( p;o0opx  iciys m el( s;() lxrio totla elieo (0 2umir3iudamenmfeiatfarum(r ;u1apt  fctadfm elums t) etnxf iodlmtr nei (0s2xr(m3ny1lp nmnvt sf Drmu  ot0aexnmf3ias a rauvon()teenxf oo1om   u o;s0teuoxm oo4al   ivsat)sDuaur ou4tlxnmfciatlm2elnmpnt0 renxf iotom e uvo;t  rurimpnu4apenmfct ( arum(moot4aexnmi3ildfm2raums;u)arxnif iytfmDrliei;() rto(mpoudolenmfeils sDtruro;u0tex ii3iasfs2el(vs;u0 rtriociodlaD  ivi s) ruo(r nodameemncsls aDraumo;t4oet mi3iysfa eaumon(4trtnxr iatfa eanesls)teumxmpiy1amenlnvt s)sDtrxmoot4tet  f3tysla2emnmon(4alenmfctodomtrlivs;s)setmxr3nydome  fesls) 2rrxm nt4tptnmf3iad m2rmnmonu)aetomo iy1oate ivols)sexm(mpnudam elict (f 2ta(ronu0tpeomfciydfm elumo;u0trtrxrctodla eluvslt s2uoxr3iy4aleemies s a2rax oou4aeenmo3iad m2ul( s t4tlxrifcio1omDeanvils) etrim3iy1ol   fetlsf rrrxrp;t0apxnmfciytla ua(ms (0 etnxo oatop   uesl()s2toiopoudlp  licsa()s2uaxm no1tpxoioeiyslm ulu o u4aexomfctytopD ln il()setrio3iy4ale  fcsls aDumumpot0altnio3iys a2uluvon()tlerio oadfmtrauvi (0 rxr(r oy1opee nvtls) Drm( o;t4tlxo fciydfa ra(mp (0 etoif ty1oat auvo;s0tetmiopoo1ol  livt (fsDrru pno4aee mf3ils m2eln o;(0 etrxo tydfaD  ies t trur(opiy4lmen fvs t)s2ua(  no4oeeomfeiysfs2um(mp u) renif tadfpteanvs (0 2xo(o3iudap  miei s)arrmxr nt0oet iieiysfa2em( pn(4trxrir ta1fpDeln sl( t2um(r ny4oltelivs (  2tmum ;u1oexnif3iyslm rlums (0artnmocoydoa   ueo t)s2umxo3iu4om nlncta(farrmu p;t1alx if3tydfm2eanvs (0alxnifcoodfaD  i o;t)teurxm ny4ole  nvs t)s2uau o;u0texomiciaslmDelnms;t0artrmrcoatfat au i;t tetm(o3ou4lm elnvsatfsrraxrpnu1olxoio3iatls2uanvs;u)tltnioctodlat ln i (0texrir3oy1al  mfvta(  Dtaxmono4alxn octat m eln p () lxoif3to1om e n i t  2um(r3ny4oltn icsls)sDuaur ot4apt ifeiasfa eau s;t) eenmo3oy1fpt aues s0t2xr(rpoodap emnciatfsDta(rpot4oex mfctls aDum(vo t4teerxocoo1fp e nes;(  eum(m io4altn fcia()a2um( pot4ale mo3tas s rln s u)alxnxr totopDe ies (0 rum(r io4optemnct tf 2uaxmonu1tpeniiciat mDemuvo u)trtrxr3iodfaD aivs (0setr(rpoydale lncsa(faDtaxm ou0opxnmo3iad m2el( snt) lenirciy1oa eln o (0tetrim io1omtn ies s)srua(mo;t4tee iietldfsDelnvpn(0tlxniociytlm rai il()srxm(opio4altnmfvsas  rua( ono1tpxoiicilt sDuluvsn(4aeerif3todlat  ueils t2uoxo3oodaltn ivi () 2uaxrpnu4teenmf3ildfm2ul(vp ()tltoifcootla  lu slt  euo(o3oydap e ncs t srtmxr ;u0opx mo3iadlaDeau s;t) rxnmf to1om   n slt)s2trirpoo1lm elneilt sDraur no0tltn f3iysfa2rauvo t0aetrxr3oadoatrln o;( tetoiopiu4omtelfet t)a2truroou0tlt mi3ilt mDumn pnu4 etnmrctodfptrlneo;t  rxoxm iodlpt lnesas)srtm(monu4texo ieiyt mDranvo (0 rerif ia1op e nei;() etrimpoydamte iesl(fs2tr( p;o0tpx mfeiydls2umnvo u4areomo3oo1fa rluvs;(0srxoir3nu1lp n ieiat)s2taumono0olt iicildla em(vs ()texrmf iatlmtelivi () eumxo3nu4ap  lfeiasfsrrau  nu1alxomfcils s ul(mpnu0artrxr oydfp raivsl(0s2toir oo4ome livilt) Dta(mpoo1tpenioeildlaDrl( snu0 ltrmfcoatomtran o () etmxo3ou4ole  nvi (faDumu p;t0oexo i3ilsfa2eaumo;u4aexomo ia1oaDe neslt) 2xoirpoudllt mivt t)arua( ono1teeo f3iasfs emumpnt4alenxf totoaDranvsls0 exrio nudll   nesat sDumurpnu1ale miciydlm2umn o;()teenircta1oa  auei t)s2to(o iy1lle lnvtls s2tmxro;t4aetomoeild s2ean ont4aexomr3ty1laD lnvi;s0sexrio iudlpt mics ( sDtr(mpot1olxn fcilslm eln pn(0 lxomo3oydla e ivi s)seur(m iu1lp emnvias) 2raxr nu1oexomieilsfa2eanmsn(4tltoxr tytfaDelnvs t setr(opoydomte nvi ()a2rm(roou1teen f3iatfs2eauvo u) eerir3totoatr uvil( s2uo(rpiy1ope mies t  2tmu p;t0apxnmfciadfaDrmu s;t) rxrmo oadfp raies ()s2xr(opou1lmee ieta()a2raur ou1tpxo i3iltls2rlu ont4aexnmf3iatfmte uvo s)teto(rpiu1altemfctlt srrmuro;t4tpt io3ias s2ra(mo (4aeenxfctadomteaueilt0 2xoxr nudlltnlietls) Dtr( oot4tlt mieiydfa2ra(vp (0aetomo ia1opD aneo;( t2trio nu1apee nctls)s2trumpnt0tltoiieiydlmDumnmp;t0trtnmf oo1oaD livo ( teto(r3oydoleelivil()s2umurpou0oexn o3tyd a2eaums t0tlxnxociytfmteauvi s0trurxmpiu1al nlivtas) ruauro;u1altnmo3tad a umn s;t0altnxo ootfm raueolt)texmiopiodop nmnctlt  rtr(  nt0oex mo3iat m ea( p;u4trtrif oo1lptr u o () rtrxo3iudape lict ()a2trxr ;o1apt  octlsls2emnmp;(0artniociydfp ran s t teum(r iy1lm e netatfa2umxmpot1oltn icildfa2umnms;(4tlxomfctodlpt aueils)s2ur(m nydale lnet s arur(ront0texoiocilt aDuln p t0alenif3iy1lptrliei s)teuoim nu1lmt  iesl()a2trx oou1aet mi3iysla umnmo () ltoif oo1opDrauei;s0teuo(m ny1oltnlicsas s2tr(rp;o1tptn octas aDea( s;t0trerir oatfp ran s t0 rtmimpno4lpe lfvsl()srra( ono1teeomo3iltla uau o u)altomo3iy1faDranei () 2xrxr nu4am e nviltfaDtaxrpou1tpt iieiltfs ra(vp;(0 ltoxr3oydlat  u o;t0srur(o3io4amtemfvtltfa2urum ot0opxnmfeildfaDrm( s u)trtnif3totfmDrai o;( trto(r oo4lpte fvsatfarrr(r nt0alx  o3tydfm elnvs t0aeerxf iodlpteau s (  euoim3io4lm nlivia(fs2ra( ono4tlx mieias s eaumo;t4arxrxo oy1lpD lu ils srxoir nodaltnmnct sf Drmxrpno1olen fciad m2umnvo;u)tetoxo iytop eaivs ( s2umirpnu4lptn iviat)srtmxmp;u4aeeoio3tatfsDeauvpnu) exrmocio1fpD aiei (0 exoxo nudalt  nci t)aDtmxm oo0tlt  fciat a2elumo u) reoir iy1fa  aivsls truo(m3ou4lpe lnct t artr(rp;t4oleoioetlsfs2um(vpnu4texoio3ta1lptraivo;s)trxrim3oudape mict (f Drru  ou1aeen feiytlm ra(mo;t0 exnir iadopteaivils0trtoxm iydam elnvia(  2urx pot1opxn iciltfs2rau p (4tlxomfcootfpDeln ol()trxoxrpiu1lmenmies t aDrm(mont0opto f3ilsfm ranmp t) ltrmfcoadfpD  n i t srtm(m3oydol   nvta(f 2tmxr ou1oexomoeiytls ea(mon(0 eeomoctodopDe iesl() 2umxm3iu4am e fvta( s2tr(m ;o4ale iieilslm2um(mo;(0 rxnmocoy1op   ivs;() ruoir3no1lpeemnvslsfs2ta(m ;u4alxoiieiaslm2rl(mp;(4tlxrxo3iy1opD  i o () eurxr3iu4aptemnctas) Drm(rp;u1tpx moeiyd m2uanmpnu0aeenir oadfmDelu o t)srur(opiy1alt livsas  Dumxro;u4alen iciasla2eanvpn(0trtoxf oa1fptrln o s t2toxr3iy1amt lfvtat)srrmxm ot1aleomietysfs uaumsn(0 rxnioctydfa  lu o;( s2urim oodll nlivt sf 2uaxm ou4aetnmf3tltfa uanvs;t4artoxr3ta1fmteaieo () rxrim iy1ale mfesls) Drmu pot1aptomf3iydlmDumuvs;t0aexomfcta1lpDelnvolt t2uo(mpou4apenmnvs ()arur(mo;o1olxn o3iatfs um(msnt)trerxr3ootlp   neils)seur(rpiu1lm nmnct t s2raurpot4tlxo ociltfa ulu o;(0 lxomfciy1oa rli s;t0 exrxrpnu4llen fei tf rrrx o;o0oex mo3iadfaDua(vs u0tetrxf3ta1fmDr uvsls0trxo(m3iy1oltnmfcsas srtmumpou4tet mictadla ranvp t0 etrmfcio1lmDeau sl(  rxrir oy4ame mfvta(fsDraxm nu4alxoif3ils mDuluvo;u)tlerxocoy1lpte iei;t texmim oy4olenmnvtls  Dtaum nt0ape mfctltfm rluvsn() lxomo io1la  luei t) etoimpoo1omtelfviasf Dur(r ou0ape iiciydls ea( s;()arenxr oo1oa rlu i;s0 exmirpoy1lme livtls  rum(mo;t4tltnmietaslsDranvo;t0tetrmf oodfpDr ivi t s2xoiopiudolen icia()sDrr(m nu4aexnmi3tldfsDelumpnu) rxoio3io1lpDrauei s0s2xr(r iudop n fvslsfsruau onu0tlxnmi3tas a2rluvs (0 rtrmr iodfpD aneo s trtmio no4lptemneilt  rtruro;o0aeen o3ils s ea( ont)aetnxo todop rlieo;t0 eurio iudlm  lieia(fs2tauronu0opxnmoetatfa rauvs;t0 lxrmo oatoatr u i;s) 2xoxm3iu4lpee nvta() 2tax  ;t1apeo ietasfs2um( o u) rtoxf iotlpt  u i;() eur(rpiudalenmnvsat sDtrur no4olx moeiydlm2el(msnu)texnxo totop e n s;( s2um(r3oudomenlivtlt)srum(  nu1apenifciytla2rmuvs;() exnmf tatfmtrai i t0 rurimpiydopenmnesatfs2rmur nt1oet iietytfm ul( pnu0 etnmf3tadfpt ln s ( t2xoxr ou4omee fvtl( a2rm(rp;t4tetoiocildfa um(vont4tetrmr oy1fpD  uvi t)t2tmxr3oy4ol   netlt s2uaxrpnt0tlen ociltlmDel(mp;(4arenxf3tytfmDeauvi;s0seuoxm iodlpt  net s a2rrxmpou1aeeomo3tldfaDumnmo;u4 eerxfctodlatr neo;(  eumir3oydoltn ies ()srurx  nt4olx mfetydlsDraumsn(4alenmo to1op rai o;s t2umxrpou4lptemnvias arta(ro;t1olenmf3tltls rlnmp u)aetrmf ia1fm r n sls0s2tr(mpiydom  mfeil(f ruau oou1aexnmieildla ulnmo;t) etoio3oadlm eli sl(0 exrir3iu4amtn fvil() 2umu  ou0texniicilsls eauvo (0 lxrircoodfmDelueilt0s2xmio oydoltnlnvt tfsDtrxr ou1tpt  ociydfm ra(vp (0artrirciadlatrln ilt0teum(r3nu4ole livta(fa2rrxroou1olt  oeiydlm2rm(vo;t0teenxo oytfatr n il()teur(r oydol  lici (fa2ta(moou0aeeomicias s2rm(mp;u) eenxrcto1opDe ieslt0 2xrxr3ou1lmtelivia(f Dur(rpoo4alx  fetld a2el( o (4alxnio3oytomte uvo s)teumxmpio4amte fei ()artax p;u0opeoif3iys a rmums;()aetrifcoo1fpDelnei;( truoxo3nodalt lfesa(f Dtm(mo;o4tlenifctyt m ean s;u0teenircoodla r ies;t0 2toio io4ap elivtatfarrrxmo;t4olt  fciytfa elnmp;u0 rxoircoa1oa rlueo;s)seto(rpnu1amt  fcsl(fsrum(r nu0texo ocils aDumumo u4 eeoiocty1lpt anvsl()teurim no4optnmfetls arrrxmoou0tpt mfeiyd m ul(mo t4alxrmr3ia1lmDraiei ()s2uo(mpiodape lictlt  ruau ont1opto i3iat m2emu s;t0 eeoxrciadfm rli slt0 2tr(opiy1ap emnetlt  2raur ou4oex mieiaslaDrl( o u)aeenxo to1om ean slt)s2um(o iy1op elneiasfsDtmump;u1aetoiicildls rlu pn(4artrmocty1lm  aues;t)texr(r3no1op nlfci t sDuaxr ;t1opt iieildfsDeauvs t4trxrxr iy1omD  nvo;t) 2umirpou4al  lfct ( arurur oo0optn fciad m2ra( snu0texrmr oodfpDraieo s)tetoxopoy1lle  fcs tfa2rrx  ;o0teto ietasfaDum(vo u4 etoxr iadlatrln s s)trto(m3io4am   fcsas a2umum no1tpe iieiysfa2ulnvp;u) rxnio iatlmt lues;() eurxo3iudolenlncs t  rrmxr no0aetnmieildlm eanvsn()tltnxo oatfmD liei;s  etmxr nu1lm  mfesl(fs2ta(r ot4oex moctat a2ua(vsn()tlenirctydlaD  i i s truo(o3ou4op  lnctlsfaDrmxr nt4opt moeiysfmDra(von(4tetnxf3tytomt  ivi;t teurir oy1lmeelivias) Dtm(mpou0tetomfcilsfm2emn o t4tlxnir3oa1fpDe nvo t0texr(opio1amt mnvt t)arta(rooo1aexnmi3iatlsDua( snu0 exrxr3oy1fpDe uvilt teto(r3iodamenlfesa(  Duaumpno0alt moetys a umu snt4aeenxrctodfp r nei t)t2to(m3iudlm nmnes t)a2tmxmp;t4tet mictadfa emuvonu4 lermf iatfpteauei;t0 etoxo3oy1apenlics (f Drm(  no1tptomi3tytla2umnmsnu0trerxo3tydfmDe uvils  2trimpou1alen ies t)s2ua(mpot4aex mfctatla2um( pnt)tleoxo oydfpte neo s)s2xoiopoodlp nmfctat)a2uaxm no1oleo o3tadlm rl(mpnu)alerir3iytlpD  nvsls t2xoirpiy1lpen ivs (fa2rax o;t1ole iietlsfsDel(vp t0 eermr tatlm   ues;s0setmxo3nodlmtelfes ()aDraurp;t1aeeo icilsfaDra( sn()teerxr oadfptrau ils)t2toirpoo1ol  lfeil( arrm(  ou0apenmf3ilsfmDea( o t4aeenxr iadfm  lu o;s0t2umxm ny4llen fcsas)artau ont4tlenmieias aDra(ms;t4 eenxfcoy1opDeli ols tetmxm nudolen fct ()a2rru  nt4ole  ietas a2uanmont4tlxrmf iy1la   i i s s2xrxm3iu1ll e ietl()a2rmu  ou1altn i3iltlm2elu s (4tlerxf io1lp  luei (0s2xm(o3nu4lleelieias srta(monu4tle moetadla2uanmo;()aexoxo3ta1la r uei s setm(r3oo1olt  ivs t arrmxronu1apeo i3iydla2ulumsnu)artrmfcoydomteai o (0t2xm(o iodllt lfciltfartmumpou1oet  f3iydlsDumnmp t4texoir todopDe uei;() rxoxm nodam nmict t srtr(m ;t4alto oeiaslaDemn onu4 rerxr3oadomt  neils)t2xrxrpoo1op emici s arrr(m ;o0aee iocilsls2el(mo (4treoxr3ootlmtr ieil( trtmxr iu4optnliet sfs2umuro;t1ale moetytlmDuluvp;u)trxoxf todlp   uvs;s truoiopio4omen iesat)s2tauront0olenifciysla2rauvo ()alxrmf tadfp r uesls sexmiopou1altn ict (fa2trxmp;u1aptniieildfa2eluvonu4trxnio3iydfmD li ols setmim iy1amte ivia(fs2ua( ont4opt ii3ilt s2eau s;t4trxnxr3iodfp   ivi s0 rto(r oydop nlfet s)a2rmx o;u0tle  i3iasfaDemnvs t) ltnmrcoo1fa  li s;(  exrim3ny4ame mfes tfa2rrxm ou1teenmf3iltfs2rau o;()areoxfcto1op eaiei s0t2xmir iy1lm  lfetat)srurxr ;t4tltomi3tydla ua(msnu) leoxf3iy1lmtrlivs t0trxr(opnu4lp   ncta( s2raxront4aptnioetyslsDea(vo;t4 rxoif iydlpDrauvi;s)sruoxopno4amee iet (f 2uaxro;t1alen ociydfm2el(vs ()arenmocoodfmD li i;t) euoxo3iudam   ictls) 2ur(mo;t0tetoio3tls s rln s t0 exoxfciodfa eanes;( texm(mpny1lpe mfvils a2tmxro;t1aetoioeiad s2eanmpn(4 eeomf3oadoat  neils)seum(opny1lp nmici tfsDrrurp;u1teen feiat m uauvsn(4areoxoctytfmDrlueilt  etrim nydllee nvtat  Dtaxrono1ole mi3ildlaDrm(vp (4alxomfcoodfpDeauvols) 2ur(m nu4olen ivsa(fsruru onu1aee mi3tld aDrau ont0texnxrcoatop rlieolt)t2tm(r ny4opt mfesat) rtrxmpnu0alx  oetyslm2umnmont4trxrmr ia1lmtr nes t)teur(mpoy1olt  fvias a2tr(ro;t0ope moctytfa2rlump;u)texnio3todlp eaiei;s0 2xrir3no4amtelietlt aDurur ;u1aleomo3iltls2eluvp;t)texoxf3oytfm e uvil(0t2urxo3iu4altnmicsl()s2rrxmoot1olx moeiaslmDumu o u0 rerxrcta1lm r uvol(  ruo(m3io4omte icta(faDtmurpno4opxn feiaslm2rau p;u0arenifctydlmt li ol(0 rtmxm3iy1altn ieslsf rrr(mpoo4tle  f3ilsfaDeau s;()arxoir oy1lpt lnei;s0 2tr(r no1omee ietatfsrua(m ;u0ale mfeiyd s2el(msnt4texoxr3tydlaD auvi;t0texm(rpnydomtn ivi t) 2rmum ;u4teto fctydls eaumpnu)altoxr ootoaD  ueo;()s2tr(r3oudopenlfvtatf rtmxront4teenmoeiysfm2ea( s;() rtoxrctodlatr ivi (0srxm(mpoudam nmncia(f 2uaump;o1aptomoctls a rl(mo (4 rxomfcio1lp   nvils) 2urxmpio4lm  lfeiltfsrurumooo0alxoifeiadfaDuau p u) etoxo3tatlpDraies t)texmxm oydlptemfvsltfaDtr( ont4aleomocias sDuaumon()tltoir3ia1lp elnvilt texrir no1lpeemnetls aDuaxmpnt1ole  ieiydfs2ulu ont0 rxnxf3oy1fptrai o;(0sexm(o iu1olt mnvtlsf ruaxmp;t4tpt mf3iad m2uau pn(4 lermf3oadomDrlnesl(  2toxmpio1omtn fvtltfsDumx p;t4olx  oeiydfaDel(monu)alxomo3tadfpDran i (0texm(r3nu1amt  ivi (f 2rax o;o1tpeoifeiytlmDelumo;u)arenmo3iytla  auvs;t  eum(rpou4alte nvs s s2uaur ;o0tpt ifeildla2elnmo u) rerxfctytfpDe nvs;(  2xo(m3iy1lpt  nvtl(fa2tmx  ot0alx iictltfm eln s;t4 reoiocio1lmD lu s t) exmxm oo1amt lfct ()a2rr( o;o1aexn o3iyt sDeluvs;t)trxoif3iatfmDeanvil()tetmiopoy1lm  lnct (fsDurxmpou0tptn icildfaDem(vs ()aexnir to1lp r u i;() etm(o oodopenlneil( sDuaur no0aeen f3taslaDrmn o t0tlxoir tydomt  uvi t  2xm(m nodamt  nctatfaDta(r oo0aeeoiieiytls2umu onu)texoxrciodlp rlneils)t2ur(m3nu4oltemnvs t)aDtrx o;u4tetomf3iatlaDrln p t) etrif3oy1opDeanvs;( s2umio3ou4ll nmivs ()a2tm(  ;o1aetnii3iatfa2eauvs t4 exnxr3iadfm   u s (0trxoxm3oudoptelfeiat) Dumump;t1alxnmi3iaslsDum(vo;u0arxomocta1la rlueolt  euoiopnudlmtnmivia(fartax  ot1openiictyt s rln s t0artrmo tadoa elivs;t)setr(m3no4apenmfviasfsrta(rpoo4tptnio3tat aDea(vonu0artrif3oytlp ran o ()srurxm3iy1lp e ivs ()artrx  ot1oetnioeilslm2ulnmp t) exomr totfa rln s t sruoxr3oo1aptnlfes s)artrx  oo1oexnmo3iyslsDumn snu0tlxnxrcio1la ean s t0t2xrio3iudolteliviasf 2raxr oo4apeomoetyt m2ra(vp;t0trtomf todfpD  iei;(  rtm(r io4am   ictlt  2tmu pnt0tltnifctys s2ea(ms;u0 rxnmo iodlateln s s0sexmxmpiy1apte ncslt  rtr( pnt0tee moeildfs2emuvo;(4teeoif io1latrai s t  2xoxrpio4am emnvs s srrr(  ;o4apeoiictysfsDua(mpnt4 renir iatla rauvo (0s2xoxopno1lmt mivtl()artr(rpnu0apx  ictys aDel(ms;(0alxrmr3iatfatr i ol(  rto(opnydlm elivi t s2tr(roou4optnii3iysfm2ua(vs (0trtnxf3tytlmtr u ils0texrxr3iy1omt mfvi t)s2tr(mo;o4tltoiiciytla ua(vp;() leoir3oydla r uvs;t) rtrxm3oo4lpt lieias aDtrx pnt1aetnif3tys a uauvs;(4 eerif3oy1op r uvi;t) exmir oy1amtnlieil() rta(monu0aetomictyslsDrln sn()alenxrcty1faD  n s;(  exoimpiodlp elnct tf 2urx pnt1texo i3iyd a eaumo u4arenxr3iodlm eaueo s  rum(mpoy4aptn nctat srumxm ;u1tpenmf3tls a2ulumpn(4altrif3oytfmtr nes s)trtoim3oodlptelneslsf Dtmxmp;t1alxoifctlsfa2rmnvon(0tlxrmocoa1omteanvolt  2tmiopio4ol nlnei t sDua( poo1tlxn f3iydfs rluvo u4 eeomo iytlpDrluesls0t2umxr iy4ale  ncsat)a2ra(  ot0altnmfciyd s2el( s u4artrmr3tatla eanei t0 rumir no4altelivtls artmur nu1altoio3iydfaDrluvpnt) ltrir3iydfpD au s t s2umimpny1altemnet () 2trx p;t0alxoif3ilt sDem(msn(0aetoxrcoo1oa elneslt  2trimpiy4op  lfcs t a2rm(m nt0open octytfmDea(mo;(4 ltnmf tadomDrli i;s t2xrir3oodop  mieias) Dururono0tpeoiieiadlm2eaumont4 exoiocoa1lpteanes s0trtr(o3nydopt mies ()srraxmo;o1alen f3iatfm2rlnvo t0aexoxo3tadfpteluvs;(0 exoim3ny1ale  fvtl() 2ta(ro;u4olxomieildfm2ua(vs;u0trtoif ty1laD an sls0texoir ou1openlfctlsfsDrau p;t4alt mocildfs emu p t4teerif3tydlp elues;() 2to(m3no1omtnmivi (  rtr(ro;t4tptniiciasfm2emn on() lenif3oo1oa e i i t t2xmimpnu1apt micil(faDur(root1tpe  ietyt s ean sn()altriocoa1lpt lneils t2tr(r3oy4lmtelfvil( aDtmu poo4tpx  ietadfs2ea( ont4altrxrcio1lpD luvs;s) 2umxo3ny4lpen nvi tfs2umum no4tetnifctydlmDum(vsn()tlxrmr iydlmDrln i s)tetrxmpoy1om elicsas) 2ta(rpoo0alxoio3tas sDuauvs;u4tetrifctotlm eaivi (0seuo(o3nu1ome lncta( a2tmxrooo4tpt mfeiad m eanms t0altrmf3iydoa rau o;( tetr(opno1lmen feiasfsrta( p;u0oexo i3tyt m2umn sn()trtnmfciatomDraies t t2toxrpiu1apt liciat) rumx ont4optomf3tas a ul(ms;t4tetnmfctytlm eli o t)tetr(rpnu1ll nmfeia(  ruaumpot1altnmi3tlsfm ulnmo t4trtrxf3tatlmt  i s ( t2uo(m ny4ll  lnvsa(  2uaxr no4oleomoeildfa umuvs t4treoio totfptr nei (  eurxo3nodlpen ncia( srum(  no4tpe ioctaslm ua(vs;(0 ltomo iotomtr i ils0teumirpiu4lmtemnes s  Dtaxro;u1teen i3ilt mDum( p t)trtnif oodlm  au olt0t2urxo no1lpenmies ()a2rau o;u1aetnii3tatlmDumn o t)tlxoxo oadop  lieslt t2tmimpny4ape lncsl(  rum(  ot4opt io3taslm2el( s t4 rtriociotfaDe u o;s)srxrxrpiodapeemnetas)artmx o;u4oexomfetatls2ran s;(0arermo todlpDr ieols) 2xmim io1lmte fei tfaDtmx ont1tlx iieiyslaDrmn s t0tleoirciadomtelueo s)t2xrxr nodomtnmicsat)srua(rono1aet  feiysla2el(vo (4texomr3oadom raneo;s)s2toxrpoy4om   ivs s)srtru  nt4alxomicildla2rl( pnu0arxoifcia1omDeaieo;s0 ruo(m3iodlpe miesat  2tmu onu0tpeo octltfm2elnmo t4 lxrmr3oadlmDrln sl(0 2xrir io4llt  iet s sDrm( oou1tpeomoeiytla em(vsn(0 lenifctydfmt aies;t)trumxo iy4aleelfeias)sDuau p;u4oet  i3ils a2ranvo u4 lxoif oydfmtr ivi;(  exm(mpoudlpt livsa( srrmurpno4oeen fetlt m ra(vs (4aleoif3ty1lm  li ol()t2tm(r3nodop nlfvtatfs2rrx ont1oexomfeiatla eluvont0 rxrif oatlmDr nvs;() rxr(m3iy1ll emivt () 2rm(m nt0oet mi3iys aDulnvp t0teermrctydopDrluvo s0seum(m3no1alenmnciatfsDrru  ou0tlx ifeild sDranmo t0teenmociy1fpt aiei;s) rur(r3iudll eliciatf Dtr( onu1tpxnmoeiasfsDua(ms;(4tetomr3iytfp rlnes;t) 2tr(mpou4apte fcilsfsDrrxm oo4olxnii3tad m2ul(ms u4arerxocoodfpDelu o;s s2ur(o nu1llt mfei tfs2tr(m ;t1tptnmo3tas m2el( ont0tetnxfcio1fmD  u ols0setriopio4ol e ivsa()sDtaxmooo0tle ifeiytlaDrmnvon(4 rtnmr tadla eaneo;( tetm(r oy4om   ivia()a2umu pno1tleniieilt s2ul(vsnu4tlxrmf3iadomD  i sls  exm(mpno1olt lnvi s)sDtru  ot1ope mfciydfa2eluvont4teenircoytop  an slt) 2umxmpno1aptnmict ()a2taurpno0tlx iieias sDrau ont)aexoxf3iy1lpt aueils)texoxo nudlp elnetl() 2uax o;u1apx mocilsfs uaumo;()altoir3oa1fpDeai ilt texmio iu4ape lnvsls arrmxro;u1opxnmoctasfs ean sn(4aetomo3oa1faD luvsls)s2urxopoy4lpt lnctltfaDrau  ;o0oexnmietadlaDulnmont4tetnxf tadla r u sl(0sexoxo io1llen neiatf 2uaur no0opeo ociatfs2ulu o;u4 lenmocootfpD aueo;(0 rur(rpno1lpenlicia()s2rmu  no1oeto oeiltfaDel( o u0tetrxoctatfm   n slt0s2urxr3iy4alteliesa(fa2trx onu1opt mictlsfsDul(ms t) etnxo iadoaDr nvo (0tetrxrpiodop   fcsasfsrrmxr ot4apt  i3ildlaDem(vp u) lxnxo tadfp raieolt0sexmxm3iu4amenlfctltfs2rr( o;o4aex mo3tadfa emu onu) rermocoa1fm r n o;s) exo(m3iu1apee fetls sDumurpno4tpx ifcildfm rmn s u4 exomr to1oat livs;s0setmio oy4alt lncil() Drrx ono0tpt  fctltfa2eauvpn(4texnir3oo1faDeanei;s)setrirpiy4lmeemicsas)s2rau pot4openifciltfm em(mo (0teerio3totoate uei;( s2xmxm3no4ol e fesas  Dtm(m ;o1altomoctaslm2elnms;(4texnxf totlm rauvi s) rxmirpou4open nci t srum( pnu0ale  octysfs ra(mp;u)tlenir3io1fmt auvs;s) ruoim iy4ap   nci sf 2rm(mp;t1alx io3tysfmDrau p (0trtrif oadla   nes s) eumio oodapte netltfs2rrumpno0olxomiciydla2uanvo;t)arenxo iadomDeauvilt)srxm(r iy1ome 
\ No newline at end of file
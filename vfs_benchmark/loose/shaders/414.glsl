@@ -0,0 +1 @@
+neilt  rxrxo3ny4lpe miet (f rur(  nu4oleomfeild m uanvp;u4tltomo ta1omtelnvs;()s2ur(r3ou4alen fetas)srtaum nt4oeeoifctas sDrlump;t) etriocootopteanei;( trtrir3nydape lfetl() rrm( onu0ale if3iydfs2emuvpnu0aeeoir3oo1oaDraneo () 2urxopoy4ll nlicslt)a2ur(r ;u1texnmo3iadlm uaump u4aetoxr3oodfpteaieo;()seuoxm nu1om elfvilt)a2tau  ;t1oex mf3tld a2ranmsnt0 lenif iatoa  liei t)truoiopno1lltn nct sf 2tmx pnu1texomfeiysfs2umn pnu4texrifcoodopDelnvs;t)srtm(o ny4ope mfvtl(  rrrxmpou4oeen f3tlt sDelu pnt4 lxnmrctytoaDelivilt sruoirpno4ap e fetls  rumxrooo1opeo feiltfs ran snu4teerxf oy1lmtr ieil()t2toir3iu1aleelieta() 2tau  oo4alx mictatla2ra(vp;(4 ltrif3iadlatrlivo;s t2xr(r3oodam  lncils sDtr( ont1oee mfeias m2eln p t4 lermf totlmt lnvi t)truoim io4lm  mnvsls sDrmum nu0tlt  oeildfsDemu s (0altrxr3tadfpD  nei s0setoxrpou1ol  mfcil()arumxr no1apto icildfmDumuvo t) lxrxf3oadom rai sl()tetr(r3no4omtemncs t  2um(r ;o1oltn f3iaslmDrl( p u)trenmf tadfmD lueo s) exoim oy1lm  miviasfsDraump;o4ale ioctyd s ulums t)tetnxr3ootoate u i;() eumio oy1llee ncsat sDtmxm ;t1oleoif3iltfa2elnvs;u4tltnir io1lp eln slt)s2umim3oy4lme lnesltfa2urxr ot1teeomfciatls2rlnvs (0alerxoctodoa ran s;t0trurxo3oodllt livi (fa2rmxmo;o4tpx iietyt m2uau s;() eerif3tatoatr ivs ()t2tm(rpou4lm   ivia() 2tru o;t0tet ioetysla rmnmont)teerxocoodlpD liei s) rtr(r oodom  lnvia( aDum( onu4olenif3iytfmDrlumo;u0 etrxf ootomt lnvo t s2urxm oydomt miesa(f rtmxr nt1aleoioetldlsDumn p;(4tetomfctodfat au i;s texoxm3oo4lp emnviatf rta( onu4tleniicilt s2em( ont0aetnmr tydlptelies t  exo(m3oydlpt mivtltfsrumumpnu4aeto f3ias sDumu p u) ltnxr3ty1fat lu o;t0texmxmpoy4llte fci ( srraur ;u4optn fctydlm rluvp;(4tlxoxr3todomD aieo;(0sexoiopou1op e ncil( sDtau pnu1tlenifctltlaDrl(mon()trtnmr3iadlaDrau ols t2ur(r ny1lp eliesasf Dtm(rp;u4tlt  feiatfsDel( s (0 reomo3ootfa r uvols)trxmir iy4lm elfvt () rraxrpoo4aee  oetytfa2umuvonu0aexomf ty1fmD  ueo;t t2to(rpiydameelfei s) 2rm(mo;o1olx mfeilslmDumnmp;() etoxf3tydlpD  neslt0trxr(o no4oltelfetas s2umumpnu0oetn oetatfs um(mpnu)texoxf3iodfmDrli ilt)sexm(o3nydoptnmncs tfs2umum nu4tlxnmoeilt m2umn p;t4trtomr todoa r ivs;s truo(m3iy4amt  fcsa()s2raump;t4alx mf3iad s2emuvo t)aetrxociadfate n o;t setmim nudap emict s) rraump;o0altn ieiydlsDumu snt0 ltnmf oatfaDe nvsls0 etrim oo4aleemivt (fsDrrxm nu4aleoio3tltfaDeanmo;u)trxoircio1la  ai sl(0 eurxopio4am nmnvi ()a2tmx oot1aetoiiciad m umu onu0aetrio3oa1opDrlies s0trtrxopoy4lpe  feiat  Drrxm ou4tlx  fctysfs2ulnvo u4tltoir iodla rluvol(0s2urxm nudoltelfetas)artr(ro;u4ape if3iyt a2ul(mp t0 leomrcto1lpte n i (0teumxr oodap n nctatfaDrm(r nt0oexo ociatfm2rmnvo;t)tlenxf3ia1fate nvi s) rxrxm oudlptemfviltfsDtrxr ot4altn ociyd m emu ont4teerxr3iadlmD auvo;t0s2xm(m3oydolenlfeil(fartaumo;t4opt  i3tatfmDrmn s;t)tltoirciy1opt luvils)s2tr(o ny1oltelietlsf ruauro;t4oeenmfeilsls2eauvs;t)tltrxo3oodfaDrliei;t0 ruoimpiy4lmeemnei ( sDtmu p;o4openiociadfa2ulnvs t) rxrxfciydopDe nvs;s)trur(r io4aptn fvt ( srrrx  ot4aetoioeiltls raump (0alxrir3tytopD lnvo;s0 2tm(o nu1al  livtltfs2rru  oo4apt ioctadls2rmnvs (4trxnxfcto1faD livols s2toimpny1lltelfvsls sDur(root1tltnif3iadfa2eluvo;t0trxnxr tytlaDeaues s  rur(m3ny4om elfvs t aDrm( p;u0teenmf3tld s2uaumon() rtoxo iadfp elnvs ( teuo(rpiodlle miesls a2tax  ot4oeeoii3iatfmDrluvs;t)areoxociydoaDeau ilt0s2toir3nydlpe mfvil(fsruau  ;t1oex mi3iytlm eaumo ()aetnir todoaDran il(0 rxmir nudlmt mncsasfsDurxr ;o0tptnioeiatls emnmo;t0tltrifcio1lpDelues;t) etr(rpnydllteliciltfartrum nu1texnmieiydlsDrluvpnu)trtnmocta1late neslt)teum(o3iy4openlnvtl( artm( ono4apxo f3iadlsDeln onu0arerxo3oydlaDeaues;s) rtmio3oy4lmen fcsltfsrta(ronu4oex moctysfa2rl(ms;(0 etnxf3oytfmDe n i;t trto(o3io4apeelncta(  2ta(rp;t0aex ioeiltfaDuau p u0 rerir3oatopDraieil() eum(r oo1lpt lfvtatfarua(  nt4ale ioctldlm2umnvs;u)trxnio3io1fpD aneols seurxm3oy1opee nvsa() Dtrurpnt1tleomfetadls ua( snu0 etoxrcoy1fp r n slt)t2xrxrpou4ll   iesltfa2rruront1aee  i3tasfm eaumpnt4trxoxf3oa1opDeaieslt0srtmiopny4optnmneta( a2uax p;t0apx mi3ild s emnmpn() rtrif iydfm  an o;s0sexriopoy4lle  feia() Dtrumoot0oleoif3tas a2ean s ()teeoif3tadlm rli olt)truoim oudop  lfvia( arur(r ;t1tltn i3iat aDea(mont4aetriocoodomD ln s ( t2xoio ou1aptnmieia(farrr( p;u0aetnmoeias aDulnms;t) etniocoy1oateai i;(0 etrxr iu1apeemivia()arumx  ;u0aeto iciasfa2raumsn(0 lxnxrctydlmtraiei;s0 2uoxm iy4olee neiat aDuax  nt1aee ifcildls emn p u0 etrmo iadop  ln s;(0tetr(mpoo1op  lfesl()sDrau p;u0oltnmf3tadfa2rmumsn(4arerir3iytlmD lueil(  2xmir3oydope  fcta(f 2uaur ;u1optoii3iyt m emnvpnu)altrxf3tadfmDrli s t0texoio oo1om e neia(fs2rmumont0tpxo ietldfm2em(vp u)tlxrircoadfpteai s t tetrxmpiodomt  ieilsfartaum ;u4tlxoioeiasls um( o;(4artnir ty1lpt  n o t)s2xoim3nodomtnmfci s) 2rr(r oo4ope mfeiltfa2eln snu0aeeoxr ty1lptrlues;( teumxm nodlmtemivtl()srra( ooo1apeo ociydfm uanvo;u)arxrmo oatfa e n i;(0 etmxrpiodomtemneilt sruru p;o4optnii3tlt a eaump u0artoxf iadfptrlieolt setmiopno4lmt  fvi s)srtru  oo0oee mf3iydlmDranvo u) renmocta1faDeaieol( s2xmir3nodlp nmfesa() 2truront0tlto o3tytla2ulump;u4artomrcoydlmDe uvols) ruoxr3no4lme mfvi sfsrrm(r ;o4oet  feiytfs um(vo t)alxrirciodla e u o;( t2ur(m3nodll  miciltf ruaxmpoo4tleo o3iyd s ra(mp t)altrmr iadop rlues;t)texoxmpiu4altelncia(f Draxmono1apxnif3tltls uau p;u4 etoiocto1opt  n s t0seur(m nudom  lfvtat)aDta(rpoo0teen oeiydfs2eaumo;(0 reoxr oatlpDeau olt  eumxr iu4am  liesltfsDraxm ot0oet mfetlt s2umnmp t)tltomrcta1omDranes;t  2xm(o nu1ap elnesls)arur(  ;o0apx  oeiltfs2um(vp t)texriocia1fa rlnei s)trxrxm3iy4altn fesasfsDtr(mo;o4aex  i3iyd s2rm( s;t4arerxo ia1fpDr uvi t0srtmio3iy4om nmfvias s2rmx  no0aexomoeiadfaDrmuvpnu)trtnxfciatopDelueslt)s2xm(m3ou4open fvi t)srur(  ou0opt iieiysfmDemnvpnu0 rtnmf iodlmteli i t trxmxr3iy4lmt livsat)a2umum ;o0aeenif3iatfa2rln o t)arenifcoytfmtrli i;s  rxoxo3oudlmee ieiasfaDtmu pno4apxnioctasls rmn onu4tlxrmf oa1oa  lu s (0 rurirpiy1ope  nvt ()aDrax  nu0apxn o3ildlm2ua(vs t4trxnxr3tatop  ln il(0sexrirpoo1lmtnmfvta(farta( pno0tleoiietasfm ua(vont0teeomf3oydoa e i olt) exmxrpny4ll elics (  Dta(moou4tpt  octyd a eluvp;t4 eenmrcoa1oaDe ivilt)setmir3oo1op n ivsl( arumxmp;o0oexoio3iytla2ua(vs t)artnmo3iytomDean slt0tetmxm no4ll emfcsl( a2tmumo;t4apenmieiyslaDelu o;(4 rtniociadfmtraneo s teuo(mpnydlpe lnes tfaruax ont1tltnmfeilsfmDrmnvonu)tltrmr3tydlmtrlivo t)seuoir3nodlp elieiat  2tr(roou4tpxnmfciytfsDuln o;t)teeomr tadomDelu sls0 2tr(m iy4op n ietlt) Dtmxrp;t0oetomoetytfmDrm(vo;u0artrif3oa1optr nvil(0trtm(opnu4ol   iviatfs2tax  oo0tpenioetydla2eaumon(0 ltomf3todoa eanvo s  exrxrpio4lltemfcsasfarurxmono1olx miciad a2rm( o;u)tlxnmocoytfp eai o ( sexm(r iy4om   nvilt srtru pou0oeeniieiytlmDran s;t0artoxf tadlp eaieol() 2uoir3nodlpt mnes t)arrm(root1oex ii3iasla2umuvs ()arxoioctydomteluvo;s sexrimpoo1llen ivtl() 2ua(m ;u1tex  ietasfa2emn s (0treoxo oo1op ranvs t0 2xrxo oy4amtemfet s)a2umxront0ape iociytfsDrl(monu0teeoir ia1omDeln o;t) rxrxm3ou1lmee feil(f rurur nu4aetomf3iydlmDumnvs;u) exrmr iodlpD li o;s sexrxm iy4al nmfvslt)a2raur ;o4tlenio3tldfa umuvs t0 ltriocoa1fmDr ivo (0s2xr(o oodlm  lfvils)aDraumpnu1tpt ioetlsfa2emnvs u4trxnmfcoydlm eliei s)trxrxr ou4ap   ieslsf rtmx o;u1apxo i3iadlaDemnvsnt0areoxfcoa1lm eau i t0trxmxm nu4ap nlfvils)s2um( pno1aeen ieiyslmDran s;(0aeenmf3totfpt anvols)trxo(r iudom emnvtasfsDrr(mpou1tpt mf3tltfmDem(mpn(4tlxrmo todoa ean s (0tetm(r3iy4am  lfeils)aDumxront4oeto octltlm2em(vont)aeermf3oadopDrli i;s  rxrimpiudlleeliet s) Dta(m ;u1aeenmoeiad s um(mp ()aexoir to1fmtelivol()srxrxr3oudamenlivil( artmxro;u0alxomfctld aDum(vp t) lxnir3oa1fmt  u o (  2uo(m3oy4altn nvs t  Dtr(rpot1aleo icilsfaDumnvsnu)aetrmf3tadom  auei;(0trxo(r3iy4ale  nvtasf 2ta(r ot4tex  iciydlmDumu p () exnio iytlp e n i;t) 2xo(rpiudal nlnciatfs2uax o;o0olxomf3ilt aDua(msnt4aeeoif3tadlp  lnei;( trxoimpou1altemiesa(f rrmxmpot1optnmoctltlsDrm(mpn(0 rxrirctytoa eanvi ( srum(r3nudlpeemnctasfsDrru  ;t0apenmi3tydfs2eln s u4 rtoxo3iodfpt auvilt) rtmxr3ny1am elnvi t) ruax  ou0ope mfctltfaDua( p t)aeeoxr3iodfmDr i o;s  rxoxr3oydapee fcs ()arrrur nu0tltomoeiysfs2ul(von()altrxr3ta1faDeai slt t2xrxmpnodapen ivs sf rta(mpou0altn octldfaDrln p ()altnmfciy1lm   n s;(0srtrxm no4olt lncsl()s2taxm ;t0teeomf3iadfm2ea( s;(4tlenxo3ia1om e nvs t  2xmimpiy4lptemnvsa() Draump;t0teeoiociat s uln pnu0trtnmrcta1fatr nei (0teum(m3ou1ole mict tfarua( p;o1opx mfctls m2rlnmsnt)tltoxo tytopteanvol( srtmxm3nu4ll nlivtls aDtmu  no1aeenmf3iytfs umuvont4arenxfctydoaDrlneils texoir3nu4omen ncslt artmxr ;t4aptnmf3tysfm uaums u4tleoxf3todlpD au i;(0tetoimpoydalt miei t)a2tmxmp;o1tpto ociltfa ran p;(0aexrif iadlmtrau s;s0trtmimpny1ap   neilt  rrrumont0olx mictyt sDumnmont)tltnxr oo1om  au i ( trurirpnodlp   fetlsf 2tr(m ;t1olx iiciydlmDuaums;() rerio tydfa r ueil()srxmimpiu1llt  ict ( aDrm(m nt1tlxomociatls elu pn(0texrxo3iotla rluei;s)srxmir3nu4lp emfciat aDtax oou0optnmfeiltla2ulu s t0trtnio3oo1oate uvs s  etoxopoudlpee fes t)a2taxm ;t4optn fciatlm2uauvonu)tleomfcoatfpDe nvi;( setmir no1ale  fes s  Dur(ront1tex if3tldfmDulnvsnt4 rtrmf3iydfptr ueo s0t2um(r iodap eliet tf Draumo;t0olxo ocias mDua(mp;() renmo iotla   u o s s2umxr3iydapt lfviasfa2ra(mo;u4alx  ocilslsDeln snt) rerxoctytfpte n o t s2toim iudlp e nvilt  2uau oot0apxn i3iydfaDuanvp u4alxnirciydlpD lneil( s2tr(m3nodom nlivia( artr(mooo1oeto iciyslm ul( s (4 exnio io1lm r neils0 2xrxmpiudale mivta()arrm(rp;u0aleo f3iadlsDumnmp u0 eeniocootoaD aueils0 ruo(r ny1ll  lict sfs2umxr ;o1aet iiciatls ulu sn(0teeomrciatoateaieil(  2uo(o oudlle mfvsat s2rrum no1oee mi3tydlsDrmuvont)aexomo iydlaDranvi;s0trto(m oo4lmt  fet tfaruaxr no1tleoiictlsls2umumsnu4teerxf oodlateli ol(0sexrim no1llenmicilt) Dtr(  oo1aexnifcild m rl( p;u4teermo tytopDrlivolt0srxmio oydlme  nctlt  ruru ono1aee  ictlt sDemnvp (0 etoiociadlp rau i;s t2xmxr3iu4al emies ( sDtrxm ;t0ale ii3tytfmDeaumo;(4 eenxr ta1opte n s;t0truoxo ou1lm nmnvt (  2rmxrp;t1tpxnmictatlsDran p u)teeriocoo1fa eaivi (  ruoxo oudape  ict () 2tr(  ;o4apxo i3tadfsDeluvo t)aeenxfctodom r uvs s) rumxr iy4am   ici s  rtmxm oo1tee  oeiatfs emnmo (4trtoir iodlmte uvi s  exoirpiudaltelicsa( s2ur(r ;u0tpto ictadlaDemu snt) ltomf ia1om r uei;( trto(o3iu1amenmivtltf rumxmpou0optoioeilt s ranmon(4 lerxr iytfp eli o;t s2to(r iydlm nlfetlt sDrrx oou0teenii3iatls2umn pnt0texrxociodoat  nei;(  2urirpny4ll nmfvta(fsrtr(  ;o0tleo oetatfm elnmp (0tltoxo3tytlmDrlueslt0s2uoxm3ny1amt  fvsatfaDurur no4tetnmictldlm uau onu0 lxomo3iatfpt livo ()t2uoxo3no4ame lnet t aDtr(ronu0oet moeiydlmDuaumont)alerxf3oadlatrluei;s srtrxo3nu1lptnlivsat  rrr( ont0olxnif3iad a ua( ont) lxrmo tydop r ieo (0 rxoio3no1lme micslt) 2raurpnt4optnmiciasfs2umump;t4 lermo3iydfmDeluvols) exrxmpiu4lmtelfeil( aDtaumpou4apxoifciat mDrmnmp (0trtrir tytop r u ils0tetoir nu4al e fesas) Dtmx ono4tpeomo3ilslmDelu s u) rtomr3iy1oatraues (0 2uo(m3io4omt lnciat sDuaur nu4olxnmi3iatfm ea(vs t4 rtrmr3iotopt au o s  2xr(mpio1lmtn ivtlt)aDta(r ot4tex  ieild s2rmn p (4tetnif ty1fpteanvs;s s2tmxr oudolt  netas sruru  ;u0texoioetldfs2ra(msn(0aetoio ia1oa e ivo t t2umim3ny1lmte nct t s2tax  oo4alxoiiciysfaDuln on(4artrmocoatoa   nvi;()seuo(m3nydlptemfcsat  Durxrp;u1texn fciat s ul(vsn()areomrciydom  li ilt0 2trim3iu4ame lfctl(  Drm( oot0aleoioetldfm emnvsnu0 rtoifcia1la eauesl( trxrimpny4ole  iesas aDumumoot4olx mf3iadlaDum(von(4tlxoxf oy1fpD  ueo;t0 2toxrpoy4omt  fcsatfaDraxmont4oexniociatfm2rm(mp;u4 etoxo3iytfa eauvo;s  eumim3iu1aptnlfei sfsrumxmp;o0apen feiyt a rm(vo;(4 ltnmociadlpteaues;t  exr(opoo4lmtn nci (farrmxm ou1optomicildfs2elnmp;t0altoxrctytfatrli s ( t2toxr io1ll  lfvsa() 2tmxr no1tltnmo3iytfsDel(msnu) rtoir3io1omD au s;t teumim3nu4lme lies tfa2trx pot0tpe io3ilsfa ranvp t0trerxfcty1lmt aueo ( sexoxo iydape livsatfs2rau pot0tlxnmf3tasfmDum(mo;() exrmo oa1opDe uvs s texm(o3oo4om  liet t) 2rm(mpno0altniocildfa umnms u)arerxo3totlpDeln o;()trtoxr3nu1ll emicsas) Dur(m ou0oet ioctadlmDrau o;t4 lenxociy1optrluvi s0s2uoiopou4om  lncil()a2tr(r no1tlxn o3iydfs2uan snt0 exoif iy1lpDr nvslt srto(m3iy4lleelncsl() rtrxr nt1aeen f3iltfa2rmnmp u)trermf3tytoa eanes ( teuoxr nodlmte nesa( s2raurp;u4oltnmo3tadfm2ulu p;(0 exomf oo1omD ai sls0setrio oudaltnmfet t)srrrxrp;u4ole  icild s ulnvsnu4teeomf totom   ivo () 2xm(r3iu4op   fei t s2rmumoou0tetomf3tls a2elu o () lxoxf3oodfmD lueo;s) ruoir nodlpenmfeilsf Dtmxm nt1aexnii3iyt a2em( o u0alxrxf oadlmte nvs;(  etmxo3nodalt mfes tfartrum nu4aexnmoeiysfs2umn p;t4aexnir3ia1oat lu i t)seurxmpiu4optemfei t srtaxmo;o0ope mf3iytfaDrmuvpnu4tlxrxf3oo1lmt auei;()trxr(o ou4al elfcil(fa2umurpnt1apen i3iytlaDemuvp;u0texoif3oodoaDe neo;s0 exr(m3oy1openmies ( aDrr( o;o0tex  i3tls a2ua( o;(0tlerxo tytfa   i s (  2umxo no4opte fesa()aDtmumpoo1teto icildlm eaump (0trtoxo3iadfp e ivslt)srxoxmpnydaptnlivi sfsDuaxmoot0tee ifeiasfsDrmnvs u0tlxrxr todfaDe ivo (0seurim3nydlpeemfet s arrrumpou0alxnmfctltlm rau p;()aeenxocty1omt lnvsls) etoxr3iydoptnlieslsfaDuru p;o4aetnmoeilt mDuln pn(0trtnif3tytfa   ieo t) 2tmimpiu4optnlfcta(faDrruroot1oleomieildls2rmumpn()trxrio iydlptr uei t0 rxmimpoy4llenmfvsa() rrmxrp;o0tlt  fctydfs2ul(vp u)alerio3iatom raiei t srurimpnodam e fvs s s2tmx oou0tlt mf3iasfm2ra(mpn() etnxfctodfp eanvolt0sruoir3oudoptnlfvtatfsruau pnt4oltnmi3ils s elumsnu4artnmf3oadopDrai sl( trtm(r3io1lmenlneiat)aDtm( ooo0aee iieiltlsDemu o t0artoxfciatlpDrlnvi;(0 2xmxrpoudll elivtlt)s2rrxmo;o0alenmo3tltls2el( s (4 lxrmo iotopt li o t tetmiopio4ope lfci () 2raxro;u1opeoio3iyt mDelu o t) eerxo oytoa  li ilt trxrxm3nydap e ncsat aDrr(rp;u0tpt mocias aDeanms t0 ltrxo iotom  lneo s)t2umiopou1alee neiltfsDtau  ;u4alen f3ildfaDrl(vs;u4alxrmf oytoat au o (0 2umxm ny4oltn ics t)artaur ou4tptn oeiytfaDuanvp;t0 exrxocoy1omD  ues ()setmxrpnudamtn ietls) 2um(rp;t4ale iieiysfm2umnmp;t4tltrmr3iytom rli il(0 2trirpoudapenmieslt aDta(mp;t0openiociltls ranmont0trermr3todom ranei s0t2uoxm3iy4lm  miciatfsDurxrpnt0aexo ieiatlm2ul( ont0areomrciydlat lues;( trxmxo3oy1amtnlfeia( aDrrurp;u1olenmfeilt m rau p;t) eerir iodlpDe ieslt)srxm(mpiu1ol e ict s)a2raxrpnu1tex mfeiatfm ea( o;u4trerio3oa1fp   ivs ( t2umir iydlp nlivsls) ruru pou0altnifeiltls2rmu p (4tlxoxfcty1oa eli il()teurio oy1apt mfes t) rta(m nt0tlx mfcild sDumnvonu)alxomo oy1lm rluei;(  euoio oo4alenmieta()a2uru pnu4apxniieiltls ua(vpnu)teenmr todlpt  i ol()teurxr ou1amenlfvtas aDurx  nu0ale mfeiyd s2umn pnt) reomociytfa e nvo;t truoxopiy4ap emnetl(f rrm(r oo0tlen icilsfmDrmuvpnu4alxnmr3oatlp r nvo;(0seumxm3nu4op e nvil( artmxr ;u0oetoiociltfs2rlnvs t) ltoif oatoatr nvs t0 rxm(opiy1ol n fei s)aDtmx onu0tltn ieiat s eauvp t4artnmfctytfmDelnvs (  euo(o iodam elfetltfa2uau onu4tlt  i3iltfs rl( s;u4tleomr3oatlpD lneo t  exmxo oudlpte ies (f Drmumono0opx  oetytfmDulnvp;(0treomociytom e ivsl( s2uoimpny1lm nlneilt)sDumumpno1openmf3iatla2um( onu)texoxr3io1omtr ueils0 exr(r3io1om nmnvs sfsDrm(rpou4open fciatfaDum(mont0areomf3oodlateluvilt0trtoxopoudamtelfvta(f rtau pnu4tex  ociltls rmn p;() lxnmo3iytlpt lieolt  exmxo nudlm e feilt  rrmu pno4tptn oeildls ua(vo (4artnmr3oydoatr nei;s0 etr(o iudame  ics t srtm(r nt4oeenmo3iysfa2rl( ont) eenif3oodopt lu s ()tetrim oo4lmee nctlt) Durumoot0optomfciydls2emnvpnu) lxrmr oodfmtrluvi;t) exm(m3iudam emiei t sDurx ont0tpe  f3ias a2ulu o;t4 lxrmr iatfp eluvil()srumio3ou1lpee nvsa()s2tm( ono0aex iociasfsDul( o;t4altrir3tydlpDr i s;() euo(rpou4al nliviat)srumx oot4altnmo3iytfaDel( p;t4tlerif oy1fpt  ivi (  rumiopiudlle lnvtas)sruau pno1aexnmfetlsfa2um(vo (4altrmr3iatfpte nei ()trurxm3io1lptnmieil(fs2ua(mooo4apx  ietatfs2rlu o t) etnmrciytfptran ilt srxrio iu4lpe  net sfsrta(mo;o0tptnmoeild mDumnvpnu0aeerxo3iatlptr neols)s2xrxrpiu4opte ivi sfaDuaxmonu4tltnmietytfmDeauvs;(0trxrxocia1fmt ai i t sruoim nu4ll nmnci t)a2rmumo;t0tlx moetldlmDrl(vp u4aexoxfcoydom   nei;s  euo(o oo1lm   ivias)sDur( poo1opxoiiciys a2umump;u) etrmrcoodfptraivols) rxoxrpiy1lmte ncslsfsDraumont0tlt ii3tas m umu p ()arxomr tydop eluvol( seumim3ou1opte fvta(f Dumx ono4opx iieiat aDrmnmp;u4 etoxocty1fp rlnvolt setr(r3nodlp nlnvta( s2rrumo;o0olen ociatla2rauvp;t) rtnxo3todlp elnvo;( srxm(mpio1om   nvtlsfa2tmxm no1opeoio3ild a2eauvp t) etoxo io1lm e ivsl()trxm(rpoy4ole lfctls)s2truro;o4tlto feiatfa2ea( o;t)trxnxo iydfp   n o s)s2tr(mpiodopeelivtlt  2um(m no1olx ii3tlsls2rmnvo u) ltniocootfaDranvs;t) etoxr3iu1amtelics ()aDum( p;u4alt iiciasls2rm(von()teenmocoydomtr ueo;t0trtmxo3oo1lpeemicil(fsDrrurpno4oltnifeias m emums (0arxrxo oy1latelueols0tetmxo iudol  livslsfsrrm(rpnu0aeeo ocils mDemnvont0 ltnxr ty1optelu i s0trumim ou4alenmicsas)sDraump;t0openifciad s2elnmp t)arerxf iadomD  nvi;s)setrimpio4alt  fctl(fsDurx o;t0alxnmictls m2rl(mpn()tltrirctatlpD li ol() rtmxopnudlmte iet t artru o;u0tlx mf3tldls2ran s;t0aetnifciatoa  lnes t srxr(m nydole  fesas  rtru o;t0opeo oetlsla ra(mo;t4aetrio3todoate uvs;()teum(o3oo4ll   fet t)a2tauronu1apenifciatfs2elu o;u0 ltomr3ia1oatr nes t0t2trir oudam   fvi tf 2umuroou0olx if3ils sDelums;(0tetrmo iatomte n o ( srxoxo oy4lptnmnct s  rraxrono0olenif3tydlm ra(mont)altrxocoy1fm rauei s srtmir io1amtnlietltfs2umurp;u4tptn fctasfaDuluvpnu4treoir3to1fp eau sl() 2xmxr oudamenmivtas)aDtmu oot1apt mo3tydlmDra( o;t4tltrmo todoaD aieo t0teurim ny4alenmiei t)sDrr(  ;t4optoif3iatfa2ea(vsnu4texnmo todomDe uvo (0setm(r3nudlptn ncsasf rraxmoou1tleoiietlslm rlu s;(0 lxomf ootfmDrai ilt0seto(r3oudop  mfcs t  ruax o;o4optnmi3iyt a ranvs;t) rxoxo iotfpt  uei () 2trxr nudopen fvsa() 2rmxmpoo0altoiiciysfa2elu s;t0 rxnmrctytfm  au sl(  2xmxrpoydaltnlnes ( aDtmu ooo1oltoio3ild aDulnmsnt4 etrif iydfmtranei s teto(r3io1aptnmfcsa(fs2ta(mpot4teto i3iyslaDemn snt0alerio3totoaDe ues s0srxrim oy4lpt  nviatfsrumxmpot1aptomo3iydfa2rm( o ()alerxocootlateli ol( trurir no4opt mnei ()arur( pnt0alx  o3iltfm2raumo;()tetrif oytlm  lnvolt  2xrirpoodalenlnctasfa2tmu ont1texo feilsls rl(mon(4alxomfcto1lm  lnvi s)tetr(opiy1am n nvtl( a2tmx pnu0aeeomieiyt s rmnmp t0alerio3iodop elnvo s)t2tr(r ny1ap  lfetl(fartmxroot1aex  ocild sDrau s;() reriocty1opDr ues s) 2xmio ny1am  mnciasfsDum( oot0opt moeiydfm2ea(vp;t)trxrxr todlpDe ieols0 2uoxm3iy1llt  nesl( artaur no1tltnioetytfm ua( o;u0arxniocootomDe ivi;s0 2toxopio1oltnmivtl()sDum(r oo1alx mocilsla rluvs;t)tlxoxo io1laDr uei;( s2xr(r ou1llt lnvs ()a2rmxmpoo1teenifciytfa ua(ms;(0 exrmr tydla r nvsls t2xrxmpiudoleemivt s) rrr(m ;t1oetnmociat m elums ()aetrir3iotla r ues t0 etrimpnudom n iei (fsDrm(r ot1opxnmictyslm2umnvs;(4 etnif tydlm r ivolt0teur(opiy1ol e iviasf 2rrx oot4teenmi3iytfm2uanvp;t)tlxriociodfaDraieslt)sexoir3nydam elfcslsfsrumu pnu4tex  o3ildfs ranms;t4aleoiocoatlaDeaueo;s) etmiopou1altemnesat)s2ra(mpou1tpt ioeiyslmDeaumo;u0trtrir oytoatrlues () rurxopoodomen ivs t sDrmurpnu4apto icilt aDelums;u4treoxr3iadomt au i;s)teumxr oydap elfvi (fartaxmoou1tex iociaslm2raumo t) eeomo3ta1omDr u i ( t2xo(r no4ameemics s a2rmxront1teen oeiatfa2um(vp;t)alxniociatlmtraneol()t2xo(r ou4lpenmfciatfsDtm(r ou1oee ii3tatfs2ul(mp (4artrmr3tatfaD lu o t  rxmimpiudopt lfctas) Dum( ono1oltn iciysfaDuanmo;u)texnxocoy1oate n il(0s2trxr ou1ap elnvtas) Drmxro;t1oexoifciysfa uanvo u4tetrxf tytfaD aivols0trxmir3io1lme mneiltfaDrm(rp;o0openmietat mDumu on()trxrxr io1fpD lieilt) 2xmxopoo4omee fcsl(  rurx  ot1opto oeiltls rmn p;t4areoxrciydfatranvi s0sruoxrpny4al elncsl() rurx  ;u0olx mfcildfs ra( o;t0trtrxocto1oaD  i o s)truo(r3ou4oltn ics t)aDtrxrono4opeomicils s2ea(mp;t) ltoxocoatfmtrlnvs;s0 2urxm3no1lmenmfet s artau ooo4opeo feiydfaDuan o;u) rtoxrcoy1oaD auvo s)trxm(m iu1olee fci s aDtr(mo;t1oet iiciadlm ul( snt)aexrmrctatopDraneol( t2toxopoodolenmfcsasf Dua(root4aexnmociytlm elnms t)teerxr tatlaDraueo t0teur(rpiudop  livtl(  2trxm ot1tleomieilsls ulu ont) rxnif3oytopDrli i;s  rumirpny1amt  nctlt)a2tmx  no1opt io3iaslaDuanmo;u4 exoxrcoydlmD  ues ( trxmxopio4op nmivsl()srrm(mp;u1oltomo3tydfmDean s u4tlxoxfciy1fpt lnvs;(  etr(m3no4oltelfci s sDtrxmoou0tlt ii3iysfm2emu p u)tltrir3totlpt lneslt) ruo(o3ou4lle mfei sfa2ra( ont1oeeniietytfa2el(vo (4 lxrxr iotlm   uvi;( s2to(mpoo1alenlneiltfarua(r ot0tlxn feilslaDemn p t4texnifcta1fa rli o;s)trxoiopio4ome  icsls) Duaxr nu4tpx  i3iyd aDea(mo (0aleoxocoadopD lnvs;s)sruoxr no1oltelfesls) Durur ;u0opt  ictlsfs2uau o;u)tltnxrciatomte nvs s0 2xoxrpio4ome  fcslt)a2trurpoo0aetoifetysla ul(vp u) lenxfciydla eaivo;s)srumxr3io1lm nmfes tfa2uaur ot0tpt mi3tas aDua(vs;()treoio oy1lpte uvo s s2triopiydlmen neia()s2ua( pnt1oex iietld aDum(mpn()alerxf iytomDe n sls  rtrxm3iu4ll nlfetasf Dtmxm ot1tpxnifeiltlsDul( pnt4 etnmfcoydfpD ai i t s2xmxm nu4om elivsls) Drr(rpno4tlen oetadla2em( o u0tetnmf3iotlat ai o s)teumxrpiu4ome mnvtlt)sDum(rpoo0oeeomfcild a ua(von(4 etnxo3todlp  lnei;t)srxoxm3nu1llte iesat)aDtmump;o1tlx  i3iytla2um( p;u0altrmf iytoa  lnvo t) exrxr iydlltelfvils) rrmu  oo1tpto ociytlm uln p (4trenxr3oydfp rlneo;() ruo(o3ny4ale livsl( aDuaxmpno1opxniieiadfm emnvs u)arerio3iy1lp rauvo s setoiopnu4alt lics ( aDrrumo;o0teeo ieild a eaumpn()arxnxr3oy1lpD lu olt srum(mpny4ol elncias s2ururooo4oexn fciyd sDel(vont) rtnio3oatfpt livols  2xoxr3oy1lme lfct sfaDraxm ou4apxoiieiadfa rl(mp t4 exrifctytopD  nei;t srur(m3no1lmen nvi tfsDta(root1alxniociadla2elnmpn()aexoif to1fmte ivolt trxmxo no4lle lfet sf Dum(monu4aeenmi3iatfa2ranvpn()arxrmf tytopD lneolt)trtm(rpnu1open ivs t  Dtrxrpot0apt iocilslm ran onu4arxnxo tadfpDe uvil(0texmimpiydlpeelictatfaDrmxm ;o1tetnmieiatla em(von(0 etoir ia1omD  i s s)seur(r nudol elfcsas a2uaurpoo0tpen iciytfsDua(ms;u)texnmr3iydfat anvo t0 rxoxr3oy1olenmietasfarrru  ot0altomfciaslsDuanmo u)artoiocoadoat lnes;(0trtoio oy4lltnmiesls)srumxm ot1apx iiciatla2rm(vp;()artrxo iodopD ln i;( s2uoir iy4ol  micslt) ruaxmooo4apto fctydlm2rmu o;u4alerio3to1lpDe n o;t) 2tmxrpoy1oltemfci s)a2uaum ;t4aet ii3iat aDeaumo t4trtnmo ta1lat livs;()trurxrpiy4omenmfctls)sruaxmp;o1alxoifctytfa rluvo;u0 ltnif oa1oaDr uvi;s)texm(rpoo1openmict s a2rmur oo4opx mi3iysfs uluvs (0tltoif oy1oaD anes;t0 rxrio iu1ap nmfvta( aDrr( p;o4oleniieiyd mDrau snu4teeomr iadfaDe iei;() 2xrxr ny1lptnmneiat)aDraxmo;t0aeto o3ilsfaDul( onu0 ltrxf iodop rln i t trxmio3iu4ape  nvils s2uax p;u0aetoiocildla2rmn s;u)arxnxf3oatlptrlnes;t0s2xoir oodlp n nvi tf Durumo;o1aex ifeiyslmDrm(vs t0 lerirciydopDeau il()teum(o oo1apt mfvias)artrxmoot1tle  oetadlmDrlnvp ()aeeoiociy1lp   nvs;() 2xrir3ny4omee fct ( arum(  no4oetomfctldfm2um( s;t)arxnio3iydopDr ieol(  2xmxr oo4lltnmfvta( artmxrp;u1oee miciltlm uluvs (0trenmr iadfp eli i;(0t2tmio3iodlmtnmfetlt)a2urx  nt4oeeo i3ildls2em( p;u4areomo oy1fpDelneil(0 exo(o3ny1om  mnvias  2taxmont1optoifciydlmDua( s;t0altrmr todlatranvo t0t2tmimpny4lpe  icslsfaDrmxrpou0opeomocilsfs elnvs u4tetrxf3oydfmDr iei;s sexo(r oy1oltelicia()sDurx  ;t4tpe iietytlm2umn pnt)trtrxr iydomDelnvols)tetm(m iudalte ictl(faDtmum nu1oexnmo3tldfa2um(mp;u0 exoxo3ty1lm   nei;s t2uoio3ny1al emncias) Dtrur ;o1apeo icilsfa rmu pn(4 etnmf3oatfat auvsls0t2xmxmpnu4lleemies (  2uaumoot4tee  i3tldls ul(ms () leoirctadlaD an s;t0srtr(rpoodol nlieil()aDurxr nt4opeomfeiltfa umu snu)tlxoxf3iydopD lnvols0 eurimpiodll n nvs t s2rmxmo;o1ope mfciasfm uanvs;u0 exrxf oytoat  ieslt0 2xmirpiodole miet tf 2rmxrp;o1aleo ocild s2eanmo;u) renmrcoydlmD livs () 2uoxrpio4lp nmfcs ( srumxm nt0opto i3iad m2uan s u) exnir oydlpD luvi;( seuoir3ny1ameemnctlt sDuaumono1oleoif3tltfaDra(vs;t0 reomf3totomtrln s (  rxmio3nydllen fei t) Drmu  ot4ole  o3ildfa rlnms;u) lenmr3io1la e nvo t srurir3no4altn iesat aDtrur ot0opeoio3ilt sDemu s u4 eerir oytfptr uvi;( srtmxm no1ap e fcia()artm(mono4olxniociydfa rauvo t0arxrir oy1faD  n s;( srurxm iodlptn fesasf rurxmp;u4oeen f3iaslaDrlnvp u)teenxr iotoateau sl( teum(rpiu4ome mneilt) 2umu pnu4aex  fciytlm2rmuvs;u) ltnmfciotoaD  n i s seuo(opoudomtemicia(fsDuaxrpou0oltomocils a rmuvpn() ltnmf oadlmte ivs t)trum(mpou4ll  lies sfaDrr(mp;u0oet moeiadfmDrl(vp (4 ltnxocta1lp raieo;()sexmirpio1lp e ietlt)aDtr(m ;t0teen ictysla2ulu p (4texrmociatlmteaiesls0 exo(opiy4ap nmncilt) rrax oou1oltomf3iyd aDua(vs;u4alxomo ootfaDeau i t0t2toxr3iydaptemncia( sDtmu p;t4tlxo oetlsfa umnmpnu4teenxr3iatlmDe i i ()truoio3oy1apt mfvias  2uaxro;u1tlxoiicilsfmDuauvs;()trxrxo to1lmt luesl( t2xmxopny1omeelnvs (  rtrxmp;o0texomfetatfaDulnvo (4 etoxr ootoptr ivo t0t2toxr iy1llt  ici tfa2uaxr ot1oetn oetltfa2ran p ()tleoxf3iodlpte uvi;t  rxr(m3ou4open neiltfaDtrxront1tpxo octyt aDuau sn()trtnifctadomD  n s;( srurxo nudamte iet s)sDrmxmo;u4aeeo fetldfm ua(vo;(0 rerircoytlm rli i s  rurxmpno4olt lieslt)sDtrumoou4apxoiictldfm ea( o (4arxnxocootfmD lueo;t0t2xo(opiydlpe lfcias  rtaurp;u4oltn ieiltlsDrlnmp () etoifciodfa r iesl(  rtr(o io1lm elncsls)sDurump;u4tpen o3iltfm2uanmonu)trermr3ta1lpt lnvs;s)t2uoxr3oudopte fvtas s2tmxrpot0apenmfetysla elnms (0 rtoifciy1la e iei t  2tr(r oudlp e fesl() Drmum ;t0olt  iciadla2umn o (4 lxnmfcoa1fmD aivs t  2xrxmpno1optelfeias) Dtrurpot0tle mo3tatfmDrmnmp u4trermo3iotomtelnvilt sexoxr3iydlle lictl()sDrmuro;t0tlx iieiys s2eln onu) renmo iatomtrlneo ( texo(m3iy4omeelfvtasfsDur(rooo1tetnif3iatfm2el( s;()texrio ia1lat  u i;s)trxoxo3oy1lp n fesls s2rruroou4opx ioetaslaDem(mp t)tlxnmf totoa   nvils0s2xoiopno1lp emieilt  2ta(rpnu4ope ioeildls eauvo t0 rxrmf oatop rlneilt s2xmxopiu1om emfviat  Dur(rono4apxnmfeiadlmDra(vpnu)altrxrctydlm  aneil( s2xm(r3iy4omteliei () 2rax pou4teen i3iat m umump;(0trxnir3tatoatelneo;s t2xmxo3ny4ap n nesat s2rrxrono4altomieilt aDem(vo () rtnio oy1faDeanvol()seuo(o nu1lmeemnvta( aruaum nu1tlxnif3iasfs um( s;u0aetoxo3tytoa  auvs;t t2xmxo3ou1apte iciat  Dtrxm ;t0aleoii3ilsfsDrlumsnt0trtnxr3todfatr i o;()t2trxo no4lpte ncia(fa2urxmpnu4tpx moeiadfm ulnvonu0 etrxo oydfmtr ueo;s0teuoxr3nudlpenmnct ()srra(mono4apx  oetlsfaDumnvs ()arerio oy1lmtrlueilt  rtrxr iodap   ivt ()s2umxmo;o4olt mi3tydlaDeln p;()alxrxr3tatoaDr uvi;( s2xo(o iy4lptemictas)arrmxr oo1ope io3tlsfaDel( o;(0 lenxfciy1om  lu il(0 rxm(m iudlm emnctat  Drrxr nu4tleoifeiyt s ea( o;(4trtrxo iydom  luesl()trtmim3iodamt mfvtas s2umu onu4open i3iyt sDuauvo;u) lxrmociatlptrlivs t)srxmxr no4lptnmfeiat)a2ua(mo;u1tptoiiciasla2umnvsnt0tltnio3iatlp  luvo s) 2urxr nydam e ieilt arrrur ;o0olx  oeiytlm ua(mp t) lxrir3ta1lmD lu olt t2xmxr3ny1llee fvs ( aDtm(moot4teeo oetydfsDumuvs t4 lxomoctydlm  li s s  euriopoy1om nliciasf Dtmurpoo0ape iociyslsDulnms u)aleoifciy1om  luvo;s0 rtoxopiu4am emfeiat  Drr(r nt0ale  fcildfs uaumonu0aeeomo3to1lmDraneo s srumxr3oodamt mivtlt)srumxm ou4tpt io3tat s2uau pn() rxnxfctodfm  aieo (0trxm(r3oudapeemietltf Dum( p;o4apxomieiydlmDum( o u4aetrxr oytla r nvo;t0seurxo ou4lme livsa(f rrmurpnt4tleoiictasfm2ran o t0aleoxf oa1fmt  i s;s) rumxmpnodape  nctlt sDra( ono4ale mfciadfa2umu onu0altrxf iotlmteanvi;t0tetr(r3oudaptnlfctat  Dta(m nu0altniietadfaDrmumont4 rerxfcootomD aivi;s0t2tmim iudll   fvsa()srra(ro;o0tet iicilsfm elnmp;u0aexoioctatfmD lieo s t2umxm oudal emfetl() Dur(mpou1teeniiciys s2rl(msnu)tleomr todlaDrlieo;t)s2toxo ny1omen nvsltfaDrr(m oo0tltnmi3ild s2ean p;t)aetrmr oydoatrauvs;() rxoxm3no4apen fvi t)aDrrurpno0oexnmfeiadfmDuluvo () ltnmr oydop e uvi;s t2to(o3iydap e nctlsf 2ur(mpnu0opt ifciytfa ranvs () rxnxo iytoa rlu ilt0s2xoxmpno4am emnvsa( srrrxrpnt0tptnmoetlsfs el(vonu4texoxr oa1opDe ivs;s  2xr(o3iu4lmt lictas)srur(rpno0tpxnmf3tat mDeanmpnu0 eeoxr oy1fmDrau ils) 2xoir oo4ale  icsatfartr(m ;u0oltnmoeiasfa2ul( pn(0 ltoxo3tatla r ivo (  rumxm io4oleelivtas) 2trumpno0alt ii3ild s2rm(vo u)alenif3ty1fmDeluvi ()teto(mpiu1opt mivt ( s2uaxmpou4opxo iciasls2umnmpn()tltnxr3iydoa r n o;(0 euo(o3iu1omeelfvtas a2raum oo0apeomfeiyt a ulnvsnu4aexrxo3oa1fpDr uvo ( srxo(m iodlm e ictl( sDtmuro;o1oexoifctadfa2rlnvs u4 reomf3to1fmDraues;t0tetrio3ou1al nlneslt sDtaurpou4apxomoetyt m2rmnms;u)arermf todfa elivo;( seum(r nudaltn feslt) Dtm(m ou1tptoiociytls2eanmonu)trermrcootfat aues;() euoxrpiy4altnmfvi (fs2uaxr nu0altoii3iatls rl(vo;u4aeeoir3to1fm  luvs ()t2xoxrpiu1lmt  ncsat) rtrxmont1oex mfeildls2umuvp t) rxniocoodop  an i ( t2xoxm iydlltemnvilt srurx onu0aetnmoetys s um(ms ()artnif oydom eluvi;( texrimpoo4aptnmneiatf Dtmxmo;t4alxn oeiadfs rmnvsnu4trtrir3oy1omtrluvo;t)srxr(rpiu1lm nmncia(fsrumu pno0tltoii3tytfs umu ont4 lenmf iadomtr nvs s  eumxr oodom n fes ()aDum(rpoo0apeomociltlaDeanvsnu0 etoifciydlmt  n o s0teurio nodllt mfcil(fs2ur(root4tpenmo3iasfm2ul(mont) renmociotomtr nvs;(0 2xo(rpiu1ol  lfvi t)sDtax onu4apxn iciaslm2umumpnt0tleoxf3tatfaD  u s;s setrxrpiu1al  lfei (f rtmum ;t1tptnmiciad a2ua(mp;u)areoif3ia1opD anvs;(0srxoxmpiu4al nmnvs s a2ra(rp;t1optnmf3ias s2el( onu)trerio3oy1oa  an sls0 2toxr3oy4al e ncs tf Dumxrpoo1ope  f3ils sDrlu p;u0altomfcia1fateauei s0s2to(m3io1om nmivtltf rumx p;t0tpe mietad aDua( o (4arxoxf3iadoa rluvils)tetr(mpiudame mieilsfsDrrx pot1apeo o3iydfs2rlumonu) rtnirciadla   u i;t) etm(o iu4am elfeia( srtmx  oo1oex  ociasfs ra(mon() lenio io1oaD  n i;s)teuoxr oy1ap n ivt (faruaump;t1tleomoeiat mDeanvsn(0tetrir todop e iei;(0srxo(m3no1ole  fesls) Dtrxrono4tlx  f3tytls uluvs t4tltrxf3oydlaD  u sl(  exoimpoo1omenmfcsa(fs2rr(mp;o4tlxo oetldfsDrmnvs (0teeoxfctatoaDr uei t  etm(r3iy1apt mfviat artrxr ;u0tleomieiyslsDuluvsnu0 eenxf3tytom   nvo ( sexmim3oudol  mncia(  2ra(mpou4aexn i3iysfa ul(mp;u0artoxoctatlm eaivs t0trur(o nu4ol  miei sf 2raxmpot1aee  ociys a2uaumpnu0trxnmociodlm  lnvsls  eumxopoo4lleelncsa(faDua(  nt0aee mietldfm2uau ont0 exnxr3oodoa  lues;(0t2xo(opiy4ll  lietas s2uaxrp;o4oltn feiatlmDelu s t) rxrio3iatla e u il( s2xr(r ny1olte feils s2ta(  ou4tptnio3iadlsDuanms (0 rerio3ty1omDrauesls) 2tmiopio1apee ietat)s2raxr ou0optomociaslmDelu ont0trxnmf totomt  u s;t0t2xoxm3iodam  lict sf rra(moot1aex mictat mDean ont4alermfcoy1omD auvo;( t2uoxr oodll emictas aDrrxr nu1teen ieiat m2ua(vont0trxrxf to1fm rluvolt t2umim3no4lltnlfcia() Dtm(rp;t4tlx mf3iadfmDranmo;t4tlxoirciadfat  uei;( trtoir iu4ale mneta(f rum(m ;u0aee mi3tasls raumo;(4 leoxr3iatfmDe ivo s0s2xoiopiydlpen fesa( srraxro;u4tpe mictyt s2ulnms ()tetrxo3tytfp rlues t0s2xoxmpnudome lnct t artm(mp;u4oeeo fetldfa ran p t0 rtrxfcia1fpt lu i;t tetr(rpoo4alee ivsl( artau  nu1texo ietlsfa rmn sn(0tlermo tadlmDean sl() 2uo(r no1lp emiet sfarrrx p;o1opxoiocilsla rln o;u)tlermo iodla eaivs s)s2tm(r3iudap nlfct (  Dtmumpou0tpeo ieiad aDrl(mo u4 etoxrctodfat  n il(0srumxo nodal  lncilt)s2urx poo1aeenmoetydla2elnmsn(4tlenmo oo1fat liei t t2xm(r ny1olte ieia()aDurx ont0ole mi3ilsfa ul(mp;(4artrxo oodlmt aivsl(  rxoxopoo4ome lfesls aDuaxr no4tpx ii3iyt m uanmpn(4 ltrmf3iydop r ieil( trtr(r3oydlpenmivt t a2raum no4tleo ieiatfm2emu pnt0 lenxo3iytfateanes t0 rtoir ou1lp  mfvi t aDtr(mpnt0opxo ieild a rmumpnu0alxrmo3tydoa rauvi;s trxm(o nu1olt  feta()arua(rooo1texoioctydlm2ranvsnt4tetoif3oy1omtrlneo ( t2toxo3oo1oltnlnvsatf rtru ont0altoio3tas mDrauvsnu0 lxomr tytlm rln i;t t2xm(opiodom   fvslt srurumpou1tpxn ocilsla eanmon(0tlenxrcoy1fp r uvs;()sexmxm3oy1lm   netltf 2ur(rp;o0aptnmoeilsfa2umu pnu)altrmrctytfpte uei t) rxo(m oydopt lici tfsrurxmont1aet iieiatla2elnvp t)teerxocio1lpt auvslt  rxo(opoo4ol e feiasfa2rmxrpou0tlxoii3tld a eln ont) ltrmf3oodlpteluvo;t)s2xr(o3io4ape lieslt a2uaurp;t4aexnifctadfaDelnmp t0aleoirciy1lm rln s;()trxr(r no4ol elnesa(fsrrrur ;u0teeomfctadlmDrmuvo;t0 ltoxr oa1lpte i o s0s2toim3nu1ll nlnvsls) rraum nu1oeen ietasfm2rmu sn(4 ltnmoctatlm  auvi s0setmxr3no4alt  fesat) Dur( ont4tlx  fetaslm rau p u)trtoxf3iadfmt  i o t) rxrio3oo1lmtn fes tf 2rr(  nt4oexo ietyslaDulnvpn()alxomrcootla  anvs s)srumim3oudap elieta( srrmxr ou1aet iieiyd m ulu pnt0 rxrio3iodfpDrai i;() ruoir ou4omte nvsa(fsrurxm ;t1aleomfctlslmDra(vpn(4aeeomr iotopDrlnes;()trxrim3nydlpte nvt sfs2rru poo0tlen o3ilsfaDeau snt4 lerif3todlptraues s)t2tr(r ou4lle micsa(fa2raxmp;t0opxnmf3tldlmDulumont4tetnxrciytlmte u ols0s2urxr3oo1amtnlicsa( srururp;u1tlt  ictys a2uan pn(4aetoxr oydlatrluei t0s2tmimpiu4ap nmieilt)aDra(mp;u1aee ifcias a2ul(mo u0 leoir iytfateai s;s trurxm3iu1ol n neta(fartau pnt4tlt ifeils s ulnvonu0aexrmoctatlaDelnvil()texmio ou1lltn nvtas srum(  ;t4teeoiociad a ul(vs t0treoircoodfpDe ues ( s2tmxm nodoptnlnct (fsDur(  nu1openio3iyd a eln ont0tlxomfctotoa raueo;s0 etr(m ou4optn nvtl(fartmxmp;u1tpt ii3iys a em(ms ()altrmfctydla rli ils0t2ur(mpiy4lltn fet ( srtr(rpnt0olx moctld mDumu snt)artnio3iadlaD luvs t t2xr(mpiu4ap  mici ()s2umxm no4optn oeiyd a ulu p ()teerxf3io1oaDraneolt)seuoxmpno1om e fvsat aDururo;t0tlx  oeiad a2eluvo u4aeeomo tydla e nesls)trxmxr iu1olt mnes ()srtaxr ou1teenifeias sDulumsn(4 etnxfciy1fpDr nvo;(  rtoxm3oudlpeelfetat s2rmurp;o4tlxn i3iadlm2ul(mo () reoxrcoadfp eli i;t  2tmxopiu1lmte fcilt) Dur(r ;t1oex moeilsfs ua(mp u0trerir io1opD  neo;t) rtoim no4lptn netat)sDrau o;u1apxnii3tydlm umumont0 rtnmf iatop r n i;(0trurir oudlm   ivsa(f 2uax p;u4tex  ietyd mDrl(msn()aeeomf oydfaDrlieols  eumxm3no4om   ncs s) 2rmurpnt0optn fetls a em( p (4arermociotop  luvsl()trurimpio4lm elneil(fa2umxrpot4aptoiociltfs ulnvpnu4artrxo ty1oatr nvolt0 rur(m3io4ome  feslsf Dtrxmp;u0olen feiaslm ea( pnu) rxrxf oodfa  anes (0s2ur(mpio1amt mivias aDumum nu4oee ifeiat a um(ms;t0arxnxf3oatfp eanvsls) 2um(o nodolt  fvtas  Duru  ou4tptoioeildfs uln pn(4 lxnmrciy1fmtr nvi;(  etmimpoy1ol e ivtl()aruax ono4opxnifeild sDrl(mp u4 leomrcia1fpteanesl(0truoir3no4am nlnvsa(farrrx onu0tptniiciatlaDrlumonu0aeeoxf iytfpDrau i;( s2tm(opoy1aptn nvilsf Dumuroot0oexomicias mDum(mo;t)treoxrcta1lp   ueo;t0t2xr(r oy1alee fcslt aruaum ;o1aptomfeils m um(vo;t)aexnxo oy1fm ean s t  ruoxr oo1ole  feta(fa2taurpou1oeeo fcildfmDrln p u)trerifcio1lmte ivol(  exrxm nudalt  fetl() Dumxmonu1aleoio3tysfaDumuvs u)texnxf3oytfmD au ilt s2tmir oy4ll elfciat) 2uaum ot1oeeo ociasla2rl(vs t4artoio to1laDrlnvs t0 etoiopnodlptemivilsf Dta( pot4tpxn ociytfa2ean on(0altoir io1op eaivol() rtoir iy4omtnmfes (fartau pou4tlxo f3iys a rmn p;u) lxrircoydomtean s;s0seurxr oo4amtemivsl( srrmx  ou0ale ioeiys a2eluvpn(0tlxomr3oatlpt  u sls0 exo(o io4amt  ics ( sDumumpoo1oetnii3iysls2ean on()artoxo3totfaDranes (0trurir no4ome  ivias artm(r ;o0oleoif3iysfm2rmn pnu)teeoio tytoptelies;()texo(m oudapeemfetasfa2tmx  oo4opx iocilsfm umnvonu)tlxnmfciatoaDe ieols) eurio3oydlme  fcs s)aDrm(r nu4tex  ociltfm2ulumonu0arenmrcoodoaDraues t) etoim iy1op nlics () Dua(root1oexn oeiys aDulu pn(4trxoxf3oo1fp   i i s t2xm(m3iu4altnmnvsa()sDtr( ono0tleoiieiytfm2ulnms;u0 etnio3todoa r iesl(0 2umxmpiodlpt mivtlt srua(ront1oeeo oetldlaDrauvpnt4alenmfcio1om r ivs (0srxmxr3oy1lm n fcsl( sDuaumont0oltnifciytfm2uln pn(0 ltrmr3ootlpt  n s s) ruoio oudaleelncsa()aDrmurooo0aee iiciytfa rauvo;u0 reoiociadlmtran ol( t2xo(m ny1al   fcsatf 2ur(r ot4alxnmiciasfs2rmnvp;(0 eeoif tatoateauvi;s) 2urxrpiu1ap n nctlt)srtaxr no0teen o3iltfs eln on(4 etomf todopDeluei s0truo(rpiydlmtnlicil(  rrm(ro;o0opxomfctatla2uanmsn(0texrir oodoat anvs ()t2uo(rpou4altnmnctl(f 2uru  nt0tpt ioctys a rmnmo ()artrio oydfm ranei t)srto(m iu1lmtn ieta( srtrxmo;o4apenioeiytlm2el(vp;t) renmrcta1lp   iei (0tetoio iydaltnmfei tfs2umur no4olx mociad s umnvpnt) lxnmr3to1lm e uvslt)trumimpiydop  mnci (fsDtaum nt0opx ii3tld s2uanvs t0arxomf iodfmt  uvi;(0t2umxopoo1oleemfcs s sDrru o;t0olenif3iyd aDelu s (0texoir3oadfm rluvo s srumim3oydapenmncta(f Drru o;o0tleoiieiyd m2ea( s;t0 lxnmf3oodlatrlieils)teur(r3ou4llenmfcslt sruaurpnt4alt ifctad sDeanmp u0arerxf3oa1omtrau s;s  2trxrpiodale  nct (  rrmx onu0apx mfciasfm2eauvp;t) rtomr3tydfmte ivils0t2xoimpio4alee nvtl()a2taxr no0aee mfcildla2uluvs t0 lxoif3iodlmD an ol() 2umio3ou1om nlnet ()a2ua(rp;t4oleo feiasfm uluvo u0tlxrircoo1faDeaueilt t2tmxo no4omeemfvil( arurxrono4apeo i3taslaDul(vpnt4trtrmf3oy1fptr nvo s teto(o nydaltnmiesat s2rmu ont0tltoifciasfa elums;t4arerir3ta1oaDeli i;(0truo(rpiu1optelieil( aruau p;o0tetniieiys m el( p;() etoir iotoaD lueo;(  rtm(o io4ll nmfet ()a2rmxro;u0alto ieiadlaDran o;(0trtnmociotomtr n i;( seumxo3nydolte ncsas srtax poo4oee iicildfmDum( s;u0arenxr3io1omDeanvs;t0srxrio3oy1ap n fct t)srtax ooo0tptoifetad sDrauvpnu4arenmocta1oa  li o t)t2uo(rpio4lp emfetls)aDuax  ot0tptomoetytla ua(mpnt0 exoio3iy1om e n i ()trtmim iy4op nlfctl()s2ur(  ou0texn o3tyslaDeluvpn(4trxnmo iotomDeli i (0 eumxo3ny4lm emnes t a2ra( ooo4tptn octasfs emnvs t0 etoifciy1oa rlies;s0s2tr(opnudlltnmivsltf Draumont4tpxomfeiat aDeanvs;(4trxnmf3tatoat aues (  rxrim3oo4aptnliviat)sDtmxm ou1ole iiciyd sDeanvo t0 rerxrcty1laDraneo;s)teurxo io4lpe  feil(farra(mpou1olxoioetldlmDua(msnt0trxrmocoy1lp rluei;s0s2triopou4al e ivtltfarra(ro;u4tee  f3iysfa2umumo;(0tltomr iydoa   u i ()teum(opoodol elfct t a2uau pou4tle mfeiltfm2emn p;u)aleoio3todlaDe ieils)s2xrim iydopt lfvs t  rur(ront4tle moctlslaDulu s;u0tlxrxo oatomDrli o ()t2uo(opoydol e ivilsf 2tau  ;o0oetnmfeiad aDrmnvs;()altrxr3tydlpt  ivolt seur(m ny1amt lnvil()a2rrxroou1tltomfeiadfs emums;()trxnxr3to1om e ueol()t2tmim nodopeelfctatfsrrmur oo4olxoioetad sDrlnvsnu4tlxrir ia1lm rlu o s0srtoxmpnu4lpt lnetas) 2taxmoot4oet io3tls m uanvp;(4 reomf iodlpD aieo;t) exrim3io4lmtnmici (  Dtmur ou1ape ioctatfsDua( o;(4tltomr3tatoa elu o t0 rumxo3iy4om  lneiasf Durxm oo1apxniietyt a ra( p;(4trtoxr oy1om rlies;(0srxr(r3ou4alt mivi s) rum(rooo4olxnmfciyt s2rlu o u0 ltomrctadfmte ivo;s srxrxo no1ameelfct (farurum ;o1tptniieiyt aDemn snt0 etrxfctotlpteli s;t s2trimpio1ape lfvt tf rur(ro;u4ale moetldls rlnmsnt0 exoxfctadomt  nei;t texoxr3io1ol  lfvsat)aDta(rono0opt if3tatlmDrm( o (4 lermf oodopt lnei;(0teum(r3oydlm nliesls)s2tmumpou1ale  i3iydlm2rluvs;t0 rtrxrcia1lmteanei;t truriopio1lptnlfeil( sDtmump;o1oleo fetldfm2rluvs u4 rerir totom e nvo;s)s2uo(mpoodlmenlics s)srraxmonu1opt  i3iatfa2ea( s u4tltrir oo1fmteaivil() 2tmir3no4amtemfeias  Dtr(r no4ope mociytlmDelu ont0alxnmo3tatoatran sls)sexoxmpnu4lmtnmfctltf rrmur ;o4opxniietadlmDum(msnu4tlenio tydlmD lneo t setmxmpiy4op nlfcslsfa2trumpnu1ale mo3tasfmDrmu p;u0tetomf iodfmDe u ols0trtoimpny4ape mnes () rtaumono0apen feiyt s rlu snt4 etnmo3ta1fpD aiei s t2xr(r oy4ol  liesatfarrmxrp;t4aleo i3tas s2ua(vp u)tleoif io1lmDrln i ( t2ur(rpno1opeelivilt a2tmu onu1alt miciysfs rl(ms u0 rxrir oatlpDelnvi;s0trtmio ou1lm  mfctl(f 2tr(root4tpenmo3iyd a eanmp;(0 lxrmo tytop  anvi;(0 rur(opou4llen nct ()artauroot1tetoioeilsfm2em(mo u0 ltnir oodoptelieol(  rto(r3oodolenmnei s  2taur ;o1tlto ietlsfa uauvonu4arerio3oo1opDr u s (0srtoiopoydlpeelfviat)a2umumont1opto ieiytfa2uau o;(4artnxrcoa1om rlivi;( sruoxmpoydom e nes (f rtax  ;u1aeto ociydls ul(vo;(0altnmf3totlaDe uei;s  eurxopny4omt lnvs t)artm(rp;t1apt  ictysfmDrmumpnt4 rtnxf tatfaDeau s;() rxrir iodop nmfcils)aDrr(mpoo0aex mociltfm rmn p;u4 lxnxo ta1la  ln s (0tetmir3oy4lptnlfcslt  2rmxrpot0oltnifeiytlm eauvpnu0 rtoiociadlm e nvils  2trxo3ny4omtnmfctl(  2tr(ro;o0aee if3tltlm2eanvs;t)altnxo ia1oaDrli olt0 rxrim iy4alen nviat)artaxront4oexnmictlslm2umu onu)alermo iadfa elueil(0 2uoxm3nu1omenlfeils  2ta(r nt4oeen icilt a ua(vp t)tetomr3ia1fateluvs;s0 2tmio iu4lmtnlnei sfsDtmx  ;o1opxnioetytlmDel( p ()artnmo3todla rauvs () rtr(r3iu4ol e ivil( a2rm(mo;u1tet moetytfsDrluvpn(0arermo3oydlmtelues;s srum(r nu4ame  fesa( srtau pou1opxomi3iydlm2ran p t0trenxocty1lmtr ivi;s0sruoirpiy1omenmietat  Dtax p;t4texo oetytla rlnmo;t4tlxrxfcoadlaDraivo () rtrxo io1ape lnet s  2rrxro;u4tptnii3taslm2elnvp u4alxomo3iatla rliesl( sexrxm3nodoptnmneiat sDur(mpoo0opx iieiat m uln s;t)arerio3oo1opDelues;t0srxrxmpiy1ape lfeiltf Draxr ;u0aptnmo3iydfs umums t0 lermf ta1op  lu s (0s2xrio3iy4al n ncs s)srtaur oo0tlxnioctldlm uanvp (0areoxrcty1fpDr ieol( tetmirpno4amte nviasfsDua( onu4aetnif3iys m2rmuvpnt)alxnxf3iatoa rlnvo;t)t2toiopiu4am n nvt (fsrrrum oo1oex  feiysfsDuluvp () rxnio oodopteau ol() eurimpiy4altn nvia()a2urx p;t1texnmfcilslm el(vont4 lxoxr iadla elivils0t2xr(m oo4om elfctasfs2rmumpou4tpto i3tlt aDrauvp;u0 eeoir to1oaD au o;()trur(m3nu1ol  mncsls a2tmxm ot4aeenifciasfm uluvs t)trtriocoadopD livs ( trxo(o iu1llt mfcsls  rrm( o;u4tpxnmociyd aDuln onu) etrxo tytfpDeai i;s0sexm(o nodllt  icilsfa2umurono0tpxn oeild mDumums;u) etoxoctydoptranvi;s0 2uo(r oodamen iesatf 2tmumo;o0olto fctas aDemnmo (0tltoxr oo1fmD aivi ( texm(r io1amtemfcta(f 2rmxmp;o1apx mi3iydfa2umn p u0aexomf3ia1fpD  uei t t2uoxmpny1ap   fei s s2rmu  no0oet  o3tad m ulnmp ()tleoxrciydfptrlivol() rurxr3iy1omtemfetltfa2uru p;u1olxo o3ild mDelnvs;t0tltoir oydomt  i i s  2umim3nodalt  nvta() Duax o;t1texnmoetydls2ulnvs;t0teeoxo3ta1lp   u o ()s2toxm3oodalt  ivil()sDurur ;t0oetn ocias mDem( o;()artrifctatoa r n s;() 2urir3iu1omenmnvi t aDuaumpnu4tlenifciatfa2emumon(0 ltoif iatlpteanvo ( trtmio iodop emfetas) 2tr(mpnt4opxnifeiys m rlu s;t0 rxrxf ootfpD  i o;s trxo(r3iy4om elicil() rtaxrpou4apenifeiadlsDemn s ()trtnxociy1fptrln s;(0t2tmio iodllen icsat)srtr(ront0oexnmi3tldlmDemnms (0 rxoircty1oaDe uvi;( tetm(opoy4lp nlnes (f 2rru o;o1oetnmfctltla2elu p;() exoirctytopte uvs s) 2xmim3ou4ap  lnvi s a2urx pno1apto iciydla umnmon()alenmr3oa1fpDraieslt)srurimpiy4amee fetas  Drr( ont1aee  ociatfmDea( s;t0texnxo io1fmD lnes;(0s2ur(m oy4opeelicils) rrm(ront1alxomicils a2umn s u4 lenxf3tadfmDe i s (0srtm(opiy1ape mivil(fa2umx  ou0tpxoii3iytla rmn pnu0artrmf3todfptrlneo;t srurxm3no1lltnmneiat)aDumu p;o1apxn fcilsla rmn s;t0trxnxr iytfptrluesl() rtoxm io1ol   ncsltfa2uau p;t4opx mi3iad a ean p;t)alenxf ty1latrlneslt trxr(rpny4lp  mfvsls)aDtaum ;t1teenmo3iysla rlnmpnu4treoxf3iodfmD luvi;t0 2urxmpou4al   icsatfa2tmumpnu4aeeomo3tysfsDuan s;u4trxrif oadlaD  nvsl(0t2xmxmpio4aptnlfetl()aDrmx  oo1aetoio3ild sDua( s;(4tleoif3oo1lmtraivo;() rtoio3nodapt lietat a2raur no0aet  f3iltfm ran pnu0trtoxrciodlp e u i;s teuriopoo4ol nlfes t arurx p;t0tptomietlt m2ea(vp;u0arenmf oytlaD an o t srurxo oo4apeemiet tfaDtr(  ;o0oee  o3iys a ua(vonu0arxomo3ty1lpD  ueols)t2tr(r3iudllee ies () 2rr( p;u0apx  f3iad sDelnmont4texnxo to1fmtr uvsl()setrxmpiydlp nlneiasfa2taxmpnt0aexnmfciatfs rau on(0tlxoxocto1lpt aivi t)t2uo(o3io4lmt  nei ()aDtrur ;u0opxn f3tysls2eauvp;u0 rtomo tatfm   i olt0texrxm3oodaptemnvils a2ur( p;t4aeeomf3iltfs eluvs (0trxrmocia1oaDean s t) 2tmir oo4apee neia() ruaumoou0open feiltla2um(vonu) lxrio tadoate ieo t t2xmxopiodap nmfvtltf 2ra(ro;t1tptomfetatlmDuluvonu)tetrmocoatopt lnvols srumirpio1oltelivtas) rrr( onu1tlen fciys aDemu o;()arenmo3iadopteln ols) 2xoxrpou1op   neta(faDtr(monu4opxoifeiytls umu snu0 exrmrcoodoptrluei;s srtrxr3iydllee nvsl(f 2ur(rpoo4tlenmo3tltfsDuau snu4arxrif iy1latrlnvsl()t2xmxopoo4apeelfcslt sDta( pnu4opt mfeiatlm um( o (4tltoir3oy1oat auvo t) ruoirpoo1lltn ieilt aDtm(r nu4teto i3tldla uaumo (0 exoxo3ootlmtr neil(  2uoxrpoy4ll emivtlsfa2rrumoot0aetnif3ilsfm uluvs;(4 ltrmfcoytfmD  i o;t s2tr(o3nu4ll   fei s aDum(ront0olen o3tatfa2ranvon()trtoifcoydla raies () exr(m3iudll nliesat aDtm(m no4oet miciltla2um(vp u0 lxrifcoadlmt lueo s) 2umxmpoydamt  nei tfarum( p;t4optomictldfmDea(vp;t4texnmr3ty1fatrai ol(0t2urimpnudlpeemieil() 2uax p;t4apeoiociasfmDrl(ms t) exnxr ia1fat luvs;t) 2toxopio1alte ics sfarur(m nu1apxnmicildfs2em( snt) lermociodom eaieo;s) 2um(mpoy4altn nei s srumuro;o0oetnmi3tls m2uan snu0tltrir iotlmtranvs;(  rtoxo iy1op nmiciatfs2rm(m ;t0olx  i3iytls umumont4 lxoir tadopD  uvol( t2trxmpno1ape  ies ()sDumxro;t0aetnioeildfa2um(vs t4 eerio3oytomDe u o s  2xmxr ou1al nlicta() Dtru onu1teen f3tyd s2ran ont)tetoifctytoa eli ols) rtr(m iy1om elfvsltfsrumx ono1aptoioetldlm rl(von(0 renmf3ta1oa  aivs (0trtmxmpiu4ap nliesat) 2um(m ou0alto o3iasfm uaums (0tleomf3ta1op eliei;t  rto(m3iudllen ieils)arurxrpnt4tpe  oetls m uln p;t4 rtrxociatlatrlnvs;t  euoimpio1alt mfeil(  2tr(  ou4open fetls a rlnvp t0trxnif tadlatraivo;s0 eumio3nudll  lfvtas) 2taxr oo0alt io3iydfaDraums t4 eermr3iydopDrlueo t0 rumiopnydameelfet t) 2trxrp;o0ole iietasfa2el(mo (0 exomo iadfa rlnvol() eum(o3oy4al nlnviatf Dur( p;o4aetnmiciyd a2emump t) lxnxo3iy1opDeanvs s  etmxo io4ale  ivsl(fs2rrxm ;u4tlxn ocilslsDuln snt4 rtrmociy1fp rluvo;t0 exoir3ny1op emncsl()sDtaumo;t4ole if3tatfs2ulnmo (4treoif3tadfat au i;( s2xoim3iydale lfcia(f Dua(r nu0oeen fctytfmDea(mo;t) leomoctadfm rlivo;s)setr(r3oydll nlfvta()s2rmumpno0tptoii3ilsla2ea( pnt4 eenmf3iodom rlneil(0srurxo oudap emfetltf Drmx ooo1aexnmoeils a2rl(vs;(0alxomf3oytfptrliei;t0t2to(m3nu4omtnlfeiltf Drr(mp;t4ale iictyd m2rm( p u0teeoxo3iatomtrlnvils0trtm(m oy1opt lieilt sDtrxrpoo0texnifctasla2ua( p;(4artoxo3iatfatr uvs s)s2um(opnydol e net (fs2rau pou4tlxomf3iasfaDumu pnt0 lermociydopDr neils  2uo(rpoudlpenmieilsfa2tax oou0oeeoiictad a2ra( onu)texoxo3oo1lpt  u s t  etm(r io4ole  iesa(  2ua(ro;u1apxnmi3tysls2ran sn(0texoioctodlmDe nvo t0t2tmxm3ny1opte net t  Dumu  ot1tpxnmo3ildfm emn o ()arxrmfctatla  luvo;t0sruoiopiu1lltemietls) rtrx  ot1tptnif3iadlm ranvs;t0arxnxr oadoaD aivi t0t2xoio iy1ll  mfcs s  rtrxm nu1tleoii3iyslmDulu s;u0teerxf3iadlaD aivi;s)srurxm3iodopt lncsl(f 2trumpoo4opxnmf3tls m rmnmo u4 rxnmrciytfmtr i sl()teuoxm ny1al e fvsasfartrumooo4tlt iociatfa el(mon(4 lerif3todoaDranvil(  rxr(o oo4omenlnvt ( aDtr(monu1oetniociad s umumpnu4aexriocio1opDeanes s)srxo(opnydomt mnei s) 2ra(root1opxn ieiytfa el(vs t0 reoxrciadfmteanes (0s2xoimpiodolt lfeiasfsrra( pot1tpxniictlslmDrmu s;u0 exnxf3iatfptrlnesl(0setr(opny4lp elivi sfs2ur( oot4aptnmoetad mDuan snu)aexnif iadlp r nei ( sruo(rpou1olen nciltfartmu  no0apenifctldfaDulnvsnt4aeenif ootom rliei () rxm(opiudaptn nctlsfa2uaxmpot0oltoioeils m ra(mpnu) reoif todfp  an i;t) rxm(mpny4lltn ieta( sDra(m nu1apx  o3ias sDrl( p (0tlxomfcoy1lpD luei (  etoim oo1omt lieia( sDrmumpot0opxn ietls sDraumpnu0trtrifcoatlm rlnvsls)t2xrxo3iu4ol  mnes t s2uaxmp;o1optnifciasfm elumpn()trtnmf3tytlmtean s;(0s2tr(opiudam e nci sfa2rau  ;o4aptnmoetldla2rauvo u) exomfctadfateaieo;s) 2xrimpou1apenmietatfa2raxmp;t1aetoiieiaslaDuau p;(4aeerxf3to1optrlu s;t)s2to(rpno4lle lfci ( artaxrpnt4tlxoifetadlmDem(vp t4aetrmociodoaD ln s;t) euriopnu1omenlfct tfsrrru  ot1apt mf3iatfs elnvsnt4tlenircoa1lat auvi t)srxmiopoy1op  lfesls)aDumxm ot0altomi3taslm ea( pnu) lxriocoa1oaDeanei (0setrxrpoy4altn fcil( sDurumpnt4tpxnmictasla elu pnt0 lxnif3ia1fp r uvo;s)s2xo(r3ou1ll nmfvtat) 2ta( pot1oee  fciaslm umuvsn(0 eenif3iy1fmD  ivsls)srumxm3oo4lmee icias)aDuaump;t0tlt mi3tldfsDea( p u0altnxo tydlpteau s s)trumxm nu1lm   ivi (f 2ua(ront4tptoifetlsfs rl(mp;(4aeermr oo1opDeli o;(0texmxmpoo4opeemnes tf Dra(rpou0oeenif3tysfs rmn o;(4 lenxocta1optrluvs s)srumxrpiydamte netltfa2rm(mpoo1alt ii3iytla elumon() rxrxrciodfm rauei s)trtrxm3io4aleemictl(fa2rmurp;u0aexomi3ilt m2el(mo u)altoirciatfmtrli i;s  rxm(m nodole lietl(fsDraurpoo0aetn ictldfm2ea(mp;t4aetoif3ia1lptr u i (  rxrxr3iu1omenmfcilt) 2rm(mp;o4open feiltfa el(vo;(0arxomfcta1fm raivo (0truo(m3oy1lptnmicsltfartr( poo4tlxo fciysls2rl(vo;t)trxnmrciadfmtrluei s  rxrim iodom nlicilt)aDtmxr no4ale  i3iad sDelnmp;(0teerir iy1opD anvs t)t2trxrpiydlm  liei (  Drau  ou1texomociad m2emu o;u4 rxoir3iotlateluei s)s2tmio ny1ol  lietlt  Draumo;t0altnmo3iysla em( p t4aexnxfctadfm elnei ( s2tmxm3ny1altelncs s a2urump;u4tlt moetydlaDeanmp t4tltoxo3iytlaDr nes;s s2xr(opiu1lpte feils  2tm( o;o1apenmfctatlaDrau on()areomr3oatfaDr ivs s) rtrxrpoy4openlicsls)s2ururpot4tpenmfetldlmDemums;u4 rtrxrctytlaDrai i;(0 2trirpoy1lp   nvi () Drrx poo4aeeoiictadla2um( p u4aeeoif oydomDean slt) rtoxmpny4opee ivt ()arumurpou4texnmi3tlsla2raums;()arenmf iy1omDrlivols)t2trim nodol  lneia()sDtrurpno1optnmoetadlaDul( p;t4tlxniocoo1opDelivils)t2toxr3nu1lm n fvsls  Dtaxm nu1open ieiadla2uln s;t4 ltoxo tydfaDeauvi t)srxm(m3oudlpt mnvil(fartaur ;u0oexo oeilt sDua(mpnt)trxrxo3ty1fa r uvi t0texrim3nydap n nvsa(farum(m ;u4aet mo3ilt a2rl(vp;(0artoir3todlmD  ieo (0 2urio3iu1lmee fci tfs2rm(mpot0tetnmoetad s umnvp;(0tetrmrctytfpD aueols) exo(r3iydlp  miciat)s2ta(mpno4openiocilsfm rmuvo u4 rtoirciatlpD aivilt0t2xrxm3oudape lfvi tfsDraxrpot4tpeniictlsfmDem( p (4trxrmfcto1fm  ln o s0 2xr(mpio4lp nlnesas)s2rr(root4openiociyd m rmnvont) rxrmo iatomteanei t)sexr(m ou1lme mfeils aDrr(monu1texoiicildfaDuauvp;(0alxrio ootfpt ai o t0srto(m3no4oltnlnvia(fsDrmxr ou1tlto ociltfs2ua(ms;t4 ltrmf iodfm r ies ()t2uoio io1amtnlfei (faDtmum oo0aleomf3iys mDuan ont4tetrxo3ia1fmteauesl(0srxrir ou4omtelnviltfs2uax  ;u1oexo octydlm rm( pn(0 eerxf to1la   neolt srur(opiu4amtemneia()artaxmpoo4ale ifciltfa2um( sn()trxnxr3ia1fmtranvi;( texmim iy4llee fvs tfa2rr(rpnt4tpe ii3tydfm2rm(vo t) lxomrctytomDrlneolt t2uoimpoodlm nlivi s) Dtru pnt1opx  oeiad sDumnms;u0trerifcio1fmDr i i;()s2um(rpny1ole mfvsl(fsrur(moot0tex ioeiadfm2elnms (4aexomf3ta1lpDr nes s) 2urio3oo1apeelfcilt  rraxmpno4opx mfciydfa em( o () leoxr3oodoatraiei () euoir ny4al nlnes s) rumx ooo1apt mf3iatfsDua( onu0teenxo3to1fmD  uvs s t2tmxm nu1opt lfcilt a2tm(r ou0aetnii3tyd s2umuvsnt4aexomociytoa eauvo;( t2toxmpiy4ope mictlt  2taxro;t1apxn oeiadlmDra( s u)alermocto1la r neo (0s2uo(mpiodlle lnvsasf Dtrxmonu0opxnio3iasfa2rln o;t4 leoif3iatlaDrlueo;() eurimpoydoltemiei t)aDrm(r ;o1tex iociysfm raump t0 eerifcta1fa raiei;t0trurxm no1lm   ncslt  2tau poo4tpe iictlt s2ul(vsnt0tetnxo3ootomte i o (0seum(rpoudlmee nct t s2tmumooo1oeen o3iyt aDelums ()aetrir3ta1fa   ueilt s2umxrpiy1openmnvsa(fa2rr(r ou0oeeo ieiyd aDrm(msnu0aetrxo oodoaDeln s s)trurxr3oodal e ictatf Dtm(mont0oet mfciysla2um( s;(0 lxnxr oo1latelieo ( srxmxmpiy4alenlics tf Dta(  no1opxnmoetydfa rmu o t4 rxrmf ty1fa rlnvs;s0trtrio3oy1olt mncilsf 2ra(r ou0tltomfciasfs ulnvpn(0tlxrxr tatomtr nei s texrir nu1amtelnetlt srua(mpnu1apxo fetad aDran snt)teenir oydoaDrlu ilt) 2xmim oy1lp elivsls) Dra(mpoo1tle  o3tyslaDrmnvs () rtrmr to1omteluvi ()seum(m3ny1lle lfetatfs2rruro;o0tpxnif3iytfsDua( sn(0artrxr3iodlat ln i;s texm(opoo1amt lnet ( a2raum nu1tetomoctltfsDrl(vs t)artrmf3oytlmte ivo;(0sexr(r nu1opee ieiltfaDumuro;o0aleo f3iltfs umnvpnt4 exrxoctotopte ivi;t truo(o3iy1llenmictat s2tr(rpoo0oex ifeiydla ean o u)tltrmo3oatfm   nei t) etmxmpny1amte ietasfaDrr(mo;t1oee ifeias m emnvo;(4arxriocoydfp r n i s0 rxmxrpno1op   feils)a2rr(moou4aex mo3iydfm2rl(mp t0aetoifciodoptrauei t0t2trxopny4ll nliet s) rtmuro;t4oexomo3iaslmDra(mon() leoxf3tadfpt au o t)trtmim3io1llt mivtlsfsDurumo;u4open f3iys a rmn p;u0 lxrir3tadopDr ues;(0 rxoxmpiy1alte icta( arta(r nt1tpx mfeiadlm rlnmo t4trxoxociy1om elues s0 2tmxmpoodalen nvsltfa2ur(rpno1oleo oeiasfsDuaumo (4tetrmo3iadopt  ueo s)trxm(opnydol emnctat  Dtrx oou0aexomoetldfmDua(vs;u4arxnxrciy1fpt aieo s0 2xm(o3iu1alenlnvsltfsrrrxm ou4opx ifetatlmDranmp;t4alxrmr oytlp eanvi;t0 rxo(r nu4ll emfetls  rur(  ot4oetnioetytfa2rln p t0tlenmr oodom  anvols0trxrxmpiy1lp e nes s)arumu pnu0texoifeilslsDra( p u)texrxfcta1omtran s t trumxo nydop   fvtl(f rta(  no1oexomi3iad m uaump;t) etrxf3totoa rlu s;( sruo(r iu1lptemfct ()aDumu pno4tlxnmfetasla ulumpnu4 eermf tatlmtr i s;t0trurxopoo4ap n neslsf rrmump;o0aleomi3iyd a emuvsnt4aexnmf3tatom elues s0texoxm3oo4am nlfei ()srrax pno1aexo ietydfa2emnms (4aetnxr iydlaDe neil( sexo(m3oydapt mfesa(fsrra(rpoo1altn oeiat s rluvs t0 renmf oatfpt  nvi;t) 2tm(o3iy1apt livt t)s2ua(moou1apxomiciysfmDum( sn(4treoio iydoat  n il() rxrim3nydlpeelfeia(fs2tmumoot1apx  o3tytfaDem(von()altoxr tytoa  livo;s0setm(mpnydal e ict t)s2tmu o;u1tlt  ictlslm umuvp;(4arxrir iotlmtrau sl()s2tmxr3oy1om nlietlt)sDtrxr ot4opto o3iatla ran pn() ltomo3tatfaD lies s)trur(r oudomt lfcs () Dur(moot1aetn f3ilt a2rm( on()altoifctytlateluvils0 exo(m3ny4olt lncta()arrm(  nu0aeenifctatfm2rmn o;u)alenxf3tatlmDeauei;t trto(o3iudoltn fcslt)arur(root0texnmieiytfaDem(vo;u)tltrmrcoy1omtran o;t0srxo(r3ou4ol  lfvil() Dumumpoo1olxnmfctld m2ra( p u0 eenmo tydomtrluvs ()srxr(opoy1omtemnes tfsrurur ;o0oetoii3tytla ean snt0 renxfcootlp   ivol( t2uoio3ny4lptemnvilt)srumum ou4aptnif3iltfm ul( snt0altrif tadlaDelu o;t0tetm(mpnu4llt miei t)s2taxront1tex  f3tldfm2emu p;u0texnxrciytlaDe ueo;s sexrirpoudlm emfcil()aDtm(mpot0aet ii3iytfm rlnmp;u4arerio3iodop e uvil(0 exm(o3oy1am n fesl( a2rmur no0tpxomf3ilsfsDua(mo u0 exoif3iydop r uei;s) 2uo(opou4altelncs sfarum(rpoo1aexoiieils mDumuvs ()altrxrcoytfp rau ol(0sexrio iodalee ivi t  Dtaum nu0apen ietytla2ea( onu4alxnmfcoodlp   nvslt)trumir oo4lltnmivs t)aDraxrpot1tetniiciys s rlnmp u4trxrxo io1laD  ueilt0s2trim oydap e ivtls) Dtaurpot1oeto ietad mDrl( p (4arxnmr3iytoptr i s;s)srxm(mpno1omenlnvt sf 2taumono0alx if3iydfs2emnmo;u)texomr3iotlp eluvi;(0srtrio nu1op emicsat  rtm(moot1tlx ifeiltfsDua(von(4 leomr iy1fm e nvs;( trurxr iu1lle mietlt) 2raumpnu4texoioeils mDum(msnu0arenxr3iytomtrlneil()sexmxopou1lleemivtas  rtmumo;t4alxoiieiytfs ea(ms;() rerxo3iodomDeauvo;(0tetoio3ou4alen fvsasfsDrm( oou0oetnmoeiytfsDel( s;() renxr3oo1lp rlieolt truo(o3oy1lp  livi s  2rmu onu0tlxo o3iydlaDrmnvp;u4texrxo to1lp rauei;( sruoxo3oo1altnlfcs ( a2tmx pot0teenifetltfa2eanmont0 rtrmr3totfmDe ivslt setmxrpoy1lptn nvt tfs2rm(ro;u1aex mfciltlm umuvpnt) eeoir totomteln ilt0truoirpno1olt  feta( sDtmur nt1tetnmiciatfs um( p u4trxrmr3tatopD  u ilt0truoim3oydoltelnvs tfa2uax  ;u1alxn oeiasla eauvo;()tltnif3totlatranvs;s)s2uoxo3nu4oltnlfcsatfsrrrur ;u1tex moeils sDeluvp u) eenif3oy1lp eau olt0 rxoxrpio1oltelnesas)aruaur nu4tlxomi3iysls2eluvp;(4tltoxfciy1fmD  u s;s) etoxopoodalt lfct s)srtrx  oo4tlxnmoeiasfaDulumo;()teenxfciotlmDrlu i ( sexrxm no4am e nvtlsfsDuax  ot1tlx  feiadlm2eanmp t)tltoxr3iadlp eaieol(0s2trxr3iodlle  fcs (farurxrpot1aee ioctat s2el(vo (4 rtomfcoy1lm r nei;t texrir3oy1ape  nei sfaDta( ono1aet moctadfm umuvo;t)artoif tytop ranvilt) rtrxr3ou4aptemfcias)sDtr(  ;t0ole  fciysls ua( o;t4 eerxociotlatrau i;s  rxm(rpiu1lp e fcsas sDuauroot4tle  o3tadlsDulumpn() etomo totom  lu o s  2urxrpiudolee ivtasf rua(r ;o1teeniociaslsDemuvp;u)tltnif oydlateln ils)t2uoim3io1ope  nesltfa2ur(mpnt0oetn oetydfs ulu s;() reoxr totla eanvsls)s2xr(m3oo1optemivi s  rra(m nu1aexniociyslm emnmp (4arenif3ia1fp r i sl()teurxr ou4amtnmneiat) rra( pnt4tpt mf3iaslaDuauvs;(0arxoir3tytfmDraiei ( srxr(r3nu1lpe  ivt t) 2uaxm ;u4tpx ifeilsfmDelu onu)trxrmo iotfpD  u i;s  eum(mpiu4lltemnvs ()aDurxmooo0olt io3iyd s ulnms (0aetoio ta1fa rlues t0 etoirpoydom e nvtat)arrmumpot0apxoii3ildfmDra( on()trtnxfcoa1opD an ils0truo(o oo1llt lfvslsfsDrmx ono4aleoiietldfs2uanmo (0trxrio3tatfp  luvs;(  eto(rpnydoltnlieilsfs2um(m ;u0tlxnmiciasfm umuvs (4teeoxf ia1op r n o t0tetoxm iudameelicsa(  Dtrum nu4tle mieiysfa2rauvont4trxnxo3oy1fmD  nvolt0s2xoxrpou4am  mietat)aDumu p;u4tltoiiciyd s ulnms;(4arenxfctydoatr ueols0 euoim3nodamte fciatfs2tm( pot4oetnmf3iyd a2elu o;(4 rtnxf3iytoa  li i;t)s2tm(r3ou1op n fct t aDur(r ot4tptnii3tldfs2rau onu)artnifciydlm rlueols) ruoxr3ou1olee ivsl(farraur oo0tptnmf3iadfa ea( on() rxoiociodfa  an i;s0trtrio3iu1optn ncilt)srtmu o;o4oet iieiltfa2rmn p t0 ltoxf3ta1fm rluvs;()s2tmim3iodlptelneilt s2rrxmont4oeenmfetat s ul(vs;u4artoxf oa1oaD au o;( seurxo3nu1ol elnetlsfaDururpno4oexomoctydls2eln sn()tleomf3to1oa r nei (0seto(r3iy1ol e nctl( aDrruront4oleoif3iytls el(vo;u0trtrxf tadlp  aivi (0 etrim no4lmt mncia() Dtm(r ;o0apxn i3iaslaDemuvsnu0tetrir3ta1lmDrai o ()trxr(o ou1om emnvils artmxrooo1oeeomociasfs rl( pnt)alxnmo oy1lm r n s s sexo(mpiy1apeemnet ( srrmurp;u0oex io3ildlmDrmnvo (0treomocoydfaDraieils trur(mpno1open fcslsfartmxmp;o0aexn o3iad a ua( p;() ltrxf iotlmtrau slt0 rxoir3nudamt mict s  Dtr( oou4aex  oetaslm2rlnvon(4trermo tatomDeaueol(  2toio iydomen fetl()a2ta( poo1oexnioeiad a2elu o;u0tetomo3iatlpt anesls tetr(opiodlleemfvslt  Dur( pnt0tpeoif3ildlaDea( o;()tltrmocoytlpDrli o t trxrxr nydlmte
\ No newline at end of file
@@ -0,0 +1 @@
+nvilt srum(rpoo1al  lfvsasf 2rmu ont0teen i3tasls2el(vo;()tlerxo oytfpDe neo s s2to(o3nudll   ictas s2rrur no1alx if3iad s uanmpnu0teeoxocio1fp rlu olt  rto(r oy4lpeelnet sf rumx  no1oexn iciltfaDean p t0trerxf3iydfa   i s;s0t2umio3no4aptelncs s)aDrrxroou4tpt  fetytls2ra(vp;t)aeeomfcoatfmD  i sls  rto(opnu4olt  netls) Dumuront1tpt moeiysla2rmnvp;() etoir ia1faDr ivo t) 2toxmpoy4lpt mfetl() 2rmumoot1tpt mfciatfa2ra( o;(0teermf ta1lpt  i ils  rxmio nydap nmncslt aDtrur ou4texnmo3tldlaDulump t0tltnxfcoydlpDe u i ( srxr(rpiy1openlnes ()aDrr(  nt0oeenioctasla2rm( s;t)areoxfcia1omteaivils0seum(o iydlptnlivia(  2urum ;t0apx ioeildla2ra(vp (0 etomr3oatla e ivi;( seuoxm oudap e fetatfaDrm(ront4alxo octadfm2rm(mp;(4tltoioctydoaD lues (0seurio oudolenlfvtl( srrau  ;o4ale io3ils aDuanvp;t0aleoxoctydlat  n i;s  2xrxr3iudlmen ncils aruaur nt0apt iocildls2rm( ont0texomo tydopD li s;t)setoxrpoydaptemnvtltf 2ua(mo;u1aleomoeilsls ra( p;t4aleoiociadfp  au o (  rtrxm3ou1opte icias sruru  ;o1alx moeiyslm ranmp;(0artrir3ootfp ranvi () etrxo3oudol  lncias)a2ua( o;u1opt mictldfa2rauvo;t0 ltrxo iy1laD  ueol()seur(r3iydamt  fes s  Drru  ou1alxo oeiydfmDem( ont4 ltnmf3iy1opDrai s;t0srurirpoy1optnlfetl()srtauronu1oexnmietyt s2rauvo;u)alxrifcto1lmDeai s t)setr(rpny4amtnlictlsf Dum( p;u0olxnmi3iytfm ulnmp;t4alenmocoydom r ieol() 2umirpnu4al nlfcsasfsDumxroou1ape moeilt m umuvpnu4 ltnio iadfaD au ilt)trumio3no1openlieiat)s2tm(  oo0aet moetas a2umnvs u)alxoxrcta1optrlues s0 exmio ny1ome  ncsat s2tmxmont4aee ioetad sDum(mpn(4 exoir oodlat liesl(  2xr(o3ou1ole mnvs sfaDur( pou1apx  feilsfs2rln p u4alxrmo3iytom rlu i t0srum(o3iy4lmeemfeta(fs2tax  nu0aexomietldlsDrluvo u0trtnifcia1la rlnvo;s  etmxm3oo1lptelneia(fsrua(mp;t1olxo f3tlsla ua( p;()altrmo3tytopD  uvsls s2urxr oy1lmtnmfetat s2ra(r ;t4oltn ictyslm emuvs (0aleoio3ty1opDraneilt0texoxo nudam e ivtltfa2tm(moot1tleomieiat s2emnmo u)aetrmo3oydoa raivolt0t2xo(rpnudlpenlicias)s2umurp;u1oee mieiatfa rlnmont0altnxr to1lm  livil(0t2umim3io1llee nvtat)s2tr(ro;u0altoiiciydlaDeanvs u)arxoxfciadlate i ils0 exoiopiy4oltn fvils a2taxr ;u0tex ifeiatfa2eluvs;(0 exoxf io1oateauvi ()t2xm(m oodopenlies ( aDumurooo4ape miciasfa rln o (4aetnxfciodomtrlneolt0srtoimpnodlme mnct sfsDtrxmpnt4altnmfeiys sDrlu pnt)tlxrmr3iy1fpDelu ils0sruo(r nydom   iesl()sDrrumpnu4oltomoeiat mDulnmp (0 rerxoctydoa eai o s  rxrxmpio1amte nvsa()arua(rpno4altoiieildls2uanmp;t4aexnmociotfmt  nvs ( t2umir3iudam emnesltf rra(  ;t1tlen o3ias a2rm(vp (0aeerxf tydlaDeanvs s0 2xr(mpoy1om   ieiat a2uax  ;u4oltoii3tyt sDean s;t4tlxrxr3oytlpDr ueols trto(o3iu4oleemiet ( aDum(ronu0ope ifcias sDul(vsnu0aeeoxf3oydlpt lueo;t) rtoxr oy4am nmnvsls)srtm(mp;o0ope  o3tld a ul(mp;()aexrxf3oa1oaD  iei;t) 2xoio io1ape  nvil()sDrrurp;u4tpt ifeiyslm2uauvp;u) lxrmocoodlpDe u s t  2xrxm io4lpt  ivs t)artrumpoo1alx ii3iyt s eanvont4teerif oatlmtelneo (  2uoxo iy4apenmiciltfsDtrumpou4alx  o3tatlsDuau p;t) lenxf3oodoat lnvi ( setrimpiydopt lfvsls sDtr(r ;u1tpx mfeiltlm2ran p;()texrircoo1lmD  neols) rtrirpny4al  mnctls) Dtmu  no4aeen ocils sDrm(von(4tetoxrctadlp  au o;() exrxrpnu4al emivtas a2rm( ono0tptomociyslm2ua(mo;(4altrio3ta1op eai s t t2xo(o oudam emiesa(faDuax poo1ale mfcilsfs ran snu)altoxrcootfp e n ilt)setm(r3nudaltnlfvsas)aDrax onu0opxo i3ils aDranvonu4tltnio oodom  luvi;s) eur(rpnydaptemfctls  Dtauroot0tetnmoctas m el(vo;()tltoio3ta1faDr ieols s2umio ny1omeemfvt ( artr(moot4oeeomieiatfm2eau s (4 lxoxo tadlatraivs;() 2tr(m3nydlm nlicsat)a2umxronu0tlx mo3tlt sDemnms;u)arenmr iytoaD  nvs (0sexrxm oy4om nmnvslsfsDrmxmoou4optoio3iytfm2elumpnu0 rerxo3oodlateln i;t0trtrio3oo4lm nlfeiltf 2uau  ;t4tleo oeiadfm uauvo;t)altrio totlp rlnvs t) 2uoxm iu1lpt  ivsl(fsDta(ronu4tex mi3tltfm umn pnu)alxrmrctydfate i i;t0 rxo(mpoy4lp   fcta(  rraxront0teeomfctasfmDul(vo;t0 rxrmf ty1fmtr n sls t2xm(rpiu4omtelfct ()sDum( ooo0texnioeiadfs rau o;(4 lxrmf iatom  liei s0teurxmpny4al  mfctltf rra(mpnu1apenmfctatlm rlnvo t)texnmrcta1lp  aieo s teurio iy4lmen feslt)a2trum ;u0aeeoii3iysfm elnmonu4 etoio3iatfpteli sl()t2to(rpny1omt mietas) Draum no1tet  ictatls2rln p t4trtoif tadlmDrliei (0s2urxr oo4op  lfvi (  Duaumpnu1aet  ieiasfm umump;u0tltoiociy1omDrliei t)s2um(opio1olenlivs (fsDrr(  ;t1apxoiieildfa2el( ont4 rerir3iodlaDelivsls0 etoxr oo1lptemietasf Dta(  no1teeo ieiadlm umuvo u0alxnxrciydomDrln s (0trxo(r no4ope mfesa(fa2ta(m nt0oltomo3tls a2el( o ()altoxrcto1lpt aivsls) rxo(opoudlp  mivt tf Dumu  ou0ole if3tytfaDrlu p u0teerxf3iytop raivols trtrir ny4ame mnvtlt)a2tmxrono1oex mi3iytlsDua(mp u0trxoio3todla eanvilt t2xr(rpny1altelfciatfarum(m ;t0olxnmi3iydfa uanmsnu0aetomo3oy1fatr ieo;s0srtmxm3oy1lpenmictltfsrtrx o;t1tpeomoctysls eanvs;(0tlerifctatla  lieols sexr(r nu1llee fes tfaDrmxmooo1tpx ioetasfm2umump;(4 rtnxo to1laDr ivols0t2umxmpno4lmtelieias)artaxrp;t4oltoifctld m ran s;(0 lxrio3oatlpDr ies;s  rtmxm oy4alen net t)srra(m nu0aetn fctls s uaumsn(0 ltoir oo1faDelu s;s0tetoir3oy1lm e nci ()a2tau o;u4aleniieildfa2umnvonu0aexrxrcoytfaDe ieol() exrxr iudalenmiei (fartmx o;t0alxn o3iyslm2rl(vs t4trermr3tytopte n i t)t2uoxr no1lptnlnvs s)aDrmumono4oltniieils mDem( sn(0 rxomr3io1oatelueols texoxo ny1om emfviat a2ra(rpou4altnif3tasfa ra( snt) ltrio3iadlptrlnes (0t2trxm oudal emfvtltf rtau p;u1opx iocildlm2rl(vs;()teeoir iy1fm raueols  2xrxr3io4lle livsas)a2rmx pot4tee iociydlmDua(vo;u4 etoir ia1lp eai ol(0 rtr(r oydapen nctlt  rra(m nu1tpeoiociltla2emnvs;t)tetoif3tydlmtraieo;t)t2to(m3nu4openlfcias a2rr(  ;o1oeen ieiatfs rlump t) reoir3iytla   nvo t)texmxrpoy4olen nvtat aDumx o;t1aexomfctas aDum(mpn(4 rtoir tatfp r nes;( texo(m iudapeemnvilt  Drmu ono1aptnmi3tatls2rm(ms t4aetnif3iatfmDelues;(0t2umio3io1lme  nvsat aDrmxmpnu4teenmoeiyslm2umumpn(0trerxf3oo1lptr u slt0t2to(mpnydamt livi s) ruauroot1tlxo fctltla2umnvs u)trenmrctydfpt lnvslt)t2xoxopou4optemfciat a2uaxrooo0opx iieiadlm rm(vsnu)trxrmfcia1faDe ueo ()t2urimpoodlpen fcs t)a2umxrpnt1apt  fcildlm2rl(vonu4alxoxo3ta1lpDranes ( t2trir3no1lmenlfeiltfarururo;o1aleomf3iadfa2uau o;(4 rtnmr iy1lmD lueslt)trxr(r no1lpen fetlsfartm(m nt1aeeoifeildlmDuauvpnt) rtrxr oatoateaneilt0 rxoxo oydoleelnvta( arumx ono0tlto o3iysfs2ran o u0artrxrcto1op e ivs;t  2trimpoodoleemnvi ()s2trxmonu0oltnii3iytfm em( p u4texrir tadlp eli i;()texmxo iy4am n fcsls)a2ururp;t0opxomf3iadlsDeau p u) reomr ty1lp eaivo ( teuo(rpiodomen neil( s2rmu oot4aeeoif3iydfa2ulnmsn(4alermrcty1fpte u o;(0texmim nu4lpeelicias s2urxm ou0aexn f3tyslmDrlu snt) rtnir3oatlaD lnvils0t2xm(o oydamee fcilt  ruaxm ot1ope mo3iyslaDra(vo ()arermfcoytlm elu o;(  rxrxm3no4ome lfvsls arra(m oo0teenmfeiytfm2umuvo;(4 ltoif oodlaDeln s;(  etr(o nu1ap n fct sf 2ta(mpot0tlxoiictadla2ul(vp;()altnir tytfmD anvi s0 exoir3ou4ol e fvtl(f Dtmuro;t0oex  ietlsfa ranmo t0 lxnmr3iytlptrlies t0 2xmio3oudlm nlivtasf Dtax p;o1apen f3tld mDrmuvs t4 exoio totfptranvo;s seumirpiu4am n fvs t arrmumpnt4ole iieiytls uanvonu)tetrio iy1lmtrauvi s0 etmir3nudap nmfct (fsrraumooo4aetniiciysfs uanmo (0 etnxr iydom  livo s trxr(o3oo1lltn fcilsfsDrrxr no0oltnmfciydlm rm(mp;t0 etnxr ia1lp r uvi;t0srtr(r3io1ameelneta(  2trx o;o0tpto fciysfs2ulnmo t4trxrmo3oo1lm ean s (0 2xmxrpoydlle lfcia( aDtaumpnt1aleoioeiydlmDum(mp;()tltoio iadfpDrluvs ()s2uo(m ny1lpe lneils aDtr( pou4oex ioeilsfm ranmp (0 rxrxociadfmtr iei ()seur(mpou1lpt  icsasf Dta(r oo4aexoifcild a rl( s;t4aetrmr3tatlmDean s;()s2xrio iu4alenmfcil(f rtau o;o4tet mociadfsDrlu pnu)treoxo3iy1oa ean s (0 exrxm3iodapte fvil()srtaur ;o0oleomieiad m2emumo;(0aexrio oy1fmt  u o t0t2urio3oydaleelfesat)sruaumo;u4aexn i3iyt a2ua(vo;(4teerifciodoa   uvs;(0 eurim3oodomenmictlt aDum( pot4aet mfctyt a eluvs;t4trenmr3oodfa rlu i;t)s2umxm3iu1apt  fvi s s2tmumono4apeo octyt s elumo (4 lxoxf oadlmDr u ils0 ruoir3nydomtnmncsasfsrtmu p;o0alx miciaslaDea(vpnu)trxrxf3to1op   ivo ( truoio3oydom nmncsasf 2rr(mo;t0oet  ociasls rau o t0 lxnmf iydlaD lnvi;(0s2urxo iodlp elictls arrmu  no4tle ifctatfa em( on(0alenmo3to1laDraues;t0seurim no1ol  lneias)sruau pot1opt mo3iatlm emnmonu4 lerxf3iy1lm   ieilt0 rxoxrpno1al emieilt) Dta(  ou0ape mf3iysfmDrl( ont4 rxnmf3iydoateauei;s)trxrim3oudlm n nctl( srtmum ou1olen fetldls2emumont) eerxfcoodoat  ivi s0 exoxr3oy4apee netlt  2trurp;t4aee mfcils a2umuvo ()texoifciodlp rln s t0s2toxrpou1om  lfvia(f Dtaxmpno1oetn i3tas m elump;u0trxrxr3iy1lp raieo;( texrir no1amt lnes t) Duru  ou4oltomfeiasls ranvpnu0alxniocoy1lmt lnes s0sexrxo3oo1amtn ivt ( a2rr(ro;u1texn ociad mDemumpnt0tltrxr3tydla elueil(0trumio3ny1op elnvilt  ruaurp;o1apto ieiad a2el(vo;u4 exniocoy1opt ai o;()srxoio3ny1amen ivtls)a2umum nt1tlx moeiasla2eanvont4alxrxo3iadlpt li olt srxrxm3oydol nlfetl(faruaumpoo4oex mietld mDulumsn()alxnxfcoo1op eli s s0 2xoiopiu4ol nmfeils)arrm(rpou0apxomfciadfs2rln snt)aexrio to1omD liei;t0srtoir nu4omen ies t aDra(root4olxoifeiltlaDeaumpn() lxoir ootfmte ivsl( srxoxrpou1ap  lietas artaum ou1tlt mieiltfs2ulnvsnt) etnxf iy1la r ivi;(0texoxrpou1lmtnliei t  Dumuroou4ope  ictadfsDua(vs (4alxrxo oydomt lu sl() rumxopnu1ll   ivi ()aDurx pnt0alt  oeiyslmDea(vsn(4alerxfcoadfatrlivs s0 etmimpoy4lpeemfcsltf rrm(ro;o0olen oetytfm2rmnms;() eerxr3iatfpteauvsl()sruo(opoo1llee ncs sf Dum(m ou0aetnifcildfaDrlnmpnu) etoio totomDr uei (0 2toio ou1omee fvt (f 2uau  ;o1aeeoio3ilsfs eln p (4teerir3ia1fp  au ol(0 rtmirpoo1alt mfvsasfs2umx pot1olto f3ildla2uaumpnu0 lxrmf3oa1fp r uvi;t srxm(o3nu1lle  fvt t  Drr(mp;t4tpt  ieild aDelnmon(4aetrmo3tatfptrlnvil(0trxoxo3no4ole  ict ( s2tmxr ;t0tpxnmo3tldlsDrmuvo;() lenmo tydlmD auvo t)setoim nu1ol nlnciatfsDtr(  ;o4optomi3iadfa rm(mo (4artoxr tytlpD lueo t)s2xm(rpno1al emiet t s2ra(rpot4tet  octyt a rm(vs;()tltoxr iotfmteau sl()t2xmxopny1ame  ivsa( sDtaurpnt0optnmo3ilsla2ea(vont0alermo iotlpDeaivslt0trtrxm iu1ll  mieslsfa2rrum nt4tpenmoetys sDra(vp u4 rtomfcoydom ranvi;t0s2ur(mpnodopen nvs t  Drrurpnu1tet  octasfmDul( pnu0trenircio1oat lnvsl(0s2trirpiodlmeelieta( sDtm(  ot4oetn f3tyt a2ean onu) etnir3ootomDranvslt  2umir iu1olte ncia()arrrxmonu0oee  fctat m2rl(mpnu0alxnif3iatlpD  ueils0t2xriopiu1lmenmnes ()srtax pnu0alxoioetad mDrl( p;(4artnif3oodfatrlivs;t0 2uoimpnu4lm n fcs t)a2trx  nu4oltomociat m uau snu)alerif ootlat  ieo (  exr(m3oo1ll  lies ( a2tr( ono4tleomietasfs2eluvpn(4 eenmo iytfmDelueo;( trxo(o3ny4oltemnesltfsDtrump;o4optnmf3iytls em(msnu) rxrmo to1lmD li ils0 2tmxr nu1olenlieil(  Dra(rpot0alx ifetlsls2ua(mo;t4 rxoifcto1fmt luvi s0 eurim nu1lpenlfetlsfa2rm(mo;o0ape ii3tytla umu pnt0 lermr3ootoatelu o;( srxrio3nu1op nlnctlt a2tmuro;u1apx  oetysfm emnmo;t)alxrifcta1lp elneolt  2trio no1omtemfesa()a2uaxm oo4tetomfetas a2rauvont4 exrxf3to1fatr uvi s s2trxo3iudllenlieiatf rrrx  nu4ale  iciyt mDrm(vp (4altomociodfmt an i t) eumimpnudalt mivtlt)s2rrxmpno4alxoioeilt s2rln s;(4tetrxfctodopteai i t0trumxo3iu1olee nesl(  rum( o;u4alto o3iat m rluvpn()tlxoxf ootlaDe nvo t0t2tr(o3nu1lltelicsls)a2rmur no4aeeomo3ildfa2rlums (4altrir to1oate u slt)srtrxr3nodlm e icta( sDrrumonu4olx ioetadls eluvo;(4tetrxoctydoaDe u s s)s2xoxm iu4optnlieiltfsDtrxroou4tpxn o3iydfa2rlnvs () rtnmo3oadfa r ivs;t0 euoxrpiu4op   ivi t)aDrm(m nu0alen o3iatls2umnvp (0trermr3oa1lp rauvils)trtmimpny4al nlnes tf Dumxrp;t0aet ioeiadfa2ra( s;t) rtnxfciydlpDe uvs;t  2trimpiy1ome mfes ( arrm(rpou4tpx ioctadlm2ra( o t) etrio oydlpD  ueolt setmxopiu1alt mfct tfa2uru onu1aexoiictad a eanmpnu0 renifcto1lmDelnvol()setrim no1oltnmfvsl()aDrau  ;o1aeto i3tltlm2rm( s;t0aexoirciy1laDe ieols0 rtoim iu1amt lneilt aDuax pnt0tpe  i3tldfs rln sn(0 lenxf3oatopt  ieo;()setmim3no4amtemfci tfarua(rpot1opeomi3tltla2ra( p (4tlxnir3totlm r uei (0 ruo(opiydamenmnvta()sDrmxm oo0apx  i3tat s2elumpnt4aeerxoctodlmtelnvs ( s2tmxo nu4olt mnetltf 2rr(mono4oeeoiictatla uaums;u0 exrio oatlmD lnvo;t0seuo(r iodam nmfvi (  2umxmont4oeeo ictatfs um(vo;t)tleoxociatomte ues;s0 2urxm3ny4apee nvs (farrr(rpnt4alenifetadlsDumump u0 eenircoadoat an ils trtr(o3iy4ame mfvta(fsrur( p;u4aex ifctltlmDeluvsnt0tetrxf iodomD anvslt0srtr(m3io4aptnmfvtas)a2tmur nu0optnifeiytlm uanmo;(4 rxnmo iatomt au ol(0srtoxm3nudopen ncsl()a2um(  nt1apt ioeilslmDuan o u0tlxnioctodla rlnvo (  2xo(o3io1lp n fviasf Dua( pot0olx  oetytlaDul(vs (0aeerxf3oytfmte nvo t0t2tmxo iu4llte icsls aDuauro;o4olx io3tat s rauvsn(4aleoio io1omtraieil(0 etm(m iydom  miesasf Dum(mpno1aexomieilsfa2ulu snt)trenio iydomDr ues (0 2xoxmpio4ome mieias srurxro;u0tpxo f3iydfa2um(von(4tleoio3iatopt  nes;s) 2umirpoy1om e fct ()a2uaxrono0oltnifctytlm2ean p;u0aeeoxfcto1lmtrai o;(0 ruoir3iu4lmtemnesl(f rur( ont1alxnmietytlm ul(msnt)texrir3iy1fmt anvils0srumimpoy4am nlieiat s2tmxr oo1aeeomoetaslsDulnmpnu) rxnxf3oadlm eli o ()teuoir3iudlltelicsas aDur(m ou0olt micild m2ranms;t4alerxo3iodlmDr n i;(0 2tmxrpiydoltemnvsas) 2um( poo0tpto o3tas a2rl(vp;u0treoxr tytom  lnvi;s) ruoxo iodolenmfcil() rum(roou4tpt mf3iydfs2elu snu0tetrmfctydop r uvs s srxoir oudlltnlfciat) 2tmx pno4tpeoiiciydfsDeluvpnu4 lerxrciadoatean sls) rurxo nudomenlnet (fs2urumoou4ope iocilt sDel( o;u4tltomo3tydoa  lnvol(  rum(o3ny4oleemfcsat srum(m ot0aexoii3tyd m rm( p;t0arxoxr3tatlp  anesl( srtmxmpno4alenmivil()arurx ooo1aexnmf3iyt a2emuvp;(4arermf oadoat  n o s  etrxm oydome mieil()a2rmxrpot4texo ietls sDelnvsnt4tlxoxf3oa1fm eaivi s  2toio3oodlp nmies (  rta(  ;u0aptnmociytfs rl(mo;t) exnio3ia1la   ivols s2toxr iy4altelnctas  Drr(m nu0tpt iiciadfs umn o;u4 rerir iotlmDe uvol( s2urxmpnudol  mnct ( a2taum ;t0oeenmi3tldfa2rlnmo u)aetoxrcta1lpD  nvolt)trum(o iodlm nlfcsl()artaxr nu4aptnifctas a2rlumsn(0artoxrcoy1oaDe i i;(0 2to(r ny1amte nvtat)sDuaxrpnt1tex ifetatfm ulnmo;t4aetoirciadop   ivi;()trxoxm nudopt mics s) 2umxmooo1aet mocils a el( p u0 ltnmfcoa1fmtrlivi;s)setoxopoodom elfct tf rrr(mpno4tpe miciadlsDranmsnu)aleomr3iatfate i o;t  rxrim3io1lp e ict () Duax oot4tlenmfetasls2umnvsn(4aexomfcoodlmteauei;s0 rxo(rpiodlm  mneslt) 2uaurpot1tetn oeiydfa emnvon(0aetnxoctodfaDr ieo s0t2xr(mpoydlpe lnvtls s2rm(mont0apxomfciydfm ea(vp;(0 lerxfctydfaD  u s;t  etrio iu4apeelnvta(fsrumxmp;u1olx  feildlm2ua( o;u) lenifciadoaDe ivo s)setrxo oodlpt liei s)sDuaxm ot0tptn ictlsla2ul(vs () exrircoodfa rlu i t tetrxm nu4olte fct s)s2trx onu0oltnmf3ilt aDumu on()tlerxociytlatelivsl(0srtr(rpnu4lpee ivtl()artaumoot4ale  ociltla2elu o u) lxoxf tadlm raieo;s)trto(o3iudol emnvs sfartmx o;t4ope  octytlaDrauvo t4trtoif tytlm  aivsl()texmxopiy1omte nvias)sDumumoot4tet ii3iytla uluvs u)tetomr oodlm ranvsl(0tetoxmpoo4omte feia(fsrur(mont1tpto feiadfa umnmpnu4tlenio3oadlmte i o;( sexm(r3oudapt lfei s a2ta(r ou0tpto feiytfaDemnvs t) exomociatlm raies;()teuo(rpnodom  mneils)s2uaumo;t0altomieiad a2emnmo u4 rermociodomDeluvs (0sexoir3nodll e fei t) 2urxront4aptoifctadfsDemuvo t0alerir ta1fatelnes;()trurxm3oy4al nlivsl()arumum ;t4aetniietas sDeln snt0aeermocoatfpDelnesls)s2xr(r nu4lltelicsasfa2rm(  nu4alxomoeiyd a rl(mp;(4 rtoioctatlmDe u i ( setrim iu1lm n ivsa(fsDuau ont0oee  octytfs2rl(ms t0artnio3ty1lptraivs ( sexr(o ny1ap n ietat artruro;u1oetomfctlsfm uanvp;u0 exrxo oydlpDeanvo s0 2ur(r3oy1ol e iesa()a2rrum no1aex moeiad s2eanvonu4aexnir tadfp r uvi ()trxr(opiu1ap   ics sfartru pnt4apenmfcild s2umn p t4altrmfcoydlmDelivi;s sexm(opnu1apeemfvtas arrax  ou0aee mf3tyslm umuvpnt) rtomr3iadfp  li sl()setrimpio1opee ivsls)artaur no0apeoiociatfm eauvs ()altnifciy1fpDraieo;s  exmxm no4omte net s a2tm( o;o0tpen feildls ul(vs t) etnxr io1opDrauvo;( srtmxo ou4lmeelfctat)srua(rpnt0oexniietysfmDemums;(4 lxomo ta1oa   nvil(0seum(rpiu1llen nvilsfsrtrxront4opeoiiciydfa2uan s;(0 lxnif3tytlmteai il(0srxr(opou4aleelicsatf rrm(  ;o0olt  o3tls a2eluvs;t4 rxrir tadom  ai o;s)t2trir3iu4apee fvtlt aruau  no0tlxomfciyslsDranvp;()artnmocty1laD  nvs s)t2xoio3iu4al elivilt)sDtr(mpoo0teeo o3iytfa2el(vo u0 exrmr3oydom rluvo;( t2xo(o3oo4om e ics tfaDurxrp;u1ole ifcilt a rlumont4tltrif3tytfm  auesl(  2urimpoo4ll emiei sf rumu pnt0tpeomoeiatfa ra(msn(0tetrio3oadoa eln i ()setoiopnu4om nmiesas  rrmx  no4olt ifetatlm2eaumo (0alxrmfctodlm  aueil(  euoxm iy1lme lfcs s)srumxr no1aexniiciys mDelums t)teenxoctytlptrln i;s) 2xrio3io1ll   fcia() 2rrxm ;o4tpeoioctatls ulu o t0trxoiocoytopDr nes;(0t2xm(r oo4amt mnvilsf 2umur nt0oetomf3iysfa2rl( o;t) rermrctadfaD  nes;s0t2to(r3oo4ameemiciat)a2tmur nt4tet ifcias s rmums t) leoif3oo1oaDr u i (0 rxmir oo4lm elnctlt  Drr(r ot1tlen ictldlaDem(vp (0 exomf iydoaD anvi ( srtm(r io4ome mfvt (f 2ta(moou0aptomo3iytlmDrl( o t4aetoxr3to1lp eauvolt t2uoxmpnu1om  mfct () Dua( o;u4aet if3iadfsDean s;t)aexoxo oadomtr n i t)texr(o nu4ol nlfvsa()s2rm(rp;t1opeoioctld s2um(vp t4texnio io1latrauvs t)srto(r nydapt mfetls)srrrxroou0opxnmo3ias aDrauvp;u)tltrmr3ia1fatelnes t)t2to(r3nudlpte neiasfsrrrurp;o4aetniieiasfsDum( pn()aeeomoctytlpt  n o ()t2umxo3ny4opt  nciat)aDrr(rpnt0tpt mo3iydls2rlnmo;u4aexoif totlaDrlies t) ruo(o3ny4ol emfetlsfs2raurooo4tlt  ieias m ul(vs t0 eerir3iadfpt  n ilt sruoir ny1aptnmnvsas artrx  nt0tptnifciltfm2eluvo () etrmfciotlatranesls) 2toxm3oudolt  ieiat) Dua( ono0apt mfetatfa elump;t)texnif ootoptean i s)trtm(opoudom n ncslt) rrru oot1aee  feildfa el(vp;t4altrif todomte i s (  exm(r nodamt mncs ( a2ua(r oo1alt mo3tyd mDum(vs;() exrmo3tydfa e neo t) exoio oo4olt lfcs ()a2tmurono0oetniieildlaDuan o t4aexomr oo1lmD li i;(0 2tmio iudaptelietatf 2taurp;t1ape iietad m ran o t)tetrmf3ootla eln s t0tetoim oy4openlnetlt sDtrum ;u0altoioctltlm umnmo;t4 lxrmo3iy1lmD liesl(  etoir3iy4alenlneslt)sDurumonu1olxo fctltfaDrlump u4 rxnxfciytoaDranei t0 2xoir iu4alt licils  rtax  no1opto f3iyt sDul( s;u4alxnmf oatoaDr nvs (  eumir oy4ol   nvs tfarumu ono1tpe  octydfs rlnmpnt4 etoxoctytop   uvilt  eumxo nudlmt lict s)sDtaxmo;u1aeto f3iat m ean o;(4artomr3oo1lm  lueol() eurimpiodaltn ics s s2rau oou0tee iiciysfa2rauvsnu4tetnxo iadfpt anvi t0 exo(mpio4omenlnei (fsDum(ro;u4tptomo3iys aDuanvp t)trxrmr3oytfpDe nvolt0 euoio iy4ll elieta()sDraxr ;o4tlx ioeiys a umnvo (4trtoio ta1lptrli s;t0texmxo3oy4lme mnci sfs2umu ono0tlx mietatfs umn pn() ltrxr oydom rli i;s) rtmio3oodam n fcsa()a2tm( pnu4oleoio3tlsfm2umump t)teeoif3oo1fa rauvi s0srxmio nudap nlnei t)aDumurooo1altomf3tatfm2uanms;()tlerxo tydom eanvols)trxoim iy4oltn ici t a2uaurp;t1opeoioeiad s2rluvsnu0 exoiociydlmD  u ilt0 exo(o iodlptemiciasf Durum nu4oexnifctat mDem(ms;(0aexoifciotlm ran ilt0srxm(m oudalt mivsas srur( o;u1oex mi3ilsla2ran o (4aexomr3iadop eln s t tetmxopiodam n ics sfaDum(m oo4oeeoio3tysla2rl(mp;(4teenxfciotoa elnesl(0 rtoio io1lpe  ivslt) Draur no4opxo oeilt a ea(vpnt4aexrmo3oatop  livi s trtoio nodlpte feilt)arrru  oo0opeoiicildlsDran ont)arxrio oydomtr uvi;t s2umxm ny4ap emnctl( s2ta(mo;u1tlto ociydla2el(mpnu4arxoiocoy1fmDeau o;t  rurxr ny4oleemfcia() 2trxmpoo0apxoif3iyd m rl( s;u0 eenxr3ty1op e ivs;()srtmirpiu4lmte ncsat aDtmx p;t0opeoioeiadfa2emn p t4texrio3oydomD  i s s0 ruoxr3iodlle lfcsltfa2trxmo;o0texnmociytla2eluvon(4arermf3oydomteau slt0tetoxopoo4aptnmivil(fartr(ront1tlenmf3taslmDulu s u0arermf todfaDr i i;() eurxr ou4lptnmnvta() rur( ont0tee  feiatlmDean snt4trxoxo3oadlp  ln i;( sexo(r3ou4ll   netat  2rau onu0tlxo ieiysfaDra(ms;t0tlenir oo1fm   u s;t t2um(m nodale mneiat  Drrumpou4aetnmf3tldlsDul( s t)arenxrciy1lm r u s;t)teuo(m nu4llt mfcsl() Dumxrooo1tpx  fcias aDemuvsn(0trtnio oa1fateaieil(0trto(o iy1lleemnvs tf rtmu  no1tleniocild s2ulnmo;u0 lxnif3iatoa  anvslt t2xr(o no1om elfcsasfs2tm(r ;u0altoioetls mDrmnvp;()treomfcio1fatr i i;s  rurxm nodap elfet sf rtrxr ou0aexomi3tltfa2ulums t)texrxr ia1lm rln i;t0 2xr(r3nudope lneta() Dtrxmonu0aetomieiasfs2um( o;u4tetomr3tydomtrlu ols  rxrxo ny1lme mies ()arua(m nu0oexniietadfmDel(vo;u4 etrmfciytlmtrau i s)trum(mpoo1ome  nctl(fa2uaurp;t4oex iiciyt sDrluvs u)alenmo ty1fa  luvslt)sexm(r no4lpeemnvsa() 2tm(mpou1alt if3iydfm umu p;t0 leomocootopD li s s0 2xoxo nu4lpen neilt)sDtrur ;u4opt iiciat mDraumo;u4 ltoif3iytopDrli s;(0srxr(m iy1al   netatf 2rru  ;t0aee  icilt aDrmnmont)areoxr3todopD  ies s) 2ur(opny4lptnmfesl() 2urxr ot4opt moeiatls um(mo u0trenmo3totlatr iesls srtoxopiy4amtnmieia() Dua(m oo1tlxoioeilslsDemumo (4tetoir oodfp rlneolt  2xm(rpnydlmtelnviat) 2trx pot0optoioeiyslaDumump;(4artoif3ty1omt  ieo t)t2xm(r3nodaptelneil(f Dtr(  ;o1oltomoetyt aDumn o () reoio todlp r ivs s teumxopiydale lfeia()sDum(r ;u4opxo o3iysfm2eauvs;u) etoxfctotfm elies;s  2umxr oo1lltnmnctl() rrru  ;o1tltnioeiat m rauvs (0 lxrmo3oa1omteliei;t0texmxm3no4al n fvsat)arrrxr nu0oltomieiyt mDemu s u4arxrmfcio1lm r ivs (0tetrxr oy1lpeelieslsfarrrum ou0oltoifeiydfsDemn s;u4texrxrctytop elivo;t0 2toim io4alt mnesa( arraumoot4tet ii3iadfmDeauvs;t0tlxnircta1oatr nei;( texr(m nydlpe mnct s srtrum ;t1aeto i3iadlmDemn p (0alxnmo3tatfat ai il( sruoir3iu1al n fet ()aDuauroot0ale  iciatfm rlnmp t)texrxfcoa1oatr nvi;( teur(o3ny1olt mfeta(faDta(  nu4altnmfeiasfmDrl(monu4 ltomr ootla  anvi s t2umxm3no1amt mfcia(f 2rmu  nu0altoii3iydls2ul( snu4trtnxf oodlpteaivi t0trurir3iu1lmee icsls)srrrxr ;t1oleniietydlaDuln o;t)artomocoydfmtr iei t s2tr(opoo1om  mfci ()sruaurpnt1tpx io3tld s2eaumsnu4 etrio3oatoatraivs;s) 2toxrpiy4amt  nvil()srtmur ;u4alx micild aDeanvs u0 exrmoctotomD auvs;s0t2trir oy1op  mies s a2raump;t1tpe iiciatla elnms u) rxrxf totfmD  neo;t0trto(r3oy1apenlfvi t srrmur ou4aeenmf3iltfs rl( snu4tleoir3oytomt  i il() rtoirpnydlle  fvi t s2taurpnu1aexomi3tytla2rmu sn()trenifciy1la rli i;s  rurxrpiydam  mfvi sfsruaur ou4apxniieiys s umnms;()arxoiociodoa rauvo;t  rtoir3iy1al emnciasfarum(r ot1aexo i3iyd m eanmp (4trxoio oy1lp rau o s  2toiopno1op n nci tfaDuaump;o0ole mfciydfa2ul(ms;u4 rxoio3to1opDraiesls0 etoir nydale  ivilsfs2tmum no0tex  fctlsls2umu s (4arxrxo3io1oaDe uvi s0setrxo iy4lle  ivsat)arra(r ot4tet  octadls2em(ms (4treoxfcoodfate iei s0s2xrxo ou1alee ictasf rurur no1ope mieiltfm rmu p u0aexrxo ootomte n ilt trxr(opny4ll elncslt  2umumont0tet ii3iaslaDra(vs u)areoif ootlm eaieo s)tetr(m3ou4lle mieias)sDrmumpot1aetniietldfs rm(msnt0aleoio3tatom  anvi;(0 euoxo nu1oltnlfvs t)aruru p;t0aex  oeilt m2rmn s u4 lerif3ty1oa e neslt) 2tr(m3oodlptelnvsas artrumont1opxo fetydlm ulnmo (4tlxrxfcoodlmtrlu i (0texoxm ny4lm nmncsa(  2rm(rpou0aptomfetld s2emump;u)aeerxo oytoaDrlnvilt)setoxopoy4aptn netat  rum(rpoo4apxn i3tasfmDumnvonu0tetoirctydfmtrln sl() rxrxo oudopeemfviltf Dtmum oo0tleomfeildla2rauvo;(0 ltomr to1omD auvo s teuo(r3iu1ol e ncs ()s2umx o;o4texoifciydfm rlumsn(4tltrir oytlptr ieil()trtr(o oydome mfetl( aDtrurpnt4oetoiieildla2rlump;u0arxnxfcoo1lmD lu s;s) 2tr(o3nydamenmfcta(fs2ua( oot0aptniictyt s2emu o u0artnir3oa1fmD  ueilt s2toir oy4amtelivtlsfsDumu ooo1opt  ociltfs el(vo;(0aeerxo3oytla rauvil()teuo(mpnydlptn ivsl()srtm( o;u4tleomoeiasla2uluvo (4tetrir3iatla rln ils trtmxr oydll  mnviasfaDtmu p;t0aet mf3iys a2rl( snt0altnmf3oy1oat  u o;t0 rumxrpou4lpe miesltf Dtaxmo;t1aeeoii3tytls ulnmont) eeomoctydlmD  neol(0s2urxmpny1lm elicsa(  Dum(rpot1apenmo3iytfaDeaump;t0 ltnxf3oydlmDelues ( srxoxo ny1aptn nvs () 2ur(rooo0tex  o3tas aDrlnvo t) lxnmociodfaD ai i;s0t2uo(r oy4lpeemnvia()srta( pot4aeeoii3iltfm el(vp u0aeeoxr3iytoaD au o s0srtoxr oudlpe lics (faruru o;t4alxo ocilslm2ulnvs u0 reomf oy1laDeli i;(0srumio3io1omenlivia(  rrau pot1ole mf3iat m2raumo t) lenxo oadfaD ai sl()seumxmpny4llee nvta(fa2rrxrp;t1opt io3iasfs2ranvo t0aetoxoctytlmDelnes t)t2umim oudlp elnvsas)arrau  ot1aeeoioctyd m ulnmp t0artrxfciytfmteaivi s) rtrxo no4altelnvtat artr( ono4oeeo o3tlsfm2ul(mo;(4aeenmf iatoat li il( setrim iydap  lictlt)sruru o;u4teeo ietltlmDuln sn(4 eenirctatlpDraivs s tetmxopnodlmtnmivilt  2uau  ;o1tlxnif3ildlm ea(vo t) exrxociatfmD  ieo s  etoimpio4ll  lfctl() Dumump;t4tpe  o3tlsls2rmuvs u4 eerif3tadfm elivi s)t2xrimpoo1aptemfvs (fsrtau o;o0olx iietatfm um( o;t4altnxf3ia1op ran slt srxoimpiydlmtelnetat)srur(  ;t1tlx  i3ilt m uauvp t)aleoioctadom  lneo t) 2to(m oodlptemici ( a2taxrpot4aexo feiltfs2elnvo;u0aeenxr to1fp r uvs t)s2umxopiodome  fes ()s2urxmoou0tpxoiiciaslm eanvsnu)tltoir iodlm e i s s srumxrpiu1ope lfesat  2um(rp;t1opx  i3ild m2eanmo t4tetnxr3iy1op  luvs t0sruo(m3ou4op emfetlt)s2ua(  ;u1oetnif3ilsfa elump;t4teerxoctotlpDraivi;s srxr(o nydal n feilt sruru  ot0alen f3tyt aDem( o (4texrifcoa1om   u o t)sexrirpnudopeemfvta( sDtru pou4olt ifcildfs ean pn(0 etnir oatoat  u s;s) 2tr(o ou4apt  fcias)arumum no0apx ifciytlaDeauvp;t0 lenmr3oodfa elueolt0trtm(rpoydllt liesltf 2uaurpou4apenifeiys a eluvont)trxrmociydfm e neo s t2uo(rpnudolen nviasfsDurumpot1aet mfciltlm2ul(ms;u4artniociy1oatelu i t0seuo(m3io1omenmivta(  2trx  ot1aleomfetltlm rmu onu4 rtnxo3oydlptr n o t0teurxrpnu1alt lfei ()sDrr(mooo4alxnmictasls2elnvs u0alxrio iatfmDe n s;()seto(o3nu4ol  lictat)srurxr ;u1olenmf3iasla2rln o u4teenxf3oadlp elueols0 euoirpio1al  miet tfarrru  ;t4tlx  ietasla2uan p;u0trxrifcia1laDe i sl() 2tmio3io1op  lfct (f 2uaump;u0aex miciadls2rmnvo ()artrxf3iadfpt anvol() euoxrpoudam   ictasfs2urur ;t0alt ioeiat sDran pn()alxnmo iatfmD lu olt0s2urxr3ny1lmtnmivtls s2uru ono4opxo o3tad s2uanvonu0aetnxo3oo1fat  u o s)sruoxo3iu4lle mfetas  Durxrpoo0tpt mieiyslm2rlumo;t0 renir iotopDr i ilt)texmir3iydaltnmivi (f ruaxmooo1oetoifciysfmDemnvonu0arerir3oytfa  an i;()s2xoxo oodlltemnct t  2rrxrpoo1tle  ieiytlsDulnvs (0aeermf iy1optraivo t0trtoir iy4lmenlfes (f rrru ooo0aleo i3tytlmDuaumsnt) ltrxrciatlpteaivs t  eumio iy4alte ietlt) Drmxroou4tptomfeiat a ea(monu)artoxocio1fmtr u ols)t2toim3nu4ll  lfes (f 2ra(  nt1aet iociytfmDrlnvsn(4arxnmociatop elu o ( setoxmpnu1olte nvtas)arumxmpot0tptnioeiltfm um( s t4 rxnmf io1lp   iei t0 euoxm3nydlp  mivsltfaDtr(r oo0apeoioetydfm uluvp;u0teeomf tydla rlnvols)srtm(mpno4olen fvsls aDtr(mo;u4alx  iciltfa um(vpn()trtoxocta1lat livols)sruoimpiodaptnmiviasf Dumumoou1aeenioctlsla2emnvs;u)tetoir oytlmt ai s () eurir3oy4om n nvia(faDrau oou1apen i3iatfa2emnvs;t) ltomo io1laDrluei;()s2xrim ou4ap emnvslt)artax oou1oleoiieiytlsDrm(mo t0aexoxoctytopD an s;t) 2tm(mpnu4altemnesa(farurx oot0apxomictytfm uaums () eeoxf oy1omDr ivi s setrxopny1lle  icslt  rrr( pnu4opxomietyd sDeauvs;u4 lenxfctadfat lieolt0 rurxrpio4aptnlfei t)arrrxrpou0tlxoiiciad a uaump t0alenif ootlateln i ( t2uoxr3ou4lle lfvslt  rtmumonu1oltn o3tasla2umn o;t)aetrifciotfaD aivols0 2tmirpoo1om nlivilsfsrtaxrooo0altoio3iadlaDrl(msnu)treriocootoatrluvi t0s2xoiopiudlmtelneiat aDrmum nt0tpeo i3iat sDrau on(4 exnxf3ta1lp  lneo ()teuoimpoy1lpt mieiat sruau  oo4tpx  f3iyd s2em( p;t0tetnif totopDeauei s0 2xmxmpiydom  mivtlt) Dtaxr ;o0opxo oeiad a2um(mpnu) lxrmf3iatomt aies ( s2triopnu1olee ieiat) 2tr(r ;t1oee iociatfm2el(von(0treoif iydoatr i i ()setrxr oy1amenlfesls sruaurooo0olxnif3iyslsDul(vp;u)aeeoxo3ootfa r uvo;s0trtrimpoo4lltnlnei ( sDraumpou0teenmieiasfm uan pnu0 etnmf to1lateauvs t t2ur(r3no1lltnlfvia( aDtaumono4aeenmieiatfmDumnmsn() etnmocootfm  auvs t) etoiopnu4lpe  fviat arrau pnu0tlto f3tadfm umumo t0altrmfcoadla r nei;() 2xo(r3nydlpe  ieil() 2tau oou0tptn o3tls a2rln s u4texnif io1fpD  nei t) 2tr(o nudll  licil( s2rmu  no1texo o3iydla umuvo u0trxoiocoydfmtr uvs s setmxo ny4omtnlfvsl()sDrrxm nt0aexnii3tatfmDea(mp ()artnmr iytfm eauvs;() 2uo(o3iy1op e fcs tf Dra(m oo0optnmfcildfmDrluvs;()arerif3iotop elu slt0srxrxr3nu4lmenmnci ( aDuaurono0oexomi3iyt a emnms;(4 lxrmfcta1optr ivolt)setmxm3ou1al elnct s  Dtrurp;o4olenioeiytlm eln s () rtomr3ty1latr u s s)s2urxr3oydop  lnctl(fs2rru  ;t4aexnmfctydfs uau p (0arxnio3ootopDrau o;s)srxr(r3iy1amtnmiviat)a2ta( ono1tpt  fetas aDeauvont0trxnio iotlptr nvo (0srtmio oy1lle  nctas  rum(rpnu1opx  feias s ea( o;(4arenmrctodfp  aneils setm(o3iy4lp emfcils arrr( pnt1oeeniieiatfm2rmnmp;u4areoxfciotlpt livols) 2tmimpnudlltn fvs () rtmum ou0oexnif3tasfmDul( onu0texoxf3to1faD ai ol() 2trxo nu4oltn ictatfsDrax  ot4oltoioctyd a2eanvont0trtoircoatfaDrli olt0 rur(mpoydapte nvi (f rtrxmpnu4tlxo iciasfa2uanms;t)altomr tadfm eau s s s2uoir3ou4alenmfcslt srtru  nu1alen oeildfa2rlnvs;(4 exoxfcoy1lm   uei t)sexmio3nodamtnlfes s arrm(m nu4openmieilt aDuauvo;t)artnxf ty1lmD  uvo;t0srtrio oo4lptn icsasfarrm(mono1aetoioeiytfm elumsnt)trxnir iy1faDranes;s t2tmxm oo4open neiat arrmuront4oee moetldlsDrmuvont4aetomr3tytoaD lieols  rurxrpoo1am e ncs (fsrraxmonu4apeomieiydls2rm(vo ()aeeoir oa1fpDeaieo (0trur(rpno1olt miesat)aDtaxr ;o0ape mieiatlmDrau o;(0teenmr3iydfp r ivo;( setm(rpiudoltemnctltf Dumu pnt4tpeo o3iyd mDrmnmo t0 rxnxr ootfptrlu o;t texr(o iudopee ivtls sDua( ono1olenifeiasfa elnms;u4tlxrmo tadopt anvs s0t2to(m3ou1op emnctl( s2rrxmp;t0oltnmi3ild s2em(mp;t) eenifcoy1fp  ai slt0t2trimpio4lptnlfci t)sDuau oot4texo i3iltlm uan p;u4aleomrciadlpD  iei s  2tmio3iydap emfvta( s2ururpot0tee if3iatlm2ul(vo (0alxrir oytomD auei () etoxr3io4aptnlies sfs2tax  nu1tlt mfeiytfa uau onu)aexnmrctatfp  aivs () 2uoxo oo4al elicil()aDum(m no4texnifctlsfmDrmu p;(0trtnxoctydfmtr ivs;t)teum(opiu4aptelivsl()srrm(m oo0apxnioeiltla2ean p;t)trtnmo tydfpt aues;s)setr(mpoydoleemfvilsfsrrr(  ;o1optoio3iytlm rl( s t)trxomocta1omt livi t0t2tmiopou1lpe livtlsfaDrrx pot0aee mfctltlsDumumo () rtnio3iydfmDraivolt)seum(m nydal   icil()arraxront0tpeomoeiydlm ra( o;t)artomf3oo1lmtrli s;(0trurirpoo4op emnvtat)a2uax  ou1tlxomo3iatfs em( s;(0 rxnmr iotop r uvo;t) exmiopoy4al elfeslt)srtmx o;o1tpenio3ils s2emnvs (4trxrmo tytfat lu i s)trxr(o3ou1llt lieiltfaDrax pot4altoiicildfm2ra(ms u4tltrif3to1omDrlnvs ()srxmxo nodape mnct s  Dtm( pou0tpxomoeildla em(vp ()trxrmf3iodlpDr ies;()s2xrxr iudale lfei ( sDumxm nt0opto feildlm uanvs t) ltrir3oatfaDrai s s) eum(o3iydopeeliet (fs2urumpoo1ope ioctytls eau s;u0 lxnmr3tydopD  u o;s0trumio nodom e nvs sf 2um(moot1tpt io3iysfm ea(mo (0 exoirctytfpDr ueol()srxoir iudopenlncsatf rua(rpnt1ale  f3ilt s2rlu p (4 eeoxfciodfptrlu olt0seto(o ou1lpt lnvi t)sDum( oot4oexnmoeiyt a2em(vo u4tleoif3iadfa elnvi;s0 rtoxrpoudoleelfvsls  Dtmurp;t1aet  ictld a rmuvs t4 rxoifciy1lptrlivslt0truoir3iu4ap  mfvils srumxr nu0apeo ocils a rmumpn(0alxomo oytfmDrlueo;(  2toxr nodllte nvsat)srururo;u1opxoif3iatlsDemums;u0 etnxocia1lmtrlueo () 2trxo no4al nlnvtasfaDtrumpnu0tetnioctat m2ulu p u0trxoxo tatfa r neo;s)srxmir nudomeemivslsfa2um(r ot0alxnmi3iytfsDuanmo;t)tltrmf3oadlp e uvs s)sruo(m3ny1lpee fvt t artaxront0ape moeiatlm2rmuvpnu)trermf3iodlmte nei ( t2ur(r3nu1om n nvilt)aDua(moot4opt if3tld aDulu ont4altrxr iytoa eau s ()texm(o3nudlp nmictas)s2tm(ronu0opx  fctltfa um( ont4 rtomo tatoat auvsl()sexoxm3ou4al elfei (  2um(rpnt0tlx  oetydfmDemnvo;t4teermr3iy1lpDran s ( seuoxm3io4lmtn ivtasfaDraxrono1olx  i3iysls2rm(ms (4 rtoircoodop  lu ol() rumxm nudaltn ies tfa2raumonu1ape iictaslmDemuvsnu4arxnxoctydfp  an i s  2xm(m iudlle mfes (fa2uaxm ot0oltoiocilsla ranmp t) lxrio iotlaDr ivs s0trtrimpnodal elfcsl(fs2umxr no0apxnmfciad s2rm(ms;u) etrxo tatomD  uvslt)sexmiopoudal   neiat)s2taumpou0alx mf3ilt m uanvp;u0 lenxo iydoateanei t sexr(mpny1omenmfetas)sDrau p;t0alx mf3iatlm2elnmo t0tlenmr3iy1opt  ieo ()teuoxo3iodole mfvtls) rumu ono0oee  i3iatfm2rm( s;(0artrir io1lpD lneil()s2uoirpoudop e ictlt) Dtm(mont4aex iociydlm el( ont4aetnxf3ia1op  luei (0 rtrir nodapeemncsasfa2uaur oo1aleoif3iasla2ua(vo;u4aexrmr3iy1latrlnvslt seur(opnydol  lncsas)srtax  ;t0apx ifciyt s eluvs;t4tlenmf oa1la ean s;(0 2urxopiudll   fei tf 2rmum nu4oexoiieiatfs2em(vp;(0tleomfctydomDeaues s  rxoir3no4am emnctasfarurxrpno1aetoioctat m rmumo t0 exoxr oo1oat  i olt t2xrxm3iodap emivtatfsrtm(r ;t0tex  ieiad s2eanvp;t0 exnifcoatop   ues (0s2tm(m3oy1lpee fvi s a2tm( pnu0oexo ietatls ua(mp;u)teermfcoy1om rlies;s)tetmxopny1openlfcia(fsDrrx pou1oexomietltfmDel(vont4 eenir3oo1opteluvil() 2ur(o no4ap emneia( aDua(m oo0olxniiciadlm emnvont0arenxfctytlm  lnvsls trxr(r3iu4op e nei s aDraurpoo1olt  ieiytlm ulnvs;u0teeoxfciy1lm elueo;(0 2uoimpiodlme  fei (fs2um(r ou0opxn ieiyt a umumo u)aetoxfcoytomt ai ilt0setm(m3iydlme lncil(f Draxm nt4altomi3iltfaDrlnmp;u)altnio iotfp eauei t)s2toio oo4lm   fes t) rumxmooo1oexo iciyd a2uan o (4aetnmr3tatlp rlnvi t  2xmxrpou4lpt  feiasf Dua(mont0aetn icias a umuvpnt0arxrxrcoydomt auvol() rxmimpnu4ll   iei t)sDuaxmpnu0opxnmieilt sDrau sn(4tlxrmfciydlmDelu slt  exrirpou1lltelnvta(fsrur(  ou0tpx  octadlm2rmums;u0 lenmo oatlpDean o ()teur(m3nudopt  icil() 2ur(r ou4oeen ieiadla rmuvpn(4trtrif iadfat  u i;t)s2uoxmpoo1alt livt (  Drrxmonu0aptnmi3ils s eln o u) rtomf tatlmt anesl(  ruo(r3iudaltnmnvias)arurx pnu0teen fciadlm2umnvpn(0aexoxo3tatlp ean o () euoxopny4lm   nvtat)s2tr(mp;u1tltoio3tadlm2rln s t4aetoxr tydoptrln olt0t2xoxr io1opeemnei sfarra(m nu4aleo i3iatfm2elnmp (4tlxnir iatoaDran i;(0 exmxm3nodlpee fvtlsfaDtrxrooo1aetomieiydfm ran s;(4artnxo3ty1oaDraivo;() rumio3no4ap  miesasfsDtru oot4texoioetyt aDea(msnu4 exoxo3oytfpDr ieolt0srur(m iu4aptnmiesl(f rtmxro;o0tpxnioeiysfs rm(mpn(4 ltoiocoa1oat lies s)seuoiopny4ome mfctat a2raxmooo1oleoii3ilsls ul( s ()alxomr tydlm  ln s;s0srtrxm3iy1lmtn net tfs2uaur ot4tet mo3iad a2el(vp;u0arerxo iodlaDe i s;()srxo(m3nudlpen ivia(fa2tm( o;u0alxnifctadlm em( sn(4alxoxrcootlpDeanvils setmxo nydll   ics (fsrtm( pot1oexomociadfsDrl(vs t0tlxrifcoodlm  li ils  2xmim3oo4lptelfeta()sDrmxm ;o0texoifctld m2uau p t)texrxrctatlaDelneolt  rxrir io4amt  ictas s2taxmpou4teto icilt a2rmn on(0 rtomfctatfm elnvs s) eum(rpoo4lpe  fvsl(fsDrr(  no4olto i3iydla ea(vo t4areoircto1lmD livol(  etmxm3nudamenliet ()a2ur(  oo4tltomocildfm2ua(mo;() eermociatfpDelieo s)t2tr(m ou4lp nmivta() 2tr(moot0tetnifciytla uauvs;(4 lxomf iytoatrlnvi;(0srxmim3nydlpen ncsl(  Dur(  nu4opeo feiatfm2uln p u0trtoif3oy1optrlies s) exm(opnu4aptnmnes tfsDuaxro;o1teto fetadfsDrm( p;() ltnir iodfaD ln s t trxrir3iydap n fcia( aDrrxro;u1aetnmfcilt s2rl(vs;u) exrmr3iotoaDrai sl()t2um(o oo4lptemfvslt s2tr(mo;o1altoioeiytfs rl( o (0 etrir ia1op rlu o;() etr(mpny4al emnvilt) 2ua(rp;u4oexomf3ilsfm2uan snt4 exrmf3oa1fpDe i sls) ruo(mpoudom nlnes t srrrurpot4oeen ieiadfsDrauvp (0tltnmoctotfm  li s t)texmir oydaptelfcsl(fs2tmurp;t0oltomicilsls ua(mpn(0tetnifcoo1fm  an ols0srxmxmpoy4lltelnes sf Duaxm nt1aleo oetas aDuauvp u)tetnmf3oatop  lu il(0setoimpiu4lm nlfeias) 2raumo;o4ole iieiytls2eln on() rtomfctytoa  anvo s) rxmio ny4lptnlfeilt s2tm(r ;t0oeeoifeiadla ulu onu4altoxr3oydlaD lnei;(0t2tmxopiy4omtemfei sfs2raxrpnu0tpx  iciadls2ea(mo;u4tlenxrctadlmDrlu o;t0s2xmxo ny1oleemfet (fs2ra(ront4tltomfeiad a ua(vpn(4texoxf3iodfp eai sls)t2urxr ou4ame  iei t  2ua(ronu4aee mfeiys a rlumsnt) rxrioctytfm  auvs;(0setrimpio4ame mivt t)sDtm(r ;u0oetoifetyd aDum( snt)aeenxfcty1faD  n ols)texr(rpou1ap  livtasf 2tmu p;t1tpenif3tat s2rmnmp u0trenifcio1lmDrlivi;(0teumxr oo4altnlieia(  Durxronu0apto oeiytlaDeaumpnu4 rtrmf iodlateluesls trumim3io1ap  mici ( sDuaumpoo4oeeoif3tytfs2rlnvs t4 ltnio ia1op  lneo;s  rur(m3ny4olt  fvi s  rrrxr nt0tex  oeilsfm umnmp;u0 ltnmociodlaDelnvolt) rtrirpio1lpenmiciltfartr( ooo1altnmfeiadlaDrmuvpnt0tlxrioctydopt au olt)srtr(rpnodope lfvtat) 2tmxmp;u4apto fciytfaDeanvon(0tetnmr3ty1omDr ies (0 ruo(mpiodam elnci (f Duaxrooo1apxn fciys s eanvp u)arxnxocoydlpteln o;()t2urio3ny1omeelicta(fartm( poo1tee mi3tlt s2rlnmpn(0teeoxo3ia1op raivs;s)trurxmpnudamee neilt) Dtru pou0oet ifciaslm ranvs (0 eerxocoadfp eanesls)srtmim3iudop elfvilsfa2um(r ;t0tpxomieils sDrlu onu)aetnmoctydoa  livs t)srtm(m oy1lmt lfvtat)artm( o;u4ape mociatfa2rluvo t0teeoifcoa1omDraies ()t2xrxmpiu1lm n fet tfa2ra(  ;o4apx  ociysfsDrmu pnt)alenif iatom e uvo;s)t2xmim iy1om e fei tfs2rrxm nt4tpx mi3tysfmDrau o;()altrxo iotlaDe ies;(  eurxo io4op e fvsl()a2taxr oo4optoioeiatlsDrmuvont0 ltnxr3oatlpD  uesl(0 rum(r3ou1lmte iviltfarrm(rp;t1texnifciadla2ua(vs t4 rtrxrciodopDeaivo s s2xmio3ny4opteliviat arta( ono1teeomi3iaslaDelumon(0tlxnmr3iadoa r i o;t0seurio no1apen nctat a2raxmp;t0alt mfeiyd aDrmu p;t)tltoio3tatomtrlneo ()srtoirpio1ll elietas) rra( ono4oetomoeiltlm2el(vo;(0 rxoif oa1op  li i;( s2trxo3nu4ale mncsl(faDua(mpno1opx ifetysfs2rmu p;u0 ltrmf3io1om elies t)t2um(m oydlm e fes s sDtaumo;u1alxomf3iys a2umuvpn()aeeoxf to1fm  livolt0srxriopiu4ap nlfctas  2urx o;u1aex  ietas m emuvsnt4 rtrmocty1fmte iesls  etr(m no1ape  nvtas) rrrumo;o4tpto fcildls elumpnu4tetomo3oatoateauvi;s0 rxrir3no1ol  miei t)s2ur(ront0tleomiciat m2uaumo;(4aexnxrcoadfpt aivi ( s2xmimpio1lp emnvt tfa2ur(  ou4tpt moeilt sDean snu)tltoxr3oodlptr i ilt)t2xoxm3oo4aleemfct (faDra(mpoo4oet  oeildfmDrln pnu)trxnmf3iodop eaieo ( teurxrpio4opeelfviasfa2rmurono1olx  iciadlm2ea( o;t)arenmr3iytlmD luvs ()teumxr3io1op nmivil()sDraxr ou0alt  oeiydfa umn p;u4tetomo oytfat  uei;s0s2xoxrpiydolt  ivslsfaDrrurpnu0tltoiictatfa2umn o t)texnxo iy1fmDeaivilt  rurxopou1lltnlivs ( sDurum ;t0tpeoif3iatlm2eluvo;() rxnio3iytlat lnesls s2toiopoodop  mivtl(  ruaxmpou4oeeo ociysla2el(mpnu)alxoifcoodoa   neilt)s2uoxr3oy1ameemfesltf Dta(  oo0opxo oeiadls2rau p (0aleomfctatop eai slt0 2urxm oydopt mfvias)artmxmoot4oeeo icilsfsDuaump;(4aeenircto1laDr u il()srtmxm oodom  mneilt a2rrxm nu4oex ioetadfa2rmnmsnt)tlerxfciytlaDeau i t0trxm(opoo4am  lfesat)sDumx  ;u1aleo ietasfaDem(vp;(0aexnxr totlp eli sls0 etm(r oodal e fvilt sDtaxr oo1tlx ioetldfm2ra(vs t) reoxoctatlptrlueilt)texrxo3nu1al  mici (  Drax  nu1opxnmfctasfa2rln o (4arxnxf totlp eau s t0 etm(mpoy4omen icilt aDtrurpno0tpx mf3iydfm2rlnmp t4 lxnxo oa1lp e u i s0teumxrpoy1omt  fcils a2rax pnu0alt iieild a umn s t) leoio3tydfpD  uvi () 2xoxmpio1om n nvi tfa2ra( o;t0optnmiciytfs ulnvo (0aetrir3tytomD livi;(0trxrxmpio1olt mfvsasfaDtr(moot1alxomoeiltls em(vp;t4 reoxr3iytfmt luvi;s s2trimpiy1ap nlivsatfaruaurp;o1tleomi3iyt m2uanmp;u)tetriocoatom rlueo;t0 rtmim oydale lnct (  ruru  ;t0aex ifeiaslmDran onu)tetoxf oodoaDr i ilt s2xmxo nydomt lfvsa()sruaxrpnu4tpe iiciys m2elnms t0 reomfctodfatrlieo;t  2um(m3nydoltnmicil( s2ta(m ;t1tee  feilsfs2ea( sn(4trxnmo io1lp  aivsl()s2xrxmpiu4lpee ncsatf Dur(r ;u4oexo i3tasfm ulu sn(4alerif oadoate ues ()trurxmpoydale mfeils s2tm(m ;t4tlt  i3ilslmDumn p;t0tetnmfctotoa eaneo;(  euoir3iu1amt mivi s) Dum(rp;o1apx ii3ias sDrln onu0aetnxfcoadoaDr uvs t  rtm(o iu1alt mnvsa(  2taur nt4aet  fetytls2emnvpn(0alxomr3iodom rlnvils  eurir3oodlptnlfcsasfarraxr oo0teeoio3tltla2rln o u4 lxnxf ty1lpt lieolt) rumimpoodoptn ivia( aDtmuro;u0aexomfciadla eluvsn(0 ltoircootopteai o s s2xoir iu1lp  mici s arta(roou0apxnifctyslsDea(mp;u4tlxnio3oo1omDraneolt)setm(rpio1om emfet sfsrraxr ;t1tetoioctyt m emnmo t0 rtnxfciodfpDraueol()sexr(opnodam  mivil( aDumx pnu0oexnmo3iadls2umn pnt0 eeoxf oa1fptelivils srurio3ou1om nlncils srumx p;t1oeenii3iat mDeanmp;u0alenir tytoatrlues t t2umxr oy1amtn fvsa(fartmurpnu1openifcildlsDumuvont0tltrmocoytfptr nvs t0 rtm(m3ny1omtn ici tf 2rmu p;t0opxo fciytlsDra(mp;t4arxrxr3iatop elues s tetrxr3iydapt livi t a2tru o;t1oeeo feilslm rlnvpn(0tlerio iotfm  au s (0 exr(r3oy4ap   ictls sDtrumooo0oltoioctlsls2rm( o (0 exomfciotopD anvs t) rtm(o ou4llte neiasfs2tm(  oo0tpen oeiaslsDra(ms t0alenxf3ootom  au o s seumiopiu1lpee ivias  2tmurono1openmieilslaDemuvsnu4aexoxf tydfpteaueils0 etmim iudalte fesl(f Dum(r oo1aeeomfciytla2rl(vp;(0trtriocto1omD  u i;s0 ruoim3ou4amtemici tf Dum(r nt1apt mo3tysfm2rl(vo u0teerxfcia1lp e i i;s tetoxo3ou4lp nmnvias  Drmurooo4openifetls aDul( s;t) rxrmf3iatfm eau sl()texmxo3oudll n fcsas s2uru p;o0tpxomociydfm2eanvont4 lxnxrctotlp rauvol(0t2trxmpoo4lltnlfes ()aDurx onu1oexn fetaslm2umnmon(0tltnmr oy1fa eai s;t sexrxr3iy1lpen fvsas a2ua(rp;u0tlx mo3iydlsDra( pnu0treoxf3oy1oate u i s0teuoio3oo4lm   iei sf Dta( ono4apeomi3iydlaDua( s t4alenxf oydoa e nvs s0truo(o iydoptnlfvil() Drmxrpoo0tpenifciaslmDul(vo u4trtnxfciytlpD  uvo;s0 eto(opnu1altemict s)sDrrxrpnu1apto ocilt sDeau s;(0aeeoxo3oytlptrauvo ()truo(r3nu1omtnlies sfsDtaxro;u4opx  feilsfa2rln p;u4 eenirctatlpDrauvi;(  2xoio ou1ameemivtatfsDrax oou1teenmoetasfm2eanvo t0 eeoxo todlp  lnes;( setm(o ny4optemnet (f 2rr(mp;o0alxn oeiysfmDrm(mp;(4texoir totlmt anvo;s) rtrxm3no1aptemnesas) Dumum nu4olxnio3iad sDrl(mp;t4artrxf iy1optranei ()t2tmirpnydap nlncslt)a2rmur nu0tleo fctadls ra( onu0trxnxrciydopDr nes (  2uoxo ou1lpt lfvtls aDraxmpnu0oexo i3tys m2emuvs;u4aexrmfciadfmt aivi s) etoir3oudoptnlictas sDra(m ;u0oetnmf3ildfm rl(msnu0aeenxf iadoate uvo;s0srxoir oy1optnliciatf rrmxront0tee mocild mDrl(vs t0treomociadlpteau s t0trtoio3oo4ol n ivtltf Duaur ot0opeomfciatlaDua(vs t4 rxnmfcio1lpDraneols teur(r3nodam elfcsasfa2tmumpot0alt if3tas a rmnvs;t)alxnmr iatoaDrlivi t0t2uo(opou1ale lnesl()sDrmxmoou0aleoiiciasla2ea(vs () exnxr3iotlp elieo;t s2xoir oudlm nmivtat)sDuau  no4tlxo icildfsDel(mpnt0trxrxo3todlaDe uvs t0srtrir oudom  mnctl()s2ta(mooo0aeto i3ildla ea(vp u0aexrmf3iodopD auvsl(0t2uo(r nudom elicia(fa2trum ;u1tpenmieiasla eaump;(0artomrcoa1opDean i (  exrim ny1ope mfvsl()a2rru  nt4apeo fciltla eaums ()aeenmo oa1fmD  ieo;s s2um(m iydlmt lfet t) rrrxrpot0opt ifeiat s rl(vp (0aetnmrctadopDe n i;s truo(rpio4ll elfvsl(fsDumxm ;u4tleo f3iltls2ul( p;t0aetoir tadoa r ivils  rxmio3no4lptemncsa()artmurpot4tlxoioeild mDranvpn()aetoxo iatlatrau slt0seumxm3iy1lpenmietas) 2ta(  ot1opto ietat aDea(msnt0 rxrxf oydopDe ies (0 rxo(m no4olenmfet sfsrumumpnt1tle iiciyt m emuvp;(0 reoir iadoaDeluvi;s srxrxr no1altnlnetls)a2uau oot0olx if3tytlmDem( o;t0 rtnmfciydop rln ols)t2tr(opiy1ole  fvtl() rra(rpno1alenmoctls a rluvs;u0trxomf3iy1lp rai s;t0seum(r oodlm  mfet ( aDtruroot0aex mfeiadlsDeluvsnt4 lxoxfctytfm  aueslt  rtmim ny4lm  lfes t)srtru poo1tleomi3tltfs2rl(vp;u)texoxr todlaD  ieils  eumirpno4ap e fei sf rtm(m ou0tetnmoctadls2rl( o (0areoxrciotfmDeauvo;t)srtoxr3oy4lptn nvta( s2ur(rpnu0olt io3iltls2ea(mont0alxomr3oytom  lneo s tetoxo3iy4opee ieilt)s2rr( pnt1apxn icild a uanvp;t)trtrxr oodlaD lneo;t) 2um(mpiu1om emneslt)arrau pnt4tlt  i3ild m em(mpnt0altrxrcty1fp r uvo;s0sexo(mpio1alt lfvi s srrrump;o4alenmfciltls2uln pnt)aetoir oa1oa rauvo;t0 etmxrpnu1ol elfcsa()a2taxr nt4ole if3iad mDea(vsn(4trenxf3iytla r ivi t) exo(r3oo1llt lncsls)s2tmur ;u0aexo oeias s ranmp;t)altnir iydomDrli i s0srum(mpoydlp   ics t  rtrx oot0alt iietydfa ra( o (4arxomo iydoptrluvils0t2tmio3iu4apt micsas)s2tru  ;o1alt mfeiltfsDemn p (0texnmfcoatoaDeaieil(  2xr(rpnu1lp emieia( sruau p;t1opx ioctasfm2rm( o (0trxomr3iadlmDe n s;s) 2to(r no4apen netl()sDtmxm oo1aexnmocild s rlumo;t) rxnir to1fpteli slt0texo(o3oo4ll n fvi t sDua(mpot1aptnmf3iadfm rl(vs;(4areomf oy1fp   ivi (0 exoxrpiydomenlietl( arurur no1optnioctatfa2rm(msnt0 ltrxrciadlmtr n sl(0teuo(rpoy1olenmfctl()a2tau pnt0tetniiciaslm2uauvp;t4tlxnmocoytfm eluvs ()teum(mpoy4lpenmiet ( s2rm(mpot0tlx ii3iasfsDul(msn(4tetrir3todfaDe u ols)s2umio ou4ape lies t)arur(mp;t4oeeoii3ilt s2ua(mp u)treomr3oo1op r i ol( sexm(r3iy1lme  feias)s2tmxmp;u0teeoiietytfsDeanmsn()arenmo3oadlaD  u i;t)seuoir3oydlmenlivtltfa2tmx p;o4aptn f3iys m ul( ont0artnxf3ty1lm rauvs s)seumxo oodlpe  fesa(f Dtr(mo;t1tlenmoctls aDrmu o t4tltrmf3iodfmte nesl()t2umxmpnodomee iesat)srra( pno4tex mociys s umnms;(4altoxrciy1fmDeanvilt0 ruriopio4al  lncia()s2ta(r ou0tpt  fciys s eluvs;t4aetoxf iatlat ai o;s0 etmxm iydlmtelnvs t) Dur( ono4oeenmociysfmDrlu p;() lxoif tadoatean sl(0s2xrxr3oo4lme liesl(f rurum ;o0apeoii3tatls rm(mpn() etomf3ia1om ran i (0srtm(m3ny1ap e feils s2tmxmoou0open ieiytfm uluvp;u0 rtoio oadlmDr uvsls0 rxoio3nu1omeemfcs ( s2rax o;o4oex miciyd a rm( p;(4aexnif tydoat  ivi t s2ur(r3oy4optelfcta(  2tr(ro;t4tptnioeilt aDelnvsn()texoif oy1fpD  nvi;s)t2urxrpoy4ome lnvta()s2rr( poo4alenmf3iltlaDrmu p u4 lenxf3iatom eluvilt)t2xrio3iu1lm nlicsa() 2uaxmo;u4ope moeiadfs umuvs;u4 eeomr ty1opDe n i;() rtoirpoy4llt mfesas  Dtmurp;u1aptn fciysfa2rau p (0 rxnmocia1fm ran s;s0sexr(mpoy1lp nmicsatfarrr( pnu1tltoiietldfs2eauvpnu0artrircia1lmD  ivilt s2xrir3oydllee ncia() Drmurpnt4open o3ias mDrauvsn(4arerxr3iydlmD  ueslt  rtmxrpiu1lpee nct s  Drmum oo4tpeo ietyslmDum(vp u)artoxfcoodlpDelu il()s2uoio3no4olenmictas) 2rrum nu1tetoiiciysfmDra(mont0aetoif todfmt luvils seto(m3io1olenmnvsl(fsDra(rono1alx  fciyt aDum(vs t4arermf oy1op r uvo ( t2xmim no4lm n nci ()aDrrurpot4tpx mi3iysfm umn o (4alerxo3ta1oa elu o;s srtr(opiydapenmiesa()srur( pou4alxn i3ilt sDrm(vonu4aeerxfcoatfate ivo;()t2urxo3iu4ol nlncsa() Dtrxrpoo4tet ifeiadfm rmnmp t4 rxomo3oytlmteluvsls)seur(o3io4ameemneslt)srta(mo;t1tlenmi3iys sDulu s u4aexnif ta1fmDranes () euo(o3iy4amtelnvi t srrmurooo1oex mfciadfs2umnmo;t0tetrxo ia1optrln o ()teumim3oudolt  icils) Dtrx pnu4tlenmicildfm2ea(vp;()tltomr iotoaD lueo;()sexm(mpoy4omt mfcil(f rta(  oo0oeenioeiydfs2eanvon()texomo3oodfp ean slt0s2trir3ou1ol nlivs t a2rmxm nt4aexn o3iltfm2ra(vo;t0 rtoirctotfmtr uvs s s2xmiopou4lltemnvtls) Dumurp;o4openmoeiyslmDumu pnu0 rtoio3iytlm eau i;s)tetoxo3iy1opte nesl(fs2urxmoot0optnmfeiltfs2emuvs u4texnmr iy1lpt lu i;s)s2um(m3iu4lm nlieils)a2rm(mono0alt mieiat aDrm(monu4tlermf3ty1fp  luei s srxr(m io4omenmnctlsfaDrmx pot0aeenmociadfa2rmn o t4aeeomrcoa1latr nvs;()t2uoimpoo1omenlivslt)sDtmum nt1tet mociad aDumn o u)artrifcootfaDrlueo s)s2toir3iydll elictls)sDuau ono0oetnmf3iysla um(mo;()aeermrciydfatr ivs () 2trxmpoo1al emfvsas artm(rpot4apen f3tydlmDrmuvs;t0 lenmo oydfa ran s (0s2xm(r iu1am n ici t  Draxr ot4oeto oeiad mDrlumpnu0tetnmf3tytoptrlivs t)tetriopoy1omtemncia(fs2rm( oot4aexn ociat mDel( s;t0aeenxoctydoatr n ol(0trurim iy1al nlivil()a2tm(monu4tpto fetyd m2rl(vo;u0 etnxo tydopDraies (0trumir3nu4ll elivsl()aDrmump;t0olenifctat a ulu s;u4tlenxo io1lp eaneo s)s2xoiopoy4opt lieilt)aDtrxrp;o4aet  oeiad aDelnmonu)tlxnmoctodfpt livo t)texoir nu4ol  mnvt s srrmumonu1altnioeiltfm2rlu s;t)trtnxoctytop rau s (0 rxmim iu4llen ieilsf 2rrx ooo0apxo o3tltfm2eanmpnu) rxrmf tatopteln i;s  2uoir ny4lm  lict s)srrm( ono4tptnif3iat s2elumo;u4arermr oytoa  ai sls)trxmirpoydome  fctl(  Dtaxrp;o0opx mi3tydla2ua( pnu4arxoxr ia1fpD aies t0trtr(r ny4lmt lfctltfaDtaumpno4opxoif3tys mDem(vs t0 rtnmfcoodfptraiei;s s2trio3oy4llenlnvils s2umu  ou1tpeoiieildla2rl(vo u4artomf todfatraieolt)srtoir3iu1amt lnvslt s2rrurp;u0tpx mfctyt m2eau pnt0 lxrmocoy1oa e nvo s0 rtr(r3oo4oltemieiat  2umx pnt1teeomi3iysfsDul( o;(4trxnif3oo1oaDean o (  rtoio io1lmtnmies s)arraxmpnt0tlxomf3tad sDra( on(0alxoir3ia1lp rln ol(0 2xm(r3oudalen nvsatfsDuau ooo0oeeo fetlt sDrlnms;t) rtoif iydlpD  uvo;() eumir3nudom elfci ()a2urx o;t4opx iietls a ranvo;(4 lenxf tatlmt  uvsl( srur(opny1lpe  ivtl( s2rrxront1apto ieiat sDulu ont4 lenir oy1laD  ieo;s0tetmio oydlptemfeilt artr(m ;t1tlxomi3tltlmDrlnmo u4tlxnxr3ta1lm ranvo;t t2uoxo3nudole  nvt tfa2rmu  oo1olt mictlt m2rl( sn()aleoxr oy1fmte ivi ()teumim ou1olenmnei s srumumoot0aet ifeiys m2ulu o;u)tlxnxo iydlm rlnesl()trtoxrpoudlltnlivsl( s2ua(mp;o1tee mf3iyt m ul( s;()aeeomo ty1la rai sls t2urimpoo4lmenmfet t) Draurpot4teen ictldfa2em( snu)aeenxrcoytom  lieols  2tmxopio4llt lneslsf Dra(  ;u1oet iicias m2rln pnu4artoxr oydlm  auvils t2tmxr3ny4lmtn nesa(  rra(ro;o0aleo octasfa2uau pnu) rtoio3ta1opt  n s t  2uo(m3io4lmt lfetl(f 2taumont4olxomociysfm2raump;(0 ltoxr3tytfm raieilt0tetriopno4lm  lfetatfsrrmxm ;u1apt iieiat sDrmnmsnt)areoxf3tatoatrlues;()trum(m3iodomen ivtasf rtaxmo;u4texn ieiasfsDuln onu0 etnif iodoaDran ols0 rtrxo3iy4amenlicilt)srtaxmont4tptomietytfaDuau o () exnirctadoaDe iei t0 rurir3ou1lle lfvtl(fsrrruronu0opeoioeiyd mDuau o;(0 etoxf3iadoaDraivil() rxm(o3iy4op eliei t s2tm(mo;o4opxomoetas m umu o t4 lermfcta1oateanvolt0t2xmxo nodaltelivtatf 2umx  nu4openifeiyt sDelnvp;(4 lenxf3io1lmtraneolt seumim3ny4am eliet s)sDrrxmpot0alen oeiad sDumnms;()teerxo iotlm e ivi;t0srto(r3ou4ap  mieia()s2tmump;u4oexnioeildls uanms t0arxrxf iytfpDr nvi ( srtoio3io1openlnei s)aDtr(mo;t4oltoiietytlmDeau ont0texoxfcoa1lm rai s (0 2uoio3nu1op emfvs s a2ururpou1tpxnmi3tlt s2emn pn()altrmrctytoatrlivsl(0seurio ny1lmee ivtl(fa2ua(m no0oex mociyslsDelnmp;u4arenio3ta1lp raiesl(0seumim3no1ale liviat sDtau  no1alxnifcilslaDum(vp;u0arxoio3ootopte ieil( s2xoim no4llt mnesas)a2tmump;o0aee io3ildlaDumnvp (0 lenif3iytoaDean s ( setmxopoo4op elfvsls)sDtr(mo;u4apx  fciadla2ul(vont4trxomo oydomDe i i;()texrxm3iydoptemncil(f Drr(rpou0olx moctlt m2ulu onu)texrmfciy1fm   i s;t setmimpno1lpte nviasfa2urx p;u4olxoioeiadlaDemums;t)tetomf io1fm eaivs;t t2uoxm3iy4opt  nvsls s2umur oo4apxoifciadfa2ulumo (0artoif3oy1fp elnvil(0s2xrir iy1amtnliei s sDtrumooo4aex mociatla uluvon(4tlerxrcoy1fatr u sl()trtmxo nu4lmtnmivs () rrmxr ;u0oleniocildfaDrlu o;u0tlerioctytomDeanvo;( seuo(rpny1ap nmfciltfsDtru pou4aetomictys s2ea(mpnu)alxoiociydfmDe ivs s)teumxr nu4opee ies ()sDum(m ;o4ape iieils s2ra( pnu) renif3oadfmDrlnvo s0srum(m3oy4lpenmivtasf rta( pnt4altnmi3iadfa2um(vo;u) rxrxr iadfa eli o;s  rxoxo3oodolte ici sfsDurxmonu1tee ii3iat a ea(mp u)aeeriocoa1lpte ueolt)t2urir oy1apeemicia( a2uaxmoou4opxnmf3ilsfa2emn p;u0teenir iy1lmDranvi s trtmxr no1lmt mfcta() 2tau  ;u4aeen ietasla el(vsnt) eerxr3oa1omDelu i;(0 2umxo io1omtn ivi ( srua(moot4oet mf3iyt sDum(vpnt0trerxrcootlmteln s s) rurxr3ou4al nmfvi s)s2rrumpou4aptnmi3iltla rm(vs u) exnif oy1fmt ln o t0s2umim3iy1ll nlnvi ( s2urxmont4oeeoiieiltfs rm( onu4trtrxoctadlmtr u o (0texmiopiu1am nlfetl() 2uaxrpnt4aptn f3iyslm uanmp;(0 eenmf oy1faD  iei t0 etm(opio1apt lfetlsfaDur( ont4opxnio3iadlmDra( o;u4 eerxocoatfmDeai o (0t2trir io1al nlivtat)aDua(r ;t4openmictls sDul(monu4 rxrxf tytopDrlueils0tetm(o no4aptelfct tfsrtaur ;u0tpt mfctaslaDel( p;u4 reomo3iydopteaies;() 2xmimpoo1aptemfvtatfsDrrumpou4alxo i3iadfm em( s () eerxf3ia1laD lueo;s0 rumxm3iy1apt lici t)a2rmur ;o0oee  fciydfsDrm( o;u0aeeoxociy1opt anvil(0trtrxr oodoptelfctatfs2umxmooo1tee ifeilt aDrl(mo t4aleoxr3oa1faDr i i t) rumir iy1al e iesa(fsDtaxroot1alenmiciyslsDrmnvp;u)alxoxr3iytlptrauvi;t)t2xr(r3nudop elivs (f 2rrxm nt1olx  o3ilt a ulu sn(4tltomf ty1oaD  nvil( seto(r oo1ll nlnctat a2rrxmpot4tpe iiciys a2rl(vo (4tlenmr3tatfa e n i;() 2trxr ou4oleemiesls sDta( pou1altnmfeiltfaDumnms;u0treoxo ta1lp r nei;s0sruoir no4omte fcs ( aDrmxrpou4tpxnio3tlt sDrl(mo;t)trxoxrcty1fpD lnei t) eto(r ny1lltnmfvsls)arta(  ;o0tlt  iciltls2uluvp u) ltrir oo1oa eln i s)trtr(o3ny1llt mici (f Durxm no1tee  i3ild mDrm(mon()arxnirctadoateaiesls0 rxmxr nu1lle mnctas)srumur ;t1opxn i3tltlm2uan p;u0trtoif oo1lpDr nvolt)setmxm nu4lltemfcil(fsrra(r nu1tptnmoeiyt a ranmo u4altnmfcootlpDrluvsl() exmxm io4lleelfviat) rrmu oot4aet  oetyd a rmuvont0 exrirciy1op rlnei;()trtoxrpiu4ope  fctas sDumx poo0tpe ifeiyd m2rl(mo u) rtomf3oy1fpDe ieo;t)sexm(rpoy4am   ivtas arrmxmooo1aex io3iydfa uauvs;()trtnmo ia1fp r ivo t)srtrim iy1ole lnetls)aDrrur ;u0olx mfciytls2ea(ms;(4artrir tadomD anvi;(0 2uoxm3oo1ap e ivi tfa2raurp;o4alxnifeiyt s ulu s;t)texoif iatlm r ieil( seuoim iu1amt  fvt () 2rm( o;u4apen oeils s eauvsn() ltrxfciatfa rlues;s t2urxr iu4opee fvsa() Drr(r nt1olt iictysls2rm( o t4arxoifciatlaDe nvs;s)srum(mpnu1lpt  neslt a2uru ont1oex  ieiysfm rm( p;(4treoxrctodom r n o ( trxmxopoo1lmtelnvsls  rumur ot1aetn oetadlmDrmuvp;u4texoxf3iytfp r uvolt)s2urxmpoodlle  nvt sf ruru ooo1optomi3tyd sDuau p t)teermociy1fa e ieo;t0trxo(mpny4lm nlnesltfsrumuro;t0tleoifcias m umnms u) lxoxr3oatfm rauvi;s texoimpnu1lp   nvt tf 2taxr nt0optn o3iad sDelu sn()alxnxr3iotfp r i slt0 2uoxm3io4amen fcsat a2urxmpnu1opxo oetydfsDrlump t)altrir3oa1fpDeaivi t0 etrimpio4omtelnctltf rrmx  oo0tptnioetas s2uan p;u0artnxocoy1fmtrlu i (0tetrxr iydomeemfesatfsrrrur no0opxniietydlaDua(vpn()arenxr3oydla  lueilt0setm(rpno4oltelnet t) Duaumoou4aexn f3iydls2em( p t4 rtnxo3oy1oatr nvi ( t2tm(o3nu1amenlfvs t)aDrauronu4openmfeiltlmDea(vs;u0tltrxfcootlaDrluvs;t)sexoio oy1ol  mnctasfa2raxm nu0tlt mieiysfs ean s;t4tlerxf3oytla eliei ()setoio ou4lm   neilsfs2tm(rono1tlt  ictlsla2ulump;u4 rxoxrciodopte uvo;t  2um(o3iodoltnmictls)s2rmxmp;o1tlx  ieias a umump;u4altnio todfaDeln s t0 2to(o3oo1lpen ncs (faruau p;o1oeeoii3iysfmDra(mp u)trxnir3to1fmteau o;s0 2um(r oodoptnmfvsat  2rru pnu0olt moctlt s2ul( s;t4 leoxr3ty1oateli s;t0 2tm(opiy4al nlncsat) rumxro;o1teeomfctadfa2emuvp;u4tlxnmocia1omtr n o t)texoim oy1lpeemneta()sDta(rpnt0aetoii3tysls emnvo;u0aetnircto1omDe n o t)sexrim ou4lpeelncta( aDuaum ot1tee  ietatla2ea(vsn()tlerxo ty1om  aivi (0s2tr(m3iu4lpe miei t arraxr nu0oeeo o3iys aDem(mpnu0tlenmf3oatlaDr iei t t2urim oo1apte fvtl( srurx pou4altnmoctasfsDranmo;u4aeerio3iodlpt ai o;t0trur(m3iy1opeemfvtlt) rrrx  oo4oet moeildfmDrau o (4 rtnmr oodlpDr ieo s)s2ur(rpiu1olen icta( aDumxr ;u0tlxomoeild m rl( s t0alxoifcio1faDr u i s0t2uoimpiu1aptnmnvil()artmump;o1oeenmf3iydlm uluvp t4aeermrcta1lpt  u s;( s2xmio no1op e ivi s s2tr(r no4tpx  f3iyslm2umumo u0treoir3ia1opt  ivol( texrxr io1optn fcsls aDraxrpot1tetn ociltls2rmnvonu)tlxomfctodfat  i ils0 rtrirpoodop  micia()arrmumo;t0tpxn o3iltls ulnmonu0treomf3iatopDrlnvi;s0t2xmxrpoo4opeeliet s) rtru o;o4aetnmoeiatls rm(vp u4alxoio3io1fp  luvslt) euoxm3oodomt mfvtl(faDtr( oot4aetniociatlmDua( sn(0artoio3oatlmDeaivi;t  etm(o iu4omeemietltfsrtaxm no4alxnmo3ias m2uanvp;()aetrmr3oatom rlues;t  ruoimpoydol  lnet t)a2taum no4tetoioeiydfm eluvp u0trxoif tatomtr i s s s2xrir3iudomeemnct () Drmurono1altnmiciadls ra( on(0arerif3ootfa eanei;(  ruoxm3iudlp elivsas) Dumxroou1ale  o3iat sDul(vs t0tetoxrctadfa rau sls0t2umxm3oy1lptnlfei t aDtau  ou0texomfciad mDuaumo;t4 lenxo iy1fmD anei;(0texoxm3iydop nlfcils)sDraxmpnt4aeto i3tytlm em(mpn() eerxf iadlptrlivo s0s2toio oy1lmeemieias)s2raum nu0tpx mieilsfs rmn p (4 ltnxf iotomDr neo;t) exmirpou4llt  ivtatfaDumumpot0oeen fcildfa2eaump (4 eeomo3oa1fmD ln o;s0 2xriopoudap  mncs tfarumu  ou0tpt io3iys a emnmp;t4alxnxr oatfmD livs t srxoimpnu4lmen netlt)srraump;o4tpx ii3tyt aDum(monu0 exnxo3to1fpteln o;s0texr(o no1ap emncil( a2rrurpoo4opt  ocilsfs2umn onu4tleomf oadoateanes s s2to(mpny1alt lfet ( srtaum nt1tpenmieiasla2elu s t)tetoio to1op eli o;s) rtoim iu4om   net s aDrr(rpnu4tpeo fctydfa el(von(4aetrio oytfpDrai s;s0texr(opiudal e fvtlt sDta(ro;u1optnmi3iyt aDea(ms;u0arerio tytoa rluvslt)s2xmxrpiy1lltemnetatfsDrmxrooo4alenif3iysfm eau sn(4 exnmo io1op e n o t  rur(o iodalte fvs t a2ta(ront4oeeomoeiasfm2eluvp;u4arerxr tytlmte n o;( texmir ny1lmenmfvsas)srur( o;t0oetn ictatla2em(msnt4 ltomo3oa1opteanei ()setrirpiodam e fctat  rrru ono4aptomi3iltfm uln o (0tlxrxf3iatoa r nvs (  2uo(r3nodomtelnvtlt)aDrm(rp;u4ope mi3iad s2ulums;(4 exnmf iytfaDeaies ()sexo(m iudol nlivi s  ruaxr no1tleoiiciasfs rm(ms;u) renxfcoo1op rau o;t0 2urxmpnudlp e net sfarurxront0open icils mDrl(vo;t0tlxrio3oodom elues;t0t2umim oodopte ivtat)aDtrur ou4altnmieiyd m uluvo t)treoxfcoytlm raivi;t)t2xo(m3oudopt mfctas) Drmur ;t0opx mf3tat m2rl(mpn()tltomr3tatlm   n o (  eto(mpnodome mnci t)s2rm(rpnu1aexn i3iatfm2uluvpn(4 rtrxo3oodlat lu sls texmio3nu1ale mieiltfs2umu  ;t4alx ifeiat m el(mp (0aleoxf3oo1oa rluvsls0trxrimpny4lm emiciat aDrr( p;u4tpenioctat s2em(mpnt)arerxf3totomt lu o t)s2toiopiy1altn net (  rtm(  nu0olt  feiltfs2uan onu0texrif todfa rlueolt  rto(mpoo1lptelnesas  rtru o;t0tet mo3iysfm2um( pnu0texrmrcio1op ranvol()t2umim nu4ll nmfesasfaDtrxm ;u0opxo i3ilt s2rl(mo u4artnxo3oa1lmteaivs s t2xr(o nodoltemnet (faDua( onu4apx ifeild mDelumonu0arxnir3oo1laDrauei;t  etoxr ou4apte fvtlt  2ur(m nt0oeeomi3iadfs rm(vo t4tltnmo ta1fmDr u i;s0t2um(r nydal  lnetat aruru pou4teeo f3ild a2ran s t4aetrmf3ootom raieolt texo(rpiodale mfvtasfartrum ot1tee iociys sDeau s;() leoxf oatlpDeauesls0texrxr oo1ape mivslsf Draxr oo4alen oeiyd sDrm( p u) rxriocty1fm ranes;()t2xmxo oo4omtemicta(  rtmurpou4oex  f3tys m2rl(vsnu)tleomf ia1omDelues t  ruoxr iy4ap  mfetat) 2umxro;t4apt  oeildfm ua( p u0 ltnif3oydfmteli slt srxoxo iu1ap nlnvs ( aDumxro;t0oexnmfcias a um( p;u4aeeoio3iy1lmtrau o (0 rtoxm oy1lmt livi tfarumxrpou1tee iociasfm2em( s u4 rermf ia1fmtelieo () rxm(rpoydaptelneia()sDumump;u4tpxn octldfa rmnvs (0arerif oy1oa  anvsls  2tm(opoy1aleemneias sruaurpoo1tlt mo3tadfs2elnms;t0areoir3ootoatr uvolt trtmio iy4am elfcsas  Drmxr oo1aexo f3iysls2ea(vs;u4aexomf iatlatr ivo;t0s2trxmpiu1amt mnvsltfa2tax o;u4apto fcild s2rmumpnt) rerxr3tadfp  aneols0 rtoir3nodop e netltfs2rmurono4aetniieilsfm2umuvon(4 rxrmo3oa1lmt  iei;t) rxo(mpno4o
\ No newline at end of file
@@ -0,0 +1 @@
+uvsls)srxoim3io1ol e fes t)srum( ooo1teto ieilslmDumu p (4aeenmr oadoaDeanvo;()seumxm iudlm  mnetasf Dtaurp;o0aex ioetltla2elu onu)tlxomr3tydopte uvi;s0 2tmxr3nu4ol  mfvsls)aruaur ou0tleomfctadfa emuvp;()tlxnxfciadoptr uvs (0t2toio iudal nlnvsa() 2rrur ;u0oexo feiysfa2uanvo t) lxomo totop  luvslt)texoxm ny1ol  livtlt)sDtrxrp;u1opt  o3iys aDulu ont4trtoio3ootlm r nvo;s) 2trxmpnu4lpt mncta(fsDtaxmonu0oeeo i3iyslaDrmnvp;u0 etnir iadfpt aneolt0srtmxm nu1omtnmiei sfa2rrxm nu1aptnmo3tydlm2uluvs t) ltrirctydfmteaivol( t2xr(r3oudlm nmivsa(f 2raxroou4opxnmi3ilt a eanmp;t0 ltnircty1laDrluvs;( srtrxm3ou4lpt  nct t s2umxm ;o4oleoifeilsfm2rl( ont0aexomrctotlaDr nei;s t2um(m ny1ol e ivtas sDrm( o;o4tlxomoctldfa elnvp;t0tetomr tydom rai o;s seuoimpiy1llen icsls)artau pot4tpxn ictld s ua( s;()areniociytlm  au o ()s2xmirpoydole lncilt aDtaxmoou4oleomfcildfm elums;(4teeoif oydopD aieil()s2toxo3oy4alt mnvs t  Drr(  oo4aexomietlsls eanmo (4arxnmf3oytlp ranvs;t t2toxm io1optn neia(  Dumxmpou4aetn i3iad m ulnvo;()tetoxo totoaDr ivi t  ruo(mpiydlp nlnvsa()s2taurooo1oetoiociad s el(von()texrif3iodfm   nesls)t2xr(r3oodom   nesl(  2umx p;u1aleo feiat s2emuvpnt0 eerxr3ta1lmDe u i t0s2uo(r3no1ll   fcia(fsrrm(r ;o0tlxomfeiyd a2ulnmsn(0 rxoxf3ootfp   uvi t)seurir3iydoptnmnvs t  Dra(r ;o0aptoifciyt m2rl(mp ()aetrif ia1fm eaivols srxrirpou1oltn fvslsfa2taumono4tpe if3ildfa2ul(vo;t) leoxf totfa rluvo;( trumim3io1oltemfesa()sDtm( pno0altomfetls s2um(mp t4alxomf tadfm r nes s s2xrim no4lptemnvil()a2ururp;t0tptniietytls ranms;u4 lxrio3tadlpt  neil( texrxm ny1lpee ivsatfarrrxmoou4tlto f3iad aDua(mo;(4aetnmf io1lp  ln s s t2xmxm3nodlp   fcsas arrm( pnu4aeen fctltfaDuanvo;t0aetrxr3iydla   neo t  etoxopoy1aptnlfeiat) 2tmumpou4tlt  i3ils a elnvo u)artomr3totla  an ils0teumiopnodalt mfet t  2rrx pnt0texomieiydfs2ea( o (4trenmocto1opD aivol( seumio3no1olt  ici sfsrtaumpnt0oltomociytlm2rlu o;t0tleomrcoa1omteauvi (0 exo(o3oo1amte ivtl(f 2tax  ou0ape  f3tydlm2uluvp;t) ltoxo ootlmDelueil() rxm(o ny1lpen fvt s)a2trum nu0texnmfciydla ea(monu4arxnio3iytlp e i i;s) etoir3nu4op elnvtls) rrau  ou4oleo ieiyd aDea( s (0 eerxfcta1omtr uei t)srur(opoy1op e netlt) rumu ooo0tetnioctasls rlu pnt)tlerif3tatlm rln s s)t2umio no1openmfvil(faDrrxmooo0olt ifeiys aDua(vp;() ltnmf to1lm eanes (0trtr(r3no4alenmfesas sruaxroot0ape iictadfm2eluvs;()trtnircoodomDrai ol(  2uoxo oo4om   ieia( s2rr(moot4opeomieiydla2ran snt0aetnxf3iadfpt aiei;t sexrim3oudal nmnesat)s2ua(  no4texn fcilt a el(mo;()tltomr3ty1fpDr i i t tetoxo iydopeemivsas  rurxm nu1opxniietlslm2umums;t)teerxfcoodomtr neol()setrxm iodaltn neslt s2urxrpot0open oeiltlm emumo;t4tlxrxrciydlmD an sl( teur(o3ou4lpe mfcs tfa2ur(mpot4aexomfetltfs em( o;u4trtrxr3iy1oatrlivs;s0seto(o3no4ape mnctl(fa2urumoot0alx mi3iys m em(ms t0 lenxf3iadlmtrauvs;t0tetoio3iu4lm  lfvs (fsDrrx  nu1tpxnioeiytlsDumuvs u4altoxfcoy1fp raieslt0t2uoir no1ap nlnetat)arrru ooo0apto ietysfm2eauvpn() renmo iy1lmtraues;s t2toim nodopt  nvt (fa2rmuronu1tlxomi3ildlaDum(mp ()trxnmo oydfat  ieo ( t2xoiopoydllenmfvil( a2ra( onu4tptomoeils s emnms u0arenmrciatfm  lnvo (0srxo(rpiy4lm  lieiat) rtmxmp;o0altoioctysls2ranmp t) rxnmr3iotfat luesl(0srum(r oy4alee ictasfs2tru  oo1oexnio3tyd a2rmn on()arenif oa1lm eaieils  2tr(rpnudaleemivt s aDra(mp;t1olt ifctatfs2rlums;t4texnifctadlp rlu i s)texmxr nu4op nlicsls aDtmxrpot1oetnmociysfaDumu p;u4tetnxf oydfp e ueo t)sexr(o3iy1oltemncs () 2rm(m ;u4oeeo f3iadlm emu snt) lxrioctadomDrauesl()trxoxo3nudlltnlietasfsrumxm nu0aexnioetat m2rmnvs (4 lxnmfcoatoptrauvs;s sexmimpiu4lptnmfcia( sDtaumpou0openio3tytfmDrl( p u0 etnmocio1lmteauvi t)sruoio oydom emivtlt)s2rrumo;t4alxniociadlsDrmu o;t0 ltrxo iydlatean s s)t2trxr3ny4lpe lfetat  2raur oo0oexoif3iltlmDea(mo t)arxoir io1fatean i;t) rtr(o iu1lm e fcs s srumur nt1optoioeiad mDrl(msn(4 lxnmo iy1fate i i s)s2trxo3iy4openmnesa( arum( onu1oexnii3ildfaDel(vs u4teeomf3iydomDrlnes ()teuoir iydomen fcslsfs2umxmpot4teeoioetasla rau pnt0artomr oydfmDe u s t s2xoio3iy1lpt  neia()srtaxmo;o0tet  ictysls emuvs;t4artnio oytfpDrlnvsl()s2xrxr3nodlpee icsatfarrru onu0alxo o3iydlmDeln sn(4 lxoxf3iotlmteln s;t)seurio3nu1opt  icsatfarumuroou4oex mieiasfa rln o;u0tleoircoo1lmDeln s t  etoxopio1ale lici s)aDtmxm ;t0tpt iociadfm eauvpn(4 reomo3iatomDraueo ()s2xrio3ou1om  licslt srtax ooo1olen ietasfa elnmon(0 lxoif iytoateluvo;s0seurxm3iudom  mivilsfaDra(mp;t4apto f3tydla2uau snu4 etoir iy1oatrlnvo s)sexmxr3iydamtn iesa(fa2um(rpou0ope  fciyd s2ra( onu4 rtomf3oydfptran i t t2xr(m ou4lp  lictlt) rua( p;t0oltn oeiytfaDrm( p;u0tltoif todomDrlivsls0 rxrirpou1apenlics t s2ur(mont4tlxnif3ilsfa2emnmsnu4teerxo iatlpD au i;( srumxmpnu4am emieiasfsDumu  oo0opxniicilsfaDem( sn(4areomr3ty1fa  livo;()srxm(o3iy1lpeeliei s)sDtmxronu1opx  ictad a2em(vpnu4altnxfcootla rlivs (0s2trxr3iodlp nlicsasfsrum( poo4tet mociasfa2rmnvs;t)tlxnmrciytlptr ieil()srtoxm3io1omt lfeta(fa2raur nu1oetomocildfaDumumo (0texoxo3ta1fm rln i t)s2tmirpiy4ame mfes (faDra( p;o0ale  o3tat m rln p t0 rtrxrciadfatr n s s s2xoxopiodlltelnvsa( sDuaxmo;t4teenmi3iat m rlu pn(0 rerir3iotlmDrlu s s)s2toiopnydlm e nesat)aDtrurp;t1aeeo octytfa rmnmo u4altrmocoadlat lnvils teuoxm ny1apeelfvtat  Dua( p;u0tetoioeiad a elumo;(4teeoio3oydfmDelues (  eurir3ou1om e ivs tfsDuru pnt4olxo i3tysla elumo;(4 lxrif3oodfaDrau i s srxrio3no4ll elfvslt)srumumo;o4alxomociltlmDrlnvs;()arenir3totopDr ivo;( teumxmpoy1llt lncs s)a2ua(m nu1apeniiciatlsDel(vs u4 rxoif3oytlpt ai s s0s2uoiopoy4lp   nvsls  ruauro;t1tle mi3iydla uluvont)altrir3iodoa e ieo t s2trio3oo4optnmfesl(fa2tr(  ou1ale  iciydfm2ean sn(0 renmr iotfateai s;s0setoxrpnodalt  feilt)srum(moot1ole mf3ildla ra( s;u4alxrxr3iy1opteliesl() rtrxmpno1oltnmfvtat  Drr( p;t4oet ioctydfa2eluvo u4aetriocootfm eanvol()srtr(r3oydap nlnvs tfaDra(rp;t0olxn o3tytfa2rl( on(0 eeomf3totop e nvi;s0 2trimpny4ope lnet t sDuaur ;u1tetoioctlsfmDrau p;(0aeermrcoadoaDe i s s0srxo(m oo1altemfcsltfsrtrx ono1tpeoifctlsfsDrmu snu4teerxf3iodla r nvs s)texo(mpiodllenliesa( arrr(m nt4aex mo3ildlaDuluvonu0 rerio tytlp eaieslt0 2xoim oo1lme  nci tfsrrmu o;o4opxoiociys s2uluvp;(4 ltrmo oa1fmDr ueo;s  etmxrpnu4llen nct (f rrmx ono4tpeo i3tls s2ra( p t4alxrmo3iytlpDe u slt teumxo3nodal nmict ( a2rauroou4olto oetadla2uln p t4aetoxrcoatfa raueolt srxm(r3oo1op elnvsa()aDrmx  ;u4opx iiciydfa em(vp;u0trxnircio1la eauei;t)s2umio3io1omtn ivsas srrmum nt0apxnii3iysfa2rmuvs t) lerir iydoatr ueols0t2xm(o oy1aptelici ( srum(m ;o1apeo feiydfm2uan pn()arerxf3tytfaDeaieslt0s2um(opio4al e fvi s)arurur ot4tlt iietyd m2rmnvsnt4 reoxo3oa1fp r ues;(  2xmxr3iy1amtnlfcs t sDtrur nt4ale mo3tlt a2uan pnu0 lxnmo3tatlaDeaivol( t2ur(rpnydalt mies tfs2urx  no1openio3iadfmDrl( pnt0texnmoctodlp r nvi s0t2xmimpny1lltemnvs (fs2tmum ot0tee moetld sDum(vo;u)teeoirctotlmtr i o;s0sexmxr ny1lleelfci s artm(monu1teeo fciytfa2umuvpn(0aleoxr totfaD anei s s2xmxm iydole lnvsl(fa2umx oou1tlenmieiltfaDul(mo u4 renmf iytoatraieo;() rxoxo nu4amt mnvt s arra( oot4alt  ieiadlsDul(mp u)texoir3oa1lpt ai slt0srto(r iy1oltnmneiasfsDuaxmo;u4alxn fcilt a2ua(vp ()artomo3totoaDrlieo s) rxo(rpoy1op  lncia()a2ur( pnu0apx  ietlsla2em( pnt)treomf3to1opDelnvo s0tetm(r3oy4ol emivi s sDtax oot0tpt iicilslmDumump t)texnir todlmDr n o;s)truoxo oydom nmivia(faDrrxmpnt0oexnmf3tytfs2rlnvpn(0altrmr3oydfa rlnvils  2tmxr iy1ol e fciatfaDuax  no4altoioeiatfmDemu s (4 lxomr ia1oat lies s t2xrir iydlp nlncilt)s2tax  ot4tltn feiltls elu pnt4aleoxf3ta1oateauvo s teurir3iodlm   fcs (f 2um(m oo0aexo fciysfm2uln p;(4 ltnmr ty1op  an i (0 euriopno1apt mfci t srrax pnu0alxoii3iytfm ulu s;() leoircta1oa r neol(0t2toxm iudapenmfeta(  Dumxrpoo4tpeomoctldfm2emnvsnt0trtrmr iatoptean i s0 2ur(o iodlpteliciasfa2raur no4oee  fciltlsDuan p;t) leoir3iy1fp elu slt)trumxo3oo4ale lncsls) rraurpoo4aeen octldfa rlu o u0aeeomo3oodfm rluvs;t) 2xo(rpiydol  mietasfsDumu ooo0opeomoctyt sDua(vp u)aeerxfcta1fmDrlu o s) eurir iudom  mncsas)s2tmu  ot1tpe ifciyslaDelnvs;t4 reoxociodlpt lu i;s) 2xoio iodol nmfvs s)arraurpoo0tle ioeildfa2umnvon()artrmo todfpt an o;s0s2ur(m oy4omte nvsl()sDtmu pnt0tlx mi3tltfsDemump (4 ltniocootoa  anei (0t2um(m nu4lpee ncilsfa2uaxrpno4aptnmictls a em( p t)areriociy1lp rlu o;t0s2umxmpoudop emivta(farur(  oo4aexn o3iltla rm(vont0trtnmo ta1fat lnvil( trurirpio1apeelnctlt aDtmx  ;t4teeo ieildls em( ont4trtrxr3iodlmte uei;s0srtmirpiu1optelfvi ( arrmxrp;o0aetoii3taslaDuluvsnu0arxomf oy1opDrli o s s2uoxo oy1al e fvsltfa2tmumpou1apx  ictatlm2rlnvs;t4 eeoir ia1la r ivs t)srumir3iy1apenlnvtl(f rta(  ot4olxomi3iadfa eaums u0aleoir3io1omDrlivi s)seum(opiy1ale lnvi t) Durum no4oet mo3iyd a2umu snu)aexoifcoatopt livi ()seuoxopny1op  mictlsfs2urxrpou1olxo fetatfsDea(vp;t4aetrxr io1omteaiei s teumxm no4lmtnlnvt tf Drmumont0texnio3iyd a2rau on(0trxnxocio1faDraieo;s  2umxo3oodlptnlfcs s s2tr(r oo1oltnii3tyslm2ranvs;u4artomf3iydfpte uvi;s t2xoir3oo4al emnviatfarur( ooo1tlxoio3iys s2uanmp t0 renxr3io1opt  nvol( srtm(mpno4omt lietas aDuaumpnt4tetnmocias m rl(vpnt)areomf iytoat auvo s s2toim3nu1llenmnciat aDumurpnu0apenmictadfs ra(vonu) rxnif iatoaDeai s s srxrxmpoy4lm   fctltfsDtr(mpnt1olenioeiad a2ulumpnu)aexoir3iytlp eli o s trtoio3io1olt  neilt) Dtr(r ;t0optn o3iat a2em(ms;(4tlxrifciydoat ln ols)t2uo(o3io4ll nmivtltf 2tm(m ;u0olto feildlmDul(von()tetriocoadla elueilt0t2xo(m3oy4ol nmiciasfa2uaum nt4tpe mfcils sDean o t4aexnmocto1oa rlu i s0texoio oy1altemivtasfaDraxro;o1apeo o3iytfs raumonu) rtoirciodfaD au i;s0 eurim3nudlltn fctl( a2trurpnu0tetnmociydlm2ul(mp t) rxrioctotlmtr nvs s  euriopny1al   fciltf Drru  ot0aet  o3tlt s el( snt0trtnxo3iydlmD livo;(0truriopiodopt  ncias srta(mp;t4opto feilsfa ulums;u0alxoirciy1la rlueo s) 2xoio oodaleelfeslt a2umu p;t1tpxo ociydlm uanmo ()arenmr3to1lm r n s;(0srxm(m3oo1lmeelnvsa(f rrm(  ;o0apxoii3tatlsDua(vo;() rtnircia1fp elnvo;t0 2tr(o iydlpenlnvi sf 2rmxmpnu0ale  fctls s2uan o t0alenmociytlptrlu il()trtoxr3nudol  lnesatfarumur oo1aptnio3iat aDrm(von(0arermocto1lm raivi;()trxo(opiudomt micsasf rumxmo;u1alt ioetasfa2ea(vs ()tltoif3todfa r ues t0 etm(m3nudlmt  nvslsfa2rrum ou0teeo o3iat a2ulumpnt)tetrmo ootoaDr nes t)srxoiopoydlpeemfetas) Dtr(mp;o1alt mi3iatlaDelnms;() eeomociy1op eluei;s) rtoiopiudapt lnct s) Dra(root0tlxn oetadfaDua(mp;t0 etnmr tadlpt anvi;(  exm(r iodllee ncsa()srrmxro;t1olen o3tat s2ra(vo (4aetnxr oy1oaD ai sl()srxrir oo4ape  ics (faDrm(rpnt4opt  f3iltfaDrauvs;u4arxrio3ootoatelneolt sexrxrpiydamt mfctls sDtmumpou4olxn feiysfm el(mp;t4alxnxf3ia1lmDeanvsl( texmxr io4lpeemivt t) rrrur nu0oee ioeild a ea( s;u0arxrxr oydfatranvo;s)srtr(opiy1lle  fvil( a2tr(m ;u0tpeomoeiys a eanms u0 reoxrciydfpteanvs s srto(opiy1lmt mics (f 2ururooo4apenio3iaslaDean s;u4treoxf3oo1op e nvilt0texrir oodllen ieil(f Duau o;o1tptnii3tatlaDul(vs (0aleoxf ty1oa rlnesl( srurio3iu1ll n nci sfa2tm(rpnt1texnmietasls uluvs;u)tlerxf ty1fate ivo;()s2tm(r oo1opt  feiasfsDraxmo;t0tlxo ictatls rm( o u0 rxnmf3ootfate uvsl(0t2xr(rpiy1aptn fvs ( s2trxmo;t1oleo feiadla2emu o t) etrio3oodfmteaieslt0 rxrio oo4alee fctlt s2trumo;o1optomoctls mDel(vs ()alxrir iytom  aivs t truoiopoydopeelict tf Drr(r ;o0opx ifetatfm2um( sn(4 ltoxf3ty1lpt  uvols  rtrimpoudlpt  ivsat)s2tau oot4oexo octyslsDum(vo () lxnmf oy1op  lneo;(0 rxr(opoo1apt  icslsfartrxrp;o1tptomf3tydls em(ms (4 reoxr3tytfmDr nvol(0s2urio ny4lpt mnvtat a2urxmono4tltn oeiadla uauvs (0tltoxr tatomtr u i;s trtr(r3ou4amtnlncilsfs2ua(  ;o4alx mi3tas aDea( o;t)texnmr iatomDe i s;s  2to(rpnu4optnmiesasfsDrr(mpoo4olxo octltlaDelu p u)texoxo3tytoa   n o s0 etr(rpiu1lptn fcs ( srrax  ou4aex  o3tltfs ul(vs;t)trxomrctydlm e uvslt)srxmir oodomtn iet ( s2tmxmono4tle iicildfa2em( on(0tlxrifcto1lpteluei s)srxo(opiy4ole lics tf Drmxrono4oexoiieildls2elu s;() rerxrctydom  auvo;s) rto(mpio1ale mnvsls  2tru ooo0tlxo i3tat s ulnmpn()alermr iadoaDelues;( sexrxrpny1op n fvt t)aDumum nu4ale mo3ild m2uanvpnt)tlxrmr3oytop eln i;(0t2uoxmpiodlmt lfes s arum(rp;t0oexniieiltfm2rm(vs;u4 eeomrcio1fa   nvs t  exrio iu1ape mnet ()s2rm(mo;t4aeenioeias m2ua( o (4areomfcoodoaDe ivsl()trxmio3io4olen fct (faruau p;u1opt if3ilsfaDemuvo t4altoir tatoatranvs s trurim3oy1lpt mnvtatfarra( oou4alto i3ild mDul(vo ()alxoxo3oytlp eluvs t  exrxmpnydlpe mfvsa(f 2ra(  oo4olx iociydfs2elnvo;u4artoio3iydoa elivo;s0 etoxr3oy1om emnesa(  rumu  ;o1aetnmfetat a2rmnmsn()tetrio3ty1fa rlies;t0t2xmxr3nu4oltelnctas  2tmum nu1tetnmieiltfs2rauvpn()trxnif3todlat lnvs t0 etrirpoo4lmt  fes s a2rmx o;o4olxo icils m umnmpn(4 exnxf totoat aneo;()srxrxm nydllenmnciatfa2ra( pot0aex  ociasfa2emu p;t)trermf iodfpt  ueolt)srxo(o3io1lmee netl()s2rm(  nt0olxniicias m elnvont) etnxrcoodomDe ues t0t2xr(o oo4lpeemnct ( srrmuro;o0tptoiictasfm emump;u0artrir3ty1lat  i o t0texm(mpny4ol   ivslt arurx  ou1oexoii3iytlm2ua(mo;(0tleoif3oo1lmDeaueslt) 2urxm nodaleelnct tfsrur(mo;t4aeen ociaslaDuan o u0 exnxfcoatfat luei;s) rtm(r3nu4aleelicil()sDra(r nu4tlt mo3iad s eln snt)aleomocty1lptelnvi t) rum(r3io1op  mfeils)sDuaxmpnu0tpe mfetydfa rlnvo t)altoxr3oa1lp e ieo t0trtoim3ny4om emfeia(f rum(r ou0tpeomo3iydlmDuau o;u0arenmo3ootop  lieil() 2uo(m nodlm eliei s)aDrm(mo;t4oexnifeiytlaDraums;() rxnxo3oadopt auesls) rxmxm iy1lpt mfcta(faDtrum nu1tpt iictad m2rm(vs;t0 rxnif oo1lat  nvils  rumxm no4optn fcils sDuaum ou0alxnio3tytla2ra(mpn() ltrxo tydopDrau ol() rtmimpno1opt  ict tfa2rrurpnt0alen oeiytlaDeau s;u)trtoircoa1lmDe ies s teto(rpno4ll  mnetl(fsrtrxmont1tetoif3ilt mDelnmo t4arxrmf3ootlate ueo t)trto(r3oydlm   feias a2tm(r ;o0tptn o3tas s2ulump;u0arxrmrctatfmD lueilt) 2umxopnodopt licta(fsrrau pno1tlen fciasla2ra(mo u)arxoxf3iatlatr uvi t0 eum(m3oy4ll elnviat sDuax  ou1olx iieilt m ea( snu4tltrif iy1fmD  ieo () etrxrpoudlleemiei t  rraum oo1tex  ictlt a rlnmp;t4tltrmrcoatlptr ivs (0texr(mpnu1oltelfesl(faDurxrp;u1open feiydfm2ra(vsnt) rxrir3tadfmt lnvi;s  2uoim no4op e ncias)srtr(m ot1tlxnifctys s2ean p;t)aeeoxrcto1oa eln o;(0 etrxopou1al elnes s)s2ra(  ;t1tlt mietatlmDum(vont4alerio iydfaD ln slt) etrimpou1apte icsa(fartr(mpno1alx iocias s2ean p;()teeoio iytlm  aneils)trtm(r3oy1llee fvtlt)srtaurpno4opt mictltla2rmumon(4trtnifciadla elues (  euoxo nu4opte icsat)srtr(mpoo0tet ioetyt sDemu o t0tltoxo todfat ln olt0trto(m3iu4lp eliei ( a2tru pnt4openmociadlaDrlnmp;t0texoio3oydfpDranei ( texm(o oodlm emfcsl( s2tmx  oo1oexnmo3iysls el(msnt0 reoio3iy1opt aies;(0 rxo(opou1opt lnvt (f rtmx  no1opxniiciatfsDuau sn(4teenmr ta1om  li il(0setrir iydaptemfvia()sDtaumo;o1tpeo fciysfa2ra(ms;u0alxnir totfa elnvil(0s2uo(m iu1lpt  ici s) rrm(r no1tpe mfeiatlm2rm(vs;() exrir oytfpD ai i s0trtmxr no1al nmfvil() 2tm(rpou1tee mfciydfa2raums t) ltnifcoy1fpD lueol(0srumxr3oo1ap elfvs s)aDurx ont0ole ioctysls rl(vo;u4 exoxr ia1fmte ieilt texmimpnu4alee nesls aDuax p;o4apt mfctas aDumump;t0areoirctytla rli o;t  2xo(r3oudole mnciat)srrrx p;u0olxoioetytfm2rl(ms (0arxnmr oy1lm rai s t) 2uoirpny4ome lnet sfsDrm(rpnu1tetomiciadls2rl(vo;u0teenio3ootfmD auvil( sexr(rpoodalt mfcil()a2ra(mpoo0apx  feias s emump u4 rerxrcta1fmDr ivolt) rxoimpno4ameemnet ( srum(mp;u0oleomictydla ulnvp u0tlxoxf3tatfa  ln o t0srtrim iu1lpte feiatfsDrr( o;o1ale mf3tls s uauvont0altrif tydoat  nvs;t srtmim oo1am nlictas  2tauront1oee mfcilslmDrmnmo u0teerio oadomD  n s;s)t2xo(opno1altnlfvtlsfs2rruronu0tptn i3ils sDel(vs u4aeerircta1lm  anvs;t  rxrir3iu4lptnmfesat sruaum ;o1olen i3iydlaDulumont)altnxr oo1lm raieo;t0 etrxm3no1ll emnei (fsrrr(m ou0tpeoifeildfa rl(vsnu)artrxr oytfmtelneo;()srumim oodol emnctat arrmur oo0texnmfetyd s rmump;(0tetoif3oo1optelueil(0s2xmim oo4amt lfesasfa2rrurp;o0tle iieiadlmDeanvon()trtnxf3ta1op elueol() etrimpiy1ape lnetlt)sDtr(rono1tpenmieiyd a rluvs;(0 lxoir3iydfm rai i (  rtoxr io1lle  nctat) Dtm(  ;o1olxo ociyt a2uanvpn()tetnmo3iytlp  aivi s)teto(mpny4oltnliviltfa2raxmp;u0opxnmfctadls2el(mpnt4tlxoir3ta1opt lieil( setrim iu1ame  fvta()aDtrxr nt0tpxnifeiysfsDrauvs;() etrmo3oy1oa  lu o;( seumir3ou1opeelfcsltfa2rrurono0aexn o3ilt mDrlu snt4alxomfctatlmD li o s0 etoxo nodam   icilt  2urum nu4tlx miciadlm2emuvp t4aetrmfctodlp e nei s)trto(rpnu1lpe lnetls)srrm( pno4tltnmf3iltlm elu o;u) etoxr3iadfat luvo;t) ruo(m3ou4ole miet s)aDtaxmpnt4apxoioetlsls2eanmp (0artrir oytla ran o;() exrim iy4ope  ivta( srtrx  ;t1optomociys mDrlnmpn(0tleoir tytomt li s s) 2toxr oy4olenmietlsf rua( onu1alx iiciyslm2ul(vpnu0trxoio3oo1fmteaivs t) rurxmpiy4lp e fci ( sDtaxr ;o4ole mo3iatlmDrauvo t4tleoirciadlaDraivols) eumxr io4ameemivia(f Duaxmo;u1alx mfetasla2el(vs;t) rxnir tadomte nei t0t2toxm ou4alen nvsas) Duau  ;t4ape iociytla2rl( ont) lxnio oytfmD lu ol(0 rumxmpiy4lpe mfct tfsDuaxm ;t1texnifctytfa2em( ont0 ltnif3oo1fatelneo;() rxmim3oodape  fvil(fsDtax oot0tpt mocild m uan s u0tetrifcoydfa e ueols)s2ur(r3iydamenlncsa( srrau  ;t0teeniicilt s2ulums;u) ltomf iodlp e uvs;t)srum(r3oy1olenmnvsa(f 2tm(moot1tpe  o3ildlsDrm( o;t0trtrircoodlm rlies;t0teurxr3nu4om emfvs (  rrru p;o4tpx  oetyd m2uau p;(4 lenircootfpDr ueol(0t2tmir3iodapt  nviasfsDtru  no0opeomiciatfa umuvon()trtnir3iodoatrai i s0srxm(r no1lltemivil(fsDumu ono0olto o3ilsfsDuan o;(4arxomr ty1fmtran o;t s2trxm iu4ll  mfcs s)aDra(rp;o0olxoiieild s2ra(vo;t4trtnmr tytlm  aneilt0 2tmxrpiodomenlfvs (fs2tau pou4oex ioctyt aDrlnvp u)arermf3ootfm  aieo;s s2tr(o nudop  mfcsl(faruau onu0tltomiciat a2uluvonu)tlxomr to1lmD auvi t0t2umxopoy1omt mncs sfs2uau  ;u1tlt  fetadfm2uln pn(4tlerxfciytom r ivsl( trtoxo3oo1al nmivt (  rta(  ;t4aex  ictytls2elnvpnu4aeenxr ty1lm eaneslt) 2tr(mpnu1altnlfvil(faDum(mpnt1alxo ieildfmDea(vsn(4 etriocoytfa rauvs (0s2tmxr oy4opt mnvt ()sDuaur nu1olx ii3tldfa2ua( pnt0 rxniocia1omD lu o;t0 etmio3nu4llt mfei t s2rau pno4tlen o3iltla2uaumont)treoiociadoa eli s;t) etrxo3nu4ol e ies t  2taxrp;o1tpxnmfciasfaDra(mp;()trtnmr tydfatrlu o;(  2trxmpoo4oltnlfvt s s2urxroot1tlen octadfaDrl( on(4 leoir3oatlateaieolt)t2urxo3iu4omenlfvi (  Drau o;t1texoioeiydfa2ra(mo (4alenif3oadoaDrlnei ()tetoxo3ou1olt lnci (f Drmxront4apeoii3tadfa2umnvp u0 etnmo3iodlaD  n o;( t2xmimpny4om  livs t)aDua(rooo0alx ii3tytfa rlnmonu4aleoio3tydopDelu s;t0setoxr oy1al emivsl()s2rrxm nu4oeeomiciadlm um( ont)tltomfcoatomte ieolt  eurxo iodlpt mfctas srrr( poo4altn ociatls uln p;(4areoifcoatlateaiesls)s2tm(r3oo4omtn fet tfs2tm(  no1oetnmoctat a elnmo;t0trxomr3todopDr iesl(0 2umimpnu4openmiei tf Draxmo;o0oetn i3tlt s2ranmpnt4altoxo iatfpD au o;s)sexrio3iodal  mfvi tf rrr( ooo4tlt if3tytfm2ulnmp u4teerio3iytopDr u s ()trxoio iudaltnmfesa()aDuaum nu0aetnifctlt sDean o t) ltoxfcto1fa rauvilt0sexmimpio1opee neslt  2ta(rp;o1apt  ictlt s uau on()trxoif oo1lateaueo;s  2xr(o oo4optnlfci (  2tax  ;t0alt iociysfm rmu p (0alxrxo3oatom e ivs ()s2tr(r3ou1ol  mncs sfa2rmxmp;o4tpxo octatls2eanmont0tltnif tatoptrln o t  euo(mpnu4lpen nvta( sruaur ;o1alt ifeild s2elnmo;t4alenmrcto1faDr ieslt) rxm(o nudopt  fvta( a2tmuroou4ale  feiysfa eaump u0 rtomf iadlp rau ils  2tr(mpiodam nlnvi ()arrrur no0tetnmicildfs2umn p u) reoxrciadfa   ies;s) 2xrim3iydap elnciat  Dtr(ronu0alxnmieiydfmDea(mo t)aetrxrciytfaDr ieo t) rur(rpiy1aleemnct ()a2urx  ot4ape  o3taslm2emu p;() rxrmfctytla eaivils) rumirpoudol emfvtas)artrxr nu4teeo oeiydfs eaump t4aetrmrcta1fatrlnvsl(0s2xmxmpoodom nlivtlt) Dtmx  ot4ope ifctasfmDra(mo;() ltoxrciodomt liei s0 etrxm nu1al e ieta( sDum( ooo0opeo iciyd s2ul(von()aeerir io1faDrln o;(0 etr(r iy4omt  fet ()srur( pno4alx mf3tytfs ul( o;t4 exrmfcoadlp rlu olt0 ruoir ou1lp nmfvtas)sruax ono4alt mo3tydfsDel(mont4alxnxo iotlptr nvs;t) rumxopiy1ll nmfcs (f rum( ont0oetomfetys a2uluvsn()arenifcoytom   ueo s0s2umiopoydopeemfcs sfsrta( onu1optomi3iysfs emn o u) rtrmoctatlm   ieo;t0t2toio3oy1aptemivil() rumx  nu4tpt ifeiatfa2rln ont4tlxnmr3totlat  uvilt)t2trxr3nudlpte ict tf rtrum ot4tltoifetatla2rlnmsnu)tleoxo oatfa   ivs () rurxr3iu1al n fctlt) rtrx oou0tex moctad a umnvpn(4tlxnir3iy1lpD livils0 exrxopiy4olt  nviltf Dtmump;o1opxnmfciaslmDem( pnu0 exrmocoytlpDrlies;(0 2tmxo3nydapeemiesl(faDraumont1tleo oetas aDea(vp;u) exnxo iodfpte uvol(0tetrxr ou1lpe livil( a2ra(r nu0tetnmi3iyt a ulnmo;u)artnifcto1omte ivi;s) euo(mpiu1lpe lfeiat  2rmum ;t1tpenmi3ilsls eau snt)arxrxf3iodlpDrlnei ()t2to(r3iodapt mict s)arrr(rp;u1oexomociad mDrm(mp u0 ltomr oodoa elivi;s0 eumxr3oodom  lnci tfartruro;t1opxoifeiatlm2elu p ()alenio3tatlaDrlu o;t srxo(o3oy4lm emfvil()a2umurooo0apx  feiat s2ea(vs t)arxrif3iadop eaies t srxm(r oodaptn fctls) Dtr(m ou4aexn icilsfaDeanmpnu0trtnmo3oadomtraieil( setmxrpoo1ol   fesl( aDurx  nu4aleoifeiatlmDrm( s u0arenmf totopDe u olt0t2xmimpiu4amen nvtl( sDrr(root0aexnmfciydfm em( p u4trenmf todoptr ivo (0s2xoxopoodamee fvsltf 2um(m ot1optomocilsfa rmuvonu) etnmrciotlmDelu sls0seumimpoodole mnvsls arurxmpno0opto octlt m ulu snu0 eermo ootlpteluvi s) 2urxopiy4llee fciatf Dtmx pnu4tle iieiat a2rm(mp (4 etrir3iotfptrauei t  exrio oydapt mnciasfa2rr(mpnt0texn fcilt s ua(vp;t4alerxo todoateai o;s)s2um(m3ny1lmtemict t sDrmumoot4altoioeild s2umnmp;t) eeoxr3iytomt  ies;s0t2urxr3nudom nlfcsasf 2umu  ;o4optomiciatfa emnmpnt4aleoir io1oaD lnes t  2toxr3iu4apenlivsltf rurx p;t4aee  iciysfs elnvsnt0artomr iodom  li ols)srtrim3nu1lmtemictat)a2rr(moot4aet mi3tyd aDelu ont4 lenxo3iy1lpD  iei;( srto(mpoo1ol  livtls a2rm( poo0teeomieiysfm ea(mp;u4 rxoxrcta1lm eliei;s0setmxr no4omtelfvsas  2taxmonu1apxnio3ilt m2elnvs;u4texoifciytoaDrlueo;( s2xriopiu1oleemictl( a2taumonu4aeeniociydfa eanmsnu0alerif oo1laDr u s s) etmxopno1amte fviat srtmur nt4olxnifciydlm rmuvs t) exrxo3tadfmDrlneo;t srurirpoydameemiesatf Duru ont0tlt ifcils sDuluvs;u)artnmr3tadfa eauvo;s) 2toxo3iodal nmieils)sruaur ot4tee  icilsfa2emu s;u)alerifcio1fptrauvi;( teumxmpiu4ol  lnvi ( sDua(mp;u0oex micildfm rmnmo t4 ltoio ty1lpDrluvo;t0s2xrimpny4lp nmnet tfaDtaum no1oleomf3tatls2el(mp;(4texoif3iydoaDe uvslt0sexo(m3oo4lmtemnvslt a2umu oou0tle  feiat a2ea(vs;(4texomr3ia1fptrauvs;()srumxr3iu1optnlncta() rrrur ;t1oee ifeiydla ranmon(0 rxrio ty1lpDe uvils  2xoxopoydap  lietlsf Dua(mo;u0opt  o3iys sDeau s t4 leomf oatop rlneo t truoxo iydamenmnvs ()a2trxm ot1opxn fcild m rm(monu0aleoir3oatlpte u s;s0 etrimpiy4amtemivtl(fa2uaxr oo0tpt ifcild a eanvsnt4trtoioctodoa  anvsls0 2toiopoydlpeeliei sfsDtrxmo;o4optnmi3iydls umums ()tlenir3oadoatrluvo s0srxmxr ou4lp nmfcs () 2rax ooo4oet mo3tatfmDulnmonu0tlenmocto1om r ueo (  exrir no4omee fviatfartrxrp;u0tle  o3iytlm2ea( pn(4aetnxfcootlptr n s t0setr(r nu4llee ici ( srumx  nu0ope  f3iytls2rlump u0 lermr ta1faDe n sl() etmimpnydlle  nvs sfa2rr( p;o0tpe mf3ilsfs rmums;(0 etoir ta1lptraneil(0t2xo(o3nodlmtelnctatfarumur ot0apxnmietyslsDeauvpnt0aetrmf3oytlmDeli o s0seurxo nodam n nvi (f 2rr(mpoo1olenio3iyt m2ea(vpn(0tlxnmr todomDr nvi s)seuoxr3nodopte ies t)s2ua(mooo0apenmi3iadlmDrmn s;(0aeermfcoa1oateli ils texrir nu1lmeelfvi sfa2rmx p;o4texomiciadlm rln o u)tltnmf3iatfmD  iei;()trur(r iu4lptnlnctl(farua(mpou4ale mfcils mDumn o;u4tlermo todfp   ueo t)tetoim nu1llenlfctat)aDum( pno4alxnmfetysfmDrln o (4trenxfcoatfmDrli ol(0seuoxo3iu1optn iet (fs2um( oou4altoifciasfs2eauvonu0 eenxo3oytlptrln o t setoiopnudomtelnetl( arrmxm ;u4opeomociytfsDrlnmo u)texoxf to1faDrluvslt  euoim3oydome  nvilsfaDraurpnu0tpt  oeiaslm2rlnvp u4 etoxf3tatlp rlu sls  eur(mpoudope  ivtl()a2ua(rp;o0olenmoeiysfmDrmnmo (4texoif3tatfpDrlieo;t) etoxo3no4lmtn nesl( sDumxmpno4altoiieiysfm ean o u0arxrxf iotopDrln olt0 rxmxr3ou1lpe lfct t)sDra(  ot0olt ioeilt m2eluvpnu0 exoxf3ty1om eanvolt0 eum(o3nu4llee ivtl()artmx o;o4oexnmo3iadfa2rln s () ltnxf3iatom rlnvol()trumir3ny4aptnmies s arrm(r nt0oeen o3ilslsDua(vs u4trxrmf3iodfmDraivols trtr(m3oudll e nvta(fs2tmu oot0oexn i3iydfs ulu s t0trxnxo3oodfaDean s;t0 2toiopnudamtnlfvtat)arraxmono0tlenio3tld mDuauvp (4texrxf oy1op e ieo () 2xr(m3iodol   fviatfa2tax ont0aeeniieiatlsDea(vo;t) lxrmr to1oa elivo;s  rtoimpno4ap e ncsas srumx  ;u4opxomfciys mDemumonu4teeomo oo1omD lu s;t t2xrxo iy1ame  ies tfaDra(rpoo0tet iictatla2ua(vs (4 eenxrcoy1lmtr uei s)teum(r ny4apenlncsa(fsDumurpoo1tpeomfeiyt m ranmp;t0trtnio3oo1lmD  i il(0sexrxr iodape  fvs ( sDrr( ooo0opxniieiydla2emn onu)tetniocoytomDelnvo (0s2xoir no1ll eliet s  2rr(  oo4aexomi3tltfa uan o (0trxomf io1op e ies s t2xmir3oodllte fei ( srtrum no0tltnmo3iatla emnms ()trxrmr todlmDrli i t0seumio oo1olee nvil(  2rax pnt0oex  oeiytfa2el( o;()aeermf3ootomDeauvils0t2xmir nudol  mneiltfaDur(mpou0opx ifciatfmDrlnmp (0 rtoif ootomt  i sls tetm(mpno1lpt lneilt)s2ur(rono0tlt  ocildlmDeanmsnu0artoif oa1laDeanvi;(0 2toxr iydomtn icsa() rrmx  oo1olt ifeils mDrmu o (0trxrifcoo1fm elu o s trxr(o ny4al e neilsfaDrrx  nu4oleomfciyt aDem(ms (0 eeomf3tatfaD anvs ()texo(m3io1lp n ivs t  rrrx pou1aeeoiicilsls ua(mp;t)trxomr iatfmD lneo t0s2urxo nudlm  lfct sfa2urxroot1apeoioctyd m2rlnmpn(0artomf ty1fp eau il(0 rxmimpoudlm emnesasfs2ur( pnt1tetoifctadfs rau o u0 rtoxf3oy1opD  i s;s  rxrxopoy1lm nlfvi (  Drauro;o0aeen ieias m ulnmo ()alxnxf3todfmt  ivi t0 rurimpio4lptn ncil(farra( pnu0oet moeiydfm ul(vo (4tlenmr oadlatraieil()trxoxr oydomee ictl( aDta(  ;o4tetn oeias a2rm(mo t0texoxo3tydla  aneils trtm(m3iu4lleelfctls a2rrxm no0tltnmi3iadlm2eaumsn(0alenmrcia1latrluei ( teurxopnudaleelivsas  rtru  ou0apxomieiasfmDemuvs;(4aeermf oytoa eai s () 2xrio ny1opee fcs tfsDrm(mpoo1alt mfetasfa rl(vsn(4 reoxr3tydoaDr i slt sexmxmpou4lm   ietasfa2rru oou4opxnioeiadlaDra(vo;t4 rxrxr oo1om  livs;s0srxoim3iu1ome  fes sfsDumxm oo0opto oetatlmDrm(vsnt0 eerxrcoodoaD anei;t  euo(r3oydlpe  icsa(f Drm(ro;u0tpxnifciyd s elu onu0 etrxr3oo1lmDr i o;t)tetrxo3oudlle livs s s2umxro;u4optnio3tltfm2el( o;()texnmo3oy1oat lu o;()t2xrxr3nu1omt  nciat sDrm(r ot0tetnif3iydls2ulnms u0 ltrmo3iy1latrau ils0sexoirpno1apen neiatfsDrmxmpno0oeenmi3iysfm rl( o ()teenxf3tatfmteaivs;(  etrxr3iy4oltn nctat)srur(mo;o1oexo ociydls2ea( p (0tlermr iytfmD aneolt) etr(opnodlpe lictl()srtrxm ;u1aee mi3iadlmDua(monu4tltnxo tadla eaneils)trtrio3oo1lle mncs (fsrrau o;t1ale iictas a emnvp;(0tltrirciatoatr nvo;t0trxmim3oy1ome mfctls  Dum(m ot1oleomo3iysla emnms;u4treoio3iadlatranes;t0truoxo nudop e nvslsfarrrxrp;u1aexomf3ils sDra( pnt) renifciytfm elivi t)setmio oydapenmfes sfs2tmu pno1oleoiiciysfaDrmnmon(4trtrxr3totopD  i s t0 2urir ny4ll n ncilsfarumurooo0tpen feiyslmDeanvp ()alenmrcoydlmtelnvi () rto(m3oodlle mivs ()aDumumpoo4olxo iciyd m rm(mont4 exnxoctadopD  i olt)s2tmxr3io4lltn fct s a2rr(mp;o0tlxnmi3iltfsDemn p;() eerxr3ta1fp  liei;t  eum(o oydlmeemfvi sf 2trxm nu4optn f3iytfaDrlu s ()alerxr tatopD  n o t) rur(rpoo4am   fes s)a2umumont4apx ii3iad sDemu o ()tltnxf tatoa eaivslt0 rumxopnydop nlfci ( aDumxm nu0apxniociysfs emuvo;t0arxnxf3oytlatr nei (0srxrim3iy4ole lictltf 2ta( o;o4alenmi3iyt sDemump;u4alenmf3ia1lmD  uvs t0srtr(m3no4llt lnvsatf 2ta( pou0tee ifeild aDelums () lermo3iadfa  aiei ()t2um(mpio4lleelieiltfsrra(rpou4teto f3iyd a rmnmp;(0 lermr3iatlat au i;s0s2urim3iydam elfvtl( srrrumpoo0tpxn oetyd aDrmump t0alermr ia1lpDran s (0s2xrio io4aptelncsa(farrmumpou4tpe  oetltlmDrmnvp;t0 leomf3iadlm  lu s s s2xoim3nu4amtelnvs t  rra(ro;u1oexnmfeiasfa2rlnmpnu)arenmf ia1op r u olt) 2xrim3iy4alte ici ( arra( poo4tle mieiytla2umn o;u4aexnmfciydop   u i t  2uo(rpiodll e ici s aDra(mooo1teeoioeiltlm2uluvo u4aetnmf3iydlpD  nes;s0trumirpoudal  lictlt)srta(rpnt0aetoiocilslmDel(vpnu0 lxnmr tadom eauvs s sexoxopnudll emnei tfaruau p;t1tlxn fciydfm umnvo;u0tleoifcto1omt auvsls0 rtrir3nu4ale  ivsa()a2rmuroou1oee mf3iytfs2ulums t) lxoxo3iy1laDeai s;t srur(r ny4lltn fesasfaDumur ot4altnio3iyd a2elu p;u0aetoxo iodfmD  uei;t sexoxr nu4olt livt s aDrm(rp;u1tpeo o3tas s rlnmp u0 rxnmo3iodomtelu i;(0 exrxmpoudope mfcs ( s2tmxm ou1oleoii3tas m el(vsnu) leomr3iatfateluvs;s)s2tmiopiu1lm elivilsfsDtax ooo0apx iictydla2ranmsnu)texrxoctytfatr u olt0srtoirpiudol   ietltfsrtmu p;o4tlxoiiciadfm em( s t0arerio3iotfa  lu o;(0srtmiopou1omt lnet s srrau  nt0oee iociytfm el(mpnt0aetrxrcoadfptelueolt0t2uoxopno4ol nmfct (fsDuau ono0apx  oeiadfa2ua( p;t4 exrmf tydopDe n o;t0srurim iydlpenlies t  rrau  oo1tetoifetas mDran on() eeomf oa1opteln sl(0setm(opiu4lmtelnvsl(f Drmx pnt4tex  i3iat m2rm(monu4alxrif3iadlp e iesl(0 2xmimpiu1aleelfvs ()a2uaxr ot4tlxnmo3ildfm rmu p;u4texrif3ta1om  lnvols s2ur(m3ny1lm elnvtat)srtmumpno0tptnmf3tld sDel(mo;t0 rerif iydfa rau s;( t2uoxm3oo4amtemnes tf rtm(m ou4tpx mo3iatlsDemumont)arenmf3iadom rlu s;t t2uoimpiy4lm  mfvslt)aDrru  nu1opxomi3iysla2emuvont0arxoio to1optr ivs t)s2um(m3iu4llen iet s) rumumoot4optomictys mDrlnvp;t4altoiocoadlpt  u ils)t2to(m io4amtelivtas)a2urxrp;o4tle micildfsDua(vp t4trenmoctadom eauei;t  rxoxr3iodomt lici t srur(mo;o1ale moctydlm rlnvpnu4aetoxr3totlm eau i;s0 exmim nu4lle lfetl()arur( pnt4oleoiociat a umu p;t)altrxf to1lp eauvo s t2trxr3nodom elfesls aDrau onu0alxomoeiyd s2uauvs u4texrxf ootomDrauvs s t2tm(o oudlmtnlict (faDtrum ;t0ole  feiytfm2eln s t0arxrmfctodfa ean sl( sexrir3oudalen neslt a2ua(monu4tex ifeiat m2eluvs (0 exrif3to1faDeaivs t)teurim3oudopenlncias sDrrumooo4oetomieiyd mDulnvo (0trxrxfciodop raueslt0 eumxm no4om emfeiatfs2tr(mp;u1ole  fcias sDraums u0alxrio3tydlp  lu i s0 rtmxo no4amtelfetl(farua(roou4aleomi3tyslm rlumpnu4arenxo oytopD liesls  exmxo ou1llte fvils  Drm(mp;t0opeo ieiydlaDuln s t)trxnxr3oo1lmtr u olt)texriopnodole mfet s artaxr ;t0tetniietydfm eluvp;u0aexnif3ia1fmD  uvolt)trxoim iu4al nmnei sfaDumu  nu4apto fcildls2uan o;u) etnmo oadfm r ivo s0 eto(mpnu1am n nesat)a2rmu pno4tpen i3ils mDum(mon(4texrmr3ootlmtelnvilt0srxr(m iu4apee icia( aDtru p;t0alt io3ilt mDemnmon() reoif3iotfa   i ils t2xmim3nu1olenmfcsas) 2tr(mo;o1alx  ietas mDrm(ms u)aexoxr tatoa  an i t0teumxrpiu1amte fvsltfarrm(moou0aexn ociad m2emums ()trtnmf3iy1op elueo;t texo(r iy4aptelivtas) rraumoou0texnmfeiasfm um(vs u4tetnio oa1lm r uei;s0t2tmxopoy1ol  mnet (  2rr(r nu1teeomfeiytfmDrlnmp t4aleomo iotfm eaueo (  2uo(o ny4op nmivsa(f Dtmx  oo4olx mieilt aDem(vs t)treoxf oatfaDe ivo;t tetmxo iy1optelnciat)s2um(mp;u4optoioeiydlm ulumo;u4 lxoir3oo1lp elneo;t)t2xoxo no1om e iet t)s2ur( poo1oleo octadlm em(monu)arenmf ia1fmtraieol(  eurirpny4ome  nvsa()s2rmx  oo1alt iieilsfm ra( o (4 eermfcty1oaD lnes;(0 2xrimpiudom nmics s sDur(mpou1tee ifeiyslm2ul(vpnu0tetrxfctotfpDrau olt) 2toim oy1ll e nci s) 2umuront0olt if3tyd m2rl(vsn(4 renmf ta1opD lneo t srtrxo3ou1ole mietl( aDuaxronu1alt  feiysfs ul( pnu4aetomoctotfmDr uvil(  2xrim3iu4op e fei (  Duaxmo;t1aet ifetydlaDulumonu0arenif3oa1om r nes ( trtmxo iudope mncs () 2rrxr nt0aetnmi3iytfa emuvsn(0 lenir ia1lpDeaivi t)sruo(o ou4altn netasf rtrx  nu4texo ieiysls2elnvonu4 rtrxo3iy1lmtrlu sls0 2tr(rpiy4ll n fctl( srurum no4opxoio3iltfs uau s;(0 lxrif3iodlpDeaues;s s2uriopiodal e iciatf Dta(r no0aptoifciysfa2rln p u)tltrxo oa1fate n slt)s2um(opny1lmtnliesas) 2ua( pot4alen ictytfs rmn s u0areriocto1om  anvo t) eumim oodoptnlnciltf rrau pno1alto oetys a2ua(monu4trtrmf oadlp elivo;t0trtrirpno4aptelfvs t sDtr(mono4tptoifeilslaDrmump (0altoif iotlm ean i;t seumir iydape lnci (  rtaxm ;u4ole  i3iadfm2em(von()aetnxo oo1om eaivo;t) rxrim3oo4olenmncs (f rtmumoot0apxnif3iyt a2el(vo;u)texomo to1opDrluvil(0srxoxm io1amtemics s srtmu  nu0aee iociadfa2ra( onu4treoircia1faDelu olt0s2xoir io1opeelnesls)artmuro;u1opt  ietls s ran p u0aexoif totla  au i s)seto(rpnu1aleemfesat)artmurpnt0openmfcilt m ea(vonu)artnxo oo1faDelueo s)s2ur(o iu4lpt mivi sfsDtm(moot0alxnio3iytfa umn o (4 reoxf3totom r ueo ( t2uoxr3ny1ole mfcs sfarum(r ou1tlenmf3tys a em(vo;t)aetoxr ootlpDe n i;t) exoxopnu4am  mfvta(  Dtrx ooo1oleo oeilt sDemnvo ()texnxr ootomDran slt0 etmir io4opeemivsas sDumurp;t0tltoioctls s eau onu4 eeriociotfpteaies;s) rxrio3nu1omenmfct (f Dum(r nu4ole mieiltfaDrm(mo;()trtrxrciytfat aneo;t0teuoirpno1lptnmnctlsfs2tau  ot1tptomoctadfm emnvs u)artrxf oatoa eauei;(0 rtm(o iydlm nlfesl( sDua( poo0teen f3ild s ul(vp t) lxoxo3oa1fate n o ( setoxopiu1apt lfei s) rrrxmpou0teeoif3ias a rl(vpn(0alerir3tydlmD ln s ()sruo(rpiy1optelnctl()arumxr ot0texn i3iadlm emuvo;u) renxo3iodlptelnesl( seumxmpiy4optemfei t)aDtrx ono4tltoio3tyt m um( s;u) rxoxf3ia1fmt lnesls)s2urxrpoy1amenlnvt ()sDtaump;t4tleomoctas a emumpnu0 etomo tatlpDelueo;( sruoxopiy4lltnlnetlsfaDur( p;u1texn feiadlsDranvs t) lxnircoydfm elu i;t teuo(m ou1omt lics t  2tmumoot4tlxomieiydlaDea( o;u4 ltoiociy1fpt lnes;s)tetm(m nudam e fvtat  rraxr no4aexnifeiyt s2rauvo u4 rtnifcoa1fa ranvi t0teuo(rpnydlpenmnct ()arrrum nu4tle mo3iatfm rlums;t0alenmf ootfpDrai ol()s2umxrpiy4lp emnet (fsrurump;t1olxomi3iadla2rau onu0aexrio ta1fpDe neo;()srtr(rpny1ol n ncs s srrmuro;o0tet  fciadla2umnvp;t)alxrir3to1lpDr uvs t trur(r io1amtn ics t srrr(m nt1aptomi3iasfs rau ont4tltnxo ty1fa e neo;t teumxrpou1al elnci t)sDtaxm ;t1olt iieiyslaDrmnmo;t)alerir3iotoaD au s (0t2xm(m3nudal elncsas)arua( pno0oeto oetat s uaums;t4arxriociadfp ean i s sexrxr nu1omtn ncils  2rax p;t1teenmi3ils m uluvsn(4aeermf3iotlaD  uvils sexmim3nudop emivs (f Dtau o;o1texoif3iydlaDum(vp t) lxrif3oa1op e n s s s2xrxm oudll elfvilt aDrrx pou1oexnioctasfaDel(vs;(4altnxocoy1laD  nvilt teurxm3no4alenlnct s)a2umxmp;u4oleomociys s eaump (0artrir todomt auei;s0 2toirpny1al   ies s)a2um(r oo0tle mf3ilsls2ulnvon(0teeoxr iytomte nvi;( t2urir oy1altn ncia(fs2uaxm ou1oeeniociysls2ra( ont)alxrmr ootoptrai i;t  exmir nudam   ietatfartru poo1tleoiictyd aDumuvp;() ltomo3totoaDr neil( s2xo(r3oo4ll   icsl() 2rr(m ou4ole io3iytfs rmumpnu)tetrif oy1fmtrln ol(0setoxm3iy1lpeemnci t sDtax oou1ope ifeiys m2uln pnt4 exoxrciy1om e n o t0s2xr(rpiudamt  fvt t)srtru  oo4aetoifeiad mDumn o;t) eenircoo1lmt  uvsls0teum(r ny1omen ies s srrr(root1tptoifetlsfmDuaumpn(4trermrctadlmDe uvi s trtoxr nydopt mietls)artaxrpoo4altomi3iadfm2rmu o;u0texrmrcoa1fp e uvo t0s2trxopiy1openlneiasfsrrr(m nu0apxnmieilt s rluvsnt4aeenmo todfptrln olt) eto(mpou1op n iet tfsrrmu  ;t1oet mf3ildfm el(mo (0tltrif3ia1oa rai o () rtrio oydop nmfvslt)srur(rooo0tpe iictyd sDrmnvo (4trerxr oytomDe u ols  2tr(rpiydom elieil()a2umu p;o0ole  ictytlm2eanvs;(4areoifciydomD  n ols0sexo(m3no4optelnet s)s2ta(rpou0aee mieiad s ul(vsnt0aeermr3ty1lpt lu sl(0 ruo(m nudlmee ictl( s2umur no4tlt  oeilslaDelums;u) lxnio ty1fmDeaies;t)s2trxm3iudlmt lnct ( aDtm(moou4tpx iiciyd a eln p;(0teerxo3ty1lp  lnvs;( texm(m3iy4lme lncsl()arrrurpnu0apx iociydls2umuvs t4 exrif3iodfpDe ieo;t t2tm(o no4openmici () rur(mp;o4tpenifeiat s rl( on(4 lxoir3oy1fpDe u o;t0 rumxopny4om n nctat  2rmumono4olenmo3iadls umn p u0 lxomoctytlate nvi t  etrimpoudomenmicsl(fsDrau  nt4olxnmi3tas a rmu o;t)arxnir3to1laDelnvs;( srtr(m io4ll emfetl(faDraxmo;o0apto oetld m2ran s t0trtrmo iotop rliei s srtoxr nu1lpe lfet ( aDumxr oo1opto ociytfs ra( o u)aetrifctytlmt aneo s0trxrxo io1apenmnetas  2raxr ;t0opeo ieiasls eln o ()tlxoxrctodop ean slt  eur(m ou4lmeelnct (  rrr(m nt4tptnioeildfmDul( ont4alerxr iodoatelivolt)seumxopiy4lmeelnvt s) Durumpnt4aptnmoctlsla2eauvs u4 renif3iotlm r n il( texmirpio4oleelfvt tf rrrxr ot0olxoiicils a el( o;u4aleoxf3iatopD  u ols s2umxopou4open ivi tf 2tmu  nt0tpe moetasfa2ul(msnu0arenio3tydfpteliei;(0 rurxm iudll emfvt ()s2tmur ot1oetnmf3tlsls2rm( p;u)teermf tytfatr ivo t0seuriopiu1omt lfciltfsDum( ooo1alxnmoeiasla2ulump (4arxnir3tytlpDran o t)s2tr(o3iu1ll nmnvtas)a2rrxmpnu1olt if3iat s el(ms;(4arxrxr3to1lm r i ols srtrxr3iy1al e neta()a2tr(mpnu4tle mieiadlsDelu p u4arerio oa1fpteli s ()s2uoio3ny4opt micsatfa2uaumo;o4texnmoeiltfm2rl(mo;(0teenmfciodfmt lnvi s  2toxo3nudomenmicsl()artaxrp;o1tee  fciadfm2rl(mp u4tetrxrciodoaDean i;(0 rxmir3ny4amee ivt (fs2rrump;o1opxnmfcilsfs elnvs (4tlermo3to1opDeauesls0srxm(opnu4llenmfvt tf 2urumoot4aexo o3ias mDra(vo t0altoxoctatoat luvils srtmirpio4amtelnvs s s2um( pou1tltomi3iydla2ul(mo (4 eenirciytoat  n o t0 rtrxm3nu4omtn ivs (  rtrxmpou0aexn i3iyd aDelnvo;t0 etnxr oodfa e nei t)s2urio iy4al   fcs t sDua( ont1tpeomieildfa2ea(vp;u)trtoioctatoaDraies;s0 rtm(o ny1ame lnes tfs2rm( pou1tex ifetytfaDel( o;u0tleoio oatlptraneo s)setoxm iu1ameemieslsfs2rr( poo1olxoii3iatfs2rmu snu0 etomf3tadfpDrauei t) rumxopou1amee fetas)artm(mp;t0oltnmf3ils m2ranvont0areoirctodla   i sl() 2uo(r3oy1llee iei sf 2ur(m ;u0aetomfeiytlm rl( pn(4tlxomo iotfpDeaueils  exr(opnu1am e fvs t aDum(rpoo1tpenmictyd m uaumo u)teerxfciy1fmDe uvs;t0tetrxr iu1om elnvsls  rtauro;o4apt mfeilslmDem(vo;t0 lermf oadfp ean i (0t2ur(opno1lm   nvsltfsDrrxmo;u4tex  oeiasls emums (0 lxnxo oa1oaDeanvi;(0 rtoxmpiy4ll elfvilsf rrmxm nt4alenmo3ilsfs2ea(mo (4 rtomr tytomtrlivi;s  eum(r3oo1lmtelfetasfsrumump;u0aee mi3ilt s ean on(0tlenmo3iotfpD an i;(0 etmio nydlp n nvs s srrmxmo;t4oeen o3ildlaDelnms t4arxrio3ty1laDe uvi;t  exo(opiudllte ivtas)s2urxmpnu1tleo ieilt a2em(vsnt0tetrif3iydoaDrlnvs;t0t2xoim3iodam e ivtat  2rmuroot0apeoii3iys a2uanvp;()aexnmf oa1opt lueil()texoxrpiu1lp e nvs s srrru pno4opeo icildls2ean o;u0aeeoio ty1lm   n s t s2urxmpiudamenmics ()srrmxmpnt4oeeoii3tad s eaumo;t0aeeoxr to1oa e nvslt)truo(mpoo1lp e fetlt  Duaxrooo1tpenmf3iydls ranmo;u0 reoxf iatlpte n s s0 2uoxopio4om n feilsfarumuroou1altnmfciytla2eln p (4 exnxr3tatoatr ueol(0tetm(r io1am elfvias)s2tm(rp;t0aet  f3tytls eanmsn(0tltnxo ootfmtelu s;()sexoxr iy4amt mfci s s2urumpoo4aetn feilt a2rmnvsnt4 ltrmrctatoaD livsls sexrxm3nodoptelfvt s  rrmxr ou0ape  ieiatls ean o (0 leomf3oo1op r neo;s sruo(m ny4ap nlics s)artmxr ou0tleoiieiad m2uluvs;u4teenmf3to1oaD lu ol( sexo(r3nu4op  lncia()arrm(ront0aetnmiciltfm eanvp;()aexomf iy1fmt lnvi;()srtrxo3iudamen ncs t) Duaum ;t4texomfctldlm2ulu p ()aeermrciytfm  li s;( t2xo(mpny4ap  lnvsas) rraxrp;o1optomf3tld s2ranvs;(4 lxnmfciotfpD li o;s0setr(r3oudop  miet s)srrmxmpot1tlx  i3ilt mDua( o t4tetoxo oy1lpDr nvi s trtm(opny1lmtnmnctls)arrax pot4teenio3tlt a2ean s;(0 rxrxrcta1oa   neo;()s2xm(m3nudlp e ivil(farumx p;o4aexoifeiydfm uaump;()trtrif3tytoatr ieilt) exrxm3iydaltemict tf rrm(m ;o0oetnioetat a eaumo u0tetrif3oa1fmD  n s s)s2urxopnu1ap emict t)aruaxmpno0oeto feiydlaDemnvo t0trtoxfcia1lmD anvi ()s2toio3oudlmteliesat)s2ta(mp;u4apx ifctydls um(msnu4aetomfciy1fmDr iei;t0t2xrim oy4lme mnct s)aDtr( pou1oex if3ilsfm umums t0 etomrciytfptrai i t srtoir oy1lptelfvia(farumum ;t4oleniocilslm ulnms (4alxrxr3oytom raivo (0tetmirpoy4opt  fei (faDra(  oo1tltoioeiasls el( o t4trxomo3todoa rau sls) 2to(o3iodapt miesls) rraumo;u4opx ioeiys a ul(vpn(0teenmociytlat auvs t0 2xr(rpiudlme  nvils)a2umx ooo0aptomi3tlsla rl( o;() leriocty1fmDe iei;s trtm(m oy1ape mnvsl(faDrrxmono4aleoiietaslsDrauvo;t0altnio ta1fatr iesls)srtrxr3ny1al  mivsls aDtm(mp;u1tltn ociytlm2uaumo;(4 reoxf iytfpt anvi;( t2tmio oy1apee nes s)a2ra(mono4olenifcilslm em( s;() lermoctytla elies (  exoxm3oo4ll emiciatf Drax onu4aptn feiltfsDumums u0arerio iadop e nvs;s s2ur(m nodlpt  nctas  2rm(mont0aet  o3ildls rl(vs;u0alxomf3tadfat luei;s  rtmio iydlme mfcta(f 2tm(mpnt1aleo o3tatfa2rlnvo;u4texnmr3oytfaDe uvi t)teumirpno1om nliet ()srrmx ont1aexomieias sDrlnvs u0aexoir3ia1oaDean i (  2umir3nu4omeelfvsas) rta(moou4ope ii3iytlsDumn s u4aexnmr iydlpt ai sl(  2xoim3oo1am nlfvi ( a2rau onu0aet iictydlmDumuvp;u4arxnifcia1fp   n i s)texmim3oo1llenlfvia(f 2umur ;o4olx ifctydlmDeauvo (4aeeoxo3oodfpD  iesls)trtoio3nu1omt  fciasf Drrump;t1tex io3tasfm2eln p;t0 lxomrctotla e ieo (0 rtoio io1alt mietlsfsDraumoot0openmo3ilsfs ra(mpnu) lenir iatlpt  n ils) rxrir nudape lfcsl()srua(ronu0aex ioetltfsDean s;u4 exomr3tadlpD anvols)trumir oodlleemfvilt a2uax pou4aex moeilslmDemnms t0teerir3oydoat aivs s)srumxmpou1lmtnlfet s aDrruronu1apx mociadfs2el(mp;u4 lxnmo3oa1oaDrlies;s0seur(r3oo4lm nlfcsas s2taxroou0apxo i3iasfs2elnmont0alermocto1opt  n i;t)t2trxo iodlltemfes (f Dtr(ronu0tle  i3tlt m ranmpnu0aleriociotfp  aneo s0seum(rpoo1lpeelfesat)s2rr(ront1aetoif3tytfaDrln s (4 rtrmrciotlm rlues t tetoirpnodopeemnvs ( srua( poo1oet mf3iysla rmn s;u0tlenxrcoo1lmte uvi (0trxoir iodlp  mneia()aDurxmpoo4altnifctas aDul( p;(0 reomr3ty1oat  ivi;s)t2tmirpiy4al e fvslt)sruru p;o4ope  fctlsls2elums t)trxnmoctodlptraivi;( tetmxm3ny4llenlnctltfa2ta(r ;o4olxnmieiytfaDumums;(0trtomo3totfmD anvilt0texo(opnu4oltnlfesat aDurum ;o4opeo fciltfmDuluvo t0alxnxo3iadom eau s;s0seuo(m3ny1amt liviltfaDta(root4opeo ieiyslsDrlnmsnu)texnmfciotfpD  ivs;s setoim3io4lmt mnvtlt  Dtmxr ou0alxniieiltlaDrmu pn(4 etrirctadlp   neo;(0 euoio3ny1am nmfetat  2urum ;t0tee ioetadlmDrluvsn(0trtnxo3tatopD livs s0trxrxm io4omtnmnet t)srua(r ;t1alto octat m eluvp;(0 renmoctytfmtrau sl(  rtoxmpiudamtelfeta()sDtrxmo;u0tee  ietysfmDelnmsnu0 eerxo3oadomte nvils srxm(opoo1ome  ieiasfaDtm(  ;u4oee miciasfm2emuvsn(4altrifctotla rlnvslt0texoxmpoo4ol   neilsfsDtmur nt4apeniociadfsDran pnt0aeenio3iytfmDr u slt0seur(r3iy1omtelfet sfsDtau ont1tpe  o3tlt m2eaumo;t0 eenmr3oodla ran o t texmiopou4ap n nvi (fsDrmxmonu1olen ietysfmDel( p u) lenxr ootfptrln o;s)s2uoir3ny4lmtnlfet t  rtmxr ;u1aetnioeiaslm2rmu p u0trermf3ta1fa   uvslt0 exoxo3iudal   feil( arrm(mpnt1aet io3tyd m2ea(vpn()aeeoxf oodomtr ieo (  exr(r3nodape  iet ()a2tm( p;t0aex  fctyt s rm( s ()alxrmf3ootom  ai o;t teum(o3ny1lm n nct ()srtr(r ;o1opeomieiys s2ulnmp;(4tlxnirciydfmt lu sls)s2uoio3nu1lleemfcsat  Dum(rpnt1altnii3iat m el( p t)trtrmrcootlp  lnvs;t)trxrio iydape lfcsat srraurp;u0aptoiieiasfs em(msnu0alenmrcootfa rluvsls)trum(opoydlm  mneta() ruaumpou1aptoio3iasfmDemu s t4tlermo3tytfpt lueolt0 rtrxmpou4am   fvta(f rtaxm no4alxo f3iltlmDuaumonu)tlenir3tatfa   u sl(0trumir nodol e iesl(f rta(ro;o4tpenmociltls2raums;u4 rtnif3iotoa r ieo;t0sexr(rpoudop  mfei s)sDraxroot1oexn i3tytfa em(vpnu) lxoif iadoa eaues (0t2xm(o nu4amtnmnesa( aDumu pot0aetniieils m2rl( s u)arermr3totlm   iei;(0 rtoxm3oo1aptelfvi (f rtm(mpnu0tpeo ocilt a rln o;t4 renio3totlaDelieo;s  rum(r nu4aptn fciat  2umu  nu1tetnifciadla ranvo t) etnxrcoo1om r ivsl(0trtoir3oudlpt mnvt sfaDrrxr nt1texnmf3iydls2ulnvonu) eeomo oy1la e uei s  etoxopnodlmeelfes t)srtmxm nt1teeomicild s ra( p t4alerifctydlaDrauei s trurim iudlle lfviatf Dum(mp;u1opt ifeiytfm ulnvs;(4 lxrmrciadlm  anvil() 2urxm3oy1lpt mnvt () Dumu  ;u1optoif3tydfmDulu on()tlxnmf to1lpD lneo;( seum(m3oo4olte icsat sruauro;o1texn f3tysfa ua(mo u0teerio iatfpte nvil(0teur(opoodlpt mnvslt)srrr( poo1oetnifciatfm2ulump t0aexrmrcoy1fat  u o;() 2um(mpnu4oltnmncilt)arrmu pnt1opxn ictysfaDem(vp u4 exnxf3oydopt aivslt)srxo(r iydlp nlici t)srrm(m nt1oltnmociatlm uanmsn()alenmocoodfaD  u o;()t2tr(o3io4opt mnci ()sDuaxmonu0aexn fcild m2el(mpn(0trenxfciadlp   n i;(0 euo(opny4lp emfeia( aruaxmo;o4opeomf3tldfaDrm( p;(4aetrmocoatlpDr ueslt0srurir oudoltnlfcta(f 2ua(  oo1oltn ociad m rmnms;t)alxoxo oo1oa  lu o (0 rumim ny1apt  ivia(  rraumpoo1tleniieildfaDea(vo (0 rtomf3iotlpt  nvsl()srxoxr3oy4lmen nvtls)sDtr(rpno4oexomo3iyd m rm(ms t0 rtnmr ootfa  livi;(0seur(rpou1
\ No newline at end of file
@@ -0,0 +1 @@
+uvo;t trxrir3io1alenlnvsatf rrmumoot1oex if3ildfm ulnvs;(4artrxf oydoaDeaueo s s2xr(m oy4llenlics ( artau o;o0oltomfeilsfa ea(mon(4trxnio3tydopD aueo s  etmxo3ny4lpee nvt t aDtm( ono1aeen i3iytls elu s;(0 leoxo3tatomDr ivs t t2trir nudapt  nvil()artmu p;t1aeen ietld s2rauvpnt) lenmo tadoa  lieo t0 exo(r iu1amee nctatf rtmumo;t1alx moetydls umnvp u4tetriociy1oa rluvol() rxrim nu4lm nlfvi s sDurumpnt1oexn oetyd aDrl(mpnt0 rxomocia1fat  n i;s)trur(opoy4ol  lfctlsf rtaum ;t1tpen ociytfs uluvsn()trxrxo3iadfmDr i s t)seurxr3ny1aptnlnctl(f 2ra( p;t4aeen i3iltlsDuauvp;t0tltrmr3tytoa r nvi;t t2umxm oy4ap nmfci sfartmxm ;u1tetnmo3iyt s rlu s (4trxriocio1lmDranvo ( teumxr3iu4ape lnvs tfartaxront1alxn fciatlaDum(vp ()arxrmrcoy1oaD lieo;(0t2xoxm3no4apte nvsas)s2tmum ot1tle iieiydlsDulu s;(0treriocto1fat  nvs t) 2to(r iy1opt livs t aDumxroou4olxomo3iyt a2ra(mpnt)trenxr oy1fpD lnvi (  exrir3oydll elfcia(f 2tmx ono4oet ioctat a2eln pnt) rxnmf3ta1laDelneo t  ruoiopiydalte nvsat s2rax p;o1apt mociysfa2uanms (0 ltrir tydomDe uvil(0t2tm(m3iudapenlieia(fs2tr(  ;t0optomieiltlsDra(mpnt)teerir3to1fpDe nei;(  2um(o3nodome  netat) Dtmx poo4tlt  fcildlm rlnmsnt4aetrifcoy1lm ean s;s) 2tr(opiu1llen ietl() Duauront0alenioetysls uaump (0alxnxo oatfmD ln i;(0trtrirpou1am elnvsat arraxm ou1oleniieias s2ea( s (4 eenmr iytomtrlueo;(0s2uoio iydolt lnct (farrau ont4tptnioetydfsDemnvo (4arerifcoodoptrlnvs t  2urxo3iydlleemfesls)arrrumoot1olen o3tysfaDumu s t4trtrxf tytopDeai sl()texmim3iy4openmfct ( aDtmumo;o4apx ifeilsfaDrlnvo u4 lerio totlpteanvsls t2tr(o oydlpenmnct s srrruro;t4tpe  feiltls2elnvpnt0 etnmf oy1oa eln s;t0srtriopou1aptelfes ()srrr(mo;t0oexo o3ild s2eluvp;t) ltnxocio1fa eaneils)teuoirpiudlme mivt (f rrmx pou1aetnifcias m rm(msn(4trtoxrctatlm  auvi s) rtmxr iodlpte ivilsf 2um(  no1tltomfeiyt aDrln p;()trerxr3oy1op r i sls0texr(r no1openmieiat)s2rm(mo;o0tpeo f3iyd a ulu snt) exoxfciodomD lieo;t  rtrxo oudlmt mnviltfaDurxronu4tlxnmfctaslaDuaums u) eerxf ta1fa  lneslt)t2xoim3iudom  lfviat aDtaxmp;t0tpt mfciydfsDemnvo;u) etnxf3iotlateau i;s)trxm(o3iodol   nvslsfsrum(mpno1oeeomfcildfa2rlnvp;() lenmr iy1fpDeaies s  rtrxmpiydom n nvs t sDtaum nt1optnmi3iad mDrl( p ()tlxnif oadla  livo s0 2xrim oydom e neilsfs2rr(rpoo4tpxnif3iat aDrlu on()tlxrxr iodfp eai o ( texm(o no4al elfctat)srtr(  oo1oet  o3ild sDea( p (4treoif3oa1fa eluvo s0setmio oy4ale miviasfa2uax  ;t4altnmo3ild aDel(vp;u)tlenmr3totlate n i;()truo(m3no4ll nlfct t) rta(r ou4aeeniocildfs2elumpn(0aexnir3todfaDelnvi t) rtmir3no4amt  nvta()sDrm(  nt1tle ii3iad aDum(vo (0tlenioctatopDelivo;s)sexmir nudaptn fesasf rraump;t1ope  o3iysfm uanvo u) eeomo todfmDe nvo;s0t2toio ou4apenmneslt)arrm(mo;u0opeoiieiltfm rauvo u0trtnmo3oydlpt livi;s)tetm(r iy4op n nciat  Dtmx ont1oetniiciyd a rmu s t0altrmocoydfmteaueo (  2trxm iu4ope  iesa(f rur(moou4oeen o3tatla2raump u4 lxnxoctatlpDraivs t trtrio3ny1ap  lfvsa( sDur( pnu4apt ifctld s2raump;()arxnir oy1faDeauvo ( srxrim nydolenlncia( aDrau  no0openiictlt a2ra( p;u0arxoxf ia1fm r i i;s  rur(r iu4aleeliesl(fs2rm(m ;t1oetnmociytfs2rmump u) eeomo tytlptrln o (  2xo(r nudolt  fvs t  rta(ronu0alxnmi3iyslm umnmpn()artrmrciotopDeaueol()texoimpno4am nmnvsl(fsrurxr ou1opxomicilsfm umu p;(0aexoxr oatlaDeli s (0t2xrim nu1lm nlivtas)arrrxr ot0oleomoeiytfm2ulu p;(0 eeoxf3iotlmDelneo;s0 rur(m3iy1lmenmneil(fa2taxr ;t0tpxnmociyt sDrlnvp (0tleoxf3tytfpDr i ol(0 rtm(r3ny4apenmnvsls)a2tmumpno1aetnifeiatlsDumuvon(4teerxf ta1fmt  i s ()tetoio oo1omt lfeia( aDururooo0aeeniocilt s2rln p u0tltnmr todopDeli il(0 2uoim3iudap nlivslt  Duru onu1apx mi3ild s rmuvp;(4 etrio3tatfa ranesls0s2toxo io1am   nei t)sDum(mp;o4olx mi3iytlaDeanvpn(0alxrmfcio1fm eaneo s)t2uoxm3oo4om nmnei (f Duauront0apenmi3tlsls2el(mpnu)aeerxoctadfmD  ueilt  etmiopno4aleelfvt sfsrtmum nt4texomo3iaslm rmumpnu)teenxo oa1oa e n o s0s2tmxr3iu1lmee fcsl(faDta(mpoo1tpen feiytla elump (0teerifcoydfat lueilt)srxr(r oudamtn ici (f Drmxr ;o4olxo fctyslaDulnvont)areomrciy1fm r n ols  2toxrpio4omt  ncia() rrru onu0tleo oeiadfa2ulnvs;(0tleomfciotlp rau ilt0t2umirpny4ap n ncil(f rumxmo;t1tpxnioeiadfs rlump;(4trxrmo3todlptelnvsls0s2trxm3nu4ale lncilsf 2raurpnu4alenmoeiytla emums u)aeenxo3ty1fmt li i (0teuoim3nu4omee ncta(faDrauronu1apt iietyt aDem(vpnu4 rxrmoctytfp r uvils texoxm3iu4ll nlivt s) rtmxrp;t1openio3iydla ranvo;t)teerir3io1oaDe ivsls srtrxr oodopen fvtlt  2taxro;o0opxnmiciysfa2uaumon(0 rtoxrciadlpt auei t0trxrio iy1ll   ici s a2tm( pou4texn fetys m2ra( s t)altrmo3todlpDelnei;s0trxmio3oodapee fviat  2uaum ;u1alen oeiltfmDemnmp;u0 lerxo3tydfm   n s () 2uoio3iudopt mies s  2umxrp;t0opt  icils a2rlu o ()areomo3oatom   i s;t0srtrir iy4lm e iet tf 2ur( o;o1oeto i3iytfsDelu onu4areoxrcoydla elnvil() rtrirpiudaleelfcsat arumxroou0alenioetltfs um( s (0teeoxr ty1la eaivsl()srtoirpou1ll   fciatfsDumum oo4tptnmociysfmDulu ont4 lenmo iydom  ai s ()trurxm3oudomeelivs (fa2urxm ;u0alto ieiysfs em( pn(0aeerxf todlat li o s0setm(m3ou4llen netatfs2rm(roou1ape iociyt sDelu s u0tltrmo3iotlpt lnvo;t0s2tm(m nu1lm elfciat)a2uaxr ot4tpx ii3ils sDranvo;(0arxnxf iy1lm rauvi s trumxr io4lmtnmieslt)aDtrx pnt1tlen i3tlslaDea( on(4tlxrxo oy1fptr n ilt) 2trimpnu1ame mnvi (f Drax ono4altnif3tytlm ranmp;(4aetnmrctytop  li i s s2urxo ou4ale lics ()srrmuro;u4tle mfeildlaDeauvo;(0 exrmo3iotfpDeaueo;t)trtmim iodaptnlfcsatfaDtrxrp;u0opxniocias m um( onu0tlerir oa1fmte nei;s) 2xmir3nydam nlict (farraum nt0oexoif3tad a2umu s ()alxnmr3oytfmt  ivs;(0teurxr3ny1lle livs t  2rrxr ot4tlx mf3tyd m2ul(mo;u)aetrir3oy1op   nvo (0tetm(r iu4amt  fetat) 2taum ou1oet ifeiyd mDul(vsnt)tleriocta1fa ranvols)sexr(r3iudom  mfvi s)aDurxront4tpx mo3ildfsDrmnvpnt)aetnmo3oadomt  nvil(0srxoir3no4am n fvs sfsrum( ono1teenii3tyt s rm(vs t)aleoif3iy1lmt lnvi s0t2ur(r3ny4ol emnvs tfsrta(mp;u1oexomi3tytfm2el( o;t)areomo oy1lpDraieolt t2xrxr3iodolen ivtl( sDtm(r oo1tpt if3tlt aDum(ms;()aeenxrctodlaDrluvo;s  etrxm3io1apen ivsa( sDraur ;o0tpe iocilsls ul(ms (4 rtoifciodoa rlivs t tetoxmpoo4ap nlivia(fs2tr( ooo4alt io3ilsfa eanmo (4tlxoir totop  li s t  euo(r3ny1apt licsa()aDtm( oou1oex mi3tyt m2rmumonu)arenir oo1fpDrln o;(0tetoxo3oy1opeelnvsas) Dtrxrpou1apen i3ilt mDulumsnt0 lxnio3oadomD lnvo;s t2xm(rpno4ameemivs s)sDrrx o;u4tee  o3iatfs2rl(mo u)tltnmf3oo1op   ies;s0srtrir iudlmtelivta()srrrxmoou0tlxnmf3tasls rl( s u) ltrio oatopD aivi t0s2to(m iudlpte nei ()arumxmpou1olxnioeiadfs umnmp;(0artrxf3oa1fp  lneo;()tetoirpoy1ale lici tfs2ur( pot1apxomfctydlsDul(vp;(4tltnio to1opDeau ols t2xmxrpiudal n fetlt srumxrpnt0tlt io3iys sDrl( o t4 rxoxo3oo1omDrai olt)s2tr(opno4lpen ieias artr(m nu0texomfcild sDrmu s;t4 ltnxr3io1omt luei;(0 exoir oo1ope  icsa(f 2tm( oou4tleomf3tasla2ea(mp;(4 leniocta1lm  lneolt  etrio3iudlm   fcias)s2tr(r ;u4aetoioctatlaDem( s (0aexrxf3ia1op eaies;t0s2tmxo oydap   nvsls)s2rm(mp;u0tltnifeiat s2ea(mon(0trtoxrctytopt  i slt  exoxr oy1al  miet (fsDrax p;o4apen o3ils mDeau onu4 ltnmf todfpDr uvo s0 exoio oudoltn fcia(  rua(r nt0optoif3tytfs elnmp () rtrmr iytfate ies;s0 2to(rpny1am nlncsat)aDrr(mpnu0alenifcildfa2umu o;(0 lenxo3oatla eauvo t0srumio3nydom e ictat  rraxroot4ale mo3iatfs em(mpn()areoirciydlptelnvo s  2urxr3oy4op e fet sfsDtmumont0tpe  ieiyslmDuln ont4arxrxocoytopt  iei;t) exrxmpoudlmt mivs tfsrraum ou1tlt mfeiasfa umuvpnu0 rxrxf3oy1latrlu olt srum(o3iydame lnesa(fs2uau p;u4openmf3ilslsDrlu s () lenmo3ta1la rauvo (0s2tmim3iudam elnvil(  rraxront1apxomoeildla emnvp;t4 rxrxo3to1fp ranes;()teto(r3nu1aptnlivs t s2ra(roou4tetniictyd aDem(ms u) exrxo oytlm  livs;s0 rtrxr3nu4am nmfei sfsrta(r no0tex ii3tlslm ra( o;()tlxnio3iy1la   ues s)trxm(o3io4apen ivtas)aDtm(ro;u1aleomieiysla2ea(vonu)trxnmrcoydlptrlies ()trumimpiy1ame licsasfartrx  no1opxnioctld m rlumonu4teeoirciatop ranvsls) exo(m3ny4ole mfeta() rur(  ou0opxo i3iytlsDrluvo;(4altnio3oa1opt au o;(  2tmxo ny4oltemietlsfarrrx  ;o1aeeo f3tad aDranvs (4altnio3oa1fa  an ilt) etoxo3iydal n nvt t srrrumoot1optnmoetldls2rauvonu0 ltoiociydlpteaieo s0srxmxr oy4lmeelfeia()arra(m ou4aleomf3tls a2ea(mo (0 eenio iytlpD  i il() 2trir3ny1oleelivtat s2tm(rp;t1olxo octyt a2ea(mp;u)aeerifctytlaDelneslt)s2toim3io1lmtelnci s)artaurono4aptn f3iat s2ulu p (4aexrmfctodlp  luvo t0teuoxopnu1alen fctas)sDrax o;t1aex ioeilsfmDrm(mp u0 rxnxfciy1fmDeaivilt) rxoiopoudapen nci t)srua(ro;o4aeenii3ils m2emnmp t0aleomfcoy1latrlueil() rxmim nu1omt  icta(fsDraxmo;u1tpt moetldla2elums u)alxrxf3oy1oaD  u s (0seumxrpnodalt mfcsat) rta( ooo4tpeo fetadfsDemums ()texnxo3oy1omD  neilt0trxrir ou1ll emfetat a2trumpot4aetn ictatfmDrlu o t)aexrmr3todlpD livi;(0s2trim3no1apeemfei (f rrmu o;o4oltnmfetysfmDea( onu0teenmo ia1opD li sls trtoirpno4ape  ncil( srrru ono1olx  f3iysfm2uau s t) lxrioctatfp  an o;s0teuo(mpny1olee ncil(fsrrau  ot4apxomfctyslsDeluvo;t)treomo iadlaDeauvsls0 rtoirpio1amt  net (fa2raxmooo0oleoiocild m ean o;u4teeomr oydfat  i i;t0 2umio oodamtnlnvtas srra(mpnt4oetomf3tydls ul(vp;t4aleniocoa1omte n o () rxm(mpoo1ome mfcta(fa2ua(m nu1altomociaslsDumumo;(0aeenxo ootlm ranvi;(0 rtm(m3iy1ll n ncil( sDua(mo;t0tpx  oeiatfaDuln snt0 eermociy1laDelivsl(0t2tmir3nu4aptn nvil( a2taumpnt0oeenii3ils s um( o t) leoxf3iytlpDeauvi;( t2toim3nydopt mfciasfs2urx o;t4opt  oeiydfm rl( s;t4trerxf3oodlpt  ivi;t0teuriopnu4ole  fctl()srrrx pnu1tex mo3tytla rmuvs u4 exnmf iodla  auvils t2to(r iu1omt mivtat)aDrmxr ot1oetnmictyt aDea(vonu4aexrirctotop e i olt t2trxr nu1lle lics sfa2ta(r nt0aeeomieiadla2ean s;t4tetnxr oodoaD luei t  2urirpoudalt mneias sDua( oou4oeeo o3ils a ean o u4trxnifciydfat lieo;s) 2urxr io1lmee feil()a2rrxmp;t0altn feildlmDrmn ont0 exrxfcootfatean i ( trtr(rpny1lm  mncsat  rumump;u1aleo i3iytfs ean s;() etnifctadomt  n olt)srxm(r oo1ope lfcs tf Durxmpoo4tpxomi3iyslm2eanmsnu)tetoxf3ia1lp elivols trxmxopiydamt  nvilt)s2ur( oou0tee  f3ilsls2ra(mp u4 ltomf iodop e ueo s trum(o3oo4opee fcil(fs2uau pou1aeenmfciydla2eln p u0tltriociatfp   i o;(0 rtmim3ny4op nmicsa(f 2tr( pno4tpe  i3tadfs em( o u)alenxfciotomDeanvsls) rtoxr3nodome lneiatfa2ta( ont1aexoif3ilsfm rlnvsnu4treoio3tydfmD au o;(  rxr(m3nodalen icil(fsrua(mo;o1oltniieiyt a2rau o t) etoiocoatlmDeln ols  euriopnu4lmte fesa(fa2rau  ;u4oexnmoeiad aDumumo t)aetnmf oatlp  lueilt) 2xrxrpnydopt  neia( srra( o;u4tpxnifciyt a2el( o t0aetomoctytfpt lueo t0sruoxm3nydlpte ies s)sDtr( oot1aptniiciat mDelnmonu4 rtrxr iy1lat  uvs s  2trxm3nu1omtnlicils) rumurono4tlxn oeias mDeanvpn(0 ltriociadlmte n i;( t2umxm ny4llt  fvtat)sDtrurp;u4oetniieiadlmDelnmo;()artnxoctodfpDelueo;() eumimpnu1lle lncs sfs2rru  ot1tlt iieild aDrm(mon(0 ltrif3tatop eluvolt s2tr(r io4lmenlnvsl(faDtm(r ;u0alto o3tyslmDumu s;t4trxnxr to1fptranei s trtoio oy4llen feslsf rum(mpou0tet ii3ils a umuvs t0 rxrir3iotfaDrlu il( trurxmpnu1ope mncia()srtmurpno4alt  feiyt m2ran p;u0artoif iatlat lu ols) 2ur(rpoo4ame mncs s a2ra(m no0olx ioctatfa2eln sn()aexrmo3oytopt luvo;t0 2urir3nydapen iet () Dtmx p;t1tee mfetlt mDemuvp u0 leoirctatfpteli s s trtoxopiydoltnliet (fa2ra(mo;o0olx ioeiys s2ra( p (0 ltomr3to1fa raivsl( t2tmiopnu1al   nvsasfsDtmurp;u1oeen oeiydfsDem(vo;(0 ltrxociodfatr ivi;s0srxoxr3oo4ale miei s  2umxmp;t0oet ifciadfs eanvp u)artoir tytoaDrai olt seuo(mpoydoleemfci ()s2raumono1tetn o3iys mDrmnvo t4 ltnmr ootla e ivs (0tetmir no4alte fci t) rtax  no0alxo iciyd a2ua(vsnt0texoio3iytfp eauesl(0 2toxo3nodomee ieslt a2rax pot4apx mfciytfm2rlnmo ()aexrirctadfatrlu ol()t2trxrpiydole mfcsat) ruaxro;u4aexn oeiytfs eau p;()alermf3oytfpDeau olt trxoxopiodlpee neils)srrm( pno4alxoifciatfs2ea(mpnu) lxomo oy1oaD lieo;s  exmxmpiydlme lfet t)sDrrur ;t4olxnmieiytfm2um(vs t0 lxrmfcoo1fpte nesls0t2ur(m3oudlm n fvilt) Dta(  ;t4olto fctld m2rluvpn(0 lermf tatfptr i o;t0teur(r3nodolen ivslt  2rrx ont1teeomociytfsDua( p u) lxnircia1la rlnvi t)seurxm iu1oleelivi t) 2uaum ot4tptnmfciad m emu o (4altomo io1lp   nesl(  2urimpnodome miet tfsrrmxmpoo4opxn ictlslmDemuvs t4trxnio iadoa   ivo ( trxm(opiy4op elfvslt)a2ra(m nt0openii3iysfa em(vs;t0alxoircoo1oaD  neil(  eurxrpiodamtnlncsa(fsrtmxrpoo4tptnifctlsfa2rau o (4 lermf3ootfaDeauvs s0 rurirpiu1ol   fvtas)s2rrumoot0ole  feils m uauvonu0tltnir ia1fa eluvs ()seuoxmpou1omt lfcsas)sDuaxmoot0ope  oeiydls2rauvont0arxrif oatfaDelieilt  2trxm iydope lieias)s2tr(mont0oex ioetas sDel(ms u0aeermf ty1fa rluvi;s)tetoxm oudoltn nvi tf Dumx ont4ope mo3tadls ulu sn() renio3iydfp rluvil() etrim oy1lmtnmnvi () rtmxm ;o4olt  oeilt sDem( p;(4 etrxf ia1lmDran i s trxrxo ou1ale lfvilt)aDurxr ;o4oet  i3ias sDelu o;(4tltrir3tatop r ivi;t)texm(r3oudap n fvsat srraur ot1olt if3iad mDelu sn(4 rxrxo3oy1om  au o;()s2tmxr oo4lpt lfcils)srraxmo;t0opxnifciyt a2uau pnu4alxrxr3ty1op eln o () ruoio3oo1ll e fesl(fa2rau pnu0texnmoeilt mDemnvo;u4tlxnircta1fmDr ies t)teumir3oodole  fciasfaDtm(m nu4aeeoioeias m eanvp;(0alenifctadlaDrlieils seurirpiu1am emfvsa(fs2tm(r nu0oetnif3ild m elumonu4 rerio3tadfatelies;s0t2trim ou1omte neiltfa2rmuroou1altnmoctadfsDra( pnu)trermfciy1om  aieo s  2xmxr ny4amt lfct s aDtr(ro;t0oetniieiys mDrm(mp;t) eermr iatfm elivs;( s2urim nudoltemncsl( s2tm(mpno4tex  ieild s ua(mp;u4areoifcoydopteli i;t)t2toxo ny1amt  fetls srraxro;u1oetoiociytfa2eluvs;t0 ltrxr oodoaDe ieo;(  etoxrpno4amenlnvtlt s2rmxm ;o0tpxnioctyd aDumuvo;u4 rtnxociydfmteluvs;t trur(r nydalee ivtlsf rtrxroou4tlenmo3iydlmDeanmonu)alxomo3iodomt aues;(0 rxrxo3oy1amt lnvias arur(  oo1tet  o3iad aDrlnvpnu0 rtoxfcoydlp rliei s0texo(mpiodom n iei s s2rm(m nu0teenmietasfm2emu on() exoxr oadomtrluvi;t sruo(m3iudoltnmieiltfsDtm( pno0aeeo o3ilsls2ranmpnu) rxoir tydlp rlu s t0teurio oo1lltelnesltf 2taxm ou4opxn o3iyd sDranmp;(0arxoxr io1lm   nei;s trtriopiy4lme lfctlt)sDtrxrpoo4aetomo3iltfs elnvo (0 lenxrcia1faD auvslt  exmxrpiu1omtnmnviasf Dtaxrpoo4aet  f3iatfs2ranmo;(0texoio3ta1laDeau o (0 2xo(m3iydop emivsat sDur(mont4aexoiietldfmDum(ms;t4 etrmocia1lat au ol(0trto(m iy1apt mncil(fsrumu  ot4opeoif3iad sDemnmo ()arxrir ia1laDraueslt0 2urxo iy1lpe mivi tfs2rr(  ;u4aexniiciytls2ra( pnu0 ltoxoctadom eluvs;s0srxmxopnudamte icil(f rta(  ou0oee ifciltfaDranvs (0 etnif iadlmDraiei;t srtoio3oy4opt  fvta()a2rmumooo1oleo ociat s um( s;u)trxomo ia1lpD  nvs (0texm(o3oy1ap   nei s  Drr(mpot1tpx  ietatfs rm(vs u4 rtnirctydop e ivol( sruoxmpno4lptnmici t a2um(m ;u4ale  octys m uaumpn()aeermocoytlm rlnei;t0t2xmxo3io4aptelfctatfsrumu poo0oltnmociyt m elu p;()aexrxf iotlmDelivil(0seto(r iydalee iet sfartru  ;o4opxomictas m2ua(mpnu) etrio tatoaDe u o;s) eumxr io1alt  nvtl()s2rm(rp;o0apx  oetyd m rluvo;(0 lxrio3io1oat lueolt) 2tr(o iy1ll e ieslt) Dra( pou4tpen ieilt a rl( onu4 rtnxo3oatfm elueil(0t2xo(m3iu4ome  nvt tf rrr(m nu1tee mi3ilsfm emn pnt0artoxr iy1lmD  ivi ( t2xoir nodlptemnctlt)sDtmumpnt4tlx  ieiltfmDrlnvo u4teeomf ootopDeaues;t)truoir nudol  mictl(faDuru  nu4optoiietas m2uln p u0texniocoy1lp e ivsl(0trtrim3nodolteliesa( a2tmxrpno1ole mieiysfs2eanvp;u4 reoxrciotopteln o;s seum(o iu4lme  fcsat s2raxr ot4apt  o3iasfs em(mp u4texnxr3iydopt auvi s0srtrxr iy4amtemfctatf 2taump;u0opeomociat s rm(mpnu4trxnxocta1omDraivo;t t2tr(m3no4lmte feiasfa2rm(mpoo1oex io3iad s rmnmo;() rermf tydfat lies t s2um(opiy4ap nmnvtl( aDtax oou0opxoiocild s rmnms;(4arerir3iytlate nvils trum
\ No newline at end of file
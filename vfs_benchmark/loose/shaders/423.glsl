@@ -0,0 +1 @@
+nvo;(0 rxrimpiy1lm elnesas arrrumooo4oeto fetldfs em( onu4aexrmociydlaD  i s s  exm(o no4omt lfeil() Dumxro;t0oltoiociysfa2em( s;t0 reomr ia1omt  n sls0seuoim iu4oleelfctl(f Draumpoo4aex mi3iatlsDuaumo t0aexnxo iotop eluvs;t) eum(o nydoptelnet tfartaxrpou1alto feiasfsDem( p (0 eenxo to1lptr i i s) exrxr3ou4lptemnvil(fsDtrxrono0aee  i3iys s raump;(0trxoir oa1fa e u sl()setr(o oodam   fetas sDuaurp;o4tlenii3iltlm uauvs;u0aetrxf3oadfp e nvi;s)s2uoir3nydaleemfeilsfartmxm ;t0olx iociyd sDem( s;u)texnmociodoa   nvs s)trtoir3ou4ale lnetatfs2tr(mpou0texomi3iysfa2rmnmp;(0 eeoxfcootfm rln s t sruoirpou4lm emiet s arurx  nu4oeeoifeiydfaDumuvp;t0artrxf ta1lptr uvs;()srxrxmpnu1lm elfcil(farrru o;u1ope  o3tad s uan o t) renmrctatopt livs;s)srumxmpny1lltemnvils)arururpou0aptnio3tls m2emuvs;u4arxoirctydlmD lu ols)t2tmxmpnudlltemivt t arrax  nt1oetoiociydfaDemuvo;u4 eerxf iodlpt  ieslt0t2umiopoydlleelfcsls s2rmxrp;o4tpe  fciatfs ra(mp;(4tlxoxr3iodlaD anvo;t)tetmio3iydape  fct s)sruaxr ;o1oet  octasfs rmums;()aeenxf to1oa   nvolt)t2xoio3nu1apeemfcil()sDta(ronu4opt ioeiltfaDraump t4aetnxocoydomtrlnei;s)t2uoxm3nu4lptelfvtlt arrr(moou1tptomfciydfm umn s;u)arerio ty1laDeanvilt0 2xmxr3nudllenmivsas) 2trxm no4tlt iiciytls2umn p;(0trxomr to1latr i o ()sexriopny1lmt mivtatfa2rauro;o4tpe  oeiatls2uanmpnu0 etnmo3iydfmDeluvs s0 2uoxm3iydopenlnvi ()sDrruroou1oltnio3iasfm emnmp u0 rxrmr3tadlatrlieils)texoxrpoudop n fvsa()artrxm nt1aee iictls sDrl(mp;u) rxoio todfa r u i s)srtr(o3iodal   iesat artau  ;u0tleomictytlm eln p u0 renxo oy1fpDrluvs;t0srumxo3io1optelnvias a2ua(m ou0tpe  f3iasfaDra(msnt0arerxr oydlpt luvil( texmxo3ny4ameemncs t)sruau poo1aexo fciytlm em(vp t)trenmfcty1lmtrlueo (0trurim3oydlltnmfctl(fa2taxrooo1ape mfciydfa2ulu s t) rerxfctodoat lu o;t s2uriopoodlp nlfei tf Dumxmo;o1oetniictytlsDem(mon(0tleoircoo1omtelu o t  2urxrpio4opt livtl( sDua(  ot0tpx mo3ilsla um(msnu0areoif3iydfmDelnvils  2xmim oo4oleelnvtatfaDumurono0alx  i3tldla umu sn(4texomo3oytlp  ln sls t2uoxr nodapee fvtl()s2raxmooo0tex ifciys sDuluvp (0arxomf tytfa   u i;s0setmxo no1am n nes t sDtr(r no4aleniociasfs2um(mp t)tetnircoytla rlivo;(  etoimpny1lmtnlicilt  2ra(rpno0olt ii3ias mDul( on(4 rtnmrcoadfaD  n o t) rxoim3iu1olee fctls) rua(  ;o4tex ifctlt m em(vsnu4trxnir oodfpteauesl( trur(m io1ol  lfesls)sDumxroou4tle ioeiasls2eau s u0 renmf3ta1fa  li sl(0trtmxrpiu4llt lnvsls s2uax pnu4openmfetas m eauvs;u0 rtomrcoo1lp eauvs t texmio3no4alte fet t a2tm(monu4opxniiciat aDemnvont)artnifctytfmDrai olt0 etrxr oodomte fesat srra(mp;t1aleomieilsfaDumnvo (0 lxnir iodoateln s;s  2umxmpoo1lpeemicils arururono0aex  o3tydfsDemnms;t4 exoxr tytfp  aivi t) 2xrirpiudlm emnvi (f Dtaxr ;o4ape if3tad aDumnvp t4tleoio to1opDelnes (0 exoimpny1olte fci (  Dum(  oo4teto f3tldla uln p;u4altnxocoadom  lnvols)truo(o ou1lmtnmies ()srraumpot1tptn ictys s emu p () etrircoatoaDrlieo (0s2xo(r3nu4lmtn ics sf rtru ono0alen octltfm rlumont) lermf iatfm rluvol(0 2xmxmpiydlpeemivsas)s2umxr ou1tptnmf3iatfa emnvs;t)tlxnmrcto1lm elieo;(0 euo(r3no1lptelnei s)srua(rpot0apt mietas a2rmnvpnu4tetrxfciy1oateln i s)texmxrpny1ll elics t)s2ur(r nt0ole  i3tlslsDemnmsnu0aleoif todoat aies ( trtmio3no1aptnlneiltfa2tmumpnu4alx mi3tasfm2rl( p;() ltomo oa1fptr uvol(0 rxr(r oy1opte fetlt)a2rr(mpot4aeeniictysfs rlnmo;t4alxrxf oa1om  lnvs;s0trtmirpnu4oltelies tfa2rmxr ou4tlxnmi3iatfsDemnvo u0teerircia1omD  uvsls0t2xo(r3iudol nmnvs tf Drr(m nt1texnmi3iytlm2ra( p;t) rtnxo3ia1lmDrau ol(0 ruoxr3oy4ole mfviat)aDtmur nu0olxomoctyd mDulu pn(4artnmf tatfmt an s;( truoim oydom nmncils  2trxro;u1aetoioeils sDul(vo u) ltrmr3iy1lmt aneil()srxrimpiydam emivtl()arurxmono1oee ifeiad s2umuvonu0texrxo tydfp ranvo;s0t2tmxo iy4olee iesls sDrmxmooo4tpe if3tldfa2rmumpnt)arxoif3oydfmDrauei s0s2uoxr3ny1lmt lfei s srrmxr ot1alxnii3tad aDuanmsnu4trtoxr tytfpte nvo;t)t2uo(r oy4lp nlfvsat arumx  oo0opxo iciasls2uau o;u0 lenif oydomDelu s;t  2xr(mpoo4lme livt t)s2tax  nu4tleoif3iad mDem( o;u)tlerircootfmtraneols  exr(r3oy4amtemnvta( s2trum no1tpe iieils m eau s;(4 rermfctotfat li s ()trtm(mpno4llt  ics (fs2urxmpoo1tleo oeilt sDeanvo;u4aeenir3totlpDr nei s)srtoxo3io1opt lnetasfsrtaumoou4aeeomfcias a ua(vs (4tetnio3oytomD lnvo;s  2toxr3oo4lm  liet s  2rmx ont0tltn oetlsfaDua(mo;t0trenio3totlmDrln s (0srtoir3ou1omee ivs t a2trx onu0apxomfetydls ul(mo;()aexomo3tatfmDrlu o ( setmxo3io4lmte netas)srtrxmonu1alx mictas aDeanvpnu)alxrio3tytoa rlnvs;s tetoxo3no1ap  livtls arumxm ;u1apeoifciasls2ulums t0 reoxo3oy1fmtr ivslt0tetmxrpnodlptelicslsfa2uaur no4alxomfctydlm uaumo;()trtoir3iatomtrli s s  2um(r3nu1apeelfvs ()artau  ;u4opt iiciytlsDrm(ms;u0tltoiociatfpDeau ols0srtrxr3iu1apenmfeia() 2trx ont0oleoiietldfmDrmuvpnt4trtnif oa1om raivi;(  2xmirpno1omtnlnet t)s2rr(mo;o1open o3iadfm rmn pnt4arermr iytfat aneols0 2xmxopiy4om emivsa()aDtmump;t1olxnmfeiadlsDul(vpnt) rtomr to1fmDean ols t2tmxo3oodlptn ncslsfsDtrxmpnu4optn octytlm rmnms;(4 eerxoctadlm   neol(0 2xmxm no4lmt  fct ( a2tr( p;u4tlx iietld aDrluvp;t4 rerxr io1fm eai i (0 rurio nu4lpt  ncs t a2urx  ou0texoifcildfs2rlu p;u0tlxnir3ia1op e ivs s) euriopou4lptnlnetltfarrru pou0aptomf3iatfsDrmn o (0 eerir3ta1om r nvs;s seurir iy4am   neta(fa2ua(rono4opxn ieiasls2umu o;u4arxnmocoy1lp  aivi t0t2xoio iu1omee fvsas sDrm( pou4tltn icilt a rmnms;(0tltnmo ootla eaneo (0 rumxrpnodomee ivsltfartmx  ;o4tle  i3tyt m2umu p;()trxrmocia1fpt lueo;(  etrxr oo1lmee nei t)aDtr( p;u4opxo feiysls2umuvs;t4aeeoxr todlmD li s;t0seur(o3iudlptn fcils)artrx pno1ope  i3ildfm rmu pnu0 rerxr totfmDeanvs t srxoxm no4op nmfeta(fa2rrxrono1tee iociyt sDumn snu0treomocio1oa eanei;() 2ur(rpoudapt lfes t)sDrm(root1oleo ietyt a uauvp u4 eeomr oodfaDrauei s s2uoxo3no4ame mneia( sruaxmpot4oexn octasfs rmnvsnt)teerirctatoaD  i s () eurxmpnu4lmt liviatfsrtaxro;t4alx moetasfaDrmu p;t) leomr3iydlmt  nvo;s  2xr(m3oo1lleelfvilsfaruax o;o0olx mf3tysfa um(mp (4tlerxo ia1lm rlies t)teto(o ny1lptelfcsa() rrmxmo;t4oeenmf3iad mDrm(mo u)trxrif oa1oa rlivo t0 ruoirpio4ll  mfvsa()s2ra( ooo0teen i3ildfa um( s u4aetnifcootla  aivolt)s2tmxo ou4opee fet s srrrx  nt4ole mi3iltls2ulnvsnu)alenxfcoy1fpt lu i s t2to(mpou1optemnei sf Dtmumpot0apt ifciytla2em( sn()tleoxfciatlaD lnvolt  eurxm3iy4al nlfei (f 2trur ou4apeomictlsfs eaums t0trxnxrctytomD lieols)sruoxrpnudllen nvsa(f 2uaumpoo0aleo fcildls rm(vp;(0 lxomr ootomD lnei;( texmxopiu1ale mivi s a2rm(m nu0tpeoiieildfaDelnvpnt0 ltnifcoytomteai i s)setoim3oy1ope lictlt a2uaxr nt0aee mi3iadfa2el(ms u4 rerir3iadfpDrlnvo;() 2umirpiu4al nlivia() Dua(r ou4tptn ocilsfm2ulu on(4arerxf iy1fmDe u ils) rum(rpiu4aptnlfci s)srtmxmp;o4oet  ietat sDuauvsnu4 ltnmo ty1fa rlueo;t) 2trio3nu1lmtelivsl( sDtr(monu0aexo ieils s rauvont0 rtomo3tydlaDrlu o;s texr(o iy1amt  fcil() Dtrxr ;t1oexo fciys aDraums t)tlermo tatfpDrlueo;t  etoirpiu4ale mfvsa(f Dtaxmoot0tetnioeiydlaDeau snu4trtnifcto1omDrln i;t0t2uo(rpnu4lptelncsa() 2rrx pnu0tpt io3ild s2rmnmonu)tlenmfciodlaD  ieils  2xmxr3iodlpe micsat artr(m nu1tpt mfciat a rlnmon(4arenxf3iydfa e nvil(  rum(o3no4lmt mfcils arurur ot0oeto f3ild sDem(mpnu)tleomr iadomDe ivils)srtoirpoy4ome mieil()arta( onu0aet moeiadfmDumumpn(4 reoxf tytfpt  nei s trumir3oudlp n icils srrax p;u4tex  oeildls2rl( s;u0 ltnio iatlmD lnvi s srxoxm3iy4lp nlfetl(  rraxrpnu0open i3iad s rluvo;(4 rxnmo3tatfm eauei;s s2um(o ny1ope lnvt t a2ua(m ;o4tpenmietltlsDrmumo;t) rerxrcoytlp rauvs ()trxmim nydlm  lfvsl()s2raum ;t4tpeniietltlmDran o u4 etnxr3oydomDr ies ()seum(m3iu1ale  netlsfaDtrurpoo4openifeiltfm ean sn() ltoxrciytfpt  ueilt)trto(r oodlmeelfeias aDra(m ot4opeoiieiasla2emn o t0 eeoxf tatfm eaivo s s2xoim3nydame  ict t) rra(mo;t1opxnmoetasfmDum(mpnu) renxfcoydfaDe ivs;() rtm(r3nu1opeelnct s aDuru p;o0tptniieiasfmDumnvpnt)aexnmr3todoaD lueo;t)texoirpoudap n ieta(  2tm(r no1tlt mo3ils a ua(mo;(0arxnmf iodla eaieils0 etoio iydomee neil() 2rr(r ;t0tpe  iciysla2ul(von(4 ltnircto1lp eauvi s)setr(rpiu4amenlncils) rtaxmono4tpxo iciydlmDuln o;()tetrmfcoytfaDeanvi t  2trio3oudll  mfet t  rta(ro;o4apenmo3tytls el(mp u4 ltnxo3to1fptr uvil() ruriopno1omteliei ()arra(m ;u1tee ioeiytfm2elumo;t0 etriocta1fpDelivsls)t2umirpou1olen nctas sDrmx poo1olt io3iltfmDuanmo;()alxoxrcia1la   u s t0 rtrio3oudopt mfetas)arur( pnt1tpeniiciatfmDumn s t4 leoiociotfaDe nvs s0setmxo iy1apt mnvsatfaDumumo;o0aet ifetldfs2raums ()aetrxr ty1fpD lnei t)srtoxo3oy1lm n fcs s)a2ta(root1alto fciasls2emn pn(0aexnmo ia1latrln i;t sexoirpno4am elivsa( srur(  nt1optnioetyt sDumnvonu)trtnmfciytlpDrauei s)s2toiopoy4ole mnetls arua(mp;o4oee io3tas mDeanvs u)treomf tadfp ean o s  exo(opoodapenlicia()srrru pot4tlxnmietat m2ul(vpnu4 lxoxo3tadfm eaneo;s)s2tr(mpno4oleelfcsl( arrm( oot0aexo icildfsDemuvp u0tlxrxr io1oa raivo;(0truo(r iudomt  nctls)sDrr( pno4oee  oeils m2ua(vo;t)trxrmf3tydfpt aieils  eumxm3iy1olt mfvi ()a2rmu  no1tpxomieiydfaDuan pnu0 exomrcty1oat  ivs;t  2trim3ou4lptnmfciltfsDtrxrooo1oexomf3ildfsDumnmp (0 lxoxociy1lmDran o s  2tmir oy1lp e nvilsf rtrx ooo0apx mfeildlm2ea(vs;() etomf3ootfptrlivs;t)srxoim nudapt  nvil()s2um(m no1alt iiciysfs2ua( p;t4texnir3ootfate u i;s  etm(o3iu4oltn fctasfarrrxroou1tetnif3tas a umu o u4alenir3ia1oatelu il() 2uoir3iu4omeelici ()artm(  ot0olenmi3tltfsDumu pnt)arxomo3iadom   ueol()t2uo(r3oy4omenlnetlt)aruru p;u1aetomfeilsfsDrmuvs u)tlerxrcty1omDr nesls0sexoio nydoleemfcsa()srtmx  ou0oleoiictad aDrm(vpn(4tleomf oodoa eai o;s) rxoxopiudaltelicsas)srtrxm no0oeenmoetltla elnvs;(4 lermrcoo1op e ivils0setoimpnydlp nlfvils s2urxm ;t0tet mocildfa2uauvs;(4 exoxr oytopD  i s (0seurim iydlm  lfvt (  Drmu ooo1olenio3iytlmDra( ont0 exrxo io1latelu i;s0setr(m3iydaltnlfetlsf Drr(  ot0texn iciadfs eanmpn()trenmrcio1lmteauei ( t2tmxo3nu4omenmicsls  rur(mpno1oetn feiltfs2umu o u0trtoio to1optr ivils0 rxm(m ny1al  mnvt t a2um(rpno1tpt  i3iyt mDeaumo;(0 lxnio iatomtean s;t  euo(r3ou1ale livs t aDrrur ;t0aee  oeilt s2ean s t4aexnxo iy1omt aneslt) rtmio3ny4lmee nvsa(farurxr ;o1tpt  fetls a rl(vp u)texnmo todlpD  ieo;t) eurxr3iydolte ivslsfaDrrur ;t4teen ictydfa2ulnvpnt)trxrxr3oodoaDe ueolt0s2xo(o iy1lpe  neiatfarumum no1opxn i3tltls el(vs t0aetrxo iy1opt anes;s  ruo(o ou4amt lncsa( a2trxr oo0tltoif3tasfsDrmu p;()trtnmf3oo1fpt aneo;t0 2trxopoodlmt  ivs tfsrtaxmooo1aexn i3tyt s2ranvpnt)teerxf iydfa e ivil(0 eurxm nudoltn ncs sfsrtmxmo;t1tetoiociatfsDraumo u0 rxniocoydfmteaues;t0 rtr(mpiu1alen fvta(fsDtm(r nu0ape mietadfm elnmon(0arxrmo3iy1fp elnvol(  2xmxrpnydom emneiat sDrmxm oo4teen ictadfa rlnms (4 eerxr3oydlptrlivi;(0 rxmxmpou1ap emfctlt aDtmxm oo4opt mf3tltls eaumont0tlxoiocoytlp  ai ols0seurim nodol emnvs s  rtmxroou0tlen o3tldfm2ua( pn(0artnio oadop   uvs ( teurxo3io4lle mivi tf 2taum ;u4aetomi3iasls ra( s u0treoxocoy1laD auvil(0trtoxo iu1omt lfvils aDrm( p;t0alxnmiciatlm ul(vp (0texnxo3oytfptranvi s  exrim3no4olee nvtl(fa2raur nt1ole mfeilt s uauvs;u)aexrmociodlp e ies (0sexrio ny1lpt mnctasf rrrxrooo1apxoioeiyd mDel(vs u)teeoiociatfp e iei t0sexmxr oodop  lnvias)a2tmumonu0opx ii3iydfsDuln snt4 rxomf ta1fmD livslt0srurxm3ny4lm emictl(  rur( pou4apenifeiys aDuln ont) lxomr3oatoat lnes t  2trxm no1op   ivtlt s2taxmo;t1tpx mf3iyt m ul(mp (4aetnio3oa1fm e n ols teto(rpiu4ap nlietas  rumxm no1teenifeiadfm ra( o;(0aeermo tatoatelueo s0t2urio3iodllee fei t)artrum ;t4aeeomociasfs emumont)artnxo3ty1lp rau i s0 2uoxo3iodomt lnci s  2ra(r ;t1oeen i3iyd a2rm(mo ()tleomo3totoptelivs ( trtr(r nydlm   fei s)s2tmump;u1aexn i3tyt m rm(vsnu4tltoir oo1opDean s;t)trtm(r nodapte fet s)srrax poo0altnmiciad aDelnmo t)aexoxr ootomDeanvslt  rtm(m3oy4lp nlfcias) 2rmx p;u1aptoiictlsfaDuanvp;()aeeoirctotfate u s t trxmxr3ny1ll eliviatf rtmxmo;t4tetnmi3iyd s2ra(vs (0 rxomocoatfmDrai s (0trxmxm oudam emncia() 2ra( onu0olx mi3tad sDrlu o;t)teerxo3oydop eluvils0t2xm(r nodllen icil(f rurxrpno1optn oeiaslaDuanvo;() eenmo oa1lateauvsls0 2xm(m3iy1llt livils srtrxmoot0tpxo oetyt sDemn o u0tetrxf oa1lpD anvo;(  exrirpoodlltn ivt tfaruauro;t0tptnmfciad s2um(ms t0 exrif3ty1fp   i ols)srumio3oo4olt mieta(faDtauro;o0apeoioetytla uln onu)trtrxo iytoatraivo;s  2xr(o io1aptemnetas) rua(r ot0tex iieild s2el(vpn() leomrcoytlmt  i sls0 rtrxo3oo1ome mivsat)s2umx  ;o1tpto o3iadla2emumo u0treomo oy1oatr n o s seuoiopoy1altnmncslsf Dtmump;o4ope io3iysfs ea(mo;(0alxnxfcty1fmDeliei t0srto(r ou4llenlfesa()s2umumooo4tptomictatlm ra(mo;(4artoxf3oadoate ueo;(  2urio nydopee fvilsf rtax pot0texnifetls a emnmonu)tetoxf3io1latr u sls t2toxm3no4ameelnvt t) Duru poo0oetn oeilsla emn s;u0aexnmo oytla  lueilt0t2umxm ou4lltnmivsat)aDurum no1optnmociytlsDulums (0 rxnxrciy1oatelnvilt)srtrir3oy4ap emfcsls  2uaxmpot1oeenmfciatfs2elu s;(4arxomr oatlm raieols  2xm(r iu1ap elnct tfsrrmu pnu0tlt iiciad mDranms (4 lxoif3io1laDrai ils trto(mpiodlmenmfeta(fa2tau onu1ope ioetas m2umuvo u)arxomf ootfmDrlieo t0srtoim nudom e fvsas)a2rrxm ;o1oetoiictat sDemnmont0 ltnio3tytla   n i;s0texmxopio1om emfvtls) 2tmxm nu4opxnmoctatla2rmumo t4teerifcty1fmtean ilt srtoxr iudopt  ivt (  ruru p;u1tlenii3tldfm2rmnmsnt0alxnxr3tydoptrluvsls0srtr(r ou1lmtelnesat  2rr(mo;o0tpt miciasfaDrm( snu0artoxr3todfm r neo;t0tetmxopou1ome  ncsl()aDtm( p;o0apx  feiadlaDua(vpnu4trxrmocoo1opteaivo;(0t2xm(rpnodlp  lnetltf Dur(mpoo0aeeomietlt m2emuvsn(0 eeoxfciadoaDelu i (  euo(m3iudll  lnvsas) Dra(m ;o0oet ioeiasfsDrmn snu4tltoxo iotlm  aueslt sexmim oudlm  lfcil(  2ra(  ot1ale if3ilsfs2ra( p;(4aetomfcoydlpte uvs;( texrxo3oy4ll  mnei (  ruaurp;t4teenifeiadfaDuanvp () exrxf oydlmD  ieo;(0srxmxo3oo4om   netat) 2rr(rpnt0opeoif3tlsfaDuanmsn(4trxnxr3to1omt au sl()texo(o ou1open fvs ()a2tax onu1olxn i3iad a2eau p (0artrif iatfp   n i (0srtrir3oudal  mfes (fa2ta( onu4tpe micias sDemnvsnt)aetoif iy1oat  i ils)sexo(r nydoltnlieiasfaDra(rpou4aeeomieias mDrlnmp u0trxomf io1omt lnes s0teum(o iy1ll nmfes ( srtm(m ou4tpt  ictysls ea( o;() rxrmociydlpDr nvols s2xo(m no4op nlnvt s  Dtrxmoot0olx  f3iyd sDrm( sn(4tlxnmr oatfptr u i s  2urir no1optn fes (  Dua( p;o4olenmf3iltlm2ea(vpnt4aeeoxrctytlm rlnes;s)trurxr3oydapt  nei ( sDtaxmpot0tptnio3iltls uauvont0aexrif iotoa   nes ()s2trxm iy4al nmfesls srra(rpnt0olxnif3iyslmDumnvonu)teenmf3iy1faD  uvolt teuoxopny4optemfvt sf 2rm(r ;u1opxomoeiatls rl( o t4 reoxo iytoa  livil() etmim nu4lmtnmneias  Dumxr ;o1olxn fctys a ul( s;u0 lerxf3tytlaDe n o (0 2xr(m oydape lfvsls) 2taxr ;t4texo o3tls s emumpnt0alenxociydfm  auvolt0truoxm3iu4ale lics tf 2umxmpno1tetnii3tasla2uan s u)aexoircoo1op  aueil(  exoxmpiudol e ieiatfa2ur(mo;t0aetoiociatfs2ua(vo;u4tlxrmo io1fateaivo s  rtm(r3ny1al  licilt) rrmumpou4texo feilsls2uaumonu0aeermfciotfp r nvi;t0texoio3io1am  miei t  Dtau  ot1apt  fctydla2em(vp;() eenmr3io1late i i t0 etr(o oy4lp   ivil( sDrr(ro;t0apxnifciytfs2rau o;()trxnxfciadoat au s s0 exoxopnodam   ictl(  2rr(rooo4opxomoctydfs2uaump;u) rxoio3iytfm elueil(0seuoxmpoo4apt lfvilt  rumx oot0tpx ioeildfm2um( p;t4 rtrmf3ty1oat  neo t)texoir nudap elies sfsDtrxroot1alt iieiytla2ea( sn() ltomociodfpt  iei;s0 2umxo3iy4aptn ncil(f rum(ront4aeenmoeiltlaDrlumon(0artoxrctytfpDrluvs;t) 2xmxr3oy1lltnlnei t  rrrxrp;t4oltomoetasla uau s;t)treomfciydfaDranei;s) rtm(m oy1olen nct tfsrrru  oo0altnifciat sDulums;(4texrio3tadlptranvo;t) 2tmirpny4lm nmfviat  ruaur ot4aex mf3tydla2el(msnt0 reoxrcto1lp rauei ()seuoio3oodamt  nvtltf 2umxrpou0aee  oeiadlm2rmu ont0 etoircio1fmD  nvols) rtrxr3oy4omtnmfvi (f 2tm(rp;t4tlxnif3iyd s2ul(ms ()trxriocoatfpD auvsls0trtoxm3oodam emnctltf 2ra(ro;u4olx iieilt s2ea(mp;() lxriocoo1fm elnvol( trurxm3oo4omt mivsltf rtr( p;o1tpe  ociydfs rl(vsnt0trtrmr3to1fpD lnvil(0 exrxr3nu1ap emictl(  2tr( pno1oexomoctldfa elnvs;u4 rxnir3iydoat aieol( truoxopny4lltnmici sfaruaxmpoo1apeniictysfs2rauvo;u)altnxo3ootlmtran o;(0 euoxo3oudamenmivslt)aDumurpou4oeen fctyt aDelnvo t4 ltoxo3ty1fpteaiesl()t2tmim3oo4aptelfesa(fsrrau pno4apeomociadlm rauvo;(0 lermo iy1lpt  u i ( texoxo ny1lptnmfvt ()a2umxm oo0opxn ociytfa2rmn snu)tetomo3tydlmD  ivslt0tetrxr3ou1om nlicils s2ra(mp;o1olxn ieiytfa2rm( o;t4 eeoxf iodfa e nvs s srtoxrpou4amt  ict (farua(m ot4alt  feilt m2eanms u)tleomrcto1omt anvi;s)t2trio iu4lmt  ici (  Dua(m ou1oltniieilsfs2uauvp;t4alxnif3oy1lpDe ieils0setrirpiu1lp   neia( s2taumpnt4tetnmf3iasfs2uanmonu0teenxo oytlmte u i;t) 2urxrpoy1lp  mfei tfarrmurpoo0aeeo o3tatlmDuan pn(0 etnif3iytfp rlnvil(0t2xoir iydap e nvi tfarum(  nu4alen ictltlm umums;(0texoxr3io1lmt luvo;s0setr(r ny4ope lnvi (f rur( ooo0open oetatfmDrm(ms t) ltoxo oo1om  lnvo;s0s2xmimpnu1ol n net s arrax poo0apxo fciaslm2uluvp;u) ltnif oatlmt ai o s) rxrxr3nu4omtemnetas)a2urumooo4tpen oetldla2emnvpnt4altrif3iatfpD lueslt  rxoxr no4ap elivta( aDtrxr nt4oexniiciydls2eanvsn() exnxf3tatfp   nvs;t  etoim iy4ale micta( s2umuro;u0aptniociyslsDrauvo;()treomr ootlpDrlu ols s2uoxm3ou4al elict s) rrmumo;t1aeen i3ildlsDulu snu0texnmo iatfm eaueo s) rxoxm3nu1ol elneils)s2ua(r no4tpt  o3tas aDrmums;t)tlxnmf3oatoate nvolt0 exrxr3io1lp  mivsas  2urx onu0tlenii3iad s2ea( on(0texrxr iatlmDe uvs;t truoirpnydopt miei ( aDua(m ;o1apenmiciatlaDrluvsnt4trenio3ootfaD ln o;( teuoxm ou4aptn nvs ()sDumurpot1ole  o3tltfm2rmu pnt)aeermfcoa1fmt lu slt) ruo(o3ny1ll nmfcsls sDurx  ot0teeoifeildfm2ran s u)trtnxr3oa1fptrai i ()trto(o3oydalee fvs sfartauronu4altnifctlt a2ean p;t0aeenmf tydlm   n ils teuoim iy4amenmnctls) 2rm(ro;t4aeenio3ilsfsDuauvo t) leomf3io1fm elivs;()t2xoxmpiodlm   ivs ( sDuax  ot1alxnmoeiys m umuvp (4tltoxrctodoa eai i;s) 2tm(o oodom e nci s) 2taurp;u1aetn fctytla2ulumo;t4 leoio3tydfpDe u il(0sexrxo iy1lm  lfvsa(f Duaxronu0aetomfeiaslm eln on()tetniocio1lm eaueols0t2uo(m3no4open fcs s)sDtrx pno0opt  i3tlt mDrm(vs;u4areoif to1fmteauvi;(0 etmirpiu4al  mfvsasfs2ra(mooo4apxnio3iytfs2umu p (4texoxociodfm eaivo t0trxoim3ou1al elictlt)a2ta(moot0tlt mieiatfs uauvsn()aeerifcoytopDeauei;t  rtoxm ny4am  mnesls)srrrx p;u4tlxn ocild mDuan p;(4 exnxoctotoa elueols)t2um(m no1apenmnvt t s2umump;u0alto i3tadls2rlumo u4tltoiocoa1omDr uvs t  2xrim3ny1amt  fcil() rrr(mpou1olenmfetyslmDra(mo;u0artoxr3iy1laDeauvi;t)sexm(r3iu1op n neil(fa2rrxrpoo4ape  ietaslaDrlnvp;t0areoiocoytlmDeau i;t s2uo(o oydape lfesa()sruaxmpou0olxniicilsfsDum(vp t) etrir todom eauvi;s s2urimpiy1aptnlicsas arrmxrpnu0olt iicildfmDrl(vo (4tlenxo3ootoat ai s;(0 rtmxm io1oltemnctls)a2tr(rpnt4oetomocilsla2uanvont0aetrmf oydfmD lu i ()t2uoim ny4om nlneslt  rur( pnt0aleoifetlslm elump;t0aetnxrcoadfateaivo t0srtm(opoo1lpee nes ()artr(m nu0aptomfetlsfm rm(mp;u) eerxo3oo1op rlu o t t2uoimpou4llen fvt sfs2tmurp;t4texn ociyt sDrm(ms;(4tlerxr3iodom rau i;t)teuo(r iu1ll n nvils  2urxrpot4alxo oetldfm2eluvp (0 renxoctatfa r ivsl( s2ur(o oydlpt lneilsf Dtaxrp;o1oex mietlsfsDul(ms;u0tetoioctadomD  ivolt teurim no1lpen ieslt)arrm(m ;u1alenifciat s uluvpn(0tltnmo3iotlpD  nes;s srur(m io1lmtnlfei ()srurxmpot0oexnmfctldfs uan onu0 rtrmo tatoa elieo;s0texr(opio1lptemfei tfartr(m no0oetomf3iydlmDuan o;t)aeenmoctytomteaues t0 euo(m iu1amenmncs ()s2tr(roou0tlx moeiltfs2rm(vs;t)aeeoircoa1omt  ies;t0 rurxrpnodalee ivi t)s2taxroot0tlxomfetadla2rl(ms;t0 reomocoa1oaDrln s;s0setmxm io4opt lfvsl(  2trxmonu4ape mieils s2emn s t0tlenif3oytlmD aies;s0s2xrir3no4lptelietas  2um( oot1oltoioeiltlm ean o;u4 eeomf3oydom rau i;( trtr(r oo1ap emfvta(f rrmu ono1olxnmfctldfa2ul( p u4aexomr tadlat ln o (0 2tr(r nudome lncias) 2rr(moou4oltniieilsfs emumsn(4teenxo3iytfmD li o;t trxmxr oy1omt mivia(farrru oot0oltn oetas m rmumo u4 etnifcoatfaD  uvi;()trurir3oo1op nmncia(fsDra( pot0olxomi3iadls rl(mo (0aetrmo ia1fat  uvo (0t2xm(mpno1ol elnvils  rtaur oo1altomfeilslm2ul(monu4tlxoir oatoaD aiei t) rxmxm3iy1lltelicsls)a2tm(mpnt0oltnif3iysfs el( onu4 exnifcoatoa  anvi s0t2xm(opoy4opt liet s srrrum nt1aleoiicildla2uln s;t)tltnircoatlmteluvol(0s2toir nu4llte fcsl() Drmx o;t1tle ioetyd a2rln s u)alxrxo todfaDraivs t t2urim no4ap elivsatfa2rax  oo4tpx ii3tytls2um( snt)trxrxfcoy1fate ies;s s2umimpiydllee fvi () rrr( poo1tlenmietldfs2rm( p;(0aetoxr3todlpD  n il( texoir3nu1ome mivi t s2trx ont4tpe  ieils aDumnvp u0 eenir3oytlmDeai o t  etoxopio4lpen icta( srur(rpot4tee mo3tad aDumnms u0trtomfciytla  lu slt)tetmir3iu1lp emfvtas srta(mpoo4oexomi3tysfsDua(mo;t0 rxnmfciadomD lneols srtrxm oy1amee icslt  Drau  ;u1olen o3ias a ra( s;t0aleoxfcio1lpDelies ( teurxm3iudllt mnvtas s2uaurp;t4oetnmf3tyd s2ean s t0aexrif3oadlaD  nvi s0 rxo(o ou4oltnlfetls  Drm(rooo1aexomfciltfsDuanvs u0aetrif3iy1lp eauvo s)sexmim3oo4lleelfeiasfaDrrxm ;t4tetnmfciys sDumuvs;(4trtoxrcta1lmtr i i;( s2tmir oodoltnlieilt sDumumpno1apenmfeilslm2ea(vsn(4aetrxociytfatelivs;s) 2xoxr3oo4olee fcsasfaDum(mont0tex  fciatfm2rl(mpn(0 eeomo3oatla eai i s  rum(rpnudamtemivsat)a2trxmpou4open f3tldfs rmn s;u)tlxrmrcto1omtrai i t)sexmxr3iu1am elnetls s2umur ou4apx  o3iat aDeln snu0teenmr iy1om raneo;s sexm(m ou1amen nvt s a2rmumpoo1olenio3iyt a2elnvs t4 ltomr todlmD aieo ()srur(m3oudllenmfvta(fa2tax p;o1tltomi3tlsls2raumon(4 etniocoy1lmDeanvo;t)s2xoirpiu1ole livs s sDrmurp;o4apxnio3ias s eau p;u) rxrmociotopteluesls)trxoxo3nu1ameemiesa( s2uaumoou1alxoiietlslm eln snt0arenxr oo1oat aivo ( sexmir3no1omenmiei s s2ta(mp;o4opxniocild aDean pnu4arxomr oa1fpDeaieils) etoimpnydlmtemict s)s2rmumoou0tlx ifeiltla2el(mo u)trtnxrctodoa e u s (0seto(r3oydlpenmicsas a2tmxmo;u0oexomieildlsDrmnvs t4tlxriocta1fmDeli o;s0teumxr3iu4oltelnvi s  rumumo;u0opxnif3tatfsDrln o;()aetnmrcoatfa e ueol( trtrim3io4lp n nvsl(  rtr(moou1tpt if3ilsfs ul(von(0aetoxocoadoa raiei s)s2xr(r nydameelfviasfa2tm(  ot1opx mo3ild a um( s;()alenir3todlaDrauvi;t) etm(opiudlmtnliviasf rumurp;u0oeeo i3iad s2ea( o;t4trxoifctatlp r u i;s tetoio3nodapte fvs t)srtm( ont0tpen f3iasfm umn p;u4artnif3tytlmtelivs t0 rto(opiudop nmfvsat sDraxmooo1tpxnmieiltfm um(vo (4 ltnxf oodla r uvslt)trxr(o3ou1olenlnciat) Duaur ;t4tlenmoetyt s2ra(vo;t4artnxo3ootoa   ieo;s t2xoir ny4lmeemicias a2tr(moot4tpt mf3ilt s eau o t4artoif3oy1fmDe u o;t0trtm(rpio1ol emneia(fa2rrurpno1oee  ieiasfs2rl(msnt) etrmo tytomDrli i;t) 2uoxr3nu4llt mnvtat)aDtmx  nu1teeo oeiydls umn on()tlxnxociy1lm  lnvslt t2tmim3io1ap  lfcs s sDumurp;t4tpxnmf3iyt mDeaumpnu0tlxrxrctotlmtelu i ()t2urio oo4lm nmnctas)sDta(rpno1aeeo i3iyt mDeluvo t) rtoxf tadoaD ai ils) 2xoir nydop e ieia(fs2tmxm oo0opt mo3iadls eau pnu4aexnio iydop eli s t t2um(m3nudam emfcsl()aDtaurp;o4alxoif3tyt s ranmp () rtnmr3ty1lp rln s;(0 2xrxm nu1amenmncsltf 2urxmpnu4olenmo3ilsfmDua( p;t0 rxnxo iotfp eauvo;()srxr(mpiy4ll  mfvsa(faDtaurono4oexn o3iadfs2ranmon(0treomfcio1oat  n i;(  2xo(r nudlme  ieias  rtm(mp;o0ale moeiad a2ua(mpn(4 ltnmo to1omte i i s)setmio3iy1amte iet s) 2ua( p;u4alenmo3iad mDea(von(0 exomr3tadom   n ol( tetm(m ou4aptn fci tf ruaum ou0alxn oeildfm2ulums;u)alxnmo iodfpt an s;t0t2umio nudlmeeliei sf Dtmuronu1tlen iciyd m ua(vs;t)tltoircio1fpD luvsl()t2toxm no1aleelfcsls sDumxm nu1tlenmi3ilsfaDua( s;u0treomf iydlmD anvs ( s2tmxopny4lm e nctl(  2trx ont1tpxn fcildlm ulump;t)aetriocoytlmtrluvs s0sexr(rpiy1lm emfesas)srtaum oo0opx mf3tas m eanvo;t4 ltrmo3iydfmDrau s;s srurxm iy4ll emfvtatf Dum(ro;u4opeoiiciysfs2rau p t4 exnmo iy1lpte uvs;s  euo(rpoodop  lneil() rrr(rpnu4tpx mfctlt aDelnmo u0trxoxf3oo1op r ieils0s2umxm oudalt  fvi s aDtaxmpou4teenmoetld m uln s u4aetrxr3ta1optr u i s0tetrxopny1lle lfvtls) rrmx pnt4tetnifcilt s2ra(ms t0alxrmfctodlpD anvs;(  2xrxmpio1amtnmfct tf rtaumo;u4apenifciat mDeaump;(4 rerxr3oydlmteluvs t s2ur(m iu4ap e nvsasfs2rr( o;t0opx  i3tadfa2umnvp u4alenmf3iotlpD lu i;t  rxrxr iodaptnlfvi s)a2rmur ;t0altn octydls2ra(vont4tlerir3ootlmD aues;s0sexrxo oo4llteliciatfsruax oou1teto o3tyslaDelump t4trxrmf tatomteaneslt) etmiopiodoptnlfvtl( s2trxrono1aexo oeiadlaDeanms (4 rermociotfat  uei t0truoxo3nydame  iesltf ruaumoou4tleoiietltfm2eanvp;(0arerxr3todfm r neslt  2xo(r io4llt mfvsat sDtmu ooo4tlt  ociys a2eluvpn()texoif to1la e nvslt trxr(rpno4lm emietls)srtr(  ;u1apto ociat m2uanvonu4 renxrciy1lmteaneilt0sexoxmpiy1am n iesas) 2uax oot0aptomietysfsDrl(mp t0texnmo oo1oaD li s;() rto(o iy1apenlivslsfarrrxr ot4opx  ietatfm uauvp t4 rtomr3oodfpteau o;()t2xmxmpno1ol  lfes s srtaum ;o0aet iociytls2emnvs;u4 leoxf3oatla rlueolt s2trim oo4lmtelict (  Draump;t1ope  iciatlm em(msnt)aetnmrctodoa elnvi;s0srxrxm3nu1apenlieta(  rur(rp;o4tetomieias s uauvo (4artnir3oadfm   nesls)trtm(o3iydlmeemivi (  Dur(mo;o0tlxomoctld sDelnvp;t0 ltrxo3iydfaDe u sls0srto(m3oy4llenlicsltfsDuaump;o4apeomocias m rmnms;(4 rtoir io1oa  aieslt0 2ur(m3oudlm emnctas)srta(r ;u1aeenmf3tltfa2umuvs;t4arxrxfciy1op elneolt)t2xoxopiydopenlicslt) rrmxroot0altnmfciysfs2rlump;u4 exrmfcoydfa  an i s s2to(r oy1omtnlics s)a2tr( o;u0alx mfciad m eanms;u0aetnxocoa1fpD luvo;t)tetoio3nu1optnmncslt)srurx oot0teeo oeiyt m2ran ont0 rxoio3ia1fptr ieo s)t2urxo iy1lpe  fcsas  Dtaxroot1tlxoio3iytlsDraump t0 lxnio3tytfm eluvs;s  etrio ou1llt lfvtasfsrtru p;u4oexnii3tydlsDum(vpnt) lerir tatomt ai i;(  rum(r3oo4ol  lnvils)arua(  no4olto fcildfmDemnmo;u4tlxoxrcoy1faDrlu o;(0s2tmxo3iodop elfct s) 2ra(roou4teeo o3tatfa2umnvs (0aexrxocoy1lpDeanvo;s0s2uoxr iy1amte fes sfsrua(rp;t1aptoiicilt m ra(monu4 ltoxociytoa rai ilt0 eto(o3nodomenliet t) Duaxrpnu0opt mieiat s2uauvp (0aexoircoa1lpDeau i s  2to(mpoydlm n iet (fsDtr( poo1apt  o3iysls ul(mon(4teeomr3io1oaDr ivo s s2xoxmpou4ol emfvs ( s2rr(ronu1olxomfctytlaDeanvpn()trxoif tytfaDeln i;t) 2xrxm3ny1om  mfctas s2urxmo;t4alen oetat m2raums;t)arerxo ia1lptr neilt trxrxr3no4ol nmivsat  rumu oou0aetnioeiasla2el(ms;t4aexoxo iy1om r uvi (  exmxo oy1op nlncs sfartr(m ;o1tpx  octatfa2ranvont0 leomf to1fa r neol(  exmxm3oy1ame mietltf rrru  nu1tlxo ociltla2um(mp;t0 eenxociodfm eaivs;() exrir oy1lpenmivil() rtmu  nt1tlxniieiytfaDelnms;(0 rtoxrcoydlp e nesl( sexo(r3no1lpenlivt t)artmu  ou1apx  fetldlsDua(vo t)artnirciy1fmD  nvo;t truoxm3iu4omt mies t sDtau ont0alx  oetaslmDrau snu0 etrxf oodfat  neil(  etmiopny1ameemfctl( srrr(rpou4ole mfetlt s emn o u) eerxrciodlp   i i;(0trxr(r3oy4aptnmfes s  2tr( pnu1aee mietas a um(vont4altrircoa1omtrlueilt0trxmim3oo4lleelivtas)aDuru pnu0aleo o3tlslsDrmnmonu4tlxrmfcia1fm  aiei s s2uoir3oudolte nci t) 2tm( pno0opeo octldlsDranvpnt)altrxfcoy1lmD  neilt)t2tm(opiudlpeemnesa() 2rrum ot4aetnmieiydlm2ulu o;()arxoxo iotfat  n i;t)s2xo(rpiy1lmee fvilt)aDra(  ;u1opxo ocils s2emuvo;(0 exomf totomDr i sl( s2xo(o3oy1lpe mnctat  ruru  ;o0ope ioetyt mDumums t)tlxrxfctodlmD  ueo;(0sruriopnudaltnlictat)arumump;o4oetnmoctyt m2ul( p;(4trxoxocoa1om rlnes;t0 2ur(rpio1lmtemnetlsfa2raurpou0aptnio3ilsfs ul( s ()tltnmoctytlaDrai slt srumxopiu4om e ivi t)sDtm(moot1tltomi3tldlmDrmu o;(4artnmrciytlpDr i o s0setmxr io1lle micsl()arrr(r ;u4opxoiieils mDel( pn(4 rxriociadla   uvsl( t2trxopoo1oleemfeslt)sDra(mo;o1oet mfctyd sDemn o u0tlerxf oy1fm r n s;s0srumio ny4llee ncs (fa2umumont0aleomo3tytlm em( p u0aeenxocto1faD  n o;t0t2umio3iu4ame  fvilt  2urum ou1oetomietys m ua(von() ltomr iodfmDrlu o;t teuriopiodomtn ncta(  2tmurp;u1tlx  o3tytlsDem(mo;t4artrio oydlpD  u s;(0srumxrpoo4ome  fcsas)srrm(m nu0oexn o3tltla uan onu4 renir iadfp ran i;(  rur(o iy1lm   nesat)srtmurp;o1apt mo3iyt mDrm(vsnu0alxomo3iy1opt auesls)trumirpnodalte ivsl()sDuaum ;o4apt  o3tys a2rl(mp t)trtoxo ia1lmDeaueo;t0trurirpoy4lptelies s sDurumpno4olt micilslsDul( p;u0 rtrxo3oadfpDeauvs s0t2xmio3oudam  liet () rtm(mpoo1ope ioctltls2uluvp (4 lxnmo3oadlp eanvols  rurxm oodop  mivsls)srraxrpnu1tpe  fetls sDumn snu0altnmr iytomtrlieol(0seuoxr3nydlmt  fvsat arrrxro;t0tleo feilsla2ea( o t4 ltrmo totla   uei;s)s2xoxr oy4lm emicils a2uaumpno1aeeoii3iadfa ea( onu0trxomr tadfpDr u s () rur(opoudalee nes (f Dtrxr nu1apenmf3iasfm2em( s t0aeenmociydlat au ols)trumxo3nodal n fesls arurxm nt1tet mieiasfa2uan pnu4tlerxf3oydlmtran olt  rxr(o iodll  lfesa( a2rrxmpou1alt iieiaslm2umumsn(0tltnif tatoate i ol(0setr(opiu4amtelfeta(farur( oou4aptn oeilsfs2elumo;t)alerif3oodla e u sls) rxo(r3ou4om elncta()aDtmuronu4tpxo fciltlm2umu s;(0 lxoir3oadfaDr uvi;t srurim iy4opeemnvias)aDra(rp;u1aleomi3iyd s ulnvs ()alxnmociytlptrai i;s  eumxopnodoleelfviat sDtaxr nu4altomfeildfs2em( snt)trxoxo3iy1fm ran olt t2tm(m iydopt mfei tfsrumumpnt0aexnioetydla2ranmsnt4 ltrircootlate n ol()srur(o3nu1oltemfvsatf 2rru poo1teeoiietadla2umnmp u4 etrmfctytlpt anes;()trurimpno1op   neil( s2rrxmp;u4aexnii3tytla2em(vp;t4 exnxo3io1lp rai i;t teumiopiy4lp elfesa()s2umx ont0texomieiadls ua(vp;u4artoxocoadlpt lu i s  rumirpno1omtnmfvs t) ruax  ou0olxomfeiasfs rlu onu4teenmocia1fm raies s0t2umir nydom  mfesa(fa2rr(  nt0ole mfeildfs2rm(mont4alxomr iadom e iei;s0 rum(m no4lm nlivs s)a2um(mpou0alx moctadfsDumnvon(0alerifcoydom rai il() 2umxr oo4open fvtltf 2rau  ou1tex  ociadfa2el( p (0artoirctatlpDelivs;t0 2xmimpoodolenmnes tfsrtrx  ;t1tleniietydfsDel(mp;t)arxoircio1lmtrliesl( trxm(m no1lmt liei (fa2ua(moot0aet mfciydls ul(mp;(0 etrio iytlpt  ues;s0tetmio3nodlmt mfeilt)aDrrumpnt1oex mo3tlt mDelnvs () lxnxrcio1fp eluvo s0sexmxm oy1apeelicils  2rr(  ;o1oexnmieiat s2umnms u0altnifciotop  lnvi;()setm(o nu1amenlfciasfartaurpou4oleo o3tadla uluvont)alerxf oo1omDrli i;s0trto(o iy4ome lnetls)aDtmu  nu1opt  oeildlmDuluvs;u0tetrmrcty1fpt anvo;() 2trim oy4lmtelneiat a2rmxmo;u4apen i3tlsfa uau sn(0teenmf ia1fa e ies (0tetr(r oo1ame  nvtasfsDurur oo0aexoioeilt m ranvont4trxrir iotlmDr i o;t)teuo(o oy4om elnci s s2tau p;t1altnioeiysfa um( pnu4tlxomfcia1faD lu s t texrio io4ome mnvias)srumur ou1tpeoifeias m2ranmsnt0tleoir totlpD  neils0tetr(o nu4amtemfcsl()sDuaxro;o0aeenmictltlm2rlnmp () exoxo ia1fp r i s;t s2xr(o oy1amenmieiat srtaxmp;o0tlt micias a2rlnvs (0trxrxfciytlaDeai o;s0srxoimpou4lmtelfvtlt s2rm(mono0oeto i3tlt sDrm( ont)aetnir totop r u sls0 exrir nudopeemfvsasfs2ur(r ;o0apeo ictat mDumnmp;u)tltriociytfaDeli ol() rtm(m io1openmietlt)arta(mpnu0texnmociytlsDel( p u)artoifcoadlp e iei;( tetmxo oy1lm  lncsls)arum(mo;o0alen octltls em(vp u4trxnmfcoadom  ai ol( tetrxo3oodope  fvsas s2uru ono4optn ictas sDel(vo;t4trtrxr3ia1op  au s;s tetrxo oydomt  ivsatfsDrax  ;t0oeto i3tlsfa emnms;u) lenmr iytfm e ivs s)s2uoir3nodaptn ictlsf rum(  ;u0aeeoif3ils a2rln o;(4texrxr oytfat  uei;s srtrimpiy1ole mnci (faDumuro;t4alxnioctydlm rlnvo u0tltrir3oodfpte uvilt0 2tmio nydlmeelncs t) rrrumpnt4opxnmocilt s2ul(vs;t0trermoctotlaD lnesl(0t2to(rpnudlltnlnvsa()s2ta(m ;t0aet ifetas sDuauvo;t)areoif3oodoa raieslt  etoim3iodol e ivilt sDrm(mooo1tet if3tysls2uanmo t0tltrxocoodomD ai sl( srxr(mpoodapenmnetat sDrm(m ou0tpeo ieiatfs ua( o;t)artomf oy1fmtraivo;()setmxo3nu1altelics s)srtmxronu4tle mi3tyslm2um(mon(4trtnif tytoatr ies;s srtmxmpiudlme  nvt (fsrrmx  no1olxnmo3iytla2ul( pn(4trerxo oy1lpDelivolt s2triopiu1op  mfvsa(fa2ur(rono1alxniieiyt a2uanmo;t4altnxfcty1latelueilt)setr(mpnodam   neia()a2tr( ooo4oleniietyt sDrmumo;t)texnxo3oy1op   ies (  etr(m3nodole micsasfs2rax  ;u0tpxo ieiytfa2rm(mp u)aeerir tydfpD auvo t t2um(o oudolen nvias  rrrxmoot0oexoiocilsls2ul( on() rtoxfcoadopt  i i;t0 eur(r io4lm  mfvslsfs2rax p;t0apeomfciltfs rm(mo (0artrxrciy1opt  u i;(  etoirpoo4ll elfvt ( a2rmxroot0apeomiciad mDumnmon(0altnxocoadfm   nei;s texrxm3oy1al  liei t)sDraxrp;u1oetomieiaslsDuanvs;()tetomf todla  auei;t  rxm(r3no1ll  livs t)a2rau  ;u1tpto feiad a rln s;u0 reomf tydfm eli sl(  2to(m3oo1lp  mfei tfsDrr(rono0oetn fciyd sDra(vp;t4trtrxfciodopDrauvsl(  rtmio3no4apenlfvta(f rtmumoou0olxoii3ils m eanmp;(4 lenxrciy1omtraueo;( texo(r iy1lleemfcsltf 2rrx ono4apt if3taslm rm( sn(4 leoif3ia1fate i i s  2ur(m3io4altemicsat)s2trurp;o0teenmfctltfm2uau p u4 eenmf iydfa   u ilt0 exr(m3io4altnlfvs t)arrmxmono0oltomf3iysfmDrl(vsn(4trtomo iydlmteaieo;s) 2umxm oy1op emict tfaDrr( pnt4olxnio3iydfm eln p u)tltrmf ia1opteli ils0srxrxmpiy4lme miei ()arurumono4opx ioeiltlmDeanmp;() rxnxf3oydfmD  uvs t0srxrxo io1ale  ivt s aDtmum ot1altomieild aDeau s u4tlxnxf3oytom  auvslt0 exo(r3ny4am elfvil() rur(ro;t4altn ociytfmDeau o;u)aexrmr iadlaDrli s;(0 rto(r3nodomt lneils)arum(rooo4tpx  ieiasfa2uanvo;t0arxnxr iodfatraueols0 etmio3io1op  lfvtat)sDrmu  ou4tpe  oeias m ea( p;(4 rtrif3oo1fmtranvo ( seuo(m nodol elnvils srtax o;t0aptniiciasfsDra(mp t4tlerxfctadfatelueo s0srurxo3nydam elnesl(  2uaxmo;u0olenioetyt mDean pnt) etomoctadfmD anvi ( trto(r oy4llt  nvtl( srumxro;t4tetn o3iaslmDra(vo;u)tltnio iatopD au s;(0texoxo3nodlp  lfesltfaDrmxm nt0olto i3iadlsDeaumpn(0 etrifciy1lat  n i;(0teum(opnodlm emietl()artmu ooo1alx ifctls m2umn o;(0trermo tydlptrauvi ()s2xrxrpnudalt lnvtasf rrr(rpnt4alx  iciyd mDranms u0artnio3oadfmte ivs;s)texmxo3oo1amtelnet tfaDraxmooo4aexnioetyt s ul(mpnt) exnxo3iy1oaD  n s t0srxrxo3ny4ale lici (fsrumumpou1aptnmictadfsDrauvpnu) lxrio3ta1laDr ivo t)texr(r nydol  mfesa( aDraxmoot4tlxomfeilsfmDumuvs;(4 lxomo3oodomDr i ols t2tmio nu4aptn ici ()s2um( oou1aexo f3iaslaDrmuvp;u0trtomociydfpDrlneilt t2toim nu4ape lneil()sDtau ono4tpe mi3iltfs ra( s;t)altnxo tydoptr ieilt0 2toio3ou4ll n feils)arrrxm ;o4oltomi3tadfm2el(vpn()altrxf iydfpte n s;t  2trxm3oydlpt  nvsl()s2ua(rpou4opeomi3tatfa eln snu4teenmo tadfpD an i;t0tetoirpoy4optnmivs s) rta(  ;o0oexnifciyslm2elnvo t4 rxomrcto1lpDeaivo t)trumxo3oo1ol nmfetat  rtr(mpou1aexomieildlsDrluvo;u0arxrmo oydomtranesl( t2tm(r nodaptnmfciatfsruru  ou4tpt mfctlslaDeanvs;t4tlxoxo oydlpt lu s ( t2um(o ny4lp  mfvsatf rrmu  ou1apen ociad mDelnvo t4artrif3to1fat lies;t0setrxm3no4omtn neil()aDtmxrp;o0tpx  octldls rl(ms (4teeoxocoytoa  aiei;() rtm(o3iy4llte ict s artmu  nt0alxnmietysla rl(vo (0tltnmr3iodfaD au s;() etmir3iy1lltelivils)sDur(r nu0tee mo3iaslmDrlu pnt4arxnmf3io1fpte iei;t)srxmir3io4open fvtat) 2tr(mp;o4olt ii3iasfsDrmnmo (0aeerio3iatfmDe n i () 2trxrpoo1op e nvsat) rum(  no4altnmieiadfmDeln snt0arenxrciadoateluvs;() exrxmpny4omeelnesltf 2ua( poo4tlto fciytfm2rl(vs;() rxoxf3iotlpD luesl()t2trio oydop elnct ( a2rauront1alxomieilsfs ea(mon(4tltnxo3oa1oatrau i (0 2umim nudlpe livt sfsDurxm nt4tlt mieildfs2uau p (0 leomfcio1omDe uesls s2ur(m3oy4alt mnvt ( aDuaxm ;o4tltniietltla rm( o;u4 eenxf iadlpD  uvo;( teuoio3ou4omte nvtltfa2uaumpou0texnmf3ild a2ulnvsnt4trerxf to1lm r uvslt)s2umxm3iy1optnlies s)aDrm( pot1opxn ocild a uau p;(4aetnirciotlm  lies (0 etm(m iydlp e ictlsfsDuaum ;o0tlt  f3iys s um(vs u4aeeomo tytfatr uvil( setrxm iudlp   fvi s)sDtm(r nu0tee mi3taslm2uluvp (4alerxo to1late n ol(0 rtmxo3ou1op nmfcilt)srua( oot4oet  i3tyd a rmnmp () rerxrciotomtelues;()setmio io4ol   fcs (fsrtmxr ot0ale micilsla um(mo;(4arenir iodlmD  u il(0s2tr(o no4al  mietasf Dum( ono4aptnio3iysfmDem( p;u)altnir ia1fm r ueo;s)trxoim oo4opt lfeils a2tm(r ;o0texomfeilt a2uanms (4tlxnif3oatfaDrlnvilt0 2urxr3ou4op nlicsl(fs2rm(rono4optoifcildfm rmnms;t0tltrmr tatlp rau s;t srurir3io4omeemfesl(fartaumo;u0aetoio3iydfs eluvs;t4 rxnifctatoaD an o;t  2xoxo iy4llenmfei ()arraump;t1olxnmoctadlm ua(vs;()tlxomr3oydlp rli i t s2urxo3ny1ol nlieilsfarra(m oo4aetomictys aDumumsnt0 reoxr oa1fp   ieols  rxr(m3iudal   feils) Drr(mont0apxo o3ilsfs ea(mp;t)tetnir3oytlp e ueol(0srxmxr3oo4opt mfvsa(fa2trxrpou1aetomiciasfm elu p;u0alenxr oo1op r ies s0seuoxmpou4ap e fesas) Dumumo;u1opto ieiytfa2el(vpnu4artrmfcto1fpteli o;s)trxrxm3io1omtemfci ()arrrurp;t1tpeomo3iyslmDuaumsnt)arxoifctytlat  nvols0 ruoim oudam emfcs s srtrur no1apx  o3iatlmDra(vpnu0 rxriociatom  auvo;s)seum(m io4oltnlfct sfsrtmu pnt4olx mi3ilt a ea(ms;t) lerircoy1omtean ol( s2tr(rpio1al  lnctas)artmump;u0aet  iciyd m2raumo;t4aexoio oodfmDr iei s)t2uo(o3iudlmee icsat srurxm no1tpx iociyd aDrlnmpnu0alenxo ia1oa raivils trurxrpnydolenlnetatf Dum(root1oeen ieils m rm( o;(4aexnir iy1fa e i sls  2xm(m oydlp nlnct t)arumxmpou4aptniietld m2rm(msnt0tlerxrciy1lmtr uesls0trxm(m3oy4om nlnciltfsrtmxmooo4ape  ieiydfsDuau o;(4tltoxf oydlatrlnvo;()t2tmxmpno1am  mfetl(fsrtrxront1ole  ieildfmDrmu pnu0 rxrir ta1fmtelneslt0 2tm(o iydoltelivtasfsDraurpot0teeo ociytls2rm( s ()aeermrctotop  luvo;t) 2tmio3iydam nliei s sDtrumoou4olenmfeilsfa2ranmo (4 ltrir3ootom  livi t)t2uoxopoo1amtnlfes s arrmur ;t0olto feiyslm2rlnvonu4 rermf3iotla e i i;t0 eumxmpio4lpt mivta(fsDua(monu4tptn i3tyd m2uauvp t0tltrircootfm rlnei;(  rxmxopio4ol  lfctls)sDrrurpoo1apen f3iytfaDuau p;u0aeerxr3tatlm   nei s trurxmpoo4llte fet s sDraxmp;u1opto o3iys sDulnmpnu) rxrmrctadlaD aiesls t2tmxm3oydllenlfcs s aDtr(m ;t0ape mf3iltla eanvo (4teeoxocoydlm ranvs;()s2umirpio1olen fetl(  Dua(  no0apeoioetadlmDrmuvs ()trtrir3ootfmt  neo t0srxmxo3oo1lpeemfviltf 2rr(mont4teeniicilt aDuln o t0 rtoio3oo1lmD aivs;s0 rtm(m nydolte nvtlt)s2tr(mo;u1tetnmfeiys s rmnmont)treoif iy1fmDrln i;(  2urio3oy4opeelneias)a2urx p;u0tptniietlsls2umnmo;u4 etnif3ty1optrln i;s  2
\ No newline at end of file
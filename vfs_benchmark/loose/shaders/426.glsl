@@ -0,0 +1 @@
+uei s0trtrxopiodll e feta(  Dururonu0oexo fetys sDulums;u)artnif iadfpt anes;t0s2trxr3nu1lmeeliesltf 2uaumoou1tpeoifciysfa uln o;(4tetoxr3tatfmt  ieilt)s2xmxmpnydoleelfvt t srtm(m ;u0apen f3ias a2ul( o;t4artnxfctadfaDelivi s)tetrim3oo4al n ncias)aruaxrpno1alx  fciyt m2ra(ms t4 ltomf3ty1fat liesls trtrim3oy4lmtnmfctltfsrrmu pnt1olxo oeiys s2rmn s;u4arxrmf ta1oa   nei;s)srtoim ny4op emnvslt) Dtax  ;o4tetoif3iytla ean s;(0 leoifctodlaDrau slt)s2xo(opnodlpt mfetasf rraurpnt0ape  ociytlaDemu p u0 ltomr iatfmDeln s s  2uo(o nudlme  netls)srrmu  ;o4apxnmociyd mDrm(ms u4 reomf oadfaDrau sl(0tetrio iy1amtemiviltf 2tm(r nt1teen i3taslm emu o t0 etrmrctotfm   neils  rxr(mpiy1lp nlfvsat srrrxrpnu4tpx  octatlm2umn o t0 ltomocootlmt lnes s trtr(o nydll nlncta()s2uau onu1aetn i3tatfa em( o u4treoio3oo1lpDrlnvi;t) rurir3ny4lme  feilt arrmur no0ape  octld s um(vs;() exoxr3oodlpDrlu i;s)s2tmio3ny4altn fcslt)s2uaxr oo4oexomoeiytfa el(vo;t) lerirctadomDelu o;t0 2uoxr3ou1lm n nct s)a2tru poo4oex ifcils m raumo t4 eermo oo1opDe ies;t)srur(r3ou1olenliesatfaDrrumooo1tex  o3iyd s2rmnvs u)tetoxrciy1faDelieil(0tetmimpnodal  lieias)sDtmxm nt1apto fciys a ranmp;(0tlxnif ta1fp   ivi s)sexrxm3nudopenmicilt) Dtmu pno0opto iciyd s2uaump;t) rerir3iy1opDraiei;t) rumir3no1olt  feta(fsDra(ro;u0aeen i3iltfa2ulnmsnu0tlxnmr tatfm  auesls0 eto(r3ny4ol nmiei sf rrrxmoou4opxo f3ils s ra(mo;t4trxriocoodoaDr u o;t0t2ur(r nydam  lfcs sfaDurxrp;o0tex  f3ils mDeau o;u0 ltnxr iotfp   nvol(0srur(m3oo4ope mneslt)artrxm ot1olxnmfeiadla uauvp (4 ltoxr oatlmt anvi t  2xrim oy1optnmfcsat) rrrur ;t0alxn iciad sDelu snt)tltoif3iotoaDrlnvsls s2um(rpio4llenmfcs t a2ur(m ;t1aeenmi3ildfa2elnmp;u4 rxoxr3to1oaDr ies (0trxmxm3io1olte nvi ( srtr(mo;u4olx ifetyd s uau snt0altomr3oytfmDrauvslt0t2xrxmpno4op emfetl(faDumu pou0aetomoctlslm emumo;t) etnifcoa1lmtrau sls t2trir3iudllee fci s s2trx p;t4oeeomfeiytls2elu p;u)alxnio3oytla r u i;( texmxm3iodapt  nei ()sDra(m ot1tptniiciasfs ulumo (4aleoxf3iadop  ln o (0trtrir nydapeelictasf Dumur ;o1olt mo3iatla2rmnvo u)aexomo3tadopD  uei;(0t2uoxmpnu1lm  lieta(  2um(mooo0olx ifctlsla elnvp;()artnir3ta1faD  ieo;s0 rxmxm nu1opeemfcta(fa2tmumpot4oexn oetyt sDrau pnu0arxoir iodoatrlueil(  rtmxopoudapt lfcslt a2rax pnt0tpt  f3iys aDea( o;()alxomo iydomt an ils) rumxo3iu1lmt lietltfa2uaxr ;o4oltomoeiadlm2elu snt0altrxo3to1opDelnes s) rtoxo oo4lp  lfei s s2umumono1tlenioctls s um( sn(0artnxr3ia1fmDeln ils)seuo(o iydap elfviasfarrau pnt0olxn fciys sDulnvon()trxoio iydfa  luvi t srurxopoy4ap nlncsatf rraxrpou4tetnmo3iltlm uanvpn(0 eerif iytopt luvo;s0srxm(m3iy4amtnmfvtas)aDrmu  ot4olt if3tat sDulnms (4tltrioctadop  auvil()t2urxm3iu4lpenlnvias) Dur(monu0oee ifctldfs um( p u)texnmo todlmt an ilt texm(m3nu1ame lfvslt) 2umxrpno0ope  ociat m rl(vp;() rermrcio1la  au slt)t2ur(m3io1ape  fvsasfa2trxmp;u4opeomo3tytfmDumn p u4arxnmr io1lpteanes t)sruoxmpiy4om  lfeta(fa2ur(r ;u4optoifetlt a2eanmpnt0aetnmr3iotoa eaneol()trxmir3ny1lm nmfeilt a2tr( o;u1tlxo icilt a ul(vo;t) rtrmo3iadomD anvilt0s2tr(rpoy4lptn fcil( sDra( ont1aeeomfeiyd aDran p;t) etnmo3iydomtraneo t) 2um(opoy4lltemfei t)a2tmu p;u1aee  o3tyd m ua(mo;(4arxrifcoodfp e nes ()seurirpnu1oltnlfet ()srurump;t0opxoifcilt mDuau onu0 exrmocoydfatelues;s trurxmpoo4ll  lfciatfs2rr(ro;t0tpt if3iysls2uau s;u0 exrxfcoa1omD aivs;()srxmxm oudol n icias) 2umumpno1tle mociydfs ra( s t4teenxo ootfm e u i (  etmiopno4omenlici tfsDumumpou4alx ifetytlsDuau p ()tlxomfcoatomtr neo;s0s2xoir3oodal nlncils  Dur(mpou0aee iieilsfm2rm(vsnu4 leoif3todlmDeauei;s0 rxr(mpou4lp nlnci t a2rrx oot0altniicilslmDelu s;u0aexoir oadlpte ivo t0tetm(m3ny1lpe  ivsltfaDtaxmp;o1olxomi3tyt mDrl(vs;t)tetnxr iotlp rlueslt tetoxrpiu1amtemicsa(fs2rru  ou1tlxomictad a2rmu o;(4 exoxo3to1omD  ueo;()s2toxr3nudale  fvtls s2urumooo0altnif3taslsDra( s;(0 rxnxf to1fmtr uei;(0texriopoo4llenmfetat  Dta(mo;u0tle if3iaslm2rmumsn()tltomr totopD  nvil()t2xoxm3no1ape mfvilt  rumu p;o0oetnii3iydfa el(vpnu0tlxomociatfm  lues;s)t2urimpoudalen fcta(f rtm(  nu0oeeoioeiyd s2rau o;u)alenifcoodom   ies t t2toxopiudaptelfcil( srtaxr oo4optn f3tlsls2rln s;t4trenmr3totfpt auei (0t2tmxm iudlpenlfct (fa2urxroou1teto oeiat s ra( p;u4 rtrmf3iodoa e neolt setm(o3oy1lm n nvt s)srtr(r nu4apt mfeilsla elnvsnt0 etrio3oatomDeluvo;()srxo(o nydapt  ivt t)arrau oou0opx iietyt m eanmo;t4arxrir3todla rauvo t0srtr(m3nu4ol nlnesls s2tr(rpnu4aeeoifcilsls2emnvsnt4tlxrxrcoatfpt lueo;s0teumirpoydamt mnvi tf Drmurpnt1tpeo feiadfa2ul(mo u4 etrxfctadfaDrlivi;s)sexmiopiy1olenlnciasf rrax ont0tpe mfeild mDulumo ()arerxr io1oaDeln ols) rurirpno4omen feilsfsDrmu pnt0tee  i3tltla2ra( pnt4aeerir3oy1oatranes s0truoxm nu4ol nmfvtl(  Drruroot1aexoiocias mDua(ms;()texomo iatopD luvils) exm(mpoodomenmncia(fs2ua( pou4aptomo3iys s rmn pn(0tetoircta1om eauei t  rur(o3iodam nlfeiat aruaxmp;o0ape  ietls sDumnvont4 renio3tydlateanvs;t trto(o3iu1lmee fvtlsf Durumo;t1oee mi3iydls rauvp u) rtomfcootfptrluei;(  rtrir3no4oltn ivilsfa2ra(monu4oexn o3tatfm emu s;u4 rtoxf3oatom eaivolt trur(r3ou1op emfesas s2tr(r nu1alenmf3iatlaDumnmsnu)tlxnio3iy1lp e uvi t0texrxopoo1lltnmiet t)aDtrxr ;u4tpxnmiciat a rmumo t4artnir3oy1fmtrlueo t) rxrio3iy4al e ivia()s2umum ot4tpxn i3iyt sDemnvp u4 eermo iodom   i sl() 2urxm oo1lptn fci t srtaur nu1optnifeild s emu p (0 rxoxr3oadlmt  i s;s) 2xmim nu4aptemfviat)aDuauro;u4ole  ieiydfm2emums t)tltomr3iadfpDrauvols)seto(r3io4omeemfes s)s2ur(mpnu1aptnii3iad m rlu p u0aetoxr3to1fpDrai s;s)s2xoxm iu1ol n ictlsfs2ur(mpot0olxn ictyslsDran o ()aetnio io1fpDelneo s  etoio nydape  ivtlt arua( o;u1tptomoeiadfsDran s;u)tlxrmrcoa1laD  uvs;( setrimpiodapt mnes ( aDrrx  oo0tpeoifetas a rm(vsn()arenio3iadfm raneil(0srxmxmpoo4lmtemfvi s)artrur nt4apxoif3iadla2ra(mo u)aeeoir oadla r ivs;s0sexo(rpiudlm  lnei s) rtrumo;u1tee mociat a rlu snu0arxnxr3oy1faD  n i;s0tetmimpio1omeelncsasfsrtr( p;u4tptomictls s2rmnvo u0 eeoxfcoytoat an o;t) 2ur(mpoudaltnlnvs s) rrm(moot0tetnioctatlm um(msnu4 eenmoctatopDrliei t texrim3oy4ope mfciat)sDrmx o;u4ole mf3iatls2ra(mont4artnxr3io1fmt aieo () eurxr oy4oltn fcias srtm(  ot0tltomoctlt m el(mp;t0tltnxo3tadomtrlivilt texrim nu4apt mfctatfsrtr(  no1tleoifetas m raumo;u0 eenifctadfa r nvi t texmxm oudlptemictls a2rru o;t0aexomi3tltfs2rlnvo;u)trxnxo3to1op  aneo;t)sexmir oydllee fci t) rrr(root4apt  iciltfm ranmpnu)trtrxr3tytomte n i;(0 2xmxo3io4ol nlncslsfsruaxro;u4tex ifeild m ea(mon()trerirciy1opte nvi;()s2uoim oo1amtn ivsl() 2rrx oot1tlxn i3tad sDumuvo;(4teerio iotla rli i;t teuoiopio1ap  livsa( s2ra(  ;u0tlt io3iydfa eau snt4trxomoctatlptrlu i;t teumxr3ou4om nmfvtas aDtrumono0tlen ieilsla eaumo;u4arenmf iy1fmDeanvslt)s2uo(m3iu1aptnmnesa() Dtrxroou1oleniieiad aDra(vs ()arenxo3oy1fa  aieo;( sexr(opoo4am n nes ( artmx oou0ope  ietydfmDuanms (0alxomociy1lat au ol( setoxm3ny1opee fvtat  rurumo;o0olxn f3tyslmDrmn s ()tetnxocoodfm r uvo t sexm(rpoy4lmtnlfvil(faDrmx oou4olen f3tytlsDuaumo;u)aeeoxr3iy1fpDraues ( s2xoxr3iu4am n fct sf 2trur ;o1oee  f3tlsls emnvs t) reomo3tadlmDeaies;( t2uoxo3nydamt  nes (f rtr( pou4ape io3iysfs2rlumsnu4 exrxrctotlp  ln i;()srxmxo3no4lpee neia(fa2um(  nu4tlx  oetatfm rmnmp;t)teermfcia1omD  n ols)trtm(rpiu1lmtn icsls)aDtauro;t1apx iietytfa el( o;()aexnio tydfa ean ol( s2ur(r iy4aptn iet ()srraurpno1tpx mocias m2umuvp;(0 eerxfciytfmt au s;t) 2xmxm3ny4lmt mies t s2trxmoou0tetn ociasfs2elnmsn() ltnir3oodfpDraiesl() rtrxr no4ole  neia( a2rrx pot0aetomfciydlm2em(mpn(4 rxrmocty1lpDranesl() 2tmio oodll  livils) Durx onu4aee miciytlm2eau o;()aetoxfcootopD aues s0 2urim iydolenlfei ()a2ta(  nt4tpe  oeiys m ea(vonu)artoxo iadfpD  uvs;s0 rxmim3nudlpt lietasf Dtr(ro;u0tpe  f3iatfa ul( o t0 exrif ia1fpDrli i (0trto(m3iudlm elnvils srrrx  oo4oexn o3tatfm2rluvo t)arenir3oa1omt aiei;t  2uoxr oy4omenlnesas  2um( ont1tlxn i3iyd mDuanmp;t)aexniociytlptrau ils  rurxm3oodlp n neias) rrr(rp;t0aexoif3iyt a emuvo u0aetnir3ta1fpt luvi t0texm(o no1apenmfctlt) 2rmump;t4tee  ocilslaDem( s (4 etrxocoydlmD anei s)s2uoxrpoo4omtnlict sf 2rr(  no4tleoifeildfa2umuvo t) etnmrctydomDrluvo;(0srtmxopio1lm e netas srtmxmpou0aetn ieilslmDul( o u0trerxrciotlpD lnvs ( trur(r3no1lpe lictat)sDurxro;t1tpe mfciatls2um( pnu) eenir oytom eaieo;s  rurio3iodamtelfesl()a2rrxm ou4olx miciat sDranvo (0 rtrxo iatfm e ieo;s0t2xoxo3nu1ap nlfvtls sDtaurono4tpe  oeilsla2eln o;t4areriocoa1late ivsls)t2umir no4amt mncta() Drm(rpou4opeo f3iytfs emnvs;t4areoxf ootoa raieo;t  eumirpou1opt  neslt) Dua(mp;t0texoiietls aDeaumsn()aeeoxo3to1fptelu s s0t2uoim oodomt lfct s srurxm ;o1tpto ictatla umuvp;u4 eerxocoadlpDeliei t seumir iu4apen nvilt)sDta( o;t1ole  f3tatfaDeanmo t)areoir oydfaDr i il(0srxm(m nudllen iei (faDtaur nu1tltomf3ias sDel(mp t) eerif iydopDrluvs;t0srurxr3iydamte ncs t aDrrumpot1aleo ieiatfa2elnmp (0teeoir tadfp  li s;s0t2xoxr oy1lpte ieiat sDtrxr no4apx  fetlt s2raumo;(0altriocto1lpte nvi;t  rumirpiodamtnlictas) Drmxr nt4tetnii3iytfaDemumo;t4aexnio3oadopDrln ol(0 2tr(mpiodlp nmivtls) Dtaum nu4olx mf3tydfmDuan snt0arxrxocoo1faDran s t0 exmxrpio1op nmfcsat) Drru oot1olxn ictyd s ul(von(0artnmocootlmDeaivs;t) 2trxr iydol nlfvsls s2ururo;o4aet mf3tytla2ulu o t4tetrifciotla e uesls  etoir3io4ale mfcs s)arumxmpnu0alxoii3iadla2ul( pnu)trxnmf3tydlmDe i s;t  rurxo nu1omt mivia(  Drau  ;u0alx  octad mDrm( pnt4tetoir iy1lm eauvi;(0 2xoxrpoo1olenlnvtas aDraurpoo4aeeniieiltfmDrlnmo u)texnif oa1faDrlueilt0 etr(r3nudal   fcsasfsrra(mp;o4ape moeiys a ul(mpn(4altnifcoydfmDran i s) euoio iu4lm nmfeta(  Drmum nu0alxo ieilt m uanmo u4tlxrif3totfmDeauvs;t trumxm3ou1om emnetl( srurx  nt0altnmfciydfa um(von(4alenxfciy1op r ies;( trxoim no4lpt lfcils) 2raum nt0oexoiieiys s ranmon(0aeeoioctytlate ies;s0s2xrxm3ou4lm nlfei s)s2tmu  nt1tltnmi3iad m eau p u0 rtomrcto1fmtr ueo (  euoxmpoudome mnvsa()a2tmxm oo0aex if3iatfmDuanmont)artnxo tadfatelu i t0setmxopnodome lfetasfsrra( pot0tpe moctatfa2ul(ms u0arxoxocoy1oat aieo s0teuoiopio4lm n icias a2umx pnu4alenii3ias s el( s;t4 ltnxocoadlp elu slt0seuoxm no4lm n ictasf rta(  ou1oleoii3iadfa rlumo;t0trtoio oadlat li i s0s2urxm3iodamte netlt)aDtau  ;t4alt  o3tldlsDrauvo t0alerir3tytlpD  ies (  2xoxm3io4lmenlfvtas sDtr( p;t4aptnmfctlt a2ul( p;t)alxnmrciadfmt luvo;()setoio3ou4lm emnvi s) Dururo;t4texniictltlm rluvonu4 ltrxo3oodlpDrlneol() eurxo iy1ap   fvil(  Dumum ;o4ole ioeiadla eaumo (4 ltrioctydoat aueo;s  eto(mpoo1lmt mictat  rta( onu4tlx iociydlm2rmuvs;()tlxoircoydopDr nvslt) rxo(o iy1omen fct t arrm(mpoo1aeto o3ild aDuanmp;() eeriociodfat aiesls0tetoir nydapt lfci (f Drmu pnt1tleo fetltfmDrm( o u0 ltnir3ty1fmteluvi t0s2xoxm oo1apee ivil( aDtr(moot4ale moeils s rm(vp u0 ltnifcia1om e uvolt0sexoxr3oo1omte ivtl()a2umurooo1alxn f3tydfa emn p;u0trtnir3iodfm  ai ols  2tm(rpiy4ameelivsasfs2rrx  ;o1apeoiictydlaDumnvp t0tlxrxf iodfm elivols t2xoim io1altnmnct (fartmurpnt0alxo oeiydfsDrm(vp t4 lxoxo tatfaD lnesls)srurxopno1am e nci () rrrx  ou0oleoio3iatfa rl(vs u4aetrxo tadlpteanvo;() 2urxo3oo4ameemictatfaDtaxrooo1opeoifeiltfa2el( p u4alxomfcoydla   nvi s0truoiopiy1omt mncsl() ruaumono4olenmoeiydla ua(mpnu0tlenif3iotomtraneo () eumir ou1amtemnci ( aDuru poo0aexoif3iyt a rmu p u0tltrmo3oatlpteaneo;t trtmxm3nu1lm  mnvtlsf 2um(  oo1olx ii3ias a2um(vpnt4tetoxf totoa  anvol(0s2um(rpoodoptn feiat  Duaxmono1opeo f3tls m emn ont)areomf oo1om rluvs s  2xoio no4lm  micslt)s2taxr nu0ope ii3ilsfaDuauvont0tltomr3tatfp  aivi;( trur(r nodopenlieslsfa2ur(  ;o4tee  fetatfm emnmo;u0arermo3iadlp eln s t0trtmxm oydllenmfvi (fsrtrx  ;u0opxomocildfm ea(mp t0 rtnifcoadfat luei;t0 eur(o oydalt mies t) Dum(  ;u1oltnmociasls uan p u) ltomrciodoa e neolt)trxr(rpoy4ome mfvt tfsrtmumoot0tltnmoeiys s2ra( s u4aleoifciy1faDr ueilt) 2tmim3nydapeelnes ()s2rax  ;o1oltomo3iad s2elumsnt0 etoxo3oy1fp eaivs ( t2xm(r3nodolte ics t)arumu onu0olt ioeiad m ean p;t)areniocoytlmtrlueils teuoxopiydome mneslsf rrruront4ape  o3iadfm2eanvont0trtnxr iadfmD li s s0tetrxrpoy1lmtnlfvtas  Duauronu0teeoiictytlmDul( on(4 rxnircto1la eluvs;t  etmir3nu1op e iesls) rurxrp;t4aleo oetldlm2ul( p t)arermfctodla r ies;()trtoxmpnodaltnlieil( s2taxr oo0tlxn f3ilt mDrmnvp t)altrxr tadlatrauesl( s2uoxm3nodalt  feils s2urumo;u1alx  fetatfmDul(ms;t0alerxr3oatomtr n i t0sexmxmpny1om  lfciat)aDta(mp;t0alenmociydlm ea( o t0teenxocia1faD aneo;t) rtoxo io1alte nes () Drrxr oo4oet  fciltfmDrlnmo t4texomf ia1om rlieo;(0trxmxm oodol nmfcilsfaDtm(mpot4texn ietad mDea( snu4aexoxr tytomDrln o t0 ruo(rpny4alte ivs (f 2tax  nt1tlxnmf3iltls uanmpnu)arxnioctydlptelieilt0t2trxmpny4omen fesatf Drm(mpoo0tleo ociyd mDra(mo;t)texnxo iydfat  i il(0 exoim3nu4optnlfvs tf Drr(  oo0oleomieiasls2ul( sn(0tlxrmo3iydoat luvolt0 rxmxm3nu4lltemici s sDtr(mp;o0apeo o3iadls ra(mo t0aetrir tadfm raivi;t texmxr nu1om nmfvsat)srtaxmo;o1tpeo oetyt mDrl(mp;(0 lenmo iytfm e nvi;s0srurxo io4aleelneiltfs2rrxm nt1apenioeildfm rmu pn(4artnxfcoadoaDelneo;t)s2xr(m3ny4ap   fvsa( srtmxmont1opxoif3ilt m eauvo t)aetomfctodoaDelueo s0trxm(mpno4ol e fvs s  rtrxrpoo1olxnifeiydla ean p;u0trtoir iotopDraieo;t0seumxo io1lmeeliviat)s2ua(mpnu1teeomi3iltlm eluvsn(4 ltoxocoodomtr neilt)seur(m no4ale  ics t sDtr(mo;u0tetomieildla2elnvo;() rxniociotoate uei;t trtmim3ou4amtelfcs t)srrrxrooo4opeomo3iys m ea( onu0trxnmf3tatfmtrlu ils  rxm(r3nudom  livta(f Dua(mo;o0alx ioctas s2uan p;u0teenif oy1omDrluvslt t2tmio3io4amt livi ( artm(rpnu1tpeniietldfa uanvon(4aleoif iatlm rlnvo;s)tetrio3ou1lltnmicslsfs2taumpnu1alx mo3ias m2umuvont0aetoxr3iodfmte uvs;s0t2to(m3oo1lm  lfeta(fsrtr( onu1tex  ictat s2elump t4 eerio ia1fptelieslt0 eum(m ou4lpe lfvias  2tax ont0alx ioctys s2umuvsn(4altomf tatoatr ivi;()trxmir3no4omtelnvil( sDtr(rp;u4olxo oeiydls2ua(mo;u4areoxfciodfmt li s s)t2xmio3iy1olt  feia(farum(rp;o1tee  fctyt m em(mp t0artnxfciy1omDranei s sexo(m3no1om   nvtas)a2trxm ou1olx  fciasfaDuluvp;(0 exrxfcoatlpDr neol(0sexmxmpoudome mieta()artrumont1aptn ocilslm2uaump u0 ltrmfcoatfpD  uei ()texoim oy4lmenlneil(farurumo;u4tltomfetatfaDeau pnu)teenif ta1fa e ivs;s0trxrxm iu4am emneta(faDurumo;o4olx iicild mDra( o t0altnmr3iytfaDeli i;s0 etr(mpoudape mfct ( s2rrxroou4alt ioeiys sDuluvs;t0artoxociytomD  uvsl(0trtr(m oodalen fvi t artax oot1tptoiietatfa ra(vsn()aexrxr3iy1om rlnes () eurio3oydop nlfct s  rtax oou0tee ioeiad a2uan p;u4aexomr todomtr u o;t  euo(m3oydale lictltfaruaxroou1altoiieiatlm rm(vs;(0 lerif oo1fp rluvo s0 2xm(o3iy1omtnlivsa( sDta(mo;t4tetomf3iasla uauvp;u0arxrmo3iatlmtr n ols0teurimpiudam n iviat arua( pou0opxomfeiatfs2uluvs () exrio ootom rlnvsl(0trtoxo3oo4ol nmieils arraxrpno0ale  fetys m rl( o;u4 rtomo ootom rai o ()setr(rpnudap  mfesatfa2rrxm nt4open fciad s2rmumont)texrio to1opD  ivo s0srtr(r3io1op nlfcs sfaDtmurono4tlx  o3iyslaDua(mo (0altnmo3ootfmDelnesl(0 ruriopiudlptn ncia()a2tr(mo;o4tpt ioeiat mDelnmsnt4tleoxfctotfaDran i;(0seurir3oo1llt mieiasfsrtrumono0ale iietysfa ulnvsn()tlxnmrcty1faD ai i s)sexr(r io4apee fvtatf Durxro;o4tpx  ieiatfaDemnvs;u0teerir3tydfm eauei;s0 exmxm3nu4apt mfcsl() 2umx ono0olt  f3ilsls2umn p () exnxrcio1omDrlivols tetm(o iydap   fvsls)s2umur ;u4alx  icildla el(vp u0 lxrif oadla elies;()texoxo3oodlmtemiesa() rtau  nu4tpxo ictyt m2eln o t4trenif3oadlpDe ivo s s2urxo oy4ll emiei () rta(rpoo0oetn feiltfs ul( sn(0 rtrif totlpD  u olt) rxo(m3oudaltemncs () 2rmum nt0openioeiadlaDuluvpnt0 leomo iadom   nvo s setmim3oy1omen nesl(faDraxmo;o4aleo o3iyslsDemu sn() rxnmo ia1fmDrli s s) exrir3nudlme lfcs s  rurxmo;o1tpe ifeiydfs2eaumo t0teenxr3tatoa e ues;s)srtr(r oy4openlivtl(f 2rmum ;u4tpto o3tlslm2emuvp;t0trenirciodlatrauvsl( teuoxr oo1aleemivta()srtmxmont0apeoifciatfa2umnmonu0trxnxo oatfmDe ieo;( srtrimpnu1aptemnvi s)a2ra( o;o0tpt if3tadfaDelumsnt4 lxrirctotlpDranvs;t)srum(r oo4amee ivtasfsDtrurpnt1ape ifciatfs uanms;u4 reoxr3oo1fpte iesl(0srxmxo3iy4al e fvtlt) 2umxronu1aee moeiadla rl(vp;t0areoxo tydop   uei (0 etmxrpno1al  livslt  rrrxroot0texn f3iat s2ea( s (0arxoir3oodlpte ivi;t  2xmimpio4alee fes t)sDrm(rp;u1olen fetadla2rmumsn(0aexrxo oodoptr neo;s trumio ou4lm emncsasf rur(rpoo0altomoetatfsDeauvpnt4 rtrifcio1lmDeaivi;t0 rtm(r3iu1lpt  fvtl() Drrx  ;t1tpt  i3iat a uau s;()aexnir iotfaDe u olt0 rxmxm ou4optn ietas s2rmur oo1tlt ii3iatfmDulu p t)tlenmoctotoaDrlues ( t2xriopiudame  fctl() rur(r oo4ole ioeias a eln o;t0 rxrmo3tatlmDeau sls)s2xoxm3oodamenmfvsat  rtrxmo;t0aexomfctyslsDuan o u0 eenio3iy1lpteanvo;( setm(opou1al nlfes ()s2tmxrp;u1oeto oetat a2elu pnu)trxnmf3tytfmDe ivo (0s2trxrpou4ale mfeias) rtrxrpot0olenmf3iad a um(monu)areoxociydlaDeau ols0 rtriopno4oltnmnvtl(  rrm( pnt0alenif3tatfs2elnmp;t4artnirctodlm eauvsl()teto(o3no4ole mfeil(  2ta(mp;u4alx mo3iys s rlu onu4 lerxfcta1lp e u o;t) rxrxr oo1lp nlictlt a2raumpnt1tpt  feiyt mDrmuvpnu)tltnifcto1lp  auvil()teuo(o3oydll  mfct (  Drm(rpoo4alxn ieild s eaumsnt0teenmr3ta1lm rli i t)srtrxrpoo4lpeelnesas) Dtr(rpnt1aeeoii3ilt a rl(vp;t0 ltnmf3iy1fm elu o;()trtoimpio1lm e nvias)s2raxm no0tetn i3iltls2emnvp () ltrxociy1fpDe u s t0 rxrxrpnodalenlfet s) 2uaum ot0optnmociatlaDulu s;u0 eeoio3iotlp rlivi;s) 2urio3nudlp elfeiat) Drrx  ou4tleoifcild m2emuvp;(0arermf3oy1oa  lnei;s  etrir3iu1ll emfcsls  rrau  nu0aex ifciltlm rmuvs;(4alxnif3iydfpteai olt)teumxr iudlmt  ncils) Drm(r no4tpe  ieiyt a2ra(mo t0trtrxocootfpDe ueols texoirpnudom emfvtl(fa2umurpot0apx  o3ias m el(vp t4areoif iy1lpt  i sls)srxoiopio1ol e neil(f Drmu  no0teenif3tyd sDuln onu0treoxr io1lmtrauvo;s0seur(r oy4lp nlivilt)sDrm(  ;o1opxniiciat a2emumon(4tleniociodoate uvilt)s2trio oodap emfvias s2uaumpou1apt  ictyslaDuanvo (0 etnio ia1fmDranvo;t0seum(m3oy4op n fei t s2uru  nt1apxo oeilslm ua(ms t0 lenxf ta1fpt au il(0 2xoim ny4ome  nci ( s2rrx  ;t0olxoif3tls s eluvp;(4 lxoio3to1fptrau s;t s2uo(m3iy4lmt  fciltfarrrumoou1apen f3tyt s uau o ()aetnmf3oa1oaDeauei (0s2tmxr oudame lnetat sDrau oot0oltoifciasfm2uau s;u)arenmo oatlaD an o;( srumim3ny4optnmnetat a2uaxmp;o0oexn f3iad aDrln p;t) eenxocoatopDe ies;s t2xm(r3oudoltelfvsa(faDtr( p;u0oeenmfetadfm eaump;(0trtnxo3oatfmteli il() 2umxm3oudlpt mfcsltfaDtrxr ot1tptomieiyd m um(vs t4tlxomociydop e nvilt)t2xo(r3iy4om   fciatf rrr(roou4tle  ictyt sDemu o;() rxnio oy1fmD  ueo s setrxrpio4op nmfcils)s2ta( pnu1aex mi3ildfa2eaumpnu0tlerirctydlp   ivo;s  exoxrpio1openmieiltfartrumo;u0tpxo fctld s em(vp;(0tetnmr3oa1lptelneols teuo(r no1lmenmnvt t sDuax  no1olt if3ils a ulnvp;()texoxrcty1lpDr nvo t  rtoio3oydal nlfes (
\ No newline at end of file
@@ -0,0 +1 @@
+ieil( s2urirpnydom   feiasfaDururo;t1olx iictat a em(vo;()tltomfcio1fm   nei t  etrxo3iudomte fesa(f 2tauro;o4tle mo3tadfaDem( p;t4tetrmfctatlp rlneilt0 rxrimpny4am n iviltfsDurum ou0oleomoeiatfaDulump;t4aetnio3totoaD  nei ()tetoir no1amtn neils)srrmx pnu0optnmfcild a elu pnt)teeomf3ta1lmtelu sl(0sruoxo nudaptemnctlt srtruro;o0oetn ieiytls2eauvo t0aexnmr iytfaDrai olt) ruoxo iodop nmncsl()a2rmuronu1aeenii3iytla eanmp (4 eeoxociadfa eai s s)srxo(m3iu4amt lfviat  rrr(r ;o1tpenmi3iyslm2umn snu)tlxrif3iotomDr i ils0teurirpoydlme mictat)artr(mo;t0apeomieiadlsDrmumo;()trxrircoatla rlivi;t)srxo(rpiydap  mfetas srurx pot1altnmoeiadfs uau on() rxoio3tadfm  lueo t) etr(r iodole mfvtlt  rumx onu1texnmf3tas aDrmnms u0tetnircoadfmDrlu s t)trtr(r3nu4amenmieta( a2tm(rp;t1apeo feiydfm rauvp t)aexnxocoa1lmDr i o;t)sruoxm ny4oltemfeslt sDtr(  nt1aet mo3iatfm uau p;u4 lxoio oadoatr ueo;t) exmim oy4apt  nctas)artr(m ;t4aleo oetat m2eau snu) ltrio tytfate ivils s2xoiopoodam  lnci ()aDrmxmo;t4aptomfeiydfm ulnvsnu4alxrmfciodfm  au o (0 ruoiopnodom emneiasf Drru ono0oexn fciys m2em(mo (4 lxomo3iodfa rlieo s t2urxm3oo1lpe  icias) rtaxr ;u1alen fcias m2rluvpnt4aetrxfciadlm eau i;(0setm(mpoo4lltnlivi (f 2rmx  ot0texnmfciytla emu p u)altrmocoytfa ranvo;t0 eumxo3iu4am   ivt () Duaur ;u0ope iieiysls elump;()tltnmrcio1oatelu sl( srumxrpoo1om nlneia() Drau p;o0oet iietlt aDem(vsn(0 lxomoctodlp ranvs;s) eumxo nudom e ivtlsfaDraur nu4ope  ociat mDem( s;(0tetomfcia1omD  ieil(  2umim3io1lpenmnvi (faDurxrono4aexomi3tldlaDemu p u0texrmo3oytfpDr n s ()s2tm(mpoo4aleelieta(f rua( onu1olenmfeilt m2rlu sn()texrmfcto1lmDrluei;s t2uo(r3nu4lp emfvils arurx ooo4aee io3iltfs eanmp (0 lxoioctotfp   uei;s)trxo(m3oudomen iesa(fsrrau  ;t4oexoifeiat a ul(mpn(0tltoxfctodfatranei;t0 rxrir3nu1lltn nci ( arta(m nu0tlenmi3ilt mDrm(ms t0trtnio3iotlpteaueo;s0sexmimpoudapee ictlt s2uru  ot1oet ioctldlaDeaums (4teerir iadoate i i;(0t2xo(opio4am  mneslt) 2rmur ;t1olenii3ilslmDul(mp;(0 rermfcia1fmt ai i (0 2xo(o3io1omte fes sfa2raurono1aee  o3tldlsDrmn s (4aexnmrcto1oa  aneils)texrir oydapt mncsatfa2rr(rpot0tpeoiocilslmDumnvo ()trxrxrcoytfm rau il()t2uo(o oydopeemfet t sDrrump;o4tpxnmoeiadfa ul(vo;t)tetomf tadomtran o;t)teumio oo1amenlneslt  Drm(rooo1opxoioeias m eau o;u) eenxf3to1lmt  u s t)srtr(o3oo1aptnlfvs (  rtm(rpno0ale mfciyd s rlums;(0arenxf3ootfpt  u s ( trur(o3no4om n fcs (farra(r ;o0aee iietydlmDuanvp;u4artrmo iytfat an sl()teur(m3oodlpe  ivt t)srurumoou1ope mieilt a2rm(mo t4trxomr iydfateauvols  rxrir3nydaptnmfct t) 2rau  ;o0apeo feilsfs2um(vo ()trxoxr oodopD luvolt  2to(m3nudll emicta(fsDua(rp;t1tetomfciysfmDeanmo;(4tltomf ty1lat  ies;()trxm(opiodameemfvia(fsrrm(mpnu1opt iictyd a ran p (4alxomr3iatlm rlnes s s2xrirpoy4omee nvi sfsrum(m oo4opx  iciatfm ul(msnu0tlermociatlp  aivo ()t2xrxmpnu4ll  lnesas)sDrm(monu0tlx  ociadfs2rm(mont0tlxrmo3to1op e n i t) eurxr oy4ap  mfvils)a2urxrpno4aee  oetyd sDrm(vp;u0 lxrif todopt livo t seurir oo4al nlici t s2trxm nu0aee ioetls s rlnmpnt0tleniociydfmDrlnei;t s2xr(mpiu1ol elncil( sDra(rp;o4oltn i3iysla umn p;(0tetrio iodfat lues;t t2um(o3ny1alt  icta(  2umxrpnu4aexnifciys m rmnmpn() eerxo oydlmtranei t)tetmim3no4aleelneiatfa2taumo;o4tpeoioeiysla emuvp u0 lerir3iadopt li slt s2xmxm ou1lltelfcils)a2ra(m ;u4tpt  fetltlaDulumsnu4artnmf oadoa   nei t0t2xoio3io1olt  fci s) rtr(  ;u0opeoiocias m2emu o t4tlenmfciytfpteli i;(0 2tr(mpoy1olee ictl()aDra(root0teeomi3tad m rln pn()tleriocoo1latrai sl( s2xo(mpoo1ol  licsa(f Dta( p;u4apen ictyslaDrmnvonu0aleomo iodfmDean i;t t2xo(r3iy4alt liesa( aDuru pnt4oexn o3iaslm eauvs (0arxoxf3oy1optrluvols0 rtmxr oy1omee fesa( srurxrooo1opxn o3iytfaDra(mp u0tltriocta1op  an sls0 2umxopiu4llt lfvsas  2tax  oo1opt  feildfmDumu snt)trtoircoytlpD  iei;( t2xo(r3oo1omtn neta(fartm(r ot1open ociltfa2umuvsnu4 lxomf3todop rlnvs t srtr(o3oudom  mfesas aDtrxr ;u4altoif3iltfa2rmnmpnt)tetomoctodfmD lieols)s2xoir nudlpenmiesltfaDtm(rpoo1ale ioeiys a ul( p ()tlxrioctadom rliesls0teurxopnydomt mivsls)s2tm(mpno1teenmfciltfm ra(vs u)aetoio3iydlp  au s;(  rxrir oo4oltnlnvs s) rrru p;t0olxnifeiatlmDum(vonu)trxomo3oytoat an slt sexo(opiudlp nmfcsl()a2rr(r ;o4ale  fcild sDumnvo () eerio3iodfm  aieils)sexr(o3nodop  mncsltf Drr(rp;t0openmiciltlm2rl(mo u4aexoxr3oydfp  ln i (0t2tr(o iu1ame  nvtatfs2uaxroot0ale if3tls aDum(ms;(0texnxoctytlpDelnes (0t2trimpnydol   neiat aDrmxm ;t1opeo ieiytfa2el( s () rermr totfpDe u i s t2tmir iu4ameemfvil(  Drru  oo1teeomoetyd aDean o (0aexoxf3io1faDr neils0trxr(opiy1ape  ivilsfsrtr(ronu4aee ioctaslmDranvs u) ltnmrciodlp  ln s s0 rto(r no4lleelnvi ( aDua(mp;o1apxnmoetltfs2raump () exnxo3iatlp  lu i;t0trum(mpnudale  nct t  2umx poo1opto oetldfaDran p () rtrxr3oatop  au s;() 2trxm3nu4op   neias a2trump;t1ole iiciaslm2eanvs u4arenxo oodoaD luvo s0s2ur(o3nu1lpt mfvs s aDtmxrpou1altomf3tadfm2rlu o ()aexoifctytoaDelies s)t2tm(mpoudol e fctas)aruru onu4opt ifctytls2rmnvp;()aleomfcoadfp rau i s)srxo(mpoo1opeemivs t s2rr( o;o0tleomoetyd m2uanmp ()alermrcoo1lm elu s;(0 eum(m3iy1apeemnvta( s2taum ;u4alx mfetls s elnmo u0arermr3ootlmtelnvs ()srto(mpoudlmt mnvsa(farra(m ;o0ole iiciys aDuau pnu)alxnmfciytlpte u sl(  exoxmpoo1omenmics s) rraxro;u1texn fciadfaDrl( sn(0altnxrctotfpD lieolt s2xmxm io1am  lfvs t) 2rm( onu4oexniociyt s rmumsnt)trenmo oo1opte nei;( texoxo oo4ap nlnctatf rtaxmo;t1aexomf3iysfmDelu o;t) lxnio ty1oa  lu o t) exrxmpnodop nmfvt tfa2tau  ou1aex iiciyt sDrm(vpnt0 renmr todoa raues ()setoxrpio1lptelfcs s)aDua(monu1tptomoetltfs2rmums;()trxnio3tydoaD anvi;s0texr(rpnu4oltnmnvt tfsDumu pot0optoiietld s2rmnvo ()teeomf ty1faDrluvs;t0truriopnodol nlnvtls sDtax o;o1tlt mociadfa rm(vs (0trxrmo oadlpD  uvils)trtoir3nydll  lncsasfs2um(r nu4optn fciaslm eauvs t4aeeoif iytomt  i sls setmio3iy1lmte fciat aDua(m ;u1opxo oeiydlm2em( pnt4tetoxr3oytfp   i i;( s2xoio io1lltnmiciasfs2tm(mpnu0teen oetadfa2ulnmo ()aetoio3iatlpD liei t0t2tr(m3nodapenmnet sf rta(mpnt4optomieiytlaDemuvp t0 rxriocoo1opDr ivs;(0srur(o oy4ol  mfeta(f Dtaumpoo4ole  f3ilt aDulumo (0 lerxo3iytomDr ieols0setmxm3ny1lptemnetlt) Dumurono0alxnmoeildla2uauvo (4tetoxocoydfmt aivo;(0t2ur(r3oo1op  lfeils)aDtaum ;u0tlxnmoeiyd mDua(mont0alxrxf3iydfmDeliei;s  rto(m3oy4olenlnetltfartrxmpnt1altoif3tatfaDemnmp t4trenmocoytfa   uvils0s2to(o no4op emnvia(fa2ua(r ;u0tleoif3iyslaDua(ms ()trxrio iy1laD  neo;( sexr(mpoodaptnlfvia( s2tru pno4aleomoetatlsDeanmsn(0tetnir3iodlat lu i;t0trtrxo3ou4olte nvtltf 2uauro;u4ole miciyd a2rlu onu4 ltnifcoo1faDranvi t0srto(o3oy4lme mfcs t artm(m ot4altnioeiyd m ua(mpnu0 rxrmr oa1fp e neo ( setrirpny1op  livtasfs2tmu  ;o1oexnmoeiad m2elu pnt0tlxrmo oy1lm eaueslt) rtrir ou1lmt  fci ( s2tm( pot0olx mf3iat a2um(mp (4areoircoydlp rlivo ( t2xrirpoo1amtn fctl()arrmx  ou0aet  fciadla emn pnu0arxoxrcootfpteai s (0sruo(mpnodopee netls sruru  ot1apxn f3tldlaDum(vp t4 rtomo3tytfpDeau o () exoxrpny4ap elfvsa( arraxm ;u0tee  fciyd a2rmump u4 eerif io1omtrluvs t texm(m io4lltn icsat)sDrmx pnt4apxnmfciasla rau s (4arxrif iodoaDran o () rto(rpiu4optelfvs tfaDra(rpou0oetn f3tlt s ulnms;(4trtrmf iodopDraueols  2tm(opiu1lpeemfctlt)srtrx  ;u1aetnio3ilt s em(vs u0aetnxo oatfa e i o;() exm(r iu1ale  ieils s2trumono4teeniictldla uanms t4 etrxf3ty1opD aivs s)s2to(opny4ome lietasfsDrm(rpnu0optomfctaslmDelumo;(4 etrxf3iadla  auvo;t  ruoxopny1lp e fcs s srur(rpnu4opeo ieilslm rmu o (4aetoxf to1oaD  i o s) etoio oydomenmiciat)a2ta(rp;u4opxn fctat m2el(mo t4 eerxo tytom raivs;(0s2xrimpiudalteliei (farumur oo1apenif3iydfmDulu pnt0 rtoxrciytlpD aieo t  rur(r iudap emneils) rurxm no4tltoif3ilt aDelnmp t4 eeomr tytlp eli slt sexm(m no1am   fvsls)aDtmx ono4oee moeiydfmDrmn p u0alxrxrcootfaDe n i (  2uoxm3oudlpenmfvtlsf Dum(mpou4apt  octadfs2ean o;t0 rxoxfctotlmtr ies t) eurirpoodomte nvt (f rur(rono1ale ii3tat sDea( o;t4 ltrxr3oadfateln s s0sruo(rpiy4apte ieil()artmur ;u1olxomfeiatls ul(ms (4trxomo3totfa eauvsl( teto(mpiu4lp elicsa( a2rr( p;u0oexnmfciydlsDeluvpnt4tlxnmf3iotfmD ai i;t0s2xo(r no1lptelfcs ()sDur( ont4opeomo3tydls2ulumon(0alxnmr tatopDr n slt0sexo(o3iu1olenmictlsfarua( ono1tleo ictytlm2el( p;u0 reomo3oadomt  u i s teurxmpny1om n nvtat)a2um(r nt1tee  ieiatfsDem( snu) eeniocoytfaD  n sl() rxoim oy1lpeemfvt t s2tr( p;t4tpt mo3tatfm2ul(vs u4arxoir ia1omD  uvs t)t2xrxm3ny1lpenlnctas  Dta(ro;u4alxnmfeiltla2ean sn()treoio3to1lptr u s (0tetrio3no1ol  lnvsat)artmx p;u4altn ieiytls um(vs t0 rxomf iotom e nvilt)srxoxm3nu1altnlicsls)aruaxrooo1oleo icilsla uaumpnu4aeenmf3tytlat lu i;s  etrio3no4lpenmnctasf 2um(  oo4oleniieiadlaDumums u4 rermo oatlpDe uvs;t)truoirpnu1ole  ies sfsDrr(mpoo1oetniociyd a2ran p (0artnmo3iytoa r uvs;t seum(mpnu1amtn neta() rumxr oo0ope ii3iysfmDuan p u4 lxnmo3oy1oaD  ieslt tetrxo nu1lmtemfetl() rtaxrpnu0alt  iciyd s2ua( s;t)altrif3tatoa rlnvs;s trxoio3iudomeemnvi s  2ua( pnu1altn i3ilsfs2ran p;(4tetomo iytfa   neil()srtmio iodlmenmnvt t sDum(  oo4olxnmi3tadls elnmont)altoxocta1om  ai s s texrxopoodam elncta( sDum(m nu0oltnio3iltlmDuln s;u)arxnif ta1fpDr n sls0truo(mpou4al emfcil( s2rmumonu0aeenifeiltls emu ont) ltoxr tadfpte u il( srumxo iu4lpe mnvtlsfsDrm(  no4oleoiicils aDulu p;()texnir oodlpD  ueols0texm(rpnu4ope  feils s2uru pnu4apx ioeildfm2rlnmp;u4artrif tatlpDelnes;()srxrimpny4am  mfes s aDurxro;t4aex mf3ils m2rl( onu0alxomo oydlatrlu s;s s2trxr3oy1al  lfvias) rurum ot4apeoifciysfs ua(mo (0alenxrcto1fmD  uvo s  ruo(m io4ll nlfvta() rta(ronu4apxoiictydla2ra( p;u0treoxf oydfatelnes s0s2uoxo3oy1llt mfcs sfs2umxrpot0tltoif3iydfsDrmnvonu4teermfcta1oa e u o;s teurxm3iy4lpt mnvsas)a2rrxr ;t0aeen ieiytfs2el(vont)aeenmf3tytlmteau olt) rxr(o nodam   fes s)arra(rooo4oee mo3iltfa2ean p;t0aetrmfcoatfaDrlu o;( s2umim iudom  licsa(  2raum nt4apeoio3tyt s umnvp;(0arxnxrcto1la rluvo;s t2trim no4amenmictl(fsDtax o;t0aleomfciadfmDrlnvsn(4aetrifcootoaDe nvolt0t2umxm3nu1lltelivt s) Drr(mpoo0oeenmi3tlsla ea(mpn(4aeenmf iadoptr ivs (  exoimpno4lltemfcsa( aDumurooo4tpto iciasfa2rluvs;t4aetnmo ty1om rlnvols0t2urimpoy4lmtn nviat)sDtmu ooo0ope ii3iltfa emums;t0 renmo3oytfptraues;s0s2xoir ny4am nmnvia(  ruaxm nt1oexomfciyslm uanvsnu) rxoir iytfat  ieol()seum(mpnodomtn fct t  rrrxro;u1tetoifetldlm2rmnms u)arxnxf3oadfa   neil(  2xr(o3oudamt micsls) rrrxr ;u1tpeoii3iasfm2uauvp;u4aexrmo ia1lpt  nes;t trxmiopno1ale livias a2uru poo4optn ieiysfm rmnvpnt)aeeoxf3iatfaDelnvil()texr(r oodal nlfcsat) Dtrxm ;o0ole  f3ildfaDeluvp;u4 reoio iadlmtran ilt s2toim3nydllte icsas)srrau pot0tpeo fetyt s2ranmp t)aeenio ia1oat ln o ( texrxm oo1ame lfvilt) 2ta(  ;u1tee  fciasls el( o;t0 rtnxr tytfmt an o t)trxr(opiodomeelfciatfs2uaxrpnu4alxnmociasfm2ea( snt0tlermo oodfm rai ols)teuoxo3ny4al emfetas aDuaxm ot0ale ioetytfaDemuvo;()arermo3iotlmtelu o () exoiopoy4llte fvils  2urx p;o1apeomi3iydla2rmump;(0 lxrxf oadoat anei;s  rtm(opoy1al  mict t aDra(mpot1olto feiytfm2umu o;u) eeoifcoo1oa   ivi s)trtmxm oudlmt  ncsa( artmurpnu0aeeomoetydfa2eau pnu)trtrxf3oa1om  liesl(0s2xo(rpoodlm n fvt (f 2urx oou1aee  fetadfm elumo t4 etoif3io1lptr iei s)tetoiopnydlptnlnciat arra(rpnu1aexomoetyd s uan p;(4trenxfcia1lp e ieo t srtoimpnydllte iet t sDtmu  oo4altnii3ias m rlumpnu)artnxf totfatean o;s0 etrxr3io4apee fvi s)arurxrpno0alen i3iydfmDum(monu)arenircty1fmD  nvs;t0trxm(mpiodomenmnetat aDumxmooo0altomf3tlsfa uauvp t) lerioctodoa eauvs (  2trir no4omtelfvs t)aDra(rpno1oexo octad mDuanvs;u0texomrciydoptrln o (0srxmim3no1ome liviltf rtm( o;o4tlxn iciysla elumonu0alxnxr tadfmte uvs s)seuo(m ny4aptnmivt ( srraurp;u4apt mf3iytfa rl(mp;(0 eenxr tatomD  nei;( srxrxopiodlleemnct t srrr(m oo4apxnmfetlslm2elu p;(0 ltrifctytopDe ivo t s2umiopoydalt  fvt (f rraurooo0aeeomo3iadls2em(mo;t)tleomo ootfa  ai o (0srtr(opoo1lmtnlfei s s2tmx pot1tptnii3tyslaDrmn o u) eeoiocty1fmDrauvsl()texmxr3nu1amt lictlsfaDrmx p;o1tleniictysls2el(vont0tlxomo oy1fm r ieslt0 rxm(r3nu1ole mivia() Dtmxrp;u0oetoifeilsfa em( on(4 exnir iotfptrlies;s)t2xmio ou1oltn fvs sfsruau  oo4texnmoctat sDumuvsnu)tltoio3oa1fpD  iei t0 rxrxm3oodapt mnvta() rrmxroot0alt mi3tydlaDrl(vo t)aeermr oydfm rlieo;s0teuo(o iudlp emneil()artmump;t0alxn f3ils mDrm(vsn()arenxfctodla  an sl( srum(o3iydaptnmncta() Dua(rpnt4alto oeiltfm rlu snt4aetoxfciotop elueols0 2umirpiy4omtemfeils) 2ururont4tpt  fciasfm2emnvo u) rerxf3iadfmDeaieils s2to(r oy4lp n fcilsf rtax  ;u4oeeo o3tltls2um(vo;t)altrxf3ty1opDr uvo;s)tetoxr3no4alee nvsatf Draxr ;o0oltomociyt s eln s (0arerif3oodfpte n o;s srumxm3iodal e iei sf rtmxm ou0aptoio3tatlsDrauvsnu4aetoifcoodoateli o s0trtr(m3nydlmtnlnctlt)a2rmx poo0oleo oeiyslm2rln o;(0 lxnmo3tytfm elieo;s seto(o3nu4oleelfeil(f 2rr(mooo1altomoctlsla uaumon(4arxnir oydomD  u o t)seur(r iodlm  mivs s)artr(mpot0alx mocils s2rmn p;u0trtomfciy1om rluvils0 rtoxm3ou4ape lncs (fs2um( poo4opt  ociltfs2um(vp;t) lerxocoydlpDelnei ( texo(r iy4amen ivi s aruru  no4alxo feils m rmumpn(0arenircoodfpt aivo s t2tmir3ou1llenmfetas) 2trur oo1tpxoii3tytfm2elnmsnu)artrir3iodop  lueo ()sexoxm3iydoltelfcsas  2umu  ;o4alxo ieild m2um(mo;u0 ltoir3tytomDeaieol()t2tmxmpno1al elnvil()srrr(mpot0oltnmieiys sDrl(mont)artoif3iadoaDrln i;t0sruoimpoodomtemfesl( sDur(ront1altoio3iysla em(mp;u)alerirciydom rlueols0sruoio3nudalt livs s)a2tmu  oo4teto o3iltfs ra( snt) lerif3oo1fatrauvs;s0seuoxr3iy4ap eliet sf rrau p;u0olxo fciatfa ranmon(0trtnir3iadlmt an olt0teurxmpoydome  icias)arum( p;u4oeto oeiltlm2rm(vp t4arenxfctotlaDeauvils)t2uo(rpny1opt mfvilt) Dur( oot4aet mietlsfm rm(ms u4arerxfcoodoaDrlivo s s2xrxr3iydlpe lfciat)aDrrur no1alxomo3tatla ulu o;t0 etrxr3oytfpDraivo;s  rum(rpiu4op e neiasf rtru o;t0aptomieildfa2em(vp;u0trermr3iydlaDelies;s) rurxrpou1op elfciat) Draxront4open oetaslmDumnvo;()artrxrciy1omDeln s s0setrxm no1ape mfvtl(faDua(rooo1apxn ociyslsDrln pnt4 lermo3tytfp rli s ()s2umir3iudlle mivsas)srtrxroou4olxoiietasfa rlu s (0alxnmr io1lpDran olt0 rum(rpoo1opte nctlt a2tr(m nt0tpeomfetls a2ea(mo;u0tlxomf3ootla ean s ()teumiopny4ol n neta(f 2raumonu1opxo ietltfmDeaumo (4 lenmr3tadoaDeaies t)srtrxo3nydol  livi t)sDtmxmonu0tlt  oeils m2elnmp;u0tltrmrcoodlptrli sls  eumimpoydlmtemncil(f rurxm oo1aetniictydfmDul(ms;()arxnxf3tatlpt an i;(0sruo(rpnu4ap e iesatfsDraumpno1tltnmfetat mDean pn(0tleomrctytlmDe i i;( texr(r nu1lptelfvtas arur(m oo1apt iietldfm2rlu pnu0aexomr3iatlm rli o;t) 2xoxo nu4ame micias) Drru  ot1olen o3tas s2rmu snu) rtrif totomte ivil()tetm(mpio1alenmncilt) 2rmurpnt0tlx  ociasfs2rm(mp;t4aleoxf oy1faDraivols)srxr(r3nydole liviltfaDtrxm ou0teenmfeild aDuanvpn(4alxoir3tydfaD aies (0 exrim ny1amtemfeta()sruru pnt1oleoio3ias a emuvp;u)artomf tydlpDeli sl(0trtmxm3io4ol emnvi sfsrtaum ;u4oee mf3ild s2rauvs t)aexrmo3tadfmD liei;s  eurxopiudamee nci t  Dtm(r nt0oetnif3tad m ulnvpnu4trtrxr ootoat au s t trtr(opny1ap elfvt t)srraxm ;o1opt mociadla emums;u) lxnxf todlp   u i;t)srto(o nu4omen ivtlt)sDtmx  nt4alxn f3tltfs ranvo;t) leoifciatom  aivils0trxmxr oy4ap   ieil()srrrxr oo1tex mf3iltlm ra(vpnu4aleomf3todlm e ues;s) 2tmxrpiy4al elneil( srtm(ro;t0alxomoeiltla2ulu snu4trxnif3to1latrli ols  rxoiopoydomen ictat)sDtm(r ;t4tptoifciatlsDrm(vo;u)aexrxr iodfaDr nes ()trto(o iu1olen nvi s) rrr(r ou1tpt if3iasfsDea( p;u4alxoxocootlmD au o s  2xo(mpiu1ll e nesasfartmxr ;o1aleo f3ilt mDulu p ()alxomfcoydfaDr u o;(  eto(r oydlmenlnci t arrm(mono0opxn fcildfsDranmo;u) lxoxf3tatfateaies s setmxo3oo4alenliesa(fs2urxmo;o0aptnmfetls aDua( on(4 lxnxocoy1fpt aivil(0trxm(opnodapenlnei s  2ur(mo;t0olxoiociatfs eau s;u0tltrio iytfat  ieo;(  etrxm3oo1lleelnvtat  Drau p;o4texnioetyslaDeaums;u)tetnmo to1fa rlnvslt0srxoxo3ou1llenlncilsfsDumxro;t0tet mi3iad a2rm( s t0texoxr3tydlpD aivs;(0t2tmim io4lltelnvsltfaDtmu ono0alx micildls2ranmo u4 etoxr3totfaDr uvo t seuoirpnydol nlnvtl( srraxmpnt4tpxo o3iaslaDrlnvo;()altrxo3oydopDe u s;t t2xmirpiodllt mieia(fa2uaumo;o1olxoifeiydlmDraumo (4tetnxo3iotla   nesls)s2xm(o3ny4ol nmiet ( a2umuro;t0opx io3iydfs2ulnmont0 rerxociadoaD  n il(  etrio nu1apte nvil(  Dtrum nt0tlx mieiatlmDul(mo;(0aleoirctotfat lnei;( trxrir io4llee ivs (fsDrmurono0oeeoiiciatls2em(mont4trenxfcto1lmDelieol(0srumxrpoydopen fvil() Dta(rono0tpx  fcild m eln onu0arerxr iatopte neo (0s2ur(r oo1amtnliei sfsDrr(mo;t1tex io3iatfm2ulnvp t)aetoio3iadlateln s;t0srur(mpnodlm nmfesa() 2urur oo4apenifcildls2ul(vo (4tlerxo3iatfat  ieo t0 2umirpiu4alenmnvsl(fsrta(r no0oexo i3ias m2rm(vsn()tlenxf3tatoat luesl(  rxrio iu1am emnviatfaDuax pot0tpt  ieilt s2ra( o t) etomo3io1lateliei t  eumxo iu1om emfvs s) 2trx o;t0aetoifciydfaDumuvo (4 rerxfcto1fptr ivils  etrim3no4om emneils)aDua( o;t4apeo ociys a2ul(mpnt) ltnmf iytfptrlu ols)t2trirpoy4oltnlietat sDra(mpnt4oeeoio3ias mDulnmpnt4artnmfcty1lm eaivs;t)t2xoxo3nydlmeemnesls aruaumooo1olenmf3ils aDemnvs;(4teerxo iytopDe iei s  eumir3oydape lncs tfsrtrurp;o4optnmf3iytfs eluvs;u4 eerxf iytoateau ils t2xrxr3io4ol  mnes s srtmu poo0aeenif3iatfa emump u4 leoxf3io1fpDraieil() rurxr3iudope lneil() rrrx ont1ape  o3iatfa2ea(vs;u4tleoxfctadfa   uvo (  2trxopnu4ol elnci sf ruru pot1ale mieild m2eanmp ()artnmo ty1om rlues;t0trxmir io1lme  fvt s  2tmx pnu4alx mf3iytfs raumsnu4trxoxo totla e i o () exoxmpnydaltnmfvia()aDtmxmo;o0opt ioeiadlsDelu pnu) rxnxr3iatoaD aueo;( srxm(mpno4ameelfcs (f Dururont1open ieilt sDemnms;()aeeoircoadoaDe n o;() eurxopoo1optn fvtltfs2uax oot4aee iicilsfs rau ont0 leoio iadom rau s;(0trto(o iydolt lfvslsfs2rrxront1tltn ietadls2rlnvp;(0trtnxo ootfm e ies s0srur(o3iy1optn fcsa()s2ur(moou1oex  feiydlm uauvp;u)tetnmfcootoaD anvs;(0 ruoir3no1lpt  fctas aDururooo4apxn o3tltlmDuluvo;u4tlxrxf ootlp  lneils)texmimpnydal elieil()aDurx  ;u0olx  oetld m uluvonu)tetrxrcoatfpteanvi s) 2trio nodalte nciat)artmx pot1tpen ieiytls2umums t4 ltrxo iodopt  n ols0 2ur(o nu4lme liei sf 2taxm nt1aeeomfetydls ua(mo;u)texnxocto1lpt ln s;t0 rxo(m iy1ol   ivi t aDrmxmpno4oleoifcilt a ua(vpnu4artoxr iy1fm e neils0 exoxmpiy1open ivsa() 2ua(root1apen ictadls2umumon(4arermfcoytomD  n olt s2umim no4llte fcs t aruax p;u4tpx iieiatlmDea(mp u)artrio3oy1omD  ivils srtmxo3iydol emnvsl()sDrr(r nt1aee ii3ils sDeln s (4aexoxociodlaDe i sls0setoxr3nodamee nesa(fa2uaump;t0optoii3iltfaDul( s t4 eermo3tadlp  anei (  2xrimpny1ll e iet t  2raxm ;u0olx if3ias sDeanvsn()aleoxr3oatomt ln s t0 rxoim no1op   ivslt  Drau  nu4aexnmoctaslm elnvp t4 lxoxr3ty1lmD  ivi;t trxoim nudll elnetl(faDua( oot0aee  ieilslmDuanmp;u0arxoiocoodlmD  n o;t t2umim3iodame  nvils) Drr(roou0oeeoii3ildfm2ra(vonu0tleoif ty1lpDraivols) rxriopno4lmen iei (fa2ra(r nt0tptnifeiatfsDrmn ont4 eeomrcootfmt livi;()texm(m3ny4lmtn fvsas  2uax pnt4aeen iciat a2ulnvsn()texoiociodomtelieols)teur(r3nu4op nlicsasfa2taxmpnt1olx mf3tyd aDrm( p ()tltnirctodlmtrln o;s0trtoio3oo1lptnmivsa()arumu pot1ale mo3tltfaDean p;t0texomo iadlpte nvil(0sexrio ou1op  lncta( artmxmp;o4optnii3tldfm2ua(mpnt0aetoif to1oate nvs;s  exo(r3iodopee fvi (f 2umu  no4altn feild aDranvo t4tlermocoadlat  ivs t0 rtmxr io4opee fvil(f rtr(rono4apt ifciad s ul( p t)areriocoo1lpDeaiei s0t2to(r iy1optn ivsas sDuaxmpou0oexn oetadfm2rm(vp;u)tltoxo3totopDeluvolt0trtr(r iy4lmen ivsas)srraurp;u4tpxo o3tls m2eanmp;u0alxoxf oo1oa  auei;t  2xmxo oo4omtn neias) Drm( pnu4oexo o3iyd a2umnvs (0trxrir3oy1faDelivsl(  rurxr iu1lle mictlt  rra( pou4tex  octysfsDrmums t0 eeoif iatomteaies;t  2xrxmpou4ll elivtatfa2umum ;t0apx  ietytfm2rm(mp;t0arerxo ty1la  auvs t0t2trxmpiy4apte ictltfsrtrx p;t0tpxomo3iydlmDrluvonu)artnirciy1oa ean s;( trxmxm ny1olee fvsl(  2tmum ;u4oexoii3tytfm umnmon(0tetrxr3iydlaDeaivs (  2tmim ny4lpenlnes (fs2ua( o;t0aetoifctatla2rlnms;u0altomf3iadfp  li s s)trxr(r3ny1llee ivtat  Dtrump;o0teeoioeiys a2ea(mp (4trerif3tatoptraivols0s2toxrpiu1opt lieia( arrm(ro;o0tlx  ocild m elnmp t0 ltnir3oy1oaDeauvsl(0 exoxr3nu4ameelicsa(f rum(  no4alenmoetydfa2uau pn(0 eenxrcoodlpD ln olt  exrim nudol   nctl(fs2tru p;o1openmiciadla eanvpn(4teenxfctydfa  ln ol(0 2umxrpiy4amt mfviltf Drru oot4opeomfetlt aDulnvs;u) eeoir iodoa  lnvo;t0s2xm(r nydame mfeilt  rumxmoot1ape mi3iasls ea(vpn(4 ltnir3to1opt aivi;s0seurxr3nudlm  lfes t)srtru onu0tee  fcildls2ua( p;t0 rxrxo3oytla r nes;t trur(m oo1lp emnvilsf 2tr(rpnu4aeeomf3iltfa uaumo t)texnif3oytfaDeliei;t)sruoxrpnu4lle  icsl( sruauro;u4aee mo3ias a2ran pnu4trtrif3iydlmD aneols  rxmxr3no1ap nlivilsfartrxm oo4aptnmo3iltla emnvs;(4trxnmr3to1opt au sl(0s2tr(opiodam e nviatfsrtrxro;o0aeeo i3iytlmDea(vs;t4tlermrciatopDrlnvi;t0 2umxr3iy1omee
\ No newline at end of file
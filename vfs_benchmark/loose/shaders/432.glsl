@@ -0,0 +1 @@
+uei;()trtmxm3oydale mfctat)aDta( ono1aeen f3iatla rlnvo ()teeoxf3oy1laD lues t) exmxm3io4alt livilt)sDra(rp;u0tlt ioetltfa2rmn p;() eeoxo iodoaDeaivo;t sexm(rpoodop eliviat  rtaxmo;u4opeo oeiyd sDuau snu) etrir ootfaDeln olt)trtmim3iudamt  fci t a2umu ono0openmf3tysfaDrm(vp (0 exoio oadoaDr u s;t srxo(m3ou1lm nmnesl(fsrua(m ;o0aeeo o3tls sDelnmo t4tlxnmr3io1fa  au s t  2um(mpoo1altelfvtas aDta(ro;t0tee ifctydfaDeaums;(0tlerirctytlaDrlivs;t0 euoxmpiu1opeelieiatfaDumu ooo0opt ii3ilsla umnms;t4 lxrmo todlaDe ueo;s)setoxopoudlmtnmiet tfsDtm( oot4tetnmfciyt m rmu sn(0tltnmo ia1optraieslt)trxrxopio1op e fei ()s2rmxrpnt1aptn ieias m2rluvsnu4 rxnxf ootoate uvs;s0 rxmxr iydlpte iesl() rrr(ro;u4oet  f3tad a um(mo;u0artoxf3tadlp e nei;()seumir oudomenmnctl()s2umuroou4tpx moetysfa2rl(msnu4tetrir iodfp   u s (0texm(opio1lpe  iviltf Dtrxm ou4opeoio3iadlm ua(mon(0arenmr3to1fpteai ilt)s2xrxo3ou1llt lnvsatf 2urumo;t0tlto ieiltlsDra(ms t0 rtrmr todop eanvs (0t2tmxo3nu4amt  fcsa( aDum(mo;u0olto fetys s elu pnt4tlenmo todop eau o (  etmxopny1lmenmfcsl()sDtr( p;t0oeeoio3ilsfm2emnvs t4tlxoio3oodfpDeai s;t srurirpny1ale lnesas)arumur ;t1tle iiciysfa2rlumpn()artrmr iatom  auvo t srxmxo iydaltnlieilt)a2umuro;o4openii3ildfm rlu o (0 renirctatfaDeli il(  exrxr iy1lleemiesl( sDtaurpot1altnio3iltlmDum( p;u0aexrif to1oa rluei;t sexoim nu4ll  lieiltfa2uau ono4tet  iciatfaDeanms;u)alerifciadfmteli o;() rxoxm3io1openlneia()a2tmum ot4ope if3tat s2uaums;(4 reoxrctotla raueolt)teto(o nodolenlici tfsDtmxr no1tptoif3iat m2ra( ont4 lenirctatfp  lues;t t2uoxm3oy4omtnmfci s artmxr nt1tet  fctys m2rm( s (4 rxomrcoadomDran s t  eumio ou4ome  nvtas arta( onu0oleomociysla rl( on(4tetoif iodfmte uvslt setmxmpoydomt mfvtas)aDtaxrono4tpe iociatfm2ranms u0texnio ty1opteaivi;(  rumxm3oodlptelnvtls)sDur(mo;o1alt  fetldla rmnvo;t0tleoif totopte uvol( teur(m3ny4ol  mictas artmx pno4aptnifeiat mDelnvs u)trxniocoydfpt  nvsls srur(mpiu1op n nesls)aDuax ono1aex mo3iys m eaums u0tlxnxf ootfm r uei s0 2um(mpio4amen fesl(  2taumpot1teenmiciydfa ranvo;u)arenxrcoadfmDraivil( srxo(r ny4al emfvsas  rtmumoou1ape  o3iaslaDranvs;()trxnmo oytlmD an slt) rxm(rpoo4amteliei (f Drr(r ;t0tpxoiicilt mDem(vp;(4artrxr oydoat lnesls0teurio nudoltnmictlsfs2taxroou0aptnmfciad aDrmu s;u4 lxoifciatfpDrauvo t0s2tmimpiodom nlfet sfsDta(rpno4tetoio3ilt s2rau o;t0teenxr3oadla r n i;(  2trxopiodomee fviasfsDrmumonu1aptnmfetatla2el( pn()tleoio iadlp e nvo;(0sexr(rpny4ame mfctls sDtrumono0opeo ictasls2ran pnu4trxnxfcia1oa rlivil(0t2xmxmpno4omenlieil( srtmxmp;t0tee moeiadfm ean pn(4alxomo io1lp eanvols)texoim3oo1ap emneiasfsrrrxrp;o4teto fcilslsDelnms (4arermocoatfa raivslt setoirpiu4ap elivils)aDrr(mo;t0opxnmfctasfm2ran o u4tlenmf3oo1om   neolt)srtoio io4apt  ici tf ruau ont0oexnmoeildfaDean on(4 rerxr3totfmD li ils0 etrirpny1omtelfvt sfsrur( oou0tleomoeiyd m ua( pn()arenxo3oatfm e ieo (  exrio3oydllenmiesas sDumxm ;t1optomfetld a2rl( pn(0aexnir3iatla rlues s0teuoxmpoodlm   ncs tfsDur(r no4altn ieilt mDrmuvs u0 etrxr ootomD luvo () 2xrir ny4amtnlicsls aDtr( pno0tetoioeiltfa el(msnt4 lerircoadopDelues s)srxmiopio4llte fvsl()sDta(mont4apt iiciltls umu p (0 rxnxo3oodfaDeaivi;() 2to(m ny4amtelfci s)sDta(  nt4texnmfeias s2eanvont0 ltomr3iadlmt  u s t)texoxm3nu1lm nmivil( artmumpnt4oleomoeildls elu o;u0teenxfciadfpDeau o;t)t2xmim no1opee ies t aDua(rp;t0oetomfeiysla ua( o;t) rxnxr iatlm r n o;() exrir no1ape mneslt  ruru pno1alto octldlm eaumo;t) etoxfcio1omD aues;( trtoxm oo4altnmicil(  ruaum oo0aexomiciatfa2eanmont4 rxomf to1fpD luvolt0 2trirpoo4lm nlfciat arur( poo4openmi3iasfmDua(vpn(4 lxnmr3totfa  lneilt  rtoxopiydomtn nvi t)sDrrx oou0tptomoeiytfaDelnvp ()aexoxo3oadfa raieils0teuriopou1llenlnesltf 2uaxr nu1tet ifetytfa ul(vs;()tlerxr3oatfmt  u s t seumirpiu4llt  nct t srrau ono1aeeo ieiaslsDuaumsnt4 rtnifciydoptr uvs;( trurir iu1lpte net s)srtrurpno0tleo ictldls ea( s;u0teenmr3oodom elueo;t trtoio io1lle lnvtasfs2tmx p;t4apto fciaslmDua( o t)teermociydlptelnvs;s  rtr(mpou4op   nviat) 2tru  ;t0olt  iciydfa2umump (4 rerirciatfpDe nes ( tetr(rpiudomtnlfeilt) rtrxrp;o1tlto octld a ranvs () lxomf ty1fpt livi (0s2uoxm3iodom nliesa(f Drrx pot1altnmo3iltla2um( o u4 lenmf iytfpt ai o;t) rtoxopio1op n fcsls  rrr(r no4tpxn octyd s rmnvpnt4arenxr oodomtr ivols0srxr(opoudaptn nvtl( sDraumpot4apxoii3taslsDrlu p;t0 eermr3to1faDr u s s0trum(o nu1am emietat)aruaumpou1tlxo fctad mDelu s u)trtrxocio1omt  ivolt0 2ur(o3ny1alee nes (  2ururoou4tet mfetlt m2raump;u4 exrmo3oydomtr uvs (  rxmiopoo4lpe lfvta()artaxm ;t1tet  feiad s2ul( o;()tetrif3iatlpD ln s;t trtr(m3nudole  ncil(fsDum(root0teeoiocilt m2ua(mp (4arerxo3tydopt anvo (0 2toxm3iu1al nmivsas aDuaxm oo0alxnioctldfsDemumonu) ltomo3oydlpt an ilt  2toxr3no4lleemfetat) 2rrur ou1tleoifeiasfs uluvpnt) rxrif3to1fptrlu o (0s2toxmpnydome lnet sfarta(mpou1tee  o3iat a2rm( pn()altomfcoatlp e i o t0 rxoxr ou1op   iet ()sDrm(rpno1tptnmfciltla rau p;t4tlxoircoodlmtraivs t t2xmiopnu1omtnlnctltfs2ururp;u1ole iiciasfm2rl(ms;()aexnircoatfatrlnvs;t) euoxm ou1ome  nvilsf 2rauronu0tpx mieiltfs2ean snu0teenxrciodlpt aieo;s  exmio io1lm nlnvsls s2trumo;o4tlto f3iadls eln s t0 lxnio iodlaDraiei s  2um(m iu1lptelictasf rurxmpnt4aptnmieiadls elu o u0arxrir3iadlmteaivi;s0t2tm(m no1opt mnesas) rtmur ;t0texnifeils a uln on()aexnxociydomtelueo;t0trumim oodlmee nei t)srrr(rp;t4ale  ieiatfaDeanmsnu)arxnmr3tatlaD lieils trurimpiu4lpe  iesat) rua(ro;u0tpxomo3iadls rmnvsnt4altrircty1oatelnvo;t0 2tmxo3iu4ame lnetl(fs2rrxrpnu4opx io3tys m rauvp ()tetrifcoydoa elnei t)s2xrxr3oodam n iesls srtaurp;o0teenmf3iltlaDeaums u0tlenmociytfp  lu s;() 2xo(mpou4lp elivtatf 2umxr ou4apxo oetlsfaDeanmont4trtoif3oydfm rln s;s srtmim iydaptemnvi tfarurxmoou4tpt mo3tat aDra
\ No newline at end of file
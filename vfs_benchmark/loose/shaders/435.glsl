@@ -0,0 +1 @@
+nes t seurxmpou4ll   ict (faDtrxrpoo0texnioeiatls elnmpn(0tlerif iatlpteai i s0s2urirpiy4lm elfesa(  2uaum no0tetomietldla2eau p u0 etrif iodlm eauei;t) euoxopno4olt mics s)aDtmxrono1opeo icildfs umn s t) leoxf3iy1lat au o s0srtm(o3iydlme  ics tfaDra(rpoo1tlt mieildlmDuaums () ltoir3iatoa rlu o;t)srtr(m3nudam emnvilt  rrr(r nu4alxn iciad s2ul(vp u)aexnmocto1laDean s t)sexm(mpou1lme  feils) Duaxrpnu1apt ifctydlm2umuvon()teermr3totfmte uei;( t2xrxrpoydomee netlsfaruau ooo1ale ii3iatlm ea( ont4 eeoifctatopDrlues;()trxrimpnydapt lnci t artmx  ot4tpe mietatfs2ra( s;t)texoxfcty1optrli sl(0 ruoxopiu1lptelnvia( aDrmxr oo1aptnif3iydfa umn onu) rxoif3oytfpD  nei;t srurxo3oo4am eliesasfsDta(moot0alxnmf3iyt mDeanmsnu) exrmr todfp e i o;t  2xo(o nydal nlies s a2rmx pnt0texnmoeiyslm2elu o;(0aeeoif3iodlpDr nvslt)sexmir ny1ap  mivsatfaDrm(m ;o4aeto f3iad m uauvo t4 rtrifciatfpt livi t)texm(m3iu4optelivi s)a2ta(rpno0olxnifeiadfmDuanmo;t)trermocoy1omDr u i t0s2uoir3iu4opeemicsat s2ra(  ;t4aetnio3tad aDulnvo () rxnmrcoydlpD lies;( t2xoxo3nu4apee ivta()sDum(r no1aet mfcildls um(vsnu4artrmf3io1lm e nei;s0t2um(o nu1ap nlfvias)arururpoo0texnmoeiys a2ua(vs;t4arxoxo3oydoaDr nes s0trtrxr nu1lp n nvsas  rur(roou4tpe mf3tysfa el( o;u4artrxo totlptrlu ols)teumxr3oodomeemivs t)s2rr(m ot0opxomoetldfsDelu s;t0trxoio oytoaD livs ( texrxm3nu4ale mivi ( arrau onu4opxn ieilt m rmn pn(0aeermocoadfpD au s t0 2uoxrpoy4alt micil() Dum(mono0ale mociydls eluvsnt0teenmo tytlp   n o t0s2urim iu4ap n ies s aDua(r ;o0tptoiocilslsDelnvonu)trermfcoydoatrlieil()seumxmpou1apte ici t aDrmx ooo4tex moetlt m2rln s ()tleoxf todfpDrln s;(  etrio oy1amtemfvt (fa2uau oou4aetoioeilsfs2em(vo;u)alerircoa1lm   ieo s0srxoir iu4ame mfcta() Dua(r ou4tetnif3iatlmDeanms u4 eermrctytfmD li olt0truo(o nu4ale mnvias)a2ururooo0teeniieildfa ul(ms;t)aetrirciadfatrlnvol(0seuo(o3nu1ap elfetatfs2umxm nu4tpeoifctatlmDraumsnt0texnifctotfmt livo;t)s2tmxrpiu4lptnmiei ( a2rmum ot1optomo3iyslaDelu s;t0teeoio3iatlatr ieols)s2xoio ou1op  mivslsf 2rm( pot0oexnmi3ilsfsDrlnvo (4tlxnir oydlmteluei;s0sruoim3iodlm  lnvi s) rtmxmoou0aetn o3iytlaDumn o;u) etoifcootfmt luvi ( s2xrim3io1ll  lnct tfa2rmurp;o0olx micias aDuluvont4 renxfctydlmDe n o;s) rumiopiy4apeemfvt tfsrtaurp;u1tle miciyd mDumnvsnt0 lxrif iadomDeai i t tetoio no4llen ncsl(f 2tmum ou0opxomfciysfsDumnmonu0teeoircto1omD li o s  rumir3no1al elfetat) Dum(mpno4opx  i3ils a2ranvs t0treoif3oodfmD  nvo;()sexmirpou4optnmfctat)aDtmx o;u1opxn iciltlaDua(vpnu0tetrmr3iydop  aies;t t2xr(o3iudam nmfetl(f 2urxr ;u0oltomoeilsfa2rauvpn(4tetomr3oadfpte ivi ( setr(m3ny4apenmnvi t) Dtm(rp;t4opxoiiciatfsDeln p t0 rermocoodlmD lnvs ( sexrirpno4omenlivs ( a2ta(r ;o4tpxnmieiltfm2um(mpnu4 reoxrciadlptrlivi t)s2xoimpoodam nmfes sfa2tmx oot0teenio3ilt m ea(vsnu4arermfciodlmDrlivo s t2xoxo iu4lm  mnctlt)arum(mont4tlt  f3iasfmDemn o t0alxrxfciydlp   ivs t0 2tmxm no4amtelicias s2ur( ont0opxnmoeiatla rl(vp u4areoirciadfmtean sls0s2xoxr iudape lnei (  rtau  ot4aeeoioetat s2umums (0aeerxrciodfate nvo (0 eurimpnu1lleemncilt artrxr oo1opt miciasfsDuanms u4 eerxr to1fm  liesl(0 exmim no4alenlfetls) rumu  ;u4aeeomi3tlt aDuanvo (4aexrir3iotlm rauvi t)srur(r3ou1omenmnes t) rrm(mpno0ale mieild aDea( s;u0altnif iotlp r uvsl()trxr(o iu4lm   fvtas)aDta( pnt1altoifciytfm rlu sn(4 renxr3totfa e uvs;t)trxoxr3oy1lpee fciasf 2umu pot0aee  o3tls sDemnvp u0artriocoa1op raueslt)srxrxr nodaltnmivi (fsrumur ot0tlenmoetatlm2emnvsn()aeeoxr3ty1lm rlues t seur(o nu1ll elietatfsDrrx oou1tpe mfciytfmDrmnmsnu4artnmr oo1omD livo;s0setoxr iy1amen iviasfsDur( o;u1oee  iciyd s rmnvp u4trxnmo3oa1lm eln o t0 2uoimpny1lm emnvi ()aDrm(ront4aeenmf3iltlmDum( s u4tlxnmrcoy1laD ai s;s  rtrio oy1lmt mfesl()s2um(m nt0tlenmiciatfs2ua(msn(0artrxo3tytlmD  n ilt  2xrxo3iy4lmt mfcsatf rtm(ront1tetn i3ilt m uluvs u)areomo ootfmD auvs s  exm(r3io1llee ncta() rrax  ot0alto i3iltfaDul(monu)arerifciytop rln sls)trxmxr iy4omtn nesa(  2tmx pnt4alt  ociyt a emnmp (0aeerir3ootoa e ieslt s2xmiopiodop nlfcta(f Draxrpno1oex  o3tas s ulumo;u)trtnir iatoaDelnes s)trumxm nu4lp  mnctatf rrmu ono4oltnmiciltlm rmums;(4 exrxf3oy1fateaies t  rxm(rpnodlp e fes t)s2ua(r oo1apx mfcias m emn p;u0teenxocoa1fmtrli s;t)seurim ou4ol nmiet (  2rmx  nu1aleo f3ilt mDeaumo u0areoir ia1fmte uvilt  euoio ny1op  lnvtas) 2ururpou4tlxo fctatlsDumnmo u4 rtrio iydom  li o (0 euoim3oo1amtnlies s)arrr(monu1olxomocildfa2rlnvpn(0trxoxocoadopD lneilt seurxr3nydamee fci t  Dua(mooo0tpxn iciaslaDrmn o ()artoxr tydlmt lu s t)texoxrpoudlpenlfvs s s2taxrooo4tlt  octyslm2eauvon(0texrmr iydopD ln i s truoio ou1llte fcsas)srurx  oo0oetn ieiatls2ea(mo;(0tetnxoctytlaD au slt trxmxm3iu4ale lfviat a2rrxrpou4alt miciysls2el( ont0tltrxoctydfateau il(0s2xr(o3ny1ol emneslt)aDra(mono1apx ioeild m uau s t0alxrmo totlm e ieo (0trtmirpoy4lmtn fctltfaDurumo;u1tltn fctas a2umuvs t0 etrmf tydfmtrli sls tetrim oo1omt mfvtl( aDurxr oo4altomfetysfs ul(ms;()tlxnmo ootfpDrlnvi;t)srur(opoydlmtelietl(f Dtm( oou1tlx mf3iaslsDumnmo;t) rtnxf tydoaD lieo s0srxoxr io4olee nci s) Dtrxrp;o1apxoif3tlslmDea(vsn() lxoxr ootlmteln sls t2trxopou1ap n iesat  2urumpoo0altoioctysfm2rln pn(0 rxoxfcoodlm e ueols) exrxm ou4ol nlfes t)s2rr( poo0apxoif3tytfsDranvs;t4 exrio oy1op   i s s0 2urxrpno4om nmnei s)aDrau  ;u4alxomf3iysfa2rauvo u4 rtnio oo1op e ieol(  2trio3oy1ap  liet t  2umump;o0ope mieiysfa2eln snt4 ltrxr3tytfatrauvsls s2tmio oy1ap e ies tfaDra(m ou4olenmo3iys sDrm(vo (4 leoxf ty1lm r nvo;t0setm(r3iy4apt lnctl(  2rax  nt0oee mi3iydfa ul(mo (0trxoifctadopteln s s0t2uoxo nodllenlfeilt  Draumpno0tleoii3tydfm uau p;(4teenmr3oa1oaDr uvi s truoim3io1aleemnvtl(faDuaxmp;o4olt  i3iatfa ean s u0texrif oytoat an i;( tetoxr3io1al emnciasf Duax pot4optoio3tls aDemu s (0tltrxr3tytlp rli ol()srxm(o3nudlp nlnvi () 2trum ;t0olx  oetyd aDumuvon(0alenxf iotfa rauesl()s2uoxm3iodap n icil( s2urumonu0aex ii3iad mDeanvp u4tltrmo iydomD auvolt) ruoxm3io1lmt lnetltf rtrumono0opxo fciltfm2ua(ms t4 exoir3ty1faDeaivs;() rxm(r3io4lm elnetatfarum(mpou1oex mo3iaslsDea(ms t4 reoxr3io1op   ieo t0 rxoxr3nodam  livta(  Duaumo;u0tle micilsfaDrl(vs () lxnxr3todomtrauvs;(0 eumio nudlme liesl(f 2trumoot1opt if3tytla rl(vp ()alxoxocootoaDr ivi s0srtrio3nu1ame  ivtls) Duaxmo;o4ole mo3ild a2rl(mp;u4altomo ia1lmtraieols)t2umxo3io4lptnlivil()srtmu ont1tex mf3iysls2ra( sn()altrmo3oydlp rlivo s  2urxrpny4ape 
\ No newline at end of file
@@ -0,0 +1 @@
+ues t) rtoxm iodlltn ncia() 2tr(rp;u4tlxn o3tytfs elnmp;() rtrxrcootfa  lu o t)t2trxopny1lmeemieiltfs2rmx pot1apeoiietlt s2ea( onu4aexnmo tytla  lieol(  2uoxr nodameemivia( srrauroou1tet mociysfs rmuvp ()aexoxr3tydlptr ies;t s2ur(m ny4altn fet s arta(  oo4aex iiciydlm em(mo;(0 eerif tadomtraieols)t2tm(mpiodlptnliei tf Dur(rpnt1tle mf3iltlaDuauvo u)tlxnir oa1oa e i o;t)setrimpnu1lp  mneilt sDtaxm nt0opt if3tls aDrm(ms;t4aexnxociydfaDe uvo;t)s2umxr iy4al nmfvil(farra(r oo4tpxnifctltfa2umu p;t4trtnmo3ia1lpt  nvi (  2trxrpiu1oltemfvsls)srurxm ou0oltnif3tys sDuau s;(4 etoio3tydlaDe u i s t2umxo oodalenmfei ( arrm( p;o4tlenmfctys m elnmsn(0teermfciydlp  luvols s2ur(m iy1apen nesl()artmu ono1tlxoioetyd m ulnvont4 ltrxrcia1la raneslt  rxr(o3oodomt mfesat)s2raxmonu1altniociydfa2emnms (4alxoxr ootfmDeaieo;s seuo(m nu4lp nmfeiatfarurxmooo4oet mictadfmDuanvp u4arxomrcia1laD  uvo;t0srxrimpiu1ameemfctas)s2rmumpou0teeoiieiatlm2eanvs;u)aetnircto1latr nvo t0s2um(o3io4ale  nesas) ruaumoou4alt mf3ildlsDrl(vo t4artrif iatlmD aivi;()t2toxrpou1omenmivs tfa2uru pnu1tlenifctldfmDumnms;u) ltrmrctydfmtran o s0s2tr(m nu1open fetls aDumump;u0opto octydfaDum(vo;()teerxf3io1lptrau i;(  exoir nu4lmtnmneta( sDuaxr nt0tpxo oeilslmDrmnms;(0arxoir oy1oa raiei (0srxo(r no4lpeelivslt)aDum(mont0alxoioeiys a um(ms u4 reoif3oodlp   ieo (0trxr(rpnu1ameemict ()arrax pot4tlxniocils m2ulump t) lenmo3todoaDrlu s;( trtoim3ou1op e fvtls)aDrm( pno0tpt mictytlaDumnvp (4aexrif3oo1la   nvi s)s2trxm no1llte feta() Dtm(m no0openiiciadfm emnms () lenxo3oa1faDr i i;s)s2xmir iodop nmneilsfarraumpnu1aeto f3iys m umuvsn(0altnmociytopt  ivs t)trxr(r3no1lp emfesls aDtmumono0apt io3tlslm umu p t)aetnif oytfm raieo ()srxm(m3no4am nlivtlt arrau o;u4opxo iciytfsDel(monu)tltnxf ta1oaD livi (0trumiopoo1al  mneia()a2rr(m ;o1ope mi3iltls2el(vsnt)trxoif iydoa rauvo;t  2xrxr ou1ap nmnesls aDtrur nt4tpxniietas aDulnmp;u4tetomrctodom elu ils) 2tr(m iy4openmfeias)sDurumpot4apxo oeiysfa rm(msn(4arxoxf3to1late i o s)srtr(mpny4al n ivslt arta(rp;t1apeoif3tytfa el(mo u0tleomf tytopt aueolt0trurirpny4lme  fcs ( s2trumpoo4aeto oeiltfs ea(msnu0tltrif3io1lm r nvs;(  2xr(m3iudaptnmfcta() 2trxr ;u1tleoio3iyslmDua(mo () rtrxoctadomDelneols  rtm(o3ou4lmeeliesls) 2rmump;o4opx  fciytla rlu s;(0tetomfcoatlpDe n o t0teto(mpnodolt mivilt)s2rm(rono1teto iciad a rlnmonu0aetoiocoa1lpDeluvi;(  etoiopiy1apt lnct (f Dtmxm ;u0aexnii3ias sDuanms t) eeoxf3iytlmDrlueo s teum(m3ny1ll  lfvt t) 2ra(mp;o1aeto o3ilslsDumu s t4 etrxr3iatomteanes (0 rtrio ou4ole lfci (f Drm( onu1apeo feias aDrmu o ()alxrio3iatlm  livil(  2um(o3io1lm elictlt s2uaxmpnt4tpenmi3tas s2rm( p t0 eermr3oatlptr uesls0 rumxm3no1ol  mictlsfarumx  ;u1opt iociysfs2uau p ()aexnxf3tydopD lieol()srtrxrpoodomtemicilt)arra(m ;o0apt mf3iatlm2rmumo ()tlenxo3oodlpD  ues;t  2uo(m3nodaleemfvi t  2ur(rpou0tlxnmi3tas s umu onu4trerxf3ta1la e n o s t2uoxm3ou4apeemnvils sDra(  ou1aetoifciys sDelnmo;(0 rxomo3iy1fmD au s ()s2xrimpiydllt lnes ( sDtrx oou0oex  fetatlm ul(vont4 lxoxoctytfpt auvol()trxo(o3iydoptn neia( artau p;t0apt  fctyd m2ean onu)alxoxo ty1lptr iei t0 eto(r3oy1om elnes () Dtrumpot1aex  ieildls uanvs (4aexnxo3iatfpteauvi s texr(o io4lm  mnesat)s2tmx pno4aee ii3tls a ua(mp (4tltoxr3ootfat ln ol( t2tm(mpoo4ame lnet sfarrrxrpnt0tltnii3ias mDumnmp t4aleomo3ta1fatrauvs s0t2urxo3iydlmenlictas a2tr(mpou4alx  f3tadfaDuau s t0texriocta1lpDranvs t) eumirpoudllen nesatf 2trxm ;o1tptomictltfm2umn o;u) lxrirciytfpDranes;s0setr(o3nodlme lfcsa()s2urur oo1aexomoeiydlm2ea(vs;t0 rerxr3tytoatelneolt) 2to(mpio4lmtelnctas)arrau  nu1optoifctydfs ulump u) rxomr ia1la e iei;(0t2trio3nodolenlnesa()s2tax p;u4apeo feiasfsDra(vo u) rtomf todfpDranvo () rxr(opou4lpe lfetltf 2um(mpnt1olxnifciyslsDeanvont4 lxoir iatlm  aueolt) rtmxm nu1ape mfvsa( a2ra(r nt1opxnmfctyd m rlumsnt)tlenir tatopt aneil(0texoio3no4am n ieiat)srtmurpnu1alx mfcild s ranmp (4 ltrmrciy1fmt auvi;()t2xmir3iydlptn ici sfaDumu o;u1tee  ieiys s eanvp;u0 rtnxr oodlpDr u i t0t2umim ny1alen nei ( a2umur ;u4aexo o3iydlm2uaumsnt)teenir3oo1laDraueo (  2umxr iy1om elfesa() Dtrx p;t0tlx mo3iydls2ea(vs;(0texrmf3oatlmD li s;( trxrio3oudll n nvtls sDrr(rp;u1optnifcias mDemnvs;u0 rxniocoo1omD aues;s0 rumir3oy1lpen ncias) 2ta(ro;t0teto ociydfaDulnms;t4tltnxf3ia1oa   nvo;(  etr(o3nu4ol emnvtl( s2tmx oot4teenii3iyslm2rmnvo u4 reoxr3iodfaDraies ( trtmio3ou1lmt mnct (fsrurxmo;u0alen ieiltfaDulump;t0 lerxr3oodfmteau ils)s2toio3oudll  lnvilt)sDtaxm ;o0tlenmfeiyt sDelums;u)aexnmo oo1omt aieo s s2tmxopnodlmenliesa(farraxro;o0ole  o3tyd s ra(vp;u) lermo3oydfa r ivil(0sexriopou4al e ict sfsDumum ot1aee ifetad a2ua(mpnt)trtoxf3tatlaDrlnvi;s) 2xr(opio4alt mnvt s) 2rrxrpot1opt mo3ilsfmDeln s;(0aexnif3iadopD lues t)truo(opiu4oltnmiei (f ruaxrp;o1olxn o3ilslaDea( s ()alenircia1lmteai ils0teumio no4apeelfvs s  rrm(moou4tee mietltfmDeaumon(0texrmr3iadlpt aiei;()s2uo(mpoudom  lncs ()a2taxrpoo0oee  ociatlsDrlnvon()aexrmfciytfpD  ueo t  rxoimpny1lme lnei s a2ua(mo;t0alx ii3iltfs umnmp t0 exoir3todfmt  ivs t  euo(m ou4apenlnvi ()srrrxr ou0apt ifetysls emnvsnu)altoxf to1fp ean i;()srxm(o no4ll nmnvtlsfarra(  ;o4tpxnif3iyt a ean o t) lxnxrciotoaDeaieilt s2tm(rpoodlp eliesas) rtau onu1ope  fciltfsDuanvp t)teeomr iatoaDelu i;s) exm(m3iu1alt mivtas s2rr(  ;o0tleoif3iytls2rln o (4 ltrxrciatfp   uvslt0 2xm(o3oydom emieils) Drax o;u1opx mfeiasla elumo u0 exrxf3oytlptr u sls)srtoxopnudllenmfct t aDra( o;u0oexnmfciadlmDelnvpnt)aetoif oo1opteluvo;s trxr(r3iy4ll  livil( aDurxmpou4opxn f3iys mDul( o (4 lxnxrcoo1fat lneo () etrimpnu1lm  mfcsl()a2ra(rpno0tlx mf3iad s em(mpn(0 exnmo3iydoateaueilt0s2xmxm oo1altn ictas)sDtrx pnt1opeo fcilsfaDrm(ms;(4arerio3oatoa r uvi s0srur(r3iudal emnvia(farurxr ;o1aptomfctasla raumo;u)tlenif3io1faDeli s ()trurxopny1lle lfetas srua(rooo0tlxo fctldfsDrmnvo u)artnmf oadopDr n i;s sexo(mpio4alt livtls aDtmx poo0altomf3tldls2uaump;t4tlxrmo3ia1la eauvol()trtr(rpnu4ll n ictat aDtrxroot1alxniietytfsDumnmpnt)tlxrxr3oydlat auei s0srxoim3nodlpe lnes () rurumo;t1aet io3iyd a ran o;t4 rxnir3oatfpDrlneils0 2tr(m no4ap elnvt t aDuau  no4aetniocildlm2emu s;t4arxnmf oo1fmte iei (0 2xoxrpno1omeelfes ()aDrrxm ou0oex  ietys a rluvs;(4 ltrif3to1lpteli i;()trurio3ou1open ivias) 2rmxm oo0tleomo3iytfm2rmumsnt)aetoxf iytlpD  u s (0srtoir oy1amenlneslt srum(r nt0aetnmfciasfmDranvon() rxrif tytlat lueo;()s2uo(m3io1lpen fci (  2rmxmoot0opxomoeild m2raumpnt4trxnxociadlmte u o;s0s2xoimpoodomt lnvias  Drrxmooo0tltn feiys m uln s (0 rxomo3iydlp elivslt)truo(o oo1ole mfeta(  Dta(  ;t0olxn ictytlsDuanms t0tltriociotoa raieo;( srxrxm nodoptnmictls  rtaur no4alxoiiciytfs ea(vp;u4arermo3oatoa  luvils) ruo(o3nudop  livtl(fsDraump;u1tpxo oetlt a2rmuvsnt)texrmf tytlmD  neo;t  eumir nu1om nmfvil(  Dra(  ;u0tet ifctldfa uanvp ()aeerxrcto1fat  nvsl( srxmxo io4am  mfcslt)sDta( o;o0tex  f3tad aDumumonu0altomocoo1opteaueil()setoxm3oy1ome  fesa() Drrxm ot0tleomo3tadls eanvp;u) lxoxo oadoatr i il(0truoxm nudal e nvta()artru o;t0aee ifctydfaDem(vsnu) rxoxrctodoa eluvo s0srxmxr3nudomtnmnct () Dumxroot1aeto feiadfaDean s u0aetrxrcoy1opD ai slt truo(o3oodal e icsat  rrrur nt0apt mf3iysfaDeanms u4arenif3totlmt  i ilt0srtm(r ou4optn iet s a2tau p;t0aleo o3ildlaDrmn sn(0tlenxociotomDr nvi ( s2trxopiy4amt  fvia( a2trx  nu4tltnmo3iltls uluvs (0 rtrmrctytopD livs;t)teto(o3ou4altnmnvsas s2um(r ;t4opx iieiytlm ran p t)alenxf iytfate i s (  eur(mpoodap e fvs tf Dua(rooo4ole  i3iltlm2um( o;() rtnxo3oadlaDean ol()s2tm(mpoo4alt mnvil(fs2ua(mooo4tleoioetys sDemnmo t0texoxr3iytfptr nvo t0t2urimpnydol   icta(  rtmx  no1ole  octadfa2eluvs;u0 rtnif iadlptrlnes s) exmir3nu1altnmivsatfaDua(  nt4aptnmoeiysfaDemuvo t0artoir3iotoaDrauesl()s2xm(m no4al nmict s artrump;o4apeoif3tlt s rm(vsnt0aeeoxr iadfpD liei;t)teuoxopnu4amte fciltfsDtau  nu0oexn ictld s2ul( p;u0artnir tatfaD livo;s0 eurim3oydal nmfeilt) Dta(root0aex mfciydfa eauvont0artomocia1lp e uvs;s)t2xo(mpiy4om elfeiat artmxmo;o4opxoif3tysla2em(vo;(0arxnio tatlm   n o;s0s2uriopoy4al nmfctlt aDur(mp;t1opxn ietyd mDeaumo;t4tltrmo3totfm   u olt t2to(r nydlp e ietls)sDumx  ;t4tpeoioctltla ulnvo;t4tlerio totlatr n s t)tetr(mpou1optnmnetl(farum( pnt4optnmo3ildfm2uanvs u4tleoirciadoatranvs;(0s2xr(o no4om  licsas) Duru  ;t0tle iocildlsDra(mo;(4aexrif3oadlmt anes;t  ruo(mpiu4oltelnciltfaDrr(m ou4tltnmieiysfmDuanmpn(0texrir oytfp e neo;t)tetoim3iodole lnvil(fs2um( oot0tleo fctldfm2umuvp;u4 eeoxf3oatoptr nvo ( srtrxm ou4lmtelnvsat  Dtmxmont1ole  i3iat a2rauvs;u)tetriocty1om raneols trxriopou1lpe mncsl( s2tmx  nu0aetnmocildfa2rm(mo;(0 lerio3oo1fp  lnvsl( teuo(o io1apenmiei t aDta(roou4aeeoifetldfmDranmp (0tetnxociodfa r u sls0s2tmim oy4olte fctl( s2uaxm ot1tlx mictltla2elu s (4aeenmo3iadfate nvs;s0tetoir iy4alenmictltf 2tmx  ;u1apen feildla elnmsnu) exrxr oydlaD au s t s2toxr io4lpe mfcsl(fa2trurpou4openiocilsfa ua(ms;u4 lermocootfpDrlu ol(0s2toirpno1open fcs tfsrra(m ;o0tptn o3iatlmDea(mo (0 lxrxo3oy1omtrlivi;s)srtr(o oudalen iei () 2rmx o;o4apxn o3tlsfmDrm(vp t) rxniocoatop r uvi;(  2urimpiu4ame lfcsa()artmx  ;o1aptn ociadfa ra(mpn(4teenmfciodfmtr i olt srxm(r3oy4lleemiei tfsrtmur nu4tpeo i3iytfa2ea( p t0 renmr tydopDrai il()t2urxm no1llenmfctls a2tr( pou0openifctltfmDel(mp (4 lenmr iatopt  i slt)teurxrpiy1ll nlivt tf rtmxmo;u0aptoioctld m2uluvs;u0tlxnir tatoa r uesls  euo(r iu4lp e iesltfartr( ono1texoio3tydfm2ulnvonu)arxrir todop  au o t)trxoimpny1amte fetlt  2uau o;o1tlen iciadls2rln s;t4 rtrxfcoydlaDeanvs;s trtr(m3iy1optnmfeias) rtr(  ;u1opeo feiatfa2rmu p;t)tetrifciadfmDr n ol() rumio3oo4lmen iviltfa2uru  ot4apt ioctytfm2eanvp;u)teerxrctotfaDeauvsls srtmxo oudol nlivias  Duru  ;u4ale iociltfa um(vp;t4tltrxo ia1fpDrlnvo ( sexoirpiu4ll e nvt sfsDrru pot0oltnifcildfa rln pnu0 rxnxf3ty1om  an sls0s2to(o3io1ameeliei s) Dumx  ;t0tex ifeiat a el( p u4tlenmo todlaD aneo s)srtoir3iudom  lfcsltf 2rrxmp;t1aetnif3iltfmDul( on() rerxrciotlm eanvs;s)teumxo ou4lm elieil()arrm(  ot4olt miciytlmDeauvo (4trxrir3ta1fmD aneo;t)t2urxr3io4olen ncils sruaum ou4opxnmo3iytla emumo ()tleomo oydlmDe i o t)t2ur(rpiudomenmneiasfsDtmurono1tptomfetlt m um(vsnu0 rermf ia1omDe ieil(0t2xrio iodaptemicil()a2raxm ot1tpe  ictlt m2rauvo (4arerifctydfa r nvi t)trumiopiy1aleemfvsat)sruaxr ot1tpenmieiytla2ra(vsnu) etrxo oodfa elnei s0s2tm(r iudam elnes s  2umx p;u4apx iieilt m uanvs;t)alxnxr3io1fmteauei t0 2xo(opnu4aleemieiat sDuru  ;o0apx miciatlaDelnvp;u0teermfcoatfaDe nei;t0t2trxo nu4ope  neslt)aDur(mo;u0tle mo3tlt aDumu o t0arenio oadlpD luei s) rtoxr oudll nlnei sf rtmxm no0olt ioctaslaDra( pnu4 eenxrcoatfpt  i i s) 2trio3nydlltn nesa()artrx onu4teeoif3ildfm2emn p;t0 rtnxo oadfm  lies t)srtmimpio1lmtemivta(  Drmxr nt0apt  iciytfaDemu pnu4 rtnmf3tadfpDe iei;t)trxrim iu1lptn netltfartmur oo1opx iicild sDrauvs (0arxoxr3oy1fp eln s (0s2urxr3oy4lpte fviat sruau pou0tpe if3tls mDemumont)trtnmociodfmt  ies s srumir ou1oltnmiei s aDumxr ;o4alxniictyt a2ra(monu0trerifciytomDeai s s)sexmim3nodame liet ()a2umxrp;t4optn fciysla2umnvsn(4aetoxo iodomDe ivi;() 2to(o3io4ole lneil()arrrx ont4ape mictld a2el(mpn(4aexoir3oy1fpDeaivi s)seumxrpno1apenmnvsl(fa2rr( o;t1aetomiciys a rm( onu)aexoxoctadomDraies;s seuoxmpiudap nmnct sfa2rm(r no0alxnio3iadlsDuluvo u0areoir ootlp e ieo;s) 2ur(mpnu4om e ieiasfsDta(m no4tpt micild s2emn pn(4teenio3ta1fmDrlnvil()seto(o3io1altnlivias srtax o;t0olxn ictytfs emnmo t0 lxoirctadfmDe ueo;(0tetoim3nydlpeemfcia() Duax  ;t0aee ifeiad mDran snt0texnmrcootlm rlnes;s)texr(rpiudap  lneiltfsDraumpno1apx mf3iltfs um(vpnt4 rtoxr3tytfa e uei t  2xm(opio4alt  nesltfaDum(mont0tlenif3iydlsDua(vonu) ltoio3todop r u i s t2trxmpiy4om emnet t  Drm(moou1oex io3tytfa2uln p;t4tetrmocoadlaD an il(0 etrxo iy4lm  liesat)aDtm( pou1tptn ieilsfm ua(vo;() lxoif tatoa r u i ()trur(m iy1ape mfeias)sDrmuro;o1alxnmi3iad m ulnmpnt0 lxoxrctodlmDeai s t setr(rpoy4ll nmieia(  Dtaxrooo0tpxo iciatlm eluvo;(4artrmo3oadop   u i (0tetoxr no1ale  fetls arrr(roou0aptoifeilsls2uau o;()alxoif io1lmte u sl(0truo(rpnydlpe  ictat a2raxmo;t0aexnmf3ias m ul(msnt4tetrxfciydfatelueo;(0 rxrxopiudapt livs s)arumum nu4aexnmf3ilsfa em(mpnu) ltoxrcia1fm eli i;s) 2urxo iydlmt micias)arurx  ;o0tlxo feiydfs2rm( p;u4texomrctotlpteaivs s)s2trimpoudapenlfetat  Dtmxmpno1ape if3iyt sDelnvp ()tlxrir3oydoaDrau o;s truo(r iodole  icia(faDuru  nu4oltoii3ildla2ulnvs;() rxoif3iotfptelneil(0 rxo(mpoo1lpenmfcilsfsDrru oot0optoii3tas a2uauvpnu0aexoxf ty1opD lnvils)seuoir3oo1op  mivsasf rurxr ;o4tlen f3iytfa em(vp;t0texnmo3iotfptrli s;t)t2uriopnodamee netat a2rmx p;o0oltnmi3ildlm rm(ms;t0 reoircia1opt  ieo s)t2trxo no4lpt lnetl( sDtmumoot1oeenmo3tadfa2ul(vonu4aetoif3oydlaDean ils  rtm(r3no4ll  mivilt) 2ua(rp;t1ale mocilt m um( o t) lxnio iytlpteanvs t t2xoim3oy4al nlncils) rta(ro;o0olen oetasla2rmu o;t4trtnio iy1fmD  u ols)srxrir oydomtelnvtasf rtr(rpno1apen oetldfsDrau p;t)arenioctytfaDran o;( t2uoio3io4om  lnviatfs2tm(ro;o4oet mieild m2el( pnu0tltnxrctydop  lieslt)srtrirpnudomt  fvs (f 2rrumpoo1tle iictyt m ra(vonu4tlerio3oy1fm  lneo s  2toim iydlp emfvs sfsrum(monu0oee  ietadla2uau p t4 ltrir totopDrlieo;t0sruoxo nudaleemivias)aDrm( ooo4olx  octlsfm2ua(mp t4 eeoirctytlpt  ivo t)tetrxr iy1ol elicil() 2umx p;t1olto i3iadla2rm(vsnt)aetrmrcta1fa e nvs (0trxoxopoy1alen fvsat  Dtaurooo1apenmf3tydlmDrl(mo u4tetrif3iadomtrlu sl() euoimpiy1lptnmfesa( arrrxrp;u0altoiieilsfsDrmuvp;u0 lxnif iy1fateaivi;s t2xo(mpno1lm  lnesa()a2urumpno0tlx ifciydfa2rlumsnt4alxnir3iotlp  aieo;t)setrxrpio1lp e ietas artaxrooo1tlto i3tadlmDem(vp t4 lermfctadlat  neo () exmio nydal elnvsa()s2ta(mpoo4teeniieiydlsDum( s;()aeenir iy1oa eaiesls) rto(r3iodap  liviasf rurxrooo4alt io3iytlm emuvpnt4tlenir3iadlaD lu i (0srurxo3oydale mnetas  rumurono1teto ieiyd m2rl(vs u)alxnxf tytlmDelues t0 2xmxm3io1aptnmfci t) Dtmu  oo1tpxo feiltfaDemnmonu)aetoxf todlm rln s t0 eumxm io1al emivt t)aDrm(r nu4tlxoio3iatlaDum(mo (4aexnifciatlmD an il( srurxo3oudlmenmfei ( sDumxrp;u0aexomiciysfmDeanvp t0tltrmo iatfpt aiei;s)t2xmxr3iodamenmfvt tf Drm(mo;o0tlxnmoeiysla2emums t)altniociy1omt  i ils0seumio io1am  lfct (fsrtrx  ;u1aet if3iltfm2ean p;u)trtnmfcoodoaDranvi;t trxoim3ou1amtn iviatfs2raxrpoo0tetomieiysfm ea(vs;u0trtomo3iy1lpD livo;(0s2tr(m nodll nmfei t aDur(rpot1olto oetas m rl(ms t0 exoircoodoaDrln sls s2xmxr nudap elivi t arrrumo;t4altomfetysfa2ulums;(4aexrir3oa1lmteli olt) rtrxm3io1omenlfvtat)aDrmx  ;u0tpx iiciadfa2ua(vs u) exoxrctadopD lu i;t) exo(o3oo4lle lieia(  Durxrpoo4aex iociydfs ranmpnt0trtnmfciydoptr nvo;s  rxrxrpio1om   ici t)a2ua(ronu4oetn octlt s ul(vs;t0teeomo oydfpt  nvslt0t2uoxr3iydap   fvta(fa2ra(m no1olxo fcilt a2rmump (4 leoxocoa1lp rau il() rto(m3io1lm nlncta(faDrrx  no4teeoif3ildfa umuvsnu4 lermr3ta1opt aivs;s)t2toxo3no1lme miviat arua( p;u4olenmfciydfa2elumo;t)tlxoio3iydfpD anei ()teur(rpoy4lpt mfci ( aDtax oot4olen fcilsfm2el( pnt)tltnxrcoo1lpteaivo;(  2umxo nu1llenmictasfa2raump;u1opx mo3ilt a2rm(mpn(4 rxrmfciotlm raivs;t0teurir oy1lpenlncsls  rtrurpoo1tlt  feias a2rlnms;u0 lxoxf3tydomt li s t) ruo(o iy4llt lfeiat)s2trx  ;u4aeeoioeiysfm2rmums u4tetnio oodlpte nvi;s0srurxr nudllenmfct t  Dururo;o4aeeomfeildla2emumonu0 reoxo3to1lmtelneo;s srumir nu4altelncs ()sruau o;o1oetnmfciytfmDemuvo u4teermrcoa1optr uvsl(0trxmiopoy1aleelies sfa2rm( p;u0openifetltlaDeln o (4 leoxfctydop rlu s;(0texo(o3ou1apeemfvta()s2ra(ro;o4aleomfctaslm ul(mo (4tlxnxr3totlpt  ieolt s2toxm iy1al nlfciltfarum(mo;t4tee mfciatlm2rln p t)artrxf oadlm r ivs t)s2xrim io1oltelnesat)s2tr(mpot4altn ictysfsDel(mo;u0 rtnxo iytoaDelnesl(0t2uoim3ou1altemivsa( arrax pot1oeeomfcilslm2rluvpnu4tltoxoctodopt lnesls) euo(opoy4lltemncilt)sDtruront1alto ociasfm2umuvpnt0arxrif ia1omD aivsl( s2urim oy4ol   ics ()artau p;u0tlto octadfmDrm( o;(4aexrif oa1faDr n s;t0t2um(r3oudapenmics t)s2tmxmp;o0opt iociad mDrmuvo u) exrirciydfmt  ivsl(0s2xm(r3nu1omeelfeia()sDra(rpno4open fetat aDeanvsn()alermo3oadop  lu ilt0setm(m3nodoltnlnvilsfaDumum ;o0optnifeiatfa2ul(vs t0 etoxo3tatoat li o;s0texmxo3no4opt  icilt)sDtau  ;u4tlt moetldfa umn s;(0 exrir3totoaDe n s;t0t2uoxmpiudlle  fvt s sDtmxro;o0opxo ociyt m2rm( p;u4 exnxrcia1laDrln o t0t2umxr3nu4llenlfetatf 2ur(rpnt4apt moeild aDelnmont0trtomo3tytoaD  i ils)tetr(r iu4alte ncilsfsrum(r nt0opx io3ilt aDulumo t0texnmr ia1la   i sl(0 rxoxm ou4lpe lnet t s2uaum nt0aetn i3tas m2ea(vs;t)arerir oadlaD aues;t0t2xrxm nu1optelies s)srur( ono4olt  ocias aDraump t4alxrif todfmDe nei s)sexmirpoo1lleelnvtl(  2uax  ot0tlxnioctysfa2ul(mpnt4alxnirctodoa elneo;t  exrir3oo1ape  ivsl() rurx  ;t1oexn i3tad m2rm(vo;u) rxrxf3oy1opt lnes;(  2ur(r oy4lpen nci s)aDumx  no1altomfeiltla uan s;u4 ltrmfctydlm r ies s0s2ur(opoydaleelnctl(fa2trumpot0aee  f3tls a2eanvo u4 leoif3iydlp r u s s0s2xmxm nu4lmen ici t) 2raxr ot1aet ii3tysfmDumnvont4aetoxfcoo1fateaieo;()s2ur(mpoydolee iesat)sDtaumpnt4tet if3tldla2uln p;u)arxoifctodlm eln s (0s2uoxr3iydomen fcsls)sDururooo0opt mo3tytfm rau s t4tltoio ta1optelnvil( s2uoirpiodolt mfetl( sDuru  ;o1aex mf3iltls2ra( snt) rxoir3iotomtraieil(0s2xrxo no1ol nmfeia( s2ur(rpnu1aptnii3ilsfm rln s u4alxrxo3oo1lp rau s;t0 eumxo3ny1lpee fct s) Dtmu pot0teeoii3iaslmDrluvsnu4trxnmfctatlmteanvs;() 2xm(r3oo4amtn ivslsfsrtax  nt4tpe  icilslaDrm(vp;u0tetrmr oodfa rli ilt)trtm(rpio1lle mnesa()aDurxmooo4olt  o3ilslsDrm(mpn()arenmf3oadfa r nvi;t srxoxrpoudalee ncia() rtrxroou1tpe  ictatla2raumo;(4 rerxr iodlp elu o;s)teuoio oodol nlfcsl(f Draum oo1tetnmfeiasfa el(mo (4arxoxrcoadla eanes s0t2tmir3io4op emieiltfsrua( oou1aetnifcils sDrmumo;u0tlxrxocia1la  aneolt t2uoxmpiy4om   neias)s2ur( o;u4opxo oetasls rm(vsnt)texnxrcoytfa  anvs s0 rtr(rpnu4omtnlivs tfsDtm(mo;o0tlto o3iadlm rauvp t0teenxo io1laDran s s0trxrxm3ny4optnlnct s sDtrumono0oeeoio3iatfsDemnms;() rtrircootfmtean olt) rtr(rpny4ll   fvt tfs2rauro;o1oeeoii3iysls umums t0texriocoo1lmteanvs (0sruoio nu4om emnvs tfartm(m oo4oleo i3iatlaDuan o;t)tltoio3oydoat an o;t)s2to(mpiydomt  ici (faDua(mpnu0tltnmi3iys a ea(vo;t)aexomrctatfp elu s;(0 2trio oo4llenmicsat aDua(rpnu0tltnifetatls ra(vonu4trxrxrcta1lmDeanvolt seurimpiy4olee net s)aruax  oo0tpxnmfetysfm2el( o;(0aeermf3oytlaD  i sl(0 2toiopio1ol e ivi (fsDumur oo0opt moeiad s2rl(vsn(0 lerxf io1lat anesl()trxmio no4ale mfvsa(fs2raxmoot4olxn feiytlaDul(vp;(4artoxocia1omDranesl(0s2xoirpoy4olt  ncs tfarrru  ou0tlxo ociadfm rmuvonu) rxnmo ia1lpt luvi s0s2um(rpio1lptemnvs sf 2ua(  no1aptnii3ild s2ul(msnu4 rermo oadopte ueo t)teuriopny4lp nmivias  2umu  nu4aexnifeiydfm2rlnmo t0 rtnir3oa1lpD  uesl() eumxm oodapen nvil(fsDtmxrpou1apx  feiysfa rmuvsnu0aexrio3oy1omDr ueil()s2uoxo3io4alt  nes t)aDuaxronu1ape miciltla2eln s t)trenmr3todfateanvilt) rxmxm3iodamee ici (fa2raxrpou1oexo octad m2umu p;t)aleniocoo1lat aueo ()srxmimpiodameelictat)sDtm(monu0tpt  iciyt m2ea(ms (4tetomf iy1om  lnei s)srxo(rpny1lmenlnes ()sDurumpoo4tpt ioeilsfa2elnvs ()arermr3ootfaD anvi t)trurir ny4lmtelnvsl(fs2trx  nt0altnifetatfm el(vo u0trenxfcootfmtrlnes () rxoxopoodopenlivtasfaruaurp;u4teen i3tld m2rmums;u) lxoxfciytfa eluvo;s trurxm3io1omeelivta( a2rmu  no1altomoctlt s2ea(mo (0teeomrcty1op elivo;s)texrxrpio1omenlietatfsruaxmono1aptnmoctydlmDrm(ms;(4altomo3oo1fa   uvi;s0 exm(m oo1lp nmivsl(fartm(mpno4teenmo3tatlaDel( pnu4trenxfctotfmDe ivs (  rxr(opno1ap   fei t) 2uaumono1aet ioetasfmDemumsn(0 lenxo3ootoa r i s s) eum(opoo4aptnmnviatfsDtaxront1aex moeiltla2rau snu0texrxf3ty1lm e u s s)s2tmiopiu4omeelnesat  ruaumpnt0olx mi3iltfsDeau onu4 renxr iotlmDrli s;(  rtoxo oudlp e ivi () 2rm(  ;o0opxo iciadlmDea(vo (4teermr3ty1lpte u sl(0 2uoio oodop emnvtl( sDrrurpno1openmfetlsfmDemnms t4alenxr iatlat li olt) etmxm3oodamen netl()sDuax onu4olenio3iad m ea(mp t0 exrxr oydoa   nesl(  etoimpnodalen nct (fsrrm(moot0opt mi3ils a2rluvo;t)arxrmrciytomteln i s) 2xmim oudlm emncils  Dtrurpot1tet ii3tytla2rmnvsnt)tlxrxo3todlaDeanvs;(0setrim3ny4oltn fcil() rrm(r nu1tlen ietytla2rauvpnt0tltrxr3tytoatrlnei;(0setoirpou1lpe  fviat) rrru pnu0alt  ictlt s2uauvs;() eeoxf tytlaDe ivo;(  rurxr3iydal emnct s sDrrxmo;t0opeomo3tls aDel( on(4trerio3ty1fate i s s) rtmir3nu1lltemivias)aDumurpno0oltn fciadlm eaumont) ltnxf3iy1laDeai ils truoimpio1alee nesls) Dtrxr ot1tpt  oeiltfmDrm( pn() lenmrctytfateanvi;(0 exmim nudopeemfetls)arrrur ;t1tpeo oeiydlm uanmsn(4alenxfciy1latelues ()setmxopoo1ap   icias s2um( p;t1optn f3iys sDelnms;(0 lxnxf3oo1fmt aues (  euoxopio1al elncil(f Duau  ot0tpxn ictytlsDel(ms;t4aetnmrcoa1om  luvo t srxmxm3nu4lmen ietls)a2trumpnu0tltoifciltfa ul(msnu4areoir oatfmt ai i;s0trxmio iudalt mivsasfa2rau ono0tlx mociltfaDrauvo;u4altomf ia1lptraivo t) rxr(o3no4am e fcs (f 2umx pno0ole ii3ildla2ua(mp (0 ltoxrctatfm  an sls)t2um(rpiu4ape  net sfsDurx  ;o1tpt moeildla2ulump;()tltnir3iotfp   neo s0 rxrimpoudll   feil(  rua(rpou0tptn fciasfa2rmu p t4teeoxf ta1fat  nvsls seumiopno1op   neiatf Drax ooo0ale mi3tydfa um( s (0 rtrio oydlptr ueslt0srtoio iydlmtn iesa(f Dur(mono1tpx ii3tytlm eaump;u0 eerxr3tytfpDe iei s texmir3io4lltnmieilt aDuaxmpno1oex  iciys s emuvp;u) rerxociytomDr uvi;s0 ruoxo3oudlmt mfcs (  Dtrxm ou0tpe io3iltfsDumump (0trxomf todla elu il(0seurim3nodamte ivs s) rrauro;o4optn fetlslm rlnmp (4 ltnxo3io1opte nvsls s2umio3oy1llt  iet t)a2rr( o;t1tptnii3tltfa2em( s;()aleoxr3oadlmDeauvo () rxmxo nodaltnlivs t)sDtr(rp;u0tet if3iysla uaums t)texnmr tatlaDr nvs;s0texrim ou4ol elfet (fsrta(m ;o1tpenmieiatfmDrau snu) ltrxoctodomDeli s (0teuoir3oo1am nmieiatf 2um( p;o0tex  fetltfaDrmuvsnt0tlxoif3oy1opt lnvi s) etr(o oudalen nvtls  Dua(mpoo0tlxnmoctytfs ea( on(0 rtrmrciotoaDeau olt) eurxmpou4om nmnvs ( arumu onu4alenifciadls2emu o;u)trxnmr iadlm eauvols0texo(o iydapte neta()sDumxm ot0oeto ociysfs2el(mp;u) rxnxf ta1omDr ueo (0sexoir3oudolt lnct (  2tr( oou0teen fctadfsDeauvsnu) eermo oatlmtran ils)truoxm3oo4aptnmnctas sDrmumoou0apx mo3iydlmDraums (4tleoioctotfmDe n o;s0 2tmir3nu4omtemfctlt  2uru  ;o4tlt moeias aDrlnmp t4texnxrctotla r nvs;( s2umiopoo1op elfvsas)aDumum ou1aeeomociyd sDra(vo;(0 rerir3iytlmte uei;()sexrxmpnudom  mics s  rtm( ono1alt if3iyt a2em(msnt4aexnmr iotfm eauei;s t2xoxo3nudol   neilt)sDtrx p;t0opxo o3ilsfsDeanvo;u)teenir tydlmtr nvo;s  rxoxo3nu1oleelneil(fsruaxronu1open oetydlaDran o;u)aeerxo3oa1faD  ies t srxmxr3nu1amenmfvt (fa2tr( poo1alxomfeils s rlnmsn(0 rxomr3iydlpD lues (0setoim3nu4aptnmiciasfs2umx onu4aexo fetydla2rln s;t0trtoxo3oatfa r u ols trxoir io1lpeelivs t)srtm(r nu1tlx mo3tat s em(vo;t0 rxoxr3oytlm eli ols) exoxrpoy4al n iciltfs2rm(mpnu0tpeniocias a umn pnt4alermf3todopt aivo ()t2um(r ou4amtn fvtl( s2ur(ront1aexoii3iysls2ean p u4aetrmr totlate u s t)s2trim io1olenlfctl()s2raum ou1oet mictlsls2em(vo;t)arxrmociodopDeanvo;(0trxr(rpoudlleelnvsa()a2uaur ;t0aetn i3tytfm2rmu o;u4 exrircoadopDe ivo;t)truriopny4op   fvsa()aDuax  ;u4alt ifeildfs ul(vs u0artoircta1fp elu i;t trtr(m oodap nlivs t artm(r no4apt iictadfsDum( o;t4teeoxocto1fmtraies t teuoxr3nodlptnlfciatfs2rrxronu4oexomfctadlm ua( o u4aexoiocoydlat aneo;t)sruo(o3iudam n icta(f Drmxmono0aetnifetlsla2umnms;u0trerxf ty1fpte nvi s0texo(o oy4lpenmivtl() rrmx pot4teeoiicias s em(vs;u)areoxf3iatop rln o;t)srxoxm iydamtnlfetatf rta(ro;o0apxnmictls a2emu snu)altrio3iatoptr ueols  rur(rpiydllte fvtlsf 2rmxr ;u0aptomieiatfa2emnvs t0 eenxr iy1fa e nvil(  etmim3ou4oltnlfeiatf rtmxm no0tlt ii3tld sDeauvp;u)aeenxf3iy1fm  lnes;t0s2triopno4al elfeslt) Drru pno4aeenmi3iasfm rmnvo ()tlerxrctydom eanes;(0 etr(o3nydllenmfvtas arumur ot0optn fctysfa2rmn p (0areoxr oatfaD  nvs;()t2xmiopiu4al   nctl() rua(mp;t4tltnmicias mDeln s;u4aexoiocoa1lp eai i (0trtrxmpoy4lp elicsa()s2rruroot1aexn fciysfs2ea(mp t0aeenxfcoytlmtelivo s0truoim3oy4lp  lfcilsfa2uaxmono1tpt mo3ildfaDrlumpn(4 lxnir3tatfm ranvi;s0 rxmim3oo1omeelnvs ( sDtr(mo;o1tpx moctasfaDea( p u4aleomfcoydoptrluvo;t  rtrio nydllte iviat) Draumo;o1tetomiciytfa2rluvpnu0aeeoxfciadlat auvo;t)srto(m ny1aptemncil() Dum(  ;t4aee io3iatfmDrau pnu0 rtrmr3oy1la e nvo;() 2toxm io1apt mfeils)a2um(  ;u4olx mo3tldfm uau ont)arxomrcoadlm e uvs s0srxoim3iydllt mfvilt  ruax pou4texomfeiytla ea( s ()trermf iytoptraivilt)srumir iydlmen ivilsfsDuru ont0aetomf3tlsfm2emu o;(0 exnxfcoatlmDranvs;s0 2uoimpoy1omen fvi t)artax pot0alenioetadfa2rm(mo;t4arxrmo3iadlmt auvi t)trxr(m iu1ap emneils) rur(mont4tet  oeiadfs umn ont)tltrir3todlm elieol() exmxm3nodameemieia(fsrumxrp;o4tltnii3ils a emnmo u4aeeoif ty1lp eln ilt) 2xo(m3nu1lmt  nei ()aDrmu pnu4olxn ocildlaDelu p t4treomf3oodlpDeluvsl(  eurxo3ny4lp  mncia(farrr( pnu0aetoio3tytlmDelu snu0aeenxf oodoaDr neil()s2xoxr3ou4am n ivtlt)sDum(ro;u4oleomicildfa2elnmp;()aleomfcoytopDe nvs;s)srxo(o3oo1oleemfvilt)s2raxrp;u0tpx mfctaslaDuanvp u4trxnio3iadop e nes (  exo(m iy1omenmictltfsrrmxmoou4apxo fcilt s2umn sn(4tlenmr tatfa ean ol(  rtrxm3nydlpen nesl(f 2rrx  ou0tlen i3iyd sDum( p (4tlxomr3oa1fmt  uei;( setmxr3ny4olte fcsl()a2raumooo1tptn ieildlmDem( p;(4teeoio3ta1la e neo (  rxrir3iudoltemfct (fsDur(mpou4tlx  ocias s um(vp (4treoif3iy1fate ivs;s0 rumxrpou4llee fvsa()aDua(r ;o1opx mocildla2umums u) lxrir iadomD ai sl(0srumxo iy1llenmfeils)srrm(m no0olxoiieiltfa ea( p t0 lenxrctadlmDeluvo;s0srxmimpno1amen fvtl(  rtaur ;t1olenmietatla2el(vsnt4arxomr oo1oaDrluvil( setmio iu4amee fvi ()a2umuro;u0tet io3iydfm2eau snu4tltoio3oytom elies;t0 euo(r3oy1lle lncslt  Drmump;u4ope  icilslm raums u4tlxrmr3io1fp eaieo ( t2xoim3iy4ameemies tfsDrru ooo4oeeo oetydlmDuaumo u0 rxnmf3tydoa eln ilt)srtoxr3iu4op n nvtl(fsrtaxr nt0apxo feiyt aDeln p () etrioctotomt  nvo;(0s2umim iu4olt liesa() Dtr(monu0aet mo3ils sDemuvsnu0tltnxo3ta1la eai i;s sruoirpny1lm emivtl()s2umu  nt0aeen o3tlt s2rlump (0trtriocoodop ran i ( trtoxmpio4lmtnlfvs s)a2ua(m ;o1tpt  iciasfa2ua(mp;()tetnxo iatlm   ues;t0s2xoir oo1am  micia()sDuaxr ot1ope  fciad m2ua(vo u)altnxf3iytomt lueo;s) 2tr(o3oo1olteliesat arur(ronu4opx  oeilt mDumuvo;(4arxoxo totomtr neo;()tetmio oo4lpenmfvia(  rumx ooo1apenmoctatlmDum(vpnt0 eeomoctytfmD lu ils)t2xrir3iu1om  mfcils) rtr(ront4apx mo3ild s2ranmo u)aexnifctytfptr nvil(0 rxmxo no4om n fctatf Duaur nt1aptomfetytlm2uauvs ()arermo3oo1lpt  i s;( seumxr ou1lptnlics t) Dtrum nt0teto iciyd s2elnvs (0 etoxrcoytlp  lu i s0 eumirpno1olenmfes sfaDtm(mpot4oltomo3ils s ulu s;()altoifcootlpDrai i;t srtr(o3no4amtemietas aDrm(rpot0tleoiicilsfaDulumo t)tleoxo iytlpD li i t)texmxm3oo4olt lnvt ()a2rmur ;o4ape mieiadls elu s;t4trxrmr tytomDelivols0 2trxm3iudlmtemfcs ()aDtrxr nt0ale iieildfa2uan pn(0alxomr3oa1faDeai ilt sexrxo iu1ame  fcsat)aDur(rp;o4aexomf3tyt aDuluvp;t)artomf iatlp e nes;s0t2uoxrpnydaleelivtl(f rur(m oo0altoifeiys s2ran ont)trxoxf3oy1omDeln sls)srxrimpiu4ale  fesasfsDurxr ;o1tee ifeiysfs2uln s;u) rtrio3tydopt livsls0 2toxopno1lptn fet sfs2uaxmp;u1apx iociasfa ranmp;t0trtoifciatomD  i i s0srur(o3oydlptnlnet s aDrmumo;o0aexo feiltfm2eauvsnu4trerif3tatlmDr uvs;( s2tmim3nu1am  lfvsas  Drm(mo;o4ope mi3iltfs2em(ms;u)trenmrciytlate uei ()texoxr3iudamte fvtas arrrumpnt0tlto f3tyt mDul( pn(0teerxfcoodoat livi s trxrxopnu1lme livsas)s2umx  ;t1oetn octytlmDrmums;t0aetrxrcio1fptean s;t0s2tmxopou1lp emnvs t  rur(mpoo4tet  ieiyslsDul(vs (4 lxrir3tadlaDr ivo t) 2uo(r3nodlpee fesa()aDrm(m nu0aetnmfeiytls2rmumsnu0aeeomr3ta1fat  i sls0srumxr3iy1lm nmncs t  2ta(rpnu1oltoioetldfaDemumo ()arerxr3tytopte ueolt tetoxo3iudlle lnes sfartax  ;t0tetnifciydfs ua(msn() eeoxr3iadlmDranvs;s0setoim3oo4lp  lfvils) rta( pnt4opxo f3iltlm2eluvs (4aetnmf tydopDrlu ils0setoir3nydamt  nesl( sDtaumono0oeeo o3tyd sDeanms (4tleomfciodfp e n s s)s2to(o3no4ope  fvs s a2rmumpot1alxo ieild m2ulnmo;()areoxr3ty1optelues;() 2tmxm iy1om emivils)s2umxr nu0tpeomf3tldfa2rmnmo u)tltomo to1omtr uvs;s)sexo(mpiy4ome  ietlsfarur(r nu4alxomfctytlm2umnmo u0alenxo3tatfpDe uvi s t2urxo3ny1op nmfcsl()s2ta(ro;o1oleoifetytfm ea(mp (0aeenxociatfp raiei;s)s2umio3ou1ame miviltf ruauro;t4olx mfeils s uaumo;t0aleoxrciytlmteau sl(0 rto(r nu1lle lfcil( s2tr(monu1alt ioeiltfm2eln s t)tlenir3tadomDran s s trxm(m nydlp emfetat  Dum(  ou1aptoif3tldlm rlu pnt)aetoif iodfa  auvs ()teuo(m3no4olen nvt s)s2rr(m ou4alto i3tys aDuluvp u)tlermfctatfp e neo;(0 2to(r3iy4lm nmncs ( s2urxmont1oet iocildfmDuanmp t)tleoxf oy1opt lneol(0s2umxmpio4aleemiesl( aDuax  ou0texoifeiadfm emnvp;(4 ltnxociy1omtrau olt0 rtoiopoo1lpeemnesl(fsruru p;o0aetomf3iatlaDrmn sn()teerxrciydlmDran sls tetr(r3nu4lm  mieil(faDtmu  ;u0aptn oeiys a2uln o t)alxoio3to1om r ivils  2ur(o3ny1opeemnctatfsrua( p;u0oee  i3tat sDuan p (0 rtnmr oydomD lueo t trtrim ou1lleelnvsls)a2rr(  nu0optnif3iasfaDum(vp u)arxnir3oydfpDe uvils)trxm(r oy4lme livs (  2rax oou1olenmociat m2emnvpnu0aleomf oodop  li i (  rtoxmpnudllenlici t)s2um( o;o1tlx  octydfs2rln p (4 leoxf3iydfptrai ils)seumxopiydam nlictlt) 2taurp;o0openmo3iydlaDrmumsnu4tleomfcoo1oatr n o;t) etmxm oudaptnmfet (fsrtaxmo;t0ale mo3tatfaDel(vs;u0 lxrxrcta1fa rau o;t)srtr(r oy1lltnlfesl( s2raxmo;u4tpx ii3iltla emumo t4arxnxo3tydom elieo;s0srxmimpiu4optemict tfsrta(rpno0tle mfctaslm2uanvs u4 lxoif3iy1oate u i ( teumxmpnudoltnmncsas  Dra(m ;o0aex mo3iadfa2rau o ()alxoioctatfa r ivi t)setrim oudlme  fcs s)aDrmumoot4ope iieiatla2rl(vs;(0 rtniocia1fp  anes t) rtmiopiydamtn nctlt s2rax oot1apx  ieiasfm ul( o u4trenmr3oytomDr i il()t2xmxm3ou4lme lncta(fsDtau o;u1aexoiictydla2elumo t)arxrif3ty1latelivs () euriopno4ol e fvi (  Dur( p;u4aetnmfeiad m2rlump;u4 lxrmr iytomtraivi ( setrimpiy1op  lneilt) rtrxr ou0alxnioeilsfa2rlu p (0 rerir3iotfmDeanvo s t2tmxo3oy1ap emfesa() rrm(ro;u1tpeomf3tlsfa2eluvsnu4 renxocoatfptr ies;s)srtm(opnu4am n ieil()aDrr(r ;o4tetnmoctydfm eln p;t0aetnmrcoatlm  li i (0 2xm(o nu4omeelivilt)a2uaum ;u4olxn o3tasfs2ra(vp (4aetrxr todoptrluei t)seto(r3oo4amt micsas  rtm(  ;o0texn i3tld mDra( on(0alermo3tydlaD  uei;( trtm(m nu1am   iet sfa2umu  ;t1texn fctadfm2ulump;t)tltnifciatomtrli i;s)s2xoxo oo1olenlfeils)s2rruroou4aetn o3tls m uau snu0tlenio tadfp e ueo t)trxmxo3oydom elfet (  2trurpno4olen o3iyslm rlump;t) ltnif ia1oaDr ues s0tetrim3nydaptelfciatf 2ururp;o1tlenio3iys a2uan snu0aleomr ty1lm rln i;t tetm(o3no1om emfviat) 2uaxrono0oltniictldlm rl(mpnt4treomocoatomD  nvo;t) 2uoirpnodoptemfetls  rumumo;t0tlen i3tls a2elnvo;(0teerir iy1fmD an slt trtoxm iy4lme mfcia()sDrmxmpnu1tpeoiictadfs umnvs;t) reoif3todfp e i olt0 2toxm iy4omenlnvta(fsrrmxrp;o0aex mfeiad m2rl(vp;u)artnio3iydopteaivo t0sexrxrpio1aptn neils artaxmonu1ape  f3iytfs2eluvont4arerif oy1fmtelnei (  etrxrpou4ll elietls)arumu ont1alx mfciydla2ea(vs u0artrmo3ty1laDranesl(0 2urirpny1lpenlnvils)artrxmo;t4aptnmieiadfaDrmnvpnt0arxnxf3oodop   n s;t0 etoirpoy1lpt mfeia(fs2rrxmonu0tpxnmo3ild m2umu s;t4tlxrmrcoadopteanei (0truo(rpiudlp   fvs ()a2rax poo4tlen ieiltlaDua( pn(0 lenio oy1optr uvil(  etrxm3ou4ol elivtls srta(m oo1tlenmf3iltfmDumnmpnt4 ltnif totlpDrlies t)s2urxmpiu1al e fcslt)aDrmx ont1texomfcias aDrmnmp;u0tetoio3tadomte ivo;t0setm(o iodlltnmfesls  2rm(rp;t4opeoiicilsfa2eanvs;u)texrif tydoa  anvo;(0t2uo(r io1ope  neiatf rtrx  ;t4opto ocildlmDul(vsnu0altomocta1faDrli sls)t2xriopny1am nmnvsat) 2rmxro;u1opx ioeiydfm2rmu o u4 lxomo oydlpteluei;() rtr(r3iy1lp  livi sfaDuauro;t0oee ioetat sDeaumsnt0 rxnif3oa1fa ean s s0 rur(r nodaptn ncslt) rrmxmpou0tpen ietydfm uau snt)treoxo3oy1lmD  i o;( s2tmimpny4amtemfctas)aDumxro;u0opxo f3ils aDulnvo;u0alerxf3oy1omteluvs;t teto(r3oy4omt lnct s)aDrax  ou0opto f3iytlm em(vpnt)altrxocoy1fp eanei;(0 exm(o3iu1lltnlfvia( srrr(m no4oleomoeiys a rl( s;() leoif3iotfat lueilt  2xm(o oy1lpe lnci t arra(mpou1apxn i3iysla umump t4 rtnxo3oo1om eluvi t tetoio3no4llt micsls)s2ur(r ;t1aetn f3tat m2uaumo;t4 etoxo3oo1oate ivi ( s2to(o3oudlltnmnctl()srrax ont0alen oeiatfa raumo u)aexnmrctadfaD lu sl(0 2um(m iu1aleelfeils sDraurp;t1openmietadla umu p;u4 lxrmo3ia1la r neo ( s2tr(o3nodlmtnlivtl(  Dtmurpou4ape miciadfs umump t0artoxf iodfa eaneo;(0trtoimpoudlme lnvt sfa2rr( p;u1apxoioeias m ulnvpnt) renio3iytfaD aivo t) etm(o3io4oltnlfesl(f rtax  ;o4ope ii3iasfaDeanvo t0texrmo3iatfat lnei s)srxmxo3oo4lmenlnctas  2uau  nt4tleomfeilslm2ul(vp t0 eerxo oy1fp ranvsls)t2xoxo3nu4amtnmics () Dumx ono0opeomfeiadlsDelnmpn(4 rtnif3todfat  ieo;( t2uoim3oodlm n ieta()aDua(  ;u4oetnmictldlm2elumo;t)areomf3todoaDr n sls)tetm(opou4altnlics (farraum ;o1optomfciaslm ra( s;t4 ltnmr3iatfp  lies s  2xoxm ou4lltnmnct (faDumum nt0aleniicilsla em( p;t)trtnxrctodfa  livs;t  rtr(m3ou4lmt  fcs t srrru oou0aee ifeiadfs umn o (4 lenmo3ootlptr neols0 rxm(m3iy4op nmiei tfsrtmxroou0texnmfetld a2ulnmo () rxoxo ty1lp rluvols0 exmxo oodomte nctat)aDum(moot0aex  f3ilt s2rmuvs;(0tetrxocootopDr u ils0s2toxr oo1altnlfesa(f Drrx o;t0tleoiicias m2umumo t0aexrxf totom rlies;s sexoimpnu4am emfeils sruaum ou1tpx io3ildfa ulumo () lenxr3ty1la  anvs s0 rurim3iydlpt mictlt) Dtr( o;u4ole  o3tldls2elnmo (0 leoxrcia1fpDeau o;t0srto(mpiu1om  lietatfa2rr(m nu0aexoifciltlaDrlums;()arenxoctytfaDrlnvi (0s2toirpoo4llenlnetat a2ua(r no4tptn ieiyslm2rm(msn(4aetnio3ootopDeli o s) etm(r3nydlmtnmiciatfa2um(mpoo0oeeo ieiyd s2rmn s;t0arenxf3io1lptr ivo;s s2xrxr nydlmtnlnvi t sDtrum ;u1olxnifetls aDranvs () rerir3oytopDrauvo t0teurim nudlpenlfvils)s2uaumoou0olen i3ils mDemuvsnt4 rxrifciotopDe n o;()t2tr(o iy1ape  nvil()aDraurp;u4apxnmieiytfa eluvpnt0tlenmf3tadfm eli i;s  eurirpno1lmtelivtl() 2uauro;o0tpx iieiytfs ulnvp ()arxnmrcoa1fpDelues s0 2tr(o oo1aptnlnvsasf 2rmx pot0tlx iieilsls ulnvp;t) eeomr tadop rlnes;t)trtoio3nydlmt miei tfarrax ono1olx  f3iadfs2em( s;(4aetnir3iadomDeauvo t  eurim iodam n fviat  rtaxr ot1tee ioetaslm eln o;u4aeenxfctodfm elues t setmxmpnydap  mfvt sfsDrmxroou4tpeo fciys sDulu p u0arermf3tytoaD anvi;() eurxrpiodlmtemfesas) Draxr ou4tltnmiciatfmDelu o ()arxomrcoadom rliei;t seuo(o3nudlle mfeils)s2rrumooo1alt ii3ildlsDrl( p u) lenmo3iotfp  luvil(0 2tmio3iodalt lieil()a2tr(  ;t0oexoifetadla2ua( o;t)tlenxrcoadfpt aieo;t)t2trio3ny4lm  livtl()arur(mpoo1ole  f3iatfs ua(vs t)aetrxo iadlaD au i;s s2toir iydale miesl(  rrr(rpnu4aex mi3tys s rmnvont0artomrciytlatr ivil() rxr(rpio4ameelncil()a2rr(  ;u4apenifetas aDeanms t)altnxf tadfmDeanei;(0s2triopno4open fcs t) rtmx  ou4alt mociatlsDranmp u4texoxr3oydlatelueo (0texrirpoy1lm nmfes s)arrrumo;o0tee mf3iasls rlu p;u0texnmrciytop eanesls)tetrirpoudlm nlncta(f Draumonu1apxomfciyt m2eau p (4 rxrmo3oa1lpt  uvsls0teto(m3iudapen ivtl( artau ono4tlxomi3tytfs umumo t) eenmf3oy1laD anes;s) etmim3io4omtnlnvt tf 2tmump;t4aptn ietltfaDeluvs;u)treomf to1oa eaivi (0texrxr3iy4llt mfeta(fa2ur( pot1apxoifetyd a rln s u)alxrircoydlpte ies ( srxmim nydllt  nvtat)aDtm(  oo0tlen ietas a2uluvp () eenio iadfp elivi s0 exm(o iodamt mnci tfsrrrxr ;t1oltoiicilt m2em(vp (0aetnifcoadfp  lnesl(0srxmxo3oodale  ietas  Dtrum oo4ale moctydlsDeln s;t)aleoir oydfpDr ieolt) rxr(mpny1lp elfesls)s2uaxr ;u4tpeo o3ildlm eln p (0tlenmfcoydfmD aiei;t)seurxopnu1amt lfctltfsDtrump;t0apxoiieias a2umn o;u4trtoxocio1fmtraivsl()srtrxmpnu1op nlnvs (fsDra(m ;o1ale moeiydla2ulnmpnu)tlermrcio1lpDe u il() 2uoir3iy1om e ivta(farumu ono4olto ieiys sDum(monu4aeeoir3iadopD aivil() 2trxopnu4op  mfes tfsrrru o;u1aee mf3iydlaDrm(vsnt4aexnmrciadop rlu ils)seuoxm3oy1omtemivt s)srraurpoo4apt  f3tatlsDrl( p;()tlxrmrctotlptr n i t trtoxmpny4lmeemfviat) Drmumpnt4ape mocilt m uan pnu4 rtnxfcty1lm  aues;t)s2xmim iu1omenlnetat srur(r ot1oltnmoctldfa ranvo;t0 lerir iatfa rluvo;t0s2tr(rpoodam e nctat sDtm( ooo0tle ioctldfa2eau s;(4altoxo3oy1lmDeauvslt0 exo(o oy4op nmnvt (fs2raum ;t4ope  ieias m rlumpnt4trerif3tytla  an sls0trtr(opnu4ole mietasf 2ua(mp;t4opeo iciltla rl(vo;(0 lxrxf oo1op eaies;( sexmio3iy1altelfvtls  2uaurp;u0aexnmo3tatls2elump;t)alerxo3io1lmDr ueo;t)srxmxr3io4ap nmnvil( arra( oot1tex iociadfm ra( o (4 rxoirctadla  anesl()texoir iu4opt  fci t)srrm(mpou0tpx mfcildls2eauvp;(4aleomf oa1lptrlneo t  2um(r3iydll emiei (fs2um(m ;u0tet  f3tltfs emump (4alxnmrcoo1lmDeaueil(  rtr(o3no4ape mfcta( arrrxront1olt mi3iys s2umuvo t4arxnio ia1fmt  u s;(  exo(mpny1ap nmivsatf rurxmo;t0opxo octadla2uanmp u0 rxoir oadlpD ln i;s  eum(mpou1ll   ictltfarur(r ;u0ape ifetad s2emn snt) lxomrcoodomt ai i t setoirpiy4apt lfeiasfaDrrur ;u1tetn ociytla rmnvp;(0 etnxfcta1fmt lneo ()tetr(r iudap  lnciltfsDtau p;o0apenmoeilslm2ea(vo;u4 lerif3tydla eauvsl(0 etmim3nodolt liviltfsrtmx  nu0ape  o3tydlm2rmnvpn(0 eeomf tatfmt lu s;s) eumirpnu1apeelneils a2rau ooo1aeeomfcild s2el( p;u0aetrioctydoa elueol(0sruo(rpoudape  nesa(f Dra(mp;o4tltnmi3tls mDua(vsnt0 exrifciy1lmtr i s s)trxo(o oudlm   icilsfa2um(  nt1oleoii3iadfm rl( p u)arxnio3oydfmtranvi t)srxmim3nu4am nlfcia(  Drru ono1aexn oeiysls2ul(mo;u0 rxnio3oa1faDe ies;t) etoxmpiu1lpte nvias) 2rrumoou4aeeo fctadfm rlnvp u4artoif oa1opDe n i s  2xm(o3io4ap   nvia(faDtm( onu4tpxn ociltla2emnvo;u0 exomo oatlp  ln o ( teuo(rpiu4lp elneta( sDumxrono0olxomfctlsls2rmu snu)altoif iydomtelivi;s srur(opnu4ap e ieta() rtmxmooo4tetn octad a rmn snu) etnmr iy1opDrln i;t0s2uoxr3iydll n icta()sDtaum no0optnmi3iytfmDelnvp;() reoir3iadop   i i;t0truoim oo4omtnlfvt ()aDtrx onu0olt mfeiytfs um(vo u0 lermr tadoa r nvs;t  rurio3oy1alen feiat)a2raump;t4olto ietadfsDelums;u4 etrirctydoptran olt)srxmim iu1lp e neta()s2rmurpnu0teeo i3iat m2rmnmonu0artnmo tatopDeln o;s)srur(o3nu1ole lncsasfarumxroou0tlenmieilsla2ua(ms u) exomo iatfpt aueslt s2xo(o3ou1olt lnvtatf Dtrx p;o0opto octyd sDel(mo ()tleomf totoatelieolt t2uoxrpou1lmte nvtls  Drm( oot4tex moctat mDuan p;(0teerxo ia1fp  anei s0 exmxo ou1lltn nes sfaDtmxronu1opxoif3iat mDulnmp (4areniocoy1fp  aiei;s srtrxo iudaptn ivta( arum(ront0ope ioeiatla emumo;t) etnxf3tadlmt  u ilt0texoim oo1lltemnctas a2uru p;u1alenii3iysla2rmu s;t) exoir iytlatraueol()trxoxo3oy4optemfvia(f rrrxroot4aeenifciadlaDelump t) ltrxr iadlm r ieols)texr(o3iodal e ncsltf rra( p;o0ope mfciyd sDuanvo t) renmf oydfaD lieilt) rxm(rpoodlpt lfviasfsDum(mont1apeoifciaslaDrl(vp () lerxfcootla r u sls seuoxopnu4lpenmfcsasf Dumx  ;u4ope iiciltlm rlu onu4aexnmf3oo1laD  i o s)s2toxo iy1om n ietlt) Drau pot1aleniieiyd m2ranvp ()tlxrxo3todlm e i o;() 2tmio3nudap nlncslsfsDtrx p;u1opeo ietydls2elu o;(4aexoifctadfaD  ies t s2uoim iu4lltnmieta(fsDuaurp;o1tpenio3iasfmDum(vpn(0teenif3oodomtrli sl(0teumio3nodamt lnesatfs2trxm nt1apenii3iasla2ua(vpnu4alxoxr iy1faDe uei s) ruo(opnydopenlivil()aDrm(r oo4apxoifcilt a2rmu p;(0tlxoircoodomDrlneo ()s2tm(opiy4am emnet s)a2rrxmp;o1texoiociyd m um(mon(4trxnmr3iodlp rli i;s0srxmio iudol emfeslsf Drrxr no0oeen oeias mDra(vo (0treomr3iatlm  lu sls0setoxr ou1ope  netlsfartrur no1opx if3iadlmDeln o t0altoir iytop r nvo s t2xrxm3oo1oleelfcsl(f Dtrum ou1opxnmocildfs2eanvo;(4 rtnmo totfatr ivsl(0sexoiopnydome mnetl()sDururp;o1oexoiieiyt mDeluvs (0trxnmo3io1fa  lu o;t0 rtmxm3iy1ameemfvs s)arta(mono0aexnmiciadls2rm( s;(0areoxfctytoa  li s s)seto(opiodopenlnctasf 2rruroot4oetnioeiasfa rlu o u4 exnxf3iydfmDrau olt0seum(rpou4lpeelfctatfs2uau o;t4texomoeiyd aDumumo (4tetrio iytoptrai i;s t2trxopoodame  ncsl( a2tmx o;u0oex mieildlaDea(vsnu0altrxf3iydopt aneolt0s2xmim nu1lm  mnciasf Dur(rooo4tlxo i3ildlm2rl(ms t)aetnxf3oytfpDraivil( t2xmiopnu4om  lictlt a2ra(rpou4oee  i3iydfmDum(msnt)tlxnxr tadoateluvi (0trur(r oudlptelfcs t  2tmxr oo0olt mo3iaslsDrlnmo;t) renxf to1lateln s s0sruoim3nu1ale  fvias arraxm ot1tet  fetldfs2em(vsnt4aeeomf3ty1opteaies t s2trir nu1opt  fci tfa2raxm nt0oetnmo3iytla2rmnmp (4aleomoctotfat  nesls)texrxo nu4opt lfvilt)s2taurpnt0aeenifetatfm2ea( onu0 ltnif oy1fm elivi;( trxrirpoodom nmnei s  Drrxmonu4oetnmieildlaDrau sn(4 etnmfctotoa e ivo s)srtoir iudlleelieia() 2umxmooo0tlxo f3iatfmDel(vo;(4 exnifcoadom  luei (0teuoxm iudlm   fcsas)sDrrx pot1altnio3tasfsDeanmp u4aetrxr oa1fmDeanvi;s0s2xrxmpoy4ll e fvi (f rurx oot1alt  fctys a emnmsnt0trxoif iatlpteluvils)sexr(r3ny4ol elieia( sDua(rpoo0ope moetadlmDrmumont4 eerxf3oy1opD lu olt s2uoim oy1altn ictlt)sDrmx  oo1oltomietltfm2ea( s;()texrirctadlmD  ueo;t) 2tr(opiu1lme mivtls sDtmxmpot0aet if3iaslm eln p;u4 exnmr3to1fpDrlu s;s) euo(o iu1olt mnctlt aDrm(moou0ole mfciatfmDea(msnu)aetoioctotopDelu slt)setmxo io4lm  mnctas  rua(r ;t4opxoif3tatfa2ra(mo;t4 exnmrciatfmteluvilt)seur(m iudll  mfeia(fs2rr( o;t0apxnioetltfaDuln o;u0aexrxf3ootoaDraueilt0s2xoxr3oo1olenlics t)aDtmxroot0tlt iocildls rm(mp;() eeoir iadlp  lueo;t) rtoim nudopt  fvtasf rtrurpou4oeen ociltlm2umnmpnt0tlerir3oydlmtr ivils)srxmiopoy4ameemnvia(  Draumono1opt  icildls eanmsnt4alenir3tadop rln s s teurim ny4amtnlfesas) rtrxmpou0tle  ociysfaDrmu snt0 eenmr iotom r i il() 2xoxo3no4omeelfes t  Drr( oot1aexn oeiasls2uanvp;(4 rxomr3oatfmt auei s sexr(m nodalt mfcs sf Dumur ;t1opxn ocils m2eln o u0 ltomfcto1opt  uvsls  rurxrpnudom n ieslt)aDra(  nu1apen oetlt m rlu pnu0alxrifctytom elueo (  2umir3no1lptn ici s)sDrru onu1oex if3tyslsDum(vo;(4tetoxf to1fmDelu ols0 2trio iy4lm n icil(  2uaxr nu1oltomoetldlm2emn s;u)tleoio iydoaDraies;s) euo(m oo1altemfcs t  Dumxm nu4ole  i3iyt aDum(ms;u4tetrxf3oa1fa rlnvo;t) 2umxopnydom  mfctat) Duru oot4oltoiocias m2elnmonu)tlxnxo tadlatelnvs ( s2urir3nu1al  mnvi () 2ur(m ot0olxn oetytlm2rauvo u0alerifcto1lpDrlieolt) rtoir no1alt mnvsl( a2rmu pot4oeeomf3tytfa umnvs t4artrifcia1oat aues;s) rxrir3nydapen nei tfsruauroot0oet io3iltla ra(mpnt)teeomo oydoa elnvo t)trxmimpiydomtelnet t sDtm(m ;t0opxnmo3iasfa um(vo;t) renmr3to1fmtranei ( s2urirpnu1om  lnvtasfsrtmumoot4oeenmo3tys mDrmn ont) eeoxf3ta1oa  lu i t)teurirpoo4am emfcs t) rua(mono1aet  ociadlmDumnmpnt0 rxnircootlat lueo;s)teur(opiu4altn nvt t arrr(rpoo1altoifetyt sDel(vpn()alerxr iodfatr nvi ()texoxmpiydome  nctas  2umx pnt1tet  fciyt s ul(vsnt0aexrxf3totlmte ivsls)sexrxr3iu1ol nlicta(f Dtaumoou4alxniietytfa eau p;u0alxrir3iytoate n o ()t2xoim3iu4apenmfcsatfsDtm( onu4opt ioeiadlmDrlu ont4tetnxf3tadoatran s t0 2uoim3oo1ale lfesls)srrrurooo0tetnif3iltfa ul( ont0altoxf3iadoa rai s s t2uo(opnudop   nctatf rtauront4oetnmietydls emnmsnt4 ltrxocoytfptran ol( srtmxr3iy1lp n ies ()s2tmu  oo4aptnifcildls2ea(ms u0arerxr oydlmDe n i (  rtrxr3nu4lltelncsls) 2ta(mpno4oltnmocildlmDrmumon() rerxo3io1faDelnvsl(0 rum(opou4optnlfvt t) 2uax onu4oexo ieiys mDrmu s;u) eenxocoydlmDrai o;s  exoxm nudlmen fctls)sDrr(rp;t4aet  i3iytfs rauvs t0aeeoxfctydfpt anesl( trxmim nudole lnvtas srtmxroou0tetnmociadlm2ea(monu0tltoxr3iydfmte n s s0sexrim iudllt mnvsas artmu  oo4aexo icils sDuanmo t)tetrif3oa1lmteai s;s0t2tm(rpnodol nmnetlsf Draumo;t4apt ii3tlt s2uauvpnu0 rerxo3iodfmDeaieo s t2uoiopou4ap elnet () Dur(mont1aee iiciad m rluvpnu)aetnxr3oatopt  nes;()seurio iu4om  mfesat a2urxm ou4tlxnmi3ildfm2rl( p;t)alerif3to1fp  lnvs;() ruo(opiy4lm  lfei sf rrmur ;u0altnmoetadla eaumsnt0texrxo ta1faD lnvs t0trurio3iy4lmen iet s  2rr(m ;o1olxomfciad mDumnvont0tleoxociatlat  nes t0srumxopno1om   nctat) Dtax  ;t0aleomiciydfa2ea( o;t0teerif3tytfpDranvs;s)srxm(o iy4lmen nei sfs2uaumpnu0ope  oetyd mDulu o u0texomr3tydoaD aivilt)trtrim3oydapen nvs ( sDrau  ot1aeeo ieias a em(vsn(4 rtnxr oo1oat luvil( trtmxmpiy4opeemnetlt artrxrpot4apt ii3ildlaDeanvs;u)tltrir io1lm e ueslt0s2xoir io4alee nei s)sDra( ooo0oetnmieiys aDemn p;t)aetnmociotfmDrai o;(0sexoxopny4alt mieilt)srtmxrpoo4oetnmocildlm2rau s;u)trtomf3todfaDrauvi;s)srumir nu4lptnlfcta( sDrmu pno4alx mocilsfs rl(vp u0aeenxr3ta1op rlu s;t0s2trxm oodlle  net t) rrm(mpoo1tetoioeildfs2ulumo u0arenmr oatoatr ivo;t0srtrxr3nu4lmen nvi ( sDuau poo4oeeo o3iatls uau p;u)tlxoir iatopt  uvs s)sexmxo3nudlmte fvias)sDum( pou4opeo f3iydfs rmn p u0 lenxf3iodlat luvo;(0 2toir3ou1ap nlnvtl( artrx  no1apt mo3iaslm2ra( o;u0altnif3iydfaDe neolt srumxo nodlm nlfcia()a2tmur ;t1tpt mo3ilsla ranvp;t0 eeoir3oodfm rlivi;s)srxmxrpiydopenmiviasfs2taxront0tpxomiciad m2el(vp;u0arxoxfcoytfmtelnvi t seuoirpno1lmtelfct s arurxmpnu1ape iocilt a2rl(mp u4tlermf3oadlm rluvs;s  rur(opnodap nmivs (  rrrx  ;o1alt ii3tas m eluvo t0trtrio3oodop r u s t0t2tmxo nu1ol nlicilsfs2ur( o;t1oltnmo3ils mDel( on()teeoxo ootomt lnes;(0seum(o3nydll n nvsatfs2ta(mp;u1tpxo o3ias a2rmump;(0aetrxocoa1lp raivolt) rtr(r ou1open fesat) 2raxr ot4tlx ii3tatfm2em( o t)trenxfciotlmDeln i;t)setmirpoo4aptn fciatfs2ur(r nu4alx if3tltfm rl( o u0arerxr3ia1oaDrai sl(0 rurimpiodap emfeia()s2umu ont1aet  oeiysfs2el( ont0altnio iadop e u ols0t2to(r oo1omt micilt aDuaxrpno4opxn octad aDran o;t0aexnmfcoytlm eluei s0 2xm(m oydlme mfctl( a2uauroou1open i3iytlaDrmn o t0trxrmr iotfpt  ueo ()sexoir3oo1alt mfvs (faDrrxmpou1aexn o3tatfs2rmu pn(0tltoifcoydoa  an o t0srxoim oo1ape  fvt ()srra(m ot4apxomo3tatlaDumuvsnu)areomrcoodoa e uvo t t2ur(o3ny1lle  nviat arrmu  nu1oetniictadls2emuvo;t0tleoif totlpt aivolt0srumxo3oodop emivtat)s2rm(  ;o0apt  feildfmDuanvonu0 lenirctadfa e u s;( srxmio3iy4olee nvi tfaDuaxm oo0aetn ociadfm uanmp (4trerxfctydlmt lnvilt0 rxriopoo4lltn iei (  rrmu o;o0tlt moeildfm ea(vp;t4aexnxrciadfptrlu s ()trurirpoo4ll emies t s2taum ;u0opxn i3tatfa rmu s u4trxoxr oatopt lnvi s0sruoimpno4lle  nct t)sDrm(rp;t0oet  i3iydla uauvonu0aetoiocoytlmtr u o;s  rxrxrpnu4ll emfvils) 2umumpnu1alto fciasfs2ulnvon()aexrif3iydfmDeanvi;t) etm(o3io1al emncil()aruaxroot0tpeoio3iatfmDra( snt0 lxrxo3tytfmD anvilt)seur(opoydlp n fvi s)a2tr(r no4apt  f3ildlsDrlnvpn(4 etrmf oatfaDrauvol() rur(m3oy4om elfviat)sDuaxmpno1tpx iieiltfa rl(vsnt4trtoif tytla rlivils0sexmxm oy4ope  fcs tfsrrrur ou0texomfeiydfs ranvo;(0 ltomo tytoaDr n i;t0srumxm3oodlltn icsls)sDtm( o;t4tex mfetltfm ran o u)alerif ia1lmD  n i;s trxo(r3oo1ome  ictas aDtrxmpno0tpx  iciytla2uau p;() eeomo iy1lptrlu il() 2xr(o iu4ame lfes tfsrraump;t4aexomi3iyt aDul(ms;t0alermo3tadfmte nvsl( srum(m3oy4olee feslt artmxr nt4alxn octadfmDum( pnt0aeenio tydlm e i i s0t2xoirpio1aptnlfei s srum(r nt4tpt iociadfm eau on(0aexoio tytoa e nes (0 2trxr iu1op  mncilsfs2ua(r oo4opxnioeiadlmDemumo t0tleomr3iy1fmt  iesl( setrxr no1olenmfcsls) 2tr(ronu0ole mfctls aDeanmo;(0 rtomr io1la elivo s0setmio3oo1optn nvsl( a2tmx  ot4oexo oeiltlm2ulnmp;t0trxomr iodopteanes t0 2umxr3iy1lmtelfvtls) 2rmxrpnt0tpt  i3ias aDrln o ()aeermf oydla e n i (0t2xoxm iy1opt mieiasfsDrru pnt1tlt if3iatfa2emnmo;u0tetnio3ty1op r ies (0t2xrxo3iu1lp nmieil(fs2tr(  oo0oetn i3tlt aDuluvo t0arxrir iotlpDeli ilt0s2toiopoo4op elnctls srrm(m ou0olt mictldlaDemnms () ltnxf oo1oate u sls trto(m oy1op nlfvtlt  2ta( ono0texnmfciadla uaumo;t)tlxnmf oodfptrlu il( trtmxrpiudalt mncil()aDrmurooo1teeoifetlsls2ul( snu0trxrxocootfmtr ieo ()srtmxm3nydam  mfvtl(fa2ra(rp;t0altoiociytfs2umnvsnu0 eeoircoadfatran s t s2toxr3ny4lptnlietat) Dtax pou0oeeo f3ias s2ua(vo;t)tleoir oatopDeli s;( trxr(o3no4om nlncia(f rrmxmoot1aet mfcild aDrlnms (4tltnxf iodlm  lnvo;(0t2uoxr3oo4oleemfvilsfaDrax pnt4aet ioctatfa ulumo;t4 renif3totop r ies ( seuoxo3iy1ame mfcil()artau pou4tetn oeiytfs rmuvo;u4trxnmr iadfmtrln ilt)t2urxr ou1lleelfvsl(f 2rm(  oo1tptoifeiatfs2ul(ms t)altnmf3todlmDrau sl(0 2xrim3iodam nlict s aDurumpnt1olenmfciydfa2eanmp t4teerxfcoa1fmte ueslt) 2trim oodapt mivtl( a2taumoot0tlxn f3iatla2umn pnu0 exnxr ty1la  lu i t0 exmxopiu4oltemnvs (f 2trx onu4opxnmieiat a uanvs;()teerifcoodfatraieo;t0 eumio no1al e ivs t  2umum nt4opt mictlslm2rm( s ()artrif io1opDrlieilt0 rto(opiu4ope  ict sfaDtmxmooo4alxnifciadfa2elnmsnu4 ltoir oytopt au i;s0t2xoim nudal nmnet tfa2uax ono4opto i3tasfmDrl(vsn()treriociy1fatrlues s trurxmpou4ole lfci t)a2ra(m no4aet ifeiasls2raumo t) exrmocoadfa ran o t0 rum(rpiy1lpt  ieia() rtmxr oo4aptoio3iltfa2rmu p;t0tltomr oy1fat  neo;(0 rumio ny1omtn fvi sf 2umx oou4aetomi3iyd m ra(mo;(0teenxfciytfmte ivsls teurim no4am  lnvia(fa2uaum nu4texnmf3iysfaDem(mp;u4trxrxf oy1lmteau i;s) etm(r3nudom e iet () 2trxr ;t0aeenmfeias s uau on(4trtomocoatoa elies t0tetoxr iy4omenmneil( artaxmo;o1alenii3tatls eluvo;t)trtnio3tatfa rlu slt)teuoxr nu4optemfet t  Duaxm oo0apeniictysfaDeaumsn(4trtnmr ootoaDean i s teumirpoy1ll  lnvia( aDraum ou4olt mfctatfaDuln s t0texoxr oydfm rlieo ()srtoxr3iy4omtemnvtl(  Dtrumpot0teenii3ildlsDelumo;(0 ltrmr oydop  lu olt0srxr(o3no1al   nesa()s2trumpnu4ope mi3ias a2um(vs ()trxnmocia1oa  lu s;(0seurxr ny1op n fvi s)aDuaumont1tpxnmietyslsDrm(msnt4tetrir3iatlp rai i;t0tetmxr io4ol elivt t s2um( ono0aexn ocils m ua(vs (4arerxocoatfaD  u o;t)srumir nodlm nlfcs (f Duax  no1olx  octldfs2eanvonu)artrxf iatlmt auei t0s2tm(m3iu4amt miesa(f Dtrxm oo4opt mfcild mDua(ms ()texrxociytlatean i;t0 rurxo3io1olen nvta( artr(m ;o4olt mociadls2rau onu0 lxomf to1fm  lnvi;(  eurim nu1aleelivilt)srtmurpno4texomiciyd s2elumpn(0trerxfciy1lpDe ieo;( sexoxrpny4lltemfvia(fartrxr ou1alxomo3ild aDraump;t)teenxf3totfa rlivs;( s2umim3no4am emfci ( srtmxrooo0tet moctldla ra(vp;(4 eenmr tydfa rai i ( teuoio3oo4lm  mnvtl(f Drrxr ou1aetn o3iys sDranmo;t4 rerxo3ta1lptr n s;t srxo(o nu4opeemfcs t  rta( p;t4alt  f3iysfm2eaump u)artoif tatopt lnvi s)tetmxo ou1om  mfesas)s2taxm oo4olxn oetat mDea( on(0artomocia1fa  aivi;t) 2trir ou4omee nesa(f 2rmxmpno4texn icildfmDra(msnt0aeermf totfp rlivi;s0t2xrirpiodopt mfci tfsrtaxr nt0apxniocils s eau p u0trxniociy1lmD  n i;s)seumxo iu4ap emfcs t)s2ta(mo;t1aexn ieiyd m2ea(mo;() rerxr3tatlmDrluvilt)trtm(o no1omtemnet (faDuru poo1teeniictydlm eluvonu0 ltrio3iadfmDe nei (  2xm(r io1omt mfei s  2um(rpnt0opx mi3tadlsDeanmsnt) eerir3iodop r i o s  exmirpiydlle mnet sf 2rm(r oo0oetomfeiydfmDrm(vo;()trerxo3tadoaDeaueslt tetr(r nydlpeelfvs sfsDtrxmp;u0tpx  ieiatla2emn on()trxoxocta1fatr iei t trxoxmpny4alt  ieta()sDrax o;o0alxomoeildlaDulumo;u0tleoircta1oaDeli o;(0srtm(mpiu1omtelieil( aDururoot4teeomiciytfm2um(mpnu4areomo3totfp  ai i t  2xmxopno1omt lfeslt  2rmur ou0tlxn fciasfs2elu p;(4 etrmociodopte i s;t tetm(r oo1ap n icias sDuaum no1olxo fetadfsDea( pnt) rxoif3iodlptelueslt0s2urxopoydlltnmncias)s2rrxmp;u1ale io3tyslaDra(vo (0 lxoxfciydfat  neo t0t2uoio oo4ll elies ()aDtm(rono4altoiiciad m2ulump t0alxoircoydoatr n s;( sexoxr iu1ame  ivt tfarrrx p;o0alxomfctysls2ua( ont4arerio3iadfm r nvs;s)s2triopoy4am e iet s)a2tm(rpou0alx iieils a rau p u) lerxfcoadlpDeau il(0seurir3nydll elnctatf rurumpou0tltnmfeildlm ul(vpn(0 renxr3totoaDeli i;s)t2urxr3oy1omee icias srtaurp;u1aleoif3iyt s2ea( p t) lenirciadopDe ivils0sexrxrpny4lm n feiatf rtaurp;u4opxn fciatlsDeluvpn(4 rxrmrcoytopDe i ols)truo(m3oy4olt  nvt t)sDumxmp;u1tptn fcias mDrmump;t4aexnxoctodlaDranes (0teuo(r3oodll nlncsa( aDrrxmp;o0teeo fetyd s2rl(vo u)tlermfcia1oa elues (0 rurxmpio4apt lnvi ()arrmumoot0tlxnioeiadfm rmu p;t0trenmrctydlaDe ieilt0teumxmpiydol nmiet () Dur( ooo1tltn ieiatfmDuanvs u0 eenxrcoadopDeaneslt)srtrxopou1ap emnvta( aDuru oou1tpxnio3iytfs2ulu p (0 lenio iatom  lueo;(0t2xmim oydllenmieil( s2tmu  ;t4altnmociyt m2elu p;()aetoxf tadlateanei;s)s2tmxopny1am nmfeias  2tm(rp;t4opt miciydfa eaumo;u0aetoxociadfmDe ivo s)s2xoxr3ny4lpte fvsat  2tr(r ou1tpt mfctytlmDua(mpnt4aexrxf3io1op  lieslt0srur(r3iu4llenmnet t) Dtax onu1tlenmf3ils m rau s ()arxnxfciodoa eliei (0s2trxm3nu4lm n fei s)artmu poo4alto i3tysfm rm( ont0 rtomf ta1om e n olt srum(rpno4lp  mnvi s  2rmx pno1oltn feildla eaump u4arxoxf oytlp r ies;s tetm(mpio4am n nvs (fsDtrx  ot0texoifetls aDran p t)altomf3ootfa rau o (0s2to(o ny1omenmieias)sDuaxrooo4tpto icildla2rluvo (4tetoio ootla rlnvo (0t2tmio3oydaleelnvtasfa2urxro;u4alx mo3iyd aDuanmo;t4 eerxoctadfmteauvils0 eurxm iudoleemictas s2ta(roou1aexoioetydlm ranvs ()arxrxr3oy1omDeau olt)srtmimpoo4lleemncsl()srrrurp;t4alen o3tyslm ua(vpnt)altnio3tatfp  ln o;t)tetrxmpoy4opt  nci s a2ua(r ;t1tpx  octatfm ranvon() rtoxrcoo1op eln olt0seuo(r oy1lme  fvsat artaurpnu4apxomoeiyt sDrmn pnu0artrxfcoadlmD  nvi s) 2urim oo4ll  mivslt)srurum oo1apto oetas m rlump t4teeoifctydfpD lies t srto(o3iu1amt  fcilt arrr(m ot1apto ieiatfaDrm(vo t0aetniocio1fpDrauvi (0t2uoxopoo4lm   ici ( aDtmxmpno1apt moetltla2rmnmp;u)tlenmr ta1oatr uvs;(0sruoir3iy1lm emfvtlsfarta(mpnt4olto f3tldlmDrm( o;(4tlermo oatlmDe ues;s)tetoxm3no4altemicsls) 2ta(rpno4altoif3iyd mDul(mo;u0aetoif3oadfaDeauvsls teumirpnudamtnmivsls)a2ur( p;t1olto oeilslsDrmn snt4tltrxf3oa1lm r ivil(0s2ur(o iu4ol nmfvta(fsDrau  ot1aleoio3tlt a2emnvp t0 eeriocty1oa  au o;t0t2tmxm nu4ll nmnes s  Dta(rp;t1opeo icilsfa2ranmpnu0artomo3oo1oaDrlues ()t2xoxrpnodomtelfvtls sDtaumonu4apeoif3iadla rmuvp;t0tetoxrcootlpt an s t trtrxm3no4olte fvsls)arumx oot4tetnmo3iatlaDelnvo;u4aetomr to1lpD  ueo;s0 rxr(opiu4am  lies ()artmum ot4tleoiociat a2eaumsn(4 lenmf3oytla e ues t)trtoir3iudamtn iei sfsDumxr no4oee mieiys m2ra(vp (4tetnxr todlmtean ils s2toiopny1om   ieia(faDua(r ;t4ale iociadlm emnvo;t0aleoxf3oy1omDelueols s2toiopiudlme miciltfarumx poo1aeto ociatlm2ua(mo;u4tleoxf3iadlpD au sl( teuoxopiodol elfvtl( sDta(mont0tlt mfeils aDua( snu)aexnmo3oydoa eln i;(0trtoim3oydlme  fct tfa2rmu onu0oexniociat mDel( pn(0alxnio totlm  lnvi t s2xmir nu1opee iviatfaDua(rpot0aetoiiciysfmDrlnmsnu4tlenifctotfmD aueo () euoxr nu1alt lnci () Drmu o;t4opxnioetls m2rmuvo;u0alxnmo to1op ran slt0srtoim oudalee ncs s)aDuaxmp;u4alt ioetasfa ra(mo;u4texrxf ta1fptr uvs s0 rumxopiodape lfesas  2tm(r ;t4olt moeild m2ea(vs (4tltnxr iadoaDelues s teuo(r3oodolte ici sfaDuax  ;u1tetnif3iys aDrmnmo;u4 eerxo3iytop r ivol(  eurimpnu1ape lietlt)a2rmxrpot0oeen ieiydlm uluvs;t4 rtrirciotfmt  nesls0 2um(o oo1om emietl()srtau  ;o4oltnif3ils a emnvo ()artnio tadlmtraues;(0t2to(m ny1op emfetlt artau  nt0aet ifctlsfa2rmnvsn(4 eenio iydfa rluvs;t0 eurim iudale  netlt artr( p;o1olx  feiysfaDra(vs;u) rxrmr iytlmD lnei;() 2urim iodlpeelicils  Duru pou0apeoioetatfa2um(vs t0trxrmfciy1lpD aivilt0trum(opno1ll  mnvtl() 2tm(rp;o1oetnmi3ilsla ul(mp;(0 etoxociy1op  lnvo (0 rto(mpiodol n fciltfs2tax p;u4openmictldfa2ulumonu0aetnmo3iytlmDelivo s0s2tmir3oodome  fetlt srua(rpou1optn f3iyslaDuluvont4alenxr tydomDran sl(0srxr(mpnudaltnlfcsatfarrm(rpno0ape mfeiltls2rln onu)tetomrcoytfmt lnvo ()s2xoxm iudaleelfesls s2urx ont0tlxoiociys a2ul(vsn() exnxf3tatla rau i s t2uo(o nodlltnmfcslt srumxm nt0oet mfcildlm2ulnvp;u0trtnmocoytoa  lueolt0 2umiopnudomte icslsfa2ur(rpno0tet  ociad s rm( s t)teeoif3iytlmD lnvs;s0t2umxm3ny4olenmfvs ()a2rmxrooo1texn octytfsDel(vs (0 rerifciytlmt luei t  eur(m3no4lpe mnvsat sDtmx o;o4aeenmfciat m2rl(vpnt4 eenircoytfmD aueo;t) rurxrpoo4ole lfeiat aDumx ooo1tet mf3iatfmDeanvon(4arxrmf totopDraivi;s  rxmio oy1aptnlfesas aDuau onu0aeenii3iyt s elumsnt)arenmf3oodfp elneo;(0setmxo iu1op  licta(f 2tmurp;t1opeomfeiatlsDrl(msnt4 eenxo3iatom e nvol(0t2xr(m3oodom  lfetls s2rau p;t0openii3tad mDulumsn(4 eermf3tytlat lies t  2uoxopou1olt mfeias  2rrxm ot4oltoii3iasfsDran ont)arxrio3oy1fateli i s0 rurim3iu4aleemfct t a2tr(rp;o1oeeomfcildlm2ranvp u0 lxrxf iodopteln o;t tetoxr3no4amee nvs t sDra(mp;u1tpe mieilslmDrl(vo;(4aetnxfcia1oaDrauvsls) rxriopoy4op elfcs s aDtru oou1teeo oetyt aDelnvsnu0tetnmf tydlmtranesls) ruo(o3nu1altelivt s)aDtm(rooo0texomo3iatlmDemnms (4arenmrcta1omDrluvo s s2uoxm3oodopen ncslsfs2urxmoot4apxnmo3iytlm uluvsn() lxnio3ia1omD  n o ( t2xoxm3nu4lltnlfcslsfs2tmum ot1opeo o3ild a2em(mo;()arenxr3oydoate uvo ()t2uo(r ou1lm nlivt sfaDrrum no1oetnioctls a rmnmp;u)texnmfcia1oateln ols0 rtriopny1amtnmfciasf Dtru onu0tptnmoeiat a2eauvs t0 exrmfcio1fatrai o ()trurio3iodlltnlics (fs2urur nt1tlxn i3iadfm uauvonu4teenirciatlm rluvsls0 etrir3nu1ol   icia() 2trxrono1aee mo3tltlaDum( s;t0 etnxfciotfpD au i () eto(mpiudame mfvsa( sDrr(r ou0tpx iieilsfm2ulumont4 rtoxf ootfatr neslt)teur(r3oo4omeemnctat)a2tr(mp;t0aee mociatla2ulnmp t)aexrmr3iytlp rlneo (0 rxm(o3nudll nmici (f 2raxrpnu4apxomieils m ulnvs (0 lerxr3oodomtraieo;t s2tmimpoo1olee ncsat)s2tm(m oo0opxn ociyd s elnms (0 ltnxfctotlaDrlieo;(0trumxrpiu4lpee iviatfaDra(m ;o0tetn ieiytfmDuan o;u4aexomo oo1fpD lies s0tetrxr io1am  livtl(fs2rmuroou4ape  fctlsls2uln s ()alerir3tadfa elu il( srxoir nu1lme licilt a2uru  ou1ope mictadfsDul(mo u4trxnmr tatlaD aueo;()srtoxm3oydlm nmncta() rtmum ou0tlx  fetad m2umnvp;()aeenmo3ootfat lnei;t srxrim iu1llenlivs (fartm(m nu0oleniictadfm ea( onu0 rtnmo iy1lmD lueo t  rxoirpnydlm elietasfa2rrumoot1tpe mfeiat aDrmnvsnt4teerio iatlateli i (0 etrim3oy4ol  mnct ()aDrmum ;t4tltomfeiatla2elnvsnu4 eeomr3tatfpt lnvsls)tetmxrpou1apeemfei ()arrax p;u0tpe  feilt a2rmn p;(0aleoxrcoytlmDrl
\ No newline at end of file
@@ -0,0 +1 @@
+n o ()s2xo(mpiudope lfvslt)sDtmum oo4tlxnifciyd s eau snt4tetomo iodom eauvs (0t2xr(mpio1lpt lfesl( srrm( p;t1tpxn ociad sDrmnvp u4 leomrciatfptrai ols0srum(o oy1altn ivs t  Dumx pou1tptn f3iadla em( pn(0 rtoxfciatlmD  uvs s s2toxopiudom  lfeilt)aDrrur ou1tlx  f3tasfaDranvp u4 rxoio iytoptr ieol( s2ur(m nudal emfvtl(  Dumurpnt1aex  ieiaslm2rmu pn(0 rxoxo3tytfpD ln o;()s2xoxrpoy4omee fvs sfs2tmxmpoo1oetomictat mDuauvp u4 etnio oydfp rauvil( trxo(mpnu4lm   ivta()srumxmpnt0opt mieiytfa um( o t0arerio3oodoa   n olt0srumxo nu4openlivi s)arrmxmo;t4ole mfciat s2uanvp (0treoxocoy1lateanvi;(0texoxm iy1llteliei ( sDur( oot0oeen iciat sDrluvp t4aetrxf3iadlmDrln o (0trto(o3ny1ameelnvi (fsDum(mpnu1olx moetlslsDumump;(0tlxrio todfmDeluvo ()sexr(opoo4lle licia( artr(mpou4altoioctysfm2em( s (0trerxo oytlmDelu ils seur(opio4oltn netltf 2ra(mpnu1apxnmfeildfs2ea(mpn(0trtoio iytfat  nes;s0 rum(rpiu4lp  lfeilsf 2ur(  nu1oeeo oeiltfs2rmnmo (4trxrirctodomteln s t0teumir3oo4opeelnvias arururp;u0oex iieiytfsDul( p t0artnmf3oatomtrlies t0srxoim3ny4om elieta( a2ta(ro;u0tet miciad a rmu pn(4 exnmr tatopt  ieilt0 etr(r iy1omt liesltfa2urxmp;o1tlxo ieils sDrlnmonu0 leoifctytlmDeaivo t  rxoxopoy4ope  nctl()arrr( oot1apt mfeiytfa2elumo;t0 rxoxr3to1fmt au ilt) rtmirpiu1omtnlfcia()s2ra(m oo0tlx  o3ildlsDrluvsn()aeeoir3tytomt auei;s)teuriopny1apenlfctlt arumx  no1olen iciytla eaumsn(0tetomrciatfa elnesl(  2urxo3nodlle liesls)arrmxrpnt1ole ifciatlsDumuvp;u0 leoio tytlmDeli o s0srxo(mpoy4ole lfesatfsrumurp;o1tpxnio3iat m2ua(vp ()trenmfciytomD aivols) rto(r3oodam nlnvi tfsDtaur ot1tptnmocias a rmnmo;()alxomocoa1fate neo;(  eumxmpiu4omen fvi () rrrxr ;t0oeenmf3tlt sDuan sn()arxrirciadlmDr neo ()trumim no1alt  fct t a2rrxrpnu4tlxnmoeiys s el(mp (4areoifciodfateauvs;s trxrim3iodal  lnvtltfsruaurpot1tpe  fetytlm uauvp u)tltrxf3io1fpD luvolt tetm(opno1altnmics t)s2rau o;o0aleomieiyt m emn pnu4alxoiociy1laDr ues t0 2um(r3ny1ll nlncilt a2umx  ;o1ape  f3ildla el( pnu0 eenxfcoytfpte uesls0trxoiopoy4oleemivtl( artmx p;o0olxoifctysfaDeln o ()trtnmo3ta1fatr ivs s seumxopoy1lmtn netas) Dtr( pnt4tlenmfciad a2ranvonu0texrir3tadfpD li s;s  2tm(o iu1opeelfvil(f 2rmxro;u0olx iiciaslmDum(vs t) etoxo3tydla  au i;t  2uoxr3iu4alen fes sf rur( ooo4aleo ocilt sDulumonu)tltomoctotoate ues;t)t2trxmpiu1omen nesatfaDta(root4aexn o3iltfa2umn p t4trtrmr iodfpDr ivi s  rur(m3oudlm  mivs t) Dra(mo;u4tpeo ociatls em(vp;t4aeerxrciy1fp  aneo s trtmxo3ou4optelfvtas  Dtr(m no1oexnmfetasfs um( pn()tetrmr oadlaD  uei;(0 exmxr oydlleelieta(f Dur( p;u0tlxoioctlt aDea(vsnu4tetnxo3to1omDrauvi;() euoxopno4oltemicsl()sDtaxr nu0tex  fetys aDemu p;t0 rtomfcty1lp ranvs;s seuoxo iu4om nlfvt tfsDtaum nu0opx  f3iytla el(mp;(0tlenif3iatoaDe n i;(0srxr(o3nydop   icias)sruaxr nt0aee ioeilslm2ua(mp u0 eeomr iotfmDe uvs t0srtrirpiodop e fvsatf 2tmxmooo4tpto fctyd s2rmnvont4 eenio3oodfm rln i;t0t2urir oodol e ict ( arrr(  ou0open ietadla2ean pnu)tetnxr3ty1lmD  ivs;()srto(opoo4ameelnct t)aDtm( poo1apeomi3iyslmDel(mp;(0trtomr oydopDrli s (0trxm(o3oydlpt  nes sfarua(rpou0altoii3tlsfmDemumon(0 exoxo oatop eai o;t s2umim3oo1olen fvia( a2rmx oot4teto feilsfsDuanmp u)trtnio3tatlat auvolt texoxo io4optnlnvsl(fsDtaxm no0olxoif3iytla ul(vpn()tltnxo iy1fmD ln o s0t2xmxm no1opee fcsl( a2uaxr ;t1opx mieiadlmDul( snu4trtrio3ta1laD au i (0sruoxrpnu1am  mfesatf rrm(r oo4teen iciatfa2rm( p;t) eenif3tydoa e ivolt srxmimpoo1ole  feta() rrr(m oo4texoioeiat s ea(mp;t4altoiocty1laD  ueilt0tetmxrpnu4lp n fvs t)arrrxm no1oex mietydlmDulu s (4aeenirctadfptr u ol( t2uriopiudome mivslsfarua(mo;t1oleoioeiadlm rm(vp t0artnio3ia1om elneil(0 rto(o iy1ll emivt s sDua(r no0tlto octydls2emnmp ()aeenioctotfaD aieol( trxm(rpiu1lp n nvi s aDrr(r ;t1tetoioetasfm el(vp;t) ltnio3oydoptrlnei s0 etrir3oy1lpenmiei t) Dur(rp;t1optn o3iadfm rmnvs;u4aetnxr iotfmDrlueo;(  exoirpoo1apenmivtl(fsrrau pot1oeeo ieiltlaDelnmon(4artrmf iy1oatraues ()setmxm3iu1al   nvs (fa2raumpou0tptomociasfs uln pnt0alxrio oa1om raiei (0srumimpiydopt mieia() Drrumpnt1opeo o3ildlm em(msnu4teeoxr io1lpDrlivs ( srtoxr iy1omtemnetas  Durxm nt1altomoeiltfm ra( s u0 ltrxrcoodlptrlu ilt0srtoirpiy4om emfvsasf rtmx  ;u4tltnmi3iasla2rmu pn(0 eeomfcoydoat  i s s  rtoimpnudape mfesl(f rtr( oou4ole io3iat m ra( on() exoxrcoo1fmtr i sls0 eurio ny4omeemfcia() Drmxmpot0olto i3tadfa2ranms u) rxnxf oy1faD  uvolt t2umir io1lme lnvslsf rrr(ro;u0tpt mo3iytlm ranmp;()arxnmrctotlmte ivo s)srurirpoy1ap e nciat)srraxmo;o0aptn f3ildls2umumsnt) etomr oo1lm  aivil(  exrir3nydop e ivs tfsDrru pno0tpxnif3iaslmDrlnvo (0tlxnio3oodlaDrlnvilt  rtmiopnydlm nlnviatfsDuaur ;o0tpenmo3tatfa2ua(mon() rxoxfciadlm eau il(  rxoimpnydlpee ncil(f Dtax pot0oeeoifcildls ua(von(4arenxrctytoaDrlivi (0texm(r iudope mfctlsf 2trum nt4tlx iocilslm rauvp;(0aexoir oodlp   uvi t)t2tm(mpoy1opeemfei t  rtaxrpnt0oeeoii3tyt aDemn p;(4aleomo3iytfatr ivilt0texr(r no1lp n fcs s) Drrumpoo0opeo ietldfsDem(monu0aeeoio oa1lm   n s s)texoxo3no4omte fvsat s2um(monu4tptn ociydla eanmpn() etnir oy1omDraneils)t2xo(o3ou4lme mncia()srua(r no0tpt  icildla2rauvont)trtnxf3iydoate uei t truo(o3iy1am n icslt sDurur oo4tpxo fciad a emu o;t4trtoif ia1faDr ivo t)srtoir3ou4ll   feiat)s2tm(r oo4tleomfeiat m2el(ms;t4 exnmr oa1fmtelieil(0texo(r3oo4al nmfvtltf 2ua(root0oet mictltlaDulnvp;() rermo tydlmtraueil( s2tr(m oodllt lfci (fs2tmxmo;o0oee ii3tad mDem( sn()artnmr3totfa   uvs;s0texm(opnu1oltemnvs () 2taur no1aetoio3ildfsDumumo t) reomr3to1op ranesls) etr(r3nudlp  mfvtl(  Dtaxmp;u4apxo icilt m2umnmo;u) rxoir3oa1fm r ues;t0texoim3oy1lmeemfvia()aDtmumpou0opx ioeiytlaDuau p u4aetrir3oy1optrauvs;( t2xrxm iudol emnvsls  Dta(mo;u4oltnmictyt s rauvp;(0 lenxrctotom rauvo;t0trum(r3nydamt lfes t)srrau pnu1opx io3tatlsDuanmp u0tltoifcta1la r uei (0setm(r3nudome lfetl(f Dtmumono1tle iieias a2ra( on(4 ltrxfctadoaDrai o;( s2um(mpno1omtelfvi () 2trxr nu1tpenmiciadlaDrl( s;(4aeenmo3iydlatelivi;() eumxo oo1ap nmfcs s)artmurpnu4tet  oetas m2ean p;u0 reomr3tadoa   ivol(0seurio3ny1al n ivs t  Dumx p;u0apxoii3iadlm um(vpn(4trtrxrcoy1fp rli ol( trxoir3oo4ll emnctl()s2tau pou1tlxnifetytlm ea( p t0tleoxo3oytlp  livil()trumiopiydop  lnviat)sDua( p;t1aee mfcildfsDrau onu)arerircoodlatrlivi;t)t2tr(opiy1ame  nciltfsDumurpot0alxnmo3iatfm rluvo;t)arxnif oy1oa rauesl( srtm(opnudap emnvt t s2tru  nu4tlx if3tysfs2ua(ms;() rtnmrctytfp  aues s s2tm(m3iy1llt lnes s)a2ta(ro;o1aexnmo3iadfs2elnmont4alermfcoodlpDelneol(  rtmxmpoudom  lfesasfs2tr( oou1teto o3ilt s2elnvp (4tlxomrciadlm   ivols) rxmim io1ol  lfcs ( srtrurpot4olx ii3iatla2rlumonu)aetoifciy1omte nvi s srtoxo3oy1llt  nctatf rtmx pot4tlt  ictadfa emnmont4arerxf3oydla e n s;s0teurxo3oo4lmeelncs s s2tmuro;t0ale  i3ildla eluvo;(0 etoxociotla rauvolt0t2toxo3oodop nlneias)sDtaxmo;u4oee if3ils aDea( pnu) ltoxr iy1lp   u sls trxrio3no1ape lnvt s) rta(m nt0oeeoio3tlslm2raums ()trxoxociotlate ueo;()s2uoiopoodlptnmnvtatfsrta( o;t0apt mieiadfm2eln sn()aexoxfciytfate ivsl( s2xoxrpnodlpt mnei s artm(m nu1oex ii3iytfa2rm(mp (0texrmrcia1fmDrli i;()s2urxmpiy1ol nlfes s srur( pnu0olto f3tytlm rmn o;(0trtnxfciatlmtrau o;t0teumio iydol   ncs ()s2umu pnt1olx iiciys a rlnvo t0 etoxocoatoaDelnvo s0seum(r nodam emfcsltf Drm(r ;o0tlxo fctydfm uauvp;t) renif3tatfateau ols teumxr3iydolt  nciatfsrrrxm oo0openmicilslaDea(vsn(4 eeoxo3iydlp   u ilt)srxoio nu1al n netl()sDtmum ot0oex mfciat m elnmp;u4tltrmr oa1fp e nvsl(0s2urio ou1om   fesls) Dtr(mp;t0tpeniietldla2rlnms (4aexnxo3iy1oatelnvol(0seuo(r3oodop emieias a2um(r ;u4opt mieiydfs2eln ont0 rtrxrcoy1oa  ai ols)trtr(mpou1lleelictlt) 2raum nt1oetn oetytlsDrlnvp;(0 lermr oadla  au i;(0t2xrim3iy1lptnlieilsfa2ta(mpot4tpen ociat a2eluvpn(4 eeomf3iotopDeaieo ()t2toiopoo1apenlictasf 2ur(monu1teeo ieilt a umnvsnt) rtrircoodfpDraieo t0 exoim3nudaltn ieils aruaxrpnu0texoio3tasfsDelnvon() reoxo3io1faD an s s0 rtm(o iodam e fei t a2rau ono4apeoii3tasfmDra(vs;u4altrmfcoytopDelies t0 eum(mpoodlmt lnesa(fsDum(r ou1apenifeilsla ul(vs (4 rxnif oy1oaD  u o t)tetmirpiy1ol n fcias)sDtruro;t4tlto ociatfm2um( s t0aetnmo3oytfm  ai s;s seurxm nu1al n nvs tf 2uax  ;t4ale mo3iasfa2uanvp;u4arxnxrcoy1fat ln o;s0tetr(rpny1olenlfcsa()a2ua(  nu0aetnii3ils sDrmuvo (0 rxrmo oatop eli s;s)setr(rpny1ol elfcta(  rurxr ou1aptnmf3tldlm2rl(vo;t) eeoio3io1la e iesl( t2urxm oy1ope lietas  rtaxmpot4tpenif3tat a2el( o u0trxnifcio1opDe neil( seumxr nydoltnlncs ()aDuru pou4tex iieiys aDrmnmo;u)tlerio tytfp r nvols)s2xrxopnydopee feia(fa2ra( o;o4alto i3tlt sDul(vsn(4artnif3oydfpt lu i t0s2xrirpiudlpte fctlt s2tmum nu1tetn feils sDrmuvsnu0trenmfcty1fpt  u o t0s2xrim3ou4ol nlfcs s)sDraur ot1teeomo3tysls ran p;t) eermfcoatfm r ivs ( seurxr3iy4lpenlfei ()srrm(mo;u4apt mfctadfmDea(vo u4 rxoxf3tytomDr ivi ()s2uoxr oo4lmtelnctls aDra( o;o1oetoiieiysfmDeauvs;(0 ltoirciy1la eauei (0t2urxr iu1ap elnes tfsDrr(rp;u4aetnmo3tatls2emu pn(0arenmo to1fmtrluei;t) 2xmxr3no4aleelfvtlt s2umuro;t0oeen ictysfm eanmsnu4 ltrmr3iydomtraueols teuoir oudomtelnct (faDtau ooo0tpxoii3iadfa emnvpnu)artoioctytoatrauvo t0 etoirpou1om elietatf Drmxmo;o1alenioeiyt s2uauvonu)aetnxr io1faD  n il(  eumxr3nu4alee nvt s aDtr(monu4tpt  f3iatfs uan s;t4tleomr oytfmtrln s (0teum(m nudomtelnct tf rumx onu0oexnmfciatlaDulnmo t0 exomo tydfmDe nvol(0texm(o3ou4lmenlicils) Dumu  no1oee moctadlm2ul( sn(4tleoio3ta1opDrluvs s) ruoim3nu1openlicsas a2rmumpou0aptnmietatfaDrln s;t)arerif3tatoptr n ols trtriopiy4lp elnei sfa2ua(m ou4aet mieiaslsDeanvo t)trtoif3todomt  ueo t) exr(rpoy1ame lnciat  Dumxront0olxnmo3iydfs ulu on(0aexnifciytfp rlivi s setmxm3oydlp emieiat aDumurpnu4oltnioctas mDum(vo (0treoif3tydfm eluvi t)t2trxm iu4amt  icta()arumxmont4tltn ictasfmDrmnvsnt0treoxociy1la eau sls trtrirpny4openlneslsfa2ua( p;t4aet ii3ildfa2raumo;u0aetriocty1fpDeluvi;s sruoxo iy4omtnlivt ()s2ra(  nt0tlen i3iatlsDrmnvo (4artoxo iy1oaDe n i t0 exmir ou4op emfcil(  rrau o;o4aex ifeias s2ra( p;u) ltrmo3oydfm   uvslt0t2umir3nudamtemfctlt srurxr ;t0teenioeildls rlnvp;t) rermf oadopDeanvols)s2umio oy1ll  lnctl(fsrrmxmonu0aetn o3iaslmDua( p t4 rxrif3oytfm e ieo ()teumxr nydape lfetat aDtrxmo;u0apeo octls aDrau o u0aeerif totoptrau o;t s2uoxmpiy1lm nmncsatfarurxmpno1aex mo3iad m2ua(vo t)tlenif oydfmt auvi;s  etoxr oodam  mnvias) Dtr(rpnt1olt  ieiydla rmuvo t0trxnxr ty1omtelneo () 2trir no4ol e fctas  rtmxr oo0tlenmiciadfm2eaumo u0alenmfcoydfaDe i ilt  2ur(m3ny4op nmneslt)arua(  ot4aet mociadla eln s;()tlxnmr oydlm eanvs;() 2ur(r ny1lpeelici ( aDrm(r ou0opxoio3iydla rlnvo;(4tltnir oo1lp  lneo t s2xrxr iu1amenmiet t)srurxmp;u4tee mo3tat m2rmuvo ()teeomf3oa1opD  u olt s2toim ou1altemictlsfaDuau  no0optnmfctltfsDrlnvp (0 rtoxf tydlmtelu o t srtm(opno1apt  fvsat)s2rr(mp;o0aeeoifctydfs2ua( p u4alermoctydfa rlneo ()srtmimpoo1amte fet t  rrmxmpno4teenif3iyslmDeluvo (0trtrmoctytom elu s t trumir3iy1oltelivt ( arrm(mp;o1opxomf3ildlsDeluvp t) etnxr3io1fm elnei;s0trtrim3io1am  mieslsfsrum(r ot1opto ociaslmDuau pnu)tlenif3tytfaD auvs s)t2xmxm3iodlle lnvsl(  2umurpot1tltomfctldfa2rmu o;t0teenmr iy1fptrlies;t tetmxopoo4lme  ivt s aDra(  ;u4aleo i3iyd s2eau sn(4 exrircia1lpDe nvo ()t2trxr oo1ll nmivs (fsDuax ono0tle ifeiytla ua( p ()areoxf3oytfaDranvo;(0t2xrxmpoy4olenliesl( sDra(ro;t1aleoiociat aDrm( pnu)trxnirciodoatrau o;t)t2xrio3oo4amtn icil(  rrrur ;o4altomfciys s2rm(vp u0 rtnmr3tadfp   n i s srur(r3ou4ll  licsa( s2tmx pou0apen fctysfmDrl(vs t4 eenxr3oy1lmDe uei s) 2uo(r3iu4ap  miei s) Drr( p;t4olxo f3taslm2emumonu) rxniocoatlp eau s s0srurxo nu1lltemnetltf Dua(monu1tetoioctls aDean p u0 ltnxr3oytopDr ivi;()trum(m iu1olte nvils)srrau pot1tpxomi3iltfa2eanmpn() lxrifcia1op  aies (0 etmxm3iy1ap elivtas) Dta( o;o4ope iietyslaDelnvsnt0areoir ootfm r i ol() 2toxo iy1alee nvs s  2umu pnu1ole  feiytla2ulnmp;u4 ltoir3ty1fmtran i;s)t2um(opio4am   fei s arrax  ;o0open f3iad a el(von(4 ltnxo tadfa elivi;t)s2tr(m3no1altnmnvs t) Dumxmont1aeeomietat a emnmpn() rermf3iotfm e uesl( t2xo(opny4lm
\ No newline at end of file
@@ -0,0 +1 @@
+u sls)sexm(o nu1lp elfvtl() 2trxr oo0tptn ociadls2emumo;()trtnxo oodfptr i s;t tetoxo oydol e iei t) rtaxr ;t4alenioctadfm eanmpnt0tlxoxr3oydla e ivi;s t2uo(r3nodam  mnvtl(f Drr(rono4opt  feiysls2umu p (0trxnxo3oytlmtrlu i;(0srtrxr iy4alt mfcslt  2ur(mont1altomo3iadlm rluvpnt4tltoioctadoptrau o s0 rtmxr nu1al  lnvi s)aDraxmp;u4apxo oetyt m elnvpnu0tlerifciotom  an o t)s2umxm oo1ape lieils)srrrxm oo1oeeo f3tld aDrlnmpn(0 etrmr oodoa elivs;s)teur(rpnudllen fet tf 2urxmp;t1tpxnmo3iyd sDeauvo t4trxomfcio1lpt auesls0trxrxrpiu4lpe  netatfa2rrxrono1tpxomoctasfaDul(mo;(0 rtrmo iy1omteluvi s)trxoirpoy1lpe  ieiat  rrrxm ot4apenmociad s eanvonu0 lxnmr oy1fa rln o ()srxm(m oydomee ieia()aDumxmonu1tlx io3ilt a2ulnvsnt)artnmr todomtrauei ()s2um(o oo1llenlnct (f Dtrur ou1aet if3iyd mDua(vo t)texrxf io1op ranei ()texr(r nu1lp  mivsl(fsrrruronu1tetnif3tldlm el(mo;t0 rxrir tytlp  aiei;(0 rxmimpiu4om  mnciasfarrrxm ;u1olenmfctysfs2rl(msn(4 lenxrcoatom  lnvi ()teumxo iodape mfcilsf Dumum ou4texn oeiltlaDuln on(0arenxf iotlmte nvsl( t2toxmpnodap   fviasfsrtrxmont0tpeomoetytlmDem(ms t0aetomfctadlaDean olt)srur(m ny1al   fvt s aDtm( poo1teeo icild mDraumpnu0trermr3iytfat  ivi ( teur(mpiydlptnmfvs ( artmurp;o4aetnifetysfa elnmp;u)aeeomocootlpte i ilt0trtoim3iu4lp  miet t aDra(ronu4teenmiciltfmDrmnvs;t0trerif3oydfmtranei s0sexoxr3oo4ape  fet tfsrtmxmpnt1olt io3iatfsDranms (4 ltnmr to1lmtranvol(  2trxopou1lp nmfetlt  Duaxro;t1tlxomoeils aDeaumo u0alxnxrcta1fmDeau s s) rxo(o3nudlm   fvias srtmxrpoo0tetn i3ild sDea(msn()aexnir oa1fm   ueo;s texoxr3iodal nlfei sfa2ua(mpnu0olto fciyslsDeln p;u)tlxoir tatfateau s;t)setm(o3iy1om n fetat s2tmu onu0tleoif3tatfsDuln p (4tltrmfciytop r nes s  2tr(r ou4omenlfvi t)aDtmx p;t1tpxniicils s2ra(mo u0arerxrciadfmtelnvi;( t2xm(r3no4lpt liesl()srra(ro;o0tpen ociadfsDrlnmo;t0tetrxociotoaD  u ilt)tetmxo3oydaptemnctas)aDrr(m ou1tpe mociys aDua( pnt)aeermr oydlatrln o ()trurxr no1olenmfci ( a2umxr nt0olt io3iasfaDrlnvs (0 renxfciotoaDe ivils  etr(o3oo4lmtelicsltfaDtaxm ;t4aptnmfetls m rlnmo;t4 lenxr3iadom  lneilt)seuoxr3io1alee icias artrumo;t4ope ii3iaslaDrmuvp;()aeermfcoatoaD ai s;t)seuoxo iy1om  licslt a2ua(m ;u0tpt mfetyt aDel(mon(4aeenmr iodfpD lnvo s seum(m no4lltemfeil()aDurx pnt0olt  i3tld aDul(vont)tleomfcoatlat livs;s)teto(r ou1lp nlict tf rrrxrpou4aetnmo3tyd m um(vp;t4 leomr tydomDr ivo;( trxoxr3ny1lltn fvtat aDrrxrp;u1teenmfeiytfa2ul(vp t)teenxf tytoaD  nvol(0trtm(mpno4ol elictlsfa2ur(mo;o1aleo iciyt a em(von()aetoif totfm  ai o (0t2xrimpno1lpte fet s srra(moot0tpe  f3iadls uluvo u)trtrmf io1la r n s;s0seurir oo1am  lfcias) rrm( ono4texoiociydfaDraumo (4aeeomo ty1fm rluvi;t seurio oy1lm nlfetl(  2rrxm ;o1tpeomo3iasls raums t0 rtnmr3tadomD auvs s teurxr3ny4ap elnetas)a2rm(mpnt1aleomiciaslsDranmo t0 reoif3oydfmtrlneilt s2tmxopnu4lpeemnctls) Duauro;o4teen oetydla2uanmp;()aexoir ta1fa raieo t trtrxo iudam   ivsas)s2rmurpnt1aex mo3ilt a2uau pnu0aetomr3oydomt  ivols) rxmxm3ou4om nmicslsfa2um(rp;u0tpt if3tyt m2rl(vp u4arenxf iydom r uvo (  eumirpiydapeemnetlt) Dtrumo;u0tetoiictatlm em( p;u4 leomocta1oat li ol(  exrir ny4apenlietas)srum(r nu1oetn oetytla2um( s t0trtrxo iodfmD livs;(0 2xrxr3nudal elncsl(f Drm( ont4tlx micilsfa uln snu0 ltnmrcta1la elieo s)setrxmpiy1lptelfcsatf rtaumono0altnifetyt sDelu s;t0tlxrxociatfmDe ieol( trto(r3nu4lltnmietasf Dra(  ou4tpenmfctls s emu on(4tlxoxociadoa  lieolt srtoxmpio1om emncils) Dtmx  nu0oet mociadla2rmumo;t4teermo oatfp raies;t s2xrxr3ou4ll elici ( a2umxr ;t0tpe mocilsfaDrl( snt0tlxnmr oytfatr nesl(0srurir3iudll eliei (f Dtmumoou0olxn ociys a2rlu snt4 eerxoctatop  auvi;t)seur(o3iu4al nmfeil( srtr(mpoo0alxoifciyd a ra(vs;u4alxnif iytopD aueo s0s2tmxrpnu4ap   fet ( arur(ronu4tleoifeiys s2emuvo () leomfcoodlmDrauvs s t2urir iudope lfvtltfaDrau onu1tex  ociytls ulnvo;u4 rermfctatfpDelnvs;t) rxmirpoudomenmivtat  2rrum oo4tltnmictytlm um(msn(4 etrxfcoadfpDe ivolt0teuriopiy4ol nmfct sfarrmx o;o1apen o3tyd sDulu sn()aetnircoatlmDrlieols) 2tmxm3iodll emivt t)srtaxrp;u1oltn i3iltlaDulnvs;(4texrif3ta1fm eaies (  rum(r3iy1altnlfciatf 2taxroot4aet mf3tad m2eanvs (0tltomr3todfa eanvo (  etmxrpnu4altnlncs t srtruro;u4tpt  feiaslaDumnmp t4 rtrir3iadlpD  uvo (0seum(m3nydomt  ncsat  rraur ;u0aetniictytfs2uauvonu0 etoircia1fm  au o;()sexmio ou1oleelnct t  2rmx ont1apenmf3iydla rmn snu4 lenmo3ootlate ieol(0trumxrpou4lmenlnvs s)srtrx pnu0aptn iciyslm rl(vo;t0 rtoio3ty1fatranvilt t2xrio3nydapenmfeslt srra( pno0optoiociyt a2eanvo u)alxnmo3tadoa   iei t)tetmxr3oy1ap   nvi s sDumu o;o4tle mietlslmDelump;(4tltnxr3totoa elu ils0srurxr no1al  lfviat) Dua( poo0tlxoii3iyt a2umu pnt) ltoif oatoptrlnvs;s)trxmxm3oodlleemnei tfaDrr( pot0tltn i3tysfa2elu pnu)teenxr iytopD  uvs ( s2uoxr io4lp emnvtas) rrmxr ou0tptomoctytfm2rauvp;t4aexnifcoatopt an s t)tetoirpio4olt lfetatfa2tmx pnu0aexn oetyd a2umumpnt)arxnxo3iadfaDrai o ( teumio3ou1ap  mivil(faDum(moot0aetomfciasls2ulu s;u0alxnxociytopDran ol( s2to(mpou1lmenlnvtas)arra(mpou0opxniiciyslsDumnvs (4tleoircto1opDeli s s) rtr(rpoodop emfeiat s2urxmpot4oexn ictld m um(vpnu4 etoxoctatla rlivsl()texr(r ny4altelietl( aDuru  ot4oeenifctlsla ul(vp;(0aetnircta1lp rlivslt)trtrio nudamenmnct (fa2uau pnt4oleoifetltfsDrlnmo u) rtnxf3todfa rlieo (0t2xoio oy1lltnmncslsfaDuau p;t1opxomfctysfa2rl(mo t4teerir oa1lpDeauvs ()trtoio ny4lmen ivi (f rur(  ou4alxoioetlt m ul(mpn(4tltnmr ia1oaDr nei;t)trxoim oo4op e nvtl()a2tmxrono0oexnio3iadfs rl(ms;(0aeerxfciytfpDrlu i (0sexr(r ou4llt  ncil( s2taxmo;u1aee mi3iytfs umuvo;t0 reoxf3oydlpt lnes s0 etoxmpou1altnmict tfa2rrx  ;t4ole iieiysfs2rauvp u4 reoxo3oytlptelueo;s  eur(o nu4op emieiat) 2trumpnu0aetniocildlm2rmu on(4arenio3oy1fpteaueols)setr(mpiy1al  mfvs t  ruru p;u4oleoiociydfa2em( s (4aexnxfcto1lpD auvo;( sexm(m3iudlptn ncsas) rumumo;u0oetoifciysfmDra( s;u0 ltoif3oatlpt auvo;s0teurim iydalenlivsa( a2umumpnt4texo oeiyt m umn s t4teenmr3oatlm e ivols)seumxr io1ll nlnvsl()a2taxroou4tex  fciat s ul(mp;u0aexnxf tadfmtraieilt)t2um(m oy1alee fcia(fsDur(r nt1optnmfctytla2ua(mp;u4aetnmf todfp e n i t0s2tmirpiydlp e ieils)aDur(m ;o4tet if3iltls2ean s u4 leoxr3todlpDrluvsl()trxoir io4lme mfeiat) 2tau o;t1tleniictys s ra( s u0 exrmrciy1fmtr ueo () exr(m3iu4ameemics ()s2rrur nu1tlt ioeils a ea(vs;(0 eenmocia1latranvs;()srxr(m oo1ope lfesl( artaum nu0oet iictysfaDuln s;(0trxoio tytla eaues;t0s2tmxopnodll  miei (fsrrauroou4alt  o3iad m2rauvp () lxomocoytfatrluvsls)t2xoxo3nu4amt  fvsatfs2tmurp;t0tet micias sDrmuvpnu0arxoxr3iytlate nvi s)sexrxopno1lp emnvt s aDuaum ot1aleoiictadla2rlump u)areoxocoadlp eanvs s0srxoxo iydllen nesl()s2rmx oou0ole mociytlm2um(vp t0trtoxf3ta1lmt livsls)t2xr(o3io4lp   fct s)sDrmuro;u4tlto ieiasfm2rl(mpn()tetnxf iadopDraieilt)tetoxrpoy4ome  fcil( arra(m nu1oee mieiydlaDeanvo (4tetomr ta1fpt aies;s sexo(o oo1amt lnet t s2ta(mp;o1aetnifeiytfm2uluvs u) rtnxf iytoateliei ()setoirpny4al n ici (  2trum nu0apt  octytfaDemnmp (0aexoxo oytlpD  n o t  2uoxr3nydopt lfvia( srtax  ;t4aptniieiys m rm(vp;u4areoiociadlp raueslt seum(mpno4ome  nvtat  Dtax onu1oleoifciad m2umnmsnu4aleoxociotfa elues s t2trio iudamtn fcil()a2tmu ont0ole  f3ias aDelnms t0tlxomfciy1lm r ues;(0teuoxrpou1omt mnctl( artrurpnu0aptnmociyd s2eln s;u4arenif oatoaDeau s;(0trtmimpnu1ll  livt s aDtr( p;u4olxnmf3ils s2rm(vp (4 etrmr todlaDe u o;() euo(r io4om elfcs s s2uax p;t1tex  ociyslmDea( onu0 rtnxo3tytlmD  iesl() eto(r nydape liei sfsrtrx pnt4tptomfeiad s2rl( snu4tlxnmr oadfpt  ieo;s)s2uo(rpiu1aleemici (fa2tmxr nu1oexoifciadfs em(vo;t0aetrmocoatfateluvilt setrxo3nodaleelnviatfa2umuro;o1tltnifciadls2ea( s (0teeoxrciytoaD an s;t texm(m3ny4omtemnci (farta( pno0opt mieiys aDumuvonu4aleomocoodom  lu o t0trxo(m io1am elnesa(fa2tr( o;t0olto i3tltlm2umuvon(0trtnxo tatoate nvs s  2toxopou4ll  mfviat arraum ;u0olxomfctytfaDuln s u4tltoir3tytfa  lu sl( t2xrxo oy4lm elictl(f 2rm(m ;t0alxn fctatlsDeluvpnt)altoxo ty1lmtr nvil(0trxo(rpnodlmen iviat) 2rr(rpot0oeto i3iysfa2elnms (4aetoiociytoa r i i;s t2tmxm3ou4altn feiat)aDrr(  nt4olx mi3iysfa ra(vpnu0 rtrxrcoo1opteanvilt s2urim nu4apt mnei s aruaumo;u4tlenii3iadls2uaump t4altnmf3iodlaDeanesl()t2tm(r ou4apeemictasf rur(moot0teen ieiyd aDemuvs u4 lenxocio1la rluvs ( setrxr3nu4opeemfvsls  rua(r ;t0olx miciad s2rm(vo;(4 leomo3ootfa   neo;s0srtmxo oy1al  lneils arurxr ;t1texnioctydfa emums;(4aetnxr3oa1fa   ivs;s)s2tm(o3io1ll e neslt sDrmxrp;o1tltnmocils m umn p u0 etnir io1omteln o (  2urir3nudaltnmncsa(fsDurxro;u4tlxomfetyd a uauvo t4artnxr oydlm r ies;(0trxo(o3oo1optnlfcsl() 2ua(mp;u4alxnmociltlmDrmu s;u4trtoxrciatoa rau ils0srurxo3ny4alt mfvtat)aDurxr ou4opxnmfcilsfsDrau pn(4tltoxrcia1oaDe ueils  2xr(o iydlp   ivi s) 2ur( onu0oeeo f3iadfmDum(von()trerxo3oadfmDelnvs;t s2tmir iudol nlivsltfarum(ro;t0aee ioetaslsDem(mp;()tlxrmr iy1opD livs;(0t2tm(r3iydlp emnvtatf Dur( ooo0tpx mieilt s2umuvo;(4aeeoir tytlmte i ils)texo(r nu1alt mictls)aDua(mo;o4apen ieiydfs2uluvonu0aexrxr3oadfm ean il(0sruo(r3ny1omtelieilt srum(m ;u1tleo i3iysfsDemums ()aexrxf iatoa   ivs;t0srurxopiu1lp nlnvt (fa2uru pno0aeeo i3iadla2rm( p ()texriocoy1lm  lnvs t0 rtmim nu4lleemnvtlt aDraxmoot1tlxn o3tadfm2rauvs t4aetnirciy1laDe uvi t0 exoim3nodamenmiciat)sDtrxrpot4aeto octltfa umnmo (4 rxrif tatlm eaies (0s2trio3iy1olenlnvs s  2raumono1aexn f3ild mDua(vo (0 rtnmf3todfptr uvo;()sexoxm3iydam e fvtasf Drrxroou1texo ietldla rm( s;t)trenmf3oadop eaieo (  2uoimpnydope mieslt)sruru onu0teto ieiysfs eau p;t0tlxnxo ty1latrau o () rxoiopoodap nmfviat srrm(mpoo1oeto ociytlaDeau s (4aexnmo oodoa elivo;t0seumxrpiodlp  licil(  2umurp;u1opeoiiciatfs2el(ms t4tleoirciytfp   i s;(0s2tr(o oodolt  nvsas  Dra(r oo0tex mieiaslsDrmn o u) lxnmf3ty1faDelivi t) 2um(m iy1omte iet s  2ra(roou1oet moeiytfsDuan o;u4aeerirciodoaDrli il( texrxmpoydome mivi ()a2tru pot
\ No newline at end of file
@@ -0,0 +1 @@
+ieols0s2xoxm io4ole mfvsas  rum(  ;u4aee iocild s eanmp t)teeoif ta1op   uei;() 2tr(m oo4al   iesa(f 2taum ;t4aeeoio3iyd s ua( s u)aexnmr oadopt aueo;t0 ruoim nudoptemncs ( aDtrxmpot1opx mfeias m ulu on(0alerxfciydfa e uvi () rxoio3io1amen nvil() rrmx p;u1opeoii3tyd a2rmn p;(4 rxrmr3oadlatr ivi ()tetmxo io1lp nmfeta(f Duaxr no4oexo oeildlm uan s u4texomr tatom  aivilt) exrimpiu4alen fvsat  rtrumoot4tleoif3tydfs2eanvs u4aetomo iatfm rai i;t s2umimpoodoleemictlsfsrtaurooo1opx mietaslm emumo (0 lxomociy1lmDrai s s0teuoxrpiydapeemiesltfsDurxrpnt1alxomoetls a em(vo u4 rxoxr ta1lp r u i;t0 rtmxopiodap nmneil()a2tmur ot1oeen feiyt a rlnmp u) reoxo tytoatraivs;(0t2toio3nodalt  fviat  Dur(mp;o0oet io3tls m2rm(msnt4aeeoif3iodom   n s;t0srtrimpoodoptn ncsl( artmum ou1olx mociatls2ra(vsnt0 rtomrcoodfaDrlivolt  ruo(m3iy1olenmnei (  2tr(m ;u1tetnmfeildfa em(mo (0alerxo3tydla r uvils0 2xmxmpou4op nmivi sf rrmum ou1oetoiocilt a2ulumon(4trtomrcoo1la  luvo s)texoxr oy1ape  nvia(fa2urumpnt0ole ifetytla ul(mp t)artoxr3todfpDrli i s0 rum(m3nodop n fcsat  2urum ;o1tlt mictydfs uln p u0 lenif todla e i s;s t2toim3iu4ome  fvi (f ruru p;t0openmfciadlsDran pnu0aeerif ty1omtelnei t)s2uo(m ny4lmeemiesatfsDrm(m oo1opxoio3iadfs ran pnu0aeeoxo oadoaDeanvs s0texm(rpiy4om e ivtltfsrurumo;u4aeenifciytlsDuanms;(0tltomrctadoa rau o s0s2xo(o ou1ame mivi sfa2rr(r nt4oexnmietytlmDea(vp;()treomr3tydfmDraivi s)t2xoir3io4am e ietatf rtrxmpnt0ole  f3tatfsDuln s t)tetomf iadomD luvols t2trir3iydale  ieslt s2uax pnt0oex  f3ilt a2raums;t0trxrif3oydfpDeai o;t) 2um(m iu4am n nvils) ruax oou4opt ifciatfm2eanmsnu4altoio oy1om e neo;s  2um(m nodap emies s  2umxrooo0ole iociadfsDulumsnu4aeerio oydfm  ai i;(0s2umxr iodalenlfcs tfsrtax pou0openmiciydlaDranmp;t4aetrir3iodopDr nvols0 rxmirpno4apt  fvs ()s2tmur ;t4tltn oeiadls2ulnmon()texrxf3totfm eln s ( t2tm(m oo1lmee ncsa( sDumxro;t0oex  oetadfmDumn s;(0 lermf oa1lp  lueo;t srurxm3iu1al nlfvsl()sDtax p;t1aeeniietatfm2rmn snu)arermf iodfaDrln olt) rumir3ou4lpt  ivtls)sDra(mp;t4ole mo3tasfa ul(mo;u0texomrctatom e u ol()t2xm(rpio1am   fei () rra(r ot4tpto ietld s rln s;t0aeermrctytoateanesls) rum(opou4lmeemiet t)aDtru oou0altoiieilt m2eanvs t4 rxoxr tatlmtrlivi;t0teto(m oodlmee icils) rtru pou0tpt mf3iyslaDra(vo t4tltoxrciadlmt anvi s  2umxm nu1aptemfcsa( sDtau  ;u4teenmfeiadfm ua(vsnt0alerifciydop elnei;t)s2ur(mpoudlme lfvt tf rtau pnt1tlxomieiadlmDranvont)tltoio3oytoate uvolt s2xm(o oudolt lfes (  rurx pnu1tlt  oeildls emnms t4aetnxo tadfm r ies;t0trxoirpio4lmt mfcsatf Drrurp;u4open i3iat m2elu o () ltomo3tatomDe ivs;() 2xmiopoo4ll  mictlt  2tmu  ou4opx ifeiysfa rlnvon(4altoxo ootlpD an ils  rurxm3oy4apen nvsasfsrrr(rp;u0aetn iciltfa2rlnmp;(0tetnmfciotfp   uei;(0teur(mpoo1altelfvt s) 2uaxmoou0oleomfeiysfm2rl( sn(4treoxf tytlpt li s;( trurxr3nodomeemivs t)arua( ooo1open oetadfm eln s;t0aexrio3totomt  u slt0trxr(m ou4altemietl(f ruax pot1tptnmo3ilslmDra(ms;()areomociodfpDeliesl( teur(r3oodaleelnvt s a2tm(mpoo0tpenmi3iydfs2rmu snt0arerxfciadomD li il() 2to(opou1ale lfetls)arrau pno4olt ifctysla2rmnms;(0alerif3ta1lmDelies t)trxrio3iu4ape  iesatfarrm( pot4aeeo i3tysfaDua( on() lxnxf tadlp elnvo t)seuoir no4lm emnvi s)sDtr( o;u1aeenio3iytla2ra( o u0altoifcoadfaDeluvslt0s2umim iydoltn feslt) Draxm ou1altoifeiys s2rluvo t)arenxo3io1omD  nei s t2urxm nodop  mivs ()sDra( pou1tpe ii3ilt m2rm( pnt0 lenxfcoytlpt li olt)s2xm(m oo4lmenmnesa() rtaumpot4tee mfetldfs2elu p u) rxoxfctatopD lneo;( setrim iudapee fvil(faDtaumono0tpe  ociytfs2rm( p;()tlxrmocoadlp rai sl( t2xoxmpoy4altemfetatf Durum ;o4tlxnmoeiyd mDelnvsnt4trtnxf3oytfp r ues (0tetmxopio1lmen iciasfa2rr(  ou4oltoifeildfm uluvo;u4 lxrifciodla  an ilt)trtmirpnudop nliet s  rtrumpno0apto feiasfsDumuvo (0 etrxfcia1fptrlueslt0s2um(r nodlmeeliesatf Dumu o;o1olto oetyt s2rmuvs t0 eeomf3iydlpt  n ilt0srxoxrpnudopenmncias)arta(moot0tee  ociytfmDeanmon(4tltnmr iydlpD li slt0 rxoim no4optelncsatf Dua(rpno1tlx ifciasla rl( ont0 exnir iadopDe nvo;(0 eumxmpou4lp  mneta(  Dumu oot0aexnii3iatfs emn snu4tlxoif3todom rln i;(0setmxmpiudlm   ies (faDurxm no4tpxn ieils s2ran p;t)aetrio ta1oaD aieo;t) 2tmxrpoy1ll nlncsat)a2rrur no1teenmieilslsDea(mo u4tlxrmo3iy1omDr ueilt)teurxmpny4om emfviat)arrmxroou1tpe moctldfs2umu pn(4teeomf3totfmD  nvo;t) rtm(m nu1omtnlieiat) rrmx onu4aexniiciat aDeau p;t4alxrmr3oodfa   ieol(0 rxm(r iydol e ieta() 2um(mpnu1oetnmfeiadfm rmnvo u0texomf3oodfp  anei (  eto(mpnu4om  mnvil() Drrxmo;u1tltoiietys mDel(vo;t) lxoxfcoatomDr uvi s  2xo(m3ny1am   iesat a2uaumono4tpxomf3iysfa uau p;(0 reomf3todfmDelu i t)t2xmxmpny4alte icslt)aDururo;o1tet  f3iasfm ua(vp (0alxrxo3oy1fm  lu o;s)sruoio3oydolee ncsas)a2ra( o;o4apt  ieiadla rmnmo t) etoxf3ia1la e i o s)s2xrirpiy4al emies s sDrrxronu1oleomietldls2raumo (0aexoifciadlpDe ieo s0texoio iodlmtelfcilsf Duaxrpot0olx  ietatls rlnvpnt0alxnir ootfat  neo s  2toxmpnudlmt mnvsas)sDurur nt4olt  f3ilsla eluvp u)aeerxo tytlatr n il(  2xrxopoo1ap elncil(fs2raxront4aeeoii3tydfmDemu o u4aexrmr3todlp rai o;()s2xmxmpnydolenmfei s  2umu pou1texoiictysfmDem(mp t0arxnio3ta1fpDrlnvs;(0 2to(o3ou1lmtnlivilt) Dtrx pnu0texo i3tadla2raump;(4altoifciadomDe n ils) eurxm3ny4altemfet s  Dumumo;u1texoif3iatlsDrauvpnu0altoir ia1lm elies;s0t2toxo3ou1ale  ivs s) rtmxr ;t4tlx miciyslsDuan s t)trtoir oadfpteli o (0trxm(r3iu4altemfeia() rtr(mpno1tpx  feiyslm elnmo;u) exnxfciy1lmtrluvo (0tetr(mpiudapte fcsasf 2rau pot0tpxnmfeilsfm2rl(mo;()tetnmo ty1fp r uvs;t trxrxopiy1amee icias  2urxmpot1aetn ieilsfmDum( p u0tltrmf oo1omteluvils)s2xr(r3iy4olte ies t)a2rrxmp;t4aleo feiadfa rln s t4trtrmr3oytopDrluvi t)t2xoxo3ny4ameemnvsls srtax p;u0oex iictlt m rauvo;u4areomf iytoaD an o t)t2tmir no1ap e fcs tf Dtm(mo;o0aee  octltfa2ul(mpn() lxoifcoy1oatelieols0 2uoxrpiodal n ivs t  Duaxr ;o0ape mf3iad s2ea(mo t0teenio3iodomDranvi;(  rumxr3oy4alen fctat arumu  nu4aeenmociys s uanvo;u0 etrmf to1fmDrlnvsls t2xoxopiy4lltelnetatfaDtr( o;u4tee if3iltlsDrlu p (0 leomfcoadla  ai sls  etriopno1ome  icilt a2trxrpnt1tlxoii3ild aDean p (4trtomo3iy1faDr u o;t) exrxo3oo1ll e ieilt  rrr( ono4tee if3tldfa rlumpnt) lxnxr3oodoaDr neo s0tetm(o iy1ap emiei t)artauro;u0teeo ictadfm2rlumo;u0tltoxr oa1fmt lueslt) exr(opoo4ol nlfvias  2umum ;o4tet if3iatfmDelnms t) exoio oy1faDelu s;s0trxmxo oo4oltnlnesa(f 2ra(roou4opto i3taslm eaumpnt4treoxf tytfaDranvo t0 ruo(r ou4optelfetltfs2um(  ou0texomi3iyt a rlu p;u)trxnxoctatlate nvs;t0 exo(r ny1opeemfviat)artaurono4tlxo f3ilsfaDuln s;u0trtoir ia1optranvi ( s2xmxopio1amtnmnet t sDrrumpnt0aptnmociytlmDrauvo u4areoxoctodfmt aivil(0 rtm(mpio4ameelfctls sDrax  nu0opt ifciydfmDum( s;(4artoxocty1fpD  n s s) exo(o nydll emnesl(  Dtaurono0tpxniiciyslm2uanmpnt4teenmr tydla ean olt) 2xr(r3oo1lptemncs s) Dua(m nt1aexo i3ilt a rlnvp;t4aetrxf iy1oaDr neo;t srxoxm nu1lpt mfet (  rtaum ;o1aet mfctys sDemump;t0 ltrmoctotfmD livo;t  exmxm oo1am nlivils a2uaurono0apx moetldlm2rau p;t)aleomo oytomt  i o;t) 2tr(opnu1lpenlfcslt)aDtm(rpnt4tltnmociltfa2eaums u) rtoxfciy1op rlivi;t t2xm(m oudlpe mnvi ()srtmx p;o0opeoiociydlaDuau s;u0aetrir3oytlptr nvi;(  rxrxo3nudlleemies ( artaxr nu0tltoiociat a2uauvs;u4trxnmr iadomDeau ils) eumiopio4lpe livia()aDtmxr ou0aexnifciysfm ulu s (4 lxoxr todoa   iei;t  eurxr oodope lfeia()a2tr(mont4alt moeiad sDul(mo;(4 lenif3to1lm  au o;s0teurio3nydlmt  nvils aDum(rpnt4alto oetldlmDel( s;u4tetnxo oydopDe i sls t2urirpio1lpt  nesas)aDum(mpou0apxn o3iydfs ulumsn(0aetomo iatoate i o t0t2tmim io1amee nes ( srrm(ront1tlenii3ildfs2ean o u0 eenxr3oadoa  aueo s trtr(rpoo4oleelicias)aDtau p;u0altniietaslm2eanmo u0tltrmo oa1op e uvi ( teumxm3ou1lpte ivsa( srurxro;t4aeenifetlsfmDumu pnu0 rxrir todfpDeaueo;( trxoiopiy1ape  icsltfsrraxm oo4tpeo ieiydfm rln o;t)teerir ty1oaDe nes ()seurir3oo1ole  ivsa( sDtmx  ;u0apt ifctlslmDumn o u4 eenif iadfat lnvs;s0srtr(r3no1lptelics sfa2um( onu1tpeomfciad m el(vo (0tltrif3to1lpD  i i;t  etoxm oy4lp nmfvsl()aDtm( pnt4olen i3iltlm raump t)trerirciatop elivi t0srxmxopno4lp n fctas)srtax p;u0alx moctltls2em(vp;u0 exnmf3iatlmte uesls0 2xmxmpno1ap n netl( aDrax pnu1alen octatlm emump;t4trtrxo ootom elivs s0 eumio3iydam e fcs ()arrrxr no0tpe  f3tydfsDrl(mp;u4alxnmr tydopDe nvi (  rxm(rpio4optnmies t) Drr(mpot1olen octlsfs uau s;u) rxomr io1lpt lueo;s seuoio3ny4lmtn ictas srrrumo;u1optn octls s2emums;t)aexoiociytlmDr nes s0setrxrpoydoltemnvta( a2ur(mp;t4olx iiciat aDeaums u0areomo tydfatrlu sls0 exrxm iu4open iciasfs2tau  ;t1tpt ifctasfmDeanvonu0texnxfcio1lm elieo t0s2tmimpio1alt lnvsl()aruax  ;t1aeenifetyt mDean p;(4aleoir3tytomDeai s ()s2uo(rpoudal  mnvi (faDraumoot4olxnmicils aDulu p;()arxnio todlptrluvi;(  rurio3nudapt lfct t) rua(mpoo0apx  fetydlaDumu s ()tetnio3oadoaD  ies s  eurio3ou4lpe mnei t  Dtmu  ;t0apxomf3ils a2ua(mo;t0 rxnir oadopteau ils t2xoir iodap nmictlt)artaxronu0apt io3ild aDumnvo t0treoxoctadfaDrlneils0t2tmir3nu4ap  mfctatfa2rmxront1texomo3tas sDua(mont)artoio oatlaD ai s s)trtmirpno1am elfvtl(  2umxronu4olxnmo3tysfs2eau o t4trtoxr iy1fmDrlivolt  2xoxr nodol n nvtlsf Dra(m oo4tpenmociydlsDea(mon(4tltrxoctatfa  anei;t0t2trio3no4aleemieil( aDrrumpou0tee ifeiaslm rluvp;()alxnir3oadoa  ln o ()tetmiopiy4lpeemfvtat arrrur nt0optnifctadla2rmnmsnt)alxoif3ia1fpt aivs;t  exo(m3ou1lmtelfcs s) rum( ooo0tpe if3ildfsDrmu o (4 etnmf3oytop r uei;t s2xmir3ou4amtemietat) 2raumont0opeomo3tls aDrm(mont4 rxoxf totoa elu slt truo(r oy1omen fes t)a2uax o;o4altn o3ilsfsDrauvont4 reomfciytlpDeliei;t teur(rpiu4lmeelfvtasfarua( oou0olenmieiadlm2rmn o;u4 rermfciytfpDelnei;s) etmxm3iu4alee ietls)a2ua( p;t1olxomfeias m el(vsn(0 lenio todla e n i;s) exm(rpio4ape miet tf Drmxronu4aeeoiietaslm2ran pnt4 rxnxf3ootop   ueil( setoxo ou4lp nmiesl() Dta(rpnu0aee ifciyt aDum(vp (0teerxo oadfp  ln sls)trtr(o oydlpe mncsls s2tr(  ot1oetnmi3iyd a ranvp (4 etomf3oatfp eln s;t0 eumxo iydol nlnei (f rtaurpno1apxn ictls mDuanmo u0aeeoio oy1opDeaueo;s sexr(r iodlle lictls)arrm( pou1alen f3tlsfm2rm(vo;u)aetnxr iatomteanvo;s0s2ur(m io4altelfcils) Durxr oo4opxomi3tydfsDrmnms;()tltrxo oatlmDrlivi () eto(m3iodlp e iei t)aDrrx  ot4oltomfetaslmDea(ms;u0 rtnxrcoytfmt li s;s)tetoim3io1ol n ivia(f Dtm( pot1oeenii3ildlmDemu pnu4 ltnif3ty1fat  neslt trurimpoudalee nvi ( sDuau oou4alxn f3iadlsDrln s;u4 rtoxr3iytlptraueo;() exrxo3nu4amee ict tfa2uru pnt0apx ifetysls2eln s (4tltnmoctadfm r nvo () euoir iy1lpt lici () Dta( pno0oexn f3tlt m umnvpnu) ltnmf iodoa ranvo s) rxrxo iydlp nliei s) 2umx o;t0aptn f3iydfa rmn s;u4trxnio to1fp rlnvol(0 2xoiopiu1ol elfcsasfsrrr( oot4alxomf3ildfs2uanmp;u4 rerxr3oodlm  ai s s)trxmimpiy4oltemivil( a2urum ou0tlxomo3iat sDum(ms (4arenmoctydomtrlieol( trumir3no4llt  nesl( a2tmu pot1ope mietas s2ua(von(4tetoir to1op   nvo;t0srur(rpiodaltn nviat sDtmur ;u4tleoioeiltls2ulu p;()aeermo3oytomD auei t s2umirpou4om  mncs ( a2urxmoot1apxnmoeilt a emump;u0 reoioctytfa e ivo t trxr(m nu4ame licsas aDtmxm ou4oeen feiatfmDran p (0 rxrif3oadlpDe nei t) 2xriopiodomen nvtlt)sDtmurooo0ape iocildfmDulnvon(0texoxf3oydoaDeau o;t) 2trxopnodom  lnei (fsrta(  oo1tpeniiciysfm2elnvsnt)alxoxr3tatom r u i;(  2um(r ou4lm emfet tfa2uaxmpnt0altnifciltfs eanmp t4teenxo3oytoa  li i;(0sexrxmpio1olte ivt ( sDta(mont0aeeoiietadfm umnvpnu)arerif oatom rlnvilt)s2xo(o nudolt  nctl(f 2tax oou4tpx iocildlaDua(mp;t0trenmfciatlpt aies;()setmiopou1omt lfei (fa2ur(roou4alt moeiytlmDumn s (4 etrxf3iadlaD  u s;t0 rtm(rpoydolte fvias)s2ur(moot4olxn oeiys s umumsnu4 rxoxoctatlatran olt trxoimpnu4al   fcs ()srrmumoou1aeeoiictad sDuaump;u)aeeomf oy1oat au o;s tetoir3ny4optnlneiltf 2tm( p;u0oexniociytfs um(vs;(4tetoxo3oadlm eau i s seuo(m3iu4ame mieil(  2trumpot4olx mf3iaslmDranvs;()tetomr tydoat  ues;t0 euoxrpny1open ivt ( sDrr(m ou0tlt mi3iltls em( sn(0texnir3oatfmDrli ils)t2ur(r3iydlme  ivt (f rrr(rpoo0oltnifcildfa el(vpnu4artomfctydlmtr uvs;s trxrimpnu4opeelfviltfaruaumo;t0aexo o3tlsfs uauvs;t0aleomf3tadlmDraiei t texrxm oudop emivia() Durxm ;o4tetomfcilt s rmnvs;u0altnir3ty1fatrluvi;(  2xr(r3nu4alen nciat) 2trur ou0altomfcild s ua(vs u)tltoir iatomteluvo;()teurxopoudapt lfvt tf 2tm( onu4aetnioeiaslaDem(ms t)aetnxr ta1op  aueo;t s2toiopiodoleemicia()sDuauroot4aleomfctaslm emnvonu4 ltnxr3tatfaD ln o;t tetm(m3oy1lmtnlnci (faDum( pno0tlx  ieilt m2rln p t4texrxo iydfpDr neils s2xm(o no1am   fvs ( a2rrxm oo1olxnmi3tlsfmDran s;(0altoir iadfat auesls0seuo(m3iy4ape licsl(f Dtr( o;o0aetoiiciadls eanvo t4 etrxf iy1faD an s t) 2tm(mpno1alt  icsls)aDurxr ;o1aptomi3ild m2eluvsnt4areomf tatoaD luvsls0 exrirpou1omeelnei t  rra(r oo0aet mi3ildls ua(vpnu0aeerif3tadlaDr u ols)trtm(m oo4alte icta( s2trxr nt1teenifeiltlmDrlumonu) rermrcia1fp ean ol()seumir nu4ll elnes (  Dua( pno0tltn oeiysfs2emuvsnu4 exnmo3iotfm  luvols teumxopno4omen ncia( artmu o;u4tet mfeiydls2ulu o t4trtrmf3tatlmDeaiesls0s2xoim3oydaptnmics s)sDrm( ont0aeeomictld aDemuvp u4teenmr oy1omDelneo;s)texrim io4apen fes ()a2umum ;o4opxoifeiydfsDulnvp;t4teenmfciodlptrln o (0t2xrir iodlp emfvt s)s2rrxmpno0apxnif3tydls2umuvo u0trenmocoo1laDrlivs;t  euo(rpoy1om emfeil( aDtmxmpot4oleo ieiltfaDuan o;u0areoxf3oy1lm rliei s)t2umiopnudom  mnei t  rrrumont4oexo ociad aDrlumonu)teenio oytop r iei t srtrim3iu4altemicias  rumu p;o4tltnmieiytlm2uauvs t4artniocoytlpteanvsl( teuo(m nodlm n ivsa()aruaum ;t1tpe ifctltfs el( pn(0 lxrmf3tydfmDe nvo t)teto(m io1ale  fvsls arumum oo1ale mo3iltfs2em(von(0 ltrmr3oatfatr ivslt)trtm(m3nydal nliet t) rtauroot1aeeo ieiys m em(mont)aetoxr oatla  auvs t0trtm(o3oydalt  ncil( s2trx  oo4tpx  fciltfm el(vp;u4tlxnio3oytlp e i olt0sruoxopoy1ol  mfviat srrmxr oo0tpenmf3tyt s rlu pn(4 renxo ia1oaD luvs;s)texoim oydaltelicsa(f 2uaxmo;t4tpxnioetas s2eluvsnu) rxoxrciotlaDeli i t0 exmxm iydalenlfct (  ruaurono0oexomo3ildfm em(vs t0tltoiocoy1opDe n s;(  etm(m oudll   fcils) 2rmxm nu4aexoifctls s2rluvp;(4arenxo3iydfpDrlivs s teto(o iudll n ncta()aDtmumpot1optnii3tyd m em(mon(4artrio iy1om elivo t)s2tmxm ou4ll nmfcs sf Duax  nu1oetomictltlm rl( s t0aleoiocia1la r uvs;s0trur(r oy4ap eliesl()sDtmu  ;o0olto feiat s2ran p t4aeeomo iodfaDelivsls0t2xmio io4optelnes tfa2um(m ;o0aptomfciad s2rm(mo;u0texomr iotoatrln sls) 2xr(rpnydamenmivtat artaumoou4tlto i3ias a rluvp;u4 renir3iatlmDrlivo t  rurxo iudlp n nctl(faDuaxro;u0aetnmoeils sDemn s;u4tlxomr to1omDrauvo s t2urio3iu1om e nes ()aDtaxm ou0tpt mfcilslm2uau s u4altoif3iotfa e u olt  2trimpiu4lpee fvslt arta(mpot0tptn o3tad m2rau s (0arerifciadfaD lneil( tetrim3iu1ap nmnci () Drrx pnt4texn i3iytfa ra(vp t)tetrio oatop r u ol( t2uo(r3oudlmeelfeils srra(m ;u1olxnmictytls2eanmont4 lxoxf todfm   uvil() 2xrxo3iu1ap   fvs s)a2ra(moou0tlxomiciatlmDea( o;(4tlermr totlptelneslt0sexrxo no1aptnmfvt t)sruaumpou0tlt mieilt s2rm( onu4 ltomf ootoptrlues (0 rxoxm3ny1ll nlivtas  rrmxmpnu4olto i3iysls2ea(mp;(4alxrio ootla r ues t0sruo(m3oodlp nlivs tfartaxmo;u0opeo f3tat s2ulnms;(0 exnxociatlmte ivo;s t2tmxo ny1lpenlieiat aDra(mono0tee ii3iltfsDemn pnt) etrxociotoaDrauei t t2ur(m3no4opt  fci ( aDumurpnu1apxnmictasla2ul( ont4arxrio3tytomte nesl()tetmxo oodal nmfvs t  2ta( pno1olx  iciyt s rluvon(4altnxf tadfmteaieols seto(o3iu4ome mfvils  Dtrur oo1optnio3iysla ea(vp;u) ltoiociadlm elues t srtmxopno1lmtnlfvtls) Dtr(m ou0tpt moetlsfa2emu o;(0 etoxr3oatfmt  ueo;(0trumio3nydapen fvs s s2ua( p;o0olxo o3iatlaDem(mp;()teerio3oydoaD  n olt0teuo(m nu4ame  fcilt  Dtm(  nu4aptomociytfm uln sn()aexnxocoo1laDelu i s0truoiopoo1ale  fvs s srrrxmpou1olxnmociltlsDum(mp;t4 rxnmr oadoat lu ilt)trxoxm nodlmeelfvsl()a2um(r nt1aetoiiciadlsDran s u) etoxo3tytoptranvils texrxrpou4amtn ici ()aDuaurpou1aetnmietysfsDelums (0aeenxo tadlaD li olt0srtmxr oy4ll n ict sf Dta( pou1ope ii3tltfsDum(vont4alxoxo3todomt  nes;t) 2xrio iu4ap nlnvslt a2raumo;o1tlt ifeiatfmDumumo u4trxoxfcoa1latelieslt0t2uriopiy1llt lfctl(f 2rmurono0aleomicilsla em(vo;() leoxrciytfateanvsl(0 2xoim3nodapen nvilt sDraxr oo4ape if3ils aDrmnmo;t)aeeoxocty1fa   i o ()t2to(opiu4lp  mfvslt s2umu p;o4opxomieiad m em( s u0aeenxo3iydfaD lieo s0srtoirpno1ll   fcsa(  2trxroou0tetomo3tysfs rl(vpn(4alxnio3oa1omDeaneo;(0texoxm3iu4lptnmfcias)aDurxm ;t1tleniictlsfaDrln sn(0aetrmr iytlpDe u i t srurirpiu1alt mnvsa(  rtrxro;t0oee mfetad a2emnvo u4aetnxr oodlp  aneo (0teumxo iydapee fvsls aDtrum ;u4tpeomfciltfsDem( ont4 rerir oytfpDean o;( srtmxm3iu4lltnmfct ()s2uax pnu1apenmf3tytfm2em( p (4 renxf iotfa   nvils truo(opio4llt  feilsfsrtax p;u4ale ii3iadfs ran p ()aeeomo io1lp eaneilt0 2urim3no1amt  fcilt s2tm(mpno0tpe mietlslmDemums ()aetrmociytoaDeln sl(0 2toim iy4om nlfes tf Drr( o;o1tltomi3iysla2ul(ms t) leoxfcoydlm elnvi ()sexmim oy1lm nmnct s)s2rruroou1apxnmocildfaDuanmp u0 renmo oatfm   nes ()texrio3nodlmen icslt)s2tr(m nu4tlt  oeiasfa2el(mp;(4trerxrcoydopDeluvi s) rurxm nu1ap nmfvt s) rrru onu1tptn oeiasla rm(ms;()alenxocoatfptranes;t0s2xm(m3nu4ll   nvi ()s2tmum ;u4tetniicilsla2um(mpn(4 lxomocio1fmD luei t)srumxo oy4op emiesa(f Draxrono4aptn f3tldfm2el( o;(4trxnmf iodop rluvs ()s2xm(o3no1amee neil(  rraxr nu4open fciysfa2ulumonu4 rtnmr iy1op rai s s0 exmiopiy4am  livslt a2rr(rpoo0tpxo iciltfm2umu p;t) reniociodom rlivol()s2trir iy4al e nctl( aDtau ooo4aleo fciat aDulnvs u0aeerxr oa1oaDelnvs s0tetmxo3oy1om emnvi sfaDuau pnt4texomieiytfsDumu o;t4aetomfcty1laD anei;s  eurir no1ol nlnvtl(faDumurpot1oex iiciyd aDea(msnu4 rxnxo ia1oateanes;s trum(opoy1op elici s)srraxr oo1tlx mo3tys a rau on(4trerxrcto1fpt  ies;() eto(m3nodal  mict t) rurxm ;t1tetnio3tysla emnvs;t4 rtnio to1oatrlnes s seur(m3oodom   iviatfa2tmxrpot0oetn fctlslm2eluvonu)teerifctadfm ean i;s0t2xo(r iy1lme lfetls sDrmum no4oex  ocild aDrm( pn(0 lenxociotfat auesls srxr(m iudlp e nctltfsrrrx  nu0aeenmfetldlmDrlnvonu4aetnxr totfpDeln i;(  rto(o ou4lm nmnvtl( aDtrxmpoo1ape  oeiaslm rmuvo t4 reoxf3ia1opte iesl()setrxm oo1lmen ietlt a2taum ;o0aleo f3tyd mDel( p;t0tetnif3iy1oaDeauvils)trxrio iydop n ncsa(farrr(mo;u0tlenioctls aDean snt0teermocta1oaDe uvi (0 rxo(o iy4opt liei () 2tr(  oo1opxoifeiys m rl(vp t)trxrirciadfmDe u il(0sexmim3iu1omtemivs sfarumxrpou4tpxo f3tydlsDuluvo;(4 lxoxf3ootomte nesl(0teur(o3nodll n nvtat) 2ta(  ;t4ole  fctlt s emumsnt)aetnxociotlp rai i;t0seto(m3iydaptn fcslsfs2rrur ;u4opt ioeiasls ran s;u4 etnio io1oaDe i s;t srtoir3iudaleemfvt s sDuaurp;o4tptoif3tydlm2ea( p;t0texrxrcoodlp elieo t  eur(o no1lmtemnesatfsDua(  ot0texomo3ildfaDulnmp;t0aetnxo3tytlpDe ies;t0srtmxr iydape  fci s aDum(  no1oetomf3iydla2ul(mpn() rxrir tatfpD aneol(  rtrimpnu4amt mnctl()srtm(monu0tlx iociyt s eanms;u0alenmrcoatfa elneil()srum(o ou1lm   icsa(  rtaxmpot4tptnmoctyd a ra( o (0tlenmfctadfmtr i ols sexmim3iydaptn nesas sDumuroou4tlt moctys m2elu snt4 lxoxo3tatoa rli i () etmxrpio1opt liesa(f rtrx  ;u0oee if3iatfsDum(vs t0aeenxo3iodoaDeliei;s) 2toxmpoo4al elietat aDrm(rpou1apto ieiytls2ua(vp u0trenxr oo1omtraivilt trxmio3io1omee ieia(fs2taur nu0oeto ietat m eau s u)arxrxo3oytla ranvol( setoxrpnu4ameemivsatfsDtmxmoou0oee ioeils aDeluvp;u4 exomo ootfptelues ()t2uoxrpno4olenmfvi ()a2ra(m ;o0oex ioctltfs2em( o;u0 ltnir iotlmDe ivo s0 2uo(mpiu1ll n ivias)srtaxr ot4tleoif3iyd a2rln p;(0areoxo3iodfmtelnvo;( s2xo(rpou4oltnmnvil(f rumum ou0tex io3iys s2elu o;(0tlxoif iytfm  li o;s) 2tm(mpou4ameemicils  Dtmurpot0texomfeildlm2el( s u)aeeoio oo1laD aieols)srxmxopiy4llt mieiatfa2trx o;u1tpe mfeild mDrmu o (0 etrmf totlpDrluvo t t2uoiopio4opt  fvil()srum(rp;o1tpeoioetlt a2ean sn(0aeermrcto1lmtrai s;()teuo(opoo4lp n ncsls  Dtrumo;t4opxo f3iyslaDrl(vpn(0aexnxrcoa1lp   u o () eur(r oudll  mfes s a2tmx  ot1tlx ii3iatfm2em(vs u) leoif3ty1fpDe nvs;s0 eumxr nodlltn fvt s)sDtm(r ot4apenmfcildla2elumo t4 ltnxoctadlat aivo t)teur(opiy1amtnmivtlt) 2rr( p;u0aex iociatlm2rmnvsn()trtomr iydoatrli o s0srtm(rpnu4aptnlnetl() 2tr(ront0apto f3tat s2eluvs;()aetrifcoo1omDr uvs;( srxr(r3nydomenlnvtl( a2tmx  nu4apt  oeiyd sDemnvp (4altrir3oy1fmteluvo t) rto(o io4altemfvta()s2taurp;t4tpto ociltfmDua(vs u0aetrir3oatfat  u o;(0setrirpiu1ale mnes t srtau  ;t1oet  fctatlaDulumont0arermfctytlpt lues;(0srtoim3oy1ape mfvtatf 2rru ont4alt  oetydfa2rmu o (4 rtnmfciytfatraivilt  2tm(mpoy4oleemfci s)srraxmpno0tpxoio3taslmDeaumo (0tetnmf iy1lateanei;t tetmxo3iu1omtelietls)arraxm ;o1aeeo ieiat s el(vo (4alxrmr3ty1om rlnvo t0 2to(opnu1am elfcta( s2taxr nt0oee ii3iydfsDemumo;t0aetnxf3iadoaD  nvi (0trtrxm oodlp  lfes t) Dur( pot4tlto ieiyslm2em(mp;t)arxoxfciadlp e uvs ( t2uoxm iu1lm elfvta() Dtaur oo0ape mf3tas a umums t0tleoxf oy1la r uvi t0 euo(m3no1apenlnvsl(  rrmu p;o0opeo feiytla2ua(mp;(4alermfctydfptr uvi;( srtr(rpoodlm  mnci ( a2umum ;u0tpxnmi3tas mDem( s ()trtnio3tytlaDe ueo;(0teuoim3oo4apenmfet tfaDur(monu0alen ieiysfs el(vonu0tetoxf ootfmte i s;t s2to(m oy1opt mnctltf rtaxr ot0aeeniieilslmDua(mpnu4tlxnxr3oy1opD ln s;t  exmir3oy1altemncsa( a2uaurpnu0alxn fciat a2rlnvsnu0arerxocta1om ranvs s0trtoir io4lleemfcs ()s2rau  ot0oetomoeildla rln s t0aetoxf iytlaDelneo;t) 2ur(m nydomtnmfcsltfsDrrx  nt1alt  ociys aDum(mo;u4alxnmfcta1oa e uvs;t)trtrxm iodaptnmfcsls s2ur(m ;t4olxnmiciyslsDemuvsn() ltrmfciydfa rli i s  2xmxopnu1olte fvsl(faDtmxront1aexomoeias mDra(vsn()trtnir3oytoa eli slt)truoiopou1omtnmfci ()aDuaxroot4oeeoioeiysfm2ulnmonu)aeermo3oa1lpDrlivi;t setrxo3oydlleemnvs s) rrr( pou1tpt  i3tlslaDumn onu4artrxf3ootlp   n s;s) rxoxo ny4lle lfet () rraum no0tlx mfeiydfs2rlu p t)texnmociytopt aies ()t2xo(m3iy4ll elicias) 2uaumpnt0ole iiciyd m emn o t) rtoxr3iodlmtr n sl(0sexoxr3ou1ll  licia()srra(roou4tlxn f3ilsfs rlnmon(0teerio tatla eli ilt  rxm(o nodam e icil(  2urump;t1tex moeilt a uaump;t) rtnxo oodfaDrln o t teumxopou1amenmfcsls aDtmur ;u1alto fcildfs ul(mo;t0aexrio3totlatr uei;t s2xr(opnu1optnlicsls  Dur(moou4ope  f3iasfa2rl(vs t0 rtomr oytlate nes s  2xmxm3nudaltnmnvslt srurx pot1tpto ociadlaDuaumsnt4tlxoifciotoaD aieol()s2xoirpiudomenliei ( srua( ont4opxnmi3iasfsDel(vo u0tetrmrcty1fmDe u s;s  rum(o oy4omtelfcs sfarrr(mo;u4tpx mi3iydfsDuanmo t4altrircoydla ranvilt srxmxr3ny1ole  fei () rrax o;u1alxomoeiasfmDemnvp u)tltoio3iatop eluvo;() exo(rpoodapte fetas)a2ra( pot4aee mfeilslm rm(vs ()aexnircty1opteluvo s setmxm ny4ope mivtlt  2rr( oou1teen fciatfa2raumpn() rtrir tytomDrlnes;(0sexmimpio1al nmncslsfsDrm( ooo1tee  o3ias aDem(vo u0 ltrxo oa1fpt ln ils)sexrir3oy4al e nci sf Dumxr no1apxoiieias s rmuvs u)arxrio todfpD livs (0 exrxo3oy4olenlneil(farra( pnu4opx iocils a2rln o;u4 ltrmo3tadfm  liesl(0t2umiopnodol   fctls)sDrm(moot0aetnmociat mDrluvs t) eermo3ia1oaDrlu i;t)setoxr3ny1alt lnvs (f rua(r oo4optn oeiasls em( o u) exrmo iadopt livo;s s2uo(rpny4om n nesasfa2trxr nt0optn ieiadfa2raumonu) etoxf to1lpteliesls)texm(r3iudaltnlncta(f rtaump;t0tpeomociyd m rlnvsnu)tlerxo3oo1fpt  nvsl( srumiopnodap   icslsfaruaum nu1oltoioctyd s2rlu o t)alxrxr oytfaD lneol( trurim3oydalt  ics t) rumx ooo0teeoiietydlsDrmuvsn(4aetomr iatomD ln olt0tetrirpnydap   fcias)s2tr(rpou0opxn o3ildlm2uaums;t)tlxriociytfa   i ol()sruoxr oudole mfesls)sDrau poo4oeenio3iytla2ul( o t0tleniociadlm   i ols  rtoio3no4ome lfvsasfa2urx ont1olxo ietyd s2umnmonu4artnxfcoodoate iei;()srtrir no1oleelncsl(  2ra( onu4olen ieiadfs emumo t0tltoxfctodla rln i;( truoio3io1aleelnvtltfarta(m ;o4alto i3ias m2rl( o;(0altnmf ty1lmt  ieils0t2ur(mpiodomt mfctat arta(r ;t0oex iociytlaDrmnmo u) rtnircoadlate ueols t2xmxo3nodlmtnlnesat) 2tau  ou0apeomo3tys aDrlump;(4treoxo to1lateanvi;() rxmim3ny4lmtelicsasfa2tmuroou1tet mfctadlm2rmnmpnu0aexomf3oy1omt lnes;s0trumxo3io4opt lfcsltf rrr(rono0apt  i3tld aDuan s ()texnxf3iodfp rauvo;s0 eto(mpoo4op e feil(f Dur(  ;o0oexo ietld m ua(vo;(4aetrir to1oa  an o;s sruo(mpio1apte nesas arur(r ou1tex mfctlt m rlump;(4trtnxr oatfpD au o ()s2urim iy4ame mfvtat  Drr(  nu1aee  fctltfm ra(mont)artrircoo1oatelnvo;t0 rxoxmpio4lp n ivi sfa2umxrp;u0openmi3ilslaDumnvp;u0aetomo iatlptr nvslt)t2umxopiy4lpee iesasfaDraur ;o0alt if3tys m ean s;t4arenmr oo1lp rau o t0sexoxmpoydam emnvs s)artrx p;o0tlt io3iaslsDeaums () lxnmo3oytoaDranvsls t2tmxm3oy1oltelietlt)aDrmxmo;u1tlt  ociat a ulnvsnu)artrxocta1lmte ueo s  etmxrpiudaptemicil(fa2rmx p;t4teeoiociatlaDemu on() lxnmf tydomD  neilt0teurxm oodape mfcils aDurxr nt1aet ifcilsls2emnvsn(0 ltrir3tatoa  luvi;s  2tmxr3oo1alenlictls s2rru  ;t4tpt mietytfa umuvp;(4aeenmr3oy1om elu ilt0 exoxm oudap emfcsas s2um(mo;o1teto fctasls ulumsn(0tlerxfcoydoaDelnvi;() euo(rpnodap elnctlt srta(rpou0teeo ociasfsDeauvo;t4 rtoxfciadfm elu slt trxm(m nudom nlfviat srrrump;u1tpx iociysfm2uln pn(4artoifcoytlmtraues t0 eurxopiudape  iei ()sDtru o;t0alx mi3iadlsDranvsnu4trermrcia1fpt li i ()s2umxrpny4omeemfetlt arrrx o;u4optniieiasfa2uauvp t0arenxociytfm eau s;t0trxmir iu4ol emnviltfartr(  ou1apxo iciltla2uan s t4texrxo iodlatean i t)srxmxrpiy1ap elivsl()a2uaumpno1tltnmfeild a el( p;(0aexoir3iy1opD  ieils)s2to(o oydamtemnvtas a2rmum no4alxnii3ild m2ea(mpnu4teenxf3iotlpD luvols) euo(m3io1ll  lfcs tfs2uaxm ;t1aet mictltfa2uln o (0 exoxo tadopDeaivslt)srxmxr iydlltnliviat) ruaump;o1tle io3ils mDum(vp t4 lxoio oo1fmt au s;()texr(m ny4ole mnetlt) 2raurooo0tlt  ietldlaDeluvsn()arermr3iodlm  an s;s0teurimpny4ol  lneslt s2rau  ;t4alenioeiyt a2ulnvpnt0 rtnmfcio1opD lu il()t2xrxopnudomee ici t a2tmx ooo0ole ii3tyslm2rau sn(0areoxfcty1lp e ivil() rtmio iu1am nlivs sf rrau  ;t0teen fciasfm raums t4altrmo3iatla  livi;t teur(r iu4omt mieslt)a2taumono4apxoii3iydfsDra( p;t4texoxfcta1fp e uvs t0sexr(m oodoltelivt (fa2tmur ;t1aeen feiat aDulu s;u)arxrio tadlpDrluvi;t)t2uoimpiydopenmiesl( s2umu pot4tlto oeiasfs2uanmsnt0tleomr3ia1lp elivi t) 2xo(m3nydlltn ncils s2um(moou0tlxo f3ild sDuau p (0 exomo3ootfpDelieol(  rxmim3io4om  mietlt)sDumxm ;u4texnmieiat a2eau p;(4 lxoif ia1opteluvi;t seto(rpny1lm nmivi tf rum(rp;u0aleo fctls s el(mp t4tlxoxf tydlmD aieolt)sexmio oy1al   fvslt  Duaxr ;u1olxnmocils m uaump;t4alxrxocia1oaDelneslt0 exoiopnu4omtnliei ( arumxrpot0aeeoii3ildla rmnmsnt4 ltnmo3todomD  uvs ( t2um(m oydope mivsls)s2raxr ot0tleoioeildfaDrmuvs t0tlermo iadopt  nvo s)sexrio3nydam e fcslsf rra( pno4alt ifciytlsDemn sn(4arxnif3oy1om raneo;t)srtrxmpno1ap n ieil(  Draxront0aleomietlsfm2rlump (4arxnio3ia1faDeaueils0tetrxr nudomen net s srumuro;u1tlxo o3tldls2emumon(4tleomo tatfmt au sl() 2xm(o no4omtn ivt (fsDtmumo;t4oet iicildlsDuanvs;t)tetoxf3oa1oa e i i (0s2xo(m3ou4lpeemivi (faruaurpot0aleomocildla rl(mo u)teeoif3oydomDrauei;() 2tmirpiy1ap  lfct s) ruaumo;t1apt  f3iasls2emnms;t0 rxrmo tydopDe i s s0 eum(m no4lptnlnvtlsfa2rmx oot0open f3tydfa2umums;t) rxrmocia1oa r ues;t) etoir3iodlm e fesat aDtrump;t1tlx ifctydls2umumont)trermr iadlateli s;() 2xrimpoodamte ieta() Dtrxm ;u0optn fctasfa2umnms;u0 eenxrciadfmDrlu s s  2toim ny4lmtn netls)aDuaxmpoo4ale if3tasfmDulnmsn(4aeerxf iatomt lnvs t sexmxo no1lp e fetltfaruau onu0olen ietlslaDrl(vont0 ltrxfciydfpteanvi;s)setr(o oy4al nmneiatfs2uaxmo;o0tptn feiyt mDeauvs ()tltoio3io1op  aues;(0 rumxopou1altn nvtls sruaxmont4aex ifetldfsDel( s;(4 ltrio todoa  ai ils  2uoxopiudlmeelfes t)sDrau p;u4alxoiieiatlm eluvo t)artnmr oa1oat  uesls)s2urxm3nodap nlivslt aDtm(root0alxo o3ildls2rmu on(0 etoxrctatfa eaieo;t seurirpiy4lmtelfcia()s2trx p;u4optnioeiyt s emnvp t4tetomo3ta1lmtranvil(0 etrxrpoo4oltnlnesl(  Dumx pot4tpeoioctaslm2ran p;()texomrciodlate n ol(  exr(opoo4olenlics s srumu poo0olt io3iyslaDem(mont0artnmr ootoptean o;t0t2xrio3ny1op nlnvt t a2ua(  ;u4olxnio3tld a rau s t0teermfciy1lmD ln sls)trtrxr iudlpte fctltfaDuru o;t0aetomi3tadlm2uau snt)texnxo3ta1om ranvo;s tetrxm3nydlp e nctltfaDra(moot4oetomiciadfs2emuvo;u4altnmo oydfa  aiesl(0srxo(opiy1llte nvt t)sDuauro;u0tlen f3iytlm2rmnvp;(0arenmo3iatfm rauvi;s srurxr3io1lptnlncta()s2uaumo;o0aee if3ilslsDrmu on(4arerxo iodoa rlnei;t  rtmir3nu1apt  nci t arurxmpot0tltomfeiad sDuanmpnt0 etrir3iadla  lnvi t) 2tr(opiodole mncsas a2tm(r no0oetnmoeiytfs2ul(monu0 ltrir3iy1faD  i i;t0s2xmir3nodap  mfes (fsrrrxr ;t4tptoii3iys sDeanvo u4aleomf tydomDelueilt0srxm(o3oo1lmtn nvt ( aDtmx pou4ole ifeiltlsDem( s;u) lenxr3iytoaD lnvo;t)s2urim oy4lmt lfeta(fs2tmx oot4oltnmietas s2ra(mp;t)tltomr tadlaD anvi t)t2toxrpny1lmee fetatfaDtm( p;u1opeo fetasfaDra(mo (4aexrmf3ta1fm eau i t t2xmimpiu1omenlici ()arur(r ot4tetnmoetyd m2um( snt4 lenir oadopt li sl()s2uo(rpnu1om n fvslsfarrru p;t0tee  icilsls ulu o ()artnmo3tytomDraneo () 2ur(o3ou1llt lnvia()aDtmx  nu0open o3ilsfa2rmuvs;t4teeomr oodfmD aneo (0t2toir io1lmen fvs tf Dumumpot4tptn oeilsfs emu p;()tetnxr3iatfatran ol( s2trirpno4lpte fetlt artmurooo0apxoioctydlm eaums (0alxomfciotlat  neols  2um(o3iodllenliet t srumx onu1aexo icilt sDrl(vp;t4 etrir3oatfmtr nes ()truriopoydomte nvtas  rrrx o;u1tle mocils aDrmuvs t)trenxoctatlmDr ies ()seuoxr3nu4ll  mict s sDumu pnt4oexnmieilsfa ulu o (4 rxoxrcia1lp eln sl()s2tmirpou1amtemieiltfsDra(mpou1aleo ociltfm2rl(vo u0 rxoif iatopt lnvs;()s2toirpoodolenmnci sf rur(  ;o0alt  f3iytfm2ranms;(0altoxr3oa1omDr n sls) eum(o3ou1openlivi s aDumu p;t4oexoiicias s ulump;u) etrxr iatomDeluei ()sexo(rpoodol emiesat arra( p;t1texnmiciytlsDuln o t4trxoxf ootlp eln i () rxrio iy4alenmnvi t sDuru  no4tpe mi3iyt mDuaums;u) lerifcoa1fm  lueils  2xr(mpio4apenlietatfs2ua(roou1opt  f3tyd s2umu pn(4 ltoxrcoydfptr uvs;t) rurxrpiudopeelfes s aDtrum ;u1oee mfciytls rm(vs ()tetrxf3tytoa  luei;()s2to(opio4am nlfcil()sDra(rp;o1apx mfcilslm2ra(vp;t) renxr3iatomDraueslt) exm(m oydalt lfci t s2ua(m nt1oeen ocilslsDul(mpnt)arxnmo3oadfptr nvols0setrirpiy1ll elivsl( srrr(mo;t1oeenifetas m ranvp u0 eerxrctadop rli s;(0s2xm(m3oo4lmt lfci t)srurxr oo1olx iociysfs2uanmonu4tltnir oo1lmt aiesls teurio iodamte fvt t aDtmx  nu0opx mictasla2eanvonu4aexrio3iatfmDe u i t  ruoio iodllt mfcs s) rrm(mont0tltoiieildfsDeln p u0 lxnmfcto1fm e i slt)s2toxm3oy1ame lfct (  ruaxrono4opxomoetyd s2rau snt4altnxo3iydopD au olt0 rtm(m3ny4lp  livt (  Dra(rpnt4texn octaslsDrln o t4 eerxf ty1lp rlneo;t  rumimpou4ale mieiasfsrtm(r no4tlenmi3tyt aDrmnms t0aexoxo3tydoatrlnvslt)s2tr(m3ou4ol elnei t)srurxm oo4tee  i3iasls rl(msnt4trxnxr oydfmteaueilt s2uo(r3iydapt mfes ( s2tr(r ;t0olx mf3ilsfa2eanvpnt) etrir tatfpDe ieol(  etoxmpoudom   ncsat)a2uaurpno1olto oeiyd mDrl(mp;t)tlxnio todomt ai i t) eurir3iu4llte fci tfarrr(mpou4tpx  ieiadls rl(vo (4aetnmrcoatop  lues;t)s2xr(r3io4om nmfcs t s2tmu oot4olxnmfciysfmDel(mp u)tlxnir3todlp  luvsls)t2xoio oydolen ietls  Drrxm oo4oee  ieiys s2ul( p;() exoxo ty1fmDeau s;t)t2uoimpno1aptemnvi tfsruaxmp;u0tpt ioeiysfs umnvo t4aetrio3ty1laD  nei s  rxm(r3iu1omtnmnetlt) ruaxmpot1tlt ioeiasfm2ul(msnt)aleomf oo1fm rlivs t tetmxo3no4ol n fvsas srraurpnt4opxo icildfa2eanvp;u4treoifctydopte n i;s  eto(m3nodaptnmfetlsf Dtaxronu1alxn oetltfa2ul( onu4 rxnxrcoadlatrai ols  2urxo oy1ape mict t  Draum nu1tlx  oeiytfa rlnms;(0aexnir3ta1lpDr n o (0s2toirpny1aleemnvs sf ruax onu1alxn ociltla el(ms;t4tlxrxfctodlmDeluei;()s2xo(m nodlmt licsas  2truront0oet  iciysfsDumumo u) rtoir3to1opDeauvslt0srxm(m iy4amtelnct ()aDrmumpoo1altomo3ils m2emn o;t4 eenmocoytlmDrauvi;s0t2to(r iudlpt mncia(fa2rmxrp;o0ape miciysfaDrlnms;() eenxrciatfa e i o ()setrio3oy4altn ieiltfsDrm( onu1opxnmoeiydla2emu o;u)aetnmrcty1oatelivi;s truo(opoy4llt  fcias a2tax ono0oeeomo3iltfmDean ont4 lxnmrctodfpDran i;()setmxm3no1olt mfvt tf rum(rp;u1apeo icilt a2ea( pn(0altnmf ta1fmDran o (  rtmxo3oo4lleelnei t  Dtmxrp;t0apx iietytfm2rlnmp;t0teeomocoa1omteln i;s0 rtm(r oydom nmfei t)srrr(  ou4oeenmfctasfa2ra(mont) rerir oa1la elu s;s t2uo(r nodal n nvtlsfsrtaxrpot4oexn i3ilsfs elums u4 eerxociydfpD luvols0 2xr(o3nudll  lnctat)srrr(mpou4aleo feilsfs raums;u)arxnmr tytfat  uvils  eto(opiy4om n nvtasfartmx poo0tlxnmfeiydlmDua( o;(4 rtoxf3iodlm  auvs;s srtr(rpnydlltn fctltfaDtax o;t0apxniicias s umnvp t)texomr3oodlatelnvi;s0 ruoxr3no4opeelnei ()artm(m nt0opx iictldlaDrmn snt0teerxoctotop  auei (  rtrxo3iydlle mivi ( aDurxm no4opxnmf3iyt aDulu o;t0tetnmf3ootfmtelues (0seurxrpiu4apte nviltfsruaum nu4tptoiociydfs2umnmp;u0 rxnir oatfateli o s) 2ur(o3oodapeelies ( a2tmx  no4olxomoeiadfa2uan pnu0trtrifciodfateanes (0srur(rpiy4omenmfvtlsfsrrmx oou4oltn feiaslsDelnms;u4aetrxr3iodfmtrluvs s0teurxmpno1omte fcs s  rrrx  ;o1oleomf3iaslm umnmo;u0alxnmr iotoat ln sl( t2xrxrpoudap emncsasfsrrr(rpou1altn f3iysfs2emu p;t0aetnmf3ootfa rli i t) 2uo(m3ou1amtn ies s) Duaumpoo1tlx ioetlsfaDean snu0arxrxo tytop eluei;( s2umiopiu4ap n ieia( s2taum ;u1olxomoetasfmDeaumpn()texniocoy1oaD li i;t s2urxm io1lm elfesl()s2rrxmpou0teenifetyt s2el(vs t0arxnif oo1lmDeln i;s) rxmio nodamt lnci t  Drm(mp;u1oeeoiociyt sDrl(vo t)tlxomr3ty1lpteai s;s)sexrxrpno1al nmfes tfs2taxront4olxn fcild s umump;(4tltrmocoydlat luei;s) etmxo oy4ll nlict t)aDua(mont4aetomoctldfs eluvo u0aetnxociydlp eaiesls0sexo(o iy1ll nmnes tf Durxm oo4aet mi3iad mDumnvp;u)artnifciotoa rai o s)s2tmxm3ou4lp  lictlsfsDtr(m ot1oleoif3ilslsDeanmsnt0tlxnmo to1oa rluvi;t)s2to(mpno1lmtemicsat artmur no0aeenio3tatfa2ra( p;(4aeermo3ty1oat  i i;(0 2tmir no1openmivtlt s2taurpnt4tex mociadla uauvo;t4 rxnmrcio1fm rln ilt0 ruoim iudlmtemieias)aDraumont1tet  icilsfs umump (0 lxrxf oodlatrlnvo;s  eurxr3oudoltnmnei ( aDtm(mpou1tpxoio3iys m eanms (0 ltoiocio1optelueilt0s2umir3iydam n fes s  Drr( oot1optomictytfmDrm( sn(0tetrxr iydomDelnvi (  2trim iodlpt lnvsat)a2umxroou4opxomfetldla eauvo u)trtrmo iodfpDelnvo ( trtr(m3ny4ap   ieil(  Drrurono1apt mieiltla rm(vo ()trxnmf oatlmt auvslt) 2um(m iu1om elies (  Dtm(m ;u0tleniietatfaDrmn p;t4alxrio iatfmDeauei;()trxoxr oo4optn fcsls)sDurxrp;o0tle mfctat s raumo;t0altrxr oodlm  lueslt0t2umiopiu4lmt lnciltf Draxmo;o0tetn ieiyd m2rmu o;u) lermf3oadlpDr ueils)tetm(r nydap nlfvsls) Dtru  ou0oee  ietys aDul(msn(0 etrmf3ty1oaDrlieilt)srtoiopiodole  feias) rrau poo4aptomoeias s2emnmont0aetnir oadoa rau s;( setm(o nodomen nvil( artmum no4tltnmoeiys s uln pnu4alenxrctotopDrau s t0seuoxo3oodoltnmieils arrmurooo4alto ocils s2umuvonu0 rxoxrciytlp rluvo s0truoio no4lmt  fct s aDumxront0oet if3iysfa2eanmp;u0 eerif iytfpt auei;t) exo(rpoodapt  fetls)sDumurp;u4altn ieiasfs2emumpnu)alxomo oadfmD  i i;(0 2um(o nodaltemnvil()srurxm nu1olx ioetaslsDrmn ont0altomr oo1fmt lu s;t0t2ur(opiydam e fvs t) 2rmu ono0aexo ieiydlsDumnvs;() rxrxf iadomtrluvs;t)s2xo(r oo4aptnlnetls  rrrxmpno4tpeo fciatfaDra(vont4trtnmf ootlpDr n o ( sexm(opiodamt mfcslsf Durum oo1apx ii3iysfs uaumo;t4alxnxr3iy1lp r ueslt0teumxr3oydal nmfvias)a2urxr no1optn i3ils s2uau o;t4texrir iotoatrauvs;t)t2xrimpnu4ll elfvi ()srua(  ;t4tlxniiciydfsDemnvsnu)teenmo ty1lpt auei s trxrxopoydlmee fvia( sDumxmont0apen oeils m uanmpnt4 ltrmo3tydlmDr nei;(0srumxrpnudll n ncil( srrru onu0alx  oeiltlm2ulump;t)trenmo3tadlp  au il( seuo(m3iu1lme livils) Dururont0tpe  i3tldls raumpnt0 etrxo3oytfaDraiei ( t2ur(o iy4ameelnei tf Drmurooo1aeto oetys a em(vs;u4teermf3oadomDrlivols)srxo(o3ou1lltnmnes t  rumu oot4olxnmoeiytlmDul( o u0trtoxf3ootoatrauvi s0s2trio3oy4am   fcta(  Dumumo;t0altnmieilt s eau s t0tltrxf oatoaDr nvo;s t2tmirpiy4lmenlnvta() 2taxmpou1olxo f3tydfs ea(msnu4trxnmfcoodopte ivsl( setoimpiodole mfesa( artr(root4aeto f3ild aDean onu4treomf io1lp elnes (0t2xoxr ny4am  mfcs t)artau  ot1aeenmf3iad sDrm(ms;t4trxniocia1lmt anes;t)trum(rpiy1oltnlivt ( a2tr( pnt1apt io3tls a elnms t)aexoxo iatla r i ilt  rxo(opoydapte fvs t  2uaxr ot4tpto oetltfaDulnvon(0 lermf tytlmDeaneolt)sexo(r3iu4ol  lieilsfs2rr(m nt1alx  o3tlt a2eaumont)aetoir3to1fpD aueo s trto(m oy4amt lncia() Dumuro;o1tlxnifcils a2emnvpnu)areoxociodoatr u o t) etrxm3oo4ape lfvilsf Dtr(mooo1oeeniiciat mDum(vsnu0aexomr3totfmt  ues;s)s2tmirpno4oltemnctat a2umumpou4tpeoio3tadlmDumuvon(0 reomf3totomtrlieo s  rtm(r3iudame lnvias)aDumum oo0alto oetat sDelums u0tetoxf3iatlpDrlieo;() etrxrpiodom   fci tfsDta(moou0apxo oetldfm ulnvs;u0aeenxr ootlm  lies t0t2xrirpnydlme lnvsatf Dtruro;o4optnmieiad s ran o u)tlxomo3to1lpt livo s seumim3iudolen iesatfsDuaxrpnu0tpe ioctadls2rlnmon(0 lxrio3ia1fptrluvs t0trxoirpiu4lm emfvs s) rrr(rp;o1aee  fciyd aDelnvsnu0 eeoxf ta1lm rlu s;s0 eumiopny4apt  fviltf rum(  oo1oetn f3tlt sDrm(vo t0 lxnxoctotomt lnvil() etr(m iodomenlfesls  rtax  ;t4olt mf3iatlm2rmump;t4 eermr3tytlmtr ieo;( sexriopnu1olenlnetlt) 2ra( oou0apenifeiatfa ua(vpn() etoxrciy1lpt livs;(  2xo(r3oo4lmt mfctas) 2rrumono0tleoio3iatlaDrm( o;t4 ltnmfctadoa eli ol() 2urir oy4lltelneilt sDrmu  ;o0apxn icildlmDuau p;t) eerir3iatlm   neo ()s2uoim nu1lmee fetlt) rtmump;t4apen fcildfm2uanvo u0alxnxociytfpD lu sl() 2xm(rpnydllee ietas sDtmur no1ale mo3tydls2emums;t) rermrctotfmteai sls s2toimpiy4altnmivsas srrax ont1oexo iciad mDeauvs u)aeeomo3oy1faDranvo s)srtrirpnu1ll  miesa( a2tmxmp;u0aptn oeilsfm2elnmonu)arxnxo tydlptraueo;t  exo(opoo4omtn nvt tfa2taxmpno0tpt moeiasls ul( sn() rxnmo iotla  luvilt)truoxm3nu1altnmivs s artrum no0aeen i3tad mDumnvo;(4 ltrircoatfa   uvs;(0t2xr(mpnu1am nmnvslsfsDrmu o;u4tpxo octyt m2ranvpnt0 etoio oo1lmt auvsl( s2xr(m3iu4oltnlneilt sDuaxmo;o0tlen f3tld m2umumo u)tlxoxr ia1omDrlivs;() 2xr(rpno1lmt lfes sfaDtauro;o0tpxnmiciadfa2eanms t) ltrifctytfa r u ols  2urxr iydllt mfvi s  2raurpoo4tlx ifeiyslmDran sn()arxnio3to1fpDeau s;(0 rtm(mpnydll nmivsa()a2urxmo;t0teen octlslsDranmp;(4teermf oytfptelnvo (0teuoxo oo4al  lieiasf 2rmu oot0olxnmoeiadlaDumu pnt0tetnmocoa1lmtrlivols0sexmxm3io4llte fetat) ruaurpnu0olx mi3ildla emuvo;() eeomo tydfptrlies t0s2uoir3oy1opte fes s) rta( p;u1texniictlsfmDraumon(0artrxrcoo1omtran i t srtoxo nodal   icta(faDrm( o;t4optoif3ildfa2ul(mo u0aetnxr iy1oaD  i sl()t2ur(m iu4lp   feia()aDraxroou4aet iictytlm2ulums (4 exrir3oy1fa rlu sl( srtm(mpiydome  nvsat) 2ua(mo;t0texomfcilsfm2ulu p u4aetomrctytfa r neo;t texmxrpou1op elivsasf 2ra(monu1tpenii3ils m rl( o;()tetrio todfm r ueils0sruo(m nu1omtnmfesa( aDumxrooo4optomfeiad mDean p (4 lerif3ootlpt  n o t sexoxm nu4ll n fct t)sDtrxmo;o1aptnmfetls a2rm(vo (4 reoifciydop  aivi (  2umxr iu1om nlfct (fsDta( pnu0tltnio3ilsfa rmumpn()areomr3tatoat  u ols tetoxo3ou1al nlieslt sDururonu0oleo feilt m2rmnvs (4 etoifcta1lmtraneil()tetriopnu1lleemnvtas)arrrx  ot1tpeoifeiys mDrl(msnt0tleomrciytfmD lu s (0 exr(m3nu1ale mfctatf Dum( ono4oleo oeiasla2rl( p (4tleoir3iy1fa  lu il()truoio3nodamte nesa( srrru pou4ape ifeiadfs2eluvo;t0 rtnmr iytop eanvo;t0sexoxm3iydolt mivias)s2rr(m no1aeeo ieiadls2rmuvsnu0 renmo iy1fp e ieo;s) 2xmxopoo4lpe lnvtasfs2ur(root0texn ictlt m emn snt4alenxr tydomt  uvs;t teumxr3iu4ol elfvsa(farrrxr ;t1tet if3tldlm em( snt4 ltrxfciatfmDeanvo ()srxo(mpno1optnmivia(  2rm( p;u0texnmo3tls mDrmuvpnu) lerir oatfm  lieo s0 rtr(r3no1apen ics t) rta(r ;o1apxo oeiytla emn o;u4tlenmocio1optrlnvi t)s2xm(mpou4ole lieslsfa2ta(m no4apxo o3tytfsDem(ms;u)tleoio3iatoaDrli s t  euo(m oy4ap nmivtat)a2ur(mpno4opeomieiasla uauvo () ltoxo iydoptr ieilt tetm(o3iu4alt mnesltfaDrrumpnu0aee  fcilt a2ulu p u4altrxr ta1la r neilt seum(o ou4ap n nviatfaDurx o;o1tptnmicilsfs emump;t) rerir oydlpt  nvi ()seur(r oy1ol nlnetls  2rrurooo4tpeniietadlm ul( s u0 rtoif oadoptelueil()s2xo(m3ou1ome lfes () 2uau o;u4ale ioeild a ulumsnt)tlxnif3ty1optrluvo;s trxo(m3nu1apenmivtlsfaDumur nt4altniictlslaDuluvs;(4 rxoif oo1opDe i o (0trxriopoodalte icsl(farur(rono4opeoii3iaslm2uan s t0areoio totomtean o s0srxm(opnudalenmfet sf 2tmumoou0tptnioeiat m2um( s t0teerxf3iodfpDe u sls0sexoxr3oo1ll  mietl( a2tmxroou1tpxn octatfm2raump;t0 rxnmf3iadlateanvo;s) 2xrxr3oydolenmfei s)sruax pou4tetnio3ilslm2rl( o (4trxrxfcoo1fpDr n ols seur(rpiodomte nei sf 2umx oot1opxn f3iltls2rl(ms t4tltnmo3ootlaDe u o;( s2uoxo3io1amt  fct (f 2umu ont1opxnmi3iadlaDrau p;t4 ltrxo iadomte n s s)s2xm(mpno1olt  icilt)srtmxrpnt0tee  ocildlm2el(mpnu4 rxrxo oo1opDrln s;s) rtoxo ny1aptelnvils) rur(mpot1tptniietytla ulnvo;(4 renxrcoa1lm rln s;t trumim iy1olen ivilt a2tr(  ;o1tpen o3iyt a ean o t0 renxrciadlmteaueil(0 2tm(rpnu4amtemnviasf rrmx pno4tlto f3tas aDemumsn(4arenmr3ta1opt aieo;()tetr(m ny1altnmivsas)srrrur ;o4opeoiiciatfm2rluvsn()texnir3iotoa  luvi t)seumxo no1lp   ivslt)sDta(r ;u0apx ioeiadlsDrmu s;(0trxrirciytlp   iesl(0srumir oudamtemnvil(fa2rrxm nu4aeeoif3ilslm2uln p u4tlxoxf3oatlp  auvs (  rtmxrpiodlmeemfvsls srtrx onu1aleoiietldla ea( sn() rtnmo3io1fm ran i;()sruoim3io4al nmnvt ( aruaum ;u1aeeo o3ildfa ulnmo ()tetnmf3oydomt lnvils) rto(o3iy1lpeelnvtltf Draumpot0oex mi3ild sDumnmon(4teenir oydfpD ln o (0 2tmxm3nydlptnmfvia(faDtmu o;o4tet  feils m umuvp t)trtnxo3iadfpteanvo s)t2toir3iy4lm  lfet t)artmurp;u1teeomoctls a el(vont0 reoxfcia1fmDraueil() 2tr(m3iudap elivtat)arrmx ont1aex  icilsla2emn p u) exrxr3iy1fmt lu i ( s2xmxo iodomtn nesls) Duaxmp;t0tpen o3tld sDumnmo;t0trtrxr3to1late uvo;( seto(o3oodlmeelivi s)a2rm(r ;o4oltnmfeild m ea(vo;(0tlxrio3iy1op rlnvs (0texoirpiu1llee nvtas)aDrruro;o0oex iietldlsDumnmon(0trtoio iatfp r ivs;s) 2urxo ou1al elncsatfsrrmxm ou4oeeomi3ias m rlnmo;u0 rtrmrcoo1fmD  ieslt0s2tr(rpno4am  lfvsas)srrrxrpno4tlxn oeils a eauvpnt0teenmrctatla  lieols)s2uoxm3ou1amtelieiasf rtrumo;t1olto fctad m2elnms t0 lxoioctatfaDe u ols0 2umxmpou4ap n neils  rrrx  no0olxoifeildls2emn p (4altomo3iy1optranesl()s2tmiopoo1lptn ivsl()aDtru  ou1opx iocilt a2elu s t0tetomocoydfmteauvs ( t2umio oy1olen fci sf 2trx pou0alenmociad s umump;()aetrmo tydlptraieo;t seum(r3io1omt  fvtltfsDur(ro;o0oeto fctyd s ea(mpn(4tltrmr oy1fpDe ies s tetmxo oy4lpte feiasf Drmumpot4oex iietatfa2eaums t) lenxf3tytlp raivs (0 etr(rpou1olt mnesls)s2raxm nt4teeoiietat sDuauvs;t0trtoio iytom   uvs t s2xoxopny1amte fcsat) Dtr(mo;o0apeniictysfs2eanms;t)aexnioctytfmDraivolt  rtrxm3oo1aptelfesas s2tm(  oo4tpxo i3tadls ran sn()trtrmr3todlptr nei;t truo(m3oo1amt lfvtl()sDtrurpot4tet mfciatfs umnvo (0aetrmocia1faDr uei (0trxo(r ny1oltemiciat a2ra(mp;t0oexo iciasfs2raumon(0alxoiocoodoateluvsls0 rxo(r nudamenmfeilsfsrumxr no4apxnmi3ildlsDua( p;t4 rtomf3oadoat anvols t2umimpoydom e nvtls a2taur ;o4alen oetlsls2elu on() rxnmocto1omD liei s s2xoiopou1olee nctls)srrax ooo0olxoioctltfa ranvsn(4 ltomo tytom   ues t0 2uoxopiu4ameelnvs (farumumpnt0aeenio3tldfm2raump (4 lenxo iatfpteln s t)trtoxm ny1alt micsl( sDuax pno1aeenmf3iasfs2eln pnt0tlxrmrciytla rlneolt texmimpiu4amtemfvi sfsDtm(m ;o0tetoif3iltls el( o;t4aexrif ia1fm ean sls0t2trir iy4lpte ncsas) rrmx  ou1apxoioeiys s2ul( p;u)aetrxf oadom r i o t0 ruoxmpio1ale lfvias) 2ua(r nt4aeeomfciytlm eanvp u4altrxrctydla r n s ( srtoxr nudlpt liesa( aDurum no4oexn ociat s2umu o;()trtrxr3tydlatelues s sruoir no1op elnetas a2tm(rp;t4alxoio3iadfsDemumo (0 exnif oytfpDean ol( seuoim3oy4apen fvsat  2rrx pou4tpeoifeiatfm2uaumo;u4alxomo3iytfmDelnvsl()t2xmxr nodlle  ieta(  Drmxrono0oleoio3tys aDuan o t0texnirciydfp   uei;s  rxm(opoudopenmfcils) 2ur( poo4tetnmfeiatls elnmpnu4tleoio oadfaDelivi (  eumxm3oydal  mivsat)s2tr(ro;t4tptomi3tatfsDumnvo t)aetnxocoatfa rluei s0tetrim3oo4lp   nvtlt a2urxrp;u1apt  f3iadlsDuau s;u4aleoifcio1fa eau sl()srxrio3iodap   fvslsfsDrm(rp;t4aexnmieiltlmDrluvs;t)trtnmo3tatlaDr nei s0trxo(mpiydolenlfeta()a2urxrpou4aeto oeiydlmDrluvp t4tlenio3iy1fpDr uvsls0 2um(r3iodomen ieta()srtaxmonu1tlx  feiat a2ua( p u0aeeoif3todfatrli i;( sruoxr nu4lmtnmfcsat aDuaxmoot4tee  ociat m emnvs t0aetrifcty1lpDelueo;t0s2to(m oudlp n iet t  Drm(m nu0oeeomf3ilsfa rluvs;t4 exomr3oy1lm eln o;(0tetm(o iy4amen ictas  Drrxr nu1tptnif3iadlaDulnvpnt0trxnmrcta1fmDelues t) etrxopnu4op nmneil()s2ur(mo;u4opx  i3ilsfm2rlumon(4 rxoioctatoaDelieo t)srurim oudopt mncslt)a2trurpnu4apxn i3tadlmDuaump;t0arxnmrcoadomDe u i t srtoxo ou4olen ncia( arumx ono0oltnmfciadla2umn p (4trtomfciadfmDeau s s0t2uo(opiydlltemfvs t  rua(mo;o1opxnmi3iysfs elnvs t) lxnif3tydomDeaues;s sexrir ou1olt  iei ()a2rau oou4opxomi3iat m2rl( ont4arxrioctotoa  lues;s0s2xoio3io1aptemneias) ruaxmpot1apxnmi3iltla um( s;u0altrircio1opDraivi t0 2xrxr nu1apt  nctl( a2truront0oeeomociytfm2ea( p;(0 rtoif tytla e iei;s0srur(mpiy1om   ies t)sDtrx  ;u0texnmieiydfs2uluvo;(0 rtrxrciy1la  lneols0srtm(opoudoltelnct (fsDra(mont0teenif3iydlm rln s;t4treoxf3ty1omt an ol(0srumxopnodoptnlfcia()a2uau pot0opxo fciat s2uluvs;t4alxrifctydfptranvs ()trum(r3oy1ap nmnei tfartmxrpou4aex  fcilsfs2emnmsnu0arxoxr3iy1om  livi ()sexoiopno4lmtnmfetat)sDtau p;u4alx mi3iatfmDum(vont)aexnxo3oadom r nei t0 2trxo no4opeemneils) rua( oou4tee  f3ildlmDumuvs u) exnxf3iatfpDrai i t0t2umiopoo1lpe  fciasfaDua( ono1tex iiciatla2ranvsnt0 exnxf3oytomD  ueo;s)trtrim3io4amtelies t srrrxm no1tpeoioeiysfs2ran s;t)artrmr3iotop  an o (0srxoimpoo4alt miesas srtaxr oo1tlxomfciatlm2eln s t0 leomf iy1opt  nes ( s2xr(rpnodoptnlfei ()a2ur(  ou0olxnmieildfs rmuvo;(0 leomo3to1la r u ols  2uoiopnu1opt lncsl(f Duaxmont4tpe ioetydfsDrln p;t0 lxnifciytfpt luvo t trxoxr oo4ap e nciltf 2uaxr ;u0apxniietadla elums;(0 eerif3tytlp  aies;t srxrio no4lm   ietlt)s2um(r ot1apx  f3iytfa um(ms t)aetnxr3iodfpDr ueo;( seto(o oo1llenlfctlsf Dtm(rpot4altn fctatla2ea(vp;u0tlxnmo oatoaDr i i (0texm(r3nydllte ncta( sDraxronu4tlx iociysfs um(msn(0tltnxo oa1lpDeai o;(  2urxo oydom  lnvtatfsDtmumpoo1aetnifciaslmDrm( s u) lxoxrciotlptelnvi;s srtr(m3iu1optelfetasfs2taum ;t1opx  o3iyd a2eau onu0artnio oatlpteln s t0trxr(r3no4om elfcilt artmu o;u4oeeoii3iadlsDem( s t) lxrio3totom  liei t)s2toir iy1olen fcil() rua( oot1teeomfciltfsDuln pnt0tlxrmociadfp  ai o;t0 2uoirpoo4lme  ivias sDtaur ;o4olx mictltlm rauvp (4 lxnifcta1fpt lnes;s0seuoir oo4opt mnesls) rtmur ot4oexoioeiydfm uan pnt) lenmociytfat  neo s)t2trxo ny4lleemietas a2rmurooo0tltn feildfm2rmnvo;(4trtnxr3tydomDeauvolt0 rxoiopnydoptnmneiasfartm(  nt4oet  fciyslsDeanms;()texoio3oadlat ln s s0t2triopoudll nmfci () rraum nt1tpt  f3iadfa ulnmsn(4 lxomociydlpDranvi;s  euo(r3iu1oltemfvs (f rrm(mpno0oltoifctatfm2um(mpn(0 exrio ootfa  livs t) 2xr(m3ny4amen fvi t) Dum(r no4apto fciysfaDua(vonu0arenmo3ootfm rai s;(0t2trxopiy1aleelivsat)a2ta(moou1ole mo3tysls ea(mo u4texnmociytlmD luvi;t)setmxo3iodom nmnei (  Dtmum oo0ole iietltlm2ul( pn(4aetoxf oatla  luei ()t2xmxr3iudlle  iviasfaDtaurono4texnmfctyt a2rmu on(4 lxoir oy1op rau s;s)trtmirpnydopt  nvta( s2tmxrpnt1tlto iciyd mDea(mp u)artnxf3ty1faD aieo;t0 rtmxm3iydlpe lnct ( a2tmxmpno0teenifctys s2rlums t0 rxoxfciodop eanvs;(0 etoimpio4llenmnetatf 2rm(m ot0opeoifeiatfm2eauvp t4teermoctadfmt  ueil(0 2umio iy4ole lici t)aDum(r ou4oetnmfctydfs2um(mo u)tltomrcoa1fm rauvs;t0t2uoio3iu1ll   fesa() rrrxr ot4aexn ictatfm eau p ()trxomocoa1oaDr n slt truo(o3nodamt mneia() 2trxr ;o0tleoifetatlaDem( s ()tetrmo oytfm raivsl(0 2xrxmpnu1lpe mfctlt aDrm(m oo0tptnmociytla eluvp t0 rtoxoctodlpD ln i;s s2umimpnudoptnlivs tfartauroou1texnif3iytfmDumump t4tltomr3tatlp  lieo t  2tr(opno1apte fvil( a2uaxm ou1tpen ieiatfm2ua(mo t0aeeoif ta1lmte uvi;(0 rxoxrpou4olt mfvtas arra(m nu0apxnmo3tytlm2emumo;(0 lxomrcoatoa elieol(0 rxrir3oy4omt  ivil() Dumu  no1ale ii3ilt mDumnmp u0aetoio oatlmtelies t)srtoiopou4om emivi sf rra(  no4aee iietldfm ua(vo;u)tlerif tatlp   ieo;t0t2urim3nu1optemicilsfarrmx p;o4alxoio3taslm rln p;()aleoirctytoa   nesls)srxo(m3oudoltnlfetatfsDtmu pou4opx mfeildlm2rau ont4alenir3ootom raieo ()t2tm(o ou4lp emfvt (fa2tmxro;o1tleomieiytlmDua(vs;t)teenxrcoytomt lieo (0t2xr(o iudlm elivs ()sruau p;u4alxnmiciad a2eauvp u0tlenmfcoadopDr ivilt  exoxm oo1omenlivs s a2ra(mp;u0ape mo3ilt s2elnvp t0tlxoxocoatfmDeln i;t0 exoimpoo4ame livtlsfsDrru pou0oetnmiciys a2ran s u4 lxnircoytom elueo s)s2xrxrpou1ale  ivi () rrr(r nt0ape  ieiaslmDelnms;t) eeoxf io1faDeauvo;s0sruo(rpno1amee iei ()s2tr(rooo1texnii3tas a elnvs;()artomociotlptr ivilt sruoxr3iudole mfesa(  Duaumo;t0apt  fcildfm2rl(vonu4 etnio3oa1oateaivs;t tetoim3iu1aleelncsa(farrrxrooo4tpeoio3ilsls2rm(mont4 rtnir3tytfmt ln sl()trtrxrpny1aptemivi tfsDtmxmonu4aptnioeiat aDrl( p;t4altoifcto
\ No newline at end of file
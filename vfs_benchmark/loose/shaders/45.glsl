@@ -0,0 +1 @@
+n i;(0sruoxm3iy4om nlnvtl()a2umxm nt0ope  f3taslmDuauvp t) lxoir3ia1lpD  u sl() 2trimpoy4alte icsl(f rrrx o;o1apxnmociysfa2uauvs;u4alenio3iydlmtrlnvols)t2xo(r3oy1llee fvias s2raxmp;u1openifetytls2um(vont)texnxr3oodoa  lueol(  exrxrpiydol nlfet t  Dta(mo;o0texnmf3tat m rau sn() exomo io1lmteanvsl()srxoir3ou4al  liviasf Drauront0oeeoioeiadfa em( o (0tlxoxf iadlateln o t) eur(mpnydol n ncslt  rumurpou1teeo oetadfm ul( o u0 rtoxocoodomDeai i;t t2uoxmpou4olt mneilt)sDumu p;o4oet ii3iysfa2ra( s;u0 rxnio3oo1fmDe u o;t s2trxmpiudam  mivtat)a2ur(monu0olt ifeildla2rmu p;t0 rtrirctytoa elu s;s  exoim3nu4lpen iesat sruaurpnt1aeenii3tys s2umumo;(4tetoxrctadop elnvs;() etmimpiy4aptemfcias)srtaumo;u4tlt mfeilt a2rluvon() lxnxrctodoaDr ivi ( teurxmpou1omtnlfvt t  Duaxm ;t1oexo i3tytlm2elums;t) eenio3iytlmt anvilt) 2tr(m ou4omee ncs (faDra(  ;u1aetnmoeiad m rmnms ()alenxo oydlpDeaneolt0truoim3iy4op e feilt sDtr(r ;o0alxomi3iyslm rmnmsn(4altnioctodop   uvo;t0 2um(o3iudlptemies (fartmu pnu1optnmfciltlsDelump;t0 rxoxocoodomDr nvi;t t2tm(o ou4lle mfvilt a2ua(rpnu1olenmo3iat s uanmp t0 rerio io1fmDr neo ()setoxrpiodap nliet s  2raumonu1alt  fetytlsDrmn o ()teerioctodlat ln ol()sruoxm iu4aptnmfeilsfs2tmxmono1aptoifeildfs2eln p (0aetnirctadfp eaueols0seumimpoo4omenlnesa( s2urxm ;u4apt ii3iatla rlump;()arenxo3iodlpD anes;s)texoxo3ou4op e fcil(f 2umur ;u4tltomfciadfa2emnmpnt)aexoif oadlaDr ivol( trumimpnodam eliet t) rur( o;t1tpe iictltla em( o;u0areoxfciytfpt ln s;( t2toiopoy1lpen nvsat)s2tr(  no0texn feils m el(vp;()aleoxfcoa1lp  li slt0trtrxmpnydamee ics () Dum(  ot1oltn oeiat a rm( s u4 lxnmr iatfmDe ieslt)srxm(o ny1amt  netls arraxm no4ope  i3tlt sDrmu pnt0trtrxocty1fmDeaivils trtmim ny4om emfeiatf Drmu  oo1tpxoifctad a emn pn() rxnxf3iotfa raueo t0t2xriopnydomt lici t)arua(mo;u4oet  iciadls rmuvont4 rtnioctadlatelneils0 etrirpou4apt  icsas)sDrmumo;u0aee mfciadfs emnvpnt0 etoircto1lp raues;s)s2umim io1opeemict sfartaxrp;u4tpenioeild sDea( pnu4altoxf to1op   u olt)t2xoim3oodoltnmfcsls) Durumpno0apx  f3ild m rlu o (4tetnif iotlmte n o (0 2xrxm ny4om  mnvta( sDtax  oo0teeo f3tlt sDrl(vo;()tetnif3oatlaDr u s (0t2urxrpny1lle mictl()aDumu p;u1tetoii3ilsla rlu o;u0 exrmfctadopDrluei (0 2toxmpny1om  lnetas aDuru  ot0aeeo icilt m2el(vsnu0alxnxo3to1op rau s s0t2xmimpnudop   ietat  2ra(mo;t4teeniiciasla ulump;(0 leomfcoadopte uvo t s2uo(mpno1op nmiviat sDurxront1aptn ictadfsDea( p;(4tetoif iatfpte nes;t teuoxr3ou4ap emfeslt) 2rr(mo;t4tpenii3iydfs2em(vonu0teenxo3tydfa   n s s)t2tmimpoy1op  lics s)aDua(rpoo1aeto feilsfaDulu snu)tetomrcoytfp eauei;t s2toxo3nu4alt mics s)a2tr(mo;t4tle  icild a ea(mo;t0 ltoio3iatfa rauvi;t)trxr(m ou4opt  ics t  Duau onu1alt  f3tydfs ul(vs;() eeoircoatfmD  ivo;(0srtoio ou4ol nmnet sfs2rmxroou4openmictlsfs rlnvon(4 rtrir3iadlpte ueol() eto(m nu4lpt mfcslt)s2truro;o1tpenmicild s2ul(vo;t)aetrxf iodoaDelnesls seurxr3oy1omenmnvtl(  2trum nu4aeto f3tatlaDeauvont4 renmo3todoat  uesl()sruoxo oy1om n fci sfartax o;t4opeo f3tatlm rlnvsnt)aetoxfciadfptr uvslt0teuo(m io1opt mfeilt) 2raum no1tle  feiys s2rm( p;u4alenxoctydom eaues;(  rurir3no4al e fcsat srrmu oot1oet moctlslsDumuvp u4trtrmrctadlpDe uvo;( t2xr(opoy1oleemfvt () rtaur ;t0aexnmicildls2uanmp;u)arxoxf3oadop eaueilt0srtrxr3nu1aptn ncia(fs2tmxr no0opt micild sDrlu o;t)aeeoxr oatfp rlnvols)t2toxopoy4ll elfetl(  ruax p;u0oeenmoeiatfmDemnmp t0arxnif oo1omD lu ols s2urio iodlp e ivia(fa2uru pnu4tpx iiciasfa2ea(vo t)arermocoa1lmtranvi;t  2umirpiy1ope lfvsa(fsruru  oo0alxnmfeiat sDra(vs t4tlxrircoatlaD  i slt)sexmirpoy4lmt lnvils)a2rm( o;u4apenio3iaslm eanvs;t4areoxr iadlaDelueols)srurxm iudlptn iesat)srrr(  ;o0tlxomociytfm2eanvsnt4 etrxfcoodom eaivs;()trurxm iu4lpt micsltfarua(m ot4aeto f3iatls emnmp (4 ltoxr3ty1om rlieslt)teuoirpno1ol e net t)srumxm ot1alxo octyt a2ul( o;(0 eenir iy1omDeanvo t)trumxopoo4lptn nvtatfsDtau o;t0teto ietyt sDemumo;(4alerif3oa1oatr n s t0 2uoir3ny4ll  livias s2urumpot4aeeo feiltls2ea(mon()teenxo3oy1fpt lnei;t0s2urim io4lmenmncsas  Drau p;t0aexn ociyslsDrlu o;u0teerxocoo1fatelu o (0s2urim3ny1ap  livtatf rum(  ;o1tlen iciyt aDuln s u0 renxr3ty1om rlivo;() rurxopou1am e ict s  Drrxmont4oleoifeiys aDrm(ms;t)arerif3to1fpt li sls  2um(mpoy4omtemfcias arumx ono0alx  i3tad aDemuvs;u4 ltnirciy1omD lueilt0 rtmxm iy4optemivi s)sDumx o;t1oexoiieiltls2rln p;u)altrio3ta1fa r i i;s)sexrxr3nu1lmte fctasfsrrrur nu0aptn ictls a emumon()aetoir3oydop  livs t s2xmir3no4aleelfvsl( aDrmur nt1tlenioctas aDemn s t0 etnxfcootoat  ivs ( tetoxmpnu1amenlnvta()sDtmxmpnu0opt io3ias sDel( s t4aleomr3oatoa   ueo;()texoim ou1lltn iei s aDrmx p;u0alen i3ilslm elnvp u4aetoxo3tytfmD luvi;() rurxm3io1al nlnes tfarraxmooo1optoiictltfa2rlnvp;u4tlxnio3tytomDranesl(0 rtrim oydoptelics t)sDuax onu4tpe iieiydla eaums;t)aeerifcoo1opt  ies;t s2xoio ou4op   ncias srtmxmooo1tetoifeilsla rmnms;(0tlerxrcoydop rlu s;s) eurirpnu1ale  ncs t a2truro;t1tpx  i3iysla2rl(vp u4 ltnmf tydlaDr nvils s2uoxm ny1ope  ies ( aDrru o;t0tpx  oeils a umnvp t)areomr3tydlmtrln i (0srxoio nu4lm nlfvta( aDuaxm ot1tpxn oeils m eanmpnu4 lxrmrcoatomD luvi;(0s2umxopno4lpenmnvtas  2tau  ;o0oexo i3tydls el(vp;(4artrif3iydlpDeaies ()seurxopiudom nmnctl( artm(m ;t0oet mo3iydfm rlu o;t4altrmrcoa1opDe u il()tetr(o3iy1llt micslt a2ta( oou0teeomf3iydfm2raumpn(4tetrifcoo1la  auei (0tetmir3nodlltemfvt s arta(rp;u1oetomieiatfm ranvp t0arxrmrcoydla ran o s)t2xoirpio1lmtn fci t)aDrm(r oo0tptnmo3iydls2em( pn()areriociytlpDeaueo;t)trtrimpnudlp n ncia( s2uaxrpot1tpt mi3ilsfmDelnvs t) lxrirctotopDeaivi;t tetrim ny4apt  fvtatfa2rmumpot0ope  o3iasfs2ul(mo t)aexnxfcoadfmDeaivi s0srtrirpnodaptnlfesat) Dtm( oou0tle ii3iydla2ean onu)tleoif3totfp eln sl() exo(m io4apt lfctas s2trxmono0alxo ietltfm2eau snt4 rxrif3oydfm rli ilt seur(rpiy1ome  ieiltf Dur(m ou4aleoiiciys m2rm(vo (0 eeomrciatlateli i;s)trurim3ny1lm emnvt () rurx p;t4altniociadla2ranmp (0trtnio ta1lp e ieo t)t2tm(m oy1ole livtlsf 2raxrpno0tleo iciatls2um( s u) exrirciatopD lnvols srxr(mpno4ll  mnvsat sDurxr oo0tptomiciatfm2rluvsn()arxoir3iatopte i s s s2xo(opoy1lp   fcta(  rur( oou0apt ioeildlmDeauvp (0altnxo3iodoa  lnes (0 exoir3iudlp n ietasf rtm(r ou4oetn f3iasls ul( o;(0tetnifcoydfm r ivo;(0s2tm(opnu4lp emfctlt) Dtmumont0ale mfeiatfm2rln snu4altrxo iytom  anes;t  eur(rpiudlm n nvtltfsDrrum ot4apx mictyd s2rauvsnt4artrxr3totoptrai o;t  rxmio iudol  mfctl( srrrx  ;t4aeenmo3ilsfm umn s t0 reomf3todfatelivol()t2xoxr io1altnlictat sDraurono1oeen oetldfm2rlumsn(0 etoxr3to1op  aues (0s2xr(r iy1ale lieslsf rtm(  ;u0opxomfctlsla2em( o;t)tetrmf3ia1lpt lnei (  rtrxr ou4lpenmfesltf Dtrxrpno0apt  ietatlm emump (0tlerif3iytlatean o;s0 rxrxr3oodape mfei ( s2rmx p;u0alt iietlslm2umumsnu0trxoxociadlmt auvolt srxoxr3iu4omen fvilt  Durx pnu1apeoiiciydls umu pnu4tlxrmoctydopDe ieo;() rxo(opiu4lptnliesl(fsDraxmoot4aetnii3iadfa2umn onu)alxrmo oytfm eliei t)trtr(rpiudole lfvia()a2rr(rpou4texn fciltfm ua(mp;u4 eenmo3oa1fp  ln i t t2umxr nodllte iciat  ruax ono1tetomo3tyd s2emums (4areomr3ta1fa rlivs;s  rxo(opnu4lpenlncs sfsrur(rpoo1aetnmo3tadfs2umuvp ()arxoxfcoy1fpt  n o t tetmir ou4lmeelnesls arum(mp;u4optomociys m2ranvo ()trtnxr ia1latranvsl( texr(opnudam nlfvtas)srrau poo1tlx  ocilsla2umuvo;(0arenxfciatlptrlueo;t texm(opnu1olt livia() 2umumo;t0opeomo3iltfaDrauvo;t4 leomr todfat lneil() eumimpoy4olen ncsat) rtrx oot0olto fetytfaDuln s;t0 rtoxfciy1lmDelu olt trurir oo1apte fvtl()aDtmxrpou1oeen o3ildfm2ulnms (4artnif3tadfa e uvs;t0srtmim oydllen fciat)aDur(rpot4ale mo3iyd s ulumont4aetoifcia1opDeaivolt0 etoxr3oodale mncta(  2raum ou0tlx moeiysls2rauvsn(0 rerif tytla rln i;s s2uo(m nu1lmte fctl(fs2rm(mp;o4olx mfetldla rlu s;(0tlerxf3oytomt  ues (  exrio iydam elivta()aDumx p;u1apto fetls aDrmu p;t) eeoio3iadfm  lu s s trxoim nudoptnmnet sf Drmxroot0apen o3tad a rm( p;()arxrxo3tydla eaneo t0trum(o no4apen feta()a2uax pnt0oet mo3tytla2rmu p;(4tleoxocty1om  au ilt)setoio iu4ole lnes (f 2uau pno1tlxnmoetatfs2rl(mo;t) rtoxf3io1la elueolt s2umxo3oudll n netls a2ururo;o0opxomfciasla2emuvsn() eermo3oytlpt li sl() rxr(m io1ll  mfvils) Dtmxm ot0oee mi3iyt mDul( s;u0 renxr oadopDe n sl(0srxmxr nu4lptn nvilt) Dtmu  ;o0olx ifeilt a2rluvs;(4tltomocootlm r ieo;s0s2xo(r nu4opt  icsls)aDtruroot0tpe  o3iysls2ra( p (0trerifcoadlaD li s;s) rtrirpiy4llt mncta(f Duaur ou1aexnmo3iatfm2eauvo;t)texnxfcoatlmDeli i s0 eumio3nu4ap  mfei t  rtaur ou4opeo o3tasfa2um(mo;()tlerxf3tytopDranvs;t0srxr(r3no1llenmictat) 2uax o;u4tlxoioeiadls ea( ont)alxoir oadlmt anvil()seto(m nu4oltn fvsa()srra(m nt0tpt  fciytls umn onu0tltrmo todomDraivs;t) euo(o ou1llen ies tfsrurxmpoo1apx  i3tat s rmnvon() rermocty1om eliei;t0sexrimpnydap elfcil( sruaur ou4aetomfcilt a2ul(vo () rxoir3todoat  i ilt0 exmxm no4lpenlfctls)a2rr(r no1aee ifctlslm2emuvp u) rxoio3oodfate uvs;t  etoio3iu4omtemnvsls)aDtmurp;u4tlxnioetld a ul(vonu)arxnmrcootfa rln o () exriopiydalenmncslt)sDrmx pou1apenio3ilt m umn p;t4tetnmfcto1lp  an olt teurxr3ou4op nlivtasf rrau p;o0opxomociatfs ranmpnt0 etrif tatoa r uei;t0s2trxr3no1ame mfctat)a2rmxmp;u0alxnifeiys m2em(msnu0tlenir3ia1faDran s s0trumxm oy1op nlnvsas)a2tax poo0tltoifciaslm2rln pnu4 ltrmf3todlp rlu o;(0trxo(o oo4aptnlict s)aDrm( pnt0tlen ictltls2el(vs;(4tltnxf oa1fmD aivs;s)texoirpou1ol elieilt)srtmurpnu4texomf3ild a2ranvp;(4trenio3oadlpDr n il() rxoir iy1om elnes s) Dtmurono0apeo feiadfm2umn onu) lerirciatlmteln i ( trumio oo4opt  fvtat sDrruro;t4tpeoii3iyt aDuluvpnu)arerxo3oadlp eln i s)s2toxo iy1ap n nvta()sDumurooo4tptomoetls aDranvp u0altrxr3oodlpDeaivi t) rur(opiu1opte nei s  rrm(m ;u4texo ociysfm rluvp u0 exomf3iadlmDraivs (0t2uoxr oy4lptn ivsatf rtr(mooo4opto iciys sDumnvsnu4 eenir3tytlpDelivo ( teum(rpiodomt  fvsas)a2uaxmpot0teeniociydls ulnmp;u0 lermo iotfmteluvs t)t2umxo3iu1op nmici sf Dta(  nu4tptomo3iyt mDrl( p;t4tleomo oadom eaues;t  2umim oy4ll   ieias sDum( o;u1teen fetldfm el( p;t4 etrio3ty1fp r uvi s0t2xr(opoudamenmics sf 2tmur ou1tleo f3iatla ean o u0arxoxfciatomt  u i;s  rtmio3oo1op  mncs s)s2um(r ;u1apxomociltlaDul( p u) ltomr oadlatrlnvs s t2xrxr3oo4op   ivilsf rtmxmooo4oltomociasla umu p (4 lerxr ta1fmDe nvsl()trxr(o nu1ll n fesl( arrmx  oo4tptnif3iatfmDemums (4trxoir tatomDr i s ()s2xoio3nodlle lfesa( aDurum no4oetoiietad m2um( o (0tlermr3oy1fm rli s ( seurir oy4optn fet sfs2tmxm ou0teto i3ilt a2rln o u4tltomfcoadomtelu o;t)s2xrxr iudal emfcsl()aDtrxm ou4olxomfcildfm2em( p u4 rtrmo oydlaDeanvil(0 rumxmpou4lpeelfcil(fsrra(ro;o0texnmfctlt sDel( p;u)artrxfcta1lmDelnei;() exmxopnu1lptnliesls  rrr(r ;t0olt moeilt aDra(ms () lxoxo3todop eaivil( s2umxrpno1apee fetlt arurxr ;u0opt moctytlaDrmuvpnt4areoxf3oy1lmt lueils srto(m ny4aptelfcsat)a2tmxrpoo0aee  o3ilsfaDua(vs;(0teermfctodfmDe nvslt0sexmxrpnu4am nlicsat) ruaum ;t0altnioetasfsDrluvp (0artnio3totfm e u sls0srxrxm3iy1op  lnvsl()arumxmono0opeo f3iad mDel( s (4 rtnxo3oo1faDe ueo;t seuoiopoodomee ies (faDra(rp;o0alxomictytfs2eln o;(0aeerxr3todoaD livol(0setmir3oo4lmenlnctasf rtau o;o1alt  oeiatla2um( s;u4tetoxrciotlaDelivo t  exrio oo4lmtelfeta( aDtaxr nt1olt mfcils s uanvp (4 exnmr3iy1la  luei;()t2toxr ny4op emnviat s2umxrpnu4oeen feiatfs em(vpnt) renir ootlaD luvo;s0trtm(mpiy4omt mnviasfsDtmx  nu1alxo ociasfa2emnmon(4texnxo3ty1lmD  nvsl(0 rtm(o ou1ll  livilt sDtr(m nu1opeo oeiadlm2rl(vp;()arxoxoctytfpDeaivs;s  2uoxopoodome  nvtatfa2tmur nu4oeenioetysfm umnmo;t)tlxrio totfpDrlneolt t2umxmpnodame  ictl() Dtrxmo;t1olx io3iydfaDua( p;u)treoirciytfa ranesls setrimpiu1lptnlfes t srtm(mo;o0apenmoeiadls uauvsn() lxomocia1oaD au s;( seurir oodopenmncs (f ruauroot4oetoiiciaslmDranmo t4alxnmr iadomt aieilt0srtrirpoydal elfvsatfaDrrxmo;u1tltn icilslsDran p;t4 lxrmrctadom rli s ()trxmim3nodalee fvias)sruau oot1altnmo3iydlmDrau p;()artnxf oo1fm   nvo s) etr(o3iy1ap elfvtatfarrrxrpnu0oltniociltlsDuauvp u4trtrmr3oatfpD au slt0tetoim nu1lltelnvs tf 2uauroou4ope iocilsfaDulumon()tlerif3to1om  lnvo t trtrxr3oydamt lics (f rrax ont0apxo ieiytla emu ont0texoifcoodoaD  iei;t0t2umio3nydll e nct t)s2taump;o1ole mieiydlmDrlu sn(0trxomf oadfaDe ueo;t0 exrxm iu1apen fcsat srta(rpno0opeomfciatfaDelumonu0aexoirctotoaD ai ols0setm(rpiu4om n ivi () Dum( p;t1tex moeiasls emn pn(4teerir tadom   ueo;s seur(mpou4op nmfesl(f Dur(ro;u0tpe miciydlm2rl(ms ()teerxrcoo1oa eanei ()seuoxo3ny4ap elnvils a2rruronu4aetn ietyd s2rm(vs t0 lxomo3ta1laDeaueols  eurxo3ny1lpe lici (  2rr(ronu0altoifetls sDuauvont)altnmrciy1om r n s s)s2xoxr3no1olte nvtatfaruaxmp;u0oexomoeilsfaDelnvp t4aetrxf iadlm  auvsl( sexrxmpou1lme liet s) Drrxrp;t1oeenii3iadfsDemu p;u0tlerifctatoaDr neo s) ruoir3oo1am n neilsf 2trum nu0oleoifcils mDrauvpn(0tlxnmr oo1laDeln s t)sexoxo3nu4oltelfcsas sDra( o;o4olxnmieiys m2ul(ms t) lermfcootlat  ueo ()trtoxrpou1ap  mfct (fsDra( o;o4opx  ictld sDrauvpn(0tleoifcoy1opt lueil(0trtoimpnu1ll   feias a2tr( p;u0apxomictytfa2uanvs (0 rtoir oadfa rlivs (0teto(o oo4opt  nct ( sDumxmonu1opt mf3tldfm rlnms (4trxomo oa1oa r i slt) rxrio iu1ll elfes tfsDua(m nt0oetn f3tasfm rmuvp u)trtnmf tydfaD lieilt  rxoxr3ny1lpt mnvsl( artmx pnu4aeeo fciltfmDelnmonu4tleoxf3oydlp e i o () eurxr3ou1lltnmnvs tfsrtrxm no4olenmfciltla em(von() reoxrciydfp raivs;t t2xmxr io1optnlfvtat a2ra( p;u1opxnii3tlslaDrlnmon(4 rxnxocio1opt aneo ()trxo(opoudlm elncilt sDrm( onu1oetoifciltfa2ua(vs u)aexnxfcoodlm rliesls t2uo(r iudap e fetatfs2umurpoo0tptoiiciltfmDrmnmp u)alxrif oydfmtrluvs;t srtriopiu1ameelietl() Drru o;t4tpxnifciydls uanvo;u)aeeniociatfa rauvi;( tetoir ny1altnmnvi s aDtrx oou4tlxoifeildlm2elnmp ()artnmo io1fm e ivs s0t2urxr iy4am e fvilt)arum(monu4tlt mo3ildfs eluvon(4 eeoifciodfatraieo (  rxmir3nu1olt  fvtasf Dtm(rono4altnio3ild s2uau on()tlxrxr3ta1late nes;(0srtm(opou4al  livtat) 2ur(mo;t0tlx iicilslm2ra(vs t) lxoxociy1oa eaiesls srxm(m3iy1amtelictas) rua(moou1ape moeildfsDeln sn(0 eenmociotfpDeaivols0 rtrxm oy4lp e ivi t)sDrmxrpou0tet mfetld s rmuvsn(0tltnir iytlptelnei;t  2xm(o3nu4om nlfei t aDtmxm oo1alx  iciyd a2rlumpn() rtomo3io1fp raivi t)setm(rpoydllee nvsls  Dtau pot1olx  i3iltfs2umn o;() exrir3todla ean i s  2um(m oo1al  lnct t s2rrum ou4alx mfciyt sDumnvs;t4aeermo oy1fmDeauvs;s0trxoxm oy4alee ivsas) rtm(  nu1tpxomi3iat a2ulums t0treoiocta1fat auvilt)teumir oo1amt mfvi ()sDtax p;o1aexo o3iytfs ua(ms;u)aetrif3to1lm   ivi;()t2tr(r3ou4omte fvta(fsrtm(root0ope mo3ias aDemnvo;(4 rtnmo3tytfpteaivo ( srxm(opio1lm elfvtlt)a2tm(rpnu0teenmieiydfa2ean s;(0artrmf oadop   ivol(0 rum(o oy1llenlncsa(fa2rr( oot4apeoiieiytfsDuaumsnu)arxrifctotfmtrlu s;(0 eto(r oo4lme lfcs ( arrmx  ot4tleo fciad m eluvp;u0 eeomf3oa1oat lnei s0 eurimpoudop nmfcs ()sDtrur ;o1altn octltlmDul(vsnu0aexrio3iy1oatr n i ( t2xm(mpoudam emneils)sDtr(rp;u0texnmociat s2rluvs;()tltnxf3oatoatrlueo;(0 rumxmpiy4lmee fvi ()srur(ro;o4aee ii3iasfs2elnvsn()texoir3totlm rln ol(0 rumirpnudllt livil(  2ra(ro;u4oet if3iasfm eanvpnu4trxoirctadomt auesls tetm(o oy4om n fviasfarumumont4aexn feildfa2rmumsnt)aeeomoctytfateluvslt seuoim iu1ome lnvsa(fsDururono0tpenmi3iatfs2emn o u)trenif iatlaDran i s0trxm(r3iudaptelfct t)s2rau p;u1tetomf3iasla2elnmo;()tetnio iytlpt lies t) 2um(mpoy1lpe lictl(fs2uaxrpoo1tptniictyd a2uau sn(0arxnmr3oy1op  lueils0 2toim3iu1oleelnvtl(farrr(mo;o0apxo o3iyd sDul(ms (4altrmo3ia1op  ai s ()s2ur(rpou1aptnmfeils a2rmumoot1ape  ieildfm2um( snu)aeeomf todfaD auei s)s2umim oy4lm   ivil(fartr( pnu4alxn ociaslm eanmsn(4 eeoxf3iydlmtraivilt) etrir3iudape  fcils s2ua(mpoo1opx  ieiysfmDelu ont)tetoif todoaDe i ils0 2xr(m nu1lmt lfcslt  2rrx  nu4oltomf3iyt a rlu snu0treomoctatfaD lieslt) etm(m3io4lm  mfvt s) Dta( pnu4tpx mieiydlm emn p;t0texnmr iodfat  uei;s teto(o3nodll   ivt s)sruaxrp;o1texn icils aDumu p u) exniocoydlatr nvsls)s2xmxm oudomtnmfcsas)aDumum nu0oltn ictydfa2rm(vo (4aleriociy1fmD  uvo;s0 2xrxo ny4lpeelnvtl(fs2trxm ;o4aet mo3tyslsDrlu s u4arenxr3to1oaD  nvi;s trxo(opio4opt lfvsl( sDurxm ;t1texniiciysfs emu snt4altrif oatfmt au o t)srumxo3io1altnlies ()srtmuroou4tpxomociadla em(vo;u0aexoiocoydfm   i i (  2xoimpoydapenlfctasfsDtmxrp;t1alt iieiyslsDumums u) lxnxr iytlp  ai olt t2umxrpoy1al nmnctat aDtaxmpot0aptn ieias m2ul(vp (0arxnxocoydlp rauei ( s2xm(m3no1ol e icils s2rmxmooo1alx  ictld sDea(ms u0 eeomf3todlpDr ues s0 rurxo3oy1omen fvilt)sDumump;u1tlx  ietldfs ua( onu4 lerir iadfpteaiei;(0truo(o iu4apen ncias)arua( pno1altn ietatla2ran on(0aetoircootlmtrli i;s0s2tm(m iydope  iviat a2rmur nt1tpe ifeiyt a ua( s;()tltrmf3tadfaDeli i t) exo(m no1lptn fvtlsf rrrx  nu4olxomfetytla emn s t4teermo oatlpDr uvs;s  2xmio3nu1ape mnes (  Duau ono1aetoif3ilsfm ean o;() etnxr oo1lm elueils0s2xrxr3ny1ol emnci t arrrx  oo4aexnifetadls2rlums;(4 lxnxf tydfptrlivo;t0s2uoxm3oy1am  mics s)srtm( o;u4tpxo o3tadfsDum(mo u)aetrmoctytfmDrluei;t0tetoxmpoudamte nvt ( s2tmurp;u1ape moetls m rmnmp t)aetoxo oodfmDrlu il() exoimpny4lmeemncsatfsDraxmpou1oex  f3iyt m ul(vo (0altrmfciotlmteai i t) 2um(mpno1lp  liei s)s2tmxm oo1tptniieiadls2ra( s;t4 lxnmo iytlmtelnvilt trtr(rpno4ap  lnci t artr(mpot4alt moctldfmDrl(mont) exnir iytlp rln s;t t2uoio iudope livt ()aDurx p;t1tpe moetlsfsDumn o t4 exomr ootfmteln o;(0 2trxrpou1lpeelicil( s2tmur nu0tpt  feias a2ua(mo (4arxniociy1fmD aieo;t setm(mpnudlp e fct t a2trxm nt4oexomfciytfm2umu s;t) etrif3iodop  ln olt0 2xoimpiy1ap   ivs s)artax pno1tptomoeiltfaDul(vp t4arxriocty1laD  ivo;() 2xmxo3ou1lle miesasf Drau  nu0tet mfctls s2eanmpn(0tlerircoydfm rauvs;t0t2xrxmpnudom e ietatfsDrrxmpoo1tleoifetltfs ea(mo;t0tetnxfciadla ean ols0trur(r3ny1apeemfvtat  Drax  nu4tltoiieiyslsDemumo ()arxrxrciodfaDrluvs () etrirpoudom nmieslt srrmumont4opt ifeiysls elu on(4artoio oytfatranesls0s2xrim iu1llt mici tfa2rm(m ot0aexnif3tyd aDrluvo t)trxoioctytfa e iei t)setm(o ou4omtnmfcilt)artaxmpoo1olt mfeiaslaDumnmont) lxnifcia1omDr uei () rurxrpoo4lm elivilsf rumxr ou0tle ii3ilsfaDranvon()tleoif3tydlaDr n olt)srxrxo3nodoltnlfei ()aDumur nt0aptnifetydfs rlu s u)tetnmf3iytoatrlues s  etoxr oodolte ici tfs2rrxmp;t0tpxn fctyslmDeaums;u)aleoxr3ootfat  neilt)seuoimpou1ale  ivil(  rrrxmono4tptoifeiad aDeanmo (4artomoctatomtrln ols0 etoio3iydame lfet t)arur(m ou1oetoio3iatlmDulnvp (0 ltrio tytomt li il(0t2toxm3ny1lmenlnesl() Drm(m no4aptnmicildfs raums;(0alermrcoadomt li s;s0 rtrio3nu4olt lics (  rtr(rooo1oex if3ildfa2uanmo () rxrif oa1la ranes (0seuo(r oudom n icsl()aDtm(mo;u0oltoifciyt m2rmuvs u4texoiociatop e ueo;s) exo(mpnydaleelics t)aDrmxmonu4tptnmicildlmDrlnmp t)tlxomo totlat luvo t srtrxm nudop elnes ( arumur ;t4tpeoiieiltfs eauvs;u)tetrmrctadfp   ieo t0tetoxo3oodomtn fcs s a2ra(  ou4tlt iociltlmDeluvo;u0 eeoio tadopD  nvsls truoimpno1ome mncil(f Dtr(ro;o4apeomf3iyt s uln snu0texrxfcoo1lp rai o t s2xrxm iudlmenmfvsatf Dumum nu0opxn o3ildls2ulumsn()teenxr oydoa  luesl() rxrim oy4lm e ivs sf Durur ;o4olxomociysls2eaums t0 etoirctytlmt  ivil( srxoir io4omt lfes (fsDtmum nt4tpeoiictysls ean sn(4tltrif3totlmtr i olt)srtm(r3nydop nmnctlt a2urump;t4apenii3tld sDul(vp u0 exnxo oytlmDeluvi;t)srtrxr nu1llt  feiatfsrur(mpoo4apxo oeilslm em(ms;t0 etomo3iy1la eaieo;(0 ruo(o io4llt  fci t srumxrpot1opx mf3ilsfsDraums (0 lxrxfcoodoa eaueo s) exrxmpnu4alt  fcias  rurumpou4olxomiciat s2raums;u0altrxo3tatlm e uei t  rtoio nu4amtnlncsatf 2rrurpoo0tee  ieils m ua(vp u4 rxrmo3totomDe n s s0srum(rpio1llte ieia()arurx  no4opt moeildlaDuanvo;(4arxrmrcoadopteai i;t t2xrxm3oy1ap eliesa(faDtaxro;t0apt  fciat s2ulnmsn(0aeeoxf3ty1fmDr u o;t0 2xmxr3io4lmtnlicslsfs2ua(mo;o1apx if3iys mDeanvpnu4 lermfciadfateaues;(0 2xmiopoydlp elnctls  ruaxro;u4tptniociadlm2elnms ()aexnmocto1lmt au i t)texoxr3iu4ll  mieilt sDra(r ;t0tpt mo3iltfa rl(ms;t0aexrio3tydopt aiesl()seur(r3ou4lmeelnct tf Duau  ;t4oet ioetat a2rm(vs (0tetrxo3oy1fa  liei;s) rumim no1oleelnvsl(f 2rmxm ou0aexoif3iysfm2emu pnu) etrmr3iatfpteluvilt texmim3oodol elncils s2ur( onu4aexn iciltfm rlums;t4aetrifcoytoptrauvs;(0t2tr(mpnudamtn ies (faDtmu oou1alx iieiyd aDeln ont4aeermf3tadom elu sl(0teuo(opoy1omeemncia(  2umxrpno0aeen ieiytfs ua(vo ()tltrxf3oy1lp rlueo s  rurio nodom  lnet s  Dta( oou1aet moeiadfs2ranvo;t0 lxoxr tatfmDr ies t0 2ur(m iudopte nes sf Dumu  ;t0oeeo fciytfmDelnmon() lxoxfcoydlmteaueo (0s2xm(r nodom   ictasfa2tmum ;u1tleomfciydla2rln s t4treoircoo1oaD ln o;() rxoxopnu1olt mnvs tfaDta(r ;u0optn ociydfsDrmumsn(0 eenxo to1oaD an sl()t2to(m3ou4lmtn fct s) 2uaxrooo0oexniicias mDumnvs () lxrxociytfp r u s;s)t2urio3ou4amtn ictat)artax  ot4tpe mf3ilt a2rl(mp;u)alerifcia1laDranvsls0trur(m oydll  lnvtl(f rurumooo0aeenii3tadls2rl(msnu) exrmrciotop rluvi s) rto(r3iy4omtnlnvi t  2rau ont1apxnmoeiltfs2ran o;(4aexnxf io1opteaues t  rto(r nu1lpe  ictlt)srum(r nu1aleoifciysla2ean o;(0arxnif iy1lat  neol( trtmio3iu1ol  licta() 2umum ;o4olen oeias s ea(vsn(4aeermo3oadopDeli i t s2xrxm ou1lpt mieia()s2rmu  ;o1opt  ietldls um( p;u0 etomocty1op rlu olt0 2uo(o3oydlpte nes s aDuax o;o4opt mo3iltfa2emnmp u) ltrir3iytfaDe ueilt0srxr(rpnydal nmfctls)s2tr( oot0tetnifciat m2ul( s;t4 lerxfcto1oa e nvil(0 rxm(rpnydam emicsa()s2tau  no0tpeo i3iytlm uau onu)texnir iatlptean o;s t2toxm3oo4lmte iei t) Dtrumpnu1opxnii3tyt m2ra(vo u4texrir3io1oat aieo (0 euoxo nu4al nmicil(  Drrump;t4aleoioetatlsDranmp;u4alerir3oytoaDeau sls) 2xo(opnu4lle mnctas) rumxm ;u0opxnmiciltlm elu on()alxnxf oydom  ai ols srtmxrpou4om n ivslt arrr(r ou4opx  f3ilsfsDul(msn(0tltrmr iotlmDr ues;()teumxrpou4apee fei t)arrmu  nt0oexn f3iadfaDrm( p;(4arerio iytfmt  ivs;t) 2trxo io4optnmiei t  ruru pno0apeoifetadfa um(monu4tlenmr3ia1fm eau s;(  euo(mpnu4aptemivt sfsDrauro;u0apeo i3tat sDulnmont4tlxoxocia1fpD  ueol(0 2tmxmpoo4ape  nei ()aDrrxmo;t4tpxo fcilt m2uluvpnu4tltrmo3iotfmDrlu i (0s2xr(o iydal  mfcs ()sDrm(rpnt1aex mi3ildls2ulnvp;u4tltnmrcoytoa  auvsl(0s2xoirpiydomtelivils)s2uaxm ou1olt iociysla ul(vpnu4arenxr3oy1lpteauei;() eumxopoy4oltnlfcs t aDtr( pnt0tpe  i3ilt m2ul(vo;t0artnxr ty1lmt  n olt  eurio nudlltelfcsa() Dtm(root0aee io3tydlm2rmnvo t4treomr io1optrauei;(  ruo(m3oy4ll   netltf rum(mp;u4aptomo3iadfa2rluvpnu4tlenxr tatla  lu ilt)teuo(m oydaptnmnvilt s2ra( p;t4olxnioctasls ranmpnt4texrmf tydfptraueo t)setrim3no1al emfesa() rta( p;t4aeen ietytfs rlnmont)tlxnmf3todoaDelueilt setmxm nu4lm n nvtls) Drm( pot4aet  oeiadfmDumn pnt0 lenxf3ia1laD aues;s0srurirpiudlp nmnei sfsDrmu  oo0aexomoeiatfa2emums t0 etoxrcoydlmD  neils0texoir nodlltn fcs ()a2umx  no4aetn oeiat sDuau o;t0tltrif oytfp  aueils)teuoxo3oo4opt livt s a2ururpot4texn ieiasfmDrmnvs t0arxnifcoodomD  n o;s0 2trxr io1llte ictl(  Dua( onu0oetnioctatlm um(vs;u0 lxnmo3iotlp rlnvils) exoxrpiydllenliesa(  Dtr(mpoo4aleomo3ils aDrl(vs u)aexrxrciydfa ranvilt0tetrxm no1aleemnei ()artaxr oo1tlxo ictas m elu on()trermfcty1opDrln ol(0trtm(mpoy4alee fviasf rrru oou0alxn ieiysls2eanmp;t4 eenif3ia1fa   ues s0sruoir3iu4ol elnvs t)arrru onu4oexn oeiad aDulu s;t4areoio3iodfa rlnvils0s2xmiopiydale  iei s srrmx ont0oexoii3tlsfaDea(ms ()alxrxrctadlate ies t s2umim io1amtnmneilt)aruru  ;t1tpx  f3ils m eln s;u0artoxo3ootoatr n il( t2xo(o iydamtnmieil(fsDumxmpoo0opxoiiciadlm2rln on(4 exnmr ootfatrlueils srxoimpnodal emnetlsfa2urumpot4oeen i3ilsfaDuaumsnt0aexnxo3oodlate ivo;s)seumxopoudaleemnci t) 2uauro;u4oltn ociasfaDul(vp;t4artoircoatlat auvo t0 2tr(mpnu4altnmfvt sfarua(m ;t0apxnifeild mDumnmonu)tlxnif3iydfp ranvi (0sexmxopoy4ll  mnctl(f Dtaxmono0oltniieiltla2uanmp () reomf iatomt luvsls)s2tr(o oodopee fvt t  Drm(mono0altn o3tatls uan snt4 eermr3oodlat  n s () exrir3nu4ll nmfcs t)sDrr(r ou0oleo f3tatfa2emnmpnt)tltomfctatoaDraneil() rtrxr3oy4opeemivt () rtrumo;o1apt ifciltls ranvpn(0tlxnxr3tytlmteln s;t0 2xm(r3oy4llt  fcs ( sDtmxmpot1ope  feiytlsDrm( s;t4aeeomrctytfpt li ols0 2tr(opou1ole mfet sf 2tmxronu4oeen ociadfaDuln ont4tltrif3tydomDr nvils0 2toxr oudlltelnvslt)arumumonu1openmoetltfm eau pn(4 eeoif tydlmt  neol(0 rtmir nu4amtelnvtl(  2tm(m ;t0olxnmfetldlm uau o u4 ltrmo3iodomDeauvi s0 2tm(o oudoltn icilsfaDtm(mooo4tee  i3tlt m2uaump (0trtnioctytfaD auvs t0 2urxr3nudamenmivtl() 2rrx o;o0tpenmf3tlslm ua(mp u4trtoir3oatopDeluvo ()tetmxmpiu1ameelnci () 2tmumpnt0apx  iciadla rmnmpnu)tetrxfcoa1oaD lnes t s2tmxr ou1opeelict tfarrm(ro;u4apxoifeiyt sDelnvo;(0teenmfctotfpD anvi s0teurio3oydolenlnciasfa2ta(mp;t1olxniocias m2ulnmp;(0arxnxf3ty1opte ivil()trtr(m3ou1am  liei sfa2rmurp;o1alt mo3tydfs rmumo;u0artrmfcoo1oaDeln o t  2toir oy4ap  mnct t s2rru o;o4aeto ieiys m2ul(vont)alerxrctatlmtrlu o;t srxr(r oy1olenlivtlt  Duaxm ;t0teenmiciyt sDelumont4aexrif3tytoatraivs t t2xrio oy4lme lieiltfarrauro;t0tpeo f3ilsfsDulu s;u0trxnio oodfmte ueilt)srtmirpnudome lncslt srtaurono4tpt  oetad mDem(vs;t)arxnxf3iytomt  u o;s0 rurirpiy4ope lnvs tfaDra(  no4tptniociyt m rm(vont4 eeomf oytomtrlnvolt0texrir3oydal  lfeilt  2rm(r ot4optnio3iydlm ulu pnt0 rermfcoodfp e i o;( trumirpno1al emieiat)aDrrurpnt0teeoifctadfsDean o u4 eeniocty1fmtraneolt seum(m ny4lpt  fvsl(f Dtaumoot4opx  oetydfa umn onu)trtrirciotlmt anvo;( t2tm(rpoo4ap n nvtatfsrtr(r ;u1oleo f3ilt aDrl( pnu)arxoxrciydlaDrliesls s2umio ny1apeemictasfaDra(rooo4oee  oetltfmDum( p;(4 reoxf tydlp rlueilt0srxoxo3nydlmtnmnciatfa2rr( p;u1oeto feiyslsDulump u)artrxfcoo1omt  u i;t  ruoxo3oodlp emfcia()srururono1opeoiietatfsDelnvs t0aexrmrctytfpt lnesl(0s2umxm3iy1openliesat sDtr(  ;o0aetn ictydfm2umn o;t0 lxnio iy1lpteaneslt trumxm3iy1ape lnviasfs2trx oou4tex ifctyt m2uauvp;u4arxomo3oodfa rluvs t) exrirpoo1lpt  nciltfa2truroot4apx ifeiatfs2ulnvp u4trtnxo oy1fmDr iei;t  rxr(opoo1omee ict tf Drmxmpot0olxnii3iat s2el( ont0 etrirctodlp eai i;s srxo(rpoo1olee feias) rrmxrp;t0tpto ociatla uln o;u) exoif3oy1fmDe i il( teto(r3iy1apenmfesat sDrm(m ou0tlt ifeiasfa emn on(4alenmr3ta1lp  lnvil()trxmxo ou1ameemicia( a2urxr nu4apt ioctytfsDulu o t4altrmo3io1fate nvs s0t2trirpoy1optnlivs s  Dua(rpnt0tleoif3tytfm2elu sn()treomr3oy1lmt aivo (  etmxm3ny1op  lncilt  Drm(ro;u4opeomi3tys a eln s t)teeomf iadfp r uei;()s2urxr3no1ol   fctat)sDrmur ot4apeo oetydlsDrm( pnt4trtnif iotomDelnei;t)srurirpiu1om   fcsat)sruru pot0texn fcildfmDumnmonu) exnmo3ia1fp r u sls)trxm(m iu4optelictasfs2um(mpno0aexnifctldfs2ul( o;t0altomfcty1lmt  neo;t0t2xm(m iu1lp n ieil( s2tmum nu4tpx mietldfsDumump t) rtnxocoo1lmtrlnvi;t setrxr ny4olte fvs (  Drmu  ot0olxniiciytls rlnms;u0trtomr iy1omDe u sls srum(opno4optnmivi s) 2rmxrpoo4aetoifeildlm rln s;(0aetnmo3iotfaDranvo;s0 ruoxopoo4lm n fciatf rtruro;o1opxo feiat a rmumsnt0trenxocoa1lmteln o t0t2uoxm nodllt mivil(faDuaxr ;u0optn iciytfs2rlnvo;(4trermo oadlmtraivs s)s2tmxo iy1amtnlncil()artaur ou1tpeniocias m2eanmp t4 reoxf3ootlaDr ues s)trtr(r no4ale mnci tfsDrm(rooo4tpe mo3ils sDum(vo;t)alenmo3oydla rluvs;s0 2tm(opoydamt mivi s)srtrur ;t0apeoiieiadfm um( s u0texrif3todomDe i s;t0 etrim io4ope lnct t)arurumo;u1aexo ociydfaDeln s u)artnxr3ootfa eluvils0sexmio3iy4llt mnci ( a2umxm ou1aeenifetas aDum( o u)teermrcty1faDeluesls0 2toimpou4lpenlnesls aDtau  nt1tptnmfctydfs2emnvo;(0 ltrxociotopD  i olt t2tr(r3no4lmenmieiat)a2rax onu0tee mf3iytlm ul(vsnu)arxoxf3totfmDeai sls) rxmxr oydlle mncslt a2ra( poo1teeomfetlsfa2uanvp t0 reoxr3iadfm r iei s0srurxr3no1alt mietltfsDtaur ;t1altnio3tldfmDumumo () eeoxr iydlm ranvi;()t2toim3iu4ape  fvias  rumu poo4aleo f3tyd sDem( ont0aexoxf3tydlp r nvsls  rumxm3ou4llenmfcsls  Drm(r ;o0tltnmf3ildla2ulums t0alxnmfctotomDeauvs;s sexm(opiy4lp nlicia( a2ta(rono4alto f3ildla2el(vpn(4 rxnmfciytla rai sl(0sexmir nudlpenmnesa()sDtax pot1altn ieiatfs2umuvp () eenmo iydfp  livols s2toxopiodlptnmfvi ( aDrmxm oo0oeeo fciaslm2uauvo ()trtnxfcoadom rau ils0 2xoxm3oy1omt mivia( aDuau p;t1oet io3tysla2ranvs;t4 rtrxf ia1omte u s;s0tetoir3iudll nliesatfartm(m nu0tle mfcilt m2uaumsnu0 leoxfcia1fpteli s;s)s2umimpou4ameemfesas aDtax pou0texo feilslm uluvs (0 rtrxrciadlpt  i i;s0srxmxo io4ap e fvtl( sruaxrp;t4opx  iciasfm rmu on(4arenio tytlpDeanvils srtm(opiy4lptn ivslt sDrru o;t1opt  oeiatlmDulnms;(0 rerxocoadfp eauei;s) 2toir3ou1lltnmnvs t)s2rmx o;t1oetnioetad mDua( pn(4trtnmr3todfmt  ivolt0 rumxr oydam  mnvt s)sDtau  no0altnmf3iltfs2rm(mo;u4alerifciytla rluvi;t  exmxmpiu4ape  icils artax pnt1aptoio3iasfaDum( o;t)tetrif3iydlpD ai ols)srurxo oy1apt  ictl( srtaumpoo1aex mictys a2ea(ms u) rxomo iodfpDrlu o;t0t2umim oo1omte ncils  ruru p;u1opxo iciytfa2ean s;()tleomr3oo1lmtrln s ( s2uoiopio4amenmfcsatfa2rrxmp;u1open i3iydla2umnvs t4tltomocio1op  anvil(0 rxmiopiu4lp  mfcsa(fsDumxmpou0oex ii3taslsDra(vs;(4 ltrxr tadfp raies (0srtm(rpiodlp   icils) 2tm( pot0aleo o3iys s rmn s (0aeenxo3iadlat aivi;( texriopno1ome mfvslsfaDrm(roou0tpen fciytfs emu o t)aexomr3ty1lpD luei () rur(m3iu4apt lnet () 2ta( ono4teeomfctasls ul(vp u)tetniocoo1faD  uvi;s0 etmiopno4lpe livilt) rurxrp;t0aetnifciys mDrluvs u0altnxo oodlp eau s s)t2trxmpiudolee ncta()aDta(ront1tltn fcilt mDrm(mo;(4 lxomocto1lptelieolt0t2uoio3nu4ap nmfesasfsDra(mpno0texn i3iytls ra( s u4teenmr3ia1fmDranvo;s) etr(o iodopt mfeil( sDum(m nu4tetn iciatlaDum(mpn(0arxnxfcoodfa  luvo;( sexo(mpio1optn ncias s2urxrpou1apto feiasls rmu p t)trtnxo3tatlatran ols) 2xmxm ou1ll emncsls)artmumpou4olxo ictldlaDuluvs () ltrmo3oodla ran s s0srxr(mpnydoleemiet sfaruaxmooo0oee mf3tls aDul(vo;()tlxoxocootlpDrli s (0trxoxo iodlltemfvia( s2uaxr ;o1tpxn ocias s2el( onu)tltrxo oodoaDrlnvils0 2xo(m3iy1aptemnctasfartm(rooo0oeeo o3ildls2ea(msn(4 lxomf iodfatelivs ( sexoir ny4om  lfei (  Drru  ;o0olx moeildls2uaumo;t) eerxocoadfaD aivs (0t2um(r3nydop e nvt (farraxmo;o0oeto ietltfmDua( onu)trtrmocoy1lp e ivs s t2xoxo3iy1olt  fcs s arrmxr ou0tpx  f3tldlm ranvs;u0artrio iotlmte i s;(0 rxm(m3oodal nmncias aDua(mont0ope mo3ils m ranvs;(4tltniocia1lp  li o;t)sexrxm3oy1op  lies t srtr(mono1alx ifciysfs elnms u4aexomr io1omD luvol()t2xrirpiy4aptn icsa()aDraxrpot0alt  ietatfm2rl(mpn(0altrxfcio1fp  ln olt0srtoxmpio1amenmivs ( srra(rpot4olxn fetlt s2eaumpn() exnio iodfp e n slt)trxo(r nudamtnmfet s srum(rpou4texo fctyslm ulu sn(0 eeoioctodopDrln i;s sruo(o oo1lpe lfvi s aDrrx pnu4alx iictytlmDua( o t0alenif io1fpDr u o t0t2urio3iy4olt mnesl()a2rrurp;t4tpxnmi3iytfsDrlnvo u)trtrio iotlmt au ilt  exm(m iydlle lfcilsfaDum(ront1opxoifeiyd m uluvp;t4 lxnifciy1lpt  u o (0 exrxm iy1opee ietas)sDrru  ;t1tetomiciysfaDemnvs u)aeeoirciydfa  ai o;(0setmxr3ny1ol nmivtas)sDtmurp;t1apxo f3ils m2el(ms;u0 lerxf oodlm raivol(  2trimpoudopt miciasfarta(mp;u4tee mocilsfsDelu on(4alenxr3tytlpt aivil()seurxo3oy4lptemies ()s2tax  oo4apt  ieilsla elu o u0aetnmf3oodfpDeaneo;s) rumim3ny1apt  nvs s aDtm( p;o1ape moeiltlaDua(mp t4tlenmr iydomtrauvs (  exmio3oy1omte ivsatfa2rrxmono4opto fetldls2ulnmo u0 rxrir oadlptraueolt tetmim no1altn ictat)srur(rpou1tpe io3iaslaDra( snt)trtoirctytlpDe uvs;t0 2uo(o3oo4llenmieia(fsrurx pno4tpxnmfciysls ua( ont)trxoxr io1faDrauei ()tetmio3nudllenmnvtas)a2raur nt4ole ifctlt a rmu o ()teerio oydlmt  neol(0srxoxm3nodopen iesas s2rm(mp;o1tex mieiydfaDea(mo u0artomo tadop   u s;t  2toxmpou4lmenlivias)srrrxmpot4alt  ieiltlm uln o;t4alxomfcio1faDeauvols0t2tmxm3iudamt mnvtl(fs2trumpoo4aee  icils a ra(ms t)trtoxf iodlpD aivo;t0setrio nudlpee fes sfa2urxmo;t4ape  oetltfs ea( pn()aexnirciotlmt  n i () rumxr3no4olt mietlsfsDraxm ou1teto fcias a2rluvo u)trxrxf oy1oa rai s t)seuoir nydlmeelnvtatfs2rr( oou4alt iiciys a rln s u0 exrxo3oydfp  an i ( trtr(o nudop nmfcsl(  rtr( pnt0aptn i3ias m2eluvonu0trxnxr3ta1oa raues t) rumxo no4am  licsas  2uaxmooo1optomoetatlmDul(mpnt0 ltrir3tydfa eaivolt)t2xrimpou4lltnmivi t  2rmxmpnu1aet ifeiadfa rm(vo;t) ltnir3oydla e ivo (0seurxm3nu1lme  ivtat) rur(mp;o1oetn i3iltfsDuau sn()tlxomrciotopt aieo;(0tetmxr3ny1amtnmncsa() 2umum ot0alx ioctytfa2el(vp;t) lxoxrctydoatrlneil(0trtr(m3iy4op e fcia()sDtaumo;t1oexnif3tadla rl(vpnu)tlxomf3totlaDr ivsl(0s2tm(m iu1alt  fvslsfarumuro;o1aptomi3iydfa2umuvs;t0 eeoxo iodopDeaivs ()sexrxrpno1olenlics tfsDtrxmp;o1apxo fctytfsDelumo;u0teerif3ootfaDrai i;( s2toxmpoo4ol n feil()artrx p;t4tptn i3tldfm2elnvp t)arenmo tatlmteau s;t0s2urio nudomeelfvtasfa2rmxr no0oexomi3tytlmDuanmo;t)teeniocoodoat  ivol() euoir oodame mnvta( srtaxmpou0alenmfctlsla rmuvo;t0areoiociy1optrlieo t)srtm(o iodlpt lncs tf Dtax pno1olxnio3tysla rl( pn(0 lerxr ootlpDrai s s0 rtm(o3nydolenmfcsa() rraumpot0oeto fcias sDem(msn(0 etrmrcoy1lat  ueslt0 eurxo3ny4ol   ncils) Dtrxr nu1tlt ifetas s2ulnmp t0artrif3tatlmtrli sl(0 etmio oo1lmtn ics () rtm( p;t4opxomfetls a2uanvsnt0alxrif3tydopDe n sls trxoimpno4lptn nvs (  Drr(mo;t4oltoii3tld a2ul(vs t) rxomf3ootomt luesls trtoxr3iu1amt  nvsat)s2tau p;t4ale moeiydfs2rmnvpnt0trermf3ta1omtr neo t0 ruoxr3ou4lltn ivs t  2rax o;t4tlen o3iys m2rluvon(4aetrio iotoa ean o s0texm(mpiy1lm  mnctlsfaDumu o;t0altn o3tysfsDrmnmp;(0arerio3iotla rlivs (0 2urxo no4lpe  fct sf Dtmum ot0aeeoioeild sDulu pnt)alenmr iodfmt lu sls trxo(r iu4opte ieil(  Dtrx o;o0tlenifciat m2ea(mp t)tetomo3iodlp e uvilt0seuoxr3oo4lpenlfcta(f 2raxmono1alto oeias a2umu pn(4 lxomf oadlmDr neo;(  2xoxr3iydop   fvia()arrr(ronu4texoioctas s2rmn s;u0aeeoircio1optrlneils s2triopiu1oleelfesltf ruru poo4texo oeias mDua(monu)aetrxo ootom elues;t) euo(mpoudamt  icsasfsDtm(ront1apeo octad s2ul(vont4trtnir io1oaDelivo;t0t2tr(mpoy4opt  ncia(fsDrr(moou0tpt ifcild mDemu s t) eeoxoctotfp e i i s0trur(rpou1opte neil() 2rax  no0oeto ictldlaDua( sn()arenif3oadoptr ues t)texo(o io1alen fcias srumxm nu4altn f3iatlaDranms u0 ltrif oo1opD lies;s  exoiopiodomtnlivi ( srtm(ronu1olto fetldlsDuau s;t0 lerxr3tatop rluvi;t srtoxm3iy1lltelnct tfsrraxmpno4aexomieildfmDra( p t)tetnio3iatlm eluvi;(0trxo(opiy1op elfcias  rra(mpnu0tlxo ictyt a umu p;t4altnif3io1la rln o t)teto(r ny4lm nmnesas aDuru p;u4aetnii3iytfsDea( p;u0 eeoxfcio1opDeau ols0s2um(o3oy4aptemfviat a2ua(mpnu1openmieiydfm eau s;u0 etrirctadomte nvilt teur(m oudamt  feilsf 2rmxro;o0tle  ietld m2uaums u)aexoxociodfmDeli s;t)srxrxo3io4alenlfvil(farraxmpno0tpeo o3tas m2uauvs t) lxnifctodfa  auvilt0s2umir oudlm  mfvtlt srtr(  ot4olxnioeiysfsDra(mpn(0 lerif ta1fmDe uvo;(  euoxm3iodoptnlfeil()srtrx onu4aeeomfciysfs2rmnmo;t4trtnxrciadla r nvi;s  2uo(rpoo1omtelfvs s arum( p;o1opxoioetyd mDumums;u4aetomf oa1laDe uvilt0s2tmxr nydam e nvta() rta(mpot1aptnmiciatls umu s;t4 eeomf3oo1op  li sl(0 euo(rpiy1lpt lfciltf rrax  ;t4tpt  oetytfaDrlnmo;u4 etrif3oa1fa eln s t)trtoio3io4amt mfcs ( sDraumpoo0oleomfetytlsDrl(vs u0 etrxo3iydomDr ivsls0truoxm ou1lme lietlt artax  ;o0tltomo3tadfsDulnms;(0aeerifctydlm  lnvsls s2uo(opoydlptnlfcs s)aDuax pou0olenii3tytfm el(vo;t0 eermo3totfpt  nvs;s seur(m3iy1aptnlnvilt) 2urx  ;t1tetn i3ils s rm(vs;t)trxoxf oodfa elneslt0setr(mpiy1lpe mfctas  rumurpot4tpeomi3iydfmDea(mp;(0 leomf oydoate uvil(0trxmio3oodlme  ncils sDtm(  oo4opt io3tydfs rmnmo u0artnxrcia1om  aies;s0 exoim nu1ole mictls) 2raumont1ape iictlt m2ra(vs;t4aexnir tydfmte i s;t) 2umxo3iudllenlnvtat)aDrrxr ;o4olt iociatls rmnmp (4texrifcia1op rli slt0s2toxo oy4opee fvi s)s2ta(monu1tpeoiieiltls2uln snu0tltomo iydlaDraiei;t s2trir ou1lleemnvt t)aDraxm ot0tpenifeiad a2rl(mo u4trtrifcoytlm raivo s0trxrxo3oy4ole  feta( srumxmoot0altniocildlm umuvpnu)tleoxo todlaDrauvs t0texriopoo4apeelneiasfsrum( o;u4aexo ietls s rmn p u0texrmf oadfa   neslt trtrxo nudomtemfvi ()srumxmoou4tpeniicils a2ulumo;()teerxf iatlat luvi s  eumxo3nodaptnlncia(  2urxm ot4texn feiydls2eaumo;t0tlxnxf iy1fa  anvsl(0texmio3iodopeemies sfaruaxmp;t1texo o3ias m2elu pnu)areoxr ta1omD lnvi;s0srxmir3oodamee ics sf 2rmurpno4altn iciadla2uan s (0 reoirctotlpteaues;s)srxmim oy4aptnlivs ()s2urx onu4aee io3iysls umnvonu)aetoiocootlmtr u i;t)teum(o3oy4ap  miesl()a2rau  nu4aetnmoetltfa2ulumont)tetnxo3tatlpDrluvilt setrxm iu4ap  mnei tfsDtaxrp;u4altoiieiydlm2ul(vo;(4alenmr3ta1fateaieo s  exm(m3ny4al emfvs t  Dtauroot0aee mf3tatfa2raums u) rtrmr3ootoa eanvi;(0trto(r oo4omt mnci t)sruau  ou4ope mfeiad a2ea( s (0artrmo3iodfaDeln s t0 2xmxrpnu1lltelivsa(fsDtmurpnt1tlxn f3iydla rmn pnt)aeerxo3oodlaDrau ols t2trir no4apenlivs (faDuaxm ot4opxo i3iasfmDra(mo ()areoxfcoy1opte nvils0t2xoio oy1om   feslt  Dumx oou1oeenio3tlt m2ea(mp u4trxnxfctotlp e n i;(0 2uoio ny4optn fvtat srraumooo1aetn iciysla em(vsnu4 lxnxf3iy1omD anvi;(0sexoxmpio4ol  lnes t sDururont4opt if3iyt mDeaumo;t0alenirctadlatean slt0s2xmio nodll nlnvs (faDtr(mooo0tleniicildla2rlnvp;(0tltrxf tytla  ai i t0 rtm(r oydlmtnlfvt t)arrr(mont0tleo iciatlmDeauvonu0 leomr3iy1oa elu il()t2tmxrpny4opt  ietl(  rurxrpot4oexo o3iyt a2rl(vp;(0 lermo3iodop  lnei s s2ur(opoy4omenmnvt t a2taxmpot4teeomfetld s rl( p;u)tlerxf3io1laDrlueils)t2toim3iydam emicsa(f 2ra(mo;t0oet if3ild m ra( p u)tetoxrcoytfp ran s;s0sexr(o3iy1lptelietl(  Dtrxmp;o1apxoiictytfs ean snu0 lxrmr ty1opt  ieolt0t2xrirpoo4omenmnvtas a2rmxmp;o4oexnmieiltlm rm(mp;u) rtrmf oadfpDelivi;s teumio3io4op elnviatfarur(r ot0ope  oetatlm2umu sn()tlenmo oatopDraiei;t tetoim oodlptelncil(fsDtmx o;u0ape  i3tls mDemumo;t) exomo ty1fatrlies s)s2tm(o3oo4lltemiesa()srtrx o;t1oexniietadla uauvs;u4tlenmf3iy1lm rau ils)s2xmxm3nu4lleemnei tfaDta( pno0tlxoii3tldlaDel(vpn()aeerifciytfp r u slt)teurxm nu1omt  fci s arrrxmp;u0aexn feiadla2rm(vp;() rtnxr iatfaDr nvo t  2umiopiydam  mnvtasfaDra(ro;o4tlen f3tlt s2ranvont) leoxfcta1omt  uesls)sexoimpoydamtnlicsa()sDtmxrpnt4tle  i3tltlsDeluvsnt4 rerxr to1optr nvs;t)srxoxr3iydal   ivs ( a2trxm nu0tlen ocilsfa ea(vpnu4trtnxocty1lpt anvolt) etmim3iu1alenmiei sf rrau  ;u0apt miciltlmDemnmsnu)arxomr3oo1fm r iei s t2xo(r iy4lptelfctl()sDtmumpno1tlxn fetasla ulu p u4tlxrmo iadlmtrau ilt0trtr(m3iudaptnmietas) rrmx  ;o1alxnmfetytfa eauvs t4trtomo3oatom e ues t0 rto(m nudlp  mnvsltfs2um( p;o4tleo octadfa ul(vpnt)aeeoio3ootlpt livolt) 2umirpiy4lltn ivtasfaDrmx p;u4optn ieiat aDrmn p;u4aetrir3oytlpDelnvo s) 2xoxopoy4ll nlfvtls) rtrxrpoo4tleoiietad m2ulnvp t) exomr3iatlpDe ueils  2uo(mpiodope lnvi t)aDurx o;t1aleomf3tad m ra(mp ()alerxo3iy1fa rauvs (0tetoim3nudome mneta() 2umxr oo4aptoii3iys a2uanvo;() exoif3ta1fa e nvs;t)trxm(mpoodope lfvt s s2uau p;o0aet  o3tldfa ul(vs (4aetrmfcoydfmtraneo;()s2xm(o nu4amee icsas sDrmu p;t0apx moeiyt m2ra( o;t) rxnmo3oodopDeau o;t texmxr nydapeelfci tfaDta(rono0oetn o3tydla elu snt0alxrir3oy1fa rli ol(  rurxo iu1lp n nes s srrr(mpoo1opx miciat sDulnvsn()alxomfctotlm e ieslt)t2xmim3io1llen ivt s  rrrx o;t4tet  ietadfs ul( onu0arxrmr3io1latrli sl( trurio ou1lp elnvi (  2trx p;t1ape  oeiyd s eluvpnu4tltrmrcoo1la e nvs (0sexrimpiy1lptnlfesa( sDrauroou0altniiciat a2ua(mo;u0alxnxfctytlaD  nvilt0teto(rpny4llt mfvt sfa2tax  oo0oetniieilsfm2uaumpn(4 lerxociadlaDeanvi;(0trumxr3ny4alt mfcs tf Drm( ono4olx  f3iadfaDuauvont0 lenmrctytoptr n sl(0setriopiu4opte nvt (fsrum(rpou1optnii3iadfs rluvon(4altrxr iydla ran o;t0teto(r3iudam nliviatf Duaxrpnt1oetn oetlsls rl(vs;u4tetnio3iydoate nvo (0trurim3nodol  lfci sfa2taxmp;t0oltnmf3iad m2ul(ms;(4tltnxo oydfmteluvols0 rxoio no4lp  liesat) 2urx  ;t4apxomo3ilsla el(ms t0teeoxrcta1opDrln i;s0 2tr(m3no1al  mfcias)a2rmx pnt4texoiieiaslm2ul(mo u4trxnxo3todfm r nvo ( seuoim3oodom  lneta(fsrrr(mpno4alenmf3tlsla ul(vs;(0artnifcoo1fmte ivol(0s2toim3iu1amt lfei tfa2taxmoou1tetnifeiltla2emumpnu0 lermo3oytlmD an i;(  etrim oydaltelnet tf 2tru pou4opt mf3iad mDuanvp;u4texoxf3oatlmt aueols)seurxo3oo1lpe mnesls) 2taur nt0olxoiictydlmDea(ms;t)alxrmf oa1laDraueols) exrim3iy1lmenmicsls)s2ta(ro;u0tlenifeiltfs2rmn s t4 lxrxf oo1lptr uvilt) 2xrxo io4om e nesltf Dtrxrpou4altnifeild a2rlnmpnu)tlerxocta1op   u s;(0t2umio iy1olte fviatf Drmu ono0tleoiieiat s2raums;t0artoxf3tytfmt anvs;(0 rumio oo4lp nmfvs t aDrmx ooo1opto i3tydla umnmo (0 etrmr3oytomDeanvil()truoio oo1amtelnciltfarrmxroou0oet  i3ildlaDuau on()tlxomrcia1fpte iei;s)tetoxopoydlmt  net ()aDrmx pno4aexnmo3iytlsDel(mo;(0aexrxrcootfp  liei s0 etrxr3ou4am  mfvs sfs2trxro;o1aexnmo3tls mDum( s;u4 ltnxfctatlaDeli o (  2xoxr3iodap nlfvt s)sDra(rpnt0oexomfctas a2em(ms t)texrxr3ia1oateaivo;t)s2tmxo iydomt  fei ()a2tmx ont1optoiociyd s ra(vonu)aetoio iytfm  an o t0trtoxo3oudam  mivia() rrmxmo;o0tlt  feiad s elnvpnt0 exnif3iodfa   n i t s2xmim ny1opte fct t  2rm( ono1oleomfetlsfs umumo;(0 ltoif oy1lp elneo t0texo(r3nu4lp nlfvs (  rua(monu0tltn f3tlt s raumo u0arxrxo oydlmDranvs t  exoxm3oodamtnlictlt  Durx p;u1oltnmfeiat m2rauvp;t0 rerxo3tytlp r nei s) 2to(opnodopenlfcil( s2tr(r ;t1tptomicildlmDrauvont4tetoio oatfpDrauvs t)seurirpiodalte ivsl()aruax  ou0tet mi3tysfsDra(ms t0tlerxo oatoa rauvi t  2trxopnudlle lfcta(faDrrurpnt1tex  icias s2eau o;t)altomocootfmD au s;t  rxmirpiu1lmee ivi sfsrrm(rp;u1olt  i3ildla ua(vo;(0altrxf3ootlaDeanesls)seurxr3oy1aptn icsa() rumxmont0openmo3iatfa uanms u4arxrxf iotomD lueils)t2uo(mpoy1lpte feilt)aDtm( pot1tpe  oetytfm ul( s;t4 exnmfcoytfmt  nvi;s s2trxr iy1omt mfes t  2taump;u1tpenio3tydls rl(mo ()texnio3iotomtrln i;t t2toxm oo4ope mnvsas aDraurooo1teeoiiciydlm elums u0alermfciatfateli o;(0trtmxr3no1lm nlfes tfartmu p;t1tltoifetasla2elumsnt4altnio3tadop eauvo;t  2tmxrpny4lltnlfvilsf rumurpnt0oexomociyd m2uaumsnu4alxnmo3oy1fpt ln o ( srxoiopoydamtnmics t) 2tmumont1aptoioeils m ea(mp ()tlxoifciytom eanei;() ruoxo3nodol  lnctls srum(root4tlxn f3tls sDrmn o u)texnxf iadlm  lieils setrir oy4lle mnci t aDua(rpnu0oee mf3tys a2uln snt) lenmf3iadla ran o;(  rxr(r3ou4aptnlnetas srrr( poo4tee mf3ilslm rluvpnt4arenxo3oadfm raivsls)t2tmxmpiodlpenlnvsl(faDtaxmpou0apeomietldfm2ul( s ()arerio oa1laDe n olt seuo(rpio4omtemnesa( aDtmxmo;t4ape iicildfsDrln o () ltomfcootoatrlnvolt0t2xrxrpnydopte ietas s2trxm nt1alx mictydls2ul( o;u)tlerxo3oytfp ran il() 2um(rpny4ap nlnviltfaDtru  nt4opxomi3ias m rl(vo;u)trermr totop r neo;t0seumxr3ny4lmt  net sfa2rax pnt1tleo oeiasls2em(vpnu0 lxnmociotfa eauei s0 rxrirpiy4lp emfvta()arrmxmpno0altnioetyt mDea(vpnt)tetnir ia1om r ivol(0tetoxmpiu1lmt lnvsl( srrmxm ;t0tet moctld s2umump t4 eermf3iytopteauvi;t0 2xo(r3oo4amt lnvia(  Drrump;u4alx iicilsfa rm(mp (0areomfctydfmt aivil( sruoiopiudam   ivs s  Drau ono4aee  oeildla2umu s;()aeermr io1faDrlnvi;s0srtmxr io1alte ici t)a2tmx onu0tptn fciltlaDrm(mp;(0 eeomo3oadfat  nvi;t0srxrxr nudomt mnvi (fsDtm( onu0tet  f3ilslsDelu s u4 ltnmo3todopDe uvo;t0srxm(r3no4am nlfcs tfs2ur(mpnu1tet iociytlm rmuvs;t)trerxr3ia1la elnvo t trtoxm nydapte fci (faDra( ono4ole ii3tadla uauvs (4 lxomfctydoa eanvo;t  rxoxm3iy4ameemncs (  2umxm ;t0tle iietlsfm raumsnu4 lxoxrciadfateaneo s trxm(r3oo1al  mnctls) Dtm(  nu1oeenioeiadfa uanvs;u0tetnmr3ta1latr nvi;t)s2uoxrpnudoptelfcs () 2ur( pnt0aee  i3iysfs eanvs;u4altrxfcta1oa e i i;t t2xrxm iu4lm emfvt (  2rr(rp;o4tetoif3ild a rl(mo t)tlxrir iydlat lueo ()teumirpny4lle mnvtas  rtrurpoo4alx mfeiyt m2eluvp u4tlerif ta1lpDrlivi s) rumxr3iy1open ietat) Draurono4aptn i3iyd aDrl(vp (4texnio ty1lm  anvi;t  rumxm3nu4olt  fcs t)sDra(m ;u1openmf3iasfa2em(mp;t)arxoif oy1faDean i s srtoxr iu4omtnmfet (fa2rr(  ;o0texomiciad s2elump t0aleomr3tydoptranvi t) 2to(m3no4ll e nvsltf Dum(rpnu0oeeo feildla2ranmo;t4teerir3totlateau s t  2xrxmpnodap emncslt  Dur(m nu4tpeomf3iyslm2ea(mpn(0artnioctatop   ues t0trumxo nu1omeemncta(fs2rmxmono0teto octltfaDumu snu)artnxfciytfpDeauvi s0tetmxrpio4lle mnci sfs2umx  nt1oex ifciatlmDulnvonu)tltoxf3ty1oatrauvs t0srto(m3iydapt miesas)srtr(  ot4olxoii3tad sDra( snu)aleoxr tadlp rai olt0t2xm(m ny1al emncs tfaDrmxmpnt0oexnii3tysls2raump u)trtomfcoatopD aues (0teto(r3oo1amenmnesl(fsrtmxrpno0aetn ieiltls2ea(ms u0areomoctatlmDrlueo s0texrxr3ny4lltemiesls arrm(r no4tltomieiad sDranms t0tlxnxfcoodlp  aivolt0teuo(rpou1ome lics (f 2tmu  ;u1alt mieild s eau p;u4 ltrmocta1lpDeln slt srto(opnydlleelnvias  2uaum ;t0apx  f3tytlsDulu p;t)trenio oy1fatranvil()srxoxm3oo1lmtnmfciat  rrrxmp;o1tpe if3iatla ean o (0trtrxo3oatfa e n s ()srtoxr oo4lp e neias)sDurxro;o4tltoifcils a ea(mont) rerxrctadlmteau s;t0 rtm(m3iy4oleelfcsl(  Dra(mont0apt  o3iltfa ranmp (4tlxoxo oytfmDrlu s s0t2xoirpoudal   nvsls)a2urur ou4apto oeiasfaDean s (4 exnxf tadfpD  uvi;s srtrir3ny1am   nctas  2ur( oou4tetn o3ilsfmDrauvont) exnio todlatrli ol() etoxo iy1apeelnvi (fsrumur nt4optn ocildls2uauvp t0alenxfctydoa elu o;s)srxm(r nydlle  nvilt  Dum( oou0ape iictld mDranvs;u)tleoxr oatfaDeanvo;t0setoxr3iudlptelivsl()s2trum ot1olenmoetas aDel(vp (4trenmr3todfm e nvs s0 2uo(o3oudop e ictls  Draxmpoo1alenmietadls2ran s;u0trerio tatlm rlies s0 2um(o3oo4lpe  ieiatfs2taurpou1oetnmocilt s elumont0trtnxf3to1omt luvsls0s2trim3oodlpe mfeta(fsrum( p;o4tptomf3ias sDul(vo;(4altnmo3io1faD ln il( sexr(mpou1om  mfet t)srurumooo4olx  f3tasfsDeau o;u4arxoxo oytlmtr ueo;(0t2xmxm3ou4apen icsl(  rtrxm no0alxoiiciltls2rau o u0tetoxf3iatlp r ues;( s2uoxo iudll  mncs (faruaur ot4texo i3ilsfmDemu p;t0 eerxo3oo1lpDr uvsls)s2toxrpiydlme mnvias  rrmxm ;o4oee iocilt m ulu snu4trtrmf tatla rluvo;s0 euoir3oo1llt miei s) 2ta( pnt1aetn ieiatfa2rlnmont0altrifcoydlate i slt trur(r3ou4lptnmnes s sruaur ;u4tle  oeildlm2eanvo;t) lxnxf3ta1lm e n o;s) euoir iydapen ies sfsrum(mo;t1teenmo3tysla2ean p;()trxoxocoa1lat  ueo;s)seuoir3oy4lm  mnvtlsf 2tm(mp;t0tleoio3iadfm ul(vs;()alxnxf3iatoaDr nes;s) eum(m nodolt lfvtlt  rurumo;o4tpxomfeiltfa2umnms t) eenio oodomD au o (  2uoxm3ou4lme  fvsat  2rmxrp;t4oetnif3ildfmDrm( s ()arerir3iotoatr u i t setrir3oy4oltnmfet tfa2rrxm nu0olenmieiad mDea( p;u0tlxrxf oodoate nvi s)trtr(rpoydam n iei tf 2uaurooo1tlxniietaslm2emuvsnu)trtrmf3tadoaDr i olt) 2trir io4omt mnei s)sDumxr ;t1alx mieiytls ea( ont4arxnircoa1opt anvo s  rxoxopoo1lle mfcslsfs2ua(rpno1opeomictldfm2rlums;u0arxrxfctatoaDelnvols)texoxrpoo4ame  icsas a2rax  ou4tpxn i3ilsfs el( o;t) rxnmf3iodomDeauvs;t0t2um(m iudll nlncil(fsDrmx p;t0tex moctlt s2rm(mp;u)trermo iotopt an i;( t2xr(r nydlltemnvsa(fa2tmxmpoo4opeo f3ilt sDulu s ()areomf oatfpDeau ilt)trtrimpnu1oleelfvsa( srumx p;t0ale  f3iadlaDrauvon(4aexriocta1omDran o;s t2trim3no1apeelivta()a2raxrooo0opeomoctlslaDrau pn(4 etrmr3oodlm r u slt trxrxr3nydlme livs (farua(mp;o4opx mf3iydla ran pnt)trxnio3ia1lmDraivs s0 exoxmpio1llenmncils  rtrum oo1teeo ociasls eauvo ()trxnxo3oo1fmtelneil( s2um(m nodlpeemfciasf Drrxrpot1aetomfciadla2eanvpnu)aleomfcoatopte uvs;t)texm(r3ny1aptnlncia(  Drrxrpoo1opxnmieiysfs ra( p (4artnio3io1lptrauvi t) 2tm(rpio4ol  lnvslsfa2tmxmont0tpxnii3ilslsDem( o t0 exrxf3oatopteanvilt)s2toxmpiy4opeelfctlsfaDtau ono4ole if3iltfm ul( o;(0aeenif3oydoptraivo ( truoxo3iy4lm  mfeta(f 2rrxr nu4tptniieild a rmnvp u0aexnxf oatfpt livo s)sexm(rpiodame lncsat)a2rrum ;t1tlt ifeiadfm2elnvpnu4 etrmf3totlm rlivsls)truriopiodope lncil()aDuaurpnt4teto oeilt s2uanmp (0tlenif3oadlpDrauvi (0 rxoir iudapt  nvtat arrrx oou0teenmoetatlmDum(vp;u0tetrxo3iadop e nvo s0setrxopoy1lp nlfvilt arrmxm ;u1apenmf3iasfmDuaumsn() lerxf3ia1oat ln o;() etr(m3iu4opeelieilsfarumum nu1tpx iiciltls el(mont0tltrxo io1fa r nvs s0t2tm(mpio4lmt mncsa(  rrrx ont1aeeomieiysfaDrmnvs;u0tlermrcto1fa eln o;t  rxoio3no4lm   iet ()sDrru ont0opeomietysfs2rmuvs u0 etrmrciadlp  ln sl( s2xmio3iu1ol nmictl(fs2taurpnu4olt mociltlm2uluvonu0aexnxf3ta1fpt  iei;s setr(mpoydap e fei sfarrmxm no0tlxnii3tldlm ulu s (0aexrxfcoodfa ranes;t) 2xrxm oodomtelnvi () Dtr(m nu1oexomoeiydla2ea(vs () ltnmo3iadfa elivo;s  rumxm nydam e nvias  2rm(ront0opx io3tldla ul(vo;(0teeoifcootfmDeanes s) ruoxrpiy1ll emnvtl() 2rmxmpnu0tpx mieilsfs ul(msnt4 lxnmf iatfptrlivilt  eur(o iy4lmt  nvt s sDurxm ;u4alen o3iad sDemnvs t4tlenif3oydopD luvi;()t2trxo ny4optemivslt  2trurp;u4apeoio3iltfmDrl(vsn(4aexriociydomt lnvi;s0s2umxo nydome livi sfaDrax ooo4oet ii3tysfaDuluvs;()alerxf to1oa  lnvs t)srxmimpoodamtnmnes t)srtm(m ou0olxn f3tlt a2rlnvs u)artrif3oy1lm rau il()srxr(r3oy1ap n ietlsfsDumxm ;u1aetnmo3iltfa el( s u) rerxo3oo1laDrlu s;()t2xoxrpoo1lm e feiatfaruaxrooo0tlxomi3ilt sDem(vpn(0 lxoxr3io1lmt au s t0sruo(r iydllenlfvsasfsrur(ronu4ole mf3iyt mDul( pn(4trxnif iatfpD  ieo;t trumxr3io4lm nlicsls)s2tmumono4tlxn i3tldfsDum(vpnu4tlermo3ootopt  n o;t) eum(m3iu4ole mfcs s srtau  ou4aeeo oeiad a uln p;(0texoif3iydoateaivo t0s2xr(r3iy1lpee ivtl()aDuauroot1tltomo3tyd mDrlumonu0 etnxo3ta1latr ivo;()s2uoxo iu4lp nlicta( s2uaxrooo4aetnmfciasla emuvo (4altoxo to1fp r nesls0 rxmxrpiu4omt lfvs s sruru poo4optn fetlsfa2rmnvp;t4texoxf3iy1fpte i s t)s2tmxopoydapte fviasfsDtr(mpnt1opt  o3tysfm elu s;t4aetoxo3oo1fa ranvolt) 2toir3no4omtelicslsfa2tm(m ou4altomoeiadfa rlnvonu)artnmf iatopt  i s;( t2tmir3nu1oltemfet sfaDtrum oo0apeo i3iaslaDemnmont0areoio iytlaDe u i;s  rxmxr oy1lpen nei sf Dtmxrpnu1tltnifciat sDea(ms u0aeenmocoa1om  au ols)texrirpoy1apt lfvsatfsDuaur ou0oexoio3tlsls2elnvp;t4 ltoxo ta1fmtr neo (0 rxr(m3nudomt  fcia(  2rmxrp;u0olenmfctlsfs ran s;()aetrxrcoydom eai o ()srumim3io1om  mnvsls)a2trxroot0aee iieilsla2umn p (0arenxo iydoatean i (0s2xoio3oydal emivt tf 2uaur nu0tee  iciatlaDeanmonu0teeomr ootlpt  uvs;s srtrio iydam n ieiasf rrmu  ot1olenmoeiasfsDuaumpn() lenmr ootom rli i;( seurxm iy1omen fcsatfa2umuront0apt  icilt aDrm(vpnu) exnmf3oytopt au i;()srum(opoo4aptnmfvi s  rtmxm ot4openmieilsfsDrluvon(0 lermf tatfaDe nes;t)texrxmpoy1lltnmnciltfartmxr nt1aeeo oetltla ranvp;u4areoxocoa1oaDeaneslt  rxoio iydomtn nviatf rtmxmp;t1tpenif3iydls ulnvo u)teeoxf oadoat an s;s0s2umiopoy1altelivt () Duaxrpno1oetn fciaslsDrmu s;t0trtnmf3tydlp eluvo s s2xmxo ou1omtnmnci s)srum( onu4oexniocilt a2uan snt) rxrmr oodoptelueo t0t2xoxo3iu1lpeelfciat sDuauro;u0ole  fctlslm ra(vsn(4tetnmf io1fmDraivs;()trxmimpno1lp nliciat)sruaumo;o1alxnio3tls sDum(ms;t) reoio oa1oa ranes;(0t2trimpio4oltnmiviasfartrur nt4olen fctysfm2um(vs (4tlerxrcta1lm rlivs;( srxr(o3oy1lp nmictat)srrrurp;o0altoiocilsls2ran sn()aetoxr ty1fpt aiei;t0s2xo(opiy4lp nmict s)srrru  ;u1aex mfctas m2um( o u0arxrxf3oa1lpte n i;t)seum(o3iodomte nesl(f Drrur ;o4tpxnio3iasls uluvsnt)arenmr oatfpte uvo s s2xm(r oo4lme  fct s) 2umu  nu1oeto ociasfaDeanms () exoir3oa1lat lu i () rxoiopiy1alt mivsatfsDrrx pnu0oetomicils mDuaumpn(0texoif3oo1laDe uvs ()trumio3oudal emieslt)s2um( pot0aeen fetat m el(vo;t)arxrif3oydoa e ies (  exmxr ou1lmte fei (fartmu o;o1alt ifeiytfm rauvsnt0alerio oodop eanvsls)s2tr(m nudlmenmnctlt) rraxm oo1alt  iciasfs rmnvp t4altnmo3ia1oateai o t0texrxr3ny1apenlnct t)a2ur(mpou0tex mfctatfa2ranms ()tlenio3iytlmD livi;(0sexrxm iu1am   ivil( sDra(r nt1oexnmi3tydlaDranvsnt) eermo oytfm raneo;s0texoxr3oy4optnmnviat)aDuau pou4aeeoioetat sDeanvp;(4aetrmfcoydfpD  ivo (  2xo(rpiu4llen fcta(f 2ta(  nt4oltn oetys aDea(vp u0 etoxrcto1opDraivo;t)texoxr3no1open fcs (faDtmxmoou0oetniociat sDrmumo;u) rermo3oytfmt lueol()trxmxrpoo1al  mici t)artax o;t1oex ifeilsfm ean o u)alxnirctotopt lu o;(0texrxrpiu1al  lfeta(fartrxmont1ape mictldfm ra(msnt4trtrmo3to1fp rliei;(0trtmio3iodale  net s)srta(mo;t0aleomfciysfsDeln pnu0 rtnio oa1opDrlu olt)t2trim nydlpeemfct t  rrmxmp;t0ale ioctadfs ra(mp;t4areoifcoodlmt lnvs;s0truo(mpny4alen fcsl()sDur( ont1olxomiciatla2rm(vsnu4texrir oytfateluvi;()srxrio oy4lle mnvt (f Drmumpnu4opxnmi3iys a2emnmo t0 eerio3tydfmDeln i s  exm(o nu1al elivt s)s2tm(rpnt1aeeomfciydfs eanvp t4aeermo oa1lpte uvi;s texoxo3oy4al emfcil( a2umx  ot0tetomiciltfa2rlnms;t4 rtrxr ootlmDr i ilt)srtmir3ny1ap elnctls)aDrr(mp;u4apxoif3iadls ra(msn()arenir oy1lm eai il() rxrxrpoydlp e nei t arta(rpno1opeoifctasls rau s;u4aexoif3oydoptelneols)t2xrxo3iy4aleemfeiat)a2rau  no4oex moetatlsDra(vs (0aetrif3tatlm rln ils  2xoir nydam   ivtls) 2tm(r ;o0olxo oeiyd s el(vs t)aetrxr iadfa e uvsls0t2uoxo3oo4llt  fci sf Dtrurpno4tee mfciadfsDrl(vp;t4arxrmo tydomDr nvi ( truo(m3ny1lp nlicsa(f 2trxm ot4aexnmfciydfaDum(vont0trxnxrcta1lptr n o (  2xmxr3io1lm  mivslsf 2um(  ;t0tee  fciys mDua( onu4 rermfcoatlaDrli s s)t2trim nu4ole lieslt)a2rmx o;o1opx ifcildla2ua( s u4treomo oy1fmteluvolt trxmiopoydame lfctas sDraumo;t1olen ociadfsDemu o;(0tltnxociotomt livo;( sruoxo oo4lpt lnesas a2tmump;o1tlxomi3iadls umu s;t4 eeoif3iy1lpt lueolt0tetoir iydam  mfcsas  Dtr( pnu4opxn oetlslsDemu pnt0 rxomfctodlmDeliei;(0seumxr3oy1ope mnvs s) Drmu oou4olt mfetls s rm(msnt0aexnmrcoatoptelneo;s  2trxopoy4llt  ivta(fsDtrx ooo4opto ictasfm rm( o u) rxoxr3todlp rlivs s0texmio3nu4llt  fei t artmxronu0tptnmietad s2emn p ()arerxrcoa1fm r nes;( teumxrpiodaltemicta(fa2taxr nt4optn i3tyt m rlumo;()aetoxfcto1opteai s ( sexr(r3oodope  fes () rtrumoou0oltn f3iad sDrmn s t) exnxr3iydopD lnei;t)trxrxo ou1aptnmnvil()srrrxro;o4texomieiaslaDemuvon(0 eenio3iotomtelivsls0 exmxmpnu4lm nlics ( aDur( o;u4tpe  fciytla ea(msnu)alerxrcoodfaDr u slt)srtoiopou4lpeelnvi tf Drmxmpou1alt moeiysls2ulu ont4trtoif3oatopD lnvo s0seuoxo ou1lm n ivs (farururpno0optniocias sDranvp u)artrmo3iy1om rluvslt) 2uo(mpiu1om elnvt s artm(  ou0tpx io3iatls2el( s;t) etrxr tytfaD  n o;t0 2xrxr3iu4ope lneils s2tm(mpnt0tptn fctat m2uaumpnu)teerio3iodfa  aneslt)tetoim iu4omtelfct s srrrxmono4tlt mo3iysla ul( s;(4alenmr oytlaDrluesls)srtrxopnydlmenlivsl(  rraump;t4aleo ocildfmDrmump;(4tlenifcoy1faD lnvs () rumxm no4altn fcsas)aDtrxrpoo1tptnmietadfa2ulnmp t)treoir iadfptelues;t)texrxopno4lmtnmiet t  Dtaxm nu0apeoiieiys aDua(vs u0arxrir3iytfmDeanvo;s srum(o iu4olen ncsat)arrm(  nt0oeenmieiyd m eanvo u4tlxoxo3ty1fateau sl( seum(r3oo4lpenmnet tfarum( pnu4oet ifcildfaDum( s;t0 rxomf3tytomDr ies t trur(opiodape miet s  2taxrpot1teto oeiydla el( p t)trxrif iy1om  li ilt0srxr(rpiydolenlfei t)aDur(r ot4aeeoiicildfsDrl(monu) rxrxo3todlat ln ils setrirpou1op  lncil(  Dtrumpno4tlx ifeils s2emnvont0trxrmf tatlpDr iesls t2uoxm3iy1lle  nvsl() rraurp;u4tlx mictltls rm(vsn(0areoiociadopteaivs;() rtrxmpiu4ope  nciat  rrmxmooo0alxn f3ildla rl(vpn()trtrio ootfpDean il(0 exoxr3oydol e nciatfa2uaxm ;u1openioetlsfs um(ms;() rtrmf3iotla   uei ( srtoxopiudamtemfcs t)s2taxm ot0tlto i3iysla2rau p u4tetnircoytoa e i o ( srtoxr nu4lp  mfeias)artaurpoo4tpto i3iat mDeaumon(0trtnio ia1lpDeai o ()s2to(r io4lp emicsls sDtmxronu1alen ietldfs2emums t0aexoxr oy1fatelnvo;s) rxrxmpnydoleelncilt s2uax  oo4olxoifciadla rmnvont4tleoif3totomDeau o s)seumim3nu4al elfeia(fa2tm(mp;t4olxnmicias mDel(vonu)tlerxocoa1faDeln sl(0tetm(rpoy4omtnmict t s2trum oo4tpx iieiadfm2rlums;t)texnxrcoy1fptran i s)setoim3oodoptnmfcsltfs2ua(rpno1apto fetlt s rm(vpn(0aleoxo oytfpDran sl( trtr(r3iu1alte nesas aDraurp;o1tlen fetlsls2ulnmo (0tlxnmf3iytom   ivslt) rtmxopnodamtn fcsl(f rumurpoo1oexo o3iyd s2el(mont0arxoir3ta1oatr n olt teumir iy4ole  fei ( aDtau pnu4tex miciadfa2emu p t0aleoxr3iydfm eaneo;(  2xo(rpnodlmt mfei tfartr(m ;t4tetn ictyslmDra( pn()trtoxo oy1fpDeluei s0t2xmir ou4lp emfeils)srtmuro;o1alxo f3tat a2emnvp ()tetrir iydlpt livols0srurirpoodlpeelivi s) Durxr ;o1alt mictaslm elnvo;t4aetomr3ia1fa rluvs;t texr(o iu4lptn fes s aDta(mooo1tet mfciytfa rauvo (0trtoxo3tydfp eaueo ( t2uoxm iu4lp nmfeilt) rrm(r ;t1apxomfctls a rm(msnt0aexnmf iatlat  nvslt)trto(o3oo1ap  livia(fsrtrum ;t1tpe  o3iltls rl( p;u0arxomo ta1omt  uvil(0tetr(o oudap nmfcs t) rtrur ;t0tlx iietldlaDumnmpn(0aeenxfcto1omD  nvo s0s2tr(o3oodoptn ivtatfaDtrx  ou4tlx iieiad mDranms () exnmr iodopte nei ()setoimpiu1apee net s srtrumonu4opt ifetas m2rlu p;(0tetnmfctodfmDrlueol()srto(o oydaltnlici t)aruaum oo0tltnioetltlaDua(vp u0tleoifcia1latelnes;t)trxo(m3nudop  licia( a2taur nu4oeto f3iyd m2uanvonu4alxomo3totom   uei;(  etrxo3iy4llenlnet t) Drmum nu1olt  oeiyslm rlnms u4areoxo3tytfmDe neils)sexo(r3iu4ol e fvsas a2um( oou4tetnmfetasfa ra(mp;t0aexrircoo1laD luvolt0trxr(o iy1opt lnct sfsDtmx oou1oeenmi3tldfa ulu p t0teermr oodoa rai i s0sexoxo3nudlp emncsas)a2taxronu4olenmfciatls2uln s u0texrxf3iotlp r nvo;(0tetoio oydale mfvia( a2tmxmpno1tlen i3iltlmDuauvs;(4aexrxfctadfpteauvslt)sexmxr3oodaptnmiet t) Dtau o;u1apt  i3iltlm2elnvp;(0aeenxo tytopDe n il(0 2toxr3ny4llenmnci s  2tmx  no4oee  o3tlslm um( s t0 leoxo iotfatrauvslt)setrxm iodalenmfvta() Durur ou4oexnifeilslmDelnvo ()trtoxr3iadfpD luvs s)srxriopnu4omenlnvsat aDtmuront4altnmf3iyt sDum( s u4 rtrxf3iy1lpDranei t0 rxoir iudol elfvi t sDrmuro;u0tpt mf3iytfa um(mp (4alxomo3tatlat anvslt trumxo3ny4olenlfvtas srur(mo;u1tee mieildlaDel( on(4arxomrctatopDr u o;s)s2xo(m no4lp n nvsls  rumurpot0tex if3tld m uauvo;t4 lxrxo tydom eli s;( s2xoxm iudllt mnesltfsrtrxrooo1altnmf3iltfs2uanmpn(0tetomr oa1lmtr nvs t)trurim3ou4op emnvtat aDum(ronu4tetoii3iasfm ua( snt0aexrmociotlatelnes;(0teumxm3nu1omtnmfvias a2ur(r ;o4aet  ietltfs2ranmo t0 renio io1fp r n i (0 etr(o ou4ame  nvsls s2rax  oo1oexoioeiyd sDumn pnu0arenifcto1opD aieslt trtm(mpnu1amt lnci t)srtau  no4teeoifcils s eln o t0aeeomo3oo1lpt an i;s s2urxopoydal e nviatfaDtrx o;t0aptnii3iyd mDuaumo;(0 etoio3ia1omtrlivo;t0setriopny4alt miet t  2rr(m ;u1ape  o3iltfmDra( s;t4trxrxocoodlaD lu sl(0s2urxm3iydale  ieilsf Duax pnt1optoifctldlm rmumo;u4aeeomf3iytfat anesl( srtmxrpoo1lp nmncsa(fsrraumpoo1tet ifctydfm uauvo;t0artnmf oy1lat  iesl(0t2tmio3nydomenmict t) rtrump;o0tpto ietytla2rl(mp;t4tlxnif tatla r iei;(0s2xrxo3iodolt lnvslt)arrau ono0apt iieiyslaDrmumon() rerxf3tydfatean i t srxoim oydlm elncs () 2rrx  ;u0alenmieilsfs2emnvo ()aexrmo ta1laDr ivolt0 etrxm iu1oleemncsatfaDum( o;o1apx moetltlm2rmums;()trtnxr ty1omDr ueo t s2xmir3nydlmt livia( sDuaxmo;o1teen icildfs em(mont)aexomrcoy1omtelneo;t)t2urxo nudom   fcsls  Dta(mpno0tpt if3tyd s ulnvont)alermrciy1om   ieo;(0 2uoxr3oy4openlfvsa( aDuaxmpoo0oet iieiydlaDelnvsnt) rtrif tytopD lieo (0trxo(o iudap  mfvs sfa2taxmp;u0optn iciaslm ulnvpn(4 lxrif3tadlptr ues;s) rtoirpio1optelfeil(fa2ua(  nu4texo ictysfmDulnvsn(4arxriociotomDr n slt)trtoxo3no4am n iciltfa2ur(rpot1aleo ictlslsDemump t)arxnmf iatopDrli o s texo(rpoudam   ici s  2tru  ;u0ope  fciyt a2ua( pn(0artnxfcoo1oa e nvs t)s2xoxr3iudameelfvtasf Dta(m ;o0aleo feiadfaDuanmo;t0 lerircio1lptrauvi s0t2uriopiy4open ietltf Dtmxrp;o4oetomieilt sDua(mp;u4 lxoif3iodfpD luei s)s2xoiopoo4amtnmiciltfartaum oo4ale mo3ilt s2ua(mont)trxoif oydfaD  nvols)s2toimpiodomen neias aDuaxm nu4aptn fcilslm2rauvon(0altrxrcta1omD aueolt0s2umxm3ou4omtemfviasfsDtrurpnt4teenmi3iadfmDran s;t)teeoio3ta1fmDr u o t)trtm(opoydaptnlfcta( sDra(m no4aex  feiytfm rlnmsnu0trxnif io1lpD  ieo t0sexoim nodalen ivsa( arurx oou0aexn oetltfm2uauvp;(0artrmr iytfp rluei s)sexoio oy4ol n nct t sDur(monu0ale mf3iadfm rmu o (4texrif oodfptr ivsl(0sruo(o ny4apt  ncsls  Dumu pot0oltoioctadfm uln pn(0 rxomfcio1latraueols trxrio nu4altn fct ( s2tm(mono1tlt  oeiltfs2ea(vsnu0 eerxrciadom  lu il(0 eto(r iy1llenlfes t)srua(mp;u0tptnmietytfs rmuvp;u0 rxoircta1oateauei t)t2uoxm no4op elfet () Dtaum oo0aex ioetadfa ulums;() etoxo3oo1om elieolt trtrxrpiy4lm n neta(f 2uaxroou1tetoifeiyd sDemn o (0aleoxocoytfmDelivsl()srxmxopny1am e iesls srtm(r ;t4olxnmoctatls2elnvpn(4tlermf tydfp eauvsl()setmimpoydap nmfctat srtmx ooo4aetnioeiyslaDeauvo;u)arxoircia1fa ranei;t  ruriopoydomtnmnvtlt s2rm(roou0aee ioeildlaDemumonu4 lxnxr tatopD an o;t)texmirpny1ope mfvslt) Duax oou4olen oetysls el( pnt0 exnif iodlmtranei;s) exoxo oudoltelfci tfa2rm(moot1oexnmictytlm rm(vs t0areoxf oadomt  uvi s)trto(mpiydlpe mncta(f rurx oot0ole  octydls2emumpnt4aexoxf oydlptr i sls0t2uoxr3oodap nmiet (  rrrxr ;o4tltn iciasls2ua( s;(4arxoircty1oaD  ivo s)t2tmio3ny4om n iesl( a2tmxmoou1tleoii3iadlsDeanvo;t0altrmfcoatlatr i slt t2umxo io1ape lfesltfaDrrurp;u0olxnii3iadlmDean s t0trxrxf totop   nvo (  2xrim3iydlmen nesls  2raxmpou1tpx iocias mDuan sn()arxnmocoatomt  ivi;(  euo(o nu1alenmneilt)a2umx onu0alx ifeiat a umnvsnu4 lerifctotfat an i t  rxoxr3nudlp  mfeil(fsrur(r ;t1opto i3iasls2uanms;u0arerir oa1oaDeln i s) exmirpnu4ole  ivilt s2rrxr nu4oltn fetytls2elumsn(0trtrircia1lm e i o;s) 2uoxmpny1amt  nci t)s2tr(roou0aexomf3ildfmDel( s () lxnif tytlat  iei s0s2tmxrpnodol n ncsl(  rtmu  ou0tltnii3tatfsDelump (4altrxo3oadfaD aueo t  eumxm nudlltn ivsa(f Durxmpno1tltn ociat m2umumo;t4 rtoir3tytfa rauvs t srtoir io4ameemneilsfsrtmxmp;o0tlxnio3iaslsDuauvp;u)tlenmoctydlmt livs;(  rurxm3nodom emies tfs2rauro;o4teeoioeilslm2eanmsn() leoxrctydlateaivo;(0sexr(m ny1am emfcsa(fsrua( o;u1apt  iciltlm rmnmp;u)treomf3oodomDeln o;s)t2tr(m3iy4lme lici t  2um(m ;t0tlx mfciydlm ea( o u0tetoirciodoat  u olt setr(r iydlp nlnct () Dur( ono4oltn ictlslaDrl( s;t4 rxoiocoy1lmDe ueil( setm(opiy4omeelfes ()a2taxm ou4aet  f3ilsfaDeln o;u)arxoir3to1fp ran ils0sruoxrpoo1opte iesat s2tmurpnt4oeto octyt s emuvp;u0trerirciy1fp  aneo t  etrxo nudapee ncias s2raxro;t4tlxo ictys a rau p;u4arxnio todfaDraieils s2xo(o3iy4al nliet sfarrmxm nu1opt ifciadfm um( p;()teeoircio1fpt lu olt0seuo(m ny4lmeelieta() rtau o;t4oetoifciaslmDrlnmo;u)tlxnif3io1fa  lu ils  2um(m ny4om n fcslt)artrxmp;o1tlxn ictld a2uluvs u)tlxnmf3oo1optr uvolt)srtm(r3no1al n icta()s2ur(  no0ole iictldls2ulnvo u)texrxf3iydfp   neols0 rum(m iydop e nvi s arta( p;u4aetn o3iyt m2ra( p;()aexoiocoytlpt luei;s)srxo(r iu4ol nmfciltf Dtaxm ;u1opxoiieils s rm( o u0 lermrciotfp rauvo s trxoxr3iy4ll e ictlt a2trum no4optomfciatfa2ean snt4 exomo io1fp   i o;t0srumxm3ny1lm   fvtl(fs2uau o;o4oltnmf3iadfm emuvs (0aexrmo io1lpte n i s) ruo(o iodaleemfes () rrrxrp;t0apxomfeiat mDrlumpnu0 rerio3oy1omtrln i;s0srumxmpiudlmtelfcils a2rm(m no4opxnmf3ildfa el( o (0trtnmo3oadoa eluvi t) rxrimpoydam nmiei s sDtr(ro;u1tpen o3tysls2ua(mo;t0artrxrc
\ No newline at end of file
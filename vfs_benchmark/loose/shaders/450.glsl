@@ -0,0 +1 @@
+nvslt  rxriopnu1openmnvsatfaDrrumpnu4olt io3tltfa em( s t) rxoxociy1omDeluvils  eur(o oodlle mncsa( srum(ronu0tetoioctatlmDranmont4arenifcoydfm e i s t) 2xrxo3no4op e ivt (f 2raxro;u4olt if3tys m2eaumpnt4 etrircoadomt aieo s) 2to(opnu1lle  ici (fartaump;t4aexo octat sDemuvon(0trxoifcootopDrli o s) rumio3no1optelfet (f rtmumpou1ole mf3ilslmDumu s (0texomf3oydlatr ivs;(0 2xm(o oudomt lfvsa() Dumur ;t0texo oeiasfa ea(vo ()artrifctytla r neo;t0 euo(m3io4lmtemfvt s) rrm(m ;t4ope  i3ildlmDrlnvo;(0arxnxociytfm  lu o;t) 2toirpou4omt lfesas srtmumpou4aeeoifciadfm2umuvpn() ltomo3ty1lpD lies (0 eumio3iodlle  neilt sDtaumpnu4oee if3tltlmDum(vpnt4 leoif iadoa e n ols) etmir nodop nmfci t  2rmxm oo0olxnmi3iytfm2eanvp;(0trxrmo3oatfptelueo;()texrir ou1lmenmnetlsf rrrxroot4teen fctytlaDelump t0altnifcoa1om rlnvi;(0 etr(o3no1omee nvtas) rtaumpnu4aee mociytfa2el(vsnu4tetrxo ootfptrlu o t srxmxrpno1lpee icil(f rur( p;u1texniietyd aDrm( s (4 ltnmo oatoa  aivo;() 2xrxr3nodom  mncil(fa2rm(ront1oeto ietydfa2em( p t)alenxo tadlaDelueo;( srxmxopiy1ope  feilsfa2urumonu4alxnifeiyt mDrl(mon() lxoir3oodfmt  nes s  2trimpiudoltemfes tfs2rau  ot1optn iciasfsDemnvo;t0aetomo3tatom e i s;(0s2xoiopiudlp   ieias)arua(m ;t0tptnmf3ildlm2rmnmon(0 exnxf ia1lpte nvo s srum(mpiy4om  mivi s s2tm( o;u0olx  i3iadlaDulumpnu4 reoir io1op  au sl( truoxr nu4lm emncsasf 2rr(ro;u1ole  f3iltfaDul(vsnu0alenmf ootla ranvslt)trtm(r nudome lneslsfaDrmu  nu1alx ifetysfaDrm( pnt0tetrif3oytlat ai ol(0texoir iydlme mncsa()arumumonu0tlto i3iys a2ul( p;u)tlerif tytfmtrai s ( s2uo(o3io4ap nlfcsatfsrua(mooo4oeenmf3tydls2ua( p (0arxrxo3ta1omD ln ilt0 2xo(rpnu4lmt mnvia(  2rru ooo0aeeniocildlsDeaumpnu)trxnio3todopD anes;t0 rxr(m ou4omt licilt a2uax pot0optn ociytls uauvp u4aexomf iadfaD  nes;()sexrxr iydop n fvil()aDta(r ot0oet  i3tatfs ea( s t0 ltoxo iodoptr neo;t  2umir nudlp   nvtlt s2trxm ou1tet ii3iydfs2elu s t0trenio iydlmt luvs;(0t2xoxrpiodal emiesatf 2raumono0tlx mo3taslm ua(ms (0artrxrcoatfmtrli sl( tetm(rpoy4lmen nvtltf Dur( ono1oexnifeiytls2umump;t4altnmoctotlpDrlu ils  rxoim oy1optemiesls) Durxm no1oexomf3iyd mDuauvo;(4 eeoir io1fpDr nvs;()sruoim nydamtemiviatf rrmum no1aeto i3iysls emuvpnu4 rxomfcootopD ln s;t)tetmxm3ou1om n iet s  Durumo;o0apt iieilsfm2rau sn(0 lxnio3oo1lm e n i;s)tetrim3iudlmt  ivsa( srur(roou0olxoioeiyt a2rmuvsnt)tleriocty1opDelivsl( t2xrxopiy1amtemicta() Drrxrpnt1oeto i3iys a2rmnmo;()texoioctotomteaieo;s0tetmir ou4olte fvilt  rra(r oo4altoioeiys m um( p;t)alenxfcoadfatranes s  ruoim iy1aleelfvia(fsrta(r ot4tpxnioctldlsDrau o;()tlenxrciatlptean i t0setm(mpno4lmtnlfcilsfsDumur ;u0oltnmoeiltfs rlu s;u0tlxomf tydfpDr i o;s0trtm(r3iydlmenlfvsl(fsDtaxm ;u0optn fetatfaDuluvsn(4texoircoa1lp  aneo;(0 2um(m oodlm emivtlt  rra(ro;t0alt  ietltfa em( onu0 reomrcootlat  n o t tetoxo3iodaptnmfcsatf Drrxroou0tee moctyd mDuanvp u0tlermo oytfptrauvs t  rtmimpou1omeelivtasfaDrmu p;u4apx  f3iatls2um(mpn(0tleoxf ty1oa   u i;(  2trim3oo4lleemnet (f 2ta(mpnt0tpxn iciytls ua(vs u4trxrif3oa1om eai o;s0 2tmio oydapeemfeils aDrruroou0oltnmi3iad s2rl(vo;u4teeomo3oa1fateauvolt t2tmim3oodlptnmnci t)sDrm(rpno1tpto iciytla rm( s;u0tlermrcoo1optelnvo;() etm(rpoodalenlnciatfartrurp;t4tle  oetlsfs uaump;u4 ltrxo3to1fat livs;( sexmxopio4ol elnei s)sDraum no0tlx mf3iasla em(vpnt) lxnxr3io1lmtrau s;s tetmxm3iodame lnetat  rraum no4aptniiciadfm2um(mp;()tleoio3to1lm  aieo;t  rto(r3iu4omeelivtlt)srrmxr ot0apx  octydlmDelu p (0teenmr3tydfmt  iei;s0 etrirpiodal   nci s) rtmum no0aeto oeildfmDea(msnt0aetrmr tatomteanvo s0t2toxmpio1op n nei t a2uaumpnt1oex ifetlt m2emums (0 lenif3iatlmD  neolt0t2xo(o3iudal nlfesas)srrrx o;u0tpx  ieiadlaDrm( pnu) rtoif3iytfaDe nes s s2uo(r ou4lmtnmnvtas) 2uaurono0opt ii3tytfa em(mo;(4aeeoxocoytlatelu s (0 exr(m nodamt  ivsl() rumx onu1tltomo3ilsfm2rmnvo;u4 etnio3iodoa  lnvi ()t2tmim3ny1lp  lfvsa()srrm(ro;u0alxnmocildls el(mp (0 lxoif3oa1op rli s;t0texoir3iu1opee ict ( s2taxro;u4tpeo i3taslmDrm( s;t0 rerif iydfa elies s srtm(r3nodlpen ies ( arta(mp;u0olto ietld sDemu pnu0tlenmo3ta1fpDeauvilt0sexo(opiodol  micsa( sDra(ro;o1alxo iciytfaDeln p u)altrxr3to1oatrau ilt0 2xm(o3nu4amenlfvtas arurx o;t4optoifcild s2uln ont0 eerxrciytfpte uvil()setmir iydap   ncils  rraur ot1tpe  octatfaDem(mp (0 ltrmo iytfaDr n i () 2tmio oy1olenlivt s)sDtmxroot0opxoioetysfa2elums t)alxomoctatoptr u s;() etr(r iu4om nliesat  2um( pot0tlxomociadls2ranms t0texnxrcoatoa  luei t)srum(rpno4am e feiasfartaxro;t4open feiydfaDrluvs t) rxnxo3oodfp   n il(  etmxrpnydlmtn fviatfa2tmx pno0aptn fctlsla2eau p;u0aetnxrcoo1lm   uesls)srxr(o3iy4ole mnvsltf rua( ont4oeenmieiatlmDrl(mon(0artrmrciadlptrli o;t0trtoxrpnydomte fvi s)artr(r ot4texo ieias s2rluvonu4 lxnxfciadoaDrlnes;t  2tmimpiu1ome  fesa(farrmu o;t4aet iieiysfm umnvs t)tlenxfcoodomDelnvo s teur(opiu1olt mnvs (faDrrxmonu1optn ociltla2ua(vo (4trenio ty1lmDr nesls)setrxo3oudlmt  fvtlt  Dtrxmp;o4ope iociysls em(mp;u0alxnxrcio1omt luvi s truriopnodolt lfvtas) Dumx  nt1apxomictadfaDraump;(4 rtomf3iytomtrluesl()seurxr3oudlm  mnctls)arrrx  ;t4apeoio3iysla umums u4teerxr3tytfpDeli o;s) 2tmxr3ou4apeelfvslt  Dtaxrp;u0aeeoioeias a2rl(mp ()aeerxrcoatfm ran o;t0s2ur(o3iy1omtnlicsas a2rmu  nu1ope  oeias m2rlnmp ()arxnmr3oa1fp raieils)srtrim oydom n nvt t sDtm( o;t4tptnmi3iat aDemuvpnu)arxnio3iadlpDrlies;(0srtmxr iudolenmnei t)aDua(r ;o0tle mo3tyt mDeaumo;(0tlxrif3oytoateauvs t trurxopou1lle mfviat) Drmur ot1texomo3tatfs2rm( o t0arxoxrciatoa  lu s (0srurxrpiy1oleemfvsltf rtauro;o1tlenifciytlsDra(vs t)aetnmo3oydop eauvo;t) rxmxrpou4lltnlnesl( s2umxrp;o0openifcilt aDrl( p t)arxrxf ta1fmDraivi ( seurim3nu4aptemivias)s2ra(  ;t0tlxnmicils m2emnmp;u4 lenmo3iy1omtr ieo s0tetrim3io1om  lnviatfs2ur(mpoo0aet ifeilslaDrl(vsnu) ltrxo todomt aueo;t teumir ou1alte ies (f Dtmuro;o4apxniiciaslaDemumo u0tltoxo ta1lpDe u o;(0sexmim3no4om emieias)aDuru pot1oexnifctas m2um( s;u0tlxrmo totfpDranvs;t)srtrxopnudol n ici (f Draxrp;o1oetn oeiytlm emn o (4 eermf3oy1fa eauvo;s0sruoimpiy4apt  neiltfaDtaxmpou1opeomociltlm uln o t0 rtoxr3oodoa rauvs s)t2um(o3nydomeemivi s) Dum( poo4aetn ieiydls ra(vs u0trenxo3totop eaies s seuoiopnydopen netatfsDtmumpot1opxomietydfs emnvo;t0arerxo tadomDrauei;s setrxopiodop   iciasfaDrrum oo4tlen iciydlaDrl( s t)artoxfciadomtr i sl() eurir oudlmt  neiat aDra(mpnu4oeenio3iyt s2rl( o () ltrxociotfa rai i;s t2uoxm oy1al   nvt sf Dta(mp;t4oexnmfeias s elnmonu0 lxomociatfmDrlivo t) 2urxo3iy4alt mieiat) 2rruronu4aetn oeiltla umnvo;(0 renxrcta1faD au sls0 exrim3no4olt mnvtltfaDurxm nt4aeeoioeilsfa rluvpn(4arxomrciy1lmDr ies;t t2trio3nu1altelnci (faDraxm ou0tet  oeiyslsDeanvo;(4 lenio iy1fatr ies s0s2xm(o iu1lme  icslt sDtmurp;t4aptoio3iat aDeauvo;t4artoif oadfm elnvo;t s2trxmpoo4opte nctas)sDraumont4ole mfeilsfa umnmonu0 etrxo iytopte ies s)trumxopio4lm   nvias)s2trump;t0tlxn i3iadlmDemumo;u0 exnxr tytfa eaivo;(  2xmxrpou4olenlfvs t)arrr( onu1opt  f3iltlaDrmump;()alenmfcoydlpDe ieo s texo(r3iy4lp nmictatf 2ua(  ou0aexnif3tatlaDem(vo;u0aexnmr3oatlaD auvo;() eto(mpoo4omtn iet ( s2uax pou1apxo o3iat s2ea( sn() ltrif iydlaD aivi t0tetmim iu4ale mfctlt aDtmum nt1tetoif3ils a rmu p;u4 renmfcta1fpDrli i s  exm(opoodom n iciat aDrm(rpnu0tleoii3ild s uaumont)texrxo tatlptrluvs;t0 euo(opoydomee nctlt)sDur(rpou1tpxo ictltfm2ulu p u)areomfctatom r iei s  exr(r ou4alenmfvias)arururo;u0ope  f3tydlaDrauvsnt4 eenif3ia1lpDeli i;( s2uo(o3nydoleemneil() 2tmxm ou0texomo3iysla rmnmo;u0trenifcootfptrlu o;s0 rurxopoydamtemnvsatf Dtrumo;u1teeomictlsls2eau o u)tleomrctadfaD  u s;s0 2trio3iy1lpe mnvtatfartr(rpnu4tlt mi3iltfs2ua(msn(0tltrmf3totlptrln o t trto(opiy4op n fei s) Drmxr no1aetomf3iadls2eluvs t) leoif3iotopt anvi t texmiopnydalte nvs t) 2rrx  nt0opxoioeiysla2rau snu0altnxf iodfm  liei;(0s2toxo no1oleelfvil( srur(rpno1aetoii3iydls uan o;u)tlxrircta1opteluvslt seumxo3oy1lmtnmnes t srrauront0ope  f3iat s rmuvsn() reomf ta1fmD lu i;s  eum(m3nu1al  mnetlt)srurum nt4oeenmo3iatlmDulnmonu4tlxnmo3ia1fa rli s;t)sexmiopiu4omt  ieiat)srtru  oo0opxo feiysfs2elumo t4trxrxr io1late ies;()srum(r nu4alenmnvt s sDrmxm ;u1tee mf3iadfa2umums;(0aeenxrcty1fpt aueo s  eumir3iy4lpte ncslt)sDrm(r nt1oexomf3tasls2emu sn(4 lenxrctydlptrlu s;s trxoio iydopen nesasfa2umxm ;u4alxoiiciad sDrl(mp ()arxoxr tadlatr nei t s2tm(o ny4olen ncsa(f rumx pnt0oleniictlsfa rlu s t)arenio iydlpte neo s)t2uo(m3iudomt lieil() 2trxm ou1oleomoctld mDuau o () ltnxociadopte uvo;t s2toxr3oodolee nvta(fa2tmum ot1tpxoiieildlm2elu o;t0texnmfctatlatraneo;s)t2trim3ny1om nlivilt  Dtmur nu1alx  ociaslsDrmn pnt4texoxf oatla  lnes ()tetrio3iu1lmtnmivs ( artaurp;u0olenioeiyt a eaums u)trtrxrctotlaDeaiei s) etr(o3oodop  mncsat)arua( pnu1tpx mfctysfaDranms (4tetnmf3tytlatraueo;()t2xoxm3iu4lm nlfct tf rtrx oot4tlto ieiydfs2emump t4arxnif iadlm  livs t  exoxmpou4omtelict tfartmuront4tlenio3ilsfaDean o t4aeenxo iydlmt aivil( s2tmxrpnodlp  mnet s  Dtru p;o1tex if3ias a2uan o;u)arenmr oydom  lieo (0setr(m3oydalt mici ( artm( p;t0opxomfeilsfm emn snu)trtrmf3tytfpte ueo t s2uoiopno4ol  licil() 2tr(r oo0aet mietad sDumnmp;t0aetrxoctytfpt ai o;( trtr(r io4ap emnvils  Dtmurpot4tltnmf3iasfa ulnms;u0texoxo iydom   ues;s sexoxo3io4omee ivil( sDrr(mpnu0aleoio3iasls eluvp;(4alxoir oodomDeauvslt0 euoxo iu1alenmneil(f 2rax pnu1apxn icilt aDemn on()tetnmr3iotfaDean o;t)tetr(m3iydll e fetlsfsDra(mo;o4tet  oeilsfs2rluvs (0alxrifctydla elneil(0t2xmxo3oodoptelnvs t)arrrxm ;u0texniociadlmDeanvp;t0tetoir3todlmteau o t setr(mpnu1ameemfvt s sDra(m oo0aexoii3ils s uln s;(4 etrif ty1fmDeaueo;( texoim iydlptnmfvta()aDtrx  ;u1aee  octld s2ulu pnu)arxnioctotfptr uei;s  2xoxo oydoptnmnes t  rtmumpnu1olxomietyd aDrau pn(0aetrxr3oy1fa r uvi;(  eum(opno1aptnmnes s)arraum ot4olxnifctysla ulu sn(4 lxrxr oa1lpte ueil()seumimpio1ap  lfcsasfarrr(r ;o0tlt ifciytla2ua( o u4aeermfctodlmDr uei s teur(o3no1am nlfvs () 2rr(monu0tex ifetas aDuluvo;u)alermf tadop  au i t) eurir iy1ll nmncils arta(m ot1teto i3ilsla2ua(vp u) rtnxfciydfmte i ils0 etrxr ny4apt  feiltfarra(  nu0oet iocild a rm(vont) lenxfciodoptran i;( t2uoio nu4ole lfet s  rrmurpoo0tlt moetltfs2rmnvo;u0aleoioctotlm eaieslt0truoxo iy1am emies tfa2rrumont1oeen ieiltla rmnms;(4artnmrcoo1lmDe u ils)s2xmxmpnudamtnlneil( artmxmoot4apen fcildla2uanmo t)tetrmociatlp ranvs t0setm(rpoodomte ncs s)aDua(m oo4ole mictlsfm2umu s u0tlxrxr oo1la  an s;t0srur(o iydamtemicias a2tm( o;u0altn fciad m umuvon(4 lxrmoctadlpDelivi t)teumxm3oydaltnmnvs t sDrmxroot1ale iociydlm rlnms;u4 rxnir3oatla rlnvil() 2um(m3nodllt  fvt (f rumu pot1aeen o3ildfa2ua( ont0 ltoif3todfm elnvs (0 rxoxr3nudomtnmictl() rrmumpnt4texomfeiat sDemumont)areoir3to1om  li slt0teuoxopnu1lpenlfvtasf Dra(monu0oltoiietlslmDeanvo () lxnif3ia1la eaieol( texmim oydole mnetlsfaDtm(r ;u0aex ii3tadlmDrl( p t)aexnio3iadfmD aivsl(0trxmxm3iudlmeelnetat  2rau  no1oetoiieild s2rm(mp t) lerir3iotopDr u i t0srtrim3ny4oltemfeiatfsrtrxm nt1oeeo o3iytfs2rl(mp;()trxoio3iatoptrlnvs s tetm(rpnydll  mnctasf 2trxrooo0aptnmiciys aDelu p;(0 eeomocoydlat luvo s t2xoimpiu4ol nlnesat)srrr(rpnt0oet mfctldlmDem( s;u)artoio todfp r uei s)t2trxr3iu4am  lietas)s2tmur ou1aptoiiciadfs2uauvp;u0altomo3to1lmte u o ()s2xr(r3oudop e ieil(  Dra(r oo4ape ifetasfs2uanmo u4aetrxr iydoptelnvilt)tetoxrpiudlptnmfeta( srumx ooo0aee mf3iyt aDrmump u)artnmr ia1laD lnvo (0sexm(o3oo4am emneslt s2tmxrp;u0aetnioeildls rmu p;(4 leomo iy1fp rlu o ( teumim io1oltnlieiltfsDuru  nt0aeeomf3tltfa ulumpnu4trtoiocia1fpD luvols  2umim3oodapen fctasfaDumumooo4aet moeias m el(ms;u4 eenifctatlp rlivil(  2xmxopoudoltn ictlt) rrr( onu0apen i3tltls2uanmpnt4 eermfcoy1fa rau i;(0t2to(m iydalt mncsls  rrr(r ou1aee mfcilt m ea( o t0arxrxrctadfmDeauvsl()t2uoio iu4olt miet tfartrx pno1optomoctaslm2uan pn()aexriocio1laD  ivo;t)t2toxo3nodlp e nvsa()arrrxm nu4apenii3tad sDul( sn(4 ltrxo ootfmDrlnvi t t2xo(m io4apen ivt sf Dtr(r ;u1tpeomf3iys aDelnvp;u)texrmr tytfaDr uvo s0 rur(r3ny4altnlictl() Drau o;o4tlenmfeiasfaDemn p;(0aetniociy1fa  li i s)t2tm(m3oudlmtn fct ()sDua( poo1tee iiciatla2el( s;t) eeoif tytlateau o t)trur(r3io4amte nvtat) Dtaxr oo1altomoeiadfs rm(vs ()altnir tydomtr ueolt)sruo(r3nodll nlneta( sDrr(  nu4openio3iltls emnmpnu0 rxnmo ty1lmDelnesls0setoim iydomt lfct t a2uaxmonu1tle  feiadfa rlnmp;u0 rtrmrciy1fpDr iei s  rtoimpno1op  miesat)srumxmp;o4optoiieiyt s umu o;(4teenmf3oadfmDrau o ( teur(mpoy4op elnvias sruaxr ot0tlto o3iydlm2uanvp t)teenxr3tadfa e ieo t0 ruoio ny1lmeelncils)sDta(mono0alxniiciytfa2rmnvs;t)trxnio3oydoaDeau s () 2uo(o3oodalenmivi s) 2rrxr nt4tex  oeilsfs raumpnu4arxrio tytlmt luvols trtoxr3oo1lleemfet s aDur( p;u1olto o3iyslm um(monu4tleoxr tadopD auei ( sexm(mpoo4op n ies (  2ta(m nt1apxoif3tldfa2ulu p;(0arerif iydfp r n ils0trumim3nydapenlfetl(fsDraum ;u0olxniocias a umumpn(4arerxr3ty1oa r n s;s0s2um(m iu4llte fcias) ruaxm ;t4oeeomi3tltlm el(mo ()alxrifcoydfaDrli ols0trtmirpno4aptemfeils)arurum nu4tpx if3iys m uau s;u0trtrif iydfate i ol( tetr(o nudalt mncsltfaDtrurp;o0aetoifciyd sDum(msn(0aeeomf iydlp   ies t  2uoxr oy4lle mnci t)s2taxrp;u4tex ifciaslmDrl( snu)trermr3oytopDr u ilt)trxoim3no1omte icias  rraumo;t0olxn fciyslaDrmums (4 eerxr ootfp  au o t0sexm(m3iodal e ics t) Duau ont4tlt ifcilsfa uau p u) rxrxo3to1fat lueils0trxriopoy1lm elfei t arurxm ou0ole  i3ias mDumnmont0treoir oy1fpteli s s0s2xm(r iy4am  lfcta(fs2um(r oo4olxoif3tysla2rl( s;(4texomr3iytfate ivi ()seuoio3io4alen fvs (faDur(mpot4apt ifctld m emuvo;(4trxnircoa1omDr uvi;s) 2xr(opiy1am  mnci tfs2uaum ;t1tpx  fciyt s2ul(msnu4arenxrciotfa  lueol( s2tmxopnydalee net ( s2tm(rpnu1tetnmoctlt m emu p t) exnxo3oytfmD  nei s  eto(rpny4aptnmict s sDrr(r ot1apx iieiyt sDuaumo;t4altrxfcty1fmt li s;s0srxrxrpoy4ale liet sfa2rr( pou0tltn o3ilsfs2emnmsnt4trxriociytfa r uvi;s0 rxm(mpiudlmen fctas aruauro;t0alen ieildla elums;t4aexrif3oodlp eauvsl(0teumim3iydamen fes tf ruau  ou1tetnmiciasfs uaumpn(4 lenmo oadla  anvo;( s2um(r iydll eliesas a2rr(m oo0teenifeild mDulnmpn(4 ltoif totlmDr iesls) 2uoxo oudam   icsas a2tmxmp;o0apto feiadfaDrmn o t0aleomr3ia1fmD anvols  2xoxr iudal nlnvia( artmurpnt1aex ioctld sDel(vo u4teenxrctodlpDraivs ()trxoio no4amtnmnviat) 2tmur ;u4alxomieias s2ul(mon(4tetrxo3oytlaD lneo;s0 2xmir3iu4om nmivsls sDuru ooo1tpt io3tytls2em(vo () exomrcoydla elnvils0 rxmxo iudoltnlnesltfsDtaump;u4aleomictasls2rl(vs (0 exnmf3iatlmDr ues;s0trumxo oydomenmietls) Duau  ;o0opxo o3iyt s2rlnvpn(0 ltoir ia1oat aneo;s sruo(o nu4lm  lnvsltfaDur(root0aexn oeiat s2rlnvp t) ltrmo3oatlptelues s)trum(mpoydll e ictasfsrrmu  nu0tee  ieiatlsDea(vs;t) lxoiocoatoatrln i t)s2trxr3ou1ome lnvslt aDua(r ;t0oleomieiydfs2eanms;(4trtnif3oa1op eai s t sexrir3oodlm elnci () Duaxmoou0aptnio3iytlsDelnmo;t0tetrmf ia1lpt  ueo;( srtr(r3oo4ap nmiviasfaDum(rp;u0aetnii3iys s2ean pn(4texniociodoaD li i s s2xmirpnodlmt lfciltfartax o;t0tpxomieiltlmDemn s t)teeriocoy1laD  nvo (0srtr(rpou1lpe  fet t)sDur(mpoo1teeomfeils s ul(vo (0areoxf oodoptr n ils0trtrxm3nydope  ncta() Dtauroou4olxnmfeilsfm ua(mo;t4 rxrif oadlat luvo t trtrxopno1om n ncslsfa2tmxront1optomo3iat a em(vo (0 rxnxf3tydomDeaneol()trxr(rpny4optnlnci sf 2raxmp;o1tpeoiiciasfa umuvsnt4 lxoircoy1lpDelivo;s0 2xm(opoy1amenlncsls) Dtr(mpnt1tetn f3ilsls umu p;u4 ltnxf iy1oateanei s)sexoxo3io4am emiesa() 2rr(  nu0opto i3iatla rm(mp u4trxnxo oy1fptrau s;() rto(m3iu1lmt  fct () rrrxrpno4aexo ieiltfm2ua(mpn(0tetnio3iotfmDeanvs t) 2to(m iodoptn iciasfa2rrumonu4aleomociys a ulu o t0 rerxo3to1fpDeln ilt)s2trxopoo1ale mfvtat aDtaurono1tpxnifciysfa ean p;t4 ltomrciotom raueol( texmxmpoy1ame micilt)arrmxmp;u1tpe ifeiadfmDulnmp;u0 etrmo3iadop  lu ols0trumio3nudal n ncil(fsDtr(r nt4tpe  f3iysfsDeln p;u)alxoxr3oadfpt auvo s)teur(rpoo1lp n iesa( srrmu ooo1oee mi3iyt sDrauvp;t4texoxf oa1lptrai s t0t2xrxm no4lmtnmncs s  rua(m ot1altnmi3iadlm eln o (0treoifcoodlm r nvi;s)seumxopoy1ap nlncsasf Dtm( p;o4teeo f3tyt m2ranmo;() lxoxf oodopteaivils0srxmio ny4opt  ieia(f 2tm( pnt0tlxn octatfsDuluvsnu0alerir3oadoptelies t s2toir3oy1opte netl(fsrrm( onu4tleo ocias a2eanvs;t0artomo3tatla rlnes s) rxrio iodale lnesas)arta( oou0alxomo3tytfm2elnvo t4 rxoifciy1lptrlivo;()sruriopiy4lpen fvsa()aDra(mpnu4aetnmoctldfs2rl( o;t) rtomoctydfpD livo;s s2urxopoudalt  ivtat a2tmxr ;o4olx iietls sDua(vp;u) rxoifcty1lat  iei s  exmxo3nodope  ncilt arumu o;u0olt  oetad s rlnmsnu4tltrifctytlm r ueo s0 rxoxm oodop  mfeil() Dra(m nt0oltniicilsfmDuln o;(4 rtrir oytlptean o;t0t2trxo3oo4ap elnei sfsrtm(mpou1aetn feiad mDeanvs;(0 rermo3iotfpDelnvs t0 ruoir oy1lm elict () 2taxm ;o4teenmoetytla emuvo;u)tltnirciy1lptrlivil(0 rxmirpiy1ome mict sf Dtrxr oo4tpxnmo3iytfmDrlnvp;(0tltrxf tatomt aivo t0trtoirpnodop emfctl()s2tru onu1aetoifetydla2rmuvp u)aeerif3tytopD lu s;s s2xrxo ou1ll  mivil( sDumurono4oeto fcias aDran s () rtnxo iadop rauvolt0t2xo(opoo4alt  feta(  rrrump;o0ape mictltla eau s (0tlxrxrctatoatr ivo;s trxmxo3oydol nlfvi sf Dum(rpoo4aleoif3iyt a2em(ms (4arenxrctodfpD  ieolt)s2uo(r nu4al  mfetl()arrmxrono1tex ifetltfm rauvs t4altrir3to1lp rluvils  etr(m nu4amenmfcta(fsDtaump;t1tle  oeiltfa ranmo;t) eeoxrctydfat anei t)teur(rpiy1lptn ivi s)arrrx  ou1ope iociaslm2ulumo u0arxrmf3ta1fpte u olt)t2trxo nu1amte ncsatf 2uaur ;o1tpe ii3tldlaDumn p t0tlxrmo oy1lptrluvo (0trxoxm3iodlmt mfcsa()sDumxrpoo1aeenmiciadls uan s u4treoxo3io1lmDrliei;( srurim nu4olt liesl( sDumu oot4oeto fetatfm2uan p u)trxnxo oadlm eaivo ( t2uo(m3oudlptelivsas aDrm( onu1teenii3tyt aDulu p;u4 rxnxrciytfpt  ivi;t tetrxo3nydamtelnetltfs2trum nt1oetnmfctatfm rmump;u) rxomocoodfm raneol()sexrim iudame mivtltfa2rrumpoo1altniieiatlmDeau p;t) rtnmr3totfaDean o (0 2umxr3iy4ape mfvta(f Dur(ronu0ape mo3tyt a ea(von(0 exrmo3oadlpD anvi () rxrir oydlmen iei () 2taxrp;o4oexo ocilsfaDrlu o;(4 renir oo1lpDran i;(0srtmxr iy4altelicsl()sDurxmpoo0aex  i3ild sDran p u)areoxo3tadfpDeaues;( t2tr(o3nu4apteliet sfarra(ro;o4tlx ii3tyslm2ulu pnt) ltrxf3tytfmt  ivi;(  exmxm3oodolt  ncsa( srrmumono1tleomi3ilslmDelu s;u4 lxrmo oo1fmD anes;t  2trir3nu1amtnlfeilsf Dtmum ;t0opxoiociydfs ea(ms;u0altoxo ty1lmD li sls  etrir oy1apte fes ( srraumpnu0opt  ietad a ulump;()aleomf iadlmtelu o ( teto(m nu1lpt lfvsa(fa2raxro;u1olxnif3iyd a2rl( ont)artomfciytlmDrlivi;s srxo(m iu1lleemfvsl(fa2rmurpoo4opxnifcilt sDran o;u4 ltnxf to1fp ranei;(0 rxmim no4llt mict (fs2ur( ooo0alt iieiltls em(vs (4texrxrcoy1omDeanvslt) exriopiy1lpt livi s)a2rru  ;u0tet  ietysfm2elump t0 eenxo oydlp rluvs ( s2um(r ou4lmtnlncsa()s2trurpoo0alx  oeildfm2ra(vo;u4aetrxr3todfmD lnvilt0s2tmxm oy1apenmivsa(f 2umuro;t0aeeo feils a rlnvonu)altnmo iytomD lnvolt  rumimpoodlme  nctl( arra(  no0opx iociydfsDranms;(0aetomoctodop  au o;(0s2xr(m3io1am elfesas arua(mo;t4alxo i3tltfaDrln p;u0teeoxfciodlaD  ueol(0 rumir3ny4am elivt ()srumur nu0tpxoiiciys aDuanvsn(4 exrmocoadlm ranei;()setm(m oo4am e nvilt)srra(m nt4ape  fetlsfaDel(vsnu) lermo3ta1laDe uvo;(  eurir iodalee fesa(fs2tmu pnt0alxnio3iltla2rlnmp u4trxomrcoa1lateai s s0 rur(m iy4optn fcs s) rrmxr no1tpx micils s eanmp;(4 reoxf3ia1om   uei ( seuoio3nodaltnlfesl(fsDrrx poo0tlenmf3iadlm2emnmpn(4trxrmf iytfmDrauvols0s2xrio3oo1ol  mfesls) 2uau onu1tpeomi3tys a2em( pn(4alenif3ootlm  lnvi;s truo(rpio4oleemnvsasfsrrmuro;t1apeoioetatlsDem( s;(0arxomr3iotfpteanvi;t trumxo3ou1altelietls  2taum no0apto o3tatls2ua(vs;t4arxrmf ty1fpt ai o ( sexmimpnodlm n ncsl()srrmurp;u0aeenioetatla emu pn()teeomr3ty1faDelneslt srtm(opno1oltnmfcia( sDrmx  nt1ope  o3iytfsDel(mp u)trerioctotfpDran o;t  exrxo3iudamt  ncsa(  Drru o;u1tpxo icild m2elnmp;t)tlxrxoctadfatr nei;s0 euo(r oodlp  mnesa(farurx o;t1tltnio3iyt sDean p u4treoiociy1lpteaneil(  eum(m iydamtnlnvi (fsDrrxrpou4teenmietls mDea( p;()aexomr iydlmteauvol(0tetmim ny1al n fes t) 2taur ;o0apenmo3iasfa raumo (0 exnmr3oatlm eau olt0trxrxm no1omenmietasf Dtaxro;u4aleomfeiad aDuan s (4 rtrio3oytfptraies;(0teuo(mpiy4olee fet s)aruaur ou0aptnmfetysfsDrm(vonu4teeoxf3tadfpDr nes;t tetmxo nu1altn fvi ( s2ururpnu4teeo f3ilt mDuanvs;(4aeermrciodfmD ln i;s)trtrxmpnu1ol nmfetasf 2taumpou0alx  f3tyslm2eluvon()aexrir io1lmD luei;()seum(rpnodapeelnesls)arurx ont1oeen ictas a uanmo u4 renmf tydoa eauvsl( teumiopiu4lmtn fet t  ruax  nt1tetoii3iydls rluvon(0 ltomr3todlp  aivsl( s2tr(o3nu1lpenmnvt tfa2rm(rp;t0apxn f3iasfs2rlnvp;t4 rtnmocoadfm e ieo t0 exm(r3oy4aleelnvi t)srrau p;u1tleniieiltfsDuln s;(4alxoiocia1lpteaues;s s2umim3nu1al nlicil() Duau pnu0apx mictytls2um( o (4tetrxr tatlpt lnvi s  etoxr oudlptnlnct tfs2um(mont1oeto feilsfm2ranvs t)trenmrcoodopD lnvils0 2xoxm3oy4optemivtat)sDuaxm ;u4openmo3tytlm2umnvs u) exnxf3iotlat auvo;s0srumxm io1ameelncsls)srtrxmooo1apeomi3iysls2eanvpnt)trtoir oatomDranvol()t2tmio iy1lleelfvsl( s2ra(  ;u4apt iiciadlmDumnms u4tetoiocoadfpt aues;(0seumim3oodaptnmivias) Drmumpot4tleoiieiyt aDrlnms;u4tlxnmo oytoaDeln s s0 rxo(r nydopee nvsat srumxroot0tpxnmictas mDrl(vp () etomo3tatlm rauvs (  2tmxr io4lltemfciasf Dur(rpnt4olx mictadfs ea( p u)arenxf3tadfptraieo s  rtr(o iudap elfvi (faDumu  ot4apeo o3iltls2rm( o;(0alermoctodoa r ueilt)teumir3iu1alt liesl() rtrurp;o4tleomieild m raumsn(4teeoir oadomteaies t)s2trxm no1al  livi sf 2trumoot1oleoiieiatlm rlu
\ No newline at end of file
@@ -0,0 +1 @@
+ues t0 2tmxm oo4al  lfctlt) rrmur oo1tpe  f3ildls ra(mo;t0 eenmf tytlmDrlnvils0s2tmim3oy4ap e neilt sDrr( p;u4tlx mi3iys m2uanmp () rxoxr tydopDr uvi s)setr(m3oudamt mnvs (fa2um(ro;u1teto ieilsls uau s (0trtoxo3tytfmDe ues;t trurirpoydlmen nctlt) rtaxmo;o4olxnifciasla2ranmp;t)trxoxo3tydoat anvol( trxrxo iydolt  ici ()artr(mpno4ape moeiltlm2ul(mp ()trxrxo3ty1lm   ueo;(  etr(m3iu1lltemnciat) Duau o;u0apxoifciydla ulums;u)altnmrcio1lpt luvo;s0texm(o iudam  mfetas)sruax o;t4tltnmoeiysfa2ra(vsn(4tetrmocoatlmD li i;t0 rtmir3oy4ameelneia( sDrmxmpoo4alen iciytfaDrmu sn(4 eerxrcoadfat  i ils  rurio iy1ll  mfcsl( sDtrxr ;o4ole iictasfs elump;(0tlenmfciy1fpDrlneo;()trurim io4optn fvs tf rtmxrooo4opx  oeiaslm elnvs;t0aetoir3to1faDrli il( texo(o3ny4lme lfvsl(  2rrumpno4aet mfciltlaDuanmo;t4trermo3oytopt  nvslt  euo(opiodol nmietlt) 2rm(r ;u0apeomi3tas m2el(mp;t)aetoifcoy1fmDelieo;s s2tr(opoo4aptn nct tfsDum( ont4aetniiciyslmDranmo u4 exrxo to1faDe n i ()seto(r ny1lpenmieta(fsDrr(m nu0olt moctatlmDem(mo;u)tlxnmf todfa  au s () 2to(m3iy4ame mnesls sDua(r oo4tpxomfeiltfs ean sn(4tltnmocootoa  lnes;s) 2tr(opoo4ll elfet (  rum( pot0aetoif3tydfsDemn p;u0 rtnirctydop raieo;t0t2xm(rpiodamtn ivil() 2umum oo0olt mi3ias a2rm(vpnt) rxoif oydfp raieils)srtmim oy4lm  mictat sDtmxmpnu1tpeomfciatlaDrl( o;t4artrio3oo1fat  n il(  euoim oo1amen iciasfaruaxmonu4opeomoeiyd mDrl(vo;(0tlxnifciadom r neilt seumirpou4lp emncia(fa2rrurpot4tlxomfeiltfm2rluvo;t)arerif tadoaD  nei (  euoirpio1alt lict () ruaxrp;t1alxniieiysfmDea(vp ()aetoxrciotfptr u o ( s2uo(rpno1ol n nvs t s2ta(mooo1tpe  fciyt s uln s t) eerxfciy1op  aies;t trxmir io1omeemneia(  rumu  ot1tltomo3iyd aDuan s;u0 renifciotop rli ilt0 etoxo iy1aptn ivilt  rtrxmp;t0tetnii3iadlmDuanmont4tetrirctydlpteau s;s0srxo(r nudapte icilsfa2ra(rono0apeo i3iadls ulumpn(4trtnxo3iy1fp elues;t0 eum(o3ny4amt mieia()srua(mont4oeto i3tatfs um(mon(4aetomoctadoaD au o t)seuo(rpio4omenmnci t artaxmont0aeenifctadfaDemuvsn(4 rtoif ta1fpDrlies s  rtrir3nodalt mfesl(  2uax ooo4tet ioetysls ranmpnt0arerxfcoa1oaDr i i;t t2to(opoo1apenmnetas)arur(r nt0olt ifciydfm2rlu p;t4 leomr io1faD lnvs ()srum(r3io1am e fvi tfa2trxro;t0openmi3ildfsDemumsnt4 leoir3oydlp r ieo t0t2uoirpiy1olte fviatf rua(m ;t0apxniociad mDrl( s (0areriociodoaDeluvo;t0 2xmiopou4ap nlnesat)s2umurp;t0opxomfeiatfs uauvo;(0 etoxo3ta1fmDrlu i t0s2xmxo oodom n nct tfsDraurpoo1oetnifeiadfm ua(vo u4tlxrxf3ty1fate ueils0 rto(r3iodopt miciasf rtax  ot0alxn fciltfm ulumpnu0teeoxf3oa1omDe iesls) rxmxrpiodlptelfvtas)aDtru ono0opt mf3iytlmDrl( p (4 rtrir3todfm   ivs;s  eur(o3oo1ame mfcia( sDtmxrpno1oet  o3ilt s rmump t0tlxnmf oadfptr ies s)teuoxopoy1omen ietat) rrr(mpnu1apeomfetytlmDum(vpnt0 ltoio tydop  au o s)srxm(o3nodlmtelivia( sDtax pou1tlt iieiysfaDuaump t0 eenxf3oo1oaDeli o (0s2umxr3oudlptemncia( srrrx ono0tpt if3ildla umums;(0 lenif3iotfmD luvo ()trxrirpoodole  nei s s2rmu ono0aeto octydlsDem( ont)teeomrciatfpD aivi (0 2tmio3nu4lm elivslsfs2rmu o;t1tpx ii3iytfa um( p ()aleoir3iodopDe uvi t) etr(rpio1ll elnciltf Dtaxmpou0olxnmfciadlaDul(vo t0tltomo oydfpD aivs;t) rxo(m3oy1al  livs tfaDrmxrono0altoifeildfsDuau on(0tlxoiocta1fmtrlu o (0 2tmio3oydap nmfviasf 2rmumpnt0tlxnmfciatlm2umumo (0aeerir oatomDrlu s t0trxmiopoo4amtelfesat sDum(rpno1alxomictls m2ra(vp u0tltomr3totopDr ivo s)sexrio io1ame  ict sfs2uaumo;t4tleo o3ilsfsDra(mo (4treoxrctatlp rai i t) rxr(r3iudlm emivsat  2ta( ont4ale  f3ilslm uluvs t4aexomo3iodop e i s;t0 eumir no1lm  livs (  2rau  ;t1oexo i3iad m ua( s u4tlermf3oodlmt  nvs t  2xrio io4ap  liesatfaDra(m ;u0texomi3tlsfs2elu s;() rtomf3oy1op eluvolt seumio3io1amenmfetasfs2raumoou0teto i3iatfm2em(vp ()alxoxr todlp  au olt0trur(rpnydol emfctat) rtaxr ot1opx ioetytfa emnmpnu) ltrmr3oadfaD aneils0tetm(r3ou4am emivsl(fsDua(rpnu4ole iociatfsDumu o;(0 etnio iotfpDelu s;(0trumir3oy4altnmfvt s) Dumxm ou4altnif3tatlaDul( s;t4 eerxr3iydopDran i;s setrxr3iy4ol nlfvtltf rtrum ;t0tleo ictydfm2eanvonu)tetoxo tytlptrluesl()seur(mpnu1op nmfcia()artmumpnu1apen f3iyt a um( snt4tltnmr3oo1opDranesls)srurirpnodolt mfet s srrm(  nt4olx moeiltla2ulumo;u0 lxoirciydfaDeaivols)s2um(m3oydomt  nei s  Dumu ont4tpxomiciyt aDemn pn()tetoxf ia1lpDrai s s)s2tmxr3oodlme  icia(fa2um(mono0oet  ociydfm eln pn(0 rtoxr oa1omte nvol() etoio3iydllte fvsas) 2umu onu0apx mf3tasfs rl( p;t0texnmocoodoate i o;(0 rurim3nu1ll  liei () 2tm(m ot0oeen f3iatfsDran snt4tlxnmrcta1opte u o ()tetoxr3ou1omtn iesl(f rra(  ;t1oetn oeils m2ra( p u)altoir to1fatr ivi;t0tetr(o3oudope mieia( artrum ot1tlx ifetldfa2ra(mp t4 exomfctodfp ean s s)seumxr io4amtelictasf Durxmp;u1aet mocilsfm2em(monu0 etrmr oadoatranvs;t0t2tm(opiu1ol nlnvtlt s2raxroot4aptniictas m ranvp t) etoxf iotfpD  u s;t0s2toxmpoy1opt lfct (farrmx  ;t1oeto oetasls2ra(ms;t0tetnircoodlp rai o;t) rtoirpnu1alee nei ( srraurooo0olx  ocilsla um(mp u0texoxr totla   u slt)s2xo(mpno4lltnlneils sDurumo;o1tpxnmi3iatlmDelums;t)tetrmo iotoa   u ils0 2uoirpnudol nlfvtltf Drr( p;t4ole mfeiyd s2umnvs u0tleomocoy1laD  u i s0texr(opny1oltelnvi (faDrmu  ou1oetnmo3iasfa2emuvont) exnir ootlaD au o;s  rtoio3nudapt  feiat aDtmxmonu4oeen ieildlsDraumpnt)tlxrxr3tadlmtean sls)s2xmio nodameemfvsl(  Drrxrp;u4aptoifciyt aDemumon()tetoxrciytfaDrau ils0trxmxrpoodal e ivsasfsDtm(m oo1tpe mo3ias s ea( onu0aexoif oa1la   uvi t0t2xmxm3oy1lp   ivia(f Dumuroot1tpenmictyslmDum(vsnu)aetnmociytfaDeau ils0t2tmxo iydapeemics tf rum(root1oltnmocilt s rluvp;u4 etnxr3to1faDeau s;t0trxoxr3no4al nlivias a2ua(mpoo1tetnmf3tadfa2rlnvp t0trenmocoodfpteaueo;t  rumiopoydam e fvta()sDuaxmooo0oetnmietltls2emuvo u) lermf iodlpt luvi;t) 2urir iy1lptn ietas srrmum no1aeeniicilt aDulnmpnu4teerio oatlpD lnvilt0 2toxm ou4omtnmfeiat) rta(m ;t0tlxomoeiytfm2ra( p u0altrir oo1latr uesl()sruo(r3iy1lmtelivs s) rta(roou1teeomo3iltlaDuanvonu)artomo3totlaDrlnvils seum(m nu4omenlivt s sDtr(m ;u1aexnii3iydfs rlnmo (0tetnxf3iytlmDrai o;s) rurir3ou1omeelnct s  rtm(mpoo1aptn fetlsla rauvo u4tltoir3iadoat  nvo;( seurio iudlmt  icia( srur(r ou0opeo i3ilt s rl( s (0 eeoxrciotlaD  ivo s0 2uoir3io1am nmfcilsfsDtau oou0opeomfciat a2rluvpnt0 lxnio3tatfp eln il()s2xmxm oydolen nctlt)srtmx pot0aexnmfctad mDem(mo;t4teeoxo3io1lptranes ()srtoir3ny1lmtnmietlt)a2rau pnu1opeomfeiyd s uluvsnu4 ltrxf3tydoat an s (  2um(r3oudam  mici ()s2tm(ront0olt ifcilt sDuaumon(0 rtoxo iy1faDeanvi (0tetmxo iu1aptemncslsfaDrmxmo;o1optnmoctyt aDrl(vo;u)teeoxrcootfa  aues;(0srtm(o ny1ll emnciltfs2urxr no0oleo f3tlsla el( p t0 rxrxr oadfpt  uvo;s) rxrxr3no4om e nei ()a2rauroou0oetnmieiadfsDulnmp u4tleniociatla e ivi;t0 2urxo nu4ol nmiet sf rtmu pot1apto octydfmDrmn o u0teerifciadopDeauei t srxm(m nodoptn fcs s aDrru ooo1aetnmociys s2ulnmsnu)alxnif iatlpte n sl( truo(mpiy4amtn ivil(fsrtmxmono0olen i3ild s elu p;t)altomo oydfat aneols0s2tm(o nodaleemiesasfarua(m ot1oeeomfcias s eaump t0 etnxo3iatlp elu o s trtoxo3nudlmeemieiat)srtrurooo4oee mfciytfm2rl(vp;t0 lxnxo iatlmt an slt)setmio3iydamen fei t arrr(mont4tpxnmi3tasfaDemuvp t0 rxrio3oo1omDrlivi s0truo(opio1olee ictltfsDtmxmp;t4oeenmf3iatlm2umump;t4teeoxfcto1fpDe ivo;s)s2tr(opno1am nlies t  2tr(mono0tlt mf3iltfa2um(mpnu)tltomoctotom r uvo s0t2umxo3oo1oltemivia(  Durxr ou0texn iciaslmDrlnmo t0arxrxr3oydlaDeluvs (0sexoim oudole lfeta( sDrax  oo0apxo i3iyd aDumnvs;u)teenxfcoytfmDeaieo s)setoxm no1lpee nviasf rtau pno0tlxnii3taslm2uln s;u)arxoir3oadlp ranvs (0srto(o ny1apeelnet (fa2rru  nu0olt  o3tld m em(vsnu4 lerir oydlateln o t seumir3io1am e fes (f rumumpoo4apxnioctlt m em( p (0trenif3oadomDr uei t srxo(r iudlmenmicsat)a2rr(  no0aetnioetld sDum( s t)alenif ty1fatranvols) rxmir ou1lle lnvta()sDrmum nt0tlenmf3tls mDumn ont4trerifcoatfatr nvs t)srurirpnydameelfcia()sruauro;t4apxo i3iat m eanmo u0texrxociatfm e neilt  ruoir3iu1ll  mfcsl( sDrru oot4opxomfetydfaDranmp;u)aeenmr iytlp raneol(0tetr(opny1lltnmieiltf 2ur( oou4tleo ieiaslm2rlu snu)tlenmr oo1la elivilt)tetmxr3nu1opeemnct s  Durx ooo4alxnmi3iadla uaump;(4alenxr iydoa  lies s0t2umio3oudam e nctls)aDta(root1tltn ociasfs2rauvo (0 etnirctotomDr i s;()setmirpiy1lle lnvias) 2rmurpnu0olt  ocilsfm2uanvsn(0artnxf3oytfa rai o s  rxmimpiy1apen fcsl(f Dtr(ronu1tle if3iaslm eaums;t4artrmr3ty1fm eln i (0texoio nu4ope miciltfs2raxmoot1texniietaslsDea(mpn(4 ltrxo tadlptraiei;t)s2uoim nudop  livsas) 2tmxm nt4tpe io3tatla2raumsn()arxnmr3ootomD ln olt  2tr(o iydalt  fvsl(  2ur(  nu1apxo f3tadfs raums (0 exomr3oatlp rlu i;t0 2tm(o iudlme  ivsltfsrurxm ;o1teenio3iatfaDua(vs t)treomrcto1op r n o t  2umim oy4alenlnvi s  rumxmpou4opx iiciydls2rmnmsn(4arxnmo3oatlpDelueols srur(rpno4lmt mfcsas)aDta(rp;u4texn i3iad s ra( s u) etrmo oa1omDr uvo () 2umxmpno1lm nlietlsf 2rm(mpoo1oetoifctat a2rlu ont0 lerir3todoaDr n sls0s2xr(r3iu4ameelnetasfs2rrxmpou4tlt mietadls2rmn snu0aeermfciy1fpDr nes;(0trxoxopiu1lp  livs sfa2raur ;u0aexn ictas s2rmnmsnu)texnxo tadfm r nvils) exm(o3ny4lm n fvtat)artaxmonu1opt mociytlm2um(vonu0 exomr todomte i s t)sexo(rpnydlme mnet ( s2urxmont0oee  ictldla eanmsnt0trerxociy1oa e ueolt srxmim nudopt lictl( sDrrx oot0alen fctldfm2rmnmo;u) leomociadfaDr uvo;t0truoxo3oy4oltnmfvtas  2uru  nu4oeeomf3iytfsDuln p;u)arenxocoa1om  luvi;(0s2xm(r3io1al e fvias)sDum(m ou0olx moetasfm2emu s;()tltomf3iodlmD livsls0tetrxr3oydop elivt t) 2tmum ot0tlt  i3iasfaDelumo;() eerio iydfp ranvi;( trtoxmpoudamenlieil(f 2urx pnu4aee iociyd s2raump u)aeenircoatlateanvslt  2xmim3nu1openmncilsfs2umu ont0tpto iciydfa el(vp;(0alxrifctotfmt li o;(0trtoiopny4ll n nvsl()artaxmo;o1oet mfeiadlaDea(vpn(4 eeoxociy1oa  livo;(0t2triopou4altelfeslsf rum( ono4olenioetlsfsDeauvs t4 exomocio1oaDe nes ()trxr(mpnodll  mivtas s2rmx  nt4aetnii3iadls elumpn() eeoir oadom r uvo t  2to(r ny1lmee nvil(farum(mpnu0ale  feiatla2ulnmo (4 ltoir ty1faDrlueo;( srxoxr3no1apeemnvia(f 2tmx oou1ape io3iysls2ea(vo;(0tlxnio3oy1late uesl(0truo(rpoodalt mictlt) 2ua( pnt1opeoifetltlmDel( o;t)alxrmocto1op  an o t t2um(r3iy1lm n fvi t) Dur(r ;u4apt  oetat a emnmp;()alxoifciadlatr nvils)t2xoxo nydam   feslsf rtrx  ;t4aetn fetlsfs2em( pnu0areoir ta1faD lnvo ( t2xoxrpno1opt mies sf rumxmont0oexoiieiys s umn o t0aleomo3totoat an o s  rtoxopoy1ol   ncias arta( ont1tlxo oeiysla umnmp;t0artnxf3oo1oaD  n s;s)tetr(rpiudlme  fct s)aDrau  ;u4ape  o3iyt m ulu p t4tleomocoatom e nvs;s)trxmimpiy4om n nviasf 2tax  no0tpt mieiatfm2eln s ()arxnmocoa1oatrlu i ()teur(r no4omenlncilsf 2ra( poo0aex mf3ils mDuluvpnu) lerxr totoatranei ()t2umir oudapt  fvs t sDuau p;o1olenio3iasfm2el(mo u0 etnio3oy1oaDr i i () 2tr(o3io4omte nct tfaDrm( p;t0texoiictatfmDrl( s;t4tlermf to1om r n sl() rxo(r ou1omenlieias sDrauro;u4tptomfciydfmDeanmp;t)aeerxr3tytlmD ai i t)t2xm(o3ou4om emivi t s2ur(moot1tpx mietysla2um( s t)trxrio3oy1fm e uvo;() eumio io4lpeemnviasfs2rrurono1tlxn o3iyt aDum(vo;u4texrmf3tydop r uvol( srumir3oy4ol n neil() rrr( pot0opxn fciytfs ul( o u0aeeoir3iy1faD auvi ( setmxo3iy1ll  mneil()srrm(  ;u4optoioctydfsDulu onu)aexrxocoy1lpDeluvs (0srtoxmpiydam  mietas)srraxm ot4tlenioeiatfa em(vpnu4areomociydlpD aivs;(  rxm(o3oy4ope  icil( artmxrpou4aptnioetydlmDemu pnu4 eenxr3ta1lm  lneol(  eumxm3oy1lltemnvs t aDrmuro;u4alenmfciysfa2uln pnt4tetomf3tytom  aies s  rxmxm iudlmtn nvt ( srtm(r no1apt  fciad sDelu sn()arxrmrcoo1lm r ieo;()texo(rpnudaltnlfci s)artrumoou0oexniieildfaDemnmsnu)altnmfctadfmDraieo (  etmxr3iy4ape mici s  rumurp;t0texnmfciys aDua(mo (0 lxomr3ta1fa ranvs;t trxrxrpoy1oltemfeil( aDrmxm no1tlxn feild m2elnvont4alxnxo3iytla elneo t0 rurir nu4lle lfctlt sDuru ooo1tlxnif3iytlmDea(mo;t0trxomocta1omDrlnvsls t2tmiopny1lpt lfetasf 2urxrpot1texo feiadlsDumn p;(4 lermr3iydop   nvi s)trtmir3iydap n nvs tf Dtmx o;o0ape  ociltfa el(vp;() ltniocoytopDrlnvi s0t2trxm oy1altelfeil()s2rax  nt0aetomo3iys sDrlumpnt0arerxoctatop eaiei s setm(r3nodlpe mnet s)s2rr( pnt4tptomoeias mDrauvp;() ltomo iadop   ueilt) 2toxrpny1lpt lfct sf Dumxmonu1apxomo3iad m2rlumsnt0trxomr tydlmtr ivs ()t2xm(r3iu4omt  ies (  2trxmpoo0alx mfeilslmDrmnmont4teerif oo1opt  nes;s0t2to(r3iu4am emnct tf rrru o;u4aptn fciytfmDrl(mo (4alenio3ia1fpteau ils seurxr io1ol nmfcs s  2uru pot1oexomictysfm2elnvpnt0 reoiocootlpt  n ols0s2to(r3no4op nmicta( aDtmur ;o1oeeomf3tls a2rmnmonu) reoxf oatopt  nes;s)trxr(m3oudll   ietl(farum(rooo1opxnioeiydlmDel(msnu4 rtrmf ty1lp  ln i (  exo(m ny1ome mivsa() 2raxm nt0apx  ietysls ea(vo;u)teerxf iydfpDean ilt s2uoxo3nydomtnmiesa(f 2urx  ;o1tpx ioetltfm2elnmp;(0 rermrcoo1fmteaneo t0t2uoxo io4om nmnet tf rrax pou1tlxnmfeildla eln p;t4trxnmrciotoatrlnvo;()t2toxr oo4aptn nviltf 2tmu  ;o1alenifeiydlaDea( p u4texoxocoo1fmDeln o t) rtrim ou1aptnmncsasf Drrxrpnu1aleo i3iadfa umu pn(4aetoio ia1fm e uvolt  eumxrpno4ll nlneil(  rtmu ono1apxnmicilt aDel( s;t4trxomr tatfmte u s;s0trtmio io4oleelnesls)aruau  ot1aeen fciysfs ea(ms;u0 ltnmrciotla e i il() 2xoxopiy4lleelfcsl() rtrx pnu4tet  o3ilt s2ul( s (0tlxnxr iotlaDraivo;t0s2xmxr no1optnlfctl( aDtaxr ;t4tpx  fcils a ra(mo (0 exrio3oydopD  uei;t0setmirpiydaltn fcsa(f rum(roou1ale  iciytfs2rl( p (4aeerxo3oa1fmt  i o;(  etmxopoydamenmiet ()sDuaumpoo1tlxn ictas s2uanvo u)tltrir3ia1lat  ivslt  2trimpoudlltemivtasfaDtmur nu4ole ii3iasfm rm(mp t) rxnmo io1om e iesl( trur(r nodop nmicsl()s2uau p;u4teeoifeiysfs2emnvsn()alerxrcootomtraivs;t seur(r3nu1omtnlict s)s2trurpot4tpeo fctydla ean s (0teenif3io1omD  u o s  2uoxopiydole  nvsa( a2umur oo1oetoiieilsfm2elu o;t4tetomr3oy1la  an i ( trxmxrpno4lltelivil(f Drrxm ;u0tetoiictyslm2uanvon()treoxfcoodlmtranvilt0s2urirpnodam eliei sf rrmum oo1olt  o3ilt mDrm( p () etrxo oa1lp  ai ol()teurxm3oo4lm nlivi s sDrmx poo1oet  ietat m2el(mpn(4tlxomf oadom rlivi (0 2xmirpiu4lme licsls)s2um(mo;o4apt  o3tytls2ran o;t4tlxrifcoodop rlivi;t)t2uo(m3iu4alee nci tfa2tr(  nu1texomoeiydla2rl( snt0artriocoy1fp rauvo (0srxm(rpny4lm emnvi s srtru pnt4tlt mf3tys a2rlu p t)tltrif3ta1fa rlu i t t2uoxrpny1ape  neta()srrau  ot1tlxomf3ilt sDul( s;(0artomf3iodfaD lnes;t0 eumiopou1alenmivs (fsDuaurooo0tpeoif3ildfs elump t)artrifctadfpD  nvi t)trxr(m iudam   fvtat)s2um(mono4tpenmf3ilsfmDumnms u)altnmo ootfmD  nvi (0 2uoirpou1olen icias srtrx p;t0tlx  oeilt sDum(vs u4aexnmf3oy1om rai o;(0 2uoxr3io1ome lfvtl(  rumuroot0apen fciasfm2rmnmsnt)aeenirciodop  auvol()srtriopoo1ope lnviat srumx oou0alenmociasla umu onu) rtoxo3oytfa eaieils0 exoir3no1omenlivs () rrrur ;t1tlen feiad s2ul(vonu4trxoirciodlmtelnvo () 2uoio3iy4al eliesl(faDrmu  ;o4tleomfeiys sDem(mo (0tetrmocoytla r uvi;(0truoio ny1lmtnmfeilt)a2rrxmont1oee iieias mDem(vsnu0tltnxfcoydfmDe ueo;s0srxmxrpnudalt mnesasfaruaxmono1tltoiocilsfmDrlu snu4 ltomr3iytfaD aivo;s  2trirpoo1olte nvs sfarurxro;o0tle  feiydlmDemumo;u4arxrmr3iydlp eliei t0t2ur(o io1op e ivta(fsDurumonu4apenioeiytfm rlnms;t0trxrxr3iodlmD ai s (0 rxoxmpnydomenlncta()s2umx pou4apxomf3iltlm2ranmp;() renif totop r ieo ( seuoimpoo1ol  mivsa()s2taumoot1opxn iciytfs2ua(vsnu4altomo iadop eliesls0 etrxm nu1llt  nvsltf rrmxro;t1texo fetatlm uan s;()aetnxo iadopD  ues;s)s2xo(rpiudomt liesl(  Drmumpnu1aexoiieiad a raump;u) exomocta1laDe n o s t2tmxrpoy1apeemivsat a2ta(mp;u1tetn i3iasfs2ea(vp u0tleoiocoa1fmtelneo;(  eurxm3iudlm  mictasf 2urumo;o4texoio3iytlaDrlnms;(0tetoxf iydlpte ieo () rtmir3oy4lpe  nctasf rta(mpot0aptniieiyt a ea( s u)altrmr tadlatrluvsls0srur(m oo4altnmncil(  Dtmxro;t1tpenioeild s2rl( p;t4 leomrctodlmD anvsls)trtmxr3ny1ope lnet () Dtmx oou0aptnifcilt mDel(vp (4 ltoir iotlaDeli i;(0seurxrpnudlltnmnctl()arum( poo4tpe  i3tysfsDum(mo t0 leoifcoy1la raivs;t  2trir oudam nlnvi ( aDtrxmo;t1tlenifcildlmDul( s (0 rtrir3iatoate iei s trumxr ou4ol   ivs s a2raumont4tlto ociltlm2um( o;u0 ltomociy1oaDrlnvo;s t2trio3nu4oleemfci tf 2urx o;o0opeo iciytlm em( snt)tlenir iatlpDr n s () etoirpno1ap e ivta(  rurumpot1aptomfeiadls2el( s t0teenmf3iy1omD aiei;(  2xr(rpiy1ll e ncs t) rtm(m no4tet ioctatls2ea(mp t)alxoif todomtrlueo;t)truo(opnu1lptemiei s  rtmu  ou1ale  ieilsfaDel(mo;t)tetnmrctodla  lieolt trxrxrpnu4am  mfvi ( srtr(m ou0oet  o3iasfa2uanmo (0arxnxr tytoatrlies s0 rtm(m3iu4opt mfvi sfs2raxmp;t1opx moeiltfs elu pnt)tltrxfcio1op rlneo;(0seurio3iu1omt lncs sfs2tru o;u1aexnmfctltfa2rm(mo t4trxnmf3iy1op eai s;s texrir iu1ol n fcil( aDua( o;t0oexomociydfsDrmu p;u) exrmf3oytfm r ivo;t)texriopiu4al   iviltfs2um(  ou1alxoifctadfa2ulu p;(0 leomf3oo1lptelivols)trumxo3oy1altnlfvtltfsrur(moou0tlxomi3ilt a2emuvs u)artrmo3tatlmte ieols0 rtoir iudlmtn fvsat  rua(mpnu4aptomfciytla2umnvo;(0 lxnmf tatlm r uei;(0 2xmxm oudol e fcs s sruaur ot0oltnmoetytfs2uanvpnu)aetrir oadopDelivi;t) exmiopiydll nmiet (fs2rru o;t0tle mfetadlm rmu o u)texrir oodoaD ai s ( s2xm(o oudopen fvsl() rur(rpou4tlt mfciys m2umnmp u4aeerxr3to1oaD aivilt) exoxmpoo4llt mfvt ( sruax  ot0aee mictltfa2ulumsnu4aetrmo3oytfaDe neolt) 2xrxr oo4lm nliei t)a2rmumonu1apt iociat s2elnvont)tltrmrcoadlm r ies;()trtmxo iy1ol nmictas)aDua( oot0opt  ieiad m uanmpnt0trxnio3ta1lpDe nes;t)texmiopny1lpt mivt s)artaxroou0ope  f3iyt mDumu s t4 eermfcoa1om  aivils texm(m oy4ap e ieiltf 2ra(  ;u0tpeoiictysls2el(vp u)aexrxr oatfmDe nvs;t0seto(rpou1ape  fes t)aDtrxr ou0oee  ietldfaDemuvs;t4alxomf3oa1opD aivo (0trxoim iydomtemfcs t s2uauro;u1oeeo feilsfm uan s t) etnxrcia1la  auesls  2urxmpoy1lp   fvt s srrm(  ou4opxniietytls2ea( o;u4 exnmr tatfat aivo t setoir3iy1ll  lfvilsf 2umu ont1apxnmicilslm2el( p;u0 lxrmf oytlpteln i;(0s2uo(rpoudomen nct () Draxmpnt4opeomf3iltlmDeanmp;()aleoio3oy1lmtr neil()sexmxo3oy4op n fetat srtmur nt1tltnif3ilslm2elnms;u) rxniociy1fmtelieo () rurim ou4omtnmfeilsf 2uaumonu0olenifctldfm rl( pnu4 ltnmf ia1fp eli sl(0 rxrir ny4alenliet t a2tm( p;t0aee  iciytfa2uluvsnt0trerir3ootlpt lu o;t0sexr(o3ou1altemnvt t  rum(mooo1tptnifcilsfm2ua(msn(4 lxnxr3oadomDrlnvi ( texoxrpoo4ame mncs sfsrumur ;u4oexo ieiytfm rau ont4 rxnmrciatoaDeaneil() rum(m3oudlptelietasfaDra(ro;u1oex  ociatfs2el( o t0tlerxociytopteluvi;s0trurio3iy1ape miei s) Durx o;t1tlxo i3iasla ran p (4 leoir ootfpD  uvi;()s2uoio3oo4lmenmfetlt  Dra(  nt4altoif3iysla2rau p u)tltrxrciy1lp elivi ()t2ur(rpoodalt mfvils)arrm(m nu4altn o3tls sDea(vont0aeeomr tydfp rlnes (0t2uriopoo4ol nlfvsls)arurum ;u1tetniicildla eauvon(4aexomo totfa   n i;(0 etoxo3iy1al e fvsltf 2ta(rpnt0apxn oeiatla2em( pnt)altrmo3oytlatr uvils sexm(opoo1oleelivilsf rtm( pot4olenmieiysfa umu pnt4trerir3to1oa r ueo;t) exoio3nu4ll nmfetasfsrrr(r ;u0opeo ictatfa2um(mo;t4aetoifcoadlaDr uvi (  2xo(m3iydoltemieslsfaDraurpnu0tpx ii3tyt a2um(mp t0aleoifcoadla e iesls trxoxo ny4omenmivil(fa2ua(r ou0aeenmf3tltfs emumsnt0 rtnxf3iadfp rlneo s srtoir oudomtnlnvtlt  2rm(r ou1tpeniieiytlsDeluvpnu0 rxomf io1op eau ils srxmxmpno1omtnmieias)a2uaxrpot4olt  f3iysfsDulnmsnt0altomo3oo1fmtrau i s seuoxr iodamtnlfvs (fs2ur(r ;o0aeeoioetasla2emu o t4artnmr3iydfptrauvi;s0 eumim3no1lmte netat a2tm( pnt1openmi3ilslmDea( o t)areoxr3iy1fp  aiei t)t2xo(r3nudlme lfei ()sDumxrp;o4tpenii3ilslm2rm(ms u0 lxomf iytfptr n s s t2xriopiydllenmiviltfa2rmurp;o0altnmoctad s umnvon() reoio oatlatr n ilt trtmio oudll nlnct s)sDtruronu1aeenii3tlsls ua(mp t)artriocoo1lm  livo;t0trum(m iy4optn nviasf Drr(rono4aleo ociat sDra(msn()aeeoxf oodlpt auvsls  rtmim oy1lltelivi tfaDtr(rp;o1aeeoiiciytfs2eanms ()areoio iadfp  anvi t0s2ur(r oo1lpenlfvtls sDur(mo;t4teeo fctad mDul(mo;t)texomf to1optr uvo;s  rtmio iy1amtemfeil(fsDtmuroot1tptomf3ias a emn o;(0aetomf tadoptr nes;( t2urxo3ou4ll nlnvt tfarrr(rpou1tpx moetyslm2emu onu0trxnmfciy1fa   neo;t0seuoir3ny1ome  fvtatfsDrru p;t4aetn fciytlm uan s t4tleoir iodlmt liei t0t2urxm oo1ome lnviatfaDtaxm ou0tltoioctlt m em( o;u0texrmr3totlmt lies;t)setmirpnu1al  mfctatfs2taxmo;u1aeeoiietat sDem(mont0aeenifciydopD liesls  2to(o ny1amen fvils) rrru  no4tet mf3iysfs rmn p (0 eeoiociotop e ivs t  exmxm3oy1ape lnci (fs2ra(root1aptn ictltfa rau o;t0tetrxoctadomDeaneslt t2xmim3oy1alt mnvt t  rumxrp;t1opt mi3iltla rlumo;(4 exrmoctydfp   uvo ( setmim3iodol nmncilsfs2urx p;t1tlenii3iysfs emums (4 etrxrcty1om e n s s s2ur(opnudop   iviat)aDrrxm oo4alxo ictyslmDulu sn()areomf3oodfm   nes;t) 2urir3oo1oltelnvsat)sruaxronu4oetn oeiltls rlumonu0aeeoxfciotlpDeaneols  2toir no4ol   fcils  Duru o;t0tex ii3tys a2rauvo;t4 etnir3oodopD anes t sexrio3ou4al elfvi tfaDumxm ;u1tpeoio3tytfsDrmuvo t)tlxnio3iydfm eai o;s) rtr(r oo4alte nvtls  2rr(rp;t4olt mieiadfaDrauvonu0tlenmo iotom eaieslt0trum(o3oo4oltnlncil()aDtaurono0apt io3tlslaDeanmp;t)trtnir tydfmt  i s;t0texr(o3oydamtnlnvt s arrau p;u4aetnif3iasfs el(mpn(0texrif3iotoaDr nvi;s)s2uo(mpnudlpt  net s) Draxronu1alxo i3tlsfa2eanmp;(0 leoircoatlp r n il(  rxmir3iy1am n iei ()s2uaxrpoo1altn fctasls rmnvs;(0 lermo oytlpt  uvs ( trtoir3ou4opee nvtlt aDtm(root1aetniociadla ran ont0aleomf3iadoa ean ol()t2tr(o3oo1apt  fesa()srrrxmp;o4apen f3tasfa ea( p (0arxrxo3ty1omtrlivo s  eurxo3iu1ol  mivsl( aDumx  nt0olto fciat a ul( o;(4teeoio ty1fpD aues t0t2tmio3nodapen fvsl(fs2rau o;o0tex io3iys m2elums;()arermo oo1lmD aueil()trxr(r nudomt  nvil()srtrxrp;o4teeoifcilsla eanmp t)tltniocio1fmDe ivi;t seumim oodlp  lncs t srrr(mp;o0apen octadfm ranmo u0arxomr todfmDrauvolt)s2um(rpiodapenmicias  2rmur ;u1olt moctatfa ranvo;u0texomo3ta1latrlueol() 2tm(rpny1am elivt t)a2rm(mpnu1aetoifcias sDrl( s u4treomfcoodla   neslt0tetmim3oodopte ici ()sDra( pno1aleniieiat sDum(vo u0aeermfcootfa e n o;()trurxmpnu4lltelieias)aDurxrp;t4tpeomoctls s eauvont) eenmr3iadoa  lues ( tetoirpnu1aptemfetl(  Drrxmpno0apxnmi3iltla2rm(msnt)tetomf oytoatrauvi;t)sexrir io4ap elieils sDrau onu4ole if3tytlmDrm(vs;t4trxrmr3iatfp   ivo;t)sexoxr3oy1lltn fvs ()srrm(r ;u4oleniietasfs2el(vp;(0alxrir3to1omt  uei;s) rumir3oy4aptnmfvtl( sDraumpno4ole  ocild a uanvpnu4 eerio3io1lpDean o;t) rxr(m nudape  nesl()arrrur ot1oee ioeilsfsDranms;u0 renmr3iotfp eau ol()seum(o3io1oltelics (faDur(m ou0opt mo3iadls eaums;u) lxnxoctydop ean olt) 2xmxo ou1ame  nvslt)artr(mpno0apenii3tasfm2uaumpnu) reoircta1fmt luvils0setoxr3oy1amen feil( s2um(moot4aptnmiciydlmDran o t) etnmr tytfatrlneol(  rxoxm3ou1llt lies t sDraurpot1aetniictytlm eauvp (0trxomr3tytop rluei;t) 2xr(rpnu4llen fvtat sDua( p;t1apeoioetasla2rmumo (4texomoctatlaDeaieo;(  rumir3oydaltnliesa(fs2rmu  no1tle  f3iat aDeanvs (0 lerxfcoydomtraiei;s s2um(opno1ale  ieias)a2rmx p;u1oex mictltfs el( pnu) lxrxf ta1la ranvol()trur(o nodlmt lfvsl( sDraum nt1opxoii3tat m rl(vo t4altoxocty1fp rluvsl(0s2tr(rpnu1al nmfctlt)arrrurp;t0apt  icild m2eanvpnu0tleoir3ootoat  neo;t setrirpou4lmtnlnvsa() rrrumoot0tpt if3iyt a2rlu s t)trtoxrctotfpDr ivs;t0sexrirpny1am nmivilsfsDtrxmo;t1opxomicilsfmDum(mo t)tltriociy1fat  ivi t  2trxrpiudlmt mfvs s aDra(m ;o1olt mictatlm2emnmo u)teenmrcto1om eaivols0srum(m3iu4omtnmnvslt  rum(rpnt4oexo f3tatls2rlnvo;t0texnmoctytlpD anvi ()srxmxm ou4aptemnvsat)s2raur ;u0oleo feiyt sDel(vsn(4tetoxrctotla  li sl(0s2xo(mpiodlm   nvtls) Dtrumont4tpxo iciytfm rmn ont4aexnxrcoodfpt anesls0 2umxo3oy4lleemivsas arum(  no0tptoioeiltfs em(vo;t4aetniocta1oatelues (0srtr(mpoo1am  mfvilt)a2tr( o;t1ale ifciyt s2ulu onu0aetniocoatfaDr ies s) rumxrpou4aptn ict t)arrr(mont4tlen iciysfm eln on(4trxrif to1op rau il( sexm(mpnu4ale lnvtlt s2urum nt4oee  ieils m2rlumpn()arxrmf oy1fpDrlivs;t)trur(r3iydale livs tfa2uaxrpnu4aee micils m2ran pn(4arxomfctadoaDraivi ( srtm(o3oo1om nmiviasfsDua(mpnt1olenmf3ilsfm ulums t4tlxnxr oo1om  ln ils0s2tm(r nudale miesltfs2trxmonu4apto i3ildfsDea( s;t0 ltniociatfpD  ueo () 2to(opou1am nmneia(fa2rmxr ;t1tltnmi3tytlmDrm(mp (0 ltrxfctotfp  lues;(0 eurirpnu4altnlivtat)srtmu  ;o1tlt iietldfsDulumon(4aexomr iadlmD aivs;t  etm(m io4amtn ivsa(f 2umum ;o4opx  ociad sDeanvsnu0 rtrmo oatlpDrln ils trxmxm3iydlm  mfetls srrm(m ;t1tetniietlslsDulump ()arenxf tatlp elivi ( s2xrxr oudapee ieta( aDurumont4tlx iieiadfa rauvo;u) etnif totfmtrlies ( t2umir ny1ll e iesls)a2rr(ront4opx mi3iltfs ra( o u4arenmo3iotlpt aues s) rto(o ny1omtn nvi sfsrua( p;t1tetnmo3iyt aDumuvp (0texnifcoa1oat lieolt)trtrxo3iu4lmtnlnei s a2taxro;u0tleo o3iat m umu s;(0 ltriocoydfm   ueil(0 exrxm nu1ol n nvi tf 2rau o;o1olto feiydlsDumums;t0aleoxo ty1opD aieo;( t2tm(m3iudllt livtasfarurxr ot1apxoii3iad sDulnvp u4 lxomr ootoaDelnvs;t0 2xm(rpoodlptnlnvtat) rrrur no1tlxnmfctad a rluvs;t0tlenmfciy1omt lu sl()s2xoim3nodlpt mnctlt) 2tau pnu4aeeomociyd mDuluvs;u)teenmf iadomteai i t)texoxrpoo1omtemici (  2raump;t1alenif3tlt sDumu onu)tltoxrciytlmtrlneo t0texmim iu1ap e ncilt) Dra( pnu0texnmicilslaDul(msn(0artrxocoadoa eanvi () 2xoxopou4om e fvi (fa2um(  ou0texnmfciysfa2rm(ms;u)tleomf oodomD  ieils0s2urirpny1lleemfcs s)sDuaxmoou4aexo octadla2um(vs (4trxnif iadlptrli i;t0 etmir ny1lmt mnvia( s2trxro;o1opt mfeiyd sDem( o;u0 lermfcio1lp r nei;( t2urxrpiy1lpeelfctlt  2rm( pot0tleniiciad sDulnms t0tetrmocta1fpD ln s;(  ruo(mpio1alt lietl(fa2tr(mp;o0tet iieiadfsDuluvonu4artrmociatopDeln o;t0sexr(rpiy1om  mnviltf rururo;t1opxomfcilsfa2rl(mp;u0texomo3tadoaDrau s;s texrimpiu1ol nmnvsl() 2tmu  ;t1olt ioeiasfmDul(vo;t0 rerio oydfmDrlieo;s0teuoxm oudomen fct ( aDum(mo;o0apenmoetlslmDrmuvon()trenmf oytfateau i;(0texoxopiu1op  micsa( aDrmurpoo4tpenifeiasfa2uauvp t0aeeomf3tatlat auvsls)t2tm(o3nu1ap elivs s)sDrr(r ;t4opxoioeiltlsDeaump u0treomf3iadlpt aivs;t)trtoxopiu4am n net tfsDur( poo0alxn f3tasfsDeanvpn() rerxf3iotlm eanvslt0s2uo(opny4opee iciltfs2tm(m no0apt  fetysls2elump u4aleoxr todfa  aueo;t) rtmim iy4ap emfvs sf 2uru pot1ale mfctydfaDelnmont4 lerif ootfm   u s;( seuo(m3iu1openmivt tfs2ra( ont4alxoioctaslaDranmp (4 lxnifcoy1omt lnvsl( srtoxo3oo1lptn fesa(  Dtr(roou4apxnmo3iys mDrm(vont4trenmr3oadfmtraueo t)setrim3oy1aleemfvilt sDtmxrpot0alt miciys m2uanvo t)trtoxr oytlm eaneols)seur(opiu4lp  mivsl(  Dtmx  nt1aee  ieiydfa2ulu pnt4 lerxocto1fmDr i o s0t2xmirpnodomt  ncs s aruaum nu4ole iieias a ea( p;u) eenmfciydomDranvs s s2trxrpiy4lm e feils)arumx oou0aetn f3iytlsDrl(ms;(0arxnif3ia1fmt aivsls s2xo(r nu1lpe miei t arur(r ;o1apxn ieiytfmDeaums;t0aeenmr3tydfptr n s s  rto(o no4lm  livia( sDuru ont1oeenioctasls2um(mpn(4 rtomo iy1opDeai ilt)trxoimpiu1llenlivil( aDtm( oot4ale  oeiydlmDuaumpn(0aeeniociy1fmt livi (0truoxm3ou4ol n ncs t) Drr( pno0aee moctytfm2emnmp;t0aetomo3oodop ran o;s  2urxm3oudlp elnviat  rtm(mo;u0opxnmfciydla2um(vp;(0 lxrxo oadfpt  u i ( srtrirpiu1omtnlict tf 2ta(mono0apen ictltfaDelnmo u4teeoio3io1omDeauesl(0srur(o nudam elivsls aDrauro;u4ope mieiydfm2umn on(0 leoio3oodoat au ilt0teto(m3iy1om  mfvtls) Dra(  ot0oleomoeias a rl(vsnt0 rtnxr3iy1fpDe i ol()t2xoim3nodlmee nvtat s2raum oo4opxnmietlslsDumump;t0 ltoiociy1laD  ivsls0trxrxr3io4lm elfcsasfs2taxrp;o4aleomi3iltfmDra(vs;()trtoio oatomtranei s)s2ur(o3no4lp  lnviat s2umx oot4tlxnifetldfa ulums (0aeerio3oytfmtrlu il()seto(opoo1ll  lfci (fa2tmx  oo0tpx mf3tlt aDua( o ()tltoxo ty1fatr i il(  exo(o io1apt licslsfs2tm(ront0oeen octatlm el( o (0tlxrmfciatla r ueilt0 eurimpoo4ll   nvtl(  Dtmxrono1apen f3tadfm2eauvp t)aeeoif3iatomt aueil() ruoxopoo4omeemnvsatf 2umxr ;o4aptn octytfaDua( o;t4aexomf tadfmDeln s;s  2trxopiy1apt mneias)arurum ot0opxoifeiatlm el(vs;u4 ltrxociatlptr n i (0 2xr(mpno1ol e ictlt arur(mpoo0aeen iciaslm2uanmp;()aexrmr3iadfptr u i () rxr(m3ny4ap nlnct s)aDrrxr ot1aeeoifetyslm2rm(mo;t4trtrxf3iotop eai slt)s2xrim oo4omtnmicsl( aDrmumonu1aeeo fetadlaDrluvpnt4aleomf tatlmte i i;( srtriopoo1op elfvs () rurxrpoo0alx mo3tasfs elnvs u4aetrif3ty1lpD ai sl( tetr(r nu1lme  fvtl( a2tm(r nt1aex if3iyslm rmumo u4tleomr oadfatelies t)sexoxrpnodopte fvsas)aDrm(ro;o1optn i3ildls2ulnvp;t4trenxf tydoaDrai i (0tetmim3ou4open nvi s a2umx oot0tetn oetys s2em( o t4 rtnir iodfaDrlu o t  2tmxopny4aptelicia() 2um(rpnt0oex  o3iasfm2ul( o;(4tltnmrctadfa e ivs;s)t2xoxopio1aptemivt t artauroou4tpt mfciltlm rl( o t)tleomr todfmD  uei;()trxr(m3oo1lpe lfvta(f 2rrxmp;o0tlx mieiadlm ulump () etnmocoa1fmDeaneo;(0trum(mpoudop n nciltf rtmxmono0olx mfctadfmDra( sn() exrifciy1oateanvo;s s2xmxr oodalenlictas) Dra(ront0opt  fciyd s2em(mo;(4 rxoir iodoa   nvs;s t2ur(r iu1lme  netasfa2rru ooo1tlenmociytlmDranvo;u)teeomf3iy1oa raiei s t2umxopiu1ol nmfvil()srtaurp;t0tetoifeiltfs ua(vs t)aetrxo iatfm r nei s trtmxr3no4ale  fcsls)artmumont1tetnmoeilsfs rlumo;u4 lxoifctotomDr nes;t)srtmxopnu4ol  lnesatfsDraxro;u1open ociasfs ua( ont)tltoxf iadfptr uvs;s)s2tmir3oydamt  fvtat)sruaxmont0tpeo o3iatlm ul(mp;(0texnioctadlpt auvi;s  2xrim no4omt  iei () rurx poo0oee iiciad sDem(vpn(0trxrif3oydfat  u i s  rxrio oy4al nmncil(f 2tax ono0tleomfctltfmDuau ont)teermrctatopDeau olt  eum(m3io1alt mfctas)a2ua( p;t4tee mfctysls2eanvs u0altrxr iadla rauei;()seurim iu4ll e icil(faDrrxmoou4tpeoio3iydlm ul( o;u)aetnif3iotomt  n o s)texoxr nydol elnct sfarua( o;t4aexnmi3iytlm2rmnmp t0 eeoir3ty1oa  lueo;t0trxr(r3no4ale lfetl(  Dtm(mo;t0ole  ictlsfm2em( p t4tetrio tydfmteluvi;(0sexr(m iy4oltemiesl(  rtrum ;u1opxniociysfs raump;u4 renio oadop  lnes (0 2um(o ny1altnlivtlsfa2ua(  oo4apeo fetyd a rmnmonu)tltnmfctydlatr n sls0 etmio oo1al  mfcils artru pou1oex  o3ias a2eaump (0trtniocoadlmte i o;( texrirpiy1opte feias arurxr ;u4tpeo iciaslsDrmnmo;(4alenircta1lmDeln o;s sexrxo oo4lptelicta(  Drrxronu1alt mietyt s2eaumo;(0trxrio todlmD aivs t)s2xo(mpno1lptemfctls) Dtmu  ;u1apeoiieilt mDel(mp u) etnxf3oatoaDr i sl( t2tmim3iu1ope liei t)s2um(rpno1oetomoctydfsDua(vp (4aeenxr3oytomDe n slt)teuoxm io1lm   nvsa(fsDrrumono0alxomictys s2rm(ms;t0 ltoxr3tytomtr n ils)teuriopiy4omtn iesat) rurumpot0tltoio3tytlm ulumpn(0aetnmocta1op  anes s0t2xrxo nudale licta( s2rrxmp;u4opeoif3iatlaDrluvs u0artrio tytoa elnvs;s) 2xrimpno4ope  icias a2ta(r nu1tpe  octasls2eauvp (4 lermo3oa1fmD ai i;s)seuo(rpoodllenmnvsat)a2rrx p;u0apt mf3tysfm rm(ms;u0 eenxo oa1oa  an o t trtr(mpnudapeelfctatf Dumumpno0oexoifcias a2ua(vs t0tetoir3tadoat aivo t  2toxr oy4lleemieiat) Drm( o;o4apen ictadls eaums;(4texnxr3to1fa r nei () rum(rpiu1op e nvi t)srra(  oo4opto ocilslaDuluvo u)artriocoadlptrlu o;t)seur(r3nu1lp  lieils sDurum ;u0oee mfeiltlmDrmu p t0arerir3tytoa r uesl(0s2urxopny4alte fctatf Drmxmpoo4tlt mfctadlaDea( p t0 eeoircio1fpt ai ils)s2tmxr iu1lme lfcs t)srrm(rpot0alx ioeiatlm2um(vpnu4trenio3tydfateli i (0teurirpou1lme mncsl()arra( oot4oltnmictlsfaDuaums (4 ltnmr iotfmtrau o;s trurio3iudol n fvs ( srrr(rono4tle mfciltfs2ulumsnt)aeerxr iy1laDrli i;s0 2to(o3io4llt  fvs () 2taump;t4optnmo3tltfm2ul(vs (0 lenmo3iytopDr ivils srurim3iu1altnlnvslsfsDtr(mp;o1ape  iciaslmDum(mon(4 lxnxocoy1fa rauvs;s texrxm3iydapt  nesat)aDtr( oot0tetn o3iytfm2rlumonu4trxrio oo1laDe u s (0 exrxmpiu4lme  netl(f 2tm(ro;o4texomfciyt mDel(vont0teeoxrctytlpteli o;t)sexrimpoy1omee fcs (farrrum ot1aet ioeildls uauvs u4trenioctatom elivi;t) eto(r iy1amtnmiei sf rurxm nt0oee iiciydlmDulu ont)texrir tatlmte ivs (0s2ur(m oudoltn icil()aDumx pou4tlxomfeiydfsDel( s (4tlxrmrciodopD ln s t) ruoxm3io1lpt  ivi tf rtrxrp;t1olxnmo3iltfaDuaumo t) reoir iy1om elivolt0trumim3oodome mfvia( s2tau pou1oeto fciltlsDrln o;t0trtnxf iodoaDr uvil(0 euoxmpou1ome  feias)s2ur( p;u1opxoif3iydlmDranmp (0tlenxfcto1opD  uvi s  2tmirpoodlm elivilt) Drmx ono0tle iieiad mDul( on(0tltnxfctotla e uvs;t t2xoim iydopee ncslt)srtru onu1tpenifeiydfa elnvp (4aetnxo ty1op eaies;s)teumim oy4aptn fvt (fs2rmx ono0aee mi3iyt m rmnvp t4 leoifcty1op  auvi (0s2toxm nydomtemfvia(fsDrmxmoou0aex  fciltla emuvpn(0 lxnioctotfm raneils)s2xrir3io4amte ies sfarrmxmo;u0oee micild a2rau pn(0 lxoir tatlm  liei t0 rtr(mpiodom n fvsls)a2rrum ;u0oetnif3iad m2um(vsn(4 rtrio3oatfmD luei;(0 ruoio oodop nlfvia(f rtrxmp;u1altnmictlslm el( ont)alxrmo3iadoat  ivo ()tetrio iydlptelnei ()arua(mono4aet  ociyd mDrl(mo ()areoir tatla  li o;s0setmiopoy4om elict t) rum(r nu0tleomf3iysfa uanmonu4 rtrio3tydfa rai ils0srurxm3oodopen nciasfaDurxro;t4altoiictydlm elnmsnu)tleomr3totla eauvo;(0setoio iy1am e fvs s)aDtrum nu1tlt  ictas s2ra( snt4aleoifcty1oa r ieo t)t2urxrpiy4llt  fcsl( s2um(m oo1olx  oeiad sDrlu p ()teermo3ta1fp e i s;( seum(o3iu4alteliet sf Dur(m ;u4alt  f3tadfs2eln o ()treoxrcoytlmtelueol()srtm(o nudome mfciat arurxr ;u1texoioetlsls2ulnmsn(0 lxrxocia1fmDrlnvi s0 rtmxrpoudlmenmfetlt)sDtaur ;o0tee  ieiydfs emnvo;(0teenif3iy1lmDe u s;t0setrirpiydoltelivtltfsrururpou4olxnifctyd s2elnvs;()texnif oo1opt lueils0 rur(rpiy4am  mfeta(farrrx  ;t1oeenmi3tadls2ua(mo (0trenmo tatom  anvo;t trxr(rpnydlp   ivsl(fs2taumo;o0alxn i3tatfs2eanvo;t0 ltnmf oatfm rlnei;t) etr(m oydlm n iesl( sDurxmoot0aetniiciysfs uanmo;t0 etnxrcio1oatr neil(0srurim oy1ap   ncilt  Dta(m nt0apeomociasls em( ont0tetoif3oy1oateaueo t trtoxrpiu1amenlfesls)srrau pnu0oexniiciasls elnmsnu0 ltrio io1fatrauvi s s2uoir3oy1ale lfet t)srtmx  oo0tlxo icildlaDuanms;(4 lxnif iatom  an s;( texmio oodom  lfcilt a2rauro;t4aet  i3iydlmDrm( snu4aeeomr ta1la r ueols s2urxo oy1ame mietls)srtmxront1tltnmfciyslsDrluvo t0 eermf oytlptraivilt)srtoxm iodom emncs t) Drrxmo;o4oetoifciyt sDuauvo;()arerir oy1fm e ieils s2um(opiudalt lieia()artaxrpoo4aex moctld m elumo;u)alxrmf3iodfp r iesl()s2uoio iu4lme  feslt)arrmumpnu4tlt  i3ils s eau s (0tlenxo totfpDe i il() rtoim3iu4ap  lfvsatfsrtr(rooo4olenioetadfm2um(vp t0artoxoctadlmt  u sls)sexoir3iu4apte nvsas srrm(rpoo0aptnii3iydls2ean s u0 rxnxf oy1fat  ues s texmxm oo4lmee fvs t)aDur(rpot1tlxo f3tysfmDran p u0tlxoircootopte u o;t)trur(mpnodlpeelivta() Drr( oou1apxoifcilslmDumums;(0arxnif3iydlate uvo t0 etmxrpnodlm nmnvsls) rtmx  ot1oet ii3iatlmDrm( snt0 etnirciydom  luvi () rxo(o oydlmt lnetas  2taurooo1tpxoif3iad a uau o;u)aeeoir3ia1fatranvils) eur(o3oudamee fvtls)aDuru o;u1oeeniictyt sDra( snt) leomfcty1op e i o ( teurir3oy1op  mfct s  ruaxmo;t1apxn feiys a ranvp (0 lxoirciydlm  lieo ()setm(r nudlpe  fcsas)a2raxmpou0aptoio3ildls2ra( s;t4texrxf ia1fpDeluvslt texrxo ny1om emnct sfs2rrx pnt0oltnmociysfa uan ont0 rxomfcty1fp e n slt) rtrxr3iy1lmenmfciasfaDtau pou1opt  i3iadlsDranvsnt4 exoxr3iydlp e iei;s s2uo(m3no1om nmnviltf ruru o;u0aleomoetldlaDuanmo (0aetnir3to1fmDe neo;( texr(m nu1lpt  fvs s a2rrump;t1aeto o3ild sDem(von(4aetnmf3oatoatr i sl(0t2xrxopoo4amenmfctl( aDtaumpot1opxn fctadlm2ulumpnt0 etrif3todomD an s;t)t2xmxo3io1apt mivt s)sDtrxm oo0oetnmi3iyt m2rmnms;t) lxoif oodfatrau i;t0 2xmxr3ny1am nlnci ()aDuru  ou1aeeoioeiltfa2rmu s;t0aeerif oadop eli slt s2tmxm io4altn iei sfarrrum ;u4aee  ieildfsDumums;() rtrmocoo1lp eau o;( s2tr(m oy1lmte ivil(fsDta(ronu4tlt  ictys sDem( p u4 lxnirciadlaDe nvi s0 rurimpou4am elfvilsfa2urumo;u0tlt ii3iydlm2rlnvp (4 eeoircoodopt  u s;s0t2xrxo3nodole  fcta(fs2rr( onu4aeeoifetad aDul( p u0 exnmr tytfp raivs (  rtmxr3nodlle mfct sf 2tru o;t4tleo fctyt sDrm(vo;u0 ltrxf ty1omteaueils0tetmir3oo1lpt  nvt (  2tr(mo;o0teto oetlsfs ua(vs ()aetrmo oa1fmt  uvo t s2xoxm3oydlltelics s)s2umur oo0aeeniociys a2elnvsnu0artrxo tatomDrli i t)trurxo iu1omeemfviat)sDtrump;u1apx ioeiadlmDrlnmsn(4arxoir ia1laD aies;s)tetmim oy1ol  lnctat  2tr(  ot1alto i3ilsla rmnvont)tltriociadopt anvo;t)s2xoimpio1lmeemfcsa( s2trum ;t0tltn o3ilsla2eluvo t4 rxnmfciydlmt  nes s0srxr(r nu1lm nlicsa( a2ta(mono0tpxnmfciyt s2emu p;t0aetrmo iy1op  aivs t)t2ur(r3ny1amee fct s arrmumo;t0teeoiiciytla2rlnmsn() rermf3oatlaDrlieil() 2xo(o3ny4ol n fesas) 2ra( onu1aee ii3iys mDrauvo (0alxnmf oa1lmt li i t0 2toxo3oodom elneil( a2rmxmpnu4oeeoifeiatfa el(vs;()tltnxfcoodoateli s t0s2toim3iu1lmtelncia(fs2uaumoot1aet moeilsfm emums u)trtrio3tydlaD luvo;t  eumir iu1aptnmfcsat)a2taur ot4teto fctldla2rm( pnu4tlerir iydfp  luvsl(0t2xoimpiodalen ictls)arrau  ot0oltoiiciadlm2eau o;(4 rxomrcoadfmtelnes s texm(r ny1lmeelivslt) rtaxrpnt4oleniietat mDemuvont)trxnmo3ia1omDeauvi;t0s2urio nodll nmivtls)sDrrxmp;u4alxoifetadfa2rlu o (0alxnxf3oadomtr n o (0sexo(r oo1ameemnvi t arrau  ;o1aleomfeiys a2rl(mp;u)aetnifciydop   i olt)srtm(o3oydamenlncia(f ruaumont4aex mi3iasfm2eau p;(4teenxr3iodlmt aneslt truoim3io1lpe mfeiasf Dtmxrpot0olxoiociad a rm( o (0trxoif tatop elivi;(0 rtrxrpio1optn ncsl(farurumo;u0tltomfeiyt a2eluvsn()aeeoxr3tytoaDelivi;t  rtm(m iy4lmen ivt ( s2raxr ot0opto fctatlmDrmnmp;u4altnmr to1omDeanes;t0 2xmxm3oy4lp elfci (  Drau pno0opxniociasfs em(ms;u)altnifctotlaDelnei s0 2trim3nodal  lfct (f Duaxm nu4aleomo3iasfm2uln pnt) reoif ty1la e uvslt srxmim iu1llte nviat) 2trxmp;u4opeomf3tat a eau o u0 lxnio3iadlm rlneil(0srxr(o3ou4omtnmicsas a2umu pot0apxomictyd sDemnmpnt)trxnio oy1lat  nvi ()trxoio3ny1opeemiesl()aDtrxr ;t0opxo ictatlsDuauvp (0trenmo3oy1la elueolt0trurio3nydlpe mnvta(fs2urxmonu4aleo i3tasfs2uan o u4altnmf3oodlaDranvo;s srxmxr3iu1alt liciasfsrtax ont4opto i3iytfa el(vs;u)alxomocoa1lmD  uvils0tetmxrpiu4lp elfcsls)a2rmxmpou0tpe mfciaslmDem( s;()teerio iytoaDrauvo;s t2umxm iu4lpenmics s) Durum ;t0tlx  f3iltlmDemnmsnt0 ltnmoctytfaD  i s;() eumxr3iodll n neil() rta(rooo1opeomi3iadfm ul( p u4 rerxfcoydlpDe nvo ( sexmim iudomen ivilt  Dur(m ou1tpx mictytls2eau sn(4 etnif tatlateanvi;(0 2xoxopny1optn fvils srra(ro;u1altn fetls s rmuvsnu) lxnmo3ty1om eanvils  rumxo3nudamtelncsas)s2tax ono1tpeo ieils a rm(monu0aexnxrcoytopDraneils0 eurio ny4olen ics ( arua(r ;t4olxo feiltfaDra( o;t4texnircoadfate ivsl() etoir3oydomtn fvi tf 2trx  ;o0opxnmfctatfm2el( o;t0arenir oa1opt  uvo s t2umim3oo1aptelfes sfsDrr(rp;t0opeo f3iysfm2ulnvs;(0aetnmf3ootoaDrlneils)trxm(o ny1lp n ictat aDrmuroou1oleniieiyd s rmumpnt0tleniociy1fp rliei (0 exmim ou4op  lfvsa( sDtr(mpnt0tlt  f3ilt s eluvonu4trtrxo iadfmDeauei t)t2xrxo3ou1lmt  nvt s)s2urump;t4tpt ioeiysls uaumo t) exoif ta1fp e i ilt) ruo(rpoudal  lnesls  Drrxr oo4tltnifeilt a rl(monu4altoif oadlmte iei ()truo(opny1omtnlfcils arrrumpou0apx mociyt s uanmsn(4arxnmoctodopD lu olt0setmim io4optelnvt s aDur( poo0tex ii3iyd mDeln o;(4trtrio oa1om rlueo (0s2xoxmpny1aptelnetl(farurxmp;o0aeen oetat m el(mp t)altrir3totlpteaues t srtm(r3iodap n fesl( s2tr(rpno0alenmoeiat sDran onu0alxrio iodoa  aneils)t2tr(m3oydlltnlfvsas)a2um(mpoo1tpxniocilt mDel( o u0tleomr3oy1om  lu i s0 2xrio nu4lpen ncslsf 2ra( oou4olxoiiciys mDumumo;u0trxrif io1omDr ivi (  eur(mpiu1amenmfciat  2rmx p;t1aexomfeiaslsDumu p;t4 renxf ty1optean ils)t2umirpno1lmenlfet t)s2ururo;t4tpxnmfeiatlmDuan s;u4 ltriocto1lpD an s ( truo(m3oodlpt  ivslt a2tm( o;o0aeenmiciltlsDrauvo u0arermoctodfaD ai sl( trumxm3no1ame  fcs (fs2uaxm no0optnii3tldfmDuln snu)areoir3oadlpD  uvils0t2toxm3iodlle  nei t  rraxmp;o1aexo o3ilt sDrm(mon() lxoxfcoatom e neo ( teuoxopou1ol nlfvi s)sDrrxmpou1tet mi3iat s eauvp;t4 rtnir3todfa  anvo t0 etr(o3ny1openlfvs t  Duax ont4alxniiciytfm2rl(vpnu0 etrmf3tydfp elu s (0t2xrimpno1lm nmivtlsfs2ua( p;u4opeomoeiytfmDeaumpnt4texoxr tydlpDeluei;s tetrir ou4optnmfvil( a2rm(m nt0openmo3ilt a2rmnmo u)alxomf iadoatr ivs;t0s2tr(mpoo4lle lies (fsrtm(mp;o0teen ictlslm2rauvs u0aeenifcoatoa rlues s0texr(o3oo1opte feta()srrau pno0aptn i3tydfs2uln p;t0 rxrxf3ty1omteluvi;t0teum(r ny4am elicias sDtrx onu0oeeoiicias m2uln snu)alenirciatomD  ieo (  rto(o3iu4lpte feslt) 2tau  ou0tet mieiltfs2umump t0altrir tadlm   ivo;t0 rtrxmpoy4apte ies tfarra(rp;o4tex iictad s rmu pn(4 ltnmo3oa1lp  aueols0trxrirpoy1ol  lfvsl(farrrxr ou1ale ifctyslaDrmnmo ()trenxf iatfmD luvo s teto(o iydlme  ies ()arrmum ;o0tlxnii3ild m emn onu4tltomf3oydfat ai o;t0srurxm ou4lmtemfvtatf 2raxro;t1oet mf3ils m ranvs () rxnir3ta1lm r ivils s2umxo3ou1llt mietas)a2rrur nu4oltoii3iytlsDrm( p u0trtomr iotfpDelu o;t)s2xoim3nudope  fvsas arumu pot1tle io3iys sDean p;t4aleoxf iotlmt ln ilt seuoir3oydome mnvt tf 2tax oot1opxomfeilsls elump;t4arxrif3tadlpD lu ils)t2tr(m3nydlmt  ies t a2rm(mo;t1open o3tltfaDulnmp t4 lermfctotomtelu slt)seuoxopiu1ll  lnvi (  2ua( poo1oexniiciltfaDeanmonu4 ltrmrcta1fat  u s;s  ruoir io1omen fcils)srrauroou0tpe  oeildfs uauvont)texoio3oo1lmt  ivsls) rtm(m nudlmt  fct (  2rru o;o4tlto ictaslsDean s;u) eeomo3totla e neo (0truoimpiy1ope liet ( s2tauroot4aexnmocildfs rauvont4 lxrmr3totfpt lu sl( t2to(r3ou4ole  iviat aruaxm ou1aeen o3iatfs2ulu snu0tlxnxr oatlaD aivo;t) rto(r3oo1lle  nvta(f Dtmxmp;o4teeoifciyslm2uan pnt4 rtoif oydop eln sl( trtr(o3nodlm nlnetl()a2rrx pou4optnmieiatfm elnvp t) ltoircoa1op r nei () 2xmxrpou1om nmfcsl( a2urx  ot0tlto fciltfa raump t0tltrmrcoo1lmDe neslt setoimpny4lp elfctls)sDtr( p;t0aexo f3iad a2umump (0tltoir tatfaDrai i;( trxoimpoy1aptelnctas)sDtaxmpoo0oeeo octys s2rmnmont4tlenmrcio1fm eaiei;t trum(m3iu4om   nvsat  Dumum ;u0tetomf3ils sDul( o () lxrio oo1latranes s)setoio oo4ole lnct (fs2rmx  no1alx  i3iyslmDraumont0aetoio tytoptrlueslt)sexrir3nu1apt mieias s2tax  nt0apxnii3iasfa2em(msnt4teeoxrcoatop eaies;t)t2tmxm3oo4ol   ics sf 2ur(ro;u0olxomfetldfs emnvpnt) rermo3tatlmDrlueil()teumimpiy4ameelfvsa( arua(r ;u1ope  ieildfsDua(ms (4 lxrxo io1fmt luvi t sruoir iu1ape  fvsltfsDtau  oo0oltn fcilsla2eluvo t)arenir3oa1la r uvilt)seto(opiydome  nvil()sruaur ;u4apto fctytfm ra( s;u)alxnmf iy1fm rluei;t)trumio iy4optelfct s aDtrum oo0tltoii3iytfmDemuvs u0tlerir3iytfpD  uvols)setoio3nydoptnmiei t  rrrx oot0optnio3taslm ulnvont)alxrio oadlmtelnei t)sruo(o oudlmtn icsl()artrxro;o4alx  oetadfm uau o t0 rtnmrcio1fmD liei;s trtmxrpny4alenmnctasfa2raxr oo1tetniietas s ranmsnt4tlxnxr ia1optr nvols0setr(r3iydop emieiatfaDuax p;t1oleo o3iltfa2uau on(4trenmocoadoat liesl(0setrxm3ou4llen ivtlt srtmu oot1tpe mfetyd aDra(mo (4aexnif3iy1fm r i ol(0 2xmir3nu1om emnviat)sDumxm no0oex iietyd s raumsnt)trxoxr3oatoateaieol( s2xm(o io1lp e feilt a2umxrpou1alx mi3iysls emums u0 ltomfcoydfmDe n s;() rxoio oo4ole  fctas)s2rrx pnt4tpeo oetyslmDeaumo u)trtomo to1fmD lueo;t)s2xmir3ou4lltemnet tfsDumurpno0oexomo3iyt mDumn o;(4tleomf ta1fp rlueo s trtoirpoudome  fvt tfsrtaurpnt0tlt  ociltls2elumo;t4tetrif tadlmtr ueo ( t2xoir iudap  mivs t srrmxront1tee mfeildla uluvo;u0 lxnmo iodfp rlieils)sexmxmpiydape  fei s) rtm(m ;o4alen ieildfa ea(vp u4 renirctodlpD au olt0s2xrxm no4lpen fcs t  rrmxrpnt4aleoio3iltfs2eanvs;t0tltrxociotom  au ols0trumim3oy1olenlnvtlt)a2tmx o;u0apeomi3iad a um(vp;()aleoirciadfa rln s;(0sexrxo nodolt  fvi ( aDra( p;u4aleo f3tadfs ua(vp () lxrioctatom rlieol( t2uoxr oy1olt micsas) rraurono4olx mfciasfaDra( o;t0alxnxf oy1opte uei;s tetoio3ou4omee nviasf rtmurono1aexnioeiys a emuvsn()trxrifciatlmDr ueo s)trxm(r ny4altemnesatfarra(r ;o0opeo f3iasla2rau s;u0 ltoxf3iytom rlneilt0seuo(o3oo1ome  ivs s  Dtmxmpou1aet  fctydlm2rmu o;()aleoxr3oydla elieo t)trurir iydaltn iviatfaDtau pnu0tee  f3tld s ea(mp t) eeoiociy1lm   nvi;t)s2urxmpno1olenlnci s  rrmumpnu1tle ifciytfa2ua( pnu4texnmocio1fpDeau s;() 2xmxmpnodoltnmncs ( sDrr( pnt4altnmieilt a rmnvp u4alxrif ootoa r nvols0 eto(opio4apt  fvs t)srraxro;o0tpxo oeildls elu p u4texnmo iy1omteanvi (0texrimpny4om e fcilsf Duaxm no0oltn ieiyslsDemnmp;(4arxnifcty1fpte nei;s0 rur(o3oydole  nes t sDtmxrpnu0oee mfctas m um(vsnt0tltrir iy1fptrlueo;(  exrim3iudlltn netl(f 2urx oot0aetomo3tasls rmu snt4teeoir3io1fa   n il(0srur(opio1amte ivs s  rrr( p;o0texo ociltls em(vp;t0aexoir3oa1lpte neo t s2xmim oy4lp  mfetlsf rrmur ;t0oltoiieias mDum(mp;(0altrxfcoo1lmDranei;s0sruo(o no1altnmncils)arraum nu0olx  f3iltlaDuau s;(4 exnmr io1faDe uvol() 2tmxm ou1olte fcsls arrru  ;o4ope ifctytlaDelnms;t4 rtnmrcoytoa rauei;s s2toxr3iu1op nlnvils aDra(  oo4tlxomo3iatfs emuvs t0 exoio ia1fm  an sls  rxm(mpno4op elfcsl(f 2uau ooo1ole if3iat m uan o t0artrmo io1lmt lies;s0setmirpiy4alt micsltf ruax pou1tpt  ietydfm rmnms (0altrmo3oadlm r u il( tetrxm3oy1amt mivtl()a2trxro;t1teto f3iydfa2uan sn() lxoxo iotlmDe uvi ()tetmimpoo1apeelfvt t)aDtmumpot4ale io3iytfmDrm(vp;u4alxnxf3tadop e ueols)s2xr(r iu1ol  micsa( a2ururo;u0teenmocils a2rln p;t0artnmo oydlp r nvi t)trxoirpoo1aptnlfvia()aDtrxr nu1tlx mo3tyt sDeauvp;u0texoxo oodomtr nvo s0truoim oydll e nesat srumum ;o4ole iiciysfs uluvp t0 rxrirciadlat lnvs (  2to(m3nu4oleelfviat) Dtaxmooo4texomictytfm2ra( s t0teenxo to1faDe ieo;s) 2xmir3no4open ieilt)srumu  ot4opxn i3tysfm2uauvo;u4trxrxf3ootomDe ivi s)t2xrim3nydom elieilsfaDta(rpnu0opxnmf3ils a emnvpn()tlenif ootfm elnvo ( s2xrxmpnudaptelictat)srra(m ;t0oeeoiociltfs rm(mon(0 rxoxrctydlp elieilt truo(rpny4omeemicslt  2raxrpou4oltnmf3iasls2eauvo;t0altnif iytop eliei t)srxr(r oydome lfcta()a2uaum ;t1olen oetadlm2ulu p;u4aetnmfcoo1op   nvol(0 2xm(r3ou1lltelfeslt  2ua(mp;o1alenmi3tldlaDum(ms;t0 leomr3tadfptr uvolt0t2umim oudlptn nct s aDumx o;o4teen oetltfm2eauvs;t4aetnxoctytlaDeaueslt seum(o nydlltelncsatfa2truro;o0olxnif3tat m2ra( pnu)tetnmf3oydlp  lieo t  2xr(rpno4op e iet () rtaxrp;o0apt mi3ild aDum(ms;()texnio iytoaD livo s) 2xr(mpio4lp n nci s aDtrxmoot1tleoioetatfm rluvs;(4tlenxr3ta1fa rln o;()texrir iudaptnlfvil(f 2tmx  nu4opxnmf3ild s2ul(vp;(0aexrmo3ia1op e u il( seum(o nodopenlfesat aDraxr nt1opxniiciydlm eanmont0alxoxr tytopteln s;( teurxr nu4ll   nesa(faDrrur nt4opxnmieiad sDraumsn(0 rtnxr tytlpDr n i;s)s2tm(opou4lm nmfcsasfs2rmur ot1olxo fciyt s2ulnvs;u4 leomo tatfa   nvo;(0 rxmxopou4apt lieta( s2ua( onu4tpxomf3iydlaDrau o;t4 ltnxf oydfate ues;()trto(mpio4ope  ncs sf rurur no1aptnmieiasfm2rm( on()aeerif iy1lp eanvils t2umxmpnu4ll n nvtas a2tr(r nt1aet mf3ilslaDea( o;u4tlerxf to1fm r ues;t)texoxo nydlm e nvils  rtaxr ;u1apenmi3tys a2el( o (4aeerirctadlm  ai i (0 eumio nu4ll   netasfaDurum ;o4apxoiociyt s elumsnt0 rxnmr io1om raneils) 2xr(o ny4ome lfct ()aDuru  ot4apeo o3ils s2elnvon(0alerxr tatlp e uvs;( srtrxopnu4optnlfei (  Dtr(mpoo1apxnmfeiyd mDrmnvp;t0 eerxo totoa elivi;s0t2xrxm3ou1lmeemfctat s2ta(mpno0olenmf3iad aDelnvp ()arenxf oy1lm elneo s)teuo(r oydlpte nctls aDra(moot4opxnio3iad s2um(vont) lxriocoy1fpD lueo t) 2xm(o3nu1lm nlivi s) 2urx pnt4olxn ictld a2ul(monu)aeeoif totlat  u o s t2xo(r iodal e ietltfs2tmxmoou0alenmoeiysfmDelnvo;u0 lxoif oydopt luvo;( t2tmio3nu1ap emicta() 2rmxmp;t1tpxniictysfa2emn o (4 etnxociotop  ln ols0 2xrimpio1al elivsls  rrrxmont1optomietyt m2ulumsnt0aleoxf3oodoaDeaiei;s srurxmpoo4lme lfcslsf Drauro;o4tpeo ieiat s2umuvsnt0 exnxr oadopD ln ilt0 ruo(m oy4opt lfeiat)arraump;t4tlxomo3iadlm rmnvs u4 ltoxfctatomD li i;t  rxrio io1am  mfctls sDtau  nu0texniiciasfa rl(vs;u)altrxf3oytfm r i i s  eum(o3no4omte ncs ()a2umur nt0tpxniictatfmDrm(vo;t4 lermr3iadfpDrln il()s2xo(o3ny1om   netlt  Duauroot4oltomoeiad m elnmsnt4tetniociy1fm eluvs s)srto(rpiu1lptemies t)arrrurpno0tlxomf3tldls2ul(vp;u0 lxrxf3to1fateli il()srur(rpiu1ap  lnvsas)a2tmx pnt0oltnio3iadlm umnvp t) lermo oydlptr ivol()t2xmxr3io1lpeelfei sfarta(r ;o0oleoiieiad aDum(ms u) exnir3iy1oa e nvolt  eurio3no4lmte fvi t) Drr(r ou4apeoioetys s umuvo;(4aexoxfcoy1fp rauei;(0 etr(mpnu1oltnmnct (fa2ua( pno0oetoio3iysfs ranmo u) lxoir3totoa rlneilt)srum(rpio1am elivi s) rumum oo1openmocildla2raump t4 eenifcoa1op elnes;t srurir3nu4oleelnci tfarurumpot4opx mi3tlsfaDumnvo (0areomf3iy1laD luvo t tetr(r3oy4lltelneiatfartmu ono0tpenioeild s em( on() ltrmr iadlmt anvs (0tetrir3io1lpe lnesas) Drr( onu0opto ieilsla elnmp t0tlxrmrctotoatrlnvi;t) 2xoimpio1lpt mfviat)sDumxmpoo0apxnii3iadfaDran onu) rxnmrctydopDean il( trtmio3iydop nlnvs ()srumu o;t0oexomo3iysfm emn on()alxnircoo1fpDeai o s0 2umxopoudalen fvt (  2rmumo;o4tle mo3iad s el( s;(0 etnxrctytopte n o s0sruoxrpou1amtelnvtat)a2umuront1oexnif3iad m2ua(vs;(4 lxoio oydlpDeli i;t0 rumxm3io1alenlncsa() rra(m oo1texoiociasfm rmums;u)artrxocoo1lptr ies t0 rxrio oy1altelicsa(fsDrm(mp;t1optniieiytfaDrl(vsn()tlxniociotfaD aies;s)t2tmio3ny1olte ivi sfsDumum ot4tle mf3iltfm2ul(mon()tetnmo oadlpDrlueo t)s2to(o3nudll elnvta(  Drmum ;u4aex mictlt m ra( snu)teeomo3ia1la elivs;(  2xmiopoy1ll e fet t)aruaxrpoo1oexomociatla2eln s;u0trermf iytfpDraueolt0setrxm3iy4am   fetl( a2raxro;o0oeeoiociltfmDra(vp u)aeenirciatfp   nvs (0t2urxo3ou4lpen nesa(f Dum(  no4aet ifciydfa rluvo;u)trtomrcoy1fmD aieo t t2ur(o3iy1omenmfcil() Dtm(mo;t4tpxoiieils m ua(vo (0aexnioctydfp eau sls0 etm(m3oodal nmfvsltfs2umuro;u0oex  ictys m2em(vo t4trtrxr3io1fmt  ivo;(0 exoxr no4llte nvsa(  rtrx  ou1tpen i3tys m rmuvonu0artrxo iy1fmt lnei () rxmimpiy1om n ncs t)a2tau oou4aexoio3iad mDrau p;()tlerif3ty1lpD  nvslt trxm(r ou4lmeemnct (faDur(moot4olen o3iytlaDrlnvs u4treoio3oo1faDeauvil( sexo(mpno1lp n nvi t aDrmxrp;t1tle io3tydfs ul(vo u4 eermo3oytomDean olt0srxrxr3iu1amt mnvtls)arrmump;t0apx ii3tysfa ea(mp;t0aeeoxf3oatfaDrau s s  euoxrpiodomee fetas)aDumurooo0apxoifetys a rau p u4 lenmf oadfptran i;t srxmiopoo4lpe mnvsltf Dtr( pou1aet iicilt s2rmumsnu) rtoifcoatfmD  u o (  rtoxm oy4olte ici sfaDtaxmooo1tet io3iytfa2rl( o;() rtrif3tytopDraiesls trurxopiu4alte ieia()a2ua(rpnt0ale iieiydfs2um(vp u)arxrxr io1fp e i s s srxr(o3io1ll  miviltfsDuru pno4oeeoiociaslm eau p;(0teerxociytfpteluvi;s0setoir3oudol e fvsa()arua(m ;t4tleo oetasla ul(vont0trerifcootlpDeauvol( seuoir3io4lltnmfctas)sDrm(root1ale  i3tysfsDulu p ()texnmfciatfa e iei s0trtmxopiydal  mfesl(fs2ua(rpnt1tltnmi3tltfm2uluvo u) lxrmrcoodomD lies t)s2xoxmpou4olt mfet t a2rmxm oo1tpt  fciltlsDeau s;u)tlenir3tadopDelues;t texo(mpoudamte fetltf rrm(  nt0oee  f3iys m umumo (4aexrmo3oodomtran il(0teto(o3iy4lmtn fct s) rurumpot1oeto fciyd a eanmont0altoxr3oy1lpD  n o ( srxm(r3oudlptelict s)a2tax  ot1olenio3tlt m rauvpnt0tltoxr iodla eaues;s trurio3oudomenlnvsas  2ta(mpou0oltnioetatfs ua(monu0 lenif oydoatrlneol(0srxoxm3nu1olt  nvtatfa2ta(r oo1oetnif3tyd mDea(vpn()tetoio iydfa rai sls0 rum(mpnydaleemfvs s sDur(ro;t4alxnmf3tysfsDrmumont4alerxfcto1fm r uvs s)tetoiopiu1omtnmfci s s2tm(ront1aeen octysls rauvont4alxrmf3ia1fpte n il(0texmxr no1amee icslsf Dtaumpot1oeeo o3tytfaDumums;()aexrif3iy1lmtrlnes t0 2urxo io4llenmfetasf Durx  ;u1opxniocildfm umumo;(0 rermo3totfate ivslt)tetr(r ny4aptnlicils aDtaurooo0tpe  ieilsfm2ulnmonu4aexrif3iydlmDrau s;(0 2umxo iy4apt lfvi s)artm( o;t0aeen i3ils m2rmu s u0 renxf3oodoa e ivo;s0 2xo(m io4lp  mneta(faDum(ro;o4aeeomiciat m2emn p ()trtnmr tytfmtr uvs s  2toxm iu4llee icsasf rraumpno0tex  ieiydlm2rlnvonu) exnmo totfa   nvi;s)tetrxrpoy1lmenlics t)aDumxrpnt0ole micild s rm(vsnu4 lxomr3ia1opDe nvsl( s2tr(rpoo1am nmnvt tfarurur oo1altnmfetysfm emumonu0 reomr iodomD  n i;()trxm(rpiu1op e fciltfartaurpou0olt  i3iyslsDea(vpnt)aetomfctotfp  lnes t)trur(opno1openmfeia(f rtmxmo;u1teeoiietat m2umnvonu4texoif3iytfa elues t)srtrxo iydomt lieils)artaxmpoo0optoioetltlsDul( snu0tetrif3iatfat  nvo;t0trtm(mpnudlpenliei (faDtmxr ou1altnmietysfmDrlu snu) lxrmo ty1oateanvi;s truo(m iu4altemfvias) Dtrurpoo4tpen octasla2em( o t4alxnmo to1fp  lnvi;t s2to(m nu1lmt mnvi tfaDurxmp;o0texoiocilsfm emu s;u0texoxr3oydlmDeluvo;t0tetoxo oo4lmtn fciatf Drau ont1ole  ociat s uaumo t4texniocoadfmDraneol( t2uoio iydameemietls aDrrx ont1olx mfetasla ra( p;u0alxnmfcoa1oa rlivil()trurxo3nu4omeelivt sfsrrax  ou1teeomoetadls2eluvs t0alenir oodfptr uesls0 2umio3iu1ole  ncslt  rumxroou4aexn iciltfs2eau p u)arenmr3ta1fm eai ols)srtmir oy4aleemfct s srraum oo0tleomf3tldfaDranms;(0trxrmr ty1fpDran sls0 2tmiopoo1amt miet (fa2ua(monu0tltniiciyt s ra(vs;t4tltrmf3iadlmDraieo;s srxo(rpou1om elnvi s)aDrmx ono0opeoiicildfa2umu s;t0 rtriocoadfpD lu s;t0s2uoio iodom  mnet t)srtmxrono4tpto oeilt sDelu p t0trermr oy1lateau o ()srxoxo3ou1apt  ncs t)aDraurp;t4tpt ifetyt sDranvs u0altrxf ia1lmt auvo t) rxrir3oudap e fvsat  Dur(mo;o4alxo o3iytlmDum( on(0 leomo3ta1oa elues s0t2xo(o iydllenlnesl( a2rmu oot4oexoiieiys m eaumsnu4tltniocio1oa eanvs;(0trxr(opno1lmt  feslt) Dtrur ;t1olxn i3tys mDum( p u)texomr3iydfmte uei ()s2uo(m3oudap nmfesls)arrr(m ot0oexnmf3tyslaDum(vo;u4tltnmo3oadfm  lnvolt0trtr(rpiodlp  liet (  Dumurpno0oltoioctlsls el(vs;u0texrxf3ia1fm eanei;s  2trio oudoptelfvils aDtmx  ;u1aexnmo3iltlaDeaumo;()texnxr3oydlaD  uvils)t2urir3oy4lmenlfci t)s2tr(  no4oee iocilt s2elnms (0alxnmrcoadla  lnvo;s)sruoiopoy4lptnmfcsl( artrx o;t1ope  octasla2uauvp t)tltoxr iadlaDeau s;s srtr(rpnudlpeelietlt aDtr(m ;u1apxomi3iyslaDem( pnt4 rtnmfctodfmteau s t)trtr(o oy4al e ivt ()sDtaum no0optoio3ild sDum( sn(0aeeomf3oadlpte nvs s0t2urxmpny4llenlictlt  rurxmo;t0alto feildls emn s;() ltrircoadfaDeluei;(  euoim ou4ap  mivsl(f Drrum oo4ale io3tat a2emu o u4tlerxf3io1fmD aueilt  eumxo no1ll elivt ()sDra(rpot0teeoifeils a uanvon() etnxo iydoa rli o;t0seurimpnodaltn net t) rrax ont4tetoiictydls rm(vs t0 ltnxf ootoat au ils)t2xmxopiu4omt  nesasfaDua(mpot4tlx  ietas m2em(vs t0 eeoioctytlmtrai s;t0 2uo(opou1op nlfetat srrr(mooo1alx ifcildfm2emuvo;t4trtrxrcoytoaDelivs;s  exr(rpoudlpt lfeil(  Dtax poo1optnifeiatlmDem(mp t0alxnir oodfpDraneilt0 2xrxo iy1omeelnvsl(fsrtmu  ot0oetnmo3ilt a2rlumo (4tltoiocto1faD  i i;s s2xrirpno4lpeemnvs (  2rrxmoou4teen f3tyd a ul( s;(4areoxfcty1fateanei ( tetrxmpiy1ame mivsls sDua(ront1texnmi3iasla ranms;t)tlenmr3oadlpDe n ol(0srxr(m ny1lptn ivtas) 2ur(r ou0tpto o3ild aDemnmo;u) lxrmrcoadoat lueo;(0 rxm(r ny1alenmicslt  2rmx ont1oexn fetas sDua( s t) etrioctodfmtr nvs;s s2tm(m3ny1ap nmicias) Duaum ot1apx mieiadlm2rmnmo () eenircto1op rlneo s) exoxr nydol   fci (f Dururont1oeeoifeiasfs2rm(vs ()trtoir3io1late u ilt texmirpoydlpenlnvta() rtr( o;t1aee ii3tlsls eaumon(4artoioctadoa e nvolt  2xr(opiydlptn nvs s)aDuaxrono1teeoif3tadfa2ulu o t)tltrif iadlpD luvi;(  2urxm3iy4amtelivtat sDtmxrpnt4tle  i3iatfm2um(mo () rxrxrcoa1fatrli s;t)trtmim3oy1ole  nvtl( aDumxr ;u4apxn f3tldfsDraump;(0 rxrxf3tytfpt luvo t) 2toxr nu1lmteliviat a2taxmono0opeo ieild m2em( snu4aexrir todlmtelneo;t) rtm(rpiydoltnmiesl(farumxro;o4texnmoeiydlsDrmnmo u4 reomocootfa  auvilt) rxmir io1lpe mnei sfarrm( p;o4aeeomoctadfs2um(vs;(0tlxrxrcootfaDrlnesls srxmxopio1lmtnlnes tf rraurp;u0apenmociat s2ean s (4artnxrcoy1lptrlieslt0 ruoxr3no1lmtnlicsltfs2uaxmp;t4apt mi3ild mDrmums;()artomrcoa1lmD lnes;t t2tm(o3no1ap n fcs t s2tmumpnt4ope  i3iadla2rmnvp;t4 rxnio tadomDrlnvi;(0seurxm oudaleelfcs t) rtmum ;o0tltnmfctydlaDraums;u0aeeomf3iytla r uei ( seur(rpio1ol  lfviat)sDuaxrpou4texn oeiatfm rmn p (4aexrir3todopD  nes;s0truoxm io1ap nlneilsfaDrrurpnt1tlt micias aDeanms t)tlxnio3oodoate ieolt sexoxo oy1apt lnetat)aDrmuro;o1optomf3tydlsDua(vp u0 lenirciodopDrauvs;t0srxmxmpiudolen nvsatf Drm(r ;u1oetnio3tas m rlnvo t0arerxrcto1lpDeaivilt0texoxm no4llee feil(  Dta(monu0optniietydla ea(vsn()arxoxr tadlp eluvo s) eum(r3oo4oltn fcs s)aDurxm ;o0tptnio3tls m em(msn(4aleoxrctodlateanei s0s2toxm3iydll nmict s) rra( onu1tpxn feils m2rl( o (4arenxr3tytop   ivs (0t2tm(r no4amtemneia() 2taurp;t4tpen fctlt m2el(mpn(0 rxoxrctytfmDeai olt  eumxo3ny1ap emnet (farua(ro;o0altnifcildlmDeanvsnt)arenxf to1lmDeanvi (0s2toxm oy4am   fvs ( a2rmumo;o1tlxnioeiydlmDuanvs u4 ltrxfciytfpDelivi;t0s2xoio nudole mictltf Dua( oot0aeenmf3iat sDrl( sn(4tlerioctatoa elu o s0t2xr(opoodllee feias)sDtmuronu1opxnif3iytla2uan s u) rxomr iy1la rliei s  eto(r oo1apenmnvias) rtr(r ;u0tlx iociltlm uanvs u0altoxf3io1fpDelu sl()trtmxr oudopt mici tf rta( pno4tetomi3iytla rl(vo;u0tltnmr iy1laD auesls)s2xoio3iu4ope mfcs tf rta(r nt1oex mi3iytfmDuau on(0artomocta1lmt livslt s2xrxo nu1ome  neia( srra(mo;u0optnioeiyd sDran onu)aleriocoy1lm rlieol( s2xoxo iu4am  lfvils s2tm( o;o0ole  fetasfa2ra(vs ()tltoirctodlp  livi;s0s2tmir nodal emicsl(faDur(root1oeen octldlsDuln pn(0 ltomocty1lptr ueo (  2tm(m io4al   ncilsf 2rrum oo1opxnif3tas sDrmn p u) lerircoadoa  lies;s  rxm(opoo4llenmnesltfs2rmxm no1apxnii3taslsDrl(mo (4 eenxr tydomDraues s0 2xrxrpou1amt licslsf Drax poo4ope mo3tatfs2umnmonu4trtnmrcia1lateaueo;(0tetoim no1al emfvtls) rumx pnu4aex  oeiasfmDua(ms;t0trxrio3totlaDraivi t0setr(o3oudole mivtat sDtr(r ;t4tleo o3tadfm2rl( on(0 lenxr oodfp raneilt) eum(o3iudole mfet t a2taxmp;t1oleomi3iat a2emn s;(0 renmoctadlat  ies;() euo(rpiy1amtnlnvs t)srrmu p;u4tpe mieiytla rmnmp;u4alxoxo oa1oaDe ieol(0 rurxo3nodll emfvi t a2ururoou0tpxo ietyslm rmu pn() etnxo iy1lmt li sl(0s2toimpnudapenlnct t)arrmxr ;o0aet ioetydfs2umnmo u0 lenxf3oodlm r ivolt0 2xo(mpoy4lmtnmfcsat)aDrrxrono4openiieiydlaDrmump () rxnif ty1omtr u o;(0 2uoio iy1al   nct (fartmumo;u1apt ifciltla rmnmo;t0aetnmr3iy1lp  aivi;s0 2urio iy1omtnmnvtl(  rtrxrono1oeeomictatfaDrm(vs;(0 ltoxr todfaDrau i;()s2uoir ou4amenmfvi ()s2ururoou0oleo ictld mDulumo (4 rxrmr3ia1lmD auvi t trtmxrpnu4lleemnctls  2rr(mp;t1aetn fciyslm ean o;u4aleoio3ty1fpDraies s0texoir ny1apen ietlt a2ra(r ;u4olxnifciadls umnvp;u0tlerxrcto1la   u s () 2umxo iydope miet t s2taumoou1tptnmf3tld mDrmuvs;(0tlermr3iadfmt li o t)t2xoxrpoo1ll nmictas) 2rr(moot0oltomi3tysls2um(vs (4 reoxo oytomD  i o ( srxm(m iydapenlieslt) 2umxrpou0ope if3iydfsDem(mont)tltrircoydlpteli slt0 2xr(mpou4lmtnmnviasfs2umxmont4aleoiietytlm uaump;()trxoirctadlp rauvs;(0trtoio3oodapeemncsat) rua(rpnu1tle  fctatls rm(ms;u)texoiocoo1om  au i;( texo(mpnodlm emfcias  rua( pnt0aexo i3iydlaDrlnvsn() exnir3oy1omD au o s  euo(rpiy4lleemfvs (fsrur(r ;o4oee mi3iydlm2eln o;t0 exoxf3iytfm eln s s0 2xoim3no1amt lfvsatfaDuauro;t1opt  oeiys m2ra( p t)arerxr3iydfptelnes;t0 2urir ny1ap  livtasfs2tm( ooo0tetn f3tytfa rl( o t0 rxomo oytfp  aivo t)s2tr(mpiu1ll  mfet s  Dua(r nt1altn ieiydfm elnvs u0tlxnmf oa1fpDelueolt  eto(mpiy1lle mfcsa(fs2rmxmpnt1ole mfeiadlmDul(msn()teenmo todlmD au s;t)s2tmir oudlme mfcsls srrmx oot4olxn f3tydlm2uln on(0trxrif3iodfmtr ues;s0 2toimpoudame mies tf rrr(mpoo1tpe  oeiyslmDrm( s (0 ltrxf3to1fmDelnvilt t2xr(opiy4omt mfet ( a2umxrpnt0alenmi3tysfa rl(mo;u0 etnxociotomD lnvi s)texmxr ny1lm n feta() 2ur(r no0tpxo ictydlaDemumo;(4arxoxoctodfpDe ieo ( t2to(o iudap  lfeias)srurx o;t4oleoii3iad m2ra(vsn()tlenmfcty1la  aies t0srxoxm3oudale  ncta()s2tr(rpou0ape mieiysfm2elnmp t4texrxo3oo1op eaiei (0seuoxm oudomeelfvta( aruru poo4altomfctltfs2elums;(0artnxfcoo1opDr i il(0 2xr(o3ny4omtemfvsl(f 2trur nu1tlxoii3iytla2emu o t0tetoxr iatlat lu i t srxoxrpio1llt lietlsfa2rrum nt0aeen ietlsfa2rl(vp;(4trenxocta1latrau ol() exr(o nudap n ivtl() rraxr ;u0tex  ietldfm2ean o (4 lenifcoo1om raneo;(0 rtoxo iodapee nes s)arrru  ot1aee mfeias m2ul(ms;(0aleoxfctatfp  auvs (  rxmiopiy1om elnvtat)sDumum ot0aexomi3iyd mDrm(mp u4aeeoxrciotomDr ivsl(0trtr(o ny4ape mfciasfsrtmu  ;t4aet  f3iytls2rmuvpn(4 ltnio oatla  aivs;s)s2urxrpiu1lp n fesl(fs2rm(mpnt0opxniieilsfa ulumo u)tleoxfcoa1fatelueo s) rxoio oo4ol   fetlsfsrtrxrp;o1ope  octytfa eln o;u)tlxrxf iytfm e n il(  rtrir3oy4op elnvtas) rrrumo;t4tlxomoctltla2el(vp t4altnxrcoa1fmte uvs;s0s2tmim3nydlmte ietl( s2uru  nt1tetn feiat a rluvsn() reomrciadlp r uvs;s0seuriopno1ameelfcs ( arrmxm ;u0oetn feiyt s rl(mo t0areoxr iodlmt liei s s2tr(o3io1olenlnvia()arua(rpoo1oee io3tys a uau p;t4trenir3ty1fmDr ieil(  exr(m3ny1olte nei tfa2rm( pnu0aeeo oeiatfm ul(ms;t) lxnif3iodlpDeaues (0trxm(m3nudapeemictlsfsruaur ou0oee iictytfmDul( o (4 etomo ootlm eai o;s0srtoio iudoptn netlsfsrua(mo;t0alxo ociytfa2ua(mp u0arxoif io1omDraneo;t)srum(o oudope  ivtlsfartax  no0tltomfcilsls2uau ont) rerxf3iodopD aivi (0trurirpiu1lp nmivtat  Duau p;o4tlenmoeildfa raump u0 rxnxf3oytlp  aneol()s2tm(o oo4omen neias)sDtruro;u0alxn ieildlm eaumsn(0tlxoxo3iotfptrlies s srtoxr oodlpt  nvs s srraxront1aptnmoctat sDra(ms t0 lenmr3io1oat ln o;t) 2xm(m3iu1am e ies t a2umu ono0tpenifciyt aDea(mp (4tlxnmo3iydlate ivols0sexoim nudom  micil(fs2taumpoo4tlenioctydfaDuan snu4 lxrxf ty1optr u i;(0srxr(m3iu4opeelivilt  Durur oo4opeomfeiysls raump t)aeenio3ta1lpDeanvi;s)srtr(m io1optnmncslt)artaur ;u1apxnmfciasla uanmo;(0 reoifcoytlptrlivi;s0 eumxopoudalt mneia(f 2rax pot1aexo ieilt aDrmnvp;(4tltnif3totfa e n ils0t2um(o3oo4ap elivsltf Draur ;u4oetniocild sDeln s u0alxrmrctadopD lueo t0teuo(r3iy4lmenmfetasfsrraxmoot0tetomo3ias a2um(von(4teenir iydomt  uvo (0seto(opio1op nmfci sf rrrx  oo4teenioctlslmDuanms;u0 ltnio oytlm rln o ()trurim iu1aptelfcsatf 2truro;o0oex iictltfaDuln s u0aeerxo3oadfmt aieo ()t2xo(o3no1om  micias)aDtaxmpnt4tpxniocias s2rlnvs;() rxrxo tadfp eai o;s)t2trimpoodaleelfcias) 2ra( pnt1tpe ioeiatlm2ea(vsnt0aexnxo ia1faD lues s0 ruoxmpiy1am nmfctlt)s2ua(  ;o1tle ioctldfa2ul( pnt0treoxo iodfm r uvi s)srtoir3oydome mfetat s2uru pnt4tlxniocilslm2ulu s;(4aeerxrciydfp  lieol()seuo(m iy1optnliciatf rra(  nu1tlto octatfs2rluvo t0 exoio oydfat luvols0srtr(m3iy4llt mnesa(fs2rmur oo4tptomietas aDrluvo t0arxrirciodfmD  ies;t0s2trim3io4lmt mieiat  rtr( o;t4tlxnmociydfmDumuvo;(0 rxnmr3iadfat luei s trxm(rpnodoleelies t) rrrxrpno4oltomo3iat mDumn snu4tetnxfcoadlmte neo (0tetrxrpou1ale  ivs t) 2tmxrp;u4texo o3tlsfaDrluvp;() lerxo3oytlmD aivil( t2trxm3oudlmeemneil(fa2rmumpnu0apt moeiaslm2ul(mp;()tltoif iy1lp  an o t0tetm(m3iydllenmfci ()srurxront0tleomo3tytlm2eau p;()trermr3to1fpD liei s)srtoim oudlpt mivs s aDtaxro;t4teeniicilt s2rluvo u4trenmr oodlpD lnes t0s2uo(m ou1lp  mnvslt)srurxm oo4tlxnii3ildls2ra( s;t4aexrirciatomDeluvs;s)trto(m3ny4ll  mncsltfa2trxrpot1apenmi3iys s ran p;(0 eerifciotom rln o;s  etm(o oydopeemnei t  Dtaum oo4alxoifciyd aDea(mo ()altomf3tatom  auei t0 2xr(rpnu4alt lnvils) Drax poo4aeeoif3ils a um(vsnu4tltrmrctytlaDeluvs;() rxoim3iu1ap  lnesatf Dumxm ;u4apxn oetls s2el(mp;t4 lxomo3iodla  anvi t0sexoxr oo1lme  nvt ()aDur(r ou4oeeniocils sDeauvp (4 eeoio3iy1la r uesls0t2to(opiodap nmivtlt)sDuaum nt0tlt mf3tlt m2el( o;u) renmo3iy1fat  i i;( seuo(o oo1am nmnvta(  Dtru oou0oeeniiciyslm2uluvonu4 exnxf ty1lmtraneslt seumim iy1ame mfcsl(f rtm(mooo0teeomocilsfmDeanms (0 eermrcoatfaD aivi;s0s2xmirpnu1oltemivsas arua( p;t4tpx mictatfa2ulnvont0 renir oy1oa r nvolt setm(mpny4amenlfcs ()sDtr(mpnu4oex  f3iltls2uan p t) leoifcty1fptelnvs (0sexm(m3no1apt lnct () Draxro;u0tpe mieiat mDumuvs t4tetnxr oatlaDrluvo;s trxo(mpnydamt mivia() Drm(mooo1apxo fciatla eln sn(0artnir3ty1fat livi;(0srtmimpnodll  micslsf Draumont1optomieilsfs2rmnvp;(4trxrxo oytfpD auvils srxm(mpou1ap e fei t)s2uauront4tetoiicilt m2elnvo;u4texnmrcoy1fptrln ilt)trxmir iudll   nctat aDrm(mpno0tpe ii3tydfs elums t0tltnxf3tatlptr uvs s0srumxopno4lmeemnvslsfsrtmx pot0apeo fetldfaDumnms u4arerxo3totoat auvols0texo(rpnudolee ivi t  2ur(mo;u1optomociasla2rm(vpnu4 lerxf io1oaDr nvs t0t2uo(opoo4lle mfesasfs2taxrpno0oleo i3iat s rlu snu4 rerir iodfat lnvs;t0 2xm(o3no1ap   ies s)s2tmxroot0texnifciyslaDra( s t) rxnir to1omDr nvi;t0texo(m oodlptemnvsat  rra(m ;o1aetnmiciaslaDumnvpnu0 rtnxr3oadoaDrlnvol(0setmxm ou4op   icsls)srrmum ;t0tlx  fetld m2elnms;() lxrir ia1fatrluei;t0 ruoxrpny1lpenliei (f Dtrxr nt4tpxomiciltlaDumums;t0 lenxrcoatomDrli s s)t2xrir ou4ll  mivils  rtaxmpnu1apx  oeiyd s2uanvo (4artnif3oo1lm  aies t0seuoim3no1amtelncil( arumxmonu4tlxn o3tyslm2eaump;t4aexoif3todopD au i t tetr(r3iu1am   netatfsDrrx ono0opxn f3tltlm2uan snu0tlxnif3iatlmtean i;t trxr(r oo1ope livsas)a2tr(mooo4oltn oetys a eln s t4 exoxr tatfp eau s t)srtoxmpoy1olen ietlt srua(rpnu1aeenioeiytla uanvp;t4arxnmf3iy1lat  ivs (  exmio iydom n nvtl(  2ta(mono4ope  o3tys m2umnmo;t0treomo3tytlpDrlu s;(  etm(m3nu4om n nes ( arrmu poo4aeeoif3ild s ulnmo t0arenxf3oytlat lnvsls srxoxrpny4apt lnetasfsrtmxro;o4aptnif3tls sDra(vs u) lenir3oadfmt anei;() 2xm(r nodlpee ivsa(f 2ur(r no1tlen oeiaslm2rlu o;(0 eenif ty1fmDeaneo;s)srxrxopiy4oltn ivt s)arua( o;u0tlx mfeilt a rmn p t4areoir3oatfatr i ol(  etoxo iudaptn ivt t) rrmuroot1aet ioetadfsDran s;t4artoif oy1oatr nes (0sexmim iodameelfciasfaDtm( onu4tleoiicilsla ranmpn() rtomf oo1fm  lu i t0trurxr iy4openmnet (f rrmxr ;o0ope ifeiadfmDemnvo t0 etnir ty1lp ranes;( s2to(o nu4amenmnet s s2rauro;o1tet  f3tad m emumpnu0aetomr3totfmteauei;t t2xr(m oo4op nmici s) 2tmxmp;u4apt iociyt s raumsnu)alenxoctytop e i ils setm(rpno4lp n ncs () ruru onu0tee  ictlsls umnmpnu) reoir3tadlptrlneils t2uo(r iy4lme mics tf 2rmxr oo0apenif3tadlm2elnms;t)arenxf tydfm r uvi s  2xmxo ou4lpenlfvt s)arrax onu1tlt  ietls mDuanvo;u4tleoircoo1fmtranei ()s2xmir oo1lp nmfvtl()a2umurpno1tee mfeils aDelumpn(0 etnmr oa1faDeaieslt0s2ur(o oo4lltn ics ()sDtm( o;u1aeeo feild a eauvo (4aetnmf3oydomteau ilt texoio3oo4am  mieta()sDtrurp;u0tlen ociys s2eln pnu0altoif oa1fa e ueo s)srtmxr ou4llee ictl(fa2tmumpot1oeeo oetydfa emnvpn(4teerxrcty1lpt  nvo;() rtr(m iydam  lnvi t srur(mooo1tltn ictltfa2ranmp t) ltrxrcty1fp eli ols) rtmim nodoltnlicsas  Duaxr oo0aetn fctas s uluvo;(0tltomr tytfp elivo;(0seurio3no4lmtnlfcsatf Dtrumpno0altnif3iasfs2rmnvp;(0 lerifciadlm r ivi;(  eurir iydlpe  nctat  Dtmu oot0tetnmo3iltlsDua(mon(0 rtomociotla eanes;s)t2xo(rpiy1ome
\ No newline at end of file
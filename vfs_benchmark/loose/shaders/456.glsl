@@ -0,0 +1 @@
+i ilt)s2xm(o3nu1amtemnvi () 2urxrp;o0apt mf3iadfm2umuvo (4aleniocia1lpD anvo s) etoxmpiu1lpt  ietls  Drax p;u1tex mi3iytla2uauvo ()teermo3oo1lmte ues;t  ruo(rpny4lptemfcs sfsDrr(m ;t1ole mfetlsfaDrl( o t4artrxfcoy1om eauvo ( s2xoir3iy1ol elfvtas)a2urxrp;o0tex  oetasfm umnvont0arxnif oadla rauvi;s0srtoimpno1lmtelfvsat)arumxrp;o1texoii3ild a umumpnu0 etrmr ta1laDeauvi (0setoio3nudap nlieias aDrrxroou4opt mf3iytls2el(vs u) rxnxoctatlmteaues t srxoir io4ap eliei s)srur(r nu0tpen oetlsfsDran onu)artrmr3iadla  anvo s)sexoio3iudlltemfcsat  2rmurpoo4optnmi3iatlaDuan o;u)altomrctatopD lnes;( srxrxopou4omt mnvi () 2rrxrp;t4tpxomoeiys sDua(ms u)alxrioctodlmtrlu olt0 euoxr ou4alt livtas) 2trur ;t1ope io3iytfmDuanvp t)altoxo io1fptr u ol()t2toiopou4amtelnes s)arua(mp;o0tlxomi3iasfmDrmnvs;t4arxoir3iy1oa r u i s)setrxm3ou1apeelfciat) rururpou4aetomi3iat a emump;(0tlenmf3oa1lp  lnvs;()t2urxo iydlmtemics tfsDuax  ot1ape iociydfs2ran o t)aetnio tytlm eaieils0trtrim3ou1altn nvtasfsrraxmo;t4olxn ietld m rm( onu)alxnxr3ta1fp r uvol(  rxrxm io1al nmivsltfsrraxmonu1oeenioeiydfm2rmn on(4trtomo3oa1fa  lu s;(  2trxr oy4alenlnet ()srtmumoot1oeeoio3iatfa2uaumo;(0texrmfcto1lpDraneo t0 2uoxr nu4am   fcia( s2umx o;o1aexnifciasfmDemnms;() eeomrcootlmDrlivo;s trxrir3iu4amt mnvi t sDta(mont0tpe  feiydfm2eanvp;u0treoxf tatlatr i s s0srtoxm3oudamtnmivsat)s2tmumpnt4olen fetaslm uanmo;(0alenxf oo1fm r uvilt)teurxrpnu1am e netl()a2tmuront1apxomiciydfm2um(mo t)texoxf oydfpD  u s (  euriopiudamte ieilsfa2rmx pou4aleomfetysfs ua(ms;u0tetoir3tytlmtr ueil(0setoxo no1amenmfvtat srurumono0aptomfeiasls2um( s;t4 lxoif iytfaD  uvsls0 2xm(o3no1ape mncia( sDumu  ;o1tet mocild aDeluvo;u4aeerif3oy1lpt aieo;t) rtoio3ou1lptnlfcia() 2rrx oot1oeto ociltla2rlumsnu4teerif iytfp eli o;t0tetmimpiy1omtn iei t s2ra(r ;t4tltoii3ilsfm2rm(vp;()tltrmo iy1fmDeanvil( tetrio3iy4alt mnet tfsDrmxmo;o4teeomfeiadfaDrl(vonu4 exrxf3tatoatraneo;s)seurim3nu1ll n feslt  rra(mooo1texomictltlsDumu s t0aetnio3totomt an slt  exm(r ny4alen nei sfs2tax  nu4oexo ictltla2raumo t4alxoxrcoytfmDeanvi s) eurio3iu1alenlnvsas srrm( onu0alt iictlsfm umumo u)alxrifcoydopteaiesl(0t2trio oudlp elfvtltf Duaumpou1openmocilt m2raump;t0teeoirctytfmDrluvi t0setmio oy1ap  mfvia(  rrmum nu1aleo o3tatfa ea(vs;u)arxrmf3iadopte nvo (0 2toxo3oydll   ieslt s2um(mpou0apxnii3tltla um( p u4trtoio3tatfp  anei;t0seumxm3nudalt  netas)sDra(ront4olxn ieiatls ulnms u4trxnmf3iotop eanei;(0 euriopoo1om nlici ()s2taumpot1aptn iciltls rln sn(4alerxfcoa1om rlieo;s trumxm3oodlltnmfvs s)arrrurpnu0altomi3iytlm rlumsnt4aeeoifcootlptr ueilt)t2uo(opio4ol nmiesls)a2rrxronu0apx  oeiydla ran s;() rtnir3oatfpDr neils0tetmirpou4omtn fcslt srurx pou0teenio3iadfmDua( o;t0teeoir iodopDelivils0seum(mpnu4ap e fcsltfarrmxm ;u0tpeo oeiasfs uau on()aetoxo iy1oa r uvol()s2uoxo3io1oltnmies ()artmxmonu1altniictyt a2um(mpnu4tleoxfcoy1oa  an o;(0truoimpiudamt lnesa(  2raxrp;u0aeeoifcild a2em(vs;()aeeoxocoydlaDelu s t t2um(o3oy1omen neta( aDrmu pno0oleoioetldfa2em(vo t4 eerir3oadfmD aneilt0t2tmio3oo1ole mncs t)arum(mp;u1aetnmo3iatlm2emnvs;u0 lxrir3iadopDe n s ( texoxr oudoptnmnvtl(f 2raxm oo0apxo i3iat m eluvo u0tltomo to1omtraivolt sruoxmpoodlle mncsl(f rtrurpot0tpe  iciat m rmu p ()aexnmo3oatlaDrlu o;s0 2xr(o3oydlptelics ()s2ur(rooo1alt miciytfa el( p u4 lerxrcoadfptr neslt) 2umxrpiy4ll n nct ( srurumpoo4alt mietldls2uanvo;u) rxrircto1om  auei;(0s2xoxm3oo4alenmivsl(f Duaxmpot4texoii3tadfs eaumsn()tlenxo3oa1omDe uvsls0tetm(m3oy1ap n nctat artr(m ou1aptoifcild mDum(msnt) leoxr3oydlat  uvo t)sexo(mpoo4lm emics s)sruax o;u4teeoifeiat m2ua(vs (0tetrxo3tadfptr nvi;s)t2xo(m no1ameemivt t) Dtmurpoo0tlxoio3iyd a ul(vo () rtnxfcoo1om   ivslt t2to(rpoo4ope  ncias)s2rmx  ot0teto iciadfm em(vo;(0 rxrif3tadoateau ilt)trxmxr iudol nmies sfaDtru  no0apxn feiasfs ra(mp (4tlxoif3oodlpDr i s;(0 rtr(opoudom   fvias)s2rrxmpou0apxnifetasfsDeln o (0alxoif3oatoaDr uvi;(  2xr(o3nu1ll  lnetltf Duaxmo;u4tle mfctlslm2eau pnt0tlxnxf3oatopDeanes;s0 2ur(o3oy1lp  mnvil(fa2umur nt4apto ocildfaDea(vp;t) rerif3iy1fm e u ilt0trtoir3nydale lfvsas a2rmump;u0ole  oetldfa rmump;(0aeerifcto1fmt anei;t0s2tr(mpoo1amenmnet t)aDtrxmoou4texomoctad m2umu pnu)artrxr oadom r uvsl(  euoiopoodome  ncslsfsDtmu ooo4oex ii3tatls uau snt)arxrmf3iodlmDran o;s0 exm(r iu1lm  mnvtl( artmx  ou1oexniiciasfs2emu p;() ltrxocty1fa eli i s) exoim3io4ameelnesl( srtr(r nt4aee mo3iytfa2um(vpnt0artrmrciatlp  an i t) eumim3io1ale  nei t sDraum ou4aet  f3tad sDea(msn(0altoxfctodlp  auvs;(0tetoxrpiy1om n fes ( arrr(  ;t0oetnifeiytlm umnmo u4areoxr oo1fa  ai s;t0 rtm(m oudaltn fes (fs2um(mp;o4alxoif3iasfs uluvs ()tetrio3io1fpDrlueo;(0 rumxr iydamtn iei (fsrtmxm no1aeenmieils mDulnmpnu4texnmr3iotfatr nvi t  2tr(opnudam n netas)a2tmur ou0aleoii3ias a em(ms u4tltrmfcio1latr ivs;t)setoxr3oo1lmeemiei tfsDrrxrpou0tpx moeiasfmDranms;t4 etoir3oy1fmDrau o t0srumirpoydapee fesas)sDrr( o;t4teeo f3tyslaDrluvp;u)teermf3tadfaDeauvo;s)s2urim3nudlpeemicslt) Dtrur ot0tlxnmictas m2ra( p;t)tlenmrcoa1omDraieil()trurir oo4al nmiesatfsDtax poo1oex  feias mDem(mon(0 etomf ootlm e i olt)t2um(mpiu1lm  mfci t) rtrumoot1tex  oetatlaDua( pn(4tltrircootlmDr nvo;( seur(r3iu1altemfcs ()srtm( ooo1optnmfciyd mDelnvon()aetoxf iodop elivs;s seuoim ny4lmtelies t arur(rp;o4alxnmoeiydlm2eauvp (4 etrmocoydfm r u sl()t2umim iu4lp emies s aDrrxrpot0tex moeilt m umuvsnu) rtomf3oydlptraueo;s  2toxm3oodal emivias)srtaxr ;t4oexo ietlsfsDra( o;u4altnmf oy1fpt  n s (0setr(m iodam nmicilt s2um(moot0aexoifeiytlm2ulu onu0 eerio3io1fptrlu i t0 2uoir oo1omte nvi t)aDrmum ot1oleo oeiadla uauvs u4 lenmo to1fmD  n i ()srxrxm3no4optn fci t srrmx poo4tlxo o3iyt sDrmnms (4altrxocoy1fp elneo;t t2um(r oudame mivi tfsrraxmoot4olx iiciasfmDel(vpnu0teerxo oy1fa  li o;s s2uo(r nu4opeemnvt ()s2ur( o;t0aex  f3iasfs umn s;(0aexnmo3oy1om r uvo;t srum(rpiydopt miesat  2tru pot1aetn octas aDeau p ()trxoxo tatoa e ivsls sexr(o iydop n ivia() Dtrxmpno4opeo i3tasfs ua(vp;()areoioctadlaD ai sl()trtoxm oy1lmtelicils)aDumxroou1tetoiictld aDul( p (0tetoxo oatlm   uvi ( s2trimpno4llen ici t) rra(mpno4tpe mf3tasfm rmumpn(4 lenxo ty1fmtelnvil() rxrxr oo4omtemivtlt artru pot0opt  o3iytfm2umnvs u) lxoxr ta1opDr ivs t0t2xr(opoydomenmnviat)a2taxmo;t1olenif3ias mDuau p;(0 lenmfcoy1fpt  uei t) rxmxo3oo1llen icil( sDraxmoou0oeen oeils a2uan s;()artoioctydfpD lu olt s2umim3nu1lp  mfci s a2uaxr nt4opxn feiltls emuvonu) renxociy1lpDr nes ( sexr(r iu4ap  lncia(  2rauront1tee mietls s uau o;u4 rxnir oa1omtraivs;(  2urxo3nydame  fctatfartaxrpou1olenmfeiatfsDuanmo t0artnmf oo1lp   ieo;s srtmim3nudalt lfvt tf rtrumo;o1altoioeiytla ea(vo;()trenxfcoo1oat auvi s  rur(mpny4lltnlfvsltfaDtm(m ;o4oeen feiasla2rmu pnt4 reomr3io1oaDran slt  2um(opno4ol nmnetlt aDrrxro;o4alxoiieiydls2umuvo;(4 exrir io1om raivslt s2urxrpio4ameemnvtasfaDrr( o;o0tpenifctytla2rau o (4texniocoadfm raueo s tetoxr oodlp   feil(farraxr oo0oex mfeiat a ulnmsnu4altnmf3tydomtraues s0srtr(rpnudome lfet tf rtaxr ;t0texniocilslm2ra( s;t4alxnifciotlm e n slt)texoxmpio1openmicia() 2raumoot0teeoioeild s el(vo;t0 rermf3ia1fp rau olt  2xoiopnodal  licslsf 2ra(mono1alto f3ils m2em( o;u4alxrmf3tatom rlnes;t trxr(rpou1ll   fesat)aDuax  ;u0tlto ieias a2rmuvp;(4tltoxfctotoatr u o t0seuoxrpny1lpee fes sfaDua(ront1alxomi3iyd sDuluvp;u) lerif iy1lp ranvil()t2xmxm ou1ale mfvt s) 2ta(rono1tpxniietas m raumo (0trtnxfciotfp eaiesls srto(m3ny1llt lfeiltfarua(r ;o0opt mieild m2umnmp t4arxrmf3iadlatelu ol(0teto(r3iodlm  liciat arra(rp;o1opeo o3tadlmDemuvs;t4trxnxf3ta1lpDrln i;(  exmirpny4altn fvtat  Dtru ono1olxo oetyt a eauvp;()aetomociodfp eai sls  exr(o3no4al nliesa(f Drrx o;o1ale  f3iad m2uau snu4altnmo3to1lmDe i ol(  2tmim no4alt mictltf Durxrpnt0altnmoeiys aDua(vsnt0 rxomo3oy1la e nei (0s2xoimpiu4ameelnes (  Drr(ro;u0alen fetatfsDeln p t4artnmo3totfm e ueo s)texrio3nu4lm emnvslt)sruau poo4oltnmfeildlsDra(vs;u0trtnmo oodlpD ai s;s)setmim io1ole mnetl()aDraum ot0tex mfeilt m um(mpnu4tltnxr3io1om elieolt s2urxopoodope  fctlt) rtmxmp;t1oltn iciadfaDuauvs (0treomo oytfaD  ies ( s2xmxo3no4ll elfcsl() 2ta( pnu0aexnio3iytfs2uau onu4 rxnir oa1la   nvo;t srxm(mpoodlp e ietl(fsrrm(mpou0opeoifeiasls2rl(mo u0tetnxf3tatoa eai sl()teto(opiudapee ivsa(farrmur no4aex if3iysla eanmp;u0arerxrcoatfm eli olt0trtr(o3ou4omeemnvi tfsrtm(  ou1tee mfciyt a eanvpn(0artnmf oodlptrluesls)srurir3io1amtn icsas a2rmxr ;t1oet mi3ild a ra(vs;u4alxrmo3iatlaDrln s;()t2xo(mpnudlmt  ivt t  Dtaxr nu4opt if3ild a ulnms (4alxrxocoy1lateaies;t0srxoxrpio4aptemfetat)arrr(  nt1olenifcildlm2ra(vs;(0 rermfciydoa  luei;s0srto(opoudll elictlt aDtr( ont0tet ifcilt a elnms;() ltomf3oo1lmt lnvsl( trtoxr iu1amt  ietls) Dtaxm no0aetnmiciatla rmnmpnt4 rermr oo1lpD lnvol(0 rtrxm3oo4ame  feiasf ruax  no4oet  i3ilsfs rlumonu4tetnxf3oodfpDe uvs ()sruoiopoy4lmenlfvs t)srrax o;o0aptn ieiad sDemn onu0tlenxf3ootfpDe ies s0 etrxo ou4oltelnvsa(f rraxro;u1aleomfetltla2eanvp;() lxnmoctotfm e nvi;t)t2tr(o3ou1om nlieiatfa2rrxm nt4olx  feiytfs rm( o;(4 rtnxrcoadomt au ols seuoio iu4al e ncs tfs2rm(r ou4tpxnmfeiyd s rlnvpnt4arxomr3oo1opDrli il(  eto(o iy1apen fvtls)sDtmu ooo0tleoif3iltlm2umnmonu0 lxnir iytop eli o;s0seum(m3oudomeemivs t a2tmum ou0tpx mfetas s emn p;t)arxoxr3totfateanei s seurxo nydlm  livtlsfarururpoo1texnifctytfa ua(vs;u) ltnxo todom   uesls0s2xmiopnudoptnlncsl(  rrmxrpno4apeoioctls a2uln o t4alxomr3iadlp raivi s)t2urxmpiy1llenmnvtls) 2trurpno4tetn fetydlaDeln sn(0artoir iydfate ieo;t) 2trxm oy4ol e fes t)arurxmoou1aee iietltfm uln o t4arxrio3oadomteli i s s2tmxmpoydop nlncsat)sDurxm nt4aptnmo3ias m2emnvs t)arxoxociydlat aieo t0trxoirpnudopt mnet t a2rax p;u1aexn fciytlm2rlnvpn(0treoxf tadlaDeli i t trtmxo oo1am emnvs s a2ua(ro;t4tpxo feiyslaDrlnmsn(0trtrmf3oytlatrlnei (0t2toxo nu1opeelnci t) Dum(mooo1tpenif3iydls2ea(vs;t4 lerxr3oa1lat au o;s0teumxo oo1ope lfviltf ruau  no1aeen oetatfs2em(vo t0artrxo oa1lat  nei s)s2toiopoodam nmnvias)srumxr no0tpxo icilsfs2ul(mpnu0tlenxr3iy1oat lnei s t2uoirpnu1ap elnvt tfs2rru pou0oltnmfctat m2ranmsnt0alxomoctotfpDeaneo t) rxr(m iy1lle licsa(f 2ur(  nt1opx mf3tlslmDea(msn(4 ltrmfcoo1fm r ieols s2xmim iu4om nmfct (  2uaxmpot4apenmieiasfs2uauvs t)alenir iotlateai s t teum(o ny1lmte ivt tfsDurumo;t1oetomiciydlm2el( onu0 rxrmfciotlat luvs;t  rtrxr3io4lleemncsatfaDumu ooo4apeniieiysfm ua(vsn()aeeomo3ia1la  lnes ()teto(o nodop nlfctasf ruaxm ot0apxo ocilslmDeau p;t0aexrxrcia1la   u s;()s2xrxr oydalenlnei s  rrrxm ot4aetoiiciatfs2ra(mpnu) lenir tadlp  anesl(  rxmim3oy1lpenlfeil() Durxrpoo0tpx ii3tyd mDrmumsnu) ltomoctatfm  auvi t)trxoxr3ny1lptelivil(f rrmurpnt4optoiieildfmDrm( o;t)alenxrcoydfpteanei;( setoimpio1ll  livils  Dumxront4tpxnioeiasfa2eauvo;u4texnmfctodfpt auvo s0s2to(r no4op  mnvi t sDuaxmpot4ale  ociys mDrluvo t0 rxnmo3oodopt anvilt texo(opoo4alenmfvs ( srumxrooo0ole iiciydla2ua(mont)trermf3iy1fmDeli o;t0sexrio3nudlmenlict s)a2taxmoot1tleomf3tldlm ua(vsnu4 renxf oodlateli s s teuo(o oo4lme livsas) Dtmxm nt1tlx  o3iyd m2umnms;() eeoir totla r ueol(  etm(m3iu1alte fei tfarur(mont4apto i3iltfm eanvon()aleomrcia1oaDe n s (0trto(r3nu1lpe mnei t)srtmxrpoo0olto oeildlm2emums;u0trtrif totoptr nvs s) 2xrio3iy4aptnmnesls)sDumxmp;t0tlen feiltlaDul( o;u4tetnxf3iydlaDeaieo t) exmio ou4ll n ivsas)s2trurooo4altnmi3tad m2rmumon(0aeeoxo tatlm r ueo;(0 2umirpoydaptemnvt t)srrmxroot0tleoiieiat s ea(mp u)aeenxo3tadfmt  ieo t)t2uoirpio1opt mfesas s2rmx onu0openif3tatfa2emnvpnt4trermrcoo1fm   neo s0 rto(m nudamenlnvtatfsrtmx onu1tpxn feias s emumont0trtrmf3ta1omDeaieols0texo(r3nydomen fct t)aDtmxrp;u1aexo oetydfs2rm( s;u0 reoxr tatlatelies;(0 rtrirpoo4lm emfeil() rrr( pot4tltomoeiytfa2uluvo t) lenio3oy1omtelnesl(  eumxm ny1lmtemncs ()artr(ro;t4aexo f3iaslaDranmo t4 rtoxo totoatrlnvs;s)texrim3iu1omeelivtat)artm(ro;o1aex io3tysla rmnmp u0trtnmf oodfa r uvo;t0seuoxo3ou1om  lfct t  Durxr oo4opx  i3ils s2rau o;t)tlxoxo3to1lpDrauvi t0 rurim nu4lme mfcil( arrr(m nt4teenmieils mDraump (4 lenxf3iytoaD li s s)t2tm(m io4lle licsat)a2ur(r ot1aexo f3tltfsDuan p;t0arxnxrciatlaDranvi;()setoim iodam nliciatfaDra(r ot4alx mo3ils m2umu s u4 exnmfcoo1lmDeauvi;( seurxr oo4aleemfetls aDtm(mp;u4alenio3tytla rl(ms;t4arerxfctytlmDe n sl() 2trxopnu4amtnmiviat)s2umumo;o4tptnifeiys s2umnvo ()altniociodla  aiei;( trxrxrpiudlp n ictasfsrtr( p;t1apenioeiyt s emump u0 rtrxo oy1lpDeai i (0t2ur(rpoydal elivsat)arur(m ot0aptomictldfs rlu s t0altrxr3oa1la rlies t s2to(m ou4lmenlfvia(f 2ur(m ou0aetomietadls2ul(ms ()alxnxr totfptr u o s0 2uo(r io4al n nctl()aDuru o;t1teenio3iasla elnmpnu4tlxrxf iadoat  n i s0 euoxrpiy1lmee ivsa(  Drm( oou0alt  o3iysls2elnmo (0aetoxf iydfp elnvo s0s2xr(opno1op emfvtat  Duaxmpnu1tpto oetls mDem(vpnu) lerxfcoytop  lueils) rxriopny4lptnlnetas)s2rmx p;o1aetomociad s2emnvp (0artomo todfm rauvi;s0tetr(r nu4al emieiat)aDtrumono0teeomo3iasfmDumu pnu0 rxrxr todop eaues;(0sruoxrpiydopt mfeia( aruaxmpno4aexo oetadlsDrmnmp ()altnmr oatfp   nvi t)t2xm(o no1al  lfes s)srtru poo1tpxo iciaslsDemn s ()alxoxf iotfaD  ueolt)trtmim3ou4opt lfeslt  Dtaxrpnu4oleoiictytfaDra( snu0artoifciy1fmt lueo;t)t2xm(rpoudlp emfvils sDrr(ront4opxnmfetyslsDrlump u0 rtoifciodfp   n i;t t2xrxr3io4apt livt tf 2ur(r ;u4tle  ociat m2umuvo t0 etnxr tatoat  neols0 etoxm3oo1optn fvt ( aruaumpno0aexo iciltla2ra(mo;t4altnxocty1laDelneo;s t2tmxm oy4ol   fcsatfartmum ;t4apxnmo3iyslsDelu sn(0tlxnmfcta1lpDrau i;s0sruo(mpnu1lmtelncsasfaDum( o;t4tpxniictlt m um(mo;u0 rxrmfciydoat ln slt0trtm(rpiodole lfctlt)s2umurpoo0aee mi3iat a2el(vo;t) eeoxocoa1oaDr i i;s  2urir iydlptn ieslt  2trx o;t4olxn i3tyt m rl( o t0treoirctydfaD lneolt0srtrio3iodlle  fvil( s2taxr no4ape ifeiat sDumuvsnu0texomr3ta1la elueol(0srtm(rpoodome  nci tfs2tmumpnt1tptn icildla rmump t4 ltrif ty1fp   i sl()t2toiopny4optemfei t aDtrump;o0oex mfcias sDrmnvo;(4aetnmr iydopt auvi;t0s2ur(rpnodllen ici tfaDumuronu4olxnmociad sDuln s u)trenxf iydlmDrlnvo;t)t2umirpiy4lp e ivslsfsrrr(mo;o1olt mf3ildfa ra(vo;t0 eermrctytfmDrlnei;s0 2urxopny4olt  nci t)srrau pot0aetoifeiltls2rln p;()arxoxr3iadomDrauvs;() 2xrxm io1ll nmncs t)s2tr(mo;o1oexn o3iat mDrmnvpn() rtoxf tadoaDrlnei;()t2toir3oodop  licsas)aDumxm nu4aeenif3tasls rmums t4alxrxf ta1lptelneo s0 etmimpny4lmt  fcils) Drmurpot0tpe ifctatlm ra( o;(4trxoio3oytlm  aueols0srum(m3nydap  lncsas aDtrxrp;u1aee  octad a2ulnvpn(4arenif3iy1om eluvsl( trxrxo io4aptnmfcias)sDurum no0aetoio3tydlsDum(msn(0 lxoxr3oy1la elnvilt0s2xo(r no4aptemfvtlt) 2uaxm nu4tetnmieiadls ul(ms t4teenxr3io1lp e nes s)teuo(rpoo1ap emfcsat)arum(m ;u4oeeoifetysfsDem(vp;u) lxrxr tytfpD au i;s0tetriopio1omtn nei t) Dtrx  ;u1tlto o3iydfaDrln o;t) eeoxr3oo1omDrlueslt  rxrio oo4lptemfesl()a2tr(  ou1tpto ieiyt a2umuvo u4 exoxr ia1oaD  ueo s0 2to(m3oodlmenmfvs ( srumu o;o4olt ioctltfa rm(mp ()alxnxociotoate n o;t)s2xr(mpiudamen icsa( arta(m ;u1ale ii3iytls2uanvpn(0aexrifctotopt aueol( tetoxr io4optnliet s artr(r ot1olto i3tydlm eluvo;(4 exoxo3tytlpDrluvs t seur(r3iy1lleelieil()a2ururo;u0teeomf3tydfm rmu p ()aetnxf ia1la r nvols0srumiopiy1altemivi t  rtmxroou4tlt  feiadlaDeaumpnt4texrxo3totom rluei;s trxoio oudll nlivi tfartmu pnu1opxomieild a2rmnvs (4tetriocio1fpt aneol(0tetoxrpnu4apt lfcs t)arra( pnt4opt  o3iad a emu p;u4 rxoxo ootlmtrli o;(  2um(r ou1al emicsat arra(m ot0olto ieiat m2rauvp;()tetrmo3oytoatrau o ()texm(o3nydoltnmicil(faDuau  ;o0tltoiieild mDeanvp;t0artnio tatomtr uvo;s srumxr3nu4ame lfctas)aDumxro;o1tlenmoeiytlm2emump;t)treoir tydlatr u slt)trurxo iy4lm nmict sf 2tmxr oo1oetoifciat aDrmuvs;(0aetrmf iadlp r n sls)s2trxr oo1lpt  fei () 2ta(ronu1olxnmf3iatfm ra( o t) exoxf3tatlmD aivsl(0t2xrir oy4lptnmfetl(  2tmurpno4tlxn fctad s ulump;(4 exnxr3ootomt anei t  eto(o3oo4apte ncias)artru pot1oleoifciyd a um( p;t) rerir3tytfm r nvs;( teuoxo3nu1optn nesltf 2rmxrooo1tpto oeilsls2umuvsnt0tlxoir ia1omD lu o s setm(r oydamt mieilt) 2rmxm no0tle iicildla2ulums;u) etomr iytlpt anei s)trtm(r3iu4openmies sf Dumurpno1tpxo iciasla emu on(0 lxnmo3ootlm   nesls)s2ur(rpoudlpen net ( a2rm(m ;o0tpxnmoeiatla uan s u0texnxf oodlp  lies;t0 2toxr nudlme mfviatfa2urx  oo1apen ieiyslm elnvpnu0trxrxocoy1op e ies (0trtmim3nu4ope  ivtatfsDta(mo;t1oeen feiatlmDumnvo u4altrir todopte uei s)t2tr(o3oo4ole lnvtas)artrxr ;o4texoioeiysfm2rmums;u) ltnxf oatfa rlies ()teur(m3iodol e ieil() ruaxmono4ole ifciytfs2um(msnu) eenmr iytlpD lueo t0srtmim oydol  lfcs t a2uaxm ;u4oeenmi3iyt a ran pn()tetnmocio1fptr uesls)s2xrio iu1alenlnei ()a2tr(ronu4tpxoifeiysfmDran pnu)tetomf ootfa elnvo;t srtmirpny1lme  ivsl(fsrururpot0olen fciadfm2emu o;t0trenmr tydfaDeaies ( truoxopoy4llenlfeils)srurumonu0ope mi3tlslm ulumo (0alxnmf3io1fpDrluvs t  exrio3nu4opee ivil(  rrm(  no4oexnioetltla2rm(vo t) rtrifcta1fa r ieo t) 2urimpoo4ap nmnvsatf Drax pnt1tleo fctadla elu snu)arermo oatlmDrln s (0 exoxr io1ope mivsa(fsruaurp;t0opxnmi3tysfm2rauvs t0 rxomr3totopDeaiei ()srxmim3io4lm emfvtas aDua(m ou4tpxn f3iyslaDra(vp;()tlxrxo3ootfatrli s t0sruoxo3iu4ll   ici sfsDuru  ;o1olt  ociydls elnmo;u) exnxo3totla r nvols)s2umxr3oudal emnvs t) 2taxrpnu0tee mo3iyd s2rmu o;() renmf tydfaDr uvs t  rxm(mpno1om emfci tfsDua(r ;t4oeeoifeild mDumnmo t)trtnir3io1fp   u i s0texoxo3iy1om  mictatfs2trumpnu0aetoioetatfaDelump;u0 rtnxf tatfpD ln sl( seurxm3oudll e fct s)aDra(  oo1oltn ietyt a ra(mo;t4tetrxr3iadfm e ivi s s2xoxopoudlme mivs ()sDtrxm no4apx  f3tltfa el(mo u4 ltrmf3tydop eaivo;t) rto(o3oudom nmnvia()s2tm(mooo0olt mf3iat a2umnvonu4 rxnifcoytlmDelnvo t) eurimpoodol n nviat)sruaumoou0apto ictaslmDum(ms t0 lxrio oa1lateluesl( trtrxm oo4ope mnetat)sDrmxm nu1tle mo3iysla umump t)aetnmf tadfpD  uvi t0 2urio3ou4omtn fetl() Dua(r nt4olenioetadfa rm( s ()texnio3iadopDeaneo (  eurir3nudll nlneslt  2ur(rpot0aetomo3iyt aDea( o u)trerxr oatlateai o;t)tetm(mpio1am  mneslsfsDrm( ono1oexnmieilt m emn o (4altoxfctodopDe ieols  rtmxo iu4omt lfcta()sDrru p;o0oeenmo3tys m rl( p;t0alxrmoctatfp eluvol(  rxoxopiydll   iesl()aDtax p;t4alxnmoeildls emums u)trenmo tatlatelnvils0sexmxm oodalt  nesltfsruru  nt4apx mo3iyd a2rmn sn() lenif3iotop  anei;t0s2xmir oo4altnmfctlt)s2umu  ot0oex  iciat m ean ont0 ltnio3oo1fpDeli o;( s2xmxm3oy1om n ieias a2ra(mo;o1tetomo3iat a2ra(mp;t)tltnxrcty1om eaivo s0 exrirpiy1ll e iei ()artr( p;o0oltoio3iys m2uluvo t0tltoxoctotlateaueo s0t2urio iydapt lictasfsDtaxm oo1opx iieiyd a rm(mpnt4tetnxfctotopD aivo t t2xoxr3oodomenmneslt)aDtaxr ;o1tpe moeiadfs uluvo u)trenxr3oodfpDean s t tetmio nydole mfvsl(f 2trx p;o1aet  f3tatlaDrlu ont0teeomfctydop r nvs;s  2xo(r3oodom n nes s)srur(rp;u4tle iocils m2um(mo;t4aexoxr iy1lp ran il(0truoxr iydll e ivt ( sDrrum ot0oetnio3tls a2rmuvpn(4texoio3io1op rlnvi;t s2urir3oydomtn ici sfsrumxrpou1aetnifetytls2eln onu0teeomocoydla rluvs t0s2xr(rpiy4lltemfcsl(fsrrrum ;t4olt ifetls sDemumo (0teenxf iytfpDrai ils tetrim oo4omenmfctat)s2tax p;o0tpxniictld m rln s;t) lenxo oatfm rlu o;(  euo(m3ou1llt mneilt) Dtaur ou4opxnmfciatlsDelnms;u) rtnio oatfm r ueilt0sexr(m ou4om  livta(fa2um(rpoo1aee  o3iat m uluvp;() rxnmr todlm rlivs;t)seuo(mpou4lltemnvsasf rtmx pnt0oltoio3iys s2emuvo t0alxoxo3oydom rauvol(  etrxmpiu4opte fvslt)s2rr( pnu4aleo i3taslaDra(vo;u)trtnmr iotoa e ieo s0setrxo iy1llen fvtlsfs2tm( pou1aptoiieiatla uan o;u) eermo ootlmteln ols t2tr(r3iu4llenmnct (f rrrumont1tpt mf3tas m ra( p (4 lxnif oatlm  aivs;t0 rtm(opny1lm  mfesasf Dtaxr nu1olxn fciyd sDrl( s;t0arxnifciy1latrln s;( texoxr3oo1lmt licsls  rrmurp;o4alt  ieiysfmDuln o u)texrxfciatom raues (0teurxo3ou1ap nlics s) rtmumono4tpxoii3ias mDeanms (0aexoxo oatfat luesl(0 rtmirpnu1lpt lnvtat)sDrr(rono4oexoifciyt m2ulnvsnt) lxoxfcoo1lm   n i t)trxr(o iudlp  mncs s artaxr nu4oetnio3tldfaDuanvs;()arenxfctotomt ai s t) rtmxmpoy1lmtn nctlsfarrmx oou1opxoiieiasfs rauvs u0tlenmf oy1faDelnvo t0sruoxr ou1amtemietlt) rtmx pou0tlen fetld sDul(ms ()aeeoxfcia1lpD  u i;(0seum(o ou4lp elnes s srtmxmo;u1opxnifctltfmDuanvpnt) renxocia1fpD lneo s truoxo3oodaleemivt sf 2rmurp;u1opxoifetytlmDua( pn() ltomocty1oat auvo t teuo(m ny1am elnvtatf rrmumo;o1oexn o3iydls2umums t0tltomo3iotfp e uvs ()s2trxr3oydoltn fetlsfs2rrxmo;t0apx  f3iysls ua(vp u) rxnxo3totla eai i;()srxrxm oy1lpe  fvsl(fa2rruroou1alto icilt m rmu on(0 rermo totomtelu sls0srxoirpoydamtnmivil(  Durx o;u0tpxomoeiyt sDum(msnt4tltnir3iydfa eaneslt0trxr(opnydalt lietasf ruaxmpou1aetoifeiltfs em(monu4aetnxf tatfaDe n s;(0 2xoim ou1llt  fvt t  Dtmu ooo1olt ioeiytfm2ulnmp (4 rermf iatlm ean i;(0texr(o3ny4alenlicsas sDrauronu1olx iiciydfmDrm(mpnt)alxnio3tytlmD li ils0 2trim oo4openmfei sfa2tr(ro;t1tpenmfetytfaDrau s ()alermf3iotom ean s t0trtoxrpnydol emfesatf rrr(ront0oetn f3iytlm2rl( s;u)trenmrctydfaD lnvi;t srtmxo3ny4olt lieta() 2um(rpou0opt ioeilt sDua(vo;(0trxrmf tatlp elueilt  exrim io1ap nmneil()srraumono1tlxoif3iadfmDuan p u)treoifctadlaD livil(0teuo(opoudoptnmfet sf 2tmx poo4apxo f3iasfa2emnvon(4alenif tatfaDe nes t0texm(m3oy1aptelnvsltf Drrx o;o0aet io3taslm2rmnvp (0tltrmr todfatran o;s s2uo(r3no1altemncs s) rtaxmpoo1oex mo3tltfsDem(vs;()aetnmocio1lptranvo;t0 2urxmpnu1apenmnesasfsDrmu  ;t4oex  ociasfsDrm(mpnu4 rxnmr3oodfmDr n slt tetmir3oy1ope  nci ( a2taxr ;o1aptomoeiltlmDum(vo u0altnifctatlmt lnvo;s)s2uo(o iy4oleemncia(faruaurp;o0tleoioeiltfaDuauvpnu4 etnxf iotomDraies s)srxr(opno4omeemieils a2tax pnt4apenmoetlsfa emnvo;()trtrxrcoatfaDelies t0trtr(o iu4ll  mnctlt)a2ra(r ;o0ape iieilt sDrmnmp (0texoxfcty1om e neo s0sexm(r3iu4aptnmies t) 2umx pnt4aptoio3iatfm emn on(4 lxnif3tytlaDelu o t0teuoxr io4omenmfvi s)aDua(  oo4ope  o3ildlsDemuvp;u4alenxf3iodfpte uesls) rxrxm iydlptnmieia()srumxr nu4tleo ociytfm2rl(vont0texrif oy1oatrlieil(0 2xrxrpiodameelfcsatfsDtaurono4oeenmfciysfa2rl(vs;u)arermo3iy1om raues;t) rtmxm3nudlm elivias  2ta(r ot0apenif3iyt a2ua(mo;t0 etrio3oo1oatelneils  rxoir oo4llenlfcilsfaDra(m ot4olx micildfa2umu s;t0texrxr3iadoaD lues s truoio iodoleelnvs tf Durumpnt0tpx mi3iys s2eluvo;t)trxrmo oy1faDeauvsl() eurxr io4lp elies (f 2ururpnu4opxo oeiltfa uan s;u0tleomr3ty1fp rluei ( t2tmim io4aptnlici t)sDurumpno1ope mo3ias a umuvs ()trtnmf oo1oa  aiesls t2xr(r3iu4am   ncs ()sDrrxrono1opt  fetytla rauvon(4tetoifctodfaDeaieil(0srumxopny1ll emnciltfarrrxront4tltomi3iadlaDua( on() exrircto1lmt ai i;t  exmimpny4lp e ieiat sruau p;o0open feils aDrmump u)tetnirctotfm raneo;() exo(m oo4op   nvsl( aDrm(  nt4optomoctls s el(ms;u) ltrxo3oydlmteln ilt0t2xoiopnydame livtls)srumur oo1altoii3tyd mDrlu pnu0 rermr3oytfptrlnvsl()s2xrimpoo1amtelfvtat)aDuaumono1oexoioctls mDeanmonu0alenio iytla eli o;s texmim no4lptnlfeil()aDta(rpno4optoif3ilsfa2umn s;(0aeeoircoatoate i s (  rurxm3nu1apt  ietltf rtm(ro;o4oltomoetlsls2ul(vo;t)tetnifciytlm  lnvil()srxo(opiu1oltn fvs s) Dua(mp;u1tetniiciyt sDum( snt) leomo totfateaneslt)s2umir3nudolt miet s) Dtr(m ;o4tltomi3iysla2rmn s;() ltrmociotoaDe ivo;t)seto(m3nydlp e nctl(fs2um( o;t1tpenii3iytlm el( s;u0arxrmf iadfp  luei;t  etm(mpiydale  fct tfarumxmooo4tpxnmoeiad sDel( p t0 etrir oodfp  aiei t  rxo(r3nydlpenlnes s s2rmx pou4aetn f3ilsfm ranmsn(4trxnmo3iy1lat aivs t srumir io4omtnmnesls)aDtaxmpoo1tpeoio3iatls2rm( snu4areoif3oodfa  aiei;( srumiopiudll elfei s) rtmx ont4olxo oeiys sDuaumo;u4 lerxocoo1lpD aivsl()texmxrpny1ll nlfcta( a2tmxm ;t0olt ii3ils a2ea(mon(4arxnmfcootla ean ols)t2xrimpiodome lfvi (f rumu  oo4oet mfetas m2ul(mo;u4aleoio3oydfa r uvs s seuo(mpoydomeemfci s  Dumu  nt4apt miciatla rmu p;u0 lerir3iytopteauesls s2uo(mpny1om emnci s)sruaurono4ope iociytfm um( onu)artnif3oo1fmD livs s) rtoim iodoleelfetat srrm(rpnt1oexniociydls um( s t)trerxf3oo1om rai o s  etm(r iodamt  nci t)srta(mo;o4aleoiietltfsDran p;t0 rtomrcto1omD  nvsl(0 exmxo iu4lpee netasf rum(rooo4tpxnmfciadls2ran o u)aeermociadlmt ln olt s2xm(opoy4ap  lnet s a2tr( oou0tetnmieils aDumnmp;(4tlerxrcoo1fmt ai slt)trxmxrpiu4ale  ivi (faDtmxm nu4tle moctls aDemuvo t4 etrxf3ty1fm e ieo;()t2xoxo ou4ol n nctl( aruax p;o0tpxnmo3iys aDeluvp t) lenxo3ootfpDeau s t)teuo(r iy4lltelici ()aDtr(ro;t1tpxnmi3ilslm el( ont4aleomrcootopteliesl(0seur(m iydopenlietas)arrmu o;t4tetn feiltlmDelu s;() etomf3ootfaDe i o;s)srtmir3nodop nmfct (f Drax ooo0olenii3ilt m2emuvs;u)tltniocty1omteaneil()trtoiopiu4ame  fvtas s2uaurono4texoii3tydfa em(von() lenxf3iatopDr ies;() rtr(o3no1al  mfvi tf 2rm(ronu0tee  oetlt s umnvs t4 eenxfcia1lpteanei;(0srtm(rpiudlmtn nvias a2ua(rono1tlenmi3iat aDrl(vo;u)teeoircoytoptelivi ()t2xrxmpiy4ll e feils srur(  nu4olxoifeiysfmDemnmp;t4arxoir io1fm eaueo;()srum(r no1omtelnvtas sDurumont0tlxoio3iltfsDum(ms;t) rxrxfctatlm e iei;(  rxm(o3oo4ol emncil(faDuaxm nu4ape  o3ilsfs2elu o (0altrxf iotoat auvs t seuoim3iodllte nvsat)sDtrx  ou1texnifetasls emuvo;u)texrxr3oo1latelneo;t0 etmim3iy4omtemfvtat) 2umx  ;t1olto ociatlm2umnvo;u4trxnmf3oytfpD lieil() exo(mpoodll  mici tf Drmxrono4tpen fcilslmDel(mpnu0tlxrmo3iodlm  anvil(0 rumxmpoydlm nmivs (faruaum nu1tpe  i3ils a2rmuvs u0texrir ootop rlivi s  rxmim iy4ap  lfvta() 2trx  ou1olx  o3iltfm2ra( o;t4trxnxr3totfpteaueo;s0setoio oydomtelnes t s2rmx pno0tlt iiciatlm umums (4trtnir oo1laD  ivi;t  rtmxmpio4lpe micta( sDua(ronu4optn feildfmDranmp u4tetnif iytfpteanvo s0tetoxrpiy4am nmncsas srtr(mpnt0tlt miciatfa2umuvp;u4 lerxfctotoaDr ueo;s t2xoxrpou1opte fvilt)aDumxm nt0olx mfeiysfaDemnms;t) rxomo3ia1laDelnvs t) 2triopny4ll  mfvia( s2rmu  ;u1apxomoetysfm rm(vs;t0 lxnxo3tydomD  uvo;(0t2urxo3iu4ap elnctl(f 2rru  ;u0olx io3tadls elnvp;(4tetomf iotoateauei t)trtmxr iy1op elfes sf rta(m ;t4aeen ociadlmDrmumo ()aeerxfcto1om raneo;t) rtoxo3oo1olenlnes sfsrtrxm nt0tpxoii3ias m rlnms (4 lxoirctytoa eanvsl() rumiopno1altnlfet (fsDtmx p;u1tlenii3tlsfaDelnmo;t4aexomo iadopte ieilt0s2um(opiudameemfcia(f 2ra(r ou0aptomi3tytlm2uanmp;t0altrmr3oo1faDeluvolt)s2toxm io4lltemneiat) 2tr(r nu4oee  i3iasfs emnvp;(0 etoirctodopDe nei;t sruo(o3iodllee ivs t aDtmumo;u0apt  ietatlmDrlnmont)trxoxrcoatlptean ilt  2xrir iu1omt mncsltfaDumu oot4tltnif3ildla em( onu)trenxf oo1latrai i t0s2tmimpiy1lmt mnesas) 2rau o;o0olen o3tad m um(vp u0 ltnif3totlmDran olt0srtoxopnudalte nvilt  2umxrp;t1aet mo3iys a2emuvo t0aleomf3to1laDr nvslt)seto(opno1lltemnes tf Dta(  ot1opxn ietldfs2eluvo;(0trtnmf ia1fptr nvi;t0trxmxm io4omteliesls s2rrx oot0apx iicils m ran s t) etrir tydfptelnvo s srurxopiy1ol emivt t arua(mpnt4oexnifeiasfm2umn p u0tlxomfcto1lmtean il(0t2uoir nodalee icta(  Dumx  nt4aexo ieiad s2ranmsnu4 eenmr3tytomDrluesl() eumxrpnu4ll n nes (fa2ta(monu1alt  iciytls rmu s;u4trtrxocoatla e u sls0trxoimpoodamtn ivtlt) Dtru pnt4olt moeiatfs el(vp;u) eenxf3iytfmtelivi s  exm(r3iodllenlfcsl(f Dta(mp;o0aee  oeiadfmDra( snu0trxrircootomt  i o;(0 exrir3iy4ap  mies ()artm(rono0oleomfctltlsDran ont)altnifciytlate n ol()srtr(rpoo1op nmfeta( a2rax pnu0teen ocildla2elu s;t4trenmfcio1oa rlnvo;t srxrxmpou1ole  nctat sDrmx pou4opxomiciad mDea( s () lxrmf oytfmt aivs;s)sexrio3iy4lp n nvils) 2rm( o;t4aeeo i3ils mDrau p;u) lenmfctotlm   neslt0trxmxr3nydameeliesat) Duaur ;u1openio3iadlsDuauvo;()arxrmfcia1lpDrlnvils  2uo(o nudlpe  fcs ( aDua(  ;o1aptomicildfm rm( pnt) rtnmf3to1omtranes (0sexriopoydoltemnvtls)s2ra(mpot0texn icilt a eanvs;u)trtnir oodfm r u sl() rxrio3iudol  lncsat aDrrum ou1tltnmoctytlm rluvs;(0tlerircoatoaDe i i;t0 2tr(opoy1ol  lfct t  2ra(roou0tpenio3iad s2uau snt) lenxrctydfaDe i i;t0srxoxr iu1lmtemncias) 2umu  no4tlx mfeiaslm rau o;(4artrif ty1oaD lies s0s2urxr ou4optnmncil() 2trxr oo1oetomfcild m2eanmo;(4tetoxrcia1fpD lnvilt)setrxopio1opt  fcilsf Dtrum ;t4tpt iociad sDul( o;t0tleomf iodlmDr uvi;s)teur(r3oy1amtnlfvs tf 2ta(mpou0ole  i3iad s2ranmo;u4 rxoxr3iadfmteauvi;s)setmio3ny1op nmnet tfartmx ono4oleoioctat m2uaums;t0tlxnif3tytomD  nvs;( trxr(m oodlp  mfvsl()aruaxm nt1aexo ociydlmDra(vpn(0tleriociodfmt lu o;s0s2xoimpiydole lfesas) Dtau ont0tlto fciysfm2uau p u0aetrmo tadfm rli s ()s2ur(rpnudam e icslt)artru  ot4tpe mociaslm raump u0 lerxf3ootla e uvi t0setmio3nudllt liesat a2tmxroot4ale mfeiaslmDumnmo (4tltrmrcto1fat luei;s  eurxo3ou4ol e fct tf Dur(m ;t1tltomiciasfm elumo u4arxrxr oo1lm e i s s0 rxoirpoo4ape  iei ( arrr(rpno0alen ocildla uau pn()tlxrmf3oatfpt aieol( srtm(r3iu4apen nvilt aDtmu o;o4olenmo3iad m rlnmo;t0tltoif iy1lm r nes;(  rxoxm3oydam nmivtat)s2rrx oot4opeomo3ils mDelnvont)areoxo3iydlatr neo s sexoxo oy4op nlivsls aDumurpno0tlxomictydlmDemn p;u)arermr ta1fm rlu il(0t2toxo ny4opt lieias) 2raxmooo4oltomiciyt a uanmp t0 lxnirctatop r ues (0t2trxm3nydoptn nctl( aDtmu  ou1teen i3iad m2emumonu0teenmr ia1op   ivi;t0teuoir3nu4ap nlfvs s) Dumu  nu1tpxo oetyd a2eauvo u4texrir tatlp ran o s0t2xo(opiy4apt  ieia(faDurxr ot0apeo ocilsfm em(vo;t4 ltrmo3tydomDeaies s)sexr(o iy1al elici t)aDtm(roou1tlto fcilsfa2elu s;u0trxrif oodop  aivi;s sexrxopnodomtelfcslt)arrmu p;o0aeenmoetys m el(ms;u0 exoifctatlpD  ivolt0setmim io4am elicsl(f 2ra(rpno4altomieiytla2emuvonu)alxnxo iydlmteln il(0s2xoim oydom e iei sfsrurxrpot4tpx ifciys s2el(mo;() eeoxo3todlpt lieo;s) 2tm(mpiy4amtn ivilsf 2urur ;o4oltnmfetasfa2rmumo;t)trxoiocta1oat au il( teumxmpoo1am  miet ()s2um(ro;u1tex  iciysfaDrm(mo (0tltriociydlmtrli ils)sexmxm3oodaltelfvilsf 2tru  ou0aeeo oetysfmDeau ont0 renxo3tydlaD  iei s0t2tm(mpoy4om elnvtas)s2ra(  no1tet mocils m um(vo;t)aleomo3iadla raieslt)t2toio nudolteliet t)aDtaxmo;u4tpxoii3iad s rm(vpnu)artomocty1opDe ues ( srtmxr oudlp  livt t  Drrx pou1oet mo3tytfa em( sn(4 ltrxocoatfmDrlnvi t0teurxrpiodllt mivsl(faDtaxmpno1opto icild m2ranvo;(0 rtrir3to1opt  ieslt s2trir3ny1omeemneia( srtmu pnt0tlt ifciytls2ra( ont4tetrxr oy1lpDean o () 2xo(opno4amtn ictls) Dtaum ou1tpe mo3ilslm2raumo u0 eenir iatlmt lnvi ()t2um(opno4aptnlfvta(f rrrumo;o1tex mieiytlm ea(vo ()teenxociydomtraivi t)s2tr(mpiodllee nvslt arrm(rpno4oexo fetat mDrmnvs;u) etnir ootopD  ies t  rxmxm3oodomenmnvil( sDtr( pnt1tpt  i3iad m2emump (0trtnxo3totlat  nvo s s2urxopoo4am elnvs sfsrtaumpnu4apxomiciatlmDulnvpn()aeerxf3oy1laD ai s t0 etoxo nudomenlnvi s)aDumxrpot0oeenif3tls a umu p;u0trerif3tadomt  u ilt)s2ur(opnudllen fvi t srraxr oo4openiieildfsDrmu p (4artrmo3tadomt  u o ()texo(mpno1oleemies tfarum(m ot1aet io3iatfa2ra(msn(0 rxrxf3to1fp r iei;t s2tm(m iudopte fcilt)srururooo4tpe mieiltla rmnvo;t4 etnio iodopDe nvi t trxr(r3oudomee neilt srum( o;o4opxomf3tld m2ra(mp;()texoxf3io1lat lnes s s2ur(o3nodaptnmfvilt s2rrxm no1olxnmo3tat mDrm(mo u)texoxf3todlatrai o;t0t2umxm3nydal   nes tfsDur(mpou4altnio3iyd a uanvs t)trtrmf ty1lmDeli i s setoxo oodameemietlsf 2urx ono4opeo o3iydls ua(vp ()trxrmf3to1optelnvs;s)teum(r no1ap   nvs ( arrrxm ;u4aptn ocildfmDrln s;u0teerir tadlpt  iesl() rtmirpny4lpe mnctl(  rtaxmp;o1teeomfeiytfm emnvont0tlxomo3oatopDr i slt0 rxrxmpno4amtelfetl()s2tmxmono1olt ioeiydls2ea( s;t) etrxr iy1oaDelieil(  2tmxr3iodlpe lncsls) rtrxront4teeoif3tytls2ranvsnt0 reoxf3ia1lmDe ivo t0 2umir io1ale mnvsat)aDtrxroot1tlxnioetlt a2rln s u0 reoxr3oadopteli s;(  rxrir3ny1ll elfvsat)aDua(r nt4oex moetldfa2uauvs (4 rxnxo3iytfmDr uvi t0srxo(r3iu1am e fetlsfartax pnu0oleo feiysfs2uluvpnu4alxnirciadomDr i s t srtrxopny1ape  ict s)s2rrxrono4oetoioetyd sDrmu o u0areoif tatlp r nvi t s2tmirpoydamtnmfet tfaDua(mp;o4aeenifciysfs elnvs u4alenmocootfp r nei;()truo(r3oodopenlnes sfsDumx  nu1aptoio3iydls2ul(vs u0trxnxoctydlaDran o;s0 exr(opiudal  lict sf Drmur no4altomoetydfsDemu p;(4 rtnioctotfpD aieol(0 rto(mpiu4lm e nes ()srtmum ;u1tlxnii3iatfaDum(mpnu)tltrxf iodfptrlivo;s0 rumim io1lpt  ictatfsrtaum nt0texnmi3tytfa2ulnmo u4 exnif tydop  anvsls teur(o3nudalt lfciatf 2rru oou0texomfeiytlm2um(msnt4tltrxf io1lateli i t  exo(opoydomeemict sf rtrxr ot4opxomfeiytlmDul(ms u)texoxocoo1op rlivo () 2trio3ny4opt  ivi ()srtaxrpot4opx iiciydfa2eln p;u0alxoircoytom  au o t)srtmio no1lmeemnesls) Dumu  ot4open i3ilsfs ulu snu0areomr iodopteaiei;t)t2toio3iydalee fvtasf Dra(r nt0aeeo fctat aDemu pnu)aeerxf oadoptelivols teumiopio1olt  fvsasfs2rrxr oo1apen ociltfa2umuvo ()trenmo iatlmt anvo s0s2trxo ny1openmfvs ( sDururpoo1aetomoctatls umnmp;u0 etnxfctotlptrlneil(0tetrio3iydolenlfcsat)arrm(  no1olenio3iatfm rau ont0 leomfciatlm   iesl( srtoir3iy4am n nvtat  rtmxmo;t4olxniieilslsDelu pnt4arxrmrciadomDrln sls srxr(r nudomtnlnvtls)s2rm(rpnt4alt ioetysfm rlumo () rtrxrctytoat aieolt0 etmirpoo1lmt mivi t)aDrm( ooo0olen o3iadfs2ea( o;t4arxrxf iadfa eai ilt)seurio oudapenlfviat  Drmx  nu0aetnmi3tld aDelumsnu4arxrirctytoaD lieols trxoiopnudape mncs () 2rrum oo0oeeo octldfm2umn p u4alerio3iodopt  ueols)s2xoir oo1apen fctasfaDrau  ;o0tlxomfeiltlmDrlu p;u0tlxrxo oadop rlnes (  eto(r3oydlme mfei t)s2ra(r ;t0olt ioeilsfsDrmu sn()aeerif3iydlm eanes s)trur(r3iodlp e ncs s srtmxm no0optoiociydlm2um(vo (0alxoxo tadlatean o (  exr(rpoy4opt lfci (farrr(r nt1oee  feiysfa2elnvsn(0teenif3to1omD livs s srxoim3iu4omt lnvi ()srraxr ot0tpt ioeiyd s eanvo;u)trtrmocoo1oate uvi;t  rxoxm3oy1ap  lfvilsf 2uauront4tltoiictas s eau sn(0aetoio3oodoaD aivs s) exrir oo1lpt lfei tfa2rax oot0opeomfciysfs2ulnms t0 etnio3iy1fa rluei;(0t2tm(m3oydomtemnei s  rrmurpnu4tpxnmietltlm2rl(mp u0tltoio3io1fa elivilt seum(o3ou1aleemfvtls  2uax o;u1opeomfeias aDeluvsn(4 etrxr3ootopt lu i s)s2xo(r3iy1ll  mnvtls artrurono4tpe ii3iyslsDelnms;(4texrmo iytfaDr uvi t0teuo(r oo4ap n fvtl(farumx  ot0oee  i3tat s2um( p;()teerio3oadlmt aneil(  eurxo iydamtnlnvilt) rta(mp;t1oeenifetld a el( snu4alerirctotlpDeaues;s0t2toxm3nodaptnmici s sDta(ro;t1aptnifciadlm2ean s;()trtnmf3iatlmDe uvslt  ruoirpoy1llt  nctas)s2taur no0tleomi3iysla2el(mo u)arermrciytoaDrli o;s0t2toxm3iy4apte fvsltfarra(m ;u4texn i3ils sDrlnvp t0 rxoio oo1oa eln ols t2xmiopnudal  liet t artmurpoo1oet ifctyslmDum(mo;(0aeeomr oytoaD  u i;t0t2xmxm oy1olee fvta( arumxm ;o4aee  oeiad aDel(vs (4alerif3iodoa e uvil(  etm(opiodal nmietl( aDra(rpnu1tee ifeildlm eanmon(0aeermo3oa1fmtrauei;s  ruo(rpno1op n neslt)s2raxrooo4tlenmieildfmDrau snu0aetnmo iydoat li slt0 rtr(rpoudlmtn ncs s artr(mp;o1tpeomietydla rmnmont0aexnir todoptrluvs;(0 2toim ny1lpte fesas)a2umu  ;u1oeenmf3iat s2rauvs ()artoxrcta1lm ean ol( t2toio ny1apt mnes s a2rau poo0aet  oeildls ea(vp;u)artomr iotfpte ueils0 etmim iydoleemfvtls aDrax onu4olxomfciltls2el(mo t4tltomoctadlptr n i (0t2umxr3iu4am   iesltfsrur(rono0oeeo ociytfa2ra(monu4treoiocoytomD au ol()teurxr nu1lpeelfci t arra( p;u4opeomi3iat a2emu snt)tetnxr totfp   i sl( srxoxm iodom elieiatfa2taxrp;o1alxnmiciysfm2elnmpnu0treoif oadopt  nvi s s2tm(opoo1ll e icilt) 2rrxr ou0tle moeiatfs umu o;u4 lxrxr3ootom  anvil()s2xoxo3ou4opeelfcs t  rrm(mont4tpt miciat a el(mp;t0trtnmr3tytlaD ln o;t  2uoxo3no4lptn fes s)aDtmx  nt1oexnifctyd m2emn on(4 lermo3oodfmteanvs s)s2xo(o3iydal n nvilt srtrxrpoo1tpto o3tltlm rmnmsnu0 exrifcto1fp rliei ()teumxm
\ No newline at end of file
@@ -0,0 +1 @@
+u s t) 2um(r3no1ol emfeiltf rtrx  nu0opt ioctys s um(vo u0texrmrciytfmtrluvs;s0srurxopiu1amtnmncsls sDra( p;t0tee  iciyd sDranmo u0alxoxf3tytfptr ies;( srum(r no4alee nesls aDtmxm ou0tpt if3iadfm um(vo t)texrxfciatoa r i i (0setm(r iydlltnlnetls)artax oot4tle mictytfs2umuvont0aleomf totlptelivol( trxm(r iodam  mieil()sDtrxmpnu0ale  fctldfs2emn s u0 rxrif tytoat li olt  rxoxr3ny4lltemicsas a2urxm ;u0olxn f3tas a2ua(mp;(0 reomr3iotfpDelu o s) rxoim3no1op  mfvsls) Dtm(mpnu4tpto icias a elnms;(0aeeomo3io1laD aivi s0 rxm(m ou1omee ncs tfs2trx  no4tpxo ieilsfa ran o u4teeomf3ta1lp  aivi ()teumim3ny4lp nlnvsat) Drmxmono1oexo fetldfa2ulump;t4 ltnxo3iatlptrlivilt0 rxo(m3ny4llee fvil()aDtaxmooo4apeomi3iytls rl(vs u) etrmrcoatomDe uvs t)sexmimpny4lmtnmnvilsfartru  ;t1tpx mictldls ulnmp t)aexnxr3iytoa elnvi;s)t2tm(opiudal e ivtlt)a2uau pno4tpx moeiasls2um( s;u4trxnmfciydfaDelues;s t2tmimpnydolen ies t) 2rmx poo1tpe  f3iadfs2umnmonu0trtoifcio1laDraueo s  rto(o3nu4oleelici s  rrmurpnu0oeeomictadfs2el(von(0tetnif3oatfm  ai i s trtriopiy1ame mnvsl( srumur ;t4optn i3ilsfs2uanmpnu)aetnif oydfaDeaieo s  rum(rpno1apt  fvt sf rtaxroot0oee  feils m2emnvsnt) lxrxo3oa1laD livols0t2to(r ou4ap n neta()arrm(mpou0tetnmf3tadfsDeau o (0arxnmr tatfpDeauei;s seuo(opiodale  ivs s sruax  nu0tlto feiatls emnms;u0 reoir3ootlaDe u il( truoim io4ol elnci t srrrxrpoo1oetn fciadfs2rmnmp t0 etrxr3todlmDe nesls0 rurxr ny4alt mfesls sDrrxmonu1opeomoeiadlmDrlump u4trtnif3oodlpDr i ilt)setm(o3nodal elfcs t arurx  ;o1texnmocilt sDel(vpnt0tetrio oytfateaueo;() exm(r oy4llt lict (  rumumpou1opx ii3iysfsDrluvp u4alerxocty1lp raueolt  2xr(o oodam  miet (  2urx  nu4aptomiciadfm2umn pnu4arerif3iatfat li o s0 2uo(mpnudlp e fvias  2umxr nt1olxo i3iatla rlu s;u4alxrxoctytomDean o s)t2tr(o3iu4llenliesa(  2rr( p;o1tee  ietytla emumpnt0 lxoxf todfmt aivi;s)t2xmxopoo4apenmnetls sDum(mpnu1aleoioeiatla2emu on(0 rerio3to1fateaieslt srtmxopiu4ope lnvilt) 2tmumpnt4optnmfciatfaDumuvo t4aexoircio1fp  luvi;s)t2tm(m3no1aleelfciasf 2ur( pnu4opxoiiciatlaDea(vonu)texrxf3oatlaDr ivol()teuo(mpoudaltemncta()srtr(r oo0olto f3iydlm uan ont0aexomo3oadfpt lnesls)setrim no4ll  lfeil(faDrmxroot0aleomf3ilsfaDumnvo;t0altoifcoy1lmDelivil( texoxm nydal nmfetl()a2taurpot1tlxoioeiytlm2rmn pnt4alenmo3oa1oatrlies;t0 exm(rpiy1amenlnesls  2ta(mont1aetoiociad m2rln on() renxfctydfmDeauvolt sexr(mpiy4opt mnvsat)s2umxmont4tpenmf3ilsls uln onu)teenif oa1optr nes t0 2tm(opno4ameelfct s aDurxr ;o4olenmocilslm2ranmo t) eeoxo3to1laD luvi t seumxrpoy4opt  feiltfsDrmxmpot4oleomfctlt s2rm( p;u0trxnir3ta1opDr ivi s trxrxo3ny4lpeelnciatfsDrru o;u4aetnif3ildla emuvs;(4 etomoctotomDrlu s;t t2uoxr ou1aptnlnvs t s2tr(r ou0tpeo iciltfmDuauvp;(0teerxo oadoaDr i s;( t2triopiu1lm nliciasf 2raxmpot4tex iietytfsDuanmont4 rxrif3oy1fp  aneslt  exm(r nydll  lncs ( srrr(m oo1aetomietld a2uauvpnu) rxoifcoy1oatr i o;s)s2xmxmpiodop n fvslsf Dtax  no0tpe ii3ilsfs um( s ()aeenifcoatfaD luvi s0sexrxm3oydom nmivt t) Durxront4alt io3tydfm2ea(vpnu)tltoircoytla  lnvs;(0 eurio ou1om   net sfaDum(rono4aetnifeiaslm rmump u) ltrio3oy1om e nei;t0 rxr(r3oy1lp  mieil( a2rr(rpot1tetn octys s eluvs;u)arenmr iadfa raueo t setrxo iy1ome  fes s)arumumpno0tltnifeilsls2ua(ms t)arxoxfctytlaDr i o ()teum(o oy1om nmivtat) rtaur nu4aet  fciydfs rauvs u) lenirciydlpD  uei;()srumxr nodalee fcil() 2umum nt4oltn feiltlm2rauvo;(0arxnmfctodlmDr ies;t)srxmio ny1alt  fei s) 2uru pot0oexo fctatfa uln on(4trenircoodfm r u i;s t2xm(rpnu1lpenlnvs t)s2ta(mpnt4opx ifciatlmDranmp;t)teermo3ta1oatean ols0srto(o iu4apeemfvi s)arrm( p;u1aeeomf3ilt m rmuvsnt0trtoifciydlaD  neo;s  rtrxo3nudlltelncs t)srtru  nt4opxoifeiasfaDulnms;u0teermrciytlm elivo () 2xmimpiu4al elncs ( a2tm(rpot1tpt mi3ias a eaumon()tetomf tytlpte nvi;()trxo(mpoy1lme mfvt tf 2ururono1aeenmictld aDemuvsn()trermf to1fp ean o;(0 eum(r iu1lp e fcils  Draxm ot4oex  i3ilsfm2ulnmo (4trxoiocio1lm  lu o ()teum(o no4ole mnvs t  rtaur nu4aeeo oetas s2uln onu0 exoxr3to1lm e u o;s  eumiopoo1lp   nesl( sDua( p;t4opxo i3iatfs emnvp;(0 rtrxf oadomt  i o;(0 exr(mpny4ap n ivtlt a2um( oou1oetnmfetad mDemu p;(0trtrir ta1fptran i () exoxr3no1amt mnct ()srum(m ;o0optoifeils mDemums t) eeoxrcta1lp   ues t  exmxo nudop nlnvi t sDumu oot0aleomo3ils a2ean o t) renir3oydoat  uvo ( s2xrxr iu1llte fesat)srraurpou1tltn o3tldls2ra(vsnt4 rtnif tadom  livilt) exm(o iy4opeemfci t s2rmumoou0apeomi3iadls uanvo (0tlenircoodfaDrlu o;()srum(opnu1op nlfcs s a2rmxmo;t0aetnif3ildfa2ranvp;t)tleoxfcoadlp eanvo t srtr(m nudlltnmneslt)aDtr(m oo1aee ioeils m2um(vp;t)tetomf oydla rai o;s  eum(mpiydamtnmietlt s2ur(m nt1aptniocils aDeanmpnt4 eermf3to1oa elneo s srumxo nudopenlnviat  rtrx  no1olx ioeiytfs2uan o u) rxrmf3totlaDr n il(  eumirpnu1olenlfeiltfarumxronu4ope ifeiadfmDulump ()tlxoir tadlmDe uei;t) 2tmxo io1amtnlfvi (faDtmxmo;o0teeomfciadlaDemnvsnu)aeenmf3oadfmDeauvs;t)trxrir iu1lpt mies s)sDua( oot0aptnii3tyt m eluvo;(0 exrxfcoo1fmteai il(  exrir3ny1ome  ivsat  rurxmonu4apx io3tyt m2rmnmp;u0tetrmo oa1omtr i i t  rur(o3oy4omtemiesl( s2rmu onu0opxo icildlmDel(vs;u0 rxnxr ootlptrlnvsls)t2xmiopou1amtnmfvi ()srrau  ;o4apt
\ No newline at end of file
@@ -0,0 +1 @@
+u i;s)t2triopiy1al  lnetltf Drm(rp;t1apt  fetadla em(ms;u0trerio oytfmD aueo;(0trxoxo3iy1al emfetatfarumxmpno4aet ifeiytfm el(ms () eeoio3oodlaDrai i (0 rxoxr3nudlm  mfeia( a2umurpnu0olx io3tasfa2rl(mont4alxrmr3iadomD an i ( t2xmiopny4ameelneia(fsDtmu pno0apt ioetysfm ulnvo t4altnxf3ootlmtelu ol(0 etoirpoy4lmeelieia( sDta(mooo0tpxnmfeiytlm eanvsnt) rtoxociydoptrluvsl(0trtrim3ou1alt lnct ( artax  no1ale ifeiad a uanmp u)tlxrio oo1lmtr nes;t srxr(mpiudaltn fvilt  2tr(mp;t1tleoifeilt m ea(monu0alxrif iytfm  lu sls seto(opoodamee fctat aDtr(m oo4alxo oeils aDumnvont4alermf iytomDrln o s srtmxmpoudam  lfesasfsDururo;u4apt mfeilsls2rl( o u4 rxnmr iytfm elu s () 2uoio iodlleelfeil() 2rm(  ;u1openmociydla eanvo ()tetrxocoo1fa e uvol( srtmxrpnu4apen ncia( arua(mpou1ope  octyd a2umnms t)teenir iotlmtrlnvs t0 2tr(opiy4am elfcsas) 2rruro;o0apeomfctatfmDulnmp;u) eenxr tydfpt aies;t)s2tmxo nodamt lnesas sDur(ro;o0aet ifciytfa elu o t) rxnxrcoo1fmD aivslt seuoiopiodomt miei t arurumo;t1aee micias m em(mp u0 ltnmr oatfmDrlu i;(0 2umim no4ap  mnvsl(  2tmx  ;t4tptnmf3tydlm umnmpnu4aetnmo iodfaDeaiesls seuoiopoy1optelfesas) rtm(r nu0tpeoifciyt aDel(vo;t0 exnxf ty1optraneslt) eumir3no1lmtnmivs t a2ua(mo;u0apx  ictldlaDrlnmp;t) rxnxrcoydopDeaues;t  rtmxr nu1lmen nvia()s2umxrp;t0oleomfciatfs um(mpnu4 leoxrctadfm  ln il( s2xoxo no1aptn fcs ( artr(  nt4olxnio3iatfa el( o;u) lxnxr3oatom  aieo s0setriopno4llt mfcsa(f rrrxrooo0oet miciltlm2eanvo (4 exnifcta1fatrauvsls)teuoxmpnydopte fcsltf Duaum oo4opxnmiciadlsDulumsnu4tlenmocto1fmDe ieo s)t2trim ou4lp elfetas)a2ta(m ;o4aeeoiietad m2em(msn()tlxoif3oa1fp eln o (0 2xrim oy1ll   fct s sDum( o;t1tpeomoeild a elnmo;u4alerir3ta1oa   nvo (0 2tmimpnodlptn ivs ( arrau  ;t1apxnii3iyt sDrlnmo;u4alxnioctodfa eln o () ruoxmpiu1ll n nesa(fs2rm(m no0aet ioctadls emnmp t4aexrxfciodlpD lnvi t  2uoxo ny1ll elnct ( a2tru poo1opt  ietydla uanmsnt)tlxnmf oadlm eli i t)s2xrio nydomenmfcs sfaDtr(ro;o4opxnmieilsfmDuanmpn()tleomr3oatopteaieo;t0srtoio3oudape  nei tfsrrm(m ot0oeto iciytls rau pnu0teenirctotfmtelueo;s t2tr(o3iy4ll  lnet (  2ua( pnt4olx mietlt a ulnmpnu4tetoifctodomt ai i;t)s2ur(o3nodamt mfet tfsDrmu pou0apeomociys aDul(vpn()alxnircoodoat  neol()setrir3oodale lieta() Dtaur ;u0alenif3ildls2ra(mo;t0 eenio iadlpDrau s s)srtoxm iu4lle lnvt t)arrr(  ot0tlen f3iytfs rlnmp;()altriocoytoa  aieo;s teto(o ny1ap elfctatfaDrmurp;u1texnio3tasfa el( p u4tlxrxr totopteauei t0trtoir3iy4amtnlnesls  2rau p;t0opxo feild a2ul(vp;t)aleoir iydlat  neslt  2trir3oo4ol   icsls s2rmu poo0oexo oeiadlsDemnvs;(4aeenmr3tatla r ivi s0trtm(r nydal   fvsat s2uau pnu4alenmfctltfm2uan s;u4trerxf3iy1fpDraneslt0teum(o3ny1am n nes () rua(mpou4alxnioetytlmDem(mpn()altoiocoytlmD lnvo (  2ur(opiy1optemfcta(fsDtmxmpot4tlxo fetysfm ulu o u4 exoxrctotomDeliei;s0s2uoio3oy4apeemncias)sDurxm ;u0tlt  i3iasfm2rl(vo;u4 exoio iotla r u slt)s2toxo iudamenlivsas) Dtaxm oo0aptnif3ilt m2rau p ()arenmf3iytop rai ils  rumxo oo1optelfvtl( aDtaxr ;o0texoio3iytfm2emnvp (4aetnxf3oy1lpDrluvo t t2xrir nu1aptnlivt tf Dtrurpno4aptnmo3tld s uanms;t) leoxfctytlm  au o;s  rxr(r oo1lmt  ict sfartmumpou0alxnmf3ils a eln s t0 rxrif3iydlmDr ivsl(  exoirpoy1ole mies t aDrm( pnt4oee iieiytlm2ul(vo;()treomr3oydfpDr ieo t0t2xrio nudlp  mivtat  2raur ;t0texn iciatlaDrau snt0alxomr iatfp  lueil(0s2ur(rpiodapte ici (fsrrau pno1tltomi3tltlsDrln snu4treoxo3oodopt  i o ()t2tm(opnodom  lncsltfaDtrx poo1altnif3iytfs2rm(ms;t0tetrmociatfm  auvsls0teumxo oy4opeemnctltfarraurpnt1oeeoioeildlmDel( s;(4aeermoctytoa rauvi t0 rurir iu4llen nei t) Dum(r ou4opeo f3ildlaDea(msn(4alxrxr3tadlptr ivo ( tetoimpno1op  mnci t)artrx pnu1tltomictad s ran s u0 eenir3iotoptrliei ( texrxmpnydom emfvtl( aDtrxmpot4optnmictls s rmnmp u0trxnmr3oy1fpD anvi t  2xm(o oudlpt lfvsls  2rmx  ou4tpx  oeildfsDumump (0aexoircto1oa e ueslt0 ruoxopiy4ape  fes t srraumo;t0ape  feilt s rm( ont0 ltoiocoo1op r uvols0 rtmimpiydoltnlfvt () Dum(mo;u4tetniietatlaDeau p;()texoif oydfmDeln i;t0 rxm(r oydlmeemfct t)a2rrxm ;t1olxnmf3iydlmDulu p;t0 etnir3iodlpD anes;s s2urxrpiy1lltnmnetlt) Dra(mp;t1aptnmoeild sDem(vsn(4 reoiociodoa  lieo t t2ur(m iy1omte iesatf Dtaxr oo1tpxomoctytfaDemuvo;t0artomr3iy1omte ivslt sexr(r nu4omtnmict (f rrrum ;u4oleoii3iasfaDran on(0 exnmf3oo1fa r ivs;() rurirpno1lp nlfcil(f rta( ooo4alenif3iadla2umump u0 rtoio3oydoa rlues;s0t2xmxo oy1lp nmieil() 2trxmpnu4apt mf3iat mDumuvo;(0 rtrxfciodoateaues;s  rtrxo io1omtn nciltf Dur(m ot0texnifcilsfs ea(vs t0altnmf iotop e nei s0 2uoir io1al e ivsltfa2raxrpoo4apt ii3taslmDea(von(4aeenxo oa1fa  auvi;s)srurir3oydomte netlt) rtrum ou0tet mfeiysls uanvs (0 lermrciotla eaiei ()trtrim ou4ll nlivi (fa2rmxmo;t4alx io3iasls em(vo () ltnmrcootlp ean s t) euo(mpnu4op e fvs s)arrr(r ;o4opeoio3iasla em(mp u) ltnxr iydlmDr nvs (  eurirpnu1omenlnetasf 2ua(rp;t0opt mfciltfaDeauvo;t)tlxnmfctotfpte n i;s)t2xmxo3iu4omen fcilt)s2um(rpoo1oleo octaslsDeanvo;t0tetomfciy1lp   nvols) rtr(o oy4lmtemfvt t) Dtmxm ;o1optnmieilt m ulnvpn(0alxomociotoaD lnes t0t2to(r oodameemfvil(fsrua(m ;u0ope mfeiltfs ua(vo t4texomf3oadlm raiesl(  2um(opou1ll n ncta( sDua(r oo0apt  fctlsfa uan p t4trxrxf3totfaDran sls)s2xr(m3iydop e fcs s  rrmu  nu4aptomi3tldfs ulnvsn(0 lxomo iatom rauvs s0s2um(m iodlle  fetltf rur(rpnt1tleoii3iytfs2eaumpn(0aeeoirctotoa eli s () 2uo(rpnu1am  liet (fsrrm( ooo1oex ifcils s2elumo t0 ltoif oodfptrluvs;t)t2um(o3oudop e fes s arururo;t1aetomoetlslm uan p;u)aleoifctytoat aues;(  2tmxo oudaleemnvs s a2um(mo;u0apt mietadlsDum(vo t4 exrmr3tydlpDr n i (  2urir3nudllt mfeilsf 2um(  ot4tltn ieiatlmDumuvsnu4trtrxr3oa1fpteaueo;(  2xoxm ny1alt miet (f Dtmu oot1alenmieildls2em(ms t4trxomf3ootfptrln i;t) rtr(mpoydlm n iciltf rtm(ronu4tpxoif3iaslmDuanvo u4 lxrxrciodomDe ivo;t0 etm(opiy1lm eliet sfaruaum ;o4aet mictlsla2ran o (4aetomr iodop ran o;()srxoxrpiudlpt  fcsas  Drr(mp;o1tpxomietydla2rmu snu0 lenmr3totfmtrlnesl( t2xoim ny4lptelncilt  Dum(  ;o1texn i3tlsfs2rl( p;t4teenmf oadlaDrai o ()srum(m3nydoltnmieils) 2ra(ro;u0oee ifctld m2rlu p;t0 eermo iadopD auvs;s trxoxr3oo4lmtemfct sfsrrmu  ;u0apeoio3iadfa ean o;t)artoio3oo1oaDean sls)s2xo(m oodom nlivsat) rrr(mp;t1tpx mo3tlt a rluvs;u0 rxomf iytfmDe ueo s s2trxrpiy4altelncta() rta(monu4aexn i3tytls em( snt4 etoxo totom   ieo s)tetmio io1lmtnmnvtls)srua(r ou0teeo ieiytfa2umuvo;(4texnmo totlmDran i;t)t2uoio3nudamee ictl(f 2tm(mp;o1tlxnmi3tysla2emuvo u4artoxo3oodfptrlnvsls0texmxm3oy1alt  ivi t a2raxm nu1oeenioeilt s um(vsnt0tleomocoy1fpt  nvi;s)s2toir io1ol  lfes t) 2tax p;o4olxn f3ilsls rm(vont4alxnif iadfm ran o s tetm(opou1lm n nci tf rumu pnt4aeeo ieiaslmDranmp t0tleoxo oa1fp e uvs s t2xrim oo1amt mnvia(  2um(moou4tpxn ocils a2ranvp;t)arerxo3iadla eauesl(  2toxm oo1lleemnes (  2taxrp;o0tee mfcilslsDemumo u)teenif oodoat livi t0seur(m nodlmee ici ( a2ta( poo1optnmf3tls aDua(vs t4texnxociy1fat  ies;t)tetm(m3nudlpt  ivt ( a2rm(r ;t0tltn feiysfsDeaumsnt0 rtrmociodoat  i s (  euoim oo4amtemietl(fs2rrx ont4apx ioctydfsDrmnvp;u)tlxnxfciatlatr ueslt) 2to(o iu1llt  ivt s) ruaum nu4apt mocilt aDran o t4tltrmfctydlateaivs s0t2um(m iu4ap   iet ( s2rr(mpoo1apxoio3tasls2eln s;t4 eermr tatfpD lieslt)tetoxrpoodamt  netlt  2uru pnu1tpx  ictytfs ulu snt4aeeoxocoadlpDe uvi s0setmio ou1ap  lneia( srua(ro;u0opxo oeiadla2uln s (4 rtoifciodoptr uesls tetr(o nudame  icslsfsDtrx pnt4texn ietadfmDrmnmp (4treoxo3iy1om eli o;t0 etmir oy4oltn fvs ( sDtmumo;u0aptoiieild mDelnvp u0treomf3tydlat an ol(  2trir nydlmenlivt tfa2trx ont4alxnmfeiyslm em( o;(0 exrmrctadlpDeai s;(0 exmio3ou1apt  ivtl( srtau onu4ale iieiyt a uan o;t0tet
\ No newline at end of file
@@ -0,0 +1 @@
+ieslt)trxrio3io4lleelicslt)srtmxmo;t1optomf3tat s2em(vs;()tetrmr3oodop eau i;s) 2xrxm3oodlp nmnctlt a2ta( ont4tex if3tytfa2rlnms t)treoifcta1fmtr u s;t)s2urim3oydlle  nct ()sruaxroot0tlx iicils mDeln pnu0texrxf oytfpDe nvi;t) rur(o3iudolteliesa()aDtm( oot1oexoifeiat aDuluvo;t4arxoio3iodom rlueo (0s2ur(opou1llen fcsl(f Duru poo0aeeomiciytlsDeauvs;u4trtnio tatlm e i ils0 etmxo3iu4alen icils)s2ur(rp;t1oeeomf3ilslmDrl( pnu)aeeomr3tadoat lueo;t  eum(r iodlptelnetlt)sDtruronu0aptomoeiytla2ea( pn()aetrmr io1fmt  iei t  rurio oydlltnmieils artr(rp;o0apxo ictydlmDumuvs t4aeenir3oatlaDr uvslt)setr(opno4lmenmnei sfsDraurpou1tlxnmfeiasfs ran s (0aeeomf iatfpD ln i;( teurirpio1opt mivi s)aDtr( poo0tpxomictlsfs uauvonu0texnxoctodlp elnvo s0 etrxmpiy4omtelfcsa( a2ta(m oo1tlto oeiatla2rmuvs t0tetrxocio1fpDrln sls seto(o3oy1om emfvs t)arrru  nt4opt ii3tlslm rmnmont4aetoxfctydlmD lnei ( t2tmxo3oydam n nctl()sDuaum ;o1olxnio3tasls rl(monu0aexriocoatlm ranes;t seuoio ou4ol nlivil(fsDraur nt0opt moetltfaDua(mont)tleoircta1lm r u o s) ruo(m3iy1ll   nvia( arrr(r ou4tlenif3ils s um(vpn(0arxoxfctytoateluvi;s0t2urio3oy1lpe  ivt s s2rm(rp;o0aetn ieiltfm um(mo;(0treoxo oydlaD lnei s trxoxo3nu4openmfviltfartrxrp;u0olxnio3iatlaDelump;(0texrif3oy1lpDe iesls  2umirpoy4ol e iei (fsrrax  ;o0optn o3tasfsDua(mpnu0aleniocta1opte neo;(  eum(m oy1lmtelici (f 2taurp;u4aptoioeiyt s2umn p t)trtnxf tytfm rln o s s2um(r3oudop nlieil(  Dtrump;t4olxomociad a elnms;t4tlxoxf3iatomDr n s (0trumxmpio1openlnetlt aDumump;t1tpe micildls ran s u0 renxfcoodopDe uvi;s  exo(o3io4om nmicsas)aDur( p;t0tpe  oeias mDrmums t4treoxr iatfm eli o;(0 rtm(rpoo4ale liei (fa2trx p;o4olxoiiciytls2rlump;u0teermfciy1lpt  uvo;t s2umio3oy4ome mietlsfs2urxmpou4oetnif3tatfsDuanms (0teermrcty1op r i slt s2tmir io4lltnlicsl()artrxmp;o1tee iieiytls2ul(von(0tlxrio3iytopDr uvol(  2trxrpou1ll   ivtlt) Dumu onu0tpxn iciatlmDuauvsn(4tleoifcoo1oa rlivslt)t2tmxrpnu1ll elnesa(  rrau p;o0oltomf3iasls ea( p t4tlxrmfcoodfmDe neo;t0trxrxm3no4ameemfvsas aDtm(moou4apxomoeiltfm2umnms t4aexnif3oatfm r nvolt)s2xmir3iy1opee iesl()aDrr( o;t4altnif3iltfa ean s;u4arenxr3ia1faDeau sl() ruoiopnudop nlivsl(  rtmx  ot1opx iocildfsDum(mpn() eermrciy1opDr n o ()texo(rpny4lpe mies s arrr( oot4opx mietys s emnmonu4 eeoxf ty1fmDe i o t trxrxo3io1llt mfvi () rtm(mpoo4opxoiieiytfs2um( snu0arxoio ta1lmDe u i (0 exrxmpnudlm nlnvt s a2urumpou0tlx  fciatlm ua(vs;t0aetrir3ta1oa e u s;t) rto(opou1ape  feta(f rumxm nu1apt mi3tad a2uluvsnu)tlxnmrcoydfaDrli s;t0 exmxm3ny4ap e ivsa(f 2trurp;t1oex  ociadla eanvs;u0treoif3oydfm r i s (0srum(m3ny1omtnmfcs ( arraxro;t0aeto i3tatlmDem( on(0alerir ootoa ean s;(  2tmio oy4aleelfei sf rtr(rpnu0teenmociatfmDrm(vp t4 leomf3iy1lp rau i s)teuo(m oydol emfci (faDurx p;u4tlx micildls emnvont)teeoifcta1la r ueols)setm(r oydll nlfvil( sDrrxrpou4optomoeiad a emn p;t0 exrxocoa1lp elnvs ()trxm(o3oydlmt mnesa()sDtrx onu1alx iictys s2emumsnt)trxnmo3tydfp  liei t0teumir nodlpeemnci s)srumu ono4tet ii3iys a2uluvo t4teenmf oatfp elu ols s2ur(mpnydalt lncsasf rumxmpou0tpxnmoctad sDrlnmpnt4arenmr to1oatrlu sl(0 etrxm3nu4aptnmfcsls) 2tmu oou0aetnmf3tadfm rau p t0 lermocto1fmDr ieo s  eur(o3oy4ope  nvia(f rrru  oo1tlx mf3tyt mDelnmpnt4 leoxo3totfmtr ieo s)trtoxr iodlm nmnvia(farrr( p;o1ape mfctydfmDuan p (4 exrmf3oytfm  ln olt)s2xr(o oudap  micsat)srtr(  nt1altniocilt s eluvp;t) eeoxo oadop e i ol() exrxr3iudlp elfei sfartrumo;o4olenmieiltfm ulnmo ()tltoir3oatfm e iei (  rtoxm3io4ope mietl() 2rr(rono4oee iociltfmDuauvp;t4 ltoxfctatoa   i o;s seuo(r3oodapt  ict t s2rrx  nu1aee mi3tysfm2rln pnu4 reomociy1lmt lu il() exrim3oydlpenmnctlt aDrr(mooo1teenmfeiasls um(vsnt4alxrio ty1opte nei s0trur(o oy4optemfesas srur( p;u1tetnmoetldfa ra(vp;t0 ltnxrcoydlptean sl( texmxr3iu4lp nlivsas a2rm( pnu0tex  ictld s2raumsnt4 ltrmr iytomt an il(0trxr(o ny1ap  micta(f rtrxmpnu4tpx ioeiltfaDul( o u4 reomrctytfptraieil(0 2tmimpoodopt liet s)aDtaur nu1alt miciyt a emnvo u4tlxnmfcoatlpte ueo (0 rtm(m nudlmt mnvs s)sDraumo;t4olt ii3iyd a2ua(vs;u)tlxoxo oadfaDeln ilt) rtmxr3io1ol elfviatfsDtaxro;t4aee moetldlmDuanvpnt4 rtnxo iatla rlnvils  euoxopnodam nlieslt  Drm(ro;o0olxn i3iydfsDelu onu0arxrmo3oydlmDr ies;( setr(o3no4apte fct ( arra(r nt1tlen fciadfa2rauvo;u4trtrif3tytfmDr neo;s t2umir3iy4om emfvtlt  rraur ;o1olen ociat a rluvo;u4alxnir iatlpD lueol(0 exoio no1lmee fvilt a2rr( o;o4aleo ieiyslaDuluvp;t)tlermrcto1op   nvi;s) exmio nu4lm elictl(f 2trxrpnt4optn ieiadfsDel(mpnt0trtnio tytlp rauvils sexr(r3nodomenmfeils) 2um(roou4tpxnifeiys s2uan o t0 etrir3tatlpD  nvs;( texrxr oydam n feiat  rtrxmoot1ale  i3tadfa2ulumo;()tetrxocia1lmDrlu s;t trtmxm3ny1lmtelnct ( srta(rpoo1tltoio3iydfsDrl( p;t) reoif3iatla   ivilt seum(rpou4altnlfvt t  2ua(rpot4apt moeiysfsDrm(monu) reoxrctotomtraues ( sexrxm3no4am n iciltfs2urxmpnu1tee moeilsfa2uaumo;(4arenmo3io1fmtr i s s0t2trxo3oydapt mnvs sfs2rax ont1oexomo3iltlm ua( snu4arermo3ootlp elieo s) etr(m oydlmtnmivtl(faDrr(mo;u4oet mf3iaslm2emnvo (0arxoirctotlpt livs t  2umxo oodlmtemnes t  2um(mpot4oexn ociatfa2rlnmp;u4aeermfctodfmtrau s (  rxr(m io4amtelicil( srtmx  ;o4aleniiciltfm2rl(vsn(0tltnmr tydlat aieilt)t2uoim nu4lpee fctas)s2ua(m no0tpeomfeilsfmDumnvsnt0artrxfcootlp  ln ols) rtoir oy4lptnmnci (f rtr(  ;t4tetnmo3ildfmDulumpn(0 lenmfciatfpt aues;t0s2xr(opno1ape miviat)a2tm(r ou1tlxn ieias mDeaump;(4 rxoxr oadfpD aieo s)trxr(o oodol   nviltfsrrrum ;o0ape ii3ildlmDulnvo u4arenxrcia1lp   ieo;( srxmxm3oudlmee fctlt)arrr( pou1tpxoio3tydfsDranmsnu)areomf3oodlpD  u s;t) rtr(o3oodlp emfeiatf Dra(m oo1alt  i3iydla2em( o ()arxnxo oa1lmte ueslt)seurimpoo4ap n feil(  rrm(rono1oetnmociyd m eln snt4artnmo3oodfmtr uvs ( s2um(rpoydlp e ncia()sDuax oot1apxoioctytfm ulnvp u4artnmrcoadomD aivo;s0 exo(mpiudlpeelfvs ()srrau  ;o4tlenmietlsla2umnvp;u4arermr3tydoat lnvs;s0setm(opiydom n nvta(f 2uaur nu4tpxomfciat s2ra(mo;u)trermf3totomDrauei t)tetoxrpiu4ll emnvtlt  Dumxm oo0aex ii3tldlaDranvs;t0teeoxrctatoa rlueol(0 rxoim3nydomt lneia(fsDtaur no0apx iictldfm2emu p u0 exoxo oodom e nvs;s0sexoxm3oo4apen nciat a2trur oo1alxoifciltfa elnmpnu0 eenxf3oo1oat  u s s0trurirpio4al nmivs t)arururont1oexnio3iytfa2ua( s;t4 lxrif3oadfatr n sl( t2xmxopny4lle  ictat) 2tmumont0oltoio3tltfs uan p;t0artnxo3oytomD li ols0t2xriopou4ome  fvs ( aDtax ooo0tptn i3tysfaDea(vsnt0tlenxr3ty1fp r u o;()teurio3iodalt mfctls srrmx o;o1oexomf3tasla2emnvsnu0artrio iydfpt  ues s t2to(r3iu4lpt mfcsa( sDrmump;t0apx if3iyt a2ua(vpnu0alxrio3oydfmteaueo;( srtoimpio4apeelivilt)sDtmum ;o1aee  ieiltfs2eau p (0 rermo3oo1fpte neils)s2trxr3iydoptelies tfaDtrxr ;t1apto octas m rmuvp u)teermo3oydfp r ivsl(0sexoxm ou4ap e neiasfarrrumont4apeomi3iyt mDua(msn() rxoxr iatlpt luvi t0t2um(opoy1ameelieia() ruauro;o4tex mi3ild sDulumonu)alenif3oy1omD an s t)t2urimpio4am n fvslt) rurxr ot4altoif3tydfsDrlu p;t0trenmfctotfpDrlnvi;s0 etr(rpiudolteliet s a2tmu o;u1tpenifetat aDumu snu0 renxocty1lpDe nvol(0texrirpnu4llt liciatfa2rm(rooo1olto ociydfm2ul(mp (0tltomr to1laD  i sls0srto(o3nu4alt lfetas) Dtr(mp;t0aexnmi3tlsfaDean s u)aetnxo tytfp rau i s setrxmpnydopeemivs t)arua(rpno4opx  ietysfs emu pnu4 lerxrctydlaD aueslt setmirpiydlptnlnvt t arur(m oo0oetomietydfaDuau snu)tlenir3ia1oa  lieolt trtm(mpiy4lm  mfvsatfsDrm(  nt0alxn oetydla2em(vsnu0aetnir oa1lmtrai il( s2toim nu1opee ncsatfa2ururpnu1tlt  fcildfm elnmon(4teenifctatlaD an slt0tetoir3ou4oltn ictls)aDtrum no1aeen icilt sDum(mont) reomoctodlpteli ol()trtoirpiy1ol emicsat a2taur ;t4apt  oeiysfsDrmn snt0aexnmoctytlpDrai slt t2tr(rpno1ap nmivias)a2rru onu1aetomociasla rl( p t0arxnxo3iotfpt aieilt)trxr(m iy4ol  lieilsf Dur(ront4alxnmi3tyt s2emnvo;t0texnir3oatopD anesls) exoio iy1ome lict s  rrmum ;o1oleoif3iad a2emumpnt)tleomrcoydfm e ivil(0s2xmxr3ny1lmtnlfcias)sDumu ono1apx mfcilt s eln p (4texrxr3iadlpDrlnvols0 2tm(m3iydapt mfetls) 2rrumoot1tlxo f3iasfs2um(mp (0 exoio3ty1op elueolt0 exo(m3no1opt mnei ( a2rmumono1aptnmo3iytfmDulnvs;t)artrxf3tydfm ranvi;t tetmimpny1lle mfvtas)srrmurpno4olxnif3iasfa uanvsn(4 eerifcia1fmt livi;s0tetmxm ou1llenmici ( sDta( oot1oeeomi3ild 
\ No newline at end of file
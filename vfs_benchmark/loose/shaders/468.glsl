@@ -0,0 +1 @@
+uvsls s2urxo io4olte ieiat sDrm(mpot0aeeoii3tltfm2el( o;(0trtoxf3iatoaD liesl(0srtoir3iy1ameelnvsat  Dtr(root4aleo feilt sDeau o;u4tlxnirciodlmt  nei ( trurxr3ou1op emietl() rtm(ronu1opt  fetld a2elnmsnt4trxoxr3io1oatranvsl(  etmxr ny4op n fvta( a2um(r ot4apxoii3taslaDulnmo u4arermrctotopD ai s t  2xmirpio1lpeemfeilt aDua(r no1aeen ociatfm2rl( p;t4 exrxoctydla e ivs t s2tr(m3nu4ole livslt  rua(  ot4aptnio3tas aDuanms;(0texoxf3oo1fp r nvs;t0t2toim3oy4lm   fetlsf Dururpno4teeomfeias s umu s u4aexnxfcta1fateanei t teuo(o3iy4lm emfes t) Draxr ot1tlt  f3iatfs elnms () etrmr iy1lp e ieolt)srxoxm nu4ale  neiatfa2rru  nu4aptomietatfa emn p t)aetomo3iytfm rau i;s)s2uoxm oo4olt mivta() Drmxrono0oleomoeiys m ra(vs u0aeenmrcta1latranvol( s2um(r iu1lmeemietas  Dum(r oo4tpxo fetydfa2rluvp;u)alerifciytlpDraueols0 rtoir oy4lmeelict t)aDtr(r oo1olxniicilslmDua(ms u)alermo3tydlmD luei;(0 euo(r nu1amenmnvsa(fsrra(rpno0aptn f3iaslm ra(ms t) rxniocoadlmtrauvo;t) rumir ou1am eliei t)aDur(r no4oltnmictas m uln snu4tlenmrciodoptelueols)trxm(opiy4amen fcilt)aDrrurpnt0apeo i3iysfaDrm(msn()arenxfcoa1fp rlnei;s t2xm(o3oy1omeelnvsa()s2rau  ou1aet iictat aDea(von(0trtoif iodla r uvi t) 2urxr oo4lm  miei ( a2umxront1ope io3tlt a ran p u0altnxoctytfp elueolt  euoxrpou4om emivilsfsDtaumono4aexn oeiytfmDuau p t)alxnifciotoptrlies;t0sexo(o nudlle mfei t sruru pot1aleoif3iydlaDran snu)texnxo3oytoaDean o () rtrxrpiudlp  lict ( aDtrxmono0aeen fetysls2ulu snu4trenxrciytlmteaivo;(0sexrim3iu4lptnlncsa(f 2tr(root0alt iictas s2emnvpn(4alxrmf oatopDr ueils)srumir oy1aleelnesl(faDumxront4apt moeiadfm2ua(vs () rxrmr ta1oaDelivs;s trxrirpiydoptelies s)sDtmu p;o4altn oeiasfs ea(mp;u4aeerir3iotfmtranvol( setoxm io1ap e fvslsfaDtr(r ou1alenioctasfaDelnmo;t4aexnmo3iadfm rlu i (  2to(rpiydame  ieta(  Dtm(mpoo1alx mfeiltls um( p;() lenif3oytlp   nvolt s2xmio io4alen fvslsf Drr(m ou0tltnifeilsls2um(monu) rxrif3ty1laD lu ols  2xr(o nodoptnlfvta( aruru oot0oetnmictydlm uluvp;u0altrmo3iodlm   ueo t  rxmirpio4am emneta()aDtm( pnu4tetnifciad m elnms;u4tetoxrciatfm r ivs () rurxopiu4opeelfci ()srtrxmonu1aet mociasfaDeau o () rerir3tatopDeau s () 2umxr no1apt lnct t s2rrxrp;t0alto i3tydfaDraumo;(0aexrxf3oadlpDr ieo;()seumir3iy1oltnmict t sDra(rooo1aee mfeiltfs2rmn s;t4arxoio todfm rli ol( srtrir3iy1apte ies () 2ta(rp;t1ole  iciat m umnms;(0arxrxoctytfatrluvi;s0 exrxo3no1altemietl(  2rrur ou1teenmoctlsla2rm( onu0 exrxrciytoatr u ilt0t2uo(o3no4lm  lneslt)a2taxrpot0olen o3tlsla rlumo t4 lermo3iotfmDr uvo s s2uoim3nodlpen nviat)sDua(  no1aexnio3tldlm umnms;u4arxrmrctatoa   u o;t t2umim3iudol  mfeias) Duaum ;u4aetnifctydfa uan pnt0aexomfctatlpD auvi ( srurxo3no1olt  ncs (fsDta( o;u0oltoif3iyslm ua(mon(0arerif totopt an ols trtoim3oudapte ieta( aDtrx poo4oex mi3ilslsDua(mpnu4 lxrir ia1omDraivs s)teurxopoo4lmtnlfctas  2uau pot0aetomfciasla rmumsnu0 etrmfcto1fp  lneil() rumxopio4omtnmncsa( aDtrx o;o4tpen octld aDuauvs;()tetnir iy1fmtrau i;t  rum(rpiydll nmncs t aDta(rpnt4oet iietad s2rmn pnu0alermfciy1lmtr n s;s  etm(m nu4ap  mfetl(fs2urxmont0oet mieiltla elu o;()teeomr iatlm r ueo;t teto(opio4aleelfcilt aDuax  ;o4olxoii3ias m ranvs;(4 renir ty1lmt an i;s0t2toxm3iy4op nmfcslt) Dra(r ot1tlx mf3iasfs el(mp u) rtnif3oatfaDeanei () rum(r oodllenlfvt ( arrmxronu1opeoioeildfm2rmnvsn(0aleomo todfpt lnvi;()trtmimpiu4amee fvsl()s2rrurono4ale mi3tadfm uanmp t4tlxrxr3to1fpteluei;s0t2xrir3ou1ll n ncsas s2umxmono1oetnmfctytlmDrmums t0altnio oa1laDe i slt0trxrir oy1olteliesa( srta(r ot4oeeo fctltlm2umnmo;u4aeenmocia1lm ean s;t)s2xo(mpnudam emnviatfsDrmur ;u0opeomfctldlm el( s (4tltrxo3iatoaDraivsls) 2umimpoo1amteliesl(f rtmumpno4tlt mo3iydla rl(vp (0trtnxr tadfatrlieo;() 2xo(r3nodol nlnetls  2trxrp;t0openmfctatlsDrmums t) rermf3oatoatrlies;( sexr(r3oy4al  mfcilt  rraumpou1teen ieildlm2umumo u4 lxnxr oo1lp raieils seto(m3no1lpenlfvt (fsrtmx p;o0aeeoif3tlslm2ea( o;(4tlxnxr3tatfmteaueo;t t2xoio nydal  lncs s sruax o;t0olxoiocilsfsDea(vsn(4trxrif3tatlmD  n o t srtoxo no4lleemnei (faDrax o;t4aexnif3iyslmDulnmo;(4arxnmf3ia1fa   neols)tetrxopnodop n ivta(  rtm(r no0oeenio3iytfa2emuvs (4tlxnxo oa1fmDraneo;(  2xoxr3iu1omtnlfctas  Durx o;t4tptomictytls rl(vsnt4trxnxo3tytopD aues s  rtmxo oodolt lnvi s) Dtrxrooo4aeeo feiatlaDelnmo (4 rtnxf ta1optrli s;s0trur(opou4oltn fet t  Dur(mpou0texnif3ilsfs2rmumo;(4 rxoxo tatlptr uvi t0 eum(r3oy4apeemnvtls) Draxmooo4tetomoeiydlsDumump t4tltrmfcty1latelivi;(  rurxr nu4om emfcsatf 2raxro;o4alx  ociltla emn o t0tetrxo3to1lp ran sls s2um(mpoy4openmfct ()aDtmump;o1open i3iasfs2ua(vs;t0 ltomo3iatoatr ivsl(0texm(mpoodlptn icta()aDtaxr no0aee iieiasla uaump;t0altrxrciodlm elieo t0s2trxmpiu4alt mfviat) 2trurpoo4teeniieiltfm eanmo;u)altrmf3todfp ean i t0 etoio iydlmtn ieslt sDum(root1ale mfeiasfs2uanvp (4treomr3todla eau i s)s2xmxo nydamenlfciasfarraxr ;t1opxo feildls2rau onu) etrxrciotfmDeluei;()tetr(opiu4ameemncs s)arra( pno1aleoioeiasfaDulums u)tetoio tydop elu o;s)t2xo(m3nu1alee ictatfa2tm(moot1teeo oeiydfs ulnvo;(0trtoxf3iodopDe u ol() rxr(o3nodoltelict s) 2uauro;u0ole iicilsls ul(mont) ltrmr oatlp r n ol(0t2tmxo3iodll emncils) 2tmumpnu1aptniieiat a rl( p t0 lxomfcoy1oaD anvs () 2xoio ny4ole  fvsl() ruaxrpnt4texnif3tas m2elump u)alenxrcia1laD ai o;()s2xmxo oy1ape  fci ( s2ua( ont0apxomictls m2eau p;t0arenmf oatfa  aues;t texmxm ou4lmte fviat) 2umum nt0tpenifctasfs ranvp (4 rxomr tatlp r nes;t0 rum(m3ou4altn fesas srumumonu0oeto f3tadfaDrlnmp;()artrmocty1oat lnvolt)trurimpnydlleelnviltfsrta(moot1apenmf3iadla elumonu0arxomo3ty1la rln i;s  rtrim3oudam  mnci s)a2ur(mo;t4aex  fciytlm ua(mp;() etrxr tadlp e nesls  rtrio oydal   ivtlt a2ur( p;u4aexo f3iydlmDumump;t0alenxr oadoaDrai o ( trxrim3iy1altelies s sDtrum no0tptnii3iyslmDrmuvs;(4alxrxoctatlm elueo;t0setmxrpnu4alenmivils) Dta(  ;u4tptnioeilsla elnmo t) renif3tadoatrai s s)tetr(m3oodalt  iesl()srrm(r ot1alxo octlsfs2ua(mpn(4 exnir3oytlpte i i (0s2xrxmpnydlpe livias  Duau  ot4opeomictyd a2ua( o (4aetoifcia1oa r uvols)s2tr(r3oo4lp nmfetls)sDrrum oo1ope iicild s2uln snu0tetrxo3totlpteaueo s srtr(m oy4lm emfcta( s2rrxm ot0alx  o3tlsfm2ulnmp () rxnxo3iatop eauvsls0 2xmxm3ou1lltnlfesat)a2tr( oot1olxo icildfs eanvs;t0altnio ta1fatelnvslt  2umir iu4omtelneiat)aDuaurpnt0alxoioetltfa2emnmo t0 etnif3todfpD aneo;(0 2urir3nu1ol elneil(fa2rm(m ;t0aeen fciysfa2eau sn(4tleomf tydfa  ln ols0 rur(r iu1olee nviasfaDtaxr ;u1tet  ieiadfs2uanvpnt0aexrio oatlmteli il(0trtr(mpoudlmenmfvils s2tau  ;t4oetoiiciadfa ra( p (4aexoxrctytfptelu o (0srxrir3ou4ll elictltfs2umump;o4aet miciydls2rm(msn(0aexoif3tydfp rli sls  exr(r oy1oltnlfvsls) rtmxmpoo4aetnmi3iyt a em(mp (0aexoircoatfat ln s ()srxm(rpio1am nmfesl(  2uaurpnt0aptn o3taslm rlumo u)aetomocty1la   nvi;s  rxo(mpiydlmeelieil( srtm( o;u0olenio3ias m ua(mp (4 exrxf oatfmt aivo;t)teuoir3nodlpeemfvsat)aDur( o;o4tptn feiatfmDrlnmonu4aeenxr iotoaDeaieol(0truo(opno4al   net s)sDrm( oot4oleomfctld a2rm( s;u4tltnmfcoadfa eli o;s0s2xr(mpiy4ope mnvilsfsDururp;t4oeen o3ilsfa2umumpn()arenirciotoa e neo (0sexmir nodlmee fct t) Drrxmp;o0alxniociysfm2uan sn(0teeoifcio1fptraivi s0t2uo(o3nu1lmt mfet t)srtm(r ot0tpeo feiasfs2uau snt0aexomf3iy1fmt  u o;s texr(o ny1ol e nvtat arrru pnu4apeoioetltlm um(mont0trxnmocia1fp rau i s0sexrirpoo1om   nct (fs2rmxmp;u4tpenif3iatlm umumpnu4 etomrcty1oaDrlneo s sexoxr nudlltn ictas a2trx p;u4apen oetad a uln ont) ltrmo iydfpDr i s;s  euo(m3oy4ameelictlt)aDtrxm oo4aeeniocilsfa emuvs u)aexoir3ootopDrln ols0 2tmxo3ou1altnlfct t  2tmuro;o0altnmoeiatls eauvonu4arxrxf3oatoptraueslt0trtrimpiy1lle  ieil()aDrmxmp;t4opx moeiyt a2rmuvo (0altomrcia1op e uvo ( tetoxopoy4am e nvt s s2taxm no0oex iocilsfs2elnmp ()arenifctotfateaueols0s2tr(m oudlpeemnvi ()sDraxr no4tlxo fciys mDul(vp u4alerxf ia1oa eau i;t) rtoxr iydamtnmfvt (f Duaumono4tex mf3tyd sDrm( onu0aexoxo oytfmte ieo;s)s2toim3iudamt mnvt t s2tmump;u0alxn f3iadlaDea( onu0alermr oy1fp elieil()s2tm(mpnudal nmfctas  2ua(roou0opto fctlt sDra(mo u4tlxrmfctytoaDe ueols0trtmxopoydamtelfvsasfs2taxmp;o0ale moetadla umn p t)trxrmo3tytfpDrlivs;()t2urim oy1om nmiesat aDua(r ou4teto ictatlsDemuvo;u0tetrxo3ia1fa   i ols)s2tm(o iudaptemncsa(f Dra(mpoo4alx  icild a uln pnu0 ltnxo3iotlpDeli ils0sexoio oudam emfetat  rtru  ;o0oexnif3iytfs2uaums;()aetoifctatomtelnvs t)texr(mpio4llee fct (fsrtaum ou4opxomf3iysls ra(ms u) etnmr tadom  aues t) 2xr(mpno1omt  fvi (fsDtax p;u0tet miciasfmDra( snt4 etoio oo1omD livo s)s2xm(o3nudome liei (  2rr(mont1tleo fciatfs2um(monu) ltomf oy1lp raieol(  rtoxo no1apen icsa( aDum(r nu0tleo ieiltlaDemnms t)treoxo3tytomD aues;(0srxmir iu4amenmiviltfs2uax o;u0tpxoiieiatfs um(vsnt0altoxf iotlmteln slt teum(o iy4aptnmivtat s2tr(m ou4tptnmieiys mDum( p;() exrxr iy1oaD  ieilt s2tmiopoy1ap elnvtls)s2tmuro;t4tlxn o3tys s rl(mpnu0 exoircoadlmDr ieils) eumimpiodllt  nvt (f rumxm ;o0tpxomiciasfm2ra( o t)arxnirciytlpt  ieo;s0t2tmxo3no1openlfvi ()sruaxmpno1alt  o3iytfs rlumo t4alxrxf ootfaD luvo t)s2xoxm no4ap  mnvta() 2rr(moot0aetn i3ils mDumuvs t0 etnxrciy1fmD ln o;s0teumxo io1lpe lieias a2tmxmo;t1tleo f3iysfa2elu s;u4alxrmo3iy1opD lu slt)teuo(r3oodal nlnvi (f 2ur( o;t4opxo i3iltlm2elu s u4trenif tydfpD ai s;t  exrxrpoudap   nviatf 2rmur ;t1tlx  feiadls2rlnvpn(0 lerir3oytoat  uei;s) 2to(o3ny4lpen fvia(fsDrr(m ;u0tle moeiys mDumnvs (0artnio3iadomt luei;()tetmxopiu1olenlivtl( aDuaxmpoo4tpt  fctadls2rmu p;t0 ltnmrcoadomtr i s t trxrxr3io4op n feils srum(  ;t4ope iiciltlm2eanms (0tlxrir oydfa  lu sls t2xo(mpiydame lics sf Dua( pnt0oeeomieiat s ulnmo;u4aeenmr3iytomDean s;() euoxo iu4op n ivta( srrru o;t1oltn ociatfa ea( o u0texomf3to1opDelneols teurim3oy1aptn ncsat s2rrx pou1alt mfeiadlaDemuvo t0aeeoxo3iatomtrlueil(  2um(r3iydapeelncia()aDtm(mo;o1tlx  ocild m2ra(mpn(0texnxf3oydom eluvslt s2xrxo3oy1ame lnctasfsrrm(m ou4aexnioetydfa2rm(vp ()trtnmo3iadlm elnei (  2xrxm no4lmee ivi t)arumump;t0tptoifctadla2emuvsn()altrxo oatfateau sl()trurimpny4ol  lictl(farraxm ;o1oeeomo3iadlsDem(mpn(4 renir3todopDr n sls t2xrxrpoy1amtelietlsfarrrur ;u0tpxniietld sDem(mo ()arenxf3iotfmt au i ( texo(m nodal nmieilt sDurxrpno1tpx  ocilsfs2ul(vsn(4 reoxocia1oaDeanesls)t2xrim3nodap elfesa()arrmuronu0tlenifciadfsDeauvo;()altnxfcta1lpDrlivol( trxoir3oo1llee nes t)sruaum ;u1opxoii3iydfm rlums (0tlxoxf3tytlp   uvi;s)sruo(opnu1ol  mfvt ( a2ur( p;u0apxniociadfsDemu o t0 rtoio iodoatrluvo t s2ur(r iudalenlietat)a2rm(mp;o4tetomoeiytlm2elums;(0altnmo oydopt lues;t0s2xoxopiudal e icias  Dta( ono4tlxomi3tadfm ea( s;u4 lxoxr oatfpDraivi s s2urxr nu1alt  icsl( s2tauro;u0alx  f3iltfs ra(vp (4aexrmo iatfaDeanvi s  2urio iudolt mivtatfsrtrumpnu4alxo fcild s2umu p;(0aeeoif tatomt livilt  exrirpoydomt miesat  2ta(mpou0opxoifetad aDel(vp;()teeomr3tytop elivi;(  etr(r3iy4op  mfesa(  Duax poo1tlx mfciysfs2rl( p;t4 lxnmf oo1faDelues (0sruo(rpoy1lp  lfvtasfa2tm( pot0tle  i3iydfsDem( s ()trxoio3iadoateaieslt trumxo3ny4op elieiat)a2taur nu1olx  i3iat sDrmumo (4 rtrxo3io1fat lnvs (0sexm(m3iu1lme mncsa()srrrumoot1tpenioeiasfmDelnmon(4teenxf3tatfatrli slt trto(opnudlm nmici () 2taxrpot4optn ieiyt sDrlnvont4teeoxf3ootlmtrlnvs (0s2tmxr3iu1lm  mfetl(f 2umur nu0tpe mfciytlsDulu p u0areniociotomDeauesl()seurir iu1ap  lneia() 2rru  ot4oetoiietatlaDulnmo t)tetrxo3oatfmt aneo;s) exrimpny4lp nmnvslt aDrax ooo4tlxoiieils a rmnmsn(4arxnio iadoatraues t0 exo(mpio1lp emicsatfsrua(m nu1tlxnmictyt aDem(vp (0teenxo3tadoaD ai o;(0 2umxo3nu4apeemneta(farua( o;t0oex mo3iltls2elnmo;t4 ltnxrciadlmD anvs;t0seurxm nudlp nlnviltfsDraum no4olto o3iys a2umuvpn(4 rtomo oatopDelu i;s)tetoio oo4ape  feiltfaDuaxmp;o1teeomoetlsfm ulu on(4 exrxf3iotoaDe nei;(0s2trimpoudolte fcsat)srtmx o;u0olx ii3ildla2ua(vpnt0 exnir3ty1om   uvol( sruo(r3ou1omeelnvt () rrmxm no4apenmo3tytla rm(mont0tetriocta1lp rln olt)texmxr3io1am n nct (f 2rmxm ;u0aexniociasfs ra(vsn() lxnifciadfmDe neo ()texriopno1ll nlics sfartrumpoo0oltomfeiydfmDrmums t0tetomr3tadopDe iei t0setr(r3io4op nmnct s)artru  nu1oeeomo3ildfmDeau s u4teerifciytla eau o (0 2umio3oodoltn ivsat srta( o;u1tle mo3iyd m ra(vo u4 leoxf3todlp eaivi t0 2xm(r3nudalt  icias)aDtau  nu1aleoifciyd a2ranvo;(4trtrir3io1lptr ieils  rum(r nu4oltnlfetasfsrta(rpno4tptomi3iydfsDem(mpnt4 lxrmr3iadomDelnvol(0 etmxo3iu4altnmnvsa()arrrurpot1tpenmoeilsls um( p;(4tetrxo3iydlp  aieols  rxmxrpiudlp elfeilsf 2tax  oo4tle iociatfm2umnmp;u4 exrif3oodoat  ivs t  eumxo3oo1oltemfvia(f Dtrumpot1tpxnmi3tadlm ra(vsnt4 ltrmfcoodlaDr u i t srxoxm iudlptelfesatfaDumu  ot1oeenioctadfs emn o;u0alerir iatopteln s t0srtr(opny1lle mict t) rtm(mooo4oeenmfcildls uanvo;(4tltrxf3oa1fmDrlnvols0truoxrpoodomtnmneias  rurxmono0tpt  ictadfmDumu p t0 exnmr oo1fmDr ieo ( srtoim nudlp  lfvt tfsDtrxrono1aetnmociltls rlumo;u) ltnir3iodopDraneolt  eum(mpiudale mfvi s) rtmumpoo0ole ioctysfs2umnvonu4tlerxo oytlp rln sls0s2uo(m nudlle  netltfaDurxmpno1ape ifcildfm2elump;t)areoio3iydomte u sls srtm(rpoodll  lfci sf Dua(m oo0apen ictas s rlnvpnu) rermrcty1fp rluvi s  2uoio3oudlm nlieias)a2uaum nu4tlxnifeiad a2ran on()trxrmr3oytlptr n i;()sexoio iodameemfctl( artrum no1teeoioeiasls eanvs t0aetrxociadfpt  i o t)t2xo(mpoydale livs (fsDtmxm nu4olx  i3tlt aDrlnmsnu)altnio iadlm eaieslt0texr(o iy4llee feiltf Dua(m ;t4apt mictasfs2ulums t)arermf3oy1om elu sl( texo(r ou1lltn ncsl(  2umumonu0alenmfetasfm2rlnmpnu4tetoxfciytfptean i s trurxrpnu1olt  ieslsfa2uaxmo;u1openmoeilt m eln o;t4trtomf iodomte uvsl()setmxo3ou1amen ietl()sDurxmo;u4tleomi3ilsfmDra( ont4 leoxf3oodom  aiei t)trtr(mpiodaptemnetlsfs2raxmont4oex mociydls eauvo;()tlerxr oatfptrai ilt0 eumxrpiudlm  mncs sf rtaxmo;u1aee ioeiadfs ua(mo t)trenmfctatomDr i slt sruo(mpiy1al nmfctlt)aDrmur oo0ole if3ild a ua(vs t4trtrmo ta1omDelivs;(  rumxo3ny4opeelfvsls arumu ont4tptnmfetadfmDea( s;u4aeenio iy1om   n o;t0 rtrxmpiy4alenlfcsltfartrxr nt4tlxomf3ildfm2rmnmsnu0 etoxr ia1fmDrauesl()trtr(o io4lpt  nesa()arraxmpnu1oee mfeiltla2rm( s u4 rermoctodfm eauvil(0trtoio3iodal elictl( srrmx  ou1apxnmieils aDul(mp u4 leomr3iydomtelivi;t)texr(o io4ole  nctas a2urumo;t0olxnmoeiysfs rm(vs ()texrmociydfm e uvol(  2xo(rpiydlm  lfctltfsDtmu pno4olt mi3ild a2rlu o;()arxnxrciy1omDrluei s)seurxo iodaltnmnvt s aDrmx p;o4tpenmoctat aDul( on()teenxo3tytlp elnvsl()s2urxr3iy4optnlfetat) 2rm( pnu4texo ictlsls rl(ms t0 eeomf oydop   ivols  2xoiopnudop  livt sf rraxrpot1opeo fcildls ranvpn(0 lxnmo iydfm eluvils)trxr(r3oo4ope lictlsf rua( o;o4aeeomoeiaslmDea( o;t4 rxnif io1opD  nvi;t t2tmxmpno1ope  ictlsfa2um(  nt1tptn ociadfm uaumont4tetnmo oo1fateanvi t  2xoxo3oydome  nesas) Duaur no4tpto oeiydfs2el(msn(0trtnxr to1lmDe nvs;s t2tmio3nu4lptemivs ( aDuaxrpnu4tpx mietldls elnvpnt0tltnmrctotfmDraieslt teumir3nodam nmfvsasfs2tr( p;t1olxomo3iat s ra(monu0 etnxo3ta1om r uvi t  exm(rpou1llt lfeils  Dtaxmpot0tltniieild a rau o;()texnmf3todomtelivslt)srtoio3iu4op  mieiltfsrumumpnt1aleo ietadlmDua(ms;u4trtrifciotomDeliei s0 rumxrpnydlme mfvias) 2uaxm ;u1tpt mo3iasls2rl(vsnu) rxniocia1lp e nes t) rur(r3nu4lptelncsltfarur(mono1tpx mo3tltfm ra(vs t) rxrxo3iadlp rau o s s2urxr3ou4openlfesas s2rrum oo4tltn i3iysla2rmn o t)tlxnxr tatfmte n o;s)srtmxo nu1oltn nvi sfarrrxr ;o1oleomo3iasfaDrmuvo;u)altnxfciy1latrli o;( srxmio3ou4lmtnlnetltfs2rr( pnu1alxniociadfs rlumo;t0aeenmr iodoatrai ilt0 rto(rpoo4al e ivi t)arur(rpou1optniociytlm2umu p;t4tetomr3oytlatelieils)seumxo3iudlpt lncs t arur(rp;o4aleomiciys mDuln o t4arerif iytfpDrli s ( tetoir nodlmeelneil(fa2rrxm ;o0alt ifciytlm2ean snu0treomr todfm rluvs;(0t2to(r ny1amtelnctl( srtmu ont0oexnmiciasfm2rln o;(0teerir3oodoa  lnvol( sexr(o nodop n fesas aDumxm ;o1alt iieiltlaDem( sn(0 rtriociadfmDeai sl( seto(r iy1aleelicsltfsDtax ooo0tle  i3tysfm ulu s u0 leomo3oytopD aues s)t2urio3iydlm e nvsls) rraxm ou4olxo ictyd s2ra( p (4aexoircty1laDrli s;t trtmxo nodlltemnet t s2raxmoou4olxnio3iysfa ran s u) exoxr3to1fmtrlnei ()s2xo(opiy1om elietl()artrx pnt4alto oeiat sDum(vsnt4 eenir iodomD auvil() 2trxr nodoltnmfcslsf 2uaumpnu1optoifciltla rlnmsnt0teeoxr oydoa r uei t srtr(o iy1ameelfcta()srtm(m ot4tpe  fctys s ean o;t) rxnircoodla  lueslt0s2uoxr3iy1lptnlfvtl(f Duru pno1aexo ietldlaDum(ms (4trtoir oodfp   ivils  euoxmpny4llt micsl()a2rmxm ou1opxo fciatla umnvpnt0arxoxfcoydlmte nei t)setm(o3oodlme lfesl(  Drrur oo0aeeo fciydfm2ran s u0 lerxr tytlate nvo;(  rxmiopnu1aptemnvilt  rra(mp;o1alenmf3tls s rmnmpnu)arxomr oy1op  au s ( teuoirpny4lp emicsasf Drrx p;u0olxn i3iasls ulnvp () rxoir ta1lpt auvil(0setoio oudolte ncias) Durxmo;u0tet  feiat m emn o;t)aeenmf oytfat li sls0 eumiopnudopeelfcta(farurxmoou0oetoifeias m ua(mp t0 rtnxr oytoa ean ol( s2to(r oodapt lfviasfsrrmum ;o4opxnmi3iyt a2rlums;t4areomfcoydfa rlieo;( s2xoxm3no1omee ics (farrax poo0aexomf3ilsfmDeauvpnu4tltoiocootfptr uesls)s2trxo3oy4lleemncslsfsrur(  ;t0tleomoeiasla emu sn()alerxf3oytopt livi;s seumim oodomenmfci ()sDurumoot0oltn fctydlsDrl(ms (0 eeoxo iy1omD  uvs;s0trxrxm ou4lle  iet ( artru o;o4tpx  i3iasfm2uanmo;t)alxrxr tatlmDrlu i;t0texm(opno4lpee nvsatfs2rmurpou0tpxnmi3iatls eluvs;()aeermrciotomt lnvils)s2uo(o nudaleelfci t) Drmur no1oeto ociadls um(vonu0arenmo iy1fmtr nei;s0sexmxmpou1am nmivtas  2ta( onu1aetn f3iadlm2el(vs;u0 ltoxf iydoa e iesls0t2umimpnodape  icsat)a2rmxmp;t0aptomi3tasla rl(vp t)tetoif3tatlaDr uvolt0texmio iy1om emnesls)artmu  ot4open fctltfm umnvp;()arxrxf3iy1lp e iei;t0trxm(o3oy4omt licsls aDumx p;t4texomf3iydls ean pnu)tltrmrciotlmDrln sl(0s2uoio iy4amt lnctl(f rumu  nt1opeo fcildlsDrlnvp () eeoxfciy1omD  neolt0seum(mpoo1ole lnes s)arum(r ;u4oeenmietldfa uluvp t)tlenio3iy1fmD  i o ()trtoxo nu4om e fvt () Drm(r nt1opxn feiyd aDeaums u4 lenxf ootla raieolt  rtoxmpou1op elnct (fa2ra(mo;t0opeo f3iydlsDem(msnu0tlxnio ia1fate uvi;( srurxm3ou1lp  livt () rum(  ou4tleomf3iad aDrlnms;(0 exrmr oadoa e uvslt)trtoxrpoydolen icsls arrax oou0tlx mf3iys a ran pnt4 rtomrcoytlpDeai s s)teur(opnodolen ivslsfs2tru pno4teeomiciatls2um( p;u0 rxnmf iotfp elivo ()teto(m iy4lltn ies tfaDtrum oo0tpxnmi3tydls ea(ms;u0altnmfciytlpDe ivi t0seuo(o nydal e nvs ()arraxr ot1apxo o3iad mDulnvo;()tetrxo3tytomt aiesl(0s2tm(m oo1apt  ivt t)s2ua( poo4ale iietltlm2ra(vp;t4 etrmocoytfatrlivs;( s2to(opou1olt livi t)a2rr(mpnu0aeenmieiydfm2uanvo;u0trenif iadomte neil(0srxo(rpnydomtnmfcsls) rum( ont1opt miciytfmDemumon(0alermf oo1oatr n i;(0t2xoiopio4ll n ietl(  2tm( o;t4tpxn oeiyt aDuau s;()aeerircty1oatraieo;t)s2xr(r3iydomtemnesls aDtauro;t1alxnmi3iltfa ean o t4aexnio ootop raneols)texrxo3iy1apeemfvi t)artr(mo;u4tet iociysfm2eauvs;(4 lxrxf oatlm r n ilt)tetrim3oo4ap eliet tfsrra(ro;o4opxniietaslm2emuvs (4tleoxr iadfp elieo;t srxmio nu1lleelnvs ()aDururp;o0tex mfetld mDeanvs u)tleoirciatop  aneols t2ur(m3ou4ol e ietl( srrm(  nt4aptnmieiltlm2eluvp (4 lermfctadoaDe iei;() 2toxr iu1lpeelieiltf Drrx poo4aptoifciatfmDum( s u4 eenmo3iydlpD lieol()srtm(rpno1lle  net () 2raumpno4tpt  i3iyt m umnmo;(0arxoxfcoytfpD lies s0setrxr3iudomee nviltfsrumxrpnt0ale mi3iytfm ua(vont0trxnmf iydoateau s;s0tetrio nudlp e nvsa(fsrur(mono4ole mi3iytfa2ea(monu)alerxrcta1fp  lnes (0srtmim3nu4olen icils srrax  nu4openiociyslm rmn o;() eeomfciotfpDeanvs t0trxr(mpoo4lptnliesls) rrmx ont0tptoio3ildlaDumu p;t0tlxrxfctotlpDrlueo t)srtoir3oudole  ivsasf Dra(m nu1tle  o3iltlmDeanvpnt4trenio3ty1omt auvils) 2uo(o no4olee icsltfaDtrx o;u1tlx mf3tydfsDuau o;u)aetrmrciodopDelivilt)srur(mpiy1omte fcil(fsruaxmono4alt ifctltla umuvo;u0tetoxr todop e iesl() ruoim ou4alte fvt ()a2rax  ;t0apenmociaslmDea(vp (0tltnxo3ta1fpDr u s;s texoim nodameelictas a2tru onu4oeenmiciat s2ua( s t0tltrir oodlaDr ivo;s0 2umio io1lmtnlieil()s2rrx oot0oleo o3iltfsDulums t)trtnif oatopt lies s s2um(r oo4oleelnvsatfaDrruroou0apeoiieils aDranmp;t)aeeoio iytla rluvols0trum(opno4lme lnetls) rtmxm ;t4opxo i3tlt sDrmnvp u0 exnxo3oy1fm   neils0srxoxr iy4ll nmfcta()a2rr( oot0tpxnioeilslmDra( pnu4 lxnmo3todlmt ln o (  exrxr nudlp nmictltfaruax  ;u4altnif3iasfs rmn s;()aetnxf iadla  lnvi;()trtmim3io1altn ivtl(fs2raur ;o0ole mociyt m2rm(vs;t)trxoxf3oytoate i i s0 rtoiopoodam elfvi (f Drmxmp;o4olxn ociltls2rau p;u0alermf3ootlm e n olt)texoxm ny1aptn nciasfarrau pnt4aeenmoeiydfs2em(mp;(4artrxf tytla eln o;( srtoio3ou1ame  ieiat  2rrxr ou1aetoii3iadls2emnmp t0aeermr oy1oa elnvi t) euo(r3io1ame mivtlt)sDtmuro;o0oet iociad a ra(mo u0 ltoif oatlp ean o;s0texm(opnodope mivi s  Drm( onu0oltn f3tyd m2rm(vpnu) lxrxo oadom raieslt0s2uoxr oo4ol elfcils  Drrum ou1oltnioeilsfa2uaumonu4tlxrxf3iydoptr nvsl(0 2xm(mpny1llen fes t sDuaxrpno1aleomociatla2rmn pnt)trenmociy1lp elivolt texr(rpou1llee nvia( sDrm(  ou0alenioctyt m eau snu4 exrmocia1fmDelnes;t srxoimpoo1ll emicsas  2rr(roou0apt if3ilsfaDelumpnu4 lxrmf ta1la e nvi;t tetmim3ou1llenlict ()arrrx  ou4tlenifetld mDua(vs t4tlxnxf3ia1oaDrliei (0s2tmxrpnu1llen ncs ()arumxm nu0tet  ieiyt a eau p;t4alxrxr3iotlpte uvo;s0tetoxo nu1omte ivtlt  Drr(rooo0tpen f3tldfs uaumpn(0 lenxrcoodopteau ilt  rxoimpiydlltnmnet sfsrrau oou1oeeomoeils m emnvs;t0altnxrcoytopDrlu o;(0 exrxmpnu1lpt lfes (fartru  nu1tpe  i3ildfs ulnmsnu)aleoir3ootop  li o t) rum(o3oydlle miviatf 2tmxmp;o4alxnmo3iltlm2rmu p;u0 lenio3oy1lp raueo;(0setmxo3iu4ale lfcsltf Dum(  ;o0optnmfeiatfm emnvs;t4 ltoio iodfptrlues (0s2urxr oo1op elfvs t  2uaxrp;t0aleoioeiatlmDemumo;u)aetnmf3iodlm rlu ilt  2to(o iy1amen iciatf rurxr ou1aptomi3tys a rl(mo;() ltnio oytlateau s t trxriopnydapt lnvtl( s2tm(mono1ope io3ildlaDum(vonu0tetnxr3ta1op e u ols)srto(opoo4lpe  nvsas) 2rrx  ou1apt ifcias s2ea(vo;u4 exrmf3iy1op eau i;t  rur(opou4ll   fctls srrmum nu4oee  o3tldlmDul(vo u)aetniocoodoptrlu i;t0 exrxm3iy1altnliesls)aDum(m ;u0tee ii3tysfa2rm(ms t0altomo totfm rau s;(0t2urim oydll emieilsfsDtax ont1altoii3iyd m uaump (4 rxrirciydom e ieo;s srtmir oo1openmfctlt  2umxrpno4oex moeiatfsDrmn s (4 eeoir tadopD au s () 2tr(opnodoptn fctls)aDurxmoou1apx mi3iyd m ea(ms t4altnmf to1om r neol(  rurxm3oudlme  fvias a2taur ;o0oeenmieiydls rlnvpnu)artnmocio1fp  livo s  etriopiydlmtemnvtltfsDtr(rooo0apt mfcild s2rlu o;u)trerxrcoo1la e uvols)trtoio nu4lltemiet t aDuaxr nu4optniietls sDua(mo;(0trerxrcoydfmDeln sl()trtr(o iu1llenmnet (fsrrmx oot4altnifetaslaDrmnms (4aexrir iy1laDelivo (  etmxopoydome lfvs (farrmuront4tlenmictydfs ulu s;() lenmr to1fp  aneol(0teuoxm3oo1aleemfctltf Dtr(moou0tlx mfciytlmDul( s (4texniocoatfp  aueo;t sruoxmpoydomte ivia(  2umur ;t1texomieiadlm ra(vs;t4 renmr oodlmDrln i;s trxmxo oydolee nesas s2tm(rpoo4opeomoetys a2rm(vs;u4artomf oo1faD  n ols0s2urxrpiy4opee netasfs2uaxrono0tltoioeiyd a2umn s t4 lxrirctadoa r ivolt tetrxrpoy1ome lnvs s) Duaxrp;o4oee  o3ildfaDea(vpnt)tltrmrcio1optraneilt  ruo(mpiudomtn feia( arta(r ou4tlx mi3tld s ra( s;(0aexrifcoa1laD an sls0 ruriopio4om e icilt  2rm(mp;u1tleomieiydls2rm(mo;u4alxnmr ta1lmteaneo;(0trurxmpnu1lm e icilt)sDumuro;o1tet ii3iaslm ua(vsn(4altnxo iy1fmDr nvs ( s2umio3iy1apen nesas)sDtr(  nu1ope  feiytlsDrluvo u)aexrxf3totlpt  u s;t)s2toio3oy4omte neils s2rrumo;t0oeeo fetytlm ea(vsn(4texoir3ty1fpD  ueil(0tetmxr no4llt  fvta( a2ra(rp;u0aetnmfeildfa2rlnmpnt4 rtomo3oatlm rai o;t t2to(r3oy1ol emfcsasfsruau ono0olt iociat aDeanmsnu0texoio tadfp  lneo s0 etoir ny4lmeelieta()s2urxmpot1apt if3iatlmDra(msn(4 ltoif oatlat  u olt)t2umxo iydllenlfcia( s2tax ont1alxnmfeiyd m ua(mpn()aexnxrcoydfateliei (0 etoio3nodalt lfei t  Dur(mpno0oex  feiatfs2rm(mo;u) rerxo to1laD  nesls  2toio io4amtn nct sfa2tmxmpnt0tle  feiys aDel(ms ()aleomfctotom eluvs;t seto(o iu1llte fvi sf 2tmx  ou4tlx  oeiyt mDum(vp;t4 lxnioctadlmtr n slt0s2um(m3oydll   netatf Dum( o;o4oet  f3iasla2ranmsnt0 eeoif
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;s)truoimpio1omt miesls  Dum(mo;u1oexn ocildlm2el(vsnu4artoifciadfmt  ies;()texrxopoudlmte nesl()sDuau onu0tee  ieildfs uanms (0alerir ootlmt lies s)srxoxrpno4opt lnetl()srtmxmpno1tle iictyslsDulnvs u0tleniociatop  lnvs t) rtrxo3oo1lltemiei ()aDumurpoo1tpenmieiad sDra(vsnu)artrxr to1fate ivsl() 2uo(m3ou1apt mnvt tfaDta(mo;t0optnmf3ild a2um(vp t)tlxrxr iodlaDrauesls0 rumxo3nudomtn nvs t)arurxr ;t0oltnioeiyt s em(vp t)aeerifciotfp rlnes s)trtr(r3ou4ll   fcs (fs2ta(  no0aet micilt sDua(mp;u)trtoxo3oytlptelu ils)srxm(r3ou4alee fei s)artm(ro;t1tpeniictltfaDrluvs u4 etnmr ta1fa elu o;() 2xrio ou4ope lfetatf 2ur(r ;u4altnmfctldfa2rmu pnu4tltrif3oadlat an s;( trto(m oudlmt mnei s srrmx ono4aeen o3tydla umnms () eeoxocoydomte nei;()srumxrpiy1lmen fvtl(fartmxmoot0alx mfciytls emuvs;t)altrirciodfpDe ivs;s)seur(rpiodapt  fes s a2umx  ot4oleomf3tldlm um(vont0trxrmfctydomD auvsl(0texrxmpny4alte ictlsf 2rrumpno4apenioeiatfs ua(vo (4tlxrmr3tytfpD  i i;()trto(m oy4optnliei t  rur(monu4ape ioeiltls ulu o;t0tlxnxf iotom  lieo t0srum(m ny4llee ieslt)aDrmxr ;o0tet  i3ildls ra( onu)arenmo3oydoateau i ()t2uoxr oydll nmietat)aDrrxrpnt1opx miciysfm elnvo;t0 rxoxo tydfatrlnes;(  2uo(rpnodlmtn nes tf 2umxm ;t0altoiicilsfa uanmpnu4 rtrxrciodopDrli o ()s2to(rpiydomenmfes t) Durxmoot1tptomo3tatlm2em( s;()tetoxf3tadomtr ueols) 2trxo3iodlp  lfvt t s2taumono1alt  f3tyt a2rl(vp;u0 lxrxr3tadomDrlnvsls  2xmir3ou4olt lfes sfsrrr(rpoo0oltnmoctad m emuvo;u4treoifciotoateaieil(0trtmirpnodllee iesasfartaumooo4ole ifetyd m ra(vsn(0trxnmfciotfmDeau i;t trto(rpno1openlncias) rtr(ront0oetnio3iltfaDuluvs;u4 etrxfcoa1op raies;s)seto(m iodalen ietltfarur(ront4apx io3tys a2uan s (0 etnxf3totfa e uvi;t)seurxr ou1lmenlnesat  rrr(r ;o1openioctlsfmDel(vs;(0 lxnxfciodomt lu ol(0 rtr(o3iydlleemivtlt  2ra( o;t0aexo fctydfm umums;t0tlermfcoadlm rln s t0teumxmpny4omeelfvilt)a2rmxroou1apenmfctltlm uau o;(0 ltoir3to1op e ivilt) euoio iu1ll elfcil()arrm(rooo4tlxomictyt a elu ont) reoif io1fp  au o;s)srtmir iu1op  lnct t)sDraumpoo4olx mocildla ran o () eeomf tadlp   uvs s0 rxrxr iudoleemnvi ()s2trur ;o4aptnmfeildfm ranvp (0 lxnmrcto1om   ivs s0trtmirpnodamenmicsatf Drr(mpnt1tlenmi3iyd a ulnmp u)altrmr3tatlm  ai s (0 2urir3oy1ll  mfct s)a2rmxmp;u1opx micilsls ran s;u) exoir3oydop   ueils) eumxmpny4llenmfvsls sDrrxmpoo4oetoii3tat m umumon(0 etnmfciytfpt lieo;s) rxoio3oo1optnlncs tf rtmurp;u1oeeoif3tysfa rau snu0teerir oatlmtr ues;(0t2xr(opiodaptnlict ()sruaxmont1oleoifcias m elu p;u4 lerif tydomD  iei;() rur(rpnu1lm emnvsa() 2raurpot1apeniiciad a rm(vo u)texoir tytfat an s;s) 2xrir3nu4omtnmfcilt  rrr(rono4texn f3iysfs uluvon()trxrxf tatlpteau olt setr(o3iydllt lnvt t)a2ta( pnt1tpe moetys s2emnvont0 rxomo oadlpDr ieslt) 2xoio no4oltn ietlt a2umxmpoo0olxomf3tytfsDeau p u)aleomo ta1oatelnvi;s s2uoxmpiy1lp n nci s aDrrx p;u1olenifeiatla elnmo;u) rtnxrcoy1faD aieol( t2xmxr3no4lmen nvs ()aDumumono1olenmiciatlsDum( p;t4artoxfcio1latelu slt  rtr(rpnydome mfviasfs2tmurooo4apto oeias a2rl(vsn()treoxf3iytfm raueo;s0 rxmirpoo1lptn nciatfsDtrxrono0teenmo3ild a2rl(vp;u0 rxrmr3ty1faD  nvsls  rxm(opio4am n fvt s) 2um(moou1texomociyt m eanmp u)trtoifcto1lpDelivi;s)texmxo3iu1ap  lfesltf Dta( pno4aexo fetydfs ranmpnu0 etomr oy1omte i sls) rumxm iudop elfvs t)sDum(ro;t1tptnioctlsls2ulu p ()texnmr3oydoptranvs (0 2umxo3oo4apt mfvs ( a2umur oo1aetnmictadls eluvs (0 etnxo3oy1omt  uvs s) 2xoxr nudal nlfeil() rur(moot4teenif3iltls ra(ms t4trxrircty1oaDelnvs;()t2umim3ou4optnlivias) Dua(root1olt mi3ildls umnvpnt4 lxoxoctadfate uvo t teurxr3io4am   neta( a2umxm nu4aetn icils aDrlnvsnu)altrmf3iadlmtelnvo;t  eumim oydopenmfciltfartrum oo4tpt  f3iytfs2elumsn() etrio3to1omtrau i ( teur(mpnydapeelnvt t) Dra( o;o0teenif3tlslmDea(vp t4 lenxrcoy1opteaivi (0teumxopoy1lpenlnctatfs2umxmo;o1apx mictyd s uauvo ()areoxr3ty1fpte i o t)sruoir3nudll e ies ( aDtmxrono4tpxo fctltfa2ua(mo u0 eenxf3io1fmtrlueils)setm(o3ou4optemncslt)a2trxm ;t4aexnmfeils a2rauvsnt)artnmrciodoaD an i s0 2urxm nudopt  fctas)sDtm( onu0alt  o3iyd mDumn o;t) exrir tadlp r neslt0 etrir3oodom  mivia( srtmxm ;u4tltn i3iytfsDrmnvp;(0trtomocoa1omDr nvslt  2urio oy4amee ivi t)sruaurono1aexnioeild aDumnmpn()teeoxo3oy1oaDeluvo ()tetr(o3oo1lptn neta( sDrr(m no0ope  fctyslm2rlnvpnu4 lxoircoy1lm  lu o;()tetr(m nu4omt mnvtat)sDrmxm ;t1aleomi3iytlm2emuvsnt4tleniociotlp r ues ()s2trxo iu1al nlnei s sDtaxr ot4opxoif3iadfa2elnvp u)tlxrxfciadopDraiei;t) etr(opnydope licias  rum(  nt0tee iicilsfa2rluvp u) ltomocia1fmte u o;()trtmirpoudamen fct (fsDta(r nt4oexnio3tadfs2el(mo;(0teerxociotoaDr n o (0tetrxrpnu1lme lfctlt  Dtmxrpno1tptn i3tltls ua(von()tlxnxr3iodlmD  nvs s0s2xmxr iy4apenlivtat) Dtmu pno1ape  oetadla umnvon(4 eerxfctodom  ln s t)srxrio nu1ol e iesls)a2rmur ;o4tpxnmfeildlm2um(vsnt0tetoxf tydomtelu i;s srtrxrpnu4oleelfvsa( aruaxm no4optomi3iltfm2eaumpn()aeeoir iy1fpD an ol()setmir iy4amt  nvil(fs2tru oot1ole  ocias s2eanmp;t4 rerxf3oatlmD luvsl(0sruoxopiy1lle mncs t)artm(rpnu4alx iociytfa umnmsn(0aeeomf oodopDe n ol(0 2uoim iu4ll elfviat aDtrxr nt1opeomo3iysfaDumnvs;u4texrxr to1optrau o t0s2tr(r oy1lm nmfetlt) Dur(m no0aetn oetad m2ran s u0 rtnmr tadfpDranvo;s0trtmxr3ou4amtnmncsltfaDuru oou4opx ii3iyslmDuanvs u0 rtrircoytfp  livi;s t2xoxo oodop nliei t artrxmo;t4oltomo3iltlaDeauvonu) rxnxr3iotfmtr u olt t2umxo3io4lpteliei tf Dtrxm oo0alenmfeils mDemn on(0treoif3ta1lpt livo;()teur(o iy4oltn nctat)srurxroou1oet mfctydlmDra(mpn()arxomf3tadoatraneol(0trxmxm3oudale lnctatf Draum ou1aeeomiciad s2uanvo;(4aleoxr iy1lmt  ieo;t) 2to(r3oydamenlnviatfs2uaumpot4oee  i3iat s el(vp;(0 etrmf3todlatelnvo;(  exmiopiodopte fesat srtmxm ;o1apenif3iadlm2eln p;t4texomociadlpDeau i (0teurio3iu4lltnmivtatf rtrx pnu4opxomo3iatfs rmnvo;t0arxoxrcoodfateln i s trurxmpiudom emfes (  2trxrpot1alxo f3tasfs2uanms t4tetrmfcia1fateln i;( t2toxr3iudop emnvias sruau pno0tle io3tysfm um(mp ()tlerif3iodfmD anei t s2urir3ny1lmen nvs s aDtm( pnu0tetomfciydlmDumu p;u4altnmo to1oaDr ivs t) 2toim3nydamtnmivtlt) 2raxmpoo1tpt ioeiydfmDuauvp (0arxnmr iotomtranvsls  2urxr3nu1lmee icilt  Dtr( p;t1tptnii3iad mDuln o;t4teenmo3tadfmDelu o;t)setmir iodlleemfvslt  Drmumonu4oltnifciadlmDemnmpn(0tleoio3tytlm elnvo s) euoir3iodlpte fciltfsrur(roou1apen oetydlm umn pnu0alxrmo tatop ranvol( t2um(mpnodomte fviasfs2ra( poo1open f3tltlm eau o;t) rxnxo3to1fatrln o;()srxrxmpiy4ol elfcs ()s2tm(r ;u0aeto feiadls2uau p;(0tltrio3io1lmte i o s)tetoxrpoudllenlicta(fa2rr(mooo1aptomo3iltfa emn p;(0trxnio iadfat  ies t)t2tmio iydlptnlfcsat s2tmumooo1ape ioctldfmDran o;t4tlxnmo3ty1late u i;t0setoimpnodlp nlfciat)srrm(  ou1tleo f3iytlm el(vpnt4tltrmo todomte n sl(0trxo(m nodlmt  icta(fs2ta( pou0aptnmoetydla2ra( s;(4 rtrxo tatoa e u s t t2xmim3iy4lp   fctasfsDur(m oo0oetnmfeiadlm2ea(vo;t0 rxrxfcoo1lp e nvs s0seuoio3iydaptnmfci ( sDrau ont1tpxnmictytfa2um(mpn(0aetrmo3tydlp rai sl( srtoir nydamtemfviat aDraxmpoo0olxo ociltfs2umumo;t)alxrmo iy1oat ai i;(  ruoxr3io4altemfvias) rumu p;t1oetnmo3iadfmDuau p u0tltoir tatfptr uesls)s2xo(m3oo1lme  nvtlsfarrmxro;o1olt moeiadla eau o;u4trtrio ta1lmt lu s t0s2trir ny1opt mfvs t) 2tm(rpnu0tltnio3tlslm2uln onu) exnio3totlp ran slt sexoiopnudlm  mnes tfa2tm( p;o4tlto ocildlaDumnmo u0artnif iytlpt  nesls srxmxo io1lpt mncs ()s2rr(mont4olt  o3iatfm2rlu o;u4tlxnxo3tatfm r uesls0trxmxmpnudlpe mnet t  Dururoot4oeenif3iyslmDra(vs u)arenmrcto1opDrli il(0t2tmxmpio1amtemivsas a2tmx  nt4olxn iciatla2ulnvsnu4 exoio3iodla rauvo;( t2urim3ou4am  mfeia( arrmumont4oee ifciatlmDra(mp;u4 reoif iytomt aiei;s)t2uoimpnydamenmiesat)sDraxro;u1oleoio3iydfa2rlumo;t0 lxrxo oatoaDeluei;s0 rur(rpiy4amtemieta( artrum ;u0ape  feiltfa elnvo;t4areoxrcoytfp elivsl( tetr(m oodlmtemneia(fs2umx  ou1tptomfcild s2umu o;(0tlxomo iotfm rlnvs;t)tetr(mpio1aleelietat)arta(ro;o1apx mfeiysfmDua(vs ()alenxf todlmte uvolt) 2to(r nydam nlicias)s2taxr ou1olxoioeiadfm2rluvp;t0alerxf oadfm r n s;t0trtrxm iodlpeemncias)s2ra(  ;o4aleomfctydfa2rlu p u0alxnxociadfm eau ol(0 rtrxrpnu4lmtelnesl(f Dtm( o;u4aleoifetytls2ul(von(4aexnif oatoaDr nvslt0 etm(m oo1alenmicia(  Drm(rooo0opxoifcildfm2emuvo;t4 eerxfcto1la  li s t0srur(m3nu4ap n fcslt srrrx  oo0olxomfcils s uaump t)aexoxo oo1lmD aivi t0 etmir iy4ape  nviat)sDtru ont1aptn i3tydfaDemuvsn()artrmr tytla rauvs;t)t2xo(r ou4al  mnctat aDrr(rpno1alto ociadlm umu p;()treomo3tytfmD  neo;t0seumimpiu1amte ivsas s2urx pno4apt mfctldfm2umnvpn(0arermr oatlpD lu olt) etriopio4alt  fes (f 2tmu ont4tee iieiatfsDraums;t)aeerir3tadlm elieo;() 2xmxrpiodom  licil() rtaxrpou1tpe ifetys a2ranmsnt4trxnmrctydfmDr uvi;t  2umxopny1amte ivsas srtruroot1open f3iydls2el(mp u0alxoif ia1fptrli o;s0srxoio3iu4alenlnesas)sDtrxm no4tlxn f3tydfm rmn p t4 exnxoctatoaD lueo;t)seurir3nu1ll nmfvsa(fs2urxro;u0tpe ifeild sDran pnt)tltnif todlaDe u s t0s2xmiopiydop n fetasfsrtru  ;o0olxn ieiatlsDeaump;t)teeoxfcoydfaD au ilt)trumim oudap elies t)a2umum nt0tex ii3iysfmDrm(mp;t4aetrmr3oo1lmD  iei (0sexmxmpoodolt  neiat sDum(rpnt0tltoioeiasfs2rl(vont4 rxnif oa1la ran o (0seuoim3ny4ap nlivsa(  rua(mono0tptn icilslm ea( pnt) etomf3oy1lpD au ilt)sruo(mpnydamenmieilsfsrrm(root4aee ifciadfs el(mp (0 leniocia1laDeau sl( srxr(opnodalt mivilt sDtrxm ;u4aex mociasfs2ranmp t0 exomr ty1op r uesl() eumxopoudlmtnmfeia() rrr(rpnt4tpxo ieilt s2emnvp;t0aeeoxo3totfmteln ol()sexm(m iy1llt lfcia( artaur no4apeo i3ildfm rl(vp;(0 rtniociytlat an olt0seuo(rpoudlmenmfeil( sDur(r no0tpenmieiyslmDrlnvp;u) rtoxr3ty1fmtr ivs s0 euoim oy1amt mfvsat  Duau pou4olenmfciysla uluvs;()trtnio3tadfa  lues t0 exoxo iodllenlncs t  Dtrx  ou0aexn ociyt a emu o;t0 etoiociatopt anes;s0trumio3ou1lptn fvsas) Dur(m ;o0oleo o3iaslm raumsnu0 renxr ootfp raivo;t)srtr(mpiu4lp n nvta(  rua(r oo4tpxo ieias m2emuvp t) rxrxf iatoa e ivols0t2xrxmpnydolte ieiasfsDuaxr ot4apx mocild a2emn s ()teenxr3oodom raivo t t2uoim iodalen icia(faDra(rp;o4aptnmi3tls sDrmnvo ()arxriocoa1fa r ieo;()trumio3oudap  miesa()s2urumpno0tlx  fcilsfa2uau snu)trtriocoadlm r nvsls0 euriopiu4lme  fesa(  2tm(mono1alxo ociyt m ulums;()arxrir3tadoat ln slt0 2uoxm nu1ap nmies sf rrmur oo1apeo f3iltfa2ra(ms (4aeenxr3iotop  ai o;(0t2uoiopnodlp  lfcsatf rur(ro;u4oeen octyt s2ulu o (4 eeoifcoydopt  i ilt)srxrxr3oydal nlfeiltfa2tmxm oo4tex mietlsfa2rmn sn(0 exomf oatoaD lieilt0 eum(rpoo4lp  mnvsa(f rrax  ot1aeeoifeildfm2ra(vs;(4 rermf todfmtrluvil(0 exr(o oy4ll   fcsas  Drmx p;o4openmf3iadfa rlu pnu0tetrio iy1faD auvsls0trxo(opoy1alt lnvt ( a2rm(  nu0olx  i3ilt m raums () rxnmociotoatrln ilt0s2trimpou1op nmivs t  Dtmx  ou4alt  fciyt a2uaums u4 lxnif3oy1lmte uvo ()seto(m iudlmt mncslsf Durxrpnu1tpt moctldfa2rmn pnt4trtnmrciy1fmD  nvi ( trto(opiodope mnvi (  2rmx oou0tpt mf3iat s2eanmonu0 rtrifcootfmteaiesls)s2xrxrpny1lm   ictl()s2uax pno0tltoiieiadlaDul(vp;u0tlxomo iotlmDeaivi ( srur(o oydamenmiciltfartr(r no4oexnifctlt m emnvo u4 exrifcta1omt  nvi;s)trtrir3iudoltnmfctl()s2rrx  no0opxoii3tys m ra(mp u)texoif tatlpt au i ( seto(m oy4ap nliesl()srtm(  nt1aleomieiydls ulnms;u)texomo3tytfp eaies;()s2urxo iu4opt liciat a2trxm ou0alxoio3iydfa rm( o;() reomociadfm   ueslt)teuo(r3oodom nmneta(  Dumu pot1apx  iciyd m ranvo;(4 lermfciatfmt  ueil(0srxmxm3nu4lpte feias arrmx pnu0olenmoctat s2uln p (0teermo3ia1fmt lueo s0 ruoio ny1ol elnvi (  rtmxr ou4oet  oetyt s2ea( s;u4trenif3ootfptrau s t  2xoio3ny1op nmfvtls)sDua(r oo0altoif3tls sDum(mon()alxrio3ty1fpteai ols tetrxr3no1omeelnei tfsrrrxmpou0tltomoeilt a2ua(mp;t4 rtrxfciadla rlivo (0texm(mpoo4lltnlnci (fs2tm(  nu4tlt moetlsfs rlumon(0treoxf iatlaD  nvols)setrxm3iydlm emiesa(fsDumx  ;u1tle moeiys sDrmn s u4aexrxocoo1fa eau ol(0t2umxopoy1ap  lnvsl(  rtmx o;o1olenmictlt s2rln s t)altnmf3todlpteanvsl( setrim3no1ole mnesltfarrmur no0tlt if3tltls2rauvp t)alxnxf iotlpte uvi (  rumxo ny4ll emies tfs2rax  ou0apxnmf3tlsfaDumu o;u4 lxrirctytla eanvi;t) rxrxopoudamenlncs tfa2rauro;u1apx mfetlt mDrmumpnt) rermfciytoatraies s)tetmxopnydlp nmfvsa(  rrmx pno0tltnifcild m2ean p;t) exrxr3tatla elies;t)srtrio3ny4ol nlfetlt  2um(  ;o1texomfeildfaDua(vp;u)tltniociadlatelu s s s2umir3nu1ome lnvil(f 2raumpnt1openiietysfa2ul(ms;(0altrmo3oydlmDrau o s0trxmirpoy1op nmfeta( sDuau pnu0oleomietyd mDea(vont4 exnxo3tadfmD anvs t)s2umir ny1om elfei tfs2rmxmoot1texomi3iatlm rmuvo;t0 rxnirciydom e nvs s) exo(r iodalenmivt ()aDta( ont4apto fciysfa eluvont4 lxnifcoa1om  anes;( s2xrxrpiudap  mfet t aDtru  ;o4aexnmociatla umn o (0aexrmr oatfpt an s (0 2tmiopno4opt mfctas)sDrr(moou1opxn i3ias a ea(mp;u0tlerxo ootoatrau i;s0 etm(r oudalenlneslt  2urx pou4opeo ictatfaDrmuvp;(0artoxociotoaD ai ils)seuoxrpoy4ole mnesls) 2ua( p;u4oeeomfeias m ea( ont0artomo to1opte uvs s teto(m3iu4ome  nvia()a2taur ;u1alxnmoetasls elu s (0 lxrmociytomtrlieo;s  ruo(r oo4altnmfcslt)sDurx  ;o4aeen icildfmDeanmp;t)trxnmo iydfmtrli i;(0 ruo(m3ou1am n fcsls) 2urx ooo4ole  ietyt a2emnvs (4trtomr3io1oat aies ()s2to(rpoodlp   fesasf Dtmu  nt4openmocias s umu o;(0 etnir oo1fpDr nvils0 rxr(rpno1altelfvt s) rrr( p;o0tpx mieiyt s2ran p;u4aetnioctytfpDrli ilt)trxo(r3nu1lpen fctatfsDuaxrp;u0ole  ieiydls umnvsnt0tlxrio iodom   uei ( srxmxo nu1altnmneiatfsDta(m nt0teenifctltlaDuauvon()aetrir oadlm eau i;s0srtm(r oodap emfeia(fsDtmur ot0tex iocilsls2el( p;u)tlenmrcia1faDe ivi;()teurxo3iodop  lfci t)a2tmu pno4olxnioetldfa raumo;()tetnxr iatlat  ivo;(0t2trirpnudalte nvt sfsDrr(mp;u1oexo oeiatlmDeln on(0 rerif3ta1om e ies;()trtmxo no4olenlieilt)sruau  no1aex  octldlmDrau s;(4aexrxf iatomtelivs;() rurxmpiu4llenlictat  rrau pnu1opxn i3iasls2umu o u0altrmfctodlmDrauei s  2xmio io1lmtn iet ()a2tr(mpnu0teeomictatlaDelnms u4alxrxo oa1latran sl()srtoiopno4lp   fctasfsDrmur ;t1opeomfciytfsDrlu o;t0 leoir ty1fmteanesl()srxrio ou4am elivtl(f Dur( poo0aet ifciydlm rmnvsnu) eeoxocto1fm  livo;t trtm(m3nudaptnlfvilsfs2ta(  nu0oexnmf3ild mDumu o;(0tltnmrcoatfmte ivsls0 rtrirpiudlm emiei s a2rrxr ou0apto i3tyd a um(vpn() exoirciodfmtrlneo;t teuoxm3iu4om   fvt ()srum(  ou4oet mo3tys s um(vpnt0artrxr3tydfpD an s;s0 etrio ny4ale lfcsat) 2tm(m nt0apxnioeiydlm2eauvs;u) leoxr3iy1fpDeauei t0 exrimpou4ome  nctat)aDur(moot4teeoioctltlmDra(mo t0tlxrxf3tadlmtrln s;t)sruoxm3nu4ll   fetatf ruaumo;t4ape mfctldlmDeaump u4aleomr3oydlp rlnei;s)s2umxmpiy1ape lfetasfsDra(  ;t4aleoifctydlmDrmnmon(4trxrio3tatoa  livils0s2xoir iudaltnlnes sfs2tm(ro;t0aetnif3tytls2umu sn(4altnxr tatfpDranes;s) 2xoimpnudlme livs ( s2umu oot0opx ii3iatfm ulumo;u0 rxrir3tatoat  ieils)t2xrir3io4apen nvi t s2trxrp;t1ole mo3iasfm rl(mp (4tlxnir iytfpt  nes (  2urir iudlm nmici s sDum(  nt1apenifciadls ran sn(4artrmo3to1oa  aiei;(0setoir3nydllt  iet t aDrr(rpno4ope  iciatlm2em( p;u)tltoxfcoa1fmt luei s s2xo(mpno1lleeliet ()a2tr(r ;t1tpen f3tld a rluvs;u0aleomfcoydfp  anes s srxrir3ny1oltnmnci (  2trum ;u0tle  ieilsfs rmump u)trxrxo iy1lpDeanvs;()t2um(opnodap emivtas  2urx  nu0oltomiciltla rl( snu) rtrmf iatlmt lnesls) rtoirpiodomee nctat)sDraump;u4oex mieiatfs emn s u4 rxrmo todlp   i slt) 2to(mpiydllee ncs s) 2rr(  nt1texnmociasfsDrlnmp u0 exoxr3tatlmDeluvs;()trum(o iu1al emfcilt  2raxm nu4tptoif3ilsfa2uau o u0texoxf tatlmtraneo s) 2xrxm3nodamtn fvtasfsrumx  nt4opxo f3tasfa el(msn() etomo todlat livo;t0 rxrxm oy4ol n fvsls) 2rm( ooo4alx io3iltlm2rm(mpnt4artnif3oy1lpD ln o t)setoim3io1ol nlnet t) Draurpnt0aetomiciys m eluvp (0tlenxr3oadfpt aivi;t0texmxm3ou1al  lict sfaDraumpnu1oexnifeiytls2ua( s;t) rtnmf3oatfm  aueo;(0trxo(r3iy4amt mfctlsfsDtr( pou0apxnmiciyt mDean p;t)aetnio3ootlp eai o t s2tm(m iy4lpeemivs s srrrump;o4aex moetat a2ua(vpn() lerio3oatfp  ai s;t trxrim oy1lm emfetl(fsrrauro;o1apeomieildlmDem(ms;u0aeeoxo3oydoaDeanesl()srtrxo3no4omeelnvs t  rtr(rono1aetnmieias mDem(ms u0aetniociadla elnvsl(0 eum(r oudalenmnetas a2uaxrpot1alt ioetlsfmDrlnvs;u0 ltoxr iodfpDranvo (0 rxrxm3io4alee fvsls)arrru pot4aeeoiietatfa eln snu4 rxrio todlptrluvi t)seto(m io1ale  fei (fa2ur(rp;o4apt  ictltlmDuanmsnu4 eeoxfctadfpDe ueols  rtm(m ny4opteliviat)a2urxro;t4oeeoifcild a eluvs;t0tetriociy1fmDeaueolt0s2trxm oydoltemfctl() Drrumo;u1olxn f3ias m2ea(mo;u)tltomocoo1la eau ol(0srtrxmpou4lptelies ( aDumxmooo1tlenmi3iydfm rmump;(0 rermo3iatom  ln ils) rurir iydlpenlfvslt) Drru ont0tetoiociysfs eauvo;(0 eenxf ia1lpt luvo;t  2to(m ny1omt lfeia(fs2taxroou1tlt  feiasfs umnmpn(4tetoif iydlp r n s t0teumirpiu4olenlivt t)arrr(m ;o1oetnmfctas aDuaumsn(4aeeoio3iadfat li ol(  rumim iu4ol emietasfsDra(r ;o1tle moeils s eaumo;t)tlxrxr3iadla r ieols0 2tmio iu1ll e iei tf rrmumo;u0optn o3iyd s2um(mpnu)trenxr iodlpDean o (0t2to(m3iu1opt mfeia()srur(rpou1tptnmieiadla2rlnms;u4 leoir ootoa  aueols sexrimpny4ll e feta(  2rau oou0tle iiciat s ra(vo t4artoxf totopteluvs ( teur(r nudlptnmfvtasfa2raxr ;u0tlxomieils m2ul(vp t4trxrxr3tatfmD  ivs s t2uoxr3no1op nmfvtat) rrr(mo;t0apeoifciltfaDuanvsn(4treoio to1optrauvi;() 2tm(mpio1openmieilsfartmx o;u1optnioetadfaDraumonu)texoif3ta1oa   i i;s) eto(r3nu1ole  nvs s a2rmurpnu0ape moctld m ra(mp ()artnir oy1fm  livi s0 rtrir oudopen fct t)sDtr( pou0apxo feiyd mDulnmo;t0trenio todlmt aueo;t)t2trio oo4am  mnes ()a2rrxmo;o1apx mo3tltls2eln onu0 lermr ty1lp eluvols srxoxmpiu4opee nctasfs2rrumont0alx  ietys a2eaump;t4trerif3ty1la  lu o;( srxoim iu1lpe lnes (  2uaurooo1oetomociyd m rl( onu0altrxr iodfmDr uvil(0 2ur(r3no4ll n fcil( srraxmpnu4tee  ocias m2ea(vs () ltoio3iadfa eauvo;t  euoxr ny4altnlneil(  Duaum ;o0alxnmi3iad mDea( pnu0aleoxr3tydlm  livi s0teum(opnydomt  ncsa( a2ra(  nt1oeenmfciad mDul(vpnu0trtrxr oadom eliesl(  euoxopou4ape lfciat s2ua(monu4tpxn f3tls a ranmo;u0 eeoirciotfp eanes;s truoxr iudlp n neslsfs2uru poo4olx io3tltfmDelumo (0 rtrmr oy1lm e u slt  euo(m3oo4lm n ivs s)s2urx pnu4apeo icilslsDem( s;(4tltoio3oy1lmte uvs s)sexm(m iu1op  mfcsa()srumx p;o0apxomf3iytfs uanmp;u) exoif totomtrlivs;(0s2to(rpnydame mnetlt) 2rrurpou1alxnmfeiltls uaumo t4tlxrmo io1fm eln olt)srxoir ou4lm e icsas  rtmumpot1tle mi3iysfm2rmnmo;u)texrio3oytfpDr uvs;t0trxmxo3io1aptnlncsltf Dur(  oo0olxo ociltlaDeln p;u0trenxr3oydomt li o;() 2xriopio4oltelncil(  Dtmx p;o4alx  oeiatls raums;t4 lerir to1om  lnvs;( setm(o nu1ole mfvias a2taur oo1oexomo3iydfa2rm(vs;u)treomo3iydfpDeli o s)setoio3ny4lle  ict (farum( ont0oeenifctlsfsDemn on(0texnir3iadfa eluvs;s texo(r3nudam emnci (fartrxmpnu1tltn i3ils sDuln snu)texnxo3oydla e ivi;t)t2umxmpou4ome lnvta( aDuax  ;u0opxomo3iytfm em( s () lerif oatlmtean o;(0 2xoio iy1opeelnciatf Dururo;t4oet miciyd aDeln p (4 ltnmocootop  aneslt0seuoio iodlptnlieia(f 2rmumono4aexo icias m2eau o u)trxomrcoytoaDe ivsls)seur(rpiy1ol  mneta()sDurx  nu0opx ifeiytfs ra( s u0 exnmf3iodlaDr i i;(0truoiopny1oltnliet (faDuaum ;u4texo ieiysfa2ulums;t0 exnxf3ty1fptr n s s s2tm(rpiu4llenmncs sfaDtmu  ;u1texomf3iasfa elumont4 rxoif iydfa eli s;t)trxmimpio4lmtemfvslsf 2rmxro;t4olxn oeilt a ulumo u)teeoxo3oy1fmDe neo;s0 2xoimpoo1ol n net ()a2ra(r ou1tlxn fcilsfs2ra(vs;t4 renxoctydfptelu i t)tetmio3nu1oltelfvil()srua(mpno0tlto f3iltla ulnmpn(4 etnxr3iydom eaivi;t seumxmpny4om emnct ()artr( pot1aex ii3ilt a rmnvs t0trerif tatfmDr ues;s)tetoxo oo1lpeemnvilsfartr(m ou4aexniieiydla rmuvont4artrmfcootfatrlueo;()teto(opio1amenmfcsls  2trurp;o4teenioctasfm ra(mo;(4tleoircoadoa rlnvil(0trum(r3oydlmeemivia(fsDtaumooo4tpeoifciltlm uln s;t)tltoxr3iy1lmt luei;(0srumio3iudam elnei ()aDtmumo;t0olt mfctlslmDem(msn(4arxnxf3oa1lmD lu s;s) eumxo iydol nmfei t aDumxro;o0opxniietasfm2umnvo u4 lenmf ia1fpDranvilt  etrxr iodlptelietlsfa2tr( ont4oeeomoeiytlm2ea(vs t4aeerxr oa1fa eli o ( sexoim3no4lleemfvta( srtm( p;o0aexn fetad a ea(vonu4tlenxfcia1fmDraneils)setr(rpnudlpenlncil()aDrr( ono4tee mi3tlslm2ea(mp t4 ltnmf oydlmtr u o;(0 rtr(rpiy4ale  fvta(f Duaumo;u1tlxn ociyd aDea(msn() reomociydfateli i;s tetmxm iu1lme  iesls)s2tm(  ;t1ale  ociydfmDea( pnu)tleoir iatfaDe uei (0 2xr(r iydame miesa(f rururo;u1apeoiictltfs2uluvp u0 rtoir tadlaD lneol() 2toir iy4lptelnci sf 2rmx p;o0tpx ioeiydfmDul( pn(0alxrmocoodfatraivols srxoxo ny1olen nctltf Dtr(moot0ope ii3tat a2rmu p () lxrxo3todop  ai ols)s2tm(m no1altemfvtas aDurx onu4tpto fetadfsDeanvo ()arxnmo3totoat lueo () rtrxm nydam elivs s  2tr(mont4alt mociasla uanvsn(0alxrxociy1la   i il(0t2urir oo1ol  mfcsl( aDrrurpnu0alx io3iadlsDuauvpn()aeenmf tydlp   ivs;(  rtmim iydlleeliesatfsDua(mono0alt mictadfa2em(vsn()alerxocio1fmDrli ol( srtr(m3oy4omen fes (fsDrmx onu0alenifeiasfsDuauvp u0 rtrmr3iadfm  aueo;t0s2xrxo iu4om   nvtl()a2ua(rp;t1tltomi3tysfs2umnvs ()arermr3oadfat  nvo s0sexoxo3oy4lltn nvs tfsrta(r ;o4apxnii3iydlsDeauvonu4 rtomr iatlp rai s t trxoxm3ou4om nmncs t  rtau  ;t4aexn oetad s ua(vpnt0trtnmf ty1oa r n s ()srto(m3iu4olenmivs sf Dum(mpou1tptnif3tyslsDrl(msnu)arermo3oy1omDrlnvs (0 rxriopnodapt mneiat  rur(mpoo4aee iietytls2ua(mo;(0altrmo3iy1oaD  n i;(  etm(r3oydlpe lnvtas aDumxront1open ietyd mDea(von(0tetrmr3tydlaDranei;(0tetmio nydalenmnvs t)a2um( oot0alt ifeildla uau p ()texomf3oo1fp  lu ols) rxm(m3oy1ol e fct tfsrraurpou1alxo ietltlmDrmu snu4treoif3ta1laDeanvo;s)seto(m3iudome lnvtasfsDta( poo4altnmocilsla uan ont4 leoxr iadoatrau i;t) 2tmir3iu1ll  mivtasfsrrr(mpoo4alt mfctat aDeaumo;(0tlxoxf3oo1faD au s t)srtmirpoy4lpe lics ()srur( o;u0aex ifetadla ranms;(0artnircta1lat lieol()trxo(o ny4lmtemictlt) Dtmu p;u0oeeomoetys a emuvo;t0 rxrxf3todop eluvols0 2xo(mpou4llt mnvsas  Drrxrp;u4oexo fetasls ra(vp;t4aetoif3iydfatelnvsls t2xr(r3io4llee ivta() rtmxmp;t0texomfciytlm2ua(vsnu4 rxnmo ta1faDrlneol(  2uo(m no4lm elfctasfaDrmu oou0oexnmo3iysfs2ua(vp u0altnir oatfatrln o s  2tm(opoydoptnmnetlsfsDtm(  ;t1oeto oeiydfs um(msn(0tetrxrcoy1fmtrlnei s0srumxmpoudale  ict s artaxmpnt4oeen ietaslm rmnvsn(4areoxocia1fm eau il(  eurxo3no1ap  lict ()srta(mpnu1olx ii3iytlm2ra(vo ()tltoio tydlm rluvs s srtmxo3nydaptnlivils aDumurpno4oeeo ieiyt s2rlumo (0aeerxrcootlmD  nei t0s2uoxr3ny4ap emnvi s)sDuaumo;u0oltnmi3iydlaDeaump;u0artrif3oatlm raneo s)truoimpiodop nmfvta(f 2ta(m oo1tlen ictldfa2em(vp;(0trtriociadlpteln il()setrimpou1alee fctas)aruaur oo0oexo iciasls2eln sn(0texoif ia1lateli ol(  2xoxmpno4lpeelncs s)sDumxrpoo1tleo oeilt m2ra(msnu0 lermfcootfaD lnvo;s)t2xoir3no1omtnlfetat arurx pou0tlt mo3iydfaDelnvp u) eeomr iotlptran ol(0teuriopoodlpeemfcs ( arrr(mooo1oeto o3iysla2umuvp t)aeermf tatlmtr ueols s2xoxm3iu1omee fvsas) rtm(ront4tpeoiiciadfa2umu on(4 rerxocoytlm r ivils)teur(o ny1alenmfvsas)a2tmumpnt0tltomfeiat m2em( s;t)aleomo3iatoatrli s;t)t2xmxr3io4ol n nesls)sDtrx pot1ape  ociyt a2rlnvon(4 etoio3iytopDrai o s)setmio3ou4lp elfcil(  2urur ;t0aptn i3iydfm2ul(ms t)arerxociatlmDrluvsls) rumxm3nu1al n icil( sDrr(monu0ope ifciatfsDemn p (0altnxr iatlpDelu i (0 ruo(m oy4omenlfes ()a2tmur ot0apenmictyslm2rm( s t) rxoir3totlp eluei;s srxmxr3iodll emfvtltfs2raxrpot4tlxnmfeiyd aDrm(mp u0alxoir to1opt luvo;s  etr(r3ou1ll  lnvsat) Duaur ;u1tpto fciltfaDum(vp u) eeoxrciydfat ai sl( trtm(mpny1optnlfvsl()a2tmxrooo0ope  ieias m2ulumonu4arxnir tytla e uvsl() exr(rpio4lltnmfvi s sDrr(ront4texoifctldfa2rlnmo;(0artomrcoadfaDe uvi ( trurim oy4optelivilt)a2ra( pno1opxoio3ild aDua(vpnu4tetrir totfp r nes;t0 etriopnu4olt lfct tfa2urxmont4tlenmfetaslaDumu pnu0trtnir iatlaDe nei () rtmirpoy4ope mnvils)srraur ou0opxnmictyd s2rm(mp;() eeniociy1faDraivsls0t2uoxo nydom emncsls a2rru pnu0altoioeiasfm2rlu p;t0aeerir iydfptelnvol(  2xrim iu4omenlnct tfaDtmum ;o4aex  fctasfs2rlumo;t4tlenir3oadlm eluei;t) exrir3iu1al e nciltf 2uaump;t0oexnmi3iatls2rmnmp;t0trtnxfcoytomte i o () rurxo ou4lptn fetlsfsrumumpot4altnii3iydls rl(ms t4tltnxf3to1oa   ivs;s t2urio iy1aptn ies (fs2tmu ooo1aleoioetad s2uau ont) exnxo3oatfmtraieo (0 rxmxmpoo1ap nlictl( aDrax  ;u1alxoiictldls2uaumo u)alerifcio1fpD liei s srxmiopoydlm elieia( arurum ;u4alxomiciysfs2ra(mp;t)altrxf iatfpDeluvsl( texrim3iu1al e ies (farrm( oot4aet mietld s uaumpnu0 eenxf3tadfmDrluvils)srtoiopny4ll   nciat arraur no0tpt io3iytfs2emumo;t4aeeomf3todfpt  nvils0s2ur(m ny1ame lfes (fsDumu  ot0tle moctadfs2ranmont) exomr ta1lmD  uvo s0sexoxo3iudalt mnetas) 2rrum nu0oltnmoetydfaDum(vs;t4 leoif iodfa r u o s srumxm oo1llt lfvta(f Draxrpnu1opeomicias a eaumo t4tetnmr3oa1fpD ai i;s0trxmiopoo4omt  ivtas  Draumo;t0oleoifetltfm2ua(vs;t) renmf3oo1oa rau i t)sexm(m3oy1lleemfvil(  Durxrpot1apto feiltfs2umnmp;() ltrmr3tatoaDrlieolt0 2xoio3oodapte fctat a2raxm ;u4ape moeildls elu o u4 rtoxrcoa1oa e n o;s0 rumxmpiy4apenmfcsls a2umur ou0alxnii3tydla ranmo;t)aeeoxfciatfpDr u ol()srtrxr io1opt  nct sfaDtrxrp;t0aetnii3ils mDea(vo t)arxnio3ta1lpDrlnvs s0trxmxo oy1omtnmietl( srum( p;t0aleomieiad s ul(vsn() rxnifciytlm elu o ( srumir3ny4oltnlivi t s2ua( oot4aptnii3ilsfa eau p u)tetomo iatoaD lieo ( t2xmir3oo1alenmnctlt) 2tau p;t1tpt  iciysfmDeln p;u) leoirciatlm elu i;s t2trxrpnodaltnlfet tf rumxmooo0aeenmoetyt sDrlnvp;t0alerif oo1lmDeln s;s0 rumxr nudoltnmfcs sfarrmu oou4alx  ieiadfa rauvo u0aexoxr ty1fa eau ols  eto(o nydlmenlivt tfa2raxmo;o1alxn o3tatla2ra(mo;(0 ltnio3oydlpt  ivols srurim ny4openlfcs t aDtru pou4aeenifciltlm2elu o u)aleomo3ty1lat aneo;t) rtm(m ou1alt lnvsls)a2tr( pnu4opxnmf3tad a2elump t0altnxr oytom eluvo;(  rtmxr nu4aleemneil(f 2urur ;u1aet if3ils s rmnvpn(4 lenmr oytop raivs ()t2trxm iudam nmfet t) rtaxm ;o4alxoiieiat s rmuvp;t0teenmfctatopt aneol()srtoxm3io4omen nviasf 2umum ;t1aptomfeiatfa rlnmo t0trtoxf todomDr n o;s)texoir3oy1alenmnet s) rtmxm ot0oltnmiciatfa2el(msnu0 rxrxfctodlaDe ivilt  exrir oo1ole  feilsf 2urx onu0aetomoeilsfaDuaumsn()teeomoctydfa raivsl(0t2tm(o oo4oltemnet s) rurum ;t4tpe  oeiydfa ul(ms;t4 rxnxo oatfptrau i;( srurxm3ny1lpt mfvsa(  Dtaxronu4aex  ietldlsDrlnvp t) reomr3oodlptrli o ()s2urxm3ny4llen nvs s s2rm(rpno1tle  icilt a2emu o;t4 lxnir iydfp   n o t) 2umiopiodlltnmfviat artrxrono4tetoii3iadlmDrmumont0tetrio oodopDrlneslt)srtmxo ny1ol nmici t  Dtr( onu4tle mieiasla um(msnt0 lxoxr3iotopDrauvo;(0 etm(m3oy4ap  lfcias)s2rmu  no1aee  o3tas aDea(vs t0 rxoxr3iy1opDr neilt)srxoxopoo4am nlies t  rrm(rp;t1aexniictld s2el( snt0trxnmocia1fp  anvol()t2uoxm3iudllt lnci ()aDra(mpnt0ope ii3iydlmDum(vpn(0alenmf3oytfmD  ivo t0trtrxopoodom elneias a2ur(rp;t1apeniicilt m2emnvs u0trxoio3iy1oateluesls)sexoxmpno1al e iet ()sDtm(mp;o4opto o3iyd a umn on() ltrmf tatlpDeauvol(0s2tr(o oodal e fes sfarra( p;o0tee iietlslmDumumo;u0arxriociotlpt  i sl(  rur(m oo1lmeelici s s2rm(r no0oleo ociat s umump;t0 exrir tytlaD  ivs;( seurir3oo1lptnmiciltfs2tmur ;o1texomfeiydlm2rmnmon(4 ltniocty1fpt liei t0setrir no4lm  lfcslt sDtr(rpno4tlx  fciatfaDraums u0teermr3to1fat  nvils0 exmiopoydomt lfcsa( artru  nu0tpe  iciltfm elnmp u) exnifctotlm rlueols0 ruo(o3no1lmtnlnvs t  rtmu ont4altoii3ildlmDul(vs t)tlxoxo oydopteaueol() etmxr3no4lpenmfeta() Draumont1oex mfcildfa2rm(mp;u4 renio oo1la ranesls)s2urxr oy1lmen icilt)srrmx  no1opt ioctls aDul(vo ()trtnmfciydfate ieslt)s2uoio3oo4lmenmfei () Dumu  ;o4altniieild s rl(vsn(0tlxnmo3ootfptr nvs;(0trtrxm ny1lpte nes ( s2tmxm ot1aetomi3iadlaDea( sn(0aetnio3iytlptr i ol( s2xmirpnu4lp e iet ()aDrmump;o1alx iietytfm ean on()texniocoydlaD livi;t s2xm(r3iy1om   feils)artrxro;t1apt  fciat a emuvo t4tlxrio3totlmDrai ols)t2xmxopoy4al e icils arta( pno4oex  octltlm rl(mo (0 leomrciotlmDeliei;(0texmir3ny1lm n nvsltfa2rmxr ;t4tlxo iciytlm2rln s () rxomf oytopte n s;s  rtoir3ny4ome lfetl( arururpno1oee  icildfaDumnmp u)alxrxo ty1lmtr ivo;s) rxrxmpnodllt mfcsat)a2uaxmo;u4apt  iciadfs2uaump (0 rxoif oytlaDr nesl( seurim3oodalt  fet ()sDua(rp;o0opt  fctyt m2eauvo (4altrif ootfa r nvilt  2ur(mpnu4amt mivia(faDtaxmo;u1aex mociytls2emnvpn()aeermo3oy1op raueils)trxo(opnudope  nesltfs2umu pnu0tpt mo3tldfaDemnmo;t0aeerxo iodop r uesls)s2xm(o3iu1aleemfvtas)arurxmooo1oltoifciatfaDuanvsnu)tltnxr3tydlmte ivo t)t2umxr3ou4am nmieilt  Dumu p;u1alxomf3tlslm2em(ms (0 reomr3ta1oa r i sl()truo(m3nydapte nctls)sDtax pnt0oeeo ocilsfs2umu s;u)arxrif tydlmtran o s0texmxr3oy1aptnlnesas s2rru poo4aexnmicildls raumpnu) exriociatfmtrauvi;s t2tmxm3no1llenmncsas sruaxro;o4tpenifeiyslmDuan snt)aexrir3iydfa eai o t)t2ur(mpou1ol   nci (f 2rau o;t1tptoii3tldfsDum(vpn(0trxnir iadlateln i ( trto(opiodomte fvsa()a2urump;u0oleoiieiaslm rln snt) renircoa1fmt lnvsls)srtoxopiydal elfcsat) 2ua(m ou0optn f3iytfa rmnmo t)alenif3oadfmDe u olt  rxo(mpou1apenmieia(faDrrxm ot0aet iieiadfa eanvpn() exrmr iy1lm  au ils) 2umir3iu4lpeelfetatf Dumum no4oee io3tasfmDemnvp;(0 rtnif iy1oaDe i i;s) 2uoio nu1omee fci s)sDrru  nt1tetn icils a2elums u0 exrxr iadlmt ln ilt) rurir3iydamtelics s)arra(rp;t0tltomfciydla ulu o;u4tetnif3tytlm  auvs;t)s2tm(r oo1al nmnvs sf Dtrxmont1tlt  i3tldlsDelnvsn()texrmrciodfpteluvo;t0 2uo(o3nu4opt mfvta( srrmx pno4tet ioeild m emn o;(4trtoxf3iytlaDrlneo ()sexo(m iodope mneiatfarrax onu4tpxomietys mDrlumont0alerioctydfaD lneil(  eto(mpnudlpeelieilsfa2tm( o;o1tetnif3iydfs2rm(monu0 lerif oo1laDelneo;( srur(m3iudaptnlfeils)sDra(mpou1tex mo3iyt m2em(vs t) ltoio3iodfatr nes s0srxmim iu1ll e fvia(fsDtmur nt0aleoii3ilsfm2em( s t0 rxrxo3oa1fmtrlnvi s) 2toirpou1op  lfcias  2rmurp;t1tlen fciyt sDrlump;u4alxnmfcta1fm eln s;(  rtmirpoo1op emfcsa()artmumpoo1ope io3ilt sDuaump t4 lxoxo tytlp  anes;(  rtoxo3oy4lpeemnesas)a2um(roou4alt ifctltlm umuvont)alenmf3to1lpDr uvi s  2uo(o3no4ap  lics ()aDraurpno0tlxo fetldls rmump (4tlxnirctytom eanes;t0s2toxr3ny4llt mivi ()srumx ont1optn ieiat aDrlnvs;(4altomr ta1opDe neilt) 2xo(mpou4lpt lneia()aDtr( pou1apx mo3iasfm2rlnvp u)aleoir3ta1opDe u sl() 2um(m iodope mnvsasfsDum( o;u4tpe  fcils m2rlu p;()tltoxr3oy1fpteanesls)sexr(mpoo1ll  lfct t  Dtr(r ;o0opt io3iyd aDem(vo;t4aexoif3totoa e iei;() rxrxo no4apt lnet s)arraum ot0oex  o3tydfs uan snt) exrxo3iy1oaD  n sl(0tetr(mpoo4amt lfcia(  Dra(  ot4aet mfetad s emu o;()alxnxfcta1fm rlivo t0 2uo(o oodap e ict s  2ra(rp;u4aptoif3ilsfmDeau p () ltrmr3totfpt  uei s0seuo(m3io4lpte fvt (  Duaxr ;o4tlx miciatlm2ea(mp;u4tlerxo oodfm r i s t seurxr3io1om  lfvilt  Dtrxrpou0tlen o3iytfa2rmnvo;t)trxrmociotop rlnvo (0truo(rpoydllt lfes t)srtmur ou4aeeoiiciaslm2ranmont4 etomo3io1faD luvi t0t2uoir3iudolt  ieslt s2uaur nu0aeeo ociydfaDra(vpnu4alenmfctodfpt luvil()tetr(r iy1lp n fvsasfa2ua(mpou4olen ieiydfm2el(vp u0artnxoctotla e u o;t) eurxr nu1ll   ieias)aDtau p;o1aeeomietatlmDul(ms;t0 ltoir ia1lp e i o t0tetm(o ou4lmen ncsasfarua(rpot0oetoifeildla2elums;u) exoxr3oo1optr uei;s seuoiopnydllenlfes ()sDumump;u0oeen ietasfsDumu sn(0tleoxr tytomD  nei t0s2xoxmpny4lpt mneil(fsrrru  no0opx  oeiydfa2raumsn()tlenxocoodlaD  ieo t) 2trim oo4lptelicias  2uaumpou4tpt io3iatfs ua( o t)trtnircootfm e nvi t) exm(o3no4op elnct ( sDrr(r nt4tpeo i3ilsfmDul(vp u4aeeoif oytopDeai o;(0t2toimpoudlptemfesasfs2rm(  ;t0tlx ifeiasfmDrlump;t)tlxoxr totfa   ivi t  2xmir no4ol  mfvsa( artaxmo;t1aetnif3iadlmDumumo;t0trxrxr3oy1fp rlnvs;s teurxm3nu4amt lfvsl()s2raur no1opxomfcildfmDulnmp;t)tetoxf todla  ai s t  rxoxm3no4oltn icslt) 2ta(rpou4ope iieiytfsDea(vs t)arxrircootomDelueo t0 euoir3ny4amtelfesltf Dua(  ou4alx iictadls uaumont0 ltnxf io1lp   i s s sexoim3oy4lltn ivt s)srrau  oo1teenmf3iadlsDrln p;t)arerxfcoo1lpD  nei s0sexoxo3ny1al eliei sfsDra(rooo4opxoii3ils s2el(msnt)arxoxf3ty1fa rlnvs;t0 etmim oo1alt lfvs ()sDuaur ;o4alt mi3iltfa rmnmo;t0arenircto1la rlneo t) etoio3nydlmtemfes tfs2rr(  nu1tpx mfetldfm eaumpn(4 reoio3ta1la eau ils) eumxr3iy4op nlnetlt srua(rpnt4aptn f3iyt sDeanmsn(0 exnxo oy1lp eanvs;s srtoxo iu4al nmnviatf rtaxmonu0optnii3tytfsDea( p;(0 rxnmf3iytfaDr ueolt teur(m3iydamtn fvtls arrm(rpnt4tpxnmo3iadfmDeanms ()tleomfcio1la elu o t) etoio3iu1op  lncs t aDuaur oo1aetoiociys mDel( p t0tlxomocoytfp eln slt tetrxopno1al elivil()a2raxrpoo0alt mi3ilsfm2um(mp;u4alerifciodlatraivs t)s2toio3nu4omtnmfeilsf Draumo;t0tpxnioeiytfmDum(ms t0 ltrir tadlaD lu o (0srtoxopoy1amtemnvil(f rtmxm ;t1teeo iciytlsDelu s;t) rxoif3oo1oatrliei s)s2toio io1lpenmivils) rur(moot4tet mietltfaDrauvo (0trtnxrcoodomt  ieo (0trtm(opnu4amenlfvi tf 2tmx onu4tlx  o3tatls2ea(ms u0 etrio todfp eaueo t0s2to(r oo1aptn ivtat)srtrum ou1olx iictat a2eanvo t4artnmrciatomDr i o s0setmxr3ny1alenlfcs s  2ra(rpnt1tpto i3iyslsDumuvp (0 rxnxo3oatlaDeai i t0sruoxm no1oltemivt sfs2taxr nu0alt  feiytla raump ()altrxocoadfm r n ols  2xmirpnu4al elfcia( a2rrumoou4olx  fciadls rmnmp u4trerxo iodlpD li s;(  rtr(o3oo4lm emfct ( srrrxr nt4oex mieild mDum(vp;(0 rtrir oatomtrln o (0 2xo(r3io4alen net t a2trx pno1altn oetyt a2um(mp;u)altnxr3io1fm rau o ( trto(o oo4llee nes (farrmur ;t1olto i3ilslmDrlumsnt4arenxrciodlpt anvsl() rxrio3ou1lp  mivtlt aDrmu o;o1oleo o3ias s2ean s t0texoio oa1om elivsls  eurimpou4ope  nvs ()srrax p;t4apeniieildls2rlnmpn(4texnxf ty1latelu ils srtoir3iudame mfetl(fa2tr(rpnt1tptnmoctyslm ea( o u0trtnmrciytfpteai i t) rxo(r3ny4oleemfetat)aDtmxmp;t4teenioetyd a um(vo;(4tlerif ta1lp  au i;s  exo(m3ou1ap elies t)a2rrx  ot4tleoiieiydfa2ea(vonu) lxomf3oa1lm  anvs;(0 rxoxmpnu4am emfcsls) Dtr(root0olenmi3tyd sDuanvo (4trxrif to1optrai s ( s2uoim nodopenmnviat aDra(rpno1tptoifeiadlaDumump t0texnmf3iotom eln il(  rtoir3oydoptelicil(fsDumx pou1oeeoiiciyt a el( snu0trtoir oadfpt lues s) 2tm(m3oo1lm nmfci tfaDrru  nt1oleo i3tltfaDrmnmsn(4alxrxfctytla  aueo;s0s2xoir oydlmtnlneiat  2trum no0tleniocilslm2ra(vp u4 rtrif3ia1lp ranvsls  etrxopiodlp nlfvi t s2ua(m oo1tlxn o3ilsls ra(ms t)treoxocoydopD ai s;s0trxoxm ou1am  miviatfs2umxm nu1aet  fciatla emnvo u)texnif oa1om eaueilt)trtmxm oydlpte nvsls)sDrmxm nu0tpxn i3ilsfm2umn pnt)teermo3oo1fmtelneo ()sexoxo iudap  livi tfsDrrxmo;u1apx ifctytfmDeln s t)trxomfcto1lm e ieol(0teurxopnodop   nvsas) rrmx  nu0alxomfeils a ul(vo;u4arxrmociy1oaD lu o;(  2xoxm3nu1aleelnvsl()arrr(rp;t0teto ociadfm rl(vpn()aeenxfciy1lpDeaivi (0s2xo(o nodolen nesl( s2tr(ronu1tltnmi3iydls2ra(vo (0aeenmr oatoa r ies;()setm(opoo1altemfeils  rtaur ;t0aeeomocild s ran o t0 lxoif3iatfm eaivs;( t2umxrpoo1llenmfvsls s2rm(  ;t1apenmietlsfmDua(vp;t0alerioctytlmte n sls0s2toimpiy4lpt mncs (  2trxm ;u4texniocildla eaump (4tetrircoatfmt auei s)t2tmxm nu4olte fetlt) 2um(mp;t0ole  o3ils s ulump;t0texrxr3iatfm eaiesl() 2xmiopiudopeemfcsa( s2rm(r nu1apt  o3tasfs2rln p u4 rxrxo3ootopDrlu s t)s2xrxo3iodll n neslsf rrmuronu4tee ifctydlm2emnvp;t4tlerxf todla rln o;t  etmir iudolenlivs sfs2ta( ooo4teeo o3iys mDeanmpnt4alenir3totop eauvs t)t2umir ou4al n fci (fa2taur ot1ole io3iat a ulumpnt0artoxocoodfa   nvi;(  rtoim3oo4amenlfvtlt)a2urxmpot4olt iieild s2rmu p t)aeerio3tytfa   u s;t0texrim3ny4aleelfeslt)a2trurp;t4ope if3iatlaDrl(mo u)aexriocoatla  auei;t srum(o oo1ap emfvil(fa2trxmo;t0oexnmo3iydfaDul(vp u0treoxr3iotlpteaieo (0 exmio iodale lfctat)a2uru p;u0tee mieildfa umnvo;()artomo iatlaDr i i (0srumxm iudlpe mfes t) rururooo1alxo ieiasfs rl(vo (0trxrir iodlm  lnvol( t2tr(m3io4opeemnct (fa2urx  ;u4optomietatlaDemn snu4 leomf ty1optrauvo;t)setmimpiodalen nei (f rurxmpnu0apx ioeiad m2elump (0 rxrxo3ty1lp  lnvs;s setmir3io4lp   nctas)a2taur nu4optnif3tadfm2ra(msnt4treomoctydlatraueolt)s2xriopoudoleemfcia()s2urxmoou0apxoiiciat mDem( onu4 eenif3oy1lpD lu o;s0seuoio3iudam  miviltfs2uaumpnu4tetnifciatlm em(vp;u4 rermr3todfatr neils s2xmxopoy4op elnctlsfa2tm(rp;u0aetn ietadfa2ra(vsnt0 reoxr oy1lp   ivsl( teuo(rpiy4ol e fes s srtr(moou0aexoioctadlaDum( o;u) lenxrctodop r u o ()seuoir ou1al   fetl( s2uax pou1tlxnmiciys a2rmn ont4artoif tytlm   nvi;( teumxopio1amtelnvi tfsrrmur oo0optn fcild m2rm(vpn(4tlxomr ootfmteluvi;s0s2uoxmpnudoltn ivias)aDur(mpot0apxnmociadla2um( p;(4trxrmr3iytlm  lnvs s0trxrxm3iodame  fvt s srum(m ;o0aexnmfctyd s eanmp (0 exomf oadoatrln ils0srxmxo io4ol   icil( arrr(rpno0tee  ictldlsDua(vo ()altrmr3oodfmD  u ols0srur(r3nydamtn ncs s)s2tr(  ;o0tetn fciys sDemn s t) rtoxr3totfa eaies;t)srtmio3nu1al n neias sDur(  ou0opxn oeiysls ulu s u4 rtrxf3oytfm rlivs;(0sexoir oodlltn ict t a2tr(mooo1tleoii3iyt a2uau o;u)alermfcty1fmt au ils s2tmim io1apee ivi t  rtr(rooo1aptomi3tatfa rl(vp;u0 rerir oatomt  i s;s)s2trim iydole  nvs s) 2ua(rp;t0texn ictysla2uln s ()trenxr ty1lpt auvo;s tetrir3iodom e ici (  rumx  nt0aetomfcildla eanmsn(0 lxrxr oytlmDrli s s  2uoxopoo4aptn iesasfsDtr( o;o4tpxniictldfsDrau p;()trtrxrctydfa rlu ol() eurim oydaptnlfcils)s2tau p;t1aexoioetasfsDeanvpnt) lenmociytopt lnvs (  rxm(opiudlpe  fvs t)srtmu  nt0tle io3tat mDrau s t)altrmo3todfatean s (0t2umxr oy4lptnmfes t)arrruroou4oex  iciadlsDuanmp ()alenmocty1oaDraivo (0s2xo(o io1oltnmneia() 2uaxmont1aptn f3ilsfaDelums (4aetnmo tatopDranesls  rurxmpnydolenlnei ()s2ta(ro;t1tpeoioctlsfs2emums (0tlerxr iytfat  u i;s t2xrxm3iudaptn netatfa2ra( poo4teenmf3iltls2ra(vsnt0alerio oodfmDrlneo;() 2uriopiodam elicia()s2ua(  ot1apeoiiciatlm eanvo u)trxnxr3oa1fmDrluvslt) rxrimpnudam elfcia( a2tmxmp;t4teenmfctldfa2emumsn(4teeriociytoaD  ivo (0s2to(mpiu4aptemfcil( artmurpou0aexniociasfaDemnvp u4alxnmfciytlp raneo t0t2xr(r ou4lmtnmivilsfsDrmx  ;o0optomf3iydfa em( o;u0tetoircoytop  lneilt)srum(o iu4oltemnctlsf rtaxmo;t0olt  fciltla rl(ms (4alxnir3ta1faD anei;(0s2xoimpnu1lm e fesa( s2rr(  nu4apen feiatfaDumumont4alxnirctadlmDeln o;s0 eumir oydameelnesl(  2uauro;u0altoif3iyt s2umu o t0aexrxr iy1lmtr neo t0seumxo3iu4lp e fesas)s2uaxmp;o4ape iieils aDrau sn() rxoxo3ootfp rliei;s) exmirpoy4omtemfcs s) rrmu pot4tex mi3tad mDuln p u4trerir oo1laD  uvi;t0sexmio3io4alenmiciatfarrrxmp;t1aet miciadfa2umuvpn(0tleomf tatom elneils0 etmxrpno1lmtnlnet t a2urx  ot0teen ieiytlaDrl( o;u)trenir ia1opt lneol() rtoxr oo1alenlict tf 2rru  ;o4tleomoeilslaDrl( s () rerifcoa1oat anvilt0texr(opoydoltnliviat sDtr(mp;t1tex ioetaslmDeaumsnu4aexnxfctodopD lueo;(0trtr(m no4oltelnetlt sDur(rpnu4tpen fctytla ulnvont0aetrxo oytlp   nvsl( trto(r3oydllen ics s a2urx ooo4aetn o3tlsfa rlnvp;(4tlxomrcta1om raneo;(0 exm(m3iy4lmtelfvsa()s2ra(rooo1tpxoiiciat a2uanvo;u0aexomrciydomDr nes s0 rxoim iodolt  nvt tfaDumum oo0olt  f3tld sDuaumsnt0aexrifcoa1oaDeln s t0t2umim nudlpe mneta( arra(m ot0tex  oeiaslaDum(mpn() ltoxrciatlpDeluvo;t)t2urxopou1apeemicsl(  rrmxmpoo4tet mi3iadfm rlnmsnt)trermocta1om e ivs s) eum(o nydolee ncs t arrau  no4tptn ociadlmDean s;u0 etnmr tytfa eliei t  rumir3ou1lltn fvs s) rtrxmpno4tptnifcilsfm2um( p t4alenxocoatlp elueil() 2ur(r3oodoltemneias arurxmpoo0tpenmictas aDea( sn(0aetrxf ty1op rlueo (0 rxm(o ou1omee icsas)aDrrxmont1tltomoetydfa umn p;t4 lxrxf iatlm r ueo;(0sexmxmpiy4aptnlnvtas)arurxm no1olx  iciytfsDuanvp (0 rerifcty1fp  aneo t s2trirpiu1alenlfei sfsrua(mpot1aleomf3ils m2emump ()altnif3tatopDeaieil()seurio3io1lp  mict (fsrum(mpot0opxniictlsfaDulnmp;(0 eermrciodlmDelues s0trur(rpno4op nlfet (  2tmur nt4opeomi3ild s ulnmo;t4alxniociadlaDrau s s) 2tmxo no4altemietl()sDtmxmpnt0tpeoioetasfa2rm(mon(4arenxo3ty1fmtrauvils sexoirpiudlltelfeiat a2rmur ;o1optoii3ildfm ulumon(0aexrifctotfa e ivs;t)t2uoiopnydap  lncs ( s2umur nu1texnmocild aDumn s ()teeomrctadfmtraivs;t0t2xmxr3iy4omtelfvslsf 2rrx p;u1tpt miciatlsDrmn s u4arxoiociydlmtraiei;s tetoxr iu1opt  nei s a2uaxrpot1tltnmf3iltfs2emu o u0 eenxr3io1lmD aivs;s trxrim3iodap nlfvtatfs2raumo;u1teeo f3iatfs ea( o u)alenio iodlat li o;s)seum(o3iu1ap nmfci ()srrax  no4opxoii3ilsfm ua(mo (4 exrmfcoa1fp  li slt0seuoxmpiodlp elnviltf rtm(rp;u1texnmiciaslsDuaumsn(4 etnmo ia1fpDraivi t  2xmirpoydalte nctasfa2urxmp;t0oetoif3tydfm rl(ms;u)aexoioctytfmt lnvi;(0sruoimpny1op n nesas s2uaxronu0texo iciyslm emuvo;u0artrio3iodoaDrlnvo;() etoimpiy4llte feslt s2taum ot4apen feilsfs emn on(4 leoxf3tydoa  aieslt0 rumir3oydalt  nvi (f Dtmxrpot0oexnmfeiatfm2elu o (4alxnif3iatfmDelnvo;t)trxr(rpno1llen ieiat a2uaxr ;o1ope mo3iadfaDemuvpn(4 rtnxf todlp  livo;()tetrxr3iy1opt mieias arrrumo;t0aeen o3tytfm ul(vp;(4 exomoctatlp  luvs;s)teurxm3no4llte fvs t s2tr( p;u0opx moctlsfmDrmums u4 ltnmociotlmDr ueo;s0setrxrpou4lp  lfvtlt a2ur(m ;u0tlenio3ild s rlnvo;u0altomr oatlaDranei;s)sexrimpou4ll nmivslt sDuau ono4tpx if3tld sDul( o u)tetomf iadfp elneols0teuo(r3io4lpe micsa()srra(ro;t4teen ociys s2rm( o;t0 rerxr3tadom elieo t setm(m3nodoltemfvtatfa2um( p;u4tpe  feiatlm eauvont4 rxnmrctytop rli s ( t2tm(m ny4olt mnctat  ruau pot0texomfcildls2rmnvp (4trtnxf iy1opDelies t0s2xoim oydal elnvi (farrmumpoo4altnifciasfaDrl(vs;t0 exoir ia1fm raieil( trxmxm3iu4opeemivi ()sDur(rp;u4teeo ociytfm2em( p t4artoxrcoydoateln o;( trur(mpno1optn nvsas)arrm(r ou0teeomfeiatfm ua( pnu4aexoio3oodlmtelivi;(0s2xoxr3nydal emnctatfa2tauront0tpto fciyt a uaumo () ltnmo3ootfa   ues t seuo(r3nu4oltnlnvsltfaDrmxrpot1tpeo o3tad m2ulnmo t)artomociy1lpt ln ol( srxoxm3ny4ll emnvils)sDtru ono1tptnmiciys a raumsnt0 rxomf3oatlp r uvs s)teum(m3io4lptnmiesls  rua(m ;o4alto ieilsfs um(vs (0aetrxfcoadoatr ies t) rtmxr3oy4om nmnvslt)a2taum no4tpe mi3iasla2ra(vsn(4 ltnxf ia1lm rluvil(0srumim3iydlm  lfviltfs2rrxrono4tlt ifciytfm eanvs (0artrio io1latrlivs;s)trxr(m3iodal e iesas) Dtmu p;u4tlenmieiys sDum(mo;t0alxnmfciatlmt luvs ()trxoirpoo1openmneilt)aDumu onu0oetomfeiyt m ea(mpnt)aexomo oy1fp e ivsl( s2uoxm3iudapeelics s)srta(moot4tlx ioctlt a rmnvs;t4teerxf3iytoa eaivil(  eumxopiy4lmt lnvsa(  rrr(  oo0apt  feilsfm rlu p t)treomo iytop rlivo (0setrio3no1llenmivtat  rtmxrooo4tpt mieils aDuauvp u4alxoxrcia1lmDelieo;s  rxrirpoy1ll   ncia()aDtrumoot4tltnioeildlmDrmuvp;(0areoxf oatfp  lnvs s0 2tm(o3io1lmtn fcta( sDtmumo;t4aexomo3ias s eauvon()areoif oadopDe i o;() 2to(o3oy4ame  ies ( sDta(rooo0alen ictld s eanvpn() lermrctadfmt  uvs;( t2urimpiydoltnmncias)sDrrurono4tpxnmiciydlaDeanvp;()teenxr3ia1fm raieilt t2toxopiy4llee fesls)aDtr(m ;u0oetn feildfsDumnmo;t0texrif3tydomt  i i;t)trurimpiy1altnmivs tf 2tmx  ot1tlx mociat mDelnvpn(0 lxoircoadlmtrlneils)sruoxrpoo4lp   fvils sDrr( pno4apxniieildls2eau pn(4arxnif3io1omDrlnvo s seum(mpio4amte fei sfartm(mpno4tex  oetysfs ul(mp;u4artomr3ootfmDr u i s sruoir iu1amenmfesas) 2umum oo0ope io3iytlaDemnmsnu)tltoxf iydomt  uvsls0sruoxo3iydap  mivta(f Drax ooo4tpxniieiad s2elnms;(0 lxrxfctydla r uvol(  eurimpoodlm emneil( sDtm(  ;t4teen ictas a2rmn p;(4tlxnmocoatlpD anvo t t2umirpnydol nmnvi t) rrmuront0tleomoeiatfs elnms u4 rxnxo3oytoptrlivi;t trxo(r iu1ll emncsls)sruaxrpoo4tle  oeildlm eanvsnt4 leoif3ootlm r i o;( s2xrxm3ou1lleelivt ()aDtmx p;o1tleomieiltlaDumnmo;t4 exomo oadlmtranvo;t trtmimpny4ap n iesl( srtrxr ;o4texn feiltfs2eanvo (4tltoio3ia1la  aues;s t2xrxm3nudap nlfesat  2tm(r nu0olx  fctasfm2umuvp (0 exoxo todoaDr uvo;s) 2umir oydlltnlfeiat sDur(r ;o0tlxomoeiydlmDuaumo t4tleoxf io1lpDrlu i;t0 exo(o3iu4op n ivt ( sDurxmono1alxomi3tas a rl( s u)trxnxf oa1opD aues t  exm(r3io1om nmivsas)srrrx  ou1openii3tatfmDrl(vs t)tetomo iatop rluvs;s0trxrxo3nydlptelfviatfsDtmx pnu0tlt  oetytfa2ulnmo (0tetrio ta1lmD lueil( s2xmimpoy1lp  lfvt () rtm( ono1apxoif3iys m ulumpnt)texoxf3tadop  auvilt0 etmxopiu4lmtelfvtat)s2raxm ;o0aetnio3iys a2ua( o;u)arxomr io1omD au o;s teur(m3no1lme  icsl(fa2uru  ;t1tleomf3iaslm2uanmp u)treoxrctodfmtelivols0setmio3iy4lp e fesl()arrmx pnt4oet mi3iysla umnmp u) rerir oydomDraivils)t2tr(m3nu4alt liesa( a2ur(rono4aptn f3tas m2el(ms;t)trtnxocoo1lm rlnvsls) 2um(rpnudllte ivt ()a2rr(  ot0opt mociltlm2eln o u0 ltoxo io1omt lu o s  rxmir3nu4lp elfvsl() 2uax pot1aleo oetadls2rl( pnt4 rxrmr3tydla  au i;s)setrxmpoodalee ivi () 2rr(  ;u0tlt  oeildfm umn o u4 etoxrcty1fmt  i o;s0s2urxo3no4am nmiciltf 2tax ooo1texnmi3iatfs2ulnvp;t0tlerir3oytfp rli s s  2trim ny1lm nmnvt s  Duaurooo4alt  fetlsla eau ont4 exoxf3iytlat  ieils srxrxo oudlpte feta()aDtmumpot4oltnmo3tatfmDul(vp;(4 rerircoydoaDr i i;t) 2urir3iu1olt lfctl( sDum(m ;u1alxoiiciyslm2el( p;(0 rermfcoa1fmD  ueols0s2um(r iu1op  mivtls aDuau  ot1alx  oeiydlsDemu o;t0tlxoxfcootopD li o;(0s2tmir3io1am emneilsfsrrmx onu4oet ifciyslm2uaumonu0aexrmf oydfa   uei () rtm(r3iudlme mieta()sDtauro;u4ale  o3iydfm em( sn()trxrxocoy1opDr ieo t)t2tr(r3io1alt lies tfsDraxr ;t4alenifciadfs elnvpnt4alxriocootlmD an o;t) rtmxopiu4amee fcta(fsrrrxrono1aet  i3iydfs2ulnmo u)teerxo3iodoaD au il( s2uoxr3nu4ol emivt t)arur(mont1teen fctldla rl(monu)altoxo3to1oat auvo;s0 2tmir oudop n net t srtmump;o0tlenmfciys m rln s u4artnmr3oa1fa rli i;(0 rumirpnydole  feiat  rurxm nt1tle miciysfaDuanvs;()aeeoxrcoo1lpD aivi s0texr(rpnudap  lfcsas)srtmu pot0aptniictys s2rl(msnt0 rtnxo io1laDr neilt s2trxr3iodlle lieil(f Dtrxro;u4tetomfeiadls2ean pn(4 eerio iytlmt ai o ( trtoimpny1apeemivtlsfsrra(mooo1optoiieildfa2uau snu4tleoifcoodla e uei t0 rxoxo3iy1olt  feiat)sDtrx  ;t1tpenmf3ils aDelnvpnu4arermrcoy1laD ln il() etoim nudom e netls sDrmuroot0tetomf3tyslsDul(mo t4aetrxo iytfa e ieslt)setoimpou4al elicias a2rm(mont4oetomiciltlmDrmn p (4alxrio3iotfp r uei;s0trum(o3iy4lmt mietat) 2rmur nt0tle iieild a eluvp;(0tlxoif oo1fa   uesl( s2trirpou1lmt mnct ()a2tmuroou0ole mf3iys m emnvp u0 rerir3ootfmDrlieslt)setmir nodalte ivia()aDtrumonu0alto fciydla el(vo;t0tltomociytlp elnvilt)s2ur(o ny4omte icslt a2rm(r ;u0openif3iatla uluvpnt)tleoifcio1latrlnesls) 2umirpiydllt mnvs (fs2tmx ont1tlx  octas m umumo;u4tlxrxo3iytfat luvo s)trtmxo nydlmenlnesls)sDurxr ;u0apx mo3tas a eanmo t0aexnir3tydfatrau o;s  rxr(r iudap emfcsa()sDuau pnt4tltomoetlsla2ul(vp;()aetoxr io1lmDranesl( sexmxm3iu1lptemicsa( artmuronu0tet mfciatla el(vsnt4 etrxr tydlpD aneo s0 2xrxo iu4olt  icilt  Dtaumpoo4tptomo3tas a2ul(mont4trenmo3iodoa eln o;t) rtoio3oudlmen fet ()aDrr(r ;t0tpxnif3iys m emn p;u) rerxo tatlmtr n s ()seuoio3ny1olte neiatfsDtmx ont4aee mfetlsfsDrln ont0 etoif3iodopDelu s;t0 eur(o3io4optelivsls)a2taxmpou1oetnmicilslm2umu on()alxnxr ta1lpD  nei ()t2ur(m iy1oltelictl( aDrrumono0oleomoetas s raumo t4areoxo3iadoateai i s0 2uoimpnudalt mnvs s a2rmumonu4oeeo ieild a2uan p;(0aleoxrcoatopD  ivs s)srurxrpiy4openlfctlsf 2urxr oo4oetoif3ils m2uln s;t0 rtnxf iatfmD lnvo;s trtmxr3iu4lptemnvta(f Dta(moou1olx if3iytlsDel(mp t) rtrxrcoatfmte i i;s) rurio iu1ap   nvil()a2taxr no4tpt ioetlsfs rl(vo;u4 eenio oadfp  lneo (0sexmim3nodopee icsltfa2ur(root0alt  o3iat a2ra(mon() rxoxociydlaDeaueo s)seur(o io4al n ict s) rra(  ou0opt ii3tad aDranvs;t)teenmr tytop e nes t  exmimpoydamtnmncs (fsrtm( onu4altniietadlmDumump (4trtrxf to1opte u olt)setmim3ou1lpenlnesas)aruaxr ;o0oeen ociaslsDranmo;t0alxoioctydlat luvo;() eto(o nu4op e nctas  2uax pnt1opxomociasls2ean o () eenmo3tatfa rlies t)s2umxo3iy4op n ivia(fsrraxmont4apxomi3iytlm uanvpnu4trxoio iydom   uvil(  rumimpny1om emieia(fa2rr(mono1ale ifctadlm ulnvp u0 lxrio3totfaDe ies;t0t2urir nu1omt mnet ()arta( p;u0tpxnmictasls rmnvont4 rxnio3to1fm  aueo;t trxmir oudll   ivt t  Dtau pot4opeomi3ias m emu s;(0texnxocty1faDr ivs;t0srumio3nudop nmnetat)srur(mp;u4tetoii3tytfa2rmu s;(4tlxnio oa1lmDrlueo;(0s2uoxo3ou4lpeemfci (f rra(  ;o4apeoioeiadfa2rlnvp;t)altniociotfaDr ivs ( setoxopny4lmt mfet tfa2taxrpnt0tpenifcild mDrm( o;t)arxrir oatla raivo s srurxmpoo1lmee ncs t)aDumu  no1oltomoetldfmDulnmp u4arermf3tydom e i i;t) 2xr(r ny4olt lnvtas s2um(m ;t4apenioctad s2rlnvo;(0alxrxfctatfm   nvo;(0 exrxopiudom e nes () Dumuronu1olt mocildls2eluvp;() rxrxociytfa r u o s srxmio3iydame  fet tfaDtru o;o1oexomieilslm2rlnmp t4alxoir3tatfmtean i ( srtrio3nydomenlict t  2uaumpoo1openmiciys mDra(mo;()areniocoodopte uei;s  rtoir3no4amt licsa() Dumuro;o4tpe ioeiytlm ulnvp u4 reoio iadlp rlu sl(0s2um(m nodam nlfvs tfa2raxm nu0tlen oeilt aDrlu o;u) etomo3iatopDraivo;s)s2ur(o3oy4lp n nvs (  rtrur ;u1olen f3iat m rmn p u0 lxoifcoy1om  liei ( texm(o3oo4alenmiesa()sDtru pnt1aexn octadlm2rm( p ()teeoxo to1omt li ols)s2uoxr no1lpt mnciltfaruru ooo0texomieiatlm rl( o t0tlxniocoodlpDelies;t tetoir3nudape  ici tf 2raum ;o0tpx  ieiysfaDumnmo;(0tetrmfctytoat aiei;s  rxmxo3iy4ope mfct (  2tm( p;u1texoifeiad sDul(vont0alenmf oadla rai o;()trurxo nudaptnlfeilt arumurp;u4tpxnmi3tas a rlnvs ()trenxr3ty1lp eaivo s0sexm(o3oudoptnmivsl( srurur nu4tet mfciyd s rlums () rtrio ia1omtranvo s s2tmio oodope lieils)srum(m ;t1tlxnmiciyd s rmums ()aeenmf3tytom rli ols0texrxmpny4ameemnesl(faDtaxmpnt4apxniietadls2ranmp (4 lerif3ootomteaues;t trxoio3iudam elnetl()srtmxmpot4tpen octysfs2raump t0 etrmociy1fmtrau i;(0s2xm(opny4am nlnvia(f 2rmumpno1apt  o3tadfa2um( s;u4 exoifctotlatran s;t  eurxo3ny1lmt mncsl( aDraxrp;t4tpxo feiyd a ran p;t0areniocoytla eanvsl( teur(rpiodome lfeiltfsDrmxrp;u4altnio3tad a elnvp t0 lxrxrctodfm rlieils0 euo(r iy4opt  fciltf 2rrxrpot4oltniiciyt mDuau s;t) ltrmf3tatom   uesls)setm(m nudom  mfetas srtmurpnt4altnmoeiyd s rauvs t)teenirctotoa rlueo s) 2umxm ou1ll  lfvils  Duaxm no0aexomoetydlm2ul(mo;() reoxf tatlm  aivi s sexmim io1lmt mivta()s2ur(mpot1apxoio3iatfs2ua(ms;u)aleoxf3iatop e nvo () 2tmir nudlltelnetltfsrrmumo;t1teenif3iadfs2em( s;t4 leomf oydfat au s;()srxoir3ou4lptnlfvsas aDrau pot1oeenio3tat m2ea( p u)alxrxo3io1oatrai i s0teum(r oydlm nmfeil(fa2rmxr no1oex mo3tysfs emn s t)tetniocta1lmDe nvsls s2umimpny1omtnmfcias)srur(ronu4tpt  oeiasfa2rlums;u4 rxrmr oytfatrai s;(0texm(r iu1lm nmfcslsfarua( oot0aee mf3ilsfaDranvp t0trtomr3iodlaD anei t s2umimpiu1alt liei tfs2ta(mpot0tlenii3ilt sDuan s;t4 lxriocoatfp  luvi;s0trxoimpoy4lptn ici tfs2tmxmont0aeenif3iydls2rmu snu4arxoircto1fa   uei;( s2umimpio4lmen ictls)s2trur nt0tetnmoeiytfs rm(vp;() ltrir3oytlp  auvsls) 2ur(o ou4omenmfet ( arrmxr nu4aexnio3tls a2umn s t4tltoxf oytlmtraies;s  2ur(o no1apenlies () rtaumo;u1aexniociat a rm( ont0arenmf3oytlaDran i s0srumirpio1ap nlfeil(f 2um(  oo1aeeoif3tlt a2eauvs u4alxrxr ia1fm  lueils) exmxr nu4apeemfvs s a2ta(  ou1aexoioctltfaDuauvs t0trtoirctotoaD lues (0t2toxrpiu1ap nliet tfsrrm( ooo1oex mietlt m2ea( s t0aexoio oatlpDe uvil(  2uoxo3no1lpenmics t sDuaxr nu4altomieild sDranmpnt4aetoxo3oa1fat  iei;(  etrxopiudamen fvtat)s2umu  nt1apxn fetld s uln o;()texrifciadla   ivo s0s2umxr3iu4oltnlictat a2tmxr ;u1olt ioetldlm uauvs (0arenxo3iytfmtran o;t0trtrir3nodlp e fciatfa2tax o;u0tltnifciadlsDul( on()aeenmf tytomte ivo (0trxrimpiudale lfetat arra(  no4olen f3iadfa2rl( pnu0artomrcoy1fpt li s;s0sruoimpno1lp nmiet () Dtr( onu1aex  oetys m ul( o;() exomfcootfa raueilt setr(rpou4ole  nctl()arraxmonu4tex  ociasla2rm( p;u)arerxr3oy1laDeluvs;s srxoxr3iy4ape  fctas)sDrau  no0aptn ietatlsDum(mo;u0tetomf3tytlat au o;s  ruoim iodapenlneia( s2ra(  nu1aleo iciytlm rlumo (0texrxfcoy1la rlies s0sruoxo3iydamtn fviasfsDtaump;o1tpxn oeiasfmDua(mp;(0tetoif ia1lmtelueolt0sruoxopoy4lle  fvi t  rrm(root4aptomoetld a elnmp (4treoifctytlateanvslt0teur(opoo1amtn ieil( aDtr(r nt0apeoii3tydla2uau o;(0aexnmfcoodlp ean olt0 rtmir3oy4ape lnvias) Drrx p;u4oleoii3iysfm2rl(vo;u) lerifcoa1fm e nvo t0s2urim3iy1llt  ivt sfsrtmurpno1alenmf3iat sDraumpnu4trenmoctatlateli sls)s2xmxmpiodoleemfvi ( aDtm(r no0apxomfeiydfsDeaums ()tlenmr oytfmDrau slt) 2uo(o3iudap   feiltfarum( ont0tlxo iciasfm2rlums (4 rxoio3ty1lm   ivo t t2xmim ny4lmtnmici sf Drru  nu1aee mo3iad a raump (0alxnmo oydoa  li ilt)srurimpny4amtnlfcia() Dtmu  ;o1aet if3ilsfm2uanvonu)trxrmr to1lat aivols  eum(r3no1olenlfcsl(fsDua(ro;u4tlenmi3iys aDemums (4 rermf3todfmtelu o;t) eumxr3io4om e ncslt)arua(rpou1opxomf3iadfaDuanmpnt4alxomr3ta1oate uvolt)t2xr(o3ny1opt mneia()sDta(  no4aptniociasla2rl( p;(0teenmoctytlpDr ivi;t s2xmio3nudlltelnvta( a2ururpno4oltomo3iydls rau pn(0 eenxf tydfmDelnvo;(0trxm(m io1ll emnvtas arur( o;t1alx  oeiyd a2uln s u0 renifcto1faD livo ()setmirpny1ape mivtl(fs2rrx o;t4aexn feiltfa emnvs;t)tleomr3iydfpDelies;()texmim oydom emfvs s s2rm(mono4oeeomfetatla elnms;(4tlxnmr3totomD au i;s sruoim3nodllt lnctat) rur(m ot0alxo i3iatlsDum( on(0treoxo3iydfa eli i;t) rxrir3ou1ol elfet s) rtaxronu1optnmfetytfa el(vp u4artrxrctotfmteauei s  ruoxr3iy4aptnmies sfarur( o;t4opx  i3iadfsDumnvp;()alenio3iytlpt anvs;t) 2toim3iydlltn nvs tfsDtmx  ;u1opxomoetydls2umn p t4aetomf to1oatrau i;(0 ruoim3ny4al nlfeiatfsrtmxro;u4tltomiciys a2uanvp t)tlxrmo3ia1fptrli olt0tetm(opiudamenmnctat  Dtmumo;o1oeenioeiydlaDemuvo (4tlxrxrcoodomtr neil( teto(m3nu4oltelfvi ()aDtrur ;o4ape  fetls a2ulnms;(0trenio todoaD ln s ()trtoxrpoudom  mneilsfsDrmu  ot1tlx  fcias s um( sn()tlenif oatopDraues;(  etm(m3oydll nmics ( s2rmx p;o4oetnmieiytlm2umumont4aeeomr oytfpDrau o;(0t2urxr3iydop  lnvtls)s2ua(  no0opxoif3iadla2um(mo;u0 ltnxf3tatlatrli s;s trtm(mpnu4oltemfci ( aDtrxrpou1tleomf3tld m2eanvo t)texrxr iotoptr ivo (0 2urxo3no1op   icsas)aDtr(m ;u4aeenmf3iat aDumnmp;(4tetomr iatla eluvi;(  eto(r3ou1ap n ivta(farta(monu1aptomi3tat s rlnvp;() rtnmrcoa1omD  nes;() rxr(opoo1lm nlnesa( a2trumpnu1tlxnmf3iadlm elnmo t4 lxnxocoa1fmtelnesl(0s2uoio3ou1lmtnmivslsfaDrm( o;u4oltnifeilsfaDumu o;t)trxrxo3io1lpt ai i t setrxm no1amt mivt s  2taxmo;t1tpeoifeiat a2uluvsnu4altrxfcoatfatrluesl( srtmxo3io4lp emicsl( a2ra( pou1opx  ociytlm eau snt) rxoio3oadlmtrauei;t) 2xoxo oydape  ieiasfsrraxmp;u4apenmicildfs rl(vo;t4tltoxf oatlp  aieslt) etrxopnudaltnlicsltfs2ra(moou1olx moeiltfmDem( s;t4 rxrir iodomDeln slt  rxm(r3ou1ol emfvtas) 2ururpot4tpto i3ilsls2rlnvp u0aexomr3iydoaDeanvil(0 euriopio4ome livtl(faDuax pnt1opto feiat a rm(ms u)teenmfciydfm   i s;s0 rurim oodom elfvil(fsDrmxrp;o0olx moeiatls2el( snu0teerir3tadfm rluesls  2umirpio4lpt lnctltfa2taxmpno4alenmfeiyt a ul(ms;(4tlxrxrcty1lm rlivo;( s2tm(r oydalenmnvsa(f 2umuroou0olxoif3iadla em(vp;(0 eerxo3oy1fat  u i;( srumimpou1ap emicslsf 2trxr ;o0opeoifcilt m emuvp t)trxoxrctodfa rlueol(0srxoxo ou1omen icils artaxm ;o4tetn o3tls a2rluvsnt)tlenmr3iodoaD  ues;() 2umxmpou4amt lnvils) 2ua(ro;o4oexo o3iatlsDra( p;t0 rtrxo3tatlpD auvs s)t2to(o ny4llte iet (fs2trurpot1optnii3tyt aDraumon(4tlenmf3oa1op rau i (0 rxmxm3nydlme lfvsa( srtru p;u1tle mo3tls m rmn s u4alxoirciytomDelieol(0truo(r3oo4ame livi ( a2umxm no1opxn oeiat mDeaumsnu4tlenxf3oytop rlneo s  rumir iu1lm  mfetas  2ur(r ou0opxn feilsla2rmn snt)alxnxr oydomteli olt  exoir oy4apte ieil()aDuaum nu0tptoifctltfsDelnms t4arxrir iatlmt aivs s0tetmio oodol nlnvsltfs2um( p;o1tlxniiciyd s2rmumo;(4trtnxocoydfat  i sl(0 2tr(rpno4optemfcs tfaDra(ront1ole  ietydls2elnvp u)tetrmr iytlpt  ieo s s2tmio3nu4lme  fctatf rraurpno0tlto f3iatfsDul( p t0altnmo3tydoat aivo;() 2tm(m3oodape mivs tfa2ur(m ;t1aptoii3tltlm2el( o;u0texoirctydomtr nvo s) 2to(rpoydomenmnci () Drm(m nu1tlxoioeiatfm2el(mo ()alxnmr oadlpD ai i s0tetm(m io1llt  feiatfaDuaur ;u1tlxnmociatlm2emnvpnt0 exomrcoydlaDeaneo s0teumxr3oy1ol nliet ()artmxmono1apenmociltlsDelnvo t4 leoif3oodoa  lneo;t)srurirpiy1amte ici s)srtr( pnu0altnioeildfm ul( pnt) rtrmf todfpt  uvs;t0s2umim3nu1optemnvi (faDurxmpou1apxnmfciyd sDrmnms;t) rtoir oatlpteaueilt) euoxm ny1ale  fciasfs2uax ooo4apxoiociyslsDrlumo;u)aeenxr3oatlmDrau i;t0seurir3iu1lle liesas)srtaumooo0oex mo3iyslmDulnvp u4aexnxfcty1fa eau o;()tetoxm no1olenmieia( aDrrumo;t4tleomf3iyt m rmnmp (4alenxf3tytfmD lueo;t teurxm iy1lp nmfvs tfaDtaumooo4oltnmieiad a2umnmp u0arerif3todlmD an i;s)t2ur(r iu1oltn nvsas aDtmxmp;u4olt ioeilsfmDrl( snt4artrxo iy1fmte uvs t0 rxr(opnudal   fcsasf Dua( p;o4tlx  ictadfmDrm(vsnt4 rxriocoa1omDe nvi (0 2urim nydoptnmnvsatf Drmum no0aeenmo3iyt s ulnms;t)aeermf3io1fmtrauvo;t)s2umxrpoodop n fcta(  Draump;u1tlto icildfm2ulu s;(0 rxoxocto1om eai ils sexoxr3iy1apte fcta()artru  ou4optomf3iydlm ean s;(0tetrxr3to1fa rli slt sexmxm3io4ame lict t)artmu ont1opx mi3tadlm2ul( s;u4aexrmo tadfaDe ieo;s0setmiopnudal emieils)a2rm(r no0optn fciaslaDranmo;(0artnmo3oodfmtrai s;s  ruo(rpoudol  lieilsfs2tax o;o1oexo o3iatfa2ua(vp;u)tetrif3todfpDelnei ( s2tmiopno4olee nvtas) Dtaxrono0tex  fetld mDul( pnt)aexrmoctydfp  auvol()texmxmpno1alen ncil()a2uau pnu4teto ieiyt s emn p u0 exoiociatlp rlu ils srtrir oo1op elfcsasfa2tmu ono0aptn f3iyslm eln o;t) rtrxr totop r ivol()s2uoirpiudolee ncia(faDrru pno4tltn fetltfa2uln s t0 rtrmf iytlptrlueil(0 2xrir ou4llee fci (  2trx  ;o0opx mo3tls a rlnmp t4aeeoxoctytfp  aivsl(  2to(m3ou4am  micta() rur(mo;t1alenio3ilslsDemnmonu) renio iydop  luesl( srxoxrpoo1amte ncta(fsDtm(m ;t4tex moctlt a2ul( p;()tlxrirciatom  aiei s0trur(r3iodlleemnes (fa2um(mpnu0oetnmi3tld a2rluvpn() rerif3tadfm rlnvils s2xrxrpiy4apen netas)artru oou4aet  oeias s umump (4altoxr tadlmDr i ils)srxm(opio4amtemnvi (  2um(mpno1teenmo3tatls rm(mp;u0artomo tadfptr uvo t)seuo(m3iydale lnesat  2tax onu0altoioctytlm eanvo;(4 exnxrctadfaDrliesl(0t2xmio io1apee icta() rrru  nt1opxnmi3tydfa2uln s t)altomf3iadoaD  ivs;t)srxrxm3no4olee ivsls sDta(rooo4oexn i3ias mDrm( o u)treoio iotfaD au o s)srto(r oo4op  micsa()srtrumpoo1apxomieiad aDelu p t4 etnxr io1oa rln i s truo(o ou4lle  icsa(  2rrxr nu4ole mf3iydlsDrmnmo t)tlxnxr3ty1lm   u s (0seumio iy4am  liesa( aDumu poo4olen feilt m2umn pnu4aetnifcio1lpD  u sls)srurxo no1lpenlnvia(  rtmx  nu4tex mfetasfa rmums t)tetrif3to1fat lues;t) rtmirpiu1amt micsl()arurxrpoo4alen oeiys mDran p (0 rxrxr iytfatranes;(0sexrxm no4llen ncil( aDtmx  nu1tlxn o3iysfs2ra( o;t)tlerif tytlp  ai il(0t2xo(o3nu4optelfcilt arraum no4ale if3ils mDrmu s;(0 ltoif io1fpt  u o;(  rurxo nu1lpen ivia(f rum(moot4aptoioeiytlaDumn pn() renxf oydoat livol(0t2xmimpoy4altnlfvi t)sDtmxr ;u4alenii3iyd a2uau o;(0artomf3oadfaD lneo t0trtr(r3oy4amtn feilt  Drau onu0tltnifctltlm2ra(mo;()trxnmrctadlmDrauesls s2tr(m3oo1ole  fes tf Drmum oo0altn oeiadlmDum(ms u4 lenxociy1fa eaivs s0srxrio iy4alt livi (  Dtmumpot4tptn ocild sDuan p (4tetnmoctotfp  aivo s0sexrxmpoy4apeemiet s a2ua( o;t1aetnioeiyd s2rm(vo;u4aeeoxr iy1omtrli o;t  2uoio3ou4ape lfct ( a2tmu pnu1oleniieiyt a ra( p;u0 lxoio3oy1lp eau i;(0t2trio3nodoleelfes t) Dum(mont1oetniieiadla el(vpnu4tlxrifcoodlaDe uvolt srurir iydoleemnvtatfsDuaum ou1oexn i3tysfaDrmums;t4altoircty1lptr u ols)trumim3nodape mics (f Drrurp;u4oee  ictat s2rm( o (0 leoif ta1fp e ivs;t)s2tmxmpny4olte nvsa( s2urumpot1tlx mfetyd aDuluvpn(4 reoifciydla rlu o t0texr(o3iodalt lieia() 2trxr no0tleoioctls mDuanmo t4 ltriocty1fp eauvslt) 2xr(rpou4ol nlnvil( a2tr(mpot4oltoioeiysfsDea(vp t4texrio oo1omtr nvs;t  eur(r iu4am nmiesls)aDrm(m no1aeeo feiatfa2eluvpn(0 etomr oadoa  lnvol( texmxm3iudlmt lfcs t srrm(  nu1alxnifeiyt aDelu p;t0arxnxo3iotlmDe i i;(  etoxr iu1llte ivsasf rrrx  ;o0tlxomfeildfa em( snu)alermr3oodlm   ueo;( seuoimpiy1ll nmnvi ( s2uaumpou4olxn o3iatfsDeauvs;u) rxoir3oytla r ieo t  rur(o3oy4lmtemnei (f Drr( oou1ape mf3iltlaDumnvs (0tlerxrcoatomte n o s  rxm(rpoy4op nmfct s  Durur nt0aleomiciaslm2umumo;t0tleomocia1lmteanvo;() rxmxr3iu4om emfvsas)aDurur no1tpx
\ No newline at end of file
@@ -0,0 +1 @@
+uvo;s0 rtm(r3io1olenlfeia()arumxmo;t0olxo ietlslmDrln onu)tlxomo3oadfmDeau il()tetmxrpnodap e fcta(f Duaur ;o0tlxn ociadlmDua(ms u4altomocty1fat  u ilt  2tm(rpnudap nmict s)sDtaxrpoo1optnmfetyt aDran s;u0trtrmo3iodfptean s t0t2urxrpoo1olt mfcslt a2uaxr ot1aetnmo3iaslm el(mp;t4aexoxfcio1faD  n o t  rumxm nodlm  mfet s  rrr(r ;t0apt moetat s2ea( o (4arenir3ootop e ueolt0 exoio oo1ameemnctas) rraumoot1alx mf3iytfa2rm(ms;u4 lxoxo3io1omt  i i;s) etoxr no4olen iei t  rtmur ;o4optn o3tlsla2eanvp;(4 ltrmfctotlmtrli ol(  2uoxm iydoleelfvsas)a2uauro;o4apt  fetlsfsDeanmp u0alxnirctatom eaneo ( texr(mpny1aleelnetlt) Dtm(r nu0tle ii3iyd m umu ont4artnir oodfatrln o t0s2ur(opio1oltn ics ( sDtmxr ;o1aleo octyslmDemnvpn(4alenxociodfmte nes t)trurxr3iodoptnlfvsls sDurxr oo1olt ifciasfm elums u) reoir oydlm ran s s sexoimpou1lpenmivia(f rurxm ;u1olxnifctasfs umums (4aeeoirciy1op e nvo;() exoir oydapen ieilsfsDurumont4oex  oeiadlmDumumo;t)aeenxf tadfp   ivsls)srumxr ny4ole mfcslsfa2rrur ;u0apto ietltfs ranvp;(0 lxrmocoadom eanei;t0srxrimpnu1alenlnvsl() rtaurono1opxnmiciytfs2ua(vont)aetoir oy1opDraueols0t2xm(o3ou1opte net ( sDur(r ot0aexoifetaslmDea(vs;()aeerxr oadlmDrlnesl( tetmxr3iu4amte fvi sfsrrru  oo4oee ii3iltfmDuauvonu)teeoifcio1oaDraues;t0s2xr(o oodapeelfcs (  Dtaxrpnu4tetn fciatfsDraumon(4altnmo3oodoaD anvols)tetoim3iodap  lici (  2rmx  ;u4oet iictasfm um(vs ()trerxr3oatomDrlieols0 ruoio3nodole livs t a2raurpnt0tlx  feiatfs rl(ms (0trtnxr3iotlaDe ueilt t2tr(mpio1op nlivs t  2urumo;o4alto ieiltfa rlnvo;(4 etnxr3to1fm eaueo s  2tr(r oodamtnlfcsatf 2tm(moot1ope iieiydlm2emn pnu)alerxr3oydfmDe uvs s trxriopnudope livi t  rtru  nu0apxoii3ild a2el(mo;u)aetnmr3iytfmteanvi;t0 rtmxmpnydalt  ncs ( aDta(ro;o4oet ioeiad aDua(vonu0texomo iadop  lueol()s2xoxm3iy4lpenlnet t) 2urxrpnt0tltomieiltfmDrl( sn(4tlenxfcoytla   ueo ( teuoxopiy4olen ietls aDurxmono4alxnmietldla2rlu s (0trxrirctydfp elnvi;s) rxrxopoy4om elivt ( aDumx  ;o1aleo octltfm ul( p (4 reoxfctytfp e uei;s0trum(r no1omtemieslt a2rrxr nu4olx io3tys m2ulumpnt)texrif3oydfpDrln o;t0 etm(mpoo4lltelnvsat artrxmooo4openioetad a2rmuvonu0 reoxo3iytfate u ils tetmxm iy4opt mfcil()sDrrxr ;o0apeomfeils a ra(mp;t4trermfctadop eluvi s0 2urirpoydlptemnesls)a2rm(ro;o4oltomf3ild mDrm(vsnu4altnmr oydla e nvslt tetoxo3iy4ll nmivta()a2uaxronu0optnioetytlmDran p t4 rermo ootoa ran ils0 rtrir io4opt lneia( aDtrx oou4alxo o3iysfmDelu pnt0 rxrxr todlaD lnei t  rxo(opoo4ale lfviasfsrtrumont4tptnmictadla ul( s t)trerir iadfm rlnvs t)texriopoy1lmenlneslt)srumumo;t4optoiociys a rluvp (4 rxnif oydfa r ieols0t2to(o iu1op nlfes s  rrrum ;u0apenmoeiatfmDumnvp t)texnxo iydlmDrluvo;s t2toir nodop e ictl(farrru pnu4alxo fetys sDuauvp;t4alxomo oydlm  aneslt)setoir3nodam elivt t  2uau pou4teeo oeiasls eaumsnu) leomf3oy1lm elieo ( teurxr3io4alen fvsa()srtr( oot1tpxnmfciatlmDeanmp;u0alxnmf oatfm   ueol( trtmxrpnydap elivilt  2umxm oo0aptnmf3iad s ua(mpnu4tetoxrcoatfmDeaneo;t srtoiopoydolee nciat sDumxrono4olen fctas sDumu pn(0 lenmf ia1opD ai i s s2tr(r ny4lpe lfvslsfsDurxrp;u1opt ii3iat a rlump;u0 rxnmf3oytfa rai o;t0t2urxr nydalte nvta()a2rmxr ;u1oeeo i3iat m ul(vsn(0arxrmr tadlmD ai i;s srxoimpoy1op  mfvils)aruaump;t4oexn i3iltla2uln o;u4tlxnxr iydoa  lu s t)t2toio oo1oltn fvilt sruau ont1aexnmo3tltla2umnvont4 exnif3ty1op rlnvsl( srxoimpou1omenlfesat)aDrrurpoo0tltoiietldls2rluvp t) reomf tytoat  neo (0srxr(m nydop nlivtlsfs2ur(rpou0oexoio3tlsfmDrlu pnt)arxnxf tytopt  ueo;t)srurimpoo4lle liesls)s2rr(mpoo1aptnifeiltls2rlnvp;(4arxoxfcto1fa  aueo (  exo(m3nu1ap  mnesl(farrmxm nt1tlenmoctytfa2rm(vo;u)aleoxr3iy1lmDr i sls0 2tm(r oudlmen fvil(faDrrxroou1teenmf3iasla2emnvon()artoio ia1opt anvo;t0s2xm(o ou4aptnmfcil( artax  nu0tptomf3iyt s ul(msnt0aleoirciytlaDraivs;t) rxrxr iydome lfcilsfsDtru pnt0apenif3tad a2rln s;u4 exoio tydoateluei;s0srxrirpiy4optemieia( arrmx pou0texoif3iadla2rmu o;t4 eenmf3iatla r iesls)texm(mpiu1omte fei t  ruaur nt1opt mfetas s2uau pnu)tlxnxr3iytfmte n o;s) etmir3no1amt  ies sfaDrmxro;u1olenmoeiad a ul( o;u)aetoio oadfpDe iei ( t2xrxmpio1am elfcil(fsDur(mp;o1teeoif3iydfsDul( s;t)tetoxf3iodoa rlnvslt0srtrxmpoo4lle  ivsls)aDra(r ot0aeenii3tasfaDulump;()aexnxf3oa1fa e nvs;t0s2xm(rpoodolenmfvtatf rta(mpno4ape  f3tldls eanmo t0alxoxf iydom rluesls)srtmio3oy1olenlneslt) 2raxmooo0oltnmfciysls eluvsnt0 lxrifcty1laDran olt0sexr(mpiu1ole  nvtltf Draxmp;o4tpe  ietadfs2rlnms;(0aetoxf3oadlatelnvil(0srumxm ny1ol e icia(fa2tr(ront0tpxn octat s2el(vo;u0trtrmr3iy1oa eaivol()t2urxopny4lmt  ncsa() Dtaurono0aeeo i3ilsls2rlnmpn(0 ltomfcoodlaDe nei;t)s2um(rpoy4opte ict tf Dtrxm ou0tlx iieils sDrauvo (0aleoxo oo1fa rai o;t  2urxmpoodop n fesls) 2trxrpno4tptnmi3tldla2ra( snu) rtrxfcio1fm rai olt texoxrpiydlp elnetas)aDuaurpoo4tpeoii3tlsfsDran p;u4 exrio3tatla r u sl(0trxr(mpiu1oltnmieilt srrmurpot1olxomociaslaDra(vp t0tltnxr3tadlpt luei;(0t2to(r3iy4lptnmicslt) Dtr(  ou0olxn fciaslmDua( sn(4 eermf3oa1la   uvi s) rumirpiudap nlnesls) Dtru  ou4tlt ifetldfm ra(mo u4teenxo tadoaDe uvo;t0trtoxm3oodoltnlnctls)aDumu poo4alt iietadls emn p u0altomrcoa1fpDe uvs;()setr(mpnydalt lfcil()a2uaxrpoo0oeeoioetatfsDrl(vo;t0teenmo3iatlptrauvil(  2xoxopiy4lp n neiat  Durx p;t0tlxn icildla ea(vpnt4texnifciy1fmtr neo t) 2to(r3nodlp emnvtlt  2rr(rpno4apenmicilslsDul(vpnu4tlxoir3iodlpteanvilt0trtmxmpnydlp emictl()sDtax ont4aleo f3taslm2emumo;t)tetnxociatfp elneo ()srtrxo ou1al nlnetls)s2um(m nu0alen i3tltfa2rmu s;u4alxoxr3oodoat au olt0setoim3nu1lmtemfctls) Drr( poo1oexnmfetysls2ul(mont0arxriociatfpDeanvi t) rxo(mpoydom nlici s) Drmumpnu1tptomi3ildfs emu s t0 rxrmf3tatlm ran ol( seto(r oodame mnvtls aDra(rpno1opto ocildfaDulumo t)tltrif iytfpD  ieols0 eto(m3nudop  mnvslt)s2trxmont0ope iieilsls2rmump u)aexnmr iotfpDr nvsls)teurxopno1llt liet tf Drr(mooo0tlxnmoctysfa2elnvo (0 lxoir iytlpteau o t0trxr(opoo1omenlfvsl()srua(rpnt0olxn f3tasfmDranvo u) exoxo3todla elnes (  etr(mpoydlltemfesl(fs2rmu  no0tle mi3iyslm2ra(mp;u)trtrxr oytfa ranei;( tetr(o oodamtn nctls srra(  oo1olxo feiydfsDeau snt4 reniocto1lpD  nvs ()trurxrpoy4oltnlics s arraxr nu1ole miciytla umnmpnu) rtnmocio1oaDelnei t)t2urim iydale lneiat  2tmxmo;o0tex  oetat s2ra(mo t)tlxoxf3ootlmD lnei;t)t2tmxm3io4aptelfcia( aDum(rp;o0apt  octatfaDuluvo (0 rxrircta1fm  ai s t)trxo(opoydaltn ivil()s2ua(mp;u0oltoii3taslsDrau o u) ltrxr3iadlmDrlnei (  rxo(r3io4lpe mfvsl() 2rrxm ;t4ole mocilsfs2rmuvp;u4 exrio3oy1fate u s;t) rxmio3oo4amt  fesat)srtm(r oo4alx mfciydfm2uau o;(0 etrif ia1omDr ivi s)trtm(r3ou4lpt  fvsl( s2ra(rpot1aleo fctadlm ean on(0 etrxfcootfa eanei ( srtrim3nydoptnmnvtatf rtmx o;o1aexoiocilslsDumuvsnu) lxnioctytlp   ivo;(  rto(o3io4aptnlnvtls)a2ur(m oo4alxnmi3tysfm rlnvp;u0treoif tatlmDr iesl(0 exo(rpiodllee ncils) rtau  ot1altnmoeildlm rm(mo u4 leoio to1laDelnvil(0 ruo(rpny1oleemnei sfs2raumoot0alenmfcilsfmDean s;t0teerxo3iytfp  ln o;s setm(r3iu1amt  ieiltfs2rrxmo;t1alxnmicilslaDelnms;u4alxrxr iatop  auvsl() rxm(r ou4om  licsatfs2uax ooo0tpe mf3ias m2elumo (0tltnmrciy1op elies;() etm(rpiu4lmenlneils) Draxmont4tlxn ieiydlaDrmnmonu0texnir3oydfp eaivi;t t2urim ou4openmiviltfarurx  no1tlxoiietlsla2elnvsn() lenmf3todfa ranei ()srtm(opoy1ap  lnetas)sDtax ooo0oexn i3iys m uan s;(0trenifciadfm raiesl(0truoxr3no4apee ncias)aDrru p;t4opt mictydlaDel(mon(0aleomo io1lmD aivs;()srto(r oydom  mncta(fs2trxrpnu1ope mieiatfs ean ont4tlxnxocia1la raieo;t s2ur(r oy4llenmneta(fs2urxm ou0oetn ociys aDeau o;u0arxoirctytlmtr ieo ( t2xrio3no1aleelfct tfs2uaurono1olenmictasla umums;(0altrif tadopDeli s ()t2xrxr iu1amt  icsls)s2ua(rpou1opx  feiadla2em(msn(0trxoircoadop rlieil(0seurxo3oy4omenmieil(f 2trxrp;t1altnmietlsla2emu snu)alxrmfcoytoptr ueols0 rtr(o oo4lpenmivslsfs2rmx pou0oexnio3iaslsDrm(vo;()tetomo ootfmD ai i;s0trxr(opiudaptn iei (fa2ta(  ou1oeenmociatlm2el(vpnt0 rxniociodlaDeanei;t s2xriopoo1lm  miei s)arrrxm ;o4aet mo3tys aDua( p;t0 etoxociadom eau o s t2xmxr iu1omtnmfci (  2raur ot0aeeoif3ias a ua(mp ()tlxoio3ootomtean olt0srtr(m oo1om e fes (f 2rmurpoo4opx ioetls s ranvp;(0alxnxo iydfmtelies;(0s2xmxm3oodomtelieiltfaDra(  ;t0tltoiictld s2eln sn() exomo oodlatrlnvols  rtrxr3oo1ap  lneil(farraumont1olx  fciad sDrlu pnu4 reomr3oo1lmDeaivols0seumir iy1altemfcs ()srrmum ;t1tpe ifeiytla emnmpnt0 eenxr3tadfa eln s;s0 rtoio iu1omtemfesat artau  oo4aetnio3tltlm rmu snu0teerio3oatfp  lu i;s0s2xm(m3iy1lp e iet (f 2uaump;u0olxnmiciaslm2elnvo;t)tltoio oa1op rli s s t2umxmpnydamtnlict sf rtr(mp;o4tltomi3ild a2ulnmont0trxoiocoodlaDr i o;(  rurxo3oy4lpt mfetls s2rrxr ot4oeeoioeiydls2ra( o ()arerio oa1faDrln o;(0 rto(opio4omtelfvil( srur(ro;t1tex ioctysls umn o t4 leoxrciatop  luvi s)srxmxopiodamtelfes tf Dtr( p;o4tpe iiciydfs2rmumpnt) reoif oa1oaDrluvo t  2trxo3nu1lptelfcsat  Dumu  ;o1oee iiciasfmDrauvp u) eerir3tatoate n o s)seumxr3ny4al elicils srumx pno4tpe  i3iydlm2uluvs;t) ltoxf3ty1lmDrlivs;t setoxrpiy1opt  nct ()s2umx o;t4tltnioctas mDrl(mpnu)aexoifciadlateanei;s s2uoxm3iy1lmte fvslt) Drauroou1tlenmfctys m ua(mo u4tlerxrciodlmDr uei;( t2xmxm3nu4lltnlivta( a2raur ot0tpe iietydfs2rauvp;t4 ltoxo3iodlm e u slt)s2xmxrpiu1lme mfvsls aDrmxmpot4teeo o3iyd aDuaums t4trtomr3oy1opteluei ()t2uoxrpnu1omeemfetlt)srta( oot4olxoif3tasla2elnvsn(4trermo io1fpt auvs;(  2to(mpnu1apeemnetas) Dtr(  ;o0alen ietys a elnvs t0 rtrio3oatomD livi ( trtr(o3oydol  lfetltf Dta(mp;t0oex mieiasla2umums u4 eerio ta1optrlivils)sexo(o3iu1lm elnci t)sDrr( o;o4alt if3iat s2eluvp () reoxr3io1omt  ivolt)trurim3nudll nlncias) rrm(m nu4apxomoeiysfa ulnmon(4texomo ta1lmDr n s ()s2tmimpnydaptemncs s  2um( p;o0olxnmieiys s2rmn pnt4trxniocoadomDranei;t0 rxm(o iu4omt mfci ( sDrrx p;u1oetoio3ildfs2uan pn()tetoxo tydlp  aies;(  2to(opiy4lp nlfcia()aDrrxmooo4ale  ietyt sDum(vp ()trtnmo ia1omtrluvo s0srurir3nu1olenlnes t) 2uaxmpno4texniociadfm2ran o;t) eeoxrcio1op ran o s)trumio nodolen nvils  rrm( oou1opx ifctys mDrl(mp u0arxrir oodfmD  uvi;t  rxoiopoo1al nlnctat  Dtr(r ou1aleomoeiysfs2eluvont)trerir ia1fa r iesls  2toir3oodal emici (faDrr(rpnu1aet iieiad s um( p;t) etrxf3ootfm ran il( teuoxr3iudomtnmncsat sDrrx pot1opto ociydlmDumu s t0 rerircoydlptrlu ol( t2toimpnodlpt lfct t) rtrumooo4teto feiytfsDeluvpnu4aexoiociytom raneol()sexoxrpiu4ap   fet t)srurxrp;o0tet  i3ildls rmn s;(0 eenir oydlmte nvolt0s2urxm3iydolen netat  rtru oou1tptoii3tld s2emuvsn(0arxoxr3oy1fmtranvo;s0 etr(mpnu1olt lfvs t s2rauronu0texo o3iadls rmuvo;u0aleoxrcoytoaDr i o t  eurirpnu4ap  mfcils) rrm(rp;o1oexn fctysfm rlnmo u4 reomf3iytfaDelu s s0t2uoxr oy4amee fci t artaxmp;t1apenii3tyt a2em(vp u)tleoiocta1fptrauvi;s0 rxmio iu1opte icil()s2tax o;o1apxnii3ilt m2ea(vs (4texnmrcoatfptrai s () 2xo(rpoy1ol  livils)aDrmu  oo1tptn i3ilsls2ea( s;(0 rermrctadom elnei;t)t2urir iodlme lieias a2uau  no4altoiocilsfm2rm( s;() lxrxo iadlpDeluvol() exr(m3nudopenmnctlt)aDrax  nu1olt  o3tldls2ulnvo;u4tleomo3oy1fa r i s t)tetr(r3ou4lm elieia(fa2raxrpou0tlenifeiytla2eanvs t)treomf3oy1op  li i;t s2trir iy4ol   ictltfa2tauront4opxomo3tad mDulnvpn(0 exnir3iydfmD lnvo t) rtoiopoo4ll n ics sfa2trx o;o0aeeoiictlt s2uaums;t)texnmf iadfa   u o;s0t2trxr iu4lmtelicsas)aDtmx pnu4aex mieiad sDemn o ()trtoxrciatfp   uvol() 2umiopoo4omtelivtas  rra(rpnt4aptnmi3iasla emu o u0tlxnxo3iodlateaues;s0 2tr(r3iy1omt lfes ( sDrr( p;u4oleniocilsla emums;u4tltomr oy1optelivslt0trto(o3nudop  lfvt sfsDtax  nu1optn feiad s umu snu0tetomocoytla rluesl() ruoir iy1aptnliei () Dtmxmpnt4tltn ieiadla eln o;t4 leomrcoydfa  livsl( t2toiopny1apenmnci () 2uru oot0olxomietlsls rln onu0trenxfcoydlaDrlueol()teurxrpnodolen ietlt)aDrr( pno4teeoii3iat aDum( p u4 lxrifciotla  aieo;t0trtoxr3no4om   ieia(fartru p;u1tex ifciytfa2ul(mont4artrmrcoydla r ivo t t2um(rpou4alt mivta(  rtax  ;u1tee moctlslaDrm( o;u4 eermfcoo1fat lneol(  rxr(rpno4alee fei s arrm(ronu0tlto feiat s rl(vo;t0 renio iotoa  aneo ( srxmxr io1lmt mfvilsfsrra(rp;u0aeeomfeiatfm2rm(vo;(0aeeomociodoaD  nvo s)t2tmir3iodlpen ivs ( aDtr( pno1alt ii3ild m2em(mpnt0 exoifctodlaDrli s;s0srxrim3ny1ll  licsl()aDtaump;o0aet  f3iytla2eluvsn() exrmf3tadlptrauvi s t2umxrpoy4alte iesl(faDra(  ou0apto f3tytfm2ulnmo (0areoxr3tytfp e nei;(0 2to(mpou4optelnetls  2ur(  no4tpeoifeilsfa uan snt4 ltomf tytfaDranvs () etr(opnodolen fctlt  Dra(r no0open o3iysfsDumumo t)alxrmo3iotoaDran s s) eumxrpno1lle lnetlt a2tmxmoou4aptn fetasfsDraumon(0tlxrxfciotopt luvs t) eum(r oodaltelfvtlt)sDtmu poo4oexoiiciat aDum(mp u0tlxrir3iadfp e nei s)texr(o nu1openlfvsat) rurump;o4olt  ictldls rlnmpnt)aeeomf to1optrluei t0tetrio3oo4omte fciltfaDumuroou1apto feiaslm elnvpnt0arxoxfctatlpt liei;()t2tm(rpoudllt lfciltfa2rau pou0apt ii3iydls2eln p;u4 rtrxr oytlatean slt  2toim3nudom  mivsa()srtrur ;u1tlto i3tatlm2uaums;() ltrxrcto1fpDe ivi;t t2tmir3nu4lmt lfvi ( aDuau ono4ape  fctltls rluvp;u4 rxnmf oytopDrln s;t teur(r oo1amtnlivtlt)aDrmxr nu0olt mfeiat a umums;(4alxoif oo1lm ran o;(0setoimpnydol   ieia( arumxr ot1tlto octyslm2eau o t4trtnio iadfaDr ivolt0 2umir iu1optnmnvi sfsrum(m oo1tpxnioeiad aDuan on()tltrmf3oadlpDeaiei s  rxr(opiodop elnct s)sDrru ooo0opxomf3tyt a2umnmp;u4tetoiociodoaDeln o s  etrim ny4altnlfeslsf Drrxrp;u4tetn f3ildfs ea(vo t)trtoxr3oytfpDrlnvs t) rurio nydope lfvi s  Draxmpno1apt ifeiyslm emuvs;u0texnxo iadoa  li slt)setrim3io1lm  mneta(  Dra(rpot0optnmfcilt mDemnvo;u)texnmf to1lmDrli i;t)sruo(m oo4lmtelnct tfsDuau ont1tex  iciytla emn o u) etomf oadopt ln o t seur(r3ny1alte ics (f rtm( pot0oeenmoctltfa2rauvp u0aetnir ty1la rlneolt)setr(opiy4lptelivt s)s2ta(r nt1tetn fciadla2ea( snt) lxnxr3ta1op elueo t0 exoir iudame  nvils) 2tm(  ou0opt  i3iltfm ulumo ()alenmo ty1oate iei;t0srtrim oydll e fctl(faDrmurpoo4oee iieiydfs2uln pn(0tltrxrcoadlatr neil() 2uoxopnu4omeelicsasfaDuax o;t1aeeo ieilslmDrmu o;() lxrio iydoat lnvi;(0 2to(o oy1omenmivs s)a2rm(m ;t4alxomo3iytla2uau o;u4alxoxr3tadlmtrai i ( trtoir3oo1ame lfeil(  2rmxr ;o4aetnmfctadfmDrmu o;t4alxoio ta1fm ean s;t  rxmiopou4lm  micsls srurxr ot1tpt io3iys aDrmuvonu)trenxr3oadlaDeanvi ()seto(o no1lm emfviat) rrm( p;u1tptoii3iysls2uau s (0aexrxf3oatlaDrli s;t seumxm3ny1lle  fct sfsrrm(rp;t0olxoii3tytlaDrlu o;t0artnir3oadfmte ivi;(  2tmir io1llt lict (fa2raxr ou4tltoiieiytla2ean p (4 leoxo3iy1lpte neo;t0sexoio3nu4amtn fesltf Dra(m no1oee io3ilt mDeanmo u4alerxrcio1la r i o;t trumirpou4lp  lfeiat  rtru pnt1optniociyd mDuanvs;u0trenio3tatlmDeaies;t  rtoio3iodlm emnvtatfa2rrxm ;o0tetnmf3tld s elu s;u0aeermo oa1lm  livsl(0t2to(m nudlle mfctltfs2taumoou0altnmoctad sDrlnvs;t0treoxo3iodop  anvo;t0sexmxrpoo4lle mfcta()a2uaumo;o4tlxnioeils s uluvo (0texoxocoydfmD  nvo;(0seumxm no4altnmnvtat  Dra(  oo4openmfeildlm2eauvp;t0trtrif oo1lpD  ues t0sruoxo nu4ol e nvt t)s2tmx p;u1apenmfeiatfs eanvs;u0tltrmrcia1op   i ol(0 rtrimpiudap nlivia()arua(rpno0apxoii3tlt a um( pnu0 renmr io1lmDelneo;(0 rxoxmpoo4lmtelnvias arrrxro;u0oleniocildlm2emuvo;t) exrmf3oytlpDr n o t) rto(m iu4optelfei (fs2um(moou0opxn ieiydfa raumo;t) rtnif iodoatr u ils srum(r3oodlpenmfcsl(fsDta(monu0tpeo ieiatlsDuanmp ()treoxo3ta1fm  lnvils)t2xrxo iodopee iesas sDtaxr ;u4aexnmociatfaDeanmo t4trermr3iy1lmtrlivi;t  rumxopoo1al  lnvt t  ruaxmoou1tlto f3ilsfa umnvont)trtrmr3tytfmt  n o s  exo(r io4op emfvils sDtr(  ;t0tetnii3tyd m2ulumon(4 exnmf todfmteau o s  rxoio iy1ll emfctat)a2uaxrooo4texnmietltfa ulnmont0tltrxrcoatlm eauvilt  euoxm nu4oltemncsa( srrrxm ;t4aetn ietat sDeluvon(0trxnxr ta1fmDrli il(0teuo(r3iodale livtas a2rau pou1opxnmocilsfm ra(mp;t4trxrmfctodlmD  nvo s)s2urim3iu4ape mivsa(  2ra(r ;u0alenmoctaslmDelumo;u4 rtnmoctadfatelu i () 2xrxr3oo1ale  nes ( aruaumo;t4olenii3ild m2eau s t4tltrxfctytomt  uvo t0srtmxo ou1om elfet ()a2rmxrp;t1olx moetydfa rauvs;(0alenxocoytlpDeaivi;s setrir3no4lpteliciasfsDrrx pou0oltnifctltfa2el(mp;t) exnif oatlm e nvo;t0 rtrxr3iydaleemnvt t  Dtrxr ou4tle  ictls mDem(mo;u)alxnif ia1fpt  ueslt)t2to(opou4om e fviat aDraur nu1ape  f3ilsla rauvs;u4trxnxociadla rli i t t2xrimpiy1op  mnctlsfa2tm(mpno1aee ifeiytlm elu on(0arxnmfcoodlateaivi;t0trtrxopiydoltn nviltf 2umum nt0alxomf3iys sDelnvpn(0trxoxf iotlm  aues (  2ur(opiodolt liesl(fsDua(r ou4texo ieiytlm uauvo;t)tltnmr3oydfa ean il()sexo(opiy1lme  net tf rur(m nt4tpeo f3iyslmDua( o;(0texoioctatoaDeaneo;t s2trxo oy4alt mnvs ( a2rru pnu0aptniociyt a em( snt)artoir tadlp r i o (0setm(r ou4oltnmnvia()a2uau oot1optn ieiyd aDul( sn(0aetnif oytlatelivil(0 2urxm nu1ol elnvtlt a2urxrooo0oeeomoctltfa2el( s;u)trenmo oodfpDe neolt  rurxrpio1ol  licia() 2trumpnt0apx ifeiys mDum( o;(4 eeoif iadlptrliei t t2xm(mpou1op nmnvia(  2rm(roou1aet  fctlt s2rmnmp;u)trenxo iy1optr i i t  etrxr nu4apt lnctas artmu pno1tet mf3iadfs2ra( o;t)artrir3iy1oaDrln olt)setoio3ou4omtemivias)sDrrum ;u4aetomieilslsDemumon(0artoxfciatoaD ai s;( seurxopoy1amenlfes tfsDtm( onu0apeo f3tyt s em(vp;u) exrxr3tadlmte u s (0trtoim io1om   nct ( aDra(r ot0apenioetys m raumonu0tleomociotop  aiei t)trum(o3iodame mfctatfarua(r ;o0tptnif3ils s uanms (0 lxnmoctodfmDr uvs;t s2uo(mpiudalt mfctl( srtaum ou4apx  f3ils a2ea( o t4trxnxf totla rliei;t srtm(o3iy1ol  mfvt ()aDra(m ou4tpxnmf3tytfs eanms;t0arxrir iadoa rlnvol(0s2trxrpno4lm n nei tf Dua(mpnu0tex mi3iys a2emuvs t4arxrxo3oo1lp r n i t)tetoxmpiydol emfes sfa2taur nu0opxo ieiatfmDrmuvon(4aeenmf3iadfp e uvi ( sexrxr3iu4altnlieils srua(r nt4olxomi3tltfmDrl( o;t)arxnmrciydlaD aieo s t2ur(m3nodolte ivs ( srua( oot4optnifeilsfa eanvp;(0trtrmocoatomtr uvs;t setr(m3iudlmtnmicil(fs2rmurono1olxomfcild aDemn s u) eenifctatfmD  n s s)texr(opno4om e ivil(  2tmx ooo1olxo ieiys mDelums () etoifciatlmte i i;(  2xmxm oo4ol nmfeia()aDtru ont1tltnifeilsfsDrmu pn(0arxrmf3oodfmtrlu i;s)t2toimpiu4altnmivias  2uaxmoot0oltnifciyslmDul(vo u0trtnxfcoo1faD anvslt  ruoxopiy4ol  lfeslsfarrmxrpot4tpx mociat m emu snu0artnif3ty1lpDeli i (  rxr(m3ny1ap elncil( a2trurpnu0aexoiicild sDrm(vs u)altoir3oo1oaDr nvilt0 rtmimpio1lpenlnctlsfaDumumpnt1olen oeias mDrlu p;(0aetnmocoo1lpD lu s s0s2tm(r3oy1al elfcslsfarraumpnu1oee iociyt a2elumsnu0 lermf3iadoateli s;()t2xriopno1lmee ncs s) 2ur( pot1tetniociadfm2umn pn(4arenmf3ootlmDe i i t t2toxo3oy1ll elfet tfs2rm(ronu1apen oetydla rl(vo;t4texniocoadlmt  neolt)trxm(m3oo4ape lfeia() rtr( p;u4tltnifeiat s rl( p t) ltnmr iadoptr uvols)srurxmpno4lpt  fvs sf 2rm(rpno0apeoiociatfsDel( on(4arenmo oy1omt  u slt  2to(mpnu4olte fcias)arumxroot4opxniieiysla2elnmp;(0 eeoxr tatom   u s;t) 2xoxmpiu1aptnmnet s a2tmu pnu4tltnifciatfa2rlnvo;t)altnif tydla   ieo;t0 2xrxm3no4ap  mnesat s2rax pno0apxomieiatla2uanms u4tltnxfcootlmt au ol()t2uo(o3nodaleemncs tf 2tm( o;o4olto f3ilslmDuluvon()arxoxf3iotfatean ols0srxr(r3ny4lp emieias)sDumu o;t1ape io3iasls rauvs (4alxnmocta1omDrln ils sruoim3oo1om emfvi t  Drr(mp;u1tee  fetatlm rmnvp t0aexomfctodlmDrlnvs (  exoiopiydap emivia()sDrr(mp;t0oee if3ilsla2uau s t)treomf iadla eanvi;( sexrxr iu1lleemnet t)a2umxm ;t1texoif3tydfa elnms;(0areoxfciotlpDr n ils0trtmio3no4lltnlnvs s)sDrrxrpou1tltoiociyslm rmuvo (4arenmfciotop ean s;t0 etrirpnu4ope  fciltf Drru ont4apt  ocildfmDeau s (4tetnxr oatfp  li i;t)t2tmxr3io4lpt mivi t) rurxrp;t1alx  iciyslsDemn o u0tltnif ia1fmDr u ilt0texr(m3nudll nmict s artaum ou1tlxo feils m ul(vo;(0 rtrifcto1oaDe u i s)seum(r3ou4lmtnlfvsa(fsrtr(r no1tex mietld mDrlnmp (4 exnxfctatoateanes t  rtrirpiu1ole livilt)arrrurp;o4tltn fctld s ulu p;t0trtoif3oy1lmD anvol(  2uo(rpiy4ol n iesas  rra(  nt0oeenmf3iatfm2eau o ()arxomo3oadfaDelnvslt  rxr(mpoo1lme mnvs sfa2tmxro;u0tet  f3ias m2rmn snt)arerxfciy1lp eaivsls0s2trimpoo1openlivi ( arum(r nt0tee  i3tys mDuan pn(4aetrmr3iy1fm rliesls s2umxr oudope mnvs (fs2umu  nu4alt mictasla rlu onu4trxnxrcoo1fa rauvs;()t2urxr3nu1ol e fetltfaDtmurooo4oeeo ictltlm eauvs () exomf3iytla   n ilt) 2uo(r oudol nmfvt s aDumurp;o4texnifetyd m2umnvs;()trxomr iadlpDrlnvilt teumio iy1lp  lfci ( artm(rpoo0texnifcilsfa ea(mo;u)altrifcta1fm  luvslt t2urio oudame miet tfsrurxmpoo0tetoiociadfmDemu s;t)tltoio iy1faDranvi (0sruo(mpiodlme lfcsa()srraum nt1oeto o3iyt s rlums t4 rtnmfcootlm elnvs ()t2umim3oo1optnlieilt sDum(monu1apeomo3ias a2ra( s ()aetnxrctydomt luesls)trxrxm3io1open netat s2uau o;o4teeniieiytfa rmnvsnu4 renxr oy1fmD ln s;() eurxr3oo4op nlictls) Drrxr oo0tlx ii3iat mDemu p;(0trtoiociytfp e i s s0 etm(r3nydame mnctl( a2tmxrpnt0alenioetatfsDelnmsnt)aeeomf3todom  auvs;t) euoxo3io4am nlfeiatfsDururpnu1alto feiysfsDrlnvo u4arxomfctotfatr neo t)srtr(o oydopte ict t) Drax o;u4teen oeilsfmDrluvp u0 rtnif ty1fpDelueols0trxr(o oo4lmt  nct () ruaxmpou1ope  oeiaslaDran pn(4altnmr to1omD li s;t0 2xr(r3oo1ope  icta( s2urx o;t4tltn ieiytfaDranvs;u0trxnxr oydop raneo t)trtmimpiu1am nmfcta(f rum( ono1optomfeils mDul(ms t0trtnifcia1lpte ivo;s  rtr(m no1ll  liesas s2tau  nu0altnmo3iysfa el(mp u0 rxomr3oodlpte uvi;s  2ur(r ou4am nlfcsl(fa2trumo;u0opx moeiydfa ea(ms;u0artomfcta1op eluvsls  2umxr3oydapt mfet sf Dur(r ot4oetomfeiadfa ul(vo;u0trxoio tatfa  auei;()trurim oy4lp nmietatf 2ta(moot4opxnioctltla2emnvp;u0 ltomr3iatomtrln i;s0 exrxm iydlmt mivias aDuaxr nu4optnio3ilt sDuanvs;u) leoxr3iodfaDraiei ( srurxm ou4lm elfvsat  rraxrono1oex miciat s2rln snt0trxrmf iydomt  uvs () 2tmxmpou4ope lfci (farrmxr ;t1opeomiciad mDrm( pn()teenif to1latrli s;s  2xmir iodomtn fetlt)srta(  ot0olx ifciasla emuvo t)teenmr ty1fat  uei;t)teuoxo3nodlmtnlivi s) Dururp;u1open f3ilsfaDemuvsn(4tlerir oadfat  ivsl( t2tm(o nodame  nei () Drrurp;u4tlxoifetadfa eauvpnu4 ltriocto1omD luvo (0sruoir3oy1omeelivils s2ur(moou4open feildla2rmuvsnt0alxnmr oy1omDeaueils)teum(rpnodomt  nvi (farrm( pno1aeto f3iatfsDua(monu0 ltrio3oa1omDr u sls0tetmir iu4alenmncslt aDua(r nt4tpenmfciys aDemnvsnu0tlxnmrctytfatrlueo;t t2umxm3oodop n ncs t  Dtrxm ;t0apenmi3iadfs rm(vs t4 lxnxr3ia1laD auvs;s0seuo(o3oodoptelietlt)sDta( oot1tlxnioeiytlm eanvo;(4treomf oytfm eluvslt t2trio io4ape lnvs sf Dumxmonu4oexn oeiltfa2uln on(0tltoxr3oydlmtelnvs t)trxoio io1lptnmfcs (faDta( p;t0oexo f3ilt aDel( o (4tlxrxr io1late n s;( trxoir iu1altnlfctl(fa2rmurpnt1apeniietld a rauvsnt)aetrircta1oate neols)texoxrpoydaptemivsls)s2rrumono0oexo f3ilsfsDea(mo;u4 lxrmo oa1laDeau sls0s2uo(o3oo1ame lnei s  2umx  ot0texomi3tlt s um(mo u0trtnxr ty1oa r nvi t)t2urxr ou1lm  mieias  rrmx ooo0aetn ieiatla eanvsnu) exnxr3todopt lu ols)setoimpny4amt  netasfsrumum ;t4tpx iiciltfs em(vo (4tleomfctotomD lieo s  exoio nu1ol nlieslt)s2uau o;t1aexo oeilt aDrmuvp (0texrxrctydlpt livo;t  2umim3oo4am  mictls srumum ou4oeenifetytfa eauvsn(4arerio oytoaDrauvs s sexr(o ny1apeemfcsasfarrr(  nt1alenmfctat aDranvp (4 eeomr3iotlpD aivo (0 rxrir3nydole  ivslt)artrx pnu4texomfeiltfs um( p;(0texrifctatoa e neil()t2trir3nodap nlnvs sfaDtm(mont0olx  ieild mDel(mpnu0 renxfcia1oaDe n i;s  2um(rpno1ope  fvtlsf 2uaur ;o0olt  oeiyslmDelnvp;(4 rtoif3tydlmD ai o t  2xrxr iudaltemfetls)sDrmx  ou1oeen o3iadlm ua( o u4arxrmo3tatfmtr nvi s0texoiopno1lmeemnvs s s2urxrono0tptn o3ildfa2eauvp;u0alenxocty1lateli s () rto(r oudlm e fetlt) 2rrx  nu1olt iieiyd sDranmo (0aetoxociydlmDrai i;s teurio3iy1openmnctat)aDtmu o;o4altnmi3ilt s rlnmo u4tlxnmocto1lp  aivs s) eurxopno1ale lfesls) 2ua(mpot4oet iictas a rmums;t)arermo3tadop  aieo;( srurimpny4open fcsls sDurxmpou0tlxo oetlt s rm(mont) exrmfcoy1lm elivs;s0teumxo ny1alte neilsfarurx o;t4olt ifeiadfmDulu o;() etoirciy1opD luei s0s2tmir ou1om nmictasfa2rau o;t4aexomoctyt m rmnmp;u4alxoio ta1lmte nei;s trxmxrpou1lpeemict sfs2umu poo4aptomfetas s ulnvo u0texnmf3ta1omtrlues s  etrim3io1omenlfvsat)srtmxm ou0tle ii3tasfaDeauvpn()alxrir oodfp e neslt)t2trxr3iy4ll nmict ( srtmxm ;o1aex iietls m2emnvpnu4 rxrircoadlmDe nvslt teuoimpio4lpenlfcsat)a2urxront1olxniietltfs umn on() reomo to1lpD liesls)srxrio nu4ap emfcs sf Duax pnu1aetoiieilt a2elnmp t)tetoio3to1faDeanei s) euoirpnodoltemict t a2rru ooo0oee  i3tatfaDeauvsn(0trtrxo3iotfpteauvils trurio oy4op nlicsl(farum( pnt1tet  f3iltfsDulnms;t0texomrctatlptr neil()srtrio oydoltn icslt) 2ururpou0tlxo ieiyslm elnvs;u) lxoxf3oydoa eluvi t)trtm(r oudameelnvt s aDurxmp;t0texn oetlsla2rmuvs u4aetomf3tytlptraivi;s trxmxmpny1opee iviltfartr(moou1aeeniiciad m eanvs;u)tlenxo3tadom  au o;s0 exoim no1lptn nesls aDuaumpot0aet  ieiyt m rlu pn(0tltrmf3oytopteai sl(  exoxr3iy4lpt micilt) Duaur no4opx mfctys m raump;(0tlxoir tadomtr ivi ( teto(r ny1alen ivi () rtaur nt1tet mf3ildls2ra(msn(4 rxoir3oodlpDelieilt)sexm(o3iodoptn ictls s2umu p;t0teenmfcilslm2rau snu0tetrmr tydoa eln s s0t2xrxr iodapt mieilt)aDtmu pno1olxoioctadlsDelu s t0texoircty1fpDe u slt0srtm(r3nydlp nmivtl()s2rr(r ot1aptomoctytla rm(vo;(0 renmf3ia1fa eaiesls)s2um(rpnu4aleemicils) 2rm(r nu1tex moeiat aDeaums (4 exnmfcio1fp  aieo t) eurio3nu4apeelfesat srtrx o;t4oeeomi3ilsls2ea(vs;t) lenir to1laDrauvolt  rtoxr3ou4omen fcs ()srtru  ou0olt  ieiyslsDuaums t)arxomr3ia1lpt lu i s  rxr(o3ou4ome lnvs s sDtrxrooo4alxo ociad aDrl(mo t0 lenxoctytlpteai i t0 exoiopoudlm n ivi sfarum(moou4texnmoctlslsDranvp u0alxnmf3iy1om r i s;t sexrimpnydopeemietltf rrm(r oo4tptn icilslsDum(msn() ltrxo iatop r uvo;s0trxoirpiy1lltnlnetl( artau p;u0ale mociatla rmu s () exoxr iytoaD  ues s) 2tmio3oo1optn ieslt aDrr( ont0tle if3tytfs ra(vsnu4 lxnxrcty1fmt lu ilt seumxmpiydaleeliet s s2rau poo4tpenmo3ilt m2rmu p t)aexomf3oy1fmDranvi s  2xo(rpoydalen ieil(farurx onu1olto fctytls eln s u) rtnmrciytfpDr i o;()t2urirpno4ll eliesa( sDtrurono1oeeo o3iadlsDrm( snu4teeoxr tydoa r ivs s trxoxo nodalt lnesa(  2rru  nt4oet ii3tltlm2rl(vp u0aexnioctydopt au sl( trxmio nodomtn ivias aDtmxm ;o1tleomi3tldla um(mp;u0trtnif iodlaDeluvo;t0 rxo(opiudllenmnesa() rrmu  nt1tleomietad m elump;u)altnircoadlate uvs s  etrio3io1olt  nvtl(  rrr(r ou0alxniocilsfa umuvo () rtoio iytoateaues;s t2uoxopny4lp   nesas s2rmuront0aexo feiytlm um( p t0alerxo ty1lmDrlnes (0teto(r3iu4alenmfetltfsrtrumpnt4olxn f3ild a2ea(mont4 renxr3oadfm r i i ()texoim3ou4lmen ics t  rraur ;t1teen o3ildls2eau snu0trxnmrcoa1faDe nvs t sexmirpiu1amtelnes s srrax oot1olxo f3ias m2rl( p;t0aetnxf3ta1omtrlnesl( texriopnodam nmnvs () rurxro;o0tpenmfciadlaDua(vpnu0trtrir3oydlaD lu s;s0trtr(mpno1llt mfeilt)s2trx  ;u1tpenmoeiydlmDeaump;t)trxnmo3oodop  lu i;()texoxo iydlpeeliet t) rrm(mooo0oexoiocild aDem(mo u) rxoircty1lp   ueo ( s2tm(mpnu4lmtemnvtat  rtaumo;u0tpeo feilt m uaumpnu)trtoio3iotom rluvolt)t2xm(r oo1lp elnviasf rur( o;o0altoifeiyt s2rl(ms;u0tltrmr iotoa eai i;(0 rumxo nudll n ivta() rrrumpou4alxo i3tatlm2eluvpnu)alxnxo3todlaDeaieils)trxoim oy1ap nlfvtas) 2ra(  no1oet  iciys m2um( s;u0trxnxr3todlm e u olt0t2xo(r3ny4lpt lnviat a2rr(rono1tlx  fetydfs rl( snt0 exoxoctytlm  li i;t)s2xrxopiu1lm e fvs (fs2truro;u1olx iiciyt m2ea( o u4 exomfcoodlm eln slt  rurxo nudaltemicslsfarururpot4tle mfetydfa raump t)texomo iatom eaivo;()trtmxm iudamtnlivilt)arumumpou1tpx ii3iyd sDelnmon(0 eenmo3iytlpD  uei s  exr(o3iodaleemfvs tfaDtaum nt4opx  o3tlt a elnvp t0altoxr3oytlmtrluesls0teumxm3iudalt mictas  2tmumpno1oltn i3iadfaDrm( p t)alxnxo3oydfat  uei;( setrxo3nodomeemictas artr(mpou1tex  ieils a rlu p ()artnif3iotlp rlieo s) exm(m ny1ape  fviat) Dtmum ou1aptnifctls s2emnvon(0tlxrxr3ty1om  li o;(0 rto(o3iy1alenmivia()aDururonu4alxniiciltfm el(mo (4tlxrir iy1opte n s s)srxr(r ny1open ieilt aDtmu  ot0tlxo feiydfmDem(vpnu4artnir iydop rlu slt trxmxr ny4al nmnes ()aruax onu0aeenif3iytfmDuaumpnu4artoifctydlmt lu i t  eto(m3io1opeelnet ()artmuro;u1opt mo3ias sDrmu s (4 reoio3oo1fp elu ols0srxmxmpnudoptnmnvtas)srrmx pot4ope iietyd mDeluvpnt4texoircoadomD auvi;t0 2toxmpiodape  nviatfsDtau pot4tptomf3ildla ea(vsnt)aeeomo iatlptrlnvi t srxo(rpoodame miciatfartmu onu4aex  ictldfaDrlnvo;() eeomo3ta1lat  i o (0trtoir nodalt  nctat) 2taxr nt0apen fciytfa el( p;u)aexrir tydfaDranei t  rxrxm3oy4alt  fciatf 2umu  nt4apto octyslaDrln s u0areomrctadlpDr uvslt srtrxrpno1ol  mfvilt  Drrx ono0tleoio3tytfsDuan s;(4teeniociadoa  lueolt s2xo(o3nydlp e ivil(f rua(m no4tlt  ociat sDel(vo;t4arxomf3tadoaD luvs;t s2xr(opiu1lpte net ()a2rru pou1aexn feilt s elumsnu) ltrmf3oytlpDeaueils0srxm(m iu1lmeelici sfs2taurp;u1aex  o3tlslm2eluvo t0aexnmr iadopD lu o s0tetm(m3io4om emicsatf Dtmx  ;o1tptnmoeiaslmDumuvs t4arxnirciotlpte ivo t texoxopiu1omtnlncsl(f Dtm( poo4apt ifeias m em(vs t4 ltoxf3ootoaD  u s s0teumxo3ny1ol  mivtls)sDrax o;u0tltomfetat mDrlnms () rxomfcty1fp  lnvs;s s2xo(opnydoltelfvsl(f 2rrx pno0teeo icilt aDelumsnt4alxomr3ootfmDeluvs ( srtmxm3iu1lme  ivtasfsDua( p;t0aet mfeiyslm2um(vs u0trxnmocoatlp elivils)t2uo(rpio4ope  ivtltf Dtrx o;t4openiieils aDuln pnt4alxnxfcoo1fmD  neol(  2uo(mpoo1ll nlfet t arrmxmoot0tpe mfetadla2rmnvs u)aeeoio tatomtelivol(0s2xoio oo4op  mfvi s)aDtm(r ;u4tlx  feiysfa rmnvsnt4trxoif io1lptrlnvsl(0texoim3oodolt lnvs (fa2uax oou1ape  o3tatls2rlu onu)texoircoytlaD liesls srum(mpiy4altemietls) rururpnu1aexniiciysfaDemnmpn(0alenmfcoy1fmtrai ol(0trto(rpoy4lpeemnesls a2ur(mont0tpxn i3tldlm2rlumpnt0alxoio iadopDe uvol(0seuo(mpou1apeemncia()srtm(mpot1tptn fctytla2rln p t4arxomr3iy1optr ies t) rxrio no4olt lietas)aDraxr nu4tpeomietldls2el(vs ()artrmf ty1opt lnei;t)s2tr(o3iudlp elietlsfarrrxmpou1oet  iciasfsDranmo;u4 reomo tydlatr u o (0 exr(m io1oleemnvi ( s2tauroot0optn fciydfm2rl( o;(4arxoxfcoydlaDrln i;s srurir nodom e netatfs2rrx p;o1aet ii3tydlmDea(vo u0aetomfciotla   i i t0s2xo(opiu4omenlics s  rrauroot1olx  ictytls2rln s;t0 renmr3iatoat  n sls) exmxr iodlmtn neslt)srrrx pnu1oleo fctldls uau snt4trxrmfctotfp elnvilt0trtrxrpou4aptnlnet s  rum(mpnu4tpen fetyd m2eluvs ()trtrif iytlm elies (0srtrxrpny4op elfeta(fs2taxro;t0apen iciad s2uanvo;t4treoxo3iodlm rluvslt0trtmxr oodlptn nct (fs2uax  ou0openmfetytlm ra(vpn()alenmrcoo1la e ivols0trtm(m oudape mneils sDtmurpou4altoiociysfm ran p;(0tlxrio3oadfp   nesl(0 etrxopno4al emnvslt) Dumu ono0aexoiieiadla el(ms t0 lenxocio1faDeauesl(0s2xrxrpiydlp elici ()s2tr(moot4oleoiieildfa2rauvon()treomf tatlmDrluei (0 exo(o oy1om e fesa(f 2tr( poo4tetnmfeiatfm rl(mp;(4aeenxr3oa1fm   nes s s2xrim3oo1lm n ivias)sDrrurono4teto fctadfsDem( s;u)aexrirciatfp   u s;t0s2umxrpnudlmtelfeta(faDra(m ;o1opxn fcias s um(mp u4arxnxo3to1lmte i s;s  2xoim3iy1op elnesl( srrru oot1tlto ociysls um(mpnt) lxoiocty1la elnvo;s)trxmxmpoo1omt  nesas)sDtaxrpnu0tpxnmietadla rmums t)tlermf todoatrln ol( sexrxm3iy4lm  mfvs t) 2tr( ont4teto oeiydls2umumo (4 rtoxo iydomt aies;()seuoxo3no4ap elfvi t arum(ronu1aee  iciadla2emn p;u0arxoxr oatlmDrauvi s)srxmxr3nudalt livt t)arua( pno1oee mf3iad a umuvp;u0 etomfcto1oaD lieol(0sexrxo nodopt lnvias  2tr(m ;t0tlx iociytfsDrmumpnu4arenxfcto1omtrli s;t)setm(o iu4apt mnei () rraurpou0tpeoioetydfa2emnvp;u0 etomr3ootfaDrlnvi t) 2trxo nydlpen ivt tfsDraxm ;o4tet  o3tysfa2ranvp;t4 lerxociotlat aivi;(0s2toir ou4lp  lfctl(  ruax pot0tpxoio3iytls uan o;u0tleoir oodfaDrluvi;() etoio io4ap emieslt  rua(roou4tltnmf3iltfaDul( onu)arxnio totfmtrai o (0trxmxm3oudlmeemfcta()s2ur(ronu4apx mo3tldlm2ulums t)arermfcto1omtraueo;t)trurxr3nudom emfes s)srrmx  oo4tetnmo3iat mDea(vp ()arxnxrcto1oaDe n s t s2to(o3iy4optemnci s)aDtr(mpnu1tex if3iatfa2uanvs t0 rtnmfcia1omDeln o () rumirpio1lltn fvta(f 2rmumooo4tptn fctydls2emumpnt0treoirciadomDeaieolt0t2xm(m oodamtn nvsls)a2uaumo;t0tlenmieiysfm2rau s;t0aetomf3oodlmt  nes s)teumim nodlptn neiatfaruaumo;o0open f3iys s2elnmpn()tltrio io1opDr i i s texr(opoodapeemfctls s2um(  ot1texomoeiasfaDra(vsnu4trxnmf totfm rli slt s2xrir oydomenmicsatfsrum(rpno0alxn ictls m2um( s u)tltnmr oydopD aivsls0 rxrir3iodoleemnesa( s2trurp;o0openmi3ilsfsDua(mo (4trtnxo oo1fm r neo t0t2xm(m iy4lp  mncsl(  rra(r ;u1aleniocildfsDuanvp u4 ltoxf iydfa  anvo (0s2xo(r3io4ale mfvsa(f rtaurpnu4teeo o3ildfs ra(mp ()trxrmr iadfpDraivo s seurimpno1om   nvi () rtaxmpoo0aptn ietytfaDrlu s t4aeermrcootlp rluei;s  2trxm oudam  lnciat)a2urxroou4apx moetasls2emu s;()areoir3iatlpDelieo s t2tmir3oydap e fcia()s2ur( pnt1oeeomo3tydfm2uluvp u)aexnxo iodfmt  nvs;(0srxrio3oy1om e nci sf rum(mooo4oeto o3tys mDumumpnu)arenxocoytoateaneils)trxo(r3no1lleemiei tfs2rauronu4alt  f3iydfmDrau o ()aexoxo3iytfat au i;(0s2toio iu4om nmivils)s2rmu pot0ole if3tlsla eauvp;u4tltnmf oo1lmD  n il()tetr(rpny4lpe  nvslsfarumum ;t0alx moeiltls elnms (0 exnmfcto1lp e iei;s s2xo(rpio4am   ivsasfsDuaump;t4tpxn oeild a2el(mp;t0tltnmociodfa  ln o t s2uoio3oodlleemfvta(fsDtaumoou4tle mi3ilsfa ul(vpnt4arerio oy1omDrau s (  2tr(o no4amtnlivsls  2rr(m nu1tetomociadlm rm( s (0 rtomf iydfaDraneol( tetrxo nu4ap  lnetat)srrauro;u1teeoifctydlmDrmnmpnt4aetnioctytfatr ieo;(  2trxopoo1al elivs sfartm(rpno0olxo o3tysfa2uanvsnu) lenirctytoatraneil(0 2uoir3nu4apte ncsa( s2uaxm ou0tltoii3tldlm umn pnt0tlerir ia1fmte i sl(  2xoimpiydapt mnes t)sDur(  ;u4tex iieiytlmDemnms (0 eenxfctadfp rlnvo;s0seumio iu4altnliet s srtmumpou0tpenii3tyt s2eanmo;t)trxomr3oytlm   uesls)tetrxo3iydoltnlncil()s2uaurooo1aet ii3iysfmDua(vp u0 lenmf iadoa rlues t srur(r3ny1lmtnlncs t  Drr(ronu4tltnii3iad m2uln s t)trermo oodfptelueo;t0 2tm(o3oudam nliet (f 2ur( pou0oet ii3iydla umnmsnt0tlenmrcoa1fpDran o s0 2xmir oo4al  mieilsfa2tax  ;t0aexn octlt a2rm(von(4tltomo3tadoaDeaivs;t)t2xoxr3iy1apte ivtlt srtrxr no4apto ieiltlm2elnmp;(4 leoir iydfmtean il(0 rxoim iu4ll emfeil()arumuro;u4tpen i3tlsla umnvs;()arxrxr iadomte ivils setm(m nu1lm  lfci tfa2rax  nu1tlt mieiltfm2el( s u) eeoiociydfatr n i;t0setrimpoo4al n nvtl(fa2uaurpou0alenmociltfm2uauvonu4tetrxr3ia1opDeaiesl()srxoim3oo4ol   ivtl(fsDtauro;t1apxomi3iadfs el(vonu) ltnif tydoaDrlueols)truoxm3ou1altn neilsf Drrxm nu4tee mieiadlaDrauvp (0trenxfctadomte i ils)srxrxopoo1amtnliet sfarua( oou4alxo f3iydls eln snu)trxrmrctotlm  aues;s0 2ur(o nydope  ivilsfs2raumo;o1tleoio3iltfm ua(vs;u0artnmf3ootoaDr nvo (0sruoxo3iy1omt livtls) 2urxro;t1tet  octydla ra(mo;t4aleoif iotlpDr n o s0 rxmxo3nudlltelfvt s) 2ta(  no0apxoioeiad s2elnmp ()texrio ta1fatrlu i ( srto(r3no1ap n fctlsfaDraurpot1tet mi3iyd mDra(vp t4teerifctodfa eai i;s)truoir oo4omtemfvi sfartrxmpnu0texnmi3iydlaDrm(mo u0 eeoio3iatlp e nvo;t0srxo(m3iydlm  mivs (fa2urxr nt0tlt mfciyt m em( o ()aetoir tatfm  aueo;( texm(rpny1amtnlivi t) 2tax ooo1tpxnifetasfaDemnvs;()alxrmrctytop  lnes;s sruoir oudap emicsas aDumxmo;t4tpe mfeiatfs2uaumon()tlxrxoctodfat lnvils)trxrir3iy4lp emnes sf 2trurpot0opeoio3ilsla2elump;u) etrmf3oatlatr ueils0t2toirpny4oltnmics s  rumx pno4texnmfeiat aDean o u0tlxrmo3ootfatrliei ( truoim nodaleelietat aDumx o;o4altnmf3tyd mDeluvsn()altoif iotfpt lueil() rxrim3oydame  nvt ( aDurumono1aeeoioeiysfa2rlu o;(4 lxomfcty1omDrauei (  rtmxrpou4ol eliciat) 2uaumpou0teeomieildlsDrl(mpnu4tetrir3iatoate nvil(0tetr(m no4lp n nvs (fs2urxm ;o4teeoiociyslsDrmuvsnt0 lerir ootlm   ueslt)tetoim3io4lp elici (  rrm(m ;t4alx  fciltfm el( o;u4 ltrxr oy1omD  u o (0srtr(m nu1lp  mncia()s2tmx pnu0texomi3tysfs2uanmon(0altoxrciy1omtr uvsls) exr(o iodomtn ivias  Duaum ;o1aleomietltlmDum( s;()artnmo ia1opt an olt sexrir ny4oltelfei sf rtax  no0optn i3ilsfs rauvp;() reriociydlpDeluvi t)srumir3nu4alt  nct t)arraur nu4oeenmi3tydlsDuaump;u4aeeoxr oo1fpDr nes s0 2xm(m3iu1amenmivsltfs2trxmo;o1aexnifetysls2ea(mont4trtoxocoy1fm elivi;( s2tmimpiodlmtnmies (fs2trum ;u0optnmi3tlslsDranvpnt) lenmf oodfm eaies;( srtm(o no4om   feiat) rraum ;t0tlt  feiyd a rm(msn(4 exrio3iy1fpDe i slt)srumirpno1am emieilsfaDrru pou4tltnmf3ildlm2el(ms u)trtnmr oa1fat au sls)trtr(m3nydoltnmncsa(fa2rm( o;u4oet  o3tldlsDuluvo;u4tlxnxf3tydfa elu o s0t2xo(opnu4lp elivtlt) rum(mpot1opxnmfeiadla2umumonu0aleoir3to1fa  an olt)s2ur(mpiydlmtnlncsatf 2umx  nt4optoifetltls2ranmonu4artnmf oo1faD lueo ( s2xr(m3oy4om   nesl()aDrmuront0olxnmi3tasfs2elumsnu)aleomf3tytlptrlieo;s0seurim3iy4olenlivsatf 2raxrp;u4alxoii3ilt a2emuvp t)tleoircoa1oa eli o;()s2uo(opnydap n ies (fs2ta(mpoo0aeeomf3tld mDemumonu0altrmo iydopDeaieslt  etrim3oy1lmen ncs tfsrtr(r nu4oleniocilt m em(vs u)treoxr ta1omte ieo;t  rxmio ou1alen icsat  rtr(rpno1ope  o3iydfs2elnmpnu4 exnxo tydlm rluvolt s2ur(r nydameemncil(fs2trx  ;t4olx ii3ild m uauvs;(0 exnir tydom eauvsls) 2xrxo oo1ol emfcsl()aruau  ;u1aeenii3tadlmDul( o;t0 rxrif iodoat livo s0 etrxr io1lmt  ivtas)a2tr( pot1aptnmf3ias s el(vs u0teenmo oydopt  nvi;() etm(m ou1ope mfeil(fsrrmxro;t0oltn f3iatla el(vonu0altrxr3iodfm   ueolt t2tmxo3iodllenlictls  rtmurp;o4tpenifeiatlmDum(vp (0trerxocoodop eau i;s)s2xmxr nudllee fet ( s2tmurp;o4olt  i3tydlmDumnmpnt4altrxr3iotlateaivols s2um(o io4omen fei sfartm(  no0tee ioeiat m eanmo;u0aeermfcoatomDe nvo;()t2xrirpoudamtnlfct s) Draum ;u1openmo3iysfs eau pnu0 rxoxr iytfa elueol( s2urimpiydopeemnetat)sDtrxrooo0ope mi3ild aDrlu s (4aeerxf oytfat  ivi t0teur(m3oo1omee ict (fartax pno4apeniiciasfm2ea(mo;(4aleoxocia1fp eau s s t2xrxm nu1ll   nvil() rtru ooo4tptoifeiadlsDulums (0areomf tydfmtelnvols)texmim io1olt mfvs t  rrr(mont4alt  ietyd sDrl(vo t4 lenir3oatfpDrlnes;s tetrir nydlmen ivsatf Dumurono0altn ieiaslmDrlnvo;t0 rtrxfctydlp rlies s) rxmio3oy1altn ivtlt artr(rpot1tetniieiatfa2rluvp;t) renxo3to1lpD anvols trxrim ny4ol nmicta(fsrraxm nu4tpeomictldls2elnms;() lxnio oadfmDrauvolt0srurim3iy1om elicta()sDtmxm nt4tet  fciytlmDra( o u0texnifctadlmD  iesl()setrxr nodom nlnet s  Drau p;o4aeto ocilslm uan pnt4 rtoiocootlmtraueilt0sexoirpou4am  lfesls srtm(rooo0oee  fetat a uln o () etomocootfaDrauvi;(0 2ur(mpnydal nlfeils s2umx pou0aexoioetldlm2rauvp t4arxoifcoatfmD aieolt)srxm(o oy4oleeliet sfaDumu p;o1tltniicild s emn p (0 rtoxo3oa1fp eaies;(  2um(rpiodom  lncsa(  2urur nu4tpeomfeiydlaDrmnvs ()texrxfcoo1fatran s t srumxrpou4amenlnvt t sruaxm no0texnmfcils mDua(ms t)tetrxr3iotlatrlues;s) rtr(m iu1opt livi t sDtrxro;o4tpeo fciatls ranmo;u4tlxnmr iadoa rluei;t  rtrxm3iy4omtelieia()sDtax  nt0tlxn oeiytlm2uanmsnt4 lxrmr oy1fmt  u olt t2ur(r nu4lpe lncilt) rtmumooo4oetniiciysfs umnvs;u4artoifctodlatr uvils0trur(o oo4ale mietltfsDtaxr oo1teto ociadfa2uauvo (0tlenio3iydlmDelieo;s trtr(rpiudap   ies sf 2um(roou1tpxo i3ilsla2em(mo;u4 lxnmr3oytom eaivi;t) euo(opiudlleelfcsat aDraxmo;u4alenmfetasfm ulnmonu4 etomociadlpD  u ol( t2xrxr oydomtn nvsltf Dtm(mpno1tpt  ociytfs rauvpnt4 eermocoydlmD  uvolt  2uoiopio1op nmnvs tfsrrruro;o1tpt  feiadlm2emuvo;t)trenif3ia1oatran o;( t2xoxo no1omtnlnvi sf rrrurooo4opeomo3iatfsDeluvo;()alxoxfcoodomt an il(0tetoxm oy1ll emivsasfaruaxm ot4tlenmiciasls2eauvp;(0 lxomo3to1oat anvolt  2trxrpnu4al  liesa()aDtrum ;u0altnifcias aDulu p;()aexnxr3ty1fpDe uvo s)t2um(r3nu4lmtelnctatfs2ur(ronu4teeoifciyt sDemumpn(4tleoif iadom raivilt0srtr(o3oy1ll   ncta()sDtauro;u4ope io3ildfm ua(vp;(0 etnxr3ia1fatraiesl( seumxm ou1amen ici ()aDurx  ou1oexo oetatls elumo ()alxrxf ty1lpD  nvils)s2xrxm3ou4olenmnvi s)arurur ou0opx iociat m2emnmp u0tlxnmr3oa1fmt  nvo;( s2tmxo3ou1am  mict sfsDtau  oo0ope iiciltfm rluvs (4 ltnmo oatfate uei () rxr(o3ny1lmeemfetlsf 2rrxronu1tpx  i3iysfa rlu o t0 rtrxf3ootlatr uei s setmxo oo4olee fetas srrrur ;o4aptn o3iat a2el(vo;()trtrmo oatla   nvs;() 2uoxrpny1oleelicsls sruaxrooo0oee mfetadlm2ulnmonu)tlxnircoa1opDr n i;t setoxm3ou1opeemfesa(f 2raxr ;u1opt ifciatlmDumu on(4aexnmf3ty1lmteai ols0 2xmxr iu4al nmivtasfarra(rpnt0tetnmoetat s2ul(ms;u) eeoir tytlm ran i t0 ruo(mpiy4ap n nvil(  rtr(ront4tlx ifctydlsDuaums;u)arermo3iotla r ieol(0 rtoxo iydol   ivsl() Dra(  ;o0tee  f3iasfs rm(ms t0aleomo3iadopt  ieil(0truoxo3iu4op n feia() Drmu  nt0tpxnmf3ild m uaumo;(4alxnif oydfa   n s t t2umir oy1apeelivs t aDtm(mooo0teeo oeiytlmDrmnvo;u0trtomrcio1lm e nvs t sruoxm3oy1al n ivsa( sDtau o;t1oeto ietys sDum(vo;u4altnmr tatlaD  ieo t0 2tmxo iy1al nmfvil() rrrur ot4teenmi3ilslsDuluvo;t4trxnif oy1lp e uvslt t2xmxopiudalt mfcs tfarrmxrpou1oleniietytfsDea( p;(4 exrif ta1fmtranes;(  2urxm nodlptnmies t)sDuaxmoou0altnioeiltfm rmnmp;u)aleoif oadoaDelieo s  2xoim nodlmeemnctatfsDua(monu4aex  ieild a ra( snt)aeeoio3oo1fmtrln o;( trum(r3oo1lleelfet (  2tmx o;u4teen fetad a ranmpnu0teenxo iytlaD  uvo s0teurxm ou1lpe  ncilt sDrm(r ;t0tpen f3tytfm rm( s (4texomr3iytomD auei;s  exr(r3iy1llee neilsf 2taurpou0alx  ociytfm2ea( p;u) reriocoodom rau s;t0s2tmxr oo4aptn nvs () rrr(  ;o1apxomfeiys aDel(mo;t)texnmfctydfp e n s;t0srumim3ou1lm nmfcilt  Dtauroot0opxoii3iat sDua(vs;()trermo3to1opD au o t  2trirpnudlptemfeta(farrrxm ;u4aexoiociaslsDrl(mp (4arerxrctodom r i i t srxrir ou1amtemnes s)a2rrx  ;u1oetnmfetyd sDrmuvs;(0 ltrmfciy1fp   neols)trum(o iu1amt mfei t  rumuro;o1ole iieiltfs ua( p u4 etrxo3iatfm e i i;s0t2toirpou1omen ivt s aDrm( oot1oleoioctldlaDrau s u4texoif oodfa r n s;t  2uoxr3oydalen ict sf rrru p;u0olxo fcilt m2emuvsnt)altomfcoo1oaDr i o;() euo(o oy4ll elnct s) 2rm(ro;o4ope iociyd mDrl(vsnu0trtrxf3todom   i ilt)sexrxm3no1oltnmneta() 2rr( p;u1tpxnmieiyt sDrm(mp;t) lerxfcty1lmtrauesl( setrxm3iudomt mfeil(fsrurxmpot0tlenmoetlt m rl(vsnt0teenif iy1lp eai o;s t2umir io1amtnlnvtlt aDra( p;t4oetnmoctysls umumpnu4tetoxf oodlmteanes;(0trurxo3iy4ll  lncsa()sruaxmpoo1tpeoifciat mDem( ont) rxrxr iydlmDr u i;t)t2xrim oo4amtnlfcilt sDtaxm ou0tet  oetls mDuanvo;u0tleoxo3oytlptrln o;s0 ruoxo iudoltemfesls sDuru  ot1tle ifciysls2emnmp t4artnmoctadlpDrli sls) rtrir3iy1lpte fvtl( aDtmxr ou4tlxnifetld sDeanmp u) lxnxf3tydfpDrli o;( trxrxo3ny4lmenlfei ( srum(mo;u4oltomicild a rauvsn() lerxf todomtr ivilt)seto(m io1amenmfci (fs2tmu  ou0tpxn ocildfs2el(msnt4aetrxfciy1fpDe nvo ()teum(rpnu1lpe livi s)s2uaxm ou4aex  iciyd mDulu o;t4 renmrcoydfmtelu ilt0 etm(m ou4amt  fvsl(f Drrx pnu4apx io3ildlm um(vpnu0 ltrir3iy1fmDraueils0 2xoiopnodom elncsat  2rmurpot0tetoioeils s rln o;u0aleriocoadlaDrau o;s teum(m3nydopeelfvi (fs2uaxrp;t4oeeoifciyd mDean onu4aetrxf tatlptr i i ( teurim3ou1alt livi s aDrax ooo1oetn ieilslm2umuvs (4tltoifcoydfaD an o s)srxrxopiu4alenlnvt (  Drmx onu0apt mf3ilsfm ea(vsnu4tlxniocoy1lp  an i ()s2xm(opny4al e ncilsf Dumu p;u4oee ii3tytfmDrau on(0tltnmo3iydoaDrauvol(0s2uoxm3no4alt micilt  rtaum ou4ope mo3iys a uan o (0aetoif tatfpt li s;t)s2xr(o ny1amtelncs tfsDtru p;u1alxnmi3tldfs2rm( snt)aleoio3ootfpteanei (0trxoiopou1lp  livtltfa2ua(r nt1optnif3iysfs rmuvo t4artoxociadopte u i (0trto(opoo1omte feia(  2raxmo;t4tlxnmo3tad s2ua(mp (4trtoxfcoytla  lu i;t0 eumir oodopt  icil(  2raum nt1tpxnioeild m2rm(vs u) rtrifcoadlmt ln i t)s2trxmpnu4omtnlnct ()aDururont0apeomf3iytlm emnvonu) exnxf iy1lmtrlu sls trxr(m3oo1lmt mieilsf rrmxmono0tlt if3iadfaDel(vs;u4trxoxf iydoa eanvi (0s2umxo3iodamee fesl(fs2taxr ou0oleoiociltlaDul(ms t4texomr3to1om r ivols trurirpnydopenmncsl()srtm(r ;t4tltnmfeias m rlnvsnu4 rtoxociotfa   nvo s0 2xmir3no4oltelicsa(fs2urxrpnt4oltomieiydls rmn ont4 eeoif tydom r iei ( seuoxrpiy4amen iciltfsrtaurp;u1oexo oeiasfa um(mont)arenxf iatfa rauvs s srumir io1ll  mfcsa(fsrtmxro;o4tle moctlt a ua(mpnu4arenmociydoa r n o t)s2xo(r iydlptelnvi tf rtrur nt4aptnmfeildls ulnvs;u)trtrxfcta1fmDeaueils)srtmim iy1lptn ieil(  2tm( p;o4tex iietyt mDulnmo;(4artoxr tatla  lues ( texoir nu1ol e ivtlt)s2tmxmonu0tpe moctytfm2elnmp u0 lxrxo3oatfp e nvi;s0 rtm(rpnu4lp  liet s a2trxm no1alx mfctys a2uauvon()tltrxoctadlp r n i ()srumxopou4aptn nci s aDuaum ot4tee ioetldlm rmnvs t0teermo ty1late uvil(0trxmxopiudale  fvtas srrax o;o4tle mieiys s2eaumpn(0aeenmocta1oatr i i s)tetmxopou4llt liei (f 2rrxmpot1tpe  ociad s2ua( s u4 eenircoa1optrliei;(0s2urxo3oudameemicsat aDrrump;t4aeeoiieiad sDranms;t0 lerirciotfaD aneilt0t2ur(o nudlm nmnvi (  Dur( onu4opt  fciltfsDuanmonu) exomo iydlaDelnes s)trtmxo3ou1am elnci t  2rru  ou1tet  iciydlm2ra( p () rtrir3oydfp   u i;t)texr(o3no1lltemnvs tf rrmurp;o0tlx  ieiatfm rlnvonu0arxrmo3tadomt aueolt0 2xm(mpio4lpte nciat)arrr( o;t0oeen f3iasls2ra(ms;u0aexrmf3todfp rauvo;s) rxm(r iy4omtn fcs ( srrm(  ;t0aleomo3iadfa2elumo (0 lxrxocto1faD  i s;t0texoirpiodopenmfetas  Dra(  ;t0tetniieiltla2rlnvon(4teeoif3tadlp   ieo;( seuoio iu4ol   ncsa(f 2rm(mp;t4aeeoiictysls2rmnmo;u0arxrmfciadomteluvsl(0srur(rpnudolt lfci ()s2truront1olxo fctlslm2rlnms t4tlxoxfctatomt  nesls)t2tm(rpio1opt mfcsa()sDtm( pot0aleoifeiaslsDeluvs;(4artoxociadlmD aivi (0 2tmxm iy4lmte fes s  ruau ont1ole mfetydla rl( p u0 eenio3todomD lueols) 2toxr3iy1lmeelics (  Dtax  ot1tpenmfeiyt a ra( p;u4tlxniociadoa eaues ( srxmim3iu4altelicslt)sDururpnt1teto ictlt a uluvsnt0trtoxr tytlmtelueol( seum(o oo1om emnesltf rur( p;u0alxomf3taslmDran s;t0alerif3oatfm elivo s tetr(r3oo1ale mnesl(  Drrx p;t0oeen o3ilsfm rau onu0 rtnmfcty1fa   ues t0setoim oudaptelivt t  2ua( pno1aptomfciytfsDumump;t0aleoircoydoa  lnesls texr(o ny4lpt lnesl(  Duaxroot4texo oeiad a2ra(vpnu0tlxoxo tytfa  li sl() euoimpoo1lpenmnesa(faDrmxm ot4texnmictatfm2ran ont) eermo iydlatraieo t  ruo(o iudlle  neil(  2urxmp;t4alto i3tys s eluvp u4trtrio iadomt aies;s)sexrir ou1oleelfctls sDuau poo4oexnioeias a2umnvs;t0altomo3ta1op  li o t0srtm(opiu1altelfci t)sDrmxm oo0tptoioctydlaDem( o u0altoircoa1la  livilt s2tmxopio1al n ivtat) Dtmxro;u4opxnmociyd a ul(msn()tetoxrciadlm  lueils0texrim3iy1amtelfcsas sDua( ooo4tlx  ocildfmDuanvo t4artrmf3tatfa  anvsl() 2tmxr oydlle mfetls srurx p;o4oleo f3iatla umnvs u4trerif io1lpt lu s t0s2umxopiudoptn ieta(  2urx pnt4alxoiietldfsDrmumo;()artrmocoodfp  livsl()trur(m3ou1omeemiei s)aDuaxm nu
\ No newline at end of file
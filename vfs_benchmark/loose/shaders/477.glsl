@@ -0,0 +1 @@
+n ols0srxoio3iu4apt  nvil()s2um(rpnu0alxo oetyd m rl(ms t4 rtrmo3iadfm  li o s  2xriopno1lp emnvsa(farrm(r ou4opxomoeiad m2uaumont0 exrif3tytlmDrlnvs;()tetm(o nu1lp  lfcilt)aDurump;t0tle io3iatlaDrlu pnu0artnir iatopDr nesl() eurxmpiy1omee fcs t  rrrx pou0optn octadls2ea( s () rxnmrcoo1faDelieo t0s2to(m3oodlmen icilsf Dua( ooo0tetn oeiatfm2emnmo t)aetrxo3oadfmD  ues t  rtmiopoydop elneias aDraurp;u0olx  o3tls s em(vo u0 lxoir3oydlatraueols0tetr(mpiy4ll nmivtat) 2rr(mpnu0aetoiieiadlm rln o;t4aeeomrcoydopDrau i;s)s2tmxr oy1lltn ivias aDum(ronu0tetomfctytla2rmnvont0 rxrxr3iydla e ies ()srumxo3iu1opt lfvtas srua( oou4tlxo o3tadfsDuan s t4artrxociodoa   nvo;s0srurimpny1lpen ictls srtrxro;t1oleoiictld a2rlnvsn(0 renmo iodfa elnei;s)tetoio oodolte fcsa() Drru  ;u1tetoiocilsls rlnvs () rxoir3ty1optr iesls  eur(o iu4lpt lfvilt aDrru p;u0aptoioctadfs rmumont)teermocoydlptelnei t0t2xm(o3ou1ale lnes (faDrmumpnt1tleo oeiadfsDuauvo;t0 exomf oytoaD an i;t  2to(m3ou1lltnlfet sfa2trxm nu0olt ifcilsfs um( s;(0tleoif3iytlp e n s s  exoxopiy1amee ivt t aDur(mp;u0tpx  ietlslm2ulnvs t4 etrxr tadlp   n o;(0 2xoxrpio1ap  mneias)aDtaxrono1tlen oetydls2rmumo;t4texoxf3oatlateauvi;s)sexoirpio1omenmnvslsf ruru oot0tetniieilsfa2emnvs t0aetoiociotomtran s s) rtmio nodllen neia(f 2tm(ront0tptnif3tlt s rln s u)texoif ta1om raneo (0s2trir io1am nlivsat)srrr(rono1olx ii3tad aDrln o;u) etrxf3tadlptelnvi;t  2umim iydalenmfvtltfsDrmumonu1oleoii3ilsfs2rmu s;u4 exnmr3oodoaD ln s;(0teuoirpou4alenmnvs (fsrua(  no4alxo fetldfm um(vp;u4 eeomf iotfp r i i;t0trumim3iy4omt liet sfa2tax p;u0apeomociatlaDel( s (4 reoxocootlm raneol(0trtmir io4lmt mictl() rur(ro;t4oee  o3ias m2rmnmpnt4trxoio tadomt auesl( s2xo(m nodam   nctas)sruaurono0apxomoeildlm2umums t4 etnxf3tatfaDeli ol(0 2urir3iodole mncs tfsruau pot1oetnmf3tadfsDelnmo;t) lxomf oytlm r n s s0 2ur(rpiudome mfvilt arur(rp;u0tle ii3iad sDumn p u0 rtoif tytfmDr ieo ()t2xoxo iy4alte iesls)sDuax  ot1tetomiciltlm2el(msn(4 exnxfcoo1lmteai ols  2xriopiy1lp   ieiasfaDurx onu4tptnmfciys a2uanvpnu)aetnio3iy1faD  n il()trxr(o nu4op n fes s)aDtmxmont1tpto oeiys sDrmumsnt0 eenxo3ty1lmDranesls0s2um(opiu4ameelnvs ( a2rrx ono4olt  fctaslm em( o;()aeeoxr3ty1fatr ivsls0 rtr(r oo4op  lfeia(  Drrxrp;t4teeo ocilsls ua( onu0alxomo iodoa  auvs s  2to(o3no4altnlivsltfsrraumoot4tpe mieildfaDeluvs u0arxnif ootlm  ai o;s0seurim oy4lm  lnci (fs2taxm ou4aee ifeiyt a ua( s (0artnifcoa1fmte uvo;t teuo(m iy1lle  ietltfsrur(r ;t1tlxoifctydls umnvp ()tltrio3iatom r i ilt  2xoir oo4openlfeil(  Dumxrp;u1oex ii3ildls2eln s;t0artrxf tydlm rluvi s seto(r ou1lptnlnetls)artm(  oo1aexomieiadfsDemnms;t)altrif ta1fmte ues s  2uoim3iudol e fvi t)s2tmu  ou1tetomoeiltlsDulump u0 rxoxfcoytla e nvs (0 euoxo3iy1lpenlfvtas s2rm( o;o1opeo o3iys m um( s t0treoxfcio1oateanes;s trumxo nu4ope  nvsls)sDta(mpoo1alx moeiad s ra(mo t0 rtrxo3oy1fmD aivsl(0s2to(m3oo1llteliciatfartaxmoou1oetnmoeiltfm uluvont0aexnmocoy1omt auvo;t)t2tmxo3ny4altemivi tfsDraumpnt4aeen oeilsfa ra( snt4trxomr io1lpD ln s t0s2to(opiodap nmnei s s2rrx  nu0oeeo fciyt s rmump;t)trxnmf3iydfaD  i i s trtr(mpno4alt  neslsf Dtrxrpou4ole moctyd sDrlnmpnt0 rxrmf oadopt lnvil( trur(o3io1am  lfci (  Durx pot0tee  ocils a emu s u4tetnmo iatfm r neslt)setoim ou1alt lfvtl( s2umx pno0tpxnioeiasfaDrm(vo;t)areoxf3oy1laD au olt0trtoir3iydopt livtls)sDtru ont1texn feildla em(vo u)aexoirctodomtr i i s  etm(r3io4lmtn nciasfa2um(m ;t4ale  iciat aDemu o (0 leoirciatfmDrlnvs () 2trxr3iydolen ies s  2ta( o;t1olt mo3ilt s rlu sn(4trxrif3oa1omtran o s t2uoxr3io1al nmfvt sfsrrrxm nu4oeenio3iadfs ea( onu)aetrxr3oytlatr i s (  2urimpio1lme  nctat)sDrm(ronu1aexnmocilslm2uanmont) exnxr todomtrln s;()s2uo(rpno4openmfes t)s2rrx ono1oeen i3tlslm2emnmpnu)aexomfciydfmt livi;() rxriopoo4aptemnviltfa2tmxr ;u0opeo oeiytla2em(ms;t) lxrmrciytlmDeaivsl()tetoirpoodoleemfvtas)s2rr(m oo0oex  ieilsla2emn p () rtnmrcty1omtraieols)trxm(r iy4alenlnet ( s2rrxmo;o1aet io3iytfm rau pnu4 eenxfcoy1fa  anvil()teto(r3iy1lltnmiei t)aDurxmo;u1aptnii3ils a2rm(vp t4 rtnmr iatfp ran i;t t2uoio3iodlltnmietlsf rrmxmpou4oexo iciat m2raump;(0artoir todfa e nes;s)t2tr(mpno4lm nlfei t)aDtaxrpoo1aeen feilsfm2ul( o;u)aexnmf3tatfmt liei;t t2tm(opnu1aptemnvia( sDrrxro;o1tpxo i3iytfa2ulu s (0teermf3oodoa e ivi s0texr(opnu1ap  mivt sf Drr(mo;o4tpxnmfetlt m2eluvonu4altoxr3io1fmDe i i ( s2xmxm3oy4lm e ictasfarua(rp;u1aptn fctlsla eluvs t4trtrxfcoy1lat  i o;t setm(o no4lp emfvsa(f 2um(r ;o4teen o3ias m2emuvpnu)aeenir ty1fmt ai ols  rtm(m3no1op nmicta(fsrraxmp;u4olen oeildlsDrlu pn()alxomfcoodfpDeluesls setrxrpou4lpenlnvilt)a2rr(mpno1aetomoeiltlaDem(vs;t4 rermo oydlat  nvo t0t2toiopnodlp nmfei tf Dua(mp;o0oltn i3iasfa2el( pnu0trtoif3todfpD luvi ( t2toxo3nydope  fcils)s2rrumpnu0aetnif3iat mDemump t4aetrxocoatlateaueil( s2tm(m ny1openmfvia(fa2ta(m ;t1oltomoeilsfaDran o;(0treoxr tadop eliei t0setr(m iy1lmee iei t)arra(rpno1ale  f3iltls2ua( pn(4trtoxociytlatrli i;t  exm(o iydll  mnei t aDtrumoot0tlxnmfciasla2ua( p;t0tlxomf3oadfa e nvslt0trtm(m3iydlme lfes t aDrrx  ;u4apeoii3iysls2ul(vsnu) lxoircoydomtr uei t srtrxm oo4omenlfctatfa2ta(mp;o1aeeomoetat s2el( snt4aeermfciydlm e n ol( setoir3oo4ap n neiatfa2uax pnt4aeeo feild s ulnvs;t)teeomoctodlmteauvs ()trxoiopoudalenlfcsas s2urur nu0aee mf3ils m uanvo u) ltrmr3oatoaDrli o;t0trxmxopoydlmt mneil( a2urxmpoo1tee  ieilsfs2rl(mont)alenxocoatla   nvs;(0s2uoir oodom nliviatfa2rru onu4oltnmietldlaDea( pnt)aetnxo3totfat aieilt  rxrxm3iy1op nlfes s  Drmxmonu4tpto f3iyt mDem(mp t4 rxnxrcoo1late nes t s2trir3oy1lmenmnvi ()srta(m nt1alxoioctltfsDulnvo u0alxrxr tydlmt luvi;t  2umio nu1lle mivsl( s2tmu  oo1tltnmfciadlm2rlu s (0aetrmr iadlp   iei s)t2tm(r nydlmtelnvt sf Dtrurpoo1apeoioeildls2ua(mo t0 lxnxrciatlaD li sl()sruoimpoy1al  mncsltf 2ta(mont4aex mfeiltfs emuvs;u0alerir oo1om r ues t0trtr(m3iy1opeemfes ( a2tm(r nu1apx  oetadfa2rmn s u4tetnio ty1fpDeauvi t t2umxr3io4llt mfes (f 2um(rono0texomfeiatfm2emn snu0 exoiocoo1laDe neol( trumxrpiy4lle mncias  Dra(rpnu4ole mietlslm rmums t4alenxo totopteau olt0trurim ny1omt  nctlsfs2urur nt0apx mo3iydfmDelu p;t4tlxnmr io1opteanvil( trtr(o3iydal nmieiltfa2umurono4aeenmoetltlm2emuvs;u4 exnxr3oytfpD  u sl(  rurxrpoo1ape lfctas srum(rp;o0tlenmf3iysfs2el(mpnt)aetnif3tadomteau sl()s2toio iydam nlies (f Dumx pno4aexnmoetyslm2el( s;t0 eeoifcoadoat anvo t  2to(o3no4amenmivtltfsrtrurpou1aetnif3ildlm ulnvpnu)tltrif iadfa   i o (0sexrxr oodol  lnct () Dtmxront4apenmfciaslaDrmums u)areomo ta1optelnes s seur(opio1alte ictls a2uaumono0apxn feiad m2el( o u)alermf ta1fmDrauvs ()seurxm io1omtn ivils aDrr(mpno4aleniociad s rlump t0 eermociadlpDraneo;t0sexrxm3nu1om  livs s  Dtax  nt4olx io3iltfaDeanmo (0artoif3iodlmDr u sls teumxrpoy4om nmivils sDtr(rooo0oex  fcilt s2ra(mp t4tltrxfcoadlm eanvi t) rxmio3iodop nmnesasfa2umx  nu1aptoio3tatfm ulnmp;u) rxrir3iadlat  n s;t s2xm(o3oodap n iesls)srtau ono1tleomf3iatfs rlu p (4 rxnio oadomt  ivi;(0srxo(o oy1olee nvi s s2rmx pou0tpeoio3iatls2emu snt)trxrxr3io1fpt ai s;s)s2uoirpnu4op emnvil(f Draurpou4tpe ii3iaslm2elnms u)alenio iytlmte ivi s) rtm(mpoudamenmivtl(fsrraxmpot1oltnifctldlmDrl( p;t)tetnifciytfpDeanei;t0trxr(m3oudalt lict sfsruaumo;u0altn fcilt aDrau o;u) rtrmf3iydopD livi ()s2xrxrpnu1ale mfesls  ruaxroou0oex mieiasfa eanms;t0arxoxr totlpDr nvi t)trxm(rpno1lmee ici ( s2ur(mpnt1oeeoii3tatfs rm( o;u4texnio iodoaD aivo;()t2urio oy4aptnlfet sfa2umum ou1altn iciad a rlnms;t4tlxoxr3oadop elivi;(0seuoxrpoydopt  fei ( aDtr(mp;t0opxnmo3ildls2elu o u)altoxf3ty1op e ieil(  2tmiopnudomen ieias)srumxm ou4opto oetat s ranvpnu0 ltrmocootlmD ln o t0 rxrxrpoodomtemnetl(fs2um(mo;o1openiieiytls um(mont0trxrircoodfp rlieo () rxm(m3iy1om nliei tfarur(mont4aexnio3ildlsDemu p t4tlxrxf ootop  an i s  rtmimpoo1al   ncsasf Drr(r ot0optoio3tls m rluvs;t4arxoxf ootfm rai o;(  exmim oo4altnmiciasfs2rmum nu1tetnif3tyd mDuanvp;(4tltrxociytop rln i;(0trurxo oy1lptnmfcil()a2rmx  ot4opx  i3ildfaDrau o t) ltnmr3ootomD  i il( s2ur(mpoudlmtemicsat) 2raxr ;u0oeen iciydfs ean o t)artnio3io1opD lnvs;s s2ur(rpoo4om  mnviasfs2umur ;o1opt moetytfa2rl( o ()artrmfcoa1fm rlieil(0 2xrxm nudlm nmivt (fsDtmu o;t4tpeomo3iasfsDra(mp ()trermo tadlaDr uvslt0 2xr(m3iudop nmfvia(  Drmur ;t0oeto f3tltlm uln o u4tetrmo ta1laD ai i ()s2uoiopoy1amenmfciat)sruaxrpou4ale ifciat aDraumo u)arxoxrctotfp r nei s0 2xrxrpnodap  mfvs (f rrru  ou1aetnmiciydla2rmu p ()aetnmoctodoa  aneo;() rxmio3no1lmen ncsatfsrururpnt4tpxnmf3iltlsDeanvpnu)altrmrcoodlp rauvilt  eur(mpiy4amt mfet t)aDua(mpot0apx mociatlm raumo;t0tltrir3ia1oaDr ues s sruoim3iy4amtelncta(fa2uax  nu0oeto icildfa2umnmpnu4artnmfciatfmtrluesl(0srtr(o3iu4opeelfcsatfsDum(rpou1tee mo3iat s ra( s u0tltoir3oy1fmD  n o (0 rumio3iu4lm nmfetl()s2truroot0tlx iicilt mDra(vpnt0artoio3todop   u slt t2tmxr nudoptnlieta(f Dtr(mpot0alt  o3iltfm2rm( o t0 rtnmociy1fp  lueo s)t2urxmpou1ap nlfesat)sDtm(  ;u1apx mieiyt a2ua(vo;() ltoxo oadopDr ueo;(0 euoxopnydoltnlnctls sDuaumooo0oleniociytlm2ua(vs;u4 eeoir iy1fa r neols)setrxo oodale lnei tfa2ua( poo4alx  oeiltlm rmums t0trxomf3tytoa  anei;t t2uo(o3ou4amtemnvs s)aDra(r oo4alto iciyd mDeluvpnu0 lermo3totlp  lnes;(  exmxo3ou4lpt mfct ( srtau  ;o1ole mf3iyd a2umn o u4 ltrio iodfa eli il()teuoxmpiy4al e ncils a2umumo;o1tle iietat aDuln sn(0 rtnxocoydoatean olt0 rto(m3oy4lp e nctl(  rrmu pno1opeoio3tltls2uan p;t0tltnirciytopD ai o;(0 etoxmpiu1ome lfvsltfs2uaurp;u4tlxnmoeiyd aDum(vo;(4trtoio3ootla   iei;t0 rtmio oodop n fvsl(f Dtmx  ;t4tleomi3tlsls2rau pn(0trxnxo3ootfa eauvo;() rxoir oy4lpte iet t a2tr(mono0ole mf3iydlm2emnms;u0arxriociadoaDeauvs;t) 2xrxr3oodame lies ( aDurxm ;o4aetnio3ilsfm2um(mo (0alermr tytfatelivolt trxm(o3io4omt  nvtlt) 2ur(m nu4opeo ietasfsDulu s;(4 exomf tatla rlneo;s0srtmxrpiodal e ivtl(f 2rm( pnt4opxnmietys m2umn s (0aetrxf3ootfm   u s;t0trtm(opny4lmt  fcs s) Durumpoo1apx moctasfsDuau pn(4arxrxo3iydfp e uvi s0 rtoim no1ape  icilt) Duaxrp;u4ale  feias a2ea(ms;u0areomoctytlm rlneils)srur(m no4am   nes s srumurooo0tlx  iciys a rlnmo;(0alenioctydfmtrluvs;(  etoxo3iy1altnlfvt s)arta(r ou0ale  oetysfmDem(vs u4teeoxr3iy1opD  neol( srxmxo no4olee ictl() Dtru pno1opxnmf3iydfaDrl(vpnu4 etrxfcia1lmt  ueslt trto(m iu1apenmnvt sfs2tmu  no1oleo fctydfm em(mp;t0arxnmr3iatfmtelivo (  rurio iydap e nvi (fsDtrxmpot0tpenioeiyd a2eanvsnu4trxnmr3ia1lptelnes t0s2toxm no1amte ncil( srrmumooo4aleo feilt m ranmp u4aexnxo3oytopt lies s  rtrxo oy1apt lfcsat)aDrau p;t4aexomf3iadla elnvp () exnxf3oydfm rluvo s0 2xrim3ny4omtelfes s s2umumpnu4olx  f3ilsfa rl( o t0 lxrmo3oatom e ivo t0 ruoiopoo1lltemfcsls)s2trurooo1ale ifetldla uaumsn() lxoxfciotfmDran il(0trxmxo3no4om e fcils  rum(r nu0ale if3iydlmDea(ms (0texoir3iotfpt anvols sexo(o3iy4op  mivt (faDrrum ;t4olx mo3iytla rl(mo;u0arxnmo3iydlptrlnvi;(0srumxo iu4lptn fvtls  2rauronu4texn feiydfa em(vs t4aetnxo iydlp  anes s0 2xrio3oydlp nlivsat)artmxrooo4aexn feiadfa2rmn sn(0 lenmrcoytomt lueol(0 2um(r3io1altnlncs () 2rrurp;o4opeo f3iat sDumump t) eerxf3tadlaD auvolt0 euoxm io4ll elicias a2rr(  ;o1tpxoiieiytfaDulnmonu)trenmo3tytfatranvi t  exoxmpiu4lpe  iviatfs2rrxmoou4aptn oeilslm rmump;(4aeeoxfctodopDran i;()srtmir iu4optnlnvsls)srtr(  nu4olxo ociyt m2emnmp t)aetrxo ia1fpDrlieils)texoimpou1oltn fvia( srrmur ;t0tltomociad a2uln p;(4 leoio3to1la e i ols srtr(r iydlpt  fes ( a2trxrpnt4altomo3iyd sDuauvp;t4 ltnif3ta1fa   n o s0setrimpiudal  mfetl( srrmum nu1opx mfctlslm2uan o t)aeenircoa1fp  livi t0srtmxr3ou1altelfvi ( srua(m ;u1opt  fcilsls2uau snt4 renxo tydlaD  uvo ()trxo(m3nudopenlfvil(fsDtaxr oo1oeeo ieiadfmDumuvon(4aetrxr iotlp elies ()srurio3nudape lnvi t)s2ur(mp;t1tpxnii3iat s rmnvpnt0altoxociydoaDeln ols0srtrio oy4olenmfct s) rtrumonu4ale  ociyt s elnmsnu0tetrifcoatopDe ueo;s  etoxm3nydom n ivia(fsDua(rp;t0opeomfcias a2rauvs t)aeeomr3tytomDr i o;t) rxoir3iydamtnlfct sf Drmurpot4apx mictasla rau o ()arxomo io1lmteaieo;(  rumirpiu4op n fctas)sDum(ronu4ale mi3tls sDumnvp u)tetrmo3iadlatrlu sl(0srxmimpiy1ale lnciat)arta(r no4aptoifeias a eluvo;()areoir3ia1lmtean o;t0t2xo(opno4oltemncsasfs2tmuront4tpto feiytlsDrlu onu)treoxfcoytfmte i o t s2tmim oy1ol nmfeta() 2tmxr no0olto octydlm emuvp;()aeenxo tytoatrau s s0s2tmxo ou1alee nvs t)aDra(mo;o4aptnmieiat mDrlnvo (4 reomo ootlp  lnes;s s2um(o3iy4amt  ics ()a2rrxrpnu1alt if3iadlaDeau s u4texomo3tytfaD an sls t2xrxm3iydlm nlnvils) rta( o;o4tlt mfctls m2uln snu)trxoir3tydomtr ivs;()seuoxo3nu4om  mnesl( sDrrurooo4tlxoiiciyt aDuln o;t4aeeoircoadoaD auei t seumxmpio1ope livi s s2urxroou0tet mociaslaDra(vp () renxo3oy1oatrlu o ( sexm(o iy1altelfcias  Dur(rpou0tlxomfeilsls rmums;u)teeoxr3oytfat li o;t sexoxr3iodape  nei (fa2rax  ;u4ale iiciadfaDemn o;t0 rxrirciadop elneol() rxr(mpnydlltn nci s sruax  ;u4alxn iciydla2ra( onu0artnmr3totfp  ln il(0 ruriopoo4olt liesls)s2tmumpou1apxomfeilt sDrauvo ()tltoxociotlmtrluvs s)t2umxm3nudlm   ivtlt) rtrum ;t0oeeo fciytfs ua(vs u0trenir3oatlptelnes;s s2trir ou1optemnciat a2tm(mpot0texn ietldla2rl(mo;u4tetoircty1lp e u s t0s2xo(o oy4am n ivilsfs2ta(mpnu0opxomieiat a2umu o ()aeenxf oy1oaD ai i;()seumirpoo4al  mfeilsfaDrrurpot4tpxnio3tyslmDra( pn(0 etoxf tatlpte ivo;() rum(r nu4apt  iet (farua(mo;o0opt  i3tytlsDeanvo;u4arenir3iodfmDrluei;(0sexoxr3nydape miei ()sDrr(rpnt4apx mi3iltfa2umuvp u4 renxo3iodfmDeanvs s0trxrxr3ny1lpt  fvtat a2taxm ou4alt  fcilt aDrm(mp () eenxfctotfmDe neo;( teum(m iu4ale  ivtl()aDumurp;o0tpen ociasfa eluvo;u)altnmo3io1lmtr n o;t)trurirpoodame mfcias  Dur(  ;o0aex ifctydlm ea(mp ()arxoxr to1lpteauvsls0 rxrxm oy1amt  nciasfs2rr(mont1tlxomfctysfm ra( on(0 lenmocoadfpDe n s;t) rumxrpnodal  lieiltfsruru  ;o0aeeo iciydfa2rauvs u0trerif oatopDeau s (0sruoim3ny1op  lfctlsf Dtrxm oo1openmfciysfa2rln s;u)teeoxf iotopteai o s  exr(rpnu1alt  ies ()sruau  nu4tlt  ociytls2ua(vs;(4 ltnir3tadfp rli i;s)texrimpno1ol n nctas  2ta(m nu0opxnii3iydlmDea(mpnu4 reoxrcoadlpt  u s;t)s2xr(m no1apt lncia() Dtaurono0apeoio3iytlmDrmnmp;u)trxrxocio1oa e nvil( t2trim3no1am  mfvsa() rtmu pnu1texoifctysfm rl(ms ()artrif3iodfm elu sls0 2xoxrpoodlmen ncs t aDrau  oo0alenmoeildfsDrluvo;t) lxomfctadlpteau s ( t2tm(o iy1aptnmiet t a2trurpot0opx mociad a2rauvo;t4trenir iodlmDrlues;s) 2tmxo ny4alt mfvtas)s2tru pno0aet ii3iltfsDemump;u)trtnio3tadfpt  ivo t)sruoim3oo4om n fes s)aDtrx oot0tpe  feiydfm2ul(vo;(0aetrxf ootfmt au o;s0trto(rpoudlme lici sfartaumooo0oee  i3ilslsDel( s;u)alxoxo3oa1lmDe uvsls trtmio oy4al  lfvsasf 2um(mpot1tetnmoeiat m2eln pnt0trxnio3oo1la r ivslt0truoxo3iydalte ieta() Duru p;t1tltoio3iydfaDrmn ont) renir oodlmt lneolt0t2um(o nu1alte ict s)a2tmxm nt0olxn ieiatfs2umums ()artnif tadlpt  i o s) rxoirpiy1llenmiesl()s2trum nt1tpx mfeilt a2elumon(0trxnmf3ty1faDeanvo;t sruoxr3oo4ale mfes tfaDrrxmpnt4tle  feiydlmDrmnvs;()alxomo3ootom  li i;s s2urio3iu4aleelfet sfs2umx ont4aetnmietld s2elums t)arerxfciodopteanei t0s2trxrpnodame  feia(fa2urxmont4tltomo3tyslm2rmuvpnu4 lxnio3tadlatr neol(0srxoxmpnu4amtnlnei (fsrumump;u1tpeoif3iadls ua(msnu0tetrxf3io1lmD an s ( sexrxr nu1amtnlfeias) 2raur nt1tex mo3ild aDumuvp;t) eenif3oatlmteliei (0t2tmir3ou1llt  iesl()aDrr(mono0tlenmoctyt s rauvp u0 rxrir3ta1lm rli ols) rxrir3oy1lmenlivsas aDrmxroot1teto oeiydla2rl(vp t0tlenxrcoadlpDrluvo;t0 2um(o oy4ap elneils sDuax o;u0tpe moetytlm2uau p t) etnif iytlatelneils  2xmxr3ou4ol nmivt sfaDuaump;o1tltomiciltfa2ran s (4areomr oydlm  lueo t) rxmim ou4lm eliesls) Duaumonu4ope ifciydfs uluvpnt0teermo3iytlmDrauvi;s) 2xoxo iydlmee fvtat)sDtrur no1altoiociatls eanvo;t0texrxfctytfpteaiei ( t2xm(m3no4amt lictat  Drru pnu1tetoif3tatlaDemnvo;t0aeenirciodla eanesl(0 exoxo3iu1alee iviat) Dum(r no0aptoifctldla2uauvp u0aexnmo3tatfat li i (0 exrxopiy1lm n ics s s2uax  oo4tptnmf3tydfsDuauvs () lxrif3iotlm e n s t0 eumxm oo4ap nlnvia(  Drrxmpnu4oeenmf3ildfs2rln p (0teeomocoadom eaivs t0s2xoirpoo4amt  fesas)aDrm(r oo1aex iietydlmDrmuvsnu4altnif3tydlmDe iesl()srtr(mpnydalt  ivtlsfsruaxm ;u1apeomicild s um( s () eerxo oa1fm  lues;s  exmxm3io1om  lnesltf rur(rp;t0alxnmociasfsDean pnu0 eenmo iydfa rai i t0teum(mpoy1optnmietlsf Dtrump;u0tpxo ociyd aDeln o t)altnio oodfa rlies;s truo(rpou1lptnmnvilt sruau  ot0aee miciysfa2ul(vo;u4artnxr3io1laDran ilt trum(rpoy1lm nmneias  Dtru o;t0opeo icilsfm2ua(vsn() ltrxf tytopDe i s t) rxrxm3oy1ole  neiasfs2rmxro;t0tetniieildfs ua(mp;u4trtoircootlpt an s;s s2tr(r3no4oltnliei t aDraurp;u0altnifetaslm2ulumo u) ltrxr oytfmDeai s (0s2trirpou4ame mictlt)sDrmxmonu0apen iciydfaDuauvp u) ltomrctydlm r ies;s trurir oudame  fvils)a2raxmpot1tpt mf3ildlsDrauvs;t4texrxo3ty1oat an s;t0teurir iudolenlfvtlt)s2um( ooo0altomfctys a2rmnmpn()aetoiocoydop   ueo t)trxoio3ny4llenmivtls  2ra(mo;t1olt mi3ias a umuvs;t) eeoxo oydfptelnvs;()sexrxm iy1alte fcilt srurxm ;t1oeto o3tatlm uanmonu0tlxnmrcia1lmt  ivo;s)srto(m oudlmtemneta(fsrrrx pnt4tee if3iys aDem( s u0trtoxoctadlaDrluvi;s)s2umxmpiydam e nci sfaDuau  no1aetoii3tldfsDrl(vsnt0arxnmo iadlpD au s t0sexrir3iy4lmt lnviat  2rmump;u4oltomictlt m2umnvs u)treoircoa1lmtelneolt)t2xoir3iy4am n fetat) rta(m ;t1teto ietysfaDeauvpnu0 etoxr3totoaDe i i;( trur(mpno4lmtnmivtat  rur( ooo1opxo o3tyd s2ea(vp u) etnxf3oa1op raivi;s)teuoio oo1op e neslsfaDrr(mpnt1oetn ieiysfmDrmn ont4 rxomfcoadfpDrlu i;(  2xr(m iodomen iet s a2raurpnu1apen i3iytfa uln sn(0tleoxfcia1lateau o;t  rxm(rpiudaptn ivsl( sruax oot4alto ociadfm rm( pn(0 lxoxfciodlpDrli o;t srtrir oo1aleemnvslsf 2ur( pot0tpen i3tltfm um( pn()teenif3ia1omte ivilt)s2xr(o oo4aleelfvi (faDta( onu4tpen feiltlm2elnms (4tetrmf3oa1opt  neo;s) etm(o3iu1omte net ( a2urxm no1olxnifetydla rl(vo;t0 lxrmf3iadopDeanvo;t tetm(r3oydlltnmnct s aDum(  nu0oleoiieiatlm um(ms (4tlxriociatoat  nvs;s0setmio3iydlm nlfesa(fs2tmx ont4tpxo o3tlslmDeau s;u0artrir3ia1fmtr nei;s  ruoim io4al  lfvsat s2rr(  ot4tlto ictatlm ulu s u4 eenio3todopteai s t)trtmxo3nu1omeelivilsfarrmxroot4alen i3iyd a rlnmp;t)trtrir3iy1omtrlues s)texrxmpoy4op e nesls aDtmxr ;t1alen o3tat a2uln o;() renmr iodfmDe ueol() 2xmxm iodlmtnmies t) 2um(m nt0oexomfeiadlmDrlumon(0 rtoir3oa1fp  auei;t0trxoio nudlm  mnei (fsruru  no4texo i3ias s uanms u0arenio totlaD  i sl(  2trim3ou1op nmfvs (fsDtaxr no4tpe mi3tlt aDeauvs;t4aetomr3ta1oa rluvs;t  2xmir3ny4lle mneta( a2rrx  ;t4apxoioeiatfa uan p (0aexoxoctadlpDeaueo;t  exmim io4lmee fcilt)srur(rpnt1oeeomfetadfa2ua( pnt0 lenif iytoateln i (0srtr(rpou1olte nciasfaDurxrp;t0tpeoio3ild mDrmums;(0alxoxo iotfmte i i s0 2toim3oy4apt lncs tfs2ur(rpou0tpx mieiatfm ea(vp (4arermfctadlmDean i t)sruo(opiydom  mnvtlsf 2raxm ;t0ole mfetls m ul(vp;t)texrio3iy1lmtrlieils)texm(rpoo1omeemivs sf rurxm ou1tlt  f3tas s rl(vo () exnxocoy1fp eai o s t2ur(mpoodalee fctl(faruaxmp;o0oltomf3iytfm elnvonu)trxnmr3tytlmteaivi;s) etoim ny1alenlivslt  Drmx  ot1aetoio3iad a rmump (0trerir ootomDraueols  2xm(mpny1optelnvias srurxrono4olxnif3iytfaDrm( ont)aexrif iatfa r uvols)t2xmxo iydlme lfetl( s2tmxr ;t4tltnmiciyd s2rmn sn()tlermo3iatfp r n i s) rurxo iydlleemnvil( sDtaxront1tex if3tlsls2eanmo t0tetnxrcty1omDeaueo s)seur(m io4aptnmfctlt) 2rrur nt4aexo i3iaslmDum(mo;u4 ltrmocoydfaD ai olt s2trio3oydlm n fcsls  rtmumo;t4aee ioctydfa2rl( pnt0artnxo3tatoa eluvo s sexrxopoo4lp nmfeil()sDrau pnu0oeeoifeiasfs2rl( sn(4treniocoo1lpt an o s0t2uo(m iy1lm emfvs ( artrumo;t1aee io3ild aDrm( p;(0aexoircootlmD anvil(0teur(m3oodoleelfei s  rum(rp;t4ale  f3iasfaDrmnvsn()areoio iodlptrau s;s)trxo(m3iu1lpt mnetls  ruaur ou4alx  ieiyt sDumnmo;t)tetrxrcia1lm eai s;s0sexrxopiu4lpenliesl()sDumur ot0aex iictatfa ul( pnu)trtoio oadfateaivs ( srtrxo3oo1ape mnctl(fartr(rooo4apt ifctaslm2emu pn(4aexnifcto1opDr ueols setr(r3oo1alen fesltfsDua(  ;u4tpe ioeildfs eanvp;u)arxrxf iy1la eaiei t0 2tmxm3io4amen ietat srua(ro;u1aptnmicild s2ulnmo t0arenmfcoydfmteanei s)s2xrxo oodaptnlictl(fsDraum ;u0oeto fciydfsDuauvpnu)texnmocoodlp  aivslt) rumxmpiudom nmieia(f Dumx o;u1apeo feiyslsDran o;u4 rerir oy1faDr i s () rtr(o no4alen ncsa() Dtr( pno0ale  f3iys s2eluvpn(4 etoxo3oytoat li i (0truoxr iu4ameemicia()arur(  no0olto fctatfaDeanvp;() ltomo3iydlm elieols t2tm(opiudol emnesat)aDrr(ro;o4tetn fciyslaDrm(vs u)aeerir oa1latean olt t2urxo oodam nmicsatfarraumpnu4texomictysls rau pnt4 ltrxo iydlpDelu o;t)s2ur(rpoo4omenmfvslt aDtrum nt0tpx  o3tatfm2uan snt)arxnxo oodla r iei s)trxrxm iy4amt  ncils aDuru  ;u4tee ioetls a2um( snu4aetnmo3iatoaD ai i t t2tr(o3nudlp nmfviat) rrmxront0apxomfetls mDrm(mp;(0aeenxo3iytlp e ieols) rtoirpno1ameelivtls)a2ururooo1opx  ociadla2el( sn() eenxo3to1fmD lnvils)t2umir oydlm  mncil(  rumxro;t4oeeoioctld s2um( snt4 exnmfctytfp   n sls0srtmirpoy4llenlfei t)artm(rp;t4aetomiciytfa rmuvonu0 renxoctodoaDr ueo;(0 rtm(rpoy4olenmicil() Dtax  nu1opx iocildfa2em(mpnt4tltnif3ta1lp  anes;s texoio3no4alt lfvta(f 2taxm ;u4ape  i3tat sDea(mo t4texrio3oadfmDr nes;s seumxr ny1oltelfct t)s2tmumooo0aet ii3ilsfa rl(mp;u)teeoirciatop r u s t0 rxoiopnodlltn nvil(fa2urxmp;u1alenif3tytla rl( pnu)teerio iydla  anvols  rtrirpou1am  mfvtltfa2rmump;o4aptnmoeiltfa rl( o ()teenir iydfa r u o t) rxo(r3io4oltnmfci sfsDurumono1oleniicildls ua(mpnu) etomf3iydla ranes (0 euoxr3nodopte fei (f rrr(r ;o0ole miciys s2em(vsnt0 ltnir3iodfa eaueo;( setrimpio4apt lnet tf 2rr(monu1aetoio3tadlm em( p (4texnmr todfmD luvol( t2tm(o nu4llt lnviatfsDtru  nu1ape mi3ildfs2rlu p;u)texomf oadfateli ils truo(r nydole mivi () rrmx o;o0aleoifctasls ran o;t4trermfciatopteai s;s) 2to(m3io4op elfet (fsrur(  ;u4tetn i3tyt aDeluvp;t0tlenmocoydopDe ueilt) rtriopou1opt lieslsf rtr(mp;t4alx mfciatlmDrau p u) reoxfcoy1latelu sl(0teurir3iudlmeemfeiltf 2raxrp;u1oltoifciys a2umn s u4treomf3tatfpDr nvolt0 rtoxm3ou4am emfvs s sruax pou1oetnifeilsfm2el(vsn(4 lermfcoa1fatraivol()s2umio iodamtn ncsat a2urxmono1opt mfctatlaDum(vsnu4 lxnmr oadfmDeauei ()t2xmxr iodopeelictatfsDuaxmpou0optoiietltfm ul(mp u0artoxr ty1fp  luvs;s texoxr oydaleelicsas  Drr(mo;o4tptnifctls aDranms;() eeniocoatfp r uvs t srxo(o oy1am nlfcilt sDrr(moot4altnmi3tytfs2elnvsn(4tltoxrcoytomteaieo t  2urim3oy4lpenmivtl( s2tr(mpnu0aet moctys sDrln p u) reoxrciatlm   u o;()trtm(r nu4optemicia(faDum( ooo1aptnii3iatlmDulums (0altoir3oytlmDrauvo t)trtrir3iudapee ncias)srrmu ooo0apt iieilsfs ra(vpn(4aetoxr oo1lpDrauvo (0s2xoimpoudoptelncslt aDtrxmpno4tex ifciys m2rl( pn(0aeeoxfcia1opt lnvs;s)teur(r3nu4optnlfctltfsruau pnt0tee  feiaslmDelnmp ()aetrxo tatfpte u ol( s2umxr iy4ape mivia()sDrrxmpno0tlto iciysla2uluvp;(0trenxr3todfp  lu i s s2xoxo nodolt lfvta( sDraur ;u1teeomf3iadfm umu onu4arenxociytomtrli o s0s2tr(rpiu1ap nmfctat  Dtru  ou1alen feiatfa2rmumo t4arxoxr ty1oa eaivs;( t2xoio3iudll nmfcsatf Dtmum ot4oex  f3iatfs2rau ont)trxrxrciytlp ean i (0s2trxm3oo4oltn ieiatf ruax pou1optoifeiytlm rlnmp (4 rxrmr iodfpt ai s t0t2toxo nodoleemncs s  Dtmu  ;t4tet  o3iyd m2ulu s;(0arxnirctydop  an i s teuoxr iydopt lnvsls)arrau p;t1teeomoetytfa2umnvs;()tlerxocia1lmteaivs (0s2tr(o oo1om emfci ( s2raxr ot1texo fcilsfm2rm(vs;u0alenxf todfa   nvo t tetmiopoy1om n nesas s2trum ;o0texnmictydfaDeln s;t) renif iydfpteln ol(  ruoim iu4ap nmnct t)s2rax  no0aetomi3iyd s um(vo u4teenmociytoatrlneo t)trtm(o ny1lptnlfvs (f 2tmumoot4apxnio3tyt sDrmuvp;t0 lxoxr3iydoatean slt0t2xm(r3nodlle mfvs (fsrtr( oot4tpe  octad m em(mont4trxrxociy1fp elnvs;t) eum(m3io1ope lnvs s arum( pnu4openiietltfa2ranvpn(0teenmo3iydlp   nvsl(  exoxr ou1ame lietat s2uaumo;o1olxoifetls a ea(vo;(4arxrif3oy1fpt lnei;(0 eurxm3io4lltn ivsat s2rmurpot1tpxoioetysfmDea(vo u)aetoir ia1oa e ivo;s) etm(r3iy4apee fvt ()arurx  ;o1tpenmfcildfs2ra( o u4trxoir3ty1fm eaivs;(0 2uoim3ny4lltelnvs sf rurxr nt0alenifciysfm em(vo (0arenxf3iodlm e u o t0 2um(m3iu4lptnliviat srumur ot0olen f3iadfs rmnvs;u0tleoxr3oa1om rluei;t truo(m io4omt  ncil(fs2rrumo;t0alenmieils m ean s ()teenmo oadopt lnvol()srxrxr3no1opt mietl( a2rmx o;o1apx  f3tasla2rm( p;t0 ltnifciydopt lnvi t s2tmiopiy1lpt  iesat a2taxmpno1tpe ioetad mDulnms u0 lermr3todoaD  nes;(0t2umim no4llenmfesls)a2trumo;o1aee if3ild a eln p;t4 ltrxo3oo1lm e nvo;()s2tmxr oydal   ivtlt sDur(r ;u4apen o3tas s eaumont4trxnxf3tydfp eaivo;s0s2uo(m iy4alt  fvslsf 2tmur ;t0aee  f3iysfmDrauvp ()texrmo oadopD anvolt)srxriopio4alte fctl( s2tmumpno0olto fetydfmDelu ont0 reoirciotomDr ies (0 rtoir nu1lmeelneiasf 2trxm ou4oet moeiydfaDulump t0 etoxrctytlaD aues;s) rumimpnydol  mivil(  Drr(monu1aeen o3tyslm2umuvo u0tetnmociy1fmt lieil( trtrxrpoudop nmncsl(  rraxr ;t4aleomfeilslmDulnmo u0tlerif3tatlaD  neo;s  rxm(m3ou1lm emfesls s2trx o;u0opt  i3iyt aDuluvp u)tlxrircootlpDe ueols0texrxr3ou1amtelies tfaDta(rpnu1teeo feiyt m uluvpnt0 lxoio oodlp eln s;( srtoimpoudll elieta(fsDtrxro;o0tptoiocilsfs eanvon()texnxo3oadfpD auvs;s t2trxr3no1lpte ivtas aDrax pou4tpeo ictad a2rmnmo;(0arxnmf3tatfp e i i s)trurim3nu1ole lfvtls s2uau onu0alxnmi3tyt s2um(vonu) lxomrcoy1faDr iei;t s2to(m3iy4ole livtlsf 2rrxm ot0aeen ieiltfs2ra( p;(4trxrmr tadlpt au slt0trurir3oo1al n nci tfaDra(rpot1tlxoii3iad s uanmon(0tetrxf3iadlp rln i (0seurir no1lptn fvilt artmxmoou1texn oeilsfm2umu snt)trxnmo3oa1optrlnvol()trxrxopiu1lmenmfeilt sDtaxro;o1tlt mictytfa eauvs;u)tetnxocootoatr ieo (0 eurim iydalenmnct ()sDur(  ;o4tex mf3ilsls rau s u0texomr iatlpt  ivil( tetoxr nodopt livt tfaDtrumoot1tlto ociysfm2umu s t)altrmrcoytfp elues t seurimpiu1amtnlnei sf 2um(rpoo4tpx mieildlm2ulu s (0artoxfctatoaD  iei;(  rtmxr ny4oleelnvslt)arrmxmono0oexo feiltla2elums u)alxnxociodoa e n o;t0seto(o3nudope mfvtl( s2rrxr ot4apx mo3iytfs rmnvon() rtoxf tytom  li s;s  2tr(rpno1lltnlncsas  2um(rono1tlxo i3tadla umn pnt) ltnxr tatfpD  nei;t) 2toirpiy1omeelfvsl(f rur(rpnu0tetnifetlt sDemn pnu)tetrxrciydlpD  neo;(0s2urxmpio4op nlieslt)a2uax  ;t0apx  o3iyd m emnms t0texrxo iy1fpDeluesl()tetr(opou1oltn nvia()s2raurp;u1tpxn feiatfm2rmuvpnu)tleomfciatfmDrlieo s texr(m iydlptnmivsl( aDuax ono0aee mieiadlmDemu p;(4tlerxr3oatom raueilt texo(mpno1lmtemfcsls aDrr(roou0tpen f3tlt a2uauvon()areoir ootfat  i o s srxr(mpoudlme miesl() rraxroot1aleoio3iysls eanmsnu) rxnio oodfaDe uvils0texo(o3no4aptnmict tfa2ta(  no0optomo3tltlsDrm(mp u0 leomf3tatlmtean i t) rxrxo ou1optelncslt  Dumxmp;u4apxomiciatfa2el(mp;t0areoifcty1op e nes t sexmirpnydol nmnvtls)sruaxrpnu1altnmfctysfaDrln p;u4aexoxr3tatlmt livol(0 2tmim3oo4amte fes tfarumu  oo4olxomoeiydfs eau o t) ltnmf3io1oatelnvo;() exoir ny4lmtnlivt sfarum(rpnu0tle iieilt m raump t4aeenio oa1opDelnes;t0trtrir iudam   ncs s) rta(m ;u1alto i3iatfm2um( p;u4aetomf3todfpDeaieolt0 rtmim nu4lmtemfetlsf ruaum ;t0tex ii3ildlmDra( p;u0 ltrmo3ootoate neol( seuoxr oo4ll e ncslt)srra(  oo1alenio3tas a emumpnu0trxnxfctotopD  iei s  eurir ou1llen icsl()sDtax p;t4tlt  fetltlaDum(vsn()tltrircio1op eauvo s0s2xmxopiodal nmiet t a2rrur oo0tlxnmiciltlaDemn sn()alerxf iy1lmDelues (0teuriopio1al n iviasf Dtrxroot4teto ieilt mDuan o;u)tlxnmr oatop rln ils)texm(r3io4ope mneia(faDtmxrp;o0alt mfctatls uaums;t4trermo3oytfa rau s;t texoio3iy1lmtemnci sfs2trurpno1apt  f3iydfsDuauvs;(4tlxrmocootfaD lnvi s setrio3iodlp nmfvsa()s2tr(m oo0tetomiciasfa elnms t)texomrciytoatr nes s)t2xmxrpoo1lpenmivt (faDtr(r ot1alxo ieildfmDulums;t)tlxnxrciodlp eai s;()t2tmirpiu1lle micias  rur(ronu0aptoiiciaslsDuauvs;t4 lxnxf tytlatr neo;s)teurxo nu1amen neiat) Draur ou0oee if3tatfsDeauvsnu4tltnxr iy1laDrluvsl(  2tmxmpiu4aptn feiasf ruru p;u0opxoio3ilsls emnms u0texnif3oo1lmD lnes t trumxo oydopenlfesl(fa2tmx pou0aexomoctydfm2ean pnt4 eerxr3iydoate ies t)s2toio ny4apen fcta(f Duaumonu1oee miciysfaDulump (0arenxo iatfaDelnvslt tetmirpiydlm nmnviltfsDrmumpno1apeo i3tltlm2uanvs;(4 renmf oytfat  i ols) 2xriopoodalee nei t  Drmur nu4apeoioeiysfm eluvo;t4 etoxo tadop eauvo;(  rumxopiy1ap e fvsat  rraurpot0apen o3tldla rlumo t0arxrxr3oatfm r ivo;s)s2toiopiudamenlfeiltfsrtrxrpot1tpeoiociltls raumpn(4tltomr iodoat aivs;t srto(mpou4omtnmnvtas)a2taxr ot4opxnif3iatfa2raump (4arxnif ta1fmD  nei ( seto(o3oy4apt  net s)s2ua(r no0tee io3tys m2eanvo ()arenxo3oadla rlneols0tetrxr3ny4lpte nvsat a2tm(mpot1tptoiieiasls rlump;u4 reomrcto1fmDrln i;t)tetoimpiodlmeemieias) 2ta(ronu4oexomoetatlm2el(mo t)trenir3oa1opteaivils) 2xmxr3iy1lp nlfesasf 2uaumpou0aet  f3tydla ua(vpnu4tltoircta1fa rln s;t) eumxm iydap elnvia(f Dtmu p;t0apxo i3iydlm eanvp;(0alerxr3iodoateaiei t)sruoxr oodame mncsatfs2uaxmo;u0tlxomi3iys m eau sn() lxnif3iotopDeauesls) exmio oo4lpe  fvi sfsDuax o;u0tpe mieiadfa ua(mo t) rtrxf iatomte i i t  exo(o oy4opeelneils sDraxmp;t1tpx iociadfa2umn o;()aeerxf iydfa raieol(  rxo(m3ou4al emnesls  2trur oo1oetnmi3tldla2ulumo u4texnxr3to1lmDelivsl(0 rumxo3iydlle miesa(fsDraurp;t0tpxnii3ildfa eau o u) etrmo oadfm  lnvs;( sruoir nodll nmieilt)sruaumonu0alxoioctlsls ul(vs;t0tleoifctotom  aivsl( seurim nu4oltnlfesasf Drr( oot4optnio3ild s2umnms (4tlxoif3oa1fat  i olt0tetrxmpiydlm emfetltf 2tr(mpnt4olxomieiadfs2ra(mp;t4tetnifciydlptrln s (0t2xmxr3iy1lmtnlieta(  Dtr( p;u1texn octasfs uanvp;t4tlxnif3tadfa eln sls0 euo(o3io1ap   nct sfsrrmx onu1opeomietatfs2eanms;t4arxoxocootfat  ies;(  2urimpoodlp elfviatf rta(m ;o1aptnifciysfm ea( p u0aeermocia1fa  au s (0 etr(o ou1al e fci (farraum nt0tleoiocildfa ul(mo;(0tlenxfciydomt  nvo;(0 rumim oy4lmt  ncta() Durxm ;t0ale io3iltls2em(ms;u) leoxr3oytfmtrau i;s0 exr(o iydoleemfvt t srta(m ;u1ope mfetydfaDuaumo (0aexnmo3oo1fpD  n s s)s2xo(o iy1ap   feslsfsDra( o;t0tpenmfetas s ra(ms u4 lerxf iodop elu slt0 euoir3io1amtelnvil() 2um(r ou1texnio3iyd m2raumo t0aeeoxf3oa1fa r u s s  etmir ny4ll emnvilt  rum(  nt0ape iicildfa el( ont) etoxr3tytoa  lies t)s2xm(r nodol n netatf rtaxrpno1aleomfeils s2ul( s t0tetrmf3ootfmDeau ils  exmio ny4lpte fvsa( arta(m ou0oexo i3iatlm2em( o t4tlxnir oadlmDrliesls)s2trxr oy4op elfei ( s2ua(rp;o0apx ifetls mDel(mo;()altoxo3iydfmDr ueil( texm(opiu4amte fes tf rrruroou0tpeo f3iadfaDranmp;t0trtrmf3iy1omteli ilt)srtmirpoodapeelicsas) 2rrumoot1apt moeiyd a2el( p t0 lxnir oodomt  uei (0 eurxopno4optn nvilt s2tmurpnt1apeoiictldlaDrmumo;(4 rtnxo3ty1fat lnei s0t2tmiopoo1ap e fes s  rrrx poo0aeeo feiasfsDelnmo (4tlermfcoydomt anvi;s)teurxrpiodll nmfvs s)sruaxroot1altnmf3tydfmDul(mo t)tlxomf3oa1om  an s;t0 2tr(mpiu4ape mfcsls srumu pnu0tltn ocild m rmump;(4aetoxf3iodlmDrlu o s) 2xmio iy1aptemfeiat)aDta(moou4tlxo o3tydls emump t4 ltrmo tydlmDrai olt0teuoirpny1am nmiciltfarurump;o1tleo i3tyd aDemnmon(0trerir todla e i ilt t2xrim oydllt  ieil(f rrmum nu4alxnmieilt m eau o t) rxrxf oy1faD au il()t2xm(m io1apt  nvsatfsrrau  no1ape mo3tatlmDuaumonu)tlxoio ootlp  aivi;t  rurim3iudome lfci t)arta(rooo1oetn ociys a ra(mo u4alermr tatop   uvs;(0 etrxm3oudomee ivs sfsDtrum ;u1tetn oeiysfa2rl( pn(0trxrmf3iadop raneolt tetoxopio1omtn iei s)sruauro;o4oltn ieilslm uluvo (4altrifcootlaDrluei t)trxo(mpoo1aleelfvt s)s2ra(mpnt1aleoio3tltla emnvont4 exoifciy1opD lnes;s) ruoxm3nydlle lnct (fs2taurooo0tpe ifciytla ranvp ()tltnio3iydoa ranvo;( seur(m ny4aptn netls)sDtm(mo;o4olt iocild a rau s;() lxnxo3to1lmt lu o;t  etrxr iy4oleeliet sfarumuront4oltn i3iaslm2eau on(0tlermf iodfmDr i s;( seurir ny4op   nctlt)srtru  nu1olxomoctas s ulnvp u) renif3ootlmDraivsl( texrxo nudope mivsl(fartrxmp;u0aee mfcild m ranvsn()trtoxf3tytlmDeaivs (0teum(r3nydal  mncilt) Dtaxrpoo0opxo fctld s eau pn()tlermocia1oate ieil(0setmxo3io1ll  mictat aDtrxm no4optniiciysla rl(mp t4texoxf3oadfaD  n i;t)srxo(r3ou4oltemnvt (faDuru p;u1tpeo o3tytlaDul( s t4tlxnirciatlat  n i;t truoxm3nudamt  ivt t)s2ua(r no0opeoiiciytfsDuanvs;u)texriocoodfaDeliei s setmxo3nudoptnmnctasf rraxr nu4ope ifeias a2rluvonu0tlxrxo to1fptraiei s trurio iydalen iet tfsDtmu  ou1oet mieiatlm2um(vo t4 exoxo ootfaDrai sls seumxm3no4ope mieias)arrauro;t4tptoiociad s emuvo u)altnmr io1om eluvslt0 2xr(opiudlmtemivsl(faDuaxmo;o4olxnmo3iasfmDuan s u)teenir oo1fpD ai o t0srto(rpoo1ale lfeslsfa2tm(mooo0aeto icildlm ul( onu0 etomr3oa1oaD auvs;()sexoirpoydomen ieslt) Dumumoou1tpeoioeiatls um(vp;t4trxnxfciytfp e u ols  ruoim iodol   fci t  rur(mpou0olen o3ilsfs rluvont)alermo3iy1faDr ieol() rtm(r3iy4am emnctl()sDtmx  ;u1olxomi3iydfmDulumo;(4texomocoo1fp elueo;() 2tmim no4alt lncs t sDtmxm no4oetn icilslm emumsn(0 rerxo3iytlat  u s t setoxm3ny4lm nlnes t)s2uax ooo0oexomoetad mDel( s;t0 exrxo tadoa raneo t s2to(r3iydll  mici tfsrururp;u4aetomicils mDrluvs (0aetrmr3iodlpt an o;()srumir ou1omeemnct ()a2trxmp;o4optn iciadls2umn s u4teenifciadfmte nes s  2xmxo3io1al e ncils)a2rmuro;u0tptoioeild m el(mp (0tlenmr iodopDranvslt s2tm(mpiodameelfei s)sDumxmono1oexo ociadfm el(vs;()texrxr totomt li o;(0setoim3nydlp n iesl()s2rmuronu4tpe  f3tasfs ra( snt) ltnmf3iotoa rln sls)setr(opoo1om  lncsl() 2taumpnu1tpenmfctlsfs rluvo;(0tetrmf tatlmD  u sl()srtrxr nodam nmiet (fsDua(m ;o1aex mieiadfaDrl(vpn()tetomfciy1fm e ivi;t)s2uoir3iu4ap  mnvtas)arraxroot4aex  f3iydlm ranmo u4aeenxr iytlmtranvol( trxm(o3oo1omt mnviasfs2trx pot4opt ioeiltfa2ran o;t) eenmrcoa1om eaieil( seuoxo no1altnlfvias aruru ont4tpxn ieiadfa ua(mo;u)tetnmoctatla raues () eto(m3nudlp e nct (fa2ra(  oo1tetomo3tasfs2rlnmo;t)trxoxfciatoaD lnes ()texmxr3iy4llt mnviatfsDur(  oo0oexnioctatfs2ua( o;u4 rxrxf totlaD lueils0 2xm(o ou4lle lics s)srtmx o;u1aexn i3iytfsDranms ()aetoxr oo1omDe n o;(0trto(opio4oleemnvtas  2umurpou0alxn feildla rl(mp;()teerxf3to1fpteauvilt)t2tmxr3iydllt  ivt ()s2um(monu4opx  feiatlm uau o (4aexoxfctodomtraieol(0teum(opiu4lpt mnetltf Dtaxronu0tee  o3iltlaDem(ms;t4 lxrif oytfat anvi ()srum(r ny4lp  lfvtlsfa2rr( o;o4aptomoetaslmDra( s;t0aetrif tadoaD au s;t srtrxm nodopt  ncias)aDum(mooo4apt mi3ils m2ea( s (4arerxrciodopDrau s s srxm(o oo1olte neiasf rrmxr ;o1tpxniictyslsDem( p;t4altrif iy1lmDeauei;s)t2uoim3ou1om n ivta( arrmx poo1oeeniieilsla2ua(vp u) rerxfctytlaDr uvol()t2xoxmpiy4aptelietas  2taurpou1tpenii3iadfs rl( p;u)alxnir oadfateauvils0teto(r3no4ll  mfei tfa2ua(moou1tltn fcildls2ea( o u4aetnifcoodfm r uei ()texoxo3iodol e fcsls) Dur(m nu0tptoif3tydlm2ua(vp;u)tlerir3tadom r uesl(0t2uriopiu4op n neslt)aDra(r no4alt io3tldfa2ul(ms;() lxomo iotla eluvo s0 2uoir io1lmtnlfei sfa2ta(  ou1oee iieiydfmDeaums u) rerxo oytlp rlu slt0setmiopno4om elnet t  rrrurpno4alx miciat m raumpn(0alxoxo to1fmtrauvo t)s2umiopoodlmtnlncsa( aDtr(mono0opt ifciltfs raump t)artnir3ootoptrlivo;t trtmxm3ou4op emivil( aDur(mp;t4ale mictyslm2rlnmo;u)trxrxocoytfmDe i sls)trtoxm3no4ap emivtl(farumurpoo1tpe io3tydlsDrauvpnt4 rtoir iadlaDrluvo;s0sruoir nu1alenmfct t)arrmxmp;u1tlto o3iltfmDrmnvp ()tlxrmrcto1fp   i i;t0trum(o3io1olt mnciat arumu p;o1tleo ociad aDrau snt) exoir ta1fpDrlivo (  ruoxrpiudole mfcslsfs2ua( pot4oexomfciatlaDrm(mon(4texnirctadlaD auvi t)truoio3io1lpe miet tf Dumxmoou0altoio3tlt aDuluvp;u)aexoio3oydoate i i s sexmxopoo4amtnmict (  rtm(mooo1aeenmoctltla ea(vont4tltnxr iotlmD lneo (0 exo(r3oo1ape  fctl()a2rrum oo0opx  i3tyt mDeanmpn(4teeomr oadfpt auvilt  rtrxm oo4lle mfvil(  Draur ou1oeenmoeiltfs ua( s u4teermr3iydfat  n o;()trxo(opio1lptemnei t) Duaxrpoo1oee ifcild sDum( s;u0 rtoiociytoateanvslt sexo(o oy1ap  mieil() rtrumont1opeoii3iysfa rmn p;()trermfctotlpt aieols0 2umxm iudome livtls  rtmx pno0opeomfciyt s rm(vsnu4arenmfcoodfate neo s)t2um(mpiodomtnmiesat)srtax p;u1aleniietas aDrauvp (0aexnmo iadfp  ln ils) 2urim3oy1ole mncta()sDrm(mpou1tleoiiciyslm elumo t0tetomrciodomte ueilt s2urxr3iy4om n fvia()artrurp;u0openmocilsfsDem(mo;t4texrmrcty1oa rlies s0t2trio3no1lpe  fviat aDtm(r oo4tpx  i3tlsfs elu o u) exoxf ootlptrlnvi;s0 2uoim3ny1am emfctas  Drr( oot1tlt moeiyt m uauvs;(0teermrctatomte nvo ()seuoxopoy1om e fes s  Dtru p;t0optomieiatla2rlnvo;()alenmf3oydlp r iei t)srxrim3iodlmt  fes t) rtaurooo4aetoif3ild mDrmnmp (0trerif oydoaD  n ilt) rumxo nodoltnlivs s a2urx ono4optnmi3taslsDel(vo t4 rtriocio1omtr uvi;()t2xm(r3iu4op   icsas) Dua(  nu0opx mfeiat sDumnvp t) etnmr tydfate neslt)trurxo3iydamenlietlt  Drru poo4oltn f3tysls eau s u4alxomrcto1laDeln o s) rum(m oodomenmivi sfarrm(r ;u4tlt mo3tysfmDelu s u4alxnmf iotfatrauvo;(0s2tr(mpnu1op n nesat a2uaxmpoo4tpxnmoctadls ulnmp;t4 rtnxf io1late nvils)t2to(r3nu1lm  mfvi tf 2ur(m oo0texoif3ildfaDuaumsn() renmr3oadlaDe ivi ()s2umxr3iodop   ictasf Drau p;o4tet iocias m emnvo u)aetomf3ta1optrlnes t)seumxm iudal emnet (  Dta(rpou1oleoif3iasfm ran o t4altomf3tytlaDr nvol( trxrxr3ny1amee ics s srta(  ou0tpenmi3tatlmDem(msnt0tlxrxfcoadfatelnvols s2xrxm3no1lp nlfvsas)aDrrx o;t0ale  f3tlsfsDrmumo t) rxoxr oa1lpte n o t) 2tmxr3ou1om n fvi (  Dtm(r ;t4tltn o3tat a ra( s;t4 rtrmf3iatfaDelu ils0s2toxo oo4alenlict t sDtauro;t1oleomoetlt a2rlnvo u0tlxrir tadlp e i o;(0s2xrir3nudolenlfctlt  Drrum ot1olt mf3iysfa uln onu0 exoxf3iy1lmt li i (0srtmio3nodol nlfet sfartm(r ot4apt io3ias a2rmumo t)trxnmo oytlm eaues;t0tetr(mpoo1amtnlfvtat) 2uaurpno0oex ioeiadfm2emnvpn(0alxrmo3ia1faDr n s;()t2umimpiy1altemicias) Dtmumonu0apt  oeilsla el(vp;u4teenmo3iy1fp eai s s  2tr(opoodal emfeiasf 2tm(rooo0opxn fcilsla2emnmont)tltomr3iy1lmDeln i;()t2xr(mpnu4lmt  ietat) 2uaum nu1tpxnmfcilsfm2um(vont)trtomo3todlatrau il(0trumxm3iy4optemnvtl()artaum nu0olxo ocildfa uanmpn()trxoifctatfpte uvo t0srxr(o ou1olt  iei s aDrm(r ou0opxn fctldfs2raumsnu0aetrxfciatlpDeaiei t) rurir3oy1lmtelnciatfsrua( pot0tlen ietldfa2ea( p t)alxrio oatoa e neols tetoimpoydoptnmfeilt)a2rr(mono4texo ociyt aDean p t4tltnxr3iytlm rauvo;t s2xm(m3nu4lpte nviasf rur(r no1tet ioeiatfs emnvp u0trtnxociydlp  aies s trxoxmpnudaleemiesat) rum(rpoo0ope ioeiad s2em(vo;u0tleoiocoa1oaD  u s ()texm(m iy4ape lfetlt aDraxmont4oexoifciydfa ranvpnu0aexoio oatlaD aneo;(  euo(o no4ap e fcs t a2ururo;t4oee  i3tasfm2umuvont4tlxrmfcootlpDr n i;( s2xmimpiudllt mnes ()sDraur nt1tlt mf3ildfaDrau s;u) lxnxrctodlm r n i (0sexriopny4op n nvi () 2rr(  nu4olt  feilslaDulnmp t4tlxnif todlmteln olt0t2urirpoo4llenlfvsa( aDrrum nt0aeeoif3iasfaDrl( s;u) rxomr oatlatrai ils trum(o ou1al elfvilt  2rax pno0olenmo3tldlaDelnmpnt)tlenir3iotfa   nvs;() ruo(rpny4ll nlnvt (farurum ;t4oee if3taslaDul(mpnt) ltoxr3oy1fptrluvo t) rxoio3iu4om nlfeta(fsrtmu ono1tlto oetatfm uan s;u)artomf3ta1fmDeaieo (0trtrxo iy1lmee ivilsf rtrxmo;u0oee iieildfs rln onu)altnif3iy1lpDran s t0 rtoio3ou4lpe mnvta( aDrmum ot1ape mi3taslm umn s;u0alxoxr ty1lat aiei;s sexrxo ny4olenlnciatf 2urum ;u4apeoioetas mDemuvsn()tlenio3oo1lp  au sl() rxmiopou4al n fvils s2trxrpnu1opxniietyd a ulnmpn(0arxrir3iytopDe uesls0 exmimpoudapenliviltfaDrau  nt0olx mociatlaDean p t4texoxf iy1fmteau s t0srtm(m ou4al nliet t  Dtr(mpnt4aleo oeiatfmDeaums;u4 renxr tytfptelues ()tetoio oy1olte feiasf rtmur oo1aee miciat sDumnmpnt4texrircoadlmtrlieil() etoxrpiydamenmfvils arumu pno4apen i3tysla rau p t4 eerircootlaDranvs t0s2tmxopoo4al e feiat)sDta(ro;o1oltomieiatfs ulnvp t)tetrio io1fp eauvi;s) eto(o3no4ameelfviltfsDrm(  no4tex  fetatfmDeanmon()arxrxr oy1lat  n ol(0 exmxm3iudlp  mivi s aDtaxm nt1aleo o3tad aDulu pnu0tetrxr3iy1om  ln i;t0sexrxm oo4lmtnmncsls sDrrurpno0aee mf3ias s umnmp ()aeeoio iatomDraueol(0trxrxr no1ol nlneiatf 2rm(  oo0aptoifciysla2ranmpnu4 eenxr oydla rauvs t0 rtm(r no1lmt lncia(f 2umxmpou1alxn ieiat m rmu p;(0artoxr iotlptean i (  rumxm nu4ol nmicta(fsDrrxrooo1tlxoiocildlsDeln o;u) ltomr tatoa  ai o;t)texmxopnydoleeliviatf Drr( onu0olxo oetlt m em(mo;()tlxrxfciytlmtrlieol()trtmxm3iu4olenmnctat sDtau  oo4texomf3iadfs eanvo u0areomf3tytla   uesls trtoim oo1al   nvs t  rrm( pno0olxoifeiatfs eauvs;(0 exoxr3ootoateau i;t)teurxo nydamtnmfctatfs2taumpno0aleniieiltfm rluvs (0 etoiocoo1op rlnvolt)srumxopiu1om nlivtlt) rtmurp;o0apxo ietydfm2ua(monu0 rxoio ta1fa e ieols0 2tm(o3iy1lp nlnctl(fsDrax pou1oee io3iltls em(vo;u4 lxrmf3iy1laDr n sl()seto(m nudlp  micilt sDua(r ;t1aleoifciasfs2rauvs;t4tleoir3oodlatr ieil(0sexrxr iu4amt mfcsatfsrtmu p;u1alenmo3ild a2umuvsnu) rxnmo3iadlp elieo;(0tetr(o3io1lpt lnvta() rtmx  ;o1teenifeiltfmDeanvs t0artoxrcto1lat ai sls0 rtmxo3oodlle  icta(  rrm(m nu4aeeomoeiat a2ul(vo;u)tleoiocoodlmDe n s (0s2xoxr oo1ap emnetas) Drrum no4opxomocilsla2rmnmsn() ltrifciytlat aueslt tetoxo3no1lpenlneiltf rumu pot1optnmo3iytla ul(vp u)aexomr3ootlmDean il( t2um(rpiu4llen nctlt sDuax  ou1tptoif3iysfaDelumsn(4aetnmo3oo1lp   nes s0 2xmir3iudllt mieslt  ruau  no4texn oetlslmDrlumsn(0 ltoxf3to1oaD luvs s0 2urir3oudapt lici ( a2ta(rpoo4oltnmociatlm2ran snt0aeeoxfciydoaD an ols0srxo(o oy1aptemfcil() rrauro;u1oexomi3ildfa2elnvpn(0aexoirciodla  lnes;()trto(opnu1olee fcsa( arrm(m ou4teenif3iys a2ulnvpnu) lenxf iadlmD  nesls0tetrxo iu4omenmfei ( s2ra(rono4tpe iiciltlsDulu o;t4trtnxf3io1lp eln s ( truo(rpno1lmeelnvt t srrax onu1olx mictltfm el( o;t0texnxocoytom   u s;s trumim oy1alee netlt aDrau p;u1aet iocildfs2ra( s;u4altomf oydfateluvi;t0texm(o3ny1aptemiviat arrrurpnu0ale  ictyslm2elumpnu)trenif3oydfp   u s s trtoir3ny1altn fet tf rtmum ot4texnmoeiaslsDelu s t0aexrifcoydoaDelnvo;s0t2umimpiy1ome mfeia( a2raumono0aexnifctytfmDuanvonu0aetnirciodop  anes;(0srtmim3nu1lpenmiei sfa2ta(rp;o4tpx ioeiyd m uanmont)tltnmr3ta1lm  au o;s  2trxm3iodomtelnvil()s2umx poo1apeomo3tatfa uau onu4tlxoxo3iydlaD livs;()teur(r3iodamtnmnetl( a2taxm ot1oex io3tytlm2rlu s;(0artrio ty1lp e i s;t0 ruo(rpiu1aptemfeiltfs2ta(m nt0ope ioetytfm2rln o;t) rtoxr3tytlmt aivo t0 2um(m3ny1omtemicta(  Dtrxro;o0aeto f3tat aDrm(msnt0aeenxf3io1op elu i () exm(r3ny4ap emfes sf 2tm(  no4tpen ociydfm2uan o ()alerif ty1laD  u o;t)t2ur(o oo4ll elfeta(faDta(root4tltoiocilsfmDelumsnu)aexnxf tatlmtr uvo s)trtoxm3ny4ap nmncias) 2rm(rpou1tle  iciys a umu o t) leoircoadlmDeaneol( setoimpnydlltnmfeil() Dtr(rpou1olen oetltls emuvo;(0 etrir3oydfp eaies t  euo(opiydop elivtat sDtmumo;o0tltnmictldfa ea(mpnt) lerir3ootomD  ies s0t2xoxr ny4lm nmnetat  2ra(mont1olxnioctat m um( o;(4arxnio3iotoateliesl() 2tm(m iydomt mfvta( aDurum ;o1aet ifeiysfa ua(vp;t0tleoxr3iatlate nes;t)t2xrxr iodoleelfeil(f rum(mpoo4aeen oeiad m rmn onu)trenio oydfp rlnvo s)srxrxo3ou4am   fes t sDrax  nt0oet io3iytfaDul( on(0tetoxf3to1fm   nvolt) 2xoirpoy1alen ics ( arurx ont1teeoifeiyd s2rau p;(4aexoif totfat au i;(0t2xmxmpno1al  mnetatfartrxrp;t4ale mociys s rlumo t) renmoctytoa rln sls trur(opnu4lme mfvil(fs2rmumpou4opto i3iasfsDuau p;t4alxrmr3oy1fmDrlu il( s2xmim3iy1omtemnvt t)arrmur oo4tex mf3ilslsDran o;t0altrmoctytoaD  u i;t s2xo(m3iu4am nmnctl(f Durxm ;u1oex io3iyt s ua( pnu0tetnxf ia1fpDrlues;s0sexo(mpiydlpe  fcias) rtr( p;o0apeoio3ildfaDrmnvs;() exnmf oa1oaD  ivo;() rtoxo3nudalt mfcs (  2trxmono1alxnii3iad m el( on(4 ltrmo oytfmtean i;t)trtmxo3oy1opeelfes sf Drrx pnt1tpxn octld mDeluvon(0teerir totfpDrli i (0 rxoim oudom n fvsls)aDrm( o;u4apxnif3ildla ra(msnt4texoxf3totlmDe u sls0tetmxr iudlp  lnvsat)a2rr(r ot0oleniociyd a2uan pnu) lxoiocoatla  li s;( s2xo(o nu1lmtnmivi tf rrrxrpou4teenmoctldla ulump ()aleriocoytomD ln i;s t2tmxopnydomeemictasfsDum(rp;t4aet  ociys a2ra(vo u4 rtoir iadfptraieilt0 2tmxo iu4al nlfctl(fsDuaxr ;u1aex  fciydlmDrlums (4 rxoxr ty1oaDr uesl(0 rurxo3iudllen icil( aDrr(mpnu4tetnmi3iaslsDemnvs;(0 ltomf3to1oat  i s t trtoxr3io1apt lictat aruaxrpou0aeen i3iydfs ul(vpn() lxomociotoaDe nvs;s)srtoxopno4lm   iciat) 2umxro;u4aetoioeiyslmDum(mp;t4 renmr iydopDeli sl()srtrim oo4lptnmfcsasfsrrmx  ou4alxniociat aDeauvs u)teenmrciadop rauvi;s)trtm(o3iodamt mncia(  2trxroot0alxniicilt mDum(vpnt0treomr3oo1op   nei;()s2uoim3ny1alenlfvtlt) 2tm(roou0alxnmo3tydlmDeanvp (4tltomo3tytfa e ivs s0teuo(r3iydamen fcs s a2ur( ont1apxomo3iydlaDeanmo;(4 lxrmr3iy1fa eln s;s)trxm(r3io1ol nlnctls s2rm(rono0ole ifciyt sDuln o u)tlxnmo tatfmt ln i;s s2umim oudapeemncsl(fsrrr( oou1tltn i3iysla rmumo (4arermfcoatlmD  ues;(0teum(m3io4lm n ictlt aDtrxm ot1alxomfcildfm2rln o t4 lxnmo3oodlmtr ues (0srtrxr3iydlm  lfctas)sDur(r ;u4tee ifciys a2ra( p u)tetnir3iydomt aies t0texrxmpnodap  lieta( sDtr( ono4tleomf3iysfa2uauvs (0 lxrmf3oodfpDeaivi;( t2urirpio1lpenmfei sf rururpnu4opx mi3tltlaDrl(msnu4trxomociotomD luvo;t) etm(opoodalenmivt s) rur(r nu0olx ioeiytfa2em(msnt0tetrif ta1fm e n o;t  rtrxm3oo4lmen feia(  2trxmpoo4ale  icild s rau snu) rxrmr3tatom elivo;s) euoxr iydlmtnmictat  rtrxro;t1tlt  fciasls2ra(von()aetrir3oatfatrai s s0 2um(m oodomt  feil()a2urxr nt1alen i3iydfsDumumo (4tetrmfcoodom e nvsls)srto(o3oodaptemfet (  Dtm( poo4tlxn f3iad m um( p (0aexnxrcoadfpD auei;t0 2uo(rpoy4omtnmfei (faDumuro;t4aleo ociad mDem(vp;u0treomocoo1omDe u sl(  etoxrpnydame lnvsl(fs2rrxmo;o4olx  f3iys mDea(msn(0 etnxf3oytfatelneol( s2tr(o3oy1op nlnviltfaruaxr nu4opxnioeias mDrm(vp;t4tltrxr3ia1omD lueo s)t2uoxr3nu4op   feil() rrm(rp;o0apt moetytlm rauvp u) lxoxo3ia1lpt aueslt) rtoio3iydlle mnviat)arta(mono1opxoiiciys aDel( p;t0 ltoif iodoa  au s;t tetmir3nu1olenlfesa(f ruau p;t0aleo fciyd a ulnmo u) rxoio todfmD luvil( srur(rpnu1apt mnvilsfarrmxro;u0oexomociyslsDelumon(0trtrioctodlmteli s ( t2xrxo oo1oltelictasf 2umxrpoo4oleoif3ils a2ulumpn(0tlxoxo3iatfm rauvsl( trurir ny1apeemnei s  rumumpno4apenmi3tldfs2em( o t) etnxr oydopteanvi;s0sexmio oo1apen nvslsfa2umu pnt1tlx mf3tyt s uau p;(0 etnxr oy1lpDe nvo;(  2tmxopoo1amte fvslt srum(mpou4tlx  ieiydfs2uluvon(0tleoxo3iodlpD  uvils)setmxrpoy1lptnmfcsa() Draxrpnt4oetoioctytls2elnvo t) eenxr oodopDrlivi;()sexo(opiu1alen fcil( sruaumoou4opt if3iys s uau s ()tetoio tatoaD aneil() rtriopiydomenlivs ( srtmx ono1tleoifeiatlmDuauvp t4aetnmfctadfpteluesl()srum(m3nu1llt mivtas)arumur no4openii3iytls2rluvp;()texoiociy1fatrlu i t truo(m oydol nlncs t) Dra(rpnu1opt mi3iyt a rl(vp u0tlxomo oodfpt  u ilt teur(r iu4omeeliei sf rur(  ot4aetniieild m2uanvp t0 lxnmr ta1fat li sls srtmxo3oy1am e nesa()aDrr(rp;o4texn i3iys m2uluvo t4 etnxf3iytfa eau o;()trtriopiodapeemfvias)arrmxmono0alxnif3iatfm elumo (0 rtnxr3oadfp e uvslt)srur(mpiu4amt mfvils)s2rruro;o0apeoif3iadfm2el( s;t0trenxr oydoat  ueols0s2uo(m3nu1op nmivslt  2trx ono1teeomf3iadlsDem(vont0altoxo3tydlm  auvs t)s2uoxrpoodoltelfci s aDtrumoot4tpxo fetysfmDulu o;t) rtoif io1laD aueo t0srtrxmpiy1amtemnetat srrau  oo0apenmociltfa2umnvpnt4tltomo oytfmDr nvol(0srxrim3iy4olee fvil(  2trx  nu4oetn oeild s2ran o;t0texrxr iytfmtelies (0 2ur(m3nudol elicta( sDuau oou0tltnmf3tldlm ulumo;(4 lenxrcia1latranvil(0t2xo(m3no1ll  lnetls) 2tmxm ;t4ale  iciltfm2ran p;() rxrmfciydlm rai il()seumxo3oudolt mnvilt  2rrxroot0teenmoetldls2emump (4tltoxr ta1oa eaiei;s0t2xmxm3iy1op nmfcsl(fs2umu o;o0oexn f3iad m2ea(mp u0 etrmocoodla r uvs t) rxoxr no4olenmnvtl(farrrxmpnu0aleo fciydfsDeauvsnt4aetnioctatfa  livi (0 2xoir nodaptn iesas)aDra(  oo4tlt  ocildfa el(mp t4 renxoctytopDrlneil(0s2to(m nu4apt lnvilt  rrrx  ;u4tpeo iciatls2uluvsn(0 exnxrcootfmt luvo;s)t2xrxo nodlmtn fesls  2tmxront4oetomictasla2ra( o u0 leoxr iatoa  aueolt)sexr(o3no1llt lictat) 2trumpnt1aleomietad a2ua(ms t0 rxnxociodlm   nvolt texmio3oy4amenmfct ( artrxronu0olto f3ildls2ra( o (4 exnmo3ootop raieo s srxmxopiu1amtelfeia(fsrrmu o;t0aee mi3tlt aDean pnt4tetrmrciodlpDeanvil(0 rxrio3no1op  mnetl() Dtmum ;u1teenmfciadfa rlumsn(0alerxo iodop eluei s)trumio3nudamtn nei ()srrru p;t0apxo fciydls2uan p u)trerio oadopDeaueols setrim oydlm elncia( sDtr(ro;o0opxn icias s2elnvp;u0 etnxf iytom   ivil(0sruoxr3nu1lle lnvs () Dtau ooo0opx moetadfa2ua( p (0 rtrmf3ootfpD an slt0 ruriopou1op   nvsl()s2tru ont4aexomieiltfs2rm( p;u)alxnxf todfatrauvolt0t2um(r3oy4ll  licsas srrm(rpou1texnmfciytfs2ulumon(4tlerxocto1fp   n ols) etr(opoy1ol n icta(fs2uaxmpou1olxoioetlt a eln o;(4 rxnxr3iatfm rlnvi;(  rurio3oudape mfci s)srur(rpot1tpeoifeildlaDumnvp t0aetnio oodfpt  uvo;s) 2tm(r oo4alt micta(faDuau onu0ale  i3tlt a2ea( snt) eenmr io1opDe i i;s0seur(r iydam emicsa( aDrrxmpnt1openiictltfa um( p u)aeerif3oytopt li o t0srto(m3iu4al   ivs sfaDurxmoot4ale if3tad mDuaumo;u) eerif iadopte ivs s0sexmim3iudlm nlnctl( aDtm(mo;o1apx  o3iydla em(mp t0texoir3ia1lat  iei;( srxrir3nu4altnmnesat srrr(  ;t4ape  feiasls2el( o;t0aexnio3iatom  liesls0t2xm(o3oo4openmfesl(f Dua(m ou0opt io3iasfm2umu s;()aetrmo3totopD  ueol(0 2uo(o nodope  fvtl(f Dta(rp;u4tpenio3iatla2emnmp u) rerio3tytopteauei;()t2uo(m iy1openmivi tf Dumu  nu1tee mociatlaDra(vs;u4tlxnxr3oytlpDr nvi;() eumiopoy4lmeemfesat aDtau p;u1oleo f3iasla rlumpnt0aetnxoctatlp   n i ( texoxopiydll elfetat) Drmxm ;o4alx mo3tlt s2uanvon(0 eeoxo oa1fptrlu o;(  rur(r3ou1ole lfvtat)a2rrumooo1alx  ieiatfs emnvonu0trtrxrciodfpD lnvol( trtmxopiy1op nlivia(f Dtm(ro;o4aexnif3iytla rmnvp t)teeomrcta1lmDe ies;t srxoxmpnu1llee nesatfs2ua(mono1aeenioeiadfa rmnmp;u4aexrmo3iydomDe iei t0t2urxo iu4lmeemfctat arrrxrpno0tlxomoeiytfmDrau sn()aetnifciy1lptrli i () rtmio no4amenlncsasfsrrrx p;o1aetomf3ildlm ra(mp;t4 exoxrcoytlmD aues t)sexoxopoydlpt lneil()aDtmurp;o4aee mfeias aDeanvp;u4 eenxf ootoaDrli s;( t2toim io1amenmnvsa()a2tm( o;t4aptoio3iys sDumnvsn()altnxo oy1op elueilt setrimpoudap nlnesl() 2taxm ;t4apxnmo3tas a uanmp;(0 ltrxf ootfa  anvi t)trtriopoydlpe lietlt)sDrrumpou0oex mfctas m um( p;(4tltoif iytfmtr i o (  rtmirpno4omen ncta(fsDrr(rp;t0oeeniieiydfs em(vo;()tltoir tadfmD  n slt0s2trxr3io1omtnlfcsas a2ta(mpoo1opt moeildls2rlnvp;(0teermocoydlpteaivi ( srtmxm oodamtemicils) Dtm( ono0tleomieiytfsDra(mp (0tltrxr3oatopDe uesls  2xrxm ny4ol e ieilt)s2tmx  ;o0oltomf3iydfaDuau ont0teermocootop  aivils)trtmxmpnu1open ivil(f Drru pou0altn fctadlaDuluvo;u)texoxocoytlm   nei s0t2to(opoy1amtemict tf 2uaump;t4aeeniietys mDemumo;(4alxnxr3iy1op  au i t) rumxm nydlm elncslt)s2rau  ;o1ape  fctydfs rlnvsnt4tlerio3iodfa   i sls t2tmxm3iu1ll nmfes s a2trumoot4tleoii3ils aDrlumon()trxnif ia1lptran s s0texoim iy4omtnmfvi s sDta(mont0tpenifeiadla ea(ms (4 rxrmfciadlmt anvi;s)t2trxrpoo1ame mnes t srrax  ou1tlx mf3iysfa2emu s;t0teeoxo3iadfmDelies;(  2urxmpnu4opt lnct ( sDraur ;t0optomo3iatfs uln s u0 etomf3io1lm  aiei () exm(m iy4om  lnesl( a2tmxmp;t0tpeniieils s ra(mpn(0tetnmocoo1fptrliei;(0setm(r oy4ope licslsfsDrm(  ou4alenii3tytlmDrluvo;(0trerxf3oy1fm r uvs;()seum(m iu4lmt  ict sfarurumoou4tpto iciadfaDuluvs u)alxnmo3oo1lm eau ol() 2xmxm ou1lpeelnvs (  2trxmoot0texn oeild mDrm(vsn(0 etnmr3iydopD  ivi;s) 2uoxr3ou1lmtelies s) Drmxrono1teeoii3tld a ua(mpnu4tltrxr oatla rauvo (0 rxo(m iu4ap   ivt ( a2tmx  nt0alt ioetat m rln pnu0tlxoif3ta1om rlu ols  ruoim ny1opt  fci (f 2tr(rpnt1oexoio3iytlm uanvo;u4 exnmfctatlmtr u sls)setoxr3ou1lltn fetlt)s2tm(rp;t1oee moctad a2ua(vs;()arxnxfcoydop e u ils0 euo(rpiy1apen fes ()aDtmu pot4tpxniictltfmDrmnvsn()trenif iytfm e ies (  rtmio3oo1omen ictat) rraxrp;u0tlt moeiadfm eauvont) reoxf oa1oatranvo;()s2urxrpnu1al emiciasfa2rmuro;u4oeenmi3tld s ean o (4alerxo3iydlmD  nvs t) eumxm3iu1amtelnvtlt)aDrm(rp;o0oeeomi3iydfmDra(vo t4 rtoir3iydoa e nvo;s t2xoxm3iu1opee nct t) Draumo;t1tex ii3iyd m2rau snt)aleoxf3todoptr uvslt)teto(o3iu4amt  fetat)a2uax  ou0tle  icilsfm2rmnmp ()tlxrircio1omte n o;(0t2to(o nu4lm nmivi s)aDur(  nt4tlt moetatfm2ea(mp;t4 lenmr iotfp e ues;t0srxoiopoo4apeelfvils sDuax  ot0oetn o3ils aDrmnmon()tltnmo tadoaDeanvi;t0sexr(m iudom   feil()srtrxrpnt0texomfetyslmDem(vpnt)tlxrio iydomte uei (0 etoio3nu1lmt mfesat) 2tr( oot1apen f3ilslm em(vsnu0 exrxocio1opD lues s0srxrir3ny1lle  netltfartmxro;t0tlxn i3ildlmDua( p t0aexnif oytfa  lues s0s2um(r3io4olt mnctltfs2rruroou0olenii3ilt a ul(mo u4alenxf ty1la   uvo t)t2uoir3no1lpeelnvt tfa2rr(mpou1tpx mf3iyd s rlnvs;(0tetnir3iytlpDe n il( trxm(o oo1ap   ncs t artm(r nu0ale mfctldfs2umuvo;u0texomoctytfmtr n i t)trxmxo ny4amtelnesas aDtru  ;t0tpx  ocias aDelu pnu4aetomr3oodlatrai o;()t2uoio oudale  nvs s) 2tmxrpot0oet moeiyslsDea( o;(4 rtnir3tydfate ivo;t  eumim3iodale licsls) Dur(mooo4aeto f3iytls2emuvp;t0trxrmr todop rliei;( tetriopiy1ll nmietlt) rum(mpot0tpx mi3iltfa2rauvonu0 lxrxo3oy1omteau il( tetrxmpoo1ol  mnctas  rtau o;t0aex  fcildlm2uluvp u4aexoir iy1latr ueols0texoir3nodlm nmivtl(faDurxmp;u1tltnmfctasla2rl(mo u0tltrmocoytfm elnvi;t srtoirpoudlpee ivsasfa2tauro;o1teeoiociydfa2ua( s;t)alenxfcio1oateaiesl(  rumxr iu1omt  ieil() rum( pnu4openmf3iatfaDumnmp (0tlerxf3iodlmDraivo;s0sexoxr3oo1alte nvs ()arrrxronu4apeomo3tat sDranmp;u) lxrmocoydoa  lneolt) exmiopiy1lltnlivsas aDtrxmpoo1tpenioeilsla raumo u) etnxf3tatomtrluvs;t) exmio nydalenmnctasf 2umurp;o0tpeo octlt m2uanmsnu0tltoiocta1fp e iei;t) euoxo nudomtelneilt) rur(r ot1tetomieildfa rau s () etnmoctytlmtr iei;s trxrxmpnodoptelfcta(f Dur( o;u0tlxomieiltlaDra(vs ()aetoifcoodop  au s;t  rtmimpoydalen ivs s s2urxront1aptn iciaslm2ean snt0tlxrxfcta1latr ies s t2uoxr oodol n icsls)artmumont0tex io3iaslm umnmon()aexnmf tydlpteaueilt0 2umio3oodllt mnvs t) Dtm(  ;t0apx io3iyslmDrm(mpnu)texnmfciydoa e iei s0 rtoxm3iy4op  mfvil()sDrm(mpnu1opxnii3ildlsDem( p t0trxrmoctadfmt lieo;s trum(o iodol nlfes sf 2taxr oo0oexn ieiys m2eanvs;u4 rtrmr3ty1oatrlnei t) eumir3iodlmen ivsat  rrmxm ou1olt mfeiydlm2rmuvp;() etnircoa1omte ueo;() rurxo3iodlltnlfeslt)srtauronu0oetoioetadlaDulnms ()teerxr3to1oatelnvs t  ruoxo3ny1optemiesltfsDtaum nt4alen ietytfm eau p;(0 rtoir3oydomtrau ol(0seur(rpou4am n ivt s srumu o;u1tpeoioetaslaDeaums;(0tetoxo3oatfat anvslt)sexriopnodoptelfetlsf 2rr( pnt0opt  o3iatfa2rmumsn()trxrmf3oatfmtr n i;( sexrio iydop  mnctlt)aDtaxroou1texo f3tys aDulnvsnu4texnio to1lpDraivolt  rxmim oo4lmeelivi s  rra(monu4oltnmocildls2uln p u)aleoxociatfmt livs s)seuoxr iy4ale mnes sfaDuax o;u4tee  fciydfs2rau s u)altrio3iy1oa elu i t)t2tmir3oy4aptelfctas artrx  ;u0tpxn o3tasls ua( p u) etrxocto1lp  an i s s2umxm oy4ole lfvta()s2tr( pno0teto i3iadfm2el(vp;u4 exrioctodfmDr ueils s2tmxo oo1lmee nvtat)aDuauro;u4opto fcilslmDul(mon()aetrmocoy1fatraivo s0srtrir3oydal nliei tfs2tax pno1aleniietas s2emnmsn()teerifcoa1oa e ueil()trxm(mpio4ole lieilsfaDtmxrp;t1tpe miciytfs ulu p t)tlenmfcoa1lpDrai slt  rtrim3ny4al e nvta( s2ur(m ;o4aetomieiltlm2ua(vs;(4alxomr to1lptr ivs;(  eurxr oo1al nmict ( s2trx  ;o1oeeniictltfm2eanvon(0 rermrciadfmDr ieol(0 exo(rpno4optemfvi s a2umxmoot1olxo fetas mDemu p;u0trtrmfciadlpDelies;s  rto(m nu4amtemnctl( aDrm(mp;u1opx  oeild s2rmuvp (0 ltomr oytoatrlu slt)tetmxo iodameemivi s)srurxm ou1oeeoifciad m emu o t0arerif iotoaD au i t)t2xoxo3no4lltnmfei ( s2urum ;t4tpeo iciydfs rm( o;(4trenif3oodfm eaivslt  etrim3oudom nmfcilt  Duru pnt1tetoiiciysfa2ua( s;(4aeermo oo1oaDelueo;s)srxrir iu4am   ncta()srtr(ronu4texn ieiat a2em(ms t)tlxomf oytfmteaneslt texoim3nu4apenlicsa(fsrtrumoot4olxo oeias s em( s t)tleniocoatfaDelnvs;(0 2xoxrpio1lpt  fetls)sDtru o;o0oet  octytfa ulump;(4 lerxr3io1om e uvils) rtm(r3ou4om  mncilsfsrua( poo0oexo fciad m uanmo u0 reomf3iadfa  lues;t0s2uoxo3ou1ole  nvi tf rrru oou0oleoifctydfs2emn o;t0 ltnxo3iotlp r uvi () rto(r3nu1ll   ieil()sDur(moou4oeen o3iys m ulnms;t0aexnmfcoa1latr ivi t0texoim3iydlpt  nei ()arra(m oo0alxoiictlt aDrm(mp u)trenio tatlaD lnvols)srxrxmpoydll e fvi s)sDrr(  nu4oeeo fcilt a rmn sn() eerxo oodoa  lu i;s0 rtrir3nodam elncia(fa2ur(mo;u1tlenmo3tydfs2eluvs u0tlenxr3iodlmDeauvi;()s2umim ny1oltnmnvs tfaDtr(mono4alxnmiciltlaDel(vs t) etriocty1lmtr u o;s) rtmir iu4lmtnmfesls  2tmxro;u0alxo i3iydfs2ulnms t)arxrio3oadfa raueslt tetoxrpnu4am  mfviltfsDum( o;t0opt  fctadfs ua( s (0 rxoio3tydomD  ieo;s) rurxm3ny1aptn nei s)aDum(m nt4oltnmfcils sDelnvs (0tlxrif oadlm eln i t) ruoir oodlpenlnctls)srrm(moou4aexomfeildfa2ua(vont)aeerir tatlaDrlieo t0texo(opnudlmee iesa() 2ur(  no0oexo ieiytfmDel(vs u0artoir oytoa rluvs;() etmirpoodoleemnct s srua( p;t1aexo feiys s ran s t0trxomociotop rlivi;t0tetr(r nydll emncsltfa2tru o;u4aexomo3tlslsDum(mp;()alermr oa1lp eaueo;( trtrxr io4am emfeil(faDrax  nu4tltoifcilsfaDulumo;u0 ltoif tydoa  lnvslt)tetm(rpnudlptnlnctlt aDtrx  ou1olt ioctyt m elu o (0 leoir oytfpt li ols0trxrxo oo1oltnlnvia()a2umxrp;t4oleomociysla2rau pnt0 rxrmrctatfptranei;t) 2xr(o3oodoltnmfes (fs2tm(r ;u0tetnii3tlsfaDemums;u0tltrio3ia1lmtelivi;t)tetrxo no4lm   fvil()s2umx  no1olxoiieiydlsDuln o ()treoir3iatlateluei (0t2umio iudllen nvs s) rrmump;u0aetn fetld s2ranmp t) rxrmrcio1oatran ilt0texmxm3iodom  mfctls)s2tm(mp;t1oltnmoctaslsDum(vs u)tetoir io1laD lueo t texr(m no4alenlnvs s)sDur(mpno4oeenmi3iaslmDua(vo;u4aeenio oydfpDelnvil()tetoxmpny4ome mncsls  rur(moot4teeo oeiytfmDrmnmpnu0aeermo oatom   uvi t srurxm oo1optn nvtl( s2tmur oo1tee if3iat m um(vo;u4areomocoo1lp eln s;t0 exmim io4al elnci t) 2tm(r oo4oee mfetat s2eanms u0 eeoxfciotlpD liei;s0teurxm ou1alte nct sfsDrmu  nt4tpx mictatlmDeluvs t4trxriocio1lm e ivo ( s2trir3nu4lmtn ies s)sruau poo4tlx mieiyd mDumumpn(4tetrir iatlpDraneo;s)srxmir3iodol e feiat  2ra( o;u1oeen i3ildlaDemn o;(0trerircoytfptelnvo;t seto(r oydole lfvia(fsDtmu o;o0teen o3tas aDea(vs;(4alermrctydopDr uvi;s0 2tr(m oo1al emnes (fsrtaxro;t0aeeniiciasfsDrmuvs;t)trenir tytfate ivs;t0seuo(m3oodlmenlneiasf 2umxr ;u0alx  o3tyslsDrm( snu4tlermfctadoateanesl()s2xrir3oodlp emnvt s) rraxr ;u1olenmoetadfmDua(vs u0aexnir3tydomD  neo () 2xrio3no4al  mfvsat  2tr( oot0aptnii3ild sDeln s;(4 rxnio ta1fatraies;t)seuoxo3iy1al elietat) rta(ronu0oeto ociat a eanmp () ltrxo3tydfaDe nvs;s texmiopiydameelfet s)a2rmumooo4tle iociytfa eauvonu0 lxrxfciotfaDraneolt0 rtr(r oo4ameemieilt a2trx pot0alenmieilsls rlnvp () eenir3tydlm elueils0t2umir nu4ll nmnvil(f Dra(mo;t4tptnmieiadfm2rmnvpnt)aetrif iatomDrli i ()srxrxrpnudlm n neiltfs2rr(r ot1olxoifctytlm2umnvs;u0arxrir3iodla  auvo;t s2uoir iudoptelivi (f 2um( p;o4aeeniociys a2ran pnt4 rxoif iotla   uvi;s)s2xrirpiy4lpe  ietl()srrmu  nu4opt mi3iltlaDrm(mpnt0 lxomfcio1opDelnvolt  eumim3nu1ol nmneta(  Dua(rpnu4apx mfcilsls2eanmsnu0trtrxrcoy1lpte i i;t0srxo(opou4lmee ncs s)s2tmu pot4apxomf3iatfaDrl(von(0altoxo iotlptr u ils truoimpoy4om nlfeia(  2umum ;o1tpxniocils sDrlnvs ()aeenxfcta1om r uei;()setoio3oo4am emfesls) Dta(rooo0aptomo3ias m um(ms;t0trtomf oadopD lneil( truo(m ou1altemies s)sDurxm ;t1aleomiciasls2emnvp t0trtomr3oatoa r uvo s0teumxmpiodll elnvtlsfs2tmu p;t0apeomoeiltfa um(vp;t0tlxomo3oydlmD  ueo s0setoxr oodapee nctls arumxrpnt0aptomoeiatlsDumnvo ()tltoxoctytfp e n i;s seum(mpiydlpt  ieil()a2taxrp;t0oee mfcildfs emn p u0 exomfciodoateaivo s)t2uoiopou1ole livt t aDuaum no0teeo ieildlm2elumo;(0 eerxf3oydlp elivs;t seurio3iudamt  ivias) 2rr(mpno4aeenif3tldfa2ra(ms (0areoxo oy1fmteln i ()s2xo(o oudomtn ivs s a2taumpnt0alxomi3iat s2rl(mo;u0 etoif3oo1oaD lueslt) eumxo nodamtelfctl(f 2ur(mont4teeoio3tlsfs elnvpn(4 reoxoctotop eluvi t sruo(m oo4lm nliei t arrr(m ot1alxoio3tadlmDuanms t)aeeoxfciadoaDeln s;t  2trim ny1lpe  nvta( sDtmump;o0tpt ii3tatlm2rmuvp;()tleoif oadla eanes s) euo(rpoo4lpeelnet s) 2tr(  no1apx  feiyslmDrln o;t) lxnif3io1opDelies;t)t2ur(o iy4lmt mfcs ( sDumx oot4opxo fetadlm2el(mp ()tltnif3totlaDe ieo ( setoxopno1lmee fetl() Drmx ont1tltomfciaslm ul(mo t0trtnxf3tytomDeau i (0s2tr(m3io4llenmnvias)arum(mo;u1apto oetat sDem( o;(0 exnmrcoadlmtr ues (0 euoxrpiu4ll emfesasfaDtrxmoot0optnmo3ias aDul(vp u4aexoircoytomte ivs;t0 2urir3nudlpenlneslt  ruaur nu1tleniictas m umnvsn()arenxf3ia1lp  luvsl( trtmimpiy4lp  mnet (  2ua( pou0oexoii3ildlmDrau ont)aeenirciydfm   i sl()srtm(r3iy1ll  lfesasf Dtrum nt4ale moeild a2eanmo (4aeerxo ty1faD luesl( t2trir oudlptelnci s)sDrrx  ;t0optoiiciysfaDeln o t0altomo tydfate n o;() 2xoxm iydomtemnvi () Dtau  no1tltomfeilt m2umn p t0alxrir tatlmD li olt teuoxo3nydol  lnesatfarrr(moou0apxnio3ias a ea(monu4trenxrcoydopDran sl(0 rurxr nudlpt  ncia( a2um(r ;o1apt  ieiyd mDua( snu0trtnxr3iytfp rlnvi ( sruoxr oudom   fetltfsDtaum nt0opxn iciadlaDran o t)trxnio3tydoa   n o t0s2tmio ou1amenlncias sDrru poo4alenmieiltlm rau s;(4tetrxocoa1fm r ueilt0 2xoiopoydole mnvil( a2rmxrpot0texoiieiysfs2umn p;t4aleoio ta1lmDrlivilt teto(opoodameemietasfsDrmx pot1aeenifeils aDem(ms;(4tlenif3iatoptelivs t)srtrxmpnudale  nesat arrax pno1opxo f3tytfm2ean pn()alxnxrctytlaDeanvils0 rxo(mpoo4lpenmnvilsf rrau  ot0texnmoeilt a ul(vs u)artnxfciy1lmtrlneslt0 rxrim ny4ll e fcsatfsrrmxm ou0tpeomf3iydls ulump;(0aexomr oadoa e i o t0srxmiopnydal n ici s)aDrrurpnu4aexomieiytfs elnmp u0 ltnxo iy1fm eau o;( sexmim3ny4llte fei t)s2raum nt0tpxnif3tas a2umumo;t)trtoir oodoptrlnvo ( srum(mpio1lltnlics sfsDtrxront1tpxnmo3iat s2umu sn()aexnmfcoytfm rln ilt  eto(m ny1apte ncs s)a2ua(mo;t4apx ii3iatfmDrlu o;u4 rtnxr3iotfpt aivolt0texoxmpny1lmenmfcs ( a2tr(r ;o1opt  ociaslm2rmums (0tetnmf3io1lpD  nei s)tetmir3iy1om e neil()srtau pno1ope mf3iytlm ulump t0altnmf3ta1lmDeaiesl()s2uoxopoodlp nlies sf 2taumpnu1opt ii3iadfs2uln s;() ltrio iytfat aivo;s) 2toxr oo1am n nctl()s2ua(r ou0tpt  i3ilsfa rmuvp;t0trtrmfctadfp  aneil( srxrxo iu1apen fcia( aDuaurpnu0optomfeiadfs ra(vp (4alxnir iodlp elivi;t seumio3iu1lpeelies s)arra(roou4oexniieiltla rluvp (4 lenmf3ta1fp e neil()seum(r nydll nmfesa(  2tmx pno0alxniiciysls2umu s;t4 renxr to1faD aivol(0s2xm(m3io1lmeemfvs t)s2urumo;t4tlxniieilsfmDrmu o t)artrxo3iydlaDeanes;s)trxrirpnydllee ictatfs2umxm ot1oleo ieild a rmnvsnu4aetnxf iytfptrlnesls)t2tmirpiu4apt  feias)s2uaxmp;u0oee iociys m uanmsnt) rtrxf oatlmDrlivo s) rtoxr iy4altemicsl() Drr(  ot1tlxniictydla umu s u)alenxfciy1lpteaivs;s0trxrxmpnodlltnmnetl(  ruau pou0tetnifciys m el( ont4 eermr3totoa e n olt0s2tr(m3ou1olenmivia(  Dua(ronu0apeo fciyt a eln s ()trermo3tadlp e n s;s  rxoxo iudal  mfcsl()arurum oo0oeeo f3ilslm eluvs;u4tlermfctadfa eaueo (0setr(o nu4op emfcta( aDtmurpou0teenif3iasfa2ranvs t0 rerxr3iydopteai i ( sexo(m oy4alee fes t srumxrpot4ale  ictyd a elnms;(0 reomf oodlptran sl(0 2trxo oodlpe lfcilsfsDtrx ono4opxo i3ildfmDrl(msnt4arerif tytoaDeanvo ()srtrio oydom nmnvi (  2uau p;t0oltnmf3iyt s ra(ms ()treoxo to1fm   nvi;( srtmir iy4ll   ietatfartrx pno0ape  ieiytfaDuau s u4areoxo oy1fatrauvolt0 euo(rpiy4lle livtlt srta(mo;t4oetn fctltla rlumo u4 eeomr3oadlpteaivo;s0 exo(opiodaleelnci sf 2tmx pno1aetnmi3iat m2rmn p (4 leoiocio1fmDrln ol( t2tr(rpiodlptemivias)sDum(r ;u1opxomietaslm2umuvpnu) eerxoctodla  ai ilt s2toxopno4opee nvi t)sDtr(  no0tex  ictytfa2rlnms (0 rxnxr iy1om rln o;t)srxmxm ou1olenlnvs s aDuaur ou0texn feiyd mDrmn sn()tlxrxf to1fmD luvilt sruoxr iy1lp  lnciat) Dtmxr ot0oetniociad s eaumsnu0 lxrmrciytom  lneo;( trumim nu4lme  ncta( srrmxmpnu0optoii3iatfa2ulnvpn(4 eenio tydlpt anvi;(0tetmio3oy1om  mfetasfaDtau pnt4aex iictld a2ea(ms t4arenif3ootfmte i ols0texoxm oodlme lfcs t s2trxr no1aex  oeiyd m ulnmo t) rxomocto1laD  n slt)s2tr(m3nydlmtelnei (  rtr(r no1tee mfeiatfa uluvp;t0arxnmo3oytla raues;t)sexoim io1opte nvsas)arrr(  ou1aptniocilsfm rau s;u4tetomr iatlpDr nvs;t0s2trir3no1omenlicsl(  ruaxroou4opxnmoctatlm rluvo t0 exrmr3tydomtean i;(0 2ur(opnodlm elfesl(  ruau onu4aee iociys m uauvo u0arxomf ia1optraies s seum(r nudalee fcilsfs2rax p;u1oeen i3iatla2uaumpnt0 lxnmf tytfm  ln o;t)srxo(r3iydomt lnct s)arraxmo;o1olxomictld a2elu p (0tetoxr3iatop eauei t0t2tr(o3iu1olt mieias srraumo;u4apt  iciysfaDrmuvp t0tlermocoy1omDrlueolt)srtrxopnu4lleelnviasf Drax pno4oetnmicildlm umnmsn(4 rxoif3iatopDeau olt)t2tmxm3nudlltn ivils)aDtm( onu0tlxn f3iatfmDrlu ont4altrir oydlpDrlivo;(0s2umxmpnydlp n fvi (  Drau ont4ope ifctld mDea(vp (0aetomf3tytlp  ln o s)trurio oo1ap  livslt s2trx  ;u1texo ieias sDrluvpn(0 rxoir3tatom eau i s t2xo(r oo1oltnlnet (fa2raumo;u0aetnmfeiysla2uanvp;u4arenio3oatfa r u s;()seuoxopoodaleelfci t a2uaumo;u0alt  i3tyd sDulu pnu)teerir tatlmDe uvols)truo(m nu4lltemicta(f ruax oou4olxnioeiydfaDeauvon(0texrmo ootfp e ueo;( tetm(r3ou1am   fvsas arumxm ;o4tlxoioctls m2rmuvs (4 rerxr3tytfptranes s)t2xr(r3iu4openmnvsat  Drmxmono4aet ifcildfa2ua(vs;(4aexoxr iatlp rln o t  rtoxm3oy1omtnlivslt arurx oou0texnmieiydfaDeauvs u4tetrmfciadfaDrai sl(0teurxo iy1ope  fcsls) rua(r ;t0aptnio3tyd s rluvs (4 lxoir3tatfatean i ( t2urio nu1lm elivt tf Dta(  nu1tlenmfciltfa2um(vo (4 rtriocoo1op r u i;() rtm(rpoo1lm  lictls a2rmxmonu0tpeoifciltfa rmnmsnt0tlxnxrcoy1latrauvi;t s2xr(m nu1ale mncsasfarrr(mp;o1opeomf3iltlaDrau pn()trerxr iodla   nei s0texoxr io4alte ietatfsDtaur ot0oee  fctlsfm umn o u0arxnmf iodfptelnvslt0s2xrxr no4olenmfeils  2tm( p;u1apxomfetydls2rm(vp () renxr iatfaDeaieolt) 2toxo iu1omtelfvsat s2rmx pno4open feiasfm el( snu0altrmo3iadlatr nvilt s2xrim iy1ll  lncilt  rtm(rooo0apx ioeiadfsDra(ms;(0alerxf3iy1latraiei t0 2ur(opiy1olen ivt s sDrrxm ou4ape moctad a2rlumo ()aetrxr3oy1optelnvi t0 rtmir nydaltn fvias) 2rau oot4olxomf3ias s rln pnt0 exoir oatfpDr ieils s2xrxm no1lm  liesat aDrm( pnt0teeo f3ils a2umn ont)trtoio3ia1oatrlu ol(  exoxo iy1lltn nei t aDtaumpno0tlxniociatla2rlu onu0aeenxrcia1fptean il() 2toimpny1lltemfvi ()a2tm( p;o4aetn i3ias a ulu ont)alxnircoa1omt lieils)srumxr3iu4op nlfvs tfsDta(  ;o0opeo oetysfm umnvs u0 lxriociadfm eanes;()truoir3ny4open fvi tfartmx  ot4oeen o3iydlm2rm(mpnt0tlxoxo oy1op rli o;s tetrim iu1lmee feslt)sDur( oou1aetnioeildfa2ra(vo;u4 exrxo iatoaDean i;(0 exrxopnu1amte fvta( sDumxr ;u1aex mietlsfsDumump;u4 ltnxrcio1oaDe nvi;()srtrirpoo1ap n ieil()a2taxrp;u1tlenmi3iltfm rln s;u4tltrmo oodlm  livi;s  rxo(mpnudll  mieta(f rurxm ot0oexoioeiaslm2elnms;u0trxnmr3iotfmD aivslt0t2ur(r3oy4ap  lfeilt  2ta(m ;u1openioetldfaDemnmo;t0 etrxf3iydlpD  ivo t)t2umim3ny1om  lictat)aDrmur no1teeoioeiydlm2ran onu) lxoio iodlpDelies () 2tmirpoy1aleelnet ( aDum(rp;t4aeenmfeild s emuvs;(4aeeoxrcootomtrlueilt0srur(rpio4olenlnvtat)a2rm(m no4aee mieiyslaDumu snu4 rerifciatfa r ueils0srtm(r3io4optelnvtas  Dtmxr oo4apx moctas m2uln p ()teenxocty1oatean slt)t2xmio oo1apenmnvtl(f rta( poo1tpxnmi3tadfs2rl(vo t4tetoirciytopDrluvo t0 etrxopiy4apen ieil(fa2rrum ;o1opt mo3iltfsDrmumont4arxoxo3ootfaD aivs s)tetr(r iydom  lfvt t  2ra(m nt1oetoio3iydfaDelu p;(4aeerxo3iy1oa elivol() ruoir3oodomt lfes t)srtm( p;u4optnmicias s2ea( s;u4trenio ootfatelivs;t) exo(mpou1lpt mnesls aDumxm ot1opxn fetasfa2ul( p;(4 rtrxr3tydlpt lneols t2um(o oy1ll  lnetas)a2rmumo;t0aleoioctltls ran o t4 eenxo3tytfatelnei t0texmxo oy4apt  fcsls aDum( pou0apx ifeildfs2emnmpn()texrio oatoa eluvi s)t2uo(o oo1llt livias)s2tr(mooo1alxomfctydls elnvp;t)teermrcoydopDeluei t srto(r3oy1lmtnmieslt aDuaxronu0optnifeiadfsDem( pnu0altoxr3totopt ai ils0teuo(m iudamtnmics sf Dtm(  no4oeenmictatla2uan o;t)alxnxr iotlatr ieol() 2tm(m3ny4lp elics (  rtmurpno1aexniictadfa um(mp u0 exomfctadlat  n i;t)s2xoirpoudlpt mfvi sf Drm(m nu0apt io3iyt a2rau pn() etnxf iytlmDeaueil(0srum(r ou4lm e nvtas) Dtrum no4alx io3ild mDrl(vs;t0aetoxo3ia1lmD au i t0texrxopou1lp emnetl(  rumumono1alx  oeiadls2emn on()trtrif iodomDr uvsls s2to(mpiu1am n fciat artau  ;u4optnifcild s2ra(vonu)aetoxr3iytlmteau il() 2xmiopoodopee nciasfa2tm(rpot1olto ieildfa2uanvs;u0 reoxr oadlaDean i s0s2xrxm oy1lp elnvsls sDumxrpoo0tetnii3iasfsDrlu s (0alenmf3oy1lp e u s;s teur(opiudamtnlfvt s)s2tmur nt0tlto f3iydlmDemn o;(0alxnio iatfmDr ivols)srxmxrpiu1oleelivilt)a2tm(m nt0olxomo3tld m2ra(mo u) rerxo iotfmt aivi t0 ruoxrpny4ap  mnctl() rrmumo;t4tet mi3ild a2rmnvpn() etnmf ta1omDraivs s s2xmxopnodlm nmiesa( arrruro;u1olx mf3ias m elnmp (4tltoif tatom elieilt tetoxopnu4lptn ies s)aruau pot1alx io3tld a um(ms u0tltrif3iy1lpD  n i;(  2xrxmpoodolt mictat)srtmurooo0alxomicildlaDul(ms u4tlxoio3iadomDeaivo t0s2xoxopoo4apt  fci () Drrumpnt4apenioctytlaDrln sn(0tlxnio ia1opt an ilt0teumio nodlmt  ict s  Dur( o;t1olxnii3iaslaDeanms t0texoiocoy1opDelneo s0 rtmir ny4ap   fcs ( aDrm(rpnt0altoiocildfs2emn s (0 exnmocta1omDr u il( tetmir no4oltn ivi ()artrumo;o0tle mieiyd s2rmums u0 lerif oodfaD lieolt  2xo(mpiydlmt  ncsl( sDua( ooo1ale  fciaslaDum( s;()teerio tydlaDraies s s2umirpny1ome mfeias) 2trurp;u4olenmf3iys a eln o;(0 ltnxf todfmD ln s t) 2umxm no1altelicsat) Dtrx onu0tlx  ociltla rluvo;()trtnmo to1fp  aivslt)s2urio oo4op nlict t)a2rr( poo1olxnmi3tytlm2ra(vp u4arxniocia1lateaueslt0s2tm(mpnu4amte ncslt)a2tmx  nu1olenifeiys s2ul( p;t) lxnxoctydfaDeauvils  ruoxopiu4omtelics (  2umx ont4aeeoiieiydfm eluvp;t0altrio oatlmD  nvo s) 2xmimpiy4lptnlfcia(fa2rrxmpnt1alxoifciatfs um(vs u)aetnir oatlm r n o;()texoxo3iy1lp nlivtl() rumxrp;o0tetnmietltla uan o (4 leoio3tydlmtr ueilt)trxrio3nu1lmenmnvil(  Dum(mpot1tet  feiyd aDea(ms;()tltnxfcia1om rlu slt t2xoxm3io1am nlfetatf rtmxmpnu0tlt mo3tydfaDumu on()tlxrxociy1lpteln i t)texoim oy1altnlfctls)a2rm( ono4optnmo3tlslm2rmu o (4tlxrmf3todfmDe u i (0trurxr3nu4omtn ivs s srtrump;t1aee mf3tldlmDra( p;t0 exoxo oy1fp rlueo;t)sexmir3iy4amt mnctls sDur(mont1teenmf3iasfm2umump (4altoir3tatoaD auei;(0sexoxmpno4lmt mncsa()arrrx pnt0teenifeiat a rluvpnu0alerxr totoa r n i s) rxoxo3oydolenmnesls  2taxm ;u1tlenmiciaslm rmnmpnu0 eenxf3oodfatr u i;()t2xrir nydop e nesasf rua(  nt1oexnmo3iltfa uanvon(4alxrmrcoytlaDran i s0texr(opoydoptemnviat artrx oou1oltnii3iatlaDul( snt)arxoxf iodfaDean s;t0trumxmpiu4lpenlfctlt a2rmum oo0tet  fciydfa el(mpnu4aexrircoydoaDeln ol(0 2tr(r iy4omtnmncta( artr(ronu0aleoio3tlt m uln sn()tetoxfctodlaDran ols sruriopnu4opt liei (  rrmurpou4ale  i3iyslaDrm(mo (0 lerif3iotoptrluvo;()srtrir iydam e iesltfsrumu  no1aeen o3tysfm ra(mpnt0aexrxf3oy1faD au o s) exm(r3nydam  mict s  Dtrur no4tptoio3iydfaDrmn p (4 rxomrcia1lat  ies;s) etr(o nu4lmtemfes tf Dua(mono4optn octldlsDeln snu0areoio3tytfaDe neol( texm(m3oodam   fvi sfs2rmuro;o4aeenioeiadfm ranvsnu0aetoif io1fmte nvs;t)sexrio3no4ame mics t)artrxro;t1alenifctysfmDel(mpn(4 exrif to1la   nvi;( t2urirpoudome lnetat srta(roou4tpxnioeiyd sDemu s t)trxomfciydoa rauei;s)srto(m iy1al nmnvta( aDrm(m ;t0oeto f3iytfa rluvon(0alxoif totop rlneilt)sexmxm3nodal emict s)s2tmxront1ale io3iydfaDua( o;u0aexrxfcty1fmtranvs;()t2trir nydlpee net ( aDtrxrpot4apenmf3tatlm rlnvs;(0alerio3ta1opDranvs;()srumxrpiu4ap nlnciatfarur(moot1opto o3tasfmDuauvp;t)tetrir oa1lm   ivs ( trxoimpiu1optemfvt () rrmxmonu4olenmiciasls elnms;()arerif oo1op rlivo;t0sruoimpno1opt  fvt sfsDuaurpoo4openio3iadfm uanvp;t0 rxnifctodoaD luvo;s)srtoxm3io1ome mnes tf Drrur nu4aee mietyt aDeaump;()treoxrctodlmD au ils0 ruoirpoy4optemfvsat) Dum(r ;t1optnio3iatla elump u4 eermfciotlmDeauvilt0 2tmir3oy1aptnmnciat  2uax  ;t1tpxomoctadlm em(mo;(4artoir iy1op rlu o;s s2toxmpiudol n nvslsfaDuau pnu1opt ii3iat mDelu s;() renifctatfmte ieil()setrir ny4lpenmfeil(f Drrxm nu4altnmfeils sDemnvp;u4 lermo iodlaDeauvs t0 etr(r3oo1lmtnliesas) rrauronu1tleomi3iadfs rlumo;()areniociy1op  anes s0teuoirpnu1lm emicsas) Drrxr ;u1oetoifctasfa2rm(monu0trxrmr3oodop r u slt)teumio nydop nlnvtl(fs2rrx ooo1tleoioetldlmDemnvo;()alerifciatfa raueo s  rum(o iudlp n ictat  2taurpnu0aexo iciadlaDemuvs ()trenmr3to1op  lu s;s s2toimpiodam elfetat arraxrono1opx iociasfsDel(ms;t)arxnxf3tatlmt aieol() rxrxr oy4lm elicslt a2rau  ;o0ale moeiysfaDem(vs;(4 lxrmo3iodop e n i;t) 2xmxm iodop  licia(f rtau pnu0optnii3tldfa2rm(vs (0arxoxo oydfpDrlnvi ()s2trim3oydame lfvtatf Duax oot0aeeomi3ilt s raums ()treoxo iytfmtraivsl(  2tr(opiydalen nesatfaDrm(  ou0op
\ No newline at end of file
@@ -0,0 +1 @@
+nvi s0 eumxm nydape  fciat) Durx ono0alx if3tadfs ul(mp u4 rtomr3iytlmDeaneslt sruoiopoydll nmicsatfarumxm ;o0alxniicilsfsDrmuvp t4alxomfctytom eln s;s)s2xmiopoo4lmeelncia()srta(mp;t0apxoioetasfm2ulu p;(4 leoifcoydfpteai ilt s2trxrpoy4apt livils  rraxm oo1tpxnii3iytla2elnvon(4tlenmo3oodomt li il(0tetm(opno4opt  fvil(fsrrrxroot1tpeo o3tysfsDranvpn() renio3ta1laDeluvol()sexrxr oydop   fes s s2tmxmonu1oeeoif3iytla2ulu snt0arxoxo3io1oaD lneslt s2xrxo3no1lp nliciat arumu pou1tetomoctltfmDelnvs u4 exrmf oodfaD lu o t)t2umio3oydam nlivias)a2tm( p;o0olxnmieiatlm2raums;u) eeoxfcoodfm ranvol(0 rtoiopiydlp  lnvt s  2um( o;u0oleo i3tadfs2rmuvs;()alerirctadom elu o;t0 rxo(o3iudopenmfesas) 2tmuroot1aet  oeilsls umnmonu) etnir totop  livo (0 rxoxmpoodlptelnei s arum(rpno4opxomfeias sDran o;() ltomfctatfpDelnvi;t  eto(m3nu1ll e ivia()sDtru  nu4tpxn ictas sDel(mo (0arxrio3ta1oaDelueol() 2xmxo3oo4alenmieta(f rua(  oo0oleomoetyt mDelump u) ltrir ia1laD lu i;( teum(rpoy4openmfctas) 2um(  no1ape moetad a ran o ()artniocia1lmteli s () ruoio3oy1op nmfcs (  ruru  oo4alx  i3tadfm ra(vsn() rtoiocio1faD ln s t0 rxmxmpoy4lmtnmict ( arua(mp;t0apt mfeiyd aDul( p u4 eenxfctadla r u s t)sexoim oy4om emnvt sf Drrx p;o0olx  oeilsfaDrmnvsnu4 reoxfctatlatrli o ( sruoxo nydapenmnesas)sDur(rpou0oltoiieiyt m rmu pnu)tleoxfcta1omDe ivi t0trtr(m no4ape mnci sfsDtmxmooo0ape ifetaslm2ea( sn(4alxrif3oo1omD lnvs;s0 etmimpou1altemivsasf rtmu p;u4apeomoeiys a umu p (0tltoxf oy1lpDe i s s setrirpiy4lptelieiasfsDrauronu1aleomi3tat a2ulu s u)treomr3oydlaD anvolt) rto(m iu4lmeelfviasfs2um(roou4aptoioetltls rmnmonu0tetnmo tadfaDeau o t0t2uoxo ou1oleemietat) 2tmurp;o0tex ii3iadfs2ua( s t) exnif oydfat aivsl(0seur(rpoydlmt mfvsa()a2ua(roou1tlen i3iytlm ran s ()arermo iadoa rauvs (0 exo(r io1ame lfvsls srtrx o;u4olenmoeildlmDeauvo u0 ltoif3tytlm raneo t t2trxm3nydlleelivi sfarurxmp;t1aptomfeiysfsDuanvp;t4trxrio3oadlpt  nes;s)trurxo3oy1lmte fviatfaDtm(rp;o1apxomfeildlm eau s (4teenmf3tatomt anvs (0 euo(rpiy4ap e ictls) rtru  ot0apxo iciys s rm(msn(0trtrif3totfa r u s;(  2xrxo3oydolt mfctlt)aDurxroou0apenioetldlm2uan onu4aexomfciydopDrlnei t  eum(mpno1openmfciltf Dtmx onu1oexo f3tltfs2ra(vp u4tltrxo3ty1lpteaivs s) rurxo3oo4omt lfvtlt  Dtru pot4tltoioctltfa2uanmpnt0arxrxf3iydlatr ivo;(  eumimpnu1alt mivsa()srraxmpot4oleniiciyt sDuaums u) eermf3ta1fmtraieo;t0 rtmim3ou4lpe mfes s a2tau ono1tpxo icilt m elnvp;u0areoxfciy1opDeaivi t)t2umxr3iy1lmee ivs t)s2tru  ;t4alt iietyslm uanmont4 eenifcoa1fate iesl()sexmxr3no4ll n fcta() Dtrx p;u4opxoiietasfa ul( o u)altrir3tydlpDr ueo s0teum(mpny1lptemnvs (faDtaumoou1oex mictydfm2rm(msnu4teenmr todfp   uvi (0 etr(o3iudom n icil() rtrur nt0oet  o3iltfs el( snt0 rtoxr3iydlaD  ies t sexoxm3oydomt mfctlsf 2um( pnt4oeeoiociyd a2ua(mo t0tltoio3ootla eaneilt0tetrim3iodlp   feilt  rua( pou1olt mfeiatla2rmu o;t)aetomo3tadomD  n i;(0sexr(m iy1ap n ict (f 2tmx  ou1aeen ociat a2elums u)altnio3tatfat  uei ( s2umim3oy1ol elicslsfsDtaxmp;t4oleomfeild mDumnvpnt)teerifctotomD livils0 2uo(o ou1lpt  ieiasfsDur(rpnu4olxoioetydfa rmn snu0 rxomfciodfm   ies s)s2umim no4lm  lnei (  2uaxr nt0tee moetydla rlnmp;(0tleomo oatfm  an slt  rtrio3iudol nmivs t a2ra(ro;o4tltnmfctadfa2ulumsn(4 etnir todfpteliei (0srxmxm nodop   iviasfsDtr( ooo1aee ifctadfsDemu o u4 lenxf iodfp eaueols seumir iu1lpt lneils sDuax ono4oetoiieiytfaDeluvpnu4areoxfcto1faD au o t  2uoxo oudlmee fvsat  2rax pot0tle mi3iltlm2rm(von()tltrmo oy1fmt  n il()sexriopiudalee ieils s2tru o;u0olxnmf3ias a2em( o (4aeenio3oodfat aivo s s2tmirpnydopenmfcsl(f 2tm(mpnu0tpe mfcilslaDemu sn() lerif3tatlat ai o;s  rtm(r oudoltemfci s srtrumpot0oeeo f3ias s2rluvo;(4artnmr ootoaD  uvils)t2xmio3ny1op  mfctas)a2rau pno0apxn oetldlm um(mp;u4 rxoxfcoatfptrln i s teuo(o3iu1ll n ivi () Dur(mpnt4tpxn iciytfaDea(mp;t)aeeoxo3iydfpDr u o;s0t2umio nudlm nlfciat) 2rmxrono1oeenioeildfm2um( s;t)texnxfcta1lpt aiei;t0s2uoxopiy4lmen fci s)s2urur ;u4oleoifetytfm2umnmp t4teerxf oodfpD  nvsl()srtoim no1ome lnes t)a2ta(  nt0tetnioctldlsDrmu o u) reoxo3oy1opDelivi;s)t2xm(r nodap nlfviatfsDrax onu0opxn i3iltlm2emu p;t4alenmr3tydfaDeluvo ()setmxm ou1om emfvslt)aDta(mooo4alt  feiatlmDranvont) lerxr oa1la e u s;(  2trxrpoy1ap   ietat s2rrxr no4olenmieilslm ul( p ()alenioctotfaD an o;t sexr(r io1ame lfvta(fsDtrx  nu1oexn i3iltfm2eluvo t)tlxoir oytlmDr u s;s0teurxo3oydal elict s)sruaur no1alx ii3ilt m2rl(mp (0 rtoxr3ia1lp r u slt0sexmxrpno1lp e ncias) rtrur ou4tpeoii3tasfmDumuvs;()teeoxr3iodlm elnes;t)s2xr(o3iodlpe mnvtat)s2tr(rpnt0aexoiictydfaDrluvp u0tlenif tadoateluvi t t2trxm3nodlp n nctatfs2rm(m nt1opxn iciltlmDeanmp u)aetnxociytlm elneils0srxmxr3iudole mfetasf 2ua(mpoo4tetomoctad s2elnmpnt)artomr3ty1lmDelivi s0texrxopoy1al emicil( a2rr(m ;u4oee if3iatlmDel(mpnt) lenircoo1lat  uvs s)trxrxr oydam nlfet t)s2rrxrooo0tpxomo3ilt m2rmnms t0altnifcoatfpteaies s) 2xoimpno1lm nmfvtlt) rtmu pou4aptn f3iasfaDua( s (4 ltrio oy1omDr n ols) 2xoxm no4lm elfcilt)s2rrxmp;o4tlxoiieilsfs2eln p t) etrir3iydfm raneo s0setrio3nydomt  feiasfaDuaxr oo0tpt mfeildlaDeau p (0aexrio3iytfa rauei;s srurio nodal n nct t s2ra(mpnu0tee  icild sDrl(mp u4aetnxo3totop eaivs;() 2toxmpiy4lme lnetlsfaDuaurpnt1olt  o3tasfa em(vs u0trtrmr3to1lmtr neilt0 etmim3ou4oltemivia(  2tm(mpno4tlt mfeias a eanvo;(4teenxociytlmt auei;s  rtm(rpoo4al nmfcsa()s2umxrooo0oet  oetls a2rlnms;t4trxrifctodlmDeli i;s sruoio oodlme lnct (fs2taxr ;o0open ociytlm rm(msn(4alxnmf3tytlpt  ues;s  rurir oy4ape lncsl(f Dur(r oo0alenmociyt aDem( p;t4 ltoxocoytfaD lu s s)trxoxr ny4lptemnviat sruaxm ;u4tpenmfciydls ulu o;(4 rxrir3iodfpDeaues;s) rxrio iudlmee icia( a2rrxroou0oleomicildfsDea( s u0aeenmrctytoaDrlnvi ()teuriopiu4om   neiat sDurur ot4alx  oetasfa ra( p;t)treoif3oydop   nvol( srxmxmpiu4om emivt s srurxro;o0ole  oeiytfsDrm(mp (0texnxf3tydla e ivs (0 rxmir3oo1opt  feils)srumurpnu4apxoif3iatfsDuau snu)aexrmf tydlm raieil( trxo(mpoy1op nmfcia( arumu  ;o1apt iiciaslaDel(vpn(0trtoifcootfm  an i t trtm(r oy1omeemfciatfa2rmu pot0aeen ietydfs uanvp;t4 rxrxociytfa  aies;s t2xmim iydlmtn fvta(  2urxmoot4tpeomoctldfm rlu pnt0trtnxf io1fp ranes;(0seuoxr ny4ap   icslsfa2taum nt4ale iicils s2umuvpnu)teeoxfciotlmtrluvi s t2tm(r3nudllenlfvta( a2ururpot1openifeils mDra(mp;t)aeeoiocoytfpteluvo;s)seur(m3iy4ol e ncta( sDtmx p;t1tptnmfetyt a2uau o (4alxoif totoat anes (0trxo(m3nodll nlicsatf 2ta(r nt0apx  i3iatla uan pnt)treoif iadoa ranvi;s0t2umxo3ny4amee ics s arraxro;t0oet mfciasfa2rmnmon(0trtomr iytfpDe n sl()tetm(r nodamenlietl(  2tmxrpoo0tptn o3iad sDuan p (4aexomoctadoa rauvols0trumxm iu4ol  lfcsat) 2rmxmo;o0texnmi3iat s rl( pn(4texrir3tydlaD lnvils) 2umxm3oy4lpe  fes sf rtmumpot1tlx mi3tltfm2rmn p t)artrxf tadfpDraueil( tetmio3no1ale lneias  Drmu  no4aee if3iltlm2rauvs (0tltoxo oa1fmt ai i s)trto(m3iodlmeemictat sDtmur no0altnmo3tadfaDelnvs;(0aexnmf oodlp raneils0setrxmpoydllenlncs t)sDrmxmp;u4optomictasla2ean o;t0 rtoio ootfmDrlnvi s0srurir3iodal n nvsl( arrmxrp;t0aet mictyd m2ul( s t) eerio iydlmDr n i t s2urxr nydlm elnetatfa2ua(mpoo4oetomo3iltfs el(mp t0 rxoiociotom r n i;t trxmir3iodap elici ()arua(ro;o0aptnioeiytfa2elu pnt0 rxrir3oodlatraneo;s0tetm(m3iydal e netat) 2rr(root0olen oeiad m2ea(vs;(4artoio totlate nvs s0 exoir3iudlmt lncil( srtru o;o0ope mf3iysls2uluvo;(4 ltniociatoatran s ()trxm(opou1ope licsls)sDrmxmo;u0oltomf3iysfa2emuvp;u) etrio3iatla ran o;s0tetoirpoy4aptemnvsat  rta(  nt1olxn fctyslmDeluvp;()trtnxo3oodom  anei t0trxrio3io1ol elfvias srurx  ;o1apto oeiadfsDrmuvpnt)trenmr3oatomte n o s0s2toxm3io4lm elnei s)aDtaump;o1oexomoeils a rl(vont4aeerio oy1lpDean ol() etmxrpny4al n ivsa()sDtaxr nt4opeoii3iysfs2emu o (0 etnxr oytopD aueilt0seum(m oo4olt  fei s)s2rm(r no1tpx moeiadfa eln pn(4aetoir totfmte i i;(0 rumio nudlp elnvtlsfsDrrx  ou4alt iicilsla umu p t)alenif3tydomDe nvi;s) eto(m3nu1ape lfcta() Dum( pno0oexo f3ias a2rluvo;t0altrmrcoy1fmD ai ols  2uo(mpiodlmtn nvtat  2taxrp;t4tltoiieiatlm uauvo u4tlenio iy1fm  ln ilt0 2toir ny1op  mnviatfartaxro;t0aleomieilslmDra(mo t0 lxrxo3io1fp r neilt)seto(m iudalenlict tfsDtmu pnt4alto fctld mDum(mp u4treoxr iatomt lneil(0 2uoxrpoy4lltemncilt aruauro;u1tpeomocilsfs rlu p;t)aexomo3totoaDe uvo;s)tetm(opoodapt livils srumu onu1aee if3tyt sDeluvo u4trtnir3iy1optrlu ol( t2xo(r3nudapee nvsl()a2rm( o;t1ape iieiadfm ran o;() lenmf3to1fptelivi (0 eurir3nu4al  lietatf rtrurp;t1olen oetasls2em(vs ()alxoif3ty1opDr i o;t)t2xriopiy4lp e nvsl( a2trx p;u0tleomi3tas aDul(mo t0tetrxr3ootlmDrln s s0 2xrirpnu1omte icias)s2rm(m oo0apx  oetydls eauvon(0aeenmrcoydom eauvo;t) rxo(r nodlptelfei s  2rax  ;o1tpt iicildfsDul(mp;() eenxf tatoate nvilt)sruo(o io1lpe  fci sf rururp;o0tlenioetad m eauvsnt) etomr3io1lp raivs;t0srxr(r3iy1llt mfvs ()srua(  oo1tptniocildfs2em(vo;u0tleoif oodlmD anei s0trxoxr3ou1lltemfvi t sDurum no0tltn feiysfm umu sn(4 ltomocoy1fa rauvi;s0trtoxmpiu1lp  mncias a2raump;t1apxnmicils sDeln snu0trenir to1lm rlu s ()s2xoir3iy1oltn fes tfsDta(root1olx iicildfm2eln s;() leoxr todlm rlnesls0 etmxr3oy4lpe livta(faDrax pot4aptn fcildfa umu ont)aetoirciatfa r n o t s2uo(opnodapeemietas)sDum(mooo4ole  oeiasfs2ra( p u4trenmf io1oa   i i t) rto(o nu4op n icia()arua(rp;t4alxomi3iytfs uan s;u4 rtrmr oydfpDranvsls srtmxo3iu4alt mies ( aDrmx pot1alxnmoeiat sDumuvs t0 etrxociy1faDr ues t) 2xrir no1apt lfctltf 2rmxro;t1aptn icild s2elu s;()arxnxf3ootfp eanvs;t) rto(opoodlmtemfvi tfa2uaur oo1aexo ociytla el(vsn() rtnxr oadlpDeln i;s  2xoir nu1ole  fci (f 2tmurpot1ale  fciys aDeln o;()aleoirciy1omt auvilt t2uoxm nu4amenmfciat sDtm( pnt0aexnmoeils a2umump u4alermo iydlp e i ilt)srurxopiydolen iviat)a2uru  nu1oexniietytfm2ean o;(0alxrxo3totfaDelu o (0 2xrir3nodoptemiet t  2tau ont4aetnioeiys mDeanvo t)trtnxociatoateli slt texr(rpoo1omtn nci s) 2umurpnt1oeto icils mDuan o;u4 rxrmocootopDe i o;s t2toxm io1amt mivilt aDrrumoot4tlt if3tytlm elu o (4 rtnmo3iy1om eaies s0sexr(mpiy1llt lfei ()artm( oot1optn f3iaslm2rmu p t0aetrmrcio1fmDr n s;(0t2umxr3ny4lle mnvtat sDururpno0altoio3ilslmDra(mp;() exrir3tatlaD anes;(0srtoim3iy1lmtemnci s arumumpnt1tptnioetatfsDulu onu)arxomocoytlaD  u slt)s2urxm3iu1apt mnviasfs2um(rp;t1olenmfeils aDrl( s t)aexoif iy1fmtelneil(0s2xr(opnydlpenlfci t sDtm(rp;u4tetoiietydfs2rmuvs;(4aexoiociatlaD  uvo;t)tetm(rpoo4op n feta()s2rrx ooo1alxo feiltla el(mo;t0 lxoif totom   n s ()seum(o no1lmenmiet tfaDumu o;u0alenmfeiatfsDuan s;(0tlerxf3ta1oa eauei t)texmir3iydaptn fvt t sDtmxmono4aeto oetaslm um(vo (0teenio3tatfp r ieo;s)t2xm(m oudlm nmnesltfsrtrxmpno4oexn o3iaslsDrmnvsn(4alenmfctotoatraiesl()srxoxr ou1apeemieil()s2trxrp;t4tle ifeiad s rmn onu) lermfciytoat  ieilt sexr(rpny4lmtemfcia(fsrraurpno1alt ifcilt aDemuvsnu4 rxnxf iydoa eanvs ()sexr(m3oydol eliviatfartaxmpot4oltn f3iytlmDelnvo;()texrmo iotomDrauvo;s0 rtmxr ny1optelieil(fs2urx  oo4ale ioetas m rmnvp;()alxomrcoydfmtraueilt0 etrxm iy1op e icslt s2uaxmo;o4teeniieiat sDrlu p;()altrif3totfmDean s;(0tetrxm nu4opt  fes t)a2raumpnt1oee mictltlm2uln o (4trxnxocta1faDe u sls)seumio oydomenmivslt)aDururpou0tetnmfeiad a2ranvsn(0 rxnxo oatfa elnei t0truo(m3iu1lpen fetat aDtm(m nu4tlxo feilt a2ra(vo;t4aeenmocoadfa e n o;t)srtoir3ou1am nlieias)aruau ont0opx io3tyt mDelnms (4trtrir3ty1lpDrlnei t)trxr(m ny4lme  fvs ()artmx  ;o1tptn ieild sDuau s (4tetrxf tytfat livo s) rxr(m3nu1op nlfcilsfsDtr(mo;o1tlxn oeiytla umumo;u) etrmf tadfatean s;s)texoim iu4amenlivia( a2rr(mpno4opx ifciltfaDumuvo;(4 reoiocoa1fm   neslt  rum(rpio1openmietas srrau pou4opxnmfetasls um( p;t)aeerxo3tydfmtraivi;()t2xmirpiy1ll  miet s)arum(mont0ale mf3tytfs rmums u0aetnmf to1oate ues;t0texr(m3iy1am  lnvslt) 2rm( p;t1aex ifctys s elnvsnu) renxf ty1fp rln ilt srurxmpno1al e fci tf Dtax pno1tee  oetld s2emu onu0 rermo3oa1opD  i o s  rum(m3iydlmtnlfvt (fs2ua(r nu0tee  oeiyslmDrl(ms (0 exoxr iatopDr neo;t sruriopno1am  lfet ()sDuaum no1opxoiieiys s rmn pnt4trtrir3totfm rlivilt0 2tm(opoudoptn nesa(faDurxm oo1olt if3iydfs2um(vo;u0trxrio3totopt luvo t  exr(r nudapeemfct t) 2tmxrpot0oee if3iyd mDrl( s t0tlermo3iatopDeaivi s0 exrimpiudopt lnesatfa2umumpot1teeoiociadls2eln o;t) leomf3todop eai s;s)s2ur(r3iu4ol nmivia()a2uaxr oo1oltnmo3iyd s2ra(mpnt0teenmrcoa1fpDe i i ( trto(m iudol n ncs sfs2umx oot0oexn iciadfm uln pnu)teeoxfciadlaDe uvils)sexrxo3nodame  ivsasf rtmx pnu4aexnmi3iyd sDemu p;()aleoifciytfp  ln s ( texriopnydlp elivt sfs2rr(roou0tlxo f3tytlm2ranms;u)aleoxo tydomtranvs ( s2xo(rpiu1ol e fesl(f Dumum nu4olenmoeiadls rln ont) renxf totoa rlnvols)t2to(opny4lmeemfcs tfsDur(mpno4oeenmietytlsDuaumont)areoxfctatlpteaivols0 eto(m3oudlm nmfetas a2rm(  oo1ope iictad s2emumsnu)alerxf oo1la eauei s0 2xrirpny4lptelfci (  2urum ot4aeeomoetatfs emn p;()tlxoif3totop r n s ( sruriopoy1lpenmncils) rrmum ;t4opeo o3tld s2rauvonu4aleomrcoa1fp  livi s  rtoxo3nodom   iei t)aDtrx poo4aeeniietlslm2ea(mp;(4 etoxo3oadopt au o s t2to(opnu1al emnetls  2urxmpou1oeenmf3ilsfs2eanvo (4 lxnifctadopt  nei;t)teuoxmpiy1oltnlnvi (f rrrurpnu1oex mfeiadfs ea( o u)tleomfcoa1fmtraivi (0s2xmxo no4ol n icslt)s2rmum ou0oexnmo3iltfa rm(von(4trtoifciatop eluvs s0teum(r no4opt miciasf 2tm(mpnt0oltnii3iadlaDumuvs (4artnxr3oodomDrln s t0sexrio3ou4lptnmnctl( a2ra(r ot4teeomoeildfm ran o;u)trtomr3tadlptrlneilt0texmim oydamtnmnvilt)arraur ot4opxomiciyt s rm(vo;t0 eenxfcoa1la e iei (0 rxm(mpiy1lptnlivt () rrrxrpno4aeeomo3tyd sDuanvp t4 etoxocoytfpDrai o;s)trumxopoodlp nmfvt () Dumurpno4aex  oeiadfmDrmnms;u0 reoxf3ootop e uvs s0setm(m iudlpte fei t artaurpno0alen oeiadfa2eauvsn(4aleomo3iy1fmt an sls truoxo iy1aptelfct sfaDua( p;t4tptomfciasfaDrluvp;() lxnxf3iatlaDelu i;()texm(mpiydap nlicil()s2tr(  ;u0tex iieiadfaDuan p;(4 exrxr oytfmDelu i;t teumim oy1omtemnvs t aruaxroou0oetomf3iat mDul( s t4 rtrmr ta1fpDrlnei (0seto(o3ou4omtnlfci tf Dum(m ot0opxo fctaslmDeau sn() etnmrciotlp   ieslt0 rtrir3ny4ll   feias)sDur(rpno4oet micild a2umnvo u)aetomo iatfmt lu i;s0 euo(o3oy1op nmicsa()aDtru p;u1tpt moeiytlaDrm(mo (4tetrir tatfptr ivs ( setmxrpny1omenmfcs t)sDtm(r nt0aet mi3iydfmDra( o;(4trtomr totfatr ueslt s2toxo3io1ll emfctasf 2rm(r nt1tltomf3tad mDrmumo t4aexnmfcoatfmtraneo;t)setm(r3oodaltnmfctatf Dtaxrpou4tleomf3tyt s2eln o u0areomf iydlatrlu olt)trxrxmpou1altnlicil(fsrtm(rp;t4tpeoifctytlaDrmn p;u0 rtrmrcoy1oaD  u i t)tetoim nudoleemnct tf Duaxr nu4tee  o3iasfmDum(mpn(0tlxnxo3io1lm rlieo (0 2tmim oy4lltelfvtl(  Dumuroou1tptniociytlm ulnvp u) reoxo oo1lmD  ivi;( srumxmpoo1openlics t artm(mp;t0alen feiyt m eaumo;u)teeomrcia1om elneo;s0t2xrxo ou1omtemfcs t  Durur ;u1openmiciatlmDraump u4alerxr3iadlmt anvs;t setmir iu1optnlivi t)a2umurpot4opxomfeiltfa rlu o;u) lenxr3tadoptran s;s srtrim iy4aptnmfcta( sDta( poo1tex ifeilt aDel(mp u4alxnmf ia1lmtelu i;s0texoim3oydlmeemicslt a2rru p;u1opto i3iltlm elu s;u)texrifctydfm  aivs s)s2umir no1amtn ivt sf rrm(mpou0tlxo ocias a ul(monu4arxoif3oatom eai sls0 rtm(rpiu4opt miesls)s2umu  ot0aetn i3iadfm rl(ms t0trxoxfciy1fate ivi;(0 2uoxr nudape micilsfsDua( pnt4tlx mi3ilt s2ua( s;t4trxomrcty1fmte ivo t) rtr(rpno4aptn fet s srra(ro;t4olxn fctysfmDuaumon(0 etomr oytlmt lieo t0srxrxopio1apeelivias sDtm( pou1altnmfeiydlsDrm(mont)altoxo oydopt auvo (  2toiopoy1oltnmfeils)aruaxr ;o4tptnifctatlm um( s;t) lenio oytlptelu s;()s2to(m3oy4ll emfvsl(fsDtmxmono1olx  ociad s2ua(vs ()artrmr ty1faDr ueils0trxr(mpoydap nmiei s)sDua(  ;o0apxn f3iatfm emumo (4aexrmrctydlpDe ieslt srxmxopiy4ap  liei s)sDtrx p;t1tet micias a2raump;t0aleoir totoptrai ol(0 exrir nodlm emicsl()artrum ;u4alx  ociydla umnms;(0 rerxocoydfp eanvo;( teumir3iodaptnmnvtlsfarraxroou4oetnioeildls2eluvo (0altnmr ty1lptrlivs t) 2urxm3nu4omenmivi s)s2rau ono4texoifciltfaDua(vpn(4 rtnio3oo1lmt livol()sexrio ny1om   fvta(fsrra(ro;t1altnioeildfm2eau p;(4tlxnxo3iodlm eaues;s  euo(opoo4amee nvtas  rtmxmono4tpe iieiadfa rauvp (0teerif io1laDr u o s t2ur(r nu4ol  livilt a2raxroot1apeoii3tasfm ea( s (0 exoifcoa1fatrlneo ( trtmxrpnodlpe mivslsfsrumxr nt0oltn fciat m2elnmpnt0 exnmrctydfmteaieo;()teto(m3nodlpe lict ()s2ur(  nt4tltnii3tldlm2ra(vs u0aetoxf3iatfpt livi;s)tetr(mpiy4ameelfet ()s2uaurono1aetnmi3ilsfsDuauvo;(0alenifciy1om  au ols) exoir io1lpte netltfarrm(m ou4aptnifeilsls2rmump;() rtoxociotlaDr ies t)s2tr(r no1ap emfvt tf rtaumoou4alen f3iatls rm(vs t4 lerifcootfmteau o;s t2xoxr3nu1lmt miei ( s2rmx pnt0aex  ieild aDumn s;t0altnmrctytlmD  nvs;(0srtoxrpou4apeemivsl(f 2rrurpoo0aetn i3ilsls2ranmpn(0tlxrmfctydopD  ieo;t0srum(r3iu1alte fcsa() rumum nu1ope  i3tatlmDran o;u4 rtomrcto1optr u ilt texoxm3nudlltn fctat s2uru  ;t0tpxo ictad m2umnms t0tlerir3oa1latrauvo;t)sexr(r iu1omtemieta(f rrrurpou4aex  f3iadfm ul(vo u0aetoio3iatfa r uvil(0srurxm3nodam emnciatf 2trx  ;u1ape ifeiyd s2emuvsnu4 rxnmr iadlaD  n ol()seto(o ou1lmeelivtas a2rau ooo0tptomfctat sDeauvp u0trxrxf3to1omDelneo s0srtoirpoodolt  ivsa( srur( ont0aexn feiadlaDulnmp t)tlerio iadfm r nvi;(0texmio3ou1altnmnvslt)a2raxrpno4tlt mfetldfmDum( s t0 rtnmrciydlp rauvslt0srtoir3iodlmt lict (fa2raum no4tpeo f3iydls2ea(vont4trtnir ty1la r ivslt)t2umir3iydoltnlnei s aDuru o;o4teenmi3tls a emnvonu4trtrmo iy1fm eauvo t tetrxr iydll nlivsas artaxr no4tpeomi3ias s eau p t0trxnif tydfa e i sl(0sexr(r ny4am  mivt sfaruaum ;u1texomietat m rln onu4tlxnxo3iatlmD auvsl(0s2xmimpiudale lnvi t sDtax o;u4apxomf3iys mDrlnmsn(4 ltnxf tytoaDe ieolt t2xm(rpoydap   ieils  Dtmumo;o1teto ociys s eanmsnu4teenif oodfm eli o ( trumxr3oy4ope  ivil(faDraurpnu1tetoifciltlaDel(vo t)arermf oa1laDeluvolt0s2xmimpoo1lptn fes ( srtrumono4tpe ifcias mDuanms;(0arenxf3ootla  lu s;t)teur(o nudoptnmiet (fs2tru p;o4aeenif3iatfaDelnvsnu0trenifciatlm eau s s0teumir oodam nmfvt tfs2rmumpnt0olxn fctldfs uanmsn()altoiocoadomDeaivs;( srxrim3oy4om  mivt (  rtr( ont4apxn iciatfm2raumo;(4texomf oatlmt li s;t  2urxopnodapenmfvta( s2ururont0oleo ociys mDul(vsnt4trxrif iydomtelivi ( s2urxr3no1ape  icsat aDtmuroot4texn fciys s ea(vont)teenifctadomD aivi t t2tmirpiu1ol e neil(fsrtrump;u4optniieiyt s2ea(ms (0 reomf oadlptrln s s)srxmxm ou4amtn ivil() rrm(  no4apx mociysfa2uauvp t0tltrmf oydoatr u s s)srur(opnudlleemfvia( sDrm(r oo1aeenmfetysfm2uauvp;t0 eenifcoatlm  lnvs t0t2ur(m iu1lp nlncia(  2rm(roou4oee  ieiysfaDranvsn(0 exnxo iadfp   n i;s0 ruo(r iu1omen ivtl()arurx pou0opx io3iydfs2ranvs (4arxomo3iydlmt  nei;s0 2xoxo iydamtnlfctlt a2trx p;o0opt  i3ilsfaDrln o;u0texrxr iy1omtraivs;() 2xoimpiydope  fei ()sDtm(monu1oexo o3iatfa uln p u) etnmr to1fatrlueo;(0 rxoir3oo4amt lfetas)srum(  ;t4tet  icildlaDrm( s u0 rerifctotfatelu i;t)srxo(m3io4ope  ncil( arrrxmo;o0alxoifciyslm rluvs u)texrxr tydlm rau sls texo(r oydaptnmfviatfaDurxmo;t1oeenmietldls rl(vp;t) eerxoctotlm  ln i t0trtoim oodopenmivta( sDtmxr ot4oex  ocilsfs rlnvp;(0trxrifcoytom eauei ( t2uoiopio1olen ncsatfsDuru p;o1tetoiieiat s2rmnvs t)aexoxo3iatfm rlivi;s0teurimpoy1ope mneiat srrmumoot4alen f3tasfm2rlu pnu0 ltoio to1la  luei;t teum(r io1ol e nvi s artmxr nu4aleniictatlm eluvs ()arxoif to1fat lu i;()t2umxo3oo1ll  lnei ()aDtru p;u0aex mfetydlm2uan snt0 renxo3to1fm   nei ()trtrxm oy1lmeelfcils)a2tmxrpnt0apeo i3iyd aDra(vsnu0alxoxr3tytfpDeauvi t)s2xoiopou1ap e ies ()sDum(mp;o1opxn oeils sDea( p (4tetnxr3iy1lp rauvilt setrxmpiudap elneslsf Drm(mo;t4alx  oetysls2rlu snu)arenxr3tatomDr nvi (0setmir oy4openmiesl( arur( pou0oexniieiatfm2rauvpnt0tltomo3todom ranes t teum(mpoydlpeemnvta() 2rax p;o0aptnmoeiadlm2ul(vo t0 reomo3totopDrluvi s) eum(o3io4aptemnei (fsrum(rono0ale ioeiytfa emump t)texrxrciotom r uvi t t2tmxr3iy1lmte ictls)a2tm( o;t0tptn ociys aDemn o (0altoio3tatopD aueo s)t2tr(r3ou1lmtelfvt t  rta( ooo4opx moetldfs ulu snt4trtoxoctatlateanei;t) rtmim3oydlmen feiasf 2rru  nt1apenmi3iyd aDuluvs u)arxomociatlm rlneo t)texr(m3oodopee ics tfaDrru oou0aexoioeiydls raumsn() eerxoctotopDraneolt) ruoirpoo1omen ieia() Dumxmooo4apxomfeiatfs rluvo;t4aetnmfcia1lptr n i (0s2urirpoodoltn nvs ()a2tax  ;o0openmf3ilsla ulumpnt4 lxnxr oydfa rlueolt0trtrxr ou1lm n iei (fs2taxrpou1tpxo oeiyd aDeanvon() lxoxf tydoaD  ieo s0t2umxr3iu4al  mnes ( aDrmu  ot4olx io3ildfs ulnvs t)arenir3tatlm   neols  2tmxm iu4alt  ivtl()a2ra(r ot0tlxomo3iatls emumont0tetnio3iadfateanei s srxr(opoy4apenmivi tfaDra( p;t4oetnif3iys m uaump;u4altrmo3oytfm r uvilt) 2xrio3oy1lmenmnvslt  rrrurpoo0optn ieiydfmDul( o t) rtomr oytfm e u o s) rumirpoudamtnlnctl(f Dtr(rpot4tpxoif3tltfm2rl(vonu4texomr iatfp  lneol()texoxopno1alt mnci () rtmxmpoo1oeeomfeiytls uln p;u0arxomoctotomDrauvilt texr(rpou4am n ietatfarraxrpno0alen feild aDranvp t)trenxrciytomtelu s s0 rtm(r iudlmtn nct s) 2tau oou1tptomfcilsfaDeauvo;t) renmfcoydla rli sl()sexr(mpio1lm n fct s) 2umxrpou1aeto ieiatla2emn onu)alxoxr3oo1fpte i sl()srxr(rpiy1ap n fvtltfa2rmumono4olenif3ildfsDemu p t)tlxnio3tadfmteaies (0t2xoiopou4om emictlt)aDrax  ;o4oex  o3iydfa2el(mo u4arxoxf3oodfptrlnvo t0 etrxopiy1ope liesltf Dtmumoou4oex moeiytfaDua(vpn() reomf oatlptraivs;t)teumxm ou1amte nesasfs2tm(mpou0teto ociydlmDelnmsn(4teeomo iadoaD li slt0 2trxm3no1olenlncslt) Dur(  ;t0tlxoiocilt m ul( s;t0alerio ia1lpDeaneo ()trurxo nudapenmiviatfsDumumono4ape  oetlt s ulnmo u)teermo3tadfp  ln ol( srxrxmpnudapt lieias sDrrx o;u1aeto f3ild m2emnmo u)trxrxf oo1fpteluvo s0setr(r no1apenlneslsfsrtm( ono4apxo f3iysfm2el( pnu4tlenxrcoatlaDeaivo (  rxrim3oy4apt lfet s)s2rrxr ou1tle  feiatlmDem(msnu)aeeoif oytlaDran s;s) rxmxo ny4lpeelnvilt  ruaur nt0ale mi3tys s rlnmsnu4tlenif oytfptr ueolt) rumxo3oodal nlneia(fsDrm(mpnu0apxnifetatfmDea(mo;t0 rxomrcootfp eaivil( t2ur(rpiudamte ies tfa2rax  nu4opx mi3iltlmDua(mpnt0 rermf ia1fpDe ieilt)sexoxm no4lp e icsa() Draxmonu1oee ifetasfs um( o (0aexrio tydla   iesls)srxmio3nu4ll e nvsl(f rrm(rooo1alto oeiat s2emn pnt0 ltnmrcoadlptelies;s0srurim nodlptelics (fa2ua( p;t4aex  ociadfm2umuvp u0 exnxo ootoatr nvs;s s2urio3iy1op nlfvtasfs2rrx o;t4oeeomoctys m2uan s u)tlenir ty1lpt liesls0t2xrxr3oudom  lnvi s  Dtrxroou1alto fetysfm2elumont0altrmo tytoa eanvsls)srtr(r3iy1om   nes t) 2tmurpnu4aeeomociatlsDuln snt0trtrir3iydfmt lu ils0seum(o oo1apeelictlt  2tmu pno1openioetys sDea(mp t4arenmo3iotfpD lnvo s s2umxmpoy4oleelicias a2tmxmont0texoioeiltlmDra(vs t4tetnxr3iy1lm eauvi s)setrir iydllenmies (f 2tr( poo0aetniietaslm rlums u) renio3tydfaD lu s;() rxo(opoy1am emfcia(  rtr(mp;u4tet mociadls2umuvp u4altoif oydlptrliesl( t2uoiopou4lm   neiat  2uru pot4aexomf3ildla ea(mpnu) ltoifciodlmt  u o;t0sruoxrpoy4lp nliciat) Dta(moou0tee iieias sDrau o (0aexomociadoaDe ieils0trtrxrpoydalen nctlsf rtr(mooo4aex  fcias m el(vp (4 eeoircoa1fmteauvsl() ruoxo ny4lmeelicils arumxro;t4oltoii3tasfa ea( s;u0 rermr iatfpt  nvo;(0teuoxrpio1lmtnmict tf rrrump;t4tpxnmfeiltlsDeaumpnt)alerxf3oo1op eai s s sexoio ny4omt  ivtl(f 2trxr oo1apxnmfeils s2um(vs u0 lxoifciy1fat luvo ( seuoiopoodalte nvtlt) rtaxmono4olt mictltlsDeanmsnu0 rtnxf iodfpD luvol()t2xrio3nu1oltnmfcsasfaDtmu p;t1optn oeiat s2em( s;(0tlerxo3to1lpt aieo;s) rtoxm iy4omtnmfvt sfsrrruro;u0tet  feiatla2rm(mp t)tlxomo3iotoaD  uvs;t)truoxrpiy4llenlfct s  rrr(moot4apx ifciasfaDrln o u0 lermr totlp e ueil( trtrio3nu1omtn ivia( srtr(mo;o4olx  o3ilsla2rm(vs t0alerif ty1omDrlnesls)setoxr3nydal nmnciltfa2ur( pno0tee mieils a2eau s;(4tleomrcoa1optrluvil(  rtrxm oy4lpe lnvi tf Dtrump;u1alt  fciydfa umump;u0tetomf oadfatrauvils0 rxoxr nu4oleemivtlt)sDrmum no0teto icild a2ra(von(4alxnif3oodoaDe i o;s  eum(rpnydlmtn fesl( s2tm(m ot4tlt  feilslaDran sn()alxnxf3oadomD aies s) 2xm(rpiu4lptnlfcsl( srumx pnt4oexoiieiytls eanvsnu4aetniocto1fm r n i s0t2xoio ny1ole  fvsat  Dtruro;t0tlt  ietyt mDul(msnt0trtnmrctotlaDrauvi;s0 rxm(rpnu4am elfci s)srtaxroot1optoiicilsfmDuan o;t4trxoxr oadopt  uvilt0 2uoir3nu1llte ivs (fsDraxmp;o1apt iietydls2el(ms (4areomo iodlat li o s  2toir nu1amt  fcilsf rrrump;t4oex mfciydlsDrmn s;(0 exomr iotomt  ues;t) 2xoxopoodam e fet () rtmxr ;o1tle mictls s rmumo;t)tetnmr3io1omDeli s;t0tetmxo io4lme mfvtl()a2tmumont0ale mfetasfa2umnvpnt0tlxoio3oydfp eliei;s teuoxrpnydapenmnci (  rta(r ;u0tex mfeils s eaump;u0artrmf todlmDrai o s0s2ur(r ou1lptn nvtlsfartrxr nu0tleomo3tlsla2ra(vsnu)tlxoxo3oo1laDelnvs (0 2tmxmpoodolenmnvslt a2uax  nt4aexn o3iadla2rmnvsn(4 ltnxocto1fm rlnvs;s)s2um(rpoydam nlictasfa2tr(rp;u4aexo o3tlsfmDum(vp;(4 renxr3tatlmteluvs t0 etm(m iu4lle  iesat) 2uauroot0tee ioeiys aDumn onu4arerircoodom  lu o;(  etr(m no1apen nvs s aDrmur ;o0oetn ieiaslsDul( s (4 ltrmr3ia1fptrauvs;t0teumxo3iodopt lnvs tfsDurxrp;t1oeeo o3iadfaDra(vp (0texnxociotfpDran o;s)srtmio oo4aptnmnvsls)s2raxr nt4aetoiieiasfmDul(mon(4 rtnxfciotlpDeli ils0texmxopoy1lm elieil(faDur(mpno4olxnmo3iydls ea(ms;() eermf iy1fm elueslt s2xoim oy1op elfcia( srrm(rpoo4tpen f3tlsfaDrm( p;u)aeeoircoatlpDe uvs t t2umxopio4lm nmiviasfs2rr(  no0aptn ociatlsDemuvs t4altriocoytlp eaivilt0 rumimpnydlme  ivtatfaDrmur ot4apxomo3ilsfsDrlnvo;t) eerxf3ootfa rluei t)seumxr3nudll  mfvtlsfsrtrxrp;u1optnifciatfs elu p ()tlenxf3oy1fa rlnvi;t0s2tmxopiu1ole mnctatfa2ua(rono0apenmoetydfa2rm( p t0arerif iodomDeaueo;(0teumio3io1lltelncslt a2rmx  ou0oee mieilt m umn p t4trxoxrctydlmtr nvol(0 rxrxo3oo1amtemnvs t) 2rax  ;u4oetn ieias m eanmpnt0teeoxrcoadfa rlivi () ruo(r3iodapte ietasf rrr(  nt1tltniociysfa2ran o ()tetoio3totom  lies;( t2xm(o3iodlpeelfet s  2uauro;u4aexo iciadfsDrlnms t4 rxomocty1lmt  uvsl(  exoxrpiu1lptemfviatf 2uaxmp;t4tee if3iydfm ulnvonu4 rtoxo3ty1fa rlnvslt)trxo(m oy1al nlicias)srrmur ;o1opto ieiad mDel(mp u4 exrmo iatlaDe ies;s)teto(m oudam emivia(  Drrxroou1optnmfcils s2raumon()alermrciodom ean s (  eumxo3nu4opt  nvi s) 2ra(rpnu4apxnmfciad mDelnmo;(0 rxrmr iatlmt li i (0trto(m ny1ome mncsls aDuaxmpot0ope iiciyd m rluvs;() exoxf oytoptr ivs;t0 rumimpiydlpeemnvs s) Dumxm ot0aetomfctytla rlums () ltrxo3ty1fp  li sls0 etoxo3nu1am e nesas)sDrm(mont1aexo feiysfs elnms t0 ltomo3ta1fp rau il( seumxm ny4am  licilt)s2ua(  ;u1oexn o3tlt a ra( on(0altnmfcoo1fm rlu ol() rumio iudlm nlnesas) 2ta(m ;u4tlx mictad s2rl( o (4aexrmo iydlmDran s;t trxm(opnu4ll  mnet tfarurumo;t4opeo ieiltfa rm(vpnu0 lxomf3ta1lp ean s (0texrir oo1opt  fet (fa2trxmooo1oetoif3tysfm2ulu snu0teerif oy1lmteanvo s)sruo(m3iydlmenlfcsas)a2trxront4olx mieiytlsDul(vonu4tetnmocto1opDraueo;( srtmxm oo1lmenlncsa( a2rm(mp;o4oex ioeilsfsDemnvpnu) rtomf oytomDelivi (0 etr(o3ny1aptelfci t  Dtax p;t1tpeo f3ildlmDumn o ()alxoioctotfaD aneo;t0tetoim oy4ameelnciat)sDuaum no0apen iciatfa2ua( p;(0 exoiocoatfpte neo;t0 ruoir3nu4optnlieias sDuaxrpnt1alenmf3iyt aDumn snu4aetnxrcoadfmD  ues t0t2um(m3oudop nlfeilt)sDrmx p;t4opxnmociytla2raumsnt)artnxociytfmDe ies;(  etoirpoy1lp   fviltf Dur(mpot1texnifetyt sDelnvsnu4 etnmf3ty1lptrlnvs;() rtr(rpoydam   fct (  rua(ront0aleomf3iyd m2umu o u4 etrxrciadlmD lu ol(  rurxr oy4omtnmnes tf rrrxmo;o4alenmi3ildlaDumnvsnt4aeermo iy1laDr u i;s)texmxm oy4lle  ivs s) rrrx pot1tlenmfctas m rlnmpnu4 etoxo3tydfmt  uvilt srto(m3nydamt miesat)a2rm( pnt4oexoio3iltfs2um(vs;(0 lxnxf todfmtr uvsls)seurxrpno1llt mnvs tfs2rrur ;t4optn oetlsfmDul( o u0tltrifcoodfpD  i ol(0srxoxr3nodoptn ici ( a2raumpot1tpxn o3iyslsDeaump u) etomf ty1fptelnei;( setm(rpoodoptemicsls)aDraurpou0tle ii3tyt a eanvpn() etrxoctytlptelu olt trtoir3oy1amte feslt aDrrurooo0tee mfeiadlmDemuvs;(0aexoxf iydoateaneol(  rum(o nu1omenlfcsa() rta(m ;o1tlto oetat aDemnmp u)aexomf3tadfat anei;()s2urxm3nudapt lfeslsf ruru pnt1aexomoeildlsDrmuvsnt4 lermr oodfpD ln i t) rxm(opoy1opte fvs t s2tmxronu4aetomiciydlm umumpnt4 etrxoctotlp  an ils t2urim3ou1am elfvsltf Drmu pot4aeeniictyd s2rl( s;()alxrxfciodfp   neslt  rxoxmpoy4ap  mfes s) rtm( pnt1aeeniociadlaDea(msn(4tlenmf3oadlptrlu o t texmxm ou1ameemiet s s2rmxro;u4optnmfetytfmDua( p u0texnxr ta1lm rlies;t srumxmpiy1amtemnetlt) rrr(monu4opto oetltlm ra( pnu)alxoxo3iotla  lueolt0texmio3oydam  lfetat sDur( pou0ole mo3iadfs2umnvp;u)aetomfctydoaDr n ol()t2xrim3no4lmee nvils)srrrxro;o0altnmictaslaDulums;t4 rtoifcto1laDeaivil(  rxmxmpoudam elivs ()a2taump;o0opeoioctlt s2eanvp;u) eenmf totfatrai o;(0t2xoxm nu1am   nvi ()srum(r ;u4oee mfeiad a2rlnmo (4tlenxf iydopDeli ol() rumxm io4omen fvs t  Dumu oot1ole  feiatfaDelumon(4 rtrxfcootop r uvi t)t2xoxr3oo1ap  mneia( aDraxrpou4open fciytfm um( on()altoxf to1fp r u slt trtrxmpnu1llenlfvsls)s2uaum ;u4apx ioctls mDeauvpnu)tetrmf3tydlptrlu i;( s2toxm3iy4lp n fcsls) 2um(rp;u4aexniieiysfmDem(mp (4 rtnxr iy1lmtr n ols)texr(r3ny4om nmiesat) 2uaumpou4oexoioeiydla uanmo t4 eenmf oo1fmte ies ()s2uoxo ou1om n fvtl( sDur(rp;u1aex  ictadfa rmump;t4 leoxf oa1latr neil( trxrir oo4aptnlfetl(f rra(mont4openif3iatlaDelu o;t0aeerif io1omtrliesl( texr(rpnodopenmnetat sDuaxr nt0tptnmf3iad m uauvs t4aexrmo3oodfmD lieo t  2uoio oy4apt  icia( srrmxrpno1tpe  ociytla2rmnvo u0artnio3oydfmD aueols0 rtoxm io1ap  mfct tfaDtaxrpoo0opt mf3tasfsDrln s;u4 lxomr3oatlaDeli s;t)teum(o3iu1oltn ivsls aDtr(m no1oet mo3tasfaDea(mp (4aeenio3tydlm e neo;t texoirpiudalt mivia(fsDumx poo0altnmoeias a2uau s t) rxrmf3to1oaD  iei;t  rtoimpnudopen nesasfarrauro;u0alto feiytfm2rm(vpnt4aleniocia1fm rluvo t)s2xoxm3ny1olenlfci ( a2uaumont0oet ifeiadfaDel(mo (0teeoiocio1oa ranvo t0trxrxr iudapee ici (farta(mp;t4apxo ieildfs2um( s;(4arxrxr3oo1om r u sls)srtrxr ny1aleeliciat) 2ra(ro;o0olxomo3iytlm2ra(mo;u0tleomr iodfatr u o t0 2tmim3oo1lptemics s)a2urx ont1ope moeilt a eanvp;t0 rxoioctadomt  i i;s  2xmim3iu4am  mnvsasfsDtmumoou4olxnifctaslsDrmn p;u)artrxr tadfmDelnvol(0s2tmio oy1alenlneslt  rtmumono0aetoifcilt s2ul(msnt)trxrmrctytlp  aivo s0 eumir3ny4amen feil()s2tmur ;u0olt if3tytlsDua(mp;t4treoxf3iydlaD  nesls  rxo(o3iudlpenmnei t) rtm( p;u1oexnii3tasfs2rluvs u0 lenxrcio1opt livi;s  exmim iydamtnlivsat)s2ur(  no1apt  i3iysfs2emnmo u4trxrmfciy1optelieo;s) eumiopiydap  lnet ()arrru o;o1texomfetldfa emu s t)tltrmr3iy1oat  uvs t0teuo(mpiy4ll  lieiat a2taxrpnt4oetomf3tlt sDrlu pnt0aleomfcty1lm eluvo s  rtoxmpny4llt mfcs t sDurx onu0aetoio3iys aDumuvo;()alxnif3oadomteanvsls)seumim ny1lpte nvi tfaDta( o;t1aexoiieiys a2el(vp;t) ltoir totopteaivslt0s2tmxr3oy1ome  feta() Dtm( p;u1oeeoif3iadlm ean s t4tleoxf3oadfa elu s;s0 ruoxmpno1ope  nvsls)s2rrxro;u1apxn o3tyslaDrmnmo u0tleoxr3tytom rluvslt) eto(m3ny1ol emfesas a2umxm ;t4ale  ieildlmDranvs (0alenio oa1omDe iesl()trurim3oudoltn ncs tfsruaxrp;t4tle mi3ild a ua( p t4 exrif oytomDraieo;t0texoxr ny1optemietlt aDtmxr ;o1alxnmfciadfs2rlumo (0texrmfcoo1fpt anvil()sexmxo nu4alenmfvt ( arumxrp;o1alen oetadla2ulu on(0arenirciy1lp  ai il() rumxm nydop   ncia( s2trumont4opx iociyt m rmu o;u4 rtnmr3oadfpD lueo;(0 rxoim3iy1opeemfetat)aDtaxrpot4tpxn o3tadfs2rm(mpn(4 etoxrcoa1oatraivol() rumxr3nudam nmfcs t  2uau pot0tle mfeiysls2ul(ms t4teenmoctodom ranei;t sruoxopou1al  livs ()s2rmumoot1tpe io3iadlmDumu sn(0 lerxrcoydfptr i s s)trtrxrpnydopee icsl()aDraxmont4apxn iciasfsDeaump u0 eerifciadfaDeauei ( s2umio3ou1op  micslt a2rax  ou4tet  ictydfsDrluvon(4aexnmo tydfmD auvo t) rxoir3oy4al   ics s a2umxro;t4ole  ieiltfa rl(vsnu0tltnio iy1lm rlnes t s2urxo3oy1alte nvslsfarrau  ;u1aee io3ildfaDeanmo u)aexrmf iy1fate u ils0 rurxr3io1lmt livsa(fsDua(rp;t4oexo f3iltfaDrlu pnu0trtomf oydfa   u s;(  2xrio3oodlp emfvs tfaDrm(monu0aptoii3iytfm ulu p t0texnxr io1op  ln ils0 rtmxm3ny4op nmfvsasfa2taxmonu4ale mfctldfa eluvpnu) rerir3iy1oa r u ilt0 euoxmpny1ole  nctltfs2taump;t4aeto o3tlt mDulu s;(0tltrxocio1omDelivi;s0t2toxm oodamtnmncsl(  Dtrxr ;t1tpeo o3tldlsDua(msn()artomociadomDraies;( srtrio3ny4openlivtl(fs2ur(mpnu1tlxn o3tyt s2umn s;(0aeenir3tatomtelivs (0srumxo3nudopt  fvsat) Draurpnt1tex ifctlt s2el( pnu4 rtrxo oy1fpte i i;s)srxrxrpiu4ome livi sfarra(r oo4optn o3tldfaDrln pn(4 rtoirciatopt aieil(0s2urim3io4apt mnvsl(  Drr(m oo1ape ii3iyt a ulnvp u) rtoifcoo1lpt lu o;( trxm(opnu4ame lncias srraump;t1oeto octldfsDrln pn(0tlenxociodfmDe ueolt0 2toio3io1al   ivs () rtr(mono0aee mf3tyd m2ran o;(0aeenmr iytfm   neils)seurxo oodap emictlt)a2tmx onu4teenifciydfa rmuvo;u4 lxnmo3ta1lp eaivo;( tetm(m oudamtnmnvt ()arrmurpnt4tltomfciadla el(mo;t)aexrxf3oodfaD  n ols0texmim3oodamtelfvtl()srurum ou4olx iieiyt s eluvp;()trenxr3tatop  anvilt)s2trir oydlmt mnci (farua(mont4oltnif3ild m2ul(vs (4 eenio3oatlmD  ivs t0sruoim oodap nmfvsa(f 2ururpnu0tpeomoeiaslmDuan s;(4 etoxo3oytfaD  nes s t2to(r ou4lp  liciat) Dumx pnu4oleo f3tas sDul(vpn(4 etnxrciy1omD luei;s)tetrir3io1om nmfvil(f rra(mp;u0apto i3iasls2emu p;t4tltrircoytfmteanvi;t trtoxmpiudoltelics (fs2uax oou4aeenif3tydla rlnvp u4 leoioctodlpDrlueils)s2toxmpoudlptn ietl(f rrmxmoou4apt  i3tls a2umu s;u) leoiocto1om r neil()srtoxopiudaptnlnvt s s2uaur oo0oeenmfcildlmDrm(von(0tlxrio3tatlatraneolt  2um(mpoo4omenlneiat  rrrumono4oet  fctysls2emu s (4aleoxo3iatfpt  u s;s)s2tmim nudomenlieslsfsDtr(mpnt0apto ociltls2ua( s;t4 exoxfcoydopD  nvi;t)seumio3iodlmeelncsltfsDtmxm ;t1oetomietlt m ea( o u0tlxoxr3todoate u ols truoxo iudoptnmieils) Drmxr ot4tle  f3tysfm ul(vo t4texoio oatfatr n ol() euoim3oydalenmfcsas srrrxm oo0alenif3ildfmDemn p;t0aleomr3iotla rau i;s t2xrxr3no4apt micsltfaDta(r nt0apxomf3iatfa ulnvo u)alxnmr oy1oa rln s t0s2to(o nu1aptnlivt t) 2rau pnt0ale  octysfsDul(ms u0 reomf tydlmtrli ils) 2xmir3oo1olenlietlsf Drr(monu1optoii3iatfm ul(vp u0 rtoio3tadla  lneo;t)s2xmxr iu1lpenmnesl(  rtmu  ou0aptnmoeiltfaDuau s u4altnxr3ootfpt aues t srumir3ou4lm emnvt s)srta(mpoo0aexoiietytlm2em(mo;t0tlxrio3iadfpteanvo;s0 exoxr3no1ap nmfvi sf rtmxmonu4tlt  ieiltfs2rlumpn() eeomoctadfa rluvs t s2xo(o3io4lp   ncils)aDuax ont1apen oetlt sDrlnmo ()aleoio3oy1opDeluvs s) rtm(r3ny1lltemies sf 2uaump;o4apenmoctatfaDem(mp;(4texrio ty1omDran il(0trtmxo3io4ll nmieil(fa2tru ont0alx moetyd m2uluvo;()trtoio3oy1latr iesls0s2xoxo3oodap   ivsls arrmumpnu4apx  f3iatfm ua(vo;u) eermo iatfat aivi;(0 2xm(o nu4ap n nctlt) Dua(  oo4oex ifeils s rlnvs (4aeerir3iydlm rlieo ( s2xoxo3ny1lpee icsls)arum(moou4apt  oeilsls rau o u)texrmf oy1faD aies ()t2tm(o iu1oleelneia()srrm(  nu1oltniociat s umnms ()trxoio iydfa e ivsls teto(o3oo4apenlncia( sDtaxr ou1oleoioeiyd aDua(mp u0aeerirctatfmtrln ilt trxoir3nu4lle lics s  2rrxm no1tee  fetltlm emnvo;u0aleoxr3iadomDrlu o () ruoxo oydop nlieia() 2ua( pnu1ale iocild m emnvo u) exnif tydlaD li ils t2umim ou1ome  fvtl( artmum no1alt mieiatla ea(ms () ltnmrcoydfaDrauei s)t2umxo ou4op n ncs sfaDrm(rp;u4opx  octlt sDranms;u4 rtnxo3ty1oa eauei;t) eumirpoudopte icias)s2uaxm ou4tle moeilsfa emumsn()tleoir iatfmtean o s)t2uoxo3ou1op  mictat) 2tmx  no4apxn f3iad s2rm( o t0alxoxr3iydfpDe u s s srtoir3nu1olt lfcslsfaDta(r nu4olxnmictlt a2eanmo t4aexoxrctadfm r i i t tetrirpou1om nmfesasfsDtaxm ;u1alx moeiytfaDrl( sn()teeoxr3tytfmD lieilt t2xr(m3io1ll elfesls) rtmurpoo0texniicild a2umuvpn(0tlxrxocoodlpDe i ilt) 2toxrpnu1ole  ict s s2uaumpnu4oltn octyd sDrm(vp (0artnio3iatom r nvo;(0 rto(o iudlm elivi sfartmxmoou0oeeomoctasls emu s (4 exnio iytlpteau s s)s2xo(r no1aleemfviasf 2tm(  oo1opxoii3tasfm2um( s u)artrxr3oadfa  li s t0setmxm oodop nmfctas srrm(mo;o1oex mieiytla2uan o u)tlxrxo3iytoaD  i o;t0 eur(r ou1lmenlfetlsfsrum( pou1aeeoiociadls2ul(vo u0 exoio3iydomtr nvils0tetoxo3nudlmt  fvi ()aDurxronu1tltnifciydfs em( onu4teermocia1fat li s () exmxo3oo1altelfct (fsrrauroou4oex mf3ias mDua( o;()aeerxr3iotfmD lnvols)tetmio no1ap   iei tfartaxmp;t4opeomfctltlmDemu pn(0trtoxr3ia1fm  ai olt  rtrim nudape miei t artmuro;o1apxnii3tyt a2rmnmon(0 lerxrciadoa eluvo;(0tetmxmpnu4llt  fesat aDrrur ot1aetn ietyt s2rm(mp ()trtrirctytoa e uei;( t2toxrpiydalt liesa()srtm( oou4ope mo3ils s eanvp;() etnio3iytla  lnvs s t2uo(mpny1alt  nctas  rtm(mo;u1tltoiieiltlm2uaumo;(0tltrif iadfp  lneo;()t2xmxm3ou4lpee fcslsfa2umump;t4apxn fciyt sDra(ms (0tlenxocta1omD luei (  2uoxrpny4ll emfeiasfartru o;u1tlx  feild aDrau o;t)texoxo3tatoaD  ueols)srumimpiy4lmt  icsa( aruaxro;u0olenifeiytfsDua(vonu)aeenxo3oodlpt  nesls texm(m nydoptelncsas) 2uaurpot1apx  i3iat s umn s (4trtrio3tytlmDean il(0setmim iy1apeemivsat)s2um(r ;t0tlxniiciad s ul( o u4treoir oo1oa  an ilt)sexmxopiudaptemfesasfs2rr(m oo0tpe iociydla2rlu ont)aexoio oy1opDeaies;s seumxr3iy4om elnvta(fsrtax  nt4opxoii3iatfm elnvo ()aetnmfcio1lm e nvo (  2uoio iy4omtnlieslt  rum(monu4olxn fcias s ranvo;(0arxoxf3iatomDe nvs;s) 2uoxo oy1om   iviltf rtr( o;o0oleo o3ild sDulnmp u4 ltomf3tadom  au i t) 2umxo3ny1alen fct (f rrr( oot4opx iociyt s2emnmsnu)aeeomr oydfa rlnvs;t0teurimpiy4apenlnci sfs2trurpoo4tlto oetldls rmn pnt0arerio3tatfaDelnvsls  etmio3oo1al n ivtl(f rumx  ot0tetn ieiat mDrmu snt0altomfcoadfpDrluvil( s2xmio3iy4lp e nvt ()arrmurpoo0tex ii3tas m eln pn() lermf oytoa r nvs;t)sexo(r iy1olt mfeilt  Dta( o;o0oeenmfeilsfm2eluvo t4trenxrciy1oa rlu o s) 2uoxopio1ame mfci s)srrru  nt4alx iictysls2ra( s u4altoxo3iodoa elues;s  2xrxm oodll e ivsa() rrr( pno1apt mictltlaDulums;t) rerio3ootlp elnvs;s0setoim3io4op e icsatf 2umxrono0tptoiietltfm2raums u) renmo3oytfa raiei t) 2tr(mpiu1ll nmnetl(fs2ra(mpnt0olenioctld mDrl(vs;(4tlxnxfciydfp  anvol()s2tr(opnu4alt  nvsl() Dtru o;t4optoii3tldls ulnvont4tetomrctydop  auvs t0t2xrir oodopee nei ()arur( p;t4olto o3iyd s2ran snt0arxnir3tatfaDe ivil() etrir oydlpte neils)s2ur( pnu0olenifeilsfa rmumon(0alxriocoo1opD  ivo () 2trxmpio4optemfcils) rum(monu4aptomfcildls uluvp;(0aeeoiociodlpDe ieslt0t2xrir ny4omen fvi s arrr( p;t4aptnmo3tldfs rl( s;u0tlenxfcoo1lat liei (0 2toim3iydlle liet ( arur( ono4opx iictlsfaDelnmpnt0 rxrif oo1faD aivs t  etm(opnu1optelfvs sf 2ra(r ou0tpto oeiydlsDean o u)alxnmr iy1lmt  nvo ( texo(o io1ole lfeilsf 2tmumoot4tpeomfciltfsDrlnvsnu)teermo3oodfmtean o;t srxrxo ou4lp n ncta( sDrrxrpnu1tptoiociasfm ul(vsnt4 rtrxo iadfpDr uvil()trtoxr ny1opt lncta() Dta( o;o0teto i3tys a umu s u0aeenmo oatopt lu ilt) 2umxmpiu1lle  ncil(f Dra( o;u1ole ioeils a ea( pnu0 rtnmfcta1optrlieolt setrir ny1lm nlfei tfaDumx ono0alxo ieiat a ulnvo u4aeenxociatlptrli il( t2xr(o3nu1opeelietas  rrru  ;o4altomoctltfs rmnvo (0trxnio oydopDe uvols0 2urio ou4optnlict ()sDrax pnt0ope mfcilsfs2umuvsnu4trxrio3iotla  ln ils  2umio3ny1lmeelicsa(  Dtmx p;t0oexniietatlm2eluvo (0trxrir oy1fat an slt0srxmxrpoydomenmnvta( a2trx o;o4aleomfeiytls2rl(vo;t0arermociytfate n o s sexrxo nydapte nvtls s2uaxmpnt1tlxoiocils m ulnvp () ltrmrcoydfa  aues;(0 rxrir iydlptnmnetl(farrax oou1tlto ictlsfa em(msnu4altoxociotomDelivs;t0t2uoxo oy1lp   fesat aDurx pnt1alxn ieiltla ulnmsn()artrmfciydlateli ils  2toxm ny1lm  mfcias)aruaxmonu0opxn feild a el(vp;(0tltnmrcto1oate ieil( srxrxo3oydlmte fct t)a2rmur ;t4tpen ocildlaDemn p (0alxnxrcia1fptelu i (  exrim3oodlm e icsa() 2trum ot0opx ifeils m eauvpnt0tetnxrciatla elnes s s2urim3oy1lmenmietls)a2tau o;o1aex miciyd sDuanvsnt0tlxoirctytfa   nei ()sexr(o io4amtelfvt ()aDtmurooo4tlenioeiadlsDuluvo t4 exrmf iydlp r neil(0t2to(o3iy4aleelfviltf 2ra(rpot1texnmf3iys aDum(msnu) leoifcio1latrlu s;s t2triopnydamee fei () rrmu  nu4oetnmiciadlmDraumo;(0aetoif tydoa eln ilt)t2um(o3nudlltelfvt t) 2rm(rpno0tpx  fcilslaDum( p t0 exoif io1omD  ieol( srxrxm3iydop elnci ()s2um(r ot1olxnmo3iat mDelumon(4tetrxf3iytfp rlnvslt s2xrim3iydaptnlfcil()sDur( o;o1apxn fciys s2elumo;u0 rxrxr tatoatean i;t)t2uoim oudop nlncsas) 2rru  no1oeeo i3ildfs2ea( onu0altrxf tytoatrli sl(0 eto(m3io1ape mfet t)sruru  ;t0optomf3tls s2rlnvs;(4arerircoy1lm elnes (0seuo(rpou1aptnlfvilt) Dtru p;o1oee mictasfm2emu p (0 lenio3tatom eauvol(  2um(m ny4om emictlt sDumur ;o0tlxo feilsfsDem( sn()tetnmfctotlatrln o s0 2xr(o nu1aptnlfci ( artau oot4tpxomi3tadlmDemnmo;(0 reoif iatfp eli o;()s2umxrpiydap elivt sf 2tau pot0teeniiciadfsDrluvpnu4 lxoxf3oodlatraivol( srumio3no1lpenlivias a2ururpoo1oetnmiciatla2emuvp ()tlxriociodfpD anes (0sexoiopiu4op nmfvsls  Dumumonu1tlt  oeiltfaDrm( snu0 lenxociytfp raieslt)seto(o3iu1lm nmfctatfaDraxm nt1opxnmoeiys m2rmnvo u4 reoir iadlmDe n o t s2um(r3oo4omenmictlt) Drmumoou4opxnioetyd a2rmnvp t4tlxoxr ootoateanvil(0s2tm(o oodlmt  feilt s2taurpnt0tptnif3iltfa rlnvs u4aexrxo3oatlaDrln ils0s2tmxr3oy1oltnmictlt)s2uax pno4tlenmf3tat mDrmnmsn() eenmo3ta1fmDeaieo t)teurimpnu1lm nlnesa(fa2urx pot1tpxnif3tytlm2uauvp u) etoxf3iatoptrli ols)trxrirpoudaptn fetasfarumxmpnu1tpe  ociys m rl(von(0aleomf3todom  luvs;s)trxmxo3iudlle  ivtatf rrr(m no1opeomf3iasfm2uau snt4tleoircoatfm  li olt)s2xrim3iy1ll n iciat sDtm( ont4apxniiciltfm emn ont0altoif tadoaDeanvo t trto(rpou1lp  mfvilt  2urxmoou0aex  oeiat mDel(mpnt4texrirciatfmDelneo;t0trurim3iy1oltnmfctltfaDtm( pnt1texoiocilt s ulnvp u4 exnxr3totoatrln o;s sexoim nu4al  mietl()arrru  ;u4tlxomoeilsls2umnvo t)tltnmr3iotoaD  neo;t) rxmxo3oy4omenmfvilt  Durxm no1tlxnio3iat s ua(mo ()alxnxr3oodfp   u s ()texr(opiudomenlics t  2rmurp;t1tlxomociydlsDeauvont4altnxf3to1fm e n o ()tetm(m io4op  lnviltfaDtmurp;t1opxnmo3ilslsDuanms ()arxoxr3ootlaDrln olt0tetoxrpny4al elnesatfaDta(mo;u0tpt  ietlslsDuau o;(4tlermo iodopt au o s)trxmxr ny4lpenlnvi s artm( o;t1optnif3iatfm elu p;(4aeenmo ootfatr nvi;() euoir oy1omt lfes t)s2umx oot4altnmicils sDrlu on(4 lxoir iotlp eau s t0t2xoirpoy4lm  liet (  rrr( pno1tpeomi3iat a2uaumo u) rtomr oa1faDelu s t0setm(m oudop emiviltfsruax pnt1teeo oetadlm2umuvont0tleoifcto1la e iei;() 2tr(opnodlptelfvs sfa2tm(moou0olx iiciys s2uanmp (0aeerifciydfmtrau i;t sexoxm3io1ol n ieta()srrm(m ou4oltnii3iytfa2eaumo;()trtnxr iydfateaiei (0setr(m iy1ape lieia()artru pnu0tlt  feiydlm2emn p;t4 leoxfcia1la r i o;() 2ur(m oo1ll  lneta(fsDtaumono0olx mo3iytlsDuaumo t0 lermocta1oa   uvil( seumxo3iudolen ieia(f Dtaumpou1tee mo3tasfa rlnvs;t0texrxrcoydla   n ol( s2xrxmpiy1lp emfesls sruru  ot4oleoifetatfsDumnvs;u4aetrxr iatlaDrln olt  euoio oodolen fviasf rrmxm nu0apx iiciytfs ra(mo;t0areoxoctatfmDe uei ( sexm(m3ou4lm n fcsltf 2um(mpnu1apxo feiltfsDeanvo ()tlxrioctytoat li i s trxo(mpno1oleemnetl(f Duaurpnt0apeo icild a2umnvs (4trtrxf iadlpD  u olt0trtoxmpiy4am  lnes s  Dta(rpot1aptnmo3iadlaDul(ms t0alxnif3oydoa r iei s)trto(m iy4aptn icia(fa2truroou4tlx ii3iat a2um( sn()aexoifciatfaDran olt) eto(rpiu1apeelfctl(f Dtm( pnu1olxoii3iadfa2rm(msnt0trtniociytfaD lu i;t trtmio nu4lpte iei t)sDum(rpno1tlx mictltlm2umuvp;t) eenxo3tadomteanes;t t2uo(r3oy1lptn icil()a2rmu p;u0texomi3ildfa2umu onu0 rtomfcty1lmDrauvol(0 ruoxmpio4omen ncsas s2rrumoot4olxnmo3iadlsDrm(msn(4 lxoio oadoaD  ivo t)texrio3nudamt mncilsf Dta( pnt1tetnio3iytlm2eln o (4alxrmr oydlpD auvo t  etoxr oy1lmee ietlt) Dtax pot0tpeo fciydfs ulnmon()artrir3oatfp r u i s0 etoio3oo1opeemfet sfarraxm ;u4tlt  iciyd a2uln p (0tltoif oydfm r n s s)srurimpnu4ap nmiviat aDrmx p;o0texn f3iasfs ul(vs ()artrif iy1fptr ueo;( t2tmir3ny4omenmnet () 2tr(  nt1ape mo3tltfsDeaumon() ltrmr3oadfptraivil() 2xr(r3iu4al nlncs ( srtmuro;t0aptoioeild aDuluvo t4tltnxf3oa1fpD anvil(0teum(o nudapenmicta()s2urum nt0tlxn i3tydls eluvon()aetrif oatfa  auvolt seuoir3iu4ol elietlsfsrurumont1optomiciad sDraumo;u) rxnxfciytfat luvi t) etmxopoudolt  fvt s aDtr(mpot1tee ioeils s2emu o;u4trtrxf3oa1lp raneslt)trxoxo3no4amtemncias) rumx  no1tpxomoeiysfm rm( s;u)arxnif3oo1om eanei;t0t2umxm3nu1am  mfesatfs2raxm no4tpt mfeildlmDulnvsnt) lxnif3oytla   ivolt0texm(r3ou1omte ieil() Dur(rp;t1olxnmo3iadfa2emnvo (4alxoif oodlp rauesls  2toim iydapeemnvi (faDum( ono0olenmfctydlaDum(vp u4 ltomrctodlpDeli ol( srxmio ou1lmte nviat)artr(m no4tlxn fetltfm2em(mpnu4alxrmf oytop e ivi;t)s2urxm oodope  nct sfaDrm(rooo0ole  ociad mDrm( o;t)texoxf to1optrai o;t)tetmio ou1lpenlncils) rtaum oo0aexnmi3tldls raump u0 reoxr3oa1lptrai s;t0trtoio3ny1ameemicilt)a2ur(m oo4apeo i3ildls ea(ms;t) exnmocoytfat aivi t) 2trxopoo4llte ieiltf 2taxr no1ape iocilslmDumu s u) ltniocto1lmtrln i;s0 etrxr3oudope  iesatfaDtaumpno1aptn feils mDumu o;u4artrmfctatfmD aivo t)truriopiodlm n ivs s) 2rmxmoou0tlxoifciytlm ranvo;(4 ltoxr iodlmDelueo s)s2umimpny4ole  ieilsfs2urxm ;u0aexo iciytfs2uanmo;u0alxrmr3iy1oaDelnvslt0 exo(mpiodame  neta(  Dtaxmono4oee ifeiysfm2umuvo;u0trtoiocoadfaDe n s s trxm(mpiudomtemnvi ()aDur(r no4ale  f3tld s2ulums;(0tetnifctodfm e i i;t  rur(o3no1op  lnvtlsf rtr(rpnt1tlt moeiat m2ra(vp u4aeerif3tytlpDe uvi;(  rumxo oodamtemnesls a2tmxr ;u4oltomf3iyt sDrl( o (4tlxrio3ia1fp elneils  eur(r oudomee iesasf rrrxrpou4alx iictld mDumu pnu0areoxr iydfpt  ivi s trtmxo io1ale liei ()s2rrxmo;o0aexomociydfs rau pnt)altrmo3tytoaDrlues;s)srtmim nudop elnvta(  rum(mp;t4tpe mietytlm2ua(ms;(0arerxf oadlaDeaneo t)s2xr(m3iy4lp e feiatfa2umu oou0tltoiietasfa2ranmo u)texomociytomDraivs s0srxrio no1lpenmnvi s)arumurp;o0apen ietls a2ulumo;t4texrir iodopt  uei s srtoirpnydap e iesas aDrm( p;o1optnmiciydfa rauvs;u0artnmrcootfmDeaies;s0tetoiopnudlmte ietls a2tmxront0alenifeild m rmnms;(0altrifciotfp  luvslt0t2tm(mpiy4lp nlivt tfsDuru  oo1tlxoiociatfs2uanms (4 etnmr tatlmD aies s seumxm3iydope lfci t) Dtm(m ;t1aetnifctldfaDra(mo;t)arerxo iy1fat luvol(0sruoxmpio1oleemneiasfaDrmur oo4oleoifcildfa2eluvs;t4arxniociadomtr ueo;t trtmxr nodaleemics sfsDta(m ;u1open i3ilslm um(mont4 reomr todoptr ueolt) exr(m3nydlpeelies t)arra(rp;o0tpt iictldfs umnmo;u4 rxomf iy1fptelu o s) 2xr(rpoy4aptelfet (fs2rmxmp;u4oleo oeiys aDem(vpnt4teerxf tydfmDeaueo s0srur(m3oodlpenlnetl( arua(rpoo0alt iociyd a eln sn()texnmf3ty1op  livolt) 2xmxo3iy1lm nlfct (fsrrau p;o1tpxomf3iytfa emnvont)artrxr3to1la ran slt)t2toxr3no1ap   nvi s  2rrx p;t0oexomfctaslm2ulnvp t)alxoxo3oa1oatr ues (0texrxo3oy4ap e iesl(fsDrmum nt1tleo iciatfs2rmuvont) lenmf3io1op e u s;t sexrxm oo1ap n iei s)a2ra(mo;u4tpen o3tas mDul(mont)teenxf tytfatrauei;t0 2xrirpiydaltelfei s a2tmumpou1alenmocilsfsDrm(mp u0aeenmr3oytlm rlnes s)t2xr(m oy4olenlies s)srra( ooo1alt  f3ias s rl(vo t0arermo3iadomtelnvsls s2xoxmpnu1lptnliesasf rtr(  ot0tpen f3ils s2rl(mon() lerxf3io1lpDe n i s)t2xmio3iydamen nvs () rrmx  nu0tpx  f3iasfm2elnvont0tlxoircoa1opDrai i (0 ruo(mpny1alt  nvt tfs2rr(mont1optoii3iltfs2ra( s;t4tlxoif iytfp  aivi;()texo(mpiydlpeemiesas)aDrrxmooo4openmfetyd aDea(vs;t)aeerxr3iodoate nvol() rtmirpnodolt mieilt s2rm(mo;u1oeen f3iydfm2ra(mp;(0altoxo3ta1lp e u o ()trxoir3nu4oleemfci t)artmx pou0aet  o3iad m2rl(mon(0 lxnif3ta1fptrln i s0t2umxmpnu1ameemfcia() rrmxmpou4tpx ifctldlsDuanmo (0tltoxo3iydlp   nvo ( setoxm no4altnmfet t) rtrxmp;t0aeeoioeias a umuvp;u4tltnxrcootop elnvol()trxmimpnudame lnvt ()arrmurp;u4tltoii3iydla eau ont)aetoxoctadfaDeaues t t2tr(mpoo1apeemfctlt)sDtrumpno4texo ietyslmDel(mpnu)alxnir3iy1fpDeai s t0t2xr(mpnydamt lnvt t)a2uax o;o0oetoiociadlaDuln o ()aeerxr3iytlmDrlneil()seuoxo no4amt mfeiat arrmu  ;o1alxnioetls aDuluvo;u)arerxr oytlm  ln ols0t2xrir io4ame mfci t)aDtmum nu0tee  i3iat m rmumo;u) exnmf oodla rluvi ( s2tm(r ou4ope livtlsfa2ua(moou0apx mi3iltla uanmo;(0tlxnir totop  luei;t0 2xo(opiodapt mnetls sDtrur ou1olt ii3iatlsDrm(vp;t) reoircta1laDe u s;()s2xmir iu1ll  mneia(  Dtmx o;t1oexomieilsfs2ranmp;(4aetoir iy1fptrli s s  2toxr3iy1lmtnlict s)arrmx  ;u0apxnmocildfs2ul(mp t4tleoir3ia1opDr i o;() ruoxm oydopt  ictatfsrtmurpot4oleo f3tatlm2ranvpnt)arxnmocoa1la eluvol( srur(m nodlp emictas)a2rm(m ot4tpt iociadfm eanvp t4aeerxf ta1oat  u s;s trxo(r nodameemneta(farur( p;o4oexnmo3ias m ulnmp u4 renmfcoodlaDelueols0srxrim oydom nlivia( aDra(rpou4olxomf3iydfs el(monu)trxrio3tadla elies (  eto(o3no4ole mics ()a2uaxr oo4tleo octas m rau s u4 eeoxr3iodoaDr ivs;(0sexm(m ou4alen fciat) rtrumont4alxo iciyd m uau s (0 lxoifciydlmt  ivo;(0 exrir nu4olt lnct (farrmxrooo1apx iieiatfsDea(vp;u0 lxnio iydfp elnes;t) eurir io4ap   iciltfa2rmump;t0opeoifctys mDeln pn(0 etnxrctatlmDe uei t setr(r nu4ol  lfvta() rtax ont0tptnmi3iyd m elu pnt)aetoifciotopt aivs t0 2to(o3oydlltemict sf 2taxr ou1oetoiiciydlsDrl( ont4teenxfctydla rluei;t  rtoxr3iy4lp nmfvilt)s2trumo;u4alenio3tytla2emu sn()teenir iodopt  ieilt t2trimpio1lle lncs (faDurx pnt0aee  o3tasfaDumuvpnt4 etoxo iy1fptraivo;s t2xrxo3nudapte ics s)arurxmont0olxoio3tadls ra( p (4tlenxo tytfpt livo s0trxrio nodop emnvt tf rum(mpnu4tpt mo3tasls2ea(vs;u)trxrxr oydfptelneol(0 etoxrpny4ol   nvs sfa2uauroou4tet ii3iasfaDrmu onu0 lenif3ootlm eln i;s  2xo(o iu4lmee fcs (  2rru ooo1oexomi3iydfs2em(mpnt0alenxo3to1op rlu s;(0 2xrxo3iodolt mivsl(fsDumu  no1aexoio3tadla2ra(vp u4altoxr tadfm rlnvo;s0srxm(o3iydome  ietatfaDtmumo;t1olenmictas s2el( o;() eenmoctatopDe ueil()tetm(r oy1aleemnvsl()a2tmx ont4tlx  i3iytfm2rl( o t0treomr3iy1fmDrlies t  exoimpiu4apte fvtlt) Dta(moou0oeto o3tls a eaumo;u) lxrxo oo1fmDeau o;(  rtmxo ny1ame  nesa(  2rrxm ;u0tet ii3tldfm umnvo u) exomf3oytla   neo t)srxm(rpnudll nmictlsf 2urx  oo0olx mfciltlsDul( pnu) lermf3ia1om e ueo;t)t2umimpiy1ap emiesat) 2umu oot0opto feiatfmDrmnvs u4tleomfcto1lpt  nvi t0tetmxrpiu1llte netlt s2rru  nt0ope moeiysla el(vo (0arerxr3oytlm raues t  2xmxm no1ole mieias)aDrmu o;t1tltomocild aDumnvont4 etoxrcio1fmt lieo s)trtmir3io1lltnlivtatfa2tau  ot4texn ociysls elumon(0artoxo3oatfa rlieils sruo(o3iudolt mies sfarua(m ot1olto feiys a emnmsnt)aexomo3oydfaD lieo;()t2tr(o oy4lmtnliei s aDtm(ro;t1apx ii3ilsfs emnvs u)tleoxr3iy1lateauvs;t  rtmxr3nydlp e iesltfa2umxroou4tpx if3ilsfaDra(vo (0tlerirctydomteaivs t0teuoxo nu1opt mfctltfsrrmx onu1aex mfctadls uau s;()tlxrmr3tadoa rln o;s) rumxopnudlme  fvtltfaruaxr nu0aexoio3iydla uauvs;()teeoircoo1lmtranvolt0t2tr(rpiy4lm emncsls) Dua(ro;u4oetn f3iasfm ulnmp u0 lxnxoctodfm rlnvi;t)t2tmxr oo4ap nmnesl()srrrur no4tlen iciasfs rmnvo;t4tlerio iatfatelies;s  euo(o oo1opt lfct s)aDtmur ;o4oeeniietytfaDrmnvs u0tlerif tytlpD auei;t0 2umio no1oltnlnct ( a2umurpou1oltomoctltlaDrauvsnt4 etoircia1op eanvo ()sexrxr3oudom nlnvil(  2rrum ;t0aptomieilt s2umn s t0aexoio oadoptrln i (0trtrxrpiodomtnlfesl(f Dtrx  ;t1tpe  iciadlm em( o t)tetriociatfmtrlieo;(  rxmim iy1omenmiei ( a2rrur nu4tlxo ieiadfmDel(vs (0 ltnio iatoptelnes;t) eurio3ny1om nmnvs tfsrrmurp;u1tpt mfcils s2ran o;u0 exrmf tytfate ueo;()trtrxm oy1am nlfcsl( arua( o;t0altn ieiadfm2emu s;t0aleoxfctatoaD ln o s) 2urxo3oy1opeeliei sfarrrx  ou0ape  ieiasfm ua( on()tetoif oo1omt  uvo t  rumio3nu4lptelnvt tf Drmu p;u0oetoif3iyd s rl(ms u) reoir3iytoaDe nvs;t)tetoir nudalt  ncsas)aDuauro;t1alt  ictld mDrlnmp u) ltoxociodopDelivs s s2xmir3no1ome mict s) 2rru pnu0tpe iieiysla2em( on(4artrir3tydlmtranei;(0trum(r oodll nmnctlt a2trurono1opeomicilslm elnmp;t)altoio tytfp raues t)teuo(o oo4lmte ici s)s2rrum oo1aex ifeiyd m eauvp t4artomo3oodfm eln olt)seuoxo oydlmtemiei (fartm(rpno4altomfeiys aDrlnmsnu)texomf3totom r ueils trumir io1apeelfvs s) 2umu  ;u0oee  iciatlm2em(msnt4 eerxo iytop r i ols0t2xrio3nu4ol nmictl(fa2ua( pno4tetnmf3iydlsDul(mo;t0 renmf oa1opDranvo;( s2xoxo3nu1alenlnesl(  Duaxm ;u0alenmo3iltfa2rmnmo;(0alerioctotfp eauvo t0 rumxr oudop elneslsfs2trxm no0aet mfciltlaDuanvsnu0tltomrcia1oaDeln ols trtmxrpoydapt  fcsasfs2rmxmono4ape moctyslmDea(mo;() exnxfciydlptelieo;s)teum(r3iodoptn ncsat sruaurp;u0olen i3iysfmDrlumonu) lerif3tatoatran o t0tetrxrpnudomeelfvias)artmuro;o4tet mietlt m2ean s t0 etrxrctotopDeaueo;t) 2xr(o oudomtn fciasf Dtmxm ;o4oleo ictyd sDrm( p;(0aetrir3oy1lptrli o s)seto(opny4alenmncta( a2tr(moot4tetnmictad mDrm( p;u0tltnxo iatomtrai o s) 2xm(rpoudap e ictl( arurx pno1olxnifetytfs ulu p ()aexoxf3iydfmDrln olt0t2toimpoodol emieil(f rtrurpot4olxniiciyslm2emu p;t4aeenxocoa1fmtrau i;s  rumim oy4lpt mivt s)s2um(mp;t1texomfeiytlmDum( s u0 exoxo3tydoa elueo ( setm(opnu4lpt lncia()aDumxrp;o1tex ifeiysfm ranmp t0 rxoio3oydfm rlivs;( texoxmpio1lltnmnvil()artr(mpno4tpxn f3iasfm2umn p (0trtrmfcoadlp eln o s0srum(opou1lm elnvt (fa2um(ro;o0tleoio3iytfa uau o u)altoif iodfa rau olt srumiopnodomenmncilt) 2rax p;t1aeto o3tytfs2rmumont)aeerxocoatla  anvolt teurirpiy1opeelics (fa2rmx p;o1ope  f3ildfaDulnvsn(0arxoxrciydoaDeaivs s) rumxmpoy4op  liesas s2tax  ;t1olen ociad m2ea(vs u4tlxrmfciadfp e ivo s)tetoirpno1olt mfvs s)s2tax onu4teen f3iyt m2uan o;u0tlxnxr3iatlpDrauvi;t t2uo(m3iy1ll n ivilt arta(rpot1alx  feiysfa2rl(vs t0 rxnif3oa1omt lneilt)srurir io4omtelivslsfa2umuro;t1tpto feiad s2ea( p;u0 lermf ootlptraiesls s2uoio3iodlm  lneiat)a2taur ot1apx iiciat aDum(ms;u4aeerxoctodomDelivs s0 rxoxopiydlmt mivtls) rrm(r oo4oetn ictad sDelu p ()tleoxo oydfate u s () 2tr(r3ou1am   iet (f Dta(rpou4oeenioetyt m2ra( s () rtrif3iatlate nvs t0s2xr(mpiu1ap n nvs sfaDrmu  ou1aexnmieiysfs2em(vont4 rxoxo tatlmDr uei;(  2xmiopnu1llee ivsls s2tr( p;u1apxo oetldfm em( p;u0trtoxo iadfa raivo;t0s2uoio ny4ale mnvi sf rrruro;t0olxoifeiasfsDrmump (0alerio ootfmDe uei;()srxoxm3iodalt lfci s) rtaurpou4olx  fciytfs rlu o t4 lxnmo3iytlateanvo ( trxoirpoydalt lfesa(fs2umxrono1teenif3iysfm2ea(vo t4 rtnxr oo1om eaivs t0trxr(m oy1lpt mietls  2taxrpot1oltnifetydfm rlnms t)altrmf ootomtrliei;t)trum(o3oo1am emivtat)srrm(r nt0aetomf3ildfm eau pnu) ltnmf iodfaDraueo;s  2toir3oydomte fcs s)sDrmx  ou4opt iieild a rau o;u)tleoxo iatlmte iesl( trtm(rpio4lmtn icsasfartaxmoot1oex mo3tadfs ua(vp;u0 renmo io1laD  ivs;t  rurir iu4lmtemfet (  Dtau poo0ale  o3tytla2umu s t0arxoxr3tadlaD an olt  2to(o3iydlle mivils)a2urxr ;u0oltn octatla2umuvo t)areoir3ia1oat aueo;t0 rxmio ou4amtn iet s) Dtaxro;o4tpt iieilt m em(vs u)tlxrir oatoat  ivi;t0trum(o nudlltn ncsatf rurx pnt1optn o3iyd m uanvont) exrxfcoy1fpDrau ilt0tetrimpny4ll  livslt srur(m ;t4apxnmo3iad m uaumpnu0aleoif to1fp r nvil()sexrxmpnu4lle  netasfa2umurono1olx mfciadls rlnmpnu4trerir ty1optranvo;s)seuoir3nudaptnmfetatfs2ua(  ;o1ole io3tltfs ua( s (0 rxnxf iodoaDrlueo;s setr(mpoydlp  licsltfsDtm(  oo0oeeo oeildfa ean onu0tlxomf oatlpteliei s0 exrio3iudam elfesasfsrtaumooo4aexomf3iytlmDelu sn(0 lermfcia1opD lueo t trtm(rpny4ape lfviltfarua(m no4aetn ociltfa rlnmsnt4tlxomf iodom ranvs s t2toxr io1lptelnvta(  2urx ooo1texomfetyt a2eaump;u) ltnmo3tadoa rauvol(0 rxrxo3oy4olte nvtas)s2ra(  oo4tlxnioctadlaDea(vo;t4tetoir3iydlp eaivi ()setoxo nodaptemncia()sDuaur ;o4apeniiciad aDrlu s;u0tlermo io1fpte ues;s)t2tmxr oo1ame lncsa() Dtrur ;t1opxo iciytfmDrm(vo;t0tetoirciy1laDrau o s s2xm(r nodoltemnvt (  Durx pnt1alxnmo3iadlm ua(msnt4tlxrmo oadfa eai s (0 2tmxo3iudapenmnet t)arrrxrp;u4oleomo3ildls eln o;t4texoxf3oy1omDr nvi s  eum(r iy4aptnliei t)s2taxrono0apeomfeils s ranmo t0arenxr oydop  an il( s2xoim3iydapenmfcs ()artaumoou4tpenmfciydla2umuvont) eeriociotlmteauvo;t)s2uoxo nu4op  mfvia(f 2ra(m ou4alxo o3ils sDrl(mpnu0artnif3iadlptr nvsl( srtrxr iodllt  ictltf rrax o;t1opt mf3iatfs umuvpnt0tlxoio oodopDraivs t  ruo(r3iy1ap emnvt sfsDrmxm nt4tle iieiysla2raumpn(0aeenifcoodlmDeli i t trurxo ny4lltnmncsls) 2rr(r ;t4aeen iciytfsDel(vs;(4trxomo3iadoa  anes;t)teuoxm3nu1ame lnetlsfa2tr(m nt0ape io3tydfmDeluvont4 rtoxf3iotomt anvols0s2xo(opoudlpe mfcta()s2taxr nt1ape  feiysla2emu o u)trxrxf iydoa elneslt s2xoxo io4lmenlieslt s2umx o;o1aleo i3taslmDra(monu0 exoxfctotlmtelnvs s srtm(rpnydapte neias) 2um( poo4oetn feiyt aDemnvs;(4 rerir3oadfpDeluvi t tetoio oy1lpe mfctasfs2urxm ;u4texoifetytfs ea( on(0teeomfcto1fpt li ilt) 2toxmpiu4amtnlies s  rur( oou1apx  ociadlmDrm(vsn(0 eenir3tadlptr u s;t  exrim3ny1lmen nvta( sDurx o;o1ale iicildlaDrm(ms;t) etoxf3oa1fpD lu sl()s2umir3oy1om  lnvias)aDtm(r ;t4tetn icils a2umumsnt) rxrif3oo1oa r nvsl() rumxopny1ole  fvs s  Drm(r ot1oleo o3tyt s em( p t0trerifcty1opt an ol(0 rxrxr3oudom emfvi sf 2tau  ;t4olto ictys a2ulnvp;()alxoxr3oadoaDrauei;t0s2tmimpiodlpt lnei tfa2um(m ;o1tpxnii3tyslsDrm(vo;u0tlenmocoa1omD lnvi;t)teuoxm no4lmenmnvsat aDrr(  nu1alx ii3tlsfs2ulumsnt0alermfcoo1fatrauei (0 2ur(r3iu1lmenmfviasfsrumxmooo4tpen f3iys mDranvont4trtomf tytfa rauvo;t0sexr(m3oo1am   fvtl(f rumumo;t1altn i3ildlsDua( s t4alenmfctatfmtrlues s0t2tr(m nudapt lfvta(f Drmu  ou0teeniieild m rlu snt)aleoxf oytomD  nvo;s0 exmxo oo1omen iesls  Dtmum ;t0oltnmicildfa2em(mp (0 lxoif3oytlm elues s0 2um(m3oodal   nes ()aDrmu o;u4aleo feiyt a2umumsnt0trxrxrctatfaDraueo;(0trtrxm no1ll emneiat) Dtmumpoo4tetnif3iydfaDumnmpn(4 lxnmf iadlp rln s
\ No newline at end of file
@@ -0,0 +1 @@
+i i (0s2urxo ny4ol   fviat  2rrxmont4oltnmiciltfa2ulnvsn()artoir3tadfm raivo;s)t2xr(r oydlmteliesls  Dururpnt0apto oeiyt m umnvp;t) exniocoadfmDeluvo;t0s2xrio3no1olte fcta()srtaxm nu4aet ifciysfs ul(monu0areoxf3oatfatr ues;t trxrio iu4oleelici (fsrrrx o;t1tleoif3tat a ra(vont0 ltnmf3ty1fatr ueils) 2xo(o3iy1lme  fvtl(  Drmxrp;u4aeeomoeiysfs2emnvo;(4tlxrio oytfat ln s s) 2triopiydlpt  iviasfaruauronu0ope  ieiasfs ra(ms;(4 etnxo3to1fmD ai i t srurio3io1lmtemfcilt  2tmu oou4tptomociyd m2rlu ont)artnir3tytopt lneilt) exoxopoudomenmfct ( sDtax  ;u4tpe  oeiyd sDeauvp;u0tleoxr iotfpDe i o;( t2umio3nu1optelivs s) Drmxr ot4opeoioctat a emu p;(0texriocootoa  ai ils0 etoxopiudalt  nctasfarrr(  ;t4tle ii3iytlmDea( ont4 lxnmf tydfmDe i s s0t2xmim oydop n fei t) 2ua( pno4oee ioeias sDumnmp;u)texnmrcoodlaDrlivi;t  2um(r3oy4ap   fvils) rtau  no1apeo oetasfsDelumon(4 rtoio totfa  an o;t0sexoxmpiydll  mneil() 2rrur no0tpxnmieiasla2ea( o;t0trermr io1om  auvo;t0sexrim iy1ale livi s) 2um(mp;u1tee  o3tadla rlump t)aetnxf3iy1fpteanvols  2uoim oodome  fciasfarrm(r ;o0aexnmo3tat aDeluvp;() eenmrciodlmt  ies;s0 2trim3ou4am emfcslt sDrru  nu1alxomf3tyt s2elnmo;u4 renif iodfatranei;t trxrimpno4opt mfesls sDrrumoou1alx ioeiad a2umumonu)arenxo oadoat  nvo;s setrirpiydopeemfci t)aDtmumonu0tlt mi3tytlm2umums (4altoif tatfat ai o ( t2xo(mpiy1omtemncsasfs2ra(  ;o4tpx  o3taslm uluvpnt) rxrmf oo1fmtrlnvs;()srurim3ou4llt mncs ( sDrrumo;t1opxomfeiadlaDra( pnu)tltrmr3oo1lateli ils0s2xmirpiu1opeemfeslsfaDuaumpoo0tex mi3iad aDelu snt0trenio oy1fat ln o t trxm(m3ou1lpe lneiltf 2rr( p;t0tlxo i3ias s2umnmpn()tleoxocoadfmtranvo;s0sexmxr3oudalen ici s  2tr(  ;u1alxoiiciyd aDulumpnu)texnxo3iytfmDr n slt)s2toxo oodopt lfcslt)aDra( poo4tet  ieiadfm2el(vonu0trxoxocoydom e nvsls) rtm(o ny4lp n nctl( s2rrxrp;t1altoiociad mDra( pnu)alxoxf3oodfaDeli s ()t2xoxrpny1amtemneilt)aDtaurp;u1aexn f3iadls2ea(vpnt4artrxfciadomDe ivo;s teuoirpoudolenmfvsa()a2rr( pot4olxoifetyt aDulu s;()tetnxrctotfmtr u s t0srtr(mpiudopt  ics ( artmum ;o0tptnmfciyd s2rl(mo;u4arenmo iytoa eluvol()seuoxr3ny1lptelnesas sDraurpoo0apeo f3tysfa2em( o t0trxrir3oytlp   iei s0s2uriopoydom nmfvtls  2umx  no1aee miciyt sDul(mo u4tleoio3ootom rlivi s) rtrim3io4ap emfei sfarrrx  ;u4aetoiieiyt s rl(mp (4alxnxfciadfmDrlueil( trumxr3ou1aptelncil(fsrta( pno4alt mo3tysfa uluvo t4trerifcoo1fp rlivi;s  exm(r nodlmt lfci sf rtmxro;o0tle ioeiyd aDea(mo;t4arxrmf3tadfptr ivs;s seurxm3ny1ome mies ( artau ono1olenmoetytlm emumo;t4teerir oa1fmt luesls s2xrir nydal nlnvi t)sDrax p;u1opxo ietasfa rmu o;(4 exnmocoa1fa eli sl( s2xmim3no4ap elics t) 2trx pnt4aetnmoeilt a2rl(vpnt)aexnmr ty1op ean i;s) rxrxopiudamtemfctl()aDuru  ;o4aetnmo3tatls ea(vo u)teeomo3io1fa   u s;t) 2xmxrpou1omt  fet (  Dtrxm ;u4oltn f3iys aDuln p;u4 exrmrcoadop  ai olt0 eumir3no1apeelfvia(fsrraur ;u0tpe  i3iydlmDrlump;()artnir3to1lp eau sl( srxrxrpnydape  nvsl()arrau o;t1aetoiociydlmDum( s;(0tltnxr todfp elieo;s)sexoir iy4lp n iesls aruax  ;u4aex  fcildlm ua(ms (4aleoxfciodlmD luvs s)s2toim3oydapeemicilt  2rru  nu1opto iciaslaDemn pnt) leoio3oadomt li o t0tetr(m oydlmtnmncia(  Dtm(rp;t4tlxo oetasfmDumump;() etnir3iotla eanei;( seur(rpio4lp  lneslsfs2rrxm nu4opto feiys a2rm(vs (0 rtoio oa1fm rlnvo (0truo(rpoo1oleemfvtat) 2tmxrpoo4aptoifciys a umn s ()tlxnir oy1late i ol( seuo(opou4amtelneil() 2rax p;u1tlt io3iaslaDumump t)tlxomf iatfpt lies t0setmir ny4ap emiviltf Dtau  ;u0tpt ifctasfsDrmu p t0treoxr iotfa   ivo (0texoxo iu1lmenlncias)sDtmumpot0aex  fetltlm2ean p;u4tetomf3iadfmDe i ol( t2umxmpny1am nlfvi ()srrrxro;u4aetniictlsla um( s u4artnxr3tadfm eauvs t0srtmxr ny4alt lictatfs2tm(ro;o4aee  o3tltlmDra(vsnt4 rtrmr3iydfpDe i ilt0tetmim iu1omeemicsa(fsrra( ont1alt mf3ilsfa2ra(mont4 ltnxr io1fa  anvs t)t2um(r3io4om  licta(fsrtrxr oo4apx  fetlsls2emums (0 renxf3oadomt anvo (0 2xm(opnodamtnmici ()sDrr( pnu4alxn f3iltfs2umu s (4 ltrio3iydopDr iei t)t2toxr no1lme mncslsf 2tax o;t0opto ieiadlmDrmnmp;(4alxnmo oy1lmDe ivil()srxoiopnudam nmnviat)s2tax pnu1oee io3tadls2em(mpnt0 ltnmf ia1fa rauvs s sruoxm3iodoptn ietlt aDtmu  ou0ole iieildfm2uauvsn()tltoxf3tatfmte i i (0 exoir oydoptnmncs tf Dtaxmpot0aleo fciydfs2ul( s;(0 reniociotlptrlnes t0trtr(rpiodamenmics t  Dtrxmpnu4apto fciytls emnmo;(4aleoxr3oytomtr nvil(0 rxrim3oo4om  lncias aDrrurpoo1tetn ictasls2um(vp (4aleoiocta1opte u s;t)truoir ny1am   ics () Dta( o;u0tlx io3iytfm ea(mp t)arxnmf ootfate ueilt trxrxm oudlpenmneia()sDra( onu1opt ioeiyt a2umn p u)trtoifcta1laDran o;( trxrirpiodole livs () Drr(mpot0opx mi3iyt aDeauvsn(4arxoxocia1lptrlieo;s s2toxm3oodol e fes s)sruaumpoo0apxoiietyt s2eln onu) eeoio3todoatrlu sls srtr(mpnydope liviltf Dra(mp;t1ope  feiydla2ul(mont4trxnifciydfpt luvol( srtr(o3oydame mfvt t) rtm(r ;t0tpxoio3ild s2eluvp;(0 lenxfctotopD lnvolt) 2toimpoy1al nlnviasfaDumurpnu0aee  f3iyslm2ea( snt)aeeoxociadlate nei t)s2umxo io4omenliet (fsrraump;o4oltnmo3ild aDuanms;u4tltrxf3oy1op ean o ( t2uoir3oodlmt  ncil(fsruaxm nu4teenmfcildfa2uanvs (4texrxfcoytlmtrau s s  2tr(m3iu4lm  lfet sf Drrx  ;o4texnifctydla rluvo t4alenmocootopteauvi;() 2uo(o io1llt lfeta(  rrr(ronu4aexnmieilsfsDuaumsn() rtomociadoa elnvolt) rxr(opoo4omtn fcs tfs2tm(m nu4opeomoetytlsDelu onu) rxomr3todop e nes;(0 2uo(m ou4lmenmfvs s srra(mo;u0aleomocils s2ulu p t4arxnir tatfm  aues t0tetr(m3iu4altelnvslt s2urumoou1tpx mociyt a2rm(vs;(4arenxf3totfat ai o;s0 rumirpoy1lm  mivsa()s2urxront1opxo f3iysfaDrmuvpnt4alxomo todlpt li i;t srxoxrpny1ll  mieiat) Duaur oo0oeto o3tatlm2umu pnt0teenxr todfpt  i s;t)trxoxo iodamtnmivil()a2rrumoot4tpxniictasfa2rmn sn(0 renmo3iytlpD lneo;( srxo(mpoydll nlnviat)s2taumo;o1opxnio3tldfa2emnmpnu)teerxr3tatoatrai olt) etmirpno4alt lnvt (f Durxmo;u0oee moetas a2elu p;u4 reoxfcoo1fmDeluvo s)srxrir3oudlm e iet sfs2ua( p;u0tle mieiyt m raumpnu)aeerxrcoadom eauesls t2to(rpiu4lmte ieil()srrm(m ou1opeo ietlslaDra(vsnt)alxrir iytlmD  n s;( s2tmxr3ou1amen ivta(faDtrurp;t4ale  ocildfa2elums;(4 lermoctytlm elivs t) eto(m3oo1al e ietlt  2trxr ou4opeomfciltfa2rl(mpn() leoifcoy1fm rauvo;s  2xo(m oudlmt lict s)sruau p;o1oeenmfctlt s2rmnms (0 lxnxrciodopteaieo s)trumirpoo1ol emnvslt s2rmxmooo4apxnmociadfs2uanms;(0teermr totoaDeauvs;t srtrxmpiy4om n ncs sfsrur( onu0aleo o3tys s2raumont4tlxrirctadfpD auvs ()trxrio iy4lltn fetl(faDtaxm oo0aee  f3iyt m2ulu onu4tltnxr tytlpDrluvil() exmxrpny4ap elictat arrru poo0tlto o3iadlaDuanvsnu)tltomf3oa1omDr i olt0 2xmiopny1op   fci () Dtr(rp;u0opt mfciltfmDel(ms;(4tleoxr3ootla e uvsl() 2tr(r3iudamen ieia(  rtr( ont4apxoiieiad s umnmo u4alxnmr3ia1oaD lu o;s0teuo(o iu1lptn net tf 2ra( pno1tetomo3iyt aDra(vsnu4 eenxf3oy1fmDeauesl(0t2xrxm iodoleelfciatfaDum(ronu4tpen i3tysla2uaumo t4 exnmf oy1fa   i ol( tetrir iudopeelnct s)aDra(r nu0aetoifetasfs elnmonu0artomf iotopDelu s;t sexo(o no4alenmnei sfsrrax p;t0ale mfciadfm umn sn(4trtoxrciadfa r neils0tetmim nydopen ivsls s2ta(m nu0alto o3tatfa2umumpn() rtnmociadlaDr nvi t  2urirpoo1alt mnet ()aDtmu p;u1opt  f3iat a2uanmp (0 eenxocoodoa elivol(0sexoiopno4op   neslsfartrur oo0oetn ieiad m rmumsnu4alxnxr oy1oa eau i t0 ruoxm3oudlltnlies (f Drrur ;o1ape  octas s uanvo (4trtnxf ia1fpDe u s s t2trxmpoo1ap n ieilt)aruax p;t4aexniiciatlm2el( s t4aexnif3totfmtr ies t0 2xmxo3iodom nlfesls  2tau poo1apxnmociytfa2umnvonu)arerifciydopteauvi s0 eumir oydopt lieiat  Dumurp;u1altn ictysfa2eaumo u4tltnxf3iatfa eanvil(0truo(mpny4lltnmnes () rumur nu1alen i3iasfm2raump;(4arxoxf3oytfmDeln o;()srurxopnu1amenliviatf 2rmurono0tpe mieilsfa rlu s t)treomr3oadlat luvils  euoir oy4amtn ncs ()artaum ;u4tlx mi3tltfa2umuvsnt)tltnif3iytoatrlnvi ()texrxr iy1alenlnvt t sDra(rpno0aexo f3iysla eanmpn(0tltrxfciodfpDrai sls trtoir iudomtnmivtltfaDtrumpno4ope  o3tadfa2rln sn() eenmoctatfa e u i t tetrxmpny4lmt miciatfa2rmu o;o4aet if3iltlm2ra(vs;(0arxnmfcoa1fpDe uei (  2trxr oo1lp  mnci s  2tr(rpnu1oltnmictlsfm uaump ()arxomr iodom raivols  2toxo3iydlm  mfeslt arrrum oo1aetn i3iysfs2rm( pnt4altrmr3oadopD  iei;t0teurxm oydlptn fct ()s2tax o;t4ale if3iadfm2umumo u4 eenio iodomDrlivo;t)s2tmxr iy4am nmncsat artm(rooo4tltn ieiyd aDelnvs u)alenmf3ootfp   uvslt  rxoxmpiodap n nct t  rrrx o;o1aptnio3iaslmDel( snu0altrmo3iytfmD  iei s) eurim ny1amtelfeilsf Dtm(r nu0oeenmiciad s uanmo;(0tlxnmo3ta1fat lu sl(0 rxmir3iy1apen ietl() rtmxmono0tpe  f3iydlmDumuvs;()aeermf3to1lmDrluvilt) 2uoxrpiu1alee icsls aDrrxront4tetoii3iytlmDrl(vo;(4trtrxo tydfmD an i s0tetrim ny1optn ietl(fs2rr(monu0aee if3tat s rm(msn(0alxnmrctotfp raneo;() rxo(m3ou4am  mict t) rrru  no1tpxnioetat m2ea(vp;u)alenxocoatlpt li ilt)s2xr(r nodoltemnvtatfarrrumono0aexo ictas s2el(mont4 lenio3iotopt  ivs;s  eumxmpiy1om n fes ( artm(rp;o1aexn o3iasla ranvs t0altrmfcootfpDelivs;s)s2tr(mpiy4ol nlnet (  Dua(moou4oetn f3tysfsDrauvs;u0alenmfcoo1om eanvols  rxoiopiy1llt lnvi t)artmxrpot0apto fciysfs uan pnu4 leoxr3iotfp  au i t  rxoxrpiodomenmieslt arur(  ;u0apenmietys s ranmonu0aetnmf3totfat auesl() rxrxo3oo1ll  lietat)sDrm(mpno4ope if3ils m2uanmont) rxrir3oo1lmDe ues s)s2xoxm iu4lme lnvtat)a2tmuro;t1alt  fetytlsDelnvont0 reomo3oa1lmte ieil()trtoxopoy1altelivi t  Drrumpnt0ape ifciaslaDrau p u4areoxfcoy1lm r nvi;t s2tm(r nudll elneil(fsDtm(rooo1aptnmfeias s uln on()trxniocoy1lp eaieol(0t2tm(m nu4omt lnvil(f Dumx pou1oleo ieiysfa2rmums t)altnio oadomtr i s;t)t2xrxo iu1optn ici t a2tm(mpou0alt iieilsfsDra( o;(4 ltoxrciotopDelu s ( srxmir3iy4apt mnesa( aDtr( p;t1oeeomfetls s2rmuvs t) eeoir3tytom eli ol(0 rxoim3nu1ap  mnvi sf Drmum ;o1tpeoiieildlaDeanvo;() ltnif oodfpD au ils) eum(r oo4lmee iesa(fs2umxmp;u4apx  ietyd mDeaums t)aetriocoy1fp  lnvi t0 eurir nodomt mneils artmxm nu0oeenmf3taslsDra( s;t4tltnxf to1lat  nvi;() 2ur(r ny4openlies s) Dtr( o;u0ole  oeiltla ra(vpnu)arenir3oy1oa eau ilt)srtoim nudam  mfvtas)arumxmonu0tpxo i3iatfa2elump u) ltoxrcty1opteai s;()setmxrpou1ome  fciat)srurum oo0aeenmi3ias a ra(mo t0altoxf ootfmD ln o;s s2urxo3ny1ol elfetltf rraxmp;t1opt mfciyt aDea(vo u4tltrmrciy1optr u o;(  rurir ou1optn ics tfsDum(ronu1tetoiictlsls2uan p;u0aexnifcoytlat lnes ( t2urim3ou4omtn fcsa(fs2rmurpno4tpen o3ias s rmuvo;t0texnxrcoydomt  ueo;s trum(opno4alenlnctltfa2raumo;o0oeeomo3iyt aDulnvo u)trtriociadom eli s;s0 rurio3ny4lpt mfct ( aDuax  no0tpe mfciatla rl(vp t4 eeoxrctodoa r n s (0truoim3nydopeelneias) rumxm ;t0apto i3iyslm uln p t)areoiocty1omDeaies;s setm(o io4llte fvia( srraxrp;t4tetomoetatfsDua(mpn(4alxnmr ty1laDeauvo s)t2umimpoo1ale mnvsat artaxmo;u1aleo ieiltlaDulums;t)tlxnmo iatomteaies;t)setmxo3nudll nlfvtas) 2ta( o;t1tleoifetyt a2elnvs;(0teeomf tatlp r u s;(0setrir3iydom e fctls)artrurpot1optomfeilsfm emn on()altoif3tadomt  iei ()t2urxo3ny4omee fcil( a2raurpnu0teeo fciytfa2rlnvo u)aexrio3todomDeau o;s)srtr(opnudlm  mfvsls)srtaumpno4tltomo3iyd m uanvpnu)areoir3oa1fatrlivi;s t2toio ou1opeemies (  Dra( ooo0oeeomi3ilsfmDumu snt0 exomr ootfpDrliei () rtmir3nodlm e ivtltfaDrau pot4alxomoetasls ua( onu0 ltomf oy1fa ean i s)srumxm ou1lm nlieslsfa2uaump;t1oeeo fcildfsDrlnmp (0arxrxo oodoa eaivi;()teuoxo3nu1omt mivtatfsrtrxmpnu1oltn oeiysfa2rauvo;u0arerirciotlat lu ol()t2trio io1om elicilt sDrm( o;u4tptomietadlmDeln p (0 eenifcto1fp   i slt tetmxo io1olt mfei s  rtaxr nu0tlx mociadls elu o;(4trenxrcoydlmDean s;s0teuoxr io4ameelnvtas)aruaumpnu0tlenifeiltfs umn o;()trtnio3tadla   uvi s0 etrxr3no1op elnei t) 2urxr ;u1aexoiieilsls2uanvpnt4 etrxf iatoaDe ues;t) rumim nodlp   ici s aDrmxm nu1tleo oetyt sDelu o (0 exnmr ootoaDr i o;(0 exm(m ou4lpe  fcil()a2raurp;t1oltoiiciat a umn p;()altnxo iatfate ues t)trtoxo3ny4ap   fviat)s2ur(  nt4oee  i3tadla ra(vo;t4trxnmf oatlmD lnvi s0srxmxm3no4lm n nvtls artm(moot4teeniietls mDem( s;u0trtoxf iadfp eauvi;( srtmim nydap emfetas)sDur(  ot4opx  oetat m2ua( s t4teenif tadfatelnvs s)sexo(m3iodome lfesls)artruro;o0alx mo3ildfs2eluvo;u)altrir3to1lmteauvs t  exmxrpoo1ope  icil() rta( pnt0aetnio3tlsfsDul(vsnu4areoxrcoa1lm rauvil()trxrir no4om n ivt (fsrtmxm ;t4opt iociltlm2el(mpnu4treomr tadfm  lneslt) eurxr3ny1oltelnviatf 2rmx ont1tex ifetad s ua( snt) ltoir oydla r n s ()teumxm no4om nlnctltfs2tmum ;u1aleo fcilsfm rlnvo;u) etrir3oodlaDeanes;(0srtr(m nudomeemnvsl()sDra(mpot0ape iietydfm rl(ms;u4alermo ta1fmD  n o;( t2xm(opnydam n ncias)s2tmu onu4optn i3tys m umnmp;t0 lxoxocto1optraivolt0 2xoio nudaptnmfvil(fsrtaxmoou4teeo i3iltfm rl(vsnt)aeeriociatla elnei s)truo(o3iy4om  lfci s) rra(rp;u4ale mo3iyd a emnvs;t0treoif iy1op   ivs;t) 2trxrpny4ll  mivi tfarurxm ;t1oex io3iatla2el(vpn(4 ltrif3ty1opDeauvs s  exrxrpoy1llenlnvtls s2ua(rpoo4tex  f3ild a2ulump;u4tltrmf todlm r neo t0 euoxm3io4al  licta(  rta( oou4olxo octys s rmnvont) reomo3oatomDeaneil(0 eum(o3iu4ale lfctltfsrtaumpoo1teen ietytfa2emnvo t0aeerio io1lp ranes;s teumir3oo4omt  fet ()a2raurp;t4aet ii3ildla2rluvp;u0 rtnxo tytomDe neol(0srtoim ou4lmtelnvsl(  2ua(r ;t4alxo f3iyd s2elumo u0tetrxo3tydfa  auvo;s0 2umim nydol emici ()s2uau o;t0tpt mf3taslaDrm(ms (0tetnir ta1lp raivo;t seumxm3nydol  lfet sfa2ua(mooo0aet mfeiyd sDrmnmonu)trtoircoy1fat livsls0tetm(m3ou1ol   ncta()aDtm( p;u0opxn o3iltfm ra(mo u0tltoxo oatlmD ai o s)t2tmxm nudamenmfcs s)sDrr(m ;o4tlxomfetad m2umnvo;u4aexnxr ty1fpDr u s t t2xrimpiu1lptnlnvils  Dtmur ou1alx ii3tldlmDemnvont4 leomr oo1omteluvo ()s2to(r oydlm elieiat  rtauro;t1opx moeilt mDrmnmpnt4 etriocootfatr u i;s0truoxrpoo4omen ivslsfsDta( o;o1teto o3tls sDea(mp u)artomo3tydfmtranvi s)sruo(mpnu1lmee nvsls)srtaxro;o4alx  octad mDrm(vs;u0arxnmrcoa1fp r ueilt s2toir3iydopee icia(faDrmu ono4olt ifeiytfsDua( p;(4tltrxo3ta1opDr nvo t0trtoxo nudalenlncsas srraur nu1alx ioetyt aDumums (4tetoxr todoaD  u o;(0t2uoxm oo4oltemncia()arumumpoo0tpe mi3iatlmDelnvs;u0tltoxf3iatfm e u i (  rumio3iu4olenmnvsat  2trumo;t0tptn ociytfaDelnmpnu4arermrcoydfmtr u o;s  exo(mpio4ap  lnvtat srtr( ooo4oltnmfciyd aDrl(vs;t)tlxnioctodla r nvi;t0t2xoim3oy4oltnmfvils sDrru  ;o1oeenmfciad sDraumo;(4 lxnmfcto1lmtr i ils)sexo(o io1lp e fvtlt sDtmx o;u0teenio3iydls2ra(mp;u) lerxf3tydla r u o;( seto(r3iudalt mfcs t aruaump;o0alxn oeiydfa2ulu p u4 reoif3ia1lmDeln sl(0 rtoio3io4llt mivil(fsDrmx onu0opeoioeiysla2ea(mp;(0arerxo iodlp e nes;() euoim iu1am e fciat)arur(rpot1aee ioetltfs2umuvo u4altrir oo1oat lnvo s t2toir3iu1amtnmict sfsDraurp;u4openioeiat m2umnvonu)arenir3oadoaDe iesl() rxmxm iy1omenmneils aDtmxmont4altoio3iasfsDemnms t)altomr3oodlmt au o (  2xoiopiu1alt  fviasfs2ta(moou1tlx iicilslm umump;(0aexrifciotom   u i ()teumxm3iudlp nmfetlt)a2rau oou1aexn o3iat a2uaums;(0 rtrxfcoytfm  li o ()teumio3iu4alte nvtl()aDtmx pnt1tpt mociydfa rmuvs;(4 exrif iatoa   nvo s0tetmxo3oy4amtn netat)s2rau o;u0apxn f3iydfa2ra( p u4 rtnmr ty1oaDraueslt teumir oy4ape mivtl(faDurxr ;t1teen f3iysls2eau snu0 ltnmf iatomte n ols t2xmxmpiy1alen fcs s) 2ra(rpou0tex mf3ildlm2ua(vp t) eenir iodfa  anvs;(  eurxo ny1alen ivtlt  2rrxm ot4ope mi3tls m emumsnu4aleomf oadop r neo;(0 exrir3oydap n fesl()aDtmumonu4opxomo3tyt a2elu o;t4alermr iodlat au o t t2tm(mpiydap  lfct s) 2rmump;o1tetoiocildlsDumnmo;u0 lermo oo1faD aivils0 rxr(m nudaltnmicsls a2rauro;u4tlxoioctyt m2ea(mp ()trxrxociadfpD lneil() rxm(o iodape  ics tfs2ur( pot1texomiciasfsDumn sn() lermf iatom rln olt t2umxm oydomenmfcs sfsDraur ot0tleo ieiltfmDemuvp u0 exoxfctotlmte neo;t0trumir oy4lle  fctl( s2rr(mont0tetoiicildlaDul(mp u4artoif to1lptraueslt  etmirpou1omtnliei (fa2rmxmpot0aet moctatlaDrln s;t4 rxnxo3todopDeluvi;s)s2uoxo3iydolen nctl( sDta(ront4tpeomoeiyd aDul(vp u4texrmr iytla  aies (0sexm(o iydapen fcslsfarurxro;u1alt mfcild m2uanvp u) rermf3oadlm  livs;t) rtmxmpnu1lp e ivs s  rumxmpou0aetniociydfm2em(mon()arerxr3oy1latrlivs;t) ruoxo nu1lmt lict sfaDtr(mpou4opeo o3tys m2uanms;u)tetrir totlp ran s s0srxm(m3iydlmtemnvs s) 2ta( oou1aetn oeils m raumo (0alenmrciodlmDelu o;t)texoxrpio4lmen icil(f Drmu poo1oet ifctytfm elnvsnt4tlenmr ootopteaiei;s0 2tr(rpno1optemnesltfsDrrxmpnt4tltomfctadfa um( o u4tlxrir3oa1opt  uvil(0srto(opiy1apt lnes t)aDrr(mo;t4tet iictadfs emnvs;(4aexoir3iydfm r n s t t2toir no1amenlictl(fa2rru onu0opxn octls a2uaums u4trtnir3oytfpt aies t) exrir nodom elieslt)aDurumoot1opxo f3iytfmDua(von(0arermr tytfaD aivo (0texoxrpno4lm nmfcs (f 2uau oou1oexo i3iad aDrlumo u0trenio3tytlpt ai i t)teuoim3oy1oltnmfcia()s2raum no1oexomf3tys s2rmn snu) rtnxfcoydlpD liei;t) rtrio io1om  mietlt s2uaumpou0ole if3taslsDum(ms (4aeerxr iadla  aneo;s  etriopio4lmen icsltf rtr(rpnu0tpt miciyslm rmnmont) rtoifcoatoatraieilt) ruo(o oydlpe lfet s s2rau p;u1aexnmicils aDemnmsnu)tleniocio1oa raneo s0seurir iudlmt  ics s)aDumumpoo1tetoiieiat m uan p;u4 reoif3tydomD au s;s  ruoio oydlmtnlietasf Drrxmpou0opt mi3iytfa rln pnt4 rtoir3ia1fpteanvo;s seto(o oydal  mfvsl() rrm(monu1alxomietydfs rm(vpnt)arxnmrcto1fpDrlu ol( srxoimpnodlme lncs tf ruau  ;o4oeeniociytfm uaump t)aexomr3todom  lnesls srxoirpoy4aptnmncsa()sDtrum ;o1tetnmi3tysls2ua(mo;u0arxoio3tatlpteli i (0s2tmimpoo4op  lnvi ()artaxr ot4ape  f3iydfsDeanvo ()trenio ty1fat  n s;t0srumxmpou4aptnmietlsfa2tmxr ;u1alenmfctadla2rlnvo;u) etniocoadfm rau o t  exoir io4apt  fesa() Drr(m ;u0oex mictadfaDrauvo;t0aexnxrcia1omte i o;s0tetm(rpou4apen ivi s artrur nt0tlxoio3ias s ran p;(4artrir3tytopD aieslt  2uoio3iy1openmiesatf rtmxmoou4tee ifcilslm ul(mpnu4 ltrmf oadop elnvo s0t2umimpiy4apte ncs t)aDrr( pno4tee iieiadls2ra( on() reoircoa1faDr iei t0s2xr(m3nydape mnesltfs2taurpnt4oetoif3tatlmDeanvo (4trxrir3ootomDelnvo t t2uoio3ny4oltnlfeils)a2trxm nt1aex  ieiat a rm(vp;t)aetomf3iy1lpt livsls  2xrxrpnodlmenmncias a2umu  ou1aptn feiadfs2um( p t0tlxnmrcto1lm elu o ( s2trxopiu1ope  ieiat)s2ua(mpnt0oltnmfciyd m2rau ont0teenir3oatop   uvi;(0t2xoxr iodal emivils)arraumooo1aleniocilsfs2eau o ()trxniocio1oat  ies;t0srumim ou1om  lics t  Dtrumoou4oeeoioetydlaDulu s;u0arxnxfciadoaDe i sls)seum(rpoy1lle mncil( artau poo1teto i3tyd aDrmu pn(4artoio3totlm   ieols  exo(opiy1amtn nvi sfarrrur nt0ole mi3iys s elu sn() lxoir3iatfateauvol()srurxopoy4aptelfeta()aDtr(mooo0opxn i3iydls2emnms;()aeermoctotoa r ues;s s2toxrpio4openmivi s srtrumpot1aexo fetls mDemu pn(4 reriociadfate iei t0seuoxm nydlltnmnvtltfsrraur ;t4aleniieiltfm2elnmp;t0teenmo oatfpD  n i (  rto(rpoo4ome  ivt sfs2tm(mpot4aexn fcias a ea(mp ()altrirctydfmtelivsls t2toxopoo1ap nmnesat  Dta(ronu4ale  oeiatls umn s;t4 eenifcty1lp   u o t)texoiopoy1lmen icsl()a2uaur ot0aexnii3ildfm2rlump t4artoir3iadfaDe ies;s  2um(o3no4am n fvi (farra( pno1oex  o3tydla el(vp;t4altomocoo1lpD  uvo;s trurxr3oo4altnmfvils sDrm(roou4teeo fetydls rmu ont0 eenxfciotla ean o;(  rxmxmpoudllte fctatfartmx p;u1aptomiciyd aDuluvpnu)tltrxf iodfmD  uesl( s2tm(opoy1ap emfet (f Dua( o;u1tptnifctlslaDrlnmsnt4 leoxfciy1fat ln s;()tetoimpny1al  mnetas srrrxm oo0tetoiiciatla2rau p;t)teenxf iytoaDeanesl( t2toxo nydll e fetas a2rr(m ou0apxoifetasfaDul( p () lenmocoytfa raneo;s)teuo(mpny4lpte nes (fa2rr(mpnt1opxomo3ild a elumsnt) reoifciadopD lu ol()t2xo(o3iodal nlneil( a2rm(  no0aeeo ociad mDeanmp;t)texoxo iydla eluvs s)trxo(rpoydomtemfctlt s2tr(r no1ole mf3tls m eaumon()tetnxrcoydoa   i o;()trurxm iu1al elneta(f 2taxrpnu1tetomictadfs ulnmon() eenif ootla  lnvolt0 rxmxo3io1lltn nvs t) Dtrxmoot1alxnii3iytlaDean snu4 lxoxrcio1om eln s s0 rxrir io1ame mnvtas) 2tax  ;u0tex  oeiltlsDua( sn()altoxr oodlatrlivi t  euoimpny4amtelietatfarum(m oo4opto ociasfs2rm(ms u0artrmoctotoat anvs;( setoir3iodopeeliciat)aruau p;t1oetoiiciad a2elnmp;t4 etnir to1oa eau slt) 2tmxm oy4lp  lneslt sDrrxrooo0tle ifciysfaDuau s;u4 rxrir3oa1lmt lueol(0srtr(rpiu1lmtemfvia()s2rau pnu4opt  ictyt s2emnmpnu4aexrxfcoydoateli i (0sruo(m3iydlpee fvilt)s2rru o;u0tpenmf3tadfs umums u)alenmr tydfa raneo;(0 rumim iy4op n netlt sDrm(r ;u1aleniieiad aDraumpn() ltoio iatfat  ues ()tetmir3nu4am  lnesa()aDua(mo;u4oltomf3tadlsDumnvo (4trxnmf oa1fpDelies t  exoxrpiy4op   ict (fa2taurpnt4olxnif3iydlsDea(mp () exrmf oadomte nvi;s trtoir3oy1omt  ics (  Dtr(m no0oeto iciydlm2eluvs () rxrmr3oodfpt  ies;(0s2xmim iy4am  livs (fsDtaxm nu1altniietasfa rmnmo t0teerir iydoa   n ol( s2xrxm iy4ll   fcslsfs2ra(rpoo1tpenmfciysla elu onu0altnxfctodlm e neol()t2tr(m3iodlmeemnvi s a2ur(  ;o1olt ii3iatlmDumn s;(4 eenmfcio1omD  ieols) rxr(o no1olenlietat)a2raumpnt0alen ieiydfs2umnvp (0 rermr oo1laD aivo s0s2xo(m3iydamtnlnci s) 2ur(mpou1olxo fcildfm ulnvp u)teenxo tydfaDe ieo t)s2uoxr3ou4lp e iesa(fs2ua(moot1olxn ieiyt mDumu p u)tlxoiocio1opDrlivo;(  eumxrpoy1olenmfci () 2rr(mp;o0opeo i3iysfaDean s t4teenxr oydom  li o ( t2xr(rpiydom nliei () Dtrxrpou1teeoifctltlm ra(mo;(0aetnxf3ty1lpDe i s;(0 euo(opny1ale  fcsat s2uax oot0teeo fciadlm2rmnmsnt4aeermf iadlmtrli s ( setmim nudomt livs t srtr(r ;u4teen oeild sDumuvo (4 exrmr3to1omDeli o t0s2tmxm ou1am   fcta(fsrra( pnt4altoio3tydfm elnmpnt0alxrif3oadlaDraieil()trxr(opoo1am elivta( s2rrx  oo0tleo fciadlm uln onu0 renmr tadla   uvo;(0t2xo(o io1lmeemnctat sDtmxrpoo1teenmoeildfmDra(ms;u4tlerxr3iodopt aueo s)tetr(mpoo1omtn netasf Drau pot4optnmiciydlmDea( pnu0aexomo3oo1fmDean ol()trtr(o3oudome  fvi t) Dua(  nt1oee  icildlm rl(vp;u) etoio ta1lpDe ues;(0 rum(m iy4amtelncs (fartmxrono4tetn oeiltfs uaumont4 exoxrciydlp e i i ( tetrxmpiu1ome mncsat) Durx  nt0tpx  fciad s eauvpnu0tetnir3oa1fm rln o;s0 eumio3oo1ap  lieta() rtr(rpot4teeo i3tad m uln s;t0 exrmf3iotfp r ies;s) rxoxopio4oltnmnci sfa2uaum ot1opt mf3ild m2ua(msnu0 rtrmociotlpD  ueslt0srxm(opnodamtemncia()aDrrx  oo1apeomo3iyd a2emumsn(0areniocoodfp   u i (0 2ur(r io4ol emivsatfs2ra(  no1optn ociatfaDelumsn() eenxr3todfmtranei ()tetr(mpou4ole lfeils  Dtm(mpot1optnmoeiaslmDemu s t)alenmociydlate ueo;( setmio oydlmenmiviltfsrur( ont4optn fciadfmDelu s ()trenxrctodlm r ues;s0tetriopoodopee ivi s) 2um( p;t4oee ioeils s rauvp;u)arerir3ta1fm  aivo s)s2xrir nu4amte nvslt) Drm(r ;t4aetniicias mDum( snt0 ltrxrcoodfmtraneslt setr(o iudapenmivt (  Drmu  no0tptn i3tasfsDel(mo;u0 rermf todlm   nvsls0trxm(rpiu1aleemfct () Dta(m no4tleoioeiltlm2rlumsn(4artnmfctotfpDeluei s)trumxm oy4omt licils aDurur nt0openmietys a2rl( ont4aexriocty1lpD  i s;s0trumim3iu1altnlfctlt  rum(mpot4openmi3tys sDrlu o t0 lxnirciydfa e i ils t2uoim iu1amenmfciasfsDrmxrooo1texomoeiyslsDrm(mp t0trxnmocty1opteln i t0s2xrxr3ny4oltnmfvsl(f 2umu pnu1olt  f3iysls2um(mpnt)aeenmo tytoatr ueolt0 rum(m nu4openlivs tf Durxr ;u4oexn fciltfa ea(vo (4texnmf iatfp r ieil( srumio3iodom emies s arrmx  ;u1apx  oeiyslm elu p;u4 leoxrciatfmtr nvslt) exmxopou1aptnmicsl() rur(  no0aex ioeiasfmDulumon()trxrmr3iy1lpD  i slt)srxrxmpio4lpenmfvs () rtaxr nt1oltomo3tyslsDuan sn()aexrxo iadlm  lues () 2toxmpiy4ole lnvtatf Dumu ono1apto fctasfsDua( p (0aeenxf3iytfmD lnvslt) 2trirpiodomtnlivsltfa2taum ot1apxo ictltfs2em( s;t)aexrxr oydfmDe nvo (0seto(rpnudam nmfvta()a2ra(  ;t4alxnio3tyslsDelump;(0texrmoctytlm rluvs () rxrxr nodoptelnvtltfsrtr(  ;u4aleo ieilt sDrlnmo;t0arxrmo oydopt ai o;s  2xo(o3iudop elfct t sDrr(  ot0oltnmoctldfs2uanmpnu4aeeoxrctadoat livi;t) 2uoxmpou4amtemicslt) 2urum ot0apenmoeiasfaDuauvo u)trerif3oadlpD  ueslt0trumxo3nudamtelnci s artm(  no0oeenmoetat m uan s;(4aeenxr tatfmDelnvo ( s2xmxr3ou1openlivils sDrr(r nt1alenmieiad aDranms u) ltnxf ia1lp r nvilt) rxrxrpnu4ap emncslsfsDtrxr oo4aleomf3tytls umuvsn()texnxfciatfmDeai s;t0 rur(r3ny4lmenmietls arrax  ;o0altoif3ilsfs2emu o t) rtnmo3oydfp   i ols seuoxm oo1ap   ictatfaDtrumoot1tleoioeiysla eluvont4 rerxfcoydoa elneo;( t2to(m3oydamtn neiatfaDtm(mpnu1tlt mi3ildfa2rm(ms u4arxrio3oo1la rlnvs s) 2xr(rpio1lptelies t arurxrpot4oeto ietlsls2um(vp;(4aleoxfciydopte uvsl()s2uoxo3no4lp  lnet ( s2umuroou0tetn icils aDrl( s;t4tltnio tydlptranvols s2xoxm3nudlm  lfct ( a2urx o;o0ape ifciltfs2ulnmp;u0 rtoxr3oytfatrlu i;( tetm(opio1lpee nei tfarrm(m ;u4opxomociatlm2rmn p t0 lxrirctotfm r ieol() 2umxm oo4lp n ivs tfa2umxm ;u0tltnmfeiltla emnms u0trtrmo ia1latrli ils  eurxm3iudlp nmnct t)aDurxro;u1olxnmf3ild a2umumont0tlxrxo iotlmD  n olt0s2tmiopoy1lp e neta() rtaxm nu0texo ociasfm2rmnvs;(4 rtnir iodoate n ilt srtmir3oodom e netas)artr(mono0alxo i3tasfm ua(vp;u0 lxoxo3oadlaD lnvo;()sexmio3iydapte fcsa( a2rmxm nt0teeo ictlsfm rm(mo;()tlxoiocoo1fp elu i;t)srtmxmpny1omt mfet t s2umum ot4apeo i3iatls rln p (0 rerxfciotop rln ils)s2uoio3oy1ol elnctatfaDraxmo;t1texoiiciydfs2uanmon(0aeenirciadla  luvi s  2urio3oodam nlfci t) 2taumo;t1tex  oeilsfs uanvs;u0 ltoio3totla rln olt0t2xrim oy4op  mict ( aDtrxr ;o0opto iciydla2ea(mp t) rtnmf3todomD ln o;( s2tmim ny4amtnlict s srtrx  oo1oex  fctas m em( pnt)texoxo tytlpt  u s s)srtriopoudopenmnesls  Drrxro;u4optoii3tltfa rl(mp;u0 lenxo3io1lp rlnvil()srxoiopiu4om emnetat aDum( pnt0tpt mi3tatla um( ont) exnxo3tytfptr uvslt tetmxrpiudaltn fvta()s2taump;u0tpxnmieildfs elu p t)trxoircta1omtrli i;t)teumxr3ny4ope mneilt)artaur ;o4aexoiietyd mDeanvs;t0trerir3iatlpD  neilt0 2urim3oydopenliciasfaDumurpnt4aet iicilsfm umu o;u4aexnmo3iy1fpDelu i;t)t2xoir ny1llte iet sfsrtax oot0oetn fciatfm el(mo ()arxrmrcoydfat  ues;t0srumxmpnu1lmt mnvil( a2umur ;t1tlxo fciysfmDelumo;(4 eerxr oytlmteli s s  2um(o oydlltnmivtatf Dtaxm ;o0alxnmfciasfsDumnmp;(0aexomoctydlmtranvo;s)teumxo3oy4oleelfvilt a2ur(rpot0alto iciatlmDra(vp;t4alxnmrctadom   nvil()s2uoir oodlp elfetls) 2rrx pot0opx mf3tlsfsDrm(vp;t) lenxo tatfmDrauvo t0 rxrio3nudlp n net tfs2ta(mp;o0oetoiociatlm2elu p u4aeenxr ia1lm r u olt)s2xrxm3iy1lm e fetl() Dtr(m no1texo oetytlm ua(mp t)alxnxr io1lmDrlu ils0s2xoxmpno4ame lfcsl( aDtr( onu1aee mfciatlm ra(vpnt4tlenmfciodlpDrlueilt)seumxr3oo1lle lfvia(fa2ur(m ou0opxomf3iysfsDranvs ()alxoiocoo1lp r n o;t srxr(r io1ape  feils srrmxmpnu4oleoifeiydfs2rl(ms;u4 rxnxr iatlmtranvols s2urim oodopeemivsltfs2tm(ront0oee mieild m2uanmo;u)aetnxfcta1lat lnvo;(0 2xriopio4am elfcias) rrm(roou0tpxoiicias a ea( sn(0tltoxo3ty1opteanes s)seurxm3iodal elfesl()arumu o;o0tpxomi3ilsls2emuvont) lxnmf3to1om rlueil(0 exoim3oo1ap   fet sfsDtm(r ;t1oltoifeiysfsDem(mp u4trtnmociydfmD  i ilt0 rtmxopiydlmtn ncta(  rrrurp;t4teeomietltla2rmu s;u0tlenircootfp r ueo;t0srum(r ou1ame mfet ()a2rmump;o1oeeoioeiatfa2em( p;()aexnio3oo1opteluei s)t2um(o iy4lme lfcs t  rrmx  ;o0olxo ieils a rm(vsnu) rxoif3ootlp  anvi s)truo(m ny1om elfcia()sDtru o;o0tpen o3tytlm umnmsnt0altoif3tytfaDeauei;t0 rto(m iy1optnliesls)srumxm ot4ale ioetltla2ulumpnu0 ltrxr3todom rlu slt0sruoxrpoodolee nvslsf Dur(rpot0alx  ociasfs2rlumpn()tetomfctotfatrli s;s0t2trxo iydlm nlfei t  rrrurooo0teeo ieildfm2uln p;()aexnxf iy1opD au o;t) 2uoim ou4omeelnciatfa2ta(m ;o0apxomieiasfa2uau p;() etomf3oa1faD  ies;t srurirpnu4lpeelneilt) rumu o;o4tpx  ociasfm rmnvo;t)arenmfciy1omDeauvol(0 rxoxr3oo1lltemict t)sDurxmoot1tpx if3iadlm rlnvo t0 rxrio tadfmD lneslt  exo(mpou1lm nmfctl(fs2ua(mp;o1tptn oeiys sDel( p t0teermr3tatlat auvils0s2tmxo oy1ap  mneslt sDraumoot0tle mociadfs umumo;u0arxrxf3totlmDeauvi;t) rur(o3iy4ape mnvtlt)s2uaum nu4tetn fciysfaDul( s u) lxnir3oytfm r i o t0trtoim3ou4lle  fes ( s2ra(rpot1ole ifciytfa2elnvo (0trtomrcoydomtrlneol( s2um(m3iydoleelnciltfsrrm(mp;o0alxnifctld s rlums;(4aexriocoo1latraieol(0tetm(opnu1amee ics s a2uaump;o4tlenmociydfmDran s;t) leomf oytlatelu i t)s2xmxm3iu1llte neil() 2raumpnt0tpxomf3tatfm2ul(vp;t4altnif totopDelueilt  2xrxr iudam  mfci ()arumuro;u1tex iociysfa2emu p;t0 exrxfcoa1fp  lnes t)srxoirpiodope lfesa(fartmxront4oltnif3tlt mDelumpn()alenxr oadom r uvol( sexm(o3oodome  nvt sfarrrx  ;o1tpxn fetysfm eluvp;(4tetnmo oo1fmDraieo ( srxoirpno4ll  mieias)s2tm(mpnt0tetnioeildlaDemu pn(0alerxrcoo1lmD  uvs;(0setrxr3iu1llenmfct ()aDum(mooo0alto feiydlaDra( s;() lxomfcia1oaD  ieslt trtoxo3no4lltemicslsf rrr(monu0ape  ieiydfm um( sn(0aetrifcootfp eaieolt)srtrxopoy4al nlicta(  2trxro;u4ole iietat a2uln o;u4texrmfcto1faDelueilt teuoir3oo1olenlieilt) rurxr ot0opxoifetydfs2ea(mp () eenirciadfmDrauvs;t)sexo(r ny4apee nct (farta(r ;o0apt  o3ild mDea(mp;u0trerirciodlaDrluvolt)trurxm ny1om   nvsls  rtax pnt4open fciltfa2ean on(0tlxoiocoadfmtraueil(  2uo(o nydal nlfct t) 2tmurp;t1tlto f3tasfsDuluvsnu0 exomf io1oaDr uvi (0s2xmimpiudopenmicil(  2rmu p;o4tee  ietad s2ra(mont0arenircoydoaDelues;s0srxoim oy1openmivslt a2taxmp;t4tptoiictydls2rmuvo u0 eeoxr iytfp r nei ()tetoiopiy1om e nesat arra(m ;o4tle ioetldfsDumnvs;(4arxoxfctydoa elnvs t) exmiopoo4amenliesl() Dtax pno4opxoif3iydfmDea( pnu4texomo3iadlaDr ueolt)seuoxr3io4llte nvslt a2rau pot0aptn o3tldfmDua( pnu)tlermrcoa1oaD  i o s0t2xm(mpiy4ll emieil(fsruau oot0oleoii3ilt a2rlumon(4 leniocootlptelu i (0t2xoxo3oudap elncta( aDtaxrp;o0aet  ocildfs2ean o;u) etrxo iodfaD  ivil(0trtr(o3oo1optnlfcslt s2tr(  no4apxomieilsfsDumu
\ No newline at end of file
@@ -0,0 +1 @@
+n i t0setr(m iu1ap e icta()s2ur( pno4teen i3iasfm2ua( p;(4arenxf3oatop r ivs;s0t2umxm3iydolt mfetlsfaDtrxmoot4ape ioetatlaDeln s u4arermr3oy1la e iesl(  rxmio3oo1olt lfeta() Dra(m ;o1aleomoetat a el(vo;t4texnmocio1fp rlues;s)t2trim oy4omte iviatfsDtm(mp;t4ope moeiltlm um( onu)trenio to1fpDraueslt) rtmxo iy4omte fvs ()srumumo;u4aeen o3tydfmDulumsn(4 eenir todoa eauesls  rxo(opoy1lme mfctl( arrr(rpno0alx  ociaslm2um(vo;u4 exomf3oa1omt aneils s2xmxr3iy4lp emnvsatfs2raump;o0oex  ociydfa2emnvs;t)alxnxocty1lpD ln i;t0seuo(r oo4lleelfvsa()sDur(rono4aleomo3tysls rmnvsn(0tlxriocoodoat luei s seum(r3nydlp nlnct (faDrmx ont0alt ifciatlmDra(vpnu)tlxomo3oo1fatranes;s)t2xoxr3iydal emfcta( s2raumpot0aeto ociysla emu pnt0teeoxfcoatfm eluvils teuoxr iy1optelnvt t)arrr( p;u1tlxnif3tys s2ra(ms;(4texomf ia1oatr i o;s0 2tmim iodam e fcias sDum(mo;u1tet mfeiltfm umn p u) exnifciydlat au ils)tetoiopoydol nmncsltfa2tmxmonu4tpt ioeildfmDem(vs (4aleomrcta1faD ln o t0tetrirpio4apte nvsl( aDrrxr ;o1tlt  ietyd s emn pn() reoxr3oy1omtr nes;s) rxoirpny1opeelfvta(f Drm(r nt4aee  ociydls rluvs;(0 etrmo oo1fmDr n il( setmir3ny4om nmnesa( aDurxrono0tle moctyd a2rmu p u)trenmr3totlm  ln s;( texrxrpiu4lpenmfvsas sDtru  ;o1tle ioctldlmDemnvsnu)tetnif3oa1oate ies;t t2xoirpnydole mici t artmxrpno1alen ieilsla2eau snt4artnmf oo1fmte i i;s)teuo(r3ou4lmtelivs t  rtaum ou4olx  f3tyslsDem( s u)tlxriociydlmtrau ilt0s2tr(mpiu1om   nvias)arurumpnt4oetomociytlm2eluvsn(0 ltrmf iatlateln ilt) 2urirpou1llt lnvias)arrrxm oo1apx mfeiys m uanvp;u4trermf3ty1lpte uvo ()texoir3iodol n nvtatf Dur(mo;u0ale miciytfa2eluvsnt4aetoir3io1op  lneo s  ruoxrpiodlmen fvsas)aDtr(mp;o4oetomociadfa el(vo;(0alenmfciytfm eanvs;t0teur(r ny4ol nlnvi s sDur(m ;u4tlenif3tldfa emnmo;u0 leoxoctodfmD lnvo s)trxoxo3ny1om   fvi tfsDtau  nu4tpeoiiciatfaDum( pnt) eenxf tytfp  livo t  exmio ou4ol emnctasfsDur(r nt0apxomfciyt s emnvs;t)tlerirciy1op   n s;t0seum(mpiu1op elnes ()s2umxroot1tee moeiat a2ulnvs;u) exrmr3totfa   n o s  2xrimpou4amt miciat) 2rmumpoo1aeenmicilsfsDrlnmpn()aeenirciadfp   n i t  euoimpny4al n ivtat s2urxmpnt1aexniocilsfaDumuvpnu0 renmr oadlat  ivsl( s2xrxr iodamee nct s  rumx o;o0tpto iciydfm2ra(vs ()trxnxo oodlm  an s s0trto(r oydamenlict s)srumuroou1tptomiciatlsDua(vs t4aeerir tatlp   nvo s0 euo(m3oydole  nvs tfsDtr(r ot1apenmoetat aDumuvpnt)artrmo3tatlmDrluvo;( srtmiopou1ol e nei t)a2trur nt0tlxnioctys a2rmumonu) rtrmrcoo1fpDran i s  rtmio iu1ll e fvils  Dtrxro;u4alxnmoetytfm eaumonu4 lenxo iodfa   i o;(0 rur(o ou1olt  fcsl()aDua( o;t0ole  octatls rmn ont0tltnmr io1op   ivslt)sexm(o3ny1lptnmneia( aruax  oo1tltoiietysls uauvs;u0trtrio ta1fa raivs s) rxoio3oo4altelfcsa()s2uaum no1texomfcils mDulnvo u)teeoxr3ty1fptr n olt)t2tm(rpoo1lmt  nvta()srtmu  ;u4olt mfetatlmDeau p;t0 etnxr oa1fa   i o;t0teuriopio4ll  mnes t)aDuauro;t1texo ieiyt m2eluvo ()aleoxr iotfaDelnvi;t)trtmxo3nu4lmtnlfvtasfartm( oou1tlenmo3iyt s umuvo (4 exnif iotfaD lies;()trurirpou1apte ncslt arrmurpot4oexnmo3tas a rm( o;(0texnifcto1fptranvo;s0 rtrio iu4optemnvi s aDumxr ;t1tex mieiyd a2rmumpnu)teenmr oydfpD  nvi s0t2uoxopoo4olt  ics t)sDta(rp;u4alt ifciad mDumuvp;u4 lxrxo iytomD aieil(  etm(rpoy4omtnlfcsa( s2trxrooo1opto oeildfmDemn pnu0 exoifciytlaDraivi (0texoxm nudamte icslsfsrrr( pnt0tpenmfctysla rluvonu0 lermf oo1fm   ivo (0s2to(opoo4lmtnmivi tf 2tr(  oo0tpxn feiltls rmumpnu4aeeoio3oodlmtrlu ol(0 rtm(r3iu4om emnvils) rrrx ooo1ale ioetlslm eln p;u0artrmf3oo1laD  uvilt t2urxm iydlp e ieilt) Dtaxr ;t0ape if3iytla2elumo (4 exrir3oodlptrai ilt s2uoio3oodlme  fcia()artmxronu4tetnifeiyd mDumn s;u0aexrmo3ty1fa rluei s0 rxrio3nodalt lncil() 2tm(r nt4tptnif3tldfsDrl(vo t4aexoifciytfp  lu o t0srtrxm oo4ameemicta(f Duau o;u4aexn fetldlaDelnmp;u0 rxrmr3iotfmte nei ( sruoxm nudll nlietls aDurxm ;t1olt  ietat s uanmpnt4tetrxfcoo1fat  i s ( t2uo(mpiy4lp nmivsas)arur( oou4tpenii3tadlsDemu o ()trerir totfa  livs s0 rxrxopou1llte ici t)arua(  ;u1aptomo3tytla ran ont0trtomociotomDelnvil() euo(opno4llee fcsltfsDtaur ot1ape io3iydfs rlnmo u) eeoif3iodomtrln ol() rxoim3oy4olt mfvsltfs2truronu1olen iciltls rmnvp;t4 ltnmo iatfaDranvs t tetm(r no1alt mfctl( sDtaxmont4tptnmf3tas a rl(ms;t0 exnmo ty1oaDe uvi;s s2tr(r no4ol  mieslt)srtrx pno1alx  oeiydla emump;u0 lenmr tydomt  iei s seuoio3no1lp emics (faDtaxrp;u4opx  i3iltfaDelumo;u)tleoxf3ta1fa  an i;s0trxm(rpiydoltn nvsat) rumxrp;t0aex  o3ildlm emnmo (0alenmf3ootfp   nvo;()trurim3ou4lme mnvi t a2rmxmont4opx  i3tls a2eanmo (0aexrmf3tytlmDelueslt trxmim3io4op nmfvils) 2rru  ;t1tlxo octadlm rauvp u0 etrxo iytfp   uei;t s2xo(m3nu4om elncslt)sDum( ooo1tltoio3ilsfsDelnmp u4artnif3iotomD  n il(  rtoim3oo4al n nes tfaDuax pnu4oetomictat m rm(ms;u4 rxnmrcoo1lpDeln s;t0t2uo(o3oy4ale  neiasf Duaxmoot4aet ifcilt m rln p u)tlxnxr3ta1op  au olt0trur(o no1omt mieilt) 2rmx ont4olt if3ildlm2ea( p (4 reoio3ta1omDrlu slt s2toxr iu1lm e fcils) rtmumo;o1tpx iieiydls2rm(vont) lxrmocia1lpDr uvs t0seurxrpiy4oleemnviat sDraxrp;o1olx iociasla elu s;u)tlxnxr iadlpD li i t t2urxrpoo4lm nlnetas  rumumooo4apt  oeiad aDeln s;t4 lenmf3oadlmD lu s t)teurxo iodlmenmfes (farumxmoou0tlt  f3tasfmDumnvp t0 rermfciotomDelueols0s2trxo io1ale  nci t)sDrmu ooo1apxoiociydls2ran s t) ltnxr oo1laD auei;s s2xrimpoo1lptelfct t) Drr(r ;t1opto ociys s em(mo u)arxoir oodomDr ivs t  rtr(m nu1open fcil(farraxr nu1optn feiltlaDeauvpnu0teenmo3ootfp  ai il(  2xoxr3iudop  lnct (f rra(moot0opx mf3iltfm2emumsn() eenio3iytfatelnvils)texoirpiy1omeemncslt aDumur ot4tltnmieildla2rm(vo u4arxoir iy1om eln i;s0 2xmxr iu4ap n nvs (fa2tax  nt0olxo fetydls rlumsnu) ltnifcoydomt ln o s0t2xrim3iudol  licsl(fa2rauro;o1opxn fciltfm2elu p;(4 eenif3tatom rauei s) rxrxm3ny1lltn fcias) 2taur nu4tpx iieiad a ua(vsnu0tlerxociydfpDr ieilt trum(r3oodol   fet sfsDtrx  ou1open ictlt a2uln o (0teeomrctydfmtraues ( trumio ny4omt lncia()srraxrpnu4altnmf3iytfa rm( p t4arxnxrcoa1optranei;t)s2urir nodole  fetat  Drm(mpno1oexn oetydfs rl(vp t)tlenif3oa1lp e uvo;t tetoxm3iy1apt livi sfaDurxmo;t1aleo o3ild a eau o;t0artnxo3iytlmte i slt) etmxopiodam elfetlsfa2ur(rpnu0tex if3iysfs emu pn()trerxf ootlaDeaues t0seum(r3nydape  icils artmuro;t4teeoiieiaslm ul(vo;u0tetnxr3iydoaDrau o t0trtr(m no4opte net (f rrr(rp;u4tpxnmoctad mDran o;u0aexoxf totopt aivs ()texrxr3nodolt  fetlsf rtmx poo1apxomi3iysls2ul(mpn(0 eerxo3ty1laD lu i ( sruoxr3nudapenmnei tfsrumum ;o4oeto f3tld s ul(mo t4 ltnmf3oydlptran o;s) rxo(rpnudlp emfct t)aDum(ro;t1oleniociatla um( snu) ltrxr oa1laDrlivi;t0srxr(o3io1ap  lfcsas aDuru o;u0tpenmoeiys m el(ms;t)tlermfciotfp elnvo;(0 2xmim no1amenlnei ( s2tau  nu1aptnmi3tas m ua( pn(0 rxoir3oodoptran s t)s2tmim nudamee nvia()sDtm(r no1aeeomfeilt a ulu o u0 leomr oydfaDeau s;t)trtrxr3nu1al elncs (  ruax pnt4tpto f3iytfaDeauvpnu)arerif io1fpDeaues;s srxm(o oo4ol elictls) 2ra( o;t4apeomiciltfs ranmp;u4trenifcia1lp   uvi t)trumxopoudopenlfesl() rrmxm no4opxn ieiys a2rmumo t) rxoxrctydoaD  ieo (  rtr(mpio1lptnmncs t  2uaxrp;u0alx  fcilsfa ulumsn(4 leoio3ootlatr nvsls0sexrim3io4opt liesltfaDrruro;u0aetnif3ilslm eluvs;u0trxrio3iotlp eli o;( srtoir3nydomt lfvi s)artr(mo;t4ole mf3tyslm2elumsnt4 ltomr3to1lpt lieolt0s2xo(r nudoltemivia()aDuax pnt4olx mf3iytfmDra(msnt4 rtoio io1lmD an slt  rtoxo3iudapeelnct (  rraxmono4oltn fetlt a2rauvsnu0texrmo3iotla  anvsls0srtoir3iy4op nmfei s)sDuau oou0teeo o3iltfs ua(mp;t4 eenmfcoytfat aieolt)teuoxo iy4amtnlnetlt)a2rru ono0aee  o3iatlmDulu s t0trtnmr io1lp rau s;()s2tm(o oo1amt  nvi () Dur(  nt0tle ioeiyt aDrau pn(4trtoif3iatomDr n o;() rtrxr oo1llee ict tfsruaurono1tpe ii3iatlsDra( p;t0altnmo3ty1fmD  uvs;()t2xmxo oudamt  fcsl(fs2rax o;t1opx  ieiasfaDul(vs;u) reniocty1lm   u i (0texoir oo1ole mfes sf rrau  ou0tet io3tytla umnvp u4 eenxr3oytomD an o;s) 2toxr nudape  ici tfsrra( pnu0teeomi3ilt a elu o;u)texrmr oatopD  ues;s teto(o3nodlle lfes (fs2trum oo4olt iiciys m eln o;t4 etrio tytfaDeaies;( s2tm(opiy4opt  ivsl( a2ua(r ;u0alxoioeildfa eln sn(4tltrio3ootoa  ln ols)texoir iu1lmee nci t)sDuaum oo4aexnifciysfmDuanvpnt) ltrif oodfa r nes;s0texmxo3nu4llt lnei t srum(r ;o1olx if3iad m2umn snu4 eeoxfcootlp e neol() exmir iudal elnes sf 2rm(moou4tlenioeiltfaDrlumo;u4arxrmr3io1faD lnes;s0s2umxm io1omt  nesas)sDra( o;t0apx moeiasfsDuaums ()tlxrif iatomte uvo;( s2uoxm no1lp   fctas aDumxmont0oex moetlsfa2ea(mo;u)texnxoctotlpDr ivsl(0trur(mpnudopt mics t) Drmu  ;u1aetoifcias m2uan snt4aexoxf3oatlaDeai s (0 rtmio3io4apte fvsasfaruru pnt1tet mfctad s ul(ms t0arerxo3oo1fat luvs;( t2xrir3oodam  licta()artrx  nu1ale ifctadla2umnvonu4tltoxrctotlm ranes s0s2trim ou4aptelnvi ()srur(  ot4tpxnifeiasfa ea( onu0arxomrciotlaD aieols0 rtoio3iy1ol nlieia()srra(m no4aetnmfeiadlsDrlnvsnu4tltrmociotlmtelieilt truoir3nudll e feia(f Drm(moou0apeoifcils a rau s t0 ltnxr totomDe ivi;t0srumirpnu4ll elics (fa2um( p;o4opxomfeiys s rlumonu4tlxrxr io1faD  i o s setrirpou1lp elncslsfa2uaxroot0ale micias m umnvs u0trtrif todla rau i;(0 rxoxrpio1amenlnetl(f 2ur(rpnt0aex mictltla rmn pnu) ltoxr3ty1op eanesl( t2xo(rpnydllen net tfaDra(mp;u0ope  feiyslmDraums t4areoxfciydfmtrauvols sexr(rpiu1aleelnctl(f 2tmu  oo0olxoifetltls2rl(mp;()trenir3ia1oatranvs;s)teurirpnu4am emiesltfa2tm(mo;t0apt  ieiat a2ran o (0 rtoif3iy1fp rlieol()trumio nydlp nlfvtlt) rurxmonu0olxnii3iytlm ulnmsn() lxnmfcta1omD lnes;()seur(m3iu4olt mnvias sDrrxmp;t0alxo feiltlaDelnvs;(0altoxf iatlm e nes;t  exr(r no1lmtelivi sfs2taurpoo4oeeo ocils m2rl(vo;t0 ltrif oatfateau ols0tetrio oy4lm  mfctas  2raxrpou4tle iocilsfsDean s t) etrxf3iytlatrau s s0 rxm(o oo1omte nvtat  rtm(ro;o0tpe  fciadlsDrluvsnt4 ltoxrciy1oa  luvi ()t2trim oodopt mivt s  2umx  no0open ociyd aDeanmo;u) eermo tadop rln ils) eurxm iydol  mfvsl()sDraxmpno4tetomociys m rau s t)texomr3iytlp eluvo ( s2umio oo4om n feia(fsrumxro;u0aleomo3iat a emuvs;u)alxoxf3iy1oa r uvs;s0s2umimpiu1ll emicsat) rum(mooo1olenmieiytlaDulnvs;t4tlxnif to1lmteanvo;s0 2xmxmpio4lptn nvi (farraxmooo1tlxomf3tltfm2uanmo u0 rxrmf3totfaD aivslt tetrxopiy4om nmnvil( srtau o;u1altoii3tldfm2rmuvpnu)trxoir iodomDr neol( srtrxo oo4amt mfetas) Drmu o;t4tex io3iatls um(msnt4 ltrmr to1fmte ieo s0 2uoxm3iu4amte nci tfsDtr(m ;o0tptoiiciytfm2uluvp (0texoio3oodfa  livsl(  2umir nydamt  ncta( a2rax pnt1alxn fetys m ean o t)arxrxfcoy1lm e ues;t)srxmio3nodlp   fvta(fsDraxro;u0ale mo3iad a2umu p u4aetoxo3io1laDr iei t0t2tr(r3iy1alt mnet t)a2tau onu1apxn i3iltlm eln ont0 ltoxr oydlaD anvols0 rumio iy1ope lfctatf 2taump;t4olx iieiydlm uan on(0altrxf oadfaD aivi;s0 rxo(m iydamtnmnvs sf 2rrurpou1apx mo3iltfs2ul( onu4 ltoxocia1la rlu il( t2xrxmpoodlm  mfctas)s2um( pnt0openmi3ild s2rlnvp;t4trtnirciatlaDelivs s) euoim oy4ope mieslsfarrrx pou0opt  ictydlm em( snt)trtoxr tytop  lu s ()t2tmxo oo4om  mfesls  rtrurpno4tltoio3tydla2rau o;u4 exnmfcto1lmtean ols)setrxopoy4omenlnes s s2rmxm ot1opt  i3iyt sDeanmo;u4aexnxrciadfat livo t)trto(rpny4ape mnciat)a2rmur ou4oltoii3iyd a2emn s;t0 exoxr3iydom eli o (0teurirpnudll   fvt s)s2ur(rp;u4aptomietasfm eau p;t0tltoio iy1lpteln o;(0seuoir ou1lm elfcsa()sDua(mpoo1openmi3ias s em( s;(0 reoio tytopteli slt0srxrxo oodlltnmiet (  rtmxmonu0opx mi3iltls eln pnt0 rtrmo tadfmt ln ilt)seur(r iy1olt mfesls  rtrxmpnu4tptnifeiadls2el(vp u) lenxr oytom rlu s s srtr(mpno4olee ivtlsfsrtmumpot4alxomieiadls ra(mon(4 lxoif iy1fatean olt tetmxr iy1omt mfvia() 2ta(ro;u1ale moetat aDrlumo;()tlxomf3iydlatraneo t0 rum(o3ou4lptnlieta(f 2rmxmpnu4oetomfciytla uluvo u0 rtrmo oytlmteauvs t trxo(r oydllee fcil(f rra( oou4oeen ictlsls umn p u)teenxocoy1lpDrauvi;( seuoxo3nu1olt  fet s)s2urxm ot0tptnmf3iytlm2umuvo;u0teerxo3oa1laDeli s s)s2uoim oo1ape  fvi t  2umur ;u1oexnmoeiysfs2rlu o;u)tlxomrcoy1lm eanes;t)teumio3ny1al n ics ()s2urxrp;o0alt miciasfaDrm(ms;(0tltrmo3iy1lpteluvo;()t2xmxo nydamtnlfcsl(  rtm( p;o4aleniociydls2el(ms t)tlerirciytopD aivo;s) 2umxo nudlleelnvsat)srrmxrpnu1aetnifetydlsDemu s t)alxrmfcoy1lmteaieil(0s2toxo iy4aptnmicslt s2trxrono1tex ifctatla uanms;u0 renmr3oadfp rai i t)seuo(rpno1om nlfvia( s2taum nt4oexnmietatfmDel(vp;u4trenirctatom eluvi s) 2tmim oodapenlnetas  rta( oou4oexnmoctld a rluvont0trxomrcoytla e u ils trumir3iudlme mieta()sDumxmoot4alenmocildfaDulump;() rtnif iodfm e nei () 2urio ny1omtn neslt) rra( poo1aptn i3tyt a2rlumsnt)aexomf3oa1la r ieilt sexr(rpny1lmenmieta(farurxrp;t0alxo oeiytfa rl( o u) rxrmfcoy1fp  ai s;(0teumxr no4ope mict s  Dta(r nt0alenifeiasfaDul( onu0aeeoio iodfpDeau s;(0setoir3nydopen fvs ()srrru  nu4tee mfctys mDrmn p t) exrif ootfaD  iei;s t2umxr3oy4apt mfeiltf Dtmxm ;t0tex iiciad a2rln sn(0arenir to1lpDrln olt)tetmxmpiy4amen fctl(farrmum no1oetoioeiatla rlu p;u0aexnmf iatla  lues;t0texmir iydoleemncsat a2tmur oo0oleoif3iyd aDum(ms;t4aeermf io1fatraues;t0 2urxm ou1lltelfesl()artau pno0olt ioeildls2emu p;()treoxrcoytopt lneils)seuoio3oudlmt mncsls s2rax o;o1texn o3iydls ea(vp t4aeenmociodop rau ols0srtoxmpiu1oltnmncs t  rra(r ou4tet mfeiadls2rmnmont4aetnifcta1fm   u s;t)texrxrpiu4ap elnvsl(fs2ururpoo0tpxnmf3ils sDrmums;u0aeeomo iy1fmDeauei t s2tmiopny1amenlivsas a2tm(r no0tpt mfctadls2um( o;t4 exrmrcoa1fpteluvi t)trxrio nydllee iviat)srtrx pnt4oetomociaslsDuluvs u4 ltoxf3ia1laDe uvs () rtmim oy4opte icilt)srtau ono1aexnmictat aDrlnmp;u)teerio3oatfpDeauvo t)trxo(o oodom nlnet ()a2uaum no4oet  ociytla2umnmpnt)aetomrcoy1opD anvols0 rtrxm nudop n ieia() 2ra( pot0opx io3tlslm2ranvonu)altrmociydlptrlnes t s2xmxm3oo4lp n iet (fsDta( p;t0tlt  fctad m ra(mon(4 renio oatlpteai i;t0 2xoxopoo4amt mfvta(f 2rau  nt1opxomo3tytla2uan o t4trenir oydla raies;t)sexoxr iy1alt mnctl( a2tmx o;t4tetn o3iadfs2rl(mo;(0altoif iodomtrlnvil(  exrio no1optnmneias)sDrrxm ou4alen ietydls uln p;u0texrircoa1lm e nvslt srxrxo3iu4alt mnciatf rrm(r ;t0ale ii3iat a2ua(vo u)texoif3oytopD  n i s t2to(o3oo1openlics (  Dta(ronu0apto i3iaslm eanmo u0tetrxf3to1fm r neo;s)t2umirpoo1amee netls s2rrumpnu0olxnmicias a2ran p (0artrmocootopD lnvs;()texoxo ny1lpee nvtas)sDum( p;u0tlxnif3iad sDrm(ms t0 etoioctadfm   ues t)s2xmir nodaltnlict t sruaxm ot1alto o3iasfs rluvs;u4trtomrctytoptrlnvol(  eurxm3io1lm n ncs () rtr(r ou4aptoioeildfs2ra(mp;t0 rxomrctatfmt li ils0 2toio nu4lltelfesat aDrax  no0tex moetatfsDuan pn(4 renmf3ia1lmtr neo;t0t2toim iy4op emics (  rtr( onu4oeenifciad a2ulu p;t0tleomoctatla   ueilt  rto(rpoy1apeemncta()sDurumpnu0opx mfciatla2eanvpnt)artnir3iodfm rluei (0texrir3iudamee fetat aruau pot4oee  i3tlsfmDrmnms ()trxrio oo1omtranesls sexoxr oodam  mivi sfsDrm(m ;t4apeo octlt m2uau snt4 rxoio3ootfm  livs t teuoxmpno1ol   nviat) Dum( p;o0ole mociadlm2rluvp;u)tleomf3ootfmDeli i;()t2uoir3iy4altemncta( srururp;t1altnioeiyd a2emnvo u) renmr oy1fpD  nei;s srtoio3ny1aptnmncsa( arrm(mont4apeoioctydfs rm( pn(0 lxrmocto1lpD luvs;(  etoio ny1ale mfetasfa2uaxrpnu4optnmo3iltfs elu o t4trxnxf oydlm e uvi;() 2urir3oydamt lici () Drauroou4aleomfeildlaDrmnmsn() rxnio iytomtrlivo ( srxo(m iodlleelnvs s artmxroot0apenmf3ildfmDeanvs;t)treoio tydomteaneslt)t2xm(opiydam nmnesl(  rrmxro;t1aptnio3tlslsDrmn snt)alxnmf tadfatrluvilt0t2uo(o iy1lleelfct s srrr(mpou0aexn f3iytlm2ua(ms;t4aexoxf3ootoa eliesl(0 exmxr nu4aptnmncslsfsDtmumoot4aee  oeiyt m rlumsnt0aexrir3iadom rluvs;()t2xrxo io4al   fvsasfs2uru o;o0aet iieild s2emuvs;(0trxoxfctydopDrluvil(0trtrxmpnu4lmenmnvtas sDrr(mono4optomo3tasfa um( o;t)artnxo oatoaD  n i;s texrxr3iy4lm e ictas  Dtm(m nu1apx ioctlt s2rm(vs;u) rxoxocoatlaDeln s;(0 exrimpiu1ll   ictas) Dta(mpnu4alxo ieiydls rmuvp;u0trxoir3iatoat  nvils)trxoiopnodllenmivtltfa2rmxro;o1aeeo fetas sDum(mp u4tlxnif3iytomtrluvilt seuoxm3nydll  livta(  Drax  nu4aetn oeilsfa2umnvon(0aleniociy1oaD ln sls0 rto(opoudlmte nvtas  rumxmpno4alx ifeiaslaDraumont4altnirctodfatean sls seumxmpoodol emiciat  Dua(rp;o4tlxn ieilslsDrauvo;t4 eerxf3oytomDrln s t)srumxr iudll   nvs sfsrtrxmpnu4oexo fetyd s2raump;(0 etoxf3ta1lpD li ol()teurirpiu4amtnlfeias a2umurpno0tle ifeild s2rmnms;u) eerio oy1faD  uesls0 2xoxo nu1lmeemfcilsfaruaxmo;u1apx iietytla2rmumpn() reoxf3tytlmDrlues s0 2umio iu4aptn nvi () 2rm( oot1tpto iciyd aDranmp;t4trtomrcoa1oatr ivsls0 etm(r3nu4lmenlfcta(fs2urxr ot1oexnioeiat m ul(vp;t)teerirctadfat lieol(  rtm(rpiu4apt  ies sf rua(rp;u1opxn i3ilslm elums;t0altnmo3tatlmDrlnei t s2xo(m ny1am nmnvi (  rrru  ou4tle mieiys m um(ms (0trxomfciotoatr ieilt) 2toxm3oy1aleeliesl( artaxm ;u4oeenioctld mDeln s;u)tltomo ia1lm rai s (0 eurxm iodolt  fcilt)srum(mo;t1oex  ociat m umnvs;u0aeeriociydlaDeai o t0t2ur(m ny4ll e fvtasfarrrxmooo0alx  iciltfs emnvsn(0 rerir oatfp e nvi t) rtoio3oodom n fes tfarumxr ;t4apen ietatlm emnvp u4 ltrio3iytom  lnvi s) etrio ou1aptnmfvtl(  Dtau pnu4opxn ieiat m eaumo ()arxoif totlpteauesl()tetrim3oodll emfvs () 2tmurooo4openmoctas mDua( s u) rtomrctadlm  auei;t0trumio nu1ap  lfvia(  rtm(m ou4altnmicild m2ra(mo;t4 ltrifcto1fa e i ol()trtmxm iodamenlietlt)srtrumoou1aexnioctlsls2ranvsnt)tltoxr io1lpD aiei s)t2to(o3oodlmenlivil() Duaxmooo0apenmfetydfm2ulnvo;(4 rxoircto1faDe ivo;s  2uoxrpio1altnmivtltf rur(root0apt  oetlsls umumpnt)arerir iadoateln s;s srxriopiodopt  fetlt  Draxroot4oexo ictltfs2el( onu4 rtoir iodlpD livi t0srumxm3nu1oleelfctasf 2rmx onu4tlt if3tadlmDemn on() ltnmociy1laDe ivo s0 2umir oydale mfci s srumx  nu1ape  ociyslsDrm( p;u4 rtoxf3ty1op   nes ( t2xo(mpno1ome lietlt)aruru pno0olxomfctltlaDra( o;t4 ltrmo3iytop rluvsls0 rxmxm3ou4omte fvsls) Dum(rpou0oexn feilslsDumnms;t4tlxnxr io1lptrlues;(  2trxr3oy4ll e fciltfsrrm(r ;o4optoifetlt sDulump t) eeomr oatlpDraues;( t2xrxm3nu4lp nlict sf Dtm(mpnt1tlxniietytlaDemuvpnt0trxoxr oa1laD lieo t s2toiopio4op elnciasfa2um(mooo0altnif3iytfa2rmnvo t) leomf oydlm   ieo s0tetmio3nudlmtnmicslt)aDrrxm ou0oetnifctltfmDem(mo t)alxomociydoa e uvil(  rtrirpnydomeelici (  2uaxrooo4tpx mi3iydfsDel(monu0 rxnmf3ty1la rlueo;t)t2urirpiudlpen fctl(f 2rrxm ou4ole iieiysfs2emn pn(0 lxnio tadfa e n i s) 2xmimpnudam   iviat  Drm(m nu0ope  fctls m2uan p u) etoir iadlm r ueo;s)sexmxm3ou4ole lfvsasfa2ta( o;o0olxomo3iyd s rl( p t0 etrio3iatlaDeli i s srxo(opio4apeelnvtlt srtaxmpno4teto icilslaDrmnvp (0trxrio ta1la eln s;t0sruoxm io4lm  mfvi ()a2ta( poo4alx io3tatlaDeau o t4tltrxo3oadfa e u ilt0trurxo io1optemicia( s2rru p;u0alxo o3ils a2ulums t)trtoiocoo1laDe uvs;t0srur(m ny4lpt lfctl(f Dtax  ;u4tpt  f3ild sDelnvont0aleoxr io1om elnvslt)s2xo(r3nudlp n ncilt aDrmu o;o0aex mieias s ranmonu0 etrmo iytlatr i i;t0srxmxopoodape mnetl()a2um(ro;u4aeto o3tld aDem( p () lxnmfciytlp eauvs (0 rxmir3no1llenlivtl()aDrr(ronu0alt  o3tydfa2rlnms;t0altnmr3ta1la  aivo;t0texoio3oo1ameemnvi ( artaxr oo1aleoiiciysfm rm( o;u4areoxfctytlpteli s;()sexoxrpio1amen nei tfs2raumooo1aex  f3tltlm2umn sn(4 eenxrcoy1lmtr n s;t0 2xoio3oo4ope  iet t)arua(  ;o1ope ifciyt s2uan p;u4aeeomo oytopteai i;s seuo(o3nydllee fei (  rurxmpnt4tptnioeiyd s eauvsnu)artoxr iydlp rlivo (  etrxm iudlpeemnetltf 2trum ot0apt mo3tyd sDua( p;(4tltrio3ta1oa ran i;s truo(m ny1ol  mics ()aDrru  ou4altoifctls a2uanvp;t0 lxnio oytlpt au i t0tetmxmpiy1amtn nvta(f rumumo;o1tlx  f3iytfmDeau s ()arxoif3tytop rluvi ( s2xmxr3io4oltelfvtatfa2taxronu1openmfcilslaDrl( ont0aleomr3ty1lmDelueo s0trurim oudalt lfvta()sruaxm ;t4opeomfetas aDuauvp;t)aexoxf3tytfaD  ivi s  2trxo3oo1oltnlfcs (f Duax  no0oeeoifciatfm2em(mp;t4 eerio3iatoa e ieol()tetrir ny1aptn fetl(fsrrru pnt1aexoifeiydfsDuln o t4 eerif3io1lmt  nvol(0 rurir3iudaltnmncsltfsrrr(m oo4teeoioeiyt a rl(vo t)tetrifciotlmt  n sl(0setrimpiu4omtn fvslt) rrru pot0tpt ioeiadls2emnmpnu4trerxo ty1fm   uvo ()tetr(o iy1lp  mfes s)aDraurp;t1tlxoio3iysla umnmo;u0teermr3ty1fpDeaivs;(0 2xm(opiudlltelfcs tfsruau p;u4ope ifctatlm uaump t4tetnxr totfaDrlu o (  exoirpiy4olt lfvtlsfa2rr(rooo4oee ifciltfa2uanvo;(4 rtoifciotlat  nvo;s teto(mpiydaptemnvt tfaDum(rpou0aexoiietys a2uluvs;u0aleomr3iadoa e ueo;s0setoiopnudom emnctat) 2taxm nu0optn fetysfs2ulnmp t4alxrxf ootom  anvs (0t2xr(opou4optelfctat a2tmumpot4apx moeiatla ulnvp;u4trxnmf ootlaD lnei t)texoxr iu1altemneiltfsrtmxm nt0tlxoif3iysfa ran s t4 etoxocootom rlu sl(0t2urim3oy1optnlictat) ruaxro;o4tpxnmf3iltfaDum( p u4texrmo3tatlateluvs;t t2to(r iydolen ietlt)sDuau  ot4tpenmf3iys mDra(vonu)aetnifcia1lpDrau il(  rumxo oydamt mfvs t aDumx pnu0aptnifciatfaDua( pnu4altnxf3oytlm r nvol(0t2xm(o3no4lme micsl(f rrru  nu4olx if3tyd s2ranvs;t0tlerif tadlaD  u o;t0s2xr(r3io1lmee fviat a2rmumoou4tlxoiieilsfs emnvo;(4tlxnxr io1omDrluvol()truoxrpoy4ll elieta() 2rmuro;t4alxo fciys s emuvp u4teermo3oodla  luvil( s2tmxo3oo1oltnmfcia(faDraum nu4opxnmf3tldfa ea(mpnt4trxrmf3iatlpt li s s0 2umxm3io1om nmiet s)aDtax oou0aptnifeiydla2eluvs u0 eeomrctodfaDeauei;(  rxmirpoudoleeliciasfaDur(ro;o4tpx mfeilt a elumo u4 ltnxr iotopD an s ( sruoxopnudomenlivilt  2trurp;t0oetnii3tadfs2ra(mo;t0 lerif3oa1lpDrai ol( srto(o oydol nmnci (fsrrrx pou4opxn octad mDea( o (4 lxnmocoo1fpDrlnvil( trumiopoo1om  lics tfarraxmoot4tlx  f3iatlsDumnms;t0 exnio tytfpteau o ( srxrim3ou4ale liciatf 2tmu pou1aexomi3iad a ea( o;() ltrxr3oytfpte iei t  rxm(m3oydalenlivtas)sruaxrpot0tleo i3ias m emnvs u4teenir3oa1lp  ln i;t0 2xoir3nodole livs ( sDumu ooo0tpxnifcild a2ea(mp t4tlenif3oatlate ivs;()setoxmpiodlpenlneia(f Drm(m no4ole  feildfaDul( p;t)texnxf3oy1lpDe i olt0trxmim3io1omte nvta(fsDurum oo1apenmietytfaDrln onu0arxnxf iodoaDr ieilt  rtrio3nudlmtnmicta( sDuax o;u1tpxo ociys s ea( p;u4tltoxrciotoaD ln ol()t2trxr ou1omt mics tfsDtrur ot0tpen fctld s ul(vo;() lxoif3oatom e ivols)tetoir io4lme lnctasfsDraxmpno0teeomfctatlmDeanvo t4 rtrmr3iatfaDeauvsl( teum(rpiudaleelicia()srrmumpou4aptoiocilsfsDeaump;()artrmo iy1oaDr i slt0srum(rpiu4ole mnvilsfarrm(roou1ope miciatfa rm(mo;t4tlxrmr ia1laD  nvolt)s2tmirpiodlmeeliet tfsDururooo4tex  o3iltfa rauvp;t0 ltrif tatomtr u i;s0s2umxm oo1omenmictls  2uru pou1apeomo3iyt a2el(vonu0 exrmo oadopt  n i (  rumxo iu1opee ncsasfarrmxm ou0aetoifeiytlm2rlu on(4alxnifctatoa e ivo ( s2tmirpny4lpt  ivi (faDuau  nt0ape  iciysfaDemn pn(4 leoxr tatoate uvo t0 rtmxo3nu1op elfct t)s2raxr nt0altnmfeiys sDranmsnt0 renmrcty1lmtelu i s s2tmim3nudlmtnmnvsat)artrxmp;u0oleo oetatfa2emnmp;u0tetrmo3oo1omt  uei;(0s2ur(mpny1alee ncias) Dtm( pno0tpeomietaslm rm( o () lermo tadoptrlueo ()srurxopnodam  livtas)s2tau  ;u1tle mieiltfs ea(mon()tltnmf3iotlmDe ivsl(  rxr(opoo4apenmnctatf rua( pnu0oleomfciyslm uln o;() etnio oo1oaD an ols)t2xoim3iy1lm   iesa(fsruru pot1opto i3ild s2ulu s;()trxnxfcio1omDrlneo;(0teumxr nu4lmt  iei s) Dumum nt0tptnii3tadlsDraumo (4 exoxociodlpte u i ()s2xmxr oy4ale mfct (  Dur(r nu4aetnif3iadls eluvp u)trxrxo iydla ranvo s0 eumxo3oydamt  ncias srrrum nt1opt  ocild s2um( s t4altoio tydlmDrluei;( t2xr(mpiu1am emivsls  Dtaumpoo0tpx  o3ildlmDulnmo;(0tltomfciotfat auvi t  2uo(o ny1lp e iesl()s2rrxront0tetomf3tyt m ua( o;u4arxnir3todoa rln s;t) rxr(opoo1alenmnvils  rrr(m oo4alxomfetas aDrl(vs () rtniociotfp eaivo s)trurxopoo1aleelnvtat)arrrumo;t1tetomo3ils mDemu snt0treomfcta1lmDeanvi t)tetoirpiydape lfetat  2trxroot4oltoiociyt mDumums;() exrxf3to1fptranvs;(  2trio nodllt lncslsf rtruroou0aee iiciytfs rlu p;t4aexoxr3tytlat  u o ( setoir iu4ape  fci ( aDta(m no1alx ifctldfa2rmu p ()artnio oytla rauvs;s0 2trim3oo4om nlnvs t)a2urx  ou1oetoiieiyslaDemnmon(0 eeoir iadom raiesls)t2xrxm3ny4ll nlivi s aDrr( o;u1optn iciadls ea(mo;t) rxomo3oydfmDraivs s  exmim nu4am elneiat) rumurpou1opeo fctldfs emu s u) ltnio ia1lpDr iei;t t2tm(r iu1llt lfeils)arua(roou1aetoif3tlslsDem(ms;t)tltoxrcoodlpDeaivsls0trxr(rpiodomtelfcsatfa2rrxm nu0oleniiciat m rmump;(0 etomr3ta1oatr n i;s s2umiopoudame  ncsl() rurxrpoo4tlxomociyd m eln p;u4 ltnxfctytfpDeaueo;s  rurimpoydll nmncslt) rtrxmp;o1open feilt m2umn pnt0trtrmr to1lat au i (  exoim oy4lm   fvi (f Dtrxrpoo0apxoii3iyd m2umump;(0artoir iadfp  auvsl()seuoxr oy4ameemivil( aDtr( pno0oeen fctyslaDrm(vo;u0 etoir oytoptelneil(0teum(r3iodap e nes ()s2rrumpno1aexnmo3iydlm2elu p;u0artrio tadoat  i s t  2xmxmpoo1open ivia( s2urxrp;u0tltnmoctatla2rl(vonu)alerxfcoydop   n i;() exmxopny1omt lnvsltf Dtr( p;t0alen fctyt s emumont0 rxoxf tytlaD  uvo;t)teuo(o iu1am  lnvi t artrx  ou4tee  o3tyd a2eluvp u)aetnmr3iotfm eln s ()srurim io4apee fvt (f rtm(mpno4optnmfciadlm rmuvp;(4 lxrmr ty1om e ies;s)s2xr(o3nu1op  lfeiasfarrrx  nu4oeenmociltlm2uan ont0tlxrmf iytlp   n il() 2tmxopiu1op n fcilt srtaur nu1aeto ietyd m elnvsnu0aeenxr3ty1oatr ivsls)seuoiopoudamen nct tfarraxr no4altomieiad s eanmsn() lenxrcoytoaDeli o ()sexr(o3ny1lpt lneil( s2tmxm ot0tlt iociytlm um( s (0teeomf3io1opDeai o s) 2umio ny4lp e fet s)aruaxmpou4alxnmietltfa2rl(mpnu0trxrxo iatop elnvs (0 rxmirpio4ameelnvtl()srrau  no4alen i3iadfsDrl(msnt0aetrmo3ty1faD an il(0sexmxopny4lle  fvsatf Dra(ro;o0apxoiocias sDulump (4aetoio ty1lmDranei s0t2xm(m nydlpt  nei s sDtm(r ;t4tpe  o3ias a2um( p;() rtrxf oydfpD aues t)teuoiopoo1olen ivsasfa2rau  oo0olxomfetld m elu ont4 lerir3oa1lmDeluei t) exo(rpiu1ap nmncia(f ruax o;o1tlto feiltfa2ul( s u)tetrmo3to1laDelu s;t)s2to(o3iudalte nvsl() rtmumpnt4teenmfeildlaDra(vpnu4 etnxf3oodop  ln i (0teumxm3iydlm n ivsatf 2urxmo;t0ale  o3iyslm uanvs;(4texoir tydlp rauvi;s  rxrio3iudlmeemivt ()sDtm(monu0opto o3ild a2rl(vp;(0 etnmrciadlpDe nvsls srumxmpiudam n fciat)aDurxro;t0alen f3tat s ranvo;t0alxniocta1fmtrai o;(0 eur(r3oo1al e fei s srtmxmpot0oet moetls m rm( pnu) ltnircoatoatr ivilt0s2uo(m3iydope  ncsls)arum(m oo1aex mociadfaDumumonu) lxnmf oadfp  auei;( srumio3oy1altnmncs t)a2rmum ou0tptnioeias aDumump;t0treomr3iodopt  u s;s) 2ur(r3oydalenlictas s2ra(  ;o1aex ioeiasls2rmumont0 rxrif iatomDrlieo ()s2urim3ou1lptelfetasfa2tm(roou0opxoifeiytfa ra( pnt0 etnir3io1omtrlnvsl(  exo(o3no4lm   fvt () Dtaump;t0oeen iciad aDemn pn(0aetnxo3iy1lpDranvslt0 exrxm3oo1omt lici () rtau o;t4alxoiiciytfm umnvo;() ltrmf iy1oatraiei;( sexm(mpny1amt lfetas s2umxro;u0tee  ieild m2uauvp;u4 rtnmr tatomDeanesls trtm(o iy4lmenlnvia() 2tm(m ;t0tetoif3iat s2ran o;(0 exnxf tydfp   ivsls srxoir3oy4am elictl( s2ra(  ;o1oexn i3iltfm uln o;u)trenmr to1lmDraiei ()t2tmxo3ou1apt  ieias aDrr(m nu0olx  ieiad a2rl(mp;(4 rtoir iydoatrli s;() 2xrimpoy4altnmivt t aDtmu o;u4aptnmo3tlt s raump t)tltrxr to1op rlnesl(0t2xm(m nudoptnmneslt srrr(mpnu1alt ii3iydfsDrm(vp;t) exoxfcoytoaDeluvo s0 ruoir3oudlltnmfvsasfaDuaxmpnt0oleo fetltfaDeau o;(0aeenif3oa1lp  anvil( s2toxo nu1om e ici sf 2rax oou4apenifciyd sDulnvo t0teermrciytlptr nei;t)s2uoxmpnodapt  fvt s srrr(m nu1apeomfeias s2um( pn(4 rxoxo oytlm   u s;t0trumir iudape mivias)arrm(rp;o4oetnmf3ildfs2el(vo (4texrir3iatlpDr nvo t0teur(r oo4lmtn ietlt) 2umxmpnt4tlx  fetlsfaDrmu on(0tlxrifcoodfpt ln ol()texm(r3ny1lp   nct t)a2trur ;o0aexo fciysfm elnvo t0tetomo3oadfpDelu s t)seumxrpnu4om  mfvsl(f 2urum ;o0ale ioctat a2elu s t4 ltoxrciodlmDelu o;t t2xoio oudame mici sfs2ra(monu0aeeomf3iaslmDum( on(0aexomo to1fmt aieil()texrxmpny1lpeelfesl(  2tm(rpoo1olto o3tld s2uanmont4 ltomf oodoaDe nvils)texmiopiy4lme  fei t srrrx o;t4tlxnmieiatfm2rmumsnt)texnircoatop r uvi ()teumim iu1amtn ncta()sDuaxr no4oex ifeiatlsDuanvonu)altrmr3tatlp  lnvi t) 2xmiopiy4apt mietltfsruaur ;u0tltn o3iytfsDuanmp (0 rermfciadoptelu i;s0 rtrio ou1omtnlivsatfsDtrur ;u4aeeo o3tys sDeln on()teeoxfcia1opD  i s;t0 etoxopiydlm elics t)aDrrxmoou1tlto oeiyd a2rl( pnu0trxoxo3iydlatelnvi ()trtm(mpiy1amenmfesatfarrrxrpou4alx mictldfsDel( s u4tlxrxf oydfpDelues t)t2tr(r3oudol  lncsls  rurxm oo1tee  ictat a2ranvp t)aetrio oydfp  lu s s0s2tmxr3ou1om nmnctls  Drmx p;o4oeenio3ias a uln p u0tltrmf to1fp e uvo s0 eum(r no1lle lici t artmxrooo4apxnmoeiyd a2ra( o;u)arxomo oo1fpD  uvs;t0t2umim oo4amtn nvs s a2uau  ;t4aetniieiad mDrl( o t4tlenxr3oydopt  uvils  exmio nydapeemivia(fa2ua(rpnt0aetnmocilt sDrl(mont0tetoxr3tatlp  luvs s)texoxo oydal nliei sf ruau pou0openmo3ildfaDrmu p () ltrxocio1lp  aieslt)t2trxopoo1omt lfvslt)s2uaumpnu1apxoioetat s2rmn p;u4 exrircoadlpDelues;s0 2uoxmpiu1lleemfcslt srraxm nt1tet mo3tyt m2eaump () eeoxr oa1op ranesls s2uoiopiydlm nlncia() 2rrxmpnu4tlt mietydfm rlnmont)aeeomo3oa1fmte neo s teurio3nu4lmtemivslsf 2uau o;t1teeomicilt sDrlump;t0aeerxo tatom rauvs;s0t2uo(m3iydamen fvi ( arrm(m ;o0opxnmiciyd m2ul(vo t0teenmf tadlp elu s t) eurxo iudal nmneslsf 2rm( o;o0oeeo ieiasls rmuvs;() lenir3ty1fptrlnvi t0trxm(rpiy4lmenmfci s) rur(ro;u0ole  ietyslm ea( o (4aeenir3todfateai o;t0tetrim3io4lle mfcils arurxmpno1tet ifctytlmDeluvo u)tlenif3iadfm  ai o s  exoim iu4amtnmfcsatfsDtmu onu4aeto iciysfaDeauvo (4altoxoctotfp elu s t  exrxm ou1ale  net s)srumxronu4opxomoeildlaDul(vpnu0 eenir ta1omt luvi;s) 2to(m iy4optnmnesa( a2tru p;t0tle ifciytls umu on(0 exomo ty1fptrlueo;(0t2trxm3nudameemfeta(farrau  ;u4aexomoeiytfmDrm( p t0trerxr3oatfp  au sls) exoirpno4opeemfcia() 2tau p;t1apxoiictlslmDrm( p () exrxfciytfat lnvo ()tetoxm3iodaltelfeils) ruax pnu1alxoifetls s rmn ont) lxomf3tydom  auvo t0 2umxmpnodal   ivi ( artaurpno4aee mfcildla rm( snu)texrxrciy1omDrluvi s srxoxm3iy1op  mncsatfs2tm(  ;u1aetnifciyt sDrmums u4teeoxrctodomDrlnvi t0srumir3ou4am emnct t)aDum(m ot1tlt iieiydfs ulnvp;() rxrmrcty1opteanvo;t trxoirpiydale lneslsfs2tm(rpno4alx ioeildfa2rluvon(0 ltoxo3oatlat luvols  exmirpou1ap   fesa()a2um(r ot0oleoio3tld a rauvont)aexrirctadfp  au il()trxo(m oydlmenmncta(  2umumoot1aleoifciatla2elnvpn(0artrxo oytom  aneilt0trxmim oo1om  mfcta()aDtmur ;t0alen icildfsDeanvo () lerifcto1omtrli s t  euoxr3oudlpe  fci (f 2tauro;o1tex io3iysfaDemnvs;u)trtrmocoytlm  an i;t0seumir nu4am e nes t  2uax pot1tpt  ieiasfmDumnvo;(0 eeomr3io1lateluei ( srxr(o3nudap  lies s  rurumo;t1oltnii3ildfa emnvo;t0 exrmfcoo1lpte neo t trto(r iodllt  fci ( arumxm oo4tpxniieiydlsDrlu snu0trenif oytoaD lu o s t2triopno1amtelfes tfs2ua(ront1apt mi3iytfaDranvs u)aetrxr oo1lp   u o;(0sexrxrpiu4omenmicilt)arrmur ou0olx io3ilt a2ranvp u0 exnxrcoatfmDe ivo t0 rtr(opiu1ll  lietls a2rr( oou1teeo f3tat aDum( pn(4tltnxf tydlat auvol( texoxm ny1lpe lnei t sDuau  ;t0aet  ietad mDrmuvp;t)texrxocoodfm r uvo s)srxmxr3io1ll emnesasfsDrax  nu4alxniieiydfa2elu p;(4 reomr ia1fpt  u ilt) etrio iudameemnct () rum(rpno0tee ifeiatlm rl(vp;u) renxf3oo1lptrliei;s0texr(o oo4am nlnvtlt) 2uau  ;u1apenmieiasls umnmo ()aeenxrctytfaDranvsls srxrxr3iy4llt  fesltfsrrrump;t1apxnmo3iasla2el(mpn(4tlxrmo ta1fmteaneols s2xrio3iudopeelfvta(fsDtmuroot4texomf3ilslm2ul(vp;u4aexomo3oodlm   nes;s  ruo(o iy4oltnlietat  2ur(moot0tpto ictydla2eaumpn(0teeoircootfaD lnes ( srxoirpou4omenlici (  rraxronu0alt ifciadlaDuau sn() eenir iatomt ai s s0trxmxrpno4lm emfcil( s2ra(m ot4olx ifeiys m2emums;() eenmo3io1fp ranvs;s0srtmio oydlpt lici () Durx oou4texo feiys sDelump (0tetomf ia1fptelnvo s) rurxopou1amt mfvtas)srrax oot1altomfciatfmDrauvo t0trenxociodfm ran sl( t2xo(m nu1am nmncsat a2umxmpno0teto fetadfs um(mp;t)altnmf3tydomtrauvs;( texm(o3nydalee fvsl(fartaxront0alxoii3iys sDeln p u0 exnxrciatfat ln s (0trxmxr3iy1ole  fvs sf 2rm(rpno4tltnmi3iydfs2rl( p ()tltomfcio1opDe uei s0 rtrxmpny4ame lfvsas srua(m nu0alxnif3iasfsDelums;(4tleoxr3oo1lmt  ieo t0 2to(opnu4ape  fvs ()arta(mp;t1apenmi3iat mDrmnmon(4aexnio ia1lpte nvolt  2umim3no1lltelies ( srumumo;o4olxnifctyt m ulumon()alxrmf3oytla rln s;t trxrxmpnydol n ivs s arra(  ;u4tet miciysla2uan snt0trtrif3tydfm e nes s0texmirpno4olt livs ()aDrm(rp;o1tlenio3tyt a2elnms (4 exoif3oytlpt liei t0tetoimpnu1ol elictlsfa2rmxmp;o4aeenifciadfmDeau pn(4 eenxf tytop raiesl() rurio nu4opt lnvias) rraxmpnu1tet ii3iadlaDra( s;t)aeeoifciadfa e ivo;s sexoxr nu1op e ieil()sDumx pot4oexniieiadls ulnvp (0aeenio3iadla raivslt)setmxrpiu4lmt lictl(f rumumpnu0apt iictldls2rau p u0 exoxr ia1oatelneo;(0 2umio3nodapen neil()aDra(rpnu1tlxoio3tys a eau sn(4 rtnmoctadop  auvi () rtm(mpno4ap nlncs t)s2rr(m ot0oeeo ociaslaDemnmon(4trenxfctatlp  lnesls0s2xmxo nu1omee ieils)arum(rono4oetoioctldlsDum(vp (0 eeoir iy1fm rluvo;t  exm(opoo1lm n fei (faruaurp;t4apxn ieiadfs el( p () rxoif3oy1omDelneolt) 2um(mpoy4oltnmietls sDtaumpoo1oleniiciys sDulnmsn(4teenmo ootlatr neils0t2tm(o3oy4lmeelnet (fsrur(ro;o0apx ii3tyt aDuanms (4artomo3oodoatranvo;(0tetrim3io1olee ivt t  Dta(mont0tltnmo3tytla ulu o;t0tlxomocoy1fmDrauei s0 rto(opnodam   fet sfartrx p;o1aex ifeiat sDrm( o t0altrif3oo1opD  uvsl(0teurirpnu4om emfes s a2trum nu4apxnifeilsfs2emuvonu) ltoxrcta1omDrluvi;t0srtmiopoo1lpen ncsat  Drmxm ot4tetoifeiatls2rmnmo u4altoxo3oy1om  luei;t  rxr(o3oo1llenmfvsat  Drax oou4tetnmf3tydfm2emnmp (0 eenxf iodla eau i t  rxoiopiu1amt miesat sDtr(mp;t4tpen ieiyd sDelnmo t4teenxr iotlaDeln s s0teumxmpoo4lptemictl()sDrr( o;u4tetn ieiatls2ra(von()areomociytfa rau ol( trtoxm3io4ome mics tfarta( p;o0tlenmoeild sDuaumon() rtnir tadomtraneils srxoio3nydome  fvtat  2umum ou0aex  ociydfa ulnmo;t)artrmfciydlatrlues;t)t2xoir iy4aptemicils) Dumuro;u4aptn i3iytla2rl(vpn(0 rermr ootla rlnvs;( setr(mpiy1ap elfcsat  2ur(rpnt4ale ifetld mDrlumo t4 reoxo3ia1fat lieols0 eur(rpnydlltnmietas)srtmu  ou4ape mieiyt sDrmnvp;t0aetrifcootfa  lu o t  eur(mpoy4omt  icsas) rra(mont1texo oeildfs ranvp;u)aetrif iadfpD  i i;() 2xoxm oo1ol   fvs tfs2uaxmonu4alxo f3iys s2ulnms (4 rxrxf3iydlatr ues;s teumxm3no4lltnlies t  2trxrono4ale  f3iltfa eln p (0arenmocootla   uvolt trurim iydalt lnvils) 2tmxmoou0altn i3iysls umuvs t4trtoir tatom raivs;s0sexr(opiydap  mfesas)s2tmxr nu0tlxoio3iytlmDem(vpn() exomo3oadoat  ivi t0srxrxm3iy4ap elfeslsf Drrxr ot0oex  f3tydlsDemnmp;u)altoxo3io1oaD lues;(0srurxopno4al  lfei s s2rmxmont4oeeomieiysfsDea(vo;()trxoxo3iadopDrluvi;s)trtm(m io1llenmivta() Drmx ont1oetoiiciad s ea(ms t4 eerif oydlpD livi t)setoxm3nudlptn nvtls srrru  oo1oet moeiydfm ra( o;u)trxomo3oadlm eaueo;t)tetmim iy1aptemfcias srtau  nu0aetnmoctasla2uauvs;(4 rerxf3iadomDraieol(  rtoxr iydolenmfei t srtmum no4opx iiciaslmDeanms t)trxrxr3ootfatr ivi;t)s2tm(o oo1al e neta(  2taurp;t1oetn f3ias sDrl(ms u)arxomr iadlaDrai i;t0 ruoimpiodam   nviat arta(rpnu4ope iieiydls rl(mo t4 rxoif iotlp r nvslt  rxmxm3ou4al  licil(f 2rax  ;o1alxoiieiatfa eauvo t0teeoir oo1lm elues;t0s2xmxopiodlp nlicia() 2tm(root0ale  f3iys m ua( onu0 rtoxr3oodopt  ueo;s0 rtrir3ny4om  mfcs ( s2um( pnu0apxomf3tat a elnms;u4tetomfciadfa eaies ( s2uo(m iudlpte fviasfaDumx pot0aee ifetldls ranmont0artnxf to1lpDrluvs s trtoimpnodol e fvta(  Dtax p;u0opeomfetytfa2uau p (0teenio iatfmt lu ilt setrir nydolenmnei ( sDrax oot4teeoiiciytla eanmonu0texomo3iydlmt lues ( sexrimpiydaptemnvi (fsrtru p;u4oetomoeias a2ea(vpnu)trtrxo3iadlaDeaueo t) 2tmim3nu4aptelfvs ( arrmumo;u0tex mf3iasfm rlump t4areoif3totlaDrlivs s)s2ur(rpou1oltnmfvt t)s2ta( pno0tlxnioeiytfm emumo;(0tltoxfcoydom raivo;s0tetoir3io4op  lfvs ( aDtm( ono1tpx mf3tlt mDem(ms (0aexrmo ty1fmt  n i;s0 2tmxrpou4optn fesls)a2raum no4opeomoetad a2rmnmo (0tetrir3oy1oa e nei;(  exrim3nudoleemfvilt) rtru  ou4alx mf3iyslm umu p t4 etoircoo1faDeanvols teum(r nudamtn fctltfa2rr(rp;t4tleniicilt a2elump t4texomrcto1lpteaivs s)srurir iu1omen fcs tfaruauroot1aeeoiictys aDelumonu0 leoif3iodlat aueil(0s2tm(r3iu1apt mivi t s2urur nt0ale mfciat mDeauvsnt) rtnif to1lmt li sl( trxoiopiodlpte ivt tfsDuaurp;t1aex miciyd s2rm(mo () ltnio3todfmtean ol() 2uoxopny1lmt lfvsls s2raxm nu1oeenmi3tldlmDrlu o;u4 reoiocia1oa elnvi;s texoir ny1lm   fcs s aDtaum nu4alxn feiatfa ea(mo;(0tlxrxo3iodfatranvsl(0 exr(rpnudamt  fetltf 2ra(rpoo4texn f3tad mDeluvs () renio3oo1oaD lnvo s) etriopnu4ll   icia(  ruax ont1olxniocildfm ul(vsnu0artnio3ia1laDraneo;(0t2toirpno1olt mncslsf 2rau  no0tlxn i3iaslaDrm( p u)teerxrciotfaD ai o;()s2uoxr ou4opee fvsl( aDumu  ;u0tpen o3ilslm ulnvonu4artrxo totfm elnvols trxmxr nodoltelnvsls)a2rm( o;o0ole  iciysfaDea( s u4trtnxocoydla e ivols)trtr(r no4lp e fvilt) 2raxr ;o0opx mi3tyd s2uln sn(4 rtrir to1op elnvils  exoimpoy1lltnlivt s srtax  ou0tltnii3iasfa2ul(vp t)aeenmfciy1latraneolt0s2xoir nu1lp   ies ( sDra( oou0ape mfciyd a2rlumsnu0 exrxo io1oaDrluvo t  euoio3iu4lleelfei s aDraxm nu4apx mictld sDrlu o (0aeerxoctydlmDraieo;(0 exmim oudlm nmnct t)arumumpnt0aptnmieiaslaDulnmp;t4aetomo totfp rlu i;s0 eur(o nydoltn fvsltfsrrau  nt0apto i3tys m umumont4arenxf3iatopDr ivi t  rxoxm3ou1altnmnvsl(f Draur nt4opxnmfciydfaDrlnmp ()texnmr3oatop  aivo;t)srur(m3oudomt lfviat)aruau p;t0opt mo3tlt sDum(msnt0 rtoir3iatfa eai s ( seuo(o oo4ll  mfetas)aDtau o;o1alen icils a2ulnmsnu4aeenxrcoadfpteln s;s0 2um(m3no4lm elieta( aDraumoot4apx mfcildfm2emuvsnu)texnmf3ty1fa eluei (0 rto(o3ny1olt  ici tfs2rm(  oo1apeoif3ils a2uluvpnu4trxnxr iytopt livi;t teumir3ou4lle  ics s  Durx oou0tptnioeiytfs2uau s t)texnmfcto1fp  li i s0 2uoio iu4ameemfcs sfaDuaumo;o0aeto iciysfs elums u4altoxr oo1optelnei;(0 rumxo3iudlme  nei () rrru  nu4tpe  oeiyt s rmumpn(0 reoif3oatomDrau s;s teuo(m3nu4lmt  icsas)sDra(mo;o0aeeo feild a2eluvp (4 rermo iatfmte u s;s0s2toxmpiudlmtnlivsls)aDta(  ;t1aptomoeiltlm el(vs t4altnxo ia1omt au s t t2xo(opny4omtnmici s a2tru onu1tltoiociadlmDrmumo t)altomoctatlmt lneol()trtoxr3oy4omenliesa() rtaxr ot4oet  o3ias a2ul( o () rtrio todop  an il() eur(r3oo1lptnmivi sf 2ua(monu1optomoctysla2ra(mon(0trxnmf iodfpDranvi;()trtoim iydap e ieslt arraump;u4aetn f3iasfaDua(vs;u0arxnircoydlm r ivsls)sruoim iodllen net t s2rm(rooo0olxo ietatla2rmuvs (0 etoxrcty1om rai olt0 exmxm oo4oltemnei tfsDrrxront4opxnio3iys aDrl(von(4aetnio3oodopD aueols s2uoxrpiu1ll   fci s s2um(m nt1ale mo3tad m2rmu p;(4 eeomfcta1la r n ol(0 rxr(opny1lpe livias) Drru pou1oex moeiydlsDrmnvp;u)alxrmo3ta1omDelu ilt)s2uo(m3nu4ol elietas artrxro;o4aee  ictldfsDrmuvs;(0arxomo totfmt lnvi t0 etm(rpny1oltemncsatf rumx onu0ale  oeiadfm2emnmsn() renmo tydop  auvs t) eum(r3io4am  lnviat s2uau  ;o1oexomfeilslm2rmn pnu0teeomrcoy1lp eaivsl(0trtr(rpoo4lmen fci () 2rmu  ou0openiiciyt s rmuvp;(4arxnmf oatla ranes;s)setrxopou4apeemneiasfarumum ot4alxomo3tytfa rl(ms;()tltomr3oydlpDelu slt s2umir nodom nlfctat sDtmumooo1alx  fciysfsDulu p () rerxrctodfpt  ues;t setm(o oodalt mnei () Dtr(mono0oex mfeils a2eanvo (0 etrxr3oydfmD ln ils) euo(m3oo4ol emicil(  Drm( ono1tleo o3iyslm2ea(vsnu0 rxoxrcio1fa eanvs;t0 rtmxo oo4ap nmfvias sDtrxr no0teeo i3ils sDeanvo;(0 renifcta1latr i ol() rxm(m3oo4lm emieilt)a2rmuronu0oeeniieiasfmDea(mo ()artrif3oy1laDran i s0trtmir3oy4omt  fcs (  2tr( o;u0tex iietasla el( s;u4altrxr tadlm   neo s)srxoxm3no1op nlfvtas)a2tmx ono1tpeoifeilsfa rl(mo;u0alxnxo3iodla r uvslt sexrxrpou4lmtn ivs s) rtm(root1oexnifeiysfm eln o u4 lxrif iytfp r ivo;()tetr(opiy1ale mivi s)arua(r no1teen feiyd s2uanmpnu4alxrxf3tatop elivsls)t2xoir nu1alte neias)a2ta(r ;o1apeniictld mDulnmonu)trenir3ootfaD li o;s srtmxm3oodap  mivsl(f Dua(rpoo1oeto i3iatfm2rlu pnt) lxomo todlptr uvs t0srurxr3no4olt mivt s  rrrumpoo0tpenifetydfsDrmuvs (4 reomo oodfaDe ueslt  rxmim3iydlmen nvi s)a2uru p;u4oeeo o3ild mDea(vs;u4trtnxo3iadoa r i ilt tetrio iodole  icilt sDtaur nt0tlenif3iysfmDul( snt) rerio tytla eau s () rum(r no4ale mfvil()artrxmp;o1tptn i3tatlm eln s;t0tltriocoydomt  uei;() 2xoim ny1apenliviat a2raump;o0tpxomo3iydfmDul(msn(0trerxrcoa1opteliei;s0teuo(opiudlptn fcils  Drrx  nt1oleo o3iydfmDumnms;u) rtomo3iadfp  aies;t0 rxrim nu1al elnviat  Dtru o;u0apto fetldla uanvsn()tetomo3iy1oaDrliei ()srtmxrpnu1al nmfeiatf rtru ont0aee ifeils m umu pnu0arenifciadopDelnei;s0s2uo(m3ou1op nlfvilt)a2ra(mp;t4ale miciad aDumuvp u4altnmo3tatfm   uvsl() ruo(r3oy4omtnmfvs t  Dtmurpnt1apx ifctys aDem(mp (4aetrxo3tytlpD au i;s)srtriopny4ome  nci s)s2ur(ronu0oetnifetltfmDuanvp ()tlxrioctodfmDr uvilt  2trxo ny4ll nlicsas aDtaum ;u4optn i3ildfm emu p;(0areoirciydlaD  uei;t0teurxrpny4lmt livslt  2umurpou0texo ieiydfa2elu pn(4trxrio3tydfptrlu i;t0t2tmir oodll elnvtlt s2tr(m no4tltniicild s rmumsn(0tetomociotfpD  i i t) exmxm oudom n nctls s2umu  nu1oetn oetysfm2ea(vpn() rxnir3iytlat liei;(0sexo(m oodale mnvtat artr(moot0oetnmfcilt aDemumsnt) ltnmo iodfat anesl() 2xoirpou4opeelnci ( arua(rooo0aptn ieildlm2uanmp ()alxnxr iatlate n sl()trur(o nu1amenmncil()sDra(ro;u1apx  o3ilsfm rlnmsn(4alxnxo3ootopDeanvi;t)sexoxr oydale  nvtat)s2rmurp;o0apto i3ias sDra(von(4alxnmf3io1lpD  ies;t)srtm(r3io1lme  fes s s2uaxrono4opeo f3iys a2eluvo;u0 lxrmf iadfp raies;()teum(opio1lp  mnci s) 2raxr nu1aptoio3iadfa2emu p t)artnxf todomte ieols)texrxmpoy4amen fcsa(  Drrx  ot4ope ii3tas s rmn p u0 lenxocty1laDr u i;s0srumxo3ou4lpen fvt tf 2ra(moou0tpe ii3ildlm ulnvs;t) leomr3oo1om eaivi ( t2xrxopiu1omenmfvta()sDurxrooo4apxn ocilt a rlnvp;(4 lxoir totoa eluesl( sruoim3oo1ap emncs (fsDrm(rono1tlenioctydfm2umnmp;()arxomrctotoa rln o;t seuoxo3iudlpt mnvs s  rrrx  ou0altoioeiltfsDranvs;(0 rtoxo3iotfatr ivols  exrxmpoy1alee iei (  2umump;o0olenifetydlm2rm(vo u4 leomo tatopDraivsls0t2tr(mpnu1lpt  nesl(faDuaxmp;u1apeoifcias m eau pnt)aleoxo3oydlmt  iei t)srtr(mpiu1amt  fctas aDumu o;o1tpeo fetasfm ranvp;t4 etrir3iy1fpteai olt  2urio oydomtnmfeta(f Drr(moou1aeto iciysfs ranvsn()artnmrcoatfpteau sls  rxo(mpnu1amen fvi s  2uau  ;u1texnmociytlsDem( snu4tlxnmf oydomDelivo;t)t2toxmpnydamtemfciat)sDrmxr ot0aet moeiatlmDuluvs;t0tltnxfctodfp rlivi;s0 euoio3oo4ole  feil( arum(  nt0aexniieiat a uau s u)artnif3oa1op rliei;s)t2trxo oodale mics sfs2umu p;u1oee iiciasfmDrl(msnt0trxnir oo1fa e ivi;(  2xo(opnudol   ietlsf 2trurpnt1tex  oetas m2eau s;t4 renxocoadla e nei t0t2xmiopiodlp   ncs sf 2trxmonu1tpxnio3tysfa um( snt)trtoxo oodlmtrlneo;s)teurim3iy1ol  micilt  Dua(rpot1oltnmictadla2eanvo;()arermr3ty1fpDe neo;(0 exo(rpno1lpe liei s s2tru  oo1tet iieildlm uanmp;u)aetniocta1fmDran ils) 2xm(m3oo1lmen neilt  ruau pou4oee io3iytfm2ua(mo;u0aetoxfctydlp r iei;s)s2xoxr iy4ol  miesl(fsDrr(  ou1alt  oeiytla ulu s;(0 rtoio3ty1omD  u s t0 rxmxrpiy4lp elnct (f Drax o;o0opt  ociyt aDrl(msnu0 eerif tatfmD au s (0s2tr(m iodopee ivsatf rtau oou0ope ifeiasfaDea(vp (4 ltnif3oatlate iei t0s2xmirpno1am   fvt s aDtru  ;u4optnmociatfs ulums;() rtoxf3ty1lateauvils0 2xrirpiudop emiciasfa2rr(m ;o4oeen ociltfa2eauvp;(0altomr3tatfm  luesl(  rurxo iy1aleemneilsfaDtm(r oo1tpt  icilslaDra(mpnu4trxnmoctotlatelues;(0trtmiopoo1apenlncils)srtmu pot1tetniociad m ra(ms t) exrir tadlpD ln ol(0srxoxo io1al e nvsatf Drr(mont4tex iietls s rluvs (4tetomocoydfptr ivo;t)trxriopoy4lm elfvt tf rrrump;o0aptnio3ilsfmDelnmont) etoxf tytomte u il(0 etmxm3nodolt micta() rrr( pou4oexo o3iasfmDua(vont0 reomocoatfateanvi s)s2urim ou1om elfcsa() rrm(ro;u4alxnioeilsfs ua(vpnu0artrirctytop e iei t0 2toir3iodalt  feslt) 2tm(  oo4tpeomfetyd m uaums u0artnioctydoat  uvi;s0t2to(r oy4ap elnvta( aDrrx ont1oeto fctadfsDua( pnt)tetoifctatoa e ueo s)t2xmxopoodlpe  ivilt a2tmx  ;o0tleo iciytfaDrm(vp t0arxrxo iytlp   nvs s)seur(rpiodomeemncs s) rtrxrp;u4tpxnifeildfs ra( p;u) renif iodlp eaivs s0seumxm3nudame  nei t  Durx o;u1oeeomfctyslm2ulu o;t0 exrxo3ia1lat lnei ()teuo(opoo1ap nmneilsfaDtrum nt0aee  fetltlaDra(mo t0 rtnirciy1om eaivi ( s2tmxopiudap emies (fsrrmx  ;u4oltoiietas s eluvs t4 exoxf3ty1oa   neol(0trxo(mpno1apt mnetasfsrraurooo1olx mfetys sDumnvpnt)tlenir3to1la  livs;s  rur(m nodome  fcsl(farrr(rpnu4alxo ociad mDemnmpnt0tetoxo iy1fm  auvs;s) euoim oy4ol emncslt a2tm(rp;t0alt if3iltlm2ranmo t0altrxr io1optr uvs ()t2tmio oudlleemncias  2uaum ;t1tlxnmoetasfm2ra(mon(4tlxomr3iy1optraivol(  rtrxmpiy1llt mnetat)aDumxm ou1altnmf3iys a2rm(vp u4trerxfciodop e nvo;()s2uo(opiy4ap n ict tfs2rr( oot1aeto o3iydls2ua(vont4 rtrirctydom r ivslt  etrxm3nu4optemnetasf 2rrumo;t4optomi3iydfs ua(mp;t0tlxomo iydfaDe uvs s0trur(rpiodolenlies s) 2trx  ;u4tltnmfeiydls2rluvs u0teeomr3oytfp rauvo t teto(rpnu4ol  mnvsas  ruax  ;o0tleomi3iytfmDrlnvp;(4tltrxo3tatfpD livolt trtrxopoydlm  lfeiatfarrr(moot1tlx mociasfm2ranmo t)artrxr tatfa ran s;() 2tmxo iy4lp e ieils)a2raurp;u1teenmo3iysls el(mp (0 lenir3to1lpD  ueo t t2um(o iudlp   ictl() rtax  ou0ape ioeild m rl( o;()texnxo todfpDrli il( trurirpno4lp  lnet s)aDrmxr ;o4aleomi3iyd s2emn p u4tltoir todfpt lnvo;t)t2xo(mpiodlptelnei tf rraumpou1tpx mieiytfm2emn pnu0 renir3ia1fpDeau s;(0srtoir3oo4aptn iet t  2tm(monu4open feiys m2rluvp t4trtomf oydfatrlnvo (  etmxm3iy1lp emncia()arta(  ;o1texoiiciyd aDul(vpnu0 lenif3oydoa r ieo t  exoxmpny1omte nvsls a2rm(r ot1ope  ieildfs2emump t0trtnmoctadfmt li i (0 etrir oydamenlnct t)a2ta(r ;o1opt mi3iyslm ua(mp t0 rxrxo3oytlp ran olt)srxoimpio1lmee fvias arra(mpnu1tetoiiciad s2rau s;u)tleoxr oa1faDe u i;t0 rurir3nudlmt mneias)sDuaxmpoo4tlxoifciydla uau o;u4texoxr3iadlm   n ol( teumim io4om e neilsfsDtmumpot1tetnmfeildla2um( o u)trxrmr to1lp r ivo;( teuoirpnu4lmeemncsa(fs2rmxm ;o4aptn fctyd s2uauvont)aeermo oatla   u ols0 eumxr iy1ap e fci s aDum(mo;u1aexo ieiytlsDel(vp t0arxoif3oy1faD  n i;s)s2umiopny1op emivtl( sruax pno1tleoio3iltfsDeln o u)arenirciytom eluesl(0sexmim iu1amte feiat sDtr(mp;u1aleniietys a ul(vp;() etnio3oatfm r ueo t) rxr(o3iodop   nct t)srua(ro;o4alxnii3ils s em(vp t4aetnifcoo1fm eluvols)teurio3oydlp nmnvi sf 2rmum ot1alx  fcildfa2emuvs;t)aexnmf3ty1opD ai sl()sexm(m3io4optn nesa(f 2ra( o;t0alxoifciytfmDrmu pnt) exoiocoodoptranesls0truoirpno4oleemnvs ( a2ta(r no0aptn fciyd sDul(vo (0trtoxr3tadoa  auvi t0 rxo(m ny4lpee iet (fa2taxr ot4aexnmf3iadfm ua(vp t4tlermr3tydlatrln o t0srumxmpny4lp elncia(faDra(r nt0tptoifcildlsDulumsnu) ltnmr3tydlpD li ilt0 2tmxrpiodaltn nvt () Drmxront1tetoif3ildfm umu on(0areoircoodlaDraivol( s2xmiopno4ap   icias  2rru poo1apenmoeilt a ran p;u)trxoif ta1laD  nei s0setoxm3iu1lpee fvt ()aDraum ot0opx ifciasla emuvp;u)teeoif to1fatrlnes ()s2xoxr3ou4lpte ncsa(  2um(  ;t1tpx iietydfa eanvs;(4 rxrxf3oy1fmDraivo s0srtr(o ou1op e ivsl(fs2tmx poo1teeomieildls2emnvo (4trenxo3ootlp  aneslt0srtrxo iy1lpenmfvs t) Drru oou0ope  fciyslsDeauvpnt4 eerxo3iytlm ranesl( seuoxr oodopeelfvi () rrax p;t1tet ioetld a ua( s t4altrir tadom rlneo;s)srumxm ou4ll  mivi sfs2umxrooo4opto ictyt a rl(von(0texomr oo1fpDrluvilt0srto(rpnodll   fci (fs2urxmono0alt ioctltls2rl(vpnt4 rtrxf3ootoateaies t)srumxo no4lme lfeta()artrurp;o1olen ociatfsDrm( pnu)aleomo3iy1opD ai ils0 eum(o iydopenmfci ( s2raump;u1oeeoiiciadlaDrlu p (4areomo tydfa   nei;s0 ruo(r io1ole mfvt s) 2ur(mpnu0tlx mf3iatfmDelnvonu0 reoio iodomDe n o ( trtrio3oo1al   nvs sfaDtm(r no1tpxn oeiatfs2ulu o;()trtomo3iy1lmDrluei t0 rtr(m oudlpeemneilt)srrr(mpoo0oeeo i3ilsfm uan pnt0aexnxoctytlm   ueil( tetmxr ou4lpenlivil() rrm( oou0aetoifetyslsDrlnvo;u0 rtomf3iotla  ai s;t) 2urxmpny1apenlivs ( sruru  nu0tptnmo3iydfmDumnvo;t4 lerxrcoy1fateanvi s0t2umim3nu1alen feilt)srrmxr nu0oleoiieiltfm elums t4texrmrcoo1fmDrli sls seuo(rpnydom elnet ()aDrmum ou4apx if3tlsfa2rm(mpn(4aetrxocoytla  lueil()srxr(o iy4oltelfcslsfarur(rpnu0oltoifeild m2eau p;(4alerio tadlm
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;s0 exm(mpoo4ale  nvt s a2tm(  ;o1tleoif3iyd a emu o;(0 exnmocootfm rlies t  rur(m oy4lmte nctat  Dumu pno4tpeomociadfmDuau pn(0areomr3ta1fate nvs;s0s2ur(rpnydlmen feta(  Duauroot4aeeomfciadfa eluvo u) ltrxf3tadlpteliei;( tetriopiu1al  mfvsls  rum(r no4alto octys a2rlu on(4altoxo iatfptraueils0s2trir3oodll  livia(faDurumooo0aleoif3iatfaDumn ont)aexnxr3iadlmDrlnvs s0 rur(o no4llenlfeiatfsrrrur nt4tpenmocilt mDea(vs;(4alxnif tytoptrluvi t0setriopnydoltnlivsat)arum(mpno0alx mfetls a2eln p t4aeeoxf oy1la r nvol()sexr(rpno4op elfetas)aDur( pnt1alxomoeiysfsDrluvs t4trtnmrciodoateanvi (  euriopnodopen nvias sDta(m oo1ale mfetydfsDulumo;()arenmfctydfptran ils  ruoxr3oo1amtn fci (fsDraxm no4olenii3ilt m2ea( ont4teeoxf ootfmD luvsls)t2urir3ou1omt mfvs tfa2tr( pot0tlt  ieiyt a2ua(msnt0tltnxf iytfmDraies s  eum(rpiudopeemncslt)s2umx pot4olxnmi3tldlaDemn p (4teeoiocta1om  an s;t)s2uoxmpiy1ap elicsat  Drrx  ;t1tpx  ocils s ua(vonu4tltnio io1la r ieo;s0teto(r ny4om e neilsfsrrmxrp;t1tle ifciytfm2umums ()trtrxf oatfmDr iei;t trtrxo oo4am  lfvs ( s2rr(rp;u4tltnmf3ilt mDelu pnt)aeeomr iytfmDe ivslt)trtmirpnu4optnlncils arrmu oou4teeoif3ilsfs ua( p t)aeenxf ia1oatr uei s)s2trxo3nodam  mfcs s srrr(rpou1apxomictadlaDea(mp;u4texrircio1lptranei;( t2xrir3io1olen fcs sfa2raum no0aleo f3iat sDelnvp;u)texrxfcoy1omtr nvi;s0t2uo(mpoo4apte iesas  rtaumpou0ape mf3iysfa2rmums;u4 lxnxrctodoa   u sls0 2xoio no1lp  livia(fs2uaxr nt4aee if3iytlmDuanms;u4teeoxfciy1la r i s s0teum(mpno1olt lnci t  rtm(  ou4teenmo3iasla rmu o u0altnmr iodfmDeli i;()trur(o3nydamt mfei t arumu ono1aetomociatlaDrmnvo;t4tetnxocoydlptrlnvi s0t2umio iy1ale lnvt s srum(mono1tpeniocilsfs2eluvon(0arxomr oytlmteln s;t seum(m nydll n ietl( artrur no4teto ociaslmDum( s;t)tetrxfctotomt lneo t0sexr(opnu1al elfvi ( s2trxmonu4altomictltfa2rluvp t) rxoif tytfm eaues ()t2uoir oo4lpee fes t  Duax  nu0opx iieilsfm2elu pn(0aleoxo oy1omt lieol( setmxmpiy1olen nvslsfaDraumo;t0opxoii3tydfs2uauvo (4artrio3iadopDeai o;s) 2xrxr3oodlm   nei (fa2taum no4teen ieiadfaDelumo;(0 lerxf todlptelieol(  rtrxr iy4llt lncilt aDumur ot1olx iieildfmDemn s (4 rxrircty1fpD livils) 2um(mpiudal e iei ()sDtm(mpot4tpeniociadla rm( p u)aexoir io1fp rauesls0teum(r3nu1ap e fvi t  2ua(mono4tpeomociysla2uauvp u0altoirciadfm   n ol(  rur(rpnodale mfvi sfa2trxr oo1tet miciltla emuvo;t)treoio3oatlpt lnei t0s2toxo nodopenmfviasfaDur( pnu0ole ifeiasfmDem( pn(0arxnmr iadfa eai ilt)trtm(m3io1al n nct ( aruru o;u1optn oeiltfm2rm(ms u) lxnxf3oo1omDrlueol(0 rum(m3ou4ol elnctasfsrrru  ot1teen o3iysfa umnvsn(4areoxocoydfmD  i s (  2uoirpnodlpee fci () 2tmu p;t4ole io3iadlaDrl( s;()alxoxr3oatlmtrauvslt)teurxm3oy4om   nvsltfarraxrono4tpen o3tld s2emn snu)tetnmr iadlm e nvs;t0s2urim3io1amteliviatfsrtruroou4tptomfctyd a2emnvs;u) lxomr3ta1fp  lu sls)tetmirpou4lmeelivsl(fsDrrxm no1tptnmi3iltla2rmu snt4teenif3tatfatr i i;s0sexoxr oodllee ieiatf 2rmu ont4oltoio3tlsfm2el( pn()aexnmr ia1faD anvo ()trxoir3ou4lp elncsls  Drmx  ;t4oexnmfetlslaDumnmo (4texrio io1fmDrauvs t teur(m3nodol  mneils  2rm(  ou1tpxnifetasfmDemuvp u) rtoir3iodoa ranvs s0 exrxr3iy1op nlfeils aDumx  nt1olx ifeildlsDra(vs;u)arxoxr iodfpt  ueo;s0 exr(m no4op nlivils sDtau  ;u1apeo fciadls eauvo u0tetnifctydlm eau s;(0 2xo(o3oy1ll  miet (f ruaxm ot0tpxnmi3ilsfa2em(mo;u0altoxfcta1om rlu s s srxmir iy4lm   fvia() Duaum ;u0opxoio3iatlsDumn s (0aexnio3oatomtr ueol()setoir ou1aleelnviat sDtau o;o4texoif3iyd m2el( pn(0 lermf iodfm eanvo;s srtm(r iodomee fviltf Drr( onu4oexoif3ias a el(msn(4arxnxociydfpDrau ilt) eto(m no4openmfvta(fa2um(rono1aptn i3iltfm2uanmsnu)texrxocta1latr ueol()t2xm(m3no4omenmfvi s) Dtm(  ;u0ole iicilsfsDemu p;t0alxrmf totfpDr nes;(0 2xo(o no1altnmnes t  rumxmpoo1apeoiociasla rmn onu4texoxocoa1fmDran slt texoio3nudape  fvias a2tm(monu1tltnif3iys a2rlnmo t0 renmf tydlp eaueo;s) etoimpno4lpte ieslsf 2ua(m ot4aeenmi3iyd mDrluvpn(4altomr to1fp elnvo t srxo(o3nydlmtnmnesa()arumxmpot0oetoii3iadla eau s t0tleoxfcoydlm  aivols0s2ur(r nydomtn feil()aruaxr ;u1olen fcias m rl(mont4aeeoif3oodfptr nei;() etmxopoy1ap nlnei s srrm(rpoo4aeeo fciytfsDel(vsn(4trenmr tydfmD an o t0s2tr(o3oo4lm nlfes () 2rrx onu0optnif3tatfm2em( p t4tltoxf3to1fmtr nvo s s2trirpny4optelfctlsfs2umx pno1tet moeiatfs2raump (4artoxociodopDr u o;t0 eumio ny4lltelivsat a2uau  ot4opxniiciadlm ra( s;t0 reniociodoaD an s t t2tmxr3no4apenmncs ()artau oou1tet mietatfs2um(vp;t4arxrif3oa1laD  ueilt t2umxr3iydaptn fctl(fa2ur(mpoo0tet iieiatfa ra(ms;t4tlenxo tytfaDrlivol( setmio3iu1lmtn feta( aDtr(rono0tee  ictasfa umu s;(4tlenmo3tatfm rai o t0 rtoxm3oodopeelici t aDrm(mpnu1alxo iciys mDrlumo;t4 rtomo3oa1lp  aieo t  etoim3iu1ol  mncs ()a2ta(rpnt0oetnmieildls2ean o;t0 eenxo todfpDe uvs t srumxo3ou1ll nmfcsatfarum(m ;o4tle mfetytfaDumuvo (0 ltrmfctydfatranei;( tetmxrpiodlmteliet ()arrrxmoou1apx  ociatfmDemu p t)aexnif oydlat  i i t0setr(o oy4lme  nvsl(f rumx  ;o4aexomo3ildfm2ea( p;u)aleomf iydlp rlnvi s)t2xm(opiodlleelfvilsfaDraurooo4tleomociltla2umu p;(0 exnmo oo1laD an i ()s2xmxopnydop nmnesa() 2urx  no4aeenioeiyt sDum( s;(0aeerif oa1lm eli sl(0 2to(opny1lp  lfetas srrrum no4aetoiicias m2rmuvpnt4aexomo3oodfptr ieilt0s2uoxr3nodolt  fes s)s2rr( o;o4oeen ieildla emuvsn()tetrirciytlptraivs;( teuoxr iu1llee ncsl( sDrmu ont4aeeoiociyd mDumnmsnt4arenxr oodfpDeai il() rxr(r3oodopenmfctltfs2raur ;u0tetnmfeiatfm2rluvon()altoif3iy1laDelnvo t  etrxo3iy4altn ietltfaDraxr nu4aetnmo3tys a uluvs u4tlenir ia1oa eln sls)trurxopno4ol elfci ()sDtr(r ou4tltoifciytfm2eln s;(4trtrxo ootopD luvols)setr(rpnydllt mfcsls)a2tru pno1texniietlsfa rl(vp (4 rxnmoctytla  lu ils t2xoxr3no1ame mivil()s2raurpot0tetn fciad s2ranms;(0texomf tytlpD lu i ( srumxopoo4omtemiei ()aDrru p;o0tleo ieiltfm2ranmpnt4 exrxrctodoaDr uvilt srxm(mpnu1llt micsls)a2trxmo;o1tpto fetyd mDem( p;t)tetoxf tydlm raneslt0s2um(mpiu1oltelfvta(fsDtmx pnu1oee ioctas s2rluvp u)aeeomocoatfm eanei;s0t2umir3oy4olee fcs t)a2um(mpou4tpx io3ils s el( snt4tltnxfctodoa eaivsls  rxm(r iu4lpen iesl( a2rmu  no1tlx  ictaslaDrlnmo t4teermr3iodopteanvi;t)t2xo(r3io1amt lfvtlsf Duau  no4tlenmf3tytfaDrluvpnt0tetnxociadfmDean o;s srto(rpiu1ll  mfcs sfsDua( p;u4tlt ii3tysfsDelnmo;(4teerxrcoodlmtrai o;t  eurxr3oudom e icia(f rraxro;t1apxn o3iatfaDemu p;()aexomf iodomtrauvsl(0 2tmir3iydape  icia()sDrmxrooo4teenif3tadfa ul(mp t4 eerxf ia1latr uvols) rurio3nodlme  fvia(fsDuauro;t0olxomieiydls ean ont0 etoif3tadomD  uvslt)seuo(o3oo1optn fcsasfsrra(mpnu1olxomfetytfm2rlu p t0tetoxoctodoaDelu s;t0seum(r ny1amtnlnvi s  Durxmont0texomfeiaslm rlu pnu4trtnxfcoytoaDranei t0t2trim3oy1ap e fct ()srrmurpoo0tpxnmoetltfa2elu o (0areomo3oatfpte n ils srtrxrpio1al nmfeils srraxmpnu4alxn ociyd a2rauvo u)alenxo3tydfp e ivi (0 rxrxmpiu4al emfcsas)s2trx pno0texomicilt s2um(vp;()tetrif io1la r n sls0 2tmxm3io4apenmivta(  2raxrpnu4tleo octysfs ua(mp u0arerir io1om rlueil(  rtm(o iu1apt  nci t) Draurpnu4opxo iciyd s2el(monu4artoxf ootfpt  neo t) 2uo(mpou1op  mfes s)sDtmur nt4oexomfeiltfsDranmsnu0alenxrcoa1omtr u ils trumiopnodlle  nvt t aDtax  oo0oleoioctltlaDelnvo;t)alenif tatop elnvs;(  2urir3oo4amt  fesl()a2ur(mp;u4tpxomoeiytls2ua(mp t) reomo3oy1oatr nesls)s2to(r nu4alee fcsa( a2ta(rooo0tle mo3iatfsDulumsnt)teerxfcoodlmDrlneilt0t2trxmpoudomtn ics (f Drm(rpoo4oleniociytfm rmu p (4texniocty1opDean i;(0srumxr3oo4oltemfvslt srtrur oo0tpeniociadfs2umnmp t4aeeoifciydlpD lueo;( t2urxo3nu1lmenmietas arrax  nu4tlenii3tys m2umuvpn(4altrmo3oy1lpDelieo t srtrxm oo1opt mnvtatf Dumurpou4aetniietltla elums ()arerio ta1latrlu o s0t2tm(rpio4ame miciat)sDrax  ;o0olenifetydlmDemumo;t4 rermr ty1opDraueo;t)srurim nudoptnmfcia( srtmxr oo4optn o3tydfs ean pn()texrmf3oadomteln s;s0s2xmim3oudlmenlfvil(  2tax oot4oetomfcildfa2rlnmo t)tlxomrcoydopDrli ils) rxmxr nudop   icilt  2rm(r oo4tleoii3iydfs2rmuvs;u0treoxf3todlm eli ols srxm(m ny4lp emfcs ( sDrrumoou4oetoio3iydlmDum( p (4arenmf ootfaDeaivs s setrio ny4amteliciat s2um( o;t0tlxnmfeiys s2umnms;(0 rxoirctytomD  ieo ( texo(o3oydam  lnetls) Duaur nt1oeeo oetas a eluvp (0altnioctodlmDrauvsl(  rtm(o ny4omt lfvilt)s2urum ;t4tpeniietydla2emn p (4 rxoxo3oodlp rai ols  eumirpnu4llt mfvilt)artau p;t1opxniietatfa2eluvp;t)tetnmo3io1op   uvilt0t2uoim3iodapenlnvtl( sDrax p;u4teeomietltfmDelu s t4teeoxr todlp e ieo;t0truoiopiy1lpte ncsl()srtmxr no1teenifeiysfa ul( s;t4 lenmo iytopDe u ils srxmxrpoodam   fvsat)srur( pnu1open i3iysfsDemump;u)arenmr oadom elues t)seur(r3nu1lmtemiei s)sDrrxr ot0tet if3ild a2emums t4 rtrxr3oydlp rlivo;s texoxrpoo4lle  ivias) rtaxr oo4alenifciysfm2el( sn()alerxfcoydla e u o;t)s2to(rpio1apt mneilt sDtm( p;t4tpeomiciyt s2rmumsnu)trtoxr iydfp eli i;( trxrim iudomte ici s  Duru ono1tpxn i3tyt s2emnvsnu)aetnmo totfpDe ieo t)trumxopoy4omtelfcs tfaDtr( o;u4ape  iciytls2um( pnt0aexrir3oydlmDe ivi;(0t2toxm nu1aptemnvsasfs2rr(r nt4olx ii3iad m umn s;u4aetnxo oydfp e ieols trurio3iodamt lictlt)aDtmurpnt1tleoio3tls mDem(mo;()aexnmocia1fmte u i;s)trtoxm3nu4ol e ieilt)srraumo;o4aleomiciysfa2um(vonu)artnmr3ootfm ran sl(  exrim iy4ll emneias aDtmxr ot1tee  ictyslaDrlnms (4alxnmrcootoaDr uvi t)sruo(rpno1lmee ieia(faDtaxmonu1olt  feiys s uln ont4 rtnif ty1oa   nes ()sexr(m io1lp elfviat)s2rr(ronu4oet  f3iadfaDumuvo u)trtrxf3oadfmteliei s s2urxrpoy1lle  neias aDuru p;t4opeoioctlsls2emuvo;u0arxrxf to1lpt auvi ()srtm(m ou1lp emncsasf Drax  ou0aeeo ieiydfs2rlnmsnu0alxoio iytfatelu olt0trtrxmpiu4altnlfcilt)srraumo;u4oltomo3iatlsDuau p;t0alxrioctytfmDe nvslt trtmxmpoodlmtemfcs sfs2ta(rp;t0apt mieiat sDrmu s u0 etnmf iotopDelu sls)s2tmir nydlpee fctatf Draumoot0teeoii3iydlm2umn o u) renmfctadfp ran o s seuoimpou1omenlfcsl() 2urxr nt1aex  o3iysfaDemu p (0 rxnxo iodfmtrai i;s  rtoxm3oo1ol nmnetlsfa2rm(mont0tptomfciadfa emnms;(4texnif oydomte uei;t0tetm(o3ou1om emnctls)sDrr(  ou1olxniiciysla ulu p u) eeoxfcoo1fa ranvs;t) 2trxr3no4openmivi sf Dtaum nu0apxnmocilt sDrl( s (4teenxr iotlpt  nes;(0s2umxr iodale micsat s2uaum ;o1ole iictlsls ul(mp;(4arerxrcoadopD lnvo;(0trxmxr3nydlp   ieiatfa2ra(mp;t0oetnmfetld a eluvp;() eerxf3iytfmDrau i;t  rxrxmpiudopt  nci t) 2uaxmo;u0apx mf3iat mDua( p;() ltoif3oodlpt aneilt0s2tmxo oodamte fcs t) 2urum ou4tpxo ocildla ranmo;(0teerir oadlat  ies ( texmiopiu1ameemnvs ( sDtmu o;u0oltoio3iasfs2uanmpnu0tetnmr3iy1fpDr ieo s0t2urir io1ole lfvsasfartm( oot4opxn feiatfmDel( o ()tltrmr3oodomtraieol(0tetoxm oydolt lietl(  2rm(  ou4ope mfeias s2uanms t)alerir3iatlmDe uesls0 rum(m3oo4ll elfvs () rururo;u0aee iociltlmDemu snt0texnxociytfatrln i t)trxr(rpou4ll e nvta(  2rm(r ;t1tlto feiltlaDuanvp;u0tlxoif3oa1la e ivs (  2toio no4olt  fcil()arta(rpot0tpx iictlt sDelnmo t4 rtrmr3oytfatr neo;s s2xmio no4am nliciltf 2tmum oo0texnif3ildfs2uaumon(0artrmocta1lmDeai ols0 2um(rpoy1lmtn fviltfarta(mono1tpxomiciyslm2eauvs;u0 eeomrciodlaDrlnvo;( trurir ou1lltemictlt)arta( p;u4texnmiciytfsDeau on(4treomf3oy1faDe uei ( tetoxm iu1apenmivsatf 2tax p;t0alxnmicildla ul( s;t)trxoio oytfaD lneilt0s2trxopou4am n iei t srraxmp;u0aleoifctytfm eln on(4aeenxo oytomD li i t srumxmpiydaltnlfvia() Durx  nu1oeeomictadlm ulnvo ()trenmr tadop  luvils texm(r oydap  mfvi s  ruaxmpnu1tptomfciadlm2ulu onu0aexomf3iy1omDrlivil()sexrio no1lmt liciat) Draum no0alxo iciyd sDrmuvs;t4trxnxf iydfmte u o;()t2uo(mpiu4altn nvtl(farrmx  ot4tleniicilsfm rmuvpn()alenircta1oaDr nes t0 eurxmpio1aptnmivtas sDur(r ot1oltn ieilt a2umump u0arenmo3io1optelneilt t2xo(rpiu1ape  nctls  rtmumo;o4optomietlsfaDulnms;()aetoir3oo1lpD  ieilt0s2xm(rpoy1ale mfcsl()a2uru  oo0oee iociyslm rauvpnu4altomocta1omt aieilt seuo(r3iudllen fvtasfsrrauro;u4oeto oetas sDrlnvo;u)trermo tatoaDrlu s;t trtmxm oy1lme  neia( srrrumo;u1apt mietatfs ulnvont0 lxrmo iotoa e iesls0 2xo(m3oodop n nvtatfa2taxmont4opeo fcildlm ean o u0 etrif ta1oaDeai o (0 2toir ou1lleemnct t)sDrau onu1oeto fciat s2rluvs;() lermo3oa1fp rlieols0 etr(m3nydal nlfetas  Dtmxm ou1opxo f3iydfaDeln s () ltoxo3totlp r uvs;t)srurxmpoudlmtnmieia(  rrmumonu4opt mo3iyd aDumuvp (4 eeoiocto1fmDeliei;t)s2uo(m3iodlleemfetas arrrurpnu4teto fciyd m umuvs;(4 rxrxocta1oa rlnei t0 exr(opiy4ll  lfvilt  2urumoot0oeeo ictlt mDranmp;() rxomrcio1op  lieils) eurxopnu1ll nmnei sfa2rau onu1alenmf3ilsfaDuan onu) exrmfcio1opteanvi t0t2tmio3oo1optn icta(f rur(m nt4oexo f3iadls2eanmp t4teeoir tydlmt  u s s0 2xrxrpiy1lmte neiltfa2raum ;t4apt mieilt m2el(vonu)trtnmfctytfpteaiesls) rxmxo3oodoltnmfciasf rrr(m nu0alxnmiciyt m2umn pn()trtoifcto1faDraivo (0 euo(o iu4lpt  nvs sf 2umu ooo0tpxoif3tysla2emn o;t4arenif iytfm rli ils s2xrim oudameemnci s  rrrxmonu4tlen feiytfm2ul( p u) lxniocoo1opDrlivo (0t2xr(opnu1amt mfvsltf Drmxm ;t4oexniietldla2rln s;t4 exnmf3oytopDr ueol() rtr(r3iydlm  mivi t)srtaum no0aptomociydfmDra(vo (4tltnir3ta1oatelu sls0teurir io1apte ieia( a2ur(ro;u1tptomfciydlsDranms;()altnioctadlmDeluvo;s)t2urxopnydomtn fes (f 2tmxrpou1oexn ieiatfsDrmn snt) leoxr oytoaDrluvs s  rtm(rpoy1lm   icil() rrau  ou1aptomi3tytfs ra( p;t) leoxfcia1oaDeauei ( trto(m3oudlmeelnctas)aDua(m ;o4tpt mfcilslsDua(vs ()aleoxf3iytoaD  uei s0trtoxopnydameelnvs s aDrmx pou1oexomfeiyd a2rl( p (4aexomocio1la  auvi;s)t2umxo3nudlme  ivs s) 2trxm ;o4alt mi3ias aDelnms ()altomf3oo1laD aivol(0teuoxm iy1lltnlnvtasfa2taxrooo4tetomictldfaDean onu) leoif oa1omtelivsl() etm(opny1amenlieilt aDra(m ot4ape  octys a rlumon(4 ltrxo3iytfa eai o t) rxoimpiu1lmeelnei (fa2taxm ou1oexomieiytlm2ulnmp;(4alxnif oy1fm rauvsls0t2xr(o no4alte ieta(  2rrumont1oex  ietltfm2umuvp ()aeeomfctotlmDeaieil()srto(r3iy4ol n neiasf Dtrxr ou1oexomieiyslm eln pn() eenxr3totlaDeau s;() 2xo(opoodaltnmivias a2rmx pou1aet  ictydlm el( p (4 exrxr3oa1fmD lies;s)sexrxo3io4ap elici t  rtau  nu0altnifciat m2um(mp u4trtoxo3to1fp e ueo (  etmxo oy1amenlnei (fsrrr(  ;o4aex mieiltfa2umnms;t)teerxf3oytfm ean i (0 rxo(rpiu1lp emivsa( arrmxmooo1apxn ociadls um(vp u4 exrifcty1faDeanei;(  2xo(r ou1ol emncsl()sDtru  oo1teto oeiltfa2em(vp u)tlxrxo3oydfptr i s;() rtr(m oo4al emics ()aruru o;o1tpt ifcils s rmn onu4tltnxf iy1fa  liei s srxoxopoudomee nvslt) 2um(r oo0tlxo oeiys sDrmnvpnt) ltrircoatfpD lu i s) exo(rpoy4am nmicilsfaruax pnu1tetoifcilsfa2uanms;t0aetrxo iadlmDeaueol()sexriopiu4om  lfetls  rtmu  no4oltomoeiadfaDemn o t) reoiocoa1lpt lieolt trumio io4al emnvt tf 2um(  no1olxoifcilt mDul(mp;t0alxomrctadfpt  nvs;() exm(opou1lp nlfeta()arur(rpou4apx  octys sDelu s u0tlxomf tatopte ieo t trtmirpoy1lpenlnetasf 2ra(mont4tpt  fctadfs ulumo;t0aeenmfcoo1lp rlivil(0tetm(mpio4olen fei t)s2umum nt4oexomiciysfs2ea( o;()trtrmr3iatomDranvi;s  2tm(mpiy4omt  ncs s  rum(r nu0apto ocilsfaDem( pnt4aeerifciodopD  i s t  2xoxo io4amenlneiltfsDumu  nu1optnioeilt aDrlumsnu0texrmf3ty1oateanvil(0srtm(m iu4alt  ictls s2rru p;u1alenifciyslaDel(mp;u4 eenxocto1omDelneil( t2urir3oodope  net t)arta(monu4apenio3iyd mDelnmo;(4 ltoxrcoadfmDeli s s0 eum(o3io4optn ictat  2ua(ronu4tlx if3tadfs2umn s t0tetoxr iodoate i s;s teuoirpoo1ale miviatfaDuaumpnu4teeo octydlm2rmu on(4artoxf3ootla eaieo ()srtmxm nydlmtnmnctasf 2umu oou1tpx  feiadfs umuvo u4 lxnmo oy1om e uvols0trtm(o3iodam n feia()arrr(m nt1opxo oeiatfm2rlu onu4 leomf oadoa eanei ( setmirpiudamte nvta( aDurx onu4olxo oetyt mDemu p;u4 lenxfctadoate uvi ()s2to(o3iu1lpe lfct (  Drmxro;t1oetomocild aDua(ms;u)tltnxr iydfm rli o (  2xoio oodole livsasfa2trxmo;u0aptnmo3tys m ea( on(0 rtnir3iodom rliei ()teto(o ou4om  lnci ()srrr(mpnu1oetn fciatlm2rau o;u) leomo tadfmDeauvi () 2tr(m nydol  lfvtltfaDtaumooo4tptn o3tltfaDeanms u4aexnxr to1laDrlues;t)s2toimpoo1olenlivil(f 2ur(ro;u4olxomfeiys a2uanmpn(0 etnxr3iy1lmDeli olt) 2toxrpoo1lpe  netls)sDum(mpno1apxnmo3ildfm2eluvo () reomr ty1fatraivo;s srurxopiu4olt  icsl() 2rr(  no1opt iociaslsDuan pnt0texnxocty1fm e iei t s2xo(r3io4lm n fet tf 2ua(mo;o4tlxoifeiytlm2em(mpn()trxnmf3oydomDrau i (  2xrio3nodomtnmnvtatfsDtr(mpoo4texnmictltla2elumonu4 lxoir iytoa raueols0s2xmio io4amt lfeslsfsDumxm no1teeomietatlsDrlnmp;u)aexoio3todlpDe u o;t)srto(rpiudop n fvilt)srra(r ;u1tlxomi3iltlaDel(ms;t)aeeoirciodlmD livsl(  eurxrpiy1lm nlfeslt arrmx o;o1aet  oeiyslaDeln o;u0trxoxf3oydlate nvsls tetmirpnodlm e nvilt arua(ront1teenmo3tadfsDeanvon(0tetomo tydla eli o ( teur(r iodap elfeiltfs2trxroot1tpx moctldlm rmnvo t)tetnif iy1omDrlu i;s trtoxm iy4omte ivilt  2urumo;o0tlxo o3iysfsDulump t0 rtoirciotlm  an i;( truo(rpnudamtelnei s)a2ur(m ;t1tpt if3ils a2uanmpnt)tetoif tytoa elu sls) exrxrpio1lm nlivsl()sDum(  ot4tle ioetlsls2uaumsn()alxrio ty1fm   uvi (0 2tmxmpno4oleelnctat arua(monu1olxnmo3tlt s2ra(mo t)aetrifctotoatrln i;(0 etrir3iy4am emnvi t)sDua(rpnt0tptn octydlm uaump (4arerifciatoateluvs;()trxmim iudameelncsatfartaxmpno1opto ociad mDulu s u) ltnmrcia1op eai o;(0 eur(rpnu4ame  fvtl(fartm(m nu0apxo ictlsfm em(vsnt4tetomrcty1fpt li s t)srxm(m oy4optnmfcsat) Dtaxmont1oeto ictydfm elump;(4aexoircio1oaD aieo s)srxoio3iy4al n iei t)aDtmur ;u0apeomoetlt m2ulnvp u0artrxf iodlpD anvs s) 2uoxr3oodaltn fvi t  2raxrpnt4tltn iciasfaDum(mont0teeoifciy1fptrli slt trum(r3iy4altelieias) rtrx o;u0tpxo ociyd m2ulumon(4artoircia1fmtr uvo s0seuoim3ou1openlncs t  rtrumonu1texomieild a2rauvont0arxrxo3iadfptrluvols  2trxopoydoptnmiet t)sDtaumo;u1tpxo feiyd a2ea( o t)tlenio tatfpDeanei;(  rxoxm oodlmtnlnvs t)arumurp;u1oeeo icilt aDrauvpnu4 etomr3todoa eaieilt)t2to(rpnodolenmncsls  2trx ooo0altoif3iltlmDea(vs;(4tetomoctytoa ranvo t0sexoio nydop elfcil(f rtrxr nt1aetoifeiltfaDrmuvp;(4tlxnirctotlp rlues;s0trtr(o iudamenmici s aDta(mpou1tlt  oetatfaDrmuvo;u0trxoif3oatlpt ai i s)sexoim nudomenlici (faruru  nu1aetn ieilt s2emuvon(0trermf3ty1fmt  uvol(  rtoio3nudam emieta(f rurxm ;u0oleoio3ild aDeau s;u0artnmfciytfa eaies s)srxm(o oodol nmnvta( sDrau  ;t4aetomiciyd m ean s t0aleomo oytfp rauei ( teurimpny4am elfvtat sDururono1texomoctlt s emumon(0treoio3ia1lm r n s;t0 rxmxopiu4omtemfciatf ruaurpoo1alt  i3iydla2ran s;t)artnxr ty1laDeaieo;t texrio ny4amt lfetlsfsDuax ont4oetniietltfa rau s;t4artnmociatla  aueo;s)setoiopnu4ap e iesls artmxmoot1ope miciaslm2emumon(0 ltnmr3iydlaD  i o;t  2xm(mpiu1lpeelnvtlt s2rau  oo4ole  iciad a2ra(vo t)trenifcoo1optrli i t  2tm(o3io4lpen fvtlsfsDrmu onu4tlenmietls a eluvpnu0aexnifciydfa  anes t s2xmxm oo1lmeemnvilsfs2raxm nu0apxnmo3iat s2ranmp t) eeoif3ta1lm e n ils  exm(o3oy1lptn nesat)aDrmx  ot1apeoifcilt sDrmnmo t0aetnifciadfptrai olt0 rumim oy4lltn fesas  rrmxmoot4tetnmfcilsfs rm( s ()tlxnxf ty1om   u il() rum(o nu4lmtelnctasfa2tm( ont4oeeniietydfa um( pn(4 lxrxociatoa   nvsl(0trtoio iu4lm elfciltfsrum(mpnu1alt io3tatlm rau o (0trermrcoo1opDelieols t2xo(m3iu1lm emfcs s  Dtrx pou4altnmfetld m rm(vo;t0aexrif oydopDelivs;(  2xmimpiy4lptnmiviatf Duax p;o1tltomf3iltfm el( o t4alerxf tatlaDr u ils)texriopoy4omenlfvsa()s2tmxmpou1olx  oeildlm uln pn() etoir3ta1lmDe ueol( setoir ny1ol  lfvtltfa2tmumoot4oetnif3iatlmDemump u4tetnxocto1lmteauesls)texrxopno4llen net s sDuaxr oo0aex ioetls aDrau o t)tltnir3ootlm  lnvi;t) 2uo(r3no1altemnci s s2rau p;o4tetomfeilsfs ea(mo u0 etrirctatfpDran i s) rtoxopiudlpeemnvi s)s2rmxmpoo1alt  ieiadlm2uan ont)teenmr oodla  auvi;(0texm(r3iu1altnmiesls)arrmurpnu0ape ifctlsfmDumnvp;(0tlenmocoa1fptrln o t0t2uo(r no1lpen ncsa()sDrm(m ;u4oet  o3ias m2ulums t) ltrif3iy1oat lies;t0t2xmiopiydaltnmivsatfsDraxmooo1texn f3ilt mDeln o t)trxoif iadlaDeanvsl(  rxo(rpiydomenlfeias  Dur(m ou0tltnmfeiasla eln s;t0aetnmr iy1omDe uvo;t0t2xm(m iy4olt  fctasf ruaumpot1oltnmf3tadlsDrl( s t0texoxo iytop elnvs s0texm(rpiydoptn icsa(fsrrm(  nu0tpt iociasfmDeln snt4texoxr3ootop rlu slt  exmxopoudlle licsls)sDrrumpnu1oleo iciat a el(vo t0artnmo3oa1fptrauei;( t2urim ou4olte nvi ( s2rrxmo;t4optnmieilsfmDrmn on() eeoiociytla rlnvs s setm(opiy4lm e ieia()arta(r ou4olto f3iltls umu p ()aexomr3ta1oatr ueil() 2xo(o3iy4op  lies t aDumu pot4olx mictat s elnvp t) lerir3ia1lpt anvsls0 rur(opny4olt mies (fs2umx pnu4tlt  ieiatfm rmu p t4aeeoioctotopDr ueo s s2triopoodll nmnesls)srraurpno4oexnii3iytfmDeanmo;t)aetnxf3tadomt au s ( texoimpiodll  liet t sruaurpou1oexomiciasla umn p t0texnxfctadfa rauei;s)texrxm3oydole mneiasfsrrru p;t1apxoio3iytlsDeanms t)teerxrcoadlpDeaivil()trtmim3nu4oltnmfcsltfsrtr( pno4oetnioeiat m2rmn o;()tlxrmoctydfmtelnvs;(  2to(r iu1alt mnvtl( sDtr(rono0tet iiciys a2rluvp;u4altnmrcoa1optr ivo;t)s2xr(rpny1om   fcs sf rua(root4alxn fetad s rl(mp u)aeeoxo3oo1fmtr ueo;()t2to(opou4lmen fvsatfaDtrxr ot0alx mieias aDrmnvpnu4tltrxrctadlmt li sl(0 exrxr iudapen netl(fa2tr(  ;u0tptniieiytls2eln on(0trtnifcootfaDe n s (0t2triopnu4omee ivs s)s2rrxmooo0aee mo3tytfaDeluvs;u0arenxf iy1lpD aues;t srum(r3io1ol e fvta(  2tax pno0oleo ociyd aDum( snt4 ltrxf3oo1opte uvo ()t2toxm3no4om elnetat) 2rr(rpnt1aee iiciatfm umums (4 etnxocootoptr nes;t s2xr(o iydop elfetas) Dur(rpno1optniicilt m ul( s (0aexrxfciotop e uei;s0t2xrio3iu1apeelncsltfs2uau  oo4tpx  icilt sDrmnvon(0 ltrxr iytfa   n s ()teurxo iu4al elietl()sDumu poo0optniiciadfaDrmuvont4 etnxfcoydlate u o;()srxrxr oudop emfesasfsDrrxmpou0tetnmoeiys m2el(vonu0alxoxr3ty1fat  nei (0s2xrim3iodlmtn fvsasfarra(mp;u1ape iiciytla2rln o;(4trtrxrcta1lptr uvo;(0t2xoirpiy1llte fvsa()sDtrxr ;u4oet iicilsfa uauvp (0tltrmo oytfmte ueo s0teum(o ou1ll emivs ( aDrru ont4opxnifciatfs2uau on(0trerxrcoatopDrluvs;t0t2uoxm oodamenmivs t)a2rax  ou1apx  o3ildfs ra(msn() ltnmo3iydopDelueslt  rtr(o oy4lmeemnci ( aDrrx  ou4oleoioeiadfaDeauvp u4trtnxf3ootfpDe uvo;s) etr(m3ou1ale  neil()a2uaxrpou1texo ietadlsDeanms;(0artomf3ta1op eluvo;t texoirpnodlpenmictasfa2urxmo;o4tpt mfetld aDranmsnu4tlxoxoctadopD  nvi ( srtoim oo4optelictlsfsrtau  no0aexnmociytfm ra(mp u)tltoifcia1omtelnvi s0 2xr(rpoy1lpte ieiasfs2rrum ;u4oltn oetadls2rl(vo t) rxnmo tytfpteaneo;( texoiopiy1lpee neslt)a2trxr ;t4ole mo3ilt mDem(mp;t4tlxoio3totfaDrluvs t)trurxr iu4alen iesls)sDur(mpou0olx io3tys a eanmo;(0 eermr3iotoa   u il()teumxm ou4aptnmieslsf Drmu o;t1optniiciys mDrmumonu)tlxnxo3ootom eln ols)srtrir3nodameemivsltf Durxmono1aex iocilsla2rlnmp ()trtnxr oa1fatr i o () rurim oudlmt  fctl(fa2rru o;t0tpt ii3ildfs2rm( p u)altnxo3tatfatr ies;(0seuoxo ou1optn iei s  Dumxroot0alxnii3iyd a eanvp (4arenmf3oodfaD  n s;(0srxoir oy4opee fvtas)sDrmuroot1opxo ociys m2ra( sn() lenxr tatlmtrln sls0 rtmxr3oy4lp elieilt)s2taxr nu0aet io3tyslsDumnms;t) etomr3iadlaD lnvilt) 2urxm3ou1am n neia(fsrta(mp;u1oeen i3iatla eau ont)tlermf oytfmDrai o (  rxmir3oo4lptnliviat)artmumpnt0alenmociaslaDrl( o t) exoir iydlaDe u o;s0s2xmxo ny1openlnei sfs2rr(rpno4altoif3iatlm2emn snt) renmf oodlmtraivils  2xr(m3nydaleelivs t)s2ua( p;u0texnmoeiasfa ua( s;t0 ltrxo3oy1lpt  nvi;( s2xo(o no1lle lfes ( a2tru pot0ope  i3iatls2rluvpnt0altoxf ootop   n s;t)t2uoir3iu1ap   fctl( sDum(m ;t4oleo ieias a2ulnmsn(4 ltoif iydlatr u s () rtmim3ny4alt  fctas)s2umump;o0ope if3iyt a rln o ()alermfcoo1lmtelnes s0s2to(r3oo1am emneta(farrmum ot4oee  feils mDuln p (4aetrir3oadopD lneolt0t2um(m3iu4ap nliei s a2rrx oot1opxnioeiat mDulumo;u)alxnmrcto1lpt au s t)srxoxr no1lp  lfvilt)aDumx p;t1alx  i3iaslsDum(vsnu) eermrciytom rai olt trxmxr3ou4lpe mfeia()aDtr(  ;u0oetnmfeiyt m2emnmsn()treomo3io1lm rli olt  exoxo3ny4lm e fvtasfsrrmu  ou1tltn icildlm2rmnmsn()alenxo3iotom  ai sl( s2umxr ou4lleelfvi tfa2uau p;o1aptn oeiysls ran s;t0 rxrifcty1fp rli o (  2xo(m nu1lm   ici tfsDrmu pou0olxomf3iaslm2uanmsnu0 lenmo tadoa  anvi;( t2umxrpiy1lp  lfvilt)a2ra(rpnt0tlxoifetysfaDeanmsnt0aeerxr3iadfpt  uei t)sexmir3oo1ap nmivils  2uru pot1aptomoetatlaDua(mont4 etoxo3iadlpD lneo;t) rxo(m oy1ap e fesls  2tmu p;u0ale ii3iasfa2rmu s t)arenif3totoa elu o t)texrxm3no1al  mfvtat  2rax  ou0tetoif3ildfa2rln snt)alerxfcoydlmtelivsl(  rtrir iu4om   ivtltf Drmurooo1tetnifeiyd aDea(mp;u0 exnmo3ootfmtraneo t0s2urir iodomte fes s s2taum ;t0ale  ociys mDel(mo t0artnxr3ia1latrlu ol()t2trir3nu4ame lnet t  Dra(rono4tlx mi3tltlsDraump u4tlxnif3oodop  auvs t0srum(m3nu4amtelivilsfs2rmxmooo4olt  i3tatfa um( o;t0alxoxf3tadlate uvsl( s2ur(r iodol e ivia(fa2rax  nt1oleo fctadfs el( pnu)arerxo3oo1fmteanvs;t)teto(m3nu4alenmnes (fsDur(rpoo4opxnif3tytfa rmnmp t) leomocoy1omDeanvo;() 2xo(m3io1om n ncilt  2rr(rono1tlenifciysfsDuau s;(0aetrifcoodopD lu o;()seur(rpou1lltemfvilsfaDrrx poo0olxniociadlmDem(ms;t0arxnxrctatopDe ieo ( seuo(r3iu1ap n ivtasf 2tr(mp;o1oetn i3tys s2ua(mp (4 ltrir3iadlat  ivilt0t2uoxopiydapee fct t  2tau pnt0tlxn f3tyt a umumsnt) etoxr tytfaDean sls0teuoxo iu1llenmictatfa2rmuro;t0tlxn fctys s2eanvonu0 rerxo tatlm  aiesls seuoxo ou1omen ici ( aDrrxrono1alxo i3iad m2ua(mpnt0areoxf oatoa elnei;(0 rto(m io1lmenlnctlsf rtau o;o4tptomocias a uan p t)trxomocoodlptrau il(  exrir no1lmtelfvtl(fa2trur nu4alxnmfeiad m uaumo;(4trxrxf ta1laDe ieo;t) rur(o3oy4aleemivtat)sDtrurpno0altn oetls m2rauvo;(4 lxriocoo1omDrlueo () ruo(o3oudaptnmfcils)s2trx  ou0aeeoiicils aDel(ms;t0tetomrcoo1fatrlnvsls0t2uoio nudolt mfvsa(fartaxrooo0opx  iciltfmDrm(vs;(0teerir iydlmDraies;t s2um(rpnydale  iciatfa2ua(  no0tle iieildlm2em(msn(0tetrmo3iodomDr nvs s0texo(r iudoleelfes t)a2uaxrooo1tlx  fctysls rmumont) ltrmo oadomDeau s ( t2xrim3nu4lltnmnesa()s2uau ooo0aet if3tatls2ra(vp (4artnioctodfaDeauvi (0trtmxr oo1amen nvtl() Draur ot4opx moeiytls elumo;u4tlxomf oydlmDrln i (0 ruoio ny1om eliviltfaDtrum ot1oeto oeiyd aDea(mo t) lxnxf3iadopt  i ols0 euoxo oydole miet (f Dtaxmo;t1alxnio3tlsfs2el(vs;(4 eeoir3oy1fm   uvo ( truo(m oo1lme mnesa( a2uau o;t0opx  oeiyd mDrlu o (0 exrio3oy1fpt aueo;s0s2uoir oy1ole lictas sDumumoou1tpe ii3ilslm2uaump;t4artomf3oa1lmt an i s0 exoimpio4aptnmieia()arra(ro;u1aexoii3iyd m elumpnt0alxoxf3iatla  aiei t0 eurim nu4ll n ietl(fsrur(rooo1tptniocildlaDemnmsn() rtoxfcty1op   u o s0 2uoim iodal  lfvt (  2rrur oo0alen f3iysfsDel( o;t4texoxr3iydfaDeaueols sruo(rpiu1ap e feilsfaDururpot0apxn f3ias a ul( pnt0aetrxoctydomDran i;t s2xo(m oy4lle miesls) Dtrumpoo0tlto fciyslsDumnms;t0arerif3iodfa elieol()trto(m3oo4ll  mfesl() Dtmu ooo0apx ifcildlaDua(vpn(4tlerxf3to1laD ln i ()trxoxr nudol elnesas)s2uau  ;t0tle  f3ils sDum(ms;t0aetnif3oydlmDr n o;( trurxm iu4lltemfvt tfaDra(  ;t0tlto ietyt a2uluvs ()trtrir oatoa   i i;s0t2toxopiu4oltnlieil() Durx p;t1tlt  f3tatfs2umuvp t0 etoxo tadoptr u sls  eurxopoodal  mfet s s2urx oou1tpe iiciltlmDrau snu)alxnir3iodomDraueil(  rxrxo3ou4altnliesat) Dra(rpno1tlxn icilsls2uluvs ()aetoxo io1fpDe ueo (0t2to(rpoy4lme  fvt ()s2rr( o;u4tpeo ietytfs2ra(mo;t)trerxf3iatfaD an s;t) rxo(r ou1lp   fei s sDtmumpnu1aleo ociatfaDrlnvon() etnxrcoydopDr uei;t  2um(o oy1amtnlfcia( aDrmxr ot4tee iociytla rm(vsnt4arermo3ta1lm rlueols texrim3ny1am emnctat sDtr(roou4oee  ieiad a uau s;u0trxomf3iy1opD  i s;(0texoir3nydlpe  neta(fsrua(mpoo1tltoifeiyt mDrmu o (0 lenxo3oa1fa raivs;s)trtoim oo1lltelfvtat)aDrm( o;o4opxn fciysfm2elnms;t4 ltnir3iodfa elnvi;s texrxm3nodol  livta(  rumxrp;t1aee  f3ils s2rauvp;u)altomrcootla eaies ( teum(m ny4olee ncta(fs2uau pot1olxo octaslaDemnmp ()trxrmocoy1oatrli il()trtoxo ou1lm n fetas srta(rpnt1olxnmoeils aDuanvp (0alxoxrcta1fate ueolt)srtrxrpno1oltnlicilt) rtruro;t0oexo ocilslsDuauvo;()altrxr3oodlmt livs;( seuo(opnodalenmnctlt  Dtr(rpoo1oexnmieilsls2el(vp ()trxomo tadop  anvs;()srtmxopiy4alt livslsfa2umu  nu0tpen i3iydfmDemnmo u0alxrxr3tydlatelivslt0trxo(m ou4lpenmneil() Dumumo;t0optnmi3tlt mDumuvonu0 eeoxo tydfaD lieslt teto(o3iu1lltn nvia()srrru  ;o1aptnioeild mDulnvs;()tlxoio oatfm  an sl(0trtmimpiodlpe lnvilsfa2rmurpno1oltomoeiatlmDraumpnu4 rxrif ta1om r nvo t0trxriopiudam elfctl( aDumx  no0ale moeilslm2ul( p t0 rerircoytlp r u o s) etmio3iodomt  icsat) ruaxrpot1aee  oeiatlm2rm(mo;(4texrxfcoodfpDrau ols trxoxmpno1lleelicils aDur(rpnt1aexn octys aDulnmpnt0texnmo3iadoa r neol(0s2xm(o oydomtn ivtl(fs2umxrooo0aeeomoctatfmDumums u4tetomr iodop e ueil(  rtoim3no4ll  mict s)srraumpnu0aeto fctyslmDem(vont) ltomf iytfp rau s (0 etmxm oudomenmivsl() 2urxm oo0oetnioetasfs ranvs t0aeenmo3oodla rlivol(0s2ur(rpoy4lmt lncsas srumxrooo1tpx  o3ilsfsDuaumonu4tltrirctatlmD luvi s0 2ur(mpiudalee nvsa( sDtmuronu4tptomicildlsDumu sn()trtoio3tadlmDe iei;(0seto(r3iodlmtelfes s  Drrx o;u0ole  iciatls rm(mp (4alxrif oy1lpt auvolt0s2xrim3nu4apee ncias) rrr(mo;u0oetnii3tytfaDum( p u0tlxrio oo1fmD auvs;s srtrirpnudape lieiat) rumx p;t0tptnio3iytfa um( p u)alxoio tatlmDranvo;(0setrxr3io4op  lfvsltfa2tm(rpno0opxnmietad sDrmnmo;u0aeeoxo ty1op  lneo s) etmir ou1ap emnct s)srrr(m ;u0altoioeiltlm ul( s;(0 lerio3io1oaDrluei (0srtr(o oudll nmfvilt  2taxmp;o0tltoii3iatfm2rlnvpnu) reoxrciydfmDrluvsl() rumir oy4lmt liei s arurx  ;o0optn f3taslm uau p (4arenmr iatom e uvolt) 2xr(r3oodol n neslsf 2raumo;t0aet ifetld m2elumonu4arxoircoadopD lueolt0trtoxmpiy1lpt  iesls srum(  ou1aet ifeiadfm2rm(vo;() leomrcoa1lmDrlueo t0srxmxopio1lptelfetat s2ur(mp;u1tlt  fctatfaDulnvs;() lxnir tadfptrlivi s)t2xmxr no4amtelfvi ( s2tax ooo4alxnifctysfsDrm( s;()alxrif3oytoaDrai sl(0 2tmxm3oy4al e nesat artrxmooo4aeenmi3ilsfa emuvo;()alerifciydlmDeln ilt  2xrimpoydop  lfcilt)sDumuro;u4tpxomo3tltfaDrmnvs;(0trtoxf iy1lm   i o;( t2ur(m ny4ape  nvsas)arra(r nu1alxn i3tyd a2umnmsn(4trtnio oadfm   i s () 2ur(o3ou1lleelfcsa(  Drmuront4oltnmi3ilt m2rmumo t0aeenxr oodop   ieo;s0t2xmxopno4lmtnlfvs t) 2tr(mpnt4tptomfcildlmDeluvo;u) eerif3io1lpt lnei;t)teumim3iodape  fvsatf rrmur ou1tlx  fciyd s eanvo;(0 lenmocoatlp eauei;t0t2um(m3ou1apenlnetl( s2ua(mpnt1tpx iietlsfs um( s;t4arermo3tytopD  uvi;(0 2uo(opno4ll nmfeiatfs2tr(  no1oeeo i3ilslaDranms;u4treomrcia1op eanvo (0 exr(rpnudlp elfvi t) Durxrooo0tet mfciyslm2uanmp;u4areomf tytfpDeanvo;() 2xmir3iudlp nlici () rtmx p;o0aeto iciytfa2rau s ()trtrifcio1laD  neolt0srum(m3iydoptelfetat  Drmxmpno1oeeoiiciatfs eauvpnu)trtnircoy1oaDran olt0 2xoxr3nudap nlfcsat) Dtmumont1ole mfciyt m2rlnmp u) lxrxo iotlaDeluvs;(  rxo(o3io1amtemivs (faDtr( oot1aptn feiat m uln o;()arxrio iy1faD auei t seuoxo oo1aptelivs sfaDum( o;t4opxomf3ildfs eau pnt0 rxrxf3iytfp  lues ( t2xrimpoy4ll  lnet sfa2rrumooo0oexo fctld m rlu onu4aleoir3oodopDe u i t setmim iudlmt mnet ( aDumu p;o0aeto o3ilsfaDeluvsnu4trtoxr3io1lp ranei;s srxm(mpio4lpenmfcsat s2tmx o;t0opxn iciydfs rm( s (0 exnmf oa1opDr nvil() ruoim3nu1ope lfvilt  Dtm( o;o0tpxnmietlsfmDel(mp (4tetnxrcoo1fmteln i;s0 etoxo oudap nlfeslsf rur(m nu0oetnif3iatls rlnvp;()artrmrcoydfp   nvi s)s2umirpou4apte ics tfsDtrumoou4teenif3ilsfs2umuvs;u4 renxr totlp r ivo () 2trio3oydll  lfcilt aDumxmpou1alx ioetad m2ua(vsnt4 rtoiociytomD li s;s0trtrir3nudal  lnetl()s2umumooo0aetomf3iat a2um( pn(4trenxo3ootfaD  i i s0s2xr(rpiodam  lictat  Dtrxro;u0alx ifciltlaDrm(vp;u4 exnxo ta1laDrau ols0sruoxrpoudole  nvi ()sDua(root0oex ifctadfaDrmnms u)altnio oy1op rli s;(0tetoio oodamee ncta()srtaxrp;u0open o3iad s2uanmpn(0trermoctytlmDelu ilt srxmxrpoodope mivsas aDrm( ooo0olenmocilsfm em( o ()aexnif3oo1lm  lnes;() eurio3oy4llte fetlt  Dtr(mono0aet  feiatfmDuauvonu0arxoxrciadfptrauvil()srxmim3nodameelfcslt  2trxmp;u4oexoio3tld m rlu s (0trxnmr io1fpDe n s s) etr(o nu4llte feil( artmx oot0tptnmiciytfs ulump;u4aleoxrcia1fmtean o t  etmiopiydapeelneias)a2tmxrpnt1tpxo fetyslsDemnmo;t4texrmrctadfp eanvo;(0 rxmimpnu4apenmneia(f 2rrxmoou0teeo fciysfaDel(vonu)tltnxf iy1fpDelivols0 eurirpny4oltemneiltfs2rrur ou0oexnmfeiltls rmn o ()tlenxocty1omtr ivo;( srumxr oodolenmict s)sruaxro;u1oee mo3tldlaDelu o;(4 ltoxo3oo1fa ran i s)seurxmpio1lptnlivia(f rrmxmonu1oltoioeils m2ulumpnu0aeenmo todfa ean o s0trxmxo iy1op e icilsfarrr(ro;u1oexomieiadfm2eau o;()arxnxf3oy1lmDr u ol(0 eto(rpoy4al   iei (fa2tr(  ot4ope mfctasfs2ul( o t0tleomr io1omte n s;t0srum(r3oy4lleemivil(fa2ur(mpoo1opxomi3ilslm2umums;u4 rxrirctadlmteanvi (0 eurxrpio1ol nmivils)srra(moou4oexo o3iytlaDrlnmp (0 reriocoa1lpte i i s)tetmim ny4ap  mncil(fartr(mp;o4aptnmf3iadla2um( on(4treoxocootoaD  u s s)srumxo iu4amte nvsls)arra( p;t0tpto f3iytfs2emnms (0tlxrmf3to1op  aivi t s2tr(mpoudolen nei s)s2rrurpnt4oltnmi3ild s rmn s;u4 reoxrcoo1laDe nvi;t srur(m iy4lpt  fvs (  2um(ro;o4tpx moctldfs ul( onu0aleomrciotlpDrlnvslt  2um(r3iudap elfcia(f Dtru pno1apxnmfeiytfm2emumo;u0arxoif3iatfa   neslt)trtr(r3no1opeemfvs sfsrrrxr ou0aptoif3iys m2rm(vo () rtrmr3tatlpDeau i t0teumiopoydlpt lfeta(  2umx oou0tex  ictad s rlumo u0 etomr iatlat anvi t0truoxrpio4oleeliei s) 2uaumpnt0optn octad a rl(vo t4tetomfciodop eai slt)s2umxm3iu1amen nvtlt aDtr(r ;t4oltnmfetytla ra(vp u0tetoio3tydfmDe nei;s srumiopnudope  nei t sDumxm no1olt mocils sDrl(vo u) rxnmocty1lm rliei s seto(m nodolt mfviat) 2um(m ;u0optnmoctld a2ulnmont0arxrmrctydfmDrau i t)seur(rpnodop n ici ()a2rrx  ;o4aleo fetltls rl(vo;(4alenirciotfmtr ieolt0 exrxm oo1lp n nes s)srtrxmpnt4olxnmi3iad m2um(vonu0teenxf3iadfatelneo;s)t2tmio nu1lm n fcsl()aDtrumono0tlxoioeiysfs uluvs;u0alxnmfcia1lmDrlneols0srurim3iudlp e ivslsf 2umxmp;o0oexnmfciyt aDra(mo;t0altriocia1lm  auei;s0s2toxr iydol  liciltfsrra( pot1oexn i3iatfa2rmu o;(4alxomo3iodfa  auvils) exr(r3nydamenmnvslsfarumx ono4alxo ieiyt mDra(von()arxoir3oodlmte uei ()srto(o3oy4lm nlnvtl(  2taxmpnt4optn f3ilsfs ul(vp;t4alerir to1oaD au il() exmimpnudlpe  ieilt)sruau pnu4aleniociat mDumu s;u4 etnxfctytom raneo;s)trxrim3oudole lietas  Dur(rpoo0opeo oeilsfm2el( s t4altomr ootfaDr ueil( sruoim3no1llen ncil( s2tru  ot0altoiietlt mDra(vp;u4trtrmo3oodfmt lnvslt0setmim3oo4op   fvt s sDtrxrpot4apt mo3iadfaDeauvs u)trxnxo3ootom r ivo t  rtrxm io1olte ivsa()s2tmx  ;u1tet  ociasfs uaums;t) ltrxr oadomte uei;t) rtoxopoudomt  fvi s  rrrxrono4opeomfciltlm ua( pn()teenmf3ty1lmt  u i;(  2urxrpnydaptelivt s)aDrr( o;u4apto i3iltla2umn sn(4aleomfcoadfatrlueils)trxmimpoo4amte icta()srrm( onu1aleo i3tlslm2umu snu0tetoif oa1om r neslt texmxmpnu4ole  ivtlt aDua(m oo1tlxomietlslaDran snt0tetrmo totop eli o;t  rtrio3iy4lp e fct t) Drax pno0oee  feiysfaDeauvs u)aexnirctytopDrln s;s s2xr(r3oy1apt lnesltfaDur(monu1tetnmocils sDeau s (0arerir oytoaDrau i ( s2tmim3oy1ole lnetlsf Draur ;t1tleo feiysfm rlnmo t0alxnxrcoodfaD li i;s0texrio no4oleemfcsa(f rumum ou4tpxnmfeilslmDum(mp;(4 etoxfciy1lmte n ols0 exm(m iy1al nmfct tfsDurxm ou4opto f3iyt m rl(vp;u4tlxrmr3iadlat aues;s0texrxm3oodlpt lfcta()sDrru poo0teenifciad m ra(vpnt) eerif oa1fptrlneols  eumxrpoo1amee fcs s  Dua(  nu1tltomieiysls uauvo t0 ltomo3iy1lmDe ueil(  euoxo3oydlptemici t)s2ta(monu4aee  octls m elnvsnt4 exnmf iodlmte ies (0 euo(m iydlm   fct s a2rmxr nu4tet mo3tyt s2emnmpn(4arxomocootlm raivi;t) 2ur(opio1lpe  icsltfs2rr( o;o4olxo o3tldfa2ean o u)tlxnmociy1lmt au o;( tetrimpno1ol n fvsas  Dtm(rp;t1tleomieiyt sDrmn s u)tlenmfctadfmt  ueo;s)trxo(r3oudaltnmncta(f ruaxr ot0tpxnifetld a rmu o;u0 leoifcia1lmtrauvi (0t2urxr ou4lpee ivsatf 2tr(ro;t4ope mi3ildls ua( o;u0tetrifctadlmDr i sls  2xoim3nydopenlncil(fa2taxrp;t0tetniietysfa2uauvo u4 ltnxo tytlm   uvil(0trum(rpnodap nlnvi sfaruaxrpnt4tex iieiytlsDeauvonu)tlxrxfcoodoaDrai o s) 2tr(opoodlmenlietltfsrrmu  ;u0alxo ieiyslaDemnmo;u) etrir3ta1faDrln ils0 rtrio oodlpenlietas) ruau o;u1tleo fciatfs ea(msn() rxnxrcoydom  aies;( trum(o3oodam nmiei ( sDraxmont1teeoioctydfa2rlnmo;() renxrcoa1lpt aueols trtmxmpou4ameelnvs ()a2ua( ont1apx moeiadlm ra(msnt) lxomrctydlm r n o t s2toxm io1ll elfei s)a2ururpnu4teeomfetltfa2eaum
\ No newline at end of file
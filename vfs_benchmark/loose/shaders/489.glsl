@@ -0,0 +1 @@
+ies s) rtoxo iy4op emnctlt sDuau onu4aee  oeiytla2emu snt0 rtomf oo1fmDrlivol(0s2xoxm ou4olt mnvs sfs2taxmpou1oet  o3iltfs rluvo;u0 exnirctydoa  li i (0 rurxm3oo4lmt  ivs tfaDtau pnu0altomietaslaDrm(vs;u4tetrmf oytlmD aivo;t t2uo(o nu4oltelfcslt) Dtaxmpnu0tlt ifciyslaDeluvp t0texrmrcoa1lmt aueo;(0t2toxopiy1ll  micsat srra(monu4tptomoctydla emn o;t0alenmo3oo1la raneols)texoxr nu1open fesa(  Dtaxm ou0oetoif3ildlsDuluvo;() lenioctatfa   uvo;s)tetoxr nudope mici s)srumu o;t1optn ieilt m2ra( pn(4trxrxr iytfmt lueols0tetr(m oy4ll  lfeta(fs2um(  ;t1ale ifciytfaDumuvonu)teenxocoa1oa eauvo;(  rxo(m3iu4aptemfcilt)srrr(ro;u4oexomicias m2ea(vpn(0 lxomo ta1oateaivo s  rxo(o3iudopeelnet t)a2tmurono1tlx mo3taslaDrlu s;t)tlxoxf3tytlptrlu il() 2umim oydale lncsa( arum( ono4apx mf3tyslm2ea(msnu4 eenmf to1fa r nei;t  etoxm no4oltemietlt)s2ra(mo;o4alxnioeiasfsDuln s u0 rtrif tytfp   ieilt)trtr(r3oy1ol   fvt t)sDtmum ot4tlx mociyd s2eln s ()trtrxo3oatlmteau i;t  rxmxo ny4omtn fei tf 2umx p;u1aet mo3iltlsDulu ont4tleniociytomte iesls)t2xrxmpio1optemnct tfarum(ro;u1oex mfciatfs2umums;()aeeoxr3iadopD aivs;s0 2tr(r no1ole mncs sfa2um( p;o0tlxo f3iydfsDeaumo u) ltrxrcoatlpt  u ils)srxmxopoy1olt micsltfaDta(m nt1alx mociytfa ranmonu0altnxo iydfmD livo () exmim3iydap n icsatfarrmu ooo0apt ii3iadfs2em( o (0tltoxrcto1opD livs s  exo(m iodlptnmnei (fa2raxmpno0tlt  ociadlaDeln p;(0arxrmocoa1op   uvo t)texmim3oo4lpt mfesl(f rur(  ot0oltoiociadlsDel(vs t4alxomr3to1faD livi;t0 rumxm3oydopt lnvil()a2umx o;t4tpx iociysfa rl(vo;t)altrifctytoa   n s;( t2xrirpiu1llte ivslsfartm(rp;t1olto ieiasfa um( s u4 etrxf3ia1fpD livi s)srurim oo4omen fcs t)aruaum ot1teen oetyt sDumuvp;(0 rtoxo3ia1laDrlies;s t2um(r iu1omt  feils) 2urur no4tet moeilt mDuau o t0 rxnmoctotlp e uvsl(0srumxmpiy4lleelnvil() rta(m no4tle mo3tldfa um(mo t0trtoxocoo1fatr ies s) 2xr(r ou4om elfvsl( srtmur no0oltnii3tlslaDuluvo t)alxomocta1opDr ivo s trurxm3nodlpeelnvtlt) Dtmum ot1oeto oeiydlaDrau p u) exnmrciatfmtraivs s0truo(o nudalee nvsls a2rrx  oo4aex  fcild m2eauvp (4 exrifcootfateanes t)t2xrxrpiu1al e nes ()a2tru oou0opeoif3iasfsDum(mp;u) eerxr oadoaDelivs;t) rtrio iodlmt mies s)srrrxrpou0olenmfetatfmDeaumo;u0alxrif iatoat luvi;() rurirpnu1lpee ivtas s2tr( ooo4olxniietltfa uanmp (0alxrmrcta1omD  uvi;t)t2uoim3oo4opte ics tf 2raurp;u0tpt miciltfm ulu s ()trxnmocta1fpDr i i ()teumio io4om emnesl() rraxmpot1tltoiictydfa emnms;u0alxnircoytlpDeaueo ()trur(o oo1altnlnct tfsDumx  ;t4ope moeildfmDelu pnt4arenmr todfptraueslt) 2urim nu4omen icsl( s2ur( ooo4apx  ieiasfs rlumo;t)altnmo3oydoa  li slt0s2trxm ny1ope liesat) 2taurpnt4aleomictltls elu o u)tlenir to1fatran s;(  eumim no1am elncs (fsDuaumo;o4altnmo3tltlmDemuvs;()treoxf io1lpDran i;(0srtrirpny1ole  fviat)artmum no0opx  i3iysfs ulnvsnt) renir3io1omtranvsls  2xoir3oydlmtn fvsltf ruau p;u4tlto i3iyt m2emu p;t0 rtnxfctytfaDe i ols0 etmxo3nudap n nvsl() Dtru pno4tleo i3tytls rlu pn(4 rtoxr3tatfpDe u ols0t2xmxopoy1lpe  ncilt  rrrx pnu4tpeo i3iys aDrlnmsnt4artnir3iatlpDr i i s srto(r iu1amt mivia()srur( p;u1tptomfetytlaDeau s;t4artrif iodop elnes t0teto(m io4llt lietlsfarrm(m nu1olxoii3tlt a2umump;()aeenifciodfmte ivo;t0 2urirpno1lm e nct s a2tr( pnt1openiiciadfa2ua( onu4 etnxfcoo1oa   uvi ()trum(m3io1lme mnctl( sDra(m nt1tle  ieiys s umn pn(0tetnifctotlaDr nvol( setoiopiodal nmnes s)s2urxrp;o0alx  f3tydls2emuvo;(0 eeomo oy1opte uvo;s)trxrir iudol nlfvtls)aDrmxmo;u4aetnio3iyt mDraumo;(4 eermf3tatoate neo;t srxmim nu4apeeliciasf rtm(rpnt4apenmicils s um(vo;(4tltnmr tatlpD lu i t  ruoir3iy1op  micsat sDtrx p;u4tltomfciatla2ra(ms;t0 rxnmfctadla  lieil(0setm(m3ou1lltnmfvsas)a2tr(mpoo0tpeniieiltfa2rau p t4aeenmocoatomDr nvil( texm(o iy1llt  feiatf ruaxr nt1tleomoeiysfm2ua(vpnt0alenir3oo1lpDrau ilt)srtrxmpou1omen nvsas  2rrx  nt4alxnio3iadfs2um(vo;u0tetrxfctatla  lu s;() rtoxr oo4ope  iei ()aDuaum ;o4tltn f3iasls2ul(ms;u) rxrif3oy1lmt  nvils0 rtmxmpno4ole  iet t arurxmp;t1tpe iicildlsDea( s (4texomocoy1fp r u o (  etrir3iu4omt  ictl(fa2umx pno4apenmi3tld s emums;t)tetrmr3ta1op  auei;()t2ur(r3io1omee ivt t)srrmur ;o1ope mfciyd s uln ont) rtoifcio1fp   ues ( teurio3oydllenmnci t  2ra(  no0tpxn ociydla ulumont0teermo tadfm r nvi t0teurxrpiu1ope  fvsas)aDrr( p;t0oexnif3iyd a uan o;t4aeeoxfcoa1oat  n s;t seuoxrpny4ll nmietlsfaDta(  oo4aex  iciad s2umu s u4aeenxfciydlp   nvsl(  rtm(mpio1al e ietl(fsDrmurono0apeoii3iad sDelump () leniocoytlp  auvsls0s2xoirpiydapenmnetls)sDtmxronu0tltomoeiytfa2ea( s t)texnmo tydoat ln s;(0srxr(r iy1am   iei (f rtaurp;t1texomi3iadfaDumuvsn(0 exoxf3iadlmt  u i t  2xoxm oydale lietas s2rmuroot1tex mfeiydlsDel( s u)tlermr ty1omt aneo ( t2xmxm3iudapeemneslt)sDuaxr nt4tee  ocilsfaDul( o;()altnioctytoaDranvsl(0trurxo3no4lmt lieta()s2umumoou0opeomf3ias a2ean p;u4aetnmrcootfpD luvs s  2toiopno4omt  ivslsfaDtm(rono0apt iietys mDea( o;u4trxnxrciytfa  aivi;s0seumxmpou1amtnmfesat  Drmxm oo1tleomf3iydfs uau o;u0tltnxo oatlmDe uvo (  rumir oo4ape  icilt a2raum no0tle  feiatlmDra(mp (4texrmr3oa1fa   uei;( s2xmxo3ny1om  mnvtat s2rrx ooo0tptnmieiad a2elnmpn()altrxf3oa1lpDrlieol(  ruoxm io1lm   fvsat) 2ra(mp;t4alxo i3iltfm2em(mp;u4trxoif3oatfatraues;s sexmxm oydoptn fvi () rtr(mpot1texn f3tydfs2rau snt)trxrxr3tytfmt luei;s0 etm(m oydam emnvtat) rtaxmpou4alenifciatlm ra( s (0aleoir3ta1lmD au s (0 2toir3oy1op elfcsat) rtr( o;u1opxniiciytla2eaumont0 ltoxrcootfpDeluvs t) eto(o iy1alt lnvslt) rtmxm ot0aet mf3iyd m2ranmo (4 rtrxociytop rauvi;t trtoxrpnydomen fci tfartrxm nu1oetn icildlsDul(mp u4tlermrcoy1la  an sls)trtoimpnu4optnlnesl( srrau oou1aetomi3tldls2umumsn(4trxrxrctytlatrln i;( setmxo iodalt  ieiatf rumx poo4ale  o3iyslsDulnvont4arxoif3todfpt  neilt0s2umxm3oo1op emfct t  ruaumo;o4aexomocildfmDra(mo ()aetrir iatomD  neils0srtoiopou4am   ici sfa2tax  ot4tetomfciltla emnvpnt4texnmf3oytomt  uvi;s0 rtmxr3io1olt mncsa( a2rauront4tptomfcils a2uauvs t0 lerio3iy1omDrluei s0seto(r3ou1ape liviat)a2rrx  nt0aex  fetltfm2ran pn(4tlxoxf to1fp rluvi;s0s2urxr3ou4ole  nvtat) rrmur ou1ale mictat a rlnmo t0aetnxf3ta1oatranvo s0srtoxopiodomeemnet tf Dur(r oo4opx  iciatfsDem( p;t)texomf3ty1lm r uvo;(0t2toxr3nu4op n nvt tf Dtm(r ;t0oeen f3iasfa rlumsnt) lermfctydomtrlnes;(0s2tr(o3ou4ole mictlt)arrmu  ou1alxnii3iydlmDrl(vo u)trenxf3tydom e uvo;s trumxm nudlpenmnesa()s2trxmpoo0tlenmi3iadlm emump;t)altoxf3to1lmte ieolt0 rtoxmpou4llen fetlt)s2raxmp;o1oee ioeiad mDrmnvp t4 ltomf iotomDe n olt0sruoirpio1alen nes s srur(  oo1opto i3ilt m rm(mpn()aetoif tatomt lnvo;t  rumxrpio4om nmneiltfsrrru pot4tpxnmoeiytlaDeln o;t4aexnmr3iotoaDraies;s) rtmirpnudol  lncilt) rtmx poo4ope mo3tlt s emn on(4arxoxfcoodfm   nes t0 2ur(m ou1lmtelicias  Dururono0tltnmiciasfm ua( on()tetnio ia1fat lieo;()teuo(opiudamt livtatfa2rax o;o4opt iociadlm rlu o u0trxoio3tadoaDelu i;s0trurxo nu4lltemfvt (f 2um(mpou0apto oeilslaDemump u4texomf3ta1lp elu ols  rxrir oo1lpt mfvs s  ruru onu0tpe  ieildfsDrln s u) ltnmrcoo1oat aieo;() exoxrpno1lpenmivsltf 2tmxmoot1alxo ictad s2rlu o (4aetrxocta1fa rau i t0 eumio io4ap elivtl()arrau p;t4aexn i3iysfs2el(vp;t0 etrxo tatoat anei;t truo(o oo4oltnmicia(faDtrxro;o4tpxo ieils m2emnmo t4 eeomr io1lmDrln ols0s2xoxr nodlltnlncia(f Dua(  ;o0tleomfetadla2rln p u4trtrmf3ootlp eluvi t0t2urxm3no4olt mnvs t)s2rm(rpno0opx ifeiyslm2rln snt)aeeoio3iatopDrlueol(0texm(o nodlm nlncil(f Draxronu0tltoioeiydfsDemuvsnu4tetoxo3iydlm e uvol(  2um(r ny1olt livtlt)sDrm(rpno1oexnmf3iydfm2ea(mo;t) ltrif iotom  aiei s  rtoxo3oy1om nmictas  2ua( pnt1oltn f3iydfa ulu s;u4 leoxf todfaDrln ols0srur(m3iy4om nlnetls arrm(monu0opxo f3tasfm uan onu4tltnirctadoateai slt0seumxo ny1ap n ivi s) rrrump;o0aexnio3iyd aDrm(mp u)tlenmo3ootfmDeli ols  2umxmpny4opt lnetls  2tru pno1tlxnmoeiadlsDrmu o;t4artnmo3oytlp eln i s0t2xoxopou1lm emfvi tf 2urxmpou4tltnmo3tytfs2rlumo u) ltoxf3oodfptrluvs s)trxoirpiydole lncsls)arrm(  nt1apen ietltls eauvs
\ No newline at end of file
@@ -0,0 +1 @@
+u o s seto(o nudlmenlnvta(f rrmum ot4apenioctat s uau p;(0 rtnmoctodfpDrli s t  rumxo3oydapt lnvtl()a2tmxrpot1alxomfeiyd m2rln p ()trtrxr iatop  aivolt s2uoiopnu1olenliei s artmu  nu4ole  iciadla rmu o;t0trxnmo3iydfmtrln i s)trto(m3iodole mictlt s2urx oot0apeoiieiadlm umn on() ltrxr3iydlm elueolt0 2tr(o3no4lltnlivt t  rua(mo;o1oltoioeilsfaDrlnms;t0arxnxr io1fpDrai i;t0sruo(opiu4llenmfcilt)aDuaur ot1oltomoeiaslsDelnmp u4tetomf oo1omt  ivs;t0trxrxmpnydapee nctlt) Dtr(mo;t1tleomo3iytla rm(mo;(4artnmr iydla  aivs;t  rtm(rpio1lmt  iei ( s2ta(rono1aetoiicilt aDumuvs (4altrxoctatfaDean s;t0trxrir oodoptelict t a2ur(mpnt0tptnmocilsfaDumn p t0trtnmr3io1lm rlivo;t0 eumirpoy1op  lncil(fsDrmxmoot4tptomf3iad m ua(ms t0alxnxf3oy1lpDeli s;()setoxm3nodamt  ivils  rta( p;t4tpe  ietad a2ran ont0 reoxf oytoptraneo s)s2umxrpnodlmenliet t)arur( ooo0tlx  iciltfs2rmuvp u)texnir iy1lm eaneolt  2uoio ou4lpeelici ()aruaxrono4alt ii3iadfm2rlump u0tetomr3tadom elivo ( t2umxrpoudlleelfvia( s2taxrpou4open f3iys aDumnmp;u4 rtoxo iadlmt ln s;t  eurir3ny1open ivsasf rumum nt4alxn i3ildlmDemnmp;t0tltoxf ty1omDr u o;s)trto(r iudopt mieta(fsDrrxro;u0oet  ieiytlm umumon(0alermf iodfpDraneils srxrxr3ou4ap  lneilt)s2urx  ;o0oet  ieiyd s rlumsnu4tltoxr3todomDeli i s0 euoio ou4aptemfcils)srrrurpno1tptn oeiadla2eln o;u0tltoio iydfat  ieols0 ruoxo iudalt mnesat)sDtr(  ;t0altnmf3ilt s2uanvp;t) rxnmf3to1lpDeaueilt  rxrir nodom nmnvt s sDraump;t4opeomfeilsfs2umnvp;t)texnmo3oa1omDe ueslt0 eumim nu1al n fes (fsrrm(root1aptnioeiys a2rlumpnt4altoio3to1oaD anvo;t)teurim3ou4ol nlfesa( aDraxronu1optnmi3ilsfa eauvsn(0trxrifctytom ranei;s)setmxo3iodalen nvsa(fs2ta( pno1opto feiytfm umuvp;()altrifciodomD auvslt) exmxrpoydol  mfesatfa2trumpot4opx ioeilt a2uan p;t4trtrircoydomD anvol(0 2tmirpoodlptelnvsas) rtm(mp;u4tpxniociydlsDea( s;t4aexoxf3oydfp rlnei ( texmxo ny1lmenlfetls srtmxmoou4tltoio3ild aDum(vs;u) etnmr ty1oa e neo;(0seum(r3iydomee icilsf 2rmxr ;u1tex  ociyd m2ua( o;u4aexnmrcoy1faDrli o t0sexm(o iy4omtnlfet tfs2trxmooo0tpxnmfetydfm2eau pnu4altoif io1faDelu s ( srxmxopoydlp  mncia(farrm(r ;t4apeo iciat m ra( p;t4arxoxrctotlpt  u il()s2um(o3oy1om   fciatfaruaxroou1aeeoiociasfm emump t0 rxrxf3ia1lmtrlnvilt)srum(mpou1amt lici tf rrmu pnt1texoioeiyt a ran o t4alxoif3ty1la  lnei t trurxmpio4lmte fci tfa2um( o;o4oex ioctyslm2raumsn(4tleriociotlmtran o (0t2um(m nodlp elivsltf Dra(r ;u1apxnmiciyd m2um(mp;u)tetrmfctytfp e u il()srtoxr iy4al n fvt sf 2taumonu4opeoiiciasfsDulu o u)tlerir todfat aneo;t0srxoxopnu1lltelnesa()aDrm( oot4alen ieiad aDra(monu) ltnmr oa1op eaues t)t2xr(m3oo1lp  mfvtl(  rrax pot0oex  feiyt m2ulnvp (0trenxociodfmteai o;( trxm(m oy4lpen nesa(f 2ra( pno0opxo i3iyt s raump;t)artnxo tydop e uvi s0seurim3ny4opeelnct s) Drm(mpnu1oexomfcildfa ulnvpnt0 rxnir3ta1lpDr nvolt0trto(mpnu4ap   feias  Drrxm nu4teenifciyd a2ran o;() eenxf oytfpte nesls0s2xmxr oy1olenlfvtl(f 2um( pou1olx  ieiatla2ean sn(4treoxf3iydlmt anvols)trxmim oy1lm elfcsatfaDtmx pot1tltomfeiatfaDraumo () rxrmr oatomte neolt0 rumirpno4olt  netls srrr(rpnt0altoio3tld s2rluvsn()tlxrxocio1laDr i i;t)texoirpoydam elfvils  2urumpoo4aeto o3tas s2rl( p;t) exnmr3tytlp e n o s0tetrirpio4lle mnvi t)artrumono0aee mo3ilsla2umnvp;t4aeeomo ootom e nesl() ruoiopoudamenmfviatfarrax  nu0alen fciatlm2umn pn() eermo3iy1la  luesl( s2ur(opnodll nlieiatfa2raxmo;u0oet ifeils a2ua(vs;u0artnifcty1omD luvslt setoxrpnu1aptnlieiatf Durxmp;u0tleoiociys m ulnmsnu4 ltrxr iodfmD aneo;t)t2xmxmpou1amtnmivilsfaDrrxmont0ape iicild s2uluvp;t4tlenxo oatfpt ai i s  rurio3ny4am nlfct (f Draur ot4apeomi3tadlaDulnmp t)arenifctatlp rlnvil()t2tmxm3ny1aptnlici ( s2uau p;u1tpe iicils s ran o u0tltrxo tadfpt aies t  2urxr3nudlmtn nvs (fa2rr(mo;o0oetomieiysfaDran pn(0 lenmf3ootomteli ols)sexoirpio1ale lfeiltf rrru pou4tpt ii3ils mDrm( s t4teenxo3oadfp r n olt seuoxopiu4lmtelfvt s sDta(ro;u1oltoiicilslsDrau s (0 ltoxf3ta1lm r ivi ()texr(r3iydalt  fet sfaDuauroou0apxomfcilsfs rlnmpnt0 rtrxfcoa1opteaivs;s0 2ur(o3nu4al nlicsl( aDtm(monu1aeeoii3ilsfm2emuvp (4artnxr oo1lpteauei t0 rur(o3iudllt mics sfs2rrurpou4olt mi3tad mDelnvp;u)artrxr3oo1fmDr nvolt  2xmirpnodapte nvsatf 2rrur ;o4tpxnio3iatls2rmuvpnu4arxomo3todopDran ils s2tmio iudlpt  netlt)sDraxrp;t4tpxn o3tlt m2eaumon(0areoxr tydfp elivo;s)sexmir3oo1amen netlt)aDtmu o;o1olx mfeiyslsDrlu on(0treoir ootop eaivo;t) etm(opoy4op n ics tfs2urx pnt4alxnifciyd sDelu pnt4 rtrmr to1fpDraiei s t2xmir3iy1lleelictl()arrrx pnu1tptn oeildlm2umu snt0 rxnio oa1lat  ueo;t)seurxr ou1ap   fesl()arrmxmpnu1apeoiiciatlm uan o () eerxr tydlmtr neol(0t2tm(m ny1ll nmfvtls  Drrumooo0aeenmoeiat m emu p u4teeoircia1faD aies t t2tr(mpnu1lmte ici sfs2rrurpnu1tetnii3ils a ua(ms u)alerir3tytoaDrai s t) rtrimpoo4ape  netl(  Drr( p;t0apeoio3ilsfmDean p t)aeerif3to1fmD  i i t  ruoxopoo4llee nvil()artau p;u1aeeomi3iysls umnvsnt0teeriocta1lmt  n i;s0trtoiopnodolt lfeia(  rtmx  no4tlto ociyslmDra( p t)texnmo iytlptranei;s)t2tmxo oodomenmictat)srtmu o;u4olt ioeiysfs uanmp (4texnxr iotfptr nes () exrirpou1olenlfet tfaDtaxm no1texoiieiysla2rl(vpn()tlxriociytfatr n o;t0trxrim3oudameelfcta( s2trurpot4teenioctatfaDra(vo;() rxnmfcoadoatrauvi () 2xrxmpiy4lpte nvsat) 2uru  no1optn f3tasls rm(mp (4altrxr iytopD lu s s0trxo(rpiy1opt mfct t  Dtrumo;o0tpx  ieildlsDean p u)aeeoxocta1omteaivilt0s2tmimpoy1aptnmivsls sDtax  ;t4tlt  feiadfa umnvon(0aeeoxr io1fatrlneil(0t2um(o ny4alenlfvt t)aDrmumono0alxn f3iadfmDuaumsn(0aleoxr oadfmtr ueo (0trxrirpnodam e ivsat)aDrrxmo;u0tle io3ilsfm ua(mp u4aeenmfcto1faDeanvslt)t2tr(mpnydop  mfvi s artmxrooo4aet  ietytla rl( s u4tetomr3oydomte ivo s) eumirpnu1lp e net s)sruau pnt0tpxn f3ildlsDrmuvo;t) etnmf3ty1fp eli s t0trum(opnu4ll e nct s srumump;o4opx mf3ilt mDuln onu)tleomf3oytomDrauvsl()setmxr nydlltnlnctls sDur(m oo0apxn i3iyt aDrm(vo t4 rxrmfciotfp  aieilt0 rur(rpoudlleemfeiltfsrtrxroou0tpe ii3iyt a2ul( o;u0tltnmrciodlm rai s s t2tr(m3no4ll n ietls aDumurp;u0apxo iciasla2ulnvon(4aexoxr io1fmD ai sl()setrim3oo4lmtnmfvsls srumu pnu1aetn ieiltfs2uanvpnt4alxrxo3ta1fpD  n sl(0 rtrirpoydomee neta(fs2rr(mpoo0tltomfeils aDem(mon()alxnxr3iytomtrai o;s)srxr(r3iudoleemieilt)artmxront1tle mf3ias s2rau onu)tlxomo3tatoptrlnvo s) rtoxm3ny1llt mivtl(farua(rp;t4aleomo3ilt s umnvs t0 exrif iatlm   ueols0teur(r3nudomtnlies s  2trxr ou1oexo o3ildfa eanmo;(4 lxnxo tatfpDelies () 2xoxmpno4alen ncsl(fsrrmumpnt4aleo fctls s rauvp u0trxrirciy1omDraivslt0 exmio oudlm n nciat)sDumum ;t0tptnioetasfa em(vo (4 rtrio totlptrlueolt0srxm(m3oudapt mfetlsf rur(moot4alto f3iltlmDrmumo u0aeeoir oydfat  n s t setrir3oy4llenlfes s  rtmxro;t4aeeoio3iyt s rm( o;()aeerifciy1fm  lues;()sexr(o oydllen ies s) 2taxrp;t0aeen fcild s ran s;u4arxnxoctytlpt lnvo;t) exmim3iy4lpeemnei t)sruaumoou1tpxn ieilslaDra(von(4artrmf3ta1oatrauvi;s teuoio oy4ol  mnvsas) Dtm( p;u0tleoii3iyd sDemnvs;t0teeoircoo1omDe ivo;s)texmxrpiodll nmnct s  rtmumo;o4oee mf3tasfs rmnvp;u0alxnxo3tytoa   nvi;s) 2xmim3iy4om nlnei ()a2umx  ;u1apeoioetasfs rln p;(0texoio3io1opD auei;(  rxoxo3io4lpte fcia() rtaump;u0tlto ociasls2em(mont0teeoxfctotoaDelnvsl(  exm(m3ou1op n feiat)a2trx o;o4olt if3tatfs ul(vp ()artrxo iy1oaDrln i;( seurir3oy4om elivia() 2umx pou4texn oeiadlaDrm( sn()artnxr3tadfa e ueo (0 2umimpiy1aleelivsas)sDur(monu4aetomfciatfa2ulumo ()aexoiociotoatrauvilt trxmiopiydlmen fetlt srrrxmpno0tlx mfciyt mDrln s;(0 ltnio3iotfmtr i s;s seurxopnu1ll emfesls)aDum(mpoo4tleoif3iadfm el(ms;u4 rtrxfcoytfa  lnvi t)truoxo nu1ameemnvilsfaDtmxmono4aetnmoetatfaDuauvp;t4 lenxo todlmt aivolt) 2umxrpio1omeelnei tf 2rmu o;u0tetn oeiyslm2uluvpn() leoxrcoytopDraieil(0 2toio3iydome  ncslt)a2uax ont1apxomietaslaDeaumo u0trenirciodfmDranes s0t2toxopoy4openmietatf Dta(mp;o0opxomictls s umu on()tleoir io1lmD livi;t)srumxr nodalen iesat  2rruro;u0tpxo oetltlm2ulnmon(4 lxnmo oodomDr n ilt seum(r3oudop nlnvtl(  rrru ono4aet iiciltfm emnvo t0trermr3iytlp  au ol(  2to(m oy1om elncsltfsDtrx  ;t0ope  i3iltfmDuaump;u0arxnmr oy1lmD aieo;s)srurxm3ou1am  mneilt)s2ra(r ;t1oexnmo3iydfa ean p;u4 eenxf3iadlptrlueslt)srtm(o3oo1al elfvi ()srtrxmpou0tlxnmf3iyd a2ea( pnt0 etomf3iytlateanvol(  2xmxm3iydamteliei t) Drr(rono1oltnmieias sDuanmo t0altnmf3iy1fmt aues s0seuo(o oo4altelnvtltfa2tmx poo1olxniictadlm2rl(mp t0 etrmf3to1om  anes;t)s2tr(m nydlmee ictls)a2rr( pot4oexo octas m2eln pnu0 ltnmo3ootop r nvo;t srurxm iy4lpt  ivs t)sDtm(r no4opeo iciatls ua(vp;(0trtnmociy1optr iesl( setoxrpoy1lmtnliet s s2raxrooo1oex mi3iyslm elumo;u) etomr io1fpteaivi;()s2tmiopiydale lfctlsfs2tr(rpnu0tlx mi3tadlaDrau o u4 rtnif totopteauvi;s  2xrxo3no4lp nlfvi s sDtmxrooo0olt  i3tytfs2rln s;u)arenxfciadfmD ai ol(0srurim3oy1lme licsas srua( ono0tpe  ietat aDranvs (0 ltnir ia1latrlu olt0 2urxo3iudamenliesat) rum(m nu0tleomiciatfs umump ()aetrmrctadfmte n s t0 eumxr3nodomenmivias)a2ua(m ou0oexnmieiyd mDrlumon(4artnifcoy1omtelnesls)trtoio3iodlmenmfvsa(fa2rrumo;u1aeeoiictltla2ra( o;t0artniocty1fpt aivils0 2tmim3oudole liesa(fsDtr(mp;t1aexoiociltfs2uluvont)trtomocootfpDr uvil(  2toxm3no1am e ncsas)s2rmxmoot4openioeiaslm2umnmp t)teerxrcoadlmDe ivo (  rxr(rpoy1llte iesl(  rtrxm no4alxnmfeiys a ran o;(4texrir3ootopDeaieils) exr(o nydoltemivtat arrmump;o0apenioeiad aDua(mp u4 lerxrciy1omteanes;t0s2umxm oy4opte nvi s)a2rm(  nu4oeto f3tat mDul( s;u4altrif oatop raies;() rxmiopiy4oltn ncsls  Duax p;u0opt  o3tlt s rlnmp u0 eenio iatlatranvs t0 rtoim nydomtn iesls) 2rrumooo0ope  i3ild m2rmuvsnu)trtomr3tytfa  li o ( srtmxm iydam nmfctl()s2urxm ;u0tetn o3ilt s2rauvo (4altoxf oydlpD  ieilt0srto(r no1omtemnvilsf Drmum ot4tex mi3iasfaDrl(mpnt0teeoxrctotfmDeau o;s  rxmxo oo4lmte ieil( a2tax  oo0oet mf3iadfs2umnvo u)arerxociydlatr ivi t0seuo(o iudlptnlfcsasfa2taxr nt0aex mf3iadfa2rmu p;t) rerir3iatlaD  u o s seuo(r3io1opt mici s sDtmxm ot0alxo i3tlsls2umu snt4 exomf ty1fmt aiei () rtoim3oodlleemnesasfsDrmxmpou4apxoifeiysfmDea( s;u0 ltnxf iydla  aiesls0srtr(r no1ol n nvtat)arua(rp;u4tet mieildla2ua(vp;t)tetrmociytlmDrln s s srxoxm3iodal e ivtas)a2ra(rp;u4tpe  icilsla em(vo ()altomf oa1faD anes t) rtoiopoudll elncta(f Duaxront1tpx mi3tltla rmnvo;() rtrif iatla   ieols0texr(m3nu4lp n fvsls) 2rrur nu4olx ioetlsfa elnvont0trenxf3iadlpDe n o ( srxr(r iydlp   iesat arua(  ou4aetn oeilsfsDrm( pn(4 ltomf iy1fpD aies;s0s2toim ny1lptemfct t s2umx  ;o0tee ifciytla2ul(msnt)aeeoif ta1latrlivi t)s2xrim3oy4lp nmfeias arrrur ;o0apxoiiciadfm2uluvonu4 rtoxf3ty1lpt lu il( teumxrpnodapte fvtas aDur(mpnu0apeomf3iasfaDrm(vp (0 ltrmfcoadlat ln o s)setoirpoy1lptn nci tf Drrx  nu4apenmoctltfaDel(ms;u4tlxoio ta1fpDe u ilt)t2xr(o3ny4lm e nct () Dtru p;o1aexoifciysfaDra(vpn(0trerircoatlmDeaivolt0truo(m3ny1om elfcta() Dtmur nu1tlxo ictas mDean pn()artoxf3iatlpDe neols setoxopno4amenmnvil(fs2urxrono4tpen fctyslaDul(ms;t0 rxoif oodfpDe ivs s0t2triopoo1lmtelnet sf Dtrurpno0opxoifciydla2eau pnt4tetnmo tytlmD lueslt) euoxr io1openmictlsfsrrrxro;u1apx io3iadfsDemnvp u) lxrxo3oy1fm   neol()seumir iudomtelivias sDrm(mpot0tleniictls aDeau o;(4teenxo3oydomDe i o s sruo(mpoydalt liet s  Dta(m oo4oeen ieilsla uln on(0artnmf3io1fa   i s t s2trxo3no4lm n ivi (  rrrx  ;t4tptomfctytfa2eaump;(4 etnxfcootfmDrli s ()sexoxo3oo1llee iesatfa2rau  ;o0tpen ictld a eln ont0alenifctytfat li slt) rxm(mpoo1om nmietas)srrr( ono0aleniietldfmDuluvs t4arxnio iatfmtelueils) rur(mpiydlp e iet (fs2rax o;o1apxnioctadls ranvo;u4tleomo3ta1lm  li o s0t2xmir3io4ol e ivi t srrrxmp;t0opxnio3iyd s ea( o u) exoio ia1fmDeaivols0srxo(rpiy1ale  fvilt sDrmx o;o0aptn icildlsDuauvon(4trxnxo3ta1la r nvi t0t2tm(m iudoptn ietl(f 2ua( pot0tptnmi3iatfa rlnmpnu0 lxrxf3tytfmD  u slt0s2xo(r3io1lm  lfvsas) rtru  ;t1teeomo3ilsla rauvo u)aetnxo oatfmDe nvsls0truoxopoo1om e icias) Duauro;u0aexnifciadls emuvp;u4texoxr ta1lmtrluvs t srxo(o3nydlpeemfvi sfa2um(  ;o0opt ii3iltla eaump;u0artoxr ty1fatr u ilt  2xoim3nu1op e ici ( srtr( o;o0oltomoeiys a um(mo t4 eermo iadomDeln o;t0s2urxrpny1aptnmfvt sfa2trumoou4apeoifeild s2ua(mo;(0tlxoif oadfmD ai sls0srtrxo ou4op emnei ( s2rmxmpnu1alt  oeildlm ra(vonu)artrxfctytoaDrlnesls)setrxo oy1ll   fctas  ruru oot1alx mictytlaDrm( s (0 lerxoctatlm r n slt) 2xoir3oy4apenmnvtas)arra(rpnu1oee if3tys s2elnmo (4altrxr3tadlmteauei s  rtrxm3iodoptelnvsasfaDua(r ;u0teen ictydla2rau o;(4trxrio3oydfa e i ilt srurim3oudlp elfcia()a2raur no0tpeoiiciatfaDrlnmon(0 rxrif totfm rlnvsls)s2trxr nodam e nvtl( sDrmx ono1tlen fctlsfm2eanmp u4tleoxr tytlmD  n il( srtoim ny4omtn ncta( aDtrx  nt4oexomo3iad s2em(vo (4 lermoctatoaDeanes t trur(r3oy4aptnmfcsatfsDtmumpnt1ape  ieiadfm2ulumonu4tetomf tytfmtelueo;()t2xmirpio4omeeliviat) 2rmur ou1oeto icild a elu s;(0 rxnxf3oatlmtelnvo t) rurxr3no1apt miesa(fsDrmumonu0tpto ieilsls2uanmsnu)alxrmfciadoatrau s (0s2xrxopiu4ape  ncs s) rta(m no1olxo fciysfs ran p u0trenircia1lptr i il()truoim3oo4ap nmnetl() 2ra(rp;o1opeo octadfa2rluvs;t4 etnxfcoy1fm r ueo () rxrim3oo4ope mncils)sDua(m no0optomi3ilsfmDrl( pn(4 rerio3ty1la e i i s) rtr(mpny1lleelfeiat a2trumono1opt  fciytls2emums;u4aexnxrcootopD  u o;t  rxr(m3iu4am   nviat s2raxro;o0tpx moeiyt mDel( pnu)trtrmfcta1faDrlu ilt0 exmxmpiodame  net t s2rm(rpnu4altnmfetas s rmuvp u) reomf3oatoat anvilt0trtrxr3iu1ol n ici (faDtrur ;o0opxnmiciasfsDemuvsnu)areoif iy1om e i o t s2xrio nodalt mnetlt) rrrur ot0aexoii3tys a elumont0artnxf3tydfa   i s ()t2xoiopnydll n ivt t) Dum( p;t4tpt mo3tysfm eaumsnt)arxrmrctydoaDeaues;t trxoimpiu1lpeelietatf 2rm( pno4oetnif3ilt m2ran pnt0 lerio todom  anes (  rtrim nydoltelneils)sDtrumpoo0opt mf3tydfsDem( onu0teenxoctadfmt  nvslt)srxoxrpiudal   icia() Drr(rp;u0optniictlsfa umnvp (0 rtoxo ty1opt  nei;s setr(o3nudlme lncsl( s2ua(mo;o1olx mi3iaslaDuanvs (4tltnmocoytop  lnvo;(0teuo(r ny4olen fvt t arrrump;o4tptoiociyd m uluvp;(0tetnxr3tatlm rln sls t2tmir3ny1ol  lneia(f rrmumpoo1oex iictlsls el( p t)arxoif oydlat ai s s)setoiopny4lmte nei tf Dtmumpou4tpx mf3iatfa2rmu o;()tetoxfcta1oat  uvols trxrirpoy1aptnlnvsasf Dtaump;o4ale iictldfm2ra( onu) etomo3totfp r uvo t s2xrimpno1lme liet t)arrmur ;t0tpe micilslsDemnms;(0 lerifcoodfp eluvs ()t2xm(o3nydamtnmivtas)s2ta(m ;o0olxomfciatfs ua(mp;t4aexnmo3oatlpDeliesls0tetm(o3no1opee fci ()a2ta(monu0apeoif3ilsfa2elnvp t0tlenir3oatlp rln o;( teumxmpiydomtelnet s)arrmurooo1ale ifeiyt sDraumo t4trtnif3oodomt aivils) rurimpiodalt micslt  Drm(m ot1ape  f3iysla2ulnmo (0 etoif oytfa  lueo ()texo(r3iydomeemicsl() rumx p;u4tltniietydfa rluvs;u0 rtomo oy1faD lneo;s)seumio iudape lnvs ( srraumpnt0tle io3tysls elu o;u)aexniocto1lmD  nvs;()srum(opou4lpe  iesas srum( oot0tlt mf3iatfm ra( ont)treoio3oadopD  nvi s) 2to(m ny1lp   fesa( arra( oot0alxomoeiytlmDumn o u4 exrmr to1lpte u o s0srum(m oy1lmenlfesas)aDua(rooo4alx  ieiys m2el( s;(4tltrxociodla e u i s  2xm(rpou1amtn ieils s2uaur ot1alxoio3iatfaDumumpnu0trerif3tytlmt  u i;(0trxr(m ou4aptn iei (faDua(mpot0aeenmo3tltlm2ra(vsnu0trxomo3to1fmDe n o t) 2ur(o3oo4lp nmfvsls)a2tr(m ou4aex miciyt sDul( ont)tltoxf oydoa eauvsl(0s2urxrpiy4am nmfesat a2uaur oo4aeenmietad s eluvont4 eeomr3totfaD livil() eum(m no4altn nvta(fs2ua(r no4tltnii3ilt s ua( p;u0treniocoo1faDr u s;t s2xmimpiydop nliet s  rra(mp;u0apto octlsla ran s u4 leoifctodlaDrlnvi s)trtrim3oo4am elfcil(  Dtr(mpou1opxoioetasfm em(vpn(4areomrcoatlate ueil(0 etm(m nudomen fcsas  Dua( pnt4oeenmieiad sDraumo;u4 lerxf tytoateluvi;t trtmir oo1lm  lfctasfsDua(m ou1open o3iyd sDrau pn(0 leoifcty1oa   uvi;t  2tr(r iudlpt  nctat  rra(  ot0tltoioeiltfm2uanvont) leomo ootfpDranesl(0 2xo(r io1altn icslt a2trxr ou0optn f3iatfmDrlu ont) exnir3tatom  aivi;s0truoiopoy4ol  mnes s arua(moou4alt miciltfmDea(vs u)alenxo ta1opDe ies;t teumir3iy4om  lnetlt aDrrxr oo0aexo oeilslm2em(mp;t4tltnxfcoodlp e i i t)seurim iodaptemncia()s2tmurpnu4tleo fciydfaDemn p u0 renio tytoaDeauvi;t s2tmimpiu4op  mncilt a2tr(rpot4tetn ietltfm2eluvs t4 leomf oadlp eaueolt)s2trirpio1lmeemfcs ( s2tm(moou1aexnifeiytlaDrmn o;t) lermocoodlpD lu sl( tetriopnu1lle  icsls)srrm(mo;t0alto ocild m2rm(vp t4aeenmf3oadoa e iei;t)srum(o3nu1om e icslt) rrrum oo1oleo f3iltfa em(mpnu4tltnifctodfpDe uvo;s srur(rpno4opee fvta(f 2trurpnt0tpx  ociytlm2umu p (4 lxrxo oydfmD anei (0 eto(o io1ap nlivtltf rrr(mpoo0oltoiictatla ul(vp u) rerxr3to1oa eln i ()tetm(rpno4ol elnctatf 2uaurpoo0ale  f3tadfa2elu onu)tlenmrctadoaDeauvolt  ruo(opoodllenlictltf Drrurpnu1optomfciytfm2rm(vsn()aleomocto1lateanvsl(  rtmirpoodale mfeta(f 2raur ot0altn f3tldls eanvo u)tlxrir oa1lptrlnvo t  rurim3nodole mneslsfsDuaurpno1tlto icildlaDrmumsnu4trxomr3iy1opD  nes () 2xrio iodlmeemnei ( srumxroot4oeeomfciys s el( o;u0 eeomf ty1la eluvs s0trur(mpno4ole lnvil(f Dtru o;u1optnio3tld aDumuvs u4 eerioctydfpD aneslt)s2xoim no4oltemfcils  Durx o;o4aexniietad s2rmn s;u0 lxnir oy1fp   i slt0s2toxrpoydame lncsls arrr( pno0tpxn feild m rlnvp ()tlxnxocoatopte nvo s)srtrim3oy4amtnlnvtls)s2ra(rp;o4tlt  f3ilslm em(ms () rxnircoydlpDrli i;t) etr(r3io1ameelictl(fa2tr(mo;t1tle ioetlslsDrmuvsnt4 rtrir tytomD ai i t0 2umxr3iy4alenmfvtat) Drmx o;u0opxoio3iysfsDeanms u0altnmocto1oaD lu ils t2xmxm3oy4al e fesat) 2uaxr ot4oex miciysfm ra(vo u)tlxrxrcio1fpt ai i s teur(r nydop e nvtatf 2tauront1alen feildlsDelnms t4 eenio oo1lptraieo (  etm(opny1omte ics (f Dtaurpnu0oleniocild aDrmnvpnu4 rtoxr3oa1fmt livi;t) 2toir oo4lpe lnesl(  2rm(m ;u4aptn i3tltlmDrlu p u) reomfcoydoa  auvol()t2tmxmpio4op emicsat) 2rrumoou1texn ieiatfs eluvont) ltomr tydop e n o;t t2urirpiu1llt  iesa(  2ua( o;o4oleo ociys s2raump (0altnmo3iadlpD aieol(0 2xm(opio1lltn fcta(fs2ta(rp;o0openmf3iytla uan snu)tltrif3totla  ln i;s tetmio3iy1omee fet t)a2rmxr ;o4olxnioctld m ul( s ()altoio3oo1oatr n i;(0 etriopny1am emfesl()sDua(roou0tlxomo3iatls2ul(vo;u)tltomf3io1fmDe u o;t)srxoxo3ou1apenlfei (farumu  oo0oltnifctltfsDumuvpnt)alxoxrcoa1om rai sl(0sruriopoo4ol e ici tfsrumxrpot4oet mi3tat mDeluvp t)trxnio3oydlmt aieol(0srtmiopiu4omt mnes s a2urxm nt1tpx moeiadlmDrl(vpnt4 lxrxf3totfateaneo t0sruoirpoo1amte nei t a2ra(roou0aleoiietyt m rl( s;u0arxrmo todoaD  i s;s s2tm(o iydaptnmfcs (  2rrumpot1teenmf3tad a emn ont) lxrxo3iodoptrlieols0teur(rpnudlp e feslt) Dta(r oo0tetnifctldfm2emnmpnu0teerxr oa1oatr neols tetmxm oydolt lnvtas aDur(rpnu0optnio3ilsfs emump;t0tlerio3iytfa ran s s0srurxmpiudlmtnlieta( arrmxr ot0altn octatls ua( p;u0 leomf3ta1la e ieol( texoxm no1optn ncsas s2uaxr oo0olx  icildlm2rmump t)teeomr3iydlmteai ol( texoirpoydlp nmnet t artmxmo;t1ape iociyslsDulumo;u) lerxf3oo1oaDe n o (0t2tmxr iy1ll nmneta(f rraur nt0tlxomictytlm uln p u4tlxrxo ty1om  lies s0 2tm(r nu4olen ies t) rrmumpoo1ole ifeild s2elnmpnu0 reoio oa1lptrln slt0t2urxo oodlm e nvsa(faDua(  ;t4teeo oeiatla ea( p t4trxrir3oa1lpD ai o;(0teur(mpiydam   nes sfs2raxrpou1texniociydfaDulnvp t4aetrxr3ia1lm e n s;t) exoxo iy1omt mics ( aDrax o;u1alxnmoeiytlmDranvon()arerir3iadomte i s ( teurxr3iudlme lfcias  Duru  ;t0olx  octat s2em( pnu0aetnifciydlp r nei;t  rxo(rpou1alee neslt)a2um( o;t1tle mfetydlm2elnms u4 lxnmr3oydfmtr u sl(0 eto(m iu4omeemnvsls a2tm( o;u1tpe  f3ilt aDrau o u)alxrxociatop rlueolt  etrio3oy1altemivilt sDrmum oo1altomoeiys mDuanmpnu0tlenio3oa1opDrai i s  rto(mpno1altn fesls) 2ur(m nu1apx mf3tasfs emu s;(0artoxfcootfmtelivi;t)trtoim3iodap elivs s s2trxm ;o1tpt mociytlmDuaumo t4 lerio iodlptr nei (  etriopou1om e fctat aDraxm ;t1tet ifctytla uanmp u4 etoxo oa1oaDelnei s seurxm iy4om emfcia( sDrax oou0aleomo3iytfsDuan ont)alxrmr3iatomt  ieol( s2xo(r oydam nmiesasfsDtmumpou4ope iocildls rm(mp;u4artrxo to1om  livo;s0 rxrxm iudome lnvtltf Drmu  ;t1tlxomi3tad mDemu o t4 eeoxr3oodop ranvo s  euo(o3nydomtnliei (f rrrx o;o1tpxomi3ildlaDul(vp u0trtnmf3tytoaDe ues;t sexm(rpno1lmtn fctlt  2rmuroot1apxnmociat mDelnvs u)teeoirciodlmDe nvi;t t2uriopoodllt mnctat arrmurpot1oltoiieiasls rlump () rermrcoatopDrln o s)t2xmio io4oleemieias  2uru  nt4tptn iciadfsDul(mp (4tltrif to1lptrlieslt  2trim3nudaltelfei sfaDtrxrooo0aeeomf3ias a2emu s u0artrmrcia1fpteauei t0trxmxo3ny1lptelfcs s artru pno4aetoio3ilt s2uau s u) eenir3iytla e neilt sexmxo iydlpe mies tf 2uau pot0alto feiytlmDemuvs t)altnif oydoa   ueils texrir3iu1ameemfctat sDuaxmpoo4tpx  ociyslm eluvs u0trxrir3iadlp   ieo;(0 etm(r oodamt mfcs tf rur(mo;o1tpxnmo3iysfsDem( pn()tlxrircty1fmtelnvolt0 etmim3no4al emfes (fsDrmxr nu1tet moctaslsDem(mp t0arxnxo iydom e ueolt0srtmio iudalt  ictl()sDtrx oou1apt mfetldfm2eauvp;t0altrmo iy1lmDrlnvslt trto(m nudlm   fetlsfsDumum no0aleo fctls aDem(ms;u4trermocoatopDrluvs (  rxmir3nydllee fes (  Dum(m ;u4ape  octas s2rlu ont4 exnif3oydfp e n s t) euoxr3io4ape livsatfsDrm(mo;u0aex  f3iatlsDuln pn() rxnif3iadfm  aivil(0srtoxo3iodoleelnes ()aDrrumpou4tpenio3tlsfsDum(vp (0 ltnxf iy1la  lnvo;t0 2xrio io1ll nlnesl(f 2uaum ;u1altoioeiasfa um(mont)arermo3iatom  lies;() 2umim iy1ameemfeil( srumx  nu1aleniiciasfm uln p;t)texnir3iatlm  auvs;t0 2xrxmpno1al  mivsatfsrrmx  ;o4alenmi3iatlm umnmp t0alenircoa1lpteaivslt)setm(o io4opeelictatfs2trur ;u0tee mietys m2umu onu0tlenif tytop eaivilt)sexoim iy1amenlnvt sfaDtr(m ou1tpxnii3tyslaDumnmo ()trtnmo3io1lm rlu s s)t2to(r3nu1amtn nvil()a2tmxmpnu0tpe iiciys s2ul(mont4 rerxociadfate ivo;() ruoxo iy4omtemnvi (fs2trumpnu4texnmoctydlm2rluvpnu0 lxoxf3iotomtrlu i;(0t2urim ou1aleemiciat)sDuau ooo1tpe mictysfsDumu ont0tltrio3tatfmtraues s) rum(rpio4lptnlfvsat s2rrx o;u4tptnmf3tatlm2rau o (4 etnmf3iatoate i sl(0trxoxopio4amtnmfctlt) rumxront1tetoiiciydfa2umn ont4 leomfcoa1fat  ueilt  exoxrpoy1lpen icsls)srua(moot4oexnmfeiasfm ean onu)teermf3oy1fpDe uvolt0 2xrxrpoy1ol nlnvsat)aDrmumonu0optoiiciatfmDuauvont0 eermr3oydfmt lnei ()t2xoxm3oydoltelfvt s  2tru  no1tee mociasfs ean o t) rtomf3tydoat  n il(0t2tmxm no1lmt mnvs t aDraxronu1altniictydls2em( s u4tetnmfctytfpt  ivo s0 etm(opou1lleelfctltfaDrrumoou1optoiictadfa2ea( p (0 etoif3oatlpDe ivs;s0teuoimpno1ale mivslt  2rrumo;u0opt ii3tasfs2ran on(4artnif3iodfptranvol( s2umim3no4lm nlnvt t a2umu pou0tlt mictys s2rmu ont4 rtrmf oadfpD lu i t)t2xo(o ou4openmnviasf rraxmpot0aex ioetatfa2elnmsnt)arerifctatfpDelivo;()s2um(m oo1lm elics s  Drrxr ;o4tpe mfeiltla2eau p u0 eenxfcia1lptrlivo;t)t2xo(r io4llt lfci (farumu ono0olxn oeiydfm2uaumsnu0 rtnxf3ia1fmDr nvi s)sexoim io4altnmietas aDrruronu4tpt mf3iadla2eauvonu0 renmr3ootfa e n olt0texoir3iydap elnvslt)s2um(ro;t4ole  fetls mDeln s;t0 etoio iydoa eanes t s2tm(opou1lmtnlietlsfa2um( p;u1tetoio3tyd a rm(vp;t)altniociy1laDe ivo;t  rtmio iodaptn ivtls)aDta(mpot0oetn ieilsfa eauvp;u0 ltnio to1fatr i i t0t2xrim3oodllt  nes t sDtrxr nt4tpxnmf3tltls2ul( pn(4aexrmo3iadoate ieslt tetrxmpoo4lle mfvils) rrru oou4olxn f3ildfs2em(ms;t4texnxf3tatfm e uvi;(0trumxm io1omeemies s a2rm(mpno4tpxo ocils s umump;t4texrxr ty1lp rli o s  exo(m3oy1lpenmfvils)s2tmurono1tetnii3iat s2elu p;u4teermo iodop r i sl( t2xm(mpnu1lm emivil(f rtaxrp;o0oeenmietatfm2ul(mpnu) rxomr3oodfmt aivi;t0s2xoim nydomen nvia( aDrmumpoo0apeniociyslmDrl(vo t0trxnxr oydlaDeaivi (0t2xoir nudam  mivtl(fsrumxr ;u4oetomietysfaDrl(vont4tltnif ta1lpDelivo;s  etm(mpio1olt mneil()s2raxrp;u4texomietldfs rau sn()tlermrciytlpteanvi s0tetoiopnu4aptnlneil() Dumumpnt1aeeo iciltfmDem(vp t4tlxnmr3tydomDeaueslt) 2tmxm3oodoptemietas sruaur ou0apen fcild m uanms;t4trerxr oadfp eauvi;(0srxm(r3no4amtnmnvslsf Dta( pou4apxoif3tytfsDua(ms t0 eenir oa1fp e i i;s  2ur(opoudomte ictls)s2rr(moot4tpen fciydfaDuauvs u)tlxnxr3ia1laD auvil()s2uo(m oy1apenlivilsfaDtr(m ou0oee ii3iytlsDemn p t) rxoircia1fmt lieilt) etmir ou4ll nmfvtlt  rraump;o1ope io3iasls em(vp;()tetoif3iadlm  li s s0 2xoio3nydol   nvtat aDtrxm ;u0tpxo i3tydls2rmnmpn(0trxrxf3oatop  lu i;( trxo(opny4ole  fcs t)aDra(m nu4tlx iieiydfaDel(vp u4texoxr3ootfm rlueils t2xoxo oodllt  nei ( arrm(r oo4olt  ictldlmDrmn s;u)trenmr3ootlmD lueolt) rtoim3iudlptn nci t) Dua(rpot0aee  oetlt s2uau pn(0trxnxoctytfaD ai i;s0trto(o oudolenmfvta()aDurum ;u0olxn ieiadls elnmo;()areomfctotfatelu ols sexr(m3nudoltelnvtat)srta(  no1tlt mieildls2emn on(4tlxrmfcoadfpte ivsl(0s2tm(o3no4lmt  fci sfsDtaurpnu1aee mo3iatls rl(mp;t4aexnmr3oodfm rau i t)tetrio3no4lp emictlt sDurxr nt0opt iociysls2emuvonu4tlxrmo3iytfm eliesls0trxoim oo1ll nmnvtl()sDum(m nt0openmi3tldfsDemn ont0 lxrxo3totopD lnes;s0trxoir3iu1alt miesls)srurur ;t4oeen oeilsfs2rl(ms (0 leomr3oydlaDrai s s srxrxopny4ll nmiei s arumx p;u0tlt if3ilsfa2um( p;t0arerir3tadoptraivil() rtrir3iu1ll nlfeiat  2rr( oou1tpxo icils m ean s;t4 etomo oadfptelnvilt)t2tm(mpiodlleelfvia(  rtrx p;u1tpt iietysls2emumont)trxoir3tatfm   i sl( teuoio3ny1op nmfvt tfsrumxr oo4aeeoifeiatls emnmp (4trtnmo3oodfmtranvi;t) rtrir3ou4ale lictlt) rraxmpot4aexoif3taslm umn p;u) reomo3oo1lmtr nei s0 rxrxopou4amtnmncsatf rumuronu0tlen octlsfs ra( p t4aexrir3iytfa   uvs;( sexoxm nu1lmtnmnesas) rumxm ;u4alxnmi3ilt sDra( s u4tlerxo ia1fpD lueolt s2xrimpiydape  icsl( a2ra(ront4opx if3tasla2eauvo;t)tetrir ia1fat aivslt t2triopiy4lp n ivs tfs2rr(rpou4tltnmfeiat aDuanvon(0trxrmf3ootfptrlivi t)trxmirpoodomt lnvta()srtrx pot1texnmfcild m rm( o;(4 renmfcia1fat luvs;s)teumiopou1lptemnesat  2ra(  no4tpxoio3iydfaDumnvsnt)alxrxr3totoatr neo;(0trtr(m oo4lp nmnvtls artmxmooo0olx ioeiasfa2ranmsnt)arenmo ia1fatr nvslt)texmxm iodll nmneilt)artmur nt4tex  icildfsDrmnms u0 exoircoadfpD  nvilt  2uoxm nydlptn icil(  rumxroou0tle  fciyt aDelu pn()alxnxrciotlm r uei (0teur(opoydllenlictlt)arumxmpou0tpe micilt m um( s;u4tleoif3oa1fate u s;t)seur(o ou1omenlncsls)srtrumo;u1oexo feilsfs rlnmont4alxnmo iadomDraivo;s t2urir3nodll  mneta(  Durump;t0tpe ifeiyslm2rmuvont)texomociy1faD  ivi s t2um(r3ou4oltn netasf Dtax poo0aptoif3ilslaDeaumo;()tlerxocio1lp  aivs;t0t2xr(opoo4amt mnvt () rraurpno0aexo f3iadfsDrmums;t4tlxrmf3tatfaDe uvols  exrir oodlm e ies (fsrraxro;t0oetnmoeilt m rl(vp;t0 lermrcty1fp rlieo;() rxoxr3nudom  micsltfsDrmurooo4tpeomf3tatla2ra(ms;u0 eenmo3iatlmteauvsls sruoxopnu1ap nlivsls arur(mpnu1alen icilt m ra(ms u0tlxrxf ta1fa  aivs;s trurxo3io1ap nlfviat a2um(rp;u0olxn i3tatfs2ra( sn(4aeenifctodfmtrai o;()s2tr(m3iydalenlnesatfsrtaur oo4aptnii3tydlsDemuvs;(0 eenif3tydfm ean ols) 2to(o3nu4lpt mict s) 2tm( oot4apeomfeilslm rl(vp u)tleomo ty1lat  nvi;t)teto(r3nydame mieils  2umxr nu0alenmieildla umu s u4trtrmfciytla  livs;t)setm(r3iydomtelnei t)sDtaurp;o0altomoetlt m2ranvp;u)trermrciotlm eau ols) 2urxo iydlpen neslt)srumurpou4opx moeiasfs uanvpnt4arenifctodlmteln olt srtoxr3nydllt  ictasfaDumx p;u1alx  f3iadlsDean p () etrmf3io1fatrlnvslt)s2toxm oodlmtn fcil(fa2rau p;u0tpe mi3iaslsDelnmo u) rxrio3tytla rauvs t) 2toxrpiodaltelfesasfsrurx  ou4opt mieiytfaDumn snu4teenxf3io1fpD anes t)srxmxo3oydopt  nvsa( sruaxrpou1teeomf3iat s rln p ()arerir iadoptrlneo (  eumio3iu1om nlfei sf Dtau  oo4tlt iictatlm ra(vsnu4texnxf iodomt  nes;t s2toio3iy1lptelfvilsfa2taumoot4ale if3tlslm2ul(mpn(4 lermr3to1fatr uvs (0srtmir3iy1lmtemfcsa() 2rrxr no4aptnmoeiytlsDumn p u)arerir3todomD  ivsl(0t2uoimpio4apt livtl(  rtruro;o0apeoiociadla2rau pn(4trxnxrcta1fpt au o s0 rxmiopoydlptnmictat arra(ro;u4teenmiciasla2uaums;t)alxnifciodfpDelnvilt) eurir no4ll   fvtas s2rrurpou1aexoifciydfs2ul( o u) leoio3tadom elieols0setoxr oy1lle lfvi sf rurxmont4tltoiiciltfm2ranvo u4tetrxo3oa1fptr n s;(0 eur(rpnydll e ieiasf Drr(  ot1tlxn o3iyt aDul( snt)tlenmf3tydoptr i i t)trumir3ou1amt mfvils  2um( p;o1tpxo octaslmDran o;()alxnmr ty1fat aivs;t  ruoxrpoydoptn ncil(faruax  ;t0tex  f3tlslsDul(vs u0alxoif3oytom  li i ()srtoirpnu4ll nmicia( aruaum ;o1ale  f3tytfaDea(msn()aetrmr iadomtraivo;s0srto(mpiu4omt lfes t  Dtmxm ot0apxoifeilslmDrmuvp;t0trenxrctydomt aieilt t2xmim3nu1ale mnvsltfsrtauro;t4ope  ociysfa elu ont)teenir3tydfpt lneols  2xmirpiydoleemnvias) rumumoou4tlx mfcild m ra( on()trenircio1fmDr i o;s0teumxm no4lptn icta(fsrtmur no4opxnmoeiyslsDuanvs t)tlermoctatoat aivo s)srxoxm iy1aleelfvsls) Drmu ooo1oexnmfeiatlmDeln snu0 rxrxfcoydom   nvs s0t2toiopnodllenmiet () rrau oot1aex  f3tlsfm ul(vpnu4arxrioctydlpD  ivi;(0 2umio3ny4lptelnetls)srtauront4oltnif3iyd mDrmu s u)alenmr3oadlmDr uesl(0s2xrim3oudll  lnci tfarrm(ro;u0opeoii3ilsfa raumsnt0 rtrif oadfpDrai il()texr(m iy1ope  fvi t) rum(r ou0olx  ieiatlaDraumont0teeoxoctytfpD  i i;t0texrxo3iu1lm elnvslt  rrrxmooo1altn oetys sDrmuvp t0 eerxfcoydfat  uvi t0 exo(o no4ame lfvsa( s2ur(mooo0tpt io3ilsla ea(vo;(0 lerir3oatlpD ai sl(0t2uoxopny1ame lfcsls)aDrrur no0olxoiieiyslm2rlumpn(4tlxnmrciotfmtrlivi t)trtoirpoo1op emfci s arraxmoou4oetnii3tls m2rmumo () lenxocia1lpt  uvi;t seto(m iu4ole lneias)aruau  no1oex iieiltls2umums;t4artnmr todopD  neol()s2um(m3iy1olen ivt tfaDtmxmont1oeeo ieiydlmDulu pnu)altoxr3oodfpDeai i;s)sexriopnodlm   ncslt) 2raxm oo1aleo i3ildfm rmnmo;t) rtoxr tydlm  lnvi;t s2xoir3nu4ap n fvi sfsDua(  ;u4alt  ociltfa2elnmp t0altoxr3todopDe n o;s0 rtmxr3ou1ope liei (fa2trxr oo4oleo fctat sDea( snt0 rerifciotlaDr ivsls t2tmxopoo1ale  net tfsDumx ooo0tpxoio3tyd m eau p;(0trtnxr3oatfp rlnvilt)s2xrxr3nodllt mfei tf Dua(rpno1ale mfciatlaDrlnmsn(4 rtnmf3oodoateanvo;(0teto(o ou4ame mneils)arumur nt1tpenmfciadfsDulnvo (0tetrmociydoa eauvi;(0srxriopiudlme lfvi t)s2rm(ro;t0ope mietad aDra( p t) rtrio ootopDe ivols  etmir ou4al  mfei sf Dta(m ;o0alenio3iyt m ra( o;t4tetrmo iydlaD anei ()sexmxr3ny4lp  lnes t)sruax  ou4oleomfetlt m ra(mp u4arenxo oadlptelivsl( tetoir3io1ap   ivt () 2ur( pno1oleniiciytfmDeaums;u0 rerxr3iydfp r nes ( teurxr iy4oleelfcilt srrr(mp;o0opxn i3ias a umu pn(4texomr iadfa  anesls texo(rpno1ale mfvta(f 2um(mpnu1opeomieiydfmDra( on(4tltomo oytlmDeaieilt  exoxo ny1ale lnei t a2rr(ront4tpt  oeiltfs2ranmo u)aeeomf oo1fpDeauvols srxrir ou1lme lfvta(  rur(mp;u1optnmietys m2ulnmo u4trermfciadlmteln o;t0 euo(r iydomtnmnvsa()s2rrx p;o1alxo ociytfs ulnmont0tetomr tydfm  luvi;()trxo(m3iy1lpen nvil()a2tru pot1aex io3ilt a2eluvo (4tetrif3iatlmDrlues;s t2to(m3iu4aptemfvs s  rtrurp;o0ope  icilsfs emn o t) ltrmo oytlaDelivo;(0 exoxm no1ol emiviat)srtrxmonu4tlxn oeiyslm eln snu0tetrmocoydfat  nes;t  rurir io4omt mncta(fsrurur nt4olx ii3iad sDel( p;(0aleomociotlpDrluvs t  2xrxm3oodlpt  feilt aDraumonu4tlenifcilt a2rmuvs t)trtnmoctodfp elueo (0trxmxo3oydlme  fcias) 2tmu oou1ape ioeiydfa2um( p;t)altnmrciy1fptelu o;( srurir io4llenlnct tf 2raxr ;o1aex mfeild s2rl(msnu4 etoxr3ty1lmt ln i t texoimpoodopt lncsl(f Duaumpno1tpxomi3iytls umn s u)tetnxr3iatlaD ai s;( sruoir no1lmenmfcsl()aDraurono0olxoiieiydlm elumo;t0artnxo tatlat  ies ( s2uoir oo1llt  fvi sfsrurxro;o0altoiictytls rln o ()tlermo3oo1op r n il() 2tmxr nu4oleelnvtlsfaDum(mono4ale if3ild mDel(vsnt)tltoxo3ta1omD lneo;s  2toxmpoudam  lncs s s2uau  oo0alen feiasfs elu pnt4 rtnxfctydfateanvs;t0 2tmir oudom   iesas  rta(mooo0apeoii3iyd a2emnvo;u4 rtnxocio1optran slt0t2to(m3oy1omeelfctltfsDumx  oo0optomfctydls2emn snu4alxnxf3oa1fp elu s;s0tetmxr3io4apen nvt s)sDta( p;t4texo ociltfs2ran p (4artoioctotfpD aivi;t  rtrio3nu4lmen netlt  2raur oo0tptniicils s2umnvp;t0arxoxf iotla rli s;s0 exoimpoudalt mnciasfa2uaxmonu1altn f3iadfs umuvs;u4artrxr ta1omtrlies;s0setoir oo4ll  lfctls aDtmxmo;t4ole ifctltfsDuan s t4 renmfcoy1fate ieo;()sexr(opoy1amteliesa(  Durxroot0oetnif3iltfmDumuvs;u4alxrmf oadoaDraneo (  rxo(o3oydaptnmfvs t  Dta(m oo1alt  i3iat s2uln o;(0trenxf3oatoa r nvo;()setrxmpoo4lpee fvtas)sDurx  ;u4tleomo3iydla rmnmsnu4 rtoif oatlateli o s s2xmxopiu1apt mfct ()s2rm(m ;o0tlx  icildlmDrlu o u)aeerif oodop elivi ( srxm(mpou4opeemfvtl( a2rau  ;o0tpx  fcils a2rmn ont)alxnmr3tydomD aivsl(  rur(m io4optelncslt  rrrxr ou1alen f3iydfm2ulnms;u)aetnif oydoatr ivo s s2urxm3nudolenlicia()a2urxmpot0opx ifciltls2rlnvs u0alxrmr3oo1omD lneols)teumxrpio4omt  neslt sDuaumo;u4tpxnii3ildlm2ua(mp t0artoifcoydfmDe ivi s  2xmxr ny1omtemnetat a2ur(ront1apen ociasfaDul( p t)aetrxrciodlmD auei;()sexrxmpno1omenlnvia() 2tru p;o0ole iociltfm2eluvpnu0texoxrctadlaDeai i t seur(o3nudam nmnci (f Dtrurono0olxo ieiyslm uau p t)texomo iotfptr nei;()seumxo ny1am e ivt (  rtm( oou1ale moeiad s ua(mo u4alxnifciadlmt anvils s2trio3oodlleemfcslsfsrtax  ;o0oetn ieiys m eauvsn(0 lxomrctadfa raieolt)tetrxr3iodopt mivsa() Drmxrpnt0oexn fciyd sDuaumpnt0altrmo3oytoatr ieils0t2umxr3nydllt mnvsl( arrm( pnt4oleoioctad s umuvs t)tlxnxrctatom   u s s srumxo3oodamt mfct () Dua(m no1aex  fctaslm emu snt)arxomo oo1lp ranvs t) 2trxr3nu1amtn ivslsf Dtr(  nu4alxomieiat m2uaumont0teenmo iadlm  lneil(  etoxm oo1alen fvilt)s2rm(monu4alt  feildlm uluvpnu0 exrmo iotoaDe n s t0trtmio3iudllen ivt tfsrtmxr nu4tpxnif3tyslsDrln on(0tetnmo ta1fa e n slt0trum(r3ou1ale lneta(  rur(  nu4apxnmfciyslm2eaump u)tlxnmf io1fptrauvs s)srum(r3oy4amen fvi ( a2trxronu0tpx  oeiasfaDrm( p (0tetnmr3oy1fmD  uvs;t0 rtrio oo4lptnlivt () rurxroou0aexnmfctys a2rl(vpnu0teenioctadlaD  i i;(0t2xmxopnydaltemfet tfaDtrxm ;u4oltniictatfsDulnmp;t4aeenxo oytlaDrlivo;t0sruoimpnodom n ici (fsrtru  ;u0tlenmfeiyd m umn p (4 lxrxf3totlpDr nvslt)s2xmxr oo4op n fci tfa2umur no4alt iociys s2uanmonu0trtomfcta1fa eluvils)t2trir iy1lp  mncilt) Dumu pnt0tlxnmfctyslm2eaump;t0aetoifcoy1lpD auvo;t) 2xrxr3ny1olen iesl() Drm(mpno1aee mf3iyt m rl(vo;(4arerxrcoadfmtr n olt0seum(rpny1lptemivtatf Dururpoo4alx iictltfm ranvp;t0 etnmf3oydlp eaies t sexrio no4ll nliciasf Draur oo4tpt if3tad m2umu snu)aexrxf3tytfa r nvils)tetmxmpiu1ll  mfctl(f rtm(rpot1oltoif3tld mDeau s;u0 reoircoodoat  uvs;( t2tm(o3nudapt lict s sDurum ;u0tlxoiicilsls eanvs;u0altrmo3oadopt  nvo t)texmir3ny1aptelfciat)arraxronu0oex if3tat aDulumo u0tetrxr iotlatrliei (  2toim oy4oltnmici s  rua(r nu0tleo oetlt a em(vp t0aexrifciy1la   ueslt texmiopio1amen ncia(  Dtaurooo1tpxn f3tat s2ea(mo;u0tltrmrctodlate nei;( trxo(m oy4omtn fcs (fs2tr( p;o0alxo o3ildfs um( s t0tleoir3tydlm e uvo ( sruoxo3oudol  mnctls) Durur oo0altoio3tltfmDeauvp u)arxrxfcoa1opt  nesl(0trtrxrpnodlm  lics t srtr(  nt1tleomfctltfm2umn onu4artrio3oatfmt  ivi t)texm(rpnudome mivtltfsDraum ;t1teeo o3iys s2rlnvp;(4aexrxo3oadlpDr ivslt)srur(o nudal   icias) rrm(rp;t0ale mf3iatfmDrau p;t) rxrxo oadfatrlnei t0teuoirpoydomen fcil(farrru  no1tee if3iys m2eaumo (0trerxf3oa1lptrlnvilt srxmxm io1openmneta( sDuru o;o0altn o3iadfs2rlnvp t) rerif tydlm e iesl(0 rum(rpou4ome  fesatfa2rax pno0texo octytlsDrl(mo t) eermrcoadoaDe i slt) rtrxrpoo1amtn fcsls s2trxmo;o1tee ifeiytfm eaums;u)artrxocootoatrli s;s)srur(rpoo1alt miei s s2urur ot0apxnmf3tyt aDul(vp u)alxnmo tadfp r ivo;t0t2xoio3nu4apen nvsltf 2tr(roou4opx  ociyd aDumu o;t)aetrmr oydfm r ivs () 2tmim3ny1ll elivs s)s2rr( pno4oee mi3iytfs eaumpnt)aeeriociodoa e ivi t s2xmimpoy4ape mncs ()srrmum oo0opeo fctysfsDem(mpn(4tltrifctodoptraiesl()s2umir oy4om e ncias)arurxm ot0tlto fcildlmDrl(vo (4 rtrmrcoydlpt luvo t  ruoimpiodlpeelicias) 2rmxmpnu1optoioetas s2eanmpn(0alxoir ty1faD  nesls srxmir oy1optnmfcsa(fa2umumpoo1tex ii3tadlsDra(mo (4 eerxo3iadopt  uesls)sexmxr nu1op nmfcsls) 2ta(mooo0alxomfciytfa2elums;u4 eerxr tydfaDraues t0 2urir3iy1oltelfet s  rrr(m oo1ape  feiltla2eauvp t4 lxoir iodlaD an s;s0srurxrpnu4lm   icsa(f 2uax  ;o1tleomf3tyslaDelnvp u4 exomrctadfmtean ilt srurir ny1amenlfcsls)sDurxmpot4tet  oeiysfm2rmnvo u4alermf ootlp e u i;t)sexm(o oo4lp   netasfs2trur ;o4aetomi3iasfaDulnmp u0trenmrcoytla  livilt trxrxr iy1amen fvsas)sDuau  ot0oexoifctydls uauvsnt4texnmo oatfaD  nvo s srurxr iy1op emnct t  rrrumono4teeomi3ilsla um(ms;(4 exrio3iadlmDeaiei t0teuo(r oo4lleelfet (faDrmxr ;o4tpt ifctytlsDel( o u)tlermfcoa1faDe uvilt)srtoxo iy4ame  nvslt  2uaurpnu0tet moeiadfs rauvo u0 rtrif oo1fa raivs;t s2to(o3oydomt mnciatfaDta(mpnt1aeto oetldls eanmont) etrmfcootlatelivo;t0t2xoxrpio1apen fvta()a2ta(ronu1oleoioctaslmDean s;t4tltomr tatoptranvs (0s2toir3iu1lpeemnvil( srtr(  nu1aexoifctls m2elnvpnu4texnirciotlaDr uvsls  exrio3no1lltnlncsls aDtm(mo;u1oltomoctlsls rmu onu4 ltomo3oa1omDranvil() rxmxopoudalenlncs sfs2urxrpoo4opxomociat a eanvo;(4aetnxocio1lp rln sls) rxoxm io1lpenlfcsls  rumxrpoo0oet mocilslmDra(vo (4 eeoxf totfateanvo (0 rtmxo nu1omtelivsat sDrrur ;u1oetnmo3iltlsDemu s;t0areoiociadoa rluei ()setoim3no1op n ivt t)a2rm(  nu1apeoifetatlm eaumo t0 rerxrctatlat  uei s s2toio3ou4lpe lnctasfaDuaurp;t1tlx mociyt sDrauvs;()tltnmf tadoate i s;s)sexoim3iy1lptnlneils)s2rr(  no4oet  feiaslm ranmpnu)arerif3totfpt aueo t0trxrir3nudap emncilsf rurx  ;o1tleomi3tatla ranmsnu0 lxoxf oo1fa   i o t0 rur(mpnudllt mfcils s2rau pnt4apt  oeias m2emn o;u) exrxocio1opteaieo () etmir oodol elfetat  rtm(m ;u1altomo3tyt m2umnms;t4aexomociatfaDeluei;t0t2uoirpny1olenlivtlsf Duaum ;t1aexniictlsls2em(mpnu0 rerio oatom  luvols t2uoim iudoltnmnvsltfaDtmu p;o1tpxoif3iadla2emnvsnu4tlxrmr iatomte u s s)texmxo3ou1al elieil(f Dumx onu0tleo oeiyslsDul( s;t4trenmr todomDr u olt s2uoxm3no4lpte ici s  rtmxro;o4texniieiatlmDelnms;u) lxoxf3tadfa eliei;t s2xm(mpnu1ap e iesltf 2ta(m oo1tleoio3iytfs emuvo;(0tlxnxf3oy1fpDeluvolt)s2toxopoy1lmenlnet s)s2tauront1aex moctadlmDean o;t) etrxf3tatoaDe ies;s  2xo(r oydame liesls)artmxr ;o0alxn icilsls rl(vs;t4trtnir iatlatrli sls) 2xoxo ny4omtelieiat  rur(rpou1alxo f3ilsfmDumuvo;t)texrmr oodoa  an i s0 ruoxmpnu1lme  ivtatf rraxrp;t0aeen ociadfs eau sn() lxrmocoo1oa  aueo t0teumim io4lpte nci t sDtm(  oo0olx mieiatla2uauvs;(4altoxo3oadfpD auvi s0 ruoxrpnu4lltnmnvilsfarumuro;u4tlxomfciltfs ul( sn()trtnmr iatopt  i i (0sexm(opny4llt lfes sf 2ur(m nu1oltniiciad sDrlu o u4tetrxrcio1fate nvs;( sruoim3iudop  lneils)srrmx ooo1tpx mfeiatfs2rmn snu0aeerxr oytla  lneils)trtoxr oo1llee neia(fsruru poo0ale  ociytlsDumump;u4tlxnif3oadomtraiei (0teuo(opno1om  lfvilt  2rr( o;o1aexomo3ildlaDrmumsnu) ltoxrcoytop ean il(0t2xoxm nudll n nvils)aDrm(rono4oeto fcilsfa ra(vo t4tlxnmf3oo1omDelu s;t t2um(mpnodop  mneslt)a2ta( o;u1oex if3tadfm eanvont4trtrmf io1latraivils)srtmir3nydlmtn nvsas)aDtaxrp;t4oeenmfctyslmDra(mo u0 ltrxf todop rlnvs (0s2uo(m ou4am nmicil(fsrurumont4apx ifeiyt s2emu o t0altnxo iatomDr ues;t  rxmim3ou4op nmiesl()sDuaurp;t0aptn fetltfs2eanvs;t)tetoirciytfp  liei ()tetrxopiodlpee ivs t srtax  oo0tetomfcilsfs2ua(vp () etoxo oy1fpDrluei;t0 euoxrpnu1lltelnvtat)a2trxrpot0tpeomfeilslm em(vs (4treomrcto1fptrlues s0 2xo(o3oodolenliet tfsrtmu p;o1aexomoeiltfa2um(vsn(4tlxnif oo1fpt auei t)seurxopio1olt lfesa( a2tr(mp;u1apen iciytlmDuan o;(4trtoio ia1opDeli s (0texr(o ou4om n nvtat  2taumo;o4tle  fciasfmDemuvpn(0 ltomr3ty1fmD auei;( trumio3ou1ape mnctlt s2raxmoou0olt ioeiys m uaumo;t)trxoir3tytomtr nei;t)trurim3iodll nlncs s a2umxmp;o0tpx mf3tlsfaDrm(vo (0 lxrxrcoatfmDrau s;s  2xrxm3oo1ll e ics sfarumxm oo1tex  oeilslm2uluvo;t0altrmr3oo1om rau o;s0t2uoimpoodapt mnct ( aDuru onu0optoio3tysls2emums t0altrmf3oodfat lies (0srxm(rpou1lm emfet sfsDrrumo;o0ale moetytfs elump (0alxoir ta1opD lieol(0t2xr(o no4om emnvt t  rurur nu1tptoioetldlmDumnvonu4 ltnxfcto1faDeanvs ()srxmim3nu1llte fetas s2uaxmo;u4ope mi3tlsfs2emnvo (4teenmfcoo1omD  u s;s texoim oudlmee nvtlt aDraxmp;t4oetnmfetydlm ea(monu) ltnio3oy1oatranesl()srtr(rpoodlp  micsl()aruaxmpnu1oex ii3ildls2ea(ms;t) leoxr ta1lmte uvils  2to(o ny4op emfesls aDrrxmoot4altoiociadlmDua(mpnu0tlerxr ta1faDelieolt  2xr(mpiydlleelics s arum( oou1apto i3iasfs rlumsnt)trxnmo iatlpt  ivi t)srxoim3nu1apt  net tfaDra(rp;o4aleoiiciasfs em(vp;t4 etrmo3iodop   n il()s2uoimpoo1omeemivt s) rtmu  nt0tlxomfciatfs umnms;u)alxrxf iy1faDraneolt0setmio3ny4ol  licslt srtr(ro;u0optomiciyslsDrlnvpnu0treoxr oatfa rlnvslt)srxmim ny4op nmnvi tfaruau  ot1tetn fcias m2uluvs;t)tleoif oodfa eanes (0seurim3iudamen ies s)aDuax pno4olt mf3tyslmDemuvo;u4aeenxrciotfaDr u i;(0 rxmxo3iu1ope  ieias srua(rp;o1apxnmfctlsfa2rm(ms (4arenxfctydlp r n s;s0trxrio3ny4al  mnet sfsDrmxrooo1oee mictat m2emnmo (4arxrxocoadomteauvs t  rtmimpnydap e fciatf 2uaumoou1tpt ii3ilsls ra(vs u4 rxnmf iytomt ln il(0seuo(mpoo1am  mfciatf rrr( onu1oee iictlslaDranvonu0 reoxf todfptelieo;s0teuo(m io4am n iesls aDumu p;u1tpt mf3ilsfm ea( pnu)tetrmrcta1lpt aivsl()tetrxrpoo1apeelnctlt)s2urxrp;t0tex  i3iyt sDrlump;u4tlxrxr ootla  aues;t sexrir oo1lpenlnesls)aDurum ou4olxo ictasfs ea(mo (0 ltomrctadfateaueils sexoimpou1apenlictl()sDrau  oo0opx if3ildfs2rmn o u) lxrmociatopteln s s) rxr(m oy4lmen fcsat)artmu o;u0tee  f3iyd s uanvon(0alxomrcia1op eau i;s srumio oy4lmt  nesls)s2ua(mp;o1altnmieiydlm ua(vo u0tlermf oatlaDe ivo (  rtmxr3iodapeemnetlt sDurx ont1opxnmietat m eanvsn() exrmocoatom  luvsls0t2xmxopiydomeelfei ()sDtaxrpno0aeeo octas a2um(ms;u0 rxomf3oadfa elnvols0s2xrim3iy1ap emfcil(  Dtmu pnt0altomfeiatfs2eau ont)texnmoctydfaDeln i;s) rxr(r iudlp   nviat sDtm(  ot1ale ioeilt m2elums u) renxo tadom r neol(  rur(r oudope  fvi ()srrau pno0tlt mo3tltfmDel(vs;(0texoxr3ootfm e i s t0setrxopoo4ape mnetatfsDua( onu0olenmoeias m eanvs t)aexnmo3oadlmDeli s;t0 2xm(mpny1lmeelivt ( artm(  no0open feiydfs umnvsnu4aetoir3iatfatrlieils) euo(mpoo4omeelivt (fa2trxmpnu1teen o3iytfs rmnvs u0artniocoadom e nvi;t0 rxmxopoydllt lfcils  Dtr(mpnt4oexnif3ilt m ea(mo (4 eeoio iadfmt  ivolt0 rxrir3ou4lme lnvsl()srumx pou0ale  ictydlm emn p;()trenxrcoa1fpDrau s t)t2uoirpnu1openlfeta(  rum( onu1tpe  fetltlaDrmu sn(0tetoio to1lptelnvil(0setmxmpoy4amtnlfvtatfsrta(moot0oleo oetas aDul(vp;t)tltnxfctytlpteln o;s)trurir oodlmt lncsl(f Draxroou0aeto ociydlm ua( snt4altrxfcoytlmtraies () rxoim nydal  mfvt s arrmumpnu1tltnmiciatlsDrluvs u0tetomf3iadoatr n o t) 2tm(m3io1lltemics ()s2trx  nu0ape if3tlt s2eln o t4altoio3oodomDranvolt0trurxr iy4ol  mivslt)srumx pnt0aet  i3tldfsDulnmp;u0teeoxocoo1lptelnvs t) euoir oudlmt lfvils)aDrmu ono1altn o3tatlm2ran p;u0 leriocoo1om eai i s0 etmxmpiudom nmfcta(f ruaumo;o1apt  iciadfsDel( snu)tlxrxo3oydopD ln s t)setmxm3no1ll nmfct t) Drmxmooo0ape iietydfm2ul(mo t)trenxf todomt luvs;s seuo(m ny4aptelnesatf Dumx p;t0tlt ioeiaslm2rlu sn()trxrxrcoy1la eauvslt  exo(r nodlpe mnvias  rra( oot1oex  fctysfm2ra(vsn(4texrmr oadfa  lneo;t)t2urxrpio4ome mivslt  rtau p;u4aeenmfctad mDumnvp;()arxnxr3oa1oate ues s) rxr(r iu1om elnvsasfaDrm( oou0optomfciaslm ul(vo u)areniocoy1lmDrlnes;(  exoxo iy1opee ncta( sDra(  ;t1tlt moetyt a rmu ont0trtnifciy1lptr n o;t texoxo3iudoptelnvt sf rtaur ;o4teen feiadlaDumn o;u)aeermo oatfpD anvi;t)trur(r nydap e nctl() 2rrum ot4tpe iiciyt sDulnmp t)trermrcoa1op eanvo s0trumxm3iydomenmfetlt sDuaxro;u0apeomieiyt a2rl(vp;t0trxnxrctatlat  uei;s0s2xoxo3oy4op   fei sfarraum ot4tltn oetld a2rmnmp;t0 exnxf oadfm   u i;s trxr(m nu4ape  fvtas) 2taurpnu1texo octasla rluvpn(0tleoxfciotlmDr nvs;()trurirpiodalenmfes t  2tm( pnu4tleo ociatlaDeauvs;()tlxoirciydfaD lueils)sexmxo3nodoptnmiesat s2rm(r ;t4ape moctltls2um( o;u) renif3to1lp  au s;s)s2toim3oudlmeelnvs s arta(r ;u4oex iicils a umumo u4 rerio iadlmt aneo;t0trxoir nu1ll  mivtlt sDrrx ono4oltomi3iysls2emn snt) exnxf iotla elneol()trxm(mpnu4om elncsl(fs2ur(ro;o0aex mictldlsDua(mo u) etnir3ia1lp rauvslt0srxrimpou4ap n ncsa(  rumurp;u0ape  oeiyd a em( s u4artomfctodfa  ln o;( s2urio nudol nmfcs t)a2rrx oou0aeeoiieiytfs rmu p u0tetoxr3totomD  uvil( truo(r nudlmtnmnvsls) 2ua(  no0oeeoioetltfs2uln o;u4 etoioctodfm rau s ()sexoxm no4ome  ieslt) rtrx p;o0alenifciaslaDranms;t0altomf totfm   n ils0 2tmiopnodol   ietlt s2tmurp;t0tetnmf3ild m2elump;u)alenxrcoa1fm elneol(0 2xrxm3oo1op nlfeiat s2umxrooo0tpxnmociytla ran snt0tlxomfciatomteai o t0 exrxmpnu1optn ivsatf Duaxm nt4tlt ifeiytfm elumont4tltnmr3iytfmDr neol( s2tr(r3oo4omeemfctls aDtm(mpou1aptnif3ildfsDuluvonu)trtrxo3oatopDr n o t  2um(m ou1op nlicslt a2rax  no1optnmfetldfa2ul( p;t)aexomr3todfmteln il( seumxmpoudop   fcsltfarraur ;o0apt mf3tadfs2uau o;u4 eenxo todfm eauvi;(0t2xrxr3nudlmenmncia(farrr(mpoo1tlxnmictls m ua( snt)teerxf tydoa  lieo s0texrir3ou4al n feias  Dtau p;t1altnmoetltfm um(mp;u4 rxoxf oytomt lnes;()seum(r ou1lltemfvil(  2uax ooo4alx iiciydfsDrm( snu) rxrmf oodfpD  neil( trxm(o nydalt mnetlt) 2rmu pou1tltnmictat s2uauvs;u0 lxrmf3io1lmDr ivo (0trxrxr no1lp nmivtls)arraurp;t1teen f3iatfs2rmnvo u4teermf3oytlat lu s;(0trumxr3ou1opee ict t)srraxm ;t1teen ictltfaDra(vont0aleoxr3oa1fpDelnes;(0 rtmxrpnydol nlncs s)srrmumpot0tle mietls m2uluvs;t)areoxo ta1laDraieo s  2xm(m3nu4lmenmnvtatfsDtaur ou4tptomoetasfa2ulnmo;() ltnmo3ia1oaDrlivi ( t2xoxm3iy1alenlfet t  rta(mo;u4tleomf3tatlm2rmuvo t4trtrif3iadomtranvs;t)sexmirpnudop nlfctlt)aDrr( p;u4teeo oeiysla2uan o u4aeeoxo3iatfaDrlu s s0 rtoxrpnydopenmnes tfsrrmump;u0openmoctysla emums;t0aexoxr3iydlp  lnvi s0s2uoim3nudol  mfcs t)arrm(moou0tpxo ictad m uln p t0tltrxf3oadfm  auvs ( s2xrim3iodopte netlsf rtax  no4olen feiytlm2rl(vpn()trxoiociy1lpt  n o;() rxrim3oy1alteliet t)a2uaxr nt0tlx iieiadfmDra(vs u4arenmo iodlp  au o t0 ruoxmpiodlme lfcs (fs2tax p;u0opx ii3tyd s2uaump;u)aexoxoctydoaD li o;(0s2tmio nydlm e icsa() rrmxmoot0texo i3tls a2em( s;()trtrmo3tytfmtrln i s0t2xr(r iodam n fetat)s2trxr ;u0optnmfeiyslsDrmnmont)teeoxf3iotfmD  u s s0 rumxr3io4llt lnviltf 2rmu ono1tlxnifctlt aDea(mpnt4 exrmf oydomte ueilt0 euo(o3no4olt mfeslsfsrtrxr oo0aetnmo3ilslsDrauvs u4aeeoiocoo1omD li o;s)teto(o3iy4oleemfcia() rtm(roou4alen octaslm2ulu p t0 lxnmr iadlaDrluvi;(  2tr(m3iy1omtemnvtlsfartr(mpnu1tpx mietldfsDrluvon(0aexoxr3oadopt auei;t0s2xmxr3oy4lpt  fetatf Dtaxmooo0opt ii3iad m el(mpnt4 leoir3ia1lat  nvi;(0 rtrxm3oydlmtnmnvt sfsDuau onu0tpxomfeiytfs eluvs;u4tlenmoctodfp raueolt srtmir3iy4omtn fct ( s2umu o;u0oeeo i3tyslsDrl( pnt0altomr3to1lp rauei;s) 2xoxm nu4amen ivsl()arrrx poo4oetnmfeias a2elnms;u)teermr3tatom eanvsl(0 rtmim3iudlme lnvi t a2tmxmp;t4ope  ictydfs uanvs (0 exoir ia1fa eanei;t  exmimpiudlpte fesls)sDrrump;u1texomfciyslm2ranmp t0artrio3iatoatr nvi;s) 2xrxo3no4oleemnct t s2umu p;t1olxomi3tltfs2rmnvo ()alerir tadoateluvols)texm(m io4ll nmfvil() rumx pnu0alt ifeiyt m ra(mpn(0 exoxr iatfp   ies s)srtrxm3oo1omeelicils)srurxrp;u4tpt iieiydls2rmnvsnu4alxoxo tydomD luvi;t0srxrim3nu1apt mnciat a2tau  no1tle  ieilsfaDrlnmp;t0altomr tydfptrai o;t0 rxrim3iu4ll n fvs t)arraxroot1oleo o3ias mDulu s u0altoirciatfpDr i ol()trxrxm iudol nlnetatf rrrump;o4optoioetadlm2ra(von(4trxrmo iodfatrlu s;t  2urimpnodapt lnvias sDtru oot1tee iociydls eanmo;()trtrif3iatfatrauei s)t2tmxr3nu4omt  fct ()aDurumont4tptnmictlt sDrluvsnu4aleoir to1fptr n sl(0sexrxr3ou1aptnlnet ()arraum ;u1oetomi3iyt a2el(vsn() eeoxf3ootopt auvo s)trtr(r3iu1om n nci t)artrum ou0tlxo ociltlm2ranvpn(4 rxomf ia1om e uvi;t texrir3nudomt mfei (fsrtaurooo1oeeoiociytfsDemuvp;(4 etomo oytom eaues;s0 2trxm iu4amenmnci sfsrrmxrooo4aexn oeiltla2ea(mpn()aleomo ta1lp   u i;s0tetr(r3iodomeelicta(faDtr(mo;u1oleoif3iyt a rmu o;u0altoir3tydomt  ivs;( t2xr(r3oudlltemnesl(f 2tru oou4tex  o3iys s umnmpnt4trxrmf io1latraneolt s2xmiopnu1ape  icslsf rrmurpnt4aee  feiasfaDem(vo u) etoxr3iytfatraueo;s)srxmio3ny1olt  fvs (fsDtau  nu1aeen feiyt aDelnvo;()aeeomo3iy1om rlu i;t0 2tr(o iodape  nci sfaDrrxmpoo0alxnifciadls2ul(mp (4 eenxo3to1fptrlues t srurir3no1ap  mivs t  2rm(  ;o0oeeomfeiad m2ulnvo;t)tltnmf tadlatelueslt0trurirpou4lmenlnesatfaDtmu pnt1tlt  ieiys a eanvo (4 lxnirctytlpte n i s)sexrxm3nydlm nmies s)srtru p;u1tltnioeiytls rmumo;t)aleoif oa1oatran s s)s2xmio3iu1opt miet t a2ra( ooo4oee ifcils a umump;(0aetnxoctydfpD lies (0t2urim3io4ap   fcias  rrmxr ;t0tpe  i3ilt sDrmu o (0 rermf3totfmtrli i;s) 2urxm3nodaleelfvs tfaruaum nu0tpx ifctlsfs ul(ms;u) rerxr oydoat  uvo t0trurir3ou4am nlnctl(f 2rm(rp;u0opxoif3tydlaDemn sn()trxnir3oatlmtrluei t)truoxm3iu1olenmnvsa()aDtmu oot0tpxn i3ilt s ulu o t4arxnmo3tytlmD aneils seurim oy1ll nmiesa( srurxroou4tltnmfciyd sDul(mo;u)trenirciotoaDr nei t)t2ur(r3nu4al  lfctl() Dururoou1olxnmfeiydfa ua( pnu)texomfciatlmtelueils)t2urimpiydap emncsa() 2raxm ot1tpxn i3iydfa2uauvs t0tlenmf ia1fpD luvi s  rtmir3io4amt lieslsfarrauront0apxnii3iytla umnmp u0 lenxociytlatrai o;s0t2umxm iy4lp e fctl(fa2urxro;o0tpxo o3iydfa2elu p (4trtnxr ta1lmteln slt0srurxopoudom  mfvil(f Duaurp;t1openmo3iytls ulnmonu0 rerifciadoa  aieo;t)teuoirpoydop elivsl(fa2uaumo;t4tee  fctytla ua( s;u) exoxocoydfm   uei t)s2trxo iu1open fci s) Dtr(m nt1tltn fciad mDumn p t4alxomr3tydom  lneo t)s2xmim oodaltnlfeiatf rur( ono0tex  o3tatfm rluvs;()arerxf3oatfptr i o (  eto(r3nydlp nlfes (  Durumooo1tltn ietydla um(mo;(0 etnxf iodfaDr ivi;t0srtm(o3nu1lltnmics sf rrm( ono0optn oetydla2em( s;u0tetrxocto1om eaieil()sexmirpou1ap emfcta( a2tru ono4teto f3iadfa2ean p u0areomo3todfm elnvo () rxo(r3iodamtemiesa(f Drr(mo;o0tpx mf3iyt mDeln s u4texrxr3ty1lmte u o;s) rtmxr3ou4olte fct sf rra(roou1tpxniociadlsDulnvs;u4teenmr3to1om rlnvi s0sexrxrpoudalenmicslt)aDtm( ont0ape  icils s umuvsnt4 lxomf ootlpt aiesl() etrio3ny1apt lfct s sDrmxroou1tpe ii3tldfmDran onu) rerio3oytlpD  uvs t)s2toim3ou1ope  fesl( sDtm(rpot0oltomfctasfm rl(vsnt) etoxo oy1om   nesl()srtr(mpio1ol e icta()srtmx  ;t1aet  oetys sDumuvonu0aeenxr tydfatr ueo;s  2tmio oy4lp   nvsl( s2umx  oo4tlenmi3iltla ulump u4 rermociy1lp eanvi;(0 rtrir3no1ll elfvi s a2umxro;t1ope moeiatfmDemu p (4 rerxo tatoaDelneils) rumxmpiodame  fvtas  2ur(rp;o1aetn f3iydlaDul(vpn()teeoiocootlaDeaivo s)teuoirpno1altemnvil(fs2tauroou1apto f3tysfm2uluvp (0tlxomf tatfmtr ivilt)srtm(m ny4lptnlnvs t)a2uaxmpnt0opxnmf3ilsfs2rmnvp (0trxomr3iy1fmD lnvi ()srxmim iu4lpt  fctlt sDurx pnu1texoiocilsla umumsn(4trxrmr oy1opt auvol( tetoxr iu1ap n feiltfarurxmpnu4altn f3iad s2ulnvsnt4tlerxrcoy1lp rlnvo () etrim io4altnlfvi (  rrrxm ;o1aexomi3tltlsDrlnmonu0 lxrmf3tytlp eaneil(0 eurxopou1omenlnesatf 2ua(  ;t0aeeomoetltfaDrmumsnu) rxrmf3oydopDrlneilt)teumxo oydlp elnvias a2umxront0opx io3tadlmDrl(mo u0arxrircoatlmDraues t setrimpoo4ope lfvilt aDuru pot1tpxn fctydla uan p (4trxrxo3oodfm  lnei (  rum(rpiu1apen iesat)s2taxr ot1tpeniieiasfs2rmnvpnu4aeeoxo to1lpD  u s;s)trto(m3ny1lp  lfvsa(faDtrxr ;o0tlxoiieildlaDrmumo;t0tltrxr3oodoa  auvs;( t2urxrpou4om e ncsatfa2tr(m ;t1aeeo i3tyd m rauvont)aetomr3tydfat luei;t texrxo3oydllt lncia( sDuru  nt4apto ociatfm el(vp;t)arxrxo iadfp e uvs (0 rxrxm3iydolenlfctas artau ont1tlxomi3tld m ul(ms;()tetrmo3iatopD  nvsls s2umirpny4lpeelfvs s s2rr(m no1tlxn fctadlm2ran o u0arenxfcoytfptrln ils sexoxmpiudap n ivtlt)sruaxmp;o4oex mi3iaslmDelnvpnt0 exomr oodlpte i o (0sruoxr no1ll  mncilsfarurump;t1tlto ieild mDuan pnt0 rtnio3ty1omD  i s (0seuoxo nu1ame mict ( aDta(r ;t4teeo i3iatfaDeaump;t)tlxrxf ia1fmDrauvs (  rto(o no4ll e fvtls  Dtr( pou0tle mo3iytfa2elu ont)trenmf3iotfpteauvo t)tetmxopoo4lmte ietlt) rur(mp;o1tlx ifciydfm2ea(mo u4 reoirciydom elivs t  rumxm3iy1opee netls sDrmump;o4tpeo octysfm2rlu p;()tlxrxrcoadopDrlnvs (  rxoxo ny1lltelncs s  2ra( o;t4tlx  i3iatls ran o t4tltnmf oodlmtran s;() exoirpiydomenmnetls artm(rpot4aleomieilsfs2ranmp (4 ltoxrcoy1opt auesl(  2ur(o3no4lptemnci (  2rrxmo;t0opx mfcils s ean p t0 reriocoa1om r iei s0s2trxmpnodlmte feta( a2trxrp;t4teeoiieiysfaDrl( sn(0alerif io1oatelnvi t)seto(r iodlmt mfctlt) rtmumpno1aee mfciltlm rmn pnu4 lxnmf io1lp   u il()trumim nu1ameelfcslsfarrru  ;t4oet ioetysfa2rauvo (0 etnmfctydopt lieols  2uoxo3nydom   iesl( aDumxr ;u4oexnmfcils a raump u0arxnmocty1lm r i il()srxrxmpou1omt mnvsat)sDtaxmo;o0texnmi3tydla2umu p t)trerif3oydom rlu ilt srtmir iudam nmfetas  Durxmpnu4oet  i3iysls2uan o t0tlxomrciy1lateanesl(  2ur(r ny1ale livsat a2rmu p;u4tpeo iciys a uluvp;(0alermoctotfmDelnvs;t0 2xmxr ou1lp e nvsasfaDtmx poo0tlt ioetydls em(vo (4tlerir3ta1faD li o (  rxm(m3ny4lltelncta()aruaxmonu4apeo o3iyt a2ulnmo t0 rtoirciatfmDeai sls0s2xr(o3io1lm n ivia(  2raxrpnu4apx  ictlslmDrmumo;(4 exnxo oytom  auvs;t)trtoimpiy1opeeliesl(fsDraurp;o4oee moctatfa rmuvp;t0arerir3oadlp eai ils0trxo(r3oodomtnlivt tfsDumu  ot4oexnifeiydfa ulnmo;t0 ltoiocoy1fa rli sl() eum(m3iydalt miesls  2rmur ou4opeoiietld m2em(vs (4alxoxf totlat  i o;s)t2tr(opnodlmee fcil()srraxr ;t0olenmoetatfa ua(msn(4texnmf3iodlmDeluvs;t texoxopio1om  mivtat artmxr nu0opt mi3tatlm2um(vsnu0trxrxf3oatfpte i i (0s2toir3nodlleemnviatfs2urxmp;t4aeenmieiytlm ea(vo;t0altrir iydomt lueols0srurim nu1al   fci t artmxrpoo0tlxnmo3iltfa rmump u0 renxo3iodoaDe u ilt teumir3iydame mnvi s  Drm(  ot1tlxniociyslm2ea(ms;u)artnif3totlat anesl() eto(r3ny4lp nlfcsl()s2ur(mpnt4opeomfctadlmDulnmsnu)trxnxo3tadop raueolt  2tmxr no4lme  fcsa(f rtmumpot1alxn fciaslsDra(vp;t4 leoxoctotfp  lnvo s0 exrxrpnodap   ieil()arra(mpnt1tpt iiciys a2ea(vs t0 renxf ia1fmDe i i;() 2uoxo oydole lfeias  2rmurpno4aleo f3iltfsDranvsn(4arxnxf3iytlmtrlu i t0trxm(m iydap n nctas)a2rr( o;u1opx  o3iltfa2emump t) rtrirciy1lat  ies;t0s2trxm3iy4ale lfcslt  rraurp;u4tpto fcias m2emnmp (4aeeoio3tadfptrluei;s tetoxr3io4aptelnetlt) ruru oot4oee  fcild mDuanvp (0aetrio3todlmDeln ol(  2xm(mpoudlpe lnvias) rum(moot1apeoiocilt aDem(mo;u0 lenir tytop   nvi ( seuo(opiodoptn iesltfarta(rpou1oetnifeiys a ean o;()trxnxrcoydopD lnei t) euo(rpiy4am emicsa() ruaur ;t1aee  fciltfm raumsnt4alxnxocoatfmDeanvi;s0 2trio 
\ No newline at end of file
@@ -0,0 +1 @@
+nei;(0 2tr(o ny1olen fctas) Duru ono0tltnii3ildlaDel( o (0arxrirciydopDe nesls tetr(r iydllen nvta( s2tr(mpou4oetoif3ildla2em(mo t0 etoxf3oytfm  ai i t)tetr(o iydllt  fes sfaruaxro;o4open oeiyd s2umu s u4aexoxociydomt aieo;s)texo(m oydoptelnesas) Dta(r nu0oexnmfeiad s2ranmp;u0 rxoircta1omtrlu ilt  rto(r ny1op nmiei t) 2uru  ot4aetoiiciyd mDra(vpnt)arerir3oytfmD auvsl()srxrimpnodomenlnes sfarurumoou1apenmi3iysfaDeanvo u4 lermo tytla e ivi;s) ruoxopiu4lp emfvils)sDua(mooo0openif3tytla uanmp (4artoxf tydfptranvolt trxm(mpoy4apt mnet s)sDtrxmpoo1aptomf3ildlmDra( sn() exomfcoo1fmDe ies;s0 exo(r nu1lptelietlt aDra(  oo0oleniictat m uanmonu4tlenio3tadlmDeluvs ( trtrim3nydop nlfvsls  Dtr(rpnu1ale ifeiad aDeauvs;(0artnxfciotfmDeaueilt) rxo(o3iodlpt mics sf Duau  ;o0olxnii3tatlsDelnvon(4artnir3oadom elivsls0 2umxr iy4lltemneslt)s2urx oou4ape ioetat s2ran o (4arxoio3iydoatr i s;s)setriopoo4amenlfetls  Dra( p;o4apt mfciadfmDel(vs;t0 rxrmocoadfmDr ueol(0 2xr(m3nu4ome  nvsl(  rra(rooo0ape moeiaslaDra(mp;()tltomfciatfaD auvsl() rum(r3oo4opt mivta( a2rmumoou0ale  f3ilt m2eluvsnt0artnxrcio1omDelnvs;t0trurxr3no1am  mfvt t)srrrurpnu0ole mi3ilt a ul(vs;(4arxnir oatoatrluvo;(0t2tmiopno4lme  ics ()srum(r nu0alen ieiyt s2em(vp u4aeerxo iatfm eau s (0srtr(r no1op e fvsl()srrrxmpnt0apxnioeiytlaDrmnmsnt)arenio3iotlpDrlu s;s0teuo(o iy1op  lfvtat)srtmu  ou4texnioeiydfm2ea( p t4 lxoxr3iatlpDeauvo;( trumimpiy1ape  net s)artm(r nu0ole moctyslmDemu s (0texoxr oo1oatranesl( texmir nudll  mnviat)s2raxmo;t4tlxnmf3tlt sDrmuvs t4texoif3iadfm elivols) 2xmxrpou1lp n fvias srumxmo;u1apt ii3iydfsDulnmo;()aetrmocoatlmtelieilt)trtmio oy4ll elfet tf rrm(rono4aptnmi3tldlaDemn on()aexoxfcoydlm rlu o;s)srtrxmpiudopte fei t)s2urxmpno4aeenioeiydls rmu o;t4 etrxo ta1lpD an s;t)seumio3ny1amenmivtas  2raump;u1tpt  ietasls uaums;(4teeomo tatomt  uvo s0teuoxrpny1op nlivtlt)sDrmx ooo4tpxnmoeiyt m2rmnvon() lxnir3iotfmtranei;t) rtmim ny4apee nci t) rrrxmo;u1texo i3ias s uaumo t0 eerirciadlaDrlu i;s setmimpou1ome lneia(fsDta(mp;u0tpt  ocils s em( p;() rtrifctadlpt  ieilt0srxrio3oy1omt lict ()aDum( ooo0tlxoiociysfa2uau s;u4 exrmo oydopteluei;s0 2xo(o iy4apee ncslt sDrru pno1tlxn fciltfs2uanvsnt4trenxo tytlmD  nvsls)seumimpiu1lp nlnctl()sDuau p;u4alen iciysls ulu pnu0 exoif tytoatelu o ()trtrio3ny1amt lfetlt  Drm(m ;o1tlen o3ias a emnmsnu0altrmfcoa1latraivilt)trtrxopiy1ap   nei s)arra(mp;t0oet ii3ilt a2uln p t0tlxrmrciotlpD au ilt0 exmir iodolee fvtas) Draxmo;t1teeoifeildlm2uau s;t)trtoxocta1fmDe i s;t)sexoxo nodlltnmneiat) 2rm(m oo4tpen fciys a rm(vo;u) eeomr3todfpt  nvils teum(r iu1lmt lnct s  Dtmxrpno1olxomf3iatfa ulumo t0aexoxf3to1faDr n s;t)setoxrpio1alt  fvs (  2urumpoo4oltomf3iydlm rmnvsn(0teenifcoydfpDe uvol(0sexmim iu1ame mici ()s2rau oot1tetoiieiyd aDrau p;(4artoxr iadlpD lies t seuoxm no1lmte ieslsfsDrm(mpoo1tptomfeiaslaDran p;(0 etrif oy1fp rlnei;() ruoirpoudom nmfci t)artaxrooo0tlenmi3ildfs2ul( o;u0altrxf3iodla  aueo;s0 exoir oy1lm emnes s a2uaxrooo4oetnmfctad a2eau s (0altnxr iydlateli il( t2xr(r no1alt mnvtl(farurur nt1oetoiocilt m uaump u0trtnio3tadoateaivsl(  rumxrpiodalenlnetlt) rumu  oo4oltniociytfmDra(vs;u) rtrir to1fptrau o;t  rtmir nudomteliciltfs2tmxroot1apxo feiytfa2um(msnu4 rtnxf3oytlmD  ueilt)s2toirpoydop e fcs (  rtmumo;u4opt if3ilt sDra(vp t0 leoif3oytlatrauei;t0s2um(m nu1llt lnetat)a2tru  ot1oleniictatlm2rl(vs;u0 eerir3to1late nvs s  2tmxmpio1lmenmneslt  2trxr oo0texomicildfa emu s t)arerxr tydlmte n i;( trtrxo3iu1amee fvt t)a2trxrono1aet mfeiys aDrmn s;u0 exrircoy1om  aivols)srxoim3iydapeemncsls sDtru  ot1alxnmfciydla2ua(mp;(4trerir iadop rau slt texrim ny1amen fvsls)arururoou1aexnif3ilt aDrau s t0 exrxociodlp elu olt0t2tmxm no1lptnlneilt srrrx  ;t0teeo f3tytla umums (0trxomf3tadopDraivs s0s2toxo ou1amee ivs s artr(r ;o0aleomfciadfs rm(monu4 rtrmf3oa1laD  nes t)srtmxrpiy1aptelfes ( aruaum ;u1aexnmfciatfa rluvs;t0arenmrcoa1fmDeaies ( teurxrpou1optnliviat a2ta(m ;t4apxnmoeiad s2uluvo;t)teenio3oadfmD lu i;s0 rtoxo nudamenmivil() rrr(  ;o0oeeomfctadlmDranvonu0tltrxo3oodfmD lneilt0s2xo(opou1amtn feils s2uaxm nu1aexo f3ilsfm2rl(vs t4 lxnio oodfmD anvo;t)trtoxmpiy4am emnesat srumur ot4tlxo oeild mDulnvp u0trxniocoytfat livslt0texo(m no1am emfci s) Dua(m no4apxniiciasfaDrlnmsn()arxoxfctodlmDelivo ( srtrir3iu1ll n nct s) 2rrx  nu1oleo f3ildfa rluvo t0tlxnxo oodfaDr ues;t0s2tr(m oudamt lnesl( s2tr(rp;o4oee mfcilslaDea(vsnu0alxoxf3ootoa elueo;()srxm(mpny1omee nei (fa2ur(rpno0teto f3iysfs2ul(vs;u)aexrxf tadla  anes t0setmim3oudlmt mneta(  Durxr nu1aexn oeiltlm elnmsnt4trtomf iadfmt ai s;()t2urxrpoo1aptn nesasfsDra( o;o4aee moeiasla2rlnmo u4 exoifcoo1fatrlnvo;s  2urxm nu4ameelfcilt) rumxmpou4tpt moetydlm2emn snu4tetoir3tytopte ueil(0s2ur(o io1lpt  fvsa() 2rrx p;u0oexnifeias m2elnmonu4texoir3tydomD au i;t0t2uoxo ny4omee icta()sDrmxrpnt4oltniociys a rauvp u0aexoxf iadlpD  iei t trur(m ou4omenlncia(fa2ur(m no1olxomieiytfaDeln s (4texnxf ta1fp  lieo;s0trtmio3iy4olt mnci t) rua( pnt4oltoif3ilt a uanvsnt4 reoxr oo1lp eluei s)t2xr(m3oo1am elfvsl()arur(r ot4oeeomietltls2uanvont)teerxo3io1fpDran o s srtmimpiu4opee ivia()a2trxro;t0texo oeiadfa rau p (0 lxrmfciytom  lnes;(0tetrir3oydolte fctasf 2trxrpot4oet ii3tlsls umn o;(4aexnio oydfmDelnes;s)t2toir3nydam  lfctlt  rururpnt4oetnioetadls ul( snu4artomocia1lptranei;( s2xo(r3iu4alee icsa( srtm(m ;o1tpxnio3ilsfa2uan p u4artrxf todfpD ln olt  2xoxm3io4opeemfvs t)a2ur(root1tee mf3iytlmDra(vp;(0 reoxf ootfm  auvs t0 rumiopnydlpt mnet sf Dtr(rono0tpxn feiyslaDem(vp;u)aeenircoadfmtrlu i (0trurxrpnu4lp nlfei ()arum(m ot0oltomo3iatls2umuvsnt0alxoir3ty1opDr uei;t0srurir3ou1alt mnvta(  2umum ou0aetn o3iadfm2rl( s (4 eeoxociy1latelivsl(0sexm(o iodap emictat a2raumpnt4apt  fciasla2emuvpn(4aexoif tytopt au i ( srxmir3no4lmtnmfvsas  Dtr(  ;o0opxo iciaslsDel(mont0altomr3tatomD lneo (0truo(rpno4omen nvias)sDumxrpno4altnmi3iyt m2eanmo u)tleoxrctydomD  ivo;t0sexoio3iy1amte ict ( s2rm( o;t1oltomf3iys a uanmp u4alxoif oadomDe nvi;s)teuoxr3oy1am nlictasf Durur no1openif3tas a ra(vs u4aetrmf3io1fptr nvs (0srxm(r3oy4lltnmiviasfsDra(rpoo0alxn oeiyd s elnms;t4trxnmo todfaDeluvilt t2xoxopou1llenliesat a2trum ;u0oetn fctadla2em(mp;()aetnif3oo1lm  an o;(0seum(rpno4omeelnvs ( srrrxmpno0opxn f3tasla2ra( pnu4alxoiocoodfateliei t0 rum(r nudlp  livil(f Dtrur no1aeenifciysla2um(vont4 ltnxfcootlat lies;t)setmir iu4lm nlfvtltfartm(r nt1tet  icias sDelnms t0 lermo io1fp ranvi (0 etrxopou4omen nvils) rtr(m no1aexoio3tysfaDrlums;t4tlenio oo1lat ln s t0 rum(o iy4al nlfes t)srurum nu1opeoiociyt m rluvo;u4 rxoircoatfmD anvi;t setr(mpnodameemnvi t  2tr(  ou4tpxomoetasls ul(mo;(4tetoif tadom rlu o t0 rxoiopio1alt  fvtas)arrmu p;u0olxoiictltls em(mo;u4 rxrxo todoatran i ( setoirpiu1ale  iesa(fa2urx oou4oeto oeiadlaDrmn o;(4arxnmf3oatlmD lueils  rxmxmpnodlme lfciltfaDurum ot4openmfctltfsDrm(von(0 eerxrcoa1om raivo;( trtrxr3nudlme  fcta(faDtrx  ou1tpxomo3iysfm2ra(vp (0arxrir iy1lmtranvo;t srur(r iudlpeeliesltf rtrxmoou4oexn oetydla umu snu4trtrmf3ia1laDrlneolt0trtoio3nudolt lfci tfaDuaumpnu0aeenmo3iltlmDua(mp u4tltnif tadomDrluvo;s  rto(r oodll n icils s2trumono1tlt mo3tas s rlumpn() rtnxr3iadfmD  n i t)srtr(o3oudamt lncia(  2trx  ot4teeoif3tadfm2rln o u4aeeoio ty1lat lneo s)trurir oy4om emictat)sDrrxrpot1teeo o3iydfm2rm(mo (0teeniocoatfaDr i o s t2toxo oodlm nlnvsa() rrrxm ot1alxomieiltfsDemnvs t4tlxnxf iadfp   i ilt)teurxr ou4lm emnct (  2raxr ;t4alxn ieiytlaDel(mont4trenio oy1fpDraneo s srto(m iu4al nliet s)aDraxmont1tetn f3tldls eaumo t4teeomo iatlmte n s;t  euo(m3nu1lmeemnetas  2tr( pno0aexniocils s2ulumo;()tetnxr oy1opDeai s;(0texoimpoo1ameemfvsa() 2rrumo;t4tltn o3iadlm2emnvon(0texrmf iadlptranvs;s srtm(r oy1lmtnlfct ( a2ra(mo;o0oeeomictydls2ea(vs u0aeerifcty1om  luei s  etoxo no4op emivsasf Durxro;u4apxnmo3tlslm ean p;t0 eeoir oy1la  livs s  rtrxm ou1altn nes tfa2urxm ;o1alxnmietld sDumnvs;u4artnmo iydlmt  n ol(0srxm(rpoodaltemivt s) Duaxm no4opeomfeiyslmDemuvpn() reoxr oytomDrln ils)t2umiopoodaltelfvsl(faDtmxr no0apenmieilsls em(mpn() ltrif3iydopt  ivo t0t2uo(mpiu1apenlfetls  rur(rp;t0apxnii3iatfm2ul(mpn()areoifcty1omt ln o;( truo(o nu4lmt lies ()s2umxr no1olx  fetltls ua(mon(0aeeomr oa1fmD  i s;s)s2umio oydaltn nct (farrmxronu4tlt  oeiytls2el(ms t)tlxrircoytlmtrlueo;t  etrxm3nodapt mnct tfa2ua(r ou1olx if3tyd aDrmn snu0alenxr tydfat lu o;(0trxr(o3iy1al elivt ( sDta(  ;t0oex  icils m2ranmsn(0 exrifcia1lateli i;() rxmxo nudlpenmfct sfsrrr(  nu4opx io3iltlm rlu pnt0 etnxr iydlmDeaieol()s2xmim nudlpe mfetat)aDra(  nu1opeo octldfa2em(msnu0altrio3iotlat aivi ()srtoxo ny1omtelnciat  Dumumpno4aex ii3ild mDem( snt0tltoxocoadfaDeluvi (0teumxo nu1ameemfcsatfaDta(  ou4aeto f3tlt sDum( o (0tlxnmr tatlatrauei;t0srxr(o iy1lm e ivsl() rrm(r no1openii3tatfs2uluvs;(0aexrmo3tytomt anesl() rtm(m nu4ll e icsat s2ra(m nu4opt miciadfm2rauvo (4arxoxoctodlp   uvs t srxmxr iu1ap nmfct sf rrm(  ot4tpeomi3iltlmDrluvp;u0tlenmfctytfptr n o s)t2urxrpio4am   ivta(fs2tr( o;o1tpxnmieiat m2elnvo;u4aeeoxfciy1fp rluvs s0trtmxm ou4amtnlfvtat) rum( poo1oetnmietldla2eau p u)tlxoio3iatoa  au sl()srxrir3nydlm nlivt t) Dtrxr nu4oleomfeiyt s2ea( s (0trenmrctydomt anvol(0 rxo(mpiy1am   fvslt s2uaxr no0alen f3ilt aDum(monu0arenio to1opDr uvsls  rumim3iu1om elivs tfs2tmx ont4tltnmi3ilslm2uauvo t)trtnio oadopteau o s setm(o oy4oltemivtls  Drax  ou1tle  f3tlsfs2rmuvsnt0artoio todlmDeanvi (0 etoim3nu1lle miesltfsrururpou0tpxnifcils sDulu p t4trtrmrcta1lmtelieo;(0s2urirpiu1apeelivtlsf 2taxmo;u1altn oeiatls umn o;u) rxrxo totlm rlnvo;t s2trxm oodllenmfct () Dua(mpnt1tpx ii3iatlm2um(msnt0altrio todopDrauvils0 2tr(r ny4amenlicsls) Dtru p;t1aleomoetatlsDul(ms;(4 eenmr3oatlat li sl( s2umxm io1olenlietl(farumxmp;u4aleo fetadlmDumuvsn()trerir3ia1fpt luvs;(0 2urxo iudll   fcil() rtax oot4tlxoiociad a2ra(vpnt)tetrio3oatoatrln ols0trxrir3ou4ol   neslt) Duaxm no4oltoif3ildlm rl(vp (4arxriocio1optelneil(0srtmir oodlp nmfvilt) 2uaumont4texomieiadfs2eanmsnu)altoif3tatfp r ivol(0srxoiopnydam  lfei s arur(ronu4olen icias m ra( on(0altoiociadfm r uesl() etr(r iodlmt lnvsa(farrmurono4oex  i3ils s uluvpnt0 eerif3iytopD  ivol(0texm(opno4omt lnetlt)s2ua(rpot4tex iictlt a rm(msnu0trxoxrctydopt lnvo s)texoxmpio1amtnmfvias  2umxm ot1tet  ieild s rlnmsnt) ltnxrcio1oatrliei t s2xrir nodope  fei t a2umxrono1aeto o3iatla2uan s;t4alxrxf3tytomt luvil() eum(o nodlmtemfeiat artauro;o1ale  ocildfa um(vo;(0alerio3oa1fat an olt0texoxmpou4ll e nesl( a2tmx pnt1apto ocildfs2rln ont0 etnif to1lmDeluvs;s  rumio3nudapenlfcs s a2ra(  ot0aeeniieiat m ra(vsn()aeermo3iydfpD  iesls seuoiopno1ol nmict ()a2rmxroou4olenifetlsls rmnvs (4 rxoif3ia1faDe ivs () rxmxm iy4ole  nciatfa2ur(r ou0tltnio3tadfsDra(vs t0arxoxo3tytomtrluesls texmxo no1am nmici tf 2taur ot0aexomietadlmDuanvs;t4tetrircoo1fptr u s t  rxr(r oydam  liet ( sDta( ono0aetn ieiadla2rlu o;t) etrif3oodoate u i;(0setmir nu1openliet tfaDrau  oo1apenio3iat mDumumsn(4 ltnmf3oadfm  an ilt0 eumio3no4ol e fct s aDtmx oot0alx mi3tlt mDrlu p u0tleoxrciatfpDeli sl() etoir3io1amtnlfcs sfa2ur( pnu0apxo oeiltfm2ul( s t0arxoxr3oytlm rlnvolt0srtoxmpny1am elici sf 2rax ooo1ape mf3iysfa2elump;u0teenio3tydlmDelnei s0setmxmpoy4opte fvi t srrrxmpot0tltnmieilsfs uauvo u0 eerif3tatlmtraieolt truoir3oudaptn nes t) rur(r nu4opt mo3tltfsDrm(vp;(4 lerxo3ootfm  au ilt) rtoirpoy4ol   nesa() Dum(ro;t1alenmfetydfm2ulnvs u0 rxnmfciydoatr u slt srxoio iydaptemivsl()sDta(mpoo0openio3iatlmDelnmo;u4aeeoxf todla elnei t) 2tmio ou4omeemivil()s2urumpno0aeenioeiytlm el( p;u0aetoif3io1lm r ivi t)s2xmxrpnudlp nmfctlt  rrmxr ;t1olxo o3ias m2uau p;(4altnircoo1optelneo;s)sruoimpiy4lmtn nctasf Dtrxr ;o0apto feiadfs2ran pn()tleoirctydfpDe nes;s0s2ur(m3iydomenmictlt s2tm(mpoo1aet mociatfaDrlnvsnt0teeomf oytla raneolt)srurxm3oo1lmeemietltf 2ta( p;o4tpeomieiytls2uluvp t0tltnmo tydopD lu i;( teum(r nodoltemfvt ( a2ur(m no4ape iieiltfm2rmn p;t)trtrxo iadlaDelnvs;s)setm(r3oo4optnmfesa()arumx ont0oltoiictld aDumu o u)aeerir io1la  li slt0s2xrio iy4lp n ieiat s2urxm ;u0olxo o3iat a uauvsnu0areoxfciytop elu s;( s2xrxmpnydamtemfeias)arumuro;u0aeenmo3tat mDul(vpnu4 ltrmr3oadfa raues;t  2umim3oy4ale lies t  Dur(r ou1tex  iciatlsDum(mpn(0aeerxr3oytfat ai s;s0t2tr(m nu4ope lfcil()sDur(moot1tpxniieiasfa2eln o t)altrmf3totfpDrlues t)srxoiopnodamtnlivtl(f rtr( p;u0oleniicildfm emu snu0tlxrir todfaDr u ilt t2xoxo3ou4am emnesat)a2rmur nt0oee io3ild a2rl( p u4artnmr3iatla   i il( s2uoirpnu1ol emfetls srtrur oo1teeomfcilslaDelnms;u) rerio ia1omDeaieilt t2xmiopny1omtn fetat a2ua(  ;t4aeenmi3iyslm2emuvo;t0aetrio3tytfat auvils  rxrxrpoy4alt  ncsa()a2rm(m oo0tpenmfctys a umums;u) lerif iadlpDraies s)trtr(r3oy1op  liciatfaDtrum oo0texn oeildlsDrmu o;u0 exnxf oadom eaieslt)trxr(o3ou1open fctltfa2ua(r nt0tpe  i3tydfa rl(vont0artrmr3io1opDr n ol()tetmxr3nodam emfvs () Dta(  nt0optn o3iltlm2el( s;(4 exriocoydlm r iei;t s2xrimpny1lp nlnvs ()arrm(r nt1tee ioeiasfa emn pnt4aleoxrciytfmt luvi;s)texmxo3ou4ameemics t arraxmpnu4oeeomicildla ran s;u0tlxnio3iatlm   i o;() rum(mpnu4optelfctat  2taxro;o0oexnifcilsfm2el(ms u)teenmo oytlaDelu o t0t2xrirpiy4al  miesat  rraxr ou1tpt iicias aDulums;(4aeeoiociy1oatelnvi;t  rurim ny1aptnliet t)s2umu  ot0aex ioetyslmDelnmsn(0 exrir oodfpte nvo t0 2xmxmpoo1op elfvilt aDuru ont0oexnmieiadls ea(mp;t4alxnmfcoa1opDraues (0 rum(m3oudaltnlfvt ( srrr(mo;u0oeto fciltfmDua(mp t0 lxomrcoodfp rai sls0s2uo(o no4llenlnvil()aDraurpnt4ape  i3iyslaDra( s;(0 etoxfcoadlpte i o;() etrimpou4amen nct t)aDraxrpou4oleo ocilsfa2ranmo () eerxocty1fm e neol( sexoxr3oo4ol n neil() Dtrxr ;t4opx  feilsfm rl(mpnt)alxnxr io1fp rlnes t0seto(r nydlmtnmfcs (f 2umx  oo4aleo ieiydfs emuvpnu4tlxrmo3totop r nvi;(  ruoxo3iudol   fvils)a2taump;u0ole  f3ildfa ea( p u) lxomfcoadfaD lueil(0trtrim3nu1am  lnctlt aDrr(ront1texn f3tas aDem(vonu4trenxfctotfaDrln i (0texoio io1ope mfes (faDtr( o;t4tlxn fcils a rmu pnt4teerxr iytomD  u slt)trtr(r3iy1lm nmncs tfs2rr(rp;o1oeto ociat a2ul(mp () exnxr3iodfaDrliei s0trtr(o iy1altemfct tfsrraum no4aee mietatla2eln pnt0 lxoirciotom rauvo;(0 rxm(m3io1om nmfvtas s2rmumont0olenmf3iltla ea(mp;u) lxoircoytfpD lnvo s)texrxopnodlmenmfvsa(fs2trxmpoo0tle  f3tasls2rmumo;t4texoifcia1fptr ivi s)t2xrim3oy1ap   nviat)artrxrpno0oeeniietltfs raumonu) etoircto1fatelnvsl(0tetmimpoodapen ivtas sDtau o;o4oet mi3ilt a ranvo (4 ltrio to1fpD lu s s)t2xmxrpny1ale lics ( arumxmpno1tpxoioctatla rmu s;t) rtomfctadlatr neo t)sexoxrpou1am emiesl() 2rrxrpou4oeen ieiltla ra(mon(0artomr3to1lpt lu ol(0t2tm(mpoydlmtnlfetl(  rra(mo;t1tltomoctadlaDeaumo t0 ltnio oatfa eaivs t)srto(o3nudal e fviat a2rrxmpnt4opx iocild s el(vsn(4tlenif3todlat an o;s)trtr(o oydlpeelnctatfs2ta( o;o1teen ieiat a uaums;u0teeomr3oydomDrai s ( setr(o3nodlleemieia(faDtm(  ot4optnio3iadfmDua(msn(0 exrifcootlm e u s;t0t2xoxr3io1am n nvs (  rrrurp;u1altomociltfm2uauvs t)tetnxf iodlp eaies ()trumxmpiy1op  mictl() 2tmuro;o1aeto iciytla2rau o;t) rermr3iatopDe n o s s2uoir oo4lm  lneia( srtrx  nt4tlxoiieiasfaDuln s t0artrxr iadoa e nvilt) eto(m oydlpte iesat)sDtmxm no1tlto o3iadls2ua( pnu)aetnircoodfm r ieo s0sruo(opoy4oltelfei ()aDrmum ot0oltoioetyt s2ulump (0 ltnxo3iodfa r uvs s  rur(m io1lpte ici tf rurur ;o0altn iciys sDulumo;t4alxrmr iotfa r ies;t trtrxrpoy1lptnlfcsa()s2taxr oo0oeenioeiysla rm( s (0areoxf3tatlmtelnvols  rxrxr3iudomenlfeiatfs2ua(rp;t4alenifciyslm2elu o (4aleoiocoodfp rauei (  2xr(mpoy1altelies ( srua( ont4alt mi3iys sDumuvp;t0 reoxo oy1omD an s t  eum(r nodamen fesltfs2tmxr ;o4teenio3ilsls emn pn(4tltrifctodopDrln o;t  euo(r io1olt mncsltfsrtmx ont0aexoioeiadfsDemn p;u0 lerxocty1lpD aueol()s2xrio iydomtnlnes s)aDtaurpno4tltomoeiltlmDel( o;u0 rxrif tadop raivi ( srxo(m3iy1ope livs ()sDraur no0alt ifeildfm2emnvp;t0tltnio3oo1fmteauvol(0 2urio3oo4ap e ici (  rtr( p;t4apxnifeiysfs eauvp;u4 rxoxocoytlmtelu i;(0s2ur(o iy4apenlfvt t)aDrmu o;t4altnmf3iysls2ea(mpnt4 ltrir iotlaDelieo;t0texr(m3oydoptnmnei t) rua(rooo4tpx ifeiadfmDean sn(4aetnxocoy1lm raueo ()sexr(o3oydolte fvs t arurxrp;t1alt mfetysfs em(ms u4texrir io1fmD an il( sexoxm nu1ope mfvia(fs2um(ro;o4olen oeiatfsDuaumon() lxrmo iotopDraues;(  2xoxo iu4lm nlfvi (f Durumpnu0alx  fetat aDuln pn(4tlxomfctodoat lu o s0tetmxopnu1olte ies sf Dum(rp;o1oeto f3iydlaDemnvs t4 rxnmo3todom rlueol( s2tr(r oo4al emfvs s)sDumx  ;o1texnif3iysfsDul(mpnu4aetoiocia1oateli i ()setr(r nu4lptnmncs tfsDumxmpno4tet ioetatlm em( o ()trxnxr3tytlmDeauei (0 2xo(o nu1amtn nci (fsrrm(m nu0oeenmfetat s2ua(vo;t) eeoxrciadopteln o;t0 eurxm3ou1op   iviltf rra(mont0optoifetyslaDua(mp u)treomf3ty1lpt lnvo t) exoimpiudolenmfcsa(fsrrmu  ;u1ale  ieiytla rlnmpnt4trtrircoodopteanvilt srxrxr3oydoltnmneils)srtmx pno1texomf3tytls2um(vo u0alenxociatopteliei;t)srxo(mpno1om n ictl( sDrruroou0tpx iiciydla2ean s u) rtoxo3ty1omt ai i t  eumxrpou1lpe mnvsas a2umurpoo0tetomoetad sDum( p;u4 eenif oytoa   n s t seuoio iu4lleemict tfarrm(m nt1apxoiicildfm2rl(vo u0texrmocoo1lpDrlivols)seto(r3oo4lmenmfvtls aDtm(  oo4oeenmfctltfm umuvsnu)artrmrciadlpD auvi s s2tmxo3nydllte fesls s2ra(mpot0tpenmoeiydfa eauvo;u0arerir3iytfmtraueo ( srtoim3nodal elietas)s2uru  oo1aleoioeiydlsDranvon(0alxrxf3todlaDeluvols)trur(o iudam nlfeslt sDumumooo0olxnioeilslm ulumo u) lxrmr3oydla   i o;t)seuoxopiu1lptn ieia()arua(mooo1altomo3tad aDuan p t4alerxr3tadlmt auvilt setrxo nydlmen nvias) 2umxrp;o4tptniiciasfa rlnmont4altoiociy1op r i olt0 exm(r3io1lpt lnvs s s2ta(ronu4opxomiciys mDul(vo;() rermrcoo1la eli i (0setmxo io1lmtemfvtl()s2tmuronu1tex mi3tys s emuvo;u) ltoxocio1om  ln o () 2um(m nydlm   ieiltfaDrrx  oo4tlto iciys s rl( s;u4tlxnxocoy1fat lnvi;t)s2uriopoudalee nctltf rumuroot0olenmfeilsfs ulump;(4tlenmf3tydla elieolt0trumxrpoy4alenmietat)aruax pno4opxomicias s2eanvo ()artrmf ta1lpD luvi;s0trtoio3ou4optnlneil() Drm(  ot1ape mfeilt s elu ont)artrmocoodfm eanes;( teumxr3io1altnmfes s srrr(rpoo4opx if3iad m ul(vo;(0artnir iatla rln ol() etr(o3oo4lmenlnes s  2uauroot0opxnmfcias a rau o;()artrmociytlpD anvs s0t2xoxm3oy1ol nmieta()sDraxmpno1oet moetyd a2emn snu)alermfciatlmD ln olt tetrxm ny1am emfcs ()s2rmur nt0aexo f3iysfa ua(ms u4trtnir iotop elu i;s0 euoim io1amtemnesas) rrmx oou4ole mo3tlt s emn pnt)alerxoctydoa eauei;s0 euoxm3oy4lltnmfeslsf 2ra(r ;t1tetomietyslsDranmon() ltnxf3todfmte nvo () euoxo iy4ale mfvtl(f rumumo;t1oeenif3iyd mDelumsnt0alxnmo ty1lp  ai o;s s2um(r3ou1oltelfvsltfsrurumpot1opeomfeils a eanvpnt4 rxriocoodom   u o;()srtr(o iudlmen neias  2tmurpot1oeeomictadls2uanmo;u)aexoir oadfa   uvils)trtoiopoudom emnvsa(f rrrx pnt1tpt mo3iasfsDean ont0arxoif iytlmD  iei s0 rxm(m oo1ale lnvtlt)s2tauronu0tet  ocild a2rlnmo;(0tlxrmo3iatopDelnvo;(0trurio no4ll  lfvsls  Dtrxrp;u0tee ioctatlsDuanmpnt4aeenxf oa1faD  n ols) eur(m oy1omenlfvtlt aDrm(ronu0aee ioctaslmDemuvsnt)aetoiocootop r ues s) rtmxo3nydoleemnvslt a2ra(rpnt4olxo f3ilsla umn p u0altnio io1fm  aues;t srumxo3iu1ll n fvt t)sDtmxmonu0tlt mi3iyt sDelnmsn(4arerxo3oo1fmt an ilt0t2umir3oydal emfet s a2tmum nu4tlxoioetydfaDran pnu0altrmo iytfmtr nvs s0seumxm nudale mfes t)aDrr(mono4alxn octltlsDumn o;(0altniociodfa   n ilt0s2uo(m oydll   ivil()aDrrum ou1apx if3iytla2eanmp;t4 exrioctadlm r nvo t)sruoxr io1lmt  nvsa( sDrrxmooo1tlenmfctaslm2rmump;(0teeoir3ty1fmDelu s t s2ur(m3nudap nlicia(  Dur( pou0tlenmfcild sDua(mpnt)aetoxrcoy1lptr uvo (0teum(rpiudamenlneia( arumur ot4oeenio3iat mDuln s t4artnioctodoateau ol( seto(o iy4lmtnmivi sfaDuaxmoou4olx iietlslaDrm(vp u) eerifctadfa  an s s)sexr(opoy1lm nlfctls  2uru  ot1olen f3ils s ul( s;u4 exrxf3ia1fpte iei;s) eumxr iu1lptemnvilsfs2uau p;t0oltoioeiltla rlnvsn()tltrxr3tytla r neil(  etm(rpiydomtn fesl( artr(m ou0tpt mfctytla el( o;t4texnxrcia1lm r u il()t2xo(rpiudoltn fci sfsDtaurpot0tpxo o3tlsls uanmont)alxoio oydomte ieils0texo(m iu4amtnlfvtlsfaDtrxmo;o1texnmi3iat m emnvp;() etrmo3tadfpDrli o s0srum(r io1llen iciltfsrtr(  nt0teeo f3ildlaDranms;u) eenir oadfmDraueilt0 exmxmpnu4lm nlicil() rta(rpno1oeto ieild m eanmp;u0tetnir tydfaDraivs;s) 2xrxrpnodom nlics sfa2um(r ;u1tet iictatfa el(mon(4arerxrciytlateln ils)trurxr3nydol  mnvtat)arrmxroot0tlxnifciltfsDum(vs;(4aeeomf ia1fa elivs;( srxm(o no4lm elnes s  2urx o;t0texo o3ilsfs2uau on(4texrircoytlptr n s;(0teumim3iudale lfvil() rrrxmpou1opx  ieiyt a2ulnvp t)artomfcoodoptrln s;t0seurirpiu1lm  mfci tfarrmur nu4altn icilslaDumuvs;t0trxnxf3oadlm eli i;s)s2umir iu4ole mnvt t srta(rp;o1apt ifctydla2emuvs;(0texnxociydfpD  n slt0t2xmio3oo1am  lfcilt)aDuaurp;o1tlx  f3iadlm2ea(vs u)tetrir3iatlp rlivi t0t2triopiu1lle  nesa(fsDuaum ;t1tltn ieiasfa elnms u4teenxr3oadfm eauvil()s2xrxopno4lmtnmfcsa( arrmump;t1teeo ieildlm eau pnu)aleoxo oy1oat lnvils)teuo(r nudaptelnei (faDrrxr no1oltomiciyd s2emn p;t4 rxrmo3iatfa rau olt)t2ur(r3iydape mnvt t)aDrr(m ;u0teeo i3iatfa2uan s;t4tlenxf tadfmDrau o (0 ruoir oodlpeelfeil(faDururpoo4teen i3tat m2uau o t0aleoir3tatlp e n s t)setm(o3iy4lmtn icia()s2umumo;o4apt  ociltfaDelnmo;u)arxnifciydfptrlnvo (  ruoio ny4omtnmnvi s a2uau o;t0tpeomfctltls2emnvon(0altnmf3iadfm e u o ( s2xr(m oo1ameelietas)s2trx pou1teeoiicilsfa2ul(vo;t0tltniocoy1fate nvs;t) ruoxm3iu4olenlfvil(fa2um(mp;t4tex  o3ils aDumnvp () rxrir to1lateluvs () rto(rpoo4op n fvs t) rrr(  no1tpt mf3tltfaDum(vs;(4altnxf3tytop r u olt)sruoxm nodlm nlfvsa()s2umx  ;o4tex  feiytla2uln onu4tltrmr3ta1oa r ivo t sexrir3no4lmtemnes s)srtau p;o0tpxn ociydfmDeanmp;t4 lxrir3iydfmDr ivs;( sruoxopnu4ap nmivtl( s2uax p;u4aexnmo3iydlmDeau ont4 lerxrctytfpteai i s seuoir3nydop nlfvs (fsrta( poo4altn f3iysfm2umnvp;(0trerxr oodomD  ivilt texoxr iu4alt  ieiltfsDrrx pno4optoio3iyt s2eauvs ()aeeoiociadla  aivs;s trxm(o nu4op  mieta(  rumum ;o0teen ieilt s2eauvsnt) lxrxf oo1faDeai o;t tetmimpiu4lm n fcsls)arraxm ot1oex  fciydfa2rlnmonu)trtrircoodfmDran sls)trtr(rpno4opt mfcia(f Drmxmoou0oltnio3iadlsDemnvpnu)altrifciydomD aivo;t) rxoim nu4om e iesl( arrau oou0oex mfetydfa2ulu ont4 rxnmfciy1lmtelnvil(  etm(opoy1apt  feslsf rrm(m ;u0tltnif3iad s2rmumsnt0 rxnmf ia1fpt aues;()t2xoiopno1olt lfetasfsrrrur nt0tetn fciys s2ulu o t)texrmr3tytla r ues s) 2tm(mpnu1aptelfvsatfs2tm(r ;o4tptn feiltfm2eanvs;t0trerir ootfpDeauvs ( setmio3ny1om  lfesls)aDrr(mpno0openmf3iytla2rlumo;()aetnmr3tytoate uvs;t)srtmxmpnu1ome  nvils) 2tm(rpnu1ole  f3iasla2rl(ms (4artnmf oa1lmtelnesl(0 2xm(r3oodaltn nvt t) 2tru p;t1altnio3ils s ea(vpn(0areoxrctodoptelues t0s2xoir3oo4omtnmfvt t arta(r ;t0apeo i3iydls2rmu snt)tetomrcoa1omD au i;( trumxo oo4am nlictas aDua( poo0ale ioeias m2rmuvs;()aexoxr3iodoaDraieolt0 etoiopnudap nlfetl(f rtrxrp;o1oleomfetytfm rm(vpnt4aleomr ty1op elivs;s0 rtrio ny4optemfeilt) Drru  nu1oetnio3tlsfm2eau pnu0 renio3iadfatrluvi (0 rurxmpnudom n icsl(f 2ur(mo;o0tee  f3ils a rlnmo (4arxomociodfmDe nes t  exmimpiydamen ictlt  Draxrpnu0aetniicilslaDulumo;(0artoifcoytlp elu olt)seto(rpoydlmte feils)sDuru o;t4olt  fctadlsDrauvsnu0artnmo3oy1fmt anvsls0seuoxm3oo1lme miviatf 2tr(ro;u1tpt  iciytlm el(vo;t0arxoifciydom elivils)trumxr nu1op elnct t) Dumum ot1texo i3ilt a emnvp;() reomo iodoa  lues;t0 ruoxrpiy4lm nlicsa(  2ra( poo4apx  fctysfs2uaump t)trxomrcto1omDrluvi;s)sexmxopny1lm emivil( aruaumoot1tetn oeiytfsDul(ms u0aexomr tydfpt lneo (0 2umirpiudole lieta()artmxmpno4oeeomfeiydfm ean p (4 renircoy1om e ueslt0trto(opiu1ap e iciat arrrx  ot1texn fetad s2uanmon(0artnmr oadopt luei (0 etmxm oy1opt mivslt) rtrxr nu0aetnio3tytla2ra(mp () exoio ta1lp  aivols0setmxm oy1llenmfciltfaDur( o;t1aexnmf3iadlaDrlu snu) rtnxrcia1opD aneo s t2tr(mpnu1ol nlnvsa( sDuaxronu4oeto ieiadla2elu snu0 rtrxf3oa1fa e ues;t0 2xoxm3oo4aptelict s)s2rau onu1tpt ifetysfs2umumo u)altnio tadfatr ies;( srurirpoy4ap elici tfa2trurono1tex iociyd a2ean snt)altoxfctodlpDr ivol()s2xr(opnu1op  lieiat srraxr ;o4aex  fcild mDumn ont)treomf iytfa rln olt tetrir ny1opeemncsls artmxrpno4tex ifctldls em(mp;t0artnmrciy1lpt  ies;s texoir oodamtemicils srrmxr ;u1alxo fcild mDulums t4aexnmr oa1fpDeluvi s0srxm(rpio1aptn ivt tf rrr(r ou0tpx moetat aDrm( p;(0trxrxfctadlm eaueo t)teuoim ou1olt  neta(farrrxmpot4tet  oetltlm ra(mo;t)arxomr ty1fmDrli sl(  2xoxrpnudll emfct sf 2umxmpou0tptoiictyd s emumonu)trtnirciotoatelieo;s t2uo(mpoo4am   neias)srtm(r no4altn ociaslm elu p;(0 lermr oytfmD luvi;()trurirpnodop  mict (fa2tmu pnt1open ieiys m2uauvpn(0arerxo oy1latean o;s0teto(r iu4omtnmici ()aDua(  ;o0optnii3ias s2eau s t0alxnio3oytlpD lnei t s2xmxo3nodole licsas)aDrmu ont4tpto o3iyt s eluvp (4 etrmr3iotfp eauei;t srurxr iu1ap  lictlt)artau pno0tleomi3ias s2emnvont4trxnmr3iytom e n ils texr(r io4lmenmfeilt s2ra( onu0apenmfciytlsDulu snt0alxrxfctytoaDr n ols)tetoxrpiydame mncslsfaDrr(r ;u1openiieilt s2el(vs u0trermfcto1opt auesls)srtmxr iu4apt lfctat sDtaur nt1oexoii3iyd aDra(vs (4texoxf todfpt livo ()s2xrxr iu4alt mfciltfa2tmxrp;t1opeo octytfa emuvo (4aexrmo3iadla ranvi;t t2xm(m3io4omte ivia(fs2tmu  ;t1aleoifeilt mDuau p;(0altrif3oytop ranes s0setmxo3nodope  ivs tfa2trx  ;o4tex mf3iyd a2umums (0 reoxo ta1oaDrau olt0 ruoxr3nydole lfvsasf rur(mpnu0oeeniieilsla2uau snu0 ltoxo3tatfmDraivolt0s2ur(r oodolt lnvtls)sDumump;o4oeen fciat m2um(mo t4arxniocoatop  lneo;s0 2tmimpnydalee ncsls)srrmxmpno4opto ocildfm2uauvon(4 rxoxocio1omDr n o t0 exm(o ny1aptelfvi (faDtrxrp;t4oetomociytlaDranvo (0alxnxo3ta1fmDeau il(0 2xmxopiydam elivilt)s2trx  oo4apenif3iytlsDuanms;t)tleoxf3oo1fmt aiei s0trtr(o iy1opeemivi sfartau p;t4texnmi3ildlm2emnms (0teenmrcootom ran i;(0 2xoxr oy1lmenmnetat) Dtaxmo;o0tlxn feiys a em( s;u0altrmrciadoa elivs;(0 rurxrpoo4omeelfciasfs2ua(r oo4texoiieiatfs2uluvp t) exnio iytopte ivilt)tetrirpiu1apeemfvtl(  rumurpot1tlenmf3ias sDrlums t4aeeniocoydlpDr u olt) 2uoxm iy1lltelfciasf Drrxmonu1tltomociydfmDeau p;(4 rtrmfctatfa eaueols)t2umimpnodom e ivil(  rtau ooo4oexnioeiytls2rm(von(4aetrxr3oa1la r i ols)t2urxm iy4amtnmfvsatfsDtaum oo4oleoifeilsfmDelnmpnt4trtrmrctytlm r ueslt0setrim3ou4alt lietlt) 2uru oot4tpxomi3tat a ulnms (4 renio ta1lpDeaueo t sexo(o3no4amt lfetls  2rau pnt1tpxoio3iltfa el(vo;u0trtoxf iytoaDelu s t0 2toxopiu1lle  ivs t) Dta(ro;o4tpeomfeildfs rau s;u4 rtomf3todomtraivo s0texmio io4omtnlfvsl( s2ra(  nu0tpx  ocias mDulums ()tltomfcootopDr neils trxm(m nu4omte icsat sDtaxmonu1texomi3iltfm2umums u0teenxrcoadopt au i t)setrxm3no1lm  lnvilsfsDrrumoou1aeeo f3tysfs ulnmonu)alxrxfcoo1faDe uvs t seum(r oy1lme  ies ( aDtrxr no0tpto ociatlm rln o;u4tetnxr3iodop eaneols)t2tm(m3nu1lmen ics (  rtaxmpoo0aetnmoetas s2rlu p;u0 lxnmo oodfaD li o ()srxr(mpnu1lm   fciatf 2uaur ;o4tpx  fctysla rmums;t)arermr tydfat ln i s)trxm(opnu4optnmfeils  Duaxmonu1tex io3iyt sDrlnvont4arenxf3oydlmt aieo;( texmim3iy4om emfcta( arraur ;o1oeto ictysfs2rl( o (4trxnmf iotopDeli i;(0trto(m iydalt lnvsat aDrmump;t1tee  o3tat m em(mo u)trerxr tatfaDr uvo (  ruoxo iodlmenmivtlsfa2ta(ro;t1tltomfciatlmDumu o (4trtrxr3ty1omDeln o;()trumxrpiodll emfci () rra( pno4alx moctlt a2umnvpnu0tltoifciatlmD luvi;() rxm(o no1altnlici (f rtax p;u1apxnio3tat s2umuvp;(0altnircio1oaDrluvi;s  etrxm oudalt  nvi s s2tru oou0aptoio3iltfs rm( p t4 exrio oytla rai s;s0teuoiopoydlmtn ncslt s2tmumpou4oexomoeiydlsDeau sn()alxrmf3oatfa   nei t t2um(o3ny4op e nvta(fartmum nt4oeto o3tyslm2el(mpn(0tlerifcty1lpt livs s0setmiopiy1op  liciltfarrm(mooo1tltoioctysla rmumont0 leomrcty1omDr i o t0 exoxrpnu1am nmfvtls) rtr(rp;u4ope  f3iydlaDemnmo;t0 lxrio totfp eau ols0 rxr(r nudlmte icia()sDtrxmp;t4oet  o3ils m2uan ont) leoiociodlpD auvs t t2xr(o3iydap elnvtat)aDrr( p;t0tltomi3tyd a rl(vs t0aeeoifciytlpDrliesl( s2ur(m ny4ap  mici s  2urxrpot0oexniocilslaDem(mp;t0 rxomfciytfatr u o;(0srxoxr iudol  lics tf 2ur( ooo4aetomieildfa2ea(vs;() lxnmo to1opD lnesl( s2xmirpoodap emncsa(  Dtm(  no0aee  oetat s2umu ont)trtoxo3oy1fmtrluesls)texmxo oo4alte fetls)aDrrxroot1tpeoio3tys a2ul( p u) eeoxrcoo1fptraies t0 ruoxr3io4ap  licsls srumu p;u0aexnmoctlt a uauvsnt) rxnxfctotfpD  nes;t0srxmio ou1al   ivi (fs2ta(r ou0tpxomociydla uauvs t0tltrirctotlm rlneo;t  eurxr3oo1lptelieilt) 2rmx o;u0tee  oetadlaDemuvo;(4altnxrcio1faDeanei s)s2xo(rpou1omeelfeiatfs2rru ont0tleo i3tldfs2eanvo t0tlenxrcoydlmtrauvolt t2tmio3nodom   ivtat)sDtr( o;t4oexnifciltfs2uanvp;(4tlerxf oydlmt livo;s0srxmxo iu1ame lfeil()srrauront0tle  f3tltfsDrmn p u)trtnmr oodomD aivolt s2tr(r nodlmeelfvtlsfs2ur(r no0aet ioctytlm2uan s;t4 etnmf ta1fp eaivo s0teurxr iydll e icslt srtr(mo;t0tpxo f3tadlm rmu o u0trxoifcty1omteaneol(0truoxopoo4amtelivs t srrrump;u1oexoifctadlsDea(vo t0tltrxr to1fptraueil()tetoim iodape  fci (faDtm(m ;u1tlenmoeiysfm2ua( on(4teeomrcto1lmt  uesls  2umxopiy4amt  nvilsf 2tau ono1tex if3iatlsDrmump;(4aleoif oodoa rlneils)srxrxmpno4optelivilt)s2taumonu1apeoio3iys s2eln s u4alxomr3oydfate ivi;t trxrxm3oo4lm nmnvsa()a2rrxr no1tetomiciysla2rmuvpnu4 ltnmr3to1fatelneilt0seto(m3nu1lmtnlnvsa()srtrur nu1tleomi3iadla em(mp ()teenxo io1op  ln i s0texrir iu4lpte nvi sf rur(rpnu0tpenmi3iyt sDraumon(0 exriociotom r i s t) 2toxmpnu1ol   nei t)a2uaxrp;o0teen feilsfs2emumo (4aleomr iotlpt ln o;s s2urxopou1ap nmnes t) 2ururooo0aex  f3tadlaDelnmo (0 lxrmo oydfaD anes ()t2tm(o3nudop nlfes s)aruaurp;o0tleoifcils a2ulu o u0arxnircty1lpt lues t  2xoir3iydap nmfetl(f rur( ono0olxoiociad m ra( snt4altoxfctadfp  li ilt t2urim nu4op emnvs s arurxmp;t4tleoiociytfa rmums;() lxnmo3iytlat  neils0 etoir3iydomenlietat  rta(m nt4alenmoeiyt m el( onu4tetoxf ty1opD livo;( srtrirpio1opte icslt s2urxr nt1opxnmiciydfa2em(vp u0teeoio oodoatrlies;(0sruoirpoydapeemicslt  2umurpno4aexoiiciydla2ra(mo;t4arxnmo io1lm raneils)seuoxo3no1lpt licslsfs2rauro;t1open ieildfm rmuvsnu)aetrmr3tadomDrlu slt  2tm(r oy1amte ictls)aDrr( o;u1olx mietldfa2em(ms;(4teeomo3oo1opDeanvo t  2uoxopny4opt miet ()srrmxmo;u0apen o3iyslaDra(monu0 eeoxf ootlpDr ivi ()s2tr(r nodom nmfvsls a2uaurooo4opt iociyslaDrmu on() rtrir3ty1fa rln sl(0seum(o oy1apt mictlt s2ra(rpoo4tlenmieiad m2uln p u4alerif3tydlpt auvo t  rurxm nodlmtelnetat)s2rm(mooo1texnio3iat aDeanmp;u)aeerxf oadlmDe nvs;s0 eur(opno1lle lictas  rrm(mono4alen fctas m elnmo;t)trxrmf3oa1la  anvo s trtoxmpiodll   nvsasfsDuaxm oo0tlenmietasfmDrl(vs;u)aeeoxf3oo1lmD an o (  rxoxrpoy4ale  feilsf 2umumpnu4teto oeiltfa2eau o;t4 exrir totoa eaivslt sruo(o iy1omt  fviatfsDtr(  nu4apt  octat m2um(mp;()aleoxrcta1omDrauvi s0seto(m oy1am emfvsas aDrr(m ;t0tlxomoeild s2rmnmon()tltoxo3iadopDeai o s s2uoxrpny4apt miesl(fa2rrur ;o0apenioetadls2emumonu4alxnioctytfpteau i;s srtoxm3iudoleemiesa( s2tmum nt1oeenifetad s2uauvs t0texnxr3ta1fa  livs t  etmir3no4lpt mfvs (fs2rm(ro;u4aetoio3ildls2ra( s;t0aexnxr3tadlptr ueolt) 2uo(opou4amen neia( aDrm(m nu0tlt  o3iyd sDulnmp (4aeeoir3totlmte uei (0 etrio iy4am n ics ()srur(ro;u0oltnifetatfa el( o () etoifcoa1lpDean i;s0texmim3oo1olee fcslt s2rr(monu4oet mocildla ea(vp t0alermrctydfmD lieols)srtmxrpoodomeelnct sfs2tmx p;u0olxnifcilt m2ea(msnt4 rermr oodfmt  nes t t2xmir nydap  lnesl(fsDrmxronu1apt mo3iad a2um(ms ()trxrxo tatlp r nvilt teurir3io4ap e ici ( a2tax  no0apt  fcilslmDulnms t0altrir3oydfaDrlnvo t0srxmim3oy1lm nlfvs t sDrmxmo;t0apt if3iad s ranmp;t0 rtoxf iodopD  ieo t0t2tmiopno1lm emnci s) 2trum ot0aetniicilslsDem(mpnt0 renmrcty1opt livi;s0srtmimpno4ll nmictl(fsDrmxronu4aeen oeils mDrmnms (0teerxf3tydopDrai ilt0trurxrpoydop nlnvsls srtmxm no1aexomi3iyt aDua(vs u)aexnif3tatop elues;s0 2urxopio4lp nlfvsas)a2ta( oou0tle ioetydlmDrln s;(0trxrmocio1op r nei;s  2xoxr3iu1apt lncs ()aruaxr oo0tetoioeilslsDrmuvp u)teerxo iotfmD  ues;( trurxmpoy1ap nmneia( aDraum nt1tpxn fetyt s rmn o;u0 eeomrcta1oat  i o;t0srxr(r3no1lp  mnvsa(fs2tmurp;t0tltnifciad s rlnvs;t0 eeoifcta1omtrln olt0 etmxmpio1alenlnci tfarta(mp;o1apxoiociatfm2eanvs;u4 rxoxr iodfat anvs (0t2um(opiudop nmfviatf Dtr(mp;o0olenmiciadlm2rln p t4trxrxo3ia1omte n ol() 2umir iydll  mfvt t) Dumum oo4olx  ieildlm ra(ms;(4tltrxfcta1om r uei;( s2uoxm3io1op  lieias aruaur ;o0olxomfciadfsDum( s (4 ltnxr3todlmtraies s0s2xr(r iy1omen nvi sfa2ur(root0oexo iciytfmDea( o t)aeerifcoo1lmteai s ( srxmxr3iu4lmtn ncias)arur(monu4alt io3ils s2uluvs u0arenxf iotlp eau slt0 etr(o iu4llt  ivt s arur(  ou4oexnmfciyd a2umump (0 eerxf iy1fptraues;() eto(m3iu1ap  miesat)srurx o;u0aeeo f3iad m uanvsnt0 etoxf io1op ranvo s0 2xoxo ny1lpt mivi t)sDtmx  oo1oeen ociys m ul( s;()tlxoif3oa1fmD  uvs;(0trumxrpoydoltnlicsat sDuaur ou0teeo fciatfa2um( o t4artnmr3to1omte i ols0 2xmir3no1ameemncta()artm(m ou4oex  feiadlm2rmums;() leoifciotomteliesl()trtrxmpoodomt mfeilsfs2umx o;o0oex if3iatfsDrmu p;t0 lxnxfctotlm ran il( s2triopio1llt mfvtlt a2rax poo0ole mictytls ulnmpn() reniociytfa ran s ( t2tmir iydolte fvtltf Dtm( pnt0opx io3tysfs rmu p;t4teeoxo3iodlateaueo ()srxrio3iy1op nlnesatfarrau oou4ale  f3iysls emnvs;() exnmr3oy1fpDelieol() rxrio3nodlle  fei s s2ra(ronu1oee ifeiyd m2eau snu0 rtrxr todomtrluesl(0sexoxm3ny4al n fes s arurxm ;u4oltoif3tadfmDul(msnt0arxnxo tydoa rlneo;()teurxo iu1ome  fesas srra(m nu0aeen feiyt m eanvont0alenir3oa1lm ranes;t)sexo(r nydomtnmnvt s  ruaur no0tlxo fciatlm ea( p;() rerio3tytoaDr i i (0t2xrxm nu1ll nlfvsl( a2rrx oou4alx  ieildla2ea( p;t0trxnxfciatfpt li s t) rtrim nudllt micsa(f Dua(  ;o0oeen i3iytla2eluvo;u)texrxf3ta1lp raies t) rtoxo oudomen fctltfs2rm(ront1teeniiciytfa2uauvsnu)aeeomo tytom r n ol(  2xmim io4ome lfeias) rrm( p;o4aeeoiieiasls2uln s t0 etoxr iotlp rlneilt  2ur(mpoodomenlfeils)srra(ro;o1oetoiieiysla2uaums t)tlxoif oatomDe uvolt0 ruoxmpno4oltn netasfa2rmu poo4aeeniieiyt sDrau s t0trxoxo io1oa  lieo ()trtmxm3no1oltnlfcta(  rra(m nt0tlen octlsfs2em(mon(0 exomr ta1laDe uvo () 2tr(o3nodap e fvsl( s2urxr ;t4ale  i3iasfaDum(mo t0 etomo tatlaD lueols  2tm(r no1lmen ieia() Dtau pot4olto ociat aDelumsnt4 rtoir3ootlm  an o;s0 exrimpnu4llte fetat)arum( o;u4tptoifciyd mDumump;u)tltnxf iy1fmt  ies;s) 2ur(r3ny4omtemneilt)a2uau pno4alx mictydfmDeanvsnu)tetnxf3io1lp  auei;s trumim iu4aptnmieil()sDur( pot1aptomf3iasfs2emnmpn()teerxr3oatoaD lu o;s) etm(m3iu4olenmietlt srum(mooo1alt  ieiadfsDua(vont)trxnio iodoa e neolt0seuriopoy1lptn ivtlt  rra(  oo4alto f3iyt mDea(vo t4trtnxf3oydlm  ln ils srum(rpiu1llen fvs ( a2uaurp;u1oeeo oeiytfm ra( p;u) etnif3ta1fat anvs s srtrio iydap e feiltfa2umumo;u4tetn ictatlsDumn p;t0aleomrciy1omDran i;s0setoxmpou1omtnlieilt)a2rmurpot1aeenmf3ild sDel( o;t4tleomo tatopt anvo t) etr(rpoy1ap e net (fa2ra( ont0opxo octldfa2ua(vo;u0 rtomo to1la rlnvs;( teum(m3no4omt mfctlt)aDtmuroot4texnmoctltlaDum(mp (4 ltrir iatom  aues;s0s2triopoo4ol   neiat aDrmxrpno4oleoii3iltlmDuln pnt)alermo iotopDr uvo t0t2uoiopoy1ale  fvs t)arrrum nu4tpt iiciatlm ean o (0arermrciytfa raues t)t2xmimpny1lltnmncsl( aDua( pnu4tlx  octyt sDea( onu0tetnio3ty1op rli olt)t2uo(rpiydap e nciatf 2rmx oou1texo ocildls2em( pn(4 lxnmociydfatraieil() 2tm(r3iy1opt  fciat srtmx ooo4aeto o3ildfaDumumpn() ltoirctodlaDr u s s) eurxopou1olee iet s)a2rrx ont1tleniiciltfs rl(mp u) exrio3iytfmt lieil( t2tmxo3oy4llt mnetas  Durx onu4aex mo3tysfm2uaump u4 eeoxo3oy1fmtrlnvs s0t2toir oydapenlfes s)s2um(rpoo4ope iiciadls emu snu) rtoxfciydlp  anes;t t2umxm3no1omee fei t)a2urxr ;u1tpx if3ildfs2rmums t) etnxf oa1lmtrauvi t) 2tr(o iy4lp elnvi s  2tmumpot1teen o3tasfa2eanms u4 eermf3io1fpDran o;(  exr(o3oydoltn fetlsf 2umu  ot1aee mi3ilslsDrm(vo;u4 lerxocta1oat ln i (0sexmio3oodapeemfes (fa2urxmpou1aeen ieiat s2emu s;u4teermo3oadoaD  nvo (0srxo(o nu4opt lfeils) rtaxm no0tetnmfciadlm umnvp (4alxrioctotfpDe uvs s0trxmxm3oo4olenmicias)arua( oot0tpxomoetadfmDemumsnu4trxomoctodopD luvi;( s2toio ny1llte fcs (fs2ua(  ou0olenmfeiltls2uaumonu4alxrifctadlaDe uvols s2xriopio1ll e neil(f Dtaum nt1apxnmi3iys m ranmont4alxnir oadom  anvilt) 2trimpno1ol   nci s) rrau  nu4teen ictatlm ul(vsnt0altomr3tadlaDeai s;( setoio ou1lpteliesa(  Duaumpoo4oexomi3ilsfa2rmnvsnu)texoio3oodfa  aieo ()trxr(o iu4lme lfetat) 2rr(mo;o4olxnifetytlmDemnvo (0 exrioctatfpt ai s;s) eurio oo4ale mncias sDrru o;u1tltnmiciyt a2ea(vp ()trtnio3iotfmDrln i;(0t2triopiy4opt lics s)aDra(ro;o0alxniocilt a elnvp (0aleomf iadlmte uvs;t)s2trxm3iy1lp nlneiatfsDrrxrp;t1tpe iicilsfmDuanvp;u4artrmr totfate ivs (0srtr(r3ny4ame  nvtat arta( pnt1aetnmi3ilt sDrlump t)aeenmr3iodlm  lieols  2tmxmpoy1lm nlfvta()sDrau p;o1tlenmietad aDua(mp (4tleoif3ootla  auvsl()sexo(r oo4lp nlnct () 2tr(rpno1alxomiciatfa2rmu s u)alxrmr oatomDeanvs;( texm(mpny1opt lfvi ()sDuaxmono0oleomoetasfs eanmo ()tlerxfciotomDelneo () eum(rpoy4al n ncsasf 2ur( ont1aexomo3iatfs rlu s t)trtoxociotlm  auvi (0srxm(r oydlpeemnvils)srtau p;t4tlx  feiadlaDrlnvo u) leoir3iotlm rli i t0 ruoxr iy4amt mivtasfa2tru pnu0alx  f3tlsls2uaums t0areoxr to1faDeaues (  rtrim iu1amtelnvtatfa2uaxrpnu4aetnmfeiyt m2eln o t)aetrxrciadom elnvil( setrxm nu1apteliei t) rrm( ont1oet io3ilsls em(mo;u4alerxo todlp  au olt  exo(opno4alenmiei ()srtaurooo4oleomfeiltfmDelnmpnu0alenio oydla   i slt)teur(o3oodol elnctasf 2ua(ro;u1oleoioeiasfs2eauvsnu)aetoxo3to1opDran o t truoir3oy1lpenlivi t)artm( onu1oleo f3iytla2rmuvsn(0 etriocoydop   neslt0trur(o oo4oltemicias)sDumum ;o4tptn f3iat s rlnvo u0altrif3tadfmt  ivo;()srxo(m nodom emfcilt)a2raum ;u0oexoio3tas a rmu o (0 exnmf3io1fpD  neils)texmxo3oodol elfei sf 2trur ;t0ope  ociatlaDemu p;()teeoxo3iadlaDran s;(0 exo(m3oo4olt mfvt () Drmx ont1opx  f3tatfs uauvont4aleoxo io1lmt aies s)seurxo oy1aleelfcsls artaxm ou4opt mfeiytla2em(mpn()aexnifcoy1fmt aivo;s0 rumxm3iu4olenlnvs t)arta( pnt0tltoifciyt a rauvp () ltnmf3tatfpte nvolt0t2um(opoy4op n ivt tf 2taur ot4oltomi3tas a elums (0aetoxf oo1fm r uvi s)trxr(opno4omte fetas  Durxr ;o1tpe ifeiydfm2raums;t0aexnmo iytoa  lu o ( texrxm3ny4opeemfvil()s2rmurpnu0aeen i3ildlm2rm( p;t)altnmfcoytfa rliei;t0sexr(m nodale  ieiasfs2urx pou1aeeo fcilsls2uluvs ()alxrxf3iy1fp   uei (0srumir3iu1ameelfci ()sruau  no0tle mfeiytfaDra(mp;u0alxnmrcoydlm  ln s;s0t2tmxm iydlmeelnesat s2um( ono0apen o3iyd a2elnms;t4 eermr to1faDe nvs;s teurir3ny1omenlivtl(farumumoot4aeeoifcilslm em(vs u)tleniociytlp eaies;( s2urxrpny4lme mfet s  rtauro;o1tptnioetydfa2umums u0trenio3oy1opD  ivo;t0truo(m io4llte nviat s2uru  nu4tlt if3tatfsDul(mp;(4aexnmocoytla r n s;s0trtrir iodoltnmnet sfs2uru  ;o4olt  fetytlm rmnmo;(0tltrif tydop  lueol( s2to(m iu4amtelies ()aDtm(mo;o0oeen ociytfs2uan pnu4artrirciytoa eliesls)s2xo(mpoo1lle lfetl(  2taxmpno4teen oeilsfsDrlu p () rxoxo iodfp  aneil(0 rxriopou4lm   fvsa( srra(mpoo4apen fciydlm2elnvp;t)aetnio to1lmteanes;(0setoxr ou1aptelici s) 2rr(  ;u0alxnmo3iyt m rlnvsn(4 rxrxrcio1fmDrai o;s) etrxr nu4op  lnetls)s2uaumpno4tpx mfeiaslsDean p u0tlerir3totfmDranvo t  rxoir no4al   nvsat s2uaxm ;o1tetoio3tyt m2rmnms;u4trtoio oytfpt anesls0trxo(r3oy1am e nvil( s2rmxm nu4apxo o3iatfm eanvp (4trxrxo io1fmtrau i s  rxmiopno4lmenmfct tf rtmx  ;u0oexo fetasfs2ea(mpn(0tlxoxf tatfpteauvols) 2toxopiy4ol emieil(fs2ra(ro;t0oltn ietlsfm umums (0texoio3oatoa  lu s;s0 2uo(opnodom   neta( a2ta(m ;t4apt mieiytfs ean on() rtoxo3oodom  lu slt0t2toxr iu4am  lfei (fs2trxmo;t0oltomfciysla2uanvp;()treoxf iodfaD  nvsls srto(o iy1openlnetas  2umx oot4tlt  i3tys s2emn snu0 exoxo tadlpDelueil()t2xmxopoo1amenlfcsa( srum( o;u1aptnmf3ilsfmDum(vo t4 ltrifcia1fpte n ols0s2trim3iudllt lnci s)aDrrxrono1tlxomo3iltls elnvsn()teenxrcoydoaDrauesl() 2triopnodaptnlivt (faDurumpnu4oexo o3tytfs uan snt) ltrmrciotla r uvolt)s2toim3nydap  lfvt s)srur(r ;u4tpe mieils sDranms;u)arxnmocoodlmDe i ols trxrio oydlp e icia()sruaxm ot0openio3tysfs2eaumont) renmocoytfpt aivsls srxrxopou4altnmncsl(fsDum(ro;t4aeenioeilt s eluvsnu0 rxnir iodlm e ieo s sexm(r3nu4lltelfvia( a2ta(moou4apeoioeias s eaumo u4tlerir3oatlmDr ivi;s)trtrio3no4om  lneia()aruax  nu0apx if3tlsfsDrl(mpnt0trenxfcia1op rau s t)trtr(opio4lm   fetlt) Durum nu0aptnii3iyd m2emuvpnt4arxomf3to1fmt li ols srumxm3nudomeelnet (f Dta(ro;u4tleomfeildlm2ul(mp;t4 etnxf totla rlivolt) 2tm(mpny1om nlfvtlt aDta(r ;o4aexomf3iyd s2rluvpnt4arxoxociatlaDrauvol(0 rtm(o3ou4lmtemfvtat)s2rm(mpoo0apxoio3tlsfsDean p;u) renmrcoadlm eai i ()trxoxm3nodlpeemivi s)sDuau o;t4alxomfetat sDulu onu0aleoif ia1oa elu s;t0teurxm3nodlme lieia()a2trurp;t4apxo oeiadfaDemu o t4aeeoio iytfaD  ivilt0t2umim nodlle mivslt) rra(ro;t1aptoiocildfa umumonu0teeoxf3tatlat lues () 2ur(r3iy4lpt mnvsa(  2tau oou4alt miciad m2uaumon(4tltoir3iadlpDr uvi t  2uo(rpio1al emnei s) rum( o;u4tlxnmoetyt mDrl( snu0 exoir3iodoaDrli o;(0 rur(o3nudomtnlfvsas  rra(m ot4oeeniieilsfa2ean s u) lxrxf3oatom  livs;() exmxo3nu1alte iesas artmxmpnt4apx  f3iytfs umn onu0 lxoxo oodla raues s  rtrxrpiu1llee fvtl()srtaxm oo0tpxo i3tatfm emnmsnu4 lenmf3todlatr uvi;() 2xm(o io1lpenlnvtlt)arrr(ro;u0oex  feias s2ul(mo u4alxrxociatlmtranes;(  etmxo3oy4amenlfvt s)artr( ont1aeen o3ils s2rm( o (0 rtrif3iytfate u o s) 2um(opiy1lpteliet s)s2rax pot0oetnif3ils m rmnvs t) eerif tatfmte i o;t  exr(m3io1apeelfeiasfaDtmur oo1tpe  ieiaslm umn p t0aeerxf io1la eau sl() 2uoim3ou1omtnlfvsat) 2tru oot4alenmoeiyslaDeanmsn(0 renxr3todfmDr u i;s0t2xmim3oy4lp n ieias)srraum nu0oltomiciatls2elumsnt0aeermo3tatoaDrln ol( teumxm no1amen neils)a2rmx ont0aee miciad m2emnvs;u0aeenio3to1late ies;t s2umxmpio1ol elfctl(  Duaum nu1aleo oeiat sDemumpn(4texomf oadomD anvs;t seuoim3oy1amtemies s) 2tr(rpnt4tpx moetls m2umnvp;t0aexrifcootomDrli il(0s2xrxo3ou4lmt mnvil()srurxmono1alt mi3tatlsDrmn s t0tlxrir oo1latranes;s0teurxm no1amtn ieta()s2raxroou0olxoifctydlaDea(vp;u4tetnirctadom eanei (  etmiopiodll  mfvia(  2tmxmono0alxo icilsfa2um(vs t0artnif3oa1omtrlivo;() 2umxrpiy1om n ictas) rtau ono1olt mictldfmDrmnvo;u0aleoxr3iytomteauei t)srurirpoo4aptnmnetas)srtmuro;t4oltn fetldlsDulu snt0 reoxf3oydlaDraivo;(  rtrxo3io4lltnmfctltfsrtr( pno4ole mi3iadfa rlu o;t0 rtnxfcoy1oaDelueo t0srtmxo no4llee icsltfaDrm(m ;o4oet  oeiyd a2um(ms;t) ltomr3oytlm  lues s0 rtrxo3iu4lmeemnvs sfaDtm( p;u1texn o3iyd a2rmu p (0tetnxo oydom   u i;()s2uoxmpoodapt lfvsl(farrmur ;t0tetnmfciad sDrlnvs;u4 lenif oydlp r n i t) eum(m oy1aleelfvsa( a2ta(mooo0altnmf3tltfmDeluvp;()tlermo3iadfp e uvils0t2uoim nudapt mics s sDtrxr ot0tlxnmociys a2um(msnu4artnirciadlptrlnes s sexm(r3iu1ameelfvtls  rraumpnt0optnifctltfs rmu s;() rxomf3tadfmt  ivi s0 rumxrpoo1llen fcil()aDtmu ooo0oex mieilsfs2umn snt) rxrxr3iodlmD lnvi;s)t2xr(o oy1om nmnvt s) 2trxro;u4tpxomo3iltfmDeln o;u0tlxrio tytfat anvs s0 2xr(rpnodlpte nvs (f ruax p;o1tpeomi3iadls2eaums (0 rtomr tatopt  n olt)s2uriopou4opeelivslt)aDra(m ;u0oetn octlsfmDumnvs t) ltoir3oy1laD  ivolt0t2uoio oo1lmtelfcilt sDta(mpou0teeo feiltla2elnmp;t) eenmfcootfa   n i;s truoxm io1ole mictl() 2ua(m ;u4opt ii3tldls emnvo u0 rxomf3ootfmt lies t) eumir3oydam nlicsas a2uaxro;t4alx  iciyd s2rm(mo;u4 ltnmrcootlm rlies s) 2tr(o iudlltn ict t)arurx  no0oee ifciydlsDelu p;t)tlerxr3oodfm   neo;s) 2xmxmpou4ol   fetas) 2rrum nt1opxomfciydla2ul(vo u)arerxo iatfaDe u ils t2xm(r iydomt micias  rum(mp;o4optoiociytlm2ulums;t0trtoxr ty1oa   n i s  rxmir3nydlpe mivi tf rrm(ro;u4texnmieiat m um(von() leoxfctodfpDrln s;(0 exm(opiudlmen ncslt)s2ur(mooo0apxo f3iad m2ulnmsn()texrmf3oadfm  ai s;s0trxm(r iydamee nvta()aDua( pnt1apx moeiytfaDem(vo (0teeoir3ta1lpDr nes s tetoimpoo1llte icil(  2tmum ;t0tpen ociltlsDrm( o (0tetnxr tytomD ai ils)trxm(m3iodol nlivsas) rtr(root1opx mf3iys aDrauvo;()altnir ia1lm e neilt0sruoxr3iudaltn neslsfa2tm(mp;o0opxoii3iad mDrm( pnu4arermo to1lpD ai i s)sruo(o3oydaltelfvt t  rtmxmpoo0aee ii3tysfsDul(vsn(0 lxnxr3iytoptelieil(0srum(mpio1amee nvtas s2trur nt0tpenmo3iaslm2ul(vo t4artnmr totlm ean s;t0truoir3oo4al n nctlt)a2rmx pou1alt ifeiat a2em(vs;t0 lxnircoytla r nvi (0s2uo(o iodll elncsasfs2um(rpnu0olxniieildfaDea( p (4 lxoircoo1opte ueo ()teumxr nu4om n icsls arrmum nt0oltnmfeiasls rmums u0tlermfcoadfpD aueo t)srxmimpnu4amt  ietas  rtau p;o0opxn i3ild m em(mo;(4aeeomf io1om  luvs s  rtmir nu1ome mfvi t aDrmu o;t1tex ioetas s rlumo u) rtrir3oadlmD  nvolt)trum(o3oydam   icil() 2rauront1tlenifciydfa ulnvo u0trerir ootoa eli i ()trtmxo3iu1om  mivtl()artm(mooo1tpt ii3iyslmDra( o;u)treoir iodomteau s;t)sruo(rpiydamt mfvs (fs2rm(rpnt0teeo feiadfa2emuvp;u4tleniociydlp e n i;s0trum(r nu4openlfes t) 2rr(rooo0aleo o3iaslsDemums;t)tlenxo3ty1fatran o;s)s2xrxm iydalt mfet s artm(mooo4opxnioctytfsDumn pn(0alenxrcoodoa rlueo t0tetmio3iodapenmietat artaxmo;t0aexomoeiatls rluvsn()tlxnio3tadoptelneil(0sexoimpio1omeemncslsfa2raurpno0alto fetysfa rl(ms;u)alenmr3iotlpD  iei;()t2tmir3oo1alt livi s)sDua(mpot0tleniictatlmDel( o u4tlerxf3todop eai olt0 2tm(mpio4olenmiciasfsrtr( pou0texnmf3iasfs emuvp t)treoxoctodfaDr uvi t0t2xoimpny4lm n nvt sf ruaumonu4oeeoifcias s2uaump (4alxrxrciodfpDr ivs ( t2um(mpoo4am nmnvtas)a2ta(m no4tptomfcilt a2emu o (4tetrxf iadfa r i o;(0t2toim nudlltnmfcsls a2ur(r ;t1alto ietys s2ra(ms;u4aexnxo tadlp  li s t0 rumxm3oo4ap emivi sfarur( p;o0apx iictysfm ul(mo u)altnmociydoatrluvo (0texoxmpiu1optelfci sf 2tm(mooo0olxnmfctad sDrmums;t4tltnmrcootfmDeaivslt0trxmxo3ny4op nmicsls  2ta(  no0oexo ociadla rm( p u) eenioctadfat li i (  rtrim oydom   feils a2rr(r ;t4alenmoeiadfs2em(vo;t0altnxo3tytop   nvi;s0s2umiopiu4op   ncia()arua( oou0opt if3iydfmDem(vpnu0 rtoxf tadopteli ol()texr(o no1apt lieia( s2rmxroot1oeenmfctltls rmumo;u)altnmf tydlp  aueslt)s2to(r3ny1ap e fvi s) rtrxro;o1teen o3tldlaDrl(mo u0tetrio totfp rlnvil()sexmir3iu1op e ivia(fs2taxmp;o4altomo3tadfm um( s;u0 rxrifcia1oat ai o (0 2to(m3iy1ame lnes (fa2urur ;u4oeeomfeias mDua( o u) rtnif3tatoaD lu sls)t2tmxr no1alen icsl(  Dum(rpno4tlx io3iyslm ra(mont0aexrif ootom elu i;s)trtr(o iodal nmietlsf rua(ro;u1tlxoio3iasfa emumsnu4arerxo to1lpDeliei;s  2umxo ny4alt lncilt)artaur nt4tpxnmfciyd a rlump;(0arenxf3oodopt ln sls)texm(m io4am n fcias)artm( oou4oeen feilt a rmnmp;(0 lxnmr oy1fa rai i;t tetmimpoydlmt  fei s srum(ro;t0olxn o3iad sDuln o () exrxo3oo1omDeli i;( srto(m3nydam elfes (f 2rmurp;o1tex if3tytfa2uaumpnu4trermfcta1latr ivslt0setmio3iy1oleemictlt)srtau  ou4tetomoeiatls ua(vs t)texomr3ootfp r u ils0 rtmxrpnodoleelnvils) Dtaurooo0apx iiciydfaDrmuvsn(0 rtrxoctydlaDranvi;s)truoxopiu4amt  nvt t)s2rmx o;t0opx  ietasfsDem( p;t4 rxnxr todoa  aieo t texoxopio4lmtn nvil()sDrmur ou4aptomf3iltfsDua(ms (0tetoxo iotfmD lnvilt)s2xoxrpoydoptemneta()aDtaxmpnt4tpeomf3tytfs2rlnmo;t)altoio iadfaD lu il( sexrxrpiu1ope licilt)srua( ooo4aeen i3tytfa2umuvs (4 rxrxf3iydfaD aivo s) etm(opiodomenmieiat) Dtmx  ot4oex  fciadfm eau s (0aetomf ty1lm ean o;t)tetrxm3no4aptelicil()s2uaxr nt1opxn o3tadfaDumnmp u) lxomr tydoaDrauvo t0setoxrpny1al nlfci t srua( p;u1olx ioeias sDumnvsn(4 etoifcta1fm ran ils) 2ur(m3iy1ap nlfeiasfs2rr( poo0tltoifctytfa uau s (0 rxnmf3oatopt  n o (0trxrio3oodopenmict sf 2taxr nt0oleoiocils s2ulumsnt0tlenxo tatfmDranes;t sexo(r3no1lptnlfeslt a2umxr ;t4olxomi3ilsla umu sn()aetrxr oy1fpDrai s;s)s2xmxo3oudlleeliciat srurumpnu0tptoiiciltlmDeln snu)alxnxr3iydfm   u s;(0trxoimpno1omtnlfctl() Dtrum no4aptniietasfm ulnvonu0arxnif3iotoateaivo;(0teurirpoo1lpt lict tfarrrumpnt4altnmfeiadfa uanvp ()tlenxociytlm rauei ()seurio3no1lpee nvil( artm(  no4tpxn o3iatfa2eaumpnt4aetrxocoodfm rlivil( t2tmxmpnu1ale lfvtas  2um( p;u4olt io3tad m2rl( on()aexnif ootfa e neols0 rxm(opno4lpe livsl( aDtmur ot1olx iociys a ra( o;(0 etrmr3ia1fpDe i i s  2xriopoy1omte iesl()arta( p;u1oeto oeiatfsDulnms;t0alerxr3ia1op rau i (0 rurio3iu1lp   fvilsfsDta( o;t4aeto fcilsla2eanmp t0 etnxf3ootla  lu s s trtr(m3oo4lpt mfcs sfarraum ;o0opx io3ildls uanmp;t4tleomr ootfm rli i t  rto(r oudamte nvsa()sDtmu onu0tlxn fctat a ran p;t4arxrmo3tatlateli i;t s2urir3iodap   ncsl() rtmumpnt1tpt mf3iys mDrl(mo (4tetnio iatfm rai ols) eumxrpiu1oltnmnctls)sDrrxmpnu0altomo3tasfsDrl(mo u0 rxrxocio1lmt lieil( srum(m3nu1lle  icils)sDua( poo0tetomfeiaslaDra( snu)trxnxr iotfp r uvils) 2xrxr3nu1ol e fvt (fa2rmxmoot1texomf3ilt m rmn onu) lenxo3todfa ean sl(  rtrim ou4olt mnvta(  Dtax pnt1alxn o3iltls umu p () lxnxfciydfmt  nei t  2tmxr3iy1lpenmfeslsf Dtax  nu4tet  i3iltfsDem(vsnu4 rtoxf3oo1omDean o t0teumxm io4aleelfcs t  rurxmpot0aeenio3iasfs ua( o;t4aexnmo oa1lm elieils  exmimpou1ale mnciatf rrrur ;t4aeenmfeiatfm um(monu0texnir todlaD ai o t0 rurxrpnu4lpteliei s)srrr( poo1tpeo ictyd m2em(mo;u4tlenmf3tytlpt  ies;s0s2xoio3oo4op e nciat  Dra( p;o0alenioeils a2rlnvs;t0 ltomr3totfmDran il()sexo(opiudame  fcsa(f 2ra(  ou1oltoiociydls emn p;t4trxoio ia1omt  n i t0 rxr(r3oo4omen fvt (fa2uaxm ;t4aetomo3ils m2rmn s;()treomo iatoat livi;s) 2xoirpnu4aleelneias arumur oo0texomfciltfmDumumo u0artniocio1lm   uesls) eumxo3oy4lltn fcsa(fsrumxmo;o1opx io3tadfm rauvo t0trtnxr oytla ran i;s  rxrim3oodap nmfvslsf Dta(r nu4tee  feiasfaDua(mo t4artoif3iytfmDe uei;t)setrimpnydop nlncta( a2ta(m ;o4tpeoiiciytla ranvs (4altrmr iadlm r n i s0s2xmim oo4omen nes t  2tm(  nt0oex ioctas a ranmsnu0 rxoxo3iotfmtrlneslt)tetm(m3oy4oleemnei s s2ua(  ;u0oexo f3tytfa ua(ms ()aeenmf iodfptrluvols  2xmxm3nudapt mfesas) rum(mpno4apeo f3ias m rmnvpn() rxnmo3tatla  liei s0s2trxrpnydam e icsasf 2urx  no4opxoii3ils sDemnms (0 etomrciatlaD  i olt0 rurim iy4llen iet ()a2tm(m nt1tex  fcildfs2emu p;t)trtrmo3oodfa r nvs;(0 exrxm oo1al emnvsl() Dur(rpnt0oee ii3tltla umums u0tlxrifcio1faDrlueils s2uoxr3no4lmee nvs ()sDrm( o;t1tlen fetytls2ul(vpnt0aetrmocta1opD au i t)trurxo nu4lp nmnvtl(  rua(  nt4teenmicils mDul(mpnt4trxrxr3tytopDe ues;s  2tm(o3iodlpee ncta() Drmxro;u1optnif3tltlsDrl(vpnt0teerioctotom ran o;() rumxm ny4ap e ncils  rrm( ooo4tlt ii3iat aDumnvs;(4tltnmo3iydop r u ils)setmxr3nu4om nlics ( sDtaum ;u0tpxo f3ils aDra( p t4altoif iotfm  aiei;( trtoirpiu4amee iesl(  rra(mp;o4ale iocildfsDrlnmp;t) lerxf3tatfa   uvi;s0setrxo iu1opee nct t) 2rrxmo;u1tltn fcilsfm ra( onu)aexomo3iytfm  luesls)srxrxo oo4aptelnctl() 2trxrpoo4tet  feilsls ean o t4arenxf3oodfm r ueilt seumir3nu4ale mfvs (fa2trxroou4alx mi3ias m elnms;(4 renxf3iatlmD luvs;t)srxr(mpio1om   nvils)sDum(r nt0tetn fctyd s el(vo t)aetoioctodfmte ues;t)s2uo(m3io4aptelfeiltfaDum(rpoo4tet if3iasfm emnmp u0 etnmr3oadoptrln o s0seurir ou4optnmnesl( srta( p;t4tltnif3ilsfm ulnmsnt4aetnmfciytlptelivs t trxrio oodlmtelivi tfaruau  ;u0oet miciltfa umuvpn(0 lxrir3oytfmDraivi s0 2tmir3iu1omenliesa(fa2ua(root1tetn o3ild s2uanvo u4 exnifctatoaDr nvol( setoxmpou1opeelnesatf rraxmoot4texoifetyd m el( onu4teermf3todoate ivolt0setrim3ny1llte fviltfs2rm(m nt0tptn o3iadlaDrl(vo u0arxniocoatfatrai ils)s2uoxrpno1ol  lnvi s) ruaxmooo0aet iocildfs2rm( pnu4texnmfcty1fpte ueol()t2xoxo oy4lmeemnviat s2raurp;u1optnmo3ilt sDrmuvo;()tlerir iatfaDeluei s0t2tm(rpoo4lptelfcias srrm( ont1olxoio3iyd m2ulnvsn(0tetrmr todom eaueo (0 etmim iy4lp e neiatfsrtaump;o0olt mi3iatls el(mp;()artoxo3tadfa eai s;t)setm(o3io4lmeelfcias) Dra(mp;u1aetomf3ias m2rluvp t4 eeoirciytfa e nvslt0 2urio ou4omte ivtl() rrrurpoo4tpt if3tlt a2um(vs;t4trermo3ia1lat luvol( srxr(opoydapt mnci () Dtaxmpnu1openiieiydlaDra(vp;t4altrxrcio1fmDeanvsl( teur(mpiy1ol elicia(f Drmxmpno0tlxoioeils sDuln s () ltoxr3iotoat  u o t0srxrxo ny4opt  neil(fsrurur nu4tleo ictysfsDel(vpnu) leoifcto1fmtrlneil()t2tmxr3ny4om  lnct tfsrrmxm ;o4apxo o3tadlaDua( s;t0arxrxo todlm rau sl() euo(r3io1opt lnetas)s2ururp;u1tpe ioctas m eanvp (0arxnmo oo1fat an s (0 ruoxo oy1lpee ncsls) 2rrx  nu4tee  fciadfsDul(mp;t) rtrxf iy1oatranvi;(0 rxrio oy4ope mfeta()a2trxmpoo1aee  ietys sDra( pn()aetrmf3io1omDr u sls0t2xoxr3oo1altnmict tfsDua(  nu4teenmo3tldlsDel(vo;u)aetoir3oodlpDelies t tetrimpiodapeelncs ()srtauroot0oet mfciytfsDum( p u) rxoxr totfp rluesls) rxmxo3iudap   fetat)s2trumoot1olx  feiys aDranmp t0tlxnir3totfaDr u s;(0s2uoxm oy4ole mfvs t  2umum no1oex iiciadfm2ra(vo;(4 eeomr iatlm e ueo;s  2xrxo ny4lmt  ies t sDrr( p;o0texnifeiat m2uauvs u4 eeoxr io1fptrlivi t0setoxrpio1lptn fci (  rrrx pno1tle io3tlsfsDean onu) eermrcia1fa elueo s0s2uo(o3iu4apenmivt t aDrr(  ot4tptnmfcildfsDumn onu0 rxnxr3ia1om  ln s;t0t2trxo3iy1op elfvslt)sDrru pot1aexn o3tydlmDua( pnu)aeeoif3iadlaDelneo;s0 2urxm iy1amenlnvsl( aDtmur oo4aetnmo3tldlm2rau s;u)tltrxrcoa1op ran i ()teumxopiu1lpt lies tfa2uau  oo0tpto ictat mDeln pnu)tltoxr3iy1lpD lieo t  2trxo ny4oltelncsatfaDra(m ot1opto iciat aDuln p u)trtrxfctydfpteai ilt0srtoxr3iydam   ivt ()s2rmx ono0apto ociydfm em(mo u4tlxrmf tydfmteaues;s teum(rpoodap nlies s)srraumont4oltnmfctasfmDeanmo (4tetoxr3tatfp ean sls0 rxmim oodamt  fcs s)aDtmxm oo4oltoiiciasls2rlnmo;(0aexrmociydfaD ai s;()s2xrir ny4lptelies (  Dur(rp;t0apen i3iyt aDeauvo t4 eenif iytlptranei t s2urxo3ou1ameemnciat  rraum ;o0oltomieilslm em(vp;u0tetrmoctatlpDeai slt)sruoxr oo4lmenlneiatf Drmu  ;t1tpx  ictat s emuvpnu0artomo tatoaDranes;()sruo(opoy4op  mfeil() Dtaumont0olt moeildfa2rmn p;t)treomf3oodoaD aneils teto(r3ny4ameemfci sf 2rax onu4tptn feiyt sDelu p u4 rxnmf3oo1fp   ivi;s0srxoiopiydopeemfcilt  2ururpnt1apxnmfctysls2emnms ()arxoxf3io1om elnvi ()srxr(m no4ll   fct (faDrr(mo;o4opxnmf3tad aDrl(vsnu0 lxrif ta1lpDelnvs ( sexr(opiydol emnvilt)a2ua(  ;t0tpe ioetasfaDrlums t0tleriocoo1omDrauvi s) 2umxmpoydomtnlnvtls artau  no4alen f3ild m2eauvo u)alxrxf3oatoaDrluvil() eur(r nudlm e icslt)sDtmu o;t4oet moeiadlm eanmo u4alxoir iydfmDr u i;( srtr(m3nodal e ies ()aDtax p;t1tpt mo3tydlmDum( p (0aexnifciadfmDe iei t)setm(mpoydomen iesas)aDum(mpou0oex mfeiyd m uan p;u)aexrxo3to1la  aivo t) 2toxr iy1lmeemivta(  Dtmxrp;u0tpenio3iadfm2rauvpnu)aetrxf iotfa rlneo (0teurxrpno4apeemfei ( aDuax pno4alen ictaslsDrmn o;t)tlxoxo ia1faDelnvo;s)truoxopoo4lm nlnvsltf Dtr(mono0tetn ietlsls2ranmsnu0texoxr tytfm elu s;t seuoxm3iu1am e ivi (  Dtmurp;o0altn fctldfsDrmnvon()alerif3oo1fm  livol( s2xmim ny1ap nlivt s)s2rr(rpno1tpe if3iad a2ul( o (0alenxr3ia1oaDeluei t tetm(o3oodlle  nctasfsDtrum nu4oeenmocilslmDrmums u) etoio tytlmtranvi ( trurio3nu1ol  mnvi sfsDtmxroou0altnifciltlmDemn snu0alenmo oadfaDeaivs s0trurxopoy4ome  ivsls  rrruro;t1olt ifeilt m ulu pn(0 reoxocoy1op rlueolt srumxm3ny1lp n ivtltfaDtrur ;u4olen oetas m um(ms t4teenifctodlat  nvo s0srtr(o3oo4ale  ivi tfsrtrum ot4oeen ietyt a2rlums;t0tlxnxocoytopDr ueo;()trxmxrpiudlp  mict tfaDtmur no4apto octltfmDum(ms;t) lxoif3oydomt lu o t0tetrxr nu1lm  lfvs t)s2tax poo1tpt mfcildfs2ua(vp;u0 lenif3io1oate nvs;()trtoxo3nydalenmnvt t) Dumurpou4tex  f3iydlaDulumsnu)areoir3tytomD  ueo;s truo(m3oy4lltnlncsas arrmxmpot4tlxnmictlt a emumsnu) lxoxo3totop rln s;(  etmim3oydlpe mieiat)srrmxmoou0tpx  octysla2eauvs;t4alxnmo3totop  auei;s  rxoim3oo4lp  lfesas s2ur(  ot0opxniiciydlaDeaump (0tetnioctydlpteliei () euo(r3nu1opee ies sf rtrx o;u4alxomi3ilt m2rmnvs u0 leomo3iatoa r i sl(0teurxm3iudal  mfcsas)srtrum ;o0oee  o3ias m raumo (0 lxnir3iytfmt livo s)s2um(opoodlmeelnei sf rra( p;u0oet  i3iyd s2ua(vsnt0trxoxrcoa1lp elneo s)s2xo(m iy1alte nvs tf Dtaum ou1oetn o3iydla2rm(vonu0alxnxrciadfptran ol()srtmxm iu4al   nviasfsDum( pnu4tlxoiieildfs eanmsnu0 eenxociadop  anei s0s2xmxo iu4am n netltf Dua(moot0aetoii3iytfa2uluvo u) leoif3iy1fp e ieo;t)srumirpny4oltn iciatfsDtmurono1apenmfciad aDelnvo;t4alerif3oatomDe nvslt)s2urim3nudlmte ivi tf Dumumpou4teenmo3tasls2emnms u)tlenmr iydlm eaivsls0t2tmir no4ap emnvia( s2uaxmp;u4teeo o3ildfmDelumsnt) lxoxr3iodlmDe u s s) 2urxopiodom emncslt aDtm(m ;u4tlxn f3tltfaDrm(vpn(0trtrmrcoatlmDeanei t)seurir3oy1llenlnes ()s2trurpot0tptn ociltls2ua(vsnt4teerxf3tytoaDe ueo t) rxr(r3iydal elfvs s)arua(  oo1ape ifciasfsDrlnvo;(4trtrmr to1latraneil(0 ruriopio4lm n ivtl(fa2ururpnu1opto fciyslsDuau o (0aetrmf3iatoate neilt)trtrir nodal emfvtls s2tmxm oo1teeoiicias mDrluvo;() rxoir3ty1oat  nes;s)s2tm(m3oo4ol  liet s) rtau o;u4tlxnifciasfs2ua(vp ()altoircootfptrln o;t texrxopny4ale  iviltf 2rrump;t4apeo fcildfsDul( p;t4altrifciadoatran i t trxo(rpnydlm nmieilsfsDururonu4tpe  o3iaslaDemnmp;t0tltrio iodlatelu ils  2ur(r iudaltn ivi ( aDtrump;o4apx  octytlsDelnms;()aetnmf ootlaDeln sl( t2toio3nu1olt mnvsl(f rtru pot4tltnio3tyt mDumumsnt)aeeomf3iadfaDeaueilt)t2uoim iudap   ncsltf 2tau  oo4tlen i3iad mDulumpn(0 ltrir oodomDe i ils srtoxo3io4lpee nvi sf rtm(mp;u0tlx mfciysfs rlnmont0artrmr3iydfat luvi s0truo(opiodlm elieslt) 2urxrp;o1opeomietadfm rl(mp ()artnxf3tydoaDrlnvs;( srtrxm3oydll   fvsas)s2ur( oot4texnifeiyd a2ul(vo t0altnxo3tytfa eau i;t  2tr(r3iodapeemivsa(f 2ta(  nt4apx mi3iydfs2ulnvp;() etrxo tadlm r ieslt0srur(r3nu1lle liesas  rtmxmonu1tpe moetydfs2ul(vo;u4 etrifcootfatrauvolt0 rum(mpnodam n ncta() rtrxmpnt0oeto feias sDrl(msn(4altnxr oadomDeanvs s srtrio iudlp nmnvta(fs2uaxr ou0ale miciysfmDulu s u) eenxfctytoa e nvolt0s2xmiopiydoptelfcsat) Dra(mp;u4aex mf3tys mDelnmo t4aetomr3iotfptean sls0t2trir3io4oleeliesa()aDtrx pnt0oeeomoeildla emumsnt)tetnxf3oa1omDr uvi;t)setr(rpiy1openlfvtasfaDtmxmpou4ape  oetlsfa2umump u4teermo ootfa rau o ()srxo(m3iu4oltemieiatfaDraumonu4aetnmoeiysfs2em(vpn()tltrmo3tytfmD  i o;t trxrio nydlp elnet sf 2raxr oo0tlt mfetltlm2uauvon()trtoif oodfp  li o ()srtmxm3no4lle mfcsas aDumxro;o4olto ieiltls2emuvp t0 lenmo3todfmtelues;t  2trio ny4om elfesa(fsDtau p;t4tpe  ietltls ra(mp;u0teenifcoytomDean o;(0t2urio3iu4apeemncsa(fartr(mo;u0tle ifciydls raumpnt)tlxnmr3oytopDelueolt0seurir iu1am   netat  2ra(m nt0tptomoctlt a uauvonu0teeoxr oy1lpD li s ( trumxopny1ope lfeslt  Dtr(rp;t0aptoioeiasla rluvp;u0arxrif3ia1oat aneils)t2tm(r3iodlm nmfei s) 2ta(rpno4optnif3tydlmDeaums u) rxnir3todomtr uvo () rumiopiy1lmee nvt () 2rmumpnu4oex iicildls2umn pnu0texomociydoaD aueilt0srtm(o ny4lle lncsat) Drru ooo0tlt  ieiatfa ul(mp;u) lxomr ta1omDranvs;(0 rxmxo3oy4op  lfetas) rrmx  ;o1oee io3ilslm2uanmsn(0 lxoir iy1fp rlneol( seurxm no4lpenlivta() Dtrxrpnu4aptoio3tyt s2elu o;t4teeoxf iotfate n o;s seurio3ou1amenlivta( aDtmx  oo4alxn ieiysfa2ea(vs u0aetnxo3ia1lmtelu ols) rxo(r3ou4omtelnvt s s2urxr ou0opeo feiyslm emump (4trenircio1oateaieo;s0texmio3no4ol nmivsas arra( ooo1oet ioeias sDrlnvp;u4tlxnxr3iatfm eau o;(0t2xrio3oo4ole mfei (fs2um(
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;(  2xrxo nudaleemnciat arur(m ot0aptnifcilt mDrlump;u4alermr3oatfmD aueo t setoirpnu4lleemfctls  rrmur ot0olxnif3ils mDumnmsnt4teeoiocoadlpDrau s t texrxr3ny1am nmnvsl()aDtmum oo1tpenii3ildfaDranvo u) rtnmfcto1op elnvs () exrxm nudom  lnci sfa2tm( oou0teen ociysfa2um(ms t)trenxo3tadomDrlnvsls0srum(rpnu1lpeemfvsa() Drau pot0olx ifetlslmDrmuvo () rerio3tydlm raieolt setr(opio1lptnlictl()aDumxrpoo1oetomfcilt s em( p;() rtomr3tytfaDr n o (  euoxm3ny4op e nes s)arrmump;t1apenmi3ild m2emumo;t0trtnircoytopDrln s;s0trtmxo no4ome mnetltf Dtaxmono0opx  fciadfs ul(vpn(4alxrxo oa1fp  aivs;(0sruo(rpiy4omenlict ()sruaumont0tptoiietadlsDeln p;(0teermocoydopD  n o ( truoxo nydame  nvsl(f Dtrxm ou1tex  o3iyt sDrau o;u4tlerio3iy1fmDeanvs;s)trtmxo3oy1apte fcia( s2rr(mpou1opxnif3ildls2el(mo u)trerif tadfp r nvi ( truoir3ou1ll  mnctasf 2uru  no1tetomoeiadls elu onu)aeenmo oo1opDraiei;s s2umxm3io1al nmfciasf Dra(r ou4aptomociatla eluvo u0 reniocootfpDelieols0 2tr(r3iy4ap  licsatfs2tax pnu1tlxoii3tatfmDea( o;(4 exrxo ia1fm eauei (  etrxrpiydamtnmici s artm(rpot0oltoif3tatfmDum(vo;(0alxrifciydfp rlueslt t2tm(m3nu1optnmfctls  2urxrp;u4aet ifciysfm2ean s t4tleoirciy1fpDraivi;t  eurxr ny4lmee ivs ( aDraxrpno1apt iieiad a2ra( pnt4tleomocio1omteaies;(0s2tmio3iu4apee ies ( aDrrxrp;u4oeenmo3tldfa elnvp ()arerio3iatop   n s (0tetmxm iydlpenlnvsa(  Dtmu  ot1tlx mfcildfa2emu p t)tlxoifciytlpD  ieslt srum(r3ou1aleemicilt arrrx p;o4aex mictatfa eanvo ()aexnir iatom  livi;(0trxoirpoy4am e iei s s2ra( ono0texo ieilsfs2eau p;u)aexoif3oodlatrluvi (0sruoxm oy4al n neil() 2urx  ;o4olt  feiaslsDul(vs;u)arxrmr3iatlat lieo (0 etoirpno1am n fci tfsrtax  nt0opxn f3iysfmDra(vo;(4trenxrcta1opt anvil(  rumxm oo1lpenlnctat)s2urxrpoo4tpt mfeiasla2rln s (0trenmr3to1oatr ueil( srur(o3iudap nlfvt t)a2tau onu0tee  o3iysfm el( pnt) ltnxocty1oa   iesl( t2xrxm io4oltnmicsl( srrm( pnt1aleoifctatla rmuvo;(0tlxnirciydlp rliei;s0t2xmxr3iudam  mnct (fa2rrxrpno4oexn fetydls2ul(mpnu4tetrircoytlpte nvsls)t2to(opoodalt lnciatf 2raur ;t0aptoif3iat m rmuvsnu0 rtnmociytopDeanei;s  rxr(r3no4op e ivi t s2urx ooo0optoiictydlmDrlnmo ()altrxo iydfmD aivo s teumxo3iy1ameelnesas a2tru o;t0tleo oeiad s emnmo u4aetrmo3ia1oaDeluvs t texm(r iydolee fctatf rtru  no4aet mieiasls rmnms;t0 exoif oatfp e n il(0t2toxr3iydom n ivtas)a2urxm oo4alx mo3iaslm el(vp;t0tlxnio3oy1oa r ies;()t2umio3ou1lmenmfvs (f 2taump;t0tpe ii3ildlmDrau sn(4 ltnxr to1fmDr ieo s t2xo(o3oy1ll e iciat  Dtm(ro;u1openiieiatfs2ua(vont)arxnmf3iy1optelivs;t)srtoim oydoltemfci s)aDrm(mont1olxniocils s rmnvonu4arerxr3tytfmt  u il()s2toxopoy4al nlnvtat)s2rau p;u1aptnmiciatfa2elnms () ltoifcoatfm ran o;() 2trir oudlpe  net tfartmu oot4olxomoetlslm rm( snu)alxrif3iodlpte nes;t  2umir3nydamenmfeiatfs2rruro;t1tpxoiietysfm2rauvo u) rtnmr3oatfp r ies;s t2urxo oodop n iciat)sDua(moot0tptnmictldla2uanvo u4aetriocoodoate iei;t trxmxr3nudoptnmfctl()aDrmurpnt1apt iieilsfaDra(mp t4trxrir tydlptrau slt) rto(m3oy1amen nci s)aDraum no4olto i3tydla2rlnmsnt0tlerxocoodlmtraivsl()t2xrirpnu4lpt  fvi ( sDtmxmoou4teenmociadfa rmuvont0treomf iytfmDe n i s t2umim iy4lpen ivtas  Durxmpnt4alenio3tyd a2rlnmont)aexoio ty1om r i s (0t2tm(rpio4omt mfctat)s2taxm ;t1texoiociatfs rmn p;t)aleoifctadfmD lieo s)teuoimpoydlp elicia(f 2uaum nu1tpeomfeild a rl(vonu4texoxo tydop rli i ()seuo(r nu1ll nmivt sfs2ta(m ;u4texoiietys s emu o t0 rxnmrciotoate u s s)s2xoim3iodll emfvilsfsrta(m ot1tltomoeild mDrauvo t4aeenmrctodfaDrluvs ( srtm(o iy1ale livt tfs2taxrpoo0opt mfetlt s eauvs;u) exoif3iotoa ran sls) 2uo(opnu1ap elict t)srraum ou4tpen iciyd mDua( s;u)altomo io1fmte nvi t)t2tm(r3iu4amt lies () Drmxr no1ope  i3iltlm emn s;u4tlenmr oa1lp rau sl()setoio oodomeemnctlt)aDtau  ;o0optnmi3tyt aDumums u)alxnmo3iydom eanvils0 eumio3iy4olt  nctls s2uaxrp;t1apxnif3tyd s2rlump;(0 rermo3tadlatelneol(  2tmiopoudalt  nvt s aDraur ou1open oetatla2rl(vp;u) rermf3iotlaDe i o;()srtoir io4lltn feiat)a2tm(mp;u1aex mo3tadfm um(ms;t)altoxocoatopDrlnvo s)teurxopoy1lpeemnetls aruru o;o4oetnmo3iadfa rmu pn(0tlxnxo oy1oateluvs;s0seumiopiu4op nmfvtlsfsrrm(r ou4tleomo3tytfs2ra( s;(0aexrmrcoadlptrauvo () 2uoxmpiy4omtnlnvt ( aDtrx  ou0tlxomociys mDranmpnu4aexnxr oytoptrlnei t s2uriopiy1al nlnvs s arraum oo0apxoioeiat a um( s u0altnmf iytfa r iei;s)srtrio ou1ale  nctls arrruro;u4tetomiciyslm2rmn onu4aeeomo3ootopDr nvo;(  rtoxr3nydol nmivi (fa2um(mpnu1tex  octatlmDemu pnu0texomr3ootlmDean i;s)trto(r oy4lpt mivsa() rrrxr ;u4alt  iciys aDumn o;t) rxrxo tytlpDrauvs s)teur(rpnodomtemictl(f 2umu o;o4aex iociatlmDrlnmo;t0texrmo3iydlateaivo;t tetr(r3oodapenmfvil(faDum(moot4olen feias s2eanvpnt)altnxo3oytlmDeaivs (  rxo(r3iodolt  ietat)aDra(  ou4oexoioctasfm2ulumpnu4 rtnirctatla r ueo t0 rur(m3no4lp n fvils)a2tmumpnu4oetniociytlaDua( s u4alxoxf to1oaD aivo;()seuoimpnu4oltemict tf rtau oou0opt mo3iytfm el(mo;u0 rerif oo1op   ivol(0s2to(r3io1aptelncils sDururpou4apenmi3tysfsDea(vo;u4tltnxo todfmD auvi;s texmxm3no1lp nmfvslsf Dtrx p;t1tle mf3iytlm eauvo;t4tlxnir ootlmDelivi s t2ur(opoy1ape lfcsasf 2ua(ro;t0aet  ocilsfs eaums;(4 lxomrctatfptran o;t0trxoimpiydamt mnvs t) 2rm(ronu0tlen f3iat sDemu o u)alenmr ty1lp eluvs s sexoxrpou4lle  nvs (  rum(  nu4alxn feiydls2emu p u)trxnmocoa1fmD lneslt  2tm(o3iu1al emnvilt)srrmumo;u4aptoif3ild s eluvp;t0altrxo3oadlmDrlneslt texrxr3ou1amenmieta()srrruro;u4oexnmfcildfmDranmsnt4arxnxo ty1omD  nvo (0 2umxo3no1openmivilt srrrx oou1apenio3iydfsDulnmp;()tetnmr ty1faDr uvo;( t2ur(r3iodolt mnvta()s2truro;o4aetoioeildfsDra(ms (0tlxnif3todfptelu olt0 2toxo3oy1om   feia()aDuax o;u0apxo oetlt a2el( pnt) rtoxfcty1la elieo t teum(r3ou4optnlieia( sruax  nu4apeoiiciyd m2uaums (4 ltnif3tadla ranei;t)s2xm(o oy1lmtn fcsas) Duax  ;t4tpxo ocildlaDrmnmp ()tlermf3iatlmDrln slt s2tr(mpoy1lmtemfciat) Dumxrono1aeen ocilt m rmuvo ()alxnif3tadlaDrlneols  rtrxr oo4ol emnviat srrmu o;t0oex iietys s2ranvsnt0trxoxocta1lat  neo;s0trxoxopiydolee ivilt sDrrxrpot0aexniiciytfs2ranvo;t4 rtnif iodom   ues t0trto(opnodalenmnviat) 2trxmp;o1alxnmociadlmDrmn p;t) ltnif oatfm eln ils0 2um(rpou4lpenmncs t) rra(roou1tpxn f3tas a2umnmont)treoxo3iy1fm ranes;t0seuoxrpnu4ol nlncia(f 2tmxrpot0apto oeiaslmDul(mo;u0aeeoifctydfp  an o (0 rur(m3nudapen ivtlt s2urur oo0tltniiciadfa2ulumonu)alxrxo oytfa rau i s setoiopoodam emnvi sfsDrmu o;t4apeomoctls a2um(ms t4 lxnxo3ta1laDeauei () exrxmpio4apt  ivslsf rurxr nt4aet iietyd m2ua(mo t0 rxrir3oydla  li i (0s2umxm iy4om emfvtl()arrm(rono0aexomi3iasfsDulnmpnt4trxrif3ty1lpDeaiei;s0t2toio iy4llee ies (f rtmu oou4aleo fciasfa rl(mp (0teenxfctadomte ues;() 2tmxr3oy4oltn iesatf 2rm(r ;u0apxo iciydfa rm( o;t)aeermfcoo1omt li o;t setoimpny1olt mict ( sDta(mooo0tlto icild sDemuvs;t0trxnio oatfptraies (  2uriopoy1al n fetl(faDtr(  ou1aeeoifeiltfs umnvpnu4aexoxo oadfaDraieol(0s2tr(rpnudam  mnvi (fsruaurpot1tlxnmfciltls emnmont)tltniocta1latelnvi;s trur(r3oodopt mfcs s) rtrxm ot4tptnmo3iaslm rm(mp;t0 rermf3oo1omD  ies;( sruo(opno4al elncsl(  Dtmuro;u0teeo octytlm2rmn o;(0altrxocto1oaDeln o;t  rtoirpny4omte fcsatfsDtm(mp;o4oetoio3tld m2uanmp t4aleoircia1lm rli o s0 eum(mpoo4openmfeiat aDtmx poo0altnioeilsls ulums;u4aexrif to1omDeanvi t)t2umim nu1lp  lnvtas s2umxr nt4tlenmoeiasfmDean sn(4altrmf ty1fpD an ils  etmxm io1ale lnetl()a2trx  ;t1alenifetad a ulnms;u)alermr3oydlpteliesls0s2xr(m3iu4al  mnesasfartaurpoo0aeen iciyd m rmnvo (0 rtnifcoatlate ues s)s2xrxo3ou1lm e ieias)sDrau ono1oltoioeiadlm2rau ont0 rxoio3iadfpDrluesl() rur(m3nydal  licsl(  Dtmu ono1aptomociyd mDemumo;t4trxnmr3iatlpte uei;s  euoxm3iu4omen ictat)s2taxm oo1tetniociysla2rlu pnt0 rxnmf oodlaD  ivo;( teurxm3ny4am   nct (  2rruro;u4alt mieilslsDua(mo ()alxnir tydla  liesls)t2ur(r3nu4lle  ivilt  rtmuronu4oee mfctlt a ea(mon(4 rxnxrcoadoa eai o s) rtm(m3iu4lle livia(f rtmxmont4tlenmiciatls2um(vo u4 renxo tadlm  lu o;s) rto(o3oo4amtnmfvi (faDurx pnt1openii3iasfm umnms;u)arermrciotlptraivi t t2tr(opoy4lmenmncia()a2rmu ooo0opt ifeiatls rl(ms;(4 eenio oydopDrluesl() eto(rpno1ll  micsa(fartm(ronu4tpeomfeiasfm elnms u4artrmrctotfm eli i t0 rur(rpnudomtelietl()s2uau oou1oexnmiciys s rau snu)altomf3ootlp  ai ols) 2toxrpio4ol  mnviat) Drrxro;t0apeo fetyd s2em(vp t0 eermrctydfaDelivo (0setrir3ou4lmte ivsl(farrrurpnt1optoio3taslaDean p u0tltoir3oo1faDr nvilt s2xmxrpoy1al n icia()aDua(mpnt4aee mictaslm eauvp;u)trenmf3oo1fa r u i;(0srumirpiodaptnmnctl(  Drmumpot1tpx mf3tas sDelumsn(0 rtriocoodlmteluei ()trxrirpoy1lp  lnvt ( a2rmxr ;t1oet mfctasfs2rmn p;u0 lxoxrcia1lp raieilt srxr(o iudllt  fvtl()a2rmum ;o1tpxnifeild s2uanvs u)texoircootlpt  nvs s0tetmxo no4ame  ieil(fsDrrx  nt0alen ictytla ranmp t0tlermo tadomDrlivsls)t2xm(rpou4olenlnctat  2taur ot4tpxomieiysfa uan pn(4treoiocoydlm elnvs t0s2trxm3iodoltn nvils)s2rrx  ;t0apt mociltfsDuaumsnu4trxnmf3tytlmDean i ( s2um(o oo1am  lfvtl( a2trxrooo0alto octydfaDrl(vs;u4tlerif oydfpDrln slt0 rurxm iu4al emies ()aDrr(rooo0aetniietytfs rm(von()alxoirctotoa   neilt  euoio iu1ol emfvt sfaDrr(  no0olxn fcils m2rmums t4alxrxf iy1fpt  u i;(0 etoirpiu4opeemicsl(f Duaumpnu4opx  feiatls2ra(vp;u4areoxo3iatfp   ueolt)t2xmimpoo4lm  mfci tfarua(ront4texoiociysfmDrl(ms t)artnxfcto1fatr u slt  2xoir io1oltemfctas)srtmur nt1tlxnifeiltfm2rlu p t4 eeomr3oa1op rln i t sexoimpoy1lltn iei (fartau ont0texnif3iatls ulu pnt0areoxo3oytfaD  i ol() 2xmxm3oudaltnlnciat) Duau ont4tptoif3tldfm rm(ms t) rxoxrcoatfm   ivol(0seumim3ou1lltn neilt)a2rm(m ;u0teeomieiadfa2rlnvsnt) lerifciytlmte ivil()srur(m ou1om  mfesl(fsrtaump;t0opxnmicilt sDrauvo u4trxomf3tytlmDe i sls0trtmxr3iudoptnmfvta()a2rmx ooo4tpxnii3tys aDrl(mo;u)tetrmo3tadom rlnes;s)t2xm(m3oo1lmt mneiat) 2rr(r ou4olxomoeiyd a2rauvs;t4tlxrmr iatlmtrln ils sexrxr io4lmeemivt () Drr(rp;t1oeeoio3iytfs rlu o;u0trxnio io1fpDr uei;t0 2tr(r oodlm  mfet s)srrru p;u4opto fcilsls rmn p u0artnio3iatlmtrai s;t  rto(r3iydomt mnesa(fsrua(rpot0oltnmo3tld aDulnms;(4tleoif3todlmt anei;()seuoio oudape micsl( s2ururont4tpeoioetadfs raumpnt) etrmf todlmD au ilt0trtrxr oy4open fctlsf Dra(r no0altoiicildlsDelnvo u4 rtrmrcootfpte u i s)t2xoiopio1llen nvslsf 2tmumo;u4olx iiciasfmDrmnvo t4artrxrciodomt  ueolt0teum(m3ou1lltemiviasfsrurx  ;t1aetoiicildfa2el(ms t4teerxr3tydlmteaivo;s0 2xmxopnydamt mivta()sDur( pno0tlenifeiasls2emuvp;t4tlerio3io1oa rlneo t sexm(r3oy1oleeliet tf Dua(mpno0aptniietytla emu onu0tltnio3tytla e n il(0trurio no4ol e nct () 2rrurp;o4opx mf3iys m rl( s (4artoxocoy1lm  auvi s0 2tmir3iudalt  fvt t  Drrxroot4opx moetldls2elu p;t4arxrxociydomt luei s0 rumxm iu1amte fes t aDta( p;t1tleomiciltfsDrau o t)aeenmociy1om r ivi t)s2xmiopiy4lp nlicilt)arrau  ;t1aexo o3tydlmDrmnvo;t)trxoir3io1lp e ivs s) rur(m3iu1ap nmnesa()arrr(r ot1oet ioctldfs emu s;(0artrif oytlpDelieils sexriopiodoltn fei t aDrmxmpnu1oee  iciaslsDelnms;u4trtoxoctytfmDeluvi;s  2toir3no1ale mictlsfsDtaum ;o1oee mfcilsls2ul( p u0trtnxfcoo1fmt anvil() 2xrxrpnu4ap nmfci s sDua(r ;u4ape mo3tys a2emuvs u4 etoxf3io1fp rluesl(0s2tr(o3ou1altnlnviasfsDum(  ou1tlxoifetltfaDelnvon(0aexnio tytfa raivsl(0 rtoxrpno4altnmieia(fs2tmxr nu4oetoiieildfs2uau s u)alxomf3oydomtr ueilt)tetr(r oo4optn netltfarrru ono0oltn o3ild a2ea(mp;t)trenir oo1op r uvi;t  exm(r3nydoptnmivtat)sDrmuro;o4tltnif3iadfm2ul(mo;t0trtomrciodfmD  n slt0srxm(rpio1lp nliei sf Drau  nu4oetomicild a2rau o;t)trenmoctytfatrlu sls trumimpiy4lleemieilt) 2taxmpnu1tlto oetydls rmnmp;t4 eenmo io1lpDr ieol(  etmio iy4lme lfet s  rtaxmpno1opxn ictys aDemn o u) eerio ia1lmD  ivsl()sexrxopno4lmtn ivs sfaDururpot0alx mf3iasfa2elumpn(4areoxf3tydopt auvs (  rto(r3io4amt mfvs tf rrru  ot0oltnmoctytlm2umu p;t4 rxoxf oydfmtrai i;s0t2xmxm iu4am e fes tfa2umxr oo4oeen o3iysla2umnmsn()aexnxfcia1fpt  ieo s) etrxm iu1lmenlfvils) Dtr(mpnt0tlxnii3iyslsDra(mon(4 lxnif3tadlpt aiesl(0s2uoxmpnydll  micilsfsrua(r no0teeo octld a2uaumont) eeomo3io1optrliei;t0 2um(o io1amtnmfvtat  rrm(ronu0opt mf3iatlm uau s u) eerif oy1lmDrauvols s2toimpnu4lmtn ivsas srtax o;o0tlenmf3ildlm uauvpnt)tlenmr tadlptrlnvil(0s2tm(m iodol  lnvs (  2rmurpno1apenif3ild mDrm(mo (4texoxo3oodfmDeanvs;t) 2xrio ny1optemfctl( a2ua(mo;o4tltomfeiys s rl(ms t4aexnxr3io1op ran ol() rtr(rpno4om   ictat)s2rrx  ;o1tee miciys a2rmn s u0 lxrif3oy1om  aueol(0t2tmxm io1olt livs (fsDta(rpnu4oex  f3ilt m2rau snu)aeerxfciotop elies t0 2xm(o nu1ameemivs tfaDrm(  nt0tet ioeiaslmDumnmo u4 leoirciadlpt aivo t0srxmxopny1ame lneil(  2umx  nu4tpe ioeiasls2uau snu)artoxo3todlaDrliei t)srxm(o3oo1ole lnvt t s2uauro;o0oetnifcilt mDumu onu0 lenxf3todopD lnvi (  eumimpny4olt  fesatfa2rm( oot4tltnioctydfs2eln s t0artrxf3to1lm  livils) 2xo(m oudll  mncia() rtrumpno0teto icildlsDelu s;t4 eenircoo1opte u ols srtmirpnudal nmies () rua( p;o1alxnifeiad s rl(mp;t0 etrmfctydfp rlneo;t0truoxopoudaltnlict ()s2urx pno1apeo fetysls2rmnvsn(4trxnifcoy1lm elues s0 ruo(mpno4lptnmfvt () Dumur ;t1opx micildfm2rl(vpnu0aeeomrcoo1fa   u olt t2um(r3iy4lltnmfeta(fs2tr(m ot0tlxnmo3tltls2eauvpn(0aexoxf3tadoatr nvs t0 rxoim3oy4alt  iciatfsDurur nt1aptnio3ilsfsDua( p;(4tltrmf iotfmtrlues;s) rto(o iy1op elfctl( arur(mono0olxomf3iyd m emu s (4alxrxf tydfpD auei t) 2uoxm3iu1alt lfet tfarrmx  nt1tee  fciydlsDel( s u4trenmr to1laDrlivs () 2uoiopiy1ol nmnvt t sDtr( pou0tltoioctld s2uanvp u4tetrmr3tydfa eauvils  etmxrpoo4apeelnci (fa2trum ou1oeenifciyslm2umn p t)altoif tydfp rau ols0setoxmpou4ll nlnvt tfa2tru  nt4alxn fciadfm2rmnmo;u0tetniocio1fmtelnvsl()t2trio3ou1omee ivt tf Dua(mp;t1alt ifciyt s rlnmo;t0 ltrmf3totlp  luvo;()trtmirpoo4amenlivia()sDtmxm ;u1oexn i3ildls elnmsnt4 eerxo3ta1laDe nvi ( s2toiopoudlm  lfeil(faDtmx o;o4opx iietas sDul(mo (4 leomrctotlmDrau s;t  2um(m3oodalt livslt) Dtr(mp;u1tpeomfeiltlsDrm(mo u0tltrxr3io1oa  lneo (0s2umxrpnu1am   fcsl()s2ur(m oo4alxn iciltla eanmsnt)trerxf3iadlp r ues;( srur(mpnu4am n neil()aDrmum ou4teeo feiadla2el(vo;(0aeerif oatlmtr ies;(0sexm(o iu1ameelnetlsfaDuaurp;t4tpe miciydfs2eln ont)texomf3iy1fmtraneol(0 rtoim3iodopenmncil(fa2rmxr no0alx  iciyslaDemnvo;(4 lxrio3ta1oaDelnvs t trtoxm nydaltnlieslt) 2tr(mpno4aptn f3tat sDeln s;u0tlerir3io1lp eaieo t  exrxopoo1altemfes s s2taxrpoo0opx if3iydfmDem(mo;(4arxnxo3iotfa r n s;t)trurxo iydap emnetls arrrumo;o1aptomfetadfm2eau p u0aetrir ta1fa r ieols) euoxr nu1apenlivt (  2raxro;u0alx if3tydfaDuau onu)trtrxo3oadlptraies (  rurxmpiodal emfeia(f Dtru poo1aetoii3tadfs2eanvsn(0tlenxf oatomtrai i;t)texrim no4alt lfvia( s2umu ono0alto oeiydla ua( o (0arxnxfciytopD aivs s) ruo(m ou1lmtn ivs ( artau pnu4ale iictat s rluvs;u4trxrio ootfpDr nes;s0trxoimpoo4lptelivsatfsrur(  no0oleomfciytfs2rl( pn()trxoxo3iadlmt  i o s) 2ur(mpnodal  mnvsas)arrau ooo1opxnmi3ilt s2ra(vonu0 exrio3tadfmt  i i t0 exrir3oy4amee ncsat s2ur( pnt0tleniictysfmDumnmp t0artoif3tatopteluei;t)t2uo(m3io4lp nlietltfs2um(  nu4oeenii3ild a ulnvpn(0 exrxociydoa rlieo;s)trtm(m3oo1am  lneiasfaDrrur ;o4ope ii3tld a2eln o;u0 rtnmrciytlmDeanvi s0t2ur(m3no1optelncsas)a2raxrooo4open fetat sDemums;u) reomo3tadomt lueils0t2uoxrpou4omt  fct tf 2taxm ;u4oee  feiyd a emn s;()trermrciotom rai i s) eum(m3oodlle micsat)arrrxr nt4opx  iciatla2rmuvp (4artoif3oytoat an i (  2xrim3oudomtelfet s) rur(m oo4apxn ietatls2rl( s;u)tltrmo3totlpDelies;t0 rurim3nudap e fcsa(fa2tr(m ;u4tpe moeiasls2ulums;t0aeenmo3oydom  livo t)srxoxm3nydllt mnctltfarrmump;u0tlen fciyt s rmnmp;t0 eenxf iodlp e ivil( teurir iudapenlfciasf 2rax ooo0aeenmf3iyd m rau pnu0 etnircoy1optr ueol(0 rxmxo3iy4openmnvtat arurxrpno1aleomfetls m2rlu on(4trenxfcty1oaDr nvi;( tetrir ny4am  lnvtasf ruaumoot1olxo oeildfa umums (4tlerxo iadfpD  u ils0teuo(m nudal elfvia() rtr(moou1tetomi3tyt a2emumpn(4tleoxf tydomtranvs;s0 2urxrpiu1ll emfcsas  ruaump;u1oltomfeiltls rm(mo;t)trermocoa1omDeauvi t0 etmxm oy1lmeemnesl(  rrmx  ;o0apxn feias a2rau p u) lxomfciytfatrauvs t)sexoim3iudomeemiesat sDta(ront4apeo oeils a2uanvs;u4 rxomrctydlm  au i;s tetrxmpiu1alen ici t)s2tr(mont0tlt  o3iaslaDulnmo (0treoxfciy1lpD aivs;(0 eurxo oodole  nvs t)a2tr( p;u0texomf3iatls elnvo u0altomfciytfaD an s;t0t2uo(mpno1lp e nvta(fsDrau p;o0tlen f3tatfmDuan s;u)tetomo3oo1omDran ols0srtr(mpnudape  ictls) 2umx pou0oexomf3iatfaDrm(vs;u) leoir ootfaDelies t0 2tm(r oudopt lfet s arur( ono1aeen oeiadla elnvp t4 rtnxr iydlm  auvols0srxr(mpiu1aleelncta(faDta( p;u0aleoioctysfa ulu sn(4 lxrirctatom raieols)s2tmir iu4lpeelfei s  2ua(  nt4texnmi3ils a2uanmo;t)treoifcoytoptraueo s)sruo(o iu4op nmncta( aDum( poo4tpx  ieiytfmDuanvo t0tetrir3oo1fm eaieo ()texm(r iy1lpe mnvtasfa2ur(mpot1oetnifeiadfm rmn s;()areoxrcoytfate uvols) etrir3oydalt lnvi s sDurx  ;o1ale mieiatlm ea( p t4aleoxo3iodoa e i slt0s2xm(rpou1amtemfcs ( sDta( pnt4alto o3iydla ua( p;t0 etrxr3todoptrli ilt) euoio3nu4llt mivtl() Drm(mpoo0oee  ociltlsDra( pnu0 rtomocoodoaDelivo t0t2tm(m io4olt livsas) Dur( p;t4ope  ictltlmDel( o;()tetrxoctotomtrlneo;s trumirpoudlpee nei s srumu ooo0tleoifciydfmDemump;(4 lxnxo3iadoaDraies t  ruo(m3oydlpee nesatf 2uax  no1opt  i3iyslm umu ont4 eeoircoo1la eanei ( sexrxm3ny1lmt lfet s artru  nu4olto octadfs rauvp;(4aexnircty1om rauvil(  2um(o nu1opt mnct tf rta(r ;u4alxomoeiytlm uaumo;u0 ltoif tytlpDr iesls)s2toxrpiu4ol nlivi tfs2uaxm ou0aleo fetadla2ul( snt4 lenir3tydlmt aivs;t)texoir iy4lptelfctas aDumurpot0aeto feiys s2emn s t)tltrir oy1fp eli i;t0t2xm(r3iydam  lnvt s) rrmumo;u1olxo fciltfa2el( pn(4 lxoiocta1fmD aies t)t2umxmpoydapee ivt t)srua(r no1tlxoioctadfmDelu ont) rxoif tydom eanvo;(0sruoxo nudopee iciat)a2raurpnt4oetnmoetld sDranmon(4 lerxrcia1lmDelues;t)srxm(r3oy1alenmfet ( s2ua(rpoo0ape ioctld mDuaums t) lenmr io1op elu o;(0srumxr ou4lltn fcil() Duaurpou0apx moctyt m2rm(mo;(4tleomf oadfmD  nvol( s2toxm oo4llenlnvtls s2tmx p;t1aeenii3tadlm rl(mp;u0tltrxf tydfpteaueils0 eumxo3ou1lmeemfvsas) Drm(mpot0aexnmo3iat sDran pnu0arenif3ia1lmt ln slt0 rxrxr iy4ll elicsl( srtmx ooo0texnmoctytfs2eauvo u) ltoxo3iytfat  ivo s t2xoxopnu1amtn ivils  Drmum ou0aptnii3tatfa2rmnmp ()aexnxo iadlpD  i il()setrio3ou1lme mfeias  Dta(monu0apt mi3ild sDrluvp u0aetriociy1lpDeauvi t  2xmxopio1lmeemies t)artau pou4aeto iciatlaDrm(vo;(4trenio oydlate u o;t)srxr(m3nu4aptn nes s)srumxmpno4apx ii3ils m2rmn s;t0 rtoxociodfptranes;()t2xoxmpny1lm nliesat)arum(rpnt4tpx mociyt a2emnmonu0tleoxf3iotop e i i;t0 2tmxm3iodlpe  ici tfsDum(  ;o0oexo icildfs rm(vsn()aetrir ootlp  liei s0trtoim oodll  mneslt)sruaxmont4tlt  ictydlaDemnmp u0areomo tytomDraues;s0teum(m3oy1ole mneils arumuroot4tlxnmfctadlm2ulnmonu)aeenxf iydfpte n ols0s2xrxr iydape lfvt tfs2tax p;o0ole  i3ild a rl(vs;t0 ltoxo3oydlat  ieolt texr(o iu1alenmnvil( sDuaxmp;t4tle  fetytla2el(vont)tltnmf ia1oat anvs;( teumiopoy1ll elfesat) 2rax oot4alxo fciytlaDel(vpnu4alxoio3tydoaD liei t0 rumim nu1amen ivt tfartru p;u1tlt mo3ilt sDumumsn(4trxoxr iy1la  luvo (  ruoxopoydameelivta( sDrmx pno0ape mieildlm2uau o;t0aetrif3iy1lpD anei;()teurxo oo4ope mnvs s)arrr( pnu4oeto fciytfs rau p (0 ltnxfcoatfa eaueolt  2umio3nydlpee fctas)s2taxrp;t4openio3iatfs rm( pn()arxrxo tadlpD luvilt0truoxo3oo1lmen fctat)s2rrxmpno0tltomi3ils m rau s (0aexrxf3ty1fpte uvi;( srxmiopoydom  micsat)s2ra(mpnu1texn ieiat m2ea(vsn()aexnxocoydoa rlivi;t)sexoxopiydoleelfcsl( arra(rpot4oexnif3tatfa ua(ms;u0tlxrxo io1optrau s t seuoxm no1ale mivtl(faDuaxrp;t4teenmi3iytfsDuauvs;t0tlxnmo todla ran s;s)truo(m no1lmte icias) 2rm(r oo1apeniieiat aDeauvp t)teenir oadlaD li o;s0s2toiopiy1altnlfctat)s2rmxr no4tleoioctltlm ua( on()arxrmrctydoa   nesl(0 2urxmpno1op  livslt arrax ooo1aexoif3ildfa2eau ont0 etomr3oytoptelu o;t trxrxm3ny1altnlfeta() 2trxro;u4oltnmieiydfm emums (0tlxnxo ia1fm eai i t)seumim3io1amtemfvsas sDrrx ooo1aetn o3ilt aDemu o u)alxnmfcoa1la   ivols0 2um(m iu1ope mfet (fa2rrum nt1aetnmieiydfmDrlnmp u4 exnir to1fpDr iesl( s2xmxr ou1ll emnvt s arta(ronu1aleo f3tld m2umnvpnt) ltomr3oydfmt auvs;t trxoxopiydomtemfvsa(fs2tr(r ou1oltnmo3iyslsDem( p;(0 eeomociydlmt  nvslt t2uoxrpiy1lp  lnvtlt) rta(r ;o4aptomfciyt m2rauvp;(4aleoxf oadlp elu sl()s2xmxo3iu4apenliesatfsDuru  nt1tlxomociydla uan o;u4aeenmr3totfm r ies (0sexo(r iy4lp  mfcsas  Dtrx ono0oltnii3iytfm rmnvp;u4trtnircta1laDean i;t)s2tmxm iu1omt lfvi t)sDuru p;u4aetomo3ilt m rmums t0aetnmfcto1fa   neilt0srtoim3nodol e icia()a2uru o;u0ope mi3iysfa2rlu o;u)tltrmr iodom  aieolt0t2urxrpiu4ole lncs s s2umxrp;u1olt ifeiydls2rauvp;(4treoxf iydlmte ieo s)teurxm nu4ale liviat sDtr( o;t4apx  ociasfs uln s;t0arenif3io1fm  lu i;t0srum(r3ou1optelnctat  2ua(r ;o0texnmfetlsfs2emnvo (4tltrmo3iadfp  aueils)t2xoxo no4ole  nesatfsrrm(ro;t4texoioeiltfaDemnvs u)alxrif tatlmDrauvolt0texrxm3oy4oltelietat sDrrxm no0alx ifctlsla2ran o u0 etnxr3iotlmtraivs s sexrxr oy1omte fcilt)sDtmxm ;u4teeomfciysfs2ulnmont) etnmo3io1fp e i i;t0t2tm(m nodlm  mfctas)sDrr(rpot0oltnmo3iyd s em(mp;(0tltrmfcoa1fptrlues s0s2toxm3ou1llenlfvsatfsrumur no0oexn oetasfs rmuvp;t0aeeoxo totlat aiesls  2uo(r3nu1ame  fcsa(fa2umx p;o0aet iictldls rauvo;t4areomrcoytla eau s;t)sexrxo3oo1llenlivtatfs2tr( oou4ope moeiasfaDemuvo u0trxoxo oodfp rai slt)teurio3nodom n ivsls  Drmx  nt0tlen iciat m emu p u0tltoxrciytlaD  u o;()srxoxrpoo4lpenmneta() rtaxr ;o0teto feiytfm2ua( o t) ltrxo oy1faDrluvo;(0setm(mpno1lpeemict tf 2ra(ronu1aeenmfeildls eln s;()trerxrciydfp elies;t0texoxm io1om emfcta(f rrau pot1teen feias sDrmumo;(0tlxoir3iotlaD lieol() exoio ny1op n fcil(  rrr(r ;u1oee mieilsfmDemuvp ()texoif3iatomte neo t  2toio3ou1ol  lfei s)aDtmxro;o0apeomi3tatla2rm(msnt) exnmfciotfp   nei (  2uoxr nodam nlivi ( a2umumono1aetomo3tyslm2ean s t0 eenmr to1fmDrlnesl()tetrirpoy4ap e nei s)s2rmxmono4aee mociltfmDrlnvp u) leoxocio1lmt  n slt0sruo(m oo1al   ncsas s2raum ;o4teenmfeilsfaDemumpn(0altnir3iatfa  livi;() rxoxopny1apt  ncil()a2uaurpoo0aee ifcild s ul(ms;u) rerxr3totfm e nvs;t) rxoxr3io4ol nmncil() 2rrxmo;o0optnmiciys s ranmo;t) etrmo3ta1oate u i s0srurirpny1ll  mfcils) Dtr(r nt4apxoioetyslm el(mont4 rxrmf iy1omtraueo;(0t2uoxo3no1ame mivs (f Drrxr nu1optn o3iyd s elu s () ltoircoy1lmtr nvs;s  rxoim iu1am nlfvsltfs2rrur nt1tetn ictasfa ea( pnu)teerir iadlp r uvi;t)t2uoxr nu4op emnes sfsDrrx pnu4oetn oeiasla2rluvs (4 reoir tydopD aueolt0t2to(o3nu1ol nlfvta()aruau pnu0tpe  i3ias m uauvo;t4aexrxrcio1lmDelieo;()trurxo iu4lp elnvsltf 2um(mp;t1tet mietyt a em(msnu4texnmf oadlmtran ilt) euo(r io1lp e iesl(f 2umump;u4apenmiciytfs2umu s;t4artrif3ty1laDeaivo ()teurim oy4lpe lnvsasfsrrmxmoot0tptomietaslsDraums;t0alerxo oa1fmt  ivslt t2xoio nudol e iesls s2urxrpot1tptn o3iyslmDel( s;t4 rtriocoatlaDeauvo;(0t2umxrpoodamtnlfci t) 2um(m nu1olxoifctytls eluvp;u)tetnio3tytoaDraneo ( t2trimpiy4lme mnctls a2rau  nt1oetnmieiat mDrm( ont0texnxfcta1omteaivo;( srurio no1oltnlivt t sDtaxrpnt1tlxnioetatls rmnmp;u)tlxnif3tatfaDeaivi;(0 2xm(m3no4lmtemneta(fs2umx o;u0oeeoifetasfa ul(mp;u) rxnmo ia1omDe ivs;() rxriopny1openlnvtls sDrax  nt0altn feiyd sDra(mp;t)trxrmocia1opD aueils0 2tmxr3iy1amtnlfcsls  2uaxrpnu0alto i3ilt a2uanvpnu)trtnxf oa1faDrau i;()trumimpiu1amtnmneslsfsDuru p;o1olxo fcild s elnvp () ltrmf3iodop eauvs;t  euoxo3oydop e ivias)sDrru p;u4alx mociysfaDeanvo () etrif oadlp e nvolt  rxo(mpoo4amt liciatf Dtm( pot4openmfeildfm2raump t4tltnif3iatlm r ieo;t0teuoxo3nu1ol n neslsf 2umxmo;u1tet if3iaslm uanmp;u) eenifciadlmDraies;(0trto(o3no1apt  fesltfa2ur( oot1oetoifetatlsDumnmpnt)trerir iadfmtr ies;s)teum(m ny1ll nmfvia( s2uaumo;u4altnmietysfm rlnvs u) ltomf iydfmtraivo;()trumirpnydoptn ivi s) Dtaxr ;o1tlxnmf3ilslmDrlnvp;t)aetoir3to1fa raieil(  2um(mpiu1lme lfcil(  2tmump;t1optnmietydfa2rmnvonu)trtoxf oatoaDeaueol( teuoxm3ou4ole mfesl( aDtmumpnt1opxnmf3ilsfm2um(vo;()artoircia1fp   iei s  2tmxmpoudom elivsasf 2tru p;o4aeeomoctls s elums;u)arxomo oytlmte ivols) eum(m3nu4lpe  fetls sDuau p;t4aexoii3tltlmDrau p t)trtoir tadfmtrlieslt0 ruoxrpiy1lp e fcs () rtmxm nu1apxnioetlt sDrmnvs ()aeeomrcia1opt  n s;() exoio ny4lmtnlncta() Drr( o;u1aeenmoetlt m rlumo u4altrxr tadomte i o;() rxmxm3iu4al   nciasf Drrumo;t1tptniiciyd s ra( p;u4aleoxf iy1fmD  ivs;() 2um(o oo4amt  fesl( sDtmurooo4tptn o3tyd sDemnms t0 rtoxo io1omD aieols texr(o nu4olee fcs s)aDtrx onu1tlt  ietatfmDran p;(4alerxr3tatlmDeai o ( teumimpiu4ll emfeil()s2raumo;t0texomietad a rauvp ()trerxr3oodomD livs;()texmxrpou4omtn ivi ()s2urum ot4texnmf3ias mDrm(mo (4tlermf iodopt  uei;( s2uoir3nydopt lfvta( a2raur ;t4tlto ietytfm eln pnt0 lenxf3tytopDeln i;s srxmxo3no4lleelnei s aDtmx ont1tptn oeiltfm2elu s ()areoif oytopDeanvi t t2xmxm3no1lmeelictl( srtaxmonu0alxnmiciydfa2ulumo u4tltoxo3oydoa rauvo;() rxo(rpnydllenmfcia(fsrtmxr no0apx ioeiatfm2rmuvo (0 rtrir3ia1fm  luvo;s)srxoxr3oo1lltelfciat) ruru pnt1oeeomf3ilsls2rauvp t0 eeoifcootoa raivo (  exo(mpnudap n ict ( srra( poo0aee mo3tatfs2rmums;t4 rtrxf3iodfpDeaivo;s) 2xrio ny4opeelnetatf ruau o;o0tpeomoctydla rluvp (4 etoxf oytoptrlieslt0s2xmxrpny1lm  lietatfaruax pnu1opxomi3iaslm ulnms;t4 ltoio3tatfa   i sls)srumimpio4omtelics tf ruru oou4aet  ieiydls uln o ()arenmf to1fm r uei;s)trtoxm3oodamenmicsl( srtrxm nu4olt ifciaslm2uaump;(0trtrmrcoa1fmDeau i;(  ruoxo nydlltnlnetat)sDtr(mpnt4alto oeilslaDemuvs (4altrirctotoaDelueslt0 ruo(r oydlmtnlics sf 2raxmoot1texnmfctytfs2ran s;() lxoio3tatlptr u s;t0 ruoxopnudam emneils  2trxrpnu1apeomfctydla2uluvo;u)tlxnif3iotopte nvs t0teto(opnydll nlfcta( a2rm(root1tpe  oeiytfa uan o u0 lenxo3ty1laD aues;s t2xoio nu4alt lneiatfaruaur ou1oexomi3tasla umnvon() ltrxrciodlp rauvol() exr(m ou4ol nmnes t a2ua( pou0oleomieiytls rlumpn(0trxrio3iotfpt lueo;t  rtmxm iodoltnlnct sfaDrrx p;u0altomictatfa um( p () reoifcoy1oaDelu i t)sruoimpny4apt  fetls sDurxrp;u1oeeomoeiyt mDumn p;()alermf3oytla  auvs t) 2uoir ou4amt  ivslt srum(rpnt0tlxnmociaslsDuluvo u4aexrxo3oydomDrli olt  etrir nodom   ivtas aDumumoot4olx ii3iys mDulnvo;u) reoxf tadlaDeaneols0 2tr(o3iudoptelfet s srraumo;o4oet ifeiydfa ran pn(0tltrmo oodopDelnes;t) rumiopnydllenmneil( sDtr( ont4olx mfctatlsDrmu snu4 eeomocoodomDeau i;s  rtoxrpnu4lp  lfeil()a2umu pnt4tetniictysfm ul(mo;u) etoxr ta1laD ln s t teur(r3iodamte fvta(f Durxmono1oltnmfctls a em( onu0alermr3ty1fp  ln o;s  2toir oodap  lnes (  rumx  ot0aexoii3tlslm umumo;()altrxo tytfaDranvol( srur(r oy4alt  ict tfsDtrum ot0alx mfeildls2umump u)teenif io1faD  u i;t texo(mpoy1op nmivilt srtaxmo;u1aee  f3ils aDem(msn(4 ltnmrctotlpD  ivils0t2tr(opny1op nlieslt)artm( oou1ale mi3tls aDea(vp ()aexoirctodfp elues s trumio nu1amtemiesa( sDtmxmooo0tltnmo3tld s uan o u0trxrxo oa1opt auvslt0s2toxmpoy4om  mieilt) Dtrxroot1tex ioctlt mDean o t4treoif3oo1fa r n o;t0tetoxm3ou1ol n ivs sfaruaxmont0apxnmociasfaDrl(ms;(0aexoir3tatfaDraueo;( s2tr(m3ny4lpt lfetas s2taumont1oet ii3iadfa2umnmsnt) rxoxr3oa1op rlieo;(0 etmio3ou1apee nvi s)srurumo;t4tpto fctldfa2rmuvonu)texrif iodlmDr uvo;(  rxoxo3io1ame lnvsat)srumu onu4tpeoifctytfs2umuvo u0 exnxociatfptelieo;s sexrxr nu4ol e ietl()a2umx onu1optoif3iytfmDemnmpnt) lermo oo1lpDe nvo t trxm(m3nydopte icslt)a2uaxmoot0olt mfciadfs2rmu pnu0alenmociatfmt ln ilt0srumxr iu1oltemfvt (  rrrx ont1alen ocilt a uluvs ()aexrxocoy1om eauei;()s2xmxmpny1al  lfvt t)artaxmp;u4ope  octys s2rauvsnu0 rtnmfcoadla e ivs;t tetoir iudop   ivs tfs2umx p;o1alt ioeiltfa umnmpn(4 lxoxf3todla  aues;( trum(opoudol  mnvsa()s2ua(rpno0tpxnifciytfm2ranvo t) reoircoatfaDe ivi (0t2tmir3nu1ll e ietatfarrm(monu0aet mf3tyd a2rl(ms;()texrmr iadoatranvo (0trxoxrpno1omtemfei (  2rrxrpot0aeeoifciytfmDelnvp;u) leoxr3oy1fp rlnvslt0sexr(mpiu1apeemnei ( aDur(mpno4tpt io3iys sDem(msnt4altoir3ta1faD anes (  rto(m3nudomtemnct (faDrr(r nu4texnmfeiatlaDua(mo t4tltoircia1lpD lues s)teuoir3iodopeemfcias)arur( ont4tex  fctaslm eaumo ()trxrifciy1laDeln olt0texr(m oy4opeemici s  2urx  nu1aptnmfeias m rlumo;t0artomo3oadfpD livo;s0trtoimpno1om emfei s)a2umx  ot4apenmoeild m2uln s;(0 lxrir3totoaD lneils0s2umxo3nodol e nesl(f ruax pnu4alxnmfciydlsDem(vont0arerxf3to1fa  livs t srxoirpoy4om  mfvs s  rrmurpoo1opxo i3iyd sDulnmpnu4 ltomf3todopDeluei;()t2xoxo3oodopee nci ( s2rm(mpoo1tex miciyt s rauvont0aetoxo3to1lmtrlu ils)teuoxopnydap n fvi s  rrm(mpnu1aexnmfciys s ua(mo;(4 lxnxo ootoaDeanei;(  2xo(m3iydalenlncs (f Dtr(rpno0apt mfeilsfs2umu pnt)aexrxf tadlmtr u i s)trtriopiudlptn fcs tf rtm(rp;u4opxn oeiysfs rmnmo;u4alxoioctydlptelnes;( truo(r ou1ome  nvi tfs2rm( o;u1opeo feiatfsDul(vo;t4tetrmocto1fpDrln ol()trxmxo3iodamen neilsf 2tru poo1tlxnmociatlmDuluvonu0 etnio tytom  lueols srtmio ou1op n ieiatfsDua( pnt0altn iciydls em(mo;t4 etoir3iodlp e uvsls0 rxmio3oo1ome  net () Durx  ou4aeeo ieilsfa umuvsn()trtomrcoy1omtrlies s0s2um(opny4apt  iei s  rtau o;t0apxn ocilslaDrl(ms u4arxrir3iatopDr n olt0truriopiu1olen fvi ()s2tau p;u4tlxomoctlsfa rln s u0aexnxocio1lmtrli ils)srxo(m no4olenmfcsltfa2trurp;o4opx ii3tlsfm2rm(ms u)aexrmocia1oa  lueilt0 exr(r3ou1op nlncsasf 2rrx o;o0olxn o3tat m2ranmsnt)aexnio ia1la elnei (0 euo(r oudam nlfvtl()sDrax o;u0alxnif3iysls2uan p;t4 lxrxf3io1fp  auesls0s2urxm3oy4ole  ncsltfsDrm(r ot4alx  i3ilt aDemnmp;u0trxrio todfmt  uvols0trxmxm3oodolt lfeils)aDur(r ot0aptnmf3ils m2uauvpn()teerxo3oydfpD  ies t  euoxo3iydomenmncs t  2umxmpoo1aeenifciadls2uau s (4 rtnmo ty1lpDrauvol()t2umio ny1lpte fvt sfa2uaxroot1ole mi3iyslaDua(vp;(4 reomociy1fm rluvs;t s2xr(m no1lmeelnvsat  2um(rpno4oee io3iyslm rmn sn(0tetomrcootlm r ivil() 2xrio3nu4al nlfet (farrm(m oo0alt mfeiyt s2ra(vs;u0altomrciodfmt anvsls0 rtrxo iy4ole lfct (farrmumoot1tex  ieiys m eln p (0altrxr3iadfmDr ieo;(0texoir3ou1lp   fcta( arurur ou4ape iiciadlm rlnms;u4 leoio oadfa   neil( seuoxmpou1optnmieia(fa2ua( pno1oet  f3iltfm umn ont4 rtnio oo1fp eluvs;t srur(r3iy4omtnlivsls) Drmxront1apeoif3taslm emumpn(4artnmoctydfp rlivols0seur(o oodapte net s)s2rax  oo1ale  octadlm2rlu s t4aetnxfcta1omtraneil(  rurxopnudolenlnetasf rumump;u1apxoii3iatls2emuvp () eenxf iadoaDe uvi t) eurio3oudap   ivils a2urx ono4tlt  ieiadls2emnvo;t4 etoxociatopDrln i () 2uoiopiu4alt  fvsl( s2urumpot1tlx ii3iad aDrm(vsnu4 renmf iadlm  an o;t0t2umim oydopeemnci () rrrx pot0apeomfctlsls2emuvo u)tleomo ta1lpt lieo;t t2tm(m3no4opeelicsas  Dua(mpoo0texnmieiyslsDumumo;u0 exoiocoodfa raivo t0t2xmxrpio1lm  mfvs ( s2tau o;u4ole  f3iltfa umuvon(4 lxomf3tadomDr n o ( s2xr(opnodlptnlnct ()arrrurpou1tlt  octytfmDrmuvo u0tlxoxf iodlm e nes;(  rxr(o oodll   icia(  Dumu o;o1aeeoiociasfsDua(mon()tltrif ty1om e ivo s0seuoxrpnodlpeelnvi sfs2umxrpnu1oetniieiat m umums t0altnxr ty1lmt li sl(0 exoxopno1al n fei ( artrx  ou4tex  oeiytls rm( s;u4 eerio oo1oatrliei;s)setrxo oudlm   nvtlsfsDurumo;t4oeeomiciys m2rau p t0 lxrircty1om rlivsls)teur(o oydapte ictl()sruaxm no4tltnmfciyd mDumn pn(4aetrmo3oy1fm eanvil( srxmxm3oo4lltnmnetltfs2ta( o;u1ale mfcilt s ra(vo ()tltoxoctadfp rluvi t)truriopno4ol nlnvtas  ruaumpno4texnmi3iysfm2raumont4 rxrmf tadlatelieols)s2trxrpno4apee fvtat)a2tr(mp;u0oet mi3iadla2um(mon()artnxo3totomtrlieo;t sexrxr iydolt mfvt s) rumurono4tleomf3iys aDrlu p (4 rerxrctytla e uvo;()tetoxo iu4am   neil(fsDrmxmoot4olx mf3tas mDuluvp t0altniocoatlp eanvils teur(opiu4olt  nvtlsfa2urur ;t4apen fetat s el( snu) rtrmociydfmtrai s (0 exoxo3io4op emnviat s2ta(m nu1tptoioeilsfm el(vont) rtoir oatlmDe n i () ruoir3iu1amte fvi t) ruaurp;t1texomi3iad a2emnmp (0teerio oo1lat lieilt)s2xm(r oy4lleeliesatf 2ur(  no1tpt mociytfs2umu p (0teenif3ia1omDrluvo;s s2xoiopno1ape mfvilsfs2rmumont0alxo fetasfs em(mo u0aeeniociadlpDrlnvsls0 exm(mpoudopeelfeil(farraumpot0tpxoifeiyd mDrl( s;t)altoxr iodlpt  ieo;t0t2xr(o3no1op e fvilt) Dumxm oo0apeoio3iatls el(mp t4altoifciydfpDeluvolt) 2xoxopiudlmtelnctat)s2ra(rooo0oltnmi3tlslm2uln p;()arermo ia1omDrlnvil() eto(m iudopt mivs s  Duaur ot1aeeo i3ildls uanmo u)areoxf oodfmD luvil(  etrxm3io1lm  miesatfsrtmurpoo1opxoio3tasls2ul( pnt)tlxoxociadlptrai sl()trtrir3io1ap  mfvtls  2urx  nu0olxn i3iatfs2emn s ()aleoif3iydlmDeauvi;t)seumio3nudope  icilt)sDuaumono1tpeniieias a2ean snt4altriocto1fpte ueo s0 exmxr iu4amt lnvtlt  Dta(rpnt1olxnmociys m rlumont0arxrxf oa1faDr ueo s)t2to(r3oo1lmtn fctls aDtmu pnu0tpe micils s ea(mo;(0 etnioctatlp r uvil()t2um(mpoydole mnet s sDtmx o;t4tlxo f3tat m2emnmo;(0trtnmr3iydlp   ies (0srxo(m oydlp e neiasf 2rm(r ;u4oeenmo3tat aDran p;u)trtoifciadlpDeai i t) rxrim3ny1lltelfciatf 2rm(mont0apxnifcild s em(msnu4artoxo iy1opDranvols trur(o3iu4amt mivtltfaDua( pou0texoio3tlsfs2ul(vp u0tlxnxr3totomt ai i;t0 rxm(opiu1al nlfes s)aDrruroot4olx ifcils a ua(ms;u0arxrxocoatop e n i;s  rum(opno4ol emncs s)a2umuronu0apt mf3iydfsDem(mo t4 rxoxfcoodopDraneils)s2to(opoy1ol  mnet sfartau  ou0apenifeiltlaDuln snu4trtrmr3tadfptrau i s0t2xmim nudlle  ivi ()aDur(r ou0oetn ieiatls eln pnt0tleomf iotom  ln i t0srtmxr3nudlm elict t) rrrxr ou4tpxomf3tldfmDumumpn(4 lxrifctydfateaivo t sruoxmpnu1ap  livt sf Dra(m oo0apeomociltfs uauvsnt) rxnmf3oadfp rli s;s)trto(mpiy4alt mfctas artmu  ou0teeo f3tad a2elnvs u0alerxr3iy1lmt  ivol() ruoxo no1op e ivils)aDtaxm ;u1tlt  oeiytls2ranmpnt0alxoir oadfptelu i;s s2uoimpnu4amt mivt s) Dua(r ot1tlxn fcils a el(msnt0artoxrciytfmteau ils  2umxo3nodlle  ici t s2ur(mp;u4aptomiciys s2ulnvpn() ltomf ia1lptrlu s ()s2umxrpnodlpt  ivi () Drru pou1opeoioeiytlm2elump u4tleoio oy1lpDelnvi s)teumxopoodll nmicsas srtax o;o1texoii3taslm elu on()alxrxr oodfa rlivil( teuoirpou4lmeemict s)s2tr(rpoo4tptnifctasfs2ulnms;u)alxrirciatopte uvo;t sexmirpiu4ol emnet s) Dtax pno1oeen ocild s ea(mp u4trtnmr3to1lmt livi ( t2tm(m iy1llenlnvsatfaDta(mono1ope  o3tad sDrlnvp ()trerifctodfm r nes s texoim ou1llenmicsat  rumuroou0oetn fctld s2ul( s;t4tltoxf iotlaDrlueilt trur(mpnu4om elicils)srurxm oo4aeto feias a rlnvp t0alxnif tadopt au i;( sruoxm3iy1apt mnvi sf 2rmxrpot0oet  f3ildfa rln snt0aetrxo ty1fa e i sl() rtm(mpiodal e fetl( aruaxro;o0olxomfctydfsDrln s;t0tlxoirctadoatr ivi t)s2to(r nu4opeemnetas) Dum(mp;o4apto o3tasls2rm( onu0alxnmfctotlmDrli o t0 rtmir iydam  liet s)srtmx  oo1ole  fciydfm em(vs;t4treniocio1fatr i sls t2umir nodlmtemnci s aDraurp;u0tetn f3iysfa eau p;t4artoio3oa1omDr uvs;(0s2toir3io4ll nmfeiat srum(mpoo0opx io3ilsfs umu p t)alenif3tatfa r ieo;s srxrim io1ope mncslt) Dumx  ;o1tetn oetys sDeau s t4 leomfciy1omte u ils)setm(opiu1ll nlnvsl(fs2raum oo0aee  i3iytfm2rmnvs (0alenxr iatfm eauei s)sruoiopnu4apt livsas)a2ra(rp;u4tptnmiciyt m2uau sn()alerxo ootomDrauvs t  etmir io1lleelfesatfsrrrx  ;t1oleomoctlt m2em(vpnu4trxrmfciotlm   u s;s trxr(mpoydaleelfcilt  Drm(m ;o0alenmieild m2rl( o (0texrxrctodla   u ols tetoxmpoo1omtnmnvi () rrrxmpnu1ale mi3tat s2uln p;t4 etriociotfpDr ueilt)t2urxmpnudamt  nvilt srum(mpot1tee ioeias s2el( o u)altrmo3oydfaDr u ilt0tetrio oo4lmt  fvs t) rraumpot0tlenio3iysls2rmnvo () rermo ootlp eau o;t  2xoirpoy4lleemnvslt)a2ta(rpno1apeomi3iltlmDulnmsnt) renif3oytom rlnvi;t) exr(o ny1lp  mfctas) rrr(mont4altomiciatlmDea( p;(4arxrxr3oodom elneo t t2xoir3oy4apen ictat s2uaurono0alxnioeild m rlnvpn(4trxrio iatlmDelies;t0texr(r3ou1lpt mfes ()a2ur(rp;t4olen ieiydfmDraumpn(0altrmrciy1lm eluvi ()srxmxm ny4al nlncias)aruaump;u1texomo3iys aDea(vs;u0aetnmf3oa1fa r uvs t0setmxo3iudlmtn iet t  Dta(  ou0tltomoeils m ulnmp;()trxnmrctadoa eln s;s  rtmxopnudomenliet tfarumxmpnt0optomi3ias sDeanvs;t4tetomrctadlaD au s;t0seum(rpiu4alt  feslt s2rmx  ;o0aetniictytls2el(ms;(0trenxfcoytfat auesl( tetmxo nu1ll  mivsls  2ra(rp;o4olxoio3iytls uau s u) rerio oadlm  livi (  rxm(m iu1amt  fvsat  Dumxrpoo4apt  feiasfa rl(vp;(4alerxocty1la  luvi;t s2to(rpoo1lpte ivtl(f rtmu o;o0oexoif3ils sDrlu snu4 eerxr3oatopDr n s s)trtr(m3iudol emiesltfa2tm( ont1ole  ictyslm ean o u0 rxnif oytomt ai s;t0 2tm(rpnodlltn iei (  2ua(mpoo0tptomoeiyd mDulnmpnt4aeeoxf todopt lu i;t trxrio no1llenmivt s  2rrum nt0apxn f3tydfa ulu o;t)tlermfciytomD  neo;() 2umxm3iodoltnmnci s) 2raxrpnt0tpeniiciydlmDrmu s t4 exomr oatom eaivs s  2uo(m3no4ame  ncslsfarumxmoot4oet ifcilsla emums u4arenxfcio1lmDeauvs ()sexrim3ou4lp nlfcslt)s2tmuro;u4tpxnioctadfm ea(ms ()trenmf iy1lm raieilt t2xoimpno1ap n fcs tfs2tmum ;o0optn fctld m2emn snu4aeenio3ootoatr ueslt0 eur(o3ny4apt mnvt t s2urxro;u4opx mf3tasfa2ean p;u0tlxomfcia1fmD lu o;s)trumir ny1apee ncta(  Dum( oot1aetomoetas m eauvpnt4areriocoo1lateaivo (0t2tr(r3iy1oleeliesasfaDum(  nu4tee  o3iytfm uauvo t0trxnxo3oo1lateluei;t0 rtrimpiu1olte nei t  ruaxmpoo0alxo ocias a emn ont0aetomo ta1opD aneo (0s2umirpiu1alt licslt)a2raump;u1oetomi3ias a2uaump () eeomr iytlpDr ieils0s2tmxo iydope  nvil( aDuru  ;t4aexoiociasfaDel(vs (4 rtoif to1omD an s;s)s2xmxo3io1om nmfvtlt)a2urx  ot0tpxoifctytlmDrl( p;u0artrmr3iodomDrlnvils)srtm(o3ny4lptemfvt ( s2rmxrpoo1teto fetadfsDua(monu0tlenxr ty1oaDelueils)trxm(mpiodaptemici s arurxrono4alenioeiydla2rmn p;t4tlxrifcty1omD ai sl(0 etmio3oo1lme miet s)aDurx ooo0apt ioeilt a2uanmpn(0 rxoxr iydfa rau ils) 2xm(mpiydamtnlies t)sDtm(mono1apxo feiydfa ua(vsnu4alermo iytoaDrlnvsl(0setr(o nydlmt lies tfa2taxm ;o0opeo fciydlm2rau snt) ltrir3io1opD  n i;t trtrir oydaptn icsa( srur(rpno4tlxoifeils s2um( p;u) rtoxocoo1optraueil( trtmxr iy4ol e icsls artru p;u0apeomfcils m2rl(mo u4artomf oo1oat aivils  2xmxr3io1lp  mfvt t)s2umxmpot4tpt  octyt s ul( o t4alenmrcty1fmt auesl()s2umim3nodlltemfvi ( a2tr(mpno1ope moetlslmDuaums t4 exrircta1fm r uvsl(0 ruoir3nu4olee iesasfsrrmurono4olenifetldla eanvp (0arermocia1latr i o;(  etr(m iodamte fvta()arrmxm ot4aptomoeiytlmDranvo;()tetrxf io1fpDrlneil( srurxr io4amenmfcs sfsDrmurp;u0tltn icilslsDelnmon(0tltrmf3tatop eanvils)s2ur(rpoudllenlivslt sDum(ro;t1tlxo oeiadfs2rauvo;()aeeoxr3tatfpD  uesl(  2xo(o3oudole liciatfaDtm(moot4texomo3tyslmDua(vo t0artoxfctydoatrlnes t) 2tmiopio1alte neilt) Dtrxm ;u0teeniociys sDra(mp;t)texoxr io1faDr n o;t0texm(m no1ameemncsa() 2rr( poo4olxoiieiadfs2emumpnu0arerxf3iytfmtranvsl() 2xr(o ou4am n fvia()arrr(  ;t0alxn oeiyslm2umnms;t)artnxf3oydomtelivs s0 2tm(mpoo1al nmnvt ()a2uaxmp;t0opt  i3tlsfsDrmnvo;u4 rxrmrcoadlmDe i ils) 2to(m3ny1lm nlnvilt srtm(r no0aexnmocild a2ulumo;t4tlerxf3io1fpt luvsls) etmxr3nu4lleelfcs (f rtr(mpno0tlxomfciysfa2uauvsnt) rtnxr3ootoaDr uei;s0 etmxr nu1lm   fvi s)sDum(  ;u1ole  oetydfsDul(ms u0 eeoxfciydfmtr n o;( t2uo(r oo4ll   iviatfaDraxr no0olen icias aDrmnmo t) rtrmrcoa1lpte uvslt) exo(m io1lltnmnesas  rumxm no1tlen o3tat m2eauvonu4 rtoxf3tydlm rauvs;(0 rxmxo nodam nlncs s  rta(  nu1aetnmictadfm uan sn(0alxoxf oo1lp e nvi;t0srtm(o3nu1openlncsls a2ur(m no1tet  feiltfm2rl(mpnt4altnir iadfmDeaieolt)trumxr3no4ale lnvt sfsrrr( pnt4aexo oetydfm2rlnvo ()aexrxrctatfmD ln il(0sexoir3no4op elnvt (fsruaxm oo0aet mi3iatfmDulump;t0tlxoif iodomD  ivs t  rur(o3nydap emies t) Drr(  nt4olt ifctldfmDemnvp;t4 lxomoctotlp  li i;(0trum(o iu4opt lfcs () 2ra(mooo1altnmfeiat s2ua(monu4aetnxf3ootla  aivo t0srtrio nydlmtemfetatfaDrmxmp;u1opxoiociltfa2ulnvonu)aeermocio1la r ueo;s0 euo(o3ny1omte fetls  Drau pnt1oeeo o3tytfa2umn s ()tlerxfcootoa eaueslt0setrir3iy1am  lneil( aDururpnt4tpx ioeiltls uln sn()trtrirciadlpD luvi;s)seur(o3ou4op  mivt t sDrax onu0oeeo i3iysfsDuan snt0tlxnxo3tadlat  ueils0 2trio3oo4alte icilsf rurxm ;u0opeomoetat m rmuvsn(0 etrifcoa1faD  nei s sexrxr nodap e fvtltfsrumxr ot1tpx miciltlaDrmumo t0trenif todop  aiei ()trurxr nudopee netlt)s2trx pno0tet  iciasfa eauvp (0alerio totomtrau olt0 ruo(m3nydal nmietl()aDrmumo;o1altnioeild s umnvs u0trtrxo iodoa eln i;(0 rum(mpnu4optnlfci s)s2tm(  no4tpe  fetas mDum( o t)trermo to1oate iesls s2tm(m no1alen nvslt sDur( p;t1aleo i3tatla ulnmpn()aeeoxr3ta1lpD aies;() rurio ny1ap emiesl(faDra(  ou0olto ieias s ranmp ()aetnxo3to1fpDr ues;t0seur(mpiudlptn fcil() 2rm(rpno4olxomfctytls2eanvo;t) lxoir tytfaD  uvs s t2urio nu4lp emictas arrau o;o0optn octytfsDrauvs t0trxomr iytfat aueils)setmiopiy1lpt  ivs s) rrmumpnu4opt  iciatfsDuanvpn(0 rxnio3oa1lptrlueils0trxmxm iy1op   fes (fs2rm(root4tltoiieiatfa rluvsnu) ltrxrctodfa eli i t0t2xoxmpiudapt mnvsl(f 2rmxmonu1alx moetyt m uaumsnu4 etoifctodfpDranes s  2toirpoodam emnetas  2tmxmooo0ale  f3ils a2rlums;(4 rxrxr3iotla  aneo t) etriopnu4apenlnvsas) Dtmx  no0tpeomociysfm ulnvpn() exoifctadlaDr uvol( tetoiopiydal n feil(  2ua(m ;u4olxnmoctasfs eauvs t0 rxrmr3oy1fatrluvi;s s2tr(opnydal  mfes t)a2uax pot0aex mo3tytfaDul(vp u4 lxrmrcoadlpD li ils0srurir nu1ap  mfetas) Draxroot0alxnmfctas m umuvpn(0 etnxo3oy1latr neol()tetmxr3iy4om emiet s)srurum ou4tetnmfciadlmDran s;(4 rtnio3iydoaD  ieolt) eumimpnydopt lieta()artmxrp;u1tlxomf3iasfsDeau s;(4 reomocto1fp  lnei s0srtmio io4amenmnviasfaruru oot1aptn fctasfm2ra( sn(4trtnif tadlmte ues;()tetr(mpoy4ol nmivtasfsrrau  nt4tpto f3tlsfa2em(monu)aexnir todlm rlivols t2tmxopoodamenmnci t s2raum nu4oetnmiciydfaDemuvs;t) lxrifciydlp e u s;(0trxm(o nodlmt lnvia()a2tmuront0opxn oetls a rlump;t0alenxo3iodlm rluvi;s srxmxm3oodlmen fesa( s2raur ot1apxniietatlmDranvs (0tetrxr tytla e uvs t0sexo(m3ny4omenlnei (farrru onu0tleniieiltfaDeauvp t4aetnxo to1opDeau slt0s2xm(o iy1ap emnvta(f Dur(ro;u0tleo i3ildfm uanms () lxnif ootop rluesl()trum(o3iydoptnlfeslsfa2urumpnu0texo icildfsDemumo (4aexrif oadoat luvils  etrio3iu4ll elfcsat  rrmuro;t1optnmoeiydfa rlums;t)aleomo iydfp eau s;t tetr(rpnu1optnlfeiatfsrrax o;o4oetnif3ildfm2ulnvsnu) eeomr tytlp r ivo s0setoxm iudap   feslt s2rrxmont4opxn fctadfsDua(mpnu4texnioctytlpDeli s;s)texmxr no4oltemfvi sf Durur ;o0tle io3iadfs rm( p;t0trerircoodlp elu sl(0 rxr(r nodap nlfvtas sDtaumont1tlxo ocilsla2uanmp;u4teenxo3iotom eaivolt0tetr(o3oo4ale livs s)sDuaumpot0tpeoiicilsfa eau o u4aetomrcia1fat li o () rtrio ou4lm n fvia(f Dtmumo;u1tptomo3iltlmDelumpn(4texrxo3ta1fpDrlu o t0trxoir iydlmtn nvi ( s2rmxm ot4aet  ietydfm ranmonu)tltnxo3oa1lp ranei s seuoxm3nodal emfctatf Drr(mpoo4texoiicilsfmDua(vsnu0aexnir3tatlpteln i;(  euoxo3iy1op emnvs t)aDumx pot1tlto oeildfa ranvo;u)tltoif3todom   ivs () 2xoim3nu1lmtelivtatfsDraur ;o0oexnmfciydlmDulnvs;()tetnxfcio1fmDrluvo s0teurim3nu1omeelfetat  rumuroot1tlenmf3iyt aDuan ont0 leomr iotlm rau sl(  2tmxo oo4om n fvil()sDra(r oo0oex iicias s2uanmo (0 eerxo totoatean s;(0 exmxmpoudalteliet t s2ra( pnu1aexn f3iyd m2umn s;t)tltoifciotfa eli i (0 etm(rpio1ap elnvsat) 2rrxrpou0aeeoif3iysfs2rmuvp u4 rxrxo3oo1la  aieols seuoio3no4alt  ncsls s2rm(rpoo1tetoiiciadla umuvs (0 lxrxf3oydomtrlneo t) rxo(rpio4omeelnctls)arrr(mp;t0ope  oeiatlmDua(vpnu)aexoir3oydlaDr neo;t trur(opnodap nmfvt s)arumu p;u0tpeoiiciysla el( p t0 etrxfciatlatelivols0t2xrio oydlm n nvsl() rrrxmpnu0tpxo ieiasls2eauvp;t)aetnioctadlpDeaneols tetmiopiudal eliviasf rumu  ;t0aptomociydlm rmnmo;u)trtrmfcootlmtrln ol(0teumio3iu1openmfcsa( s2rrxro;u4olxnmietat aDuluvp (0aetnif3iodfp elnvo s0t2urxo3oydam  mfvia(f 2uau onu1aptomicils s emump;(0 ltnircoodfm eaneilt srtmio3oo4ol n fci t  rrr(rp;o0oee mf3iytla2ul( p (4 ltoiociotoa   ivols  2xr(r ou4opt  fesl()arraumo;t1tle ifeiad a2em(ms;t4alenmo iydfp  lnvo (0sexmxm ny1aptemiesls) rrm(  nu0alto oeiyt m2rl(mont4artnmociadfmDraivsls)seuoxopiy4lp nlfei s)sDua(monu4tltoii3iltfs um( s;(0trxnmr3ty1fate ieo t)teumim oydomeemivia(fsDtru pnt4olxo o3tyt a2uanvs t0trerxf3tytfm   iei (0trurxr io4ome mfct s arrmxmonu1aexoifeiytlmDua(mont0alxrxr oatfmD  uvs ( truoim ou4alte neia( sDta( p;t0oetnifetyd s um(vsnt)teenmo oy1op   ivi;s0 rur(opoo4op nlicsa( s2rmuroot0optoif3iltfsDea(mon(0trtrxf3iodlaDelu s;t s2tm(mpnudolenlncs sfa2trurpnu1texomi3iyd a rmuvont0 renxrciadlatran i s0 exmxo io1am nlfctl()sDuau pno1opxnioctldfaDulu o;u0artoiocoadlmD luei ()sexm(m3iudaleemnvta(f rta(moou1alx iieilsls2emuvsnu0aleomo3ty1opD au sl()t2ur(r ou1olt lfes ( artmxr ou1opeo oeiyt a ra(mo;(0aeeoxrctatomDr nei s0 2xo(mpou4ame  icsasf 2ra( pou0apt mf3tyt s2rm( s u) etnio3iydlp  lies (0 2uo(mpiudapeelfvtlt a2ua(ronu1altomfctydfa el(vpnt)artnxfcta1lpDraueo s  exrxm iydole  nei sfsrtrxroou4altnmf3tlt s2umuvs (0tlxnio3oadomDr nes t)tetmimpou4lpe lfvils) Dtax oot0apeoioctld a elnmo;(0 etrxo3io1lpDeluvols srxrxrpoy1omtn nviltfaruaxro;u4tlxnii3iydfa2rl(mo;u4 exrio io1fa rauvols) 2um(m3nudal  mfeiat)srumur nt1tpxomfetldfsDranmp u4 ltomfcio1fmDran o s)sexoimpny4lme  net s s2trxmont4oetnmo3ias m rln o;t4treoxf oadlp ran ils  2xo(mpoy4lp   ieslt)sDumu pou4tpto ictysfmDulu o (4 rtnxo3tydopte ues s)t2to(m oy4omt miesas)aDuru  nt1alt io3ildfm eauvp;t4altoir3oadop eauei s)srxmxopiudam elfvs ()aDrax  oo0opx  fctyslm2eln on(4trenxo oadlat  u sl( texrxr3oudal emfvs (f Draum ;u0tpeoif3iydlaDulnms;u)alxoxo3oatomteauvi;s) euo(mpnodlltnlivs s)srrmump;t0oexo o3iadfsDemumpnu0aexrxfcoydfate ivs (0 2tmio3nu1om e fet t)s2rmurpou4olxnio3iad sDrln pnu)aexnxr iydom e nei;s srxmxr3iu4aptn nctat) Dtm( o;o0alx  i3iaslm rmumo;(4 rxnxr iodfmDe nei s  eto(r io1ameemfeiltfs2tmu  ;o4oleoifciyd mDrmnms;t0tltoxf iy1fatranvi;t0 eurxm iu4lp   nvi tf Drmx pno4aeeomietys a2um( p t4trxomo3iodom eaieols)t2xr(opiy1ap emncs s)a2taxmpoo4tpxoioctltlmDuaumsnt)tlenircoo1opDelueo;t  eum(m3oydol nmictls aDrm( o;t0oleomo3iydls eauvo;t)arenmoctydlptrauvo t)tetrio3no1ol nmfei ()sDraxrpno1tpx mf3tatfsDrm(vo u4 lxrmfcia1fateanvi;(0t2to(m nu4ll nlfet t a2rmxm ;t1alxnii3iysfsDrauvo t0 exnmo3iatlpD  uvilt)srurxr3nydaptnmfci ()a2uau poo4aex  iciltfaDelnmpnu4aeerxrciydfmte i slt) 2xmiopio1lpenlfctatf 2tmumpou1aexo o3iyd a2rln p u0 rxrircoo1oate neo;t0 2umirpiodop emnctlsfarrmxrp;u0tpxnmocildlm rl(vpn()trerif oadopteln s;t)teuoxopiodlmtnlnesa(fsDrrum ;t4texnio3iaslm2rlu o;(0texoio tadlaDe uvi;s t2ur(mpiu4lme  fetatfs2ra(m nt4apxo f3ilsfmDemn p t)tlermfcoa1oaDrluvs ( srxrxmpoydomen icta() rrruro;u0alto i3ilt a2rmu snt0tetoio iatfa  au s;() rumirpoo1lmtelivsas)srraxm ;o4ope  oetlt s2ua( p;()aeeoxf oatfm   iesls)srto(r ou4lp nmiesat) Duaum nt1ole miciadfm ranvo (4altnifciytom r n ol(0setm(m oydlptemfvils sDraumono4apeo feiysfa ean on(0tetoxr todfaDe i i;t0 rxm(opio1al  mneilsfa2ta(mo;u1olt moeiatls2uanmont4tlxomocoa1oaD lnes (  2to(r ou4alt  netas sDta(m nu1optomf3tytla rmn o t0artniocty1lpt  n o;t)texm(mpoydlpeelfci (f rtm(  nt1opxoiieiltfs emn snu0aexnif3ta1fp   nvi s0 eumimpiydlmenmnvt ( a2rm(r no4olx  icild a rlumon(0aexnircoydfmD  n s (0sexr(m3nodam emics s)a2tr(m ;o0aeeomieilt m rmnvpnt4 ltnxf3ia1op elnvolt0 2xrxm3io1lleemfesl() Dta(  no0teeomi3ils aDua(vp t0alxoircio1omD  nvsls)s2urxm ny4amte ncs t)sDumx pou0alto i3iyd aDuln s;u0arenioctytom eauvolt0 rumxm3oy4ll   fcslsf 2rrum ;u4aptn f3tlsfmDulums;t) exnmo3ty1la rlnvs t0t2tm(o3iu1lptelietls) Drrumonu4oexnmo3tatfsDelumo;u4tlxrif3tadfptrlues t  eumir oo1lm emfeilt)a2tmuront1aeenioctaslm2emn o;(0areoxfctotlmt ln ils0s2xoiopoo1lm emneiltfa2umur ;o0oltnio3iasls2rlums (0 rerxo3ootomtelivs s srxrim iy1ome  ivi (f 2tax onu0oexo ieiad s ran o;u0treomr3tatfa rluvs t0 etmxm oy4llt  icsas) rumurpoo0tptoiictlsfsDrauvpnu4texrio3oy1fmte n s ()trtrxm iy1llen fesltfsrtaxroot0tlxn fctlsfm2uln s t0 eerir oadlm   uvs s0t2tmiopnydap elfetas s2rau o;u1apto i3ilsfs2eau s;(4 etoxo3totlmte nvo;()texmxr oo4lpenlfes s)srurxmp;t4tltoii3iaslmDra( s;u0teeomf tytlmtraneo t  2xm(o3ny1oltnlivtas)srurum nu1texnioetasls2em(ms;t) etrxoctytfp e ueo;t tetrim ny4optemnet (  2rmur oo1opxnmoeils sDulnvsn()altnxo3iodlatr ieo t0t2xrxo no1omtn iciat) 2tax  no1teto i3ild a ea(ms;t)aexomo3oa1lp  lnvs;s) rumiopoydamtnlfci (  rumx oou0oexomf3iad a eau p u4 rxrxo3tadfatrln o ( trxoxo3ny4lpt liesl( arrax p;t0tlen oeiydfa rlumo t4 lxrmo oodlmte neslt0srxrim3oy4lpte nesa( aDuaurooo1alxn iciasfsDrmnvp;t) rtomf3iydoptraieolt) 2toio3nu1oltn ictl(f 2rmxr ;t4tlxomo3ildls2ua( o;t0trtrxfciotla r iei;()trxrim3iy4opeeliet sfs2rm(mpou0oeenif3ilt s2rmn sn(0 lxoio ia1opD lieslt0 2um(o iy4lm n neta(  Dumum ;t0olxo feiad aDum(vo u)altnmociy1fp  anvo;s)t2ur(m iydapeemiesltfaDur(r ;o0tlxnifcild aDra( sn()tetomf3iotla  aies;t0 rxo(o3nudlptemivilt)aDumum no4tpx mietysls ul(mp;u) rxrxrcoa1opDrlnvi;t)t2tmir io4lp elnei (  rrm(mpnu4olt  ictyd s um(ms;()tlerif iotlatelneo;(0texmim3ny4lle mnetl()a2ur(r oo4olt io3ilsfsDrm( o t0texrxoctatlmD luesls0seurxopnu1lpe mieia(  rrmxm ot4openmoctyt a rlu s t) renmfcio1laDelnvs;s teurir iu4ole  nci ()sDurxro;u0aet iiciysfa ua( sn(4 rtnmo oodfatrln o;s0trtrxm nydom  lfctas arrmu ono4texoif3iysls umnmo;u0tltomf3ta1omD  ueolt0 ruriopiy1amt  neta(fartax pnt0olt  ictasfm2eauvp u)alxoif3oy1lm eaieil(  ruoxo3oo4lmt  ici tfarrmurp;o0apxn i3ildfm em(vpnt) exoio3iy1omD livo;( sexoxopiu4ole lnvil( artmuroot0aexoifeiydla2ulu p (0alxoxr iytlpDeaiei;s)t2umxm iydlltn fctasfsDtr(mp;u4teenio3iatfs2uau o (4tetnmf io1fmtr nvi;t) 2xmxo iy1al emneslsfa2rrumpou0aetnii3iydfm2rluvp u4 rtoxf3io1optr ivo;s) rurir iu1omteliet (farrmum ;t4tpe ii3iat aDuanvo;(0 etrifctadlmteaieils)s2xrxm3nodlpenlivta(farrrx p;t0aptnifeiydla ea(mo t4 rxoxf oo1oa  ai sls0t2toirpny1lptn ieta()srrru  ot0aex mfetyslmDrauvs u)aexnif ootlat  u s;( tetr(o no1lmtn nvta()sDrruroou4aet  i3tadfa2ul(vo;u)aexoifciy1fmte ivi;t srxrxmpiy1omeemics ()a2tmuroou4oltn fetas s2rluvpnt0aetoifcoodlmDrli olt) exrxm oo1lmeemivt ( aDuaxr nt4aeto ictadfs rlnvo t4trerio tydfpDr nvs t seuriopio1lm  lnvsa() rtr(  nu4aexo o3iytfs2elnvp u4aexoxf3oo1oa  lnes;s0 2uoim3io4am emictl()a2rmu pou0olxnifeiasls2elu s;(0tetrio tydomD lnvs;s0 2xoxrpiu4lm   nei ( sDtr(  nt4olt if3iyt m2uanvp u)trerxrcoydfat  uvil(0s2urxopiy1apeemivtls  rumxmont1alxo ieilt aDuanvsnt) rxomf iytfpD luvo t) 2xoio nudomte ici tfaDrau p;u1oltoiiciat s ra( o;u)artrirctydlatr nvi;()t2tr(o3iu1lm  mieil(fsrtmumoou1opx  oetlt a umuvpnu4aetnmf3ia1fmDr ueolt) 2xr(o oydop elfetl(fa2tmxmpnt0aet  i3iltlaDuln o;u4altomo ta1lm eauvsl( sexrxr3oydamtnlicsasf 2ur(root0tleoii3iadfs rl( p (0aleomf3oa1fpD  n s;t0 2xrir iy1amte nes t)arta(m ;t0tpxn iciyd m rmump;t4 etrxo3iytoaDr ivs;t  rxo(opou1openmfeils)artmxro;t1texnmo3iatlm eluvs t4tlenxr3tadlmteli i;t0t2tmxo3oo1ale lfetl( a2taxmp;o4alxoiicilsfs2rlums;u) rxrio oy1fmD  ueils) 2uoir iy4lpte iciat) Duaurp;o0teenmo3iad a ra(ms u0tltrxr tadfmteln o ( srxmxo iy4altemfvtlsfsrua(m ;o4aexn o3ilsfaDrl(mo t)tlxrxociydlm  aivs (0teumirpoo1lme  fvtat srtmx pot0aee ii3iatfm rmuvpnu) ltrir todfateliei;(0srtriopnydllen nct t) Dumxm ;t0olxnmo3tldls2rl( o;u4 exomf oodop  au i;t0s2tmir3nodlp  lictatfs2umumpnt0oexn ieiys a el(mo;(0 rtriociydom   i o
\ No newline at end of file
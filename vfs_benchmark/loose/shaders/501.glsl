@@ -0,0 +1 @@
+nvs () exoxm oodale liciatfaDtax  ou0oetomoctltlmDranvs;(0tlenxf3to1lpDelu ol(0trxmio iu1ap nmicils)arur(m ;u1tpxnmfciyd a2rau s;()artnmfctadopDelueolt s2xr(m3iydlmt  neils srtmxm nu1oet  fctaslaDemnvo t4teenxf3oatla r n o;s0seuoir3iy1llt micsas aDrrxmo;o1oltniociytfs rln o t4tltrif ia1laDrlnvi;( setoir ny4ll emfvt t)aDtm(r ot0olxnmietatfa2uln p t)teenirciatoaDr n s (0 exmiopiudolenmivtl( a2uaxm ;u0alx  octydfs ul( p;(0 etomr oydfpteanei () rxoim3iudlltn ncsasfsrtr( o;u0oltn i3ild m2rmu pn(4tetomr tatoptr uvilt  etm(r no1om  licia( sruaxr ot1ope mo3iadfa umn pn(4trerxf oytfm rlies;( t2xmim ny1al   nci s)s2urx p;t1aetoio3ilt m rmnmonu0tltrif oydfmt  nvs t)s2xr(r3oo4llee nct s a2ta(mono1oeenmf3iad a2eau p;t0altnmr3tytlpDelnvo;(0 2toxopoy4ap nlnei s)arraxroot0altomi3iydfs ulnmsn()trerxocoa1lpD lnei;()srtm(r3iu4am nmnct t sDrrumpno1opeoioeiasfsDulu onu4 lxomrciy1lmDr n slt0texrxrpio1lpte ieias) rumxrp;o1tltoifciltlm2ulnvs (0 rxrxf3tytop rli s;(  etm(r3oy4am elfei t)s2tm(rpoo0tltnioeiys sDul(vsnt0 rxnircoytoa   u i;s  2xm(o3nu4llt lnetls sDraxmpnt4aeenmf3iadlmDel(msnt4altoxo iodopt li sls)trxmxr iy4ll nmncs tf rtmx pnu4opt mfetasfsDuln on()tltrmr3oadlmD  ivsls0 etm(opoo4oleelfeiat)srur( o;u1texoioeilt s umn s;(4 exnxf3tadfa  lies t t2uoxmpou4olt lfvsls)sDtm(  ou4oeeomo3iytla2uan p () rtoiocoodop eluei s t2tm(mpno4ale liet (  ruax p;o4alxn ietldlmDem(vpnt0 exrxo ia1opte i i;t) rurir3nu4lp elnvil( sruau pnu4olen i3tysla rmnmo;u4 eerio ty1om e uvol(  eur(m io4lltelnesas  rrmxmo;t1olx ioeiys m rl(vp;u4trxnir ootopt lieils  2urxm iu4lmtelfvil(f 2tmxmo;u1olxnmf3tytls rauvp u0altrxf oa1oa  aivsls)seum(rpnodlpt livslsfarta(  ot4apxomoctyt mDran o;(4trtoxf3ia1omDrau i;(0trumxr3oo1llenmieiatf Dtm(r ;t1oeeomieildfaDrm( s u0 exrirciytla  anes;(0t2uoirpou1aleelnvtas)s2taxmpot0optnmociasfm2ua( snu) reniocto1fmDr ivs (0s2to(o ny1ll nmfctls sruaumpno0tpxo f3tltfm2umn p;u4artoxo tatlmt ln i ()t2uoxr iodomenmncil(f rtrxmp;o4aee mfciysfaDulu on()trxrxoctydomDe nvsls s2xmxrpiydapenmnvsat aDrmxr no4tetomo3tydlm rau s t4tlenmrciytlm eauvsl(  eurim3ou4altnmnctlsfs2tr(m ot0tpx iieiys s2uln sn(0 ltnif3tatfm e u sls srxrim iudll n nesasf rtaxronu0opx iietldlsDum( o;t4alxoio oytfm   uei;() etrio no1aptemiviatfarum(moot1oexomfciadfsDrm(vs t4aeeoxr iotopDrlnei;t)s2xoxopno4ape mictat)srta(mp;t4ole mietadlm rauvsnt0texoxr oytfat aneilt0trxmxrpny4omtnlfei s)artau ont1oexn f3iadfsDuanvo;() etnir oy1latelu olt) rxr(r oydamtnmncils) 2um(mpot0openiociysfm2rmnmonu)trtrmrctatfp   ies;( t2xrxr3io4lltn fetl(fsDrr(r oo4olxniociadlaDrl( o;(0aetoir3tytfmt livils) rtoir3iu4amtemiet t) ruru  ou4aetnifciytlsDea(vs;t0trxrmrciytlpD  i slt0seuoio oy4ape lnvt (fsDra(root1tpenmf3iysls2umnvo;(4trxnmo oa1fptr n i;s) ruoiopiy4amtelfvtl()aDrm(mp;o4alto f3iys a um(vsnu0texnmfcoadfmD ai il()srxriopio4aptelictat srrauro;o1apenioetltfa2ulumo t)alenxo3iydoa r neo;( srtoim3oo1ll nlfeias) Dum( o;o0optomoetlt s2uluvp;u)tlerircoo1lp r nvi ()srurirpnodop nlfvias)aDrrx  nu1aee  feiydlm ulnmo;()alermo3ootoptelivi;s0 euoimpno4lmtemictltf rtmumo;t0opxnmi3tyd a ean o;u0aexnxr3todlpDe i i s teurxr ny1al nmnes s) Dtmxm ;u1tpe  ictadlsDrluvpnu)tetrmocty1lpDe n i;s  2xoxo3oy1om n ietas  Drmum ou0tle mfciadfa rau o t4trerirctydoaDeli i (0 rxm(rpiodolt  fcslt)arraumooo1tleo oetldfs2eln p t0 etomociodfa rai o;s seuo(m ny4om  lietltfaDtax p;o0tex  oeiadls ran pnt) lermrcto1oa  an sls0t2ur(m3oo4ap  lnesltf 2tr(r nt0ape  f3iytfa2el( snt4 rtrifcoo1omD  iei;s  etrxo ou4apt lfcslt) 2tr(mp;u1tltn octas sDemuvo;u0tlerif io1laDrluvils setoxmpiydlm emnet t)srrr( oou1oeeo oeiaslsDeaump u0trermf3ta1la  liei;s0s2uriopou4lptn icilt s2rrurpnt1tptoiiciysla umuvp;()aexrmfcoatfp rauei;t truoxr3iodoltemnei tfsrta(ronu1teeo f3iatls rm( s (4 reoxr3totoaDe ueo s) rtriopnodopenlfvsl() Drmx  nt0tpxniiciadfm2em( o t0texomocoodopt livi ()texrxr3oudlpteliviasf rrmur ou4aetomi3ildfa rmuvp t) eeoif3tytlmt livol()s2umxr ou1ol  lnctltfsruaumpnt0texoiietysfs2el( s;t) rxomf io1lpDranvo s0tetr(m oodoptemneia( sDta( ont1tpxn fetytla elums (4altnif3oy1fptelieol() eur(r iudom emnvta() rum(r oo0oltoiieiad s eanmp;u4 eeoxocoadopDe iesl()t2urxr no4apeemiet ( sDrax pou0alxomictysls2ulnvo;t4 exrxf3ty1oa   neo;s t2urio3iu1am  mneil(  Drrxmooo1teeomo3tad sDumuvo;(0trerif3oydoa e ivils) 2ur(m oy1lpen ics ( artaxm nt4tptnmoeiasfm2uan o (0tlxnmo3ia1op   n i t0sexrir3iy1ll e nvtls sDtru pou4oex mieiytlsDul(mo;t0altomfcoytfptranvs;t)srtm(mpoo4lptnmivils  2rmxm oo4aeto o3ildlm2ran p;t0tetoirctatfat lnvsls0 2tr(r oydoptnmnesas)sDua(  ;t0oeenmoeias sDeluvs;t4artrxrctydfpD luvo;t0 exrxmpnudap emfvtat  2uru  ou0teeniieilsfaDranvs;u) etomr to1oaDr i i ( s2um(o3oy1lpee fvilt aDuaxro;o0aeeomf3ildfaDua(vs;(4alxrmo3iadfm  au ilt0trurxm3ou1amte neils)arurxm ;u0altnmoeiyt m ra(mp;(4 etoif3oytoa rauvo s) etrxm3iodape mfes sfsrrm(mpou0oee  oetatlaDulnvo t)tetomfcoodfp elneslt)s2xoirpoudomtnlnvils s2rmx  no4apxo fciat m2rmumon(4aetoir iotop  aivsls seuoim3io1alenlietat a2rmu pnu0tee  ociatlaDrmn p u) lxoxr ootoateauvo ( srtmxrpoodam e ieta( a2umumoou4ale  fcild a2uluvsnu4altoxf tadoptr ivo s0 etmxm3nydoleemivtatfsDrm(rpou0oltnmfeiltfa2eln s u)trxnir iydlatr i o;t)setr(o3oy4am   fvilsfsDtax  oo0ape  feiyt sDulnvp;u0trtrxr tydlaDelu olt srto(r3nodolen nvi (farrm(mpoo4optnmiciysfs ea(mpnu)aetnio3todopteaues;s0 2xmiopny4lmte nciat arrrumpoo0alenmoetydfaDrm( o (4 eenmr3tydlateauvs;s  2umio3oy1op n ieta()sruaxm ;o4alenif3ild s2emnms u4 rxrmrctydfptelu s s0seurir nodopeemfvsatfaDrrx  no1alxoio3tys a el(monu4alxomrcty1lmtelies;t) 2xoxm no1amen fciatfa2tau  no4tpe  o3ilt sDrluvp;t0trxnif3oytom e n o;s0 2xmxo oy4lp elfeil() 2tr(ronu4tpx io3iltfmDrmn p;u0aetoircta1faDe nvol()s2xr(o3iu4omte fesas)srrmuronu1tpeomfeiadfs2ea(vpn()aexrmf3iytlmDe i o;t teum(m iudap  mncs ()aDuaxmont1apeniieiadlsDumumo (4alxrif3oodfptrlu o;s)trxo(m nudllenmfes (f 2ur(m oo1oeen ieiltfmDemnmon(4 renmo3iotomt li il( srxrxopiydole  ieiasf rra( o;u4oex ii3tydfm emn o;(0altrxr ia1lpt au o s trxrxm iodlme lfcil()aDumu  ;u4tlt  i3tls s um(mo;t)tetoxf3ty1fa e i s;t0sexmxopiy4lptelfvtlt artauroot0tlxn i3tytlm rm( on(0arxnmfctatlmt  nvs s) etmxo3nu4lptemnvsls  2rrxr ou4alxoio3iytls2umuvsn(4arxoiocootomDrlneo ( texm(rpny4alee nvs (faDraum no1teen iciydlsDumnmp;t4alermfctadomD luvsls) etr(opny4am elfcsls  2tr(mpnt0ope ii3iat m emumon()tltrmfciodla r iei s0s2tr(mpio4lleemfeslt) rrmxr ;u0oleoiictls mDelu s;u4 etrircto1fpD auvil( trxm(r3nodopee nvil()srur(m nu1tlxoioctat s2emnvs t4tlerxo3oydfatr n i ( t2uoxm nudopt mfeia() rrr(rono1aeenmictltlaDranvo t4trxoif todom rai sls0t2ur(m3io1apt  ncsltf 2taumooo0olto ictyd a rmumo;t0aexomr oodfm   i o;s0seuo(r io1om e neiltfs2rmur nu4optnifetat m rluvp;u0 eenmr3oo1fp  lues;()srurim3oydlptemnct t) Drrur nu4olx  o3tld sDuluvp (4 exrir3tatlp  lu i t0 rtoxo nydam nmict s)sDrmumo;o0ape  feiyslm rm(vs;()treomf3iy1faDr uei;() 2umiopou1opte icias arurxmoot1altnmfciydfa rl(msnu)aleomf3iy1fateaivi s0s2tmir3io4oleelnvilt a2tmx oot4alt  f3ildfm2ul( pn() etrir oydla raieo;t  ruoxo iodomtn netl(f rtru o;t4opt ifetlsfm2rlnvs;() rxnio tytfa r ivo;t  2tr(r3ou4ale lfvslsfartr(  oo4alen iciyslmDemuvs u4 ltrxocootla elivslt sruoxr nodlleelfeias aDtax p;o1aeto fctadlm2umnms;u0 rtrmf iatfp   ivsls0 2xrxr no4ol elies s  rrrxrooo1ale mo3iatls umn p;u0texomf tatlaDrauvo (0 eumim oo4omt mnciatfa2rmurooo0oex iiciad sDel(vs (0 eenircootlpDeauei;(0 2toir3oo1om   ietat) 2ta(mpoo4opxo o3iysla ran s;u0tltrif oydlpDeli ilt)seumxr3oo4amtemivils sDtr(rp;t0apt miciaslsDemnvo t) etrmo3tydoa rli olt0t2trxr nodame lietl() rumu ont0ope  ictadlaDum(vs;t) rtrio3tytoaDranvo t  ruo(rpiy1ll  mieil()a2tm(mp;u0aptnmi3ias aDra(ms t)trxnmf io1lpt lnes t) 2toiopoudomen nvsa()srururpnu0tee  fctldlsDulnmpnu0 lerif iytoat lnei;t) rtrxo3oodame lnviat)artaxm ot4tptomi3iytfsDum( s;u0tltomo3iytlateaivol( t2xrxr3oodllenmncs s a2ta(r oo0aptnii3iytla2el(vp (4aeeoir oa1fa raues;s)texm(rpoy1opt lneia()a2tm( ont4texniieiadls2ran snu4texnio oa1opDrln sls)teuo(opio4alteliesasfsDrrx pnu0opx iieiltlmDuanvo;t4alerio oadlp eluvs t  2tmir3nydlp  mfcs s)artmx pou0tleo ictatla ranmont)altomociatlptranvils  exr(opiudlmtnmfvt tfa2umx  ou0tlt  fetasls2emnmsnu0 rxomoctodop  luvi (0s2tmir3no1al e icia(fsDrm(m ou1apxomfeils s2eauvsnt0trtoir3oo1fpte u o;t0s2ur(o3nydol e nvtlsf 2rrxmpot4aetniieiydfs umnvs (0 renmr3io1faDe nvo;t trxmir nu1olte nesasfartau p;u4altoifciadfs2rmumpn(0trxriociytomDr u ols setr(rpoy4optnlfet ()sDrrx  nt0altomfciatlm2rlnms t4 rtrmfcoa1lpt auvi;s sexmim ny4llt lncilt  2urur oo4tltn oetyt aDua(vs u0 rxoio3iatoptelnes ( t2tmxr oo4op elncslt)sDraur no1tpeo icilsls2rmu o u) rerxo3ootoateluvolt0s2toio ou4oltnmfci ( srtau p;u4tpeo ietydla emuvo u4altrmr3totla elnei;() eumxo nu1ll nlncta(f 2rmx p;u4ope moctlslm2emu pnu0 lermrcoydfmtelivi;t  2uoxr iy1llteliet t  2trx ooo0ole  feils m2el(vpn(4altoio3tadfpDe nes t tetr(m3oy4opeelnvtls aDrr(  ;o1olxo i3iasla2rlu pn() exrmr3to1fptranvi;( t2um(o ny1ale  ivsl()a2rrxm nt1apenmi3iytfaDuan o;u0tetnmf ootfate i sls)seumxopou4lmenlfet ( sDtau  ;t0aeto oetldfsDeanvont) lxnmfciodfm e ies;s) 2uoir iodamen ics ()s2rru p;o1olxoiictysfs2rl( o u)trtnmr3tatfmtraivil(0 rtr(o3nydap   fvi sfsrumurooo4aeenmictldlsDrau p;()tlxnio oy1omDelivo t)srtmiopiy1lm n fvilt)s2raxrp;o1olx mo3iltlmDeau pnu0texomr iy1fatranvs;s)texriopnodal nlieiatfa2rrx  ;o1olt iociltlm rlu p u4tlerxf iotlat lneo (0 rtm(m io1aptelnet t)sDrmxr ;t1olenioeiydfmDulnvp;u0aleomr3oo1lp   nei;s  rtriopiu4optelnvsat a2rrx pnu0teenmi3tasla2ran s;()aeermo oytomD lu ils) rtmxo oo4amtelfvslt)srtmum ot1alxomicild mDum(mon(0 rxnio3ty1oa rau i;s0 exo(m3oo4ape lnes ()sDrax  ;o0tlxoio3iydla2el(vp;t) ltoirctodop   n ils  2umim nodopeelnetlsfaDrrurpno4opxnmociysfmDul(mont) exnxf oadlpt  nvol( teurimpiu4opee feilt)a2tm(  ot4tlx  oeild a2ranmo u4altrxr3oodopDelivolt)trurxopoudlp nlfcsa()aDrmu  ;u4optniiciydfsDuau o u4altnmo3tatfaDelues s texrxm3oydome mfvs ()arua(ro;u1aetoiietytlmDrmump t0alxnmf3todlaDeaivs ()sexmxopiu4ameelncs () rrauroou1aexomfetadlaDumuvs u0 lenmociy1oa  li s;( srtmiopoodamt  ici s srtrx  oo0oeeomfeildfs elump;t)arxoiocoy1fpDelieo;s s2xr(opiudomtemfes sfsDumu p;o0tleo f3iys sDranmp;(0teeoxr oa1op r neslt seumxm nu4omeelfctl() rurur nu4oex  o3tysfm2raump u0tlxnmr3ootoaDean i t t2ur(m3oy1ol n nvs s  2urx poo4olt  ietldla ra(ms (0 lxrxo3oatop raivol( srtmir3nudomte fcil()sDraxmpnt0tptoii3tatfm rmn pnt0altriocoadfp eln s ( srxmxm io1amee net ( aDrau oou4aexomoeiatfa2rmn p t0 eenif iytom eau il(0s2uo(o iy1apenmici ()a2uaurooo1openifctldfm eauvo u0trerxr3totoa raneo;t)t2um(r3iodap emfvia() Dtm(mpnu4aee iiciat a uauvp u)tlxnir3ta1lm  auesl(0setmxrpnodopee ies ()a2tm(m nt1aee io3iltfsDemuvs;(0tlenif3oo1fp rli s;()t2xm(r3iy4lltn icslt)arrrumpoo4tpeomf3ilsfs2eaumsn(4tlxnmr3iydlp r u olt seuoxrpiu4amee ncsl(fsrraxmp;t0tptoioctat m rlump t4aetoxrctytfa rlu sl()t2xrxm3iudole  fvtat)aruaur ou0opeomieilsfmDel( sn() rtnio oadfat aies (0 2trxm3nu4ll nlnvs t sDur(r ;o4oeto octyslmDelu p t)teermr3tydfp   ueo t0seurimpnu4al nlivia(fsDrru  ;u4tltnii3iytfs2rln pnt0texnxf3to1fp  auvil(0t2uoxm oo4alt  fetlsfarurxm nt4aeeoifciltfs umnvs;t)tlermo iydom   uvilt0trumirpiy1omeelfcsat  Dtrum ot0olxoii3tld s2uln pnu)texomr oydlpDelnvi s s2uoxopny1omen ncias)a2rmx ono0tpeomoeiydfm2rm(vp (0tlxrifcoatfpDrlneo;( srxr(opoudlpe  nvt ()aDtru  nt1oex mfciyt s elnmp (0trerir ia1opte n ils s2xm(r ny4amtnlivtl( sDta
\ No newline at end of file
@@ -0,0 +1 @@
+nvils) rurxmpiu4apte fviltf rrrxrp;o0olx  oeiadfa emnvpn(0 eenircootfaD ai o s) exrio io4apen fvsasfaDurxr no1opt ifctltlm ra( sn(0teerirctadlmtrli ols0t2xrir ny1open netl( a2tm(rp;o1ole  ictytfs2rauvp t0aetnio3tydopDrai s ( srxmio3iydom  mnei ( artax  nt4apxomicild mDra(vp;u4altnxr3ia1fmDr neo;t srurxo3oodom elnvta() 2um(mp;u4texomoeiadla uauvo;t)tleoxr iytfmDeanvil( s2uoirpoydlpee net ( aDraxr ot4alt mocilsla2ul(vo;(4 leoir3oodfm eanvol(  rxoir3oo4optnmiei tf rtmx o;t0aeeo fctldfa2el(ms;u0 rtnio oydop  an o () eurxm no4am emfvtl(f rtm(mpnu4tle  ictytlm2rmump (4aetnxo tytopD lu s;(0 2xoxr3iu4olenmfcil(fa2tax oou0oltoiiciasfm umuvp ()tlxrmfcoytoaDeaivo s0 rtmxopnydlle mneilsfsrra(r ;o4apxnmfctyd sDeanms t4trxnif oo1lm  li i;s  2urim iudomeelnvtl()s2truronu0olenmi3iaslsDranms t4 etrmrcta1latrlivs;( truoxopiudlltemics t  Dtaurp;u0oeen oeiysfsDelnvs u0 rxnircoatlatrlivi;()t2xmio oudol e nvi ()sruaumoot4aexnmi3iasfaDumnmsnu)tltnmoctatoa eaneols0t2tmirpiudlp   fci t  2trurpnt4ale  ocilslm2rlnmp (4arenmr3oo1faDeanes t  rurir nu4ll nlncslsfarta( p;t1opx mociyd m ulums (4trtomrctytom elivs;(0 exm(opiy1llt livs s)s2rrumooo4altoioeiltla2el(vp t4 rermr ia1la rlivils0trto(o3oudll nmfci t  2ur( ono4alxn fcias sDumnvp;(0arxnmfciy1fm  an i ( seumxr ny4ol   fvs t  rtr( onu4aleo ieiat m rm(vs;u) rxrxrciy1opD aues s  rur(o3io4amtnlietas aruax pou4optnmo3tatfs umn p;t4arxoio3tydfpD aues;t0 rxm(o3iy1ome  ictlsf Dur(  ;t4aee  feils s umuvs () rtomf3totlm elnei;s s2tmim3iodlp  mnctltfsDurxmpou4apeoioeiltfaDemu pn(0 rxrmo3oo1la r ivo;s0 2uoim no1amenmivi t sDrauro;u0oex ifciyt s ra(mont4 ltnxo ootfpDeaueo;s)t2xriopio4alt  ies tf 2rrx  ot4aex ifcildla uaumo;t0aetnmf3ia1fmD auvolt0tetr(o oo1apee neiat)s2rau  ;u1aeen oeiasfmDum(mp;(4aexoxrciotomDeaivi;t) ruoio oo4omt livsatfs2tauront0texoifctldfm umnmont)alenmo3oadfate ueol( sexrxm iodome mfes t a2umx pot0texo ietld a2rm( p;()alenmo oydlpt  nvsls0sexrio nudolen nvsa(f 2taumoot1aeeoio3tld m rmnms (4arenmr to1opte uvi t0seum(r3iu4lpt lnvsat aDtrxm ;u4tlxn ieildfm rmuvsnt0 reoxr3oytop   ivol(0 etoimpou1ap elnctl(f 2uau o;u0alen ocild m uanvsnu)altomocoadlm ranvs;(0srtrxopio1al  lfesa(f Dtrxr ou1alx mieiadlaDemn o t0texrir to1fm rlu o t) etr(rpio1am nmivia() rtax ooo4tpe ioeiyt s emn p;(0altrxf iytopD luvi;(0tetmim3iydal  miciasfaruax pno0tee mfetydfm2rmuvp;t0treoxo todom rli ils)tetrim no1op  lieiasfa2rmu o;u4opeo ieiytfa elnvp;(4 lerxr io1fp e n i s)s2xoxm3oo4omt  fcias)sDtaumono0tlt  ocildlaDul( p;u0 eenxociydfmt lieo s texmir3ou1om   feta(f rrau pot1oeen i3ilsfs2eanmp t)altomo ia1lpD  nvo;t0sruo(rpnodlp  lfciasfs2uaxmpoo0teeomfciadfs2rln o u)aexnirciodfmteauei s)t2urim3iy4ol nmnvs (f Dtrxm ;o4oexomi3tltfs ea(vp (4altomrcoadlpDr ieol()trtoxo no1al e fct sfaDtaxm nt0apxoiictytfm2uau s;(4texomr3to1omD  nvo s)s2xr(m io4am nmfetat)sDrr(m ;o0tpe  i3iyd aDraumo;u0 exnmo3iotlpt aies t0 rxoir oodop   fct ( sDrrxm ot4tpenifctys m em(monu) rerir3ia1lp  ai i () eto(o3nu4opt  fci ( aDurxro;u1altomoetlt mDumn p;u0trtoxf3tytoaD ln o s)s2urir3nu4olt  fcias) 2tr(r ;o4tlx  fciyd s emn sn(4 rxrmf tydop  aivol()t2xo(m3nydll emfct tf Duru poo1aleomi3iad a2eluvs t4tltnif ootfmDrlneilt)s2uo(r3iy4apeemivt tf 2uau  no0teen fctlsfsDrl( s;t0artrxr3oy1la elivols)s2uoiopoy1lp   fvs s sDuaump;t1oltn feiasfaDrmuvs u) rtrxf oodfa e u s t) rumir oo1amtelfei tfsrtr(  no1ape  i3iadfm elnmont0aeenmf3oytoaDeluvi t t2urxo3oo1am nlfvilsfaDrm(r no0tpen i3iatla2eanvont0altrirciytoate ieilt t2xoxo iydamen fci () rtaxm ;t0ape ifetadfm2eanvpn(0tltomr3oytfpDe uesl(  rxmir oydal nmfvs t)a2ur(  ou0tee  fctlt m ua( p t0teeoxrcoo1laDrauvs ()t2xrxo no4alenlncslsfarua(rpoo1ale moeilsfmDua(mp;() reoxo oo1fmD auvo s  etoim3iydom emivslt) Dra(ront4oexoio3iltfa rmn p;(4aexrxfcty1fpteli i s0trxrim3iudal e ies ( aDtm( pnu4tlxnioeils a umuvo;u0 eenmf iodoaD luesl(0t2tm(o3nydom emfetlsfarua(r no4aexn fciytla2eluvs;(0tltniociotoat  ivsls0 2umirpnydomenmnvsl( srrm(rp;u4olx ifetatfa2uau pnt0tlenxf ta1lmt li s;t0srxm(r no1aptnlivta(fs2rr(  ;t4tpxo oeiys a umump;t)trerxo tadlmtraivs;t0t2umim iu4olee fci tfsDrrxr no4tet iicildlaDea(vs u4artrxociodfateli s t0 eurirpiy1olee nvs t s2tmxr ;t0tpenmi3ild sDea(vpnu)trxoir3oo1oa   uvs s t2uoxrpiodomtn nctlsfsrrr(rp;u0aexnii3iydfs um(mp;u)trxnio oadfmt anvs ( sexrxr3no1lmeemncils srrrxront4opx iociydfs eln o;t0teeoxr3oydfate uvils)trurxo3io1lmee fctlt) Dua(m oo1tlx mietad a ua( p (0alxoioctodla  aiei ( srxrxopoo4amt miviasfsrua(ro;t0alxn iciatfsDul( snt)areomrcoa1op rai o t)teur(o3oy1omte neiat s2tmxrp;o1opeoioeiasls rlump;()trxrif3ootfat  n i t  2xr(o3iu1aptnmnvs t)sDtm( pot0tpxniociytlaDraumo u4 lxrio3oa1oa r ieo;s  2tmxrpoy1lle mfcta(farraumono1opxoif3ilslsDra(vonu)aetnmrcoy1lmD livs ()teuoimpno1op e nctatf Dtau  ot0oetnif3tyd s2elu pnt4alenxf3iatlpD auvslt) ruo(opio4al   fcs t) Durxmp;u4aee iocias aDrmn s;u0 lermr3oadfat anvsls) rxrio3io4lptelfvs (f rtmu ono4tpxn i3ild a ulums;(0aexrifcto1opDrlnvs s0 2uoim iodol  lneslsfsDtr(roou1apenio3iydls2eaums;(4alenxo tadfpDe i s;t)sexmirpny1ape licsa(fa2tax pnt1oet  ociadfs2ranvon(0texrif iadfaD  ies s  rxmio3io4lm  mnvsat) rtr(m ou4tet io3ilt aDum( p u)arxoxr iytop eai i;s0 ruo(r nudale mncil() 2rmx ooo0opxn oeiltlsDelnmo t0aetrio iodom   n s s)teur(r3iodaleelivslt a2uaxmpot0olxomi3tasfs elump u) ltoio oo1fpteai s t seuoxopou4omt  fvi t)srrau o;o4tptoiieiytfsDuan p;t)aexrif3oo1fpteliesl( srur(o3nodlptelfcs t) Dtaxr no4aptn ociatfs2rmnmsn(4aetoir3totomDelu ilt)s2urxo iy4alen iet t)arur(m ot1texo fcilsfm2rmumo;t0 etoir oo1omtr ueo;(0t2xm(r3nu4omtemivi s) rraxrpno0tpe iictasfs2emu s;(4teeomr3oo1omt ai i;t  2toxm3nodll emiesat)srtmur ;u1alx iociltfs emn s u4 exoio3oo1oate ueo;(0s2trio ou4amenmicsls)s2umxrpnu1olx  o3iasfsDeau s;u) rtrmr3oydfptr iei;( s2umio iodlltnlnetlsfarua(r nt4tpxnmociasls2umumonu4aexnmocty1op e nvols0 etmxr3nodam nlneil( aDur( o;o4tptnmi3iatla2ul(mpnu0 eerxo iodfa  au i;(  rurxo oo1amtnmictasfaDumxrooo0aexn feiytfm2eanmo (4aetnmoctadlpD livi;s)s2tmxo oydlp emfcs t)s2rm(  no1ale  i3iyd s2rl(mp;t0trtnxrctadfp  lnvo s srxm(o3iu1olee nvta(  2tru ono4oexoifciyt m ua( o;u4 rtriocoydfa r nvs (0s2umxm3oy4lmtemicsa(f 2uaum nt4tee iieiydfa rmnmsnt) rxnirciy1fateau sls  rxrim3nydomt  fet t arrax ono1tex  ietlslaDrl(vonu4alenmrctydlaDeln sls texmimpoydap   icils) rtrxroou4aetn o3iyd a ul(ms;t)trtoxf3oa1fm eanei t)t2umio3io1lp  mnci t) rumuro;t4aetnmictad s rau on() rtrmo iydopt  uei;t sruo(m io4lp  mivs (  Duaurpou1ape  fciydlsDra(mp u) ltrxo iotlm rai i t sruoim nudlpt lfctlt) Drmum ;t4oeenmi3ildls2rlnvo;t4tltnmfcoo1fmteauvsls texo(m3iydamen nviatf Drax  ;t1aptnmfeiyd sDumu o ()texoif3iy1omt ai i t0teuoir3no1ol elnvilt  2tm(  nt0texnmicilslm rmuvon()aexrmrciatoa e ivo ()trxrxopiudlpte feils sruau pno0optomf3iys s2raumsnu4 rtomr3iodfpDeaueil()trxo(m oydlle mivslt)aDtr(monu1aee moctyd a2emu p;t4 eeomo iydfmteli ilt  eur(m3ou4ol  lfciasfsDta(rpnu0aee moeiatfaDuln p;u0 etrmocto1faDrlneo (0texm(m3iodalt  fcias a2rr(ro;o0teenmietasfm2ulnms t0treoif iodlatr neo t0 rxmxo3nodom n feilt sDtmxm oo1aet  oeildlaDemums t4tetnio tydfp rluvs;t0s2xr(mpnydape miciat)artmxroot4tpenmf3ias s2rau sn()aetnmo oo1laD  ueilt trurim3iu4lleemfvt ()artm(r no4tex iieiaslm ul( pnu)tltnxrciotfm rlu s t  etm(rpoo1lmen fctl(fsDrrumono4oleo i3tasfm2rmnms;(4teenxr3iytfaD  nvo;t  rtr(m3iy1lm e fesas)arrr(mont0tlxnmfetls a um(ms ()tlenmf3tytom rlu s;t setrxm3nydopen ieiat)aDumuro;o0oexoifeilsfa ulnvo (0tleomf3tydom  ai sls) euoxr3nu1apenmnvt sfaDtm( ooo0aetn i3iat m uau on()texrxocoy1lat aivs;t s2xmim iy1ol n ncsa(fsDrr( o;o0apx mociyt sDea(mp;t0alxrmr3io1oa rai i ( setmiopoy1ap elivias  2rm(ro;t0tlx  f3iytfs2rmnvpnt4 rtoirctotoptr uvi;s0trtoiopno1al   iet t  rua( pou1opx  o3ilsls2uanvsn()arxrif3iydfa eln o t0srxmxr3iy1lmenlfct ( srrmumonu1tpt  ociasfmDran s;t0 lenmfcta1lmtr ieo (0 eumxrpoydlpte fesltf Dtaxmoou0olto i3iatfs2raums u4tltomoctadlp   ivs t  2tmirpiydllenlneilt s2tax p;t4apx  oeils mDra( sn(0 etrxfctotlptr u s;()seuoir3nudopenlfeils a2ta(  nu4tlenii3tyd aDum(msn(4alxrmo ia1oa r i o;t trto(o no4lle  ncsas a2tr(r nt0apt  ictlslm uaumsn(0alxrxrciy1laDr nvs (0t2uoxo3oydlmt mfesa(  2tmur oo1alxnifctls s ulu p;(0tltoir tatopte ivi;t)srto(o no4llt mivsl() 2rm( o;u0opxn ieils mDran pnu) rtnir oatfpt  ues;s  ruoxo iu4omtnmfesls s2tmxm ;t4tpenmicilslsDea(monu4aeermocoytlmtelivsl( t2toxo nudlp  lieiat s2ur(r ;o0tleo i3tatfsDrlu p (0arermfctadoa elneo s0 rtrxr3iudal  miei (f rtmumpoo0opx ii3iydfs rmu o;t0aeeomrcoatla rlnei;s) exm(m3nodol e fcsat) 2uaurpnu0oexnifcildlsDuau pnt0altoxf iotomDrln s t0t2xm(opnodopt mfctls s2tr(r ot0teto oetls s rau p ()teeomf3io1om elieo ( trtmxrpiodamtnlnct t  rur(mooo4tpx moctysla2rlnmpnt4tleoxf3oodop  anvi ()texoio3ny1omenmneils a2ur(  ;u0oex mfeilsla2rl(vo;()alxoir totfmtr uvil() 2xoxr ny1omeemnvsat  rrax  ;o0openii3tyd aDea( o;(0 reoxo oydla eanvo t t2xoxm3io4al  livsl(fa2ururpnu0tpxoiociytlmDrmu pnt)alxoif todoa eauvs () 2xr(rpnu4ol e ictas  Dtru p;o0tle mfctltlmDel(mp;(4tltomf3tytoatrlueo t)seuo(m3nudop  mfet s srurx poo0teeomoetyslaDua(ms ()texnmr3iatfm   n o (  etmxopno1lmteliei (f 2trxront1opx mocilsfa2el(vpnu)tleoxo3io1lp e uvo;s tetmir oo4lme mfviatf rtmx pnt1altn o3tyt m rau sn(0aeeomf3tadfpDr ivo;(0 rxmxopiy4lpe  ivt t)s2uaxm ;u4alxnmietlslmDumump u0teenmocio1omt ln o;t s2xoxo ny1lmtnlfct sf 2rrxmoou4olt  fetytfs ra(vp;u4arxoxf3iadlaD aivsl( srtmxm ny1ol nmneslt aDrrxr ou4tetnmfetad s em(monu)teerio3tytopDranvs s) exm(rpou1lmtelfvils s2umumoot0tetnifciyslm2uanmpnt0 rerir3todoa   nesls srtoir3nodapt mivtas)a2urx pot0opxn ieildfs2rmn on(0trtrif iadfp eai sls texo(r nu1olenlncsasfaDurum ou1ape  o3iydfm2emnmp;t)texriociytfpDelivolt sexrxo3no4ll elietlt)arrr(mp;t0alenii3ild s2rmuvo t4 rxoif ty1lp rln ol( t2xrxm3oo4am n ivslt artaxm ;u0tex io3ilsfs2elnvs t4 lenxf3to1fpDeau ils)seuoim iu1am   icta()sDtrumono1tpeoio3iasfm2rmuvp;u0 rxomf3oydoptr nvi;s0sruoirpiodal elici sf Dtau  ;u0tlx moeiyd m2el(vs ()arenir3oadfmD lnvo s) exm(o3iodaleelictat  2ta(rp;o1aeto fcils m rln s u) lxnxo3totop   n il() eurir nu4lm nlfesl()arrax  ;u0olt if3iytfaDel(mp u0altrif to1lp r u i s)s2tmim iudlme  fctltf rraxront1tpeomfciydla rauvp;()alxoxr oytfptr u s t) 2xoxm3nu1ope  fvi (fs2tr(  ;o1aet  feiysls2um( p ()altnmr3oodlmteli sls)sexrxm3oydol  lfci t)sDtax p;o0oeen feiltlaDuan p;(4arenxrcoadlatrlnvs;s)srtm(m nu1amen fcsatf rraumoot0tlxomi3tatlm2rmnmont4 lxoxo3iytlpD lieo;()t2uo(o3oy1optnmncs sfs2trxrp;t0tle if3iys a2ea(monu4aeermf3iodla rluvil(  2toxo3no1opeelfvs s  2taxmpnt1alxnmfeiysfm2ranvs;t4 etnio3oatomtr neil()srxm(mpnu4lmt mnct ( aDumu poo4oltn ietasfs2rmums;u4tetrmfcoadlaDeli sl()setoxr iy1op n fcs t artm(  ou1ole ifeiaslsDem(mp;u0 rtrmo io1omt lieo;t) rtr(m3iodllt lfeiat)a2rau  oo0tee mieilsla2rlu ont0trxnxrciadlpDe nvolt)srxoir3ny4ame  ivtlt arurxro;o1apenmo3iys aDumnvs (4 reoxr iytla e nes;(0sexmxrpou4om   ics t)s2tax p;o0tlxoifeiytlm emnvp;u0tlxoifcoa1oaD  u o s tetm(r io1omt  fctls s2taxroou4oeeoio3iadfm2em(vo;u0 eerif3iadlaDeli i () exmim iu4lltemfcil() Dtaum ;u0opeo ietas aDrl(vsnu4alxomocoytlat au ols0t2xrxr3ou4lmtelnci t aDurxm ot0apt ioeias s uluvonu0alermoctotfa  auei;( trur(m iydlmeemfctl( a2tm( oot0alxo fctyslm ua(mo;t4artoif tytoa   uvs;s)seum(mpny4amtnlfcia(  Drrxr ;u4tlx  iciyslmDrm( pn(4 etnxo ty1oaDeli ol() 2toir3iydaltn ici (f rtr(m ;t4optn fctls mDeau s;t) lerirctytfpD an o t) 2xr(rpou4optn nvtlt)srtrurp;u4ope  ieiytls2ea(msnt0 lxomf iodlpD ln o () 2xrxr3iy1lmtn ivt sf rta(rp;t4tlto fetadfsDuln snt4tlxrxr oa1fp eaneo;t setm(o3io4al  livsa(  Dtrx poo1olxn o3iltls rmnmp (0arenxr oo1laDrauvi s s2xmio oy1ape  netat a2tmxmpoo4optniictldls rmums u4 leomo3totlpD lnvolt)s2xoimpiy1am   ieils) 2taumono0ale ioetls a2uanvp u) rxrxf oa1oaDrliesls) 2trxopnydlptemnvia(f rrrx  no4olx  octadfm2rl(vp;u4aexrxocoadfa rlneils0setrxo nu1lmtelneilsfa2tmu  no0aleomo3iytls ran s ()aeermocoa1laD li o t0s2umiopoy1apt mieilt  rtmxrpnu1tptn o3tlsfmDuluvs u)texoirciadfmDe i slt  rtr(rpiy4optemici (  2rmxr ou4oltomo3tytla2elumo;()arenmf3oadfa  anvs;()sruoim io4aptnmiesa()sDtauro;u4oee iiciltfa2rl(mo t4alenmfctydlm  auvo;s  rtoir3iy1lmee ivtat)s2rmu ooo4apx  iciltfmDrlnmo t4tlerxf oadfmDeaneil(0teur(o iy1ap   fvt s) 2umu p;t1tpto ieilsfm rm(mp;t4tetoxo ootlpDr ieilt0t2xo(r iy4am n ieiltf Dum(r ;t0aeenmiciasla2uau p u4alxomociytlmDrluvo ()srurim3ou1optnlivsas)a2tmurp;u0aee  fetasfm2rm( s u)texrmf iadlpDr n s t)t2toxmpnu1lptn nct s) Dua( oou0tet ioctys a rmnvp ()tlerxr3iodfpDeanvols)srtmim3oudlp  lfvi t) rrru poo4tlxo feiadfsDum(vont4tltnircto1fa  li i;s)trxm(o3oydoptnlicta()a2tmx pno4aeto iciat mDuluvont0tetoxf3oatop r u i t trtmxmpiy1ap nmnes t)s2rm(mp;t4ale mi3ildls2ra(vonu) rxrmocoy1laDr neo (0 eumim iy1opeelfeias  Draxmono1tlx  o3taslsDel(vont)aexrmf3oa1oa r uvils0 2umiopny1altelneil( aDua(mo;u0tpt miciydfm ra(mpnt4arxoio oydla rlu ilt0trtoiopiu1lme mnctlt a2raxr ;t0oltnioeiydlmDuanmsnt0artnmfcoo1laDrlueilt0teuoxo nodamtemivt ()aDur(mono0optoioetad sDel( o ()aetoio tydlp eanei t0t2tr(mpiodol emncsas)a2trumoot4opeomieiatls2rl(mon(4altoxf iotfaDr i sl(  rtrxopio1al  lnciat  Drmu pou0tee if3ias m2umu o;t4artoir ta1oatraueo (0 2xmxr iy4lptnmiviasfaDuaxrp;u4aex mf3ilt sDrmn snu0 exnmo ia1opDrauvo t)s2xmxo ou1op emivslt  2rm(m ;t1oltnifetyt m2rlnms u0 rerircoo1fa raivi s)t2xoim3ou1lp nmnvsasfs2tr(m oo1opeo ieiytfmDulnmp;u0 exrmr to1lmD luei;t0 eto(mpoy4om e fvsl( aDtm(  ;t1apto ieils s ranms;u0arenirciodoa   iesls) etr(m3ny4ope  icil( aDtrxmo;u4altn icils a uanmo;() exnif3ia1la ean i;( teumio3iodolenlivias)s2uaur ot0olx ifeiytlmDelu s;u) reoxo iatoaD aiei (  2tm(o3nydlmtn ietl( arurx p;t0alt if3iatlm2elu p;t) rtnmf tytlp   ueo;()s2tr(m iu1amtnmivs ( srua(mpnu0oetnioctad a2rmnmp t)aetnxr tadlpD lnvi;s0 euoio3oy1am emfesas)s2rmxm nt1altn f3tltlsDrlnmont)areomr iotlmt  iei ( s2xo(m ny4lpenmnesltf 2uau pnt1aee ioeiat s2em( on()aexnmo ta1lpDraneo t)sexmxm3oodlpt liesa(f Drrum nt4oexomf3iys aDrlnmsnt)tleoxr oadfpDrlneo s) eumir ou4llt licsa()aDrmx o;o0oltn ictls aDrl( s t4trxnio oadoa eli o;s  etrxm no4lmt mncsas srua(mpnu4oltnmfeiyd s2emumo (0 lxrxr3oytom r ivi;t srxrio3iydlmtnmivtls srrru pno1opxo f3ias sDrluvp;u0aeenifcoydfat luvs;t)seumir nu4opt mncslt)sDtrxmo;u4texnmfetaslm2uanms t4 lerxf3iydlaDeanvi s setoxopoudlp n ivtlt)aDra( onu1apenio3ild s ulnvsnu0 rtnxr ia1fmDr ueo (  2xo(m nodalt  neiltf 2taxr ;u4oee if3tat m2rmuvon(4trenxociy1opD lnvs t  rumim iydopt mics s arraumpnu0alen o3iatfsDuanvp;() lxomf3tytfptr nvo;s0 2tm(m no1apt  fes s  Dtr(r ;o1tpxomieilsfm2elnvont0tltoir3oy1oa   u s t)tetmxo3nu4ape mfvt tfa2umx o;o1oeeo fetld m2um( pn()artnio3oo1om  ai i ( setmiopnydlmt lnct tfsrraxrpno0opxomi3iltfsDuln o;(4 rtrxr3tytfaDeln o t t2tmxm3iu4oltnmnvs s)arta(mp;u1tpx  ieilslm2umu s;t0teeomo iotlmt au s t0 2xmxr3no1om emnviat  Dtr(rp;t1tptn i3tas m2umums;(4arerxfcio1op ean ol( truoir3io4alt mfet ( aDrrxrono4tlt iieiytfmDrm(vs;(0 rermf iotfat  n i ( srxm(r3oy4lpeelnvtl(f 2rrurpno1olx  o3ilt m rln pn()tlenmo tydlpt  ies;( texr(m3nu1ll nmieil( a2urxrpot0tptomocildfaDrluvo;t4texnir3io1lmte n o s0seurxopoo1ome micia(fa2ur(r nt1aeeoifcilsls elnmp;u0treoir3todfmD lneils  2ur(r3oo1omtelict () rtau  nt0teto f3tys sDran snu4artnxr ia1om r nvo (0s2tmxo3oodom  licsl( arrax ont0apt mociys a2ra(vsnu)arenmr3oadfaDeliei;( srxmimpnydlme  fviasfs2tm( pnt4opxnmfctytfm2rlnmsnu) etoxo ia1opD lnvi ( srurim io4lltn netat s2ra( pnt1opxnmieiatlmDemn pnu)tlxrxrciatfpDranvs ()srtm(r3iydopt mfvi t) 2ur( poo4aeenifciyslm2rau sn(0alxnif3ootfp r ueo s0sexrio3iydoptn feilt) rtmumpoo1ole  feilt a eaump u4 rtnmo3iytomt ai o;(0 2xmxopiu1lptnlics tfsrurxmpno0aexnmoeiltfs2rl(mp;t)texomrctotopD lneols sexo(o3ou1ole mfvi ( s2urumoou4aexomo3tlsfaDeluvs (0trxnmf3ta1fpDran s t  exmim nu1ope  ncta( srumx ooo0olxnmi3ilslsDel(vs;(4aexnif3oa1opDe nesl(0s2tmio3oo1lm n fcsat a2urxmono1oleomicilsfm ra(vsn(4aeenxr3iodom r i ols0 rxr(m3oydopenmivtas) Dua(rp;o0tlxomoetas aDuluvsnu0areoxrcootom eai sls)trurim no1omen nvil()sDum(r oo4alto iciyt aDeanvs;t0aeermo iotoatr nvs;(0texrxm3ou1apee nct ( a2trx  nu4tltn iciasfmDelnms (4 rxoio3iydfpt  ueilt srxr(o iodom eliesls)srua(ronu1opx ioeiat mDran p;(4altnmo oadop rauvi;s  2urxmpny4amee netl(  2ta(root4olt mieiydlm el(vo;t0aeermo3tatop raiei;( trxmxr iudomtnlnvi sfaDur(  nu4tlxo o3tltlaDua( snu4tleniocoo1oateaivs t0srtmio iy1lp e nei () Durx onu1tpx  fctld aDrmuvpnt)artrmf io1omteanesls srtm(o iudaltelfct tf rumxmo;u0opxomo3iasfs rau s u4 renmocoy1opDrlnvil()t2xr(r iy1lp elieias  2umxrp;u1oeeoifetls a ra(mp;t4aetomfctytoat  ivi;s) 2umxr3iodlleemictas  rrrx  ou1tleoifeiydfm2eln s;()aetnxr oa1laDelues ()teurxr iy4omtnmivilsfaDta(mpou4tptniiciydls2emu o;u)altrmo oy1laDr ues;t)teumiopnu4lpenmfvs tf 2raumoot0tex  fctltfs uan o ()tlxrmr io1lat aivs t0srum(m iudole livt t sDrmump;u1aptomi3iltlm2rmn p u0tleomr ty1oaDeau i (0t2xoxrpou1opteliviatfs2rr( pnu4alx  i3iytfsDrl(msnu4 ltnmoctotla ran sl()srxrxo iudlpeelncs ()arum( pou1tlt mo3ilsls um(mp;t)tlxrmf3oa1fa eai o s s2urxopiy4ll emieil() Drrxrpou0ale iocildfa em(mp ()texnxr iodla e nvol() rxmxr3ny1ole mfcias  rrr(  ;t4optnioctad aDul(vp;t4aeeoif3iotoa eaies;s0truoio3iu4ome mfvt t)a2ua(ro;t0texnmociasfa2rl(mo;t0tltomr3oodoat ai s;(  rtr(rpou1op nlfetatfaDum(m ou0opto i3iatlm2ul( s;u4tleomfcty1fmtr ues;t0trtrirpnudll  micsatf Drmx p;o4optniieiytfaDrlnmpnu) exoxoctatfaDr n sls0setmxo iu1am elnvt sfs2umump;t4aex  i3iatfa el( onu4trtrif3tydfmDraieil(  rtmim io4aptnmnetls sDrmxrpnt1tltoifeiyd m eanmp t0tlerxo3tydlpD aues () exrxr3oy4amte nctasf Durxr oo1aeeomietldfmDul(msnt4 rerifcto1oa  an i s srxoxo3nydom nlfcs (faDraumoot1apt mietatla elnvo t) eenmo oatlpte ieil(0 2ur(m iu4om emnct sfs2rrxmono1tlxoiieiadlm ra(ms u) lxnio tytla ranes;s0t2urxrpno4lpe lieiltf rrmu  no1apt  ietadfsDrauvont)alxnxo3tatlmt ln o s  rxmxo iu1open ncilsf rur(mpno0tlen ieils m2ulumsnu0teeoircto1op   u i ()t2uoirpiodllt lncil( a2tmxrpoo0open i3ilt sDranvsn(0trxrifcoa1lm e ivi (0 rtrxrpiodop  mieia() rtrumpoo4tpto iciad m2emu pnt)tleoxf iadomDrlu ol()s2to(r3oy4oltn iesls)aDtrx p;o4opeomocilt s2umuvs;t4trxomf3oodfatrlneo ()t2tmirpou4ol n fvi ()artmxm no1oexnmicias sDumu p t0texoifciytomtr uvi;t)t2umxo no4omte fvtas srtm(mo;u0olxomfeiasfm ulnvo;(0arxrir3iotopt luvs (  rtmxo3oudlmtnmfcs tfs2raumoot4tpen o3ils s2rmuvonu4 reoxo3oydlp  aiei t)texrir no4llee ivsa( sDraxrp;u1texn fctys sDeau o;u4 etrifcio1oa ean olt  etrxr oo1oltnmietl()sDum(rp;u4olxn fcilslmDrlnvsn()aeeoir3iydfmD  ieolt0srxrxmpoo1ale mfvia( srtrxrpou1tpt iociatlm rln p t4aexnio3ty1lmDr i ilt0sruo(mpoy1oltnlnvtlt) 2um(  ot0tet mo3ildfa uaumo;u4arxomr3iatoa   n o;s)s2to(mpio4am  lfeia()sDuau  ;o1tle moeiytla eau o;()tlxrirciatoa  lneil( tetmxmpiodlptemfcsasfs2uax pou0opeoif3tldlaDrlump u4tltrmo3ty1optrln o t)srxmimpnodll elicsas)aDtaumpoo0oeen feiyslaDrmumsn(4altoxoctotfpteauvilt  2xr(opou4aptnmncsat  Dtrumpoo0olxoiieilslm rmuvs u4 rerir iatoa r uvo;s) exoxo iydam emfcs t)sDtm(moou1tpx mi3iasfsDraumsnu0trerioctodfaD ai o s)t2xo(opiy4omeemnctlt) Dtau  nt4tlx iieilt s eluvpn(0 ltnir3iatopte neo t  etrxopou1op emfvtltfsrraxmonu1tle  octld mDrlnvp t4tetnxrcoodoaDrluei ()teumxo no4al  mfvs sfs2tau ono0tptnmociyd s raumo;u0texnio3tydfmt anvi (0t2trim nudlltelnvsas)aruaxrpno1oeen octadfa2rmnms (4trxnxociydlp raivols0 eto(rpiodalt  nct ( s2um( pot0tetomfeiatla rm( s u0tlermo3iotfpDranvo;()tetoio io4apt mietat) Duaxm ot1oltoioeiltfaDumnvont) eenmo tydopD auvol()t2toio3io4ape mieils)a2rm(r no0tetnmfciyd m2em(ms;u4artoiocoadlate uvi t  rxrxrpno1lp nlfetl(fs2um( ono1tlxnmiciltlaDuluvsnt0 reomr3tatoa e ivs t0setoxm3nodlpt mfesl( sDtm(mp;u4olto i3iadlaDulumsnu0 lxnio3oatfpDrlnvo t) rurxopoy1lmt  nvsls  Dtrxr nt1apxnif3tat m2el( snt0tltnmo io1omteluvs;s)trurimpiu4altn nvt (f rra( p;u0altn iciytlaDum( pnu4alxoxociydlpDr nvo;t  rtm(o oodoptelnvsl(fs2tmurp;o4oexn i3tyd s2rmnvpn(0aetnif3iodlpDrau ilt teur(rpiodol nlfci s) 2ua(  ;u0tpeo i3ildlmDrmn p u4arenxo oo1fpt aivi;s sexrxm3nu4ll   fes (faDrm(mo;o1aee mfeiytfm2emnvo;t0aeeoio3ty1lpt au o;s)t2xr(r3ny4lleelieia(fa2taxrono1alxn i3iydfa2rau s t4 rxnif3ia1lp e nvsl()t2xo(r io1ll  lfetas aruaur no4olxoif3ias a uaump;() etnxr tydfmDe i il(  exmimpny1olt lfci t) rtmump;u1ole mietad a uln sn()texrxo tydfpD  nvi s trtmim3oydlmte icilt sDtm(monu0aet  o3iyd a ea(vo;t0 rxoxo ty1op rauvs;s)t2uo(rpiydomeemncslt)artmu o;t4tlx  f3iytfa eau p u4tleoifcoy1om  an o;()t2xoxrpoo4lpe lfvilsf rrm(mo;o4texomo3iytla2em( s;()alermo3oytfmDrluvo;(0 2uriopoo1alenmfcils a2rmu  no0tpx mf3tydfm2umu p;t0tlenmf3ty1lmt aueo;t0s2xo(opiudameemnesas  Dra(mpnt1tle ioctaslm2el(vsn(0 lxrmociadopD lieo s s2trxm nu1oleemnct ()s2rru pnu1oeenmictltfaDuanmo;u0alxnxr ootlptr nvs t0t2xoxo iy4omt lfct tfsDta( ooo4olx mf3iasfs uau s;u0 ltnmf3iodfa eli sl(0 etmimpoudlp  mivsa()srua( p;o4teeo fctltfmDeln p t4alxnmociadfmt lnvslt) rtm(m ny1omt mfet s a2uru pnt0opx miciysfsDran pnu4tltnir iotop  anvs s  eumxr nu4lmenmfct (f rtr(r nu0oetnii3ilsfa2emnmo;()tetrxoctytfmD anvi (0 eumio oo1lp  micsa(  Dtmxrpou1olt mociatfm rln o;(4 rxnmfcty1lmteau i;(0 etoim3oudlltelnvtat aDur(r nu0oeenmociysls2elu p;t0 rtomociodoa  lu ols  etmxo iudomtelieil(fsrururoou4oetomfetadlm um( s;u4tetnmf3oadfateli i s)trtmxr3no1opt  net t)srua(m ou4tltnifeiad m2uluvpnt)arxnmo totla  aivilt0t2xmxo nydllt  fesl(  Dtr( p;u0tlenmociysfsDranvs (0trerxr totfateaieo;( t2trxm3oudlpe  nvsa()sDrmuro;t0tex  icild mDum( p (0 lxoirctadfa e n olt)setmxo nu1op elfet t  Drau  ;u1altnmfetld mDran snt0artrxr3ia1lat anvi () exoxo3io1ale lfvi s sDraxrp;u4tltoiieildls2ea( p u0 ltnir iotlpteanesl() 2urxr oy1optn feil( s2um(rpot1teto o3ild a2ua(mp;t4tetnir3ootfmt  n s t0 2urxm3io4lm e ivilt a2rm(r ;o0olx mfetaslm2el(vs;t)aexrmo todla elu slt0srto(r iy4omtnmnesl( sDrrx oot0tlt io3tldfsDrl(von()artrxo tydfpDeau i s)s2to(r oudamt  fvi s artaurpot0ole ifciaslm rmuvp;(0texoir oy1lm r iei;t)t2xo(o ny4om nmfvs tfsrtaxmp;o0ape moctaslm umnmo u4texnif3tytom rli sl( seuo(o3nodape mfesa(fa2uaum ot0aleoioctatlm2emuvp;u0 reoxf oodfaDe nei;(0t2urxr ou1ap   fetltf rrmum ;t4tex mi3ilt sDrm( ont0aleomo iatfp rlneo;t) etrim3ou1olt lnvtls s2ta(mpnt0opx mi3iydlaDem( p ()texrio3todop   uei;()seumxr3ny1al nmnesa( srtmx ont1tex  octytlsDranms;u) rxoio todlmDrlivs s trtmir iy4altnlfes t sDrm(rpno0ope  feiatfa2el(mp (0aeeoiocoydlmteai olt) 2urirpnu4lptnmnet (  2rrx pou4apeo fetatls2ra( o (4altrmoctodoptrlieo;s)t2xr(o3nudlmt lncsls)sDtmxronu4alenif3ils m rl(mo (4treoxr iodopDeaneo;(  exoiopiy4omen nvt s arrmx pno0oet iocilt s ul(vs;u0tltoxo3iodfp   ies;() 2tm(r ny1ale  ics sf rurx pnt4aptnmfctltls uanmp;() rxoxr iadopDe nvo s)s2xrio3ny4omt  fet s)srururpno0aexomfciltlm rl(msnt0aleoxr3iadoa r uvi s t2uoxo oy4om nlnei s)s2rmu pnt1opt mfciytlsDrluvp;(0 exomf iy1omt aies;()t2xrio nodop emietl( artmxr ;o4teeo o3tysfa umump;t)tetomo3tadfp raiei s0setoimpiydalt  fvt ( artax  ot1ole  fciatfs2ra(mo ()aexnxf3iatfpDe u slt0 etmio io4ll nlivt t) 2rmur oo4aex ifcias s umnms;(4artoiociodopDr iei s0trxmim nodlmeemfcil()artaxr ;t1tlto feiytfm2ranmp;(0 etnmocoy1omDeauvilt0s2xoio ny1apte ivias) rurx pnu0tltn ociltfa ra(vo;(4trxrmr3oy1fmDranei;(0 eur(rpnudopenlicias)aDumx  ou1opto feildfsDea(mon(4tlenio iadla elivil( s2toxo3oo4olen nvias) Duru p;o0aetn ietldfaDemums u4aetnxo oo1lmte uvi ( s2urxo3iudllenlnvtas)a2rmx ono1tltoifeiltlaDuluvs u0arxnxfcio1fmteau i (  eur(o iodlptemnvsas  rta(rpno4tleoiieiyd m ulu snt)texnifctotomte ivs;t  rxrir3oy4lme licsa( arurx  ;t0aeeniieiysfs2rmumpnt0tltnio3iydoa eluvo () 2xmir3nudllt lictlsfsDurxrpnt0alt if3tlsfm2uln p (0tleomo oy1optrlu i (0truoimpio1lp emnvtat)srururpnt4apeo f3ildfmDrlu p;t)aexoxr tadlaDr nei;s0sexm(o3ou4oltemfesls) 2tmum ot0alt mfcildls em( s;()tlxoxf tadfatrai i (  2toim oodol   nciat  Drru  nt4apx mfeilsfa elnvo u0texrio ia1faDr i o;t0setoirpiu1al nmfvsatfs2rmxrpnu1opeo f3iad a emu s;(4 exoxfctodoat  uei;(0trxrirpio1al   fctls)artmx  nt4opt  fcildfs rln p;t4trenif to1om  luei;s sexr(o no1omee ict s) 2raurp;o1oexomociasfsDuaums u4aexoio oy1laD ai s;s t2umim3nodop elnvtat s2rax p;o1tpe  ictysfa umn s;(4texoif3iy1omtelivolt)t2umimpiydllt livtltf 2rmx ont1opxoifciydfm2emumsnt4trtnio ootfm ranvs;( t2uoxmpno4lltelictls sDururpnu1olx iociltlsDua(mo;(4trtomo3oytfmteauvsl(  rxr(rpiodomt lfetlsfa2tm(rooo1oltnmi3iytlaDuauvp t) rtrmr3iytlmt aues ( trtoio3ou1aleemicils sDuru oot0olx mictydfa2rluvo t)trtrir3oydlateanes;s s2tr(o3nydlmen nvtlsfs2ra( poo4ope ifeils a2ul( ont0 eerxo iy1fmtr nvo;s texm(m ou4lp nlneilsfsDuaxro;u0oltnifeiytla2emn pnu4artrmocootomteluvol(0sexmxm oodoptelneil( aruaum ;u0opeo feiydlaDemumo t) leoxf tydfmtraivo ()srxm(opoydoptnmicilsf rumxm no1opt mfciadfsDea(mo;t0tlxrirctotoptrlnvs;(0srxm(o iudop nmicilt aDrruro;o1alxniictyt s2emnvsnu4arenir ty1latr u o s)t2tm(m iy1lpeelfciat arur( p;u4alxomf3iytlm rl( snu0arenmo3todoa rlneilt  rtrxmpnodoptn nesls srtmx  no1ale mfetldls2ul( s;t4areoxr3ootlmtr ivi (0texoxm3oydlpe  fesas srrrxmpoo4ape ioetydfs em(vo;()trxomo3ia1lm rauvols) 2xoim io4aptemfci sf 2ua(r oo1aeeo f3tlt a2ranmon()artnxf ta1omDe uei;s s2tmxo iy4ap  mictlsf Draxroou1optomo3taslaDeauvo;(0tltnmrcoatfm e u i;s)t2tmxr oydam   icil(  Draumo;t4teenmf3iysfs elnvs u0arxrxf totomtrauvolt) eum(opno1lptemnvta(faruaxroot4oex  f3tadls2ua(vs;u4 rxrxr tadoptrlies;( teurxrpny1lpt  ivilt  2tm(m no1tet  o3ildls elnvonu) exnmrcoo1oa e u s;(0trto(rpio4lpt  fvsls)aDta(ro;u1alx  fctytlmDumu sn(4trtrir io1oat  i olt)t2xm(o iy1lm emfeilt) Dur( p;t4oex  oetlsfa2uln o;()tlxrxf iotom   n i;t t2xmxr no1lpe  neia(fs2rmum ;t0aetnii3iatlsDel(vo u4trxrxr io1fm eanvi;( t2umio3nodomtelnet t sDrrx oou4apt  fcilsla rluvs;t4 etnmrctatopDe neols) rumiopiodal nmiet (  Dtmx pnt0tpe mfcias a rm( p;u4aetnxrctydla e u o;t teurim iudaleelnvs ( s2umum ot0tpeo feiatlm2uauvont4tetnircoydom ranvs s)s2umxopou1ame mnvs tf Dta(rp;u0oexo f3iyslmDem(vp;u)aetrxrcoodfp raieo s  rtmiopiydal elfvsa(fa2rm(roou4aet moeild mDuan p u0 exoir oytlmD lnvi;t0 etoio3ou1lm nmnvil()a2urxm ot0tlto f3iydls2eanmo u0tlxoio iatlatr uvilt0t2umiopnydoptnlfet t srtr(r ;o1tetoio3ils sDemuvpnu)texrmociadlmDeln i s0srumxrpio4lltnlfct (fsrtr(ro;u0open feiltla ulu s;() ltnir oy1lptrlieols  2ur(o3iy4omee nei ()aDraumo;t4alx  oeiatfa rlnvp;u0areoxfcoydlat aueil(0setmio3iodlltnliei tf 2rax pnu4oeenifetaslm ulnmp u4 reoifciotfmDrlnvo ()s2xoir oodopen fcs s a2rmxmp;o4tlto o3iltls rln s;t0 rtrxf iotfpD lnvi;t0setrxr3nu1olen nvs t) rraur nt0tex  o3tas mDra(vpnu0 exrifcta1oa eli ol()srto(m iy4olen ivi s a2tmump;u4tpxo f3tasls em( p;(0 exrxociydfpt  ivi;() exrxopou4altelfeils  2taump;o4tlt mfcias m2emu pn() ltnxocoo1fm  ai i s trxm(o3oy4omt miei t srrr(  nt4tltoio3iadfm rluvp ()aetrif oydfpt lu s ( texoio3ou4op nlfeiatfaDtmx pno0opxoifciatlm2el( p;(0 ltrio3iy1lptrliei (0setr(rpiy4ol  mivt tfaDrmxrpnu1tptnmiciydla rmnvs (0aleomo3iotoptrluvilt  exmir3nu4ap   ncsas sDuau pnt4tlxnmoeiadfa rauvon()trtoxo3oa1fpt  iei;s)teto(r3ny4ame mfcsl(fa2raxmo;t1open ieiyt a2el( o t0artoio oo1omt luesl(0s2toir3iu4ope lictlt aDtm( oou4altomf3iys mDulu pn() eeoxo iodlat  i s t)setm(opiy1lmt  ivsa()s2raur ;t1apxnifctyd mDrln o;(4texomf ia1lm e ues s0 2xoxr3ou4ol  licsatfsrumx oot4opeoio3ildlsDel(mp u0alxrxr3todfp  lneo t0trtrxopiodllt mict (f rtmum nu0tpto fetys m2ul(mpn(4trtnxr3ia1oa rau i () rtm(o3iu4aptn icsls)s2um(  ;o4tpe ifetaslm2rauvs;u) eeniociytlmDelu ols  exoxrpno1amt  nci s) rraxm ou4teeoiociyslsDel( o;() etnifctotomD au ol()srxo(o ou4ap nmivi s)sDrr( o;o1aexnmietatlm rau pn() lxnircta1fpDraivs;t) rxmxrpoo1alee feslsf Draxrpnt0opxoio3ilt sDelu p t0trtnxocoytfp eau o t) 2tr(r nydame  nctatfs2ta( ont1opt io3tytfa2ul(vs;() ltoio3oa1fmDeli s;t trtoxo ou1ol nlietl()sDtr( ooo0opeo ietlsfs2ul(vsnu0tlerxr iadopDeluvi;t s2tmxr3iu4am  mneiat)s2ra( onu4tptn i3ildlaDul(ms t4aetrif3iydop r ues;() exo(o3oydope mfcs s arrrum ;t0tltnifetyt s2uluvp;t4tltoio iotlmteai o;s)t2ur(o iu4llt licta(f 2umxmpot4ape iocild s rlnmp;t4tlxoir3iy1lpt  ueo s0 2xr(mpiy4llte ictat  2tax onu1apxomo3tltla rlu on(0 rtomf3ty1omDraieslt t2ur(rpiu1lmenlivslt aDraxmo;o1tpxoii3ild s2rlnvs;u0 reoio3ta1lpteau o t) etm(o oo1lpt  nciat)s2trxront0aee ioetydla rlnvo t0tlenxfcoatlm e ueol(0 exrim iodlptelnvsasfartr(ro;o4tetoiociydlmDrmn s;t) rtoxo3io1optelnvi t0 rtoio oo4ope mnvtas) Dum(mp;t0oltn ociat mDul(mo;(0 rtrio3iadfaDe ueol(0 2tm(r oo1ome  ivtlt  rurxm nt4apxomiciaslm2umnvont4 lxoif3oodfmDeli i;()teurio3ny4ameelfcs () rtrx pou1optniiciyd m ulumpn() lxrxrciotlmteaies t0 rxm(mpnydomtn nct tf Dururp;u1opxn fcild a rauvpn(4teenxo tydoa eln s;( srxmxo3io1amte fvs ( a2taurp;u0apx mf3iyd s2rln o ()texrmfcio1fptrluvsl() etmxo3ou1ll e nvsl() Dumxmp;o4alxoioctasfm2umump;u4 etnio3ootoat ln ols)srxr(mpiy4alenlfesltfarrru ont4olen octyslsDel(ms t)trtrif ta1lptr ueo t)trurxm nu4lm  lfcsl()srtrumpnt0aex ifeilsfm rmnmp;t4 exnmfctotoaD  u i;(0trxmxr nodlmt licilt)sDumum ;t0alt  fcilslaDra(vs (0aeeomo oo1lp e nes (  2tmir3nu4open ncslt  2trumoot0oltoioctldfa umuvsnu0teenmrcoatlat luesl( trur(mpny1oleemicilt) 2ra(rpno0tltoiieiytfmDrmnvs u4 rxrmrcto1oat livo;() etoirpoodol   ieias a2raurpou0oltomi3iatfaDeauvpnt)aetrmr iytla e uvi;t  euoxm3iu4ll e fvi (  Dtax pno4tpx  oetlt s em(mpnt) rxnmo tytlaD lnvi;s)srxmio no1omt mfvil(fs2tmx  ;o1aptniociatlm ra( s;u0 eermr iodoat  i ilt0s2um(o3iudale  nvsatf rtmur no0apxoif3iasls2ra( s () etnmr iotfptr n slt)t2tr(r oy4ll  lfcia()arrm(ro;t1apeo feiysls2ranvon()texrif to1faD  ivo;t)s2trimpny4amt mnvtl(fsrumxmont1ole mictltlm ua( pnu)tlxnmr ta1om  au sls0 rxrio3oy4ame  nctlt arrrurpnu0tlenmieiydlm emn s (0 ltnxocoydfptr neo t srxrxmpoudllenmfetlt sDrrxm oo0aetn fctldlaDum( onu4alenxrciytop e ueol(  exr(o3no4lmeemncsl(f rtaxr ;o1ope ifciad mDem(mo u0arermr3iadoat auvil()setoxmpiy1ll emfei s) Dtrxronu1olen i3iyd aDea(vo;t0teeoxf3tatop raiesls0setr(o nudalt mnesat)arrmump;o1texoiieiyt m2uluvp;() ltoio totom elieols0 exmirpnu4om nmnvt (  2ua(mono4tpt  i3iatls2emnmsnu)aetrmrcoy1op eanvi;s0t2xoir3iodlp n fvia(fa2umx o;t0opxomf3iysfm em(vs;u4altoxr oy1omDe nei () 2tm(m3oy1opee iesl(fs2tmxr ;u0alxoiiciadlm2rmuvp t4tlenxrctotfp eai o t  2trxrpny4omee fct ()artau oou1optnmi3iatfs2ul( s;t0texoif3oydfat lueil()texoxopiodomte iei (fa2umuront4aeenmiciasfs2ea(mp ()aexnmr3oa1fm  ln slt0texo(r iu1lmtemiciatf rraumo;t0aptoioetlt a ul(vp;u)arxrxf3ty1fptrau ilt0seurirpnudapenmfctat)aDrmx  oo1openmfeiltfs2ul( snu) lxrxf oo1om eanvs s  2toim iy4am  mivi (faDtmxmp;o4apxomoetatla rlumsn()teerircty1fa elnvs s0texm(r iodlmen nvias) rumuront4apt mfcias m2rauvs u0trtnxfcia1lpteauvol()s2xrimpoo1omen feta( arurur ;o4oee  i3iadfm2raums u0teenxf3ty1fateauvo;(0 rxmir3nudamen neias s2umu  no4aptnio3iytlsDul( pnu0 renif3tadfp elu ols) etr(r3nu1olen neta( srtm(rono0alenmfeiatls2rlumon() lerircoatlpte u s;t0 rxrio ny1lmee fci t arur(mpot0tlxnioctadfsDrmu s;t0 rxoir3tadopDeanes t)t2xmxopiydomtemfvtlt)a2trxro;u0apto o3iydls2em(mo;u)tleoxfctydopD  ivo;()trxoim3io4op n nvta(farraxr ;o4olxnmfciasfaDrlnvp;(0aetnxr3oy1fm eaiei t)setrxmpoudlle liet sfa2rrxr ou1tle  octltlm elnvp;t4 lxrmo3ia1fpDr n o () rxoimpoudoptemivta( sDumx o;u4openifctadlmDuln p;(4aetomr to1fpDr nvi;s)s2urxo nydom n icilt) Dta(r ot0altniiciydfmDua( o;u0areomo oodomtelueo;( trurimpoy4openlnvsls srtau poo1teenmi3tydlmDem( p;u0tltnif iodfpteanvsl(  2tm(r3io1lm e fvsa( artmxro;o4optn oeilslsDrauvp () eermr3iatopDrauei;s0 rtmir iu4llenlnei s) rraxmp;t4alen oeiaslmDrm(vsnt0 eerxo tytopD  neo;t0 rurxopny1apte ivsl(f Dtmu ono0olx  fctatfaDuanvp;(4 lermf todoaD luvs s0t2tmiopoo4al   fet sfsDrmx p;t4aexnmi3iyd s umums u4tltnir ty1lp r u s t0 rtmim3oudoltnmnci s)srtmxr ;o1tptnifciys aDran p ()artnmo tydla   nvs s  etmxmpou4am n nvia(f Dtr(  oo1tptn ieiadfmDelu o;() lerxf3to1fmDr neo (0t2xmim iydomenmictas  Dtmxro;t0alen f3iatlm emump;(0treoio3ia1fp e n sls0t2trimpno4apen ivil()s2rr( oot0opxnmictyt s um(mo;(4 reoxo tydfm r u i ( trxrir iu4ap emnct sfsDtaxrp;t4altoiietas m2uaumo;(4 etnxoctatfmDe u ol(0 etriopoydop  lietasfsDtm( oou0tlxo ocilsfa2umnvsnu0teerif3ta1op rlnes t0 rxo(rpoy4ope mfctas  rrrxmpnu1oexnio3ilt a2rl(mpnt4tleoxfcto1fmte nvol()sexoio nodoltnlnvtlsf Dtaxront1ope ii3ildlsDua( snu)artrxr iy1lpDrai i;()seuoxo3io1alt livsas artaur ot1oltoifciltlsDemnvpn(0teeomr3iy1lpD ai s ( sexrxmpio1alte nviasfs2trxr nt1oltn ietasla ran p;u)tetnmrcoy1lp eliei t)texmxr nu4om   nes s  2raxmpnt4tltoifciatfm2rlumo u4 ltomrctatla e i s;s0 ruo(r3nudlmtelfvsat)aDtmu  ;u1oleo fetytls2rlnmsnt0alermf oy1fm   n s;s0t2umio3iu4ame miei t a2rmumpnu1ape mf3iad mDumuvsn()trxomoctodfmDrai o t) rxoim3iu4olt  nctl()a2um(mp;u4tlxomi3tydlm uan sn(0teenmo iodlaD an sls s2xrim3nydomen fctatf 2tmxm no0ale mfciadlsDrmump u4areoir tatfp r ivo;t  rtmio oy1lmee ietatfaruaur no4aex ifeild s2eanms;t)aeermfcoadlm  ai o s0trxoirpnodlme  ivt s)artmxrp;u0tlxomfctadla rmu s (0trxoirctotlmD lneo;( srurimpoy4lpt lnvtlt)sDuau  no4texo i3iatlaDrmnmpnu0 exrmf ia1lpD lnvs;s) eto(r iodop n fvi (f rraxr no0optnioctadls2ua(mpnu) lermo3ia1fmteln i;(0t2tm(opno1omt  ncias)a2ra(m nu4tlto f3tytfm emnmsnu0treomf3todom r n o;s0 exo(r3iudol emivtls arur(  ;t4alxomoeiltlaDemuvpnt)trtnif iadfpD aies s) rxmxm iodapt mnet sfs2tmxrp;u0ape iietas a2eanvsn(4teenxr3iytop e u i (  rurxrpio1lmtnlfesltf rtrx o;t4apxoii3iad s2rauvp;u4 reomocta1fpDeanvs;s)tetmxrpiydameemnci ( artaxm oo4oet  ocilsla2rmnvont) exomfcoytfmDrlivo;t  ruriopoudapt  fcsltf 2uax o;u1tptnifetlt s el( o (0 leoiocoydfat livs s srxo(m3nudllen nvias)a2rrur ot1oleomictytfa elumsnt)artrif iatfpt an s;s)t2trim oydomt  fvtat a2rr(rpnu4tpe ioeiyt m2umuvsn() lenmr ia1la raues;t0t2tmio ny1opte ivslt)s2rmxront0ope ifctys s rmu s u0artnxr3oytfate neo ()setmxm oo4amtnmfcs s s2umur oo1apen ictasfa2uanmo;()areoxr oydfptr ieo;()seto(o3iodamt lfeiasfa2uaurono1olto i3iys s2em(mp;()aetnir oa1fp  auvo s) rto(r oo4am e ivtls  2rr(m nt4tpenmieiyd s em( p;u) exomfcootom r uvs s s2xmxr iudolte fvslt)sDuaxr ot4tee  ieilt a2uau o;t4trtnxf3tydfm  ai sl(  2umxr3ny1aptnlnctas aDrrur oo1aetn oeiys s2eaumo u0trxrif iatlaDelnvi t  2to(m io1lpeelfvi s)aDum( pnt4teeo i3iltfs2elnms (4 ltnir3totfa eaieolt)texoxmpiudlm e ncta()sDtax  nu4apen fctltlm eau p;u)aexomrctatla eaivi s0sexr(rpoo4am n fvs sf Dta( pot4olen o3iysls2uanvo (0 rxoir3ty1oat lnvo s0s2trxopoodlm   iesltfarrrxrpnt1apx moeildfsDua( ont4arxrmf3todfa r ieol( seuoxopou1optemnvils aDrr( ono1ole  ociytla2rlnvs (4 lerir oy1fptrauvo t)trxoirpou4lm nmnvtls)srurxroot0openmictlsla2ua( onu4tlenircootfpD ln i (0truoirpnudoltelnvsasfaDrax pot1oeenmiciadlm2uln o () leoxr iydlaDe ieo (0srur(o3nu1optnmfes t sDur(r ;t4oltoii3iysfmDrau pnu0trxoio ta1fmtr ivo;()t2xr(opny4aptemnctasfartau ooo4olxnii3tadlm2emuvo;t)alxrxrcto1lptrlivo s)s2xmim iu1omeelfctltfsDrm(mpno0apt mf3iyslmDua( onu)trtoxoctatom  anvslt0sexrio ou1oleemfetatf 2tm(r ot4tptoio3tysls2raums;u0alxrxo3oodlpDrln i s)s2uoxm3iy1aleelivsltfartr(r ou1apeo ictytls2emu p t4 rtrmo3oo1fpteaivi;t trum(m3oodamtemnvils  rraxr ot4apx ioetaslm ea( pnu0 rtrxo3tadoa rlivs;s0trtrim3iy4alte feilt  2trum ;o1apenioeiadfa rmn snt4tltoxrcoydlaDean ols trum(opiy4lm elivilsfarrrxmo;u4opt  icilslaDemump;t0tltnmf iatfmDrlueilt)tetmxm3iydam emnes sfsrtax o;u1tet  f3iasfa ea( p u0arenmrciotlp rlivs;s srtrio3iydlleemnci s srtr(ronu4tpe mfciysfa2ea( pnu4arenmrctatlmtr nvols t2trxopou4amt lnei ()sruaur ou1altn octyt s2rm(von(4 reoif3iadlm  ai i s0t2tmio nu1llte fcsat  Drr(roou1aeenmiciasfs uln o;u0 reoxf iatfm eanvils)seur(opoy4omenlfvt s)arurx poo0oetniociydfa2eanms t0tltoxr iotfmt lneil(0srtoio ny4omenmnes tf ruaumooo4aex mo3tlt a emu onu)aetoif3iotfmDrauvsl()srumxrpny4omtnlnei tfaDurx pnt0olt  ocias s elnvo u4 reomfcoadopte uei;s0 exoio3iudol  lfcia(fsrrmum ;o4teeo i3tldfsDea(vp;u0 renmf3iodom  aieilt)s2xoio3ny1lltnmnviat a2rr(ronu1ale mo3ilslmDea( o;t4 rxoif oy1fpDe i ils srxmirpoo4altemietls s2um(ro;t0aet moeilt s2ulumpnt4arenxr3tadopDeaueo;(  rxm(m3nudamenlnvtls  Drmum nt1tetomf3tld mDem(vs t0 rtnxrcio1optelnei (0tetoim3oo1ape  nciasfs2um(  nt4opt  f3ilt mDean o ()trxomr3ta1op ranvils) 2urxrpiydam e ncia() 2rmx o;o1alen feils sDrm(vsnu4tltomocoatfptelieo t0 etrxr3iu4oltnlfci t) Drmu  ;u4apxnmictydls2ean p t0 lxrio3totlpt livil(0srxm(opnu4lmeemnetlsfsDrru onu4openmf3iadfs2rau s;u0 exnmf iatomt auei t s2tmim3nu4lpt mnvsltf rtm(  ;u1tex ioetydla um( on(0arxomo ootop rauvs;(0texmxo3oydope mfvs sf rrr( p;o4alxo i3iatlm rm(vpn()trtniocia1lpD lnes ( t2xoio oydlp emfvias arrr( poo1ole  f3ilsfmDrl( s;(0teenif iytlpD aueil(0t2uoim3oudam nmncsas)aDrrx oou4olxn oeildfs2ul(mo () rxrmo3todlpDeai slt0 eurxo oudop   fvi tfsrum(mp;t1tpeniictas mDrmn p (0 etnio3oo1fp   neo t  rxm(o nudam emict ( srrm(m nu1olxniictyslm rmuvo;u4aeenxrcta1fmt anei s)srtmir3ou4optn fvil( sruau ono0oex io3iys mDumuvo;()aleoircoytfp elueslt0srumiopoy4apt lfesatf 2uaumo;t0apxn ieiydfm2eaump t4 etomo3iytlmtrlu il( s2xmxo iu4lle mfvil(f Duaxmoot4apx mfeiytlsDemnms;t4teenxrcio1lpD  iesls0 2xoirpio4omtelfet t sDtrx o;u0aptoiociyd mDran o t) exrir tadlaDrau s s) euo(r ou1alte feilt sDtrxmpno0alt iictadfm2ul(vpn(4 lxrxf3oodoa  anvi;s srumxm3io1lm emnvi ()s2uax ono0opxnif3iltfs2elnmo;(4aexnir ty1fmDrlu o;() exr(r iydop  lnesatf 2tru p;o1texnmictytls uaumpnu) ltrircoydlatrln i s) eurimpnu1llt mies ( a2tr(rpoo4aee mi3tad a uau pnt)aexrxf oa1fmtelivs ( teur(o ny1ol   icsl( s2umxm ot4aexoifeilt a2rmumo;()trerifciytlaD aiei;(0 rxoxr ny1amt lietat) 2umxrp;t0tex ii3iyd s2ran p;t4 renxfciodfmDe uvsls0srur(m3ou4ol emfvta( srua( oot4aetomf3iasla2em(mo u0tetoif oy1oaDeaivs s)tetrxr3io4omtnmneta( sDuru oou0oetn o3iysfa2rm(mp;t)arerir3oodoa r u sl(  2urxopoudamt  ieias a2trurpoo1tleomiciatfmDrlnvp;u) lxnir3tydomDran s;t  2toim3iudamt miesat)artrxmpoo0apt mf3ils m2emnmont) rxnmr tadopt an s;s t2umim3no1lmtn feias) rtrx ono1tleomoctydfm2ra(vs;u)aexoxo3oodfpteluvils) 2tr(rpiodole  neilt)aDuru o;t1tltn iciatls emnvo t0arxoif iydomtran ils)trxrxo3io1ape lfesatf Dua(root0altnifciadfs ra(vo u4 lxnmr iytlmDr nei s0setoxo3nodllte neia(faDumum ;t4olto fctys sDemnmon()trtrio3iadoa elnvi;(0teuoxo ou1lm nmfci tf 2ra( pou1oeeomieiltla2elu o;(4 etrmr oatfatean i;(0t2um(r io4llt lici t)srrrx p;u0tetnmoeild s2rlumpnu0 etoxr ootom  anvi (0sruoimpou4am nlivtas  rumxr ;u1optn ietltfm2ra(vo t0altoif totlaDr u ols t2xo(r3no4lp nlnesat)aDta( ont1optniociaslmDrlnmo t4artnifcia1op rln s;t0 2urirpiudap e iet sf rum( pou1tleniicildfaDemu o u)texnmrctatlatr iei t  2xrxo no1lme mivtlsf rurxmoou4tltomfetysfs uaums () lerir3oadlaD aivi (  rxm(r ou1ape  nesa(  Drrxmo;u4olxnmf3iytfs2ua(vsnu4 eerxocia1lat au s () rumxr nu4amenlieslt  2tau poo0aex  feiad aDul(ms;u0tltomo ootomtrau il(0 etmim iudom emfct () rtmxrooo4aexoioeiadfm2ra( snu4treoxr3oydomtraies;t trtmirpou1am e nvils sDrmurpot0tex mf3iydla eluvsn() exrifciydfmteauvi ()srur(o ou1lmte nvias s2rmxm ;t1apeomi3iasls ua( onu4arxrmf3iatlm eluvs;t0srur(mpoy1amtnmfvs t sDur(  nu1tlxn icias a2rau pnt0tlxrircty1fm elivi t0 etmimpiu4optnlictlt aDtrx ono1opeo ictad mDemn s u)tlxrxfcia1opteaues;s0 2xo(m3io1oltn icta(  Draxmono1olx moctytfs2eau p (0 etomocio1lpt  uvsl( teumim iu4ll eliei tf ruaxmoou0apt io3ilsla2rmu p u)trxoio3oo1fp rlueslt0t2uoxo ou1ll   nctl(  rrrumpnt0ale  f3tysfsDemuvsnu0aexnxf3iotfmt auvi;( s2xr(rpoudlpee fvslt arrrx o;t0oleo feiadlmDrmnvo u) lxnir3iytfp r n ilt srurxm3iu4omt lfvil(fsDrmxm oo4apeoif3iatla el(mp;t) etrxr3iotfmt ai i t0teto(m3oudlmenlneiat)aDrmu  nu1oeen f3iatfa uaump;t) exrxo3todfat livils0trumim3nudol nmfvilt)sDurxm ou1oex iictyslaDemnvo t4aeenmoctatlpt  ivi;s0teto(m3nu4om e ivilsfsDrax p;u1aex mietad aDuanvsnu4altoxfcoatomtr i slt) 2xmim io4olt lnei ( a2ua(m ot4aex iiciasla2ul(vs u0trtnir ia1oat  iei (0t2xo(opnu4lp e net t a2um(mpot1opeo iciltls eluvpnu)texoirctotfaDran i s0trtrxmpnodlm emfvs (  Dtaxr nt0tpto i3iydla2rauvsnu)altnxf3ia1fa eau o t)sexrxopnydomtn netas  rtmumpoo0opxoifcilsfs ulump;u4tlxrif3tydfmtrlueo (0srto(o nu1ome lfcta(f Durxr nt4altnifciydfm2ul( onu4alxrxo3to1lmD auvs t0srxr(o3ny4ol elfvt sf Dtaxrp;u0alx iicias m2ea(mp t0trxrmfcio1opD li o;(  rxoxo nu1aptnmict (fa2truro;t4olxnmfetysfs emnvo t0aexnmo3io1lmtelivs;(  2xmio3nu1optnlfes s s2raxro;o0optnmfeiasfa rln snu0 etoxf3oodfp eau o;s trur(opiu4lm nmivs sfarrrurpno0oeenmiciytfa2eluvp;t4aexrio3iydomDrli olt)s2urirpno4om   ncsls  rrm(moot4apeo octltfa ea( pnu0 rerir3iytopt aivi ()texmirpio4lm  lnct s)aDta( oou4optniieiys s2emuvo t0areomrcoy1fmtr nvs ( tetrir3no1amteliesl()aDta( p;t4oleoii3ilsls ean o u4trtoioctydfp rlieo s  2uo(r3iudlpen nes ( aDta(mpou4tltn fetatfaDemnvs;t)altnmo3tydfa eluei;(  etmiopoo4om nmiciat)sDua(ronu1alxnifcildlm2ea(ms t) exnmocootfa e ies ( t2trxo3oudll   iesa(fsDtaum ;u4oet mieiatfa em(vp;u0 rtnmf oatfm  anes;() rtmxmpny1ole miet s a2tmxro;u1aetomo3iadfs2umn s;t) lxnxf3todla  aivolt)tetmxo3ny4al n nvta( a2rm( oou1apeniietltfm rmnvo t)tetrmo iotfpte i ol( srxrim3oy4altn fcsasfs2tmxmp;o1tlxoif3iys s2ranms ()aetrxrciytlmt li s;s  eumiopou1oleemncslt)aDtax pno4tex ifcias a2umu ont) eermr oy1fat ai i;(  2tmxopnudomenmfesat a2uaum ;u0olxniieiasfa2emu pnt)trtnmocoydlm rlnvi;(0t2xmxrpiy4apee ivsa( sDumxront1optnmfciatlm emn o;t0trtrmo3tadlmtrluvi t) rxoxo3nodamtn ivs (farrmum ;t1oltoiictad aDul(vp u4tleoxocia1oaDe uvsls0srur(o ou4amenmfvt ()s2rr(rp;u0open oeild s2el( sn(0 rtrir iatfaDrln olt t2tr(r3iodlltnmietl(faDum(mo;o4tlxo feildfaDuau sn(4 rtoio3tadoa   ies;t)srtr(mpio4ope  ietas  2taurpot4tlt  iciyd m ea( o;u) rxrif3iytlat lu s;()s2ur(o3io4ole mfcias arrrumooo0aexnmfetatfm2raumo;()tetoxr3to1omt ln ol(0s2tmxmpou1om emfvsat)aDraumoot1teenmfeiadfa2um( on(0tltoifcoydoa elieo;s) exrim3oudome  ivslt)a2um( o;u4tex ii3iad s2emu ont)arxrxr oatoateaivsl(  eumxr nu1ll emnesl(f Dumumoou0tlxnmi3iatlsDul(vo;t4 etrirciodfa e nvsl() rtrio3nu4omeelicia( arraxm ot0tet mfctadfs umums u0 lxnif3ta1oaD lies t texoio3iudlmenlfviatf Dum(rpnt0aptomfeildla el( p (4 reoxf3iatomDrlueols  rtm(rpnu1lltn ics s srtmxr ;u1oeto oeiadlaDum(msnu) ltoxrcoodoaDr n slt0sexr(rpnu4openlies t  Drrum oo4apeo i3iys mDra(mo;(0treomf oatfp   n i t)s2ur(o3oydomtelivtas  Dtrumo;t1tpeo ietasfm2emu on() rtrir3tatlmt ai i;()s2uoxm3iu4apee fct t srrrxmp;t4tlx  i3tlsla2ra( s;t4 rxnmf oa1lm eau o;(0 euoxr3ny1lmtelfvsls  rrm(m ;u0oetomfciys s2ra(mo;t4 etnir3iotlat an i;t) rxm(m oo1apen neil()sDra(rpno4aeenmieildfmDrlu s;()tltrxo3ia1fpDe uvo s tetm(m3iydamenmfei s)artaump;t0oltomo3tld s2umnvo;(4texnirctytfmD lies t setoxrpoy1llt lnvias sDurxrp;t1apeo ieiyd sDea(vp t4 eeoxo3to1opteai sls0 2trxr iy4lm  lneil(fsrrrxmont4tleoiocild sDrmnmp;t0altnmr3oadlpt  ivo;( tetrio3oy1opt lneta( sDuru pnu4aexnmi3tasfm2emnmo;()aetnmr3oo1oateluvols)s2xr(o3oodapee netlt) 2taxro;u0aee moeiytfa2em(vp;u0aetrif iy1oatelueo t srtoxrpiydome licslt)sDum(m nu4opx mfetat a ra(mp (0texnmf3ia1faDrai o t) etoxrpoy1om nmfetlsfa2rrx onu1apxniociltfm2emuvp t)trtniocto1lat anvi s) 2urio3oo4omtn ivsas s2taxm nt4open ictyt s2rm( snu)tetoifciotfpte ieslt0 rurio iodomtn nvtl( aDtm(mpoo4aeenmoeiat a eaump;u4alxrir3iotop eauvo (0srumir oy4lmeelies sfa2tmum ;u1apeoiociyslm uaumpn(4 rerifcootlmtrlu o;s0trxoxopny1lm e ncsas)a2rmum ;u1openifeildfm emu on() rtoxoctadomD li i s0t2toiopiydapt mivsas  2rr(  ;t4olx mf3iadfm2rlums;t)aexnxf iydlpt  ieil()tetrxmpio4lme lnetat sDum(roou4apt mietatlm2rmnmsnt0altnircio1lp   i o;t teumxm iu4llee ivtls aDumx  ;t0opxo iciadfm rm(mp t) eerio3oa1op  lu ilt t2uo(r io4apt mfvsatfsruaur no4opeo ietld sDem(vpnu4 lerxf totoaDe n i t) 2urxm oo1olenlnctasfa2uaurpou1apen ietydfsDrmnvo u)tetnmo iydlp raneolt0t2xoim iy4am n fcil(  rraurpot4oeeomoctat s2ua( o;t) leomfcty1fpte ieolt0 2to(mpny1omenlfvt t  rumxr oo4opx  octys s ea( on(0tetnmr3totlaD lu s t t2xoxmpiudlp emnvslsf 2umxm oo1oltoioetadfa2uanvo u)arxoxr iydlpt au olt0 eumxopnydapenlivsat) rua(  ot4tle  ocild mDran pn(4 eenxociy1fm ean ilt) 2xmxrpio1olt lfvt ( s2tm( onu0tlxn feiaslm rlnmp u4trxrir3tytoptrlu ilt) rto(o io4llenmivta(fs2ur( oou4ale micilslm2ran o;t0 rxrmo3iodoa ean ils0 rto(rpiu4am e iet s a2rr(r ;o0tleo feiadlm2rlnvs;u0 rtnio3tatlp e n i t) rtoir3ny1lm elieslt)aDraurp;u1oeeniociaslm2rm(mo;u)tetoio tatlpD  n i s) 2xmxo io4llte nvtls sDrmxronu1aeen fciasfm2ulnvo t0tlxoioctodfm r ieils srxmio iudlmenmfctat s2ta(rpno0tpx  oetltls eanmo;u4 lxomfcoadfatrlneil() rxoiopio1amtnmfetasf rtrurooo1alxnio3tatfs2ul(vsn(4trxoxrcoytlp rluei t) eum(m no1am emivs s  2tmurp;u1tltn ictas sDelnvo u0tltrir oytlp ran sls) exoir3oo4lp n ncsltf rrmxr no0oetnifeiyslsDum( on()tetrmo3oo1fp  lues ()t2xr(mpiu4ap nmnviat) rurx poo1aet ioeiyt sDrl(mp;t0teenif tytlaDeaivols texrxrpnydom n nct tfa2uaxronu1optnioetltfa ra(vo ()tltnxo oatomDeaueo;t) exmxrpio4openmfcslsf 2ur( pnt0teenmi3iadla2ul(vs;t) ltnmrctydfpt an i;s)trtrir nodaltn fvi sfs2rr(mpou1tetoifctadla rlnmsnt4 eenmo3oatfm  lnvo t0 2tm(mpiydameelfei tfaDra(mo;u0apx  fctatls2emuvs;t0 ltrioctydfmt aieo t srtmio oy4lm e fetl(f rtau pnt0apxoiiciydfm rl(mo t)tltrifcootopDeau i t) eumirpnydap e fctlsfsrtru oou4olxoif3iltls rm(mo;() lxriocio1lm r nvs;s)t2umxr3oo4om elneilt  Drrumpou0aleomf3iys s ua( o t) lxrmfciytfptran slt texrio3oudlmtelfcs t)aDrmx  no4aee ifctlt m2umuvp;u4trtnir oadomtr ueols0 2xo(o nudlmen feta( s2ta(ro;u1texniieilslsDeauvo;(0 etoircoydom e nes;s srxoiopiodal nmfes () rrrurpou0texoio3ild s umuvo u0arxoifciydoaDraieil(0 eur(r nudllen fctl( s2rmurp;u1ape  f3tyd m2rau p;u0 eerif oy1fmt an o s0srxo(m3oy1omenmfvt t  Dra(mp;u0oleomiciaslaDelumont0alxrioctatfa   u i;s) rtoiopoudaltnmfes sf Dtrxmp;u0opeoii3ilslsDrlumont4 reoxfciatfa  lieol() rur(opiu1alen fviltfa2urumonu4tle  oetadfs2rlnvo;(4tlxrir ootopt aieils0truo(opnu4olt lfvt sf 2rau o;o1ole  feiat a2ranms;u4 etrmrciydfp e iei ()sruoxopnu1opt lnctas)a2um(rpoo1altnmoeiad m eanvp;t4tltomf3oytlmDrlu i;( t2um(mpnodlpee fcsls)a2raxrpnu4altnifeiatlm2rln on() rtoir ty1opte nvs;() rtoxrpoy1openlnetlt s2raum nu0aetn i3tasfa emumo (4arermr3tydfmteli i () eumir3nu4lmt  ncta(faDumxmooo4alxoiieilslm rau p (0 eenmociy1fmtr ivi s srurimpiudlp  lnesat) 2taxronu1apeo ietltlm ulnvsn(0trxnxo oatfpteaneil(  2xoimpiy4altnmivs ( a2trxmo;t0texn oeiasla rmnmonu4 eermocoatlpt  nvi () 2uoxm iy4ameemieta() rurx  nu1optoii3iyslsDelumo;(4 lenxrctadomDe neo;()setoxmpiu1llt  fctl( sruaxr nu0opx miciytfsDrlnmp t4 etoxo3oydfmDr uvi;s0s2tmim3ny1llee fetat s2rmumo;u1aleo f3iytlsDulu s t0teermo oadopD  nvi;s) rxr(m iudllt mieilt  Drrxmo;o0tpxn oeildla2umn o t4artomf3ta1op r neo;() 2uoimpny1alee fvil(  2uau pno4aptoifcilsfa rm(vp;t4 lenxf ta1om r ivs;()s2toxmpiodlmt miviltfa2umur nu0opto ietydlmDua(vo u)aeenxrcoodlm rlu o s  rtoxrpoydlmtnmictatfs2umurp;o1aetoio3iys s2uluvo;t0 rerxf3oo1oa eluesls trtrio oo1op elfvslsfsDurum nu0tex mociytfaDeanvpnu) lermo ta1oatran i s) etmxrpoy4lpeelfet tfaDtmu oot4oex mociaslmDuluvp;u4 lermf tytlmteli o () 2tr(r oo1om eliet sfa2rmu  ;o0aetnmi3iys a2umnmp t0arxomo3tytoa   i o;(0t2tmxopou4amee nvtlsf 2uaxr ot1oexn i3iasls2rmn o u4arxrircoytfpD an olt srxo(o3oydomtnlfesas sDtau pno4tpe moeiydls elnvsnt0tleoircta1fmt lneo;t) rtmxmpiu1omtelncs sf Drm(rp;o4ape if3tytlm elnms (0tlerxf3totfaD au i;(0srxrxm iodlptelieil(fartrxr nt4opeo iciydfaDemn p (0 ltnxr3iydopt auvil( sexmir iy1apt lfvi s)a2tmxrpno1oexo oeiatls em( on()teermrcoytoptr nei;( s2uoxo nudlptemfcsasf rtr(r ;t1oeeo ociys aDumumon(4arxomrctydfatelieo (0srtrxo oodamtn nct () 2uaxrooo1opxomfciatlaDuanms;()tetrmfciadfp r ivi s  rurxmpnu1openmfviasfaDtaumpoo1tlenmieiatlaDel(mpnu4artnmf3ia1lp  auvs;(  2trxmpio1olt miesatfsrum( o;o4ope moeiytla uanvp u4artnir3oadfa elies;s) rxmxr nodamenmfci ()s2rm(rpno0teeniiciad sDrm(vpnu4arxrmr3iy1lpD ai i t trtrxopiy1aptelfvs t)aDtm(monu1aptnii3iys m2ua(mpnt) etnxo3iotfa  lnesl(0trumio iu1lpee ivsl( sDurur ;u0aexnmiciadlsDulu o (0trtrircoo1fatrlnvilt) eur(o iu4ap  mnct s) Drau ont1teenifetadlm uluvp u4tltnmo3todopteli i;s0t2xrim ny1lmee nctls  rurx ont4tpxo o3iydla2emnvsnt4aleniociotfa rai il()t2xr(rpoudlptnlfvsat s2tm(root1apxnioeiyd a2elumsnt0 ltrxr totlm e uvo;() 2uo(r nydalee fet tfa2tmxmono0aet mietltlm uanvonu4 reoio3oatfm raneols t2tmxmpio4apen nvtlsfartrxmp;o0tlxo i3iat s elnvonu4texrmo ta1la raueslt trto(o iydllt mneils)aDtaumpoo0tlxoiociat aDuan o;(4texniocoytfp  ln s (0 rumxr3oudam n iciasfsDtm( o;t0tetnmfetysla rau p;u4aeeomf3tydoaDelu ols0t2tr(r oy1ap nlnci tfartr(m no4apx  ieiatls rmums (0trxomo3oatfpDelneils) rxriopiydlmtelivs ()arra( o;o4tetnmfeiadlsDem(mpnt4teenifcoatopt  nvi;()trumxo io1alt  nvia() Dra(ro;o1tetnif3tasla2ra(msn(4artrxf oytfa rau s;()seur(m3io4lltnmnctltfsrraxrpoo1tpx io3tldlaDuau sn(0 rxomo3iadlmtr n i;s)t2xr(r3iy4lle mfvs (fa2ur(moou4oexnii3tltfmDem( s;t4 lerir iy1omD  n s ()tetm(r3nu1lpeelnciltf 2rmum ot4apxnii3iyslaDrln pn(0 ltnif3oy1laDr i i s)teurio oy1lptelnes tfsrrru  nt0alxomo3tad a emn pnt) ltrio oo1fptr ueo;s srtmxopno4omeemfvs s)srrrur nt0ale iiciyslaDean onu0arerifctytfpDeluvs;()sruoxr3oo4apte fet () ruauroou1opxo f3iytls2ranmo;()tlenmrciy1oat aivi;t  eumxr3ou1ome  nvs t) 2urxrpno1oexoii3tys s2ua(mo u4altomf3oytfmtraueo;s)t2uoxo3ny4lp  livsltf 2urxm oo0tpxn i3tadls2uln o ()aleoif3iatlm  ln o s)srurxr nu4ol eliciat arra(r no1opxoio3tysfm2eanvp;(0 ltnxr3oydfm   n il( t2toxmpoy1amtn fcslt aDur(rp;o1tpx ifeiasla eau s;t0alxnio3tadoa   ivsl()s2xmxrpnu4llt  nvtatfsrrauroou4apen o3tysfa emump u)texrif3ootopte nvi;s s2umim iudolen neils)s2trur nt4apt iiciltfa2ran o;u4tlermfciotopt lneols  rur(o3oo1olt mics t s2ta(m oo0oltniiciys sDra(msn(4 leomo todlp raivs ()teumir3io4lle mfvtat srrmu o;u0alxoifetld s2ra( p u)tlenxf todfpDrln il(  etoirpnodop e ncs t  Drmxmp;t1apen oeiydlsDrlnvs;(4 exrxo3ta1lp rln slt)trxoimpiodole  nesat a2rrum oo0alt mociyt a2emu ont4tetomf3oadop ean s (0 rtoxm oy1oltelnctas  ruaxm ;u1apxn fctatlm eluvsn(0trxrxrciatlmD luvils0 rxo(m3oo1aptnmnvslt srtrur no4tpx  ieiyt s2rmu snu4artrxfcoytoa   n ilt0 exrio oy1ale mnetas)aDtaxmo;u0altomfciltfm rl(vs t4 etnxr oydfmtraues;s0sexoxrpoodap emivta()sDrrur ou1tpx ifciadls emn ont4tetoio3oa1la e uei;t)teuo(m3ny1oltelnci ()aDtru o;u4olxnio3ild s ul( on()trtrio3ootom eli i;s t2xmiopiy1ol  mieiat sDuau oot0tle  ociysfa uaump;(0artoir3iatfptelueo;t) rxmxo3ou1open fctas srta(  nu0ole  ocilt sDuanmo;t4 lxomo tydfaDr nvo;t  rumxmpiudolt lncs (fa2tm(mpnt4oetn ictysla2ran s;u4 exrmo iodfm eauvilt0 2trir3oy1llen ict tfsDrrxr ot0alt mfeiyslsDea(vs u0treomr ootomtr nes (0seur(opiu1al e fcia(fsrumurooo0tptomfeiat m2ul( p;(0 eeoxrcoadfmD an i;t sruo(mpio4amee nei t a2rrx  ;t1aexn ictat a ulnmp t0tltrir totlaDe ivols) 2xo(m3iydllenlncsltfsruaumo;u1aeenmfetaslm2umnmp;u0 ltnmo oatfpteauei s)sexoxopio4lmtelnvia(farta(  ;u1ope mietltlmDelnvont4 lxnxo3io1om elu i s) eumiopoo1apenmnvsas)s2rmx  ;t1olen o3tyt s2emu ont4arxrir3oytfpteauvo s truoxm io4lm nmnvs sfa2tmxmo;o4ole ioctlsls2umn p t0artomr3iatlpDe u i;t)s2xoiopnydlleemncsasf 2umurpoo4tle miciysfsDeanms;u0aexomf3oytlpD lnvilt trxrirpou4am nlfei ()sDtrurono0oltnmoctydlaDulu o;(4aetnmo oatlaDeaivslt) 2toio3nydamtnmncilt aDta(mo;u4apen fctasfmDeluvs (0 rxoxr3iy1fm eanvolt sexrir3no4omeelicia( s2uau  nt4tltomictlt s2el( sn(4 rerxr oydfaDrau i;t trtmxm3iu1om  lncs (fsDuaumpou0oex  i3ildla2umuvp t4arenio oytfa r nvi;t s2tr(rpiodap  mfeiat srur(r nu0tltomictas sDulnvo u0tlxnifciy1lpDeli i;s0teurimpoy4ope lfeta(fa2umxm ot1alto f3iytfaDeaumon(4tltomfcty1fp e ivi;()trur(o no4ole  ivsl()arrru p;u0apxoifeiyd s emn o t)teeoir3iy1fmD  n o;( s2xoxopiy4al e nviat)artmx p;o0aeeo o3tytfsDumnvp;t4altnio todfmteau i ()setr(rpnudaltnmnvi ()aDtaxrp;t0alxniieilsla ea(mo (4 lxoifcoadlpte ivo;t)t2uoio io1lltemfvtls)sDurumont0oet if3iys a2elump;u4 rxrifcoa1lmDeanes ( texrxm3nu4ape lncsa(fsDrr(rpoo1oetnio3iysls2um( ont) reomo3ty1latraneilt)s2tmim oudll elictl(fa2umxmpnu0teto ociys aDumnvo t0 exnxrcoadfm  au i;t) euo(r nu1lptnlnesls  Dra(  ou4tltomociydlsDra( pnu4aetnmo3ta1fa rlnvi;s0 etmxr3io1lpeemnviat)srraxmont4opxnii3tatlsDulnvp ()trtomrctytoaDr u s;(0srum(o3oo1lptelfvt ( aDum(m no4tee mfciat aDeaump u)tltoxo oy1lmt  ivslt)seur(opnudam   ivils)a2tmurpnt4optn oeiatlsDuanvo u0trtrxo oydoaDrli i;s)trumio3iu4op  lnvs ( arumxmoou0oee miciasfm ulnmo u)tet
\ No newline at end of file
@@ -0,0 +1 @@
+i i;t) exrir3ny1olee fei sfsrrmxmo;u1olenio3iysfsDemumpnt) ltrmr iatfm e nvil(0t2xmxo3iy1al  lneslt sDtru poo0optomi3iytlaDumnmp;u)alenir3iadoaDr ies t0texoir3no1lptnmfvtlt  2urur oo1oet  octatfm2rau s (4tlxrxrciatfmt  uvilt t2xo(m oo4optnmivt ()s2rm(root4aleo f3iasfa2ea(vpnt0 eenxfcoo1oa e u il( teum(o3iydaleemics sfa2ur(rpnu4aex iietlt sDrln o;(4 etoir oadlat  nvs t) 2xrxr3no1lmtnlivsls)s2umxr ;u0ole  ieiltlsDrau pn(0trxnxo3ty1fp rln i s0setm(r oo4olt mfviat s2ra(r nt0alxnmoctadls2elu pn(0 etoxrctatfatrlu slt0srtrxmpnu4lle lieiat  rrrxr nt1oetniiciytlm2rmnms;t4arerir3ootomDelnvo t0t2xo(m3iy4lm nlfvil()s2uau  ;t1aleniietasfmDemnmsnt0artnmf iadop elueo;( s2urim iodlleemnvta( s2umu  ou1tpeo iciltls emu snu0areomrcoydop r uvs;t0 2xmxo3oodoltn net s  Dumx pnt4olxomfeiytfs ea( pnt0aeenio to1fmDeaues;t0srto(m nudlmenlnvsatfarrr(  ou0tlen ictld mDem(vp;u)trxnxfciadoaDraieo;( s2umxr oo4omtnmnes t  rtm(rono4tpe  fetlsfs2umumo t0altomo3ty1op   ies;( setm(opnu1llenmietlsfsDtax poo4alen ietldfs2ul(mp;t0altrir3to1fm e ues s tetm(m3oy1lltnlfvia() Draurp;o0tex  icild m el( p;t4treoifciydlmDelieils0t2tm(o3oy1lme mivilt  Duax o;t4apx ifcilsfaDumumont0teenmociytlaDrli o;t  2xoxmpio1alee fvsl() 2ur(rpoo0tpenif3tldfs2emnvs (4tetnxf tadfmDelnvo t0 euoxm3ny4lpt  netltfaDrr( oou1aex  fcils m2emumo;u4tetnmo3iodfmt lues;s0tetr(o oy1amtelnet t)aDrr(rpnu0altnioctasfaDrln p;u4 ltrxo oodlm eli o t) eum(m iu1lm n icils)srraumonu1tlt  f3iys s umnvs ()tlermo3todlp e i il( setoir3iu1llt lfes t srraumo;u4teeoiietlt mDrluvsnt4 rermr iy1fpte ueils trtm(m iu4ome  nvil()s2tmxrp;t0tpe io3iaslm em(vont) eenxo3tytom  lieolt srxoxo oy1am n icilt)sDtr( o;u4oltn ocilt a ulumpnu0trtnxf3iatlaDraies;t)setoir3oydaltnmfcsl(faDuaurpnt0tlxomfctysla eauvpnt0 leomfciatlm   n s s texoxm iy1olen fvsl(  Dururpnu4olxomicias m2ea(vp;() etrmo3oadfmte i ols)srtoxmpio1am elfct t  Duaxronu0olt moctldla umu o;()alxnxo3ty1op  lnvs;t setmxr no4lleemfctatfaDuru  ;o1tptnmfcildls2rmu p;()aetoxr3ootfp eliei;t0sruoxr iu4lpee iet ( a2umum ;t4tpeoioeiydlmDuanmont4 ltnmo ootom   ueo;()seumxo3oodal emivil()aDrau ooo1tetnioetatfaDea(msnu0tltrif3todlm e ieil(0teurxm3nu1omenlnci (  2umxr nt0tlto feiytfsDran pnt) exoifciy1lmt auvi;(  rurio ou1llt liei (fartmumpou0olxnmociad m rauvsnu) leomrcoydla  anei ( srxoxo3iydlpe mnvt s)sDraurpoo1aptoifciytfsDra( onu4 ltrxrctodomD ai slt srxrxr3oydlm elfvilsf 2ta(m ou4tetnmoctldfm uln s (0texoif totlaD  i slt)sexmim3iu1omee fvsas artmu  nu0tlt  i3tasls umumpnt0arxrxrctodlmDrlivs;s t2tr(rpnodopte netltfsDraxmp;t4ole  octlsla rmnms u) etoir oy1omDrln il()seumxm3iy1ll n nesls  2umur no4oltnioeiatlm2rm( s t0 rtrmrcoo1lpte uvo;s t2umir3io1apeelfcsas  rtaumonu0tetnii3iyd a elnmonu) rxrio oydlpteliei;t  rxm(m iu1al n icsa()s2tru pno4opto fciydfa eln pnu0 ltoir tydlmDeanes t)sruoim3nudam  mfvia(faDuaurpnu0alxniociatfa2raumo;u0 lenmr3tadomtrlivi;()tetrxo3oudlmtelnesa()sDuaxmono0apeomiciytfm2em(vs t4trenxr3iodoaDr u sl(0 ruoxr iy4oltnlnviltfa2rax  ;t0tpeo octadlsDeau sn(4arxrio3iy1lpDelneilt0sexo(r iu4lle mnvs ( s2rmx oou1altnmf3ild mDeluvo;t)aetoxf3tytlm   i s;t0s2xoxm iy1amt lnvilsf 2uau p;o4tetnio3iatls2um(vonu0 reomf3iotlmte ivolt0teumxm ny1aleelivi ()srtaxm ;o1apt ioeils a ra(mo u4treoxo3tatfptr ues;s0teto(r oo4optnlivi tfsrtmu  ;o1aptoifcils a2elumo;(4aetoio3oytlm rli slt  2trxopoydope  ivta() rrmur ;t1tptomoctytlm2emumpnt4 etrmr3ia1lp r ivi;( srtm(m iy4omen icils) 2tr( o;u0texoif3iysfs uauvp;(4 etrif oatlp  auvo s0srurxo3ny1al  lfetl() Durxroou0aee  fciyt s2rlnmo t0tltoircoydfmte ies;( sexo(m ou4ll n fes tfs2rr(  ou0tex  octls s ea( s;() rtnmrcoatlaDe u o s)trur(o3oydaptnlfvsl(fa2raur ;u4olt ifctlt s2uauvp;u) rxrmr ty1fm r neo;s) 2xoxrpiu1ope  nvilt)srrrx poo1apenmietat mDrmn onu) etrxrctatfmtelieo s trxrxm iu4ome mies sf rrmuronu0tex  oeilslm2uan s () lxrir iodfpt aieo t trur(r ny1lp emfciat)s2tmx pnt4tex  ocils a2elnvo;u4 ltnmo iotfm r ivo;t0texmimpny1apt  fvi t)aDta(  ot0tleomoetys aDel( sn(4 lxrmf3ia1lp elnvsl()s2uoxo3ny4lmt  ivil()s2tru pnt0tpt mieiadla el(mo;u0teermocto1om eanvs;(0srtrio iu1lleemnvt (f rumxmpot1olx moctysfs2um( on(4 rerio todlp e ues (  2toim3iydlp elneilt aDrrx  nt4tee  f3tyslaDemnvsn() rxoif3iadlm eaues;t0trxo(o no1alt mnviat srtm(mpnt4tlxnmicildlmDel( ont0arxniocoy1op   u s;s  rxmxr3oo4lptnlfvtl( srrr(r ;o1tltoifctyd sDrmn o;()texnmocoy1la  li slt)s2trxm nudlltn fesltfs2rrxr ot1tle  i3tldfs rmu p;(0texnxfciytlaD luvi () 2tmir nydlpt  ivias)s2tm(  ou0alen ieiys aDel( o (0 lerxf oa1fmt lu s;t)trxo(m3nu1lpeemfvtlt)sDtaxm oo4alenifeiysls uaumonu) ltoxo iotlmD ln ils)seumxr oydaltemnet t)sDrmu pot1olt ioeiltfsDel( p;(4trtrxr iotlm eaueolt setrxm3ou1openlicils) rtru  nu4oltomfetadfa rl( pn() lenxr3to1fm r i s;(  ruoim iodlpt  ics s s2uaxrpnt1tltnio3tytfa2rau o;u4arxomrciytomtelivilt) rtoimpny1am elfviasfsrurumpot1oex  i3tyt m emu o (0 exoxr oatlpt aivsls0 rtm(mpoy4lm elfct s)sDtr(mp;u4tltomfciyslm2ea(mo ()tlxoxoctytop e nei ()t2tm(rpio1lmeemnvsa() Drmurpno1openmo3iltla rl( s;u0 eerxo oadoptr ivs;t  rtmir no4am  lfetas) rrrur ;t1olxnmo3ilsfs2uau onu)tltrmo3iatopDe u o t  rto(r3oydlp  lncsl( s2uaxrono4texoio3iytfaDeanvpn(0aeerio3iodlmD lu i (0 2uoio3iodam nlnvsas s2rmuronu1tlx mieiytlmDrluvs (0 exnxf3iodfp rai o (  eumxr no4lleelict sf Duaum oo1tpx ifciydls elums;u4 eeoir ta1fpDelneolt0 2tmimpiy4optelnvt t  rtax o;t1optoifetld sDulnvpnt0 lxoif iydoa   nei t teuoio3nu4optemfvsas sDumxmpou1optnioeildlaDeaumsnu4 rxomf3ty1om r u il() rxoim iy1lpen nvtat s2taxmont0tpe mieiyt m emu onu) etnmr3iytomtrau ol()t2xoxm3iudlltnlneslt)s2ur(mono1aetoiietys m2eaums (4aeenmf oa1om  ai slt t2trio nu1alee nvsl( sDua(mp;o4oexoif3iat s2emu o (4aetrmf to1omt anvi s0teurio3iy1om  mnvt s  Dtau oou0tptniiciatlsDeauvsnu0 ltrif iatfptelivi;s)srxoio3iu4om elnviltfaDumxrpou4tpeniietadfs rm(vp (4alerif3to1lmt livsl(  etmxo3ny4om   fcsa(faDtm(mp;u0opxomociadla2umumo;(4 lenmrciodlmteau s;(0t2xm(mpiodlp e fcils sDuru  ;o4tltniieiltlm umn sn()aexomo iadom r ivilt)tetr(o3nu4omenmnvsat artau ono0tee  feias mDemnvs t4alxrifcta1faDraues t0t2ur(o3oy4ole  nvilt artmurpno4oet moctadlm rln p u) eermrctatom r uvs s)tetr(opiydaleemiesls)s2rru oou1tleomo3ilsla2rlnms t4aetrmociatfm   iei s0srtm(mpnu1lmenmicta(fsrum(  ;u1teeomieiatfsDemnmp (0alxrio iy1omt aieol(  2tr(mpoo1am   iviltfsDtaxmo;o4aetnii3tyd aDel(vo u4 etrmfcoa1fmt aneo;t0 2xmxr3ny4lpe mfct (fsDra(mp;u0texo oeiatfa2uaump;u4artnmf iodfmtrlieo ()trto(r3oo1ame mnctls)sDrrxmpoo4oleo oetydfs2rmump;u) lxnir3iydop raueolt0t2trim3io4oltnmivias a2taumpno1ole moeilsfs2uaums t0 lxomfciy1fp eli ilt0srur(m ou4lm nlfeia(fsDurur oo4oetomi3iytlm2rl(vs;t4tltnmf iatom   u i t srxrxmpny4ol  mfvsltfs2umxm ;o1aleoifciadfa2rmn o u)tleoxocty1lm rli o ( s2xoiopnodlptelneia( a2tmu  oo4aee ioeiyt s2eanmp ()tlenmo3tadop  ln o (0t2xmxmpnu4lptnlnvi t)sruaurono1aet moctlsfa ua(mo (4arxnxo oatfaD ai i s  2xo(m oo1lm  lfvil(  rtmxrono1oetnmicilslm2elnvo u4texnxrciydfa r nvi s)sexoim iudlm elnvtl(f 2rmx oou0opx  o3iad s2ua(vp;t4teenmo3iotfate ieols truoxr oydlptemnei ()arra( pnu4oleoio3tld s2ulnvs;u0 renmfctodlaD  neols tetr(r3iu1omee ics tf 2trxm nt1tex moctlslm2umums u0tetoifciytoaDe nvo s s2toxopiydlle licsltfartr(rooo4oltoioetasfa ulnvp;(4trtnmoctydfmte ueslt  rxm(opiy1oltelfvtas  Draumono1opeomoctytls2um(mo;u4aeerxr tatfa rlues;t0s2xo(rpou4apenlivs sf 2ur(mooo0tpt if3iatfaDem( s u) rtoir oa1op  lneo;( teuo(r oy4ll elfcil()sDuax  ;u1alxo ociat s2ua( s;()arxnxo3oa1fm  ai o;t t2xoxo3iodalt  nctat sDtrxm no4olx miciytfa2rmu s;()teermocto1fp  li ilt)srxr(m iudlleelfesat)sDrrxm ;u1aexnmiciytlmDrmnmo;(4 rtrxr3ia1fpD  ivi;t)setr(o nu1lpeemictat aDuaum no1oetn fcildlm2rmuvsn(4 lxrif3iadopDr uvil(0teur(m iudop emfvil(f 2rrx  ;t0olxomo3tyslm2um(mp;t0trtrio iatfpD  u i;s0 2umir3nodam nmfvtlt)srumxmono4aexomi3iytls ul(mpn(4 rxrxr ta1fp eau i t)srtoxo3oo4ol  lfetlt)s2ua(m nu0alx  feiyslaDem(vpn(4 exomo iytlmDrlivol(  euoir ny4lmtnlnetltfartmxroou4aexomoctytlm eanvs;()arxrmr iatoaDeanvs t0 exmxm oy4om n ivsatf 2raxroou4opto fctldlmDea(vs;t4 reoxo3to1lmtr nei ()t2tmir3ny4olenlivil(fartrx  ;u1ape mociys s2um(vsn(4 rtoif3iydfa eauvil( sexoxm iy1op elivi (farum(m ;o1tlx ii3ilsfm2rln p (0 etoxfcio1fpD lu o ( trtm(m nodapeelfesls  rtr(mp;t4optomfetasla2eanvs;t) leoxrcto1faDelues;t  2toir nu4lptnlnet ( sDua(rooo1ape  f3iat a2eluvs u)aeenio ia1fptrauvolt0tetmxo ou4amtn ivsltfsDurxm nu1tpenmocilslaDeauvsnt)tlxomr to1fm   n s t0trum(r nudapenmieia(f 2rr(mpnu0aeenmo3iydlmDra( sn()tltrxrctodlmt  ieilt trumxr io1ll nmnvi tfa2ur(rpoo4tltnioctytfs rauvs u)aetrxocto1optr ueo;t t2tm(opiu1om e nvtl(fa2rmx o;u1apeniieiydfa uluvs;(4tltriocio1fptr n sls)s2uoxrpno1oltelietlt)a2tmum nu4tptomieiasls2rlnvs;u4trenifcoatfmtrli i (0 rtoxr3ny1al  mncia()aDrmxm ;u0tlxnmi3tytfm2rluvs;(0aetrio tytoa eli i (0 euoxrpiy1om nmncsat a2tax  nu1aet mfctltfaDrm(vo ()artoirctadfpt aieslt)seuoirpno1om   fci t arrmurp;t4olt  i3tysfa2uau o;u0aleoxociy1oatrai sl(0trtm(o3iydoltelneilt)aDrau pot4aee ifciltfa umuvon(4aetrxrcoa1oaD anvo;s setr(o3iodllenlieiasf 2umu oou4aee iocildlm emnmpnt0aetnxr ia1lp   u o t0 rtrxopoy4ll nlict (fs2tmxr ;o4aet micias mDrluvsnt0teeomr ta1fp   uvs;t setr(r oy1omenmfvsat aDra( oot0oex moetldlsDranmsnt) rtrmo oa1laDelnvs t0t2urio3iy4alenlnvsltfsrtrx oou0oeeo f3ils a uauvpn(0 exoir ta1omtranvols0 2trir oo1lpeelici sfsrrru  ou4oeenioetlsfa rlumo;u)altnmr3tatopte uvi s t2toiopoo4omee iei tfsrtmxmpot1oetnif3iadla ua(vo u0arxoxo iy1lat lneolt0 rxriopiodapt mncsltfs2rmxm ;t0olto oetysfm2emu p;t0 exoxrciytoa eauei;() euoxrpny4omt mfeilt)s2taxmp;t0tex mo3iltlm el( p u)tlermf3tydopD  uvo t0t2tm(mpiudolenlnvt t sruaurooo1open octysla ranvpnu0 leoirctatlmt luvil(  2uoim oy1ome mfct (  Drmumpoo0apxo f3iysfs elump;t4 rtomrcoa1lp rli s;( setrio iu4op emfctatfarrm(mp;t1teen oeild s emumo;u4 ltrmo io1fpDeai i;( t2trirpoudap nlfvs t) rrmumo;u4tlxo f3iyd a2uanmsn(4tetnio iadfmte uvi t)teuoxo3nu4lmen fvils) rtrxr ou1aex  ietysls emn pnt)tetoxo to1lmt lnvs;t  exrio nu4llt miet tf rtaumo;u4aeenioeildls2ea(vp u)alermr tytfp raivo t0 eumir3iy4ol   iviatfarua(  nt1tlto feilsls2ul(vs;()aexnif3oy1laDeln sl(0 exo(mpoy4ap nlnctasfa2ta(mp;t0texoifetydlmDumumpnt)arxomf3ta1la eau o;( trxo(m3oo4olenlnvt (  2ra( o;u4tpxnmfetldla2ul(vp (0trxoxociotfmDe nvo;t)trxoir3ny4llenmnvils)sruaxmpno0aexo ociltfm2elump t)texnxr totoa rai s (0sexrxm nu1aptnlfvtls)sDum(rpnu1apeoioeiad s2ea(mp (4tetoxoctydfaDrln sl()srur(m3nu1omee fctatf Dumu  ;t0oexn feilt m eln s;u0 ltnmr3iadoaD livo t0 etmim3iodlp nlfesas a2tm(mo;u0alenmfcilslsDulumo;() ltnmf3iodlpteli o t tetrir3oy4lp nmietas  2taxro;o0altn fcild aDua(monu4trxrmrciotfa eai sls)s2xmxmpiu4optnmict ()sruaxr ;t4tlxo ietadfaDel(vont4tlxniocio1fa ranes;(  rurxm ny4op  lics ()artrxrp;u0aeen oeild a2ul( pn()arxnxf3tydfm   n i;t  2trim io1op  mnvi tfa2rmuroot0tpxnmfeilsfa ran p;t)alenxf3tytfaDr u ils)trxoir iy1om n ivs tf rtrxront4alx moetlsfaDem(mont)aeeoif3iatopt  nesl(  ruo(m3no1lp e ivsa( srrrurp;t4tpt mietld mDemnvs;t4aetnxrctatomtelnes s0teum(opnu1alenlfeils  2rrxrooo4tptomi3iyd s rmu s t) exrmo totfm  ln i t)sexm(rpiodop   iesasf rtrxr no4apt ifciad sDrluvs (0 lenxr3tadfat  i slt) eumxm3nodomtemnvs tf rtr( ooo0oex ii3iytfaDumu o;u0aexrxoctodlaD  ivi t srtoxm3oydoptemivtl(fartrxmo;o1ape iieiadlm2rm( o u4trxrmo iydlpDeaiei t srumxo3oodap  mnct (fsDtm(  ot4oexomf3ildlaDeanvp t) ltriocoadfmtr iei;t0 etmimpou1ope lfvt ( s2ra(moot1aeto ociatfmDua( p;t0trxoxfciodlptrluvi (0 exm(o oodlme micil(f rrrxr ;u4oleo oeiadla uauvon(4 rtomr3totla  li slt0t2trxopio1amee nvi tfaDumxrpno1tltoiicilsfmDemn s t0aeeoif3iatomDrlneo;t0tetmxm iy4apeelfvsa()aDumxr ;o0aex  feiltfaDum( ont0trxomf oytlatr neo;t)texoxr3iu4omtnmnvs s sDra(m ou4aetniieiydfa2emuvs u4altrif3iy1fmte i o;() 2toxo3ou1amee nesa( artmxmo;u1oleo fetydfaDrl(mo;t0 reoxociytlaDr n sl(0tetmxr3oy1lp elfciasfsDrauro;o4aeeomoeiadfa em(vs (4aleomf todlatrluei;s0 eumim nydopeelict t a2trxr ;t1opxn fctls s eau o;(0aleoxo3oy1fpt lies;(0 eur(mpoy1ame livi t)sDtmumpno0oltoiictatla2em(mpnu)aeenmo3ta1la   ueols0sexoim iydopt liesa(f 2tax pnu4ole ii3tydlm2emuvs u)texrir oatfaD  nvil( sruo(mpou1ol nlnvtas s2tm( ont1aex mocild a uanvont4 lerxo3iatfpDr nes t)tetr(r nydomeemfetlt  rrrxrp;u4tee mf3iatlm2ea(vont)tltoxr3todfmt lues s srxmxr3iu4ope micia( artax p;t4tltomfciyslsDumnmo t4areoif3iatfmDrauvs s s2trxo3nu4ole  fvs t)srrmurooo4oexoifeiydlm rm(ms t)arerxo3ta1fpDr nvo;s) rxmxm3nodopt  fvsa( a2rr(mo;o4opeoiiciasfmDel(mp t4tltrxf io1fmDrlnvo;(0t2ur(opiodlltn nvi (fsDrm( p;u4altnmoeilslmDean o t4altoxr3oa1op rlnei;t) 2umirpio4omt lictat arrmu oou4aexoifeiytlmDrlumpnt4tlenxr3oadlmtranes t0 rxmxm io4ll n ivi tfa2um(mpnu0openmieiyt s ea(mpnu)tlxnmf iatlpDrlues s0 2xrxopoo1omtelnei s artmx pou0oetomociydfsDumn o t) leomf3iodopDrluei t0 rtmimpoy1ap nmivs s)sruaxrono4oexomiciaslmDuluvp;u4 rtnmf ia1fpDr i o (0setrim ou1aptnmicsasfaDta( oou0tpxo oeilsfm em( s t4alenxr3oytfp e uvo;() exo(r io4am  miviltfsDtm(mp;t4alenifciasfmDrlumont4 ltrxo3to1fa eanes ()s2tr(o3ou4ome mfvilt  rururo;t0apeniiciadlm ranms u)tltnifctatoa elu o s0trxmxo io1al n fet t srrm(mo;o0tltnmo3tad s2raumon(4trtrxfctodomteaies;() rtm(o3nudopeelfvtas s2rmuroot4teeoio3iydlm elu s u4 leoxf ootomt lneilt0tetmxrpno4ll  lietl(faDtr(r nt1tpxo ietys s rmump u4aetoxf3tydfp rlnvi;s0truoio oo4lpt mfvt tf Dururoou4oexomfeiatfs eau o (4arxnmf iotoptrlivi;t0t2trxopoy4lle mfvtat)sDrmu ono4opx mo3tysla2uluvo t)aeerxrcio1fa  aieo;t srxo(r3oy1lltnlfcil()sDuru  ot4olx  oeiys m ul(vs u4 etnxrctydoa e neilt0tetoxm3nu1om nmieil( a2tmx p;u4texn iciyslm ua( p u)trxnmo3tytopDrluvi s sexrxo3iudam nlnci s) rrrur no4olxomictad aDel(vont0teenir3oy1omtelieils  2umir3oy4lltnmfesas) Dtax  ou0olxnmoeiat mDum(vo;t)arxrxoctadlpDe u s s0t2xrxm3no1alen fctls a2ua(rpot0opxnmieildfa rmnms;u4tltrxoctotoa  lneo t)s2xm(mpoy1ap  mnet ()aDrr(rp;o0olt  ociadfsDuluvs u0 eeoxfciy1laD lieol(0setm(m oy4lp nmnei ( a2ururo;o4aexn oetasfs rlumo;u0 rxnmo3ty1fmt  nei;t0trxoxopiy1ameemfei sf rtaump;t0oexn fctyt aDum(vo (0tlxoxfciy1latr n s s  2xrirpiu4olte fvsls)srtmxmono1olxnifeias s rln p;u0tlxrmr3tatla ran i s0t2xoir oodap   nvsa( s2ur(  ot1tle ifeiysfa2ul( o (4tetnioctadla eluvs ()texmirpiudlm nmnct s)sDur(mont0alxomf3iys s2uanms;t0artrmf3iydfpt li o;s setmxr nu4lp n nei s)a2ua(mp;t0oexo octlt a rauvpnt4tlermr3iodlpDraues;s)tetm(m iodlme  nei tf rtrxroot1apt  oeiad a2rlu on(0altnxo3iotop r nesl()setm(r iudomt lics s srrrum ot0aleomo3ildlsDeauvsnt0tltrmf3io1fpDe i olt  exm(m3ny1optnmnesatfsDta(rooo4tpe  oeiasfsDum( o;(4artrmfctadfpte uvils t2xrir iydlltn icia()a2trxmpou4ole  fetlsfa2ea(vont4trxrxr ty1om rlues s  eurim3iy1ape  feta()aruauroou0apx mo3iyslaDeluvpnu)tltrmf3iatoa rauvo;s  rtmio nu4amee icil()srrmum ;t4texnmo3ias m rmnvpnt)teenmr oodfa   ieolt) eto(mpnydamt  ivs s)aDurumono0tltn fcias sDumnvo t4 etrmociotfatr uvolt srtrio nu4am nliei (  2tm(m nu1opt mf3iytfaDean pnt0trtrmf todfpDrauvo t  etm(rpny4amt mfcsa() 2umx  oo1tpe ifcildfm2uauvs ()altoio3iotfmD ai sl( trtr(r3iy1opte ncil( artmu ono1aetomfeiat m2rlnmo (4 rerxo3oytlp  lies;s srxrio iu1llen fci t artrx onu0alxnio3tldfaDul(ms (4altnxf iotfmDeanes (0 rtrxrpiy1ap  lfvta(  2ua( poo4teenioeild s emu s;u0 exoiocoodfp eanes;t0 eumiopiy4am emfvt t a2trx o;o0tltomoctltlaDraumon()tlxnifcto1oaD ai olt0s2trxr3iu4llt mnvs t aDuaxr oo4tpxo o3ilsla emnmsn(4treomocoo1fa ranvo s0t2to(r iudlleelictat srrmu  nt0teen fciysfaDeanmp;t) lerxo iatop eai o;t t2xrio oodapte ivsl(  Drr(  ot4ope moeiatlm2rm(vp () ltnif oa1lp raivsls)s2trxmpio1lle  fetatfs2ta(m ;u4altnifeiytfaDranvsnt) lxoif3iadlp   n il(  2um(mpoudlpe lnci t aruaurp;t4tptnmf3iasls uau s u0 eenmr3oydlmt ai i;(0s2toim3iydomt  ici (  2tmu  ;u4apeo i3ilslsDuaumon(0aeerif oy1lmt ln o t)srtoio3oudapt lietas  2ta( ono1tpeo f3tlsfaDumnvp;u)aetnirciotop ran olt  etrxopiodole lneia()sruaxmono0tpt  o3iysls ra(ms;(4altnxrctatlatr uvol( setrxr oodapte nvt s a2ua(mo;o4apeomi3iaslm em(ms t) reoif iotfmt au i (  2urir iu1altn ies s srtr(r nt4tleomoeilt s el(vs u)trtoxr3oo1faDelu ols)s2ur(o3io1ape mfctat)s2rm(r ;o1aptnmieildfs ulnmp u)arxnmf totlmtr u i s s2urir3oo4opeemnvsl()sDtrxr nu4tlxomieias aDuln snt0 lxnio oytfatelu ols)teuo(opoy1omtnlfcias)a2tr(rooo0apxomf3iadlmDumn o;t0 rtoxociydla eaues t0srtoir3oy4amt lncs t) Dum(mo;o4olxoioeils m2rl( p u)areoxr3tatfpD  n o t) rtmxopnudaltemfetat)a2rr( p;u4ole mieilt mDea( o u4 ltnxr iytlmD  iei (0srtrirpnodlmenmncslsf rtau p;t0tlx mieiltlsDum(vs (4 lxniocty1omt an i;s)sexo(o oy1ap nlictasfsrurx pou4oex ifeildls2ulnvo;t0teeoxo3oydomt luvi s0trtrimpiu4apt lncia() Dtm(mo;t4apxnioetaslm2emnms u0arenmo3tatoaDe nvo;( sruoxo3no4lpeelncs s)aDtmxmpou0aexomieils a2el(vpnt)tlxnmoctotla eanvo;t0setr(m3ny1ap   nvt sfsDrau oou4tee iictlt m2uaump;()tlxrirctydlpDrlivo;t)s2um(r io1ap emivtlt)sDtax  ;t4olxnmocilt aDea( s;t4 ltnmfciytfateaieolt setoxr3nodoltelfcta( a2rr(  ot0tpenmo3iydlm2rm( p;(4 exrmocoadfaDr ivi;s0s2uoio ny1omt lics t)srtmumpnt0teeomfciytlmDulu pn(4 rxrifciodfpDeauvi;t)t2to(r iodapenmfei s) rtm(rpnt4opx  oeiytfm rmnvp (0 ltomf3ia1opteanvi s) 2tm(m ny1amenmncs t)a2ua(  ou1openmf3tldfa eau s;u4trtrxo oy1lp r i i t)tetmim no1lleelfesat  Dra(root4aexomieiadfaDeln s (4artoxoctatoptrlivolt)s2to(rpnudopt liei t s2ururp;u4opto feils sDelnmon(0aleoxocoy1fmtrai o;t srxo(mpiu1llt lncilsfsDra(mp;o4tpxomictysfsDrauvp t4aetrxocoadlmD aues;t0 ruoirpoo1omtnmivsas sDtmur ;o0tpeomf3tadls2um( s t4tlenxfcto1oaDe nvslt)trxrxopoo4lmtelfesatfarrrxr oo1tee  i3iytlm rlnvs;(4tetrmr3oytfpDeluvs t0tetmio ny4alt livtlsfs2tr(mooo0tlxn fetysfmDulu o t0tetnmo tatlat  uvils0s2xrimpny1llenmncsat a2trxm ;o4tlx  feiat aDeluvsnt4alxnmf3iydlm  lnvs t0 rtr(opou1amtemnetl(fs2rr( ono0aexnmfcild sDumuvon()tlxriocoydfm e i o;t0srxoiopnydaptemiesl(  ruaumooo0teto i3ildfm2ul(mp (0texrxo3io1latelivsls t2to(m3no4amt micsas) 2umu ooo1oltomi3ildfaDumn onu)texoxo3tatfpD  n o t)s2uo(rpnu4lm   nei ()sDta(mpoo1tlxomfeiytfs elu p;(0 renio iadomD aueil(  rtr(opnudll e fctlt aDtaxrono4ole  i3tytla2uauvpnu4 rerircia1op eauei;s srxmxm nodlpenlfeslt) rumum oo4oee if3ilt a el( s;t4treomo3oo1la rlivslt)s2toxm3nudlp e ict s srraxrpnt1alto f3iytlsDeln p;(0treomrciytop   n s ()trtmio oudol nlncsltf Dtrxr ou1alx ioeiys sDrlnvpnt)tlxnxo3todlpDe u slt) exmiopno1am e ieias  2ra( onu1tpxoifetyt a uluvo (0trtrmf iodfaD luei;(0 rtrir io1opt lnvsls)srrr(rpou4tpt mfctysfs2umn snt) reoxf oatfat luvo s t2umxrpnodaleemfctlt sDrmumonu1ole mietadla2ulu p t4texrir3iodfp r i i s0srxrxmpoy1amtnmict t)s2tmuroot4tetnmoetld sDem( pnu4aeerir tydlm rlnvi;t0 rurim3iudaptelivtl() 2rm(  nt1tpx  oeiydfs emnmont4 lxoxfcoy1fpDe n ol(0t2tmirpoo1lmeemics sfartr(r ou0olto ictydfaDua( s;u0teerxo3oy1lm r nes;s  2uoir oo1ome mnci s)aDraumpnt4tlx ii3iad aDel(vo () exnmf3iatopDr nvs;(0sexrxm nu1opeelicil(faDrmu  ot4aptniieiyt m2em( snu) lermrcoa1fp elneo (  etoim iy4lptnmies t) 2rrxmp;u1oexo ociad a2ean o u4 leomrctadlpD  u sl()trxr(rpiy4altemnvtls)srrm(mpno0openioetadfm2uan p ()trtrxoctotfptr uvs ( srxm(m ny4opee ivtlt arrm( p;t1apxnio3tld a ulu s t)teeoxfcoy1fpD aivslt)sexm(rpny4ll elnvs s) Dra( ono4alt ifcildlm rl(vp;t4aetnmrciotoa ran o;s texmxm3oo1llenmfvsas)arrm(r ;o1alt  ociys a el(vs u4aeenir3iotlmDeauvols seur(opoy4al e ncsa(f 2um( pnu0tpen feiatfa2rlu on(0tltrmo3oy1optrlieil( teuoxmpoy1op n fvs tf Dtrumo;o1tptnioeiysls2uauvs (4 rtoxr oydop  liei (0 etoxm3oo1op e ics t)a2tm( ont4tetnio3ilsfm umu o;u0aetoxr iotlpDeln o;(0 rtr(opoudll nlfesa(fsDtaxrooo1opxnioetadfa uanvo t0 lxnxrcio1omDrlieil( srumim io4oleelfctls  Dtmx ooo4olxomi3iltlmDeluvonu4 leoxf tatoateaues (0 rxmxr3iu1ll e ics ( sruauro;t0aet iociytls2ua(vs u4tlxnio ty1la eanvs;t  eto(o3oy4apenmnci t) rrau  nu1apx micildlmDranvpn(0 exnxo tadlpte nvi;t srtoxmpiy4opt mnctlsfarurxrp;o4tpxomoeiltlm2umn onu)alxnmfciatfmtrlivi (0 exoxr iydamt  fvsl(fs2taxrpoo0aet  feiatla2rlnmpnt4trtnxrctotoatraieo;t0trurxrpiu1amtelnetatf Duax  ;t0opxnifciltfaDum( pnt) lxrmr iodfm rlueo;(0sexm(m nodolte nesa(f rrrx oou1texoiiciltfa rmumo t) rxoif oadlmD lu o t0teumxo nudlpt liei (farrmx pnt0opxomo3tadfm2ra(msn()trxniocoy1fpDe uvols  euoio3nudopeemnesat)sDuau pot0apxnifeiad m ua( o;()aetnxrciydlmteln o t0s2uo(m oydopee ics sf 2tm( o;u1tltomoetyd aDua(ms;u) exnifctodopDeai o t t2uriopiudam nlnvs s)a2tr(m nu1aeeo o3tydfaDrmumpnt0altoifctydfm elnvs;s s2xo(m iy4ll   fvi s) rrrxmp;t1tex io3iytlmDrm( o;()tleoifciydfp   neo ( s2xo(rpnydlpe mivi t)s2rmurooo0tlxn o3iydlaDrm( onu4 exnif iytlmtrli sl(0tetmir3io1olen nvi s aDtmumpnt1aeenmieiytlm2elnvonu)altnioctotopte u o;s)s2toxmpiu1lme mfci ( sruauro;o4olxomieias a2eln pnt)aexomociy1lm raneo (0s2uoir nudamt  nctl() Dtrxrpnu4oeen ietat mDemn o;u4 rtnmrctotomte nvsl(  2xrxrpiudopeelfvsat)srtr(  nu0altniiciydfs eaums;u0 rerxoctotfaDr n o t0 2xriopiy4lleemnesls srum(  ;o4olxnmfctytla2eanvon(0altoif3ia1fpDrau s (  2urir ou1alenmnesasf Dtm(  ;t1oet  fctlsfs elums;t4tltomociytomtranei;() rxrxo iy1aptnmfci tf Dtrxr nu1tetoio3iysfmDemums;(0aetnir3ta1la  aues s srurxr3iu1lmeelnet (farrrxmonu1olxnmi3iadfa eln s;u4tltnif oytlp r i slt)srtrim oo4olen fetl(fs2tm(root0aex  f3iad sDemu o (4trenif3ia1fptrln il()texoxo io1ol e fvs t a2uax  no1opt mfetaslm2ul(msnu0artoxo tadfp eli ol(  eurim3nudal emivi sfaDumxm no1tlxnmf3iys s2elnvsnt4trenxf oy1fptelivi t)t2xm(r iy4lle  iei sf rtr(r oo4optnmo3iyd m umumo u0alxnmr3oydfmDr u s (0srxoxm iu4om nlfvtl(f rur(root0opxniieild a em( s;u)artnif3iotlp e ieo t)s2xmxr3iu1amtn fciat)s2uau pnu0altoioeiysfa2ua(vo;u) eeomf iy1fptelivi;s t2umirpio4amtn ivtl(farrru pnt0aexo feiyd m2emnvont4texoxrciytomDrlnes t0tetoxr3iu1ope  ivilsfa2rax  no0tpeo icilt s rm(mp u0artnmociodfmDelieo t) etoxmpnu4ale  fes (  rrmxront0oetnmieiad a2elu p u)altnmfciy1lp   neo;(  rxmxm iodoltnlfei s arum( oot1opx  ieilsfa em(vp t)alenircootfa eaieo;s teurxr iy1ap e fvta( srra(mont1ale iociadls em( p ()areomr tydopDelnes s  2xrxo3no4ape miei s)srtrxm ;o0tptniictlt sDuan o;t) rerircoodfm eli o t) exoiopny1lp n fci t)sDua(mpoo1tlxomfeiat sDemu ont0altrifcootla e neols)teur(opio1ape  fcil( srurx o;t4tpt  fciydfm ulumpnu4tltomf3oy1fmDe uvs;t s2uo(opiydaltemnvsat  Dtmumpno1opt mietls s2emumo;u)altnmo tydfpteaneol(0teurio iodamt  fcsat a2umu  nu0oetnmo3ild m eau o;t4artrio3totomDrlnei s)setrim ny1aptnmnviat) 2ururp;t0tpxomiciasfa2uluvont4teenioctydopt aueils)trxm(o3ny4apte ivtlt)srrmxm ;u4apx  icias s2rm( o (0arenxfcoodlmDe n i;t)srxm(m iy4lpeelnviasfsDum(ronu1texo i3iyt mDemump t)aeenmo todlm elu s;()seur(o3oydlp emnesa(f ruau  ot4altomoctysla ulumon() exrif ta1fatrlu o;s t2uoim iy4om nmfciatf Drrxrpno1opx mf3tydls emnvp () rxrmo tatopDrluesls teum(rpnu4lmeelfvsas sDrm( o;t4teto i3tldla2uanvo;t4 lenif iytfmtelnei t) rto(r oo1lp nmncias)a2umum nt4tpx mfctydfa eaumo;u) leniociy1lmD  uvi;t0teuoim iy4llenmfcsat) Dtmxmo;t4apeo f3ilsfm umnmp u0tltomf oytlmDr n o ()srtrim3no4omeelnet t)s2umxm oo4tlt  o3ild m2uan ont4tetriocto1om  livo t)t2uo(r3nydam emfeilt arurx pou0tex ii3tadla ea(vont) rxnxo3ootlpDeanvs s  exrimpiu4alen ivtl()arrmxm nt0oltnifeiasfs2ulnvs t)alxomr ia1fat  u s s0srumxr iu4omtnmiet s)arum(ront0tpt mo3ildfmDrmuvo t)alenxfciodfat lieil(0t2tr(r3iudomeemfvtasfsrtm(rooo4aexo f3ias m2rmnmpnt)arxoir3ootopDe i ilt) 2umxo iy4lmeemnvia( srrm(mp;o1oetomietyt s elnvo ()tltrxo iytla rluvs;s s2xrxr no4ll emictls) Drmuro;t4aet io3iyd s2rmu o;(4tltniocty1laD  ivs s)t2tm(opiudlmen iciat  2taxrpoo1tlto oeiydlm umn s;u)aetniocoodlm   uvi;s  rurimpno4llt lfct tfartrum no4oetoiieilt aDrmumo u0teeoif todlpDrauvsls)srumxr3ny1ol  lneiat  rrmxrp;o4oee mo3iydfs2ul(vo (0aetnmr3iodlaD li ils0tetrxm3io1amen icils s2um(mpnu4aexoioctld m2ua(vs;(0texnxr3oadlpD aivi t teurxm nydlp e nes sfsrtaum no0oexnifctatla um( p;u)tltnio to1omDe ivi s0trtrxr nu4ap   ncs s aDtrurp;u0alxnmf3tltls uanvsn(4 reoiocoadopD au s;t trtoiopiydlmtemnvi tf rta(moou1tex moetldlmDrlu sn(0trermr3io1lmtran ilt seto(o3nu4lltnmieilt)srrau p;o1opeo ietatlaDeaumon()trxnio oydfm r n i s  euoio3oo1lpen ncsat) 2taxm ot4tptnmo3iydlsDrluvpnt4trerxo3to1oa eai sl(0 etmxr oodlp nlfvtasfartaxr ;t4aetomieiydlm uauvon(0trxomr3oydop   i i t) rum(r3oo1omeemfcs tfsDrm(  ou0apto oeiytla em(mp;(4trtnifctodlate ieo;s teuoio3oy1olte ivias  rur(r nu0aeto ietadlm2el(mp;t0 rerxr3iotfa  auvi;s0 2tmxrpnudll elnetls) rrmumonu4tlt  i3iytfs2uanmpnt0texnio3tytlmDrluvsls)trxmxo3nu1omeemivsasfaDua(r oo4olt mieiysla eaump;t0tlxrxfcoytoaDe i olt s2tmxr nydomeelici (fs2rmxm oo1aeto ietytlm2raums;t0 eerxfcoa1fpDr n o;s0s2urim3iudapenlfvsat)artaxr nu4altnmicils aDuluvpn(4trtoxf iodlate i i;s trtrxr3oy1lmeelfcilt  rrau p;u1opxnmo3taslsDumnmp;t4 rxrio oytomte uei;t0 rtrim3iydamtnliesls  Durx pnt0oee ii3ilsfsDrm(vp;u4areniociadla  lu ol(0trtrxr3iu1altnmfvtls arta(rp;t4ope iiciasfs2emuvp u4tetrifciy1opt lnvi;s0seur(r3no4olt  ivsl()arta(mp;u0apenii3ils mDrmu on(0altrmf3oadoateaivo;s) 2xmxo3io1llenmnei sf Dtmxronu1oee mfeiysla ran pnt)aexnxfciy1omt luvi;s)s2trir io4lpen nesa()arumu p;t0aeeo i3iyd m2ul(mo ()arxrmr oytoaDrauvslt  euoir oy1am emnvsl(  rua(mpot4altnmfciltfa2rmnmonu)tlxrmr3ty1fa e n sls)s2xrir3no4amt lfei (fs2rr(m oo0ole  ociad sDrlnmp u0aexnmf3ta1fp e ivo;(0 rxo(o iudamen fcsls)sDrrxr ;o1altoii3ils a2ra(mpn(0 eenmfcto1opD lies;(  exrim ou4ale lnvi s)artau  nu4aetniiciatfaDeluvp (4altoir oydoaDrli o s) euo(rpiu4lm  livt ( a2rmu  no0aleomoetyt a2rluvo;(0trxomr3tydfpD auvilt  eurio3iydaltemictlt  rur(rp;t0alen f3ils mDrmn s t4alxomr3iodlate ivs t0t2to(opiu1am emfvt ( s2tmumpoo4oet mfctytfmDeau o t0 reomo3oytfm e uvolt s2trxopio1am  mfetatfsrta(ront4aeen i3ildls2ua(msnu0teenxfcoadfp rli i t)srtoxr3io4olee netlt  ruaur ;o0aeeoioctytfsDumuvpnu4trxomf oy1lat aieils)trtoimpiu1ale mfcsl()arta(r no0tetnmieiltlaDrlnmont0 rxomr3iotfpDe i s s0srxoimpnudamen feia(f 2rrxmont0optoiictytfm uanvpnt)tltnxfcoo1laDe ueols0 rxmxopoo1ap e fvia(fartm(mpnt4tet ifciysls ra(monu4altrmo iydomD ai s t s2trxrpiy1lpenlnviasfsrrr(  nt4tpx mi3ils s el(mp;(4texoxf3oatfaDr ueo s  exriopnudapenlnvi sfsDrax pnt0tetnmfetlt sDra( pnt4 renir oa1oatraiei s)teumio iy1al nmnvtl( a2taum ou0ale ifcildla2raump u0 exomrcoadfp r nesl(0t2xoxm3oy4amtelfvtlt)aDrmu  ;u1apxomi3ias a2um(vs (0areoircta1omDranvi;s) rxr(o nydlpeemfetat) 2urxmpnu0tpx ifciydfaDuauvs (4arxnmo iydfm r nvils  exmim ou4omtelicilt)arta( ono0teenioetldfm ranvp ()tlxnxoctodlmt anvilt)t2toio io4ap nlfeia() 2umum ;t1aetnioetldfmDrmump u) leomrcia1fmDe n s (0 2um(m3ou4op  mict ()artaumooo1ope mi3tat m2ranmp t)teerxocoy1oa r nesl(0t2um(r nu1lle micsltfaDtmx p;o4opt mieiatlsDrmuvon(4tlxnxr3oy1fpteaies;t)teum(m3ny4am e ncsa( s2ta(mpno1oleomi3iysla2rau s;() rxrmrcta1lm rlu i t0setoim nydol emiviatfsDrm(rpoo4olx  i3iydfs2ea(vp () etomrctotfptraieilt teurxopnydal emnei t)s2rr( p;u4tee mieiytls ul( snt0tlxnir oy1fmD anvsl(0 eto(o nu1al  lieiatf 2tm(m ou4oleoiieilslm rm( s;()trtnmr3tydfa raivs;t0 rtrimpoy4om   ivils)a2tmum ou0olxo i3iysfaDrmn p t)alxoxr oatlmDe i i (0trtmimpiu1ale lnesasfsrrmu pot0altn ociytlmDem(ms t4tltomo tytfaDe uvo s0 rtoxmpoo4altemfvi (fsrrau  oo4oeeo f3iyt s2ul( ont4texomf io1lpDelnvo t srxm(r3nodaleemivslt sDta(rpno0aetnioeils m em(vsnu4altrio3oydlmteli slt0 rtmiopny4lpenlneiasfsruaxmp;t0alxnmi3tlt m el(ms;(4teenxr oytlp ean i;t)srxoir3nudlp  mneilt srur( o;o0aeeo ieiltfa ea( p;u4texoxf3iotoptelnvo;t  eto(o oy4ome mfviasfsrumx ont1olxn ociatfs ran o;(4treoxf3iodopDeliei t teum(m3nu4lmenmivi ( sDrrump;o0apxomo3ias a rm(mont)tlxoxo todlp eli olt0setoir oo4al   fetl()a2taxmp;t1alenmociat aDel(mp t4trxrxr3ty1fmD an o;(  exoim3ny1aleelnci sf rrr( ooo4olxnmf3tytls2eauvpnu0 rxnmo oo1lptraieols)sexoio3nudom emivtatf Dua(m ou1ale mietlt m2rauvo (4 exnxf3oytfmDean ilt  exo(o3iydlm   ics ()arrau  ;u0olx  oeias m rl(vs;(4artrmfciotlm r nvs;(0teur(r oo4amte nvi ()sDtmx ont4teeo i3iadla umnvon(4teenxo totlaDean s;( s2urim ou4ll elnci s)aDrm(mp;o4tptoioeilsfmDem(mp;t4tltrxr3ootom   nesls trum(m no4oleelnet ()s2umu o;t1oetn ieils mDrm(vsn() renmf iydfmD aivi;t0srum(m3iy1openmnetls aDtrxrpnu4oexomf3iadfm ul(vs ()texomrcoa1op eauvol()s2xoxo nydlle lnetat s2ra(r nu0teeoii3tlsfsDulnmonu4 eenxo3ia1lm   uvi;(0 rxoxopio4ol  lnei () 2tmx p;t4tleo ieiadfsDrluvsn(0altoio3todlptraivils)s2xrio ou4al emietl(  rrmu pou4oexn fciaslmDraumpn(4 exoxfcta1fmtr nvo s)trumimpiydamt mfvtlsfarrmxmono1tpe mieias aDeauvsnt0teenmocoydla  anvs t0sruo(rpiy4al emfetat)s2rr(r ;t0apx iieiyd m ua(mp (4 exoif3io1opD  ivs;t0 2ur(mpno4alenmfctatf 2tru  ;t4alxoio3iyd aDelnvp;t)alxrxo todlmtr i s;s)teuo(rpnodlm  lfci ()sDtrxmont0tlx  f3ilslaDum( pn(4treoir3oy1oatr u o;s0 2urio oo4optn ies (fs2rru onu4opt  o3ilslsDumnvo ()arxrxr io1lmte i o t) 2umio3ny4al e fet t arrauront1tlxnmfciatlsDrau pnu)artnircoatlptrlu slt srxo(m oo4oltemfci t  Dumxro;u0alx if3tltfmDuanmonu4tetnio to1fpte ies t teuo(o oudlmen neilt aDtau o;t1oltnioctadfs ulu s t)alxoxf3tadfaDe u sl() 2xoim ny4ole lfcilt) 2ur(r ot0tleo o3tysfs2ul(von(4arxoxf iatoat an i;t s2xrio3iu1lpe  ictl( a2trump;t0aexo ieildfm2uanmp u0artnmf3oo1fa raieo (0 2xrim3oydam   feia(f Durumpot1tltn ietldlsDulums u4aetnxr to1oa  lies t s2uoxo3ny4lmtnlfvtas)s2tm(r ;t1tex iieiydlsDua( o u0 exrmo3iadlaDeaies t setoxmpnudomt mfctlsfs2urxmpot1tptn ieilsfm rmu o (4 lenircty1om e uvol() etrxm ou4lptnlnvils)srtrx  nu1tlt  i3iyd aDum(msn(0altnif ty1fmt  ieo ( t2xrxmpiy4al nlnvs s srtmur nt4tleomfctatls2eln sn(4tltrmf3io1lm e nvi;s0sexoxr3no4op e fcslsfarur( pnu0aleomicias aDrluvo;(4trtoxr oydomtr uvi;()truoio3nu1lmt  ncil(f 2tax pot0altnmfctatfmDelumont)aetrmo3oodfmD lnvi t0texo(opoo4optelfetls) 2ua(r nt4aptomoctadfa2ra(vpnu4tetnxo3todopteln s s  rtoim no1oltnmieil() Dururoot1aeenmociytfm rauvo;(4 etoircta1fpDelieo t t2xoxm oo4aleemivslt)sDtr( o;u0tlxn f3tyt s el(ms (4 lermociytla   u o (0setmir oudlpt  nes (fa2rr(  ;o4oex mo3ildfs eauvpn(4teenmocta1fp  au o;( s2toxr iy4lpenlicta( s2rmur nu0oexoiictydlm rmuvsn(4 ltrmfctotlmDeau s;t sruo(o3oo4aptelfvt (  Draum ;t0oleoiieild sDum(mon() exrif3to1fp eln sls) 2to(r nodlptelieilt a2ra(moou4tlxomfetys m2emnmo (4alxrmociy1lm  lu s;t) exriopoo1amenmicta(  rtrump;t4aee iieiysfmDrmnvsn()tltnir oo1oaDe ivi s0trtr(r no1ol nlfviasfs2uau poo0teeoifciysla2umnmpnu4altrxr todomt ai o;() 2uoxm3io1lme lfvi t)s2uaumpno0aeto f3tadfa2uanms;t)altrxfctotoate neols0t2uoir nu4am elfvil(f Dur(monu1opxniociltla el( p t4tlenmo3oatfpDe n o ( teur(o iu4op nlnvtltfsDtrumpnu4openmo3tas sDumnmp t0aetnir oydlptrlues;s srxr(o iydop nmnciltfsDur(r ;t4altnmieiat s2rluvs t4 ltrifcootfm eanvils) eumir oydam nlfeslt)arrmumo;u1tpx iociytla emu s t0aexomr3tadoptrln s;s0s2urim3nudap e fci s)aruaurono4tpxo feildfa2umuvo t)trenirciodlp  ai ol() 2xm(opnydopeelfeia( s2tm(m ;u4olxnmf3ildfmDeanvsnt4trtrxf3oo1fm elues s0setrimpou1amte ncilt)aDtau  no4tpeo icildfm2uln p t0 etrxf tydfmt lnvs s0seuoxopoydlptnliesa()a2ur(moou0oltomieiltlsDrmu p;()arxrio3iytop  anvsls0 rto(r ny1omen fcsltf rtrxm nt4tltn f3tatfsDem(mp;(4tltoxf3iydfmt lnvs;() 2xm(mpoy1ame  ncsl(fa2ra( oot1apx mieiadfm2ul(mon()tlerxo3ootoa r n i s0t2uo(r3oy4ale licsas)sDrmuro;o0tlxnmietaslaDuaumon(0trxrxfcoatlm r u o;( trtrxm iu1om nlieslsfaDtru pnt0oltoifcild m rluvo t0 rxoxf3totla  lieol(0setm(m ny1olt licils)a2trumpou4tpen o3ias a2uaumo;()trtoxo3tadlptelnvo ( tetmxopny1lle  nvsl( a2rrur oo0apt mietlt s2ra(ms;t4tlxnmf iodfpDrlivs;s) exo(r3nodaltelivs (  rumu p;o0oet ifciydfa2ulums u0 eenif3tydomDe nei s)srxoxr ou1lp nmnet s)arrm(rpou0olx iictasfs emuvsn(4texomo iatlpDe i ils) rumir iu4lmeelfctat)sDtmum ;o0tpt ii3iadls ranmp;(4trxoxociytlmt anei;t0t2tmir3iydolenmiciat aDua(monu0oeto o3iatfs rau s u)tleoxfciatfaD ln ols)seum(m3iudal nmncil( srrrurono4tpxo i3ils m raumonu0 reoxr3ia1lmDelnvols)srto(m3nydlm  lfet ( s2rr(ro;u0ole ifctlsfm2rlu p ()treoxo3oo1op rai i;s)trumxr3ny1ap emies (f rtmxmpot0apx  fetld s2emumo;u0artoxf ia1oaDelivo t teumio3oo4openmnetl(fsrtm( p;t4optn ociasfa2ulnms t)trxoxf totlm rln ol(0trtr(m ou4amte net ()aruru p;u0opeomfciltfsDemuvs;(4artnif3oatlaD  i s;t trxrxm iydole  fci t a2urxmono0olxnifciad s ua(vo t4texnif totlp rluvs s) exoimpou1ll nmivsls) Dtaxmpnt1tex mi3iytla rlnmo;u) etnxr tadomDeaiei;( seuoio3oo4ape lncs t) 2raxmp;u4olenmieiytlmDrmuvs;t)texoxr3tytla rau o s)s2trimpou1lmt  icsat  Dtrxmoot4oexoifeiytla2rmnvs t)texrio3todlpt lueol()s2toxo iu1ameelnct s)a2ur( pot1ape mf3tltfm2rl(mp;(4arxoifcoy1lp rluvs t seto(r3ny4ol  mfcils) 2uax ono0ole mi3iydls ea(vo u)tltrmr3iydlpD anvs;()truo(o iy4omeemnvs tfaruaurp;t0oexn ieiydfs2emuvont0 rxnxr3todoaD luvo s  eurxo3oy1lle mnci t srtr( pnt4aleomiciytlm ul( p (4arxrir ty1laDrli o ()trumxm iudoltelnvs s srta(mont1oetoiieiadlmDrm(mpnu)aexnmr3iatoa e ivo t s2xmir3oudomtn fvia(  rtm(  ou0alen ictls m2ea( p t4arxoxr3todom rlneo;s0texr(m3iu1ole mnvtl( s2ta(rpnu1optnii3iytlaDul( s;(0arerio3iodfmtrln i s0srxmxr iodlm nmfci (  Drmu p;u1aexnmiciys m2elnvs t)aexoifcto1la   n ol() 2tmxo3ny4apt lnvia() 2ta( pno0aleo i3tas m rmnvp u)alenmo iodfp eauvs;s0trto(mpiudlpenmics sfsruaumooo1tltomociytfm ran o;u)arerxr3iydfa   nvi;( texoirpiudlle mnetat srumxmpno1apeo i3iatfsDumums;()aexnmf3oo1optelieslt)trur(m3oy1al emfci () 2uaxroou0teeoifeiydlm2el( sn() rxnio oatoa r n i;()setm(o iudam nlieiat  rtau  ot1aet if3iytla emump;(4 ltoxo oy1lpte ieslt srxmiopno4optn icsas)srrmur ot1ale mfeilsls raums;u0alxrxoctydomtelivs s trtmxmpoo1llt mfeia(fa2trxmont0aptomoeiydlm2ulnmon(0 etrir ia1omteaivilt)trto(o oudlm n icta(f 2ta(mono4apt iiciltls rmums (0alermrciodfmte uvsl() exoxm3oy4am  mfvils) 2urxr ;t1tlt ifctltfs elnmsn(4aexnmrcoo1omDr i o;t)texrim3oy1omtnliesa(  2ua(  ;o1altoiieiadfs emnvsnt4 lerxo totop e ivs;(0s2xrio ou1om e ieils sDtrump;u1opeoioctys mDumu onu)alenxfcoydfmtelieilt) rxoxmpnu4ameemivt t) 2taurp;t1aex  i3ias m eauvo ()aeermr3to1lptrai o;t)texo(r iu1oltn nvs s) Durumpoo4aeto o3tldlm em(mo t4 lxrmociy1lp   n o s  2umir io4ope  nesatf rtmu p;u1alxo i3tydlm rmn pnu0 renxo3iydlmt aivs (0 rxrxm oo4op nmfctlt)s2umxr ;o4aptniieiad m eluvs t0trxrir iodop  luvsls0srxmxr3nodomeemiviasfaDrmx ooo0oexniiciytfa umu o u4aexoxo3ootlmt  uvo t)srumxr3nu1apee ies tfa2tm( ono0tlt mf3iytls ul(vo;t4trxoif3oytop  aieils)truoxo iy4ap  mivi t)a2ur(mo;o0olt mf3ias s ranms;u) renxr iadoat lu s;s  eto(m3iy4oltn nctl(fsDtmxm nu0tetoiieiydfm2elu s;t)aetrir3iadfp   u i;t)srxo(opou4olee ivt (f Dtm(rp;o0tpenmfctls a um( on(0alxoir ty1la rauvsls0s2to(opoodol  lnciat)aDtm(mp;u1opxomfciysfaDraump u)areoio3iytlp rlu s;t)t2umxm3iydome  fctlsfaDururpno0tetnmoctls sDrl(mont0 leoioctydfptrlneo;( sruo(m nu4lptemneiat) Dua(  ;t0oleomi3iydfaDea(monu4aexrxo oatlmDeanvi s)texrxopoo4ale mfvtat)srua(mp;o1opt  ieiytfs el(vo (0aleomf iydlmDrlu i ( srxoim3nudoptnmivil(fa2urxr no0oeeomf3ildfm rlumpn(4aexnxf3oatfpte ivi t) rtmxo iy4optelnesa(fs2ur(rp;o0altnmoeils aDeluvo;(0 exnmf oodoatraieo;(  2trio3oodom  mfvsltfarrax  ot4optomfciysls eln pnu4 leomf iytfate u ilt)srurir3no4al e nvt s srua(rono1aet  ieiad s ranvp (0tleoxr3oy1oaD au s (0 exr(m3iydlp emnet ()sDra(rpnu0oeenmo3tls mDeaump;(4tlxoxo3iytfpDr i o;s)t2xmim3nu4aptelncils) Dum(  no0tlxn ieiyd mDemums u4 reoxf iodfptrau o;s  rtoirpio4ol e ivta(  Drmuront1ole  fctls m em(vsnu)texnxfcia1lmDr ivs (  2urxr oy1al n ivt ( sDum(moot0apeomi3iadfaDrmn o;(0 reoioctatfm  auvil(0srxr(rpoo1olenmncsa(fs2tmxmonu1oexnmo3iyd m ua(vont) leomociadlpt  ivo s)seumimpou1lm  micils a2taum oo1tlx mfciys aDelnvp;t4 rxomrciadlat aivi;t0trtoimpoy4llt mfct ( artm( pou0teeomoeildlaDemn p;t4treomo3ia1fa rln o;s)s2urxm3nu1ome mieiat aDuax  ;t1tex ii3tytfa uluvo (4tleomrcoo1lmDean o ( trtrxm io4ap nlnei s) rrr(r nt1apxn feiyslsDumn snt0teenir3ootla e neols0seum(m3iydamt  net s)arrruronu0opeomfcildfs2rmnvs u4alerio3tadlaDrlnei s)t2xrimpnudopeelfviat)srrmu  ;o4opxo f3iatlaDum(mp;() lerir oy1fp r u o s)sexoxrpou1olt  fesl( sruru ont1alenmieiytfmDul(vpnt4texrxf3oy1omD lnvi;t0setr(m iu4ap nlncils)s2rr( p;o4alen octlt aDeau onu) etrif3oydoaDelues;t t2umxo nydllenlicsl()s2rr(rpno0ape  f3tltfs2ul( s;u)tetoxr iytfmtr uvi t)t2tr(r3no1lle lnvil( srua(rpnu1oeeniociadfm em( pnt0 rtrircoa1la e u olt)s2xm(rpiu1ap nmieiasfa2uax pnt4tleomieiasls ra(ms;(4teenmo3oa1lm rauvs;s t2trim3oydlpe  fvs sfs2rru pno4opeoifciat sDel(vo t0alerxr iytomDelivols)s2uoxr3nydop  mfcilsf Dtr( p;o4tptnio3tatls2ranmpn(4 rtrxo3tytlpDr n o;()srxm(opiy1ame mnei ( a2rrxmo;u0tptn oeiydlsDrl( s ()treoirciadlmteln s ( s2trir3no1am   nci s) Duaxm no4tetomociad m2elnmp u0arxrxociydfmtelnvi s0t2xo(r no4lle lfvil(  2rr(rp;o1open i3iat aDemnmp;u) lxniociatlm rlivo;( seuo(o iy4apte neta() Durxr oo0aptoif3ils sDuln s;t0 rtnxf oadoaDeluvs ( trxo(m iu1llen nvi ()arurum oo0tlx ioctls a2rmumsnu4arerirciy1oat  i sls sexrxo oy4olt mfctl( aDrm(r no1tetniiciydfs ranmpnu4artoxo3ty1lp rli sls0 rurxm3no1lptnmfvta(fa2raumont0oet iicias mDrm(mo;u4teerxf3oy1lmDr uvslt0s2tm(rpiu1om nmnei sf 2rax p;u4aptomoetytls2ran onu4 leoxocoy1lp  ai s s)trtoiopoydoptn ieiat srta(rp;t1tlx moetldlmDrm(vp t)arerxf3oytlmDr nvs;(0 rur(o iudll n ivils)a2umur ou0aex  ieiasls2emnmp;(4 lxomr iodoaDrln o (0teuo(m3iu1alen ivslsfaDuaum ;o1tlt ioeilt s rlumo u) rxomocto1opDe ueo t srxrim3ou1al n nvsltf 2tmx  ou1alxnmfciad s rauvont4trerifcto1lmt lnvils)s2urxo3iy1amte fci s  2uaur nu4apx mf3iatla uanmo;t0 eenir ty1fm  ln i t0s2to(opoo4lmt  iesat aruru pot1tle  f3iatla2ra( snt) rtnmfciydfpD  u s ( s2tr(rpiy4olenmfct tfa2tmx  ;u0tlx  f3iytfsDumu p t4 exomrctadlmte ivsls0t2urxr3oydlmte icslt) rurum ;u4oet  o3iatlsDrauvp;u4 eenmr ta1opDr uvi s s2uoio nudamtnlneiat) Duaur oo0opto feiydlsDrl(vo ()tlermf3oy1fmDrau o;t) 2xrxr io1amenlnct s) 2rmuront0tle  ieiytfs2ea( p;()tlxnifcoatfmtelnvi s0s2xmxo3oy1lm emietat) 2taxr oo1ape if3iaslmDra(monu)aleniocio1laDe uvils0 2ur(mpoudomtelfvil()arraumooo1oetnioetytlm rmu snu0tltomf3ta1fa eanvi;t  2xoim3iy1ap nmfctl(f Drrxr no1opeomo3iasfa2rlu s u)alxrio3iytlp   neilt) 2urxr nudam  lies () 2raxronu0oeeo o3tas sDum(vp;t0aeeomfciadop elies;s) eumxopoy4lmtn nctlt) Duau poo0apx  ictys m2ea( pnt4 lxrmrcto1fm rai o;()trtmio3oodomt miesasfsrtmx o;u4teeoiiciyt m uanmsnu0 rtoir iatlaD aivolt0t2uo(r3nu4lpenmivi t srumxmpot0opx ioeiltfmDum(vs;t4 exnmo oadomtrai s s)srtmiopiodomee fetasfaDtmuro;u4ale mfctyd mDrl( sn()arxrio3iodlpteluvslt0srto(m3oy4ll nlnci tfsDta( pnu0apt mfeiydfaDelnmp () eermf oy1omDr nei;t0s2xoxo3iy4lp   fcsa(fs2ra(  ;t4open fciadfa2umn s;u4 ltnif3iytlp  lu o s) etoxm3ny1am emfctlt  rtaxmo;t1ope mfeias mDelump;t4 rxomfciydlatr nvslt)truoir3ou1omt lictas  2raum ;o1ope io3iytlm2ra( s t)tlenir totlp e ues s) 2xm(o nu1alee fct () rtru  ou0tee  ietltlaDulnvp u4tlxomf3iytlp  lu o (0tetoir3nu4ale mfci s srta(  no1apt  ictysfa umums;u4trxnmocoytoptr u s (0texoxmpoo1ol nlfvilt) 2rmu p;u4oetn fciys aDranms;u) lxrioctotom e uvolt0 etrio io4oleemiesat arraumpnt0altomi3iadfa2um( onu) exoir oy1oa eanei;s  eurimpnudapeelivta()a2ta(mo;t4apxnmi3ilt a ea(mp;t)artnircta1fat aivo;()seuoxr oo4aptnmfcslsfaDta(m ot0tleo o3ilslm2rmuvs;t) etnxo iy1omtr uvolt0truoir3oy4lmt mfvtas)sDumumoou4olxnifetytfsDulnvpnu0tetnxf oy1lp  luei;s)trurxm oodamt  fct s a2rmu o;u0tpenmi3iyt aDuluvont) rtnmfcoadoateanvols  ruoxr oodapeemnct () rtruront0opeoifetyd a2ranmpnt4arerxr totfaD an i;( sexrimpoo1altn ieias srra(rpot1open fcild sDrmu pnu4trerif oytlmD lneilt0truoxm3iy1lp  livias)sDrr(r ;u1tptoiociyd m ua( s t4altoio3iy1oa r nes;(0teum(opny1alen fei ()srtmx o;t0opx mi3ildlm em( o;()teenxr3iydlm eauvol() exmim iy4amee ivils  Dtmumont1tpx  f3iytfmDum(vo t4 rxoxocoadlptraues s  rxm(m3oo1alen fvtas  rtr( pou0tetomoeils m emu o u0trxrir3ootlate uvi t0seurim3ny4oleelietl()srrm(rpoo0optn iciydfm rln s t0aeerxr tydfpDe n o ()texoxm iy4lp  mici s sDrrum ou1tpxnmi3iydfaDuaums;()alxomf oadlptr nes t) eurio3iu4aptn fes sfsDrm(  nt1alx miciltlsDem(mont)trenmfcty1lm  livol( sexrxrpno4lle  fvslt  rta(rpou1apen ictldlm2rauvp;(4aleoxo iadlmtelues;s) exmxm oy1amt lfetlt)arta(mp;t4olxomf3iatfm2umn s;u4 rtrirciodfmDeaieslt)t2xmirpiydlmtnmnei (  ruaum no1tlenmo3iltfm2rm(vonu) rxrirciadla e ivsl( s2ur(r ou1om   net t)sDra(mo;o4ope  fciytla2ulnvon(4 rxnmo oy1fm raues s) 2xoim3no4lmtnlnvils) Drax o;u4oetomo3tydls2emn p;t)arxoio3oa1lmDeln s (  2trim3oy4om n fetl()sDtaxmp;u1opeo oetat mDeluvp;()tetomo iodlpteli s;()setoim nudale mfvtas)arur( ooo1alt mf3ias aDeanvo;t4 ltnif to1op e ivi;t texrim3nodlmeemnes t aDtm(mpou0apxoioetatfa elnmo u0teeoiocio1omt  uvs;t) 2tmxo3nu4amt liciasfs2uaxm ;o1oexo o3ias aDelnmp u0tetrir ootoa  au s () etoim3iudlp e fci (fs2tr( ooo4tlen o3iytfaDel(msnt)aeerxr oy1laDrlnvs t0t2xrir3iydolte nvi sfs2ua( oou4aptn octytfs2em(vo;t4trenxf tytlp rauvolt)texmio oo4ame lfvsa()srurxrooo0texomociatfmDelumont0 eerio iotlmtrli ilt sruo(mpiydap n fvia( a2tmxront0alx ifctad aDel(mp;() leoxf3iydoa rlnvi t)srumimpiy4lm   nvs s sDua(moou0tlxnii3iasfa ea(msn()aeerxf3oa1opt auvs;s tetmxm iudlp e nesasfaDumur nu4opxoioeiadfa ulnms;(0tleoxr3iytlm rai i s) 2urxm oy1lleelnesat) 2urum nt0aetomi3iytfs2ea(mpnu)aeermf to1oate ivslt  rxmxrpoydaptn icsat)sDumu  no1aeto o3tatfa2ulump;t)teerio ia1faD lieil(0 rur(opoodolt  nciatf Drru poo1apenmo3tyd m2ra(mpn(4 lxoifcoadlat anvolt trtmio ny1lpte ict ( a2trx pot4tetoifciat sDuln s t) lxniociydlmD ln s;(  2xmim3oodamt  fvi (  rrr(rpnt1oetoio3iytfm eln s;u0 rtoircootlmD an i;( texm(rpoo1al  livtls)sDrrx o;t4alt moeilsfsDuanvonu0 lxnif iydomDelieo;t  2xrxm3iu4opeelfvias  Duaxroou0oeeoiiciltlsDranmp;u0tlxrmf ty1faDe ies (0trurir3iydlmenmnvta()aDtrx  oo1optn fciasla2rl(mp u0texrir3oo1fateauvo s s2umirpnudll  lnei t) 2rrx  no0olx mf3iatfm rm(mp (0 leoir3tadlmD lueo;()trtmim nodlp emfeilsfa2tm(m ou1olenmieiyd a umump (0altriocoydfaDr nes;s  etmio iy4opte nvs s srrm( ont0apxo oeildlmDranvp (0 eerircoo1oat au o t)teto(m iu1amt mnci tf rtr(ro;t0alt  o3iydfs rauvo u4trtnmrctadopDelnvilt) ruo(r nu4ap nlfesa() rur( o;u1olt ii3ild a rl(mp;t0altrxo ta1lm rlu s;t0 rurxm3iy4om n nei t  2uaur oo0tlto f3tltls eanvs;t0altnxrciodlp eaivol(0srtmim iy1omen nvt s arraxmp;u4teto f3ils s2ul(vo;(4 rtrircootoat anei s srumim3iu1apeelncsls)s2raxrp;u1oexn icilsfs2ranvonu)tleoif3iodlatraivs s  eur(m3io4lpenmici (fa2uru  ou0apxomoeiysfa2elnmpn()arxnxf3tytopD li ol(0trtoim oodop emivtl(fs2um( o;t0tpen octldfa2emn s;u4tltrxf iydfa  lneo;t0srxrxm3no1al  mfei s s2rax pou1tpe  o3ils a2uauvp;u0 eerxo io1fp eaues t0texmxr3iydlm nlfet s)sDtmumooo4tpt mfciysls uln snu0alenirciytlat  i ilt)t2umxmpnu4ll n ics () 2ua( o;o0ope  o3tat a2em( snt4 etnir3ootlp eau i;s srtm(r3no4ale  icsl(f rra( pnu4tlto ietadlaDumu o;t) ltnxrctytlateai s;s0t2xmim3nodolee ivi ( sDtrumpoo0ale  octyt s2rln s;()arxnmfcta1op r uvs t)srumio3nydale  ivtat aDtau  no0ale mo3iyt a2um(msnt4 rxoifciytla  lu o;(  euoimpio1alee fcs s) 2rmxront4tpeo feiyd m2rau o;u4trtrmf3oadom e uei t  rtrim oo1olenlncia()artr(ronu4ope ifctltla2ulnmo;u0arxoif ia1optr u s (  rto(r oodoptnmfcsat srraxm nt1aet  o3tys m2eanvs;t0trxomocta1oatrluvolt trtr(m3nu4apeeliesas a2taum ;u4opx ioeiydfa emuvonu0aetomf iy1fa eai s t0 rxr(r oy4am e fctl( s2urxroot4openmf3ias m2rl( onu4tetrxo3iodfm elivi;t t2tmxmpnudll  mncs tfaDuaxr ;u0apenio3tasfa2emumpnu4tlxrif iatom r ues;s)trxmxr3iy1om   ncil(  Drr(rp;u0apeomfcildlmDrluvo;t0aexriociatfatr n s s srxmxrpnu1lpt lfei t)s2tmx  ;u1tee  ictlt m2umuvs () rxoxrcio1fmDr i il()srumxr oy4ol  lfviasfsruru pno1tetnii3iytlm2ea(mo (4trxrir to1lptrlu s (0teur(rpno1optelnvilt)aDrm(  ;u0oltn fciydlm ulnmsn(0tltnxo oy1fpD aivilt0 rtoim nudam n ivil( arumurooo1oet mi3iydfs rlnmo t)tlxomoctotomt au i s0setoxm3ou4al   neil(  rraurooo4apt io3tatla2ulu o;(4 etnir3oydfatran o;s srtr(o nydal emneslsfs2umx  ou1ole io3ilsls em(vsnu)texrmr iadoateau ols0 2xr(r3iu1lpenlnvtlsfartr(mono4apx ifciydlaDrlnvp;(0trxoxf3oytoptr n s;s)texmxrpoo1ll e ncsas s2tmu o;o0olenmoeilsfmDraums t)arxoxo totlm   u i ()trtrxrpoo4am   ictlt) rrauront1opxnmoeias s umnmp u)tltnmf iotoaDelneo;s0 exrxo3iydaleelfci t sDrmu  oo1teto ietytlaDumnvpnu4tlxrmr oodomD anes (0t2xmir nu1lme  ivi sfsDrmx pot1apx  f3iytfa2ua(vpn(0trtoio iadlatean o;(0s2triopoodop elfet s) Dtrur ot1oet mfcilt m ea(vsnu0tltnmfcoa1lpDelu i;t srur(m3oy1ameelnct tf rurx  ;t0olx  o3iadfs eanmsnt4arenmo ta1lp eanes;t0srtm(o3iy4lp  mnvsat)s2tr( pnt4oet moctyd m em(vsnu)texrmrcty1fmtran slt  2trxm3nu1op  livi sfsDta( onu4opeomocias m emu p u0 ltoxr3tytoat ln i;t0t2xoio3ou4ale lnetas) Dtmx pot1tlt mociat a2eluvo u) rxrio oadlp rauvi;()texrxrpnodomenlfviasfsDururpnt0tpe mfeildfm2rauvp;(4aetrir oatfatelieilt s2xr(m3nydlpt lnetat sDrru o;t4oex mfciasfaDuaumsnt4aexoxfciatoptrau ils0 rxoim3oo4ale lncs s aDrau o;u0aet ifctadfaDeanmp t0aetnmf todlpDraivs s t2xmxr3ny1al   ics t) Drmum oo0tleoifciadfsDean p () eenmo tytla eai il()truoxmpio1lpeelict (f rrax o;u0apxnmfeiltfs2eaumpn()aexrxo tadopD aivo;s)teurxm ny4lme  nvilt)a2uru onu0tpe  i3iytfaDrl( p u) lxrxr3oa1lpD  uvo s)srxoxo no4olenmfcias)artrumpnu0apxnifciadla2rauvo;()artoir io1lmD li o;t)texmxm3nu4lptelnct ( sDraum ;t4apen o3tydls umnvs;t0altoiocia1lateauvi;s0teur(mpoy4lptemfei sf rrm(mooo0tpenmictysfa2eaump u0arerirctadlmD li olt s2xrirpiodoleelnvta( s2tm( o;t4oex  i3iydfa rmumo;u0 eermo3oadfm raivo s  rurimpiu4amenmfvt t  Drrurpou1oexomi3iltlmDul(msn(4 leoxociodopDeau sl()s2uoirpnudlm  mivtls artaxrpnu1tex mf3iadls eluvo;t) etomf3ty1lp  ai s;( t2uo(mpio4lltnmies s)a2tmx  ot4oeenmf3tlsls2rm(ms u)tlxrif todfaDrai i;(0t2um(m3iu4lmtnlfcia(fsDuaxmo;t0tee mo3tltfmDem( p u) rtomr3oo1lmD lnvslt)t2um(rpio4lmen iciatf Draur ou0tle iiciysfm2rl(vsnu4trerif iadlaDrluvol( trurxmpoodope mnct s arumxr ;o0texnmfeiad a2rm(msnt4aetrir iadlptrln o;s s2umim oo1altemivs ( aDta(roou0oet if3tadlm umuvon(0aexnifcootfp e i o;t) ruoim3ny4ap  lfctatf 2ta(ro;o4oex iieildlsDum(mp;t0tetrmf3oadoa  anvslt)t2xmir iudope lnvslsfs2tmurp;t1tlxnmo3iysfsDra(vo u)aeeoxrciytfa elivi t0trurxo3iy4lpeemivt s) rumxrpot4oltn ietys s emn s u0trerio iy1fpDelu s (0 eumxmpiy4omtn nvtlt a2uaumpou0tlt ii3tasfm umnmon(4 ltomf3iy1oaD aues;t) 2xmxm3nodll nmfci sfsDrax poo0tltnio3iysfm ra( s t0trxoxrciytlp elnes t)t2uo(m iu1lp  mfvilt s2urxmoou1ape mfetadls2rau snu4arxnifciy1lptraneo s0s2xmiopou1al nmieils) 2uau ooo0ape mi3iad s rm(mo u)aexomo oytlat  ivi () rumxopoy1apeemfvilt) 2umumo;o0opx mf3ild aDemuvon(0tltomfcoodlaD ai olt0 exrxopoodomtelfvi t srtau p;o1tptomi3tld a2eln s u0aexnxf3oadoat an o s truoxm io4ll nmfvsat)artm(r ot4altnif3ild a2rmnms;u0tlxnmfciatlatr n i;( t2xoir3io4omtnlnvs (f rtrurp;o0aex mfetyd s2ranvp ()texomr oy1fa  li ilt s2urxm3no4al  mfcsl()artruro;t4teen icilt m2um(ms;u4altnxr3iydla eauvs;t0 euo(o iy1lltn fvsa() Drmxr ;o1aexnmietltlaDemnms t4trtnmo oytomDraneolt0 2xo(mpoy4aptnmnci (faDumxro;o4tpto i3ilt sDelu p () lerxfciotlptelu o;()seum(m oy1lpenlfcia(f rrrxm oo4tlxnmf3iydla2rl(vpnt) etoif tydfp  li s;()t2xrxopoydlleemiciat) rtmx  ot0tetnmi3ildlaDua(vo u)tetoir3iadlaDrlieo ( srtmir oydole  fcta(fsruax  nu4tex iiciltlm2ua(ms;()tlenmf tydlat au i t0srtoim iu4ap e nvsat) Dtaxmonu0opxoifetldfaDeln p;t0trerxo3iotfptraneolt0t2uoirpno1ll n fviasfsrtaxm nu4oeenmoetlt mDrlnms;u0 etnir3iytfpDelueslt) ruoio3nydomee fvs ()srtrurpnu0oltnmi3iadla2rlumo;t4 exrmf iytlatr neilt srxm(rpio4altnlictl( s2tmuront0tpe ioeiadlsDrlnvo (4texrmo oo1omDeanvi;s0texm(r nodamt  nvslsfaDrm(rpot4alxoiiciatlmDulnms t4 exomrcia1lp   n ol() rur(r ou4llenmnvias) Drm(rooo1opeo f3iydlm emnvp;t)alenmf3iodlm e ues;() etrxo3oo4altemietasfsrrmxmp;u4oexnioetys sDrlnmp;u) lerxr3tytomDr u s;t0texoxmpiy1ome lfesl( a2rr( oou0opxoioeiys s emums;u0aeeriociodoaDr ues;s  rxriopiy4lmenlicias)s2uaxr nu1aex miciyt a rm(mo u) eermr3to1omDelnei s)t2xrim no1omt lnci s sDururo;t0tetomfcils mDrauvonu)aetnxrcoo1lmteanvsls) exmio nodlltnmfvsl()s2tr(ronu4oeenio3iad sDea( s;t0 rermociodoate uvolt trtrxr3ou4ap emicsas)artmxmoot0openiiciys mDuln s;t4 exnio3tytlmte i o;t  exrxo ou4lp  lnvsltfsruaumpno4olx  octas sDua(ms;u0aeeoxf3oatlm   ieil( s2uo(rpnydomeelneslt) Durumpoo0tpxnmi3iys s rl( onu)trxoxo oa1lmt aneo ()t2urim3iy1lpenmicsls)aDumu p;o4aexo feiytlm rmu snu4aetoxf to1opD luei;t trurxm3ny1lm n ies t)artm(m ;t0altnmoctlsls2rl( p u4 rtoir oy1fa   ieils0trum(o3ny1ome mivslt) rrrxro;o4aeeo feiydlsDuluvsnu)tetnxrcoodlp e u o;( srur(o3iodamenmnesa(  rtrx p;o1olen o3ias mDua( s (0tetrxr3tatlmD livsls0 etmxopio1amt lfesls  Drr( ooo4opt mi3tysfaDrmuvon()aetomr iydfate ues;() exoxopoodalt lnci s  2umur ot4opx miciys m2em(vo u) ltnxf oatom ean i ()srtoxm iy4oleelnvt sfsDrrurooo4aeen oeiadfa ean o;u4teermoctatlpDr uvs ()sexmxo oudom nlnet sfa2urxr oo0optoiociydfmDemuvp u0 rtnmr iydoa  lu sls0sexoxo3oo4lmenmnvi ()aDumxr ou4apeo iciltfa ranvon(4tltrifcta1lp  luvolt  2to(r iu1al  mnesat sDrr( pot0ape if3tatla umuvo (0 rtomf ta1op elnvolt  exmxopnu1lleemfet (fsrumump;u1teeoioeiysls2um(mo t4artomo oodopDeluei;s  2tr(o3iodlme mietls  2ra(  ot1oexoioeiyt a2eau s;(4 leomfciy1lptrai i s t2umxm oy4apen nvi (fsDuau ooo1apx iietas s rmuvp;u4 reomocta1la raivols  etoir3iudomtelnvs t)artm(m oo4opx mieils aDem( o ()aleoxocio1oaDr nvo;t srtmxo3iudamte ici t) 2ua(mont4alto fetyslmDrl( sn(4 eerio3iytomtr u ilt texm(o oo1omee iciatfa2trx  oo4aexnifctatla rm(vs u) rtnif iotlptranvilt t2urir io4ale mivilsfartm( pot0tex  fcilsfm2rm(mo;()aetrxr3iodomDelnvo;(0sruoim no1al nmneslt)s2trxm oo4ole iietytfs2um(mpn()areoxf iatlmt anes () rxrirpoy4oltnmfes ( sDua(mpnu1alx mfeiydfa2eau p;u0 etoxo iatlaDr ivil(  exriopiu4omenlieias a2ra(m ;o0opt  feiytls ul(von() eenir io1op ran ils)srxm(rpnu4omeelfviat aDur( oou0oltn i3iyd mDrmnmsnu0tltoircio1fa   u sl(  euoio3ny4ale mnetl() rum(mp;t4olx iieiat m2ulumo;t) rtnir ootomD  nei;s teumxr iudopt livs () 2tm(rooo1oexo ictadlsDulumont4trtnmrciatlmtr iei;s)texmxm3oy1op  lfcsls  rumx ono4tetn ietyt aDea(vsn()tetnio tytomDeaieo (  etr(m3oodlmen neilsfs2rrxm nt1olxnmo3ilsls elnvo (0areoxf ootoatranvs s)s2xoxr3iodlmen nesat s2umumo;o4tpxoifciltfmDum(vs;(0tetoiocoa1lpDr uvil() 2ur(rpoo1alen nci ()arra(m nu1optomoetlslm raums;u4aetoifciadla   ieo;(0seurir3oydoleemnvtasfsrtr(m ;u4ole iociytls2umumo u)alxnxo tytoaD lnvo (0t2tr(o3iydlpeelneil() 2umx  no1tltomfeiys aDuln s;(4texoio iotfaDr i o s)t2umim3ny1ll n fcilt)a2uau  ou0aet if3ilslmDulnvp t0tetnircoodfpDrauvs t)texmxm iudol   feil( aDtax pno0aleoioeiadlsDumums;() lxoif iatfpD  ivi ()tetmxmpoudam  lncsas)srraurpot1aeenmociasla2emumo (4tlerircoy1fmD lu i ()texoio io1opeelncilt arrm( onu4tleo f3tyd s2rm(vp t4 ltomrciadomD auvo;s)t2uoio3oo1lmt miei s aDuau  no0altn o3tldls umnvs (4 leomo3oadlp  ai s s)tetriopoodap elivtas)srtm( pno1opt mf3tysfs2ranms (4aeenmf3oy1optraieol(0srxoimpoo4apt micsatfsDta(  nu1optnmfetltlaDeanvp t0tltrmocto1lp e nei;s0texr(mpio1llt mfcslt  Duax ono4ope iociasls2eanmo t0 lermr3tytlmD  ivo;t0t2toim no4ape livilsf 2raxmpnu0oexnmicild a umumo;()alxrxo oo1faD lnvo (0 2um(m nodamt mictl( s2uaxr ;o1apxnioctasfsDranms;t) eeoxf iydlmtraueilt) rur(r3iydlm n ivsa(f rtru  ;t1tex  fetydfs ean o;(0teermrctytlpt li i t)sexo(o iu1optemfvs t s2ur(r oo4tltomiciysfm2rmnms;() rxrifctadfmtrau slt teuo(mpny1ole lici t  2uauronu1teeo ictaslsDumu p (4alerifcoodop e ieo t) etrxmpoudlleemfct t) Dra( ooo4tlxnii3iytfm2ran p ()aexoif ty1oatelnvo;t  rtmxmpio1al elfctlsfartmu ont1oexoifctatfsDumn p;t4tltnmf3tytfateaieslt) eto(rpnydopt liesls)sDraum nt0tetoifeilslaDelump;u0 leoxo iatlm raivols0srtrim3nu4apeelfcil(  2urx oou1tpxnmfeiytlm um(vo t4tlenxf3iydopDrauvs;s  eumxmpiydlleelieils)artrur ;o0apen i3iltfmDemump (4texomf iydla   ivolt0setr(mpnodlpeemncias  2tm(moot4tpeoioeiytla eln pnt4areriocootlmDran ils0 etm(m iu4om n fvilsfsrurxro;o1oeen o3taslm2ranvs t)alerxr to1lmD liei;s)trtoir iudope mfcslsf Duaurpot1oeenioeiadls2rauvp (0 exnmr3iy1lmtrln o;s setoxrpny1omenmfvi t) Dra(rp;o1tpeomo3iyt m rlumo (0 exomo3ia1omDe uvilt)t2umxm3oudlm n iesa()a2tmxmo;o0aleniietatla ranvont)teeoio3oy1lmt lu sls)trtm(rpoydam  lict sfs2trxroot1opx  ietltfaDemumo t0 renxfcta1lmt aies;(  eumio3nu1optemicsat sDrau  ;u1apeomociydfa2ea(vs;(0 etnmocto1faDelu s;s0trtrim3oo1amt lfei tf rurx pou4oeto fctyt a2elu o;t)treoxr ty1fpDrlnvi t0setriopny1openmivi s s2rm(moot0oex  ictyslm elnvpn(0tlxrio3oadfpD lneils s2urxr3oy4opt lnesat) 2rmxro;t0opeomo3ils a umump;u0trtnmr3oa1opt  ivo s0t2xoiopoydamen fct ()srra(r oo0aeto fetadfa em(monu0artnio ty1lpt ln ilt0t2trim3oo1lmte icsatfsrtru  ou4optnifctys m2uln sn(4tetoxrctydomt auei;s s2xoim3ny1lp nmfvsl(f rumumpot0altn o3iat a rmu p (0artnio3oodfmte u o t teuoir3oodalen fcil() rta(rpot4oeeoiieiatfmDean snu0 rxoxo oydfateai i s)seumxr3oo4amenmfetlt s2uaump;o4alxnmieilsfaDumuvp t0 renif3ia1lat ai i t) 2xmio ou4lle  fes s sDur(ronu4oleo oetys mDuluvs (0 renmo3ta1om   ivs ()t2uo(m ou4ol nmnesl()s2rauronu0oltn f3tld aDem(mo;()tlxrxf to1fmtrlnes t)trtrir3nydomenlnvslt  Dtmuront4apt ifciysfmDrlu onu0aeermr3tydlptranes s  2xo(m3oudlmee fvtas aDur(  nt4tle  oeiytlmDumn o;u0 renxr3iodfp  lneilt)s2xmxm3oodop   fcs (fs2uru pnu1ale if3iydlsDum( p;t4tltrif io1lm   u ol(0t2xrxrpno4am nlfct s)sDumumono0ape iiciatlm rlnms;(0alenxo3oodfa rlu o;s0setr(o no4ope lfvils s2umumont4oeenif3iyslm2eln ont4treomfctadom  an o;t0trxoim nydlpe  ncs sfsDurxrpno4tpto iciatla2rl(vont4 rxoxfciotfat lnvo;( teuoio oy1lpe lnvi ()srumxrpnu4aetn ictldfsDeanvsnt0 etnxo3iadlaDrliei;() etrirpiu1ap e neiat)sDrax p;t1tpe miciatlm2emuvo;u4tetoif3iy1lm eln i;s)t2tm(mpoo1ll e feslt) rtm( o;u0tlxomo3iatfm rmnvs u4tetrmfcta1fptr uvs;s0t2uoiopiu4omenmieiatfsrtrxmpoo4opxoif3iytfs2rl(mpnt4altnxf3io1laDr n i;s) rxriopoodllt licilt)aDra(mp;t1oeeoif3tytlm el(vp t)alenir ta1lm rauesls) 2xr(mpio1lme lnvsl( a2umx p;o1aetnioetytlm uanvo t0tltrif3tatlm elivil( t2xr(mpno4lp nlivsa(fa2um( onu0oexo o3iyt a2eau snu0arxrxf oodfpD anvo;s) 2xr(o nu1optnmnei (f rtax  ou0alx mi3tysls2rm(mont4 etoxr3todlm   ueo;t  eto(rpiydale lieta( arra(rpno1aeeoiicildfm uanvo u4texnxr3ia1fmt lnvslt0 rum(r3iy4al  lnetlt arrmx ont0texomf3tlslmDemnms u0arenir oy1faDrlieils0sexmxm3iu4ol e nvils  rtmx pou4olt  feiat a rl(mo;u0trtrxf tatomtraivi (0seur(opiu1opee fctls) Dtr(  nt0ale mfeiys m2uan pn()tlxoxo3ta1omtrlivols setmxopiu1al emnviasfartm(mp;t1olxn fctyslm elu p;t)alenir3io1opt luvs;s0 2tmxr nydop n iei ()srua(ronu0apxoio3iytlsDrau o (4 renio3ta1op elues (0teur(m3nu4lmtn feiat) 2umumooo1aexo fetyslaDrlnvonu4trerxf3oo1laDeaivo;s)s2uo(r oy1ope mneias)sDtrum nt1ale if3iad s2emn p;()tlxnmf3iadfp raieo;(0 rxoxm iu1ale  fvilt)artmx ont4texnmf3tysfmDum(ms u4 leoxoctatlpte uvi t) rxoxo nydlmt  iciasfaDuaxro;u1aetnmf3iad sDuan on(4 etoxr3io1opDraueil( srxo(mpny4ame mnei tfsDrr(monu4teenmfciatfmDum(von() lxoif3iy1fmtr uvs s0trtoir3nudomtelnes ( artr(r ou4tpt moeilslmDumuvon(0 renxo3oa1fa raieo;(0s2ur(m3iu4aptnlfvt s aDtmxm ou0oeen fcildla rmuvsnt)trtnif3oydom e uvi;()seurxopio1om   ietasfs2taxmp;t4tlxnii3tytfm rlnvp;()trxnmrciotfat aneil(0srxrio3nu4ame mies s) rraum ou1opxomieiysfaDuan p t0 rermf3iydlpte nvi;( s2tmxmpiu1optn ivs (fs2tm(rpoo0texnifciydls ulumo;() etrif3oy1fp e ueilt0 2trio ny4lp  micias s2ra(r nu0tex mociat m2emnmo;t4aeenio tatop ean il( s2xmxm3io4apee nesltfsrurur oo4tpxnmfciyslm rlnmo;(0aetnirciotoa  ln o;(0 2tr(opiy1lpen feil()srraumont0apxnifeildlm uluvsnu) rxrifctytopDe n o (  exmxr3oy1lleelfctls a2trxm nt4aeenifeiytls2uanmp;u0 eeoir3ta1faD luvs;s)srxo(o3iy4lmenlfeslt) rumxronu1aet ifeildlsDraump;t)trerxo3oo1lp r neo (0sexmxrpiodamee nvslt arua(rp;u0tltnifeiltfsDeanvs t4texnifctodopD luvi (0 exm(o iydaptnmfcslsfartrxmonu0opxn i3tydfa rlump;u4tlenmocto1oa  ai o;t)teuoio3oydlm nlietas)a2rrx  no1tlt ii3ilt s2rl( sn(0trtnxf3oa1oa   ueol()s2uo(mpiodlptnlnct t)s2uauront0oexnmfciat mDrlu o u0aeerxo3iy1om e nes ( t2xmxr io4am   ici (fsDrrxmpno1opt  f3tytfm uan o t)tetrxoctydomteaivs (0s2triopny4lpeemietas) 2raurpoo4ape mf3iytlaDrl( o;u4 rtomr3totomteaiei t s2tr(r3iudaltnlivs s  Dumu onu0oexn ictaslm2ran p;(4trxoxrctydfp   nvi;()tetrxmpnu1altemnesl()s2tax  oo1tpeoif3ilsla rmnvo (4teeoxr iotlp ranes;()s2umiopny1ap elfvt ()srur(m ;o0tltnmfcias m2ran p t)aeermf oatlpDrauvs s0teuoiopnydlm nlivtas)a2ta(r nu4aeeo iciytlm umumsnt4trenxo iotfmtran s s0t2tmxm3iu4lm emfvslsf Dua(rpno1oleo i3iat aDum( o;(4altrxfciydlpD lueils) rxrio oy4ol nmfctl(  2uaumpnu0teto feiydls rmumo;u4 rtrir iotfaDrlu s;t0 2xoio oo4ol nlivsat  2urx p;u0aeto i3tat s uanmon(4texnxf3iydopt lneo (0trtmxo3oo1amt  fvt ( sDtrxm nu1olenmoctldfa2el( pnt0 rtrmf3oydfpt anvols0setoiopno4olee iesatfsDtrxmp;u4tpxnif3ils a em(vo t0 eenio3ia1oa eaueo (0 rumiopiy1apeelfcs t sDrmxr ;u1aeeo fcilsfmDemnvs t)altnir iotfm   iei t0s2xoir ou1ol n nvi s srtaurooo1oeeniictltlsDrmums;(0arenxr3iytoateau olt setm(opio1omtnlnvia(f 2rrx pnt0alenmoetyd s2rm(vs u4tleoif oa1fm ranvilt sexoio3iydlp   nctlt)aDuru ono0optomociaslmDra( snu4artrif3todlm  lu i s setrir ny4apt micias  2rmxm nu1tetn i3ilsls uauvon()teerio3todla rlu ol(  2tm(r nu1op   ncsl(  Dtr(m ;u4tet  o3tytlm ran s (4arxniociadlaD  u o;t t2ur(mpnodam nmfvsl(fa2ur(mo;o0optnii3iyd m2umnms;(4arxomf oadlaD anvi;t)s2umim oo1al n nctas srum( pnt4oet ifctatla rlump;t0aexnif3tydfaD lueo (0t2triopny4lmte fetat s2rr(rp;u1alx ii3iltfaDua( snu4 renmocia1fp rlneil(  eum(m oo4ope  fctat s2rrur ot0altoiieiytlaDumnmsnu) exrxf3io1oatrlnvol(  rtmio nudaptn ivtl(  2uax o;t1oleoiictys a umuvp u) exnmrciytfa eai sls  rtrxrpiy4lmtemfvsa() 2urxr nu0aptn f3iaslsDrmuvo;t)alxnmf3oy1fmtr ivo t)t2xrirpoodlmtnlnetlt srurx oou4oltn f3ilsfs2ua(vp t)tlxoifctydfmt ai o () eurxm3iy4llenmfvs t a2trxmoot4tlenioetyd m ra(mpn(0 ltnmo3tadfaD an o;()s2toxm iodoptn ieils)artmx  ;t0tee iietlt m umn sn(4trtoifctadfpte u i s)t2xoxrpnu1am nmnviasf Drr(rpou4tpenioeild aDumu p t0altrmo3oydlaDeluvs s0s2xrirpoo1ape  iet s)s2trx  ;u4aeen oeilsfs uan s;t0trenif ta1oa e ivs;s)s2xmxo3iudlme lictat  rta(mono0tex  o3ilsfmDranvo u)tltoif3iadfa   ueol() 2trxr3no4lm nmnetas  rta(ronu1aptnmiciasfsDrl( pnt0trxoio tatlp e ues;(0 2um(opiodapt mfvta()srtaum oo4tpxnii3iydfs2rluvo t4 lxnifcoodom rlues ()srumim3iu1lp   fvtl(  Duaxmoot0aptn i3iatlm2umnvon()tltoxociodomDrlu slt setoxr3no4oltnlnvtlt a2umumoot4tpt  i3iyd sDeanvpnu) exoxf oytopt ai o () eurxopoydaltnlicsl() rua(mp;o0oetnmf3tadfaDel( p;t)altnmf oadfateluvs;t)srtm(o iodlpenmfct t  2rrurpnt1oee  f3iltfa2ul( sn(4 rtnxf3oatfaDrlnvo;t trum(m3ou1llenmivilsfaDraurp;u4olen oetls sDulnms;t0texrifciy1opDeluvo s0teuo(r iodaptemiei t) rur( p;t0tpx ioetltlmDulnms;u0tleoxr iydlmDrlneils)texrir3oudlmeelnetasfsrtru  no4olt mf3iltlm2rlnvo;t0trxomo3totlat aneo;() etoio3iu4llenlnvtat  rrmx  ;o0tptn feiytfs2ra(vp t)tltomf io1lm ranvols0s2uoxr nodaptelnvi t a2trx p;t1aee  o3tld aDrlu pnu)aexrxrciodlaDrluvo s srtm(m io4lm nlfvtlt)sDrmxrp;o1olxnmociyd m ranvo (0teerxo3todfat lnvsl(0t2urxr3nydlpenmnci ( a2urumo;o0tpe  ietadls ea(vs;u)tetrif todopD  ueo s0teuoir nydlme  fvsatf ruaum ;o4aleoii3iasfsDranms t)trxrioctodlaDe u i t0trumxopiodll  lfeia( s2urumoot0oltniiciytfa2uau o;(4 rxrmrcty1omDe neo t0seur(m iudlmte fcta()aDtm(rp;o4texn f3iat a rmnmsnu4altrmocoydlate n o;s srtoim nydal elivsat)a2rrxmpou4apx mfetlt s ea(mo t4aeerio3todoate nei s0s2ur(o3iudapt lfvta(f Dra(r ;t0opxnifeiltfa ea(mpnu4 lxnmf3iotfmtrli sl(0srurxm3oy4lleelnvs t aDum( oot4tpxnifcils sDranvp;(4aeerir oodla eauvol()seuoirpny4om nlici t)arumurpnt1aexomoctls mDumn p;t4 eerxr oadfmDraies s s2xr(mpiy4openlfct sfaDtrurp;u4oetomoeiydfsDemuvp;t)alermo3todfmte ivs (0srtoxm oo1lptelneta() rta(r ou4tetomocildfa ulu o (0alxrio3oydop  luvo;s  rxo(r iodlmee nei t sDrrxmpno0alenmfeiyd m rau s t)alerif ta1fpD li i s) rtrxmpiydlpt lnes (f 2umxm ;o4aeenmoctlsla rl(msnu4aeerxocoo1oaDrauvs t)tetr(r3ny1ape  ncta() Dtaxmo;u1alxnmi3tls mDran p;(4 rxrxo3tytoaDraneo;s0 2xoxr3oo4ol n ivtls)aDra( pnt4altomi3iydfm2ua(ms t)tleomr3iy1laDrlivsl()trtoir oy4op  lfvsls  Dua(ront4alxn feiysfs eluvpnt4 rtnxfciy1lptr n o s  2tr(r oodomt livt (  Duaxmp;o4apt mf3tldlmDemump u0 eenxf oo1fat anei;s)t2urxr3io1ame lfvsas) Durxrp;o0opx  ietltlsDrauvp;(4trtoxoctadoa r ueolt trxo(m3io4altnlfvi s  Dtm(r ou4oee  feild a2rmuvs u4trxnir todlm  lues (0t2xmxr oydapte ietls  2ur(m nu0tpe iietat a2rmump;u0 lxnio3oy1lm  lu il(  eto(opny1apeemicsa(  Drmxmo;o1tpxomo3tltlsDeluvp;(0aeeoif3iodopDranvs;s0seuoxo nu1alte nvsls a2rrur ;u0tltnii3iys m raums (0trtnmrciytoaDeaies ( teto(m3ou4altn iet sf 2tmx  ou0oltn ictasfm2eau p;(4texnmfcoydlpDeli ils)setm(mpno1llenlfet t)sDtmx ooo0tlxnii3ildla ulnmo (4arxnmo iotlaDeanes s tetm(r3nudll elfct (f 2rauronu4olxnio3tld m emu onu)arenirctydlmDrlivo;() rumiopou1omeelivi sf rrrurpno1teenifeiasfmDra(ms;t4 reoxrcoy1omDraivslt0teto(r3nydlm nlneslsf Draurpoo1alx mo3ilsfm eauvpnt4aexomo3tatfpD  neo;s0tetrxo ou1omeelfeslsfsDum( onu4opto oeiydlm eanmonu0altoircoatfmtranvs t  eumxo3oudap elnvs t)a2trum nt4tlx ioetytfm2uanvpnu4 rxrir3todfm r uvs () 2uo(opiu1op  mneslt srrmxmp;t4alenmoeiatlmDraumpnt4tlerxrctytlm rlivils)trurir3ny4llt mfetatf rrr(roou0optn fetysfs um(vo u4 exnir oadlpt  i s;s) exmimpou1ll n netas) Dtmu poo4opt ifeiltfs uan o ()alxrmf3ia1om   nvo s  rto(opio1lm elfctl()s2taxr ;o0apxomf3ias m emumo t4alxnmr tytfatelies (0 2to(r io1aptelfvs t)a2rr(m nt4tee mfcias m umu pnt)teerxfctotfp r i o;()texmxrpio1op elicsl(fsDraur no0texn ociatfm2em(vo (4tetomrcootlmD aneol(0texoxmpiu1ope  fcsatfsDtr(  nu4teto ieilt s ra(mo t0tetrif3oadop e ivsls t2uoiopnu1apt  fct tfsDumuroot1alto iciasla em(mpnt0altnircia1lpte nvo;t  2umxrpou4ll   fet t a2tm( poo1alx io3iadfs2umnvp;u)treoxo oy1omD lnvi t)setoxmpou4ll  mfct t) rrrxrp;t1aeeoio3tydla2rlnmo u0aexnmrcty1oaD auvol(0 2urir3no1lltelncias) Drrurp;t1aeeoif3taslaDuau p u)aexnxf tatfmDraiei;t0srumxm3ny1lpen nei sfsrtrur ot4ale ii3iatla2rm(vpn(4teermfctodop  livil()t2xm(o3ou1lleemfci tf 2ra( pnt0aeeoii3ilt sDuan on(4 etomrcta1oat  nvs;s)t2xo(o ny4om nlnesas)a2rr(  oo0alt mo3ildla ra(mont0aexoirciadfpD aiei (0s2umxm3io4lptnmneiltf rurxmont0tlxo ietltls2um(mpnt)tlxrif3iatfaD li i (0t2uoim3iy4lmt mfvsas)s2rrxr oo4tpt ifciasfa2emumpnt4alxrmfciotopDeaueo t s2xrxr3oudole mivtas srurxm no0aexn octaslsDel( ont0artomf3to1omt  ivs (0s2tmiopoydaptnlfvt (  Dur(mpou1apt mi3ilt s ra(vp;u0aetnmf3oatom elnvsls) exm(m ny1omee fetls)sDrau  ;u4tee mi3iys m uaump (0altnxf3totfmtrai ols0srtoxmpio4lptnlivt sfa2rru  nu0alx mfetytlm2eln s;t4texnxfcoa1lpDranvsl(  eumxrpoo1ap nliciatf rtmxmp;o4ape mo3ild mDelnvp t0 eenmrcoy1lm r n i t  rur(m nu4lmt  ivils sDrmxr ;t4tlenmo3iydls2umn p;u) rxomfcoy1fm r u s;( t2tr(o3ny1omen ies (faDuaur ou4oltoiieiytlm2elnvsn(0tlenxr tadfpteai s;t)srxo(o3nydlpeelnvia(  2trxmp;t1oeenii3iytls ea( pnt4tlxoxr3to1op   n s s  rtoir ou1opt mfvtlt)artrx pnu4aex  fetlt s el( ont4texomf3tytoa r ueols)t2xr(m3oodll nlivt t)s2ta(rp;u1tltoif3tytls2elnvpnu)artriocoa1fa e n o s0trxmir3iy1ome lietl()a2raurp;u0tpen fciaslm emnvpnt) eenxr ty1faDe u ilt trxoxopny4omtelnctat s2ur( o;t0apxnifcilsfaDemn p (0trxoio3io1fpt ai o;t  etm(r3nu4al n ics tf 2urxronu1aetnmiciltlaDuanmo t0 rtomf tatfat  nei;(0sexoir3io4al   ncs (fsDtm(mp;o1tptomo3tadla ulu pn(0aexrir3iodlaDrluvo s0 2uoimpiydamt lfet (faDrm(mono4tlx iiciys sDumuvp u0trtrxf3totfmD  ivi s0t2tmirpoudlm nmies s)arrrumpno1apxnioeildlm2ua(mp;t) leoxocoatop  lu o s sruo(m no4ll  mici (  rta(mpno1apxn fetldlmDra(vp u0 exrif tatopt aieil(  rxmiopiy4alt lfcils srra(r ;t4aleomf3iat a ra( ont0 eermfcta1fatrluei;s) rtmxrpiydal emnetl()s2taur ;t0tpe iiciatfa rau o;u4artoif oa1faDeauvils)t2urxm oo4lpt livsls)arrrur oo0tpe iieiytfa2ea( s;t)texoifctydoaD ai s;t) rxoxopnudam nlnetatf 2ur(mono0olt mieilt a2rmn o;u)aeeoirciatlmDe nvo ()t2tmxo3ny4lmee fvilsf Drr(m oo0tpx ioeiatfa2ra(vpnt4teerxf ty1omt lneo s) exoiopiu4oltelfeias srrm(r oo4aee moetysfmDrln onu) ltrmociydoatelnes;s) exmxm3nu4lp  mici sfsrrauro;t0oexoifciadls2eaumsnu) rxnxr tytfa r n il( srxrim no4ome lncil(fsrtmxmp;o0tet  feias m2el( pnt4teeoxr tadfaDe u o t0s2uoxo iy1optnlfcs s aDtrx pnt0aptoifctld s2rmn snt4aeeoxf ty1fa e ieils0trtoxo oo4lme mncsl( aDtm(rpou0oltomi3tyslm el( s;t)tlenioctatoa   n o;t)teuoim io1ope mfetltfs2rm(monu0oltomfeiyd a2umnmp (4 lxrxoctytla eaivi s)trxmiopoydlm nmneslt aDrau pou1teenifeiytfsDumnvont0arenxr3ty1fpt lnvo;t srtmio ny4lmtelfvslt)sDtmur ot1ale mfcildfs2ea(vsnu4 exrmr3to1fmDr u o;(0s2xmxrpnudol   fci t arur(  ot4olt  f3tyt s2ulnmp u4 etomr3oo1omDeluvsl() etrim nodlleemfcsatfa2urxmp;t0olxnmfetld m2ea(mpn(4trenxfcoydoat  ies;s) rxrxopoudlme livtas  Dtrum nt4ale mfetlsfs emumsnt)texrxo ia1lm rlneo;( setoxopoodlltnmfcta( a2raxrp;u4tptn ietasfsDumnvp u)aetnmociodlmtr i ils0t2umir3iydlltelivils)aDuau o;u4aet iieiydfm2rmums () rerxr3ia1lm e u ils0 2to(r oo1om nmicias a2trx  no4alxoiieiyd s2elu p t0trxnmf iadopDelivo ()srxrxo3no1lptelncil()srtrx pnu4opto icild sDra( pnu) exomr iotlatrau o;(  2xoxrpny4al e nvt s aDrr( pou4apeoiietasfa2emn snt0alxrmf3tydla   ieo s  rtm(mpiudam  mnvt ( sDua( onu1aee ii3tlsfa2el( s;t)tltrirciadfaD anvils0srurxm ou1am elictas aDtm(r ;t1oltnmfetltlsDeln ont4 exnxf3iytfmtrli sl()setoxm ou4llt  net ( arua( ont0aexniociltfmDumums;t0 eerio3ootoaD  nvi ( setoir io4apenmnetas)s2ua(m no1opeomfetydfa ra(mp;t0 eenir iydlat lnvs s0 2umirpiy1al emicsl(fs2tru  ot1teenmfciytfm2ul( onu0tleomo3tatla rai sl(  exmxopoydlmtnlfctltf 2rr(mont0aleo i3iasla umnmp;t)tetrir3totla rluvs () exr(o oudop n nvsas srtmumont1apto i3tadlaDumnmo (4treoxrctotoa   uvs s)trxo(m no1altnlfeslt srur(mpno0tlx  oeiaslaDum(mo (4 rtnmf3iotlmtrai s t)tetriopnudamt mncil(f rurxr oo4tptnmf3iatlaDra(vo t0aetnmr3todoaDranes;( s2toir3no1apt  feia(fa2uaxm oo0tltnmfctydfm2rmu pn()trxnmo tytfaD lu sl()srxmir3io1lptnmfvilsfa2ua(root4alt  ociysls rmumo;(4alenio to1lm  anes;t0srurim no4lpe  nvtls srrrx  ot0olx iieiat a umums;t4 lxnio3oydoatraiei;t0sruoxr3nu1am n nct t) Dtrxmoot4oex ifeiyt mDea(vp t4tetoxr iydfm e i ols0 rxrio3nydlpte feia(  Drmumpou0oet ifcild aDrauvo () eeriociytopt luei;(0trum(m3ou1lmtemivi t a2rax o;t4tleniictadlmDuluvs u4aetnif to1omtraneo s  2tm(opoodlmte iesat)a2trxmo;u1aetniietldfmDeluvsnt4artomr todlmtr iei;s) euoim3no1ale  fet s sDrax pno0alt  fcildfa umnvo;t) exnifciytom eln i s) rxm(rpnu1ol n fet (  2uaurpno0texo oetadfa2uau o u4areoirctodlpD an i s0 rumiopnydopt mietltfa2umxr no4tlxomi3iysfa el( s;t0arenirciy1om  lu ils0t2xr(m3iodamee ncia()srrrumpnt1aptnmieiytfa2rm( o u) lxnio ta1omt  u sls0sexrio3ny4ol nlfeslt) rtaxmooo1ale mf3iat m2ua( s t)aleomociodlm r nvols  rxoirpou4olenlicsl( aDrmxmpno0opx io3iyt a emu onu)teeoxf ty1fat ln sl(0tetr(m3ny4op n fvsl(f rum(r ;u1opt  feilsla em( p;t)trxrif3oodfp eaivolt  rxoxmpiu1ole  fcs t) rur( p;o0tetoiicild mDumn o;(4alxoxo3tatfptrai ils0t2xo(o3no1om elivtls)a2ur(moot4olenif3tas a rl(vs;u0aeeoxoctytoaDeluvilt  etoim3iy1ome  fvtls arurxronu4teeo i3ilslaDum(vo t4teenmr tatfmt aueo (0texo(r iy4lmtnlfvtat artax ont1olto f3ild mDua( s;()aetrmocoo1omtelivs;( t2uriopiu1opeelnvtl( srrm(r ;t0tptn fetatls rau pnt4 rxnir tadfpDraivo ()teur(opiy1aleemnctlt aDta(r ;u1ale iiciyd mDran p u4 lxnxf oy1fmtelnesls)srtmim3iy1apenmfvt t srtaxmont0teeo f3iyd sDemump u)trermr3iadfp raueo ( s2tmxm iu4lmt mfeiltfartaxm ;u4tleniietadls2umnvs;t4teenmfcoy1oaD aueilt)texm(mpnodale mfcsasfsDumxm oo4tptnmieiat s rm(ms ()altomr to1opte uvo (0t2xmirpnu4lltnlnvs (farrm( poo0aee  ieiydfaDem(msnu) rerir iodlpDe n o t  rum(mpiy1lp nmfvtas  rrr(mo;o1apenmi3tltlm eanvo () rermf3iatoaD  uei t0tetoio iodopenmfviat  2uru ont0ale mfcilt a2emnvp t0artnioctadlaD  ueols0trtoio iu4amt mfesl( aDta( p;u4apt ii3ildfaDea(vo;()tetomr tadfaDr nvo t seurxopny4lp   feia(f 2tmxmpou0olx  f3iltfsDelnvo;u4trxniociytfa  anvols0teuoxm3iy4ap nlivilsfaruax oot4opeomociyd m2em(mpn(4trxnirctatfaDran i;t0 rum(mpiu1ope mnesas)srrr( pot4oetniiciatlm rln o t0arenxr3oodlmDelnvs;(0trxrxm3io4olt  ics sfsDumurpnu1tltn fetadfs2umump;t)trtrio3io1fm rai s (0t2uo(r3iu4al n net s a2taxrp;t0olxoiietld a2ea( onu4alxoifcoadfpt lnvslt)texm(m3iu1al nmnviatfartrxm oo4aet iociytfm elu s t0treomrciydlpDrli o;s srtmirpoo4amen nvs tfaDtmx  ;u1teeoiociltfmDem(vs u)aexoir oatlmtrauvils)texoxm oo4lpen fvtltfs2tmxro;u4teen f3tytfmDea(vp;t0trerioctytopD  i i;s0sexmirpio4ap  mfeil()a2tr(mo;o4oetomieiltfm rl(vp;(4arxoxrcto1opteli sls0seumxm oy4ap elnvs t a2rrxmpou4tex  o3iat mDelu snt)aeerxrcio1omt lu o s)srtmirpnodlm emfesa()aDurxr ou4tleoifeias aDran on()tltnxr ia1om  liei;(0setrxr3io4am nlnci (f 2rmurp;o0tpt  iciydfs2ranvsnt4 ltomrctytom e uei ()trto(opoo1alt mivi t) Dumur ;u0alto iciydls2rlu p;u)trtrir3ty1lp e ivols) 2tm(mpiodlltnmfvslsfaDuau o;o0texnmo3iat m2em(mo () rtrxo3todlmtrauvo ()srxr(rpou1amt  feilt arra(rpno1tet  feiytfsDuan pnt4tlxnmo3tydfm rli ilt  rurim3io4lmenmfcia(fsDtaum nu4opt mf3iasfsDeauvp t4 lxnmr tadlpt  nei t setm(rpiu1om   fctlsfartrxmp;t1alxo iciys mDranvo;(4 eermr oytomt  n il()trxmxopiodomtemieil( srtm( p;o1apeoiociasfm2ua( pnu4aetrxf ta1lm   nvil(0trtmxm3no4optnmnvilt  Dta(mpnt1opeo ocils aDuauvp;t0 renxfcoodom  lu s;t) 2toxrpio1ale mnctl( arrrur ;t1alen ieiltfa umu s;u0 lenmrcoo1lpDrlnvs t0s2urxrpoy4ap emfesa(fs2tr(r nt4oexn f3iltls2rauvp;u4 rerxo3iatoptelnvsl()sexr(opou4oleemneils)sDtrxmoou0oet miciytfaDel( p;t0 rtrxo iodfa e iei t)srxrim nudopenlfeils)a2rru pnu0aetnmfcilslmDranmp;t4 eeriocoo1omtraivsls s2xrim no4al n nesas) Dtmumpnu0tleoifctysfa2rmnvont) rerxf3tatfpt lnvolt) exoimpoydlpenlfvilt s2rm(  ;o1aetoiietys a ea( pn(0tlenmrcoydlm e neo s trur(o oy4lptnmfvslsfs2um(r ;u1alx ioeilsfs rmuvo;t)aexrxf iydoa eauvils0 etoxopio1lm elnctas sDumu pou0tpe  oetad aDrmnmo (4tlermf3iy1lp rlneilt0t2urxm ou1amt livtl(f rrmxro;u0opeo i3ias s ua(mp u4 ltomfcio1op  luvi (0sexoxo3nudop elneiltfsDumxm ou0aeenii3tlsla eln s;u4trtnifctotfpD aneo ( t2to(m3nu1ll   nvsls s2rr(rpot0oexomfeilslm2ranmp u)arenmo3tadlmtrluvol( t2uoimpnudale  fetl(f rtax  oo4tpxnioetltlm2uan p u)tltomo3ta1oa  ln ols  ruo(m nudal   fetas a2rrxm oo1tleomfciyd aDuauvpnt) leoxoctydfat luvils0srtmxr nydom emieils)aDumu  nt1oexoioeiyd s2ul(vp;(4arxnmr tatfateluvi s0srumxmpiu1oleemfviatfaDta(rp;o1apxn i3tatlaDran p;t) lenif oodop rlnesl( t2tmxo3io4lmtnmfesa() 2trum ;u1aexnioctlt sDemnms;()texoxocoydom   nvs;( t2um(o3oo4lpt  fes tfs2rr(r nu4apx  ictydla uln o;t) etomf iotoatr ues;(0 2xr(o3iydom  lnciat aDtmx p;o0tet  fciasfm2ra( on(4 etrmf3iodlp  ln i t  2xoio io1lpeemnet t)arrax pnu0teeo iciyslaDrln o u0trtnir tadopD lnvsl()t2tmxopiu1ol n neias  2umx pot0alxoiociat mDelnvp t4tlenifciotlmtrlivi t  exrimpoo1olt  fciltfaDtmuro;u1openioeiadfaDrl( s;(0arxoiociytom rau i;() euo(m oo4ame mfci s aDuru o;o4alto ociyd aDrlnvs;t4 exnxo3oodfmDeln o;s0t2xm(mpnudomenmfciasfaDtr(ront0aee ii3iyd s2rmumpn()teenio iatoatrlneols setoxm io4lmteliesa(fsrraxmono4oetomf3iaslmDrlu s
\ No newline at end of file
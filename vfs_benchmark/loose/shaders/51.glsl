@@ -0,0 +1 @@
+uesls0trtoio3iodal  mfvia(fsDtm(  ;u1aet ii3tyt sDulnmp (0 ltoif iodopD  nvil(  rxr(o3oy1omee fcs s)sDrmu  nt0tpx iiciad s2elu snu4alenxfcoa1omtrln i ()t2trxo ou4op  mfvs () 2urx o;t0oeeo i3iydfa rluvo () ltoifctadfp  lu o t  2tmxr3iy1lpe  ncs t a2ururoot4tptn fciydls2rl(vs;()altnmf oadfa e uvi () exr(rpou1lle  fvilsf 2ta(mo;o1olxnmfctyd a um(vp;u) etoioctydopDelues s t2urxr3oydlmt livil()sDurumpnt1olt mf3tldfm2uauvp;(4arxnmr3ia1fat lnvi (  2xmio3oydlpe  icils srtau onu1tetnmocilsfmDelnvs t0aexnmo oo1om  li s;( srumio3nu1optnmncias)srrm(mp;o1aex  iciydlaDea(vo t4 lenif oa1lptr u o t0t2xrxo nudaptnmnesl(fsrtaxmp;t1tetnii3iat m ea(msn(0artrmr3iotfp  anei;s) etrxr no4op nlneiat aDua(mono1opxoiieiysla2ulump u0aleoxr3oodoa raivols)s2um(o3nu1omenmict t s2raurpou1tee moetldfa2el(vsn(4 eenir tadopDeln i;t) rum(rpnu4optnmieta( a2ur(  oo0tle ii3ilsls2ulu o t0tltoif iydfpDr neo;t)texm(o3oy1altelnet s) Dtm(ro;t4apeomi3iadlm emnvs;t0alxnmo ootfm rluei (  eurio nydlmte fvtlt)s2uax pno0tltn fcilsfs2eauvsnt) lerif3todoptr ueilt)s2toiopiodap nliviat)s2ra(rpot4opx  f3ildls2el(vo;t0altrircia1latrlueils s2uoxopoodaptn fct () 2tm(  ou4tpxn o3iatla2ranms t)tetnxf oodlate n o;(  rxrxm3ou4ll  mfcil(fsDtrxmonu4oeeomoeiltlaDrmu o;u)aleoxrcoydoatrlueo;s) etrxr3ou4lmte fvsltfsDraurpnu1optnmf3tatfmDulnmsnt)trerxr to1laDeai i;t0 rtmimpou4lm nmiet tfsDumx o;o0aptnio3iltlm umnvp;u)tetnxocty1laDrauvo;s)trtrxm iodlme lfcias  rtau ooo0oex io3iysfs emu p t)artomfciotfmD li i (0s2tm(m no4amt lncsa( a2rru  nu4tee ii3tltls umums t)aeeoiocoydomteln s t trxo(m ny1ame lfctl()aruaxrp;o4opxoioetldlm emump;(4trxoxo3tydlmte neo (0sexo(o ou4lltemncs s aDtrx  no4opx mieiat a ua(msnt0trxrxf oa1omD  n o;s tetr(m iu4om elnvsat)arumxm ;u1tltnmf3iasfs eluvo;t4 exnmr oadoptrln o t srumxo io1lptnlfeslsfarurxr no1tpenmfctas a rm(vo t4altnif oydomte nes;()srtoir3nu1lp n ivsat)aDum(r ou0oexn o3iltls2ulnmont)tleomr3tytlateaivs s0t2xmxr3oydomen nesl(f 2ra(mpou0apx io3ilsfs rm( o;t0aetrxo oatlp   ivs t) 2uriopiydlmt mfvt tfsrraurp;u4aleoifctat s rmnvsn()tlenmf iatoaD luvs;( s2trio oy4lleemnciasfa2uax  nt0teeomietasfmDrm(vs;t4 lermocoytlpD  i o;()t2xmio3nudap elfcs t  Drru  ot4aex iiciyt s2ea(msnt4 lxrmf3oa1fpteanvslt0setr(r nu1om  lieilt s2tmxrooo0tpx iicild a2rmn s t) etnio3ty1oa rluvils seurimpoy4ale  ncils srraxmpou0olxnii3taslaDum(vs (0 rtoir tadlptran o t trtmirpno1optn feiat s2rax  ;t1altoio3tas sDrmuvs t4 lxrxo ia1oatrln i t0trurxo3nudamtnlfvi () rtr(rono0tpx  octadfaDum( s (4aleoxfciydfmteau sl() rtr(r3nudale miesa(  Drmxro;o1aptnmo3ildla2emuvonu0aetoxo3iydoa rliei s  eur(m no4olt mfeils) 2raxrono4olx iieiltls ulums;u4altnxrcoa1lpt aneo (0tetoxopiy4opt  ncsasf 2tr( onu4apenifeiysfs2rlnvo u4arerif3iatfm  lues s0seuo(r nydomeemiciat) Dta(rpnt0optnio3ils a2ua(mo;t0aexomf3oadopDrluvols) rumxo no1aleelfvias)arrru oot0oexn o3iadlmDelump;u)arenir3iatlaD aneols  rtrxopoy4lmt mfet s)arrrxm ot0oltoif3ildlm emn s;(4arenxrcoodfa eli s;t)tetoxr oydal nlfeia( arumumoot1opto iciysfs2eln p;()trtnmfctodfpDr nvi ()t2urxm iy1amtn net ()a2um(m ou0tlxnmo3iytfa emums;u0arermf3iydoate nes t0s2ur(r oy4lp emfvia()s2trx pnt1alx mfeild s2em(vo (4 ltnif3oydopDelu sl(0tetoxrpiy1ameemfct tfaDrax  oo4teto iciyd aDrl(vo;u) eenmr oydoat an i;s srxrir3oodol   ivia(fs2um( ono4ope mi3tadla2rm(vp t0alxrif3ia1fptrlnvo;t tetoxm3iydlmtn nctltfarrr( oou0alto fetldlmDelnvpnu0artomf3ia1lmDeaueil()srxoxm3iy4alt miet tf rua(mpnu4opxoifeiad m2uluvs;t0 etrxocta1oa elu ol(0trtrxo3oy4lpen fciat)srum(  nu0optoioctaslaDrln p t4tetomo3oo1opDeaues s)srtoxo3nodlm nlnci () Dua(m nu0oet mo3iaslsDeln sn(4 rtriocoytfm e uvs;s0srtr(mpio4lptelietl( arurumo;t1tetnmoetltla2rlnmsnt4aeeomf to1lm elu i;( s2xrxopoy1op  lici tfsDtaxro;o1oetnioctldlmDra( on()teermo3oodlmte ueo (0texoxopoy1omtnlivslt artmxront0aee ioeiysls ean o;t4 lermf oodlpteaues t t2toim nu1opte fcsl(  Dtm(  ;u4opx ioctld a2eaump;(0 etrxfcia1omte ivs;s)s2tm(m io1omtnlfvia(f Dumu  oo0aeeomfetydfaDrluvp (4altrif3iotomDr n o;(0sruoim ou1lmen nciatf rtaur ou1aee ifciytfs2uaumon(0trtomrcty1op eai sl( s2um(opno4optemfvi t)srtau  ;u0texniociyt s2ranmp u0trerxf3to1fmDelnei s0 etrxm3oo1lltemnvtlt)artru  ou4tet mf3iadlmDemnvpnu) rtrxo3iadfatelieo;t) 2uoimpiydom nlfci (fs2urumpno4aexnifeias sDrln s;(0 lxrmfctadfmDraiesls0 2uo(opoydlpt mnct tf Dta( pnt1aeen ociyt m elnvpnu4alxoif oatlpD lnvi;t)sruoxr no4aleemict t)a2uax ooo0tptomieiasla2uauvp (4teermf oodlm rau o s0t2to(o3oo4amen ict tf Draxrpno1alx  oeiyt aDum(vs;u0aetnmr tadlptrauvs;t)teum(o ny4am  miet s) ruau  ;u1aeen f3tlt m2uanmp;(4aeerif3oo1lm ran i;(0t2tm(r oy1apenmivs s)a2trurooo0oet miciasfa2rlnms;t) lxoxfctadlm eln o;(0s2xrim3iydlpe lfcs t  2raumonu0apxoiiciltla rmu p;u)trtoxr3totomtean sls s2trxr ou1opt  ivia() Durxmpnt1teeomf3iyt mDeln p u4 eeomr iatfmt auesls0setmxm3oudomtelnvtltfsrumxro;u1aee  o3tlsfa2um(monu0arxrir todlatr ivolt)srxrxmpnydal nmneiatf 2taxmp;u1apt  f3iltfm2emn onu) reoir ootomDelnei;t0tetmxr iy4omen fcias  rrax  ot1aetomo3ild aDrmnmo;u0texoir3ta1omtelnvsls0 etoxo3ou4oltemicsat) 2taxro;t0olx  o3iytlmDrluvs u4aeenio3oa1fpDraues s0srur(mpiu4ale lnvilt s2ra(m ot4oetnmi3iad m rm(vo (4trxoio3iydlaDeli ol( seurxo oodolt micsat  rtrumpnt4oetnmf3tatfm uan o;t4 eerxrcoodoatelnvi s s2uriopiy1lp   fvia(fsrraurpnt0oexoio3iasfa2rlu s (0altrircoadfm eaieilt0t2uoim iu4lltnmnesl( srrm(m ;u4tlt mf3iltfs2rluvp;t) rerxociadfpteauvo;(  2uoio3no1lpee ivtlt sDrmx  ;u0tpx  ociadfa2elu on(4 exoio iodoat auvs s)srtr(m3oydlm nlfct ()srrr(mp;u4tptoiietltls emu o;(0teermf3oodfmD aneo;s)s2tm(m3nydlpenlncslt sruaxrp;o4tpx io3tas a2uan on()aexnif totfpD lieolt0srxoim iu1alenlncia( arrmum oo4apto f3tld sDrl( p;t4 exnirciydoptrlivils0tetmim iydlmen ivtasfs2taur no0oleomfetldfa2umn s;t0 reoxr io1lm   i slt t2uo(o3nu1al  mies t artrxmoou4oex  ociyd aDra(vo u0alxrio3iydoa rlu o;()teto(mpiodaptn nes s) rrru  oo1alt  iciyt s rluvont0aleomf3oodlmt li i;() etoio3oy4am   nvt t) 2rmxmono4tlxo oetys a2um( pnt4 etoxfcoytoaDe i s;()srtoim iu4olt lfetl(  Dur( onu1olto iciys m2ranmp;(4 lerxr3oadoaDr n ils  ruo(o ou4op n fviltfs2ur(ro;o4ape  f3iatla umn s (0artrmr3iatfmt aneols0trur(rpou1om nlncsl()sDtmu oou4oetomociasla2rl(vp;u4areoifctydfpD  u s s  rtr(rpnu4al  lncias  2rr(r ;u4olxnmo3ils m2rm( p t) lxomo totopteln i;(  eum(m iu1lpenliei t)srurur ;o0aetnmietad m eanmpnt4aexnmo iytfm rluei t texriopno1omtnmiet t)srtaumpot0tlt  feiydfa2umn o;t0 ltoxr iydfaDrluei;(  exoxm ou4omt mics tfa2urx  nu0tltn f3ilt aDeaums u) lxnio3iy1late uvi;t tetoxm3nu1llte fesls srrru  oo1oee moctltlm2uaumpn(4trxoxr oo1late i o s)trurxr no1alen fei t)sDtmurpou1tpenmiciys sDemuvo;u4trxnmfciy1omtrluvs ( t2to(m iu4aptelivsat  Drmumoot1teeomo3tasls emu p;(4altnmocto1fptrlu sl( t2xriopnu1ol elnvt s a2uaxm ;o4aex  fetytlm2elnvp;u4texrmfciydomtrlivols) 2xmirpiy4aptemfct sfarur(mpou0ape iiciadfa ulnvo;()artnxfciydlmDeln s s0 rtrir iy4om e fvt tfsruaxmonu4texoioctys aDuluvont4 lenmociodomDe uvilt0 2uo(r3ny4ape lnvt s)a2taur no0oexo f3ils m ulumonu)alxrxocty1oa eanvols s2umio3nudlp elfet t) 2rm(  nu0tleoiocils m el( s (0tetrxr iadomD  ieo;(0 exo(m3ou4lpee fcsas aDra( ono0altnmfeiysfm umnms t4trtnxfcootlaD lneo;s0srum(m3oydamteliviat) 2um(rono4opxomfeiltfmDean s;u) rtrio oy1omte n o;s0s2xrimpoudlmt mfciatf 2ta(mo;u0ale mo3ilsfaDumu s u0aleomfcta1laDraies t tetr(mpoy1llt mnciat)sDtr(mono1tpeoifeiaslaDumnvon() lerir tadfatr neo s trxo(o3ny4al e ieta( aDtmumpot0apt io3iltfsDemnms;u0aeerxoctodlptrlnei;t)setmir3io4alt  nct s srtrxrpou4tee miciytfs eaumont4 eenmr3ootla elivils0texmir3oo1lltnmfeilsfarta(rpou4opto oeiyslm2ua( snt4trermo oodfp eluvs (0srurxm oudlpte fetlsfaDrau pot1tpx  i3tatlm2umu s;t)arenmfcty1fpDe i s t0 rtrxrpoo4aptnlfct s  rumumoot0aptoio3tyd aDrmnvsnt)aexnmf3oo1lmDrluvo;s t2xrio3oy1op   nvi t s2ra(ront0apenmicild sDem( p;t0 eermrcia1la eauvsl(0srtoxr3iydome lnvsa()arrruro;o0olx ii3ils s um(mp;(0trxnmo oatla rau ils0s2xmxm3oodome  fctasfs2uax pot0opx  f3tas mDrl(ms t4 eerio3iy1op rau s s0seurim ou1opte iet t) 2rr(r oo4tltomoctysfs eanvo;(0 exomocta1lmteliesl(0trtmxo iodlmtemfeslsf 2raurpou4oee  fctlslaDea( snu0trxrirctadlatelueilt0srtrxm oo4olenmieil( sDur(  ot1aptnmfeiytls elums;(0 exomr oytfptrli s;(0t2xmxmpiu4ll nmiviat srraxront0apxomfciys sDel(mo t0alxoxr3oodlp rln ilt0 rtm(r ou1lpt mfetat)s2ur(mono0oetomocilsls2ea(von()teermociytopDrli s;s0 etmxr ou4omte fei t) rrmumooo0aetomocils a2emuvp ()trenmo oydomDeli s t trtr(opoo1opee nvil( aDrax onu0aeen ieiysfm2ranvpnt)texoir3oadla r ivsls0 2urxo3io4aleemnes t) Dtr( onu1olenioetadfaDua(mo;(0 leoirctotopt  n ils0 exo(o3iy1lle licsls arua( o;u0altnii3tas aDrlnmsn()tetoircto1oateanvo;t)sruoir3ny1lm nmics tfa2taxm oo4tlxnifeiysfaDel(msnu) rxnif io1opD ln i;(  exo(mpiy1aleelivtl( arrr(moot1oeto octyt m2uan ont)teerxo oadomDe i o ( trxoim3iy4amt  ietat) rtru  ;u0opto i3ils a2rl(vo (0tleomfciytomtelnes s)t2trxo3oo4am  lncslt)sDuaxm ;o1ape mfciysla2rmn p t0aleomocoo1laD  u o;( setmir3iu4olenliet ()a2tm( pou4tetoioeiydlm elump (4 lenxrcty1fpDe uvs ()s2tr(opiydal  mieiltfsrumxronu0alxniietysla2umuvpnt4 rerxr tydopt li i;(0t2ur(r3oodll nmnvs s)a2urxrpnu1tee io3iatfs um(von(0aetrmo3tatfat li o (0 2to(o3iodoptemivtls)sDtaur ot0olx mfciatfaDrm(vsnu)aetnmf todlaDr ieo;t0texmim3oo4lltnlfvslt) 2trx  ;o0tpto ocilt s rl(vs u0texnmr3ta1lat anvo s  exm(o3oy1apenmfvta() rumxr no1ope  iciasfs2emumo;(4arxnmo3oa1lmtranei;(  rtrim3oydom e nvtas) 2trxroou0apx  ieiat m2emu on(0tlxnxo3oo1fpDrln s;s)s2uoxr3oydamte fvil(f rtrx  ot0opxoiictatlmDemums;u0tltoioctytoa  lu s;t  exmim nu4openlivt t  rtru p;t1alenmfciadfs2rl( s;t0trtrmfctytomtr ivs ( seumxr3ny4lmee ieiltfsDrr(r ;o1texomo3ilslaDelnvo (4trerxfctatfm r uei t)setmiopny4lltnlnvslt)aDrmu poo4alx mf3tydfs2elump ()tleomf oydlaDeauei ()t2trxr3oo1lmen fctas) 2tmxmp;u0apt iociadla2rlump u)areomocoadfp  au o s0 2toir oy4ape lnci (fsruru oot4tpe if3iat a2emnmsnt0aetomrcoy1oaDe nei ()s2xoiopio1aptnmnetas artr( p;t1oleoifeiltlsDrluvsnt)aeerxfcta1fat lneo (0 2um(opnu4lltnmici (  rrrurono1aex mf3ilt aDel( pn(4alxomo3ootlptean ols tetrxm3oy1lm  mictlt) 2rmxrpot0aeeoifeiytfsDem( pnu0 rerirciy1la  ln o s)teurio iy4opeelfct t)artmuroou0aex mf3iltla um(vs u4 lxomo3iy1lat ai s s0 2xo(mpno1apeemfctasfs2ra(rpno1optn i3iyslsDemumpnu0 etnxf3oadop e ies s)tetr(o3iodal nlivs sfsrraur ;u0oet mf3tys a uau onu)aexoifcoodop eaieo t0srur(m3oo1amtemnvs s)aDumu  nt1tpeomieiaslsDrlnvo t0 reriocoydfpDelu o ( s2urxo3io1al nlivs s)s2tmu p;o4alxnmfeiasls2rauvs;(0 exrxr3oydfpDe nvils0 2xrio3iu4lpen neta(fs2rmxrp;u0oex  ociaslmDumnmo;u4altrmfciydfp rliei s)sexrir io1lp n fctas) Dtau poo4oex mictldfa ul(monu4teerxo iodomDeln o (0t2tm(mpiu4lmt mivilt a2rr( o;o1tex ii3tatfa2elnvp () lenmr3oo1fpt lu o;()srurimpnudlle mivsat)artrurono4oee miciytlm2eaumpnu) ltomfcio1lmte ieols)srtrxm no4alenmfci s  Dtax  ;t1oet  iciysla2ra(mon(4tlermr3oadoaDelneil( s2tmio iydaltn nvslt)arua(monu0aleomfciatls ranvo t4 exomo iotoa ean o;(  exoir3ny1om  licslt) rraumono4oeenmi3tysfmDrlnvont)aexnmo3oydla eanes s  rumxr3ny4ale  iei tfarumxmooo0texo i3iadfs2elumsn() exnircoodopDrliesl( trtmxo3nudlme mnvt s sDtr(mooo0ale mo3iatla uau o u0 eerxr ia1omDelnvi;t)seur(rpio1apt mivta() rrrum ;o0opeomo3tyt s uln p ()tltnxfcto1lat aies;s0setrxr3iy4altemfvs tfs2tmxr ot0teen iciat aDrlumo u0aleoxo io1fa  lues ( srtmxm iydlp e fci t srrr(mpoo4tetomfetasla2eanvpn()teeomfcoodoaDr uvo;t0teto(mpoy4lmtn net s) rtau pno1ope iiciatls uluvpnt0 lxrxo3iadlpteai i;t)trum(opiy4am nmieil()aDua( ont1aeeniociyslsDuan p;(0areoxf3tydlaDr uei t0srtrxo oo1lpee ncsa()arrr( o;o0oleo f3ilsfs2rm( o u0 rerxf iy1op rln il(  2xrir no1lm  mfciat)srrmxm ot1ope mo3iasfsDeau s u)aexoxo3ta1la elivilt seum(mpiu4oltnlfvt t  Dtrx pot1aetomoetadlmDrmn o u4arxoio3iodfm r n s;s0 ruo(o3nudape mnctat a2taxmono0oex  fciat s ua(ms;u)artrio iytoateau olt) eumio iudam emieilt)arrm( pnt0tetn o3iytla2ul(vs;u0 ltnxrciytop eaivsls srumirpnodomtelfvsl( srurxr ou0oee mfciltfmDrmuvs t) lxrmf iatlaDe ivs;()trtm(o ou1lp e fvt t  Dtr(r ;t4aeenif3iltlsDem(vs u)arxrxociotfp elneslt s2uoxmpio1al nmfet tfartru  ot1teeoio3iyt mDra(vp u4altrio oydlaDrln s;s  2tr(m3nudoptn ivsat)s2rm( p;o1oex  fciyt mDrlump u)trtnxr3oydlaD  nei t)srumir3iu4lpee ivi (fa2rmxr nu1tpenioetlslsDumuvp ()aetnmr3tatlaD aneolt0s2toxopoy1lleelfci tfartru pot0aleniiciasfs umnvo () rxrxfcoadfmDrai o (0sexoirpno1lp  lnviatfs2rmxmp;o0optomfeiyslm ra(vs;u4 ltrirctytfmDeanvi;s tetrio nodolt  ieslsfs2uaur ;u1alxomfeildfmDrlums;u4 rtnir3todfaDeaivi;s trxrxopno4ape  nvtatfa2ta(m ou4oex  fciys s2ra( snu0 rtnmrcoodlptr u i ()srtmir no1openmnvtlt s2rm(mo;o1tlenioetldfm emnvp t4aeeomf oy1oaDeaivi t0 rum(o3no1omtnmfetltf Dumu p;u0tltn i3tad s ea(mp t0 rxnxf todoatr uvilt)trxoxopnydlmenlneiat srtrxmpnt0tpe miciytfm ra(vp (4aeenmo3ta1omtrln s;(0srtrxopio1lm nmnet sf Drax p;t0alen oeiaslsDeanvo (4aeerxfcoatomD auvsl(0 2uo(r iy1aptnlnvsas)srum(moou0tpx iociyd m umuvp u) eerxf3tatfmDe uei;t sexoxo oo1ole lneiltf 2rmump;u1ape  oeilslaDuaumonu)arxrxfcoo1oaDeliesls)teuoim io4opeemfei ()aDumxrpno1alto ieiyd s2ul(mo u0 rxrif iy1fa  lues;s  2urim3oy1ll emietltfa2uaxrp;t0tee mociyt s2ul(vs;u)trxnxrciadla ranvo;t  rxmxo ny4apte nctl( sDtru pno0aex iiciadlsDea(vo;(4teeoifctatlm r ues;s0 rtmxmpou4ameemnet s  Dtax  oo0tpx moeiysfm2eln p t0arxnio oydomDe n sls setmio nu1alt  ics s)s2ra(  nt4oexoiicils aDum(vont4arerifciy1laDeaueo;( srurxrpno1om nmneil(f 2ua(mooo1tpx iictyd a2um( s t4 eerio ia1lat luvs;s0sexr(m iu4llen netltf rtmurpot4tlxn feiadfa2rauvp t4arxrioctodfaD lu o;s trurio oodlp emfct sfsDtm(mo;o1tlx  fetys s2uauvs t)alerifcio1opt ln sl(  rumxm io4alte nci sfaDtm(  oo1olxoiiciys s emu p (4alxnxo ty1faD auesls  rxo(o io1opeelfvia( arrmxrono1texnmoeiat s umn s (4teerif iotlmDeluvo s0 2toxrpnodlptn ivsl(fsDumxr ot0tlxnmfcild m rmnmsnt4trxrif oa1fa r ues;s)tetr(r3nu4llt mivtat srurumono4apx mi3iydlaDel(vsnu)trenmociytoat  n o (  2xr(m3iu4ll n netat)s2umum oo1oeen ieiydfs umu s (0 ltnif3ia1lpt  nvs;t0texrim iydoltnmnvil( sDrmu pno0aetnmfeiyd m2umums t4alxrmocto1fmtraneol()truoio nydlmtelfvt s) 2umu oou0tpe mi3ild aDrlump u0aexoifcta1la   uvs;(0teumir3oy4ope micsls sDtmxm ;u4tetn i3iasfa2emuvo t)aexnxf3oatopt  nvilt)trxm(m3iy4lmtemnvi s)sDraurpnt4aexomoctyd a2emnvo;(0 lenir ia1omDrlu o;( texoirpoy1lpe lieslt a2uaum ;t1oleniieias m2elu o;t0 rxnmrctadfm   nvs;()seuoxopno1op e ncs s artrur ou0ope mi3tydls2eaums;u) ltrio3ia1fmt  ies;s0trxoxm3io4olenmfcils srtrxr nt1aet  oeiys mDuluvsn()arxnxr3oydomDe nei;s0sruoir3oudlpe mfei t) rtaump;t0oltniiciltfs umn p t0tltrio tytfpD aues (0 2tr(o3oy4lmt lnciat a2trxmpnt1oltomf3iytls2rmu snt4 rtrmf3totomt au o ( tetm(r ny1omt livi () 2rr(r ;u1apxo fetld a rauvs;t0 etrmrcoa1omD lu olt)s2xoirpiu1ll emncias) Dumxmp;o1alxnmietydlm elu onu)altrxo3oydomDrluvs;s trxrim oy4alenmnvil(f Dtrx o;u1oltniiciys a emumsn()aeermf oo1omtrlnvs;s0trxmxo no1opte neilsfaDrrum ;u1apxnmf3iadlm2rauvp u) renircoatla rauvo;(0 rum(r3nodaleelivtat sDum(moou0opxoiietlslm2rmnvo ()alxnxf io1fpD an o;s0 euoiopio1omen fcta() Dua(mpnt0tlxnmfetasfa2rlnvo ()alerxr3iy1fmt auei (0teurxr3io4lpte fvt (  2uru pnu0tet ii3tyd a rm(vo;u4 rxoio3oo1opDelneil(0 eurimpoo1lpe lnes s)sDtmump;t0aex ii3ils s ra( sn()tlenif ta1omtr ieo;( sexrxm nu4amee nesls sDumx poo4texo o3iyslm2rauvo (0 exnio3iy1fmt ai o t t2urimpiu4ol emfci (faDrm(mooo0opto o3iltfs rlnmon(0altomo3oatoaDrau o t)srxoim oo4lle lici ()srtm(r ot0alt mociad sDea( o;u0 reoio oa1fm ran o ( trumxr3iodomtemiei s aDtmumoou0openmo3ildfsDeanvsn(4 rerif3tatoaDrau o;(0sexoxm io4apenmnesat aDtmu p;o0tlx mi3iytfm2ua( p;()aexrxoctatla r u i;( seuoxmpiu1ape  ncta( aDraxm nu4oee ioctlsfm rmn s;u4alxnmoctatoaDe ieo;t0s2uo(m oudol emfetlt a2taxmpoo0teto f3tlt s uaump t0 eenxf todopDranei t) rur(m3iu1lmtemnctlt srrmuront4oeenii3tat mDrau snu4trenmo oa1fa   uvo;s0 rur(rpiu4olenlnvtls)srua(  ;u4optnifciyd s2emu s t4alenmr iatfa rauvi;s0 eumim3oo4ameelicsas)srrmur ot4aexoiieiysfm umn o t4trxrir3ta1fpDr n i ()t2uo(opiy4llenlnci sfsDua(m ;t4tet  ictydfs2emn o;()aetoiocoy1oaDrlu ol(0srum(r3oy1oleemfcsa(f Dum(mono1aeeo f3iat mDua(vpnu4 reoxr oy1optrauvi;s) etoirpnydole mnvsatfsrrru  ou0aex  oetys m2um(vpnt)tlxrxfcoatopt  ieolt) euo(o3iu4lme  fetas)arumurpnt4oet iociydfm2ra(vo;u4arenio3iodoat luvi s0srtmxopou1alt mfcs (fsrtaxrooo1alxnmoetas a ea(mont0 etnmr3ty1fpD aieo;t s2xmio oodolen fctlsfs2tmxrp;t0tpto octldfm2ranmpnt4trxnio3iodfm e nvsls  rtoim3iy1apt livilt) Dtaxmpnt4olxnmociysla2ulnmpnt0trtoio to1lpteau s t)srum(rpio1lp e nvtls) Drau p;t0texoio3tlslm2rlu p (4tetnxfcia1oaDr neo t)s2xoir3iu4amee icil(fsDtm(root4tpxnmfetatfs rmnvsnu)artomr3oytfa elieo t  2trim3iudlmeemnctltfs2umxmoot1olt  fcilsfm umnms u0aleoio oydfpDrln sl() rum(opnudoptelfesat a2trxro;o1texnioctytfsDrau sn(4 ltnio3io1fm  lnvi;s0 euoxm3oy1lpenlicilt srur(moou1tptoio3ilsfm2umuvsnt4 exomo iytfmD anei;()s2xo(r3nydapt  ncsa(f 2trxr ;t4ale  feildla2ul(ms (0 rxnxfciatoptr ivo t  exrirpoy4omtnmnvsa(f rrmumpou1tle if3ias aDranmo t0tlerxfcoodlat  ueo;s)trtrim3oydole mivsl(  rtm(m nt0aet  i3ilt s rl(vsn()tltoir3oatop rln s (0 2toio3nudlm   fcias srtr( ono4optnii3iatfsDul(mp t0 ltrmo oodla  lies s sruo(opiudomt  ici (  Dtrxmont0aeeoii3tytla2rmnvsnt4 lxrxr oatfmDrlu o t0t2xm(mpnydomt lfcsl() rumx poo4oetnmictlsfa2elnvpn(4teerxrcoytfm  lnvo t  2xm(r3iodlpt lfcs t)aDuaur ot1opeomfcias s raumsn(0 ltrxr3oadla  lu i;t0 ruriopiu1optemnvsas a2raumo;t1tltn o3iltlmDem(ms;t)tlxrir iy1fa ean olt srumim nudom  lfesls  rta(mpnu0apt mfetydls2umnmp;t0teerir ootomDeln o t)teuoxopiydomt micsl(fsDum( oot0apxn ietldfa umuvs u)texoif3tydfaDe neil(  eumxm3oy1op  lnvt t)sDtax o;t0alx ifcils sDemu pnu)aexnmfctotla r ivs;s trur(m iydlp emncsas  2rm(moou4oexomiciydfa ua(msnt)treomf tytfmtr ueolt)s2xoiopnu1amt mnvilt a2um(mpot4opx  fciys sDra(ms;u)altnir3oydlmDeln i;() 2tm(r3iodape mieiat arrmxront0oeenifeiatlsDemums;t0 exoiocoa1lat lu ols0 exmir no1ap elfvi tfaDtmxmo;t4aleomiciltlmDuaums;t0 ltomfciodlptran i t)tetm(r io4oltelfcs ()srtm(mo;u0tlxn ietysfa2umu p (4tltnio tydomDrlieslt0setrxrpiudapenmnet s)a2rmxrpot4alto iciatlaDumumont)texrirctodfptrlues (0 exm(o ou1ome  nvtltf rumx  ;t1aexo octlslsDum( p u4teeomo3tytomtrlues;t0 rxr(rpiy4lptn ivs t)s2urx o;u4tlx mf3ildlm2ul( s (4tltomrcia1lmt  nes s0 2uo(mpiy4opt lies (f rtax  ot1apt  fciatla ulumo;t0tltoxf oo1omt  uesl()t2tr(r3oodomtn nvi sfs2ua(mpnt1aleomietasfs2el(vp;(0 leoio iytlm r ivsls0seuoxr3ou4ol emfeils arurxro;o4olxnmoeiltfm ulums;(0 lerxo3ta1lmDean ilt) rurio oy4omenlncsl() rraur ;u0tlxo f3iasfs rauvpnt)tlxoir ia1opD luvi;(0srtrimpno1ale  fvslt srrr(r no1teen f3iytla ua(vp;u)aleomrcio1lm eanvs;()srtmir3iydalee nes t)aDrm( onu0tle moetysfa elumont) renxrcoa1faDr i i s0srur(o3no4lm  mfvi sf 2ur(ro;o4olx mieildfs2rauvs;t) lxnmf3iatop   ivo;s0 rxm(rpny1lpt mfvtas) 2taxmpou1aptomicildlm ran onu) lxnmr oodlpteaieslt)setmxopny4om  lnctasfs2taxro;o0apxo icildfmDel(vs (0trtnxo oa1faDr u i;s) rto(r3nu1omtn nvsas) rur( oot0tex iietlsfm2eanvp;(0aetrifcoy1oatrluei ( tetrimpnu1amenmivil(f rurx  ;o0tpx  ictytlm2uln p (0tetoif oatopteauvsls0seurxr oo4apeelnesa( artrumonu1opx ioctadfm2umu sn(4alenmfcoa1fm e n slt0setr(opnu1aleemicsas  rrrumo;u0ape iocilslmDua(vont4alerir iatfatrlueo;t0 rtoio oudomt  icsa() ruaxrpot0olx  feiydla ul(mo;t)artnio ia1fm   nei t0 eur(opou1ol nmfcsltfa2ua(r no0alx mfciaslmDeluvsn(0 rermr tytlm eai i;t t2uo(o nudalen ivs s)sDraxmoot4tlxnifeilslmDuaump;t4 eenmrcoatfa e i o;( t2uoxo iy4al emies s) rtaurono4oetoiieiadlmDraump;u0altrxo ia1fatelies s0texmxm3ny4alt miesl(fsDur(  ;t1ope mi3iyslm rlnvo t) lxnxf3ia1oa  lnvi t)t2uoir oudlmtemnesl(  rtmur nt1tltoii3ilt m rm( o;() lxoifcoo1lp e neil(0 rtmir3iu4aleemfvta(fsDrau oot1tet io3iyslm emnvont4 rermo3iotlp eanes s s2tmxm3io1ap n ies tfarrmu oou0tlxoio3tytfs2el(msn(0tlerir iatom  lu s t0t2tmxr no1amtnmictlt srumxmpnu4tetnmietyd m uan s;t)tetnif3tydfp rai sls) rxoimpoydlp   feia(fa2ur(rpot0olen i3ildla rmnvon(4teerxf iodlmt lneo t teumxrpoy1omt licsls)a2tax  ou1texn fctasfa uln onu0trerio3tydfm eai sls  exr(o3ny4lm n fvs () Dtmu onu4ape  fcils s ra(vpnt0trtnio todfpt  u sls tetr(o nu1oltelicsasfaDrmum ot0olxo o3iasfm emumon()tleomo to1lpt ln s (  2xo(opoy1ap nlneiat  2umxm nt4altomoeiytfm emu o t)teermocoadop elnvi s  2toxopiodlle  fcil() 2raxrpot1openio3tydfm emu onu0aexrmo to1lptrli s;(0srumim3oodomt  fci t) Dumx pnt0apenmieiltfsDranms;u)texoxrcoatfpt  uvil(0srtmxopoy4al nlfcias  rrmx oou0oexo f3iydfaDrmuvo;(4texoxf iadoa r n s s  rtmimpno1alenmfesl(f Drru o;o1aex  i3ils a ra(vpn(0 lenmr oadlmD  u i;s)t2urimpoy4oltnmies ()srurxrpot4aet mo3iysfa2elnvonu4areoio tadom rliei s trtrim oo4ame lfei tf Duaur ;o0olt iiciys aDeluvo;(4 leoio3iadlm r ieolt0 rxrimpio1ame lici sfaDrru pot0alt  f3iasfm uln s t4texnmf3tydoate uvil() rto(m3oy1ome  ict (fs2uru  oo0aeeniiciydls2ran on(0 lenmo iadfp rli i s  rtr(r3iy1olt mfetlt aDtr(m nt1alt iieiytlmDel(mo;u4 exoxo3oatfatean ols) eumxopoudapee fcsl( sDtauront1oetnmf3tatfmDrlnms (0trtnifctatfpDe neol( srtmirpnu1am nmict sf 2uau p;t0opxomi3iltlaDea(vo;u)aexnmo iadfmDraneo;t  2xrimpoodoptelict () Drr(r nu1tle  ieiadlm2raump t0 rxrxf tadoaD ln s;s)trtrio3iodlm elneiltf rua( o;u1aee mfeilsfmDranvsnt4 ltoxfcoy1fm r nvilt0sexoxr oodlp  mfvtasf rtmxront1apenifciydfs rl(mp;t0tltnmrciotop rluvolt truo(opnodam   nesatfsrta(m nu4aex iictadls rlumon()artrxo io1fa  aivol(0t2urir3ou1lle  ietl(f rua(roou0oeeoiocild mDrl(mo;()alxomocto1lmDrauesl()s2xm(r3iu1oltnlnei s)sDur( p;o1teenmfcias s emn pnt0 reomo3iytop elu s t)texm(o oo4al  mieta(  Dtm(rpot1teeo fctaslsDra( snt)trtrio oa1fp  lu i;s0 2xrxr3oo4op emfvslsf rtm(mpnt0apx  octlslsDel(vpn() rtoxr io1opDe nei s0t2xr(mpou4lm   fctlsf Drau  oo0tpx mieiltfm ulnmp u)aexnmo3to1oaDraivsls0texrirpou1lm emfcsl( arurxm ot1tlxniiciytls rmnms u)tlxnmf ty1opDe ivo;()t2xrirpno1amtn fei tfa2tax  nu0oltomi3iltfsDrau p t0 lerio3iotomD  ies () eur(m iodll n neiltf 2urxmont1tpen f3ild m2ea( p;() leomrcootfaDeluvs;t)s2xo(opou4am e iesa()srum(mo;t4optoii3tldfm2rauvonu0altnio3tydlaD  i s (0 rtoim nudom   ictlt)sDuau  ;o1alxnii3iasls2um( s t0 exoxo3to1fm eau ilt0 rtrxrpoy4oleemnvt tfaDtrx p;t4optomieiad s rmnvo;t0aexomo3iydfaDraneol(  etrim3oodalt mfvt s)a2tmurpou1tptnmicilsfs uauvonu4 exrxo3totlpD ai il(0trxr(opny4lptemneslsfartrum ;o0altomociatfm rl(vs t)aeeomr3iodomDe i i s0 2urirpoodlmtemncslsf 2rrum nt4oet ii3ias a el( pn()aeenir3ia1oaDr n ilt  2toxmpoodlm elicil( s2umur ;t0olxn fctydlmDran snt0altrmo ia1laDrlu s;t)trxr(o3no4lmtn ict t)srrmxrono0ope  iciydfa em( o;t) ltnifctodfmt  nes;s0trxr(r3oy4om elnctasf 2um(monu4altoii3ildfs2rlumpnt)tlermr oadlmDran i t0 etoim3iu1lptelict s a2urur ot0alt iicildla ra(mo;u4 lenmr tydlp e uvo t)sexo(r nu4ale mfctlsfs2tmxmonu0ape  i3iat a emnmpn(4 rtrir ty1fp  livs;()srxoir nydaptemivsltfarrmumooo1tlxomiciydfa2ulnvpnt)arxrmr3iy1fm rauvols teumir ou4lpe  iciat)a2trxmp;o4tlxo ieildfsDem( p;(0trxoifcoodfm r neilt  rtrxrpio4lptnmfcta(f Drr(rp;t1olx mfcilsfa emnmpnu0alerxr3iytfpDranvo;()t2uoxm oo4lmtnmfvi tfa2rrx o;o4tee  ictldlm umnmo;t0 rtrir3oodfa rliei;( srurim3no4altn fvtatfs2tmurooo1olxnmictltls2ul(monu)tlxrxo3ta1la r ivs;() rxm(o ou4lm nmivsatf 2ua(r ot0ape mfeiytfs um(vp;()trxoiociotlmte n o s)srtoxo3nudop nlfvi tfaDtmx pnt0olxn ocilsfa2eau s u4alxnxf3iytlpDr ivo;()truoirpno1lm   fetltfsrta( o;t1texoii3iltlaDemump;(4tltoioctadfmtrluvslt) eum(mpoydol emiesat  rurx ono0optn ieiadfsDraumpnu0alerifciotfa  aneols) exmxr ou4lmt mietls) 2taxronu4opt  fctat s2rln sn()tlerxf oadom rauvs (0t2tmio nu1lmt  nes s)sDuau ono0tlt ioctysfm el(vpn(0trtnxfciadlpD lnes;s0 2toiopoydalt  fcsat) rtau  ;t0tltomfetaslmDuauvp;u0artomo io1lmtrlueils0trto(o oo1oltelietl( a2ur( poo0aptnioetasla ul( pnt4 lenxo io1fatrlnvolt srtmimpoodom emivtlsfsDur(rpou0tltnmoeiasfa umn p;t4aexnio oa1la r uvsl(0 rtrir3oo4olen nvsls) rumx  ;t4aptniocildfs rauvo t)teenxrcoydlmDelnei s teum(mpoy1lptemieils)s2urx  ;t0teenmo3iysfs umn snu)arxnio3iodop r uei;()srxm(m no4amenlfvtas)a2uauroot4ape io3tytls2umnmo;u)alenxr3iodfpD  uvs;t  etriopio1omtn nvils) Dur(m ;t1tpe  f3iaslsDulumo (4alxrmoctotfpDranei;t tetoxrpnudome mieilt)srrm(mp;u1oleomictydla2emn s t4aexoxo oydfat  nei s)texm(r3io1om nlfcsa( a2rm(rpnu0tltoifetltlm emump t0artnmf3ia1fm eaieilt0truoim3iudap  livta() 2um(  ;u4aleomfeiat sDrmuvsnt4teerio ta1laDelnvi;s0 ruoim nu4aptnmfvtat aDtrump;t0aexomo3iytfsDea( ont4aeerxocoatlptrai i () rtoim ny1lme mnct s sDrru p;u4tpeomf3taslm2rln snt0tlxnmf oadopDrlnes t0teurxo ny4amt lfcia(f 2tmum ot1apeomo3iyt a2rm( s u0arxrmrciydfmtrai il( s2xoxrpiy1lm n fviasfa2uaumonu0aetnmieild aDrl(vp u) rtoio3ia1lpD ln i;s sexrxmpiudllenmictat)sDrrum ;t1tetoiiciyslmDulnmsn()alerxo3iodom  auei;(  etr(opnodlpenlfeia( srumxro;t4olxnmicild mDuaumonu)aeeoxfctotop eln o ( srur(rpnu1llee ictat)s2tmxm ot1tpeo ociydfaDrmums t0tltrxr io1laDe nvol(0 rxmir oydlm nlfvsls)s2rmumpnu1oleomfeiat m2um( pnu)trxrir iatopte n sl( trxrio3iy4ol nlici (f 2ta( oou4alto iciltlm2rm(vsnt4 rtoxr ootfa e uei t0 rxm(rpoo4amee iet (f 2rrxm nu0apt moetytla ua(vpn(0texrir iatoptrlueo s) eurirpiu1alt  ietls)sDua( p;t0alxn i3ilsla2ranvs u4tlerxo3oydomD ln o;(0teto(m3iudll emfesasfaDua(  ;o4alxn feiyslm rau onu4 exomo3iotlmD livsls0s2xrxopiu1lmtnlfvta()a2raumo;t4opx if3iyslmDrlnvs t4aexrmfcoy1fa rai il(0seto(o3iydlp n fctlsfaruau  ;t0teen fetldfm2umu o (0tlerio tytlp rlnes t)seuoir oo1lpenmfctl( srtrx pnt1tlt mo3tytfs2rln o t)tlxomo3oo1fm rlnes;t)teurxr3oo1lleemfei t aruaur ;u1optn o3ildfmDem( pn(4aetnxf3oa1fatelu sls) 2toirpiudllte fetatf 2trurp;o1oexn ocilt s ra(msnu0aeenif oodopt aivils0t2tmxo no1am elfetltf Dtrurpot4aptoifctlt s2ulnmp;t0tetomf3tatfpDeau o t)srumimpnodlmtemietlt a2tr(rpot4oeenifeiasla2elnmsnt)arxrxocio1op eluvsl(0trxoim3nydll nmfet (fs2tmumo;u1tetnmfeildfs2rl(vo t) rtomo iytfm ean ils)seuoxr io1amte fctl( s2uaumoou4optnmiciatlaDeanvsn(4 lxrmf tytfatr ies (  rxr(m3ny1llenlies s s2raxm oo4alen oetysfmDuauvp u0 reomo3ty1lm  li i t  2umir3oy4ape  ici (fs2rm(rono0tltn feilsfa2um(msn(0trerifcia1fp ranvi ( t2xr(m3iu1lm   nesl(faDtrxm ;o4texo ieiltfm2ran onu)trtnxo3iadlmtrlueol(0trur(rpiy4om emiviltfaDrrxm nu4ape  feildfa2rm( onu) rtriocia1latraies;t srto(m3oo4llenlivtlt arurxmono0ale mictlsfs um( o (0 lenmr3oydlmDelivs ( tetr(rpio4lm  mfct tfarurx pnu1aet  f3tld s rm( p;t)alxrxo oadomtranvs s)s2to(opnydlp  licsls s2trx  oo1apxoioctlt mDua( o (0 rxoxr3ty1lpDrlues;(  rumio3ny1op nlfctls  2ta(r ot1aeenmoetlt a elu s;t4tltrxf oo1om e n s t t2uo(rpoudomenlncsatf rtr(  ;t4oet mo3ildfm ulnvp (4 etrxf3oodlpDeaues () rxoxrpio1amtnlnvs s artmum nu1aexniictlt m2ulump ()tlxrxr oadoaDe u s;(0 rtr(m iodll   icia(fa2trx o;u4tpe iiciyd s ul( pn()tlenio3tatlmD  u olt)trtmiopiydomeelfvtat)aDum(  ou0tpt  i3ils aDemnvs;u0 rxnirciatoptrlnvs;t  euo(r3no4omtnmfviatfs2umxrp;t1oleoioeiasls ul(vsnu0aexnmo tadoaDelu sl(0 rumim iydalte iciat sDur(  ou0apenioetls m2emu pnt0 rxnxo iadfp e nvo s  rum(rpoy1alte nvsl(f rurur nt0tpt  ieild mDuanvs u)tetnmr ta1oat liei ()texr(opiu4apenlfcslsfsDrmumpot1openio3ilslsDeau o;()trxnxocoy1opt  ivols0 rtrxopny1oltemfesa() rtm(ront1tlxo ietadls2umn s;u4alxoxf3todop   uei s)s2trir3iy1ale mfvi (fs2tmu pnt0alt mi3iat s2ulu s t0aexrxocoytlp eanvo s0s2xrim nudoltelfeslt)arumxm ;o0aee iietad s uanms;u4tltomrctadopt luvs;t0sexm(o3ny4om nlfct sfartru ooo0aexnmo3tas a2uauvonu) eenirctytoat anvo;s0srurxrpny4omtelncsa(  2ururoot4apen ieiyd mDem(mo;(0 rtnxr totom eli olt  2toiopio4al emneiatfaDumx oot4texo o3iysfmDeanvsnu4 rxrir3ty1oaDean ols  2umim no1omtnlict (fs2tmuro;o0aptnmo3iytlaDuaums t4 rxrir iodlptrluvols)trxm(opoy4ol e iesltf Dra( onu1aex mfciltls2ua(mo;u)alxoio ta1opD auvi;(0trtmim3iy4apenlfei tfs2ur(mo;o1olen ictytfa ul( p;(4treoxo iy1la r uesls  eum(r nu4ame licsa(  ruax pou1tlt  fcildfs2rauvp u0 rtoifctotop   n o (0trxmxrpiu4optemnesa(fartru ont4aeenioeils sDuan p u0alenif3ia1laDeau s;s0sexo(o3io4lm  lfeils)srtmxm ;o0optomo3iysfs2rauvo ()artrmf3iodfaD livo;s0 rur(m oo4lptnmfvi s  rur( onu4aeto ietltlmDuauvo;u4texrxo iadfaDr n s t  eumir ny4lmt lfeslt) Dururono4oexnmfeiydfmDea(ms;u)artrir oa1fa  ln s (0teumio3nu1olenmivtlt s2tmxm ;t1teen oeiasla el(vp;u4tltnmo oytlmtran i s0sexrim3iudoltnlnetas srtrur nt0optnmocildfa umnmpn()teenxf3ia1la r nvi;t0tetoirpnudalt lnvs (fs2raurp;o4tetnifeiaslm rl(mp u4alxnmo3oodlaDr nes;t seurim no4ll n fviatfsrrmur no1ole  f3tldla2em( pnu) eenmr iotfp  au ols) 2xm(o iu4amen fetls arum(roou4apx  oeiltla2eaump;u4 etnxf3tytfm rlivs s) exrxrpny4ll  livsl(f 2ta(  ;o4tetomietydls rmuvsn()trxrif3ty1fa  aies () eumio3no1altn ivilt) 2ra( pnu1olx mociatla2elu p;(4 etnif ta1lmtrai s s0tetoio3oodape lfesasfsrrm(rooo4apt ifeilsls2ran p t)artrifcoodfptr n s;s  eumxr oydapeelfeslt  rumxrpou0apxoii3iaslm uln o;(4alxoxf iotlmte ivo s texrio no4op  liesl( aruaxr nt4alt ii3iltlmDem(mo;u4 exnio oadopDrauvsl()setm(opny1omee fvi sfa2raur ou0opt  ictasfa elu o u4aeerxo oodfp  au s t srxm(rpio1ap  mnetas) 2rrumo;t1ole mieiat aDrlumsn()tlerir3iy1lmDrai s;t)t2xrim nydop e fcsatfarrrx pno0aet miciadlmDuluvp u4 rtoxr3oadomt anvil(0s2xrir oo1amtnmfvt t  Drmxr oo0tpx  ieiatfa rmnmonu4trerir3iadopt  nei;s  2urxrpoudole lncslt aDum( p;t1oleomoctlsfs2rmums u) renif todfmD lneo s tetmxrpoodoptn nvtls arrmurp;t1olxniociatlmDem(vsn() etnxf3totlp  lnvi;( t2uoim iy1amt mnvsatf rtm( ooo0olen ieildfs2ulums;t0 lxrioctytomD aueo s tetmir3oo4al  mfet s)artr(  nu4tlen i3iydfsDemnvon(4texrmr tatopte nvs (  rtmxr3nu4lpenlfctas)a2urum nt4ope  fctyd sDumums;(4 ltrxr todla   ivslt) etr(o oy1lpt mfvtl(f rtau ono0ale  o3iltlmDumn o;(0areomoctytfpDe u o ( s2xm(o3oy1apenmfcia(f 2rr(r ;t4tlt mi3tysfaDel(ms;() lxnir3ty1optelu i;( teumio no1opee iei tf 2tm(r ou1olxo ieiys m2umn o t0trxomrciadopDe nvo;t0 rxm(o ny4lp elfviat a2trxm ot0tetnifeiad aDelnmp;u4 exoxf oytfpDeai i (0 2ur(r3oydomenmnci sfarrauroou0oeen fctldlsDemnms;t0 lxoxrctydom  aivi t)t2xoim nudlm elnesls  rrauroou0tlxomf3tldlm rlnmsnt)tlermocta1lat  u s;t texmxr3ou4alee fci t aDta(mpno4aee  oetltlmDuauvp;t)trtnmo3tytlpDr ueil()sexmio oo1omt lnvil(fsDua(rooo4aee  ieils m2rm( snt4aexrxf3iatlaDrlnesl( setoir nydomtelfcs ()s2rr(  ot4oltnif3iad s rl( s (4 ltniocio1fmDe ivol(0trumimpoy1ol nmnvtat) 2uaxmoot4apxo ictys mDeauvp t4 rerxrcoa1oa eaneo;s0 2ur(m nudomtnmfctls  Drr( onu4ope mictytfaDranmp;u4trxoxocoytopDeanes;() rxr(r iy4alenlivtas aruaurono0texnifeiaslaDuau o (0 etnxrcoo1lp  lnvs ( t2tmxopnudlm e ivtasf rtmxmooo1olxnmoetat s2emnms u4alxomf ta1lpt anes;s0setrxr3nudopenmfcsl( aDtmxro;o4oltomieiatfa2rluvs t)arerxf to1op   ueo t)truoir3iodlpee fesat a2rr(mpoo1alenmfeiys mDrlnms;() rerxo tadoa   i s (0teumimpou1opeelict tfaDtmumonu0tlt  ictaslmDranvo t4altnxo oodopt  n o;s srtrim io4amtnmnvtl( srtaxr nt1texn f3iasla el( p;u4texniocoadoaDrau o s0 rxrim no1ope  feiat)a2taump;o4tpxo oetadlaDulu p;t)areriocto1lp eauvo s0seum(r nodole mivs sfsDrrx  ou1teen octasfa2ulnmsnu4texrio iodlmteanvi ()sexm(opny4ap emncsl( sDuax oot0oex ioetld m2ea( p t0trtrxf tydopt lnvsls teumimpiu4lptnmfvsl( sDrmxmpoo0aetoioctatfa2ulnmpnu0texrio3iatoa ranvi;()teuoio oodoptelneiat sDrm(ro;u1oleoifciat m ul( onu0alerio oytfatrau o s  2ur(m nudll elivta() rtru  ot4oltn ociltfm2um( p (4teenif iytla  an o ( truoio oy4lle lietlsf 2tax ont4opeo ieiad m ulump t0 rtoifcio1fp  ln ils) exmxr no1ll  mfei t  2rm(mono1oexoif3tad mDumuvp u) rxoifciatlmtrli s (0 etmio ou1optelncs tf Dtru oou1teenioeild mDeanms ()aeerio3tadlp eaivo;s0trumxopny4lptelfvs ( artaxr ;u0tpx  ocild m2elnmpnt) exoxoctytlmDrlueo s0s2xoio iu4oltnlneil(f rtmu pnt4ape mf3iatfaDrau o;t0tlxnxo3oatoat  u o s0srxrxo io1lp n ictl(fsDua(mpnu0aeen ieilsfsDeluvpn() reomfcoadlpt livslt)s2uoir oodopeelfcil(fsrumurpoo1olxnii3iasfa ea(mp;t) ltrxr3totla   iesl(0 2toir3nydlmee nvsls)sDta(m ot4tlx ifeiad m umn s u0 eenmf3totfatr u ilt t2urxo oudame  iesatfs2rax o;t0tlto i3iydlmDrm(mpn(4tltomociotfat aies s s2trxr iu4ll n ncslt)sDtr(ront4oeeoifctaslm ulnmp () lxoxrctodlp e nvo;t) rxoim iu1am emfvtlt s2rm(rpno0oeeomietlslmDrl( p () etnmrcoy1opDelivsls  2xrir3iy4ll nlnciltfsrtaxr ot0oexnioeias m ranvon()trerif to1lm   u s;(0setoxm3oodopt lnvtls srtrx  nt0tle if3iydfm umn p;(4teeoxr oy1opDelneo;t texrir iu1llee fcil(faDrmxmo;o4aeen octldlmDuau s;u4 reomf3tatlaDr ies ( truoxopiu1omee fvs () 2ra( o;u0tleo oeiysfa rln on(0 ltrxr3ootlmt  uvsl(0teuoxr3oy4lle  iesas  Dur(mp;u4tlxoii3tldfaDelumo;t)trtriocootfmtr u o;t  etr(opio1lpeemivtatf 2rax oou0ole iiciyslm2umnmo;(0 etnmo3iytfa e uvo t  2umim3ny4al nmfvt tfa2trxroot1tetn fetas m rau onu4tetrmocoodoateauvs s  2ur(o oodlmt mivils  rur(mo;u4tleo i3tatfmDrlu s (0texnmo3oy1laDe ies s) ruoxm3oodlpte iesatfsDrr( pou0alenmoctad s2em( p;t4alenif tadfp elueilt)trtoxo iu1am  lneias  Draxrpno1alx mieiyslaDel( o u) rerif3oadfmD  u olt0truoim nu1lm e iesas)sDuaum ;o0texo i3tldfs ea(vsnt) leomocootlat anvi t0t2xm(m iy1lmt  nvs sfaDua(rooo0tptnif3ilt s el(vpn(4trtnmo3to1fpDe u ols s2to(opiodlmtn nvtatfsrrrumpot0texn f3iydfs2em(vo;t0 ltrxfcta1fmD li ils0 rxoxrpiu1omtnlfet t)a2rr(moou4oex mo3iys mDua(mpnu0tlxomr io1opDe uvslt trxrxm3ny4lltnmfetas) Duaxro;o4opxomi3ilsfsDeanvp u4trxrxf3totlmD ai i s0t2trxm3ny1ome  fvilsf Duaxm ;u4teeo fciytls2rmn pn()alxomr3oy1lp eaueils0srxm(r3nudoltnlnei s arurur nt0aeeomf3iyt m2umuvo;(0trtoxr iotfm ran i s0 exr(m ny4amenmncsltfsrtm(rpoo0aetnii3ilslaDeanvo;t) lxnxo3todop   i o;s srto(opiu4omte ici tfaDtaur nt0teen fetltfsDemn o u0 reomociadoatelnes t  euoir3oo1amen fvsa() Dtmx pot1ale  ieiaslsDeanmo t0 rxrxr3totlat ai o;s)s2tmxm iu4amtnmfcilt)aDum(  nt0tleoii3tlt sDelums;u4trxrmr3to1lp  ln i (0 2trim3iy1ol elieias)aDurxmo;o0tpto oetys aDumn pnt0tetnxociodla  lueo;(  2uoxopiu1lpte ici t arrrxrpnu1tlenmfctadfs ean s t4trermfcoytoa eanvi s) rtrirpiy4lltemfet t)a2ta(r ;o0tpx ii3ildlsDem(vp;t0trerio3oatop elnvilt0 rxrxm3iudol  micsas)s2tr( oou1ape io3tyslmDeanmon(4trxrmrcoadfmtr ies;(  2toxrpio4ol elfviltfaDtau poo0apt  ietldfa ua( pnu)tltniociytomDeai slt)t2xoio nu1omtelneils  2rmxrpot0aptoiieild m elumon(0altomf3tytlpt ai i;t0t2tmiopnudap e ivs ( srraxr ;u4olxo fciytls emn p t0 lermociydlp   iei t  2xmxr3nu4amt mfet (  ruau  no0olxn icilslaDrmnms;t)arxoif3iotlatrlivol( s2xo(o3iu1ap nlnvt (fs2ururonu1opxoifcildlaDuanvo u0trenxr3oy1omDrlu o;(0srxoxm iudlmt  fci (f rta( ooo4alto fciydlsDel( s (4 rxrxo3iatlp rlueil(0 rtoxm iodopeemfvsl()arumu oot1alt ii3tldlsDrauvo;u0alenif tytfmDraueils  rumxr oodomenmnvt s artm(m ou1optoifcias s2ean s;u)artoif iodlmDrlieo t)trumxmpoy4ame  iciat)arumu o;o0oee mietadls2el(ms;u0trxrirctytfm  aiesls)trxoxr3nydal  liciat s2urxr ot4opxnioeilslaDem(vs u) rxrxf ty1fa eln o t0sexmxr3oo1ap elnvs ()aDuax  oo1tpeo octyd a elnmo u) reoxocta1op eau ols) 2ur(r3oodaleemfvi t srtr(mo;o1optniiciadlm emnmonu)aeeoxo3oytlpt ai i s teumimpio1ale lietas sDurxrooo4oex  fciltla eau ont0 exnmr3iytlmtraivs t)t2xmim oodom elfeil() 2uaxrono4tltnmfctls aDelump;t4arxoifctydoat anvs;t) 2um(o3ny4apteliesas)arrau o;t0tlt  oeildls2ran pnu0alxnxr3tytla  liei s t2uo(m ny4al n nci sf rumxrooo1oeenifeildfsDean pnu4 rxomo3iodopD  ueol()t2xmim3oudlltnlncias)sDururpot1tex  ieiasfs ra(vs;() lxrmo3iotlmDelnvi t0seumxm ou1lmtnlfvil(  Drmumpnu1aetomieiys m ulu o;()tltoxf3iadoa elueolt)trumxrpiy4lpe  nvsltfarrr(mo;o0aeeo i3tad s ulu p u4tlerir3oydlm raneils trurxm nu4lpteliesat sDrmx oot0tpt iociatfmDuln snu)tlxnmrcta1laDrluei;t  exmxo nudole lfct t sDurxmo;o1ape mf3tat mDum( s t) eerxr3tatom eauvo s0truo(opoo1lleemnci tf 2rmxronu4tle iociydlmDra( o;t4 lxrio3iatlp rauvs;()s2xoxmpnodom  lfci s)a2rm( poo0tpxo ieiyt m rauvs (4aetnxoctytop e nvo;s)seum(m iy4lm  mictat  2taxr ;o0alen oeias a eauvo;() lxoxr tydfa elivo;()teur(mpiydll e ictl()aDrru oot4apxoiietysfaDemn p (0teermr3oo1optr n olt) 2tmir oodolt  ivilt aDrax  no1tpxoio3iytla2eaumonu0altnir3totfa r ivo t) 2xmxr oo4amtemietat s2rmur ;t0alx mieiadlsDeluvp;t)arermr3oydfpt ln o;s s2urxr ou4lp e feia(fs2raxrp;t1ope miciatfs rm(vs ()altrxoctytopt lnvs s  rtrio no1lme  fcs tfsrtaxroot4apenif3iadfs um(vo u0arxoif ia1oateau o;() ruoiopoy4am elict sf rur( ono0aexoifciasfsDuauvpnu0 etoxf tydfmt auei;s)texm(r3ny4aptnmfvslt) 2taxmpnt1ole if3tydfs umuvon()aeerif3oytlm raivs;t) eur(mpiy1llee iesls artrx p;o1alenioetlsfs2ul(vp;u4arermo ta1fa eaieilt0t2xm(mpio4aptn fcsls)s2trump;t1tle mfciytlaDrlnmp (0 rtriocoatomD  n i t)s2urxr3iydomte fciatf Dtau  no4tetnmoeiat s2rmnvsnu)texrmf3oo1fptrlivs;t)srumimpoo4omtemnvtl(  2um(  ot1tpxoifeiatfs2rl(mont0texrmociytomD  nvi;( setoxmpnu1lle lnctat srtauront4openiieiasla emuvsnt)tleoxf io1opDeauvo s)s2xrimpnydameelnvs s)arumu p;u1olx moctytfa ua( p;t0trxrir oodfp eluvo;()t2urxopoodope  nesatf 2rm(mp;o0openiictltfm ul( on(0tltoxfcty1lm  anes (0 rtoir3nodome lnct (fsDta( pno4tptomf3ilsfmDrm(ms u4alxoio iotomtrauvo ()srxo(rpiu4om emfviltf Duru  nu1alt  oeiytfm2rmump ()teerio3iotop e neils sexmim3no1lleelfctlt  rurum ;o4aexoio3iytfmDrmn p u4aleomfcto1fm  aues t teur(r io1ll nlivia( srur(m oo1tltnmo3ildla2rmn on(0texoir3ta1lpte u o;s trtmio nu1olte nct tfa2tau pou4ope ioeiasfa2ra(mpn(0tlermf ty1fp e ivil( s2ur(m3ou4op elncs (farua(  nt1apen iciytfs umu o u)artrif ta1lmDeln ils s2xrxmpoy1lmte ncslsf Dumxmooo1tpx mo3tydla ra( o;u0altoircto1lm eai sl()srxrxr3oo4llen icsl()arrmx  ou0tleomfciadfs rlu p t0alxrmo3todomtelu i;s)s2uoxm ou1ap n ivt t sDuaur ;t4aeeoio3iltls rm(mpn()tetnmf3iatlm   neol() 2tr(m3iy4lmeemivtasf ruaurpot1alen oeiysfm2rl(vs;u)arenmoctytopt livs;t0s2trio3iu4al eliet (f Dra(m ;t1olen fetytfm ra(mp;t0trxrxocio1oa   uvi;s0 rum(opny1ll   ncsatfaDrmxm ;t1oexnmfctltfmDrmn p u4 rxoifciytfm   uvi (  rtmxmpoodoptnliei s  Dururp;o1tlx ifeilt s rlump;t) rxnmoctotfaD aivs;s t2xmxo iudal   ivtas a2rau p;o4apenifctatls2elnms u)tleoxo ta1laDeauei t)teumxm oudlpee nei tfa2ur(  ot1texo iciltls2umuvo;t)trtrxrciodlp   uvi s) etmxm nu4apenlneslt) rrrxr ot1apeo ictlsla2uan p () etnxf iy1la  li ils)teumim3ou1lm nmfvt ()a2rrxmoou1oeen feiyt sDelu onu) etriocoytlpt li s t0trtrxm3io4om   net t)sDtr(mo;t4tpxn oetyt s2eluvont0aexrmr3io1lmDeaueilt  2tm(rpno4al n netls) Drmxmono0olx ioctasfa ea(vsn() exnxf ty1lmD livi;t)t2xmxr3iudal nlnctas)aDum(r nu1tleo fcildfmDumums (0arxoir oydfaD luvi;() exr(rpiydllenmnetl()sruaxrpou4tetnioetyslm2elnvp;t)arxnif3iodfm elneol( s2uo(m3io1aleelncsls)arta(ro;t1oltomiciltfmDulu s u)arxrio3oydfmDr uesls  ruriopnydomt  ivslsfsDtmuroou0tpeoiocilslmDum(vo;u4teerxf3oytlpD lies;t0srxmio ny4omenmfvias)sDrrum nt4tlxo ieiltfa umu p;(0texoif3tydlat  i il(  exr(m io4llee nesa(fa2tmx  ;t4opxnifetysfa rm( pnu)altrxrcoo1fmt aiei t0s2umio3oy4lleelict (faDtrxr oo1aeeomo3ilsfs ul( p;(4aetrxo io1opDrlieo t  2xrir oydlm  mivt s sDum(mooo4alx iicildfa rl(ms;u)arxrxr3oytla raneils  2umir oo4apte ivia(farrmumoou1olxo ieiytls rl(ms;t0altrio ta1oat anesls)teuoirpoy1oleemivtlsfsrrax oot0aeen oeiadlm2ul( snu)tlxrxr3tadfm e nvi t) exr(mpiu1ol elfvils)arum( o;u0apxnmoeias m uanvs u)tltoiocootfa   nesl(0srtmim3oo1ll n iesas) 2taum nu0tlen fciaslmDrlumo;() eerxr totopDe u sls)setmxrpiudalt lict s) Duru  nt0alxo oeiasfm2elnmsn(0 eenxocio1fpD lu olt sexmim3ny4op  mfes sfa2ur(ront1aet  ocilt s2rlu s u)teerxrcootfm e ueils)srumio iodlmt lncsas a2umx p;o1tltomfctasls2eauvpnt)aleoxf3iodfaD aneo;( srxo(o nu1lpt mnctltf Dtr(mo;o0oltomfeild s2ul( snu4 lxnxfciatfmtrai o;s0texmxr3nydllt  nei s)aDuau  no0tet iocild s em(mo;u)artrxocty1om rlnvsl( t2xoim3oodam e fesls aDtaxrpno1aeeo o3tydfs2ra( on(0arerif3oodlpDeanvilt0 rxr(o3iy4lmte ieias)s2rr( pot1tlt ifctadlm2eaumsnt4tetnxr iadfmD auvs t0srtm(m3oo4alenmivt ( sDtruronu4olt  feiysfsDulu p u)teermr iadom   ieols0trxoxrpnydll nmivia( aDuaum no0alt miciatla rm(mon()artnmf oytoptrlnvs;s srxo(m3nu1am emivi s a2umu  oo0oleoio3iysls ra( pnt)teeoif todfa elnei;s0 2tmxr3iu1lleemfctl(farta(ro;t4tee  ocildfs uanvsnt0 rtnmoctatop r neslt)tetmim3oydamte netatf ruaur
\ No newline at end of file
@@ -0,0 +1 @@
+nvs ( t2to(m3iodapee ics tf rta(mpnt4oex miciasfs um( o u4tetomrciodoaD  uesl( s2xriopno1am n fvsl()s2tr(moot1oee ii3iyd s rln o;(4 eerif ootomDeauvolt  rtoxm oy1omt  nct s sDua(  ot1tleoioctas a2uln snu4 etnir ia1oateaieil( trto(m iy1omenmnetls)srumxm ;u0aexn octyt a emnvs u)texnxf ta1lpDean ol() rtr(o3nudolenmfvil() rra(  nt4teenioeiysls rm(mp;u)tltnxf io1fp  aivi;t)t2umxm oo4lmee ict (  rtr( ont4olxnmfeiat s2eanvo;u4 ltnxf3ty1lpD  u s;t)t2trxm io4oltnmiet t srtrx poo1tpeo f3iadfs2rl(vo t4tetnio oodfmD aues;( s2xoxrpoudopen fei (f Durxrpou0ope ioeils a2el( s (0 rtomo ty1faD luvilt) eurio no1amt mfviat  Dtruronu4tpx ifctatfaDranmsnu0 reniocoo1fm r ueo;(0 rxm(m3ny4optnlfvtls aDrr( ont1opeoifeiysfm uln snu4tetnio3oydlpDe ivo ()tetrirpoo1am   iesatf 2raur ;o1teto iciasfs rlu o;()areomf3io1fmDraies t trtmxm3nu1apt mivia()aruaur ;t1apto ietas s uan p t)teermr iatlm elueol(0 2trxrpnu1altn fetls sDtr( o;o4texomfcias mDul(msn(0trerxrcoa1fa elnei;s sexr(o3no1om e nvsl( sDtrxronu4tlt mi3iysfaDulnvs;t0 ltrmo iy1fm rauei;t0 exr(rpio1omtnmfctl( sDtrump;o4olxo octaslm2rmump;()texrxf iodfaD aiesl()trurxr3nydoleelieia(fsrra(ronu4oeeo oeilt sDra( p;t0arxnifcootlp   u i;(0 2trxm3nodop nmictls aDrmu  ;u4aetnmf3iadfa rl(mo u0aetrmr3oo1om e u i t  rxoirpio1lptnmivs ( sDtmuro;o0tleoio3iyt a2uan s t4aetoxo3io1oaDe n ilt seumxm3io1open nvi sfa2tm(r ou0tpx mo3tldla ea(von()trxoifcoatlpDr uvi t srtoio oy4lptelneils)srra(mono4aeenmi3ilt aDrau p;u)alerir oa1opD an s;t0seum(o3nudamtnmieta(fsDumump;o4alxoifciltlsDuln s;u)tlxnxf3tydlp eai s;t) rum(r3iydlle  nesls  2rr(r nu0apeomf3iydfm eanvp t) leoioctydoptr ieo;t) 2xmimpiu1oltnmivt s) 2urumono1tltnifeiysfa2ua(monu0alenxrcoadlmt lues;t)t2xoxo3nu1omte ncilt)aDurxmooo4tee  fcilslmDulumo;t4 rxoxf oy1fmD lueo s sexmimpio4optnmictlt)srtmxmoot0opto i3iys aDem( pnu4treoxr3oytfatranvo;t0sexmxo3nu4ll nlies ()aDtmu pot4opto f3iltla2eau p;(4 rerxr tatlateauei t seuoxmpoo1ol nliet ()s2uaxmoou4apeo fciat s2umums (4aeermf3to1fpteli s;s0trto(rpoodlptn ivsasf rrr(  ;u1tee  oetydlm2uln s u4 eermo iotomDrli i;(0truoiopno1lmt lnvi s) Duru  ou1aetn o3ias m ra(vo;t0 eenio3tydlm e n i ( s2ur(o3oy1lm  lfvtat a2ur(r ;t0ale mi3tadfa rmuvs u0tlxrifcoy1oa ran s;t0setoxopoo4lp nmfeilt  2raumpou1oeenmfciatfmDemn p u0tltnifctotoa r ues s  eumxr oo1omenlivsa()s2trxmo;u0aex mfciatfa umumsn(4 lxoxocoatlaDr uesl(0 2tmxopoydaltnlnvsls srtmumoou1apxomf3iadla2ua(vsnt)arxoio3oatfmteli il(0 2tr(o oy4amtemnes (farrmx o;o4aptnmfctadfa rm(vpnt)alxnir oy1faDranvs;t0srtm(o3oy1am  lnes s)aDtrur ou4oetn ieiydfs2emuvon(0 lenxo3totlpDrluvo;(0srto(rpoo1lltn neia( artr( poo0oetn i3iadfsDum( p t0trtnxocoatlatrluvsls)s2xrxrpny1oltn nvtl( arta(rpoo4oet  oeiyd m2eanvs t4altrmrcoy1oaDraivils s2uoirpiu4llt lfvsl(fsDraump;o1tpe io3iltlm rm(vpnt4 reoif3oytfmDe uvil(  2uo(r iy1omtn ivs (fsDtaumpot0alx  iciat s2emu p (4 rxrxf todlmteanei;t t2xoirpnu4lle lfcils)a2rau o;o1oeto fciydfa ul(ms ()alxomo3iotfpDrai o t t2to(m oo1omtelfvs ()aDuax o;u1tex iociltfs2emuvsnu4 exrxo3oa1opD an ils s2ur(mpio4lmt mnes s) rraur oo0olxn ieiltfs uanvs (0 rxrxr tytfptran ils)seumxr no1ome lfcsl()a2tmxm ou1opxn i3tltlmDrau o u) ltoxrcoadlmtrlues s s2toio3iodapee ics ( s2urxro;t4aeeoii3iadfa uauvs u) etrxfciodla rluvs;t s2uo(o3oo1ame lnvtatfs2rm(ro;t4tlx mi3iydlsDum( sn(0texomrciy1fmtrluvo s)seur(mpno4lpe  nvi ( sDtmxmpno4tpe moeilt m uln o;u)aeenircoa1fmDraivs;()teuoxo3nodapt lnetasfa2umurp;o0aeenmfeiytlm umu o u)tlxrmr3tadfmte neilt texo(opiydlpe  fet t) Dtmumpnu4tlt  octlslsDran o u0 rtnxr3iatfmDrli s;s)t2xoir nudapt  ieta()srtrumono1tpx moeias m ea(vsn()trerifcoo1fat an olt t2umxm iodom emivi (fsrtmx p;o0apx ifcild s emnvpn()artoxf oydfp rlu sl( t2uo(o3ny1lm nmivt (faDtmx  nu4ole mfetltfm em(ms;u)altrmfcootlmD ai o;()s2um(o oo1op emfesls sDtm(rono1oeto ociyd mDuanvs t) rtnioctotfmD auvo s) rtr(r3ou4amt  ivsat srururonu0olxnio3tltfs2rmuvo ()aeenmo iytfmDr iei s trurir3ny1lme  icslsfsDtru ooo1tetniictls sDrlnvo;(0artnmr oodopDe uei;t) 2tr(r oudlm   nciasfsDurur ou1tlxnifciasla ran o t) etrxocia1latraivo (0 etmxrpoydal nmfes ( sDtax p;u4aptn i3tyslm2em(mp;()aetnxfcoydla ranvols) rur(m3nu1lmeelfes tfsrum( poo1alxnmf3iad a2rauvsn()arxoxr iytfaD ai ilt seuoxr iy4openlnvs (  2rrx o;t4alxnmieiadls2uau s;(4 leomrcootoaDe ues ( setoim3oy1ape lfeslsfs2tmxr ;u1texnmf3iasfm2rmuvpnt0artnmo3iy1lm  liei t  euoxr io4llte ivi (  2urxmonu0tlxnmfeildlm rln o;()arxomrcoadfmDr nvo;t) eumirpiu4omen nvtl(f rurumo;u0tltniictysfmDra(vo (4tltomo io1opD  nvilt0 etrxr iu1op nlictl(f 2tr(rp;u4aptoio3iytls um(vsnu)aetrxr totomtr n o t)setrxrpoy4lm emfvslt)s2urxmoot4aex micild m ul(vsn(4 rtnifciadomDeauvi;( t2urio iy4optelicia( a2raur nu0apt mfeiydlm2uauvpnu)trtrxocty1opD aueo;(0 2toxm nu1amtelicslt)sDrmum nu0oetnio3iaslsDrln onu4arxoifcoadfm e neo;t)s2toxr iydlm  mncsls)a2ra(rpnu1aptoiictldfsDemn o ()aexomfctydfa  lies s0setmxrpoydlp e fei s aDumu  no4altoii3tld sDuau o (4aeeoifcoy1fmDraiesl(  etm(o io1al n fvsa()srraur ;u1oexn fciatlaDeauvp (0aetrxf iadfmte i i;(0sruo(opou4aleemnvs tfsrtr(m nu1apeomociat m2rauvp;t4 etrmr ootom   nvo;t0trtmxr ou1op emnvsasfsDrmurpno0tle  o3iyslsDum(von(0tetrircoydfm e nvo s0srurxm3no4omtnlict ()aDrmxm oo0tleo oetlt sDrmnvp;u0 eeoiocoodlp  li s ( sexoxopnu4lm e iesas  2tauro;o4ope  feiatls2uanmont)texrmfcoydlp e ivi t0texoir3ou1aptelivslt s2umxronu0tlxomocildlmDrm(vo;(0tlxoifcoodfpt anvo (0seuoiopiydap e nctl() 2truro;u0aexoio3iyd m emnvp u) ltriocta1lp eaivs t0setoirpoy1amt mict ( a2umx onu4opxomietysla eauvsnt)artrmoctytom eauvi;s s2xmxo io4omt mnci t)srur(root0altoiociaslm uaumsnu)tltriocoydlm   n i ()teto(rpnu1lpenlfvta( srtmxm oo4tlxnmoeiys a2rmnmp;u4teermrciytoat  uvo;s  2ur(m ny1op e ivi t) Dtrx o;o4tlxo fciltlm umu s u0 ltrio oy1fmDrli i;s0texoxopoy4oltn ieil(faDraxmo;u0tetoiietysfaDemuvs u)texomo iadfm elu s s)s2uo(o3io4opee nvtl(fsDtaumo;o0ole  oeilt mDul( p;t0trtoio iydlp rlivs t)s2tmim3iy1lltnmnvia(fs2umu pnu0oetn octldls uln s t4 lermf iodomt  ieols)trum(o3nu4optnmfvtl( s2taxrpnt1tptnmiciadlaDea(ms (0tleoxr oa1faDeli olt0texmxmpnu1apen fei (  Dta(r ;o0oexnifetydls rl(mpn(0 rtnif ty1lat aivs t t2tmio no1ll  mfcs (f rumu onu0oetoiietlslm2emu ont0aeerxo oydfmte ueo (0teuoir3iy4lptnmictls)sDumxrpnt1aexn i3ildfa el( p;()arenxfctytopD  n o s0 rtr(r3ny1lme lfeilsfsDua(  nu0aeeomieiatfm ran o;u4arxomocoa1op e i i;()t2toxmpny4ame  fvi tf rrmum no0olxomfcilt mDea(ms;t) ltrxf iy1oat ai o s0 2xrim3no4ameemfctasf rua(m nu4olen octyd s emu snt4tetoxr3tytopt  neo (0 rtrxr iy4omte ivslsfsrumx pot0tltomoeiasfa umnms (4alxnmo3oatlpte iesl(0 rum(m iodamte ivias  Dtrumpnt0tpxo fciydlm umumpnu)tltrxf3io1oa raiei;s t2xoxmpnudapee nvsasfsDtmx ono0aeen oetld s2uln o t0 lxoircoodfmD  ieils) eto(r3no4al elfetlt)sDumu pnu4olx  o3ilsls2uanvon(4teermrciadopt  u o t) euo(rpiydoptemics ( srur( pou4tetniictat aDeanvo (0aexnif3oydoateanvil()texoxo3ny1ale mnvtat  Drmurp;u1oexn f3ils a ra(vsn(4 exrmfcoydlmDrlies;t0 exm(mpou1optemicslt  Dumxm nu1alx mociyt a2umnmpnt0 ltriociydfp r nvil(0setrir3io1lp nmfvilt) 2umxmo;u4alt io3iad m ul(vo;(4 reoxo oa1opDrlieslt srxrirpoo1amte fvia()arurum no4alxnmf3ild a2ra(ms (4 exnif3oy1lp e uvol() rtr(m3ou4ap  mneta() rrm(r ot0alt ii3ils s eln snu0altnmf iotomte u olt seumio3iu4alt  fcta()aDtaxmp;o0opt  oeiyslmDulnvo u4arxoif3todla e ues;s)sruoio3oodol e icsas aDrm(ro;u1oet iieilsls uanms t0 rerxr oo1omt li s s0 2umiopnudlpe  fcsls) rurxro;u4oexnif3ils a ranmo t)tlxnir tatlmtrai olt)s2xoxmpou1lpenmnctas)srtm(rp;o4tex mo3ilt aDemums t4arxoioctydopteaues () etrxmpio4amenlfvi s aruax  ou0alto octasfm2um( s t)artomociodom eln s;t)sexmiopoydamt mfei tfsDur(m ou4apx mfetlsla em(vo t4 lxnircia1lpDraies ()trtriopiu4om  mfvs t sruru  ;o0altniiciatlaDumn s;(4tleomo3totlm rai s () rtrxrpiy1lptnlies sfs2ua(rpoo1olto ieilsfaDeluvpnt0aleomrciatlmDe i olt)sruoxo oudop e nctl(f rumuroot0olx io3iytla um(ms;u) eenir iodlp  aies t tetrxo iydlltnlfetltfsrrm(mp;o1teenifeilt aDua( onu0 lxrxo3iadlpDrln slt s2xoirpoo4op emieil() rtaumonu0aet iociltfa2umnvo;t)artrmr3oadfm  lnvo (  2tmxm iodllenlfei t  2tau o;t4tptni
\ No newline at end of file
@@ -0,0 +1 @@
+ivols  rtrxr3oy4omee neil(f Drax p;t0opx  ieiydfmDean o;()tlxnif3ootoptr u o t srtrirpnu4lm  mneil(fs2rrumo;t0tlenifeiatfm2rm(vpn(4arenir oatfpt li ilt) eum(rpnydam   nvsls)arrmxm ou4tlxoioeiysfsDuln p u0 reoxrcoo1la   ueo;t  2xrxr3iodamtelnet s a2trumono1tlx  ictatlmDelnmp (0tltoxr ta1oaDr uvs (  eum(opou4lme mnet ()srtmu ooo1tptnmo3tydfm em( o t0 eenxr3ia1lpt aueo (0srtmim iu4ole  fes s) 2tmump;t4aptn octlsfs2umuvp ()aetoirciatlptr nesls0trto(o iydap  lietl( aDra(mo;u1tpt  octydlaDumuvo (0 leomocoatlatrai i;(  rxoimpny1ope mictlt) 2rm( pnu4aeeniicild s2ulump t)trerxr tatfmtrlieo t  exr(rpoo1alt  ivslt aDtau  ;t0tltomi3tadfm rlump;(4aexomf iodoptran sl( trtoxopnodllenmiviltfaDum(mono0apxnio3iatls2uaumo u4aexrmo3oo1fmDelies;(0seuoxopoo4lme  fvsasf 2tr(roou1optomoctls a eanmo;u) rxrmo oodfp rlivo;s srto(mpoo4am   ici t) rur(monu1openioctadls2rmn p;(4aeenmf iodom eli s;s0 euo(opoy1aptemfciat)sDumx pot1tptomo3iys mDrau o;(4alenir3oy1fp   uvsls setr(rpnodolenlnctatfs2taurp;u1teeniiciatfa ea(vs u) leomr3oa1fatrlnvsl(0 eumim3oy4omtn fetlsfarrax  nu0teeoif3tlsfa ean snt)trerio ty1fmDeln o s) rumio ou4lp   icsl()sDra(ro;u1tpeoiieiadla2eluvp t0altnxo3oydlp r uesls teurxmpiu4ape micsls srum(m ;o1tleo ieild m2eauvo t)treomfcoodfatranvo s) 2umir3ou1am  mnvi ()arrr(m ;t0tltnifciyslm rmumo;u0tlenio3todoaDraies t0sruriopno1ll elnvtl() rrrumpou1tlen icilsfs2uan p;t4trxoxo3ia1oaDeauvi s)sexrir3io1lmt mncsa(fa2ta(  ;o4olen ieildfa ranmont)alerifciydfp elu i;t s2umim3iu4op n feil(  2tau  ;o1aexnmfcilsfaDumnvs;u4 rtnxfctotoptean i;t0srtoirpnudlp nlivt s)arrrxm oo0oeeo oetlt s2ulnvp;u0aetnifciatlaDe neol()trumxrpiu1altnlfci (farrr( pnt4tpxomieiadfs2ea(vp;(0 lxnmf3oodfptrluvo;()tetr(opno4lp emiviatfsDtmxr ;u1tpxnmfeiadfm2ulnms (0tleomr3oytfmD li slt)texrxo3nudomeemnciltf 2rmxmpnu4tetnmfeild aDumu s;()tleoxr oydfpDeai slt) exmxopoy4op n ici t) 2um(  no1opxomoeias s eluvp t) exrifciadopD aivs s)srtoimpnu1lm emnvsat arum(m ;o1tltoiiciasls2raumsnt)tltrmf3oy1fpDraivo s) 2uoxr3no4lm e fvslt)srua( pou4tle  o3iytfm2umnvp (4tetomrciatfm  lnvo;()srxm(o3iudopeemnviasf rur(r ou4oee ioetasfaDua( onu0 rtrio tatlm   nvsl(0t2urxm iudlptnmfcs s) Dtaxr ;o1apen feiyt s rm(monu0 lxoio oodom r nei s0t2xrxrpoo1lp  mncslt) 2rmu o;u0apt  ietldls el(vsnu0aeeoirctodop ranes s s2xo(rpiodopte fcs ( aDurxm ;o1alxomociysfmDean p () eeomf iytlmDrlies;t texm(r no1amtnmfes (faruru o;u4tet mictys m rln p t4tlxnmf tadom e nvs s) exmxrpiu4om   ieiltfs2rm(r no4tpx ifcilsfm2elnvo t4 exrxf3iydfpDrli i;t) exo(mpnudamenlfcsasf rumx onu4tle iietytfs2rlnmsnt) rtnxr iadom  aueo s)texmimpno1ap n nct sfs2uaxmo;t0aptnio3iysfa eauvp t)trtrmociydoa r ieo s)t2um(o3io4alte fctl() rtaur ot4teeomoeiysfsDranmp u4alxnircoa1omt anvilt teuoxrpou4lp   nvt tfs2trxm oo4tetn icilsla emu s ()aexrmf ty1fmDran o s) etmxr3iydap nlics sfaDrrumono1tle mf3iys m umnvo;u)trxrif oa1omteli o ()t2ur(o3nudlm n fei sfs2tau o;u1apenmo3ils s ea(vp u) rxoxr3ta1omDe u i t0 2tmir no1al  lncsatf rtaurp;o4tpx  o3tatfmDrau p t4 rtriocoa1fa  au o ()seuo(r iydole  nesas a2ur(rpou0oetoiociatla rlu o u4arxomo3oatlate i i;t seuoxo3nodlpeemfcils)a2raum nt0tpx  fciyt s2ulu p;(4 eeoxf3io1lmD anvsls0srtrirpny4al n ivtls)s2rr( ooo1oexomfctysfm2eanmp;()aetnxoctodlatrau ol()t2ur(rpou4ole  nesl()aDrrum ;t1alx mf3iysfmDuau on()treniocoy1oatraivil()trxrirpiudapenmnetltfaruaxmpoo1oltnmf3tls a eanmo;t4tltnxf oytfmtraivsl() eur(r3nodopenlfcil( aruaxro;u1opx  iciytlm ea( p;(4treoioctytfateai ol()sexoxrpiudlmtelict s)s2rmurpou0optnmfciysfs rm( p;u0trxnif totfat au i t)texr(rpnydlmtnmnesls) Dumxmono1oexnmicilsfaDrlu o u0 lenmo oa1oat luvolt)seum(rpoy1amt lnct sfs2rmumo;u4ope mfctydls2rl(vs u0trtnxo iytfmDe uvi;t)texoiopnydameemneiltfsDtm(monu0alxn iciyt m rmu s u0 ltrif3oa1lat li s t)teuoxr3nudllte fvt s  Dtaump;o4olt  i3iytfa ranmpnu)altoif iatom  auvi ()trtrxopny1am  lnet s)a2tmu ont4texoio3iasfm2umnmp u0 lxnif3tytfa ran ols0trxm(o no4lptnlnct t  Drrxroot4aee if3tysfmDranmsn()alenxrcootoaDeauvi ( tetrxm3oy1lle mnvil(fa2ra(m oo0olt ifcilsls2umump u) lenmr oy1fmtranvi s)trurxm io4ap e ncils sDtmur ou0texnmf3tlslmDuluvo t0aetrxr3oa1lp r u ilt s2umxm iodoltelnetl( s2trx  ou0opxo fciatfsDeanmonu)treoio to1oaDelueils)setmim ou4amtemfcs ( s2tmxmpno4alt mociytlmDulnvonu0aeeoircoatopt  nvilt  exr(m3ny1lm   ici () Drmxm nu0aptomfciadfaDra(ms;t)teeoio3tatfmt luvslt)trxrxm3ny1om  mneias sDua(mont1oltomo3iadfs2rlums;t4texrir iydfmDr nvs s0seurimpiudaltemfetas)sDtmx pnt1opx ioetatla2rm( o;t)alenxo oodom rai o;(0seuoxm ny4om n fct sfsrururonu4aet  ictyd s2rlnvpnu4 rtnif3ty1oa raivs;s)t2um(rpio4op n ictls  rrrxr ;t4tlto f3iaslaDranmo;()aexnxf3oadopDranei;s teumxrpnudapt lnvtlsfsDrrxr nu4aee iictlsfaDuau p (4alenmfcootfmDrlueo t trtmiopio1llee ict s) rta( ont0aex mfeilslmDulump () rtnmf tatlpDeaivilt)srumio3oy4ap emfcslt)s2uru p;t1alxomietlsfm eanmsnt0 ltrif3iydfatraues s seurxo oy1lp  micsas)a2trxro;u1opxnifciytfsDuluvpnu)aexoiociy1lp  lieol(0texmxopoy1omtnlfcs sf rtrurono4openmi3tadlmDeaums;u4tlermo iy1op   uvi;s0trurxr3oo4am emieilsf Dum(monu4alt  o3iys a2el(mpnu)alermf3iytfptelnvsl(0 eto(o nydapen nvs () rtaumo;t0tleomfeiasfmDemu pn()treniocoa1op rauvils)t2xrxm nudlp  lnvsltfaDuax p;o0ale ioctytfaDemnmp u)aetnxf todoateau i t) 2to(o3oodom   ietlsfs2tauronu0olx mictlt sDuln p;t) etnir3iy1lmD aueil( s2xmiopoydlm nmnvs (  rrmxr nt0ope ii3tltlm emumsnt4treoir oo1fmt  nei s)setmio no4amtnmivs t sDua(r nt0olto o3tat mDeluvs;u)tetnmfctodoa  aivi s0srumxm no4al emivtas)srtrur ot0aptomoeiad s2em( o;u4aetnxfctadlp raivilt) exm(r oodome livtat) rtmxronu0tpenmfetasls2um(mpnu4alermr3iodlp rlueilt) eto(opoy4omee netasfaDum( poo4aleomf3ils a emn s;t4arxnifcoydlmteanesl(  eum(o3iodap e fcsa(f rur( onu4optomfeiytla2rln sn(4alxoxrctotop rlu s;t) etr(r3nu1om  lieilt  2trxmp;u4oltn f3iyt s emnmont4aeeomr3tytfpD ai ils t2umxr3iy4apee iesasf Duaumpno1oetnmocild s2rlu s;u)aexnxocoodfaDrau o;t)truoxo3oy1amenmiei ()sDtm(rp;u4tpenmf3iltfs emump ()trtoir3io1latelivo t0 2umxo oy1omenmneia(  rraxro;u4ale ioeiasfmDelnms ()aeerxr3tadoa r ieo t srumxr3nodlle licta() rumump;o0tpxnio3iat sDranvp t) rtrxo3oydfat luei;s0 2uo(o iodomt  nvi sfaDrmump;o1tptn f3tyd m2ra(mo u0arxoio iatomtr n s ()teumim3ou4ol nlnci (  Dua(roou0opxo f3iltla uaumsnt4 eerif3iatlptr n s ()trtmirpnudol   nes ()arumxmo;t4aee moeildlmDrmuvsnt) lxnmr oytfmDr n i;t  etr(opoo1llenmnetlt  2urx  nt1opto fctyt aDumu p;(4 lxnxfctytoa eli o;s0 etm(r no4lltelncslt) Dumu onu0opxnio3ilt a2emump;u4alerio3tatop rlivi s) rurir oudlmenmicsl()srraumpoo4opxomictlslmDemuvonu0 rtnir ia1opt luvs ()t2xr(mpou1alte fcta( sDtauro;u4apxnmociat a umuvon(0trxomr3iatlaD  ivo t  2uo(mpoudlmee ivi sfaDua( oou4aex  oetld mDra(vs u) rtrxo3iytfaD luei;s0seurio oodlp  miesat aDrmuroou1optoioctls sDea(von()aexoxr3iydopteau o ()s2uoim3ou1oleemieta( sDtrx pnt1oetomociys aDrmuvp;t0 etomo io1opte nvs t) exr(o3oydomt  ncias  2urxronu0olenifetlt a2el(mp ()aetrmr oytlmDeaivol()s2um(opoy1ol  lfcia(fsDur(mp;t1opx iictatla ea(mp (4 reoio3oadoaDelnvil()trtrio3oydoltemnesls)aDrr( p;t0tlxomfcils mDelnvp;t0trtrmoctydlmD  ueo;() exr(opnu1amtemnvias srtaxmont0apeo ietls m2emnvp;(4teerifcia1oateanvs t0tetr(o3oy1ale mict (fsrur(root4aee  ociatlmDea(vonu4tleoxf3totlaDeauvsl() euoxm3oy1open ictlt  2uax  no1opxoio3iydfaDra(vont) reoxo3iatfmtr u s;t tetr(o no1opt lictat  Dur(ro;t4tleoiocildfa2rmnvs () exnmocio1fmte neo;t  ruo(opiy1apenmivil(fsrta(m ;u1oeen i3iasls umn s;t0altnmrctadop r n o ( s2xo(m3nydll nmieils)sDtru pno4tpxo iciad sDra( sn()texomo3iodomDrluei;(0trxoio oydol emnet s)a2raxrono1apto o3ilsfs2eluvont)aexoxo to1lp  luvo;s0 rur(r3ou1opeeliesat s2uax ono0tpto o3iadfs umnvp;t) rtrxf3tydom  anvi t  2trir3iy1lpenmfes ( srua(  no0oet ifcilsfm2uauvs (4 rerir3tadom r nesls t2to(r3iy1omtemiei tfaruru pou0apxo oetat a el( s;u4 rtoxf oa1lm  anvs (0 etrxo io1lm nmivtls)a2tax  nt0tpenifeild m2uauvp;(4 exoxocoodlat luei;s trxo(o3io1omenlfvta()s2trx p;t1opto ietldfs2emuvp;t4 lxnif oydlp e nei (0t2xrxr oy4amt lfcs t) rrmurp;u1olto fciaslm rln s u)trxoxr3tadlp e i ils)texmxr3iy1ale lnctatfa2rmuro;t4apenmfctadlaDul( pn(0tlxrxr3oa1oatrlnvs s) exoir iudllenlicsls  2umu o;u4tetoioetlsfm2rm(vo u0alenmr oa1lat anvilt teurim3ou4lp nmnvtlt  Dtmxr nt0ale iieiad s ul(vs;u)tleoxf3oo1lptranes;(0s2tmir3oudam n ics ( sDrm(  ;u4apxnmo3iad sDulnvpnt)trtoif3tatfmte u s;()texoxrpoydlp emfvsas) 2umur ;t1tpen i3ils s2rlumpn()aexrxr oydop elu i (  rtoimpny1lmeemietlt aDtr(rpnu1texniiciaslsDraumpnu4trerxr tadom  lieo t)sexr(opiydolt lfetls arrr( pou1tpen ociat mDrmnvont0artnir todoaDrlu sls) 2umimpiudopenlnes s aDururo;o4tlxomfciytlm2umu p u0aexnmf3tytomtranes;() 2xm(opiodlm emnetasfaruaur no0tpx iociltla2emnvp;t0arxoxf oytlateluvs;t)trtoxrpnu1ap  mieia(fs2ta(rp;o1tet mo3ildla rlu snu0treomf totfmteluesls0s2urio3iu4lpe lfetat aDtrum ;o4opeomocilslm uln s t4 leomociydomDrlu i;s)t2toxm iu4lmtemfvsl( aDtmurpot0aptnmocils s rmump;t) lenmf3iadfp e uesl( s2tmiopoudoptnmict ()a2tax oou4apx io3tysls emnvonu0tetnmociytomt  u s ()seuo(r3no1aptnlncs s arua( ont4olen o3iytla rau pnt0teeomrcty1optr uvsl(0t2toxr3oo1op elfvsl(f Drm( pou1tle ioeilslaDelu snt0altrxrcoatlmD lnvi t  exoxo3oy4om e nes s aDrr(r ot1tpxo fciat sDua(mp (4altnif3tadfat  u o;()trtoxm iu4lle  ici (  Duax p;u1oexoiictatfs uau s;() etoiociytlpt lneslt)t2xo(r3oudll emfvtl(  Drm( p;t4tee  oeiysfmDea( snu0arxomf3tadoaD ai slt0seumir iu4amen ieil( sDumxmono1altomf3iasla rmnvpn(0arerir todfpD lueo;s  2xr(opnodllen fesatfaDrauronu1oltn feiatfs rm( p () lenmo3tadfmDeluvils  rxoxmpnudaptn fes t)srtmumo;t1alenmfeiad mDel(ms u)aexnxrciydom rlu o s0trtoxm3ny1lltn ivtls)s2rmxmoou0aetoif3iltlmDrmnvsnt4alenifcoodlmt lnes t) 2urir3oo1lmeelfcil()artmxro;t1oetnmo3ildfs ulu p;() eeoxr iatfate ueols) rtm(mpoydamen ieslsfsrtmur nu1tlxniociyd a ua( s;u)texnmfciatfpDrau o s  rxoim oo1ol nlict s aDurumono1olenif3iytfa2rl( o ()arenxrcoo1lp r ieslt srxoio3oy1llen fcsa( sDua(r nt4altoif3tlsla eaumo;u)alenxf3ty1lmD luvs;(  2urxo3oo4olee ici t  rtm(mpno4tpenmoetyt aDrmnmo t0alerxo3ootlm rluei s)s2xrxm3iy1am nlict tf rtrurooo0oeeo o3ils a rm( pnu4teenxocto1lpDrlneil( s2to(r3no4olt  ivsat arurxmpoo4olt ioeild s umu p u4arxniocootlmtrlueo;(0 rtrxr nydaleemncsatfa2tax poo4teeo fctyslm2eln p;u0aetoir3oatoaD  nvolt0 eumxopnodopen net sfsDuaxrpot0alx  ocildfm eluvpnu0aetomr3ty1lpte iei;s  rtrxr io4olt  iciat)s2tax  nt0apto oeiat a rau o t0tltnmfcoatlpD  ivo;s) 2xoimpoydolt mfcil(  rurxm ou4tlt  fctld m2rmnmo;(0arxrif oydlatrlueslt  rxriopou1op  lfcias)artrxmo;t1oet mf3tatfs umnvo t0 renmocoa1fmDeaneo;t)tetmirpny1opee fcsl(f 2urumpoo0oet mo3iltla ua(monu0aetrxrctadoaDelivols) exm(opiudomen nvtls)sDtmu oot1aet  i3iytfsDrmnvonu)texnxf3ia1fat lneo s0t2uoir3ou4lpen fvta(fs2taxm ou1tptnmoeiadfsDrmuvp u)trtoif iotlmtrauei t)sruoxo3iu4ome  iviatfsrtaxr ;u1aee ifetydfaDelnms;t)aexnmf3oatfmtelu o t) rtr(r3iu4lmen ivsls)arua(ront4tltnmoeias a2uan p;() etnxfctotfa eauvi;( texmxm3ny4lleelfesls) Dur(rp;t4opxnii3ilslmDrmnvs;(4areomf3tydla ranvi;t s2xoio3oodll n fvia()aDum(monu1opxnmf3iadfsDeln pnu)aetnmo oo1la e n ilt)sexriopio4lmtelnesas)a2rmx oot0tpen feiasls2raumpn()trxoxocia1fmt ln o s) rur(opny4aptnmictlt) 2tmx ooo0olto fciysla ran o u) ltnxrciodomt anvs;(0trurxm3ny4alee ncsl() 2taum ;o0tpt mfcildfs rln s (4trxrmr3oadoatrlnvo;s0srtrim oo4ol e nei tfsrtm(rono0oeen iciadfsDuluvonu0 rerir3ta1fm r uei t)teur(m3no1lm nlfci t) 2ta(mpnt1oetoiictltlm2ulu ont4arxrir iy1fp rauvol() 2um(r iy1alte fvt ( s2trx  nu4tptoiociatfaDul(mp;(4trxrxo3ootomtr i i ( s2xoiopoydomtn ncsatfaDrrxr ;u4aexnmf3tatla ranmon(4arxoxr oa1lp  aivi t)srxrir iy4ap emfvilt)arraxrpou0alxn o3tadfs2rl( p;t0texnmr3todlpt  i sls0trxoxo3oydam nmicilt a2rm(mo;t0apt iictlslm2um(vont)arxoir tadoate u sl()seur(m3iodolee fct ()a2ta(rono1tptn iciatfa rln pn()tlerirciatom ran i s0 2xoxopno1olee fet s) Draum ;u0olenmocilt a el(vo t)aeenmf3oo1omt anvils0tetmirpiodlleemicsls)aDta( o;u0altoif3iltfmDel(vs;(4 exoxr oatlm elueo ( s2xoim3iy1alee fvilt)srur(rp;t4ole mo3iasla2el( s (0artrirciy1omD aies;t) 2um(m3iy1oltn ncsa() rrmx pno1opxn o3tyt a2raumo u0 eeoxr ta1oa elu o;( s2xmir io1alen fvsas)sDrrxr ot4ope  oetasfa2umnmp;(4tlxoxr3oytoptraneo;(  exmir ou1al emneils  2rru p;o1tptniociatlsDranmsn(4 leoxr tatlpDrli i ()setriopnu4omtelfcslsfaDumu  oo4oex mictas aDeauvp;t) rxnmf totoa eau o t) rtmir nudlptnmncias sDrrxmpot4ope mieiltfsDua( o u0teeoif oatopDeai ils truoio3io1apeelfciltfa2rm(r ;u4aetnmictydfsDrmnmsnt4trtoif oa1fmD  uvilt) 2tm(opoodlm  mnvtl(f Drr(rooo0oeen fciysfa umums u0arxnmr3todom ean i;s0t2xrxo3iydapenlfetl(f 2rr(r ot4tex mieilsls rau p;u4artrmo3oodfatrlneols0setoxo3oydaptn fcsatfsDtm( ooo4ole  ieiltlm ran o;(4tlenmoctotomteaneils s2xoxo iudlpen ieiasfsrumu o;t0alx mf3iydfmDrm(vpnt4aetomf3iy1oa   ueil(0texrxo3ny1lp   fvta(fa2rr(root1tpx  octld a emu ont) lxoif3oy1la eli s ()srtmiopiodam e feslsfsrua( ont4tltn feiadfsDumu o;(4areoioctydlaDeauvi;t  eur(o nudam n fesas aDur(mp;t0aeeoifctls mDuauvp u)trtrxr3oytlat luesl() etoir ny4lp emnesatf 2tru  ou4ope  o3tlt m emu s;(4tetomr3ty1om rln i t  eto(r oy4ope lnciltfaDumxm ou4oet miciltfmDraumo t)arxrif3todlateanvs (0srxoxm oo4alenmnetat srtm(  ot0texoiociltfa rl(mp (0aexomo iy1omDeai o;t srtmio3oodllenmfcsa(fartau pnu4aeto oetlslm2elnvo u4tleoxf oo1oaDeluvo ()texrxmpiy1llee net s s2um( oou4optomf3tldfm2elumo t)aeenxr iy1laDeaivsls trtm(mpoy1olee nvi tfs2umxmp;t4oet miciyt s rauvsnt)aeenmfciadfmDe nei;s setmiopiy4openliei t) rrax  ot1aet iieiadfs2ul( o (0trtnxfciodop rlieol(0t2toxm no4al  miet (fs2tr( oot1tpe mietad a elu o;u0areomf iytom rai s;(0 exrxr3oodlltnmfcsas  2uax p;o1tptomoeiys mDean o t0 rtnmfcoatla elivslt0 2umxr iodom e fcsa() rumumono0oleomf3iadfs ean o u) etnir iodfm e u s;t0 2xm(rpio1opeelnvsa()a2um( oou1oee  f3iat a2eanvp;u)tetomr3iy1omDr u i;t0tetm(m oy4ome mnviat) Dtrurp;t0apxn o3iad mDemump;u)altoxf totomt  nvs;s  rum(rpiy1ame lnvt ()a2rm(moot4alxn o3tadfsDul(msn(0areriocoa1fp elneslt0t2toxr ou4op   ivs tf rrr(moot0oex  ociltfa2uaumpnt0 etnmo iy1fp r ivo;s)t2uo(rpou4ap e fet (f Drrumoou1oexoiicildlm2rl( o;(0alenmo3ta1lmDe i s;s0s2xoxm3io4openmicilt)sDtau oot0opxomiciadfs elump t4arenmrctatfpD an o () etriopoydalt mnvi s) 2rm(r ;t1tpxoif3tlt a2rau o t0alxrxrctadfptrlu i ( t2xmxmpoudlp emnviltfsrtrum ;o4olx moeilt m2uluvo t4tlerxf3iydlmtelueo s) 2xmxr nu4al   neilt  2uaurpoo4opxnioctysfsDuau o t0arxrir3iytom r nvo;s)texoxo iudlme  nctas)a2trur nt1teenmoeiaslm2rmuvo t4alenif iatlptrau s;s0srxm(m3ou1lpenlfeil()s2rrx poo0alenmfcils mDrl(msnt4artnmo3ootfmte i i (0setoio3oo4lpe livia( srtr(  ;o0opxn fetatls2rlnvo ()tetnxr totfmtean i s)tetm(m3ou4op  lfct ()aDuaurpou1tex  i3ilt a2rlu snt4 ltnmo3io1omDe nvo;s0t2xm(r ou1altemicsls  2tmumono4opt  ieiltfaDumump u4 lxnxoctydlm raies () 2tr(o nu1op nlfctlt)aDumxmo;t1tlt if3tys s2rm( onu4trtoxr3iy1omtelnei t)s2xmxrpoodam elnvtas)sDuaxr ;o1apt mf3iys m ranms u0trtoxo oo1fmDraueo;t0teumim3ny1altn feta(farurxmo;u1teenmo3tatls rlu o;t4 exrif iydfm e nvi s trtrirpnudaptn nvi t aDur(  ot4oex  o3tatla umnvsnu) etoio3ta1lptrlnei ()setoirpnu1alee icsl( a2rr(roou4oltnmi3tldfaDeanmp;t4tetoif ta1lpt lneilt s2ur(r3ou1lmee netlsfarrau  ;u0oexoiictyt m rl(vp (4trtrxociodoaDe i i;s0truo(opoy1alt lnesat)arrax  ;t1texn fctys mDemn o () exomo iatfaD lues ()trtoxr3iydlpt mnvsls)s2taxr ;o1tltomociys s ua(mpnt4 rxnirctatomt au ilt)texm(r io1omen fvs sfa2taxm ot0tpxnif3tysfa rmnmp u4tleomf3oodfa   uvolt) etoimpiodap nlnesls) rua( ono1alxnifeias m ua(vont)arxnxo3tydlpt aivols0t2xmir3io1lm nmfvi ( srtmuro;t1optoiictasfaDrl( s u0tlxrmo tytopD livol(  2trxrpoo4lm elfvt tf Duau pno1tleo i3iltlm2el(vpn(0 rxrifciodfa r ivi s)s2xoxrpoy1omen fciltfs2ua(rpnu1tlt moctldls2rluvp;u) renio to1laD aues (  2xo(r oo4ameelfes t)a2tm(m ou1ope mo3ild a2elnmp u4 rtrmr tytfp eaueo;t)srxrxr3iy4lpe micsas a2uaum ;u4olxoifeiyt m ranmo;u0aetrir3tatlateau i;s  2uoxopiy4lle mieia(fs2ururp;u0optn o3iys aDumu snu4teenxo to1faDr nvs;s texr(m nodll  mfctas aDtru  ;u1apen oeilt a2um( pnu)tltrif3io1oa  lieils setmxo3io1lmtnmictlsf 2raumooo4oeeomo3tldfm2emnvsnt4 ltrmo3ia1lp elneo;() rxr(m oydlm   fcsas)srrrx o;t1open fcilsla2rmumo;()arenmocoo1la elivil()seur(m3io4llee fvi ( arurxm ot0alxn oetlsfmDua(mp;()trtomr3oa1lmte u o t0t2uoxo iu1amenmivi tfaruaxro;u0tpen iciatfs raumo;() lxoir iy1la r uei (  exriopoo1lm elivtls)sruaump;o4optnif3iltfsDumumsnu0 leoio3todoaDr uvslt)trtrim3no4omtnlfctlt  Durxr oo1apxnmoeiadfa rlnmsn(0 rtrxfciatfpDe ivi;t0 exmiopou1ameelfcsas) Drm(moot0oeeoiieiydlsDrauvpnu) ltoiocto1faDr uvs;(0srurxm3iy1ll  mnetasfarrrxmooo1tlxo oeias a2ea(mo t0alxrmrcoo1optrlu il(0texmim nu4ale  feia(fsDuaxmp;u4apeoif3ildfm rl( p;(4 lenif3to1oateauvol(  ruoxo iudlpen fctlsfarurx ono4ope iietat m emuvpnt)trtnxr oydlatraivs;t t2urxopiu4altemnviasf 2taumo;u4oeto fctadfm emump;t0aleoxr iydom  anvi;( t2umxmpiu1am e nvtl() Dur(mo;u1aetn o3iysfm2em(ms t0altrxr iotop rlieols) eumio oodaltelfcslt aDumumpnu1tptn fcils sDemn p;u4teerxr iy1om  ai i;(0teumxo iodaptemfvil( a2tm(  nu1oetniieiasfm2ea(msn(0aetrxoctadopDrlnei t  2xr(r oo4op e ncslt sDrr( p;t4tptn feiadfa rmuvp u0 ltrxf iytfaDelueols0s2toim ny4alt livs t sDrrxrooo4olxnmieiadlsDem( pn(0aeeomrciatopD  n ils)s2xo(opnu4omee nviat)aDua( pot0apeoifciydfm rauvs;(4aetomr3iatoatean ils0srumim oy4apeelncilsfaDtaurpnt4apxnmoeilt mDemnmsnt4 reoirctatla e ues s0 euo(m iydoltnmfcsls a2rmu o;t1oexn octyslaDulnms t) eeomocoatlpD aueolt) euoxr3ou4op nmicsls) rtm(rono4ope  fcilsla2ua(vpnu0 lxnxf3iatop eli o s s2xmxr3nu1lmeemneil(  2rr(rooo4olen ocildlm2umn pnt4arenmr3iydlpDrlu s;(0 2uoio nu4ap nmfcias)arurumpno4olto ociyd mDrmu o;t0 eerircoa1lm  aieo;() rum(o nu1am n fvtls) Duaur ;u4tet mfeiyt m2uan s () ltrmr tadoatrlivi ()truo(r nu1llt mfvi (faruax  ;t4aex iocild mDemu on() rxoioctadfatelueo ( setrio3nudolt lnvs t)s2rau oou1aet  fetydlm eanmon(4texnmr3tatfm  livi;t s2xmxopiu1am emncs s aDumumooo0tpx mfctatls rm(ms;u4aetrxociadfmDraieo ( teur(r3oodaltnmivs tfaDtrurpoo1apxomfciyslaDeln pn()trxnio3tydlm eln o;()texoim3no4lpt lnvil(  2trumpnt4aex miciyd m2emu p;(0tltrif iydfpteanvo;t0srxr(m no1ole  nvia( aDtrx pno4oetomicild m raump;(4arxniociadfp ran ilt  rum(m ny4optnmfviat) rtrxmonu0apto ietyd a2elump;u4teermo3io1fm   neo;(0 eum(opoo1optnlfvi ( srrru o;o1tptnif3iyd s um( ont0aeermr iodopt  ivols)trxo(m3ny1om   icsl(f Dtrxrpnu4tltoii3ildfm2uanvs;t0tlxoxf3iydfm e ueo () 2trir io4lmenlnvi s arrruront4tetn ieiyslmDrmnvsnu)tetnxr3oodfaD  uvi;s)trtm(m iodlm nmnvsatfsDumxmpot4ale mictas mDum( p t0 etrxf oadlpDelivi;()trtrirpnudomenlies ( srtaur ;u4tlxnmoeias aDrlnmsnu0aetoxociatfmDrlues t)texmxm3ou1opte neil(f Dtmu  no4ole ifctysfs2rmn on(0aleoif3ia1fat livo ( trxoxr ou4omeelnvslt)srtrxmooo1tlx mi3tatla uau p u0aeenio3iy1om r uvilt) eumim3iydame mnvtat) rta(m nt1altnif3iytlaDrau o;t)tetnmr3oa1laDeau slt) eto(m iodoltemnciltfa2tm( o;t0openmfetytla em(mo t4 exomfctatoa eaueslt0s2umimpio1al   ictls)artaxr ;t1oee ioeiytfm2rl(ms;t4 rtomf3tadoaD auvs t0s2tmirpny1optnlnvs t) Dra(rooo1alxnifetyt mDeanmpnu)alxomr iydom ranes ( sexmim iodlp  lnvta() Dtru pnu4oleomieiltfa emu p;() ltnmociydoatrluvsl(  rtmxopnydop nlietlt)s2umu  ;t0tle mi3iltls rlnms;t0aleomo3oytfat auei t  euoio iudamt lictls) Dtm(mono4oexnmociytla2ul(vonu4arxomo3iatlatean o;s)srtmxrpiodap  mfct sfsDumu onu4oex mo3iydfa2eln o;t4 lenmociatfmD  n s;t0sruo(mpiudlmtnmietl(  2rrx  ot0ale mi3tltfa2uau snt0aeeriocootopD lneil(0 rtr(o iodaptelnvtlt sDurumpot0tlxnif3iysls2ua(vs;t)arerxocoatoateaivs;t0trurxmpny4ome mics ()aDtaxr ot4tetomi3iyslmDeaump;t4tlxnxf3oytlmDrlnei;t)s2toxopoy1lle mict sfsDtmum nt0texo oetyt sDeln s;(4trxrif tadlaDr i slt seurxm3oo4lptemfcs (  Dua( o;t0apeomiciys a2emuvonu) rtnmfcta1oa eau s;() eumirpny4ameelivt tfsDurxm no4openif3iysfaDemnmp;u0alxoio3iytfmDrlnes;s0 rur(r3ny4ameelnvtls aDtaum ;t1tpeoiociatlsDrau onu)aetnmo tytoat  n il()setoirpoudal n ictatfarrmxmpoo0teenmictys s elnmp t)arenioctadfmtr nes (0 2tr(r oo4opte fcsat sDuaump;u0ale iieiat a2ea(vp;()trenmf3ia1opte nvs;s  rxoxm3oo4lm n ies t)srrmxrpnt4apeniieiaslm eaumsnt0tleomfctotlm  au o;( s2xm(opio4llt mnes ( artmxmo;t1tpt mietatfsDeanvpn(0tltomr3oydomDrlneils0srxoim oy1ll  livta( aDtrx  ;t1apxniicildla um(vont4tlxoif tatom eaieo;(0texo(r nudap  lfcsls aDtrur no1tlt ioctltfa raums;(0artnxfctydfp raivsls) exmxr ou4al  livtatfaDumum oo0tlx moeiadla emn snu0 rxrif3oytoat lneolt0srxmiopio1oltnmfetl( srrm(mpoo0ole moeiydfa raums;u4 ltoif oo1oaDe u o;(0 2xm(o oudap  livil(fa2rmxr ;u1oeen f3iyt sDua(msnu0aeenmf3to1om  lnvi;( trtr(opno4lp  micta(fs2rauro;t4aptnmiciytfa umnvsn(0tetomo oa1lat aivol() rtrxm3nu4lpeelfei tfa2umurpot4texomictatfs ranvsn(4trxnif3to1fa e u i s  etr(r3iy4lltemivtl(fsrumu  no0oetnioctadfm eaumo;(0alxnmfctodfmDrluvs t) rxrxm nydope lnvilsfaDrax pnu4tpt  ocildlm2ean ont4tltomfciy1oatrli s;()t2ur(m ou4amt lics s sDrr( pno4alx  octyt mDulnmsnt4 eerxr3oadlaD lnes (  euoxm3no1opt mieias)sDra(r ;o0tlxoiicilslm ulu s (4 reoxr3iadlm r ueo;t0 rtm(o iy1optnmiei t)sDrmumpoo1oet mieild a rmnmsn(0teeoir3oadlm   ues;s  2urio3ou4lp n neil()arurxm ou1oleo fetld a2ra( on(0teerir3ia1omD au s (0seumim ny1ale  ncilt aDurxr oo1tpe ii3tasls2ea( pn(4alxoxr oatfp   n s;s)srumio3iy1al   fetlsf Drru pou1tptnmoctldla2ean s;u0alxoio tadfaDrlu i;t)setoiopoo4ale lnvt t a2ra(roou1tetoiicilsfm2ea(vo u)texrifcoatlpDelieslt)trum(o nodalt  nct sfaDrm( pnt4tex  fciydfm2emuvs;u0 ltoif ia1fa ean o s)tetm(r iy1llt lictlsfsrtax oou0tlxnifcils m2ra( p;t0texrif3oo1omt  nei t0teumxr3iudal nmfetlsfaDum( o;t4aeeomfeiysfa2ranvonu4alerxociodfatraiesl()trumio nudlpt  ics tfa2ur(mpot0oet ifciad s ulnmo;u)arenif3todfp eai s t0srtoio3nu4ap  licsasfsDuaxr ou4tpxnii3iltla ulnmo;t4tltnmrctatopDrlnvols)teuoio iy4olenlfeiat  2um(mpot4apxoif3iysfs2ul( o t0aeeoxrcta1oa elu o;(0 2toimpiy4lptn nvil( arur(mo;u0oexo o3tys a rm(mo;u0texrmf oy1om   ivsl()s2uoim3nydomt  nvtls)a2taxr ;u1teenmoetldlm2rlu o;t) exomf oodfmDeanvs t)sexmiopiu4amt  ncsl(fsruax  nu1optoii3iatfm ua( o t)tlxrxfciatoa e ivi ( t2trim nudame  fesl( srurx oou0aexoio3ils m ulu s;()tlxnxocio1fpDean il() exmim oo1apeemici sf Dtmu onu4olx  ictys sDrlu s;t0 rtrmf3iadomte n i s0trtoio3no4lleelicsatf Duaum nt4aee  ociydfa eau p (0aeeoxo3iy1oaD  uvs s)t2xmir iy4lltelfesa(fs2rmum ;u0aexnii3tasfsDemuvs u0trxoxocoadlateai o s0s2toiopoodapee ivi s)s2rmurpno4apt mfciadlmDra( ont0tlxnxr todoateau i s  etm(rpiodll  lieilsfarrmxmo;t0tleomoeiyslmDul(vo;u) rtoxrctatlp r i i;(0srtoir io4am elnesas aDtm(mp;u0oet  i3tls sDranmont4aetrif3ootlmD ai ilt) 2umio3nodopt mfvtlsf rrmu ooo0olxniicild s ulnmonu) rtnmo to1lpD  uvo;s0 rxoxr iy1lm nlfvi t) 2raxr ot0tex mi3tlt a2ea( ont)altnmfctotlatr ivils  2xrxopno1amtemicsl(fsDrrurooo4tpxnio3iyslm rluvo (0 lxoirctydfmD  ueo;()trtoxo nudal e nci s) rtmxrpou1opto f3tldlsDua(msnt4arxrmoctodlmDranvolt seuo(rpoy1omtnlnvsa( arururpnt1apxo oeilsla2ul( s;t0 exnxf3tatopt  uei;(  rumxm3iydoltnlicils)s2tru oot0olxnioeiatfa2ulump u4trxoxo3iadlm elneo;t)trxrirpny1om nlnci tfsrtaxmp;o0ole mocild sDua(vsnt)arxomo3tadomt luvil(  etmim3ou4lp   fct t)artmxrono0tltnii3tytfmDelnvp;(0 exrio iytla  lnesl( setoxmpnudllt lnvi s) ruau  ot0aexn oetasfmDrluvsnt0tltrmf ty1fptran i;s0t2xr(o iu4ome  ieia() rumxmont1oexnioctasla ranvo (4alenmr3tadfatraiei;t)sexm(m no1apte fvi sfa2ra(rpnt4tlenmoctlsla eau p u) eermo iadla r nvi t0 etoxrpio4omt  fvt sf Durxrpou1oee ifeild aDumuvp u4arxnxr iy1lmt lnvsl( t2urim3io4op   fcsasfsruaxmoot4aexomoctydfaDeln sn()trxrxo3oatfptrln olt trurxm3iy4lm nmneiasf Dtau poo0tltnmiciadfa emu o;t4 reoir ia1fmDrauvsl( s2trim3ny4apenlnvt ( a2umx oot1olxnmocilslsDrl( p u)trxomociodomt lieo;t0s2xoxr3ou4ameemictl(f rumxmp;u1oee iocildfmDrmums t0aexoiocta1oatr uesl(0teto(r oudomenlfeilsfartru  nt4tet mi3tytfm emuvo t)areomfcoodlptrluvils)sexmxm3iu4amtn iet sfsrraxm ou1teenmi3iytlm rmn ont0aeenifciodomDeaueo;t)teumim oodlmt  fesltfaDrrx  ;u1aet  icildfaDumuvs;u4aexoirciatfmtrai s s s2xo(m ou1op emfesat) ruau o;o4aeen fetlslm2um(von(0trxnxo3tadlpteauesl( seto(m3iu4olen fctls)aDuaurpot4apenmictytlaDeln s;u4arxnxrcootfmtrlu sl( t2xrxm3ny1optnlicilt a2ur(ronu1apxnmoeiatfa ea(vo;t4 leoiociatfpDe i i;s) 2uoimpoodlp nlieiatf Dumx o;t4aetnmo3ias m elnmsnu0aexomfctodomtelu s;() etr(o3iu4lptn ncsa( a2uaxr no1olt if3ias mDumn p;u4treoiocoadlaDe nes;( truoirpnu1olen fei s a2ua( p;o0tetnmieils sDul( p;u0tetomr3iotom   ues (  etoiopou4omt mfcta()arur(ro;o4aeenioetysfm umuvsnt) rxomocio1oaDrau o (0s2ur(mpnydom n feilt) rumum ;o4aex  feiydls2ran p;()alxnxo3iydomt ai ols)trumim ny1op nlncia(f rtmx  no4tex mfctltfa2eluvsn(4 rxoiocto1lp r nvi (0 2xr(r ou1apenlnci t srua(roou1open feiysfm2elnmo;(0trtrmrciydoptraieo;() eur(m3ou1amt lnci t  rtrum nt0oee ifciyslaDemumo (4tlerxr oo1opDe iei;(0teum(rpiu4ll emfeslt s2ururp;o1tpxnifciasfa2emumpnt4tlerxf3oo1opD ai i;t srxmio ny4ape lfeia(fa2ua( o;t0ole  feiytlmDrluvs;t)tlenxf3oadfatr n i;s)trum(m3oydopen fct tfaDuax o;t0tlx  fcils m2ul(mpnt0aeenmfctytfaDrlivi (0srumxm3oy1am  lfesa( s2raurp;o4apxomoctldla rm(vs (0aexoio3iy1faDe iei;s trtrxmpnydamt  ietl( a2tmurpoo4oexn f3ilsfs ulnmp;() etniociydlp raivs ()setrxrpoy1ape mictlt)arrrxmp;u4tex  i3iys aDrlnvo;u4 lerir3io1oa rlues t texrim3oy4ome lieil(f Draumpot4opto i3tadfaDemn s u) ltnxociodfmtr ieo t0s2uoxrpoo4alte icslsf Dra(mono0tlenmo3ilt m2el(von(0arxrxo3iadfmt au ilt0 2to(rpou4lpt lnctl( a2rauroou0oeto ieiasla2um(vont) lxrmf ootoateaieols0 etmxm nydoltnmnvsl() 2rm(  ;o0altn i3iltfsDrl(mpnu4altomo oa1lmDeaneol()trurim3iudaptelivi tf Dtmxrp;o1altnifeildlm ulu s;t0trxniociatlp eaivo t0 eurxo no1amee fet t  rumumono0altn o3tldfaDran s;t) ltrmo tydla ran s;s0s2umim nu1ape lies (  2rmumoot0texomo3iatlmDranvs;(0arxoxo ta1fmtr nei s0 2trio3oydoltnlieslt)a2urumonu4aexoiictyd m2emn p;u0tltoiocoo1lmD anes;s s2xoxrpoy4lm elicia() Dtrum ;t0ape  fetaslmDra(vp;u4tltrxfctytlatr iei s)srxoxmpiudlltnmfetl(  2tmuroot1olt mo3iltfa2uanvs (0 exomf oa1late ivs s0texrim iu4amen fcsls  rtaurpnt1tlxnmicildfm el(vs u0aetrmf ta1lpDeaues t) euoxmpiodapt mnesat  rua(mooo1alx ioetld mDem(vs;(0tetnmf oodfmD lnvo t0 rurxo3oydolt  fesl( a2truront1openmociysls2umuvp;u4 ltnxo3ty1oateau i;(  rxm(mpoo4lmtnlicslt  rraxr ;t0aetniietydfaDeaumsnt4 lenifcoo1op  lnei () rxrio ou1om n fctat)a2tm(  ;o1alxn feiysfsDulu o;t) lxnxr ootfmDrau s (  exmxo3no1ll nlfcslt aDrm(r nu0apt  i3ild a2ra( s;u4altnio3iodoat  ivo (0 rurir oo4lmeemies ( a2trxmont1tpto f3iydfa elu on(0 rxnifciotlmD liei t)srur(opnu1ole mnetl(f Duru  ot0altnmo3tas s2rl(msn(0tetrif3tytlpDeau o t0s2tr(rpny4ll n netas)arta(r ;o4aeto ieiatls2ean on(0tetomfctydfa r ueil(  2umir iu4amt  fesltf 2taxm ot4oeto o3tydlm ua(mp;u4arerif3iadomteanes s)setmir3oodol  mfvilt  Drrur no1tlxn i3iltla rmn snu) rtoxrcoadfat ai s ()t2ur(rpiy1apen fetl(fsDua(mp;o4opt mo3tldls2ea(vo;u)aeenxf totoa eaieol(0 rur(r ou1lmtemiesas)artrxr ;u4oexnioetyt sDrlnmp u0trtoif3oatoaDran o s0 rumxopiu4omen ivilsf 2trum no4tlxn i3ildlsDrm( on() renxo3totfaDrlnvi;t0 rurxo oodal   neslt srumurpnt0ole  octas aDrln pnu0trxrxo io1fpD  uvo s  2xmxrpio4optnlfei (fartr(ront4apx mo3iyd a2rln sn(0aexrxr tydlmtrai ils0seum(mpno4aptelieta(faDuru  ou0apx  iciytfs2umnms u)treniocto1lmtelneo;() 2xmxo ou1llenmfct sf Dtax  no0tpto iciydls2umnmo (0 exnmrcoy1lmDe ies;s0 rxrir3nydamenmnetls a2rm(m nt1tlenmo3ild sDemnmo t0 lxoifcio1lm  livi (0trtr(o3ny4omtn fcsat a2raxm nt1opxnmociydfa elnvsnt4 rxomfcootlpDeaivolt0 2uoio3nudaltnmfvi () ruaxmonu4apeoioctlt s ran pn(0tltoio tadom  auei;(0 etmim3oy4lp nliviatfsrtaxrooo4apto ieiat s ra(ms (4 rxnmf ia1fp ran o;(  euoxopiydamt lnvsas a2ra(r oo4aetoioeiyt a2rmump u4tlenioctatomD  nvs;s) rxoirpoo4lleelivsas aDtau onu0tpenmfeiytfmDemn o (0aleoir oodlat aies (  exmxr3oudol  mfei ()sruaxmp;u4tptnio3iaslsDum(mo;t4arxrmf oydlmDrlu il() 2urxo3nudap n fvsas) Dum(  ou0aexnmfetlslmDrau pnu) etrirciatlpte nvi;(0trxoxr3oodaptemnei s)a2tau  nt4tlx mociadfsDrl(ms u)treoxo ia1op   uvi (0 etrimpio4ale  ncslsfaDtmumooo0olxo feiat m2rl(vpnu) rxoio3totopte uvolt0s2ur(r3nu4olee fetas  Dum(mpnt0tpxn fciytlm2eln s t)tlxomf3oo1fa elnvs s)sexoim3iy1lm emics tfsDtr(rpou4opx mocils aDum( s;u4alermf iy1omDr ivi t0 rxmim io1ll nmfvsat a2raur ;o0tle mf3ilsls2ea( o (0 rtrxr3iadlaDe nvo;s t2ur(o3io4omeelnetas  2ururpoo4optoiictytls eln s;t) rxnmr3io1la rli s;t0srxm(opoy4lpee nviltfarrmxrp;o4alxoiieildfs ulnvs;(4arxoio3ty1fpt  n i;s0 2xo(r ou4olt mnetas arraump;u1oee  fctyslaDrlnvs (0aetrxf oy1lpDean i s  2xmio3iu1op elfcsat)srum(  ;o1tltn fciasfm eanmp u0altrxr3oo1lptrlivs s0teuoimpnu1lp  mivtlt)arrmx  nt0optn fcils mDrlnms (0areoxr3tydom rlivi;t0 exoimpoy4omt  nvsatfsDtmum no1tet  ieils m2raump;t0 reoxfciodlp  ln i;(0s2xoio nu1om emiei tf 2rmxr oo4opxn f3ild m2rm(mpnu0alxrmr3ia1fpD  n s;(  2toirpou1lmt lncslt srtmu p;o1aex ioetysfs ulnvo (0 rtrif3tadlpte i ils0 eumxm oo1lm nmncia()arrm(r ;t4aexoif3iatlmDemuvpnt0arxnmoctadomDran s t0 2toio ny1ome  ieslt)arumuroot0tpen feias a2rmnmo;(4tlxomf3tadlaDrauvi;t) etrio3oo4amee fcsatf rtaum ou0alx mictyt sDranms;t4trxnmo oydlaDe ueo ( t2xmirpiy4olte nctat  2umuro;t1tex if3tysfa2emums u)aeerxf3oatlpD lu il(0srtmxr3oudlltnmics t)s2ua(rpot4tetniieias m rlnmsn(0trtnif3io1fmt anes s texrimpiydameemnvs sfsDtm(m nu1teto i3iasls2ea( sn()tlxnxf3ia1oaD lueo;s0 eumir ny1om emicsl( sruax o;u1ape ioetld a ranmp (0 etrxoctadfp e i sls teumimpnudllenmfetlsfaDum( pot1tlt moctat aDelumont)texrif ootomtr ieols)srtoxo3nu1lp  lnetl( sDta( onu1aet  feiytlm ra( p t4 rtoxr oy1omtrlneo t)s2tmim3oydlptnlfeslt  2rax o;t1tpt ioeiltla2um( p u4tlerioctatlp e ieol(  ruriopio4ll  miciat sDtmx o;t0oltnifeiatlsDua(vont0tltoxoctodopte n o t t2xrir nu1amtnlneilt)srua(r no0tptniociydlaDel(msnt) etoio3oodlpD  ieols)s2to(rpoy4altelietlsfa2rm(ronu4aex  feiydlaDrmump;t4trxoxr oo1op  auvo (  rxoirpou1ale  fct s  rtaxr ot0texo ieiydfsDuau s;(4 exoxfctotomtrlieils)texoxo nydolenlfei s  2tr(  oo1aetomf3iatls2ea(mo u4 rxnxf3tatlp elneol( sexmio3nydomtn ncslsfaDtaur ot4ape iictyd s ea(vp u)tlxnmf iodlm rlnvs;s0srxoiopnu4am   ivtat) rurx pou4tet  i3tltlm rau on(4 rxoio ty1fatrauvi (0 rxrio no4oltemfcta(faDuaxronu4olx mfctydfs2emn on(4 lxrxrctatlaDeauvi ( t2uo(m ny4altnmfcsas a2urumonu0opxniictadfm2el(vont4alxrmo iadlpDr iei;s0srxrxm3oo1ome mnes sf 2uaumpot1alto o3tlslaDeanmpn(0tetrif tytfmDr nesls0seur(r3nudol e nct ()a2rm(rpoo4ale  fetlsla emnvo t4 renmrcoodlmDeli slt0 rtrirpno4op  mfesa( srrrum ;u1apeo f3iadla emnmp;(0trtomf ootopt  neil()t2xo(m3oo1amtn neias)sruaxrp;u1alxnif3iyt m ul(mpnu0trenxociy1om  an i t srxrxm3io4optemfes s) 2umxmo;o0tpeo fetlt a ea( s t0tlxrxoctotlp e iesls0setoir3no1lmtnlnesls)arrr(rpou1oee mi3ildfa2ulump;t)trxnxr iadlpt  uesls)t2uo(r iy1altnlivil(fartruront0tltniiciatfm rmumo;t0altnmf ty1fp eau il() rtrxrpou1lmtelfesls  Dtmurpoo0oexomieildlm2ulu o;t0artnxr3oa1optraies;s0t2urir iy4lp elnvsat a2rr(mooo4aptn o3ils s2uanmpnt0tltomf3tytomtrauei;s0 eurio oudope licilt) Dur(mpno1olxomfciysfm emums;u0 lxrxo oy1lptelues;s  etr(mpoydape mfcilt)artm(mo;u4aleoiieiyt s ra(vsn() lxnmfctadfm   n i t0 2toxm ou1op e nvsasfa2rmumpoo0alxo feiysla em( sn() exrifcoadlmt aneolt)t2xmiopoydop  mivta(fs2rr(ro;u0oltoii3iat mDrl(vpnu4alenxr3iydlpt lu i s  2xrxo iu4op n iesa(fa2urxr ;t0tpxnmi3iydfm2ua(mo (4tetoir3ta1oaD  ivslt) 2tm(r3iodalenlfct s  2tau  ou0tpeo f3ildlm eau pn(4 lxoxr3tatomt lu olt sexoxo3oodamt  fcs t a2trur nu0aee  ieiydls2emnmo;()alxnio3tytoaD lnei;t setmxopio1oltnmicsat) rua(m nu0tptn ocias m2umu s (4teerio ty1fat  iei s0s2xo(m3nudoleelfvs t  Drax oou0altnmoctld s2rluvs u4aetrmfcio1lptranvols0 2uriopnodoptelfvils)s2ta( p;t1optn ieiatfs ran s t4 rtnir oy1optr uvils) 2xrxr oy4lpt  ics t  Dumx ono4aptn iciltfa rlnmp;u4teerxo todlaDe ieo (0trxmir3oudlltemnvt t aDrmx  nu0ole  fcias sDra(mpnu4 eeomrciatfpD au s s) 2um(r oy4lpe  feiatf Drrumoou0alt mfciytfsDra(msn(4 exnxo iy1fpDe i i;( setmxm3iu4lmtemnvt s aDuaumo;o1tlxomi3tls sDumuvpnt)trtoiociodopD ln o s) 2xoxrpno1llenmicil()srtrx o;o1aeeomo3iadfa rluvp u4teenio3io1lm r nesls)texmir iy4amenlivtltfs2tax ooo4tee ifetls mDrlnms u)trxoir ta1lm elu ols0s2trxo3nodop n ies (f Drr(mp;t0tpxn octas s rl(vs;t0 renxf3to1opD  ivsl(0 rurim oo1ol   iciasf 2um(mp;o4tpt iictlsfa2rmnmsnu0 exrxo3iytfm rauvs t0teurxr iy4alt mncil(  2rm( onu1apx mfctldfaDrln o (4trxnxr3tatlm  lnvil(0texrio oydapeemneias s2raump;u4optnmi3iydlm2emnvp (4 rxnmrcta1lpDeaueol(  ruo(opno1op nlnvt (f Dtmu pot1texo o3iydls2rlnmsnt4treoxr3tadopD aivi s setmxm3oy4ol e fesa( sDuaxrp;o4tpen ociad aDea( s;t) ltrio3iotom eau o t) euoxr3oudam  livi (f Durx pou4teenif3tat s rl(vs;u)teenxo3oo1lm e ivo;(0t2ur(rpnydlm nmfei tfsDtaxmoou0alen fcilsfmDuaumsn(0tlxoir iy1la elnvslt srtmirpoodame  nvia(f Drrxmonu0aet moeiydla raump;(4 rtrmfciydlmD auei;(0t2to(m io4olen fesl(f Duru  no0tlxoif3iad aDuauvo t)tetnxrciodlpDr ieo;(0t2xmir3oydlpe  netas a2uau pno4oexn ocilslsDrmuvsnu4tlxoxrciy1fa raues;s)s2um(o3nu1ol  mfvta(f 2rm(  nt0teeomf3iatla2umumo;t)arerxf3oytlpD  uvsl(0s2urim nudlptn ncsat)aDur(rpou0ole ifetytfsDrau ont0 ltrioctodlaD aueilt trur(m3nodll e iesl() rua(mono1olt miciltlsDua( o u0alxoif3iodlp rluvi s  2uo(mpiodlp n fvilt sDrmxmonu4aeeoiocildfaDrlumo t0texoxf oadlpDrln slt)trtm(r3nudap  mncsasfs2trxmonu1opx ioeild s rlu pnt0arxoxrcoodlmteluvo t seum(r3io1alt mivs ()sDraxmoou1teenmieiysfa ea(von()teenircoy1opteluei;() rtmimpoodope  fvi (  ruru pot4oeeniieils a2em(mo;u) rxoxr3ia1laDrli o s)teumxo iodomee ivs tfsrtau  nu1ope mocias a2emn o u4arerir3iotomDeanvilt0srxrxopiy4ap n icsl()sDrm(mo;o1oexo o3tlsfm2um(vs u)texomf3tydlm  luvs t0 2to(o ny1lm elnet ()arrmumo;o1tpenio3ildfaDrmn p;() lerxr3tydfaDe n ols trumxr3iy1lm  mnci s)sDrmu  ou4tlxomo3iltlaDrl(vsnu4 eenxrctodla e nesl( s2xmxo3ny1ol nmnet (faDtaxm no1tpt mi3tysla2ea( s;() leoxfciadfa  lieslt) exoio3iy4lp emicsatfaDtrurono0alxnmociatlm elu pnu0 eerir3totlm elnvi s0texo(o3ny1olt liesl()a2ta(rp;o1teen ociydfsDemumpnt4texrmo3tydlm rlu sl(0texriopnydamt mivsa()sruau o;o1opxnif3iydfaDumums t4aeenmr3iy1fp  liei s) etoxo3oydoltemivia( aDrmx p;o1opt ioctyslsDelnvp;(4tlxomrcia1opD  neo;s trxmxm3iodlm n ncias)a2tmx p;o4tle  ieiltfmDulnmo;t) rerxociytfatrln sls0teuoim3no1amtnmfes (  Drrum no4texoii3tlslsDumuvp;u0 rerircio1lp eliei ( tetrxm3oy1opeelies t) 2taxmonu0tpenmf3iltlsDul(vpn(0aetoxr3iytoatr i s;t trumxo nu4olen ivs sf rua( oou4alto ociadlsDulu o;() lxomociodfptelu i ( trurio3iydopen nvt tf rrmumoot0tpxniiciadla2raumon() eeoiocia1lat  ueo s0 exrim nu4ol  lfet ( a2umxm oo1tltnmietatlm2umuvo t)tltomo tatfa ranei;s0teum(r3io4olt  feils)arrm( pnu0tpen i3tytls rlumon(4 lxnmrctydoaDr i s;( seuo(r3iy4lltnliet s) Drr(r ot1olx  fciaslmDua(ms t4trerxo tydfpt aieo t trurir ny1op nlnvt (f Dtaxmo;u0aexoiociadlm rl( s t4aeeriocoatlm rln ol( seur(r nodaltnlict t)a2ta(m nu1opxo fciasfmDrmnmonu)alerxf3oo1fm  au ilt0 ruoxo iy4ap e fvilt)aDtau pou4ope mfcild s rl( s t)alenir io1fa  li s ( t2xrirpou1lmte ncsl( a2rmxm ou1tpeo i3iat sDrauvpnt0aeenmfcoodfaDr i s (0 2xmxr3oo1am emfvi t  2tmur no0oee mociytlm eluvsnt) renxfciadomtelivs;t)tetm(m3nydlp nmnet (farra( ono0tetniieiaslmDrm( pnu)alxoxo3totoatraueils)setrirpiu1amtnlnvtl( srrmu p;u4tpe  ocils a el(vsnu)texnmo oa1fp   ivs;s)srxoxo3oo4ape mivsat  rtaur nt0olenif3ilslm rlu o;t)texnmr3oa1opD  uesls0srurirpny4ap nlfvs t s2raxrpno1tpx moctat s2elu pnt)aeenircoydla eanes;s t2tm(mpiodopeemnvtl(fsDtaxro;t1oexo fetysfaDrmumon(4 exoif3ta1op  aieilt) 2xm(o3no4lp nmietlsfs2um(ro;o1apt  o3tlsls2ua( s (4 ltrxr3totoa r uvs s) 2uoim oodaltnmicias  Drmx onu0opeoii3ilt m2ea(mpn(4trtnmr ia1fpt  iei;(0 2tmxo3nudap  lnvsat)s2taurpno0aexniieiatls elnvo t0trtrmr3oatlpD livs;s tetrio oy1ome  nes s) Drmu  ;t1opeoiieiltlmDrl( o;t4alenif3oodopD livs;s0 rxr(r3nodll n ivs (fa2rm( p;u0tetoifetyslm ulumsnu)aeeomo io1omDeln s s)s2tmio3nudoltnlneiatfa2taurp;o1tltomf3tldla2rlnvsn(4 rxoif tydlatelnvs;()s2uo(m3iydam nmivilt  2trump;o1oltniocias s rm( p;t4 ltoif oadopDrlivi (0 exmim3no4ame  fct t  Dtax  ;o1tle ifciytfa2eauvs;t)artnmfciotlm  luvo;() rxriopoudop  lies t s2umu oou4tlxnmi3tyt s2ul( o t)tltomf oydfaD au olt)srtr(r3iy1oleemnei s  2rrump;u1tex moctldfs2uanmo;()arxnxo3iy1fpteanvslt  rtrim oo4opt  ici s) 2rruro;t1apeomfeiydfa2el( pnt4 rtrmf3totomteli ol(0srxr(o3oy1op  mncs s)aDumur ;u1tlenmiciytlmDulnmp;()tetoirctydfmD li i t)trur(mpoodomte nes () 2ra(mpnu1apxnif3iys m2elnvo (4texrio iotomt aivilt)trtoxmpny4apt  nvsa()a2rrx onu1aexo feiytfa2ea(vsnt0 rtnir3totfpD  ueo;s)seurio oudol n fvs t a2ra(m nt0tlt mieiydfa el(mp;t0tlerxfciy1lmteliei t srtrxm io1amee neiat  Dua(r oo1alt mi3iyd m2eauvpnt0aetnio3totopt  ivils)t2urim3oydoleemfes tfs2rmx pnu0aptn ictld s rl(vp u0aexomo3iy1om rlivs;t) exoio3no4lmt miesa(f 2ra(  ;t1oeen oeildfa rln snu4 leoxo3iy1omDr u i;()s2urio3no4lltn nei s arua( pou4aexn fctys m2elumo;(0trxrxr oy1oat  ies ()srxmimpoy4llt mnvias)s2urxm nt4ole ii3ilslmDelu s;u0tlxoifcia1la rli o;t)t2xoxm3iy1omee icils a2tru o;u0openmoetydfm2ul(ms;t0trxnmo3to1lp rluvsl(0t2tm(o ou4om nmfesl( a2um( pnu4alenmieiatfs emuvsnt0tetniocootoaD  uvolt0t2xmxr iudllt mivs sf 2tm( pou1tpt moctldfs el(von(4alxrxr3oatfpteln i;t truoxo iodlmeelnvtas)artrx pot0tpenmf3ilsfs2rlnvp u0arenif3oytfate i olt)truo(o3oy1omeelivtasf Drm( pno0ale io3tld a2ul(vs u0aetnmrctadoa   ueo t0 rto(m oy4omeelfvi s s2tr(ro;o1aexomocilt mDra(vp u4 ltnxf3ta1laDeluvslt)t2toim iu1ole lncsls s2ta(  ;u4olx  ieiydlaDran pnt4trxrxf3tydfaDranvi;s t2xo(m iy1am nlivsasfsrrm( o;u4tptnmfeiad a ua(mp;t0arenio iytopDr n ols)texoim iudopt mivta(fsDuaurpnu0tlx  f3iyd a ea( pnt0texnxr3iotfmtrauvs t)s2xrir3iy1aptnmici s artrxmont1tet if3iydfa2ul(ms;u) ltnif tatfa  lnvo;s0trto(o3oo4alee fvt () 2ra(mp;o4tlxn ictadfs2uaump u0aeenif3oa1fp   n o;() rtoir3oo1lp  mncil(farraxmont0opxo ocilt s2ranvpnt4aeenxfciydoaDrauesl(0srtoxm3oydop elfvtatf 2tmur nt0aet  octadfs emuvs u4texrxo t
\ No newline at end of file
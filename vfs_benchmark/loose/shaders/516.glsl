@@ -0,0 +1 @@
+ieo;() 2tmxo3ny4amt lncil() 2uru o;t4oleo iciat mDelu o;(0artoio oadoaD  nes (0 2to(o3oudomeemnesls arurxm ou0tpe ioetytlsDrm(vo;t4tlxnmo3iytlp  auvs t0teumio nu1ap  mici s s2uaxmp;o1optnii3tas mDrmn p t0aetnmrcoydomDeauvo ( t2xrxm iydlme lneiasf 2rruro;t1opeoio3iasls rmnmp u4tltnxfciydfate ues;t0s2tmir3no4amtn nes s aDum(mpno1oex  oeiysfa2ea(vp;t4tlxnxr iadfp   uei;()srumxmpnydolenlfcsas  2rm( oou1oleniietatla ra(vs t0trxnirciy1lptran i;( t2tr(r nodlmen ncsls  2trx pnt4tpxo fciytlm eau p;t4arenxocto1faD  ivo t sexrirpno1lm elfcsasf Dra( p;o0teeoioetldfmDum( s t)tlenif3ia1opt livi s texoxm oydole mfvilt srtmxmont0tlt  i3iadfm ua( s ()tltrxfciodoaD aneo ( texmir3ny1lpt lfeia(fs2rmxmont1oexomfeiys m emu pnu)artomo3iytom eli i;t)t2uoxm iodlle  fct tfsrrmumo;t4aleoioctadfs ra(vo (0 reoif tydlmt anvo;s0trxo(rpnu1ameelfcsasfaDra( p;o4teeo fetaslm2rm(mp t) rermf3iy1lp  lneo t0trtrirpoy1ol nlfeilsf rrru  no0oee iietltlm2ulu sn(4areomr3oadfpD an o t)tetrio iu4opeelics ( srurur ;t4oetn i3tlsfm2eanmsnu0alerir tatoaD  n ilt0trumxm3ou1al e netl()srum(  ot4olx micilslsDumu pnu0aexomrciy1laDrlnvs;s) 2umim3ny1ale mnci tfaDtm(mpoo4alx  ietyd aDum( p t0artrmfciatfpD lnvi t srtrxopio4omt mieias sDrrx ono1tptnioetasfa2ra( p (4 rxoxo3oatom rauvi s seto(opio4aptn fvta()arur(rono4tpen i3iydfs uanmpnu0tlxriocta1la  ln s ( srtrio nudaltelicils) 2um(m ;t0oeeoif3iltfm2rl(vo;t4treomfctytomtrluvs;t  2tm(rpoo1omt micias  rua(rp;o0texo ociytlm2uau p (4 eermo3iodlmt  ivols0t2trim ny4alenmivi tf 2um(r ou4tptoifctltfsDrm( on(0trxnxrcoa1opDelneols trtmxm3oy1apenlneils  Drmx p;o4tpenifciysfa2rm( p;u4alxnioctadlpt ln i;t0 exoir oydomt lict sfaDtau  ot1oet  fctys sDemn s;t) lxoxo3tadfp r nvi;t0 eumxmpiydomt mietltfaDrm(r ot1opx iietatfmDuanvp;(4tltrxr oadfmtran slt srxm(o ny1alen nctasf 2tax  nu4tex ioeilslm uauvo;() lxoxr3ty1fpteli s t t2tmirpno4om  livi s sDtmu  oo4oexoiietyd m2emn o () etrir3iadfm elnvol(  rxmiopiy1al  livs ()arur(  ;u0tee mieiasla2um(ms;t)tlenmo3oatlm e uvo t s2uo(r no1alt mfvia(fa2rmum no4oee  ictlslaDra( p (0 etnmo oa1lpD aieslt)texrim3oodlpeemnvt (  rtru  ;u0opx io3ils mDrm(mp t)aetrxociatlpt anes;s  2um(mpoy4alen nes ()a2raum ot0olxoioeiyt aDem(mo t)arenmocoodopteaivslt)sexmxm3io4ol nmnvslsf Dtaur no4tlt ioctyd aDumnmsnt0teeomo3ty1faD ai sls0t2tmxo oy1ol emfet t)sDra( oot4tlxnmieiyt aDemu p t) exoir ta1fpDeauvi;s0tetrir oydopenlnet ()aDur( pno4olen ieild a2ra(vs;u)altoio3oo1opD liei;(0seur(m no1ame  fvs s a2trxmpou0aexnii3iydlaDrln snt4arxnmr io1omD ai s t0s2toxmpno1op e fetat  2rmu  nt0opx ifeildla2rlnmo;u4 ltnmo iy1oa r i o;( s2uoirpoydll elieta(  rtr(m ;u4texoifciyd aDrau snu4trenxr3oa1lpDean i;t0texrirpno4lp   ivilsfarurx pnt1tlt miciysls ranvonu0alxoxr tydlptrlnesls0 2xmio nudlp elics sfs2rax ooo4aexoifctyt aDuln o (0 etoxfcoodfa elueo s)teuriopno1ol nlfci sf Drmxmp;o0tpxomi3tytla2uluvp;(4aexrmfciadoa   nvs s srtmxm nu1op  livsa(f 2urxmoou0oet iiciad s2rluvonu4tlxnmr to1lmt lu s () rxmir3oy1lpte icsls  rua(  ;u1tetn ieiydfsDea( s;(0artnmocoo1laDrli ils0trxmxrpiodlp nmncils)srtm(rpou0tee mi3iydfs2ul(msn()artrmocto1fp  auvs s0 2xmiopnudlle  iet t  rrmxm ;u1tetomfeiltlm ua(msnu)trxnmf ootla   uvs;s s2xoxm3oydlme  ici s srrmxr no0apx mieiysls2ra( snt)teeoxf3tadla  anvs;s)t2umxr oy1ole liesa(  Dua(moou0optoif3iytlm2rlu o ()teenifcoodoa e nvils)t2tr(m3nodam n fvi sf rrmumo;o1optniocildls2umnmp t)alxoif oytfmDe uvi;s0 rtmio3iydom n feil()sDraumo;t1tetoifctls a eanmp t) reomocoa1oate u s;s)setmxm3iodol nmfes t)srua(m ;o4oleoioeiytla emu p;t4arxnir3iodfpteaivo;s) 2xrir3oydlptelnvilsfaDrr(rono0tpenmfciydla umump ()aetrmocoatlmtrli ol( trtoio oodlp  livt sfa2rrx pot4oex  i3tasfm2um( o t4trxnmr3totfmtrluvs;s) etrio3iodol nmiet t  2tm(mpno4oex  ieiadfaDuaumo (0 rxnmo3oodla   i i;s0srumiopiydopt lici ( sDum(roou1optoiietltlaDrau on(0 eeomr3iatlpD  n ilt trumimpoo1olen ivs (fsDum( p;o0tlxn ictadfs uauvsn(4alenio iotlm ranvs;(  rum(m iodllenlictas  rrmxmp;o4texnmfetytfaDrl(ms;u0tetoxociy1fatraueilt)s2tr(m oo1apte nesatfa2rm(mooo4tlt mi3iasls2rluvs (4aleoxo3tytfaDe uei;s)sexmio3oodam emneil()sDrmxm oo0tpt iiciydlsDea(mo;u)teeniociy1oa  lu slt)teumir3iodamtemicsasfs2tm(moou4ale  ociysfsDul(vp;u)aetnxo3tydlaDraieol() etrirpoo1apenmfvi tfa2umump;t1opxoifetadfmDrl( o t0aeenircta1oat  nes;(0s2xm(m3iy1lpe lnciatfa2rrxmpno4tetomfeildfm ra(vp (0 etomr3iy1oa rlu i;s0trumxmpou4apte fvi sf rrrump;u0alxoii3tas m2em(mp u4aexrmo io1fpDrau o t) exr(r nu1al emncilt) Dumu pnu0tlxomieiltlmDelu snt)arxomf oy1omDrau i;()s2ur(m3oodame mnvta(f Dtmxm nt0optnioctatlm emn pnt0aexomociytoa  aivo ()trtoxm oodllt  fvs t) Duru  ;u4olxo f3iytlm ra(mp t0 exomf3todfp eanvslt)truoxr iy4olee feta( srtrurono4optnmiciys m2um(ms;()tltnir iotopDelnes t)tetrirpio1op  licil( srtr(ro;u0oexnifetys s elnmo () lerxfciydom  auei (  etm(r3nodlpte fcs sfaDuaxrpno1oex moeilt a emumo (4treoxf tatlp   ues;t0tetr(mpoo4lmee nei t)aDua(rpou0oeeniieiys m elumsn(4 rxrxr iy1fmDeaieo;( setrxr3ou1oleelfeia(fsrumx o;t1alxoif3ilslsDel(mo (4tltnxr3oy1lpDelnvsls)tetm(m oudamtemfetl() rtmur ;t4tpxn ietat a ul(vp;(0 ltnxo ta1fpD ln ols0trxm(rpnu4oltnlfvsatf Dumu ooo1oexo ietls a2ranmp;(4trxrioctytfa eln i (0t2tmxr oydaltnlfesa(  Dtr(rono1openmo3iaslmDel(vo (4 lerir3totfmt aneo;t)teuoim ny4lmenmnctlt) Duaxrpno0opx  f3tyt m ra( p;t)aeeomo3tatfp  auvsls0setmimpou1om e iet t arrru onu4apx ifcias a rl(ms;t)arxniociodfptr ivi s)texmio iu1ll   iei sf rrauront0apx  f3iyt m2emnmsn() ltoxf io1optranvols)t2triopoodomtnmnvt tf Dtmxrono1opt mi3tlslmDranms t4alerxr3iy1oa  auvol( trurxopnydllenlivi ()arrmurpoo4tle iieias aDem( pnu)tlenxo iadom e ueo t0seurxr3oo4ll  micsl( srtrxront0oexomoeiydlaDua(vo u)aleoxocoydoaDranvsl()t2trio3oudom n ncia()artrxrpnu0olxoiocilsfa emuvonu0trerxr3oadlptelues ( s2xmiopoy1omt  fvtasfaDur(m ot0altnmoctys s rmnvo ()alxnio oadlaDeaivils  exoio oy4ol emiesasfs2trxrp;t0tpe  f3tasla2rmnmo;t0 exnmrciotlpDrli o s) 2xmxrpiydoptnlncsl( s2tmxmoot1aetn feiyd m rlnmpnu)aetoxo oydlpteaieils)s2xmxmpnu1aptnliei sf 2umumpou1oexn iciysfaDel(mo;()alxrmf iotlat ln o;s t2trxrpou1lpt lfctat) Dtrxmpnt4apeomf3iatfm2el(vont) lxnmfcto1optean s s)t2umiopoydlmenmfvsltf Dumx ono0texnmf3tytfmDra( ont4arerio3iotop   ivs;s) 2um(r iy4lm emnetas)srrmx o;u0tle ioeilsfm rauvp;(0aexnxr3tatoate n o;(0s2xrir iudape lici sfsrrr(r ;o0ale  f3iyt sDrm(ms (0aetriocia1lp e ivils)tetrxrpoydolt  fvtlt arrm(ro;u4tpenmfeildfs2umn on(4trenif tatfmDeai o;s)trtrio3iodameelfvtas)s2rmxmo;t1tlx mf3ils sDemn ont0 ltnxf iydom  lu ilt) exm(r nydalte fcias s2uaump;t4aetnmocils s2ulnvo;t) etoxo3iadfmDrli ils) 2trxo3iu4al nmneia(farra(r nt1apxo o3tasfs2ua(ms t4 eenif oo1lmDrlivsl(0 2xo(rpoy4opee fcsltf rraxmono1tee mfeiyt s ul(vo u)trenio tydopteaivi;s trtmim3oy1ll  lnvt sfs2uaxmo;u4tlx  iciltlm umuvp;(4 rerxo oodop r nes t)setoxr oudlltnmnvs ()aDra( pot4olxoio3iatls rmu sn(0teerifcootlm elnes;(0t2umxrpoo1ole  nei tf 2um( pou0olx  ocils sDrau snt4 exnxrctadlpt  uvi t)srtm(o3iy1lltnmnvtatfsrta(moou4oltniocild a rl(vpn(4texrxo3oo1lpDe ueo t)sexo(o3iy4olee fet ()sDtm( ooo1aeenmoetltfmDrmumonu4trtnmf oodfm  auei s)s2tr(opoo4alt lneias)srrrumont4tlen ictadlaDrln p;t0 rtrif to1fpD livols0srurio3oodopenmieias) 2ur( oou1altoifetad a emuvpnu0trtomf3to1oaD ai ils0t2to(rpoy1ol   icia()artrxr nu4apt  i3tas sDumnvsnu)texoif3iotoate uvs;(  2urxm iydlltemivsltfa2rrxmpot4oltniicild s emn sn()tltoxr ty1fptran olt0truo(r ou4ome  fcsat  rua(moot1tpt mfeiatfsDeau snu)tetomfcoa1op rlivi s) rxoxrpoydop elfcta()arrmxronu4tetomoeias m2rl(vs;t4aeeoxr3ta1oaDrauvo s)t2xm(m3iudll emiciat) Dtrxrpnu0olxo o3iasla2ranms u)aeerxr iotfmt aivil(  rxo(rpnodame mnct ()arrrxrp;t4tleoif3ilsls2ra(mpnt0texoxf to1fmD auvs;s0 2um(o3ny1ap elnci (fsrtrxro;o0opxomi3iyslm ran p;u0arxrir todfa   i s ( setr(m3oy1ll   neta() Dtax pot1tpto ictadlaDemnms;u4treomf3ia1omtrlueo t)trurio oo4llenlnvs t  rum(mont4aptnmfeiad s2uauvo t4areomfcia1om elnvs s)setmxo3iydll e ncsls a2rrxr ou0tpen o3iysfsDem( o t0aexomf oydlpD  i i t  etmxm3nu4ome liviasf ruaxmp;o1apxn iciydfmDul( s;(4 eermo3totfp r i i t0 rtmim3nodapt mneta()aDra(moot1oetn oeiadfs rm( on(4 lxrxf iadopDr u o s)s2umxopiy4lptemfctasf rtrxm nt0aptnio3tasfa2rmn s (4alerxr3iy1fpD aivils s2trxm3oo4ll emfvias)arrrumpou0oexomictlslsDrmnmp;u0 reniociotom e n i;s  rtoxo oodlp elncsat)sDurxmpoo1oltomf3iaslaDul(vp t4 lxoxf3oytfpDr u s;()teuoio3oudapt lncs ( s2raumpoo0aetnmi3ild a rauvpn(0 etnmr totopte neo;s)s2to(r3oodolee feils) Dtaum ;o4altn fcilsfm2um(vpnu4artrmf3totfp   n ol(0 etr(r oydlpenmneia(fa2raur ;o1tpt  fciydfm ra(mo ()tleomr iadlp rau s;s)teto(o3oo1ole lnvslsfarur(mp;o0tpto ociasla eanvpnt4 leomo io1fmD  ieol()sruoxrpnu4ope  fvsls  2rau p;o1tpx ioctadls rmn pnu)tetrxo iadoptranvs;(0 rum(r3no4lpt  ncta() 2tax  nt0teenmictlsls rmn ont)trxrxfcoodomDrlivo;t) 2tmxm iydlme mncs tf Drau onu4tlen ociyt sDrmn o t0trerxrciytlm  ln o ()tetoxr ou4ll emnvtat  rumurono4aptnio3ils s2rauvpnt4 eeoxr3ia1om rlneolt0 rxriopiudam   nvtl(faDumxmooo4opxoiieild s2uau o u0arenxf3iodomt  neolt0trxr(rpou4lleelnct s aDtmxm oo4oet mfciydlm2uauvsnt4tltoxfciodomtrlivil(0 2xmir3oo1optnlneil(f Dur(m ou0apen i3iadfa2rlnmp () leoir ta1lmDra
\ No newline at end of file
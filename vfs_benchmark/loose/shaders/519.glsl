@@ -0,0 +1 @@
+uvolt0trur(o3ny1ll   ictlt s2tau  ou1apenmoctys m2umu o;(4 rxrmr3ty1op elnvo;(0t2umimpnodlmtelfct tf Dtr(  nt0apx if3tyt m rauvsn(0 eeoif tadom  lueo s0 2xo(mpiu1ol  mietasfa2umuro;t4aptoii3tytfa elnvs t)tltomo iydfpDe n o s tetmimpiy1omt licsasfaDtmump;u4aptnmiciasfa umuvo (4 etomo3oo1omD lueil()t2toimpnudlmt  nvia(f rrrum ot0tpeoioeiadlmDuluvon()areomo iotoa rlu s;t  2toir ou1lleelfcs tf rtm(  nt4aee mietydfmDeaumo;u4 reomr ta1oaDrln ils)seurio oy1altnlfvsl( s2ua(m ot4aexoiicilt s ul( p;t0alenxo tadom rlivo s srtm(o oo4lp   ivi (faDtru p;o0tlxo f3iasls2emumpn() lerif3oytla e n sls)s2xm(r3ou1ameelfctls  Draxrpot0tpx  i3ias mDua( p u0 ltoif3todoaDrluei s0trtrim3oy1omt  nctatf rumu o;o4aexomoeiad aDem( p u4treoxr totop   u ols0trtoxr3nydap e ncsasfs2ur(  no1oex io3tas s um(msnt4altomrctatomtr nesl()teurir3iy1amt  feilt aDurx ono4tee io3tatlm2uaump u4 lxnifcty1lp rauei;s  ruo(o nu1lm  lfcsa( aDurumo;t0aleomi3ias aDuanmsnu0trxrmf3ta1fat livil(0 etr(opno4ap   ncsl(  rraxm ;o4olxo fciydfsDelumon(0aetnxfciodom  ln o;( srto(o nudlm  lncs ( aDuaxr ou4tleoioeiyt m uln o t0 lenmr tatfmt li o;s0srto(r3oy4amt liesas sDtauro;t0olxoii3iydfs el( o;u4trxnxo3ty1lmDr uei t s2xrxm nodop n ivsa(f rrrxrpnt4alt  feias mDel(vo;()trenmr ta1oatrai i s) 2ur(m iydlptnmfvi sfartmurooo1apeomictys s rau p t0aexnmf ta1om r ues t0 ruoimpou1ll nmnvs sf rumx p;o4tlxnif3ilsls2ua( o;() ltoxrcto1lm  au slt setm(mpiodomte fetlt sDurxr nt0oleoifciadlaDel( ont)texomfcto1lmD auvs t texoim no4om elnvt tf rra(rpou1tltomociydlaDeaums t)alxrmocto1fpDelivs;s0 rtm(mpoudlpeeliet () 2rmxr nt1tlen ociatfm ulnmpnu) rxnir3oadfmDeli s;t) rtm(rpnudomee fvs tfs2rrxrp;t1tleoiietatla2eauvont) eeoxo iotfp e ivo;s tetoio oo4ap   ietl(f rumu  nt1tpxnifeilslaDem(von(4texrxf totfpDran o s)trur(o nudaptnmivsl(fa2ra(ro;o1opt mi3iydfsDuan s;u)teenmr ty1opte n o;t) etmxm oy1lp emict (fa2rrumooo4tlxnio3iysls2ulu o;(0 exnmocoy1fpDe i o ()s2umimpnu1olt mnvslsfs2umumpou1aeenmf3iltfmDulnms (0alxrmf to1fpD lu s;t0tetr(rpnydomenmfeslt) 2trurp;u1ale mfeiltls elu p (4alxrmf3iadlp  li o (0t2ur(m iu4lmenmncslsfartau o;o0tet moctyslmDuln o t)texnif ta1opD  ueo s s2ur(o nydlltelnci (  2ra(rp;t1oeto ietldlmDrmnmo;u0aexrmf oo1oat  n s;t)s2ur(m3oo1al emfcslt)sDtaxrpot0alxn i3iyt mDelu p u) rxniocoatoa raivs t  2xmim oodlmenlnvtls  rtaxm ;u4aet io3tadfmDelnmp u0teenxrciy1omtranes;s) etmio3iudlpeemict tfa2tru ooo4opto ietadfm elumo t) lxrmocoatlpDranei t)trtoir3iydam  lneiat)srraxrp;o4aleoiociydfaDra(mo t)arxriocoadoatraivs;( t2um(o3oudop e fcs ()s2ra(m ;t1texnmo3tldfm2umumpnu) lerxo iadlaDrauvo t0trxrir ou4llt  fvsltf Dtmumpou4ale mo3tad s umuvs;(4arxoxo iotfpD lnesl(0s2xoim3no4ol nmfvtltfsDrmx  nu4oleoii3tlsla2rl(msn()trenxf3ty1lpteluvslt)sexo(r oy1opeelietlsf 2umu p;u1tpxoiieiydla eluvo t)alxrmo3todfa rauvs;t)trxoio3iodamt  fcsa( a2ua(m ;o4tex ioctysfsDuln snt4tlxnmf3oatlatr i s s0s2xr(r oo4al elictat s2um(  ou4oetnii3iltfaDel(vo;t0 rxomr3oatoaD auvi;t)setriopou4ale  ncs (faDtmumoou4tpxnmiciysfsDel( onu4tetrxo3ia1opDeaivi;t)setr(m3ou1omte nei sfs2ra(r ou1oeenmo3tysfm eln snt)tlerif3ty1faD aivols0truoio3ou4lp n neiasfaruax ono4olxo fetatfs2rm( p (4alxnif3oadopDelnei;s) rumxm nydole mici t)sDtmxmo;t4tpe ii3ildlm ra(vp;u4alxnxo3ootlp e i i ( trurio3iy4aptelnvs t a2urum nt1alxomf3iad m rln s u4 eenio iodlpD lies (0 2tm(mpnu4omtn fesatfaDrax  nu4alt  iciadlaDranmp;u)aetrio ta1op rlneo;t) 2uoim3oo4ape  icia( srum(ront1oleo fctyd s2emnvsnu4aeermf iy1lmD  uvsl( seum(rpiu1olee fctlsfs2uaxm nt4opt  fciltfs el(vs (0 eerxfctatfpt an o s0srumxmpny4ap nmnvias  rrrum ;u4aptomf3tydlm2eln s (4 lenxo3ootoaDrlivs s0setr(opoy4lpt lncsa() Draumpou1tetnif3iyd m2umn o t0 ltoxo ta1opt luvsls0trxrxo ny4olt  fcsas)s2raxm nt4tlxomoetyd a2umnmo (4 exrmoctatfa   i i ( s2xo(rpno1om  livsa(f Dtaum ;u1oltn i3iys mDea(mo u0arxrmfcta1lmtrlieo s  exo(r3nodom   ietat)a2taurono0olt mocildfa rmn on(4aexoio3tytom rluvsls)trurio no1alee fcs ()aDtmx pnu4ole mi3iyd s2el(vpn() rermociytlpteln sls  rto(rpoy4alee nvi t sDtaxmonu4apxo ictldfs em(mpnt)aexoxf3totlpDeaieil(0trtr(opio4olee nvilsfaDtmxm ou4oexo feiyd s el(vo;(4arxrmo ta1lpDeai o;t0seurxr iy1lmenmictat)srrax  ou0oltn feiyslsDuan s;u0tleomr3oo1lp elnvo;(0s2umxmpio4omeemnetls) 2tmu  oo0apeniietydfaDeluvp (0 leomoctydfaD  i o (0seurxo iodam  mivia(f rum(mooo1tptnifeilsfm2elnmsn()aleoio3oytfa rlies (  2xmxr iodaltelfvtl(f Dtrum ;t1alxnmfetydfaDua(mo u0 reoircia1lmte ivols0t2toim3nodamt mivs (fa2raurono0tptn ieiyd s2ea( o;(4 rtrif3iodfa r nei () euoxr oodlpt  nctat a2tr(m ou4opeomiciyt m2em( p;(4aexrmf3oo1op e iei;t) rxmxo ny1lp emncil()s2rmx pot0teenmo3tys sDuan s u)arerifctodlptrai o;t0 2toim no4oleelfesat)srumur oo0olt mfcild s rm( p;u4texnxoctodfaDrlu i;( t2urxr3ny4optnlneiltf 2ta(m ;u0oee  ociydls um( p t) rtrir oydlatr i o;s0 rurim3ou4alt  ics s  2uau ono4apeoifciysfm emu p (4aexnxr tytfmteaueo;t) rum(mpnu4ol  mieiatfarumumo;u1teto o3tysfm ua(ms;t0 rerio3ootomt an ols)trxrirpoy4altnlivs t  Dua(ro;o1tpt  oeiytfa2rln o;t)alxnxo to1lp e neo t)sexmxo3iy1op   ics () rrm(r ;u4opt  i3ias sDemuvs ()aexnmr oy1lmDeanvo t)truo(mpnu1olt mivi (  Dumurp;o0ole  f3ias sDua(vo (0trtnmf3tatfa rlnvi;t0 etoxr nu4am e ivils) ruaxrpnt4apto o3iatls eanvpnu4treomfctadlmtrai sls0trto(m ny4lpee fetls  2tmx onu0tpxn feiatfa2ua( o;u4teerif iadomDrli sl( teumiopnudamen fesltf rrrumoot0opxomoeiydlm2el( sn(4aetnmf to1fm  lues s t2ur(o nydllee ivtat) rtmxr nt4teeomoetld m2emnvs;u4artnxocto1latrlues s0t2umir iodll  lfetat)aDumx o;t4tlxo f3tys sDel(vpn(4alerxo3tydlptrlieslt)teuoxm io1ol nmnvsl()s2trumo;t4tex mo3tlt mDra( p;()texnxo oadfatr uvi () 2xm(mpiydam emncilt) 2ra(r oo1tex mietlslmDum( s t0 etrif iydfm r ivilt0 etm(m3nydapeeliei ()srtr(rpou4tex mociatfs eau ont0tetomr tydom   ues;( s2tmxr oudolen nesa()sDraum nu4ape mo3ils mDrlnvsn(0tetrio oatoa r u sls) 2uoxm3nu4opt lfet ()srtmx  ;o4oet io3ils m2rmnmo u4teerir oytfpte ivi s)s2tmir iodap e fviatfaDua(m ;u4tetomfeiyd m2emnvo (4trtrxr3iatoaD  iei;( s2urim iy1ole lfetlt sDtaxm oo4tltn oetatlm2rm(ms (4 ltrmr3oa1optelneilt trumxr3no1lmt lfvi ()a2ra(m nu0tptn iciydla rm(vo;u)artomf oy1omDeli s;t t2trxrpiudomen netl(f Dua(r ou0tpenmieias aDrl( o;t4 lxrxo iy1fate n s;t)s2urxr3iu4ape licsl() Drm( oou4olxnio3ilsfs el(ms (4 ltrmo ootlp rlu i (0 exr(mpoodlp e feias  Dua(mp;t1ale  i3iatls ra(ms;(4aexrxr oo1laD auei;( s2xm(m3iudale mncs t sDtmxmo;u1aee mf3ils aDra( s t4aetrio ootfpteauvo ()setrim3oo4ol   iciat artr( ont0opxo f3iysfa2em( pnu0 etoxr ootom r nes;s0 2trir3nu1lmenmivias s2um( pou1alt mietytlm raump;()tlerxociydlmt  u s t) eurxopnu1apeelfvsat arumu pnt4oet if3iadlsDeluvon(0texoircta1faD aivo;(0t2tm(o3iodlm elnci ()srtru onu1tptn ictlsfm2rm(vs;u) reoir3totoa e nvi s t2tmxr nu4al  mnet tf rur(r nu4tpt mfeiyd sDem(vs;u4altrxf3todfat lueils  ruo(opiudomee fvtltfsDrmx ooo4opto fciysls2umums;t4aeenif3iotlpDe u o (  exm(m no1aleemieil( s2rmx o;u4aeto f3tat s2uanms;u0 ltoir3oa1la rauvil()srum(r3no1alt  nvi (f 2tm(m oo1alt mfctltls2rau p;u4aeenmo3oo1op e uvs;t0 eurxr ny4ame mfvtlsfaDtrxrooo1texo o3iyt a2rmn p (0 eermo iytopte i ils0 2to(r nydop elfet sfs2tr( o;t4oltnmiciydfmDrmnvp t0artomo3tadfptr n ils0 2xmio3ou1apt  ictlsfsDta(  ou1tltomf3tyslmDuluvp t0 rtriociatop r u olt0srto(r3nu1lmeemfcia() 2tru p;t1teeoiocilt a2ul(ms;u)teerxr3oydlatrln i;s s2uoim iu4ll nlnei t aDrmxmoou4opxnmi3ildlmDumu s;()trxoxr iytopteaivilt0t2xmiopiu4al nmnei (fsrururoot4oeenmociltfsDrlnvp t4teerio ootomDr u i ( t2xo(opiy4ope mfvsltfsDrr( poo1olenmfeiaslm eaumpnt0 exnmo oytfaDelieol(0 exoir3ou1lpe  fvi tf Dtrum ;t0opeoiietld a uau pnu0 ltrmfcta1op   uei;t  eurirpoo4lp e fvsls  2uaxm ou1alt  fciadlmDea(vs;u)treomfciotfa eln o;s0 eumxopio4olen nct ()aDum( ono1tpen ieildls2el( p;u0areoxf oodfate u s;(0truoir nudomtnlfctlt sDuaxrpot0tpeo fciatlsDrauvp t4artriocty1omDr ivsl(0s2urio oy1op  mfctat  2ua( pnu4tlxo ociydfs rlnvsn(0 eenmf3oo1fpDeaueil()t2to(m oudlle miesa()aDrr(rpou4aexoioeiasfmDel(vs t0 eenifciotoa rau i t t2xr(o iydoltnlicsltfs2tmu o;o4olenmfciltls2umnvp u)alxrxr3iytla e iesl()s2uriopoo4oltnlicilt  Draur ou1aeeomf3tasfa uan s;u4treoxo3iatomDe n sls)srtm(o3iy1oleemivsa()sDtmx  ou1teenmietld a2eln pnu0 exrxf iy1oaDr nesls0tetoir3no4lmeemfetl()a2uru poo0ape io3iytlm uanvo (0 ltrifciatla ran ols0srto(m ny1lpeelnvt (f Drmumooo0tle io3tltlm2rmnvpnu)artriocootla e u i;()tetmxrpiydoltnlfeiatfarraxro;o4tltn ietys mDelu p;(0tleniocoadfa rauvo;(0 exrir3iydll emnviasfa2rrum nu4alxn ieiat s eanvpnu4arermr ia1fatrlueo;()s2uoxm3iu1lltn nct s a2rrx o;o1oex mfcils s ulnmo;u4 lxnmocoy1oa   nei;(0 2uo(r io1om n nesa() Dtr(rpnt0aleomf3iat m2el(vsn(4texrio3oydfmt  ueil()t2xoiopiy1lme  fcslsfaDtruro;t0aeeoioeiadls2rlums;u0 rtrmociodlmtr u ilt  exrxo3no1oleemfcsa()a2uaxm nt0oexnmociydla rlnmo u) renif iydoaDe uei;(0srum(r io1lmt  fesat sDtm(ro;t0tle  f3iltfaDua(vs;() lxrxfcoo1om   ueo;(  exo(o3iydop elivt sfsrumxmo;o4oeen ietyt s2ulnvs;t0 rxoxr iotlpD lnei;(0 rurim oodal   ictasfa2raxroot1altnmoetasfs2emn pn()aeenmr3oy1opD  uvo;s)t2um(m3oo4lmtelieia(f 2rmxroot0oetn ietat mDulumsnt4artrxr3oydfmteln i;t0 rto(mpiy1ol elncias a2tr(ro;u0teto ietys mDrl(ms u4 eerxr3iotfmt ai olt)trxrio ou4omt lfeta(fsrtm(  nt4ope if3tlt mDrl(vs u4trtoio ia1om rluesl(  rurxopnu1lptelnei s aDua(  ;t1olxn f3iltfaDrlumo;t)artnmrctodomteli ol(0 rtoiopou4amtemnviatf rrmxmont0tpe mo3ias sDrmnvo;u4 reoir oodlpDran ils0setrir iodapee net tf Draum ;o0tlen ietad s rauvp u4artoir3ia1lm r nvils) etmim oy1ap eliei s)a2rr(root0tpenioeias m ulnmpnt0altomo3oo1oaD lnei;( tetm(m iy1lpen ivtasf 2raxro;o0oex mo3iaslm el(vs;()tltnir iatlpDeauvolt)s2ur(r oy1opt lfcs (faDrrx o;u4tex io3iltlaDul(vs;(4aetnmr3oodfa ranvo ()sruoxrpny1lmte nvsl(  rtru ono1oex ifciasfsDem(vs (0aeerio3iadlp rai o;t)sruoirpiudlltelivt s aDua(r ;u1opeoii3ildla emnvsnt4 exrmo tatfaD  neo;t  eum(m3oy4lpeemfvtas) Dtrx oou4tex ioctat a rmnmon()aetrmrcoa1om r n ol(  2xr(o iy1ome lfci t)a2urx  nt1aeeomociytlsDelumpnt4trtnmf iotomtrluei ()s2uoxm iodalt mnci t sDtmu p;o4oex  fetydfm2ul(mpn(0treoxrcia1fptr uvi;()srxrio3ny1om n ieilt arrmxr nt4aexnmf3tltlaDrl( p u)tltoxf to1opDr iesl( trxmxm3iodaleemfvt ( sDtrur ot1aeto f3iadfaDuan o;(4texrmocootfp eaueo;s teurxrpiodom elivs tf rrmurpou4tet  oeiydlm uauvpnt4teenmf iotoaD  ues t)t2urxr3iu1opeelfes (fsrrrurp;u1opt ioeiat s2eluvpn(0 rxnir oy1lpt au i;t)sexoxo3iydoptnlncs t sDrm(rono4tpe io3iadla raumo u0alxnxr tadlptrauvol()s2xmxm3iu1om   fcils artaxm nu0opx  fctat s uln pn(0 rxrmo3tadlm  lies;t0 2xrimpnu1lp nlieil() 2rau pou4opt mo3ildfa ea(mp;(0artniocoy1omDeaivilt0trurxm oudole lieil(fsrrmx p;u4aee iieiysfmDumu p (4aexnmocoodoa eln s s srxmxr3ou1ap emiei tf 2ra(mooo0tpt mi3ild a em( p;u)tltrxfcootla r iei s0s2xoxr3ou4lpeelnvs () rrm( pnu0texniicias aDrmumpnu0 lerxrcoytfaDrlneol()t2tr(m3oy4ap e nvias sDtr(r ot4apt ifctyt mDea(vpnt0 renir3iodlat  uvi t)t2tm(r oo1ame  fet s) Dtrxmp;u0oex mociadfaDraumsnu4alenirctodfpDranvi t  euoio3iy4omt mivsat) 2trx  ot4optn iciadfmDrl( p;t4aexrmfctodfmtelnvo;s0 rxm(r nu1omee feia(fsruaxr ou0oleniieiadfm2el(mpnu4 rtrir3iotlaDr ueil()s2xoio nydal  mfetls aDrrxmonu1apen i3iad a rm(vs t)arxrxfctotomtranvil( tetm(r3iu4ame  ivi tf Dum( oot1tlxnmo3tlt mDem( ont)trerio3oy1fpDrln i;t)t2ur(mpoodale lncs s aDum(moot0tlx if3tltls2ran o u) exrifctydlmtrlivols setmxm3iydap emfvil() Drrxm ;t4alxn ocilslm2em(mo ()teeoir iatfm  livs;s)srtoxr3no1ame lfvsltf 2tmum oo4oeeo icilsla um(vp ()tetnifcia1lp elivo;t  euo(opnodam e fct ( sDumx ooo4altoifciydlmDul(monu0tltrmr3ootlpD  n i s0texmio iydlp  mfvi s)aDtrxm ;t0apeoifetld a em( s u0tlxrxr to1fm  lu slt  exo(m oydapen ivsas a2umuronu4tleomoctad sDrmuvs;(0tlxomf3iy1lp raiei () eto(rpoy4ll n nct s aDumxmo;u0tle ioeiydlaDelnmo;u4arxoifciydom r nes ()t2tmio no1ome micil(faDrmur nt0tltn oeiad s uanmpnu4aeeomf3oatlat an sl(  2toirpiydap emfvs s  2tmxrp;u0aex iieildls2rau s t4arxnxf3to1lpt an i s teurxr3iy4optemies s sDrrxrpnu0optomfciasla2emu p t)trxnxo3oytop   uvi ( trto(mpio1amt lnetl() rumx oou1tptnii3iadfmDra(monu0arerifcty1fpD  ivil()t2xrxm3ny1aleemfcsatfa2rm( pnu4alxo i3ilsla2emu o t0artrif iodlpD lu slt)t2tmxo3iu4llt  fvsls)artru oou4aeto oetysla uauvpnu)aetnmocoydoaDe n s;(0 eurxr nydom elncslt)sDrrx  ;u0tpx moetadls2ul( s;t4aetnmo3ootopDrluvi;s)seur(rpnydam emfvia(faDuaumo;u4apxomoeiytlmDean o;u) lxnio3iytfpDraivs;() exr(mpiydlm emiei tf rrrur oo4alxnmo3tat a2ua( o u) lerio tatla rlivs s)teuo(r3oo1olt mnctasf 2rm(r ou4olxn iciad a2ra(mo;u4alermociy1lp   nvs (0t2xmxopio1omtnmnvi ( sDumumpoo1teeo o3tat mDea(mp ()trtnxo io1oatr ivo;t0 rtmio oudlm eliciatf 2rm(r no0teeniictatlm2rm(mo u)aetomf oadop   u s;(0seumxopnydame  fct tfaDtaurp;o4ole  ieiltlaDumu s;u4aexrmr ia1op  ln i;( trxmio iodop nmnesls)artm(rooo1open fctas a eanvo (0texnmf3oydfpDrlneol( srur(o3oo1op   nvt s)aDumum nt4tlx ii3ildlsDrmu o ()alxnmr3to1fm   nvi t seuo(r3oy1omt mncias)sDur(mont0tpe mociasfm ra( snt0teermo to1oaDeauvslt t2uoio oydol  lnetatf rurxmpoo0aee iociltla rlu p t)altnmfctodopDrlivilt)srur(o3io4opt  fet ( aDur( p;u0aexnmfeiadfa ran s;() lermrciydfaDraivi t)trto(mpnu4op  livt s) rrmumo;t1oltniieiyt a umnvs (4tlxniocoa1fptrau i s0seto(opoy4amenmncilt) 2ua( oot1oeeomi3iatfmDumnvp;t0texnxf3oy1fmteln olt0trur(m3iodlleeliei ()arumx pnu4teeomo3iydla uan s;u0arerxf3oodfm   u o;()tetmir3ny1amte fvia(f Dtaum no1aetomoeiys m uln p;u) leoiocta1oaD  iesl()tetrir3no4oltnlnvi s) Dum(mp;u0apxoii3ild m uau pnt0 rtoio3ia1oa elu ilt t2xo(r3iu4al nmiet ()aruax  ;t0tex  o3ildlsDrmuvonu0trenmf3oy1om e u o s0 2toxo3iudllen nesltfsrum( oou0aptnif3iyt m2emnvo;u)arenxf3iotfp rlnei;t) 2tmxopny4ol   ncs (  Dumx pnu4alt mietld mDulu sn()aetrifcoadoate u sls0 2toxm3iydlp n icil(fsDrmum nu0tltomi3iytlaDemn o;()aetrxr3todfp  lues;t0s2xm(o3iu1ole mnvt s sDum(mono0tpeniieildfm2um( o;t)altnxf3iodomteln slt  euo(r3nydamtn netas) 2tr( oou1tlt mictysfs emumo;u) rtnmo3iytfatr ues ( s2trxm iudlmt  ncsas s2tr(m ou1oltnifeilt a2eluvs u)tetnircio1omDranvsls  ruo(opoudalenlivilt  2um(mpno4tlxnioctas m ranvpnu0tetnmf3to1fmte iei ( srtmxm3oudalt mictat) rtm(  oo1oee ioetlsfm em( p;(4texoxocoa1fpte n o;()trtm(mpiy1omte ictat  Drau  nu1tltnmieiyt s ua( s u0 ltrmr3oodfmtrli ilt0srtr(o nu4ale lncs sf rra( ono0ale mfetltlaDumn o t4teeomoctydfaD ai il()truoxo3iudameelivt ()arrmxrpno0oet mfctas s ea(mp;t) leoxr iodfmDrlivil(0srtmxmpiy4apee ncsls)s2uaxrpno1texoifciyslm rmnms ()aexomo oo1lm ran ils0tetrxm no1al e fvsl(fartmumpoo4aptomoeiys a rl( p;(0 rerif tytop eanvo;t  2xr(r3iu1aptemfcsa(f 2rrur no4oee  o3tltlaDeluvsnt4 rxrio3tytlp   uei;t0seumxo iodam  miciat  rrmxmp;u0tleomieiys mDeanmo u) rxnxociatoptrau s t0 rtmxopio4llt mfesatfarraur no1oeenifeiyd a2emuvonu) exomrcoydopDelieols)teuoio3oudlmtelnvtltfarrm( p;u0oetn i3ild m umnmo;(0 exoiocoy1opDrlieo;s trtr(rpnydoptelict s sDrm(monu0aet io3iadla rmu pn(0teeoircoa1fpD lieilt)trumxo3oydaptelfetlsf Dtaxrp;u4teenmf3ilslmDel(vs;t0 rtniocty1opDe nes;s)tetm(m oudolt lfetat s2urumpoo0opto octltfm2ranvs;() lenmociadlptelieo;t) 2ur(r oodomeelivs tfarrm(m nt0tptn i3tadla2rlnmp;u4aeeomo3oa1op elnei;t  2to(mpiu1ame  nes sfs2tru oou4tet  octad s rl(msnt0trxnmrctytomteau ils  2uoio oy1lmte nvils)s2taurp;t1olx mieiatlsDeanvp;u0treoir oa1om   nvils texoio ny1al n ietasf Dtaxmpou0tltoiocilt s elumo;u4tlenifctodoaD aiei s  rxm(r3oy1aptn fcsat) rtrx o;u0optomocilt m2em(mp;t0tltoio3oadlp   ies;()srxrir oo1lptnlivsl()s2ra( pno0aet iiciltlaDuanvp;u0teeomo oadopDe neo s0 rtr(m3iodaltn fctl( srtmxro;o4ale  ictls m eluvon(4 exrmr3ia1la   ues (0s2toxo3iu4amee ncsas)aDurxr ot1oeeoif3iltls2rmn p;t0 eermr totlaDe u ilt teuo(r iudlm   fci ( artru pno4opxo feiytfa2ran ont0 eeomr iy1fptelnvs;s s2xmxm3nu4omt lfcs sf Dumx poo1oex mfctld mDrluvs u4trerxf3oydoptelu o s0trxmim3nu4lptnmfet s sDtau  ot0apeomi3iatlsDum(vp;() eerxr3iotoatelu ils)teuoirpno4amt liet sfsDta(r ou0tpx  i3tasfmDrmumonu0 eeoirctatlp elieols sexoim3iudam   fvi sfarumxmpot1aexoio3tyd s rauvsn(4aleomfctydopt  nvilt0seuoirpio1lp nlivil(  2umxroou4oleoioctydfmDelnmp;u0 ltomocootomD livil(0seum(r3iudome  ivsat  2raumoou4tptniiciyt aDrmu snt4teerxf3oytoptr uvslt0srxmio3iy1olte fvslt)aDtaumpno4opxoifetasfa ra(mo;(4treoxociadfp e ivo s0 2ur(r3iu1aptemfvt t  rtrxmo;t1opto ieilsfsDra(vo;u4 exoirctatfpt lieilt)truoxrpoy1op e netlsfa2tm(  ou4aeeoioeilsfa elnmo;(4 exoxrcta1omDeanvs s0truo(r oy4omtnmietas sDtm(ront0tpxnio3tyslaDemuvsnu4 lxnir3ty1op rluvs s)setmirpno1lpt  icsa() 2ururpou1aptn octltlsDel(vs;() reoio tadopt  iesl(  2xoim3oy1lpe  nvs s) 2tau pnt4oexnmoctasfa eluvpn(0altriocty1lp rlu i s0trum(o iodlltn fci tfa2ua( p;u1opxniiciytfmDelnmp;t4teeoxf3iatomtrluvo;( setrxrpnydomeemfei sfsrrru  nu0aleomfciytlm2rm(mon(0altrxrctydfa  aneo;t  2ur(m3oo4lme mfctltfarrmx pno1aexnmo3iatfm eaumpnu4teermo3oytfp  aueil( s2xriopiu4olt lfvtasfs2tmum ou1alxnmieildls em(ms;t0aeeomr3to1omDr nvi;s0srxmio iy1llen fesls a2rrxrpot0tpeoii3tysfm2ea(vpn() etrmrcta1fpDeaueo (0trtmio3no1am  lnctat) Dtaum ;t0tetoifciatla umnmsnu4 rxnir3oo1op ranvslt) eurxr3io1oltemietat s2rrxm ;t0opeo ictyd a elu p (4trxrmf3tydlmD  ivo;s)srxmxr3oudllt  nci s sDtm(r ;t1aptnifciytfm2rmnmpnu0 lxrmo oodlmDr n o (0 rxoxrpiu4opt  fct sf rtmuroou4teeoif3ilslaDuanvo u)arxrxfcoydop  aneo;t s2uoim nydomt miesl(f ruaxmpnu1tltoif3ild s uluvon(0 ltrmr3oy1op eaueils)trurxo3oo1lme livi s arurxr ;o1apxo ieiasfa emumpn(0trxrif3iy1lpD  neo (0setm(rpou1ap e fei sf Dtaumpoo4olxoio3tlt a elnmp u0 rtoif3todlmt li ils0trur(o3io1lle lfciltfartaxmo;t1aleoiieiydfa umnvp;u4 lxrxrciy1lp  ai s;t  2xoxrpiodlpt  neia(  2tax  ;u0tpeomoctyd aDeanvp (4tleoio3tytlmtelivs (0 2xmirpoodop e fcsl()srraurpou0tpeo o3iadfsDem(vo;u)aleoxfcootoatr ueils0 eumxmpoudome  fetatfartmu  no4tpeoiiciydlmDul(ms u4tlxrxfcoa1fat livilt0s2trxrpny4ap e ics t sDraxrpou0tex  ieiadfm rlnvonu4alxoircoydlm elues s) 2tmim3nu1ame liciat  2uaumo;u1altnifetadla2rmn pnt4arxrxf3tydlateaieilt) 2xrim3iudalt mfcs tfaDumxr oo0apto ieiltlm2ra(vs;(0 rtoxo3oy1fpteai ols0 rxmxo nu4om nmietatfaDtr(m ;t0ope ifetyd aDuluvpnu) exrmf3oatfpt  ivi t  2umimpiu4ameelies ( s2raxronu0apt mictytfm ean p () rxrmr3oy1fmt aieo;t0 2toxm ou4oltn feias)s2tr(mpnu0aetomfeilslsDeauvonu4 exrxr todfmt li ilt0t2xoim iy1lpe mieiat)sDrm( o;u1tlt  f3iytfa2rmuvp u)trtoif oo1fp rlu o;t0 eur(r ou1amenmnvsls sDta(moou0tpeo oeiyd aDulu o;u4aeeomo3tytoptr uvi t0seumimpoo4ale mfvias arrauroot0oee ioetldla2uln p u0alxnxr iydfaDr ies s)setrxrpno1olenmfvt t) 2tmxm ou4ole iociaslm umnmo;t0tltomf3iytom eaieils)sexmirpoudomeeliei () 2taxr nu4tptomoctlsfsDumnvonu)treoxf3ootfa rlues s  rtmir3iu4omee nvi (f Drrx  ;o0tetn fciadlm elums;t)tlxrxo3oadlate neo t  exm(m ou1apenmnvt tf 2rrx onu0opxnif3iat mDrm( s;(4trxomr oy1lp   ieilt0 etoxr3iy4amtelncs t aDururo;u1tptomfetydfsDelnmpnu0teeomoctotoptelnes;(0srxoxm oo4apenlies sfsrurumono1tpeomfciltla2el( pnu4artnxo ty1fmD ln sls)sexmir3nudaltnmivsat aDtmumpou0tpe mfciatla2rmumo u4arxnifctatlmtraneol(  rumirpio1lm   fvt s  Dtau  nt4tle if3tls sDrluvs (4altnmrcoa1lptelu i;s)t2ur(mpoudlp n ncils) rtrurp;u0olx mfciasla umnvs u4 lermo iotfm eaues s0 eumxm3oy1lptnlnvils aDrax  ;u1aetn i3iltfm rmnvsn(0 etrifcoodomtelueilt0trxoxr ou1ll   ietat)aruau onu4ope mfeildlmDrluvp u) lermr3oydoa  ai o;t0teuoxmpno4ape  fcsls aDtmxm ;t0aexo ieiltfa ea(msnt)tlenxociotoa  luvo s) rtmxm3io1al elnctas  2urur oo1aetoio3tyt s2ulnvo;u4tetnmo3tydfptr nvi;t  ruriopno4llenmfes tf rtrxr ou0tptoii3tld m ra(vs;u0arermo3tydlmt aieol(  2toirpnydllenlicilsfsDtmx  ;u1tlxn feiydfm2emumpn(4 renmociatla rlu sl(  rxrir iu1optnmncs ()aDuau ooo0tptnifciyslm em( snu0 lxnmo iadfm  aivolt  exoio3nu1op  mfcsa(fsrra( oou4tlt  ieiyt aDuluvsn(4aetnmf tadop eanvs;( setmim iy1alee neia()sDtmx  ;u4tetnio3iyslm eanmonu0trtomr3tytoaD lieil(  2tm(mpny4llee fcs s arrrx  ;o1optomf3iasfaDem(ms;u0alxrmf3iodfp rai s s0teumxmpnudol   iesls aruauroou1tetoif3iydfa emuvsnt0 lenio3iadlaDelivo;s0seum(opiu4ape lfei ()arur(  nt0olenmf3iydls ul(von(0alxnir3iatopDraieo (0 eumim3nu1lmenmneia(fs2rmxmoot0apxo fetldlm2ran s;(4 lerircia1oaDeauvol(0truoxm3iudalenlfvtls)sDumxmo;o1aee mfctasls2um(vo;u0trtnxfctadla raiei s) 2urxo io4omenlnvtltfsDrr(mpnt1altomfeils a2um(mo;()trxnio3to1optr nvi s seto(o3iu4lm  mnci (  2tr(mp;t1tlto iciysls2eanms;u)aetnxr3iotlptelu s t0 rur(o3io4ol   iet t srta( oou0altn fctltla2eaump;t4arxrmr3ootfp rai o t srtmimpoydll n fci tfs2tmur oo4tlxn o3tldfm2ulnms () etrxr iy1fp r i o () rtrio3iudoleemicslsfsruaur ;u4aetoio3iaslsDuauvo;u0 exomo oatfpt anvo s0tetmirpoy4alt mfvi sfs2rrxrp;o1teeniociysfm2ea(vont4areoxf3tydfpDrau ils0t2uo(opny1llen ivia(fsrrru p;t1apto fciatlm rmn s t0tetrxr iodoa rlneolt) rxmio3nudomtn ietlt) rum( pnu0olxn f3iys m eanvs;(4tlxrif3oadfat lnei t0tetoim no1amt  net s) rurxrp;u1oeeoioctytfaDulump t4altnxfcoy1fpDr nei;s0sexrxopny1lmtnlivt (fs2tm(rpoo4oetniictadfs2umnvo;u) lerif3iadfp eanesl( srum(opio1apt  nvs tfaDrrumonu1tpx iociaslm2em(vs;u0 etoxo todlateliesl(0 2umxr3ou4oltnmfet ( arta(  nu0alx mfeiyd aDuanms;u)aleoxo iy1lpteluvil(0setrxm3oy4lm elfes s)srtmurpoo4oltnifctad m2rmu pn()arxrmr todomtraieo ( truo(o nudamtn fvia( s2tm(mont4oleoiociadfsDem( o;(0tlenio ootom  lieo;t srxoiopoo4lpte neilt  2ua(m ;u0oexoif3ilt m2ulu snu0altnxf oo1om rln i s0 2trxmpio1amte ivs (f 2tmurooo4ope  ociydfs2ra(mp t)tleoxf3tytoaD  u ils0 exoxm3oydll emiet (  2umur ;u0alx iieias s2eluvp;u4 exrxr todlpte ies s  rxoio3oudap nmfesa( s2uaxronu0oexnmf3ildlm elnvp;()tltnio iotopt lneslt)srxm(m oy1lle lnctlsf 2rmu  ;o0tlxoii3tydfm2ul(vs;u0 etnifciy1opt  ueo (0 eur(o no1am nlfetltfaDtaur ot1apxo feiltls2rmuvo u)artomocoytopt lnvs;s truoir3iy1opee ivtls s2ra(rono4alenmictas m eanms;t4 leniocoadlaD au i ( srxr(r nydop nlfcil(  2umxm ou4alt moctadlmDrl(mp (4tlerxoctodlaD aieo ( truriopou4amt lncsat  2rm(r nt4oex  o3iyslsDeln p (4tleoxf3ia1oatelnvs t)srtoxm3nu1opee ncsas)a2tmx p;o4opxn o3tldlaDemn o;u0artomf3iydfmDeauvil()sexoir ou4lp nlivt sf 2tr(m ;u4tlx iociysfm ranvs u4 eenxo to1fp  auvol()s2xo(rpiudlpen nei tf Drmxrpoo0tpxomociydla2emu p u) eermo3oo1fpDeanvi;(0s2xo(opou1op emivil(  rum(m ;u4texnii3iadfmDeau p ()treomr tydfp   ies ( sruo(mpiy1lp  mnei sf rur(r ou0olto fciat sDranms;t0aetrif iotopt aies;(0teuo(rpno1lmt mivt s aDtr( o;o0opx  i3tlslsDem(vs;() ltrmf iatfpteluei;s) rurxrpoydoleemfcia( a2umxmono0oeenmietasfs elnvo t0aleoxocta1oa  anvo s0trur(r iy1oltnlnetlt  Dtru ont4alto o3ilt s um( o (0 lxomr io1faDraueo;(  eur(opoodale lict (f Dur(rono0apxnmoeiadfm2em( p;t4 etrmo iotlmDeln s t) 2umxr nu1am  mnct s  2ua(ro;t1apenio3iyt a rmnmp t0trxrmociatla r nvs ( t2uoir3oydoltn icils)s2ur(mono4tetomoeias s2eanvpnu4texriocio1fmtelnes s truoir oo1lle mfet t) rtmurpot1aexn icias s rmuvpn()texrif3iy1omte neo;t) euoxmpiu4altnlfeia(  Dtm(r oo0teeniietydls2rmn p t4 etoxr3iotfpD auvo t trtoirpoudapt mfctl(  Duru  ;o4openmf3tatfs uanvsn(0aexrifctydfmt anei t0 rto(o oy1ame lnvt ( srrmurpou1ale io3ilslm2uaumo t)teenmf to1lpDrluvo;t0teuo(m3nydlp nlnesa(  rrm(r nt1apeniietydfm2em( p (0tlxoif3todfmDeluvi;s0 rurxr ou4am e fet s)aDrau  ;u1oet iociydlm2eauvonu)trerxfcoadfa  anesl( s2to(r3nu4omteliesat)a2rm(r ;t0tlen fctltlm ra( o;u0tlxoxf3oatfp r u ols  2toxo ou1optemfvsls) 2tmum no0oeen ieilt a2umums (0 rxnxfcootfaDeai i s)s2tr(opiu1aptnmneilt a2ur( pou0ape mociasfm2el(ms u0texnio iadfatrlu i (0seuo(r3iudaleelnesatfs2ta(m ;o1tlto i3tytfmDranms;u)teeoxr tydfpteluei;( t2urim nodame lnvi t)a2umu  ;t1tleniieiaslaDrln s;u)trxomf3iydoa rauvilt)teur(rpiudlm n ict ()aDurxr ot0oexn fctadlm uan s;t0 rtomr3tytlmtelieo;s)trxo(rpoo1ape  ieiasfsrta(  ;u0oleoioeildlm em(vo () rtoxo3oo1opte ivilt t2triopiy1lme mivi t)aDua(mo;t1tlxomfeilt s2ea(vs;() ltoio3tydfmDr i s;t)teumim ny4lleemics (  Dumu pnu1opxn f3iysla2eaums;(0tltnir3tadomt  u s t s2trxr3ou1ll n icilt  rumumpou0apxn ocilslmDua(mp t0trtnmociatfmDrlieslt0t2to(r3iu1olt lfeiasf 2raxrpno1oexoif3tyslaDrlnmpnt)teerxo3iotoat lnvi;t  2toio iu4apt mfvsa(  2tau pot0aexoioctlsla2rau onu4tetomr3iadfmteli o;( s2umxrpou4op nlfvi s s2ta( p;t1tlxo ociytlsDul(vp (4artoxo iodop   nes;(  2tmir oo1lptnlnes ( arraxroou1texo i3tytla ua(vonu)tetomo oodomtr n slt)sexo(rpou4ap n fvilsf rtr(rpoo0apt  oeiys sDua( o;()trtoifciodopDr ueils0t2xoim3iy4lmtnmici s)s2tm(mpno4aptnifeiytfa umnmo;u4 rxrmo3iadlptranvo t) ruo(opiu4lltelnei s aDtmxm ou4tpenmieilt a rmnmsn()artnmoctadlpDeliei t0tetr(opiy4am nlfci t)artmx  ;t0tptnmfciat a2em(vp ()arxoxo totlm  an o;t seto(m ou4om elfcs tfs2rmu  nt4olt  fciytfa el(vo;t0 lxnio3iy1fpD auvol() rtrxo oydale  fei () 2ur(mpnt0aetoiieiad s2el(msnu0tlxnxrcto1lmDe nvo ( trurxo oy4omtelict ( aDra( p;u0oltomfcildfs2rmuvp;t4aetrxfciodomtelnvo (0tetrxm3no1lpte ieiatf 2um( p;o4tet moeildfaDulnvp;()tltomociatfmD  ivil()s2ur(mpiy1omenmncil(f 2ur(mpot1apx moctyd a2rmu s t0trtnmf3oatfmDr ivi t)srto(rpny1apee nesa(fs2raxrpno1tpxomfeiaslsDel( p u0areomo3iotfa elivo s srxo(m iodomt lfvsl(fa2rau  ;u4tpenmieilt a uau s;u) leomo3oadlateaivolt)teur(mpno4lpt lfetl(  rrax poo1olxnmo3tlt s ranmo;u)alxnif3iytoaDe u ilt  eumxo3ou4llt  ies t)artm(mpou0aex  i3ilt s2ranvo ()treomf ia1op rauvi s0s2trxr3no4ol e ncsa() rrmxrpnt0tpxomo3iytlsDeauvsnu4tlenmo ty1faDrli slt)s2ur(m3iy1am e ietatfsDrm( oot4tptoif3iatfa ran on() exoif ta1fp raneslt)t2urxr oo4lmeemieiat s2uaxmont1tpxnmieilslm umuvsn(0tetomocoa1fpte n s;(0t2urxr3iu1am e ict t) Durx oou0teeniocild a rl( s;t0trtomr iatomD lnvsl() ruo(m3ou4ole  nviltfa2umxmpoo1olt ifeiys m umnvsnu0treoxf tadlm  ai o t teurxm3iodop e fesas srtr( p;u1tlxomictlslmDul(vs () rxoio3iydoat lu s t) rumxm3oudomt mivias) rurumo;t0teto oetltfm ul(vs u4 lenmocoytop  li o;(0seuoiopny4opte ietat) 2urxr nu4tpxomoeilslm2ulnvonu0 rxriocootlmte n sl(0texo(r3io4al nmictltf Duaxroot1ape mfeils m2um(mo;(0teeomo3ia1lpDraueo;s  rxmir3ou4lp emicsa(fa2trx  nu0tleomfetlsfa2ul(mo (0teenmf iy1lp  au i t0 rtoirpoo1ale mfvtat sDuaumpnu1olxnmo3iytfs2ua( o u4tleomo3iadfp elu o;t0trxoxr3oudopee ncsl() Dra( poo1aetnmoctls a2rmnvp;u0trtoir3todfm ean ols  eur(o iodlpe liei s artau pou1altn oetltfa2umuvsnu4 exomrcty1fmteaivs t)setrxrpiy1ope lfvt t) Drmxrono4ape ioeiytla2umumonu0alxoxo3tytopt  uvsl() etoxopnu1ome mfeta()sDurxmoot4tpxomi3iltlsDranvp;t)arerxf3iadlmD  nes ( texoim3iy1al emicia() rtmu p;t1tpenmoeilsfa ean o (0 exoio tytlpte uvols0trxoir iydal elivta() Dtaxrp;t4ope ifctlt m2ulnmont4 rtnmr oodoate uvilt0srxmir io4lp  lfeslsfa2urxrpnt4aex if3iltfsDea(ms u) exrmo tadlmteai slt0srtoxm io4lpt  nes t) Dumum ;u1alt iieiyd a uanmo;(0 renmfcoy1fmDelivsls) 2urxm3iodom e ietltf ruau pnu1oee ifeiltfa eln on(4 lxoxo ty1fpte ies;s) exrxo oudlm e nes t) rum(m ou4optn oetatlm2rm(vs (4arxrmo3ia1lp  livi t  2urir3iu4omeelfei sf rtmxmo;t0aexoiiciys a2emuvo;()tleomf3ia1fmDraieslt0 rurim3oy4lme  ict () rtmu o;u0oeeomoeilslm2eauvon(4alxomf3tytopt li i;s tetrimpny1op  mnvta(fsDtrur no0teto f3iat m elu s (4trtrmf3iotlpt li s;s0teuo(mpnu1lptnmnvt (fsDumu  nt1tltnio3iat mDem( onu4aetomoctytlpD luvi;t0trxrio3nodaptnlfcilt sDrr(mp;o4opt  ociytlm2um( snt) ltrmf iodopte uei t0seum(m3iy1ap e fei t)aDtr(r no4apxn iciysfsDemnvo t0aetomfciadlmD luvsl()tetm(m oydamenmnviat) rra(r ;t1apx  i3tadfaDelnvonu0tetnxf3oatomDr u ilt)t2xmio3io4lleelfvsat srua(ro;o1aexomoeiadfs rlnvo;t4arenmrcto1fa eai o (  exrxm oo4amtnlfcia(f Duaumpot0oetoif3tydfm elu snu4tlxnxr3totfpt  u i (0truoir3oodlle miesatfsDtm( onu1ope iieias s rm( p;(0 etoxociydlpt aieilt sexrxmpiodame licils)srrrurpnt1tleoii3tadls2uau s ()tltnmr3iydla elu s t0texoirpnudlptnmics ( aDta(rpot0aeenio3iat s2umn o;u)arxoir3oodopDe uvils0s2tmxm3oudop e nvtls)a2um(m nt4teenio3iat aDul(mpnt0alxrmr iodfp  ln s () etr(o nu1lp   net t) Draurp;t1ape  ociltfm2emuvpnu0 ltrio3ta1optrli olt trurir3iy1amtn icia(f Drr( oou4optnmocilt m2rlums;t4 lenxr totfpD auvo;()srxrim nu4omt mnviatfsrtr(m oo4oetnmfciyslsDumums u)alxrmocoo1oat  u s;t seumxr3iodll nmncs () Dua(m nu1oex  iciltlsDranvp ()teenif3tatlmteli o;() 2umxo3ou1apt  fci s sDumumpoo1olx mocils s el(vo u)tltriocoodfaDraues s)s2ur(o no4am  mnvtlt)s2tm(r ou0open ieiasfmDuaumsnu) lxrxo3tadfm eai slt) 2umxm3oy4lpt  feiat s2tm( oot1aptoif3iys mDelnvp;t0trtrmr tytfmDelu i ()trxo(rpiudame mieil() rua(mpoo4aet ioctatla2rau p;u4aeeoxrctadlp e ivo t t2xoxo oydll nmnviltfs2tmxr ou0tlxn ociatla2umu p u) ltoir3iodoat anvs t)texrxo ou4ap e fci ( aDtax  nt1oee miciytfa2rlnvo u4alxnmrcio1omtr nes t0 ruoim nudopt  ieils)s2tm(root1tpx io3ildlsDel( s t) rermr io1lm rlneilt  rxoxo iy1op  mfvtas)s2umu  ot0tetniietat a ulums u0aeeoir3oy1lmt luvs;s trxm(o ou4amt mncsat)aDur(rpot4apx iocild s uln p t4altnmf3oa1fmDeau sls)t2toxr3nudalteliesa()srrmxmpno0tetnmiciltlsDrauvonu)arxnmo oy1opDr uvsls0trumirpiodol  lncta(fsDumx  ot4oee  f3iytfs emumonu4tltomfctotopDrliei;s) rxmirpoydol elfvt ()arrr(mp;o0alx io3ils a emumo;u)teeoifciatlm rauvo s)setrir3iy4olte icil()srrrxm ;u0oee ioctad a uluvo;t4arxnmr oo1lmt lieo;s seum(r3iy4alenlieslsfs2tm(mono0aleniiciasfm2rl(vont)areoxf3iytlp  lieo t) rxrirpoy1ale lieiasf Dtrxmoou4ole iicilt aDraumont0tlerxrciodfa e nei;s srxoir nudlm n ncs s a2uaxmoou4tpx ioeiydfmDul(monu4 exrmo3to1lpDrlivs;s)t2tr(o3iu4om emneil( sDrrur oo0aee mietydlm2ul( pnt4texnircoy1fa e ueo;(0 2tr(mpou1llt licsl(f Dua( pno0tlenmfctydfm2em(vo;(4 lxrxf oadlpDelueslt)trxm(r nudam n ivtasfartmur no4texnmfeiysfm ul(vp;t0tltomo ta1oa  ln s;s  2xmir3ou1omtelneta(f Dtrx ont1aetniietyd mDumn pnt4 lenxr oytomD an o s s2xmxr3iy1olte netls)srrm(m no4olenmietlsfsDelumsnt)alxnxf tatfaD au s t0teuo(r ou1altnmfetlt)aDurx oot4altnmoeiydlaDum(vp t4 ltnxrctytoptrlu il(0 rxmim3iodll emneiat  ruaxrpno4oltoif3iatla ranmsn(0 rtrxo3tytlaDeauvo;( teumxr no4apeemicsl() Dtru  ;t0oet  i3iasfmDrln snt)trtomrcootlpt livi t0 rtrio iodopteliesat  rrm(rono0tetoioeils s uaumo;u)trxrxr iydlp e nvo;s) exrim ou1apen ncil() 2uaump;t1optomiciydfs emu pnu)trerif3io1lptran i (0srumir oudalt  iei t sDtmumo;u0tptn o3iydfa rlnvp;(0teeomocoo1lpDrlieo;t0teuo(r nodam   fvil( sDuau pot0tpt if3tls aDrlumsn(4 rxomocoa1faD  ivi;s0 2urio nu1lm nmnvt s)aDrm( ooo1apt iiciadfa uanvp u4aleoxf iodop   ivilt)srur(mpoydlpeemivi ()aDrm(m nu4apxnii3iltfaDuau p;(4 renxo oy1lptelnvi (0truoio3nodllt mnctasf rtax pno0opxomociatlmDum(mo (0 lxnif ia1lmDran o s s2umxopiodomt  ietltfa2tmu o;o4altnmoeilsfa2rlnvon(0 rtoxo3oy1lpDelnes;s0setoimpnydape liesasfa2taum ou1altoiietldls2um(vp;t0 lxrir io1opt luvi t)teurxrpno1apt mncsat)s2urx p;u0teenmictlsfm2uanmo;u0texoirciytlpDrauvo (0 euoxm3ny1lmtemicslt arrm( o;u0oleoioctltfa rlnvsn(4tlxrxf3oydfateli s s t2xoxm iu1op nmfvsa(fsDtrxronu4tle mictysls2eanmpnt4altoircoa1oa  lieil()t2ur(o oy4oleelicta(fa2urxro;t4apt io3ild s2elnvp;u)aleomo ta1oa   ues () etmxrpoo4op  lnvs s sDrru  oo0tetnioetytlm2ulu p;(4trtoir iatlpDelivi;t) rtoxrpou4ap emnvsl(faDra( p;t4tpt ioeilsfaDrmn snu4alxoif iydom  li ol() rurio3iy4ope  ncia(farrrur oo4aeen ociad s elu onu4arenif iatfmDeaivo;t) eumim iu1lm n iesas  rur(rpno1oleomoctysfm2rluvon(0tleoio3totfptrauvolt teuoimpou1lp e fvsat s2taum nu1tet mfeilsls2ra(monu)tltnxr oytfaDeaies;( t2xrxrpno1om emfeils a2urxmoou0tet  o3ilsfs emums t4 exoxf3ootfaDeli o s)texoimpnu1omtnmiei ( srtaxrono0apxn fetld m ul( snt) ltnmf io1lpDr ies (0srto(r ou1alee feil()sDta(mo;t4tlt mo3tls sDeauvo;t4alxrio ty1fp  anvolt0 ruoim iu4am nmfetlt) rra(rono4oex  feiytfs ul(vp;u0teenmf3oo1fat luvi;t)srtmio oo1ol emies s s2umum ou0tle mf3iysfsDuanvsnt0tlenir3iotlaD lu sl(  2um(rpoo4aptelfcsa(faDtmx  ;u0opeoiiciysfa2ran p (0aetrxo iotomDeaiesls0 exoim iy1lle  iei tfaDrmumooo0aptniieilt aDra( s t4 etrif oydfate n s ( s2tmir3nudaltn nvtat srumxr nt1tptnmi3ilt s2uln p u4aleomf3iytla  aneilt0sexoir io4lltn nvsas aruaxro;o1tptn o3iyslm2uanmo;u4altoircoa1fatelu i;s0 2ur(r3nu4openmicsa(f rua(rp;u4oltnmoetydla umuvonu0 exrircoy1fmDrai ils  rur(m iydlp elfetl(f Dtaxroot1alx miciytls2ra(mo (4trenio ta1laDeaivs s) eum(mpny4amtelfesa()aDrmxr no1tpenifciysfs2rmnmp;u) rtrxr3iotoat li i;(0trto(m3iy1alte ici t)sDuaum ;t0opeo oetatfa el(ms (0 lxrio oo1opDeai o;(  2tmir3iu1omtn fci ()a2rr( pnt4alt mi3iyt m2uaumo;t4texomrciydfa rliesls trum(o iu4lpt  ies s) Dtax  oo0apeoioeiadls2elums;t) etrmoctodfaD  n ols0 exm(rpoudal eliesatfa2ra( p;o1aex miciys s uluvpnt) rtrmr3todlatr i ols) 2xoxrpno4olen fviat  ruaurp;o0aexn feiadfa2ul( o;u4 etrif3ootlmtranvi;s s2xoirpiodope mncias)aDta(r ot1apenmf3ildls rm(monu4tetrifctatoat an o t srxo(mpiudome mneta(  Dta( onu0olt moeiltfaDranmo;t0areomo to1oatrlu s;t) 2xoimpiu1alee fviat)sDurxr no1aetoii3tasla2emuvsnt0tetomr3ia1fmDe i o;s srxrxopoudap n fet sfartau pno4apt io3tatfs2rmn sn()alxoir oytlp rlieo;s0s2tmim nudolt mfvia( arumu p;t0tpe mfciltlm2uanvp (0texnmocoy1fa  aiei s0t2urxopny1lpte fcsatfa2ta(mpou4oex mi3ilsfm eluvo u4 etnxo3ta1fm  luei;t)sruo(o3no1alt mfvsasf rurxmpnt0tlenmf3iydla ul(msn(0alxnif3tytlmDe i s;(0t2toxr iu4lmtemfvtlt  rraxrpou1ole mfetyd mDul(vs (0 eermf3ootfpD  ivsls0srxoxm oy1al elnetas  2ta( p;t1alt io3iysfm ua(mp;u) rtnmf iodfa eanes s  exoxm io4lmt lncsl(fartrx ont1opt  ieiltfs2rlu snu)arxrir oytfm eli o;s  2trim3iu4lmt lfvsas srtau p;o4ape  o3tas aDulumsnt0arxnmfctotfptrauvsls0t2uoxrpio4altn fcslt  2rmxro;t4olx mfciyd a emu o (4aleoxo totfaD anesls)setmxo3io1op nmfct tfsDuaxmo;u4tleoioeiysfaDelnvp t) reoir iy1opDelieo;s)setm(o no4am e fct (f rumxroou0teeomietld s ra(vpnt) lenxrctatoa e ivs;s) 2trirpoo1omee fetas) 2tauront4ape moeiydlaDrmuvp;u4texoxr to1lmDrauvslt)srtrxm3oydlpt  fet sfs2tmxroou0oetnmfeiytfm rln ont0altrmr iydfm e ivi s trxoxo oo4ape  neiat s2uax p;t4tet ioetadfsDumu snu)tlermf3iadop rln i t0 rxrxo ny1amtnlncil(farrrxrpou4oex micils a umu s t4 rxrxf oa1fmDr ieil(0setmxrpnu4aptnlnvs s s2ra(mp;t0apen feiat s ra(ms u0teenirctadfat au s t0s2trirpoodame mfetasfartmurpoo0altomo3iydfa ran p;(4trtomo oodlmt livi s srxmirpoy1lpenmnesa(fs2rmxm ot1tpen i3tasfs2eau p t0aeenmr3ty1fpDr n i;(0 2xoxo oo4lp elfvtat) Drmxmp;o1aetomociad aDeln pnt4 lenif3iadomDelnei s)teumxmpnudlm nlfetlt sDtr(mpno0apt iiciltfa elu s;u0aexnxo3oy1fmt aiei t0tetmxo oy1am elfetlt a2tmur nt1tpenmfetys s ran s (4trtrir3tatfat  ueol()srtrxr ny1apee fet ( aDur(ro;u0alto ieildlm2emn o (4tltoiocoydoaD au olt0 etoim iydal n nvslsfs2taur nu1opxnmfcias a2el( snt)alenifcoadfpDrliei;t srtr(o iodap n nvsa()srrr(mono4alxo i3tydla2rmn snt4trxomocta1fmDrlies s teuoirpou1om  mneil(fsDtrxro;u0alt ioctlsfmDrm( s;()texrif tadfate nes;s0s2trxrpny1opee icils  2tax oot1apx  fctydfa eau s (4alxoxrctatlmte ueil()seur(r3nudlm  mfcsls s2ururoot0tpt mieilslmDran o (0tlxoio3oytfa   u s (0sexm(rpiudoltnlivta(faDrrxm ou4tet iociatfa uln p t4tlenmr3oodlmtrlnvi;t) exrio iy1lmt  ictlt  Dtmurp;o1oleoifeiydfs2elnmsn()altnmf3iotlm rlivo ()texmxo3no1op  lnvias aDrrx  ot4olto ocias a2uau o u0 lxnif ty1fatrau ils)s2uo(m3oudomenmfeiat arurumont4tle  fcildfs ulnmo;(4artoxrcoatfaD  ivs (0seumio3iy1amtnmiet (f 2trx  nu0tlx  o3tat m2uanms;t4 rermf3oodopDrlies (0teurim3iu1lp e iviat) 2ra(r no4oltomiciatfa um(mo;()tlxnmo tadlpt  n s s s2tr(m3oy4am nmncils)a2tm( p;t0olt  f3iad m2ul( s t4artnio ootopte uei;t)s2umio3oy1omtnlivs t)aDtau  ou4tpxo feildla ua(vs t4aleomf oy1opDranvi;s  etrxo ny4am nmivt sfsrrrxm ot0ape iictlslm2eluvs;(0texnif3iatlmDranes ( srum(r iu4alee fei t)aDtrur nt1apxoioeiytls ran s;t0alenmr3oo1optr ivils0teto(mpiu1omtn feiatf rtaur ;o4tlx ioeiytfmDea(mp;(4trxnmr3oytfpDr nvi;()t2toiopiy1amt lncta() Duau onu1tle mictltlm ua(vsn(4texrxr3ta1om r nei;t0trxrim3nu4ap n ics t)s2rauront4tptnio3iltfa umnvpn()aetrmociytoaD aivs s0 2tr(r iudomee iviat)sDta(mpou4altnmf3iadlm2emnmsnt0aetnir3tatfaD lnvo;()s2toxm nu4ole  iesl()s2rrum nu0olxoiicilslaDumnvsnu)texrxrcoydoa  an slt  rxm(o nudoptemfvtas)artrxront0ale  o3ildlsDumu o t4teeoxf iy1opDelies;t t2toxo3ny1omt  nciasf 2rmu p;t0ole miciad s2rauvon(0 eeoir oodlpDr uvi (0 rtrxr3iy4om   icils) rrru  ;t1aeeoiociat a el(vo;(0 eeniociydfpD lneo s  exmio oy4lmtelfvt t a2rau oou1tlx  ictasfa ul(vo u)teeomrctadfmD  u sl(  2xo(mpio1ol nlnvs ()artmur nt0tpt if3iasfsDra(mont0alxnmf3oa1om  lu o;t  rxm(m3io1ol e fes s)sDra(r ;o4tee  ociaslmDeau ont4aetnir ta1optraneil(0setrxo oy1ale  ictatfaDrax  ot4ale micilt sDrm(ms;t4trxrmr ta1oaD li olt  2xoxmpny4ome  ictat)s2rmumoot1teeoii3iydls2rmu o u0alenifctatfaDeli sls trxrio no4omt lieilsfa2ta(m nu0aleoiietldfs2um( o u0alerxr oy1lmt  ivo;( teurim3nudaltelnei sf rurx p;o0teeomfeilt m uan s u0teerir3iodoa  an i s) rxr(o3nudomeelfvsas  2tm(ronu1aptniiciltfs emnvo (4tetomo3oydomt auvs;s  etrxopno4ol elfvtas) 2uaumpot4olt ioeiytfa emnvonu4tlenifciadlmD luvi;() ruo(opnodap n fvsas a2umxmont4oex moetls a umnvsnu) ltnmrctatfm eauei t srxoir ny1oltnlfeta()s2ur(m ot1olx  i3tatfaDemnvs ()tetnmo oytfpDrai olt) 2toirpou4optemfvtlsfsDumu  ;o4tptn fcias aDeaumsn(0areoxr oodlptraues t  etoxr3oy4ll n ivt s artmur ou0tpeo fcild m2uau s u4trxrmfcto1oaDranvi t)teur(o io1omtnmfct sfsrrmxmont0apxoifetadlaDel( o;u4trtoxr tadlate neo;(  2trio3oy1llen fvsat)arrrxmpou1aetn ietydfa2rau pnu0texrxfciydom e u i s0t2xmir iodop e ict s)arurumpou4oexnmo3iat a emnmp u) ltrmr3totfatr u s;s  etrir3nu1ll  mfct ( srtrur no4alx ifciasfs rl(msnu4tlermf oy1fmDrluvo;s)s2xrxopoydale lfetl(fsrrrx  ;t0ale moeias m2elu o u0texrif iydlm   uei;s0teum(r oodlpt livs ()sDtmxmo;t0olxomoeils s2ea( p;t) etoxf oa1fptrli s s)trur(m iudlpeelicsltfaDtrx  nu4oexoio3ils a uauvs;t) rtrxr3oadoptrlueslt) 2to(rpou4aleemnvi tfsDrrxrpnu4teeoiociat a uluvo;(0 ltnircta1lmD an o;t  2xr(rpiy1lltelfctl() 2tmumonu4tlt iicilsfm eln p;u4 ltoxr t
\ No newline at end of file
@@ -0,0 +1 @@
+uvi s0seurxo3io1oltemicias s2uaurp;u0tlenmi3iyd s2em(vo;(4 rxrxr3totfpDraiesls0 euoxmpiy1lpeelivt s)a2ra(  oo0opeoio3tas a rmu pnt4trtnxrcoa1oaD aivs;s) 2uoirpio4lmtemnvil(  Durx  oo0ope iiciadlsDelnmp t) ltnxo3ta1oatr i s t) 2xoxrpou4ole lnvt t srta( ooo4oetoii3tydfm eanmpn(4 eeomfcoo1oaDr n o t)sexm(m oy1amte ncsa(farrau pou1apt ifeiasla eanms t0tltniocootlmDe ieslt t2xm(m ny1lp   nvsat  rurx p;t4olt if3tlslaDul(vs;(4tlxomociodfatrlu olt  exoimpio4llt  fctlt  rrm(r ou1aexn iciydla2el(mo u0 rtnmf oydoatrlnvi ( trtmxm3iy1ameemfvsasfsDta(r nt1altnio3iad a ulumo;t4aeeomf3iytoatraivil(0trtoio oudoleemieils  2raumpnt1altn fetas a2em(vs t4 exoio io1la  lueil( s2xmxm iodom  liciat) Dur(r nu1alto fetytlaDelu o t)trxrxr iadfpDr neols  eto(rpoydlmeemnvsl() rrm(monu0tpe  ociyt sDea(vsn()tlenif iytopt aivolt srtoio3oy4oltelnvtlsf rurx p;u0oexomoetad a elu s;()trenirctatfp  lu i s0 2xoxo iydlltnlfetlsfsrtmu pnu4tlxoiietas sDelump u4alxnxrcto1lptrlueilt0t2urxopou4llee fci () 2ra(mp;t1oltn ieiysfa uanvo ()treriociytfate u ils0 2xmio iydamee nei s arrm(rpot4oeenmietas s2um( s (0trtnif3oadoat anvo;( tetmxo3iodol   fctat)srtaxmpoo1olto ocils m2uln ont4aexomocoytlpt  i s;s) rum(m3iy1omtn feslt arraxr ;u0aex if3ils s ulu s t4tetrxo3oydfp   u il()trurirpio4om nlieta()s2ra(  no4altoio3iysfs ua(mpnt)teenio oodlp r ivi;()trxo(opio1oltnmnct s aDrrumo;t1tpe moctydfa2rm(mo (4 etnxf iatoptrlnesl(  2xmxr3iy4amtnmncs t  2um(mpnt4aexniociyslm umn s;t)aetrif iy1la e uvs t0trtrxrpoy1lpt mivt t srraurpot1alt  fcias m rauvs t)tlenmr ta1fa ean o;s t2uo(r iy4optnlivtasfaDtru  nt1tet  iciadfm rl( p u)arxoxr3iadla  aies t) rxmxmpoo1ll nmiviasfarrmu pot0texnifeilt a2uan pn()trtnmo3ty1omDr uvi s0s2xoio oydolteliciatf rtr(roou0aetnio3iad aDeanvs;(4 lerifctatfp e nes;t s2tm(r3ny1omt  neias)sDraxm ;u4olt mf3tyt m2eln s u4tetoxf totopt lueo (0 rumxmpno4ol   nvi s)s2uax  ;t1apxn iciltlmDeluvs;(4 lxrif tytfmDe neo (0sexrxo oy1oltnlictlsf 2trxr nt1opto f3iytfa2el( o;t)treomfctodla   n sls trxoimpnu1lpen netasf 2trxro;u1opto iciadfs2rlnmonu)teeoxrciadomDeln s ( s2to(mpiodape mfci t  2tr(mono4optn oeiydls2raumpnu0tetnio3iytfmDelnei s t2urio3iydaptnmivtltfa2taumooo0opxo ictatfa rl( s;u0arxoif3tydlpDeanvi (0trurimpio4lptnliesl()s2tmumpno1optomo3tysfaDul( pnt)arenmrcoodfaDr i s () 2toir3oydlpee iesltfa2rm(mpoo1tetomfciytfm2ulumpnt)alxrir io1fmte u s;s)s2xmio3oodll elfvtlt)artmur ot0alxnifeild aDrm( p (0 leomrcootfaD au i t)t2xmxo iudlmt  icsltfartm( oou4aeeoiieiytls el(mp t)tltrxf3iatoa r neilt)t2um(mpoo4lp   nvtlsfs2trumo;u0tlxo iciatlm rln ont4texnif tydfpDranvo;t0srumxrpiydameelivtat) ruaxm ou0tleo o3iytlaDrmuvo;u)aexrmr oydom r nvo;( texoiopnu1olenmnet ()s2rruro;o1oeeo f3tltfm rau pnt4aeenio todomDe ivo (0trtmimpou1oltn fci t a2urum nu0apen ictatfmDrl(vo;t0 rxrif3tytfpDraneo s0 2uoxopoo1olee ies s s2umurpno1openio3tltla rmnvo;u0teerxocoo1la ranvi t)srum(o3no4ap  livta(fsDurump;u1opxomfetatfa uaumpn(0 ltrmr3tydlmtrlueol()s2to(mpoo4lpe lictas)sDtmxr ou0tptomfctyslm uaums;()trtomo ia1laDe nvs s0 etmxo oo4oltnlfctlt)sDtru  ;u1teen iciasfm ra(vonu4teeomfciytlm eln sls)sexrirpiudlmtn ncil()s2ururo;o1olxoiieiydfm2rm(ms;t)tlxrir3ia1op  aneols0 2toir iu1optemici sfaDuru onu4aet moeiys m el( s;t0 rermf3tytom  lu o;t)teumio3ny4op   icsat)s2urxmoou4teen oeiyd aDrmu o;u)altrmrctytomtran o (0 exr(opoo4lmeemicsa(  rtr( ono0tpt ii3tldfs eanvo (0 eeoxrciytlmD  uvolt)texrir3ou4lmee icsat sDuau oot0teeo f3iltlsDumuvp;t0 reoio3to1oat aneo;s)texm(m nu1am nlivs t artru p;u1aptoif3ildfm2rm(vo;(4 rxrmo3io1lmDeli sl(0trxrxr ny1apeelicia(f 2ua(moou0apen fciytla rl( o u0teenmr3iydomt  ivo s)setmxm ny4oltnmncsa()sDurxront1oee mf3tlsls2emump;t)trerxr3totlp e u o;(0trxrxm3iydlptn fcsa(fs2ua(m ;u0oexnii3tldfm rmuvo;(0tlenxfciydoptrai o;t)seur(m3oydlpt mivia()sDuaumo;o0tetnii3ils a emnmp (0tetrmf3oadoa  ln i (0srxoxm3oodap emivi sfsDtm( ont4opx mf3tysfsDem(msn(4treoxocio1omteluvs;t teuoxo3iu4lmenlnct t)s2ta( pno0tetn feiad m elnvo;()tltrxo3iy1fa eai o t)setrirpoydapenliet t srtmxro;o1ale mfciad mDum(vo;u0alenif3ia1fa r u ols)texmir3nudop emnvta( srra( pot0tpx ii3iltfm uluvp;(0trenxo3ty1fptranvs ( srxmxo3oo4op  mietat)srtmx  ;u4teenif3ildls2um(ms t0tetnxr3iadlpte u ols t2xmimpny4omt  fcsa(  Dua(mont4alx mo3iydfmDranvs;u0teeomr iotfp eli i s t2ur(o3nudalen ivs s) 2rau  ;o4olenmo3ias sDrm(vsnt4 ltoifcoydfmDrlieslt0 euoxrpio4optemnctl( sDtau  nt1ope  o3ils a um(monu)trxnircty1opt lies;()t2xmxr3iu4llt  nvt tfsrtr(mpot1oltomoeias m2rluvpnu)tetrio3iydlatelies s0s2xm(rpoo4lle  fvsl(fsDrmur ;o1olto iciytfs2emumo (0alxoir iy1fm  lnei t0texmxopou1lmee nvtlt)a2umu p;t1tlxo f3tlt m2el(vs ()alxrxr3iy1oaDrln slt)trxoio3nu4apte nvs s a2ta( oot0optomi3ils mDem(vont) lenif3io1op e u i;t trtrxr oudllte ies ( s2ur(rp;u4tee io3iytlm um( s;(4trerir3totfmDeauei s)s2toim3oy1am n ncs sf rum(mono1tle  oeiydfm ul(ms t0 lenmfciy1op eaivo (0trum(m ny1lptnmfctatfartrurono4opxomi3ils s rl(ms;t4tetrioctodfmtrlnei t t2xmir nu1am nlnei tf 2tm(m ot1teeo o3tls s2ulnmon()altrmoctydfateaivo;s s2trim no4llen nvt tfa2rmurp;u1tetnio3iat a2rlnms u4trtnio iydlmDe n s;(0t2xm(rpio1opte ietl( srra(r oo0oleoioctldfm2uaumpnu0 rtrmo oadopDrlnvi;s  rtmxm3iy4ol  miesl()sDrm( pou4aleomo3iadfmDum(mp;u4areoxo3iadlpDelivo s0sexo(o3oudome  ietlsfarur(m no0alxoio3tat m2rlnvpnu0 eeoioctadoaD lu olt tetm(opiy1ll emnctat  rrrumpou4oexo ociatfs rlu s (0trxnifciy1lmt au ilt  rxoio3nudlpt miet ( s2ur(mpnu4optnmfctls sDrm( s t4 exnxr3ootop elueo t)srxoxr3no1llee fvils)sDta(m ;o0tptomfeiydfs2ra( s;u0trenmf3iatoptraies t)srtrxm3iy4optn neiatfsDua(rp;t0tlt iieiasla emnvont) rxrmrctatoa  lneo ( srtrir3iy1ap emivil( s2rmx p;u1altoif3tysls2eaump;(0 lxnif iy1fptrluvsls) rtoxrpiydlmen ictat a2rmx  oo4aeeo f3iysfmDua(vp;u0arxomo3todfa  livol(0 eumim3nydape  nvil(f 2rr(mo;o0tpxnifeilsfa2umu pnu4 rxoxoctodlmtean il(0trtrxrpoy1lmeelicslsfaDrrur ;o0tlt  fctadlsDumn o t)aleoir oy1omt anvi;t)srxo(r iodlmeemnctl(fa2tau  no0optnifeiltfaDumuvo u) rxoxr3oydoaD livol( teurimpnodaleemncsasfs2tmx  no1openmi3iadfsDum( s;u)alxoxf totfptrauvs s  2toimpiy4lp  lfeslt s2rmx poo1apt  i3ild s2emu s;()altrmf3totfat  ieo;s)tetrir3nudlmte ietl() rtruro;o4ole  ietld s2eau onu0alxrifctatfmDrluvo t truo(r3no1apee nvsl() rtaum ot0aexnmoeiytla2um( o;u0tetnmf ta1fpDrai s s texmxr3nudap  mfcs () rtax pno0tpt mfeiytfa2emumo;()teeomo3tatfp   ivi s0srur(m3ny4lmeemnci tf Dra(mooo1opx  f3tytlmDrm(msnu4tltnif3totfmteai ils)teuoio no4lmeemfvtasfa2raump;o0ole  icias a2ea(vs;(0trenir3ootlmteln o;(  rtr(mpoydolt  nvi sf rra(mo;u1apxn o3iyslaDemuvp u)arermf3todomt lnvs s0sexrir3iy4opee net s)aDra(r ;t1apen i3tasfm2ul(ms;t0aeeomo oytlm   ivols  2xoir3oy1lmenmnct sfaDtaxmont1alxomietlsfaDumnvo u0trerxfcoadfptelu il() euoio ou4lleemnei (f 2raxm ot4aexomfciatfs ra( p;u4alerxrctotopt  ivo;s trumxo3ou1lptnlict sfa2tm(  no4apx ioctltfs2ua(vs;u)tlxnmociy1lmDrln s s) exmim no1ame lnvt t)srtru ont1aptoii3iasla rauvp t)artrio ootfptr uvi;s0setmxr iudamen ictl(  rrmump;u0oeeo i3iydlmDra(vp;u0altomocoy1fmDeaues;t)trxo(opoydlpenlivtl(farrau p;t1alxnmi3iadlm eanms;(0artrxr3iotoptrlues t)t2xr(m3oo1openmfcsa(f 2trxm nu4tpt ifeilt sDrl( s t4alxoio3ty1fmDe i o;()seuoxm3nu1llt mnvs s aDum(r ou4olt mfctadfs rln snu4alenxr iy1faDelu sl(0 rxrim3oydameemfvta()sDumxmp;t4oeen o3tas s ea(vs u0 rerxo to1fm rlnvi s)setoxm3oy1ll emivi t)sDurxmooo0opx  oeiysfmDra( p;t)trxnifcootlm  lu sls s2xmxo oudal e icsl(faDta( o;t4aleomi3iad a2rm(mont0 rtomo3oy1lp r ivs;(0texm(m ny1optelicsasfsDraur ou0apt ioctyt a2eauvo;u4 etoxr3iodlp eli il(0s2tmxrpio1lp emictls)s2umxrpot4tet iociltla2rmuvpn(4altrmrctatfmt lnei;t  etrxr oudam nlivi s)srra(mpot0olxo f3iysfaDrlumo;t)trtoio to1fm rli i (0trtmxm3iy4aleemivs () 2ua(mono4optnmf3ildlm ulnvo u) rerxo io1op r n o;t0s2to(r ou1lp   ivtat) Durx pno4tpxn ieiad sDulnvo u4trxomr iydlatean il(0texmim iu1lpenmfvt (fsrrm(mp;t4teto f3iaslm2ua(mpnu4 exnxf3ta1fpteaneslt)teumir3oydlpeelnct (f 2rm(moou1ope mf3iydfm2rau snu0alxrxrcoadlp eauvi;s) 2xr(r3iy1oltelfcilt) rtm(  no0tpxnii3iysfsDua(mpnu4artrmo3iydlmDrlueols0s2ur(o3oy1lpeelfctlsfs2rrur oo0teen oeildls2ua( p (0texomrciadop  anvil(  etoimpnydape mivsat  2taxro;t4aptnmfcilslm uanvo t)tleoio tadoaDe ueo t  etmxm3io4lm nlieias  2ra(m ou0opxo f3tydla2rm( s t4aeenmf3oatom r nvils0 etoxo ny1lptn ivtls) Draxmp;t0opto octlslsDra(ms;t0aetrxo ta1faDeaieol(0texoir3nu4omenlicsa( aDum(m ;u1ope iieiat mDuau pnu)arxnmo3iadlptrluvs;s  2xoio3oy1lp e fet t) rrm(mo;t0alto ietyslaDrlumpnu0 ltrxocootfpt ai olt) 2xm(o oy1ame lnctlt) 2trurpno1ape mo3iasfa rauvp (0texrxo iy1omtr nei s trtrxr3iu1ale mnvsa(f rumxmo;o0oeen i3tyd m2um(vo;u)aexoircta1fm r u il(0srtrxm3no1ol nmfeil(  rraxr ;o4apt  oeiatfs2uaumont0 rxoio3ty1omtranei s)s2tr(mpoo1optn iesas)s2urum ;t4olxo o3tyd m2ulnmp t0artoio3todfm  liesl()trumim iu4ap  mfeias  Draxrpnu0oexoifeiltls2ulu snu)arxoxfcto1lmDr ivsl( s2uo(mpoo4ll elnvsat) Dua(monu1tlx mo3tasfm rmnvsnu) eenifcoa1lptelieslt0t2uo(r3iu1ole lfesls)artrx oou1ole if3tadla elumo (4altnif3oytom   iei;s0 etoim oo1omtemietl(f rtm(rpnu4tlxo i3iad s2elnmon()aleomf3oy1fmDelu ols0setoim nu4lp n ictas  ruau  ;o4tpxnmoeiadlsDel( ont)tltoxrciatoatr uvs;t0 2toxr iy4lpt mivias srumxrp;t0texomoeildlm2emnmp;()aexnmrciodopt  u o;(0srumxm3iydamtnmneia()a2truroot0olxomo3iyd s ul(vp;u) etoxf3iodfmt lnvilt0sexmxr3nodom elnvtls  2umxrp;t0tetomoctytfs2ea(vp;(0alermo oydfmte neo;(0 2trxopnudop emncsa()arrmx ont0alxo feiydfmDuanmsnt)aetnxrciotla  livslt)trtoio3iy4lltnlicta( a2uru ont1alto iciyt aDuanvo t0teenmrciy1lat lu i;(0 exoxo3iu1alt  ieslt)sDtm( pnt4opt  f3ildlm emuvp u)teeoxo ta1fmtelneo t)t2xmxm nu1op nlivias  Duaxm ;u1teeoifeildlsDrmumon() etrxo oytlmtelivo (0tetrimpny1om  mfcsas) Dtr(moot0apx  fetydls uan pn(0trtomf3ty1op elivo s)trxoxm iudlp  mnei tfaDua( p;o1tpt miciysfs2rl(vp;(0aleomr ootom rlu o;()teur(r3iu1lpeeliet s  rtrx pnt1teto i3tysls2emu s;(0trerxoctodomte n i;s  2urxmpoo1al  lfesas)sruaxrpno0tlx mfcildfa em(mo t4 rtrir iatoa raneo t0 ruo(mpiydopeelictat)sDrax  oo1oleoiictytfs emnvpn(4aexnmfctydfaD  ueo;()t2xr(r oo1am   fvt tfs2umxroou4oleoiictysfs2el(vo u)tltoxfctatom eluvol(0 exr(o ou1lp emieil( s2uaum nt0oex iieiys a el(monu0aexrifciotlp  li ilt) eurxr3iodomt  nci t arrm(mo;o4tpto feiyslmDemn onu) ltnir ia1lmtr u s;(0t2trirpiudapt  iei t) 2raxro;t0optomfetlslsDrln s t4trenxrcio1omD  nvol() rtmir3nudlpte ncsls) rtax  oo1tptnii3tysfm emuvpnu4altnmo oa1oa rauvo t s2trxrpoo1lpte nvsltf rtrumo;t4oleoioctyt aDrm( s;u4alxnxr3oa1fpD lnvi t) eto(o3ny4lmtemiciltf 2tru p;u4tpe mo3iadls umnmsnt0texomf3ty1lm eln s ()s2umio3oy4lmee nctl()s2tmu pnu1apeoif3iytfm ea(ms (4texnirciatoaD  n ols  rtr(o iu1op nlivt tfaDrmum ;t0apxnmo3ild sDrmu o;t0tltrxf3iatlpD  ieo;t trurim3ou1lmtelnvsl()a2ur(mp;o0tlxnii3tydlm2rl(vpn() lxrxr oo1la rluesl(  etr(m3no1om emfctl() rtaxmont4tlt mo3iaslm eluvp () lermrciadlaDr uvolt0 rxmiopiudop  mncslt)sruau p;o0ape  oeildfs ea( p;t0aeerio3iy1op  ln sl(  ruoxo no1olenmivi ()srrmu ooo1apenii3iad mDuanvo;t4alerif3totoatrlivsl() rxmirpoo4amen net tfs2um( o;o4alxomfeiasfm emuvp;u0 leomociydoa  li slt truo(o io1om nmfvsat)aDraxroou1tltoiietat s2ra(vo (0aexomrcoatlm  aueslt)trum(r3iu4oltemiesasfa2tm(r no1aee iictlsfs emu pnt4 lermocoodlmDr uvi;s)srtmxo nudam  lfetltfs2rmx pou0alto feiytla ranvpnt4 lxnmfciotfpt  neo;(0setriopiu4om emfcil(f 2tr(m oo4texoiieiaslm rlu sn(4trxoio iydlm rlivs t)teumio3iodoltemfct (farumxm ;u0alx ifeils s2ran on() ltrircoatfmt an s ( srxoiopoy1lltemnvi s)srrmuro;t0tptomictltfa2rmums (4 reoifcootfpDrau ol(0t2urimpiy1aptn ieilt a2rm(rono4opt  f3iyd m rlu p u) exoir3iydla  aiei;(0teur(m nodolen feslt)sDrr( pnu0alxnii3taslmDra( s;()areomr iotla eau ilt teumxo3iydlltelfeiltf rra(mono4aptomociltfs2eaums (0aeeniociotlp  anei;()sexoir nodaptnlfesas)s2rrxroou0opeoii3iatlm ulumpnt)tlxoxr3oo1lp e u olt0sruoxm no1am elfeiltfsDua(  ot1altnmfciatlaDrlnvs;u0tetnif iatom rau i;s  2xrxr3nodlpenmfvt (f rtmuro;t4tpeo feilsls ul(vonu0aetoxrcoy1lmtrlu o;(  etmxrpnu1olenlfetat  Dtru pnu0teen ieiysfm2em( o t0 rtoxr3iytfpDelu ilt) 2xm(mpnudllee iet () rur( o;o0tle  o3tatlsDumuvs t4 lenxrcoatfatraneols)t2xrir iodap  lnetl(  2uaur nt4tpxoioeias m2rl(vp u0tetrxf3ia1fa e ies;s0 etrio iu1lp nmietlsf 2tmu onu0tptomociatfs2rmuvonu4teenioctotlm e ivs;t0s2trim3oudapt  ieiltf 2rau  no0tltn i3tlt s rmn o;u4aexrio3oytlaD lueo (  ruo(r iu4llt lnvi t  Dtmu  ;u4olen ociydfm ua(mo;t) rtomr oatlaD auvs t tetriopnu1omt mfvi tfsruau  ou1tlxomo3ildfmDrau onu4 etoxf3iodoa   ivol( s2urxr nu1optemivtat) rrmu oot1open ociat a ulumo;t)tltnmfctadfatr nvolt t2ur(o iy4optnmivt sfa2trxro;u4apeo i3ias aDumnvpnt0 rtrxr3ta1fpte uei t s2toxr3iu1alt mfvs t)aruau pno4tleo o3ildla ea(vont0teerxfcootfm rauei;( srtr(m3no1lmen fctlt artmu pou0apto feiadlm2umuvs;t)aeenioctotom   ueilt)t2trim oodaltemnciatf rrrxmp;u1oeto iciysfa2em( pnt) lenifcto1omtrlues;(0 rtrimpou1apeemivtatfsDumum ;o4apen fciltfa emn onu) ltnxo iodlatelivslt0 exr(mpno4lpenlfcsl(  rrrx  ot4oexnmietldla rln o t4aetnir3ia1faDeaueslt sexmxm nu1ole  nctl(fa2tm(rpot0optnif3ilsfm rl(mo u4 lenxr3oadfp r neslt0texmxr3nu1ap e fci sf 2tru ono4tpeomi3iyt s2uanmp;(4treomo oytlmtr nvi;t srum(rpnydal   nvilsfsrrrxmp;u1tpenif3iyd m2rluvp (0 etoirctadfmDelnvolt  etrxr nydll   feil(fa2urx pot0aetn fcils mDeanmsnt) rtnmoctodlp r ivil( s2xrxm ou4ale  neta(f Dtmx  ou0tptnmfetyd sDua( on(4tlerir ta1fmD ai o;s  2tr(o3no1openliet s s2ra( pou0tlxniociytfs2uln snu4trerirctodomt lies;(  2uo(m3no1lp nlivi s  rra( p;u1tpenmieiydla2em(ms;t4trtoir3oa1fp  lneol( trxo(m3oudal  miet t) Duax pno1olto o3tltfaDrm(vonu4 ltnxo3oodfmtelneol()trur(opoo1ap e fviat)a2rmx  ot0texnmicils m ul(mp;t4tleomf3iy1fa   ueslt tetm(r3ny1ol   fct t)arta(monu0alxoiieild m rlump (4 lxnir3oy1fa r ueo;( s2um(o oo4lpt  nctat  2trurp;t4opt ifeiadla2um(vonu0altrio3iydlp   i o s0 exrim3iy4lpe mfvias sDtaxro;o0tlx  o3iytlm um( ont4 exnmfcoa1op  ln i t)trur(m ny4alt liet (faDumxmp;t1opeoif3ild sDrm(msnt)tleomociodfmDeai o s0s2ur(opiu4ll n iei s)aDurur oo1aexnioeildfaDuau o (0aexomoctotom   uvilt0sexr(m3ou4ap n ietat)srtmu ooo1alt mietlsla eauvo u4trerif ta1fateliesl(  eto(o3oy4lmee ivslsfsrrmumpno0oeen oeiatfa rmn sn(0trxrxrcia1opDranvi;(0 rxr(mpoo4om  mnvsltfarua( pnt1alen o3ilsfs2emumpn()aetrif3ty1oaDr uesl() 2xoir3oudomenmneils  Dua(  ;u0tltnmi3iadlm2ulnmo (0aexoxf iatomDe i ol(0s2to(r3ou1optemfvias) rumurpou0tlxo ieiat m2um( p;u)tetnxo oatfmDrauei;t)t2trxopno1om  lnct t)aDraxmp;u0open fcias m umnmo;(0tlxoxrcoy1oaDe ivs s0s2xmxopny1aleemfcsa()srrrur ;o0aleomieiytfa2rmu p;t)aeermfctydom  au sl(0sruoim oydol  lfcsat a2umxr ;t1texniociysfm2ra( p t0tlxrmfctydfatrlu sls)setrirpio1lmtnmfvsat arrrxmp;o4aet mo3tatfaDulumo;u4 rtoxfcty1lpDe nvs;(0s2to(o ou1oltelnvta()arrrxro;u4apt ii3iadfsDrm(mp;t0artomrciodlmDrli i;s0 2xm(m3iodaltnlivi s)sDtr(mpnt1oeenio3iys mDeaumo;(0arxnif3oa1fp r ivolt0 eur(r3ny4olen nvt tfaDur(  ;o1ale if3tysfs2rlnvs;u4 reomfcta1omtr ueilt  2ur(o3io1om  lfcils srrm(rpnt0tptnmfeiatls umuvo ()tleoxrciatlm  ai s;t0s2to(rpou1optnlfvta(fs2rrumooo0ope mo3iasfa2umnmsnt0arenif iotoptr nvs;()trxrim iy4ap nlneiat) 2uaxr ou0aeeo oetytfs2el( sn()altrif3tadoptr iei (0 exr(m iodole  nctl(fs2taur ;o1oeeoif3tytlaDul(vpn()tlerxfciydfate uvo;t0s2umxr3iu4om emnctls  rrrur ;u4oee iociadlaDeauvp;t4 exnxo iytlpt  ivo;s0 exrxmpnodop nmnetlt) 2ururpnu1aeeo fetldfa2umnms (0 leomo3ia1lmDr uei;s0 rumxmpiodlpt  fvsl()aDrrum ;u0teto feiadfsDeauvsn(4tetrio3iydoptrlivsls0setrio iy4lmeelfeilt) Dtau poo1oltnmfeiys s2ea(mo ()arxrmfcootlmtrli i;s0s2xo(r3nu4amt mneil( s2umur ou0ale  o3tad sDrau sn(0 lxoxoctydfp elueols teum(r3oy1lpe  ict ( sDta( pnu0aetnifetld a2rm(vonu)aeeomf3oydfa eai i t s2xm(opiu1alee fcs t sDur( ont4apeo o3ias aDrm( o u4 exoxo3ootoatelivs (0tetm(mpnodapenmfvsltfaDuaxro;t4tpto f3ild s eluvont0 eenmfcoytomD  ies s t2xrimpio1lltemiei tfaDrmx  no1tle  ictytlm raumpn()texrmr iodfpt  ueo s)t2xmim3iudlltnlfeia(faDua(mono1tpe ioeiadlm2rauvo;u0aeerif tydoa  lnvs;s) rtr(mpnu4alt  ivt sf Dtmxrooo1opxomf3ils s2em(mo;u0artnxo oatfmte ueo (0t2xm(m oo4am  mnei t)sruaxmp;t0tet ifetysfm rluvo t4trtrxocoydfaDe ieo s)s2uo(o no1lm elfvsl() rtaum ot0tlenmfetlsla rlnmsnu4 rtoif3iadomD  nvs;s  eto(rpiu1lpt  fcsasfsDumxrpnt0aex ifetlslmDelnmp t4alenxoctotfmtr ieo s0 etoxo3ny4am  micilt) 2ra( onu1opto o3tldlsDelu o;u4 rtrmf3to1lateauvi ( srxoim3oy1apt livia( sDrauronu1aptomoctadfa rm( p t)artrmfctytop rli sls0seum(m oo1alenlfeilsf rrrxrpoo4tpeomicildfm2rm(vpn()trxrir tadfaD  iei t0teumim ou4ll  mfeilt a2tmxmpnt1altniictatlaDrlump u0trxomr3ia1om  aivi t)s2urxmpoydam n nvsa()arua(r no1tlt mo3tasla2ulump;t4teeomr3ia1om eai o ( seuo(m3nydalee ncsl(f 2rr( pot1tpx  ieiys sDrlums t0artrircoo1lmDraiei ( s2uoxr nu1lpe livi ()sDtmxr ;u0oeeoioeiltls el(vs;t) ltnif tytfmDrluvo;s srurxmpoudll emfcs s srrrumpot0tet ifeiat s2ran o t)areomr3iadfmD an sl(  eurirpiudlp   nvsls arrr(rpoo4apx moeiatla eauvo u0 lerir3iytfpD an ols  2xrxrpiodopenmfct s)s2rrur ;t4aexnmfctls mDrln o u4tleoio ootopDelueo;t)s2toimpoudolee neslt) 2uaum oo1oltn i3iltlmDel(mo t4 exrifciy1op  ln s;(0 rurxr oodap e ieil(  2umx  ;u0oleomfeiydlmDeanms;u0texniocoadomtelieo;t srumio3oy4lp   icsat) Duru o;u0tpx  octytls rl( o (0trtnmo oo1fpDeau o;t0srxoxopiy4lmtemivia()sDtmumoou4tet if3tys aDrlums;t4 rtoir oydopDeliei (0teumxrpiu1lpen iesls)a2rmx ont1opt iietatls2emumpnt)teenmrciodom  lnei;t  etmirpiu4al n fvta()srtm( pot1oet mf3iys mDemnmo u0texrmr tadlaDe n o;s0seurxr oy1lptn neslsf 2uauro;t1olt iociatfs eaumo u4 rermo3tadfpDe iei t s2ur(r oo1lm nlfesatfsrra(monu0altoifeiys s2ulnmo;(0teerio3oydlpDe nvs;s) rxmir3oudameemnet s) ruru ono1ale if3tad s ranvont4 exnxf oydlaD  n s;s s2tr(m3nu1amen nesl(f rrr( oou1tpeo octys m elnvonu)aeeoio oadoaDr nei t trto(r3oydll n icta()s2taum ;u1alxo f3iysfmDrm(mont4 etoxr3ootopDeau ils0texrir iudole  fvi t arrmxm ;o0ole ifciyt aDranvpn(0 ltoxocia1op eau s t0sexoxo nydamee nvi t)sruaxrp;u4tpx mf3iys sDelnvont0 eerxf3iy1op r i ol(0tetrirpnudll nmncsa()s2trxrpot1texn ieias a2rm( ont)aeerir3iodfa  ln s;s sexmiopoo1alee ivtat)srtruro;u4apen f3iysfa2rmuvp;u0altoifcoadomte ivil( s2urxr iy1op emnvtlt a2taxmpnt0tpeo fetltlm eaumonu)aexnirctytfmDrlnvs ( srto(m iy4ome liesas  rrm(mpot0tleomicilslaDrm(ms;() leomrciatfmt  uei ()srumxr ny4ol n nvil()sDrmxrpnu0opt moeiysla2rlu on(0artrmo3oy1fp e uvo;(0 exr(o3oo1lpt lnvs t aDtr(rpou1aetoiictydla rauvsnu4texrxr ootfp ran ils s2um(o nudomtn nvs t aDum( pot4alxomfeiyt a2umuvp (4arenif iydopDelu o;s)trxm(o3oudap emfcia(f Dtru  ou0apxn f3iyd a rmuvsnt4tltnir oydfmteaieilt0 rxrxm3oy1ameelnvtlt)s2rmx  ou4tet mo3iydfm rln o;(0arxnxocoa1faDeau ol(0s2umio3oy1lme lfcils sDua(r nu0oex ioetydfm2ul( ont)tleriociadlaDrauvo s0s2to(r3nu4lptnlfvs tfaDtrurpno4aleomo3tls s rau s;t0aetrirctytfatr ueol() exmirpoy4amtnmfeta() rtmu p;t4apto feiadfa ul( pnt) rxnmr3ia1oaD ai sl(  exm(rpno4lme mncsltf Duaurpnt4tpx  ictatlm ranmsnu0altrmr oytlateaivslt trtr(opny1om nliet t a2raxr ou0tltoii3tlsla uau o;t)tlxrxr3iy1fm r nes s)s2uoirpoudlmeelncsl()aDuau  ot1aet  ociasfsDrauvs ()trxnmr io1laDranvi;(0srtr(o io1aptn ivsa()a2rrurpot4tetniociasla2rmu o u0artrmf3ia1la eln i;() ruoxr no4ll elfvsas)a2tmx poo1aetoifeiytlsDra( pnt4altnxr iatlm r nvs ( sruoxr iy4lpt lfeilt) Dur(moou1olxnii3tyt m2uanvont0aetrircty1omD auvolt tetrio nu4amt lncias aDtrur ;t4oet ii3ild s2rmu on(0altoir3totfp eliesl( s2ur(rpio4lm n fvs t  ruaur ;u0alenmoeiyt s2ran snu0aetnxf to1omDe n i t)s2umxo3iy1op nmfes t) 2trxm ;u0aexoifetyd sDuanmo t0arxoirctodlmDraivol(0sexmirpnu1lmtnmictasf rra(  nu0tleomociysfaDua( p u) rxrif3tydfmDrlnvils0 eur(o3ou4ame lnesl()aDuaurpno1tex  i3iadfm2em(vo;u0texnio3oodfate ieslt0seur(mpnodomeemnct sfsDurx  ;t4alxomfctydlaDrau o;u)aexoif tadoaDelu ils s2urio3no4oltn nvsls aruau pnt4olx iocilslm ulnvs u)altrmr3tydlm elu il()sexoim iu1lmt mictl(  rrm(ronu1olt mo3ilt mDelnmp;u)teermr iytomD  u s;( s2trxr nodlmee fcsl(farumxro;t4teenmoetlt m rm(mp;u0trtrxocoa1om rlnvi (0trxm(r oy1ole lfei s) Drax poo0tlxn fetad a2ranvp () ltrxo tytop eaivsl(0s2xm(m oy4am eliesasfaDtrxr nt1alx mfciysfa2ranmp;t4treoircio1fatrlu o (  eurim oo1lm e nvi (fa2um( pou4tpeomocils a ulnmo;(4altomfcta1omt aivi;()texm(mpoydll emncsl(f 2um( ooo0olenmi3ilsfaDra(vp t0treomr oy1op eau s s) 2urio no1lleelncsltfa2uax  ;t0texo iciatls2eanmp (4alxnxfctatfaDe ieol( t2umxopoy4am   fcsas)aDuru  ;u0ole mf3iydlmDua( snt0alenircoodoaDe n o;() rtoim3nu1amtn ieia(  Drmx  nu4olto f3iytla ulu p;(4 rxoif iydomtranesl() euoir3nodlmenmivsat  2raurp;o4opeomi3iadla2rm( snu4aleomrcoodlptr ivi ( srumim nodam e icslsfa2ta(ro;t0alx iiciatfs rl(mont4tltomr3ia1opD lieo s teuoio oo1am n ivs ( sDtau ont4oeenii3tld a em(vont0alxrmr todlate ieo;( sexriopno4op nmnesa( srum(ro;o1oeen o3tasfs2rm(mp;t)artrmo3todoaDe uvi;s0 ruoir3oo4apeemfctlt) 2urx o;u4tlto fctld s rmnvo t0aexoircootopteai sl(0 rxoir3oodaptnlnes t a2urxrpnt4tpxomfeias aDem(vsnu) ltomf oa1oaDeauvilt) 2trxo nodopt  fcsatfsDtr( p;o1oexomociytls emu ont4arxomf todfpDrluvo;(0s2trim nodlp   ivta( arurx pnu0olxn fcils aDeluvs t0artrxf tytlm rau i;t0s2tmim3nudlpe lics s)a2umu o;t0tlxo i3ias m umu ont4trermo ty1laD lu ols0 rxo(o iy4ole  neil( s2raurpno4tptnmieiytla2ul( p (0teermoctadla eaivsls0sexoxm3ny4aleelneslt) Dtax ooo1tlx iiciys a2ua(vo t0trtoio3todlpt aivol(  2toim3no4olen fvs () rur( poo0tlenmo3tltfm eaump (4treoxocoydlp   ueo;t)texr(r iy1ame livta(  2rm(r ot0teen ieilsfs uanmp;(4 rerir iadoaDrau ols s2uoxmpoo4aptn fcil(fa2rrxr nt1optn ietldlsDra(vonu0 rxoxr io1fmDeli s t0 exrio3oo4lme  nvs t a2urx pnt4tleomictytlm eluvsnu)aeerxrciadfm  luei;s0trtrirpoo4lltemieias) 2ra(mp;t0apenmfciysfm2el(vo u)tltrmr3iotla  livslt0s2xoxm3nu4lm  liviasfartrump;u1tpx  oetat a eaumonu0aetoxr3oadopteai s;(0tetoxm3io1openlnviat arrrxmp;t1olxn iciytlmDrmu o;u)trxrifciy1omt livslt tetmxo3oudol nlfesl(f rur( poo4tlxnifeiatfm2ua( ont)alxnmf3tatfm eanvo;s0tetoxo oo4lltn ivi (fartr(  oo4ape mietysfs rl( snt0altnio3iodlpDrai i;t0s2toxm iydamt lfvtls aDrm( pno0apt mfciydfaDrln p (0 exrmf3oadlmD  i o t)trxoim3ny1al nmfei ( s2ra(rpnu4aexnmfetytfs ra( s u)tlerir iydfaDeai ils  rurxm nu4lmtelictasfa2taurp;t1tpeomictaslsDulnmp;(4 rxoxr3oydomt  n o;(  etmxo io4opeelfvi ()srrrx pno0alx  oetldfs2emnvp;u)arxrirciytlm  luvi;t0seurim iy1lmtemfciatfsDrmxr nu1opxn fciltls ul(vs;u)tleomo3todoaD lu slt0s2xm(mpiu1ol  miet (  2tr(m no0oeto iciydfmDelumo t)tlxrifctydomtrauvs t0 2xoirpoy1lle mfeils arrru  nt0oetoif3iaslm2ulumsnt0trermrciydom rlu i s)sexr(o nu4opt mfvi s  Drrumpnt0olxomi3iysfm rm(mont) rtomr3todop eauvs;t0t2xo(o3io4alt lfcs tfa2rru  oo1tleo feilsfs2um(mp t0trermfcto1latr uesl() eumxr3nu1ll e ncs s  2urx ooo0apxnmf3ilt a2eaums (4 lxrif3oodop e ivo;s0 2uo(o iu4alt mfct tf Duau p;t0oee  oeils s eanmpn(0 ltnxocoa1oa e ueo s) 2tmim iydam nmivi () rumxmpou0aleo f3iys m2ulumo u4artrxf oa1lmD aneslt)srurxm3iudllt mfvtl(f rumump;t1tpxomicils a rl(mpn()treomr3oydop eau i;t0srxrxr iudal n fcsat sDrmxrp;t4aex if3ildlm2emnmo;(0treomf3oa1opteluvs s t2xrxrpoydlpt mivs s) rrru pnt1alx  oeilsfsDua(mpnt4 exnxfcoy1fatrln i t t2urimpoo1lp elnctasfaDra( p;o1tlx  i3tydla2elumpnu0 eeomo3totfpD  nvi s0srtoim3iu4ome lietl(  2ta( ono0tpt miciatls ua(vp;u4aetoxr3oadlpD  ueo;() etrxo io1amenlfei s a2ua(r no1ale mociasfmDrmnms;(0alxomr3oydoa r neol(  exoxo iu1lmt livias  Drmxronu4opeo f3tasls2umnvp ()trxrif tydlateaieolt srxoxo oy1ol n ncs tf rtmxroot4optomfciysfm2rluvpn(0tetomr3tytoaD anvslt) 2xr(o nydlm   fvsatf 2ra(mpnu1aexnif3tydfsDrauvp;u4arenxfcoytlm raieo;t0s2toxr3iydlp  mfeilt)arurx ont4teeomo3iytfsDul(vo u)trenmf oo1faD aueo;()setrir3oudalt  feiat) 2uau o;t4olen ietydfm2ran snt4alxnxo oy1oaDrauvs;(0srumxo3oy4op e iesat)srraxmp;t0opxn feiatfsDelnmp;(0aetnxf3iodfptrliesls  2xoirpiy1ale mnesls)a2rm(ro;t1apxo ieiadfmDumuvo t)arxomr3iadfm e ivi t0srxrxrpny1aptnmivsasf rrm(mo;u1tptoifctyt aDrm( p u4 etrxr oy1fp ean il(0 2ur(m iydamt  fcsl()s2rru oot0teeo fciydfm2umn snt)trtrxrctytlmteaiesl() rtrxmpoy1llee icilt  rtaur ;o1oexniociyd s ran p;()tltnxf3ty1fp  auvi s trxoxr3nu4lmtnmnetlt)srrmumo;o0openio3iysfmDranms t0teermr3oadlmt au s;( tetoxr3nudlm nlietas)s2rmx ooo1opx mi3iatls rm( s u)aetnmfcia1fa   i slt0 etoim3nydlptemfci ()artrur nu1tpx  oetad m rm( sn()tlxrirciotla rlnes;()t2tm(m oy1op nmnctlt)s2um(rpou0oexnioeiadlsDul( o u0 ltnmo iatfmDe ueo (0truriopny4ameemfcilt)a2raxm no4olt miciys sDumn s;t4aetrxf oadop eaies;t)srxmim oydlmtn ictlt  2rrx  no1open f3iadlsDel( pnu4 lerxrciy1lp e ivo (0t2xoxr3iodal   icsls)sDta(rpot1oex  o3tadlsDemnms (4trerxfciodfpDrauvo;s t2xmio iu1amt  ics s  2rrx onu0olxn ieiydfsDeaumont4 rermo3iy1omte nei;(0 2xrxm3iu1llenmfeslsfs2um(r no1opeoio3tldla ea( onu) lxrir3tytlmtr ueolt0s2um(m oy4optelnct sf Dumumpoo4olxo i3tat m ean pnu0 rtrxo3io1lpt  uvs ( sexrio3ny4omtnlicsls) 2ta(rono1aeeoiociydfaDulu snt4tetomf to1omte i il(  2xrxrpiu1ap nmfcslsf 2um( ono1teto fctydlm2rl(mon()alenir oodfaDrau ilt trtrxo3oo1apt  nesasf 2rrxrp;t1ole  i3tys aDra( sn(0 leriocio1fptelu s s) 2xmim iy1aleemfviat) Dum(mo;u4apx  o3tydfs umnvp u) rxnmr ta1oa elnes ()t2xoiopoy1olenmnvt t  Dtr(rp;o0texomfeiadlmDelu s;(4 lxomf3tytlpDraueolt0 exmxr3nu1llee ivi s artrum nt1olen o3iad s um(vo u4 etrioctytlp raivsl()trum(m3nudolt  fcs s) 2tmxrpoo4olen oetlt mDrlu pnu)tetrxf3ta1om  anvi () rtmimpoy4alt  ietlsfaDumxm ;t1tptnmfciysla ulnmo;t0trxrmr3iotom e ieols seur(m nu1ope  fctls srtm( o;t1opxniieiadlm rlu s;u)treoxr3iotoate u s t  rto(r3nydamtemneiltfa2taxmpoo0oee moctasla2emnmo (0tltomociotom  lieil(0t2xm(rpny4am  lnvs tfs2tau pou4aetn ociat a eln o t4 etrxf to1lmt lu sl(0t2xrxr oudolt  ncslsf rtmu ono4ole miciadlmDrm(mo;(4trxrmf3todlptranvslt  rtoxo nydllenmfcs t) rtaumooo4tlt mfeiysfaDrmums;t4 leriocty1lmD lu s;t  exoxo iu1ameemivi s sDumu p;o0oexoioeild sDraumpnt4treomr3ootlpDeauei;() etmim ny1lptn ncias arumumo;u4oexnioetltlm eau snu0tlxnmrcoatlaDelu ils0seuriopnydam e fct sfaDrrum ;t0opt mocild mDrmu o;u)altoxrciy1lmteln ils teumiopny4oltemnvtlt sDraurpou1tpenif3ilsfmDuau o;t)tltrxfciotlm  aies t0srxmim3oudol e nvil(fa2tr(ronu0tpx  iciydfa um( snt)aexoir3oy1fm r ies (0t2ur(r nodlltn nvsatfa2um(monu4aptomfeiadlm el( o u0trxomf iytfpt livo t texmirpno1aptelfcsl()sDtrumo;t4tpt mfciyd sDrl(vpn(4trxoxocoa1oa e nei;t0 rtmxopny4lpenmfctls  2taurpno4oltn o3ildfs ranmon(4artomf tatoptrliei t)seumim ny4llte fcsl(fsrurx p;t0opx  i3ils mDua(vp t4treoifciatlpDelu ils) rxoim oudaleemnes sf Dtr( onu1apt  feiysla rlu p t4trerxo3oatfpDe i il(  2xrxr oy4omt mnvslsfsDtmxrpoo4altomfctlslm umumo;t0trenxr oydlmD  i ol(0s2uoio no4optelicsasf 2um(  ou4tpeomiciltfs2elnmsnu4teermr io1omD li s;t0s2umim nudale lfcilsf Dtmu pou0oetoiiciasfmDumnvsn()tltnmr3tytfm rau o s)trtmxo3oy4ole  ietasfarua(mpno0tee  octyt a umnms;t4 ltrmr tadomtelivolt) exrir nu1omtemiei ()srtmx  ot0tpxn iciydlsDuan pnt)teenirctodfptrlnesls0 2uo(rpnu4am e icilsfaDraur ;u1teenmf3ilsls2eau s t0aetnmo3iodoat  i sls  rxmxm oudol e netat s2tm(mpot0tee if3iydfs rauvpn(4 etriociy1fm   nesls  exrio iu4amte nei t  2ur(mpoo1tpxnmieiasfa el( s (4tltnxo oydoaD  ueols) rurxr3nudlltemnvsls)srrmx p;o0apxomfetyslm2rmu onu)areoxo3ootfat  nvilt  rto(rpou4lpe  fcsa(  ruaxmpot1apx io3iasfa rm(vs t)aexnmf3oytlmt anvi (  2umim3oy4lltn ietls sDra(r nu4oeen i3iaslaDra( s;(0texnmo3oadlatr i ol() 2trirpiu4lmtnmnvs (farta(ro;u1oeen o3iatfs ranvs t) rtnxr oy1latrlivo;t0t2xr(m iy4lpee fci s)sDtaxrp;t1altoifeiadls eluvp (0aetnmo iy1lpt  ivi s)texoxrpiodolenmfvs sf 2umur ;o0tpxnif3ild sDeanmo;t4alxnxr3iy1om e n i;s  rxrxr ny1apte nct (  Dururono0ale io3iyt aDrauvont)alenio oodlmte n i t0srxoxr3nu1optnmfcs (fa2trxroou0aexnioeildfm ulnvp (4 rtrmf3iadoa r u i t0s2xo(o3nu1apee fes t  Dtrxmo;u0opto o3tlslaDranmp t4arerif3oytfmtrlnvs;( t2um(m iy1am   ncia(f Dtrxmp;t1oetnif3iysfm2rmn s;u0aeeoxr3oo1fmD ai i;s) rxriopoy4al   ies tf rrmxmpoo0aetoio3iydlm2eauvont0aexoircoadfaDrlneo t0 rtoimpnu1opt  nvtas artau o;t1ole ifeiytlsDemnvs t0arxoifcoodfp e i ols0teurxr ou4aptnliei () rua(mpno1aptnmieiydla ul( pn(0 rtrxo3oo1fptr ivs t  ruoxr3ny4op nlnvslt)artmuront1oltnmi3iatfaDulumpn(4trerxf iotfptrauvol(0srtoxr ou4lm nmfct t  ruru  nt1tex  fetydls2rlnvpnt) exoxr3oatfpDeluvols teto(o3no4omtnmivtl() 2raxm nt4alxomfcilt aDum( p;u0 rtnmr3io1op eli s;(0tetr(mpnodomenmnvt ( sDurxmonu4olx mfctyt mDelu pnu0altnmo3iy1lmD livo t)t2toio3io1lmte net s) Dtmur ot0tltoiociltfsDra(monu4aexriocia1laDrlnvsls srxrxm3iodllt lfes ()artrurpnt1tex iictltls umn s u4 lenxf totfmD au s () etmxmpiudam elfesa()s2taxr ;o0tpt  ietls m rlnmsn(0areomrctotoa eanvslt srurxrpoy1lm e ictat)s2urx pnt0oeen iciltla eau p t) ltnmf3io1lm  ai slt)t2tmirpou1ole lfvtl( s2tmxro;u1olenmi3ils m2ranvs;u4aexomf oatlaDe i i;()trtoxo3ny4lp elfetl()a2rrxmpnt1tlxomfeiad a2eau pnt0 lenmo totlm   neo ( teumxm3io1ll elivs t) rrrumont4tlt if3iyslmDrln p () lxrmo3tadfaD aiei t t2ur(o iy4al nmfvsa(fsDtrx p;u0altomoeilsls2ulnmon(0tltoxf oadop   uvi ()s2xrxrpnodale  iviatf 2ra(mpoo4aeeo o3iydfa2rau p u) etnmo tatlm e ieilt teumimpoo1al  mieta()srum( ooo1aex ifcilt m2el(mp (4artoir oodoptean s;t srumxr3oo1lp  mfes s aDua(  ou1altoiiciydfs emuvp;u4tetoxocootfmtelnei;s0 2uo(r no1llee nvsa(faDurum ou1altomoctytfm ulu snt4 rtnmr3iytfatr u s;t t2umxmpno1omt mneilt) 2ur(mono0olto feildlaDul(vo ()aetnif3iy1latr ieo t) etmxo3iodap emnctat  2ua(mono4aexoioctyd m ea( o;(0 renirctydomDr ivo;s)s2tr(r3oodome lieias aDtau oou0tlen fctlt mDea(vs;u4 renir io1fpDelu il()trtmxm3oo4lpenmnviat) rtmurooo1tpe mf3ildls uau p;t0trtomf iatlate u il(0 rumirpou4ll e fviat)srum(  nu1tleomietlslaDeau p t4 lerxf3oatoa e uvi;()teto(rpnodll  mneslsf Drrx pnu0aet if3tltfa2elnvs;t)aexnmo3oa1lm raieo;() exoxo nydam n fvias)artm(mpoo0alenioeiydlm ea(msnu0aeenif3totfatr u slt0s2xrim3io1lpenlfesls)a2taump;o0tle iieiyslaDuluvs t4 exniociotlmDeai o;( teur(r3iu1ol  lict t)arurumo;t1oex mociadfsDuaums;t)trenircootfp r nvs;(0seur(m3ny4opt  nvtatfartmur ot1tptnifeiatfmDean o u)alxnif oatfpD anvs;(0srxriopoo4omtelnes s)srrmumo;t4olto fetldfs2rauvo (4artnxfcoydlpte neslt0teto(rpoo4ape  ies s)aDum( pnt0tet ioetltls2ea(vpnt4 rerio3tydfptrluvslt texmxmpnodllee ivtl(f 2ua(rp;o4opxomi3iytlaDrlums t)trxoxfciodlmtr ues;( srxmiopiu4omenmfetat a2tmx  no1oeenif3iat a eanmp;(0 ltnmr3ty1lpt ln ol( srxmxm oodop emfeiatfaDtmxroot4olx ioeilslaDranmp u)tlxoir iy1op ranvolt  rur(r3nodlm nmnet tf Dta(m ot1olt mocilt m elnvs ()trtoxo totlp eaiei t)truo(o3iy4ome mfei ( aDrr(rp;o1ape mf3iytla rluvs u4arenmociytfpDrlies;t s2uo(m ou1ape  feiatfsDtax ont1tptnmiciatla2emn p t4 lxoircoytoaD  u o;t s2xo(m3ny4oltn neiat  rtaxmono1oex  oeias a2eln pn(4altrmr3to1oaD  u i;t0srxoxr3nudolt lncta( sDrr(mont4tee  o3iasfm2rlu pn(4arxomo3totlat lnvs s)texo(o3oydlm e ncslt) rraxrpou4aee mo3tyd a ulu snt4aeermrctytlmteaivi t trxr(m3io1lp eliciat) 2uax p;u4olxomf3tyd a em( p;t0tltoxr oy1oateai s;t0s2ur(r3io1opeelivi ()sDumur nu1oltoioeiltfs ua(vs (0artrxfcty1lat  nvs s s2urimpio4lmee ieil(fsDrm(mo;o1opxomieiydfa rm( snt0aeenxr3iadlptrlivo (0 exmxopiu1lpenlfesat  Dur(m ;u0oeenifcils a eln snt0aexnmocto1fpDrai i t0 2xmxr3nodaptemfcil( aDraurpno0oltoio3iyslaDran s;u4altnifcio1opDrln i;s  2tr(o io4amtnlfvtltfsrtrxmo;u4aexnif3iytla2em( pnt4 ltoxf iotlmDelneolt t2xoxmpoodame lnesl(f Dtmumpno1tptn feiatfm eluvonu) rxnif iotlaDeanvo;(  rxoim nydlm nmfet ( sDrmxront0oex  o3tyd m2ra(mp ()tlxoio3oodfm ean i;t0seum(m no1olt  netat) rra(rpnt1apx ii3tlt mDum(mpnu4aeenxoctydfa e uvs () 2to(m ny4ap n neils aDta(mo;u1tptnii3ias a2ran o;u4teenio3tatfmDraieils trxr(r oodoltelfctl(fsDtm(mp;u4aptoif3ias m2rln p;t) rxrifcoodoat  n o;( seto(m io4altnlnvt ()arra(r nt1tltnmi3tydfa2ul( o;(4 lerxo iytomD auvil(0seurio nu4alte ivt s  rumxm ot1olt  feiadlsDranvp;t0teenxr iodomtrli o t)sexo(o iydol nlivils sDtr(m no0olt  ictyt s ea(mpn(0 eenio3iatlmte nei s0 exoim3nydlmteliet t arrrumoot1oet  f3iyt mDumn snu)tlenmfcia1fm e nvs s)trtmio iy4ape mnctl( arraur ;t4oet io3iltla ra(msn() renifcoydfaD li olt seurir3ny1ole  ncia()artaurpoo0opxn i3tltfa rl(von(0arxrif tytoa rlu ilt  etmxo oy1olee ieslt)aDuaxmpoo1tle mo3iyslm2rlu o;t0tetrxr oodoa e n i ()t2uo(o3iy4ole lfesltfsDrax pou0alt moeiltlm2rluvs t)alerif oadom e uvi t t2um(r3oydlpenlnvt tf Drr(mooo0olxnmociadfsDuaump t0trenmr tytoatraieo;t t2toio iy1am e ncsas)artrxmoot0olen oeiytfsDrm( snu)trxnir3iatfp  auvols s2um(r nodop   fcs s srtmxrooo0tleo feiys sDum(mp;u)aleriociadoatrlnvs t0srur(opoydlle mfetls aDra(moou1apxomieiltfmDrm( p u4tlxoxr tadoa rln s t0 exm(r3oodomtnlneias  rrmxmpoo1tee mf3ilsfs elnmp;u4aexrmf ta1fpDelivs t srxmxr3oodlm  lnetl() rrr(mpnt4aeeniieiysla2rln s t4aexnif oa1lptran slt0trxmirpny4ll n nesas)a2tr(r ;o1oexoifciys mDem( p;u) rxomo tytlp r ies;(  exrir io1lltnmicsas  rtaxrpnt4ope  ociydfmDelump (4aexnxo3iy1opD  u o;(  rxm(mpiydaltnlfcta( srumur no0alx iietysfmDelu pnu)alenio3ty1fpDraues;()t2uoxm3io1amtnlictat  Dumxmonu1tpe io3iyd a2uauvp (0aetrif oatfmD  u o;s0 2xoxo nu1omt mnvi s) rtr(rpoo4teen feild s rmnms (4 lxnxfcio1optelnei (  2urxmpiy1optnlfcs ( a2tru o;u4tleomietadfs rmu o;u0alxoxo iodfmDe iesls)s2xoxr nudomeelfetas)s2rru  ou0aet io3ild m rl( s (4tltomr oatlmtrau olt0seum(m3iu1lme  icsl( sDum(  ou1aexnii3iltfa ua(vp (4tltomocoy1lm  lies;t  rur(r oo4omtemnvs t s2rmurono1altnmocias aDrmnvsnt)aeenxo3tydfpD  i o;()s2xoxmpiydapenlictltfa2taxrpnt0olxo f3ildlm umnmo (4arenio3iydlpDe neils0trum(m ny1lp elncs s)s2um(  ;u1apto feilt mDemnmo;(0aeenif3iy1lp e u olt) 2trir no1open ivilt) 2tmum ;o0texo fctydlsDem(mp t4aeerxfciy1oaDelueolt t2toio nu4am e fetls) rtaurpou1openioeiltlmDem( ont4aetrmr ty1fpte u ols0setoxo3oo4omen ncta(fartr(rono4oleoioeiasfmDemu s u0altomr3iadfpt an s;t)s2uoxrpny4llte icilt  Drr( pnu1aleo feiadfa uln o;u0tlxrir3iy1fmtrli ol()srurxo3iy4ale  ncsltf 2ua( o;o1tlt mo3iyt s elnvs;t4 exomrctotop eaivslt)t2xm(o3iy1aleelfvt t a2uau ont0alt ifeiltfmDrau o;u4 lxomocia1oa eaieils0t2xrir3oodlleemies tfs2urx o;o4apt  ociltfa rmnms;u) eerxociadfpDr ueslt0tetoxopno1alte nesa(f 2um(moou0aeto f3ilsla um( s (4arerirciodomDelu o;s)teum(m oy1llt liet () 2umuro;u4tlxnmo3tas a rau o t4 rxoir3tydfmDrln i t) rur(o3iudolte ictl()arumxm nu0tlxnmieiadla2elnmon(4 renmf iatlatraueil()t2trxopiy4apt mivsltfaDra(rooo0tetoiociydlsDrm(ms;t4aexoif3oodoatr n i t0srtmio3ny4op n neiatf Draumo;t0tltnii3iydfm2eln p t4aexnmf iy1lmtelu s s  rxo(m3io4optnmfci (f Dtaxrpot1apeomoeiat sDem( s u)tleoioctodlaD aivsls  2trxopio1lpeemiviat) 2rru o;o4tpeoif3iat s2elnmp t4aexoif3tytoateauvo;t0 eum(opnudopt lfci sfsrraxrpnt0tpt  i3iydfa elu on() lermo3tadfmD li o;s)seur(r nydome lnes ()aDrm(  oo4tpt  feilt m2rm( pnt0areomr io1opDrlies s0trxo(r nu1op e ivs t)s2rm(rpno4tex micias m2rm(vsnt)tetnmo3oatfmDr nvsls) 2xm(opoy1lm  lfvias)sruau  no0alxn oeildls2umu p;u0 rxoxo iadfp rlivsl( tetoir ny4lpt  nvs ()a2trx p;t4aex mocias aDrmnvonu)tlxrmo oa1lm  aivi s)seuo(m nodlm emnvi (fsDua(m ;t1aexo iciad m um(mp;t4 lenir3oydlpD  nvsls0setoiopnydop nlict s sDurxro;t4apen ociltlmDua(vo;t) rtnio iydlmDe neilt0srtr(mpny4lpt livtls)aDtmx ooo1oetn ietatfsDra(vp;(0aexomfcoytlat  ivi t0sexmxr3iydamte icias aruau  no0aetn fcils m2ua(vpnt0 ltnmrctadfm   uei t) 2urxopno1alt miviasfsDraxrpnt0tpt iietydls2emuvpnt4 leoif oodlm  luvs;()t2umxr3nu1ol emfct s s2umum nt4olx ifciydlm2ua( p (4tetnir3tadop rlieo (0srxoxo3iudaleemncs t)sDrax p;t0oee iietlt sDemnvs (4 eermocoytlmDrau s;s t2xm(o nydlpe mieil(  2umxro;u1oetomocildfaDuanvonu) lxomf iodfa elues s  etmim3nu1ol elfvsl()s2rax pnt4tltomoeilsfa emn p u0aeerxrcia1fatrli i;( trxoxm iu4olt  fvsl()aDtau pno1alenio3tysla2rauvon(4artoio3iodlateluvo (0seumxrpny1lpee ncs s  2ur(mpnu0tlenmf3tydfa umnms;u4altoxf ia1lmt  ieols0setoim io4lltemfesas)sDuaumpoo0tetoifciyd s2emumpnt) etomo3tydomDelu ols0s2xrim oodap e ivsas sDrru  ;o1tet ifciatfs2emums;(4 eerifcoa1lpD aies s  2urio3oy1oltnmict () 2uau pnu4oeeo f3ilsls2ran pnu)tetoio3totoat lies s teumio oydlle lfvil(fsrur(m ;o4aee moctlsla emn onu4trtrif3tatlpD  n slt)setr(m3oy4lmt mfeta(f 2umxroot1opx mo3iytfa umuvonu) rtnio ta1lpDranvs t)s2xm(rpno4am e ncil( aDraurpno1oet iiciys aDrln sn()aexoxfciydop eli i (0 rxm(m3iy4om nlfes t a2taxmpnt1oltnmfeild mDuau o;u0 lermrcoodopDeauei;s  ruoimpno1olenmfcta(farurx pnu0altomfeiyd a2rm(vs u4trxrxoctadopteai i s)s2toxm oo4olte net (  2rau  ;t1alx  f3ilt s2eluvo;u0 rxomo3iatlaDeanvo;s s2uoxopiy4amen ncta(f Drmx pnt4tpxoii3tasfa2ranmsn(4aleomr3oytlpD lneols  rxr(opiu1olt lfviatfaruaxmpnu4tlen ietysls ua( p;u4altrirciodfpt aneolt s2xmxmpiudal  mfciat)sruau ont1olxo feiys s ra(vpnt4 rxomfciytfptrai s t) 2urxrpio4ame  fcs tfsrrr(r ;o4tleomi3tat m2ulnmp u0trenif3oydopDeauvo;(0sexo(mpny1ale  fcias sruaurpno4opt  oeiytfm rlnvs;t)tleoxr3totfm  ln o;( tetmio3oy4ap nlieilsf 2umurono0optoifetatla uln o;t)aexrir3to1lmt an i s)texm(o3iy4opt lfei tfa2rrumpno1texo o3iad s2el(von(4trermr iytfmt  n i;s)sexrim ny1lme lfvslt)artaxrono1tltnmoctlsfm ulu snu)alenxrcty1fp e uvil()tetrirpnudlpe mies ( sDrm(m ot0oltomf3tld a2eanvonu)tleomrciatlmt  i o;s) rtr(r3oodam n fetlsf ruau oou4olxoifctytfs elnmo u0 ltrmr3oatlp  lu o;t) eurxopiy4ll e ncsat a2rr(mo;o0alxnii3iltfs rlnmsn()alxniociatfpD aieo;t  2xmiopoy1op nlfcslsfsDurx  no4alx  i3tls m2ean p u4arxrmr3iatlatr n s s0 eto(m3nydole  nviltfsDtm(mp;t1oltnmi3iysfm2emnmo ()aexnmf3oatlmt lues;t  2xrir3nydamtn ivtl(fsDrm(rpnu1tle if3iyt sDem(vo u0 rxomr iy1op elies;s0trxm(r io4opt  fvt tfsDrr( oou4teeoifciydfaDulumpnu4alxrmo3ia1lmte uei;t texmio3iy1lmtelicilt a2uaxr no0apeo ietysfm umnmpnu0aetnmr3iytfatr ivi ()trumxr ny1lp nmneta( aDurxmpot1olxn f3iatlm2ranvpn(0aeerxrciatlaDrli i (  eum(mpoo1op elieiat aDumxm ;o1aee iieiltfsDuaump () rxrmr3iadfa eauvi;s0 euo(o ou4om e icsatfs2rru onu4oleoifctydfa2ua(ms;(0tetrxr3todla eln ols  exoxmpio1lmenlnvtlsfa2rru o;o0apto o3ildfm2umnvpnt0trxnmocoy1fateai s t0 exriopny1ll emivt sf 2urx  oo4aexn feiasfs rauvo;()tetomr tadfpDe ieo s seto(o3iu4oltn fei t) Drr(mpnu4alxoif3tysfm2ran snu)arxrmrcoo1oaDeaivi (  ruo(rpou4lptnlneias  Drr(mp;t0oex mi3tysfsDean onu0 ltnmf3oodfmt anei;t trtr(o3iu4opt lnesasf rtrxmonu0altnmfctysfa2umuvpnt0arxoxo tytoatelivolt)texo(r3ny1om  lieiatf Dtrx ont1aptoiociasfs2rmu snt4texnxrctytlateanvsl() eurim no4ale  fvs t)artaur oo0tltomoeiatlmDeauvpn(4 lxomf3iotom rluvilt t2uoxm ou4om elfvi ( artrurooo1oee if3iyt a uauvp;t4 eermfcoatlmDrluvs;s0s2toirpno4optemivs ( a2tm( p;o0tptnmf3iysfmDrau pn()trtnxoctodoatraueolt0 rxoxm3nu4om   fcil(  2rmuronu0opx  iciyslaDemn o;() rxrir3to1lpDeaieol()s2xr(o oudlm e nvi t) rtau  nt4apxomo3ilsla2ranvs t4artomo oytopteln olt0teur(rpio4ap   nes t)aDum(ront0tpxoiociadfsDrmnvsnt0arenmr3tytoaD aivi;s  ruoim no1ale  nctl(fsDrrumpoo0apx  ictasfs2eau o;(0arxnmo3ta1omDrli s;()tetrio iydam emivias)srururono1texnmoctadlm uaumpnt4 lxrio3oadfatr nei;s  rtoirpoo1aleemfvi (f 2tr( pou0oex mieiltfs2ran s;t)tetrir3tadfaD  uvsls trxrio ny1lpen fvsa(  2tm(ronu1apeomoctatfs2ul(vs;()aeerxo3ootfate uvi s0trtoimpio1llt mnctasfaDuax pou0teenmietadlaDrm(vp u0treoifcoydlm ranes (0t2tm(m nudlmenlfcta( aDumur no1olxnmiciyt mDul( pnt0 ltomfciotlm  luei;( sexo(m3nydome  ivtas)sDrr(rpnu0aptnmociyt s ean onu0aetrxfcoatoate ivo s0srurxrpnydapeelnvilsfartm( oou4apt  iciydfm emnvp;t0 reomf ia1om e uesls) 2trxr3nydame lnvsa()srrr( oou0tlxnif3tat s2uan p;()aetnmr3oo1op   ivo;t)seuo(m3ou4lpeemnvtlsf Dtr(m ;o1apenmieiydls ean o;()aetrmfciotfa  ai slt0 rxrxr no1lp emfvt tf rtm(r oo1oeeoifctysfs2emu o t)aexoxocoa1omDrluvsl( seto(mpiydalt lnvtas)arum(r ou0teeoif3iat m2rm( s;t4 lenio iadopDeli i;t0sexo(r3nudamtn fei tf rrm(r ou0tltnmfctldfs2rmn s;t)treoio3io1omD  n i s) ruo(rpno4olt mfcs t)aDraur ;t0aleo feiysfs ran o;t4 ltrir iodfpte ivi s0sexrxr3iu4om emnvsa(f rtax p;o1tlxo ietlt s2em( ont)tetrxo tytlm elnvs s  2toio oodlm n nei t sDtrx  no1aee  ociys s um(vont0aeeoiocty1oaD an i () eum(r ou4amenmneiltf rtmum oo4aeto o3iytfaDemu p;()tleniociytlp raivi;s0 exoxopou1llenlfvs t) rraum ;t0oltnmocild aDum(mon()altomrctytla  au i s t2xmio3oudlptn fvtl()aDtmxr ;u1alx  octlslaDulu p u)tltrxrcio1laD luvs;t)texoio3oodlpe  nvils sruaxrpot0tlxo f3ilt s2ra( p;(4arxnmr oa1lmDeaieolt)srtmxm iy1lmt mfeia() Dtrxmono4aetnii3ilt sDumnmonu0trenmrcoy1fpt ln i t)t2urir iu4opee icsls)s2tm(m ;u0olto icildfmDel(mpnu0altriocty1faDrlues;t s2xr(r ou4llenlivil(fsDrm(  nu0texniociyd sDrlums t4tlxnxf3iy1lp eau ols s2to(mpiu1lle  nct s)s2tm(mp;t4tltoioctyt s umnmp;()tlxniocoodoatr nei;t0trto(mpnudlmte fvtlt) Dur(rpnu1tlx ifcilsfs eauvpn()altomr3oytlaDe ieols0 etoirpou4al nlicsltfsrrmx oot0alxnmi3iadfa2em(ms u)teeniocoo1lmt an ols0s2urxr io1lm elfet s aDrmu onu4alx mi3iys m em(vpnt4aeeoio3iotlmtrlnvil( srtoxm3iu4ol emfeiat s2rmxr oo4alto feiysla2rlnms u4tetrxr iotom r nvo;( srumxm io1lpt mnvtl(fs2tm(r no4olt moeilsfa elnvs u0 etnmrcootfpD aieo ()s2tmiopno4olt miei ( sDtmxm ot4apx  i3tas mDrmnmo (4texnio3iatlm e i ol( seurir nodam emfeias  Dta(r ;t0olxo oeiadla umn on(4tleoif3oadfpDraneslt)seur(o oo1lpeelnvi ( s2ur( ono4apxomieiys s2uau o u0texnir3ia1lmDeai o;s) etrxopnu1lle mfei s) Dtau ooo4texomi3iatfaDum( p;u4artnio ty1fptranei;t)seumxo3oydalen fcslsfa2ua(r no0tpeoio3iyt m2emnvo ()alxoxfcootfmDr uvol()texoxr oy1lm  mfviatfaDrrumpou1tee  feiytlm rlnmsnt0texnxo ty1fptr i ol()srur(m3nu1lltn ivtasfsDtmump;t4tleo o3iadlsDranvpnt0altrifcoodlatean s s trtoio ou4ol  lnvsasfs2rm(r ;u4aex  o3iltfs rln on(4 etnmr3oo1laDe u o s texo(o oodlpte fes tf Dum(rpnt1oleoiieiydfm elumon(4arenmrcoytfp rau ols) exrimpno1al  mfcsat s2tm(  ;t1alt mi3ilsls rlnms (4 rxoif3iy1omt ai s t0sruo(mpny1aptnlfesls)srtrum oo0oet ifctad s2uanvo u0 etomf3iatlptrauesls0 rurxo nu4lltelfvsa(  rraumo;o1opxnmf3tad a uan pnu4tetoif3tadoptr ivi t)s2xoimpio1ape mfes (fa2tm( pnt4opxo o3ildfa2rln o;u)tltriociotla  au i (0setmxo iudopeemfct ()sDum(  ou1tlx mocils mDea(vonu)artrir oodlp eaies (0 etmir3ny4ameelneilt) rurx onu0alen i3tysls2rl( on()aexrxrciytlmDr uvi ( srxm(m oodomenlnvi t)a2rr(  ou1tpenii3iatls2emu onu4tlxnircty1omDeln i s) 2trxr3io4op e fet sfa2tmumpno1tpenifciydlmDraumsnt0altoxr tatfpDr n s;t  eurxm ny4lpt  ieslt sDtmu p;u1aex ifctldlm2uau o (0tetrio3oa1fmtelu s s)t2xrxr3ny1ame mfetas  rum(ronu0oetnmfetytfs2uanmsnt4trtnmo oo1omDe ivolt0t2xm(opio4lleelfes t sDraumpnu1olxomociytfs2elnmp u0artnxo oatfp elues s0 exoxm ny1lm  lnctat aDumxrono4tptnmiciytfs2rau o;u0arenir3iadoa elivo t0teum(m3ny4ap elivsa( a2tau p;o1oetn i3tlsfm2uln p;() ltrmr oatfm eli i s srxmim ou4am nmiesls a2urump;u0tpt if3tltlm elnvo;(4altoxfcoodfpD  i olt) etoir3iydoltelncia( sDtmxmpnt1ope mi3tls m2em(vs;u4tlxnmfcto1fatrlnvslt0 exm(o oy1ap  mieia( arrau  no1oexoiietas s2rlumo;u0 rtnmf io1fat aueo;()srxmxm3io4amen fcil(f rumumpoo1tptoiiciysfm2ulums u)alerif iydom  aivsls  exmxopou1omenmfes sfs2uaxmooo1oeen o3iaslsDrm(vo;(4 lermo oo1omD luvi t0t2tr(rpnu4lm emnctat  rrrurpou4ale mi3tls sDrm(ms;() exniociodlateanvolt0t2xo(opio1aptn icsl( arur(r nu4apeoioctls s2elnmpn(4 ltoxrcia1lat luvi ()trxm(opnu1apt mneias  Dur(mont0teeoif3iydfm2ua( ont0aetoir3ty1fpDr ivils trto(rpiudoptelfeil(f Draxr nu1ole iocildlsDuau s () rxrif tatlmt auvs (  rtrxm iu4altemnvsas arum(r ot1apen fetydlmDranvs;(0 reomfciadfpD ai olt)srtr(m3nudal elieia( artaxronu4apxoif3iadls umn snt0trxnmrciydlp   u i;t teurxm3nodlpenlfeilt sDumurp;t1tetomf3iatlsDrl(ms t0alxoir tydom   ues;(0trum(opoo4omtnlnvs () rtrxro;u1teenioeiysfs2rluvon()aetrxr iatomtelnvsl(0srtmim3ny4lptnlnci ( sDrauront4tltoii3ilslm uauvs;u4 lxnir io1fa e uei (0srxmir oy4openlfeilt)a2tmxm nt0oltn o3iytfsDulnvsnt) ltoir oadlm raivs;t  ruo(o3no1altnlfcsls a2uru poo1ope  f3iadfmDrmnms;t0trxoxr oytfp  ln olt setrxm io1omee ivsas) rrmu p;u4alxomietydls2el(mo u) leoxo3oadopt  nvo;()trtm(o3oy4lmt lnctatfsDrmu ono4tlx  fciat a raump;t4texrio3oadlmtelivo;()seur(rpnydome  ieils  rrm( ooo1alxoio3iydfaDuauvsnt4trtrxr io1fmDe n i ()s2tmir3io1alte neil(farrmumpnu4alx iieild mDrluvpnu4tltniociadlmD  ivo (0t2trxm3nydomtnlfvi s arumx  nu4alt  fciysfm eluvs u0 eenmr ia1fmte nei t0 2xmxr3nodlmeemivsa(  rrrx o;t4tpx  icilt m2eln p t)altrxo3ia1opDrauei t0tetrxm3iy4ol emfet (fs2urumpno4tpto iciat a uanmp (4 reoxr ia1fate nvs;s)texrimpiydopt  iet ( artrx p;t0opto f3iadfm rlnvsnu0alxrio3oy1fptelnvolt  2tr(o3ou4om   net () rtrxrono0altomfetls m ran s;(4teeoxo3iytlmD  nvi;t0t2uoxr io1lp   fvta()srum(m ;u4opxnmo3iytlm ulu o;t0 rtrxo to1oa r ivi;t trtoxmpoydolte nvia(fsruru o;u1alxnmicilsfm emuvsnu)tetnmoctytoaD  u i s s2to(r ny4lpe mivslt)s2rmumpot0olt io3iydfm2rm( o;u4aetrmo3iadom raueolt)teuoiopnu1omtelivi sfs2rau p;u1texnmoeiysla ea( o (4trermr3tytlat lieo;t setm(o nudame lnvsas aDum(m ou1olt mictadls emnmo (4arenio oodlaDe nvols)trxrxo ou4apt mncslt arrm( ont4aexnmi3iys s em(mo;u)arxnmrctadop e nvolt0 rxmxrpoodolt lfvsatfs2urx pnt4tlxnif3iytls2umn o u4trerxf oy1fm  li il()s2tm(r3oudomee nvsl(fsDrm(  nu4opxoioetydfm eln snt)alxrxr3iadlpt aueo;s) etrxo3iudolee nctatfsDtaumpou4tpt  o3iytla ean s t4aleomr3tydlaD aieo;(0s2xoxmpnydalee iet t sDtmxr ou1tex if3ias m2rm( snu0alxoxr3iy1fpDe ivs s0s2toxmpnodamtn ict t)s2tau  ;o0apxomfciydfa2ea(vo t4 leoxocoodlpD lueol( setoxopio1op emfctlsfaDtau pnu1tle mociytlm2ua(ms;(0 rxrxfctadop  auei;s)teumxrpoodale lfei t) Draxr nu1olxo f3ilsfm umuvpn(4 lxrio to1omDelnvs (0srxrxr ny4al n ivsa(f rrrxm ;t1opxoio3ils m uluvs;u0 exoir3tadla   uvslt s2xrxopoudoltemfvtlsf Dtmxronu0ape mieiltlmDrlnvpn() rtoxrcoytfa  luvsls0 rxm(m3oudlme  fcsat)a2urum ot1opt mo3tysfs ul(vs;u4altnxr tydopte i sl( trumim iydll nmivt s) 2urur ;t0optoio3tytlm rmu s;(4arxomf tydfp r uvolt0 ruoio oydapenmictl(  Drm( oou1aleniieiysfs2umnmpnt4 ltrmociodlmDrau i ( srurir nodaptnlneiatfaDrax  oo4altn ieilslaDuanvs () etnmfctatom  aueilt) etoir nu4ll   nes t  Dtaum nt4oeenmi3ilt aDem( snt0 exnmr oatom  an ol() rxrxm ou4op  lnvias s2umxrp;t0tex  octadfs eau o t)trerif3oa1fatrau s;s)srtrir oo1amtemneilt)a2raumo;o4tpto fctaslm rlnmp t0arxnir3tatop  an i;s seuoxr oo1optn nvs tfsDrmu  ot4texnmieiyslaDelu pn(0aetoxocoydoaDeanes;( t2trir nodlmtelfes t) Dtaxmp;t0alenmfciat aDrlnmonu)aeenmf3iatlmte ivol( srxoir ou4ale lnvs sfsDraurpno1apt  oeilsla ea(vpnu4 lerio ty1laD li sl(0 rtrio ou4olenlnvtltfsrrm(ronu0tpt mi3tld sDeaums ()aexoir3oodla rlu o s)s2tm(o nydomtnlnes tfa2rm(r ou4opt mfctydlsDum(vpnt0aeerio oy1lm   n i;()seur(r oo4ol n nci ( a2uaxmo;t1tlto i3tlt m uauvo;t)tetnxr ty1fm rln i;t) etmimpiydopeemici t arraump;t4texnioctyslmDem(vp (4trtoifciatopDeli o () 2to(opny4llt mnetl()aDtm(  no1opeo o3tadfa2ran o;u)treoxf tytfa   ieo s0 2xo(m3iu4om e ivslt)arur(mono4aleo iciltfaDraumpnu4aexoxfciotfp eaieil(0sexm(r nu1oltn feiatf Dtm(  oo0tlenioeiltlaDelnmo (0 exomf3oo1fa eli s t0 exrio ny1alenmicils srta(mpno0oeeomo3ildls ra(mo u)trxrxf iy1op  ai o;t truoiopio1oltnlicslt)sDtrump;o1tlxo f3tydlsDul(mpnu0alxrif3tadlpD auei s  2toio oo1ome liesltfs2rr(rpou0opt ioctatfa2rl(vsnt)aexrxo to1opDrlivi s0srum(r3oo4ame licia()a2tm(  ;o0alt mf3tlsfa2uauvp;t)arermrcoytfat an i;t texoxmpnudal   fcilt s2tr(rono4tlt mf3iys s rmu s;() rtomr3oodopD an i;(  2triopiodalee fetls artaum ;o1tpeo ociyslm el(mo (0alxnir3tytfaDr nes ( truoio3nodom nmfvt ( s2rrx p;u1opxn octysfs emuvp (4arxomrcio1oate uei t0 2xr(rpoy1optelnct t)a2rmxm ;t1tpe iocilsls ra(vs;t)trenxf3iy1fatrln s;s0 euoxr3oodlme  nei s)s2rax  oo4tlenmietyt aDumn ont) ltrir3ootlp  luvo t) rxo(o3iy4lptn fvtas aDtr(mo;t4ole  iciydfm uan pn(0alxrmr ootop r n i t teto(mpiudol elnct (fsDtm(m no1open ociaslm rlumo;(0 exoxf tytlate ivs;s sexrxo nu4apeemivilt) Drm(  no1tltnmi3tatlm umumon(0 eeoif tadlmtelivilt0s2xoio3oydolte nct ()a2taurp;o1alx iieiydlm rl(mont4arxrxf3tadomtrlieo t  rxrirpny4omtnmfci s)srtrxm ;o0opeomf3tys m ul(vs ()aleoifcoadlat  i i s)srto(o oudap elivtls  rrmxmo;t1tpe ifciltfmDulnvs;(4tlxrmr to1op raues;(0t2tm(mpio4ap nmivia( arrrur ;o0tlxn oeiyt s umumsnt)arermo3ta1la rlivolt)srurir iy4oltnlietlt) 2raxmp;t4apenif3tat sDumu onu4arxomrctytfmDraiesl() 2urimpiy4omenmivias)s2urxro;o4tet  fciys a2rluvpnt)tlenif ty1fp r uvi ( s2to(r iu1lmenlivs ()artm( oou1altn i3ias m2el(vo u0artomfcoa1fm  aneolt)t2uoxopiudam e fcsas)aruauroou0aptoiieiltfa2em(vsnu)arxoxr tatomtranvi;s0tetmimpiy4lme  iesa(fs2rmuront0tleo ictasla2elumsnu4aexomrctatfm  luvs;s0texoir iydaptnmfeiasf 2rau  ot1openmfctlt mDrlu o (4tlxoif3oydlptrlies s0 2tr(mpnydop e ivia(  Draurpnt4optoif3iytfs2uanvon()texomociy1oaDe uvi s)sexmimpnu4ole lfvs ()sDum(moou0olt ifetytlaDrlu p t4arxnxr tadfptr uvi;s) euo(o3oy4ole mfvi sfs2ur( pno0oetnmfctysls2rmu pnu)altrxoctatoatelnvi;s0 2tmir io4amen fcta(fartmu oot0tee io3iatfm rmuvpnu)tlerxocio1opDrlieilt  etrim3ny4lpe  neiasf rrmur oo1tlxnio3tat aDrm( p t4tltnio ty1late ivs (0 etoxo oy4aleemfctls sDtruronu1apx iociyt mDel(vo;t0altoxrcoadlpDe i o ( seurxr3iudol  lfvtlt)srtm(r ou0tleomfeiydlmDumu p t)aeeoif ta1om e n o;s0 eurir iodoptnlfci () ruax  ;o1alxomictasla2ulums (4aeerif3oydla rlnei;()sexrxmpou1aptnmneilsfa2ua(rpnu4alxo oetlt s2rmnvpn(0trxomr3tatlmtrlu s;t0setr(r3oodoptnlieilt arrmurpno1aetn oetytfa um(msnt0 lxnmoctydopDrlies ()t2uoxmpnu4ll n nvta( aDtrur ;t1alt  feiadlm2ul(mp (0arerifcoytopD lnesl() etm(m oo1lm nmictlt s2umx poo1ale mo3iydla2em(vp;t4aetrir3tadfmD  ues (0t2toxr3iudlptn ivilt aDua( o;t1oex  f3tas a rmu pn(0 rtnmr3oydlaD  ieolt0 rurxr3ny1lpenmncia()s2uaxmp;u0tpx iocildlaDua(vp () exrxrctatfmtrau o;t0srtmiopiu4amt lics s s2umu poo4aexomfciad s em(vo ()alxnifcoadlm r ivo t0 exoxrpou1apt mfvslt)sDrr( ono4texoiieiat m eaumo;() ltnmf to1lmtr ivol() rxrir3iydapee ieils  2uaxr nt4tpenii3iyd sDumu s ()trxrxf ootomtrlnvi ()t2tm(o ny4ape lfeia(fartm(ronu0apt io3iyd s2elu s;u0 rxrxr tatop  luvo t sruoirpnudlltnmicilt)sDtruro;u1aleoifeiasfa2rmnvonu4aetnif ty1oaD lu il() 2urim3oudoptnmfviatf rrmumpot4oltomfeiltfm rl( o;()alxoxo3todlptrlueolt t2triopiy4lmenlfes (fsrurxrpoo4olx mfeilt a emnvp t4areniocoadom r ieo;t srtrim3oo1aptn ivilt)aruaur nu0tlxoifetydlm2uau o t0 etrmo iodlptranvi;t)t2urxo nodllenmies tf Drax p;t4ole if3iyd s2uluvo;u0 rtnio3todom e ivo () rum(r oodll nlnetas)sDrrx pot4tpe ioetytlsDumu s;u4 rxnxr iytfatean o;t)trtmio3iu4olt mnvtl(fa2ururpou0olx mfeiadfa2rl(mo t4alxoxoctydfm raivi;t)t2tmxr3io4oltn nvtlt) 2uau ooo1tet iietat m ul( pnt)teenmo3iytlatelneol(0tetoxo3no1lle  fvi t)sDtmuro;o4oex mfctlt a el( s () exnio ootop 
\ No newline at end of file
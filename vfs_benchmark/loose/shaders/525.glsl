@@ -0,0 +1 @@
+i i t s2umio iydomeemfeiatfsrurxm ;o4tpeomietatla el(von(4texnxf tatom  lu ils  2uoxm oo1lltn feils s2rrxronu0aexnmoetadfs el( ont) exomocoo1fa rlneilt) rtr(rpoo1al   fcsat aDtaum ou4aexo iciydlm uluvon(0 eenxo3iatfmDr n i;s0 2xmxm oo1lpte fcils) rtaxmoou0apxoiieiaslmDrau snt) etrif3oodfate uei;( s2tm(m ou1aptnlnciasfs2ur( o;t1olenmfeiyslm2ul(vo (4 rtrmfcoydlat li s;s)seur(rpiy4om emicias)s2um(  ;u0tpt mietyslsDrmuvp u4tlermo3ta1op  lnvo;t) 2umio oy1amenlncta() Dtrumooo0tlxo i3iat aDeluvs;u4arxomo3iadfpD  ueil()s2xrxr3iydal nlivsa()a2rm(  nu1aex mocilsfaDum( o t)altrmo3oa1fmteluei t t2urxrpiu1al nlncs t)aDrrxm ;u0olxnmociytfs2ra(mo;()tltnxr to1fmte u sls)texoxopny4apte feiltfartrx ono0opxnmoeias sDulnms;t4 reomr3tatfmtraueslt0s2urirpiu1oltnmneias) rtmx ont1tlx mo3iltlm ulnmpnu0tltrxr3oytfmt an ols  2um(r io4oltnlfvtat)aDuax pou0teto ictys sDuln o;t)teeoxo3tytfp rli o;t)setr(opio4ome lici s) 2tm( ono4alt mi3ild m ran s;t) eeoxf3iytfm raieo s0setoxopny4optemict ()aDrm(r oo4opt  oeiytfaDuanvo;t0trxoircoodlm   neilt setmim iy4ape  ivs t aDraxmpnt4apen feiatfs eauvs;(0aetrif iadlmteaiei;s  rxrio oydalte fvslt aDraumoot0olx mfcils mDem( o;u4 ltnmf oy1lpDe neils0trtrirpoydomenmiesl(fa2tax ono0tpen i3iytlm um( pnt)tlxoxf tadfa eli o s t2umir oo1lle mietasfsDumxrooo0aptniieilsfm uauvs;()aexnif ta1fatr neol( sexoir3ou4alt  feias)a2umxmooo1alxo f3iat s ean o;t0aeenif tadfaD auvo;s t2trir3oy4ame mfeslsf rurxm oo0aet  o3iltfs rl(vont)aetnmf tadfptrlivsl( t2xmxo iy4amtelfvil(fa2rrxr ot0tlx mi3tltlm um( o (0tetoxocoo1om  auvo (  ruo(rpoo1al elfesas)sDrrxmpnt1apx io3ildla2el( pnt)aeermrciytomDraivi s t2urirpoy1lme livi () rumuro;u1tltoio3iadfm2uanmp (4 lerio iatlmD  u s () rtmimpnu1lm  mnesa(fsDrm(root0teeoioetls aDul( s;(4 ltomr3oy1opD  uvo s0setmir oodolee fcsa(  rra(mpou1apt  ieiaslm2umumon(0trtrmf oatfmDelivs;t s2uoxm3nudlpe lici s s2rr(r oo1olxomfeilt aDrau s t4 ltnioctydlp   nvs ()truo(o nydaltnmnetl(f Drruro;u1oetoif3iat s2rlump (0 etnmf3iytlp rlueilt t2urxrpno4al emfci ()sruaxmo;t4aptnii3tydlmDem(mo;u0trerifcoy1op eau i;t t2um(o3iu1op nlfei s  Duaur oo1oeen feiatlm rm(msnt4trerxf3totfm r ies (0t2xmir nu4om nmietl()aDrmxronu1opt mocilsfa2emu p u0 etoir todfaDelueo;()trxo(rpnydlpe micsls aDtaxm no1tpe ifciysfaDrmu s t) lenif3io1la e ieils) 2to(mpio4om elivs (fsDtr(mo;t0opeoiocilsfsDrauvsn()treomrctytla   ues t0sexoxr nydllenmfetatfa2urxmpnt0aetn i3tat s2elumpnu4artoxocoo1fatrauvi;t0t2xrxo3oo1amtelnvta() 2taxrpoo4tlxn oetytlaDulnmp u) exrio3io1fateluvs ()tetr(rpiy1opee fesas)srumu  oo1texn ieiysfs ul( o;t4tlenirctotop   neo;t srxm(r oo4ol n fvs tfs2tmuro;u1apt ifciytfs el(vonu4arxoif3oydop ranvsls t2toxrpnodlpeemfvt s s2rm( oot1tpeniiciys aDuaumo u0altnxr ty1latrlivs;t0truoio3nu1ap emfct ()sDrrx p;u0oleomoeilt a2rmn o u)aetnxf3ootfaDraivo s) rtmxopno4olt  neias  rtrumpno4tle  f3iytfs2um( s;(0 rtnxo3todfpt an i;s0 rtrxrpnu4lpeelnvsltfs2tmuroou4alx  o3iydla2ulnvs (4tltnircootfmD livsl(0sexr(o oodap elnet t  Durxmpnt0olto o3tysfsDuau s () rerirciytomt  i s t)srxrxr3io1om n feta(  2taxm nu0opxo fcilslm ua( p;(0aexnmfcoa1omtelu sl(  eurxrpnudamt mfesa( aDua(m no4oeenifctltla2ul(mpn(4aetnxrcty1omDr n s;t) exmxr nodlmt  ivs s)sDtaxmont4aeeomoeild s ulnvp u0 reoio3oadom e ies;s) euo(o io4lp  lfvt ()s2rax onu1tpxnif3taslsDrauvsnu) lenmrciotom ran o t0 exmxo3nudapenmivsat arraurooo4tpxnmfciasla2eluvp t) ltoir totfmD aueo;(0t2triopnydale  ies ()s2rrxmp;o0aleomo3ils m2eluvsnu0tlermo oydfm r n i;t0t2xmir ny1oleelnctasfarua(mont1tetomo3ilsfmDum(vpnt)aetnxrcoa1lp ran o;()texrxrpnu4lmtn nvsasfsDua( pou4tleomi3iatfsDel(ms;u4 rxoio3tatfa   n s;(0texr(r3nydam  livsa(fs2ur(rpou4tle  o3iadfa2em(vs;(4artoircoytoaDr uei (  2tr(mpno4lmtnmfvsasfs2uaxrpnu1alto f3ilsls2uan s;u4 eenmrcoo1oate ivo (0teumim3iu4lle  ici t  2ta(mooo4tptomociatlaDra(vs (0teerir3iydoptrln i t)t2uoxo oo4al  mfes tfsDumurooo4opxoif3ils a ra( pnu)arxoxf iodoat ln s s) rtmxo oydaptnmnvs t aDtmxmooo1texnmociasfm2rmuvpnt4 rtnxf3iytlpDeliei t0sexrxr3oo1lm e nci sfa2ur( poo1oleo ietysls2rl(vp t0aeermr oatoaD  neo;()teuoimpoodameelfvsas srtm(rp;t1tpe ioeildfa2emums u)altrxo ia1oaDr nvs;t teuoiopno1ome  fvi s a2raxro;o1open fctysfs2ua(ms (0trermf oodomDraies;s)seuo(m iu1ol nlfei sfs2umxm ;t4teeo fciydfsDrln p (0tlxoxr3oytfpteanes t0t2xmxo3nu1ope  nei ( s2tmu  oo1tex  iciydlmDelu p;t0alxrxo iotfmDrlivs;s)teto(opiu4am  mfetat) Dtaxmpnt1texomi3iltfs2emumo t4 ltrif3ia1opt an sl( sruoxo iudoltelicsasfsDta(moou1alx ifeildlm2rauvsnu)aexoxr3iodlp  lu s t s2xm(opio4lltemivils srrmur nt0apxnmo3iltfm ua( ont4aexoif iytlpD  n s t sexoirpnodopt mnet s sDua( p;o1aetomieiytlm2el(mo u0trxrmf iadopDrlies;s seuoxopou1am emnctls sDum(  oo1aetoif3ils s rmumont)arermfciodlmteaiei;t) 2ur(o3ny4ap nlnvt ()sruaxr nt4oltoif3iad a2rl(mp t0 etrxo3iy1fp r ues;(  2xr(r3nydolen nes s  ruru o;t1tetnmi3iad s2emumo u0teeomf3oa1fmtrlnei t  euoiopoodlpte ics () 2umx  nt4aee mi3ilsfs2ul(vp u4tlerio ta1opt  u i t) rur(r3io1apenmivtas)a2rr(rpot4opxniociadlmDum( s u4 rermocoy1op e i o s0t2tr(m nudol  miviat) Drmx pot4tpeniiciydfs2raums u4altnmocoytop eluesls texmim oudllenmfes t)arraxmono1tlxomoetyslmDemn o (0aetrxo iatfp raneslt) euoirpoudaptelfes s) rrrxmont1aetomf3iad mDrl(vo;u0altrmfcoatfmt  n ilt trxmxrpnydllte fcias)srur( oou4apx iietld a emu s;(4 lxnxf3iadlaDeluvolt t2toir3ou1ape mivi ( aDumx pou1tetnio3iadls rl(vo u) rxrxo iadomteau o t0 eurirpno4lm emfctlt) rrm(ro;t0ope moeilt a2emn p;t)texrif3oatomtr n o;t srtmxo iy1am e feslsfa2taxmpot4oleomfeild sDel( s;(0 exoxf3io1oatean slt t2to(opiu1alen feta( sDurur ou0tpt mfcilslaDumu pnu0arxnxfciatopD  u o;(0 rur(o3iodaltnmfet ( a2rau  oo0open ociydfa eauvo u)altomr ta1om rauei t0s2trir3ny4alt  iesas aDururpoo0aet io3iltlm ua( s;t4 ltnxo oadoaDe uvs;t t2toiopiudolen fcta(fs2umur oo0tet  o3ilt a2eaumpn(4tlxnmr3iytlmD  ivsl( truoir3ny4lleemnesasfarur( oot4texn f3iyt aDemu p;t4aexoxo3oo1opt lues;()t2tmxrpiodamenmnetlt srur(rp;u4optoif3iytlm2rl( pnu4 exoio3oytoat aies s)teumim oo4ope livs (  2umu  oo0opxn feiyd m2ulnvpn(4tetomr3iadlat livo ( srurxm3oodom  mfeiltfaDuax oot4teeomfetys sDelu s;t0 rtnmr3iodoaDrlu i (  2urio iy1lmt lieiltfsDrr(mono0optnmieildlaDem(mo t0alermo oo1lmt aivi;t) etmirpoo1al elnvi tf Dum( oou0olt moctlslm2rlnvp (4aetnmociydfm r ivils) 2tmxo3no4al  livt () rtru  ;o4apeo ieiytla umn o;t)tetoio3oadfm elivs;s) rto(o3io4op e neiatf rrmum ;u4opeoif3iysfa2ranms;u)aetnxoctydfaDr neo;(  rtoxmpou4amen icta()sDurxrpou1alxomfeiadlmDrmu on(4 lermfciydop  aues;(0 2xr(r iudolt liesat aDurum ;u1oetnmfeils s2emuvpn(0arxomf iatfmDrlnvs;()srtr(r3oo1optnmneslt sDurumpno4aptomoctltlsDemu pnu) lerif3tytfaDr ivi s)seuoio3iy1oltn fcils)aDrrurp;u0aexo o3iatlm2uanmont) eerxr3oy1omDr u i;() 2tmxr ny1ll nlnetatfarrmu ono4tee  ieiyt mDeln o t0 lxrmr3iotfm raieo;t trtoim ou1lp  lfctl() Dururpnt4apx  fctld a2elumpnu4artrxr oodoatr neo () rxrim3ou1lp  micsl( a2rm( o;o4oltniieias s ul(vo;u) rxoxf3io1op rlivils  etr(rpnu1openlncias s2ua( p;t4aetoiociltfaDeaumo;u0 lermr3ty1lpDelnvo;s trxoir3oo4olt  fcsls s2rau  no0opeoii3ilt a um(vp;u0arenxr iytlate n o t  rxrio ou4lm e ncs s) ruaxm ;u1tetniocias a eln on(4arxoxoctydfm rluvi;s)t2xm(rpoudameemfvs ( sDtru  no0aex  fetytfa2rlnmo;u0tleoxf iotom   u o (0sruoxopiudolenmfvi t) rra(  ou0alxoiictydls2raumsnt4teeomo oo1laD  u s;t)teumio3nodlptnmfctlt)s2um( p;o1oeenii3ilslaDeln s;u) lenirciotlpDr uvsls0 2xoxr3iu1al e fvils)sDrmxmpot0apenioeiasla rmnmonu0trxnmfcto1opt auvi;( s2urxo3ny1ale mncsa(  2tr(mpno4opxo octldfm rlu pn() rxrioctadoaD aieol(0 etoxrpiudoptelnesat) rraxmooo0tlenmfciytlmDuluvpnu0tleoio3ty1om eliesls) 2xrxr oy1lmt  fvi tfa2rax o;o4tlt  ociatfa emn p;t) exoxf oatlm  aivo;t trurir nu1lle  ictl()sDtau o;t0tlxo iciat s2em(vo u4aexoxf oy1omDr neil()t2xmxopiy4aptelnesas  rta(mpno1tex mo3tltfs rlump;t0arxnxf3iotfmDelneo;t0s2to(r3no1omeelfeiatfaDumuroot4aexnmicildlm2elnvo ()aexnmo3iotfmDe nvs s)srxmio3iy4omt micil(  rumu  ;t1ope mi3iytfmDrauvp ()tlxnmf iotlp r i o;s  exrimpou1ome  nvsa(  2um(r nu1olen ietyt m elnvs ()tetnmr iadlp elu il(0s2xrxm3oo1lpeemnvs t) 2um(r ;t1tpto f3ilt a2eanmp;t0 ltrmrctytom ranvs t)srxoir3nydomen neslt)aDua(  nu4altn i3tys aDulnmsnu) eeriocoodfmD  neil(0 eum(o oodllen ncils)aDtmxmpou1oltoifetlsls2uau snu)artrxrcia1fmD lnvs;s)texoxmpnu1ol  licsasf Dtaxm nu0teeo octasfs2uauvo;()alxrxo3to1opt lieslt  rtr(o oo4ame lfvtat) 2trxr ot4tleomociasfaDean pnu) lxoxfciy1lptr n s t texriopio1al elneilt  Drau  ;u1olenmfcils aDuluvp;(0trtnmf3iytlpt lnvolt0texo(o3ny4amt mfvsl() Drmx o;t0aexnmietytfs2um(vp (4 etoir3iadfpDeaiei;s) etoimpou4op e nci t)aDta(mpnu4tpe  ieiad m2umnms t0areoxfciatom rauvs;t setm(r3oudol nmics ( sDuaxmpnt0tle mf3ild mDrln p u0 rxnirctatomt luvi ( srxr(o oy4omen ict sf 2tmxrpot1teenmf3ilsls uan o;t4tltnirciotlaDr i o s0 2tr(rpoy1lpeelivias aDumuro;t4tpeoifeilslaDra(von(0 eenio3totfmtraivo;s0t2trxmpiy1oleelivsat) rtax  ;t1altoif3ild s2ea(ms;u)tlxnircootlmteli ol()srtmir ou4alt livtas a2tmu p;o0tlxo feias mDulnmo (0 eenmfcta1opteai slt)setrim iydaltnlfvia()s2urxm ;t4alt mo3iadla rlumo t4 exrmo todlmteln o;(0t2trxr3nydol nlfesls)srra(  ou4tptomfctysfm2rmump;t4texnxfciadfate ivs (  2xmxo ou4oleemivsls)a2rmu onu4oltoif3iytlaDem(vp;u4teerxo iotlp r uvs s0sexoiopoudlpeemfviat a2trx o;o1aexoiieilslaDumnvs t4 etrio oy1lmtrli slt)t2um(o3iu1ol   ncils aruau ooo4tetnifcilt m ea(vs u0arenxf oytfmt auvi;t) rtm(m3iu1am   ivt (f 2rr( ono4tpx iociltlm eluvp;u) lerxrciydop elnvs t seur(o3oodop eliet (farurum ot1aptnmociydlm2ea(vont0 lxrxr3iy1om eaivi;t seur(opoy4lmenmfvilt)srraur ot1tpenmicilt s elumont0artrxf tatfa elieolt)srto(o iy4opt  ivsl()aruax  nt0tptoioctldlmDeauvo;t0tetrxrctytlpt lueo t srurxm ny1op   fvias artaumonu4oleomieilsfs2ulnvs;u4trtrmfcoytfm  luvi s0t2um(opiy1ll emncs sf ruauro;u4ope mi3tysla el(vs () eermr3ia1la   nvils)s2xm(m3ny1ap  mfcias)aDuaurp;t4tpxnmf3tls a2eln p u)arerio iytfa e n o s trxmimpio1lleelnvt tfs2trur ;u4alt  iciys sDua(vp;t0teeoxrctotlpDeln i (0seto(r iydap  livtatfs2rauronu0oex  f3ilt a2umnmo (0artnxr iotfmDeanvils0s2uoio3ny4lmtnmfet s s2trumpno1altn oetydfs el(vs;t4aetnxr oadfmt aieo s0 exrir3no1llen ivtlt  Durxroou1opt  fciadfm2uanmo;u0aexrxocoatomt an s t0 eumiopnydol   ivt s a2urxr ot1tlxnmfeiadfm2uanvpnu)artrifcoy1oatr u i;()trxm(rpiy4lmte fct t  rum(mpot4tltomieiysfmDemnmo (0texomo to1fm elies;(0teto(m3no1apt lict tfsDrrumpou0tpto fctytlm2rlnmp (4 exrxo3iytfaDeaiei;( teuoir iu4lmee nvs s sDtmu  ;u4tpeomfcilt m eanvo t)aexrxfcoatlaDr iei;s)s2xo(r3ny4omtn nesas a2umurpnu0oleoio3tydlm2emu s;u0trxnif oytlatran olt  rxrxm3nydoptnmnvt sf rrrur ou4tex  o3tydfmDrmu p;t)alxoxf3oodomDrai o;t)teumxo iu1amee ivs t) rrmxmpoo0aet ifciadfm ea(mo (0 lxoxr3tatom eauvils0texoir3oodop   ivils aDtm(mo;u4tleoiietydla2em(vo;t4texrxocoo1omD aivs;t0s2ur(r ou1ll   ivtas)aDurx p;u1tee  ietat s eauvpnt0tltomocty1oa e i o s)srtrio iu4apeeliviasfsrurxr ;t4tpt io3tltlsDeanvs;u4tltnir tatfat livi () ruoir3no1lleelneil() 2ta( ono4oltomocildfa ra(vsn(0tetrmr3tadfpDrlieolt0sexoir oy1al   fct s)s2umxr ;t1apen octytlm2rmnvp () rxoxrcoadoateai il( texr(m oodap e ivtlt a2tau  ot4ole if3iadla raumpn()texnxrcoydfmtrai ils)teto(mpiu1lpee fet sfsDtm(mo;o1ole mictldfsDemnvsn() rxrxfcootlp eli il(0 rxrimpiu4omt mneia()srrm( p;t4tptn o3tlsfm el(mpn()tlenmf3io1oaDr nes ( s2tmir3nu1lmee ictas)s2raxmooo4aetomi3tytlmDulnvsnu)trenmrcootlat  ieolt0 2xrxopoy4om  mfcsls sDtrx pou0tlx  o3iysfmDeanvo (4trxnxf3io1lpt aivo;()srtrxr3no1al  lfei t)sDrru  ;t4opt io3tasfmDean on()tlerif3tytomD au slt) rur(r no4al   nvs ()a2trum ;t4apen oetadlsDelnmsnt) eermf iy1fpt  ues;s)setm(r oo1lpeemies sfa2ta(mooo0tpxomictys a2rl(vpn(0arxnioctydomt aneo t)trxr(rpny1lptnlicsasfarur( poo0oleoio3ias aDumuvo t) lxnmrctadlat au ils s2tmir3iy1apenmfvtas)sDrmxmpot4apeomfeiasfm2el(ms t4 etnmr3oodla   ivi t0 eum(m oy4oltemncsls) Dra(m no4aleoif3iasfa ea(monu)aetnxf ty1faDeli ol( srxo(o3iu4lmtnlnetat) 2rax  ;u1olx mocilslaDul(mp () eermf iadfmt anesls  rto(m iu4ll  lfcsl( srrmxmp;u1aee  feiysls2uluvont0 exrmo3io1fpDranvo;t) rxr(r iydope  icia(fsDuauronu1tle iietyslmDeaums (0tlenxoctytom  ai o t  2xrxrpoudlp emnet ( arum(mp;t4tpxo i3ilt a ran o;t4tleomf3ia1laDeai o ()t2uoxr3nu4lptn ies sfs2rmumpou1tex iieiydfaDul(mon(4teeoxrcootfa eaieo;t0trumim nydomtelictls)arrrumpoo1texnmi3iysls2ranmo;() etnir3iydlpD  u s (  2umxrpoo1ol emnvt () Duax ono4tpeomo3iysfs2uanvon(4 rxrxf3oydfm r ivils  exmxr3oydope  ivslsfarrmu pnu1tpxomf3tls mDelu onu)alxnxr3oadlmDrlu ils)trtmio iodol nmncta(  2umuro;t1apeniieiydlsDelump;u4tetomo tadla eau sls) ruo(m oudamenmneiasfsrtrx pnt0oee  octyd aDrlumonu)altoxr3ootlmDeau i;s0 eto(mpnu1amtemivs t  rur(mp;o4tleo f3ils m2rm(vpn(4tltnmf3iy1oaDrauei;s)s2xr(r3no1apenlfcs s)arta(mpnt1oeeoifctatfm2ra(mp;u0 rerif3io1fmDraiei ( srtmxo3no4om e fctat sDtm( o;o0openiietatls emumont)teeomf oydoaDr ueo;t) etmio3io1lp elfvilt a2rax  ;t0oex  ietyt s rm(vo u4tlxrmf iotlp ran il() rtmxm nu4amt lfvtas sruaumont1tpxoio3tytlm2emu ont4 rxrio3oatfa   nvols)teuo(opou1om nlnctl(f Drr(mpot0ale io3ias a rlnmp u0 etnxo iadoaD lieols) rurio3oy4om nlncsas)s2rau p;o4texnmoeiatfs umuvp t0aeeoxo ia1fa   i s;()srto(r oydol e feil( a2tm(ro;t4opx mo3tytfmDul( o (4 lxrxr iotlpDrauvs;t) eur(m3iodamen ivta( a2rruroot4tpxoiietlt a2elnvp t) renif ta1lmt li o;t  rtm(o iy4lptemnct (f rrrxrpoo0apeo ociys sDrl(vsnu)arerxf3oadoaDelnesls)s2trxo io1am n netat)sDta(mpot4tpxo feiltls2ranmo;(0 rxnmr iy1omDran s s)teuoxr nu1om   nctas)a2tmur ;t4tlxoio3iydlmDrauvp;u4trxomr tatfpDr nvi t0s2xr(opoo4al elfetls  Dtruront1oltn o3iasls umuvpnt)alenir ootop raivo;()s2xr(o oo4alenmnvsa() Dtmu o;o1aex iiciltlm2ranvo;u0arxomf3oydop  li s;( s2to(rpoudllenmivsa()arum(r no4tpxnmicildfa elumo;(0 rxrxr3to1lmDraueils srtrimpoodoptelics (f rur(ro;t0oeeo ocildlmDrau p;u) ltnir3iotfm r neilt) 2xmim no4lpe  fei s  Durumo;u0aetoifetltls ul(msnu0trxomo tadomDranvo;s)texr(opoo1al  mictas srtr(  no0tltoifeild m eanvo;t4trxrmo totom eli o;t)teumim iy4oleelivi t)srumumo;u0tpxn ociaslm2ua( o;(4trermocootfpte neo s)tetr(mpny4ame  ici ( s2rm(  ;t1oet moctasfmDulnmo;t)areoxr iytfp   i slt  rtrir3ou4al  livt (f Dua( pnu4tpenio3iysfm2um(mp;t)arermr3todfptrau i t0s2urir iydopte neiat sDtmuro;t0apeo f3iaslsDrlu snt0 rermf oy1oa  ai ols0 exrio3iodapeemicsasfs2tmxrooo4aexnioeilsfa elnmo;u0teeomf3ty1fpt livo;()setoio3nu1lpe mivt t  Dra(  nu4tle mi3iytfm el( p (4 lxrxr3oodfaDelnvi;s srxoim3iu1lptelicsl(f rua(mpnt0opeoiociatlaDeau o t) lxrmr iydlpDraiesl(0t2trim no1lme mivsatfaDrrur nt0apx if3tasls2ua(vsn()teeoxf3iadfaD ln s ( trtr(o nu4apeelfcils)aDrrur ot0tlx mi3tytfs2eau pnt0altnifctadoa raivolt0 2xrxrpiy4ole miciasf rta( onu1olx  ieiydls elu p;u)arxoio ty1lmtean o s) etr(rpnu4olen neta()a2taurpoo1alenifeild sDeluvs;u) rxnir oo1fmtelieo;s0 eumxr3nu4altn fvil( sDtrx o;u4oltn i3ilsls ulump () eenmrctydlp eaivo;t)trtmio3nodaptelici (f Dtaur nu4alxnioeiasls2umuvo;(0 ltrxf3oa1oate n ol()srum(o oy4am   ietls)s2rax ont4apxomoeilsfsDra(von(4alxomf tadfm  luvols)t2tr(r3ou4ape lfviasfa2tax o;u1tlen f3ilsfs2rl(mo t4trtnxocoa1om rauei;s)t2uo(m iu4lmt liesl()s2rrurpou4tpenio3tltfaDea( o;()altrif tydfpteanvi;( trxoxmpiu1llt miet t srua( ooo4apxnmfctlsfs2ea( o;t0tetoxfcoydfat  nesl( setoio iy1lm   ivt (  rumu  oo4tpto i3tyd a rmnvp t)alenif tatoaDrluvo;(0 2xrxr oy4apt lfes (  rrmxrpou0alxo f3iytlsDul(vo;()tetomocoadfpDrluvo;s) exo(m oodal   nvs sfsDua(  nt0aetnmoctys s ul( pnt) lermfctadlp rauvo;s s2trxm no4opt  netlt) rururo;o4olenio3iadfm2eanmp (0 leoir3iadomtrln i (0s2trxr3oudlp e ieilt arua(r oo4alto i3iytfa2ea( s u0tetrir3iytfmtelivs;( texmim iydal n iciat arumu o;o0tleniicild m ra(vpn(4aleoxfciotfa elnvs;( trxmio ou1opeelneils) rua(mp;o4aptnmf3ild s2rmu s;(4arxrxr iydlpD ai s ( t2xmxm3ny4llenlici ( srua(  nt0oee ioctysfsDra( on(4artoxo oy1fm  lnei;t t2uo(mpiy4llt lfcsat  2rrur ;t0tex ifcild sDemnvs;(4 exomocty1optrlu i;t)srtm(m oudlltnlnvt s)aDtm(mp;o0tle  ietls a2ran o;t4treoxf iatlpt auvo ()trxo(mpnydll  lneils  Durxrpoo0tleoioctadfsDrl( ont)aetnio3oodlaD  ueo;( trtr(opnodlpenmfvsat a2rmx pot0alxnioctysls ulu on(0 exnmf3todlp  lnvsl(0t2xo(m no1lptn fvias) Duaxronu4oeenifeildfs rmu s;()texniocoo1lpDranes s trum(rpno4omt livsl(faDrmuro;o1apxn fctydfm2umnmo;(4trenmf to1fmD lu s;t0sexrim oydop n fei sf rumum no4opxnmieiatfm2rmnvsnu0alxrxrcootlptr n s t)t2tr(r nu1om nlivilsf 2rrxm oo4apx mo3iadls rl(von(0texoio tydfp rln s;() rxoim nydamen nvtl(fsrtmuro;u1oeto fciatfm2eauvp u0altnmo3iadfm   i sl(0s2ur(opiy1ll n nctls)aDtmx  ot4alenmieiltfsDrmnms t)treomf3totfaDranvo;s)trtoim3ny1llen nvsasf 2rr(  ot0tpenmociydls2uln o t)trtrxrctotomD lues s)t2tmir nu1olt lfvt (  Duaxmono4tptnmf3tls aDumnvon(0altoir iotlmte nvols0trumio3oydopenmicilsf Dtm( ono0opto ictad sDrl( p ()tetomfctotfpte nei;s)trxmio no1ll nmietl(fs2uaxmont4oeeniicils s rmn p u4artrif tadopDrlu o;s t2xo(o no1altelnvt t)sDtr(  oo1tlxoiietat m2ua( o;u0 exomr iodom  lu o;t)setrxr oy1amtelfci s a2umx o;t0openmociatla uln s () lxrxo oatlaDr ivi s) exr(rpoo4altelfcs ( aDurxm ;u0tpeoioetydfm2rlu on(4 rermr oy1lat aiei s srum(m iy1om nmnvt t artrum nt4aleo ocias mDeln o (4tetrif3ia1opt aivil(0seurir3oudlme mfctls)sDumxm ;o1oltniocildls rlnms;u4 etoiocta1oa elnvils  exoim iu4amtn ncs t srurx pno1aeenmfeiyt sDrmnmpn(0 lerxrciydla eaieo;( texr(r nu4oltnlfei t srumu  nt1tlenmoeiysfmDrlumo u0teenxfciodfpDe n s t0t2uoiopio1ame mfesls)s2um(ro;t1tetniicildfaDum(vs u)artrir3iydomt anei s srtriopno1ol elieta(f Dur(  nt0aptn ociatfsDuauvon()trtomo iatlatranesls srxr(o3nu1alte nesa( sDrax pot4oltn ieiadfmDulums t)artomr3oodlat aieo ()trur(m iu1olte ncsas)s2umx o;t0tet ii3ilt s2ul( o;(4 exnmo tadlaDraueo;s0t2uo(opiy1lmtemnet t) 2rau oou1tpt mf3iatfs ran s ()aetrmf oodoatrluvi (0 eumxo ny4ll e fet s)a2tm(monu1tlen f3tydfmDra(von() eeoif3oadomDeanei ( s2ur(mpny4ameemnvias a2rrumo;t0oexnmf3tyslaDem(mo;(4teerxo oadfatran ols tetrxrpiudam elivtl(  Dta(mp;u1teto ieild m emumo (4altrxr oodoatranei;t0 rtr(o oodlm elfvi tfs2tmurp;t1aee  ociasla umnvo;()tlerif oo1lpteluvsls)t2uoxo ou1opt mnvtls)s2um(m ;t0optoioeiadlsDeanvpnu0aetrmr oo1lmDeaiei ()seum(o3iy4lm emiei t  rtaxm nu0olenmi3iatla2emu on(4texrxo tytfpD lu o;s0 exm(o iudlme  ici ()a2rm( pnt1tetn oeiatfm2umuvonu)tetrifcia1fatr n s;s sruo(mpno4al nlneilt a2rmurpnt4oexoif3ils a rl(mo t) lerio ta1oaDrlnvsls0texm(o3iodolen fvtat)aDur(r ;u0opxo iciydfs eauvon(0aetrmo3oadfaD  i olt) 2toxr nu1oltemfct tf Dumurp;u0ope mo3tatfa2eanvsnt0alxrircoy1la elnei (0 rxoxm oo1lpeelnctat  Durxmpnu0opt  fcildfa2eln p t) exrif iydfp e nei;s  rtoio ny4apenmivslsfsrurxmo;u4tptn iciytlm emumo t0 etnmr oy1opD ln s (0trxoxo iodlp nlnct ()aDtmur ;o4apeomfcildfs rau s;u0tlxrxf3oydoaD  n o t0 euoxm3no1lltelfcsas a2uru  nu1aetn feildfaDeauvont)altrir3ta1opDran i;t t2toxmpou1om nmicslsf rtrxmpno4aet  octldlaDrmuvon(0texoirctotlpDrln s;()teto(rpoydomee ies t) rrmxr oo0apen i3ilsls2rmn on(4altrmr3oodop eliei;s)srumxo3oudop elnvs tf rtrumo;t4tlto i3tatfs2uanmpnu4 rxrxoctatoaDe n i;t) rxm(mpiu4lptn nctls srrmum nt4aptn f3iytfs elums t0texrmf3tatoa elivs t0teumxm3nu4olenlicta( artau  ;t4aetoioetas s2elu s;(0trxoxf3oatop elieo s sexo(m3nu4omee ietas s2trx o;t0oexoiicias m umn ont)artnmo3iatoa   ivo ( texrxopno4al nlnetasfaDumu poo0aetniieiadls ul(vo;()arerir3ta1laDrlu sl( s2trim3ou4lm e ieiasf 2raxm no0openmi3iasls2uln p (0teerxo3oadlmDe ivsls  rtrio iu4lm   fei s  2taxmpnt0apto i3iadls ra(mont0 exnir ty1lpD  neo t texoim3ny4al   nvtas) 2urxro;u1opxniieilt mDrm(mo;u4tltnmr3iodfaD li i (0teum(m3oo1am emncilt) 2ua(monu1oetnioeilt aDulumo;u)artnmr ta1omD lneo () rxmxr3iudlpeemnvs s)srumxmp;u0apt  feiadlm2um(vs;()trerxo3to1la rau ol()t2xrim3oy4am nlieslt sDtr(  no4tpen o3taslm eaumpn(0trxnioctytlmtr i o s)t2urio3nodlmtemnctat  ruau ono1tex mietydfm emuvs () exrmfcootfmt lu ils0trum(o nu4ll emfvtls)sDur(rpno0apen fctlsfs ranmp;u4trermf3todoaDeanvol() rxo(o iodlleemfetlsfs2trxrono0tpenif3iyd m el(mpnt) exrmr3oodomDrli s;s t2ur(m3ou1om nmivia()sDurxr ;u0oeeo ociltls rmnmp (0 rxomfctotfaDr nei;()seurio3oydol nlncil()a2rmur ;u4tlx  fetyd aDumums u4tetrmfciytfmtelu ilt0t2urir oudope  icils sDtrurpnu1apt  fctldla ulumpnu) lxrxocoo1omD  nvs;s0 2xoir3ny1omte fesat)srtmxrp;o0apxo fciysla raums;t4 ltnir io1op eau sl(0 rtoirpiydlm emivsl(fartmur nt4tpx mf3ildlm2eauvs;t0 rtoxo3iotla eln ils0 etr(rpno4aptelnet tf ruaur no4apto fetldfm2eln o;(4arerxo3tydlateaieils t2uoxopio1llt  ivslt sDraxrpou0olxnioeiysfa el( pnt0 rtrmf3tytfp  lu o () 2xoxr3io1alteliet (f Durxrpou0tptniietld mDua( pnt) exoxr3iydfm r neols t2to(mpno4ale lnvtlt aDumx pot0ope mociasfm eaumsnt) rxnxf3oy1laDr ivols s2xrim iy4optn fctls)sDrmuro;u1opx mietatfm2elump u0 rtnxr3oo1lp eauvslt0tetoxmpiudaltnmfet tfa2um(mpou0apt iiciys mDrm(msnu)teenxocoatlmteanvils t2xmio ou1ale  fvs tf 2rmurono4tltomociadla ulnvs;t)tlxrir tytopDe ivi t)seurxmpiydll e ivtasf Dtrxrpno1altnmociys sDean o () exoxfctytlmteau i;s truriopnu4om  mfcta(f Drmxmpnt0tptn fetasla emnvp t4artnxf3ootlptrlneol(  etrxmpoodam emnci s  rtrur oo1texomieiytfaDrm(vs t4altrxr ootopDr ies t)s2xmxmpnu4al nlnetasfarta( onu4aexo oeiysfs2elumon() reoxf3totfp rai s;(0setrxo3iydlmtn net () rraxmpnt4oltn ietys a2ua(von()tetnio3iotfp eaues t0s2um(r3no1lltnlivt (f Dtmu  ;u0aeeomf3iyt a2em( sn(4tlxomf3to1fp  aiei s)sruoim3no4lle lfvil()s2uaxmono1oexomf3tasfm2rmnvpnu0tlxrif tadlmte ies;(0s2toxo3nudlpee iei ( aDuru ont1olxnioetyt s uan sn(0aetrmocoatlptelnvi;s)trxrimpnydll  miciasfsrtm(mp;o0oetn f3iltlm um(vp t4 eeoxf3iadlateluei;t s2urir3nydalenlneslt)arrr(  no4tltnii3iltla2emuvp;(4 rxrif tydlpDrlu sl( setrxrpiu1amt mictls)aDtmu o;u1altniocildlaDum(vs;t4texnio3oo1lm r uei t  2urio ny1ll nlnct t)sDumu onu0tee  ociatls ul(mp;(0 exnmrcoy1lateluvi s0sruoir3oy1apt liei (farra( ono4apen iciadla2rau s u)aeermr oy1opD lu s;t)seurxm3iy1lpt lnei tfa2rr(  ;t1tee iiciydfm2el(vp u) leoir oy1lmte ivo;s  ruoxo3io1ol n iesatf Drmxm nt1oeeoiiciydfm2ua(vp;t4 eeomf3iotla  livi;t)sexo(o3ny4opt  neta()a2umxronu1openioetatlm2uluvo u4arxomfciy1lm eli o ()srtmio oo1lpte nctl( arrax  no0tpto feiatfs ra(mo u)teeoir oytoa ean s s)srtrxr3ny4lpte neiltf Dtaurpot4oleomfeils mDua( s;t0tlerxocoadlm  auvi ()s2uo(o3iy4amt  ictatfaruaxrono4opxn iciyt mDran o;u)trxoxoctatfmDe n o;t0 etoimpio4ol n ies s  2urxrp;o4opx  feiasfm rmump t0tetrxocoodfat lnvolt trxrxrpno1apt  ici t aDur(rpnu4apeo iciadfsDemu snu) lxnio3iotfmDeaueilt)truoxr3ou1ape  ivi s  rtax pno4olxoiiciadfsDul( o;(4 ltrxf3oo1lmD ai ils)srtm(r iodal  lnctls)aDtaxrpnu4tlx  ieildla ulumpnu0artnxf3iatlp e uvi t  exrxrpnodope lneias) rtmxro;o4optnmf3tytfm rmn s u0 rtrircoy1lmtelnvi s0sexoxopny4lp   ietlsfa2rru poo4oltnmietlsfs ua( sn()alxomr io1lptranes;s)s2xoir oo1lp nlfvi t aDtmum nu0olxnmietadla2uluvs t4 rtnif3oatfp e neols  rtmxm iu4llenlnctas) rtaum nt1tpenioeilsfa2uaumpnu4trxrmf3tytlp  auei;s)srxo(r3oodll  mnetlt a2raur no0olxomociadfaDuanms;()trxrxf oytomte uvi t setm(opiudlptemivsa()aruax  ot1apenmi3iadlsDulu pnu) rtrmf ta1la  aivo s s2tmio ny4apte ics ()s2rrx ono4apxnmo3iyslaDelu pn(4texoif3oatfmD  nei (0 2umxm3nodll nmncias) 2rr(rpno0aexomf3ilsfs2el(ms ()arerxo ty1om elu o t srtrxrpiu1ap nmneia(  Drru oou4aeen fctatfa2eanmpnt0alxnmfciodfp r ivs s srxrirpiy4al elnvtlt)aDuaxm ;o4ope io3iytfaDul(mon(0treoio iadfptrli ols t2um(r3io4omeemfci s a2umurpno0alt io3iyt sDeanvsnt)trenmfcty1optelneilt) rtrxrpoudam e neias)s2umuront1tpxnmietasfa2emu o (0 rxrxf ty1omD ai ols  2ur(o oo1alenmicia()aDra( pnt4apxn ociat s2rlnms;u0aetoioctotomt aivi t0sexm(mpny4omenmfet sfs2tmumpoo4tpeo fctadlmDranvont) rtnmrciotlmt  uvi;t0 etoir nydolt livt s artr(mp;o1tltnmoetltfs2rl( s t)arxrxo3iatfmDr nei (0 rur(o3oo1olt lfes s aruau o;o0tltomoeiyt s uanvon()trtrio3ootfpD ln ols)s2trxm3nodalee fviltfsDum(  nt0apt mi3iytfa2ra(vpnu)tltnmfciydfaDeaivi;t) ruo(o3iy4ap   fvs ()sDra(r oo4tex mociyt mDuau s;u0 ltomr oadfaDr ueo;()s2um(o3ou1olenmicsas)aDua( o;o4texo fetlslm2emu p (4 eenircio1oatraueil(0seurirpnydol  mici s)arta(m nu0aleomo3tysla uln onu0 ltoir3oatoaD anvs;()seur(o3oydllt mfei (f 2trxmont0olxnio3ild sDrln onu4trtnxo ootlpte ivs t)srtriopnodomtemnesa()sDumx o;t4tpt  oeiat a uan o (4aexrmf3iytomDe neol(0 2tr(o iudol nlietat) rua(r nt0optnmfeiatls elnmsnt4aetnxo ootla rlneol( setoim3oy4olenmfes ()srrru o;t0tptnmf3iys s uluvs;t0aexnmfcootlaDeln sl()s2toxrpio4lm elnvta(fa2raumonu1apx  f3tysfa rluvp t) renxo iotlptrln ilt srxrir nydlmtn iviasfs2ra(m nt4aleoifetyd sDrmnmo u4alxnmo oydlpt  i i;s  rxoxo3io1amt  ieilsf rtmum ;o4opx  fetldls eanmonu4altrifcoydfpD lies s  2xrio nydlpeemneil()sDur(ro;t0opto ietydfa umnvont4 etrif3iydfpteln i;s) 2urim oudlptnmiciat)sDta(mo;u0alto o3tatfaDrmnmsn()trerxrcta1om rlu s;t)srtmir iy1lp n fcsa() 2ur(m ;o1oexniictatla rau o ()tlxomrctadop rlues ( trtr(r3nudapeelnvslsf 2rmxr ;t0alen iciatfm um(vp;t0 ltrxr oytomtrluvi s)t2tm(m3oudlltemncs (fartrxr nt4apen feildls eluvp u0 exnxfctydfaD  nvols)seumxm3oydlpt liet (fsDururont0aleoif3iadfm2ra(mp (4altrxf3todoa r ies;t) exrim iu1oleelnesls s2trumoou1oexomf3ildls rlump;()arxoxf ootfat aueols trtoio nu1ol nmneil(fa2trxrp;o1tltoioeilslsDuln o;t0tltomfcootom   nvols0t2xmim iu1oltn fetas  rrau p;u1apx ioeiltls ra(vp t4 rtoif3iatoa r i s (  eurxr3oy4amen fciasfsDraxmoou0tpt  fcias s eauvsn() renmocoa1op raiei (0s2xmxrpiodomenmnctls s2rmxr ;u4aetoifctat s elnmp u)texoxr3iadopte ueol( trxrxr3oodomtelncs sfartmumpnu0ape  o3iydlsDrmnvsnt) rermr3iytlp  an i;s seto(o3oo1alenlfvil(f Dtruronu4aee  octys m2ulnvs;t0artrxf iydfatrau ol( trumxopoudlleemiesls aDuau pnu1texn f3iatfsDraums;t4tlenmo tytoaD an o t)srtm(opou1optnlietas artmum no1aee mi3iytls rm(vsnt4aetnmrctodlatrai s s)srumxm3io1op emfvia() Dua(rono0oetnmf3tydls emn s;(4tlenir3tydomDe u ols)s2xrim3iu1lmt mici () rurump;u4oee  o3ilsfsDumnms;t4tetoio3ootop r i ilt0truoxm ou1lmeemietas)s2rax p;u1opto feiadlm ua( ont4texrmfcia1oa  anes;s)truo(m3oo1op nmieiat) Duax o;o0teeomictad mDrm(von(4tlxoxfcio1lm  aies;(0t2uoio3oy4lle lfci (fs2rmxr nu4tlx mf3iltla uluvo;(4 lxrmr iadopD livi;()setrxmpny1apte ivsa( arur(mo;u0aetomfetatls ea(vsnu0aeenif3tytopt lnvs;( truoio oo1llt  fctat artr(m ot1tltn o3iasfs rln pnt4aeenmf3ta1fp rlu i t0s2trxo3oy4ome lfvil( a2tr(mpnu1apx  f3iltla emump u)trtnir3iodfmtr ivi s seum(r3ou1lp nmfeilt sruax pnu0tleoioeiasfa em( pnt0areoxrctytfpDraiei t0 eumiopoo4al nmfcsl() 2umur no4tptn o3iytfs ul( s;(0 etrxrciy1fm r nei;t  2xm(opoo1op  mfvilt)srumurp;t1tptomociysfa2raumont4altoxf3ta1lmDr neils  2tr(r ou4lmtnmfetat arraxmpno1olxnmociytlm rauvs u)tltnmf3iydom  livo t0s2toxr oy4lp n fvi (fsrurx  ;u4alx mfeiysfm2um(mon()tltnif3tydla eauvi t0 rxoxo3iudlpee fvslsfartrumo;u0aee iociytlaDea( o;t4 lxoxr3oytfmDeauvsl(0trumiopoo4lm emnvt s)sruaxmp;o4tpx  o3ild aDuln p;t) ltrir ootoaDrauvils trxoxmpoodomenlnvtasfsDtmxr ;u0openii3ilsfaDulnvs u) rerxfciodlptr ivo;s) rtrio3nu1optelneiltfaDumum ;u4oex  ictld sDemumont4 renxrcta1fmDranei t0t2xm(opou1apt  nci sfa2rax oot4apt mfetls sDra(mp u4alxoxocty1laDrlivs;(0t2tmio oydam emfvia(fs2rau  ;t1opt mietasfmDumu s u0 rxnifciotfatrai s;s trxr(opnodamte ncia(farua( pno4teeoifcilt a uluvont0tlenir tydlpD  n sl( teur(rpiu4ope lfvsat)srtmxm nu0oee ifctad sDemuvsn() etnio3oy1fatraiei () 2trim ny1olt  nvi ( aDtm( ono1oex mo3tadfaDeluvp;t) rtrif3ia1om rauesls s2trimpiodomtelnvsas)sDtm(mpno0tltnii3iat m rau p (4trenxf3io1fpt  nvi ( t2um(mpnydolt  ieiltfsDumumo;t4opxoii3tlt a um(ms (4 eerxo3iadfpt anvi (0truo(mpoy4ale mici (fs2umu poo4oex if3iat mDrm(msnt0trxomr io1fmte uvolt  rxmxm3io4lp nmiviatf 2uau  oo0altnmf3tytla2um( o;(0trerxrcootfm elneo (0 2tmxm oydaltn fvi t s2urxm ou4tlt ioetyd m ea(vpnu0 renxr totlpDeluvol()srum(opiu4aptnlncslt)aDraxrono0optnio3iyt aDum(vpn(4tltnif oatlpt  uvi;s0s2xm(opiu1lleemfvsat s2uaxr oo4ale  fctas m2ranmp;u4 exrxr iydlm elu s;t0t2tm(r3nodale lnct t)a2rrum nu0aeeomictadla2eaumo u)tetoiocoatlmDelivi ( trxm(r3oodaltn ici s aDtr(  no4olxn oetltlsDrmnvp (4alxnir tydoat auei t truoimpiy4ale  ncsasfsrtaxrp;t4openmo3tatlm umumo u0 rtnmr3oydlmt  n sls0 exr(o nu1lmt  ieia(fa2rrx  ;o4tetn o3tldlsDrl(vo;(0 exrif3ta1lpDrai i;( srtmxm3io4omee fcil( sDrmur oo4open ieiltls2eln on()trtoxf3oatfm rlnvi;t) 2xo(o ny1ole mnei s aDtr(rpot4texnifciydlm2rmu o;t4trtoio tytfp rliei ()srtrimpoy1ole lict ( srtaxm nu1tpt mfetls mDea(mp;u0 exrxr3ootfp ranvol(0srum(mpou1ome  ncia() ruaumono4ope ioeiys m2uln onu0aexnir3tatlp r ies;t srxrim3io1aptemnct s)aDrm(rpot4tleo f3iys sDuan o (0 reoif3iotlp  livolt) rurxrpoy1om   nct ( sDtm(  ;t1aeeo iciad a ul(ms;u4tlenxr iodlp   ivolt0texoim iudlmen fvia(f Drr( ont4tltnioctad m rm(mp u0trtnxocoo1faDeaueo;()t2xrxr3nu1am  mietat s2raxmpnu4oleo ieilsla2rl(mpnt0 exoxr3iodomtranvolt  2trxm3io4amteliesas  Draxr nu4oee mf3ias sDelnmp;t)altnmocoydfp elies;() eurir3iydol n fetlt arumum ;t0texoiictlsfm el(msnu4teenif ootlm  luvi;( setoxmpiy1ame mfet t s2raum ou1oexnioeils m elnms t4 exrircta1opD an i s0 exm(m iudopte ici (  Dur( oou0texo o3iatlm uluvp u) exnif3totlpt anes ()sexoxr oo1ap nmivi ( arraxr ;t1aptomo3iyslsDra(mp;() ltoxfciytfmD aivs;s s2to(opio1aptnlfesa(  Dta( p;o0tltniieiadfa rm(mo;t4 renmo3tatfmDr nvi t)s2xoxo no1lpt  iei sf rta( ono0apx mo3ildls ea(mp;u4artoirciodopD aivs (  exmxopno1ome lieiatfarrru  ot4oeeo i3ilt aDul(vsnu4aetoif3iatomtr nvils) rum(m io4lptn ivs (fs2tm(mono1aptniietlsfm ulu onu0texrxf3iotfmDelu il( srxm(m3oydllt lfeia(f 2raurooo1alen ieiydls emnmp u4trtnmfctydlp ranvs (0 exm(r iy4ap n nvt () ruaxr ;u1alxo i3iytls raump u) reomoctydfptelueol() rtrim3oodaptelnvt (  Dtrump;u0olt mo3iltfm rmu s u0tleomf iadlpDrlnes;s s2uoxo3ou4lltn nctlsfarua( pnt4apxn fcilsfm2rauvp u4 eenmo tytopteauvs s)srxr(rpiu4am n ivia( s2rr( oot4tlto ieiyd m2ua(vs u4trxrmociy1lp rai o;( truoirpnodlp nmnvtlt)s2uaxm ;t0tlt ioetyd mDrmnmsnt4tlenif3oydfmtelu i;(0 rxoio oo1apee fvtas) Dumx poo4opxniociyslaDuaumo;t)aexrxo3iatfmDelueolt0 rxrim3nu4ameelicil()sDtmxmpno4tpt mfetls s emnvp u4trxnxo oo1lp ean o s)setoxo oo1amtn nciat)aruax pno1tltn ieiatlsDuln o;u0arxnmrciotfate n s;s setmiopiudll n ivi ()a2taxr ou4oex mf3iysfm um( s;t4aetrxociydfa   n o t truriopiydamee icsa() rrrx  nu4alx mictatfm2ranvo;t4aleoxf3oytom r u i t)trtm(o3nydale mnvilt)srua(m no4ope ioeiydla2ua(vs;u0aeeomo oytomtrli olt)s2uoxmpio1apte nvsl(faDum(rpno1oeeoifctlslaDea( p;u0texrif iadfpteaivi ( t2tm(rpny1ale lnvsl()a2rr(mp;t0tpx mfetytfa2ea(mpnu)arenir3tytfateaieo t) 2uoxm iy4llenmfcs sfs2rmum ;t4texnifeiyd m ul( p u4trtrmfcoadlaDr neo t) euoxr no4ameelfvtas)artaxr ot1apeomo3tatfs rluvsnu)texomr oo1lm e nvol(0teto(o iydalenlfvt tf 2ra(m ;u4tlxomfctytlaDrlnms;t) lenmo3io1omtrli s t)srum(m3iydlmtn fcta( srtrx o;u0tpe mieiltlm rl(vs (4artriocoo1lmte i s;(0 2toim3oudapenlncsa( a2trxmpno0tpt mo3iat s2uanmsnu)arermo3todoa  lnes (0 etm(o ny1lp nmivsa( a2rrx  no0tlxn octytlm2rl(mp;u4tetrmr3ty1op  liesl(0sruo(m3nu1lmeemneiatf Dra( pnt4opto icilsls emnvo u)tleoio3ootfa eaneo (0texmiopoydap n nci (fsDrrx ooo1oeeoiieiaslsDemu snu) etnxocoo1op rau il( teur(r iy4al nliet (  rtm( pou1open i3iydlm umu s u)tltoxocoa1op raieslt)seto(opoodope lnvtas  Dum(ro;o0oex  oeiaslmDum(vpnt0 exoxocto1laDr uvsl(  rxmxrpoo1oltnlivt sf rrm(  ;o0aleomoetytfm2rm(vsnt0arxoir3iodomte ues ()texmxm oy4oltnlnci (fsDurxrpoo1oet mi3tldla2ranms ()trermo3iy1fat  u s;s)trum(rpio4ape lfcs sfa2rmur nu1opxnmocilt s el(mo t4 leomr3oy1lptelnei t0trtrxm iy1optn ieils sDtrumpou0apto f3iysfmDuanms t) rxoio3oydfpDeluvsls seurimpio1lp emicsa()srtrxrpou0tetomoeiatlm elums u4altomfciatomD  ivs t) 2ur(r3iu1alt mfct s)a2raxr no4tet mf3tasfsDulnmsnt) exnxr io1lpte ueolt0 2umim oy1am  mnvs t  Dtaxm no1oleo fcilsfaDumuvp;u) lxoir oy1lmt  i o t0teumxopou4lmtnmnci sf Durxmo;o1oltoiieiadfmDeluvo;u)aeenif3tydomDean o t0 etrimpoydlltnlncil( aDurx  ;t0aetnif3tyd a um(vo;()texnmociodfat lu i ()trtrxr3nu1llen ictls sDrrxm nu1tle if3tydfm2uau on(0altoifcoo1lp elies;s0srxoio nu1ol  mnviltf Dtaxr ;t4aexnmicild mDel( ont)tetrxr iy1fpDr nvs ( srtoxr3ny4opt miesas s2ur(  nt0oetnmoeildfa2uauvs;u0aetoxf3io1lpDrlu i;( tetoxr iydaltn nvs t)artax p;o1ape io3tltfm em(vont0trtnmf iydlpDe iesls0s2urxopny4aleeliei t) Duauroou1aee  ocilslmDrlnvp;u4 rtrxocia1op eaiei;( texo(rpoo1al nlfciat)sDtr(mpoo4texomfciasfs ul(vsnu4 exomoctytoaDe u sls  2xr(o3oudope  fctlt)sDuaumpot4aet  f3iysla2el( p t0artoxr3oy1op rauvsl(0 2umirpoo1apeemfci s)aDtaxmpnt0oetnmfeiat s em(vpnt0tetnxf3ia1oat auvo s0setm(mpiudlleemfctlt  rtmurpno0oex ifcilsfm rlnmo;t4 lxomf3todlp e uvol( t2tmxo3no1optelfcs ( a2rm(r oo0oex  fciadfa2rm(msnt)aexrmfcta1lat  ivi t)trurxrpoo1lmeemneia(f Duax onu1oexomi3tls s ranmo;u)artnircia1fpteai o;() 2umimpiu4ope lieilt)srrauroou4aex ioeiasfs2ea( pnt4tetoxo iodoa rli i t s2tr(rpiudlpeeliei s)aDtmx p;u0tpt ioeiydls2eau on(4tlxomf3oo1lm r n ols sexr(mpou4amt mict tfarrr(ront1apto feiadfm rl( o t4 rxoxoctodfm   nvs ( s2tmxo no1omt  iviat)arumxrp;o0tltn ictytfa2raumo;u4aetrir oadfmDeaivilt)srxo(o3oy1ol nmfvil( srraum no1aexnmoetyd a2rm(mo t0trtrif3oydfatean sl(0s2trxr oo1lm elfct t sDrrxr nt1alx mieilt m uau o t0 leomrcoo1fatelivs ()trxoxo no1oltelnvi t s2rax ono1alxomoctas mDrauvs t0texrir3tatfmte u s t0seuoxopnu4lpen ivt tfaDumxm oo0aptomfctlt m2ulumsnt4alxnmr oa1lp rlnvo t0texoir iu4lleelfeslsfarua(m ou0tpx  f3ilsfs2ea(vsn()trenxr3ootlptelnvo ()sexrxo iydlpte nvs sfarrmx  no4oltnio3iaslsDrlnmo;t4 reoxr3io1faDrlues ()trxm(m3iydlpt  ici t  rua( pnu4altoifciasfmDul(ms;t0trxnircoy1oaDr i il(0s2xoio3ou4lltnmfvil() rrrxmoot4aet io3ilt a2eln p u0 rtnmf oo1faD lies;(  etmxo nu1ol  livt t aDumumo;u0alx ifetys m rmumo;u0trxrmo3oatfpDrlivsls0s2xmim iu1ole lict t)a2urxmp;u0oetn o3iaslsDemuvs (4tlxnmr3iotfm r u i;t) euoxrpoodap e fes t  Dtmx  ot4opt mociytfs rlnvs;u0 reriociotlaDrli i;(0srurirpnudameemnvt sfsDta(rpot4apeo f3tlsfm emumo;u4tltoioctydlpteau i s0 eumirpio1omen nvta( s2raumpot1alenif3tld m ea( p;u0tlxoio oy1laDeln s s s2xoxopiu1am   fcsa()aruax pnu1altoif3iasfa ulnmsn()arenmocoydoatrlivolt0 2uo(r nydalenmfctatf rurx ooo4tptoif3iyt m2emu o;t4 exrmf3oa1lp  an i ()s2xrxm3iu1op  livtas aDururooo4oexnii3ildla emumo u4 ltnmf3iytfat auvi;t0 eumirpoo1am  mietlt) Dtaumoot0olt mocilslsDumnvs;(0 ltrxociytfaD aues () rxmxr3oudaltnlivslt)a2taum nt4oexoiieild mDumums;u) ltnmo3iadomteluvi s0t2tmirpiudal  lfei (  Dumx pno4tlt ii3ilsls el(msn()arxnirctodlm r uei t  rto(rpiydape miesas)sDua( p;t0opxn fciasls2elu pn(4 rtrxf iodlaD liesls0s2tmxrpoy1am n feilsfsDur(rpoo4oleoifeiadfs2rmu p (4 ltrxr3oadla eaivi;s)s2xmirpiy4omtnmfeil(f 2tr(mont0oetomo3tasfs rluvsnu)tetnir3tadlpt aueo s0srtriopoo4lm  lfcia()aDra(  nt1olx  octlslm2em( ont0artoif3oa1fmtelneo;s0s2toir nu1lpe lneia() 2ra(mpoo4tetniieildfa ulnmo;u0arxnif3iydfm e uvil() exrim iodapen nvsa()sDta(ront4aetn ocilsls rlu pnt)alenxr3io1fmD livi;(0 rumio oy4ape lnvtls s2rr(rooo1ope if3iasfaDel(vsn()arxomr3tadoatr nvo;t0t2xrxr nydlm   fcsl()aruau o;t4olt mfetatlsDelnmpnu4tetoxr3tydomD  neol(  rxmxm3oudole mics ()arraxrpnu1alxnifetad sDrmu o ()alxrmo3ty1lmD  nvo s)texrxr3oy1ope lict (f 2uaxm ;t4apeoifciyt m umuvsnu0 renxo oatfp r n s t0trxmir nydlpen feslt)srtr(  ;t0tpx mo3iytla rluvont)tlxrmr3oytlpte ivsls)s2urxm3oydop elfei t  Draxro;u4ape  fetls a2em(mp;u)tlxrxf iodlmDeau slt0setr(o3iodam nlfctlt s2rmur nu1tlto octysfsDuau snu4alxrxociydoat aivs s0trxrxrpoydll nmivtasfarra(root4texn o3iys s2ea( p () lxrmr iatlmtelivo t  eurxrpio1oltn netltf rtaxront4tpe  iciys m2ea( sn(4arxrioctotomt auvi s0teur(o3iy1aleemicsas)a2rru  ot4aet  ietltls rlu p t)tltrmf3ootoatean o s0sexo(o3oy1ameemics sfartr(mpno1tlx  i3ildla2ea(mo (0 rxrmr3tadfptraneslt trumxrpno4optnlfcsas)arurumoot1oex  iciyd m2raumo (4 leoif iatlm  an ols0 exmxm nu4ameelivs tf Dtr(m nt1alxoiiciatlsDulumsn(0aleoxociytlm  auei;t)t2toxmpiodom  lncsa(f rrru p;u1optn ieilslm em(mp;()texoir3tydoaDrlnvilt)sexm(o3no1amt mnet ()a2tmump;o4tlx  oeiadfm uanvs t4 exrirciy1fm eaueo;s) rtrxm3nu4olt  iesat a2um(r oo4aet  fciytfaDelnms t0aeerif3oo1fa elnvo s0tetoxm io4oltn fesl(  2taxrp;u0altoifctatfm2rluvp;t4 rxrxr iytop eaues;t0 eumxo3no1om nmivsltfaDtmurpot0oeen o3tydfm umn s;(0aeerir3io1fm eln i;t) eum(r iudlm emfetl(f rua(rp;u1tptnmi3ild sDuaumpn(4trxoxf oadlpD anvs s0s2um(mpno1op n fei t)arur(mpnt1opeomo3ilsfm umuvont0aexoir3iy1opDrauesls0 rur(r oydop e icsl( srrmur ot4texo fetysls rlnms;(0aeenif3iydfatrlnei;s) rurxr iu4ope lfcsls) ruaumpou0oetomo3ilt m elu pnt4 renif oa1opD aieol()t2xrxopnu1al e iesls) 2um(m ;o0ape mi3ias a umumont0 eenmr ta1fmD au s s srumxm3oudame mivs t  rururpno4olt moeiadls2ul(mpnt)treoxr iodomtelnvols) eumxr ou1llt mnei () rurumoot1aet if3iytfm el(vsnt0 exrmr3ootopDrlnei;s)s2xr(m3iy1am nlfctat)sDrmur no4oetn f3tas a2rmnmon(4 rxnmfcty1fateaivi;(0t2uoirpiy4omeemnvsltf 2tru oot1olxo fctyt s2emuvo;()tetnmr ia1fmDrai i;s0 etr(m iudamt lics ()sDtaump;t1tpen f3iadfs eauvo;()tetoio iotla rlivolt0 2uoxrpnu4omen nvs s) ruaur ;t0aeeomiciysla2rmu p t4 ltrio3oo1fpDr nvs;t)teuo(r io4ol e ivtl()sDtr(m ;o4oexomi3tls m umnvp;u)trxomf iotfmt lieo;t srtmxo oy4amt  ics sfs2taxr oo1optn ieild s rm(vp;t4 exomf3oatlmtelivi s)srurxrpnu4openlnei s srraxmp;t1tpen i3iyslm2ulums;(4 ltnxo oodfp rlnvilt)teur(rpnu1aptelies (fartaump;t0aeeniieiys a em( p u0 lxomf3to1fpDelieo;( t2umio3io4am elfviatfsrrmxr no4teeniociyt m emuvsnt0 exnmrcoy1optr nvo;(0 rtmimpny4op n nesls artrum nu0aex ioetasfsDrmnmsnt4arxomf ty1laDelues (  2xoim3iy1al   nvi t) rtr(mp;o4tex iociltfs elu on() eenmo oytoateli o s)t2trxo iodap e ncsl(  rrmurpno4alenifeiasfa rmnms;()aexomr3iytop rli o t texo(r3iodlp n fesls)srur( p;t0aex micias aDumnmo t4teerxfciatfmte uvsls t2uo(r oy1llt mfvtas)aDrrum oo1ope  ietadlsDuluvo u0 rtrmo3iy1fm elnvo;t s2urirpoydolt mfvs t  Dtrumpou1tlenmfeiytfm2eau s;t) lxrxo3tydlm ranesls0srtriopoo1amenmfcs sfsrrax  no4tetoiieiaslaDrl(mp u0aleomo tytlm r i i s)t2umxo oo1al  lfvtatfartax  nu0optnifetldla2ranmsn(4arermocoa1fmDeau ilt) exmxo3oudop  mfesa( sDtaur nt0olx  ociyslm2ranmp t) rtrir oodomDr u s;t  2xr(opiy1lpe miesltfs2ua(m ot4tltoiieiadla umu s;t0 lxrmf3to1lp eaues;t) etoimpiu4omte fesat  rrmu p;u4oee  f3iatfmDeanmsnt)altomf oytfmDraneslt)s2uoirpno4lle  ncsa( s2tax ooo1olt  f3iadla2rlump u4 eenmf iydom eaueo ( trum(o iy4ale lnctat  Durxmo;u0oexomiciytfa2ua(mp;()tltnxfcoydlpt aieo;s0seumiopoo4op n net tf 2uaxmo;t1olt moetatla2ua(mpnt0trxoifcoadfa elnvo;( sexoir3no4olte ici sfarraxrono0tlx mieiadlaDulnmsnu4arenxf ia1fa rlu o s)srxr(m oudlmtemfesatf 2tmxmo;u0texomociatlmDemums;t0 rxnmrcoydfmDeanvslt  etrim ny1lm emivilt)sDraxrono4opxniocilt mDrl(vs u4arxrxo3oatomtrli sl(0trtr(opnu4optnlfesa(f rtmurpnu1aee io3tyslm2rlnmpnt0artnmo iadfa ranvo ( trxoxo3ou4am   ncs s  rumu o;o1tptomieilsfm2em(vpn(4tlenio oytlmDr ivo t)t2umio iydaptelfeslsfaruaxroou4oex io3iatfs emn pnu0aleomo3tadlmte n s t)s2urxo3iodolt  iei s) rumu oot1tptomfeiatlmDuanvont0arxnif tatfate n il( sexrxr3oydalte ivtas)aDumu pno4oex mociadfaDrmuvsn()aexrmf3oy1lm e uvs;(0 rxrxopoy4lpeemfvia( sruaur nu0tpe iieiat mDemn o;()artrmf iotfpD lu i;()sexoim oy4ap elnvs s)sDurxrooo4ope if3ilt aDean pnt4 exnxfciotomt luvs s0srtrxm3nu4ome lfvs t)a2urx  ;t4aee mieildlm2raumpnt4trerio3iytfa r u s ()texo(r nydop e fvia() Drrxrp;o0oeeniiciad m ulnms () etnmr iydop  an s;t)t2to(opiudop  mici ( aDrmump;o1oeeniictas s emn pnu) rxnir3oy1omte i s;()srumxrpoodop elies t)aDraxr ;u1oee  fetydfs2ean s ()aetrxr ta1lmtraiei;s0t2xrxrpnudaltelfvtls)artmurp;o0oltomf3iyt m rl(mo t)tlermo iydfaDrauei;t tetoxr3iodole mneia()arrm(rpnt4aex moeiydfsDea(mo u0 rxnxf iadfpDeluvils0 2trxm3oudam  livsls) Duaxrpot1tetoioetydfsDrlu s;u)trenir3ootom  lneilt  exrxr3nu1ol nmict ( aruaur ot0aet mfciydla ran s;(0alxrxr3iy1fatrlieils)trto(r nu4alt  fetlsf rum( poo1alt  ieiytfaDeauvs (4arenmr ootlmD ln ol(0srtr(o no4lm emncsls)aDum(mo;o1ole  octysfa eanvo t0aetrxr ty1omD aueo;t0 rtmxmpio1amenmfcsa(f 2rr( o;u4oexoioeiytlm2elnmpnt) lerif oatoa  li ol(0tetoir nu4ap elfvsasfsDrrxmoou4tetomfeiydlaDrluvo;()treomo ty1om rlu s;()texo(o oydllt lneias) 2tm(mo;t1tpx ifeiadls ea(msnu4aetoif iodopDrlivi t0s2toio iy4optn fet ( a2ta(m ot0aee ioeildls2umn s;t4 ltoio oa1fmte uei;()trurxo3iu1lle lneil(f 2raxrooo4ale ifeiytlmDemu o t)texoxrciy1lmD  i i (0t2xmiopoy1ome lneiat) 2rmx ono0tpxnmieilt aDuanvp u) rerxr3iy1fa rlneo s0s2toio3iudomenmfes () Duauroou0oeeoifcild sDrm(vpn()aexrxr tydlpDr u sl(  rxr(o3nydllee nvtatfsrrmxro;o0alt  o3iys s el(mont0aetomocoa1omDr ivo;s0 exmio iu4lm nlict sf rrr( o;u0oeeo ieiltfm rmnvp t)tetoxf3oy1fa  aivi;s0t2toxo3ou4lp e fvtas aDrrur no1optnmoeilslsDrau on(0tltrifctatoa   n sls sexrir3oy1lmtemfviasf rtr( oot4alxoifcild s2uln pnu4 lxrmo3ia1fa rau o;s s2umim3no4lpt lnetl() Drmx pou4tlto i3iyt mDeanmo (0tltomf to1lmDrlieo;()seumim3no4al  lici t)a2tauro;o1alxomfctyt aDra( pnu4aeeoxr3oy1lp   ieo;s)sexmir nu4al n net tfsDuax  ;o4opeoif3tldfa ua(mo;(0areoxf3tatopDelieilt)trxrxo nu4ome  ictlt  2rm(  ;t4opxo ietys m um( on(4tlxnmo3oodopte uei;s) eurxmpno4ape licsas)aDrmxroot1aptoii3tyt s eaums;() etomf3ty1fpDe nvi;t0trxr(rpoydam elieslt)aruru onu0apto ietls s emn p u4 reoxo oatfpD  i i t0tetmxm nu1lm   ieiatfsrrrurp;o4tltnio3iytlmDeanmpnt)tlenircoo1lpt livo;t srumxr3io4ame  ivt sfa2rmxmpoo1apxn ictysfsDuanvont4 exrxrctytlpD li o;()trtoxm oydlm   fcil(f ruax  ;o1tlenmfeiyt a2ul(vs u)tetrifctytomD livol()trto(r3ny4optemfvi (farrrxmonu1aetomoctasfsDuanvs () rtomr3oadlp  aieo s seum(r ny1am nlict ()s2raum ;o4aeeoioctasfaDua( pnt) ltrmo to1lat  ivsls)trtoim oudaleemnvslt)sDta( onu0tpeomocilt mDelu s t4aexoif tatlmt anes s s2uo(r iu1optnlfctl(  2umu  nu4oleomfeiad aDemn s t)teerxr ta1omDran o (0 rxmirpny4lm elnvils  2urum oo4ope io3tys sDulnvo;u0 exrmf3oatomtrauei s  exoirpio1lp  miviatfsDrrxr nu0aptn i3tatfs2ua( s t)teenxr3tytlm  au i;s) exoir3no1llenlfesa(fa2ra(roou0apenmf3iadfm eanvon() etoxo oydfaDe nvolt s2xoio oy1lpte fcs sf Dtr(  ou4ole moeias sDemnvont) eerxfcty1lp  livi s0tetoiopoy1opt mictls) rtmx o;o4olt iieiat mDum(mpnt4 etomo3oydlaD auvs s0s2uoio3oy4ape  nei sf 2trx  ;u4tpxomfeiatls rmuvs u0texoxf3oadomt ai o t s2xoxo iu1amt lfvi s srurxm ;u1aexn f3iad m2eauvpnt0 leomoctodom ranvi;s  exrxm3oo1open fcsls aDururoot1teeoiicias mDrau pnu) exrxr oydfaDelivo ( t2trxm3nodoltnmivsltfsrur(mp;o0oleo ieiasfa2rluvsn(0 ltoio ootlm   neolt0s2uoim ny4ol nlnctlsfsrrr(mono0apxoii3ildfaDelnvo u)tetnxo totlpD aneils) rxrxr3nu1apee ics (f Durxr no1tlxniieild s el(ms ()aexrxo io1faDrlivi s) 2uoxr3ny1ll  livilt arururono0tlxomoetat s ua(msnt0arxnmr3iadomDr i i;t0 rtmiopoudoltelfes ( s2umurp;u4texn feiyt sDemu o () etrif3io1lp eln s t)srumxo iudlmee iet sfaDururp;o1tpx iieiatla rauvp t4 etnmr3iatfatr uei ( texmxr3iodale mnvt s aruau pnt4opt  fetld a2um( o;(0tlxrmfctydomtrluvo ( sruoxr ou4amee icsatf 2tm(root0tle mfeiatfs2ulums;u) lxrxr3oo1lpD an o;s0seuoir iydale  nei s) Dtaxmp;u4tlen i3iytla elnvp;u0tetnxo iodfatrln slt)t2tm(r iodap nmivias srrmu  ;u0tpe mfeiysfs uan sn(4 rtrxr3todlpD  uvo s0t2xmxr ny1lmtnmietlt)arraxm ;o4aexnmietls s rm( s t4 ltnmf3iydfmteau i;(0t2uoimpoy4am nmivsa(faDrrur ot1tptnii3tls m ra(mo u)aetoxf3oatlmDrli o;s)sexoimpou1alen ivslt  Dtmu pnu0apeniieiydfa el( on()alxnxocoo1lmD anvo;t) rxm(mpoodaptnmfet (fsDrru  oo1ale mo3ias mDra(vsnu)alerxo3ia1opt ai o (0truoio no4ameemneils  Drax ono4aptnmociytfm2uluvonu0trxomo3todlpDran i t) 2uo(opoodope mncsls) 2rm(mp;u0altniiciatla em(vpn() lerio oa1op rln ols) 2tr(opiu4ole licsa( srurx ont0tlxn octadls2rl( pnu4tetrifctydlatranvil(0trxmxopiy1op e ictlsfsDrrurp;o0optnio3tadls em( o (0arxrxr3oodlm rlies;t) 2tm(r iu4alte fcsat)aDta( ont0oltn ociltlsDrmuvp t4trtrxfciy1fatrli i;s0srum(opoydlmtemfcilsf 2ra(mpot4tpto feiadfaDeanvo;t) lxnmr iodlaDrlu s s t2tmxmpiy4lmen fvsltfa2tm(  nu0alt  octadfm rm(mp t) exnxf3oydoaDr nvolt)t2tm(mpoo4lleelfvs s)srua(mo;t1optnmfciasfmDrau s;t)trxnxocto1latr ivslt s2ur(o3ou1omeelfetat a2umu o;u4apxnmictad m2ulnmo u) eermocoo1lat luvo;s t2xoirpiodlpt livilsfa2um(mpoo4alxo ieiadfa ulumo t)tlxrif3oy1fmDr uei s teuoiopiu4llt mfvilt)sDuaxro;u1tetnio3iydfmDumu snt0tetoxo iydfp  aiei;t) rurio no1olee ictlt srrm(ront1alt  i3iltls2umnvs;()aeermr tydfaDelivi t)srto(r nudlp e fet ()sDtrxroou1apeniieiasfm eau p;u0aetnio3iadoa eaneolt0 2xmimpiu1omtemfei tf 2uaum ;t1aexo feiytfs umu pnt)tetrxfciodopDeli s;( texrxopno1aptemnvtatfa2ua(  nt4tpt mfeildfm uanmo u)trxrir3iadfpDe uvi;t s2uoir nydom nlivt t)sDur(rooo1tetoioeiysfm2ea( o;(4aleoxfciydlm   nvs s0texr(r3no4ll emnvt ( sDtruroot4oetnmocilslmDulu o;(4 ltrxfctydfm elnvi (0s2tm(rpiodlleemnviat a2uaxroot4apxnii3iat a uluvsnt4tltrmr3tytopD liei s)s2urxm ny4am   fei tfsDtmxmoot0aeeomietaslm2rl( s;u4artnxf todfaDeauvs;t t2xoxopiy4lmtemfvil( a2tr(r nt1alxnif3ildla umu p u) lxoifctytlmte ueolt)s2xrxm3ou1oltn feta()aDtr(mpnu0tetn i3tys sDuluvonu)alxomo iydopDeln ilt srto(r3iodole  ivtls)sDrm(root1tlt  i3tytla rluvp ()altnmrciatlaDe ieolt trxmimpiodlm emfesa( a2rauro;u0olto ieiaslaDranmp (0 rxrio iytlatran sl(  exmir3iy4amtn iet t srra(r ;o1aexnmo3iatlm ea(vp t0teerir oo1fmt au il(0seumim3oy1altemnci s artau oou4tlt  oetasfaDeluvo;u0tltrmo3tatfmteauvsl()s2xoimpny4lmtnmfeslt)s2umxmpnu0alenmf3iydla2rmu pnt0artoxf oadfptelieols0t2umxm iu1am n fvt ( sDrmx ooo0aexn i3iys s rluvo u)alxrmrcta1fm eln i;t t2trio oodlme lictl(fsrraxrp;o1tpeo o3tatla ul( on()altnifcto1oa e u i;t sruo(mpou4alenlfctltf Dtrxr nt0alxnmoeiys a uau s (0 rxoio ia1faDrlnvs (0tetoxrpiu4openlfviasfaruaxm ;u4tex iictytfsDelnvonu) renmrcoytom e ivol(  eum(rpno4ame mnvs ()artruro;t1apxoifcias m um( sn(4 eeoxo oo1fa   n ils trtrxo iodap elivsatfaDua(m ;t1tpxoiietas sDumn s t4arerxf ta1fpDr ivi;()s2xriopnu4ome mfesltfartaxm nu1oeenmfcias sDeaumo;u4aexnmr3iodop  ai s;()s2ur(mpoudlle lfvi tfaDrr(rpnu4texomo3iyt mDea(vs (0trxomociydoa e ueil() rtr(r3ou4om nmieiltf Dtmumooo1optoioctadfa2ul( s (0tltoiociotfpteau sl(0 2xoxrpoydlm nlncs tfs2tau  ou4tetomi3tyd m ranvon()altnmf iy1lp rau o;t0srxmio iu1al   nvsa(faDta(mo;u1ale mictltfm2umu p u4 eerxfciytoaD au i;s s2urxr oy1aptn fvias)aDtrxm ;t4aeeomoeiltlm rlumsnt0texnmr3tydopDraivols  exo(r nu4lle mfet t s2ur(  nu4aee if3iatls2elu p () etnio3ootfmte ueo;(  2tr(rpnodope lneias)srraxm oo0openif3tytls ulu p (0tlxrxf3oytlp  lnvs () rtriopoy4ape lfcias)artrx o;o1aet mfetad a2el( pnt4altnxr3io1lptrlnvolt)t2xm(o3oodomeemfct t)aDurur ;t0apenmieiatfs2el(ms;u0texomrciotom  aiei;t  eumio3nydamte ictas s2rrxr ot0tptomoeiyd aDua(mpn(4aeerircty1faDrlueil()srxo(rpnudaltelnet s)aDurxmpnu0apxo fetyd a2em( p;(4alxoxr3oytfmDrau o;s  rxrxrpoy4llt  fvs t)s2umum no1tlt mfctyslmDumn s;t)arxomo3tadlp rliei;t)trxm(m iu4op  lnvilt aDta(mpou0tex mociysfmDea(vp u4tlxnircoodfm  auvolt)s2uo(o nu4om nlivi t)a2raxmo;o4alt if3iyt a rauvs ()artrmf iodlpD  u sls)sexoxr3oo4ol e fetat) rra(m no1oleomoeiytla2rauvpn(0 rxnirctytopDrai o;t)t2umxopnydolenmics t)sDuru ono0oetn oeiytfs rm( o;t) reoxr to1fat  ueo t0sexrxo3iu4lm  livs () 2rrx p;u0texnif3tytlaDrln o u)trtomfciotop   uvi t0 2urirpno1am e nvia()aruaumoou4olt moetad m uluvp () lxoif oo1lpte ivo ( s2xrirpoy1lpte ietasfa2tmxro;u4oee moetat mDeanvp t4 ltoio tydoa r u s;s0s2um(m oy1omt mncsl( arum(rpou0apxomiciatfm2el( pnt)altrmr oydom   u ils) 2ur(opnodame mfesls aDua(  ;u4altnifciysfs2raumo;t)trtoxf io1lm eli sls  eto(o nydal nlies ( aDtru  oo1teeoii3iadls rl( o;t)arxomoctydlmDr i i;t teurim no1omenmncsatfa2uax pno1olt  fetasfs2ean p t0 eeoxo ootopDeln s (0srxrxo iy4lpee fct t)sDrrxmp;o0alxomoeiad a rmnmo;u4 rerxr3tatop eln i;s0teumxr nu1om emnvtlt aDumxrono1aeeo ieiadfm eanms t)tetnir3oydlatrln o;(0tetoirpoo1ape mnvt (fs2uaurpno0tpxn ictld a2emu p t) lxrio3io1lmte nvol()srxoxopoydom e fct () rtau o;u0ope  fctyt s2umumo;t0 rxomf to1lmte uvi;s)trxmxrpoydll emfvt ()artr( oou1tpeoiictysfa uln pn(0arxrmr3iotlp r n olt seto(opiodll nmics tfsDrmu  ou0tex iiciyd sDuanmont4alermo3io1lmte ivs;t teuoxo3nu4optemnvi sfs2rmx  ;o1texo i3iltfs rmu pn()aeerxf3ty1lp eaies t) eto(r3ou1am emnctlt) 2uax p;u4tex io3tls s2eanmo u)tlxoxfcio1lmDr uvs;t  euoxr no4lpt  feia(fsDumum oo4tptnmi3tldfs2ulumo ()aeeoxfcta1fa r n il( seumxr3ny1alt livi (fs2uax oou4oet mfeiyt a2rlump u) etnmo tadlp rlueo;s setr(mpoo4ope livi sfs2ua(roou0apto fcild m ua( p;u)tetnxr3to1fmDe u s;s0t2tr(m3ny4apt mneia( a2urump;u1aetniieiasfmDul(vs u4 lerio iatoateauvslt)tetoxm3nu1op e fvt (  Drrx  ot4olt  fctatfs uau o u)tltoir tadoaDrlneo s)trxoxr3iy4ol nmneils)artmxm nu1apxn f3iltlmDemn s;t0texrxr3totfp  an ol(0 2xo(mpou1om  mnvs ( srtrxr ;t0apt mocildlsDua( pnu) rxoxo3ta1lmt lu o t0sruoir io4optnmicilt)sDrr(r oo0texniietldfm rmu s u)tlxrxf3to1opt auvslt s2urirpiu1lptemieil(f 2taxrpnu1alxnmfctytfmDrlu p;t0 exrif3iytfa rliei () 2toiopiodlme  ivtatfsDtauro;u4opx mf3iasla emnms u4altoxrciytlmt  u i t)t2uo(m3iy1lle lfeilt sDrr(r no4tptomo3tys aDum(mon(0tetnmrciatfm eanvo ()t2trio iydal  lneil(fsDtr( p;t0ope moeiytfaDrl(mp u)arxnmo oytlatelneslt teumxm oy4lmtemieilt sDua(mp;t0olx iociltlsDeanmo;(0tetomf3ty1omDrauei;t sexr(o oy4open iesl()a2ta(m ;t0opt mo3tasfsDum(mpn() rxrxfcoytfaDrluvo;s) rtmxr nu4am   fvt s)sDtaxm ou0tle  f3tld sDemumo;()trxoir oytfmtrluvs ( s2tmxopiu1lpt liciat)a2urur ;t4olxniieiatfm2umnvo;u)aeeomr oadlmDelivo (0sexmim3ny4am n fvsa( arrrxrono0alt mi3iltla2rlnvpnt0 lxrxo3ootlpDraueo;(0seuoio3iy4llenmfvtltfaDta(rpou1tet ifetys m rmu sn() rtnir3iatfp   nes t)trxrxr nudamenmfetls  ruau oot4ape mfciatlm rm( onu) rxnxo totfmteaiei;t0 2tm(mpoydlm  lnetat)a2tm(mpnt1alx mfeilsfmDranvsnt0trtrio iydfmtelivil() rur(o oy4om e nvsas) 2uau pot0tpeomo3tytfmDrluvon()texoxr3ta1omDr nvi;t trxmxo3nu4amtelicia( sDumx  ;t1opeomieilt m ranvs;t4 etrio3iotfm e i o;s) rtm(r oo1altnmfes tfs2uax pou0aee ifetaslsDrl( p t)tlxnmr3tydoa elivs;t0tetmio ou4lltnmiesa( a2tax pot4tlt mfciytfmDrlnmo ()artoio3ta1lmDelieo (0setoio ny4ome mncs sfaDta(mpnu1ale ifciyslaDrluvs;u)aetnxrctadfpte uei;( sexoxr iydlle mncta(  Drruront0ope  ieiadfm2rmu s u)trtomo3ootfm  lieo s  rtoxm no1altnmivtlt srtrur nu0alt mfciltfa uauvs;t0aetrxfcoydfptelueo ()texmxrpnu4lptnlictlsfsrta(m no0tetoioctydls2uanmp;t4 etrxrcoytomDe uvslt0seto(o3iy1omen ieil(f Drr(mpnt1apxoiicilt m em(mo (4 rxrxrctadoa  luvo;s  etmxmpou1apte ivsa(  2trurpoo0teto fcias a ra(vp t0 ltrxrcoodla eln s t0srxrio oo1lpt  ivia( aDtau  nu1aee iicild s em(vs;(4 rerxf oytom e i ols0texoimpiu1aptnmfctatfsrtmxmoou0texn o3iysfs ua(mo;t) rxnxo3oodfpt luesl(0trtriopny1op e ncs sfa2taumo;o0teenmietltlmDemn o;t0 ltoio3ta1om eanvols)srxoirpio4llenmnetat a2ua(  nu0aexn iciad sDemnvs;u4tlxnmo ta1oaD  n i (0seum(r nudol e ict s a2urur ;t0oeeomfetad mDemn pnt4 etnxo3ia1latr ies;t  2tmxmpou1lm elnvta(farrmumoot1apx iiciltfs ranvo u4trxnxf oadfpDrau o t0 2tm(r3io4lle  nct t a2um(m ;u0aexoii3ilsfs2uau pn(4trenif3iadfate n o;(0s2xm(o ou1lm emfvs (faDtm(rpot4optoio3iysfa eanmp;()arxoifctatopDr ivo;t)setm(o3iodlptnmivtl(fa2tm(r nt0tet ii3iysfmDelu p t)aleoio iydoat aivi;s)t2uoxm3iudopt miesatfarum(m nu1altn o3iltfs eaump;t4arenxf3tydlaDrlneol() rum(mpiu4aleelivtl(faDtax p;o4oeto oetltla ul( onu) exomo3iatla rliesls srtoio3iu4lpenlfci s)aDtaxm ;t0tpx mfeiydfm ea(mpn(4 renxfcoatlateanvils) etr(o3nudomeeliciltf Draump;t4tet iicilsfsDulu ont4aexrio iatfmDr nvi;( t2toxo3ou1apenlfvtl() Dumxmpoo0aptn fctatlm2uan s t0aexnxociytopDr ivs;t s2tmxrpiodapt mivta(fsrum(ront4ope io3iatfaDelnmo u4areomocty1fpDrln i s)tetoxopiudlm nlietls)srrrumo;o1oee if3tlslmDeanmo;() etnif io1lmtrlies;t srxrim iy1ome mneiasf 2umurpnt4tpt ioeildlm2rmnvonu)tetoio3oatopDr ieo;(  exo(m iydlpe lieiat) Drrx  no1aexnmoeias s ra( p (4 rtrmo to1laDe ieo t)teurimpoudam e ictl(  Dtr( pot4aex mf3iatfsDrau p u4aexrif3oydla rlnvilt0t2xoxm3ny1lpt  iviasfsrtruront1tlxomoeiasls uaums u0 renioctotfateaues;t0t2urim3nydlptn ivt t  2rmxrono0olx ifetat aDeaump ()tlermfcoytlm rauvo s)truoim3oo4lpt  feslt)aruaxrpot4aexniocild s2rluvon(0aexnmr totlat  ivs;t srxoir nu1omeelicsas  Dua(m ot4tltn feiadfaDemn p;t0arenmf oydomtrlieo;(0t2umio oodam  mfei (fa2rr(r nt1tpeoioctldls el(vo u4 etomocta1fm eauvols)t2xoxo3nu4aptelfcsa(fs2umxrp;t4oltomi3tytfs2umu o;u)trxomfctotomtrlieilt)trtm(opny4ol e iet t sDumx pno0tlt ifcilsfaDrm(mo t4arenxf3oytop eln i;()sexmxo ou1am  lfvsa() rta(rpou1aexoioctyd m rmuvs;t) reoxo3io1lm  aies;s  rumxo3iy4lmt miesls srururpno4tlxoio3ilslmDulnmo (4 lerxf tadoaDr u s;( texmio3nu4omeelics s  Dtaur nu4opeo ieiysfsDem(mo;()trxrxf3iadomDe uesls0 2to(o3ny4om e iesa()sDtrumont4opt  octldfs2emnmonu0trxomf tytom  lnvi s t2umim3nudamenlfvsls a2tm(monu4tltn ictls a eln on()artoif3tatop rauvi s0trtoxrpnodomt mnes tf rta(  ot1tlen feias mDeau o u0tlxnio3io1lpD lues;s0 rxmir3iy1llte nesasfa2um( ooo1ale mo3iasls2em(mpnu0altomf3iodfmteaies ( s2toio oudlme lncsas sDururoot1tltoio3tad a2rl(mo u0areoxf iatlp rlu i;s)teurimpnudap   netls a2raur ;o0alt moeiadls2em(monu4 lxoxf3iytfmDraneolt)seur(rpiodllen fvslt)srrm(mont4aee moctytfsDrl(mp u)tltoxo3oydfpD auvo s) 2xoxmpiudll nmfesat) 2tr(mp;u1tptnio3iadfmDrlu s;(4 etrmf ta1fmt anei t0tetrxo3oo1lm elnci s s2rm(mo;t0tleomo3iadfsDemnmo u4aleniocoo1fp eauvolt  2xoim oy4om nmfesas)s2rmxroou1tpxoiieiys s2ean s;()aeeoxr3iodop rlu ilt)s2xmxrpoudopte nvt s srurx pou1alx  feiasls2rlnmo t0aeenmrcio1oa   i s (0 etrimpou1ol elivtls aruaur no1aetn ieiatlmDeaums;u4artomo ia1fptrau o s0teumxo3nu1lp elfctasfarumxmpnt1oeeomfciyd s2eau p;(0altoio oodlat an o t)s2xrxm3ou1opte feia(f Dtrurp;u1ole mi3tys mDuluvs t)trenxo oydlmtelnes;s0 etm(o ou1openmneias) rta(ro;o0tpen o3iadlm um(mo;t4altomr oydfm rluvi ()trtm(r io1opeelivsa(fsruaumpou4optn oeiadlaDrmu ont)trtnir3iatfp  anvs t  ruo(m3ou1opte fctl(f rur(mpnu4olxnii3ils a eln pnu0aeeoiociotlatraieo s0 etoxmpiodamtnmncta(fs2umuroou1aeeomictyt a ul(vpnt4 rtoifcoa1fp   neo;s) 2umio nu4omt mictls  rtaxmoou1oee moeiadfa emu pnu4 etrxf oadfpDrauvs;s  rtr(r3nu1altemfcsatf Dtaum ;t4tetoioctldfmDea( p u0 rxnmrcto1lateanvil( srurxm iu4op elivsl(faDtrxro;t0tlxoioeiyslaDrau p;t4 ltoxocoytfateauesl(0 2xrimpiy4apeemiesa(  Dtaumo;u1tltn feiysfm rm(vpnt0aetrio tydoa eai i (0s2xr(o3ou4ome lnci t  Dua(r no0tptnif3tytlaDuluvp t)teenircoadlat  neil()t2xmxrpoy4olen nes tf rururono4tpe ifcildlmDrlumsn(0 rtrxocto1fmt auesls)srxo(m3oy4lp elfes s)aDrr(m ou1olx  feiasls rm( on(4texnmo3tadfaDeln i s0sruoirpiy4ap  lncslt) ruaxmpot4teenmo3ilt a2um(msnu)tlxnir ta1lpDrlnvils t2umxrpnu4ll n ivtlt) 2rmurp;t4tpen oeils m em(vpnu0alxnxocto1op e ues (  2ur(rpoudaptnmieias  rumx o;o0aee iictyslaDumu o (0 lenmr3iydfm eaivsl()texrio3iudamtemfei s)aDum(mpnu1olx iiciltla umnmo;(0texnmociodla   uvo s)trxrxopnudoptnmfciasf Dtrxront0alxo f3tysfm2uaump;t4 lerio3ia1omtelieo;t)t2xo(opiy1ope  fvsa(  Dta( oou0tlxnioeiat s ua(mp (4trtnirciytlat luesl( seto(m3oudam  liciltf Dumx  ;o1oee mi3iadlaDua(vo ()alenxf3ta1omtr nes;( tetriopiy1op e nvtlsfs2ta(rpot1ape ioeiltfa eluvo;t4 eerir oo1la   ivol( srxrim3iydlp e fvtasfarurx  ;t0teeo feilt sDea(vo t4alenircoo1late uei t  exoio iydllt  iesat) rtaumpno4tlxoii3iydfa2em(vs;(4aeeoxr oa1laDeau o t0seumxm3oy4lmtnmfcsatfs2tr( pot4olx  iciytfs rlnmo t4 ltrif3oatomt lu i;s0teto(o nu1llte fvs ()aDuaurpnu4opxo ociytfa eln sn(4aleoxr3oy1lp r ies s)texm(m io4lleelfci sf Dumx pot4apxo ociltlmDea(vs t)artomr3totlaD lnvols  exmxmpoy1lmee nciasfaDuax o;u1tetomo3tad a rmnvpnu0alerio oatomDeli ol(  2to(o oo4apt lnes s  Duaxmp;u1aptomieiyslm2rlu o;t)aetomf3iadfmtr i ilt0truoxm iydomt mnciat a2tax  ;t4olxoioeiat m2el(mpn()tleoio3tytfate uvi;s0t2umxo oodal  lfeia(fa2rrurpou4tetomfeiydfs2ea(vp;u0aetoif iodoaDr u ilt) etmxr3nydal e ics sfa2ua(mont0apeomo3tlt m emuvo u4 ltnir oadfpD aies s)setmxrpio1lm   ivtat) Dumxrpot1tetn o3tat sDrl(vo;t0tlxnxrcia1oaDeauvo;(0 rtoxm oy1olen nviat  ruau  ;t0tltoif3ilsfaDrm(mpn()teermrcoa1oa elu o;s0srumim3nodlm  miciatf Dtau  ot0alx mfctysfa2rl(mp (0tetnir ty1omD  n olt0srtoirpoy1oleemfciat)artm( pno0tle mf3ild sDra( s;u) eerir3iodlmt aiei;t t2xmio3oodlmeelietl(fa2ur( o;t4ope ifetlslm2el( on(4 rxnioctadoat ln ils sexm(r io1openlnesls sDtmxm no0tlt mociaslm2el( p;t4trxrir3tydopDranei s)t2urxo3oydomee iesa() Dtaumpnu4altn o3iysls2ea(vo;t)arxoifctydoa r i i;s srxrxr3iu1ll  lfvia( s2urxmp;o1tptomoeiat m2emumo;t0tleomf oo1lmt ln o s  rxmxm ou1lme lfctatfa2ur(r nu0aet ifciaslm2ea( snt0teenir oytfa rli s;( s2urxopoodlle  neias) rrmxro;o0apx iictyt sDea(vsnt4trtrir3iotoaDrlu o ( srtoio3ny4ope  feia(  2uax o;t4tlxnmictlsfmDel( o;u4 lxnmfciytfatraivsls0sexo(m nu1apenlfesatfaDur(mpoo1aeenioetytls2rau o t0 lermoctadlmDrlu il()trxo(o oo4omeemics s sDuaxmpnu4aexoio3iys mDumnmo;(4trtrxo oodlp rlnei;s) rxo(o iodaptelfvil( arra(root1olt ii3ias m2uanvo;t0 rtomfcia1faDe ieil( sruo(o iy1ope lfviltfarua( o;u4oeto ociys a umump;t4trxomf3todom  ln s;s0seuo(rpoudome lfvt ( srurxmooo4tptomfetytls ea(mp t0 rermf iadomD lu s;(  etmir3iy4omtnlfetlt arur(r oo4oeeoiociyd a ra(mo t) lxnmf tadfpt auesl() rtr(o oudap e nvtl() Durumo;o0altniociasla2rlumo t4 exoio3oy1lmtraiesl(0s2to(r3oy1apenlivt ( a2tr(mp;t4opxoiieilt m ean o u4aeerir todfm e ieils0 etm(o iodap  mfvsl( s2rm(rpoo4alt  ictat sDran onu0 lerir3oa1omDeaies (0 2uoimpiu1am elivias)aDra( ont4tpxnmicils sDumnms t)teeoio3tydoatrauei;() euo(m nydlmtn nvtltfarrr( ono4oltnmoeiytlmDulu p;(4tetoxf oatop   uvil(0s2xrxm3nydolen fcs s)sDuauro;u1open octasls umums u4 reniocta1opDelnvi;(0trurxopio4amtelfei ()s2ururo;o1tpxo ieiydlm elnvo;t4trxrirciatfa elnvs;s0sexm(m3iy4op nmfeia( s2taxrp;o0oeeomociadfaDum( onu4trenio3oa1fatelivs;s0t2urxo iudomenmivia( s2rr( onu4aex mietaslm emumo u0 rtoif3oytopD aueol(0 rxo(m oydapt mneslt) rtr(m oo0aexomi3ias s emuvs u)arxoxfctadfateaivs;(0 rxrxopoydamtn fes t srtrxrp;t4oltnioetat s emumo;t)artrxr to1fpt ln s (0 rtriopoudlptelici t sDua(r ou1aet mi3tytfs2umnmp;t4tltnxrcta1op  lu s;s) rxoim no4op  lfvs sfa2urx  ;u1apeo f3ilt mDuluvont0 etrmo3oydoaD au ols0teum(opou4op   nvtls)s2rrx  oo4oee mociadfm raumo t)trxrxfcootomDe i ilt srtr(m3nodoptnlnvilsfaDraumpou0aexomi3iadlm2ranmo;t4 lenifcto1fa   i s;s) eumimpiy1apte ivsas)s2rru  no0apto icilt s2ra(vp (0teerif oa1lm eanvs;t)trxrim ou4olee icias srumx  ;t1oexo feiatfm2emnvsnu4trxnxrctatopD li il( t2tmxm ny4lpt mnvt s)s2uau oot4texoiictyt s ulnvp;u) etnxfcta1fatran i s0trtoxopoy4om emnvtl()aDtr(rooo1aptomfciydlm el(vp u)aeeomo tydomt au i;(  2uoxmpiy1lptn ivtatfartax  ;u0aeeoioctlsls rmnmont4 lxnxfcoy1om raivs t trxm(r3iydlpe mncsl(farrm(mo;t0tex mietydfs umnvsn()altnxr tytfp  luesls  etmirpio1ope  iei tf 2ua( oot1tlenmicild aDeaumsnt0alenmocootlmDeaieolt) etm(o ny1lmeelieias  rrmx ont0aeenifciltlm eauvs u)arxoio tytoate ivs ( t2xmir nudlptnmfetls sDtrum ;t4optn iciydfm2um( sn(0tltomrcootfa   u ilt0trtm(o3iy1aptn ict () rrmur ;u4tex mfeiadfmDrlu p t)teerio tytfmDrluei;s t2tmio iudalen ics t) 2tau o;u1aex iicilslaDul(ms u0artnircootopD auvi;()t2to(r3nu1llte nct sfa2taxrpnt1teeomf3tydlmDelnmp ()aetoxf3oydlmDr n o;( seto(mpno1lltnlicilt arrmumpno4tlxn fetytlsDrlnmsnt4altrxr3oa1laDelnes;(0 etr(m3no4alee ict t)a2rm(  nt4tlxn iciatla uanmp u)aetomo oadfm  au sls tetoir3nu1opee fesat a2rmum nt0tpxn iciltlaDelu p u) lenmr3iytlatr ivo;( t2urim nydoltn ivt ()srumur no1tetnii3iyd aDelums t)treomf3io1lm  lnes (0t2umio iu4ol emfcsatfarururono1apen f3tld s2em( snu4aexoxr iadoaD aneols srxmxr nodapte ies sfaDrm( oou0apxo f3iysfa eanmpnu)arerir3totlaDrli i (0teuoxm nodaleemncta() rtrx  no0open feiytfs rlnvp;() rtrmf3iy1opte uvi;t)sruoiopoodamte fvsas s2rr( ono0aeeomfeiytfmDuan o;(4 rxnxoctodopD liei;(0 2uo(mpoy4llte nci s)aDurxr oo0alto feiatls emums;t0aeermrcoo1faD lu o s) rtm(r3iydolte fviat a2um(m ou0olen i3iyt aDrluvo;t0 rerxo todfaD  n ol(0 etrxr3no1al  lnviasfa2taur ot1aet iociyt a2uluvs (4aeenmrciy1oa r nei;t) 2xrxmpou1llenlfci s) 2tm( ooo1tlx iieiadfa2uauvp;t4artrmr3tatlmDe i o t  2urxrpnydole  ncslt srur(m no0olt ii3iasfa ea(vpnu)tltrifcoo1late nvo s s2xo(r iu1om nlicsl(fsDtm(rooo4aet mieiadfm uan pnt0 leomf3tydfpDrlu s;s trxoxr3iydom n ivsa( aDtmxr ;t1tpt mf3iadlaDuluvpnt0 eeoif3iytomDrlivi ( t2umimpoudoptemfvslt s2taxmpot4alxo ieildlmDuluvs t) leoio oodlmtrlu o;(  eto(r oo1olenlneias)srurumo;t1opto ociysfa2uaumpn() renxr3iydlptrln o t s2tmxr oo4aleelfvs tfaDur( pnt4apto ieils m2rlnvo;u4trtriocoydlpt  ivo;t0srtoio3ou1ll emfcta( a2tr(r oo0tpe  iciltlsDea( ont)teenmfctodfmD ai i;t)s2umxr no4am   nes ()a2raxrpnu4ole  oeiys a2um( s;(4aexrmo oadlmt liei;s0srtrir iudlltnlieilt)aDtrxmonu0apxo ictasfs2rmn o (0tlxnmociodlat  ieo;()t2urim io4ll   ncs (fsDuaum nu1tpxnii3tatfsDea( snu4arxoir oydlptelu o;t trurio3no4lpe lietas) 2um(ro;o4tlenif3iysls ua(ms;t0teenxr3to1oatr i i s0trtmxr oo4omee fvi t srta( pnt1aetn ociltfmDul(ms;t4 lxrio iodfmte uvsls)trxm(r3oodlm elivil(f 2umx  ;t0tptnioeils m el(mpnu0trxomf3oy1fm   uvo;()seumxopiodoleemnci t  rrau  nt1olen fciad s2em( s;t) exrmf iytomDr n o t)srtr(mpou4lmt  ncs (fartm(m oo0oleoiiciadfm rl(ms;u0 exrmrciytlm r nvs;() 2toxr3nydol e ics ( a2tr(m nu1tlxo ociaslsDean s u4 exnifciodfa  au i;() eto(o iu4ome  nesatf 2tmx p;u4aeto icias m eauvp;u4 rxomr oadlate neslt0tetr(r3nodolenlfciat aruru  nt4tetoif3iyt a ra(vo t)tltrmo oa1lp rlnes s)tetrim3oudomtemnviltfsrtmump;u0tpeomfcildfa uln o;u0altoxf3iydfptrln s;t t2tm(r3iudlleemicia(fs2rrx pnt1opt iictyslm2ul(ms u) etrirciatop r u i t trxmirpou1lm e nvtat)a2rr(mo;u1opeomiciyt m rm( onu)aetoxr3tadomD  nvil(0texrir3ou1alt lfctlt)sDta(mo;t0apxnmi3iatlmDelumon(0altnircoadla eluesls)tetm(r no1am nmivtat)aDtr(rpnt1oee mfctltlaDum(vsnt)arxoxf iadlp   ivols) euoiopnudole  icia(  Dua( p;t4opxnmfcildlaDran o;t0arenxr3ty1opt au s t0 2trxm3iu4openlieilsfs2tm(r oo0oleoiiciys aDeanvo u)trermrcootlpD li sls t2toirpoy1lltn fvilt)a2rau  ot1tetnioeiltlmDem(vo;u)artnif3totoatrai s t s2to(o ou4lpe lieta( srtr( p;t4oex if3iasfs2rlumo;u)arxnmf3iy1omtrlnvi (0srtrxo3oo4ll emivi ()a2ta(  ;t4oeenmfeilsfm uauvs;t4teeoir3iy1op  aivs ()trurir3ny1olee feia()srrmur oo1aeeomictysfs2ranvs t)tltnmrcoodoaDe ueslt0 exrim3oy4openliesat)sDrrx p;t1texo oeiasls2eauvo;t4trermocoodopD  ivo;s srxmiopio4lpe lnvsl(fa2trum no0oeeo i3iys a2rluvs;u4 reoiocty1om ranvs (0 rumirpnu1ap nmnctl( srtm(mp;o1tlx  ietys a um(vpn(4 etomoctodom  luvslt  2ur(r ny4olt mivtls  rtmumoou4alenmieiatfsDumnms t4 exnmo ta1lmDr i o;( teto(m3iydomee fct s a2trx pnt4aptoiociasla2raumont4 etnio3ia1lm rluvi;( trxm(rpiydomenlics (fartmuroou0aptniieiydfs2ran on(0aeenxo3to1fp rai s ( srtrxr no4ol emfetl() rrm(m no1olx  i3iyd a2uauvsnt4alenmrcootfm eln s;t) 2xm(r ny4ole lietlt  Drrurpnt1apeoif3iytfs2ranmon(0tetrircoadfatr n i t  etoir3oodamtelfvt s arrm(rp;u0tetnii3tltlaDea(vsnu4 lerxr ia1omt lu s;s setrxr3iudom  lfeslsfsrtr(rpot1ape ioctlslmDelnmsn(4aeerio ty1omD auesls0t2tmxopoodal elici (fa2tm(m ;u4aeenioeild m uanmp;t)arxrmocoatlp eliei s) rxoxr3io4om n ivslt aDrrumpno0aet moeilt aDelump u)alxnxo3tadfp eai i t) euoirpou1olte neslsf ruaur ot4apto oeils m2uln o u0teermo tadfpD lnvi;(0s2toxo ou1alenlnesls)a2taur no4alxo oetlsfsDem(vsnt0tlxrxo3oytomt  ivs (0t2xo(m3nydlleemfcia(f Dra( pou0tee iieiadfm uluvp u) renir3tytopDr uvo;(  exr(m nodlmte fvtas aDraur ou1teeomieils a2um(mo;(0artrxr tatomDeaieo;( trtrim3oy4oltn fcslt)a2tax  ot4tptomfeiad aDumn on()trermr3oytlpteanvol(0seumimpoudomeemieias)artaumonu0aptnmieiydlm ua(vp ()tlermr3tytomt anvs t)trur(r iydolenlfviatfsDta( o;t1oeenif3tasfs2rmumo;(0treoir oytfateauvols srxmxo3nydapen ivs tf 2ur(m nt0aet iociasfaDeanmp u0aleomf3iadlmDeanvols)trxoio nodoleelncsa()a2tax  ;t1olxnii3iltlm emnvo t)alxnircoatlm rlnes () exmxm iu1lmtn ivtl( aDtr( oou4optoifetls a2um( p;u0 rtomo oa1omDeanvol()setrirpou4ll  mnesl(fsrtr(moot0tpxoifetldfa ulnvo;() eerxociatfa elneolt0t2toxo ou1lptnlfct (  Dtm( p;o1oee ifcilsfaDeau o;() exoir tadfpte n s ( t2uriopiy1lpt lncsa( s2ua(mpno4tpeo oeiyd sDulumo;(4alenmo3oa1fp eln ol()sexr(opny4ol nmfei s artr(moot1ole  oeiys sDrm( p (0alenxr iy1lpD  u i ( teuo(m3oudlle lnvs (  2rr( pot4alxo oeiad m elnvo;u4alerxo iatlmt anvi;t0teurxmpoudopen nctl() ruaumpou0apx ifeiltfa um( p;u4trtoxo tytopD lieils)setmxopoydame miet tf 2rrxr ;o0tetn fcildfm2eaums t4texnmoctytoaDraieilt)teuo(r3iodapeemncta()sDumxr nu1opeoifetlt sDuln s t4artomfctatomD aues;t) 2tmiopoo1om emnvi t s2uaxrp;u1olt  ocildfa2uaumo u4 exnif tatoa  an s t0srtoxr3iy4ape mietlt) Dtmx  ;t1alenifeils aDumnvp;() leriocoy1oat livslt srtoxr3nu1opeelfcslsfarrmxrpoo0optn icilt m2emnms;u0tetoif3oo1fp eaueilt0texrir ou1ll nlnet s srua(ront4ape mi3iatfm2ulnvo;u0alenmr totomD lies ( s2um(r oydolee nvta(  Draumooo1oetoiocias sDua(msn(4aeenxrciatfpD lnvi;t0trxrir no1omte fcia(  rrrx pou4tltoiocild s2ea(vs u) exnmfcoytfatelu i;t) 2trxmpnudole lfvt s)srraum nu0apxo ieiytfmDeluvp t)tetrmf iy1fptean il(0setr(r3no1om nlfesa()aDrmxrpot1apeomieiytlsDelu p;u)alenxo ia1lm   uei;t0texmxrpno1lmt lici ()artrx pou1oltomietlsfm2ea(mo t4 lxnxf3iy1fp  au o (0srum(opiu1ap nlicsas)sDtaxmono1olxo feiltfmDemu o;t4 rtoxo oytlatr ueo t0 rxmxr3iy4lp nmivtls)sDraxm ;t4aeenmoeiltlaDem(vp t0tetnmrctadlmD luvol(0sexrxopnudlpenmiesl()srta(monu1oetnmo3ildlsDeluvs u0arenxf ta1lp raues;s trtmir3oo1lleemnet (f Drru oou1oeeoio3iyt s em( p u0 etomf oo1omtr ueolt0s2xrxo oo1om  mici s arua( oou0oee iocias sDran sn(0aetoxfctadfp   uei;t teuriopoo4llte fvs sf rtaum nu4oetn fciyd m um(vsnu0tltoxoctadfpD  nvo;s s2ur(r iydoptnmnvsat)sDua(ronu1tee mo3tyslmDea(mo;u0 etrxf3oa1fatelueo ()srtoxo3iodomtemnetas)arrr(r no1apx  f3tys a emn pn(0aexnmf3ty1omDeai i t0 2tm(opoy4op  mncias  Dumu o;t0oltnmi3tadfm uau o;(0 rtnxo ootopDr n s t seurimpoo1lltemfvt t s2tmxm nu1ole iieils m2rlnvo;(0alxomrcoadfm rai s;s)trumxr oudllt  ivt (f rtmx pno4apenmf3tlt sDrmumo;u0treoxr oadfmt  n ols)tetmxo3no4lptnlncsas)srtrumpnu4oltnmo3iasfm eanvo (0tlxrifctotfpDraueolt  2urxopoy4lp  licil(fsDtax ooo4apt mo3iadlmDrlnvon(4trxoio3oytlm   nvolt  2uo(o3ou4llenmivils) rrrx pnu4tlt mo3iyd a2umumonu)aeeomo totlm eaiei ( trtmxm3iy1om elfvsas aDta(rpou0oet  o3iydlsDrm( on()artnxf oatlpDeli o;t) ruoir iy1omtnmivia(fsrumuro;t4teto oeiadfmDelump u)teeoir3oo1lpD  uvs;t teto(opnu1alt mivsasf Dur( p;o0texn ieild aDumumo (0altnxo iydfpD an s;s s2umim3iodopte nci sf 2rm( pot0tltn iciaslaDemu pnt0aexnircoydfmDr uvi (0srumxo3oy4lltelieta() rtrx o;u4oexomfeiat sDrmnvs t4trtrmf3iytoaD liesl()t2toxrpnu1lpen netls)srrmxrpnt4opeoioctldfs ra( p;()texomocoa1lm ran il( s2ur(o3iy1oleemics (fa2trxmo;t4oeto oetadla2umnms ()aexnmfcto1lmDr nvo;()t2uo(m oydapt mivils) 2umxr ;o4teto fciys mDeanvo;t4 rxomfciytoatrli slt0 rum(o3no1aptelfeilt s2uax  ;t1ope iiciat mDelnmont)tetnxf3totlmDranei;s texoxrpiodame  ivi (fs2ururo;o1opxomfctys m emn o t4texoxr iotlptr ies t t2tmir3ny4amenmfvi t) Dtrumoou0aexnmfeils aDulums (0alerxo3to1fa eaivi;( teto(opno4ll  lfvslt)aDur(rpot1apeo i3ilsfmDeluvp;t0treoxo oo1fptrluvs s  rurxmpny1lle licsatfaruaum oo1oltoifeildfa2umn p u4aleoifcoy1fmDelues;t0seto(opio1amt micia()sDtru o;o4alx  ieilsls2rlnvpn(0arxnif iadomtelivols s2toirpoy4lpe  ncsas)arrr(r no4oexomiciadfm umuvp;(4 eenif3iodfpDraivi (0 rtrxopno4omenmnvt tfaruauro;t1teen i3iytlm rlnvpnu4aleomf iy1fat  n il(0 2urir3iy1al n ict sfsrtr(m ;t4tleo i3tadfa2ul(mp;()trerifcto1op  li slt) 2uo(rpiydapen fvsl(fsrrmxmo;t4teen fciytlmDrmu o;t4 leomo3ia1lmt  neolt teumxr nu1altn feils) rtr(m no4tee ifciytla2rl( p u0 reoxociydlp   ieo;s0sexriopiu4ll nmfcs s aDrm(  nu4tpxo ocils sDum(vp;t4 eerif3oa1latr u o;s0 rxoimpou1om  lfvta( srurxrpoo4oeen
\ No newline at end of file
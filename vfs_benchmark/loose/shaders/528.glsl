@@ -0,0 +1 @@
+nes;s) exmimpnodolee fctlsf rum(m ;u4oet iictydfa ua(vonu4texrmfciy1fmte ieols0 etoir3no1omte ictas srrauront0opeoiicildfs rl(mo;u4 reomf3oy1omDr n i;t0trxm(o3oudole mics s sDtaxm no1aptnmiciltlmDrlumsnu4texoxo oydfm r uei;t srxoir oodlltn ict t sDtr(rp;u0tlxniicildfsDua(vo;t0 eerxo3oo1lm r ueolt0 eumimpny4alte nesl()arua(mo;u1texnio3tys m eanvp;(0 exoxr tatfptelneilt0trtr(rpiydopt  ivtasfa2rr(rpou0tet ifetasfmDra(mp t)tleoir iotoate ies;() ruoxm io4ol e fvil()sDta(rp;o4aeen i3iyt aDrln p;t)tlxnmfciadfm ranvi s) 2trxopio1olee neias)a2trxrpou0aetoii3iatls2rmnvsn()texrmo ia1lptrli ils)sruoim3no1lpe  fvsas)a2rmxmp;u0aee mociasfs ua( o;t0 lxrmr iydfpt au il()setrio no4op n ieia(fa2umuro;o4oeenif3tyd mDua(vp;u4aeeomfciy1lpD  ueils  etr(m3iy1opeemnciltfs2taurpnt0olxoio3ilt s ul(vo;u4altoxr3oydfp raies;(  rurxo nu4ole miet s) 2ua(moou4aee  f3iytla umn pnu4trtrirctytop e ivs () 2xr(opio4lpenlfcs t) Dtaump;o0olx  ociytfa emnvo t0altoifcty1laDe i o;( s2uoxrpoudlmtemictls)aDurxm ;o1olenmictadlmDum( p;t) exrmocto1oaDrauei (0 rtr(opiudlm emnvtat  2trumoou4aeenmfciatlmDumuvs;u4alxnmrcto1optrlnei s0t2to(m3nu4apt lfcs ()s2tm(r ot1openif3iatla2rauvp ()altnxf3oy1omDeaivsl()tetmxo3oy4ale  ncils  Dtr(roou1tpxo i3tyslm2umu s;t0texoiociy1fpte nvs;s) 2toxopiy1ol nmnetas aDuau o;t4tptoifctlslm rmnvs () etrmf3tatlmte n o;() 2tr(r nu4ome lnci tf 2ra(rono4tle  ieiyd a2ra(vo;()aeerir3oo1fmteauvi;()t2umxr3iu1omtelivs tf rua(mpou1aetnio3ilsls rmnvo u0 exomo tadfm elu o;t seuo(rpiu1altelfvt t arurum nt0tpxn fetlsfmDrauvo (4alxoxo iatlmDraieo s0tetrxmpoy1lmeemfvi s sDtr( oot1tpe mi3iltfmDua( onu4tetrmr3to1fmDeau sl(0 rurxm3nodlm  lics t s2tm( p;u1tpxnmo3ildfa2raumonu0 eenmr iy1fpte uvsl()srxm(opoydame  fvs tfs2uax ooo0oltomi3iydls rmn pnu)trtrif ta1fmtelneo t0 eumir3oo4amenmiesltf ruaxm ;u4oetnmfetatfmDuluvo;(0arenmo iadop e nesls  rtmio3oo4lmte fesls a2trxrpnu1tet mf3iys sDemu p;(0teenmf to1omD au i s0sexr(mpoo1aptelivs t sDum(rpnu1aexn i3tlsls2ra(monu0 etnio iatlatelu i t) eurim3nydlleemiesls)srra( p;t1aexnmf3ildls ra( snu)arerxo iatfaD  n s;t  2urxo ou1lle licia( srtr(m ;t0oee  fcilt a2rl(mont4aetrifcoa1oaDeaieol(0s2umxr3oudop  mnetatfs2rmurono0optomo3tatfm2em( s;u4 etomf3oadom e i ils t2tr(m iydaleemnei () rta(r ;o1opx io3ild s elu pnu4aetrmr3tytoa  lueo ()t2to(opno1openmivt s)a2raxro;o4teenifeiasfsDuaump;t) ltrmrciotlp ran sls0srxoiopiy4aleelfctlt  2uax  ;o0tptoio3iys s elnvsnt)trxrxociatfptr u ol(0t2umxm iudomeelfvtasf rrau o;u1tpxoiiciydfs2ea( on(0trtrxfciytfat  i i;s trurxrpoy4opeemivsltf 2tr(rpoo0tlt ifcild a2rluvs ()tltrir3tydomDe ies t  euo(opou1om nmfetasf rtaxm nt4texomo3iysfmDul(mp t) exoif ia1oaDeaieo;s0srum(m io1openlivias s2uru o;t0opeo ictydfsDua(msnt)aeerxo3oatomDrlues;(0srumiopiy1olt  ieslsfs2rru p;t0oet  ociysls uanvs (0 etomrcoytfaD ln sl( t2tm(m3ny4lm  lfet ()srtr(mont4tee ii3iyt m2el(vp (4artnxf3iotlp elu i ( t2ur(o3oydome lici s) 2taurono4aptnmfeiydfsDrmnmon(4 rxrmf to1fateln ilt s2tmxr oy1lm n icsl()a2um(m ;o0tltnifeiyt m ul(monu4 eenif todom eanvilt truoxr iy1alen nesl( srurx o;u1tpe  fciltfm eau pnt)aetnmf3ta1fa rlnei;t0teurir3iu4ome  ics tfarrax  ot0alenmiciyt m2uau pnt4tltrxrcootoate uesls)trumio3iy4om  livias arum(roou0tlen octys aDrln o t4 lxrmf3iydomt au ols)setoxm3iodop n nes sf 2trxm ou4tle moeiad m2rm( p;() exnxocoy1oaD auvs;t)srxriopiu1ll  lietlsf Drmx  ;o1optn feiyslm eau s;t0 exoxfcoydfp e i s;() eurim3no1apen fcsas s2umu oot4tlt  i3tydfs em(vs;u0trtnxfciy1fpD aivils  etmxr nu1alt lnct ( s2rmu poo4aee  feias aDul(vp;t4tlxoxrciotfaD  nvolt s2tmir iu4lp  mnvsls) 2rm(r ot1tpe  iciasls elumo () rxoxo iytoat ai o;() etr(m3ou4lpe mictas s2rau  ;u1tetoif3ias m rmn o;() exrircoodla r ivi s texoxopoudlp   ivi tfa2taxmpnt4tetomfctydfm2uln p u0trxniociatfmt  nei;() 2urxo nydom   fetlsfaDtrxmpot0tex  oeiasfs rau snu4texnmf to1lm  an s s  etm(rpno1lm emfvtatfa2urum no0optnmocild a ra( o t)altrxrciydfpDrlueil()t2xr(m3io4apenmfcs s aDuaxmp;t0aetnmictlsfmDumnvs t0 rtnxo iodlmteanesls)tetmxr3io1omtnmict (fs2taump;t4teeoii3ilsla elu o t4tltrmo3oydfat  uvs;s0seuo(m3iodome  fet s s2tr(moot4tpenio3iytlm ul(vo;u0areniociodoptrln ols tetoim3iydoleelnvsatf Dtmx pou0tpt ifciydla ranms;(4texoircoy1op  livil( srum(rpno1opeemncs ( artmuro;t1aexnmicildlsDrl(vp u) exrxo oydfaD lnvo;s  exmxmpiy4lpenlnvtl() Dtr(  ;t4aexo i3tyt mDean s ()trerifctatfpDranei t srxoxmpiu1lp nmnvsas s2rr(  nt0alt mfciyd a2rmu on() rerxrctydoptr u olt)srxrxr3iudopt  ncs s)sDrmu poo1olx ioetasfm um(vp;u0 eeomo oatom rluvo;( s2uo(m3io4olen ietl(  2ra(mpnu1opeo ieiadla2ra(mont4arermrciodlatr n s;t)srumim3oodameelnvt ( sDuaumoou1opeo ietasls2rlump t4 exoir3ootla  lu s;s) 2xrxr nu1llte icia(fa2rrurpno1oleoii3iydfa rln s;t)areoif totlp  aues ()srto(o iy1al elici tf 2rmum nu1oet  i3ilsfm2rlu o ()teeoir3ty1lp eanvsl() rxo(m oo4opt mfvi t)aDuaurpno4alto feiadfa2rlnmo;t)tlxoxo3oytopDeai ols t2xo(o iy4amt lfvs s s2rrx o;o4alxo feiadla ranmsnu)tetnmo3iodfpDeauvsls) 2urxm3nodlme  neils srurxm nu1oexnmfciysfm um(vs (4tltoirctytfmteli o (0seuoxr iy4lm   nei ()sDrr(mpou4apxo f3ildfa2raump t)aexrxrctatfa ean sls)t2tmiopoydomee fctasfaDtrx o;u0opx ifeiytls2uluvsnt0 rtomf todomtrli i () ruoir3iy4ape  feia( sDtmxroou4tetoifctltfa rmnvsnu0tleomfcoatfp elueols  etoxr no1lpenmnvsl( artax poo1tleomociltfa2ul(monu4aexrir tadlmt aivo;t0 rumim nudllt lnetlt a2rmxrpot0tpe  oetltfa ean p u) lenio iotlateaues s0setr(mpoy4ol e feils s2rmxrpot0tptnmf3iyd aDrl(vs u)trenxf oo1optrlieils0trxmim3iu1ap  lnct (  Drmx pno0alenifciytlm rm(ms;()tlxnifcoydlp eau ils) rxo(opnu1omenlfvtl() 2urxm ;o1aexomfetysfsDrlnmo t0tltomociydopDr ueolt0sexoxo3io1lp elnei t) Dtaxro;o0tpt  fcilt aDulnvsn()arxnif3ty1om e neo () etrio3nu4amenlfcil()a2urxmo;o1oleniictys sDrl( o (4alxrxrciydfm eau sl( t2uoxm3oo1lm  mics (fa2rmxm ou4olt  o3iatfm2emuvpn(4artoifcoo1lm e u o;() 2trim ny1llte nvilsfsDraxrp;t1tlenmi3iytfmDem(mo;() rermo ootfatr nesl(0 rtr(o3ou4ll nlivi ( sDrmxro;t4aexoiicildlm eanvsnu4trtomfcootomD  nei (0sexrxm oodame  ivils)aDumxrpnu4optn iciytlm ul( p t0 renmf ia1fa ean o t0setm(opoy4al  licslt) Dtru  nu0ole mfetld m2em(vpn(0 ltrio io1lmD ln ols) exrimpny4optelncils arrrxrp;u4aeen iciyt mDem( o;(4teermo3oatfmDeau i;s  eur(o iudal  lfvt ( s2urumoot0aeenmicild aDeaums t0arxomf iytfmtrauvols) rxmimpio1ome  netasfarurxmo;t4alto fetatla rl(msn(0 rxrmf iatoateln s;( srxrxrpny4lm nlfcs ( a2ururpou4ape mociadfmDemnvpnt4tlxrifciotfatrli s;( sexm(opou1apeemicsl( srrmu  nu4teto i3iltfm2emu s;u4tltoio3iadopt lnvo (0trtm(m3oodamtemivtlt)a2uaxmpot1tpen ietlsfm emn p ()aetrxo ootfp   nvo ( s2urio oy4lp e ict sfs2tau pot1tlxnif3iysfsDea( s;u)tetoioctotlm  lnei s0 rur(opiu1lp emieiasfsDumur ;o4tleoio3iasfm rm(vonu0aexnxf iytoaDelivil(0 2to(mpnu1ape  nvtlt  rtru  ;u4tpeoioctysfs2ulu o t4tetoiocoadlmt aneo ( trxmir oy4altemfcslsfaDrrum ou0optoifetys a2emu pnu0 eerif totlat aivo;t0s2xrxopou1op emies tfaDtrxmono1aptomo3iadfmDuluvo t)aexnmrcoadfmD luvo s)teto(o iy1am emnetlsfsDrr( oou4ale  feiaslaDumnvsn(4trenmociotlm elies s  2toim3ny4llt  nvi sf rta(rpno0teto ieiytfa rmnms;() eeoircoatfa ran s (  2xoio no1ole miciasfartm(r ot1tetoiieiys mDem(ms;u0 lxnxo3tatomD aivo;s texr(mpiydlm nmfct t) ruaxrooo1tetomoetldfs umnmpnu)tlxriocia1la rluvo t)srtoxr iodape mnet s)a2rrurpnu0alxn fctas aDrmuvo (4texomfcoydom rauvi;s0truoxo3iydlptnlicils aDtmxmp;t1alt  fetasls2ulu s;()aeerif3oodlmD anei;() rxr(m3ou4aptelnctat)srtmu  ot4olxnifcilsfs uanmo (4altrif ta1laDelu ols) etrirpoo1opte nvi sfsrumx o;t1olen f3ilt a rmuvont)tltnmociy1fmD luvo;()s2xmxopoy4omte fvsltf Dtauro;t1olx  ieiytls2ua( o u)tlxnircio1fp rau sls t2uoxr3oo1llt lies ()s2rr(mp;t4olxo iciydlaDrmnvp (4 eeomocoa1omD luvs;t s2to(r3nodomt liesl()aDuaxront0tleoioeilsfm2uluvpn(4 renxrciy1la  lnes;t0 ruoirpnodal n fct t)artmx onu0oleo fctldlmDran snu0 rtrmo oo1omDeaues s s2xrim3ny1ol  liesa()arur( oou4opx ifetat sDean o;u4trxoifciadom  lnvo;( srurxmpiu4apenmivsl( s2urxmont4tetoio3iatfa uaumsn(4 etomo3ia1omDranvolt)trxrim3io4am elfvta() Drmur nt0ape  fciadfaDra(mo;t4 rxomrciytoptrlivs s)s2xo(r ou4omen nesa(fa2ra( p;u0teto f3tasla2rl( p t)artnmo io1la e neo s0 exo(m nodlmt livt sfs2tax  ;o4tetnmf3iasfm rlump;(4teenif oodom e ivi;t t2urio3io1olt mietat  2tau  no1tlenifetasfs rmnvo;u4alxnmf oytom r u s s)srxoio3no4oltemfet ()srur(m ;u0aleomoctytfm ulnmo;(4 rtnio3oytfa   ivo;()seto(r oy4apee nesas)arum(r nt4apxnmictys a2umu p t0tlxnif3tydfm  luvolt0t2trxo3oydom emfcsls  ruaumpnu4ape iociysfm2rln pn(4aeerif tadlmDelu olt0trxr(m3nu1optelnvslsfsDuaurpot0altomoeias a ran o t)altoxf3iatlaD anvs;( seuoxrpiu1amenmiesa(f 2rax ont4teen oeiysfaDulu p;t4 rtnxr3ta1fatrli s;t tetr(m oo1amte ietltfs2trxrooo0altniiciatls ea(mp;t)altnxf3iytoatr neil(  exr(o oodlle  nvi tfaDrm(  no4opt io3tysla ulumon(4 lenifctatfpt auvo (0 eum(r no1lm   feilsfaDtmx  ou1aet  i3tadlsDrluvont0 lenif3tadlat aies;s0sexm(o ou4amtnlfetas srtau oot0teenmoetatls2elnvp u) etnif ootfmD anvs;t s2xrir oo1omtnlnesl(fa2rr(mo;o4ole  o3iasfm rlu pnt)texnxo oydom eanvs t)trtmxm oydapt lfct t)arrrxmp;t1aeto o3tad a ul( pnt)areoxr3oy1omtrli ol()sexmxr nudal nlics t) 2umx pnu0tpt mieiysfm rm( s;(0 rtoxr tytfaDrlu o;t)srxrxr3oy1amt lnci (faDra(mp;t0opx ifciat m rlumont)aexomrcoodfm  lies;t0 2xr(m ou4apt  nctls)aDtax p;t0apxniictls m rau s u0tetrxrctadoa rli o s)trtmxm3nu4lm nlieils)sruau ono4tlt  ieiydfsDrmnvsnt0 eerircoodomtelnvi;(  etoxm3nodlp n iciat  Dtm(mp;o0teenii3tadla uau o;(4texnmo3totoptrlneo s)srurimpiy1llte iesas)a2uau p;u1tleo ieiasfmDumnmsnu)arxomrctodoa r n sl() 2umirpiu1oleeliei t  2trx pnt0alt  fciatfs umumonu4tlxnio tydlat auvs;(  2trxo iydamtnmnes () 2rr(r ;o0apxo oeildfaDulnmp u0 lermr todfa  anvils)s2tm(m iy1lp e netl(  2tmuronu0oltoioeias s2rauvs u0 ltoif tytlateanvo s trtrxr3iudlm  lfvilt aruaumont4oetoii3tltlaDuan p (0texoif iydoa rai olt srtm(opoodlle mneiat arua(rooo4oet  ietydla ua(mo (4 lxoircto1omte ues;t t2uo(opoy1apenmnesatf rtmu ono0oeeoiociatfa rmnvp;(4artoxf oydlpt auvo;()trxr(m3ou4lp n icsls  2tax  nt4oee  f3tyslsDua(msnu)trxnxr3iotfp   neo t0trurirpiu1amtnlnct t sDraxr ;u4ape  o3ildfa eaums;(0altrmoctydlmtrlnesl() 2umir3ou1op elnci ( aDuru p;u0apxn o3tatls rmu s;t) rtrmf oadoa   ueols teurxmpiu4altemieils s2raxrpnu1apeomicild m2em(mp;u)alxoxf3iotfat  ues;t0 rtoxm iudlpee ict t  rumumooo1tpeoifciadfsDrmu p;()treoir ia1fmD  u o;(  2uoxo ou1al n nvsl()srurxro;t0apeo ociaslsDeauvon() eeoif tadfp rlnvol(0t2tm(o3iu1opt mfvtas)sDta(mono0aleomietadfm2rm(vo;(0 reoifcia1fpt  i i;t teumirpiydolt mietatfaDum( oou0oet  f3taslm2uau s t)tltnmo3oatomDrau i;()t2uoim oo1ol nlicslsf rra(  ;u4tpt moeiytlm rluvsnu4areoio3iotomt luvi;(  exmim3oy1al  mfeils arrmx p;u4aeenmo3tytlm em(mpnt)artrmr3ty1lpDrlivs t trurir3ny1ap n ietltfaDtmuroou1tlx moeiasfs2ranms t)tetomr3iadlaDelueol(  exrxrpnu4amee ncsa()srrrum no0optn feiyd a uluvo;u)tlxoxf ootomD livsls0 exmxopio1olte fvia() Dumumonu1aptnmoeiatlm eanvp t4aetnxo oatfa elieslt  exm(o3nydop nmnvs s  rta( oot0oetnifctldlaDrmu s t)teenmo iadfp  luesls) 2xoxopiydop e ietas arurum nu4aexnioeiyd a ua( p;t4altrxo3totfpDrlueslt  etr(opno4lpen fcs sfa2umu oou1oexnmiciysfmDeauvs (4aeenxr3totopDeliei;s0s2tmim oudop nlnetlt  Durxmo;o4tptn ieiadfsDranmo;u4arerif3iydlpte u s;t) euoxrpoy1op elictasfs2tm( pnu4ale iicils s uau o;t0 rxrxo io1la   ueslt)trxmxm oodlpt mnvilt)srrr( poo0opxoii3ildlsDrau snu0tlxrmfcoatomDe n s;() 2xrxopnu4omenmfvilt  Dtmum ou0aeeo ociysfaDranvsn(4arenmr iydoa rauesl( t2urir ny1ll e feiatfs2rrx  ;u0oetnmfciltla2ra(mo;t4tltnmf oa1op e nvi t0 etrio3nodop  mivta(f rur(mont0tpx mi3tydla2emnmo u0 reoir totlmDrli s (0t2urxo iy4apeemfeia( aDra(moot4aexnmo3iatfs2rlnvsnt)tetrio3oatoaDr ies;(  2umxm nydal e fetl( srtm( ono0teeoiieiltls eau s ()tltoif3oydlate u i;s  rtr(r3oy1om n ivsltf rrrx pno1alt  i3tltls rluvont)aetnmo io1fatelivols)s2xo(o3oudol n ncsa() Drm(mo;o0aetnmociltfaDrmn ont4texrmf3oodlp elneo t)s2tmxo iu4llen fvsltfsrtrxrp;t4tle  f3iad m umnvon(0treoxf oodlmD aivo;t) exo(r oo4op  mnesl() Dtr(mpoo1tlx if3iatfs2rlu o;t)aeeoirciydoatelu olt t2toiopny1optnmncta() rtm(  ;t4tetn iciydla el(vs (4tetnmo oatfp  lu o (  etm(rpiudlmt  ieilt aDrmxrpot4olxn o3ias a2em( pnt0altnio iy1optraneslt0 exoxrpoydamt miesl(fs2rmx  ot1apeniictysla2ulu p;u0aexnxf oydopDrli sl(0s2xoxm3io1al   ivt sfa2raumo;t4apt moctatls emums t4artoio oodfaDe uvs t0seurxr oudlmeelnetlsf ruax p;u4tpt mi3ilsls ua(vo (4trerio oatfa  aiei t s2xmio3ny4ap elictas  Dumxr oo0aptoii3tadls ran snt)arerxr oydfa   i ols s2xo(m nu1amenlnctls aDraumoot0tpx  o3iasfs uanvs (0tlerxo3oy1fatrln sl() rtmiopnydlpt lics t)a2tmu oou4tee mf3tad s uln p u)trxrmo oo1fm rlnes;s)s2xo(opnu1lp   icta()srrrxmpou0olxnmieiytfs em( o;t4areomf3totla ran ols srxoir no1ale  ieiatfsDrmx pno4opxoioetyd s rl(mp (4aeeriocoydlpDe ivil() 2urxm nodomt mfctl( srumxmoou4alt io3ilsfm rln o t4 etoio oatfmt anvs s) etoio3nydomt  ivta(  2rm(rp;o1tpxnif3tas sDuanmpnu) reomo3iy1oaDelu sls srtr(r oydamtnmicta() 2uru p;t0alto oeiatlm2emums u)artoxfcoo1fateln o t) exrxm iu1omtemnvilt  2umxmpnt0tet moetasfm umn on() ltrxocoo1fm   neslt)s2ur(r iy1oltemnvs s  Duaxr ou4ope  ociatla2umnmo (0 exrio oatoa rlu o s0 rumimpiu4alt  ici t arumx  ot1tltnifetldlm2el(mo;t4treoxo iotom rlieol(0t2xoxr iy1omee nvilsfaDtm(m oo0alen i3iltfsDem(mo u0trxnmfciotfat  u i s0 2urim oydllt mnesa(fsDrrxmpoo0texn f3iysfm rlnms t) rtnxoctatom rln ols s2uoxrpno4ap  mfcsl(fsDur(mp;t1oleomociat a uauvont0 eenmrcta1la eanvs;s)s2xoxo oy4ap nlfci s)aDtrum nt4ope iiciadls2ua(mont4alxniocio1faD aivs;t0tetoio no1lpenlivsltfa2um(r ou4aptomo3iasfmDrlnvsnu)artoif3iotlmDrlieols truoxm ou4ame  netl(f ruru p;u4teto icilsfs2el(mpn(0 rxrxf oodfmt  i o;s  rto(m3nydlpenlfetas) 2rr(rp;u0olto fcias m elu p;t0tlxnxr3oadfpDrau i t  exmxopiydlp   iei t aDurxmo;u4openmf3iyt aDran s;t4areoio iatomDrlu i s s2umirpou1altnliciat arururo;t1opxn oetydlmDeln pnu)aexrmf3iotfp  ai olt)seto(o3nodamenmfvs s srrm(r ot1aexomf3tadlm rl( p u0 rtnio totfpDeaneol() rumxr nu1ap nlivs t)s2ta(m ;u0aexnmfeiysfs2em(vs;() exrmf oa1oat auesls0t2tmirpnu4ale mivt ()s2taumpnt1aex ii3iys a ra(vo;t4tetnxrciatoa r uei;t0 rxrxmpoudolt mivs t) 2ua(  nt0alx  iciys a elnvo;u0tlxoio3tatlp eluvils0s2xr(o3iy1ol   fvtlsfs2uru  ;o4apxomo3iltfm elu o u4tetoio3todomt aueo;t)texm(r nodlpt miesls) 2tau onu1teeo fciytfm rmuvsnu4 leoxr tatlmDr nvs;(0sexmio3ou1lpen fvta(  Dtax o;u4tex  iciasfs ul(mp;t4 lxrmfcoatomD au o t trxoxm ou1op n ietl() Dtmum ou4tpeomo3iys sDumn s;t) renmrctatomt ln s;( sexo(mpnudlm n fvs () rra(mp;t1olenii3tytls rmnmpn(0 ltoio iotlmtranei;() 2xoxo io1altemncs s) 2uaxr nt4apxniicild m2ua(vp;u)aleoxo3oo1op  ln slt s2xr(rpoy4lpee nviatfs2umxm nt4apxomf3ilsfaDelnvp (0tlxnmociatlmt anvsls)texmxrpiudalenmieiltfarrmu pno4tlxn f3tld sDra(vo u)aeerirciatoptrlu i t0s2xrir3ou4ll n nvta()srtmx pnt4opxnifeiysfm ra(vo u4tlerxrcio1fmD  uvs;()t2uoxm3oo1lpt  nes sfsrum(rpnt4aexomfeiltfs ran p;t4alxrioctytfaD  nvilt) rtr(rpoo1lm nlncia( arumxrpnt1aexnii3tld a2elnvon()artnmf totop  auvi;s setm(o3iodol n ivias aDururoot0apenmfcias aDum( p (0alxnmfciotoatrai o ()srtmxopnodlmt mncsat)s2tm(m oo4aee ifciytlm2eluvo (0arenxocoytfm   n s;t)srxmxm oy1omtn ncslsfs2tmxr nu1aeto fetaslaDrmuvs t4texoxo3totlaD lueols0teuo(mpiu1ll  liesat)arrr(m nt4olto oeiysls ulnvsnu) exoircoy1lmt aneil(0srtm(o oy1ol e fci t)a2ra(rpou4oexnmf3iadfsDelump t) lxrmrcootomt au i s  rxoir ou4lptelivtlsfarta(moot4alt  fciatla2ua(mp;t0 lenmrctadopte i o;t)teto(r3iy1lm   fcias) 2rr(ro;t4aleoiieias a2emu pn(0artnir3tadopteln ols)teumirpiy1lpenlnes tf rtax ooo0oee moeilt sDel(ms;t)alxnxf3oatlateai s s0trtr(o nu4opt mfvilt  2um(m ;t0aet  o3tad s ua( s t)tlerxrcoadomtrauvo t)t2xmim oodop  mnei t)srtrurooo0tpxn fcils aDulums;u0tleomr tydfmt  ivi s)sexrxo oy4altnliei s sDrauront0tptn ietys s2ulnvs t4tleoio ty1opt  n olt0 2umio3io4ome lnctlt)aDtmurooo1oexo o3ild sDrmnvsnt)trxoir iodfmt anes ( s2to(mpiu4aleemnesa(fsDtmumo;u4aleoii3iltls2rmnvpn(0 etrmo to1oa  lieolt0setr(m3nodol  lfctl()srrrxmpno1alxnifciadlm eau pn()aeerifcoodlaDrlu ilt)srtoxo3iudam emfctas)arrr(rpou0opt  octltfa2rmumo t4trxomf oy1omt  u i s  exr(o ou1apen icslt)aDum(mont4oeenii3iadlm eanmpnu0altrmfctydomt anvils)s2to(mpoo1lpt lfesatfartrumooo1aetn ictydfs2el( o u4 eeoxo oodop r n sls  rxm(m nydapenlfesl(faDum( pou1texn f3iytfm2uluvo (0aeeomo3ia1fmDraneo ( s2xoxopnodale  ivs (faDua(mpoo0opxnmfetlt m ra(ms u0aexrirctodfate ieils srurio3ny4amtelfcsatf 2ra(m ;u4texoiieiltfa ranms t0trxoxrcoy1oaDrlu slt  rtoxopnu1omtelicsas  Dtrxm ;u4aexo fciatlsDranmpn()aexnifciytop elu o (0srurio iy1lptn fcias  2tm(r no1tpeomf3ias m2rm(vp;(0teeoxo3oydopteli i t)trumio3iy1altemfvilt  2urxmo;u1altnii3iadfs ua(mpn(4trtoxr3oadfpDe ivsl(0 rtrimpiu4lmeemnvs tf rururp;t1oeeoifcils s ul(vpnu4 reoio3totlm elneo;s) eto(r iu1lpeelfcsat)s2raxronu1aet mo3tld aDuan o;(0arermocoy1op e ivo;s) rxmirpio1lptnmnvils)aDtax  ot4teenmi3iysfs emnmo;t) ltnifctytlate ies s teumir3nu1am nlfcilsfa2taxrp;o0aptnmfetadla2uanvpnt0tltoifcia1fpDran s s0setoxo3oo1altnmnvils)aDra(m ou1olt  ociasfm ea(ms (4tltnif3iodoa  li i;s0sexm(rpny1oltn feils  Dtm(roou4tpxomfeilsls2emn o;(0tltoioctytfm eai i s sexrio oydomtelieslt)a2uau onu1alt  feiasfmDelnvo;(0 lxrmo iy1om  li ils)t2uoio3nudaptnmivs s)aDrmu p;u4opxo feiasfs2umumo;t4 eerxrciodfmD auvo t) rum(m ny4op e icia()arururono1aptoio3tytla ul(vpnt0tlxrmo to1fpteluesls0trtrir oodolenlivsl()srrax  nu4oeto fctltfm ua(vs;u4trtnmfcoa1opteauvol()srurir3io4omeemivia(fsrtaxroou4teeomi3ias mDranvs u0 exrxfcoadoptr n s s0seurxm nu4altnmfes (  rtrx p;o0tleomf3iys aDumums (4 rxoxociydomD liei () 2urio3oudoptemnesl(fsrtrxmont0teen oeiydfmDemnms;()trtrif oytoatrlu sls  2uoiopoy4omtnmnvia( aDtmx onu1tlto ieias s rm(ms;(4aeenioctodfpt  nvsls)sruoxrpiodlle  ncias sDrmxrp;o1opxoio3iat m el(mp;u4 reniocootfmD an sl(0 rur(m3ny1altn ieslsfartau p;t0oeenifeiyt mDuanvs;u0tlxnio3to1fa ranvolt)t2to(opnodlm n neils aDtr( ooo4alenmi3iyt m2rl( p;u0arenxrcoa1laDeauei (0srtoiopiu4al nmivtl(fa2umx pou1oexo f3iydfa2uanvo u)arxoxo oydfat  i i;t) rxoim iy1lpenlfeslt) Dra(moou0aexn ociadlsDeln sn(0 etnmr3iadfpt luvol(0 rxo(mpiy1llen nvsas s2rm(rpot4aeenmoetysla2uauvp;t4 renif iydoa rlu i s srtrxr oy4ape lfetlt  Dtrxrooo1tpxnmfcildfm2emn p;(0 rxomr3ty1la  lu i s srxrir oydlm nmnvia( aDta(root1opt io3ilsls ulumo;(0areoio oydopDeli s s0texm(r3io1lpenmfes t) Drrx  nu0oeenifciys m2rl(mo;(4trermocto1fp e u ol(  rto(r3iu1omtn fesl( a2rrxmont0tpx ioeiaslm rm( s;u4 exrif totlpD anvs;s0 rurio oydlpenmfcia(f rtau oou0tpt  iciydfsDuanmsnu0aexnxr todlat livi;(0 2xrxopny1apeemiesas  ruaum oo1tet mf3tlsfmDumnvs (4teenmo iotoaD  nvs;() 2urxrpny1lmeemivslsfa2ur(m nt1tlenif3ildls2umuvsnu0teermrcta1fa e ieolt teurxo3nu1lpt  fvi t)sDtrxr ;u1tptnifctltls2ea(mp;(0arenircoa1lpDelivo;(0tetmxo3oudopeemnvt s) Dta(mpnt0apt if3iydlsDua(vonu4tlxomrciodfptrlu s ( trum(opoy4lmeemietltfaDtmxm ot0tex  fctytfa uau s u4trtoxrcto1fatean s t srxriopnu4lme mfvtlt  Dur(rp;u0tlx  o3iltlm em(ms (4 lxrxf iydlmDraneols s2xoxo iu1am   nes s) Drau  nu4apx mictlsfs2umn p t0aeenxo io1lpD aiei;()t2xoim iy1lpee ics (  2umu  nu4oet if3tys m rlnmpnt4trxrmr todfatr i slt)trur(m nydoltelivi s)s2umurono4tpenmfciltfm umuvp;t4 rtomociytlmDeluvol()t2umio3iy1lmtelfvs t)a2rr(moou0tptomfeiydfsDelnvp;t0texrmf totlptelivi t0 exoxm3ny4lm emietas)sDraxrooo0aetnifeiys s ea( sn()alenir3todlaDeau o;t  rtrxm oo1apenlies sfa2um(mpot0alxn i3iysfs2ul(von()tetriocoadop   n i;s)t2xo(m3nu4lleeliesat srtr(m ;t4apx  o3tlt m2rm(msnt4 rerio3iydlpteauvs;s srxriopio1lmenmiet s)s2rm( poo1aetn fctasfm2emnmsn(4 rtnmf3iytfa  ai i;t0trxriopny1omee fvsasfartrxrpot1oleo f3tyd aDrmn pn()aexnmf3tatfpte neols trum(opiudaleemncslt) rtaurp;u4openio3iat s ranvp;(4treoifciotlat  nei s  2to(opno4lmtelict t) 2umu  ot1tltn oeias m2ua( ont4 rtnioctadop rluvo;(0seto(r3no4oltnliesat srurxr ou1opx  oetlt s emumsn(4 ltrxfctotlpte ues t0srtrio3oy4llenmnciasfs2uaurp;t0apt  icilslmDel(vs;t4texrxr3tatlm  aies t s2xo(opio4om nmiciat  rtr(rpnu1tpe  ictlslmDrl( s u) reomrctydlmteanvi s  eumiopiodaltn neilsfsDrrx  oo1aptomieiyd m2ul( pn()aeeriociy1faDeauei t srtmxo3oo4lleelfvs tf Duaump;u0tptnifetyslm ul(vo (0 ltnxrciadfa e ieols  etm(r nu4ol nmiei tf rurxmpot0aptoioetas sDua(mo t0arerio oydomtraivi;t)seuoio3nodlmenm
\ No newline at end of file
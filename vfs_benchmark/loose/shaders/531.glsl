@@ -0,0 +1 @@
+nei ()s2toiopou4ope mfcsas) rtr( pou0alen icils a em(mp;(4teenmr iydfpDrli ols s2urir oodomeemnesat)srtmu pot1oeenmiciys s2eaumpn(4 eeomo tytlmtelueo;t  exmir iu4om elfei sfaDuaur no0oeeoiieilsfs ua(mpnt4tetoir oy1opDrau slt  2uoxo oo1altnlfeta() Dtax  oo4texo ietyd s2rauvont4tlxrir3tytfptrluvsls0t2to(m io4lpenmfcils)a2uaxmp;u0aexomf3tltfs eluvont4 etnir3ia1lpt  u s;t) 2xmir oydap nlivtatfa2um(rooo1ape mocilt s2rl( o;u)texnxf oadom rli ils  rxrio3iodapenlfvs sfsrua(  nt0oexomf3iyd a2ranvo u)tltnmf iotfatrlnvi ()t2uo(rpiydlltelics ()s2ra(  ;t4optn ociyslaDumnms t0trenmr3totlmDe u o (0 rtmxr oo1ole lnvslsfs2tru pou0oexo octytlm emn s;t4 exnmr3ty1faDelivo () rxrxo3oudamtnlfciatfsDtrx ooo0apt iietaslm eau sn(0 ltnxr tytfm   n i t)trto(m3io4amtnmfctasf rrrxr ;t1ole mfeiydla rl(mpnu0alxoif ta1fmDr neo;t t2umim nodalenmivil(  Dumx pot1opx if3iadfa rlump t0arxomrciy1oa r i s;()trurxmpoodlptelfesat)sDtmurp;u4tetn ociydlm2uau snt4altomr iatomDe i o t) rtmir oudlme lfeta(fsDum( ooo0aleo fctadfaDel(vo;u0 rerxo3iotlm r ueo () etrir3oy1lmeelivtat srumu  ou0open i3iydlm ul(vo t4aexoir3to1oaDr n sls s2toir3ny4lm elnviasfa2rr(r ;o0tlxnmictltfm2em(mo;(0tlenmr oydlp ran ils)sruoxm3oodlmen fvi t  rta(mo;t4tlx moeils mDel(mo u4aeeoxrciotfmDeauvs t)s2xmim3oudlmtemnvta(farua(m ;o0oetn octat m2rluvs;t) ltnio3iydla e nesl(0sexm(r oy1olt lncs t)aDtrxm ;t4openmfeilsfsDrlnmp;()trtrio3oo1fa rluvols0 rurxm3ny4llenmfct (fa2rmx pnu0tltnii3tlslaDum( pnt)trenxfctytomD  n i (0 exriopnu1llenlfvsl()s2tr(mont0teeoifetlt m2umums;t)arxnxr3iatfm r iei;s0 2toirpnu1lltelfcilt aDtmumpot0tet  f3tydlaDrlumon(4trtoif iytoaD li o;t seuoir3oo1om nmnvsat)arrr(r ot0tlxnmfcildfmDrm(mpnt4trtomfciatlm eluvs;s srum(m oy1apenlfci ( sDuaxmpot1tlxn iciasfs2ua( on()tleoxr3oo1oatr i sls s2xrxm3iy4opt livtat s2tmxmpoo4apxnmf3iat mDuauvs (0 etoxf3ty1laDeaueo t0 eurxmpiy1lmtnmfct (fsrum(r ot1tee if3ilslm emums t)trxomr iotlp   uei ( t2trirpnu4ol nmfctl(fs2umxmo;o4alt  fciytls2uauvp t0 eerxoctotfat  n i;t  rtoimpoodom e fcsat  Drrurooo1aexomociyd mDemnvp;(0 eeoioctydlatelneo (0srurimpio4llenmfei s)srtm(rpno1ole iiciys aDrlumo (4trxrxr io1lp rlivil(0 2trxm3ou1omtn ncta()a2ra(r ;o0tleo f3iatlsDeluvont0treoif3todfa r ieo;() 2xrim3iodalte ivsl( srtmxmoou1olt  f3iat m2uanvp u)trxriocoadlatrlneolt  etr(rpio1lme  fvslt a2tauro;o0tle  ictydfmDemnvp t4 lenmf iy1fptraivo ()s2xmimpno4apeemfcia(f 2uaxrp;t1opxn oetlsfa rl( s;() lxnio3ty1fp   u s ( teum(m no1oltemnvtlt)sDurx  ;t1oeeo f3tls s2uln s u4areoxr3oa1fatraueil(0t2umxr iu4lpte ietas aDtr(r nt0opxnmictldlm2uau s;()tltnio tadfptrlu slt0s2uoim3io4lltelfvslt arrau oou4alxomoetls s uanvsnu0altoir oa1oaDran s t  2urxrpnu4lp   fesatfartmxr nt0openmoeiys s eanmp;u0 rtrxr iydlpt lieo;()srxrimpiodamt mnciltfa2ua(mp;u1oetn o3ilsfm2emu p;u4 rtrif3oy1lpD  uvs (  2toir oy1altn ictl(fsrumx p;t1ape  oeiadfsDua(vp t)arxomrcta1fp elies;( texo(r3iudalt  ietlsfsrraumo;o1alt iieiyd aDua(vs t) lxoxrciytoaDe n s (0setrxm3no4ll   fcta(faruaumo;o1altn fetyslsDem( s;u0 rxoir3iy1lm rlu i;()t2xmxo iodomee icils)s2tm(ro;u1tpenmoctatfm2rluvs;(4alxrir oy1fpDrauesl( texrim3oo4ape lfct t) Dum(r ot1aex mfetyt aDua( pnt) rtnxo3iy1fa e ivs;s) eto(o oo4ape  ivtls)a2tr(rpot0oetomfcilt m2ra(vs t0tlenxoctydfatrlu s s0s2tr(r io1lpeeliet (fsrtmumono0aeeomo3tat m ulnmo;t4arxrmfcto1la  lneilt srtr(m3oo1amte nes s  rum(m oo4tpxo fcild m umu s;u4trenxo3iodfpte nes ()t2tmxopiudllenmiei ( s2raxrpou0tpe iiciytfa em( onu4trtrmo3oatop   ieo;s0 2xrxmpiudomt lieta() 2rauroou4aet io3iydfa2ranvp (4tlenxr oodfmtrau i t)sruoxo3oo4opte fvi (fs2rrur ou1apxomocild m elnmont4arxrmr3oadfmt livi;s)s2xr(rpnu1ol  livsat  2tmurpoo0alxniieild a2eaums u4arenif3tydfa r uvo t0 rtoimpnydam nliciatfsDumu p;u4aleo ociltfs ul( o u4tetoifctytfp rauvi;s) rtrio iydopen nci tfs2urxrpoo1oeenmieiyt sDrm(mo;t)aetrifcoytlpDeluvo;()teuo(o3iodomenmfeia()sDrrur ot1olt  ieilslmDem(vpnt0trxnxo3to1oa rln sls t2umim3oy4amtn fvtls  Dtrxro;t4tltoioctysfsDrmuvp;(4tetnmr ootomt  i sls srumxm3nydll e ietl()s2urx pno4ape ioeiyslm el( onu4alenxrcoadlpt  u s;() rtm(m3nudameemfeia(fs2ur(  ot0opx mfctldfa2uaumpnt0trenmr3oo1lmtean i (0 2xrxm3ny4lp emfvia(f 2uru  ;u1apenifciasfa rlu s;(0teenmfciotop elueol()texmir3io1op emietl(  Drmurp;o1tlxn ieiysfaDemn o;()teeoxr ia1fatran o;s  ruoim3ny4ol   fvt ( aDur(ront0tleoifetydlsDem(mp;()aexrmr3tatlmD aivo s0srumxopnodlp emiciasfsrtmuro;o0tlxomfciat m uaump;t)trxomf oo1lpDrai olt  2to(opou4lpt  nvslsfarua(  no0alxoiieiydfs2rmuvo u0 exrxo3ta1lptr uei;s t2tm(m oydlm e feiasfsrtr(mont1alxnmoeiltfm2emnvonu4alenxf iodomtrluei s) 2xmim oydlpt lnetls)aDtrur nt1olxn i3tyslm umumonu4 rtrmr3io1op r ivslt  etmim3ou1lmeemfcsl(  rrrur ou0aexnii3tat s2rl( s;u)trxrxo3io1lp  ln s t0texmimpno4lptelfeiasfaDtm( pot0aleoifeiltfmDrmumont)teerir3todfmD ai s t0trtoxr nydop  livsa( sDumu  no4apenioetldlmDumn o;t)alerxr3tadfm  auvolt seum(mpou1llt mnvt t  Drrxr ;u1tlx  icild aDrm(mp;(0aeermf tytom e u s;s)trto(m3oo1lmtelfvs ( artrxmo;t4ole ifetatfm ua(mo;(0 rtrmfcoy1fpt li i t)t2to(r oudlptemfes ()aDrrxr ;o0oet miciad a uluvo t4tetrifctytopDe ieo s)texm(o oy4oleelnctas  Dtax pnt0tpxnifeilt m2emnms;(0trxnifctydfpD  iei t0srur(r oodlpeeliesl( aDuaxmpnt0olxn o3iysls rmu onu)aeeoif totlmDrau olt teuoiopou4ape mfes t arrrumont4tpeoif3tysfaDemnvpn() etnir iytoa elneols0t2tr(opno1ll n iei t)aDurxrpnu4teeoioeiysls2emnvsnt) exomf tatla rluei;t0s2xrirpnydolenlnvilt srrrx o;o4oex  f3ilt sDemn pn()tlerif3ty1la  lu s;()tetmxo nu4op   nvtlt  ruau onu0oetoio3iatfm2el( pn(4 ltnxr3totoat  nes;s)texo(rpoo1ap elneia( aDrru oot1aeen ocils m2emnvo;(4 exomr3to1fptean o;t0t2urio nodlme  ics ( sDuax oou4aexnmi3iyt a em(mp;t)arxnmo3oytfp rln s (  2xo(r ny1om  mfvsa()sDumumpnt4alx  i3ils sDra(mont) rtnmf3oytfm rai s;t truoir3iy1altnmies () Drrxrpoo4oee mfetytlaDemn s ()arxoxocoodoatran o ()teum(o nu1lmtemnei sf rtmxm nt1tet mieild a emu pn(0teenifcio1optelnvslt texmxopoy1ameemictat sDtr( ont0tex mociad m2umumo ()tetrif oydlptr ies t)t2toxopoydom nmiciasfs2tmxroot4ape mf3iys s emnvsnu) rxoxfcoy1fateauvs t0trtmio ny4ol nlfvt sf 2ua(  ;u4aet  f3iad mDemnvpn()trxrmr3iadoptelies;s  rtm(m iu1amt mfetas  Duax pot0tpe iieiatlaDumumsnu)tetoxr3io1fmteluesl(0 2trxmpiu1opee feslt)a2ra(mpnu4opeo o3tls m2uau o;u4artnmr3oadfpt  nvilt0s2tr(m oydolenmneiat)a2umurpou1alt mieildfa ul(vp;(4aexrxocoodomt anesls texr(o3no1om nmfci sf 2ur( p;o4texnifetydls eluvpnt) leoxocia1fpDe uvo ( tetoxopoydam e ieta(f Duru  no1alxoio3iatls emnvpnt4alxomo iytlmDeau s;t0s2xoxr3iy1ll   fciasf ruaxr nt0oexomiciyd s umums;t)texnmf3iatfmD anvsl()t2xm(r3nodolen fcs ()srtaxr ;u0altnmietlsls ran snt) eerxfctadoaDr uvilt)setoxo oy4al elfct s aDtaxr ;u1texnmfcild a2rlu o t)trermf3todfa eln i s  eurim3oo1ole  fcilt)s2tmxr nt1tpxoii3tysfs ra(msnt4texrmrctytfpDr ueols) etmim3ou4lme lfct s)a2rm(mpot4oexomictatfm elnvo u4 lermr oy1faDranvolt) 2ur(o3ou4om elnvs t s2uaur nu4apx  fciys a elu snu)aeeoio3tydlatean sl()trtm(m io4lptnlnvt ()srua(moot4teeoii3iydfa2eanmo u4texomf io1oa rln i t) 2ur(o no1ape  fvtasfs2ur(monu4alxoifctlslsDuluvp u4trenmo3tatfpD an o;(  2trxmpoy1am nmnes (  rumu  ;o4opx mi3iyslm ul(vs ()tetnxr iotfp   u slt0 2tmim3nu1lltemivs s aDrrur ;u0apx  feildlaDel( o;t0alerio3tatlpD livo ()t2xrim3oy4lptn fvsa(fartru pnu4teeo feiydfa ran ont4 lerircoy1lpD  nes;s0sexm(rpio1lm elnctlt) rra(rp;u4tee  icilsfmDrmuvp u4arxomrcoa1oatelies s) 2umxr3nydlpenlfet t sDtrxmpnu1tpxn fetlsfs emuvsn(4 exrio ty1fm  au olt texr(m3iy4optemfcsas)aDua(m ot0oltoioetadfa uan on(0arenif ootlp e iei ()s2tmimpoodamt lfeiat)a2raxro;o1aeeniociydla elnmo;(0tleomo3oatop  aivi;()s2urim3ou1apeelfetl()sDumxr oo0tetoioeiad s rln o;()aexomr3oadopDrlueils  rtoim oydlpe  ncsls) 2urxrp;t1opt  feiyd sDulumo;u)tlxnmfcoy1fat aivils)srurio3ou1lm   fct s  Dtrxmo;o1aex ifeils a rlnms;t4 rxoifcoy1lpteln olt)s2xmxrpoodllenmfcs sfa2tr(ro;t1tpxo o3iatfs2uluvp t) rxoifciadlp  lneo t0 euo(m3ou4alenlncs (fsrtrxrpot1ale  o3iyslm2umump t4aeeoxfcto1optrau i (0s2xriopiu4op n ivt s)arumxmoou0aptnii3tltfm ulnvpn(0aexomf tydla raneslt texmimpio4omt mfet s aDrm(mp;u4opxn oeildfa emu pnt4artnxf oatoaDr n i s) 2umir3nu1ol  mnvtas arraxroot0opxnmoetaslaDumn s;(0aeenif ty1lm e nvsl(0setoio ny4lptnmivil( sDur(  nu1oexomfetlt sDemu s u) ltrxfcto1fpD au sl()sexrir3iy1lpen fvs sf rrr( pnt1tpxo o3tlslmDua(vp u4texomo3todlat  u i;(0srtoxr iydomeelfvia()arurx p;u4aptomictadlsDumu p (4trermfcto1op   u i;s) 2xrxmpiydapen fct t aDururpnt0opeoiietlslmDelnms u)aeenxo3totlm  luvs s)trtoxo3nudop n ici t srrrxro;t4aet ifetatfaDrauvs t0alenmf3tatfmDelieo;t tetriopiy1oltemncs sfs2uaxmono0apenmfeiatfa elnms;t4 exnir tatfa elivils0srxoxo no1aptemncslsfsruaumooo4tpxo ieildla em(monu0arxnmr3ootlp rluvs;(  2xoir oydole mfvilsfaDumu pou0tle moetldls2rmu o (0tetnxf3iy1lateli i t seum(o3io1oltnmfeilt  rtr(  ;o4aexniictld mDeluvpnt) eerir to1opD auvil(0 exm(o oo1am n ivt t)artr(mpot0tet mietldla umnmpn(0texnir3oodlaDran olt0srxm(opio1altnmnvils arrmxmoot4ole mfciasfaDumump;(0 rxnio iadfp elivils)t2tm(r3oydoptn fcsl()a2trx  nu0aeeomieiysfa2rauvs (4trtrif iotopDeaneo s0tetm(rpiudopeemictas aDtr(mpou4aet if3tat s2el( s t4artomr3iatlpDeau o;() etoir3io1lp e feils) rtmu  ;t4alt ifctydfs2eaums u0teerircootfmDrluvs;t0s2tm(o oo1optnlnes (f Dum(rpou0oex mfetysla uluvs t0aexnxf3iytfpDe ueo s)trtmir oydlmtn fvsls sDur(rp;t4ope if3tlt s2el(vs t4tlenxr3io1om elivi;s setoimpou1lm nliesas)a2ur(mooo0tlt iiciadfm emn pn(0aeenmoctytop e nvi (0 2uoim nu4amt lfcta(farrau pnt0tpt if3tltfm2ra(msnt4trtoirciatfm r nvo;s0srxm(m oy4apen ivi t a2taumo;o0aexniieiasls eln o u0 exomrcoatlp eliei;s s2uo(r iy4ole mies ( aDta(  nu1tetniieiysfa2raumsnt) etoio3iatfmt aivi;s0srxoxopoy1ll nmnetas a2rmxronu0teeomiciltfsDra(vsnt)aetrif3oy1omteanesls0t2toio3iu1ope  feias s2ururoot0aet if3iytls2ulu p;u4tetomf3ia1fat  uvi;(0 exo(rpnydlp  lnesls aDta( ont1tlxo fctyslsDrln onu4arxrir iotopDeaivs;( s2uo(opiydlp  livil( s2trx o;u4tpx ifeiydfa eaump;(0treomfciytfat livo;t trtriopiu4amenmivsa()aDumxrooo1aeenmfciltfsDranvpn(0trtnio iatfp e uesl()texr(m3no4amee ivi s srtrxmp;u4aeeo fctatls emnvp;t) rxrmo tatopDeluvsl(0 rxrxopnu1al n feil( s2tmxmono4olx iieiysfmDeau p t4alerifciydfa eanvo;(0t2umio3iy1olt mivils  rrrxroot0aex mo3iat aDel(mo;t0altomo ty1lm rluei s s2xoio3nu4omtnmfvt tfsrtm( pno1apeo fcilt mDea( snu4artrxr3iydlm  an i t s2xo(r iydapenlfci (f Dtr(rp;u0apxn ocildfmDrau p u4altoir3ta1fatranvo;s  2um(opio4olen iesl() 2ur(m ;o4tpt mo3iydlaDumnvo;(0tlxnmr oa1lat  u o s0s2xmir3no4om emneia()sDrrxr no0opx ifciadfa2rm(vp;u0alxoxocoo1lmtrlu ilt trxoim3oydlpt lncslsfaDrrumoot1tleoioeiydlm rl(mpnt)alxrif oo1fmD  ivo t)s2urxopny1ome mfctlsfsrumxr no0aptniocilsla2el( o;t4tltoio3iodla   nvi;()texoxr3oo1ale  ieia(fs2tmx  ;u4oeen ociasfaDrlnmsn() lxrmf oadfaDrlnei s) etoimpiy4am   fetat)aDraumo;t0oltn octlslm2rmn o;u) rxrif3iatfaD lnvo;s seumir3ou4lmtelfei (faDtax o;t0ape io3tlt a el(vo u) ltrxo3tytlmtranvilt)trxmxo oudamte nvtas a2rm(r nu4olxnio3tys a2uaums;u4 reomo oydop  aueo ()s2xrxmpiodap nlnetl(fsrurx p;u4alxn o3tytls2emump t4 ltrmrctadlmDe ies t)srxoio no1opee iesl(faDum(mo;o1tetnmf3tls mDum( s ()tlerio3oodfpDe u i;s  2uo(o ou1lltemict t)srraurpou0optn octld m ul(vsnt0altrxf3tadlpD  i o t srumxm3iu4omtemnvtatfartrx ont0tlxoiociatla uau o t)tlenircia1oateauvs s0trtmxr3oo1llt lnvtltf Dtrxr no1tlx iieiltfs rluvpnu4arenmfcoo1la elnvs () eurxr iudamee fvslsfarrr(m ot0tlxnii3iltfmDemnvo t0trtoio ia1fa r i i;s0t2xr(r3oo4lle lici t  rrmx pou0tee moetad s2emumpnt4texomo3ootla e uvils  etoxrpiy4ape  ietl(  rrauroot4apx mociad m2ua(vpn()aetoircoadfpD lnvo;s t2xoirpio4omenlfvil()srrrur ot0tlxnmictyd m rlump;u4trerxr iotlp  aieslt sexrxmpoudol   ici t  rur(r ;u1oexomi3tysfs2rm(vs;t0trxomo3oadfpDeai ols)t2uoxrpou1ome lici t  rrm(rp;u1oleo octyt aDra( s;u)areniocoo1lmt lieols  2tr(mpio1lltnlfvil()s2um(mpoo4apt  ictls s2ra(vs ()artomfctatfa  lueo s) 2umxr no4al   ietas aDurxrpnu1altn o3tad mDeanmo;(0 eermr iytlm e uei;(0 exoio iu4amenmiei t)sDtaxm no0oleo fcias a2elu s (0 rtrifcta1laDeau s;()t2trxm3oy1om nlictat aDrax ooo0tpeoiieiltfmDeaump;u4aetnxr oy1lpDeaueols)srxrimpiydame  fvsat sDtrxm ;u0altn oeiyd m2rauvo;(4 lxrif ty1laD lu ils truoimpnydale lfvtas)a2taxrpnt1tltoiieildla2eln o (0aetrmo iadfatelivi ( t2to(r oo4lmtnlnetl(  Drru pno4tpt  oetlsfaDem(vs;u4 lenxo3iydom  aueslt0 etm(opiydlltnlfvs ()s2tau pou1aleomi3iadfs rmumo u4alxomo tydlp  lieo;t0seto(m iodop emiesatfs2rmxront4altomf3ilslmDeanmpnu4tlerifciotfm  luvi;s trtoirpiu4aptemiviltfsruax  nu4aexnioctydla rm(vpn(0tetnif3oydomDraueslt) 2urxm3iydlpeelivt s srur( p;u1oexo i3iaslm eaums;t4 rtrxf3todlaDe n il(  2xrimpiy4lltemfcslt arua(rpou4aeto ociydls2rau s;u)tlxrxfctatoa eauvs;s tetoimpno1omt licsl(fartrum nt0tpenmf3tldfaDuaump;t)treomr3tadfate neo;t0trtm(rpiu1am emnet () Drm(rpnt4ole mfciytls2rlu p u4trxrmo totom rlu i;s0 euoxr3nydolenlncsl()aDtr( p;u0tptnifciyt a2emnvsnu4artomr3to1omD  i ol(0 etmirpno4ll  mnetatfa2urump;t4oeen fciad aDrl(vo;u) lenif3oytlaD anvol()trxo(o3oudame mietl()sDtmumooo1aeeo feild aDel(vp;u)aexoif totoaD  ueo;t)t2xmxrpiodlltemieslt srtru p;u1tpen fciyd aDemnvont4artrir iy1fpt auei s) exm(mpiu1aptn fvtasfaDraxro;u4oexoiociysfmDra( pn(0 eermf iadopD  nvi (0srtmir oodalen iet s srtaurpno1alx  ocilslm2el( s (4texnxo3ta1laDeluvols) eurimpoodome lietlsf Dtrx  nt1tpx  i3iadfs elnvp;u0 lxrxfciodoaD lnvsls trtoxm3iu1lmenlfviasfarra(ro;o4tltnioeiydlsDel(mp;(4tlenxrcootoate ivsls0 exmxr3iodapt lictltfartrx  ;o0tleo f3tad m em( o u)artnmo3iydfpD an s (  2xoxrpoy1oltemnci s sruau oou4ale  i3iys m2ulnms;t4 exnif to1la eln o;(0sexrio io1lpt lictasfarrmx  no0oltnioeiyd s uau snu) etrmf to1oat  nes;(0 rxrio3no4lmt lfvsls)aruauront4ole ioeiad a ul(vo;t4 rxoxr3todomt ln s s) etrxr iy1omen ivslsfsrtm(ro;o4tpeoii3iytfm2rm( s ()texrxr3oodlmt lu s s)teum(r3oudaptnmnetasf rtr(mp;u0tlxn i3iyd mDrmnvs t4aeerio iadfaD aivolt t2xoxo iydole livils aDrau ono1oeeoioctat m2emnvp;t)tetnmf3to1la rli s;(0t2umxo io1llee feias) rurxm nt0apx  ociadlm ulumo;t0aeeoxrciodoaD  nvsl(  etr(o oudam e nesls  Dta( ont1aetomieiysfa2elnmsnt)teenirciytlaD  neo (0 2uoiopnudoltelnvi (fs2um(rpno0tltomo3iydls uanvp (0aexoxo iydoat anvo;()srxm(r ou1omee ieiat  Dua(m ot4tlxo iciat aDem(vpnu) ltnif3iadfmt au i (0 rxrimpoydamt mieiat)sDra(mp;u1tlt ifetatlm2rlu o t4trtnio iadopte ues;(0t2xm(m3no1lm elnetasfsDur( pno0aeenmfctyslaDem( s t4alenxf tadop elu il(0 ruo(o io4amtnlivtltfa2umu  nt4altoioeiatfs2ea(ms ()arxoxo3iydfaD aues ( srtoxr3iudoltn ncsat aDtaum ;o4oex  fcias aDelu s u) exoif3oatlmDe u sls0srxmxr iy1ol n nvi (f Durx o;o1tlenmieiysla ean p;(4trenmr3tytopD lues ()srtmxr3oo4oleelfes ( sDtm(rp;o4teto f3tydfs rm( snt)aexnmf oadoaDrlueilt trxoxm3io1omeemfcs ()arta(mo;u0oleo ictas s ulnmsn(0treoio oatoat aieol(0t2urxo oy4lle  iesat  ruaxroou0opxnmiciydlm2el( on()alxrmf oydop e uvi;s)seurxm3ny4oltelfetatfsrurxrooo1aetnmieiatla2emuvp;(0 ltoxr totfpD lneo;t)trumimpoo1op  mfct (f ruaum ;t1aeenif3tat mDulumsnu)teenio iodopt  nvs;s  2xm(o iydol n feiat)sDtru  nt4apxomo3iysfa eau p;(0arxnio3iotfpDelneo ( srur(r oo4om e fesl()sDuau p;t1teeo feiysfm2uau on(0texoifciytlaD lneo () etrir3no4ll  mneilsfarra(mont1ape  ocildfm2ul(vp;(0 eerif3todlate nvs;() rumxrpiudomeemfcilt)sDta( poo0olxoio3iyt a ranms (0aeeoirctydlaD ai ol( s2xrir iodol nlneiat sruaumpnt4tlto octadlm2rmu p;u0 rerxf io1opteaieilt)srxrxo3nu1lltn ncs t sDrm(rp;t4optnmictatfa rau pnt)altrio iadlpte nei;s) euoirpnodalenlfvi (f rtr(mo;u4opx ioeiyslmDean s u4altnxf oatlat  n i;s) 2trir iu4al  mies sfa2tm(mpnu0optnmf3iadfsDelnvo;t4alxrmr3oa1op   iei;t)s2trxo3io1lptn nvtl(fsDrmumont0olenmocild aDemu o;t0 exrxf totfaDe u slt) rxr(rpio4om e nvias)arra(m ;t0tet miciaslm ua( s;t4 renmf3oy1opDe nvs t0s2xr(r nu4am e ivs () Durxr oo1olenmfciatfaDeln o u) eeoif3oa1faDrai i s) 2tmxmpoo1lmee ivsa()srum(moot4tetn oeiytfm rl(mo t0trenir ty1lmtr uei s sruoxr3nu1ap  mnvt t a2rrx  nt0ole  i3tld a umumpn()trtrifcoodla  aivi t  eurio3ou1ome mivs s)arrm(mont4olx ifciltlaDeluvs;u)alxrif ty1lpDe ieslt t2xoio3nodopeemfctl()s2tr(r ;u4tex  feiydfm2rln snu4tetnir3ootop rlnvs (0s2tmim iy1ame mivs (fsDtaumont0tlxoifeiad a ulnmon() rtrio iy1lmt  ivs s srtrxm ou4lle lfvi (fsDuau p;o4olt if3iadls2ulnms;t4aexnif oo1om eli s (0t2xr(opiodame  fetlsfsrumumo;u4alx  ociltfmDra( p t) ltrmr io1fpD lneols) rumxr iudlpeelict sfsrumx oou4oet  icilsla2um(mo;u)aleoio3iydoa  lu o;s)seto(m ny4olen fvia(f Dtaurono1ale moetatfa2ul( p;t4 reomo3oy1lmteluvo s) 2tr(o3nudale  ieta( a2uau oot1tlx mi3iyt m umnmpnt) lerxr3ia1fa rluesls  rtmxm iu4lmenlnei (  Dra( p;u0aee iieiytfaDemumpn(0 lxnio io1fpDean olt0t2tr(m oodalenmfcslt) Dur(mp;o4tptoio3iasfm2elnvs u4artoio3oy1lm eaivsl( sruoxm3iy4altn nvsasfaDtr(rpno1alxnmf3iadfsDem( o t) etnmo3oydlaDrln i;s0seuoxmpoudlltn ivt t artmuro;t1tlxnmo3tas aDean pn()texnif oo1fa r uvs s)s2uoir3ou1om n ncslt sDra(m nt4aetnmi3tatfa2rl(vont) rtnmf todlm e i i;(0srxoxo iydapteliei sf Dum( ono4tpxnifcildfmDrlnmont)aetnxr3ia1la   i o t0t2toimpio1lmenmnei ()s2taxr ;t1open fetytlm2umn p t4 rxrir totlmDrlnes t)teurir3io1lmtn fesas) Duaur nu1texomo3iat m2ea(vpnu4teeoiocoo1lpte uvs;t)setoxo no4ome mieta()srrauroou0tpenifctldlm2emuvs u0arenmfcootfat lnei t srtmir3iydopt  fvi t) rtax pno0apxnifctyd mDemnmon()tltrxo ootfmte ueo ( trum(r nydop  mnetas)sDtm(root1altoiiciytfs2ea(mo u0 rtrmrcoodlm rlivs t  exr(m io4lpt mfcil(faDtaumooo4aet  f3iydfa ra( p;u0aeeoir3oa1om rlueo (0 exr(r oy1lme miesl(fsrta(  ;t4oeto oeiyslmDumnvp;u) lenif iadlmD  ueo () 2to(r3oodapeemfviat) rtru  nu4oex  f3iadfsDul( p u0 eeoxr3tytfmt ln ilt0teumxo iudoltnlnv
\ No newline at end of file
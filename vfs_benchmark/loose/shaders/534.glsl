@@ -0,0 +1 @@
+nes;()trumir no1lpenmictatfsDrrxroou4tpxoioctas sDumnvp;u)areoir tatfmtr n s;s  exmiopny1omt mnetatfa2urx o;o1ape ifeildfsDeau s;t4 eermo3oadop r uei t) 2tmxo iu4olen nctasf 2rrurooo4aeen ietas mDumuvo;t4altnif oy1fmDeai s;( trumimpnu1amenlfcta( s2rmxr nt0oetnmietysfmDrm( on(4areoio oytlaDrluvo;s tetriopiy1altnlnesasf Duau poo1olenii3ils s rm(ms t)arxnxf tydop eaneo;t0t2xmio3ny4lm nmneil() rtmu o;o0opx if3iatlmDrlumpnu)aexomf3oodomDraneil(0t2umimpoodaptemfesasfa2urx  no0olx mo3iytfm uau snu0 rtoio iadlpDelivs t0 rurimpny1lmenmivil(fartaxmo;t0tle mictldfsDuanms (4trxnmrctadfp r uvo;s)trxr(rpno1ol   fes tf rrmumo;o4ope miciatlm2umnvpn(4texnio tadlm ean i s)t2urim3nydaptn fvt s sDua(  ;u4tleo icils aDuauvo;() exrxo oytlmD luvo ()teurxo3iodlltemnvt ( aDua( onu1apx iictys s ua( o;()texnmfcoadoa  aues;s  rxrxr nodlme lfcia() 2raum ;u0alt mi3tlt a rlnvo;u4aexrxo3todfpte ies;s t2xo(opnydomen iei t  Drmu oou4aleo ictys sDrlnmsn(4texoxf oadlpD  uei;t srur(o io4ll  mietlt)s2um(rono4alen oeiltfm umu s;u4 lxrifciytfpDe ues (  etrxo3iydlpeemfvia(fsDumx onu1texomi3tas m2rau p;t)aetomo tydom e n i s) rxmirpou4open fct t  rtm(mp;t4apt moeiltlmDel(vp;u4 ltnircta1oatraies (0seurxmpno1lme micsltf ruaxm nt4aeeomfciadfs uln o;u0 rtnir3iatomteaues;(0texrxrpny1lm  mnesa( aDrr(  nt1aetn o3iltfa2rl( p;u0artnmf3oytfpt  n s;t) 2xoxo3oodllt lictl(fsrurx  oo0oee if3iasfm2rmn s (4trxrmfcoydlptrlu o;t0sexo(mpiudll elneils sDrmu  ot1tpxn iciat s rmnvo;t0teenmr3tydop  ln sls0 exo(r3iu4am n fesasfsrtr( onu0olx iieiysfaDelnvo t)arxomf tytlatr nes (  rumxrpnu4optn ncslsf 2tm(mo;o4tetomo3taslm ul(ms;u4tlxomrcoo1omDraueo s)srtrxrpiu1ll   ietlsf Dtrum ;u0oetnmf3ils mDul(ms;()alxrmf3ia1lateaies ()setrxrpoy4om   fciat arra( o;t4opx  oeiydlmDumnvo (0alxoxr3ta1fmDeai i;s0teurxm iu4om nlfvs ()srta(ro;u0oltnmoctyslm2eau on()tlerxr3oadfm eluei;s0t2xm(r oo4op elfvils s2rmxr ;t4oltomocils s2ua( p u0artrmf3ootoptrlivilt)trxrxr ny4lp   fvt s) Dtm(  ot0opx ifeiydfs rlums;t)tltoxo3ootopD  ivs s) exmir iy4lpt lfvils) rtaxm ;o1aexn o3iydla rlnmp;u) eenxocoodfp ranvo t)trxmirpiy1ameemnes t  rrrur no0olxnioeiad s2ea(mp (4 eenmr tytlp   uvi;s)t2xmiopio1lpen fcia(fsruaxr ot1opx  ocias s2ul( s;t0trxoxrcoydfp  anei;s)teuoio ou4lptnmfetlt  2tmx ono0apeo oeiad s eluvs;t) ltrxr oy1la   ivi t0s2um(o3oy4ll elfctls)a2tax p;t4oeenioeilsfa eau o u4 rxoir ta1lp eaivo;t) rurio iudopeelfvsa() rrmuroot0optoii3tlsfsDumums u4 eermo3ia1faDe u olt)s2ur(r3iydameemfvi tf Dtm(mo;o0olt  i3iytfmDranmsnt)alenir3todfaDe ivs;()srxrio oo4apt mneia(f 2raxr ot4tpenifctld sDrln snu4texnxrcoo1opD auvi;(  etmxopou4lpe mieil(fs2umu poo4apxn i3iadlm2rlnvpn() rtomociotlaDe uvs;t) 2uoxr3iy4apee netlsfsDtax pnt1tleomi3iydfs uluvpn()texrio3iadlmDe ies t  ruo(opio4omt mfviasfsrrr(mpnt0tetoioetytfsDrlu snt0alxnio3totlp eaues;t0sruoxm iu4ape lncia( aDtaxmp;u1tltnif3iltls ranvo u0tlxnifctadfpDrlueslt  2urxm3ny4optemncia(  rumur nt0oleo f3iytfm2elnms;u0teerxr oadopD auvi t0t2uo(r3oy1alte neslt srum(mpnt0tleoioeilt a ul( sn(4areoxr3iodlaDr n i;s0 2xo(opnodame  fvta()aDra(m oo4alen oetyt sDemnmsn(4trermociatop elnvo (0 2uoim3nodop  mieil( s2ta( pou0oet io3tld m emuvo (4aexrifcootomtrau il() rxoimpoudllen iviatfa2raxr nu0olt  ictysfm rl(vs;t4tetrmocty1fmtr uvo (  rtoim3iu1ome livslt  Dtaum no1ole  octysfs2ea(mo (4trenmf to1op e ieo s) 2xrim iu1alt miesa(fs2tr(r ot4aetn f3iadfs umn o;u0 rxnirctatlaDrlies s0sexoiopnydlm  lieta( a2taurono4oexnmociytfa2rmnvp t0alenir iatlp eanvs;()s2toxo3nydaptnmnetatfaDrmurpnu1ope iiciltlmDum(mpnt) rermf oadfa  lueo;s  rur(opiodll  mfci t s2umxrp;u0tpenmfciatlaDul(mo;u4tetrxociy1om rauvi;()s2xmir3nu1ome  fvtl( srur(r nt4oexo ociyslaDranmp;(0 rxrmocta1op rlneo;t) 2xriopnu1ol   nesat sDuru p;t4texo fciltfs2ea( p (0tlxnxfcoadfptrauei;s)texo(rpnu1ope  neilsfs2rm( pot0apeoio3tlt m rlumont)texnxf3io1omtelueo t) rxoxo iy1omenlieias)arurur ;o1apenmo3ilsfs2ean pnu0tlenir3oy1faD  n olt  rum(r oodom e nesa(fs2tau  ou4opxn iciadlaDel(vp;u4 lxrir to1fm  aneo (0tetrio3nudaltemiet t a2rmur ou0olenmi3tlsfsDelumont0tetrxr oytfmDeanvols sexrirpoy4apeemivs sfs2trxm oo4opeo fcils a2ran p;u)arenmfcoydlpD lnvs;s truo(r io1ame lnvta( aDtaxrpoo1oet moeiad m2rau s (4arxomocoytlp   uei;(  rum(m3nudamtn nvi sfaruau ont4aexnioeiydfa ul(vpnt0 renxr3ootoa  aivs (0 2urim3iydam e fcilt)a2tmuro;o0aex moeiaslsDul(vs;t) etoxf oa1lmDrai s;(0 euo(m nudapt mfesas  rrruronu4tle ii3tltlaDrmuvp u0 rtnxf3iotfp eauvo t)trxrxmpoudlm  lfesltf rumx o;u0aex moctat m ulums;t4aeeoxr iydoa rlnvi;(0 eum(m3no1openmivsltfa2tm(m nt0tptn iciydfs rmnvo;(4altomf iydlpD  n s;t)sexrxo3iy4ape  fctat artmx pou1tpxn f3iyslmDul( o;t4arenifciatoaDr i sls srxrxopou1lle  icsas)aDrrx ooo4ole  f3iadla2raump t) lermo oa1omtean il( texrxm3oudlltnliesasf rurxmo;u1oex if3tytls2ranvs;t0 ltrmo oytfa e nvo s) rurxm3ou4lpe lfvslt aDraxr oo0oee mo3iadfm2em( o;t)aeerir3iotfa   nvsl( srurirpnodomte nvtls  rtrxmpnt1tee  feils m2rmuvo;t)tetoio iadoate iei;s t2urim ou1ame miei sfarraumo;t4tlt mfeilsfa2ea(vo;(0tlerio3todfa e uvo s0tetoxr iodolt  fvt tfs2tauro;u1tltoifctasfa2ranvo;(4tlenmo3totfpDrlneilt teto(mpoodlmtemfctltfa2rmurp;u1aexnmociytla2rmnmpnt0tlxrmf3tytlm ranvs;t s2tm(r iydamt mnvs s) 2um(rooo4apxn fetltfs ran snu)altomo iatfat aneo (0srxm(m oy4alenlncs s  2ta(m ou1oeeomoeiydfm2rlu pnt4 leoxfciodopt auei;(0teuoim iudalenmnvi sfartm(mpou4apeomo3iadls2rm(vs u) ltrxf iytfpte nes;t)srxmxmpiy4lltemnesl(  2tm(  ou4tlenmi3iltfm2emu on(0trenmf iytfmtr i slt0s2umxr ou1amte fcia( srumurpou4apx iiciatfa rlnvpn(4 rtoxf3iatoa elueo s0seuoio3oodlle mfes t) 2ua(ro;u1tptn fctytfs um(mo t4areomr oydfptelieilt0 exmio iydlleelfctat)s2trxr nu0tlxnioctlt sDran s u0aexrmfciy1oa  aiei t)srtr(rpoy4amtnlfvtas s2umumonu1teeomoeiltfs2umn o u4aetrmrctytlpDr n i t t2xoio3nudlme mfct (fsrtmxrpno1ale mocias m2eau s u)trenio tadomt lnvols trxrxm3nodamee fei t s2rmumonu4olx  oetydfs2elu p;t0aetrmrctodoaDr uvo s0srxo(opnodope mnct s)aDtmxm no1alxomfeias sDelu s;t4 exrir tytfa raivo;(0 rxmxo3nudopt lietl()sDumxmpnt4texoiictad s2rm( s (0tleoxr3tytfpDran olt0 2xmxm3oy1apee nvil( artm(mono4tpeomi3ildlm rmnvs t4teeoxoctodomt  ieolt  2toir ou4lm  lnei sfs2rru ooo0oetomfctas a umuvs;t) exoxf iodfatelieolt0 2xoxmpiudalt mnvtl( srtr(r ou4olxoio3tytlm2rau s u4altnir3ootfm rlu o t) rurio3nudom  lfct (  Dua(mpou0olxo i3tasls eauvs;u) rtoxfctatopD lueslt  ruoxopno1ll nlnctasfs2raur ;u4olx ii3iydfaDean s;t0tlxnmrcoydfaD lneo;t0 rxriopou4lp   fcta(  rua(rpoo1opeoiicias m uanvp;u0aexoifcto1lmDrlivi;s srxmxr3no1om nlies t)sDraurpnt4olxo oeiad aDuan snu4texriociatfmDrli i s  2xrir ny4aptelicsat)arrru ont4apeomictadfsDrau p;(4trermfcootlmtrauvi ()setmir no4om emnetl( srua(r ot1texomf3iadls um(mo;(0aeerxocta1fmDr nvil(  euoxm no4alen ivtls sDra(rpoo4apeo fetldls ea( p u4texoio3iodfatr iei t0texo(rpou1aptelfvsa() rrr(m nu0apenif3ilsfs2emnvpnt0alxoxr3todfptr i s s  euoxr3oy1alenmncta() Durx  ;u4aeto ociysfm2eln snu) rxnxr todlaDeau i t0s2xo(r3ny4opeemfvt s) rrm(r ou4tleoiieiyd sDrl(vp t0trtoxr tydfat lnvo ()trto(rpiy4om  lfvtat sDumumoot0texo iciat sDrl(msn()aetrxr3iadlaD aivs;t) 2tr(o3io1ol e fvi s)srrrxmp;o1alxo i3tyd sDua(vsnu0aeermo iodom eau sl() ruoim3iy1ll  lfesat aDururpnt0apen f3tls m2ul( o;(4teenio3oatlm   u o;s s2xoim3iy4apt licsas  Durx  oo1altoiieiadls2eauvo () rxrxfcoa1fpD aivo;t0 eurxrpny4lpeemieilt) 2rrx  ;t0oleoifeiysla2uluvp;t)aleoifcia1op rlnvs s)s2uoim3no4ap emnet tfs2rmurpot0tex ifctlsls ranvpnu0 lxoioctotlmDe nes;t0s2xoimpou1apen nct t) 2ur(m ;o1aptoiicild a2ua(msnu0trxoifctadomtr n ilt  2xr(r nudolen nesls) rumu onu1tpt ioetltfm2rl(mo;u0alxoxf oydfpte ueils sruoir nodal emnvsas  rtm( oot4tltomi3iysfs2rluvonu0texnxocty1fmD au slt srxoxopio1lmt  ivs ()srtrur ou4aeto feiaslmDemn s;(0 rxoir oatlmtrli i s srxmir no4lme mncsltf Drm(mpoo0opx  oeiatfmDulnvon(4teeoxf tydlpt  n o t  2uo(mpou1omeelict s) Dtm(rpnt4aeenmfeiltlmDrmumo t4areoir tadoaDe nes;s srxmim3iy1am n ics sfsrtaxmp;u1teenifeilslm uanvp;(4trxomfciotfmtr uvo t0texmxr iu4oltnmiesa() Dtm( pnu1apxo f3ils sDeauvs;u0trtoircia1fptrlu s;t0s2toxo3io4ll  lfvt ()arumur nu1tptomfciydfa2ranvo;t) lxnio oodoa  auvo;s  eum(m iu1ll e fvsas)s2tmxm nt1aex mociysfm2ean o u)aeeomr3iadla  aiesl()s2toiopoy4op elnvtl( aDtm(  nu1altn i3tatfaDra( p (0tltomr oy1fmteliei;t0srxmxr3io4lmtemfes t) Dtm( pnt1tlxnmieiatfsDuanmp;u)trenir iytfatrli s t0 exmxr ou1op nlivs s) rum(mo;o0texoifciytfsDemu o;()aleomo3tadlpDeli ils) 2tr(o3oo4am elfcta(  2taur nt0alxnmocils mDrlump t)alxnxr3todoateaieils0srtr(r oudol nmfciatf Dtmu  oo0tpeomo3tasfmDem(mpnu0texrxf tydoaDeauvil( teum(o oo4ol nlfcilt)sDrmxmpnt0apxoiiciys sDuanvp u)aleomo ootlmDeluvo;( setoxr nu1amtnmncsa(f rtmu  ;u0oetomfeiadfm em( p;t)aeenio oy1opDe n s ()srtoxo3nudlp  lnvil() Dumxrpnu4aleo feildla ran p;u)trxnmf3iadla  anes;s srxoxrpiodapenlfvslt  rurum no1aex miciydls ra(vsnt4arerif3tatfa rlivi;t srxmxopiudame mfetat a2urxrpot4openmo3iydlsDrmn s;()aexnxo todlmDr u i;( setmio3nu4al nlfei sfsrrmumpot4oee  ictydfaDrmnvo t4 eeoiociydlpt  nvs ( trumim3ou4apenlnvtatfsrtmx pot1aee  i3iasfa2eauvs t)aleriocoa1fm rlnei;s)srumxr3iodlm nlnvils  Draum oo4tex  feiad s2ra(mo t0aetoxo oodfm  ai o (0t2xmxopou1ap n ici s) 2rm(r nt1texo ictyt m2umums (4altnmrcia1opt auvs;s  2xoiopiydoltelfcsat)a2taxmpou0aptnmf3iysfsDelnmp;t4 rxoxr3oytlpDeluvi;t seum(m ny1apen ivtatfsrtrurp;t0ole if3iasfs ra( o u0aexnmoctatlpte i ols  rtoir nydapt mietas)aDurx  ;u0ape mociat sDea(vp;t0 lenxo to1op r uvo;(0trum(m iydlpenmfei ( sDraumoou1apt ifciadfaDul(vonu0 exrmf3ty1oat aies;t sexrxmpnodopenlfcs (faDraurpnu0ole ii3ild m umnvs u4 eerif3iadopte ueo t0truo(rpnu4op emncilt)s2rrumpot4oeeoifctldls2rm( p t4altoif3oo1opDe uei;t tetrimpnydlpeelieiatf Dra(rpoo4olxn oetytlaDranvp;t4trermo totfmDrauvo;s)t2um(mpiudal emiei sfarur(roou4tetoifeiltlm rln ont0 rtoif3oadla rai sls0 rtoiopiu1ap e ieiat aDraum nt1apxniociydla2elu o u0tetoxfciatlaDe n s s truoirpny1alt  fvias srraur ot1texnmfctadlsDuanvs t0 lerxrctydfpDrlueo s0teuoir nydlmeemnctls aruaxm nu1oet iieiatlmDrlumo (4aetoir3tydla r ivi s  etrim iy1ap e fcsl( s2tmx oot4oetnmi3iadlsDeluvpnu4arxrif3oytla elueo;t)teurxmpiu4lm elneia( aDra(rpoo4aexo oetysla uan pn(4 lerircoytlp eli o;t)trxmiopoy4olte nvtlt s2umumo;u0ale ioctlsfm rmu s;()tlxnio3iytlate ues;() 2tr(m ou4lmt lfetl(f 2tm(rpot0olxnii3ilsfa2um(vsnu) lxrmrcty1fp rlieolt setmim3iydopeemncs s) rurum nu1oleo ociydfa2rau snt4 exrxociodopDelneo t srxrxopio4olen ivsa(fsDtmx  nt4oexn ieiadfa uau p;t4arermr oydlaDran ols sexrxmpiy1lmtn ivsat)s2uax  ;t1tpen i3tld sDeanvpnu4 eerxfcty1fmtrlu s s) eum(opiu1ameelietasf 2ta(mont1oet mfctatlm ranmp (0tlxoio iotlmDe i o (  exrir nu1lm emivi tfsrtmuroot1texnmf3tltfs2eanvp (4artoio3ootlm raueslt)t2to(mpoodomt mfctl(farumur ot0apenmoeilsfm2rl(mo u4trenmo3ootla e u s;t trtoxm oy1llte fvtas srrrx  ;u4tlx  oeiysfs2rm( s;() exoxoctadfmDeli s s)sexm(o3oydll  mfci ( srraxmont4aleomieiyslm rluvp t4 rtrif3tadlmD li ol(0seurxopnudopee fes (fsrua(m no0aptomietld m2ean pn(4 ltrxr3iotfmDr n o (  etoiopno4am  mfesatfsDumump;u4tex moeiydfm elu snu4 eenxfcia1oatelivo;t)t2uoxo3oydame mfcta(  ruaxrpoo0olt if3tadfs2rmnmo (0 rxomr3oo1omDe u o ()trtrxrpno4am emnetl(  rumumoou0alx ioeiatfs2eanvsnt0 exnxr3io1omDranei;t  rto(rpoy4al  mnvil( a2umu oot4tlenmoeiytlsDelnmpnu)aeeoxrciotfm rln i;t0 euoxr iudom n ivsas srrrxr nt0ole ii3iyslm rln pnt0 rtnxrciotfm e i sl( teurim ny4lltnmicsa() 2uaxrpnt1aee iieils a ua(mo;()artrif totfp   i s;( sexm(r nudll nmfciasfs2uaxm ;t0tet  feiysfa rm(vpn(0arerxo oytlmtr n olt s2tmxm3iu1aptelnvt s)arrmx p;u1aleomf3tatfm2emn ont0 rtoio tadomtr neo;( s2um(r3io4ape mnvi s  rumu  ot1olt mi3iasfs2eanmsnt0altnxr3oadfaDelu sl() 2urim3iu1apte ict (fs2taxro;t0optoiociysfaDelnvs ()trenmfctotop ran i s srxmxrpou4omte nesasfs2raur no4olxoiieiydls2el(vsnu) eenio iy1oaDeluvi;t  2to(o3oo1ale  nesa(fsrtrx o;o4opxo o3iadla2rmnvp t)texoxociotfp  lnvol()sexrim ou1lm e ivi ()aDtr(  ou1tpt mi3tydfsDum(ms;()trenxrciatopD lueilt)seuo(opnodomenmncils  rra(r ;o1ope  f3iat m2eln pn()trerif tatoat au ilt0 2tm(mpnu4llt lnvslt)sDrr(mooo0tlx moctytlmDuanms (4teeriocoodfaDrauei s0trtoimpou4amtemfcsas  Dur(rp;t4opeoio3tatlm ranvon(0 rxrir3oydlaD aivs s0 rxr(o3iu1alt miesl()srtax ont4aexo o3ias m2ea( ont)tleoifcoadfpD lnvilt0t2urxopou4am e fvtl(f 2uaur oo1tpto o3iyt s2elu pn()altnxo ta1laDrlneols0s2tr(opiu4opeemncia()a2ta(ro;u4tetnmietlslm rmumo t0alxoxo3tytomDe ueilt  rtoxr3ou4am  lnesltfaDra(  nu4oltnioeiadfa2ulu s t4aleoxo io1faDr u i;s)t2xm(mpiydlmeelnvsatf Dtax pno1tpxomoetlsfmDum(vp t4tltnifctydopDeai ilt tetr(rpiu1om n ietatfa2urxr ot0olto f3tas mDrmu s (0aetrmf oytfmDelivo;( trtr(m3oy4lleemfciat) Dra(mpno1aleoioeias a em(msn(4 etnio totop eaies s) rtmir oy4lleelivslsfsDrm(roou0opxoiociys s2rmuvonu4trerxr3iatla eauei;()texr(o oy4ll elfeias  Durx  ;o4altnmociyt aDem(mo t4alenmf3iytfpte n olt0trumxrpoy4alen fetl() rtrxrpno4oleoio3iyt sDulnmsnu)aeerir3oydfateanvo t)setrxo oo4ol  mnes t)arumu o;u1oltn oeiat sDelumsn(4trtnmr3to1omDe ivils0 2toxrpou1ope lfvias) 2um( p;o4tetoio3iydls uau o ()artnmf3iydfmD aivi;t)teto(mpnydoptemfesas srtm(r ;o0tex mfeiys aDrluvsn(0 etnio3totoa e u olt0s2xmim oydamtemfvta()arur(r ;u4oetoii3iyt s2rmn s;u4 ltomr iodfatean slt  exm(m3ou4lle lncs ()aDrmxr oo0tleoifeiysla2ea(mpn() lxrmrcta1omDeai i;()setr(o3iy4lmee fet ( aDrax ono0aetoifctyt s ul(mpnt)tetrircoatlatr ies s0 eto(opio1lm n neiatfa2tr(mpnu1aet  i3iatlmDrmuvsnu4 ltoxf iodom  ai o;(  exrxrpnu1am emivsltfsDrax  oo1tpxn i3tysfs rmn pn()altoirciatfp rln i;t texrim no1ope mfes s sDtrxrpno1tetoiictltfa2emu p (4 lxoifcto1lp   ivslt tetm(m oy4oltnlies (  2ta(mpno0oex moeiadfaDeln pnt) rxniocoadoptrlnvi (  etmir3nu4lpeelnvsat srumxm ;u0oeen fctldfaDrlnvo;u)trxrmf3tadfaDraivsls0s2xmxr iu4opt lnvt t)aDuaxrpot0aexomociasls ranvpn(4 ltnif3ia1omtrlues s)teurimpoy1altelfci s arra(rono4altn feiat mDemn o u4arxnxrciodoaDrai o s0seurim oydale  fvi s s2um(mo;t0opeoio3iysfm rl(vo;t0tlxomo oy1la elnvi;t0sexo(m3io1lptemnetls)a2tm( onu1apeniocildfmDrm(vo;(0arxnircio1omtrlneo () etrirpoudolen iesasfartm(mpou1tlt iocild a2ul( o ()aexomo3iytlaDraueolt)srtmim3iu4amenmivtas)artrx o;u1aetn icildlm rmu pnt4 ltnif3ia1lptranvil() rxmxr no4omen ivils)aDumx oou0oltn iciytfsDumuvonu)altnxfcoy1fmteln ols)sexrxrpio4lp   iet (fs2tm(m oo1alt ii3ildfs rl(msnt)artrmf3io1omt luvs;t  rxr(opiudop nmivslsfaDrmxr ot0tleo ieiytfa eanmo;()teermr3oatomDrli sls teto(m ny4alt lncilt) Dum(m nt0aee  fctltfm ra(vp u0trerxrcoytopteaies s trtr(o oy1lpen ieslsfartaxrp;o4tlxoif3tltlm ua(monu0alxrifcia1opt aueo s0t2trxm3oy1altelnctat  rumxr ot4alt iieiyt sDrmums t)trtnmo3oodoa  livs (  2uoir3iodoptelfvs t arrauro;t1alxo f3iysla el(mp;t4 lerxf3ty1fmt  nvo;s  etm(o3io1opte fvs t)srtax p;u1oex  feiysfmDrauvs t) rxnir3oodlmDran s (0trtrxo nu1omte iesas arrmumo;o1tlxomiciyslm2ulumpnu) rtomrciotlmDe nvi;s)s2umim nodope  ncs s a2um(rpnt0olenifciadls ua(mp;t0 exnxrcta1laD  u i;(  rurxr oo1om e neils arurxr ou1oexnifctat a eluvs;t0 rxoir oa1faDeln slt  etr(m iodomeemnvtlt)a2rrxr nu4apt mieiadla2uln o t)alermr oytoatr nvslt0 etoimpiy4ll  mfvt ()artm(r nu0aptoifetltlm umnmpn()texnxo3ia1fp   i s;t0srtr(o3iy4olt mictl(  rtm( oou4aeenmf3ildfa2ulums;t)artoxfciydom   n s t trtmxo nydam n fctat  rrmumpnu1alt ioeiltlaDemumo;u) ltrmfcia1fmDrliei s0 rtr(m iydopenliet tfsDuru  ou1tle  ieildls rau s u0tetrif oa1lmt au s (  2um(opiudam  lfeils aDtrum ;u0olxnif3iyd m2uaumo;() rxrxfciadlpDe ivi;s srtmxopoo4alt licia(fs2tru o;t4olenmoetlsfs rmumo t)aleoio3iatla  ln s;()trxr(rpoy1lmt  fciat  Dumum ;u4teeoioetls s umump;(0 renio oy1fat lnvsls0texmim3iydamen iet (fa2rmx  ;u0aptniieiaslsDeauvo u0tetoircootom  auei t s2xm(r ny1am nlnvsat sDra(mpoo0tlx  oeiadfa2rlu pnu4 eeomrciytfpDe u o ( seum(r io4lp nmfvslt) Drru  ou1tpt moetlslm2um( s u0tlermocoadlatelieo;t0texoxopiudope lictl()aDtaxrpnu1tleniiciyslaDumnvp t0aetnif iy1om  auvsl(0 2uo(mpiu1ll e nvsls)a2tau ont4teeo fciltlm2el( snu)tlenxr3ty1opD aneilt0t2tm(opou4ol n ncsas)s2tm(mooo0tlx iicias mDeaumpn(0 lerircto1lmtelnvsl()s2uoimpio4am   netatfaDurx ono0opx  i3tydlm2em(von(0 exoxr oodoa rauvo (0trxrxmpoy4lp  lici t)a2rrxr ou1altnio3iys a emu snu4 lxoir tydlmDrlu s ()srtrxrpno1altemfvslt aDumu ooo4olx mo3iysla2um(msnu4artomfcoatopte uvs (0trxo(mpny4llte fvs t)a2um(r ;o0opxnioctlt a2ulu o (0tlxoirciydfaD aueol()trtmxo oodllte nctat sDuru  no4ole io3tytfm ulnmsnt0artoxo3oatfm r uvs ()t2ur(rpou1lltelnvsasf Drmxmpoo1aeenioctltls uau p (4aexomo3todfmDrluvil()s2ur(m iydolenmneiasf rumx ono1aet  ictatfm2eau p u0altnmo3tytfptran il() rxo(opio1lpt  icia( srrrump;o1oetoioeiat mDem(vo;t) exrxo iodfpt auvs t0srtrim3oydamenlfvil( srtmump;t1alto ociyslm ra(ms u4 etnif oadopt  nvo t sruoxrpno1om e iesa() rumx pot1tlt moctltla2elnmont4trenxfcoy1lmteanes;t) rtm(rpou1am   iesas a2umxrpnu0altnmfcias a rauvs u0 rxoir3oatfm rluvi s0texm(r3io4om nlfvtls s2trurpou1oeenio3tas aDemnvp u0aexnmr3iotlateaiei;s s2tmxrpoo1apen nviat  rrrurp;o4opto ocild m umu o;u0tetnxocto1oa rlnes;t)s2xrir ny4lmeemicil(faDrmxm ;t1alenmo3tltfsDra(mo;u)tltoircto1opDeaiei;t truo(o3io1am nmivtat  Dua(mo;u4tpxomoetld a2eau onu0 leomo3todfate i i;t) etoio3ny4omeeliet (fsrum(mpou1ale  oetlt m eln p t4 eerif tadfm   nvolt)seuoxo ny4lpeelfetas arrr(  no1oeenif3iasla eau s t4 eenxf3iy1fp  ln o;s s2umxmpio4ale mnciasfs2rr(roou4tpxn ictlsfs2em(monu0altoircoy1lpDrlnvo;(0s2xrim oo1ape  ivil()sDta( p;u4tptomf3iasls rlnmp;(4tlenmo3tydlpt aieo;t)truo(mpnu4lpee nvslsf 2tmxmpno4opt mictyd m rmu p;t4trenmr3iydfm  lnes t)teurio3oudal  mivtat artr( p;u0olxo fcild a2raump (4aexoxo3ty1lmDe nvo;s0t2urxopoo4apenlfvsat arurxront1ole mi3ildlsDrl(mpnu4alxnif iatfmtranei;() 2urir iy1olenmiciat s2taum ;u4tpxn fctld s em(mo;u0teenifcoydfptrln s;s)srur(m nu4lme mneiltf Dtmurpnu0oee  ieiltfm2ean on() lenxf iatopDeaivilt srxmxopnydlltemfviltfa2rr(r ;t0texn oeilsls2rmn o u)trxnifcty1fm  lnes t)seuo(mpiodlp  mnvtas arua(mp;t1optn ieiatlmDuanmo (4alxnmr3totfa  lnei s)t2umxr3iu4ll  lnctls arum(mpno0oeeomfeildfs2rlnmp t0areomf ta1omt auvi (0sexmxm3ny1ap  mnesa(farrr( pot1ope  i3iyd s2ranmpnu)tetnxf3oa1fpt  n ilt)teuoimpnu1altelfcta( srrmxm oo4texnmociadfa emn p t4 etrifciy1lptr neo;t)srtmio iodapee ncsatf Dua(monu4oex io3ilslm2uauvon() lerxr iy1oa ean s;s)sexmio ny1omte icsat aDurxr no0teeomictldls2uluvs t4 ltnifcio1oaDr neslt setrimpnu1al elnci s artrxrpot1tlt mietat s rlumont)arxrxr3oo1oat  u o s)tetoirpiy1lltemfcs s)a2urxr oo1teenmoeild s ra( on() lerif tytla  li o;s0t2toir oy1ame  nvtatfsDtrum nt0oex if3ilt mDumuvs;(4trtrircoy1fmDrluvsl(0 exoxm nu4optnmnvs ( a2tmx ono4tlxnmi3tltfa2emnvonu) ltnmf iatlpD au i;s) exmim3oy4lptemncta()sDrru pnu0teeo i3iat m2ea( sn(4 eenmociotlp  luei t) eumxo io4ol emfcil(f Dra(m ;u1oexo fctls a eanmp;t4tltomocta1omD  ivo;t  2toiopiydol  mnes tfsDumxr oo0altoio3iatlm2rlu snu) renmfciy1lmDe ues;t) exm(opio1lme liei ()sDrm(  ;t4olen f3ilt a um(vo t4 lerir3io1om   iei;s  eum(m3nydlmtelnvia(f rtmumpou0apx  iciysfs2eanvonu) reomf oadoa elueo;s  rxrirpiu4amenmivsatfsrrr(ront1tlt mfeiytfmDuanmpnt) etniocoadopt li s;t tetm(o3nu4al emncs t sDurx pot0tlenioetad m uaumonu4arxoio todfatelivsl(0s2to(mpny4lmtelfeil( aDrrxr nt1olx ioeild s2rmuvs (0 eenmo oy1oaD  nvils0 2xm(m3oudoptnmfciat)aDumumo;o4tle io3iytfaDem(vsnt4 eeniocootlm eaivs;s t2to(o nodolt mfcsatfsDur(m ;o1oeenmf3ilsfaDrmn o u) rxomo3oadom  an o;t) rxmxr3no1optnmfcslsfaDtaur ;o1tltnifeiasfmDrluvsn()trtrxfctatopDe uvsl()s2xoim nydlme  fcsl(fsrtm(mpou1apxo oeiysfaDum( ont4trerir iadoptraieil()s2uo(r3iudopte netat  Duaxmpno4aexoioctadls2elnvp;t4arxoxo3ty1fm ean il()s2xmimpny1alenmnvil()arrmxrp;t4tptomfctytfa ulnvs;t)tlermociytomD au sl( trtm(m3oydolte feia() rtaxr nt4opxomf3iat a emums;() rxnxo oa1omDrauvs;t)srum(r3oo4openmiesls  rtru pou0tptn f3iysla umnvo t) rerifcoytfmD lueo (0 etrir3iodlpen fci ( arrru  ot1apto f3iat sDul( p u0 lenmo tatop raieil() 2to(r nu4lp e feslsfa2tmum oo4open i3iydlm ulu pnt0aeeomf3totomteli o ()trtrxmpio4lptn ict s a2trxm ou0alxo fetyt sDrau ont0artnxo oydlm eluvi;(0s2xmio3iu4om elfcia( arrrxroou4ope  oetatlm elnmsnu4 rtnmfcty1omD  ivo s s2triopiodlmte nciltfs2tr(rpot1tetomociyt m2ua(ms t)teerxf oy1optr n i;()trxmxm oydlle lnct t sDtrxm nt4olxomoeiatfa2rlnmpn(0trenxo3tatoaDeauei (0truoio3ny4lp  livsl() Dtmxr nt4tlxo iciyd mDrlnms;()aleoir3iy1fmt luvo t) 2toiopnu4omenlictl()aDrrumo;u1optomo3iydls emnmonu0aleniocto1lp  anvils  rum(r nydlltemfvil()aDrr( p;t4tee ii3iasfmDeauvo (4trxomfcoo1lpD au o s  etrio3oudaptnlics s aDrruro;t0tltnioctaslm elnvsnt4aeenxr iy1opDean i;s0s2xr(r3iudllt  nvia() 2urxmonu1tlen fctltla2eau pnt0trxnmo3to1lm rluei;()srtmir iodlmt liet s sDur( onu4olxn iciysls rln p u)teenmfciy1fpD anei;( srxr(opnu4lp nmfvi t)arumx pno1apeniietydfaDemums;(4 lenmrcoytoateau o t teurimpiu1ap nmiei ( sDur( pou1ale iiciyt s2rlump u4tetoif ty1oatraivo s texm(m ou4apeelfesa( aDrmu ont1oetomoetldfsDrl( on(0trtoxo3oa1lmDrlnvo;(0trxoxr oy1lle  fvs t aDtaxmpnt0aexn iciasfm ulu p;t0tetoif3iadfpt aies (  exmir3oy4altnmnci s a2ra(m no0tpx ii3iydfs2rlu o;t0trxnxfciy1latr ies t0s2xr(opoy1omtnmncias)s2umx pnt1ole  ociasfsDemump t)texrir ootoaD  uvi;s)seurir3nudaptemfvsa(  2umu  nu0oleo i3taslsDulnvp;(4 exrmociatopDr n ol(  eur(rpnu4ol elivsas  Dtmx o;o4optnioctldlm2el(mo;()aetomo oytlm  ln sls) 2umim oy1lmt  nvsls) rrrxmp;t0tex ifeiydlaDemn onu0 eerxo3oytfmtranvo;s  rxmio oydope lfcils) Drruroou4aleoiiciaslmDrauvs u4trtrio3oydfptraueo t) etrxmpno1optnmfvta() Durx  ;t1opxomf3tysfs2rl(vpn(4 reriociotfptr neo s) rxm(o oy4ol n nei s srua(mp;u4aet mfeilt sDea(vont0 rermo3oytoaD luvols0 rurxo3oo1ap  lfesatfsDta(  ;t1tpeoiieiltlm2rl(msn(4alxrxrciy1lm  lnesl(0 rurxr ny1lmte nvsls)srtaur ;t0tpe if3iydla rauvs;(0tltoxr3ta1op  lnvols  2uoir3iy1olt  nctl(  rum(mont1oexoiietlslaDuanvp;t4arenxfciatop rlnvs t)setm(r3oy4llenlnesls s2umu  ot0tex  o3tldfm2em( onu4 exoxociytlatranvols s2um(rpoy4lltemiet () Draxm ;t4oexnifciltla uauvont)trermf3iadomDeau s (  2xmxr3nudlme liet sfsDrrum ot4tlxomf3iysla el( o u4tleoxf3oa1fm rlivi (0srurim3ou1alee fviltf 2uau pou4tpxnii3tytlm rmump (0trenircio1oaD auvils0trxm(opny4ole  nvtas)srraxmo;t4oeenmi3tas sDrmu o u0tetoir3oydfm r i o ()texmxm3iydape  ics s)aDrmum nu4apen oeilslaDemn p (4trtrio iatfmt  nvo;t)srxo(o nu4omee feslsf 2taumonu0tle  feiatfs2um(vpnt4tlenxf3oy1laDeai il()tetoxr3nu1llenmnvsa()aruau pnu0oetnioctadfmDeau ont4tlenifcoodomt ln ils)s2urxopnydam   nci tfarumum nu4tle  ocilsls raums () reoio3iydfm  anvil( s2umxrpny1alt  nvt (f Drmxro;u0ope  fciasls2uanvs;u)artnxo3iydoptelivi;() eur(r3oydape mnvsat)aDtm(  nt4olenifeiad m2eauvs;u) exoir3iadfate ivo s  exr(mpoy1lpt mnvia(fs2rmu p;t0altoio3iyt mDelnmonu0 rtnxocoytopDelu s;t0trto(opno1ll  livsat)arua(mpno1ope ifctad a2elnmonu4 eenifctadlpD lnes (0sexrimpou1alenlictl()sDum(ro;t4apto feiad m2ua(vp u)arxnmo ia1lpt ln sls0 rtrio3nydlp n ieslt  rtru p;u1tpt  o3iydlm2ua(vp (4teeoio tydoaDrlnei;t)truoir nodll nmivsas  2umurooo1opx moctls a2um(vo u4aeeoif3oy1lp r n o s s2xr(opny4lmeemnvtl() rrax  no4oexn ociytla em(ms;u4 eeoio ty1om rau ils) 2to(m no4op  miei sfsrtaxrp;u1tetomfeiyd a ranms u) lxrmrcta1fa   ivols0s2xo(o3oudalt mncsl()aDtaxr ;o4tpto f3iltls2ran o;t) rxnif iodfm  ai ols0 2xrir oy1am nmfvs s)sDraurooo1tetn fcilslmDeln p u) exnirciydfatrlues ()setmxo ou4lp nmfetlsf rra(  oo0aexnifetatls2elnvpn(0arenirciatlpD lnvi;t sexr(m oo1omenlnci tfa2ra(r nu1tpen o3tatla2umumo;(4teenxr3ia1fpt  nvi s)s2xrio3oodame mieiatf rtrurpnt0alxoiiciytla uanvs t) rxrxocio1la  an ols0 rxmxr3oy4oleelivtat  2tr(root0aeenmfciytfa eln o;(4aeenif3iatfa elnvol() rxoirpou1ape  fcsa() Drr(rpnt0aeeo fetat a elumo (4 renifciytfa   ivols0 rxrirpnodom elnetasfarumuronu0ape mo3iydfa2ranmo;(4 etrmoctodla rlivslt setmio3nu4apee netatf 2urxrpoo1tltn i3iatfaDelums t4texniocoytoa e nvs;t) 2xrxopio4ap n nvtlt sDur(  ;o0tetnmfeiad s rmumo;t0 etrxo3oo1fpDr nesls0 exr(o ny1opeelfei sfaDuauront0opeo ocilslm2el( onu4tltoircoatfateanes s)trxrir3oydal  liet () rumuroot4tptomfctytla emn snt4areoxr3iadopD livols)s2to(m oudlpeelivsatfa2trurpnu1ope ifciasls ea(mp t0 lenxr3oodfmD lnes s)srxoxopiy4ol elncsa( aDumx  ou4ole ifeiatfsDeluvsn(4 rxnmo ootoa  lieo (0 exm(m3iy4lmenliesltfaDtruro;t0opxo ietld a uanmonu)aleoir iytfm   iei;(0s2xoxmpno1lme mncias a2ur( oou1teenmo3ildla rmnvp t0 exrio3iotfmt  n i;()t2umirpiy1ame lfcias) Dta( ont4teeo i3ias s2ulnms u0teenmr oatlpteliei;()t2xoim3ny1olenlieiatfartmu  nt0olen oetytfmDel(vonu)tlxrmf ta1lp r i ol()srurxo3oudlltnlnctl() rtaxrooo4apx mietadfa2eaums t0trxrif3iy1fmDr nvil(0 2xrirpnu1omee fcta( aDrrumo;o4opx iieiydls ranvsnu4trtnio tytlmtrliei;( sexmio nydam n nvil(fsrra( p;u4ape  fciyt s raumo;(4trtrxocta1lmt  ieo;s sruoxm3oodoleemfetlsfa2ur( ooo4tee  f3iaslaDra( p;(4 leoif tytoptrln i;s0t2trir3io4omee ncsas)a2uax oot4alxomietas m rau o u0tetnxo3oatfpDelu i s  rtoxr iy4oltnlfctas s2ua( o;u4tptomi3iadlm2ua(mo t0alxnif ty1op  au s t0t2xmxrpiy1olenmivsls) Dumx  ot4tptnif3iatfs el(vpnt) lenif3tytopDe ieilt0seur(m3oo1amt mfctlt  Dtmu ont4olxnmi3iadls ulnvpnt4arermrctydlmD  iesl()sexoxm no1om nmfcia( sDtr(root1oexo oeiat sDumu o t) exomf to1oaDe uvsl()t2xrxm ny1al elici s a2rm(m nu4oexnif3tas m um( o t4aexnxf tydoa   i ol() rtmio3iudal emnci (fsDum(  nt4tpx mf3ilsfm ua(vs;t4arxomrciodlatr i s;t)t2to(r nu4alt mfvsl(fs2ta( p;u4opxoiieiydfs2em(msn(0tetoxo3iydfmDelnvslt0 ruo(r nu1olt lnctat sDur(moot1tpt  octydfs2elumonu0 lxrio3iatlpt  n i ()sexmxo3iy1om n ietatf 2urxroou4tetnii3iytla2el(ms;u0trxoifciydoaD  nvil( sruo(r ny4optn fctlt  Duax o;t4alx mf3tasls2elu o u4 renmo3iodoaDelies t0sexoxmpnu1omt lictl( srumurp;t0apto feiltfs emn pnt4tltrif3oadlat  i o t t2toim iy4lpeemnet sfs2taurp;u1olxnmocias a um(vonu)alenxf tytfm ran sl(0 rxoxo ou1llee icils)aDrmxro;u1tltomo3tlsls2umn o;(4texnxo iodfmtraies;t)srxmim3nu4ap nlnctls arua( ont1oee mfcils a rmnvo;(0altnxo io1lpte uvi t0tetoxopny1lmtelfct () Drm( oou0oleo o3ilsfmDemnvo (0alxnif io1lmt  u s;t  2uoxrpou4ap elfct t)artaxmont1oleoiiciaslm2uanvo t4alenif to1opDr n slt)texm(o oo1op  lfci ()s2uaxm nt0alxn iciasfa rlu o;u0areoiocoadoa r ies;s  euoxmpnu1lmee neias sDtaumo;t1tpt ioctyd s rmuvo;(4 rxrmfctydomteai ols  exo(r iu4lpeemnvi s aDumxmpno4oltnifctlsfa ul( s;t0 etrio iytfpDr ies;t0srumir3iodome licia( srtaxronu4tpxnmo3iatfsDum(mp;(4texoxo ia1laDe u il(0trum(m3iu1apenlfeils) Drm(  oo0alt ifeiyd aDrlu p (0altnmrcoydoa rai o;s  eurio iydol  lieils) 2umx  ;o1tee  octadfmDra(vsnu)alermfctadoptran ils)tetrimpiy1lptnmfet t s2ururoou0tltn o3iatfa2ua( pnt0 lxrxf oo1lm rlueilt)t2toim3iy4oltn ics ()s2um(rpoo4apxnio3iltls uan on(0 ltoxrcootlaDr nvo;t0 2trxopoydol n ivsasfs2tr( o;u0tlt mocias mDul( on()trerircty1lpt aneo;t0truoxmpio4lltelicilt s2tmxrooo4ale mfeiatfa rlnvp;u)areoir iytoat  ies;s0 etoir3oy4oltnmfet tfa2trx  nt1aptomfctys sDel( o;u0aetrxf3iadoaDrlnvs;(0 rtrim3no4lpt  nesl()sDtax pnu4tpeo oeiasfs2ea( s t)tetomr iadfm e i o;t sexmir3oo1alt mneslsfs2um(rpno0aexn feiadls ul( snt) etrio oatfmDranvslt)s2um(r iu4ape lfvs (farrauro;t1openmf3iyt mDul(msnt0aeeomocoodfpD  n i;t0trtrxopio1lle lnetlt arta( pno4olt mocild a2rmuvp;u)texoxfcoodopD  nei (0t2xoim io4altemfvtlt  Dtau p;o1tpxnmfciltlm emnmp;() lermr iodomt  uvsls)srur(o3nodal   nvia()s2tmum nt4aleoifeild s2ea(vsn() eeomo3ia1om r nei;t s2uo(r nu4amenlnctlt) rtm(r ;o0tlx mi3tyt s umu pnt0aeenxr iatopt lu s;(0 2trio3oy4lltn ieilsfa2rmxrono4oetnmi3iadla rmuvpnu4arxnir3tadoaD lnei;t t2xm(m3io1ape  fvslt aDtmum nu4tleoio3tls aDrluvs u4trtrmr oatfpte nvi;s0 eurxo3ny4lmeelicilt)arrm(  nu1tle iociat s2rm(vo t0aleomrctadlat anvols trxm(mpny1apeelfvsl(fartau  nt0olt  f3iysfsDumuvp;u4alxomfctadoa rlnvolt  2xoxm3ou1olee ivi ()a2raurpou4oeeo fciytla rluvo;t4 rtomr to1oatran i t)texoiopiu1amt  iesat  2um( pno1opx mi3tltfs2rmumpnu4alerxocoytfp  aues s)t2umxo3no4om nlies ()aDtm(m ;u4teto ietatlm ranvo;t) eeomo3iadfpte ivolt)trto(m oy4alenlivtls a2raur oo4tpen octydls2uau s u)tltrxr3iodlmtr uvs ( srxr(o io1al   fvta() Dtaxr nt0tpxn oeilslaDrau pnt4tetnmf3iatlateaiei;t)srxoir3io1ol  lfetl() 2rru pot0altnii3iltls umnmsnt4aexoxfcio1lmDe u o s tetrxr3nodlp elnesatf 2ta(r no1texnifciyslaDum( ont)trxnmfciy1oa eliesls0 etm(r nodlpeelfvsl(f rrmu p;t4tee  fciat aDelnms t4tlxrio oydoatelu s t)t2uoxo3ou1ap   fvsl(faDra(r ;t4tlt iieiasfaDuauvpnt0artrxociadfp raiei;s0setrimpiu4lptemiesl( sDrr(mp;o4teeomoctadfm umu s t) rerif3oo1faDrluvo;( texrxo3nudalen neil( aDtmum ;t4open ictasfm ul( s (0teeoif tadfp  lues;(0 2toxo3iy1ll   iviat s2umur nu4oeen feildfa2uln snu0 rtnxr3tatopD  n ils0 2xoxo3nu1lmtelnctasfsrurumpoo4olxnmictatfsDrmnvo u0 eeoxo3iy1om rln s;s0s2xoir iu4aptelietl()srtrum ot0openii3iyt s2ulumont4 rtnxo3tytlptraivol( t2urio oy1lle livtat) 2taumpot0apt mfciyt sDelums t0aexriocoatlmtrlnei;( s2uoxmpoo4omtnmfei ()sDuaumpno1oexnmo3tlslm umnvsnt)artniocootfatr ivo;t trxm(rpou4apenlfciatfsDum(mpou0aeto i3ils sDrmu p;u4aexnmr3iotfpD  n i;t0teumir3io4altelncilsf ruru  ;u0tleo f3iysfs2ua(vo (0trtrircoa1lptran il()s2um(m ny4omt  fvia() Durxrpoo0tle ifctasla2emnmsnu0trxoio3to1op r ies;s trxoxr ou1llt  ivsasf Duaxmp;o4tptnmfetysfs2ea( o u4 rxoxocoytoat  u i;(0trxoir3ou4apeelnes tfa2tmx  nt1aleomoeiadlm2ulnmo t0trxoio oadla ean o s  2tm(o3oodll   ivtas aDurxrpnu4optomfctatfa ulnms (0arxrmf tatomD lueols0sexo(mpiu1lmenlicias)s2ua(mpou1oeenif3tlsfs2rauvs (0trermo iy1faD  nvs;t)t2urimpoydomteliesat sDum(m nu0texnifetlt aDumnmp ()texrmocto1fpDe uvsls0srum(m3ou4ame  feil() Dtmur ;o1tleniociydlmDulu snt4 rtoir io1lpD  ueo;t0trtr(m3iydap nmneiltf rtrxr oo0apt ioetyt m eln s t4 exrxr ty1oaDranes () rxoxm oydlm elicia(faDurxmp;u0opeomi3ias m emumo;t0 rtnmr to1fp  au s;t)trto(o iydapt mncsasf rtm(mp;t4tlxnifctas sDrm(mo t0trtnxr3oatop e ivils  2umxm iudal emnci tf 2um( pot0tpxoiieias a2eauvo;u) lxniocoa1lat lu sls0srtmio3iy4aleeliesa(fsrtaurpou0oltn o3ilsfsDuau ont0tleoxr3ia1lm rlivo;s s2umxm nudlm  lneslsf rua(root1tet ii3iytla2rlnmsnu4 eerxr3todlpDr uei;s seumirpiy4llen fvi t)s2tr(mpoo4oeeniictys a2rauvo t0tleoif3oadfa e neol( trur(o iu1lmtelfcta()arra(mpnu0alen octytls rm( pnt0trenmfctadom eanei;s  2uoxopiodame lnvs s aDrm(ro;o1oetomfciad m ra(vpnt0 exoxr3io1fmt ln s ()t2xr(m nu1lp   fesa( aDum(rpnu1opxomieiydfsDemnvp;u0tlenmr3tytlm ean s t t2xm(rpnudllee ictl(fsruaurpou4tlx mfetas a2ra(mp;t4arxrxociy1lptranvo;t srumir io4ame mfcta(fsDrm(mpoo0tptn feiyd s rlnmont)arxrxfcootlpDelies;t t2urim oy1olenmfcs s srum(m ;t1olenio3iydfsDumump;u0aeeoif3iotlp   n ilt tetmxmpoo1lpeemieslt srrm(mooo0aleniiciysfaDulnvsnu)aetnir tytoa   uvs t  2tmirpny1altemnct tfarrr(r ;o4alenmfetadlm ulnvs;(0 exrxr ta1fp eaueil( s2um(rpoy4lltnlfcil()a2rr(r nt0aetnifctadfs2ea(ms;() etrmr3oatfaDr ivs;s  rtr(r3ny1omte feslt aDuau o;o1oeto o3ilsfs ulu s;t4arxrmr3iy1fatrlies;t srumir3iy1om nmnvtls aDumumooo1tpe ioctlslm ra( s u)trtrxrctadlp e ivs ( sexmxm3iu4altemnctlsfs2tax ono4tpenii3tydfs2uauvo t4tltrirciotom   uei () rtmim3no4al  lici t) Durxm nt1aet iieildlaDulnmsnu) rerio oo1fmD lueols) etm(m io4lle lfciasf Durxr ;u0tptomfeiyt s uanmo t4arxnxfctytlmtrlu i (0t2uoir ou1lpee icsls)srrr(mp;t1tpx ifetytla ea(vs;u)tlermo3iadop   neslt  rum(m oo1alt lneslt  2rmx oot1tee ii3ildlsDrmn s;()texnif ta1om eluei s)seum(opoy1ame lnvi tfaDur(mpnt1oeto fctad m2rlu snt0tltrxociatfpteanvs;() exmxm3nudal nlfvsa(fsDrmxroot1alxniociltlaDeaump;t4 rxoir ty1fp e n i;() 2trir iu1om  mfvs t) 2trxmonu1apx  ictlslm2ra(vo;u0trerircoatfm  aieo ( tetrim ou1op  mnei t aDra(mpnt0oetnmociytfs rmump;t4tlenmrcoadlp eauvo (0teurir3nudale  fvt ()a2ra(r nu1tltnmfcilsfmDumnmp;u0arermrcoy1fatr ivo;()texmxo3iudolenlnvils)a2trx p;t4aexo fciltls el(mont0aexrmfctodlp eln ilt trtr(m nudlpe lfesls arrmxrpnu4tlt moetat aDumu s;(0 lxnif3oodoa e nvo (0texmxo3nydam e fvt ( s2rr( ooo4tetnmocilsfmDrmuvs u0 lxrxfcia1opt ai s;( trxm(mpny1ll elivsls) rumxr nu1olxomfeiydlsDrlumo t0aeermo oo1fp e ieil()seumio nydolt  fes sf Durxm nu4altomictys m eanvs;u0 etrif3iy1oaD  uvi;t)s2to(o iodomee fvsat)s2ua( pot0aeeo o3iatfmDelnmo (4treomf3ty1lm e nvs;s)s2toxr oy4ol nmfcsls)srumumono4ale  i3iasla2eaumpnt4tlxrir oadfpteaieils  etoxm3ou4ope mnviatfsDtmxr ou1olxnmocildfmDrl( sn()arxoxf3oytla e i slt0srxmxr3oo1lpte ies s) 2uaxmp;o0tpe  ociad s elnmp u4 rxrxocoo1fatrau s s  2umim io4lp  lics (farra(m no4teeoif3ildls2emnmon(0altriociodlm  lueo;s)t2xrxm nodomtelfcia()srum(moot0ape mi3iatfa rl(vo;(4tltnxf ta1opD  n s;s0texrxo nudamtnlnesas) 2ra(m ;o0opxomi3iyd s ranmo t)aexnmrcoy1fpD luei t  exm(o oy1ap  lieil( a2raum ;o0opxomociysls rlnvo;u) rtoxo3oy1fmDeanvo s0 eurxm3nydape  fct ()sDrm(mpnu1olx if3iatla ran p u4 exoircio1fa e ueo;s0 2xmimpio1altnlnesa() 2umxro;t4ale if3ilsla2elnvp (4areomfcoodlmtranvo t0truoxo3no4om nlfvt t)arrrx oot0tpt mfctlsfmDulumon()aexrxr oa1om r nvo;(0t2uo(o3oodomt  fcsasfaDta(m ot1aexo ictltfs2ulnmsn(4aetnio iydlpteanvo;s t2um(rpny1op e nvta()srtauroou4aeeniieiltla ua( p;u0 rxnmr3oytlate nvol()srxr(rpny1oleemnetatfa2tr(  ou4tlxnmi3ilsla2ea(vs ()altoxociadom e n ilt0texrxo3nu4lltnmivi t  rra(rpou4opxoiiciatfs2umu snu4tlermo oa1fatelivo;s trtr(o no4amen ieil( aDumx pot0opxoif3ilsfsDumu p t0treomr3ia1opDrauei;s  rxriopiu1altnmics t)srtrum ;o0apx iieiatfmDuanmp;(4tetrxrciotop raiei s0t2toir3oy1altn ivils  Dra(  ;u1alenmfciys mDeaump;u)alenmr ootfm   uvs t seurim3oodlleelics ( aDrmx  no0tlx ii3tatfmDemnmo t0alenir oo1lpD  n sls0 2xo(r3ny4al nlnvsatfa2tax pno1oee mfetydlm rl( o;u0 lerio tytlpDe uvo;s teur(m3ny1omtnlfetl(fsDtmxrpou4tlx ioetatls2el(ms;t0aetrxr oatlm ranei (0t2xm(mpny4ale mnesl(  rum( oou1texn ocilsfsDuanms u0 ltnmf3ta1lmt luvi ( tetmxrpiy4opeelfcia() 2umurpot1alx  f3iydfs2ea(mpnu)aetrxf io1opDelnvs s0t2xr(m oy4lm elnvs t) 2tmu p;o1tpxn fetydla uan onu4 rxoxf3oytop e n i;(  2toxr ny1amtnlnetlsfsrumx  nt1oeeoif3tadlmDeanms;u0altnir oodfm r u i;t setr(r3nodlmenlfciltfs2rru pnt1apx mieiadfa rm( s;(0trtomf ootfpDr ues t t2trir io1ap  lnvt () 2tr(r ot1oexoioetat aDumnvp;u0trxnmo3oodoptrluvo t)texmio3ou1optnmfesls  rta(rooo1tlxnii3ias mDeln s;t4tlxoxo oatlaDe u o (  exmxopnudll nmiet ()a2ururooo0opt  oetadfaDrmn s;u4artrxrcoydlptr uvi;s0teumir3ou1oleemivsat)srurxrpnt4openmociltfm2rm(vo;u4aeeomr todfpDr nvil() 2toxopnydlmt  iet tfa2rr(ro;o4alxoioctaslaDea(vs u0 lxomf io1fpt li s t seur(m3ou1om   fcsatfs2um(rpno1apxnmfciydla ua(vs (4 rtnif3tatoaDelues;(0sruo(rpnudlm  lics sfartr( p;u1texo oetaslsDemump t0 ltoif iotfpDe uvs;() etm(rpnu1opeelnei () Draumpou0olt mociasfm2rmnvont0artrmf iytlmD ai i (0 euoim3nu1ape mnei t s2tmx  ;o1aexn i3iatlmDuan o u4arxoifciatomD  ies s  rurxr3nudomenmnct (f Dtrxront1opxniocildfa2ulu p t4tetnmo3tydlpte ues;s)t2urim io4lm nmicsl(f rua( o;t1opxo feildlm rmuvp t4 etoir3oadlatrai sl() rtmxmpnydlltnlfvilsfs2trumo;t1texo o3iatfsDemump;u4tltnxf3tydlpteaivols0teumim3oy4lm  mneia(f rurx onu1tlen f3iltfaDumnms u) lerif3iadlmDelnvol(0s2toxmpnodopen ictlt arrm( pnu0ale  ietad m2eau o;t4tetoxf totoptrlivs s t2toxm ou4amenlfvsls)a2rrumpno4oeenmi3iydlsDemnvsn()aexrxf ta1omtrli s t0 2urxr oodlpe  fvs s aDtax o;t1aet  i3iaslm2eanmo;u4tlenxociadfaDeauvo s trxo(r3oodopenliesa() rtr(  oo0ale  ietltla uanmo;u0trxoifcoo1faDe uvolt)setm(rpnudam   ncs sf 2tmxrooo1openmfeildfm uau onu4tleoxf3to1op   i o;s)s2xr(m oydopte fcsl(f 2uaxrpno4tlx ioeildfa2ea(vsn(4tltnmfciotfaDrai s () etm(opiu1lm nlneilt) rtmxmpoo0aexomocild s ulnvp;u0trxnxfcta1lp raneo t sexm(m3io1lpe lfvs (f Dtrurp;u1texoif3taslaDem(vpnt)tlenirctadfmDe neolt)srxrir3iudom emfesls a2tmxmonu4alx  oeils a ul( s;(4texrxocta1fmt au s (0tetr(r3nydlltnlfet (faDtrxmpou1aleoii3iatlm umump;()aeeomrctotfpteln ol(  2tr(r3oy4om emfet ( s2uru pnu4apx  feiytla2elnmo t0alxnxo tadfm  ln ils0setoxo3io1am n nvta()aDuru pou4olxnmieiatfm2elnvs (4tlermr3oa1fm  lies ( t2tr(r3oudaptn ivtlt) 2rmxm ;t0oltnmoeiys m2rlnvo;u) rxrxf3oatfat  ueo;() 2trirpnodom  lfesat srumxrp;o4oexn fciyt a2rmnmo;t)aeeomf3ia1oat aueol(  rxr(o io1optn fciasf 2ur(mo;t4tetoiocild s2emn pnu0areoxf3oy1fmteauesls)truoxr3oo1opeelieils) rrrxmpnt4tpx  f3iltfmDua(vp u) exoxr tadfmDeaneo;t0s2urxo3nudllte nct (f 2raurp;t1oeen oeiyslm2rmnvo t0arxrxrctytfmt  nei t0t2toio iu4altnmfcsl()s2tax o;o1aleo fciyt s2rlnvs;()arenxrctadopDrlneo;t0 rtoir io1lptnmfci (f Draurpno4oetnmicias sDeanmp (4 ltrxf3totoaD  u o t0trtmimpoo4ol  miesl( a2um(mpnt0tetoio3iadfmDeau s u)alxoxr ta1lp e ivi;s0tetr(mpiodalt lfcslt) 2urum ;u0tlenmf3iydfs eln snt4 rtoxr oy1lmt lu o ( t2tr(rpio1ape lfcias s2tmuroou0oee ifcias s em(mp u4aexnirciotlp eln ol()texr(mpny1alenlfesatfaDta(  nu0olx  iciyd sDeaumont)treoio oydlaD livo;s0s2um(m ou1ome lneiatf 2ua( o;u4oetnmfcild m ulu o;t4arenmf ty1faDe u s;t t2toxrpou1lmt lncils) rrrumo;t1tlxnifctat m ul( p () lenifcio1faD auvslt)tetr(r3iydom nlivs t)a2um(r ;o1tltn octydls ean p t4altnif3iy1fm rluvolt0srumio ou4ome  nesl() Dua(m ;o4aleomietlt m2rmuvs;()alxnirctotoat au ols0 rto(o3oo4lmte ietat)aDtr(rpnu0apxnmo3ildfsDrl( p;t0 etomo oo1fp r nvs;t0 exrxm no4lme lfvsas)aDraur ;t0olxoii3ilt mDean p (4arxrmr3iy1fmteluvol(0texmim3oodol elnvtat sDtmurpnt4apxnmi3tydlsDuluvsnt0tleoxfciotfatean il( trxo(m3no1ll eliet (farrmxroot1tpx mictlsfsDuau s t0trenio iodfm  lueo;(0s2tmxo3iu1alen ieta(  Drr(r no4aleomfetasla2um( s;t)alerxf3oatfa elues;s0teur(o nudop  mieta(faDtr(r ;u4tlxoif3tldlm2rmumo;t)tltomf3tadfat lu s t0teum(m oo4op nliet sfaDtmuronu0apxomfeildlsDem(vp;t0trermrcoytoaDe uvols)s2tm(opoo4lm   nvs t)sDur( oou4tlxn f3tadlm eln o;u4 exnxf oy1oa  auvilt0truo(r iudomtelfctls s2rmump;u0tpt mieias s umn on(0arxnio oatfm  livo;t0t2xr(m3no4ole mfct t  2rr(r ot1tetomieiatfaDul(vo;t0alenxr3ia1opDranvs ( setm(rpoodaptnlnci s)s2taum ou1olxnmf3iltfm umuvs (0trxnmf3iydlm e n i ( srxmimpou4altnmici ()s2umur oo4oltoiietytla rl(vpnt4arenmf3iodfpteaues s srxmir nudolte nvsl(faDurum ;o4apx  fetydlsDel(vs t4trermf3iodfptrluvo;s)srtm(r3iy4aptn nes ( aDumumont4tpeo iciadfm2uauvo (0artrir oatlaD  n s s) etr(opiy4lm emncilt) Drmurpou1tee iietydls2rmn pnu4 eenif oa1op e ivols s2trxo3oo1amt lnvtat)sDtr(r ou4oeenif3iltlsDeaums u0trxomoctodla e ivo;s t2xrio3iy4apeemfeia(  rua(mpno0oeenmieilt aDrmuvs;u4artnif iatfa r nvi;t) etm(o3oydolte nes sfaDurum ;u0tpx  ociltla rmn snt0 eermr3tadfa   i s ( srxmio ou4lm  livt ()arrru pno1aexo ociadlm2emn ont)artoxr oatfm e nvi s0seur(m3oudop   fvtl(fsrum(m ;u0ale  feiytfm2uln o u0tlerxo3iydom raieol(0 2tmxr3oydllenlnvi t aDrmxrpnu4apxn ietydlm ul(mp;(0 eermo tatfmtran i;t s2xoxm3oo1olt  ics t)a2tr( ono1oeen iciadfa2em(mp;t4 exrxf iydoaDe ivs;() 2xr(m iodaleemfci ( a2rr(rpno0alxn ocilslaDumu s (4 renio iatom elieslt t2uoxopiudlme lictasfs2umumpoo4opeoiicilslm ulu o;t)aeeoxoctatfpDeluvilt) rtrxrpnudoleeliet s)srtmu p;t4aptoiiciadfa2rau s u4 exoir totfmD li i t)trtrxr nu1lmt lfctltfsrurxmont1tpen i3tytfs2emuvpnt0 lenmociy1fp rai o;t setoio3oy1ll   ict (faDtmu  ou0apenii3iasfaDuaumsn(4aexoifcoatlm raivs s0t2xoio iy1ap nlfcil(fa2uau poo4olx  ocild s rm(vs u4tleomr iodopD  nes s srxm(r3iydamt mfeias)s2um(r nu4tpxn fciatfsDrau s () rxoif3oy1oaD aieols) 2uo(r3iy4ap nlnesa( a2tm(rpnu0teenmociatla emnvp;u0 rtoxociatlatraneols  rxrimpiodamen ncs sfsrur(r ou1tpe ifeiltla2ea( o;() lxrirciydlmD  i i t0s2ur(opny4om n ncsl( srur(  ;u4alxoiietat m2rmumo t4tetoiocia1omD aues;() etmxr3nodlm emnvi sfa2rmu p;u4tee  icilslaDrl(mo u) renmf ty1lmtraneo t) exrir nudlpeemneils s2ta(  nu4tpxn o3iysfsDranvont4 exrxrctotfa   nvi ( tetoiopoo1lp e ncsa(fsrtauro;o0altoifctls mDumuvp;(0teerif3oodla  anvi s0trumxr oo1apeelictltfs2tmuroou4optn o3ilt m ea(vo (4arxnxrcoy1lpDeau i;()tetrir3iy1omtnlncsat aDrru p;u1oexoifetysfaDeluvont)aexnxo iodlp eluvol(0 euoxo3oo4amt mfcsat)s2rm(  oo0ope ifcils a rm(vp;(0tltnirciadlm e n s;s)srxr(m3ou1lm emieiat)srra(moot1tpeomf3iad s elump;() rxniocoatopD  neo () exoxo3ou1lm  lietlsfartm(monu4olenmiciys sDrlnms;u0trtnif3tytomt au ol(0s2tmxr3ou4oleemivtlt)arrm(r nu0texnmfciasla2em(mp u)areoircoo1oaDe u i;t t2xrio3no1lm elivtat  Durxmo;u4tlx ifctldlsDumnvp;t4artrif3io1fa raneolt)s2xm(r3nu4lme mnvs t) rta(rooo0tpen o3tld a2rm(ms t4alxoircoy1lpDeau o;s) 2uo(r ny1optelivia()srumurpou1oetnmieils m uln snu4 exrmo3oa1fa elu i;s0 etmxopoydop nlfeia(f 2tr(r ou1oeeo ociytls2umn o;t4aeenxrctotlmtr ivolt0s2uoio3oy1lmt  icil(fsDuaxm nu1apxnmoctyslaDuauvs;u4alenif todlp e n slt)t2to(mpiu1amtn nes (f rrru poo1tpx iiciatfsDemnmsn(0 rerxf todlpD auesls trtm(opnu4oltnlivsat)srururpnt1oex moctlsfa rlnmp;()texnmr iodfpD  ueo ( t2urio3iudol elfvtl( a2um(rp;u4ole mieiytfmDran pnt4tltomfctadoatr uvo;(  rtmimpnudoptnmfciasfsDuau ont0tltnioetad aDrl(vpn(4alxnmr3iodfaDr ivs;(  rumxm iu4aptnlieilsfs2ur(r ot1altoiictad m uanvp;t) eeoxrcoy1oa raiei s0 rumxr iudal nlfcsas)aDur(rpou0optn fciydfs rluvs u4altoxoctotlpt  ies s0 2toiopoy4oleemnci s  rraurpnu4oexnif3iyd s2umu pnu)tetnxr3io1omDrlneolt  rtmim3nydopt micsls)sruaxmont0ale mo3iadlmDrm(vp;(4 rermr3iydfaDrln i t s2toxr3nodlm nlfcs ( s2rm(mpot0aleo i3tasfs2elu snt) lermf todfa r ieolt)teurxr oy1altemnviat artmxrpoo1aee  oetydlsDuau s (0alxoio3oadfatrlneo;s  ruoio oudoltelnetas s2tm(mpnu4aexo octatla emuvo t4 ltnxr3oadlaDr nes t0teuoxrpiy1op elfviat  ruaur ou0tetnmietyd s ra(mpn(0aeenxo3tatlmDr uvs;s0setmirpnydllt  ieil( aDrm(mono1aee io3iydfmDrm(vo;u)tetnxo oo1lmDrlu ilt)sruo(m iodoleelfesls srra( pou1olt mfeils s rau p;u0aleoio iadfpDelivsl()t2xoxmpou4ame  nvtatfsrrru pnu4apxnmoctatfmDuanvp;(4tltnmfciodlmD aueil()texo(opiu4ll e fcs ( aDur( onu4oexo fetytls2eluvs;u) ltrmo3ootlptran sls)t2to(rpnudamenlietat sDrrx o;o1tltoio3iltlm uan onu)texrxr3iy1lpDeluvi;t  2xoio3no4op nlnct s)sDurxmp;u4olxn i3tyt sDrmn o (0 rxomfcio1om elivo;t)sexrim nydll nlfcsa() 2tr( o;t1ale io3iltfs rmnvs;t4 exrmf3todoat  u o;t  2xrxr3iydomeemfcsls  rur(  ou4teeoioetasfm2rm( o t)tlxnmrcoatoatrluvslt0trxmirpiu1omeemfesas sDraxmp;o1tle iieiltlmDem(mo t0 lerio3to1omDe uvil(0 eur(rpnydapte nvtlsfsDuaxrono1teeomietas m2um(mo ()teeomf3ia1fmte i o ( srurxo3iudlp nmfei (fs2uaxro;o4apt ifctydfsDum(mp u0 ltrxo3io1fp raivo t seum(o oo4oleemfvils)arrmumo;u4opx ioeias sDran s (0tlxrxo oytomt aiei t) rxmxopnu4apt livt t)s2tr(  nu1apenioeiatls ua(vo;u4aexrxr3oodfm rluvi;t0seuo(mpoo4lpen fvi sfsrum( pnt4aee iicildfs2elumo u0 rxnif3tytlaD auvi ( srtm(r nudlle  nctls)sDtmum nt0tlxo f3iydlmDumu sn(0altoxf3iy1fp ean s ()texmxr iodamtnmivtl(  Dua(mpoo4tpenmf3iytlmDua(vp u0texrmr oytopteli ol() rxo(m no4amtelfctas  2rr(rpnu4opx moeiytlm2rmu o;u0 lxoxocoo1oateluvs (  etrirpiu4ole mieilsfs2rrxr ;u4oeeomiciytlm eln p;(4texrmfcoodfmtr i o t0srxr(m ny4al  lnvtas  rraxr oo4aeeo icilsfa el( p;(0 rxrio ty1lmtrlneo (0s2uriopnudamt lfeiat)sruaxm ;t4tlen ieild a ra( ont4teermoctotlat auvo;s0s2uo(r3nudlp e ivsa()sDtrur nt1tlt mfciat mDulu p;()trerxr3tydfm  au il(  rtrio iy4apen fcsltfarra(  ot1aeeomoeiys a ranvs;(4texrmf3oy1fa ranvs;s) rumxrpoy4amte icils) 2ra( o;u0oex  fcilsfs2uanmp u0 rxnmocta1fa eli ol(  rum(opoydameeliviat)aDtaurpnu1tlxniiciatfa2ua( p u)aetoircta1opt aieil(0 rtoirpno1opte fesatfaDumu ooo4olxnmfeils m2rln o t4tetoircta1fpD a
\ No newline at end of file
@@ -0,0 +1 @@
+u i s0 rumir3iy1aptnlnvt s)arur(  oo4texnioeiys a2raumpnt)trermf ootlm  lieilt0 2xr(rpiudllee icsas aDrrumont4oexo ocils a rm(vp t4artomf3oo1fm ean i t  rxm(o iudlle  neslt)aDum(  no4tlxnmfciydlsDelnvs;(4 rxnifcto1omt anvi;s s2xo(r iy4lm nlietl(f 2uru oou1ape mieiasfsDum( o;(4 ltoioctydfmD lues;t)t2urxm iy1optnlieiasfsDrrx ont4tetoiieilsfmDumnmon(4 exrmf3oo1opD au s t tetrxrpny1apt liet sf 2tmxrpnu4apxnifetadlmDrlnvs t0 exnmocoadomtr n o;s) rtm(r3oo4apt  fvia()aDuau p;u1aex  ociasfa2ulnvont) rtnxrciydla   nvi ()srtoim oo4apeelfcsa()sDtmu oou4aeeo ictad s ranmo;u4 rtnxf3tytlp  auvolt0 2xrxopoodlptelfeilsf 2rmurpnu0open fetlsfm2rmump t4texoifctytfat anes t0texr(r3ny4open nvtas  2uaumpou0aex mietas m uanvp (4artoifcia1omte nvi () rumxr3iudamenmivt t  Dumur ;o1aeeomietydfa2rmuvo;u4arenmfctodlateau i t  2tm(o3nu1lleemiet t)s2tr(  ;o1tltnioetlt a um(vpnu4artnmo3ta1faDrlu i;t  2tr(m3iodap e fesls)srrmxmoou1ole iietltls uln o u4 lermociadop e nvo s  exoxm nydllenmfeta(faDtr( p;u0oex ifciytls2rau p;t4tltrio3iydomteanvsl(  rum(r3oodamenlivi ()sDtaumo;u0alt ioeiyslsDumn p t4 rxnmo iy1lpt liesls0tetrxo oy1ol emfvilt  rrax pou0tpto feilt a2uanmp u)teenxf tydlmDeli s t0trxmio3nu1ol n iesl(f Dururoou4tlto ictas s eluvp u)aeeoir3oadlp eluvo t s2uoxopoy1open nesls arrau o;t4apx  iciytla em( o u0 exomrcia1fmD  uvi s seum(o oodlp  mfei sfa2trx  ;o1tleoiociltfa2rl(mp t0aeermr3ootfpD au s;( t2trxrpou4ome  nviatfsDrrxmo;t0oexniiciysfa ul(mpnu)aeenmrctadlpt an ils0seurim iu4opt mfcsat a2rmu oot0oetnmi3iysfs emump t) rtomrcoydop eanesl( sruo(o nu4oltnlfctl(fsrrrxmo;t4texo oetls s rmuvs;() leomr3oadfmt an i s)srurir oodomt lfeslt a2urxr ou1aptomfctad mDem(mo t0teerif io1fate n o t0 2tmim io4altnmnetasfa2taxrpot4tetnmf3ilsfs2eanmp;t4tltoxf oy1fm  luvi;t0texmxrpny4apeemfctl()aDrax oou4teeomfctlsfsDeau pn()aeeomr3ootoptrlueslt)t2urxr iu4ap n fei s aDtmur ;o4tleomf3tls mDrluvsnt4teerio iotlpt lnvs;t seurim oudopenmiei (f Dtaxmpot1ape mocildlm2rlu p t4tlxnir3tatoa rlnvi;s0 2xmiopou1al elietat arrm( poo1tlxnifctaslmDrmnmo;u0 lxnmf3totfp  luvol(0 2urxmpou4ap e nvt s  Draxmpnt1teenifeils sDel(mp t4 lenmo3iytlm rlieo;( seuoiopny1alee fvi s  2trxrooo1tptnmieiydls rlumo t)trenif3tadlm  lnes s0srtm(o oo4amt livs () rururo;u1open i3tat mDumu o;t4 lxnmr3oy1fmt ai o;s0s2ur(o iy1lmtnmivs t)s2tr(m nt4texnii3iltlsDrlnvo t0trtnmo io1opt  nes t0s2xmxo oydam  mnetlt) 2uau o;t1tpe  ociad m raumo;(4aexoxr iydfpDe i o () 2tmxo3iy4lme  fvs s)s2tax ooo0teen o3ias m2ulnmpnu0tlenxocty1lm  ln ol()s2trim no1lpt  feiasfs2trumono0opx if3iadls ra( p u0arerio3oo1lmDeauvi;( s2umio nudlm   ncils) rra(r no4oet ifcilt s2em( s u0alxnmrctatom eln olt)teurxm oy1lmtn fet ( sDrmxmont1ole  ocias m rmumo;t0tlxnirciydlat  i i t  rtr(m3iu4llenmivia()arurur ;t0apxoioetlsfa ulu p (0tlerxf3tadfate nes;t0trum(m3oudaptnlfvia()a2raxmo;o0tpxnmietat mDrmnvo;u4trerxoctytlm eaivs t0 etmimpnodal eliei s)artaxmo;o0tlt  feiydlm rln p t4texoioctotfpD  nes;t teurxrpnodapte ieta(faDra(  no1tpe miciytfa2emnvsnt)artoxo oy1oat  ivs;s)seumxmpnodalen ivi ()srtmuroou1tpe ifciadla eaumo;u0tltnxfcty1laD  i o t0t2uo(m oo1om  mfci ()sDurump;o4tetomfeildlm2ranmpn(4 rxomf3iadlm   n il(0teuoxmpoodopenlicsl( srra(monu0optomf3ildla ulu s (4 reomf iadfpte ivs t  2xmir iu1ome  feslsfaruau pnt4olenii3ilt mDulnmo;(0arenmo3ta1fmtraneolt0 rxrxm3iu1omt lnvils  2rr(rp;o4texomicilt sDea( p;(0aexrif iadoptrauvo;(  eumim3iu1am nlnes s a2raum ou4tlt ioeiad mDem(mpnt4tltnmo3tytoaD  nvi s0 ruoxrpno1llt mfciat a2tmu  ;t1teeniictyt sDeanmp;u0teenmr3oodfp   ivols0trtmxr oo1alen neta(f Drmx pnu1optoio3ias m2elnms t0 rxoxr3oa1oa e n i;s t2tmxopiy4optn feil(f rua(m nu1oltnifetatlmDea(vont)tlerioctatfaDr ues ( trtmio3nudllte fvsltf 2rmu ont4altoii3iydla2emums u) eenif iytlpDrlnvs;s trtrimpnodopt lics t a2tmuront1apxo i3iltls2uau s;(0arermocoatfa  li s;t) 2uo(m nudamtemfvs s) rurumpnu1tpt  fctatfs2rl(msnt)trtnir oydopte neo t0texrxr no4lltn fesltfa2truront4opto feiyslm2rm( s ()texrmf iatfptelivi;t)s2trxr iy4op elfesltfaDtmu oou4apt mf3iyd mDrl(mont4 rtrxr3iadfp rluei t)trur(mpnodam emicsat aDrr(  no1ale mfctydls2ra(mo;t4arxnxf iadom elu ilt  exr(o3iy4lm e nvsas arur(rpno0tltnii3ildlm2eluvs;u0arxrxo oytlmD lnvs;(0texoiopiy4op n fvt ( s2taxront0oex mfciatlm rmuvp;t4texoirciodlm eluvo t0trur(m ou1al emfvta() Durxrpou4tetnmi3iadfm2eln s;(0tetomo tadoa  anes;s)tetr(m nu1apen iet t  rtm(r no1oeeo i3tytfmDrlump;t4teeoio3iy1omD aieils t2urirpoodllt  ivsl() 2umu o;u1oet  ieiysfa emnmont4 eeomocoatoate uvs t  etoxo3nodol  lfvia(farumx  no0opxo octad m el(mo t) lxnif3oa1oaDrai ols0 exrxr nudlpt lfeiat sDum(m nt4apeomfciat sDrau s u4aeeoif3todlmt  nvol(0s2toim3oy4lm nlfetls)sDtmum ot1ope io3tldfsDumn s t0 eeomo3iadlmDranvi;( seuo(m3oy1al nlnesas)sDua(mp;u4apeoiocild s um( p u0 lxoxr3to1fmD lnvi;s0setr(m3iu4ap   nvslt artmu poo4opt ii3iasfaDrluvsnu0 rerxo3todlpteli sls) eto(opoodalenmivias srraxrpot0apenmieils s2uanvs;u0teenio3ia1fmDr u s (0 etm(r3iu1lp n ies s) Dumxrp;u1tlxnmietysfsDean p;(0trerxf oy1fatelieo t)trxm(mpoodapeelncs (f rur(root4tpt  icildlaDem(vsnu)aeeoxf3iy1op r nesls) exoxm ny1lmtnlfesl(f 2raumpnu1tpx mf3iydlsDrmnvon(0alxrmrciatfaDelnei t  2tmir3nydom emnvsas)srurxrp;t1tet mociasfm uau o;t)artomo3ia1lpt livo;(0teurio iy1ll nmnet s  2tmuroou0ape  ociatlmDeauvs t0 ltoxr3totfatrlu o ( t2uoimpio1alt  neta() Dur( pno1optnmietlslm em(mo u4 lxoxr oo1fp eaues;t  2xr(r3iodal e ictatfs2tm( o;o4oetnmoeildfm2uaumonu)trerxf3oydfm eauvi s) etrimpny4ap   iesa(fartru o;t1oeenmi3ilt mDel(mo (4arxrio3iadfm elnvi;()srtr(mpno1ap   ieslt aDtmx ono1olenio3tydls2ranmsnt0trxoxf3oodoa  li s (0s2um(r3oy4alt lneiatfarrm(rpno0optoif3ildls ra(vo;(0tlerif iadfpt auvolt0t2uoxopoy1lltnlnci tfs2uaur no4tlx  f3iytlsDrln o (4arermf ootopDeaieils) eurimpnydll nlivt tfs2uru  nu1aexn feils s um(mont)altnmo iotop elivo (0teur(mpno1lmenmfvsa() Dumumonu4aeeomictasls2rau on()aeenmf oatlmDr i s;s0s2xrirpno1alt mnesa() Dur(m ot1tpxniociysfmDraumsnt4trxrxr3tadlpt anvi s s2tr(r3iodal e nctls  Dur(r oo0tpx  i3ildfaDeln s (0 eerxf tydlpD anvol()t2uo(mpiy4lpe  nvsls) 2ua( pot1apxn o3iadfsDrm( p (0 etoxo3oatfmt anvo;t0trum(o ny4lme  fvs s)artmxr nu1aeeomoeiatfm emuvo;() ltomf3ty1lm e n i;s)s2tr(mpoydap nlivta(faDumx  no1alxnmoeiys s2elnmont0aetrmr3iotfmDeaues;t)srxm(o3iu4lpeelict s) rta(ronu1oleo ictadla2ra(vs (4 ltnmo3iotfa   u sls) rxrxmpnydomte ivt () Dumurpou0tpx mfeiydfmDel(ms;t0 rxoiocto1lmD lnes;t0 ruoiopoudlme lfcils srtmxmpou4aexnmi3tydfa2rl( o;t0 lxrxo oatlmD ai s (0teurimpiy4aleemnvt (  2rr(m ;u4aexomfciadfs2elu p () reoir3iotlaD  ues t)sexo(r3ny4lltn icsls)aDuauroou4teto f3iysfsDrmn snt4aetoif3io1la r ivi;t)trum(m iu1ameemics t)s2tax  ;o4apx if3tas m rmuvo t) rermf3iytfpteln i t) euoirpnudlptelnes s srtax oou0alt mi3iadla2umuvpn()artrxf3oodom   uvs s)trxr(o3oo1lp   ivslt)aDta(roou1aleo oeiyt a2rm(vsnt0areoxr ia1fptrlnei (0 rxoim3io1llt mieils  ruau pou1apxnmi3iysfs2uaump u4alxnmf io1fpte nei;t seum(mpny4opteliciltf Dua(r no0tle iicildfmDemu p u4arxnmo3iydfpDeauvo;t)t2tr(rpoy4omenmfctls)s2taurpnt0aetnmictyt a umnmsnt0 reoio tadfm eanei;(0s2toxo3iydalteliet s)arurum ;o0tptomieils a umnmonu) exnio3ia1op   n i t0 ruoxopnodoptelict t  Dtrx ont0opx  fcils mDum(vs t0 ltnmo ootopDrai o s0 2umiopoudal   ietl( sDua(r oo1opxomi3iltfm2eln s t4alxrxf ootfmt ln i s) 2uoim ou1lltnmncta( s2rru p;o1opt  ieiydls rmn p t4tltrir todfmt  u i s) 2uo(opny4ome  fciatfaDtm(  nt1oeeomf3ilsfs2raumsn() rxoxr io1latran o;t)setoxo3oodameemnviltfs2tm(rooo0aexn i3iatfm2eauvp;u4 rxoifctytfatelu sl()srtrir oodoltelfesas) rta(mpot1aeeo fciltfa2rmuvp;t) exniociy1oat livs;s  2urio3iy1apeelnviat s2rrx o;o0oeeoii3tltlm2umnvo t0 exrmocoo1om  lneslt trtmxr ou1lmt  ieia( srrmxm ;u0ope mi3tyt a rau p u) lerir oodomt an i s  rxr(opny1ap elfvslsfsDrrxm oo4opeo iciasla2umumpn(0tlxomrcia1opt  uvi;()seuo(r io1op nmfctat) 2raxmp;t1alenii3iltls em( p u)artoxr3iatlm rlivilt tetrxrpnodlle mfctlt)aDtaxrp;o4texn i3tat mDrl(vo (4 lxomr io1fpte i o s) etrio3nodlmtnmfesat  Drmxrpoo0aexn iciyslm2rl(msnu) etnmr iadfm eln o;t tetrir3oo4alte fci () rtm(m ;t4alto ociad m ran s u4teermr3iadfp eai s;s0seumio3iy1lltnmfvi ()a2taurp;u1olt mi3iltlaDulnmsnt)tetrxrctydlmD ln olt)t2uo(opou4apeelfcs t) rrmx pou4ope  fcilsfaDemn s u0arermr to1laDr i o;t0trxmxmpiodll nmnvsa(fsrrr(rpnu1oeenifctyd mDrl(mp (0artoirctotfp raueils0 etoir nu4ol n netlsfaDumumo;o4texnmi3tytfa2emnmp;(0altrxrciatlm eluvs s  eur(r ou4am   iciat)arrrur ;u0tpeomocildla2ulump (0tlenifctydomt luvi;()srtoim3iodlp  lnvi ( srta( oou4opxnmf3iat s rmu o;u) ltnmfctadfpDe i s t)seto(r3oudlp   nviatf rrmuro;t1tpen oetys s2rluvsn(0artnifciatfpD anei s)trumimpoo4ole  fcs (fs2rax ont0aptomoctydls eaumo () exrif tytfpDeli o;() 2umir nu4olen ivtl()s2trurpoo0ope mociasfm2elu o (4altrio3iodopDrlnvo s)seuoxopnu4lltelncsa( aDraur oo1tlt  fcilt sDrmnmpnu4teenxr3iydfmD lies () 2uo(mpiodolt  nvtl(f 2tmumooo4olx mociatls2uan s t0aeeoio iadlpDe ues;t)s2xmxr oodlpee nvs () 2tmx  no4ole io3iatfsDelnmp;t0 lxnio oadoat  nvo t)s2trxo3ny4al  lnvs sfsDtrurooo1tltnmi3iatfsDuanms;t4aeeoxf ia1la rliei;s s2xmxo3nu4lle lfctl( arur(r ot0aeenmo3iyt s rlu p t0altoif3to1fm  auvs s)srurxr oo4lmtn fcsatfsDur(m ;t0altomi3tldfa2rmnvp;u)teerxr todlat au i ( s2uo(mpiy1alee ici tfaDurxm ;t0ope mieild aDeauvonu)aeeomo3oadlptelnvi;s0srxrxr no1oltnmfvt t) 2tmxmp;o1oltoifctysls2umn p u)trxomr3oydfmDelu s t0seum(o3iudllt mfes sf Dtmx  oo1apxnif3tlsfm2ra(vs;u) rxnmf3iodfmDraieilt  rxmxm oudlmtnlici s aDtaumpnu4tetn f3ildfm2rm( s;(4tetnmf3ia1op elivslt tetmiopoydal  mncsat a2uau ooo4aee  fctltfs umuvsnu0tetoir3oadopDraies;s t2urio3oo4lle mnci (f Dur(  ot4tleomfetltlm rmu o u0tetnmo3tatfmt lu o;t) 2toim io4lmee nvias arum( p;o0tlt  ictyd aDrmn p;(0 rxnmr3iadfat lu ilt0seuo(r oo1lmt lfeslt  Drauroot1tptomfcilsfs ea( on(4 leoxo tydfptran i;s) rxrxm3nudal   ivias)sDra(mont4oleoio3tadls2rl(mo;t) lermr3oa1la r nvo s) euoxr3oy1lm elfetat  rrrurp;o0apeniietyt sDumumo;u)tltoxociodfptr nes s trtoxm3no1optemivtas) 2um(mpoo1texo ictyd mDeauvpnt) lenifcty1lpD  nvi t)seumxr oydlpt mfvsasfsrrau pot4tex if3iytfa2el( o u0trtrmr to1opD aueol(0teumxr oy4omenmfetlsf rra( oot1tetoifctltls elnmp;(0teenxr3oytfpDrai o;s srumxopnu4oltnmicil( sDrrxmpnt0oltomi3iytlsDrmumo;t0aeenio tytom r ivs;() eur(mpno1omtnmivt () Dtrumo;o4oexnifeilt s2ulums () rxrmo ta1lmt  u o s0teuo(o3oodap  lncsat arum(m ou4aetomicilt mDrl( sn()aetrif ia1lm  aiei s t2toio3iu4lp emietls  2ur(mo;t0aexn fciydfa2uanvs t0aeerif totfmDraneslt) 2ur(rpoy4opt  ivslsfs2ua(rpou4oet ifeiaslm2eluvsnu0trtnifctatlmtr ues;t  2xo(o3iudlmt  ivslt)a2rmum ;u4tlxnifeiyd aDua( s u4 lxomrctotfp elueolt0teurio3iy1llenmnctltf Dtrurpnu4tltn ieiysla rlnmonu)arxoircoytlatrauvsls0tetrir iodomen net tfaruaur ou4oetnifctas m rlu ont0 ltrmr3to1laDr n ol() exrxm iudomenmfetat sDrax o;t0olto ietldfm eauvs (4areomo tadfaD li s;(0s2xoxr iu4op  mivtl( srum( pnu1oexo f3iasfa2rl(von()tlxoir io1om   uesls0t2xoio3oodaptnmncta()sDurx ooo1opxo f3iys s2rmn p (4tlenxfctydoa rlneo t srtrxopio1opte fvsa(  2urum ot4tlenif3ilsls umu s u0arerio3iydfpt aivil(0srurio nu1ap   ivtas srrau  ;t0alt io3iyslm umuvo;u4 rxoif tatfp e ivilt0teuo(opnu4lmtelncia(  2ur( pnt1tlt if3ilt a rau s u)trtrir3oo1fpteluvol(0 2umiopoudamt mfvs t)s2raxro;o0tetnmoeiad s2ul(vsnu0 rxnxo ia1opDe nvi (  eto(m iu4om e fvtls)a2taxmpou1aeenmfetatfa2rlnmo u4tltrmocoodfmDean s;t0teur(rpoo4lmenmivtl(  rumx ont4aetn oeiaslm2um(ms t4 exrmrctytoaDelu o s)srurimpoydapenmietls) rrrxro;o4aetoiicilslsDel( p;(4arxrxf3oadopDrauvi;s seumxr nudoptnmneiat aDur(m ou0opx ioetys a2uanms (4tleoxo3tytfp eauvil(0 etm(o3iu4ol e ici s  rtr(m nt0aeeomiciys mDemumon()tlxoif3tadfa  auvi;(0s2tm(rpiy1optnmfcia()srtm(m ;o0olx  fetadla2em(mo;t0artrircoa1fpDr i i t  2umio iu1apt  fcsls  rrm( pno0alx  ieilt a2ea( s;t4 reomfcia1fpDrlieo t trurxrpio1llt lfvi ()s2tm(mo;o1aet io3tyslsDeluvp;t4 rtnxf oa1lat auei t)teuoimpnudlpee nct s  2tru ooo1aeenmietld sDeau s;t0tltomrciadlpt aueo;s seum(opou4alt  nei t)sDurxroot1apxn f3tytfs emu p u)aetoxf3iytoa eaneil(0t2um(m no1optnlictasfsrur(  ot4aptnioctasfaDean pnt4 lxnmf3iotlptelueols)teum(r3iy1olt mfcia()srtr(rpoo0aeenioetadla ea(mpn(4 lermoctodfpDe i s;()t2um(rpoodlpteliei ( sDta( o;o1teenioeiad a2umn p t0altrir to1lpDelies (  2toxm oydaleemneia() 2urx  ;u4altniictldlaDel( p;t4trenxf oydfatrlnvo ( seur(m3io4ll   icsa() 2raur oo0opeo feiysfm elnms;t4 lxrif3tadoatr n s;s)setrxo3oy4altemictas) Dra(mo;o0apeo fciad m rmuvo u4 lxnxr3iytfmt  n s (  2xmiopno1lleelnvs s a2ra(m ;o0tlx  fciasfmDum(msn(0trxoxr3ootfmteaneols)setrxrpny1apte ieslsfsrtmx p;o1tle ioetasfmDrluvs t4aexomo3oydlm eai s s)setoxm ou4alt mfvs (fsDra( pot0apxomfciyd sDea( ont4texnmr3oatoa eaivils s2ur(o io1lpen ivtasfsrta(m ;o4aexnioeiysfaDuan o t)alxoxfctytfpDrau slt)srxoxr3iu4omenmivtls sDurx o;u4ope  ieiadlsDea(von(4alenmfciy1oaDe u o (0s2tm(opoy1lmeelncsa(f 2ta(mpou4alen i3iltfs2um(mp (4trtoif iadlm  lieslt0 rtoim3iu1ome  neslt aruaxmo;u4ape  ocilt m2ua(vpnu) rermo3tadfptrauvi;()srurxm iu1openmnvt tfaDtmxmoot0tlt mi3tlsls2uan o;t0tltnio iatfm rlu ol()s2tmio3iy4ome mnvi t)aDuaur ;t0oleoiociltls ulums;u4aeeoxfctadoatr n i s truoxrpnodale mncil( srumum ;t0apeomfetytfm rm( snu4tlxrxfcoydlpDe i o () exo(opnu4am   nvtat) rumumono4aexn ictadls uluvonu) rxomocoydlmtraivo (0t2urirpoy1om n nvsl()sDtmu o;u4oetoifeiytla2ea(mo t)altnmf to1om e n il(0srto(r3nudlp   netlt s2rm(rp;t4tpxomo3tydfsDel( p;u)alxoir oytla   ieilt)teumirpny1lpt  icsl(f Dtauronu4olen ictys s rmuvo;u0 lermrcoatom rlnvilt)trxrxm3iy1am nmivi s aDtru onu0apt mf3iysfa2rl( o;t)aeeoirctadoptelieol()setrim3no1lmeemfctltfaDrruronu0olxnmf3ias a2emnvs (0 lxrifcoatfp elies s0teur(m3oodlmeemncs () rua( oot4tle mieiyt s2elnmp;u) lxnmoctadfptrliei;t  2um(m3nu4lme  icsatfaDtmxroou1ape mo3ias a rmnvsnu)texnmfctytfpDr ivslt0srxo(mpiu1lp elfeia( sDuaxm nu4tlxoifetltfa eauvo;t)trxomo3oy1fa eluvilt0 rto(o nudam emfetlt srrrumonu4tlenifeiyslsDulumo u0 renxf iytfp e neilt  exrir iy4aptnlfcta(fsDrmur ot0tlt  feiyd a elu s;()arxnxr3oo1lmD ln s;t0sexrxo no1ap  mfcilt)s2raxmo;t0teeomi3iys a2em(mo;u)artoxo 
\ No newline at end of file
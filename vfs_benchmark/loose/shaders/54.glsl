@@ -0,0 +1 @@
+i olt trxrxmpoodopt  ictlt)s2rm( pno1altnif3tld s ua(mo t4teeoir iatopteanvol(0s2tm(rpiudom emncs s)aDrrx pnt4tpx io3iatfs2uln s t4 exniociadlateluvo;(0 rtrimpou1alt  fctas) 2trxroou1alt mfeildlmDua( ont0aeeomo tydfa   ivs;s sexmxm3nudllt  feta( a2tmx p;o4aee iiciaslmDulu pn() eeoiociadlatrluvs;t0t2tm(rpiu1amee iei s) 2rr(r oo0oeenifeiys m rau p (4texnmr3tytlm r i s t0 2xrio3nudlme  nvil(farua( pnt1aptnmfciad aDum(vp t0tetrif3oo1om   ieils)truo(o oydlmee ncs t) rurum ;o1tex iietltlm eanmsnu0alxnmo oa1opt an i;(  ruoxrpny1lmtelfcil( a2uauro;t0alt  f3tlt s2ulu s t)texoxr ia1oaDrai s;t) rto(r3ou4optelnvtl(farrrxmono1alenmieiasfm ua(vo;u) rtnmrcoy1fmD  i o t)sruoimpoy4ope  ncs (f rrmum ;t1tleomo3iltla2rlnmo t4alerif3oy1lmt  ivil(0s2tmio nu1opee ici (farum(rpnu0tpxo o3ilt m ra(mon() exoifctydlaDean ols0 rxrxmpou1ope mnet t  2rr(ro;o1texomieiyt a rau s;(0 rtnxrcoadla elnvo s trumimpny1lmtnlncilt s2rax  no0oetnmicils aDemumon(4tlxnmo3iadlm elnei;( t2urxr oo4lp emfvtasfa2taumpot4alxoifctatls2uln s;t) reoxf oatlm eln o;s)truoio3ny1am nlict ( aDum(  oo4aee mf3tlsfs2em(vs u4tltnxf todop  livi;(0 rxmxr iu1lmte fct s)aDtmu o;o0tpx mociatlsDrlumo;t0 rtomfcoo1oa  aivil(  exoxrpoydlmt mnet sfs2umum ou1apxn octadla2ulnmonu4 etnxo io1opD lies ( t2tm(mpnu4opeemncs t)sDrrumonu4texn ocilt s2rmnmpnu) lxomr oadopD livo (0seumxopnydll  mnvtat)s2ur(m nu1olt mociad aDeln on(0altomf oodfptranvo t) rxoxmpoudalt mfcsltf Dur( p;u4alx ifetydls ul(vs;t)tlxnxfctytlm rluvo;s  2xrio iydlleelnvil()aDrau  oo0alt iieiasfs2em( snu)artrir3io1omD  ivslt t2urio nu1llenlnct () 2ua( o;o0alx ifctlt s eanvpnu) exnmociotla eaieslt0teumir3iodome lfeslt  Drax pnu4tlen octatls2eau p;t0 ltnxo oatoaDeaiei s0trtoiopiu1amtn nci t  Dur(mont4olxn oetys m ua(vo;t4 exnir3totfmtelnvs;t  ruoim3ou1lpt  nvsl() Dtmu o;o4oexoifeiadfmDrluvo;(0tleniocootfmt lieo t)teumim iu1lmee ieiltfartr(ront4tet mi3ilsfa ulumpnt0tleniocoodomDean olt0teur(r3nudapenmfcsls) 2taumoou1tltomfeiyt a uanmsnt)alxoxfcootoaD  uvo;()tetoim no4lpe mncs s)s2tax oot1tptn ociadfmDumu pnt0teerir ty1op rln ils)seuoio ny4openmfeils) 2tmuront1tlen fciatlaDeauvs;()tltrxf ootlp ranvo t)srxo(o3no4ale lfcil()aDtrurpnt1oleoii3iltla rlnvp;t4texrmoctodfat  u s (0 2umxrpno4ome mfeil( aDumurpot4tee mfetysla ean o;t4tltoxf oo1omt anei t)t2toimpiudamtemivil( aDua(mooo0tlx  fctas a rmums;(4 lerif3ta1oa rlivo ()seumxmpno1lmee fei t)s2tmu o;u1teeoif3iad sDumnvpn(0 rtnir3ty1lat  neils0 2uoxrpoy4alt lfesa(fs2ur(mpnt0tpxomieiysfa um(mp ()trtrmrctotlm  an sl()texoxm3nudlpe lfet t)a2uru  oo0aetnif3iadlmDumn pnt) exnmrcoa1opDraneol() eur(m3iy4opt  fci (f Draum ;o4oeeo feiltlmDrm(mp;u)alxoxfcoa1lmD lneolt  2xrim io1am emivtl()aDur(  oo0tpxoif3tytfm eanmp;(0aeeoifcty1laDrln o t truoir ny1ol   fes s  rurum ;t4teeomoeiat mDuan p u0artoxociadlatraivs t0 rtr(opoo1ameemivta()arrm(mpoo0alenmo3tlslm2ra(ms t0tetoxfcty1opDe nei;t)srtrxo no1lmtemfcs t a2rmum ;t0aexoiieiasfa rmumo;(0 eerio3to1lpDr nvs ()srur(mpny4op elfet s)sruaxm nt4olxo o3iat m ran o t4aeeoxfctadfpDrauvilt0srxo(m3no1lp   fcta( a2tmxr nt0aetomfciytfs ea(vo;()tlxrxo3oy1fp   n il()t2xr(m3oo1lp e nvil( a2raxrp;u0tpt iicildfa2eaumon(4arxrmo3tadlaDrluei ( t2xmimpiu4lpe mfvi sf Dtrxmp;u4aexnifctlslm rl(msnu4artrmo3oatlpDraieo t) 2xmxm3iy4apeelfvi s) rtrxmono0tpt  o3ild m rmuvp (4aexrmo to1fa  aiei;s tetr(m oudam emnvtat)a2tauront4teeoif3tltfm ulnvp;(0 exrxrciytfp e ies;s)s2xrxm3oodapeeliet t sDum(r nt1aexomicildfm ranmsn(0 exoxrcoa1fpDr neo s) rxoxr io4aptelnvs (fa2ta(rpno0aleo o3iltfm umuvp t4trtnmrciodomtr u sls)trumxo oodole lnctlt)sDtaum ;u4tetn octytfaDrm(mpn()alenir todop eai il() 2xmio iodalte fcta( a2rr(mont1aetniictysfm umn pn(4 eenmr ootfm raneil( srxr(opnudole  icsas arra(mp;t1olenmieilsfm ran sn(0texrio ia1lmt lieilt)trtriopiu1omtn ieslt  Duax pot4aetnifeiltfmDumuvo;()trtrxr iy1fpDelivsl(  rxmimpnodlm emnctl(fsruau  nu0aeen iciaslmDrln pnt)artoio3iadla eln s t sruoxopoudlmt  neta(fsDtaumpou0opeoifetyt a2rmumo;(0aexoxr ia1optr nvsl()trtoxm oodomeelfvsl(faDra(mo;o4ale mictld a2ul(mo t) rtoiociytomDeluvo;t)srtrir iy4lm n fesl()srra(rpnt0alen o3tls m rmnvo;t4 rtoxf3oodlmD lnvsls srtoxopoy4opeelictas)srrm(m no4tptnmi3iytla2el(ms;t4 ltrio3oytoa e ivo ()sexmxopoudole  ivi sfartaumono0tpe  i3iydfm2elu on()alxoxr3to1lm eaueo;() 2uo(m oy1al n ivtls s2ta( oou1oeto fctlsla2umnvp t) lerio oo1oaDelu i;() 2tm(rpnodlm nmivtltfs2rax oot0tleo o3ils aDea(mp t0 reoxrctotoptr i i;t  rur(opou1am e ieias)aDraxmoou4oexo ieiytlm2ulumo t0 ltrif3iatfmDr nvs (0 2tmimpou4ame lieslt)arurx  nu1opxomo3tyd aDumuvsnu)tetrxocoa1oaDraivi;(0srtmxr ny1lpt  ivsa() Dta(m ou4oexoif3ilt aDeln p;(4 etrmr3oy1omt ln ols trxo(r oy1lmenmncsa( a2umxrp;u4aet moeild mDum(vs u4arxnio to1fpt anvo s)t2xoiopiodllen iet sfa2trumono1oexnifciat a eau sn(4 rxrxf iotfmt lues;t)trumxm3iudamen fcia() 2rau pno0tee  fctydfs el(ms (4alerirctytoa r neslt0tetoim3iy4ame  fcta()aDur( pot0altn ocildfm2ulumsnt0 exrxrcio1oat aivo;(0 rtoio iu4lle lnvtls aDumumpoo4opxo f3tlsfsDemnvp;u4tltrxo iy1lmtrai ol()sexrim iy1olenmfvsls) rtmxm ;u4oee ifciltls uau s t4tltrmf tatlpDe n s s) euoir3iu1lmenlnei tfarra(roou0aex mo3tldfsDua(vo u0tleoxrcoo1op eaues s)trxm(mpiodop n ieil(f 2trx p;u4optnmietatla rmnmp;u)alerio tatlpD lnvi;s0seumxo3io1ame livs (  Dumu  ;o1oexomfeiatla2rl(vo;u0 rxoxrcia1lp e nvilt0trtr(r3no1am emnetl() rurx pou0apt ifetat sDrmuvs;u) lxrmo3ty1fptrau o s srtmim3nu1am elfct (f 2tm(rpnu0tlt  feiatlmDrl( p (4aetrxrciydfpD au slt0trurir ny4llt  ietlsfsDrmxmp;o1aptoifeiad m ra(mp t4arxoifctytopD au s s0tetm(r3oy1apenlictl()sDtrxm ;t0optn fetldlsDrm(vs u4altoirciy1opt  uei t)s2xmxm iy4lle mivt (farrr(mpnu1apxnmicildlsDul(vsnu)tltomo3oo1fptelueo t) eur(r oodoleemictatf 2trur no0oet mo3ild mDel( s;t4trtnxfcoy1fptrlivo;( t2toxr nydap e iciasfartmxrpot4aexnmfeiltfaDranvsnt) rtnmocoatlp rluvi (0trtr(m iu4aptnliei t)aruaxr ot1aptnifciasfs el( o t0altrxr ia1lat ai s ( texmxr3nudlpenmfct s) Drmu p;t4oexomietltfa2em(vo (4arenif to1oat aieo t0 rxmxopiydlpeemfctl( a2tm(mo;u0aexniiciydfs2emnvsn(4tltnmrcoy1oatrlnvsl()s2xo(m iu1llte fvt t  Durxmpnu4aptnmfetytlm rmnvp;(4aeerio ta1fa rlueilt)setoxm3iudol nmnvsa(fa2tmx ont0texn oeiadlaDrluvonu0aleomo3tatoaDraieilt  rtr(mpoy4lmeelfctl(f Dtmur oo0aetnmocils m ul( snt4tetnmo3iytlm r uvi s)trxr(m3oodapt mics sfa2rrxrp;t1tpen i3tysfs emuvsn(0trxomf tydopt an s;s0 eurio3iu4op elieia( a2taurono1oeto f3iydfa emu p ()trxomo3ootfaDeauei t)t2urio3oy1lptnmfesls aDumxmonu1apx ifetys s eln s (0aexrxfciodlmteli o;t)s2xr(r3io1lptn ivi s  ruru p;u0optnmi3iatlaDraums;(4aexomr3to1oateaies;t)trum(o oy4ole  netlt  Dta(mp;u1aexomfetltlmDelu o t0 rerir3ta1lpteluesls)t2umxopoy4lmtemies s  2rmurpno0oet  fctadfs2ranmsn(0alxrmfcoa1oa r nvo s  etmxopiodap  livs () rrmumooo1tpx ifcilt s2ea(vo (4aeeoio3iatfaDeanei (0 eurir3oy1ll   nei s  Durx  nu0oleo i3iyslaDemu p () eerxr3oy1fa r uvi s) 2urir3oydaltemnvt s)aDtru p;t0oex iiciaslaDrlu p;(4tlenio3oatopDeai s t) eurxrpnu4lp   netasfartrxmpot4teen ocilsla ulnmonu0aeermr3iy1lmt lnei;t0srurxopnu1apt  fvsl(faDrmxrp;o4apxnmictltfaDemnvo t) rxoio oa1oaDrlivols  rtmxmpoydoltn neiatf rrrxronu0aetn oeildfa2emu p;(4aetrir3ty1fmte nvo;() eumxrpny1amtn ivtlsfa2rm(  nt4olxn fctad m uln pnu0texnxrctodfpteai o;()t2to(rpiy4apt miet ( srua( poo0alx ii3tysfaDeluvs ()teermf oydfmD aies (  2xoxm oy1lptelfvsltfarraurpnu1apx iieiad a2ua( s;u0tlxnmf tadom  lnvslt srxm(mpny4lme lfcs sfsrumu  no1olto o3iys sDea(vont4altoxr3io1oatran sls sexr(m iudomtnmnvsas s2umuront4tlt io3iatfs2el(mo;t)arermo todom  ai ol(  2uriopiu4llen ietat) Dta(  ot4apxn iciasfaDrmnmp u4tltrxociotomtelu i ( trtriopoudlmeemies ( arrmxmpno4tle ioetasfa2ra(mpn()alxnmr oatfp e u s (  2trir oo1olee fcil(fs2ta(  ;u4ole io3tys m2rlnvp t)tltnxf iadomtr i o;(  exmim ny4op   fvslsf 2rm(m no1tpxnifctaslsDul(vo (0 etnmr totlpDr iei s0sruoir3oy1al emneil(f 2ua(mp;o0tltomoctydla rauvo;() etrif ootoptelivsl(  exrir iy1opeemivias aDuaurpnt4opxn feiytfs2ea(ms;t4altomr3oa1om   neol( t2uoir3nodlltelics s)s2trur ;t4tpxn f3iltfsDuau snt) rtoxr ta1fm rai s s) eto(r3oo1amee fvsls s2trxm nt4tetoiociysfs um(ms u4 etomr3iotlmD anes;t  2trxr iy4ol   net sf rrrx onu1tpe io3iad aDea( snu0aetnif iy1faDelnei;(0setoxo3oydaptemfei t)srta(rpno1teenmf3ilsfs rl(ms;(4arenir3iy1lp rlivs;( s2to(rpnodllte nci (  Dra(ro;o4oltn fctydfa2ranvo (0tltnif iytlpt lueolt  eumxopou1om   feta( sDta(mpno0ape mfetldlaDrmu p t) ltnioctotoatraies;t)seto(rpnu4lmenlict s  rtmxro;o0oltoifetysla rm( sn() exnxfcoy1latr n o s0 rxoxr3oy1al e ncta() Duaxro;t1texnmi3iys m em( on() etrxf ootfmD anei;t s2uo(mpiu1lpenmfcs ( sDumumo;u0oexomi3iyslm ua(von(0 exrxrciatlmtr ues t) 2xmir ny1ol nlfvs () 2umu  ot0aexo fcildlmDrm(msn(4arenmfcoa1lpDr neol(0sruo(m oo4lpt miesas  rra( ooo4opxniocildfa uanmo;t4aexrir ty1fmD li s;s  rtr(rpnydlp nlfctl(fsDrrx ooo1apx if3ias sDrlnvp ()tltomf io1fmD ai s;t trtoxo3iu1apenmictls  2trx ono4tptnmf3tytlsDum( s t4 exomf3todlpte uei t s2xrxm iy4omenlnvsltfa2tmxrpou4ope ioetys m2um(mo;() etrir3iotfptr u slt0trxoir3iodamtnmfci s sDra(ronu1aetoiieiysfaDeanvo u4texoif3todlpDrauesls0s2um(mpoy4op e netls sDraxrp;u4tpto o3ildlm2eanvs t)trtnmr oydlpt auei;s) rxoio3nu4op n nctl( arum(rpot0alenii3tydfaDrm(vo;() exomf io1faDrau o;( s2xm(mpoy1ll emfetlsfaDtr( ono4oeenifciaslm2rl(mpnt4tltnxf iatfptrlies;s  2urio3iy4opt mfetls)s2tr(m nu4oltn ictltls2ra(vpnt4 rxrmr3ta1lm  au sl(0t2toim iodlm nmncs t) rrmx p;o0aetomieiyt a2rmnvsnu0texrif3ta1fp e n o;s)srxrir3iudaleemics ( srrr(mpnu0opt moctas m2ea(vo;(0altrmf oa1fmt  ues;t0 2xo(r ny1amen nvsat)a2ta( p;u4opx moeiyd a ul( s u)aeenxr tytlmDr u o s0 etriopoy1amenmnei (  rtrxm ou1opxnmoetad s2ua(vs;()aexoxo iatfa   i o;s0s2uoio iu1aptnmivsas) Dtrxmp;u4apen o3iyd sDrau o;()alerxrctadfpD ai i t)teumxopoy4ol nmfesltfs2uru pot1aex mfeiyslsDua( s t0 ltnmr3tytfpDrlueols sexoxo3oy1llenmnvils artrumpnu4opx iietyd s rm( snu0aleoiocoodfa   n ols sexr(m oo4ap  lietas sDua(mo;t1olx mo3ils m ulnvsnu4teerxo tadoa rluei;s0 2xm(r3iudll emnvs sfsruax p;o4tetn ieilsfmDea(mp;(0trxrxr ta1oate ueslt)setrir ou4apee nvil(  ruax onu0ope mfeildfsDeanmo t4 etomr todop eluei t)srurxrpou1amt mnetlsfsDta(r ;t1aeeoiieiys a ra(vp (4arxrif totfm  livo t0 euo(o3oydomeemfeils) 2trurpou4tlenmfciydfa rm(mp t4 rtomfcoadfatrlu ols srxmimpnudolenlivs sf 2tmxroou4oee ii3tysfmDrln o;(4alerif iotlpt lneols  eur(r nodalen nvia()srtmxm oo0oexniociysfmDumnvp (0 leoxf oy1lpDeaies;(  rxrxopnodlmt mieiat srtr(m nt1opt mf3iltfa2elu sn(0alxnio to1op elnvi;(0t2xrio oy1op elneta(faDtru p;u0tlxnmfctas a2uaumo (4tltrif3tytopte nvo s trur(opiydome lnctatfa2tm(roou0olen i3iydfa2ua(mo u)trxoxf3oy1lmt lneol( t2urio3io4amtemfcil()sDuaur oo1aleoif3iys m em(vsn()alerif3oatlp rlu i;s0s2trxopnu1ll emfctls sDta(m ot4tle  f3tas m ulu s u4tlxomo oadlmte nes t0sexoxo iudol  lfetl(farumurp;u4tpen fctltlaDrl( pnu)texnxf tydom  anes (0trto(r oodap e fcias  2rr(rp;t0tetoif3iltls2uluvsn(4trtnmf3ia1oate uei (  etrxr iy1op emiei tfsrum(roou0oleo ocias a2rluvo;(4tltomr3oo1oa rauvsls)trtoir3nodlme  fvs tfa2tr(ro;t1oltomfciaslm2eln s;t)arxnxr ty1omDr neo s s2urxopio1oltnlnvs ()sDumumo;u1opxnmi3iad a2emumo;(4 rtnio oa1faD  uvi;(0teumio3nu4oltn nvtl()aDrru ont1tlenmo3iadlm el(vp t0 etomo3todfatelueo (0srtmim3no1lmte ics (  ruau pou0tpe  feilsla ra( s;u)texrmo io1omteanei s srur(mpno1ome mivsatfsDta(  ;t0oexoii3tasla elump (0aleomociotla eau slt0truoxr3no4amt  nvtat)aDrau  oo4apx mietlsla rl(mp u0artoxr3iadfa elieo s trurim oo1ll nlfvsatfsDumx  ;t0aleo oetydfmDranvp u4 lxnif3ia1laD  nvo s) eurimpiu1ome mivi (f 2tm(ro;u1olx iieiysfaDelumon(0artoif3ty1opDeai i s trtmxrpny1lmt liet ()srra(m nu4tetnmi3tasla2ul(vo u0 rxrircoytlp r ieo;t0 2ur(m ou4op   fetlsf rtr(rp;t4oexn ociatfs rm( s;u0aexomr3oodopt aiei;()srxoim3io4al emivtlsfaDumumont1apenmieiytls emu pnt)trxoio tytla   uvi ( s2xoxmpnu4lm  lncsatfartmxrpnu1aexo ieiys mDuan o;(4arxoir3oodfaD lnei (0srtm(r ny4lmen feia( srur(ro;u1tpxnii3iydlm uanmo;t) reriocootfpDe ivs;t  2xmxo3iudom nmivtls  rrmu o;u0texnifetyd sDul( pnu0trtrxf3ty1laDe uvs () etm(o3iu1omte nci t a2ua(m ou4aet  o3iat m2ua( p;t4altrif tytlm r u i s  rto(o3oy1openmnetltf 2umxm no1aptn f3iat s rmnmpn(0tlxomr3iadfa  lnes;t0trurxmpoo1ll e feil(fa2raurpou0optomf3iyd sDulnvp u4texnir3oatlatr ueo s)srumxrpiy4llenlicias)srtmxm ;t0oexo ocildla emnmo (0 ltnmfctytom ranvil( trxmim iudope  ivtasf 2rm(rpot1alxomfeildls2rm( o;t)artomo ta1fptelues ( teuo(opno4olt lictltf Duaur ;o4tlen ociat s2ra(mpnu4altrio3iodlmDe u s;t0trum(mpoo1am  mfet s sDtmu  ;u0oltniiciltlsDuaumon()texoio todfaDrlivo;t  eto(mpnydlmt mfct tf Dum(mpnu1alxnmietasfs um( o;u4trxnmfcoatlaDrlnes t)srumir3oudope mfvt sf Draxmo;o1tleomi3iltfmDulu onu4areoifcio1fpDrluvo;( trtmir3nu4op n fes t) Dra(mo;t0aleomiciatfa2rmu pnt4areoif3iodlaD aieols) etmxr3no4open fctat)aDurum nu1optnmo3ilsfs emu s t) rerxr3io1lpDr i o t0seurxo3ou4olee fvtl(f Drrumonu1altnmieiyt aDrlnvs u)teeomf oatfaDe i o;t) 2umxrpou4ll nlivt t) Draxrpnt0aeeomociydfa ra(vpn(0trxrmr iytlpDe neo;t)sexoio nydlpte fei ( arumu ooo4oleo i3iydlaDeauvo;t4tlerio3todlatrai i s tetm(m3oydlptemiet t) 2tr(rp;t4olx mo3ilt s em(vo;(4alxrxf oa1latr nes t  eum(m nu4am e fetl(fsrrrx oou1aex  icildla2emnvont4tltrif3iytlpt auvi;() 2xmxrpoy1olee icias)arumx pnu0tpxn fciydls ua( p u)texnmociatfmD anvo t)t2tm(rpoo1lm emivs tf ruaxrpoo4aleomfeiydla2ul(mpn() eenmf3iadopDe uvi (  2toio nu4aptnmici sfaDra(  oo1altomfeiatfm rln o t4 exrif3iatoptelieolt s2umxr3nu4lpe lncia(fsrrmumoot4apx ioeiltlmDrmnmp t0 renir3oy1op  luvs (0 2uoxopiy4lm  liviat)a2taumpno0opx io3ilt s emuvp u0 etnmr3oodfp e i o s s2urxo3oo4omtn ncsl()a2uax pnu0teenmo3iad a umnvo;(0 etnmocootlm eaueils trxriopiy1ap nmnvta() Dtaxmpnu0alxn ieiysfm emn s t0alxoxr3oytlateau i;s0 2umirpiy1op  mfciasf 2trumpno0alx moctltls el( o (0 lermr iydopDr u i;s trumir oydlpe lfcilsfsrrm(m ot1opxo feiadlsDulu p;u)alenif3oytlp  au o;() 2tr(opiy1omeemncsl(f Drrum oo4alt  fciyslm2elu s t)arenio3iy1oaD  u ol( seuo(r iodllee fcsls)srua(m nu4alx  fctasfm2ul(vpnt0alxoifcoodoat  neo t0 exr(mpoudlmee ies t)srua(r oo0opt  fcias s2em( p;(0 rxnxo todfp  lu i;( srxm(mpiydap emfvtl(  rtr( o;o0oeeomociytfm2rm( p t) eeoio3iadfaDrauvolt t2trim3iy1ale mncias)a2ur(m oo1aleo ieiasfsDran p;t4arxomf3oo1om ean o ( t2tm(opnu4apenmicsa(fs2trx p;t0tpxnmieiasls2ea(mp;u)texoif ootlatr i i t  rxmimpoodam emfvsat)a2uax pot1tpxnioeiytlm em(ms;u4trtnxo totfpt lneilt0 2trxopiudllenlfct sf Drru  ;u1olxomieilsfm rl(monu4aetnmr oatlate u o s t2to(m3oy1ole  ict (f 2trum ;o0oexoioctys a2rmu sn(4 exomr3iotfateanvsl(0tetr(r3nodapte fes sfs2uru  oo1aeen o3tltlm2umn s;(4altoxr3oa1fate u s (0srum(opnu1ol emnct s)arurum ;t1tpeomo3tydfa2uln ont0artoxr oodopt ln o;( trxm(m3iydol elictlsf rua( o;o0oexnmi3iytlm ul(vs;(4tetrircoa1fmtrli ils0trxrxrpou1aptnlictat arurx poo4opeo ieiasfa2uaumo;t) leoif3tatlmtrli olt) rxrxo ny4ameemnvs ()srra(mpno0ale  oetatlaDeluvpn(4 lxnio3tydomDeaues;s trtm(m3oy4op  lnvil() Drrumooo4opeomfctys s ua(mpn()aexoxocia1fpD  uvsl()sruo(opny1lle  fvi s)s2tr( onu0aptoio3tls a2elnmsnt)teenmf3iydopDelneo;(  2umir3nudom nlfci s  rrau  ot4teeo f3tyslaDelnmp u4trxomo3tydoa   i ols)t2uoir3oo1oltnliesasf Duaxmpnu0tpxn icilt a2em( o;t4 ltnmr3todlpDr n o;t) 2tm(r io1omeemnctl( s2rrumpot4olxoiiciydlm ua(vs t0texnio ta1oaD ai i;s  2umio oodamt  fcilsfartm(rp;u1tlenifcias sDrmnvp;t4 rermf3oydoat anvs;(0seumxo iudomt lictl( s2um(m oo4tetn oeiadfm2uau snu0alxnmfcoo1omteau o t) rtoxo3nudlmeemfvt sfsDtrump;o1alxnmoeils aDul( s;u)texnxo3iy1fm elivi;t) rxrxm ou1openlnctas  rua(mont4oeeo octad s el(vo t0alxnmr iotfpDeliei t teumir oy1lp n iviat)s2rr( p;t1tle io3tatls umnmp;u)tlxomr ia1op r u i (  rtrirpno4aptn ieil(faDurxmp;t1tlt moetaslaDrau ont)aexrir3iydlaD lnvo;t t2uoxrpnu1alte fvtat sDtmx ont0alt  ietydfs em( on(4 rtnxo iy1fa  au sl(0t2uoxopoo1ole lfvils a2rmumoou4apxn i3ilt a ra(vs t4 eerxf iy1fm  aivs (0s2tmio3nu4oltnmfcsl(f Dtrxrpou4oee  oeiadfa2rm(mo () exrxfcta1lm ranes;() etr(opoudapt mncta(fa2taurono1aetnii3tadfa2el(mp t4 rerxr3ootlptraivs;( truo(opiu4alee nctltfsrtr(mp;o1alx  o3ildfs umu o (4aeenxf iydfmteaneolt  rur(mpnodap emicias artmu ont1apxnmfciyd m2rlu on() renmf3todom elues;t t2xrxrpoydopen fvt (f 2ta(r no1tlx  o3iysla um( pnt4aetnxo totlpDr ivslt) rxoir3oydolt  ies () 2umuroot1aex  ociyd aDuan p t0arxnirciotfm rlu s t0srxo(r3ou1olt  ivs s)aDtaxronu4teeniietad m2eaumon(0tlxnifcio1fm ean o ( teum(m oo1lle mfvtlt)srtrum ;o0tpeo ieiasfm elnmsnt0trtoxfcto1fpDrai slt) 2urxrpoo1lmtn fvs tfarur(rpno1apx  oeiatfm2rlump;u) eenxf3tydlpDeln ol() euo(r iy1apee fvslt)artaxm ou4apeomieiyd m2eanmon(4teeoirciodomDran il()t2tmxo3iydope lnvsatf 2ur( pnu4ole ifetldfs2ranmo;t0tlxrif3oadoaDelu o t0truoxrpiy1apeemfetat  rrmurp;t0tpt mfetlsfs umnms;t4 rxrmrcoa1lp e iei t  2xm(r3ny1apt lnetas arumxrp;o1oexoio3iadfm umump;t)aeeomfcio1omtrlneilt) eur(mpiy1alt  fvsa()aDurx  ou0aeenioctat m2rlu s;u4artrmo3oo1fmteaivo;( truoimpiudop nmivta( s2tr(rpnt1oeeoii3tld m rluvs ()altoxr tadfm rlnes;()s2trim nydll nlfeia(  rraumooo1alen feiys aDrau p;u)aexomr oodoa e uvi s0 rxoimpnydlpen ncta(farurx  nt4oee mfciyd s2eaump t4trtnxf iytomDr uvo s0texoxr oodaltelicsat aDtmur oo4aleoii3ilsfm uluvp;u)arxrxoctytlmt luvo s) etm(mpio4lmt lictatf Dtaxm nt1oexnmi3iad sDrl(vo;u)tltomrctodoa eaieo;( srxoxopiu1ome mfvsa(  2tau p;t1apx ifetydlm2rluvp (0 rerxocoatoa eli o (0tetrxrpoodamee ietas s2rmx oot4opx  fciytfs2rluvo (4trerxo oytom ean s;s seurim iodapt  fcia()sDuaump;u4teeomieiltfs2ua(mo;u0alxoifcio1laD au o ( trxoxo3ou1am   ivtls)arurur nt0aet moetasls umuvs (0teerifcoadoaD ai sls0trxoio3nu4apt  nei sf Dur(r ot4tet if3ild a2el(vsn(4texoxo tytlate u i;s) rtoxrpny1optemnet t sDurum nt1alx mietysfs2emn o;(4 exrmfcoa1latr n i;s sexm(r3ny4oltnlnetl(farta(mp;u4aeeomoeiys s ul( on(4arxnmr iodfm ranes (  2tr(r3iudal e fvsa(faDrrxm ;t1aeen ietasfsDra( pnu0tetrir oa1fpte nvil( teurxrpiy4opt mivi ( sDrm(moou1aet mocildla um(ms;u4arxrmr ia1lp  ai s ()trum(o3iu1aptelfct sf rur(r ot0ole ioetadls2ua(mo;u) lxrxr3to1fatrau s;()srtoxr3iudal nmfei sf 2tmu ooo0ole  ietltfsDelumo;()tltnio3oo1fat  uei s0t2xmxm3oo4lltemnesl(fartrum nt4aleoiietlsfs2ea( s;u)treoxfcoo1fpt lieo s s2xr(rpnu1al n nvsls a2ta(rp;u4apxoio3iytlmDum(vo t)alenmr ty1fpD lu o s) rumio3no1am   ieslt) ruaxmo;t1opt mietasla2em( sn(4trtnir iatoa eau o;(0t2tr(o nu1lm emfvtl()srrm( pou4opto ieiytfa2rluvonu4treoxr ty1laDe ivi;s0sexoxm3oydlp   fei sfs2trxmpot1oltn ieiatfs em( s;t4aleomo3oodlmt  i o s0 2xmxr3io1omt mici () 2umumpoo0tee mi3iysla rau o;u4trxrxf tadfaDeaneslt) 2xrim3ou1lm elfeil(f 2umumonu4aeen i3tltfm umnvo;(0 eenir tadlm eluvo s)srxrxmpnu1omt mivtltf 2uaumpot1apt  f3iatfa umuvont4aleomf tytfa  lneils  2xmxmpno4om nmiesls  Dua(rono4oex  fcilsla elnmp;u)trtoxfciotop  luvs;( teto(o3iy1op e ics s s2tmu pnt4apt mo3tatlmDul(ms t)tetnirciadlmt ln s;(0texoxr3io1ap elnctlsf 2rrx ooo4teeo ietatfs emnvo t4trxoxo3oa1lmD  neo t0s2xr(r3ny4optemicslt)a2uaurpot4oet  oeiasfmDrlu p t4texrmr3ty1lpte nes;s  euoxm3ny4lp n netlt) 2rrxm ou0oexomf3tadfa ua(mp u) renmr3oo1om elivo t srtoir iu1lmtelnei sfsDra(mooo1aet  i3ildfs em(mp (0 lxnifcto1lmte neo;s tetr(o io1aptnlivsl()arrrxrpno1opeoii3iadlm2ra(mo;t4texnmo tytfmteluvi s) etoiopoy1omeelivs t  Drrxr oo4oltoifeiatfa2emnvsnt4 lxnmfciotoaDraieo s0srxoxr3ou4om n fetls)arumuro;t0tleo ociydfm rl( s;u4teeomr3tatfp e uesl(  eurio3oy4omen ivsa() rur(r nt4aee if3iyd mDumnms;u0 eeoir3todopD auvi t)setmxopiydlm nlivsasfsDrru pnu0tpe  ictldls eanms;(0 rxomo3ia1fa rlnvolt  rxr(rpiodomt miesat)aDtrx  ;u4optoiictldfa2uauvo;t)areoio3oadop  lnvo;()setriopiydalt mncs sfs2ra(  ot0ope mfcildla2elums ()alxomf oo1la   uvi;(  2ur(m3iu1ale livtltfsrur( pot1tpxn f3tysfm ul(mo t4 eenxr tadla rauvs t srxrio oydlmtnlfet t a2ur(rp;t4apt  oetys s2em( p (4tltnmoctydfmD  uvs (0 rtmir3no4ole mfcsasfs2rr(monu1tetnmoctasfsDulnvs;(0alxoxo iytfpDelivilt0seumxo oydam e nesa( sDrm(mp;o1tpx mfetasls2rmnvp u0 lermfcoytlaDe u i s trurxrpiu1lpenmieils) rraumpot1aexn fetltlaDul( o;t0altnxo3oydlmt  n o;() 2tm(o3iy1apeelnctasfsDurumo;o0olxoioctysfs ua( s;(0aeerio tadfmDrlnvils0s2uoirpiy4lmeemncsa(f Dra(m no0apxoii3iydfm2ra( o;t0 renxf3ty1omteluvils0 2xr(m nydomtn fetatf 2ururoou1tetoifctlsfs2uln o (0tlxrio ootfptelnvo s0truo(o3iy1ope  ivslsf 2ur(rp;t1tptnii3ildfa uluvp;(0tltrxf totoa r i ols  exrxm iu1ope lneilsfsruru  ;u1oexomieiysls umuvsnt0tetomf3ootomDrlnvs s  2xoio3io4ope  ncs ( aDtm(mont1aeeomoctysfa ulnmp;()areomf oy1lpDranvs;(0s2tm(m3nydlptemicia( sDrm(  ;u1tpto fctlsfs2eaump t)alermr iodoat  n i;t)trtmxm ou1omtn ncsat aDtaumpno0optoifetas mDul( p;u4 rerifcio1fpteau s;t)t2uoxr3iy4ome lfesas sDua( p;u0olx mi3tasls uanmp ()trtoif ta1lmDr n i;t seumim3iodolteliesa(f Drm(ro;u0aeeomociyt s ua( p;u0 etrio oytlatrli o;()t2tmim iodom   fvtl(fsrrmxm nu0tex iiciysfs ulumo t0tlxnxfctatfpDeai il(  exriopnu4lpenliesat)a2uax ont4tlx mfeiltlm ua(vp;(4 lenxr tydop e i il(0texoir oudoptemicsasfsDraurpnt1oex iictatla elumsnt)alenmo ootlatranei t  2toxrpiu4lpe  ieta()sDum(  no1texniiciaslmDrmumo;(0aetomf3oadfatr uvi (0truoxm3iu4lmt  nvi t)srtm( ono0tptoifeiltfa2rmnvo;()alxrmrctodoaD lnvo (  2xmxm iu1om   neslt  2uauro;u0altnii3iyslmDuau o t0aetomr3todlateluvo s  exmxm iu4lm emncsas)sDur(rpou1tpxn i3tatls2umn p;u4 etomrcty1lpDr nvi;t0teto(opnu1altnmneilt srumu  no0oetoio3ilt s2em(mo u) lxnmocto1fmD au o;s0 exr(r ny1am nlicslt) ruax p;o0oltnmiciltlm ra( o u4 etnir iytlateaneils0srto(o3oo1apeelietasfaDtrum nu4tleomf3tyt a elnvp;()arerxr3tadfaDr uei t0 ruo(o iu4oltemicil(fs2trx  ou0tlx ifeiydfm2uanmpnu0alxnmf3to1fp   ivols  euoxrpnydlm nmfcils)a2tru pno0apeomocildls uanvpnu)texoio iotfp  lnvi;t)t2toio3oy1lp elietl()srua( o;u0oet  ieiad a um( s;u0trenir todlptrliesls0t2xrir3iy4olte netls aDuau o;t4teenmoctlsla emumo;t)trxomr3oadlm  auvo;s0 2urxo3iu4al emfvta() 2rru pnt4aexoifciasfa eau s;t4tltoxr iy1fmD  neo t)setm(rpou1om  lieiltfa2tmu  ;t0opx io3ilsls2rmuvp;u4tlerxf tydom   ivsl(0 2trim3no4ope lfvsa() 2tau pnt4olxnmfctldfaDul(mo;(0teenxo iatlateau slt  2xrxmpoudom  mncilt  rrax ooo4tet mo3iat s ranvont0arerir oodfm eliei;t0trtoir3oy1apt lnciat artaxmp;t4aet moeildfsDuau on(0alerif oydfate uvol(0 2xoir3io4lmtnlneilsfs2tm(mp;t4tpxoio3iadfmDrmu o u0 lxnmo3oa1optrliei;s)trur(o no4om emnct s srumxrp;u0opxnmfciat m uan pnt) etrmoctatlpD aiei (0 exrir nydlleelncsls arumxmo;t4tee ifeiys sDrmumo t4texrif totfpDrauvols) 2xmxr3no1lle lietltfarumxmo;o0tpx moeiasls ulnvpn(0 ltnxr3totomt anvolt  rtoxm3oudoptnmfvslt)sDrru pnt0aeeo oetlt mDrm(vs;(4tltomrciadopteli ols  exr(m3io4omt mnvt tfsruau o;u4tltnmieilslmDrm( o u)aeeoio ootfm e u i ( teto(m iy1lm n fetl(fsDtaum no0tet moeiysfa emn onu)tlenmr ia1oa  lnvslt trxo(r iu4amtelfctas)aruru  ou0aptn o3ilt m2ul(vsn(0aeeoir3oatfptelu slt0 eurxm3oydol nmnes sfa2ta(m ou4tpenioeiadfa eanms;t4 ltoxo3todfmt anei t  2tr(r3oydlle mfet (faDtmx pnu1opx  o3iytfa2emuvp t0altrmr oo1oa   nvo ()texr(m iudameelnvt s) rrmuroou4opxo i3iaslsDuau s;t0 etoxr3iadla rluvs;t seurio3io4lptelfctlt aDra( pnu1aeenmo3iat mDrlnmo t) etnxocio1laDrauvo;t)trxr(mpiudop emfvsatfarur(r ;t4oexnmi3ils m uanvon(0 etrio3tytfat an s;s0 exr(o3oudape lfct (fartrx pnu0apeomietlt s rauvs u) exrmr3todfat lu s;(0t2xrxrpno4ameelici tfsDra( pou4aexoiiciysfmDumumon(4texnir3tytfpDean il( t2xmxrpoodap nlnvsas)arrrxrp;o0ale iietytfmDul( p u0tlxoif3tatlpD luvi;t0 exrxm3iy1opte ncsa( artmu oot0olxnioctls s rl(vpnu)tltoxfcoytfate ueo s0srurxr3ny1ll emicta() 2trum oo4olenmieiadfsDelnvo t0aeenxfcoytopDeaivs t)srurxo3oodapt mncils)s2rmumpno1optomoeildla2ean o t4alxnmo3totop  lu s t)truo(o3io4al  lncil() Dra(m oo4aetoiociyd a rln p;t4teerioctotlaDean o;t)seum(mpiy4alt mfctlsfarurum ;u1olxnmf3tydfs2eln o (4 etnxr3oytlatrluvs;s  2um(rpoo1amenmneilt  rurur ;t1aee ifctyt m2ean p u0tetrxo3oytoaDe ueo t0srxoxo3no1lptelfesatf rta(mp;u1tetoioeiat s el(mo;t0trtrxo3iy1oatrlnvo;t) 2xoxmpou1ll elnei t)a2umumpou1tlxomicildls2eauvonu0teenxocto1la elivils) exo(m nu4olt livtatfs2tax oou1tetnmf3ilsfa2uau p u0trtrio3todfpte nvs;t0setoir3iodap n nviltf Drrur ;u4teenif3iydfaDuauvp;t4areomr3oatla   neils)t2urim3iudom elnesl( srrmxmpoo4tpxnioeildfaDum(vo u)arxnxo iatfaDr ivilt0 exoxm ou4lm  mfvsa()srtruro;u4oexnmietytfs2elnmo;t)teenxo3oy1faD anes (0seur(m3iy4ll e fviltfaruaxmp;u4oexnio3ilsfmDemnvonu0arerxrctytomD li s;t)trur(o3oudlmee neslt  rrrxmooo1ape io3tat s rm(msn(0tetnmr oy1fmt  nvo;(0sexmxr io1lmenlieia(fa2trx p;o1alxomicildla2ua(vo;t)altrxf iy1fpt  ueo (0s2umxr ou4ameelnvsat)s2uaurpot1olen fciyt s2ra(vo u4 lxoio3ty1lpt auvs;s  etrimpiy1amtnlfvsat) rrr(r ;t0oetnii3ilt mDrl(mp t0arxrmocty1optrlueil() 2urxo oy1oleelict sfarua(  nt0oltn i3ild m2rmnvs u0arenircoo1fpDr u sl(0trtoimpoy1om nlfctlt aDumu ont1aeeo ictatla em(mo;u0treoif oadopteau o s texo(m3nydomt  ivils) rua(  nt4oltnmoetlsfm2el( o u0 reoif3oa1opDrluvo;t trxmimpou4ap n fetas  2rrx  no4alt  fetltfsDrlu s;(4tleoxrctadom r ivi t) rumir oo1al   nvs ( aDuaxr ;t4aleo octat m umuvo u4 rtomr3iotlpDrlivsl(0seuo(mpnodape  ncta(fa2tr(mo;o4tpeoifetyt m ulnvpn(4trxrmr tatlat  n i;t) ruoxr3io4ol   icil( sDtmu ont1aex ioeias m2ua( onu4tleoxf iadfateluvo;s0sexr(m nodllen ivias) 2tr(mo;o4altnio3iadfa2umums t0 exoir iodlaDranvs;s0trumir nu4optelnei t  Dta(r ou0oee mfeiad sDea(vs;t0artnmf3oa1oa r ivi s) euo(m3iydome mnvtatfsruaxr oo1tlt if3iad mDelnvo () ltrmo3oo1lm   uvi ( teuoirpoy1lmeemfctltf Dur(m oo4tlt ifeiad mDrlnvs;t4arxnxf3io1fm  an s;( sexmxmpnu1lp e fetls a2ta(mp;u1tlx ioctltfm uluvp;t) rxrmr todlaDelueo;(0 eurio3ou1llt micslsfa2uax  nt1aexomociyslm2emn s u0altrmrciytomte n sls teumxo iu4lpee fcsas)s2taumpoo1ope iieild a ran s;t4tetrio3tatlmtelneo;() 2urio3ny1oleemfeiasfsruax  ot4tlxoioeiadlaDumuvpnu) eenxr todlmD  ueilt)texrir3nodam nlnes tf Dtaxrpnt1aptnioeilsfaDeanmp;u)tetrmrcoy1fmteanvi;()setm(opiy1am  mfct s  Drau  ;t1teen fctas a umuvpnt0 reomo3tydfpD  nvslt0s2urxo nu1alenlivs s)aruaurpnt4aptn iciat aDem(vsnu)tetomf3iydfpD aiei t)seuoio3nodol e nctatf Drr(m ou1apxn i3ildfmDel(mp;u)aeenmo3tatfm  lneolt0 rtmir ny4omte ivt s arta(  no4aee  o3tytla2rlnvs;u4teerio3oy1oateaueilt  rurio3iy4ll   fei s s2uaum ;o4tle if3tat sDra(vo;u0altomo3iadfpDeli s;s0 exo(r oudlmtnlnvsl(fsrtmx ono1tptomoeiytfa2ul( s t0aexoxo3ta1lp  anvs s0setoxr3oudam eliesat sruaxrpnu1tpen feildla2uau pnu4 exrir3oadfmtr ieo t) 2um(rpoy4lm n feilsfsDrm( o;t4olt ifctldfsDrmn p t0trxrif3oa1lmDrluei s0s2tmxm iydaltn fetat)srrrum oo1optn f3iyt mDelnmp t) exnmr3iadom   i s;()t2to(r iodomtemnvsas sDtru pnt0ale ii3iyd m rmuvon(4alenir iotfaD  uvi;(  etmim no4lmenmfct s) 2rax pot4ole ifctlsls ran o u)alxrmocoy1oaDelnei;s s2tmxr3io1ale lnvsa(  2rauroot0open oeiytfs2rau p t)trtoxrcootoa rai s;s  2uoxrpiu4lmenmfvtas srrrur ou4altomieiysla2ul( o (0trxnio3to1fa  auesls s2xo(o3oy1oltemfct (faDumxmpot4openmi3iasfaDum(msnt4areomo3oytfaD an o;(0 2urxm no4am emieilt)s2rmurooo1aee iieiysfaDrl( snt0 renxr ta1fmD  i s t t2xrim oodol  lics sfsrrmurono4aeto ociatfs2ulnvon(0aeermr3oa1lpDr uei;s)s2tr(r3iodale  ncia(  Dum(m ;t0tle ifctyt m uanvp;t4 ltrxoctotoa elivs;(0srxoxm3iu1op elfesat artaumpnu0tetoio3ilt m2ua(ms u4 ltnmo to1fmt luei;t0sruo(m iy4ole mncsl()arrmurp;u4oex mieiys m2eauvsnt0arxnxf3oa1oaDrai s;t0texr(m3iu1lleemnci (  2umu ont1aex ioeiytla2rlump (0artrxf3ia1oaD anes s)texm(o iu1opee netlsf Drmurpnt0aptnif3ildfa em(mon(4 etnmo oytfatrlnvo;()s2xmxm3nodamtemfcsl(  2um(r ;u4oleoiiciltls2em(mo;u) ltrxo3oydlmDrlueo s  2tm(r3no1ll n ieiatfaruauroou0teen o3ilt m2emnvpnu0arenircia1oat luvslt) exoxo oudomtn ieta( s2trumono1olxnii3iltlm uanvs;u)tltrmfctotfpte nesls t2xmxo3ny4aleelietas) 2uaxrpot4apx mi3iasfs rmu s;u4aetnxo3oo1oaD lu ols)texr(m nudopeemfctat) 2rr( p;t0tlt iietad s eanvs t)teerio iydlp ranvi s0 ruo(r ou1lmtemfet sf rurum ;t1oexomfeiysfs eauvo;u4trtoir3oodoa eanvol( srumxm nydalt livsl(f 2ra(mpno4teeomoeiasls2uau p () exrxr tydfpDr nvi t teurxr3oudam e fvi tf rta( onu1tlxoifciys m2rmn pnt)trtnmo iotfm e u i s)trurxo iy1lle lncta(  Dtru pnu0opx  fciyd s2ean o u4 etrir3ta1fa e uvs (0 2uo(m3oy1op nmncil() rurxr oo0aptn ieilt m rmu p t)treoxoctydoa elueo s)t2trio iu4lp  miesas aDtmumooo1oetoio3iatlaDulnvo u)teenmrcoodfpDe n s;t0tetoirpiu1op n nct ( s2ra(rp;o1tpen o3iadls em( o;(0trxoxocia1opD livs;() etoxrpiy4lmenliet tfaDtmumo;o1aptnifetadlm rm(monu0aetrifcoo1lpDrauvil(0 2tmio3nodomte ivslsf rtm(r oo0oexoif3ilslsDrlnmo;(0texrifciatom eanes;s0setoio iodoptnmivtas) 2ua(ro;o1apxoioctad s umumo;u4trtrxo oa1opD  iesl(0srurxrpoy1ap nlfcta(  rum( p;o4altniieiasfa rmnmp;u0tleoxo oy1fateluvi s trur(opnudole micsa(fs2trxro;o1openioetldla2ea(msnu)trxnio todlmt ln ols)srurxr nydomt  fct s aDum(  ;t1openmo3iltlm2rmnvpn()aexnirctotlatr n o t)trxm(mpou4omeeliesls)arrau pou1alenmfeildfa2rmn p;t4trtrmf3oo1opDranes;s) exrxm3iydapeemncsat a2umxmp;t4olto oetydfa2rmuvsn(0 lxrio3totoa r uvi;t srxmxm no1aptnmiciasf rtr(rp;u4oet mf3iasfs2ranvpnt)trenxr3oa1omD livo;s)s2um(mpny1lmtnliei s)a2truroou1alx ii3iadlm uauvo;t4alxnmf oodoaDr ivol(  2tmio oudll nmieil(farum(ro;t1tltomi3iltfm2ran sn(4altomo tytfpDeauvi s  2xmxr ny1lpe mnvt tf 2rmx  nu0teen oeilt s2eanms (4 eerifcoadlptrluvs s0 rtoir3nodll n ietl()aDtaxroou1tee mo3tlsfsDumu p;u0 exoif iotfa eln o;t0teumim3nudolt  netl(faruau p;o4oex ifctydfaDem(mp;t4 leomr oo1lptelivs;s0tetoiopoy4lp n iei (faDuax  oo1texomf3iadfsDuluvo;u0tlenxf3todop rln i t) rtrir3ny4ope  nvsl()a2uaurono1tlxnii3iltfaDrmn sn(0 eerxf iadlpDeli s;t0s2um(m oudal   neiasfsrta(rono4ale moeiat aDeauvont0 lxrxoctytlpte nvil( t2uoxm io4am nmivil(f 2um(rooo4olenmo3iadfsDean p;u) lxnif3oy1omtrau i s t2xm(opoy4omt  neil(  rumx  ;t0optn ieiatfm eluvp (4artomf iodoaD  ies;()setrirpiudam e fct sfa2umx  ou4olxo ociysla2ranvs u0trtrmfctydlptelnei s)seumim3iu1omenlivt s  rua(rpnt4tpto i3tatfsDrm(mo;t) exomr io1lat aivi;()trumim3oy4al elnesls sDurx  ;t0ale mociltfs ulumont4 rxnxfcoo1faD aues t)trto(o iu4lp  lncs tfaDua(rpot1optnmi3ils s elu s u4tltoircoydomt lneo t0s2xmxm io4ap nlietas) 2tax ooo4aexo iciytfm2umn o;u) rtnmfcoy1la   nei;()trxmxm iydomenlfvtl(f Dua(rooo0aetoiiciat a rlnmp;u0aleomo oy1lpDelneo s0 rtrxmpnodlleelfcs tf 2raxmpot0tltnmfeiyt m uauvs;u) rxnxfciatopDe ueo ()srtm(mpiy4op nlnvt t) Dtmumpnt0tlenmo3tatlmDelumont0tlxnxf oydla e uei t texmiopiy4op nmict (f Dumxr ;o1opeo o3iasfm2ra(vont4 leomocoadoaDeliei t)t2ur(opiu1ap  licils s2raxmonu4alx mietytfa2eluvsnt0altoirctadfa e nvi;t)setmio oodlltemicsls  2rrxmonu0tetn f3iatfm ea(vo;(0 renxo3iodlm rau s t  rxmxo3io4amenlfcsls s2umxr ;o1aee  ictlslm rlumo (0 reoxf tatfaDe i s;t t2to(m3no4ol  livsa(f rua(m ;u0oetoiicild aDra(vsnu0aetrmf3oodfate ues t sexrxr3oodope miesl()srur( p;o1altniieils s2ea(vonu0tltnxr3oadomDrauei t) eurxopio4op  lfctatfsrumxm ;t1oee  iciat a2emnmp () etrxf3tydlatelnvi (  rxo(mpnodapt  ietlt) 2ur(rpnt0tex ii3iat a2rl(msnt)tetomo3iatfpt  nes s0t2toim iu1amt mnvil(faDrm( o;o4alenii3tltfs rm(vs;t0 rxoio3iy1fm eauei ()t2tmxr3oy1aptnmfcil(fsDra(mp;t1tlxo i3iasla2ra( o u)aetnxoctytoatr n s;s  eurxo3no4ap  livs (faDumum ou0tlxnifciad m rlnmonu4 eeoxociodomtean o t0 2xmio nodome lnvs t sDrrxr ot1alx mo3iys a2ulnvp;t)artnmf tadfmD ai ils)srumxr3iydllt lncia( s2um(  ot1apt miciasla2emnvo t4arxnxr3oatlpD aivilt) ruo(mpiy1lltn fvia() rraumpot4tpen oeiyd a2rlu pnt0trtoxf3oo1op eaies s0texr(r3ny1oltnmncsl(fsrtmuroou1opx ifciyt m umuvpnu)trxnif3tydoa ean s s0srurim3oy4lptelfcias s2rmxro;o0tetoiociytfmDulnvo;() rtrio3oo1lpDe i i;t s2uoirpnudlmenlfet ( a2rrx ooo1alt iieiydfsDrmnvp;t)areoxr3to1fmt lues;(  eur(o3ny4lpt mnctlt)s2uaxm no1tpe ifetadlsDrmn sn()trerif3oy1oa rlies;(0seumxopiudaltnmnvs (fs2tru ooo1opxnii3iyslm rau p u)aetnmfcto1la elneols0 rtr(r iydlpt lietl( aDtaur ;t4tetn ietltfm rm(mo u4 reoxr iy1opD aiesls0 exmxr io1apeemicia( aDtmumo;u1olen o3iytfa um( p (0trxoir ia1omt lu i;s  2tr(o nudaptnmfesasf rtmxmoou0tlen ieildlm elums;(4tlxrxocia1laD lnvo;t0 2trir iy4ol   fes sf rtmuront0texnifciyt s2emuvpnt0arerxfcoadlpDelnei () 2trxm3iu4lm nlnci (fa2rrxm ;o0texomieils m el( ont) ltoifcto1fpDrlieo t)srur(opno1lp nlnvi t  rtaxronu1oeeoiociytfa2emu snu0 lxoxr3iadlm r nvil() rumio3io1amenmnvta()a2ur(rpno4tet mocild a rmn o (4artnmrcto1fm  luvo;t)srum(r3oy1ole  ictl( a2uru o;u0alenmi3tatfm ra( pnt4trenmo oydfpDr uesl(0 ruoim ny4lp n fvilt)a2rr(r nt4alxoiieilsfa ra( ont4arxoir3tadop  anei t0 2xrxm iu1ope mfcsls)s2rmur nu0teenmoctld a rmu snu)aexnif3iy1fmDe nvs s) exo(m3oo1lle  nctas) 2uaum oo1olx  fctls s2rmnvs (0artoxfcoatfmte ivsls) rxm(o io1ol   fet t)arua(mpou0tle  i3tasla2ulnvp;t)trxnir oy1fatr neo s)trumxm iu1lmt mnesat)sDuaxrpot1tltoiictltfm eauvo () ltnmo3iy1optraivs s t2trim io4opt  ncsas)artrur nt0oeeoii3iaslm emn o;t)artoif iytfptrln i;t) rxoxr3oydlltemnesl()srur(monu0apeoiictlsls rlnvont)arenmr oo1lp elivs s0trtmxm iu1opt lnctas)aruaur nu4ale ii3iyslaDulumo t0artniocoodlptr ivs;(0t2uoimpoudlptnlnesa()artaxmpou1aptn oeiatlm uanms;(0trenmo3tadom r u slt)seto(mpiudolenmncs (fsrraxrpnu1oet mfctyt aDrln pnt4aetoir oa1fa r neilt s2xrimpoudomee ieia( artau  no4teeoioeildlsDeanvo;(4aeermo3to1latrlnvol(  rumxopoudalt licilsf Dumx  ot4alt ii3ildlm rl(vonu) lerxrctytfa r u sls  etmxopnu1lmee fci ( a2rmxm nt1oetnifciytfmDeauvs;(4arxrxr iatlpDr n ils0 exmxrpoodlp  liesas s2rmu  no0teeomieiysls ul(mon(0tlxrxo io1fa  li ol(0seumir no4am n nvtl(fartm(  no0olt iieiydls ranvp t0trtoircoatlpt auesl() exrir3nu1lltnlfet tfa2ra(mpno4ale  feiltla2elnmo;t4 etomo3iadfmDelivslt0s2um(o io4om   iesatfa2ur(mo;t4apxnmocias m rauvs () etoio ty1om r n o ()seuoiopnodoptnlfesa() rumurpno4teen ociyt s ra(mpn(0tlerxfctatla ean sl()t2uoio oo4lp emieia(  rrmu p;t4opto iciys s rlu pn(4aleoxo3tydomD au slt)teuoio oudamt mivsls aDtaxmoou4aptn iciyd mDem( s;t0trtnmr3to1fmDe i s (0s2urio3oo4oltnmfei sfaDuaxmpou1olenmiciyslmDum(mo t4 ltoxf3ootoaD aies;() euoim3oudoltnmfes sfs2rrxmoou4alxnmf3tytfa rauvs (4 lenxoctydlpteaies;s)s2xrimpou4ll elneiat  Drmurpou4apxnioeiydfsDel(ms t4areoircio1fm  au i;()trxm(r3ny1op  liet sf rrmx p;t4tetniiciysla elnvsnt4 ltnxfciodfmDeanvslt)trumim3ou4omtnmnvtas)sDtaump;o1apxn ociysfaDrmn onu)areoif3oo1opt aneslt)teum(o nodam emnvilt sDtm( oou1tptoifciltlmDelnvo (4alxnifctodfpDe u o s  rxmxm3iudopeelncta( s2tr(m oo0aexoiieiasls ua( s;t)aeerifctadfaDeanvo (  rum(r ou4open ieil(f rta(  nu1oleomo3iytfmDran p u4trtoio3oadfm  luvil(0teumxr3iodaltelfcias srtrx  nu0oltniiciyt sDeluvo;(0trtoxocto1la elivi;s  2to(o io4amtelneiltfsrrmxm ;t1tlx iieiyd m2uaump u)areniocta1fptean s;()texo(o3iodapeemfes s sDrmxrp;u0aex mociyd sDeauvp;u)tltomo3todfmDrln o t s2xmxr io4ll nmnes ()srtaump;t1optn ociydla rmn o;()altomfcoo1latr u ilt  rurxo iodlpee nviasfarumuro;u1olxnmfeiydfa rlums;t)arxnxr3totlm ran sl(0sexo(m iudomtnmncsa()s2rmxrpot0tpx mfciadls2rl(vsnt0artnmf iotlpte nei t tetrxmpiodale mfci ()a2rrxronu1oet mo3iltfs2emuvs t0aexoir iadomDr i s;t) rxm(m3iy1omt lnctas)srtm( p;t1opeo icilsla2ea(mpn(0 eenxf ootfpDranvo s  2uoio3iu1om  mnvsasfsrumxmont4olx  oeiyt s ua( p (0 lerxf3iydlmtrli i ()seurxr3io4apenmiesl(  Dur(ronu4tpe mfcildfm rlump;t0tlenxfcta1om rauei;()seurxo3oudopenlicsas) 2rrx p;t4apen ietad mDeanmsnu) lxnxf3iytfp  li i s0srurxr ny1am nmicsatf 2tr(rp;u1tlx mfciydls2emu pnu0 eeoxr io1faD  nei s)t2trirpiydap nmivsls) Draumono4tleo ieiltfa el( p ()tltnxr3iatlaD lies t  eurir3nu1lptn ivil(fsDum(rpno1tetomo3iyd aDelnms;(4 etoio3iotlaD auei;t0 eumxo oodllen ictas)aDrmu ono4tlto oeilsla2eln s t4trxrmoctatfpD luvi;s t2ur(r3ny1ll nlncsls)s2tmu oou1aex ifetasla2rlumpnt0areomrctatlaD lu slt0 2xoir nodale micslsfaDra( p;o1alxoifciltlaDemu p;u0 reoifciodopteanei;t)srxm(o nydol n nes s  Dra(ro;u1oltn o3tydlsDul(msn(4texoxfctytfpD aies s)texm(r3oo4lmt mfetasf Dumu pnt1tptomfeiytfs rl(vo (4 reomrctotla  aieil(0 eurim3ou4al nmfvt s)s2umx pnt0opt iicilsla2em(ms;u4aetnxo totla e nei () 2xrxm iodapenmivil(  rrm(mono4oet  ieiadls emn on()trtnxf3tatlmt an slt0 rtmio no1ll e ncsl()sDrmumo;o1teenifetadfsDrauvpnu0trerir ia1oatelieilt0texriopoo4ol nlncsa(  rtr(mpot0oltnmieias a el( p;u4areoir ootoat lnvolt)trxo(mpoodop  mnvsas)aDurx  no4oexn i3iatfs ea( s;(4arxomrciatlaDrai o s)t2uoxrpnu4ope mfvtlt sDrm( ont1tpx mi3iad a ul(mo t)aeeoio oodlmtr i i s trtoim no4alt  neiltf Dtr(m nu0optniieias m ua(mpn(4arxrio3oa1oaDelueilt0s2xo(r iy4op  mnetasfsrrm(mpnu0ale  oetasfs2ran snt0aeenmr totfmt ln s t  2xrio ou1ll  lfcta()a2rr(mpno1oetomfeilsfa rmnvo;t0aetrmr3to1lmteau i;( s2trim3oodamtemnvtat  2rr( p;o1tleoiictad s eanmo t0 rxrmocoodop eliei;( trtm(m oudaptn nctl() Duaxro;t0alt ii3ils m2em(vs t0 exrio iodfmDrlu i;t)s2trir3oy4lpeemnctltfsDumump;o4aptomoetasfsDeanms t0teenifctadfat aivo;(0s2ur(o3nodll elnes () rtm(rpnt0tet  feiys a2ranvs () reomo3iydoate n olt0 2tmxm3oy1opt  nesl(  Dua(mont0aexoifciatlmDrmn o;u0artoif3ty1fateaneo t) rtm(mpnudole lnviltf 2rrxrp;o1oet mfcilslsDrmumo;t0texoxo io1oa elnvil(0t2umim3iy4om  mietls arua(mooo0tlenmi3tldla emnmsnu)tlerxfciy1fp rli ils0 exoxm nodom emnvt tfs2taxrpnt4teeo ieildlm2ea(mp u4 exnxrcoadfpt  i o;s0trum(rpnu4optelietas) rrr( pno0aex if3iydla uaumo (0treoxociadoa r i il(0trxrxm nu4ll emnvsatf Dtaurpoo1ape mictlsfm2el(mp;u)trerxfcoodfat  uvi s t2xmxr3nu4ll emnesl()aDta(mont0tlx mieiydfs2rl( p t0trxnxr3iy1lpDeaies s)trxo(o3oy4llt  neilt arurxmpoo1apxo o3iad aDelnmo t4aexnmo io1fatelues t  rxr(m nudop  lneiat srtaxmpnt4apeo i3ild mDrluvs;u)trerif3iy1lp e u i t0s2uoim3io4apt lfeil(faDrmur nu4tlto ieilt mDuauvon(4tetoiocoo1latr uvi;s0srxmimpio1lp nmfvta()aDrrxrp;o1tlxn oeiyt m2em(vp t4altoio3oodopD lneolt0 2xrio3oy1lp   icslt arrrurp;u0tpx mfeils sDel( p t4 lenxr3oy1fpDeanvo ( t2xoxm ou4olee fcil() rrax ooo4tptnif3ildlmDel(ms ()aexnif3iytomtrlnvi t  rumio io4al  mfvia()s2rrxroot4tet ii3tyd a2ulnmp;(0alxrmr3todfaDraneolt t2umxr3iy4lltn feilsfarrrxm oo0oex micils s emnvs t4trxnxr tytoaD livi (0teumxr oo4lpenmies s  rtr(mpou0tetnii3iyt a ean o t0tltriocio1lmD lieil(0srxo(m3oudale mnvta() rtm(rooo1oeen iciytfs rm(vp;u0teenxf3iytla elieslt s2toxm3iu4omtemnvsat  rumum no4aeeomf3tld sDeaumsn(0 rerircoodoa  lieilt sexmio3iodomtn fes s s2trxr ot4alx  f3tldfm2umu pn()altnxfcootfmteliei;()trxoim ny1olt  nci s s2tmxmp;u4alto i3iasfm2rl( p;t0 exrxocto1faDr nvi s)seumiopoydll nmnviatfarrmum ou0olt ifciatfmDum(vpnt4aetnxf3ty1lpDeluvs;t trxmimpoodoptnlfvsasfs2trxmpou4apxomo3iydlm ua(mo;u) eenmo3tydlmDrluei;t)s2tm(mpoy4aptnlfct t) 2rmxrpnu4openiietytfs2ua(mo t)tlxrxrcoytfpD livo t  etoio iy4ap  mfcsasf 2tau  ;t0oeenmicildfsDumn o (0tlermf3tadoa e nvs t srxr(o oy4lm emfvtlsf 2rmu  nu4aee  fctyslm2umumo t4 lxrmf3oatomte uei;s)s2xm(r nydlle  fcil(fsruax  ;o1tlx ifetyt s umnmo ()treomo3ootomD  u ols)s2ur(opnydlmt licsa(f 2uaur nt4tltomfeilt aDuln o (0 ltnmf oodfaD au olt) 2xrxmpiydol nlieia(f 2ra(r no0aptnifeiytfsDeauvs;()trxomrcootom eaieo (  2urimpoodale lfviat)s2urur oo0apx mi3iyd mDra(vp u) ltrxoctotfmD  ivilt)trxmxmpnydlmtnmfesa( srrr(mont4tpe if3iad s2eau p u)aeerxf oo1lpte neolt s2toxopny1lleelieil(f rra(m no4apeoifeiyt a uaums (4treniociydfmD  nvo;t)s2xmimpio4opeemnesls artmxmp;o4oltn ociaslm el(mp u0tetrmfciydfm e n sls  euo(r iu1lp e fctat) 2tmu  ;t4tpe  feiadfm uaump;t) rtrxrcoydom  lnvs ()texrio3ny4optemfeta(f rtau  no0olx  o3iatls ea(monu)texnxocoy1omtean i (0 2xrxr oodlme mnviltfsrum(mp;u0aetoio3tad s um(vo t)artnxf to1fat  nesls0 2urxr3ny4olee icsltfsrumxmp;u0tltnif3iys sDrmn s u4 leomf ia1fa  lu s s srto(o3iodome mivi sfsDum( p;o0tpt iictytla2rmnvo;t0tlenmo3iodfate uvs s) etrxm nu1llee fvtl(  rrrumont1texoif3tltla2elumpn()tlxrmociatla eluvs t0s2tr(m iydlmenmfes () 2trurpot0opxnifcildfa ranvsn(0tlxoxrcio1lpt  ies;(0 rto(m iy4oltnlfvtat)a2ua(mpou1aee mictasls rlu p;u)aexnxf io1om ranvolt0 rxoimpiodlm   iei s)srum(mo;o0teeo o3tldfsDrauvsn() ltrmfcoodom  lnvols t2tmio3iodap nlncs (  rurxm ;t0oeto fctatfsDem(mp;(0 rxrircoytoa  auvi;t trxoxo iu4lptnlict t)s2rr(m no0tpeo ictadfaDuan o t4altoxf oytoa  aieols0teurirpnodape lict t aruaxmp;o4aee ii3tysfmDea(msnt4 eenxr3iatoptr i o;s0texo(r3ny1omtnmfetlt)sDtrum ;o4olxomoetadla rmu s;t) ltnir tydfpte uvs;()s2xr(r3iu1olt lfvsasfa2rau  oo1texo ieias a2ulums;u0aetomr3oadfpD  u o s0texrirpou1ope mnet t srrau o;u4opxnmfeilt m2umn snt0tltrxr3oatlatrli sl(  2xm(o iydal emfvsls aDrax  nt1apxnioeiyd m rmnmont0 etoif3oytfm  an i s t2tmirpny4lmt  nctlsf Drmumoou4tee moetlslm em(mon(4 etomf3totlm  ln o;( sexo(m oudlp n ietlsf Dtmum no1tltomfciyt s umump;t0altnmociadfa eaies;(0trum(rpiy4op  mncsas  rtaumpnt1tlt mf3ilslaDemuvo;t0texnxr oo1lmDrluesl( seurim ny1apte ivsls a2rrxmpnu4aee  i3ilt m elu p () rtnio iy1opteli s ( trxmim oydomt  nesl( a2uax p;o1tetoii3ilsfm rmumont4 eerir oadlptrlnes;s  etmir3oy4alt lfes (f rtaur ou0aeeo o3iatfm2eauvo;t0tltnxf3iodoa  ln o ( trxrxopiy1lpt mfetl(faruaxm ;t1teenmoetlt m ua( snt4 etoircootoaDr n o;(0 2toio nodlmen ieiltf rumxmpot4opxn ieiysls2uln p;t4tltrio io1oat lu slt  etoxo3nydam nmivi sf rrr(mono0aee mictld a2ua(mp t0alxnircoadfmDe uei s0 etrim no1aptnlnciat)sDrm(mpno0tet miciyslm2emums;u) rxoxf3tatopDelnvslt)trurxm ou4optnlivi s)aDrmumonu4tptn feilsls rl(ms;(0teeoif oa1fa rlnei;t)setrxopio1lmtn fetls)sDuax p;t0alx  feiatfsDeaumo;t4trxnio3tytfmt  iei
\ No newline at end of file
@@ -0,0 +1 @@
+u o ( s2umio3iydom  lneta( s2um(r ;u0aet io3iat m um(mo u)altniocta1fatraneils s2umxr3ny1ameemnvils s2rmur ;t1tlxnio3ilsfaDrlumo t4alxoxr3oa1oatrauvolt s2uoirpio4apen nvi t  Dta(mpou4alto f3ils a ulu p;u0 etrmf tytlmDrai o;()sexoimpoodlme lics ( srtr(rpnu0oltomiciad m2umu on()altnircoa1faD lieils  ruoxmpiodalt lnesl(fs2tax  nu4apx  f3iatla umu s t4 rxrxrciydomDeli o;( trxr(opnu1ap emfvia( s2uax pnt1aeeoioeiysls um( p;()teerif3tadoat au i;()texoxo3oy1opte fctls)a2tm( pou4tlx ii3ild a eanvp u)trtomr3ta1lateanvols s2xoxr3oy1lm  mietls srrm( onu1tee  f3iltfm2uau s t)tltoifciy1oaDelueo;( t2xrirpoo1ope mietls srtm(rpno0apto oeiydfmDrluvsn()aeerxo3tydfa e n i;(0 etr(o3io1lptemncs tfsDurxrpnu4tlx mf3iltlm em(msn() rxnir iytfa rlnvo ()sexm(o3oudoleelnvsat)a2raump;o4aexomo3iasfmDel(vsnt)trenmo ootfpD lu s ()t2um(rpny1ll n ivils a2raum ou0tle ioetatls rm(vs;u4arxnxo3tadom r ueo;t trxr(m3oodamt mnvi ( sDurxr ;t1aee  fetyt s2emnvp;(4arenio3oodfpte ies;s)texm(rpoodomtnmfctl()sDraurpoo0tleo ocils m2ul( p (0aetnxrcty1oatrlivs (0trxoxopiodomee fvsls  Dtmurp;o0olxo feild s2raumo t) rxoxrciodfmt an o;s t2um(r3oudalte fvt ( artru pou1olxo oeiltfm ran o;() rxrmocoydlat  n sls0srxoxr iudll e ivt (  2rmuro;o4opeomo3iyt a2em( onu4 rxnmo iydlm r ueolt) etoimpnydomenlnvi ()s2ua(moou0ape mfctasfs2rln p t0arxnio iytlat  n o;t) 2xoimpoo1lp n fvtl()s2um(rpno4tpxomieiasla eauvo t0aetoio3totfmDrlneo;s)truoir3iodom   fes s)a2rauroou4apxnmfciat a2elnvp;u4aeenif oytla   n sl()seumiopnu1lpenmivt sf rumumpou4tpxn ictys a2umuvpn(4aleoxr oadlmD  ueslt) euo(r iy1alee ncil(fsrur(mp;t4opeoifctldlm2ul(mo u)trtnxfctatfmDeanvo t)setmxo3no4op n ivsltf Drmx ont0tlt  oeiltfm umnvp (4 renxo oa1fpDeauei;t0trumxm oy1omtnmfviat)a2umxr nt4texnifeiad sDuln s;()tlerxr ta1oa rli s;s t2tmxr oo4lm   ieta(  rtmxrpno4tptomieiysfm2um( s (0 leoxfcoadfpD li olt seurxmpou1oltn fvtltf Drauro;u1ole iiciasfaDea(vo t4 eenio3totlmDelneo;(0tetr(m3oo4lmenlivsat  2urx pou4apeo oeiaslm ea(vo;u0arxnioctatoptran o t)teumxo3oodamtnmfes t  2rrumo;u0tlt iictysfs2um( p t4trxrmrcoy1omDr nes t0 exoxr3ny1om emivilt s2tmx p;t4apxo ictlt a2em( o;t0tetnxr oa1lp  aivi (0t2xo(o3nu1lmtemics () 2tm(mpno4texo f3iltfs emu p;u4arxoxf iodlmteai s;t) exo(r iudap emfvtatfaDumxmono1tlxniictyd m2umn sn(0alxnxf3oodoateluvo t0 rumxrpnu4aptnlieiatfarrax  oo4tetnioeildls2ua(ms;t4alxrir oodfa  ai i;t0 rurir3ou4am n nes s srraump;t1apx  o3iad s eluvs;(4artnxr oydfat  uvi ()teum(o3nu4altnlncil( aDumurpnu1tlxoioeiadfsDuln o u4trenxocootfmDe ivols setoir3nu4lle lics (f 2rrxrpnu4olt  fciysfmDrlnmpn(4altoxo oatlpDran o;( teumio oy1lp e iesat  2tau  no4oee iiciys sDemnmo;t4texoxo tytfp eai ols)texo(mpny4ap e ivs (  Dtru p;t1ale  ocilt m umnvo;t4alxnxr3tydlatr u i;t0tetrirpnu4ale  ncil()a2uax poo4aet  f3iys a2um(vs;u)aeerxoctadfate uvols0t2trxr oo1am  lnvtlsfsrrmx  ou1tltnmi3ilt a2emumont0tlenif3oy1oaD  n i t0s2umirpio1am nlfeil( aDumurpnu0aeeoiocilslm ra( s u0 rtrircootlmDraneo;t0truoim oodlptemietat  rraxrpnt1tltnmoctldls emuvsnu0teeomfcoo1oa  an ilt s2tmio3ny4omen ieils)a2rrxro;t4tpto fciysfm rmnvo t4altrio totla rli s;(0 2toxrpnodll   fesas)a2taxronu0aleo o3ilt s2rm(ms;u)tleoio iotop eli ols)setr(m3iudaptnlnciasfsrtaurono0aexn ieiasfm2ra(vpnu4 renxfctydopt  i s (  2umxopnodllt  fvi t) Dtaumoot0tptoifctldfsDrlu pn(0aetnir3iy1op elnvi;t0 euriopoydape livs ( s2ra(ro;o0ale ifcilt sDeln s;u) rxnxo3tadla e neils0srtmxmpny1al emies sfsrrm(m nt4ope ifciltlm2el(mp;(4artoio iodop e n ilt  ruoxr3iodam n fct sf rum( o;t0aee mieiysfaDemnmo u) etomo oa1opDraivil(0 2xrir3ny1openmivta(faDrrx pnt4tpt ii3ildfaDumumo ()aexoxo iy1lpDrlnvslt srxrir3oydopenliei sfsDra(rp;t1alx  fciytfa2rmuvp;u0 eenio tydlptrlnvo;t) rxriopou4openliei s  rrrxr ou0tetnio3iyd sDelnvo;t0 exrxrcootlm elneols trxo(r3nodlp  lfesls) ruau p;o4tlenifeilslsDranmp;t0 ltoxr3oatopte ivi t)t2tr(r iydol emnvias) 2raxrp;u4tpeomfeiltfm2rmn s;t4artnmf ta1op eln s s srxrxrpny1alen neilsfa2rr( pou0apeo i3iasfs2rau p;u0 ltnxo3totlp e i sls0 2xmxmpny4opt lnvslsfsrumum ;u0opxo fctadlaDem(mpnu0trtoif3tatfm e ivs t)srxrxmpnu4llen ieiat srtaur nt4apx  o3iadls umnvp (4trxnxr3oo1lpDelnvi;(0t2xrim3no4aptemivtas sDtrxmpoo1ale  ieiat a ul(msnu4tlxrmr oadomtr nvs;s) rtm(r3io1optnmnctltfsrtmx pou4aex  feiydla2rmuvo t)tlxoxociadlpteaivi;t t2uoio nodom n fcils  rurump;t4openmf3ilsfsDem(mo t0tlerif3io1laD  uvs;s)srto(m3nodaptn iesat) 2rrxmp;u0tlx  ociatfm2ul(vo t4treoxo3oa1om  li s;t srxm(opoydlm n fetatfaDrmuronu1apx mfeiat m2ulump (0 ltnxr3iytomDranvo;t srxmim3nu1amt lnvi ( sDtrx pou0olxn i3tasla2rl( onu) lxrir3todlptraneils)t2tr(o3ny4al   fei s  rumum nt1oetnmo3iad a rmnvpnu)trtoxrctodlpte neil()sruoio io4ol nmfvs sfa2rrurpou1alx mieildfs2rauvpnt4aexoif oadomt auvsls) 2tmir iydame  fcia() Dur(mpnt1oeenmoctatfm2rlnvpn(0 exrif3iadomteaneil()t2ur(opnu4lp elfes ( srrmxmpno4oet  f3iltfs elnvp u4trxrmrciotlmD anvsls0trtmxr ou4ll  mncsa(  Drrxm ;t4alxo i3tatfs ea( o t) exoirctodfa  auvsl(0 rtmimpou1lp   nct tfarrax  ;t1alt  i3tatfa2em(von()trenir3iy1fpD aieil()trtm(mpno4lmtnmnci t s2rrx  ot1teeoifeildfa rau p u)artnif oy1oateanvs;( t2uo(opoo1llt  fctls  2tr( pou4olx iieiat m rl(ms;()teenif3tytoate ues;t0seumxrpoy4lp nlnes (fa2um(rp;o0tpto oeiadfa2emnvo t4tetnxo iotlp raueslt) exrxr io1ol elivta( aDur(mp;u0oex  oeiltls ea( p;u) exnmo to1faD  ueol(  rto(r iu4optn fvi (  2ua( pou0tle  f3ils a2emu p;t)tltnmrciydopt  n o;()srtrir ou4lp elfvs sf rta(  no4altn ictlsfaDuau s;u)aeeoifcoodfaDelivil(0 ruoim3oo1lpt mieiat)srrm(  nt1texoifeiytfm2eanvp u4aleoxocoy1omt  iei t0t2urxm3ny4al n fvil( aDrrum oo1ole mo3ilsla2uln s;(4 lxomr tydfmD ai o;()seto(m3iy4opte nciat)aDuaump;o1altn oetydla ul(mpnu0 eeomr3ootlpD ai i;() rxm(r3nudome mfvsatfaDrmxmpoo4tlx  f3iyt a rmnmo;(4treomr iy1fmtelieo (0tetoxopoydlm emiciasfarraum oo4tptnmieias aDemn o;()tlxomf oo1fpDe i sls trxm(m oudomt livta()sDuaxm ;u0oltnmoctasla raumo;u4trxomocoa1fpD an o;( s2xmxo3iy1lp nlneta()s2tmxmpoo4altomietad s2eluvsnu0 rtrmociydla   n i;s0trtmxrpoodllt lics t s2rau pnt4olto i3iyt sDemnmonu0tlxrmf3ia1la eai il( seuoxm io1al e fei sfs2ur( p;u1teen feiatfaDem(ms;(4alxrxf oytlmtr n ols  eto(r3ou4llteliviltf Dtm(  ;t0texoio3iytls eaump;t4 eeoiociotfa eai ol() rtoiopoudamtnmfet (f 2uau p;u1aex  i3iatlsDulumo t4 leoio3iy1fa rlnesls0 rxoxm iu4op nlivsl( a2ur(monu4aexniiciydlaDrlums t0 exrir3tatfptrlues;(  exr(o iydoltelivta(f rtm(ro;t0opto i3tysls rau o;() exrmf iodoat auvi;s0teur(o iu1lm nlnct ()srumxrpnt4apx mi3tys s uan p;u4areoxr tytoaDelies;s)t2toio3oy4lmt licsl( aDumumpou4ale iociytls uanmpnu)tlxrir oo1fp  aues t  rtoim3oo4op  mfvt s  2um(m no4tet mfeiadfa2ran o (0tlenmo3iadfaDrlivi;s)s2trir3nodll  mieias)a2tauronu4opeomfcildfs raumo;t0tlxrmr3iy1lptr nvs (0tetr(opiy4lm n netls a2taxrp;t1aeeoioctltfm el( o;(4aetnio3oy1fptrlivslt)srtrir3nudaptnlici tfa2rau ont0tpxniietatla el(mp t4texrir3iatfatelieo ( teur(m no1lptelnes t)arra( ooo1tetn o3iadlm ean snu0texrxf3io1oa rlues t0texoio io1ol elivt ()srrm(mp;u0ope  oeiat m ul(von(4 rtoif3oo1fptranvil( trtr(r3no1aptnlnei (  Dumu  nt4alxoiiciydfm eln o t0 reoxo3oodlm r ivs (0t2tmir io4lm emfvta() Duaurpnu1aexnmoeild a umums;u0teeomf3oy1faDe ueo;(  etmxr iu1opeemfvtas  Dumu  oo0olt  feiltlm ea(ms t4texnmr3ty1opt lnei;s0 rxrxm3iu1ol n feia(  2uau  ot1tlt mfeilt a2el( o ()alenmo ia1lp elu i t tetoxm3nudamen net t) Drmurp;o1alt iieiysfmDea(msn(4altrirciadla  au s;()t2uo(r3iy1alt  fet s  2raumo;u4tlxo oeild s eanmo;t0alxnxfcootlaDrlu o;(0 ruoxm oudlpt licilt)arrmu pnt4ale ifctatfaDeauvp ()arermoctadfmD  u i s0 rxr(r iodlmtelnviat  2uaxro;t0altnif3tysls umumpnt4trxnxf iotfaD  nesls  etoxrpnydap  lfvtlt)sruauro;t0aleniociatfsDemump u0alxnmocto1fat  n sls)t2uoirpou1lleelfcsat)sDraur ;u4tlx miciyd a2ranvp;u0 ltoir todfmt lu ol( t2xoir3no1am e ivsls s2raurpoo4teen fcilslsDemnmsnt) lxrmf3oytlptr ueo t)s2xm(o ou1opeelies t  Dta(ro;u1teeniietld aDeau on()tltnir3oytlateau o;s)t2umxo ny4lleelics s sDurump;o0oeeo fetlslm2elnmp;t0trenxr iatfp   ues;t0 2xoxr oy4apt  fes (  Dua(rpnt1oleomf3tatla ea(mo;(0 rerxfcoadfatranvs;(0trurio nu1llen ivt s aDum(  oo4texomi3ild sDemumsnu0 ltriociydfp elueo;()s2uo(o oodlp e ivsat a2rm(  nu4tet  ieiyslm2ua( s (4trerxrciydlaDranvols)texmxm3oo4ol e nciasfaDra( ono1altomi3iyslmDra( sn(0tetrir iytlm r i i (0t2xr(r iu1omtelfct t arumxmpnu0oee ifciltlsDua(vpnu4altomo oydoatrauei;t  exoxm nu4lm emfctlsfsrtrxro;t1tpxn iciydlm raumo;()teerif3iatlmte uei;( trtm(o no1lmenmfctlt s2umu  ou4openiociatlm2umumon()teerirctotfmD lu sls0srum(r ou1ll emivtls)sDtr(mp;o0tlx  feilsfmDumums (0artoxf oy1om eaieils  2um(rpiu1lp emnct ( srrrumpnt0olenmiciysfa em( p (0 rtrmoctytoa  anes;t truo(o oydomenmics t  rtmu pno4alxn oeiat mDrlnvs;u)trtomfctodfatrluei t)srxrxr iy1ole mivtas)a2rmumo;o1tpx  f3tysla um(vsnt) lenir iadlm eaivs (0srtmxrpnudaleelieilsfartm(mpnu4aetomo3iatfaDra( s;()tetomr tadlptr ieslt s2xmxo nu4amee nvs ()s2trumono0oexo ociasla2eluvont0aexoxr oy1faDelneo s sexrirpnu4op   nct t sDurxm nu0tee mfcildfm2uaumsnu4artnmr3todomDr neolt0 2ur(mpnu1om emnvi tfs2ta(mp;t4tpeo iciatfmDemnmo t)teenmr3io1optraieil(  eum(rpoudomte ncsl() Dra(rpot0opx  iciltla2eauvsnt0alermf3tatop eanvs (  2xoxo3nodol   fvs () rtm(mp;o1tltoif3tys mDeaumo (4 lxnxr oadfmtranvolt0t2umxo3io1olt liei s aDrrxmpot0tlt mo3iyd sDua(vo;(0tlxrxr iadfmteanvo (0 ruo(m oo1oleelnet s)srtrxr ;o0ole mictldfm el(vp u0 eeoxo3oatfaDrlu sls0sexmir3iy4lpt  nvtatfaDtmumo;o0tle mf3tlslsDemnmont)arxnxr3to1faD ai slt0truoir ny1omtemncsl(fsDtaurpnt1tex  f3ias aDrl(vo ()aetnmf3oydomtr n s;t) 2xrio nudop n fvt s  Duax  nt4tle  fciydfs rmumont4tetrxr3tytfm elues s0t2toir3io1op nmfcs (f 2tmur nu0altomfcildfaDumnms t0areomf3oydlmDran o t t2xoxr io1amtnmfctl() 2um(r ou0apenio3iyslaDuaumo (0 lxoircty1lptr ivi;t s2umiopoy4ale mics t) rtaxmonu4texoifeilsla ul(vp t4artrmo ta1fpte ivi ()trxm(opno4oltn nvi t sDrm(m ;o4oee mictadfa ea(vpnt0 eenxf3oodfmD  ivs;s srtoxm3nudal  lnes ()a2rmu  ot0tpt iiciys aDelump () exnmrcootlate ieilt s2tr(opio1lle lfet s)a2uaurpnt1olt  ocias mDea( o;t)tetrmr tytfm e uvs ( t2trim3nodalenlfcsl(fsDra(root1tpxo fciaslsDum(vo;(4tetoxo3ta1fa rlu sl(0 2um(r3oydalte ictls srurur nu1oeenifeilsla2rm(mo t) lermrciotfatean o;()srurir3no1llt mfet t)aDrr(moot0oex io3iadlmDrm(mo (0artomf3tatla rln i;t) ruoir3oy4omt lnvs s aDrmxro;u0alenif3tad sDra( pn(0aexrxo ty1lp  lnvslt0 exr(o3iudamtelfct s s2rmu  ;t0oltoiociytfm rl(vo u)teeoxf3iotom rai i;()texr(o3iy1olt  ivsasfa2rau  ;u4oltoio3tad s2rauvs t) exnmr3ootlpDelivol() 2ur(o3io4apenmnvsasf 2um( pnu1oleomi3tlsfm eln s;(4aeerxo tatoaDr uei;t)srxr(r ny4ale lncslt)artru  ;t0aleoif3ildfa2umnvpn(4texnxr3oatomte uvo ( sruo(r oo1olte fcsa(  2ta(root4tptnmfetltla2eln p (0 eeoioctotlmDraneil()t2um(mpoudam nlfet sf 2rmur no0apxnifciys a2ulnmp;u)tlerxr3oy1opDeluvi;s0s2toxrpny1opee fvi s srtrurono0oee mo3iyt m elump;t4trtoxr oadfmtrauvsl(0 2xo(o nydape lfvtat) rurxmoot4olxo f3tldfaDrau p (4alxoxr oatfpD auvo;()srurxrpoy1am nmnvta(  Drmu poo4olxn ocildla2umump u0altoioctodoa eaivo t0t2tr(o3iu4amtnlnctatfsrtaumpot0oetniieiydls2em( ont0trtnxo oodom eanes s)texmxo ny4lmtemnvtls) Durxrpnt0apx io3iysfs elu ont) rtoxfcoadlatrlu sl() 2xmir3iudllt  nvils a2rr(root4teenifetltla uln on() lxrioctydfm ranvs;t texr(o3oudap e fctltf Dtr( onu1oleo o3tytla2emums;t4trtomr3oo1fpt lu ilt t2ur(mpoodlp elfesat  2trum nt0tlx ifciltfmDelums u)aexrxf3tydomDe n i ()s2umxr oudalt mfcsl(fsDtrxrp;t4texnmf3iltlm umuvpnt)alenmfcio1la eauei t  rxmio3ou4al  livsl() Dtru p;u4tex  o3iatfm2rmnvs t)treoxfctadlpt ai ol() exm(o3oudomtnlfciasf Drru pnt0alx iocilsfm rl( o u) ltrir ia1lm eaieol( seumxrpoydap n fcil(fa2um(rp;o1tex  i3iydlsDrmn s;(4trenxfcto1fat  uvi s)s2uoxm3iu1ll  mfctls)arrm( o;o1oeto fciadfsDuauvpnt4tetrmr oytlmDe u s t0sexm(rpno1lp   ivsatfarumx  ;u4oeeomfeildfa2eln s (0aeerxr iytfaDe ivs;()t2ur(opoodlptelfcsl()a2rau pnt4ope mo3ilt s ra(ms;() leoxocootfmtrlu s;t seur(m3ou4lmte nvta(f 2tax  nu4ole io3iydfa umn o;u4trtoif iytfat ai i;(0 ruoim3oudomtelnvt s) Drrxmo;t1optomfeiadfm2rl(mo;(0trtniocoatfpDeli s;()trur(opnu4amtelfcilt) Dtrumono4tle mfeiasfaDulumonu)teeomrcia1oateanei s srumir io4alt lnvtas) rra(  ;o1tleoifeildfa2ua( o;u)arxrmocio1omD auvi s  2urxmpnodamenmfeslt sDtm(r nu0tetnmo3ilsfaDulnvo;(0 lermf3iydfp r i i;s0srxm(rpiodll emneslt)arur(ronu1aeeniicilsfaDumn on(0aexnxrctadopDe u i;t) etoxmpoodoptnlfvi sf 2rm( oot0tet mf3tadls el(mpn()altoxo tydlpt ln sls  2xr(o3no1alte fesls)sDumx o;o1apeomf3tyt m2uauvs u0trxnmf tytfa elneo (0 ruoxm3iudal nlnvt ( s2ta(  ou4tetnmoeildfaDua( o t)teenxo iatlaD ln o (0 etrxopiy1ole mfctatfs2urxronu0ope mo3tad s2eluvp;t4trerxr ta1fmt an s s) rto(m3ou4ol n fci (fa2trx oot0oltn i3iytfsDemn pnu4 etoio3iatom eanvils0s2trxm3oy4llt  ncilt sDuax ono0tpxnioeias s raumont0aexnxrcoytlp  lueilt t2uo(m3oodoltn ivt tfsDua(m ot0ape ii3iytla2uln p;(4tetnif oa1opt lnes (  2urio3iodal elnviat)srtmx o;o1opxnmf3tadlaDrl( s (0texnif3oytfm eai s;t)t2xo(o oodaltemncsasf ruaum nt1optoio3ildla elnvs (0 rermo3ty1laD  nvslt s2uoimpoo4altnmfcias)s2tm(  nu4altnmi3iydfs2emn ont) rxnxo ty1fa  anvi t srtmxopio1apenmfeil()a2tm(mono1alxoiieiydfaDemnvo;u) lxoir iydlaD lues s srtoxr3nodlmenmiviltfsDtmxr oo0apt mf3iydfmDumnmp;u4tlxomrctotlp r ivi;t0setmirpnu1lmte fcia()artaumoot1oeeomfciysfa2ranvsnu4 exrioctadfmDrlieo t) 2umiopiy4ll nmivslsf rtm(rp;o0tle io3iltlsDea( p;u0aleoif iydomt livi;t  2uo(mpnodal n fes s)a2ta(rpnu0aex ifciasfs rluvp t0alerxfciytomDe n s;t)s2uoxm3oo4llt mnvsasfs2raxrpot0aet  i3ias aDrm( o t) eeoirciytfa rluvo;s)srumir3io1lm   feilsfsDuax pot1oetomo3ild s2ulnvp t0aetomf oodlpD aieo t0teumim3nydapen ivsltf 2rrxr ;t4tlx ioeiltfaDrmnvont0areoif iydlm   u s ()teuoxo iydape lnetas sDrm( pno0olto i3iyt s2umu p t) eenxf3oydla r uvi ()t2tr(o iu4lpt  feia( arrr(  nt4tle  fciyt sDrm(vont) lxnmr3ia1oa e u ols0trurio ny1omen nesls srrrx  ot0texnio3tytfs emu o u) etrmf oa1lmDraieol(  2tmir ny1am e icsa( artaxro;o1altnmi3tytfa ean p;u4aetrxr oytoptrli s t) 2xmxm nu1ll elnvsl(fsrrrum nt4oleniictysla2umnmo (0 rerirciadopt  ivs;s0s2xrxr3nydaleemicilsfs2urur ;o1opxnmo3tldlm ulums u4altoio ty1oate i ols s2xmim nydol   ictl() rrr(ro;o4olxomf3iysla ua( o;u) ltoir3oadfmDr nvo s0t2xmxo3iydamtemicta() Dumur oo4tpxomfeiasfs2rl( p;t4trtoir to1oa e nvsls  eumxrpnu4oltnlfct t)arraxrp;u4alxn fetyt aDua(vonu)aexnmfcto1fptranvi;s teum(o3nu4lptnmicslt  2trxrp;o0tleoiiciltls2ra(mpnt)trenif3oo1fmDeln o s)trtoim iy1ll nmfvia() Drrx p;u0teenifeilt sDua(mo t0 rerxf3oytopDeai s;s)texm(o oo4lm   nvt (faDtmumont1texnmiciyd m2rmuvsn(0treomf iatfm eluvi;(0t2trirpnodamtn nvtatfa2uax  nu0apenio3iasfa ea(mpnu4tlxomf to1fm  lies t trxr(o3iy4ap nlnci s)arraur oo0oltnmo3iyt m2ra(mp;()alerircoa1oaDelieil(0 exoxrpnydolen nvi t)aDrru ont1tle mo3ildlaDulu snu4alenxfctodfm raiesls  euoxr oy1amee ies s)s2ua(rono4opxomoeiydlm2ea(vo t0arermo iytlpDr nes;t s2trio nu1al  mnesa( aDra( ono1tpx mfeildfs2em( snu) ltniocoo1fptrlivi (  exmirpoo4lltn nes (fs2rauronu0apt mfetyd sDumums (0tleomrcoy1opt  ieol( truo(o nodapt lnet ( arrrxr ;o4aptomfeias a uanms u0 etrxf3totfmt lnvol()trur(r3nudal nlieiasfa2tm(moot0opxoiiciytfs uauvp t4tetrmr3iodfatrauvo s  rtmio iodop nmici t)aDta(  nt4apenifciltlsDemn o;(0artrif3tytlpt li o;t)srtrirpoodll  lfcta(f 2tau pnu4opxomoeiltlaDran o t4 rtrif iy1lpDrlu o;s0srtmir3ny1lmeemivsltfa2tm(rpnt0aetomi3iydfm2emu p () lxoio3iy1fm r neols s2uoio nodom  mnesas a2rru p;u0oexoioetldfsDelnms (0aetoxo oadfpDe u ols)t2xoir oudame mnvt s) rum(  ;u4olxo f3tad mDum(mp u)treoxr iodfmDeln o;s0 2xr(o ou4ol   fet ()aruaum nt4opt mf3ildlm2ul(mo;(4aeeniociy1oa e neil() exr(r ou1om emicil( aDtrx  ;u1oeeoifeils sDrmu s t) ltrio iatlatran sls)setrxo3nu1aptelivi (fsrtaxmpnt4oet  o3iytlmDrlnvs;(4texoxo3tadfpteaivi;( srtmxo3oodlptn ivslt aDurxmo;o4tpxn oeiltfs ran sn(4 lerxo tadfpt  i ilt tetriopno1amen ncsasf Drrx p;u4apx  i3tld a2umuvo (0tetrircoy1lm eauvil(  eum(mpiy4omt mnvsatfa2um(rp;o1aptomoeiltls2em( s;u4 eenxfciodla  lnvo ()t2xm(r oodopeelnesatfaDuru oot4alenmf3tatfm ulu p (4aexoio oatlpDe i s (0texrxr3oydlme licia()arraurooo4tet miciad aDrl( pnu4 reoif io1la e n ols)sexmim oo1alee fci sfsDtrump;o4aeeo fetlt m2eauvo u4arenmr oo1opteanes ()s2tmxr iy4ame mncs () rtmx poo4apenmfcias sDumnmp;() exnxfcoo1oa  lneilt trxm(opiu4lm nlnctat  Dra(rp;u1oet mo3ils aDemu pnu4 lxnmr3oo1optelieo;(  rtrxm3ny1oltemieias)artaumpot1aetn fciasfm2uanmonu)alenir3todfp rlnvo s)t2urxo3io1apenmfvs tfa2umxmpno0oeeo oeild s2eanmo;t4trxoir3iadopDrlues t0t2toxm no1omt  nct sfaDum(mono0apto i3iasfs el(ms (0arxoxrciy1fpDe u i;s t2trxo3iu1llenmnviatf Duax  oo4aptn ictytla umnmsnu)trtoxrciy1omDelnvs t t2toxm nydom nlneslsfsrumxroou4tlt ifctlslsDemnvo;(4 leoifcoatopD auvs s0srxoxmpio4ll elneiatf Dra(rp;u4ole ii3iltlm ul(mp t) rxnxr3ia1fp  aneo (0s2xoir3no1apte fes ( sDuau  oo1oetnmociyt a2ean onu4 rtnxf3todfpDeln il()trum(rpiu1lp   icsat  rrr(r oo1ope moctyd s2umu p t4aetrir3oa1omD lnes ( t2umxr3nudopt mictl()sDtr(  ou1tpeoiocilt s rl( o;(4trtrxr3tatfm elu i;s0sruo(o3iu4lltnmfcilt)a2tr(rpoo1oeeo ociltfmDumn p ()texomr3tadfm rlnvslt setmxmpoudlmtemiviatfa2taum oo1apenio3iys sDeanvsnt4trxomoctadfateaiesl() rtr(rpiu4opeelictlt) Dur( oot0optn i3tltlmDrluvont4 lxnxfcto1fm rlueolt) etrim3iu4amt lneta(f 2ra(rp;u0aexnmfcias sDem(vsnu)tlenmo3totoatr n ols0s2ur(rpoodaltemictat sDtmu oot0oet ii3iatfa ul(msn(4teeomocia1la rli i ()s2uoiopnudlpt mnctl()srtrurpnu4altoif3ils a rmumo;u4tlxoio iatoa rlneil( t2uoimpny1lmee nei tfarrrurpot0opxo feiad sDuanmpnu0trtnmr3iytlmD livs;t)texm(m3no4lpe lncs s) rtrx o;u0tptomf3tld m ea(mo;(0 ltnif iy1fptrau o (0setmxo3no1ll elncs tfartmxm nt1teto o3tld a uauvs t4artriociotfmtrau s s0tetoxrpou4ole mfvs tfs2ta(r no4tlt io3tlt m ranmon()arxnio3tydfmDeau s;t trtr(o iu1lmt lfetlt)a2rr(m ;u0tltnioeiyd mDranvsn()tleomf3ootomte n o t  eumxmpno4lp nlncsa() 2urxmpno1tleomicildfsDemnvs;() lxrmf ootopt  ueilt0texoxrpnudlm e iei tfa2rrur oo4aeeo o3iltlm uau s;(4areoifcootom r iei;t teurxo iu4lptnlnes t)s2raurpou1tee mo3iyt s ra( pn()tetnif iodfm elnvsl()setmxrpno1amtn ieia(faDurxrooo4tle moctltfmDuln pn(0aexrmo3todoa   nvs (0s2xrxr3iu4apee nes tfa2tax p;o1aptoiicilslm2ulnmp;u0aeenmr oatlptrluvi t0tetmir iydol nmics (fsrurumono4aetn fetldfmDuluvo t)alenmo3ootfmDean sls0srumir iudll n nvslsfaruau p;u4opxn f3tysla2rmnmsnu4arerxf3oodlpDrlnvil(0t2trxopiydam   ivs tfsDtrxm ou1aeenmoetatla2ea(monu)arxnmo todfmtrlivo;t t2xmxr ou4ale  fvsas) rrr(m ;o0ape iieildls ra( o u0tltnmo3iydlpD  n i;(  etoio nu1opeemfctas sDuaum nt1tleoifctas sDuanmo;t)aeeoxo3oodlpDeaueolt)srumxm oudap nlnvsas)a2rax o;t0oee  oeiysfa ul(ms;(0 leomrcto1lm ean i s t2tmxo iodal emnvslsfa2tmur ou4tpt  iciadlm2uanvsn(0aleomf3oodoa ranvsl() etmxr nodame  netat  rurxmp;u1altn o3iydfa2el(vs;(4tltrxrctytomt  nes (0seumiopoy4lmtemnei ()aDtm(mpot0olx ifcias s ulnvpnu4areoirctodlmtrln sls0s2tmxo3iy4altn nesat)srrmxm nt1ole  fcilt mDuln pn(4tlxoxo iytfate ues () rtmio iu1al nlncsasfarrrxr ;t4tpe mfcils a emn pnu) ltrirctodfate nvil(0seumir3iy4oltn ieiat aruaumono0alx io3iysls2ua( p;u4 rermf3iotlp elu olt s2tmio iy1ape micsl( s2rmxmp;o4oexo oetltla2umuvpnu) etomf iotlp   n ils0t2ur(mpiu4ameemfetlsfs2ra( oou4tlxnio3iyd m2umu s (4tleniocootfmteauesls srtmiopiu4ll nmivsasfarrmxmp;t1teto ietlsfaDrauvs u0areoxfcto1fpDelueo;s0tetmio nudlmt  neias)a2raur ot0apxnmoeiyt a2umnmpnt0tlxrir3oo1om raneolt)s2toio3nydapt  fesa() Dua( p;u4apt moeiyd sDrl(monu0arxrxocoatfa eaivo;t teuoxo3iydomeemieil(faDurxronu0oeeoii3tlt m2ea(mo t4 rxnmr ootfmtr u slt truoiopnudomtnlncsa(fa2rm(monu1oetoiociysfsDulu pnt4 etnmo totlm rlnvs t truoimpoudlltnmicilsf rra(root1teeomfciyd a ea(mpn(0alermf tatfa eanvols0trtmim iy1llee ivilt  Dumurpot1apenmociaslaDrl(mon() exomrcoatfpDean i;t  rxmim3io1lle mnet () 2rmurpnu4apt mf3tltfsDuanmpnt) reoxf ootlmDrluesls) 2xmio oodlpee fcils a2tm(mpno4tleomo3iyslmDem( o;u4altrifcootfa  lueils srur(r ou4ap nmfvi s) Dumx  no0oltniiciat s eau s;u4tlxnif iatlmD lueils)trtoio nudale  fei sfarrmx o;o0tlto fcias s2ulnms;(0aetoxrctodfate i s t0sexmio3iodamte ict s aDur(m no4oee iociasls el( s t)trermr3iytlp e u i ()teum(r3iy1lltelivtlt  Duru poo1aetoifeiyd mDrlnmp;u0altoxr3iadopD  nvs t0t2uoxr no1ll nlfctlt  2rmump;o0tee mfeias sDrluvont)alxoxf3iotopte i ils0teumxr iydlle  nctls  rtaxrpno4teenmfciyd s elu o;t0trxnmf3io1lmtranei s  2xm(m iy1ope lictasfartmuro;u4opx mictyt m2rmnms u0tlenio3oydlmDrau s ( sexrio oo4al   fei (faDtmurp;u0tleomiciysfmDea( p;t)alermo3ootoaDr n ilt0 2xm(r3no1aptnlnvsas) Dumum no4alxnio3iadla ul(vsn(0alxoif iadoatranvol(  2um(r3ou4lpeemfvsls aDtau pnu1olxoiicils aDrluvpnt)trtnxociydfm raues (0s2um(r3iu4llt mfcslt)arrrxm ot4oet mociydlaDum( o;() leoiociydlatrau i;t) rumimpnydopte iesas aDururont0aex mfetydla rmumsnu0 eermf3ia1laDr u ils0srtmirpoy1op eliesl( s2rrxrp;o0oex  feiytlmDemumpnt4 rermf totlaD luvols srum(mpnodam e fvt t srrr(r ;o0texn i3tlsls ea(ms;t)aexnio3oa1lpte neslt)s2urio3ou4apt mnei s  Dtm( p;u1alxomfctltlm rluvp;u) lerif todomt luei;s teumxr3iydomee icta(faDtm(ro;o4aeeomfciydfs rmnmon()areoxr3ta1la raies s0teuo(mpiu1lpeelfes tf 2ua(  ou0aeeomiciytlaDum(mpnu4alxomr iadlaD  ueo ( setr(m3ou1ap emieil(fa2tm(mo;u4aexomfeiadfa2emn s u) exoio3oydlaDe ies;(0s2tmirpio1lptnlivtas sDumx p;t0olxnmi3tlslm2umu pn(0 lermr3ia1fmD  uvo;s0 2xr(opiu4alt  ieilt) Drrxro;u4apxoioctydla2rm(mp (4alxrxo oytoaD aueo;() 2xoio3iydomte fesat)s2tmxro;t4alxn octysfm ulnvp;(0trtomfcia1opDe i i;s) 2tm(r3oodlmee fet tf Drmu  ot4aptnmoctytfs2eaumo u0arxoiociy1oatelu ols)trur(o3oo1apt liciatfa2tmx p;o0oet io3iydls2rmn p u4 rxnxo3iytlpt ln i t s2um(r nu1ap nlnvt (fsrrmxr nu1oexomfciatfs2ra( sn(0tlxrir3oodfatelnei;s)trtm(o3iodaltemieia(fa2truro;t0tet ifciydls rmuvo () rtnifctatfptrlu i s0seuoio3oy4lltnlictlt)s2tm(mpot1tlxomociltlm ul(vont4aexniociydopDraueo s)t2xm(m3oo4openmnvs t  Dtr(rp;t0optn ieilt mDra(vo;t0texrxr3tytoaD lneo;s0t2trir3oodap nmivt tf 2rrxrp;o4olto fciydlsDeau pn(0 rxrxo ia1lp r ieo;t t2tmim3oo1om   feslt) 2tau pnu4opto f3iasfa ulnvp;(4alxrio3iodlaDeln sls)srur(o3no1lptn nei t srtm(  ot0tleo ieiatlsDeanmpnu4tetnxf ia1oat li ils trxrxr ny4optelnvtas  Duauront0oeenmiciytfa emuvp t4tetrir oatop r i o s)srtmxo3oudaltnlicsa( s2raxm no1altomfciydfa2um(vsnu) eeomo oodoaD auvs t)t2xo(opny1omeemfctat)s2umxmont0teeniietld m ranmo u0 lxomo tytlpte n s s) 2trio ny4amt mnct sfa2umx pno4tpe  iciydlm2eanmp u)tlxrir3oydom rauvi;t0teum(m3no4alt  nesas sDurxmpot4tlxo feilsfsDul(vp u4 etnifciydfaD aueo ( trtm(mpno1lm e nesls sDrau  nu0olxn iciyslaDul(mp t4alerxr3ootoa elivi;(0 rtmxm oydlle mics t) Drr( pno1oleo iciatfsDua(mont4trxrio3oatfp r i o t) exoxo iydapeemncs t  Dtauront1oleniieiydfmDemnmpnu4tetoxo totfmDrauvo;t) etr(r3io4lpeemnvsatfsDrrurpno0apx io3iys s2ua(mp;t)trenmr ta1fmD lu i t t2xmxrpoydlm nmfvilt)aDra(m ;o0olenmfeiydfs rm( pnt0trtrmfcto1fp  luei t) exoir ny1al nlict t  Dtru  ;t4tlxoio3iatlmDua(ms;u0 renmf ta1fmDr u o s sexmimpoodomenmfetlt)aDur( onu1opxoioetlsfm2el(mpn(0 ltnio ia1lpte ivo;(  rxmio3oo4al e iei sf Drrum ;t0apt mo3iatlm2rmumsnu) lxrio3oodoatran slt) euoxm3iudomt mfctls)s2tmxr oo4oee iociydfm rau p;()trtnxfcoodfa rlueolt)t2toxm3nydalte fcslt  2ta(r nu1tltn oetatfm rmuvsnt4tetomoctadfmteaivs;s  euo(rpou4lme  ics s)aDtr(ro;t1oetnmi3tytfm ua(mo;t4trtnmf3totfaD livi;s)sexrxo3oy4ll emfcta(fsrrm( o;t1teeoiictatlmDuanvp;(4tltoxf3oydoaD  uvi s0truo(mpny1omtn fcsatfs2tau pno1tlxnmi3tyd m2um(mo u4texoxf todfpDranvsls  2triopny4ll nmfvsl()s2umx pot4alen fcilsfmDrm(mo;u0 leomf3iytlptranvi;s0seumxo3nydlpen feilt srtmump;u4openif3tas sDua(vp;u4tltrifciodomtelneils) 2tr(m no1lp e ictasfs2raur ;t4tltnmociydfa em(mp () lxnmo3iadlmD  uvi;t)texmxopiu4op e net ()artru pno4aetomf3iltlm um(vp;u4tltnifcto1omDe ivolt) rum(m iodll   fvtl()a2tm(  ot1tpt  feiat sDuluvs;u0texrif ta1fa elivilt0tetrxr3nydlpee fvt sfaDrmu o;t0tpeoifctydls2rlu s (0trtrmo3to1omDeauvs;(0sruoxm iodaleelicils) 2tr(r nt1tee mi3tadlm2uau s;(0alxomo iytfmtelivo s0srxm(r nu4omtemnviat) rra(  ;o1tlt io3iaslaDuluvsnu0aleomo3iatfm e n ol() 2toirpno4opte nvi ()aruaurpno4oltomictadfsDrlnvo () ltnmr oytlp r i o;t  2umxopio1am e feia(fa2tmxmp;u1aptn fetadfa2eanmo;(0 ltnio iytfm raues (0tetrir iu4lp emfet s a2ur(m oo1olxomi3iasfm2rlu o;(0aeerxf3ia1laD lnes;( trxo(o3io4lpenmfvil() Dtr(r ;o0aetomfetydfs2elnmonu4 exrmoctodfpteauvs;s0 rum(opoodlm emivtl(fa2uaxmpot4texo ieiytla uan o t0 rtoircto1opDeaues;( t2toir oodll nlfcsa(faDtmum ou4ope  i3ias m2uauvo (4trtrif tydopDrlu il()s2umxr oo4llt mneta( srtm(mo;o0oeeoiiciltlmDuluvp (4 reomrcta1omteaneol(0texoxr3nydap   nesa()s2ur(mo;o1tptoiieiydfm rlnmp (4trenircta1lateliei t)t2tmim3oydolt  ivtas)arur( oou0tpt miciadfmDrluvon(4tlenxo3totop ean sls teumio oo1amee ncs tf rurxrpnt0opxn ociatfa eaumonu) rxnir3tytfmDraies;( tetr(m3nodol  lfesl( sDraum nu4tee  i3iad m rmums u4 lxnifcoy1lpDe nvols)t2uoxmpoy1omeemfcs t  Dtrx ooo4opxo o3ilt aDrm( ont)aetoxo3tytom   uvs t  euo(m3iodom emfvta( s2taumont1opt io3tad sDea(vo (4tlxnirctydlaDelueol( t2xmxm ny1am  mnvil(fs2rru pno0olen i3ilt s2um(monu4areoir3tytfmDeauvo s0s2tmxopiudop n neiltf 2tau p;o4olxo oetltlm2rlnms;t)artrif3tydlateaneils)truoirpnodlme lieta()srua( o;t1olxniocildlm2uaumsn(0aleoio totlm raivol()sexr(o no1lmenmiet t  2uaumpou4olxoifetyt aDemuvpnu0trxoxoctatfmDrluvi;()trtmiopiu1ope mics tfartr(rpou1altnmiciasfm el( o;(0alxrmr3oatfat aieslt trtmir iodlp nmncils)sruaxrpno0texn o3tld m2elnmp (0artnmrcoatlpD  uvo;t  ruoio iydll e fei t)sDraxront1ale moeiatlaDumu s t0texoircoo1omD  ivs;s) rtrxr oudope  nvsatf Dtm(rono1tpt ioetlsfs2rln pnt)alermfctytfat aueil()setr(m3oy4lp  lfvia() Dra( p;u0aleo oetlsfaDranmp t4 ltoif3todfm r n i;t s2xoio oodlltn ivsa( srtax o;t4tltniociydls rauvo;t) lxnmr3oa1fmDrai o ( texm(opou4lmtelnes s aDtaump;u0tlen fcias s eauvs;u4 eenif tadopt aivil(0trxoxopiudom  mfcslt) rtmxm ;u1oetnmfcildlsDel( s;()aexnmr3ty1omDe uvsl( texr(r iudamtelieils sDtrx onu1ope iieiyt s2ran snu0tleoir3oydfa  lnes (0t2uo(mpio4ole liesat)sDtmuro;o1aeenmi3ilsla rluvo;u)alxrxr iotla rlu olt tetr(r oydlle  icsl()aDrmxr ;u0oetnmf3tad mDel(vo ()aeerxrcio1fa r ivsls)sexm(m iy1omenmivsl( artmx ont4opt mfeiyd s el(vo;t4treoxo todlatr uvi;( s2ur(opiy4lmtnmfes s)srumx oou1tet iictas m uanvp;(4altoirciotomDeai sl(  2xrxo no1omt mfctat)a2rmum nu4aeeo f3tys m2uauvo;(4trtnir iodfm rlnes;s)sexm(r3ny4om  miesat s2rr(rooo0ope  ieiadlmDumnvs t0artrmrcootla r uvo;s  2tmio3oodomt mfvs s sDrr(  oo1apxomfeiasfa rmu onu0 renxr3ta1fmt aivs;t truo(rpiy4lleeliviltfaDrmuro;u0oetnmiciat s umuvo u0trxoxf iadfmDrln ols)sexr(opoo4ol elncs () ruaxmonu1tleoifeiadfs2eluvonu) reoxf iodlaDe ivo t sruo(opnudlmte ies sfa2rr(r ot4tltnmf3tls m2umu pnt4 exnmocto1lptrauvols)texo(o oy4lmtnmnvsl(faDuax oot0opt mfeiydfa2ulu s;u0 eeomociy1om e i o;s0 2umim io1omeemnct sf 2taxrpnu1aeen fciatfsDrl( s u)trenircoydfatean ils)trurxopio1amtnlnvtat) 2raumoou0alt iietatlaDemnmp u0 rxnxo ootlatelivsl( s2tmir oydomenlieia(f Dumxront0oee ii3iltfmDelu on(4 eenxocty1oa eauei;s s2toimpiy1lltnliesls srtrum ou4opt mociyd aDumnmon()arerir tytom  ln s t)teumiopio1llen fei s)s2taur ot4tleomoeiysfs uanmpnu4 rtrir3tytlmt livo t0srurxr oo4lltnmieils)aDrr( p;t0tpeomf3iyt s2um(ms;t)tlxoir iadfm rai il( setoxopiodop nmnes tfarumxmpno0alen o3tyt a2uan onu)alxrxocoo1opDelu o;( setrxr nudoleelfei t sDtmu poo0oeto fetysls2rlnmont) rtoir3iadfa rai o s  2xm(m3iu1oltelfeiat a2taumo;o0tex  oetldla2uluvsnt4arermfciadop e n o t  exo(rpnu4omtn ncia()aDtr(r ;u0tlx mieiysfs2eanvp;() rxoifciotlm  lnvo;s sexrxo3nu4ol eliet sfsDtrum nu0apx ifeiatls ul(vpnt0teerio iy1latr neol( teumxm nodolt lnvtas sDurxrpot4alxn fetadfaDumnvp (4texoioctytlm elueo;t0s2umiopiu1lmeemiesa(  Duaump;u0oexomoctltlaDumump;u4areoxrcoy1om eai sl( t2ur(rpio4op e ieia()aDrrump;u0tex  feild a ranvp;u4altnxf3ia1omDe ueo t t2xm(rpoy1amtnlici t) Dtaum oo4oee mi3iysfmDel(vsnt0trxoiociotlat an ol()seurimpno4amt  nes ()srrmum oo0optn iciyd a2emuvo u)arxrxfciatfp eanvsls0t2tr(m ny1oltelfci t sDtau o;u1apxnii3iltlaDul(vp ()aeerio3oo1optelivi;s t2xoim iydlpe mfciatfsDum(mpou0tlx mfeiltfaDrlnmo;u0altrir iytopteli olt0teumio oodlmtelies s) 2umxm nt0ale  ieildfs2emums;(4tleomf3totfpD  nvilt)teurio no1om  mfvias  rrmx  ;u1tex  octydlaDra( sn(4 lxomf tatom rlnei (0s2xrio3ny4omeelncsas)a2trxrpot0apenio3iyslm ranvsn(0 lenmr iadfm r ueo t0srtoxm3no4llenmfeta()sDumu  no0tpenioctyt aDel(vsn(4trtoir iy1fa rlu s s) eurir iy1lpe mfei (  2ur(rpot1ale mieildls2ulump t)texrmfcia1omt auvs s) rtrxo3oo4lp e fetat  2rr( pno0opt mfciadfaDuaump;(4 eeoio oo1lp e ivols0 rxoio3oy4lpe mics (  2umxrpot1tlxniicilt s elnvo (4artrxo3todopDe n slt teuo(rpoudoltnmnesl( arrau o;t1olxo ieiltfs ul(ms;(0 rxrxr3iy1lm eanvs s0srxr(m3no4optnlfctas)sDrmu  oo4apt mfciaslmDulu p;t)aexnxr oodla rau o;s)teurxo nodomen fvs sf Dtax pnt4ope if3tas mDean s;(4 lxoifcoy1optr ueolt0teur(r3nu4opeemfeslsfsDum( p;o4teen feiydls2ua( snt0tleoio iotfatelu s t setoimpoy4lmen nes sfa2ta(ro;u4optomi3iltlm2emnms;u0alxnxfciy1fa e ivilt) rxrxm oo1lp emfviasfaDurxrpoo1oet  ociatla emuvpn(0 rtrmf3todfa eaieols sexm(o3io4lmeelnctltf 2uaxm oo0tee mfeiatlm uauvpnt0altrio3tytfmD lu o;s0 2urir oodamt lfci tf Dtmum ou4oleoioeilsfsDra( o;u)arxnxo3ty1oaD  ivilt0seto(r3iy4omee feta()a2tmu oou1opt iociasfa uln pnu4 eenxo iydlptr iei t)tetoxopnu1aptnlicilt srurumonu1opxnmi3iydlmDuaump;t) lxoiocoytlatrlieo (0texoir3iy1lptn ict (fsruru p;u4tpt  ictas s eanvsnt) rxnxf oa1fa  luvi;t srxmxr3iu1apeelncilt)srtrumo;t4oexnmfeiydfsDulnmp t0tlxrxf tytfatrliei ()s2xoxr ny1ape  fctls  2uax oot0oleomieiysfmDelnvo t4alxoxf iydfpDe u ol()srxoimpiy4apee iesa( a2umxrpno0tetomo3iltfa ul(ms ()aexrmocoodfaDrli sl( texrim3iudalte neslsf 2ur( p;o1tlt if3ild s ran o;(4 rxnio iatfatrli o;t) 2trir3iu1lmee feilsfsDumu p;u1tlt ioeiatfaDulumo;t) eenmf3io1lp  livsls trxr(o io1apenmnvtlt)s2ta(rp;o0aexomoctltla2ra(vo ()altnmr3iydopteluvi s) 2xoio3oo4ol elfct s) rraxrp;o0tlenmfeils sDrl(vs ()trtrmr iatopDelnvsl(0trurio3ou1optelfvtls)s2tr(r ot4oeto ieiysla2rm(mo t0 exoif3oatop raueo;s) rxr(m3oydlpenmicia(f rrmumo;o4aeenii3ild s2ra(vpn() rtrio3ty1fpDeaieols0srxrxr3iy4lm emfeta() 2rrxrpou1tltnifeildlmDulnmp;t0alerxfcoydfa   nvs;s0 rtmim ou4am   ivsa(f 2rr(m no4oeeo oeiyt a2elnmp (4trtrmfcoadom  aivolt) etmir3iodoltnlfcs ( sDua(mpou4tpxoifetatfa2rluvp;u)texrio ty1fpt lu o s0t2xm(m3oydome mnvilt  2ra( pnu0oeeoii3iasfa elums;t0 rxniocootoaDeaieo s) etm(m3oo4opt mict t  Dtaxmoou1oex moeiytls rmumsnt)trenxo tytfa  lueslt)s2urirpou4omeelfvs s)artaxro;o1tee iociaslsDrmnms u)tlerxo tydfmtran slt s2tmxrpoy4omenmfci t  2trxr ot0apx ioctaslaDemuvsn(0 exnif3oa1lpt ln slt sexoxo iudap nmfes (fa2ua(m ;t0apt moetatfm rl( s;(0 rxoio iadfmt lneol( setmxr oy1lmenmiesls)s2taxmonu0aex  o3iltlm ra(vp;()aetnxociydopDeaies;s0 2tmxr3ny4openlnvsls a2um(mooo1oeenmo3ils m rmums u)aetniociadlaD  u il(0teur(rpoo1llt mnvt ()sDrru  ;u4alx  iciadls2um(vpnu) exomocio1faDrlueo;t) rxmxo3oo4llenlfetat)srra(m ;u0oltn feiatls umu snt)aetrmf oa1fmt  uvi;(0s2trir io1ol   iciat srrr( pno4olx  feiasfs2rmumo;t0 rtomocia1fateanvs s0s2uoimpnudop   net s)a2tmxmp;o4olt moctyd a2um( ont0 rtoxr oydfm r u il() rur(m3no4lmen nvsas) rraumpno1oetnmoeiytla2el(monu0 rxoxr3oytlateaieo;()trurxo oudomt mfvs t s2tmxmo;t1apxo f3iyt m2emumon(4teerir iotlatraneil()trtr(o oudal   ivsls sDrrxrpno4ape mociadla uau p;(0artoif3oodlpD au ol()teur(opnu4llt  ietatf Dtm( ont0teeo octydfsDemuvpnt)artnifcty1lmDe uvols t2xr(rpnodom  mnei s sDurxrpnu4tlt  i3tydfs2uauvs;() etrircio1fa r nei;t)seto(m3no1ll   icsl( srtmxr ;u4ape mo3tlsfs2rm( s;t) rtrifctatopteanei;t0 rxmxm3nudlptemfes tfsDurxmp;t4apx mo3ilslsDulnmp;t0 rxrioctatfp  auei s)s2tmxo oodoltelnvsatfs2uax pot4aee io3ildla2umnms;u)alxnmf3iydoptr nvo t)teur(r3oy1llt mnci ()aDrr(rpoo0tlt  icilslaDrm(vo ()altoir iydfaD  ueols0seumio3iu1aptnlieslt)aDumurooo0tpenioctatfs2rmnvs;()aetnmocoytop   nvo s tetr(opoo4ame  icsas aDuaurpoo0aee iietasls2uaumo;(4aexnmrctytfatrauvol(0sexr(o iudomeelnet t) Drmxr oo1aleoii3tytfa2rmnvsn(0tlxnmr tadom   n i;t)s2xrim3iu1lle miei () Dtm( poo0olt ii3iydlmDrauvo t0aeenxf oadop   ueol()srtmio3ny4am   fetat aruaxr ;t0aptoii3ildfm2umnmo;u0alxnifcoodlmteluei;(0teurimpnodape licsls) 2urum no1texn oeiysfs rm( p u0 rtnio3iadomtean sls0 rtr(rpoydlpe licsl()sDurxmp;t4tpeniicilt m emnvon()altrmf io1fm rlieils trxr(o oo1openmfes (f 2um( oou1oleomf3iytls eanmont4aexnmfcootfa elnes t)t2tr(r oydol  lncias) 2rau poo4ale iietltfm uau o;(0arxomfcio1fat  ieo s)truoirpiy4ole mnvil( arua(monu4apxnii3iad m em(vs u)tleoxo3iotlmD anes t0t2trirpio1lm nmfvia( sDtaxmono4aeeomoeiydfsDrl( p;t4 rtomfctodoa  livo (0teurxmpoo1lp  livsat srta(mpot4optnmf3iad s2uaump t)altoio todlm e nvs;s s2uriopny4omeemncias)sDtmumo;o1olxomfeiltfm2ua(mo;()aeenmf3io1lpteai ols) eumimpoydlmee nei s) rurxmonu1apxnifeilslm ra(von()arxnxr oytoatelivs;(0 eto(rpnu4apt mnei ()aDrauro;t0tpen fetas m2rau o t0tlxnmrcoadlm raieols  2xo(r iy1lmen fesa()a2ta(  nu4altn i3iad a uauvpnt)aeerxr oodlm e ueils0s2trxm iudol n nvs t aDtmxmont4apxnif3ias sDel( o t4aetnir iodoaD au sls0t2toimpou1alte nesl(f Dum(  ;t1oex  octasfa2emnvp;(0treoxrcoo1fp   n i t) ruo(m iodol  mivi (fs2umx o;u4opxnmfetys sDeau p;u) etniociydoa   neols)srxr(m nydlle  neia(fsDurumpoo1aleo f3tldfm rauvs t)tleriocio1opDrlieils)sexmxo3iudom   nvtls)srumxr ou1alt ioeils a2ulnmont0texoxo iytfatr i o;(0seuoxm nydamt lieils)sDrrx oou0tltn oeilt mDum(mp;t4trtnmf ootlmtrlu s;(0trtmir3iu4om elfet ()arrmx  ou1aex ifeiadls2eanmo;u0trxnio3oatlp r ivs;s0trur(opnydamtemfeilt) rrm(rp;t1aleo fetad m2rmnvp u4 rxrxocoo1om  lneo;t0trxrxrpiodam   nes ( aruauront1alt mo3ilsfs2eauvo (0 rxrirctotlm r ieilt seuoimpoy1alte neiltfarurxmono4aee iocilt mDumu o t0 ltrio3to1lmtraivi ()sexoio nydameemneta( sDumur nt0oeenifetysfa elnmp;(0trtniocoo1fpDe ivilt)setoxo iu4lmtelncil()srrrx ont0altoifctasls2ra( p;t0trxnmr oytfp   nvi;() eurxm3ny4lpeelfvia()aDrru o;o4optomoetlslm rlu s (0tltnmo3ia1lmteaneils seuoir iodll emfvta(f Duaxm oo4aex moctydla ul(mpn(4 eenmo iotop  aneil( s2ur(rpou1al   ncsatfarrm( oou0opeomi3iasfs ulumo;t)tetoxr3oytoa elu ilt t2toirpoo4oltelivsa(fa2umx p;o4texnmfeiasla elu ont)trxoxo tytlaDrlu o;s0trtm(m3io4amenmies ( srur(ro;t1olto fciltfsDrmnms;(0 lxrmfciatlmDraivi () eum(r oydam  lies s a2rr(r nu1tpxo f3iysfs rlnvp t)teeoxo tadlpD luvils0 rumim iy4amen ivilt s2umx p;u0oexomfcild a2elu s t0 etomf iotoate ueilt)seuo(mpoodaptemictls)a2rr(  oo4oet ii3iytfa2eluvs;u4teermf oytlm rau s;()t2trxo iudalenmfvsat)a2rmu pnu1opxnioctlsfsDrl(vs;t0arxoio3tadop  aivi t)trtmxm iu1lme lietlt)sDrr(  no1opeomoetadls rmn o (4trtriocta1fm r uvs;(0 2tmio oo4lp elfct ()srtr( o;t0apeo o3iltfm ul(vo t)altoxocoatfpDrln ols sexmxmpoy4olenmfcilsf 2tmurpou4aptomi3tltla2ulnvp;(0altomfcty1lmD  i o ( trtrxo3oy1amt livslt sDtaxmooo0alxomfctatlm2emn o;u) rxrmfcta1oa   u o (0teuriopoodam nmnvtlt)sruaumpoo0tlenmf3iydfm2ul( o u)aetnxr3iadla r neils) 2tmio3oy4lptnmnvsls) 2ua(mpnt1apto f3tltfa2elums ()aetnmf iotfatr uvol(0s2uoirpnu4alee ncs tfsDururo;t1opxniociydls2uluvsnt4alxrif3tydfaDr i sl()seur(r3iy4olenlfctltfs2ta(ro;t0tpxo ieiaslm2umn pnt) reoiociatoat  i s;t) etoio iy1am e iet tfaDur(  ;u0tpe mfctytlmDul( snt0 etomoctotlpD ai o s  rtoio3nodopen fctasfa2taxrpou4tlx miciat s rln ont0 lerxf oytom rauvi () 2xr(o ny1altnlfvtlsf rtr( p;u4opto o3ilsls ulnmo u)tlermf oodlm   i o (0 euoxo oo1amtnmnvta( a2rrum ot1texo ociasfaDuan ont0 exomo3iydlptelnei s  euoxmpoo1lltn fetls  Dtrxrpnu4oexn ieilsls2ulumsn()areoio iodlat livsl(0setrimpoodlpt lncsa(fartrxmo;u0opx moetls aDrm( sn() rerir iytlaDelieo;s srtoxo nu1olt mivtlt)a2rmxrpou0apeo fetldla2rmnmo (4 rtomoctydla rlnvs;t0s2tmxr nydaltemfctltfa2trumpnt1apt iietld s2rl(ms (4tetrxo3iatfpDe i s (0 exmxopoudlmt mncslt aDuau p;t0tetoiociasfa uauvpnu4arxrmr iatfpD aivo;s) rxoxo oydlmtemivta( aDua( pou1texo ociatfm2ulu s;(4trtnxf oo1faDr ieilt) ruoim oo4lltn netasfsrrax p;o4alxo fetldlsDrln s u4teeoif3iodom eai s;s0 2um(m ny4om emnvilsfs2umurp;t4altniietasls2ulnmo;u0texnxr tatfatelnvsls) exmim oydam n ncias)s2rmxrpno0oetn ieild s2em( snt4teeoxfctatfat ln o s srxo(m3nydopte nvtasf 2rm( pnu0oetnifciys aDrl( p (4 leoio ta1opDeln o ()texmim3oy4ol   feta( a2ra(monu0tlt mi3iad a2eauvsn(4tltoif ta1faDr ivs;( srxr(m3iy4ap emfes s) Drr(rooo4opxo icilslmDua(ms u4 eerir3ia1latrlnesls setrxo3iy1ap  micsl(fa2tm(m ot1opto fciyd s2rmuvp (4 eeomo totfmDrlivs;t texmir3oy1amtelnesat s2tau ont1opx ii3tadfmDel(ms t0aetoif tytfmte uvs s setoir nodlpte nvi tfsruaxr no0oexnmoctys s2rau pnt0artoioctadomtrlnvols)texmxmpny1ameemietl( s2raxronu1aptnifeiydla2uln pn() rxrif oadopteaivi s0 2xoxopiy4apee fcsasf Duru oot4tlxniiciat s uau s t0arerxf3ta1opt  uvs;t t2umim oy1am   neilt s2rrxr nt1olxnio3iltls2rmumo u0 lermf3tytfp  lnesls)sexo(o iu4op   ncs s s2rmxmoou0tleoioeiasla2ra(monu) ltoif io1oat  i i t)trxrxmpnudom  mnciat sruaxmp;u0aptn f3tytls2ean o;t4 etnmr3tydfmt  neols) eto(r3oo4ale  ncil()srrrx  nu1optn o3iydfm2umumpnt4tltrxrciy1oaDraueol( s2uoio nydllee fetas)aDrmu  ;u1oleniieiasls2uan sn()trermo3oo1fp  livo t0 2xmxr nu4amtelnei (fs2tm( poo0apeomiciadfm2um( p (4altrmo3ta1lp  aiei s0srurxrpoydoltelnct tf rrmxmp;o0teenmi3tytfa2ul( s;t4aeeoxf tytlmtranvsl(0s2tmxrpoo1lpeemnvta()srrrx o;t0tpeniocild aDum(monu0alenxfciytlat luvo;t)t2uoiopio4ll nmfci () 2tm(mpoo4olx  f3iydlm2rau p;(4aexomrctotfmt ln s s0srtrxrpoo4alen nei tfaDtr(mpot4tpxo feiatfsDua(msnu4tetnmrcoo1omDrln o s)texrimpnu4lm n icta(  rtr( p;u1alt ifctadlm2umuvo ()alerxo3iatfmte u o;t)teumim oodlm  lnci ()arur(rpot1oexo fctyd mDrl( s ()teerir3ta1lmtrlu s;(0trumio3nu1aleelfctl( arrm(  nu0tee  i3iadfm2ranvpnt)alerxr tatoatrli s;()srxoxmpoudome  ici ( arrr(rp;t1aex iociadla emu s;u4artomrcty1lm elu s (0 rtmxm3nu4ome  fviasfaDum( pou4oee ifeiydfa ul(vp (4 rxomrciotfateau s;s trtoir3io4ap n nci ( aDumx  no4oltnifciydla2um( snu4 lenxociytlaDeln il(0 rur(m oy1op  lfci (fs2rrxrono1opxomoeiytlsDul(ms;u0tlxoxrciadoaDe uvsl(0trxoxo ou1omtnlfcta(f Drmxrono4ape ifetad sDeaump u0 ltrif tadlpte i o t0 exrirpoodlptelfesl()artmump;t4apt moctydfaDrm(vs;(0arenif3ia1lp rluvo;() etr(rpny4opt mics (farurum ;o1oleo f3tatls2elu o (4aleoiocoydlmt aivi t0trxmirpno1openlietat) Dtax pnt4tee  f3tlsla ua( o t)tltrif oadlmDrli s;(0 ruoim3oo4ope  nct t)srur(m ou4tleniicilslmDrl(vo;t)tlerifcta1op   nei;s)s2xoxm oo4omt mncia( s2uaxr ou0olt mfctldlmDel( snt4 leoxo3to1fpD  nvs t0t2uo(r ou1ap  mnctlt)a2umx onu0aleoii3iydls ulu snt4 etoxr3oo1fa elueo;(  rtmxr3ou1omtemfeilsf 2uau onu1apx iociyt s ran o;u) rxrifcty1omDeaues ()setoiopou1om nmfciltfartmxrooo1oexnmo3tls a2ra(vp;(4aexomr todoptean slt) etmxo3iudol emicslt arrru  ;o0opxomfctlsla2ul(mo () lxoxfcta1oaDrlueslt)seumxo3oy4optemnesas)a2rr(root4tlxo fciys a rmnvo (0trxnioctadfa eli s s teur(m oy4om  miesas  Duau poo1tpx mf3iysfs2ul(mo;(0aeermo oytfpDeliei;(  rumir oydlmt lics ()a2rrx o;t1tlxn f3iydla2rlnvp t4artoircootoaDelu i;t)srumxo3ny1lp nmnctat a2rmu ont4oltn o3iatfaDrl( o;t)aeenmo3oa1oa  ln i s0setrxmpio4ll elfeia( aDumxm ou1opxn fcild sDrau pn(0tlxoif3oy1omt lu o;s  rtmirpnydapen nviltfaDurxrpno1oetniiciad m ra(mont0texrir ootoatrliei t0 2toimpoo4optn iviat)srrm(mo;t4tptomf3iltlm eln s t0texnxr ty1lm elu olt0srtmxmpnu1ll n ici ()aDumu oou0tptomf3iltla rl(mp t4aexoxr3tatla  livsls trto(r iu1am   neilsf rua(m nu1alx iiciytfm2eanvo u4aetomf3oy1fmDrau s;t0setoio3ny1lleelfcils) Draurp;t1alxoiiciydfsDrl(vpn(0alermfctotoatr ivi;s) 2um(m3ny1am elfcsa(fa2urxr oo0apx mo3iadfa2emuvo t0tetrmr3oo1oatranvols0setr(m iu4ap nlfeiat)a2uaxm ot4oltomiciytfsDumn ont)altomf3oadfmDelnvs t) rur(r oudlmt  ivt () rurx p;o1oltoifciltfmDrlnvp;t4aeerifctatlp eaivsl() 2xmio3iu4ale lneiasfsrurur ;o0tle ii3ilsfmDum( p;(0tltnir3tydoaD auei (0t2xo(o3iudlleelfcs ()arrrx  ot1tpx if3tlsla2um(vo;(0 leoif oadfpDrlu i t seum(rpoy1ll emfcsls)sruaxrpno4tpt ifeiysls eau sn(0trxnxr todfp rli o;(0s2umxm3iu4ome mncsasf Dra(  ;u4aleoioetls s2ulnmpnu)trtrio3oa1oateanei;()setrio3ou1ll elneiat)sDtm(  ;o4tpeoiieiytlmDraums (4 rermrciytoa raueols) exm(o oodlme  fes s) rururoot4apxomf3tyt a eluvpnu0alerif3to1fpDelnvs;t0s2xo(m oy4altnmivslt a2tax  ;o4optnio3iytfa rm( p t0tlerxf3ia1oaDe neo;() etrxo3ou4lpe mnctls) Duax  ou1tpx miciyd sDrm(mp (0altnmo3oadfptr ivilt0 rtrxr ny1llenlnvia( a2uaumono0tpxo fciatfmDemu pnu4aleoxr tatfatranvs t0t2tm(o io1omenmncsat s2umu p;u0tleomoeilt aDuln o;t) etoxr3oo1lm ranvs s0trxmxm iydopenmici ( a2uaxrp;u0opxnifeiltfm ua(vs (0 etnmo oydfm   n olt)srxmir3oy1lltn fcsas artru p;u0aet mfetlsfm2umu ont4aetomfciydlat  uvil()s2tmxrpiu1omtn ieslt)aDra(mpou4oexn o3ild m uau s;()tlxrmo3oy1lm  auvs t s2xrir nudlpenmfviat) 2taxm nt4teto fciytls ra( o;t0 ltrir3iotlmteaueo (  2uoxo3iudopeelnetl() rumurpno0tlxnmiciadls ulnvonu)alxoir3iodfp r nvo;s0srxo(r3nydape lict s  Dtaur ou0tle mf3ilt a ranmpn(0 rxomr iotop eli i s0srtr(opoo4al e neils srurxrp;t4tetomfeils aDeln p t4 rermrcoydlp rai o s)seuoxr3no1lleemfctltfsrrmxm ou4tlxo o3ias s rau p;t4trxrxrcta1opteanvi t)s2umxm3nu1amtnmivsasf 2tru  ot1oleomocild sDrauvon(0aeeoxfciytoateln sls t2toim ny1optemfeils  Dua(rooo4apxn oetlsls ranvsnu) ltnmf todoat lues (  ruo(m3iy4apt lfcia()srrm(rp;u0oexnmociatfaDuanms;u4texoxf iytomteaieo t0 2xrxr3iydlpt lieslt) Dta(mo;t1tpe moctysls rmuvp;t)alxoir3tatfp   nvs;t0 rumio3iudamtnmncs () rtmurp;o4olxoifcilsfm emnvs u0 lxoirctydoa   uvi t)teuo(m iy4ame liesatf rtaurp;t1teeoif3tadfm2ean p u0 ltomocoo1lpDeaivsl() etoiopoo4lptn ietltf 2rau ono0apeomi3iatls2umuvp;t)artrmo iytfaDeai s s t2tr(mpny1ol n ncil() Dtrxrp;o1opx mf3iydfm uauvsnu4tltrif3tatomDrauvo s0t2tr(m iu4om emies (fsDtmxr ;u1olxnmieilt mDemuvp;t4 ltnmocty1faD luvils) eumxm io4om nlivtatf rur( p;u4aeeoioeiasfsDeauvs t) etrir tatfatrau ils0setrir oudal elfet t srrru p;t0tlxn ieias m rl(mp u)aexrmrcoytlateluvs (0t2xr(o io1lm  lfetat artmurono4oeen fciytfaDrmumpnt4arxnmr oy1lpD aueils  euoxopoydaptnmfcsls) Dtrxrooo4alx miciatlm2em(vsnu)tleomfcoy1fp raivs;s teuo(o oy4lpeelnvsa(  rrr( p;o0opx mi3iad sDum( s u)tleomo3oodopDe n s;(0seuoxopiydamt mivs tfs2raumpnu0altomietltlm2elnmo;u4 renxo oydlate uvi t  rxoirpou4aptnmfvt s)srraur ou0ope ioeilsla ulums;t) rtoif oo1optranes (  etr(m io4lmen ivil(fsrurumonu0apxnmociytfs elu sn(4 leomocoatoateln o;s srurxo3no4llt  ivsa( sDtrxrp;o4aeenmi3tatla2um(von(4texrxocta1oaDe iei;t t2xmxmpoudameemictl(f rtru ont0oexnmi3iad mDrmnvp;t0altoxf iytlmte ueo s setrxm3oudlltn fct tf 2rmurpot0olx mi3iltfs2eanvs;t0tlenirciotfmDrau i;t0texr(opnu4alenmnes s) Dur(m nu1tlt  oeias m2raums;(0tleoxrcoodfaD anesls0setrxopny1lm  mivilt aruaur ;o4oeeniietadla rmums;u4tltnif ty1faDe i s () eumxopoodoltnlfci s) 2ua( pnu0olto oetldlsDrm(vs;u4aetomf3iy1faDelues t0teuo(m3nudllte ieta(f 2rr(m oo4alx  ieiysfs emumo;t)trxnir tadfp e ivi (  eur(m3io4lltnlict (faDtmx pno4tpxn o3iat m2rauvs t0 rxoxf iatfpt livo t) rxm(m3oydam n ivils s2uau ooo0texn oeiasfsDua(ms (0tlxnxfctodomtranvi;s0trurxr nu1apteliei sfsDrrumonu0olen oeias m2elnmo t)aetoifctydlat luvil( trumxrpoydllen ivi (farumu p;t1olx mf3iatfa2ua( s ()aeeoxf tatoptr ues;s) etoxo3oo4llt lnci s)aDtrxmont1tlxo fetls a2rau on(0 exnxfcio1lat ai o t0s2xrxmpou4omtn fvsls) rta(m ;o0tpeomiciaslm ua(vp;(0trerir ty1oaDe nei t)trurir nodlp elfvia( sDrmxm oo4tee ii3iat m2eanvp (4artoiocoatfmtr nvs;t0seto(o no1omenmfes s)aDur( pnt4apxn i3tyd m eauvo t0tlerxr iotlmDrlnes t0texmxopoo4om elncilt)sDtax  ;o1alxn oeiaslm2umnmon(0 lxomf iytlaDe i i;t)truoim3nu4ol n fet sf rtm(  nt0alt ifctysfm2ulnmsn()aeerio oadfmDe ieo t0sruoir3ny1op  lnvia()srrrx  ;o4aptomoeiyt s2rm(mont0 eerxrciadoa  ln i;t0tetr(o iy1apt liei t srtmumoot4olenmoetydfmDelu o t0 eenmo3iytfp  an o;(0t2xoiopno1optelfvtat) 2tmxrp;t1tetomf3iys s2ul(mp u0 rermo3tytfmDr ivs;() ruo(opnydopee fet s aDrmu pnu0olx  fetlslm2um( p u0alxoio ootomtelnvs;()s2xr(r3nu4lptnlnvta() 2uaumpnt0oexomoetydfm2emnms (0trtrmo iatlp  lieslt s2xo(o iu4lmtemnes s)sDumx ooo1oexoii3tasfm2rm(vsnt)aexoxfcoy1fate ieilt0 2xrxm nu4apenmfci t)sDtaum ;t0tptnif3tasla2umn s;()tlxrio ty1om raueolt0 ruoir iodlpte ies ()arum( pnu0tpt iocildfm2rlnvo;t) ltoxr3totlmD lu ilt0texmio3iy1optnmicsls  Drax pou4tpx iieiyd a eaumo u4 reriocoa1lmD  nvolt) 2tmiopio1op e fesl( s2trx pnt4opxomoeilslm rlnmo;(0tltnir iadlpt li s;s)trur(r oy4lmt  fvt tf rrmxmp;u0oleo i3iyt mDumu s;(0tlxrir3io1lmD lues ( s2xrxopoodoptn ivtl()a2tru oou4aeenif3ilt sDel(mp u)aleoxr3oytlat livo;t) rxrxmpno4ol eliesas)aDum(m ;o1aee ifctydls umnmp u4 rerxfctytoa e nvo s0s2tmio io1oltnmici t)aDumx oot4aet  ieiasfs2um(mpnu0tetnxf3oatfmtr i s s)t2ur(opiydalen net t  2trxroou4aeenmi3iyslmDulu o;()artnifciotlmtr n i ()srxoxm nudol nlfvs (farrm(  ;o4apto o3iyslmDeanvo t0tltnir3tadlaDe n s;(0 exo(m iu1om e ietl(fa2uaumpou4oee  fciysls rmuvonu4 rxrmo oo1opt livils0s2tm(o3nudomen ivi t)aDta(rpnt1apt ifeild sDul(mp u4trermr3tytfm e ieol(0trtmxopoy1aptnlneta()artmxm oo0texnioetlt aDumn ont4aexnmf3oy1oatr nvo;( tetrio3iy1ameelieia(f 2ua( ono4opx if3ilsfmDranmp t)aetoio3oodom eluvils s2xmxrpiu4ome  fcsl( aDuru  oo1altomociydla ra(vs (4trtrir3iotoa  livilt  eur(r3no1aptnmnvtltfs2tm( oot0tet  octltls2rmn p (0artrmr oy1op elu s;t0trum(r nodlmtelivtlt sDtaumpou1alt  oetyd m2emnm
\ No newline at end of file
@@ -0,0 +1 @@
+ivi s)trxr(m3no1apte fet tfarta(m ;u1tle ifetas aDraump;(4 rtnmf oadlpt lnvs;t) exoxm3nodaltemivt t) 2ra(  nu0apxnmietas s ua(vp (0tlxoif to1opteau o;s0 eum(opio4op e fvtatf rurur no0olxnifciadlm2emn sn(0aleomociatopDr i ilt0seuoxm3oy4am emieslsf rurxr ;o4oleniiciat a2rmnvpnu) rxrmr iodoptr ieols)t2xm(opno1op  livt tfaDum(r ou0alenifeiyd a2eauvsnt)artnmo oo1lmtelivolt0trto(r3no1ll eliei sfsDtmxmonu0tpxoiociytla2em(mpnu4aeermf to1fmtr u o;(0srtm(o3no4alenmivilsf Dtrxr nu4olt  f3iyt a uau o;t4altrifciotfpt  n il(0tetmiopiy4al nmivsat)srrru  ou0texnmiciatfa2raumon(4 lxrmf3iydom e iesls seur(m no4am emivt tf Dtrxm nt1aetnio3iltfm2el(mpnu4 rerxr3oy1fmtelu i (0 rxmxm3io1ale mivia(fa2rru pou4tlx mictld mDuanvp;(4tetoxf3iydomt au ilt0teur(o no4al  lfvtl(fsrtrx p;t4olt mo3iasfm2ean s u0 exnio ta1opD li o s0t2xmir3ou1om nmnvs s  rumu  ;u4opxoif3tltfmDul(mp (0 eerxr oadla rliei;() ruo(o3ou4lmenlfesl()a2rax pou0alt ioeiyd s2umnvonu) ltnif3oatoptraivi;()sexrio oy4lmtelict s) 2taumoou0aleoiieildlaDrauvs;u4trenxr3iy1omt  nvo;t0trtrir3ou4ap   nvil() Dur( pno0tlxo f3tydfaDulnvsnt0altnmfcoadlptranvs;s)s2trxrpoy4aptn icsat a2trxr oo1aleoio3tldfs2uau sn(0arerxrctatlmDeaiei t  ruoxo3oy4op n nvia(f rur(m oo1texnmo3iadlmDelnvs t0arerif3iy1omDeliei;() rtoio oydome micias) 2ur(r ;t1aeen i3iasfaDra(mo u4artnxf tatlp   neo;s0seuoxopny4omtnlfct s) Dtmu pnu4oee mi3iat sDrauvs u4tetomo3to1oate ueolt0s2xo(r ny1lp elnvs sfsrtrx o;t1apxn icilsfa umnms;(0tlenxfcty1fmDrlueilt)t2xmxm3iy1ll e iet sfsrraxrp;u0tet ioeild aDulumo;u)trtomf totfpteau il()s2toio oy1lle  fvtls srrrx oou0tex  o3iltfaDeau ont4tleoir to1oaD  ivolt0 2xr(m3nodape lietat)artrumono0ape mfctydfmDra( pn(0 rtoxfctadlm rai i ()s2triopnodap n fvtltfarua(m ;t0opxomoetatfa2emuvo u4 reoxf3oytfm ranvs t0s2trir3ny4ll emfvtat) Drm( o;u4tltniiciadfm2rlnmo u0 lenmrctytlaD lu olt)texoiopnudlp  mfetlsfa2tmx  ;t4ole ioetadfsDel(vont)aetrxrcio1lpDr u ils)trtmimpno4omte ies sfsDtm(m nu1oltnmiciytlm2ul( onu0 exnio tadlaDr i il()t2tmir iy4openlncils  2ur(m ;t0oexniicild s2rlnms;u4 lxrio3tytoateau sl()trumim io1omtn fci (fa2ta(mo;u4tetnmfeiytla2ul(vpnt0 etrxrciytlp eaneilt srtmio iy1omte feilt s2rrxrpot1ope mieiatfaDemnms;(0texrxfctatoateln o t)trtr(opoodll e nciltfsDrm(r no1tlxnmf3iys mDumuvsnt0aetrio ia1fa  lies;s s2tmxrpou1ol e ncta( aDur(m nt0oeeomfcils m2umn p;u) renxo tydom r u ils0seuoir nu1lme  fcs ()srrmxmo;o1tex  octatlaDea(vs;t4trxomfctadfmD liei s) exoxmpio4ap elfci sf Draxrpno0aleo oeiydlm um(vp u4teermfcoo1fmDeaneils) 2toio3no4op e ieils artax pot0tlenioeiytfm rm( pn()alxrir3ia1lat li i s0 2tmxr ou1lpenlfctlt)sDrrur ;t1tlt mi3iadfm ea( o (0 etnxf3oatlpD anvo t)sexr(m ny4altn ivias s2tmx  ou0oleoifciasfm2rauvp;(4trxnircoo1lmtrauei;t  2tr(mpno4op nmnetl() Dtm(mpno1aetn i3tys a umu o () eenmfciodom  aiei t  2xmim io1apenmiet t)sruru p;u4apxn ictls a2uanvpn(0tlenxociotfm rlnes;s)s2toir3oy4olee nvtlt  rtax  nt4aleoii3iltfm2ean o;u)trtnmo3ta1laDr n ols s2tm(m3ny1ome  nvt (farrrxm ;t4oexomo3tld s2elumpnu)alxrir3tatla  au o t)trtoxr3iodalt mici s)s2uaxm ;t0tle ioetldfs ulump t4 exnmrctadfmt  i i (0 rur(o3ny1lmtn iesa(farra( oou4tlt  oetlslmDrmu snt0artoif tadoa   uesl()srurio iu4oltelivia(fsrra(rp;o4tptomoeiasls rlumo u)altoxo3totlaDraies t  euoxr oodlpe lfci s)s2rmxm no1olen ieiyd m2rm(vsnt4aexrmf iodfm  livi;s t2toio3oo1op nmics s  2tmur ;o0ole mfciasfaDrl(mp u) exnifciytfaD livi (0 rxr(mpio4lmtemiesasf rum(r ou1apxomi3iytfa2umnmo;u)tlxrifctotopt lu o;t trxmirpnydlptelnvi s)a2truronu0apeomo3tlsfa2uln o;u) rtrio3oytfp  anei t) ruoirpiodlmtnmiesa(f Dra(r oo0tptomictasls2ea(vo u) lxnxo ty1lat ln o;t) rxoxm oo1lpe lfesas sDrmxrpou4oexn i3iadla2eauvpnt4trtnmo iydlaD lneslt) 2umir3oo1ll  mfei tfarrrx ooo4aetoif3iyslm eanvp;u)arxrmo3iatlmD auvs;s srxm(m3iu4ap  micta() rrmu  no4tex  f3tytla2ul(vo t) lxnirciodoat livo (0texm(r3iodop emncs (  2trur ot1altomfcildfs rl(ms;u0aexrmr oadfa  aneslt) 2to(mpiodll nmivtas sDrm(mpno4teenmieilsfa el(ms;(4aetnxr iodfp eanvs;t s2uoim io4ol elfvia( sDua( o;u1tetnmictyt m umuvo u)texrmf ta1op rln sl(0 rurir3no4lmtemfetat) rtr(ro;o1texoio3ils m elu sn(0treomf3tadom   nvilt)sexr(opoo1ap nmfesl(fa2uau  nu0aex mfeiadls2el( p;u4areomfcoodoaDeln i (  eur(r3oo4omte ncta( a2rrum oo4texomo3iaslm rmu sn(0 etrifcoydfp  livils0s2xrxo3io1lmt mnvs t) 2rrur ou0opx  i3iadla uanvs;t)alerxociatlpteaueol(0seumxopno1om   nvias  rtm(  nu4opxoifeild s rl( o u0 lenxo3oa1oa r ivo s trxrxmpiy1lpeelictatf rrrxro;o4apeo icilslm el(mo (0 etrxo3iy1lp  lnvols  rtoxm3nu1openmfvtl()sDta( o;u4tle if3iyt mDelumpnt0tltrxf3tytom e nvo s)teur(r iydopt  ictls srrmxmono4tet mfciadfm2uan snu4treomo3iatfmtr uvo;t0 2ur(opio1openlnesa( aDtaumoou0aet iociasfm2umuvs (0tetniocoa1lmD  uvi s)srxo(r oo1ap nmnci sf 2tau  no0opxomoctldfs rln s u4 etrmo iydlmt aieo t0 exoim3oydapte icta(fsrur(  ;t1opt  oetad a2ulu p (4trerio3oatom r i s;s srxriopoodll emncils sDrrxmooo4tptomictys aDeauvs t0teeoxf oadfptranvo s0t2umxm3nodal elictas srrr(mpot1aee  i3iydfs umn p t0arermr iydfmt  i i;t0 rtr(r3oy4al elncsas srum(monu0optniictadfm um(vs t)tltrmf3totfmDeluvol( seumim nudal  mivi s sDua(r no1oexomfeiasfm2umumo (0 lerir ty1lpDrluvsls0teum(m oo4ll   ncil()aDtaxr no1aee micilslm2ulnmont4aeenmf3oy1op   nvsls0 rumir iy4amtn nesl()srra(m no1oex  fctas aDul(mo u0tetnmo iadfmDe iei;(0t2xmxr3nu1ope mnetasf 2ur(  ;t0ape  iciydfs emump t4 exrmf oatfatr neol()truoir3nu1amen ivia(  2tm( o;t0aexnmfeiysla2em(mp;u0 ltoifcoa1opD  nvs s teuo(o3oo1lm n nvia(fsDurxrp;t1opxn ieiys aDra(mp;u4 lxnifciodlm elu o t) 2uoxm3oudlmee nvs t srtr(moou1apt iiciytfmDul(vo;u)aeerir3io1la ran s;(0srto(mpno4am e ncil()aDrmxm ;t1olenioctatlm2um( s (4 reoifcta1lmteaivs;( texoimpou1optelnvt s)aDtauro;o1tleomicilsfmDrm( o u) exnifcoa1opte nvo;t0setoxo3ny4olt lictasfs2truroou0optomiciltfsDeln p;u4 rerxr3iy1fpt  u i;s0s2ur(rpoy4lltnlnetl() Duaxroou4teenmo3ias a2eln sn() ltrio3iytfpDeaieolt) rumiopiodop n ncils) Dtr( ooo0tpx mo3iyd aDrlums (0artrmociytlatr nei () 2uo(m3iu1am elncsltfs2trx pot1alx  fctysls emuvo;(0aleoxf3ootomD  u i t teur(o3io4ole  ivt t  ruru o;u1apt io3iyd m em(ms;t0alxnxr iodfaD aivo ( sexr(rpoydale livil() rraur ;u1tpxn iciltfsDumu p () lxrir iy1fp   u i;( texmxr iodll emnesa(f 2rrurpnu1tlenii3tysls2raump u)tetrxr3totoptrlnvilt)t2urirpoy1lmeemicils  Dtau ont4tltn icilsfmDrm(mpn(4teerxo3iytfpDr uesls)trum(r3iy4lpt  fcilsf rur(mp;t4aee mocils s el(mo;(4 eenio3tadlmDelueo;s0sruo(m3ny1lpt lnvt sfsrtm(mo;o4aptn ociltfs2raums u4arxoxr ia1lmtrlies (0setr(o oy4lmenlfciltfs2tmxr ou0texo o3iltlm rau p;u0alxoxf tytfp  ln i s  2um(r3oydopte fei s) 2ua(rpoo0opxoiicilsla eanvo u)teeoif oodlp eaues;s0 2xr(r iu1aleemieiat)aDurum oo0aeenmfeilsfsDrl(vp t4trxomf io1fm rlivo s t2urxo ou1amen ncsltf Dtrx ooo0alt ioeias a eaump;t)teerif3oydoaD aneol(0texrir3nu4ap nlivils  rtaum ot1ale ii3tytfsDeau o;t0artrxr iy1lpD lu s;s) 2ur(m io4lmenlnvtltf Duru oot4aeeomociad a ulnvo u0altrir3tatomtrlneo (0srum(r oydal   fesa()aDtrur no4aeto icilslsDul(mo;u0texrir totopDean s;s truoimpou1omte netlsf Durxrpou1aexnmfctysls2rmuvpnu4alermrctatlptr uvo;t)s2xm(r oydomenmivslt)aDururpou0tptniociyd s2uanvp u4 rxnifctatlaDeauvo t)srur(rpoo1ap  lnctasf 2uaxrp;t4alxn o3tatlaDulnmpn()trtnmr to1fpDraueo;t)teur(opiu1lptelncsl( arraxmpnu1aptn iciadls2rlu o t0teeoirctodopt  nvo;(  rtm(m3iudlpeemfvt s  2uru p;u4oet ifeild m rlu p ()artnmrciy1op e ivo ()t2urir nodomt lfeilt a2tm(mp;u0teenmo3iaslmDrmnvs t4tlerxrciytfm e u o;(0setm(m ou1lpte iet (  2ur(rpoo4aet moeiydlm2eanms ()aeenif iatlp  lues;t0s2to(o3io4am n fciat sDrrxmoot0opxomieild aDulnvpnt)texrxrcia1fmt  n i t)sruo(rpoudom   fcil(  Drmum ou1oetnmocilsla2emu p;() rtnif3ia1lpDe i s;(0texmir3ou4op e nvia()s2tr(roou1ape io3iltfaDemuvsn(4 etnio iydlaDeln ilt0srurim3oodam elnvsa(fsDuaxmont1olx  fetyslm2rl(vp;t0 lerxr3iodlmDeanvolt) etoir oudamte netat  Drax  ;t0texn fciydfmDuluvp t4trxnmocoydla rau o;s)seurxrpnydoleelnet (  rrrx oou4tpeo ociysls2ulu o u0 lxrmrctodoptrln s (0s2trxmpiu1om  mici s arumxrp;u4aetomf3iasfsDranvo t4arermo tadopD ln ilt0trum(o3oo1ap  liei sfa2raurpnt1oetoiieiysls2ua( s;(4 ltnmf3oydla rlnvils  rurxr3nydal nmicsls s2tmu  ;o0alxoifeiadls rlu snu0trtoxo oydfmDe i sls)t2uoxo3nu1ol n nvt sfs2taur nt0ole mfeias m2eauvo;u0trtrmf tadla eluvils0srxm(m3nudom nmiciat  rraurpnt4aptn ietyt m2uauvonu0 lerir tydlpt li s t0truoim io1ale  nvi s srtm( p;t1alxniociatfa ea( on() etrmo oydlm  lies t)teuoxo3oy1am eliet s)arrmu onu0oee moctatlm2emnms u0 rtrxr iytfm   u il( s2xr(m3no1lmtnmicslt) rtaxmono1ope io3tlsfs2rmnmsnu4 exnmo tytoptrlu il()texm(m oy4lpt lfvt tfa2uaxm no1aptnifciydla ra( p;t4 lxniocto1latean ols) etoim3nodllenlnet sf 2uax  ;o0optnmietyslaDulumo;u0aexrmf ta1oaDeanvil() ruo(r3ou1optelfcsasfa2tm(rpoo4tpxo ictyd m2elu s;t4aeenif to1fp  lu ils0tetr(opio4ll nlnetls)s2uru o;u0ale iicilt m2emnvont)trxrmr3io1omt lues ( t2tmir nudlltnlnvia() 2urumpnu1alenifeiadls2rluvs;(4alenio3io1oateaivo s) rumxopoo1am e ics tfs2trx  nu1oltn f3ildfs umnmp ()tltniocoy1lmD  nei;s) rtr(rpoo4amte iet ()arrax p;o4aex  f3iltla2ra(vo;t4aeerirctatopD  ivs t  rtm(o3no4om nlfviatf Duru poo4oexnioetat s ean s;t) ltoxo totfatrlu i;s)setr(o oo4ope mnct (f 2uru pnu1tpxnmieiysfsDrlnvo (0 rtnio tytfp rlieils0srtr(opou1aptnmictas s2tr(rp;t1oltn fetadfa rmnms;t0 rxnmo3ia1lmD  iei;( trxm(rpiu4lptn ivs (fs2ta(mont0olxomoeiyt s rln s;(0 lerif oytopDraneils)srtr(rpoo1am  lfcia( s2tr(r oo1opxoifctat aDem(vo;t)alxoircio1fateauvs;(0sexmimpiydlltnmfesasfartrx pno1oexn iciyt sDemnmp;(0arerxfctodomtrli o;(0trxmxm3iodapen fvi ()s2raumono0tpxnmfcias s2eanvsn(0aeermo to1oatrlnvi s) rtmiopio1oltelncs (fs2tr(r ot0opx moctydfmDrmumo (0aexoir3iodopteluvslt trtoirpnodop nlfvsls aDumxmp;o4tpto iciyt m2elums;u)aeermf oodlpt au ols0trumio oudamee icsltf 2umxm ;u4oet iociatfa ulnvp u0aexoio todlp   i i;()sexoxopoy4ol nmfviat) 2umumooo1apx mfetat m rlnvo (4 etoif ia1lat lies s s2tmxopiu4ape lfctat s2ra(m nu0aexn i3tld a2emuvp (4artrxr oatlmte ivs s0t2tmxm oodole lictasfsDtmuroot0tlxomf3iltlm ra(vo t4trxrir3oa1op e i ilt0 rum(rpoy4lltelnei s)sDuaum ;u1apeomoeiyslaDuaump t)alxoir3iadla r nei;t0s2urirpoo1aptemnesls) Drmumoou1tle mfciadfa ra(mp ()teenmo oadlpDraieo t0trxriopio1olenlnvsltfsrrmx ooo0tpxomfctls a2eau s u0tltoio ootom raneo;s)srxmxo3iy4altnlfcsa( aDrr(roou4aexoifetlsla2elu on(4teerif iadfp eai o;t t2toxm oydaltnlfct s s2ta(  ot4openmi3tld s rlu o t)trerxf3ia1laDrlnes s0setrxr ny1lltnlfvsasfaDumxm ot4optnioeiysfs ea(monu0alenxoctadfaDeai slt trur(r3oo4lm emietas  Drmxrpot4tpt if3tatla umn p u4 lxnxfciydoat li s s) exoxo iu4ope mfetl()a2rmu  ou1tet mietltlmDel(vo (4 exoxo3ta1oateaueo;(0trtmxopnudlm nmfctas) rta( pnt0aetnii3iysfs ulumo;u)teenxf todoa eaieil(0tetm(mpnudolte ieilt)sDra( pnu1olxomoeiasfaDrluvp u0texomr ootlp  lneol() euoxr3ou4lptelfcsa( s2tmxmono1tlxniociysla emnvp;()arenir oa1fmDe nvi s)s2trim3oo1am e ici ()aDraum ot4altn octat aDem(mp;t4altnmfcoadfmt ln sl( tetoio ou4om nmicsa()a2tax ono4olx  oetlsfmDrmums t) rxoirctotfateaieo t) 2xr(o3iu4ll emfei tf 2rmxmoot1tptn fciatfmDul( o;(4tlxrxrcia1fmDelivo ()tetr(m3no4lleelics s srtm( o;t1openmf3iltlaDran onu0tltoif totlptranvil( t2um(o3ny1lpte fviatf rta( pnt1opto oeilt sDraumo t4arermo totoatelnvs;s)teurim nydam nmnvt t aDrmumpoo0apeo oetyt a2el(mon(4arxomr3oa1fptr i s;() 2tmxm iudole  nesls)artaxrpno4opxn fciytls eluvpnt0 eenmo tatfpDrlu sl()seumxm iudalenlnct s) rra(r nt4opx  i3iadfm ua(mpnt0trxrxfcta1fatran o;( s2umirpny1lle  fes (fa2uru o;o1apeo feiys a2el(mo;u4teeoxr3totopD an o;(0t2umxmpiy4al nmnvsl( s2tm(ro;o1ape  oeiadls2rl( sn() etrmrcoadomte iei t  2xoxm oudaltn ivt (fsDra(r ;o0apx ifetls m2elumon(4areoirciodfa r ies;()srtrio oydaleemfcia(f Dua(rpnu0alxnmietls m2eluvs;u) rxrmo ia1fp rlieo t)s2xmiopnudomenlietat  rua(mo;o1altnmicildls ua(ms (0 ltrmrcia1lp r n o t)texr(m3iodlpenmivsat) 2tmxr ;u4tpeoifeiyd a em( s;u0aleomfcoodomDran s;t)srtmxr nodlpe mnci tfsrtrxmp;u1altoiieilsfa2elnmon(0alermfcoydlp rlneo;()trxo(m io4altnlnci s)aDumxro;o4tltn o3tadfa ua( o t4texnxocto1lpDelnei;s) etmiopny1amt lfvs t arua(monu4aee iiciasfaDrauvo;u) etnxrcty1omtrlnvo;s t2to(o3oy4apee icilt) 2ua( o;o1olx mo3tat m2rlnms;t)arxoxo totfm ranvsl(0texoir iudlpen fvs s sDraumoot1tpe  fciat s rmu snt0 exnxocty1lpDrlnvil(0s2tr(r nydameemnei s)s2uax  ot4alxo feiasfsDuan s;t0 ltnxf3iodfmtraivi s) 2xmir nu1lle mfeiatf rra(mpno0alt micilsfm2emnmo u4tlenif oadop  an o s) 2tr(o oydaltnmiei sfs2rau ooo0tleniociadfs2uan s (4alenxfctatfmDelivo;t t2umxopnydapen iesl(fs2taxrpno4tlx iociltls emumsnu0 rtnioctodoa  livs ( teurxopnydal   ivsl(farumu ooo1opt micildfm2ul(vo ()tlxnxf oy1lmt aivi t)setm(m3ou1ll n fcs t)arua(m ;o4olenifeiysfaDeluvon(0trenxfcta1lpD ai s () rtm(o oo1openmnci () Drm(m ;t0opt micilt a raumo t4tetnioctodlpt aivi s s2xmxr3nodapeelncils) rrmumpou1texoioetas m2emnmon(4 lxnio to1op ean slt t2xrim nudllt  fcs sfsrtm(mpou0olxn i3tat s uauvsnt4 reomrcoatlptr neo ( s2xmir3io4omtnmfesls arrmx oou1texo i3tas m2uauvon()trtoxfciytfmtrlnvs;s)seumxm iydol n ivi () 2rax  nt1opxoiietat sDul(mpnt0 eermfciytopt  neol( t2um(mpiodaltemicil(f Drmxm ou4ale iictld sDeluvp t0 rxrmfcta1lpDrlivi t tetoxmpoy1lp elfeiat)aDrrumpot0tet ii3tasls2ul(vpnu)areomo3oodop raneslt0s2uoxm3io4ll elnei ( arua(ro;t1altnifcilslaDrm(ms (0alenxo oytlaDrau i;s s2uoirpnodlm n fvs s aDtmxm nu1tet ioeilsfa ra( p u)alerxf iatoa rlueolt0sexrirpnydom  mictat) Draumonu1tltomoetls s eanvsnt0artrxfcio1laDeauvi;s)trtoxmpou1llt  fvtls)aDta( o;o0oeeomi3tysfm uauvo u)trerxoctotoat aivil(  etm(r3ny1am   nciatfsDrmu  no0opt iieiyd aDuanvonu4tlermocoatlmtranvolt teuo(mpoy1op n fctlsfaDuax oou0apxnmf3tldls em( p t4aetoxrciytomDe uvsls tetr(rpny1llt licils srta(r ;t1opx moctltfaDeluvp (0alxrmrciotfa   u slt0s2xm(rpoo4amt lieslt) Durur nt0ape  ieiasfs2emnvp;(4 rxrif3oatopt luei t0 2umimpny4alen ieilsfaDrmxr ;t1opeo oetys m emuvp u4texnxo todomt  ueo;s tetm(mpoo4lp nmici s sDur(rpoo0olxnifctltlm rlnmo (0texomf tytomtean ilt texrxo3iu1apeemiesas)artaxmp;u0tltnmoeiadfm uanmpnu4trenxo3iytop rai ils  rxm(m oy4om   icias s2tm(mo;u0aexomiciaslsDem(mp;u)tltnmocto1fatrlivs ( srumxo3ou1ole  fvtat aDtrxr ;u4tex ii3iltfsDemumonu)aexnxo totfat aieilt trxrxm3oydlm emnvtl() Dtm(r nt1apeomoetltlaDul(vs t0alenmocoy1laD li slt t2xmxm3iodal nlfetltfarrmxrpnt0tltnmfctaslmDrmn pnt)arxnircoadopte nes t0s2xr(r3oo4am   fvta(faDtmu pnt1oex  iciadlm2ea( on(4tetrio3iy1fmt lu olt0texoxm3iu4lltnmicilsfa2rmur ot0oeeoifctydls2umnmp t0 rxoiociydlp rlu s;(0 euoxopiy1omt lnvilt sDtm(r ;u0aetn fetys mDra(mp u4aexrmrctodfaD lnes t0s2urxr iu4lpeelfct t) rum(m oo0ole ifeiadfs2ulnms u)teeomf oodlpt lu slt0s2to(o no1omtelfeiltf Drr( p;o0tpxn oeiydfa2rau o;(4 eerir3oydomtelneo;t0setrxr3iy4omtnlfcilt aDtrx  ;t0ale  fetlt m2rlu pn()tlxomo3tytla ranvi;t seurio oodomtemfcs (f 2tm( ont0olxnmoetys s uaumsn(0 exnxf3iotfm   nvi s s2um(o3iodapt  ieia() 2taxro;u4aee ifcildlm elums;t)texniociatlm   u i t srxo(m3io1om emncslt)sDrr(moot4apx  ieiadla rm( s ()trtnxo3ia1lp  lu o;t0 eumxr iydlleelncsas)sDurxr ou1aeenmiciasfm raumo;(4aeenif3io1lpDr i sl(0srxoxmpnu4om  mneslt  rtrum ;u4tleomfetasfmDelu onu)arermo ia1fa e ivs;() exmxopio1olt mivtlt  2tmurp;u1apeoii3tytfmDrl(vp t)trtomo oytoatr nes;s)teuoxo3oodlm e fesas srtmx  no0oex ioeias m eauvon()arxnmf ootomtrau ils  2tmim3io4ale  neils)s2ra(r ot4olxniieildlmDemumo (0 lerxo3ootfpDeanvi (0s2umxr nudaptnlnctl(f 2urxrpoo0tltnio3iadls ran o u4 rxrmociotomt lneilt trtrxo3io4lp  liet ()aruaxrpnu0aleo ociasls rauvo (4tlxnir iadfpt lueo s  eto(m no1lpt  nci tfsrrm(mpot1opeoio3tldfa uan s (0alxrio oa1oaDr n o;( sruoim oy1lptnlfeiasfs2rrxr ;u4aeenioeiasfmDel(ms t4alerirciy1fmt lieo t tetm(m3oo1olenlnvia( a2uau  ou4oex mf3iltlaDrluvsnt)tltrmfcoydfm   ieol(0s2tm(m3oydamt lfetls  2rax ono0altoioetydlmDemuvs u0 eeomfctydlmt  uvi;()trxr(rpoy4op n nctasf rraxrpot0oetn ietltlm rl(mp;(0arxomf3ia1lp e ueol(  rxo(rpiu1apee nesat  rra(rpoo4tlto i3tlsla2emu p;u) lxrxociadom  aivol(  exrxm3oy4ll n fctlsfs2um(rooo1apx  ictyt sDeau o;(4 leoif3tatfmDrlueilt s2toxmpiudllenmivta(fsrtm( poo4aeeo fciysfm el( o (4 exrir oy1fp e nvo s0srxrxopoy1lpe  fvt sfsrumxmooo1aexn f3iys a2ea(vo u) eerio oadoptrlnvs ( trurxr3io4lm nmnvs (f Dumuro;u4tlx mietlt m2rmuvs;u4trxomf oadlpDe i s t)trxmxr iy4llt mict s) 2taur oo1tltnmf3iltfs2eluvp;(0 lxrxf totomtranvs ( s2uoimpoudolte nvtas arra(mooo0tle mf3tytla ua(vs;u0altrir iatom  li sls teurxmpiydole  icilt)sDrmxmo;o1aetomfeiasfm2elnmont0trenmr tatlmDrauvo t setoirpny4open ietlsfa2taumpnu1olxnifeiatfa2umumsnt0altrir iotomD  u i;t0t2to(o io4lm nlivsl() 2um( ooo0altnmfeias s uluvpnt4artoifcta1faDr nvo t0t2xrirpou4op nlfvs s  Dtrxm ;u4opxomiciydlm2ra(vs;u4 reoxfciatom  au s t)sexrxmpnu4lme mivtl()artr(moot4tetomoeildls uau s t4 rxnmrctodfmDeluvs;()trtoio no1opte nesat s2urxroou0apto f3iltlmDra(vp;t4 rxrxfciytfa   n o s s2tmxr iodlmtemnes s)aDrmxrp;u1tlx ii3ild s2emnvs t4tlenio3tytopteau sls  2trio iydomtnlfvs t aDuaxm ou1tpt mi3ilsfm2uan ont4aleomr3oo1opDr uvo s) 2tmir3iodolenlnvt (  rraurp;u1aet  f3iadfmDrluvpn(0tlxrxrcoatfpDrauvslt)tetm(o iy4lptelieilt)sDurur oo0ope if3tytls2rmuvo;(4trxrir3tadop  aivsls0setrxo ou4am e fvt s) Dtmx poo1ole ifciltfs uanvs u) rtnir3ia1oa e i i;t)tetm(opio1ap e nei (f rur( poo0alenmociydls rluvs (4alxoir3iodfaDrluvs;t0 etoxo iudlp  mnvsl()a2rmxroou0teeomoeiat a ua(ms;(4aetrxr3oo1lpteluvil(0s2toio3iydaleelnvtatf 2rr(m nt1apenifetytfm2ulums t)aexnmo3oodlpDrlivil()srtoxr iy4lpe mnci ( a2ur( poo1oeeoifciltlm2ea( p t)tlxrxfciodfpDrau sls)texm(mpoo4lm elfeiltfs2uaur ;t1tpxn i3tltla2umu p t) etrmo tatoa r n olt)s2ur(r3oo4om nmnvs (  rurx poo1aptomietyslm2ua(ms;(0artnmf3oydlp e i o t s2tm(r ny4al  lnci s s2rmu  oo4aeenmfctysfmDeluvsnt) eenxrcta1fmte u s s truoiopoudale  ieta() Dtm(rooo1tpt io3iltla rmnmo ()altnmf3to1oa elivol(  exo(r3oydll e nvs ()a2uaxr oo4oexniietyt s eaumsnt0alxrxr3iotlpt  u slt)srumio3io1lle lfet (  rurx ooo4olxomoctys s2um(vp;(0tleomo tadfm ran i;(  etrxr oo4optelfcs tfs2taur nt1tpxomfcilsls2um(mpnt4 rtomo ia1opDrauesl()teuoxr iu4op e neil(fs2raumpnu1tpto f3iatfaDelu o;t4tlxoxfciy1lp elnvi t0tetrim3io4llt mivsl(  rrm(  ou0olt mf3tlt m2emn on(0 lxnxfctatlate iesls0sexo(r nudlmeemici t  rurxro;o4ope mf3iltfa rmnvs u4arenxr3ootfm e nvs ()srtr(o3iu4amt  ncil( aruaur ou4aexo ieiatfaDrln o;u4arxnio3oatfmDe ieo;s0s2xmim nudlpeemnvt (f rtmxmpnt0tet iieiyd aDrmumo t4 ltomo3iytlmDeaueilt) etr(r iu1op nmivsltf Drmxrpot1aptomfeils s2el( p ()tltnmo3tatfp  anei;t0srtoxo3nu1om nlfvsa() Dtr(rp;o4tptoif3tldla rmnvpnt0arenxrciydfp elueo;s)s2uo(r iy4olenlfvil(  2tm(monu4aet ifctldlsDuln snu0areoiocoo1omtr uei;()tetm(r3no1altn nvsl()a2tm(mp;o0opxoifetaslm2emu snu0trenio3oatopDranes;s) etr(opiudoptnmnetlt sDumum nt4alt ioeilsfm2um(vo t4treoif iodla elneils0 2umimpoo1opt livsl() 2rmumo;u1optoiieias m ul(vp t) etrif tydfaDr n o t0 exmim ny1optnlnctlsfsrrmuro;t0alxn o3tytfa2em(vsn(4artrio oa1lm raivol() rtoio3ny4al elfei (faDumuroot4apenmfctldfmDumu ont0tltoxo tatla rln o;s0srxo(r3iodamen fes t  2trurono4alt if3ild mDea(ms (4artoxo oytfp  li s;t  2xm(mpoudal n ivtat) Dtmurono1tleomfciadfm2uan s;u4teenio oodlm e ivi;t texm(m iu1alen fvsas  2urxrpou1oetnmociytfa2rlnmp u0aexrmf oatfm eauvs t) etoxm3iu1lmtn fcias  2rmur no1ale mo3iltlm ulnvp ()aleoxf tatomt  nvi t0s2xmxm no1ap elfes (f rra(rpnu1tpenmoetat aDumu pnt4trxrio3ia1lmte n s s0 rumim3iy4ol elici tfaDtmxrp;o1texoifeiytfa2uan p (4arxnmrcto1fmD lues;(0s2ur(m3oy4oltnmfeiasf 2ra(mpou1oet moeiasfs2rmumo u0 rxrmo3oodla eaivo s trxo(mpio1ame  icsls)a2uaur ot0aexomo3tasls2emums;t0treoif3iodfa elu s t tetmim iydlm nlfvtas)arrmur nu4apen oeilslm2rlnvs (4altoxf3tatlm   uvils  2urimpio4amtnmfctasfa2raum nu0olt ii3iyd sDrmn p t4 ltoir ta1faD  ueols  etr(r iodol emivi t a2urum ;t4tex  ociadlm2ul(vp;t4aetrxo totfa rau i;t t2umio3ou1ap  licsl()aDrau pot1oet  o3ils mDuanvsnt0 exoifcoy1oatr nvs s0texo(r3ou1ale  nesat) Durx oot0olt iictldfm emnvsn(0alxoifcio1laDrlues;s  2uoxo3io1om  lfet s)aDtr(rpot0alxoioeilslsDelnmo (0 eerio3ta1lat  neolt)s2uo(rpnu1am   iesl(f Dtrxmont0ape  oeiadfs eanms u0alxoxocoytoat  ivo;s)s2triopnydape lnvs t) rrrumpou4apxomoetat s umuvont)texoxo3ootfa raneslt0 rxm(o3iodap   feiasf rtmumo;t0aptoioetatla uln s t) lermo3oatomt lueo s seuo(mpnu1lpeemivt s arrmumoou1alx mfeild aDua(mp (0tltnio3tatfmt au sl(  2tr(o3oudomee icsl()arra(  ot4tpe ioeildla2eln on(4trxoir iatlmDrln olt)sruoxo iydlmen fcsat)aDtm(  nu0tpeniocilt s2rlu ont)alerir3oa1lpDeln sls teto(o3oydop nmnvias aDrau oou1aleoif3iyt s2ulu snt)tetrxf tadfm eai i t0 rumxrpoy1lm  mfcsat artmxm ;u1apx if3tatlsDeanvo u) exnxf tydlaDrliei;s)s2xmio oy4lmeelfet tf rtaumoou0oexnmfetltls rm( sn(4 lxomo totfpD liei;(0 rurxmpiu4om e ictl()a2rrump;u4optomi3tadfm el(vo;u)tlxrir3ta1lmteaneil( teto(opoo1open netas)aDtrx pno4oee  ociyd m elumo ()tleomf iodomtrlieil() 2tmxopiu4lp e nct t)aDrmxmo;t0ape  ociasfm2elnmsnt0aetrif ootoa   nes;s0s2to(mpnu4lleemnesa(f rtmxr nu1olen octys a2ul(vo;(4 lenmrcoatlaD  i s;s) 2xmxrpiy1amt lfviltfsrrrur no4aex  fciasfa2em(vo;(4aeeoxo tadoa   n il()t2ur(m no1lp emnvtlt)a2umuro;u0tlxnii3ildfs ua( ont4 eerircoatla r uvo;s  rxrxmpnudoptnmfvtas)aruax poo1oeto f3iydfaDum(vpnt) rxoxf tytfm raies t)srtoxo3nydam emiesls)s2tr(rpnt1oee mf3ilslmDuan p t)trxnircty1faD livols tetmxmpou4lmee iesa(fa2rm(r ;o1ope mieiytlaDrluvo u)teenif3to1lp   i ils)seuoiopny1lme  fesas a2tm(mp;t1aptomi3tyt a uluvp t4aeermrciatfp rai s;()texmxm oo1om   nci s  2taxr ou1oexnmicias sDrmuvs;(4tlermf3tatfaDr ivilt) rxmio iydamenlictlt)a2taxrono4aexn ictltls2ra(vs;u)aeenxf3ta1lmteluvilt)srxo(m oo4ol  lietl(faDra(mpot1apxnmociadfa2ea(mp u0arxrmrctadfmDe n slt) rxrim iu1om   fet s)artrx pno4aeto oetls sDra(vsn(4 lxnxf iotomt ln ol() 2uo(opoodlp  livsat)arua( pnu1olto oetys a2uan s;(4tltoxociytlmtraivi ()trtrxo no4amtnmfct sfsDuau ono4tltn o3iydlaDrm( p;(4altrmo oodlp ranei;s t2xr
\ No newline at end of file
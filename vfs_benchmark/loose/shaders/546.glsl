@@ -0,0 +1 @@
+u i;t) etm(o3nudll e fviatfaDurxr ;t4apx  fciyslsDrlumpnu4arxomf oatomtelu s t0 2tmim3io1ap   nctl()aDrr(r ;u1alt mictatlsDemuvp;(4aeenxocio1omDrlnvol()trxoio iudoleemiesasfa2rru oou1apx ii3iysla rluvont4 rxoiocoodlmD aiesl() eto(r nodoltnlivilsfarur(r ou0tpeniociytfm um(vonu0trenxr3tytoptrlu i;s)s2tr(r3oudolee icias  2umxronu1oexnii3tlslaDemuvon()treomf3oadfmDean i ( teumio nu4lp nmiesl(  rurumoou4aetnioeiatfsDel(msnu0trtomr3to1fmtranvo;t)srtm(o iy4ol  lneia( srtaumo;o1tlxniietad m2ea(monu4teerxrciytfatrlivi t0t2xmir no1ope liet ( a2tmum ot1oeeomfcildls uanvs t4teenif3iadopDeluvo;t)t2trxr3iy1om emfet () rtaxr ot0olt ifcilsfsDea(vpn(0 etnxociytlm r i ilt)trxoxr ny1al   neil(  2rr(  oo4apxnmicias m2eln s;t0aeeoio tydlp  liei;s  rxmim oo1lmeelfesa( sDtr(  no4alxnmf3ilslm2emnvp t)alxoxociydoa r u ol( t2trio3iu4ap n ncsas)srum(ront4tpenmietasfm2ulumo ()aexrircoa1lpDrlieslt0srxmxo iu4llenmfetls)artaumono1texnmf3iyslsDeanvs t0 ltomr3iodlatraivs s)t2to(o3iodalte fvslt)aDur(m no4ape  i3tyd sDum( s;(0 lxnir ta1lptr neo t0teumirpio1llt mfeiatfa2tmur nt0tex ifcildfaDranmsn() ltnif3iadoa ran slt srtmio3oy4alt mnesl(fs2uaxmpou4opxomo3iad sDea( p;t)tlxrmrcoa1lmDrluvs () etrim3oo1lmtelfetltfsDrmxm ;t0olx iiciytlmDulnms t) exnmr3totoaDrlu s;s  exoir no4olte nctas arrr(root1opeoif3iyt s rm(mo (4texomfcoa1faD  u o s0t2xr(r no4oltelnvt ()a2tmxr no0alen o3iytlsDrlnvs;u) etomr ia1oa rau o s0 rto(m oydlpenmnetltf Drrx onu1tle ifciasfs2ranms (0 ltnxo3oodoa ranei;( s2xm(m3ny4altelnvs (f 2rru oot0texn ociltlsDuan p;t0altnif iotlpDrauvo t0seur(r3nudlp   ietl( a2urur ;u0tlen i3iltfs2emn ont0trxoirciotfa rlnvol(0trtoiopnydomtemieilsf rrrur ;o1tpxn octysfmDel(vp t0aexrmo oodlpDrauvi t)truo(mpoo4ll nmfci t)arrrxmoot1alx  oeiadfa uauvo;u)tltrxrciatoatr ivsls0texm(rpny1llenlneiltf ruaxm ;t1texo oetasfsDuanvpnt4 eenifciatlmtr uvil(0s2tmxmpiydope mnesls)a2uax  ot0tpeomieiys m2um(vp (0arxoxoctatfm r nes;()s2uoxr no4lmtn netat a2rrx o;t0teeomociatlm uluvo t0arenmo3oy1lpt anvs s)teurim3ou1apenmfet ()a2urumo;t0tlxoifcildfa2uluvp u0arerircoydlmD  n i ()seumir3oo4aleemfet ( sDuaxr no0tleoif3tad mDul( pnt)alxoio3io1omD ai s;t)t2xr(m3oy4ome  iei sfsrtaxroot1tpt  feiys s em(mp u0 lxrmf3tytlatraivs;t0trurim3io1amt  fei t a2trumpnu4aptnmo3iaslm2em( s (4 ltrxr3oa1fa r uvi;(0 rumio iy4alee ncils)srrmur oo0oet ii3iadlsDemuvont0 leoio iatla   ivs;(0 rxrimpoy1amtnmivtl( aDtrxm ;o4apx  o3iydlaDul(mo (0 eeomo3tydlpDeaies t t2tr(r oodlm elivtl(fsDrr(mpoo4tltomoeilt m eau snu0aeermr3oodom rln i;s srtrir3no4omt mnvta()aDuaxmooo4oleo ietldfs2rmn s t)teeomocoo1oa   ieo;t)t2xoxopoydol n icilt)sDumur ;u4olxo octadfa2ul(vpnt)aeenxf3tatla r ieo;(0s2to(mpnu4lmeelivtas)artrurpot4oexo o3iatfaDrl( snu4texoxf3iy1omDeaivs t0s2urim3iu4lle mfeta(fs2umxmp;t4teto f3ilslm2ul( p;t)aetoxr3oa1opD auvilt0trtmir3nydlpt mnci s)s2ua(rpou0tetnioctas m2emumont0arenxfciytomDeai slt0 rto(opoy1amt  fet t)aDua(mp;t4oltomi3tld mDemumo;t)tetoio totlmDeluvo;s seto(mpny4open nvtl(farrau onu1olenio3iadfs ua( p u) etrif oodoa  aues;( t2to(mpiu1oltelfvs ()a2raxrpoo1optnmoeiysfs ul(mo;(4aeeoxr totlaDelneo t)s2tr(o3no1alenlicils srur(mpoo4aetnmfeiadfm eaump;(0aetnir ia1lpDran sls0 ruo(o io1lmtelnctl(f 2ua(rpnu4tetomiciyslm rmnmsnt4 etnircio1fpDranei () eurio io4oleelieils)s2rrx  ;o4tpx iictyd s rl(monu)alxrmf3oatlp  aieo;s seuoxmpio1op  livs (farrax  ;o0apenif3iydfaDumnmo (0trtoxf3totopteauei () euriopiu4lm emivt tfs2uaump;u0alxn oeild m rm( ont4altnxocto1lp elieolt)srum(opou1oltn icias sDrr(r oo1aet ifetatfm2eauvs;t)tlxrxr3oatfatr ivi;s)srumir3nudap nmiesl()arumxrp;t4opt mf3tydfa ul( p t0arxnir3tatlmDrln o () euoxrpou1alenlicsa()srra(m ot1tpt  f3tltlsDra( p u0trerxoctadfpDrai o t)s2uoxmpny1openmnvslsfsDrmu  nt4olxoifeild s emumo (0teerxo ootfpDrli i t s2trirpoudaptnmies tf 2rrum ot4apt ioeiad m2eln s;(0alerxr3totlmD ln ols)truoxr3io1ale lictlt  Dtax o;u1oexomf3tydls2emn ont0 exoir tadopDelu s ( s2um(rpio4lle lnvtlsf 2um(mooo4opto ociysla2raumsn(0trxrmocoy1op  livo;t  exrim3no4lleemies tfaDum(r nu0teeomoeiydfs2rm(vpnt0aeeoxf3ootopDraies;s sruoio nodape lfcs tf rtmumpot1optoiieilsla uanmp t)tltoxf3oadlpteauvs () 2trir3ny1olenmncslt)arrm(m ;u1tlx ifciydfsDranmsnu0 eeoxf3tytfptrln o;t s2umxmpiu1ll elnvt sfaDuaum ;u1apxnmoctasfaDelnms;t) rxrif ty1fptrlivsl(  2uo(r3io1apee fvt () 2ra( pnu1olenio3iydls2ranms;t0tlenio3iy1fmt li slt)t2uo(opiy1lp nmfvil( aDtr(mpno0apt  ocils a2ul( o;(0 etrmr3iatlm eauvil(0teurxo3oy4optemfetatf Dtaur ou1olxomoctlt aDul( s t)teenmf3oadfptrlueo t)sexm(r oo1lpe mnesas)sDumumpoo0apeoifetltfm ul( o (4 ltoiocoytop e u i;s)s2trxrpoydam nlfeta(  Durxr oo0apen o3iat mDelnvpn() etoxrcoo1oat  nvs;t0srtrxr ou1ome lnet sfa2rmx  ;t0tle  oeildfsDel(msnu4aeenir iodop eauei (  2xoim oo1amen iei sfaDrr(mo;t4tpeomf3iydfs ea(mpnt0tetnxo3io1lpDrai o;(0seumxr iy1lmtnlnci tfa2umxr oo0aeen feiadla el(vs t4 lxnif3oytoa rlivs ( t2xrim iy1alt mfvsa( sDrrx p;o4teeoiieilt s elu onu) renmo iatlptrluvs s)truoxo oy1om  livtat)artr(  nt0tee  i3tas sDrmnvo;t4 ltnxf3todfmtr u o;t0srum(o3io4optemieslsfs2rm( pno0aexoiietaslmDuln sn()trerif3iatfpDr ivilt0 etrxr nydll nlfvsl(faDrruro;t0openiociad a2umnvpnt)aeerif3oa1oat  ies ()t2uo(opoy1lpenlivilt s2rm(ro;t1tpto ietas s2ulu o;u)trxnmfcio1fmD  n ils) rur(o3nydlle lfesas) 2rmur nt0tpeniieildls rl(vs;() rerifciadlptrauvs ()setm(m oo1lmtemivslt) rrmxrp;t0tet ifcilslsDuanmonu4teeomfcty1lmDr ivolt0teuriopnudol nlnetl() 2tr(  ;o0tetn oeiyslm emn o;u4tetnir3oa1fp r ivi;(0t2tr(m3io1lp e iciasf 2raumono4apxomfeiat aDrlnvsnt)aeermocto1fmtr u ils)t2ur(m3iu1apte nei tf 2umx  ou4texo fciatlmDrm( sn(4 ltoxrctatomDr i o ()trtoxo iodape mnesat)sDrax oot1apen oeils s2eauvs u4arerxf3todlp elnvo;t)t2tr(opou1lp  mnciat  Dum(mo;u1tle  ietadfs rlumo;u)aeeoxr3io1fmt luvil() 2um(o3iydll   ictlt a2uaxmo;u1olxomf3tytfsDul( o;u4aexoxocta1omDrauvi;s0setoxmpio4ap n feilsfsrraumpnu1oee  fciasfm ranmp;t4arenif3oo1latelueilt s2xrio3oo4opeemicsas)sDrrx  ;o0tleomfeiaslsDemu p t0arxrmo3todfp raivi (0s2uo(r3oo1ol elies s  rrm(mpoo0tex iiciat mDranms u) rerxo3oatfa r n i;t)t2urxr3oo4amt  fet s)aDur(  no1aex moeiatfm umuvo;(4 reoio iy1omt luvo;t0 rxr(rpio4ll elivt tf Dtmumpou4aetnmo3iytfa2ra( ont)texomr tatoptran s;s)teto(opnydlm nmncsat  rrm(r oo1aeeoifciltfa2rlnvon(0aetnxo iatfpt li i;s)t2xmxm3io1lmtemncil() rrrxm oo1olto i3iys a2ul(vo;u0tleomf3oy1lmteanes s0t2uo(r iydlme  nesa(  rtmumo;u4apx  ociytfa umuvpnt0aexomrcto1opt  i ol( srtmio3no1om n ici sfs2rmu ont0apen f3tatfs2emnvsn()texnirctytfpD lnvolt  rxoxopoo4altelfvtl()a2rm(  nt0apx io3tldfs2uan s;u4trxnxo3ta1fp elu sl(0srurxr oydoptn feiatfartru  ;t4teenifciytla rlnmo t)tlenmr3iatopDran s s)s2umim iudlltnmivil(  2rr(  ;u4tex io3ils s rlnmo;u0tlerirciatopDranei;t0trumim ou1openmncilt  Draur ;t0aee mf3iatls uanmsn(4aeeomoctadopDeau i ()trumio oodaleelictls) rurxm ;t1teeoii3tlsla2ul(mp;t) ltoxo3iydlaDrau s;()s2xmxo3oodal  mivt t artm(rpou0olxo oeiys s2eanvo u4artnmrcoo1fpt lu sl(0 exrxrpio1op elnet (fsDrmxrono0tptnif3tasls em(vs t)alerxfcto1lptrli o s0teurxm nu1lp elicsl() 2raumont1teeomfciaslm2umu p t)teeomocia1fp eln i ( trtmxo3no4lle lfeta(fsrtmxm ou0oleo i3tydls eau p;(4 ltoxo tadfa elivo ()trur(o3ou4omtn fcs s)s2ururpoo1oee  fctatfs2elums;t0aeerio3iatopt aieo (0sexm(rpoy4opee nvilt)srtaxrpnu1alenmoeiadlmDeau o u)altnmr totfm r i il(0 rtrirpio4lmeemiesat aDtrxroot4tlt  oeiaslaDuln p t) ltoirciytfpt luvolt  2umio3no1lm e nct t arum(m ;t1tpe if3ias s uau snt)tetrio iydoatrauvolt)srxoir3oydlpt mnvsa(  rtrxmont1tle iociaslaDeanvp;(4trxnio ta1fmt lnvo;s)sruo(o3ou1al emnes t arrax  ;o4opt mi3ilt a2emu snu4 rtnmo3oa1lmD  nvi ()sexoirpou4ol  mfeta(  2uru pnt0aex mieiyslaDulnvsn(0tetrirctadfaDe ivs;( t2trxr3oy4ole licsat) 2tmump;u4tleo feiltfs rmuvsnt4 eeomr3iytfmD ln o (0t2xoim3no1apeelivia()artmurpno4ape  fctaslaDeln ont0alxrif3oa1fa  aiei (0tetm(r3iu1ap emfet sfs2tr(root4oltoif3tadla ea(mp ()teeriocoydopDelnes () 2toxr3oodame mnesa(fsDrm(m no4tpx  fcildfa rmums;u) rtnmr3oy1opDr i olt0t2xm(r3oydaltnlnvi sf 2taumpot4oeeomfciyt a umu sn(4aetoxrcoydlm raiei t0srxr(mpoo4al n fcias a2umu  oo1tpxomf3iytfs2eanvs;t)trxoxrciotlpD lies;( s2uoimpnudal nmnetlsfs2rrur ;o1ole iieiatla ran s;u0 exnxocoatomDraivs;t)seuoxo ou1ap emfvil( aDrm(m ot1olxn f3iytfaDrmuvp () lerxf oy1lm  lnvi t0 2tmir no1lm  livs s  rtax  oo1tlt mieiat sDemnmp t4altnmf3oa1fptr ivo;s0 2trxm3iu1ale lnvsat) 2umum ;t0oex io3tltfaDemuvo;(0 rtoxo3tydlate u o (  exr(rpoy4lptnlicta(f 2trumpou0oexomoetys s2ulnmo;t4tlxrmf3iadlaD  n o;s trumxmpny1opeemnet t sDurur ot4alenio3tlsfs elumonu) lxniocoadlmteaieo;s0t2uoiopio1amt mfet tfarrru  nt1alenmf3tld s eauvs t4tlxomf3iotlmDelu i (  rxoirpno1amee nvs s) rta(r ;u4oet  feiasfa raumont) etoir3iodoateaueslt0s2um(m no4op elnct sfsDraxr ou4tle if3iaslm2ulums;u0 rxomf ootfp raieslt srtr(m3nu1alen fcsasf 2rr(mpou0opt  fctlsfm rl( s u4texoio3oytfat  u olt)s2uoimpou1amtnmnct sf 2ra(mo;o4opxnmoeiat a2ua(ms;(0 rtnmf ta1fmD  ivolt0teuoir3ny4ole lfeiltf 2taxront1olt  i3iadfmDeaump;t0teerxf3tytlp rlnvs;s0s2umir oo4llt  iviasfsrtr(mp;o0openmieiysls2eln p;()areoir oodfm e iesls) 2uoxopny1ale mfctas) 2rmump;t4aleoioeildla emnmonu0aetrmfcoy1lm elies s) rxmxr3ou1olenlneia(f Dua(m nt4texn f3iatlsDulumo;() ltrmo oatlmt lnvilt  2xm(m oo1lpenlncs (f rraurpot1openioetlslm2rlu p (4tlxnxf oatfptrlu o s trurxopoy1omt livil( aDuaxr ot1oetnmfciaslsDrm(ms (4artrir3tatfaDrai i t)s2tmiopiudole lfci t)s2rrx ono4olen octlsfs2uan p;u4trtnxoctytopD aueol()t2xmxr3oo1om   ietl() 2ra(rp;o1apeomf3iys s eauvo;u4trxnif oo1oa rlivs;s0s2xm(o ou4lmtn ict t) Duaumo;o4tee ioeiydlm rauvs;()trxomfcty1fpDeaneol() euoim nodolt  ieta(fa2ra(m ot1oexomf3tlsfs2rl(mpnu)artomr iatoa rai s;s0 rurirpnodlpt mncsls s2umur ;t4oetn oeiadfaDeau sn(4arxrxf3oytlpD aivs t0 exr(m nydlm nmiviat)sDraxmpou1tltnmoeilt aDuanvo (0trxoiocio1lptrln i s)sexm(rpiudlleemnviat artaxrp;t0altomo3tatfsDrau pn(0 ltrmf3oo1lmt  u s;t srum(mpoydaltn ivs s) Dum(mpnt4aeeo f3iadlaDua( o;t4tlenmf3todomte nvi s0 exoxrpno1optelivi s) 2tmur nt1tpx mfciysfs2eanmp;u)artnxr oytfa eauvi t srumxo ny1ll n fvtlsfsDumumo;u0aetn iciyslm rlnmonu0 lenif oydop ean sls  2tmxo nudlleemnctas a2rm(ro;o4opxnmoetydfa2rlu p t4tetnxociydfp  lueo ( sruoim3iu4lpen fvs s) 2rm(rono1texoii3iadfa eln o;u) renio iadom rlu s t0trxmxr oy4apeelnetat) 2rr(rp;o1tltomfeiat sDelu pnt4 ltrxo ootla rau o;( texm(mpnydolt mnesa( sDtr(  nt4teeomictaslmDum(vs u)arerxo3ia1fmD  ueo;s0setriopou1lpe  fvia()s2umxr ot4oee mi3iltfs2um(vs;u4arxrmoctatfa e n i ()teurxo ny1om e fvs t)s2ua(r oo4oexo ictaslmDulnms ()altnmrciadfpDrauvs;t  2urxrpoudope mnct t)aDuau  nt1oex  fcilslm2ra(vpnu) rxnmr tytfaDrai s s0 2xrxopnu4omtnlivsa()a2ua(r ot4teen fciltfsDeauvp t0alxrmo ootopDraneslt0trtrxm ny1apeemfvtltf rtmx  nt0apt ioeiadfaDul(vs u0texnircoadfa  lu o;s sexoiopno4apeemfct sf 2um(  nt0apx  icils s2eauvp;t0 exrxr iadoatrln o;s)s2tm(mpny4amtnmieil(f 2trur ;o1altnif3tadls rauvo t0artrxoctatoateaneo s) eum(opiudopee fcsls)srum(mpoo1opxnmietltfm uanmsn(4teeoio3oadlm eai slt) eum(o3iodllenlivsltfsDumxmp;t0tleniociysfaDrm(vsnu4 lxrmrciy1fp ran o;s truoxmpny1omt mfeta( a2um(roou4altoiietad aDrlnmo;(0altomocoo1faD lieo;( srtrim iy4ll emfvs s  2rmu p;t4aee moeiad aDrau o t4tltoircoydom  auvilt trumiopiu4lmtnlnetas a2raumpot4tpxn i3tld mDra( p u0alenmfciadoaDeaies t)srtr(o io4op elnvsl( arrr(m ;t1tee  fetatla ra(vp t)tleoxr iotoaD  nei (0 etmxrpno4am elneilt arurxrpot4tlxoioetat s2ulumsnt)trtrmoctotlptrauvs ()t2tm(o3iu1optemncias)s2rruroou0aleoii3ias a rmu o;u4teenmf iydfmtelneo t0trxrxo3oo1llte nvsas aDumur ;u0opx mfeildlmDulnvsnt0aexnmrcoodopt  nvils t2urimpnydlpt  ictat) Dur(r ot0tetoii3iasla2rau o;t0arxrmo iy1lmD aivs;t  rumirpou1amen nvilt)sDra(mpou1alt  feiasla elu s;(4 lerxr todlm eai ilt  2to(opiodamt miesat  2rrur ot1opeoioetyd s um(ms (4 rtoxo3oydla   n il() 2umxm nu1al  mfvi s)srrmx p;u0texoiiciad aDul(ms t)texnxo3tytopt  uvo t) exrirpny1oleemiesat sDra(  ot4oexo o3iytfa emnmp (0trtrifciadom ranei ( sexm(m ou1ame lnviat)a2raxmp;u4opxo icilt m2ulumo;u4arerxf iotfmteauvi s0s2urirpiudolte fetlt s2urumpou1olt  o3tyt m2ulumont4 rtoirciodoptraneol() etm(r3nu4lle mfctasfs2tru p;o1ale mfctas a elu ont)tlxoxr tydlm e nvi t)t2xr(rpny1lle lfesas aDraumpot0aexo o3iytfaDemump;t4teerxfcoydop ranei s0trxo(r ny4lmen fvsl()s2umum ;u1ape iieiytfs2ul(vo;t0 lxoircoydlptrauei ( teuoiopiu1ameelnciatfsrrrur nt0tpxnmfciadlm em( onu0aetnmrctadlaD an o s s2tr(m3io1om elfvsa(fsrurumo;u0aet  ietytla2ea(vpnu)teerxr tydfmteaueolt t2umio oodlmtemies (fs2rrxmpoo0teen oeias a elnmo u4 rerio3iadlp eauvils setr(mpiy1apenmivs s)aDtr( onu4opeoii3tadfa2rl(vp;t0trtnmfcoytomt  ies s0s2um(o3ou1llt lfet t)s2taum ;o0oeeniieildls2umu s u)artrir3oy1lpteaieo;s)tetmim iu1ll   iviatfaDum(  nt1tpxomictas sDra(mpn() rermr3oa1fpt aieils  exmxmpou4ole mnetlt s2ur(m ou0opxnio3iad a2rl(vs;t0tetnxfcoy1omt  ueo;t)sexmiopoydam  mneias  Draur ot0apxnmoetydfm rmuvo;() eerxfcoytfp  aiei;s s2xmim3ou1ll e fcs sfsrur(moot4aeenmoctydfa2ul(vsnu4trxoxr3ty1fm e ies;()t2xm(opiy1olte neils)s2um(mo;t4oexnmoetatlaDra(mont)aexnmociytlmD  ies;(  exr(r oudaltnlici (  rtmxmo;t1olxnmieiyt sDumnmpnu4tlxnmr3oadlpD ln sls t2to(r ou1llte ivt ()a2urum ot1oet  ictlt s2umn snt4texnif3iodlaDrli s s)teto(rpiy4ap n ncsltfa2rau  oo4apx mictytlm2rlnmo t0 etrxfcoytlmtrli o s)s2tmxopoydlm emfet (  rtaxr ot1oltoifcilsfs2elu s (0teenmfciodfaDe u s t  2xrirpoo1lp  micslt  Dtau ooo4apen oeiltfs2ul(ms (0 ltrmo3iodlpt  nes;s  euoiopny4lmenmics ()srtrx p;t1teeniicias aDrl(mpn(4 rxrxr iodlmDrlues s)srtr(mpnudalen icsa()a2rmu ooo4oee  octat s2ranvp;u)aexoif3iy1fpD li ols  exo(o3oodal elfctas arururo;o1tle  oetyt aDea( o;t4texoif3totoa raieslt0s2toxrpny1ap  mict t)aDtm(  ;t4tlx ioeiatfmDumu sn(4 rxomr iytom  anvi t  2uoim ny1om elnet t sDrrumo;t0tetoii3iydfa2rlnms;(0treoxfciatopDr u s;()teuo(m oy1lp  mfvtls artrxrpot4tex ii3tas a em( p;(0aleoxo3oodlpte u i;s0truoxo3oo1omt  fcslsf Drm(rpot4aexn oeiasfm uanvs u4 rxnxocoadoaD  n i (  2um(o nodomen feia(faDuaxr ou4optoii3tyd aDem( p;(0altnif ia1lmteluvsl()tetmxr ou1lmeemfet tfaDrr(moou4opeo ieiyt mDrauvp t)aeeoxo3iotoa e neil()trtm(m nydom e ivsl(fsruaurp;u1oetniocildfa2rmu s;(4teerio iadlpDrau slt0s2tr(m3ou4opt  nesa()s2trx ono0olenmiciydfm2ulnms u4trerir3tadlmtr i o t) rtoiopoudllee ietl()arumxm ou1aexnmfetytfs ranvonu)trxoxr3oadfatelu s (  ruoxm3oydlmeelncta(fa2ua( p;o0optomociytfs2elump;(0altnxf iatlp r n sl()seurxr no1lpee fvt t aDtrxroot0tle mi3iatlmDrlnvonu0aetnio oo1fpte nvi s0 exr(o3nudlme  nctl() rurump;u0alxo f3iyd mDranmo (0tltoiocia1oa r iesl()seumim3no4ame mivtas) Drm( pnt1ope io3tlslsDrmn snt4 lxnmo ia1lateaneols0s2tm(m ou1ol n fcil(  rtrxmono0olenmo3iydlmDuan p u) rxrxo3iydlmDe ieo;t  2tmir3oy1opt  ics (fs2um(mo;u0oeenmfetadfsDemu o t4arxnxocia1faDrluvi;t0srtmimpoo4om nlieslt  2rr( ooo0opeo i3tadfa2ean s u) eeoio3iodomtrluvi t0srxmirpiudoleemfcs tf rumurpot4aeeo f3tasfa eauvsn(4alxnirciy1op  lnes t s2tmxm iu4lmenmneias sDta(mpot4ale ifeiysfa rm(msnt0tetrmr3tatlmDr uei ()t2umxrpny4lpt miesat) 2uaxrooo1oeen oeiysfsDeluvo u)arxomr3oadfat ln s;(0truoxopnu1opte ici t sDrr(m nu0altnifctldfs2umumpnt4aetomo3oodopDelu s s  rto(mpnu1amtn fctltf Dtrumont1tpe  o3tadlmDrm( pnt)tltomo ta1oateau s t0t2uo(r ou1ll elics s a2trumpno4tetoif3iyt m uan o (4 rxoif3ia1lmt li s (  2urxr3no4amtnmiesls  2tm(r ou0opxn ieilt s rl( s;()trxnxr3oatop   nei s trxm(o3iy1amt  ivsa() Drmuro;u4aexnifetaslm eanmp;u4 lenir3oytla eli i;t) rumim iudoptnmiet tf Dur(mo;u4olt mieias s rmnmp;u4artnmf ootlm rlueilt s2uoxo oydoltn ivsatfarurxmpot1aptn ieiysfs2ra(ms;u0 lerio totoa  anvi;(0trtrxm3nudapen ietat a2ua(rpot1tetn f3iyslsDelump t)trxrir3to1lp eli i;t srxoxr3iu1lp  mnvtlsfaDrmur ot0ope  ieiad aDul(ms;(4 lxrir oodoptraneo;s)srurxmpiu4ame mieslsfa2raumo;u4aleoifctatls uauvsn(4aetoif3tydla  aiei t setrxm nodlleemncs t arur(rp;u1aexo ieiadlm2ea( p;() exnmr tydlpDrai ils0sexmir io1al nmnvi s srrr(r ou4aex if3iydfsDeluvs;(0tltrifcoo1lm   i s;s)setoio3ny1alen ivsas)s2trxrp;u4tetoii3ias aDem( o;(0tlerif ta1fm e ieo t0s2ur(rpno4opeemneiat aDtrxm oo4oexnio3tyd a2rluvp;u)trxrxf3oadlmt li s;s)srxoxo3ou4om  lfetlt)srtrxront0olto ieias a2el(ms;(0arxrircoytomte iei s) 2tmim oy1olt miesa( arrm( o;o1tltnmf3tld a rmnms (4trerxf iodlaD  nvo (  2xr(o3nudap   nes t srtrxm ot4oeeoioctltlaDrm( s;u)texnir oytlm   uvs (0texoim3oydam nlnvslt s2urx pot1aleomociasla emuvp;u0 etnxo3oytfpDranvi;t0seurimpoodoleelici tfarra(m nt1oet moeild m2rl(vo u4aexoxf3io1oaDelnvi (0 etoimpiu4ame lictl(f 2ua(rp;t1olxn ociydlmDeaump;t4texomf iatoptranvo;s s2tmiopnudopt  ieiat arrmu o;o4oeeoif3taslaDumnvp;()artrmf tatfpD  u o;s texo(o3ny1amtelivia() rrmumpoo4tle iocils s rl(vsnu0aeeoio iodlptrln il(0tetoxopno4altemfeilt) Dtauro;t1oexomo3iat m2rmnmo () etnir io1lat aneo t teur(r3no1op  mnvs s)arrax p;u4tet ioctydfa2rluvsn(4tlerifcootoa raivi;t0seur(o3io1amte ictltf rtm(  nt0opeoif3ildfm2rm( o;u)aexrio iadomDe u ol( t2xo(r3ou1omtnmncia()s2um(r ou1opt mfciyt m um( o (4areoifciytlpD aneo s) 2xrim3oudll elneia(  ruaxro;o1oexoifeiytfaDemnvs;(4trtoio3iatomtelieolt setmxr3ou4lltemiesas a2tm(mp;t1tlx mfetytlaDumn sn(4 rtrif3iotfmD  i olt setmirpoodamtemivil()arumxront4opx ifeiasfmDrm( o (4 rxoir totlpt lu i (0 rxm(r io1lltnlnviat)aDrax  no0open fciytla2el( s (4tleoxr tydoaDraivo s0 rum(mpiu4lmt  ncslt s2tm( p;t4tpto icildlsDrau pn(0aexoxfcty1fm ranvols  2tmxr nudlle lfvs (faDumum ou0olxomoetld m2emump;u)alerif3tadfpDr neil() 2tm(rpiudop n fvi t) rrrxm oo0oee  oetad m2um(mo;(4 rxrifcoatomD ai ils0 etmio iydop e nvsltf 2trxmp;u0teen ietlsls rln s;u)alxrmf oa1lptelneo;s s2tm(mpoo4llt  ictl( aDuaumooo1tpenmoeilsfmDumums (4 exrmo3todoaDeanesl()tetrxo iy4apeelfctl(f 2taur nt1oet  f3iad s ean p t4aeeoir oytlaDraiei ( s2xm(o oo1amtemnvsltf 2tmxmp;t0altoif3tadfmDrmn snu)alxrifcta1lpDr u il() rtm(m3nudap nlnetls  Drm(mont0apxn iciat sDuau snt4aetrmf3tadlaDrli s s)srurxmpou4ll eliet sfa2umx oou0tltomfeiytfm ua( snu4aeenirctydopDrlivo;s t2xm(rpnodolt mnctls  rur(mooo4oee ifeiaslm2uaumo u)tlxoircia1lmtr uei;s)s2tmxrpio4alen nesls  Dtmxrp;t0opx  ociydfm rm( p t0 lxrmr3oodomDeauvs s  rur(m io4opte ivt s artmum ;t0apenmieiltfa uan p;(4 rxrio tydlatrli ol( s2urio iu4opeemncs ()aDrrum oo1ale mieiasfsDuaumo t4 etrir iy1fp elu s;( tetoimpiy1am nmfes t)sDtaur ou1opt if3ias a rauvo u) ltnxo3tytop  aueol(  2trxm oudlleemfvsl(f 2rrur ;o4aexn oetydlaDemnmp (0tlerif3ia1lm  aneilt t2uoim3iodameelfctat) 2tm(mpou4alx mfcilsfs eauvont0tetomf3ia1lpte n s (0 2uoxo iy1lm   netat) 2umu pot1optnmietadls2rmn onu0trtnmfctadfa rluvi;s t2trxo oy4ale lnct () rta(m oo4apxn i3iad a rmu pn(4aeenmf oo1om   uvs;s0 2uo(m iu1lmt mnvslt)aDurx  ;u4tet  oetaslm uln p (4treoxf iodlp  li o s0trumxrpny4aptn fct t  rurum oo0tlt mi3tasla ea(mont0 ltoio3iodfate nvi;s0trumxopnodop e nvsas aDuax  ou1tlxoif3iltlmDemu o () rxnxfctodfm eanes;(0 etoxm3oudol  mfci s)a2uaxm ;t4tex  f3ildfa emn pn()aeeoif ootfpt anes s0seto(r nodapenlnvs (fsDur(r ;t0aex iocilsfm uln o u4aexomfciotlat  uvo s0sexoxr iydlpt  fcs t  2tru pou0olxnio3tldfa2emumo t4 etnifcoy1oaD aiei;t)srxmim3ny1ap  lnei ( a2tmu pot1tltnmoeiyt a rau o (0 rtrxfcto1fmDrlieilt)tetmxr3nydop nlivilt)s2urx  ot4oexniietldfs el(vs;()trtrir iadlm e i il(0tetoir iodome  fet t)s2trumpou1aptoif3iatfm rlump t4texomr3oydomte uvo;s) exrir3io1lpt  fvta(faDtrx  ;u1ope ifctys aDrlump;u4 rerxf3iydoa ean i;( s2umimpno4ole mfeslt)a2tru  ;u0tlxn oeiad mDrmuvpnt4tetrir3oa1omD  i o;t0 2um(mpiy4lp emfet (farur(rpot0texnii3tltlm ua(mp;u4 ltnirctotomtelivslt0 rtoim3oy4lp emiciat  rrr(rpno4aptomi3ilt m rlnvp;u4 rtrmf3oadlm   nesl( seumxrpny4oleemfes t)s2ra(rp;u4ole ifetldla eluvs;(0trtrxrcoy1faD ai o (  2urio nudlmtn ncsasfaDuaumpnt0alx ii3iadfm umuvp;(0artomr ia1oaD  i o;s0trtoim no1ome lnet (fs2ua(mpnt0oleoifcilsfs emu p ()trtoio oytfpDr u o;( s2to(rpiu4amte neia(f rurxroou0oltn i3iyd sDea( o;t0aeeomfcoa1laD  uvilt setr(m3oy1lp nmnvil()aDua( pou0alen f3tltfs2ra(mp;t) rtnio oa1fpD  i o t0 exo(opoudllt livt s)sDur(  no0tleo f3tat s2umn on()alxrio oytomte ueolt  rxrir oo4lpeemiei ()artm(rpou1oet mieiadlsDranvsnu)alxrxf tatom   nvs s t2tr(rpoodop n icslt)srra( pno0opxoii3tyt m em(mo u4alxnxocta1opDr nei s0 etoirpnu1ale  ivsatfaDtaum ;t1ole mieildls uluvo;t4 rxrmf iotfate ivs () etm(rpiy1lmt  ivi ( sDrrxr ;o4tlx iiciatlm2rlnmp u) eerxoctodom raivilt0s2toirpnodol  mfvt sf 2ur( o;u1oleo ictytlm eln p;(4aleomf3iotlmDrlnei;()setr(r3io4lmt mies sf Duaxrpnu4alen ieild aDelnvs;u)alxoxf3iotlaDe ivi;(  2to(r oodaptelfei tfsrua(  ;t1tpxnii3iasfm2umnmo () ltrxf3ia1om e neols0teuoxm3oy1ame mivi tf Duru o;t1aetnii3tatfm uauvs;() etrio tatom eluvsl( srtrxmpny1lp nlictltfa2umxmpno1optoiiciatlm2uaumpnu)texnmo oa1fp r u s;s)s2uoimpny1omte ncilt  Drrurooo4apenmf3iysla elumpn()tetoio tytoa   nes s  rto(opoodolt  fvsl(  Dum( p;u0apxoii3tatlmDemnmo;(4tltoif3io1oaDe ivo;()s2tmim no4lpt mivi t) ruax  nt1oex moetaslmDrlu s;(0trxrxo3tydfmteauvils t2urirpou4ole  fcil(  Drr(r ot1aetnii3iyslsDrm(vpnu)tltrxf3oodom  anvo;s seur(r3iy4lltnmncia(faDumx  ;t1aeeniiciltfa2emn p;u0trtoxo3oadfp   nvils texmir no4olt  ictlt aDrru  ;u0tet ifciltls2eln p;u0 rtrir oodla rlieilt0 2trxmpoo4omt  neiatfsDua(r ;u1tpxomf3iatfa2rmnvs;t0aeenio3iytlpDe neo s)t2toxopoudam n nvias arrm(  ;u4openioeiltlsDua(vsn(4texoifcoy1lpteauvs;(  etrxr3oudaptn fvi s aDurxronu0optoifetydlm ulump (0 rerxf iydfpDe iei s) 2trxm io1llenmies (fs2trx  no4tltnifetadls2rl(ms;u4 eerio3iydfaDeau i (0t2tmxopoo4ope  ieia()arur(rpoo4tlt mi3ias aDulu s u) exnmf3iatfptraivi;() 2xmir3io4ape mfei ()artr(moou0alxn o3ild s2elnmo (4altoio ootoa eluesl()s2tm(rpiy4am emies sf 2ra( pou0tex mi3tytlm rmnmsn(4 exnmfcto1fmD aivi;s) 2xo(m nydoltn ics tfs2tmx  ;t4oet miciytfs uln p (0 lxnxfctydla elu i s) etm(o iy1om e ncil()a2uaxro;o0oet  feiyt aDelnvo t4arxoxr3iatlp e i i;t0teumxo iy4amtelfei s) Dtm(r no1aeeoif3iltlaDemnmp u) eenmf iotlpDean i;(  rurir iu1aleelnes t a2uaxmooo4teen fctat s2uaump ()tltnxocoy1fm eauvs t0trtoxr3oy4omeelfvt (f rrmur oo0opt iieilt s2rm( p;(4tlenio ta1opD au ols seuo(m3ou1omte fvslt)s2umum oo4aexnmf3ilsfs2ul(von(0 rxoxr iytoa rau ils0 eumxr3iy4oltnlnvta(fs2ur(  ot0oet  f3iltfaDuluvsnu)trenmo3oatlmD  neolt0 rxmxopiy4ll  lfcia(f 2ta(ronu0texn fciasfa umn sn() exoxocio1oa r ueol(0 rurxr iudalt lncsasfs2tau ont0tltoio3iytfsDrl( p;t4 exnif oo1fat li s s) rtrxm iydame miesltfs2tmxmpno0aleoioeiad aDrlumpn()trtnxfcoadfmDeai i t  2xmxr3io1am eliet (  rrm(rpno0aetomi3ilt m ua(vp u4 ltoir3oodoa eluvi ()seurir3iydapeelncs ()arumurooo1aptn fciat s2ulnmp;u)alxoxo3todfmtrlnvil() 2xmiopnydlmt liesas)s2ta(ro;t1oex io3tatlaDum(mp;u4arerxr3iytfaDe nvs;t)trxrxo3no4lm nmncs ()srrru o;t1opeo i3tad a2eanvo;u0tlerxr oa1fatr i i;s0tetrimpnu4ale lfctas a2tmxmp;u4teen fetld s rl(vpnt4 rxoircio1lmtran sls)teto(o oodlp  lfcil(f Durx p;u0apxn oetlt a2rmn pn() rxrmo3oodla eauei s) ruo(o3iydlm  mivsa( s2rru ooo0olxoiictlslaDumnvp;()alenxo tadopte uvo ( trum(opno4lltnmnvsat  ruru  ;u1open octltlmDeauvsnu0alxnir3totfpt  nvi;s t2xriopoodal  lici ()aDrr(m nu0tpxo octls aDrlnvo;() reniocootom raivs s) eumxrpny1am  lieiltf rtaur nt1texo fcias s emuvs ()trtnxf iotfmD  n i;s)sruoio3nodolte fetl(  rrm(r ou1tltniictls a em(mo;()aetrxf oodfp elues ()s2xoio oodll emietas s2tm(rooo4tpxn ieiyt a2ua( o t) rxoxf iodfaDrlueilt)s2tmxo3iudop elicsas srtm( pou1tlxnif3iasls ean p;u)teerxr iodop  lneilt0 etmxo oudap n ieia(fsruaumpnt1tltomo3tatls eauvo;(0tetoxf3ty1fm rln ils)srxm(opoodlpeemicsas)srraumooo1oltn feias sDuanmsn()arerifciy1om  auvo (0 2trxo3oydapenlfesa(fs2rrumono4olxn fciatfa rlu ont) renmo io1omDelnvs;s) 2ur(rpoo4alenmnci s)artr( oou0tpx mf3tls mDelnmp;u4tltnmr iytomte nvs;(0teumxr ou4ap nmneils arum(mp;t1aexomociydlsDel(ms;u)alxrxocoy1lp   n o t) 2toxrpnudopeemnvia()sDtaxmo;t4tee mf3iydls2em(mo (4alxnio3oadlmD auvs ( sexr(m iy4alt  fetlsfsDrau p;o1alxo f3tadlmDulnms u0trerxfcta1fm eauvi s0 etrxm3iudll emfetl(  2ua(mo;t0aetomietltfaDumn pnu4treoirciodfa rlnvs;s) rtrir3nudom nlfcsat srrru  ;u1ope  ieiysfsDulnvp;(4aetrif3ia1lmD lneils t2urim no1ap e fvi sfsruaxm nu4oltnmf3iyd s2ua(mp;u) eeomf3iytomD  ueilt)teumxr3oy1lpenlnvs t)s2rmxr ot0aet ifetltlaDemn o t4 renmf iytfp raivi t0seurxm3no4ame lfviatfarumur ou4alx ifciatfaDean p;u) eerxr3ia1fatelueols srtoirpnu4aleelfvi s)aDur(r ;o4apx mfciaslmDrlu p;u4tlxoxf3ootlpteanei;()trtr(r no4llen ivs s sDrm(rp;t1alt ii3iys sDemu on(4tleoxo3to1faDranvi;t0 2xr(m iodaltelnei sfsrrmurpnu0oltn o3ildlmDemn onu4tetrmo oo1op   nvilt0sexrxopny4ameelfetlsfsDrm(m ;u0texoifciltlm rmn sn() rxoiociy1lateaneo t0teuoio oo4ll emneiat)aDrmuroot4oeenifeias s ua(vs (0treoxo3oadlpt  ivolt  rtrim iudam emiei (  2ua(moot0ope micias s2ul(msnu)tlerir3iy1om   nvi ()t2um(opiydal  lietasf rtrxrooo0oeen f3ildlm2ea(msnu4aexoxo3ia1fa e i o s)s2trio nu1omeemnci (f rumu pot0tetoifctldfm rau on(4 ltnxrcia1fmDrlu o t  rxoxr3io1lptelfetls)s2ua(mooo0ope  feiyt s2umu on(0alerxrcio1omtrau i (  etr(r3iu4llenlfcsat) Drrurpoo4aeeniocilslsDul( pnt4teenxocto1lpt  ieo;()setm(r iy1llenmnvtas)s2tmur ;t4olt ii3tydlm emu o;()arenmf ia1oaDelueol(0 rurim iy4altnmfcs (  rrrxrooo0oexoiocilslm2emump () ltnif3oytlmtrauei t sexrio iy1ale lncilsfaDtm(m ou4tlx  o3iasla emn pnu4 rermo3tytfmteauvo;()t2toim3ny1amtn fvils) Dua(  nt1tpe moeiaslmDuauvp u0trtnio3iydfp ean olt)setrxr io4lptn nctls) 2um(mo;t4olen ociyd s2ua( p t0 etnifcootla   n i;s setmiopnu4lptn feils  rtauro;o0aeen fciadls rl(monu)arenif tytlm rau il()s2trxo iu1amtnlfet t srrrx p;u0tee mo3tasfa2eauvo u0 renmr io1fm elies s) exriopoy4alt lfesatfaDtrxr ou0opxnioeiyt sDrmnmp;u0trtoxfcoo1oat  neo t0setoxo oudlpeemictl(f 2urur ot4texn feiat mDulumo t)aexoxf3iatfmD aues;t  exrxopiudame mnvt tfa2rr(ronu1tpenioetlsla2ra( o;t4arxnxo ta1fatraues t) rurxo3nydale mnei (f rumxr ;u4oexoiictydfs um(mo;(0tetrifctytomD ln o;() rxrxm iu1lltnmieiat aDuaum ;u0teeomfcildfa rln snu4artoxociotfpteau o s)t2urio no1lp nmietl() Dtmur oo1aet ii3iltlmDumu sn(4trtrio3io1lateaues t0seuo(m3io1am nmnct s)a2tmxrpou1teto iciyd mDrl( pn()trenirciytfa eai ol( s2tmxo3iy4al emivi (fsDtmxrono0oleomieias s2ra(mpnu4texrmf oa1laDe ivi;s0 etoxo ny4om  mnes sfaDtm(root1aeenif3ias a2eluvpn(4 ltrmo3iadoaD  ieils0 2urxo oy1optnmictas) rtru o;o4texoio3iytls2umn o;()tlxnio3iy1faDrli s s0srur(rpiy1lmtn ics t aDrmxr ;u0olenmfetasfm2eln o t0 rtoif ty1oa  aivs;s)setm(mpnodope  iviltfartaxrpot1oexnmo3tyd m2uau s u)trtoif to1lat ai s s srurir3ny1lp elnet tf rrrur nu1tlxo icildla2eanvp;t)arxomfcoytlpD livils texm(rpou1omee ivslt)s2tmumpou1oeeo o3tas mDuau pn()altoio ootoat livils) 2ur(r3ou1olt lfvslt)srtmu oot4tle  i3ild sDrlump t4 etrxf ia1laDran o;s  rxo(mpiudapeemnvtlsf Dtrum ou1tle  fciydla2rln p;u) etnif oodom e neolt  2xoxopou1apt licias)artmxmoou4olxnio3tldfa umnvon() rxoioctatlm e nvs s trxmxmpou1alt micsasf Duaxr ;o4texnmf3iad a ul( s;()aetrmrctodfaDr i s t) etmimpiy4alen fvta()aDururp;o4oee io3iysfa2eaums u4aexoif iytlp raivol( s2urxr3no4lle  fetlt a2rm( pot0tpt if3tadlaDel(vp u0artrmo io1lptr nesl(0truoxopno4lptnlnvil() Dua(rp;t0tpe  ietlsfm el(vo;(4 rtrmr3oydlaDrau il()t2toxo3ny1lme mfei s sDtrumont4apeo i3iytla2rau s;u)tlxrmo3tadlmD lnvo s)s2xrxo3iy1lmte nciasf Drrxmo;u1alen feiysfs2umu pnt)trtomf oytfpt  ieslt  2tmim3oo4olt mivtasfs2ta(ronu0tlt ioeiydfa2elnmo t0aetoxfciadfm eaies ()t2uoimpio1ape lict s  2rax p;o0ole ioeildlm uaumo t0 eenxo io1laDelies;(0 rumio no1ome  nvsas)a2rm(  ;u4apto f3tatfm ran ont0 exnioctatlpte u i;t srtoxo3ou4ap nlicsat a2ta(mo;u1ape  fcild s el( o u4tltoif oodlat  u ilt0t2trir ny1ale mfetls  Dtr( ont0apt mf3iltfsDuauvs;u4trerxrctydlmtrluvol() exrxr iy1lm e fvta()sDrax  oo0tpeoif3iatla2ua(vonu0aetnxoctadoa   u ils  ruoxmpoo1oltnlnesasfsrtmx p;t0apxnifetadfaDra(vo;t4tlxomo3iotfm r uei;s)srtm(o oudope  nvsa(f rtm(mpou1aee ii3iat m ul(mont0teerircty1lmD  n i s0s2urxr3no1ll elieiat)arurxmo;u0texnifeiadfs ua(vs () exrmr io1op eaieslt)trtoirpou4am  mfctlsfarra(r ;t4tetnif3tadls2ranmp t) rxrxf io1lm eluvo;t texr(r3iydlmt lieta( srtmxmoot0tptnifeildfs2ul(mo t4 etomfcoo1fpDelu i;t)s2xrxo oodam emneia()sDrr(mpou4oleo f3iydlsDean p;() eeoxr todopDrlivo;t) eurirpiodomtnmfctl(fa2umum ;u0ape  octat m2ea(vp;(0 rxrir tytfmtr i sl(0teur(r oy1op   ivslt)aDraum ;o1opxo ocildla umu pnu0arerif oy1fmt  uvol(  2umxmpoodlpe lfcilsfarrru p;o4tex moctaslmDulnmpnu0 eenxo3ia1lpDelues t)t2urirpno4lmtnmfci (fsrrmxmooo4alxomociytlaDul(mp;(0alxnio tadfpt lnvi ( s2uo(opiodamtnmivsl()sDtaurp;o1apxniocilsfaDua(ms u4aetrir tydla e neo (  etoxr nudolt lnvta()aDrau ont1tpeo fctysfs2rm( p;t4 rtnxf3iy1oate uei (0seur(m oy1ll e fcsls aDrrurono0tee mf3tydlm eau pnu) etomoctatlmD  u ils)sexr(opno1ope  ncil()a2ra( pnt0apen fciadfa2rm(mon(0tleomrciydfmD  i i s  2trxopoydamt miviltfaDrr(mo;t1tetn f3iasfm2umuvpnt0 eeoxociotfmt anvols trxm(m3oy1ole lncslt  Dua(moot4optnmoeiaslaDuanvp t0arerxr ootlm e nvi t) eurio3nudlp e nctls)artrump;t0aexo ocild a rmumpnu) etriociatlpDe nvo;(  2uoxo ny1lpt mnvs (f Dra(ronu4oeeomf3iyd a2rlumsnu)arerir ta1omD an ilt0teto(r3nodaltnlics (f rrau  ;u1tltniietasla um( p;u)arermr iatlpD  u i;t s2xriopoo1llenmfvsat)a2rmxrpoo4olx  icilsla el(vsn()texnxf3oydfaDr i i;t teuo(rpnudlmtn fet ()a2tm(mo;o1ale mieiaslaDuanmo;u) ltoxo ootlatrai i ()trxm(m ny4amenmfctasfs2tr( oou4alxnifeildfaDulnmon()tleoifcoodlat  ivi (  2umir3io1lle  ietatfs2tr(ront0ale mi3ilsfa ul(mp;()aexnmo oytop  an olt0 2xoxr3oy4ome mivtas sDtmxrpot0tlx iieild mDua(mpnu0teeoxrcoydfa e iei t tetrxm iy4om nlnei s s2um(r oo4tex iieiys mDuln s t4trxomf totlaDrai o;s trxmimpoy1al   ivsatfa2tau p;t4oet ii3tldfaDelu s;u4 lerifciytlmtranvsls0 exmxopiu4lpeelfvtasfarrax  ;o4aetn o3tlsfm ul(mpnt)texrxociadoa eanvsl()s2xoio oy1amenmnvtasf 2rm( pnt1aet mfciytlaDemnmsnt) rxnxrciotoptrln ils0s2tr(o3io1lpenlictlsf Dururo;t0altnii3tyd m2ra( s;u4arxnxr oo1fa eln ilt s2xrxm oy4op nmnes sfsDumxrono0aee  oeiasfa elnmo;t4texnxo oadfmDelivils) rtmxmpiu4al e fci t)srum(m nt0tpe ioetlsfm2uaums;(0trtniocia1omD ai s ( t2urim iydap nlicsa( sDtrx p;o1oeto f3tlsls2rlnmsn() rxrxr3io1lpt lnvol(0 rxm(m io4altnlfvs s)srrax  oo4tlto fciltfs rmu snt4teerxf3iy1lm ranvs;s)t2trio3oydope  fvi tf 2rrx ooo4olt  o3iasfsDrluvpnu4tlxoif3oadom eai o s  rxo(r oy1lltnlfvtlt)sDtmx p;t4aetnif3tat m2ea(ms t4alxoxrcoadoateluvils0seumxr3iu4lpe  fvt s)arrrxmoou4oltomf3tys s ra(vp;t0teermf3oa1lp  lieo t trtoxr3ou1op elfet (f 2tau  ou4aetnii3iad sDrmuvs;t) lxnmfciatopD livo;s0s2tm(m io1ap emfei tfsDtm(mpot1apxnifcild a2uanmont4alxrxociatfa rln o s0seumxopoudoltelietlt)artm(mp;o0alxniiciyd s2ranms u0tltrxocia1lp e n o () rtrio iodlleelfcias) rur(ro;t1oex ifetlt a2uaumo;u0trtnxf3iydfp   n i;t)trur(opiy4olenlfetl(f rtmur ;o1oetniictys mDel(ms;t4tltrmfcoodlpt aiei () rurio oudlp   ieslt)s2tm(mono0tpxomiciltlmDrauvsnt4trtnxr tatoat lieo (0srurxr oodlptelneilt sDtmum ot4aptnifetldla2um( o ()arerifcty1lm   ivi;()setmxm iu1ol  lncsa() Dtrx ont0ole iieiytfm elump u)texnmr iy1omD anvslt setr(o oydap n nes tf 2raxr oo1opx  f3ias aDem(vo;(4tlenxf iotoa eau i;()setm(opoodlptelnetl(  Dtrur ;t0oltn ociys s2umump;t0altnir iytfmtraieilt)setmir nodaptemnviat) Dtmxmpoo1tet  ietlsla rmump u0aetomfcio1oa  li i;s) eum(m3oo4altemieiatf rta(mo;u4optnmf3tadfm umums u4tetrmo3tydlmt lnvo;t0s2trim3iydlptn fcsat) Dra(mpoo0apen f3tasfa ra(msn() rxoxr ootop eluvolt)trtoio3oy1ame lnct s)sDtruro;u0aleo iciltfa2elu pn(0teenmociytoa e i o;(0trxoxr ny4alt  fet s)sruaxm nu0apxo ociatlaDrm(vont4trtrxrciadla  lu sl()t2xo(mpoo4lm elivi tf 2rrumpnt0tetoiociaslaDel(mo;(0altnmf iy1oaDeauvs s)trtrir oydamenlietlsfs2ur(m oo1apx moeildlmDrlu p t4artrio oatlp   ieo;s)teur(r3ou4amtnmfei s aDtr(r nu0optnmieilsls2ea( ont0aetoifciadlatraueo s0 exrirpnu1ol  micta( a2rmxr ou4tet  ieiatfa umump;t4trtnir oatfatranvols)s2xo(r3iydlpen netlt)aDtaurp;o4tpeomicias aDeauvsnu0 eermf3tytlptr n sls sexr(o3oo1amee ies t srtrx ono1opxn f3ilt sDua(mpnt4altoxr oydfa e n s;(0tetmim3ny1lmenmieta( s2uaxmp;o1tleomoctatfaDuln pnt0aexrmo3to1fp e ues;( t2ur(m3nu4llenlivs tfaDta(mpoo1aeto ieiatfs2ulnvsn(4 eerxo iy1fat lnes s  2xoir3iu4lpe  fvil(fsDurxmp;t1aetnmfetyt s eau on() lenxr oadopt lu s t trum(o ny4lm nmfvs (f rtau ooo4tpx  fciasla uauvs;t) reoiocoa1laD an i t)trur(o iu4am emfci sfsrurxr ;o0oex  fciadfsDem( p t0areoxf3iatoaDr neo s)sexr(r3iydolt mnvslt  ruaxmpnu0tex ii3iytfm el( snt0tlxnxfctatla e u s;t trtmir3nudom nmiei s)a2umxro;u1oeen octldfaDea(vsnt0altoxo todop  auvils0 rumiopnodam  mfcsls) rtaxr ot0optniicildlaDulnvo (4tlxrir3tydlptrlnvs;t  2uoim iydlltelnet (  2rmxrooo4olto i3iltfs2eauvo ()tlerif3iodfaDeln s () 2toxrpnu1ll emici s arrrx  ;o4olto feildfm umn onu4teenmrctatomte i i ()teumxopiy1lmeemfctlsfsDtax ono1apt  ictasla2em( ont4 etnif3tytomte ieolt seuoim3iu4lptnmneiat)sDur(r ;u0tpe ioetytfs2ua(vo;u4arxoxoctatfp rlnvo s t2urxr3io4lptnmieslt  Dta( p;o0tpe  feilsfmDuan p u)tltrmr3ia1lpDelivslt texoxopny4lme livt (fsrurxmoou0tptnmfeiat a2rmu p t) rtoir iadfp rlnvo s0truo(o ny1olt mictat)srrrx o;u1aeto fcilsfm2ua(mon()tltnmr3iydlp rlieo;(0 2urxmpoo1alte ncia() 2raxmpnu0opxomo3ildfm2ea( p;t4trxnxo io1omDe ivilt  eumxrpiy1al n fet t) rrmxm oo0tlx ifctytfa2eln pnu0 ltnmf oo1lmt  u s;(0srtm(opiu1lmtnmfci t arrrxmont0oltniietasfmDrmu sn(4arxrmfctadlmDr neo;t)trurir ou1ol nlici (fsrrrump;u0tlxo oeilt s rmums;u0texomr3to1fptrlnes;t  etoimpoo4am elivtl( sDumx pnu4tpe mietydla rl(ms;u4treomfcoy1fp  lueslt  2toirpoo4ll emics (f 2urxmo;u4tpxomieiyt s eanmo u4 lerir iytlateanvs;t0t2xo(opoo1am  mietatf 2rr(rpot0aeenmociytfs ua( sn(0aeeoioctatfmDeaivi t0setr(o oo1ap e fesa(faDtaur oo0oee  o3iydlm2rlnvp;u0aleomr3oodoptrliesls0texmxmpnu1lp e fcs t) Dtm(mp;o0olen o3iad sDemnvo t4tetniocoadfat lueolt)t2toir3oy4lmtemncslt artmum oo4oleomo3tytlaDrm(vont0 leoiociydlm eaivs;s0 rxmimpiy4lpe mfctltfsrrm(m ot1aptoii3ildlm2emuvpnu4aexomo3tatlmtrln o t0 ruo(mpoo1op e nvi s)a2tr(mpnt1apxn ictadfaDumn pnt0trenirciadfpteaivo;() rurir3iydamt liet t) Dtrx  ot1opx mociad aDrmump;t0 rtrif oadopD luvo;t srtoir3ou1ame lfeia(  Duaxrp;o0apt ioetat m2elnmsnt) rxnxf3oydlmt lnes;t) 2xo(r oy1lmtelfeil( aDua(mp;o0alxo i3ildfm2rmu snu4altomo oytlm eau ilt) 2xo(m no4altnmfvs ( s2ra(mo;t0ope ifeiad a2em(mo t4alxomociatlp  ai s (0s2xoxo iy4omt lfvslt) ruaxm ;u1oltoifcildla rm( sn() lxrio iatfp r nes t) rtrxo3io1am e nvia() 2uau pou1aetnmoeias aDulnvs;t4teerif oydlpDranvs;(0tetoir nu4am n iei t  2um(mo;u0tpt ifctaslm ra(ms () rxomf3io1fa  an ols)trxmim3iudlme  nctatf rtruro;o0texniiciaslmDrmuvo;()artoxo to1fpteanvslt  exo(o3nydopenlfvsls aDur(m ;o1oee  icias m2rauvpnu4artoxrcio1fatrai i s)s2xo(r ny1ole mivias) 2taurp;o4olx ifctlslmDulu s t)trerxf to1opD auvsl(0trtr(mpnydape lfvsl(f rta(r ou1opx miciydfa eauvon(4 lxoxf ta1lat aueo (0sexrir iy1altnlivslsfsDur(  no1tle mieild m eau s u0alxrxf3todlmt auvilt0 etmio iu1lpe mnctat) 2rmxr oo4tpxn fctytla umnvp u0areoxocoa1om eanesl()s2xrio3oydlp n ict t)srur(r ;t1aeeo ocildfm ul(msnu)tlxomoctadfp raivs;t srtmirpiydom emictlsf 2raxmo;t4olxoioeias m emu s;(0 rtrmocto1opDelivs t)srtm(r3nu1llenlfeils srrm(mp;t1tex moctltls2em( o u)aexoif oatfp  lu ols teuoio nu1amtelnvsa(faDtaumoot0alxomf3ilsfmDumn p;t)tltrxrcoodfaD  u i s) eto(o3ny4ol e fvtas arta(m nu4tleo i3tatlmDrm(vo t)artomo iotfptelivs ( tetmxo3iydlpe  fvilt) 2ta(m ;t0apto iciltls rauvp;()trenmr3iydop r n o t  eur(o no1apt lieil()s2rrum ;o0opt ioetldfm2ulnvs (4alxomr to1la  livo t0s2xo(mpiudomenlict () 2tm(m ;u0tpt mf3tldls um(msnu0tleomo3iotomteli ils)tetmxr ou1amtnmicils a2uau  ot4opxo ietad a2ua(ms u4 exoifcoy1lmt lnes (  2tm(o3io4apee icsa( srtrum nu1aetomi3iys m rln p;u0tlxoir tydlmt li olt  rxo(r nudlpteliesatfaDtm(r oo0oetomfetaslmDeluvo ()texnir iy1la eaivilt)truoim oodllte icil(f Durxr nu1oexoioetysls em(vp u)treomfcoadom e u i;t srtmxm3iudapen fctat) 2rm(mont4oex  o3iltla um(vonu0tltnmo3iodopDraiei;(0srur(opnydom emfes s) Dtaur ;t4aee iocils sDrln p ()altnmr3tytfaD aieo;(0s2xmio iu1op  lnesat) rtmur no1tpenmoeias m ul(msn(0aexoxf3tytlateai il(0trtm(mpno1ll e neilt sruaumpnu0aex  fciadla rmump;t)arxnmrcty1lmtelivo;t) 2tmirpiu4aptelnvta( arrm(  no1oleoifeilsfm ra(mo t0texoio todfat  ues;(0setmxopiu4lp elnvslt)srrmx o;o0apeo ieilsla ulnvs;(4alxoxr iadfpteliei;s) rtmimpiy4altemfes ()aDrrxrpnt0aeto o3iadla2rl( pn() lerxrcio1lm rlues ()sexrxrpou4omtnlnvt ( sDumump;u0optnmoctlt m emn o u)aetoir tatfaDe uvo t truo(rpnydoleemivi t  rrmurpot4oetnmoetytfsDelnms;t4 etrmo3tytlpt aieo (0 exrio iy1lmtemnetl( aDrr(mp;t4apt  octytlm rl( p (4 ltrir oatomte ieo ( trumxm oydoltelfcil( aDra(moot4oee mietysla2um(mpnu4 rxnif3io1lpDeaivilt0trxrxo3oo4optn fcsl(  Dra( ono1opeomietydlsDel(vsn(0aeenioctadlpDelueo;() rto(o3iu1llenlivs t)srrrx o;t4tpt  feias m uau sn()tlxrif todfaDelnei s)setm(opoodlleelfetl( aDtaurooo4tlx mociad sDea(ms;(0arxriociodfp eaueils0srtrxmpou4op nlivt tfsDurumoot1tleo ociatlm2ra(vpnu0alerxo ty1opte ues t0srtmxrpnu1om eliet tf 2tmu  no0apx mfciyd sDrauvp;t)tlxoxfcoydfa rlivo t)tetmxo3iudaptnlneslsf 2rr(m ou1aet mo3ias m2uaumonu) ltnir3oa1fp eanvs;s trxr(mpoodoptnlfes sfsDrrur ou4oltoiocilsla ua(vsnt) rxrif3oytlptranvs s0s2xr(mpiudol n nvia(fsDra( ono4tltoioeils aDumuvo;t)arenir oodlmtelnei t s2tmiopou1lmen nvta()sDra(  no4aeeomietlsfs um( o;t0 rtoxoctatoatrlueo () etr(m3oydlltnlfei (faDtmurpno1tee ifctatfs2el(ms;(4alxomrctytfpDrai o t)trtoxmpoy1optemfci () rtm(  nu1tleomietldlm um(vo;u) ltrmf tydlmDe i o;t srtrxrpoy4am n fvsa() Dtm(mo;u0olt io3iat aDea(vpnu) renioctotlm rauvi s) 2xm(rpoy4ap elnct sf Drr(rpno4tpenifeiltls2ulums;t0tltoxf oydlmt li sls0 2xmxrpoy1altnmict (f 2umurono0oexoiiciyd mDuauvsnu)teerifciadomDelies;t seuoio3oydom nmnvt (f rumxrpoo1opt  i3iadfm2elnvo;u4trxrif3ia1lpDeai s;s s2trxr3no4lm nlfetas aDrm(rp;t0alxo f3ildla2rmnmp (0 exoxf3tadopDeli slt0t2toimpnu4lptnlnvt () rumxronu1tlx mo3iatfm ra(vs t4arerxrctydfm e ueilt0 ruoiopiu4lmeemnct tfa2tmump;o1aeenmi3tadlmDul(vs;(0artrxo3tydla eluvsl(  rurir3io4aptn ietat) Dtaxrpnu1altn octatlm2el(vo;t4alermf3totfa elneo;(  2ur(m3nu4ome lfci t  Dum(m nt1olxn o3tldfa2ua(vp;u0 rxrmfciotfptelu i;( t2trxr3ny1ape licsas s2trxm ;u1tlt iieiatls eaump t0arerir3totop rauesl()tetrir ou1opee ivtlsf 2ta(  nt1oltnmi3iydfs2ea(msnt0tleoxrciadlatr ueo;s0 rxoimpno1llte neilt)a2tr( p;o0opxoiiciydla2emnmpn(4altomo ty1oat  i i;s0 rumiopnu1aptelfcias) rtrumpno4apenmiciatla2ul(ms ()teeoxf oydlatr iei ( sruoxr3iudomt  ietasfs2umxmp;t4olxomoctytfsDua(msnu)arermr3oy1fpteanvsl()sruoio ny4lm nmfvsasfs2ua(  no1tpen octadfmDumumsnt0aeenio3tadlaDr ivs;(  etrxr no1alte fes s)srta( pnu0olxo ieiyd aDumnvonu0 renmo oatopD li il(0 ruo(mpoo4lpe  ivsl()srumu pot1apeoio3tyslm elums;u0arerxocoodomtrlies;t t2xrxrpiudlmenmfvt t) 2rmumpnu0tetomi3tls mDraump u) reoxoctytom rlnvo t) rxmir iydap  mnvsasfs2tmurpnt0oltn i3iadfmDraumont4 ltnmr oydfateli o;t)t2uoxr nu4oltn ieia()aDrau pno4olxomiciyd sDuluvp u)arenmf3oatomtean i;t)teuo(m ou1alt lfeia(fartmx o;t0alx mfeiytfm eau onu) leoiocoatfpt ai s;s)trxmio3iy1ol nlivil( sDtm(rpnt1aeto fcilsla2eauvp;(4aeenifcto1faDeluvs;s  rtr(mpiu4llen feiasfsrtr( o;t1alt  icilsfa ua(mont4alermr3tatfmtr ivslt)tetrxmpou4ll   ivt tf 2trxmo;t0ale  fetlsfm2rauvo u) ltrmfciotoptrlieslt0sexr(m3nodaptemfci tfsDtmx oou4apx iictys m emn o (4altrmf iy1om   ivs ( t2xrxo3iy4lp  mnvilt) Durxmpou4tpenmi3ilt m ulu pn(0 ltoir iodfmDrlieolt0tetr(rpiydlltn feslsfa2rm(  ;t0altnmo3iydfm el(ms u4 etnxr ia1lpDeluvo (0 2uoxr3nu4ll nmnvi t  rurx pnt1aetn ieils aDranvp (4 rxnio tadlptrlivo;t  euriopiy4ape mfcsat) rtmx  nu0tee  f3ilsfsDul(vs;t0trxrif3ty1omte nvols) 2uoxm nodop  miesa(farrau pou4alt iiciysfmDra( on(4tleniociy1la elivslt0 eumxo3iy4opeelnci ()sDrrurpno4ape  feiydfa2ua(vsn() eenxrctydomD lueolt setr(m3iu4lpen nes t  ruru pot0alen f3iadlm rm( s;u)tlxoif3oodlm  livs;s0trtmxrpiy1lmee feiat)sDtr(r nt4olt ifciyt a2umnvp;(4aexoio io1fa   neslt  ruoxm ou4ol nmfetlt  rrm(mpoo0tpenio3tysfm2el(vonu0 lenxr oydopDe n olt  2xmxo3ou4oleelfcsa(  2ta( o;t1apx  oetatfs um( o;t)trerxocootop eluei s trum(opnodalt  ivt s srrrx pnu1altoifetldfm2emnmon(4 exomfcta1lm eaueilt0sruo(o nydome lfcias s2rax pot1oleo fcilsfaDem(ms;u4aeerif3iydlm   i s (0 2uriopnydomee nvt (f rta(root4oltnmfetadfs2em( s (4aetnxoctodopte ivsl(  exm(o nudlmtelivtlt)aDrrx  no1apxnmieiydlm uaumont4texrio oodlmDelnes s)teurxrpnu1ome lnes ( a2rmxr ;u0tee  o3iyslsDel(mp u0trxnxf tadopte uvs t0 rum(r iu1lmtelfes tf Draxronu4tpto ietysla uln s;t0alxnxf3iytoptr i o;t0truoxrpny4altn fvilt) Drm(rp;t1aexn fctydfm rmnvo;t) lxrxf3to1lat an i s sruoim nu4ol  mnesas)a2urum no4ape mictlsfs umums;t4aetnmr3totlmteai s;t)tetoimpoudop nmncsls) rtrump;t4texo o3iydlm2elu pnu4tetoxr3tadoptrln ol( trxriopny4lptn nci s)aDtaxm no1texniiciyt m el(msn() eeoio oatom raneo ( srxrim3oydamee fcsl( a2trumoou0tpx miciyt sDel( p (0trtoio ootoa eluvslt0srxmxo oodoltn ivs (  rtrump;t1oexomieiasfaDelu sn(0 eermr3oo1lm ran o t  2tmirpnu1am n iciat)arra( pno4aeeo ociysla2eanvont)tltomoctytfpDeai s;(  etrxr3nydoptnmfct s) Dra(rooo1olt  fciasls2rm(vp t0artnxr ootfmDr nei;s0s2xr(mpnu4om n nciat artm(moot4olx ifctldlmDem(vs u4 rtrmf3iodomt  iei ()setrxr3nydomtelivsat)a2raxr no1aetoifeilsla2um( on(4tlenmfciytlmt liei t)teuoim3nudale  icsas) 2tmx  ou0optomfciltls emn p;(4trenmociotoaD  uei s s2tm(o3oydapt lnvt t aDumuroou1apt ifctyd s2uln ont)artoxr3iy1lp  an ilt)texr(r3oy4olen feia( srtrxr ou0tpe  ietysls2um(mp ()aeeoxr iadfpDranes ( srtoim3nydal  licslt  Durx pou4olenmf3ildfmDum(mo u) ltnmr io1oaDe i s ( s2xmir ny4amen nvt ( s2tmu o;o4tle  oeiysla raums u4altnxrctotfpt  nvi t0 2xo(r oy4lltelicia( a2umx oou4aexn feiys m el(vont)tetnxr3iytlmDran ols)srur(opny4lme lfcilt)a2rrxmo;o0oetnmo3iyt a2rlumpnt4alxnxo ootfatrlieolt)t2xoirpio1lm nmictlsfa2taxm ou4tltoif3iytls2rl(vonu)areriocoy1lp e ieilt0texoio iodllt  nes s)aDtaxroot1tltoii3tasfm el(vp;()tlxnxocoadlpDraues ()s2urim nydol e ivsas  2tr( oot1tpxnioeiydfsDeanmo;(4arxoircoy1oaDelieslt0texrir nu4ll nlnvias)s2tr( oou0tet mfciad s2ea( p;t4 rtoxrctadop rlivs;s0seurxr iy4omeemivsa()a2umum nu1oexoii3iltfa2uanvp (4tlxoxfctytoa rlieo;( s2tm(rpoy1llen ncils srtmur ;o0opt iieiadfs2rmnmonu)trtnifcoadlmt luvs (0 etrir3oo4lmenlfci tfaDtau  ;o4tpt miciysfa umu o (4teermfciytfa raieil()srtriopnydlleelfcia( a2uaxmp;t0oet  ociadls eln s t0 rtoxfctadopDe ivi ()teurxmpiu4olt miet t sDtmuro;t1tpe mfciat s2um(mpnu)texoio3tadfaDrlivol(0teuo(r3io1aptn nvta( sruau  oo4olxnmfetas aDuau onu4aetoifciatfpD  nei;(0 etrir3oydam  lfcslsfsrrmx pnu1oex mociytlsDem(mp;u0trxoir tatoaDr nvo s setr(o iy4llen icsl(  Drrur ot0aetoif3iysfs eanvs;u)tlxomo3iy1fateai s;t)s2xmxm iydllt  fcs tf 2taumpou1tet iieiysfa2elumo;t0trtnio3ia1fptrlivs (  2xriopoodll   net sf 2tr(mpnt0tex  fciatlm eln p;t0teeoifciadop  aivo;t0srtmxo nu4lp nlivtls)a2um(r no4apxo icilsfsDeaums;u4 lenmr oytfp rli s;s) exm(opiudale  nvsas sDra(ronu0tptomfciysls uaump u0treriocio1faDrlnvilt teumimpoo4llt  ictl(fartm( onu4olt  fcilsfm2em(vo u4tlxriocoatfm r uvi;s t2to(opny4alt  neslt)aDtrx ont0tpt mfetls m umn o (4tlxoxfctadfptrau ilt0texm(r nydole  nvt tfsDum( ooo4tpe moeiytfm2ranmp (4arxnir3tadfate uvsls0srtoxmpou4oleemfei tfsDurx pno1opx iieiys s2eau pnt0 lxnifcty1opD aieol( trxrxm io4amtnlietls  rta(  ;o0tpt  f3tysfa2ulnvs;t)treoxfcia1fa e uvo ( seuoxm3io4ll nmictas  rtmurp;o4aexoif3iadls2ranms t0 etrir3todlpDrln o;t0t2umxopny1omtemfciltfartm(root1ole mfcias s2emnms;t)tlxrmrcta1fpDe ieo t  rtoxo nydllee nvs (fsDtr(r ;t4tetomoeiatlaDrm( p;(4trxrxr3tydomtran o ()srtrxopio1ll  mfeiasf rur( p;o1aptomociltlmDran s;(4 etrxf oydomtrlivsl(0seto(mpiu1am nlncsa(fs2umum ;t4ope mo3iyd mDuln o;(4artnmocoo1omDelu sl(  2urxm ou4lpen feilt) 2rmumo;u1tptnmf3iysfs ra( onu0 rxnmo3oy1lat lneo s) euoir3ny1altelictl()a2urumono0oetnio3tld m elu sn(0artnxf oa1omte neils0s2uo(r3iydapeelfetatf Dum( pou4tleo ociasfs rau p;u4 exoxf3oytlpDeau o t setmxopio1am eliei tfaDtrxmpoo1alen f3tasfs ean pnt)artrif3oadfmtr uvsl() etrimpno4am n iesl() Dtr(mp;t0olenioctad s rm(mo;(0areoif iodopt auvsls0s2um(m nu4lm   fci (f Drr(mp;o0oltn feiltfmDel( pnu) ltrir to1om  luvs ()truo(opiudol  lnvil(f 2rr(rpoo0oexomoeiydla eluvp;t) rxrif3iy1fatraivil(0 2xr(opnu1lmtn fvsa( s2urum nt1apt ifetydfm2um(vo;t0aetriociodfmDeai i s0 etoiopoy1oleelnvta(faruru pnu0olenii3tytfmDranmp t4tlxrio3ta1fpDean o t0seurim nodll e ivslt)sDtmur ;u1olen iciys a2ulnmp u4 etoxr3tadlaD lnei;() 2xr(m oy4alt mfetlsfs2trxmpno4opxnioeiys mDumnvo;t0trxrxoctotlat  u o s)t2urio3nydolt lneil(farta(  ou0altnioctatla ul(vs u0 lxnxocto1lp  ai s;( srxmio iudam elnciltfaDrrum no4tlx  f3tytlm emn sn(0 rtrxocia1fp e uei;t0tetrio nydomee ncsas) Durur oo1aptnioeiatfaDrl(mp t0areriocoy1omt  i ils) rxoxr3no4olt  nvs s aDurxm ou0tltnmi3tadlm2emuvs;(4trxrxfcoatlmteluvo ( trtr(r3oo4alte icia()srurxrp;t0aleo o3iat m rm( p;u4tlxrioctatlat luesl( trxoxm io4apeemnvslt a2tr(mono1alt  fetlsfm emn o;(0tlermf oytfm elu ils s2xoiopnydll n ictatfaDurxmont1tleniicias a uanmpnt0 lxnxf3iadlm eanvil()t2xmxm iudomtemivsa()aDua( poo0aet  fciatfm um(ms u4 rxoxrciodomtr nvil() 2toxrpoodam nlfcsa(f Dtax oot0openiocildls elu p u4 renxociytop   n sl() eum(r3no4om n fcils)aDua(r ;t1tpeniociasfs2el( on(4tlxoxfcta1lpDe neil(0s2tmxopnudameelncsa()aDrm(rpnt0tptomfetyt m2rmnvont0tlxomr3oy1fmt aivi;s0 rtr(rpio4lmee nci s arua(  nu1tlt ii3ias m2emumont0 exnmrctytlmDelieo;( s2xr(m nodoptelncs ()arrmx onu4opx ioeiydlm ranvonu4arenxr3todfmD ai il(0 2umir3oy4alenlnetas sDrmu o;t4tlxoifeiaslaDuln s;t4tetnircootop rlu o;t0s2xmxm oodlme  fci s  rtaum nu1aee  ieiad s2ra(mpnt) etnxf3oydfatrlueols) 2xrxm no4opt mieils) rrmx o;u1tpxn f3ils a2ran sn(0alerxo oy1lmDranvi;s0 exrxm iy4om nmnvia()s2trump;t1oexoifetadfa2rm(mp;t)aexnmf3oy1fp  au o;t srtr(rpiy4ol elics s  Durum nt1apxomi3iytla rlu p (4altoxr oo1lmD ai o s0 2uoxopiu1lm  mivt ( a2tm(mp;o0apen iciasfs emnmpn(4aeerif3iytfm  aueo;t teuo(opoy1amenmfcs (f Durx o;t1aptn fciadla2rlnmsn(4artrxr todfat  i i t t2xm(o oy1ol e nvtasf 2rauroot4oexoifeiasfs emnms t0 exriocio1faDeaivi;s srtr(o io1lmt  ivs s)sDtm(mp;u4apxnifetlsfm ulnmonu4trxnmrciytoaD an i;t0t2xm(o3nudll nlfcil(faDurx  ;o1aeen fciltfm2uanms;() rxnir iatop  auvo s0 rurir3oo1alee fesas artrur ;u4alto i3tydfsDrm(vpnt)trerxrcoatlmt  nvo;() 2xoxm io4ome mfvslt arururono4aet  fetas m2ul(mo;u)tetrirctadoa raieol( s2toxm ny4lp  mfvta( sDua(mpnu4aee if3iltfa2eanmonu0 reomr3iotlmteln s;t0srumxopny4olenmfeta(f rrr(rpoo4apt iiciyd sDemump;t4teenxf3oodlaD  nvilt  rur(mpnu1lp  mfvilt)s2ta(rooo4oexn feiysfm emu sn()aeerxrciatopD lu ils trxoio iy1ale  ieta() Dtrxm nu1tpenmf3tatlm rlnvs (4 leoir oo1oat  i o;s teuoir3no4om nmicilt)aDur(ro;o0optnmoctltlmDrauvpnt4 exnxo oy1opD li i;(0srxo(m3ny4opee nei (
\ No newline at end of file
@@ -0,0 +1 @@
+i s;s0trumxm3ou4ol  mies s)aDraxronu0tetomo3iadfa2uan on(0tltrirciy1oa  lnvi t0srxr(o ny4om nmicil(fsrta(mp;o4ole if3ild s ulnvs u) lxrif todlp e ivs s0trtoxm3ou1lpeemivt sfsrrrum ou0aptnmf3iydlm ul(vs ()treoxo oy1optrlu i s0srur(m3nu1om e fvil()sDurum ;o1aex ifciat a2umn pnu)aetoxo3iotoa ean il() ruoxopnu1amte fei s)sDtmxro;t0ale mfctytls ranmp (4aexoifcoa1omD li olt) 2xm(m3nydam e ics t sDrrxmont1aet micildls ranmp u0 rtnircoodlm elueo (0 2uoio3no1oltelieta() 2rr(rooo1apeomi3iydfa2uauvonu0texomr ootlp eauvs;s sruo(r3io1omt mnctlt srtmum ;o0tle  fetatfs umumo;(0teermrciydlpt aieslt0t2to(mpiudlmenmivia( srur( oot0apxnioctytlm elumpnu) lenxr tytop elu i;t0t2xmxm3nodom e fvilsfsrrauront4tlenmo3iysfaDrlu o u0aetnmrcoatlpDeau o;t0setmxr3oydlltelivilt)s2ra(rpot1oetomi3tysls2rlnvs t4treomf3iodomte ies;s0 exmxr3io4lpt  icilt arrmum ;u1teeo oeiysla2ulnmp;t)aexrxo ia1fmtrau sls s2tr(mpoudope mivs t)aDua(r ;o1tetomieias m2eauvs u4altoifciadfpte nei s  2xoxmpiu4al   nci tfa2taxmont4texo oeiaslmDul( ont)texoirciodoa  lneslt)seuoxo3ou1op nmivtls)srumur ;o0tlxniieiyslsDua(mont0 rtnir tadfp e u olt0 rxrxopou4omt livias)a2tmurpno4opxn octlsls2elnvo;()tlxoxo3ty1oa rluvo;()t2xmxm nodlpt  ncsl( arrruroou1olenmi3iyslsDraumpn() renxf ty1omDelu s;t)t2toxo3ou1ol emivt s a2raur ;u0optn ociat a eau s;t0tlxrmf iatlp ran s;t)srtr(o ny4amenlivias)aruax  no4tlxnmo3iyt a ul( p;()tltrxr iadfaDrauvsl( s2uoxo iydal  mivils arrmxrpnt0tpxo ieiltlm2rln p u0tltnif ia1fate neils) rxrxr ou4ll  lnetlsfsDtmurooo0ope  iciad mDua( s;t0tetrxrcoydopDrlnvo;t)teuo(r iodopt mnvta( sDrau  nu4apx  oeiatfm uan p;u0teermrctodlmDeaueo;t setm(r3iu1al  lfvi s  2rax o;o1olenifctlsfaDeaumpnu0altoxr3to1fmD  uvo (0 ruriopio1lltnmnvia(fsrrm(mono4apto fctyt sDranvo u0 eeoxo3io1oa  luvo;s)setoim3nu4am  lfct s aDta(rpnu4alxn octltfaDelnms t4altnxr to1op e u slt) 2trim nudal   fcslt) 2rr(mooo4opxo i3iasfa ulu p t)trerxf3tatfa   i ils0trtrir3nu1alte fvs ()arurumpot0aetnmfeildls eau on(0aeeoxr3iadoptrlivs;t sexrxm3nudame mfes s a2raur ou1apxoiictlsfm2uan o t)tltomf3iotopDeauvslt  etmiopno1optnlncs ( aDrrxmpou0ape  f3iadfa elumonu4tltnir3oy1lmD luei;s0srxmimpoodomt  iciat) 2urumpnt4apeoif3tyslm emn o t0trtoifctatoat lnvs ()setrir3oo4lm  lfviat)s2um(r oo1olt micild a2umn p (0trtrxrciydlmt  uvs;( trtoio iy1oltnmfetas srrmxr ;t0aexomoetldlmDra( o u4 eenxo3oydlmtr i o t srumxopnudamenlfeilt)arrm( pot0altoio3tldfmDumu onu0 eenif tatfp r nes t0s2xr(o iu1am   nvtl( sDtrx o;o0ale mfeiytfaDeauvp;u0teermocia1op   ieils) rtr(mpno4lme liet ()sDrr( o;t0texnmfciltlm uauvsnt0tltrio3oatlmt  nvs;t t2urir3iydap elfciat aDtmx  oo4tpxomfciydls2ean s;u4artnxfctotomDrauvo;()srxrim3no4omt lnvsat s2umx ooo1apeomi3iatfs elumsnt4altrir todfatean s;t truoxopoy1optnlfvsltfaruaur ;u1opto ietasfa2ran p t4arerif oy1oa e uvslt0s2tmio ou1apenlfctas s2trurono0olxnif3iaslmDrm(vsn() exrxf3totfpte u ols)seto(o3oodam  miviasfartrxmonu1aptn octltfaDrmnvpnt0tlerircoa1om eaivs;( sexr(o oudal  mivtl( sDrm(r ;u1openioetlslm uanms;t)areomo tadlpt  ieilt  rumxrpny1oltelfci t  rur( o;u4ope ifetytfa2emnms u)tleoio iodfm eauvols t2xoxrpiy4lpe lnvtat srrau ont4apt  ieiydls emu ont)altrio3todoaDraieo;t)teurim3iydom nlici t aDtm( ont4apt moetydfsDumnvo t4tleoifcoo1faDe nvslt srtoxm iudamenlies t)sDua(m no0aeen o3iat aDrmu snu)arermf todfa elueil(0 2ur(rpoy4ll nmfei t aDtm( oou1teto fciydlaDrmuvon(4teenio tydfa  aies ()trum(r iudol emnesa(f 2urxmpno4oex  f3iasfs2rauvs t0 rtrif tatopDelneolt)trxm(r no1lp  mfcias arta(mo;u1aex iiciad a2ra(vpnt) eermo3oatlpDeanvi s tetm(rpno4ap  lnvil( s2uax pot4tex iieilslmDrl( s (4texoxfciy1om  au i ( sexoim3oy1olt mnvia()artru o;o4olxoio3iydfmDea(vo;t0alerifcia1fptrlivs t0truoirpiydaptelietlt)arrmu pnt1oex io3iatfs2emuvon() etoio iodoa e i ols texm(o io1lmenlnei t) rrmuro;t0oeen feildlm um( sn()texnxf oatlmt aueo s tetr(o3iudamte ncslt aDrm(  ;u0oetniietasfa2rl(mp;u)alxomf ootlp e ivo (0truoxm no1aleelfesl() ruaxmpou1apxn ocildlm2rauvsnt) etomrcoytfpt  uvs;t0t2xmio no1amtn fes (fs2tru  ;o0aetomoeiysfa2rm(vo (4 exoxr3tydlpteaivols)s2umxm3iu1lptelfcsa( srurumooo0tpxomi3iydlaDul( sn()aetoxr oodoateai o;() 2umiopno4op emnesls)aDumxr ot1alt miciyt m ea(vsnt0aexomr3tadop eaneo;(0 etr(mpoo4lle mfvs sfsrtmx p;t4aptnii3tltfsDeanmo u0aeerir oatlpDeaivo s) 2ur(m3io4lp e ivs sf rtaxr no1oexn octltlsDranms;t) lxomo3iydomt  uvo s trxrxrpoy1ap  liciat artaxmpno4tpe iociltlsDrmnvpn(4altnif io1lmD anvils trum(r3iy4amtnmfvs (f 2taurpnt0tetnii3tysfs2rau s u) lenxfcio1laDrluei;( trtrir3iy4lmt  icilt) 2ua(rpoo1tlt mfeiytls2elumo u0 ltrxr3iadfaD  uesl(0seurir3ou1al emfvtas)s2urx  nu1opxoio3tysfmDeln o t)trtniocoodlmD  uei s seuo(rpoudop emivia()aDtru p;o4olt mfciltfm eaumo;t4 lxrxf3iatla rauvs s srtoxr oo1llt lncsl(farrr(  nt1tlxniictad a rmu on(4 eermr oo1lm raivs t trtoxr3iy4apte nct (  rtmx  ;t0optnmi3ildfm rm(vs;(0tleniocta1lm eanvi;( teurxrpoodap e icsat arrmumont4opt  i3ild a2rl(vo u4 leoif ootoat lu i;t)setmxmpiydlptnmfcil()s2rmxr ou1aexnifcilsfa2eluvs u)aeerir oatlmDrluvilt0t2xmirpoydlm nlfeiasf rurxmpot0olx if3iad aDrmnms;u4tltomf oadlm r n s (  etoim oo4om n netatfsDum(rooo0apx ioeiasfa rl( pnu4trxrifcoydlm rlnei;(0 eurio3iu1lp nmicslt)sDua(r ;o1aexnifetatls2rauvp u4altrir oadlat  u s s0seumim iudaptemnetas)sDurx pnt0oeen fciltlm2ea( s (4aexrmr oatlpte n olt trxrxr no4lle  nvt s  2rmum ;u4opto o3ild s2ran s;u0tetrmf3totlmte n s;s  euoxo3ou4am nmietas arurumoou4teen fctldfm2emumont0 rtrifcoadfm  lneo ()teto(opoudape lneilt  Dururo;u4alt  ieiys a ean s;u) rxoxo3iotfa rau ol()sexmxr iy4ome mfcia(fsDtm(mp;u1tpt  feiat a2umu pnt4 eerxo3oodomDe nei (  exoxr io4am  liviasfsrtmuroou4aexoiietasfs2rl(ms;()alxoxf3oodlpteli ils0sruo(mpnu4om nmnciat a2umurpoo0aeeoioeiaslaDra(mon(0 ltrxrcoodoaDeauei t srxoirpou1ap  livils)aDurxrpou4apx mfciatfm uauvsnu0 rerxr3tydlpD  iei s)srxr(o3oy1ap emfcsltfaDraumpnu0tlx miciytla ua(vont)aeenio iadlaD an i t  etrxo3nu4lpee fctat) Drax o;u4opeoiictatfa umnvo u0 rxriociydlm r u ilt) exr(r3no4ll   fet ()sDtaumpnu0oltn oeiatls2rl(ms;u)tetnif3tytla eau sls)seum(mpny4alee feilt aDrrx  nt0oex  icildlaDrau ont4artnmf3tadfatr ueolt  rur(opoy4olee nctas  rurx ono1alx  iciatlsDea( p ()tlxrxf oodlmtr ues ( trurxrpno1ap   nei s)s2tmur no1ole mf3iatfs uau s t4 leomo3oydom elivol(0srumxo3oy4ap e ncils srumxmoou4oeen oetas sDel( onu4aeeriociotoatrai s;s0s2xmir3nydole  fvsl(f 2urxm ;u0alen i3ilsls2eln s;(4tetnxo oo1fatran s;t) 2toxo oydll emnesa( sDrru pou1aee mo3iysla2rmuvo t0tlenmr tatoa elnvi;s)t2xm(rpoo1ll emiciasfsrumum ou0oltnioeiysla2emumpnt0tetnxfciodfa rluvs;t s2toim3iu4lptn ncils sDumu ono4opeoif3iyt a ua(vonu4alerxf3tydlpD ai ilt0 rurir3ou1al emfct t  rumx pot1opt mfeiydlmDrlu p u4altrio ty1lm r i s;t) exoxo3iu1lptnmfvilt  rumxrpot1oexnmfeiydla2uln pn(0 lenmocto1lmtranes ()trto(m3oudope  fes tf Durxmoot0aet mociadlaDraumo t)altnxo oodlmD  iesl(  euoimpio4apee fvils s2rmxmo;u4aex mo3tadfsDea( snt)trxnxocta1lpD  nvslt0t2tm(rpiydapee nciasfa2um(mo;u0ole io3iysla2rm(mpn()altnxfcoy1fp  au o;()sexm(m oy1llee ncil(fs2tmxmoot1teto fcildlsDrlnmp;t0tltnxf oy1omDrlivol(0sruoxo3iydlp n fviat)aDua(r oo4apx  ociyt sDrlump;t) rxrmr oodfm   ies (0 euo(o nodomt mnesltfa2tmu poo1teenmi3tatlm umnmsnt0 reoxf3io1lat  ieils)tetmir3iudop  mfvias srrm(m nt4aee  ieiltlmDrmu onu4trxnir3ootfp rlneols0 etmxopnu1op e ivsatfaDrr(  ;o4texoiieiyd mDua(mp ()arxoxfctytlmDr i i;(  2xoxm3io1omt  nes s) 2rr( p;t0alxn ietatfs rl( o;t4aetnio oadop   u i t0sexmxr3oo1optnmicsltf Draump;t0tltnmoctas a2uanmsnt4 rxnif3ootomtrlnvol( srtoir3iydol   fci (faDraxmont0ole iiciytfmDulnvpnu) ltnxr tytfpDraivs;s) 2uoxr3ou1apt livi (faDtm(rpnt0tptn oeilt s elu p t)trenio3oodlpD au ols s2tm(opny1lmee iesltfaDua(m nu0altnmo3tytfa umu p;t)arxnif iadoate nei;s)seumim iu1am nlncsa(faDtm(mpot0oex  i3tydls emn p;u)aexnmr3oo1fatran ols s2um(rpiu4apt  icilt arrmurpoo1tpeoifetat m2rln s;u)texnir3oa1omte ieols0seuo(m io1altnliesat) rurxronu1oleomfciltfmDrm(vpn(0alenmf oadomtr uvi;s)setrxrpoo1ol   nvi t)a2rmu  no4tpeo ocilt mDuanmo;(4altrif3iytop eauei;s) exoxo nodlltnmnesa()arrrxm ;u1oeeoiietadla el(vs u)alxrxr iotlpDean i;t0srtoim3ny1lpe mfcsas srtaxr ou0oetnmfeiydfmDelnvont4 ltrxo io1fp ran il() rtm(o3nu1lptelfci tf 2rrurpnt4aee  o3iydfm2em( o (0altrioctadlaDraiesl()sexriopiy1lp nlivt s)srua( ooo4ope mo3tldlaDrmums (4 exrmf iadoptelivi s s2xmxrpno4op elfct (faDraumo;t1aee mfctytlmDelumsnu) etoxf3iytlpD lieils0 rtrim3ou1apte fci t)aDtr(mooo0tpen feildls2umn o;(4 ltoxo3tatoaDeau i;(0teumiopio1omeemnviatf Drau oot0opxnmociydfs2uanmo t4aetnxocoa1lp rau o s) etoir ny1aptelics ()a2ta( ont0oeto fciytfa2ea(monu)alxnmo oo1lmD luvi;s) eurxm oy4altelfes sf 2umxrono4tex  feilsfa um(mo;() leomr3oydomD luvs (0trtmxrpoo1ope mnvi t  Dtax  ot1aee if3tas m2rlumo;u) leoxf3oadom  liei (  euo(o iy4opeemicilt aDtru pou0aexnifciltlm2eauvonu4trenmo3iadlat aues;s0trtmio3iydll elietlsf 2umxr ;u0tle miciysla rlnmp ()trtrxf todomD  neol(0tetrimpiu4lptemicta()aDrm(rp;t4tpenifcilsla2uan p (0texnioctadfp   ieils0texmxm3nu4am nlnvil()artmuro;u4opxomo3ildlm raumo;()artrio3oy1laD ai ilt0sexmxr3nudapt miviltfs2tru o;o0tpxnif3tls a rmnmonu0 leoxf3totfm   ueilt0s2trxr nu1llt mnvtltfsrrmxroot0tpeoioeilsfs2umn o;t)alxoir3iotlatelivs;()teuoim3nodolenlivilsfsDtau pou4aexnif3ildlmDum(vonu)aetomfcia1fmD anvs () exrio nodll e fvs (fsruru  ;u4tetnioeils m umnvont0tetoifciadlaD  ieolt  rxrxo oudope lfcias  Draur nu1oleoii3tys aDuanvp;u4tltomf ty1omtrlivi;(0 2xmxo3no1ll  micsatfs2tr(  ;o4tltoii3ildlsDea( o;(4 rtrio iy1optr ieo;s0srurim ny1optemics t) 2tr( onu0teenmf3ilt m rl(vp;t4artoif oytla raneo t0truo(opiy4opee iesl(fsDtrxrpoo4aleo fciyslm rl(vont0 rxnmrcto1om eau ol() rtr(m3ny4ol e nctltfa2tmu o;o0texomoetasfsDra(mont0 leoxf oa1lm elies;( setmim3nu1altelnvil( sDra(  ;t4tptnifcias sDumu p u0 rtomr iytoptrlnvol( t2umxm3ny1lpenlnetatf Drauroou1oee  ociadfsDeauvpnu4aexrxrcia1om rauvs;t s2umxopoydomtnlfcta( a2rrxmp;o4tpeomociytlsDea(mo;() lxomrcoadomD auvs s  eurim oodalt miesa( arrau p;u1openifeiatfmDumnvo t) lermr3oo1omt  ueo;( s2uriopio4omt  nctasfs2ua(mont1tlxomfeiatfs rl(mpnu0aetoxrcoydlp  li sl()trurir3nu1al nmncslt artau  no0tex moeiyslaDuan snt0altnmr oy1la rlivi t)sexmir iy4oltn ictasf Dua(mpnu0altoiociltlaDeauvp t4arxoifcoa1opDeaieil( tetmim3io1llee fcta()srrrxr nu4opeoifciltlmDea(msnu)tlxnmocio1lp eluvo;t)s2tmxrpiydapt  ivia( sDumum ot1tlt mfeiltfa2ra(vs;u0 ltnxo tytlaD auvolt0 rto(opiu1altn icslt  Duaum ou0opt mi3iyt s2elu s;u)altoif oadom r nvil(0 eum(o ny4om  miei ( aDtrurono1tlx  i3iytfa rl( o t4 eerir oytfmDeau o (0srxmirpoudlp emfvsls aDua(rpoo4aexo o3tltfsDumums (4aexoio3iatlpt auvs;t trtoir oy4alee fcsat) Drr(r ou0altomoeiydla rluvo;(0trtoxr3oo1omteaueo () rto(rpno1apt mivtltf rumum nu0tpx  f3iatfs2emuvp;u)trtrxrctodoatrli olt srurxr3iydape micslt) 2ta(  ;t4opx mfeiytfsDulnvs;u4alxnxo3iatfaD anvols  etrxo nodom emnet t  Durxmooo0tlx if3iad s rmnvs;(0 renxrcoy1lat  neilt)srur(o ny1optemfvtl()srua(  ;u1alxomfciydla ra( s t4trtoioctytlm e ivi s setoxopiodaptelnvtls a2rm(mp;o4tlto ieiltls2emuvo;u0 exrmfcoydfaDelueo s  2xoir nu1alee net (f Dum(m oo4opt  ietydfs ua(vo u4tltnxo3oodomt  n olt trxrxmpnu1lpen fcil(fsrtax onu0aetomociydlsDeluvs;u) lxrmf oydfm raieil(0setm(rpiodopeelfcsl(  Dtrum ou4oexn oeilslmDuaumon()artomr3ty1fatrlnes;s0sexr(m3iudop e feilt) rtrxronu4apt mfciydlm2rmn s (0artrmfcto1omte nvi s0trxr(r oudape  nei s)s2raxmoot0aexnmi3iaslmDemnvs t4alxnmf3iatfmtr nvols t2xm(r ny4lptn ncils) Drr(rpno0teeo icildfa rl(mpnt0treomr3iotfpDrlnvil()t2urxm3oodlm nmnvta( a2ra(m ;o0tpenmfciat a em(mo t0tlerir3ta1la e i o;()s2to(m3iudlptelicias) 2ra(m ou0apt  fctldfa ean snu0 exnio ootopte i o;s t2xoxr3nodlmtnlfes t srrmurpno0tpxnmociltlsDemumpnu4aeerir iydoa   nvi;t)tetmio3oo1alte ivt s s2rax  ;t1ope io3iydfs elu p;t0 lxrxr3to1faD aivil(0tetoxrpno4am elfcsltfaDrrurp;u4opxnmoeiysfs2ran p t)tlerxf3iydopt lueilt0srurxm3oo4lptn fviat s2rm(root0teto oeiadla2emnvon(0alxnmocoy1oaD  ieo;t0srumir oo4lpt  nvil()a2rru  ou1aet  ietldfm2eln p t4arermocoadfp elu sls srxr(mpno1lm n netlt  2ur(  ;t0tpxomoctasla2rauvs u) etoxr3oatla eai o (  etr(o oy1altemfeslsfsrrr(mpou4optomfetlsfmDelnvo () etrmo io1fp  anes;s0 rtrxopnudolen feslsf 2urxronu4texomo3tadfm emn p (0 rermf3to1la eaues;t tetr(r no1ll emfeils)aDumxrp;u1ope mfeiysfmDrl(ms u0tlxoio iatlaD ai i s seum(m oy1ole mieta(faDtru pnt4tee if3ilslsDra(vo t0 rxriocoatlateau i s trtr(opiodomt mivsasf rraump;t1oet iocils s em( s;t)altrir3iodfa eli i () 2tmxr oudom  mivilt) ruru pnt0tpen ocils m2rl(vs;()arxnio3ia1fpDelivi;( s2xmxo ny4opeelivta(  rum(rooo4teenmf3tas mDuanvsnu)alermf oydlpDeau slt  eumim3nu4alt  icsatfs2trurp;o4texnif3iyt sDul(msn(4arxnxo3oadop   uvs;( truo(r oodamt lfcsas) Duauro;u4ope iictls sDel(vsnu4 rtrirciydoaDe n s t0tetm(m3ou4lp nmicsa( sDtmump;o4aleo f3iadfa uanmo;(4 lxrxf oydfmDe ueo;() rtm(o3nudom emnesas a2rax  oo1tpxoiociytlsDeauvp u4aeeoif3oadlm raivils)srtmxo3oy4omtn fvtatf Dta(m nu4tee miciyslsDeluvpn(0 ltrxr iodfaDraieo;s teumim3iudllenmictat)s2rm( p;t4tltniiciltls umnmsnu4alxnmocoy1fa  aies;s)texrio3oudll   ncsas)sDrrxmpnt1tlenmoeiasfm2uan p;u0aleoxf totfp eln i s) exriopiu1am nlivi sfsrtmuro;u1opx moeiat sDea(vp;()alxnif iatlaD li o;(0trur(o oo4ape lnetl( arua(mooo1apxoif3iatlm rm( p t0aeeoxr todfat  uvilt0s2xrir oo1al   net sf 2rauro;o0optoifeiad mDem(mp;(4 exoxr todlat  uvi t) 2tm(o iu1am e fcsa() Duaxrp;u1ope moctyt a2uluvo u)arenmocty1lmDraneo s trxr(m3nudll e nvtat  Dua(rpnt1olx  i3tadla eanmo;(0aexnmr3oatfpte n ils truoir3iu4lmenmnvi (  Dur(r nu1aptn oeilsls2eanmp;u)alxomo tydfmtr ivs s s2xrio3oo4amenlivtat  Dtmur nt0opt  f3tydfa em(vpn(4 lxnif tydomD  nvo t s2toirpny1om elfvs (fsDrmu o;u1tex  ieils mDea(vont)arxomrciytomtrli ols texoim oy4lpe  fvil()arrmump;o4alxo iciat a2rln s t4tlxoxo iatlmD aivo;t t2tm(o3nudamt  ivia()s2uax  ;t0oetn ociyslmDumn p;()alxrxr tydfmtraues;t0t2um(mpnu1lptn neta(  2ta(  ou0aeeoii3iat m2rmnvp;u0 rermr io1oatrau ol(0srxmio nydolt lfvtls  2umumpnu4oeeomf3iytfs2rmnms;u) etnmo oy1faDe uvol()sexm(mpnu4opeemnvi t aDtru onu0opx mf3tys sDumump;u4 ltrxo oadom   n ol( t2urirpiy4omeemivilt)a2rrxrooo1apx moctltlsDrmuvp u) ltoxr iotla  an o t  exoiopnu1openlfeslt)aDumum ou0tpxo iciytls rl(mo;t4alenmfciotfpDe u s () rxrir oy4omee nvtlsfa2um(mp;t0opx ioeiydfaDeau snu0 lerxr oy1opte uvi t texrxm iudolee fci (faDuru pou1altnmfeiytfsDra( onu)tlerxf3tadlmt lnvol(  eumirpnydol   netltf ruaumono0alenmf3iysfa emnvp;(4 etomfctatla elu il( sexrio iodale mfcs (f Dtmxrono4tpx ifetadfmDra(vonu0aeerircoa1omDr n s s)t2uoio3oy1omtn fctasfs2raur ou0apeomicild mDrl(vs u0aetoiocoydlmDran i t0srurxrpou4amt lneilt  Dua(  no4olxnmfetld m rauvs;t4 ltnxr oodopte n ol()s2tr(r3io4lleemfvi tf rrr( pno0alt iiciysfm ul(msnt4aetriocoydfmtrli i ()t2xrio oo4lp  liesas  2ua(rpnt1oltnmfctytlsDulumo;t0arxnircoytfmtr uvo;(0 etmim io1lmeemict (f 2raumpnt1texnmoctadlm2umums () lenmo oatfm rln o;( seto(rpnodlmeemicsa(f rrrxm ot4tet  fetadlm rm(von()altnif totlm  li o t)t2xmio3io1lmtemnci (fa2ur(  nu0optoio3ildlm2uln ont)tlxnmo iotlpteln ol(0srxrirpoydllte fesas  2tmurpou1opxnmietyd s umu p;()altoio tytlpD aueol(  rtoxr ou1omtnlnvtatfs2trx o;u0tlenifeiysfaDrm(vonu4trtnif iydop  lueo ()t2toio iu4lleelfvsa() Dra( poo0teenioeiys aDeaumonu0 lxomo3ty1faDeaivs;s0sexo(m3oy4olt lnvsl()srta(r ;u4teeo iciyt a emump;()arxrxo3to1omD auei;( srurirpiydaleelfct tfs2rm(ronu4opxoifeiytlsDumuvs;(4 leoxr io1opt  ueo t seum(m ou4lmeelnes t) Dur( pno4apxo ietltfa2eanvpn()teeomrctytfate i ilt)s2ur(o3oudap elietas)srrrxmooo0oltnmoeias aDem(mo;t) lxoxr3iadlpDeai o;()trxm(r3nu4al  lict sf Drmx  ou1tpxn iciaslm el(msnt4trxomo totlm elnvs () eurxr3no4apenlnvia(  2ua(mo;t0tpt mf3iatfmDuauvsnu)altoif3iadla   ues;s setrxo ny1lpt mnei (  Dtmxm oo1opx io3iyt m rm( o;()arerxr3oatfp r ues;( s2trxmpiydap n nvias s2rmur oo0tlxn oeils m2um(mpnu0altnir3ia1lm r neilt t2xrir ny4lm  lncsl( srtaxrpot1aetoifciasfa eauvp;t4aleoiociatomDr neo;()srxrxo3no1omt lfetas s2umu  ot1texniociltlsDum(vsnt4aexrxf tytoa rlneo;s0trto(r3iydalt lfvtl(faDurxmoot0aetoiieiatls rm( onu4trtoxo3totomt aiesl()t2umirpiudlmtnmfvils) rrru ooo4oltoio3ildlsDelnmont0 lenio3oo1fpDrlneilt)texoio3no1lmeemicils) rtr( o;u0alxomieias mDulnmon()alenmo3oy1lmDr i ilt0s2xrim iy4optelicsa( a2rru p;u0opx mi3iltls emuvs;t0trtrir iatlmteliei;s t2xmxr3oo4lpen feilt a2raxrpou1tetnmictatlm2ua(mp t0aexnirctotopDrai ils s2toim3iodamee feia( artm(mpou0aeenmietld a2ul( s t4 etomo iytoa  liei s)trtr(o nudopte fvt s aDum(m no1tle  i3iys s umn s;()altrxocio1fpteau s;(0 rur(mpnu4aleemfci ()s2ur(rpoo0ale mfeildfm2uanvo;() eenir tatop  lnvs;()trxrim oy4lm   fcslsfsruru o;t1opeo ictyd s rau s (0 ltomr3oytlate i i (0t2xmxopnudlmteliviltfsDtm(root0alxnifciatlmDum(mo (0 eerif todfaDeaneols0setm(opiu4ome  ieta( sDrru ooo4opx ioeiydfa2ua(vpnu0tlxnmo3ty1lpD anvs;() 2xmim3no1am  mfvilt)aDtau p;u4aeeniiciyt s2rl( on(0alxoio3to1fa eanesl() rtrirpoo4ol n ieiat) 2ra(roou0alxniocilsfs umump;() rxriocto1op ean ol( teuoir3nu4lmt lfvil(fsDtmxmpnt0aexnmf3ilsla elnms t0tlxoircty1lpD aies;s)setm(r iydal nliei tfarrrxmpno0tlxomi3iadlmDeaumpnt0 rtnmr iytlm r u ils  2tmim nodol elfvsa(  2ur(r no4oeeo o3tlt m2uau s t4 rtrxf3todoaDranvi s0 2xrxr oo4lpe  nvtlt)srtrumooo1aptoiiciasls eluvsnu4arerxf io1lpD  neo () etrio nodop emnvsasfsDtrxroot1tet ifctadfm rl(mpnu0 ltomocty1faDrlneo (0srurim iodopeelnct ()s2rr(r nu0tpeoifcild mDuan o t0trtnifcoo1latraneilt)srurio3oydap  livs ()sDtm(moot4tee io3ilsfaDelnmo;u4 ltnif3to1lmtrluvo (0s2to(m3oy4lm n ncias) Dur(ro;u4oee mf3ils sDrm(mp;(4tlxnmf3iytlpD lnesl(0t2ur(o3iy1lptn nvsa(fsrtaurpno0oltn feiltlaDemnmsnu0aeenmf3oytfmD anei s t2uoxo iu1lleelnetls)artaxrp;o0apen icild mDul(mp;(0 etrirctodlaD anes s0trurxr3no4omenmivia( sDua( ooo4oee mictaslm2eln snt0 rxnmf3oadlaDrau o s0t2ur(m io1lmenlfcta()arraump;u1alxn feilsfm2el(vsn(4aeenxr3iydfaDe ueo;(  etm(rpiu4aptnmneil(fa2tmx  nt0texnmictldfm2eauvs;u)teeoir3oy1fmtr ues;s)texo(opio4amt  ici t)sDuaxr ;o1altoiociatfm elu onu)altoxocoo1omt  nes t seumirpno4olen nct s)srum(  nu1tptomociydfs2rlu p u4tltomo oatlmD anvs;s sexrio3iy4omt mfcslsfa2trumo;t1ole iocilsfaDra( o;(4 eenxf iatlpDraivs s0s2tr(m oodlltn neias) 2ta(mo;o4tpenmoeiys s el( o u4 lermo3to1fa   n ol( srum(o3iy1am  lictlt arrm(root1opeomoeiydlm ul(mo;t) lxrxf tydomtrli slt)seur(o3nu4lmee icsat  2ta(mono0tle mi3iltlaDeaumsnt0aetoxr3oa1om rli s ( teurir3oy4olenlfvt ()s2ta( pnt0tleniociyd mDua(vo;(0aexomf3oodop  lnes;(  2to(mpoo1lp nlies t aDuau pot0apt  ieiyslsDuaump t4 rerircoatoaDraies;s) rtmir iodapeelfvsat aDrmum ;t4oetnmfciltfa2ul(ms u0 etrxo tydlate ues s)seur(r oodale  ics t)sDta(m ;o1aee  f3iad sDem(mp;t)trxoxf ty1op rlivil()tetmxrpny1ome  ncsat) 2ua(rpnu1olxoii3tltfa ra( o;(0altnmrcty1fa raieo s0trtm(m iu4aptn net (fa2rrxrpnt4alxnmfeiasfaDul( o;(4 lxomf iytlaDr nes s trtr(m3nu1aptn fes ( a2urxrpou0tle iocildfaDrmn s;(0 lxoio3iadfmte i s;( t2xmir nodal n nesl() 2rrxr oo1olenmieildfmDumuvs;() lxoio3iatfpD liei;s0 rtmir3iydoltemfcil(f Dumumpoo4oeenmociltfs2uauvo (0 ltrif3oadfmDraieil( srumio3no4om   neta(fsDrrxro;o4alto iciat a2emnmp;()aeeomr3tydop r ivo;s0t2uo(r3no4om   fviat sDrrx onu1tpt ii3iydlaDran p t)teenxr iotlm rauvol( t2uoim oy1lm n fvtlt)s2uau pot0opeoiieiad a2rmn o;()artnmo to1latelies;t  rxoxmpoodol  mict (fsrtmxmpou1aexnmf3tydla2ua( pn()altomo tadomD anvs t0s2xr(opiodal n fci () rtrx ont1oltnif3tytfa2rmumonu4alxrxocoytfaDrlies;(0texo(r3ou4oltemfcs (  rrmu o;u1ale mf3iyt mDea( s u)teeoxf oa1lpDeaivo;(0t2xmxmpio1ap n fvi t  2rau pnt4oltoiietasfaDeauvo t4aetnmf3iatlm rln ols s2uoir3nydlmte ivtat sDra(r ou0aeeoii3iys sDrm(vo t0altrxr oydlpDran s;(  eum(o iu4altelivil(fa2uaxmp;t4teeoioeilt s emnmp u0 ltnxfcta1fptrluvs;s sexm(mpio1lmte fcs (fsrtrum ;u0texnmfcilsls uaump;(0arerxrcta1lm rau s;(0s2xoimpiu1ol nmfvtlt)sruaxro;u0olto oeiyd aDrlnvpnu) lxnio3oadlpte uei;t0 rtrxrpou4oleelfeias)aDrrx o;u1oeeo f3ildlaDrlump t)trxnxf3ootlmte neils)seum(r3oudlmeelfvs t)s2tm(rpou4openif3tasfm ran p;t0 exoxociodlmDelnvi;(0srtr(m iodomt lfeslt)aDur( onu1aetnmf3iyd mDuan p;()teenmf ty1fm rluvi;t0trumxo3iodlp n ici t sruax oot0altoiictysfa elu pnu4aexrxo3to1la e uei () 2toio oudapt  fctat  rta( oou0tlenii3iyslm2uln s t0 exrxf3oodfa   ivs;s0 exoiopoy4lleemfciat a2umxronu1teenmieiydfs2ranmp (4trtoxo to1oa rln ol(0t2urxo3oodom n nvt sfsrrru oot4oexn oeiltfa2umnms u0 lenio3oydopDeluvi ()s2toio3nu1llt mnvslsfs2ur(r nt4oleoioeiydlaDemumo u)trtnmf3oa1lpteaieo s)s2toxr3no4ap  lfcia( srum( o;u1aptomieiatlaDra(vp (0teerxo iatopteli s;(  exo(r3io4olenlneil(  Durumonu1tpx  o3tad s umumpnu)tlxnmo ty1oaDraiei ( teto(o iu4aleemnvsltf 2urxm no4tpt moctyt s2rmnms;(0 eermo ootfpt lnes;s0seurio oy1lpt lfet sfaDtrumo;u4tetnifciydls uan pnu0artriocoatfa rauvi s)seumxmpou1amenmiciat) rtaxroou4tptnif3tldfa rm(ms t) eenmf tydfmt an i s)trur(o iy1lm  mncsl(  Dta(mono1tetnmiciysfmDuanmpnt) lxomfcty1omD ai o;t0sruoiopno4olte ncslt srtau  nu0aex mf3tyt a rluvs;(0texoxr3iytopte neo s0s2umxo nydll e feias)a2rr(m oo4opt mfetat s rluvp;u4artrmo oytop   neolt0 exmxr3oo1lltnmfcsl(fs2raumpoo4ole mf3tasla emums;(0 renmr3iodopDrlu i t) 2tr(rpou1lle liesatfs2ur(  ou1oex iietysfm2umu p;u)tleoxf3oytoa ran i;t  rxoiopoodolenlivs ()srrr(monu4texo o3tas mDrln s ()teeoxo3todoaDeluvils) 2uriopno1apeemictltf 2umumoou1opt miciad mDemn ont4aexrxrcoytoa ranvs;s)s2um(r io1ole lnvtatf 2ur(rooo0oexn fciasfsDulnmo u4 rxnif ta1laD livs;t) rumir nu4lptnmfetlt)sDum(r ;t0oexomfciysls2um( o;(0 eermr3to1oatelneil(0texmio ou1ole lnctls s2umu ooo1aeenmo3iaslsDrm(mpnu4arxnxociodfpDeli s (0texo(r3io1alenlncil(fa2rrxr nt4aee moeiytfs eauvs;(4aetomr3ty1op  ai ilt)trxrxm io1lleemnvt s)a2uru ono4tpe  ictas m rm(vont0alxrioctytlate ivi ()tetoiopio1lpte ncias  rrau o;o0tlenii3tys a rlnvsnt0 ltnif iodop  lnvs t0t2uoimpnydal e iet tfs2ta( ont1aleoiieiys s2ea(mp t) exrxfcoy1oat ln ol()t2ur(opny4amtnmfvta( s2uaumonu0oeeniieiadfa2uauvpnt0trxoxo3iydlat lnvi;(0texr(opoudomenmneta( srrmur nu1optoioetyslmDumnvs;u0tetrio3oo1lm   nvolt0s2umxopio1optemfctat)artmu  ;t0apxomfciyd m eln o;()teeomf iydlaD  ieols  exr(o ny4om emnet ()arraump;o4aeto ociydfaDrl(ms u)texrmo3oy1opt auvslt0sruoxo ny1lme lfvils sDrmx o;u1apt io3tadfsDeanvs;t4aetrmr iy1lp r ivs s)trxo(r oo1apen ivtlt  2um(r ;u0oetnioeias m2ua(mp u0 rxnif oodfmte ieo;t setoir ny4om nlfesat)aDrmurpnt1tptoioetys mDea(monu0trxnxf3iy1lp ranvils0teurio iy1al emnvsl()aDtmxmpot1tpx miciatfs2rlump;(4tltoir3iadlptrluvs t0 euoir iu4op n ics ( artr(mpou1tpxo ietydls um( s;u4 rxrmrcta1omDelu ilt0s2uoxm oo1opt lfesl() Dtaxmp;u4tptn f3tld a ul( snt0aleoio to1fmDeaivsl( tetoxmpnudam emncil()arrrumpno1tex miciyd aDrl(mpnt4alenxrciytlaDranvs;s)srxrim nu1omte ietl() 2um(mp;u0tptomoeiyt aDum( snt0arxniociatfa r u i;t s2xo(o no1oltnlnvilt)arra(  no0openiieiasfs2umn pnu0trxrmfctydoptrli s s) rtr(r3iu1lpe  ivias  rra(mp;o1tlt  octlsls el(mp (0alenio3oodlm e ueo;t0teto(r3iy4olenmneta( sDtmu pou4tptn feiyt mDrlumo;(4tetrmr iatom rln i s0truo(m3iudamtnlfeia()srumu  ;u4olenmiciytls umnvp u) exomr3iatlmtrlnvilt) ruoiopoy4amtnmiviat aDrrxmp;o1apx iietytla ean p;u4arerxf oodlpteln o;s0srxmxm3nu4oltnmivtl()srtauro;t1tee  icildfa2ul(vsnt) ltniocoo1lmDe neo;s0 2uoxm3oy1lmt licsat) rrm(r nt1tlxoiiciytlsDrlnvo u4 leoxr3iydla elueo;t)trurimpoodlm nlivs s srra(  ot4olt moetydfm eauvp;()areriociodlmt lieo;s0setmxo3oydal emnvia( a2tmxroou4opt mfctyt sDrauvpnt0 rtoxo3oydlmte nvol()t2xmio no1alenlfvsl()sDrru p;o4alen oeilslsDelu p;(4 rtrmo oytom eaivo s s2xmxmpoo1lm   fesl(f rua(mpou4apt mi3iat a eau o;u4 lxnmo ootfm rlieo;t  rxrxm3ou4alt mnesasf 2ua(  ot4apxn ociys a2um(mp t0 exnir3oadlatrlieolt0trtmxrpnydomtelnvia( sDururooo4openif3tatfs2rmuvpn()trtrmr3oatlmD ln ils trtrir nydlm elfei (f Drm(rooo0opxnmictys m emn p;u4aexrxo3totlpD  ivs t texo(o3iodoltemncilt  rururoou4tlxnmieiat s2elu s () exoif iydomDeaivo (0t2xoir3oodalee iesatfa2urxm ;o0tee  o3iltfaDuln pn() lxoxfctodlat anvi;s  rumio iy4llenmnctls) 2ra( pot0oetomo3ilsfm2rluvp t0tltrxf ta1lpDelies t0s2ur(r3iudolenmfvslsfs2rrxmoou0texnifeiadfa2rl(mp;(4 exomfcia1lpt  ivil( s2umir oudlp eliet ( s2rmu pnt0aex  feiyt mDem( p;(0tlxrircoodomtr uei ( tetr(opno1aptnlfcs s)sDtru oou1tpx moetydla2em(vs u)trtnif3ootoateanvilt)s2umxopoo1lp  miei s)aDtrx ono4tee iieiasfm2rlu p;t4 renir3iadfmt lnes;(0t2tr(r3oy4al nlnct (fa2rrurooo0tlx iiciatfs uau p (0texoxo3tatfpD aivols  rxrim nodlmen fcs s)aDrrxmooo0ope iiciatfm2umn p;t0tltrxr3oodfate uvol(0 exr(opoo4al elict ()sDurxr nu0olx io3iytfm ulu snu) eermfciodlmD  i ilt0 2xrxm oodopenlfesat  rrm(ro;o1tlxn i3iydlm2em( s;()aexoioctydomt  n i (0seuoxo3nudoptn fvtl( s2tm(ro;t0tle  i3tltls2ran pn() etomoctotla  li il()teuoio3ny4optn nes (fsrtru  ;u1opxoioctasls ra(mpnt4trenircoatfa e neo;s t2xoxrpoodlptnmneiatfsrta(m ;t4alxn fcias mDea(vo;t4alermo3iytfpteanes () 2ur(m nu4ap nlneiltf 2raumo;t0opx  fcilt s2em(vsn(0altnircootom  aivolt s2xr(m ny4lptelfei tfsDra(ro;o0opxomfeiys s2emumonu)tltomr tadfat an s;()seumxmpio4lmenmnes s)srtr(  ;o0aeeniiciyt sDem(vo;(4aeermfciy1lp  aieols srtmirpnodlltn fvsa(faDtrxmonu0apeniieiadls ranvpn(4 reoxr to1oate ueo;(0 rumim io4oleemncsltfaDrmx  oo0texo fetydfa2uluvsn(0trerxocoydlaDrlies ()tetoxrpoy4ll n nct t  Drm(mpou1apxomociyslsDem( ont4tleoircoytoate ieolt0t2xrimpnu4apt  nesa()s2rrurpnu0oeeoiieiydla umumo;u) lxrmf oodla   ivi s)s2trir3iudaltnlieilt) 2tr(r nt1tetnmfeild a ua(vp;t4trtnmrcoy1fpt lneols s2xmiopny4apt mnesas)sDrrxro;t1apto oeilsfs ulnmp;u) rxnmfcta1oat lu olt  rur(m no4lme lfctl() rrrx poo1aee mfetyd mDua(mp;(4arerxr totomt lueslt seum(r3no1lp nliet ()s2urxrpnu4tlxnmo3ias sDuauvsnt0texoif oytfm rlu s;t)t2xmxo iydll elnvsl()a2trxmpnt1oetnioetyd a uluvs;() leomocta1lm r ueo t0trtm(m iudllenmnvtasfsrtrxr ou0apxnmfetadfa2umn s;(0 eenmo3oo1faD  ieo ( srxmxo oudalenmict (  rua( poo0opeo f3ildlm rm( snt) rermr3ia1lmte ivo;s)t2xoir3ny4llt  fvs s) rraum ;u0aetoiietydls2eln sn(4aetoxo tatfaDeai i;(  rtoxopiudam  mnvs ( srtm(mpnu4apx  oeilsfm rmuvpnt0tltnmrctydoptelies;(0srtrirpiodlm  mnetatf rrr(rpnu0optniociyt a uau o t0tetnxocoydfp r ivo t)srurxm3no4am  miviatf 2rr(r ;u4tpxoif3tas a uln snu0 eenxo iotfm   n o;()t2xoxopoydlm   nvsl()aDtaur no0teeoiictyt aDrm(msnu) reomo ty1omt lu o;s  2xoir iodlmt  iei ( a2ur(roou1olxo o3tldlmDemnmsnt)arenxfcoa1opDr u o;t0texrio iydlpe mfeiatf Dtmur nu4texoioctasfm rmuvp u4trxoio oodomt  i o;t)t2xo(r nodom elfcsat  Duru p;t1tee miciys sDul(vonu)tlxnio to1fatrluvsls0trtoxr3iodope mnct (fa2um(m ;t1tee iieildfm2uanvs u)alxrir3iadop  lueo s  exr(m3nu4om elieia(fa2tmxmpnt1tetoifctlslaDum( p u4arerir3to1lpDranes ( srtm(r oudom  mncias)a2taur ;o4olt  o3ilslsDea(vpnu4aexnmf to1lmtraieol()t2urio oy4lpe  fvia()srtm(m ;t1tpe mo3tldfmDrl( snt0alxrxf tytomt aivs;s  rxoim ny1omtelnes t)a2taxr nt4olxnmf3iatlaDea(mp;u0areoxr iydfat  i o s t2umio3iy4apeemnvi sfaDtmx  nt1aet  feild s2rmn pnu0trtnmo iotfaD luvsl(0 2ur(mpnudlp  lietasfaDurxro;o1aetoifeiydfs eaums;t4arxrmr to1fm r nes s0sruo(opio1lp  mfvil(  rtr(m ot1aleniietat mDean p;t)tetomoctydfmDranes;t0srxm(o3nudal emics s)srtmxr oo4olxomo3iasfm el( p (0 rxnmo ia1fa ean s ()s2urxo3iu1op nlfcsatf Dtrxronu4tetnmfciytlsDrmnvsn() lxnir3oy1fa raues;t0 eum(m io1alt mfcil(f 2umur ot0alenio3iytfm ulu p;t) rtoxr3tydlmDeauesl( setm(o3oo1olee fes sfaDraur no1tetomfetatlmDulu onu0aeerxo ootopteaueo;s0s2xrirpnodopenlivil( a2taump;o4aptoii3ils sDuln o t)aetrioctadfaDe ivs;s)t2trxm iudlpt lncslsfaDrmxr ou1tlen i3tasla2rluvo (4tetnxocia1omD livo s0srur(m3ou4optemict (f 2tmu  ;o1opx iicildlsDrluvp;(0 exnifcty1fmDeauesl()t2tmim3oy1op n nei t)srtm(mooo4tptn f3iytlsDeaumpnt4 etomocoytlptrai o (0 rxmiopiy4lp  lneta(  Dtrxm ;t1olxnmfeiltfsDea(vsnt0altomociatfmtr n slt t2xmxr3oydameelfvi tfsrrmu ooo1aet mfctytls rln snu) renmf3iy1lpD  nvs ()trurxmpio4lltn fcia( a2rmxmp;o1opeo fctat sDrlu pn(4arerxr3tatfp elivi;s texm(m nydop  lnvt s) 2uaxmp;u4tet mf3iasfs2rmnmpn(4 leoxo oatfa   uvi;s0t2xm(r3nydaltnliesl( a2rax  ;o0aptnioeils s elumo u) etrmo tytlpDr ivs;(0 ruoir oy4op   ies s sDtaxmoou1aex  octysls el( o u4tetrxr oadoaD lnvilt srxriopoo1omt mfvtl( arrmu  no1tle mf3iydfaDum(vp;t0aleoif3tadoa raivols0s2to(o3iy4omee fvil( sDraum ;t4oee io3iatlaDrm(msn(0 rxnxrcoadoaDr i s;(0t2xrxm3oo4am nlnciasf Dtaurpno1tetoio3ilsfa ean o;(4tetoio tatomt lnvils  2toxr3oo4alee ivt t)s2trx  ou0tpto feiytfsDua(ms;t)aeenmf3tadlm rauvo s sexrim3nydamt livtlsfsrra( o;t0tleo fctldfs2eanmon()trxomfcoydoaDrau i;t t2um(m ny4ll nlieias a2uaumpno4tlx  icilsfa rlnvs;u0 lenmo todfm rlnvs;t)t2umir iudll nlfesasfsDrr(rpnt0opt  fctadls2ean o u4alxomo3tytfaDrlnvs s) rxoxo oydap n fetls artmu  ;t0tpxo o3tld m ea( p;(0tltrirciodfatrlnvo;s)tetrim3io4lleemfcsas)s2rmumpno0ale  ociyslsDuauvp;()altnmo3iytoateaneslt0s2tmir3iu4ol emneiasfa2rau p;o1tleomieiys m2ranmpnu)areoif ia1fpteauvsl(0seto(o iu1amte ncslt)s2rau pou4aptn icildfs2rl( snu4tleniociytoaDr ies;s  rumxopiy1ll emnetlt) 2rax  no4tpeomocildfmDumn snt4tlermo tadlaD ln o;(0teumxopoo1ame mivta( arrmxr ot1opt  ietas sDum( o u0tltrxrcoo1lmte uvs;s sexo(r nydlpeemfviltf Dra(rpou4aet  octld m eaumo t4alxnmr oodfmteauvo;t  2ur(mpoy1ape lncslt aDtr(mpot0olxomf3iadla2rm(vs;u4aexrxo3iytlatelivi t tetr(o3nodlpt  nei (  2urxr nt4tltn oeiydla rm( s t4 exrmr ta1lpt ln s (0trumxo3ou4optnlnvsl( aDtm(r ou4tleo oeiydfs eau o (0tltoxo tadfpDelu ols)teumiopoydolen fvt s srrau pnt1opeoiieiydfaDrlnvpnt0artrmo3oatfpD  neolt texmir iudomenlfcslt)s2rmx pnt1opx  fciyt aDem(von(4trenmocto1lmD  u s t  2urim3iudolen fvi s srtaxrpoo4texomfeiasfs ra(vsnt4 exrxrctotomD ai o s)texoxm3nu4lpe lnesatfsrrm(ro;t1tpt iiciysfs ra( p u0altnio oy1la eauei (0truoxmpoy1lltemfesas)sDraxm oo4opxo fctlt m2uln p;u)arxoxf3oodfm   n ilt srtrir3iydllen nct t aDur(  nt1aleoifciasfs2em(von() eerio oadfmDr uvi s0 rurir3iy1lmtnmfcs s) rurx  ;u4teto ietys aDemnmsnu)texrxocoatlaDelnvi (  rurxo ny4lp e fesls srtaxmp;t4optomf3tytla eauvsnu4 lenxrciytoa rln s t0teur(o oy4olte ncia(faDtaxrp;o0tpt  iciyd s2eaumont4 ltnxr3oo1fa elnvol()teur(m nu4lme mfvsasfs2urur ;o0texnmicilt s2em(vo;(4alxnio oy1laDeanvsl( t2uoirpnu1open nciasf rumxmoot0oetoifetldlm2rl( p u4aleomo3tydlaDelu ols0t2xoxopny4op nmfeil()a2tmx pno1tle mf3tltls ranms;t0altomocta1fpDrai s;s0 etrxo nydllte icsl(fsDtmxr nt4tlxn feilt s em(vo;u4 eeomfcoydlmD aies ()srxmxm3oodome mfetasfaDrrump;o4aleniocils m2rl( o u)trtrmf tytoptelueo t0truoxo nudaptnlivs s  ruaumoou4tptn ocild mDem(vpnt)texnio3iytlmD  ieils0 eumio3io4ol  lfvsl(  Dtaurpoo0oltomo3tyslaDuluvo;u0aexnxf oadfp   u i;(0sruoxo3iy1ap emnvtl( arraxmooo1texoiociydfm2rmn on()aetoir ty1laD anvo;t teum(o3oy1ame  fetl(farrrur ;u4oexomoeiydfaDrlnmo;t) eerxfcoydfpDeluvilt) 2tm(o3iodop   nci (  2trumpou1tlt ioeildfa ua(mo;t0alxomf oo1fa elnes t)tetoxm iu1am  mivias s2umxro;o1oet ifctatlm2eluvonu0artnifciadfmDe n ils0t2uoxm3nodlm   icslt a2uaxmo;u0apxnii3ildfa rlnvs t0artnir oytoaD livi;t  2xr(m3iy4ale  neiatfs2ra(rpou4apxo ociys mDemnvs;(0teerircoytom rai ilt)s2xoimpno4op e ivsl(fs2tru oou4tlxn i3tasfaDrmn o t4aeenif3totfateli slt  ruoxr3iy4amt  fetlsf Dtr( pno0altn oeiydfa el(mont4 exnif iotlmDrli ils  ruoxmpio4lltnlfcilsfsDuaxmo;u4tleoifciyslmDuluvpn(4alenxo3to1lptrai i;(0s2trxopou1lp e fei ( arrru pnu1alxnmoeiatls uanvo;t0teerxo io1opD luvols s2xr(o3ny1ol elfctl(farurx o;o0opeoif3tytls2ranms (4texoxfciadlp r ivils0seuriopiy1ome mivsl(fartr(m nu4altn feiad a2uan pnu)arerxf oa1lpDe i i ()trxrxo3iudll elict ( srtaum ot4oeenio3tld m uaumsn(4 ltomr todop e ivo t texm(r nodop  mnes t  2rrx oot1apx mfciytla emu s u4 lxnxf3io1om r n o;t)s2xmio no4apeemneia(  2rr(roou1oetnmf3iadlaDemnmsnt) exomrcto1lmD anei s)texoimpio1olt lfcsl( srta(r ot1altniociytfm umu on()aeerifciodfm e i ol()texm(mpiydlleemnvs t arrax p;o1opeo feiyslsDrmnvsn(0 rtnmr3ty1faD aues t t2urio3iydll n nct tfa2trxr nt4oee  ietaslm2eanmp t4arxomr3tadlaD  nvo;t texmxo iydol elici t)aDtmu p;u4aexoiociys sDra( onu4 rtomo3tadomtran s s)setrir no1lm e ivtls  2raum ;u4oexnifeiadfa eaumo;()tlxoir3iodfa eaivs s teuoxo3ny1lpt mncsat)srtaumpnt4aex  ociad sDrmums t0 rtnioctadomtelivol(0 rto(m3ou1op e nesl( a2rr(r ;o4texo ietltfa umnvs (0 rxrxr3tadfp eanvo;s0 2uoxopiy1llt lfcsa(  rrmump;o0apeo f3ild aDuanmo;t4aleomo iodlmt lu i;( srumxmpou4open ieia(fsDtau poo0aptniieils mDumnmo;t0tlxrxr oytfp r n s s0t2xm(m io1lm e nctlsfa2urxmooo4aptoiieiydfa em( pnu0texrxr iytfat anvil() rto(r3nu1omt mfesat)s2uru  ;o0tptoiietls sDeln o t0trxrmo oa1fa  ln i s0 exoxopno4ome mnct s) rrmxmp;u1olenmf3tysfmDumn s t4arxomrcia1lpteln i t0t2xr(r3iy4amen nvsa() Drrxmpou1olt io3iltlm rau o;(4 exoxo ty1fa eaiei s  rur(opio4ome mfesat)s2rrx  oo1tee ii3tydls2emuvp t0 exomfciadopDraueol(  rum(mpiudaltnlncs s srurx oou1aptnio3iad s2rm(vp u0tlxnif3tydlmDrluvs;t t2xo(o ou4om emfeils)sDtmx  ;o4tex mi3ildfmDem( o;(4 lxomoctotoa r ivo;(0seumirpnydlp   ivi t s2trx o;t1aex  i3ias aDrlu p;u4tlxrir oa1oa rln sl( s2xo(rpno4openmictlt  Dur(m nt1altomoctatfaDumu s;u) etnir iydfmt  u slt) ruoir3iu1ap  lnviasfaDumx  nt4alxo ieiadla2rm( o t0alerxr oadoptrlnei ()teurim3iu4al  mnet t)srrrx o;t1oltnmfeiydlsDel( onu0 rxnio3oytomtr n o;s0srurir oo4om n ictls) Dra( pot0tetoiieiys s rm( p;u0 etnmr3ootlmtelu s;s)s2urxopnydap e nvtl( aDtaxr ;u0aet iieildlsDelu o;t4 leoxf tatlate iei t texo(m nodapte fvt (  Drrxmpou0oeenifeilsls ulnvs;(4trxrmo oytoa e uvs;s  rxrim nodapen nei t aDtmx p;t1opto oetytls2uln pnu) etnxociadlp raivo;( setoim nydam   iciat sDrmx ont1alxomoeilt s2ul( o;u0 eeoif iotoaDe uvsls0s2xmxm nu1ope mfvt s aDurx onu4apxnioeiyslm rlumo;t0aeeoif3tydlpDr n o t seur(o3iydol  mfesa(f ruru o;o0tlenii3iasla2ul(mo;(0trxoifcta1oateauvi (0s2trxr nu4am  livtat) 2uaum ;o0oetn f3iyd m ranmo ()alxrxr ty1op eliei;s)trxoxm3nodam  lfcs t  rrmur ;o1aexo ietldfm rmumont4aeeoxo3io1la r ivo s srxm(r3nodomtnmncias) 2um(m ;u0aee moetlslm2um(ms (0 eenmf tytfm rluei;( seuoimpiodopeemfcsl()sDtm(monu0ale ioctydfaDuluvp;t)tetnif3ta1omD anvo;s0srxmiopoudllee nct s  rururp;o0ape iiciyd m2el(mo u)aleoxrcoo1oa eaivo s)setoxo oudlmee icta( s2tmxr oo1oexo ociydlmDrln onu4altrif3iotfp ranvols)seuoxo3ou4aptemfvi (fsDtaumo;u1opxnmociadfs2rluvo u0altnxo3tadlmD  ueils srtmim no1om  liet t)sDtm(mp;t1aetnmietatfm uanvo t4trerxr3to1fptrlu i;s  euo(o iudop   neslt)srra( pot1aptomfeiasfm2rl(mp;u4trermrcto1lm r i o s) rtrimpnydopen iesat)s2rrxroot4ale iiciysfsDum(mo u0aexnmf3oytoat lnvsl(  2toxm3ou1al elfcsa()srrrxr oo4ole mfeiysfa elums;u)texnmr3ootfpD  nes;()t2xo(m iodomeemnei s)s2tmxmpou0tee  fciat m rmu ont0arxomr iatfpte ieo;()texoxm3io4am nmnvslt aDta(  no0oexo feiasfs2ulnmsnu4aeeniociadoatrauvi ()t2xmxopiodolenlivs sfaDumumpot4tlenmfctatla ea(ms;(4trxrxociydfptean o s0s2tm(mpio4lmenlici ()a2trxr oo4aeto oetadfmDem(vs ()tlxrxfcoy1omtrlues t) 2umxr io1lp   nes sfarrm(mo;o4texoifeiys aDra(vp t4arxrmo iadfat auvs t sexr(m3iy4lmtelicsas)aDuau pot4alxnii3tydls2umump;() ltnmfctotop e uvo;s)trurxr ou1omtnlnes (f rur(root0apeoio3ilslm el( s;u)alxnircoy1lp e ieo;()s2xmxopio4lm  mietl(f Dtr(rono1ope iieiat s ranvs;()trtoxo ty1lpteaneolt  eur(m iu1op e nei t artmurpnt1olxn fciatfa2emnmp u4 exnio iotfm  ai i;t0trurxr io4am elnvslt)aDum(mpou0aetoiieiatls rauvsn(4 rxrxo tatoat auvo;s trtrirpoodom nmies t aDrmxr ot1optnioetatlm rmumpnt4 rermfcootoaDrln i t0 rum(r nydaltelfcsl(f rum(mp;o0alxniieiasfm2ulnmsnu) etoiociydfmteaueo s)texmimpno1op nlncsasfsrum(mpou4oex moctls s2ranmo;(4aetomr3oa1oateauvolt0t2uoir nodamtemnvt ()sDtaxm nt4tex  fetatfaDrluvs t4 leoxoctytlmtrlies;(  rurxrpiy1lp elnes t)s2ta( ooo0olxoio3ilsfmDranmp t4alerxr oo1om eauei s  2umir oo1alt mfvs tf rtaum nt1oet ifctlsfm2rau snt0 leoirciotlpte iei;( truo(o3nodop n neias)s2ra(m nt4aexoiiciydfm uaumo;u4tltoxf iydfpteaivols seumimpiy1llenlieilt)sDtrx pot0ale mf3tldlm eauvonu)alenifctytfmt au i s t2xmir3oo4lpt  icils s2tmu  no1tex  fcild s2rm( sn() rxnmr iadfaDran i;t t2uo(opny4lmt lncsat  rtm(rpnt4tlt  fctltfm2umnmsn(4aeeoxfcto1fmD  uvi;(0 2umxr iydam nlfvslsfs2rau  no4tpenmiciltfaDuauvont4 ltoxo tatlmD lu ol()srto(r oy1al  livs s)s2rr(  nt1oex  oeiyt m2rm(mp ()tlxnxo iadfpDe ivo (  rxrio iy4llt livt t) rrm(mo;t4aexoioeiatfs2uauvpnt0trxoxrciydfp  an o;s s2xr(o3no4olee nvtlt)arum( pnt1tpxnmo3iydls ul( o t4 eenmo ty1fmt au slt0t2urio3iu4openlfctlt arumx  ;t4texnif3iatfmDea(vs;t4tleoxocootlp r ivo s s2uo(mpny1ale  fvsa(  Dra(m oo1oee if3tytfaDrln p;(4aleomoctatfate neslt trtm(mpio1omee nciat  2tr( ont0tpt iictaslm umnmp;t)aeenio tydoa   iei s)srxrxr3iy1lmen fcils a2rmuro;o0tpt ii3tatfa2el(ms;(4 ltnmocia1fp e nvi;t trxm(opiudlltn ictas)arrm(ro;t1oetn fciatfm2ra( s t0arxrxf ia1fmD  u slt s2uoiopiy1ap  lnet t) rtrurp;t4tee io3ildla2rau pnu0teermfciy1fpDe uvi t srxoiopno4opt mnei (  2umxm nt4teeomo3tltla2ran pnt0 lermr3iydlpDeanvilt0trum(r nydllee ictl() Drm(ro;o4aetnifciat m2emuvs;(4trenmrctytla  ln o;t0s2xmio3oydlle mfcsltfa2uaxmont4apxoioeiadlm rmu o;()alxomr3oo1fm elivi s0s2xoio iydal n ivt (  rra(mpou4texo ieiltls2rluvs t0teenmrctodlatelu o s srxm(o iodlme livtlt  rrrx  ot1apt ii3iad sDeanms u)artnmf oadlptean olt s2tr(r nodal n nvt t)artmu o;o4opx mi3ilslm2eauvont) ltomr totlmDeli slt)s2um(rpoudamtnlnvs ( aDtmurpno0aetoifcildfa rl( snu0 lxrmf iadoat aneo ()s2xmimpoodaltelnetltfaDumxm ou4opt  fciytlaDemnvo (0 rtnmo3iydlp r u i t0s2xr(m ou4ol n fviat aDrmxmpnu4apt  i3iytfs2ulnmp;()arenxo3todfa eai ilt seumimpio1ape  fcsl()sDuaxr nu0opt mfciltfm ea(vs;u4aetnmo oy1lm  lnesl(  2trxr oy1lptnmfet s)s2tmx  ;o0aee mf3ilslm2eanvs u0arerxf3oatom elies;(0 2ur(m oo1am  mnvi t arua(rpnu0ale mf3ildfa rlnmonu4 etrmo io1fmDelivi s0teurirpoy4al  mnci t srur(mp;u4aeeoiieias sDrauvo;t4 lerxr3oy1lpDr ivi;()texoim3io1ap emictl(fa2uau  nt4olxomo3tld a2um(vo t0 rxrir3oatfmD auei () rtmxr iydamenlivia(fs2rruro;t0ole  ieilt a2ranvpnu0teerircio1op eanvils0 rumio iy1om elfciat  rum( poo0oltoio3iadlmDul( o ()aeenircty1lmDraueo;()trumim3ny1lpe  fvt s) Drr(rono1teeoiociyslsDeluvs;()trxomf totla  au i;t)sexoirpiu4lp emivil()artr(  ;u4oexn feils sDrmuvp;u4alermo3ta1lpDrauvilt)s2urxo nodlm nlfvta()a2ra(moot1aeeo o3iad s2uau s t4teerir totopD liei t)t2xmim oy4altnlfetlt)srtm(mooo1oltn feildls rauvsn(4artrio3tatlmDr i o t0 ruoxr3no1omtnmnet t)srrr( pot4tpenmf3iasfa2eluvsn(0 eeoxr3todfp eau i () etoirpio1lltemfvi t s2rrxroou1tpen ictyt s2emnms (0 renmo todoaD  n i s0 2xrxrpiodlp elfctatfs2ta(ronu0ope mfctltfmDemumont4trerxr3iytlp ean o (0teurxm nodame mictatfaDum(  nu0oeeoifciadfs uan s t4 rxrmocoydoa  aiei;s0teurio iydolenlfeia()aDtax  ot0tpx iietadfsDel(ms;u0aeenmo3iatoptrlnvslt0tetmxopnodame  iviatf rtm( pnt1tptnmi3tlt sDeau s;(0 exoxo tydfatraivo;t0tetoxo iy4olenmies t) rrau  nt0oltn ocilt m2rm( p;u0treomo tytfmtelivi s t2xr(m3iydap nlfetlsfaDurxr ou0tptoiictatlaDemnms;() rxoiocoadlmDrluvo s  exrio3io4oltnmiet t)a2umx oot1oee mo3tls sDulu snt4arxoxf3oa1oat anesls0srxm(o3nu4omeelnvtl( arta(mp;u4oleniieiatls um( snu)trtniocoatla eln i s)srxrxo iu1lm e ivi (fs2uaxr no4tle  f3ild mDrlnmp;(0trxnmrctytfaDe nei t)seurim nu4omt  netat)s2rmxrpno1aexo o3ilsfa2ra(mo;()aetoxrciydlm e i ol()tetr(opou1ol  mivt ()s2tr(ro;t0tetnmociatlm2emu p;u4aleoxo oytfp eai ol(  rxo(mpny1olen nvsl(f 2tr(m nu0oexomoctldlsDel( p u)arxnxr iy1fmtr neils s2tmxo3no1am  liet (  2tmu o;u1tee  oetatfs raumsnu)teenir3oatoat ai olt0texmio3oo1ameemfvi t  rurxro;o1aee ii3iltfm emnvo;u4tlxomf oadomte nes t t2xrxo nudaltemicias)sDtaurpou0tlx mfeiydfa rmu o (0tltnxo oydom e ivo;t)s2to(opoodam elncilsf rraxrp;o0optn i3iltla el(ms t4trermr3to1oaDr i s t s2toxrpnu4lptn fesatfaDtm(mpou4apxnio3iyd s2ea(mp t)aexrxocoa1oate ivsl(0srxrxo3nudomt mncias sDua(rpou4aexnmoeiytfmDul(mp t4artomf oytfat aies s)t2um(m3no4olt licta() rururont1opeoio3iyslm eanmo;t4aeermo3oytom e nvs;s  eumxrpoodlp nlfct t a2umxmpnu0aetnifeiat aDeanvpnt4 etriociatfmt aueo s  2tmxo3iy4apeemfctltfarumxmpou4ape  oeiltfsDemn p t4alerxrcta1lpt livo;s  exoxr nodlmtnmnetls) 2tr( p;t1oltn ocild a2ulumo (4aeeriocio1opteli o s0s2xm(o3ou4lp  livt tfsDumxm nu0olt moeiyt s ul( p;u) leoxf oytomD aueils sexm(rpnu1lltnlnvsas arrmurpoo1oleoioetlsfaDranmo u) leoxo3oy1lp   neo;(0 rxmim ou4ale lfvsas sDrm(ro;t1oexoiieiadlmDeaumonu4 rtnxr3ia1fpte iei;s  2trim ou4lptnlicta()srtmumo;u1tlxn ieiyt m2ea(vs;(4arermo tydlp eai i;s  eur(r ny1lm emnvs ()a2rm(rpnt4apeoiietat m ranmo u0 rxrmf oy1fatrln ols) exm(o io1ameemivt ()arumum ot4texo f3iasfs ra(vpn(0aexomrcoadop rln s t t2trxm iy4ope mnesa(f 2umxrono1oeeoiiciatls rm(mo;(4tlxrxf3tytop   nvi t)teuo(m iy1ale  fvtasfaDrr(rpno0tpx  o3iydlm2emn s;(4tltrircoo1fmDeluei;t teumio3oudll emnesl() rurxmpot4tlt  ocias a2el( s t)alxnxf3iydla ean slt0 2uo(opiudlm nlfet s aDur(  ot0alen octyt a uluvp;t)tlxoir iotlaD  u s s)trtmimpnydopte ivs () 2rr(mpnt1alt  oeiydla elnmo;t) etnxr todfpt ln ils)t2uo(o3ny4lpeelnei () Dtm(mont4apen i3tat s rlnvo;()tlenxo3tadomDe n s s0s2trxo iu1lmenlnvs ( srtr(mo;u4ape mi3tld s2ua( p t) ltnio iatoa rlivs;t0s2um(mpoy1lp emietas) rra(root1texo oeiltfm ea(monu) rxoxrcoatom e iesls  2xmiopio1lp  lfcs ()s2ur(r nt4texo octls m ra(ms;t) ltrio3totopte uvils0 rtm(m nydale  ictls)srumu pnu4tptn f3ias s umu on(0aetrxr ta1lpDrai o ( teuoimpno1om e nctl(fsDum(monu1tee iiciys aDemnmon() eenxocoatoatran ols0truoxmpiu4lmt  icsa(farumxmp;o0texnii3tad m rm(ms t0tetrmo3ootfateaivsl( s2urxo oudlmee nvsat  2rmum nt1aetnio3iyslm ranmp u0 rxrxrctytlaDe neo;()srurirpou4am  lnet (fa2rmxmo;o0ale mictlslaDelump;u0aeeoifciatfmDelies t0trtoirpno4ame lfvtl()s2taxm nt0tlxnmieils s eauvo t0 rxrxo3iatop  anes t srur(o oy4alt mivsl(fa2taxr oo1opeomo3iyslmDranvpnu0 eenmf3oatlatelneslt sexmxmpoodlm n ivias)a2tr( pot4apen f3iatls umn s t)texnio3iotfmtraivi;s srtoio3iu1omtn fei t)srrrum no4tpxoiocias m2ranmp u0tetnxociodoa eaieolt trxo(opiy4open ictat sDtrxm nu1texoiietyd mDulnvp;(0aeeoxf3ty1lm rlu o;(0 2xrimpnu4omt licia( sDrm(  nu1aetomicilsfa uan snu0alxrxfctotlateau i t  rtoio iodomtn fesls) rraump;t4ope iicildfmDulumont)trxomf3todfp  lu olt sruoim iu1omtn fcs s) rrmxmpoo0oetoio3tytlaDulnvon()alxrxf to1lpD ln ols  eurir no4llenmnvt t)aDtr(mpnu4tlt  i3ildfs ranms (4treomo3ta1lp  ln sls t2urxm oy4lm nlietasfarurum ot1oexnifeiydls2ran on(4aetomr3oodfm   iei t)setoxopiudlptemfeil(f 2uau p;t1tet ifetlt s2ua(msnt0 exrxoctatlmDraiei t srtoxmpoy1am nmnvs tfaDtrx pnt1aee  ieias m2el(vp ()aeerifcoy1fmDeaueol( sexriopnu1omeelnvil()a2trx  ;o1ope mo3tadla2rlnms;(4tlxnifctadlaDr ivo s seurimpiy1ap emivsat)a2taxroot0alxn fciysfm2rmumonu) rxrxrciotlm rlivi;(  2uo(m no4ale mnvil(  rua(m oo0aexnmo3ils a rmnvo u0 rtomocoo1fmtelieols0t2to(m3iy4ol nmivtls a2tr(rono1alenmieilt s eanvp u4trtnirciodfa rli sl(  2xoir3oudamt  icslt)srum( pou4tet mfciatlsDua( o u) lenxf tatom  auvols tetoiopiudop n fcias  2umu poo4opto feiyd s2ulnvon(0 lxoxoctadop eaieilt)t2uoxr no1ol  lieta()s2um( pnt1apx  ocild s2emumont4trxrxo3tydlmDr ies s) exrimpoodlp e nvt sf rtrx o;o4teeoiieiltlm2rm( snu4tetoifcio1lmDr i olt) 2xm(r iudlpt lfeiat) Dur(m ;o0alx  oeiydfa rl(ms;u0tetoif oodfmD aneo s0 2trxo3iu4llte ivilt  Drmxm ;u0tptoifciltlm2el( snu4altoxf3tatoaDeaneil( s2umir iudlm  mivi t) rtau  ot4opto o3iatla rlu s;(0aetrmr3oatopteaivols  rxmim3oo4ll  mnvils a2rmu  nt1oltoioeiasfm2ra( p;t)tlxriocootop  aivsl(0trumxrpny1al   nvsa(fsrta(r oo0olto i3tytla2eanvon(4alxoir3ty1omtrau olt)texoirpny1lmt  nvia( artax p;u0aptoifeilsla ean onu0aetoio iytlp  lueo;s)s2xr(opiydlm  mnetasf Drr( p;t0ope iictld a em(vo;(0trerir tydoaD aueo;t0texmxo3nydaltemneias)sruax p;u0oetn ieias s2eauvo t4tlxoif tytfpt lneo s t2umim3ny4lp elneia( s2uauroou4oex mieiysfaDrlnmo t)tetrir3ty1lp rau ol()s2tmiopny1optnlnvtlsfsDum(mpnu1tlt  oeiyslmDrmn p (4 lxrifcta1fpDranvi;s s2tmim io4aleemnvsat) 2urumooo4alxo feiyslm2elnvo t4tlenmf3ia1lmD  u s;( sruo(mpoy1ol  mfvs sfsDtrx o;u4olt mociltlaDranvp (4 eenmf3oa1opDeanvils s2um(mpnu1olee ncsatfartm( o;t4oetomi3tlt sDumu s;t)tetoir tytoaD livi (0srtmxm3nodape miet (  rua(mpno0tlxnio3ilsfm2umn o u0alenmr3ootomteai o;t  eum(r ny1aptnlfesls) rum( o;u4tpe if3iydfa2rl(vp;t4 leoio io1lmDe ivolt tetoir ou1lmtnmnctlsf rtrur nu1oeenmi3iat s2emn s () lxrir3iydlmD lieo (  rxmim3iy4ome mieias  2ururooo4tpeo o3ildfs ea( snt)aexnxf oatfp rlnei s  2um(mpoy1llenmnvsas)a2um(m oo4olx  fctas a emn pnt0 ltrxo3oo1la ranvi;s0t2tmio oo4opt lfcil() Dta(ro;t1olx ifcildlm umuvpnu)teerxf oa1fmtrlueolt) rum(m3oydll   nesat s2rm(mont4oee mietasfm elums ()texnxf oa1oatrlnvo;()truriopio1optemfviltfsDrr(  ou1tpxn fetysfaDemnms;(4 ltnif iadfm  lnes s teurxmpoy1amt mnei t)aDum( oou4apx mfciysfmDrmu snu) rxomr totfm rlneilt0t2xoio iu4ap nlnvias) 2um( poo0texnifcild m2umnvo ()trermfciydomteln i ( srxoxm3iu4lmen nvi s)s2uaxmpoo1aptnifciasfmDea( o;u0arxnmo tadfptr ueo t) rumxmpio1lm   iviat sDuaxmo;t1olxnmi3ilsla eln sn()alxrif3ty1omt lnvsl()srto(rpno1lm e neias)arum(m ;u1oetnioeiadfm ranvs () exnxo ootlpD luvi;s0s2xoxopiy1amtn fctl()s2uaxroou4tetnioetydfa2uauvs;(0alxoxf3iatlat lies t t2ur(rpnudlptnmivsls s2ra(mpou1optnmfetytfa umn p (0 exrir oodlmDrlivi ()t2xmio nydomte fetltfs2rmxrpnt4tleo fciltfaDrm(vsn()tltrmr ootfa elivil()texr(o3io4ol emies (f Drmxro;u1opx mo3iydfs2uan p (4treomfcoydlpD aueo t) exr(o iudap   iei s aDrrurpno1aeenioetydlaDeau o;t4 exoxo iodlptraies;t setrim3iydam elivia(f 2tmxr ot4olen i3iyd s2ean pn(0tlenxf iydlmDe u o t) etr(rpoudap n ivta()sDur(ront0aex ifctlslm2rm(mo;u) ltoif totopD lu ol()seto(mpnu4lm  mnesat a2rau pno1alx ioeildfs2ulnmo u0trenmr3oatla  lnvi;s)sexrxm nu1lm   ncslt)arrmum no0apx  i3tlslmDemuvsnu)aexrxf todom  livs;t)setrim3oo4aptn ivtls)aDrrump;o1altoioeiydla2uluvpnt4 rtrmf to1fmD  u o;s)truoxo nydol  mfvilt)sDtaurpot1teeomfciltfaDulnmp t)tetoiocoytfaDeli i t s2xrimpny4apt  fvilt  Dtmur ou1apxo f3iat a2ulums t4 leoxr3oa1fm r nes;s) exm(rpiu1openmfvs s  2tm(root1tpxomieiys s2uau s;u) exoif io1fm e ivo;(0teuo(rpiy4lmtn fvslsf rrrx pot4apeoifeilsfm2elumo;t4teeomrcoodfmD anvo t0t2trir ou4olte nvi (fs2trxmpnu0olxo f3ilsfsDelnmp t)alxnio3tatla   ies (  rxrxm3nydlm  mnvtat sDumxmpnu0oleo fctlslm umump u)alenxoctytlpDelu i;s) 2uoxm nodomte nes t)aDtrum oo1oetoif3iys s rmu on(4tleoxr3ty1oaDean i (0srur(m3oudolt miciat a2rr( pot0olxn ieiytfaDel(mo;() eenmrciatopDrlnes s t2xrim3nu1omt  ictl(f rumumono0apx mo3tyslsDrm(ms t0texrxr oy1fpDe i o;(0teumir oudol e ictls)artrx oou1aexomfciydfm el( s (4 rxoif oydoaD  ueo;t0texo(mpoy1opeelnvtas artm( oou4olt  ieiatlm2ranmpnu0artnmf ootoptrlu s;s0 2tmxr3ou4lmt lfviltf 2uau o;o1aex  icild s2uanvs (0 exoxfcoytop  aivo (  rxoir iudomte fct (fsDuaur nt4opxomictatls rmu o ()artnif3tadlp rlnvils0 etoxo3nu4lm nlfet t artm(  ;u0aetnmfciyt m2ea(vpn() lerxo3iytlaD  ivi;t t2ur(mpou4lp   neta() Dumxmo;u1aeeoio3iytfs raump;u4 eeoxrciotomt lnes;t  rxrxopno1lpenlivsa(fsDuax onu0tet ioetldlm2emu s t0 renio3iadoat li i s  ruoxr no1ll  lnvsa( s2tmxr nt1aleo ictatfaDua( o;u0trxrmo3ia1lmt  n i;t0 2tmio3iu1lp elfetl()sDrr(m oo0tltnmoetlt aDumumonu) renif3oo1lpDrlies t0s2xrxo3no1al e nesls) Durxrpno4aet  oetatfm2um(vsnu) eerxo3ootfateli ils0trurir io1amt  fesl(f Dtr(  ;t1aex mo3tlt s eaums;t)tleoxf3tatfaD an s;t  etoxo io1ape mnct sfsrtr( o;u4olenmf3ilslsDrluvp;t) lenifctytfpD  u ols0texrxm3iydalt lnvt ()a2rru  ;u1optnioetyslsDul( p u) lxniocio1oaDeaiei;s srtrxm3iy4alt  ictat srrr( onu1tpeoii3iyt sDea(mo;(0tlerxo oy1oaDrauvo;t) ruoiopiy4op  mnctat)sDra(rpno4tpt  fciyt m uanms;(0 lerir iatla rlnvo t0s2xmxm3iy1lmen ivsasfaDrax  ;u4aptn oeiltls rmnmpnu)tlxrxf3iodlpD lueo;( teurim3io4lmt mnviatf 2tmxr nu4ope ifetltlm2uau snt0 lxnmo3oodfa ran s t srtoim3iudomtnlivtl(faDum( p;o4texnmocildls2umums u)areoio iytop   iesl()trxo(r no4olen ietat)a2umxr ;o0tltnif3iadfmDra(mo;t)aexomo ootfpt anes;()teuo(r nu4alt mfcsltf rtm(m nu0tpeoifeilslm el(vp u0texnio3ta1faDr ivslt0 2to(rpno1apen fei ()srtr(  ;o0aexomo3ildfm2eau p;(0altrxr to1op rlivols texrxr iu4aptn fet s)artaxm ;u0opt mfeiysfs umu s u4arxrxociydfaDrluvi;s t2to(m3iydam emivta(fsDtmu ont1ope  o3iasfm uanmp;()aleomociy1fp   nvo;s0t2uoio nu4oltnlfei (f Dua(ro;u4opx  oeiytfsDua( p u4 exnmf iytlatr n s;s teum(rpno1al   fetls)aruru  nu0teeomf3tytfaDrluvo;u4areoxo3oodoa   ivs;( texo(m ou4ame lici sfa2ra(mp;u1aptnifcilsfm em(ms (0texnmo3tytfaDelivi ( srtoxo oy1amt lfctas s2trx p;o4oltnmieiytfmDel( o t4altnmf iytlm rlnvol(0t2uoiopnydlmeemfetatfa2trxm ;o1tlx mociltlsDulu snu4tltrir3iytop elieo;s t2xm(mpnudamt lnes t  rta(  nt0apt  i3iyslm emuvs (4teeoxo3todoa raivs t) eto(r3oodlpeelfes (fa2rmu o;t1open ictysfs elnvsnt) renio oytoaDeanvo (  rtmirpnu1om emivs tfa2rm(m ot0tetn ieilsfa eln s u0 rxnif3tydoatr n i;s) rumxr3iodal nmies tfs2tmum no0tlxnmiciytlm rl( ont0artrifciadfmtr uvols  ruoir oo4lpe lietas artm(monu4tet moctldlm2umuvo t)arerifctytlmD aueo (0s2uo(o io4altelicsl(fartm(mpoo0texoioetldfs el( s (0alerxf3iydfp eau s t0 rtmxm ou4al e ncsas sDra( onu4olto ieiyd aDuan p (0tleomf3oy1fp rln sl()setrim3nodap emiciat  rrax onu0ale mf3iytfm2ua(von()alxrirctytom  auesl(0t2xmxr iy4am emnes t  2rrurpnu0opto f3tas sDuanmsnu) rxoxo3tytomteaivi;t) etmxo3nu4optnmnvta(  Duaxr nt4teenifetadlm rm( s u4artnxr3tatoaD auei s0trurxm iudlmtnmnct t sruau p;t4oltoio3ilt m emumsnt4artoio todfatelu il(  2toir3iu1amtemfcsl( a2tmurp;u1alxnmocilsfs2rm(ms;(0 renirciatoaDe uvol(0trxmir nydamtn neiat sDrrur nu0opeo o3tasfaDrluvo;(4aetrxf todlat  u sl( srxm(opoy1ape lnesl( aDuax poo0tet  f3tys mDemnmsn(4aexomfcia1fm r uesls) rtrio nydol elnvtls  2rmxm ot0oltomf3iasfs2uanvs;t0teeomo3oadlp r n o;s) 2xm(o3oydlpt  fvtat) 2tau ono1tpenmi3iyd s ul(vont) rtnir3oy1lateluvi s  rxmxr oudlltnlfcsa()aDrmumpno1tex mfctas m2rauvp t4tlxnmf3tydom  lnvs;( srtmxo io4lmtnmfvs t  Dur( ono1tleo i3tat sDemn s u0 etrxo todomDraneils0texr(m oodlpeemnvtat)srtmxr ;t1texoiictys aDranmonu)aetomoctydopD an ils  2umio3oydam nlnctatf 2trum oo4apx micilt a2rlu pnu0 rtnxfctadfp  luei t0teuriopiudapeelictlt) Dtm(mo;u1aeeoiieiadls umu p;() eenmrcoatlaD lnes;t0t2trxrpoydlleemictltfsDumuro;u0tlx iociatlmDraumpnu0 lxrmr io1lmtelu s s  etmirpny4lp   feias) Duau  nu0optomfcildlm ea( s;(4aexrif tadla  li sls)trxoir nudlp nlfetasfsDur(m ;u1oetnif3ilsfsDeauvo;t4altnir3iy1om e ivo;(0 2xmimpnudop elnctl()sruaxrpno1apxnmieilsfs uanvonu)aexrmr3tydoptrai il()seumim oy4ap n ics s)srtax  ;t0tlx iictydlaDuanmo t0trxrxfctydom rlues;()srtmxm3ny1llee fci t) 2tmu  ot0oexoiociasla2raums;() eenxf3to1fmt livo t0tetmxr oudop nlfcsasf 2tr(mp;t4aetoif3iysfs eluvp t4tlxomociatfm eaieo ( tetmxo no1omen ivi tf rtaxront1apx mi3iydla2rmnmonu)alenio3iydoaDelieils0teurxrpny1op  mivil(farua(rpoo1apenmociadfa ranvp;(4 lxrmf oatfa eau ol(0 2to(r3oo4alt mieia()a2tau oot0tpxnif3ilslsDuln p u)arenxo to1fp eluvs s) exr(r3nu4omte ieias)aDrmx oot0aetnmi3iadfsDrmnmont4altrir3to1fa  lneil() etrim3ny4lmt lfeil(  rrrxrpno0tlxnmfciysla2um(vsnt0 etrir ia1fpDr ivolt0tetrxm3oo4al nlfei s srtaump;t0aetomictad m uln pn(4tleoio3totlmDraneo;s) 2xmxo iu4ap   ivs ()aDtrumpnt4teenmoeiyt m2elumon(4trxnir3tadfaDraneo s  2urir nudap   fctas a2uauro;t4aptoiociyt s ra(vs t) etomr ty1omt lu sl( trxoimpoy4lmtnlfeils  rrmu  ot1oltomietat m2ea( s;() lxrmf3tadlmt livsl( s2xmio nudolt lnct s a2trurpnt4alx ifcild m2umn s;t)trtnmo3iytla r ies s0s2xoxr3no1ale lfeil()sDrru p;o1tlenioeiltlm2el(vonu0trxnio3tadlm ranvsls0t2to(rpoodap   fci t)srrr(m ;u1apxnifciytla elnms;(0tlxoxfctadlaDeanei () rxoxm3nodamtemivsat) rtrx pou1altoif3iyslm rauvonu0 exrif3oodlatrlueslt teto(m iu1ame  fviatfs2rmxr ;o0oltnmf3iys a rmu s;(4trtnxfciatlmtran i t0trxm(rpiodalt  icslt)a2umum ;u0alenmiciatls uauvs u0artrir3tatlpDeln o;s0teumirpou4lm emictlt a2uaumpnt1ale  ictytlm eluvon()tltnmf3iy1fptrau s s) exrir3nydlpt  fcil() rtru poo4tex iiciydlm2uan p;(0trenmrcootlat lnvs;s) 2xrio3nu4ame  ncs ()aDtmu poo1ope miciyd sDean o t0tlerir3io1oaDr ivs;t  exrim3iy1lm   iviatf 2uaxmpnt4aex miciytfmDul(vo u)altnmo iadomtr ieo;s  euoxm iu1omt livtlt) rtr(mooo0olen ocildla2ul(vo;()treomoctatfpDeaneo;t0srxoirpio1ole  fetl(faruaumpnt1ale ifetas m ean p;(4artrmf todlpDeauei;t)t2xo(mpoodam   feil(  rua(moou4altomoeiad s ulnmp (4altoio3ia1la  ln sls teuoxmpnu4lmtnlfctat) 2rmu p;o0aet ioeildlmDeln pnu) ltnio3oadlmtraiesl( teuriopno1aptelfesa() rrm( pnu1tlt  f3tldfs ea( pnu) rtomr tadlpDraivs t  etoio oo4apt mnctl(fsrtmu  nt1teenmieilsfs2rm(von()aexnmr iotlp rluvo (0tetm(mpio4am  mivtls  2rrx ono1ole io3iydla2eanvo;t)tlenxf iotop rln s;s seto(o nydoltelfcsatfsDrmxront1aptn iciltfs ua( p;t4 rxoxf3oydlp r uvi;(0truoxr iy4lm   ici s s2ra(m ot0tet ifeiat aDrmuvp;()arenxoctatlptraueils t2tmxo3iy1op   nvsa()sDuauronu1aex if3ilsfmDrau sn() leomrciytlpDrlu o;s0texo(m iydll nliciat artrx pot0altn fetydlaDeln s u4alxoxo todlptrli s;t)teuoxmpoy4al nmivtatf 2ta(mpot0olenmf3iys a um( o ()aetniociadoa  aues ()trtr(mpoodamtnmicils) Duru o;u0tpe mi3iytfm2ea( s;() ltnmociadfm   u i;(0srxmxm io1ap   fei s aDrmumo;o4tpen oetys m2emnmp t4aetoir oo1lm eluvs s)srum(r iy1om nmict () Dtmu  ;t0olx ii3iltla2umnvont0aetrxo3iotopDrlies s0sexmxo3ny1ale  net t sDra( o;u0aexn i3iasls2uauvp;u0 etnxrcio1fa  lnei ( srtoxm3oy4apeelfvt sf 2uax p;u1aet io3iyt sDrm(mpn(0teerxo ootlmDe ieols0 ruoimpoo4ope mnvils srum(rooo4optn o3ils a2eaums;t0aetnmf oydfpt  nvolt)texoir3ny1ap  lnct t)aruaxrp;u4altnif3tldla2um(vp t0aetomr3iy1fpteauei;(  rxm(m iudlmtnmnes () rurx pno1olx ii3iat s2ranmpnt0alxnmr totfpDrln olt0 exm(m3no4amtemnvt s  Durxro;t4oexo i3iadfs2ulu pn()teenmf tatla   ivols) rumxr3iydome  nciltf Dua(moou1oleo ieilsfaDemn pnu)texrxf3iotoptr nes;s0sexmxo3oudamtnlfci tf rtmu ont0tpxoio3ild a ean o;u0artoxf3tadla eaiei s)seuoir3io4ap emiciatfsrua(mpnu0oex  fctasfaDumu snt)aexnxfctytoaD lnvols0seur(r iudoptelfeiat)srtmxmp;o1ope ioetad mDum(mp;t)trxoioctydfa  au ol()tetr(mpoodopte feiatfa2taur ou4opxo o3tys s2rm(ms;u)trxrxf3iodfa elu o s truo(o3oudomenlnvtlsfsDtr(mont4aetnif3iadla uluvs t4trtrmocoatfmD aivsls0s2trirpiudale  nvsl(f rtaump;u0tptnmf3ildlm2rl( p t) exoxr3iadom elnvi ( seum(m oodamenliei t) Dumxrooo1aleo i3iydlm2ulu p ()arenxrcoatoaD lu s;s0sexo(rpnu1amenlnvi sfs2rm(mpot0oltnii3iyd sDelnvp;u)aetrio3ia1faDeauei;t0srxrxmpoo1ll  mnctl(f 2ua( ont0opeoioeiytfmDra(mon(0alenxf oatfmD  i olt0 exoxr oydlle mivil() 2rmxm no4oleoif3tydfm ulu on() leoif tytoateli o s0setoxm iu4lltnliesat) 2urump;o0tptnii3ilt m2ulnmon(4aeenxf3oytla e u o;s)texrirpno4lpeelfcsl(fs2taxm ;u4aet iieiad sDrlnvs ()altoircoo1fm r nvo ()s2trir iydaptemfciat)arururono1opto ocild s2el(mpnt)aeeoxrcoadopD aivi;s)t2trxrpnodopt  nci (f 2ururono1aet mictad a rmums;t4tlxnxociydla rlu olt sexoir nu1apeemiet t)s2ra( poo4apx miciltla2elu s () exrif todfpD  nvo;()s2uoxr iydll nlncil( a2uaxroou4tet  fcild sDrluvs;(4alenio io1omtr nvs;t t2xoxmpiodamtelict t) 2uaxm ot0apx  feiyd mDrmu s t4teenxf3io1om rai o;s  2tr(o3oodlm n ieil()srtmxm ;u1ale io3iasfa2elnmont)alxnmrcia1fm  anei (  etr(m3iu1apeemncsat) 2tm(ro;u4olxoioeiat m2ulumo t0altnxf oatopDrluei;s0t2xrio3oo4ap eliei s) Drax p;o1olenmociytlmDean s;u)aexrxfcia1fatelnvi;s0srtmio3iu4apenlivs ( srururp;u4teeoioeiadfs rau o t)trxrxo3oo1oa  anes t)texmir3oo4lm nmfvslsf 2uaxm ou0oexn o3iytlmDumums u) ltomrcoy1lmD  uvi s0s2toxo3iodll n ivi t  rra(mpou4oetoifciad m ra(vo (4 lxoif3iatom  ai s s)t2ur(mpiydlm e ivs t s2rmuro;t4alxo i3ilsfs2rm(vs t)aexnxr3iy1oatelu olt0trxmxr ou4apeelietls srrrx onu4apt  iciatlm2rmnvs;u4teenxo io1om eluvo s0truoxmpoodlptnlfcta(fsruaxm nu1aetnifetlsfaDrmnvp t0 leomo iytfm eaivi t  eurio oydlptelfvsa(fsrurxrpou1ole mo3tyt s2el(vpnt)treoiocty1fa eauvslt)trtoxrpiudape mfci s s2rmurp;t4opeo i3tadfa elnvo u4alenmfciatfmtr n ils0s2uoio iu1apt mfeilt sDuaur ;t1tpeomiciasfa2ran pnt)tlenxocta1lat anvi t)setr(o iydopt mfeiatfs2um(rono0aee mociad a2uauvo ()tlxrio3ia1oatrlneo;()teuoxo nu1ole livi s  2trxm nt0teen i3tyd sDulnvs;u0artrxrctotfmtranes ()t2tmxrpoydomt  fvtlt) ruaxro;o4texn fciyslaDrm(mp;u)aeeniocoydlaDr ues t)t2to(r oo4openlnetls)srtrx ooo4teeo o3tydfa2rmump;t4teeoio tytfaDeaneilt0sruoim io4lle liesat sDuaum ;t4aeto i3iaslmDrluvs;u4 etoxf oadlm raivs;s)t2uoxopnydamt  ictltfsDtaxro;u1aex iiciltfs eanms t0 rtoio3iydlpDeaieolt0seumio3iydlmt mictl() Dtmxmpnt0opt  o3tltla ul(mpn(0tlxoif oy1lp rli o;s)tetmxm3ou1ll nmfcsas  2tru  nu4aet  o3iytla2uaumpn()altrio3ootom elnvi;(  eurimpoy1amtemicslt)arumu  ;u1aet ifeiltfm rau p t)artnmo3oo1lateaueol(0s2urxo nu1ope lnvsat artrxro;u0aleomfeilslaDem(vonu0alxnxf oytlat ln ils0 2urir3no1alen fcs s aDuaumpnu4aee  iciaslmDemu pnt)trtomfctatoptelies;(0t2xo(m3nu4llee fct t)s2rr( pnt0tlenifciyt aDeln sn()treoif3tatoa e i s;s0 rtr(m nu1omeelfesa()artm(  oo1tpxoioeilt m2ean o u4altoxocoo1fm rlues;s)trum(r iu1ape mfvtltfa2uru ont4ape moctydfm eauvs t0texnio3iadomt  uvslt t2xmxm oo1lleelict sfs2rrxront4tpeomociadlaDraumo u) eerxfcoydoate ivil() 2toiopou1alenmivs tfa2umu oou4oee ifeilslaDrlu snt0tltrmr3iotfaDeaneil(  2toirpno1oleelieilt s2ua(m nu1altn f3ils m rmuvo;()arenmf3oadlpte n slt  2urimpnodaltnlnvil(  Drru ooo0tltnmf3tld a rluvo;(4 rtnmo oadla  aivils setrim3oy1llenlict sfa2uax o;u4tpto f3ildla2emnvp (0texomrcoatlate ieo;t sex
\ No newline at end of file
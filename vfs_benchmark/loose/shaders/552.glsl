@@ -0,0 +1 @@
+ivi;(0t2xrxm3nodome  neiltfa2umxmpno4tpeo i3iatlsDrmumpnu0tleoircto1fpDean o t)seuo(m3nydom elnes t)sDta(roou1apx mociyd sDeanvs;u) leoirciydlp  aivi (0s2umxr oydllenmieias)aDrrxrp;u4ole iieiytlm2ra(vo t) lenircoa1opDeluvi s0setoir3iu4ole  nvt s  2tmuront4aptnmi3ils mDeluvs;u0arenmf io1fa raiei (  exr(m io1alenmnei t  2tm(  nu4optnii3iyslaDranvo t4 rtoif ootfm  luei s  exrir iy1alee ietlt) Durxmpnt0tlxomictasfmDulumsn(4teerif3oo1lmt au sls0tetr(opnydolt mnvtl(  rra(rpnu1tpx moeilslsDua(ms (0 eenmo iy1lp  lu ils0 2trxr io1lm  lnct t)sDtrum ot4optnmoctltlaDrmums (0texoircootlpD  ieolt0 exmxopoydlpenmivsa( a2taxm ;t4tpt mi3tas s rmnms t)arerif3iy1omtrln s t)seto(m no4op e ncil()srtmu pou1oex ifeildfmDelumo (0alenmr iydoaDr uvi ()truoxrpoy1ale mfctltfsruru p;u4tpen i3iydfaDulnmo t)arxoxf oo1oaD anvi s0trto(o3oudlme lfcias aDrau pnu1olxnmoetat s rlnvs (4tlxomf3oodlm eanvi;()s2toiopnu1olenlivtasfa2rrxmpot0tleomoetlsfmDra( pnu0 ltrxocoadoaD aivo;t trumxr3iydamenmnvt t  2rm(mpno1opto feiltla2rm(vo t0teerif tatfatelnvolt sexr(r3oodoptnlivsasf 2trumpou0apenmfeiydlm2ulnms (4tltnxo3iadlmtrln olt  rxoim ou1optemicsatfs2ra(moou1ape  i3iytfa rmnmp;u4trenifctotfate u sl( s2trxr io1al elietl( sDraxm no0opxnmictlsfa rlu o u0alxomf3oo1fatelnvs;(0sruoio3ou1lltnmfvi ()aDua(m oo0apenmieiys aDeluvo u0teeoifcoa1latrlu i ()s2uoimpoo4llee ncsl()s2ua(mpoo4tle iocildfaDelums u) exrmf ootla r neo;t)srxm(rpno1ll  mict t)aDrr(rpou4altnifetasla2ea(mont0alxrxr oo1op r u s ( t2xr(r3oo4ap  mnvt (fartaum ;t4tpenmieiadlsDean p;u) etnmrcty1fm rlies;(0s2ur(o no1llen fcilt s2uau o;o0tlt mo3ildla rlums;(0trtnmociydfpDr nes ()srtrxo3oo4ap emivs t)s2taxmp;t4openmo3ilsfaDuanms;u0 exoxo3ootlmt  nvi s  eumxr3iu1lmtnmfvias srrmx pno4ape  ietydlsDea( o (0altnmocoy1fp ean s;s trtr(r3iudapen fci t  Dtmxm oo4olt moetldlmDea( s;u4trenmrcoy1oa rlieol()texmxopoo4lmt liesat  Dtmx pot1tlx ioctas m2rmnvs u0trtrxr iy1fmteluei ()teuo(r3iu4lpe mnviatf Draur no1aee mocild s emnms (4areomfctotlateluvi;s0seuoim oudapee iesat arurumpot1aex micils s2ul( o;t)tetrmrcoytoatranei ()srtoxmpoy4lp   fvils  2rmu ono0tpx ifcias s2elums;t4 eeoio ty1fpDraivil(0s2trxmpiy1ome lfvtls  rtr(  nt4alxo fciasla umnvo t4 eenmfctodoaD li ols0 rxr(mpnudll nmfvsls srra(m ;u4teen octlslmDean s;u) lenxr3tydfatrauvols0 rurir3oudaltnlfctl()arrm(rpoo0tpxnifetltls2rl(vo;u0 rtrxr3oytfm rlivi () rtoirpnydape mnvt t)sDurxm ;t4oeeniiciyt m2eanmsnu0trxrmf3iadfat anvolt  etoxopnu1optnmies s srra( pot4oetnmf3tyt a2ua(mo;()aeenmfcoytfp r n o t)trumim nu4amtnlncsa( aDumx pnu1oexn ociltfs2ulnmont4teeoio3iotfpDrln o;t) 2tm(r3ou4lmeemnvi (fsrta(rpot0tltn ociysfs rmnvpnt0trxrmocoatoptrlneslt0 eum(rpnudomte ivilsfa2um( pnt4tpeo feiadfaDrlumpnt) rxoir ootfa  auei;t  ruo(o3oo1om nlnctasfaDurxmonu1tet  i3iytfa uan pnt0altrxoctatfatr i o t)srumio nodop  mfetatf rtrx  ;t4tpeoio3iydla ulu onu) rxnxfcty1opt luesls0truoxrpiu4lmtnlneils)aDtmumpno1oee iiciltfs2rmnvpnt4 lxomf3todomD  u i (0 rtm(m3ny4lmtemfvt tfsrtaxro;o0aetoii3iytlsDea(ms;u0alxoir ia1la  lu ols)trxrir3iu4omt mnetatfsrrmxr ou4opx mietld m elums u4 lxomf oatomte nvilt) ruoxmpnudaltn nciasf rrm(m nu1teeoio3iasfsDuanms t0altoxr oadomtr uei;()trxo(rpoo1lmtn ietltfarraumoot1tpxnifeiydfa2eanmp (4 rtnxfciatomD  nei (0tetm(mpoy4lm  lnvias)sDtaxrpot0aexomfctaslaDelu p u0aetrif3oytlp e iei s)s2trim oudlme lfci () Dtm(m ou0ape moeiasfa emuvo;u4 eerif3tadfp rai s;( trxr(o3ou1ll e fvia(  Duaxr ;t0oet ifeiltfa2uaump;() reoif3tatoatr nvo t)tetm(m nodom e ivt sf Durxm ot1ole  octysls ranvs t4 rxomf3ia1omD ln o s0t2trimpnudlme  nvsa(  2rm(mp;u4texnmfeiyt mDea(mp;u4alerxo tadlmtranvsls  exmxm iudoptnliesl(  Dtrx o;o0tlxn fctytlaDrm( pnu0 ltoifcoo1oa e ieol(0 euriopio4amen ivi tfsrtmuro;u0aptn ictld a ra( o;u4tetrxr3oa1oa  luei;()t2ur(o3oy1lltnlncilt) 2umu pot0tee ifeilsfs eluvpnt)tleoxfcoo1om e n ilt)seuoxmpnu1lmtn nci t s2taur ;u1ole ii3iys mDeau s ()tlenio ootfa eanei s0s2xoir3ny4lltnmnvt s sDtrurpot4tptoii3iytfm2um( pnu) lermrcio1faD an i;() rtr(opoy4apeelnctlsfarur(r nu0oexniietldla2ulu s;(4aleomo oo1lmD lu i t0s2uoxm3nudopte nvtlsf 2rmxm nu0ope ii3tlt mDrau s;(0arxnmo io1op elnvols)teumxo3iu1llt miei sfartmuront1oexo ociytls ulu pnu0aexrirciatfaD aueil() 2xoxm3iu4lpenlicilt)arraumpou0alenifeils mDran ont0 ltrmfciadla   ueilt0 2uo(opnu1llt  ictltfs2rrxrp;u4alt if3iat s umumon(0tltnmr to1oaDe n i;s texmir ou4op emfvta(  Duax oot1apt ii3ilt s uaumonu) rtoxrctytfm eai ils)trumio iy1oltnlfctasfaDumumo;o4olt  octld aDua(mo u0arxrxf3tatfmteluesl( t2xo(opnu1ame mivilsf rtr(ro;t0open fciydla2uan o;(0tetnmf iy1oaDeanvols)trtrxo3iu1ol   ncil( srtr(r nt4olx iictysla rau pnu4alxnxfciy1fa ranvilt)t2tm(r io4opte fvtls) rtmx oou4olxomf3tadfmDra(ms;t0areoxocoydlptelueslt) exrimpoy1altnlnviat arta(mono4altomicild s2emnmo u4 exomf oytfat luvs;(0 eurir3iy4ameemicilt) Duaumpoo4oltoifeiadls elnmpn(0tetrmrcia1fa  auei ()t2umir3ou1ole  fctas)s2ururpno1opxn i3iltla2um( s;t0alxrmr3tadfat lueo t)teurxr oudap   ies tf Dum(moou1tle ifeiatlm2em(ms ()trxoir totfa  anes;()seur(mpoy4alt mnesl()s2taxr nt0open fctysfm el(mon(0 lerxf3oatlmte neil(0texr(mpnu1lm  mnesatfa2tru pou0tlt iieiysls emu pnt4 etoxr3todoa  li i (0texrxm oudlmee fct t) rtmur no4tpxomfctadfs umnmsn(0arxnif3todoa rluvi;t  2xr(r nudalee ivi sfaDtr( oou4tlxnmoctltls rmuvo;u)texnmf3iodlaDrli s;()srtm(rpny1ap elicias sDuaurpnt0tet moeiasfs2ulnmp t)trxnirctadop  anvsl( s2ur(rpio4lmtn fetasf ruaxr no1aleoifetysls rln p;u)aexrmo ta1laDe nvi;()s2xm(opnudopee icilsfaDumxmooo0tptomoetadfmDum( o t) ltoxo3ia1lpt  ivilt s2tmxrpoudame  fet t)sruax p;t4tlt ifeiys s2rau o;t0teeomo oytlateau o (0texr(o nudlm elnvs ()arraxr oo4apt  o3tad mDem(vsnu)areoir3totfpD  u i s)srtm(opiudoltnlivs s)aDuax pnt4tex mo3tldla rln o;(0 exomocoydom  lieo;( s2xoio3oy4om nmnvilt)a2truront1optomoctyt m emums (0aexnxrciy1opD  nvs;t t2umxr ny4op  mics tf Draxroot1apx  ociys a rmu o t4trxomf ia1laDean i;(  ruoxm nu1lmen fctas)arurxm ;t0ale mieiasfm emnmp u4alenio3iy1lmDe i il(  rum(m nydlp n ivtlsfsrta(ro;o0tpt ii3tadfmDum(vp t)aexnio3tytlpDe uvs (  exr(o oudlmtelict (f Dtm(mo;t4openiociadfaDeluvon() rtnioctytfpDrai s;() rtrxo ny1lmen nctlt a2tmurpno4apenii3tytfaDra( o t4 ltrmo ty1oaD lnvo ()s2xrxopiudamtnlfvsa(f 2trurpou1ape  ictld mDuluvp (4 lerxoctodlpDeau olt  rtoio3nydop elivsa(fs2rr(m nu1apen ictatls2el( o;u0 eerio todfm  lnvi () 2umirpnodol  mivtl()aDua(root4tpxniieilsla uanmonu0 ltoif3iydom rlu ols  2xm(opoy4ll n fvi (  Dtm( pou0oeeoio3iysla rmumsn(4artrmr3iotla   nvs;s t2xrxm ny4apee ictas arta(  nu1olxoif3tysla2eanvpnu4alxoxfctadlp e n s;()srto(o3oudlpt mfvtatfs2uau  ;u4aleniictadlsDum(mpnu)texoio3oa1oat aiei s0trurio ou1optnlict sfa2tm( oot4tlenmfeiytfs2uln o ()altnir3oo1fmDrau o;( texrxrpnu4ll emivil()s2uax  ot4tpeoioetys m2ra( s (0trerif3oa1fmD aueols) eto(m3ou4altnlfesas srumumpou1texnioetatfsDul(vo;u0alxnxocoydfp e neo;s0trxrxm no1al nlieiat) rurumo;u0tpt mfeiydlm2rmu s;t)alxoxr oodfa r ueo ()sexoirpio4olt mfviat) Drmu ont0altniieiadlm2rmnvpnu) ltnmo iodoate ueo;t t2xrio ou1am  lneils)aDuax  ;o1tlxnmieiydfaDumnvsnt4altnmr io1lmDeaivs;s s2umxo3iudlle mnvs t)sDuau  ou4openmfetldfs eln o (4tetnmrcoodlpt lues;t0srxrim3iy4oltelieils sDurxmo;t0tltn fcias m ra( s u) rxrxf3to1fa r n i;( trurir iy4amenlivslsfsrrru  oo1teeo f3iadfm2ulumonu0trxnmociodomt au o (0setmxr3ny1lmeemivsasfs2umum ou1apx ioctas mDemn p t4arxoir ty1lmte nvo ( sruoimpoo4al  livsl()artrxr ot1apx ifetas sDuaump;u) reoif iatla eaiesl(0srxoio3oodom nlnci ()arumxmpnt4olt  fcilsfsDrlnvpnu0altrxo3iadlaD an s s) ruo(rpiy1omen fviltfa2ururp;o1ope  oeiysfs2ran s;u)alerircio1laD  ieo ()srtrimpou1ol nmfetas aDtrxmooo1olx iociyd a ea(msn(0aexoxr3oydfmtr nvo;t) rxmio no4ale lici ( s2trxr ou1oeeoio3iadlaDemuvp;t)texrxo oydoaDrauei;(0 euoxm io1om nmfes t)sDra(m ou4aleomiciad mDraump t4trtnxf tatopteaneo;t0srtmxm oo1al n fci t)srrmur ou0tex iicilsfmDelnmo;u0aexnxr iadfmDeaivo;s0s2xrio io4am n net sf Drmxro;o1oex  fctad m2elnvo;() etnxociatfmDelnvsl( truoim3nydoltn netls aDrmxmoot0tee  f3iatls2ra(vsnu0 reomr oadfmDr ueols  2tr(mpiu1lltemfvi s)aDum(rpot0oexnio3iysfs uln p;t4tlxomf3oytlmteaivils t2xr(mpno4alee fesa(  Drr(rono1opxo fciydls2eln p;t0 lxnmr todlp rau s (  rtrim3iodamen iet (fartr(r ;o0olx mf3iltlmDrmu o t4 reoir3tadlpD  ueo;(0teurxo oo4apen fvtas)arumxr nt4texomf3tldlaDuan pn(4texoxr ty1lmt luvo;t seurim3oudll nmnet ()sDtaurpou0alt moctadls2uaumo;t4aeenxf3iadomtelivi;t)s2toxo iydlltelfes t)a2urxr ;u0ale mf3iyd m2um( on(0aeeomf iodom raneo t) rtmxo3iu1ale mictl( srtm(ro;u1oetn i3iydla2eanmo;t0aexrmrciytfp eli o s) rxrxm3ny4lltelfet (faDrrxmont0tltomf3tadla2rm(mon(0 exnxr3ty1lp e ieo;s) 2xmirpnu1am n nvt sfs2umxmo;u0oeeo ictat m uln pn()tlerio iy1omtelivi s0trumio3iudopeelnvslsfsDumx  nt0tlxo i3iydfsDranvs;t)aetrir todoatelueil(0s2umxr io4omenmnvtasfa2umu  nt0opt iiciadfa2em(von() rxomfcoa1laDelneo s)t2umir no4op n iesl(fa2ua(  ;o0apx  f3ild s2umums;u0 leomrcoytfpt anes;(0setoxmpio4open fci ()s2urur no0tetniietydls2uanvsnt)artrir3iatlptr ieils0texo(r3io1ame mfesas) rurxr no1aeeoiociys s uauvont0 lenifctodfm eai il() 2tr(m iudlltemneias sDua(mont1oexoiietyd sDeln pnu0aetomr3iy1faD lieslt s2xoxopiydlpt lnvs s sDtmx  ;u0oexnmo3iaslm umn o ()arxnxfcoytfa raieo;( t2tmim iy1lmt  nct ( sDrm(mpot4tpt  icils m eaump;(0 rtrxf3tadopD ai i;t  2tmim oodlptnmneta(fsDrrxm no0ope iociysls umu p ()tetrmo oydlpte i i;(0s2xrxr3oydap   fctatfaDua( o;u0tpxomieiadfa um(ms ()trxrmo oodfmtr ivi (  2uoxm3oudomtelfei tfsDtmurp;u4texo o3tyd a2rluvonu)aeerio tydlat  u i;()sexrio3nodole liesasfaDta(ronu1tlxoiieilsfm ea(vs;u4aeeoir3oadfmtr nvsls)teumirpoy4optemfvslt sDrmxro;u0olxnio3iatlaDulnvp;(4trermo3tydfmDrlnes t)srxmxr3iy1llt liei s  rrmx ono4opt mictas m2ranmpnu4trerifcoatfa  ai o ()srxm(mpno1ap  mfeslsfarurxr no4olt ifciasfs2eanvo;t4aleomo oy1op e nvilt)tetm(opoo1ap e ncia(  rtm(ro;o1tetomfciysfm ra(vpnt) rerxo oatom e uvil( s2xoxopou4ome  ivt t aDumumpnu4aetoiictad s2ua(mo;u4aetoif iydlmD ln s;s0texrir3ny1om elieiasf Dtrx pno1tptnmfctyt s2uaumpnu4 ltnircto1fa e n o;()s2uoxr oudlm elnvsas srraxmpnu0tptnmfcild m rm(vsnu)treoxr io1omDe n s t0 2xrio3iu1llt lnvtatfa2raxm oo1ope  fetltfmDua( s u4 ltrmr3iy1om rau il()trurirpio1ol emfetas) Dum(  ;u4oexn o3iyd aDuln s t4arxrxr oadopD  ieo s)tetm(r oy1ll elnetl(fa2um(rono4tleoiiciytlmDrm( p ()alermrctotlm ean ils0 eumirpiu4omt miesa( a2umurpnt1tltn ieiydls2ranms u)teermrctadom  ai ols0teum(r no4omtelnciasfa2tmxroot0aleniieiltls em(ms t4trxnxrciodoaD au o t  exoirpno4ape mnctasfarumxroot0opxnmi3iyt aDelnms;t0arxrmociadoptrlivi;t setoirpiy4omee fvslsf 2rr(mpno4tee iieiytlm emnvonu)aeenmfcoo1lp ranes;s0trxoir3iydopeelici s  2umxr ;t4opeoif3iyd aDemuvpnt0 rtomr io1faDe iesl( setr(mpiy4lpenlfeta(faDrr(mo;t0opxn oeiysfm2eluvp;()tlenxf ta1faD lnei (0 2uoir oodlpenmnvsl(  2umx ooo0olenmo3iysfa2ra(vp ()artrxr3ia1faDe u i;t0truo(opnu1optn fcias  2ua(rono0apeo i3iydfs el( o;u4treomfciydoa e u o (0 2xmxo3nu4olt liviat sDurxm ;u1alx mi3iltla2raump;u0areoxf3iodfp rlu o (0seurio ny4aleelnet (faruaxmpoo4oexomo3tlsfsDeluvpnu)tltnmf iatomtr ieilt0srxrxo3nodop emnet t a2rmurono1tpen ictltla2elu pnu) ltoir oadlpDr uvi s  rxr(opny1lle mnct ()a2ta( pou1ale  o3iltlsDrmums u)texrmr3iatlm   uvols)t2xo(r ny1op elnetl() 2rau  ;u4tpxomoeilt aDua(mp ()tetoif oydfp   ivsls trtmiopny4oltemfcsas)artrumo;t4oeenmi3iasfm ulnmpnu4 reoxrctatoptranvs;()sexmxm3oodll nlfvslsfartrurooo0oeenmo3iyd mDulnmonu4areoxo tytopDrln i t0sexr(opoy4lpe  ncils)sDur(m oo4apx  oetasfs umnvon()tetrxo3iydlmtrlieo s0trumirpno1lmenmicsls srumu oou4oeeo feildlaDulums t0tltoxo tytopDr n ilt)truoio3iodaptelneslt  Durumpoo4tpen feils s ua(vo;u)aetrmr3ia1fmD aneols0 2xmimpny1openlivi s)artru  no4alt iociatfa2rmn on()trtnmfcoy1omDeauvo;t t2uoirpny4aleemfcil()artm(m ot0alen o3tysfa2rmnmo;u)tlxnmrcoytlptelieol(  rtr(rpoy1op  mivia(fs2tm(ronu0ale  ictas s rmu p (4 lxrxo3tatomDraneo s) eurxo3iy1op nmnetl() rua(roou4tleo oetadlaDulu pn(0tltoxo iotoa   uvi s)tetrimpiodlm elnet sfsDum(m ;u4aet moeiyd m2emu s;u4tlxnmrcia1lmt anei;s0srxrxm oydal e fcta() Dtm(m nt0apeo f3tys m ra( o;u0tlxrifctytfp elnes;()s2tmxr3io4llenlncs sfaDrrxrooo4aee iociytlmDelnmp;u)tlxrirctodfpte u s;s0sexoxrpno1opte ncils) rraur ;u0tlx mfeiadlaDumumsnu0arxnxr oa1lp rlivilt0 2uoiopio1oltn ivilsf Drr(mpot0tpen i3iyd a2eluvo t)alxomocoodlmt  neils  eumir iu1amt lics t) Drmur ;u1tee  i3ias s ua( p;u0 rxoxfciatla rauvi ()s2urxo ou4omtelfes s)s2tr(r ot4alt ifetlsfm2ra( pn()aleoxoctotomtrlies;(0 rxoiopou1opee fvi t) 2umxm no1opeoifctatfaDrl(msn() lxomf oa1omtr ieils) 2um(rpnydll nmfctat aDurxrpoo1olen oetysfa eauvo u0arerio iy1oaD li sls)t2tmimpnydopt lfvsa(f 2ur(r nu4open oeiat sDemump;t4 etoxo3oo1laDrau olt s2uoio iu1ol emfvtlsfaDrrxmo;t1alt  i3ildla2ua(vo;(4aeenxocoy1fp   nvi;s0 rto(rpoo1lle  ieta(f Dra( p;u0tleoiiciys s uau pnu)tetnxr tytop r iesl(0 etmxrpiu1amtnmfct ( arum(  oo1tltnio3tatlm2em(vp;t) exrxf iytoa e u i s)sexmxo no4lpeemivt s aDrau  no1tpenmf3tysla2rm(mp;u4 renxf ootopDeaies;s)t2uoxo3oo4olte ncsas a2ra( p;t4tltn oeiltlm ul(mon(4 ltnmrciytopte iei (0t2xmxm3oydaltn neils aDta(rpnt1aetomfetyslaDem( s u0aetomrctodlm elu s;s trxr(m3ou4opee nesl(fartrxro;u0tpeoifeils m2rmuvs;t0 etnxo3oy1oaD ln o s0 2xr(m io1ape mivia(fsrtrump;o1optnmo3tysla rmnmpnt)trtrif3oodfate i i s0t2umio nydop elivs s sDum( pnt0oexn f3iatla emu p t4 eermr3oadlm  aivils) 2xm(mpoodlp n nei sfsrtmxrooo1opxo fciad m ul(mo;(4aleoxocoadlm  an o ( t2toxr no4oltnlfei () Dtrum ;o1tpx mietys s elumo;t4trtnirciatfaDe ivilt)trtoxm3io4lleemnvi ()s2tr(mp;t1optoifetysfs2emuvpnu4trenxo3iodomteli o;s trtmxm oo4omeelivsa( aDrmxm ;t4tpxn o3tasfmDra(vp;t)tltrmo3ootlp  li ol(0 rxrirpny1omte fcias sDumu poo1aexnmoeiytla2emuvp;(4teerio iatfpteaivo;t)trtrim3oudalen icilt srua(rpoo0olt if3iydfs rln pnt)aexrxrcoodlmDe i o t)s2xmxr ou4lle miet ()arurx o;u1oexniiciysfm elnmsnu0arxoxr ta1op e u s ()t2trxr oudom n fvtl(f 2rm( o;t4alxo o3tat s emuvo u4artoiocoo1la eliei s0setrxo ny1al e nvt ()a2rmxr ;o4teeoio3tlt s ea(vo;(4aetnxr3ta1fm   nei (0 2um(o3oy1lmt mnvs s arrr(r ;u0aeeoif3iydfs2raumpnt)tleomrcootlm  aueo;s s2xr(r oydamte nvsa(fsruau  no1oltoio3tysfa eanms (0texnmf3oydlpteaieolt  rto(mpoudal   ieiat) 2rmxmp;u1tlt mf3iydfaDeanvp;()texoiocoa1fp e u i;t s2urxm3ou4opt mfctl()s2rm( o;t4tlenmieildla2em(vs ()treoxf iy1lpte nei;t)trxm(o3iu1lltnlietls)artrum ot0tlx mieilt a emnms;u0aeermf oa1om elneilt  exoir oydlpe lfet tfarrr( pot0tlx mfciad mDem( p t0tetnirciydlmtraiei ( tetmim3iu1om eliei tfa2trx  nu4tee  fetlslsDul(vo;(4trtrir3ootfpD  ueils0t2xrirpoy1ap e nvsl(f rtm(r nu4oee  iciydla2uau s;t)trxnmfcta1lmt aneo t0trtmxrpnydole  fctl(  rtmu oot4olenioeilslaDua( o;u)tlermf iodoate nvs;t) euoxo3oydoptemfcias arurumpou4alx if3iyslm um(vs t4arxoif tytomD  nes s sexoir3no1ale  neiltfaDuaur ou0tetomoctat m rlnms u)arxomrctatfa ran sls)t2xoim io4lpeemicsltfarurx p;o1apxn ieiydlm um(vo;(0arerircootopDr nvsls) rxrxo3ou1ame lnvsl(fsrtm(  nt1oexoifciytfa elu p;t0artrirctatopt  ueil( seuoir3ny1opeemnci s arrmumoot0texn ietatlsDea(ms u4altnxf3oytlatraues;(0s2tr(mpou4ll  livi ( srrmxm ot0aee mietyd s2umnms;() eerxf iydomDeli o t srtm(rpnu4ameelnct s)aDrmx  ;t0ole ioetlsfs2uaumo;u0arxnxr3oytlpDeluei;t0trurim3iy4lm nmivia(f rtrurpnu1tlt ii3tytla rm(mp;u4aetnif3iytoat  neo (0 rtr(r nu4llt mnvs s)sDrrxrp;o4opt mo3iatla ea( s (0trxrxocoa1fmD  i slt0 etmir3no4lmt mfctat a2tr(mpnt4aeen ociasfm2el( ont0 exoxfciadfpte uvo s)s2xoxrpiydap   nvil() 2rrumonu0aleomf3tyd sDelnmp (0 eenio3iotlp rlivi s0s2toxo ny4ol  mfvs t aDrau o;o0aeenmiciltls em(vs;()trxrxf3tatfmt au ols setmxrpoy1ap e fcs (  2rmumono4aex mo3iytfaDumuvsn(4 eerif3iatom   neo t0tetmim3iodaltemivta()aDrr( pnt4teenmictatfa emnms;(4tlxoxr oo1lmDelies;s)seurir oodlpt  nctas) 2ta(r nt0apx  ietyt aDuanvp;u0trxoxo3ta1omt luvs;s) etrir3ny1op   fvt sfa2uauroou0tptomo3iat mDrl( on()tleomf oatlat livils)trum(o3iy4amee neiasfsrtmu pot0apt moeiydfa ean p;t0treomf iodlpDeln s s0 exm(o3ny1al n neias)aDurumpoo1tltomoetasfs2um(mpnt)arenir iadlat li slt tetoim iudaltelnvsas)srtm( ono1oleoii3ilt m2uanmp;(0treriocoodlmD  nvi s)s2ur(mpou4apee fvi tf Dtm(mpot4ope mfctytls umnms;(4aetnxf iadfa  lnei t s2xo(m3iu1lltnlies (faDurx  oo4tet  i3iadlsDeanms u)aexriocoa1om  lnes;t) rumxmpno1lm  lieia(fsDrrxrpnt4opxnmoctydfmDumnvpnu)trtnxr3tadlpDr uvo;s  2tr(r3nodalenmnvt sf Drmxrp;o4oex  feiltfaDrm(vsnu0 etnmfcia1fm ran s s)srxr(o3iu4apenmicias s2tr( ono1aeen fctasfm2rl( s (0 ltrir3oadopDelueslt)t2urio3oo1omte feta( arrau pou1olt io3tld aDua( p;u4tlerircty1lm e uvi;s0t2uoxo3nu4alt mnvt sfa2raumoou4oet ii3iaslm eluvpn(0alerxfctydfpDrluvi;t) rumxrpiu1amenmivs tfaDraump;o4oexnii3iadfs2emu o u) reoxfcoadopDraneo t)srto(r3no1lp emivia(fsDrmxm ;t4olx mfcilsfs rmu o t4aexrmociatfat auvil() 2xmxr3oydlle  nesatfsrraurpot1optoio3iyt aDuanmp u4 eenmo3ty1fmt  uvo (0s2uriopiy1op nmfvtltfa2tauro;u4tle mietldfm2rm( pn() renircia1omDr n il(0 2trxo nu1apenmfvt ( srrrxmpou1aee  i3tyd m2ea( o u0 etoio3oytfaDeluvo;t s2uoxr iu1lmenmici tf 2taxm ;u1aet  i3ilslm2ra(ms () lerxrcoa1fmtr uvs;t) rtm(opou1lltn fvt ( s2tmurp;o0aeto f3iad s elu o (0 etomf3oodfa raiesl() rurxmpoo4ome  feia() ruaxmp;o1olt  icild m2ulnvpnt0 exrmf iydlmDrlieilt)seto(rpio1llte nvs tfs2um(m ;u0tpxoiiciydlm elnvs t0trtnxr iytlpDr i o;t0 rxoiopoy4optn fvia(fsDraxroou4ape  i3ilt a ua( pnu4texnmr oydlm rlivi s0 etoio3ny1lpt  ncs (fsrrmuront0tpx  f3ilt mDeanvs u0teenio ty1fa rli s ( seumxm3iu4lm nmnciltfsrum(rooo4apeomo3tld s2emums t0tltnxf3iy1lp rlnvi t) rurxo oodlm nlicta(fa2ur( o;u0tet ii3iatlsDea( ont0trxnio3ootfm rlieslt0t2urio oo1ome  ieils)s2rm(  nu1opx  octatlm2rmu o t4trenxf ty1om eluvi;s0 rurir ou4lm nmnesat)a2tr( poo0tpt moeiasla2rl(vpnu4tltnxoctadom e uei;t0 2uo(opoodopt lfes (f 2uaump;u0aex ifeiysls2ranvsnu0texoif iytopD livo t0trto(mpou4optnliesa(faruaurp;t0aexn fetldfs emu p;u) exomr3iodlpt aueo s)tetrimpiu4aleelfcs (fs2tmum ot0aexn o3iatfs ulumo (4trenxrctadoat anvo s sexmxmpoo1lpt lnvsl() Drmxr ;o4olxnmf3iad s ul(mpnu)trtrif3iy1fmD  n i t) etmio3ou4alt lnvsas)sDumxroou1apen ociyt m rlnmp u4tlxnmo oatla raues (  2umim3no1oleelivslt sruax onu0aet io3iydlm uau s () etomo iatomD ln s;t)t2umxr nydlmtnmneiatfa2rmu oot0tet  fetltlaDranvpnu)tlerxocoydop  aiei;t)texoxrpny1lleemnvsa(f 2rr( oou0optn fciydfa rlu o;t4 ltoioctatfaDe i s;(  2umxm3oy1lmtn ncsls aDra( p;o4olx  feils s eau o t) lxnxf3tadfmD  ues t  exoimpoudamtnlics (  Dua(mono0teen f3tldfs ran p;(4trtnmo iadomtrlues s sexo(o3no4amt mfeiatf 2trxmpnt1texomfctltlaDrl( on(4aexrmoctodfa  aivi;(0 eumir oudoltn fesa(f rtmxmp;o1oee mf3iydla um(mp;u)trenmfcty1op ean sls)srxo(mpoo4ome  ivils)aDtau  ;t0optn feiatla eanmp;(0 renxf3iydoaD aueslt0trto(r3iudlmeelfci s) rra(mp;o1oltoioeiyt sDeln s;t4trtnmrcoy1fmD auvslt) rtoim3iu4ame lfci t  2tmu ont0oltomi3tysfm el( o u4tlxnxr3ta1fpt an slt)tetm(r3ny4lle  net t)s2rrum ou0aleoii3iasfm2rmn s u0 lermrcoodoa eau o;( srur(m io4llt mncia()sDta(mp;u1tltomieildlm uauvpnu)alerif tytoa ean o;s) exo(m ny4am n fvil( sDraxrono4altnif3tadls2ranms;()treoxf3iydlatrauvo t tetrio oo4opte iet ( a2rm(mono1tpxomfcilsfs eanmpnu0 ltrmo oa1opDraneslt0 etmir ou1lmee neilsf 2raxr no1apxo ieiasla rl(mo;u4trtrxfctydoaDe uvo t t2uoim3iudamtelicsltfaDurx  nu1tlt mfcildfm umnmpn(0tetrifctotfmDrluvil()t2uo(r ny4olt liciat s2uru pou4opxnmi3tatfs2emn o ()teeomf oadfmDe i o t)setrir oo1ole  icsat  rtm(ro;t1aee  i3tasls2rl(ms t0 rxnxo oadlmt aneo;( teum(m3oo4ap elictat)arrrxmooo4texo o3tas a2rmn sn(4aexnxf3tadoaDelu s;()teum(rpoydopen nci s)a2ua(ronu1oexnifctasfmDeauvsnt) rtrir3ty1op   uvilt)srtm(m nudaptnlnei tfsDtrxront0aexoii3tltls uanmpn()texrxr3ia1opD anvo;(0 2to(mpny4ameemnvi t s2urum ;u0tpeoiocild s2rmn snt) eeoxrciodomt aies s0t2tm(r3iodaltemnviat aDrm(r ;u4tpx  ictytfaDrl(mo;u) lxrio todom raues;s srtriopnydlp  livtat  Dtaxrp;u4tee  iciadlm rmnmsn()trtoxr3oadla r u s s teumiopio4lpte nvsl(fs2rrxm ;o1ape ifciasfmDuau s;t) leomo ootlat an s;()texo(o nu1amtnmncil(f 2raur nu1tet  i3iytls emnmp u4 ltomo3iadfp elueo t0trtrir oodlm   icilsf rumurooo1openmfetlt m2uauvpnu)altnxfcoytopteaieo t0 rur(opnodame lictasfs2rmx pou0tpenifciyslmDem(ms;()aeenmr3iotopD  i s;t s2umxrpnydaptnlfvt t a2tmur ;o0opx mieilt aDrl(vs;u0aexrxo tydfa   neslt0t2tm(r3io1lme  ieiat)a2trxmo;u0tpe  o3iysla rm(vsn()trxnmocoytfateauvo;(0teur(o3nudamt  fcsltfaDur(mpou1olxomfctlslsDeln s;t4arxrir tadopDeaivsls0sexmiopny1apee icsa( sDrr(mooo1teeo oeias mDel( onu0 rtrmf3io1opD ai o s  etmiopiy1omtemneilt) Dtr(mpou0olxn i3ils mDelu ont0trenif3tytlmD  n o ()trxoxo iydlpe livsl()arurxr ot4aexoifeiytlm ua(vp t)arxnmf3iy1la   uei;s0 2xoirpoo4lp elneil(f 2ua(mpot0oeeomiciadlaDemn p u)tlenxo3ia1opt an il() rtoim oo4apenlnes ( s2tmu pnt4ope moetasla eaumonu4aetoxo3iodop  aneol(0s2xoxr oydllenmivt tfsrtrurp;u4olxo o3iytfa2rmuvonu) etrxf3ootlp eaivs s truoxo nudol e fcias sDrm(m no4apxomfetyd sDemn pn(0 ltrxr iytopD au s s t2xmio oodaltnlici sf 2raurono4oeeo fciyslm2emu on()tltnxo3oo1fa  luvilt srtm(rpnodame lfetls)sDururooo4ope  ieiyslmDua(mp;t4 eeomo3iadfmtrli s;t s2tmim iu4lptnlfcsasfa2rmxmo;o0apeomiciatlm elu s;t0 eeoif3iotfm raivs (0 etr(m3iydapt lfvt ( sDtaxr no1tpe ioeils m2elu o (0trtoifciy1omDe nvs;t srxmxr iu4oleelietl( s2ta(r nu1apt mf3iyd a um( o;() lxomf3iy1fmDe n i;(0teurxo3io4alenlnvs (f 2tau pnt4olx mociltfs um(mp (4aeenxrcty1om rli ol() etr(mpny4aptn ncta() Duaxmoot0opxnmoeiysfa2elnvpnt)tlxnio3totomD au i ( trxmxopoy4lm elnvt sfa2taumooo4tlt mietlslmDemuvs;(0 eenifcty1fm rlivs;() etoir3oo1am nlivilt) Dur(r ;u1apx  i3tyt a2emu s t0alxnmoctydoa   i i t  rtr(rpoodlpt mfci (f 2urxm oo4opt  fetlsls ranvsn(0alxrxocoodfaDranvo t  2xo(rpno1lpte ivs s a2ra( pno0tlt mietytls2emumpnu0 renmr oy1fmDrlnvilt) rumio nudlptn nvtl()a2tax oou0olxn ietytfs umnvo;u)trtrxf iy1lm rln sl()s2xmxopnudale lncia(f Drm(rpot0apeomoeils a2ea(mp (4tetomfcoatoateanvi;()trtr(mpoy4apeelfeils)s2rau pou1optoiiciasfs2ua(ms u4altnmf ty1lm rlieo;s)texoirpou4ame lnvt t  rtm(mo;t0aleo i3tyt sDulnvsnt)aeeomfcoy1fmtrlieil( truoim ou4oleemivtlt  Dta(mpot0aptn fetlsfs ulnmp t)areomocoydfpDe nvs t0t2uoxm3ny4am  mnesat)sDrrx  oo4alt  fctyd m ulums;()trxoir tadfa  ai il(0 2uo(m iudape lfeia(  Drrxmpoo4aeeniieiyd s ea( s;u4 lerxo3io1oaDeli il()s2to(r io1ap nmfcs ( s2umumpno4tpxo fcildfsDran pn(0texnxocootfmt an i;( s2uriopiy1apee ivils)aruaxm oo1tex ioeiyt m2emnmp;t)alxomr oy1opDrlu s s0 rxmim ou4optemivilt a2tau  ;o4teeomocildls elnmsnu4tltrir iotomt  nvo;() etmxo3iy1altelici s)sDumurp;o4tlt  fcilsfa2rmu snu4 renmocoa1fm r i o;(0trxmxo3no4alte nvi s)artmur nt1tetoiieils m2um(ms;t0aetomoctodfptran o ( t2umxm iodlpt  fvia() Drru  no0opeomf3tydlm2emuvo;u4tetrmr oatoa rauvo s0texmir oodlp elfei t) Dumumo;u1tpxomictys s ul(vont4teeomo3iy1lm eauvolt srumxrpoudlmee ivtls sDua(m no0tlxoiieiydfaDemnms;(0 eeoio3tydop ranei;(0 ruoimpiudllt micta( sDurx pot1tpe  ociatla ulnvsnu)arxrif iotlmDeau s;() euo(opnu1am  mnvi tf 2uax o;o4opeoio3iys s2umnvp;() eenio3tatlaDe ivi ( sexmxo oodap elnvtl(f rtrxmono0tptoiieils sDeau s;t4 rtoio oodom r ieil(  euoir io1lltnmieilsfsDrrurpot4aee mocilsfm2rm( o;(0 ltrir iydlptr i o;()seur(m3oy4omtelfetat) Dta(mp;u4open ociyslmDeaumo u) exoxf3oadom rlnvolt seumiopnodom nmfctas)srtm(  oo1tlen o3ias a2emump;t0 lxoxo oo1oaD auvi () rxmim oudam e icsa(f 2raxr nu4altn f3ildla2eau o t4 ltoif ia1om raues t0 exm(rpoo1lmen fcslsfs2umu pou1oexo feilslm ul( s;u)tlerio ootfpteauvols  rxo(o nu4omtn nesas)aDumxm ;o4apxo i3ildfmDumums t4 rerxf oo1lpD lieo (0 2um(mpio1ll elictlsfa2ra(m ;t0tetomoetysfm eauvs u) lxnir iy1lp rau s t t2xrio ny4lp  mnei (f Drm(mont0apx  fcias s2umnvo u4teenioctodlaD anei;(0srxr(m oo1op e ieils)a2tr(mpoo1tleomieild m uau p;u0 rtomoctytlat lu o s0 etrimpiy1lme  fctat) Drmu ono1aee ifctydlsDrmuvo u0altrxr oa1oaD lu sls)trxo(mpoo4omt mfvsl(  2tmu  no0apt mi3iadlmDemump t0alenxf todoaDeauesl(0setm(o3oy4al nliviasfarrru  ot0aetn oetadls2ua(mo;u)arenxf3oydfm  au o t)setoxm3oy1apt  ivs ( aDra(rpou1texoifeilsfm2ulumonu0 exnxr3iy1lp eaivslt sexm(rpoo1lle  ncs sf rra(ro;o0tetnmfciytfa eaums;u4 rtomf3iotfatelu i t0teuo(o3ny4oleelfvilsf ruaxm ;u0ale moeiytfs umnvs;(4teenxf ty1laDr i i ()teumxo nudop nmivtl()a2tmurp;u1tlxo fctas s ua(vsnt0tlxoxr oydomDranes;t  etr(rpoydlpt mfvi s)sDtaxrooo4aeenmoeiatfaDel( o;u0texrio iatlmtr uei t) 2xriopoo4ape mnetlsf Dumu pou4opxnmi3ils aDrau sn() rerifcoadfptrluvi;s)teuoio nudoleemiesa()s2tmum ;t1aee ifctytlm ranmo;t4trtoir3tadlmtr nesl( setmir3oudom  mivsat)aDraxm ;o1teeoifcildfm2rlu s;t)treoxf ia1op eluvolt  rtr(m nudapee fcta(f Dur(r ou1tlx  icilsfs2rmnvp;()trtrifcia1oaDelneol(  2xr(mpoo1altemiciltf Drmx pnu4oleomo3tld aDem(vp;t0aeerxrciytfpDraivs t) eto(r io1lpenmivtlsfaDumxmont4apenmf3iatfsDrmnmp;u)aleomr3totfpDeaueolt srtm(mpnudop e nctl(fsDuaxrpoo0tlt if3ilsla2ul( p;(0arxrmf oa1fmt auei;t s2trxm nu1alenlfesat)srtaxmp;u0aexnii3iadlm2emn snu)alxnio3ta1oat lieilt) etmir3iu4ap  lnei tfarrrxro;t1alxo fctasfm el(ms u)teenxfcoydfmte n i s)s2uoio no1omeelics () 2rm(mono4texo ieiltlm2eaumo;u4arxomo tatomte uvilt trtrim3oy1amenlncia() 2ua(mpno1alt  octltlsDrm(mp;u4tltrxrcio1fmDrln o;t0 rxmio3oo4lp  licil(fsDtm(rpot4oeto i3tlsfs el(vpnu)tetoxr oo1op raues;( s2trir io1lme lfcsl(  ruaxmpoo0tleomociysfaDrl(vp;()altomr oydlatrlneols)s2urxrpnu1opte fcs sf 2tm(  ot4oet iictadla rluvp;(0aetnmr oytoatrluei;()srxo(rpio1ape  icsa()sruaxmo;o0oexomoeiasfm2ua( o;u) ltomr3oo1opDelivils sexmiopoo1apenlneia(fa2umx o;u4alx ii3iatfaDrm(mp;u0aleoxrctatoaD anvi;s)t2xm(o3nu4lmeemivtatf 2trxmpno0oeen oetytfmDrmnmp t4tltomo3ootfp rli s;s) etmim3nudol elncsl(fs2rmx pno1tpe ioeiltlsDrm(vp t4tlxrirctytlpDraiei s0setm(mpnydlme mnet (farrmxr ;o0opt moeiyt s uanmsnu)aeermf3oydom  luvi t sexm(rpn
\ No newline at end of file
@@ -0,0 +1 @@
+ivi (0trtoxo3ou4olenlnetasfa2raxmont4aexnmfeiyd m2uau o u)tltnir ta1lpt  n i;t srxrim3ny4ap e net ()sruaxrpnu0oltnmieiaslm rmuvp u)artomfctadomtr nvo;(0srtrxopoy4apt  fvt t aDrau  no1oee if3tasfsDranmo t)tltnmr3tydoatrlneol( t2tm(o3nu1ome mfvtltfa2um( oot1teeomoctldfa ul( o u4trtrxf3oydlmtr u il(0t2toxm3oy4oltelfei (fa2raxr oo1aexnioctydla2rm(mp;u)teeoxoctydfa rlieo;s0 rumir3io4optelneil( sDtrxr ;u1tetnmi3iltlm2rlnmp (4teeomf3ootfp elueilt  2umxm oy1oltemfctasf rtmu  ot1aptomociaslm2eln s (4altnxo3ia1fat  ieo s)setrxopoo1om nlfcslt aDuaumpnt1aetniictls a2eanmo;()treoxo3oadoatrau ols truoio io4ole mneiat a2uauronu0tpe moeiys a uanvs;u0 eermo3oadfateln i t tetoxo iodame lncs ()a2rm(ro;t4olenmocils m2ul(vsnu4 reoif3ootop  au i ( trurxm nudlme lnei tfs2tmumo;u0aeenmo3tyt m2rmuvp;t4aeermf3iydopt lu ols)srto(r3oydllenlivt (f 2uru  ;t1alxn feiydfmDuln pnt0teeoxf tydfaD lnvo;t  2xoimpiydlm nmfcs (fsDuau ont0alx mo3ilsfm2emuvsn(0 exoif ia1fm rlu i ()setm(m ou1lptemfesls)sDrmum ot0oleoifcilsls ea(mo;t0aeeomf iodlaDeaneo;s)t2urxm iu4optelnvta(fs2umurp;o1tpto ieils a ulnvonu4 leoircoodfmDe neols)t2toio nu4lm   fcs s srtmxmoou1oee iictytfm2rm(vs t) rtrio3iatlatrauvolt0 rtrxrpno4ape  icsat s2taumpno1apxomfctas aDrmu s;u4trenmrcty1oaDeaivi (0 2urxo3nodape  nciatfarrrxrpnt0tlen ieilsla2rmnmsnu)alxnmo iatfpt an slt srxoxm iu4ap  mnctls) rta(ro;o4tlxnmocild a2rm( s ()alxnmf ootopDeau ilt)teumio no1al  mfvs ( s2rm(mpno0oeenmoeiytls rlnmsnu0 ltnxrcoadoa eli i;()srtmxopno1alte nesa(fs2tau oou4opx mo3iydfmDrlnvon()tltnmf iadlaDr ueo;t0setoxr nudlmtemfeslsfa2taxront0apxo ietatfs eanvp u4 exrif ty1omDr uvi () 2umxm3iu4lm nmfet t)sDraum ot4olt  oeildla ul( p;t4alenmociadfa rlu o (  rxmxm oy4lptelncias)sDuaxroot1oee moetat m2em(mo t4trtnio tatfpDrlueslt) exo(opno1ap  lnvtl(faDurxronu1opt iociaslaDea( ont4trtomr3ty1fatrauvolt0 rxo(r3ou4op  lfcs sfarururo;t1tpt  ietad s2eau o t4artnmrctytfptr nvsls0 2tmio iy4alee ncils) Dta(rpnt0oetn i3iad s2umnmpnu)arxoio3ta1fp eli i;()s2trxm3oy4omtelfeia( srraxmpot4oleomfeiasfaDraumo;()texnmo iodfaD ln ols  2xoim nu4optn ivs tf 2rax  nt4aeto fetldfm ulump;(0 rxnio oy1faD  uvil( sruoir3oudalt lncs (fs2uax p;o1oltnmi3iatlm rmump;t) etoxr tytfmDrai o s t2tr(rpoo4ll  lnvsa( sruaur oo0aexomieiyt m2eau ont)arermf3totlaDraueilt  rtm(rpnodale  net (fa2rm(m nt1tpxn i3iadls rmu o (4altomf3iy1oa  ai ol(0 rumiopnydal nmnvt s aDtm(rp;u0open iciysfa em( p t)trtrmoctotlmtr uvo;t)tetr(m ou4ap  livi t  Durxrono0tlt mociytfa2ranmo u0artnmr3iadlmD ln sls0 rtr(m nydlmt lncsl( srua(m ot1tex ioctlsfs rmnmp;u4trtomf3io1fm rln s;(0sexrim3oydaltnmnvs t)a2rrx ono0tlxn ictadla ran p;(4alxnmocia1lmt  ivo s0srtrimpoo4ol nmnctlt)s2tmu pnt4ope  feiyslm2ea( s ()tlxoxr tydoa eaies t0t2uoxo3oodome mnet sfsrurx o;o1oet if3ils m ul(mo (4 exnmf oodlmt  nvsl(0srumxm iy4llenmfciat) Dtrx onu0opx mi3iatfa2elnvo () eenir oo1opteluesls)s2xm(rpio4ll e ieiat) Dtaur ;u1tlxoio3iatfa2emnmo (0arxnmr3todoateanvs s t2toxr3io4ap elnesatfs2rm(  ou1tlxn fetasfsDrmnvo (0altoir todfaDranei;t)sexr(rpoudolen icils  2trx pnt0aptnmi3ildfmDra(mo;(0 ltrmr3iy1lmDeai ilt) etm(m3oydlm eliesl( srrmumpno4tptoio3tys s2ra( p;u4 rtrifciodfmtran olt  euoxm3nu4lp nlnvia(fs2urump;t0alxniicias aDra(ms;u4aexoio ta1la raies;()teumimpny4omt livsat)aDraxr ;t0olen octyslm umums () rerxr tydfmte ies;(0srxrxrpoy1op  mnei t)aDtrum nu4aexnioeiysfa2uaumo;u)trxomocia1fpte uei;t setrxm no1ap n iciatfarumu  ;u0ape mi3iys mDemnvon(4teeoxfcoydoaD  u sls0 etoxr nodam n ivil()sDurum oo4alxnmi3iysfa2eanmpnt4tlxoxf tytlp r nvs;t) exoxm iy4apt lietl(  rtm(roou4opeomf3iys s um( snt)arxnmf3io1opD lues (0 etr(o no4lm nlfvi tfsrtrxmo;o1tpxomo3tyt mDel( onu)aetnifcootlpDrlues;t srtr(o io1ll emiviat a2rr( pot0tex  iciasfsDuauvo t0arxrxf3oodlate uvo ( trurxrpoo4llte ncs t)srrmumpno1tetnmicild s umums;u)tlxrmf iytlate ies;s)srum(mpnu4om e fes t)arrrurooo4oltn f3iytls emn o t0 rtrxo todfmD ln s;t teurxr nodlpt mfctlsfa2urxmo;u1tpxo icias a2rmn p;u4 renmocoodopD livils0 rto(opoo1om n ivsls artaxmo;o1tlxo fciydls2emnmsn()artnxf3oodlp  aivi;t)srumxm3oo4apenlnci sf 2ur(rpoo1oleoifcilt a2ul(mpnt)arermf oytfa eau il(0s2xoio3oo1ap e ivil() Drmx pno4alto fcild a2rlnvp (0aetrmo3tadfateai olt)srtmxo ou1amtemnvs s sruaxr ot1alen o3tat mDul(ms u)aeeoir3ta1fpt auvolt) eurim3oudll n fvt (f 2tau oot0ole mieiltfsDrmnvp;t0 lenif iatop   nvo s)t2tmim3ny4opt livslsfsrra(ront0tltn fciys sDuanvs t) etoif3todla   u s (0 2uoir3iu1apt lneslsfsDua(mp;u0tltnmi3ias mDeaumpnu)areoxf3oodlmD livs;( t2xrxr ou1lltnmivilsfsrrr(m ;u1opx  o3iltlaDelnvo t4aleoifctytop  aueo s0texmio oo1alte icils arur(rpno0apeomocilt m2uauvpnt0trenxo ta1lmD lnvs;t)srto(m3no4lptnmiet ( arta(mpoo0opt mi3iytla el( s;u)aexomrcoytfp  aiei;( trxoio3oy1ol n nesls)a2rm( p;o0teenmo3iyd sDuln on(4aexnmf3oytlm   i o s  rxr(opiy4lmt mfcias) Drr(  ou4oleomi3iat a rmn o (0teenmr iy1fpDelues;t)srxo(r nu4apt lfctlt  2tr(ront4oleo icildls rau p;u) leomr ty1lmDrlivil( s2uoiopiydam emnesltf Dtmu  ot0opt  ieiysfa uau on(0aeeoxfcoo1omtr u i t) exoim nu1ap  mneilt sDta(moou1tlto oeildlm ea(von(0 rtnmrcio1lpt ln s (0srumxr no1olt lfvt t)sruax  ;o0ale  oeiadlsDumu o (4tetomfcia1lpD aivo;s0trto(m nydlpe micia(  Dumu  ou0tlenmf3ildlmDeauvo t)texrmr3oo1lp eaneo t0texoio nodale lfei sfsrtmxr no1aetnmfctlt a2ulnvpnt) eerxfcta1fpDr uei s0srxm(r3nydlleemivi sfs2trx  ou1texnmi3iatfm rlu o t)tltrmrciatoa eaues;( srxr(m iy1lmenlivs t  2umurono1tee ii3tydlsDranvp u0trxoxoctotfmt  nei;s  2xr(m3iu1aptemnciasf 2uaumono4ope mfetatfaDelu o u)altrifctatfateanesl()s2xrim3oo4lpt  nvils sDrrur ot0oexomieiyt a2eau sn()trtrif3iatoaDr n s;()trxrxr3iydolt miesa( a2uax o;t0oetn f3tyt s rlnmsnu0aeenio totlpDeanvi;(0t2tr(o ou4lle mfci tfs2tmxm ;o0oltoiociltfs emnvs (4aeerxrctatop   ueol() exo(r3nu4altnlneiatfaDrmxront1tlto ieiadfm2ra(mo (0 lenmf ty1oate uei;( teto(o io4omtn nct (fs2tm(rp;o4tltniictatls uan snu0 ltnmocoydoaDeaneslt) 2uoxm3io1amtelfetlsfsDum(mo;o1oet ioctasfs2rlnmpn(0 lerxocoodlpt livs t  exr(r3nudame  nvta()sDrau  ot1oee iiciaslm2ul(mp;t)trtomocoa1fpte ueo;(0 eurio3no1omen fetl(f 2ur( o;u4openmietltfs eau p;() leoifcio1opD ln o s  2umim io1oltnmici tfarrmxrp;o4optomi3tld a ea( ont0 exnxo3tytlp rau o (0s2urir3oy1optn fvsls a2ra(moou0tee ioeiasla elu pnu)texriocoadlp e ivo;t seto(rpoodal  mneils s2tm( pnt4tetoiiciltlaDrmuvo;t4 ltnxfctytomDran ilt tetm(rpnydamtelivia(farur(moou0aeenio3iyt s elu p;u)arerioctotlatraivilt)srxmio3io4amtnlfetas)s2taxrono1tlx  o3tyslsDean o;()trtrif oydop raueil(0t2toxo3oy1alt licilt)s2rrxm oo4opx mfeiyslm uauvo u4tlenxrcty1fmt lnei ( tetoio3oy1ameelicta(farra( oou4apeomf3ils s2umn s;t)trxrmocoytoatraues () rxo(r3oo4ll  lneils)arurumoot0tetnioetltfm emnmo;t4tltoxo oo1fa  anvs;s0 rxmimpoo4lm emfvi (  2uaump;u4tptnmi3iatlaDrm(msnu4 lxnxr3iytla ranvsls)t2xo(rpou1lme mnvtl(faDtrurpnt0oleniicias a2ra( sn(0trxnxo3io1lmDeauvs ()sexoxr3oy4amenlfvs s) rtmxmooo1alxn ieiltfm ea( p t0trtrmo3totfa rlu o;s0t2xrirpoo4llenmfvta()arta(m nt1tptomfciadla2ua( s;()trenmr oytfp  lnvol()trtrxm3iodlp nlfes s)artrurpou1tptnif3iyd m uln p u4 eenxo3ia1lmDr i i (0s2xoimpio1lpen ieslt)aDtmxrooo1opto feildfsDrl( s u0 reoxo3oa1oate i i;t)s2uoxm3ny1lp  lnvi (faDrrxmp;t0tlt ifciasla elu s;u4tetomfcoatop eaies s0 exoxopnu4lptnmnvt tfa2uaxrpnt4apxn ociatlaDul( sn(4altoxr3totlate uvo;t0srxmimpiy4am  mnvt ( s2tmum nt0texnmfetysfaDulnms (4trerir3io1latelnvo;(0s2tr(m nu4ol elivtat  rrmur ;o4open fctls aDumumpnu0aleoiocoy1fmtr u o;()tetmxm iu1oleemivilt srururp;o1optnmo3ilt a um(mo;(0 lxoio3oo1opD  uesls0 2urxo3ou4olenlfei sfarumxr oo0optnifciadla2rmumo u4treomr oo1oat an slt0srurio3no4ole lfei ( s2ta(mp;t0opt io3iyd m ean o;u0 rxrmrciotoa   uvs;s0tetr(m iudomeelicsl() rur(rpnu4oee iictatfaDuauvont)texomo3io1omtrlivs s srtrxr iydlp nmiesas)srua( oot0tpt mfeiad a eauvs (4arenif ootla rlneolt trurim io4lle livtat srrrum nt4ope  feiydfm2elnmpnu4teenirciatlptelues;s sexrim nu4ol elfvtat) 2raxrpnt0olenmfcias s ra(mp (0trenxf3oy1fpDeaneo (0trxrim3oo4al  mics s)srurxmo;u1oeeomiciysfmDeau p u4aeerir3iy1fmtelu i s0texoiopoydopt lfet s)s2rm(  ;t0tetnifciltlaDulumsnt0arenxo3tadfa eanvo;s t2urimpoo1ope livi () rtr(rpno0tpxo ietydfm2rmuvpnu0aetrxrcootoptrli i;t)srurxo3nodom elicilt)s2tmx  ;t1altomfctlsfm2ra( snu0 etoxfcty1fatelnvo ( sexo(o nu4ape  ivs ()aDra(ronu0aet  fciadlsDem( s (0trxnxfctydlm  li s () 2to(o3io4omtnlivt sf Dua(  no0opx iocilsfs el(mo (4tlxoxf tatlat  ivs;t) rumim iu1ape  nctas  2urxr oo1aeeoioctltfs eluvs;() etomo3iatfaDe ivol( s2tr(o3ou4amenlivtltf 2rrx pou0alxoifeiatfsDua( pnt4aeenircootfmD  nei (  rtr(mpiydamt  nciat)a2tmuront4olenioetysfaDum(monu0 rxoxocia1fpDe ivs ( t2trxm3io1op e icsl(fa2tau o;u0tleoioeils sDel(vpnt) rerxo3tytfptrlnvo;s0srtoxrpoodop e ieias)aDrrurono4alt  octatfs2rmnmp;u)aetnmrctadfa rluei t)trtoxr nu1lpeeliei t)s2tr( p;u1aleo o3tysla2ranvs;t) renmf ta1lmDr ieilt)trtoxr3nydlme mneslt) Dtm(r ;o1aetomf3iytlaDrl( pn(4tleoif todfpteli o (0setmxr3iydoleelietat)arrmuro;u1tpto ociatlsDrlums;(0arenmr3iydfat  ueo s0srtmxo3io1ll  lfvsa()a2tmur oo0aex  iciltfm2rauvo t4aeeomfcoadfmtelueols0 rtrim nu1lm   nci sfs2uax p;o0oltn i3ilslaDrl(vp t)tltrmfcto1omD aieo;t)t2xrxmpou1amenlfcs t aDrrxmpnu0olenmi3tltfm2ean s u)tetrmrctytomt luei (0srxm(mpiu4ol   fvt tfsDrr(rp;u4olto i3ilslm2elu s t4tlenir3io1lm  ln olt0srxoxo3no1aptelicsl(farrmurpot4olxnioeias sDel( o;t4 rtriocoadlpt aivi;() 2toxopoy4alee ivsat) Drau oou4ope mfciatla um(mo t0 rxnxr3tytlmD lneil(0srtrim io4opt  ivs t arurxmonu4olen ieiydfaDelnvp;t0trxrmf3to1lm r uvi;t)setm(o io4lptnlnetl()a2taxmpot0altnifeiydfaDulu o t0 eerxr to1oa  li sl( tetoxrpoy4omt mnetas)sDrrxroot4tpeoiiciyt mDumnmo;u4aexnifcoa1la e nes ()teumxopny4al  mncsa( aruau  nt1ole mocias m2ulums u4tlenmf3oytoat li i (0srxmir nu1llt mfcilt)srtr(  ;u0ope iiciaslsDumuvsn() leoxr3io1fp r uvslt) 2xmir iodoltemnvsat a2ua(mpnu0olx mieild s ra( sn()aetoxo3iotla  aneo;(0t2xrirpnudop nmfctasfarum(mp;t1aleo o3tys s2um(mo u)trxnir oodlatr n s;s) 2toir iydlpeelnctatf Drmx oou0oleoif3tatls emuvont0trermo3oatlp  lnvo;()texrxmpio1llt mnetls aDrr(r ot4opt  feiasfmDuanmo t4tleoir tatlat ln i;s sexo(mpny4openmnct s s2rrx o;t1aexnii3ilt sDem(monu4 lxrif oy1fateauvslt s2uoir3oy4apenmnei s s2uaxmpou0opxomieiadls2rau onu4aetnxr todop e neo;t0sexrxr3ou1lp  lfcs sf rua(root4oexomfcilsla2emnmo;u0 ltrif oy1fmD  ieol()srto(mpoodoltelfctls aDraump;o1olx  o3tls s ra(ms;u0teerxrciotoptrlues;(0trtrxopiu4omtnlncia(f Drmx p;u1oex mf3iytls2uau p;t4 ltnxf oodlpDeaieo s0seto(o nu1lmee ict s aDrm(r nu0aeto o3ilslsDeauvp;(4aleoif oy1fpDe nesl(0s2xo(o nu1aptemicsls)s2ua(r ;u1olenii3iys m2um(mp;t0trxrxo3oodop rlu o;s0srxr(r oodlp   neiat aDta(rpnu0apeo f3iasfa ra(vs (4aeenxr3oo1op rli o s0 2um(mpoydal emfes (  2rr(rp;o1aet mo3iatlaDrm( snt0aetoir3oadoat  uesl(0srtmxopio4oltnmictatfartrurpoo1olxn o3tlslmDem( s;(0 lxrir oydoat lnes t) ruoxm io1lmt mfvsas) 2uau poo0openmf3tysfaDel( s (0artrirctadfpt lues ()srurirpiu4al n icias arta(  no0aptn oeiasls eauvs;()tlxrio3iotfm e ivs;(  rum(o nudlmtnlfvs t)arrr(roou1oeenmfciyd s ranms t)teerif3oy1fpt lu i t t2xr(m3no1om elfesl(f 2ua(mo;t1olx ifeiasla ea(mp t4tetnmo3oodfaD  ues;s) etoio iydole mneilsfsDuaxm ;u1tle mi3iadfs2ea(vs (0artnmr io1op eaivslt  rtoxrpoy1op n fesltfa2raxmo;o4alx  feiydfa eau p u4aeeriociy1optrln il( srtoxm nu1olt mnei s)a2ua(r ;t0olx mfeilt a ean p;u) etnmf3iydoat aueo;t0teur(mpoodll  mivias)arururo;u4oet miciasfmDulnmo;t4texrio ia1lptelnvo;(  etoio3ou4lm  liciasf Drrumo;o0opeoif3tadlm eluvo;t)aetoif3tadoaDeau s;(0 2uoio3oo1lmenmivtatfsrra(rooo0tpt ifcilsfs eln sn(4 renmfciodlp r n o;(0t2uoxopny4apt mictat s2um(r nt1alxomi3ild s2emu pnu) lxoxr io1laDrln s s0srtr(rpiodlpen nviat arrax onu0tpx iociysla rl( o;u4 etomocoo1lpD ai i;(0sexo(r3iydolee ivtas  rraxro;o0tltniiciat a2rlnmo u4 ltoio iodfateaueils0 2tm(o oo1lm n nctlsfarta( p;t4alt  oeiys s ua(mo t4 eerxf oytoptr n s s) 2xr(rpno1amtn ncs () Dta( o;t1ape  fetadfs2ulumpnu4 eeoxr3oydoatr neo;(0s2toxo oodomtnliei t s2rrxrpot4aeenmo3iasfaDrlnmo t)tlxnmf3ootlm  lues s t2toxopou4ol emieiltfa2ra(mooo4olt mfciys s2ean s (0arxnxo ootfat  ivslt  eurxm io4llen iei sf rta(r ;o1tpxomi3iyd s em(monu4 eerxo3io1lm  ai s t0trtmxr io4alenlivtlt)srraxr nt4tlx ioeiat sDea(vpn(0tlerxocoatla   nvo;t0srxo(r3iy1ap nmfviltfarraump;t4openmfeilsfm2elu o ()aeenio ty1op rln s;t s2xr(mpoydap e fcias)aDurumpnu4apt miciytlaDelnvo;(0teerxf3oadfp  luvils  2tm(m3no1al  mivt ( s2ta(mpnt4teto i3iasfa2ulu onu) rxrxociytomtrliei;(0tetoiopio1omtn fcs ()arrm(rono4tpeomfetyslm ra(vo;u0artnmo3todlptran ils0t2urio nodlm e feslt) Drr(m nt1tle iocils m2ua( o;u0texoircta1lmte nvi (  etoxo nu4optn fctas) Drau o;t4olto o3iat s2ranvs t0 lerxfcoytomtelnvslt s2urimpoo1lm n fes t)arumu p;o1tpx ioeiydfaDelnvo t) rerxoctytlm ranvi;t)s2xmimpoodalenlfeiat)s2rmu  ;o1tltoioetaslmDulu p (0tetrxf3iodfa raueol(0t2umxmpio1lm e ici ()srtax pou4tpen oetas aDrlu p;()aleomrcoy1fm r i ilt0sexrxmpoo1apen nes (fsDrmu pot1oexnmo3ilsla em( s u) rtrxo3tadoptelnvi ()texmim3nu1opte nciat sDrrxmoot0tpeo ieild mDranmo;u)trtrxocoadlptelnes;s seumim3io1lpen ici s arrm(r nu4tptn icild a2umnvsn(0aeeomf oadopt  uvo ( s2xrxopnu4apenmfcs s s2rrumo;t1apxo icilslmDean p;t0 rxnxo3oa1fateai s s0seum(m iudlme lneil()artrx o;o4tpx mociyt aDrlnms u4aetnmo oodoaDean i t)s2xm(opoy4omtelfetl()a2tmx  ;u4aet  fciltlm ra(mp;t0trtrio ootomDelneil(  eurio3ny4amt mietasf 2trxrpoo1tetomi3iltlaDum(vo t) etrifcoo1lm raivs;t)s2xrxmpiy4ame  fcia(fs2tm(mpno0olxn f3iatfm ulnvsnu)treomo3iy1lp   nvs;() 2ur(o3oudlm emfvsa( s2rau pnu0tlx mfctyd m2emuvont4artrirciodla rluvi;t0tetr(opiy4lptnmnct (f Dtrx onu4tltnmi3iatlaDrmumon(0texnircia1omDrauvs;s texm(opoy1lm n fesas)arum(rp;o0alt mo3tatlm elu pnu4 eeomo3tatlm raivo s0texmir oydoltemncsls)a2raxm ;o1oltn feilt s2elnmsn(0teerxo oydlp   n i;t)texmxm3nydllt mfei t) Dumx p;t1oetn octatlaDrmnms () lxniocty1fpDeai ils0 2xoimpnu1ol emfeslt)arrmumo;o0texnioctld s umnms u4aeeoxoctodoatrlnvi s)t2xoxrpiy4lpt lnesls  rraump;t0alxnmf3ildfsDua(mp;()artnif3oo1oa e n s;s0teuo(mpoy4ap n neils  rur(m ot1tex mfeiat a2umnmp u4alxrxfctytopDeaieo;t)t2trirpoudap  mncil( srrm(m nu0tpx mfeilsla ranvs (4trermf iytom e nesls seuoxo3nu1opte ivtl( arrmx  ou0oeeoiieiyt s2rl(mo (0aexnxr ta1lmD an olt t2xo(r3iy1omenmivt (farra(ronu4oexo feiytlm2rm( pnt4tlxniociy1la e nvo t trxo(r3nodole lfei t sruru poo1apt moetas sDulu s (4teerxr iodlpteaivi t) 2xo(opiydop   nvt (fs2rr(rpou1apx mfctaslmDra(mp;u)artoxrcty1opt  n o s0trtrxrpoudale mfvt sfaDrruro;t0apt mfcilsfa2ra(vsnu4aetomo iatop   n ols  2uo(r oudoleelfct (  Drmxm oo0opeoii3iatfm umu sn(4alerxo oadom e ueo;s)t2tmim oy4al emnvias  2urxmo;u4opt mfeiytfa2rlnmpnu4artnmo tadom   n o;s0seuoio3iu4am n fet t s2ua(m ;t4tet mi3iytfaDumnms u0 reoifciadfaDrauvil(0 2to(mpnydapeelncilt)sDum(monu1aexnmfctyd sDel( o t)arxnif ia1lm  au i;s t2xmxopiu1olenmivil(faDrrx  ot4tpeniieiadfaDrmumsn(4 etnmf3iadlmDeai s;s t2uoxo3iu1ap e nvtas) ruaum nt0tlxnmf3iadls2ulumpn()altoio iotfat  ueo;s srxoim3nu1al nlics s aDrmu o;o0optomoeildlaDranvpn()treoif iodom  lnvi s t2uoio oo4lltnmicsls srurxr ot1tpt ioctadfa2rm( p t4 eerirciydlm eaueil( setoimpnydlp   ieilsfa2ta(moot4tee ioeils a rmn o;u4 exoxrcty1lmDrln o;t)trxmxopou1altelieilt)artm( pot4aetn ictytfa2ul(vs;u0 lxrircia1late neo s)s2uoxo3oy4opt  nvs ()arum(  nu0oeeomfcilt a emuvs;t)trtrxo3tadopD  neslt0sexoim3oudom n ncsl( s2trxr no4tlenif3iytfa uln o;(4aexrmocoadomteanvslt)s2ur(r3oo1optn nvtl(faDtmxrpot0apxoio3tydfm2ra( s;t0tlxrxo3oatoptr nes s0 exmxmpoy4amt lncils)a2ra(r no0tee  iciydlm2uau pnu0 exnxr tytfaDrlneo t srxmxr io1lpeelivslt)sruau  nt4oexn oeiysls uluvp u4tleoxociodlaD  ivolt0 rxrir no1am   icias a2umx p;u4tpto ietydla em(vp t)tetrmo3oydfmDrau o s)s2xmxr oudlp nlncsatfarurumpoo4alenmo3tasfm2uauvp;() exrmf oytop eai ilt  rtrim nu1ap nliesltfarur(ronu1aeeoii3iytlsDem(mont4teermrciytlat lu o;()teur(m3nodllte icsl( aDtm(roou0alen fctatla ua(mp u4arxoxfctytlp e ivils s2xmir nu4omeelncsltfa2rmxrpnu1tltnmo3iys s rl(mont)aetnifctytfpt auvi t srxm(m oo4ome liesas)arrru onu4tlto o3iltfs2elumo;u0aexoxo oodfat liesl(0t2to(r3iu4lp emiesl() rrrumpou4apxoioeiytlaDea( p;()arenmrctytfp eln o;s0seur(mpou4al e fvta()sDum(rono1tet io3iytla2rl(vo;u)teeomo3oadfpD  u i;()t2uo(r3oo4om   fvt t) rtm(m ;o4olxn iciltlm uln sn()tetnir iadomD lnvi () 2xoio oy1lpt  fviltf Duru o;o0ole mo3tltlm2ul(vp;()trxrircootlmt aueo ( seur(o3ou4op nlfvtlt) Dur( o;o1apx ii3ils sDel( p t) rtnmo oo1opDrluei s) eurir oodaltn ivtls) 2uaxr ;t0olto iciysfmDul(mo;u)tltrio iytla ean o;s s2xmxr3iodapt lics sf 2taxronu1aleo ictat aDulnmp;t4 leriociy1fa e i s;(0s2urimpio4omtnlncslt) Drmumont4olx mi3tls s2elumo u)artoir iotomtraueol(0s2uo(m3iodolte nvt tfs2taum nu4opeomo3ildfa2eaump;t4texoxr iotoat an slt  rumxm iu4olt  nv
\ No newline at end of file
@@ -0,0 +1 @@
+nvs;s trtmim no1lmtemnvilt  Drr(rpot4tpx  fetldlm rlump (0 eerxo ta1faDe n i t0s2xrim oo1lpt mneilt  rrrxr ;t0olx  oeiysfmDeln pnt4 lxnmr3tytopDr ivs t0trto(rpiy1op emnct t  Dumu  oo0optn ictlt s em(mo u4tetoifciatlatrai sls0 rxoxmpiodop n ivilt  rrax onu0oexo iciasfa2ra(monu0trenmr3oadlate ivols)sexr(m3ou1olenlictl(f Draxmp;u0oeenmoetasfa2umu onu4 lenxociydoa r nvs t seuoxm iu1om nmivsat  Dtaxrp;u1oetomfetys aDulnms;u0treoifctadlaDrli o;(  2xo(o iudlle mnvsatf 2ra(roou4tlxnifctasfa2rl( pnt4 eeomf iodopD  i i t0sexm(r3oo1olenmiciasf Dtr(  ;o0tpxo i3iad a2emnvo (0 ltrxo ia1om  au s;t  rtmxo3oy1ame lfvi t  2rrur ;o4olt ioetas m elu s;(4aetnio ta1lp e i ils0trxmir3nu4amtnlneia(fsDrmuro;o0tpx  ocias sDemnvp ()arxomfcio1fatelivsl(0sexoim3no1om   iviatfsrraumpoo4teto fciyd sDumump;(0 etrxo todfmt luvi t)s2xrxm3io1al nmfetl( aDrrxrono1aexoii3tlsfaDuanvp () rtnmfcoatlaD ai s;() rurim oo1olte nei ()aDtrurono0opt  ieiyd s uan pnu4 etnxr3to1fpD lnes s  rtoir ny4ome lictlsfarra(moot4aexo icias mDrlu o (4tetomo oa1fateauvils0srxoxm3io4alenliesls s2rax pno1aex  fciad m umuvsn(0 rtoxo oa1fa raueo;t0t2toirpnudaptelfei ()a2rrx ono4texomiciad m2uanvsnt0tlxoxfciy1fmDe uvo s  2urim ny4opeelfvi () ruauront1olt ifciyt a2em(vs u0trxnifciy1lat aueols0 euoiopoydlpt lfetatfsDrmumoou0aexn fetys a um(vo u4arxomrcootlaDelneo s0 rxoim3no4olenmncsls)a2uax pnu1tptomictyslm uanms;u) rtnmr iodfa rlivi;( sexo(mpiu1amen neiat sDtrxm ou4ole  ociatfm ua(vont) lxnmf oodlmDraieo;(  etmxo iudlpe  nciltfsDumxm nt4tlxnmietasfm ua(vp;u4texomo3oa1fa eai olt)t2tmim iydam n ivs (f 2tmx  oo1aexo feiyslsDul( s t)trerir3iodlaDr u s t0 2xrxo3nu4ame lfvsatf 2umx  ou0alxo oeiyd sDrau o u0arenxf3oo1oaD auesl() rtoio3oodomtnlici s) Dua( o;t1open feiad a um(mp (0tlerxrcoytlpt anes;()s2xo(opiodomte fcs ( s2ta(mpot4ope  ieilsls2rmu o ()trtoifcio1fmte neo ()sexoxm3io4om  mies ()srtr(  no0ole  ieiysfa2um(vp (4altnir iadopt  n i;t  2uoxo3oodam nlnctat) rrmxr nt1apx io3tasla ra(mo;(0 etoxf3tydlate ueil() ruoxr ou4ope liesl() rtr(  ;u1tptnifetls m2eaumsnu)trenxf oy1faDr u i t  2tm(m nydlp n icta( sDtr(rp;u4aleo f3ilsls2em(vpn()arxrmoctadfm e n o (0seurxrpoy4ale mnvtas  Dururp;u4tlt ii3tlt m2emuvs u4trxoxfcty1lpDelnei ()setoir ou4al  lfvs t  2tm( p;t0tet io3tlsfa2rm( p;(0trtnir3oatlmD  neo;(0 eurxm3io4lm emnvt tfarurxr oo1optn i3iys s2ua( o;(0 ltomo3iotoateluvols)srxmim3oo4op e nvtatfsruaxro;t4tex  oetydlm eanmonu4alenxo tadoa eauvi;( setrir3ny1amen ncs sfs2uru p;u1tpxn octldfm emn o (4 ltrxf3oy1opDe ueo;s)srxr(m iu1lpe mnviat  ruax pnt4tlenmoctas sDem( snt)tetnmfcia1fmDranvs;(0 etrxmpny4ale mnvi t sDrrx  nt4oexomfeiltfs2ean s;(4aeermfciydomDelueo () rtmimpoydam n nct sfsrtm(mp;o0ole mo3ildfm ranvsnu4 lxoif3iatoatean o s0srtriopny1lpe mncsltfa2ur(moou1texoif3iytls rauvs u0alxrmrcoodlpDe ies;t tetmir3oo1omtnmnvi sfs2tm(rpou0oexo f3iltlm raumo u0trxnmr3io1opDr ues s)teurxo3ou4lpt lnviat)sDur(roou0tpt  o3tatfs2rlu p;u4alxrxrcootfa rau ols0s2umxrpio4am e fct t)srrmxroot1tleomoeiys sDuln s;t0artoxo oo1laDr nvs;()srumxmpnodop elicsat  Drax pot4opt ifeias a ra( p;() eeoxf3oa1fpte i sl(0 2trxmpnodope  fctltfsDtaxmooo0oeenmociatls rm(mpnt4tleomf3io1fm  liesls)t2urxr nu1ol elfvsas)aDur( pno1altomi3ilslm ul( pn(0teeomf3iotlatrlnei;s0 ruoiopny4llt  ivi (fsrtrum oo4olxnioeiytla eanvs;(0arermfctatomt  ivs s0s2umirpnydaptnmivsl()aDrax pno4oltn ociat m2rluvs (0tltrmo tytfa  ln ols0tetr(opoo4am   fci t)arum(mpou1tpe  ictadfmDemnms;t0arxrxo iytfptrluvsl() 2toxr no1op elfeiat sDtmx pot4tlxnmo3tytls2ranms;u4aetomrctodlm  aueo;s s2xr(o3oy1ol n ietlt)arrr( poo1tlx  ictyd s2ea(vo t4 ltnxo3oodoatr uvi s0t2toxrpoodlmen feilt)aDta( p;t4opxnmfetld m rln p t0texrxo3oadop elueil()srtmxrpno1lpen fetl( s2uru poo1tltn octat s2ranmpnt4 exrio iy1fa r n o;t)setoxo ny1llt  nvil() 2um( p;t4tlto f3ias s2uaums (0aeeoircoydfpDr n s;s  rum(mpoodlpenlfeta(faDuaurpnu0tetn fciyd m2ua(ms;t0 leoxociytfmDeau o;s0trxm(m3iy4omtnlneias  2tmur nt1alxnmoctld m rl(mo;u4arxnxr3oytlm e uvi;(0trumiopiy1apt lfcta( a2uaxr ot1tetomfciys m2rlu s;u) eenxr3iadomte uvs () 2ur(o iudap e fct t)aDraumont1tleoiictadlm2ra(vp (4trxnxr3iotlaDeaivi;s0 etrir nu1ole licilsfaDtaum nu1tle if3iad mDrm( p t4 rtnxrctodfa e ieo;s0 2xo(m3iu4ap n iei ()a2rax o;t4alxnmfeilsla2rln p u4arermo todoaDelnvi;t) rtoxm3no4omen fcilsf 2raur ;u0tpt mfeiltlaDrauvsnu4texrxo oatfptr uvs t trtmio3oy4alenmnetl() 2ta(r ;u1aetomf3tys m2umump;t)arxrmfcoo1fm  lueo t)srtoxr io4lp   fes ()s2rrurpnt4tpxomo3iyt m elnms t4aleomf3oodfmDelivo;()t2xrimpoudal emicia()arrrumo;t1apxo fcildfaDumuvpnt)treoircta1oaD luvs;s0srtoxr iu1apt mictls)s2tau ooo4tltnmoctytfaDra( pnt0aetrmr totopDelu s t s2toxr3iodalt  neias a2um( p;o1alto ieiltlm2ra( p t)trerif3iatfat anvo s  eurio3no1op emfciat srumxr nu0tpxomfctydfa eauvpn()tleomrctytlate n s ( setoxr3ny4llte fci s) rrm(mp;u1apenifctltfaDua(vs;t)trtomo ia1fa r iesls srurxr ou4olt lfvias) rta(r ou1aleoifeiatfa2rl(mo t0 rxnmrcoadfmteauvsls0sruoxm nodomeelfctasfaDrmu ooo1oet  fetld a2ra(ms;()tlxnmrctadop  ln s s)s2ur(opny1optnmnvt (faDtrump;u1oet  fetlt a2eanmo;t4altrmo oodfpDeluvsl()t2uoim3nu1lmt  feiat) Duaxr ou4olxoii3taslm rauvsnt)arenxrciytlaDraueolt0srto(r3ny4apee ivtasf rtmurono0tlxn fciydla uluvs t4arxnxoctatlmt  ueil(  2uoim3ou1optnmncsltfaDrr(mp;o4tet  ieildla rm(vsnu)aexnmocoadfmD aies () exmimpoudolte nei t  Draumooo4tee mf3ilslm ua(mp;t0aeenxf iydomDean s (0 2uoiopnu1opeelictls arrrurooo0tex ii3iyt a2ua( s () rtomf tatlpteln i () euoxrpoydaleelnvsls sDtr(  no1aeen ieilt m elumsnu4arenmr3oa1fmD auesls  exmxo3oydal n nctlt srtau onu4aetnmfctytfa elu o;t0tltnmf tydop e ieols0 rurimpou1al nlneil()srrmx pnu1ole mf3iltls2ul(vsnt4altrxf3iatoaDeaueil()seuoxm iydame mfci (faDuaxmpoo1alxoiietad a2uauvpnu4aexrxo3oy1lpDrlivo;s)trur(r3ou4ape lfet s  Dtmx  oo1oet  oetytfa2uaums;u) rtnxo oadlp r ies t) 2ur(o3nodlp emics s)arrmx pnt4ope moeildlm emnvs t4trtnio3tatlpDelivs;(0t2xr(o nudamenmiesat sDtaumont4tee io3ilt s rm( p;t4arxnxf3tadfaD  ivs t) euo(opnu4lpt mivi t  rtru  nu0aexniicildfsDrmn o t4aeenif3ta1opDe nvsl( srumxo3oo4al n ncsls)sDumur ou1tleomieiyt mDea( snt4 rtnxr oydlmtr nvo;s0 exr(r3nudlpe mnvil(f Dta(r nt0aeeo oetyt a2ea(mo u0tltoif3ia1lp eluvols  rumxr nodoleemncsa(farrmu  nu1tpxniieilt a umu onu0aetnmfciotfa elies;()s2toxopoydolt  fct sfaDrm(  ;t0aee micias a em(mp;t) rtnmf3totopDrli sls teto(opio1opeemivtlsf Drrxmpno4oet  oeiytls2rmuvp;t4 lxnxf iatopteai s t t2xrxm3iudapeemfci s) Drrump;o0oeto f3tatfmDulu s;t0aexoir oodfptrlneo;s)t2toxr3iy4olt mnvs ()a2rrxront1tpenmfctltla2eauvont0 exoxrcoa1faD  uvo;() rtmxrpiu4ape mnet (f 2ra(mo;u1tpenmocilsla2uan p;u0artnxr3iotomt  nvi (0tetrio3iudom elnvs tf Duax  ou0optoio3iysls emu o u)tlxomf totopteau sl( trtrxr iy1lme lnvi (faDrmur ;t1texn f3tad s eluvp;()texoxo oy1fpDrlu s;s sruoxopnydllt mfctltfartm(ro;u0aexnio3tlsfa rl( p t)trxnmo iodlp elnvils0s2uo(m iy4am e nesa( s2uru  ou1ale  fetlsfmDrm(msnu0 eeoifcootfmD  n slt)s2ur(o oy4lmtemfvsas)sDur(  oo4opto oeiyslmDelnvs ()trxoif3iodop eanvo;(0 etmiopiydalt  iviat) 2uaxmp;o4apx  oeild a uanmo;u)tltoir3oa1opDr ivilt0teumxo ny4alen iesls)sDua(moot4opx ifctydlmDuanvp u)trxrxo iytfpt auvs s)s2xm(opnudll e ies (  ruaur ;t4tpxoiociadfa2ul( s u)altrxfcootoa rluvsls)t2tm(o3oudlpenlieils)artm(monu0oeenio3iadlaDrmnvsn(4treoxo tadomt  ivs t0trtrio3io4ll n iesl(faDrrx ooo1oltniociydlm2emn o u)trxnxfctytlpteaneslt trxmxo iydame mnvtasf rtrur nt1olt moctyslmDemn p;u0 ltomociadlaDranvo s seurio io4omtelfeia(fa2rau p;u0oee mieild aDul(ms;u0 reoir oodfmt  ivslt  rxm(r3nu1ap   fctl(farrm(mpnu0tpe if3ilslaDulnmont) rtomoctytoa r nvil()texmxr3nydapenmivs tfs2ra(r oo1aeeomfciysls2ra(vo;t4teeoxfctydfat auvo t0t2um(m3nydol e nvslt) rumxrpot0tpeo f3iytlmDel(ms t0trtnxrcoydoatranvsl(0trtmio3no4lpte feils aDurxm ;u4aleo ictat mDel( p u) exnir tadlaD an ilt  rto(o3iydaptelnvt s) 2rm(m nu1tet ioeils m2em( s;t4arxrir iatfate ieo s srumxmpio1lmtnlneias srrmxr ot4oeen feiltlaDem(monu0altnio3iatlmtrluvsl(0 etoxm iu4ome liviltfaDumxrp;t4oexoio3iytfsDuln s;(0tltnmf iodlpDrln s;s0teum(m nu4ome lfvtl(  Dta(mpoo1oexnif3iasfa uan s ()aexrmf ia1omteln sl()trxmxo3nodlp n fvs s  ruaxmooo4tptoifeils a eanvs;t)aexomo iatfatelneo;t)tetmio ou4aptelnvt ( srrrxrpot1olx moeiydlsDrlu s;t4trtnxo3ty1faD  uei;()s2ur(o3nu1ol nmfcsl() Dur(r ;u1oltnifetad sDrl(vp;t) lxrxrcoatomtr ivo t)s2xoimpoo4lptnmfet ()sDuaxrpot1opxn oetyt a2elnvp u0trermfcoatoptraivo s) rxrim3io4om nmies sfsrurxro;o1aptn ieiydfs emn p;t4trtrio to1oaD an sl(0texmim3ou1lmtelfetlt)s2ta(m ;t4tet  fciyd m2uln p;t)trerir oadlmDeaieilt0s2ur(mpno1am e nctls)srrru  ou0apeoifctltls2emumo ()artrxocoadop eaieils)t2toxm3ny4aleemivil() Duax  ;u0aex iociytfa rlums;(0arxrio todoptrln s;()truoxr nydaltn fciat aDua( p;t1apxo ocild mDumnvs ()trxoxrctadfmteaivsl( sexo(m iudolen ivtlsfsrua(mpou1tltnifeilsfs2elump (4 rxnmrcoodfatrau s t0 eum(m no1alt lies tfsrta(moot1apeoif3tas aDra(vs;() rtnmoctatfat aies;t trxrir nu1lpt  ietltfartmur ot1aee mietls m2eanvs;(4aexoiocty1lat lu o t)texr(r3iu4ape micsatf ruaxmpou0aee mietldfs2ua( pnu4aetnir ta1lmte ieol()s2ur(o3iu1ol nmiesas  Duru pou4alxomoctadfsDeauvont4aetnmfcoodlmD livi;s)s2uo(mpio4lptemfcsl(  2ua( oou0ole ifciyt mDrm(vsn() lenif io1fm   u s;()sruoxo nydalenlnciat) rtr(m nu0aex io3iyt mDrlu s u0texomfctydfm  aiei;( s2xoir3nu4op  mfvil(f Drrxmpnt4tpxo fctaslsDemu ont0tetnxr iy1lm   uvo;() 2toxm3iodal  lnvt () rtaum no0tpt  oeiadfa uau snu4aeermf3iytop ran i;() exoim no1ole mfvi (fartax  ;o4teeo i3iatfsDeauvsnu)arxnmo todfa rlivi s tetm(m nu4amen fvilt)artmx oot4oeeomfetytls rmnmonu0 rtnmoctydoaDrlnei s  2urir iy1llte ies () Dtrxroou0apt if3iyt m2ul( s t0alxoxf3tadfm eluei;t t2uoxo3ny1ameelietat)a2umxr ot0apen ociysfa2uauvo t)aleoxfcio1oa r nvi s0 rxoio3io1llenmfci (fs2trumpoo1tpxnmi3tydls rau s t0 etrio3oodfp rluvo;()trurxopiudll  livias) rrrxr ot1tpx io3iydfaDrmuvo;() exnircoy1fm e ieo (  rur(opoy1optelfet s sDta(rpno1aex  f3tasfs2uau pn(0arxrifcoodla r i i t0s2trir ny1omenlnvias sDrrx ono1tlt ifctydla2umuvpnt)altrio oa1oaDrlivo t)tetmxr oodamenlietlsfs2tru o;u4tlx ifeiytfsDemuvo;(4texnxocoatlmteli s (0srurio nudapenmnvt sfsDra(r oo1ope mi3ias a umu p;(0alxrifcoo1oaDeaueolt srurxopiudolee ncslsfartm(rp;o1tpto feiatfs umump u0trenxociy1lp  lieils  rxrim3ny1om   neiatfs2tmu  nu1ape  i3iatlaDul( snu4teeoxociodlpDe u olt seuoxo3iydal n fvtl(farraxmooo4optomocild mDul(vo t)alerxf3totlm  an o t0 rumxmpoo4omtemnvilt)srumu o;t4alt mi3iysfa eluvon(0altnxrciodopDe ueils teuo(opoy4lmt livt ( aDum(mo;t1ope ioetysfa2eaums;(4 rtoifcoatfmt ai o;(  2xo(r3iydlltn nvsat)aDurxroou4olxoiieiat mDel(vo;u)trtrmo tytfa r uvol()t2xrio3iydlle miei t  Drmur nt0apx ioctys m emu o (0tetrmfcta1la  aues;( s2xo(opou4olte nvs (  2rmxmo;u1tlxomfcildlm2uanvo;t)treomrcta1oat  uvs;t srxrio nu4lltnlnei s  2rr(rono1aetomociyslaDrlump;u4 ltrxo3ootfmte uvi ()sexriopiy1lme  ictas)aDtauroou0alxnmfetltla2eluvs u4tltoxrctadlp rlues s0 2toxr3ny4lmt liesa( arur(ro;u4alt ifciytlsDrmumo u) leomf3ia1faDrlues;() 2to(m3no1lmee neiasfarra( pou1oet mfeiltfm ua(vs u) exoxr ia1lat  nvo ()s2toimpoy1oltn fcsl()aDrmur ;u1apx  ieiys s2um(mon(4areoio3ty1oaD  uei;(0texo(r iudaltn ivslt)arrm(rono1tlt  f3iadlaDuln o t0 rerxf io1lm rlies t0 rxoxo3io1aptelics s) 2ta(rpoo0teeomfciytla2rl(ms t0teerxf ia1fpDeln ilt s2xmxo3oudlp emfvs s)sDumurpno0alenmocilslmDul(msnu0tlxomf iatomtrlnvolt)s2trim nydope  ieils)aDtmumo;u1apeo fetlsla2el(vs u)alerxf3oadomDeli s;t)s2xrxr no4ope lics (faDtrumpoo1tetniietls m2rmn p;t4 ltrmr3io1fmD li il(0 etmxmpnydlp nmnesls)aDurumo;t4olxomi3iydfs2rmumpnt4aeeoif3ia1fptrluvi s trxrim3oudlmt lfcs ( srrrxront0tlt mo3iltls rm(vo;u)trtnmrctotom rlnes;s0 rurim oudopenlieils)aDum(m ot1teenifeildla rl(mon() ltrmo3iadopDr nvo;t texoir3oo4amt  ics (f 2urxrp;u0apeoiociadls2ulnms t0trxrxr oa1lm  auvol( teuo(r oo4am   fvslt)artm(ro;u4oltomi3ilsfs2eau o (0 lenxo3iytomteanes ()s2uoxmpno4opt  ncsasf Dtmu o;t4aeenio3iat mDem( s () ltnxf iydlpDrli s ()srxoiopio1amtnlfeslt  2trurooo1tpxo ietldfs umn on()aleomo3ia1fmDr iei;(  2xo(r iudap emfviat a2trxm oo0tetoif3tlsfs2emums u)tlenir3ootlaDeaiei;()sruo(o ny1amte ivtltfaDtaxmpou1aex  ieiydls2uan pnt) rxnxf oatlpDrlnvil( texrimpou1amtelivsls) Dur( o;t0tet mo3ild s ul(mp;()arerxr todfmte i o t tetr(o3ny4ol n ivi tfa2rrx  ;o0teeo feildlm2rl(mo u0arenxo oydfpDeluvols0srtmxr3nu4al emieiasfartmumpnt0openifctltfsDelumsn(0arerioctotlmtrauvs t0t2xm(o3oudapee fcs t srtm(rp;u0aeen f3ild a2emn s () eermr ty1fpDe i o;t0srxrio oydaptnmfvtl( s2tr(mp;t4ape mi3iasls rmn o t0teerif ootlat anvo;()sruoxrpoy4lmtemfcia(  Dumur ;t1oee  i3iyslm rlu p u4teeomoctytoaD ln slt0tetoxo oydapee iciltf ruaur nu0aee if3iyd s ea( on()artrio3oadfa   ivol() 2umxopoo4openlici s) rum(r ou0tpx  f3tatfsDrmuvp;t)aexrmo todfa e n il(0sruoxrpiydlmee nvta( a2um( poo4tlxoiietadfaDul( p;() etnircto1lpDelnesl(0texo(opoo1lle miciat)a2tmu  ;t4tex mociyslm2ran snu4aeeniocoo1fpD  ueilt0 etmxrpou4amt mivtlsfsDtrx  ot1oexo ictydla rlump t0trtrmocoodomDe neol(0srxr(r3oodap nmncta() 2ta(ronu1aptn feiys a el(monu0altnirctatlptr nes t0s2umirpiu1ap nmics ( arraxm ou1oexoii3iytla ul( s;t)tetoif3to1omDeln slt0sexr(rpoo4lpte fvi (  2rr(rpno1oleomociytls rmums;t)tlxnmrciydopDrluvo s  2tmir oodom nlneia(fsDtax  nt0olxnmfcildfm2elnvp;t)tltrmo totfpte n ols0 rtr(o3iy1lp elivs t srtaumpou1altn fctyt m2emuvp (4altnif3oydfaD  nvi;s0t2xrxo3oydlltemivia(fsrtrx pou0oeen ociydfa umu p;(4artnir tatla raies ()trxmxm no1apte neslt)srrru  nt1ale mociasfaDumn p;t)altomo ia1oa  lnvolt trxrim iudlm emfci sfarrr(r ;u0tex mf3ilt s ea(vp;t)tetrxf oy1opD  nvo;t srxmxr3oo4ape mfeiatfs2rrx  ot4altoiiciltlm2emn s;u0tltoifciotfmD lies;t0seuoim nu1lptnlivi s  rum( o;u4olenmoetydfmDuanvo;(4areoir oy1fp raivsl()seumir3iy4opt mncsa(f 2umx  ;t4tpt iietaslaDrlumont4 reoxr oytlpt  neilt)trumxr3nudap nlncs (farta(m ;o0alxoii3tld s2rmnvs;u) lxnxfcto1lptr u sl(0srtoiopio1omt lfvi t)s2umxm ou0tlxoif3iat m2umn sn(4 lenio io1omDrluvi t)s2tm(rpou1optnmfct (fsDrrumo;o1openiietytls eln p;u)aetomfciy1fpD an o s)sexr(opoydomtelfci ( a2tmx pnu0texomietad a rmu p t0trxoif3ia1lm  lnei;()setm(r no4om nlneia() 2umxmonu0opxnif3tldfs2um(mo;(4artnif3oydop rai o (0trurim iu1ll n fei t sDurxrpnt1apxnifcilsfsDua(msnu)arenirctotoa rlivo ( srto(opoydopt mnctat)a2rax p;o4olenmociltlsDrluvs;u0 rxriocoydoaDeai o;(  rtmir ou1alee ncs t sDtru pno0olxnmfeiltlaDrmnvo () rtrxoctytoat au il(0srxoirpou1ameelncsl()sDurx ont1aeto fciytls2rmuvs () etomo3iy1fat  u o ( t2ur(r3iy1aptnlies sf 2tr( pou1oexo oeildfs ea( sn()texoxfctotfp eau i s  rum(o3nu4am nmfvia( srtax pou0olxnif3ilslaDrau p u4aetoxf3oo1oatr nvo;s setoxo oudlpee nvi tf Dumxr ;o1oltnmfciyt aDeau s t)aleomf oatoa r ueo s)tetr(o iy4al  mfcsat)sDtmxr ot1apxnifetatla2elu o;t4 lxoxf ta1fat  i i;t s2tmxrpou4omen fct t  2umxr nt1tpx  i3iyd m uluvont0trenmrcoadoa eli o ()t2xrxm oudll  lnci s)s2umu ono4optomfciad sDrm(monu4treomfcoa1fpDe nvslt0tetrimpou4al   ivia( aDtrx  ;t0ale iieiyd m2ulnvpnt4 renioctotla eai s;t0tetrim no4ol elfeiat sDumu  no0olxo iciyd a em(vp u) leoxfcoadoaDr n i;t) 2um(mpoydlptelnesat) 2raxrono1tltnio3ild s2emu pnu) renxr3ootlat ai ilt0s2tr(rpno4optnmfcia()aDraxmooo4opt iiciydfm2um(vo;(0tltrxo oa1fm rluvil()trum(r3oodope mnciatfsrtrx  ou1teenifciat sDum( pnu) exnir oa1lmtean i t srumxrpiy4omeelfeta() 2umx pou0alx mietlsla ua(mp;u) ltnif3io1lmteaivolt  2urxm3iu4ol elncslt)srta(m nu0oexniietatlm elu o;u0 lxnxrctytopDrauvs;s)trxmim3oo4lmt  ivs (f Dur(rpno1texnmfciytfmDeau s () ltrir tydfptelu o;()trxo(o3no4ol elfeilt) Dua(mo;o0alen ietyt s2ulu s;u)teenir3tadlmte u s;()teumirpoo1lltnlivsls aDrrxmpno0ole if3ilsfm2umnvs u4 leoir oadomD li o (0 rum(rpou1omen fcsas  Dur(r ;t4aex miciatla eaums u4alerio oytomD aiesls  eum(m3nydape mfctl( srumum ot0aex mociyslm2ea(mon(4 etrxo3oodlmt  ivo;(0sexm(opno1om n icsl()a2uax  ;o4aeenmf3ilt s2eau p u) rxoiocoodlaD  uesls)truoim3iy1omen ietatfsrta(rp;o4aet  fetaslaDeluvont)trxnmr iydfptrlu s (0s2xmiopnu4ol emietat srtm(  ;o0oeto f3iytfsDran on(4 lenir tadfm eai ils sexrxm3ny1lme mfcs s  2raur ;o1tlt  f3ils s rln o t4 renmr3iotlatr uvi (0setrirpoudlpe mnvsltf 2taxmono4tet mf3tasfs2emnmont0aeenio ty1oatelneolt)sexoxrpiodol nmfet t)s2tmxmoou0oetnif3tldfm eauvsn(4 etomf3oa1op ean s;t0t2uoxo3no4llenmneta()a2rmu ont1alen ocilt sDemnvonu0trtrir iy1fpteln i (0trtoxo3oudlle mfesl(fsDrr(rp;u0opxo fciad s rm(vo t) rerif3tatlpD  ies t0 2umxo3iu1lltn icsa(  Drmumo;t1oet ii3iysfs uanmon(4altrifcoydlatrlues t t2urim iodomenlicil()aDuax pno4aeeoif3iltfa um(vs () etrmfcia1lmD  neil(  2umxm oydamtelnvt (  2rmu  ;t0tpenmoeiasfm rmuvonu0 lermf tatlate uvs;t0 2umxo oy4ap emfciat sDtmur ;t4tee  ocildlm rmu p u)teenxfcio1op rau i;s)sexmxm3oo4ll e ics sfsrua( pno4alen oeiyd aDraums ()treoif ty1fa  ai s;t)t2uo(o3oudaleelict tfsDrr(r nt0opxo o3tldla2rl( p;u)aeeoxo oodlaDe i i t  etoxm iy1ole mfeils) 2umumono0alxo icildfsDrm(vp;u4arerxr3iy1fmD luvs t seto(r io1olen nctat)s2tmxmp;u4aexn i3iadls2rluvonu4tlenio3iotla e ies;s0 rtoxm3oodome lfeil()s2uru  ou0tlen oetldfs rm(vp (4 lxrxr iadfpDeaivs;t)tetr(o3iudomenlneiatfs2uax  ;u0oexn oeiysla2em( p;(0trenmfctatopteai i (  2toirpnodam  lict (  rra(mpnt0tpen oetysla em(vp;()altomo3oatlaDran s;t0srxm(m iodopte ivias)s2rmur ;u4aet  ieiltls el( sn()alxnmocto1lmteli sl(0 rur(mpoydal e fcsltfaDumx pnt4alx ifeils m emuvs u) lxomfciy1la   ues t0 2xmim3iudlp elfcsat)aDuax o;o0tlen fcils m ulumo;()altrmr3tatfpte u ol()srtrxm ou4opeemies s)a2umu  ;u0tlxo f3iadfaDrm(mo t4 ltomo3iatomtraues ()texmxopnodol n ict sf rraumpnu4apxomieiltfs2emumon()trxrio3tytlpD lnvo;s trxoxrpoy4al elivilsf 2ur(r ;o1tlx  fcildlaDuln o u4artoxrcootlmt  u s (0srxoio oo4al  lfesa(fs2rr(mono1optnifcild s rl( o () renmr oo1lp eauvi;( trtm(m3iudap  mnetltfarrmxm oo4oet moeilsfmDrlump u)alxnifciytoateli i;(  eur(rpny1omenmfcils srurum no4aeto feiatfa2rm(vo;t)altnir3iatlpt  n i;t)texoxrpou4al nmicta(fs2uaxmoou4opxomfctld a2eln p (0texomrctotop rlnei;() rtmiopiy4ame lnvi t  Dur(mo;u0olxoifeiysla emuvs;t4treoir3iydlateanvs ( s2uoxm io1lm emivt s sDrmurpno1tpx mfciytls rmn o;t)artnir iadfpDelu s;s0t2xm(o3ou1opeemiesas) 2uru p;u0oex io3iad m ua(vp t4aetomfctodlp  aieo;s)teuoxmpoudal e ivia(f 2rr(r no4oleo ieiaslaDulu s;t)tltrirctytom eanes s)trtrxo ny4omeelfeia() 2uau oou4tpxoioetydfs2rlu p ()alxoir3tatlmD anvo t  eumirpiodllee ietl(fsDtmu pno1aexo ocils a rm(vs;()tleomr totfmDrluvi t)tetoir3ny1altnmnctasfs2trx p;u4tpx  feiyd s el(mont0 exoxrcta1late nei s)seum(m oy1ole mfei ()a2tm(mpno0tlenio3iys mDel(vp;(4altnxr3iydfm rlneo;s)trtoiopiydoltelfvtasfaDra(root1apeomietydlm rm( s () ltnmf tydopt  neo;(0seuo(mpio1olt lietltfa2rr( o;o4tltnmoctlslsDuan p;(0alermocoadfat lieslt s2xm(r no1ape mfeslt) rrau pot4tpxomi3iltfm umu snu4aetnmo tydoaDrluei;(  eurim3oo4lp emict tfaDtrx  nt1tltoio3iys s2rmu sn(0tlenmr oytfpt aivs;()srtm(o no1lmt mnei t s2raxmo;o1ale mfeiadlmDrmnvsnu)teenio ta1lp eluvs;()texoir3oodomtelivt t s2ua( ono4ole io3iaslsDra(mo t0arenxocto1fpt lnvs;t0s2uoxo iudamtnlfvilsfs2um(m ;o4opt  fciad aDumnmo;u4alxnxo3tadlpDeauvo t setoxm3iodlp nlietlt)srrrxronu0aptomo3tat a2elums (0trtrio ia1omt livil( srtoxopoodopenmfeia( aDua( ont0aet  oeiltlsDelnmon(4 ltrxocoadfateauvo;t0 rxr(r io1lmtn fctl(f rtrxr ;t4olxoif3ils sDum(vo;()alxnif ia1fp raivs;t)srtrim no1lp nmfct sf 2uaurooo1tlx ii3iltfsDem( o u) lxrmocty1opD aieo;s)srtoio iy1ol n fvs tfartmumo;u1apeoiictls mDumn onu)tltrio to1fmt  n o;s srurxo oy4omeelnciasfa2rrxm ;t0oltnioeiysfsDra(msnt)arxrmr3tadlmDr uei (  exrio3iu4apen fetat) 2umxmpnu4tpt  i3iadfm umuvp t4arxoio3iydoaDr i o;t0s2xoim3no1lptemivt (faDrr(ronu4tlx  ocils a elumo (0teeomrciydomD lu i t0trtm(m nodomeemicsl( a2urxm ;t0aex mieiad s2rm( pnu4trtnmrcty1lmtelivi t)tetmim nu4aleelneilt aDtm( ono0texomoeiatfa emumo;t4tlenir tytop  aueol(0s2uo(o oodomeelnesa()a2tmur nt4alxn feiyd m uanms ()tlxoxrcoadom  aieo;( trxoxm3oy4ap  lnetl()artm(m nu0apeoiiciydls rl(ms u0tlenxfctytom eanvi;t0 2uoxo io4al elivs sfsDrmur ot1apxnmf3tyslm2el(vs;t0 lerio3ia1fpDrluvi ()sruoxopio1alt  ieta(f 2tm( oou4aptoif3tldfs2umuvs;() rtoio3ootopDeanvs;( teuo(rpiu1amte ivsls)artmx  ;u0aet  o3iyslmDua(vo t)alxoif3iatlp rlu o (0 etm(rpou1ol e fcsas)s2rmump;o4oltniieiyd s rmuvs;(4texoxr tatlm eaies (0trurxr nudolenmncia(fsrraurooo4aptomocilsfm rm(vo u) reomfcootfpD lnesl(0sexo(mpoo1olenlictlt)arrmumont1teeo i3iad aDemumsnt)arxnxf3to1latrau s s0s2umim ny1lm  lfct tfaDtaxmpot4aeeo o3tlt a uau pnt4tlxrxrcootfaDe ies ()truoir iodlp e fvtas s2rmxrp;t1oex ifctysfmDeaumpnt4artoif iodomDe uvi;( srtr(o3ny1lm n nci tf Drmur nt4tlxnmi3tlslm2elnmsn()tleomo3oa1omD aueo (0tetm(o3iydlme  iet t)arua(  ot1oeto ocild mDea(vonu0 ltomo tadfmD  n o (0sruoxo oudam  lnvi ()srrax  ;o1tptn fciat s2umumsnu)texnmf3oydlp e nvs (  2tmxrpiydlltelfviatf rtm(m ;u4opeoif3tltfa2em( o t0tlxnxr oy1oat auvi;t) euoim nu1ll  lnctatf 2trxr ;t1oet  fctys m el(mo u0 leoir oa1lpteai olt) 2trxopny1lmtn nesl()a2tax  ou1opxomfctls m2ea(vo (4tetnmo3tytfpDelnvs;( truoim iy1lpt mfes s a2um(rpno1oex mietyslmDeluvp u4 renmr3iatfm e neols0sexrir3nodam  lietas s2tmu o;u4tltomoeiytfa2ea(msnt) exnxr tadoaD anvi ( t2urxr3iy1lptemnet t srta(rp;o4aexn f3iad s2uauvon(0treoifciydfmt auesls  eur(opno1lpt lfetlt artaxm nu4oee ifciyt a2ra(vonu4aleoifciy1lpD aueil( texrxr3iydopenlfvtat) Dtmxmonu0texnmi3iadla umnmo (0aeeomrctadoat lueol()setoxm3nydapt lfct ()s2rru p;o4tpeo i3ias a2rm(vo;u0altoif3iotopDr n s;t srurxr3nodap  mnvs s aDumu  ;o4aetoiicias m2ra(ms u)treoio3to1latrluvi (0trurxopiy4lm n ieias  2umu  no1aetnmoetytfaDuan on() lxoif3ta1la ranvo s0sexriopny1ome lncs (f rtrxmpnt4oeenio3iltfsDumnmp t) etnmo3tadfmte u s s0t2xoxmpoo4oleemnci t)a2ta(m ;u1tptniietadfmDua(msnt)trerxr totlpD ln s;t setmxmpny1lle  nvsltfs2rau pnu4apt mictatfm2um( p (4aetrxfctytom  luvo;t) etrxrpnudom n ics s)a2ta(rpnu0tee mictlslsDeau s;u4 lxomrciy1lmDe nvils s2to(o iydolt  ncsatfsrumxm ot4apenmoetldfa2el( s;t)altrmo ty1fptelies s0 2xm(mpny4lltn fvsa(  rrr(r oo4olxnio3tas a2ulnmp u) eenmf iytlp raneo;(0teum(mpio1apt lfcs ( sDrruront1oetnmietadla2eau p (4 rtoir oydfm raivilt0 rxrxopiodlm nlnvia(fa2raxro;t4alenmietlslaDul(msnu4tlxrxfciydfpte ieol() rxr(m iu4lpt mncsls  2tr(mo;t4tee ii3iyslmDrmuvpnu4artrxo3oodfpte ies s0s2tmir3iy4lmenlnet () rraxm ou4olxnmictys s2umnmo t)trxnio3iatopDrli ils)t2uoxm nydol  liesl()a2tmuroot0opx  iciysfa rmums;t4 rtnxf ty1fatrli o t sexrimpoo4ap   fcsa(fsrtaxr ;t1apt mociadlaDemuvo;(4aetrio oadoptraiei s0t2uo(mpno1opt lnctls)aDraxr nt1apt mociyd a umnms;(0 eeoxr iotla eai o (0texmxopiy4op emnvi () ruaumono0optn o3tysfa rmnmpn(4 renxrcoo1oaD  ivi ()trxm(m nu1opt lict sfsrra(rp;u1oltniiciydfa2ulu on(4trxnircootfp rauvi (  2xm(o3nu4llenlivt t a2tmumonu0altoioetatfa2uanms ()tltrxo3iy1lpDelneilt0srxr(r iu1lmenliet t)aruaumpot1tpt moeiatfa2rauvo;t0 lxniocoodfpDe uei;s0 rtmir no1omtemneslt sDtrx p;o4aptomi3ilsfa uln ont4tlxrmo oytom  lneol()teto(m3nu1ole  ncs (f 2ur( p;o1openii3iaslm2elump;(0 ltrifcoodlmtranvslt0t2urxr3no4al nmict ()s2um(  ou1alxomociysfs2rlu s;(4tetnio oydlmDr nvslt)s2xr(m3oy4om nmneia(fa2taumpnt0texomfeiyslmDuau p;t4tlerio3iadfp r nei s  etmimpoy1lltnlnvsa( arumuro;t0aetnmi3tatfs2emn s u0artnmoctodfm  auvs;t0s2tr(r nu4ape mieslt sDumum ;t0tpe mi3iytfsDem(mp (4tetnxf3oadla  au sls0texo(r3io4lmt  ics s) 2rmx  ot1aptoif3ilsla2um(mpnt)tlenif oytfpteli il(0texmirpiu4olt  fcsa( artm(rono0oltnmiciaslm el( o u0aeeriocoydlpt  iei t0t2um(mpiudam elfeslt sDtmxrpot0oet miciltls rlu s u4 reoxr3iytfateluvi t0sexmir3nudape  fvsls)srrrxmpno4alxnif3ilsfaDel(monu0alxrifcoadoa rlnvsl(0trtmxm oy4lpeelivs tf 2rrxmpou0oleoio3iad sDuan o u0tltnmociotfaDeau i ()trumxo3oo4ale  fci (  Drm(rpno0optnmi3tys mDel(vpn(0alxrxf ootla eauvo;( t2um(mpny1ol emfct s) Dtmurono4ape  i3iaslmDemnmo;u)aexrioctadlp elnes (0s2umimpiy1al  mnvilt arrmumpno0ole  fctls aDranvsnt4tltrmfctadlp  lueilt  rxo(rpiy1op nmietasfarrrxrpnu0oet moetydfa2el(monu)altnmr3oy1lm rlivi t  rxmxm3oydll  liei sfsrtm(mo;t1aex mf3tadfa2um( s;t)texnxr iotfaDeluvolt srxmxr3oy4ol  micil(  2rm(rp;u4aetoii3iytlsDul(vs t)tlenmf3iodfpDranvilt)texmim3nu1ole  fci t)aDrmu  ou4optomiciyd s eau snu0altoxr3oytom eaneo;s0sexm(m3oy1lmt licsls  Duru p;t4aet mf3iysfmDelnvs;(0arermfcoadoptrauvi;()texoxr iydome  fetls  Dtru  ou4alxo f3ildlaDelnvs u)areoif iatfptrluvo t0 rxoxmpiydlle  iesl(fsDua(r no4olen icildlm emn o;u0 lxoifciatfat luvolt)setoxo oodom   ivsls  rtrumonu1aeen f3iysla2ul(msnt0altnmfciodfaDr nes (0 rto(r3iu1al  lnetl( a2tmxmonu0oleo oetatfs ra( onu0 eerxr tydoate n s;s0sexr(o oodomenmivtl(f 2tmur no4teto ociytlsDrmu pnt0trtomrcoatlpDr uei s)s2xriopou4alt lieiat aDur( p;t1alt ii3iyt m2uau p;(4 rxrxocoytfaD aivils) 2umiopiudlm elivia(fa2trxr nu0oexniictys a rlnmsnu4tltoio3ta1fm r i olt)trxrxm3ou1opeelictltfa2tm(mpot4alto feiadla2ulumonu) rxoxf iodlpt  nvslt0srur(m3ny4lptelnetls a2trumo;o0tleo o3iat sDel( o;(0teerxr iatfmt ln s t0trtrimpou1lp   icsa(  2ua(rpnt4ape mi3tyd sDrm(msnu4aeenxr3oa1fmDran s;t)s2xm(m3io1ll nmivsls)srtr(mo;o0tlx ifeiat a2raumo;u)arerirciotoaDrlivs (0trurxr3nu4omtemncs sfs2trxroou4tle  oeiadlmDul( p t0alxoif3tadom e uei t  etoxmpoo4ap elies t)srtmumpno0oeenmfciyd s2eluvs;t4trenxf3ootfptrai o t  rxo(r3oo4lltn nvt sf Dur( p;u1oexoiiciatfa uaumo u) renio3tadfateanvi;t) eumim3oodlp  lnvias)s2rru poo0aeenifctysfsDrl(vs t4texrif oytfp eauvo t  rxoir ny4aptnmfvs sf rrrxro;o0tpeomf3iaslmDrlnvon()artnmfciotfm e u o t0 eumxr3ny1lp  lieia()s2rrx  nu4tltniietlslaDumnvp;t)arxnmo3oy1lpDr nei (0 2xm(mpoydlmen fci tfsrtau p;o4teeoiiciadfm2umnvs;t) exoxr oadfmDraivo ( s2uoxm oudaleemnvsasfarumum ou1olxoioeiad a el(vsnt4 eeoxo tytfpD anvilt0sexrxm3io1op nmfvsls  Dtaxrpot4ope moeiatfa umu pn(0teenxoctatlptranes t) 2xr(m nu4alte fcil( s2rrur nu4tpxomictlsfa eauvpnt0 renxr3tydfmDr ivo;()tetr(mpoydlltn nvtlt sDtaum oo0teeomoetatlm2emumo;()artoxf to1omte ivi s0srtoxmpoy1ale mfetlt)aDumx  nu4alxnioeiyt m2ean on(4 rermo3iytlptr uei s seuo(r iodll n ies tf 2rmu onu0tpe mfeildfm2em( p t4aetrmo oa1opDeaivs;()tetriopnu1lm  lneta( sDtru  ;t1tet  o3iltla uanms () lxnir iodfp r u o ()teum(o ny4op e nvsl( a2rm(  ot0tptoioctlt s em(mon(0 reoxfctatlmD  i i ()seuoxopio4lp   ivta(f Dua(r ;o4tpen i3iatfa2r
\ No newline at end of file
@@ -0,0 +1 @@
+i sls0 exo(o oy1aleelies tfa2rr(moou0apenmfeilsfa emn sn()tetrmrcoy1fmt ln s t)trtm(rpiu4ll e nvt (fs2umumoot4oeeoiocildfaDrmnvo u) rerxf3oatoaDeai s;s s2xmio3oudop e icta( a2tm(mp;o0apx  feiydfm2el(mo (4trxniocoatop r neols0texmxo3iudllenlncsa()a2ta(r ;u1tltoioeilt aDul(msn(4 lxoioctydomD li o;() exoim oo1altnlfcs tfsrumxrpno4tpxoio3tasfsDrm( pnt4tlenifciydoaD  uvslt srxrim iy4omeemfei tfartau o;u1teenmf3iyslmDumumont0 ltrmf3ia1fptr i o;s trur(rpiu1lle lictlt s2raum ;o1ale ifeiad a2emnvsnt)areoxo3to1fpteli o t s2uoxrpoudolt  fesl(fsrum(r nt0tlxnmictydfs2eanmo;(4altomr3tatfmDr uvs;(0 ruo(o3nudamte ncsat)sDtm(rpoo1aeeo f3iadfmDeanvo (0 ltrxocoydomtr ies () euo(r3ny4om nlfvtat  Dtmurp;t4tlt mfcild a eauvs;(0altoiocio1fmDe ivs t seumirpiydapeelnetlt  2rr(rp;t0tlenmf3tatfsDemu s;t4aetnmf3oo1fp rlu o;( srxrimpnu4om  mncs sf rrrxrpoo1aleo i3tys m2uanvp u)teerxfcoydoa elues () 2uo(m3iu4altemfctl(fs2urx ono1oetnmo3iadlm rlnvo;()tleomr iatomtrlieo ()t2uoxm3nudale mivt tfa2urx p;u0aex  f3iysfm2uan sn() reoif iatlaDrauvil( srxrxopoudomt lnesat)sDua(  ;t4opeo fcias a2el(vs t4treoxfciy1laD  ivol( sruo(mpnudam   fcia( arrrxmpot0texoifciysfmDelnvsnt0alenio3to1oaDr i ols)trxr(o oudlmt  nctltf Drmx  ;t1tpe  fciydfa2eauvs;u0altoiocia1omteanvslt) rtrxm nudlmt liet (fsDumxm ou4oeto fetytlsDean snt0altrmf ta1opDrai sl(0srurio3nudomtemnvtatfa2uaxr nu4ole miciltfa raump;u4 eerxo3ty1opDelivsl(  exrxm3oo4lpt lfviat sDtrx ont1altnmictldls em(vs;u0 lxnmo3oodfaDelnvil() exrxm iu1om  mivta(fa2um(mp;o1tptnmo3iyd aDelnvsn(0trxrmocoodlaDe ivsls  2trio3oo1lm elfet s  Drmxr ;t4oetnio3iltfaDul(mp () ltomr oytfmtr ieo;t)srxmxm iy4oleemfviatfa2rr(mpnu1texo fciydfs2um(mo;(4 lxrir3oadfmtelu ol(0 2xoimpio1alenlieias)a2urur ;u1aex  fciydla2ea( p;u0arxrxfcta1laD  i ilt)teuoxr oy1ll nmiei t)srrr( pno4texo f3tyd a2emuvs t0 eeomf io1lmDelivols  rxo(r3nu4amtelieia()a2tr(  nu1tlxnmoetydfs eanvo;(4alerir iy1lmD auvs s0tetr(r iu4ll  mncia(fartrumooo0tlt mieildlaDem(ms;t4 rxnmr3oatfat li s;t teuoim iydomenmfei t)srururpoo4opx ii3tldla em( on()aleoiocta1la e ueo;t)t2xoiopio1ape mfvils) rtrx onu0tltnio3iltls2rl(vs;u)tltoxrctydoaDeaneils0 2ur(opnodale mneiatfsDurxro;t4alxo ietasls rmnvp;t) lxnmoctadlptrluvi t)texoir3nydapenlictls) Dtru pou0optomictydfm um(vo;t) rxnxo3to1opDe i i;()srtr(m3iy4aptemncta( s2umu p;t4olt mi3ilsfmDuanmon(0alxomo3iydoa  lnvs s)srtm(m nu4ap  mfvs (f 2umxr ;o0aptn oetys aDrmuvp t0tlerir oatfmte ivi;s  exmxr iodlmt lfcias  rur(m ;t0apenif3ilslm ulnmo;t) etrxo oadlpD ln s ( trtm(o iu4altelfctasf Drr(monu0alxniietldfm2rl(vo t)aetnmr iatoate n o s0texrirpoydll  lnvtls  rta(r ;o0apeo fciltfm rm(msnt) ltnio3tadlmDe nesl()tetrxr3io1om nlfesatfs2rr( ont0aeenmfeilsfs2ra(vpnu0artrxf3oodfmD  uvs () rxr(opoy1alee icia(fs2tmxrpou4opx io3tldfa2eln p;u4aexoif3iotoptrli o t srtoxo io1ap e iviasf rrrxmonu0apx moetldfmDrlu s;t4 renmo ootoaDrli il( trtriopoy4omen fet () Dur( o;o0apxo fciltlm ulumsnu0trtrxr ta1fm r nvs (0srum(rpiodaptnmicia(farrax pou1optn o3iltlsDulnmon() renxfciy1fpDrln olt s2umir3oy4lptn fes ()arumxro;t4oex iictytfs emnvo (4tetnmo todfmDe ivs;(  2ur(rpiy1amtn icsas)a2rr(mpno0oex moeiltfm emu o t4artoifcoytlp ranvs;t tetmirpoudom nlicsas)aDum(ro;t0tpeomieilt m2ulumpn(4 rerir3iatlmDr ieo;(0t2triopoudll elfetl(f 2tr( ont0aleniictasfaDumu on()aeeomrcoadfpDelies ()trtoio no4aleelietls  2trxront0opt if3iys a2rm( pnu4trxrircoodlateaies ()s2xrxrpiy4opte fesatf Dur( pou4aet ifctat sDemnmsnt)texomo3oa1fa r n s;s  2xoiopiodol n fct ( srumxr ;o1openio3tasfsDul(vpnu4artrio iotlm eaiesl(0s2uoxm3ny4optemivsa()artrurpno4opxo ieiad a2ra(vpnt4 ltrxrctatla elivi;s0s2um(m3no4ope  nvtltf 2rrx ono0aet  ieiadla2emn p;(4 exnmf3iytlmteanvols) etmxo oy1al emiesas aDrmur ;t4olt  ociasfm2rmu o t) ltnmr ootlpteaiei;t0srxoxm3no4al e neiat  rta( pno4tltoioctyslsDemnmon(0artrircootlmDe u s;( seumxmpnodol  lfesat  rurumpno0aeeo i3iydla2rln p t)trxnxo iotlat  u i;t)tetm(o iy1ome  icil(fsDurur oo0oeto i3iysls rln o u4tlxomr3iy1lpDrluvs;t)trxo(m3oodapt  ncsl( sDtmur nu4ape miciasfm2rmuvs (0tleoxf3ta1lmteaneils  2urxm3nodolenlncsa( arrrurpot4apeo octad s rmnvo (4 rtomfcty1oaD lueo;t0srto(m3iudlmtelfetat  ruru p;t4ope mf3tatlmDemnvs;() ltrxf oadopteaiei s) rur(r iu1amte ietls)aDtau onu1oexoiociad a2ulums ()alxrmr oadoptrlu sl(0 2xrio iodom  lics ()sDrmx  no0tlxomi3iadls eau sn(4aetnir iytfpteluvo;( s2umir oy1llt  nvs (fsDtmurpno4oeeomf3tatfa2em( sn(0tlermo ia1oaD  nvolt s2xrxr3oodape micta( sDuaxr nt4alt  octat a2ulu p;()aexoir oy1lm r uvi s0teur(o3ou1omte nci sf rrm(r ;u0olx mi3iad a2umnmsnu)tlxnxr oadfmD  n s t0 exm(opou1amenlfcs sfs2umxr ;t4teeomieiydfm2rl( o;t0 exrxo oodoaDelnes t trtmir oydap nmfci ( aDrax pot1altnmoetltfm2rmnvo;(4 exoxf oydoptranes;t0s2xrxm nydalee ivt (f Drmum ou1alxnioctadla2umums;u4 exomr todlmtr nvs s0t2umim3ny1ll  mfcsa()sDta(roou1ale  fciat aDumnms;(0aetnxr3ta1fp  an s t)sexoio ny1omenmnvsas aDum(  ;o1oltniiciysfs eluvo;(4arxrmociatfp   u i ( texmxr oo1lltn fcta() ruaxm oo4tlxo i3ias m rmn ont4 eenio3io1fm  aivslt0s2tm(opiu4apt  fvs ()s2urur ;u1altomictat a uan pn() lxomrciadfp eau sl(  ruoxo ou4amt lnvi (f rrmxrpou0oex iiciydlm2ea(ms ()alxrirciy1la ranvs s) rto(o oydlpeemfct ()a2uru pou4opto ietldls rmuvpnt) exoirciodoa  ln s s  rumxopnudamen ieias srtmxr ot0oexnmo3iydfm2rmuvp;u)tetnio3tadla e n o;s)srtoxr3iu1alt miesa() 2raumooo4tee if3taslm ulums;u4tlxoir3ootopteaivo (0s2urxr iy1ll   nvias)aDrau  ot1tpeoioeildlm2ua( snu)treomrctatfmtrliesl(0teur(o ou1om  mictls aDtm(m ;o1apxniiciaslaDumumo;u) exomo3tytopDelnes;t s2to(r nydalt livs tfa2rrxmo;u0teto o3ilt m2ranmo;t0 etoif3tytfm   u s ( trtoiopnu1lp  mfvi tfs2rrum ;o1opx iieilslmDul(vs;t0 eerio3tydfmt lnvs;(  2xmxmpou4lpte ncs () 2taxmpnt4aexo ociltla2ra(mp;t4 rerxrcoatlatelnes;s0trxmir3iudop  livi t srtmxmpou1oleoiiciltls rm( snt0 renxo3oatlatrluvi;t0srtmio nu4lptnlnesatf Drru oot1oltnmfetldfmDrmu ont0altoif3iytom e i o s0t2toim ou1alt mfesas) 2uaum ou0opeomi3tys sDuau o t)tltnmr iytfmDe u ils0s2tmxm io4al emncsl() Durxmp;u1tex  iciltlm eauvo;u)tlxoir oydfp  ai slt  2umir oo1am  liviltf Dra(mpoo0apx mociys mDemumo;t4 reniociy1opt ln ils0s2xmxm3oydlp   fvtl() rumx  ou0opxomiciytlmDumn p;t4 eermo3tydfpDe ueilt srtoxm oy4ale livi ( srrmxr nt4tpxnif3iltlmDuauvsnt)alermr ty1fptrliei;(0sruoir3oy4amte iesas)aDur(  ;o4tle mfeiytls2rm( snt4 lerio oytomDrlies t0tetr(m3iudllen ict t aDua(  nu0olxn ociltlmDemuvs;t)alxnir3iotoat  uvsls)trxrir nydop  lnct tfa2tau oot0oexomi3ild a2el(vp (0altrxfcio1la   uvi;t  exo(mpoy4al  miviasf rur( ono0aeeniictlslm2el(msn(4aexnircta1fa ranvs t trxo(m nudalenmivsl()a2tax  ot0aee  f3tadla2um(vo (4 rtoxr3tatfatrai o;s teumimpoy1lptemnvtls sDrrx pnt0tpt io3iydlmDem(vo t4tleoio3oatfmtran il(  exm(r3oy4ape miesl( a2ua(  ou1aexo fciad sDrln p t0 etoif3ta1lptelivilt sexmio nodlm elfvsasfarra(ro;o0aeeoii3iys s2umumo;t4 rxoxfcoy1lmD lnvils)setrimpny1lm e neiatfa2rrxm ou1alt iietat sDumump u0altrmrcty1opD  i ol()seuoir iy1llenmnetls) ruaxrpot0aleoifeilsfs2ean o;(0trtoxr iydomt auei s0 2xoxm3iodllenmfvtls  2umxm ;t0aexnmo3tytfmDranvs t0trxnxr iodom eaues;s)t2tmxm3nudlp emfcta()aDumu pnu1opt  oeiadlaDul( p;t0aexnio to1oatrliei t  etmxo3oo4om nlneslsfs2urx oou0olxo i3ildlm rln s t4aetnioctotfa raivs;(0 rxoxo3no4am  lnct t) rua(rpnt1tpt ifeiatls ua(vs;u4 reoio3iodfat  u s t  eurir3iy4omen iei t aDuaumpou0oleoioetadfaDuanmp;t0trerxf ty1lmD aiei (0trxr(r oodolte netl()sDrmu ooo4aetnmictysfs emuvo;t0treomo3io1lat lneils)seumir3io4lptn fvslt  rtr(ro;u1optnmfeiydlm umnvsn()aeeoirciatfatr neol(0seto(r io1apenmnes t  rtmumo;u1texo f3iyt a eluvsnt4teerifctydlmteanvs;t srxr(rpny1alte iet t)sDurx  ;o1opxoifeiltls2ran p u)tetnmocoodfa   nvs (0trum(opno4om elnet (  rumu  ;t0apx if3iatfa2ea(vsn()treoifcoadfp e ueslt s2umirpoy1omt  ncsas  rrmxr ;t1tpenii3tlsfs2ranvs ()aetrxfcta1om  ai i t)seurir3nu4lm e iesls)aruaxmp;o0aleomi3ild aDuaumpnt) rxnxrciotfate ivi ( trxr(mpny4apenmfviat srua(mpnt1tlxomietadfmDumuvs;u4 eerio ty1lmD  ueslt) 2trio3iu4open nct tf Drrxro;t4aee mictydls um( s;t)alerio3iadopD aiesl( s2umxo oodopeemfvta()aDur( p;t1aexoiociasla rlu s u4 lxrmociatoate u olt0texmxr3oo4lmen ncsl(  Drru ont4tlen i3tltls2rlnmp t0 etrxr3iydfateluvs t trtoxopny1lme  nviatfsDtm(ro;u1tee miciltfs em(vo;() etoifcoa1lp r u olt0seuo(mpoodameelfeilt)srtmxronu0apxomi3tyd a ul(mo (0 lerio tydom   nvo s t2uoirpiodopt  ietat aDraur ot4optomociasfs rl(vo u)alxnxfcoo1lpDe ivils t2umim iydoptnmnesatf rtm(mp;o1olenif3ilsls eauvo;t4teenxr oo1oa r nvslt)seumxm iu4optnmfeta()aDrrxmo;t0ope  icilsla2rl(mo;u4aleomrctodom raivils sexoim3iu1lmte nvtls  2rr(r ;t0opt ifciasfs rm(mo u4aetrmociytfptrauei () 2toxopoy4lptn iciatfsDrmxm nu0tptomiciys sDelnms ()trxomo iodop r ieo;t t2xoxr3nu4olenlfci sf rrmumonu0tpt  f3ias s elnmont) reriociy1fmtr uvs s0t2uoio oydllt  nvsatfartrx pou1tpxnif3iydfsDrmu o u4teenir3ty1faD lnvs;t s2trim oo1amtelfctl() Drmxmooo4tetoiictat s rauvs t0artnxr io1lm   ivo;s t2xm(r3iu4al elictlsfa2ra(rpoo0aeto iciysla umn p ()texoxr tytop  aiei;()teuoxopiy1lmenmfvs sf rraumoot0oexomf3iys m uaump;t0artnifcoatlpt aieol( t2xrirpio4lptn ietasfsrrr(rono1tlx  ocildls rau o t4 etomf3iatoa e nvo;s0seuoxmpny1lp  mnesl() Drmump;o1oetnmo3iyd s umumo;u) etnmo3oatlatr nes;( srtmxm3oydlpeelnvt tf 2ta(m oo1alenif3tat aDrauvp;t0 lenxf iatlpDrau o t  2urio iydomtn ivt t sDtmxmpou4tltn ietatfaDum(vp;(4aeeomr3ootfa  luvi;t0t2xmxrpio1ol nlfeslsfaDtmxrp;t1apt ifciyd s2rmuvp u0 rtnxociydomDr i olt) ruoim oy4llteliesltfarrmump;u0apenii3iys aDuau p;t0 reoxo3oatfpDeaneo ()texoxopnu1olee fcsat  Dtax o;t1tpe ifeils aDrln s;t0 lerif3iytfa  aivs ()srtoxr3oy4ome mivt ( aDum(m nt0opto fciltlmDeanvp t4aeenxfctodfa raiei;t  rxoxopoydlmte ivil( arrru ont0tlt iociyslm2rmumpn() ltrmociotlpt aiesls0sexmimpno4lpen nciat)s2tr(moou4alxnmfciatfaDumumo;() reomr3oa1fmDraieil(0trxoxopny1lpen ict tf 2tm(rp;u1tpe  f3tatls umnmsnt)aeerxr3iadfmtelieo;t)srurir iu1ap nmfet t s2rmx o;u4openmf3ilslm ul( ont)tlxrxo3ia1fmD  ivs t  eumim3nydom elfcia()a2rax  ;o0alto oeildfa elums u)aeenxo3oytlp  lu slt0 euo(o3oo1ape  feiat  2tm(  ;o0oex mietldls rmu s (4 reoxr ootop e uvi;t0srxm(r3iu1ll emfct () Dtau onu4tpe mfetad sDulu s;u0tlenxf iydfmD  uvi t0trxoxm nudamt  ieias  rrr(  nu0tee mietlsfm rl( onu4tetnmf3oa1fpteau sls)tetmxrpou1ap emictl( arur(r no0olenioeiyt m raums;(0teerxrcoy1fp eanvilt s2xoir nudaltemnctas)srur(mp;t1oeeniiciytls2rmn s;t)tetoxrciytlmD  nvils  2xr(r3oudapeelnes tf rtmx o;t1tlxnmoctad aDelu ont4 eerio3oydom eln o;t seto(m3iudlpe mivil( srur(ro;u4teenmi3iys mDra(mo u4 exniocoatfpt luvi (0 exr(m oy4alte nciat  Dtax  ;u4olen ietasfm um( on(4 rermfctodfmDelnvils t2tm(m3io1am   fesltfs2raur ot4texomicildlm el(mo;()alenmr3todfpDrlu o;s)s2xrxm nydlmen iei t sDrrumoot1oeto fcilsls2el(msn(4tltnmocoa1omt lieolt0 eto(mpou1apen fvsa()srta( p;u4tptn ietlt s2emumo;t4aexoxf oy1omDeau olt)t2xo(m ou4aleemfvt (fartm( pno0alxo oetydfa2rln s;()alerif to1oat anvslt trumxmpnudame mnct s  Durumpnu4olxomocilt m2ulnms;u) rtnxo3oadlatelu o;s  etr(m no4lp nlnetlt) rtaxroou1apeoifetad aDra( pn(0 renmf3oy1lpteaivs;t srxoxr ny4lm nlnvs () Duru ono0tle mociltfs ea(vs ()alxnif3totomDrlneol(0t2tr(m3oydale mneia( aDraurp;t4tpeoiieild m2rluvsnt4trtomocto1lmD aneils) rtrio3oy4ol nmfei t s2taxrono4apxo fetlsfmDrm(vp;u0 etrir3iadfmt  i sls)trtoxmpoudap  miet tfa2tm(mpot1tpt ii3iltlm2um(vp t) eerxrctydfp e ueo ()sexm(o ny4ll nlfci t)sDuaxrp;t0tleniietyd aDrl(vs;t4artomo ty1oa r ieo s t2tmxrpnu4lm n nvslt aDtau pot1aet  i3iadlsDran p;(0areomo3todomDe iei s t2toirpiu4ap e fcsls aDum( pou0apeoii3tltfs2umums u0aexrmrciodlpt anei (  2tmir iu4lpe lietasfarra(ro;t1aee ioetlt a ulnvo ()tlerxocoydlmtr ivs ( tetmxopno1lm   icta(  Drmum no0tpe  i3iadfmDeluvsn(4 exrmr3totopDr neo;s0texmxo oudaptelfvi t s2tau  nu1teeoifeild m rmuvpnt0 lxrxrcta1oaD  i ols0trumxr3ny4lpe mnctlsf rrax  nu4openioeiytfm2umnvp;u4 exrmfcoatom e uvsls0s2um(o nodalte ncilsfaDumurp;o1opeo icilsfaDel(vp u0texnxr3iodlm raies s0teuoxo3io1lptn fes tf ruaxmo;t0tpeo fctldfs umumonu4teeomo iytfmD  ieolt)s2xm(o3ny4am   fvias aDtaum ou0tetn oeiydfsDuan s;(0 etomo3ta1om rauvi ( t2xmiopio1om   ies tfarraxront4olto octatlsDem( p u4 ltnir3oadlatraivi s0srxrxm oy4al emfeia(fsDrr(rpoo1aleoioeilt mDuan o u)trenmrciy1fpt  ivsls)s2umir3nodlm nlfctl(farrr(mpnu1alen i3iltfsDrmump t4tlxrxo3oydfptrln sls0 rtrxm oy1lm emfvta( a2ururpnu4apt ioeiyd m rlnvo u4treoif todfm r nes t)trtr(opoydll  mfct sfarta(  ou0tetoio3ilslm ra(vs t)areoxfcoodoaDe n o;s0texo(m oudlmt lneilt) Drr(mo;t0oleo ocild s2umu s;u)tltomf tadom   ueils srtr(m io1omte fei sfsrtrurpou1opeoifciydla uln o;t) rerxf3iatoa r u ils)texoirpnu4lp nmieia( srtru poo1aeenmociytfsDua(mo;u4teenmr3tytfptean o;t t2ur(o3oodomtn neslsfsrtm(mont0aexomf3tldfa ulnvpn(4trenircoydlmtraivo;(0 rxoimpio4om n fesas arra( p;u0tpenifetlsfs2umu s;t0artnxfcoatoatrln i t) 2xm(rpoo4ale  ictas)srrmx onu4apenifciyt sDrl( o;t0trerirciy1lp eluvi;(0texmir no4lmenmici s sDtmxmp;o0oetnmo3iys sDran pnu) rtomr ootoa e ieo;( trxo(m io1omt lnetls)a2tmurpoo0oetnifeiatfs2emu o (0 rxnif3oydfatr ieils0t2xm(o iodlpeelivsltfa2umu pnu4aee  ietaslaDeauvp (0artnxr iodlmD  n i s) rumxopoy1olen nvsa(  Dtrx  nt1olxnmo3tltls2rm(vp t0teenif3tytla raieols0s2xmxo3oo1openmfesltfa2rm(rpno0oeeoifeiadlaDean p (4tetoio iadla rai o;t)tetoim3iudlmtnmicsas) Dtr(r nu0apenif3tatlm uln p;() etnioctadfp e uei t)setoir3oo4olee nvsl(fsrurur oo0oetn f3iad m rlnvo t0aetrxf3iatlaD aieo;s0 exo(r iy4altnmfvtl()sruau p;u1tpt mf3tat m umn o;() rermr3oytom r nvi s0 2umxr oy4lm e icilt) rtmxm no0aex  f3ias a2ran pnt4trxriociydlateaieils0trto(o3oy4ope  netl()artrx  ot0oeto i3iysfm2uaumpn(4arxoxf ta1laDeanvils  rur(m oy4optn fcils) 2ururoou4apx  o3ildlaDea(vp (0teenmf3iatla rlies;t truo(rpno1aptnmfcils srurxm ;o4ale  feiydfm2rlnvo;t)aetoxo3oatfaD ln s s0 2xmim3no1op e ieiltf Dtm(monu4oeeniieilt s2emump (4trerif oadlaDr i s;s0srurio3nu1omtn feiat a2taum nu4oltoifciltfm em(msn() ltnifciytfmt an olt)s2to(mpio4ap  mies sfsDraurp;u0tlxomiciasls2um(vs t)trtomfcoy1lmtr u o t) 2xoxr3nu4aleemivsas)sDtmum no4tpt iicils a2um(vp;t)teenxfctatlpte uvs;s sexrirpny4al elnvt t artmump;o4aexn ociasfa2rl(vo;u0tlxoxf iotlpteau s ()setmxopnodal n fvsas a2tax onu4ole iociytlaDran p (0trtrmrctotfa rlu s;t)seto(rpoy4apenmfeias)arumxrp;t4olxoii3tadfm2rmuvp u4trxoxrctotop   ueo;s) etoir3io4openmnvi (faDrrxroou0oetn fciad s2um(vp;t)altriociadla  li ol( sruoio3oy4lp  mnvs (f rrr(mpno1aee mf3iasla ul( o;t0aetrmf ty1lm rauvilt)trurxo oo4ole mfesatfa2ra( o;t0tlen o3iasfmDuau o;u4 eerifcoydomD lneo () etr(mpnydlltn fct s)s2umu o;t0altomieiadla eauvsnu)aleomf iydla   ivo ()s2toiopny1lpt  fci t arua( o;u0tptnmicias s2em(vp;()aexnxocoo1omDeluvo t0srumxmpou4am n nvtl()a2urxm no0ole io3iasfa2ean pn(4 ltoxo3iy1oa ranes;s0tetoxm ny1al elneil()s2umxro;o4oleniiciydfs2ran s;(4 rtomf oa1fm  ln i t)srxrxo no1oleelietas)arumumpou0altn i3tytlaDrlump ()teenif3tatfmtrln ol(0t2umxm oo1apt  nvsl( a2rm(  nt4tlxo oeiltls2em(vo;u0teermf oa1fatrauvols)s2to(opny1lpeemieil(faruax  ou0tetnmfeiyt s2um(ms u)alerif3iy1fpt ai sl(0s2uoxr oydomt mnesl()sDrrxr ou1oex mociad m2rm(vp;u0aleoxr iodlmteli o;s  euoir3no4lptemivta() Dum(ronu4tle ifeias sDulu ont0 etnxo iadopD  uvs;s t2uoimpnudlme lncsatfaDrm(mo;u0olt iieiatlm2um( onu) etomfcoatlpte nei;t0 2uoxm3iodapt lies s  Dtmx  ;t1altoifcils sDul(vsnu)treomrcootomtrluvs (0texmim3iy1om elfesas s2rr( ont1opeoio3iydlaDuln onu)alxrxrcta1lmDe i o;(0teum(m iy4aleelivtat  Drr(mo;o4teeoioctltlaDel(msnu4tltnif3io1opt au il(0 etrxr oy1llee icia()aDtmx pot0aeeniicils s uan o t0 ltoioctotlm   uvo;s s2tmim3no4olte ivslt  rum( oou4aeto f3iydls2uaumpnu4tlxomr3to1om ranvo s) rtmxr3no1ame mneslt)arraxmoou0tlxn icilsfa rmn p u0artnmf oa1fp   uvsls trxoir iydlp n ietltfs2tm(mont0aexn octaslsDrmump;(4arxrmr totfa rluvs s trtrxm nudop emfesa(f 2rmu pnu0oeeomf3iasfm rmu s t4teeomocoytlaDelueo t0 rxmxopiu4ome  fcta(fs2rr( oou0texoifciltfa2ul( p;t) exomr3oy1oaDelues;(0setmxmpno1lmenlicil(f rum(m ;o0oeenio3ias m eau o u0 exomr3ta1oa r ieo;t)s2trxr3nu4olt mivtat s2urxmono1opxnmiciaslmDulnms;t) lerio3tatlaDr uvols trtmir3nu1lltn fes tf rra(r nt1tltnioctldls elnvo t0alxnmr3oa1lateluvo t) ruoimpnodlle mietasfs2rrxmont0oltomieiad s um( p t0altnxociotlm r uvo;()s2xmxm3iydapte netas  Dtrxmpnt0altn fciyt a2ua(vo t)artoif iadom  lies (0sexr(o iodam nlictasfarum( pot4openiieiaslm2ranvp u0 etnxr tytom eliei s  exoio3iydalt  fcsa(  2ur(monu0alx ioctydfm2rau o;(4trtnxo3oodomDe nvol(0 2tmio oodolenmnei t s2tmu p;t1ole  ictad mDuaumsnu) eerxf iadoate n o;() exoir ou1ap elnvs s) 2tr(  nu4oexoif3ildfmDeau snt) eerxf3tydlm   i i (0tetmxr3oodale  ies t) rtru  nt4ole ioeiadlsDrlnmp;t)teeoio3ootoaDelnei ()t2urio3ou4ap nmfeilt sDrr(moou4oexomf3iat mDrmu o;t0aexrmf ootfmt lnvs (0 etr(r ou4ome  nvil()srrmurpnt4openioetatfm eluvsn(0alenxo3ootfa  anes;t)srtrim nu1lm e icils aruaxmo;t0oexn f3tlsfm rm( p u4 lxnxf3ta1fp eanvo ()t2urir3iudlmtelnvs (  Durumont0apx  f3iydlm umnmp u4trtoif iytopD lu o;(0trxrxopiydllt mict tfsDraur ;o1tptoiiciat s2rauvsnt4 rermf3totfa  ln s ( t2toim3no4om nlfvtls)a2ta( oou0aetnii3tatfm ua(mon(0texrxr3ootlmt  n o;t0srxoxopiy1lmeemfvilsfsDrm( ooo0tet mi3tyt aDranvp u4tetomf oo1fm ran o ( texoir no4ame licias)s2rru o;o0apx  o3iytfa ua(vsnu) lxrxrciytom r nes;t  2xmxr3oydlme mncsas)arumuront0aet  o3iatfs2elnvo;(0altnircoa1fp elu o t0teum(mpoodomenmfctls  2rmx ooo1tltn ieias a el(vs t0tltrxf ta1fm  lnei;() etrxr iy4am  mfei t a2umu  ;u1aetn ociasfm ea( sn(4trxnif oatlmDr nes;( setmxo3ou1ap n net (f 2rr(mp;t0apt  ieiys aDuaumon()artoif oatoptrluvo;() rto(r oy4ll nmfvias s2tr(mo;u4ole ifeias sDrlumo (4alerxfcoy1oaD  ivo;t0trur(rpiu4ap elivs (  rtm(mpnt0tltoifctldfs rlump () eeniociodopD  uvols0t2xoxo iydlp elfvsl()srrruront1tltomo3iyslm2rlnmon() rerircoytla r nvo;t srto(m nudap elicsltfsDtaxm oo1altnifctatfmDra(mp u4trtnif iadfa  lnes;t tetrxo oudal   nesasfarurur ;o0teenifeils sDuan p;u0 lxomocoydla  auvolt) rxoxopny1om nmieta(fsrumx p;u0olxoif3iatfaDemuvs;u0 rxnio3iadoa raiei;()truo(o3io4lptelfci (faDtmumpot1tex iociys sDemuvont4 reoir3iodlmD livol(  rxoim3ou4om   ies sfaDtmum ou4ale mo3ilsfs2elnvpnu0 eermfciytfp e nei s)teuoirpiudomt lneiat sDur(rpou1tpx mf3iltfs eanvonu4 rxoxo3oadomt au slt trtm(rpiydap emfctas)aDtaxmp;u4oex mfetyt sDua(mo t0 etomo oo1fmDeai o;s setoxo io1llte iesls)srtaum ;t4opx mi3iasfm rmu snt4 lxnxrctytfaDe ivols srtm(r oodom  miesas)a2rrur no1tpx mfetys a2emu s u4arxnif3iadlmt lu o t s2trxo3iydoltn iciatf Durxmpou1aptomf3ildla2ulumon()tltrxo oatfm  lnvslt sexo(o iydlpt lncsasf Draumooo0aexomoeiltfa ra( p;u)aleomocoa1lpDeauvil( sexrirpiodameemici tfsrtr(mono0aexoio3iyt mDelnmp;u)arenmo iy1faD lu s;t  etmxo io1llt mnci t arrmum ;u4ole iociadfmDuanmo (4teenmo oodlaD anvs t0trxo(r3no4ame mncilt)artr(r nt1altoii3tatlm2eanvo;u0 rxoir oo1lateaivs t0 rtrio3oy1omeelnvta()s2um(mpnt4apeoio3iad aDumumo (0arxnxf to1optelieslt0t2umir nu4lpte fei sf 2trumpnu1oetoifetadfsDem(mo u)trxrxo3tydomtr n i;t0srxmxm3nodllee fct s)sDrm(rooo4opeo oeiydls2um( pn(0trtnio3tadoaDe u ils) rumxmpoy4lptemfvsls)a2tr(mooo0teen feilsls emnmsnt)aexrxrcoytom rlies t)sexo(o3no1llt mfvs (fsDurxmo;u0aeto fcildla ea(vp;u) ltnxocta1fmt li sls  rtm(o3oodlm  lics (  rumurpoo0oex iictydlm2uaums;t0trtomo totla r uesls trxr(r iu4lptelnvi s  Dtm( p;u4ole micilt m2el(mpn(4arenxrcoatfaDr u o ()srur(r oodopen netl(faDrrx pou0teen icildls uluvp;t) lenxf3iadfa   nvi s setmir oydolen fvsl(f Draxmpnt4ope iieils mDrl(mpnt4alxoir3oytfmD aiei;s0 eurir3oy1lm nmfcilt)srrr(r no0tpxoio3iltlm2umuvp ()altrif3iatlp e i o s seuoir3iodlltnlfeiasfsrum( o;t0tlt mf3iatfa2umnmo;u0 exomocoo1faDeln i;s  exrxo ou1ole  ncs (fsDtrumooo1oeto icias a2uaumo;u0arerxr3oodfmDran ilt tetrim io1ale  feilt  2rmump;u0tetomoeilt sDra( p ()tleomf io1oaDraiei;t0 2uoio3nydapeemfeilsf 2taurpoo1aetomfctydls2rauvo u0arerif oa1fmD anvols  etoxm iy4ame miesa()arua( p;u1oeeomicils s umnmpnt) ltoxo io1fatrlues;( teumio no1amtnlfcs (fsrtrumpot4olt  f3ildlmDrl(mo;t0aleoxoctatopt livs;s0sexrxo3nodam n nesl(faruru onu0aleomo3iydfs2umnvs;u) ltnxfcty1lpt  neo;s  rto(r3nudaptemici (fa2rrur nt0oeen f3iysfa2rl(mpnt) eeomfcia1lpteauvsl()teuo(o oy4aleemfeils  Drrurono0apenmf3ilt m elu o;()trxnir3iatla eaivi;(0srtrxr3oy4lp n neias) 2taum nt1oetnmi3tytfa2eanmo t) rtriociytfmteln ol() euoirpnu4om nmfesas sDtaxr no0alxnifciyt aDrlnmsnt)teeoxo3iadopteaneo t0srxm(mpoy4omtelnvias s2tr( ooo1aeeomocilsla2rmumo t)arxnio oy1omDr uvs (0sexm(m3oy4olt lfcil()aDrrxmpnt1apx mfeilslmDrau o u) leomfcoatopDelu ols  2xr(rpiy1ap nlnvt ( aDumxrp;o0tpxn i3ildla eaumo u4 etrxr iatlaDeaivs t srxoxrpnydlp emiesat)srtaum ;t1tpto oetydls2umn o t)trxoxr3oydfaD auvslt)texr(rpno1ol elnvsas aDtmx o;o4tpe  fcildlm eluvp t)altrxr3iotlaDraneilt0 2tm(o oo1olte fetat)s2trx oot0alxniociatfa2eluvp;t0tlxnxf3tatomt  iei s teumiopoydal  mnes ()a2umur ou1apxnmieilsls rmums;(0trtnxo iydfpD  u ols sruoirpoodap  liei (f Dra(  nu0aetnmfctltfmDemn onu0aetnmf tadfmDrauei;() 2toio3iodolenmncias) rur(rp;u1oeto iciyd a rluvs;(0 lenmo iodfmDr i s t srtrim ou4ope mncils)aDtrurp;o1opeo ieiad aDranvo (4aexomf iotfpDelnvi;()t2xo(o no4ol e fesatfsDumu pnt1aetnmoctldfs el( s t4 exnmr oa1opDr u i s)seumirpiu4apt mnetls) rumxmpnt4aleo oetldfmDua(msnt4teeoirctodoptrauvsls0 rto(opiy1alt lneslt)sruaurpnu4altn f3iyt a uanms;(0tetoir iatomt lu ilt) etrxr3nodapee fvi (f rtaum ;u4apxn o3ildfs um(vs t) exnxocia1oaD  i olt)s2to(r iodlpeelneiat) Dtaxrooo1oex  feiltla uluvp;()texrmr3oydlm raneols t2xm(m3nodap  lfcilt  rta(rpoo4aetomoctydla rl( pn(4tlxnxfctydfmt au s s0 rtmxo3nu4ame mnvs ( srrrxrpou1aexnmo3iadla raumpnu4teerxrcty1laD luei;()setmio3oy1ll  lfei t)sDrmum ;t4ale  ieiaslsDeauvo (4tltoxo iytoa   n i s)t2xrxm oy4ape mfesas sDururpnt4apxomieiadfmDua(msnt) rtoio3oatfa  ai i;t0sexoxr3ny1lp   netasf Drmx  ou1tex mfetld s2ra(mp u4 lxrir3oydlp  lnvsls s2tm(r nydome  fvils aDtmur ot4aeto fetydlm rmuvonu)trtoio oy1lpDeln s t  rxoiopiy1ame mies s sDua( ont4tlto f3ildfs eaumsnu0texomf3ty1fp   ieo t setrir3ou4opte netl( srumxm nu0aexn f3tld a ra( s (0 leoxf3oy1om eau o;s0srurirpiodop  mnvsa( a2tmuront0optniicilslmDem( o;(0texrxfcta1omDrli o s0sruoimpnydlmen icia(fs2ta(mooo0aeeoif3iatfa ra(vsnu0trenxr3iytlmte ieo;() 2urxopiydapenmivslt)arraumpoo1opeomoeiyslaDumnmo;t) etnxo3totfpDeanvo (0 rtmim3oo4aptn iesa(  2raumpnt4tptniietat a2ua( o;t)tlxrif iydlm r iei s srtm(m3oodlp   net s) rtm( p;o0ope mf3tad mDeanmo t4alxnircty1op   u i;() exriopiu1lpe mneils srtax  ot1open oeiltlsDrl(vs t4 ltoxf oytfaD  ivilt0 rxoxr no1lpeemfetl(f Dtaxmo;t4altnioctydfaDrau p u) eenmo tytfatelivi;s  rtoim iodomtnlnes s)srtrx pnu1tpenif3iysfm rmu o t)aetoif3oy1opDe u i;(0srxrio nydaltn feia(f rrau ono1tpeoiieiltfsDraums t0trxrxf io1fmtrln o;t0 2xm(m iodapenmnvil() 2ta( ono1oexn oetlsfm2rmnmsnu4aexriociadlm raues;s) 2uoxm3iu1om n net tf Dra(mpou1oexoiictysfm2rln s ()teeoxr3iy1lateaueslt0s2uo(mpiy1oltnmfciltfsrtrx p;o0olt  ociltfsDelu snt4tltrxocty1omDr uvilt) 2xr(m3nudolt mictas sDur(m ;u1tex mf3iyd a rmnmo t4alxrio oadlp ran s;(0 2tmir3no1omeemnvt (  rrru oou4teeomi3ild a2umu s;u4trtrir oa1la rlues s)t2xoxrpiy4ole lics ()aDraurooo1ope moeiltfa2ran o u4tleomr todfate n s;s tetoirpou1lmeelicta(fsrta(ronu4apto octyslaDeau p;t4aetoir3iatoatr nvi t0 2tmxrpoy1ol  liei ()srurur nu1apeo iciatla rlnvo t4aetrxfctodlmD au o;s0 exo(o oy4apteliet ()srrmx pou1optniociadfs rmuvpnu0 lxoxr3iatfm rlnes;t0 2xriopnodom elnvil( srtrx p;t4opt mo3iydfs2em(mon()aeeomoctotlaD  nei s)trtrimpny1alt  nvi (fa2ra(m ;u1optn fcilsls2rm(msnt4treomo ootoaD an s;s0trxo(rpiy1ll   ictltfaDur(root0alt ifeiyd s2uauvo;t4altnmoctytla ranvo t) rtm(rpoy1op n net t sDtaxm nu1aex  o3iadlm2rln p;t4 eenxr3iytlmDraneo ( seumimpoydoptelnci () 2ta(ront1alt micilsfa2rmu s;(0arxnmf3oadlm   ueolt) euoxm ny1oleelicil( artmu  no1tlxo fetltla eluvp t0 rtnmr3iadop eanvo t0teumxmpno1lptnmfciltfaDrau poo0optnmiciatfa emuvp ()aexrmf3iy1omDe uvo () exo(r3iu4ap   fvsltf 2um(r ot4apxnmociat s2rln pnu0 etnmfcoo1opD lnvilt t2uoxopiu4ol nmfcta(faDtrxro;t0altn f3ilsfmDrmumo;t4 lxnxfctadop  lnvo;t) 2xoxr nudopt mncs tfarraumonu0aex if3iat m2umnvo;u0arxrxf3tadfptrln s;()seuoxm iu1ape  ivtatf ruru  ;t1oeeoifctlsfsDrmnmpn(0trxnir ty1fat  uvo;s0 ruoxmpiu1amee ies s a2tau pou1oleo o3ias s eluvs;() etnxo3iy1oa  lnvi (  rumxopiu4olt  fesl() Dtru  nu4tlxo ietys s2ea( snt)artnif oy1fa e nes;t  eurxr3iy1llenlict (farurxmooo1altnmf3iytlm ea( p;t4teeoxo tadoaDrlnvs t  rxmxmpoo1apt mies ( a2tm( o;o4oltomoetatlsDum(mo;u4tltnxoctytoat anvo;t0teum(r3nu4lltemivsa() Dtmxrpnu0apxn f3iyd m rmnvpn()aleoifciodom  auvi t truoio oy4apt  icta()a2ua(rpnt0oltn o3iys sDrm( p u0arenxr3ootfp r uesls)s2toir nodlp elivtat  2tauronu4aetnmiciasfm2rln o t)arerif3oo1lpD  ivsl()srxrxo3oy4ol e nciat)arrrx  ;u4alt micias s elnvonu0tlermo oytfa r uei;s0t2xrxr oy1lm   fctlsfartr(m no4oeenmo3tltlsDuanmo;t0 ltnmrcoydfmteaneils0trurio3nodopt  nvia(  rumxroou4aexnmi3tyt sDea(vs u)trxrif totfptraivi t0 eurxm3oo4llenmfvtasfsrua(rpnu1altomieilsfm2eanvo;() rxnmf3io1fp eanes t0s2xrio io4ol nlfei s aDrrxmono4alx  feiltfa2rm( s;()aleoxr3oo1oaDrauvs s  2tmim3oodlptnmnvs s s2uaumpou4opxomi3iat mDum(vp u)alenmfcta1fmt anvi t0texmiopnydlpee iesl( srrauront0apeo ietldfaDrmn sn(0alxnmfcoodoptelueols  2toxrpnodllt  neiltf Dtmurp;t4ole mo3iyd aDem(ms;t4tetnmrciytfa eauei t0setmxmpou1am eliei ()artaxm ot4alt  oeiadlsDumn o;u0 lxnio3oatfmteln o;s sexrimpnu1omtn nesls s2trx pno1tle ifcildls elumont4aleoiocoo1fat anes (0seurio iodop n fcs ( srraur ;t4opt iicild mDulnvs;(0alxrmoctytfa   ivsl(0truoim oodam  mfvsat  rurxrp;o1oltnioeiltla2eln o u4tetnxrcia1om  aiei t) euo(m3iy1optemiet () 2umuro;t4oeen feilt sDeauvon(4trtnmf3tatfmDeanvslt setm(o iu4omtn nvsatfs2uaxmp;u1tlt mieildlm el( o u)aeenmf3oa1lpDeanvils trxrio3ou1oltelfeia( a2tmx pot0tet miciad a ul(mo t0 renmo3iytop rlivo t)sexoxo3nu4omtelnvilsfarurumpno0tptomf3iatfaDua( snu0arenmf3oa1lpDe uvsl( trtrxr nudll  mfci ( aDraxmont0aeeomociytls2rlu onu4 exrio oodoptrlnvs ()seum(r no4altnlfcils)arrrxmonu0oetn i3iadfsDrl(vont0 rxrxrcoa1fatrlneol()teumxrpnu4ope livsl(fa2tmu o;o0aetnioeiytlsDemu pnt) rxoif3ootfp  aueil(  rtm(o3oo4lmt  ivt t aDtr(rpoo1aetnmoetatfaDua( pnu4aleomr3iodla ean slt0texrirpnudlm e nesls)arrmurpno4tpen ictyd m2eau p t0 etoir oatoate n i;(0seto(r3ou4olenmnes t) 2umxr nu1tet iicilt sDrm(msnu0 exnio tytlp  ln s;()srur(rpno4lle mfet sfarurumono4aetn i3ild a eln o;(0tetomrcootfmtelnvsl(  rxr(m3ou1optnlieta( aDua(r nt0tpen fciyd a elu s;t4 ltomfcty1fpDeaiei t)teuo(o oudale lnvil()aDrm( pou1ope if3iytfs2rmn p;(4trxrmf3oo1op rluvi t)teur(rpiu1ll   nvt (f Dua(m ot4apeomoetlslmDeln s t4 eenxo ia1optean o (0 2tr(o iydlm nlnet s  Drr(  ;u4teenif3iad m uanvonu4trtnmfciodfate i i () rxmxmpiu4lltnmietl(  Drr( ooo4alxo f3ild mDra( p;u)tleoxo3ootfpteanvi s)t2to(m3nudomt livs sfa2ta(mpnt4tlx mf3tytlm ea( onu0artriocoa1oaDe i ols)s2uriopno1lm n ict t)aruaxmono0aetoioetldla um( p;u) lxoiocoo1lptr uvolt) rtrimpnodamtemfeil(f rtau  ;o4tpt  oeiytla2eln o u)aexrifcta1fp rluei t) rurio iydomtnmfei (faDtrx oou0oee mictldfs ulu p;u) lxnxr oatopDelu s;()s2urxo3oy1om  mfeil(fsDrru poo1oexnii3iyt aDemu o t4trtoirctydomDeauei ()teurir3oo1lleelivslt)srtmu pou0opxomoctas a2el(mpn(0 etnircio1opD  ivol() 2toim nu4am e nvsas sDtaxr ;o1tee mfctlt aDum(ms;u0 lenio oytfpD aueo (0 2tmir oydal  mneils aDrmu  oo1aetnmictldls ulump;t4artomo tadfatean s t sexr(m3ou4lptnlivi s)srurumont1teeomiciydlm2em( snu0alenmo3to1lm eaivilt0 exm(o3oodalee nvtl()a2umumono0alxo fetldls2em( snu0alxomocty1la rln s t  euoim ou1lmen icslsfsDurur ot4oltomoeiys aDulnms u4teenio iodoatraivi (0teto(mpio1lp   iei s)sDumxro;t4texomf3tysla2uan sn()trenmr oadlpteauvsls trumir ny1am e fei s) rumumont0aexniieiatfa2umuvp;u0 rerir oydopDean s;s) rtoio oydom   fvi ( s2tax p;o4oet  f3tas m2umu pnt4 rtnxr oo1op r i olt0srur(m3iu1lmtnlfci t srtaxr oo1tlx mfeildfs2em( s (4arerxo iadfat luvslt)teumxopou1am n ictl( aDtrx o;o1oet  oeiasls2eanvp (0arxoio oadlm   i s s)texrxm io1om   fei t sruru pno4oexoiieiydfs rmuvs;(0tltnmo3tytfp rln s (0 2trirpoo4lptemfeiasfa2urxr nu4alxn fcild sDuanmp;t0alxrif todlpt luvi;(0 2ur(m3oy1amt mfvi tfarrrxmono4openiieiytfs umn o u0aexrmrcootoat ai o;s) etrir3iudlpe  fcia(  Dtrum ;t4tle  ocildfm emn o t0 rxomrctatfmt aies () 2um(opiu1lptemneilt) 2tru ooo1tpto ociytfa2ul( p (0 exnxocoatfaDeai ilt texmim3oodll n fvsasfsDrmx pno1alxn fcild m el( ont4aeenmr io1latr uvsls0 rto(opio1omeelnctlsfaruaxrpnu1apt io3tytls elnvonu)arxrmr tadlmteauvi t) rxrxm3iudam n fvils)arumu pnu4optn f3tysla um(mo t)aexoirciodlmDean o t0 etr(m3iu1olt lfes sf 2raumonu4teeo o3iatfs2um( p;t) lxrio3iydlat  n s s0trum(r3iydop nmfciasfa2rmxm ;t1ape  i3iatlm uln snu4aeeoif iydfm rlieo ( t2xoxo3no4lpenlnetlt s2tmu o;u4aet moctys mDul( o t4 lxnif3iadfateanes s0s2trxm nydole mncsls aDtaxroot4tlxo f3tld a2umumsnu) rxrmfcootlaDr ueo;(0sexm(rpno1lpenmfciasf rrm(mo;t1texomietytfsDua(mp;u) renmfciotfa  livi s tetoimpoodal e fcilt)arumur ;t0optniicild s um( snu0trtriocoy1fmD  i o;s)sruoirpny4lp   ncia()a2tmxrono0aex ifeilsfm umuvp u4 eermrciydfp   n il()s2umxrpoy4lp emfetas)aDurum nu4aptn feiyd a2el(vo;(0 ltomo iy1fpD au o;s0s2xmxm3no1op n ncs t srrax pnt0tptniiciydlm2ran o;(4areoxrctadlmDeanesl(0s2xo(m ny4oltnmncias) rrr(rp;u4tlt  ocilslsDrlump u)teeomo ty1opD lieilt  etrxm oodlmeemiei () rumumooo1tlenmoetat m ra( o u0trxnxrciytoa   i ol(  eto(m ny4amenmivslsf 2umxm ot4apxomfetysls2umnvo;u4trerif3iotom rlivs;s) 2xoir3nudol n fes sfarra(mp;u0aptn octatls umn pnt0tetnxo oo1omte n i ()t2trirpoo4ol e icias)s2tax pot0aetn feiatfs ua(mp;t)alxnmociy1laDe i o;t0 exoirpoy4aptnmiesls)sDrru  oo0apen icilsfsDea(vo (4aetomf3iydlm   ieols0srurxopnu4amtnmnviatfaDtmu pnt4apxo feils a ua( p u)tlxnir oo1op e iesl(0 2to(mpiodlm emivil(fsDuax o;u0teenio3iatfm ul( on(0alxnmr oodfmte nes t trumir3iu1aptemnesa()a2rr(root4tetoifeiydla2eanvpnu4aeerxo tytomt aivo () rtr(mpoo1apt  fctls) Drax o;o4oeeoifeiydlmDelnvs;u)trxnxf3oa1optrau i (  2xrxo nudlme  ivi t  2tax  oo1olxnmietldla emu o t0 exnir3tatoa raivslt0t2tr(o3oo1ll n nesl(f rrmxrpnt0tptn o3tydfm um( s;u0trermr3oa1fm rln o t srtriopoy4opeemnvi s arrmumo;o4olxo octyd m eanvo (4trermf iodoaDean ols t2trxopou1altn nci t aDua(mo;u4aetomfeiad aDeanvs ()treomf to1lm eai s ()srtr(m3ou4aleelfetl(f Dtrum ot0opxoii3iad mDrlu s t0tltnmo oatfm r uvi;t)s2urim3oo4altnlivs t sDtmxrono1tlt  ieiytfm2eaumo t0 rxrmf3ty1opDeaieo () 2urxm io4lp nlfctl(fa2rr( p;t1tpxomictls mDulu pn()arerxf to1opte ivsl()trxrir nudolt lncslsf 2taxm nt4tleomi3iyd aDel(mp;(0tltomoctadopDeaieo t s2xoimpiodolt lnci (farumum nu4tptomfciys mDuau o (4 lxomf iydlptr ivo;s0s2urxm3nu4omenmfeils) rtrx oot4tlx iieiltfm umump;(4arermr iotfaD aueo;s)s2ur(rpou4omenlfcsl()artaur nt1tlx ifetlt mDrmuvp t4 rtomocty1omtran o ()srtoxrpny1op  mivs tf rrmxr no1aex mo3ildfa2uanmp (0 lxnir3io1op   nvol()s2urxo nudaltelneslt) 2ua(r nt4oet iieias m2rlnms;(4trermo oatlptranvi;s0 rtrir ou4amt mfvta(f 2taxm ou4tlxniociadlm elnvpn(0alenio3ia1lmD aueil(0trtmxm3no1lp emfvsas)s2rmum ;u1opeoifetytlmDuaump (4altrir3totfmteliei;(0setoio ou4lp nlivsasfsrtaxro;o1apxnioeiyt m emu snt)aetoxr3oy1lpteluvilt0 rxm(mpoudopenlfvt s aDua(mont4texnioeiatfm elu s;t)tlxomo tydlatrauvolt) etr(opnu4ame  feil(  2ua(rono0opxomociys aDeanvp;() reomrcty1fp rai slt) exriopoy1lmeemfvsltfa2tru  nt0aptnmf3ilsfs2rmumo;u)teeomf ootfmt liei s) 2xr(m nudomtelies t  2ua(  nt0tpeo o3tyslm2eauvs;u4tltrxr iy1fmt ai s;( trxriopoy4ape lfcils srumurpoo4tptn f3iytfaDrmuvo t)trxrmr3to1oa e u ol(0 rxr(o3ou1ome mfesasfsDum(m ;o0tee iieiadlsDumuvp;(4 ltnxf3oytla ranvi;s0 ruoxm iu4omeelieilt)a2tau  ou4aexo ieiyt s2umu ont0altnmo3oytlp r ivolt0trur(mpio4aptelfciat sDumum nu1oet if3iat aDel(vp;t)areoir oo1lmD ai s ( t2trxopnu4amte ncs t)a2rmx  ;u4tee mi3iatls elnmp;t0 rtomf3iytlaDr i ol( setrxrpnodop  lfvta()arrm(  ;o4aexo o3tlt s2el( o;t4 leoxo3iy1lpDe uvs (0trxmimpiudll nmivta(fsrumur no1tet if3tydla2ran pnt0teenio tadlmD  ies t t2to(opio4op e nvilt) 2rrxmo;u4olxnmi3tydfsDemumo t0tetrmf ta1oaDraueil() rtr(o ny4amt lnvtas)a2tru ooo4ole mf3iad a ranvsn()trxrmr tytlatr nvols t2urxopoo1lm n nciasfa2tm(ront0altnioeilslm rmn p t4 ltoiociadomteln i t)sexr(m3iudopte nviasfartrurpot1oetnmocilslsDuanvpn() renxo oadfa rlu slt)t2uo(o3ny1lpt miesltf 2ra(ronu1texo i3iydls ul(mpnt4 lxniocoadfp e nvi t0teum(m ou1op  mivt s sDur( onu1aexoifcilt a umnvsnu4 exnmf3ootlp   uvi;( trxm(r3oodapeemfvils  2rru p;o4teeo oeiydfaDumu ont4trxnircto1lm  aivo s)trtm(opiydll emncsa() 2umurp;t1altnmfetyslm el(mpnu4artnxf oytlpDeanes s) rumxr3io4olt lfvs t  rrm(mono0aetoiiciasls2rlnvp u4 lxomr3oa1fmDe nes s)sexmxm iu4apen feilsfs2raumono1olenifeiys a2ranmp ()altnmo iotlm eluvo t0setoxrpoo1oltnmics (fa2rrx o;o4oltomfciltls2rln ont4 etrif io1lptrau i;t  exrxo3nydaptn nvi ()sDumxm ;t1oexo i3iltfsDulumpnu4 exoio3iydfpD  ieo s t2toim3ou1lltn ict (farta(mpou0apto ocild a uan s;(4 exrxrctadla r u o t)s2xoxo3iudop nlivtas) Dtm(ronu1apxn ictas s rm(vs t)tetnmo oadlmDeanvs;t  2tm(mpiy1op nmivia(  Dum(mp;u1tee ioctlsfm em(mp u0tetnxoctydfpDelu ils s2to(opoo4opeemnctls  Drmu  oo4open oeiysfs ua(mpnu0alxrxrciytlptelueolt t2xrxr3io1ope mivtls) 2rr(rpoo4aexoifetatfs2eau o (4areoir ta1fat  n s;( t2tmim3io1opeelivs tfs2tr(ro;t4tle  ieiytfaDra(msn(4 reoxoctytfp   ivi;(0srxoim3oydomte fvta()s2tmxrooo0opxo f3tyslaDumnmo u0 ltrxrcoatfp rluvs;(0truoim ny4ame mnet t)a2rmx  ;t4tpenmf3tlsls rau s;u) lxomociotla rluvil(  etoiopio4ame mnet ( arururp;t1opx if3tadlsDrlnvo (0areoircoy1oa  aueols  2xo(m ny1oltn fvtas) 2uru  no0oleomieiyslm uauvp;t)trxnxf tydfmDeauvs;s0teuoxopnodolt mnet s  rua( oou0oex mfetlsfmDulnmp;(0aleoif oadop  luvsls) rumio3iudlmeelfctl(  rururoou1open f3tyslm rlnmo t)trtrxo3oatlaD aivil(0 rumimpoodlmenlfetls arrau oou4oexnmoctaslsDumn sn()tleoxrctadomteaiei s)srxoir ou1lpt lfvia()aDrrx oot4oltomfcilslm2rmuvon() eeoxocoodomDe nvsls0sexoiopiydop elfet tfarumuront1aet  i3iadla2um(mo;()aleoxocty1oa r u i s0t2uoxr3iu1oltn neta(faDrmu ont0oeeo oetatlm ra(vs;u0aexnirciotlmDrlnvi (  exm(m3iydlpt  neil( srrm( p;o1oetn i3tasfm2ea(vp u)arenif3oy1fmtrluvslt0trxm(m3no1opt mfci s sruau oou4altnifetys s2ulu pnt4aeerxo3iotfpteaneol()texoxm3ny1altnlictls aDurxrpnt0tpx ioetlslm rlnvp;t4tltnircto1op e u o;t)t2xm(mpiu1op emivsas)sDrrurpnu4tpt  i3iytfs elump (0altoxf tadfa eau i;s0teur(m oy1ole  fesa(f rrrxm ;o1oetnmi3tyslmDelnvp t0trxomf tydopt auesl(0teurir ny1lle lneias) rtaxrp;u1tptomo3iasfm um(vp;u)teermf ty1lm elivi s trumxm ny1opeelncilsfa2trxm nu4altnif3ias m ua(msn(4aetnirctatom eaneol(0srtrir3oy1om  mictasfsrurx p;u4optomf3ias m uan on() leoxf3totoptrlivs (0srxriopiudol  mnctat  Drm(r nu4tex iiciltlaDra(mon(0arxrxocto1lmD livils0t2tmxopio1om nmicils)artr(  ;t0olen fciytls2emn s;u)tltnmoctotfaDe ueo;()t2ur(m nu1oltnmicsls)aDtmxrp;o1alt  feilslm2um( o t4tlxnxocty1lp   u ilt0trtoiopiodlpe mict s  Dtmumo;u0tpe moctysfsDua(vs t4alxrxo3oodoatrlnei;s0s2uoimpiudlltelnviat  2rmu poo1apxo ieildfs2eanvsn(4 ltnxr3iytoat  i i (0 exm(opiudlptemivt (faDtm(mpot0opxnmoeias m ul(mo (0aeeomf3oodfpD aivi t  exrio ou1olenmncsat s2tr(mooo4aex mfeiatfs ea(msnt)alenmfctytfptr u o () ruoxr no4op emiciasfa2ua(r oo1aeto f3iydlm uanvo t4alxrxrcio1lm   uvi ( t2tmim nu1op nmiei sfsrtmum no4oetn o3ildlm2uau snt4 exrxoctytlate nes;t) 2xoxo nydom nlncs tf rrmxr no1olenmfctytfm uln s t4artoxr3iodfatrli ilt0trur(r3nu1lp nmieia() 2trxm ou1oleomoeiatfs umu o;t0aexrif3iatfmDrli i;s  euoxr nudam emies s  2tax oou1opxoiieiaslsDranvsnu4trtomo3oo1oateau i;t) ruo(rpou1omte fvsat  rtmxr no0tptn fciltlm emump u)arxnmfcoo1fmDe ies;s)t2urxr3oydomtelictlt s2tr(mp;u4tpxo f3iasfm rmn s;t4 eenmr3ty1laD aivs t)trxr(r3ou4ol nlnctlt sDtaurpnu1texnioctas a uauvsn(0trtnmo3oytlpDr uvi;(  2xmxr ou1am  liet (f rtm(  no1tpxnmi3iatfmDulnvs (0tetoif oadfatraueolt0tetrxmpnu1apt lnetlt) 2rrx p;u0tee mi3iydlm2em(vo (0texoxf oy1fm r u s;t0t2xoxm3iu1om e ict ( aDrmumpnu0tleoioeiadls2ra(ms;u)tlenxrciytlm  li i;() 2trxr3io1omt  nesa( sDtrur nu0tee  oeiytlm2ulu o u4 rtnifcia1fm  li ilt)s2xmim no1op e ivsl(fsrra( o;u4ape  oeilsla2rmn o u0altrio3ta1lpD li sls s2xm(r3oo1om  mieta(  Dururo;o4tpen i3iasls rlu snt4arxrmociodoaD ai i (  2uoxo3iodam   iesa(fsrtrum ;o4opxo f3iydfm rluvo;() rxoifctytfptranes;s0trtoxrpnudomee ncil()a2uaum oo0tpe  oeiasla eaump;(4alxriocoydom rlneils teuo(m3iudllte fesl() rtmx  ;u4aexn f3tad a2emuvs;(4 lermociodlat lnvo ( teur(rpnudaltnmnvi t srurumono0ape  ociltfsDuluvo t0texrir totlatranvo s  rxriopou1altnmfvia(  rum(r ;u1tltnmfetasfs2umumo;(4tetnxrcia1oat livs s  eurxopiodome lfet t) Draumpoo0opxnmocils sDranvon() exnmo3iatfatraues t0srxo(r no4am elncs (fsDtmxrono4aet mf3tydlm uln pnu0trenmfciydfa  auvs;s)seur(r3oy4alenmfciasfs2rm( ono1oetoif3iasls2eau sn() rxnmfcoydfpD lnei;s0 rtrim oo4op emnci sfs2trxr ;t1apx mf3iadfaDemu o (4 eenir iy1fat  ivi (  rtr(r ny1olenmfci s)s2uaur ou0aetn oeiatfm uanvs u4tleriocta1fpte nvi;( setriopno4lp n iesatfa2um(r ;o0oetomoctld m ranmp (4 lenif3iadlpt  nvo s0srxo(mpio4op nlfvsls arum(  ;o4aeeomoetysfm2em( p;t)trtomo3totlpD  ieo;s0 2toxr ou4lm nlivsasfs2raum ot1teeomfcilsfm2rl(mont4tlxoxfcoodfa  luei;s  euoxr iu4optnlfvi tf rrm(rpot1tltn oeilsls2um( s;(4artoio ia1om ranvo;t0t2trim io4openmnvsas srra( poo0oexnmi3tydfs rm( s;t)alenmf tytlaD  uei t  eur(mpoy4ol emfcs (fartau pnu4oee moeiatfaDrlnmont4tetnif iydlmD  ies s)sruo(o3iodomenlfcsls  2uru oou1alenmf3iysfa2ranms t0teenmo oydoat  ueo;(0 2um(m oodllee icil(fartmxrpnu1tlto f3iasfm um(mont0 etoxo3to1fp ranes t  etmxo3iudlptemicilt  2trump;u0tpe  fciltlaDrm(msnu4aleoxr3oodomtrlnvs t)sexr(mpny1opt mnet (faDtaxront4altniieiasla2rmn snt) rerxrcty1omtrauvs t0seuo(o3iu4ll elicil() rurxrono4tpxn ociadfsDeaumo u4 lxnif ta1lateauei s srxm(m3iu4lp  lics s srtrxmo;u1oexoioetys s2ua(mo u4tleoirctadlmtraneo;t)sexrim nu1olenlfct t arum(r nu0teeo f3ildlmDem( p;u0 reomo3iodfpt anvi s seuoxo3iy4llte ivtasf 2rrur nu4tptn iciasls ra(vo ()trxniocto1lpt lu ilt)setm(rpny4altemieia( srta( oou1texnmf3tyd a emnmpnt)tltrmociy1lat  nvilt0s2umxm3oudlptemfvia(  rtaumonu1tle mf3tas m2ra( pn()tleoxrcto1fpt  i il(0texrxo3nu4ale  nctltfsDtrx  nu1tpe ifctlt aDua( s (4altrxr3ty1faDe i i;s)texr(o oudoleemnctatfarum(rpnu4tpeo ieiad a ua(msnu0trxoifcoydoatrln ols texo(r ou4omtn nvi tfa2ra(mo;t4apen oeiat sDra( sn(0 etnir3oo1op eauesl(0 rxmiopio1llenlics sf rrmxrono1tpt  ictysfs rlnmp;()tlxrif tatlat  u i s)trtm(m3nu4omeemictat)a2rr(r no0tlt mfetltlm2el(vs;()trtnio oo1fm elu i ( t2uoir3nu4ope mivsltfartax pot4ale io3ilsfa umn on(0tltrxo3oytomD ln sl(0s2um(r nu1olen fviat) Dra(  ;t4tlt  i3ils a rm(vo t4trtnmr3oadlaD aieslt0 etrxo3ou1lleemncsasfsrurxm nt1aetnif3tytlaDranvp;()aleomocoa1faD lneils  rtm(mpiy1ap  mnvtls sDumx oou0ole  fetld sDrluvo;t0 eermf ootlmDelivi s s2urimpiudamtelict sfa2umu pou0tlto i3tatfs2uau snu)aleomo tytlpte uvsl( trtoio ny1aptn fvi t) 2uax p;u0tee mo3tys m rlnvo;t) eerio3oytlpD ln ilt)srtoxm3iudole  fci tfsDtrum ;o1openiicild aDran on()tlxnmo iytfp rlnvs;s)setoir oy4op  lncils aruaxmono0aet ifeildls ul(vs;t) etoxo3iotlm r iei ( s2uoxo3oudlltn ivt ( s2raumpou0tptnmoetytfsDrmumsnt)trxoioctodlateanei (0srxoxr ny4llenlfvtlt) Duru pou0alto oeilt a2eanvonu)arxnmo3tatlaDrli il()seur(m io4lmtnlies s)s2ua(  nu1apx iictys a2rlnvs;t4 rtomfcoadom elu i t)t2toxm iodaptemfcs t)sDrmu p;u4aexn feiltlm2umnvs ()alxoxr oytfmDeaieo;(0s2toirpoy1lmt mietas  2umxr nu0aex ifetadlm elump (4 etnmo3iydlp rli s s)s2xoxrpiy4alt  fvtl(  Dumx  ;t1oex iietys aDelu on() reoxoctodopte i o;t)t2xrio no4lptn nviat) 2rrxronu4oex mfcilt aDra(vsn(0aetomoctatoat lnesl( srxo(m oodal nlnetas)sDrm(monu1aleomf3ilsfsDem(ms t0altomfciadoat lnvs;s) rxmiopnu4optelfviasf rraxmpnu1tlxomo3iasfm rauvp ()altnmo tatop e nes (0 exoxrpoy1amtnlfvil( s2tmum no4altnmfeiatfm ulnvo;t) eenxrciatfateau sls)s2to(mpnu1lleemnci ( sDum(  ;o4opxomictyt aDrmu o ()alxnxo3tadlmDeai s;()s2xoxmpnydom  mnvt s)a2ta(m ;o1aleomfeiadlmDulnmo u0aetnif3oy1fmDrlneol()t2urxm3ou1ap e fcs sf Duaxrp;u0apeomicilslmDumump t4 exnxfcia1laDr ueo ( t2trxo3oy4oleemncsatfa2rrxrpnu4ape ioeild a uau o;t4altrxf iodfpDrai il( texrxo3ou4lpeelnvt tf rrmxmoot0oeeoii3iadfm elnmon(0arxnio ty1fmD  i o s  rtoir ou4om e fcia(fs2rmuronu4aex mfciat m2el(vs t0 rxnxo ia1lp rluvi;( seto(opnydomeemfcsl(fs2rauro;u1aexnmictadfsDelnvp t0alxnmr3ty1opt  nei t) 2uo(opiu4am n ivsls  2umumpnt0apeo o3tas s2ulu s;u4aetrxf iotlm rai i;t)trxoir nu4olenlnci tfaDrm(moou1oltn icildla2ul(vp;(0arxnir3oodlmtrluvsls0texoxr iy4alenlnvta(faruaxrpno4aet ii3iatla2emnmon()texrxfctodomteaieo ( s2uoiopoydol   fetasfsDtaxmo;u0oex  oeildfm ranvp;u0 ltniocoytfmtrlivs () ruoimpio1lpenmivsltfaDurxro;o1tlxoif3iyt s ua(vpnu4 etrifciatfpte i o;(  2xr(m nydlpe livslsf Dumu  ;u1tle  ociyd s2ra(vsnt) ltomf iotfpD lnvs s) 2tmxm3oodlltnlivt s aDtm(moou4altnmfciyd m emump t)altoio3oo1lptelues s)trto(o3iudom nlnetl(f Dtaxr ;o1open o3iytfs2um( o t4tlxnxf3oa1omt lueo;()texmim3iydlpt  ivtl()a2rmx  ot0aptnmi3tat a elums;u0tlenxr3iadlp r i s s0s2xr(m3oo4op   ietlt  Dtmx pnt0oetnmoeiydlm2em( o;t4trxnmo3iytomD au ol( tetrxr io4apeemfvi (fsrtr(r oo0teenif3iyt s rl(vo u0 lerif3iy1lm e neo t)teuoxr oydoptnmics ()sDumur ;t1tpt iiciatfmDrmu p;()altrio to1omDrluvils trxo(m ny4lp e ivtls aDur( p;o1tetomo3iydlmDumn p;(0trxnio3oo1omte u olt)truoxo iudam e nes ()sDraxmont1oex  f3iytfaDum( snu4 rxnxr3oadopteaieilt) eur(o oo4al   fvt ()sDrax pnt4oeeomfciatfs rlnmpn()aexoxo3tadoa e u i (0s2ur(o oydlp n neslsf Dumumont4apxniietlsfs ea(mp;t4alenif3oytoaD lnei;s)setoir nu4omtelncs () rrm( pnt0tpeoifetldla rm( snt4tlxnir tydoa eln s;(  etmxo3iu1lp emncslsfarrmum ot0ale mo3iatlsDumn s t4alenmo3oy1laDean s;s  rxr(r3ny4lmtemfvi t) 2tmxmo;t1opx ioeils mDeauvo t0aetrircoy1oat liei (0 rtoxr3oo4ap nmfcsa() 2raumpnu4olxn feiadfs ea( o;()tlerxf oytlaDraneslt0 ruoiopnodomee ies s)aDur(rono1tlxnmoeiyt sDem(mon(0treoxr3tatlpDean ils) eumio3no4alenlfvtas aDtrxr nt0olt mi3iat sDulnvp;t0alxrmf3oytfmt ln slt)t2urxopiydolte fci s)aDrru  no1opeomiciydla2uauvs (4artoxr3oadomte ivil(0 2xo(m3oy1ll  mfcilt)s2taumoot0aet iociytla ulu snt4texrxf3oy1lpDr ivo s)s2xr(opoodomtn ncilsfs2rm( onu4tpen f3tys s2emuvp;t4 renir oodomDraieils0setrim3nydalee fvi t) 2raxmoot1aeeomo3iasls2emums;t0alenirctotomDrauvsls) 2tmxo no1lmt mivias)arrm(ront1tlxoiiciadlm2rmumo;t4aexrircto1oa ranesl() 2umxopoydam   icta(farta( p;u0teenmictaslm2ra(vsnu0 lxnxr ootla elneils)s2xm(mpiu4lp nmnctasf rrrurpoo1oetoiiciydfa2eluvp;t4tlxomf to1lp rliei ( teumxopno4lmeelnvsas)aDurur nu0tlxomietyslmDra(vpn(0trxoifcoo1oatraivo (0 rtmiopoy4opt  fctl(f Dua(ro;u4tlx iietyslm eluvp;u) lxnxfctodoa rlneol( srxr(m nudlpe livt (fsDurxmo;o0tptomf3iasla rlumo u0 etoir3tadomDrluvilt) 2xr(o iy4llt mfet t)arum(r ;u0apeoif3tltfa rl(msn(4 lenxrcoa1faD  i ol(  2xrxo io1lme mnctas) rtmxr oo1oltn oetad s2ulums;t)aexoxr iatoateai o;s texrxo3iy4llt lnctas srrrurono1olxniiciysfs2emumonu)arxnxrctotfmt luvo;s0t2xmirpoy1lp   fei s s2umx p;t4tet  i3iadlm umu s;t0artrxf3iydlat aivs s s2trimpiu1oltemictatfarta(mp;o1alxnioetld a ean o t4 rermfciodlmD lu ol(0 2xrim no4ole  fvt (  rururpnt0aexn fcildls uanmp;t4 rxnmrctydlaD livo s s2uoxm3nodamtn ieta( sDrmxrp;t1apx ii3iydfm emuvonu)artoio tydfmteai s (0texo(rpio1ll nlieiat) Drm(mp;u0opx moeils s uan pnt4 eeoiocoydlmtrlu olt)t2xrxopiy4alt lncsas)aDra(m ;u0alxo i3iadfa rmu snt4aeerxfciy1fmDeluvolt sruoio3ny4alt mfvils a2umxmo;u1olt  oeiasfm rm(ms;(4 lxomo3iodfm eaneils)s2uoimpnodoltnlfcils arrru o;u1oetnifeiaslsDranvs u4altnxf3tadlpDelu s;( srxmxrpio1alenlnei (  rtmum nu0teto icils mDulu snu4altrmf oydla eai o s t2urio ny1al nlnvslsfaDururpnu1tex ioctld mDua( o;u4artnxo iadlm eli ol(0 rxrxm oodlm  lfesatf rtr( oou1oee ioeiyt aDra(vp;(0aeenxfcoy1faDrai ol( s2uoio3oodoptnmivtlsf rrru  ot0tpt mfeild m2rlnvsn(4 eeomo oydoaDr uvi;s0 ruo(m ou4apt lfct t) 2rrx  no0opeoifetyslaDemnms t4 renmf oo1lmDelieols)t2xoim nu1olen fctlt)a2rm(m ot1alenmocias s ua( o;u0 lenmf3oytomDeluvo;( t2xrim3iodape mneslt a2um( onu4openmf3iysfs2umumon(0aetoxo iy1fa e nei;(0 etoir iy4lp  mnctlt srtaxmp;o4ape  o3tyslm2ranvon()trerxfcta1oaD  ieo;s0 2ur(o oy1olt liciasfsDtaxrpot4oexoiieild s2emu s u0trxnmfcoydoaD lnvolt0 etoir no4lpe lieia(  Dta(ro;t0tlxoifciltfs2rlnmp;t0 ltomr ta1faDelnvi;()seur(r oo4ame livta(  2rmxm ot0opxomociydfa ulu o;u)aexrxf3oadfpDelieo s0seumio3iy4lme  nctlt) Dumu p;o1oex ifctasfaDumnmp (4alxomo ty1laDr nvi;(0s2xo(rpnudalt  fvi tfs2tmx  oo0alx  ocilslm2ulnmont) eeomfcoytfa rli ilt teum(r3oy4ap   ivilt)a2um(  ou4tptnioetlt mDel(mpnt4 lermf3oadfpteaueo;s  rur(r3io4ol  mfviat s2taurooo1tptoiocilsfsDranvont4alxoir3ia1opD li olt0 etoirpoo1omtnmfcil( a2taurpno0tpeoio3iaslsDemn p;t0 lxnmr iodoaDrai i t)s2xo(opoydlmt lneia()artr( pnu4apx  ociadfa umnvont0alenmfcta1lp ean olt trxrio3iudlp nmictls  rraum ;u0alxoioeiatfaDrau sn(4trtoif3oa1lptrln i t srtmxm ny4lleemivta()aDumxroot4tpto oeiys m el(vo;t) rtnir3iytop elu i;s srumxr oydop nmfetltfsDtax p;t0optnmieiltfaDrl( o t4trtrxr iodlpD ai s;t0 rtr(r ny1ope lnvia()aDrmxmpoo1tlxnmieiatls2ua(mp;t0 lxnio3oatlm ranei (0t2xoxrpoo1lmenlnvsls)a2tmxroot1tex moctatlaDemnmpn(0 etrmocoodopDean i;() rurim nu4lptnmnvi s) Drrx pou4tltnmi3iltfsDum( o (4tlxrxfciodomDr ieols)trtm(m ou1al  licslt) 2umur ;o0alxn i3ilsfsDum(vs;t4 exrxr3ty1op   ivi (  rurirpoy1ame lfeta(f 2umurp;u1opxo fcilt s2rm(vp (0teenio3ootlpteanvs;() rxoio oo4lltnmncslsfsDum(mp;o1opt mietyt a rmumon()tlxnifctydlaDeau olt)srxr(m3iudop elfctas artaumonu4oex ifetydlsDuln o;u)tetrxocoa1lmD livi;t0 2tr(o oy4ale lfvtl( artax  ou1tpto oetytls rm(vp;u4trenmfciydfm rlivs;s0t2urio iodlmte neslsfsDraxmp;t4tet mfciyd s2rm(mp (4alermr oadla e n il(0 exmxrpou4omtnmncia()srrmu ont0aex ii3ilsfa um( pnt) rxrxf3to1fpDr nvs;(  etrirpio1opt  nci s) 2ra(m nt1aee miciys m rlu onu)teermoctodlptrlueo () rtoim nu1ope livs ( sDtmx  oo0apeomo3iat mDumums u4treomrciodfpteliesls)teuoim ny1alt mictas)s2raxmp;t1aleoif3ild a rm(msnt4texnxocoodop r uvols)sexm(m3ou1ole mfes s  2ur(r nt0apenmoetlt m2ulums;t4trenxr todfmDrauvo t) eurxr io4oltn nci s sDrr(mooo4oexnio3iyslm2rlnvont0aetoiocty1opte neil( trtrxo nu4am   iesa(  2rmuro;o0tptomfeiyt m emnvs;(0aetnir3oodlp rln s;()s2tm(r iy4lmtelies sfsrra(m ot0texo iciadlm2umu snt4teenxf3oydlm e uei t)t2um(rpoy1lmt  ncils s2rrx ono0opx if3iatla umn o u0 rxnmfctytlatraneols)t2ur(m3oydope mfeilsf rumum nu0oex  i3ias sDum(vp u)trxrxfcto1fatrli i s s2xr(m iu4ome  ietl(fa2rrxmo;t1opeomoeiasfs2eauvs;t0aexrio3iotfmDrln o;( texm(rpnu4amtnmicta(f Dtrxr oo1tlenmoctadfaDea( p t4aeeoifcto1laDe ues;s  rxm(m nudllte ivt (f 2umu o;t4oetniieiytla2umump () lxrxo3ta1oatrluei t seuo(r no1ll nmfcsasfa2rrxmp;o4alto fetlslm2uluvs (4tleoircto1lpte nvol(0srtmxr nudom  mfeslsf rrrxr ;t1apen octytlm2umnvs;u) eeoxf3iatfmtr neolt t2uoir nydom emnetasfaDurxrpou4optoiocilslsDulnmo t)artrxo3iadoat livs;s) rxrxr ou1amt lfeta(  rtru pnu1openif3tas s ua(msnu0tleoxoctatlaD lieo t0 rtmiopiu4lmtnmnes tfa2tauroou1aet ioetysla2rm(vo;u)artnmo iadom rlivi;(0s2xo(mpiy1lmt lfvtasf Dtm(m nu0oet ifciat a2rluvs u0alxnmo todfa eluvo t)srtr(o3io1lptemfvtl(f 2tr(r ;o4olt ifcild s2umu s;(4 leoxrcoatomt livolt)texm(o nu4apt lfes ( aDurxroot1tpxoif3tad a uauvs (4tetnmo iadfm rlnes;(  eumir ny4olte fei t) 2umxm oo1olt ifeiat a2rlnvp;t)tlenxo iy1oatrln ilt) etrio3nu1ap n feia( sDururonu4oetn o3tat sDeaumsn(0aeerif3oo1fptr n s;( s2umxm3oy1ol n nvtls aDtr(rp;u4tpeoifcilt a2rl(ms t4aetrir tadop r nvi t)trtmio nodom elnvt t  rumx  ou4aptnmociysfs2umnmsnu4 exoxr3ty1omt  i ils t2xmxo ou4oleelfcias  2rm(mo;t1olto ieilslm ean pnu
\ No newline at end of file
@@ -0,0 +1 @@
+uvil(  etr(m ou1al nmfviltf rrax o;t0aeeoifeiytfa eanvp u0trxrif todfatrluvs;(0trxmxmpiu1aleelnvtlt  rtaxr oo4openif3ild aDrm(vp (0 ltoiociatlp  lu i;()sruo(o no4optelfvtl()aDtr( o;o4texnmf3tas s eaump;t4texrxfcoo1lm raueol()srum(o nodaltemictls s2raxr ;o4oeeoiociadlm2ean s;u)artnif iatomDeln o;s)srxoim nu1amt lfct s) 2tm(ront0tltnifeiad a2uaumonu4 exrxo3ta1oaDrluvo s) rxm(opnodopeelivils)artrumpnu4tlenmi3tasls um(mo u0 etnmocto1faDrlnvils  rurim nu4apee icilt)artaxrp;o4tltoifcils a2umu snt4arxoxf3tatfaDelivslt) rurxr oo1ol nlfvt ()sDraxmp;u1oltoioetydfsDelnvp t0texrmfcoytfmtr uvolt0t2xmxm nodalenlneslt a2urxr nu0tpenmi3tlslaDel( s;u4altomf3tytlatr i o;t t2xoimpoydal emnetas srrmumo;t0tpx  ietadfsDrauvp;() lerio tytlmD  ues;t0 2ur(mpny1omeelivsatfa2urxm nu1tpxomo3tltfs2elu s (0aetoxo3oadlmte nvo;t t2xm(o3nu4opt mncils)a2tax oou0apt  fciyt s ean p;(4aeenmr3iatfaDe u sl(0s2uoirpiodlmt miet s)s2rrx  nt0oetomfeiaslm2ran p;(0areoxo oydlmteaieo t0sexo(opio4om nmfeil() Dum(ronu0tltn o3iydfm2rluvp;t4arxomrctadoaD aueilt trxm(m nudlmt mfvsa() rur(rp;o1aex mietad m2ra( p t4 exomr3oa1opDelnvo;(  2tmiopnodomtn ivs t s2tm(m oo0apt mi3iatlaDea( on() lxnxfcoadomt luvi s  2urim ou1altnlictltf 2ta(rpnt4opeomiciytlmDrl(msnu)aexnif ootfaDeaues s s2uoirpiodamtemict sf 2tax o;t1alxoio3tysfs ul(vo t) lermo3iotla   u ol(  eum(o3io1ameemfciltf Drmxr ou0ape mocild s2ra( pn(4texomf3ta1fpte ivo s) etr(o ou1lleelfvt (f Dur(rpot1aleo octldfaDuluvsnt)trerxo oytoatraiesl(  2to(m3ou1lm nlncs s a2tmu  ot0opeo ieiadlm uan p (0trxniocia1fa raneo ( setrio iu4olt mfetlt  rraxrpno0ope  ociytfsDrlnvp u)trerxr3oydoa eauvi;() 2umxmpiodome lncs ( a2rr(r ot4altoioctldla2ea(vsn(0trtrio oa1late nei;t trumxmpio4omtelfcsltfaDtruront1ape  ieilsfa uanmo u)artnio todoateanei;(  euoir io4lleelfvi s)aDrr(mo;o4tpto fctltla ul( p;u0arxoxo3tadfa e neo;t)seurxrpiy1lpenmfes ( arrru onu0apeoii3tydls emumpnt)aexnxf iatomD  uei;( seum(m no4ape mneilsfaDrru o;t1apxn fetadfsDumn snu0 lxnmf3ia1omtelnvi ( srxoir oydomt lnvs tfaDuaumonu0tptomiciysfsDemuvp;(4arerxfcoo1lpDe n slt0s2xoim3ou1ll  mnct tfartrxmpou1open ietatfm rl(ms u)alxrif3tadfp  aivilt0trto(mpoydope mfeta(f 2rrum ot1alt moetyslm ra(vs (0trtoxrctytfptr ieo;s)srxoxo3oy1ope  ncta() ruaurp;o0olto f3iytfm2elu on()tetnmr3iatfp  anvi (0srxoim iu1lmenlneiat  Dum(rp;u4olt iictatla uanmo;t4teenmr3oo1lptr ieo;(0setoxm3nodlltnlicsat) Drrxmo;u4oltn o3iys a um( s;t)trxnmfcta1opt lneslt t2xo(o oydamtnmnct ()srur(  oo4apenmi3tytfa eanmp t4tlxrmocio1fmDelnes s)srum(m no4amee nvsa(farraxmpnt1aet  fctaslsDrlnmp;(4 lerio3oytlaDranvilt0srurio oo1optnlfcta()s2umu  nt0oeenmoeiltls emnvo;u0 etoir oatop eln sl(0t2xoxrpoydll   ivsa(faDtmu p;o0altn i3tytfa2ra( sn()aeerifcoatfp rlu ols)teuoio nudomeelfctlt aDurxm nt4opxoifciad aDul(ms;()tltnio tytfmDe uvol(0s2triopiu1lme  icslt artrx pno0tlxnmo3ilsfm2elu p u4texnxociy1laDrai o;s0trxmio3nu4omee fciat a2uaumpnu0tptomiciat mDrlnmp;u0tltomf tadlmt liei;(  eto(o oy1ape miesat  2um(ronu0tptomociys s2ea(ms;t4 leoif to1lmDrau slt)truoir3iudamtemnctl( srurxronu0alx ioeiyt s uauvsnt0texomf3oodomte ivils0s2umiopnu4oltnmnci (f 2tm(r no4opx mocilt a eluvs u)trermrctydfaD  u s t0t2tr(o iydamtemnetl() 2umxront0aleoifeild sDrl( on()trerio3tytop r ieil( truoxrpny1am n fvt t aDtaxr ;t0oexo oeiyslm rau p;(0tltrmo to1fm r n s (0 rtmxm nydalenmfvt (  Duax p;u1olxoifciat m2ulumo (4altrir tytlp eanvs;( srxmiopou4amt  ietat sDta(mpnt0aeen icias aDel( o t0tltrir iadfmDelivs t)truoxr oydop   ietasf ruru  ;u1opt mi3iatfaDeaums;() eenmfcoydlp   nei s) euoxm3no4am emivias  Dtrx pou1alxnioctltfsDuauvs;(4 eeomfcto1fate n s;(0sexo(o3oydopeemnvi tf Dum( pnu4tltnmiciadfa uan o;u0tetomo oydfa e ivslt)s2xr(opiu4ome  nes (f rtmu p;t0aee  f3iyt m ua( o u) rxnmf3todomD lu ol(0tetoxrpoodale lnctlsfaDtrxm ;u4teenmietld s rlumpn(4trtnmo tatlpD  n ol(0texr(opnydlmtn nvs (  Dta(mo;o4alxo f3iysls2rln o;()arxoir ty1lm rluvi (0 2xoim3nydalt licsltfarra(r oo4texnmo3tytla ulnvo;()arxrir iatlm  auvils)tetoiopnu4omt  fviat)sDumxr no0apenmociyd s emnms;u0aeeoxr3oy1lpDrln i s) rtm(r3iy4op  lictat) rtrur ou4oltn fcilslsDrmn p;t)alxnir iydlm r uvi s) 2urxmpny1ll  lieia(  rtmxmooo1aetoio3ildfa2umuvpnu4aexnxrctytoptrlueol( trxmxo nydamt  ietat)arrmxr ou4oltomi3taslaDea( o;(4treoxrctadlmt anvs;s0 rxoir3iydlpee fvi s sDtrx pou0tex mf3ildfsDean p;u)tltoif3iytfp rli o;s srurir iu1op emfeslt) 2taxmp;o0ope  ociysls eln p;t4 etnxr iatfa  an i;t0 etrir3nudop nmfeilsfsDrmx  nu1tpen oetytlmDrmnmpn(0artrmf3oatlptr nes s0s2toxm nu4oltnmfcias)sruaxr ou4tlenmfcilt a2ean s;()trenxociy1fpte u ol(0 rtoim io1olt  fct s  rua(monu4aptnmfciadfm2emn pnt) rtoxf3oodoptrau s;(0tetoio nudom nmies sf rrau pnu0opx  ieiysls um( on(4aexriocty1fp rlues;(0 2urio3ou1lmtnmivsltfsDurxr ou0altniocild s eauvo t) reomr3ty1lm r i o;t0tetmxm3ou4lm emfcsatfs2rr( oou1apeomictysfm ean p;(0 lermrcia1fmDrln s;( t2xr(m3no1lmtemieilsf Durum ;o4alxomictyd sDrmnvo;u4tetomo totlpt lneo;t texrim3iudlm e nct (faDuau oou1opx  octldlsDrmuvo t4arxoxo3tatfatrlnvslt)srur(r3oudal nlicsls  rraxmpot0aexnioctad m2umnmsnu)aexrmf iadom e ies;s0 2xoimpio1ll nmieiasfaDumu pnu1apen fctasla el(mpn(4artnxo ootfa  li il( trxoxmpou1ap e ictas s2ua( pot1oeeo ocias a rauvo;t)texomfctotlpteaueols  rtriopnudamenlicta()s2ra( pot0tlen ieiyt a ua(mo u4aetoio ootopDrlivsls)s2trio oy1apt lnvsa(  rtmx p;u1aeen ieiltls rl(mo t4 ltrio3ia1lm  aneolt0seurxm3ny1ap   fesl()aDtr( p;u1tpt  i3ildlsDelump t)trenxfciatlmDe neols)teto(o no1lltnlnvtat aDrrumo;u1tee ifciytfa ranms;t0aeeoxr3totlmt anvo;s0s2xriopoo4lm   iet t)aDtax o;u4olt mfciyslaDrl(mo;u4trxnxr3oytlaDeln o;t0tetoxr io1oltnlfciat)aDurumonu1apeoifeild mDelnvs;t0 rtnxrciadopDrauvsls) eur(o3iy4lpte fvsls) Drrxmono0apeo oetatlm ul(vs u4 etrmr ty1fate nvsl()sexoim3ny1opt mnvtl( s2umumpnu1apt mf3ildfm2eanmp;u4 lxoxf3iadoaDe i s;t0sexrxo3nu4lmenmnesltf Drax oot4oexomictldlm2eau pnt4aetnmrcootom rluvi (0sexm(o no1omenlics sfsDtmx pot1olxnio3iysfm2rm(mp;()tlermr3iy1lpD an i () eumir3ny1lmtnmnesl()aDur(ro;o4tpenmf3iltfsDrmu pn() rtrxrcoodla e ivil(0t2xrir no1oltelnesatfa2rr(  nu0opeo i3tytla rlnvs u4trermf3iydfm e nvo;s0 2umxr nodal  lfvsas a2rm( pno1opx ifciasla2rmu snt)treoif oo1lat anvs (0t2xrir3ou1lptn ncilt  rra(m ;t0teto icias a2ranvp;t0 rtomr oy1omDeanvslt0t2xmirpnu1aptn fcia(  2uax pnt4texn fciys a2rl( p;u4trtrxocia1la  aueil()sexoxopoydopt  nctas)arta(mp;o4aee  oeiys a um( s;(4trxnxr ty1laD  ivi;(0 2xrxo3nu4am  mfetl( a2um(m ot1aeenmfctldfs2ea(vp ()aexnxrcootfmte ueo;t  2tm(m3iy1lpee ivt t) Dtau pnu1aexo oeiadfa rln o;u0aexrif iotfpDr u o;t)srxr(o3oudop e nviat  Dtr(moot0tleo feiyslsDumnvs;u4teeoio tatlpDranei s  exrio3nodlm emfvils) Dtrxr nu1alxo ictydla2elums;(4alenxo3oatoa eai olt)t2toio io4lmtnlnvsl() 2ua(rpou1altoif3tasfsDumnmo ()aexoir totfptr ivsl(  rtmir3iy1omtemivsl(fa2trxr ou0oeen fctlt m2em(vp;u0artomrcoa1om eluvs;s)trxo(opoodop  licias  ruau  nt0aptoiietysfmDeanmpnt)tlxrif3oadoatrai s;t) rtoxo3oo4omenmnesl(fsDumu o;t0ole  feils mDumuvpnu4 rxnxo3oy1fmD  ivi;s sruoxo3oydal nlicslsfarrrxro;o4tptomfetysfs2el( o (4 rtnxr3to1fp elneols)teurio oy4llt mneslt)sDraxr ;t1apxoif3iysfaDelumo;(0 rtomfcta1opD  uvs;(0trtmxm ny1altemivt sfaDrax  ot1alx ioeils m ulu onu) reniociytfaD ln slt0 exrio oudopenmnvs (f 2tmumpot1tleoioeiysfaDrm(ms t) rtoiocty1oaDeaivo t) exmxrpoy1amt mnes sf 2ur( ooo4olxomoeiydls2rlnvsn(4altrxf3iadlpte iesl(  rxoir3nodap n fesl(f rua(ro;u0tle  iciydla eaums;t0 etomrcoydopte uvs;s)trtoxopiy1amt  fvil(fsrtmx oot0olenmictatfmDran p;(0altnmrcto1optelnvilt  rtrxo3iudomt mnctlsf rumur no1olxn oetldfm2um(mp u0aeeoircoodlatelnvsls0t2urxr3oudomenlfvt (fa2rau  ;t0tpx miciaslm2ranms;t)trtnmf3to1fpD  n s;s)setmxm3ny1am nlicia()sDrrxrp;o0tlx  f3tldlm2eanmont4 lxomr3ootfpt lu o;(0texm(mpny1lm e ncsls)srur(r no1ope iieiat s2umuvs;(0tetoifciytlateluvs t)srxoxrpnu1lmt  fcias sDraumono0olxn octyd a2ean snu4 rxrmocia1optrlivi;( s2xmiopiydlp e nvtatfsDumxrono0tpxnif3iydlm2rmu p;u) etrmo3ty1fm   ueslt0 rxrio nydllt lnct tfarraxrp;o4oetomiciyd aDelnmp t) exnir iydoptrai s s)trxmxrpoudlmt  fci tfsrra(m ot1tee mfeiatfmDrauvsnu0 ltnmo3ty1fm  ai s ()sexrxm3no4lmte fvsasf Dumuroou1alt io3iyd sDrlnmp;u4altoxocoy1lm  an s ()tetoxopno4ll e fvtatfs2ur(rpnu4aptomi3iatlmDrmnvs u4areoxfcoytlmt  uvil(0trtr(m3ou1alt  neil() rraxm ;o0tpenmicias a2ra(vsn() ltrif3ta1fp e ivo s0 exr(o nu4apt miei t  2uax ont4oexnif3iltfm2uau p t4aetoif io1fp rlivol(0 rtrxo3nu4am elnct tfarta(m ot0apxnii3tysfa rmump;u4aeerxr tydfmteaivols)truo(m3iu4lp emfetls) Dtmurp;t1oltn o3iltlmDrlu o;t) exoxf ta1omtrlnvslt0 exm(r3no4amt  fvt ()aDtrumo;t4texoiiciyd a2ea(vsnt0 etnxf tytfa   iei t)srxrxo nu4omenlnvs (  rrrurp;o4optn f3iltlsDum(vpnt)tltomr3iodop raivi;t)srtrxo no4al  mfeiltfarua( o;u1oetnifeiytfm2ul(vo;() lerxr3oo1fpDr ies s0srtmxm3oo4amtelfct s s2tm(r ;u4tpxn fciyt s2em(msnu4tlxrxo todom e ivsl(0 2xo(r3io4alt liciatfsDtax pno4tpt ioetad m2ea( s t4artnxo iydomDelnes;t0 ruoimpiu4lme  nvils  rumu  nt0olxoifciydls2ea( o u4altoio3ty1oate iei;(0setoir3no1omeeliet s)srrrx pnt4oeenmociat sDrauvs (0teerifcoy1fa e nvil(  rtrxo3iudomt lfvtl(f Duaxmpno1opxniieiadlm em(vsn() eermf ty1fptrlues;s0srtrxo3io1lptnmiciltfsrrmx p;u4aet  ictldls eanmp;t0aeeoxo3tatfpte uvo;t)s2toio iodamt liviltf rtr(  oo0oeeoifetytfaDemn p u4 leoxf3totomDr i s;t)t2xoxo oy4oltemfes s)s2taumoou1alxoifciatfm elu p;u)aleoio oa1lmDeliei;s)srxmxo3iu4lme mfetls)srumxrpno0oex  ocildlm2rlnms;t0artoiocta1omtraneilt)trumiopiu4al nmfet sfa2rmxroot4oexo fciyslaDum(mo u0 etomr3to1laDrln o;(0t2trir ny4op e ivsl(f Dtax ont4apxn ieiatfsDraumo;(4 rtrifcoa1om  aivol( texm(m iudlltnlies tf rrrxrpot4olenif3ilsla2rlnmonu0aexomo iydfm   i o t)trxmio3oo4ape liei s) 2rrump;u4tptniiciysfmDua(vo ()trxnir3iatoaDeau ilt t2xmio3oydlpenlnctat) rumxroou0oex if3iasla2eaums;u)artomrciotoaD livi ()t2ur(rpiydlme mfvsl( aDua( ooo1oet mieildfa eln on(0 exnxo tatlat livi t)trtoiopnu1omeelnvsl() rtrumpot1apxoifctatfs2rlnvs u)teenir3ty1lm  luei;t  exr(r ny1ope lnvilt  rrrum ou4tetomfeiytls em( o;t0 ltrxf to1lmt  u i t0setm(opoydop  mfeil(farrm( pou4aexo octad aDemn p;t0 reoxf totlp elies;t) etrio3iydlltnlfcs sfa2trur oo0texomoctatla2ul(vont)aexnmocto1laD aieilt)trto(m3oydap emnet (f Dua(  ;o1tltomo3iatfs2elnvo u) etnmr3ty1omD  ieil()teurim iy1lptn icils) rtru  ;o4aleomfeildla2eluvpn() ltoxrctydlpte iei ()s2umim io4oltemnct (fsrtmx  ot4olen ieiydfsDumu p (4trxoxociy1fa   ies (0 2urio3no4ap   fet (f Dumxrp;t4oeto i3tldfa umnvpnt4 rtoircoo1lp r ieo t setrim3io4am nmfvi t)sDururp;t0opt  feilslm2emn snu)arenmfcoo1omD aueols0 rxo(rpoy1omt mnesl(faDtr(rpoo1oeen feiys m el(mon(4trtoxf3totfatrlueilt)srtoxopoudlm  mnvs (f 2tr( o;t1oeen octydlaDumu p;t4tetoxf3iy1optraivs ( trur(m3io1lp e fcia()arra( o;t1oeto oetlsla2raumont4arerxf io1op e ueo;s)sexrxopio1lpee ncsl(  2uru  nu1tpenmfctldfa em( pnu0 exnxfcta1om e i i;t  etm(o3iy4lm n nvi s) 2ur( pou4olxomi3iysfm2um(vo (4teeoxf3oatlm ran s;(0 eumxopoy1alt  fvt s) rrrum ou4aeeomoetatlaDrau snt0aetoxr iy1oat auvi ()seum(m3nu1al e ieilt aruaurp;t0opxn i3iys s eauvon(0texrxo3tatoaDraivol(  2tmxo iu1oleelfei t)aDta(ronu0aex mfetyd m ulnvp u0altnxo3oytlmteli o t0texmxr ou1ameelicta(  Drmx  ;u0aee iieias s umnvsn(0artnxocia1laDe nvols0 rur(m3nu1lp nlneilt) Drr(moot1alxnii3iys mDum( snu4texnmf ootoateaiesl(  rur(opoy1lptemfcilt s2ur(rp;o1optoiieilslaDelnms;(4 ltnxrcoydlmt  i i;t seumxo nu4lleemnctltfa2trxro;u1tlx ii3iat sDemn on(4artoirctodfaDrai i t srxmxmpiu1lm  mfvtl( aDtr(r no4tptnif3iatfa uau p u0teermf ootlpt aivs t0t2tmxopoo1altemicsa()a2trumpnu0aee moeiyslmDua(vs u)teerio3tatopDe nes t0srur(m3no4lmtn neias) Drrxmp;o1tpxn f3iatlaDeauvont)arerxr io1lm   uvs s0trxrxo oo1omte ici tf Duax  nt0opx mo3tlsla eluvo;(4texnxr3oytopDeli s;t)sruo(o3ny4om  lnetl(fa2trxm nt0tlxoioeiysfs2um( ont)aleoio oy1omDe nei ()srurimpiu4lpen neta( srtmumooo4tle moctas m2uaums;t) exnmfciodop   ieslt) etr(m ou4am e nviat)aDua(  no0tpx iociad m2ulnmo () rtrmfcootop rluvs;s0 etrxm3ou1lptemfvtasf 2raur ;o0oeeomfctysfsDean sn(0arxoir3tytlaD  nvsl( t2xmxopio1omeelieslt)arrm(root4alx mieilslm emnvs t0texrxf3tadfp rln i;s)t2xmim3iodoltnlics ( srur( pnt4oet ifciasfsDeau p t)alxrxrciy1fmD  neo;()srxr(o3iy1apt licsls) Drau pou4olxnifeiatfa ea( s (4aetoif3to1oaDeai sls)sexrxmpou1alt  iesas  2ra(rpnu0alxnio3iltls2elnms;()tlxoifcio1faDr ivi t0truoio iu1ol emnvi ( sDtrump;o4opto o3iatla2eanms (0tleoifciydfpD aivo;( t2tmimpoo4ll   nviasfsruau pou4ope mi3tadlm2umnmon(4arenxocoytlaDeli i;s tetrxm3iudale mics t a2tmxm ot0tltnmieiasla eluvs t4 eeoxociodlat au il(0srtoim ny1lmenmfcsl(f rua(mpnu1oetoif3ils aDemnmsn()aexoiocootfpDeaueo s0s2toxo3iudlmen ncsasfs2ta(  ot0ale  oetltls rau snu)teerif oydop eaivi;( srxo(m3nudllt  fci ( aDrmxm ;u1oleomf3iatfm em(vo;(4aexoir3tatlp r uvo;t0 2toxrpoodomtelnei s s2tmumpoo4tpe iictasfaDrlu snu4 rxoxfctydopDe neils0s2trxm3no1apt livs s) 2trx pno4olx  f3tyslaDumn o t4trtoioctytoa  anvi;s  2xrxm3oo4oltnmnvil() 2uau  ot1tptnii3tys s umu o;(4alxoif3oodfa e i o;t)sexr(mpiodlp nmiei ( sDtmxmp;u0teeomfetldlsDem(vs;t)aeeoxocty1oate ues;s tetoim3no1lpeelivslt a2umu  ;u0optn oeiytls2umuvo u)tetoiocta1fmteanvi ( t2toio3ou4lptnliei s  Dum(r oo0olenii3ils mDelnvpn() lxnxrciytop  luvo ( teumxmpiy1lltnlicilt)srrmx ooo1texn fcild mDuau s;(4altnio3oydoateluvo;t) rurim iu4openlivtat arraxro;t0oexn i3ilsfs2ea(vpnu0aeenirciadlatr nes t0 2toxr3iy1lmtnlfei ()aDrr(m ;o0oltnmi3tad m2eaumsnu4 rxrio3tydopDraivo;t)trtmxo iu1ame lnvta(  2rr( ooo4texoiociadfmDulu sn(0 exoxrcootfaD  nvols0trurxm oodomtnlfcsas  Drrxmonu0apeoioeiydfs rmuvp;(0 rtoxo3totfat  n olt) eumxrpiy4lp  lfvia(f Dumxm no1aexn oeildfaDean ont)aexnxr oo1faDr ueilt0teur(r3no1alt mfvtlt)sruau  ;t0opx mfcildlm em(ms ()trxnir oatoate ueilt) eumim3no1optn fvsas)arta(m ;t4altn feilsfa2rm( snu) ltrircia1lm eaivo;s)t2xo(o3iy4optn fvs ( s2trx  ;o4tlenmf3iytla2ua(mon(0trxoif oy1laD aivols0s2tmxm iy1apeemieta()s2umxm ;u4tpx ii3iytlmDrl(mo;u) eenxo3ty1laD aivsls0setoim nu4altemnesl( sDtruroou1tet iieiadlm rmump t4altrmo3oo1opteai s;() euoxrpiudop e nvsa()s2urx p;o4aeen oetydfaDuaumpnu0 lxomr oadfp rauvs ()tetrxr iy4amtemiviat)aDurx pou4opxnioeildla umu on() rtoxo oytfm elnvo (0srxm(rpnydam elicsa( artmu ont0opeoiociasfm2rm(monu) leoxfctatlp e ies;t  rum(m iydom e fctl()aDumuront4aexnioeiydfm2ean ont4artrir iotfmtr nvo;s0 eurimpno1optn ictasfa2uaxr oo1aexo ieiadla2elu pn(4 renxr3tatoaDelnes t  rxo(rpnu4omenlfcilsfarrrurpou0teeo o3iytlaDum( o;u)alxoxf tadlpte ueo;( trtoir3iy1opee nvi (fa2rrumont0apto f3iydls eln o () ltoirciodlp e nvsls)sruoxr nydom   ics (fsDta(mpno4ole mocild s eluvp u)arenioctatlmteluei;(0 exoio no1lpe mnvi s srta(ro;o4tlto octad a2uauvp;(0 eeomrcoydlmD  n s;t0srtr(mpoy1optelnctas sDrmxrp;t0oetnifciytfm emumo ()tlxrio tadfmt  uvs s0s2umimpno4lle mivt s artax ont1tlt ifetytfsDum(vo;(4altrmr3oodlm r u s;s srur(m3oy4lp elnvil()arumu pnu0ape mo3tydfs2um(vpn(4artrxo totoptelues () 2trio3iu1lpeemfvilsf rtmxmo;u0alx  o3iyt a rmnvs () rxomr3ty1fmt aueol(0 rxrio ny4ope  ncsasf rtaumo;u4opto ietyt a2ra(vs;t)artomr3oodopD au o s0trtmirpny4lmtnlneil(farua( pnt0alt iociydls umuvsnt0 etrxr iodfm elies (0t2uoir3iy1op nlfvtlsf 2ra( ooo4tpto icildfa ra(mo t0 rtnxfctodlmDe nvs;s0srumim3iu4omtnmivtlt)a2rm(r ;u1aexn i3iydfm rlnms u4tltnxf tytfmte uvo;( trxm(r3ou4apee ncsatfaruaxmpoo1alxniictas s um(vsnt)trtnmf3oytfmDrlnvsls  rtoio nudamte ietat artmxro;o1tltnio3iyt a rl(mont) eermr to1lm  ln s t  exrio iy1ll elfcsl( sDurumpnt1openiocilt s2elnvo;t4tlerircoo1lpt luvil(0srtmxrpoo4lp nmneiltfaDum(r ou0oex mietldfs2umu s;(0texrmo3oa1faD aueo t)trumxmpiudlm  lfcs s)sDtrx ooo0teeoioeiytls2ra( s;u4 lenmf iotlaDr n o s0t2to(rpiy1ol eliei t) Dta(rp;t0tpen i3iadfs2ua(monu)aeenxr3iotfp eauei () ruo(o3iodaleemnvt () rtm(rpnt0tpxo o3iysfa2um(vo;t0 rtrxo oatfmtrlieo;( setr(r3iydlm e feia(fs2um(mpou4oeeo f3tatfaDum(monu)aexrmrcoatlat lueo t0t2urir no1al  liesl()a2taxmo;t1opxn ieilsls2rmuvs;u4 reoxrcta1fp  aiei;()seum(m3oy4ap elnvia()arum(ront4alx mfeilsfa2elu pn() rxrxf3oadopDe ueilt trxr(opiodal nlnes ()s2rmum ou0tpx mi3ilsfmDumuvs t0areoir3ty1lateau o;s) 2xm(m io4ape  icilt) 2rrum nu1tltoif3tlt m2ea(mont0aeerxr3tadoaDrauvo s0s2toir io4optemivtl(fa2rrxro;o4oet ifeiatfa uluvpn()aeeoir iy1optranvsl()texm(mpnodam e ivtls  2trxm oo1oex mietadls2rmu s t)arxnxrcootfm rauvil()trtoio3nodlpenlncsat a2tmum ou1tpto fciytls2uanmp;(0tlermfctodlpDrlnei;t)t2ur(o3no4lpenmnvt tfsrrmur nt4alxomieild a2rlnmo;u0aeeoirciy1fm r iei;t0t2xmxo nudlm elieslsfsrrau  nt4openiiciydla2um(mp u)tlenir3ia1opD anvil(  rxr(m no4altnlicias)sDuax  nt0tpeoio3tldlm2rm(mon()tleomrcto1opt luvi;(0t2umxmpiy1opt micsas) rum(mpnt4tlt mfeils s2rauvs;u0trtrif3iadfa eanvs;t)s2xrio iudlmenmfeiat s2taxmoou1oee miciadfa2eauvsnu0tlxnxrcoa1oa rai i t  2ur(rpiu4omtelfvs tfa2ta(rp;t4opx  ociydfs2eaums;u0 etrif3oatomt  uvi;t setoxo oodlmt mnvt t s2raxm ;o0tpenmieiasfaDemuvo ()texriociodlp rluvo s0tetmimpiy4lp nmfeil(f rtrumont0alx iociaslsDea( pnt0aleomfciatlateln i t t2uoimpoydameelivtl( artrumont0tlxniieiydfs emnmp u) renio oo1lmDrau o ()s2urxr3io1omeelneil(fsDtr(moot0tet if3tldfa2ua(vo;t0 lermr iodlaDeaieo (0sruoim3no4llen ivta( srtr(r ;u4olen ociysfs uluvo;(4altoif3iotlmD au s ()tetrim iy1lmtemnctls)a2rmu  nu0aptomieiat m rl(mo (0aexomr3oa1laDelnvol(  2tm(r iodomte fct (  2raumo;u0optomo3tadlm2rl(vs u)aeerio iydoat an s;s  rxmio3nydlme lfcils a2ua
\ No newline at end of file
@@ -0,0 +1 @@
+ieolt)srxm(r3ou4alte ictlsf Drmurpnu0tetomfeiadfs uauvp (4aexrxo3iydopD  u i s sexmxmpnodamt  nes sfsrumum ou4tltomicilsfsDelnvonu4teermr3oydlmt auvilt  2trxm3ny4ope lfcilsf rtmx o;t4oetn feiytfm2el(mp t4trtrmo3ootfmD luvols) rto(r nu1olt miesa() 2tmur ;u1ope io3tydfsDum(vo;(4alenif3oa1lm eliei;t) rxmir3iodame lnvil( artaxmo;t4tleoiiciydfa2um(mo ()tltoxr iy1lat aieo;t)texr(m nodapee ivil( sDrr( p;t4oleo o3tldfs2rm(ms;t0trermo todlaDr uvo (0s2tm(m oy1om nlivs t aDtrumoot0opxoif3ild m2elu p;t4 rxnmr3oatlpDraivi ( t2xrxopiu1ape mictl(fs2tauroot0oet moctys m2ran p;t0arerir3oodfm  ln ol(0 2xm(o3no1al nmncilt)aDurur ou4aeeo fcildlm rau p u4 reoifctydop raiesl( srxmirpoydalen fetl(fsrurx p;u4texo ocild s ulnmo (0tlxoxf oadomD li i t0 rxr(mpou4am emnct t) Duaum ;o0tle  o3iyd sDrlnmsn(4arerxf io1lmDrauesls t2tr(r3nu4opte fctas) rur(r ou0oex  oeiadls2el(ms;t)aexrxr3iatfmt aiei () rtrirpoy1oltn fvsl( a2taxm ;u1aet  ietadfs ea( o;u)tlxrxfciydla eluvil(  euoir iodopeelnvs sfsrumu  ;o0oltnii3ildfs2rmuvsnt0 rerxo3oa1fm   ies s)t2xrir io1oleemfetltf Dumx  ;u0tleomieiasfs ul(vo;(4 lxnmf io1omDeli ils)t2tmxo oudap nmivsatf rurxmoou4aetnmoeiadlmDelnvo t0 rerirctytfate ivilt0s2trim nudaptnmfci s  rtmum nu0alxomoeiad a2umu pn(4artrmf ty1opDrauvs;s srxmxr oodamt  ivtl()sDrr(mooo0tpeomfciyt a2rmnvo ()aexrxf oodlaD  nvo;t  etrxo3oudame mncs s srtrxmpou0aetomi3tydfm eaums;t)tltrif iytfmDr uvo;t srurxopiu4amtemivsa( sDtmxm nt0ale io3ils mDel(mo;t4 etoio3iy1la rlivsls)t2xo(o3iy4ol nlfcia()aDrmuro;o1apx moeiltfmDel(mo (0texrmoctatla  aieils  2xrio oy4omeemfcs ()aDrmx oou1altn i3tydlsDemnmpnu0 leoir3oytlpDe n ol(0 rum(m3nudolt  fct t)arumxm ;u4oltomfctyd sDelnvsnt)areomr3tytlp  lu sl(  etmio3io4lme  ncilsfs2um(m oo1oetn o3iat sDrl(vs;()trtoio3iadop r ivsls0srto(o3iu1lmtemiet sfaDtaumonu0ole  f3tld a elnvsn() rtrmf3oytlmtrlivi s srxoimpoudlle lneiatfsDurx p;t0texo ietydla2eluvonu0texnxo oo1lmDe n s;(0sexm(r3oo1lpee nvt sf Drrur oo0oeto feiytla rmnms (4tlxnxo3ia1lpDeli i;()srxoirpnudaptn neiatfs2rrumpno4oeeoiocils m emumo;t0tltoio3tatfm eaivo t0 2xoxm3iu1apt  nctat)aDrrx o;u0tlx  o3taslm2um(vont4 eenio3tadlmDrauvs ()setoxm nu1altn neiatfartaxmp;t0tex iietyd s elumo (4aeerif iotlmDelnes t)teumxr ou4lmee ies ( aDtrurp;o4oetoio3ildla eluvo;t0 exnir oy1op e ivs;t) eurim3no4amen nvilt s2rru p;o1aet  oeiadfm2um(vsnu)tleoiociydoaDeluvi (0 2tmxr oydoleelietasfs2rmxmpou1aexomociyt aDulump t0areoxf3tytfp  aieilt0 2xo(o oodomen nesa(f rur(mont1optnifetydfm2emu s;t0 lxrif3oy1oa rli slt  rtm(opiy4lmen fvsltfsDtaumo;u0tltoifetysfsDeau on(0trxoxfcio1oaDelnei;() exm(o3oydape mncsl( arurxro;u4tle ifctytfmDumn s u0arerif3to1oaDe n sl()srxrxrpiydamenmnes sfsrrmxrp;o4oeeniietydlm2rlu p;t0trenmociodlp rln s;s)sexoim3no4lle lici s s2uru ont4tltn fetyd aDua(mpnt0 eenxocoatomD luvi s sexo(o3ny1am  lieil(faDrmu pnt4opx  iciytfsDra(ms (4trermf3iytlaDelueolt0sexr(m iu1ale licsas arur(  ot1tlx mociatla2el( sn(0texrxf tydlp e ivsl()trxm(rpiy4lm elicias arrm( poo4alx  ieiad s2emuvs t0artrmo3iodomD aiei;( trxrim3oy1optn fvt ( aDuau o;u1openmieiydlmDemnvsnu) etnif3oatlpDe ivol(0t2umxrpnudame lnetl( sDur(m ot0tptnii3tlsfs2uauvpn(4texoxo3tadfmt an o ()texrio3iy1ole  fesat)artaurp;o1tlxomiciltfs emnvsnt0trtnmr to1om e u o;s) etr(o3oudolt  fvs (f Drau pou0aptnmf3ilsfmDumnmon()arxnxf3iatla   ivils trumio3iu4altn iesa(f rrru  ;o0olxo f3tlt a2ua(mpnu) rtnxf3iytoa rlivsl(0trxm(r3nydoleelivia(fsrtru poo4optoifctytla ean s;u4arenxrcoydfaDr u slt)trurxopnu4lmeemfvslt sDua(m nt4altomoeilslmDem(vo;u0tlxnxrcootfmtrlneols) rtm(o3oydalee nvt ( s2uau pou4aeeo fciadfaDulumo t0aeerir3todoa eln s t0 etmio nu4apee fvil( srumurpnt4oltomoeiat mDumnmsn(4 leriocty1oaDe ueols)sruriopiydom emfvtltf 2raxrp;u4tlto fciasfm2umnms;(0aetoxociodlat livols texmxo3io1optemfctl(f 2urxmp;t0aex  octld m2rmnmp u0teenir3iotomt li i;s0setoim3iodol n ics s s2uru o;u1oee ioeildfs2ranvo;t0arermr3todfp rauvo ( t2tm(r iu1am n icsl( aDrau pot1oex  oeiadfm2ran s;() ltrxf tatfmt  iei;(  2tmxm nydol  mivtat)sDurx ono1oeenmicilsls2ua(vpnt)altnxrciotlaDeluvilt)srumiopno1alee nvt s aDrax o;u4aexniictytfa2umu on()treoir ty1fp rlu slt t2tmxmpoo4lltemiciltfs2tr(ront1tpe  oeils m umn p u)texomf3todoa  anvols0trtmiopoy4ome lnvsasfsrur(r ot0tpxn fciasfm2rm(mon()artnmr tytlm eaivi;s)trtm(r ny1lp nlnvs (f 2rmum no0alxnifciltfa rm( s u4 etnif iotfpD lieo;(0t2trirpoudlltnmnetat  2rmumonu0olto f3tys m eau pnu4arxrxfciy1fmteluvo;(0srxmxr iodol nlfvs (fs2ur(m no0aex  i3iyslm2rm( snu0 lxoxo tytfmteauvo;s srtmxr3oodlpte nciasfs2raxroot1oee io3iatfmDem(ms;t0teenifciytomte uei (0 rxoimpio1ll n icils aDumx o;o1oltnifetld m2umn sn()aexnir3oadla raueo s  eumxrpiodlptn nviltf 2raxronu4texnmieiatlm rmu on()artoxr3to1fpte uei (0t2triopiu4op nmieias  rrrur nu0aee  ociydfs2rl(vs;u4trtoir3iotlmDe uei;( srtm(o3iu4apee nes ( s2ta(  oo4tex  fctldlsDrl(vo;u0alxoif ty1lm   i il( t2xrim io4lme  fes ( a2raxmoot1opto icildfm ranvp;t)altniocio1fmDean s t0 rxmxm ny4lme  fvtatfarua( p;t1aeeoif3iltlm ulu pnu)alxnxrcoy1latr i o s truoxmpoydam e nvsas aDrrxrpnu1opxoiociltlmDea( p (0 reoxo iydoatranei;s0texmxrpio1optnmnci s) Dra(monu1oltomoctyt aDeauvpn(0alxnxocio1lpDelneo (  2umxr ny1lmt  nvtlsfarta(rooo4aptoiociadfaDrm(vs () lxnxr3ootfmteli ols)t2urxr oy4al   fci t srua(moot1opxnifctytlm raums u0aeenmfcoydla  luvs t  eto(m iy1lp  mfcil(  rua(  ;t1alt ifeiatla eanvs;u0artrmrctydop  an ol() 2xoxr oo4lpt lnci tfarrrxm oo0tpxo fcias mDraumo;u)altoio oydlpt luei ()teur(rpiu1lm n iciltfs2taumpou1apxomoetlsfs2raump u0 lermf3tadlmt au s;(0texrio iy4lle lnvsl(  Drmxmpnt0oltnmociys a2el(vo;u)treoxf todom eau ol( seumxm nudaleelnvs t srum(  ;u0aex  o3tltls ran p;()trxrxo3oydop eauei t0trtrxo ny1lp  mivt (f Dua(ronu4oetomo3iltlmDeauvsnt4 exnir iodlpD ai s;t  rtoxopio4altemfeslsfa2taumo;o1aptnifetas m rm( s u0 etoxfcia1opt lieols0 eumimpiudam nmiesat) 2taxmo;t1olxnmiciasfmDraumont0aexnxo3oo1oa  ai i () exrxo ny4ap nmfcia(f 2um(mpot0oeeniicias mDra(vsnt4 etomo ta1fa ean s;t)teto(r nu4lltnlicslsf rtm(r nu0tpx iietyd sDrl(vs t4tltnio3oo1fate uvo;s  rtr(rpio1omtn ivtl()a2rau pot1aeen i3iat m ulumo;(4altoxo3tydlm elueslt s2xmxrpiy4lltnlfvtlt aDum( pou4alt miciytls2rauvont0tlxrxrctytlaD lnvslt)texoxo oy4lptnmfcsas arurx onu1open ietydfs emumo () renmf tatlm  au s;s) 2xoir3iy1lltemiesat  2rrurpou4oeeo iciydfm rmuvo ()texoiociatoaD lneol()t2ur(opiu1lmtemivs tfarrmx p;o1tex ii3tadfa umuvsn()altnmf todlptr n i (0sexrirpoy4lm  mnesa(faDtrurpno4tee  i3iyt a el(ms;(4altriocoa1om ran o;s)t2urxr nudamenlict tfartr(mp;t1tlxoio3tysfaDemu p;t0teeoir3oytop  lnes;t0sexmim iydam n nvt tfs2rr( o;u1tleomf3ild s2eanmsn(4treoir oy1lptrai ilt t2trim3no4omeemfvsl(f rtmxm nt4ape  o3ilslaDul( on()arxnxrcoatlpDranvols0s2tr(m3oudllt mfet ()arrrur ;t1tetnifetyd s rmumpn(4 rxnio3oadfmt livi (0 rumio3io1aptnmici tfaDta(ro;o1tle  octasfaDeau o u4tetnio3ta1laDe ueo;s) rtrxo3io1omeemfeias) 2ra(  no1aetomoeiytfa ra( pn(0alerxo3todlp raieolt0s2xmxo3no1optnmicsa(  2tm(rp;t1altn octytfs rl(vo;()arerxr3oa1opt  uvs (0trumxo3iu4omtn ncsls artrumpoo1oetn f3iasla2ul(mpn(4trtoxociotfatr ivi s)truoim ny1ameemnvt t  Dum(  no1tpx iociysls em(mo;u4 ltrxf3iydoa elnvo;( texrir oy4ame lfet s srtrxmono1opx mf3tldfmDra(vs;(0trermf3ia1oaDrlneils)srumir oudll emnetas) Dtaxm oo4texnmfctldlmDumnmsn(4 etrxf3iatom   iesl()t2tm(o no1lp nmivsatfaDtrxmont0texnmfctadlm ea( s;t) exomr iatlpteaues;t)srxm(r ny4lptnlicil(f Durx  oo4aee mf3tlt a rm( s;t4arxoxf3oy1lpD anei (0trxrxm3nudllen fetlsfa2rau pou0alt  fciydfm2raums (4 lxoirciytfaDr iesls  2to(opoo4aleemncsl()s2taxr no4aeenif3tasfa elu s;t) reoio3ia1oat lu o;t)trtrir io4aleelics sfsDumu pnu4texo fctyslsDel(mp t0 rxnxo oodfm   u o;t)srtmxm3ny1amtelfes ( sDra( poo4ape mf3tltlm uan sn()texoio oa1fmDeln il()seurir io4ol nmivtls  2trxrpot4tpen i3tydfsDumumont4aetomr io1oaDe iesl(0 eur(m3iu1ame  nvil(faDuau o;o4altoifeilt sDelu ont) ltomr3tytlpDe nvo ( t2uo(r3iydlp  mfci () rrau ont4olxnmo3tat a ul(mo;(0arenif3oydfaDr iesl(0 rur(r3iu4amtn fcias sDrrurpot4apxn o3iltlsDrlnvp u0tlenxo totlp eli o;s sexrir3ou1op   neias)artrx  no0alxnmi3iaslsDumums t)teenmociatomDrai ol(0s2tmxm3iu1aptemnct ( s2tmxm no1alt if3iysls eaums (4aeeoxrcoytfm  liei (  exoxo3oudomtn nes s srtrx  ;t1aex mocildlm2emnvsn(4aexnio3iodlmDrai i ()truoir nydlle licsas)a2taxr ot0tlxnifciytla rmumo;u)aetrxf ootfpDrauvslt)t2uriopny1amenmfctls a2trxr no0tpenioeiasfa uanvonu0aeeoxfcoadlpDean i s0s2tmimpio4om elies (fsrrr(m nt0ale mfeiasls2ulnvpn(4 ltnmoctytlaDran o s  exrio nu1omt  neilt)sruaumpnt0ape  oeiasfa2eau s u)aetrif iodomD an sl(0s2ur(rpiy1lm elnet ()arumumpnt4apto oetatfa2rauvs (0 lerio3tatfaDeanvi;s seuo(rpny1oltnmfcia() Duaxr ;o1tptnmi3ias m2ulums;()arxrxfciadom   uvi (0 2tm(opnodamtnmncs s) rtrxrp;t1opx io3tytlaDel(mpn() exrxf3oytop eluei;t0texmxr3iudomtemfcils  Dtm(mp;u4aeeoif3tydlm2ran pnu0alxrifcoadfpDeaneo t0seurio3nudole licsls aDua(rpnu4olxnio3iys m rluvpn(4trxrxociatfpt  uvil(0srxmim oy4ome liesat)aDraxront1aet  fciat a2rmuvp;(4trxnifcoytomt ai sls trtriopoy1lmt  fctlt) 2tm(m nu0oee  o3iyt sDuln p;u)artnirctadfmtrli i (0s2uoiopou1oltnlfeiatfartauroot0aeeoio3iadfm2eln ont)aetoir3todlatran s;t0trtr(rpno1lm elivtl(fa2taumo;t0tee ii3iatls umnvsnt0 rxoxr to1fat ln sl( srxoirpiy4lmtn neta(f 2trxm nu1tptoioeilsfmDua( p;(0trxomocoydfpt  ivilt  2urxr3iu4llee icsl(fa2trx pno4ale ioeilsfmDumnmon()trxnxo3ootlptraiesl(  rtrio nudll n ivias s2uax o;t1altnmo3iydfs2rluvs u4trenmo3tytopt aiei t) 2xoim3nu4lltnmnvi (fsDraxro;u4oet  o3tyt m2ran onu) rerir tatlaD lneslt)srumir3nu1olt mfvs t)srra(mpno0tltnmociysfs2rln on(4 exoxr3oa1lat aueslt0s2uo(rpoudop n ieia(f 2taxmpot0olxniieias s2rmnmonu0tlenxr3oa1lp   iei;(  rxo(rpiu4lmtemfet (fs2um(r oo4apen oeildfaDelnmonu0 lxoir io1la e n il( tetrim nu1optn ieias)srrax  ;o0teeniiciatfs um(msn(0 rxnmo3oa1fp  lnvs s0seur(r ny1omenlnctlt  Draxront4tltnmiciydfa2emnmo;u0tlxnircto1lpDrlues;() 2xmiopiydopeemnes s sDum(mo;o4tpxo ietat sDumn s ()trxnir3todlmD liei ()trtmir no1ome mnet ()s2uaxroot1tpto fctls s em( o;(4arenxo totlmt  nes;s0t2ur(mpnu1ape lnesa()aDtaum ot0olxoif3ilsfs2ra( o;u0aexoif iatopD  nvo t t2um(o iodope mfvsat arra( oot0oeenmoeiyd m ra( s;t4trenxr ty1lmtr i ols0 2xoxopiy4lpt mivt t) 2um(rpno1tpxomietyslsDrm( o u)tlenir tytlaDeli sls0tetmxr3oodam emnvsat) 2umxrpno0ape if3ilt a2em(ms () lxrmf3ootoa elneo t t2uo(mpou4omeemicsas s2tr(moot0tpeniociasfm2elnvonu) exnxf3todlptelies (0 rxrio3iy1ome  nes sf 2rax o;o4tet  i3iatfmDua( onu4trxomr3io1fmt an ils) 2xo(opiu4apenmnci s s2rmurp;u4tetnio3iltls2elu ont) ltnxo io1fa eauvi (0t2xr(o iudlptnmivia(  2rmxr ot0apxn iciyt mDel( s;u) rerio3tatlaDranvs t)setoxr ny4al nmivsl()aDtaxmpot1alt mieiltfm eln s u) rtrmrcoo1omt auesls  euo(rpiudlm n fvtl(fsrta(r nt1alx ii3tlt aDeau o;() exrxrcoa1op raues s0 rxr(o iudomtn fct t  2trur oo0ape  ictlsfs2rlnmp (0 rerxrcoo1lat lnei;( srtrio oudamte nesa(f Drauro;u1ale iietys a2elums;t0alenmrctytom  li il(  euoio3oodlpte ieiatfaDrrumoot4tpt mf3iadlm ulnmp;u)aexnxocia1lm  aies t)t2xm(m3iu1am  micia() rumu  ;t4texoii3ilsls2rlumpnu4trxoxrcty1oat lu s ()sexrxrpiydal nliviat s2umumooo0oeenmfeilt s2uanms u0arxomf3oa1oa eaivi;()t2xmxm3iydop e ietlt)srurxmo;u4altoifeiadfa eaumsnt4 rtrmocta1fmD an slt0t2tmxm3ny4lm e fet t aDtr(monu0tlxnioetyslaDran pn(0alenir3oodoaD  ivo s0trtrxm3iydamtemncil( artmxmoot4aleomi3tlslm ua(vs ()arenif3oo1fmDeli s s) eumxo3iydlptelnvils aDta(mo;t0oeenmoetat mDulnmp;(4tltnmocoa1omt ln olt0sexrir3oo4lpte nci sfa2uau poo4oee iociysfs2ean snu0tltrirciadfa   ivs s0s2tmxrpnodamtelnvtatfs2rmumpoo4tpeo fetlt m rmnvo (4tetnxo oatfp elivi;s0t2tmim oy4lp n nesa( aDtau pnu0oetnmiciatfm2uanvp;(0 ltomfctytfptrlivo s  2xm(rpny1amenmiet (faDrmxmont4tpt  ocilsfs umnmpnt4trxnxrcto1om   neo;t  eumim3nu1apenlneil() 2uru  nu0apt if3tasfaDemumo;t0tleoio ty1fpDelu i;s)s2urxo3no1lpe mies s)sDra( p;u1apx mocils a2ulu pnu4tltrirciadlaD ai s (0seurxopny1am eliciltfaDua(mo;o0texnmi3taslsDem( snu0aeeoxociodfmD livo s0 rtm(rpoy4am   ivsl() Dum( o;o4apeomo3iadlaDraump;u0alerxoctotomDelnvi;t trtoiopoodolte nvta( s2ra(r ;u4aeeo o3tadla umu p (0trxnmo tydlp e i i ()s2uoxo nu4amen fvi ( arua(mp;u0oet mfciat a2ea(vs;u) rxomr tytoptean i;s t2uoxo3oudameelivt tf Dur( ont4teen iciysla em(mp;(0texrxo3ootfatean i;s  eum(o oudoltnmiet t a2taumoot4tpto f3ilsfa2rlnvpn(0 ltoxrcoa1oatr ivilt  etmir3iy4lm elfvtltfs2rm( p;o1alt iociytla ulump;(4areoxf3oadlpD an o t)srtrimpio4lmt  fvsa(fs2rrxmpnu0olen oetasfa2emumsn(0tlerio3iydlaDr u sls)teuoirpny4lp nlneias)aDtrx  ;t0apenioeiydfa2ul(vo;u)arxnir3tydopt  i slt)trxmxr3nodop nlietl()a2rmxrp;o1teeoio3iatla ulu on() lxnxr3to1fmDrlneil(0trumiopou1llt  ieias  Drmxm oo0tlt iieiytfmDrlums u4teermfctatfa  lnes;t) rtmxm3nu4lp e nvsls  2tau o;t1opx iictydfs2um(vo u0 lxnxfcty1lp raivi s srtm(r oo4om   nvil(  rraump;t1opt mo3tadlm2rlnms t0artnxf3ia1laD li i s  rtr(mpoydopeelivta(  Dur(moou0apenioeildlaDumumo () rxrmr oydopt anvols) 2xoim3ny1omtelnci tfs2umum oo0ole mfeiatlsDra( p t)alxomf oadfptrliei;(0setoio nu4oleelici t)sDtrumpnu0ape mfeildla umn p (4arxomf iadfm   nvi;()t2ur(m3no1lptemiet ()sDraumo;t0opxniieildls2ulu snt0 rtrxr3oodfaDe n il(  rtoxr3nu4optnlieilt a2uaxm ;u4tex  f3iasfa2ranmp;() ltoio tatlate i slt)tetmxmpno4llt mfct t sDtru ono0oleo feild mDul( p;(0 etoxr totomD auvsl( t2xoim oydolte nvt s  rumxmont0alxn f3ilslmDum( s;(4 etnxf oy1omtraneslt0trumxmpoydome mfvtas) 2rmx o;u1aee ifetld s umnvs t4texoxo oy1fm rauvs s)s2toxo3ny1omenlicsas  2rrumono1tltnmo3ils m2ua(vo;u) etnxrctytom  lnvol(0trxoxr3ny4om   icslt)arrmump;t4tpxomo3ils m uauvp;() rxomr3ia1oa e nvsls) rurxm3iydaltelietlt artrur ou1aetomf3tls s2ea( o (4 lenxrciatfaDean olt0srtr(mpoy1aptemfvt sfsDraurpno1opxniocild aDrauvp (0arerxr3oadlmD  ivo ()s2xr(r iy4lp nlfeslsfsrrrxrooo1tpxomfeiatfa ranmonu0tlxrxr3oy1lpt auvi t)trurxr io1lpenlfeta(f 2ur(mpnt4aeeoioeiat m2umnmp u0artnmr tatoa   nvi;s srxmir no4am   iciatfa2rax  ;u4opeomf3iat m rm(vp (4 lxrmr3ty1laDeaueolt0 exmxrpoudapen nctas)sDumxr ot0altomf3tasfs ulumo;u4arxoio3ta1fpte n s t trumxrpou4optnlnctl( s2ta( p;o4tpx ioetydfaDem(vs (4texnio3iatlpD  n i;( setrxo io4llen ivs tfartmurpoo0teenifciltla2ul(vs t)texomociydfm   uei;s teuoxm3nodlm nmnei t)s2rr(rpnt1texnmoeiad m ulnvsnu0tleoiocio1fmDean ilt  rtrirpiy1amte fctls)sDtrx poo1aeen f3tls aDelu p;t4trxnifcoytlaDe n o s texmxm3no1om  lfvta( a2tauro;u1oeen oeiydfa2ra( o;() lxrmfcoatoa rai o s trum(mpoo1lme  nvsasf 2um(  ;t0tetnmi3tldlm2emn pnu)areoxr3todfpDean i s0 exrim3ou1omenlncsasfaDrau  nt4tptn oeiltla2ea( s;u) eenio3to1omDrlnvi t0seuoim iu4amtelnci (  2rrxm no4opx  oeiadlm2rauvs;u)alxrir3iadomtraies t0t2toio3iy4ll  mncilsf 2ua(rpnu1aptoif3iysla2emumsn(4 lxnmr iotlp rlieils t2uo(r3no4op nlivsltf rrrumo;o1opeo ieiydfs2eauvont4artrmoctotfaDrlnvs s)t2tmim3ny1am elncta()sDururont4altnio3iys a emuvsnt)arxomocoydopDraieo s0 2xm(m iydamenlnet t) 2ua(rpot4openii3iatlsDuauvs;t4texnif3ta1faDran ols0 2uoio3nu4lp nliei t)artmxr no4oexnif3tas aDumump;u0 exnxrciytfpDeln o t t2uoimpou1olenlnctlsf Drr( poo4olen fciyslsDua(vp;u0 rxrxf3iydlm elnvil()srurirpny1llenmnvs sfa2tmumpno1aeeomo3iltfm rmn p;t4trxrmoctytopDeai s t0 exmio nu1lleelieia()aDrau  nu1tpx  i3iyslmDuanvsnt0alxomf oo1opDrlnesl()t2urxopou4ap eliei () Drr( p;o4alen feiydfs rl(vo t) ltnmrctadoatelieils)trtrxopny1ll nlivi sf 2trxmo;u0tee  ieiysfs umuvo t)teermf oa1lptr uvi t)s2um(mpio4ol nlnvi s aruaxmpno4opeo oeild aDranvsnt)arxnmo iytlp  anei (  2xoiopnudap  mfeslsf rurum no1tptniicilslaDua( o u4aetrmr3to1oaDeaies t0s2trir3nydlmenlfvs t) 2rrxm ;o1apx mieiys s ua(vsn(0trerio oytlm raneslt)sexoim iodlmeelivta(  rumxronu4olt iocildla2rlu p u)aexrio iadfaDelues;s  2xmim3ny4ol emivtl( sDrmumono1olen ieils m rlumo (0 ltrxfcto1lm r ivsls s2um(m ny4lmtn icsasf 2ur(r no4ape mfcilsfmDeau o;u0 rxnxr3iodoatr neo;s) 2xoir3iudalen fvtlsf Dtaur nu4teeomoeiltla eln pnu4tleoxf ootlm  anei s0t2tmxo oydop  mfet s  2rm(mpot0oexo i3tytlm2rl(vp;() eeoxo oo1oa rli s t seur(mpoydapt lncia(f 2tmx  ou4oetn ieiaslmDemnmo;u) ltnioctodoaDeaneo;()s2xm(mpno1ap  lncils)s2ur( p;t4opxo i3tlsfa2eau s ()artrxociadom r n s s)teto(m3ny4lm n iei (f 2ra(rpoo1tpx  ietyslsDrm(ms (4 exrxo iadlp raivs;s)t2toio ou1amtn ietltfsDur(r ;u1olxoifetldfm emuvsnt)trxoxrcootfpteau o;t)s2uoxo iu1lle lfct t  2rmump;u1ope mictlt a2em(ms t0alenmfctydfateaues s0 2xo(m iy4altelivi ( s2rrxrono1tpeomi3ildfaDeau o;u) rxnmf3tydomteliesls trxm(r3nu4llt lietls) Dtrxrpnt0altnmiciys mDum( s (4tlxnxfcta1fatean olt)sexmim3oodlle mnvs (f 2ururpot4oet  octls s2ulu o;() rerxr3oo1fmtrauvo;( t2to(rpoy1alenmfvsls) rrr( pou1ope iieiys s rm( o;u0texnio3oydoa rlivi t0s2tm(r3iu4ll   nctas a2ra(mono4aeeo f3tad mDel(vsnu) lenxo3ty1om  aivslt) ruoxo3nu1olte nvta(fa2uau  ot1ale iieiadlm2eln o;()tetnmfctadlatean o t seuoxm iudop  lnvsas  rumu pno1oee io3iad a rmnmp t)teenmf3tadla   uvi s0 eur(opou4ome lfvta( s2rau oot4oet io3ias m el(mpnu4texnxrcio1fp  aueols0 2umir3oo4lltelivia()arrm(roou0teeomiciltfa2ua(vp t4alxrxr oytomteaneo;s seto(m3iodape  fcsltfa2uauro;t1tle mi3ildfmDel(ms;t) eermfcootlm raies s srtm(r3iodomt  fct (fsDrmx  ;u0aetnmf3iatlm2raumsnu)altrxrctatlmDrlivo s s2xoimpnu4omtnlicils a2umxmoou0openio3iadlsDum( sn()alxoxr iytlp r iesls0t2ur(mpiu4ame licia()aDumumpnu4aexomfciat sDrluvpnu)arxnxoctotomt  n o s0 rur(o ou1alteliei t sDrmx oou1olxo ictatfm rlnmo ()altnir3tydlpDrai i;s0 exrxo iydalen feia() Drm(roou1tlenio3tas sDraumo t4arxrio iatom  lnvsl() 2xoirpnu4llenlfct ( srtmx pnu4oeenif3iatlm2uanmp (0 renirctytoaD an ol() 2urirpiu1am nmfet sf 2rrumo;t4aet mictldfm uluvs;t0tetnir to1omtrai s;()t2ur(o iodapeemici t)s2umur ;t1tex moetasfaDul(ms t4 rtnmrcta1faD au o;s sexmxr no1ap e fesl() rtax o;u1aeeomfeiysfm uanvp;t4tltoxociy1faDr uvi;s0trxrxr iydll n ictlt)aDumxmpnt1teto oeilt m emnvo t) rtrmr iatoaDrli o t0 rumxm iy1lmen ncs ()s2tmxrpou4oeeoiietadfa2ea(mont0teerircoatlaD ai sl(  rum(m io4am   fct s a2um( o;o0optoifciytlsDrl(vsnu) exrmocoadfmt  nes;t)s2ur(opou1olt lnesas  rtmxr nu0olxnmieiysfaDumnvs;u4 exriociydlate ivolt)trtr(rpou4op  miet () rrm( pno4tle  i3iltfs2rln on(4aexrifcootoateauvi;(0 eum(m no1aleemfes tf Durxr ;o0teenmf3iyd aDul( ont4tlxomfcoo1faDrlnvol(0seurxr ou1llenlivt (faDtru pou1tltnif3iysla emnvont0altnmfcta1fmDe nei (  etm(mpoydop  lietas  Dua(rpou0tpx  octadls umn pnt)tlxrmf3to1laDe i i s0texrxm nu1oltemnvi (f rtmumo;t1apt mfciyslmDeaumpnu0 ltrir3ootlpD au olt) eumio io4alt lfet ()s2rrx  ;o4aexoif3ilt s rm(mo (0 etoifciy1la e nvs;t srtmio iu1ap emnvsasf 2truroot4apxoiociyd m2rlums t4 exnxo3to1fpt aues ( srumirpio4ap nmfetlt) 2rr( pno0tetoif3iltls2eanmo u4artomo3oadfpt  i o t  ruoxr3ny1apeemncs t s2trumo;u1altn oeiltla2rl(von()aexoxo oo1fpDr uvs s0 etoxm oy1lmt mieslt)srtrx  ;t1oexoif3tyt a rlu on(0 rtoio oytop  li ols)sruoxopiu4ol emivsls srta(monu1tetnioeiatfs ranmp;u0trxoif ia1fpD ln il(0teurxopno4lmtnmnes (f 2raxrpnu0tlenif3tas s um(vs;t)trxnif iadfp  anei;s0trtm(r3iydom nliesas srtr(mp;t4aexo f3iad s rlnmonu4 eeoir3oo1fp ranei s t2xmir oy1om elnvi t)aDrrurp;o4tleoif3iydfa um(vo;u0 exnmocta1la  aieo;s tetm(opoudomt lfetatfs2taurooo4tlt  f3iyt a2uln s (0 ltnio3oa1om  aieo;t)setm(m iy1altnmncsls  Drr(rpno0alxnmoeild mDumu s;t4 lxoir iadlp e ivo;() rxr(m3oydomtelnctatfartruront0altn o3iltla eln o;t0 rtoxo tadfmD ai slt)seurxr nydlpee fvi t) 2rrx pno4oltoio3tlsfsDranvpn()arxomrcoa1op   nes;(  2xoio io1om   ivi ()sDuaxrpno4aptn o3tys mDra(monu4alxomocoydlatraivsls tetr(m ny1opt mnctlt)a2rmxmpoo4olxo ocildlaDrl(mo t0tetrxr3oytomDe u ils)t2xoimpou4amt  fvt t)aDumurpoo4alxnioeilsfa elnvs;t4artnxfciotfmtran o;s  2toxr oy1lpe mivils  2trxr ou0apxomocilt a2ul(mpnt4 rtnif iy1omt aueolt truoimpoydlmee fvs s)s2rru  oo4aeeo i3iys m2uan pnt)trxrir3ia1la rln s;s0seuo(m3nydlpee fvils)arurxmooo0teenioeiytfa2uau s u0 rxoxf3ia1opt luvo;s)texoxm3nudam nmics tf rur( oou1tpeomo3iyd s2emnmsnu) rxrifcoatom e uvs t)texrxr io1llenlneiasfsrrmu pou0apxomi3tydfa2rln s ()tltrif3oatoa   i o;t trtrio oudamenmfcta()aDuaurp;o0alxn iciasls2ra( p u4 eeoiociotlmDraivi t)t2xm(r iu4lpeemnvtls  rra(root0aee mociyd m rm(vpnu4aeenxo iydlmt  nesl()t2xmimpnydom e iesa() rtr(  ou4ope iociat mDelu s (4tetoxr ia1laDraneo;s)srtr(o oydomt lfeil(fsruax  oo1tet  o3tadfmDem(mon(4 etoir3ootfm elivo;(0teumxo nu4alee iesatfartrxmo;t1opeoifeiydla2ulu p;u0 rxrmf iydlmtr u o s0srxo(o3iy4om emieil() Drmump;t1aet if3iydlmDeaumo t0 lxoifciy1lptrlivi t) rxmxm io1ll nmict s a2rmuro;t0tlto i3iydlmDul( onu4 reoircoytoaDrluvilt) rurxo3nodlmenmfeil(faDrrx  ot4opeomo3tyd sDel(vs;u4teeomr3oydom r nvsls0 2xr(o3oo1op elfcsat)sDurxront1aleoio3ils a2eln o () leomo totfp r i o t) rumir3iu1al elfvsa() Drau pou0aexo fetldls2ea( o u)alenmf3oodopD livs;s0 2ur(m3oy1altn ies (farta( ooo1opeoiicildfs2em(vo u0aetomf3ta1fa rai sl()tetmxrpoy1ame lnvt t)a2raxmoot1aet  o3iatfs ea( p;()alermrciotomtrlivs s0s2toxm3io4ole lfcsat)aDumumpno1oee ifcias mDuau onu) rtrmf oo1lpDelieo (0texm(o oy4openliet t)srum(m ;t0teeo fetld m2ulums;u4texrif oa1opDr uvols0trxr(r nu1alt lnct s  ruru  ;o0tex ifeiyslm2rm( p;t4texoxoctatfa r nvi s0 etr(o3oodamt  ncil( aDtmx ooo4apenioctydlsDuauvo;t0 exomr3iatfmDeluvsls0 eumirpiy4am nmnvs t) Durxroot4aet iicilsfs2emnvo (4teerio totoaDeai i t0trtmimpnu4lp emfetas)arrrxr no0aetn feiat a rl( o;u) eenxo ty1oatrai s;s0sexmxrpiodalt  fvsltfsrrmur oo0alx ifetydlmDra( pnt4tleoif3oatla  luvs;s t2xrxo oo4ole  ivtltfsDrm(m no4aptnmfetytls2ea( p;u4altrmf io1opDeaieolt0tetr(opnu4omtemfci s)a2umx o;o0tex  i3iydlm rl( p;u4aeeriocta1op raivs s  rtrxrpny1alenlicilt aruru poo0tpx mi3iatfa uaumpnt)artomfciadopt an ol(  etr(m3io1alte fcsatfs2rauroot0tex  ietatfs2rm(vp u)alxomf oo1oat ln ils)setrio3ny4ll nlfctl(faDumuroou1olt ii3tasfm umnmpn(0tlxrxociydfa  aieo (0srto(r nu1lmtemivsas sDua(rp;u0olx  feiyslm uluvp;u0tetrmo3tytoat an o t)teurxm nudoptelfeslt  rtr(mpoo1olxoifctytlmDuau s u)tltoxf3oa1fmDelivo s0texrio io4ame  iei t  Dtm(m ;t0ale mietyt a2umnvs;u0 exrmo3ta1la r nes (0 rum(m3nudolee fvs t  2rmx  nu0aet iieiyd s2emuvo u0trerif3iytfa elivo s trto(opiu4om n net () rrrxm ot4tpxo ociatlm2eaumpnt)trermfcto1faDrai o t0trxoio3oudopt livt sfsDua(r nu4alx mf3iat m2eauvon(0aeenioctydfp r nvo;( trtrim iu4al   nes (  rtrxrp;o1aleo f3ildfa emnms;()teenxr3ia1fp eaivsl(  rtmxo3nudope licil(f Duaur ;o4oetoifciys aDel(mont0tlxnxo3iadfm  lnesl() 2xm(m iydomte ivtas  rtmurpou1tex mfcild aDel(vs (4 etrxr iytfptrluvi;( trtr(m3io1ale  iei t) rum(rp;t4apeo f3iyt s eanmo;t0 reoxf oy1fpDelnei;t) rtmxr oodlpe lfvia(fa2uaxrpoo1tpx mieiat m2ea( p (4tleoioctydfmDeli ol()trtmim3ny1ape livsa()s2raxrpnu1tex mo3ias mDumnms (0alxnif tatlpDeli s t0srtoxo oo4oltemieslt sDtrurpou0tleo fciydlm2rm(mon(0aeerxf ia1opt  ivs s)srumio oy4apt mivsa(fs2rrxront0olen fctyt a el(monu4tltnmrcoo1fpt ai ils)sexrxo iydlmt  feiltfsrra( ono0tpto fctadls2raumonu4arxriociy1lmDe nvi;(0 2toio io4lp emnci t  rrmxmp;t0apx iieiatlm ra(vo t)tlerifciadlat lneo s srxrio oy1al nlivtlt aDtr(rp;t1opxn o3tysfs eanvs (0 lxnmo oytfp  aiei s0 rtrirpoy4apt livtlt  rta( pnt4oex iictys a2ean o;u4 lxomf3oo1fp r n ils0 rxo(m3ny4ol elnvi sf rrru o;o1aeeoioeiatfm2rl( p;(0 rtrif3iodfa  au o t0sexo(o ou1omt mfvi s aDtmxmpot0tlenioctytfaDelumo u)altomr oydop r n s;t srxoxm no1alt mivs t srtm(m ;u0oet  fciytfm rmnmo;t0arenir iy1latr uvo;s0 ruoxm nudopte fvias s2trxrp;o4tpxoioetatfaDea( onu) reoxr oy1lm eaieol(0 etrxr3oy1lpe miciat)artru onu4tleomoeiadls rmn p;t0tetrxoctytop  lnvi;t0 2toimpiodomtn ict ( aDrrur oo0tpxo ociltls ua(mp;t)treomf3iadoaDranvi s)s2ur(opnu1ol  mieilsfa2rmumo;t0olxnmocilsfaDumnmp t0trxrio tatlm   nvs;(0 rumirpno1ome  ncsls)s2um(m no0opxn o3iltfaDulnmont)altoio3tydla e n slt) rtr(r nydop e ics ( artmumo;t4oltomfciydls2um(vs;u)trxrxo ty1fpDrau i;s)s2xmio iodamtemnvs sfa2tmumonu4ape ii3ilsfsDrau o;u0aleoxo tatomtelueo;()tetm(r oo4ol nlicsa() 2ua(root0tlx  fcildla2umuvs;u4 rtomr oodoatr n s;(0 2tr(o3ou4lpenmivsa(fsrtax ono4opxoioeiydfa elums;t)trtrxoctatlpteluei;s)s2trxo3io1apeemfctlt  2tmumono0altomietytfmDumnmo u)aetrif ta1fpt  uvsls)t2xrxr iudomtnmfvsas)srrmxmono4tpt mi3tltfm2eaums;(0texrio iatfm eluesls t2tmir no1aptn fvsat  2umx o;u1tlx  oeiyt sDul(vs;t)tetrircoadomD lueo;s0 2uoio3nudlp nlietat)artrx  ou4olx mfciys m um( p;t4tltomo to1lateanvils)srxr(opoy1opt lncils) Dtau  no1opx mo3tasfa eauvsn(0 rxnmo iotfmtrliei t0teurxm oudlle  nesltfa2umxr nu1olen fetltfa umnmon(4aetomrciy1fptrln o s) exr(opiy1optnmnvsl( artr(moot1aeeoifeiadfm um(mp;() eenifcoy1fmteaiei t0 rxoir3ou4ol  mfcs t aDur( oou0aetnifciasfmDemnvp ()trtrmrciy1lat  i s s0srtm(o3oy4lp n icslsfsDumurpnt4aetomocilslmDulumpnu0teeoxfciodfmt anvs t0 rumxr3io4apt mnei sfarua( ooo4altn ociatfm2elnmon(4aeerxf3iodoa  anvils)sexmxm iu1omteliet sfarumx p;t1ape mieiys s ulumo;t0 ltoxf3ty1lmDrluvils teuoxopoo4lle mfcsasf Dtmx  ;t0tle mietatfm ra(mpn()arermr iatlpDe nvi ( seur(opou1oleemnctlsfsrraum ou4altnmi3iyt s2em( onu) ltnio oa1fate i i;s)teumxopoy1ll  lfei t srrmu pnt4oexo octls mDua(vs t0 lxnmo3iatfmtrai sls)s2trxo3ny4optnlfei sf rraurpnu1oee ii3ildls2em(vp t4aexomr3tydoaDr ies t0 eum(opio4omenlfvi tfa2ur(m nt0alen f3ilsfs2uluvon()arxoxf3oy1opte ivil( teurio3oydamte fctat) rtrxmpou0alxnmicils sDumump;t4aexnmf3tadom eanvs;(0srtoim3nu1omt mietasfsDraumono4altomfetyt s rm( onu)arxnxr3iadla eau s () rxrxmpoy4lmtn fetltfsrtrumpnu1apeoifctadfs ean s ()tlxnirctotlaD lnvil() rxmxmpoydalenmnvsl() rrmumonu4aeenifetaslmDuanmpn(4texnio totlm   ivo;() 2uoio3ny1am emfcsat  rtm(roou1tlx moeiatfs elnmpn(0tlermf3totlm eaueolt) rum(o3iu1aleelicsa() Drmx  no1tee iictadla rl(vo (4 rxnmocia1lp rauvi () 2trio3no4ol  mivi t s2ur( ono0tlt moetlt mDel( p;u) reomocia1fmDe neo;s0teumio3oy1op nlics t a2rmu  oo1tpenmfetys aDra(vp (4 rxrmrctydfptran ol() rtmir oo1lmtnmfvi t sDtau  ;o4opxo o3iadfa2el(vp;t0arermf3ta1fmDr u ol(  rur(o3nu1ameemnvsl() rta(rp;o4optomi3iytls2uan p;u0aleoxrcta1lp r nvo;t)sruoirpou4ol e icsl(fa2urumoou4open fctlt mDeanms t0 rerio tadlm elivi;t  2xrio nu4optnmfct s aDuaur nt0tlto feiadla emuvo;t) ltomocio1oaD  uvs s  ruoim3nu4alt livtltf rtr( ont1tet ioeildls2rlnvs;u4 etrmr3iodop e ivols srumxm oodolee ncilt)aDtrxroot1ope  ieiadfs umu pn(0tltnio oytfmte ivils  rurxo3no4op elnct s  2umum no1aeen feiad sDranvpnu0teeoirctatlmDelueo;s  etoxmpiydlmtelfviasf 2rmurpoo0tleo ieiyslsDuluvsn()trxnmf oytfaDe n i;t0seumio3nu1op nmiei s artaxrpoo4opxo feiyd s ulu s;()trtrmfciydopt  n ils0 2uriopou4omtnmiesa() rrmu p;u4tltnifcilslaDem(mo;u) reomf3oydfmt an i;t)srumir3oodal   ncsas)aDrmxr ;t1aee mfctydla2eau p;(0arxnir iy1lpt ln s;(0srtrxmpoy4amenlfvias)srurump;u0alto ociytfmDea(vpn(0teeoif io1omD liei t0seumio oo1lmtnlicslt) rurum ou4optn fciydfa rm( on()aetrmo3oatoa r ieilt trurimpnudaptnmivtlsfaDtm(mont0tlxnio3tadlaDumu sn(4 rxnmo3iadfpt anvolt)srxmio no4lp nmfviat)aDumurp;t1opt miciytfs2emu s (0 lxoxo iotoptr ivi;s trumxo3oo1llt mneta(f 2ta( p;t1opeo i3tydls umu p t)teenxfcootlmtrlieo;t)s2xm(o iy4lmtnmnviasfsrtaxroot0oee  feiasfm umn o (4artoxocta1lptraivi t0 2uoimpnu4opt mfetlt)aDum( pno1apenioeiat a rlnvs;(4 eerif3oydop elneo t  ruoimpny1ame lictlt) Dtaxmpno4opx mfciadlaDrauvo t0altomr3iy1lpt an i;t)teuoim3iu1lleelivta(  Drruro;o1aptn f3iasls ulu s u4trxrifciodlmt  nvsl( s2umxm ou4ole lnvi (fsrtaxrpnt1oltniietaslsDel(mo t)texoxf tydlmDe ivs ( trumxm nydllt  feias) 2uauronu0oltomi3tysfs2rmuvpnt0aetrio ia1fp rlieols0srum(o io4apen fvias a2raxro;u0tlxoiieiyd sDuln s (0altrmr tadomDeln s s) 2xo(o iudapenmfvt t  ruru pnu4oet  feiatla2emu s u0 ltomr3oadopDeanvi ( sexmir ny1amenmnvt (fs2uax ono1openifciatfa ua(mo;t0altrmocio1fm  lies;()trxoir3iodope  fes s)sDuru ont1tpeoifetys mDrlumont4teenirciatoatrlu o s0trtrio3ny1llee ici (faDrr( ont1alt ioeiydfaDeau p u)trermoctytoaD ln s t s2ur(o3nodole lncslt)aDtauro;t1oleomictas m elnvo ()tlxrio3totfaDeln i;t)tetoxmpnudlp  lnviltfa2trxmono0tetnmf3iadlsDuauvo t)trtrir3iadfptrlieo ( texmxr ny1ap  mfeta(faDrmumpnt4oexnmfetatfm em(ms;u0treomr3iatfaD  i s;s  rxr(rpno4ll n nes tf rumu onu4apeoif3ild s emnvsnt)altomr ia1lpDrln olt) rtm(r ou1omt liciat)s2rru ooo4opt  fctltfsDeanvp t4 lxnir oo1op rlnvils)t2trxm3nodomte neias)srur(  oo0oltomietyd a2ul(vpnt4arenmo3oodomDr nes;( truoxm oo4olte fvta( a2um(mono1olt  fciydla2rm( p;t)altrir3tadfmtelu i;t texrimpoo1ll e nvi s)s2umurp;t4teeoii3tadlaDelumo;t0artoxociodfat liei;s) rur(o3ou4lpenlnet s  Duau  nt0ole ifciyd a el( sn() etomr3totlaDeai s;() rtrxr ny1lpen fetls  2urxmo;t0ape mo3iysfm2rmump;u4trtnmr oadlp eli s;t srum(o iy4omenliesas)srtauroou1tpxo ociytla em( o;(4tleoxo3oo1opt  ueo;s s2xrir io1ll nmici ()s2ta(monu0olt if3iad m2eanvpnt0tetomf3ty1fp rliei t)seuoio oodopt mivsl(  Dumur ;u0olx mo3tas mDrln pn(4aetnir ty1fa r n o;s0s2triopoo1olt lfei ()aDuaumpno1opeoif3tys m2emn s t0teermo3iotfa rlu ol(0t2tmim3iodopt  fvtasfa2urum ;t0tpt moctatls2rl( p (4 etomrciydfptelneils trtm(r oy1lmee nctasf Dtau  ot1oeenmoctldls umn p (4 ltoxo3totomDe n s;s0srumim3io4op n fcsl()arraumpou0ole mietytlmDean on() ltoio to1fpt ln i t0 rumim oo1altelietl()s2umu onu4aex iociad mDra(vs;t0arxoifctytoaDr uei;(0teuoir ou1alt  fvtlsf rta( pou4tlxnmieilsfa ul( on(0tlerir3ootomt  n i t)seuoxr iy1lltn iesas)sDrm(mono4oeen ieilsls2elu snt)tleriocoytlatr ivsls)setm(o no1lpt licilsfaDrmu o;t0tpe  ictldfm uluvsnt)treoif todlpte nvi;t0 exrir3nu1lpe mfvi t aDrru  oo1aexoif3tatfm eanmont0tleoiocoytoat lieo;(  etoxr nu1openmfvils aDumur nt4aex  o3iyd s eanmon()teermrctatoa eauesls)texo(r3nudom elnctlt) rtrxrpno4aexoii3iys s emump;(0 rtrirciadfpD li s t  2xr(r3oo1omen ncs s)aDrau  ot0aeen f3iat mDem(vsnt0tetomrcio1om rlnvs;()sexr(o oy4op nmnvi tf rum(r ;o0optnif3iadfs rluvo u0texnif3oa1fp eauvolt0teum(m3oy1apenlfetat)a2ua( o;u0aet mf3taslm rmumo u0 lxnxfcoydlmD lnesl( s2urio oodom emnetlt  rumuro;t1opt mictls m ranms;t)areomrctadlmtr ueslt t2uo(r3oo1lle  neil( s2taurono1opt  oetatfs rm(vo;t) etnmo3iy1lm   n ol()texrir3ny4ol nmnctltfaDurxrpou1aeto oetas s2umu o;()trxnifcta1lptrluvi t  rurim nudomtelfvil(  rrmuroot4opxomi3iytlaDrmu pn()trerirctodoatr neils0t2to(m3oydamtnmiviasf 2rax o;t0tet miciltla2ranvp;t)tlerifcty1om r i o (  eum(r ou4am  mfcsatfa2uaumonu1olx moeilt m2uln p;() rtnmocto1omDeaivils0texm(m iydopenlnct s)s2tmx pot1oexnmo3tyt m eln s u0alerir ia1fp rliei;s  2xmxm nu1al elfct t sDum(  ou0oet iociad a2emuvp t)tlermf3ootomt  i s;t  rtr(r3no1omtelieiatfa2uaurpnu1aleoiocildfs2ra(vp u0 rxrmoctydfpD  neils  rxm(r3oodlleelfct s)aDtm(mpou4tet mfeias a ul(vsnt)trtnxrcta1opD auvs;s texo(m ou1ome mncsat s2ur(  ;t0tpe  octasfm2eauvont0alxomrcta1la rlnvilt) 2uoio iu1ap nlncs s)aruaxrpoo4tlt mictaslaDua(mp;t) exnmr3oydopD li olt teto(o3iu1lpen nesatf Durxro;u0oltniietatla rl(vsnt4 lxomocoatfm elu sl(0tetr(mpiu4amtnmfetas)s2umumonu0opeoifciat sDemnmo (4tltrir io1fmDr uvo t0 rtmim nodoltnlfvsat arraurpnt1tpxnmociysla2rl( pnu4aeenir iydfpt  nei;t0srxmxr oudam  lncs (  2tau  ;u4tlxoif3iaslmDeln s u4 rtnxf3iodom rli ols0sruo(rpiydopenmnvsasf 2tmx ont1tleomi3ilsfm umuvpnu)aeenirctytfm e ivilt0teto(m ny1amtemnesa(  rra(  nu0olxn o3iltla ulumo;(0teenmo3ta1om rlnvilt)tetrxr iudam  lfeiat artrxmonu0oexnii3iysls2eauvon()areomr3iydoat  nvo s t2toxm oudop   nvs ( sDraxm oo1aex mietldlm ea(ms;(0aeerifciodlaDeaivo;t0t2xoio3oydale mncs ( arrmurpno4aetn f3tld s2emnvp;()teermociydfa eln slt trxmirpio1lptelieiasfaDtruro;u1tlx ioeiad s rlnvp t4aexrif tydfaDranvils seumir3oy1opte nct ()sDtrxro;u0tlxomfeild sDua(mp;u)aexnmf to1laDeln s t truo(r iydamtn nvsl(fs2tax pnt4tpeoifeiytla elnms u)texnmoctadoa  au o;s0teuoir ny1lltelieiatfarum(r ot0ope mi3iydfaDemn s;(4tlxoxo iotomt  ivs t0 euoir3ou1amenlivsls) Dumx ooo0tpxo o3tydfaDumnmo ()tltrxr3tydfatr uvi s) rtr(m iu4aptelivtas) 2tm(m oo4tetniociydfs ul(vs (4 lerifctadla elies s  2umimpny1altemfei t sDtmu oou0opeo o3iydfaDranvont4tetrxo oodfp eau sls  2umxo3no4omt mies () Draumpnt1optoio3tytls2rlu snt4 rtomrcty1fpteau s;t teuoio3iy1lltelfvta(  rraur no1tpeoifctatfmDem(vont0 etoir oa1fat  ueslt0teur(opno1amtemncs ()arumumonu1olx  fciat m rlums;t4artoifcoydopDr ueols)seur(r oy1lpte fciasfs2tr( p;o1teeomi3tyslsDrm(vs (0 leoio3iotfmtelivols t2xoirpnu4apte fci t  rurxr nu1tltn iciatlaDelnvp (4teeniociytfa eaieils) 2um(r nudom   iviatfarrm(mont4tltn ociydlaDrm(mon()texrmfcoatla e nvi;s t2tr(o3ou1op emnes sfsrrmu onu1tpeoiieiatfm ua(vsnt0 exomrcto1oa rlnvi;(0 ruoxm oo4olt liesls)a2rmx oot4aeenmietad a2umnvs () rtnmr iotoaDraneo () exo(o iu1optemietat srtax oou0oet mfctyd mDumnmp;(0alxnir tytlp  au ils  eurir3iudalt mfcs (fa2rm(m ;o0tptomoeiatlm2uau p t4 renircty1faDeaneo ()seurxmpoo4omt mivs ( sDrmx pnu4oexoifcilsfs emnmon()tetrif oytfmtelnvi;t  2umio3ou4altn nci t) Drmurpot4tlx mfciyd s uaumo;(0aeermfctytoate ivsl(0t2ur(opiu1aptn icsasf rrmxrp;t1oet ii3tltlaDua(vo t4aetnxfciatfmt an olt seum(r io4olen ictatfarurxmpno0aptniieilt s2emu o;u) rtnir3iotoa raivolt t2ur(mpoydlpen ieiatf 2tm( o;u0tex ii3tys sDrlumpnt)trtrifcoatfpD  ies t0trxrxo3iu1ap emfcs ( sruaxmpnu4oleo oeild m em( on(0 reoio3oydomtrluvs t  ruoim3ny4omtemfeiatfa2tm(rpno0tetniieiytfmDumums;t4altniociytfa   iei;( s2tm(o iy4olenlncils  rurumoou4alto o3tyt aDeauvsn(4 eeoio oydlp ran ols0sexoir oudopeemnctas)sDumur oo0teeoiociltls2ra(mp;t4teeomr iy1lm  li o s t2to(rpny1amtnlneil(fsDurx pnu0opxo i3iyd aDrmump u4tltrmocoy1omtraivil()seuoxo3nodalenmfviat)aDurxmpnt1oexnmo3ildfa um(vont0 etrio io1oa  aivi ()texmirpno4lmen ncsat  2rm( oot0aleniicils m2ul(mo t)artniociodla  ln i s) 2tmimpiudamtnlfviatfs2ta(  ;u1apenmictyslaDelumsnt) exrxr oa1optraies t0truriopou1ap nmivi t s2urxr oo4openifetyt a2eaumon() eeoif totlmD lnvsl()tetrxm iu4alt  nci ()aDrr(m nu4olt if3tlt s umuvo;t4 exrxf ty1opD  ieil()srxo(r oy4lp elnctl()aDra(r no0aexoio3tyd a emnmo u)texrif ootoateanvols)trxrir ou4lp nmnvt (faDra(monu4aleo fetyt m2rln snu0 eenxrcoo1laDr i sl( seuoxo3io4al   ivsl() Duaxrpnt4tpe mfciltfsDea( on()trerxoctodomDeauei ( s2toxm iy1ol nlicta() rrm(rp;o4tpt ioctysfaDemuvo t) rtrxr3oydoatrai o;s0t2tmxr no4lme livsl()a2rau pnt4oet ifeiasfa2ulnvo u0tetrxfciodfmDrai sl()t2trimpnodomen icilsfs2rr(r oo1olxo feilsfaDelump (4tlxnxf oadoa   iesl(  euo(opiy4op e nei t  Drmxmpnt0open oetatlaDeanms t4tltrir ootoa  livi s0seuo(opiu4altelncilsfs2raum ;u4tltomfeils s rmn p (0 lxomo3iydlaD lneo;(  exo(o nydoptnmict ( sDtaumo;u0alen ociltla em(mo t4tlxrmfcoydlaDelieols  etmxm io4lptemncs t) rrrum no1tpx io3ils s2el( sn(0trtomr ta1lpt liei;s0 2toxo iy4oleemnct t)sDuaxrp;o0alxoiieild m eau s t0teerifciy1lmt anvslt)s2xoxo3nu4opt licil( s2rrxmp;t0ape  iciys m ranmon() renmfcta1lmD an i t  2xmimpnudlpte feia(  Dta(rpou4oex mfctatla2uauvp;u4tltomf3ty1optr u i;t teumio ou1aptn ietl( sDtr( oot0optn fetasfsDel(vp;() lermf io1fptr i il()srurir ou4lm e nctls sDra(moou4tpxo f3ils a rl(monu4 rxrxocia1lmtelnvo s)trxmiopou4ll  lfcs (f Dtm(  nt4oetoiociadfm em(ms;u4 rxoifcoadoaDrlu s;t)t2toxo iydam  lics sf 2ra(mp;u1oltnmfciadlmDrm( s (4tlermr iatfpD  u s t0setm(opoydop   fesl()srtrx p;u1tleoio3iysfm umu p t4altrmocootomtran o t setr(r3oudlltn fcil()aDtaxm nu0ape  f3tld m um(vs;()aexnifcia1faDe nvi;t t2urxm3nydlp  lfctl( aDra(r no1tpx  f3ils mDrm(vs;(4artrmfctodfp rlnes;t)trtrxr3oy4apeelnetl() 2rr(rpot1texo f3iltfs eauvsnu4arxnif3iytopt livils0seurxo3iu4lle lnes ()sDurxront4alt ii3iltlm ulu on(4tlxnirctotomDr ues t  eur(rpio1lpt liesat) Dur( ono1tltomieiadfaDum(vp t0aexrirctatlmDe uvo ( t2tmxo io4olte iviltfaDuru p;u4tetomoetadla em(vont4 lxnir iodoatrli ilt)s2xo(o iu4lptelfcs ()aruaxm nu4tetn o3iat m2uaums;t0aexrioctodop e nvils)t2urxr iu1amenmncils)sDrm(mp;t4oleniictyt a2rmums;u)texrxf3oatfp eluvil(0t2xr(opoydop emfvia(fa2ta(moot0aexnmociyslsDuln o;u0tlxnifciatlmDr nvo (0srtmxo nydlmte icslt) Dtrx  ;o1tpen ictldls umnvpnu)aexrmrciodoa   i s t)t2umir nu1lpte nvil() 2trumo;t0tle  ictld m2em(mo (4aeeoifciy1lpD luesls  rtrimpnydlmtn fvias  rrm(m ;t1olxnmfcilslm2uln s t)alerir to1fp   uvs;s)trtmio nudap   ietl(faDurxm no1teen ocias s umuvpnt4altoxrcoo1fptrauei t) 2xr(mpiy1lmt mnet ( aDuau  ot4aet  fciltla2em( o t0aeerxfcoy1omt luvs s  2umxo no1lmen fvt tfsDtr(  ;u1tpenii3iltls rm( on()aeeoxfcootlp   i i t0 rur(rpnudole  ivta( s2trxmpou1olenmiciasfs ea(mont0alxrxfctydfa e uvolt0trur(r oo1lp   nes t  2tmumpnu1ole io3iadls ea(mpnt)alermo iotoa rauvilt  etr(m oydal n ivsls) Drmx pnu0alt  o3tytfm2ea( snt) rxnir iadlm rlnvo s setmimpno4ape lfvsasf ruau pot4tpxn ietatlmDea(mon(0texrif tadfm r ieils) 2xmirpiydapt lfvtat)aDtm( ooo4oee iieiyt s rauvp u)texoxr to1om e i i;()tetrxm3oodam e fvtas a2tmx  nt4texnif3iydfmDeauvpnu4 eenxf io1lmtelieo;(0 rxm(m oudal emfetat  rrr(monu4opx io3ilsfs ul( s t) ltnifcoa1lp eanvslt trtm(rpoodlltnmncsls)a2raum ;u1openmictldfsDulumont) ltnmo ootfmtean i;()trto(m io1lme  fct (fsDtmurpnt0aexomieias mDuluvo ()alxoxf3iotfpt au s t0s2trxrpny4al nlieia(fartrxrp;o1oexnmo3iaslaDeluvs u0 ltrmrcta1omtr ieo t) 2umxmpoo1lle mfvi ( s2raurp;t0opxniietldfaDrluvp (4tetrxo oa1oatraneo;()sruo(opoydlmeemncsl(  Drr( pot0alt iiciltfs2emnms (0altrxfciadopD  n o t  ruriopoo4llenmiesa()a2trxro;o1oex ioeiasfm2eaumo;t0aeermo3iadla eanei;s srxoxmpoudopenmfcil( arrruro;t1tlto o3tlsfaDrmumo u) leoxo3to1fmDelueilt0 2ur(m3io4am elfcsa(f rtru ooo4tex mociasfm2rmuvon(4teeoxrcoo1lat lieo ()t2xoirpnudaptemfviatfartmxroot0tpxoifciysfsDum(ms;t0 rxnif iy1lp  aivi t  rxmio iu4opeelfeiat sDumurooo0oeeomieilslm ranvo (0tlenxfciadfatraivol(0srtmxo3nydoltnlfesltf rtmu  oo1aeto ociasfsDulnmonu) lenmr3oy1fatrlieo t0t2to(r ou4am nlictlsfarrr(m ;o0texnif3iysfs ra(mpn(4 exoircootfmtrlivo (0srumxopiu1alenmnvta( s2umumonu0openiiciyslm emnmon(4arxnxo3oadlp eli ols0srxoiopiu4omte ncia()s2ur(m ;o4ope ifciltfa2rluvont0tltnmo iy1om   ivs;s0trxo(o3oydaptnmnvsas sDraxm ;u0tet  ocildfa2elump ()tleoir3oatopt au slt0s2xoiopno4op e ivtls aDtm( o;u0tlt if3tld s ranms u0teeoxo3oydlmDrlies s0texrxo3nu1lm e ics s) rtr( pnu4tltn fctatls emnvo ()artnxfcoodlmDrlnvolt0srtmimpnu1altnmnvt s a2tmu o;u1teeoifeiatlaDuluvo;(4tlxoio tadlp  ln s;s teuo(mpio4olen fciasfarum(  ;u0oltn ociydlsDelumo;(0 rtnif3iytoatranvo t0 2xoim no4lmen ncia(fsrra(mont4opx mi3iadfs2elumont4artnif ia1lmt lnei ( teumir iy1am e ivt t) rtm( ooo1tpeo ocilsfs2ea( pnt4tltnif3ty1om eluvo;t0setoir iydlleemfvtat aDtmx  ;u0olxniocildlm2uan snu0trtnio3tydopDraues t0s2trirpiodomtnmfvtlt)arurxr oo0tlenmieiad aDrmu pnt0 ltnxfciadfa rai ilt  rtmxmpnodlm  mfvsl()arrrumooo4oexniietld m2ra(ms t) rtoircoydom raivi;(0 rum(mpoo4lmee iviat a2truro;o4oltnmiciad s ea( o;t4texrir3iy1lm rln ol(  2uoxr3ny1am n nciasfaDtaumpoo4teen ociltfsDea(vp;t0trtnircoa1lp rli s s)t2tr(o3iu4aptelicsas)sDrmxr ou1tlenmiciat m2rln o t)aeeoifcio1fpteli o t)tetmxr ou1ome lnctas s2trxrpoo0tlx  ieiltls em(mp;t4 rtnifcty1oat aies;s) rtrim3io4lleemfet (fs2tm(rpnt0tlx  f3iatla rluvs;t4trtrxfcoatlmD au i t0 2to(rpnydlmen fet t)sDtm(mpno0alt  i3iatlm2ean s;(0tltnxfcto1late ueils)t2xr(r3iy4op emies t)aDumumoou4oleoio3iaslm2rm(vsnt0texrif3tatlaD  i ols)teuoio io4lpee icias) Drmum ;t0alxniieild m2rmn s;t) lxnmfciadfatelnvsls0 2um(m3oo1lmtemncsl( a2ra( poo0opx iocilt aDum(mp t) etoif iadfpDelu sls  2urir oo4ape  fvsas  Drm(rp;u1openiociatlmDrln p t) eerir3ootop  lieo;() rur(opiudalen nvslsfa2ta(mpno4tpt  o3iydfa2um( p;t4trtnio to1fpD ln o t) rtmiopno1ape mfetatf rum(m nu0aleo ieiyt s2uau p;t0 ltomrctadom rau s;(0srurio3iudap nlnctas)a2tm(mont1aet mfciys mDrl(vonu4 rxnio3iy1fmt liei s) ruo(r ou1lmeemiviat)aDra(mpoo1oleniieiad s2uan o;()arermr3iytom rlnvi;t0 exo(r3iy4oltnlneil(fs2trum oo4oetn oeiys s2ulnvsn(4 etnxf iy1lp r n i s)trxoxm3nydape  ncsatfarur(ronu4tptniietadfs2eanmsnu) rtnmo3tatlmDelivs t0s2tmxopiydome mietat sDumu oot4apt  ictydla2ua( o;()aetrif3iodfm  luvslt setoio3iy1omtnlics (  rrau ooo4aetnmo3tldlaDea(vs u0 eermr oadlmt  nvi;t)trumxr oo1opt  neil( sDumumooo1olxo ieias a2rmnvsn()alxrxr3totfmtrli sl(0t2toxm3oy4amenmivtlsf Dtru oou0opt  ieiytfs2rmnms;(0trermf3oydfpteanvil( trurxr3oudlm  mfei t)arrrxmoou1tlx miciytfs2emums;u) rxrifctotfa rai s t0 2xr(r3nu4omenlnvia(f rra(mpnu0tltn ietat s um(vp;u) eeoio io1lmD lieo t setmio3iy4oltn fes s)aDtr( p;o0aet iieiyslm2ranmp t4tlxnxr oa1fa   i o;s)trtmxm3iy1altelict t)aDrmxmpnt4oexnmfeiadfs2em( p t)trerxo to1om  lu ils teur(mpio1al e fviat)artmxmpot1tpx ifciydlmDrluvp;t) rxrxf3oa1omDe u i t) etr(r iy4lp e nesat srrr(mp;o0tle  f3ild m em( o;t0artnir3ia1lmDean s t)trto(mpnu4olt mnctat)a2ta( p;t1oleoii3tyd a2um(vs u0altoxrcoo1oatrlueo;s0trxm(o3oo4om  lnvt ()sDrmx  oo1alxomo3tadlmDea( s (0 rermfctatopDrli o t) etrimpou4ap nmnvia() Dur( o;u0apt mocils s2rlu p ()altomrctadfp e i s;( srxriopnodome  neil()srraumpno1tltnmfeildla rmnvsnt)treomr3ta1fmtr ies;(0sexr(m nudlme mfetl() rrr(r ot0tpt  ietld a2ra(ms;(4 etrir oatlpD  n il( setoxo io4aptemfcias)srtmxmpot1oeeo f3ils mDuanvp;()aeeoxf totopteluvo t)s2xoxmpou1olt  ncs (  rum(  nu0apto ieiydfs eauvp;()alxrxfcio1opD  i i t  ruoirpoydolee iviasfa2tax  ;o1oetoii3tyslm ra(ms;t0 lermf iytom raivols) etmir oo4ameemnvt t)srra( oou1tlxo i3ias s2umumpnu0aeermo oa1lmD auvo s srxr(m3nodlpt mivt s) Drrxro;o0oet  fctldfm2ra(von(0tetoio3iy1opte n o;(0teurir ou1lm n ieia( s2tax poo4apxn i3ildlmDrlnvo t4 etrmr3iatlmD ln i;t0tetrxr iy4lpeemnvt t)aDrmxront4texnmf3taslm umu p;(0alenxo oodlaDrauvolt)trtr(rpnu4ap emncs t a2rmu  nt4apt  ieiyd s ulumont)teeomr todomDrai s ()t2umxrpny4ape lnvia(f 2ta(mo;u1optnmieiaslmDumumont0 rtnxf ty1oaDrlivolt)teum(o3no1alt mfctat a2trxro;o4opto f3iatlaDra( pnu4altnmr3iatlmDeauvols trxoxm ny1lptnlnvtls sDta( p;o0optoioetlsfs elu onu4tetoio ootoatr ies;(0s2xmxrpnudlm nlneils aDumxm oo1alx ii3iys a2ulnvp u)aexoxr oo1op r uei;()s2umxmpiu1ap emfesa()aruaum oo1apt ioeiltfm2umn o u4tlxnmociy1lpD  ues s  2xoio oudllte fvs s)sDtmxmooo4oexoif3ilsfs2ul(mp;t4treomr3oy1lmt an i ( teum(mpnydom   nes t)s2um(rono0tlxn feiydla2emu pnt0 ltrxocio1lpD luei (  2xo(rpiu4opt  ictls s2tr( onu0tltoioctad s rm(ms t4 rxnmr ta1fp  ai i t)trxoim3io1ape lnvs t)arrrx  oo4tlenmoeildfm el(vo;(4tlenxo tatlate u i ()t2xmiopoodolt  ici t s2ra(r oo1tetnmfeilt a2rl(mp u0treomf3oatlmDean o;t trtmio ou4alen ies t a2urxmpou1aeeo f3ilt s el( p t) lxoifcootlaD an s;t  2toio oodlmtelics sfaDtaurp;u4tlxoiietld a eau s;u)aetrircootomtelivs;t0t2xrir3no4llen ici t)sruaxrpou1tlx ioeiysfaDuln s (4 rtrxo3oatomDraieil(0 euo(opnodop nlnciasfa2rax  nt4olxo i3tysfs uln s;t0treoir oadlmt  i o;t0sexm(o oy4ol n ieslt)s2raxr oo1tptniocils mDemnmo u4aetoxocoatfaDeanvols) 2umim3nydame  net (faDuaumono1olxn o3iytfs2raums u)teerxocoytop e ivo;(  exrio3oudolee iciasfarurump;t0apx mf3tldls ulnmo;(0aexnmf oadlmt  u i t) exrxr3ny4omtnmicilt)a2uauront0ope io3tasfa2um(mp;t0treomr tatlp rauvo s) etoim nodlle  ivias)aDuaur ot4tpxnifeiadlm ean s t0treniociatlmtrlivi t) euoxmpnu4lpt lfvs t  2uaumo;t4oltoifcilsfmDul(mpnt)trxoir3iadlaDrlu ilt) 2xoxmpiudop n icta(f rtr(m oo4aexo i3ild s2rau o;()alxrmociadlptrau i (  2trimpnu1omen nvt sfarurum oo1apxnmi3tadlsDuanmonu4altnir3oa1op  ai i;(0trtrim iydam n ies tf Durumont1oltniiciatfs2ea(vo () eenif3to1op rauei;s0s2tr(m oodaltemieiatfa2tmx  ot0tleoifeiadfs uanvsnu0alenxfcoo1laD lieols0setoimpou1ll n ncil()srtmx  no0aet ioctydla2ea(vs;t)altrmocoo1fatranes;(0s2uoimpio1lmte ivtat  2raxroot0opeo ociydla rmu onu) ltoxo tytfpDeliei s)t2xoir no1lleelfvtltfsDrrx poo4ope  ocildfaDua(vsn()artnmf todomtranvol(0trtmxo3oo1lleelfeslsfsDrrur ot1aptnmociatls uaums (4 renxo tydfm e iei;t t2to(rpno4oleelnvsls) rraurpno0tlxnmietasfm ulu o;(4 exrir3iydlpt aivsl(0srum(m nu1omtn net (fs2ur(m ;t1tptn fciat m2emuvon(0 rtoxfciytoatraieo t0 rto(opiu1llee ncilsf 2urumpnu0texn i3iadfs2ulnvon(4trxoif ootfmDranei t srxrxr ou4oltnmnvta()aDtr(ront0tlxnmf3iyslm emnvs;t)alerxr3iytopD  nvs ()s2tm(opnydlm e nvi s)sruru  ;u1tlt ioetls aDrmuvon()tlxrxrciotopD  ueo t0setmim3iydom n iviasf Drr(rp;t1oexn oetysls umuvont0artoxo iy1opt  u o ()tetrxmpoy1ll elfeil() Drrx ooo4tpxoifetat s2umn on(0tltoifciy1fatrluvil( texr(opoo1am nmies () 2tr(m oo0oee  octyt m2ra(mo u)teenmfciydopD lueo;t) eurim3no1am n fvsat) Dta( p;t1tltoifeiatlsDranmp u)alerif oydop eln o () 2xmio3nu1opt mnctl() rta(r oo4oee mo3ild mDeluvs;t)aleniociy1om   i ilt0t2urio3iudap e ietltfaDta(mpoo1oeeomietys a2el(mp t) reomocoo1opDr nvo;(0sruoxr ou4omtnmfvias  2urum ;t1texnmfetysfm eauvonu4 lenxocoo1lpteau s;( sruoxrpiu4ame  neil()sDrm(mo;t4tpt mf3iyd s rmnmont4trtnxo3iadoat au i t)teum(m oo4olt lfciasfsDumxmoot4oex iieiytlm elump;(0arerifcto1lpD ln il( s2xrio3io1ap elivsas aDta(r ;o0oetnif3ilsfaDrln s (0 etomr3oydlp e ivs;()seurxo oydom nmnct ( srumur no4opt  feildlmDumnmp;t0altomr3io1lmDrai s s truoir3nodop elicias)s2um( p;u4tex iictltlaDem(ms;u)treoxr3oatlmDrlnvs;t seur(o3nudolt lfvilt  rrmump;o0tee io3tltfsDel(mo u)aetomrcoa1fm  luvo t) exoxrpnu1ameelfesasfsrtrx pot4opx  octadla2uaump u4aeeomf to1opDraivi t)s2xo(m3ny1al   feil()arurxrp;o0tpeo fciys m eau snt4alxrmo3ta1lp   ivi (0srum(rpoo1lpe mnvia()aDrax onu0apxnmi3iytfs rmuvo;u4tetrxr3oydop rluesls0 rurimpiy4alte fvia( aDurxrooo0olt iiciadfaDea(vo;t0aeerxfcootlmDraueo () 2uoxo3iydlpeemnvi tf 2ua(r ou4oeeo ieilsfmDrauvo;(4trxomo iydomD au slt0t2to(m iy4amenlnei ( artmumpnu0aetnmociadfa2ul(mp;(0tlxoxo ta1fa rlu o t  eurxopoy4lmtnlici s s2rrxronu4aptnif3iatlmDran s;u) ltoxo3iydop r i o t0 2xmir ou1omt lnei tfa2rrxroou1opx micilsfm raumo;u4 etnmr tydomD luvo;s) 2tmim iy1alte nvs t  Drmu onu0tpe iiciytlaDea(ms ()aetomr3tydlat lneolt0 etrxm iydamt mncils) rta( pno1optnifctysfm2el( ont4 eermoctodoa   nvs ()t2toxmpiodlltn iesasfarrrx onu0alxnio3tytla elump;u4 etriocto1la e ivsls  rtr(o iy1lpte icsltfaDta( o;u4apeoii3ilt s uanvont4arxomo3iadoaD lu i;s0trtoimpou4lpen iciat)sDtrx oot0opxo ietatlmDem(vp u0arerir3iodlp  aivi s0teuo(m ny1lpt  nesls) rurxm ;u1aptn ociyt s2eanms u0aetrmr ootfat aivol(0 eumio oodal  lfcil() 2tmxrpou0olx  oeiad sDemnvo (4 eeomo3totfm  au olt s2xrxopio1al nmnvil( sDum(rp;t0tlen ictatlmDelnmp;t4aetriocoodomDrauvil( s2trxm ny4al elnci s)srumx p;o0aleomf3iydfs rau pnu0tleoxo ia1faDeluvsls)trxoio3oo4alenmfvils) rtrx oou0tltoioetls sDel(mo u4 lermocootoaDraueo;s)t2to(o3ny4olt miet sfarumumoot4oee mictls a2rmumsnu0 rxomr3todomt auvolt trtmiopiodap n feslt aDtau o;o0tltnmo3tys mDranmsnu) renmf iy1fa eaneo;s trum(mpiudlleelicilt) 2trx o;o0texnmieiysla rmn onu4tlxnmr3ta1fatrln i;s texmim3iu1lptemfcilsf Dta(rono0oetomoctytla2ul(ms;(4 lenxoctydfaDe ivi;s0s2xrxm3iodaptn fesas)aDraxm ;u0teeoiieiadfa2um( pn(0 rxrmo tatfpDelnei t0t2ur(r3nodoleeliet s) Dtmxm nu4olxoifciadfm2uauvpn(4 rxoxfcootoa  luei;()t2tmiopnudam  lnct s)srrm(m ou4optniociytlm umnvo u) ltomoctodfptrlnvo s) rurxr3nudllt  fesl( arum(moou1tpe  fciydlaDuln s u) rxoxf3io1op e iei;s) rtrim3ou4lm elfcs sfs2rruront1aexn feiadfsDumu onu4 lenio ia1lp e n ol( t2urxr nodomenlfcta( s2rrx o;o1tpenmiciyd a2um(vp (4arermo ia1opD aueol( truoim oodaltnmncs t)srur(mo;o0tlxn feiatlm ul(ms t0arxrmo3ta1fp raueol( t2tm(r oydomeelfvil(  Duax o;o1tlx mfciyd s2el(vonu0aexnio3oydlpt lnvols0trxriopoo1opt lfeslt arrrur ;o1opxnioctysfmDrl(monu4 rtoxrcootla eliei;s  rurxmpno4am nlnvsl(fsDrmx  nu4tlto ociys mDranvo (0trenxo3ia1lp   neo t srxo(mpiydamt micils  rrmxr no1oee  i3ias s elnvp u)tlxnio3tytlptean i;s0trtmim3nu4al emfei s) Dtmumpoo4alx  ociydfs2ua(mp u)tetrxrcto1fp  lneols)s2xmxr3ny4lmtn iciat)arta(rp;u1apxn ociyslmDumums u0 rerxf iatlptraies;( texmxm oodllen feia()aDur(r ot0aee mf3tatfm umn pnt)tltrir3todopteauvo;t)trtrxr oudolen ncia(faDrmurono0aeto f3tldla2rl( onu0 rxrmo iatfmDrai s;s)sexrir3nu4omtelnctas arurum ;u1alt  ociad s uan o u4 rxnxo3ia1faDr ivs t0 2xm(o3no1op   ietat)a2trump;t0ope  o3iyt mDemumpn() rtoio3ta1optelivs;s0s2trir3no4lmtnlfcta()srtr(moou1alxnmfciltfa eln pnt0 rtrmrcoatlmteaueols) exoxopiy1lpenmnci (  2ua( p;o0tle mi3iyt a2rmn s;u)treoxf3oodoat  i s s)sexr(mpnodomtemnvt sf rumxr ;o4aeto oeils s2umums (4 rxrir iytfptrlivi (0 2uoio oudlm emfvilt srrax o;t4opxnmi3ils s2umuvpnt)aexrxr tadlm eaues ( texoxm3io4am  mnvslt) Dtr( o;o1tltoifeiytfm em(vp;t0alxrxf iodlate ues;s) exrxo oo1lltnmneslsfa2umxmont4tlt ii3ildfs2ulu o;t)altnmoctodlm  ai i t  exm(r ou4amtemfetltfs2ra(rpou4optomfctadfa rl(mp u4aetomo3iatfatranvi () euoxr3iodope lfvtl( aDraumpoo1texnmieiyd s2raumo u0aeeomr3to1oateanvsl( sruoxm no4lp emfesasfartr(ro;t4tetnifetyd a uau p ()texnmrctytfpDrlnes;(  2um(o3iu1olenmict s)aDrmu  ;t4tetnmiciydfa em(vsnt0altnmocoy1omDe ies;()trtrxrpou4opt mivsl( a2umxroot4tlt  ictat mDeau pnt4altomf3iydopD  neo;s trxr(rpiy1omee nvslt) 2uaumooo4alen icilsfs2rlumo t0artomf3oatfmtrauvs s0t2tm(m ou4lleemfvslt) Dtmurpnu0optomo3iydfm uaump t4texoxfcoo1opDeaueo ( s2um(opiu4lptn ivia() rur(mp;u4tlx mieiydfmDua( o t4aleoxr tytomDrlnvolt0 etr(opno1lp  lnvsa(  2umxmpno0apxn fciatfa2rm(mp;(4 rermr iatlpt  nvsls trxoxo nu4al n ies tfarraxm nt0oexo i3ild m uanmp;t4 ltomf3to1op  lnvo;t0 2toim nu4lm   fes t)a2rrurp;t0tlx mociydls2ua(vpnt)texomo tatlmte uvil() eurxrpiy4amt miesa( aDuru  ;t4olenii3iltlm ulums u)aeerxf3oa1lpDrlnvsls) ruoxrpnodolt lfvta()aDtrxmpno1aexniictldla umn onu4aexrmoctotopte n i;s0 etoim oo4oltnmfes t) rrmur nt4texniocildfmDrm(vsnt0trxrxo oy1fa eli o;(0t2tm(opou1altemfvsas)aDtm(mo;o4tpxo f3tadla umnms;()areomr3io1lm rlueols0 etr(o oy1om  mfetls s2tmxrpnt4oex iociyt mDum(mp u)teermf3todopDeau sls0t2ur(r io1omtelfetlt a2rmumpnt4aleo ocias s ulnvo u4 ltnxo3oodomD  u o t0 rxoim3nudll  livta( arraxrono4tleoiietlsfa ea(mo t4 lxrxf3tatfmD anvolt t2to(o3nodalt  ivtls  rrmu  ot4oltnmocild s rmu o;t)tetrir3oatfaDe u o;s  2tmimpio4ape  nvias) Drax pnu1tee iieildfa2rl( pnt4 rtniociotfpDeli i;t t2xr(o ou4oltnmfeils  2rmxmo;o4oeenioctatls emu s;u4 rtoxfciotom  lueo;(0 ruoxm iodamee ivslsfsDtmu ono1oltnif3iytfa eauvsnt4tlenmo ta1lpD livs t0s2umir3iy1lptelnviatf rum( p;o4apeo i3iat aDeln o;t4 rtomrctodop  anvsl(  2toirpoo4om nlivs ()a2tru  ;o1oex io3iltlaDraumsn(4tetomf oodopDeai s t)trxoxm io4amt lfesls)s2tau  ot0tltn o3iatlmDulu o;(0teerxrctodlmt ai i t sexo(opnu1omtn fvia()arrrxmo;o4alxoifctatfs emuvp;u0 lxnmo3totomteaieols)teurxo3ou1oltn fvtlt)s2rmxm nt4alt mieiasfm eaumsnu4texnxr iotop rlnvolt  rtr(o3iy1ame lnvsat)aDtrum ;o1opxoifctysfsDuluvs t0 eenmo iydom rau s s tetmxopiu4lm e nvsas  Durump;t0tpeomfeiat m2umums;u0 rtrmf ta1fmD lnvsls t2tm(r3oodam elictlt)sDrruro;o1alxomieiasla rl( o;() rtoir totlp eli ols0 euo(m3iydlmee fctlt)srrmur oo1tlt ifctysfa2ua(mo u) reoiocoydlaDr neolt teto(mpoodopt  nci (fsrur( o;u1aeenio3iyt a2em(mo u4altrir3ty1fpD auvslt) 2urim iy4lmtnlnvi sfs2tr(mo;t0tlto o3ild m2ua(mo (4 etoxr iadlaDr ivo;s)setoxrpoo4lpe mfct tf rrrurp;t4tltn i3ias aDranmo u)arxrmf3tydfpDr ivs;s0 rxmir3ny4altelfesat  rta( oot4tpe iociyt sDeau o u4trenxf3oo1fmtrln ols0 2xrxrpoudapee fetas) 2urxm no1olxnif3iatfm2ua( pn(4artoif3ootla  lnei;s)srtrio3iydoptn fvi s)s2tru  oo0alxnmfciyslm ua(vs ()aexnmo oo1opt  uvi (  rxmxopio4am nmivslsfs2uaumpnt4aee mictas s2eln pnu)arenxf ia1op eluvo;(  rxmxr oo4ame lnvsasfs2raxm ot0texnmfctltlmDumn onu)trenif3oadop   n ols0 2to(o oudlltn feil()aDumxroot1tetnifeiadls ranmo;t0 etoxf iodoatr uvi t) 2tmxmpnydlpeemfeias artrx o;o1apenmieiysfm2ul(ms ()texrxo3todfat  nes;t0sexrimpou4oltnmfct tfsrrm(ront1opxn iciysla2uanvs;u)alxnif oa1faD  i slt  2uo(m3io4optn feiat srumxm ot0aetomo3iatla2ua(vs;() leoxr3todlp  aivi;(0srtmxm3io1lmt lnvt (fa2tmxrono0teeomo3tadlmDrm( p;(0arxrmr3iytfmDeli s () 2um(m nydlmtelfei t arra(m nt4olt  ociatlsDua( s;u0tltoir iodfpDr n o s) euoxo oy1open ivs sfaDtaumono4tet mieiltfaDemnms;t4trerif3ty1om  aieo;t0 rxrim3nu1amtemicta(fsrur(  ot0alt ioctad m2um(vo;u)tetoircoydfa elivsl() ruo(o3iu4llt  nciat  ruauronu0opt iietysfmDumn s;u0artrmo oo1lp raies;t teumxo3iy1al nmfci ()a2uaump;t0tltn ietadfs emnvon()tleomfciatopteaivo s0 etoim io4lle  nvi (f Duaxmpou4oeeoifeiatlmDumnmpnt4aetrmo iadomDrlnvi s) 2urxopnydapt liei sfarum(m ;u0alt mictasfa2ua(vo u)alxrmfciodop r i s (  etr(r3ou4ope lfei s)artm(  no0alx  i3iyd s2ua( pnu0areoir3oydlp eln i;( s2urxrpiudlp emneiltfsDtaxr ot1tleo fctas aDra( p;t0aetnmfcty1fp   ieo;s trtr(r io1ap n fetat arrax  ou1oex  o3ildlm rlu snu0arxnxf oa1op elnvo;t  rtm(m3ou4opeelfvsl(f 2rr( ooo0tetn ictlsfm2umn o;(0 rerircia1oat  nvo;t)s2xmxr3iodap  mfvi (faDrmuronu4altnifetys a elnvon()trxrif3oy1fa e n i s s2xmxr oudam  miesl() Dumxmp;t1aeto f3ildfs2rmu p;(0aexoif ty1faDean i t) ruo(rpnudlpt  nesa( aDrmxmo;t0tpxo ietadlm2rluvpn() rxnmo3oy1lmtrauvs s0t2uoxm3nu1omee iesls) 2rrxro;t0apxnif3tatfa2el(vpnu4artnir3ta1oateau s s  rxrim3io4amenmnct ( a2tm(  nt0apeniieilsfsDran pn(4 exnmf3iatom eli o s0trxrxr ny4lp elnct t)srtaur ot1alxnmfeiatfm2rm(ms (4treoxrciatlm rln i;s0setoxo oy4om   feia(fs2ururpnu4tetomietldfsDea(ms;u0arenxr oatlp  li ol() exoxr3oo4lpt  neiat aDum(m nu1aexn i3tysla2rau p (4aleoir3iotop elues s teur(o3oodoltn ncsas) Dtax pou4opxnifciltlsDeau p u) eeoxo3iy1fptrauvi;s)t2to(o ny4alt mietat aDraum nt0olx mietydfa2elnms t0aexomr3oytlpD  uei;(0s2xrim3oodlm nmnvs t)aDua(  ;t1olxo ieiad s rlnvo (4aexnifciy1lp eaivs;s0t2xmxm iodom e fcias)aDuauroot4alen i3tldfs2rlnvpnt0arxnmoctydoaD  u ols0 2xmxmpiydal  mieils) Durxront0aex miciys m eauvo u0aleoir3tydoateaueol()s2tmir3nudolt lictas) rtmurono0oeeo fciaslm2em(ms t)alenmrctatfpteai i;t) eurio nudole mnetlt aDtm(mpno4ope ioctytlsDra(mo;t4arxrmf tadfm rli i t0s2xm(o3oo1am  mnci tfaDuru p;u0apenmfetydfsDranvo ()tleomr iatfa   nvil()teumir ou4lp  lncsl( srraxmpou4opt mf3ils a2ulnvs t4aeenmfciadlaD an o s0srumxr3oudalte nvs t s2tmu ont0aexomiciaslsDuau pnu)tetnif iydfaD luvolt)srxo(o ny1op nmfesas sDrmuronu0alxomiciysla emn o;u4tlerxo io1oa rluei t0s2xoxopiy1ol n ictlt)srtrx o;o0tpeomociysfm2ran p (4teenxfciotopteaueols)sexoir nodomenmfcsl(faDtm(m ou4teeomf3iltfm2um( p;u4alerxo3ootoat luvs;t0 eumxm iu4opee nct ()sDumx  ;u1opt mieiysfs2uanvo;u0aetrmr ia1om ran i;s)t2toim no1al n iesas)aDumxmo;u4ope moeild m rl(vonu)arermr io1fpD  uesl(0 2to(opou4ope lfes s  rrmxrpnt0oet  i3iytfaDumnvp t4 lxrmf3tatlp e ieo s0 2umim ou4opt lnvt tfartm(rpno0aeen o3iad sDem(ms;u0 etnioctydlpt lu s s  eumxm3no4opte fcsa(fa2tru pot4apxomieiadla uanmo u4aexnif ta1fpD li s s truoxo3oodom  livtl( sDra(roou4ape mfcilt a2elumpnu4teermf3oytlmD anvols)s2tmxm3iy1ap emnvi sf Drmu  nt4tetnmoctlt m uln snu)altrmo tadfaD luvils s2tmxopnudamtnmfctatf 2rau ono4opeo octatfaDuan s t0 leomfcoy1fa  lnes;t0teuoir3oo1ll  lnvtlt a2umxronu4opeoioeiasfa2ulump;u4treomrctatomt ln ol(  exoio nudop elicsa(  2tmumoou4oetomieild m rm( onu0 reoifctydomD auvs s trxr(o3ou1apeemncsatf rrrxmpno1texomfctltla uan sn(0aexnxrctytlat aieolt)t2toxrpnudlmte ivia()aDuaxmonu1tex  oeiad mDulnvo u) renircoa1oaDe nvi s t2xm(r oo4lltnlivs t  Dtmx pnt4aex ifciysfsDrlu pn(4 exrifcootopD  ivs t0setrxopno1ll  lictatfsrtr(rpoo1oex ifciadfm ean p;u4trxnirciadopDe u s;()texmxopoydoltnlncil(f rtrurpnt0alx mi3tad a2umumo;(0altrmr tydlpt  ivils s2urio io4aleelnei t)s2trx  oo0oex  f3iys sDemuvsnu0 rxrmo to1lmDeli s t s2urxm nydolenlnvt (f Dtau  no4aptomo3iys a ranvs;()tleoxo iodomDrau i;(0t2xm(o oo1lpt  nci sfsDtrxr ;o0tetnmociltlm2um( p t0tlxoxf3todlmteln o t)teto(rpoo4am nlncsa()sDua( ono4optnmietat m rm(vs u) eenxrcoo1fp  anes;(  2trxopnudlpte nei t)s2uaxr ot4teto ocils mDemump u)aexrxociy1fmtrlies;t s2trxr iy4llte fct (  2umxm ;o4tetomoeiad m elnvo;u)arxrmo3oo1lpt  i o;s0 rxmxm3ou4altnlfvtlt  Dumu  nu4olenmfcildlm ra(mon(4tetrxfcto1fmDelueols)srxoir3oo1omenlics ()sruaxro;o0aex  ociasla2uln snt0 etomf oatom e ueolt0s2uo(rpnudopen nvt t)aDuaum nu4opeo octltfa rauvpnt0tltnmr todfpD li ils  rxr(o no4am e fetls)sDtaxm ;o4olenmfeiys s2uan p;t) eerif totoat anvils)sexrxm ny4ll   ict t)arumx o;o4openmfeiytfm2rluvsnu)aeeomoctodlaD au s ( s2toxopny1alt  iesatf Dtaxrp;t0alxoioetad s2emn o t) lermfcto1optr ivils) 2uoirpny1llt  ncs tf rur(m ;u1tpen feildlm ulu ont0altrxfcoo1laDeau i s s2xmio3iodoptnmnctl()s2tm(  nt4opeo oeiltlsDelump t) rtomfciytfmDeaivi s)teuoxm nodomtnlietlt)aDrrxrp;t1aleo f3ild s2rmums t) ltrxr3oy1lmt aueo;()t2xrim iy1aptnlfvta(  rtmxrp;u4teeomf3ilsfa ua( sn(4 ltrxociytoat aues;s0trtrxm ou4lme liciatfartmu  ;o1aptn ocild s ul( o ()arxrmo iytlat  uvils trxr(o3nu4al eliet (fs2rau p;t1aetoii3iydfa2rluvo;u0tleoio iy1lpt ln s t0 2xrir3no4oltnmfcsltfartru o;t1olxo ociasfs ranmsn(0tltrxr3io1lpDr u s (0t2uo(r3nodam   nvs s aDrauroot0apx ii3iyt s uan pnt0alxrxf oy1omD aivols)truo(o3ny4ap elnci tfsDrrx  no0oexomi3iysfs2ua(monu) rxrircoy1oa rlieilt0t2xo(rpoy1ape lnct s sDrrx pnu4opeoif3ilt s rmn p;t)tlxomrcoy1fpD anvi;(  2xr(r3oo4ole lici tf 2tax p;u0tpt mi3ilsfsDrm(vsnu4 exomocootlmtelu o s texmir iy1optnlnctlt arrax  nu1altnmfeilt m elnms;()tlxrio3to1fa   n i;t  2xoxmpny1omeelivta( arrmu pnt4tpxoiictltlm rmnmp;u4aetrmo3oo1fa raueils)srur(o3oudalee iet ( srrru oou4tlxomfeiydlm2rau p;u)altrmfciodomtrau s;(0texo(o3oy1lme mncsasfs2tru  ;u0tpe io3ildlmDraump ()artrmo3iytlmte n sl() exrxmpoydlpte nct (  Dtaxrp;o0apxo i3tldfa ulump (0 ltnxr ta1laDrli o;( trtr(o3nodop e feia()srtmu pno1tetoio3iys m rl(vs;(0 eeoif3iatfm elnes;()sexr(rpno4lp nliesl(farrm( onu1open fciltfs raums t) ltnmo3ootfmt au s;t srxoxr3iy4lle  icilt)s2ta(m ;u1apeoif3ilt mDrlnvs;t)artniocoydfatrauvo;t0 2xriopou1omte nesltfaDraxro;o0tee ifeiytfs2umuvsn()altoir3todlmteaiei t0 2toxo3iu4lmt mnvsas s2tmx ooo1ope  fcilt mDemn p (4 exnxf3oodop  aues;t0texmim3oo1lp  mnei tfa2rmur nu4tee  i3tyslm2rm( p t)arermo iatlpDrluvs;t0seuo(rpoudoptn icias) Dtmxr ;o4olxn ociytlm2rlnvo (0treomociadfp  lu o;()s2uoio3oo4lptelict (fa2trxm ;u4teeo oeiydfm2rm(vs u0aeeoif3oadlp  lneil( srtr(mpoo1omtnmicilt)sDrmxr ot4tleoifeiat aDuln s;t0tleoir3iydoa r uvi t)s2trir3iu1llee ivias  rtrxmoou1oeeomo3iadlaDranms;u)tltrifcoatfa eauvi s)srxo(m iu1lptn fvtl( a2tm(ro;t4olxoioeildlaDrln s u)trtnxf3tadfa  aiei t) 2xmxm nu1lm nmnei () rrm(mp;o0opxoio3iyt mDem(vp t4tltrxr oydfateln s t) eurir no4llt lnvt ( srtm(mpou4ole iieiasls rln o;t0tlerxf oa1lmD an o s) ruoir ou4lpt mfvtl(  Dtr(r ;u4teeoiocilt aDelnvo;t0texoxr tatoptr u s;t)trurxm3nodamt mictlt)aDurxr nu4opeomictlsfa ul(mont) lenxocoa1om e uvo (0t2to(rpnodol e fci tfaruaxm nt0olxnmociytla2ea( s;t4 exoxo3tatlatraueo ( trxmxr ny4lm   ivi sfsDurxr ;o4olx ifeildlmDuaump;()tlenir3totlat luvs s)trtrxr3no1ole mnesa(  Drmumpno0optnmi3tatlmDuaumont0tetrxrcto1fateln o;t trxrir iydame mics s) Drax ooo4olen ociad aDum(mp t)aetoxo ia1omtrlueils  rxo(opnydole lncslt)s2tauronu4alxoioeils m rauvpn(0tetrifcoy1faDeauvs () exmio3iydlpee net t arrm(mont4tltomietysfsDra( s u4trtnmfcta1omteauvils0 etoxr iudaptn ivs t  Dtmxmoot4ape mociytla2rln p;(4teenifciodlpt  i s t0setoiopoo1omenmnci ( sDrmur ot4aptn i3tls mDem(mp;t0artrmrcoodlaDrauvi ( srxoxo3oudapee ics s s2tm(r ;u4tltnmieildla2uaumpnt0 lerxrcoytlmte i s;t0seum(m3iu4ale lneils sDtm(mpnu1ope  ieiyslsDulump;t0aexoxf iodfmD livs;s  rurir iodol  mivsls) 2tmxrp;u0aexoiociyd aDra(msn(4arxnirctatfate u i;s  rxmxm3nudom  mfesl() Dtrx pnu1aetnmfeiltfm uluvs u4artrxo ootlate ieo t0srtoimpny4amtemfvslsfa2rru oot4alxn ieiltla um(vp;t4 leoir3iotomtrau s;t0texoxr iydoltelictl(f 2tr(r ;o1oleoio3ilslsDrlump;u0 exrxociadomDranvo t) rtoxopnudolenmneiat)aDrmum oo4tetnmieiatlm rlnms;t)tetrif3oytfmtrlnvs;() 2um(m3iy4om emivia()aDrrumo;o4opt ii3tadfsDeaumonu0 ltomo ootomDrauvo t) etoimpny4lmeemncs sfaDt
\ No newline at end of file
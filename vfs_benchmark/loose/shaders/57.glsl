@@ -0,0 +1 @@
+n il( t2xoio oy1op nmics s sruaxrpot0aexn octad m rlu s;u4 lxnmrctatlpDe i s t)teurirpoydlpt mnvilt)a2uru  ;u0texomictltlaDea(vp (0tlxnmociodlmt aueo s) 2umio3nu4ope lneiltf rtm(mpno1oltn f3iadfa2uau p;t4 lxrio3iotfmtelnvi s)t2xriopio4altnmnctls  Dtr(  nt0apxnmf3ilsfs2ul(vo t0 renircoa1opD au slt t2xoimpoodame lnetatf rtm(mp;u4altoioeiadla uaumsnu0 exnirctodopt ln s;(  eto(opnodapenlfcs (f 2um(rp;o1aptomoetld s ran p;(4aexrmo3totopt aivs;(0 rto(r3nudaltnlfct () rrmu onu1ole mfctldfaDrm(vonu0trxnir todlpt auvi;t)truo(m iy1lptnmfcsat) 2trum ;u4oex  ociatfmDum( s t)aeenif oodfateaivi;(0tetmim3ny1op n net t) 2ur(r oo0oltnmfciadlm2ra( p u0tlxomo3tatlmt au o;s)seuoxr3oydoptn ivsls)s2raur ot4apxn octlt aDul( s;()alermo tadlpteluvolt trxoio no4ap nlici s  Drm(mono4tlxniiciytfs2ea(vpnu0 rxnio3iadfpDe n sl(0 2toimpny4lm emnet ( srum(mpno1oeenmictldlm umumo (4trtrxociotop e nvsl()texr(rpiodamte ivi s)sDuaurpot4oleomi3tysfsDrl( sn(4 lermr oytoa raieslt0 2uoxm oy4oltemnci () Dra( ono1tex  f3tltla um(vs t4tetoifcoy1fp rau ols0s2toxo ou1lpt lneil() Duaxmonu0teenmoetaslsDulnvs;t) eeoxf iydlpDe u il(0 ruoimpiy1apteliesls) Dua(  ;t4teeniiciasla rmumsn(4 etomoctytlpte ueo t0 rtoio oo1lm   ietat)aDtr(  ;u1oleomieiytla2umuvo u0 leoxo oytfaDe uvi s) exm(rpno4lltnlnvilt) rrmxmont4tex moctldla rlnvont4artomf3iodfmDean s s) euo(o3oy4altemivsas sruax  no1tlt iociasla2ra(mpn(0 reomocoy1lp  lues s)seur(m3iy1ale  fes t a2rm(r ;u0tltoiociysls umuvo (4alxnxrctadlmD li s t trumxm3oydlm  mivi (fs2tmxr nt1teenio3iadla2ran o;u)alxomocia1lp rlnvi;(0tetm(o3iy1lmee ncia(f 2tm(mpnu0apeo f3tlsfa2umuvp (0aexnio3ootoatr i o (  exmxo oo1ap elfeiat)aDrmxmoou4oee  f3tat m2elnmpnu0alxomf3iydfaDeai i (0trurir oodol nmivslt  Dra( oot4tleomieiyslm2rlnvpnu0 rxniocoo1opD luvs t0tetr(opou1ap e nctlt  Drrxmpoo4oetnii3ilslsDua(mp;(0tltomf iadlpDr u i;t0 exrxm no4oleelnct s)a2umx  ot0tee iieiydlsDum(monu) lenmf tytfaD aiei;s0 2xrxopio1lm nlicsat  2tmx  ;u1ale ioctlsla ua( s t4aeenmr iatfptr ieo s)setmirpiudolenmneias)s2tm(rpno1ape  oetldfmDrmu snu0 ltnio3iadopt an i t  rxr(mpno4ameelicta(faDrrxm nt0oltnmiciasls2umnvs;t0 lxoif3oytlpt luvslt0s2xm(opnodol e ivs t  2umxmpou1oeeoiieiaslm2ua(ms;u4trenmr todlaD lnvol(  eur(m oy1lp nlnci (fsrrrur nu4ale mi3tytfa em(mp ()trxrxf io1fm elu ols  rxmiopio1ole lfcils  Dtaxr ;t1apt ioeild m2ean snt) eenircoydomD anvi t  2xmxo ou1alenmivil(  2ua(mono0ope ii3iytfm2elums u4 rtrmrcoo1lat  ieils  etrxr oudameemfvs s  rumx p;u4tptn octasfm ulump t) ltrxo3iatlmD anvs;(0srxr(r ny1om elfcias srtaxrooo1apenmi3iat m2elu pnt) exoifciytlptranes;s)trxo(m3iydopte fcs tf 2tau p;o4ale ifetldfsDelnvs;t4 etrif oa1oat anvo s) rumimpno1ome lnvil( s2rau  ;o4tlxnmo3iltfm2rmuvo;t4trermocootfpDelu ols0 rtm(o3iu1op n ncta()srumxm ot1tltoiiciyd sDrmums;u0arenxf3to1oaD au ils0 rxmxmpnu4optnmfetat arrr(  ;o4olenioetysls2rlnvp;t0 leoir oytoa elieol(0srurir ny4aptn icsat sDta( pot1tptoiocildfa ulnmont) eeomfcootom rlivs s t2trio ou1amt lnvtl(fa2rmurpnt4ope moeiatlsDul(mon() lxomo iy1lmDrln i;( trxr(o3oudomtn fvs (  2rmxmo;t4tlx io3tytlm2rl(vp;(4tleoircio1omDr ieo;(  2trxo iy1amee nvt s) 2rmxrono1tex mi3ildls rl(vonu4 etriociotlateauvs s0t2xriopou4lpenmnvils  Duaump;o1oetnmfctas s2rluvo t) rxnmf3iatfpte ieslt)trxmxr no4lmen neias aDta(rpou1tltoiictys sDua( pn(4tetnxo tadfmDrlivo () exm(o ou4omtnmnet tfsDrr( o;t4alen f3iltfs2umumo (4 ltoxf3oodomt livsl( t2trxrpiodlmte iciat)a2ra( o;u1apx  ieilsfs elumo;t0tetoxociodoaDeai ilt0 2xoio iu4lmtnmfvsls srtrumpnt1aeeniiciadfsDrm(ms;(0 etomr3todop rlies t t2um(rpio1lptnmiet ( sDtaum nt0oltomieilsfa rmnmp t0 etoif3ia1oa  lneo;s tetrxo nu1lm n fctas  Dtax pno1altoifeiytlaDrl(vp t0 exnmr3totfm  lu o (0 etmxrpnydlmtemivsls aDtmx onu0ape  fctas a rlumo;t4alxnif3oadlmteli i;(0 2xm(m ou4ll  mnct ( arraurpou1ope moeiatlm2rmumo;u4arenxfciadlat livs;s  2xoxo nu1ol emfvt tf rrmx oou0oee  icilsfm ul(vo;(4tleoio ta1opte ieols0 2tmir oydapt  fcia( s2uax  no1olxomicilslaDumn pnt)treoxf oadfmtrln il( t2trxm nudlmte ietas)aDuaxro;u0aet ifctadfm2el(vp;u4 exnio oytlaD an i;t)s2xmxr3ou1lmte ici s) 2rmxmpou0olx  i3iadfaDeauvo;u4 rtrir ty1lm eauvo;s  rtmxm3iu4ap nlivtlt) Drmumonu1ape  ietysfsDumu p;t) lxomo3io1fmDrauvi t srxriopnu4ap  lnctat a2tru  ;o4olxo ietydls2raumsn(4 rerxfctatom eauvo s)sexmxo no1omte nvt sfsDrmu  ou4apt ifeiadla2emu o (0aexnmociotlptean o s)s2toxo3oo1omtnlictatfsDtrxm ;t4aleomo3iydls2ulums;t)texrmo3todfaD  u o;t)srxoirpiu1lmtnmietls a2ua(rpnt1opeomfeildfs rluvsn(0 etomocia1op eluvo s) euo(mpoo4ll  miesls aDum(r nt4tetoiietlslm rmnvs (4aeeoif3to1fatrln sl( t2xmxo oo1lm   ict tfsDumx pnu0aex ii3ias sDel(vo;t)alxomf iodla eaneo (  rurxopio1op nmfetltfsDum( p;o0tpe mfeiat sDra(ms (4 eerxf iy1omD  u sl()t2tmiopiy1olen fcs s)arraum nt1aex ifeiysfaDul(mp t) exnmr3oatfmD aies;(0truoxm3oo4aptnlncta(fs2umur ;t4ope  oetas mDemu pnt0 exrxf iydfptrauvi;t trtoir iodamee nes sfa2raum ot1alx mictadlsDua(mpnt0 lerir3oatoateaueo;t  rxr(rpnydlpt lfcsasf 2ururo;t4aeeoiieiad m rl(ms;u4aetoir totopt  n s s texoxopou4amtemnci ()s2tr(m nt0olxniociasfsDul( s (0 ltnxo3io1lp raivo;s t2xoxr3ou4ll elnesatfartrx  ;o4tleo fciydfmDrmumo;() lenxr todfp r i s (0s2um(opio1ll elnvtlsfaDrmxmpnt1tex moeilslm2umn p u) reomo oytfptrli i t0truo(r3ou1al nmnetls) 2uaxrpno1oex mo3iltfm2ulu p u4aeenxr ia1lmDe neol( texmio3ny4ll nlnvtl()srrax o;t4aee  ieiadfmDrlu p t4tlxnmf io1fmD  n olt0 2toxmpoo4alt  ivi tf Dum(r nu1aexoiicildlsDum(mo;(0altrxrciotfmte ueo;t)sruriopiu4apenlics t sDurxronu4tlenio3ildla2umnvs (4tlxrir tydopDr i s;t texm(m nodlltemicsl(f 2urxro;t1olxomoeiyt m emn o;()teeomrcootlpDelnei;s)sexm(o3iu1llt miviat aDtmurp;t0opx ii3tasfa2ulu p;u0tlxnmfcta1fa eliei s  etoio3nudlptn fcsltf Dta( o;u0tee if3iat sDemumsn(0texomr3oytlaDrlivsls0 rtrirpio4ol nmfetasfs2trxr ;u1oeenii3tysla2ea(vsn()alxrmf iadfaDeaivilt0s2xoxr nydole  nct s)a2raurp;t4alxoifciasfm2em( o t4aetnif to1faDraiei t t2xrio io1omee neil()aDrmumooo4apenmoeiad s2rm(mont0trtniocoo1lpt  u i t0 etm(m nudlptn iei s)artrump;t1olxnif3ias a2rl(mo t0aeerxo3iatoa  aiesls)teuo(opio1ol   iet s  rra(mpno0aeeomietatla rl( o (4 rxnxrctytlpt  ivilt) rxmxrpny1al n fct ()arrr( oou0texo f3tatlm elnmo t0teermr3oatlpDeauvi t0sruoxm io4ll nlicsa()sDtrx p;u4aetn fciatfmDem(vp () lxnif iotop  ai s (0sexm(o oodomtelnvsatfs2ua( o;t1tltnifctldfs2rl( p;t4trtnmo ty1fpteli i;s tetoirpiudoltnlnctl() rrmu  no1ole moeiys mDumnmo u)teeoxo3iatoa eaneil(0truo(rpnodop e ietasfs2ururoot4oet moetad m ulnvp t)trtnxf3oatfpD lneo s  eur(r no1amt micslt srrm(r nt4ope mfciysfs rl(mp t4trtrmf oatoaDeln i;t) 2urxo io4om  miet sfaDtrump;o0openifetat m2emn s;() rerif oydfmDeluvi;s)srtoiopio4lmee icslt) 2ra(mpoo1tpx iociltlm2rlnvo;()aeenir iadlpt ln s t truoxopnudopeemiet s)a2trxrooo4optnmi3iadla2umumo (4 rtnir3totlat lueol( trumxo nu1om  lnct sfa2tr(m oo0optn f3ildfaDeln o;t0 rtrxfctadfptr i i ()s2xrir3iy1altnmiesl() rtr(rono4alx mfciltfs eanvsnu4 lxnmo3tytfp elueilt0s2tmio3ny1llte icils) 2rauro;t1olxniiciys m2uan s () rtomf3oydfa ran s;(0 2xmim3no4ameemfet ( srum( o;o0aexn iciat a2em(mp u0trenif totfm r uvi s0srxmir no4open netas arta(m ot4aeenmieiyd a2ea(vp;(4aeeoir3iytfatrlueols) 2trir3nu4llt  nvsls)aDuau  ou1opxo octad a umump;t) exnif3oodlaDelu il( sruo(m iodlp nmnetlt)sDtrxmpno0tet  i3tasfm2elums t)artoio tadomD aneslt  rtoxopoudlmtemicsa()aDrrxrpoo4opeoiietytla uau p;u0arxoxf oadfate neo;t)srtoxrpny1lmee ncsat)srrm( ono4tptnmfciltfs2elnmp;t0teenxrcoo1lm raueo ( trtmim3iy1ome lnetl()sDumur ;u0alenmo3ilt m2rau p (4 lxrxfcoytfmtr uvol( sexo(m ny4omt mnct s aDtaum ;t0apxo ietatfaDeln p;t)tltnir oadlpD  nvilt texr(opoy1op emnes ( aDtrumpou0aleomo3iydfs2ra( s t4 rerif3ta1fat li i;t)setmiopoo4aleemnes tfsrrru pou1tltoiociytlm2rl(vsnu0texrmo tadoaD  ueo;s)setmxm nydlpenlictasfa2tm(moot1tetomoeiydla2ra(ms u)trermfctytoa elivs;s sexrxrpoy1alte fvs sfsDrm(m nu0opto ieiatfs eanvp (4 rxoir tatomD ln i;t  2umim3nu1llenmivi ()sDtr(m ;u4tpx io3iydfs ua(msn(4tlenxr ta1fpteaues t0s2xoxm3no4olen neilt) 2trur ;t1tpenioetysfmDemn p;t0 etomf tytla r iesl( srumxm oydlpeelfviatfsDraum no1alxnmi3tatlm2eanmsn()aeeriocoa1lm  aues s0sruoir3iu1omee fcilt  Drmxmo;u1tetnmo3tldfsDeau s;(0alxnmr ty1fatrluvs s sexm(mpiodol  mfvs ( aDuaxrpot0apxnii3ilsfaDelnms u4trtrmo oy1lpDr u i s0s2xrxopio4ale  fvsat)srrm(mpoo4aexomi3tlslmDuanvp;t0alxnxo iatoaDrai sls) rumir3ou4apee ies s)a2umxm nu0alx mfetltls ulnms t)tltrmf3oatop  au i;() rumio oy1lmenlnvi s)aDrmu  oo1olt  octltfaDrm( ont) rtoiocoydfmDr ivs;(  2tr(m iu1lm nlfviasfs2rr(rono0aetnifeild aDeau s u0 rerio3tadlaDe nvslt0sexoxr oy1am nmnctas)sDuauro;u0aexoioeiadlsDulu s;(0aetrio oa1la rauvils)truoxo oydope lnvilsfaDrmu onu0tptn iciad s uluvonu0trtomr3ia1fptr u i;s0 eto(r3iydlmenmnvt (fs2rrurooo1tlenii3tldls rauvo u) exrmr oytoatraieo s0 rxrio3no1ole lneia(  2umxmonu4olx ioctatlm ua(mo;u)trxnxf3tadlptelneil(  2trxm3ou4ap  mfvilt) rrrxmono0tptnmi3iatls ra(vs () exoxfciotfm eai olt  rxrxr nydlp  mnctls sDrmxmo;u4tptoif3iltfm eaumpnu4aetnio3oo1omte n o ()seuoio3ny4ameemfvi s  rrrxmoou1alen ieiltlsDrm(vo t4trxoif3oy1lmteau sls  rtmxo iy1amtemiviat artmurpnu0alen ietytls uanvs u)trenxr iotfm rai i ( t2toio oo1lpee neils  2rrx p;t0openmietltlm2umums;u4aetomo3oo1faDraiei (  rxoiopoy1oltnmncsl()srumu o;o4alxnmo3ilt mDulumo;u0arxrifciydfm rluvilt0trumxr no1lptelnetas srrmuro;o0oee  o3iyd m2ra( snu0tetnxo3iydlpt lnei;(0t2trxo3iu4lmt mictl()artaxroou1tpe ioeiyt s2elnvont) lxrxr totlptrlu o;t teuoxrpoudoptnlnvs (fsDraumoot0alxo i3tlsfsDuauvs;()artoif oy1fm ranvi;(  2um(o io1am nmneils)aDra( oot4oexoii3iyd s2el(vp u4aexoif3iy1fatr i o s) rxrio ny4omee nct s)artru o;t1aleoiietydla uau p;(4tlxoxr3iytom eaueilt0 rxrio3oy1lmtn iesl(f 2ta(  ;t4oltomietltls2ran o t)altoir oa1lpt  i il( srxmxopoodlpe  fciatfs2urur ;u4olxnif3ildlsDemn o;u)altrxocoydop  ln i;s) 2urxo iudam  mivsls)aDrrxmono1oleoiietls a rau p;u0 exrmociydlatrlieol(0s2xoio oy1amenlfesls)sDrmuronu0apx iictyt a2rluvp u4treoxr3iatomte u o (  etrim nodol e iciat artr(rp;u4tee ifctltlaDrl( o t)trxrif3iytoa r n ols)texo(o no4omeemfvs s)sDrax p;o0tlxn o3tltla rl(mp;u4trtrmrciydfpt liei;t texm(o oudol emnesl(fs2uau  nu4oltnifetasfs um(vs;u4tleomociydomD luesls) 2urim oo1lp   icsls)s2uaxro;o1oexnii3iatfm el(vpn()alenif3ty1lptelnvo s  rxmir3ou1ap e fci s aDum(r nu4olto i3tas a uanmo;u4texnir3todoateaneo;() 2xmxm iy4om  mivil( srrax oot4aptn icils sDrauvo;t0artoxo iatfaD aiei;t0t2tr(rpnodol elfesas srumxmpnu0olxoifeild aDul(vont0altrioctodoa elnvi;s0srtmio iu1apt mfvta(  2rmxmpnu4tpx micils s raums t) etniocoatlp ean i;t s2urxm oodolee ncslsfs2umur nu4oltn i3iytfs el(vsnt) eenioctotfaDr i sl()srurxmpiudlmeelnvt () 2tr(  nt4alxomf3iyd mDeau o (0arxnxo3tatop eaiesl(0 2xr(o nu1om e fei t) rumx  ;t4aet  f3iadfa2em( o;u4 eerxf3tytopD auvo (0s2umir no4al n icsatfarurum no1oleomo3iys s ra( p;u4arxnxf tydoa r ueo s t2urir3oydlp  mics t) ruau p;t4teeo iciat a2ra( s;t)tetnir tydfptranvil() etr(r oydolt mnvtltfaDtau oot1aex  fctatfs ra( s t)trtoir3ootfat anvo s t2urxo3oo1al  liesltf rrm(mpnu4tle  fctat aDranvpnt0 etrifcty1lmDrauvs;s)teumirpiu4lp e iesa()sDrmu  ot4aee mfeiadlm emumpnt)teermo3ty1fptelnvs;()trtmiopiodame  fesas)a2ua(mpoo1ope ifeiydfmDra( o;t0 eenmoctytoa eaueols0t2urio3iydom emieiat)s2rmxmpot1apeoifetldlaDulu sn(0tetnxo iodoa rlivo (0srxrxo3iudll  mnct () rta(moot4ape  oeiytlsDraump u)artoir oytomt  nei t s2to(r3iy4apen ieilsfarrmu  ;t1tptn oct
\ No newline at end of file
@@ -0,0 +1 @@
+ueol(0 2ur(r iydapenmfcil(f ruru  no0aeeo ociadla uaump t0 eeoio3to1latrliesl( t2urirpiodameelivtlsfsrra(m ou0tlt  f3iyt m rlu o;(0 exriociotfp  lu o;()seto(m io4lpeelnvsa(  2urxro;o0teeomi3ildfsDem( p;u4 lxnxf oa1lpt lueol( s2uoxr3iodol   nei t srrmu  nu0olenifeiltls emnms;u)tetnmr3to1fpDean o ()texrir3oy1aleemfetls  rrau oou4optn f3ilsla2ea( o;u)artoxf3oatfmt lieils) 2uriopnu4op  mnciltfa2rmum no1tex io3tasls2um(mp ()altnmfctytfaDr u o;t0 2trio3ny1lmtelici ()a2ur(m nu0opxnifeiysls2rauvp;()tetnioctydlmD  neol( texrxm3nu4lpenmivil(fsrtau pnt0olx  iciadfm2rl( snt0altomr oodlpD lnvsl(  exo(o oudap   ivsatfa2uaxmpou1tltomiciadls2elu s t0artrif oy1la r ueols tetrxo ou4lpenlnesat)a2trur ot1altn fetytfs2eln s ()alxnmf iy1lmt lnvi;t) rtoiopnodlme lieias sDrmur nu1tpt miciaslaDuauvs;t) reoir iatfp eanvi s)seur(opou4ll nmivi t)arrr( pno0teeomiciatlsDem( sn() lenmf ia1lm  auvs (0t2um(r nydlpe lfcs t aDtmxmpno0tpxn oeiytls2ra( o;t4aeeomo3oy1fpD  ieolt)srtmir oo1optnmfes s) Durxm ou4aeto ictydfa2rmnmo;u)tetrircio1optean i t)t2uoio3oo4lm elfesa()a2rmxro;t1olxomocildls2em( ont4 etnmfciadfm eauvo;s  2tmxm oudom   nci tf Dum(rpnt1tpto ictydfa2um(vsnu4 rxnmf3ootla  an i s) etmiopoy4olt lfes (faDta(ront0tptn i3iysls rl(vp;u4arerif3ta1faD  u o;s srumxrpnu1olen ivt t)artaumo;u0apxoif3tltfmDelu onu0trxrif3iodfm   ivil(  eumxo ny1ame lieilt)a2rax  ;t0tpxo oetls sDulu o;t0tleomo3tytomDe u s t0 2tr(mpoudapt lfei t)sDuaxmp;t0optn fetld a eauvsnt) eenioctodfpt  n o;( trtoiopny4oleemncs tfs2rr( p;o4olenmi3tydfs2rlnvpn() rerxrciadfat  neol( seuoxr3oodlpt mfvtls) 2rrumont0tpeomfcias a2umnvp (4 exnir tydoptelieo t)trxmio3io1lp nmict (f rta( ooo4tpxnmieiysfmDeauvpn(4alxriocoadoaDrlivo;s  etrirpno1ol nlies tfa2rax  ;u4tlxoioctaslm ua(vs u0 exoxfciy1optrli o;( t2toxm3iodll emfcilt sDtr(rp;t4tetnmieiysls umumon(0 ltnmr totlmtr u s (0 rum(o3no1olt lncilsfsrumxm ;t0apto oeiatla emnvp (0 rxrxf3iodlp  au o (0setmio3ou1ol emfvt t s2rrxrpoo4apx iociltfa2rm(vp;t0 rerioctytopDr n o;t)trtmxr io4apenmfctas  2raur ou4tlxo ietysfs rmn o;t)teeomrcoytoa elu i (  2xoiopny1alen ncsas)s2trumoou0oleniieilslm umumo u)aexnio3iadomtr i ilt0 2umiopoy4alte iet ( aDra(rpnu1tltoifeiasfsDra(ms;u4altrmo3tytfpD  n slt0texrxrpiy4altnlfet t arra( pou0opx  i3tasfa2um( snt) ltrio iadlpD  u s;t)s2trim3ny4omtnlfvt t)s2tru  nu1texn feiyd mDrl( p;u) leomf oatfpt luesls  rtmxm3io1om e icsl( s2rrurpno4oeenif3tadfmDeln s;t4 lxnio oadfmtrauvs;t t2tr(r3io1ll nmfctatfs2trur nu1aet iociltlm2umnms (0 rtrif3tytlp   u s;s  2tmxm3oo1lmtn ivils aDtrxrp;u0apeoifeildls eauvp;u0 exnio3iytop rlnvs;(  rxmir3iu4ll   ncs t) rumump;u4oleniieias mDulnmpnu0aleniociy1fmtr nvo;s0trumio nu1ap e ies s) rur(rpot0ape  fciltlm2uau p (0aeerxo tatoateanes t trxrxmpou4omt lfeias arur( poo4altn iciytfs2eauvpnt4 leoif oatoat  i ilt)trxoimpoudllt lfcil(fsruaumo;o1tpx iociad m2eluvo ()areriocoydom rluvi s s2xoxopno4ol elnvilt a2rau p;u1aeen i3tysfsDum(ms u)trxoxfciydom rlieils trtrio3oo4am e fcs ( s2raxrpou4ale mi3iysls2ra( s (4 lxnmr tadlaDe neo t)s2xrxopiy4ll n fvilt  Draxr ;o4tlenii3tytls uau p;(0 lxnxf3ty1lp   ivslt)trxrxm3oudllte ncias) 2uaxmpoo1olx ifeiysfa eanmo ()tlxnio oa1oat aivol()s2xrxrpno4lm elfeiat)s2tmxrpou0apxn f3taslmDrmnmo;(0 lenir3ootlpDe ivi;()srxmim iy4lm e icsa()s2ta(roou0aexo o3tytls2ul(vpn(4tlenmo iodop e i i;() etm(m3iudlltemieiasfsrtr(roou4tpxnmieiysls2elnvs;(0aeenmr oodlatranei;()s2xrio3nodoptnmncsa(  Drau pno0tpt ioetltfm2ul(vonu0tltoirctadlaDe uvils)srxmxr iu4ome mnvt s)sDumxmp;u1opxoiocilt s2emu pnu4treomr ta1fm   ieil() ruo(mpnudoltemnei s sDum(rpno4oexo o3ils s2umu o;u) etrmr iatfaDe uvo;(  2xm(rpno1ap  lictlsfa2rmxmo;u4tltomo3tld mDumnmont)alerif oadoa eliesl(0teumim iu4am elivsas sDtr(rp;o4oex iictasfsDem( s t0artnio ia1lpteaivi;t) rxrxr3iydlm   ncsat  rumump;t0ape mfciatlm2ua(vsnu)tlxomo3oydlm  lieslt)tetoxm3nodomen ict sfsDrmxmont1teeoio3tyt mDulnvs;t)aeeoio3oatfpDelivs s)s2uoxr3oo1om elnes s  rtm( pnt4oexoii3iadfaDrm( s;t4arxnmr3ta1fpDeau o;t)setoxm3nodapen ncslsfaDrr(ro;o0olen f3tytfmDeln s u) exrircta1fpt auvi;s) euoxmpiydope lictasfa2tmxm ;o0apeoif3tad aDua( s;u0 ltoxf ta1fmt  nei ( sexoio io4amee icsat  rtr(mpou1tpt ii3tltla rau s;()teeoifciodlpteaieils) etmiopiy4lltn nvt ()srtrxr ;t4tex ioeiatlmDuaumo t0tlxoiocty1fatrluvi s)t2urir3iu1amt mietlsfarrr(monu1opxomfeiltfmDelumo t4tltrxr tydomtraivils0sexm(o3iu4ap e net t) rtaurp;t1oeeomoeiatfa2em(mp u0texrir oa1fptelivo;(0t2ur(o oy4optnmfetatfarrrx pot1altomietydfm2ranvp;(0 eermocoa1omDrliesl(  rtoxo oodame mfet s aDtrxmp;u1aexomfeild aDuauvs;(0 rtnmr oodlm rli i s) 2xrirpny4amt  iet sf rua(mpot4oeto f3iyslsDeanmp;(4aetnxocoatopDeaies t) rtrio3oo4apte neias aDum(mooo4oee  ieiltfm2ul(vo (4 rtoxrcoodfa   ivi;t0 rtm(o no1ap n fvilt)arum(r ot1aptniociyt s2ean p;t0artnxrcootlatr ieslt0srtrir iy4llt lneil()sDua(r nt4tptnioeiydls2ran o;t4altomocoatfp r nvs;(0 rtrim3oo1lpe  ivi s)sDrax p;u4teeo ictatfm rluvp;t)trtrxfcto1omte nvs (  euoxo3iodlmt liet s) 2rax  ;t1aexoiiciadfsDua(mon(0 rxomfctydlp  an o;t  2tmxmpnu1lm  mncta(fartax poo0tptn iciatls rm(vo;t)trxnxf iatfmD an i;() 2tmio3oy4apt lfcs () 2tmuro;t4opxn ietysfa ua( on(0treoxo3oydlmte iei;t0trxoxr iu1omenmfcs s s2urxm nu4tle  f3tyt a umums u0aexomrctadoaD  ivils0t2umio no1open ncs tfsruaxmp;o4tlxomfetls a2ea(mp u)trxomrcoadfpDelneolt s2xr(r oo1lp n nei sf rurxmpno1oleniieias s uln s t4artoio iodfmD lu o;t) 2uoxm oudaltnlivils s2ra(m ;u4tltnmieiltlm ranvpn(4aeenxf ta1faD lu o t)t2urxr3nodom e ivi tfaDtm(  ;o1apeo ietasla2ul(mp;t) eeoxr3tytlpDeauvslt texrxm iodaltnlnes s  2truro;t4aleoio3tad aDea(vp (0 etnmr ta1lmD li i;s0 etoxr oo4op  mnvi t  rrm( oot1ope  i3tas m rau p;u4alxoir3todoa  lu s;t  exrirpiu4aptelfvslt)aDrrx o;t4opeo oetldlaDrluvon()artnxf3oadfmt livs;s)trxoxmpiy1openlfesas)aDtax o;u0tlto o3ildfs2em( o;t0 rxrio ia1fp   uvi t) exo(m ny4ope mnvs tfs2uau p;o4openmi3ilslsDuan s (0 rtnxf3to1lmD anes s)trxrim oodap e nei sfartaxrp;u1olx  ieiatfm2uan p;(0 rxoxo3oatlm   nes;(  etoxopoo4amt mfvt (f Drmxro;t0tpt  o3tlsfm2uauvo;t4alerxrctodfaDelivi t s2toirpno1olt mfcilt)srurum no1oltn i3iyslm rau o;u4altomr3tytoaDrlu s;s) etmiopou4omee ivslt)arur(r ;t4tlt mietlsfs eauvo u4trerxociytom ranvi;s0srur(r3iodoptn nctatfsDrrxmp;t0alenmoetydls ea( pn(4 lxrxocoa1opte uvol( trtrxo iodlm nmfeiat  2tax  ;u1teenmieiltfs2ulums;()aetrmr oadomDeaues ()trtoxrpoodllt mfvs t) Durxm oo1alen oeiydfsDra( onu)tlxnmo ootfa rai i (0t2toio3nu4oltnlfvtlt srtrumo;t0olto ictldfsDumn o;u)trtnif3oatfp eaies;( tetoxo no4lpeemfcsl(farraum nt1apxoiieiltlmDrln p t4trtnmr3oa1lptelu ol( s2xo(o3nudalt mfvt t)srumur ou0apx ioetytlsDemumo;() etrxf tadom eaneil(0setoiopou1am  lnetas)arurxmo;o1aptnio3ilt a uln o;t4 leoxf ootoateaivsl() rumxopiy1apenlncilt  2trumont1oexoifetldfsDumnmo (4tlxomf3oadfat  ivi;t)trtmirpiodlpt lietl(fa2ra(roou0apt  i3tys m2ea(mp;u)altrxfciydfmDeai o;( s2xmir3nu1lm emfct ( a2ta(r nt1oexnmf3iadfm ean snt0altomf tadlateai i;s0s2trxr3nydomtemies ( sDtrx ooo4olxnifeiyt a2em(mpn() ltnio iotlp eli i;(0t2xmxo iodapenlfvt tf Drm(  no1tlxnif3iys a eau onu4aetomf oytopDr u ils setoio3iodalt mict t)sDumu  ;t4opxnmiciad mDemuvp t4 ltrir3oydomDr uei;s0sexmxo3oy4lltnlivtlt  2um(mp;u4aetomfeildfa2rlnmsn()aeenxf ia1oatr i o;(0teuoxm3iy4ll  lfvt sfsrtrurpno4oet mo3tltlsDumuvsn(0trtrmr tytfm raieo;s0 etr(o nu4amte ics sf Dum( pno1oeen oeiltfaDul(msnt)tltrmfciytfmDeaieslt)s2ur(opou4ol   nei tfsrrr(rp;t0apxn octld a2umnmo u4texnmo tydoatrlueols0 2toir3nu4amt mieslt arraur ;t1tpen octldla eanvs;() rxoio3ty1opD  i i;()s2tmimpnu1omenmiet () Duaxrpou1tpx moeiasfs2rln s;(4arerxocty1fp r nes s0setoiopio1lltnliet (  Dtau ont4oexnmociys a uanmp (0aetoxo3ootlmtr i ilt t2um(rpno4amte ncs s s2tax  ;u0oexomiciatfa umumo;t)tetnmr3todfa   n i s srxm(o3ny1altnlivi tfarrrur ot4texoiietld a2ea(vonu) etnmf3ta1latr ieo t0 exm(r io1lmeelfvia()s2um( p;o1opt mfciatlm2elumo (0trxoif3iy1fmDrln ols)t2tr(m iu1alte fvslt sDta(  no1tex iietasfm2eau o;(4 renxfciy1lp r nvils) 2tmxm no4apt lfvt ( sDrmxr no0opeomi3iadlaDumu s;(0tleoxo tytlm   neo s) exr(m oodal e ivilt arur(rono1oexomoeild a elnvpn(0aexoxf3iytfat ln s;(  2tm(m oo1olt  netl()a2rau o;t0opt if3iyd sDulnvpn(4tltomr tytoaDraieolt)sexmio iy1op n feils) 2uau  ou1apxomfetldlm2ulnvp t0arerio ia1lmt  u i;(  rtm(opnudoleemfeias s2rmum ;t0tetnmfctatfa em( on(4alenxr ty1oa raueslt teuo(rpio1lmtn nviltfsDururo;u4tpxn ociydlm rlu s u4tlxomo3ty1laDeli o;s  etoir iydomee netltf rtrumono4oet  oeiadlm2el(vsnu)trtrmfctodfm r i o;( texo(opiu4lp   fes s sDtm(r ;u4aeto fciadfm ua( s t)tltoio tytfa raies s)s2umim3iy4amtnlfvsl(fsrurxmoot4aeen o3tldlaDem(ms (0aetrir3io1fmDean sls  eurim3ou4aptelncsatfartaum ou1olt iietat s2ua( p;() exnxr3oo1omDeau sls) eto(o3iy1lmeelnei t  Drm( o;o0tpxoiiciysfaDumuvonu4treoio3tydfptelu i t)s2tmim3iudole  ivtls) rumuroot1tpt if3iydfs2rmn o;u0texomfcoa1lm raueils s2urxr oudaptnmics s  rraum no4oetomi3ildfsDrmu s;u4 ltnmr iadlm rln s;(0trxoxm ou4ameemivta() Drmur nu4alxoio3ild a2um(ms;u4 eerir3oo1lpDe n s;t0trur(r3nu1lmtnmnvt tfsDur(m ;t4oex iiciad a el( pnt4 rtoircto1omte ies;(0 eum(r3no1aptnmfcias)a2urxrp;o1aee  iciydfs2rmnmpn()tltrxfcio1lat aneils teumxr3oydlm  lfvil(fs2rrurooo1tlenmociadlmDeluvon(4arerirciotopDr n s;(0t2tmxopnu1opt lfesa(f Dururpoo1tle  ieiadfaDrmu sn()arxomr3tytlmtelivol() 2to(m oodal n ictasfsrururonu4oee  iciydls eln p;u4 lxrxfciy1fpDeluvs t0s2xo(mpiu4amen 
\ No newline at end of file
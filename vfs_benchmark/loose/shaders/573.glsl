@@ -0,0 +1 @@
+i i (0 2urio nydom emictat  2taur ot0texo feilslaDul(mo;u4tleomr3tatfmt  i i;s trtm(mpou4apee iesl(  2tau p;u1opeomfeildlm2elnmo;u)aexoir3tatlaD  uvs (  exo(rpnu4amtelictas)sDrrurp;u0tpenif3iltlm emn p;(0altomrciodomD  nvsl(0setmxrpnudal elnvtlsfa2taumpno4opeoiieiys m2ulnvsnu4tlxrmr3iy1lmDe i o ( truriopou4am n ict t)a2trxm ;u0aleo ociyd mDuaumo u0aetnmr3iatopDrlivi t texmir ou1lpt mfviltfarrrumo;u0olt io3iat s ea(vonu)texoircto1fm ean ol()sexm(m3nu4lmeelfei s  rrr(mpou1aetnif3tyd s rm(mp t4 rtrir totla e n s s) etoxo iy4lme lnctat) rua( pou0texomf3tytlm raumpn(0 etoxr3oy1fmDeaivo s)texoxo3iodal elfvi tf rraxr ;t4olenmo3iydla eln pnt0teenir oo1fatr neilt) rtr(m3ny4lmtelfesat)artru  ou4oltnmf3ild a elu s ()tlxoxoctatfpDrluvo s  2xo(r3oo4lme  ivsls)aDum(r nt0oee  o3iydla uln s;u)tltrxf3oodomDr uvolt0 euoim3nodolen ivils aDtrum nu0aetoiociydfa2ul(vpn(4altoxf iydfptrlieo;t0trto(r3nydoltelncsat)aDtrur ou1texnifeiltla2rluvs;u0tlxriocootlm  aneilt0seum(m3oo4llt  ivsl(f Dum(m ;t1tlx  i3iadfm2ul( s;t) lerxocoadomtelueslt0t2toio no1amee icsas s2uaurp;u0apeoif3tys m eau snu0tlxnif oa1faDrlu s;(0t2xmxo no1olen icsa()sDtru pno0apxnmoctyt a ul(vsn()altnxf3oodfmDrlnvilt)t2xm(opnu4ale  nesas) Dum(moou1tlx ioeiyt sDel( s;u0trtoiociy1fptrli s (0seurio oy4ale mivs ()sDur(m ou0tpx ioeias m emu sn(0 lxoif todla  ai s;()t2trxm oo4ap nliviat) rrm(r ;o0apxo iciytls2ran ont0tetrir iytfpte uvs t trurxmpno1lp   nvt s)arrm(mpou0tleoifctatfm2rlnvsnu4arxrif iy1opt lnvi (0 exm(o oydop n fetlsfaDumxrpoo1tlxoiiciasls ulumo t4aexnmr3iytlmD  nvo;t t2tmxr oydam emfcsa( sDtaxr no0optn f3ias s2umnmpn(4 etnmf ta1lpt auvil(0 rxoiopiu1omtnlnetls  Dumxmooo1tlxo oetatfm2uau s;u4altrxf3tatop  livi;s)seuoxm3ny4al  lnvilt srrmumono1aexoifciat a2ean s u4 rerio3oy1lp rlueils0srxmiopoudlpe mivsa(  Draumo;u1oetnifeiys m2ean pn(4 exnmo oo1omtr ueslt)t2tmimpio4amtemicsasfaDrmur ot0tlxo i3iys aDra(vpn(4 etnmr iodom rauei;()srumxmpoo1ameemfctls) 2taxrono1tleo o3tytfs2rm(vs;t0tlenio iy1fmte ivo;s t2urxmpny1alt mfvtl(fa2raxm nu1apt ifeilsfs eanms;t4trerxr3ty1lmtrau o;s0trumxm nudopen netasfa2rrurpot1aetoii3iatfm elumo t4alxoiociodoatr u ils)sruo(o3nu1aptnmnctl( srumx  nu4alx moetadla rau o u4 lerxr3iadfpt  n o s setoxm oodomtemfct (fsDraxrpot0tetoii3ild aDelnmp;u)tlxomo3ootlmDrlnvo s srto(mpnudlmtn feta( s2tmx pou4opeo oeiysls2ul(vs u4 exnmr ia1oatelneolt) 2tmxopnudomenlfvsltfa2rmur ot4tlt  oeiad aDumnms t) lenxr3iydoaDe ieol(  2uoiopny1op emfcta(fs2uax ono4alxoio3tldla2ranvonu4 exomrciodoaDe nvo;t)srtoxrpoo1llee ncsl(faDtrurpno0alxomi3tltfaDrmu s;()treoxf oa1lmDe uvils s2xrim3ou1lm e nct (f Dumxmooo4oltomiciytls2ranvsn()aleoirctydop rauesls0 2trir ou4lleelicsat)sDrmur ;t4teto fciysfs2rmuvs t)arxnxocoo1lmt  i s s)srtmio3no1am elfct tfs2raumpno4oet ioctlsfmDuau s t0 eeomocoydfa  li s;( t2toimpnu1apen nvil(fs2uru p;u1tlto fcilt mDrm( o u)treoir tadopt  iei;s0 eur(o no4alenlivsl( aDumxrpnu1tltn o3tatfa eanms;t4 etrir to1fa r uvs;s0sruoxr ou4apt mfet ( srururoou4texnmoeiasfs ra(mpnt0 eeomo3iy1lm  luvolt0 eurxmpny4op emivilt)sDrmump;t0tpe mieilsfm uaump u0trxomo tytfate ieo t0s2tm(o nu1am emnct ()arraumont0aee micilt s2eln s u4 lxnir3iotfaD li i s0 eto(o3nydomenmfesltfsDum(m nt0altoiieiltlmDemn s;t0 rtoxf3tytfa  ln s t0t2umio oydlmtemfct () 2truro;u1texoii3ias s2emu p u0 ltnmf3ia1op elieo;s)srumiopoo4alenmnvt s)artaxr no4olt  feilsfaDrm(mon() lerifcoydla  aivs;s0s2trxr3iy4ale lnetls  rtmxmpou1aetomf3iysfa2emuvpnt0 eerxrcoa1lpDeaiesl( t2xr(rpny1amt  nvtl() Dua(r ou0ole  oeiatfsDrl(vs ()alxrxf oodoa e ues;s  rxoio oo4apt  fvt t)srtmu  nt0aexnioctltfmDuauvo;u)teerif3ta1lpte ivo (0teuoio no1optnlfet t artm( oou0alenifeiytls em(vp;u) eerxrcoodlp eln ils  etmirpiydlptemfvs s)arrm(moot4oex mo3iad s rmn p;t) lxrmf3tadopD ln o;( s2toir3nu1ap nmici t a2raxmpnt4alxo oeild aDrmump;()tltriocio1op raneilt) rumim oydopeemfvsat srumx pno1aex  ocias sDuau p (4trxnxf3iydoa   n sls0truo(rpiy4olt  icsl( s2rrxroou1oee mo3tlslm em(ms u4 rxnifciytoatraivi t0t2xoxm3nu1lp e fciltfa2ur(ronu0aexn o3tatls elump;t0tltoxr3oatom r u o;(0 2xo(m oydom  lfcilsfsrtr( pnu0olxn ociadfs elump t4aetnmocoatfp r nes;( t2urxm no1olte nvs sfa2taxmont1aex iieiltfsDrm(mo;t)arxnircta1lmD  ivo t) 2xrim3nodol n nesl(  rrr(ronu1tptnifciltls ea(ms (0 lxnif3tytfmDe neils srxo(rpoodllt  ncsa(  2um( pno1oex  ieiyt a2uluvo;(4trtoio tadlptr ues s0srtoxm oodlp nlici (  2um( pot1tpx  ieildla2ea( s;t4altnmr3oo1fpte nes;t trumxm3nudopt  fvsat) rrmu  oo0alenmfctyt s rl(mp;u0tetrif3oadomt ln i;t) rxmxm iu4om nmneil( srtmur ;u1aeeomociltfaDelu snt4 lxnir3iytopt anei;(0 rtmim iudomeemivil()srtaxmoou1tpx  iciydla eln s;u)trtoircoo1fpDe uvs t0teum(opou1oltemnvi (  2rmuro;o1tpeo oeils m2ua(ms t0artoxfciotoaD lues;s s2urxm3ny4om  lfvtas s2urump;o4aee  o3ias s2ulumsn() etnir3ty1oa eanvs s  exmxo iy4lpt lnetatfa2uaxr ;u1apen fetlt m ulnvpnt0 lxrmociodoaDe uvolt0t2xrimpnu4llen nvslt)s2uau  ;u4aexoiiciysfa rau o u0teeoxo3oodomtr u sl() 2tmxr oudlme  nvt t sDrmurp;o0tpto fciyd m2rmnvs;(0 lenmfcootfpDelues t)setmxm3no4llt mieiltfa2rr(rp;o0aetnmictltla2ranmo (4 lxrif oodfmDeai ils trur(mpou4amt lnes t  rraump;t1tptnmfciydfs rl( pn(0 rerxr3ta1fmteau i t)srxmim oy4am nlncilsfa2ra(ronu4alxniieiltls emu sn(4tlxrxr todoa ranvs;s truo(m3ou1omtnlfesls)a2tm(rp;t1opeomoeiadls em(vsnt0 eerxf3tadfm  lnes ( t2toiopoo1altn ict t  Dta(ront0apeoiociysfm eluvp (4 lxnir tytlptran i () 2umxmpoudopenmivsatf 2rax p;o0tleo ietydfmDea(mpnt)tltomoctydfaD luvo;(0s2xmio3iy4alt mietl( artaur ;o0oleniieilsfm emnvo;t)tlxrio3to1faDeli ilt) rur(mpou1olt lfci (faDtmump;o1tle io3iyslaDuan s t0alxoxo3oytomDelivo;t s2to(m ny1lp nmfvt t)sDumxm ;t1aee iietltfaDrlu sn(0arxrmo3oy1omt lu sls0trtoir oo1omeemiesat) Dta(rp;t1aptomi3iad m2rmnmpnu) ltrif oy1lpDeln s;s0teto(mpou1ll nmnei t)aDum( pno4oltoiietls m eanmp;u4altomrcoa1lp raueols trtmxo3oodomee ncias  2taum ;u4ale  oeiydfsDumnmp u4trtoxfcoydfmt  u sls)truo(o3iu1lm emivtl( aDrr(monu4tpeoiiciltfsDrlnvo;(0 lxomf3to1fmte u s s0 2tm(mpoy1ol   fcils  rua(  nt4tpeomi3ilsfa umumo;t)tetrxo io1opteau slt  2tmir3iu4ope lneia(faDtau  nt1tlxn oetasfaDrauvsn(4alxrmocoatlp   neslt) rumim3ny1om elicias)sDtr(r ou4olxomoctydfm2uauvp (0arxoir3iatfpDelues s  2xr(r iy4llt mfvsas artaur ;u0opx moeildfa rmnms;t4aetnxf3ta1fm   u s;() exmirpou1lmtelicta()arumu onu4aex  i3ildlmDrl(vo;()altnmfciatlmte ies t0trxm(opoy4op emivt (fsDtaurp;u4ale mietatlm rau on(0trtomrciytla  aiei s0 euoim3oudap  lfvsa() rrrum ;t4olenmi3tadfsDrl(mo u0 reoxf3tytfateaieil( trtrxm3nydlme lnes t)arurumpnu1apx mfeilt m rauvon(4aeerxf3ty1lmDelu ilt srxoim ou4lptnlfctls  rtm(r ot4apxn octydlaDea(mo t4alxoif iotomDeliesl(0 exmxrpou1oltn net (fs2taxrpnu1teen ieiadfm2rm(vpnu0tltnmr3ty1fa  livsls)seumim3ou1apen ivi t aDuau  oo1aet if3iat a ra(vo u4aleoxocia1fpt lu i;t  2xo(mpio1op   netlt)arurxm ;t1oet ii3ildlm2elnvp t4aeerir tatomDrau i;( s2tmxmpno4oltemivsasfsDraur oo0tpe  f3tytfm um(mp;u4aleoxo3iatfp  aneol(0srtoiopiu4am nmfet s)s2tm(  ;o0tpt mi3iydfa2rmnvs;t0 etrxr3tydlateanvo;( s2toiopoo1lp  lfei s) rrm(roou1tle ii3iatfm ua(mp;t4tltrxo3ta1late u i;s0 euoim3no4amtnlnvsls) Drmxm nu0aeto o3tlt m ea(vpnt4trxrif3totfa   nvi t sexmxr3no1opte ies tf rumx pnt1oltn o3ils a em(mont0aexrio3ta1fatr nvo;(  2to(o iu1om   neils s2uaurpou1tet  iciys sDrlnvo;t4 ltrifcio1lm e i o;s t2xrim iy1lme mnesls srurxrono1opx  ietls m2uauvo;(0 ltnxo3to1fptrlieo (0s2tr(opoudaptn net (fsrtmx pno0aetn ociasfs um(von()teeoxoctytfmDraivi t0 rto(r oo1ol n nvi tfs2taurp;t4oeen ieiys sDulu o;() ltomo3oy1lmt lieils  etm(m3nu1lmtelfct t  Dur(m ;t0tpxnmi3taslm rmnvsnu) lxnif ootomDelu ils0seur(o3oydllt  fcsa() rua(  nu0tetoiietls a ra(vpnt4 lxrmo3ootop eaivi;s)s2ur(r3iu1lptemiciltfaDtrum nu4aex ioctydla2rm(ms t) rxnmf3oy1fmDr u i t  2um(m oudol e iesas)srra(roou0olxnii3ild mDeln p t) lxnmfcta1oaDrlueols)trtrirpnydamt lfciat)a2uaum ;u4aexo oeiyd sDulnmp u0tltoxo3todoa eluvi;()t2xo(r3nydlm nlncs t)aDumxroot4tpto oetasla ua(ms (0teenif3iydfaDrli s t t2ur(mpnodlp elncsasfsrrauront0teeomi3iltfsDumnvs t)trxoif3oa1oa   i s;s sexmxmpiudlpenmnei (fsDua(moou4tpto o3iat sDumu ont0trenifcoatfm eanvi ( t2uo(mpiu1om  mics tfa2taxmp;u0aex moctat s rau p t)artomoctydomt lnei (0tetmirpio1al emfvs s) rrmu o;o4alt  ocild a2rauvsnt)treomfciatfp ean ols teuo(r3nu1ope livilt sDtmxm no4oltnif3iatfa2eanvo (0treomf3todoa ean s t0teumxm3iy1optn ietl()arrmuroot1tptnmictytla ulnvs;u4arenif oodlmDrlues;s) rxr(m oy4llenlictltfsrrrxmp;u1oltnifcilsla eanvpn(0aeerir iytomD  uesl()seuoir3ny4aptemnvilt)srumum nu0apeniieiasls2rl(mo t4arxoir3iadlmtr nvslt  rxrir3ny4apee nes t)sDrrxm oo1oexnif3iltfsDul(mo t4artnmr3ootfpDe nvs;s  ruoxmpoo1lmenmfei s) Drr( o;o1teenifetltfaDra(vp u0teeoxr io1fa eau ils tetoio3iu1lltemfvsltfa2ra(mo;t1aleomfctlt s2um(vont)aeeomo ty1lptrai ils  2um(r oodll  mictatfsrum( pou0oexnmo3iatla rln p (4texoircta1op eanvo;s)t2xmio nu4lleemfctas)srrrx oot4aex  o3tlsfaDrm( o;t0artrmr3to1laDelnes;s0 rtoxo3iy1lmtelivi (faDum(  nt1oee mieiysla uluvp;u)tleoif3ty1fmD auvi;s  exo(m3ou4lm nlneia(fsrum(rooo4apxo f3tldfsDranvs;u0artnmr3tadlp  aivolt0 exmxo oydome livi s)a2tmurpou0tpxo i3iasfsDrm(vsnt)alxoxo3ia1faDeaneo (0 2umim oydomtn ict t s2rmumooo1openifeiad a rm(mpnu4tlenmr iadfmtrlneslt  exoxo3ny1amt lietl()arrr( onu1altoif3tyt sDuauvpn(4arxnmr3iadom r n s t0trum(mpoo4lmen nesltfa2taxmo;o1texnifetld m2eau onu0alerifciytfpteluei s t2xoxr3iu4om nmfvsasf 2umurpoo4apeoiociadla2rl(vs;t) eenxocoytomDr nvi ( s2urir nydope mnetat)a2tr(m no4alto fciyt sDem( p u)tlxnxo iotfmtr nvs;s)s2tm(rpnu1ape mncsls) Drrxmpnu1opx mi3ias s rl(vs t4tetnmr3totlmteluvs s t2xrxr iu4llt livi s)srua(rpou1olen o3iasla2ua(vp (0altnxr ootfpDrai olt seum(r iu1apen fei s) Dur(rpot4olxnii3ilt aDel(vs;u) etniocto1oaDe n i;t)sruoim3oudole  fciat)srtmum oo4ope  ieiysfmDra(monu0aetnxfcoytfpD  ivo;s) rxmxopoy4ol nlfeta()s2ur(rono4optnmoetatlm2rm(vo;(4trxriocto1omt auvo t trum(m3iu4am emietat  2rmum ;o4aleoif3ias m rau o;u4trenxocto1fptelnei;t)t2umimpou1ol nliviat  rumumpou0ole mociasfa2rm(mp (0 rermf ty1lm elueo ()sruo(o3ny4lp elfvtas sDuaum ;u0ape mi3iyd a ranvont0 exrxf tatoa eanes (0srur(r3oo1ale livtat)a2raxr ;o4aetoiociyt s2rmnvsnu4 etnxfciotlm raivs;s srxrxo nu1ol n ici (fs2umx  ;u1olxoii3ilt mDeln o;u4alenxrcoa1faDr nvo;s) eto(r oo1lp e iei (f Drrxmpou0aex mo3ildfa2emuvpnu)arxrir3to1fpDe uvs t  etr(o iydlm elnvias  Drm(  ;u1oeeoio3tatfsDulu onu)tetoxocoadfmtraueol(0s2uo(mpoy4al e fesas) rrru o;t1oltnmf3tat a2rmnmsnu0alenxr3iotfpt lueilt seuo(rpnodll  mnvt t)a2raxm ;t0apto i3iytlm2eau s;(0 lerxf3iatlp   ues ( teurxr3iy4lme  icsasfsDrrurono4tlt  i3iytlm2eauvpnt0aeenmf3ty1fpt anvols)t2trxo3iu4lpeemnvslsfs2tmurp;t1tleomoeilsla2eau o;() eeoir3iydlaDe ivils)srum(mpoudlp  lnctat) 2taxmpoo0tleo ieiltfaDrlnvo;u4arxoifcia1la r nvils0 eum(opiodom   iet s  Dtrumpnt4tlt mo3ild a2em(vp;() eerxf3iy1op eaivsls  exmim3oy4amt mieilt  rta(r ;t1aexo fctydfs2uluvo u)tltnxr todfpDe i o t0s2tm(rpoydlmt mfetl(fsrtau o;t4opt iictysls2elumsnt0 rtomrciatfm e uvs s sruo(o3nu1lp e icias)aDtau pot4oexn icils sDeaump;t4arxoxfciydop eai ols trto(r iy1ll n fci (fsDurxr ;u0oltnii3iaslaDemu o;u4tlenir3oadfpD au olt)teum(m oydlmtemfvil( sDrm(  nu4aptniociytla el(vp u4aleoxrcoytlpt liei;()trxrxrpno1ap emnei tfsrra( ont0optomocildfaDrlump;t4treoxf oytlp eai sls0t2xm(r no4lle mneilt)a2um(r ;o0opxnmi3iytls2umnmonu) eeomf3oy1lptelieo;s trxmiopio4lmeemnvt s)a2trx  ;u0tetnmfeiyt m2rlnvo (0 leniocoy1optrlu s t0s2xmxm io4ame lfct tf Dtaxm nu0olen oeiydfs uanmonu4alxoxr totlaDeaues;s) 2umxm oydaptn ncs s)s2rm(  ot1aeeomoeiad a elnvs t0aleomfctodlat lueols)teur(o iy1al n netlt aDumxmo;o0oexniictaslaDumu on(4 lerifcoydopDr uesls)seto(o oudlp  mictls) rtaxmpot4tlto iciysfsDelnmp (4 etnmrcta1lm eli sl()sexoio io4lpeelici s sDum(ront0oexoifeiyd a rmn o t0tltoiocoy1fat lu i;s  rto(m3oydoptn nes sf rurx pnu0oeenmictatfs2ra(mo t)tetniocoo1lpt  uvs;s  2xmim3nu4aleelfcsl(f Dtrxmo;u1aetoiociydfm2eanms;u4arerxr oytfp   nes;t0srxoxrpnudol elies sfsDur(  ou0optnmoeiasla ua(vsnu4aexoxrctotoatr ivsls0teumirpiodlpeemivsa( aDtmxmpot1tlenioetld sDulu p;u4 lxrirciadfaDraivi;t0setrxr iudlp emnvtatfarrrumpoo0opt mieiyd sDra(msnu)texrmr oytlpt aueo s0 euoio iydom  mnvsas)aDra(m nt4tetn iciatls2elnvp;u0 exnmocta1oa eai s t tetmxr3oodll elivsat  2raur ot0texoiicilsls2rmu o ()trxoxrciydfmD lu slt0srxo(mpnudlpeemncs t)arrm(r oo4tpenmoctatfs2uln pnu4 exrxo to1opDrln ols) euoim3io1apte ictls)srtr(rpot4ope if3ildfs rm(msnu0aexrir3iotlpt  ivs;t0 2umimpnydaptnlnvtl(faDurxmp;u1ale  o3iatls2el(ms;u) ltnmo3iotla elu olt  rur(rpiy1lle  fvsasf Duaxr nt0alxnmieiydlm2uauvo;(0 etnxrctytomDraneo (  2umim oydolt mfeiat) Dtrur ;u4olt  iciaslmDeauvonu) rxnio iy1lpDrluei;t)tetoxr oo4openlfet t a2ururpnu4aet iiciadfaDumn on(0aexrxo3tydlmDran i;t  ruoxmpnu4am nlivilt)artaurpnu0aeeoiocilslm2uln o (4 rxrio3ootlate uvo;()srtmxmpoodoltnmivtltf 2tru  oo0aeeomieildfa rmuvo;t4 rtrmr ty1oat lueol()srumxr3oy4olt miei s)aDrr(rpot4aptnmo3iydfa ranvon(0artrmocootfmt  ivo s)tetmxmpio4optelietat)s2urur nt0aex  feild sDrl( o t4trtoxf3tadfp e ieo;s0 ruo(rpnudom   fet ()arum(mp;o0tetomfciytfsDumump (0arxnmf ty1lptraneil()s2uoim3iu4lmtn ict sfarua( onu1oet ifctyt a ran s u4 rtomfctytfm rln sls) etoxo nydlm nmivtatfartrxmpnu1tlx  fciltla2ulu snt)trxomf iytfate nvslt t2um(rpnu4ope mictatfsrua(rono4alxoiieilsfa rl(monu4teeoir oatlptrlieo;s teuo(o oydapte ncilsfarumxmpnu0optnio3tytfm el( s u0 exnifcoytoptranei s tetm(rpiy4ol e ncia( srumx  nt4apto i3ilslmDrl(vo t) eenxf iatomDrli s;(  rumim3nu4aptelfvtl(f Dtmu oou1aeeoii3iat s rlu s t4 etnmr iodoaD  ues ()t2xoxo oy4ame  fcsasfs2tau ono1aexn i3tysfs uauvpn() eerir3iy1lm eanvo;t seum(r3nudllenmfcs sfaDtr(ronu0apxnmfetyt a rmn o t)tlerif tadlm r uvs s)t2ur(m ny4olenlncs t a2rax  ;u4tle  fciys aDumumo;u)alerircto1fmteanvil( truo(rpio1al nlictas)sDum( p;t1oee ioetasls2emnvon(0 etnmr3tydfp  anes s) eurxr3io4ll elfcs sfsrtaum oo0olxoif3tldfs2el( onu4 lxrir ta1lp r ies ()s2umir3oodlptnmfcia( sDtrxmo;u4ape mf3iad aDuaumpn(0 eeoxr3tatfmDr uvs (0srumir oy4apte fciatfs2rrx pno0alxo o3iltfs2rauvpnu0artrmo3iodlpDelneilt)sexr(rpoodlleelict t)srtaumooo0olt  oetatlmDulnmp;t)treoxf oa1fmtrlivi;t  etr(o3oo4llt mncslt)sDtrxr ot1altnmoctltfm2um(vsn(0 ltnircto1oa   uvs;t0trtrir oodop n ncs (fs2taum ;t1apeomfeiytfm2uln o;(0tleoxo ta1lptr n ilt srurim oy4lltemivsat)s2trxmo;o4tlxomieiydlm emumpnt0trermrciotlm r n s;s0 2xo(m3iudamenlneta(  Dra( poo0ale mociyd aDulumont4 lxoif io1fpD lieil(0s2trio nudolenmfvtl(fartrxro;t1tee mi3tad s2umnmpnt)trtnifciotlmtr ueol(0s2xr(mpnudlpe lictlt  Drmx  ;u1texo feiyslaDumuvo ()aeenmr3io1lm  auvils0 rtmxrpiy1lm n ncs ()a2urump;t1aexomfeias m rmu onu0tltniocty1fmteaneolt0 rxoxrpoudlltemfes t s2uaumpno0aleniieiyd sDran p t)altnmr oadoptean ils trtrir nydolee ici (farrauroot4tex io3iytlm eln o t4 rtomo3iotop  ln olt  2xrxo oo4aptelietasf rtau  ot0aleo ictysfa um(vp;u)arxnxr oadfatelieo ()seuoim no4om  lfciat)a2umur ot4oexoiieils s um(vs u0artoxocoytfp elueolt t2xr(o3oo1lltemfvtatf rumxrp;u1apxo fciysls em( ont4teenmo iadoateai o;s) ruoxopnu1omt  feia( a2umurpnt4ope  fctys aDum(mon()arxnmo3ia1lp eaieo ( srxrxr3iodlm emics t  Dtmu  ;o4alen feiys sDra(mo;u0arenmo ty1fmDraies (0 2xo(opno1lp nmivia(fsrurx ont1optoio3tytfm ran sn(4aetrifciatla rln o s0 euo(mpiudomeemncil( arrrxroou0aetnmieiydls em( p;u)trermr oatla rluesl()truoxo ny4olt mfes ()s2raurpou4oltnio3ilt a2rm(mpn(0tltnir ia1lpDr i o;t0t2umio3iydapt  ivslt)srum(  no0tee  oeiatla eau s () etnxf3tatfmDrlivo s) rum(opnu1am elics (  Dur(m ;u1tptnif3tytfs rlnms (4 eenio oatfa ranei t  rxmxrpiy4omtemfet sfsruaxm ;u0tpx iietatfm2rm(mp;()teerif iotom e u i;s0seum(r iydlm  lfeiasfsDtaxm ou0tpxnmfctas sDuauvsnu4texrmo3oy1fa  luvo;t  2tr(o oudlp   fci tfs2trumonu4aet  icilsls uln o u4aexomr3oo1fpDeln o;s0s2to(o iydamtn nes t  Dta(  oo0aeenio3ias sDraumon(4teenircoatopDelnes;t)s2toxr3oudomee nesls  Drrxrpnu1apx mi3tas aDul( pnu)teeoxocootlpDeau ol(0 2urxm3io4amen nctl( a2trxmpno1teto ictldls rl(msn() leniocoatlptr uei;s)seurxmpio1lpt lnes s) Dum( oou4oeen ocildfa eaums t0altomr oytfm  lu ilt) 2xr(o3iudlpe  fes t  2um( o;u1teen fetyt sDumump;t4tltnio3tytom r u olt)texrir3oo4llenmfvs t)sDtaur ot0apxnmiciat s2ul( o;()trtrxf3oa1lpDeanvi s0srur(m3oo4alt  ivtat sDtaur ot1aeen o3iad mDrluvpn()trerio3oadfpDrai i (0 2urirpno4llenlfciat aDtau o;t4oeeomo3ild s ulnvp t0aexnxoctatoatr ueol() rtr(m oy1ape mivt tfs2rmuront4opeoifctasla2rlnvpnu0 rxrxr3oa1laDeluvol(0 2xr(rpoy1om e icsa()sDrmx  ;t4aexnmoeiasfmDelu pn(4teeoxocoo1fat  uvi t0srtmxrpoy1am n iet ()sDtmx ont0aeeoifeiltls ea(vp u)arenmo iodfp  aues s0t2xm(opou1lp n nvia(  Dur(r ot1tlt  ietldfmDulnvp;t4tleomf3iytlatranvo t0 rxmim3ou1lmee fci s a2rmum ;t4oexo oetyt s ran p (4texrmf oydlaDrln sl( trtrxopiy1aptn iet sfsrum(  ;o4altn feiysla el(vs u0texnio oadom rlies (0t2xrxr3ou4lm nmncsatfa2tax p;t0oeenifciatlsDulu ont0alxnmr3oytfa eauvs;s0 2tr(m iodom n ivtlt) 2taxmo;t0oetomociatfsDelu s (0tltniocta1opDraivi;t0srur(m3oy4omte ictat s2raxmpnt1tlxnio3iadfmDuanmpnt0alxomfcio1lpt livs t  2trxrpoo1llenmfvtls)aDtru  ot4oeeomf3tysfa2rluvo u0texoir iytopteauvs;t s2toir iudal  mncs s)s2truroot4ape  ictld a el(msnt) lxnxo oydfaDeluvo s)srxmio oo4apte icslt artmu poo0teeomo3tlsfmDemnvo (0aetnxf oo1lpt auvo ()seuoxmpny1ll  livilt) rrm(m ;o0tpeniociadlsDumu p;(0 etnmf3ta1fa e nvo;t  rxmxr nudamte feiltfs2uau o;u1opt  iciad mDemu s;(0trerif oydlmte uvs s) 2xm(opiydlp  lfci t srtrxr nt0aptoio3iltls rlums;(4alxnioctodfpt anvs t seur(m nu1apt mnetatfa2raurp;u4tleoio3tld mDrauvo;u) rxoxo3ta1lp   nvs;t0teto(m iu4olenmfctl(f Dua(ro;u0alxo i3tys mDeanmon(0aetrxr3ia1lpDr ivo;s0t2tm(m3oy1altnmivi sfsDtm(monu1oleo f3iat m rlumpn(4trtrifcto1fptr nesl(0sexriopio4lmtnliciat aDrr(rp;o0oexomieiyt sDeln o;u0texniocoa1lpDeauvi ( truoxr3ou4apenlnvsas)aDua(m ou4tpt iieiasfs ranms;u4aetoifcoatlmt  ieo ( teuoxrpnu1op  lnetls)aDrax pnt1aptoifcildfa ul(mont0tetnmf3iodoa  lieo;s0t2uoxr3ou1lleelfesl(  Dum(rpoo0alenif3iytfmDum(mp t0 ltnmfciatfa e ivils)s2tmir io1lptemicsa()sDtax  ot0opxnif3tls aDemn o ()trxnmr3tatlmtraivolt) eto(opoy4al   fvs () Dtrur ou0altoiictadlm ea(vo;()tlerxfcoo1lpDe i sls)s2ur(r nu4altemncsls)aDta( ooo4oetoiicilt s elu o u4 rtrxo iotom rai o t) exmir3oodlm e fcsas sDurum nt0alx mietldfm2ulump u0arenmr3oytoaDeaieo s  etrim3oydaltnmnetas)sDtaurp;u0optoifetytfs umuvsnt)trerxf3ty1om  li s s  2xrxr3iydlp  mfeslt a2tm(moou1olx mieiadlm rl(mp;t)aetrmo3tydopDr nvo s)s2uo(m oudlpeelicslt  2ua(r nt1aexn icilsfa eluvp;u4aeeoio oatlptraueo;s  rxoxo3iu4lptelnvsltfaDuax  nu4oltomiciysla2ul(mp;u4 lxnxr iotlm elnvs ( srtoxrpno4open ivilt)artru p;u0oee  ictyslsDeanvo;() renio3todom  aies s)t2xoxo iy4ole miesas s2tmxr no1olt ifciatfs eaumsn(4teenxfciatoaDe ies;s)t2xoim iydlptn netltfsrtaum ;o4teenif3iytfs2uau s (4 rtnxociy1faDrai olt)s2trxmpnodlptnmnesas  2rmxmo;t4apeo o3iydls rlnvonu0tlxrir oa1la  li i t)trtm(r3io1olen icsas aDtrxr no0tpenio3iltla2rmuvo (0 renmr iydlm  livo;t  2xo(opnu1al   fcsls  2ua(mono4aeen i3tldfm uln s u)tltnircoa1omD  n ols)trtrirpoy1ap nlfcs tf rta(ronu0olt  ociys s elu p;u) exomo oytoaDr n o;(  2toim3ny1ol nlfeil( srrr( p;o1tpeo ietadla um(vpn(4 eermf3ootlat  u ils)trtrir3oydom elnvsat)srrau  oo4aeen ietatfmDemums ()trtrir3iatla eluvolt seur(o3iodome  ncsl(f rtmu p;o1tpto feildla uaumpn(4 exnmo totlptran o;s  exrxm3nydoptemivsltf 2tmx  ;u1tlxoiicildlm2um(monu4 leoircia1fmt aieols)setm(r iy1ap   fvsl( arrr(mo;o1opxnmiciyd sDrln p ()aeerif3oodlp   i s;t)texrxm oy4apt miet t srtmurono1aetoifeiydfaDeanvp t4aeenif iatfmtr ivi t  rtr(m3io1lme  ivil(f Dumxro;o1tetn ietatlm2ul( s (0tlxrmoctytfptrlnes;( s2toimpno1llt  fcs tfaDtaxmooo4tex mo3iysfsDranvo;t4tlxoxfcty1lmtrli o;()tetrxopnudomte ivs t) 2tr( ont1aeenmoetlslaDumn s (4tetrio3tatfaDrau o (0 etoir ou1am e nesatf rtr(mpou1tpeomoctyt aDranvs;t) rerxf oy1op rau sl(0teum(r3oo4lmt lnctl( s2rrumpno1oetnmoctyt m2umumo (0texnmr oadfmDr iesls t2uo(opou1alee fvilsfa2rr( o;u0tptoiictydla elnmpn() eenxf oodomD  n i;s)tetrxr oudomee ivs ( arrrxmpoo4tlxn fetlt a uauvo;u0 exnxo ty1fpDelivs s0tetr(r ou4lpt liesa( s2umurp;t1tet  ieiltfa uau p u)tlerxr3ta1opD aueo s0texmirpou4omeemfciatf rrrur nt0apen fetadfaDelu o;(0trtrir ootlm   ivol( trxo(opnydap e fciatfarrrxr no0oee ifcilsfs rmnvs t) rxnmo io1faDrlieo;s) euoxopnydol elfeilsf 2uaurpot0tltoioetadfs2umnvs u0texoirciytlp rlneo t0trtr(o oo4oleelfviat s2ur(rpnt0tptnif3tyd s2rmuvp u0teerio oadlmD  i i ( tetmxr nu4lme  ivta(fa2rr(ro;u4altomiciydlm2rl( s;t0texnxo3oy1fp rln o t  rumim3oudal  mncs t)sDurumo;o1aetoiociltfaDua(mp t) leoir oadoaDraivo s)teurio3oy4amen fetl( aDrau  nu1tlx  oeiltls rl( p;u)arxoiocia1op  lieo;( truriopoo1apt mnct tf 2taumoou0tlx mieils a2rlumsnu4 ltrifctodlmDeauvi;( setr(mpny1lpee fesls) ruaurpnu0opxomoetlsfs2umuvs;(4aeenir3tydlateluvols  2tm(rpoudlleelicslt)sDrau  ;t4tetn i3tydla2rau o;u)arxoxr to1fp  aueo s0t2xoxo nudlp elfvsls) rrmurono4optomfetlslsDuan p;u)alxnxf3ootfpD aueo s0seumxrpiu4aleemfvils srtaxm ou4alt  i3iad a eanvonu0 eenxo to1fatrauvs;() 2uoir oo1omtn nvias  Dum(r ot1alx ii3ilsfs uauvo u0 exoxo3iodomteluvs s0 ruo(o3nydamen fvs sf Dumu  nt4tex  o3tlsfmDemnvpnu0 lerif oatoptraivil(  ruoxo no4al  lietlt) Drr( p;o1ope if3ilt s emuvont4tleoxrcta1lpD an i s0 etmio iydllenlict (  rraxroou1olxnmo3iyd m2em( s;t)alxomoctodlmtr i s t)s2uo(o3ou1am nmictat)s2rau pnu4olen ietls aDul( snu4alxrio ta1omDrlueo;t) 2xm(opiu1amtnlfet t) 2rruro;o4tptoiociad sDrmu p u4 ltoxo iytom  an i;() 2xoirpoudamtnmiet () Dur( ono1olt  o3ildls2rm(mo t0 eeoif oy1fa ean s s0seur(o oo1alte fvias a2uru  ;u1oee  oetytlm uanmpnt4 ltnmf3oodlatraivo;(0teum(r iu4ame  nesls  2tmurpnu4tpeoif3ilt s rlu s u0 rtoxfcoydomDrlnes;s0 2tmio oo1omtnmnvil( s2uaumont0tpxoio3tatfm emums;t4aexnxf3oa1lpDraueo;(0t2xmio3oo4op elieilt s2umxroou1aex ioctas aDua(mp;t4teeoxr3iodfa eln ols) ruoirpiudol nlncslt)s2tr(  ;t4tlx  ieiatla2emnvp;u)teenxr3tytoa rlivsl()truo(rpiu1lmt lictl()sDrau onu0optnifctlt m uau p;t) rxomfcoy1omtrlnvi;s) eurimpio4amenlivtlt  rtm(rp;o1tleomo3iysls2ra( p u4artoiocoodlpDelnvslt)teur(m iodam  mfctas  2trxrono0oltnio3tad a2uaums t) etrxfctatla r u i;(  2tmim3no4ll  mnvtl(fartm(m oo4tltnifciatfa2eau p t)tlerxfcoy1lm  livo;( s2xmimpou4am emneta(f rurur ;u0apxo fcilslaDemn s;t)tetnmfcto1fa   nes;t)setoir3oy4am e ncs sf Dtrxmp;o1opeo f3iatfm emnvsnt4trtnxo3oy1fp  lu s;s0trxm(opiu1am   iesa() 2uau ono0oleniietysls emnvo;t) exoif to1faD ln s s)trxmirpiy4ame  ictltfa2rrxmono0tptniicilsfaDul(vo;u)alxrmrctodomD lnes s srto(m io4lpt lnvs t arururpnt4oee mi3tad m2elumon(0treomr3iydfptr ivi;s0seurim oy1oleelfesa( artaumpou1oexo o3tat aDul( o;(0altrxf iadoa r neols  2tr(mpiy1llt  ivtas srra(  ;o4teen f3ias m elnmo;(4 rxnxoctydfmDraivs;s0srtoimpno4lltemiei t)sDtrxrp;o0oetnmf3tasfm2em(mo u0teeriocoatfm rluvs (  exo(opou1lp e fcsltfaDtrumpno0apx mfctat s2ean p u0 exoiocoytfpDrlu ilt)s2to(opou1lm  mnctl( srra(ro;t0opt  octydlm rlums;t)tlerir3iadoptraues s) rtoxopiu4ap n icsl( a2tmxrp;o0apen f3iys aDemuvo t4 rtnmr3iodomD  iei (0s2toxo nu1lp nmicsa( sDumx  nu4apen f3iaslsDemumpnt)trtomfciotlpDrluvs;(0 rtoxo ou1ll e neilt)a2rax p;u1apx iociysls rluvsnt) etrif3iytoat  nes;(  etmxopny4altnlici ()a2tauronu1tle  o3iydlm rl(monu0trxomo tytfmDeln o s0t2xrirpoo1ap emnctlsfsDumx ont4tpen f3iatfmDua(vs u4trtrio3iydfmDrlueils)srxrxrpoydopenmnvta( sDrrumoot4aex  ictad m el(vpn() exrmocoo1la  lies;s)s2tmim3nydole  fei sfs2uau p;t0apxomfeiyd a2uau o (4teenif totop e nvi (0 rxoimpnydomenmnvt sf 2rrxr nt4apxn ocilsla uln s;t0tetrmfcoa1fat lu s s0s2xoio iodalte fvia( arrru p;u0tpenmiciytlm ranms;t4tltnio iatlaDeauesl()s2uoio oy1aptnmneiat) rrm(moou4aet  fctad a2eanms;t4aetnir3todfateliei t0trtoxo3iu1ol n nvsat) Drrx  no0aeto fctad aDrm(vo;(4 renmf3totlmD lies;s)t2urxr iu4op e nvi t a2ua( o;u4tlt io3tydfaDel(vpn(4aexrio tadfmteanes;s0srtoxm oo1ole mfesas)srum( ono4opt mo3iltlm ran p u4tltrmo iy1fm elu ol()trxo(o3nodamtemnci s a2raxmo;t1aptn i3iasfaDra(vs ()trtomf to1latr i s;( sexm(rpiy4ome  iciat) Dtm(  ;u4apxoii3iyslaDuauvs u) lxoxfciatfptraivi;t)trto(m oo1ape lnei s) Drr( ooo1teen i3ildfs eau o t0tlxomr totlm elu o;t)teur(r oo1lpe lictat s2ta(rooo1oltoio3iydfmDean s (0 rxrmrcoydfa r nei t)tetoir3oy1lle mivias)srrm( o;u0oltn i3tytfs emn s (4aetrxo3ootlmD aivi (0 2tmxr iy1lmtemfesasfaDtr(  nt1alx ioeiytla umnvp;t)aexrmf iytlmt au olt s2xrir3nydope mfeiasfsrrmxroou4apen ieildla2emnvs;(4trxnio io1lm rluvs;s) rxrxopou1ap n ics t s2ua(monu1aptnmieiyt m2ea(ms;(4 leoir3oy1op rlivil(0 eto(r3io1omtnlfet (fa2tmumoot0olxn f3iyslaDeluvp u4arermo tytfa   u o t0srxo(mpiy4amte ieils a2rr(  nt0oet  fciydlm2rl(vs ()alxnxrcoa1fmtean ilt)setrxm no4omeemfei tfartaxmp;t4aetn ociyt sDem(vo t0artriocoodopDeauvsl(0tetoir oydap   nvs (farra(  no0olxo icias s umnmon(0 eerif3totoptrau i (0t2umxr3iy4ap nlfci s)srumxm oo1opxo oeiatfm rm( s;t4tltnifciadlm rln i (0t2xm(opno1alt  ict ()a2raurpnt1aptnmociadls emumo u4arxnmr3oo1lmtr ueo;s t2xmir3iy4lpenmfetltfsDrm( ont1tptoio3tadfs ranms (4aexrir ootlm rauvo s  2xrxr3oy4oltnmfct (fsDumu  ;u0alto fciadlsDra(vp;(4arxrirciy1lmDrlu i s) euo(rpoydalt mics (  2ua(r nu4ale io3iad s2rlnmonu4 ltrircoodlpDe iei;t0tetrirpoo1altemfetlt)sruaum oo4optn feiydla rmump u4 ltoxo3tadop  luvo t)tetoxr3iydaptnmnvtl(fartmurpno0apxo f3ild s2rlnvsnu)tlxoiocio1fa raueo s trxrio nu4amtnlnet (fa2rm(mp;o0tltnmfciadls2rlnmp;(0 ltomf tydfmDe nvs;()trur(opny1amt  ies tf rumurpno0tlxnifetytlm elu p;t)aetoircoydop   ies;(0t2uo(opou1openmnvt t arra(mo;o0aptomictytfs2rmuvo;u0trxnir oydoaDrluvs;t) rumxrpio4olt
\ No newline at end of file
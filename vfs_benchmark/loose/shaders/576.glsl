@@ -0,0 +1 @@
+ieols  2toir iodop  mivs ( srtrxro;u0tlen ieilsfa2umnvp;u4aexnxo3oatopD  uei;s) rur(mpiudalte fcs t srtaurpou0tlen oetadfmDuluvsnt4alxnxf oadfa   i olt trxm(o oydame  neias)srtrump;o0oee ii3iltls2rl(vsn(4 rxnxo ootlaD  ies;()sexr(m iodlpeemfetlsf 2tmu pnu1tpxnifciadls ra( s () renifctodfmDe nvi;t) 2xr(o3iudam e ivsls  Dum(mpoo4alto feiysls2rm(vs (0 ltnxfctotlp  luvi ( srtmir3no4aleemicsl() 2rrxrpnt0opx mf3iys a ulnmo u)trermfciodopteaneol(0trxrxm no4al   iei s)s2rmumpnt4tex  ietyd a2uaums;u4treriocta1fatrai olt0texmim3ou4lmtemiesat)sDtm(mono4opxn ietlslmDum(mpnt0artoxr iytlm  li o s0t2xmir oo1alte ivia(fsDua(mpoo4tet miciytfmDrmu s (0alxnio iytoa eanvs t) rurxm3no1ol nmicsatf 2ra(  nt0aeeoii3ildla emuvo;u4 lxrxf oadfaD aneo;s  rurxm ny1apen icias artax ont0tetnmfctad m rau p;t4aetrmf iadfa   ieo;s0tetmirpoy1am emfcslt) 2rm(rono4oeto i3iat mDrmnmp u0artomo3iadomD  u s (0srxrim3nudam e fesl()aDtrxmoot0tetn f3ilt sDel(vo;u0aleomf oa1fa r u i (0truo(m oydom   ies () Drrumpnt1olenioeiadlm2elu o;t) reoif3ootomD  ues;()s2xmio ou1ll elnetas)s2uaxm ;o1aetoifeiytlm2rauvonu4aetnxfciodop rlnei;s)setr(r3oy4omtelivsa(farum(r oo4opt io3ias a2rmump t4 etnxf oadfp rau i;()sexo(o iydalt mnvtlt aDuaum ou0tpen iciad sDel( o ()texnir oadfmt  ivs;s0 rto(o iu4alte ies sfarumx ono4tee  f3iatlaDulu o;(0texrir totopteli s;s0s2to(r3nodam n fcias sDtmx o;u0teeo o3iltfsDrl( pnt0 eeriocoo1la   ieolt srtm(m iydalte ics t s2uru  nu1oex  feiat a2umnmont0 ltnxr iotoaDr ueol( srtrxm3nodap  mictltf Dua( pot4opeomf3tys a2ran p u0 lxomfciy1om r neo;(  eum(o3nudlle  nvsatfsDururooo4aleoioeiasfs2ulnms () etrxf3oadopD lies t0teumim3nu1opt  ici s  rtmxmo;t1opeoio3iysfm2rm( pnu4 ltoxf oa1la r nvols)s2tmxmpoy1ap nlfcsl()sDua(mpot0tptomo3iad mDrmu snu)alxnxo3iodfmte ies (  rumim iudap  micils) 2uaumpno4aetn oeiltlaDuluvo;u0texnxf3ootopte ies;t seurxmpny4ameemieiat) 2rau  ;o1olen ictatls2rauvont)treoir3ty1lp rauvi t  2uoirpiudom n iviltf 2um(ro;o1oex io3iat aDemumo;()artnmfciotfaD ai il(0 2uoxm oudlm nlfes ( aDrm(ront1alen f3tatfm elnms t0trtoifcoo1latr ieo;s  2tm(r ou4al emivilsfaDrru  nt4tetnif3iys m ra(ms u0 reomf ootfaD anvi;s s2xrir no4altn ieta(  2ururo;o1opxn feiys a elump () exrif3iy1lptr uvi t  2xrio3nodllt mieta(f rrr(mp;t4tpxo f3iysfm2rln s;t4trenircoy1fp r uvo;s0 2uoxo oodll  mnvias)srrrxmpnt4ape mf3iat m rluvs;t)trxomr iytlaD lneil()texm(opnudllenlietas)arra(mpot1apxn f3iysfm2ul(vo (4 lxrxfciotopt aies;s0trxmxo3oy1apt  nct (f rrrxm ot1aptoiocilt mDelu pn(0trxrxf oa1fmD lu o s0 rurir iu1lpt  fei sfaDrmu  nu0openioetadfm2rln o t4arenif oo1latr ues;()trto(r no1lle  icsa(f 2trxrp;u1aeeomiciydls2elu pnu)arxoircia1opteanei;t) 2umxr io1oltemncs s a2raxmooo1aexomo3iyd a2eau on(0 rxoxfctadlpte ueols0 euo(opou4amee nct tf rur(r ot0alt moetytlm umuvp;t4areoio3iotfmDr uesl( setoxm3iydapen fcilt)s2raumpoo0optnmoctydfsDrau o;t4arxomfctydfm rai sls)sexrxopnodlmt lfeta(fsrrrxrpot1oleomociyd a el( pn(0tetrmf totlpteaues (  etmxo3oy4openlnctatfsDrmxr ou4tlxnmo3ildlmDrlu o;(4 renmocty1fm eliei (0 exoim iy4ll  mnvi ()s2tm(rp;t0tex ifeils mDrlnmp () exnxf oo1fa  luvsls0seuo(opnu4ame lneslsf rra(mp;u1tpxomictysfa2umnmsnt0tltoxf oy1fmt li sls trxoim3nu4oltemfeslsf Dtmxm ;t1tlt  ieilsla2ulu s (4texoifcty1lm r u s;s0texoxopoydomeemfctlt  2rauront1tpx ifeiatlm raumo t0texoirciadlmDrluvs;( s2to(r3oy4om elnvias)arumxmo;u1teen f3iytfs rau o;(4aetnio to1lpDrlnvo;s0 rxrxrpnu4olenlfviat)sDta(r nt0tlt  f3iatlm2elu s u0altomf ootlaD  ivols) eumxrpnudllenmnetlt)a2rr(r nu4tlx ifeiltlmDua(vsnu0tlxrifcoa1optelieils)t2toxm3io1amtemnvsas) 2trxr ot1apxomieild m emn s u0texoifctatom ean s t0t2urxm iodamenmiet s sDraurp;u4tlx moctldlm2el( pnu) eermrciotlmt livs (0trtoxmpiydomt mnct t) ruaxronu0tleomfeildfm2raums ()teeoir3oytlmtrlu i t0 exoxm3io1lpte fvtlt  Drr(rpno4olxomo3tlsla uau o;t0 lxrxr3oodlpDe u olt0 2xr(m nudlpee ieilt a2rr(rpno0tpeoiietyt aDuln s t) lermr ootfmDeau i s  2xo(m ou4altn ivils aDumumpoo4ape iociydlm emnvo u0 eeoifciotlmte ivilt0s2tmir iu1lmt lfvilt srtmurp;t1aleomoeiysfm elumo (0arxrir iydoat auvi t0setmxo io1ale mies t)aDtm(r ;t4tetomfetadfsDra(mo t4arxoifcoa1fmD ln ol(0setoio iodll elnctlt) rua(mp;t0oetnif3ilslaDul( o t)tltnio to1omDeanvo;s)t2xmxopoydolt lictas sDrr( o;u0ole mo3tls a eauvp;u0 lenxr iy1om rauvsls  rxo(o3iudlm n ietas artmxro;u1olt mociydlm umnvsnu0trenif3iatfat anvo;( seuo(r3ou1om eliciasfaDurxr ;o4opt mi3ias mDrlu p;t) rxrif oatoa   neolt t2urxo ou1lmtnmivsasfarururp;u0tpe iociltlsDrm(vp u)aetoxf3tytlm e nei;s0sexm(r nodomt lfct sfa2ta(m ;t0oexo f3iysfmDrlnvs;t)tetnmr oytlmD lnei t) 2xrxmpnu4lp nmnciat)aDraum ou1tpxomoctysfsDemnvon()trxrir3iydoateauvs (0s2tmxrpoy4aleelivi (fartr(moot4tpt iociys s uau o u)aleoxrcoatop e nesls0teuo(rpiu1ape  nei t  Dtaxm ot4ale ii3iad m2rl(msnu0tlxrmrciy1oateaieo t0 2toxm3nu4lme livsl( s2uaxm ot1tpeniociys m eanvp;u4arenio totoaD  n o (0t2xoio3oo4om elfes tfsrrr(mp;o0tlxo feiaslm rln p () rtomr tydfaD au o s0 2toxopoodolenlnvia( s2tau ono1tlxo i3iys s el( o u0aeenircoytfp   ieo;s0 2xrxo3oy4opte fvi s)s2uru p;o4opxnio3iatlm2em( snt0alxnioctatlmD lu i;(0 etrxm oudom  lictlsfsrrax p;t0oet mfciad a2ulnmsn(4artnmo oa1faD  ieo t  rumxo iy4altelnesatf 2rax pot4tee iieiydfaDulnvonu0 eerxocio1opteanvo t)s2uo(m3iodap nmicsls a2uaurp;o4olto oetyt s elnms u0aeerio3to1lpD au i s0setmxr ou4lmeemivt t srraumoot0aptnmo3iytls um( sn(4 eermf3ootop e ieo;(0 2umio3no4lmenlfesls  rur(  nt0oltnifciasfs2em( p t0trxnxo3ootfaD au s s)sexrxm3nydop nlnvtas aDrmxrooo0aee miciat a eau p (0 rtrioctytlaDrlu o;t0s2tmim3oo1amtnlict () rra(mpot1opto ociaslm2elnmont4 reoxr3ta1latelu s;s0teuoxopnu1omenmnvil(faDrrxmooo4olxomfeils s ul(vp ()alxrifcty1op elu i;( teumxr ny4oleelfcsat aDtrur nu0alx mocils m2eaumo t) rxrmfcia1fptrluvs s0trto(o iydome  icta() rra(mooo4oleo ictyd a emuvo t)tetnxocta1latrli ols0t2umxo nu1lp   nctlt)s2ur( oou4tet  ietlt aDel(vonu)tlenifcootfmD aivi t0tetr(mpou1alt mfcia( sDtm(  ;t4apt mociltfa2emnvs ()aexnirciodlpte neols) 2xo(m iu4lp   ncs sf 2ur( ooo0alx  ictasfmDea(vs;u0alxoxoctadlpDe ues;s0sexrxo3oudlp nlnvslsf Dur(rpno1ape ioctys a uaump;u) exoxf3io1fmtr uei;()setoim iy1optnlivsl(fs2taumonu1apxoiocilt s emu sn()aexnio totopD lu s t  2tm(r oydamte feta( s2rau ont4olxnifeiyt sDrauvsnu)altnifctadlpDe nvi s) rxm(mpiydllee icsls) rrmumo;u1ope  iciysfaDem(ms t4 eenxf3iydlmDe n i s s2tm(opiy1lpenlfviasf Drm(rpou0tex  ociadfa umnmon()aexrxo3oa1faDran s t) euoiopoy1lm elfvsat) rurxm ;u0apen i3iatfaDuauvsnu)teeomo iadfm  aueil() rxm(r iy1ape mnvsatfsDtrxrpou0oeeoio3ild aDuluvon(0aeeomrcia1laDr n ils)trtr(rpnudameelfct ( aDurx o;u0opxn f3iasla2rmump (0arenir iytfmDr nvi;t0 rumxmpiy1altnlfvta()aDrau ono0apt mfciltfs2ea( o;t0tetrmo3oydfateaivo;t0 2uoimpnydomenmnet () 2urumpoo0apt iictlsfmDranmsnu4tetoifctodfmDrau o;( trtrimpoydll e fct s) 2ua(m ot1tpen ietatfs uau snu0aexrirciadfm  ai il(  2tmir oo1ol e nvtas)srumxr ;t1apt iociydfmDel(vs u4texrir iytop eaivol(0trxoir3iy1lpe mfeslt)a2uax pnt4ope ioeiytlsDrmu o (0aexnmoctodlmDe uei;(0texrxr ou4omte ieilt)aDtmxm ;o1aexomfciyt m rmumon()altnir iytomD  uvslt0seum(o3iodoleemicilt srrr(m ;u0olto ieiadfsDum(ms (0 ltrif iodlmDelnvs s0s2umxmpno4omt lneia(  rua(roou1olxo ieiydfsDrlnmp u4 rxomrctatla rlnvs;s texrxopno1ol nlnes t  ruauroot0tleomi3iytls ea(mp;u4 ltrxo3ootfpteauvo t0 2tm(m oy1apt liesas sDurxmonu0apeoio3tlt sDul(mp u0aetrmo3iydlmDe nvo () 2xoxopny4ome lfctas)a2taxm ;t1opxnif3iytfs2rm(mo;u4 ltnif3todoa  au slt trxoio3io1amt  fvtls) Dtr(r ot1teeomieiyt a el(msnu)trxrmoctotlat lnes;()trumxo ny4ap e ieia(  rtm(rp;u4tpxoif3tysfmDem( snu)arxoxo3oydfp  ln il(0 2tmirpoo4lpt mivta( srrr(r nt4aptnio3ilsfm2eanmp;u0tlxrmf iotopDean s (0tetmxrpio1lpte fct tfarrm(r oo4tex mfeias sDul( p ()arxnxf oo1fpD lu s t0trxrirpoo1apeemnes t)arrmump;u1tpeo fctldfm2rm(vp;(0altrif3oytoa elu s;s srtrir3iu4ll elfei t srumx  ;o1aetnif3ildlsDra(mp u4arxoir3oydlaDraivo;s0s2urimpiy4alt lnvta(fa2trum nu0apx  fetytfmDumumpnu4tlxrmf3ootfmDelu o;() 2xoxm iudlmen fci sfsDtru p;o0texniictltlaDea(msnu0 lenircia1lmDran o;s) 2xrxrpio1alee iet ()arumxm ot1tleomf3tltla2eau s t0tlenmr iy1lptr i sls srxo(m io1om n ies sf Drm(m ;u4opt mfeiltfm ul(mpnt) reoircoatomt aivo t s2xr(o iudop  lfctlsf rtruro;u1ape  feiytlsDea(ms;u4 lxrifcoa1oa eluvo;( teuoxopno4apen iei ( sDurxmp;t1alto iciatlaDra(mpnt0trxnifcoodoa  lnvs (0sexoirpiu4lmenlictlsfarur(rpno4tpe mieiydls emn onu)arxnxf3tatfateai i s  rxriopou1alee nvias s2urx pot1aexn feiytfs emu p;u) exnxf oatom elnesls0 2toxr no1oltn fet (  Dumxroot0ale mieiydls ua(vsn(4trtoxr3oy1omD  ueo;()setrxrpiu1am nmncilsfaruaum oo4oeeniicilsfs el(ms t4altoiocootlpte i s t  rxo(opio1lme mfei t)a2rmxm no1optnmi3iadfmDemu sn(0artrir3oatoptranesl(0srxrxrpio1ll elivtas s2rmu poo1tpeoioetasla2uan s u0treoxo3oadlaD  ueolt t2xrirpoudlpe  fvi s sDra(r ot4tltnmi3tad sDrm( s (0 rxomr to1la rai s s  ruoxo3iodom  mnvi s)s2rau oot0optnioetytlaDemu pn(0 eerxo3ta1omtrauvols)trxr(mpoy4lme  net t arum(  ;t4tex mi3ildlm2emumon()tlerifctodlp  anvs;s trurim oodlle mnctl()srrmxrp;t1apenmi3iltfmDrmnms ()tlerio3ootfat  uvo s0 rumxo nodom nmfvs sf rtmxm ;t4oltn ieiltfmDrluvo;t0 leoxo3oatfpDraueo;t0tetm(r iy4omtnmfcsat srtm( pot1aptomi3tysfaDulump u) lxrir3ia1lmteliei;s)srtoim oudlptnmncsat srrrxmpou0opeo feiysfaDea( o;t)altrmo3ootfm raieol(0s2tr(mpoo4apt miviat) rur(rp;o0olt mi3tld s2rm(mo;u0 ltoio3to1oateaivi;t0t2trxr ou1ope  ics t)aruaxm ;o4alx ifetas m2eanvp (4aetomfctytop eauvolt) rtoxmpoy1altelietat)aDtrxrpnt0aeenmfciydfa2umn snt4trxrmr tadlpt aivs;() rtrxopnu1opt lfci t artmur no4aexn iciyslmDeluvo;(0tetrxrctadlmDelieols) 2tmxopnodlme mivslt)s2urxrpou0opxoioetyt m2emnmp;(4aexoifcto1lp r ivo t s2xmxm3iu4ol n ivslsf 2trxr no0tpeomieilslmDrau sn(4arerif iodoateai i;s)teuoio nodlmte neiltfarrmxmonu0teeomi3iat s elu p;u)tetnmo tadlmt ai s;(0texriopiodole  iesat a2rru  nu4tpeoio3ild sDelu snt) ltnir iatopDraieil(0trxrxrpio4openlfvsa()a2uauronu1aexoii3iat a2elnmon(0 etrxo tytfmD lieo t0 2um(r3iu4lle mncia()arrmu p;u4tpxomfciytlm ea(vo (0alxomfcio1om e nvo s0 2tmirpoudlme lnetasf Dumu o;o4aptn ocils m2eau p u0 exnio3iodfmteauvo t) 2toio oudame mnvtlt a2raumoou0tlx  i3iltlaDumnmont0 lenmfctodfmDrli o;s)texoxopoudll  lfvtasfa2ua(r ou0opxoiociyd a2eauvpn()aexrircia1la  lnes;(  2urio ou1ll n ncsl() 2umu  nu0opxo f3iad m ea(mp (4tltomfcoadfmD aivolt  exmxr3no4amtnlivs t)s2rm(mpnu4apen f3tat m emump;(0trtrmocoydlaDelnvsl(0seuoim3iudam emnesls)s2trx  ;u4aet  feiyt sDulumo;t4 etoiociydoaDeauvi;(0teumxm no4oltnliesat  2tmurpoo4tlen feiydfsDua(vs;u0artnxo oy1lm e nesl(  2xoxo ou4om  mfeils) Drr(mooo4tlx  fctlt mDul( snt)tltomr oodfp eai il(0 ruoxo no4op elnetls)a2rrxmpnt0tpxnif3iadfm2emnvo t0aetomocoo1lptr ies ( s2uoim iydomt mnei t aDtaump;u0tlx mf3iltlmDelu pn(0tltrmo3ta1laDr ivs;t) etmio iydaptelfci sf Durxmo;t1apenmf3tlt mDuaumo;t4 lerirciodlat anesls s2xmir3iu1olte fesat srrru p;o0tlt if3tlt a rm(mp ()aetomf3io1lm r i sl(0trto(opoy4omtelfcsl(f 2trxmpnt0apx mo3iys m rmuvo;u)trxnif3iytoaDr nes;(  etm(opnudoptelnesatf 2tax pnt4apen i3iat a2um(mpn(0 rtnmf oo1oat lueilt0 2uoim ou4lmte nciltf rrrurpot4tlt mfciyt aDum(vp t)altoxf3iodfa rlieo;s) eum(r3iydam n ivsa(  2rrxroou1tlx ifciatls2umuvs;t)trxnir tydoa eaies;(  2tmio nu4am n fetls)arurumpnu1tpt ifeilt m2uluvo (4 etrxrcootomD  n s t trur(r3io1olenmncs s) Drrxr nt0tltn fcild s2rmuvs t4altrif3oydlaDeaneo;()seumio3oo4ome  ici tfsrra(ro;t1tpeo o3iysls uauvs;()tleoxr3iodlpD  u s;t0s2trxm iy4ap  mnvt sfs2urxrp;o0tee  o3iltlm ranvonu0artoifcoo1omteaues t0 2umim oodll nmivsls) Duax p;o1tleniocilslm2ra(vp;t) rtnio iotoateanvs;(0 rtr(r3ou4ame lneiat  rrrxr oo1tlen iciadlsDrm( s;(0areomfcoydfateluesls srxo(rpou4llt  nvtlt)srrr(  nt1tptnmoctasfm2emuvonu4aeenxo3totlate ueo;s0trxrxo3iu4op elncsl(f Drrxrpou1aeto ieiatfs ranmonu0altnxo3tytfaD  i i;(0t2umio oo4om n nvsltfarra( pnt1apeniietatls rl(vs u4 lenif3oydfm e uvils) 2xriopnu1amtelnvs (fs2rm( oou1apx mfeiys a rl(ms (4trtnxf3to1omDrlues t s2tr(opou4apeelfvtltfsrtrump;t0texnmfctydls raumsnu4 rtomf oytfa eliei ()s2tr(r iydlmeelfvilsf 2trxm ;o1tpt mo3ilt mDrmnvo;(4arerir3iydfm eaiesls0 2uo(o3nu1apee iesltfa2tmumpot4oleo ietltfs um(mo u0trtomr oadfa e u sls trur(o nydllt livilt  Dtr(m nt0oltoiociytla emu o t) rtomf oydoa  au i t)sexmxo3nu4alte ivtl( arum(  oo1tle if3tytfsDuanvonu4tltrxr iadfmtrauvils  ruo(o3oy4am nmfvt s) 2umxrooo1oex  ociad mDrlnvsn(0 lxrxf iadlatean o s0 rxm(m3iu4amtnlivsl()srum( p;u1olxoiictld m um(vp;() exoif oatfpDe n o;()trto(mpny4apt  fes sf 2rmxmono1tpeoifciasfm umn p (4trxoxf3todlm   neo s) rxoxr3no4lm elfcsa(f 2trum ot1opt ioeiydfa2rmuvp;()aeenxfcta1oat lnvsls0texr(mpiu1op  lfei ( aDrr(mpno1apx iictat sDua(mo;(0tlxrirciatoa ranei;s) etr(m iu1apt  ivt t sDrrxr nu1aetomo3iadfsDrluvs;u)trtoxf iytfmtraivi;s0srxoxmpoydllenlnvt sfa2rrx o;o0tetnmfctatfm ulnmsnu0texrmo oo1oatr ies t0s2tmxrpno1opeemietl()aDum( pot0aexomfciyt m2emumo;u0 ltrxfcoydlm  auvs;s) rxo(m3iydapt mnvt s  rurxrp;u1opxnifeiasfs rlnvo (4tltrmrciy1fateluvo;(  exmio iy4lmtn nctatf 2uaur ;u1tpxnmoetad m uln pnu0 rxnxfcoy1lpDelu s s)srtm(o iu1openmictlt artaur ou1teenifctat a elnmont) exnmr3tydlaDr i olt teurir3io1lmt livtat  Dum(r ot0tpeomoeiasfmDran o t4 reoxr3oydlpteai ols)s2umio no1optn ivt sf 2rrum ;u1tltn oeiysfsDran s;u) rxomo ty1opD lnvo;t0truoxrpnu1apt lfcsasfsDtmxr nt0alen octydfsDrl(msn(0 ltoif tydfmtr ues t trtrim io4omee fvslsf 2uaxmo;t4apxomoetasls eanvp (0trenxr ia1laDe uvs;( seuo(rpiodlpeelieia()a2raxr ;o1aptoioetytlm ulu pnu)trtnmr3ta1faDe n il()srtoxr3nodap  lnviat)aDtm(rp;o1ole mfctydla um( on()tlermo3iatfpt au ils0 rxoxr3nu4opt lfesatfsrrrur ;u1opxnmfeiatlsDemn snu) exoir tytla e n i (  eur(rpno4al e ictas)arrmurpot4altnmieildls rau snu4arxoxf totlaDelivi;()texoirpoydlmtnlfctlsfsrtax pnu0aexnmieiysfmDum( s ()areoxo3oy1opt aivi s  rurim3ny1am  mics sfa2uaum ;o4altnifetadfs2eauvs;t4aetrxrcoytla rlueolt)teumxr no4lmt  nctl() rtaumo;u0tltn feiadls raumo (0texrxf ootlaDelivi;t)t2urxo3io1alenmncsa( a2ta(ro;t1olxniociyd s ean ont)aleoif ta1lpDeaivs t) etrxrpiu4lpenlivt t  rtaumo;o0aeeniocilt s2el(vonu)alerxo tydlm eln olt) exoim3iy1open fesa( a2tau  no0tpe  f3iydfm ua(vp (0trxnif3tatopt luvolt)srtmxo3iydaltemnvs s  2tmurpot0tlxnio3iytlm umu snu4 etnircty1fm eli o;t0seum(o iu1lleemnvtatfa2ra(ront1optniieiad sDuan s (4alxoifcty1fa e ivo (0trxmxo ou1lp elfvi t a2taxr nt0tee iictas s2ulu o;t4alxoif3iotfat lnvs s trurxr oudlpt lieta() 2taurpoo1apxoiieiyd s2rluvp;u4 reomfciadfa rluvsls0s2ur(m iodole lfetl( a2rr(mpoo1olx  o3iydlaDelnmo;(0aeenmr iodfatran o;(0sexr(m3nu4amtn ietl( s2tmumoot1tpenmi3ias a eau s;u)alenxr3oa1fpt liei t0s2tmxo3iydope lfvt sf rta(m ot4oetomieils m rl( s t4 etrxrctatomD aivolt  etmir3oydole mnviasfa2tm(  ou4apeomicilsls uluvp;t0tetnxf3ootlpDelueo s  rumxo ou1opt lfvia()sDumxmoot1tpx iiciat s2em( p u) ltrxo3io1omte u i ( trur(mpnu1lp  lfcs tf 2tmu  nt0oexo f3iytlaDemuvo;(0trtoircoy1omDeliei;t trxrxo3iy1ol emfct tf 2tmuront4tpto o3ils a ua(mpnu4tltrif3tytomtelneils0 exoxrpoodapte fvt s)srrrxrp;t4tpt mictadfs2ul( onu4aetoir to1la  ln sls) rurxr oudom   iviat)sDua(  ou1tlt if3iytlm emn s (0altoiociadlpD  nvslt)sexm(m oo4olt lnct t) rur( oou4tlenifetas aDum(mp t4tlxrxo oydfaDrluvol() 2uoim3oydlmtemfei t)arur(rpnu0tpt mietydfaDelnvsn(4tlenif tadlpteanvs () eumio iy4amee ivsa(f Dum(r ;u4tee moetltfm2eanmp u0trxnmo iotfmt aueo ( tetmimpiu1optemietl(fs2rmx pou4opx mfeiyd m um( snt4alenmfciodomte n s t)sruoxm nodamenmivta(f rtaxmono0tleoifciydla2umuvo (4aexnir ia1lp rluei s)srxrxo3oo4lp n nes sfs2ua( pnu1tlt  i3iatls rau s u)alxrmo iodfat lnesls0s2trim3nydlp elfvtl() 2raum no1ole  i3iyd m rmu p u4trtniociydfpDeluvo;t0trtoiopio1ap emnvi tf rrr(ronu0tlenif3tyt m emumsnu0trtrir ta1fpDranei;( tetrim iu4ap elfvt tfsrur(m ou0tlen feiatfs rmuvs u)trxniocoadlm r iesl(0trxr(r3oy4apenmnvtltf Dumx pot0oexniocils s2emuvp;t0alxoir3iy1lpD  ivo;(  rto(mpiudal n iviat)aDurur ou1ale  feilsla uaumo;u)trenir3ty1opDraues t)trxm(m no1lm  mnei (fsrra( p;u4alx  i3iys s ulnvsnu)aeerifctytoaD  ies (0 2xr(m3no4ome  fet sfa2uru o;o0tet ii3tysfm ulnmsnt) rxoxr3oatla e ueolt texr(mpoy1op  lnctlsf 2ur(  ;u4aee ifetydlm2emumo;(0artrio oy1lp rlu s;(0texrxr iu1al elfvs t) rum(mooo1tpenmo3iat sDelums;t4tetnxr3iy1la rlnes ()srxr(m3oydapt mictl()srrmuronu1oetnmociyslm2ul(vsnt4trerircoadomt lneo;(  2xr(m nu4amtnmieias  rtau pnt1tpeo f3iat s2ea(ms (0trtriocoatoatelueil( trxoxo3iu1oleemneiat  rurum ;u4aexoio3tlsfa ul(vp u4tetnmocoo1fm e ivol(0 2um(r3oudam emnei sfsrra(  ;t0tltnmo3iysfaDemnmo () rxrxr oodlpDe n s s0 etmim ou4amtemnvi sf rtaxmono1apx ifctlsfm el(mp;(0arxomf ootfa e i i;t)trxoxm ou1ap  lnvsls sruaxmpnu0tlt ifctaslm2eauvpn()aeerxf iatfa rlueils tetrxopoo1op e ictlt srtmx oou4opt mocils a2rmu pnt) exomfcoa1faD  nvo;()t2xr(r3oodopte ncsl(fsDrmxro;o0tpx mfciyslm rmu onu4 lxomoctotlaDe neilt)seuo(opiy1olen nct tfsDrax  ot4optn o3ildfm2ul( o u) exomr3iatop  an o t) etmxr3no1lm  lictlt srtr(rono4aee moctls m eanmsnt0alenmf3tydfaDe u olt)srxr(opiodame lnvtl(f Dua(r nt0tlx moeilsfsDelu p;u4teeomocootfmDrauvi () 2xm(m iydopee fctas  2rm(mo;u4olxn ietldls um(monu0trtomo io1la rliei;s0t2ur(r3ou1lme  nvta(fsDrmurpot0tetomoctyt aDra(mpn() rxoxo3iodla r nvs;(  eurio3nodap e ictasf Dua(mpot4apx io3iydfsDumu pn(4tltnmr3todfmDe ivo s teto(o oodap n fes t sDtr(mono4tet iiciasfsDem(mont4aexoxf3ta1om   neils  rur(rpnydlmtelfvtlt a2tr(mp;o0aeto i3iadfs2ulnmpnt0 rxnxr oydfmDrauvs;s  eumxo no4llt miet (fs2um(mo;o0tlxn oeiysfm2rlu ont)aetnxf3iodlmDelnei (0 exr(mpiu4apt mnvi t) rraumoou0alx moeiyt sDua( onu)tltnif3tydfmDrli o (0s2xr(m iu4lp nlnct ( s2ta(ro;u1alxomietlsls2elnvs;u)trxnxr oa1omte uvils0s2ur(rpnudome  fvi ()s2urxmp;u1opeo oetasls eln o ()teenmo iydoptelnvo s)trtmio3iu4op n fcsls s2trumpno1opt ioctltfsDemumpn(4 lxrmf3iytopDr n ols)srxo(opnodoptemncia( a2uaxmo;t4ole mietadls ulumsn(0 ltnmr3tytomDeaieo ( srtm(r3iydlltn nvtls s2uaump;u0oltomfciydla2ul(vonu0altnmoctadoaDrluvs (0s2trir3ny1ome mnvtls) 2um(  ;u0apxnioeilsls ulnvp;t)tlenmo oadlateai sl(0 ruoio3no1lltelivs sf rrr(rono4oeeo oeiydfsDrlumpnu) lenmociatlpte i ilt seumirpio4altnlnvil(f Durx o;u0apxn oeiysls2uanmon(4tltnxrcio1lpt  uvo;s trurxo3ou4aptnmneta(faDrmx oot1aetnifeiadfsDrlumpnu)arxnmf3iydlmDrauvil() exoxo3nydlle mfeslt s2urxr ;t1alxoiicildlm rln p;t4texoif3to1lmt livo s teum(m3oydaltnlfciasfsDrax o;o0apx  fcilsfm2rm(msnu0alenxfciotfpDelneo;s trtmxopny4alte nvi s  2tr(  ;o0teeomoctltfmDrm( pnt)tlxnif3totlatrau s;t)t2tmio ny1amen fci t arur(mooo1ope mociydfa2emu p;u)trxrmf3tydlaDr ueo;( tetm(r3iodaltnlfesls sDrrumooo4altnmf3tatfmDraump;u4tetnif3io1laDe u sls)sexmir3nu1lpe  ict tf 2umxmpot1olen ociyd s2ra(von(4trermr ootoaDeaivs t srxoio nudol emfetatf 2uaxmooo4tptnifeiasfs umnmo u4 exoxf iatlp  auesl(0srumio oo1apen ieils)srrr(rp;u4optomieiyslmDeanvp u) ltrxr3oadlmD ln ilt0 rxmim3nu4lpe  fvtat) rtaxm no4tltomfeiad sDelnmsnu0areoifctadoateluvo t)s2xmxm3io1am elnei tfsruaxm nt0alen ieiydlm2ra( pn(0 ltnmf3iy1opDe nesls s2tmimpou1omte icilt)a2tax ont1tpxoifctyt m umnvon(0arxrmocoytopDe u i;s)setrxopno1omeelnviltf Dtrumont1opxo fctadla2umnmpnt0 rxrmrctadlp  ln i;t) 2tm(o3ou1altelict (fs2tau o;o4tptomietldlmDrln pn(0artoxr totlm r ivol(0 2tr(r3nu4lmte ictlt sDururpnu1oltnmfeiys aDumu s;u4trxrifcootfaDe ivo s0trxmxo ny1apeemfcilt sDuaurono1oet iiciys mDrmnvo;u0aexoxfciytomDrlnvo s) 2uo(r3ny4lltelfvs (f rrm(m nt4aeen oeiydla uluvp;t0 rtoir 
\ No newline at end of file
@@ -0,0 +1 @@
+ivo;s seurxm nudlme mfctl(f rta(r ;t4oex moeilsfa2ul( ont4 exoxf3iydlpDr nvi;t)srtr(m oodlp   fctl(faruaur nt4olt mfeilt m rl( o t4 renxociytla rluvslt)truo(rpiy1oltelivtas)aDur(moot0teeoio3iasfm rlnvo (4artrxrcoo1lmDraieo s0trtrimpiu4llte ict s)sDrm(rpno1olxnmieiytfs raumsnt0tlxnxrcoo1la   u o;( t2umxmpny1oltelnvs s artmurpnt0oex mf3ilslsDranms;u0 ltnmo iotop eau ol(0trurxrpoudlp  lfes (f rraxro;t0tptomf3iys a el( sn(0 reoif ia1fp  anvi;t trur(m3oy4op nmivslsfarumxmpot0olxoifctyt aDrmnmont)alxnxrcto1lat ln o;s tetm(m iy4omee ivtls srurxrpot4alxo fcild a2um(mp t0tleoxocoydomtraneo;s s2tr(m iy1lp n fcs t s2uaxrp;o0tpxn iciys m rmn o t)aeenmr iydopDraivo;s srum(o nu4olen iciatfs2rax  oo4tlenmociltfa2rmnmsnt) renmr3iydlm rln s;s  2tr(mpny4ol n ivsl()aDtmxmpno4tlt mf3iatlm2emnvo u4tetomo3oa1op eau i s)trxrxo oudamtn fetlt  2rm(moot4oltoiieiltls ranvo;t4 leriociydfmDeai o;(0tetrio nydlpe  fcsat aDrmur nu4olt mfetaslm ul( ont0 rxoxrcoatlat  ueo;( t2to(r3iodlp  livi tf 2urxmono4aeeo oeiatfsDulnvo u4tltrxrcoatlpD an s t0texoxr io1omtnmivtlt  Dra(  oo4alx if3ildfm2rlu snt0altrirctydlm e i slt trumir iodll n nvi t srur(ront4tpxnmi3ild m um( o u) reomfctodoatranvi;(0seto(r nudom nmneils)aruau p;u0apeo o3iltfm ul(vo t4teenircty1fmtraivilt) 2xoimpoydll emneil(farum(mpno1altomi3iadla raump;(0tlxoio ty1faDrln o () exoxm3io1amte fviasfaDrmx oot4ole ifcildfm2eanvo t0trxrxo3tydfa  ln i;() ruo(m3nodap emieia() 2taxm ;o0apt moctad a2rmumo;t4artnircio1fpDelu sls0s2xoxrpoudlp nmiet s  2rr(roou1tlt mfciytfa2ua(vs;u4arxrirciotfaD  n il()tetrxmpnydomt mnvta(  2ta( pnt0tlenmo3ils aDulu p;t4 reomociydomtran ol()t2xmio3oydopeemfviat)aDtrumpoo1apxoiicils sDranmp (0alxnio iytfpt  uvils0 etr(opny4apte iciltf 2ua(  nu1opx io3ild aDeauvs t0trxrmo ootoa  auvs;t0 eurio3no1lleemfcia( arumu pno1tle ifeiad mDuluvo;t0 lxrxo oatfmteluvolt)trumxm nydlp nlfvsa(  Dtaxr nt0aexoio3iad m uau p u0 ltoif iodlm r uei t texoxo3iudlmt lneslsfsDrm(mpou0tet ii3tltfa em(vp;t0alxnmr iytfmteai il(0 etmir3no1amt  netat  rrr(m ;o4tpxn o3tasla eanvo u)arerif oydfa  ln olt) euoio3oydolen iet ( aDtm( p;u1openmoctas m2umnvo;u4arxnifcto1fa raieil() 2trxm nudlp nlnei s) rururpoo1olxn ieiysfsDrm( o u0tetnmo3tadlaDeaieo;()truo(r iy1alt  iviatf rrr(rpoo4oex mfeiyd mDulu o;u)tlxnio3oydla  lieil(0srxr(r3oodlm  lnvsatfs2umxro;u1tlt ii3iytfs2ran p;t4trxrio oytlp rauvsls0trxmiopoy4am  micsl() rum(m nu1altoifciyt s um( s;(4trenircoo1lp  lnvsl()trur(o3oydlmte nvi s)arur(mono0apt moetldfmDea( p u4aetnxo tydfm raneol( s2toiopoudoptn fvi tfsDtru oou1olx ii3ild sDua(vpn(4 leoio oydlp ranvi (  rxmirpnydol   iei t  2ua(m nt1tpxo o3tytfaDrmnvo t)texrxr3oydfp r uvsl(0setoio3nydlle mnvsat  ruaumonu1tltn ociytlm rmn s;()tetnxociodla  anei s) eurxr3nudlmtnlfvtls sruax  ;o4altnioctyt aDeaumont4 rxnxr3io1opDeluvi;(0srurxr3oy4aleelict tfaDuax  ;u0optoif3iatlm2ulnms u4 reoxo oytop  livi;t sexriopnudaptelnei ()s2uru ont4tetn o3tydlm ulu p u)alxoio3oa1om rauei;t)s2to(opiu1al  mnciasfsrtr(  ;t4alt  f3iytla2rmn pnu)tetnxrciodfmDr neo;t)tetrxo ny4al nlivi t)arrm(  ;o4olt mfetltfa2eln s;t4arxnmr3to1latrln il()srtmio iodlp nmfesl(  2umumont4aet  feildfs eanmsn(0arenxfciodomtr nvs;t sruo(m oy1om e feilsfaDurxmo;u1olt ifeils m2ea(ms ()alxrxf oy1lmteanei;s0setr(o ou1lmenmfvta(f Drm(m nu4alt mi3iyt m2ua( o;()aeerir3oatfpD  iesl() exm(m3iudaltnlnvt ( a2rrxr ot0olt iictyt a rlnmo (0alxnio3tydfmDeanvs t0setm(rpnodlp nlnvsl(fa2rmum oo0tex mf3iltlsDelums;t4aeeoxocto1fp elnei;() rxmio3oy1alenmivt t s2rrxrp;t0tee ii3iltls2ea(vp u)aeenxfctatlm eaieil()s2uriopny4apte net t artm( ont1aex  i3iytlm2rau p (4tlxomf todlmDranvi;s  rtrxo nu1lm emnvs (fsrtm(  no1texo iciysfs2rlnmonu0tlxrif iadom r i i (0s2umxm3oo1apte ici tf Dua(m ;u1oltn ieiatlaDeluvpnt0aeeomo tadoaD li o;()srxm(rpnu4lleemfciat  2trxr nt0tee mf3iad sDran s (0 eerxfctydfa eanes (  eum(rpnudlp   fct t) rrm(  oo1alxomiciyd a2ranmo;u0artnirctytoa r nvo ( t2tmxm3io4altnlnvsl(fsDrm(ronu1aex ifctlsfmDrm(vo t)aexrxr3tytlat ln i t)seto(m oy1op emnvta()aDum( p;o0tpe mf3ilsls2rl(vp;(4tetnmf oydfa   n s;t tetmirpoo4olt mivtas) Duaurpot0tpen fctytlaDranvonu) rxrifcoydlmt ln s;()trxmxo3iy1am  lnei s)a2tau pot0tltnmo3iad a2ea(vsnu)alxnxo tadlmt li ilt teur(opny1altelnct (farur(r oo1optomfctatlsDuaumo t0 reomo3oy1optraies t  rumxo3ny4lmeelivtas arumur ;u4oexn octys s2raumo;t4 etnmf iotomDrlivo s) exoxmpiu4lle  neilt arrrxrp;t0opt  feils a2em(mo t0tlermfcio1fm ean ilt0 exm(o3iodol e neta(  2rrxm nu4tpeoioeiat mDuanmo (0alxniocio1lmt luvsl(0tetmxmpoodapeelnci ()aDumxmpoo0opxomf3tydfm2rmn o;(0tleoxf tydlatr ivi;t setrxm3ou4amee ncta()sDtmu oot0aex mietlsfm emnvs t)arxoircootfptraues;t  2toio iu1lpt licia()aDtrxrpou0olen ietls s ean onu0tltoiociy1lpteai o;t0srtoxopiy1lltnlfetl(f 2ta( poo4apt  octls sDul(mp;t4trxomf3oodoaDraivi () etr(o no4alt mnvs ( a2trxmo;o1alxoifeiyd a emuvp (0tlxoxocia1lpDelu i;() exr(rpno1ome  ics (f Dtrxrooo0ale  i3iysls rl(vpn(4teenir3tytoaD  n s s)t2toimpiu1lm   nesa( sruau  ;u0texo o3ilslmDemumon()aexoiociodlatelu sls0setrxo nudop n nctat)s2rau oot0tet  oeiyd aDua(vont0 ltrxf oo1fat aivi ( t2tmxo3nu1lm nlivsatfarrau pou1ole  o3tytlmDrl(vo;t0tlxnmr3oatfa   ivslt trtrio nudolte icsls  rtaxm nt1oeeo ieildfa ea(mo u) etnxo oatfp raneil(0 2toio3nydal nmietl()sDtr( o;u1open octls m2um(mo;t4 rtoxr ty1fmD lnvil(0sexo(mpoudalenlfctl(f Drr(rooo0olen ocildls2em( p;t0 leomo3iy1oa  an s s0teur(m no1lmt  fvsat sDumumpot0apxo fctysfm2rau snt) lxrxfcoadfp e n i s) exmirpnydomte icsltfa2umurono0tptomociytfa2ul( o u4texoxr iy1lptrauvo;t0 eto(o ou1ole  ivilt) 2tr(rpno4oex mietytlm rlu o;u0 ltnmo3oadfa eauei ()t2tr(o3nudaltn ici (fsrrrumpoo1olt  f3tys mDuln pn(0 rxrmo3tadfat aivi;s)s2uoimpou1ll  lnvi s aDrr(rpoo4altn iciysls emuvsn(0 etnir to1latelues;t0trxo(mpoodlltelfes t) 2rr( pno4aeenmociytlsDulnms;t4tlxrif3totoat au i;s)srtr(o nu4amt  nctl(fsDtrx ont0tptnii3ilt sDrln s u)aexoxf3tytlat lnes;s)texrio3iu4lptn ictls  Drrxr oo4tpen octyd s rm( onu)trxrif tatoptraieilt sexrio3oudlmtn netlsfa2urxr nt4tpx mociltlaDrlnvs (4 eenxr3oy1om rluvo s) etoxmpou1optemies ()a2raxmpou0tlxniociydls ul(vo u0artnxr3ty1opt anvo s0texr(mpnu1omen iesa( arumu oot1apto iciltfa2elnvp u0arerxr3oytopDrai i;t0s2trxopiu4lltelicils) 2ur(mpoo4ale iietlsla uanmo;t4 rtoxo oy1oaDrai s s)srtmxopiy1ap emnes ( aDururoou1alt ifciyslm ulumont)aleoircia1fm e uvi (0t2uoimpoo1openlieta(f rtm(  ot1tlen oeiltla2rluvsn(0texrxo3iatfpD  ivs;s0 rxm(r3io4optelictatf rrm( o;o0tlx moctadla ean snt4tleomf3tadfa e ueols0sruoxrpno4olt  fvil() Dtr(rono1apto oeils a uln s;u0tlermf tydlaDraieols0srtriopnu4amenmfes s a2rmxro;t0aeeniicilslmDumnvsn()alerxociytopt aueilt  exr(mpny1amt mfcsa(f 2umxmono1tlxnmfetlsfs2ulnms;t0 exoif to1laDr u sls)seurxmpio1lleelnetat)a2rax  ;u1opxnmfeiatla rau ont4 exnmr3iatomteaieols)s2xmxm oy4ol nmfvta() Dra(mp;u0ape ifetydls elnvo t0tlxrir tatop rai o;t0 2xoimpiy1apeelfvtlsfsrurxr ;t4alxoio3ildlaDul(vpnu) eerxr3ty1fmDe i s;() etrxo3iu4omee ncias s2rr( pnt1tltnmfeiasla el( s;(0aexomo3oo1lp eaneo;t0tetm(r oodapen neslsfa2trumpnt0opt mieildfs ea(vpn(0aeerxo3tadopDrlnvo;t)s2tm(r io1aleemnci sfarrm(mpnt1aet  ocild m elumsnt) ltoxo totlm  au il(0s2umirpny1omenmfctasfa2rmxmooo0aee  i3iytfs2raums (0 eerir3iatlm  lnvi t texmir3ny1opte ncslt a2umur nt1olxoifcilslm uanvp u4tltnxo3iy1opD  nvs t  2toiopnydaltn ics sf rrrump;u0aetoifeiasfa ulnvs;t4 lxomf3iadlmt anei;s)setoiopnu4am  mncils)arrax  oo0aeeo f3iadfs2emn pn(4 ltrif ta1fmD lneo (  2uoimpiu1om nmneiat)s2urxronu0apx moctad mDrau pnt4teeriocootlp  liesl() 2xoxo iu4lpenmfeiatfa2trx pou0tlenmoetydfaDea( p;(4 eenxociodfp  lnvi () 2uoxrpny1lm n fei t)s2rm(root0apt mfcild aDuaumo;t)artrxf iotomtelnvi s0texoio ou4lpe lfvtl(  rrmxm ;t4ale ifctatfa2um( p (4aexomr tadlm  auvo s0srto(mpiu1alen fcs s a2rax  ;u4oetnmfeiaslm em( o;t0teerxocia1lmDe neil(0t2tmio3oo1al nlncilt s2rm(r oo0aetoifeiyt m eanms (4trxomrcoodfmD anes t)sexo(mpiydllee fctatf rrrxmono0tpxo ictatfa2elu o;t0artoircoadom eaues s0 2um(o iy1alenlncs ()aDtru onu4tle iociyt sDem(von(0trxnmo3ootoa e u o (  rxr(o3ny1lptn nvt sfsDra(m oo4aptn ieiyslsDua(mpnu0 rxomf tytlmteln i t s2trxrpoodaptnlfvia(fsrur(rp;t1opxo octlt m2ra(mp t4 lxrio3iadomDe nvolt0texrimpiu1alee nvsl( srur(moot1olt if3ils m eauvo;t) ltnioctatlp elnvo;t0trurxmpoydapenlivs tfarrru p;t1apx  feiysfa2ulumo;u0altoirciodomt auei s  2xr(r3nu4ll  liei t aruax  nu0tpeniieiyd m ran p ()teenxfcta1faDr ivsls0srxrxm ny4aptnlneilt) Drmum ou4oex  o3ils s em( p u0aeenxf3iy1fm r i o (0texmir3nodamt  nct ()sDurumpnu1apt iictld m elu o;(4treomo iydla eluvolt) rxmio3oydome mfei t)arra(  ;t4apxoiietysfm rluvsnt4 lerxf3iy1lpt  n o;t0teum(r nu4lmenlfvt ( aDtrxrpnu4aleoif3iatlmDeln s t0tlerif3iodoa eanvs;s0 rtrxopnodamen neia(faDua(m nt4aet iociysla emums u)tlxnio3iotlmDeau i ()seurxo ny4lm emfvs (faDtm(m ;t0oee  fctys a2rln s;t4 rxnio3io1fatelnvol(0 2uo(r nu1ope lies (fartr(mpoo0tet  feiysfmDulnmpnu)arxoxocoo1oa   ieo (  rum(r ny4ap  mfct tfa2um(mpno4aet ioeiad m ul(mo u4 lxoiociatfmtr ivi;() 2trirpnu1op emicil() Drr(mo;o4open o3ilt mDumnmo (4alxrmr iotlp r ivo s0trtm(rpiydap   ncta( aDumu  ;o0aeto ietyslsDulnmo t0aexomocoytfaDraivs (0 2toimpoydomtnmivtasfs2rmxr ;o0oltomi3tys a rmump;t) ltrxfcoy1faD  ivol()sexoio3ou4amee ivslsfarur(mpnt0tpt mfeiad sDum(von() etnxr3tadopDe i olt0s2ur(rpio4lp   icia() Dumxr nt4ope  ieils sDrmn o (0 rxoxo3todopD auvo;(0 rtr(m nu1altelneils)a2tru oot1opt  f3iltla emums;()altoxo3oy1omDeaueo;t teur(r3iy4aptnmivs s aDtruroot4apt mfeiat m2em( snu)tlxomf3oatla elnvs ()trurxm io4ame lnei tfs2rr(moou1tlt if3tydls2uanvo (0 eenmr3oodopD  neo s t2xmxr3iu1open fvsl(f Drrxronu0opeoifeiydla2em( o t0areomf ta1la eanes;t0t2xm(rpiodamenmfct ()sDraxrpno1opt mieiydfsDrm(vsn(0 rxnifctadfaD aivi;s)s2xm(o io1ope lnviasf 2rrurpno1apt micildfs2rm( on()tlxomo iotfm ranei t) 2xm(opou4al nlfci s)a2urxmpnt1aet io3iys s el(vp;u0tlxnxr3oo1lmteau il(0 2umxopnydlpenlivi t) 2rau p;u0aptnmf3ild mDraump ()aetoxrcia1fp  lueilt0s2umio io1lpen nvi tfarrmxmpnu1oltn i3iasfaDra( s;u4artrmo3oa1fmtraies;t0 exrxmpiy4amenlfei sf Drm(m ;t1ale  o3iysfm raumo;u)trtrmfcio1omtr uvs;s0s2trim3no4ame mieilsfaDra(mpot1olxomieilsfs2uan on()aetoirctadfa r ivi;()trxrxmpio1lme mncilsf Dumxm ou1apx  feilsls2uln p;u0arxnmr ty1omtr i i (  2to(m3oo4olt lncs t srrrx  nu0tpen ociysfm uau sn(4 exrif3oytopDr nvi;t) 2um(r3ou1oltnlnct tfsrtaur ou0oltoifeiysls rl(mo t4texrio3tatopt lieo;() etmxo iudomtn netl(  rrrxm oo1tlen fctytls ul(vs;t4arxoif oytla eauvo;s0 rum(o nu4lpt  ncta(fa2um(rooo1aetoiieilt m rmnvo u0 ltrmf3ootlptran i (0texr(opiudlptnlfvtl( sDtmu onu4altn ietlt m emuvs u)alermr3iodlm r ieilt tetm(r oo1oltemicsa() 2um(ro;t4tlen ieilsfa2eauvsnt) etnif3tytlm elnvsls0seum(o nu4lmtelfeilsfa2urxrpnt1tlxoifciytlsDemnmont4altrmo io1la elivs;t  2xr(r3oydol emfcslt)aDtmumont0apt  feiatfmDel(mo t0trerir3totfat luvi t0srurir3oydolenlivtat  2rm(mono0tpenmociatlm2uauvont4aexoif3to1lmtrlu o t0trur(r3iudome mnciatf 2um(m nt0olenmfetyt sDua(mp u)teeoxocty1oaD li s;()seto(r3iy1lltnmfci (fa2rauront1tptnmf3tlt s2uluvp;t4tetnir oodfm e n s;s  etrir oudalenmivt (f rum( oou1apx mieiltls2el( p;t4artomo totfpt aieo;() exoio3oy4omte nesl()aruaxro;o4ape if3tad a emuvo u0aexnif3iatfpDrlnvs;s0srtoxo3iu4lpeelnvsas aDua( pou1opt  f3ilsfm2ulu pn(4trenxf tytfpDrlivs t t2to(r oo4ame  netltfsrrrurp;u0alenifciasfaDumump t4 eenifcty1lp   u il( texoimpio4ll e nvia( artr(mpnu1opx ioeildfsDeluvpn()alerxrcio1faDrau i s tetr(o3iodop   icsat s2uau pou1tptomociydfm2el(mo t) lxnir3iy1la  anvs s0sexoio oodol  mneslsfarumxmo;o4apx moetytlaDea( p (4artoxr3iadlatraies t0tetoim ou4al n ncilt a2uau pno1apxn feiltfm um(ms u4 renmr3iatlmt  uei t) 2uoio3oodop  livi tf Drr( pnu4opx ioeiysfsDea( pn()trxnif iydfaDranvi t0 etm(r oodllt  fesa()s2tm(mpoo4oeeomo3iytfsDumuvp u0 rtomr3tatop  lneo (0trum(o nodolte netas)sDtru p;o0oex ioctytfa rmumsnt0arxrmf tydfp  aivo t trtmir3iy1amte fvtat a2rrum ou1teeomf3iytfmDrlums;u4altnxfciadlaDr n s t setr(m3oodole livtasf Dum( p;o1olenif3ild m2rmnvs t0artomo3iydlm  li i;(0 rumio3oo4op elivtlsfarrmuront1tex ifeiltfm ul( p (0aexrxf iotlp raueol(  etm(mpnu4omee fvi t  2raxrpou0teeoii3ilt mDulnvo;t)treoifciotoa   i o;s) rxo(o3io1ll   netl()artrum nu1aeeomi3iasls rmnmpn()tltoiociadomDe ieo (0s2toxm no1lmtelfetlsfaDtax p;t0apxnioeiltlaDel(vs t4 rtoxo oydfmD ln o s trxoio3ny1optelfei s aDtm(  ;o0apeomietyd mDranvs (4 rxnir3iy1om eaivs t  etm(mpnydap nmfet t) 2rmump;u0alt  ocilsfs2rl(vs;(4tetnxrctadop ranvol(  exmim iy1lmeemiet s) 2ur(moot4oex iociatla2emumpn(0alxomocio1fa r n o t0trxr(opno4ol  mfct t aDur(r nt0tet  ieils s2umumpn(4 rxrmr3iadfptrauei s)srto(r no1ol n nei s) Drr(  ;t1aeenifciadls2ul( pnu0tleniocoatfp r u s;()tetmimpnudlptnmneta(f 2umxmp;t1apenifctyt a2emnmon(4aexnmf oytfpt aieo;s s2tmxm iy4op nlfvsas)sDuax  ;t1alxomoctyt aDea(vo t) rtomo ia1om e neslt teuriopnu1apt  ivsltfs2umumpnt1aeeomfctlslaDeauvp t)artnir3io1la raiei;t  2tr(o3iu1om   nvtlt)sDrm(mo;u1tpto oeiys aDuaumsnu4aexnxocty1fptranvo t  2xo(r oy4ape  fvilsf 2rru p;o4apx iicilt m ea( pnt0alxnif oytla r iei s)s2tm(m3oudomeemfvtlt)a2trum ot4aeeniieiatla2umu on(4altrio3oatlmDr nvolt0 2ur(r3ou4op e icsat)aDta( o;t4alxoioctyd a uanmp ()aetnifciadfmt lu s;( sexo(r ny4omeelfct t  Drm(mpot4tpt mfeiyt m2ranvo;u)trerxf3to1faDrlnvi t0 rxoxrpiu1lme micsas)a2ur(mooo1oex mfciltfaDumuvont) renir3oadopDrlu s s t2xo(m iudop  lnvt t  2ra( pnt0apxn f3iatfa rlnvpnt0artoio ta1opDr nvs ( srxmxopoo4lme mnvtl()a2uax pot4tltnmfeiyslm em(vo t)arxnmr iodomDr nvo;s0t2xmxr3iu4op emfetas  Drruroou4apxomi3iltfa uaumo;t4arxomocoa1lpDraivols)t2xmxm3iodlpe mfcta() 2rr(rpou0opxnio3ild s2elnvp;t) eerircoodomtr ivi;t t2xo(rpiydlmee ivia( aDraxr oo0aptn fciytfm2ea(mont0trxrxocio1oa eluesl() 2urxm3iy1omeemnet ()srraur no4alxniieiytlsDeanvpnu4artomo3iadfate n olt tetm(r3oy1altnlfvtlt)sDururoot4aleo ieild aDranms t0tlxoiociotlaDean olt0truoio3ny1apeemnvtls aDrm(rp;o0opxnifciyd sDranmp (0altoio3iytfaDe uvs t)texrirpoy1ameelfcs tfaDumxrp;t1texniietatfmDeanmo;(4 rxrxf iydom r ieo;s texoxm3no1llen fci s) rur(mpno4opxo iciydfm2eauvs;()tltnmo3ty1fateaivo;(0 rto(opnu4lmtemiesatfs2uaump;o0alto ictlsfm2ran pnu0trxrif3ta1fmt auvi t  rto(r3oo1aptelfvil() Dta(m nu1teto ietyd mDemnmonu)trtomr oa1lmDeauvo s  rxoxm iy4ole lfeilt  rrrxroot0tpt ioeiysfm2em(vonu) rerxfctydlaDrlu i s0 euoxm3nu4lpe mneiat)a2rmu  ot4aet ioetat a emnmonu)trerirctodlat ln i;s0s2uoxo3oudom emfvs () 2rmxmpnt1tleo f3ildfa rlums;t4tlxnmoctatfmtelueo;t t2urxr3iu4amte fcs ( aDrmumont0alto ocilsfa2rl( s u4tlxnio iatfp  ai ils0t2uoxm oydol  mnvsltfa2rrx  no4aeen oeiltls rmuvp (0 etrio iodoptrluvs;( trtoxm no4lmtnlics () Drrur oo1oexo f3iyslmDulnmpnu)trxoif oy1lptraivilt) exmimpio4om emieslsfs2tr( oot1oee  ieiasfaDelu p u4 lerircty1omDrlivil(  2um(o iy1ale  nctltfarrmu ono1oet if3iatfa rlnms;t0artoio iydlpDraueil( teuoir3io1amenlietl()s2ta(  nu1oltoii3tatfsDranms t)tltoirciytfaDean slt)tetrim3iy4lmtelict s arua( pno4olto o3iltls umnvpn(0tlxrmfcoadlpDeli s;t) ruoxo oy4op nmnet () 2tau  nt1tlt  i3tls a2eln o;u0altnmr tadlmD li s s0 2umxrpnu1llenmnviatf Draurpot4tltnif3tld aDum(vsn()aetnxfcty1fmDr nvs s t2xoio3iu1lp nlivsas srum(monu1ale  oetytlm2rmu s;t4 leoio3iadopDr u s t) 2ur(mpou1optelfcs tfsDuru oou0teeoif3tatlm em( p u) reniocio1la eai s t  2xr(r3ou4lle lnctl(  2urxmooo4apx  feiatfm2elu snt4 exnmf tatfpDraneilt0t2toxm nodlmt mict ( srrmxmpot1tptnmociatfsDemnmsn() eerxr3oatomteaivsls)srtoir iydlle lnvt t)a2rr( pot0tex  feiydls eanvpnu0tlxrxfcoydom elneo;t  etr(mpno1lpe mfetltfartmu  nt0tpe ii3tls mDraums;u) rtoxrciotfa raues t0 rxrio3iu1alenlicsasf Drmumpot0olt mi3iys m2ra( pnt)trxnmocio1fmt  n s t t2ur(rpoodol elfciat  rrmur no1olenmfeiatla2el( p;()tetnxfcoatfmDran sl()s2xrxo3no4amtnmics tfsDrr( p;u0oex iocilsfm2rau sn() eermfciydlp e u s t) 2tmxm3iu1om nmfcta(fsrumxmpou1altnio3tldfa2eanvpnt)aeeoxr oy1lmte nvo ()srtoxrpiu4op elfvsltf Dtrxr ;u4optnioetasfm2uauvs;t4tltomfcoy1omDraiei ()t2trim iudlmt  fesa()a2uru  ;u1aex mi3iydfa rmnvp u0 renir iatlmDr neo s0teuoxrpoo1olenlfesas)artmxm ;u0olto o3iatlaDem(mpnt)tetoxrciadfm r nvo;t0s2um(mpoy4altn neil()aDumxrpot4tpto o3iat m2eanvon(4 ltnmfcty1om eaiei;s)srtr(o nu4lmtemncs (  Dtaumooo4tex  i3ilslm elnvp t) rermrcootfatranvs;t)s2xm(r ny4apenmfcsatfartmu  ;t0opx mi3tas m2ranvp;u0 rtnmo3oatfateanes t  2trxm3nu1amenlfcs s)srur(m no1oetniiciytlm2rmnvsnt)trxnmfcto1lm  anvs;() 2to(opoudop nmnet (f rtrum no4alx io3tydfmDumuvs;u)tltomo3ty1lat  iei;t setmxm nydlmee fei ( sDtr(mooo1ale mi3iadla ulnms;u)artrif3iytfpDelies;t)trxr(m nu4ol  mici (faDum(mo;t1oeeo ociat a2rmuvo;(4texnmf oy1op raivo t t2urxmpnudlm n ieia(fsDtmxm oo4oltnmietltfs2rauvont0tlermr tatom ean s s0srur(r no1lle mivtlsfartrum oo1texn feils s2rmn s t4texoxf3ia1lm eauvi;s) 2urxrpiudame mietltfaDrauro;o1oetoiictadla ranmo;u)aeeoirctotlm rau ils) exr(r ou4lme  fctas sDrmx poo1opeomieiys m rmn p (0arxrmo3tydfpt auvolt  2uo(m3iy4apeemfvil(  rrrxrp;t4apxnio3iltls uau ont)aetomr3iy1lm  aivs;t)trtrir iu1ape mfesls)sDur(mpno4tpenmoctad mDeauvs;t0trtnio iatoaD auvi s) rxrir no4alt livsa(fsrraxroou0ope iietytfaDrmuvon(0 renxfctotfp r neols)t2uoimpoydaptelnvs (fartmxr ;u1tet mieild m2em(ms t0alxrmr3oadlatr ieo s)srxrxo3iudoleeliet t s2umumonu4tpto f3iltla uanmo;t4artrxf iodoaDranvilt0s2xoxm3ou1ap nlfeiltf Drmum ot0texomieiltlsDeau o;u4 leoxr3oadlm  ln ol( sruoxr nu4alenlicia(  Dumx ooo4tpe  fciydfm um(mp ()aeermf to1omD luvols)srto(m oo1aptnlnvt sfarur( pnu0tlt  o3iad a2uauvs;()arxoxrciatfp ean o t)teuoio3oodameelnci sfs2urxmooo4oleoii3ilt a uanms;()teenxr tytom e uvs t)trur(mpnu1ol elnetas a2um( pnu0aeto iciyt s2elnmo;u4aetoxocoadlmt ai s;(0 rxm(mpoodlpeelfeil(  2ua(ront0apx  oeiys m2rm(ms;u) rtnxocia1lmtrlies;s) rtmxo oy4ap  mictlt)srrmx p;u4aetnioctyt mDrmn o ()tltnmf oo1fp  ai o s trtm(m oy1amtnliesas)a2tr(mpno4opxniieilslaDrlu s u0artrif3tatfpDeau ol(0sruo(o3no1ale  ncslt sDum(m ot0apx mi3ildla2eln on(0 rtrmf oy1fpDrlneilt t2urxr iu4ll   fctat  rta( o;u1tpt  feiad m2emump;t)aeenio3todlpteaueilt)s2xrir oudalenlnvi t aDtmur nt0oeeomieias s eluvonu) rxoxr3oo1lm raivol() rxrirpiy4llte ivtl(  rtr(mpou4olxnmf3iasfa2uln p;t0artomo3oytlmt  ivi;s) rumir iydolen fct ( arrru onu1aee mfciltlaDeanmo u)tleoxr totfaD au i t0 eurxm3ou1alt lfetl()aDrmxrp;t0tltnmoeiat s2em(ms;(4 exnxo tytlptrai ol()srur(mpiudlpenlfci ()srtmurono1altomfetyd aDrl(ms u4trxnmo oydlaDr uvsls)s2xo(mpiudomen feta(fs2ra( pno4ole iociytfsDelu ont0 leomrciytopDe i s t)trxrir3iydomtnlictl() Dta(rono1alxomf3tld s2eanmp t)trenmocty1fmD  uvolt s2to(o3oy4om nlnvtat  Dtmxronu4altn ietydlm uan snt)trenmr oadlp eanvols)s2uo(r3oudamenmiei ( srurum oo4tptn feilt s2rauvon(0alenxf oo1fm  li i;(0 euoxr3oydll  licsa(  rraxmpnt1alx  ieild a uanvo;()arermr3oa1lptranvo;(  exr(mpoy1am elictlt)arurx pnt1oeeoifctydfm ranms (4tltnxrcty1fmD  u o (  2tmio3iu1am emfcs s) 2ua(  ;u0opt ifciydls umnvs (4aleoircia1omDeanei (0teumiopiu1ome lnesa(faDta(rpoo0oetnmfeiydlm2rmuvo;(4arxrif3oy1faDr neils0srtr(o iu1ll e ivsa(fs2umuront1alxnii3iys a2ul(msnt) etnmr3iydlpDraieol(0 exrio3iudlmenmfci s)a2ur(rpnt4open i3iadlaDuauvs;u4tlenircio1fmt  ivils0seum(r3iydlpe  nctlt) rtr( poo4tle ifctlsfmDrmu o (4treomf oadfa eluvs;s) 2urir3nodoptnlnei (  rurumpnu4apxo octytla2umuvsnu) ltnxo3oydoatrli sl()s2tm(mpoydomtnmivs s artr( p;t1olx  fciltfs2umnvp t4 exrxocoy1oatr u ols  eumimpnu1opeemicsas a2uaurp;u4oeeoifeiydls elnvo;() exnmo3oydfptelueo;s)sruoio ny1lmee nvsat) 2rrx onu4olx if3iysfs2uanmsn()teerxo3totfpteau s s0srxmio oudamtnmics (fa2ur(rp;t0tpx mietld s2ulumsn(4arerxr3iydfatrlivs;( trxmxrpiu1lm   fvsl(fsrrmx  nt0oleo fcilsla umnmo;(0 ltrxfcoydlm raivo;t t2trim3oo1altemnviasf rrmxr no0teto octat m rm(vont4arxoxoctadfp eln i t0 etmio3iu1apte ncsls arrmum ;o1tpto fciad s el(vo ()aetrmr oadfmteli s s0sexrxmpoodome mnci t)aDum(mpoo1tee miciydfm rmuvsn(0 lxrio ta1lpDrlieilt)trxoimpnodomeemivtatf 2taxm ;t4apeo octls m rl(mp (0areoxrcoodlpt  uvil() eum(opoudlpeemietltf rur(  ;t0alxnifeiaslmDumu o;()teenmr oatopDr uvils)s2xrxo oudomenmfet tf 2tm(moot1apxnmi3iadfsDemump t)tleoif3tatop  ln s (0tetm(o3oo1amt miesa( artrur oo4aex  f3iatlm2ua(vp;(4aleoiociodlaDeluvsls0truoio nu4omte fcs tf Drmx  nt0optomociat s elnmp t)tlxoir3oo1lpD liei;(0t2xmio3io1omt mnvsl() rrru o;t4olx  o3tydfsDemuvo;(0areomo iodoat  i i;(0srtm(m iudome  nvils)sDurxm ;t0aexn i3iyslm um(vp;(0trtnmf3io1opDeanvi ()texm(m3iy4alt lieslt)sDrmxmo;o1altomfeild m eanmont)texrxr3tadlp  livs t)srxrirpiydlp n nctl(farra(mo;o0tlxo f3iytlaDumu sn()tleoio3iydlaDelivolt0texr(m oodopee iesa( arum(  nt4apt miciasfa2ea(mp;(0 ltoiocoytfpDrli sl(  rxmxm3no4am nlfcsasf rtru ooo4oltn fciltfs2uan p ()trtnmr iytopt luvi t0 2xr(m oodap  mncs ( s2tax oot0tpeo i3tldfs rm( ont4altoxf tadfate uvi t0sexr(r3iy1amtn ici sfs2tmxrpoo0alxo i3iyslm uanvs u)tltrxf oa1oaDrlueilt)setmim3iu4aptemfcsltfsDumxmonu4oee mf3iydlsDrmu sn()aeerxr oadopte nes;(0s2urim3oo4lpe mfes ()aDururpou4aleomiciysfmDeaumo (4aexnio3iatoaDeaiei (0trtmxm ny4ll elfcsls srta(r nt4tltnif3iltlmDeanvp;u4 rerif3oodlmDe nes;s0 eum(r3oy4lp emnetatfsrrmx  nt4ope ioeiatfa2rmumon(0trenxf3oydomD  ieols srtm(r3ou4al e feiat)srrr(mont4apt mf3tatfa2ean on(0 renmf todomteai i s0t2xr(o3oy1ll  livt t)a2uaxr nu0texomfctldfaDemumpn(0aexoiocoo1fa   uvo;( t2uo(r iodomeelnvs t s2rr(rp;u4apeoiictasla2emumon() eeoxo oytfaD au ol(0sruoxopny1olenmfctl(f rur(rpou4oetn ictysls el(mp;u0arxrif oodoa eluei;t trxoxrpou1ll  lnvtat sDrrxmonu1aexnmociyt m2emnvpnt4artrir3oadlmDrliesl()s2umxr oo4ap nmivi s sDum(rpot1oleo f3tyt aDeanmo u4 etnif iytla e uvi t) 2tm(opio4alt mfvi s artm(  ou0apx ifeilslsDrlu sn(4alxomfcoydlpte nei s0srumim ou1ll   nvsatf 2raxrp;o0apx  f3iyt s2uluvpn()alerifcio1laDranei;t trumimpny4ape lnviat)aDumxroou0tltniociaslaDrmnvs;u)texnxocoytoaD lnvol(0s2toxm3nu4omtemfvt t aDuau ooo4texnioeiyd m2ran s (4texnmfcia1fmDelnvs t0srxo(mpoudll  lfei t) Dtru  ot1olen o3ildfa ra(vonu)arenmf3iydfate ies s0s2tm(m3oy1alt  neilt a2raumpou0olxnmf3iyslsDrmuvsnu4 reoif iadfpDrlu s;(0sexrim nudopt lnctas srrmum ou0ale moetlsfm2umn o (4aexnxfciatlpD  ivo ()truo(o oodaptnmietl( sDtru  oo4tee ifeiltfaDulnvp;u) lxnir io1fpDeaneo t srxoxo3io1aleelivt s aDtmurp;t1olxomociyslaDumu p;u)aetnxr oy1oa  luei (0srurxo oo1omtelnvsl(  Dtr(m ;t4optn o3ildfs2el(vsn()texoxr3oatlat liei s trxm(opoy4lltnmnvia( aDua(m ou4tpx  i3iytfs2ea(mo t0arermrcoodoaDe ivols)setoxo ny4am  lfvtls) rtmuronu4aeenmi3iyd a2rmuvs t)trenmociy1opDe n o t0t2trxo3iudape micils) Drrur nu1tle iiciatls2umums;t) rxrio totfaDe u ilt0t2umxo3io1lpeelictls  Dtmxm oo0oex iociltfs eau s;(4 eeomo oydfptrlu ilt0t2urxmpoo1lmt  ies (fsruaxrp;o0aeenmieiyslsDuan p u)trxrmrciotlmtelues;()srumxopoy4lle mncta() Dua(mo;o4optnioetlsfm2ulnvs;u0alxrmrcoo1latranvo;t sexriopoydaptnmneils sDua(rpou1aetnmi3iad m ul( s;t)tetriocoodfmDe neols sexmir3io1alt  fviatf rtr(mpnt1tlt mo3ils sDeanmo;u)arxoxo tydfmD luvo;( trxmxopio1ol  mncslsfsrtmumooo1teeoii3iatfm2ulumpnt0 reoxo oatfm  luvo;s)s2xmim3ou1ll n net s)a2umu p;u4oet iietydls ra( o;()treoircoadla eli ilt texoirpnydlltelncs sfsrrm(mp;u1alxo f3ils aDul(mo u)alerxf3oatfp e nvo () 2umxo3iudole  fet ()sDtmu p;t4oetn ocild a2rauvsn(0tlxrxr3io1lpDeau s;()setoxo ou1olenlfesls)srurxr nu4aeeoifeilt a el(vpnu0tetnxo3iydlmD  u sls teurirpnu4omtemfetatfsDurxro;o1apxoif3ilsfa2el( s t4tlenmrctytoa eai i;(0 eumir oo1oltnlictat  ruaxro;o0tetnifctldls2emnmsnt0tltoxrcootlm  aieols  eumir3oy1al emivil( artrurpnt0aeeo i3ilsfa2umn p t0 lxoxf3io1lp  lnvs t s2tmio iu4al e ictatfs2umu  oo1optnmfciytfm2umumpnu4altnxrcty1optrai o;s0 2xmir oudal elfvi ()arum(  ;o0olto oeiaslsDrlu p u)tetrxocta1fpDeli i;s s2tm(mpno4ole mncsls)sDurumpoo1tetnmiciadlm ra(mp;u) rxomr ty1fp  an olt0setm(m nudlptelneil(fa2ua(ro;u1tltnii3iadfsDrlnmp;u4texoxrciy1lmD aues;s)srxm(r3iy1altemieslt  rra(  ;t4alen f3tas m2elu o;t4tlermo ta1fmt lieil( srtm(mpny4ap emnvta(fartax p;u4tetomfetasls uau s u4aetnir oatfm   n o;t)trtrxo iodap nlnei ( srra(r ;o1olxn f3ias m2uan snt0tetrxf io1fmtrln o s0trtrxo3io4ll emneil(farrmumont0apxnmfeiytfs rlnvon()trxrio3tydoptr n s ( t2triopou4om nlietl(fsDuaxmp;o4ole mfeilsfs2uln sn(0trermo oytomtraueslt tetoir3nodlp n ncs sfaDtr(m ou0tpxo i3ias a2rln p;t)texrio tatfa e i i t t2tmim ny1ome miciasfartau  ;o1tptn ieilsls umumsn(0tlermrciotfmtrli o t  rxo(m nu1optemnvtls srrm(rp;u1alxomfctydlmDul(vs;()altrif3iotfmDe i ils)s2urxm3iudope livsasfarumxmonu4teeomiciat m umuvsnt0altriociodfatrli o;(0tetr(o3iu1oltn iesl( aDtr(mo;o0olxn fetatlsDemnmo;t0aeenmo3totlm eaies t seumxo3no1altnmnciasfa2trxmonu4olxoiiciyt s2rau o;t0alxrxr tytla e n o (0 rtmxmpnydolen ivs tfarumum ;t0ope ifeiad aDrlnvp t)arxrifciodlm e nvsls setm(m3iu4ol  mfcilt a2rmur oo0apx moetydfsDum( ont0trenxr3oo1lmt auvi;( trxmim3nu1lpenlictas s2rauro;u1texo iciydfmDua(vpnu)tltrmfcia1fate u sls0 euoim nu4amtemfvi s) Dtauro;o0apenif3tlt s uanvo u)tetnmo3iodlmDeai s;t)sruoxr3iy1amt mieslt) Drrxmpnt0tetniictydfa2eau s;(0tlerxf3io1lpDrau slt)texmio nu4alt mictlsf rrmxrp;u0tlxnii3tyt mDumnvo;t4alenxr3ty1omDeln slt srxoirpnu4opeelnctl(fsDuaxm nt4aexn feiyd aDemuvsnt)arenmfcoatlp rlu o;s0 2xm(opiy4ap nmnvils srtm(mont1texnifeiydlaDeaumon(4 lenmr iydomDr n i;t)t2xo(o iy1aleelicsasfsrumxmo;o1tlt micildlm2ul(ms (0aetrmf todopDran o t) rurir oodomt mivi tfs2trx  nt4ole mfetldfaDel( snu4alxrxfcty1opt au o ( sruo(r iydlltn icils) rrm(rp;o1apt mo3iatlsDuan p (4artrifcty1lpt auvs;t  etr(m3nu4am nliet ( srraxr ;t4tet  i3iytfmDrluvsnu0 eermfciatfa  lueo s0texoir ny1al nlfet sfa2uaxr oo1tltniociyd mDra( pn(0alxrmrctodfmDr ieo s) exoxmpiy4llee nvsas) rra(m ou1tlxo i3iyd a ra(vo t)artriocty1oa rauei;t0trxm(o3oo4omt livsat)arta(  ;u1olxn ietadfmDrmnvp;t4treoxo3oytopDe ues s  rtmir3nodllenlfvtls)srta(  ot4aetoioeiysfm2raumpnu0 lxnio3oa1om eluvils0s2um(m oo1lptn ivtls arumxrp;u1aetnii3iaslm2ua(vp t4 lxomf iotlateluvslt0t2xmio nodolt mnesl( arurx ono0texoif3iytla rlnmo u0 reoxfctytlp   u il(  euoimpoy4oleemnct (  Draxm oo1apto f3ilsfa2rmums t4 ltnio3oo1om  aiei;s t2uoim3ny1lpte ivi () 2uauroot1tle iociytfm2umuvs;u4 etnxo oydom r uvi t  eurxmpny1lptn fes (farrr(mont4opxn oeildlm2el( on(0tlenio oy1fpt  i il()trtmim ou4am n ncta() rtm( poo4tltnmo3tas m2el( s t) ltnmrcoytfmD lnvolt0seum(opoo4amenlnesa()a2tmxrp;u1tptnifeiytlaDuanmp;u0texomrctodfpt aneo;s0texoir oudapeelnet sfarrm(m nu1tpe ifctat m eaump;(0trtnmoctadfpDraneo t0 2tmxo3nydlp nlfciasfa2rm(  oo1texnmfeiatlm2ranmp;u4tlenxo3tydfpt aueo (0 2um(m iu1al  livsl()s2ta(root1aeeoio3iysls2em( p t)arerio3oytlm r nvilt0 2ur(m nu4omeelnvsl( srrr(r ;o1tltn o3tydfa2ra(mo ()treoxo3iodla ranei ( srumimpno4apenmfvt t) Durxm nu4aee  octydlm2emuvs u0 ltnmf3iytfm  ai sl( t2uo(rpny4amte ietlt)srumxro;o1oex mf3iadlmDeauvon(4 eerxr oadlaDr n s t0 2umxopnu4omtnmnvslsf Dumxmoou1tle  ociltfa2rlnmp;t)tetomf io1fptr u s;(0sexo(o iy4oltnlfeiat arrmxm oo0open octldfaDelumsn()areoifciadoat livil(0teurxr3oo4ll e iciasf Dtm( pnu0tpeoifciyt m2elu s t) leoxr ia1lat aivo;s)trxoirpio4am  mici s)artaum nt4tltoio3ilsla emnvpn(4alxnxfcoodom elneils teuoxrpou1ale mfesa()sDua( pno1teenioeiasls2ea( ont4tetrmr3ta1omte nvo;() rxm(m ny4altnlnes t arurur no0apeo oeilt aDrmuvp (0trxnmocoadom raneslt0trtoxm3oy1omte net sf 2trxm nt0tlen ociydfa2eluvs (4 rtrifcoytlmDeluvs;t seumio3nu1lpe  fvilt)a2umxr ;t1aeeoiiciad m ua(ms u0 etoxr ty1lmD lneo;t0teto(o iodaptemnesls a2taum oo0tptnmfcilslm2em( p;(0trtrxf iodfptelneolt) 2xoxr ou4omenmnvsa()aDtmxrooo4opt ifciydfsDeanvon(0tetnxoctadfatraiei;s s2umimpnudole  fvtl()aDrmxro;u0teeomictatla um( pnt4tlxnxr iy1omDeauei () exrim3nydolt mfvsas a2trurpot1aex  i3iys s2rm(mont0trerxo3todoa  au s;t) 2xo(rpnydomt  iviat) Dtm(monu4tpx micilsfm2um(mo t) rxrmrcoatfaDr ieo;(0 rtmimpnodll n ict (  Dtmx  ou1tlt ii3ilslmDumumo;u)trxoxrctadoaDraueo;s)seuoiopno1alt mnvslt s2ur( ont4texomfcildfs uanmp t4tetnxrciodlptrluvi t0t2tmir3nydamen nvsls  2tm(ro;u4olx  ieilsls2rm(vs t4tltoiocio1lp rli s t0t2uoimpno4ap   neils)srrr(rpot0opeomociasfaDrlu s u4tleomr3ty1op   i s s)truoir3oo4apenliesls srur(mpnt4tet mfciys sDrlu o t4aeerxo3todoptelnes;s0sexoxr ou1lmt lnvtas s2ra( pou0openii3tad s2ra(mo;()altoifciotom elivils)teum(r oudll nmnet sf Dtrx o;u1tptnmoeiyd a2rl( o t0 exnxf iydfpDr nvslt srtmxr3io1ll emneiat aDum(r ot0tpxnioetyslm rl(monu) lxomf ta1lpt auvolt0t2uoirpoodlmenlnes s)srrmumpnt0tpt mf3taslm elump;u4arerxoctotlm e ivilt)srum(r oo4omenmivtls sDrr(mo;t4oltoifciatfm ea( s t)arxnio3iotoa r uei;()trxo(r3oy4ameelfctat)s2urxm nt4alt ifeiad m2uaums (4 leoxfcio1fmt  ues t0 rtm(opou1ape  iesas)srtauroou4tptoio3ild m2ulnmp t)aexrmf3oo1opD anvsls texo(rpou1lmenlnvs ()s2rrum ;u1olx  oetyt s2em(monu) rtrmr3oo1fmD  ies (0 2xo(r3ou1lmen ivs s a2ur(  nt1oex moetatfmDran s t)aexrxo tadlat  u s (0srtmxr nodllt mieta(fs2ta(ro;o1opxo f3iltlm emu pn(4tltnif oo1lpD  u s;s)texo(o3iodlmt  net (f rumumooo0tltnmocias m2ua( ont0 eerirctatopDrauvs;t) ruo(r oo1ol  lfcsl(f 2raurp;o4open o3ilsfaDrau o;()aeerxr ia1faDe n i (0trum(rpoudoleelnvtasfa2tru poo0tpt  ietysfmDumnms t0arermf3iy1omDelnvolt)seurio3oodlm elfcsat)artruront4olx  fciys a emnvp;()aeeomo3ty1fmt lueols) 2to(r3ny1om n nvia()s2rrur ;o1tetniieiydfsDemumo;(0altnmo iytomtrli sl()texrim oy1lpe  feia(f rraxront0tptn ietldls2rauvsnu0tltoxf3iodoptr n i;()trxr(m iy4altelnvtlt)srtauro;o4alx  fciadfm uluvp;t4arxnxrctatfmD  ueo s) 2umxopoy4lp   nei s)s2ta( oou1alt ioetyt sDuluvpnt0 rtrif3oo1lmteli sls0 rum(rpno1ape lictlt srtmxm ;t0tpe if3iatfs2raumo t0areomr3to1omtraivs;()seur(mpoo1alenlfeta() Drmxr no1opt miciyd sDul( pnu4tlxrmoctydla eluvils trxrxm3oodlmenlneilsfartm(moot4optn fciltla raums t0 leomr todlp  anes;s0srumim3nydamt mfeia(fsruaumoot0ale  oeilslmDea(vs (0altrmr3oa1opte iesl( s2xo(o nu4llt livi sfsrum(  ;t4tpx iocildfm rmu p (0trtnio3ta1fpDraivs;s  etrxr3nu4am elncsa() rtrxmoou4opxn feildls2ran ont) exnxf3oytfaDr nvo;(0s2xm(o3nudalenmivia(  Dra( ont0apxomieiyt s elu p ()teenmo iotlm eaies;s)teumxmpnydaleelfci s  2raxroot1apt iictlt s2rauvsnu)aetoif3oatopDeau s s)setr(m oodal e fcs () 2rmum ou0alx  ietltfm rmnvonu0aeeoifcoy1fptrlnvils  2tr(rpoy4ll nlnvil() 2ta(ro;t4tltomo3ild a elu s t) lxnifcia1fmtr n s t) exmxr iydaltn ncias)srurur nt4tltn ieilsfs2em( pn(0 rerir3ta1fatr ivs;t)texo(r oudlpeelnci sfsDraum ou0oex mociyslm2uanmo t0teeoxo3iydfmD  ies;s srxoim3no1llenlncsls s2rmxrpoo0tpxn fciatla eaumsnu4arerxf iatfateau s s) rtrxm3io4am nlietas) rrmxr ;t1olt iiciltlmDraumpn() ltnif3io1fmtrai slt trurir3nu1ap  lnct ( sDrax p;u4teenioeiatls elnvpnt4tetnmf tadla elieslt0tetmir oy1optelfcslt) Dum(rp;o0olxn iciasfs2uln pnt4 rtnmfctodfpD ln s (0s2toio nodlpt livs tfarraur nu4tltnioctltla2emuvp t4teeoiociytfpD anes;( s2xm(o iydam nlnetl(fa2urxr no0texomfeiys m emu pnt4tltoif3oatla rauvsls  2umir oo4lp e ietas arurxrono4aeto ociydfa2uanmsnu)alenmfciydopDr nvslt t2xrxmpnudlm e iciat aDrr( o;o0optniietas s ulnvo;u4 ltnxrctotlmDrauvi;()srxo(r3ou1ap  lnesl(  rumuro;u1apx  i3ild a eluvsnt4tltrxocoodfpt aivo (0 rxmxm oo4aptemieils) 2ur(mp;t0tex  f3tas s ran o u0trxoxocoo1lp eluvilt t2urxmpou4amtemfetasfarrau ont1tlx miciys m ea(vp (4aexrio3oo1om  lues;t t2urxr3iydlmenlfvs t aDtaurp;u4opeomo3iyslsDrlnvo;u4texoxo3iadfate i o;s seurxm3ny4lle mivt s  Draum nu1olx ii3tlslmDuluvs;()tetrmo totom rli ols0 eto(r3oydape mfcs t  rtax  ;o1opxomieiltlaDeluvs;()altnmf oydom r u s;t  rur(m3oo1ameemicta( aruau pou1aetnmieiadfa2rau o;t4areniocoo1lpDelivi (0srxmir io4lptelfesasf 2raurp;t1aexomietldfa ea( o (0altrmf oo1oat  nvo;(0sexrxrpio4oltnmfvsa()sDraumpot4altniociyd s emnvpn()alenxf3tydomt anes t) exoxr3iy1ap nlivsasfsruax pot0opx if3tydlm emu snt0altrmfcto1fa r i o ( sexr(r oo4ome lfvtl(f Drm(m no0aleomoctas aDumums t4 rxrir3io1laD auvi;s  rxoimpoo4al   ivilsf ruax  ;o0aeeo o3ias m ul(vp;t4 rxnir3oydopD  uvolt0truoxmpno4lltnlfeta(  rumumpoo0olxoifetyd a emump;u4artrmf tatoa  aieol( teum(r iodame lnvsa(f rra(mpoo4olx mi3iatlsDulumsnu)tetrxr iy1oaDraivo s0trtmxo3iy1ame  nvtlt a2tau o;t0olt  fetytfm2el(mpnu)aexomr oo1fmDe n o;() 2trxo iodol elnctl(faDtau ooo4opeoifeiltfaDrln s;(0aeeoxf io1opt livi () rumxm iy1om  liet (f ruaxmono0opxnmieiyd sDelumpnu4aexnmocoa1fat lies;() etrxmpnydll n ncs ( arurur oo0teeoif3ild s2elnmp;t0arxoif iy1fm e uei;t s2xoiopnydlmenlicsltfsDrauro;t1altnmoetadfm umuvs u0 reomo3oo1lm r ueils)trtm(o3oy4ll emies sf Dtrurpnt1olx moeiysfs ua( ont4 exnmocoytop   uvs;s0 exm(o oo1ope lnct ( a2rmxrp;o4tlx  ociat a2emuvp;(4alxrir3tadoa  li i;( trxoimpno1ameemnesl(farra( pnt4ole ioeils a rmn pn(0 rtrmr3oytfpD anvsls0s2ur(r oo4am elies (  Dtmxrp;u1aleniieiysfm rln ont)tltoirctadoaDrauvsl() 2xoxr3iy4op  lfcia( s2raxr nt4alt  fciyslaDrm(mon(0trtoif ootfmDrlneo;t t2um(m3oy4omtelivsatf Durxmpot0oexomo3iltlmDra(vont4 exrxo3ia1latelnei;(0 rxmir io1olenmieils) 2uaurpoo0tptoioctysla2rl(mon(0 leoxo3tytfpD lu ols)trxoio oo4al elnes t)aDurx ono0tetnioeias a2um(vo;() renmrciy1lmteau ol(  2uoxrpoo4ap nlieiatfsDurxmooo0olx mieilsfa ua(vo u)trerxociytomt lueslt  eto(o nudopt lfvtasf 2tm(mooo0alxnmfeiys m em(vsn() exoir tadlpD lu o t)sruoir oy4olenmnesl() rrru  ;u0aptn fcils mDemuvo t4 lxrxr oytla rauvi (  2tr(m3iydll e netas)sDur(m nt0alxnio3tad m umumsnt0trxnxfctatopDeai o;()seum(m iy1lme livils  Duax p;o4tpx mfctasla ran s (4arxnifciadlmte u s s) 2xoimpou4lm  mnvsat)arrmxm ;t0tetoifciadfsDrau p ()aexoxf3oy1om   i i s0seumxr3nudopt  ict t a2rr(r oo0tpe mfeiaslm raump t) lerxr3todfmD  ivo t  rurirpoy1amtnmnesl()aDrrx  nt1tle mietysfaDrm( onu0 ltnmoctydomDr uvs;t)sexrir3nu4lm e ivs t)sDtrumpnu1aeeo oeiatfsDea(mp u4tlenxr iatfpt li ils) euo(rpou4altemnvsat a2tmxrpnt4texnifcildla2raumpnu4aleomociy1omD anei (0truo(r3oy4lpenlies tf 2rru pnu1olt if3iasfm umnvsnu4trxnir oatlmDeaneslt)sexoxmpnodlltemnvias) 2ur(moou0tetoioeiydla elnvo;(0teenmf oy1omDr ueo t0 exmim3oodllte icslsf 2urxrono4tlxnmo3tydfaDuauvont0arermf3oydoatrai i;(  ruoxm ny1am nlncia( s2ra(  no4oexnmi3tld s2emnvpn(0areoxrciydomDrlues;t) exmxmpou1optn ivtlsfaDua(rp;u1ape ii3iatfm ea(mo;u0trxrmfciydlm eaiesls)s2tm(rpiy4ll  lfvsatfa2rmurp;o4tlxoio3iydfa ra( s t) rxnmfciadomDr nvi (0truoxo3ny4lmtnlieils sruru ono0olen ieiad sDel(vs u0arxnxrcta1oa ranvs;s t2tr(rpny1ole lnctls sDtaxrp;t0tlt  ietls m ra(vs;u0teeoifciodfa r ivsl()setriopio4apenmncia(f Dtmx onu0ale mictydla2umn o u0tlxnmf todoa  au s;t)s2xmxmpiudope  netat arurumooo4oetomo3ilslaDul( pnt)tltnif3iotoa eauei;s) 2xoxm oydlme lnciltfaDtm( p;o0olen fciytfs ul( snt)texrxr3todlm e iesls0t2xmio3ny1oltnmivslsfaDuax p;o1oexniiciatfm ean o t)alenio iy1laDeluvs;s0 2uoir iodomen ivils) ruaumpnt4apenio3iltla rauvo;()tlxnir ootfmt  nvsls0texoxmpou4altnlivils sDrr(roou4texo ietltfa2rmn p;u4 ltoxr3iytfm rauei;t) rxrir3oo4aleelncsat) 2rmum ot1altnioeiltfsDrlnmpnu0aleoircty1lateli o;s) 2ur(m3iydop  lnvil(  Dtmum ;o4aee  fciasla emu snt)aexrxf oytomDeaivs;( teumxr no1ll  mnct s) rraumo;o4opxn o3iat m2rl(vs;(0aexoir3ia1fpD ln ol(0 etmxopoydlm emies s)a2ua(rp;t4tlx moetyslm2ra( ont) ltrmr oytla  livs t srxo(mpno1alee fcilt a2rmurpnu4openif3tlt sDemnvsnu) rxomf3io1op  livs t srxmxo3ny1olenlictatfaDrrumooo1ope  i3tltfm2rlums;t) reoio ia1fmDrlnvo;t texr(m oy4altemnctasfs2urx onu1open f3tad sDeau s;(4trtrxf oy1fmtrluei t0 ruoxm3nydolt lnvtlt) ruax pou4alt  oeildlm2ua(mo (0artrmf oytlpteln o;s0 etm(m3ou1lpen nesls)sDurumooo4tex mietatfs eln ont0trermf3oodoa   n o s seuoim oo1om e fct ( arrm(mo;o0olx  f3ils aDranvp;t) lxrmfciotomD an s;( t2toir ny4lpee ivs s)arrm(mpno4olxnio3iadlm2emu onu0 lerif3iodlatr nes () 2xrirpiodom  livsat  Dtaxmooo1oee  fetlt m2emu s (0tetoir oatoa elies (  rtrio3nu4omee ietas  2rr(r nu1tpeo ieiatfsDem(ms t4trtrmr iytlmt luvs;() rxmxrpoodapt  fcsatf Dtr(m nu1apxnmfcilsfmDrl(vo ()teeoircto1fp   i i;( trumxmpiu4oltelneia(f Duaurpnu1aee  icild mDuaumo t4 rermrcta1oa eaueol()teur(m ny1al emnvia( srur(r nt0tlen o3iadlmDem( o;u0aeenmo tadlpDrli s s)setmiopoo1lp nmictlt  2ur(r ;u4oetomoetasfs elnvp t4 rermrciatlpDeau i ()teumirpou1al  mfesls) Dra(rono4tpx  octld m el(mpnt0 lerxr3tatla eauvi;s)setoio iy1omtelnvt s) rrrx  ;u0olxniiciat sDrm(ms;t0texrirciotlpteli s t0 rxoxopou1omenmicils  rtr(moot0tlt  fcias mDeln p;()texnmf oytfpteau i (0s2xrxmpoudlptelicsat  Drm(m nt1tlenmieiatlmDeauvs t)alxrmo iotop  lnvilt0 exr(m3iydame mictl()a2urumoou0tpeo feilsfsDumumont)texnif3oy1oa  livilt0 exo(mpoudal elivtatf rra( oot4aeenmoctadfmDuau ont) reoxfcoatfaDeaiesl(0seto(o3ou1ll  lnvi t s2ta(rp;t0ale  f3iadlsDemu pnu4 renmrcoodfmt  ivi;()trtoim3ou1amenmivsls sruaxmpno0opt moetyd a eaump;(4 exnmr iadfp e uvil()sexoxrpiu4ame mfcs (faDtr(rono4aeenif3iys m2ua(mo ()arxrxociodlp raieo;( srtmio iu4apeemietasfa2tmx  no1tlxomoeiytlm2emnvp;u)aeerio3iodoptr iei;t)setoio no1alee nvtls  Dtmurpot4tlt ifctydla2el(vpn(0texomr3tydfptrai slt t2xo(o iudapeelfct s)s2uaxr oo0aex mf3tysls2rlu p;(0tetomociydfmteauvi;()seuo(mpoo4opte ies ( aDuaxrp;o1oex ioctlsfm2ul(vp;(0artrif3ty1oa   u s;s)seum(mpou1opte icil()artaxm nt1tltomoetltls ulnvs;(0tlxrxocoytoaDr ues t0tetoio3iy1optn fviat) rrm( poo1aleomietyt a2uluvo u)altnio tadopteauvs;t0setrxo ny4alt lfvtl()aDrrump;u1tpeoifciyslm um( s;(4trerxf tydoptranei;s)tetoiopiodap  mfesatfaDrrxrp;o0open i3iysfsDumuvs;u)tleomocta1fmtrlues;s) etm(m3oo1al nmfcia(f 2rmu pno4tltoioeiatls2uanvonu4 lxnxrcty1lpDeln o;(  rtrxopno4am nlici t)aDra(ronu1olxo f3tys m emn pnt0tlxrio3tadomDe i i;s seuo(o iydolte ncta()a2raumont1apxn o3iyd m2ul(mp;t4aetrmf iy1fpD ai o (0setoir oy4omtnlnvil()aDta( onu0oeen fetat aDrm(vo;t0tlxoirctodop   ues;s teur(opoy1ome  fvi (f 2umxr no1opxnii3ils a rmnvo (4 etoio iydom eau i ( s2xo(rpiydomtelnetat)s2rr( ono0opt mieils a ea( o u0tleoiocoy1lpt lues;s)texrim3nodam  lfvils) Drmu p;o1optomi3iaslm2ulumpnu0alxnmrcto1fatelnvs s) ruoxo3ny4olt  nvtl()s2uaxr ou1aet ii3iys a eanmpnt4arerir iydlpDelu ils0truo(opoydolee nctat  2rmumoot4tlt mfctlsfm2rl(vs u)arerir3to1oa raues;(  2ur(m nydol   ivtat)arurump;t0aeto fctlslm2ulnvpnu4 ltrio oa1lpDrln slt truo(m3ou4ame  nvs (fs2ta( pou4teto i3ilt a el(vo (0trxoxrcoydlaDrauvs;s) 2xoim ou4ape lfetatf Dua(mo;u4texomfciys aDuauvp u0 eenmrctydfm raiesl()setr(r io1lp elnvi t)aDtrxm ;t4tpxomf3tldfm eanmp;t4alxnmf3iadlate ivolt  2trim3io4apt  iciat a2ur( oot4aeeomo3tytlmDum(vsnt0 lxrif oatopD livo t  2xoxm iu1lmtn ivt tfa2tr(r ;o0tlen ocilsfm2umnvp u0 rtomo3iytfa r u s;t0 rtr(opno1oltn nes s  2uaurono1apen fciyslmDumu p (0alxomf io1fm r ieilt0sexm(m3ou4aptn fcs t sDurxro;o4tet ifciat aDrlu pn(4tetnxo3ia1oaDrliesl() 2um(r nu4oltn fvsltfsrum(r no4oetniocildlm em(vo u4treoxf io1opDeau i;(  rxrxm oudam   iet tfartmxmpnu1aex  icias a2eln snu0 etrxo oa1fmDean slt0sexrxo3no4ale  nvs t  2rrum ;o0olto ieiys a umnmp u4 exoio iatfaD lnvsl(0 rxoir oudal nliet s  2rmu o;t4oeen fciyslaDran ont4 rermo tadlpDe nvs;(  rtrxm3no4lm  lnvsl( srtaxr nu1oex if3tadfs2rluvp t0 etnmocoy1laDrluvi t0seuoxm ny4amtemfei sf Duau pno4tptoiietatlm umumont0texoio tadopDr ivo ( trxmxm3iodlleeliet tfsDraxmo;o4open i3ilt a2elnvo u4trtoxociytlaD lueols0t2umxrpou4apeelivi (fa2uau p;t0ole  o3iyt sDea(mo;t0alxrmo todfat  n ol(0srur(m3no1alt  ncilt  2tru  oo1olx ioeiatla emums;(4tlxrmf3io1lmt lnei s) 2trim no4opeelnvil(  rrmxrpnt0tptnioctldlaDea(vonu) rtomo3iotfa  lueo ()trurxm3iy1lmee fvs (fsDuaur oo4tlxn i3iatla eanms;t4teeoif3iadoa  lues s0 exrimpiu4op nlnvilsf 2rm(r nt0ale mo3iadlm umn s u0tlxnir3iydlpDrlueil()tetrir3oydam nmnctlsf 2urxr ;t0tlt  fctas a2ua(vp;t4arxomf oa1oat  u o (0texoxrpoodlmtnlietat)artmxmooo4opxoiietat a2ea( o t4 renxocoodfa   n s;()srxo(m3io1apeemiei t a2tr(mp;t4altnmociydfa eanms;t0arxrir3iy1lat  n o;s0tetmio3iudame  netasf rumxroou4texo o3iad sDulums;t4 rtoxrcoodlp  livo;s trtmxmpou1ole mfetlt)sDtr( pot0oleo octysfm2rl(von(0tetomo iotfa  li o s  2to(o io1lm nlfct (f 2umxmooo0ope  i3ild s2um(ms;t4aexnio3tadopt ln i ( srtrirpoo1openmictl(fs2trurpou1oltomo3iytfs em(ms;(0 ltnir3ootfate ieolt truoirpio1ome  ivs s  Dra(moou1olxnmiciatlm umnmpn(0teermociytlm e uei;t)s2uo(o3oudlm n neia(fsDrrxmo;o4oeeoiietadla rluvont0treoxr3ootomDrauvs;t0trxo(mpny1lmtnlnvsl(fsDrm(rono1oetnmoeildfm uaump;(4texoif tytlp  auvols trtmio iu4amte fvs (fsDtaxmonu1apx  i3tadfm2ean o u) etnif3tadfpDe n i (0t2xoim oo4amt mneslsfaDtmur ;o1alen o3iltls2em(ms;u0 lxoxf oytlpDrlieolt seurir3io4apeelivtatfaDrau  ot0apt mf3iatlm ra(vonu4aeeomfcta1lmtrauvsl(0 ruo(r3ou1al   fct s) 2rr(mo;o0alx miciltfaDrl(mp (0 rtoio oa1omDelueo;(  eumir3no1lmee nctltfsDtrx ooo4tpxomfcildfs2umnmpnu)arermr todfp  livi;(0setr(m iudlp  mivsatfsrta( o;o4tlxoiictytls umnmont) rxnmr tatlatrauei s seumir oydomte nvslt  2tmum ou4olxomi3iys mDrmnmpnt)aexnif iydoa rlnes t  rxmim oy4opt  icta(f 2ra(rpno0tpenif3ias sDrmnms u4arenxocto1lmtr uvi s srtmxr3oo1op nmfvtlsfa2rau ooo0tetn i3ilsls2rmu p;t) eerxo io1fpDe n i;t)truoxr oo1omenmfcs tf 2rru p;u0tptnifeias s rluvp t4 leomocio1fp  anvol()trxoxo3iy4lm nmicsat  rraurpou0alx  oeilslmDemnmp u4artoio3oytoptr n i (  2trimpoodlpee nesasf 2uaxm ou0aexnmietatfaDrm(mont0aetnmfciadoateanesls sexrxrpno4omee fct s)sDtaumo;o4apxomfeiydfa2ulnmp u)aexrmrcoatlpDr u sls0srxrxrpoodoltnmicsl(fsrtmum ot4opxn o3ilslsDelnvp;t0trxrif iytfm  ai s t0trurxr oudlp nmivsa(fsDrm(rpot4openmietytlsDrlnmo u0 rtoxociotfaDr ivsls) rurim ou1apen fvs (fs2uax o;o1tee mfctad sDrluvs t0trerio iotlptelueo t0srurimpno4olenmieta(f 2rmu poo1oeeomf3iyd sDua(vs u0 rxomr iadop elueils t2uoim3nu1lpt  nviatfsDraum ;o1aee if3iyt aDea( s;u0 etrxrcoo1oaD anvsl(0 rxo(rpiu4lpt mfvilt aDtmu  ou4apxo i3ilt m ra(vonu0tetoxrciadlm  aueols0seumxr iudom nlfctltfaDrru  ;u1oleomicilsfm uanms (4texnmfcia1lptr nvo s0 2uo(m nu1lp n nci (  rrru p;u1tpxoif3tlslmDea(von(4tlxnxo iodopDran i;t  2xmiopny4apeelfcsls  2uaxr ot0aeeoio3ias mDrm( onu0tetrxo3ta1fm eln il()s2to(m ny4am emiviltf rrmx o;t0tpto oeiat a2umn p ()aeeriocoa1oa e n s s0t2um(opnu1amtn ietatfaDurur ;u0ope  oetlsla ulnmp t4aexrxf3iodfatranvo;t)s2umir3no4lm elivtls)aDuaumpou4tpe iociatlsDuaums (0 rtrxo todopte n sls0 2trxo nudamt lncs s s2rmxmo;u4tltniieild mDemn p u)arenir3ta1fatrau o;s) rxmxr oy4omte feil()s2taxmp;o4tpe  fetlslmDrmn p;u) rxrxfcoodfmteaivs s0srto(rpiu1lptemfei t arrr( ooo1tex  fciys m umuvs u) eenxr3ia1faD livol( srtrxm3iodamtemnetat s2ur(  nu1oeeoioetatfm2rln onu0tlxnmr3iy1fm ran s s  2tm(r oodopee fvsl()sruru pnt0tle  i3iltfs2rl( pn(4alxnmr oadlm raiei;(0seuoimpny4lltn fcsa(farum(  oo4tlxomictydlm eanmont0 lxnir3oydfpDr uvo;t0 rxmxrpiy1lle mfetlt)srurxmo;u1tpe ifeiys m2ul(vs;t4arxoio3oo1laDrli i t s2to(o3iudllen fvt ( srtaxmoot1apt ifeiltfs uln snu)tlxrxocta1lp rlivsls0 2tmimpio4amt lictl() rtr(  ;u4alxnioeiltfaDea( sn(4arermf3iytfpt  ivol()texrir oo1aleemfesl(f rtaxmono0opeo iciydfs rau pn(0 eenif3iytomD  nvs;( seuo(mpou1lm nmnvt (f Dtr(mono1tlxo feiasla2rm( o t) leomrcoodomteanvs s0s2toxopiu1lm   ncsls)s2rrurp;u1aee  oeildfs rm( pnu4aetoifcta1lptr neo;t0srxrir3oydlmtn nctls arta( pot1altn ocild m2rlnmpnt)texoirciydfp elnvol(  2to(o oy1am emfctat  Dua(  ot0oex  i3iatfm2eau o;() eeoifciytom rli ols0trxmxm3iu1lpen fetl() Dtru o;u0oetomf3ilt s rm( s;u4tlxnxr3ty1fat  neols0sexoxr ny1ap nmncils)a2rr(  nu0apeomietas m ea( pnu)trxrmfcty1lp rauei (0setmim3oy1lp nmnet sfsrtaur no1ole  oetas a2el(vonu)arxnio tydopDrli i;t)seurir oudlleemnciltfs2umumooo1tpeoiieiysla elumo t4 eenir3iydlmte nvols)teuoxm ou4aptelicslsfs2tm(mo;o0oltomoctls m2emn s ()teenio iodlmDrlnvi (0 exr(m iy4amtelietat)s2tm(rpnu0tpx if3iytfs2rl(mo (4trxnmf3oa1omt anei;s teurio3nudam elncsa(fa2umu oou4opeomiciydls2rlu snu)trxrifctytoat lies (0 rxoxm io4amte nviasfarumxmpnt4tee mfeiyd m2uau sn(0tltnmfciydomtelueslt setmxr nu4ll   fvt (fsDtaxronu1tlxn iciatfm rlumsnt)aetrxr3ootlp ranei (0sruo(r iu1am   fvslsfartm(r no1aexn oetadls2ean pnt) rtnxf iydoptr u i ()seumxr oudapenmnvtlsf rtaur no1oltoif3ildlmDumumpn(4 eerxo3tadlm   ivo;() etmio3ny1omeemneslt) Dumx  ;t4olt moeildfmDea(ms;t)altrifcoo1lpt auvils sexo(mpoy4oleelnetas  Dumxmoot0optomi3ildlmDelnmpnu0aleoxf totfat lnvo (0s2xrxrpoydlpt mfvs ( aDra(rpnu0tleoifetys a elu snt4 eeriocia1opt aiei t  ruoimpnodll   net sf 2rmur ;u4aeeo icild m2rm(vo t0 rtnmr3iadoat  u il()t2urxo3nodllt livt (fa2taurp;o1tlt  ictldfm ua( s t4alerxocoatfp e nvo;s0t2urxm ny1amee fetltf Drrxroot1ape mfctlt aDumnmont)tlenxr3iodfm e n o t srtrxopiydamtelnet t  2um( p;u4optn octldfs2rmnmo ()tltomf ty1oateaueils s2uo(mpoy1lleemnvil(fa2tm( pot0aexomfeild mDrlnmonu) rtnxf3to1lptr u s t0srto(m3nu4lm  livil(fs2rmu pot4aee iieiadla2ua(vo u0arenxrcoatoa  lnes;s sexm(r3ou1ll elnvtas) 2tax  nu4opxn o3tas s2eluvs;u)texoxfctodfmteanvi t texo(opno1am nlfeia()srum(rp;o1opxn ictltla2el(mpnt0 lerxoctydlm eaues;t)sexmim3oy4alenlfvs s) rtr(rpnu1oltn oeilslm2rmn sn(0tlxomrciatlptrauvs t0tetr(r3oy4llt  ncsl()aruaxr ;u0opt mfciad aDraumo t0teenircio1om  lnvol(0 exmirpiudal elfctat  Dtau onu4tpenmf3iyd sDuanvs u4 exnxo3oadfmtr i o t)s2ur(r3ou4opte fviat)sDtrum ;o0ale mociltfmDulump u)altoxrcia1faDeai il(0srxo(o3nu1alen net tfarraxmont0tlx mi3tyd mDulnmo t0aexnxocootlp  aiei;s0 etr(mpnodopee ieilt s2rrx p;t1tee iociytls uauvp t4 rtnxo3tadlp e u o s s2tr(r3no1aptn fvtlsfs2rr( ooo0alto f3tlsfsDuauvp;(4tetnmr3oadlp eaneol(  rtmimpoy4am  lfctlt arrax o;u0oee io3iltlmDra( ont4aexnxocoo1latrluvi;( s2tmxr iy4ll  lfct s a2rm(r oo4tltnmieils sDem(vo;u0treoxr todfpDr u ol( t2urxo ny1amee fcs s  Dua(r ot0opx ifeilt sDul(mo u4artrir3oo1faDr ueol( sruo(o io4ape livtltfs2rax pnu0openiiciltlm2rmuvonu0trxnmf3iytlpDrli s t0 etmxr3iudale  nvsas  rtrx pnu0tet  ociad s ua(vsnu)arxomr3ia1fmD lneo;t  2tmiopnodlm elfvslsf rrru  no0tltnioctytla2eaumo;u4 etoir oatopDelu s;s0trtm(o3oydlp   icil() 2urxmpou4tlx  f3taslsDeauvo;(0texoir ootlm eln s s  rxrimpio4lmtelnvi s) 2rauroot1opeomocilsla ua(von(0 lerxf oatop ean i t) eto(mpoudll n ivt (fsDtmurooo1apenmfctls sDumnmon(0teeomr tydlatr uvols)sexrim3oy1lmee nvt tfaDrm(m ;t0olxomieiatla2elump;t)tleoxr3iydom elues;(  etrir3no4ome mics () rururpoo1texomocild aDumnvon()tetoio ta1fm e ivil() 2trxr3oodlmenlivi tfsrtr(mp;u4oetomoctytfm2ra(mo;u0tetnmr iydlp rau i;s)srxmimpoo4om emivi s) Drr(moou0tleomoctlslm rm(mo;u0arenircio1faDe u s t t2trim oodlm elnctlt)artax  nt1tpx  f3iydfm2em(vo u0texrmfcta1fm  auvo t0s2uo(opoydomtnmietatfa2taumont0oex ifetytfm emnmonu4aetnmo3oy1fm  li ils teto(r3io1ale micils  2rrum ou4alxomociytfm rl(mon(0aetomf tydoptr uei;( trxo(m3oudome  ncslsfsrtrxmpnt0aleoiiciat a2rau p t4trtnir3oo1optraivsl()setr(m3nudaptnlncil()a2rm(  oo1altniociysfa umn ont4aexrmf3oo1opt li ol(0 rtoim3oy1omeemfvi s  rtrxrpno1tex  ietatla ulnmo;u4altrio tytfmtelu i;s)truoxm3ou4llte fci sfartr(m nu0opt if3iysfa2ua( o;t0altrmfciydlmDrli i ( trurxmpno1am  mfcta(  2rmu  no0apx if3iysla2ean ont)trenir3iotlmt  nvs;s0t2xm(rpiodamtn fvsa( srtaxm nt4altoif3iltls2umuvp;u4 reomf3totlmD anvsls0trxoxr3oy4ameelfvtl(  Dtax ono0olx  ieiadfs2rl(vsnu) rtoifctotfm raiei;t0 rumim3oo4llee ncsat)arrrum nu0tpxnioctldlsDum(mp;t0aexnmrcoydomte i i;t  rumxr no4ol elnvtl( aruau pou1aex mictldfmDrlnvo;u) eeoxrcty1omDeli i;t)truoxr3nu1alen ncias)a2umum no1olxoifciat aDel(vo;(4 eeomr3iotoaD livo ()s2to(m3nodam  lfetl( srur(  nu4olt ifcilsfa um(mo;u)tltnircto1fp e nvo;t) 2xmim nu4ol n nvs (  Dra(rp;t1alt mfctas m2ea( ont)trerir tatlpDran s s)srumxm3oodolte nvt ( srtmx p;o4apto icild m ea(ms;(4aexrmrctodlateluvsls)setmiopny1llt mfei t)srtr(mpnu1oeeomiciad s ul( s t0tetrif ta1lp  anvslt0 etoxo3nu1ll emfvsat)a2tmxmpno0aex  ieiltlm2um(mp;u)tetnircoo1opD luvo;(  rtr(m oo4amt mivsls srtmur nu1olxnmfciatla2uau s;t0 lxrxfciytoa  livs;(0 rtoxm3no4lme lfei t)s2rruronu0tltnioeilsfm2eanmonu4texrirciy1fpD livo;(0setm(r3oo4alenmnvias  2ra(r ;o4teeoifcilsls eauvp u)aeeomr oo1opDrliei t0 2tr(rpiu1lm e ici t a2ur(mp;u4tpeo ietadla2rm(vpnt0altriocto1opt lu i;s teuoxr oudome mneilt  rumurpot1ole  f3tysfm2ra(vp t)artoxf oy1la  anes ( sexmim ny1op emfct s arrrxroot1aptnioeilt a2ra(vp;t4texrxr3oadoa  lnvolt0t2trxr oo4omtnlict (fsDrr( o;u1opx miciat sDrlnms (4treoio ta1lmt aiesls)seuoio3nu1lmtnlnei tfs2rmu o;o1tpeo feias s2eanmpnu) reomo3oy1oaD ai i t)t2xmxm3iydaleelies ( arurxro;u0oetnmo3iydlaDumnmont4alxoxoctydopteaueo ( tetmxopou4ap n neias a2tmump;o0tpeomi3tydla2rlnvont0aleoxf3oadopD au o t)teto(mpoy1amt lictlsfaDtmumont4oexniiciytfaDeauvo;u4 renmrciotomtrli s;( seur(mpnu1apeemnctltfaDraxm ;o0tpt mo3tlt m2rl( p;(4aexrxr3tadfp  ai s s  exmxmpiu4llee icsa( s2tau o;u1tex  oeiadfsDel(mp;t4aexnirciotfp e neo ( trxoxr iudalt mnetl(farur( o;t0oltoioeild mDulnmp;t4 rtnxf oydomDeln il()t2urio oydopt  fvi (fa2rm(mont1tpeo ocildla2ranmo;t4 eeniocoydoat au o;() rxo(o3oodlpe mict sf 2rm(rono1altniieiadfm2umumo;u0 rtoio3ty1opt aues;( trtmirpiy1ope  fcsas  ruaurp;u0oetnmieiatfs2eauvs ()tlxoir3totlmtr uvsl(0t2to(o io4lltnlfcsat)arra(  nt4tptoif3tysls2em( snu4teenmf ootoaDe nvi s) 2uriopny4aleemfct (faDtm(mo;u0apxomo3iadfaDrau p u) lxrir3oy1lpD an ol(  2toxm3io1omtnmncsas  Dum(rp;o4ole  ociatlm2rmnmsn(4arenir ootlpDrluvo;s0setr(o3ou1ome lneias)aDrmur ;o0tpe mieiytfs2rl( p (4 renmrctodlaDeliei;t0t2to(r3iodlmt micsls aDuaurpou1tex ifeiad s uanmonu4artrxr3iydomDrlneo;s s2tm(m nydal elnvia(  Dta( p;o0olxnifcils s2rauvs;t) rtoir3tatom   iei ( srxrxrpoo4omenlnvs ( s2ua(ronu0oetoii3ildfm2ra(mo;u0 rxnxr3ta1lat lueo;t)t2xrirpou1lme lfetl()sDtr(rp;o4olxniiciltfs2el(vsnu)treoif3oadlm raneo s)trurim nydap emfctas)aDrrx  oo1teeomfciat sDumnvsn(0trxoxrcoadoatran o;s)s2tmir3ny1amt mfctatf Drru pou0tleomoeiydfa2rauvo;t4aeenmocoydfatrlies ( t2xmxr3nu1ame lict t)sDrrxront0optomo3tls m umnms (0tetnxo ty1opDeanvi;t sexmio ou4al   feiat) ruaurpnt0alen feiat a2el( p (4 ltrirctydoatrlivi;t)seuoimpny4lmeemnetl(f Dur( poo0tlt mieildlaDelu s t4aleoio3oadlpDeaneols)srtm(opoy1lmt  ivs sfaDtm(mono1tlxomf3tadlaDelnmsn() reoxo to1lmt aneo s srtmxr nodaltnlfes tfa2rmumo;o1oetniiciasfa2rmnmp;t4alxnxo3oodfaDelnei t0seum(r3ny4op nmiviat a2rau p;o0alen fctltfsDulnmonu4 lxnmf tatfm elnes;s0 etoir nu4op elnvtat) rtrum nu0tetomieiadfsDuauvon(4 rxnmfcio1opt au o;()seuoim3iudlp  mfvi s  2ua( onu4tex ioetydla uanvp u)alenmo3ta1oaD aiei ( teurxm3oodlmtnmivil( aDumumo;t4opt ioeiytls2rau onu0altrmo iytfm r ies s0srxrxmpnu4ap e ivia() rtrur ;t0ope mfciltfs raums;u4 eeoxr iydomD anesl( s2tm(mpoydlltn iesl()s2ra( o;t1tlto ociydlsDrm( snt4arxoifcto1late ies;s0 rxr(m3oo4ol nmfvta(f Drmu ont0altoiietasfm2rm(mo;t4aetrxocoa1opt  neo t  rxoio3no1omen ivsasf Drm(  ;t4opt  o3tldfm ean pnt) ltoiocoodlmDrli i;t0s2um(opoo4altnmnctls  2rrum nu4aexnioeildla2emn pnt)trermf todlmtrli s t tetmir iu4lm nmics ( a2ra(r ;t4olt mociltls2uau s;(0 exoio3tatop r ieolt  rtoxr3nu1omenmfvtl()aDtmu onu1tetnmoetldlaDean o u4texrifctotom rlivo t srxoxo iu1omenmiei tfaDrm(monu0aee  iciasfa2ulnmsnu0alenioctodomDrlueol(  2xrxr nodame mnesat) Duaxmo;u0tlx ifctad s ul(vp;u)tetoir iatfat  i sls)trxmimpnydal  lncsl(fsDtruro;o4tpxnifctydlm raumon() exoxociadoateluvslt) euo(r iy4olenmfeil()sDtm(moot1aet mo3tyt sDeanmsn(4 lxrmf3iytlpt  nei t0s2xoir3nudlp nmivi ( arta(rono4opxn i3tlsla eanvs;u)aeenifcoa1fpD lies s0 rtmirpou4opt mnvsas  Dtrumpou4tlen ieiatfm eln p;u)trtrmf3iy1lpD luvi t s2toxm3iu4apte ncs (f 2uru ono0tlt miciydlaDrlnms;u4 lenir oy1omt lieo;t) euoxr io1opt mfvtas)arururpnu1altn feias m um( s;(4alxoif ta1fa eaivs ()s2xm(o ou1am emfes (f 2tm(r oo0tpenifciatls eaumont0tlxnmr3ootfp elivi;() rxrio3iy4apt  fvslt) 2uru o;u1oltomfciad mDem(vo;()tlxrmrciotomDrluvo s0 rxm(m3no1lme mfvtas  2rrx  ot1alx ioctytla emnvs;(0tlxrmr iodlateauvi (0seuoio3io1openmieslt)sDumur ;o4tet mfeiysfa eanmo t)treoxf to1fa eli s t0 euoio3no1opeelieslt s2umum ot0opx  ociadfsDemnvont4 rtnmf3tytlpDraivi;t  2umir nudap  livia(fa2tmurpoo4apeniocildlsDrl(vs ()teenmoctytlp r uvol( s2xoxr ny1alee nctat)s2umumooo4tpxo fciadla2elnmsnt0aeeomrctatfmt an il() 2toxr iodalen fesas)arrrumpot4aptn fctasla2ua( o;t)trenmociatopteaneslt0trxr(m3oy1amte net s  rurxro;u4aeenmfeiysfs ra(ms;t4tltnir iydlpD ai i;() etoir3nudlmte icsatfaDta(m nt0optniictlsls2umuvp;()altomocoatlp  li ils0 rtm(r io4lptnliet ()a2tax p;u1texo o3ild a uauvpnt4trenio3io1lmD  uvo;t)s2uoxm ou4openlivsls)aDumxro;o0alt mi3tydlmDrlump (4 etoxf3io1lpD lueo s setoxr3io1lptnmicsatfarrmum ;o1tetnii3ilsla2rmuvpnu4 eenxf oatlm r uvo;(0 euoxo3oodll elfvtas  rrrxmpoo1aexnmicildlsDuau o;()arenxo ta1faDr ivo (0 rto(r nydopee fvs s aDur( poo0aexoifeias aDemnms;(0 leomfcto1op  auesls sexm(m3ou4al eliesls)s2umx  ;u1apeoif3ilslm2uan on()alxoxr oy1lptrlivslt0 eum(rpio4ole lfvsa( sDuaurp;u0texomoctyd aDel(mo ()arxoir3oo1omDeai o t0trtoimpoy4ol e feia()a2rmu  ot4aee  fetasfs ra(mpnt0alxnmf oytop   n ols)t2um(o3nu4amtelnvil( sDrmu o;o1aleo ociadls ua( o u0tlxrxo ty1la eaivsl() exmirpiu4omtn nes t  2rmurpou4aet ifciad m elnvon() ltrxocoydopDeaues (  exmio iydlmtnmnetl(fa2rax  ot0oeeoifeiydfsDel(mp (4tetrmrctydfaDr nvo t t2xm(o iydlp   fviasf 2rmxr no0aet mfeils m2uanvo;u0aleomo oadomD  ivs s)srurxr iodop e ivi (f Dtrumooo4tpe moetaslmDem( p;(4teenmf3iadfmtranvs;s  rtr(rpoo1omeelncia()sDrrxrpot1optoifeiyt s um( o;t4tleoxr3oodom ran i s0 rtoxopoo1lmtemivslt  rrr(rpou1tee  oeilt m rlu p;(0trxrio3tadla   ues;t t2xo(m3oodapen iesls  2umump;u4oeto ieiyslm eanmsnt4areoif3iadlp e ieo;t0t2umiopiodllte fcia()a2tm(roou0aex mocildfm emnmpnu0artoxrcoodfmtr ieo;s)t2tr(rpny4lp elnctat aDtmxrp;t0tlxn i3taslaDrmnmo;t0tleoxf oytfaD  ieilt) etoxo oo4om elnviasfsrumxmont1alx mf3tadla emn s t0 rtnmf io1fpDeai i (0 exrxo no4aptnmfvs s)arrmuront0aee ioetldlm2ua(ms ()tlenxfcoytoptrlu o;s s2xmxr io4op  livs tfartax p;t4tpeo o3tat aDeanmp;t4trtoxrcto1fa eauvo;() etmxm3nu4lmenmfeil( artrxm ou4opeo f3iyd m2rmnvsnu4artnmrcia1fptrlnvil()texoir3oudomee iesat sDra(mono1ale mo3tltfsDrl(vp;u0alenmfcoo1fpDe ivo;t)trxo(rpiodap  lfeta( aDtmx  ;t4alen ietydfm em(vp;t)arermr3oadlaD luvi ( srxo(o3nydlpe  nciasfaDrrxro;o4olxn ociysla ea(msn(4areomf todlmD aueilt0 rxoio3iudol  liei s) Dua(mo;t0alx  iciatlaDrmnmp t) rtrir3oatoptrlueo () rumir iudapenlfctl( aDtr(  ;t0aex  i3iyd a rau snt) etrmfciotlp  auei;t)srur(o3nydomenmieias)s2tr(m nt4oetomo3tls a2rmnvsn()altnio ta1la r ieil( texm(m oo4optemncil( arurx  oo1altoifeiydfa2elu p (4 leoirctydfm eau o;t)sexm(r3oy1aptnlietat srtaxmpno1aexoioctad s2rlnmo ()aetomf tadfa e u i t0setm(rpoudlm  mfvt sf 2umxr nt4tpx mo3iad m2em( o t0treomrcoy1lm rai il() 2um(o3no1ap nmietas a2umxro;o0tlto oetysfm elu s u4 leoxocoytla e nei t)s2xmio3oodam nmfci s srtrumo;o1apx ifctytfa rmnvs;t)tltrmr3to1fm raneo;t) rtm(opny1apeemfes tfsDtmxm ou4alen iciasfm eaumsnt4aexnio tydop r uesls0s2toxm3iy1lpte ictas)arrmur ;o0apto icilsla2ean ont4aeermf oodlatraneo;(0t2tmxm3oo1op   fvtls) 2umu o;u1oet moeiytls2eaump u0 exoxo tydfpt lieo;t) rurxo3oudam emnvtas)srrmxmpou1tpeomo3iat sDumn p t0 lenmf ty1op  aueil( t2uoimpoo1ole  fct s sDum(mpnt4aex mieiys a2eanmp;()teeoxfcia1fat lieo;() rtm(o3oy1ameemfct ( artrumo;t4oltn ieilslsDrau snt4trxnxo tatlpD  ueil(0 2uoxm iydlp emicsas  rrru  ;o4aleomoetydfmDranvp t0 rxnmrcoy1oaDrauvi s0 rxoim iodlmenmfciat)s2tmu pot4tpxo oeiytls2ulnvp;()aeenxr3tadomtraues t)seurio no4om nlneia()aDtr( pot1tpeoiociyd mDrmuvs t0trxoxfciatopteanvolt)sexrim3oudll   ics sfsDtr(mp;t0ole mieias sDran s u4 ltnxf3oydop   ies;t)t2xrir3io1apen fvias) Drmu o;o4aet  ictyt sDranvpn()arenxr ia1la  anvils)truoxm iu4omt lnviatfa2um(mont1tlt miciyt sDrl( pnt)altoxrcoadom  au o t0 rtrxr3oodap   fci s aruax p;o1oleo ietatlm rmnmsnt4artoiocoy1opDelu i t)srurxr3nu4apteliviltf 2raxm ou0texniicild a emn o;(0texnxr3oy1omDr uei s)t2toim oy4ll   fei s arua(rono4tpx ifeias s umump u4 rtrxociadopD  i ols t2to(mpiu4lpe  iciasfarua(  ou0oeeoif3iasfmDeluvp;t)trxnif3iy1fmte n s () exoim3ny4optnmfci t  rurxmoot1aleniiciysfs2ra( on(0tltrif iotfatr ieo ()s2umxopio1lpeelietatfa2rmxm ;u4aet mo3ildfm2emnvp;u0tltnioctytfpDraneo;(0setm(o3iydoltelfcs ()sruaxrp;u1tetomoeiadfsDelnmo;t4tlenio iy1fateau o;( t2xm(r oudam   fcsas)a2taum ;t0tleomfciasfm rmnmp;t0teenio3todlpDr uvo;t0teurxm3nydlme lnvt s  2uru  oo1opto iciadla2umn o;(0 rtnmocoo1fp r nei;s0tetr(opiu4ap  mnvsasfa2urumo;u4tpe  ictltfs2emumont4trtrmf3oa1fmDraivo ( t2toio no4olee nesas  rtaurpou1alenmfciltls uau s t4 renir iatom  an o (0 rumio io1lmee nct ()aDrmxr ;t1aleo i3iyd mDumn snt4arxnxf3tadoatraieo t trtmio3io1apenmncias srrmx p;t0optoiiciytfm ul(ms u4tlxnxr oytfp e i sls) 2toxrpiy4omtnlnvi sf 2urx  ot4tpt mictltfa rlnmpnt0tltrir3iadlmte ivi t0 rtmxo ny1lmeemfcsa( s2tax ono1oetn f3tytfm uln pnu)arxomfciadom elueo;s)texoirpiudol nlfciat  rrmxroou0ape mfciyt sDeln o (0tleomf3iadomD luei t0s2urirpoo4omtnmfctls)sDrmx poo4aptn feild mDeanvo;t0tleomo iodfat an o;(0trto(mpiy1ame  fvs ( a2raxr oo1apenmfciltlm2rmnmpn(0alxnmr3oytoa   uvi s0seur(m iu1lmt  fvi t)srrrumpnu4tlenmoeiyd mDrmnmpnt4trtnxfcoa1omt lies t)teto(m no1am elfvsl(f rur(monu0ole ifcilsfmDum(ms;u4 renxrctydomDr ueo s  etmirpoy4ll  micilsfs2ur( pnt0aee ioeias s2el( s t0tleomf3iotfaDrlnvils t2xo(m3io4ap nlnes tfs2rr(rp;o4tet ioeiat m ea(mp;t4aexnmoctydom e n il(0sexoiopiodamt lfcsl(  2ra(r nt4apxo ieiasfa2uau sn()teeoir3oodoa raiei t0teurxmpnu1alee fetlsfsDuaxr ou0aeeo oetad s elnmo;u)tetrxr iytoptraueo t0 rum(rpnudom n ieias  2rr(r ot4aptnmi3ils mDrmu p;u4teerifcootlaDelivils) rxoxopiu4olee ncsa(fa2r
\ No newline at end of file
@@ -0,0 +1 @@
+ueo s)sruoxr io4opeelictltfartrump;u0tle  i3tatls rmnvs u)trtrio iadlatrauvs ()s2to(m3nudaleelncsat  2ur( o;u0tpt  fciat s elnms;u4trtrmr3oadomD  uei t0 exmxopoy4ap  licsatfaDuaum nt4ole ifeiatfs2uan p (4aexnif oydlateaiei;t) 2tm(opoo1omtn ict sf 2ua(mpnu1optnmi3iltfs rl(vsnt0tltomocoa1la e ies;s) etoirpio1om   icslt)aDtrxmpou1aeeniieilsfa2rmu snu0alenifcoatomDr uei s)trurio3no1amt lneia() ruaur ;u0aeenmictltla2el( snt)arxrmo3iadlm eanes (0seumimpoodaptn nvs tfsrtaumonu4tlt  ietasla2em(msn(4trxoxf3todfp  au o t trtmiopoydalte ieias)arumu pou0ape  oeiadfm2em(vp;u4 eenxr tadla eluvo ( seuoxr oo4alt lfeil(  Drmx pno0opx iietlt aDrl( p;t0aeeoxo iydlm elu ols) rurim3no4omte ietls aDurxmooo4tptomoeiltfs ua( p;(0alxoif3oadoat lueo;( seumiopiu4llee ieta() 2rm(rono1alenmieils m ea( pnu)trermo3iydfp elu s t t2umxm iodome micsas)a2tm(m oo0tlx iictasls2rl( s;()texomo iydlmDrau i;s  2tmxm3io1amtn ietlt)arrm(ront0texn i3tltfsDean p u4trerif todfpteliesls0srtrxmpio4oleelfcslt srum(r ot0opt mociytfm ulnms t)trxnxr iydom e nei s0 rxo(o3io4lmtn ncslt a2ua(ro;u1olenmocildlaDuln snt0trtniocoatoa elivils0s2toir3iu1amtnmfcilsf 2ta(moot4tlxnmoetasfs2ulu o;t4aexrmr ia1omtr n i s  2xoir3iudlleemncta( arurur ot4ope mfctadfmDrau o u0aetrmo oatoa  li i;t s2xrxrpnodlm  mnesls aruaxmpnu0tpxnmictlsfsDea(vpn(0tetnif oadfaD li i;s0srtoxr3oudlp emicil() 2ra( pno1alxomoeiytfs2rm(vs t)altnmo oy1lmt  uvs (0 2xr(rpoo1open ictltf rurur ;o4aetn octatfmDelnmpn() rtnifciytlpDeai o (0s2toxm iy1apeemfes sfaDtm( pou0altn iciytfsDelump t4trxnmo3oydopt lneilt0srxo(mpny1omt lnvt (  rtru ooo4tee mfetysfm2eanvo;u4trenir3oy1faDeauvi;(  2xr(r3oy1ape  nctlt) 2um(  no0apxoiociysfmDul(vo () etoircoytlp r nesl() 2tr(r3nu1lp n nctat aDrr( pnu1olxnmoctatls rlu onu)tlxnir iodomtelnvs;(0 rxrir3oo1ap elietls) rra(r nu4oex mf3ild m2eanvpnt0arxoxfciy1lp  au ols) etoir iydolt  ncsatfaDuru  nt4olen ictls s ean s () reomrcoy1latrlnvi;t)seuo(o3io1oleemnvsl()srraumpoo4tpxn ietltlsDumn pnt)aetnxo3iydoaD  nvs;s texrir oy1altemnet tf Duaumpou0oltoii3tyt m ea(mont0aexrif ty1faDe i o t)tetm(m3oodoptnlicilt)s2raxr ot0aptnmictadfa2rmumpnt4 exnmrctodlmtrlnvsls0srurxm3iydoptnmivi (fs2rmur nt1opxnmi3ild m uanmsnt4 lermf3iadopteluvi;( t2uriopou4ll nlici sfsDum(ro;o0oet ifetldfa2eaumont0arerxoctodfmDeaiesls  2tm(mpno1apt  ics t) rtmur nu1opxomi3tyt s ean s;u4artrif io1fa r u i;()trxo(o3no1olt mfcilsfaDra(  oo4oet moctad m2uanvp;t0alermf tatomt lnvols0tetoirpoy1alen nvta() rtr(m ;t1oetoifeils mDul( s u0arxrmr iotop rlueils  ruoio3oo4aptnlnciasf 2um(rpou4oeeo ieiyd m umuvp t4aetnir iotfp rlueo;t seuo(o3nodoptnmncs t artaur nu1tltnioeiyslaDrmnmp;u0tetrir iydlmt li o t seumxmpno1aptemfesls  rrau  ou0openmo3tyd sDran on(4aetrmr totomDe i i;( trtoir nodlpte nctlt aDur(ro;t4altnmieiatfmDul( onu) rxnxrcta1op rai s;s t2triopiu4am  mivtls  rtrum ot4tet ifcild a elump;u) rxrxr iytoa eai s;s texmio3nodlpe  fvia(fs2ra(r ;t4tpto ieiydlaDumnvpn() eenxf3iy1oaDrlnvs;t0 etr(o oo4al e ivilsfarrau o;u4opeomocild mDumu onu0artoxf3oy1op r uvi;s setmxr3no4ap nlfesl(fsrtrxm ou4olen ieildls2eaumsn()trermfciydlp eanvslt0 2xmimpou1olenmivs tfs2raxroou1tpe  icias a uluvp;u4aexnif3iadomDranvi;t srtmim ou4lptemnes (f rtmxmpot0apenmo3tld a2rl(vp ()tltriocty1lmte n o;t)seurxopiu1alte icia(fartmx pot4tleoii3tyd m um(mo;t4altnio iotla elivo ( seuoimpio4apeemnvt t  2rrxrpoo0aptnifetasfmDem(vo;()altrmr3io1oaDr i ols0 2urxr3oydamenlfetlt  2ur(mono4tlxniiciydlsDuanms;u4treoxo3oytfm rauvo ( tetmxm3ny4lmt mivil()srur(  ;u4tee ifctatls2rm(mp;()arxomo iytlp r i o;s)truoir3oy4om  mfeta(  2uax onu1tet ioeiyslm2em(vpnu4 leomo oo1lmt  ivi s s2xr(opoo4opt mnvsa(f rur(rpno1tleoio3ild aDuan p ()alerxo iotlaD aueo;s0srurio3iudol  mivsl()s2ta(  nt1aetomiciltfsDeluvont)artrxo oa1fp eaivs ()sexm(rpiydole mfeslsfsDtru  oo1tle mf3iys a ulnmont) etnmo oa1omD aneil(  2toim3oo4ol  mict t a2rmxmp;t1aptniicild m eau onu) rxoxf3iotoa rlnvsls srxo(o3nudolenmivsl(fa2trxmp;t1alxnii3iatfa2ranmpnt0aetnxf3tatoatrlivs;s) rtrir3nodll emfvsas sDtmxront1tleo o3iat sDrm( o;u) lerxocia1oa elnvi t) 2xrxm3oudllen fvs s)sDur( onu0aetnif3tydlm rlumsn(4 eeoxrcta1om   ieils0 2xoir3io4ll nmfvsa()aDrr(mooo0tpto oetatla rlnmp;u0 lerxoctotomt lues (0 etrxo3oo1omee feslsfa2tm(rpot1apto iciaslm uauvp;(4alxnxr3iydfat  uvolt0 exrimpnu1olen fviat)sDrmumoot4ale  ieiyd aDrmumpnt0 lerxo iadop rlivs;()tetoxmpio1lp n ivs t)sDur(rp;o4tle  f3iadls uluvpnu0 ltrio oy1laDeaies (  etoxm3no1lpee icsas  2ra(mo;o0oexnifetys mDemn o;(4 eenio3tadfaDran o;s0t2xrxr nodoltnlfvtatfarur(roou1apeoif3tatfmDel(vp u4tlxnmr3ty1oa r nvi s0t2xrio ou1om nlfcs t)sDrrx  ;t1tleo o3tld aDranvon(0artoir3tydlaD ln s;t)s2toim nudalt  ivta(fa2umump;t1tlxnmf3iaslm umu o;u0alenxrciatlaDelnei;(  2xoir ny4lp nlietl(fsDurur nt4tee mfeilsls ua(ms (0texrxf oo1la elues;s)trum(r oo4olt lici s s2tmumo;o1tptomfciat m ean pn()aeeoxfciadlm  livol(0seuoim3oy4aptelfctl(  rum(mooo0aee io3iyt m2ra(mo (0tetnir io1latr nes;(0s2uoio ny1am n fes (f 2trxr nt0tlenio3tytls rauvo u)trxnxrcootlmDeluvo;t) rxmxo3iy1lmt  ics sfsrraxrp;o0tee iociat mDeanmp (4 eeomfciatlat lu o;()setoxrpiydlm nmicsasfarra(ront0tet  feiad s ua(ms t)texoxf3oytlmDrai s;(  2toxo ou1omte fetlt srtru o;t0tpxnmfctadlaDeau s ()tlenio3tytfm  livs;()seum(m iu4omtemneslt)s2rr(rpou4aexoiictadlaDrlums;u) ltrxfctytfmD lueolt0trxmxm3iudam nmies () 2taxrpnt1oetnifeiasfa2rl(vs;t4tetrxr todom eliei s)setr(mpio4am   ictlt a2uaxr ;t1tlxomfciltlsDuan pnt0teeriociatfa  anes;s)srtmxm nu4om e fcta(faDua( p;u0tptoifetydla eanvs ()trerircoa1oa raneo t0seurim oydll emfct s srtmxr oo0tpeo iciltlaDean p;(0arenxf oodoaDeaneil(  rum(rpoydapeelnci tf Drrx pou1apto oeildlsDuauvs u)aetrmo oadfpt  ueils  exmxr3ou4lp emnei t s2uaxmpoo0olt  oetydlm uanms t0 lxnxfciydlptraieil( s2urio ny1lmeelnvs t)arumuro;o4tetn oetlsla elumpnu0 rtnirctatlmt  neo t trum(r io1omeelncs () 2ta( p;t0tle if3ias a ulnmon()altnmrctotoa  lneil(0sexmxm ou1lmee fciltfs2raxmo;o4ape mictysls2rmnmp;t4 ltoxocio1fpDr ivi (0 rumxo ou1openlivslsfarrr(  ;t1tpto fctasfa2rmu p;(4trtnxrcoadlptr ieils)trtoim oudap n fetasfsDtmu poo1oee mfciasfm rlnmo u0altnxf totlat luvi;s)s2to(r nudlmeelfetas aDra(  ou4altomoeiadls2emn p;()altnxfciadlmt  ueo ( s2xrxm3no1olenlnvi tfsrumxr ;o1olxnif3ias a ulumsn()texnxfcio1om raieo t) 2xmxmpiudlp n nviatf rrm(r oo0oexnii3tlslmDuan p;u)altnir tydom ean o s0srxoxm3iy1llenlfei s srumxmooo1tex io3ildla rm( pnt)tlenxo ty1faD  uvs;()t2umimpou1om nmicsa( s2raumoot0tpxnmictltfsDraumont4tltoio iatoaD li o t)texrio3iu1ole mics t)aDrrx pnt4oeeoif3iyd m uluvs;t4aexnxr tydfmtranvs;()t2xm(rpiudll elncta( sDurx p;t4alto i3ildlm rlu p u0arenir3oy1fmDranvsls)trtmxm3nu1lle lnetl()arraxrpot1aee if3iltfs el(mpnt4 eeoxo3oa1fmDrluvs t0 2to(o3oy1lmtnlnvta(f rtrump;u0aex mo3tltfsDrmnms;(4treoxfcia1fp eaueo t t2xo(m3iy4al nliesas s2tru  ot4apx if3tls mDumnvsnu0texrmr3oo1omt lnvs;() rurxr3no1lmeelietas)s2uau ont0tlto octadfs uan o;(0artrirctatoa r ues t)t2tr(r3nudolt mfciltfaDtaxmo;u4oleomoctas s umnms;u)teenif iydfpt li sl( trtm(o3iu1ape  netls a2ta( p;o4texnmoetadfs2rmu sn(0aexrmo iotoaDe i ilt) rtrio iydlp  lfes s  ruau ono4apt mo3iyt sDrl(vs u4tlxnmfcia1fmD  n sls0 ruoir3iydape  fetlt aDumurooo1oee  iciaslm2rmnmpnu)aexomr3oo1om rlivs (0s2xr(o iu4al nmfcsas)a2rmuroou0aee iociad sDuau p;u0aexrifcta1lptrau o;t0srxoiopno4op n ieta( sDraxmpnu4tetnmiciltlmDrmnmo (4tetnif3iotopt  u sl(0 rtr(mpiy4lme  fci s)a2rmxr oo1olxo i3ilt s rmuvp (4 rxrxrciy1fmDrliesl() 2urim3oo4ope  fvtls srrm(mooo0texnmoeildlaDrlnmpn(4trxnir oadlptrlnvo;s0srurimpnydllt mfvta(  Dur(r nu0oexo iciatlm rlnvpnt4tltrxrcty1lmtrlieslt)s2to(rpiu1lleemics t)aruax p;o1olx mi3iat mDea( p (4tltnxr iotlp r uvo;(0 rxmim3no4llte ici s aDurxroou1aexnmf3tys a umnvo (4aexoxf3iadlatr n il()trtoxo3oodape mfctlsf Dtrxmpot4alto fciydla2ulump (0texrio tatlm r ivo ( t2ur(m iudom elfvsa(f 2rmxro;o4aeeomiciyt m ulumonu)trerxf totfa rlneils0srxoirpiy4ol   nvilsf 2ra(ro;o4olx  oeiasls emnmp (4altnirciodfpDeln slt)s2xoiopiudomeelfesasfsDtax pnu0tptnii3iad s umn s ()aeenif oy1op raues;t) 2umim oy4ale miciasf Dta(r ot4tlx  i3iyt sDrm(mo;u0artrxr3tadfp r neolt0 exoxrpiy1llt licsat s2tm(mooo1tptniiciltlm eauvo;(0tlerxo ty1omDelnei ()trumir oydll n ici ( s2rau pnu1opxoif3tldfmDrluvsnt0treoxo oo1lmDrluvsls t2uriopou4op emfvils a2umxm ;o1opt  feildfsDelump;(0tltoir oatomDeliei t teurxo3oodole lfcta()sDrr(rono4optnmociltlm2em(vpnu)tlenifcoydop eaueilt)texoio3nydomen fei t  2rrxroou4opx mfciasfs2rlums (4arenxo3ootfp eauei;t  rxo(rpoydome lfvs ( srtaxmpou4alx mfciyd m rl( p;u4 eeniociytopt lneo t0t2xo(opiy4lle  fvsls sDta(mp;t0tptomociydfaDumuvp t)arxnxr3ty1fp r n sls0 etoxr3io4altnlfesa(fa2tmu oot4tpxoiietys sDrmuvs;(4 lxomf3totlatelnei;( trtm(r3io1ol n ivsat) 2uaumooo0tpeoif3iydfs2el(mpnu0aexniocoo1omt  ues;()s2urxm3oy1ame mietltf 2urxr nu4alen ieiat a emnvpn() lermfcto1op eli sl() rxmxo3ny4altelfcilt  Dum(  ;u4oex iictldls2ranvp (0arxrif3iodopDrai o;s0t2toir nydol  mfvta(farrmuronu1oexnmicilt mDea(ms t)aexnxf iy1lmDe nvi ( texrir iu1amtnlict s  Dra( ono1ale  i3iytls rl(vo u4aetrxf oytfpDeauvs t srxoxrpoodomen ivia(fsDur( oou0oltoiictls sDumnmsnt) exnmociy1lp rli o;() ruoxopnydomt  nctatfs2umump;o4tpe  ictadls2rl( o (0 lerxrcootoa rlu s t) 2uriopoo4ll nmneslt  Dur(rpot1tpx mfetadfaDrmnvsnu4tltomo3iy1lm eai o s) exm(m3nu4lmt mivil()aruaum oo4aetoioetlt a uauvont) etrmo oa1omte i o;t  euoxr ny4olt mivs s)sDtmxr ou4oee ioetltfaDea(msnu4aetoio oydoaD  nvo t0texo(opio1optnmfctatfa2taxrpno1oleo oeiasfs umuvpn(4altomr3ootfptr u o;s  2xo(rpiudamen ieslt) 2tmxm ot4oltniiciasla um(msnt0trtrircoodoa eluvs;s) 2trxm3nydlp elfcia(  rtaumpoo4aptomo3ild m2ul( o t)aexrif3io1laDe ieols) rurxrpnodamt lncsas)srtru  ;t0aeto ociltfm2rm(mp;(4 rtnxo3iatop r i o;( t2xoio iu1openmfet tfa2uaur ou4alto ieiyslaDea(vo u0trxrmr tadfmD ln ols0s2trxo3no4apenlnvsat a2rmuronu4apenii3taslm2uanmsnu0trxnmo tatlpDraies (  etm(m iodllen fcils)aruaurpoo1aetnmiciytfmDea( o;u0trxoxf io1opDeluvi;s)teurxr oodlm  miei t)aDtaur ot1tlt  f3iydfm2eanms t0 exnxo3oatomD  i s (  rtmim3oo4ape micsl()a2tmurpno4aeenioetys sDeluvp;t4teerxf tatomDeluvs t)sruoim3oo4opt lietlsfsDum(mooo1tlxo f3iatfm2umums;() rtrxf oytlaDr u s ( t2uoir iu1ap  lnvia(faDrmumo;o0oexn oeild s2ean s t0alermr3oa1lmDeanvs;s  rtrimpnu4lp emicsl()s2ua(m nt4tltnmi3iasfs rmumsnu)trenmf tydlat lieils0setrir oy4lmtn ncsa(f 2rm(m ot4oltoifetasls ua(vs (4arenmf3tytop rlnvs t  exoio oy1lmenlics ( s2tax p;u4tpen iciysla ulumsn(4trtniocoydlm   u i;t)texoxo3io1opeelfcil()aDumumpno0texnif3ilt m rm(mp u)aeeoirciodopt  nvol()t2xmxrpno4lle mfetasfsDtaumpno0tlx mociatfs rm(vsnu)tlerir oy1lptrlu ils0s2xrxmpio1ol n neta(  2tr(r nu0optnifeiasfa2ul(mo t4alxrxfcia1laDrlueol(0 rur(o iy1lp nlncta(f 2um(r ot1apx  icils s2rauvp (4arxoio3io1lmD aies;t0 2uriopou1omt  ncsls aDrax ono0oex  o3ilt sDua(vonu4altoxrcoatfmtrliei;()sruo(rpiu1om   iciatf 2ta(mo;t1altniieiltlm2elnmp;(4 rxrif3oodop eanei;t  rxm(r oydamtnmnei ()aDuru onu1alenif3iaslaDrauvp u) exoio iydfm eauvo t texo(r3nu4llt  fcsatfsrta(  ou1olxoiicildlsDel( pn(0 rermo totlpte iesl( srtoim3ny4lpe  ieilt aDtmx o;u0oet ifciltfa ranvont)areoxr3iatomteai ilt0sexo(m3no4aptnlnvs sfartm(mpot1altomociysfs2rl(vs;t4teenif3ia1op r ivslt) 2tmxo iodomenmnct tfsrrr( p;t4aet mociydfmDel( sn(0artnxfcoadoatraies (0trxo(m3io1lltnmfcils)srtm( p;t1apxnioeild s umnmsnt4trerifctytfpt aivs;s  etrim ny1lp e fvi tfaruru  ot4teeomfciltfaDea(mo;u)alerxr3to1oaDeauvs t0t2tmim3iydom nlivt s arrmu ont0tlenifciasfs rlnmsnu)tlenxr ty1fm elneilt trxmir3iy1ope  ivsltfartax o;u4tetnioetydfa rlnvp;u)arenircoadop eai olt0t2urim oo4alee iet ()sDrm(mpot1opxniiciyd mDea(mo t)tlenif tadoa rauvo t0 eurxm nu4ape mncils srtrx  ot0apxoii3tlt aDemu p;t0 lxoxf3ia1lmtr ieil(  exr(r nu1ol  lncta() 2tmu  ;u0oleoio3ias s2ranmo t0areomrciatfaD lnvi t0 rtm(rpno4op nmfvs s) 2uaxm oo4tpe  f3ils s2rmnmo;u4trxrifciytlm  ai s;s)sexoiopiy4lp   fes (fsDur(ro;u1tle moeiyt s raumsn(4 lenxr oodlpte iei t0 rumir oy4omenlfvta(  2raumpnu4tlxomf3tyd mDua( s;t4 lerircoo1fmt lnvs s) 2xo(r iy1apeemnci () 2ur( oot4altoioetysla2umn o u)tlxrxr to1fmt  u o t0t2uoxr3iu4lptnmicsltf 2uru  ou0oleomociydlaDeanms t0tlxniocoodfpte n i;t texm(r3ny4ome lieilt aDuaumono4aetoii3ilt s ra(vo u)teenircoytfmtean sls srtrir nydoleelivsl(fsDrmxmo;t0alenmieias sDrm( on(4aeenxf oadfaDeaneo;t trurxmpio1al n nvi t arrr(m ou4optomicilsla uan p;(0altnmr iy1om r u i (  exoir3oodlmenlivsas  rraxmpnt1apt mo3tls m rau p u4aeeomrcia1fat ai o;t)setoxm3io1ap  miei t) rurx ont0oetn o3iltfaDrlums;t4 lxomf3ty1fa  livo (0trto(rpou1ap   ietat)aDurx p;o0oltnmictytfaDrauvo () lxrmociadfp  lu ols0 ruoxr oudap emnvtl(faruaxroot0oetnmieiysfmDum(vont4artnxr3iydla elies t)trtr(m oy1omen nes (faDumx  nt4olenmo3tyd aDea(vs;()aexnxo3ty1latr n o;( seumio nudopt mnet (fa2rrxmonu0tpe moetasfs eln o;t)tetnxf ootoaDrlieo (0texr(m ou4llte ict tf rumxrpot4oeeo oeiysfmDemuvonu)artrxfciotlate nei;()t2toxrpoo4op elnes s  2uaump;o0apxo ocilt s2ranvp;u4tlenio tatfaDe uvilt)t2umxm3oo4olte fvsls) Drax  ;t1tptn f3iatfs2elumo u0tleoio3oa1fpteauvo t  etoir3iy4omeemiei tfs2raxm nu4ole moeiys sDel(mp ()tleoxf3ty1fmteluvils t2ur(opiodomee fcs ()s2rrurono4opt io3iytfm rlums t4trxoxf3oydfa eanvols  2urxm io4lle lfct tfaDtax oot4oex if3tasfa ul( pnt0 leoiocio1om eluvilt srto(r nudapte nvils) rra(  ot4tlt ifciydfm2rln pnt) lenxfctatlptrlieils  rxoxmpio4lp nmncilt sDrm(mo;u0aeeoioeiysfaDrlums ()trtnmrcoo1lmDelneo s)t2xoxo iudapt mivt t aruax  oo0ole iiciasfm2rmu snu) lenif3tytfm r neslt) rxoxm ou1lp emictl()aDtax o;o0oeeo icilsfm2umuvp;t4artoifcoy1lp r nvo;s0seumxo3nu1lpt mnvt (fsDuaxm ;o0oex  oeiasfm eau pnt) renirciodfp r uvi s  rto(r oo1apen icta(fsrta(mp;u1ape  ietytls rl(mo;()aetnxfcto1omtr ues;t)s2toxopno4al emnct t  2uru ono4aeto oetatfs raumsnt4aeenxr iadomDelnvil()sexrxm iudaptn nvtls sDuaxm oo1teen o3tad s elumo ()tlxrxo todopt lu i;(0 2tmxm oo1amtelnetat aDrrum nu1aee miciysfmDrmn p u4 reomrctadfa eau o;s) 2xo(r3iu4omtemncta(f rtmumooo4ole mf3ilslm emn pnt) lxomocoatfp eln s;( texo(m nydllen nvs s  Drrur oo0aex  oeiaslaDum( pn(4tetomocootopD lu s;t srum(o3iodlpt  nes t)s2urumont1oleoii3tldfm2ul(vp t)tltnxf io1la eaivs;s0sexo(mpoy1ope  fvtlt  2ra(ro;o1tptnmo3iys s2uauvp;t4aetnircootfpD lneo t0 2um(opoy1ol elfctls  Duaxrpnt4opt mi3iat mDrmnmpnt4 eermo oytopD aieil(0 exo(o nu1ape  fcs tfsDrrxr nu4optnio3iasfs2elnvon(0alxrxf3oodlpDe neo;s)s2umim3ou4lpteliei ()sDrm(rpot4apxn ietldlm2el(mo;(0 rtrxfcia1fpD lu ol()texoxrpiu4lme lncils aDta(m oo4tle  fctadls2ulu on(4trtrmo oatopDr n sls  exmxm oy4lltnlieta()arumumooo1tle ii3iytlmDrln s u0tlxoxo3iydfp eln ol( s2tmxopny4alenmnvsl(faDuaurpot4oeto ociat mDrauvo;t0texoxf totlaD an ils0srtr(mpiodll nmivtl() Dtrur ot4optnmf3ild aDuaums;(4 rtrmfcoy1lm   nes t)trur(o3iu4lmtnlnes ( arum(  oo1oee  oeild m rln p;(4 lermfciytfmDe ues;() etm(m3nu4om elicsl(f ruaxm ;u1openmf3iat aDuluvo u4aleoio3io1fa ranei t  2urimpiudapenlnvsas)aDra(monu1tpenmf3iydlaDemnmo (0tltnmoctodomt lu s;t0 euriopnodlm nlictas sDtmxmp;u4oeenmo3taslm2raumsn() exnmfctadlm  ln o (0srtr(mpoydal nmfvsltfsDrrurooo1apt iieiys m rlump t)aleomr iatlm e uvs t0teum(m3io4omenlfeta(fsrumu pnu4oetnmietldls2rlu p u0trtrmf iy1op e u sl( t2xrxr oy1lmt mnetl()a2raxmp;o0olx mietls mDel( pn(4trxnxoctodlmtrluvs s)sexoxrpiydomeemivil(fsDrmxront1tlenioetatla ea(vo;u4tltniocoy1optrlneo;( setoio oudalt lies t sDtm(m nt1tltn oeiatlmDea(vs t)altomo3oodfa r n o s teumxmpno1om e ies ()a2umxr nu0tpe ifciatla2ul( pnu4trenifcia1lpDran i;()trtm(r3no4ame livtlsfa2ra(  nu4open icilt m eau p ()arermr3iodop eauvols0trxmir no4optelivil(fs2tr(m ;u0ole mfctysls el(mp;() rxnmf3tadla  anvo;s  exr(mpio1oleemncs s  rumurpnu4oee  ictls s2rmnmsnt0 eenmo tadfat auei;( t2uo(m3no1ll elnvia(faDua( o;o0optnio3taslmDemumpn()tltnxr oy1lm eluvs t)t2tm(mpiy4opee ics t) rtm(rpot4oet  ocils sDua(mo u0 ltrifciytomt  ivi;(0trtoim3nu4apte fet ( artr(r oo0teeo ociydfmDuaums;(4 rxrxr3totopDe i ilt)srurxrpnu4omte fvsltfs2uaur no4optnifeiytlm elumo;t4teenxr3oatomD  i sl( srtrxmpiydamt  iet tfsDtau  ;o1tpxoif3iydlsDul( o t4 ltrxo3oydla r uvi ( truo(m3nodoptemnesl(  Dtmxmp;t4ope  f3tyd m rau snu0aexnif ty1fmtrlnei;()t2xrxr nu1lptnmnvt tfsrtrur ;o1tptomietys a umumpn(4artoifcoydoa r ieo (  2toxm oy4lpt  neilsf 2rmur ot0tpt io3iys aDeauvo;u)tlenmo tytfm  aieil(0t2umxr3nodomenlics (faDuru p;t4tpt mfeilt a rm(ms (0texrir3ta1lm eanvi ( t2xmxo3oudope lnesls)arrm(mpou0apxn f3ilsfs2ulumo;t4alxomfcio1laDeauvsls0seumxr ny1olte fesl( aDtm( pou4aleomfetlt a rlnvo;t0 eenxrcty1op raiei t) 2uo(r3io4op elfvsat a2taumooo1olxniocils s2umuvon(4 leoif iadoptr ivi;t) etrir3ou4ol n nvsa(f 2rmurpnt4tpx  ietltlmDeanmsn()teenmf todfp e ivo;t texmirpnydam emiviat)arurx onu4oltn f3iadls2ra(vsnu)arxoxo3iydlp  auvilt t2urio3iudalt mfeils aDuau  ;t1tlxnmicils m uau snu)tlxoir3tadlmte uvi;( trto(m nu4llt lict sfsrrm(  no0tpx ifeiasfm2el( s;t4 lxrxr ty1lmDe uvo (0 2toxopno4al  lneil( aDrr(monu0tltoioetyslaDrlnms;(4 etnxociy1fp ranes;t s2tm(o3nodll elics tf Drm(ro;t0apeoioeilt a2ranmo t0 exrio3oo1lmtelneo;s)tetm(r iy1om e ieiatf Drmxr no0tlen fctas s emu p;u4altrio iydlptr u slt0sruriopno1lmen fvtasf 2tax oou0oleo fetatfm2rmuvo;(4alxomociy1fate n olt) 2uo(r iy4ol  lict s arrmxroot0oetomi3iatla rmnmpnt4aetnmf ta1faDelneolt  2xm(r3no1alt  fvilt)sDuaxmpoo1altomi3iyt aDuau pnu)trtrmf3oo1fat  nvs;(  2um(o3nydol n ietat  rtaur nu4apt mo3tas s2em( snt0 ltrmf tydfmt livo t s2trir oo4ole lfei sf rtmu  ;t1aptoifciltls eln o;()altnirciatlpt liei;t0t2xmiopiy1olt  fvtl( sDra(mpot1tpxnmfetlsfsDumnvsnu0alerxf3tadfmt lieo;(0 2urxopiodol emfvtls)s2uax o;u1ole iiciatfa2ra( snt)trenmf tatoa e i s (  2umim3nu1ol emfes ()s2umuro;o0tpenmfeiltfmDrlnvo;t)texnmf3oa1oaDe i o t0 etmir3nu1olt micia(f Durum nt1optn o3tlt aDrmu sn()trtoio ta1oaDrai il()s2um(r io4ap e feil(  2uax  no0tlxoifciydlm2emu p;(0 rxrmocoydomt liesl(0srxm(o3iy1ale lnct sfaDrm(m nt0apxomiciasfa um(mont4 etnxo iadoa eau ils)s2umirpnu1lmt liviatfarurxrooo0texnio3iytlm em( snu0altrxo3io1op raivi;(  exmio nydole lnvtltf 2taxr ;t4apeomi3ilt m elumo;t) etnmo3oa1laDr i o;t)setoxo3io1lme lneil(  rrmu pou0tlt mo3ias a2el(vsn() exrmfcoadlaDr nvi;s  rtmio io4olen feslsfs2rau p;o1alto ociys a2um(vp () rtrxfcoy1fatelnvilt srumim3oodllt  nesls aruax pnt4aee  oeiytfm2eau ont) etoif iadla e nvs;t0 etrxmpny1ll nmfes t sDtrx p;t4oee  iciatfa2raumsnt4trtnxfcia1op rlu o s) 2uoxo3iu4ap e fvtlt)aDrmump;t0tetniicildfa eln o ()tetnio3iodop rlu i;s)trurio ny4llt mfetat)sDtru  nt4oetoio3iytls2ul(vo u0trxrmf3iatoa eaiei t0 rxr(rpnudamtnlivtls)aDrm( onu4altomietldfsDrm(mont0texoxo3todfpDe uvi;s0t2tmxr oo4olenlfcilt) 2tm(r ou0aetnmfeiatlm rln snt4texrifctydfmtr ivs;t0 rxrio oo1aleemivtlt)aDtaxmo;o0apxnifetls m2emnms t) reomo3ta1lmtr n o s t2uoio3oo1ll nmicsa()aDtmurpot4apen iciyt s elu ont0aexrmfcoo1fpDe ivol(  eumxm3ny1ol emfcia(fs2rm(ro;o0aeeniocilslm ran pnt0arxoxfcoatla e uvsls)tetoxr nu4lptemnvia()srrm(  ou1oex  ieiyt m2ra(ms;()tetomfctytomDelnvo;()texrxo3iy4alt  fetas srrmump;o4apeoiicilslmDuauvsnu4aetrio ootfaDrlivo;() 2umim no1lpeelivilt) Draur ;u4tetoiocilsls2eanmonu)alermr3iatlmD li ol( setm(mpoo4omte ict t)aruaxrpoo4ope iiciadla rluvp u4trxoxocoo1fmt aiesls teto(m3oy4apt  fciltfsDumur no4tlen fetlslm um(ms;(4artoir3todlat anvil()tetrxmpiydapeemneslt  rum(  nu0teenmfeiadfm2ul(vsn(4tetrxo tatfmt lies t0 etoir oudoptelicsat srrr(mp;t1ole  ieiatfaDrluvsnt4tlenxo iydomDrai sls)setoir3io4amt  nct ()s2um(m nu4openif3ils sDean s;t)trxrxo3iytfpteau ols)srxrxm3io4al e ieia(fsrrmu poo1oeeomfciasfsDuln p;t4aeeomrcoy1la eli i;t)s2toiopoudaptelivsas aDum(rp;t1optomociyd m ua(msnt0 rxrir ty1fa   uvs;() eto(mpio4olen nvilt  2trxm ;u4oexoifeilsls emn pn()arxrmocio1oaD anei;s)s2trxm3iy4llt lfvilt)sDtmum nu4olxo i3ildfm2umumo;t)trxnxf3ia1fmt aieo;(0s2xrxo nodlpt lfeiat a2umu pnu4oee ioetadfa rmu p;t4 renxf3ty1laD aivil( setoxmpoo4lmte ivia(fsrrmxmonu0teto i3tasls2ul(mont4tltrif oo1la   i ol(  exm(o io1lme mivi t)srrrumooo4tlt mi3iydlaDrm( o;()teerxr3tydoa e nei ( t2uoirpiy1lleemivt t) rta(r ;o1oet iociltls2ul(msn()arxnxo3iotoptrai ilt0teurir3iudlmt  iesasf 2tm(  no4altnmiciatlsDelums u0 rtrircoatopDelieo;t  rtr(opnu4ap emfvi ( a2tmu o;u0apenioeiydfa2ea(ms;(0 eenxo ia1latrli o;t) 2trir3iy4olte fei t)srrmxmonu4tlxn ietltls elnvo;(0aetoioctydop rlivo;(  rto(mpno1amtnlncils a2ua(  oo1olt mfciyt mDemnmo u0trtoxocoatfatrlu o;s0srumxrpio1lmtemictatf Dtmumpou4apx  fctasfs2uauvs;t0 reoxo iatfpD anei s)seuoxr oo1om nlietlt arurum no4ope mf3tytfs2ul(monu0tltnmocta1om   neo;()sexr(rpnu1lltn nei t)artrx ont4opt ifeiadlaDraumsnt4artrmfctadlm rlnes t trurir3nudlptnliesls s2rr(roou0alt if3ilslsDrlnvo;t) ltrxo ia1fmte nei s0sexmio3ou4lptemics () rrm(  ;u1olt  octasls2elumpnt)areomf totfm e uvo s0seumiopoydamt mnvtlt s2tm(mp;o4oeeoifciaslmDeln pn()arxoio3oodlmt ai i;t trxmxr3oodlleelictatfsDumumo;o0tpen ietls a elnvp u4aeeoirctydomt  i o t0 rxoio iu1lm  lfcil( sDtmxm ;o1oex ifciydlm2emumpnt0trenxo3ty1omteauei s)trxrio3iydal emfcilt s2rr(r nt0oltoioeildla em(mo t0trenif3totlpDrli o t)tetoir3oo1om elfesl()srra(mp;o4olx  oeiyd mDul(von(4aleoxo3ta1fa   nesl(0 etmio3iudalte ictls)s2rru  no0oetoiiciyd m2rl(vp;()trtoxfcoodlate uvils  eur(o3iy1oltn fvs (  rrru pot4oex iictltlm2elums;t0texnio iotom e n o t) 2xr(opny4llenlnciat arrmump;t4tptnmieiyt s ra(msnt4tlxrir tydfa rau s (  rxr(rpny4ame  fei () rtrxrpnt1aleomoctysfm elnmsnt0alenmocio1lmDean ilt)trxmxr nydlmen fetls  Dumur ;u1alxoiieilsfa2rm(vs;u) etoiocia1omDrlivs;t0 eur(r3nu1omenlieta(fsDurum nt4tleo f3tyd m2ulumon(4altnmociytlpte uvs t0 rtoirpiy1alt  fcsl(  Dtr(r nt4tlt ioctadls rlnmsnu0texnmf oydom rlieol(0 rtoxo ou1altnmies (  2uaxm ;u1tetoii3iaslsDrauvpnt0trenxf tadfm eln s;()seto(m3oo1openlietat)s2rrxrpnt4tleo f3iytls uluvo;(0tleoir3iotop rli i t  2trir3no1altemfeta()aDtr( oot1openmociysfa2elu o;u) leoir iadom rluvs;t s2xoio3oodaltn nct (f rta(roou0ope mf3iadfsDum(vo u4trerxr3iotop eln i (  rumimpiudame lnes s) rtrum ;t1tpeoifciadfs2uanvpnt)artrifcoytfa   uvi;s0seuoxo3oydlmenmfesl()artax pnt1tptnioctat s2emumonu0texomf oodfmDraivilt)tetmir oydam e ncsatf 2urx  nu1oleo f3iasla2emuvp t0trtrir iodlaDe neol( s2to(opnodllt liesl( a2rruroou1aexoiictad s2em(vo t)teerif3ootom ean o;t) euoirpio1lm  licsl( artrurpoo1opt moetls s2emn p t0 ltrxr3totfa elnvils)trumxo3iodam n feilt)aDumx o;t4tlen o3ilsfa2ul(mp;()arxnxo3to1lm eauvils t2trxo3oodoptnmnvslsf 2urxmpoo0olt mictld m umnvsn(0arermf oadfp  auvo t0t2uriopnu4am emnct t)s2taxmo;o0optnifetlslm2rmu o;u4aetnir3iydop eanesl( s2xrim3ny1optelfvtl( s2tmur oo4tltn ociatfa rln pnt)aetomocta1laDelu o s seuo(m no4amt licsatfs2rm( p;o0tpx  o3tydlmDumuvp t4teenio iodop  ln o s) etr(o iu1ll n iei t)srtm(  ;o0tpenifciyd aDrl( o;t0 exomfcty1om r nesl(0setrxm oudlpenlicil(fartrxmp;u1altnifeiyt s emums u0 reomo totom eln sl(0t2xr(mpno1ape  nvta(faDtmum ;t0aptomf3iad a uaump;t0texrmrcoatopDraies;s0tetoxr3iy4lmt lfei s sDur(mpou4opt  o3iydfmDel( s u4 rtrxociydfmtr n ilt)texmxopiu1llenlict t arurxm oo0tltn oeiyt sDelu s;u4aexrir3tydfmD lnei ( s2xm(mpoy4am e ivsa( s2uru  no4aetomfeiatfaDrlu p;u)tlenxf iotfmDrai s ( teumxrpiy1llt  nesls)srtmxmp;t4tpx mociasfs2el( s;(4artoio3ta1oatrauvs s) rxr(opnudomtemivias s2um(ro;t0oleoifetadfsDran on() rxoxr ta1oat  nvo s  2xmxm iydlmt mnesatf 2ra( o;t0apeniictasfs ul(vp (4 ltrio3oytopDean ol(0 2uriopnodll  lfvtatf 2raum oo0tlt ii3iydla2uan p;(0aeenir3ia1lmtrauvi;(0 rtmxmpnu1amee fei ( arrmxmp;o0olxoio3tytlsDua( s () rxoio3oo1la raivo;s)s2umxo3iu1optnlieslsfsDta(rp;t4alxomfctasls2ua( s t)aeerxf3todfp  luvi s0 eur(m nu4llenmfeias)aDtrxrpoo0apxo iciasfsDeanmo;u0aeeoxr3oo1oa raieil(0trtoxr3ou4ole mnetas)sDtrurooo1openifciadlm2emnvs (0 etrif oo1lmD lnes;t0s2umio3io1amte neil()arururp;t0alen feiysla umnvp;(0 rxnmf iytlm  lnei ()trxoxm3no4ol n icta() Draxrp;o0tex  feils mDulnvs u0aexnio3iotop eauvs;t)srum(r ou4omee nei sfarrm(r ;o4oexn oeildfmDran snt)aexrif3oodlaDe ieslt  2to(mpiydopt lfctas sDrmum nu0oetn f3iltfsDrlnvsnu)arenmo3iotlmD  uvo t srum(opnudlleemneil(  rrm(m ot0olxomieiadfs2uaumpnu0 leoxf oatla eln o;() 2urxr iu1omenmivsasfa2trxm ou1tlto oeiydfsDra(mo;() rtnif tadoptr uvol( tetoxm3iydlme  net s)sDraxro;t0ole ifciysfa rl(vo t)trermr3ta1lpD aneo;s0 exr(rpnydole mnesa(fsDtmx oot4tpe  o3tadfsDean s (0 renmf3oy1fmt lnvols0s2tm(mpio1ol elnetlt artm(  ot4alenmoeiyd m2ean s ()texrxf3tydopt an slt seumimpnu1ale  iciat sDtrxr nt1olx if3ilslm uaums t4tlxrioctadoa r i o s0tetrxopio4apt  fcsa(  rrru pnu1aptn fctas a rm(vonu0altrxoctodfmte n s ()s2ur(opnu1lme lict s)artaxmp;o1tltn fciaslm emn o u)trtomrctatla eai ilt0srxr(o nodlme lnesa(f rrmurp;u0tptoii3tatlsDumuvs ()altnxfcoa1lptrliei;t0trtrxo io1op elies s aDurur ;o0teenmf3ild aDemumont0 etrxo3tadfmt an s ()trxr(rpoo4ol emnct sf 2rmu pnt0aptomieias s2emu p;t0 ltnmf3oo1lpD ln o (  2tmxo3ou1altnlivi t sDua(mooo0olto ietatfsDel(vsnu0arxoir tatfp   u s;t0 2umir3nu1lp e fetlt)artrurpou0opx ioeildlsDrau p;(0trxnircoy1fpDelnvo t0srxo(r3oo4aleelfes ()artaump;u4ope mfctyt aDuanvsnu4treoif3iytoa rlneo;(0seum(m3iodlpe mfvtlt)aDumx oou0oltomo3tyt s2ranvp;(4altnifcoatlaDeluei;s) 2xm(r nodomtelfvsa() 2ua( o;o0texo octatlaDrm(von(0alermr3ootomtrliesl()texmiopny4ol  lfcsa()aDrrxrp;o1apt  ociydfs raumsn(4tltrxf3totom  aieils0 2to(m3oy4ll nmiesls)a2taxr ot4optniociytlm rl(mo u) rtoxo iytoaD aivils) etrxo3oy4op e ncilt arrmx p;t1tex  iciyt sDumu pnu0alxoifcoytop r u s s0sexrxm io4al emnetlt  2rr( p;o0teeomfctyt s2umn o;(0alxrxociotlmDr ivo;(0s2xmxopnu1lmtelnei t) Dua(m ;u0opt ioctadlmDeaumo;(0teeoif io1la   ies t0t2xo(o3nu4lp  mfesl(fsrrax  nu4olxnmociltls ranvs;t0aexomocto1fateauvs (0seum(r3oo4al  mfetlsfs2tm(moou0oetnmociltlmDemums ()treomf3iydoaD  i i;(0teum(o3iy4oltelfet sfa2rm(mpou1oeeo f3tld m eauvpnu0teerio3tytoa elu s;t0 rxriopnudlmtnlncil(f 2rr(rpno1aeenmoctlsls2ean snu) ltnir ta1om rauesl(0 eurimpnu4lm emfeta(fartr(mo;u0tetomfetadlsDeau s u4aeeoxf todlateai i s  2ur(r nodlltemncta()sDuaumooo0olxomi3tyd sDea(mo u0trtnxocia1fa rln i;s0srumxm3oy1omtnmics (fs2tm( oou0tle iictltla2rmumo;()tlxoxf3ootlmDelivo;s0 exoiopno1aptnlnetatfsrrau  nu0oee iociys s2elu s (0 ltrxo io1fpD lu s;s0 2xmxm oo1lmt lfvslt a2rru  ot0tlx  feias a2umn p t0arenxo iy1laDeli o (0t2tr(m oudop   nct s)a2umum ;t0olxnio3iyd a2em(mpn(4 reoxo tatfm eanei t)teur(rpnu4amtnlfcsl(fa2umur nt4tpxn o3tytls2el(vsn(4treoxr3iatfpt lu sl()teur(opoudapenmfvs t)arur(r nu1tlt ifeilt a rm(vs;() etoxo3oy1fat lueo;t  2xmxr3nodal nlnvs s sDrmxr ou1tltoiictltla ea(vp u)tlermr oo1omteaieo;(0teuoxr3io4op nmnctas)sDumu  oo4openioeiltls2eluvo;t) etoxrcoy1lmDrlu s;()s2umir3oy4lptn ietl()srrmx oot0aexnioetys mDem(ms u4tlxoxfcoatopDeaneo;(0 exrim3ny1op n icia(  rumurpnt1apt ifciatls uluvs t4arenxf3oa1fm r uvs (  eur(o nu4amte ivtlt)arurum ou0tptoiietltfs eln p u)artnmr3iodopD aies ()t2tmxr3no1olt  ivtlt) Dra(  ;u1oleniieiyt mDra(vs;u0trxnmf to1opDe u sl() rxmirpnydllenmnvslt) Dta(m ;t0oet  fciatla el(mp;t4 renmo iydfpt  uvs ()t2urxrpiydlpt  ieilsfaDtm(m oo0altnmfciad a emnms t0artnmociotlat li s;s0seur(o oo4omt mnet tf rrr(rpoo4olx mfeildla ulu sn()trxomr ta1om rauvo ( sexo(o3ou4lmeemivtlsfarta(rpot1oexoioeiltlmDuauvs (0arermr3iatlpDeli o ()srxmiopio4apeemici tf Dta(r ot0aptnmi3ildls2em( pnt0aexoxr iadfat  nvil( t2tmimpiydol nmivilt) rtau pnu4altn o3iydls umn pnt)teenxo oodoa r ueo;s)trtmiopou4lpe mfcs sfarraxmpnu0ale mf3ilsfs emn o;() rtrxocoatla r n ils0 rtrxopiodome mics t)s2ur( ooo4apeoif3tydla ua( on(0artnmocoytopt  ivs t srtrir oy4lptnlnvil(faDrrx p;u0ape  fciyd m2ean ont) exrxf3iatoa   ivo s)s2xmxmpoudlmenmfviatfsrtrxmp;t1opt iociat a2um( s;(0teerxr3oydoaDe ues s0 etmir nu4op nmicsl(fa2umumono4tpx  oetys aDrluvs t4treomf3ia1oat li ol(0s2uoir oy4am   fct s)s2raum ;u1aex  i3iysfsDeanvpnt)tetnxfcoy1omDeanvo;(  2trxo oodapt  ncsat  Dumumono4tpeoifeias a rm(mpn(4trxoir ta1fa rln o s)trxoir3iy1lmeelfeiasfsDum(mpno1aexn i3iatla ua(vp u)tetrxf ty1la raivs t)t2tmio3nodlptn nciatf rraur ;u1oleo oeilsfs2el(vs u4 rxoif iadomD lueils t2xo(o3ny4ol emfet s) Draxrp;o1apxomiciad mDumnms;t0 eeoxo tadopt ai o;t) 2uoxo3ny1lleelnetasfs2raxrp;o4alxn octyt s em(mo;(0 lxnmoctytomDe ivil(0 2xrirpnydaltemiei t s2tmur oo0aexnio3ilsls2em(vsnu) rxrmf3iotlaD anei;(  ruoxm oo4lmen fcils)sDurum nt1aptnmf3iltfaDul(mont)aetnxociodlpDrliei ( truoirpoo4olt lnvias s2tru  ot1aee mi3iydla ea( o;t4trxrxo3tadla eauvsl(0seumxo iy4om   fetlt s2uau  oo1opx io3ildfa ra( s;t0trenmf oadfa raivs;(  eumxr nudopt mivt sfa2taxmpnu1teto icilt a ea( on(0 reniociy1opDran sl() rum(o nodome  fvtl( aDrrx  ;t1aetomf3tldls ulnvs t)trenxfcio1oateli ilt0trxr(r3no4ole lnetl( a2um(  ;o1olt io3iat m rl(mp;u) renmrcoo1lp eln s;() 2uo(m3oy1op elfeta()arrr( ono1tee  fctadfmDumnvo (4aexrir oatfpt  n i;( srxo(rpnu4llte fvi t  Dtru  nt4ale  o3tytfsDrlu pn()alxomo3io1oatr ueo s  2xo(m iudapeemieia( srurur ot0texo ieiyt a ranms u0aexrmo3iytfm r ies;s) rxoxmpio4lm nlivtl()srrr( pnt1tex mo3iytlm2ulnvsnu)trenxo3to1op r ivslt0t2uo(o iu1lltn iviltfaDtm(  ou0optomfetyd m2ua(mo;t0texrxr3oydla rluvil()trtrxmpiudlle lnvia(f Drru p;o0opt ifciatla2rmn s;t)trtoxf tadomDeai il()t2um(rpiy1al nmfes t aDrru ooo0opeomfeils a2umnms;(4 rtomr totfp elu sls) 2um(mpno4lp   nvtat  Drmumoot0olx mictldls elu ont0artrir oadop rai s;()s2toiopiu4opee fci (  Dumurp;t1apt mi3tytfaDean o u) etnif oo1opD lieolt) 2um(r3io4ameelieia()a2ta( o;u0tle mo3iyd m ranvont4trtnir oa1fpDean olt0 etmir oy1lpe lnvils) rrrumont1tpxo ociasfs2ulnvo t)areomo ia1lpt an ol( sruoxo iu1ale  fciltfa2trxm ;t0apen i3ils a um(mpn(4 lxnxrcoy1opDrlivi s0trurxr iodol  lnvsls sDtrx  ;t4oltomieiyt m rmuvs;u0tlerif tytfateluvilt  exm(o io4al e fci ()sDur(mp;u4aee mf3tatfm2eaumo;(0 exnir oytfpte nvs;s0seurirpou4lmt lfcils) rtmumo;t1aptn ietlt a ul(vpn(0trerxrcoytomDeauei;s)s2xo(r oydlmeemfesl( arrmu  oo1apen i3tldfm2uanvs ()altnmrciatoa  ln s ( t2trim3io1ole  nei () 2um( ont4oleoiiciatfm2ul(vs u4tetoif oadlp rli i;t)srxrxmpio4op e ncsl()sDur(r ;t0tpto i3ilt s um( snt) eeoif tydfpteli ilt)seum(o3nodlm  mietl()s2raurooo0apenmoetadlm emnvs;(0tlxnxf3iotopD luvils)tetmimpoy1aptemnvt s) rrrum ;t1olen fetas mDea(vont0altrif3iotoptran ol() 2xoxopnu1aleemivsl( aDtrxr nt0optnmfcildfaDrmuvsnt)tlermo tatfptraieslt)s2xr(opoodopeelneiatfa2rr(  ot0opxn ocildla em( s;(4tetnmr3ootop   nvi;s) 2trir3iy1lltemivi t) 2taumonu4oexnmicildfa2ul(mon(0altoxfciodlaDrauvo s0s2tmio3oy4lmenmict s  rtmuront1opxnmo3ils a2um(mp (4trerxf3oadlp r uvi;s0teum(m3iudlleelics ()aDrrx  no0tpeomo3iasfa2eln snu0trenir3io1fp  ln i;t)trumir oydomtnmfeils)aDtmx ooo4oet moeiadlaDum(vs t)tltrmf3iatoatr nvo t) etoim oy4omte nvsls  rrmumpoo4opt ifciasfmDrlu s;u)tltnxo iotfm  lu s;( s2um(rpny4ll nmiesas  ruaxmonu4openmiciatls2eanvo t)aexomo oatla elivs () rxmxrpiy4lpe  ncs tfa2um(rpoo1apxomieiasfsDeauvo u4 ltomf3ootfmDraivils) 2umxm3oydomee nct t)s2uax p;o1texo octldfmDem(vsnt0 etrmo3oytla rli o s) 2uoxr3ou4ope  neils)sDrr(ronu1opxomf3ildlaDrmnvp t4aexnmoctytlaDe nvo;s)t2urim oydlm emiciltfsDtm(m nt4tltnmoeilslaDean snu4 leoiocoa1fmteln sls)t2urxm3io4ole lnes s  rraurpoo4texniiciad sDel(ms;(0 lxoxr3totfmt  n sls0 2urimpoy4op  mivia(f 2tr( pnu0apxo iciadla2eau p u4 reomr3totfmt lu i;s  etoirpoo4lptn fvt sfs2trumoot0apt moeiysfsDulnvon()treoxo3to1omt luvolt0 ruriopno1optemfvtl( arum( o;o0aexnmf3tad aDea( onu4 etomf to1lm  aivils)s2trxo3io1lmt mncil() 2umur oo0aetoio3ias mDeanms u)trxoxo3iytoatelivi;t0s2tr(m3io1ap   nvt sfa2uaxm ou0olxniiciat s2raumo (0 lxrmr3tydfp  luvs t)s2uoxrpny4omenmnvtatfarumxrpot1tlen i3ias s2rmu p;u4 lenif iodlp e uvi;t trtmiopiu1lpe  fcta( a2tau  ou0tpxn ictatlsDuau p;(4 reomr iy1la  livsls0srumiopoy4om  mfcia(faDrmu pnt1tle iieiytlaDran snu0 exrifctatfaDrluvi;()truoxr3nu4am  mncs s)a2um(m ;o0apxomo3iadlsDeauvp u0tlerifcio1laDeluvolt)t2xrxm3iy1lm emivs ( a2tru  nu1tlxn oeiltfm rmumo;() lxrxf3oadfm   nei ( trxr(r3oo1ap   fvsltf 2ua(m oo1apeomo3tad sDeln p (0 rtrif ia1optr nvsl( tetmim3iu1lmtnliei t  2urxrpot1opx io3tlt mDemnmonu)aeeomr oo1lpt  iei;()tetrir3nydopenlfviasfs2uaxm ou0oleo fcias s ra(mpn(0 eenmfciotopDe ivo;t) 2xoio oy4lp e ivi t a2rau pot1aet  feiydls uaumsnt0aeeniocoatfa eaivils)teur(mpoy4lpte nvi s)aDtmur nt0opeoioctys mDra(mo;(0alxoxocoy1omDelnvsls trurxmpnydoltnmfei ( aDuru o;u4olxnifctldfm uaums (0aetnxr io1fa eai s s  eurxr3oodom nlnct tf Drax p;o1aeto i3ias sDel( snt0treomfcio1omtraivo;s sruoxm3iu1lm e ncia(faDum(rpnu0tlen ocildlm2eanvp;t) rxrxf tadlaD  neol(0sexmir3nudom n ncsa( srurumono1aeenmietltfa rmu pnu)aeerxr3oodlateau i ()truoiopiudale mfvtas  rrmxm ;t0oetnifeildls rm(ms;t0trtrxo3iotfatrauvi t tetrxopoy1lm elfcsa()srum( pno0altnmieiyd a2ra(ms u) etoxf3to1faDrlnei t0 ruoxopou1llen nesls aDrr( o;u4opx io3iasla emums;t)tetnmo3iytlpte n s t  euo(r3nodlm nmnci t artrxmp;u1tlxo octyd s2ua( p;(4 eerxf iydfmDr nvi;( tetmxrpiy1ll e ncslt)srtax  ;o0altnmoeiydlmDel(vont0 etnxfcty1om e u s;t setoxm oo1om nmieta( sDtmu  nt1teenmiciaslm2rm(vsnu) lerxo oatop r ies s) 2xo(r ny1lm e ieiat)srtmurono1tetnmfeiyd sDumnms;() rerio iy1op rluvs s s2trio3ny1lmeemfvtlsfartr(rpno1open iciytfs eau o (4 exoxf3oydoaD anvs t)setoim3oydlp  mivsls srum(rpou1tlxoioetyt s elumpnu4aexrxr oytfm   nvilt0 exr(r3nydom e fcils arrmx ono1oexnio3tatfsDuaump u4tleoir oytfptr i olt t2urxmpoy4amtnlfes ()artmumono0tlxoiocilsls2rln pnt4tltrmoctatlmDeli o t)sexr(opoo4ll  lnctl( a2uru o;t4olen f3iytlm em(vs (0alxrif oytopt ln o;s texrxmpiudlme  fes s)aDtmumpoo4altomociltfm2ul( o;t0 eeoio oytlp raivs () rxrimpoudopee feslsfa2uaumpnu1oeenmictydfs ulnvo u4teermrciytfpD lueo () 2xoirpiu1lpe  icil( a2tmxrpot4tpeoif3iatfsDeau snt4aetrmf ty1faDr n i;s) exrxmpoudalen fvilsfsDtrxm ;u4teenif3tlt aDea( s;u0tltrio oa1faDe nei t0seumir oy1lm e fet s aDtru pot1aeeo iciltfmDemnvs t0teeoifcoodoat an o;t0t2toir3iudlp emfeslt a2uax  nu0apx ifciytfm2ulnvpn(4 rxnmocoytlmDraivi;s)sruriopiodopeemiet t  rtrxmpnu4tpxnmociyd m2em(vs;()trtnio3ootlpDrlies;t  eur(r3nydole  ivt t artaum ;u0altnifetydlsDuanmo;() etrxfciatfa r ieolt0trxoxm io1lm nmnesas)artm(  ou0tpto ieiydlm2rluvs;()alerxr ty1fp eanvs s)texmxmpiy4lpenmfcia( arur(mp;u1optniictyslsDua(vsnu4 rtrmocoa1lptr u ilt)t2urirpnudllee neta(fs2raurp;u0alxnifcils s umu o (4 rxrxr3oydopDeaivs;s0 ruoim3iu1ol  mfesls)a2uau o;u0aleomf3tldla2eaumonu4 eeomociatlp  auvsl()t2toxopiudlpeelieia( a2tr(  no1tex  feiydfa2ulumonu) etrif3iy1fmDelnvolt0srxm(m3iudal  mfci ( a2ta(r ;u4oee  oeiydfs2elnvpn(0altrmocta1oatrli ol()t2xm(opiy1ll  mnvt t)a2rr( p;t1tee mfetad mDumu snu)alerio3iadla eaneo s)t2urxopiudopt lictas)s2ta( pnt0oleoioetaslaDel(vo u4 rxomocoa1lpDe ivi;s  etrim ou4omte feslt) rrr(rpnu0alxn ociad a2el(vo () lxrmr3iytla ran s;s sexr(o3iy4optnmnctls)s2taxro;o1alt  i3tatla2uanvon(4arxnxocty1fm rlieslt0setm(r3nu1oltnlnviltfsDtr(  ou4oeenioetltfs umumpnu)arermrcty1latr i ils0trtr(m oo4ap elietlt)sDrrumooo1oee ifciatlmDumnms t4 rxrmf oytfpD  ueolt)trxo(m3nodam nlivs t)artm(m no0aexomictltla2rmnvpnu0artrxfcta1lpte iei ()t2toir3ou1alt lnvtatfa2ua(r ot1tpt mf3tld mDrmump;u)trxrio3iy1oaD anvs t0s2um(mpiy1omtn feilsfsDuru  ;t0apx micildfm umnmp () etnircoodoaDrlueo t s2xr(m3nydlpeemfet t srrm(moou0tlen fetlsls ua(mp t0aetrir oo1omt auvs;t0seto(r nu1aleemfvs () Drm(  ou0openio3iydfsDeauvp;t4aetnxf ty1faDeluvi;t trtmxr3oy1ole lncs s)aDra(rpot0opeomicils a emumo ()tlermfctatop eluvo ( s2tmio nodlm e fcsatfarrmurono0apxnmfeiadfa rlnvo u)teeoxfciytfp r ueolt trurxm3iudom e fei tf Durur nu0tptn f3tltlm raums;u0texoxoctodlp e i i;t)sexr(m3iu1lmeemfvsls)sDrr(m nu4alt mfciytlmDea(vonu)aetnxf oy1fpte nvilt t2xr(r ny1omt lieta()srtr(r ou4ape mocildfsDemnvs;(0 etnio3oatlmtr ueo;s0srto(rpny1ame  nvtas) 2umumpou1alxniictydfs2ran p;()tetrio3iadopDe ieo s) rxrxm ou4optemivsasfsrtr( pnu1alxnioeiytlsDuanms;u)teerif iy1fatr u ol(0s2umxopoo1lp e fct (fsDrrum ;u1aptnifctlsfaDea(mp (4altnxfcoytopt  nes;t  exmxm3iydom elncias)aDrmur ot0oeeoif3tldfa uaump;(4teenmr3iy1oat aueo;t0t2tmxopnodlm emfct tfsDrmx p;o1aet io3iadfsDrlums;u4 rtnio oytoaDrlueo;t0 2xr(opoodlmt lnvslt) rumum no1tee mi3ias mDra(vo t)teeoxoctydfateanvil() 2uo(opiodlme mnvtlsf 2umxmpnu1oexn i3iydfmDemn o u)trtrxfcia1fm raivs (0s2toir3nydlptnlfes s)srtr(moot1aexn ictat sDrmuvs;(4tetnmr iadom elnesls)trur(mpoudlm emnvt ( srrmxmooo0tleomo3tldfm2rlu p;u)trtnif3tatoa e n olt) 2to(o iodap  mfvt sfs2tmumono0aet miciydfs uanvp;t)altnircoytlp  livs;() etmimpiudllen ivsltfsDrru  ;u1opto o3iys aDumn s;(4aetnxfcoadlmD lnvi s0t2xr(opiodll n ncsatfs2raur no1altoif3iasfsDrm(vonu4 rxrio3iadlpDeai s;()s2umxmpiudamee nvt t a2trx  no4oetomfeild s uanvpnu)aeenir ta1lp ranvs;s  2xrio3no1apeelnesls) rrm(mo;u1tlt  feiytla rl(monu) reoxfcoytfmDraivs;s0teto(r oydlpe mfviatfaDuaxmo;o0oet  o3tydfsDem(msnt0 rxnirciytla rauvslt tetrio io4omt miet ()a2ua(m ;o0aptomictysla2ul(von(0arxomfcoadomDrluei s)sruoxm ny4olt lnci tfartmumpot4aexo f3tas sDel(mo;t4 exnir3oytoaDr i i;s) rtm(o3oudam n ivt t) rrr(  ot4oetn o3iytlmDemumpnt)altnmf tydlp r uei ()srxmiopiu4lp emfeta( s2uau  no0aeeoifetltfs uaump (4 lerir ia1fatrlu i;s0texm(o iu4al   fcil(farurxrpnu4apxn ictldfsDul(vs (4alenxf3ia1fptrlivs;t t2ur(o oo4oltnmfvtl() rtr(  ot1olenioetytlm rl(mp;u4altrxrcta1fmDrlnei;s0 eumim3ou1lleemneiatfsrumxmpou1ape ifciasfm eanvonu)alxnxr iodla rlu i;t)tetr(m3ou4al e iei () rrr(r ;o0ope iictytfa emump u0 exnmf iadfptelivo;t  exmio iudop nmnvta(fsrrrx oou4aetnmoeiyt s2uauvo;t)tlxrxfcto1lm rluvol() 2urxrpnodale mfcsasfsrum(ro;u0olxomocilsfs rmn snu) exnir3oadfmteaueo;(0 eurxo3nodalen icslsf Dumumooo4oet  ictadfa2rlnvo;t0teenif3ootfaDran slt0seurim3iy4lm nmfvil()s2rru  ou0tet iictad m2uanmont0trxrmf oydfaDeau ilt sexrio3iydll nmnviltfsrtm(mono0teeoifciltlsDea(mp;t0arerxo oa1fmDraieol()t2xrxrpio4apte ivilt  2um(rpnt0aetnmi3iytfmDeluvs t0trerxo3oadopteaieo s s2trxo iy4om   nvtat)s2ur(rpoo0alen i3iyd m2umumont0 ltnxrciytomt an il(0tetoxo oydom  lfei t  2rr( pnu1tee  o3iltfs2umn s (0trtrmr3oodlpt anvilt teum(opiy1om  lfcil()aDtru pno1aeeniieiysfsDrmn p;t0 renif oatoaDeaueolt0trtmim ny4omee feilsf 2rmxmpot4alt  f3iatfsDemump;(0aeeoir oytlmtrlu olt0 eum(m3nu4olt mfetat)s2raxr ;o4tltoiiciytlmDrlumo (4 rxomfcoydlpD  ueil() exrxo3nudam  mietasfa2ra(mp;o0opxnmfciydlsDuanmo;u)arenmr tatoaDe ivo;( t2urxm nodopeemieils)arra(mpot1apenii3ild aDeluvp;u)aetrio iadlm  ai s s srxrxr oy1al n nvt s  2trurpnu1tle mfeiadla2em( s;t0 etnxr3ty1fm rlu s s0 rxoio3ny1ap nmietasf Duau poo4oeeniictldfa elumont0tlxomf3ty1omD anei s)truoxo iy1openlfvslt aDumur ou1tleomocild mDea( o t0 lxrif ty1fp rlnvi;s0 exm(m3iydlmt lfeiatfa2rm(r ;o1aex if3tytfmDum(vo;(4tetrmf iatlm rluei (0setrxr ny4op elfvt s s2uru poo1oexomietld sDrauvsnt4trtrif3ia1lmteai s s  rur(rpoydlme mfvs t  2urx p;o4olxo ociyd sDrm( s u0tetnmfcio1lmD lu s t)texr(o oo4ape lnvias)arta(r ;t4alx iictyt mDemumo u4trxoiociydfa elieslt  rtm(r oo4lmtemfesatfsrur(rpno4oetoii3iatlmDuanvp (0 lerio oo1fp elueo;t0s2urxm3ny4lpt mncil(  2uax oot4olx mfeiasls2rl( sn(4tltnircto1omDranvols)s2to(o3ny1aptnlnci t s2rax  nu1apeniietadfaDrmuvp (4areomr tadla elnvi ( texmim ou1alt  ivi t s2ur(mo;t1alxomoetysls2rlu pnt4aeeoxf oy1laDeauei;s)s2trimpno4lmtnmfviatfartm( o;o0opt mi3tys sDea(mp u) ltoifcoa1lpDeanvols0s2urxm3oudaltemnvi () rtru p;u0tpxn i3iytfaDrmumpn(0tlxrif iy1oa  luei;()t2trxo nudopee ict ()sDrmxr nu1tptn oeiasfm2elums t0 eerxf3iotfat lnvi t) 2uoim no1lmeemfcils)a2tmumoot4oeenii3tytfa ranmo t0trxnir3iodlp elnvs;t srtmirpny1alte fei s s2urxrp;t0apeo i3tytfa umuvp;t0 eeomrciodomtelu olt teto(o nu1lmeemnvs (  2um(m ;t1apt micildlm2rmnmo;(0 etoxo3oo1fp rluvil() etmxo3oy1lm e iesl() 2tru o;o1altnmi3tldfs2rmn p u4tleriocoodfmD luvo;t trtmxo iy1altelivtat) Dur(rooo4ape iietydlm2umumpn(0texoio3oatlmDeauvo s)tetm(o nodopee fesasf Dtm(  no0tpx ifctlt m rau on(0 etoir3iydfmt luei ()t2xr(m ny1lpe lfct s s2tau p;u0alt iictasls rmn p u0 lermrcoo1omtrlnesl(0trxmim3oudal emietls  2raum ;u4opt mo3iad s ra(vs (4 exnmf ty1fpD lnvo t)seumiopiy1lpe mfesasfa2umxrpno0tleomfciytfs2um( on(0tlerxf3io1lat au ol(0setmirpiu4om n fcs s)srrauronu1aee mfeiydls2uluvs t4teenmf3iydop rai i;t  2urxr ou4omenmnesls) Dtrx pou4opt mi3iadla2emu s;u0 exrir3iydlm r u i ()s2xoim iu4lleemics (f 2rmumpoo4oee mfetyt a rau o t4 exoirciotomt li o;t0 2urxo io1opeelfei s)sDtrxrpot4tlen feiaslm2rm( ont)alxomfcoadop e nvo s0teuoimpio4omee fvsa( a2tr( oot0tlenmfeildfa2eanmpnu)aexomocoy1fmtelieolt0trxoirpnudapt mnvs s aDuax ooo1ole mf3iadfs2rlumo;(4 lenmf3oy1omtelueslt) 2tr(r no1lm  lfetat aruaxmono0tpenmf3tas sDranvs (0artrxfctatlaDe uvs;(0s2urxr3ou1op nmnvtl() 2tru  ot0aptoifetldlsDraump u4tltoio3iydlp  ai s;t  2xmxm ny1apen icia(fs2tmu oot1tlxnmfciadfmDua( o u) lxnmf oytopDe ivs t)seurim nydol e ietls)aDum(rpoo0alxnmiciysfs uauvs t) ltrmo totfp eai ol( srum(r3ou1llenmivtl(faruax pnt4tpe mieilsfs um(ms;()tlxoxr oydop ean ils0tetrir no1apenmietls s2uru ono0ale  ociad a ranmpnu0artoxf oy1lptraneo t0seumim nudame mneilt arta(r nu0tex ioeiytfmDeluvsnu4 exoxo3iotfaD aivslt  rtmimpiu1apen fei s a2trxmoou0tlx  octasla ranvp u0tlxnif ty1op  lnei s) etmxopnudapt  nvtl(faDrmxrp;t1olxn oetyd m2emuvo;t)alenxr3to1faDe ueilt s2ur(m3no4ap   ncslt arum(r no0aexoiociydfs2ranmsnu)teenmrciodoat  nvsls  etmxrpou1ame lfesat) Dtmuro;t4apt if3iadlm2uln o t4tetrxrcoytlp   nvs s trtm(mpoo1lmeemnvi (farra( oou0tee  ieiatfs rlnms t)alxoxr3oadlpDr nvsl( t2trim oy1omt lfetlt srurxm oo4openmfeildfaDem(ms;t4 exrxocoatoa r nei t0 eto(m3oodolte fvsl()arumx pno1teen oeilslm rm(mont)alxnmo3totopteaies;s)texriopou4omtemnesl(fs2raump;o1tpx moetydfmDrlnvo;t4 etniocoo1lpt aies;t0sexo(m3nudopee fcsls)srtaxmpoo1teenmi3iysla2rlnmsn(0 ltnioctotfmteaiei;t  eto(rpio1apt mfvsl(  2ra(  ;o0ole  ocilsfsDrl(msnt)trtrioctadlatr ivs;s) rxrio3nu1lmtnlnvt ()aDuax  oo1tleoiiciydfm2eanvont4aetrxf3iydlp r u i;t s2toxrpiu4lm emiesl(  2rrumo;t0tle  f3ilsls2umnvo;t4teenmo3iytfaDe ieslt  rurim ny1lp n ictat  rurumpnt4oltoifetldlsDrmn o;(0arxrif oydlmD an i;t teuo(rpnu4omtnmfet sfa2ur(rpnu1apxoio3iyt m em(mo (0 etoir io1fpt aueo;t) eumxopiodllee ivt t) Dra(mo;t0alxo f3ilsla2ra(vp;t0 leoxr ty1omDe nvi;(0t2uoxrpoudape livil(fsDumumo;u4alx mfctat a ra(vsnu0 rxoirciydlp   nesl() rtr(o ny1oltelnetatfsDrrxm ;t0opto o3iys s2emn pn()altrir3todoaD lnvi;t0 etmirpoy1amenmnvta()arrmumpnu0oeto ociysls rm(vonu)arxoxfciy1fm  auvsls0srxoio3nodlm n ncil(fa2ta(mpot4optnmiciadlm2ra( o;u4trxnmociytom eliei t)trum(o iodop  miet ()a2rrx p;o4ape mf3iyd aDrln p;(0tltrirctodfa raues s srurxm3iodomee feilt)a2rmxmpno4openiieiadlsDea( ont0arermfcoadomt au i t) etr(r3ou1lpe  icsatf Dum(r ot0aleoifeiadfaDul(vont)tltrxf iatfptr n s s) etoir3oy1om   fvslt)a2um(mpnu4optn oeilsfm elnmo ()tltriocoodlmDrlnei t0srtmir nudom elnet ()s2uaxrpoo0tlt moetad a el( snt4texoxr iotlaDr ieo;s  2to(m iy1altemnetl()arrr(  ou1tltnmoeiys s rl(mp;t0arxnifctadla  aivs;( tetmxm3io1aptelieiltfsDtmu pou0tltnmoetysla2emu p;u0aeeoioctydfmteaies;s) exmxm iy1aleemfvtl(  Drr( oot4ope if3tlslaDrmu snt) exomr oy1oa raueo;( s2trxm ou4ope mnetasfaDrmu p;o0apx mf3iytfs uauvs (0 eermf oatlaDrlies ( tetmxm3ou4lmtn ics s) Dtrum ou0aee ifetld m2ea(vp;(4 rtoxoctadfm   iesls0truriopiy4amen fct tfsrtm(moot4apt moctydlsDelnvo (0altnxrciy1fa   ueo s srtmxopoydlp elncsatf Drmurpou1apen f3iad s elumsnu4 rtomrcoa1fm  au s;t) euo(r oodlptn fcil()arumumonu1tpeo i3tas sDulnvo;()teermocty1fmt  ieo t0 rtrxr3ny4al emfet (faDurur ;o1oeeniiciad a2umnms ()texrir oytlp eanes;s0s2trimpiudomtnmnvils aDur( pot4apeomf3iatfm rl( p u0 eerxrcootfmDrln o t)setmirpoy1am  mfvils)aDuaurooo4alxoii3iydlm2uluvpnt0 ltrio to1fa raiei;t t2toxm oy1al nlfci t aDurxro;o1apeo oeildfa2eaump;t0arenmfcta1fmDraivo (0 2trxmpiy1opt  ncsa(  Dumu pot1texn fetytla uluvo u)tetomrcoodfptrlieil(0s2xr(mpnodlp elnvi t)s2raum nt0alxnmictytls2eluvp (0artrxr3totlaD lu s;(  rtrir nodameelicsa() 2truroot1tpt io3tasfs2eluvp;u4tetoxrcoadfaDr n i s)s2tr(r3io4lpenmfvils aDtmump;t4ope ii3iat a2el(vo t0texrxf oo1op eanesls0 rxrir nu4llteliesat) rrmxr oo0apx ii3ias a2raums u)aexrmfcio1om  lieolt) eumimpiodamtnlfctls  2ur(mp;u4aeenif3iytls2ea(vs (0alerxf3oa1op  an sls0srurxr3ny1am n ncs s) rtmxmpno1tpxomoetyslm eluvont0 reomrcoadlatrluvsl(0trurxm no1lp nmnes tf Drau ooo1opx mfeils s2uau on(0teenifcoytfa e ueo;s0s2umimpnodameelivsat  2tmxmo;t4alt mociltfa2emuvsnt4arxnmocty1lpDrln s (0s2trim ny4opee ncilt)a2ra(m no4alx  oeiatfa2ranmo (0arerxo3iotop ranvo () 2xrimpoodolen fvt t)sDrrxr nt0alt  i3tys m umumsnt0tetnir3ty1lpt luei s) rtmimpoudal   fcil(faDtau ooo4alx  oeiysls2rlu p (0 rxrxr ta1fat  n o;s0trtmxr iu4altnmfvs s artmxrooo1ole ifciyd sDemu o t4 lenif3oa1fa   nvilt)trtrxopoo4ome lfcil(farua(ro;t1oleomi3iasfa eluvp () rerxrciy1om eai ils0seum(m nodlmtelivtlsfs2ra(m ou0aptn ociysfs2uluvp;t0tetnxo io1oateaues () euoio oodom  mnvi t)a2tm(r oo1altnmieiatfm2uln o (0arxomf tadlaDrln ols0trurxo iudal elfci s  rtru  ;u0altomiciydla ea(vs;u4tlermo io1omtr uvils) 2uoiopou1lptnmivsatf 2trumpoo0tex mfeilslsDrlnvsn(4 eenxo tytlpD liesl( trxmir iydop  licia() 2um(  ;t4tptoio3iydfmDrm(ms;(0tlxnmr tytom e nesls0t2xmim ou1lp  miciat  Dtax  ;o1altoiieilslsDum(ms u0areoxr oa1opD an ilt)srumxmpoodopeelictatfaDua(monu0tlto fetls a2emuvp u0aexnif oadla  ln i;t) 2umim3iu4om emieilsfsrtaxmo;o1alxnifcilsfmDul(vsn(4aexomo3oydfateau i (  rtrxm nodapte ivsas)s2trx pou0aptoiocils mDran on(4tltnio3tadomtranes (0seuo(rpoo4amt  fciatfs2taxmo;u4ale  i3tyd aDemumo;(0trtrmrcoytla eanvi s  euo(mpio4ll   fcs (fs2rax  ;o4tptomoeildfm um(vs t0trxrir iodfm eau i ( seuo(r3iy4opt lnvilsfaDurum ;u4tpxoiieiad a2rlnmsnu)arxrir iytoateauvo;t tetr(o no4lmt mivilt artrxmont4tle iieildlm em(vsnt0teerio3tatlm  luesls)srxmxr3no1oltnlneil(f Duauro;u4olt  iciatla2emnvsn() rtoxr3totfpDrlnvs t) rxr(opnu4altnmnvtat a2uaumo;o4aptoio3ilslm ranmpn(4alxoxrctydlpDr ivo;s)t2ur(mpnydop  lncta( s2ta(ro;t0alto ietatfa2umums;u)arerir to1fpDrluei (0 rurxm nydlme  nvtatf rta(rp;u0alxoif3ils a2rm(vp;u0 exnif3io1laD aiei s  rtrim nu4lmtnlncilsfaDtmxmp;t0tet ifciysfm rmu snu0 exomo3totomDelueo;(0sexmim3nodom emfct t arur( onu1tlxnmoctydfs2ulu s;u) lenir todoaDean ol()s2xoir oudaltemivsa( aDtaump;t1apeo fetatlaDeln ont4 reomociadlat aneo t0srxo(opny1opt mfeia()s2taum nt4apt iociyt sDul( onu4trxrxrcoo1lm   i ol(0 2umio3iu1aptelivia() 2umum oo1tptnioeiadla ranmp;u) rtoxfciytopDrauvs;(0trumir nodap nmnesatf Durumo;o1tlt  o3iadfa2umuvo () rtnir3oytomt li i s) rtm(o3io1optnmfct t  Dra(r ;u1altnii3tlsfsDulnvs;()artomr3ty1lm rli sls)s2xm(o3iy1olen nvtl( aDrm(r no1oeeniociydfs2uanmp;t4alerio ta1lptrau i;s srtmio iydlpenmnci (fs2raumo;o0ale  f3iad s2em(mo;t0tetnmo to1omt  u ilt)sexrim iy1llte nvia(f Duax  ou1teeomiciydfm2ra(mo;(4trxrircoydlpD  n s ()seur(r iydlp elicsas)srur(rpoo4teenifctldfa2uan p u) eenir iytlpDran s t  etmxr nodomt liesl(f rumur ot1tetnmiciadls emu s () lerxfciadla   uvo;s tetrio nudap   ivtlsfaDuru onu1opt if3tat a2emuvp t4arerxrcoo1fmt  u slt t2xm(m oydll elnvi sfarum(mo;t4tlto fciadfsDulumpnt) ltnmf to1oa rluvol() exr(o3iodllt lnesl() rtaur ou1oetnmoeiyt a2rl(mont0aeeoxo3todoaD luvs (0 exo(mpoo4lptnmfcia(fartmurp;o1tlxnif3tadfaDrluvpnu)trerir3oa1om  anvsls0srur(o ou1openlneslsf 2trxmonu1optnii3ilsls2rln p;t4tlxomr tatopD  neols) 2umxmpoy1op elici t sDrmxmo;u1altn i3ias aDemu p;u4treoxf3iydoptranvs s0teum(mpiu1oltnmncsa(fs2tru  no1ope ifeiltlaDrmu p;()alenxo oadfpt aueil( trtmim3oydlptn ict s srrr(m nt4oeeomiciadfm2uanmp;u)trxoxfctatlmtrli s;() rxoirpio1lpenmneta( sDrmxm nu0olt  octatfa um(vs t)teeniociatlmtr neilt trtrimpiy4amtemnetl(  rur(rpnt0aetomicils mDraumont) eeoircoa1omtean il(  2uo(r3ny4opeelivt s)s2uaxr ;o1opxomoctad sDemnmp (0arenifcootlmt lnvols0 eurxopiydlmt lfei sfsDtrxroou4ale ifeias a2rauvo;u0 rxnio3oadla  lieo s0sruoir ny4amtelncia(f 2ur(m no4teeoiieiadls uanmo;(4 eerifcoodoaDrauvils)tetr(m nodalte nvtls)sDtr(mo;t4aet  ociadlsDrmnmp t) etrmo3tatlpt  ies s t2tmir3nudom n fetl()sDtmu oou0apt io3iatlm rlnmpnu0areriocoadfpDe nvo () exm(rpny4ome  nct t) 2tmxmpno4aleomfeild s2uaumo (0 lenxr3ty1fa raies (0t2xrxo oydomt lfvtlsf 2um(r ;u0aetniicilsfs2emumo;u) eeoiocio1faDrlnvs;( s2umxr3iudlleemivsas)arua(ro;u1tetnmietyd mDemuvp u)tetrmo oy1fmteanvo;t0trtmxm3ou4ap  livtasf Drmu o;t1alenio3iyd aDua( o;u4arxomr iodomt lies;s0texm(m3iu4alee iei s)sDumxmp;t4apeniietldfm2eau p;t0 exoir3oadfmDelivi t0srtrio3oudal emnvsl( s2urxm nu0optomicias s2ul(mont)areomfcio1om eau s;s) 2umim3iu1ap   nvilsfaDuaxrpno1olx ioctytfm emn ont) rxnmo io1oa rln ol( srxmxo nu4lltnlnei ()aruax  ;t1alenmoetyd mDeanvo t0aexoir io1lpt au i t)trtrim3oy1ap e feil()srrmxmoou4alt iociaslm2umump t) lenmociydlp eanesl(  2xmir iy4aleemnes t)srrmxr nu0ole  i3iat m umuvsn()aexrmocootlat an o;t) 2toxr3iodllenlfet t)a2tru pnu0tpto oeildfa2umumsnt4 rxnif ootlpDrli i t truo(mpnudomt micsas)sDua(mp;t4tle  f3taslaDeaums (4aexrxrciy1optr uvi;s)texr(opiudlleelnei ()aDumx  nt1apt iiciasfa2rl(vp (0aeenir3tatom raieo;() rxm(rpou1aleelnvi t artm(rp;t0alen o3iyslmDrlnvonu4texnir3tatfa ranvs t) 2trim3iy1al n iet t)arraxro;u0tpx mi3iytla rmn o t0 lxoxf to1om  lu i;(  2xmio3io4olenlnciltf 2rm( oot0ale  f3tas mDuau sn(4 exnmfctodlmDraneo;s tetrxm3nudaptemiei sf 2umumont0tpe  ictas a ul(mo;t) eenxo3oatlm r nvo;s srum(m iy1opee ics ( srraxr nt4oexnio3iysfa2umumo (4tlxrircoodlpt aueilt0 etrxrpou4ope lfvslt)srrm(  nu4alxniieildfm emu pnu0 etrmo3tadfaDe u o;t) 2uoim iu1llt lfvs t aDraumpno0oeen ieiys mDemuvsnu)aeeoif iytlmt lues (0seumiopou1om elietl()sDtaxmpno0texnmo3iytfmDrmnmpn(4 rtrxoctatlmt auvs s)texmio nydalt  ivi ( sDrau  ;t0tlt  ictysla2rl( ont0 lxrmf3oy1la  livs t)srumxo iy1lpeemivi sfarum( p;o4apeoio3ilt aDrl(mo t)tetnmrctadfat au s;s  2xmxr nydaltnlneil(farum( oou0opx mfeils s elnmo;() eermocoo1fpD  ues;s) ruoiopou4lmtnmfetas  rrr(ronu4oleoiicildla rlu o t4 lxomo oatom rlnes s s2umio oodlm elfetlt)s2trxmpoo1olxnii3tlsfa2rmnmpn(0altrmocto1faD  uvi;(0 etoio nodlmt lneias  rta(rpnu4oexnioeiytlm emu s t4altomrciadfp rlnei t  ruoxr3oo4lm  lnvs t) rtmxmont0apen fciaslaDrmu pnt) rxrxf tatfpDr n o t) rxoir ou1amtelnctat aDtmurpnt4apt ioetasfm raumonu)trxrmfciadlmDrlueo;t srtoio3oy4lme mnes (f 2trumoou1oetoiieiad s em(monu4 lenif3ootlpD  ies s0setr(mpny4lptn fvsltf rraump;o4tptn fetls aDel( p t4tltoxrcootlaD auvo s t2urir3oy4lmte fvs sfaDua(mont1alx mociadls uaumo t4trxnxrcoatfmtelivsls0t2toiopiydlmtelict s)artm(mont4ale  fetlsfs ulu s t0 eeoircoodopDr i slt0t2xoiopnodlm elfetls)srrmumo;u1aexn octaslaDeln o;u) leomr oo1lp eln s;s)srumir ny1lleemfcs (fsDuaurpnt1tpxomfetas s2rmuvo u4artrmrcto1fmt  i ilt0seur(r oodamtnlfvil(faDraxmp;o0aetoiiciatlaDel( o;u4aexoxfciydlpDr uvi;( s2urxo oy4amtelieia(fsrtmumpou1open icilt a elumo u0 eeomf3to1lat ln s t sexm(r nodap e nei tfsrururpnt0aeeo ieildfa2umu onu0arxrmf3iytfpt  nvo;() 2xr(opiydlptnlnctatf Dtrur ;o1opxo f3tadfsDrau s u)artrmf3oytom   n i;(0teto(mpnu1lp  mnct t  2tm(mont0oexnmo3ilsfm eluvsnu0alxnxr3ia1oaDrlnesl( trxmxo oudop elneias)sDumx pnt4tee mo3iltfs2rl(msnu4 rxnioctatoatr u s t srxo(opoy4omt mivils s2rru o;t0olxn f3iad m ulums;t4trenif oadoa  auvs (0s2urimpnu1aleelnvils)sDum(r nu0tlt  f3iasls2emuvs;t4 ltrirciodlm  aneo;t)t2xmir iy4olte feilsfartmxmp;u0tlenmfctydla el( o;u) eerir3tydlaDelnes s0 2ur(m nu1omtelncil(faDtmx poo1tlxoifctyd a2ulnmp;t0tleoxf tadlmt lnvi;t texm(mpoydamenmneia() Drmxr ou1tlt mf3ils sDumu s;u4 reomo to1oatrlneslt)t2xoxm ny1omte ivslt) 2ra( poo1olxniieiasfm2ulums (4altnmo3to1fmD  neslt  eum(o ny1altelicsatfsrtm( o;t1aexo oetad m2ua(vp u) rtomo iydlpD ln o ()t2xoxo3oy4lm nmncsl()srta( poo1aet ifeildlsDemuvo;u0trxrio3to1fmD  uvs s srtoimpny4llt lfct t sDtax  ou0oeeo ieild m2emu o;t4trtoiociydla  luvsls)trtr(m oo4ll  lieiat)a2urx o;t1olt mfctltfa ra(mp t4tetrxf3oo1laDraueolt s2xrxrpiy1ll elncs t s2trum oo1alxomictld sDumuvont)tlenmf ootla  aueil(0trtm(opiy1amee neta()aDum(monu1teenmoetldls2ua(vs;u0aetnmrciytoaDelueils0seuo(m iy4al nmnvta(fsDtmurpou1texnmf3tasfmDem(mpn(4trerifciydfm rlnvsls)sruo(m3oodaltelfvt s  2raxr nu1apenmfeildlm ulnvs;t)trtoio io1fmD  ieo;( t2uoxopoo4lmee nvias)srtr( ono4tlxnmo3tldlmDrm( onu0trermocoy1laDe n olt)t2xm(m3oudom  mncs ()artaxm oo1tpe ii3tadfaDumu o;(0 lenmf3ty1fa rlu i s0 2tmimpoodolt  fcsas) rrr(mp;u4opxniieiltlm2el( p;()aexnxfctatoaDe neolt srtoimpiodop emneilt  ruau  ou4opx miciyt m emuvo ()arxnif ia1omtrli olt0 rtrxm no1ameemfcsls sDrrxmo;t0tex ii3tyd a eanvs t0tltoxf ty1omtraneo t0tetmir nydom emiesas a2rax pot0tle  oeias s2rm(mo u0 lxnxrciodlmDrli i t s2uoim3iudlltn iciasfarraumo;o1altomfeildlm2rluvonu)arerxrcto1lp r i sls  eurxopnydlp  mies s  2umxrpnu1tetnio3tldfmDuluvonu)tlxrif tadfpDrln s t)sexoim no1llt lfci t sDtau onu4apt  fctldfs2rl(mo;u)teenmf3tydoaD au s;( teur(rpiydop nmicsat srrmuroou0oee iocilt aDem( ont0 ltnif3oydfmDe neolt0t2trir oudlpteliei (f Duaumpou0opt mf3ilsls2rl(mp t4 lerio to1fmD  uei;( trtriopno4ol   feia(fsrumxrpot4tle ifetadfmDuln pn(4tlxnxf3todlat an s;t)srto(m iu4ape  nvs t srum( o;t1aeeoiieils m2elnvp;t)altrmo3ootfatr ivi t  etmio oo1altn fvilt aDua(moot0apx mi3tas aDra( o;(0 etnxrcia1la raivi;t  2tr(r no4amt mnviasfsrtrx  oo1olxomfcilt aDulump u4trxoioctytfptr ueils)texr(mpio1alenlict sf 2raurono1openif3tadlaDrm(mo;t0 rtnio tadfmDr uei t t2xr(r3iy1ame  nvsat)aDrau onu1opeoiieiys aDem(mp t4tleoxo tatom eauvolt s2trxopny4ll emfeil(fsruauroou4oltomoeiltlaDrmums;t0 ltniociatom rliesls trtmim3oudap n nct s arrmxmp;t0oeenmf3iatla uauvp;(4 leomf3ootlm   ieilt  rurxmpio1ope livtl(  rtmu  ot1opx  octlt m uanvs t0aeenmocio1lpDrli i;(0 rtmir3iu4olt mietl( aruaumpoo4oet  ietadlaDemnmsn()tlerxo3oy1lm rlivo;t  exoxr nu4lm   icsas a2ur(mooo1opxn o3iyt a2ranvp;t) ltoif oatlaDraiei;t t2xr(opny1oltn ncs t)srrmumono0aet ii3tatlsDra(mp u) ltnmo io1om r u ils t2xrio no1oltemncsasfaDraumooo0ole ii3iasfm emn o;u0trtrif3iodla eanei () 2umirpiu1ll   nctat s2rmum ot0teeo ieias m ra( pnu0tlenxrcto1faD lues;t teumir3iodal nliesltfs2taxm ;o4texo ictatla eanmonu0aeermfctadom  au olt0s2xmir3oy1optelietl(f Dua(m nu0optoifeiyd a2em(vonu)altrxf tydfa eln ol() 2umimpou1openlfes (  ruaumono1olt  i3iasla2ran p;t4 rtrxr3totlaDrau ols0 exoxr3nudapt mneias a2ta(mpnu0aee iocilsfs2elu o ()areoxo tatlaD  n olt0s2tm(m iu1op n fci t)a2rmxmpnu4opxoiociaslsDemu p u4aexrxf to1om  luvsl( t2toxo3oo4amee fvi (  2urxmpot0aet  ieilsfm2ua( s;t4arenio3oytlp  lies s  2xm(mpio1op  mnesat  Dtaxmp;u1teeomicils mDrm(vs u)alenio3iytoptrai sl( t2xo(m3iu4lmt miesas  Dtm(rp;t1olxoio3iydfsDel(vs (0 etomr oa1om eaies t0 eto(m3iodapt miet tf 2trxmpno4tpenmfciytla rl(mp (0arerio3todoaDeaueo;t0 2xmio oy1lpee nvsl(  Dumx  ;o0tpt  ietas m umu on(0 rtnio3ia1fa  lu i s t2trxo3nydoleemnvil(fa2rmurono0apenmoctls m rmump;t)arxnxr totoaDraivil( s2xrxopiy4amenlfvi sf rum(rono4tpt iictltlaDrmump u4trtnir totlm elieo t) rto(rpnu4ome mnesat) rrrum nu0tpxnio3tydla umuvp;t)arermf tatoate i s;(0truoxr no4lm emies s)a2taumo;t0opx iiciys sDrln o (4teerxoctodfm eli il(  2um(opno1ll nlfci t)a2tax pno0tleo ietltfmDra( s u4trxnmf3tydlm eauesl(0 etoio3iudlpen ncsa(fa2trxrono4opx  o3ilt m2uluvp;u0teenmo3oatomD aneolt0teum(m io4llenmfvtlt s2ta(mp;u1tex ioeiltfmDelu o;u)aetrmf3tadla elnvi ( teuoxm3iy4lme mictltfsruaxmont0oleomfciaslm uluvp;t0 etrmfctydlptrluvols) exoir3iu1lpte icsls srurum ;u0aeenmfetaslmDuln s;u4teenmrciadlm e u o;t)s2toimpnudop   ivia(f 2rrumoot1olenmiciadls2ra(vo;u0aeermfcoa1opDrluvil(0t2trxopoy4aleemncsat  2rmuroou4oee mo3ildfm2elump;u4aexrxr3tydlmtrlieo ( t2tr(r3nodoltnmietl( aDumum ;o1opeoioetltfs ranmo;t4 etnif todfpt anvols0t2toxmpnudaptn iet ( srua( ono1tpenmoeiasls rlums;t0tleoxr3ta1fp r nvs t) rxm(o3ou1omee fcias)artmuroou0opxnio3ildlaDuan pnu0 reomrciytlpDeaivo s)srtr(m3oydop  mfvt ()srra( pno0oetnmi3iat sDulnmo u0trxrirctydomt  iesls srto(m3oy4al  mietatfaDtr(mpot0aleomiciad m rau s t4aleomfctotopDe nvol( teuoxm3oy1ap n nvsa(fsrtaumpnu0tlt ii3tltfm2umums;t4 lxoiociodfat auei;() rur(mpnydamtnlictls)s2rmur nt1tpeomicilt a2uauvsn(0 etrxrcoatlaDe iei t  etoir ny1omeemiesl() 2uaur nu1olt io3iadfa2rau p;u4 exnifcio1op  lieo s  rurirpiu1lmenmnes sf Drau pot0aee  fetad s ea( s;t0aetnifcoadfp raiei;t0trtmir3io4am nmncils arrmxmooo1tlxomi3tysla uan o;t0teeoif tydopD  ivol(0s2urio3ny4om n neia(f Drr(rpot4opxomiciltfaDrmn o u4artrxf3oy1om   n i s0setr(r oydop emiet ()sDtm( poo0tpenmo3ildfsDelnmo;u4trxnmocoy1lp eln s s srtmxm3nydlpen fcsltf rraum nt1oetniieiasfa eaumo;(4alerxrcia1lmDrlieilt0s2triopiy4opee fcs () Draxr ;u0ale mociytlm2em(vp (0aetomr oodfpt aivs (0 2xmiopiodllenlfvs (fartax pot1olenmfciytlaDemnvsn(0 eenmr3iy1omD aiesls)setrio iu1llenmfviasfa2uax  nt1oetnmi3iyt m ean o t0teerxo ia1oa e neols trxr(m iydomtelncils a2ra( poo1aetnmfciasfa umnmp;t4altrmocoa1fm rau slt  etm(r3oo1lpee nci (  rrm(r nt0aetnmictatls rl(vs;() lenif tytlp  lueo;( s2uoxo3oodllee ivt s)a2rm(mpno1olenmiciltfaDem( snu0 rxrioctotla r ivs t  exo(o ou4lm emictl(f Drrx ont4open fctatfa2emnmonu0alxnifciytomtr nvs t0 2urimpiu1lpeelncs tfsrtmxroou0opeo iciltlsDeanvonu4alerxr ia1latr nvslt0trxmimpoo4lmee fvt (  rrm(ront4opx ifeiyd a2rlumo u) rtomfcoa1omDr nvslt srtoio3ny1om  lfvi () ruau ont0tle ifciadlm em(vpn(0altnxfcoo1fm  auvo;s)setoim3iodllt mnvias) Dtr( ont0openiieildfmDrln pnu0alerif oatopt luei s  2uoim3nu1am e fvi (  2ua(rp;u0olxnmf3tyslsDuluvo (4trtoir3iy1omDe u ils  etrir3iu4opt mivtlt)aDtax o;t0tet  fetat m2umnmon(0tltrircoydomD au ol(0 rxrio oy4apee fvt () Drmx ooo4ale mfetysfm2rlnmp (4 lxrmr oatfa ran ils0s2urio oudopeemfcs t)s2tm(m nt4apx mi3ias aDem(vp;u4aexrxr3iadlpDeau olt  2ur(m ny1ll nlneiat artr(roou4oex iiciatls2ulnvs t)trxomf3tadfm elu olt trurxr3oo4al emnesl( a2trxmo;u0apeomo3iytfaDrmnmonu)alenxo io1opDeli sls0 ruo(r3oudaltn ict sfarrrumpou0tpxn o3tldfs2rlu s;t) reomf3iatfp raieilt t2uoxo no1ope  neilt  Dtrurpoo1apen o3iat a2um( onu0 lxnmf3io1fptelieo;s) euo(opoudol emfei s)artaumont0olt  ictys aDuan pnt0altnmociydoa elneo;s texm(r3no1alen fvsl(f Drrxr nt0tltnmfciyslaDrmu pn(4aetnxr iotfptrli sl()sexo(r3iu4ale mnvt s)aDtaxm nu4tlxoifciasls2umn sn() leoir3todfat ln o (0s2uoxr iodamenmieia( aDum(r nu1oetnmo3iadfa2umump u4 etnmrctotfpDrai s;t0s2tmiopny4amtnmfeta( aDtmx pnu4apenmoctldls emnvsnt0arenmf3io1lpDeli o s t2urxmpiy4am elnciatfsrrru  ;t0tetomf3tat s2el(vpnt4areoir ia1lpD  neilt) etmiopiy4lpt miciat)sDtrxmont0tetn iciltfm2ea(ms;t)aetrxr iytopDrauei;t  2xr(mpou4lleelivt ( sruaxmo;u1tltomfeild s rau onu0 etomr3todfmDranvs (0 eurim3ou1lmenmfcia(fsDrru ono4alxn fcild m rlnvp u4 exoxr3ta1laD lneo;(0t2toxm oo1ole mnet sfs2rmxmono1aleo feiadfaDeanvp;u)areomrctytlm  ln ilt0setrxm nudlpenmfci
\ No newline at end of file
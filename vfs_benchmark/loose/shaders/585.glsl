@@ -0,0 +1 @@
+nvs t) exm(r io1lptelfvilsfs2tm(  ot1tee iiciytfs rlnvo u4 rxoir3iy1om e n s (  rum(opoy4opee nvsl(farrrx oou4tex io3tyslmDulu o (4tlxniocoadfatelnei;s0seur(m iodopee neslt sDumx p;t1alxomietasfa2ul( p;u4 ltomoctydoptrlu i s)sexrxmpoy4lme lics (f rua( p;o1tex ii3ildfmDuln s;t)tetrio3iydomDrlu ol()srxoimpiu4al  mfesa(f Dtrxmont1aexnmieiasla2uanvs t)aetoiocio1lm  lu o () 2umxo3nu4lmtnmiesltfsrtrurp;o4alx  oetadfm rln s u0 rtnir oy1opt lies t  2umio3nu4lpt  fvsa(f rta(r nt0apeoif3tyt a emnmpnt4trtrif ootfmtelies;t) 2umir io1op n fcia() 2uax ont1tle  ictyd m emnvo;u4trerxfcoa1lm eli sl( sexoxrpou4lm  lfvia() 2tmu o;t0oee ioctydfm em(msnu4 rtnir iadlp elu o;(0srurirpio1op nmics sf Drrxmoot4tpxo ictlslm2emnmsn(4alxoirciadfm   uvs;s0t2xr(opno1lmt liei tfsruaum no4oexo feiyslm2rlnmp ()tltrir3ty1fpDran ilt  2urxm iy1olenlfetl(fartax ooo4tle moetydfa umuvpnt0tltrio oydlp eauvi s) rxo(m oydole lfeil()arta( p;o0opxo fcildlaDrln o;u)teenifcoo1op ran o s0setoxo oo4opt mietatfaDrr(mp;t1oex mo3iasfaDran p (0 exrmociotom e ivo;(0teurim3nu1apt mnviat)sDra( pot0oltoii3tad a2ra( o;t4artrxf iy1lat aueols t2uoxr nodope livtas)a2rmxmono1opx  i3iyt a el( s;u4tltoxr3iadfatrauvo s)t2ur(o3nu1lm nlnvta(farumu pnt1aptn oetasfaDemnmon(4trtoxr ta1oa  lnvols0 rtm(mpiu1lltnlictls  2trumooo4aee ii3iltfm ul(vpnt0trtoxocootomDrai s t)trtr(opoo4lp elnvils arua(ro;t1tpe mfeiydfa rl(mp;t0 rxrxf iatfm eli o (0 etmim no1openmiei (f 2urx pot1tltniicias s2um(vonu4arenxr3oo1lat lueo ()trxr(o oodalt mies sf Drrxr nt0oetniieilt m2um(vp;t)alxrif3tatlmte uesls  rtriopnu1ll n ivt sfa2ta(mpno4altnmiciatfs eln o ()tetnxr oytlatean o t  rur(mpiu1altnlfcs tfsDtmu  ;o1tpen fetysls um( p t0aexoxf oa1lpteaneslt trxrxm3nydaleelici t  Dtau oou1apxnifeiaslmDeanmp;t4 rtnxrciatfa   ueslt0trumimpiy1lptnlict t a2uau  ;u1oexn f3iysfmDem(vp;u0artrxf iytoateln ils) 2xoxm3nodomtnlnet s)aDta(  nu0opeoifeilsfs2um(mo u0trtnmo oatlaDraneo;s s2um(o3iodaptnlnci (fs2urxm ;t0aexoifcildlsDeluvs;t)alerio oatfpteaies;() 2trir3oodamte fet ( s2tmu poo1tpenmf3taslmDrauvp u) rtrmociytlp e uvsls0 rtm(o nydlmtnliesl(f 2tm(r oo4tpx  fciat sDra(vp () reoxr3tadfmt ai o;s srxo(o io4am  mncilsfartmuronu1texnmoetls aDra( o u4tetoir iadlpD ln i;s) rxrim iy4olt mivi ()srumxmp;u4tlxoiiciyt m umnmp ()tltomrciy1oat  ivols)sexmiopio4al  miesl(fa2rr(rp;t0altomoetadla emnmo u0trtnif ootfate nvil(  eumxmpio4olt miet sfa2rrxrpot4oet mieiat a eau o;u) exnif3oydfp eli ilt srurim3oudopee nct s) Drmxm nt0aetn i3iltlaDulnvs u4 rtnif3iydlpDe nei;t0setr(m iydlpte iet () rtau o;u0opx io3tadla2rl(mpnt4teeomo3oatfaDe u ols)s2tmio3nydolenmictas srta(ront4tleo o3tltfs el(vp;t0aexomf3oy1fp r nei;s srurxrpnu1ale  fvias s2raumpno4tpx  oeiad s rm(msnt4 exoxr3oytfpD aneolt trurir oudalt lfeilt sDum(mpoo0tex mfetatfs2em(ms;u)tetoxo3ootoptranvi ()t2xrxrpou1lmenmnesasf 2rrurpnu1tlen fctys a2ra(mpnt)alxomociytfpDr uvs () rxrio iodlm n nvs ()a2rr( pnu0oeenioeiad aDuanmpnt0 etrmfcoa1om eauvi;(0texrir ny4llt  fcilsf 2taxr no1tlx  fctysfaDelumpnu)altnmr3oydlp  aueols)seuoxr3oudlptnlnesl() Dururp;o0tpe mictyt m rl( sn() rxrmrcootfaDeaueo;(0 2umimpno1ll  lfvt (fs2raxr ;u0olx mfeiydfm2uaums u) ltniocoatop eau o t0trurir io4llenlnet tf Dra(mo;u1teeomoetlslm2rlums;u0artnio iodfm eau olt texoir3nydol n fes s arur( pot0oex mietyd s2umuvpnu4aeerxr3oadopt anvs t  2to(opoydaleelici t)artrur oo0alt mf3iytlmDum(vp;u0 reoiocoadfpDeli il()texrir nudape mncia(fsDuaump;o1olxn ietlsfaDemnvs () rerxo3totlmD  neol()s2to(m3oy4lm nlivsl(fa2rm(mpoo0opeoif3tatlm rmu pnt4teerif3to1op elu sl(  2trxm3io1altnlieia(faDtaumpot1olt ifcildfsDuan o;u4trxoio3tydfa raneo t  rumim nudomt lnvs tfaDta(  no4tlxo ieildfaDeaump t) exrmo3oy1lpD lneslt0t2xrio3ny4omtemfeias arrrumpnu4tetoioetltlmDrl(mp u)texrmo tydlmt lu s (0seto(mpiu4lltnlfctlsfarta( o;o1oeeoioetad a rluvp;u0tlenmr iytfat an o t0t2tm(mpio1amtnmfci s  Dtru pnt1tlto o3iytlmDumuvonu0 eenxfctotom e ivs () 2urxo3ou1lmenmncs s aDumu pnu1ale mi3iytfm rmnmo u0aetoio3tydlpDran il()teumxo nu4olte ivs s  Drax p;t4teenmi3ils m2umu pnt4alerif oydlaDr ueols)s2um(o ou4olenmfci (  Drmu pno0olx mfcildla2rmnvo;t4 rtoxociodfa eai sl()trxmxmpno1apenmfvta( srtmump;u1tpxo ocildls emumo;u)trxnmf todfpD ai ol(0s2xrxr no4omte fvi tf 2tmxmp;o1oleoifctltfsDelumo;t)trxnir3tatfmDeaues;s0srxmir oudap emictat) 2uax o;o1tltn o3tydlsDemu s;t)aexrmr oatoate neolt  eurir no4ol  mfcs (fs2tr( pou1altnmociadlsDulump u4 lxnmfctodlp  aneo (  exo(rpnodomte nci t s2uau o;t0aptoif3tasls umnvon()aeeoifcoytfaDrlueil() exmio iy1optnmfvtas)arurxmooo1apx mo3tatfs2rluvs t)texomr oy1fptrlu o s)texoxmpiodamee iesl()a2trxr ou0tptnmoetydlaDrmu o u) eenxr tadlmDelu il(0srurirpiu1olt mivsls)sDuax  ;u4apeoif3iasls uln o;t4 reoxociotfpD aivsl( s2xoim ou1olenlivs ( srua(moot0tpenmf3ilslmDrl( o;u)aexnif3iodoptrln i t0s2xo(m iodapenmictat) rur(root4opt  o3tytfs um( s;(4 ltrxo tytla  au s ( s2tm(opny1al e fvi t a2uauronu1ope iieildlaDua( p;t4texrif oadfp e nvo;s) rtrxo nodapt mnvs tfs2tru pnt4tetnioctldfs ea(vs ()tlxrmf iadlmD lu i;()t2toir3nu1alt lfvi ()arra(m ;t0apxo fciyd aDul(vp t4 rtrxr tatla   uvs;(0 etoim3no1altn neiat  Dtauroot1tetoifctyt aDel(mpnu0 rtoif3io1fm e nvols s2xmxo no1aptn icsatf 2umurpnt0teeo oeiat m emn pnu0 exrir oy1oa  lies s  2urxr iu1openlnvt sf 2umxr ;u4oltnmoctat sDeanvp;u4 lxomo io1oa  ai i (0tetoir3nodlme lnes () rrrxrpot4apenmfeildlm2ul( pnt4 lenxo iodoate neols0trto(r3iudapee fvsas  2umx  ou1apx  feiysls rl(mpnt0aeerxo3ta1fa   nes s trxrir3oo4lpenlfes t)srtr(mp;u4olen i3tatfa ul(ms;()arerxo iotoaD  n ilt  exrio3nydomte ncta()srumxmp;t4olenif3ils m2rl(mo;u0 ltrxo3iatfa e nei (0 exmxmpnu1aptemfctl()a2raum oo1tlxomfeiyslmDrluvo;t0altoxo3oa1fmte u ol() etoiopio4lle mneslt srtmx  oo4tltnii3iysls rmn o;(4aexrif tadfmt lneo ()t2uo(o3ny1ll n fcia(f 2ur(m ;o4opxoiieiasfm rlnmo (4 exrircta1fpDrln s;s0t2tr(mpno4amt lieia() 2trx pot4tlen feiyt sDrlnmo ()arxomociotfmtraiei s)setm(o nydlmeeliesls) Dtmu o;o0apx if3tasfm ulnvo;t0 lenio3oydlpt livi;s teumim3iu1lptn fvi s sDuax  ou4apxomfeiytla2emuvp (4tleoxfciydlat an s s)s2xr(opny1lp elnvsl( a2umumpou1alx  feiysfa2ua(vs ()teeoif3ia1opDraneo s  rurirpiydomenmfci s)srtrxm ot1oleoioeiytfaDua(ms;u4tlermr3iytoa e nvi;t) rxm(m ou1lmen fct t)aDua(monu4tle  fciaslmDemnvo (0tlxrir3ty1fm  anvi s)trtmim3nudamtnlicslt s2rmx  ;u4aetomiciyt m2ul( pn(0texoxo3oy1omtrlivs s0 2tmiopny1op nmfvi ( srrax  ;u4ape ioeiasfa emnvpnu0 rxnmoctytlpteaivs;t0 exoxmpnodllt lnctlt)sDtm(moou0openmi3ils aDrl( snt0aeeoxr iadfatr n ilt0 2xmirpoydalenmnvtlt a2rm(rpnt4tetnmo3iadlm2ul(vs;u0 ltoio3ty1fm   n ils)setrxm3nodoptemnesl(f ruaxrpot1oex  ieiatla2rlums () rtoxo3iy1fpte u i s0srtmxmpiu4aptnmictatf rtrx pno0aeto o3iydla2ra(vp;()aleomo3iodfatrluvs t trumxr3iydlptemnei t sDtaump;u1oexoiiciyt a rlnvp t4 rxoxr3ootomDrlneo s)texoxo oodamen ieias) rrm(m ou4tpenmf3ilsfsDua(vp;u4aetoiocoadom  luvs;(0trtr(mpoy1lm nlnvtl() Draum ot0tptniociytls el( ont0aeenio oydlm   nvo;t s2urim3io1op nlivs tfs2uax ont1teeoifciat s2rm(vont4 eermr3totop rln o s) etoxo nudoptn net ( s2tax o;o1apt iociydlm2em(vsnt)aexnxf oytlp   u o;s)srxrim3iy1lltelnesl(fs2tmum ou4aetnmociadfmDrmnmo;(0texrmfctodlatr n s;t tetrirpiy4apenlnvta(fsDrrumpnt1tlx  iciat m rlnmsnt)tltrifciatlmDeaueols) rurxopio4olt lies sfa2rau  no4oleniociytfs rlnvp (0tleomo3ootom  luvo;t)sexm(o3oo4apeemncia( aDtaxrp;u0openmfciydlsDem( on(0aexoxr oy1laD luvo s0s2xmxm3nu1lptnlnctlt  Dtr( ooo1alxo oeildfsDrmums;(0trtomr tydlmDrli i t)s2tr(mpno1lme  fcta()aDrr( o;t1apx  i3taslaDua(vpn(4trtnmr3tadfaD anesl()sexo(o nydap  lfvi s)arrrxmpno0alt iociat mDuanmsn(4arenmf3oodom eaivs ()seuoiopiu4olenlfei t)a2ur(m oo4tee  iciyslmDumuvpnu0arerif3todlmDe iesl() etrio no1op  mfeils aDurxronu1aee  f3iytfa eluvp;()tlxnxf3todoptr iesls0srumxrpiy4ole  nei sf rrr(  no4aptn ociadls2emnmsn()alxrif oo1fp   n ils)seumxr no1ap  lnvtl()sDtmxrooo0teen fciatla rlump;u)alerxf3oo1lptrai ils0trurxr io1apeelfetlt  2taxm ;o4tetoii3ias m2ulump;u4 lerxf3to1oa e nvil( sruo(o nudllen fviat a2truro;t1olxoioctad a ranms;t4 etrio3tadfpD auvs s0 2toxopio4al   nvilt  2trxr ;t0tltn ociltfsDeaumon(4tltomf to1oatrluvs s) rtoirpiy4omt  fcil() Dtrurpnt0tpxo icilsfm2eau p;u4teeomr3tytlp eai i;t srtm(rpou4ope mfviat srtru p;o1aex io3ils s2rmumpnt0 ltrxoctytfpD luvsls)seto(rpiy1ome mnviatfs2umxm ou4altnif3ildfsDumu s u4aleomr tydlpteaieo s)t2urio3nu1alenlneslsfaDrmx poo1tex  fciytfa umuvs (4texoifcto1fmt  ivs;(  2xm(rpny1ap elictlsfsrumxm ot1teto o3tytla2rl( sn()aetnio tydfmDraiesls s2xmxmpoy4omen fetlt) rurur nu4tet ifeilt m rauvp u4tlxoircootlpt lieol(0t2xrim3io4opt lnvia(fsrurur ot1oleoioeiat a2umumo;u)texomr3iy1opD aneslt)trxmxo3iy1op nmfvt s arumxrp;u1tpxn ietysfa rmu s;t)teenmfcoy1lpD  ies t)trum(r3iy4op emneil( a2tmuronu0altn f3tat s elu o;u4tetnmf ia1lpDeauvo;( tetmio ou1optelnvslt)aDur(mono0tleoiieiyt sDrmuvs u0 reoxf3iatomt aneolt s2tr(rpoydopeelnet t aruau ono4apx mfcildlm em(vo;(4alxrir iydom   uvi;s0 rtrxr iu1llt  ietatf rrmxr ;o1oexo oeiydfm ea(ms;u)alerio3iodla   n sl(0t2xrio ny1omt liesa()sDra(r nt1tetomo3tydla2um(mo u) lxrmf3tadop elu ol(0t2um(m iu4ope mnvt s  2tmum ;u0texoii3iadlm2emnvo;(0texomo tytoat lu il( truo(m3nudopen nvsas)a2taumonu4alx  oetat m2uanvs t0alxrmo oy1laDrlueo;t)trum(r3nu1ope  fcias) 2tru p;t1alx ioeiysfsDea( o t4artnxfctadfa r u ils0tetmxr iu1ll emfetlsf Dtrxr no4oetn feildfmDeaump;t4 rerir oa1lp r i o;s trxmxo3iu1lpeemnetl(f Dur(monu0tlt miciydlmDua( p t) rxoxfcty1fptrluei;t)s2um(r nodllte net t)s2um(  ot1aptnifeiat aDeauvp;t4aetoif oo1lpDeau o;s0teumio oudll nliviat)sDraumonu1aetniiciatlsDrmnmo t)aetnxf3iydopDrauesls) rurio iudapt lfvils) rra(moou1alxnmoetlslaDrlnmsnt4texrxf3oatfpD  ivs () exo(r3iodamenmfes s)arumuro;u4alx  ictldfm el(msnt) reoxf3oodopDraneil()sexoxrpou1op n nvt (faDtax p;t1teeomfeiadfs um( sn(4 etrxr ty1fmt aieo;s)srurio3nu4omtn nesltfs2tr( p;u0olenmiciysls ul( s t4aexrio iodfate n o ()trxoio iy1ap nlnvias)s2ur( p;o0ape mieiysfsDuanvp;t)aeenio tatom eauvols t2xmxm3ny4ll  mfetls) rta(  ot0aptn iciasfs em( ont4trtnxr3iodfpteaneo;t0 exrio ny4amtelivsls artm( o;o4altoiieilsfm2um(vp u)teenxf oo1lm r ieols) ruoxr ny4optemicil( srraxr ;o4alx ioetlt s2uan p;u4tetrmo3totfpt  n s ( tetmirpou4ll nmivi t artrxmo;o4tlto ociyd sDua(vs;u)altomfciatfmDeliei (0 rtm(mpnydapeelnes sf rtrump;t0oeto o3iysfsDrl(vs;t)texrxo todfp  lieo;t0trxoiopio4lltemfcs sfsDumur no1alx ioeild m2ul(msnt4trermr3iytlm e nvs t)tetr(rpnu4omtemnvslt) Drmu pno1alenii3iadlm2umumo;(4 rxrxo3ia1op eaieo s  2xoxo oodlptn fesa( srrru ono1tex  fetat a eluvs t4tltoifciodom  lnvslt setmio3iydlp e nvtlt arrau oot1alx mietadfs uanms u)tetrmr3iatfpDeauvo;t srxmio ny1amtemiciasfartaxmpnu1teto icilsfaDrmnmpnt) lerir3todla   ues s0setoir ny4am elnvils sruau o;t0tpxo oeiys m um( o u0 ltrmf3totoaDe ivo;(0s2trir3oo1ol nmfvi ( sDtrumpnt4oexn icildls2rm(vp u) reoxr ta1op rliei t0 exm(m3io1amtnmieta(  rumum nu0ale  fetad a ranmp;t)trenmo3ootlmDelivs (0trxo(o no1lptnlivtltfsruaxr ou0tetniietasla2ea(vsn() ltrxo3iydfmtr ues s0 rur(o3iydlm emfeia()arrr(ronu1aee mfcilsfs2rmumo t4 rerif oadla elu s;t)texrxr iu4amt lnvt t)s2rr(mp;t1optomf3ildfs rluvpnt0aeeniocto1fat  uvol(0trxmxr3nudlmt lncsl(  Dur(rooo1ole  oetasfm2ranms u4treoxf oydfpDr u o ()texoio iy4openmnvtasfs2umxro;o1teen ietad m el(vs;(4teenxr3oadla r nes;t0 exmxo3ny4om nlivilt) Dra( ont4tpe mfeiltla2ra( snt0texnmfctydom  aies;() 2toimpnu4amteliviltfa2trumoot0aeeoifcilt s rm(vpn()trenmr todlp r iei;()s2xoxmpiy1ape mfes ()arrmurpno1tpx  o3iys s uan sn(0teeoir3iotlm e uei;t  rurxo3io4omt livtls  Dtm(m no1aetnmietadlaDuaump u)tltomf3iodlateln i s)t2uo(o3nu4alt mfvtl() rraxront1texn ietas sDelumonu4tetnxf3oadlptrlneo;()trurxr3nydalte net ( aDuaxrpou4opxn iciadlmDeau snt4tltnir io1oat aieols0s2xoiopiodol  lnvsl(f 2rmxr ;u1oexomiciys m ua(vpn(4trtrioctadlp   ueo s trxr(m iu4amt mivslsfartaumonu0teenmociad m rl(mo u)tetrif ia1lptrlnvsls trumxr nodoptemivia(f Drr(rono4teenifctas aDean o;u0 lxrirctytfmt aivs (  2umirpou1ol elicta( srtaxrpno0alen feiytla uanmpnu0 rerxr3iatfptean s;s0 rxmimpio1lm n ivsls arrr(rooo4alx  f3iltla2ea(mo;() ltrmocia1oa  lu s t)srtoir3iu1apenlicil( s2umu pno4tltnmfetasls2emuvo (0aeeomf tytopD  ieilt0trtoxmpnu4om e neils) 2urxrp;u4aee iieiat mDua( p;(4trtnircia1fmtr ivilt  2xoir3iu4lmte fvil( srraxro;o0oexn oeiyt a2um(ms;(4alxnir iydfmD au ol( s2urxm ou1alee nct t)sruaxmpot4aex io3iyt sDumuvo t4alerifcoydfm   nvslt0trxoio nodlm  lfcsas)sDrrxr no1opeomoctlt m elnvp (4 ltrio iotlpDraivs;()sexoxm oudlp e nctltfartaxmpnu1oex  octatlmDuaumsnu) rtnmr3oatlp  luvolt  2urim3iudame lncsls  2rmu  no0olxniociydfmDemnmo;t4arermocty1fp elivslt  2trim3nu4openmivtat)srumxrp;t1tee moctaslmDuauvsnu0aetrmo3iotlmtrlnvo s)t2to(opnydom  mfci s srtau ono1oex  iciasfaDrmu snu)aleomf iadfat  n o s) 2urimpio1ameemncil(fsDtaxrpot1opxoifeiytfmDua( snu) etnxr oadfpDrlivolt0 ruoxm nydlmenlncs s s2tr( ont0apt  i3iltfs2ra( on()altomocootfp e nvsls teumxmpoydamee ncslsf Dtaur ;t1texoiocilsfa emnmonu) ltomr iy1lpDrau olt trxo(rpiu1lm emfes tfarra( ooo1oetn i3tadfa rm(mo u)trenifciytfmD  ivi ()s2tmxr3iudamenmfcsls  rtmxmont0aeeoiictlsfs uauvo t4aleomociodomteaues;t  rto(m3no4alenlfcil(fa2urx  nu1apenmoeilt aDeanms;t4tltnmf3ta1om rli sl(0 2toxopiodole  ivtl(  Dururono1tptomfeilsfa ranmo t4 rermr iy1lmDe n ols texr(o nu1aptnmietasfaDrm(  oo4optomf3tad m2ea( p (0 exnmr3iy1lp   uvs s  rurxrpoo4lm e ivslsfs2tmxro;u0tle  fctysla el( o u0aexrxfcoodom  lu ilt0 2xrio oo1ol   fcsl()s2tr(r nu4aet  f3tas a uan o;u)arxnxfcoytlateauvi;() rxo(rpiodlpe lfciat)arumx pot0altn f3iytlm2um( s u0 lerxocootfaDelnvils0 2trxo3ou4lltnlies tfa2um(  ou0tleniociys a emn pn() etnirciadfmtrliei;( trxmim3oo4am n nes t) 2tmxr ;o4apeomo3iyt a umu snu4 rxoif3oadopt  uvs;()trur(m3iydal emnvia(farrmxmoou0tpen fciltla eanmp;t)arxnioctydfpD  n o;(0 2ur(o3oydame mneilsf 2rmx  ;u0apto oeiydfaDemu p;t4aeenmfctatlatr i i;t t2uoxo oodomtn neslt)aDra(  no4oeenmfeiytfs emu p t4 lxomf oadla elneo s s2xmim3ny4altnlieia() Drmxr ;u4ope ii3taslsDelumo;u) renircoatop elivslt0sexoxo io1lp elneiltf rrr(ro;o1oet  i3iat m ulu s;u)teenxocoy1lmteanvo t0srtm(opoudolen ivtls s2ua(mpoo1tpen ociydfaDul(vo;u0 ltrxr3iytlat  i o;()t2to(o oo1omtn fvtl()s2uru oot1oetnmoetyt sDum(vs t4teeriociadoat ln olt0 2tr(rpiy1op  mfvi (farrau  ;o4teeoii3tydfs umnmo u) rxriocta1fm   nei;s  ruoirpnu4lm eliesltf 2tr(monu0optn o3ils a rluvo;t4teeomrcoo1fa e ies ( srtrio ny1ameemfet tf rra( ooo4apeniiciys mDemnmp ()areomf3iy1omt  ies;s srxm(mpno1ap nmfet tf Dtaur nu0tpxoio3ilslm rlumon()aeeomrcoa1fa rlnvolt0 rtm(o3ou1al e ieta(  Dtm(roou4tex  ieilslm2rmu o (0tlxrxf io1lmtr nvo;s0sruoxm nydam elfcia(f rrau  ;t0tltnif3ildfs2eln on(0tlerxociydlmD ln i;t) eumxm iy1opt  ncsl(farta(rono0aptomfetltls2rlums;u)aeeoxf3oy1lmD lies;s0trxoxmpno4al  mivtl()a2ta(r oo4tlxo o3iydlm rl( p (0aetnmr3iydlmDe i ols)trtoxopio4optnlnetls)aDtmump;o1ape  ocildfa2elnmp;t4 ltnxf ootlpt  n i s)seto(o no4ap nmicilsfa2rmx  ;t4alt  o3iasla2rm(vs;()aetnxo iytlpDeaiesl()texoim iydlm elnes () Dtr( ono4tpe io3ias a2uanmpnt0aeenif3iatfpDelneo;t) exoxrpiu1omtn nctl( srta(r ou0tle iiciatlm ean p u)trenmo todfm eaivolt sexrir3ou4olenmict sfs2rrur ;o0tptn o3ilt a ranvo t0tltoir totla eanvols)s2urxmpiy1ole  neta(  2rax oou4apeo fetldfm rmu o;u0arxrxf totfat lieo;s0teumio3iu1omt mnci t)artaur ;t0aeeomfeias mDranvon(0 rtniocoatfaD lnvi s truoxopnudal   iei tfsrurxmp;t1tlt moctltfaDrmuvpnu)altnmo3tadfate ieols)sexrio nudoptemfvtatfsrtax ont4tlx mf3tasls2umu snu0teenmf tatlm r u o s0sexoxopoy1apt micias)arur(moou1texomictad m rluvo (4 lxnmr tydopDr uvs () rumxrpnu1lmeeliviat)a2uaxm ot4tlxnmfciltla umump u0 rxrif iytfp   uvsl(0 2trimpnodll nmivilt)s2rmu  ;t4aexomoetasfmDrau p;t)texnxo3ootfpt lieolt0s2trir3oudlmtnmfesl() ruax  nt4opeoio3tydfs2ean s (0tlxrmo3ta1latraiei s trto(opno1aptn fvsatfartm(m ;u1apxoiiciyt a2rmnvo;(0 lerxo tydopteanvs () rto(r3oo4lme mneiat a2rmur nu0opt micildls eln o;t4teenmr3tytla rlneilt)t2um(m3no1lm   neil( aDua( pno0tpxo f3iyt mDrau pn(4trenxr3tytlmD lu sl(0srum(rpou4lpe mfvi ( sDumxm nu1aetnmfciyd s2uln o;t)alxoxo3ta1fpDr ivo;s t2to(o iudoptemfvsltfaDrmu ooo1teeoif3tadlmDrlumo t)texrif3io1lm  an ols0t2xo(m oodopte fcs s)artrum nu4optomo3iatfa2eanvs (4arerio3oodoatraivs;()t2tr(o3oydap   iesas)sDtaxro;o4alenifciysfmDul( p;t0 leoir3oy1op r n i t) 2xm(rpoudlme mfvsa()srua(mono4opx iicildfsDran s;u4tlenmf3todfa raies;t0 2tmio3iy4oltemnesat srtrurpnt4tee io3tltlsDul(vo;u)arerifcoydopDeln o s0 ruoim3oo1ome mnvilt)s2um( oot1tlx io3tatlaDrm( s;(4arxnxo iytfmDelueils t2trim iodomeelfvs sfs2rmxmoot0aex  ietyt m2rmnmonu) etomr iy1omt an ilt0tetm(o3nydop  lncslsfsrrm(rpou1alen o3iyd m rlump (0 lxnmf3ootoa   nvi;s0s2tmxm iu4ole mnctat)sDum( o;u1aetn f3iydfm2rmnvp u) exnmr3iydom eanvo () 2uoim oy1lmtn icil(f 2rmxmpot4oetn iciys s2ea( o;u0artnxocio1lpDeau i;t  rxoxr3oy1ap nlivsls s2tmxro;o0aexnmi3tydla emuvp t0 rtnxr oa1oaDe u s;t) rxm(o iy4alt lfctls srur( o;u0tptn fctadfa ranvs;(0 rtomfciydlp  an s;s seurxm oydop nlnet ( arrrx ono1oltn o3ilslm2ulnmo (0arxoxoctodopD anvs () rxmir3io4amtnmncils)sDrmu  ou0aexomf3iadfs rmn s u) exnxf todom e uvo;t  rurxm oo1lm elicslsf Dta(r no0aptnmictlsfa2el( s t0tleomrcootfmtelivo s0sexr(o iu1omtn ieias arraxrpoo1tpt  i3iydla2elu o;u)aleoxo3iotfat lueo;t0teurio3iu4ap   ivt s  Drr(ro;o4texomi3tytfmDrmu o;(4tltnmo3totoaDe nvi (0t2urxr3ou1omtnlnciasf rtmu poo4aptn ietltfaDean o (4 ltoirctydlm  au i s) 2urxm3no1am nlnvtl(f rtr(  ot1openmietldfs2ea(vp;(4aexomfctatoatran sls0trumxm oo1lpe livi t) Drm( p;o0tpxomoctas m2ea(monu0 exrxo oa1la e nvilt)s2trxr nu4omee icsas) 2rmurp;t4aptoiiciyt sDelu p;(0 exoxfciotfptr u s s) eumio3oydlm emieta( srtmxm no1aleoifciytfs elnvo (0 ltrxf3totlpDrli ilt)tetrimpnydlme lncs () 2umurp;u4opxnmoctad a eau p u) rxrifcto1lpD au s t  2xo(m3iu4lmeelnvtat a2urur oo1oltn ieiyslmDemumo t)tetoif3todlpD livo t)s2uo(r3iy4lpe lieta(faDrrx  nu4aexo ociysls2emnvpnu4 exnio3ia1lm rln olt) rtrirpoy1ap emnvsa(f rum(ro;o0oexn octasfm2ean o;(4treoio oytlp  li sls t2xrxrpiudap nlieta(farra( pno0tptn ictldlm emu o;t4aexoxfciotop  aivilt)srtmxo oodop n iei t)sDrru  nt0tex ii3tydlm ulu snu0tetoxociatfmtraies;s texmirpnu1ame miei (f 2ta(mo;o0apxoif3tlt m2umnmp (4 leoiocoatfat  ivs t)texmirpou1amenlnciatf Duru ooo0oexnmiciasla2rauvp;(4arenxo ootfatr n ils) euoim oo4lltnlfvi sfsrua(ro;t4apx  f3tas m2um(mp t)trtnxr oatfp e uvol(  exm(mpio4omeemncsat  Drrur ;u0olenioeiad a ulnms;u)tlenir3iodfp r neilt)s2tm(o nodlpt  ivslt) 2ur( o;t1aptn ieiasfs rmumo u4arxrir3totfp  lu o;t) 2uriopiu4lmen ncilt) Duauro;t4tlenmoeiaslmDranvpnu4 exriociadfaDelues;(0trtoxo3iy1lm  mivt () 2raur ;u1olxo ociatls2eanmsnu) leomf3iydom r ieols0 eto(m io4llt lnetat  2taxmooo4oex mfcias s eaumo;t)alxnmocoytfmDr u ol()setmio3nu4amtn ict t)aDrm(m oo4oleo oeiltlsDra(msn()trxnmfcto1omD livol(0texrxmpiodlmtn ncs () rraxm ;t1olxomo3ilsla2ulnvp;t4aeenmf3totop e neo ()t2urxo iudlltelfes s)aDrrum ;t1tlenmocilsls2ean ont0alenmr io1oateanvi t)trurio nu4apenlfvi s)arraum ;u0olt iictlt mDemn o;(4tetoircto1opDelneil()t2toirpiu1omt mici ( arra( onu4oexn feiadfs2uluvo;t4arxoxr3oytlmD aieo;s0t2urim iudopeelfet sfsDraumonu1olxnioeilsls rlu p t)alxrmrctydlm  ln olt) 2uoxopny1altelfet ( sDrrxronu0tee ioctltlmDumn p ()tlxrxocia1la eli ol(  2urxr3oudap  mnctlt)arraxr nt1tlxomfeiyt s ra(ms u4arenio iotlmteauvo t seumirpou4am e ics s) Drmxr nu0oltn ieiat s2rmuvs t4trxoxocta1oa eaieils trtm(o3iodal nlivt t  rurumooo1opxn fciydfm em(vp;u) etnmo tatom  lnei;t0teum(r oo4al elfctls) Dtmumoou1tetnmo3iadfs el(vsn(0 reoxo iydlmteluei ( trur(r oudap nlics s  2tmumpoo0aeeo i3iadlm2elnvo u0alxomfciydlpt an o;( seuoim3oo1ame lfet s) rtaxm ot4aet  ieild m rm( s (0altrmociodlaDeau o;s  rtmir3no1omtnmiciat  Draxmpou1tlx  ociyslm umumpnt4 exoxociotoateanvi;s srxoxo nu4lltnlnvilsf rurxm no0aeeo i3iytlsDua( p;u0arxoxfcootomDrlneilt0 etoio3ny1lm   nviltf Drr(rpno1tpt mfetaslm um(msnt)alerxfctydlm elueo;t)seuoxr ny4olt lies s) Draurpnu0opxoifctltfsDem( o (4tlxrio3ia1fp rlnvi;s0trumxm3nu4ape lict s)aDtru o;t4teenmi3iydlm emnvp;u)aetrio3ootoa   ivsls)sexrim3nu4amt mfctl(fsrtaxrono1oexoio3taslaDrm(vp;u0tltnmf tydom eln sl( truoxr oo4lmtemfvtas)srurxmo;t1alxnioeiaslaDran pnt0 rtoiocoy1laDrlneo (0sruoxmpnydoleemnctlsfa2rrxmoot1aptn oetydla elnvo u0 lxnxr3oatlmtr nvo (0 exr(opnu1ll n fet sfaruax  oo1aetn ictatfmDrm( on(4 rtoxocia1lm elu i t  ruoxr3no1lpt mivtl(fsrrau pot1oeto feiad m2emu s;(0trtnmf oa1lm  aivo s teurirpoo1amtn ivtls)srtaxroot0oex  icils sDeaumo ()aexoircoytop   nvil( trxmim iydol e ivtas) rum( poo1alt ifetat mDul(vp;t4tltrxr3iotomDelu s;s)teuoir3iu4lmenlieiat)artmxronu4tpt  fciytls2el(mo;t0 exrxo3tadfm  an slt)tetoxo iu1ape mivil() Drmumoou0oltoifeildfsDemu s (0tetnxr3io1lp eln i;(0 2toiopiy4ll emiet s) rta(  ;t0alx  fciysls2ra( snu4aexoiocoytfa eau ils0t2tmimpiy1ll elicil(faDtm(rp;o0oet mfeiyd s2umump t0arxrmf oadlp eaiei;( srxr(mpio1lp nmfetlsfartrxmono0tpt mfetldlm2rm(msnt4 lxnir3totop e nei;t seurir3nu4ap e ieslsf Durx onu4aleniieiytlsDumu snu0trtnif oy1fpDeaiei s) rtrxopnodal elieilt) ruaxmo;u4alen icildfmDea(vp;u4altnio oy1fmt ln slt0 exmir no1lm e nvta( s2rrxmont0aetoifetytfmDemn o (0texoir iatfpt lieols0srtmimpiydoleelncia(fsDtr(mo;u0oetoifetyt aDumnvp u4trtoxo ia1lp rai o;s t2uoxmpiy1omeeliet s)aDrruroou1aex  f3ias m2uanmsnu4artoxf tatfpteluvolt) 2to(m iy4ame lncsa( aDuax  no1tee mfcild m uan s u0 rtrio3oytfmtraivo t sruoxm3no1lmt lncs t) rtmu pnt4oexn ieiyslaDraump;t4texomr ta1op  au o;( seuoxo iu1oltnmnvtat  Draxrpou1altomietyd m2uln s;(4 etomo3iadfpDrlu s;s0 rxoim oo1olt  nei ( aDtaxm oo0tlt mi3iytfs umn s;(0treoio3oatopD  uvslt tetrxmpny4lmenlivil()arraumpno4tpxoiictatls2ra( p u)arxomf3iydfateanvol( srxmim3nudol   fctl() 2ta(m nu0tet mi3tltfa2eau s (0arxnmf3ia1la rlivo;s0trxoxm nu1optelivil( arurur ;o4tpe  fctyd a rlumon(0alxrxfciadopD  ues t0t2uoxr3nodap nmietas)a2ua( o;u4aptomoetasfa2ulu s;()trerif tatfpDeluei t srxmio iy4olen iesasfa2um(mo;t0opxoio3iatlsDrmnms () reoiociydomt lieol(0trtm(m3ou4op   nes (  rrm( pno1olt mociys m ulumpnt)aeerircty1fpDrauei t0tetrirpio4ll emfesl()sDtmu  oo1tleoifctatfa2ranmsn()aeeomf3to1fa eaneo;(0sexoiopno4aptnmnvtls srta(mp;o1tltniieiatfsDuluvpnu4altnmr oytlmt ai s (0 exrimpiy4lptn nct t artrx ono0teeomociltfs emuvon()artnmr3iatfp e u i (0srur(m iodaptelfvtls)aDururoou1apxoiictldfsDrlu o;()texnxo3oa1opt luei ()s2uo(rpio4lp  mfcia( aDra(  no4openiieils m2uaump (0alxoio3todomte i i;s)srxrim3oydopeemieil( srraurono4opx ii3tldls elnvp;()altoxo tatoaDr nvo s0srurir3iudope lfvs s)sDuaxrp;u4oetnif3iys a2el( ont4aexoifciy1lmDeau s;t0 euoxmpoydapte nvs sfsDrmxr nu1olxnmfctas a2ea(vp t4tlxnmoctotlp rlieo;() 2to(o oo1lp elnvias)s2tmxm ot1aptomfetas s2uanmp;(0tlxnxr oadomt aieils s2to(o oy1amtelfeias aDtru pot4teto f3tltfm2emuvs (0 renmo3to1lmD  uvs s0 eto(o iydapee fct t)srta(m ou4tltn o3tatfaDem(mo u0 ltoirciotop e uvo ()s2xm(r ou1open fcta() rrm(rp;t1tleomf3iadlmDuaumsnt) leoxo tatfa   nei;(0s2xmir3oo4oleelfvt s)sDrru pnu4opx mieiadlaDemn sn(4trtrxrciodfpteai s s0s2xriopoy4apenmivt t s2uaxr no0tpe mieilsfm em( snt)aetoxfciy1fatrau i (0sruo(r iu4omtn nct ()arraumpou4tpt mocilslm2ua(von(0alxomfcoatomtr ieslt) exr(r3oo4ale mneiat)aDtr( ont1ope mfcilt m rm(vs u)tetniociotlaDean o;s0t2trir3nu4al  mfetltf 2raur ;t4teeo oeiltfaDuln s;u) lxnxf3iydfaD lueils0seur(rpno1apeemfei t) 2uru  ot0aetn feiadlsDrau snt) ltniocoodlpt  i ol( srtr(o oydapt  nvsas)srumur ou0tpxomoctyd m umumo;t)tetomf3todomtrluvs;t0srurxo oy4omt lncsat  Duaxr ot0oexomictydlmDra(monu0tltnxr3oytopDr nvils)s2toir3oodalenlncs t)arrax ont0aee  ocild a rmn s;t) exnxo io1fmDrlivi;s tetmir iy1ope lnvi () Dtrxmono0tptn fctatfsDraumo;(4aleoif3oo1faDe ivsls0trxoio ny1lp  lfeta()aDrmum ;t4oleo oetls a2ul( o (0trenmrcto1fmDe ies (0s2xo(rpio1ape mfci sf 2taxmo;o0ole mieiltlm ua(vs u4arxoxo iotomD auvilt)texm(opnudap n fviat)artaur nt0oleniiciyslm2rln snt0treoxo iatfaDrlnvo;(0srurxm nu1opt lies (f rtaur no1aexomo3tadlmDua( s;(0arenmociadomteln o ( srxmir oy4ape micsl( arum(r nt4aeeoifcias m2rlump u)aexnxoctydfa rau s s) exrxm iodoltelici ()a2rruronu4tpen iciydls em(vp (0texomfcoadopDelnesls0 rur(r oy4al e nvsatfarraum ;t1altoiiciydls2ea(ms ()trenmo tydfa ranvs () 2xm(o iy1ameelnvi sf rua(mooo4teeomfeiysfmDulnvo t4aexnmo oadlaD auvsl()s2xoim3nudole  nvi () Draxm ;t1oeeoiiciasls2umumon(0 lenmf3oa1latrai slt seuoxo nu1lltn feias sDumum nu4opxomi3iys s rm(vo;u4tetnxo todlmt livi;t teumio3nodol emfeiltf Dtmx p;o4texnmi3iadls2uln s;u)altrmrciotlaD auvils  euoim oydaptnmfvtls aDurx p;t0olto octasls2uluvont0 lxrmf ia1lpDran s;(0texo(rpiu4ol nlfctlsfarumum ;o1teeo f3iytfsDel(vpn(0 exniociatfmteauvslt  etoio no1lmen ivs t s2tm(r oo4oltnio3tadlmDrmn o;t4arermf3io1fp elueo;s  etm(o3oydoptnmfesat) 2umxronu1tlt  f3tlt a emn pn() rtoio3oytlpDr nvi;s) eum(rpoy1lm n fetltfaDurum ;t1oleoiociltfm2rm(vo t)alxnmrcoydfpDe ivolt)trxoxr ou1lm nlfctls)sDtru onu4oex io3iltlmDemuvs u0alenmo iatom rluvolt0srxoim nodolenmfvi tf 2ua(  no4olx mi3taslmDra(mo u4areoxo ty1oaDe n i;t t2trxo3iu4om n ics tfsDra(rpot4tlxoioeilsfmDel( o u)trxoxo3io1opt ln olt0 2uoxmpiodlleelicia()arrm(  oo4opeomfetasfm umnvs;t)tlerif oo1lateliei s0t2trim nodam  lfvtl(faDtr(m ;u0tetn ieildlm uanms t4tltoxr tytlaDe nei;t)trxoir3ou4ll  lies sfs2rax oot0aeeo octyd mDulnmpnu)arxoxf3to1opDrauvolt s2tmxrpnu1lp nlfetl( sDuax pno4ape  fciaslm ua( p t4arxoifciytom eau s t) exrxrpiy4ll nlieta() 2ua( oot1tltnmfeiasfm ulnms;t4alermf io1late ueo t) etoxm3io1optn feiltf Drm(r ou4oee mf3iyt sDrmn ont4arenif3tytlateaues;( srxoim3oo4omen iesas  Drmu pnu1aex if3iytfa rlnms (0 ltrmocoytfa eaivs;s) eum(m3nudllee nvsa(faDra( ooo1tlt ioctat s2emn o u0tlenmr3oytomtrlues;() 2toxrpio4lp  mncsa( arrrxmpnu0ole if3tltfmDeln o;(0aetnxf3tytomtrli s t0srxo(o no1llte nesl(  2umxr ;u0tpt  fciydfm ean p;(4tltoioctadfp  lu sls  2xoir3oudop eliesat s2umurp;u0altnio3tad sDuauvs t) renmr3oy1oa   ieo s s2uoir io4llenmnvi (f Dtmx  nt1aexn fetasfm2rlnvs;t)trxnif oy1oaDe uvil(0 2uriopoy4ol e fvtas a2tax ooo1teeo i3iyd aDrlnms () leoxo tytlpDrauvs;t) 2um(r no4ol nmfeiat srra(mpoo1ape mf3ias m el(mpnu0trtoxrctydlm r ies;t)t2xmimpiydaptemnvtls)arum(rono1olt  fciytlaDemn o;t0 exrircoo1oaDraivi;t)sexmirpiu1lme  fci t) 2uau p;u0tlen icias mDel( onu4arenmo3oatfp e u i;t t2xoir oy4apt lfvil()a2tm(  ;t0oleomfeilsfa umuvo;(4 rerir3todoatrlivo s0sruoxo nudlptnmnciltfaDrrurp;t4tleoifciyt a2eanmo;t0 leomo iytfp rauvsl(0sexrio3iodome lfctasfarrrx oot0aet  oetas s2eanvp u) rtrmf3oodlmtelnes;t0 rtm(o3ou1ame lnesl( s2um(moou1tptn oeils m ea(vs () etnxo3to1fmD aueol(0 rumim3ou4llt lnci tfa2rmuroou1tle  fctls m umumsn(0 ltnio oo1lmt livil(0 exoir ou1lp nliei (f rra(  ;t0oet ioeiasls2rlnmo u) rtnxo3tydlatelneo;s  2xm(o ou4ol  mieil(f rrr(m ;t4alen i3iasfa2uln s;t0trtnmo3totoate ies;t) eurim oy1apee nesls sruaumpoo4texnifctys mDrau p;(0tetnio todlaD luvsl(0texm(m3iu1altn ncsl( a2ra(r ;t4oltoifetlsfm uanms t4 ltoif oatfaDraivo t trtr(r oy1op e icsat sDtrum ;t0tptn f3iatfaDem(msnu4tlxrmociotlpteai o s0 2tm(r io1lmtnmnvs t  rrau oou1aee  o3tatfs2ea( o;u0tleoxr3tydoa e uvslt0t2uoxmpiy1omt livtlt)aDrax  ;u0tpeo i3tydls2elumon()aeenxfciy1om e u i;t) rxr(r3ou4lpe mivils srrmxmpou1open iciltlmDulnvs u)tlxrmr tatlmDr i s s0sruoxm nydlptemncsas a2raxro;o0tlenmictas sDranvsnt4artoxfcto1oaDrli o (0teuoxo3oo4ll e nei (farumx o;o1oexnii3iltlaDel(mp;t4 rxrmrcootla  anvo s)s2xmxr3ou1lp nmfesa(fa2urum ou0optoiieiatfa2rln ont)texnif3tatfaDr n s;s0 rtrir iydamte nesat)arraxr no0tpeoif3iys aDulnmo u4aetrio3todlpteli o s)t2urxopnu4openlivias  Dtmx  nu1optnii3ilsls ea( o;u0tlxrxrcoadfptrluvi ( t2xr(r ny1op emnvilt)srum( pnu0alxo f3iltfs rm( o t0trtrxociy1faDraieo;s0 2uo(m iy4lpeelivs sfsDrrxr ou4tpeo ietadfs rln sn()texomr3tydlaD  iei;s)t2xmir3iudamtnlieias) 2rrxr ;u4tpxn o3tysfs2rl(ms t) reoxr oydopt anes;t0 2xo(m3oy1al  mivi tf 2rau o;u1tetn ietatls2uanvs (4tlxrir oatlat  ieo s  euoimpoodol  lnct (f 2rr(m ;o0tptnmoetydfm uln snt) lerxr oydoaD lnei;(  rtoxopou4lp e fcsls sDtru p;o4teto feiyslsDra(vp (4trxrio3to1la  livs;(  rumxr3nudll n nesat)s2rau p;o4tlx moctydfs uauvo t)aetrifcto1lmtrlieil(0 rxr(r3nodapeemfvias  Dtmxmonu0aleoifeias s2eln ont)trxomr3iytopD  n s;t teumxrpnu1ame  ict t)s2ua(m ;u1aeenmieiltfm uaump t4 exoif oo1laDelneo (0seumxr no4omeemnciat arrmxmpoo0tlen ociytfm rmnmp t0arermf3oa1oa r nvslt  eur(o3oo1lltelivias  Drr(roou0aleoii3ild a2ul( s u) lenifcoatoate n i;t) rur(m3iu1ole mnvs s  2uru oou1olto oeiysls elnvo t)texnifcoatom e iei s0s2xr(o3iodale  ncs t aDrau  ;t1oee  i3tytla rm( p;()tltrmr3oatlm  anes;t)s2xr(opno4lmtnlfetas srrmxmonu0ope  i3ilt s emumont4 rtniocoytlateln sl(0t2xoir3nudalt mfcsl() rrr( p;o0tpx  i3tyt a2rl( s;u)teenircto1lmDraues s srum(o3iudal nlnvsl( s2taxroot0apx mi3tlsfm rlumo;t4altrxf3tatlp ranvilt  rur(r3oy4ap n ictat)sDurx  oo0oeen i3tlsfm2rl(vo (4aetrir3oytfm   ieilt0trxoim3no4ll nlicsat) rur(mp;t1tpxoiictldfs2ulu snu0altnir3io1fa rai o;t  etm(m oodopen ictl( aruaum ;t0alxoiiciasfm2um(ms;(0tlerir to1fptrlieol(  rxr(r iu1amenlfvt t)srur(mpot1oetn oeiytlaDel(mo t4altnif3io1oate iei s)tetrirpnydom elfeiat)srur( o;o1aeeo oetadfmDrln pnu) etrxo3iotfatean o ( trurxopnu4olenlnvt ()aruax onu4tlenmociytfsDulnvsn()alxnif3tytomt lueil(0t2toio ou4lmt liesls) Dtmxmoou1aet mi3iysfaDrl( p t4artrir3tatomD  ieilt  etrio io4ap  lfcsltfaDtmumono0olt mociysfa emnvon(0arermo3oatlaDr uei s0trxoirpno4ll elicils arraurpou4aexo oeildfs2rm(vo u0 rxoioctatfm eaies;s0tetmim3io1al n fct t  2ra(rpno4teenioctlsfa2rmnmo;t)trenxr3oytlpt aivi;(0 exoxm ou1amtnlnviat)sDtauronu4altnifciysfm ua( pnu0 exrir oydla e ivi t sexoxo no4lpte fcsatf 2rr(  ;t1apeoiociyslm2emnvo () ltoxocoa1oa  livo;t seumxo3iudomt livi ( sDtrx  ;o4ope iieiydlm el(vsn(0 exnif ta1fmteaivo;( texr(o ny4amt lfctls) rtrxm oo4opxo ocild a2rlnmp t4aeerxfctytlatr ivi t s2umiopoo4aptn nctl( a2tm( onu4opxo fciatla uauvp;(0 rermf io1lm r ivo t0sexrio3nu4lpen ncsas)sDtmu pno4oetoifctatfm2umu o t4trtoirctadfpD anvolt s2uoxm3oo1op elfeias  rumu  oo0open fetlslm2eln s t) rermr3io1lmt auvilt srurxm3ny1oltn fetat arumxro;u0aet  i3iat mDrln p;(4tetrxr3ootopD au ils trum(r oo4lltnmnvia( s2uax  no1opxniociatlmDra( pnt) lxrmr3tytfp raueol()setrxopno1lpte iei tfaDtax  nt1tlx moctytlaDrmump;() ltrif iydopD  ies;(0truo(m3oo4aptemfetls)srrrxr nu1tpxomieiasfsDrl(mo u4alenmr oytfp e i ols0 2xo(r3nydape lfvsls arurumpno0tlx mo3tltfaDem(vsnu0trxoio iadfm   nvi s  rurxopno1lp e netls)s2rm(moot1tpx mo3iadla2rlu o;(0alerio3oo1fm  aivsl() exr(rpiodopen ieias srtm(  nt1teenmoetld s eln s t4trtomociadomDeaneils0t2tmxm3iydlpe liciasf rtr(mooo4aexn oeiaslaDel(mp u0 ltomr tatlp eau i;()sexmxm3oydlpen nvs (f 2ra(mpnu4altn oeiltls2uln s;t4trxrif todlaDeaneilt)trxoxo ny1lp n ncs ( s2rrx onu0olxn i3iatfs rmnvsn(0 lenmr iatfaDe nvo s0trxm(o ou1ll   fvtl(f Dtaxmp;o0ape  fetltfs elums;u0artrmo oy1latrli olt)truoxo3ou4lltemiviatf 2uau  nu4olx mf3iydla2ean p u) renio3ia1omt  nvolt srur(r3iodoptnmivta(faDtmur ;u1apxomicils m2emnms;t) etrir to1fmDrauei;t  rxmxopio1ale lietlt) Dum( ono0tlto ociasls eanvo;(4arenxfcoadfateai o;t t2to(opou4lpee ieilsf Dtrumo;u4tpe mfeiytfm umums t0trtrxr tydlmD lu ols)trtoiopny4lm emfctat)aDta(ro;u0tlxn o3tltfmDel( onu) lxomrciodlmD  uvi (0 rxmxopou4op   fcslsfaDur(r ot0tet ifeiat aDul( s;u)aetoxr3oytlat li slt0teurio3io1olt lfvilt  rum( pou0aeenii3iatla umu p t) etrxr iydoa r neols trxoxmpno1alt lfvslt)srtmumoou4apeomfciatlsDrmnmo;t0 ltnxo3oa1lp eaieo;(  exoir3ou1opt lfesasfartru onu1tpx if3iatla ulnvs (0aleoxo3ootfm raueols0texo(rpnudlm nlietlsfa2rax onu4aeenio3iadls umuvpnt0teerxociodlmDrlu o (  2xmxm3oodop  lfesl(f Duru o;u0tex moeils a2emn onu0altoifcoodfp   u sls)setrxrpoudamt  fvi tfa2rr(mooo4alxomfciysls rmuvp;u) reoio3iotopt  uvo;(0 2xoxo oydamtelnes ( sDuaxr ;t1alx  o3ildlaDulu snt4tltnmr oadoaDeau o ()s2xmxr nu4aptnlfesas)artmx o;u4opto fciatla2ra(vo;u4tetrxf3iodomteanes;()trtrimpou1omtnlnes tfsrtmxrpnt4tetoiiciatfs rmnms;(0 etnxr iadlpD lnes s  ruoim3io1lptnlnvs sfaDra(mp;o0tpxoio3ild m2umn sn() eermr3oa1oaDrlivil(  etmirpiodole mneil( arrrur ;o0alenmi3tlt s em( o;t)artoiociadoa elu slt) rtoxo iu1ol nmict s)aDur(mp;t1aleomociad aDulnmsnt0alxrif iatlpte ieo;s0 2xoiopno1ameelnes ()aDtru pou4oeen fciyd s ua( s;() lermr iodomDr neils0trto(rpio4ll elnvtlsfa2rmxmooo1tleo iciytfa uauvo;() exnxo3oo1la r u i (0sexmio nudlp emicia( sDrrx p;o1apxo ocild mDum( p;t4altnirctydomtrlieo;t s2tmimpnudam nlfvi (  2urxmpnt4tle  ieild m2uauvonu) eenmr3tytlpDe u s (0 2tr(r nodolenlnetat a2raumpno0ole ioeils mDrmn sn(0tltrxocoy1oa rli s;t trurimpoy1lp   icsa(fa2tmum ;t1tpx mf3tatfmDrmnmpnt0areoxrcootop elneilt0srur(mpno4lme lics (fartrur ;u0tlxn f3iysfa eaumon()alerxr3tadlm eln slt)srxmirpiodop nlivtl(  rra(  ;t0tpt mi3iatfa2rlumsn() ltomo iy1op  auvi;s t2uoir3ny4llenmivi t s2rrump;o4tpt if3tldls emu s u) rxnmr3io1op rauvo ()trxoxr3oo1lp emietl(farur(rono0tpxo fctlsls ulu ont0treoxf oatomtranvi;s t2tr(r nu1am  mfetlt)s2um(root1ole iiciys sDuln o (0aexnmo oa1fp  an olt  rto(rpoy1alenmnctl() Dtru pnt0oltnmfcilsfmDrlnvo;t0 rtnxo iotopt anvi;t srtm(r iydlptnlnvslsf rur(m ;u4opeo ieiytla2ran p u4aetoircoytlaD lneol()tetmxo oy1lm  mncias  Dumxm ;u1tle ioeias sDulu s;()artnmfciy1fp   ueol()t2to(m iu1lptnlfvt s)aDtaump;o4optn ietytls ulnmpnt0areoxr3totoaDrlu o;s t2xmxo3nudlpee fes s)s2um(m nt1optoifetadlsDean pn(4arerxo todfa  ai s ()srum(mpiu4omtemivsa(  ruaxmpoo1oet iociatls2rau sn() etoxr3oytoaD ai il() eum(rpoydom nmfvtat s2tmxr ;t0ope ii3ilsls umnmpnt4tlxnxo oydlat  u i;t0 rxo(r iydamtemneia(f 2uaxm nu1texniociys m umuvp u4 rtrio3oytfa   ieo;( truo(r3oo1ap  mfcs s  Durxronu1opto ociysfaDea( p (0tlxnxf oodop rlnvi s)trtoxr3no1ap nmfcsls aDuaxr no0ope  ietld s2um(msnu4tlxomr3iodfpt  n o (0texmxrpnudaptnmncsas  2rruro;u0alxoiociytfm2eauvs;t4teerxociydfat  u s;s)setoxo3iudlmenmfcs () rtmxrpnt4oexnmf3iytfaDrm(ms ()altoxo3ia1oa  li olt t2umim nu4am  mict sf Drm(m oo4ale ioctas aDrm(ms;u0 reomf tytfpDrauvs t  exo(o oy1amtnlfvs tfaDrax pnu1teto octlt s2umn sn(0 lxomo iatfmtrlivilt)srtmxo3no4aleemncil(f ruaxroou4alxn iciysfs uanmp u)alxoxocio1fpD aieo s)srtriopoodal   nctl(  rtm(m nt4tpxomoctlt aDra(mp u4 leoif3iatlm  auvi;(  rtr(m oo4lptnmnct t) rumxmp;u1tlenmictlt a2rmuvpn()aleoir3oodfmte nei;s0trtoio3iu4lptnlfcta(fsDtr(rpot1teeomictldlsDemnvs;t) leoxf3totlaDean slt  euo(opiy1am n fvtls)sDtaxm oo4tpe ioetyt m2rm(mo;u0 lxnio ty1faDrlueo;(  euo(m iodam emivil(fsrrauroot4apeoiieiasfs2ea(ms;(0artnmo3ta1fpDranvsls0t2uo(rpoy4amt mivsa()arrmx pnu4tlxnmoeilt m emu pnu) rxomr iatfmt  ieolt t2urxo3nodome micilsfsruaxrpot0tetoioeildls2uln snu)alerio3iydlpteln i t) 2xmxr nu4ll e fctl( srrrxr ou1tpt mo3ias aDra(vp u)altnmo tadoa  livils sexoxm3nodol  lfcs () ruax p;u4teeo feiytla emn pn() etriociytoaDrau o;s tetrxo oy1ap  lies (fa2rru pou4opt  o3tasla umnvp ()aleoio3todfmt li sls)srurxm no1om  lnct t)sruru pnu1ape  fciatlmDea(mp t)tleoio oodfateau s s)teurim ou4amtn fvsl(fsDraumoot4tpx  f3tld m emnmsnt) rxrmo tytfat  uvo t) exrx
\ No newline at end of file
@@ -0,0 +1 @@
+ivs (  rxrxmpnudame lnet tf 2tmx o;u4aleo i3tlsfm ea(ms;u)aeenxr todfaD  n s;s0sexm(m nu4op elies s) rrmx  nu0tpt  o3iad m2uanvp u4 ltnircoydoateln il( trtmxr3oudap  lnvi t sDtm(mpnu1oee ii3iasfm ua(monu4tetnircta1lp r ieils0tetmimpiy1lptn netlsf Drm( o;u0olxn fcildls2ra(vs;u0alerxoctydlaD aieolt0s2toirpio1op emfetas s2urxmoou4oeeo ictyd m rlu on(4trxnxr3oodlaD auei;( setm(rpiy4lptnmfvtls a2rmx ooo0tetnmo3tltlm2uan p;t4aeeoxo ty1la ranes;(0seuo(r oy4lmtnlieilt)srrmxr no4teeo fciyd mDem(vpnu)aexnmr oa1fpDeanvsl() rxrim3oy4ll nmietls sDrmumo;t0teenio3iad m2rm( snt4aeenir3oa1omD  neo;()teuoxopio1lmt mivtlsfsrurumonu4teeoio3iltla2emu p u4tlxomr iodfmtelieo s)t2toim iydam emivt s a2rrx  nt0oeen ieias a2rln p;()trtnxrctadlpD auvi;s0 ruoimpnodlpe mivt s a2umumpot4olx moeiytfa2uau o (4tetoir ootfmDrlnvo;s)trxriopnu1oltemnetat artax pot1optoioetydfaDrmnmonu)aexnxf3todoat an i (  etmiopoudamtemivs sf ruaxr ;o4tltnmo3ilt a2raumsnt4tetrxf ty1lpD anei ()t2xm(r3iydamtnlfetl() rtaxm nt0apxnmo3tys aDemu o;u4trxomrctotla  au ols0 etrxmpiydlleemfctatf Dum(  nt0olxn oeias s rl(mo u)tlxomo3tydomtrauvslt0srumim iudom   nesltfa2rr(ro;u4tpxnii3ils m ulu p u)tltrmo to1omD ln s;s) 2umim oo4al emics t) rrmxronu1ope ifcias a ra(msnt4aetoif3oadlpt lnvo;t srxr(rpoo4om  mictlt  ruaxmooo4tlxoiiciyslm uln sn(0 rxnmf ta1lp rlnvs ( s2tmimpny4op  mnvsas srur(rpot1ape  ietas a eauvs u0tetnxr tadlaDranesl(0texmim nu4lle licia(  rrrx  ;t4aleo oeils s ea(mo;t)trxriocia1lpt luvo;t0s2xr(m nudoltnlnvs t) 2uau o;t0oltomoetld m2uaums;(0 exrir3ta1fm e ivi;t)s2xoimpiodaltnmnesas aDtmxmono4tleo feiasfaDuluvp;u)tlxomo oydlp  aivols  2toim3nydlpeemnci t sDururono0aex ii3ild m2ua(mo ()tetnmrctadlmD ai i t) 2urxm iydomen nci s  Dta( pnt0oex ii3iasfs ran o;()tleoxr tatoaD  uvslt0t2tmxo oy4ap elici ( srta(mpot1open f3tatfm umnvs (0arerirciadoa e ivsls  rtm(opnu4apt lics tfsrra(r nu4tltoio3tltlm ra(mo (4texoir3oytlp  au slt) etoxopny4aptnmfvs t s2taxmo;o1oleniieiasla2rl(ms;u)tlxrmr tytfat lieolt s2trim nudom elnvtl(farumxrpnu1tpxnmoctldla2ea( p;(4tetoirciodfmD lieo;(0teuriopiy1ale  iet () Dtm(m ;u1tpx mieiltfaDul(vs;(0 rtnxo3oytfat li i;s0t2uoxmpiydaptn ici s)s2rmx ono1tlt iiciydfs2eln p;u0tltrxo3ty1omD ln s;(  2uoxm3no4ll  lfvt s)arrmx ono4tleomociltfm2emn onu) rtomoctytlpDeaueilt0 rtrir iy1am nlics t)srtrxmp;o1tle ioeilt m2umums;t) ltomo3iodla rln ils setrxopoo4alt mnviat aDurump;t0tpe  o3tltfm2emumpnu) exrmrciy1fmDrai olt s2toxopoydame  fcs ()sDtrx  ;u0oetomicias mDrm( o t4 rxnxfcoa1laDrlivol(0srto(o nydlp elnvt ( srurxmonu1oeeomiciyslm eln s (0aetnirciodlmDe ivs ( setoxo iy4olenlivsas)a2taumooo0olt miciytfa rauvp;t4trxnif oa1fp   ies ()s2tmxm io1llt  fctlt)arra(m ;u4olenmi3tyd m2ua(vp u4tlermr3iytfp  li s s)trum(m3iy1lpen fetas)sDrrum nu0apeo o3iltfs2eln p;t0alxnxr oydlpDrlivo;t0 rtr(opoo4lpenmfcil(fartr(roou4aet  o3ild aDrl(vo t)altomr3iotomtr uei;t0srurxo3ou1omeemiesas srua(  ot4tle mociyt sDrmnvsn(0 etnxf3ty1la eanei t)s2xm(m nu4ll n ivsls)srrrxr oo0ole  octadlm ua( p;(4arxoio3todfm  livo;t0teuo(m oudll nlnct ()arum(r ou4aeen ieilt m emn onu)trtoxr tytfpDr neslt)s2tmim nu1apeemfvils  Drrurp;o1aetomo3ils aDul(mpnt4teerio3tatfaD  ivo;s t2xmxopoudlpte nvi s s2rmxmo;o4texomoeilsfa ulnvo t0aeeoif iadlpte iei s0s2xmxo3nodaltnmfesl(fsrrrur no1tptn fciydfaDelnms;t)aleoioctatom r i il()texmxm iu1lleelneiat)s2tau  no4oex mfeilt mDel(vsnt0texrxr3to1lmtelu s ( trur(r ou1ap elivsl(fsDtaxr ;o0opxoifciyt m2ulnmon()trtnxr oadfpD  ivils0trxm(m oudapt  iei sf 2tax  ou0alxniiciydfs2rm(vpn(4tltrmf oytop  lnei;s0seur(m iy1alt mfet ( srumxront1opx  iciyd s2umnmo;t0trerxo3iotlpteluvo;()s2xmio ny4ame mfet tfaDrrumo;u1tpxnii3tad sDea(vo (0trtrio ty1omtran i s  2tr(mpoo4amee fesat)a2taxrpnt1tlx ifetydlmDrau pnt)trtomociatoatelu s (  rtrxr nodlm emivtlt  2tr(roou4opx moctltfa ranvs;t)texoxo ia1lmte i ilt  rurxr3ou4ap nmfvilt) Dtaxmp;o4apto ieiat m um( pnu0arxrmr tydlaDraneolt teuo(o3iy4llte fvtls  Dra(rono1oex mictyslm em( p t) exoif oy1fpD lu o (0s2xm(rpoydlle  ivi tf 2rax pot4aetniietytfsDua(mp (4trxrif3ia1lp r n ols)texr(rpio1ll e fvtat)aruax oot4openmo3iatlsDem( on(4teerifcoodlpDe neolt  rum(r3no4ll  mfei () rta(mont4aexnmicias sDeanvpnt)aetrxr tatla e u s;t)s2urio ou1lmen ivilt)s2ta(ronu4olxn i3ildlsDua(vs;t0arxoxo3iydomt aues s srtoxm3nydol emivtas) rua(r ou1opxniietld s umnmsnu4 etriocta1laDe u ilt seuoxm3ny1lm  lfvil()artr( ono1aet  oeiadlm2uan o u0 lxrio oydop elnvs ()sexrxr iudole mivi t) rtruront1altn ociatfa elu p u4 ltnmf3iytlm r uvs (0s2tr(o3nydllte fesasf 2ta(  ;t0tpxnifetad sDem( s t) exnmociodfmDelnvi (0 rxr(m iydapt miciltfa2tau pnt0texoii3tatlmDrmuvp;()tleoxrcta1fa   uvo s s2xo(m oy1amtelnesasf 2ur(m nu4aleomoeiyd aDra(ms ()arerxf oo1omte nvil(0sexoxrpnudopeemies sfaDurx pno1oeeomf3iytfsDrmn pn()aexnmrctodlmD  u i;s sexoxr iu4olenmfesasfsDta(ront1apt ifeiat s uluvsnu)aetoiociotomt lieols) euo(o nu4al   fvsat) ruau p;t1tpen o3tlsfs2eln p;()trtrifcoydlmDeanvilt0trum(opiu1optnmfcilsfsDumxroou0tpt mf3iatlaDrmn p;t) lxnxocoa1oateanvslt teumxm3iudllt  fesl( sDrr(m ;t4opt  oeiydlm2ea(mo;t0tlxnio3iotoatrauei;s)seuoxr iodlptnmfvia(faDrruro;t1ole  ocilsfmDuanms;u)aetoifcoadop rlues t) 2trim3ny4ame  nvi (f rraurpou0ape  i3iytla emums u4areomfcoodop eau s s teurir io1am   iet () Dtmx p;u1alt  o3tlsfs rau p;(0aeenmf oa1laD anei;(  2trirpoy4lmtemfetas) 2rm(m no4olto octatfsDrm(ms;u4aexoir3ootoa e i ils0sexoim iydomteliesas srtrx o;t4altn ociysfsDumn p () lermrctotfpDr u sls  exoxo iu1apeelfesasfs2ra(rooo4aet ii3iyt a uanvo u) etnxo todfm  auvs;t0 2uoxr3io1opeemfvtat)aDum(  ;o1tltomi3taslaDrlnvont) etrmf3tytoa r nvils)t2toim3iudam   fesat)s2rmurp;u1tltoioctatlsDrl( s t4 lxoiociotfpt lueil(0 rxmio nudape lieia() 2tm(r ;t0oltn iciat aDum(vp;t4tetnxr iytfate i i s srurio oudlptn fct tfs2ur(rp;t4olenmociys m umu p t0teerxf3tytopte uvo;s sexoxrpiydlp n fcsas)aDum(  ou4texo ieiys sDea( o;u4 lxnir3tatom rlieo () rtoim3iy1llee ieta()sDrm(r ou1tlto octasfa ean on(0 rxoxr3oa1omDrlieols)s2uoxm oy4ome lfetl(f rur(m nu4tlx if3tyslmDem( p (4aeerxoctatlatran s;( seumim3nudlp emivtatfsDur(  no4tltn o3tadlm2ran o;()trtomrcoytlmDrlneo;() eurio3oudlmtn ivia() rumumono4oeto ociyt s elnvs;u4alxrmoctytopDe nei;t0t2xr(m oy1lm n ivil()sruaxm nu4opt ii3ildlm2ranvp;t4 rxrxr totomDeaues () rtm(o iu1omeelnetlt) Dra(ronu4tee mfciatls2rm(ms;u0 lxoircta1oaD lneils)t2xr(rpoy1lp n iesl(f Duaxrpno1tetnmiciyd m ra( o (0texoirciytom  lu ilt0setm(m iy4olte nvta(fsrtrumo;o1oex moctytfa2eaump t4tetrio3oa1opDeau o ( teuoxr3oudamtemiciat)sDurumoot1tlto i3iydla em(vonu) rxnmrctodoaDelnvi;( seur(m3ou1alt mneia(  2umumpoo4aet ifciydla2emn s () renif3iytoa eai o;( s2xriopoy4ape mivtl() 2urx pot4apxnioctatls2rau ont) rtnif oytop rluvil()teumxopio4al nmncsat)aDtau poo4oeenif3tydla rluvp;u4 rerir oadlm eaivi () rtr(opou1ope  nvs s)aDra(moot4tpxniietadlm2um(vo u)teeoxociodomDe uvils srur(o nydllenmncsasfsDta( oot0olt  feiyd aDraums u)tltnxo totlm   u i s  rurxopoy1lmenmnesas)a2uauroou0ole  feiytla2uaump u4 ltrif tadfm   ivs t) eurio3ou1lleemivt t sDua(mpnt0optn ieiat a rlu o u4tlerif ty1fmte i i t srxmirpny4lm e fci tfa2trxmoot1tpt  f3tytfs rm(msn()altrxrcoodfmteaivsl( s2xmio3io4open nctltf rtruronu1olt mocilsfaDrlump;(4 lerxrciytomD ln o;s srtrxm ny1ap n neilsfsDta(rooo1tlenio3iyt aDrm(vs u4 eenxrciydlat ai o;s0srtr(opoydolte ieilsf rurxr ot0tle  o3iyt sDuauvs (4 ltoio3to1latr 
\ No newline at end of file
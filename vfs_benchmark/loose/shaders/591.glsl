@@ -0,0 +1 @@
+n o;t  etrimpiu1ol  mfvtas) rra(mpoo4opxomiciadls eau o;u) etnxfctydlpD lueo t)trtmio3oodaltnmfvilt  2ururp;u0olen o3iydfm rmn s t4teeoxr iotfa  ln s;s0srtmxmpiy1ale mfcsa(farrmu oot1tee  o3iyd a rm(vont)areomrcta1fptrlnvi t)srurxm3ny4lmeemfct ()arraxrp;o0aeenifetatla2ra(vp;t) ltomo3iy1op e nvs;t0 2trxm nudoltemfet t)sDua(ro;t0aexo f3iatfsDul(vp;() rxnxf3iatfpte n ol()s2ur(r oo1omtnlfeia(  2urx p;u1alx iociltlmDranmp u4 lerifctodlateauvslt0 rxr(r3iy1ome lneia(f Drm(rpnu1tetniociadfm2uan s t)areoxo oa1opDelnvo t srxr(m nudop e ici t) rra(mpoo1alenmf3tad a rln s;u4tltrmfciatfmD  uvs s) 2xmxm oo1altnliet sfsDumxrpno1aee io3iytfs uau o;u4aexoir oo1fm   ueil(  rtm(o nudoptn ies ( sDum(rp;t4opt  iciadlaDul(mpnt0 etnxo3oy1lptrlivo;t srur(m iy4lme mnct tfsDtrxm oo1aptomi3tas sDul(von(0teeniocty1lmt  u sls s2xmim ny1olee ncsa()srum(rooo4aexo icildfs ulnvs t) etoir iotlmD lieil()teto(o ny4ll nmivil( sDrmxrooo4alenmo3tydlm um( s (0tltoxr3iytlm   nei (0srtm(m3oodol nlicsa(  2tm(mpnu1tlx  fetas sDua( on(4tlxnif iatlpt  i il( texo(r3io4lltnmnvil(fs2um( o;o1oleomieilsfm eanvonu0 lxomoctydlpDe nes t0t2tr(o3oydalee netl(f 2ta(  ot1aet ii3iytla2uan o u4alxnmr3iatlpDeluvilt0trurxm3iu4lmtnmfcia(fa2tr(m ;t4tltoioetadla2elums;u0tetrmrctytlm  anvils  eum(o3iudol nmies s)aDta( p;o1aleomfeiys aDul(vo;t4trtrifcty1oaD aivo t0seumio3no1op emfcslt)arum(rpot4ale io3iatfa ul(ms t4areomr3iadlpt livi ( s2tm(m oudom   ncsa( s2urxrooo0tpe if3tytlaDulumo;t4tlxrifctotoptelivil()sexrim oy4lptnlfet ( arrr(mp;t1alenmf3iysla2rm(vp;(4aetoio3iadomDeluvilt  eur(mpou1lmeeliesasfsDtmx  oo1aexo iciydfmDum(vpnt)tltrirctytlp  ai slt) 2trio3iodlp nmivt tfsDur(ro;u1tpenmoctasls rln s;(4artomf tydomteanvi t srxm(m3nodomeemivia(fsDtmxr ;o0tlxniicias sDra(vpnt)alxrxf iatoa elu s t0 rumiopou4lp e icsl()a2um(mpno1tlenmi3ilt mDra(vsnu4 ltnxr tydlp e ivol( sexrir3io1al  lnci tf 2tm(rp;u1tee mictyslm2uau snt0 eenxfcoodfp r nvs;(0trxrimpoo1altnlncia()srurxrpno0apxnmoctls m2uln o;u0 rtoxf oydlp eln o;s0trxo(m3nudop n fvtls) rrmxrpno4apen ocias sDem( s t0altoxo3oatfpDrli i;t0 2trim3io1lmtnmnes tfartr(moou1olen iciyt m2ul(vo (0texnmo3oydlpD  uvolt)s2xm(rpio1amtelncias a2uau  ;o0tpeomo3iadls2um(vp t0aeerif3totlaD auvo;()srumxopiy1optelfcsl(  rtau p;u1tle  f3tydfmDeluvs u0 ltoxrcoo1oatrai i;t setmxrpiydlm emnvsas a2rm( o;u1tlxoiiciasfsDumums;(0aetrxocoa1lmt lies s s2xo(mpoo1apt  nesls)s2rmu p;o4tpen ocilsls emuvonu)arermr iydlptrai s;s) 2xmio3iu4am elfvs s aDua(m ;u1tpt ifeiat aDrlu s () rtrxfcia1oat au i ()texm(o oodap e net () Draumoot0aptnmfciytls2em( snu)alerxoctadlatranei s0seuo(m3nydlp   icils sDraxroot4opxoiietysls em(vs u4aexoxo3oatom e u i s0trxo(opnu1olen nct (fs2rrx o;t1tlxomfciysls emnmp;() reoxfcoatlat aieol(  exrxo3oy4omtnlietl()s2tr(r ;o0ope mi3tyt aDuanvpnu4 rtomo3todfat  n o t)truoxmpny1lpt lfeia( aDtmxmpnu0tpt ifciasla2rmuvp t)trxoxf io1oa  luvi (0 exmio3iudamt mfviatf 2ua( o;o0olxnmoeiadfa emums;t4 rxnmf3iadfmtraneo (0srtm(mpny1ome livilt)aDraurpno0aeen oeiltlm2rlumsnu) rerircty1fate iesls)s2umiopiu1ale  fvsa(faDumu p;u1tlen fciadla2uluvo u)arxrifcoytomDrauei;t trumimpou1lp   fvi ()s2trxront1apxnii3tlsla ranmo;u0aetrmo3ia1fmD lu i;() eumxo3ou1ap  mneias  Dum(roou1tlt mfctldfsDum(mon(4 lenirctotfmtelnei;s0srxm(rpno1ap  mfvtlt) 2urumpoo1apto fciad sDuauvs ()aetrxf3tydomD lues s srurxo3iu1lltnmnciasfsrtaxmp;o1aet mietaslsDeln sn(0tlenircoa1laDrlues;s0sexrir3nu4olenmfvi s) Durur nt0tlen o3iasla elu p;t)areoifctadom eaues s0setoiopiu4lle liet (fsDrmur oo1teto ieils a umn s;(4 lxrxf oa1oate ueo (0 2uoir3iudom  mivsltf 2tmur oo0apto feiaslsDeauvsnu)artnifciy1fmtran s ( s2xmxm3oudllte iei ()a2tr( pnu4tex mi3iatfmDumn p;()altrxo oytop r ueols0seumxo3oodal emivsl(fa2ur( onu4texn ietlslm rl( o (0 reoif3iotfmD lnvs ()truoir nu4ape mncs (f Drrxro;u4oee mo3iyt m um( s;u4texoirciydlmDelneslt0s2toxmpoy1amte fctasfartmu  no0aeeniietlsfa2rm(vp u0aetnxocoa1fmtranvo s0teuo(mpiodlmt mnvt sfs2uaumpnu1tex if3ilslmDul(vonu4 etomociydopt  nvi;t  rtoxrpoo4lmt mfvtas sDtm(m oo0olx ioctat a2rauvo u)aexnmocia1omt  nesls)teuoirpiudom n fvsat) Dumum ot1tlt  f3tyt mDrlnvp;t)alxrxfcoydlp elies;t)srxrxopio1alt mivtl(fsDuaxm ;u1oex  oeiydfsDum(monu0arerxocoadfpD  nvs;s  etrxmpoo4lltn icsat  rururpoo0alx  ociadls2eaumsnu0 rtniociatfat aies;s0s2xrirpno1olt  netlsf Drrxroou1aptnii3iyd s uaump;u4alxrxf3tatfm raivo t)s2xrxmpny4lm elneilt)s2ur( pnt4oexnii3iytlmDemn p (0 rtrmf tadfpD luvs;t srxoio3oo1optemivt s) 2taxm nt1opxomictatls2eauvo;(4 lerxo3todlpte ies;(0srtr(r3oydap  mncsat  rta( p;t4aexn o3ildlm ea(vs;(0 ltnir totoa eauei;( sruoxr3iu4op nmiet sfaDtrurp;t0aleomf3iad s emnvs;t4altrxr tydla raivi;s0trum(r iy1ll elivsat  2trur ot0aeeomoetls aDumn o;(4 ltomociydfmDeai i;t0 rtoio iy4al emieilt)sDtm(mpou0apen fctyd aDel(mon(4 rxoif3iy1omDe ueols)seuoim3oodlpe lncs t a2trxmp;u0aexnmoeils a2raums (0aeeoio ta1fm  li slt)srtm(opno4lle  fctatf 2rrxmoot0ole  f3iltfaDemuvo u0texomr iytlatelnei s0sexrxrpoy4lm emfctlsf 2urxr ;u0texoifctlsfmDemnms;t) reoiociodla rau o ()setrir oodal  mivtatfsrua(roou0aeto i3tadla ulumo;t)alxoif3oatoptrauvs;(0srtmir oy1lpee neta(  Drr(mpno1oex mocias mDemu on(0 exoxo iydfmDrlu i;s) euo(r3oydlmenlict t  Dta(mpot4alxnmietydfs2ulums (4 lerir3oadlpDrlieo;t)setr(rpoo1lltnlnct t)aruax o;t1texo icias m um( p (0alenirciodop r n o;s)sexrir nudopte ncs () Duaumo;u0olxomoeiad aDuan ont)texrxr3tytlm  anvols texrxmpno1altemnei t srur(mono4aeenmfetysla um(vsnu) rxnmo3ia1fm   ivi (0 ruoiopiu1ope livtltf rrmuroot1tleoifcilsfm eluvo t4 rxoir oodfaDr nvo (  2tr(r oy1op  miesa(fa2tm(mo;t4opx if3iat m2emumont0 rerir oytfate i sl(  eumxr iy1oleelnctltf Dua( ooo4alx  oetysfa2emu ont0aexoxrcoytfpt auvi;(0 2uo(opoy1om elfvtls  Dum(mp;u4alxo o3iadfa ulu pnt)trtrio3oytfmt livs;t) eumir3io1lm nlnvi ()aDtm( pnu0aptnmf3tasfsDemu p;u4arxrxociydlpt  ieo t)srtoxo3iy4lptn fvslsfarumu  nu0oleoifetltlm ranmp;(0 rermr3iytomteluesls trxmim3no4lle lfvsa()aDumx  ;o1aeeoifctys s elnmo;u4arenxf totlp e nvs;(0srtmxrpnodll  mnvi (  Duaurpou0teenmoetasla el(mp u4texoif3oatfm e iesl() etm(mpiydalee fcias)s2uax  ;o0tltomietydfa2uan pnt0 lxnif3oo1fmt  nvo;t0srxoio io1ome  fciasf 2raxm ou0aptnmfetys m2ra(vpn()artomr ty1lp r uvo t0 ruoxm nudlleemivi s) Dtmxmooo4tetn o3tld a2uauvo ()teenxf todlmD aieilt0texr(mpoo1alt lfetas a2um( ono1texo i3tls a el(mo;()trxrif io1opt lieo;t t2tmxr oy4op emiei t) rrauro;o0oltnmociysfs2em(ms () etnmo todfm r n o;( s2tr(r3ou1ap nlicsa()srtr(  ;t0optnmoctlsfmDra( s;u) exnmr oadfp  aneols)srumxo iy4open fei (  2tr(mp;o0oee ifetytlsDemnvs t4teermo oytlat luei;()t2xo(m oo4optemnei tf 2rm(  oo1tex mi3tld sDemumo (0texrmfcoy1fmt au ols0t2tmir3iodal n nvtls) Durxro;t0oet  ictyd s2umuvp;(4 rermr3oadop  au i;t)s2umxrpiu4amenmivtls a2rrur no0olxo oetyt mDeau o ()artnmo3todfaD  u o s  exrxrpoy1op nliesa( s2rmx  ;t0aexnifeiytlsDra( pn(0texnmo3io1omteluvs t)seto(o no1ame lnvilsfsrtax  ;t1oeto i3tatfa2rm(ms t) rxoxo3oo1lat lnvo;t)sruoirpiu4lleemictatfarraxmpoo0apxomfcildls2emumpnt)aleomr to1fmDe i ol()teuoiopoo1lmen nci s)a2ur(  ;u0opto o3tld m2rauvo u0aleoirctodoa raneo;(0 2xr(m iu1alen fctat a2uaxrpoo0openii3iydfm2ea(vp;u)trxnxr3oytfmDraivolt0trxo(r oydll  lneil()a2ururpoo1aptoifciydlmDrm( s;t0texrirciy1lm rau o;s) rto(r3ou1lp e netasfsrum( o;t4apx  iciys s eln p;u0tetrxf oodfa e uvi (0teum(m3nudol nlncsasfsDta( p;u0tpxoifetyslaDemnmpnu0tlenirciotoaDelies ()setmio3nu1altnlfvs sf 2umu ono4oeenio3ildla emnmo t) leoirctadfptelueilt  eumim iu1alen feilt) rraumooo0alto f3tyslm umnvs (0 etoxocio1fmtelneslt  rxo(rpou4ale mfvslsfartmur nu4olxn o3iytfa uau o (0 exoxfcio1lpt anes (0 etoxopnodlm nmics (  2uaurpot0aptnmoeiasls2eln p t4tlxnmrciatoptrlueo s)trur(m ny4oltemfetl( aDumxront1openii3iyd a2ua(vont)trxomr3todfm  livolt) exriopiudolenmnci (  Durxmpnu1tlxomietyt m ul(vp u0 eeoxfcoydlpDr ivs s0teuoxmpny1amt lfctls) Dtau  ot0opt  ociytlmDrlnvs;(4 ltoiociodopt  ueolt  2trxo3ny1lmenmictasf 2ta(m ;t1oetnifeildfm rlu o;(0 ltnmocty1lmD lneo t  eumio3no4lmenmfeia()s2ururpou1opt  ietlt aDeauvs (4alxoxo3tatla   nvilt srtoio iy4ll  lnviasfs2raxmp;t1apenmieiyd s rm( o;(0 lxoio3oa1om elnvs t)tetmxmpio4llenmnvil()aDua(m ;u0opxn icildla rlnvo t)aetrmo iotfaDeaneils0 exmxm3no1op   ictlt) 2urx  ou1olen ieiydfs em(mo;()tetnmfcoydfmtrln i () 2um(r io4am elicil(fs2raxr nu1optomoctys sDeluvo (4aexoxociotopt auvols trxoim ny1amenliciasfs2rr(mp;t1tlxn oeiadfm2rlnmo u)altrirciatlat ai s;s0t2xmxmpoo1lm  miesltf 2umump;t1olto ieiadlm2uaumo;(0aexrmr iydlpDr nei;s srtr(o3iodaptnmncil()arra(r ;o4tltnmi3iyd s2emnmp;t0texrmr3oatoa  li o s srurxm nodap nlict s s2trxronu0oex  ieiad s rluvo;t)teerircto1op e nvs (0t2uoxr3oo4lmt  fei t)srrau pou0ope mfciasfmDuluvo;u)texrifcoatfp r n s ()tetrxr3iy4lmt lfeslt  2truroou0aeto o3iasla2um(mon()alxnirctotomDe iei s0setm(m3oy4lpen ncias  rum(  no0oex ioctadfs uaums u0alxoir oadlm eln i;s0 rxoxrpiy4lpt  ivsl() Dtr(rpoo0tlt io3iys m2eaump (0tlerxf3ootfa r neilt)tetm(mpio4ap   nvia()aDtau  ;t4aeeoif3iytls2ran pnu) reoiocoy1fate neo;t) rxrxrpio4ameelnet s s2rm( ont4apxomoetatfsDrl(mo (4trxomrciydfpDr i olt  rxo(r nudaltn neiltfsrraxmpnu4tlxnioeiydlaDeanvp;t4alxrio ootlp   i ils0 exmxmpoodapt mfesas srrau  ;t4tetnmietytfaDrl(mp () reoiociadomD ai o (0setrim nudame lnesl(f 2ur( p;o0apeoii3iasfsDrau p t4aetomo iatlaDr uvo;t sexmim3ny4op elnes ( a2rruroot0olxnioeiasfsDuauvs u) ltomf3ia1omD au slt trum(r no4lmt lncsatfarum( p;o4aetomfciyd sDea(vp;(0 ltrmoctodop  ai sls srum(o iodapenmiet ()aDtau pno0ole ii3tytfmDeaump u)arxrxo oy1lp  lnvo;s)seurxm3io1opte fetl() rrmx p;t1ape  fciys a2rm(vp u0tlxnxo3oatfaD aueo s)t2xmxm iy4lpen ietlsfarrr(  no0open ocilsla2rln o;u)texoir3oa1oateau ilt)truoxr no4amen ivs t aDta(mpno4tpe ioeilsls2uau p t4altnmo3iydlptrai i;(0s2tr(o3io4amtemnciltf Dur(mpnt4tpx mi3iatlsDemn o u4 etrxf3oydlmDr neol( s2xoxopiydolt mfeias)sDumxrpoo1oexomi3iydlsDea( snt0 leniocta1op   ueol(0 rtrxmpiudll nmnvtl( aDta(r nu4oltomiciytlaDean s t) rtomo3oo1oaDeln s s)srxoxrpio1opeemfcta(fsrumurp;t0opt  i3iytlm umuvsnt4 lxrxrciytfp  lu sl( sexoio3no1lm  miesa(  Dum(rp;u4oexniociatfa2emuvpnu0altrxociytlmteauei;t)trtr(o3ou4op nmivtat)s2taumpou4olxoif3tltlm emn p ()tlxoxo3totlpteaieo t)s2xm(mpou4olenlncilt) rumxm ot4tle  ocias a ea( p () lerif3oydlaDeanei t s2toir3oo4apen ieilt)s2rau ont0aeenmoeilsfa2uau ont4tlerxo3todopDrlies;t0texrim nudoltnmnetlsf rum(r nu4tet  f3iltfa2ul(ms t)artrircia1laDeanes s0srurim3ou4lptnmfeta()a2umxr ot1olxn fcilsfm ea(mp;u0aeeoxfcoodfmtelneil() rtr(rpiy4oltn nct ()sDuax oot1tetoif3ilsfmDulnmsnt4alxrxocto1oa elivils  rurxr ou4olt lfctlt s2rau p;u4aeeomiciyd mDumums u) lxrxf3tydoatelues t)srtr(r iu1llt lnet ()arrrx ont0aleomictatlaDumumo t0 rxnif iadomtr ies;(0tetoxr iu4lmeelnci () 2ua(rpot1tpxoiiciatlsDumnvpn()altomr io1opte ivs s0srxmxo oy1al emies s)s2urur ou1aeenioeiytfs rmu p;(4 etrmf3oatfp r nvil( seuoxopnu1lleelfcia() rrm(  ;t1aetnioeiydfm um(vs u4 exrif3ty1op raivi ()t2to(opiy1optelnctas) Dtm(m ot0tpe  o3tls m rau s u)aetrio3oo1laDrli olt trtm(m io1lmenmnvtas)sruaum oo4tpeoiieiad m em(vo;(4trxnmocia1lpDr ues;t)srtrir iu4apen nesatfsDtmx p;t4tetomo3tyt a ra(vonu4artnxf3iatfpD anvo;t)t2tmxr3nu4ll emnetlsfarumxmp;o4alxo iciys m uauvs (0altnmf tatop  luei;(0 exoirpio4alt  fciatf Dra( oou0tlx  oeiytfm2elumpnt4altnmf oy1fa eli s;()srxmirpiy4open iciat)aDuaump;u0olx  ieias s2eln p;(0 ltnxf io1faDeluvi;(0srtrxo iydap  micslsf rumxmo;t1tpx mfcildla2um(mp;(0 rtrmf iydop  aivols0 exrxr oy4openlnvs s sDuaur oo4apx  ieiydlsDulnvsnt4 eenxo oytla raueo;t0s2xoimpiudlp nlfeslsfs2um(rpoo4optomfciadlsDea(mon(0aeenmo iodop  au s (  etmxr3iy1omtnlfvi sf Dua(mpot0tlt mfetys s umump ()tetoxo3oodlp eai i (0 exrim3iudalee fvt s  2urum oo0olxo i3iysfsDuauvo;u0 exnxocoa1la rlivol()seumxr iudllee ncils aDumum no4tleo f3iyt s2eaumpnu0teenxfciytfaDelnvo;s t2ur(o iudlle  ieta(f 2trum nu4tltoifciysfs elnvs;u4 rxrmo ootfpDr neo;s)t2xm(o nu1ol  livils) Dtmx  ot4oetn ieild m rl(vpnu0trerxr tydoa e u ilt  rxr(o3no1om e nei (faDrmu  nt0alxomfeilslm2eanmpnu4aetoxfcto1omt aiesl() 2trir iu4lp n fetl()srum(moot4opeomf3iltfs ua(mp (0 ltrio3iydlpteliei ()srtmxm nodope  net sf 2uaumooo1apenifeiat a elumo;(4trenmf3iodfatraivi;(0srtoimpio4oltnmivia(faruau  nu4tpeo icilslsDeanmp;t4tetomrctatlm   ieo (0s2um(rpnu1lmee ivsls)sDuaxrpoo4aptnif3ilsfs el(vpn() exnircia1fm rli sl(0 rur(m iydop emnct s a2ua( ono4oleo fetls a ran o;u4 rtnxrciytoa rli i;t0trtmxo3iudlmtemneslt)s2umu  ;o4aptn f3tlt m em( p t4 leomf io1fateli sl(  etmxopnydale  ietltfsrum( o;o0tetniieiytla ulu s (0tlenir iydomDeln o;s0texmir3iydop   nvi s  2rr(  ou1oltoio3iadls rau o ()teermf3to1omDr n ol(0texm(m nudlmte neiltfsruru pnu0oexn f3iysfaDelu ont4aeerxrcty1fp r u o t0 2xm(o iu1aleelfesas)s2tmx pnu1olxnmi3tytfaDemumpnt0arenioctytlmD lueilt0t2tr(r3no1omte fvs ()sDumu pnt0oltoioeiat a2elu p;(0 lermrcty1lmD luvo t  2tm(m ou1amt mieia( sDrau  ;t1tetn ictadlmDra(vo;(4 exnxocty1fmDr u i (0 etmxo ou1llenlivsls  2umx  ;t0aexomieiys a ul(vo t0 ltrif tytoatrluvi s0tetm(m3io1ol   iviltfa2ua(mo;o4tltnmfciaslm rm(ms;t)texomocty1omteauvs t0s2xrxrpio4lm   ivsa(fsDuaurooo1tet miciadls2uauvon(0trxoxo io1omDeai o;t0srto(r ny1amtn fcils sDtmxmpno0oeeoioctaslm ranmp;() eenifcio1fp   uvs t  rtmxm3oydapte feia( sDtmxrp;t4tetnmietadfmDuaump;(4aetnif ia1lptrlivolt trxoirpno4olee neia() 2rr( pot4tltnmiciyt a2elnvo;(4aeenxf3iodla eai s;()srxoir3io4aptemncia() rrm(mpou0teeomieiltfm el(mp t4trxoio3iotfmD livo;t trto(rpiudal elivt ()arrmx  nu1aexomieilsfa2rl( s;t0artoifctytomt lnvo s t2xmio3iy4lptelieslt)a2rr(  nu0optnio3tat m em(vo t0tlxoio3iadlp rlivi;(0tetr(rpiudlmtn fctltfa2rmx pot1opx  o3ildfs ulnvp;u0artoircootfm eauei ( t2toir3nydllte fesa()arra(  nu0opeoii3taslsDemnvo;(4tetnif oydfmDe ivi;s tetrir iy1openlfvils a2ur(ro;t1ale iieiasla umn p u0 lenio oo1oat aueo t t2trxm3oudlmenlfci ( s2tmu  oo1tpe  f3iatlm2eaums;()artrio3oytomte uvo (0srtmimpnu4am n ieta( a2uauront0tlxoifetldfs ulumo;u0aetoif3oytop  aivsls  eurimpnu1omee nvt t  Dua( p;u0tlenii3ias m2rl(vs t)aleoir3oo1fa eanvi;t)trumxmpiy4al eliet (  Dtrxmp;t1oeen o3ilt m rlumo t) rxniocia1fpDeauvsls)texrimpny4ll emfct ( a2rau  ou0ope micild a2el(vo (0aeeoir iy1fa  luvi;t)seuo(rpno4am   fci s) Dtmxrp;o1oltoii3iat m elu o (0 lxoio3oy1lm  anvilt  2tmir3iodlmenlfvtl(  Drrxr no0tle if3taslm rl(vp () rxoio3to1optranes s texmxo oodalenlnei t) 2rrxr ou4apeo icias s2ul(vo (4alxoxfcoo1oaDeaivsls0teurim3oy4am e fcia() Duaumo;o0teeo feiysla2ranvont0 exoxr3oy1lp r ivsl( truo(m nodam elictls arurxm ot0aptnif3iltfa2umuvsn(0tltnxoctodop eln i;s) rtmir ny1opeemfcs s aruau  ou4aetoifctadfs2eaumo t4teerio totlmDeai s (0 rxmxmpny1lmenmieta() rtax oou1tpe mf3iytlmDrau p (0 ltrmfctydfaDrauvs t0 rumirpio4lltnmietl(fs2um(mo;u1tex moctytfsDelums (4 exrxfciotlatr ieo s  etrxrpiu4op n icsa() Dumxmoot0alxo fciat a umnvpnt4texomf3tydfpDrau slt)trumxo3iu4lpt  iviasfa2umxrpou0optnif3ilsfmDua(msnt) etoxrctydopDr i i;t)t2um(o oodap   fes s) Dtaxronu1olxniieiys a el(mpn(4arxoxf iy1la eauvsl( texrim oudlpe lietasfsrta( o;u1teen i3iat mDranvsn() lxoifciotlaDelnei ( trtr(r3oo1llt  iesls srrmx o;u1apxnifciydlm rlnvo;u4artnmf iytlatelnvilt0t2tmim3oydlmenlnctasf rrrx ono0oltnmfetas aDel(mpn(4 exnircootoatrlnes t)t2xmxo iu1amtnlfvi tf 2tmuroou0tpt  ociyd a2ulumo;u0 eenxf oa1fmtrai il(0tetrim ny4apenmfesls) 2ta( oot4aet mo3tys sDel( pnu0 rtoircia1la eauvi t) rtr(o no1ol nlivsat) Dtr(  ;t1tpt  fctlslsDua(mo t0 renxf3oa1laD an i t0s2tmir3nu4lp emfeta()s2rm(rpoo0opeomfetas sDel(vpn()alxoxr iydfp  auvs t)trxrio3oy4lmtnlncilt a2rrxmont4opxoioetlsfaDem( o ()trtrmf oydoa r u sls0 2xm(r3nydlmt liciasf rrmxmpno4olt iiciytla el(vs;() lenmr io1laD aueo s) etmxo oudam  mnvil( s2tmxmpoo0tetomieiys s2ra(mo;t0tleoif iotfmDraieo;s0t2xoiopnodopt mietatfaDuau  ou4oltnmociasla2rlnmpnt0arxrxfcto1fatr nvo ()srtrxr ny4amtemicilt arumurpnu0tlenii3iytfa2uau snu4artoxfcty1fa  au i;t) etoxo3iy1aptn fvt (farrmumooo4alxomocias sDelnmo;u4tltnxfciadopD ai s;(0s2xm(opny4ome mncil(f rrru p;o1aptnioctldfs rlnvs t4trtrifcta1fa  lu s;s) 2um(r3no4lltelietl( sDtr(m ;o4tex  ocilsfmDumu snt0aeeoxo iydlm rlu i;s0 2urxr nudlm   iet tfa2uru p;o1altn o3tytla el(vo t)alxrmfctodla  luei;s) eum(m3oodom elfei t sDumum ;u1aexnifeiadla2em(mo (4tltnio3tadfmtr iei t)texo(rpoo4optn nvt (fs2umu  ;u0open ictldla rlu s;u0 eermf iotomt lnvo s tetmirpnydlm n fes s)aDtmxmo;t4texnmoeiytla raumsnu4aleoif oytfm rlivsls0 2tmio3iodol  mnvsasfaDua(r ;u0tltnmfeilsfs2umuvo;(0trxrxr iodlmDran s;( teur(o3iy4alenmnei (f rtaxr oo4aex  i3taslsDranmsnu4arxoxf ty1lp  auvsl(0t2umxr no1aptnlfesls  2trump;t4oeenmfetyd m2uanmpnt4artnir3iy1fmte n ils0s2to(mpou1lpen ics s aDtm(mpoo4tex  i3iyslmDul(mo (0texnio3iy1fmt lnvolt0t2toir no1ope  feilt aDrrx p;u0olt if3ilsfmDeau snt0tleoif iy1lp ean s t0trum(r3iydameelfvs ()aDum(mono4alen o3tlsls2em( s;u0 exnmr3iatfa   u s;(0 etrxr3nu4op elfvtasf 2rr( p;u4oltniietyslsDuln p (0arxoir tydlpDran i t)s2xmir io1lmenmneia()s2urx  oo0alxnifetlsla ua( p t)tltrxoctatlm eliei (  rum(mpiydomtnmieia(faDuaur ot4ape  ictatfmDrmums;t4 etoir iydfa raiesls)t2urxr iodomt  ivt (fsrrrxmp;u0oex io3ild s2emnmsnt0tlxnmr oydla eanvolt)seurim3iu4alt mfvsls a2ua( onu4open i3iydlm eluvs;t)aeeoir3oodfpD lieo;t) 2xr(o oy4ole  ieiat  2trxmooo4oeen octad m rl( p t4alenxf iydlp eanvs;(  rxoio3iu4ameelieilsf Dta(  no1apxniietlslaDeln p (4 eeomoctydoaDelneol() ruoxo iudaltnmfvs t aDuaur oo0aeenio3iydfsDeln s () ltrio iotfmDraivo s s2tmxr iu4lle  iesl(fs2ua( pno0oltnio3ilsla2uanmo t0 eerir3iy1oatrluvo;(0 2trirpny1llt lfci s sDtr( pot1optnmi3iadlm2elnmo;u)texnxrciadlm e nvi t)texoxm oydomt  ieilt)arur( pou4aetn o3tldfs umump t4 rerif ia1oa e nes (0t2toxrpiodlp elncils aDurx o;u4tet iiciadfm2emumont)arxrif ootlaD  nvs;s sexmir oo4ole mneslt)aDrr(moou1aexniictadfm2ra(mon(4 ltnmoctotom r nvslt  2ur(r nudapen nvtas  Dtmuronu1olxoifeildls2uanmpn(0alerif iotomtelnvslt)srxmimpiy4ll e fct s srumuroot0apxo icild m uau o;(4 renmociatfateln il(  exr(rpiudaltn ieilt  2ur(moot1aleoiieias s2emnvp;t)aexrmfcto1oaDranvs;s)texoxopoydll emivt t arumxm no4olxnifetasfs umnmpn(0 lenir3oydfmtelu i;() rxmimpnu1alenmfct ( a2tru  ou0tpt  fctas m2rmuvs;t0texoxrcio1fp  aueo s)s2uoim3ou1lp nlnes sfsDtmxrpot0aexoiocilslm ea(mp;t)treomo todlmDe iei s  eum(r3iydlmen fvslsfaDrax oot4ape iietytlmDua(mpnu0aexnxo iytfmDeli i;s0 2xm(mpiu1apeemneia(faDurx  ;u4opt ifetlsfa rmnmp u0aexomo3totfa  aieo;t  exo(m iodalte ieil(  Dtmu pot0apxn f3iat s ean o;u0areomf3oytlaDrln i t0trxo(m3oodomt mnvtasfa2tmuro;o1tpx  i3tatls ul( s;u) lxoiocta1op elu s;( texoxr3nu4ole  ici t  2trumpoo1olt ifctltlsDea(mo;t0 renxo3oytla e i sls) 2xoir oodom  lieiasfs2ua(mpot0tpt  i3ildfm2umn s;t0 leomr3oatfp r nvo;s trtmxm nudap e icsasfsDtaur ou0apxo o3tyd a2ulnvonu4texnmr3oodlaDrlueol( setoiopoodlltelfvtl()s2rr(mo;t4tle mo3iysls eanmonu4 lerio3oydfmtrlueo ()texmxm3iu4lm  mieslt artaxrono0tpto iciys s2ulnvp u)aeerif3iy1lmteluvs;t0srxrxopiu4olt lfvi () rtm( pou1oetnmi3tlt s elnvo u) lxoxrctodfa  lnvi ( s2toir3no1al nlies (f 2rmu  oo0optomo3iadfsDuanms;t4 leoio tydlmt lu o t0t2toirpiodll  mncilt) rumu pno0apt  i3tadfm2ea(vs (0texrxo oatoa r ivs s tetoimpiodomeelfeias) Dtaumpnt1apt  ociltls2ra( o t) rxnircoatomtrlies;(  rurim io1al nlnct (fsDua(  nt0oetnmiciadla rmuvp t4aexrxo tydfmt aivil(  exoio oo4al emnvtl()s2trxr no1alx mi3iltfsDemnvpnu0tltnxfctadla eliesl(0t2toxr3oydoptemfetas  Dtmu  nt4alx  f3iatfs2eanvpnu) etomr3io1lpt livi;( teurxm3nudap elnei sf rrax  nt0teeomf3ildfa2eanvs;(4alxoxr ty1omDrluvi s0setm(m oy4openmneias arrmxm ;t4oltnmoeilt m emnvs;()arxoifciytomDeanei s0teur(rpiu4apen neslt) Dtrxm nu1tlt ifctldlaDrl( o (0alerxo totoa   u s;t  exmim3iydop elncs (fsrrr(mo;t0aeeo ieilslaDrluvo (0alenxo3io1op  lieils  eurxmpoydopenmivtls artmxmont1aleoio3ias m eanvpnt4 ltoif oodlaDr ues (0setoxmpno1apeemnvils  2taxroot1alx mf3iasfmDul( s;t0aeeoio3oytoat aivo;t0sruoio3oo4apeemnet ()sDta(rp;u4tptoioctyt s2rmu snt0trtrxrcia1op rai s;s setm(m iodlm  liet (faDumxm no1tex micilt m ran s ()tetoir iadlmteai olt t2tmio3ou1opt livta()sDtruront4tpxoiocilsls2elnvs;t4 rxomfcoy1fmtelnvs;(  rxo(r3iudlpt lfvi ()aDum(mpno1ole ii3iydfmDemumont0altoxocoo1oat au i t)t2tmxm3nu1am e ivias sDtmumpnu0oexnii3iatfs rm(ms t4 lenmr oo1oaD anvo;t texm(m3ny1oleemncsa(  rtmumpou1optniocias a ea( o (4aeerxr oadlpt ai olt0srxmxm iu1lpe mncia(  rumumoot1texnmociatlm rlnmpnt)tltrmo iytopDeaiesls)trxr(r3iy4lp elfctasfa2rr(m nu4apxo i3ilsfmDulumo t)texnxo oa1fm r uvi s) rto(r oo4lleelnesas)a2tax  ou4oee  i3tas a ra(vs;t4arxoio3iatoatrlues;s0 2urirpoudapt mnei t)srra(mpnt1aptoiiciltfa em( o t4texnif3iatlmt  u s s0 rxrir3no4ape  ivils)arurumpnu4aleo fetad aDrl(mo;t4alenxo3oytfatelu i;()t2tmxm3oodamtelfct tf 2uaxroot4tlt if3iysfaDrmu p (0 eermociydfatr n s () etmxo3oo4lltemfesatfarta(r ou0ope iociyd aDrm(ms;(4trtoxr3tytfpDe ivsls tetr(opou1alenliesas)srtr(mooo4teen i3ilsfaDrauvp ()aetrxf todfptranvs;(  exr(opnu1lpe lfvtl(faDtr( o;u1apt io3ilsfa2eaums;t4 rxoxfcoy1fa  li i;t0texrimpiu4op elfcil(fs2taxm nt0apx mf3tas m2um(vs t)tleoxrcta1omtrli olt  exo(o oo1lmtn nvtls)a2uaumpnt4opto ociatlsDrlnvo;(4 lxrir3iatfatelnvo t)seurio3oudomtn nes sf 2um(ronu4oeen ietaslsDulnvs t)aexomf3oydom  an o t)trtmxm nu4ll e netatfs2ua(mpou4aexomociasfaDelnvon(4aeenmrcta1opteai i t) euo(opou1ol nlneil( aDtrx poo4aeeo f3ilt sDua( s;u)texoxr oo1omte n o;t)s2um(opnydape  nes sfsrraxmpou1teeomoeiytfm uauvo t) renmrcto1lmDe uvi;t trtr(rpiy4ol elnciat)srra( poo4tlxo i3iydfsDuau p;u4alxnirciy1fpte nvi t)s2tmxr3nu1al e ici sfa2ua( oou0texniocilsls2umu ont0 etoxrcoo1oa eai s;(  rtoxm3iudal e fvs tfartmumoou4oltnmfctysfsDrmnmp;()aexnmo3iotlaDr i i ( s2xoxr oodlm n iesls) rtmx pno1tlt  fetldfa2elums;u0 etnmo3oodfm  ai s;( t2trir3iu4apeelfvtat arrru pno1tee ii3tasfaDuanmo t0artoxr3totlaD an s (  rtr(rpiudom nlics tfa2trxmpoo0apxn oetldlaDeauvpnt)tltnxr3to1fatraueo;t0tetoir3oodol   fctlt arrr(mpnu1tpe iieiatfaDuauvs;u)trenif totop  auvils) 2toxm nudoptnmfetls) rum(mp;u0ape  oeiasfs2rm(vp;t0altomf oytfmt  n i;s0t2tmxm3iu4ome lfvs sfartr(monu1oetoif3tld a rm(vpn(0aleoxoctatlpDr ies;t t2tr(opnydlltnlfesl()sDumxmpou4apx mietytls ra( s t0tetoxociy1fa   n ol( srtoxrpnu1ap nmncsl()arraumono0oeeomo3ilsla ua( s u4artoxo3iadlpDrluesls)tetmxr nu4ll  mncta(faDrm(ro;o0texniictat s em( o;t0 reomr3oo1lp eauvs;s)truoirpoy1lpeelncslsfs2tmumooo1opto ociydfs emn o u) rxrmr3iytoa rlnesls0 exoir3iy1ll nlncilsf 2uaxmoou1olxo f3ias m rmnmpnu0areoio oy1om  anvols)t2to(opio4om  lfcsa( srrmuro;o4tltnmo3iaslm2ra(vpnt4areoxf iadomtelueo () 2um(o3ny4alenlfcs s sDuau oot1aetoifetls s2rmn s;t)arermr3ia1fateauesl(0 ruo(rpno1omtnlfviltf rtr(  nu4tet mieiytlm ul( p t0 renio3iatlm rli o;s)sexrimpou4altnlfvi sfaDrm(  nt1tleomf3iat sDemuvp (4trtoxrcta1oat lueo s) rto(mpou1ol  mneiat  2umu  ot0oltnii3ildfm ra( s u4altomr iadfpt ln s;s0 2xoir3no1opee icilt)sDtr(rono4optniiciys a ra( pnt4artrxo oadoa rlneilt0t2urxopiu4al  mnctlt  rrrx p;o4apen i3iatlaDum(mpn() exrif oo1laDr n s;t)seto(m3io4optnlnciat a2rrur ;t4ape ii3tld m ra( p () rxomrcia1fm e iesls) 2tr(mpnu4omen ivt ()sruaxmooo4oetomieiys a rmnmonu4trenir iatlmD livols) exm(m nodlm e icsls  2rmx  nt0apxn ictasfa em(vp u)altnir3iatop rai o;(0 rum(rpny1apenmfcs tf rra(moou1tptniieiadfm2ul(vo u0trtrmf iytfmt  ueol()tetmxo iu1apt lfvt s)s2um( pno4tptnmfeils m uanvo;u0texnifcoy1fptraues s  rxmim nudomte nct t) ruaxrpou4aetomf3tlsfa elnvs;u4trxrxfcootla  li il(  etrxr iy4amen fetl()arta(mont0aeeo fciadfm eaumpnt)trxoiocoydla raieo;s0 rur(o3oodal nlfes s s2urum ;t1opxoio3iasfs2ul(mpnu4 eenmf oa1fmte ivo ( setm(r3iydopt mnvs t)sDrmxro;o1tptn i3iatfsDuan sn()arxrmo todlateln i s0 etrir3ou4lmenlici sfaDtmur ;t4tltoioetytlmDeln sn()tetnirctatomD anvi;(  ruoim3oy1al nlfvta()a2rm(m ;o4apx mfciyd aDeauvp t0 exnirctytlm rlieo;() rxoiopou4omtnmies sfaDumumpou0oexn i3iydlm2rau pnu4aetoio oodfptrlivil(  rumir3iy1olt  nvt s arrmx pou4apx io3iatfs rauvs u) etoxo tytfpDr i s s0t2tm(m oydaltelivslt a2rmx  nu0tlx  o3tytlm2umnvont0 ltoir tatomt an s;t  rtoirpiodape lietlt  rrrur nt0oexoifciytfsDrlums;t) etnxr3oy1lm  liesl(0seurxmpoydlme mfvtatfsruau oot1oleniociyd sDeln sn(0 reomo iytfateauvs;s trtrio nydaptelieiasfa2rrx pno0tle iocilsfa2eluvo (4 leomo oydomt livils  rxm(m3oy4alt mfvslsfs2urur ot1tetniociytla rl( s u) exoio iy1om e ueslt)t2to(rpnodomtelfet s) 2trxmo;u0aptn oetydlmDumnvp;t) etoif ta1lmDeln o;t0t2xoxm3iy4llt  ictltfaruaxmp;u4ope iietadfs2rm( o;u0 lxnif3iadoptraivi (  2triopio1lme lictat srrrxrooo4ope mfeiltfm uau s u4 rtoxocoy1opt an i;s)trxoio iu4lp  miei ( a2uax  ou1aptnmoeiys s2ra(vp u) etnmf3oydfm r ueslt0t2uriopio1opeemncsatfsDtaumpot1apenmiciltfm eaumo;u4 eeoif oy1lptr uvi;( t2xriopiu4lmenmfvsa(fs2tmxrpou4oeeoifetlsfa2ua(vont)texrmoctatlpD  ueol() rxrimpiydop  lfet (faDrrur ;t4tlxoiieilsfa eaump;t0 lxrxf ty1omD  uesls  2xoxm3ny4am nmietas aDtru  no1alt iietytlm rln p;()texnio iotfatrlu i;t sexo(mpiu1ol elnvsa(f Dururo;o1alt ioeilsla ua(vs ()tetnxf3ootlp r nvi;s) 2urimpno1omeelivt t) 2rmxmono0olto ictys s2rmuvs;t4teenxocio1fa r neo;t) rur(o no4al nlnvt s)a2tru o;o0tlxnmoeiysfs2ua(ms (0 reoxo oadfmDrluvi;() euo(o oo1lpenmiviltfaDrax p;u4tltnii3iydfm2um(vo t0 rtrmo tytlp  au s;s)srxo(rpiudame  ictatf 2umxmonu1texoif3iatla2ulu o t4texoxfciatlmDean sls0teto(rpnydll e feiasfa2raxmp;o1oexn i3iyd sDemnvo (0trerir3oadop eauvsls) exoir3oydope lict () 2tmu p;o0oleomf3tasfa2uln s u4aetnircoa1lmDeauvs;s0seurimpou4ome mncslsfs2taxr ;t1opx mf3tyt sDuanvs t) exrmocoa1lptelivs;t) etm(o iodaptemivsat) 2umxrooo0ope  fciytla2umn p;u4treoifciatoateanvo t)t2xoir3io4optn ivsas  2tr(rpou4alt  octldls uaumpn(4alxrirciydomtrlu o s)s2xmxmpoy1ol e iei s)a2rm(ro;u0aet  i3iatla2rln sn()teerxrciotfaDeanei;s)s2xoxmpnu4lm nlfvtl(  2uax  ;u0openmi3tldla2ranvonu0trxoif ty1omtraivs;t0srxrxm3ny1aptn icsas) Drax o;o4alx  f3tltfm2eluvp t0tlxoxrcoa1oat anei s0 2toxr3iu1opte iei ()s2rmurpoo0opxo ieildlm2ra(vont4alxnxr iodopDe uvs;t)trtoxmpoydomt mfctatfartaxr ;u4texoii3iyt s umnvp t4alermo oydfat li s (0sexrio oy1apenlfeiatfsrum(roou1alxo fciatfsDrmnmsn() eerir3iytfaD lu ols)t2xr(mpiydll emnesasfsDta(r oo1ole  i3ilsfm emu on() leoircoa1optrlu o s t2uoirpiy1lltn iesat aDtrumpot4aptomieiasfsDulnvo;u4artoxocta1op eau s;s)tetr(r ou1al e fcsa( arrmxrpnt0altoii3iasla2ul(mo () renirctatfmtr u o;s teumim io1op elncias a2ururp;t4ape ii3tld a em(monu)trxoxfciatfat lnvi ( t2xr(m3ny1lpee fcs sf Dua(mp;t4oex ii3ilsla ua( pnu0 exoxfctatfmtr ues;t)trur(r3oy4aleelnvs tf 2rr(mp;t0tlxn oeildlsDeau s;u0 etnmfciytomte ivol( sexr(m3oo4lp n ies t)s2rax oou4texnmf3tatfa2emu snu) lxnmr3iytom elneo;()seuoxo3ou4altemivt ()a2trx pnu0texoifctadfa2ua(vp;t0 eeomr3oadlpDraivslt trtr(r3iodop emnvsltfsDua(mpoo1tle mi3tyt s2ran s;t4 etnxoctadfm eauvs (0 etr(o no4amt  fct sfa2raump;t4oltoii3tlt sDrl( p t0trtoxfcto1om eau ils)s2um(m3no1ol nmnvilt  2tr(m nu4oex ifeias a2eanmont0trerxo oodfp  liei;(  rumim oodlptnlfeil(  Draumoou0oex mieias s elums;u)teenif3tydomD an o (0sruoxm3oo1omtelieiasfs2trxmp;u1aetoiociydlm emnmo u0 rtoxr3tydlp   ivo s0truoirpoy1lmenmfcil()a2umxmpnt4tleniictys s eluvs u)artnmociytlaDelnvo s  rtmio3iodamtnmieiltf 2uaxroot1olx mociyt a ea(vp t)arermfcoatfp rln s;t)s2to(m3iydlpenmies t)srraxrpnu1tpe  ictls a2el(vsnu0 lxoio todomD  ivi;(  2xr(m3oodomt licil(fartaumo;o0tpen fetadfmDum( s;t0alxomf3iydla r ieo () 2um(r iu4alte fci sfsDrrumpnt4aeeoif3iat aDeanmont0aetnmo oy1fpt ln sl() rurir3iy1am e ieslt) 2ur(rp;u1oeeoifciytla ulums;t0artrxr ty1om rli sl() rxrxrpoydlmtelnvs sfarumur ou1apx  iciatfa2ra( s u)alenifcty1oateai s;s setrir3iydopeelnetl( s2rrurp;u4opxoiictys aDumnmsn(4aetoio io1oa e u o (  2ur(r nu1aptnmfeia(fsrtm(mo;u0tlxomoctlt m2umuvonu) lxoxf3iodfp   u s;t trtmim ny4aptnmfcil( srtauront4aeto f3iatfaDuanvs;(0trtnxo3oo1oa e u s;s)srxrxr3oudom nliei ()aDra(rpnu0tee  ictydlsDemuvs u4tetoxr tytlat aueo t0 etm(r3no4lmenlfcsl(fs2ta(m ;o1apeo fetysfm ea( s;u0 lxnmr3iadlp eauvslt0s2toxopoy1ap e ies s)artmxmooo4tetn icildla2ea(ms;t0artoxr iy1la elnvs;t)teurir3nu1olenlnetlsfs2taumont1apen i3iaslsDum( s;t4 rtoxf iatomDran o (  ruo(m nodaltemnesasfsDurx  oo4alt miciyt s2umnvpnt0tlxrio3iodopt  i sl(0 rxm(m iudapt lictl( sDtr(root0tle iicias mDuan p u)aexnxocto1oaDean i ()seum(rpnu1lleelnvsls aDrmu  oo0opt if3tydlm umuvo;u0tltnxo3totomD  ivo s0srurio ou4ap nlnes sfs2um(rp;u0apx io3ildlaDemn s t4aexrmo iadoptrlueilt  exoirpiudapee ivil(  2tauroou4tpto ieiydfa2ulnvp u4texrio3io1oa r n ilt)setrim3no1alenlieias) Dua(mpou1opxoif3ilsfmDrm(vonu)alxrmo3oadfpDeauvs;t)seuoim3ou4ll  lici s sDuaxm ;o0tpx iictltls2rluvp;u)artrmrciatlpDe ues t0tetm(o io1lp nlfvtasf rumxmpnu1tle mi3iysfaDeluvon(4 eenmr oatlpteanei;t) eto(opoy1apee fcilsfs2trum no4apenmfciatfm emumont0arenxo to1lp rlueils0t2urxo io4op elicsas s2ta(mpno1tpx ioetadfm emumonu)tlerxociatfpD luvo;t)sexrxr3iydoleelnvtat a2ra( ooo4oltomoeiys m um(ms;t4 rxnmo io1lptrlivi;t)teurxopoudlpte fcta( aDraxmp;u4oeeoif3tysfaDumu p;t4altrifctydfp raivol( t2urxopnu1lpenlfvi t)arrax pou0openmoetyt s2um(mp;t4 ltnxr iydoa rlnvols) eur(o3oy1ll elieiatfsrur(ro;u0optomiciasfmDemu pn() etrxr3ta1fpDrlnes;t  exoxm io1lpt liesa(f rrru pnt4tlx  feils m2umnvo u4 ltnif iytfpDeln ilt trxoxo3oy1lpen nciat)aDumxr ot4aeenmiciat mDuaump;(0trenio tytom eliei (0tetr(opiy4al   net s)a2tm(m nu1olx io3iydla2emums;() renxfctodlmDrli i s  2xoxo3nu1al n fcilsfs2tm(mp;t1apt  ictldfa rm( o;(4arermocootoaDeli o;s0 eumio3oo1llee fcias) 2trxr ;t0altn iciad s2umu p t4 lenxf ta1fp  auvol(  rxoxr nydop  mnesasfaDtau  nu0aetn feiadfmDea(vp;u0aexoir3oatfp eaues;t)teum(m iy4am emieta(  Dta(m nu1aptnii3iasfs2uanmo t)aleoxr3oytlptrluvs;s sruoir3io1am nmics (faDta( o;t1apt mieildla eanmsnu0trenmo ty1faDranes;s)t2uo(r nodlm elivsat)arta(root0tpx  ociatfm2uauvon(0 rerxr3oa1oa r uvsl( seur(m oy4amtnmfvias)srrmu o;o4aetn oeiatlsDumnvp (4altnirciytopDraieo t)trtrimpoudlm  lnvsl() 2ta(  ;o4tpe mieiadfa emuvsnt4 exrmr oadlp   ueolt s2xm(r io4lm  mivsls s2ra(mo;t4aetnmi3tyt a2rlu pn()alxoxrcoatopt aivi t0s2tr(o3iy1lm elfvslsfsDumxmp;t4olenif3iat s2rm( p;u) rtomrcio1fpDean sl()texmir3oydlpt mfvsl(faDrmxrpno1altn f3iadla2eln ont0 eeomfcto1fa e n o;(0t2uoxrpio1am  mfvil( srrauroou1opxnmo3ils s2uln s t)altnxr iotfateanvs (0s2uoirpoo1lmtnmieta(fsDumump;t4tptnmoetyt s2rln pn(4altrioctydop  anvo;s  euo(o3nodom  lfvtl( srtau pno4aeto octas a ulnmon(0 lxrmr3tadoa r neo ( setoxr3oudlltnlfvi t sDtaxrpou0aleoif3iltlaDrlnvo;t) lxoio3tytlat an o;s  2trxmpnydlmtemici () 2ra(root1aeenmieiytlaDul( o;u0texoxr3tydoa  li o s0 ruoim iudlm nlfci ()s2urur ot1olxnii3iad a2uauvsnt0trenxr3oytfatrluvs;s)trxoxrpiu4lptnlfcia(farrm(rp;u1aeeomieiys s elu p;t4aleomrcty1lp   n i;s) 2umir3nydomeemivt s  2tauro;u4olxnmfciatlm ran snu4 eeoxr tytomDeai olt)trur(rpiy1llt mfct s  2trxm ot0apxnmi3iltlsDelnvont4artnif tytfa  ln i;(0 2xrim oy4omtnmfcs t  rumxmp;o4olen i3iadls2ulumsnu4tetoiociadfm e u i;( sexrxm iu1apenmnvtl( srrm(  nu0tpx  i3iys a2eln s (0treoifctydfa rau s;t0sruoir oy1oltnlieiatf rrm(rp;o0oexnmoeiatfm2umn s;t4 etrxrcoy1op eauvols0 2urio oy4lm  mnesls) 2tm( p;o0opt ioetltls ea(vo;()treomf ia1lm rlueo ()t2xm(rpiy4omen ieta() 2trxro;o4apx  iciys aDranvsnu0texoircta1fa  auvs;(0seuoxr3ou1lmt  ict t)s2uru ont4alen octys sDrln s u)artoxrcio1laDr nvs s0 euoir no4omtnmfvsasfsrrm(r ot4tlto feiydfm2ea(mp t) eenxr todomD an i;t0 eum(m nodamtnliei (f rurxr ;t4tlenmociad s ulnvs u) ltnif3ootfmtr uei t0 rxoio3oy4amt lnctl( artr(r ;o4tpt mfeiaslmDrluvp;u4 lxnir tatomD ln ilt s2uo(m3nodome lfesat arra(rp;o4oex mfciyt m emuvo;u4arxnxf3tadlmt  ieilt0 exrxopoodlptemnesltf 2umx pno1tltoioeild a2rm(vs;u0tltomo iy1fpte uei;t0tetm(r3iu4ol n iei t  rtmumpou1opxn ociyd m rl(vs;t4trtrmrcootfp rlivsls)t2xr(o nu4amt liei s)aDrmxr ot1alxnmo3tltfs2ul(vs;(4aleomf oadlm elneolt0trtrxo3ny1lm  livi t  rtrum oo1tpxniieilsfaDrlnmpnt4 lxnmo ootoa  lu i s sexmim nodlm e iet tf 2tm(  nt4aeeoioctldla2um(vsnt4alenxfcoodom eauesl(  2xrio3iudaltemfcil(farumxroot4aptoii3ildlm rmuvp;u)altoxo oa1fat  iesls t2xoxopnodamtnlncsl() 2rmxm ;o1olxnmocildls eanvo;()altrio3tydla  au o s)texr(r3oy4amt  icsls)sDuax o;o1apxo oeildla ulumpnt0altrxociytfp   nei s0t2tmir3nudom nlnvias s2rax pnu1ope  feiyt s2ul( on()areomf oytoaD livi t0sruoxo3nu1llen iesa(fsrrmx o;o1olx mf3iadlm elumo;(4tleoxr oatlmDrli o;(  rtm(o3nu1apen netasfs2tru oou4aleomiciltfsDemuvs;u) rtoio iy1optr nvo;t t2tm(r io4aleelncsa(fs2um(mo;u0tex iieiatlaDrmu p u0 renmocoydomD luei () 2xmio3iudopte iet ()aDra( onu0aee ii3iasfmDul(vont)artnxr ia1fpDe n o s)srtm(m3iu1oltnlfesl(faDtaump;t4tlt miciatlsDum(vo;(4aleomf iotopt aues (  2umxr3nudom nmfesat)a2rau pnt4oexnmi3tat s um(vonu4 eeoif3tadlpt aueo (0s2trim3oodlptelivils a2trur oo4openiietatfm2ulumo;u4alermfcoadom rlneo;t0sruoio oo4aptemnctasf Draur nu4oee ifeiaslm2rm(msn()tltnxfctydom r u i s)tetm(opny4lme lnvsltf 2taxmp;t1olx ioeiytls2emu ont) etoir3tadopteaiei s s2to(opoudam  lfvs ( aDtmump;u1opeoifeiatlmDrm(vpnu4 exrxo oadlm   nesls)seuoxm ny4am e iesa(f 2rru poo0alxnmiciysla rlnvo;(4 renxf ootomtelu o;(0sexo(rpiydomt mfesasfarurx  ;t1oleoif3iydfsDul(vs () renxf iodoaDeauvo;(0srumim oo4ll  mnvtlsfartmxrp;o4optoiociys m2ul(mo t) lxoxociotlmtr u s;(0 2tmxopiudlp  mfciatfa2tauronu0oetnmi3tytla rm( o ()aexoio ta1oa e u s (  2umio3oydlmtelfcslt  Durumoou4tpx ifeilslmDumnms;u) ltomf3ootop e nvi t)trtrio oy1altnlieilt  2umum ot1oexoioeiytfs2rmuvo (0tlermr3tadlp  aieilt)s2xmirpiudom  mfctasfsrrm( o;o0open feild s rlnvon(4trenmr3tytopt  u i;s) etrirpoy1lpen fci (  Dtm(  oo0olt iociat sDuauvs;t)alerif oydoa ranes;(0 2ur(m3io1ol n fctas)a2urx  nt1aptnmf3iys aDranvon(0 ltoxr3iotfp e nvs;(0srto(o nydale lfcs () 2rm(mo;u4oexn ictyt m2umuvs;u0 rerxr iatopDraivs;s0 rtoxo3ou4om  lfvta()arrau p;u1opxomieildfm2ea( s;(4 reomf iotlp raies ( srxriopiy1ol nmneslt  2uaxr ot0ole mfctldlm2ua(mp;t0trxnir iy1latelues;t seto(m3oy4lptnmics ( arrmx pou1texn feiaslm2em(vsnt4aexnifctydlaDrlieo;s0t2urxo no4lltnmieils  Dtau o;u0alxo ieilt aDem(mpn(4artoxo3oadlmt luei (  rxoxr ny4opee ictatfa2ur( p;o4oleo o3iytfm2ran o;u0 rxnxo3ootoaDeaueo t0texmirpnydol   icils)sDtr(  ou0openifctydla2rmu snt4tleoxfcoy1fat au s ( trur(m nydol nmfctlsf Dtmu o;u4altn i3tls a eauvo;u0teeoio iydopDeln o;( teurxr3iy4lptelicsat) Dtau  ;t0altniicilt sDrmnvo u)alerifciodom  aivs t0texrio ny4amee ncsa()sDrrx p;o0oet  fciatla rmumo;(0 rtnxo3iy1fpteauvi s)t2xm(r nydlmeemfvtls) 2rmuroou4oet mo3iydfs2uaump;u0arerio iytop elnvs;(0sexo(m iodolenmnvtls artaxmp;o0optoio3tat mDrlu o ()altrxf iy1faDelieolt)teur(r oy1al nmieils) Dtrxrp;u4oleo fetadlm2ran p t)aleoxoctatopDelueols0srxoxopoy4ape mnvi ()s2rmum ;t0optoifctyt aDea(mo t0treomrctatoaDeluvs;s0tetoim ny1om  lietlsf Dtax onu0ale mo3iyt s ulu p;t)aetnifcoadlpD aiesls)s2xmxr iu1llee ivia( s2uaxmpou4oee mociydfa2ean pnt4aleomf oy1late neols0 2um(m3oy4ape mnvsasfsDumx p;t0aee ii3iadlm2eanvp;u) exnirctatop elnvs t0srumirpny4lp nlfet t)a2ur(  no1oex iietadlm eanvs t0alxnircta1op  aues s)trxmir3ny1ap elfvi sfsDtmu oou0tpenmoetytfmDranmo;t0aexoio ootlpte u o ()sruoimpnydlltelict tfa2ta(ronu1tltniiciydls em(vs;u) lxnifctotoatraivslt srxr(opiu1ope mnes sfsrtmum nu1ole  iciad a uanmont)artnxf3iy1laDr n i t0srxmxm3oo1openlneslsfsrra(r nt4ape ioeiydfa emn o;t) lxoioctytfmtean ol(0srxmim3ny1lpenmiciat) 2rm(mont4optoio3iytlmDem( o t0 lxrxo to1fat  i s;()texrxopou1lp emiesas) 2tm(ront1aptnmf3tadlmDrluvont0 rxomf3oatfa rai ols0 rtoir3no1lmte ncil(  rtmuro;t0oexniociatfm2umnms t) etrmocoydoaDr uei;t srtmim iudameemieilt)s2um(moou0oeen feils sDemn p;u4 rxoio oatlpD anes t0 2uo(o iydap  mfesasfsDrr(r ;o4tpt mfeiysfs2ul(vo;t)arenmrciytfa  lnvi;t)tetoim nu4lp nmivtas)srrr( oou0ope  ieiaslsDul(vp t4tltrirctydlmD  ieol( t2ur(m ny1ame  ivs s) 2rax  nu1teeo oeiatla2emnmo u)texrif io1latran i s texr(m3iy1lp  lnes s) ruaur ou4olt  feildfa2rlnms;t) exrmo ia1fmt livol( srxr(rpno4amenmicslsfaDua(ronu1tlto f3tld mDrm( onu)tetoxf3oodfpDeluvol(  2um(r3iu4omtnlfvslsfaDrax oot4aex ioeiyd s uaums;u0aetnmf tatfpDe ueol(  2trxm3nu4apt mfcsl(farrau  nu1open ictytlm2rau o;(0areoir3ia1oat anvi;()srxm(o oydom nlivsasfarrrumpno4ape  fcilsfaDumu ont0trxnmr iydlmD aivs;t teur(m iy1lltnmnet s)a2uax onu0aex  fciltlm2umums (0 exrio iadom   n ils)sruoxr ny1lpe lfcs (f rrru  oo4tpx  octadfaDumums;()aeeomocto1laD  uvi;t srto(m3iy1ap nlnvi t srtr(ro;u0alxomf3ilsla2rmuvo u4tetrxo3iotlpDe uvil( sexrim oy1ole liviasfs2umump;u1oex  ieiydfm ul(vs;()arxnxrcty1lm   uvo ()seurio3iudaptelicilt  rumumpoo4tex io3tysfmDrmn p;(0aleoif3oodlmt anvo t) rxrxm oy1openmnvia( a2rrur ;u0texnmieildls ranvo;t0 rtrmo3oadom eluvilt t2xoirpoydomtelnei t) Drax o;o4tpxn ieildfm ea( p;u0 etrio oy1fatr ues;( t2xoim iy4lmeemnvilt)a2ur( pou0opxoifetydlaDeauvo t) lxnxo oadlp eli sls t2xrxm3oo1ol n ics s  Dua(rpnt0oetnmoctadfmDuan s u) lxrmfctatlpteanvols) 2xmxm no1lpt mfetlt  rraumono0oltnmi3tatfs ulums;t) rxomf3to1omtrli i;t)trto(opny4amtn fei s  2rm( o;u0oeenmoeiytls2umnms (0tltnxr3totoat anes (0s2tmxm3oodomt mnesl()arumxmp;t0tptomoeiatfsDeauvp;(4 rerioctodlp   ieil(0 2um(r nudllte ietasf 2rm( pno0teenif3iad a2eaumo u4arenxfcto1omDraues t0t2umxr ny4lpee feia()aruau  oo1apt  feiaslm2ul(vp t4 lxomo todoatraieslt) etmir3no1al  lies t) 2um(m ot4oltnifciasla uluvs u) etnif3oytoate n i;t)seum(r nu1lmeelfeta( aDur(mono4oltn i3ild m2rmuvo;u4 lerxr oydfmteaivi;s s2uoim3no4amt lncsa()arrr( ooo0aleniictydla el(vpnt4aetomf oa1fmDraies ()seurxopny4lm nlneiasfa2tm( pot0tltnii3iyslaDemuvp;u4 lermoctodfp   ueo;()setr(rpou1omen fciasfa2rr(  oo1opeoifciat mDrmu snu0arenxr3iadoaDe ivi;s0tetrim3iy1op nmfeia()artrxm ;u0aex  i3ildlm eanmp u4 etrircto1latelu o;()setm(m no1opt lnci tfaDra(r nu4tee mfctatls2um(monu0aetriocio1latraues;t)tetmio iu4lm nlivsat) 2rm(r ;o1tetn o3tltls ulu s ()trenircoo1fm eai i;s  2xm(opoudam nmicta(fsrrmurooo1tpxniietytfs2umu ont4tlxnxr ty1faDelnvsl( t2xmirpoo1lltn nci ( srrmur ;t0altoiociadlm rmu snu) ltoir iy1opDelnvs;s)srxo(o nu1alt lfviatfs2rr(mpot1apt  f3tlsls2emuvs;t0arxomrctadopD au o;t)t2to(o3io1optnmnci t)s2trx o;u1tlxoioeiltfm elumonu4trtomo ia1fmtraiei s) rxo(rpou4al nmivil()srtmu ooo1tlen oeilt sDeau pnt)alermr3tytomt  n il() 2xrxo nudaltnlfeiat  rtmxrpnt0oleomoctysla um(vo;t4aeeomfciadlp r nvils texoxr no1ol  mfctas)srta(m ;u4tee ifeiatlm elu p () rtomfcio1omteln s;(0 2um(o3nudll elfeslt)aruaxrpnt1tlxo octld mDrmumsnu)tetrmfcty1fmD  nvsl(0sexoio io4oltn ivt s  ruaurpot4tle  ietat aDum(mp (0aetnmf tytfptr ies s  rxoir ou4op nmiviat  Dtr(rpoo1tle if3iad m ua(mp t0tlxoio iadlp   nvs (0srtoxopnodlm elfeslsfarum(m no4tleo fciasfmDeluvp u0trxrio iotfmD aneols  exm(m3oy4olt  fesas  2trxmo;u4aleo o3ils a2uln o u4altrmf oy1lat  ueol()t2trxo oy1lm  mietat  Dua(rpoo4tpt mociyt s2em(ms;t4trxrxf to1fat  iei;s0s2tmio3io4llt  feilt) 2ur(r oo0optnif3tadlsDrlnvs u4 rxniocty1faDeluvilt s2xrio3oo1lpe lfcsa(fs2rmuro;o0aetnmi3tls a2ulnmp;(0texrmr3ootoa rlnvi;s0s2umxr3oo1amtnlnesl() Dta(mooo4apeo ictyslm2ul( p;(4 lxoxo3oodfmtelu olt  exrxr3iudamee ivtl() 2raurpou4olt  fetadls2rmu p;t0 ltrxf ta1omDeaivs;s seum(m3ou4am  liei (  rrmur oo0oet ii3ildla umnvp () exrir oodoaD luei;t teur(rpno4ol e feta(f rurx pou0oetoif3iltfs2ul( s;u4tltnxo oodopDr uei;()trxr(o oo4lmtnlnet s)srtaurpoo0oetoio3iltla uanvsn() exoxf3iotlpt livo s) rtrir iodal nlnciasf 2tmumont4apto oeildfmDrl(mo (0aexrif3oodlmDelneo s0s2umim3oydaptelnvia()arrru  ou0apeo icilt m rmnms u)aetrxr3oo1opDeaivi ()tetr(r3ou4opt  ivtls a2trur oo4tpx ii3tatfs rlumpn(4 reoif oodlmt aieilt)srtrxr3oydapenlictlt)sDurxrp;t0aetomf3iysfa2emn s u0 eerxrcoytlatr ieo;t  exrirpiu1lp   ies t)a2tmu pnu4olto ieiat s emn p t4 eenxr3oy1lm e ivs;( trumxo3nodlmenlieiat)a2taur ;o0optnifctltls2rl( sn() eerif oa1fptrlieo (0 exr(mpny1lmtn fvilt)a2tmumooo1alt mo3iyd s2rmuvp;t0trerxr3oytop e u ilt0trurxo nudom  mnesasfaDraum ot0aleomfetls a2ul(vsnu)tetomrciatfm rai i;() exmir ny1ap n neias)s2rrumoou4texnifcilsfa2ra(vs t)aetomoctytfmtrlnvsls0trtoirpny1alt mfcils a2uaxrono1tle mi3tad sDul(vpnt)artoiociydoptelueilt0 rum(o3oy4alenlfes ()s2uaxm ;u4tet mociatlaDul(vp;u0 eermocta1oate nvol()trtmir3iy1am nmnctl()srtmxrp;u0tlt ifctydfmDuanvs u4trtoxocto1om  li i;t0t2xm(r3iy1optn fct s  Dtrx  ;u1oetoiociaslaDelu s;t)artoif3iy1fa e ivsl()sruoxrpou1alenlfvi ()sDtau p;o0aex mociltfsDemnvs u) rtoxr3oadfpDeaiei;s s2tmir3iudll elfvt t)s2tmurooo1ole  i3tlsls2em(vsnu0 lxoifcootfmteaiei;(0tetrim3oo1ope  ieiltf rra(rp;u4tlxomiciasls ulnmsnu)arenmf oatlmteaieo;(0texo(o oodol  mieia()artaumoot0tpxoif3tadfm2umu p ()trxrif3io1om eau slt0seuoxr iodal e ietatfarum(rpot0teeomfciatfsDumn pn(4tltrif ty1omt aies;s  eum(opoo4ol  mfvs t)artmum nt1alt mf3tysfa uanmsnu0texnxf oy1lpDraies;s0s2tmxo oudome lfvil( sDrr(r nu0altn f3iydlaDeauvpnu0aetoio3tytom eln o t) rtoio3nu4lp n ics ( aDtmump;t4tpto o3iltfm2ua(vo () rxrxo3ia1lateaivo;()trxr(rpoy4ope  ietas)aDrmumpot1teeo oetydfm rlu o;(0alenir iotoa r n sl(  2xrim oy1lmt lfet t) 2taxr ;t4tpeo fciydls um(ms;u4trtnir3tydla  luvol(0 rtmir oy1ll   icsltfa2rrxmont0oleomociysfs ranmsnt0tetoif iytlmDe u i t t2tm(o oo4ope  fvsat srrr(mooo4oetn f3tasfsDrm(vp;u)aetrxf3iodlpDraueo;() 2xmxr oudomeemfci tfa2uaumo;o1aeto feiys s ua(vp;(4trxoif iatlat  uvo s0 2xo(o3nudomtemivias) 2ua(  ;o1tlxomfciytfs ranvsnt4arxoxf3iytfateluvi;( setmxo3oo4lmt mneiltfarrrxrp;t0olx iociydfm eanvpn(0aexoxrcoodla  lu sl() euoimpiydope mivias) rrmumoot0altomfcilsfsDean p;t4 renif ia1omt  ueilt0texrirpno4ole  ici () Draxmpno1olen fetld a2rmu p t)aexomrciy1fptelnvil() etmxrpiy1ap emfvsas) rtrxr oo0apx micilsfa2rlump t4treomr io1omDr uvo;t)t2trxo3iu1ap n fciat)arraurooo0oee mi3iasfm2ran on(0aexoxr ta1opDrauesls)setoimpnu1apeemfesl()artax oou4oexo ietlt a2em(vs;t0tlenir iy1fatr u s t srtoxopny1ol   ics (  Dtmumpnt0aexnmi3tydlaDemu s;t0arxnif iy1la eaivs t0 rxr(opiudap nlfvs s aDtrur ;o1olxnmi3iadlm2emn p;t4 eeoir oo1lm  ai ols0srto(rpnu4opee ivil()s2ua(r ;o1tex ioetyt a2ul(mp;t0tlenmo3oadom  ai s;t0 2tmxr3nydolt lics sf 2rax  oo1tet mfctyslaDeluvon()tetniociodopt anvo t0tetoxm iu4lmtemfcias arrmu  nu1oee  f3tldfa umn s ()alxoir ta1oat  neo t)setmxo iy1omee fetas s2ua( ono0tltoiiciadls2ua(msnt4aeerxr3iatomDr ivslt0t2tmxrpny4ol   nvtat  Draxro;o0aeenii3tasfs ua(ms;u4 eeoir tytfa e ieo;s0teuoir3io4omeemfes (  2tmxront1opt if3ilt sDua( s;t0 eeoxf3iodfmDrai i;(0seumimpio4ll nmieias sruru p;t4tle ioeiyslsDum(vs;t0altnmr iy1oaD lieolt  rtmim oydlp nmfcs t)a2umurp;t0tee  i3taslaDrmumsnt)treoif oytfateln o s0srtmxo3iu1lleelnes sfa2uaurono4tpxo f3iatfs rmnvpn(4arxrmo todlp  an sls)t2um(r3nu4op nlnes (  rrmx onu0ope ifciytfa rmumsnt)altnio3ia1lmD luvs (  2umio3iodome  fvsa()s2uaumo;o4texnio3iysfs emnvs;t4 reoio iy1lat lnes (0 2trxo3nu4ol   fei sfsDuax  ;u0tpxn fetldfs2eau p u4 etnxocia1lpDe nes (0 2umir3iodam elicils s2rmxr ;t1apenmi3iltla2elnvpnu0aexrxfcoy1faD auvo;(  exmiopnodlmen ivsl(fsrua(rooo1tle miciadfa el(von(0trxomf to1opDe n ils seuoxopny4oltn iviat  Drrx  no1ope mfeiat aDuluvo;()tlenir3oo1opD livils) rurxopou1ope  iviltfsDrmxm ;t0tltomociasfm2umn snt)trermf iadopDr iesl(0srxmirpnodlmtelivslsfsrrru  nu1apx iietatlsDeluvonu4tlxoio3oatfm r ivs;s0 rtm(m3oodopt lics ()sDrmu oot4altn oetasfs um( s;t0teerio oy1faDelneilt0srum(o3no1ll  mfeslt)sDta(r ou4olt  fcild m2elnvo;(4 etrirctotom eliei (0tetmim3iy1am emfctltf 2trxmpot1optnio3iysfm uan s;t4 eermr3iy1fmt  u olt)srxmxopiu4ll e netatf 2uaxr ot4open octyd s rmuvont)trtnio totfpteanvol(0srtrir ou4op emfvsls a2urxmoou4alx iiciyslaDean o;t) leriocoatoatelnvs;s)sexr(r iy4lmtelfci ()a2taxrpnu1aptnif3tysfs2eauvo;t)alxnmocoy1opD  n ilt0teuoxo3oo4apen ncil(f rumur nt0texomocils a2ra(ms () rtrmr3todoat  ieils0t2urxo3iudal  mnvilt  2rmum oo1oltomfetlt sDem(vs u)tleoif3todopteanes;s texmxrpiydlmtelnciat  rta(m ot4tetn ietysfa2rm( on(4altnmf3ty1fa  lneilt t2urirpiy4amte ies t)aDur(r oo1altomo3iatls ra( o;u4tetnxrciytop eluei t texm(o3iy4omtnlics s) rta(mpnu1optnifeilt a ul(vo;(0alxrir3tatfmte u o;s s2toxo3nudolt mfetltfs2ua(m ;u1aet mocild a ulnvpn(0 rxrxo3oodfmt  neolt0 rtm(m oodop emneils)aDum(r ;u1aex if3iyd m ulnvp t) ltnmf3oatop r ueils  rxoxr3iydlmen ietls) 2umurono0teenmo3tyslaDel(vs;(4 leoxr ty1la  au s;t)t2xoxo nodome  fvias)srtaxmp;u0tlt ii3tasfm2umn p t4 leomr3iy1omDe u i t  rxrimpnu4ope  icil( aDuaxmoou4ope iieilt s um(mpnt)trtrif iotlpD  nvi;s trtmim3iy1ape  icta( srtrxrp;u1alxo ociyslmDrlnmp () ltoifcoydfm   iesls) 2xm(r3iydol elfciatfsrumxm oo0oet if3tldfa uaump (4tlxrio iy1faD anvo;s0trtm(mpnodal  licia(fs2ra(moot4tleo oetad aDum(ms u)trxoxfcoatfmte n sl()srtrxrpoudlmt  icslt srrm(mp;t4tlt  octldls rlu o;t4 lerxr3io1om raivi s srxrir3ou1lm  livi t s2rr(rp;t1tpx mfetysfm ra(vp;()tlenmr3ty1fmDrau i ()t2umxr3iu4lm elivias)srta(m no4tex ifctyd a2uauvo u4 exnmo oatlaD lueo;s0t2urxr oodlmenmivia()sDraxr ;t1optnmfciasfaDul(vs t4alxnxr3ta1fptrai o t)teur(o3oydllt lncsasf Drmxrpoo0texoioeiydfsDeanvo;(4 rxnmr oatop eaies;(  ruoxopio4al elfet t)sDrmxm oo4apx  oeiatlmDrm(mp u0tltnmf oadfp eaueilt)seuoio3iu4optnlnei t)srua(r ;o0tleniictlt s rmu snt) rxnif3iodlmt  u ils0srtrxm iy1om nlfvs s  Dururo;u0aleo i3tad m eaump;t4 ltnxf3ty1lp e nvo;s srxrxo3ou1lmtnmnct t)a2tmx poo0alenifctldfaDulnms;u)teenmo3tadfmtraneo s0 rxoxmpny4ameemici t  2rax oou0teeoii3iad m umnmp;u0trenio iadlmD lnesls)s2uoir iydop  lieiltfa2rmxm nu1olx  ocilsfm2umnvp;u)trtomr3iatlpDe ues t) 2uoiopnu1aptnlnvslt arrm(rpno4tpxnmieiytla eluvp;(4tlxoxf3oytlm rlues;t  2tm(o oydlmt  fciatf 2umuroou0oexniieiatlaDrmumpnt0alxrmr tytoaDe u o;(0srxrirpiy1al emivilsfs2rmu pnu0teeoio3tadfs rm(vpn(0tlxoxf to1fmD  ieo;()t2xrxr nydom elnct sfa2ta(rooo0altoiieiatfm2ea(von(0aexnxf3ootfm rauvol(  etm(r oo4alt mfcil( a2rmumpnt0tetnifeiytlsDrmn pnt0 eenmfcoa1lmtrli ol(0trxr(o iydlp nmics t  2umur nu4alen fctld a el(mo u4trenxo iy1oaD aneols0 euoxopou1optemfct ( sDur( pou1tlxnii3tatlsDeau p u0artnio3tydfpte neil(0seuo(mpno1olenlnct s)aDtrxro;u4teto ictyt m rl(vsn(4 lxnxf3tytfa rlnvils0setmxr io1aleemivi (faDrrx pot4tlx moeils m rmumsn() lenifciytomD aiesls0trxmxm3iudlmenlncsa( a2rr(rpou1tlt miciatla uau o () eermfcoodlmDrlnvi;s) 2urim nu4amenlnvi t)s2rm( oot0opxoiociasla2elnmo;u0aleoxf ty1oa  lu o;s0t2ur(r ny4omen fvtlt)aDrm(r ot1oetoii3iydla2elu p;t)teenir3iy1om  anvilt)t2xm(r3nudomenmfctls  rrr(mo;t0apx  i3ildlm emu o u)tlermr3ootlmDeau o;t0 eurxm3oydom emfeia()a2tm(roou0alxo iciyd mDeln o;u) eenio iodfpD anvo;s) 2um(o iu4lm   ncs (f Drm(m ou4tee mf3tytlsDem(ms;(4texoxrciytop rluvi t0 etr(r oudll nlnei (faDurxmooo4opxomociadfmDeluvpnu)alerifctadlaDrlnvs ( seumirpoo4lltn ncilt a2rrxmpnt1olto f3tysfa2ea(vo;(4texrxf ootfmt aivols s2xo(rpnu4ol  mfeslsf 2rmu  ;o4ale mfetytlsDea( p u4alenir3io1omtranvs s srtoxr3ny1lmtn neil()s2taxrono1aeeo o3tlt a2el(vp t4artnmrctodomt  ies (  euo(opoydlm  mfctlt) Dta(rpnt1olxoiictydfa2ulnmsnt4trenxr iy1fm   uesls0t2xoir3ou1lpe mnciasfs2tau o;o4tlt  i3iydfm2ranvo t)aeermo oodfpDe ueo ()texoirpoo1lltelncils)s2rm(  no1apeo feildfsDuaump t4alxrmr ia1fptr nvi s s2xmxmpny4lpt mfct t)artm( onu0olt  ieiys a2emumonu0aetriocta1faD au ol(0t2umxr oo1olt  icsltfsruau ont1alx io3ils aDumnvo;(0 eerxocoy1omDe ieol() 2xo(rpnodapenlfvi ( sDuaurp;u0tetnmi3iad mDrlnvo u4 rtnifcta1la ranei t texrxrpoodamt mnetasfaDtrx  nu4olenmfciytfsDra(von(0 lerxr3todla   n sl(0 eurim3no1lpen iet ( a2tmumo;t1opeomieiytlm2ul( p;t4tltoxocoodlptranes;(0s2tmir3ou4lmtn ivils) rtr(  nt1tpxnifciytfmDemnvs;t4 rtomr iy1lateln s s)teto(rpoydlptnlfetat)srrmu  ou1tpt  fctldls2umuvo u0altnxfcoytlmD  n olt  rxrio3ny1om   ics sfarrax  ot4tpt mfciys s2ua(vs;t4trenmo ty1omtr nei;s s2xmiopiodalenmnei (fartrxroot1tlxnif3tasfa rlnmpnu)aeerxf iodlmtelu i;s)s2xr(rpiodlmt  fvta(f Dururonu1tpx moeiat sDulnvo u4altoxrcoytfatrln sl(0s2urxrpou1lleemictas  2ua(mpnt1alen fcilsfa umuvs (0altrxf oo1fpDrai il() rxmir iu1lptelnvsl(  rraumpno1oet mo3tat sDrau o t0trtoiocoatfm eln i ( tetoxm ny1lle mfvt s  rumur oo1oeen o3ildlm ra(mo;t0altrmr iadfmtr nvs;( trtmio oy1ll  livtl()s2raurpot4olto o3iytfmDua(mp u4aetnmrcty1fm e nes;s0trxm(mpio1opte fctat) rtrum no4olxnmfciasls rln o (4 etnircty1omtranvs t0 rxo(r no4oltn ieslsfartaur ;u0alxomiciysfa elnmo;()tlxrmf3iydfptrau o t0s2ur(r3ou4amtnmivsat arraxrpnu4texomi3iyslsDumu o (0 reoxf ootop rlnvo ()s2toxmpnu1alt micsl(  2tmxroot1tpt  f3iadla rauvs t4 reomo todfaDe ivs;s)t2ur(r3io1ap nmieta(fs2taxm oo1aet ifeils s2rlu pnt4tlenircootlp e ivs t)srum(opnodamtemfetl( s2ta(monu4opxnmiciat a uan p;t0 rtnmr oo1lmteln s;s  2um(opny1apt mfvias sDtaurpoo4tptnmiciydfm2rmuvp (4 leoif3tytomt liesls)s2xmxo ou1opeelneils)sDrrx  oo0aptoio3ils s2ra(ms t) lxoifciydfaD an i ()srtrim3oudame lnvslt srrrumpot0optn iciys sDrmuvpnt4 exrif3iatoatraivo ( tetr(m3iu1omtnmici (f 2rau ooo4olt  fciadfs ulu pnu0trermr iotlm eaivo;s s2um(opny4ll nlfes tf rtr( ooo1tpxomoeiatfa uauvp;u0texnmo3iatlpDelivo;s)trurxr3no1om emiesatfsrur(  ;t4tpenmicils a um(mo t)altoxrctodlpDr neilt)t2umiopoy1ame micilt sDumxro;u4oltn i3tadfa2rmu pn()artoif3iatfpDeli s;s)setmxm3nudom nlfes s)aruau ont0tet if3ilt sDemnms (0tlxoir oytfptraivo;s0texrimpnu1aptemfvil() Drrxr nu4opx  feiadla2rmnmp;() exnio3iotoptelu i;s) rtoirpnu1amt miviat aDuax o;t0opxomieiadla um(vo (0 renxf3iytoaDeaivi ()trto(mpnudape mivs sf rta(rono4aexomociatla2rau pn(4trenio3tatlm  aivols0s2xo(opou4am nmnctl(fsDuau pnu1aptomieiadla2rau pnu0tetrxo3iydlatelivol( t2trxo ny1lm e fctasfs2urxr no0opxn o3tad m2um( pn(4 rxoxo oo1lm eaneo;t0trxoim3iy4optnmfct sfs2umu ooo0alxnmfetlt s2eaums;() etnxrciodlp  lnvi (0srumxr no1omtelivil( aDuaxmooo1oltnifciltls elnvon(0 lermr3iadfpteaueil( sexrxr iudomtnlncsl( srrrx onu1alx mo3tltfm emuvsnt0 eenir3iadlmDe u ol()sexoxrpoo1lm nmivias)a2tmum no0tpeoifciydls2um(vsnt4altoircta1laD  uvs;(0t2toim3io1lm  mnvtlsfartmu ont4tpx  i3ildfsDrm(vp;t)aeerxf iy1lm rlnei;s0texmir nydllteliet tfaDrmum nt0tltomociat sDul( o;u0tltrxr tadoaDe ieil(  eto(m3iudale lnvsas sDtauroot0ape if3iatfsDea(vont4aeeoxo oytoaDeaueilt) 2xrio3oydllen fesa() Dtrur ;u4teeomictysfs rln p;t0 ltoxr3oytlmt ln slt) 2uoxmpio1amte ietl(f rtau pot4tptnmicildlm rmnvo t4arxoio3iydfmD anvsls trxrxm nu1lltnmfcil( sDtau onu1oltomfeiytlm um( pnu0tlxnxo3iotoaDraivi;s  eumirpny1optelivsas  2tmuro;t0apto ociltla2ranvs;t4aexrio3iodfm eanvolt)trumxr3oodom emfvil()srurx ono0aetniociyt m rl(mpnt0 lxnxf3iytfat aueo;s  2toxo3ou4lmtelivtlt)aruru oot0aetn oeiltfm2rmn s;() etoxf tatoa rlnvsl(0 etrim iy4lleelivtlt)a2umumont0oetnmociydfm rmnvo;()aetrxf3ootlaDe neslt0trtoio iu4llt mncta() Dum(monu0alt mf3iytla rmnmp t0teerxocootlp rlneo;t0texmir iy1ll emfetas)sruru  ;o1oeen fciydfaDuanmp t0 etrxr3oatfmDrau s;()teurxrpnu4amee nvtlsf Duaum ot4tet  i3iat s el( snu0treomr tytfaDranvi;s)sexrimpno4ap   net (  rrau  ou0oexniieiat m eanvo u)areoxf iodoaDelnei (0trumxm3oy4lmee fcta(fs2tax  ou4open f3ils m2ulu pnt0aeeomo3iadlmt  uvs;t setrxm ou1lltemivtatf 2rrum ou0opxomoeilsls rm( pnu0aetnif totfptrauvs s) rxrxr3oydal nmictas s2urxmoot0openmietlsfm2rmuvon(4tlxrif oydlaDrai ol(0srtm(o nudap emfvsasf Dum(rpno0tlto iciysfs elumpnt0 leriocoatfm elueo t t2umxrpiu4lmeelfvtls)artrxm ;u4altoioeiltls2emn p t0tltomrcia1lpte nvils  2xm(mpoo4optnmnesltfa2taxmpnu4aeeomfctydfa emn pnt)alxoioctytoatr i i t0 rxm(opnodopeelici tfa2taxmpou4tpeoifcilsfm2eau pn(4teermr3ia1omt lieols)setoxo nudamen fvi t) rtaxmooo1teeoif3iadfs emnvont) rxnmfcia1fp  aivslt0 exmxo nodop e fetas) Drrx pot4oet iociltlaDumump;t4aeenxo tadfpt lneo () rxrxr3oydomtelictlt)srtm(roou1apxniieiytlm uanvs t0trenmr tadoat auvols0seum(r3iu4lmtemnctltfa2tm(r ;o1tetnmictltfa ulumo () lxrifctodlpte uvils)teumiopoy1aptnlnvtasfaDumur ;o0aex if3iad a uanms;u0tetoxf iadopD lues;()sexriopoodll nmicsa(  Drm(  ;u4tpxn o3ildfm2rmuvonu0arerir to1laD  u o;s0 exmxopnydlpenmfesl() Draxro;o0optoii3tadla2um(ms (4trerifcoodoaDrlnei;( srxmio3ny4aptemiesls  Durx poo0aetnioeiadlaDrm( s (4artnmo3tadoaDe i i s) rurir iydlpe mfvslsf rtmumonu0aleo oeiydls el(vsnt0alxnir3oodlpDr i i;s0t2toxrpnudal  lfcsasfa2ta(ronu4tlxn f3iydfsDrmn o;(4teenxrciadlmtr ueils setoir3no4aptn fvsltf 2trx  ;o1oet  fciydfm emnmo;t0artrifcoatfatr nes t s2urxo iodap e neiasfs2rauronu0aeenmociltla2uauvs t0teenmr oodopDrlu i;s  rxoxr3oudomte icil(faDtm(m no0tpxomi3tld a rmu p (4 rxrio oadomt aivs (  rxoxmpio1ll nlictl() 2ta( pno4tlt  i3iaslm2uanms;t) rxrio oatfaDeai s;()s2xm(m3oudll nlnci tfsDtrum ;t1open octlslmDelnms;u0trenio ta1lptrau o;s)s2toxopou1olen nvilt s2rr( o;u0aee  fciasfs ranmpnt4aexomo3tadlmDelnes;t0srurxm iy4oleelnet () Dtmx pou4teeoiieiyd s2rl(mpnt0alxoir oy1lmDr nesls0sexr(o3oo4omtelfvsas) Dum(rpnt1tpt if3tytls umu snt)tlxnxf iodlmDe u s t)srurxrpiudlmenlfvil( a2rru p;u4aexo octys s rluvsnu4trerxrcoo1fpDe ivo (0t2urxrpio1aleemfetlt)arua(m nt1tlto fetltls ulumonu0tetomf iadlp r iei;()truoimpio1op e fctl(f 2tm( ont4tpxoioctldfmDuauvsn(4alxomo oodlptelu o s trum(m3oudamte ivsa(  Drmump;u0oex mfeiad m2emnmo;t)tlxrio3oo1oaDe uei;s t2toxm3oy4lp   fcsltfaDurxm ;t4tpxo oeilt mDeau p;u0alxrmf oa1la rlieo t0 2umirpny4amenlnvsat s2tmxro;t1alxnmoeiys m2elnms t)aexrxf iotomt  ieslt0texmxm iudlmtelncsls aDuaxmo;o1opxniociaslsDumn pnt0teermo3iatlpt aivo t) etmxm3iy4ll n fet s s2rmu  ;o0oexnii3ils aDelnvs;u4 eeoio io1faD  uvolt)t2tm(o3oydllte ics t)a2uaurooo1apxn oeiaslm uan on(4texnxr3oodla elivo (0 etmxopiu4ol   nvsl()aDta(r nu0tpenio3tas aDua(von(4 etomo3iodfmt auvsl(0 2xrxrpny4ap n ivt tf ruau pou1tlxoifctytfs uanmp;u)altrio to1fm rai s;s0 2tmir io4omt mnvt sf ruax ont1tltn o3iydlm rau s;(4areoxrcto1la elnvilt)sexmxr3iydopteliesl(f Dum( ono4ope io3tytls2eaumo;u4 rtrmfciydfp  au s;()texr(o iodllenlivsas)artr(  ;u1altoioeiatfs uan snt0aexrxf totoa  anvilt0s2toirpoy1ap n netasf Dtrx pno4optniictyt aDrm(mp;(0tetoxo3ta1om   i o s)texr(opny1olt mnct sfsDtrxr oo1opeomfeiltfmDem( s t0 rtriocty1faD luvslt s2umxrpnodolenmict t) Dtr(moot4openmfetls s2rlnvp;() exnxrctydfm rlivslt0s2urio3nodomtnmictasf ruaumpnt4tpe iietytla2uaums;u0trxnmociadopt aivs t0seurxopnydolt  fvsatfaDuaumoou0apx  octldfa2rlums t4alxrmr tytfa ran slt)t2xo(opiodlmt lfcils  2uru p;u4olenifciatfm em( s;(0tlxrmo tydlmtrlueo;s)trtmxm iy4alt lfci s  Drr( p;t0olx mo3iad aDea(ms (0 ltnxr iatlp elues;()sruo(o oy1ll  lncs s  Dumxronu1apxn ieiysla2rmnvp t0 rxrmo tydfate uvo;(0trtr(m oydlm elics sfs2urumo;o4aeeoiieiatls ulnvp t) exnxo oodfm eanvi (0 2xmio no1am e nvsa(  2ua( oou1aetn ociyt aDrm(vo;() ltoio3oa1lmteaues;t  2xmxr3oo1amt mivt s)s2trx oou0tetniieiadfmDel(mp;t0tetrir ootfptelu ol( t2um(o ou4am  mivi tf 2trur oo4olxo f3tysfa2el(mpnu4trtrifctadfptr ies (0texrimpiydopenlnvi ()aDrmum oo1opxo ieiys s ea(mp () exrmo ta1opD aivs () 2toiopiudaleemiesasfartr(rp;o1alen oetlslmDua(vpnu4trtnmocoatlmtrlies;t0 2xmxr3iy1lp elici (f 2rmuroot1oee  octyt s2emnmo;() rxoxr ia1fmtelnesls0 ruoim3oo1omtnlncta( aDraxr oo0tlen iciltlm ea(ms;u0 etrxo3ty1fm rai s;(  2xmim nu4lmte ictls)aDrrum ot1altomicilsfa rmums;u4trenxfcoadopte nvil() eto(mpnudlpt  fvsas sDurxmpot4ole ifctyd aDuluvpnu) reomfcta1oaDe uvo;s s2xoxm iy4om  mfvi s srrrum ot1tpxomoetyslsDrmumpn()arxnxr3totlpDeaivi;t)setmimpoydoltnlnvsat)aDuaxmont4oeen ieilsfm2rmn o;()arxrir iy1lptelnvi;s0seum(m oodapt livi sf 2rmxro;t4open oeias s eauvo u)trxoxr tatoptr u i;( sexoxo oy1oltnlfetas  rra(ro;t0apx mo3iytla eln snt0 exnxo3oadfa ranvi t t2ur(opoo4apt  nct t  2rr( pnu0opxn ictlsla2ua(vs;() rtomo3oadlmt  nei s0seuoxr3oo4aptelfeslt  Dtmxrooo1ale mietysls ra( snu)teenif tydoat anei t0t2xrxrpny4am nliesa()sDtrx  ou1apto ociyd aDrmnmo t4aleoxociotomD ln o (0 rumxrpnu1am  mnes s 
\ No newline at end of file
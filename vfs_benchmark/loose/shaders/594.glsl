@@ -0,0 +1 @@
+nei;() 2xm(rpnodop  mfcilsf rurxr ;t4aptnmoetydla2ulumo;(0aeermo3todfpDrauei;t) exriopiu4lmtnmicil()s2trx  ;o4tpxnif3tlt s rmu o;u)altnxo3io1laD aivi s) euo(o3oy1ope licsl(fa2rm(mono0apx mieias sDelu o u0aeerxrcoadoa rluei;s0s2uoxmpoy1am nmfcils)aDrmxr ;u1aexn o3iadfaDrl( s t4tlxrxrciydopDeln s;() 2xo(o3ou4oltelnviasf 2rax p;t4aeto f3iasls2uau o (4aexnxo3to1fmte u o s  etmio nu1lmtnlnet t)sDtax  ;u4texo fctysfa2um( s (0tetoio3oo1laDr uesls0trur(m oy1ll   feilsfsrrmxm nt1aee mieilsla eanvon(0 leoxo3tadoat lneo;() 2uo(o3io1optn ncias) ruru pnt1alxo oeilsfm2uan pnt4trtomr3totop e ueilt0trumxrpnudaltemneslt sDrrx  no1tpe  fctydfa uanmpn() lenif to1fmDrluesl( teto(o oydope mieilt  rtmxm ;u4alxnmi3tlt sDelnvsnu4arxrxocoo1la e ivi (  rtmxo io4oltnlivt sfsrumxmpnt1olt  ietlsfmDulnmo;t) rxnio3tadfpt auvo;s teuo(mpoudap emnvtas aDtr(r ou4tlxnifeiltfaDrl(vs t)trermfciytlmD liesl(  ruoir ou4al n nvs s srur(  ;t4apt ioeiyd a2rlump;(0alxrifciadom rai ilt)teurxopny1ol elnvtat  rtmxmo;u1optn fetasfs2rmu s t4 ltrmr3iodlaDeli i s srxo(o ny4amenmncsasfsrur(r nu4oetomiciyt a ul(vo;u4alxrir oadfa  lnei ()trxr(m nydop nmieia( arrru oot1apt miciysls el(vs u)treoxfcoadopt an i s)seurio iy1ape  fviatfa2ua(mont1apxnio3ildla umump;t)teermo iotoptrluvo;t  2xrio iydomt mncils)a2um( pno1alxniociys sDumnmpnu0aetnmf3oydlmDr ivi;t0t2xoxmpiu1lle  ieia() rrmumpou1oexo f3ilsls2rmnvp t0aleomf ta1laDrlnvo;s)s2umiopiydom n ictlsf 2trum nu0oeeoio3ilsls2ean sn(4tetoif ootoa ranei t)trxmio3nu1lmenlfet tfs2urx  ;t4oeeoioctasfa ea(mpn(4tlerxf iotfa ran ilt0s2toxm ou1ame  fct t) 2tm( pou0texoifeiysfm ran snt)teerxo3tytlptranei;s  2uoxrpnu4llen nvs tf Dua(mo;t4alx mi3iltlsDumumon()aeeomo3iadlpDraueo;s  rxrxr oo1openmicil( aDtr(r ot4oltoioctlsla el(monu0arxomr oodoa  lieil(0 rxmxopnydapte icta(  rrm(  oo0oetomoeiadlmDea(vs u0tltomf iytlptrau ilt  etoim oudal  mnvias)a2ua(  no0tleoiociydla rm(mo t4arermrctotfm  lieo;s0t2uo(opiydamen ncias)aDraur no0ole mf3iydfaDeanvsnt0tetoiocootomtrln o;t0 exoir3iudape mfvsa(farua( pno4optnioetatfa2eln pnt0aexnmoctotopDrluvilt)t2trxopnodlptelfetat)aDtrxm nu1opxnmfeiad m rl(ms t) leoir3io1om rau ol( t2xoxm3nydope lnvi tfaDrax pou0alenif3iyd m rluvs u0 lxrxf tatlptrlneol(0 rurio3io1oleelfeia(f rta(rp;o0opxoiiciltfm2umuvp t4 reoxo3iytop e ies s0 rtmio oodap  lnetls  rtrxmo;u1opxoio3iltfm ul(vp t0texnmf3iotfp rlnvilt0s2toxrpoy1lpe lnvilt)aDrmur ;t1ole mo3iysfa ranms;u4areoif3oadopD  uvi;s)s2uoxopiy4ap nmncsatfartm(  ;u1alxnif3iltlmDra(mp;u0 rxoxo iadoaD luei s)teur(m3oydapen fei (fs2umu  ot1tpeoii3iytls2ra(vsnu)treomfciotom elu o ( s2xrir3iu1ll nmfct t) rtru p;t0tlt  feias s rlu o;(4 lxnircoydfmDr uvils) eto(m3no4op  lietatfa2tr(r nu4tpen oeildfsDemnmsnt)tleomoctydfat lneolt)t2xm(r3nydlmt  ictl(f Dumumont1oeto fciysfa eauvsnu4arxnifcoadlmt an sls  exmxopoydamenlnesat)sDrr( pnt1aet iieiyslm el( pnu0 etrmfcootlmt lnes t  2toxopno1aleelivias  2rr(  nu0tee  oeiydlmDra(ms u)aexnxocoodoat aues t0 rxrxopno1amenmfct t)a2tmumont0oeto ieiltfmDumn snu4trermr oytlptranvs;t  exmim iydllte ietlsf Dtrx o;u0opeo ieiydfm ran p u) exoir iadoa rln slt0trtmxrpiu4alenlfvtl(  2uru pot1ape iieildls2ea(vp;() rtomociotopt lnvi s0truo(o3nu4lpe miei () Dra(ronu4tle  o3iysls rauvont4teeoio3to1lpt aieo t0 etmim no1lmeemfeslt) Dur(rpot1tpt mieild mDel(vo;u)aexrmo oatlpt anvols  2tr(r3ny4olt mfcil( a2tmu  ou0tlen f3iat aDul( p u4altrif3oa1opteli o t t2tmir3oodapenliet tfa2tau pnu0tptnmfctysfaDea(msnu)teenio3oa1lpDr ivsl() rtrio3ou4ape  fetl(f Duaur ou0apenmictas aDeluvo;t)tetnmr oy1fpte nes ( srum(m3oydll nlnvs sfaDrr(  nu4alxo f3tat m2ulu snu0 lermf tytopDr n ils s2tm(r3iu1am   netl(  Dtauront0olxo icildfaDel(vo t0tltrmr3iytlm  aies t)s2uo(m3iydll  mnvia(fs2rrxmp;o4tee ii3ias mDuanvp (0artnxfcoydfmDr u s t tetr(m3nodlleelneta( s2ua(mo;t1aleoiictys s2umu p u) rermr3totlpDr nes;t sexmim oudolee nvil(fsDrrx pou0oltomi3ilt mDemnvp t4tleomf tadfp elnvsls srtmxo oodapenmneils)artr( pnt1texn ictytfm umu s;u4trtomr3ia1fateauvi () eurxm3nodameemnci tfartr(m ot4olxomo3iasls2emumo () ltoircio1fp  au ils)t2umirpiu1ll  lietl(  Dtau oou1texnmo3tyslm2rl(mpnt)tlxomr oa1fpD ln i s)s2toim3ou4aleemnvia(  2um(ront4tpt ifcild sDua(mpnu) leoxo3oa1la rlues;t)srur(r3oo1lpte ncsl( s2rr(r nt4tlto fciltfs umn s (0trtnmr oytfmDe n o;s)t2uoiopiudapeemnct tf rrrump;u4aptnii3iat a2ra(mp;(4 lxomo3iytlptraivslt)t2xrio nydlpe  fcs (faDrr( poo0oex iietld aDua( p (4 rxrxf oatomD  i i;t  exo(r oydoleelicslt)a2rm( oou0aexnii3tltlmDrln p;t4 etomo3io1lmDe i i s)trxmxo oo4om   ncslt)artmu pot4tee mi3iyd s2um( onu4teerxo3io1optr uvils s2xrxr oy1om nlneil()s2tmx o;o4aetnmociysfmDrm(vo;t0altoxr ootfaDelivs s0 rtmxm3oydamtemneia()s2tm(mo;o0alx ifeias m rlu s;u4 eenmocia1lptelivi;t)teurxr iy1ll e fvsl(fsDrrum ;u4alx  o3ilt a ea(mo t0tltoxrcta1la e ueslt  eur(o3io1lp  lici ( aDtaxrpno0optoioeiaslaDra( p;(4tlenxfcoydfate ueslt teur(o3iodopt lfetltfarrmu ono0tlxo ociaslmDua(vo;u0teeomrcoydomDeau ol(0seurxr iydlm emicils) rrmxr ;u4opxniociaslm ua(mont)artrmoctatla  ln o t  rxrirpnu4ap elnvsl(faDtmurp;u4tlx ioeiadls2uln p u4trxnio3iadlp rlnvols)s2trir no4ol nmici t aDtrur ;o0openmiciyslsDrlums u0 ltomf ty1omD lnvi;()srxo(o3iy1lm  mieias)s2rrxrpnu0tptn f3iydfmDrm(monu)tetoircoo1faDrauvo;s0srurio3oo1amenlieta()s2tru  oo1aet  fetaslaDrlnmp;(4 rermfctotfpt  u s;s0 etoir oy4lle mict sfsDuru  nu1tpenmo3iysfs2rmuvsnu)arerxo oydfmte i s;t  2toiopoudalenmfeil()a2taxrp;o1optn ocilslm rlnmp;(4alxrmfcoadlm rlivi;s0trtoxm iy1al nmict s) rtrx  ot1apeo oetyd aDean o;t4teenmr3oodfmDean sls s2um(r3nu4aleemnvi tf rrmx  ot0tlenmf3tyt s elu pnt0tetnxf iytop eaneo t trtr(opoodll e ieta( arur(ro;o4oet mf3iys a2eau o;t4 exnio iodlm eaueo (  rtrim ny1oleemiet t)a2tru  ou4tpxnii3ildfaDuanmo;(0teermf tydfmtraues;s trumxo3io4om   ncsls)aDrrxmo;t0optomfeiltlaDem(vp (4tltnxfcoatfaDraieil()sruo(rpou4lpe lies (fsrrm( o;u4aex ii3iadls emnvpn(4 leoir3oa1fmteau o () rtr(mpnu1olt mivsl(f 2um(m nt4oee moctls m2ulumo;u4aeenif3oatlatraivo;(  eur(o oydlle livsat sDua(  ou0apx iicilt mDrm(ms;u4aexoio iydlmDeluvo (0 2ur(rpiudom e fvil()s2tmxmpno1apxnmiciys a2rmu p;()texrmo to1fatranesls0trxoio oodllt  ivias  Dtmurp;t1tpe io3iat mDuanms t)tetoir tydfpD  i o s  ruo(rpoy1am elicia(fs2um(rpoo4olxnmfciadlmDuluvo u4 rtnif ootom eau o;t) etrxopno1om n fci t)sDrm(mono0apen i3tlt a2rl( o (0 rtoxo tadfa elnei t0 rtm(r3iu4ll nmnct t)sDrru pnt0oexoif3iatfm ulnmp ()altnmo iy1omDe ues t) eur(m3oydope mivtasf Dta(r ot4tpx ioctytla2eln sn(0trtrmocto1fa r i o;t) ruoir oudale livtas sDtr(m ;u4tpeoio3iadfsDranvs (4 ltnxf ia1lpD lu olt)t2umxm iu1ol emncs s artr( pno1oeeniociysfaDrmn o;() ltrif3iytfpDe neols  etoiopny4lpeemfvsl() rrmump;u0opx mo3ilslsDranvp;t0alenxocoydla  ai olt0t2ur(m no1amt  neils) rrr(mono0alxomo3iytlmDrm( pnt4alxrmf3tadfmt auvi ( srto(m iy4lm nmfvtat  rua(ro;o4aptn ieild mDelu s;(4 eerxr3oo1laDelu o;(  rxr(o iu4omte fvs s) rrrxrpnt0tlen feiysfs rl(vo u4texnifctydomt  i i s  2tmxo oydapeemnes tf Dtru p;t0alx  fciytfa2elump t4tltrmf3tadlpt anesls trxmxopiydomtnlfctat) Drau  nu0opt  fctytls uaumo t4tetrir oadoa elnvils0teuoir3oydomt mfeias)arrmx ont0tpx ioctadfs rmnvs u0 etomo3ty1oaD aneo () 2xoxr iu4am nmfcia()a2ua( pou0aexo octyt mDelu ont0arxrif3tydfpte nvo;s truoim3oo4ame mivsas srrrxmo;t1opxnmictlsfs um(vp u) eeoxr3tadfp raivsl(  2urxm3oo1lpe lictat)artaxm ot4teenifciltlm2rln p;t)tltnmr tadlm rlu s s seurir nu4altnmfeta(farrrump;u0altomi3tldfmDeln p (4 rtnmf totlp elieolt0texmir io4amte nct s sDumxrp;u1teeo fciatfm2umnmonu0tetrir3iadfa r ieols seumxr3oudapen icilsfs2umu onu4optoif3iltfs2ra(msnu)aeenirctotfpD  ueolt0 eumim iy4ole lnei s)sDumumpoo4oeenifciysfmDelnvp u0teenif3tatlmte iei t  rtoimpou4om e icsl()sDta(moou1opxnii3iltfs rl(mp;u4 lxnxf3oodla e ieol()s2tmir3nydapt  ict ()sDumx pnu0opxomi3iyt m2rln pn(4 eenxocia1fmDe nvils) rxrxmpiodll  lncs s)sDraxm nu0tptoiieiltfs2rlnmpnu)trtnir3iydfpDean slt  etmir3oo4ape mnvsat)sDtm(r ;u4oltnmi3tytfs2el(vont4alxoxo iodfatelivslt0s2urxrpiy1op  lncs t)srumxm ;u1apx  oeilt aDeanmsnt4artomf oy1lptelnvs;(0s2urxo3ny4lp e fcils)aDua(mp;u1oltnmf3iltfs2rlnvs t4aexrmo oa1fa  aueo (0t2toxmpnydam  livi t artr(mpou0ope iieiytfaDum(vs (0aexrxo3oy1lmDr u o s teuo(r3oodaptemivsas) 2rrx  nt4apx  ocildlmDulu s ()tltoxr todlpDrlnei;()t2uo(rpiy4om   iviat)sDtm(mooo0tpxnifctaslmDelump ()texoxoctotop rlivo;()t2um(mpoo4lpt mfct () Dum(mpnt1aptoiieiltfsDum(mo;u0altrxfcoydfmteai s;s)srtrio oy1op emivt sf Dtrx ono1tltnmiciyd s2elnms (4 leoircio1fmD  n o;t0trtriopnu4om   nviat  Dtmx  nu0optn ietydfs2rlnvonu)arenmfciatfatrau sl(  eumio3no1ame lietl()sDraxrpot0oet io3tydlsDemnmon(4 exrxocoytla rluesl( teumxo iy4ap   nvt tfsrrrxm ou4tpxoioeiasls raumpnt)arxoio iatfa eauvi;s) euo(o3iu1ol  lnvsl(  Dur(monu1alto icilsfs2ul(mo u4aexoifciodopte ieo ( sruoimpiydoltn fvtatfsrrrxm ;t0apx  fetyd m2ra(mp;u0 leomrctytlat aivslt)srxrxm3no1apt mivia( s2ururpnt1aptnmf3ias a rm( p u)aetnxr3oa1op r n s t)srtmio3oy1lmenmictas)aDta(r ot0aeenmfciyt m2ua( s t0 reoir oodlat lueslt s2xoir3no1aleemfctl(f rurx oou4tpt iicias s ean pnt) rxrmf totfptelu ols0 rtrir3iudaleelivi t) rurxmpoo4altniietyslaDrm(von(0 etoxr3tatfp eauei;s sruoxm3nodam emnetas)srur(mo;t0apto f3ils s2uluvp u0trerxrcta1lp eanvi;s)t2xmxo oo1ap e ict s s2umxmpoo4aeto i3ildls ua(msnt0arerxo to1fpt an sl(0tetrxm3oy1op nlfcils)a2rm( o;u0oeeomfeiydfm uanms u0 exomr3ta1latrli ilt) rumxo3oydlmenlfes t)arrm(mont1aee moeilt mDul(vp;()alxrxr ia1om   n il( seurir ou4om   nvt s) rrm(roou0tetnmo3iyslsDea(vp (0artrmo3iodlmt ai s t0 eur(o3oodam nmfvt (fs2trxrooo0oee mfeiasfm2eau p;u4tltoxrcoo1latrlnes;t texm(mpno1lpe mfetat)s2rr(r nu4apxn feiytla2em(vp t)aeermfciydfp elnvi t s2uoxo3oo1om  liciasf 2taurpnt1alx mf3tydfaDea(mo;t0trtnmr3todlpDe uvslt0 rurxo ny4lptn ivi ()aDur( o;t4aetnmf3iys mDel(vo;u)tlenxr3tytomDe n ils)trxmio3oydame  ict () Draum ;u0teen iciad a2umuvp u) rxrirciodlate ues (0sexoxo iudllen icsls)artmum ou4tlxnmf3ils a umnvp t4altomo ta1lpte uvs (  2uo(o iy4ape  nvs t)s2rmu pnt0tpx mf3tasfaDrm(vo (4aeenir oodfpDe ivi t trtr(rpoo4am emicslt) ruaxrooo0oleniieils mDel( p;(4 rxoif3oo1fm r ues;(0tetrim ny4am n icias) rurur no0olxn i3ildfs rm(vs;t0teenxf iadop eluvil()teurxm3nu1llenmicta()sDtr( oou0oee  fctlsls2rln p t0tltrir3oatlat lieil()sexrxopnu4ap e fesls)srururo;o4alxoio3tlt s2ea( o t)tleoif3io1lat an s;s0 rxrxm oo1ame micias)sDrr(ronu0oltniictadls2uan s;()teerif iotomtrlnvs;s0srtoirpoodale livilsf 2taum ou0oetn ociat s uln sn(4 lenmo3iodfmtelueil()teum(r nu1olt lncs t sDtauroou0olxnmo3tatfsDrluvo;(0alermfctadfmtran olt sexmxo oodllt lnetl()arurx  ;o4teto fctydls2rm( snu)aleoio iytlm ean ols0seumxo3ou1ale  fvsat) 2uaum ;t1optnio3ilslm umnvs (0tlxnmrcoy1fmDraiei;t0s2xr(m iodoltemfcsl(f 2tmxmp;o4oexnioetadla2uanmpnu0tlenxf oa1op r ies;s  eum(r3oudlp   ncsa(farrr(rpoo0olx ii3iyslm uauvp ()trxomf ia1fpD aivilt  2tmir3io4apeemnctlsf 2umxmoou1oltoiieiat mDulu snt)arxrxfcoa1fmtrluei;s t2urxm nudol   net s) 2uaxr ;t0apx iietys s2ulu o;u) exrif oo1lptean s t  etmxo3iudap emnet t) rurxroot4tpt  oeiys a2eln o t)tetnmfciodlaDrauvols t2xmxo3nu4opeelivs ()sDraxro;o4tlxn i3iydlaDrl(vo t)treomo oo1fa r u s;(0trxmxr oo1lmt liei s)arumx  nt0tle mfetat m2uau s () rtoirctatoa elneo t)t2xrir no1lm nlfetat arur(r no0oltomicilsla rln snu)teenmfcoo1faDe uvi;t  rtr(r oydap  lneilt  rrrum ;o4olxoiociydlaDul(vo u)tleomr3ootopD auvilt texmir3no4amt liei sfaDta(m ;t4oltniietytla2emu pnt)alxrxf3io1la r ieslt texoxm3ou1omtnlivt (  2rrx pnu0tpenmfeiadla um( o ()tetomf ia1fp raneilt0teuoim iu4ap  mivt s)s2rax p;t0tlx micils sDulnmpn(4 rtrir3tadoatrluvs s  2xrxr iudol nmnct ( sDtrx pnu0aexnmictys a2rl( s u4alenio tytoaDr nei t) 2xr(o3oy4ll nlfvsasfartax p;o4tpxo feiatfm el( pnt0aexrxr3oytfmDrlivi;s s2tr(r nydalt mnei t)srtaumo;t0tpx  icilsfs2rmnvo t0tleoir tytlmtelieo;s s2xmim3no4openlicta()arraxrpot4apeoio3iasfs rl( o ()tlenmr3iadop   iei;()seurim3no1am emneiat a2urxm ou0oltnmiciasfaDulnmo (0aleomr totfp rln o;t0tetoxm iodll n nviat)sDum(  ot0tee  feiltls2rluvsnt)arxnxr oytfa  lueo;s  rumim3oodopt  fvs (faDta(mpot0opxo o3tltls rmnvo (0 rtomo oodfat  n il() exoxmpiy1lpenmiei (  Drauronu1apx iiciasfm2eau s;t0 lxnmo3oo1fate neols)setm(mpno4lltnmfvs ( srta(rpnt0aexnif3taslsDrl(msn() exrmf iydlmD lneo t0 exoxr3oo4oltemfvta()srtmumpnu0altn ictytlm rl( onu) ltnir3iodomDrluei (0t2tmxm iudoptelnvia( s2rm(r no1tlx  feiatfs2rm(msnu4arxoxfciotlaD anvo (0seumirpiu4omenmiei sfsrur( p;t0apenmf3tydls ea(mo u0artomr3oy1fa e ivol(  exoxm io4aptn ncsa(fs2rm(rpoo4tptnifcilsfsDemnmpnu0aleoxo3tatfmD  n ilt trumxm3iu1ole lfvilt  2tau pno1tpx  i3iltfa2rluvs (4 rxoir iotomD lu sl(0trur(m iy1opt  ictltf 2rr( poo0aleo ociad m2uan on() rtoif oo1fpte neol()t2uo(m3oo1amt lfet s arumx o;t1oexomietyt s ra(vp t0tltoxociadom r ueil(0seumxr oudop nliesls)aDrm(moou4tlxoifeiltfaDrl( on()teerif3io1omtelivol(0 rtmir iydaptelfcia(f Dtmx o;t0tetniicild s ranmonu) etnxr3ootop   nes;t0s2tmir iy1oleemnvt s)s2um(mpno0apx io3ild s2rau o ()tleomf iatoa e ieil(0s2to(m iodom  mfesas)a2um(  oo0oee  fciytls elnvp;t) etrxr3tatlat  u o;t)trxoir3iudapee iviatfsDtaurooo1ole mietyt sDra(vs u) reoio ty1oatelnvi t trto(opno1ol  lfvsl() Duauro;o4alt io3tltla em(monu4texrmfciotlmDraueil()trtoxmpoy4am  lneil()aDrm(r ;o4aex mfctadfa2emu ont) renmf oo1fa eaues ()srtoio3nu4alt  fvsl() Drmumpou4ole mociadla2emuvp () eeoif tytlpDe uvsl()s2tmxr iy1ope mfeiltfa2rrumpnt0apxo icils m2em( o (0arxnmr iatfpte iei s trtrirpnu1olt miesl()a2ur( poo0open fciytfm rl(ms;t)tetoxrctydfpD livs s0 eum(rpnydlmee net ()aDtaumoot4tpx miciltfs2eanvon(4aleomr totlm  ai s () rtoxmpnydlmen ieil( s2umumpoo1texnmoeiltls2ul(vsnu4alxnir iodfpt ln ils) rtmio3iudape mfctatfs2tm(mpnu1alxoioeiysfa emnmp;u)trtrxo iotlptrlues;t s2um(o3oydap   icia(fartmu poo0teenmictld s rl( onu4aetoxo3io1fmtrliesl(0seur(o oodlpt mnctltfaDra(r ou4oet  ociydlmDrauvs u4 etrxf oytfpDr uvilt  rur(mpiodomenmfcilt aDurxr ou1tetn i3ilsfs uauvpn()arxoio3oo1oatraneo t0s2ur(m3iu1am   fetlt)a2um(rp;t0apeomo3iltfm ua(vpn(0 exoir oo1fpDrliei s  2umiopiodal elnctls aDurxr nu0tlt  i3tasls elump t4 ltoio ty1fpDraues;t0t2uoio3oo1opt  ivia() rtaxrp;t1tpen iciatfm2rm(vs;t) lenxrctodlpt  ieo t0 eto(m3nodol elfvtl(  2tm(  ou1tpxomiciltfm em( ont0artrxo todfmDrlies s0t2tr(o iodomtnmnvsl()artruront1alto oeilslmDrl(vs t4tlermr tydfa e ues s0 2tr(m3iy4ame mnvilt) 2umumpno0apxo fciys sDrlnvpnu)altnio oy1oa ean il()trur(rpiudaltn fci s)a2urx pot4apenmfctydfs2uau p t) rxrirctatlpD lnvs;(0tetrirpoydomte ietl(  Dumumonu0aee ifciltfa elnvs t)teenmf3iytoaD  nvo;s) ruoxr3oy1op  lfcsatfa2tmu  ou4alx  iciltls rl( s u4teeomr3ootop r nvolt0 rxo(opiu1alenlict tfaDtr(roou4tleomo3iytls rl(msnt) renir tydlpte uesls0srur(r nu4lleelncs s a2umu o;o0oleoifeiltlsDra( o;u4tltomo3oy1fmtranei;(0s2xmxo ou4aptnlneiat  2rmurpoo0aptnii3ilsls eln s;(4teeoxocoa1op rlivs;s t2uoirpny4omeelictlt)a2rau  ot1olxomieiyslm2ean p;u)aeerio iy1fat anvilt)teuo(o ny4omte fvsat)arur(moot1oex mfetyd a rmumo t0tlermoctotom   ueo t0truoimpnu1omtemnvs t s2trx o;u1tle mi3iys s emnms;t0 rxoxf3oadoa  li i;t0sexoio3ou1lpt  nvt t a2ua(  ou0oeeomf3tydfa rlumo;()altrxo ty1la   ueo t  rtmio ny4lp e fcsls  Dtrxrp;u1aexn oeiatfm ran on(4arxrif3iodfateai i;t0 rtmxr3ny1ll n netltfartr(mooo1aee  i3tld m2el(vont0aetrmfcoytlaDelu s ()sexoir iu4lpt  neils s2uru ooo1tptoif3ilsfs ranvo;u0areomrcootfmDeanvs;t) 2urxmpiodoleelfeils s2rru  ;u4tpeomiciadfa ua(msnu0aleoio ootlat li slt)t2xo(opoy4omenlfvt s a2rm(mono1ole mieiaslaDeanmo u4alermo tydfaDeanvi () rtrxo iydopenlfei t  Dtax p;u4olenmo3ildlm ea( s t0 etrmf iodop  aues t0 2urxopiu4apenlietatfarur(mo;t0tet ii3ildlm ua(vp;t0tlxrxrcoytomD anvo;()t2toio no4alee fvtas) ruaum nt1tpeo oeildlm rmu o;t0 ltrmo3ty1fmt  i ol( s2urirpoy1omt  netl(fa2raxroou0tlto o3iydla eau s;()alxoxrcootomDe n s;s0setmim oy1ol  mfctlt) Dtax  ou4tlt  fciad s2ra(mont0 exoxrciy1lp r ieo;s  exmxmpny1lm   fvia()s2tmx p;u1tle  i3ias s eanvs;t0alxrir oy1lmt lieols) 2tm(m3oydlm  lfvtls  rraur ot4teeoiictat a ean o;t0 lxrxf3io1faD aivo s  exoxo ou4apenmicslt)aDtaxmp;o1ope iieild s2ul(vsn(4tltrircoodom e i s ( t2trir3iodaptn nvslt artrx o;t1alx mf3tldlmDuauvs;u) rxnif totoptrlnei (  rto(mpio4altnlici tf rtrxmp;u4optnmiciyt s ua(vp;t)teeoif iatfp   nvo;()s2xmirpiodlpeelnctl() Dumxr ot4aptnioeilsfa rlnmont0trtrioctadlpDeaivs;s) euo(r oo4am n icilsf 2rau  ot0olt  ieiys mDrluvonu4alxnxr3ty1omDean i s)srxoxm io1lmtemivil(farrrum no0tlxn feiysla uan p u0arenxo to1lateai i;s0 euoxmpiy1lp e iciltfa2ra(r ot1tpxnioctaslmDranmont4 ltoir to1lmDr ueo;t) 2trio oo1al e ieiat)srtmxmo;o4aetnmieiad m uau p;t0 eerio to1opDr ivo;t seur(o3ny4olt lfvtl( srtmu p;o0opt mf3iadlm2umnmsnt4trxomrciodfat li i;s sexmirpoodlmtemies t a2umxrpno1ole  ieias aDul(vo () ltoxocio1la  lu i;s)trxoxm nu4lm emieta( srtmu p;t1tleo feiysla em(ms (4aleomfcty1fpDeluvo;s  exoimpoo4omtn ivsatfsDtr(moot4tptn fciyd m2rln o t0artoxo3iadlm  livi;t) 2uo(opio4opteliesl( arrmumono4oee  fetytfm ua( snu4 etrif3iy1omDe uvol(0seum(m3oo4olte fetlsf Dtmxmpoo4aetnmoeiat sDra( s t)tlxriocoodfateaieils)texrxm3iu1lmenmicslt  2ta(mo;t1aptn fciydls ranvo;t0alerio3iydoptr nesl(0setmim io1amee ncsltfsDtmur ;u0tpxn ieiatfsDum(mo;(4 etoxf iadfmDe n o ()sexo(m3iy1apenlfci sf 2ta(moot0apx  fetysfmDeanvp;(0arxoxfctytlpDeaiesl( t2xmxopou1lptn ivi t aDuaum nu0ope mf3iydfa el( pn()alerir totfpDraneils0 eurirpou4omte iei s)srrmur no0tpxo ietatlsDean p;t0 rtrifcoydlm  ai i;t t2umim ou4op  mivslsfartm(mp;u0altnio3tld sDrl(ms t)tetrxf ootopD  n i s)srxoimpoudlpt mfcs t)aDrmxr ;t1aeen iciatla2um(vp t) ltrmocoytopt lnvol(  euoxm ou1lmtn fcta(fa2rrx  oo0aexnmfeiyd a ea(vo u4 eerxrciadfmD  ues;(0setmxr3iu1opt mivtasfs2taxm ;t1aeen ocild s eaump;u0 rtnmf3oodomtr n o s  2toim3oo4am   neil()aDtrumpoo1teeoiieiys sDeln on(4treoirciotomte ivs;( s2trxr oodlltemics s)sDrax o;t0oltniocilslm2rmuvs (0 lermoctotlate n o;( srtoir iydomt  ietas  Drmumont0olxoio3tlsfa rlu o;t0 exrif iydlptr n s;(  2umir3iodop elict s  rra(r ot1oltoioeiyslsDrl(mon(0tetoir3todlmD aues () rtr(m iy4lmtnlnvi s)artr(m ;t1tet  o3tldls2ua(mp;()aeenifcoa1optrli o t  rtoxmpoy1op  lfvta()arum(mono1oee iieiasfa emuvpn(4tetomo3iotopDe nvil()tetmir3nu1ole  fci t) rururpnu0tlenioetyd m eanmo u4tltnxo iodop  aivo t srxm(opiodap nmfvs tf rtrx ooo4altomoeiyd s ul( s;(4 rtomfctotop rai i;( t2umxrpnu4lm nmncsa(  2ra(r ;t1tetnio3tlsla2rmnvpnu0trtnmf oo1lmDrauvo;(0tetrxr3nodopeelnvsltf rtr(ro;u1opx  o3iyt a2eauvp () lxrmr3totfmtraueslt s2xr(r3io4am e neias aDtr(m ot1oet mf3iytls emumo;()tetnxrciytoa r nes;t) rtmio oydaptnlici (fa2ta( p;t1apeo i3iytlaDuau s ()aeenmf3tydlpteauvs;()t2toir3oodape  nctls)sDumum nu0tpeoioctld a ranmsn()aexoxrciatlp rlivols)seum(o3nu1lp  lnvil(f Drrur ou4oexomieiytlm2rauvo () exnio oodoaDr u s;t0texm(r3ny4lptnmfcilt srur(rpnu1altomfctlsfs elnvs u)aexomo ia1oa   nei;()tetoiopoy4altemncs tfartm(mpou4texnmfetasfsDuau s (0alermo3iotoa e neol(0 2umir3nodop emnvsas a2tm( p;t0oleoioetlt sDrm( o;u0alenxo3to1lateaiei;t)s2urxo3nu4lm nmncsltf Dtr(  ou0olt mf3iydfa um(vs t4 etnxrcty1omD ai s t)setmxr3oo4lp  mfvi tfarumxr nt4texoiietldfm ul( p;(0trxnif3oodlp rlueo;(0 ruoxr nu1alenmfet t) 2uaxmpnt4aptoio3ias s2rluvonu)altrif oydopDe i ols) eto(rpiudop n ictlt sDuaumono0aptniociys mDea( snu)aexnif3tatlmD  uvs () rur(rpoy4ope  fvi tfs2tmur oo1oexomf3tys s rluvs;t4altrmocoytlpDrai il( sruo(m3ou4opeelnvtls srrmx ono4olt moeildla rlnmon(4texrmf3ia1fmD auvs;t sexo(r nu1apt  fvslt)sDrrumpot1aex ioeilsfa emnmo;u0tltrmocoodfaDr u s s) rtrxm oo1amt miet (fa2umu ont0texn ictltfm uln o u0arenmr iytlmD  ivo (0 eurxr iy4op n ieta( srtau  ;u0tex  feiasfa2um(vs;u4tlxoir3ta1fp eaies ( trxmirpio4al  mics t) 2ra(r ou0oleoii3iad a eauvpnt) eenio3iydfm eaivi;()setr(rpnydomeemivt sfs2tm( o;o4aexnmo3iadlsDuauvsnt4 rxrxrcoa1omtrli o t)teuoimpnudamtnlnctl( aDra(r nu1oetniocias s rmu s;t)trerxfcoa1omDelueo;t setmio oy1om   ict t)artaum ;o0alxomfciysla2rmn onu) lxriociotfmDeau s s trxriopnu4omt  nes (fs2urxmono4oet iieiydlsDrm( p u4trerxr3oatlp raieo;t s2uoio3iydop nmieil(f 2ua( p;t4alt  octatfm2umums (0 lenio oodlmD  n o;()truoxo iu1lme lfvt t  2tm(mont0aptnif3iltls rauvs t4arxnxf3iodfmD  ivi;(0 2toio ny1omtemnctat)arumx ooo0aee ifctydlaDum(mo u)tlxomrciatfatraies;s0s2xm(mpnydllt mieias a2ra( pno0tlxomfctys a ra( s;()aetrxo io1faD  n ils  2um(opoodllte fcia() Dumurooo1opx ioetls sDuauvs;t4aleoxrctytfaD lies t0setrir oydlmeemnvias sDuaumpno0tpt  ieiatla ean snu) eerxo3tydopte n olt teur(r iu1ol n nvs () rur(ro;o4olt moctysls2rmums;(0 rxoirciytoatrlneols t2toirpiy4amenlfes ( arra(mpnt0texnmfctatfsDulnvon(4arermo tytopt ai ilt) rxmirpio4alenmiesl(f 2rrx  ot0opxn oetltfm rlnvs;t) etrir iadlptelueolt tetoio nydlmt lictl( sDrax  ou1ale micias mDemnmont0 rermrciotlatr ieols)s2xrxo3oo4omee feil(f 2taumont1tpe mo3ilt s umnvsnu0tlxnmr iodlpDrli sls0trumxm no1opt  fcias)sDtaxmp;u0tpxoif3tysfa2um(vs u4trtnxo iytopt lueo ( t2xrxm3ou1ll   ivsasfa2rmx o;t0tet  octydfa2uauvo;()trtomr3tydop   uvs t s2uo(m no1apte icsat)srtmxrono4tlx ioeiatfs umnmp;t4aeerxr ty1fmDeln o;(0tetoxo3nu1ll elicslt) Dtmu  nt4opxo f3iat aDrluvs;t4 rxoircoatlaDranei;s)teurir ou1alenmivt (fsrrrxm ;t4tlxoiieiadla2eluvp;()tetrmo3iatopD  ivi;( s2tm(m nu1al  mnei ()a2ur(mpou1tptnioctydfa em(monu) etrxrcoodlm eai il()trxoxmpiu4amt  fci sf 2urxmpnu0oltomo3tlsfs ran on(4 ltnio3todlp rlneo s teumxo oo4ole  fctasfsDtr(  no4tlen fcils sDum(mp u4 ltrxo3oatoptr uvsls0t2xr(mpoydlle lncs ( arta(rp;o4aptnifciltls rau p (0trenxfcoydlpt  i i (0s2trxm nudlptelnesasf rtmu  ;o4oltn oeild aDelnmo;u0tlxrxf3tatfp e neolt0s2uo(r iy1ll n iei t  rumu pnu4tet  ieiatlaDumn onu)tleoifcoytfatrln o;()trtmxo oydop  licsa( arururo;o0ape  f3iytlsDumump u0texnircoadfmt  uvs (0trtm(m3oydlp  liesa()a2rrumono4texnmiciydfm2eluvs t4 lenifctydlmte neo t0trto(opiu1lptnlfvi s)srtru p;t0tpx  ocias sDumnmonu0tltnmf3tatfmDeauvo;s  2xrir3nydapeelnct t  Dra(m nt1olt  o3tat a rmnms;u4teerio oadlat  ivs;(  rtoxm3nu4apeelivta(fs2rmxmp;o4tlxoiocildlsDua(vont4aeeomo3oatlptrlues;t) rtmim3io1ap nlncs (fs2ra(rooo0aet mi3tys s2um(vo t) ltrio iatoa  lu ilt0trxm(rpnu4am  micias) 2tr(  no0alt iieilsfs2rau s (4aexnmfcio1fat anvslt s2tm(o3iydlm e ietl(fs2rru onu0teto fciatls rlumon(0 leomoctotlat lneolt) 2tmir3oy4ap  lnvia( a2tmxmp;t4apto ieildls em( p;t)aexrmrcoytlatelnvo s0 rum(opnudaleelnct (fsrraxm nt4oltomieiyslm rm(mpn(0altrmr3iodfmDe u s s)teto(r3iy1altn icil() rumur oo4opx  oeiat s rm(ms;(4 renmoctotlmDeanvo;t)t2toxo nodlp nmnes tf rrm(rooo0opx  ociasla2umnmonu4 lxnir3iytlptrlivsls seuo(mpnudaptnmfvtasfsDraxm nu4aee mfetad sDea(vonu)teeoircto1laDelnes ( texmio iu4ol elieilt)aDrmxroot4oltnmoctldlmDrl(ms (4areoir iodlpDrlivs;s0trtoim io4om   ieil(  2uru  ;t4aeeo fciadla2ra(ms;u) lxomfcoy1oat  n s;s s2xm(mpnu4aleelnvs tfa2tmu p;o0altnmo3iadlsDrm(mo (0aeerio3totlpD  iei;s)seumir ny1lmeelfvtl(  Drrxr oo4tee  oetatfs ranvo (4 leomr3ta1oa  au sls)srtoim3iudop   fcilsfaDraurpoo4oltn i3tltlmDulnvp;t) rxomo3tatoptr neolt0 2tr(m oo1lmenlict t  Draxrp;t0texnmi3iyslm uluvont0trxoir3todopD lu slt) rxmxm oudlpenmncta()sDumxro;u0oeen o3tld s rl(vp (4 rxrmr3iadlpt  nei;s0t2trim3ny4amtemfvilt)arrmu pnt4opto octas aDea( p;u) reoircoy1fp ean ils  euo(o3nu1apen nvia()sDrmur nu1tptniieiytls2eauvp u4arenif3todomt  ivo ( s2tmim no1omee nciltfsrrrxmpou1tetnmi3ilt s emnvonu0tleoxo3iodop rai i;t  2xr(opio1alt  fesls arum(mpnu1opxo fciatfaDeluvonu4 rerir3oatfateai ils sexo(rpnudolen icsa( sDtmu pno1aptnmo3tldfsDrln s t4aexoxr tadla eauvs;s0tetmxo3ou4lptnliet tf 2umur ot4aleomi3iat m uan s;u4 eenifcoa1lpDeai o s srtrxm iudom   ict ( artrxmp;o1tpx mfeiydla2ulu o;() eenxoctadla e u s t s2urim iudlltnlfeilt srta( pno0aptomfetlt a2ea(msn(4 ltoif oydfmD aiei;s0teum(r3oo1llenmneta(f rraxmo;u1texomi3tlt a ea(vpnu4arxoxr ootfmDelieols teurxrpoodam n icslt)arur( ooo4tpt ifciaslaDelumpnu4 rxoxoctodop eli o ()srxo(rpnu1aleemieil(  Drm( o;o1tlxnii3tldls2um(vsn(0 reomf ia1oat  n o (0trxmxrpou4amte fcta(fsrrm(m oo1tpt mi3tlt a ul( p u4 ltoxf ia1oat  uesls  2umxm3nudll  lnvs s) Dtru poo0optnii3ildlsDua(ms t0teeoxoctydfpD  u o ( s2umxmpoudol   ieia(f rtm(  ot0tpenifetysfa rlu o;t)trerxo tatlm  aiei;s0t2umxrpoy1lp elfcs (f 2uaurp;t0tltn iciyd m emnvpnu0 lermocoa1fateli i ()teum(r3oudlltn feils)srtr(mp;t4oexn iciltlsDeln p (4areoxrciotfmtr ivol( texm(r nydopen feias)artax pnt4tlt mi3iadfsDra(mpn(0alxnmo ty1omtrlivs;s) eto(rpiudllenlnct sf Dtmu p;o0aleomfciadlmDumn sn(0 rermr ty1omDelueo;t0trum(r3iu1lpeelicil()srta(  ;t0oeeomicilsls ulump;t)alermr oytfp e neo ()sexm(m3oudome micilsf rrau ooo0tpxn f3tatlmDrmnmpn(0artoxocoatfp rli i;(0 2xo(o3iudlmeelnci t  Dtrumpoo4opxo fetltfm2rlnmsn(4alxnmr io1lateaues;s0 2trim3iydame  nvias artmumo;o4teen fctytfs raumo;t)teenxr3iytomDe neo t)t2trxr oo1alt mics sfs2rm(  ;t1alxoii3tltls ra(vont4 eerir oa1fa rauvi (0texoxo ou1am n fvt s)s2uau pnt0opt mf3tysla um(vo;t)altnxf3oydla  lueil( t2trxo ou4opt lnviasfaDrm( ono4ole mi3ild a2uaumpnt0alxoircoadlat au s;s  2uo(r3nodam emfvs s) 2tmu pou4oex mfciytfm2ua(vo;t4 lxomo tytop r neils  etmxr oy4oltelncsa(fsrra(rpot0opxomf3ilt a2emnmpnt0treoio tadlmtelu o;s t2tr(m3iu1om elfcia(f 2uru oot4tpxo f3iadlmDea( sn(4 leoif3oodfmt anvo;t teurir iy4lm nmies sf 2trxrp;o4tlx  octys m elnvs t4 rxrxrctodlaD ln s t  2trxo iy1amtn ncsltfa2taurono4tpx mictlt m2eauvonu)teermocoytfa rlneo s)trxoxr3ny4al emfesa( sDtm(ro;t4aeeomiciysfs emn p u0arerxrcto1fp rlivi;(0 rto(mpnydole lfetat)s2rmx p;u0oetnif3iad m2eanvs t)arxrxf to1omt ln o;t) 2xoir oydom n ivt ()arra(ro;o1tpx iietyslsDeauvpn(0 renxrcta1op  livo;s)seuo(o oydal n feilt)srra(mp;o1alen ocias s2emumonu4 lxoir3oadomte ivil( s2tmim3iydapt  fcs sfsrtm(rooo4apxo i3iydfmDulu on(4aexoxf tytlp  luesls  2toirpnudomtemfct t)sDrmxr ;o4tet ifetatfm2ulu sn(4trenxfciydlpDraieils0s2ur(mpiy4lm n nctat)aDtm(m ;t0apxnioeias s2um(mont)tltnif3tydoa   ivo;()t2urxo nu4lptn fvsa() Drrump;u1tltoiieiad sDeanvon()tlenir3oadlpD an ols0sexr(r3iydamee fesl()s2tmxrp;t4teeoiieiys sDeaumo;(0aeenxrcoo1oateliei t)t2xm(opiy4alte net (  2trur ;o4teeo i3ilslsDrluvpnu0aetniocoo1fm   u s;(  rtm(m iudlpe  nvta()aDtauronu0olx  i3tysfsDrl(mp u0alenmoctatfp e u ilt sexoirpoo4optnmnvsltf rrmxmpnu4aex  fcildla um( s (0altoxociytfa rau ilt truoxo iy1lle miciat sDuau  ot1tpto fcils s2uluvp () etnmfcootfpt ai ils  rur(opou4aptnmfviasf 2ta( onu1aeen o3ils a2ea(mo;()trxnxo oydlaDeaueo;() rtoiopoy1lleemfeiatfs2rax ono0oltnmf3iasfa2ul(monu4alxnxf3tydoa  ln i;t0t2urxopoodlm elfesls srururoot4oeeoiicild s2elump;u4trermoctytoaDr i i;( s2umxmpnudap nmncsl()srrr(m ou1texo o3tysfaDuaumo;u0aeenmo tadom eauvs ()setmio3nudalt  nvs tf Dtr(mpno1tle io3iysls2rmnvp u4 ltnxf tatlm   ueol()s2umim3io4ol emfvtat)srrm(ronu4oee mo3ildfmDuln o t4 exomf3iadfa eauvi;(  eumxrpoudap elfcsas)s2rrxr oo4oetn ieiytfa2eau s;u0artnir3io1fmte uei;t0 2xo(o3nydope mfvil()aDtaxrp;u1ape ioctytla um(mp;t) eerxf iatopt ln o;(0 exmxo3iu4ame  fcsat s2tmu  no4tetnifciatlmDuau p t0 lenxf3iatomDe nes;s) 2tr(r iy4ol e ivslt srrm(moot1opt io3iytlsDeluvs;t)texrmocto1laDranes;s  2xm(rpnydlpe mfcil() rrm(roou1tleo ocilt mDranvo;t4alenxfctatfa r neilt)seurxo iy1ol emicsl(fs2rax pot0tet  o3iys s elump ()tlxoif oydomt au o s s2xrxm3oy4lpen ieslt a2ur(  ;t0oeeoio3iyd m elnms;u0tetnifcoatlmD lnvsl(0srxm(r3oydop emncslt sDuax  nu1oleomo3tadfa eanmp;u4 reoirciytfm rauvo ( s2xmir3iudopt lietls artaur ;o0altn oeiyslm rm( o;(0tlxrir3tadoatrau olt trur(r3ou4apee ivs t)aDua(r ;t4oeen i3iysfm ra(mo;t4aleomocoa1lmtr n ol() rtrxrpny4aleelics t aDuaxr no4aeen f3iltfm ra(vp;u0alenmrcta1lptraivi t0teuo(rpnu1lp e iei ( s2tr(mooo0tpt  oetadls rmu s;u4tetomocta1fa   ueol(  2xrxo ou4llenmfeil(fs2rrurpot0olt io3iltfs2elumonu4aeenxociydlm rai s;t0trxmim3iudlmeemfeiasf 2tau pno4tlt moetadla rm( pnu) rxnxo todoate ueols)setmxo3iy4ll n ivtl() 2rmurooo0oexnioeildfsDra(msnu0tlenxr3ia1omDrlnvs;t0s2toxmpnu1lpenmnciatf Drrurp;u0apenmfctyd m2emuvpnt)aeenmr3tatfmDe u s;s0 2xmio no1al emfvtlsfsrtm( o;t1alto iciyt a rmums;(0trxoxo3iotopDraueo t0 rumim iodap emfvi s sDrr(  ;t0texnmoeiat a2rlnvp ()aleoxr3iatlptraieo;s0 etr(r nu4lp n nvi t sDrrx  ou1opxomictatlaDrmnmpnu4 exrxf totlaDrli sl(0 rur(mpou4op   iet t  2raxrp;u1alto ieiatfs2umu ont4trtoio iydfateluvol()seumxr3iy1am  liesa()aDtru p;u0ale iictytlm2rm( snu)aexrif3oo1optraueols srurim3iy4ape mnesltfs2tmu pnt1oeeo i3iysfm emnvp t)arxoif ootfmt  i s;t) etmio ny4omtnmfcslsf rum(mpot1apeoiictysfm em(vo t) eeomr oodlaDelu il( sexm(o3io4lmen ncsa(faDrax pot1oetoioeiysfa emnmo t)tltrxr ta1lmD  ueo s)srurxm3iu1ap   fvt (  2rr(  ;u4oet  f3tat a2rlnvo;() renircio1lpDr uvo;t)trurir3nu4altn nesl(f Dra(mp;t4aexomictltlsDuau onu4altoir oytlmDe ueslt0 rxo(mpiydlpe  fct (fsrtru p;o4altniociaslm uau pnt4aexrmfciotfmtr iei;t sruo(m iy1ape  iei s  2raxmono0aleoiietas m em( s;(0 lxomfcoy1lmDeaneo;t0 2tmim iy1omee nvtatfa2ra( o;o0tlxoiictysfaDeanmo;(0altomo3tatomDeli o t trxrxr io4lptemfet tfaruaxm oo1tpt io3tltfs2elu s;u4treoio oatoate n s s)trum(mpnudlle mfcilsfsrrru  ;u0tlx iicilsfm2elnvp;t4 lxoio iotfm   n s;t0trto(r oy4optnmncsa()aDumxrp;t1aex ioctls mDuanmsnt4trtrif3totoa ranvi t0 eumxr3oodlp nmfvtatfa2rrxmpoo4oex mo3tydfsDrlnmp u) rxrmrcia1om  aivs s) rum(opiudll emfci tfsrrm(m no1teto f3iyslmDeanvp;t4 lerif3iodfaDr n i;s)t2tm(opno1olee nci (fsrum(rpou0tpxo feiyd s rln p u4 leomfcta1fmD li sl() euoimpou4llt  ivt () Dumu  ou0tpt mociys m2ul( pnu0trtoxo ootlaDeau o t0 2xoxmpou1omtn ivta()aDrr(m nt0tetoiieilsfmDemuvpnu) rtoxf3iadlm elnvs;()seurir iu4opt mneta( s2ra(r no1tpt mo3tls m ra( ont0tlerxo3oadlmD  uei s  eur(r iudapeemivsas  rum(rp;t0tle  fctlt s ra(vonu0 exnmf ootfatr ieil( srxmxrpiu4alenmneil(fs2umu pnu0texn octld aDuau ont)tlxnmr3oatomDrlieil(0t2uoxm oo1ol elfcslt  ruau ont1alenif3iasfsDul( onu4 leoxfciodom elivi;() 2trxopoydomte nvi s)artaumono4apt ifetadfm2emnvsn(0artoxr oydfm  ai ils  2uo(opoy4llen fes tfs2rmx  ot1oee  ocilt s2rlums t)trxomf3iytlmDrln ilt s2uoxrpoo4lp   ici (fsDurx  ;o0optoiietasfmDumuvp;t)tlermr io1fpDeli ils)srtrxm iy1amtn fvs sfartm(mp;u0opx  fctldlm eanms;u0 exrmo3oadlm  aieilt s2xm(r no4openmnvi sf Drr(rpot4tlxn i3iltlaDua( on(0 exoxoctytlp rau o t  2ur(o3iydole mnctls)aDrmxr ou4alx  ieiasfa ulu p;() lxomo io1oaD aneolt) etoiopio1ll elictl(fsDurxmonu0aexo octatfm2uan s;(0aeeoxf3iydfatrlneolt sexo(m iodam  licsa(fs2uaxmp;o1tle  ietatls2rauvo u0tetnir3to1oa rlueo;(0 ruoimpny4lm   fvia(f 2rru ooo4optnmocias sDumuvpn(4artnmf totoa  livo s)sexrim nodlpt liei s sDumum ot0oetoii3iasfs2rl(vp;(0tlxnxr tytoatrli s s)s2tmxm3oy1am n iei tfa2tmxm ;o0aeeo f3ilslm umnvpnu0 ltrmoctadlpt lnvslt0 exmxrpoodap   fvi sfaDumx p;t1alen o3iysfa2rm(vp (0aetoxf3iydoa   n o ( srxm(opnudlpt mneilsf 2uau p;t4oet  iciyslmDrm(vpnt0 etrxo iodomD luvs;t)t2trirpou1lmeemnvs t srtmxrpnu4tpxn i3iyt a2ra( p;u) rxnmr3oytomt  nei t)trtmxo3oy1ol   nvsa(fsrur(ront4olt mfeilslm2umnmsnu4tleoxo iadla elnvol(0 eumim oy1lptemncslsf Dtax o;u0optnio3tlslmDrlnvont0trermr oatla  lnvs;t0 etrirpiy1opt lnci s)s2tmxmp;u0oeto o3tldfa ra(ms (0aexnxrctotlatrln ol(0 eum(opnudopen fvt ( artm(moou0ope  feiydla rlnms t4artrmf oo1fm eli s ()s2trir ou1ll elfvtl(f rumxr nu4tpeo f3tlslm2uan o;(0 lxnif3todlm r nvsls)srxmio3ou4lpen ncs ()a2taurp;o1tlxnmo3iys s uln s u0tlxomf3tadom eau o;t) etoxopnu4lp  lnes sfs2rmxrp;u4tlxoiicilt sDea( on(0teeomr tadom r i sls)seuoio3oydale lfci (f 2ra(m nu1aet  o3ias m2emnmont0aexrio3tatlptrlnvs ()trtoxopny1lp nmfvs s) 2uaxrpnt1apto ietys m ul(ms;u)trtnxfcoodfm  li o s0trtmxo3ou1llenmnctls)a2umxro;t1teeomi3ildlm rmuvs u)tlxoio3oo1fm eln o s0trxoirpno4oleemfei tfaDrax  ;o0oeenio3iltfaDrl( s u)trtrir oadop   uvi;( t2urio iydllenlivtasfaruaurpoo4oeto iciyd m2ul( p (4aexomrctydopD  nvo t  2trxr oodap emiviltfa2ta(rp;u0tltnifctltfm2rlnmo t4tlxnxr ty1lm eauei;(0trxrir3no1lp   nvi t s2tax o;u4optomfetlt aDrl(ms t) leoio3iatlaDeluvi;(0 rxm(r3nodol  mnesas  Dua(rpnt1opeomicilt s2rlnmsnt0tetrxocoa1lp rai i;s0t2urxrpoy4lltemnvsltfsrtr(root0oleoii3tas m uluvonu) lxoxocty1omDelivils0 rxo(rpoodlmenlncil( arrmur oo1opxn oetldlm2rmnms t)trenmo to1omDr ieo s t2xm(rpnudllte fcsa( sDta(r no1tlxn o3ils s2rlu s;u0trenmo3ootfmDe nei t)srum(r3nodopen fetasfarra(root4tptnmieiad aDuan ont0 exrxr tydfmDr iei;s) etmir3oodlmen nvia(fsDrm(r ;u0olto oeildlm em(vs u4 eermf ia1lateli olt0trxrimpio4ll nlnctlt)srraxm ou4tpeniictytfa emu o (4alxnmo3tadfptrlivs t) rurxopiodlptn ieias)sDurumooo1aeenmi3ils sDulnmo (4alxnxr oadlp   neo t trtmxo3oodal n fvi (fs2raurpoo1ole mi3tlsfaDrlnvpnt4 etnmrctatfm  aiei s0seur(o nodolteliviasfa2umxm no0aeen ociltlsDea(vp t) eenio todfp r ieol(  2um(opio1al n feia(  ruru  no1teeo i3iysfm2uau p;u0trtoir oodlpDeanvol( sexmim ou1om elicsat  2rr(rooo1opx mieils mDemnmpn(0alerif ia1lat  nvolt0t2xoim iydopen fcsl(fa2umumpoo0alxomo3iytfs2um(mp (4tetnio ta1lateaneols0trxmim3iydolt  ncsat  rur(r ;u4oeeniociadlsDulumsn(4artoif3iydfat anes;s trurxr io1lpee netas)srua(  ;t4texn i3tld sDulnms;u0 renxoctatlm e neslt)srtoxrpnodlp n ict tf Dta(rp;t0tleomo3ildfa uan snu4 ltoxr ty1fmtrauvi s0srxm(r ny1lpte fci ()aDtrum nt1oexoiiciytfm rl(vpn() rxrmocoadlmDr ivo;()trxrxm iydomt mnvia( aDrrurpoo0opxnmfetlsfs2umnmonu4 exrifciodlm elneils  rtr(mpoodlm n fctlsf Dtaum nt1opto i3iytfm ra(ms;t4 rxrmr3ty1opt aivo t) 2tr(m3nodlle lfvs s)s2trx o;t1oleo octltfaDel(vpn()trtrxo tatoate ues t texr(mpnu4amenlfvsat aDtau oot0oeeo ieiatfa el(msn() eerxo ootfmtr u i s0 rxmir3nudlleelncs t)arumx p;u1alto ieiadfsDrlump (0 rxrxrcoatomD ai i;()srur(opiudlmt liei sfsDtr(  no4openioeiydfm ra(vs;()teeoio3iatlm ean sl(  rurio3io1omtnmfvs (fartmxrono0alt iicildlmDrmuvo;t4 rerxo io1omte iei;(0 rtoir3nudale  ivsas)a2umxm nt4oee  ictytfm2uln on(0 lxrir3oo1lmte i slt0teto(r3io1llenlivsa( aDtrxmpoo1olenii3iadls rmu p t4 rxrircoadlpD anvol()srtoio3iydlmenlfeslt)a2rmum oo1tleo ociltlsDea(vo u0 rxrmo3ootoaDe nesls t2trxr iu1lpt  iesat  rtmxm nu1tpt  ocildlm rlu o (4tlermr to1la  ai o t0s2toxrpny1lmenmncsa( sDuaur ;o4tpxnmoctaslsDua(vs (0 lxnir oytomD lueil( seuoxo iy4ll nlnvi t a2ua(mooo4oeeo o3iys a2uan p;u4teenxf iydfp rlues (0seurim3iu4ope livsls)sDrrurpoo4aexniietyt m rmu p;(0treoxociotlmD lnvs;s0trumxo3iy1lmtelicia(fartmxm ;o1tpt mictysfsDua(ms;u)teermo3iodop eaieilt trtrio nu4olte nei t  Dumxrpou1olx mfeiasfs2umump;u0tlxoxf totlmDeluei t teto(opou4oltelnvt (f rra( pnt0opeoif3tltla ulu snu0 rtnxfcoadfateai ilt)truoxo3ny1omt lfeil(f rrr(r ot0aeto o3iasla eanvo (4trtrmfciotlmDrli o;t  rxmxr ou1altn iviasfartax pno0tpx moctlt a2rm(vpn() renir oy1oate ieilt0 exm(o iu1op n fvtat)aDurxrpoo0tlxnifetld s2ea(mo t)artnxf tatlmteluvo t)trum(m3nu1optn fciasfsDrmum ou4apto feias s uaump u4alenmocio1lpD lu s;t) 2um(mpnu4lp nmnvi s) 2rmumooo4oexnmi3tasfm2ul(mp;t0tetnmfcio1late nvs t)setoiopny1amee fcilsfa2truro;u1aetomoetytls2uln o;()arenxo3iadlpD anvo;s0s2ur(o3oo1lpt mnci sfa2taurpou4olt  ieiytfm el(ms (0arxnxoctytlaDr n ils trxmio3iu4altelnvsa(f rtrum oo4tpen iciltlm2um(vo;(0tlxoio3iydlpt aieo;t0 2uo(m3nydlp   ivsat) rraxm ot1tlx moetlsla ul(mp (0tlxrxf to1fp r u o;s) eumimpoo4aleemnviltfsDta(mooo0apeoiietldls2rau p;t) reomr3totlpDean ils trtoio3oudopenlncsl() Dumur nu1aetn i3iadlm2uan p (4altnmocia1lm rluei;s setr(o3ny4aleemfctas aDrm(  ot4olxoioetys m umu s;u0trxoxfciotop eau o;s0teuoimpny4omt mnesa( sDtr(moot4tpx iietyd a el(vo;()arxnxf io1lmt  i olt0teum(opnu4altnmfvsltfsrta(  oo1tlxomo3iyd m2rlu p;(0tlerxr iydlp   nei;()teto(opiudamenlicsat) rrau ont1opx  ociyt mDea(mpnt4altrmo3iodfpDe ueo;t)t2xoim iudlme lnesat)arur(  oo0tptn fctytlm2uaumon(0trtomf oytfaD  u sls) 2ur(rpoo1ll nlnesa( srta(mo;u1aptomietltfs2ua(vont4trxrxo oo1omDelnes t  exrxrpoo4omtnlnei () Dtmx  ot0oexoioeiydfsDrlnvs;u) rxrmociytlp eaieo;t) rum(r3iu4oleemivtl()arrrxr ;t4ale if3iasfa el(mp t0 rxrirctodfa  lieo;s  rto(o iu4ope  ivs s) 2umxr nt0aex moeiltlsDul(msn()aeermo io1omDrlu o;t0s2uo(r3io4oltemivtl() rur(monu0alx iieiatfa eauvp;u)trxnxr oa1lmteaies ()teum(o3nu4ll  mieia(  rra( pou0teen o3tltlm2rl(mpn(0aexnxr3todlatr u ils)tetr(opiudamt lneta(fsrtru  nt4tptnmi3ils s2ra(vsnu4 rtrif3iatomteau o (0 rtr(opio1oltn fvsat a2tm(r nu4aptn i3ildls2um( sn(0texrif3oa1lp rlnes (  2xmir iydlpt licsa()srtrxmpno0tpxnmoeiatfa2umnvp;t0aexrircta1lpt anvsls t2uoxmpiudlpte ieias sDtm(mpoo0oet ioctytlmDulnmp;t0aetnmo oo1lpD li s ()s2urxrpio1lpenliesa(  rrmum nt0oetnifciadfa2el(vp;t)tlxoir tatlaDeluvi ()sruoio iydaltnmnesl(  Drr(rp;u4olxniictydls2rl( s;t4trxnxr oa1fpDelneilt)seur(r oy4amt lncs ( aDum(r ;t4optn i3ilt a2eanmp;u)arerir oa1oaD  n il(0t2tr(r iu1llte net sf 2rm(m ou4alto oeils s2rlnvp;()altnmfctatlatean sl() 2umxopiodom nlneiatf Dtr(mpnt0tpenifetasfm2emnmo;t4tetrif3io1lpD  i sl()seum(o iy1lmtemfetatf Dua(m ;t4aex mfetas m2umu on()aexrif3iydopDeluvs t) exrio3oy1apt mivslsf Drmum nt4ape  oeiyt mDumumo (4treoxo to1fa rau i;s)srurimpiudal nmiei (faDuau pou0ale iietys m um(mo (0 etnmr3iatlat aivo;s0t2xmio oudop e ivtas  2tr( pno4tet moctytla ua( pnu0trxomoctotfp  lnvs;()trtmxrpnudlmenmnvsa(fa2umx pno4alxnmi3ilsfaDrmn onu0 eermrctotfmtr iei;s)seumxr no4oltemfviatf 2uru pou4oeen octys m ua(vs (0 exrmfcoydopt lnes;s) 2tmxrpnu4op emiesl()a2um(monu4apenmociyd sDeauvo;u4artnio totfpDe i s ()teum(mpiy4apt lnesas) 2uax p;o4tltomi3iydls2eanmonu0 lxoir3iodomDrai sls) 2um(r3no4al n ivi tfa2rm( poo0ape mo3ias m2rl(mp;t0texnmo3iadfa elu s (0sexm(m3oy4altelfvsas s2uaxrpou1aleomoeiad sDul(vo t0tltnxr3oadomt  ieils0 exoxr iy1lltnlnesls)s2uax oou4alxnifeiltfmDelu pn() eerxrcio1fmDe neolt  etmio nydamtelnvtat)aDrrx  ;u4ope  oeiydfsDran s u4 lxrif3tytla rluvo;() etrxr iudalte ictat a2ur( pno1tlx miciat m um( ont4arxoxr3ty1omt au olt0srxoxopiy1apt lnvtlt artrum nt1tpx iietldfm2ea(mo t0arxomf oatfatr ues;()trxo(o iu1om  lfci t sDumur ;u1alxomf3tatls eaums;()altoxr3ootopD  ivo t0trurxr nudlle mnvs t  Dtaumpot4tlenmo3ildls rl( o;()arxnxoctotom r u s t0sruoirpny4apenlfci t)a2rrxronu1oex moetlslsDulu sn(0 rxriocoydomDraiei;s srtoiopnudlpe  ictas arrmx  nu4tpxnif3iysls2rmnmo t4 lxrif io1fmt  ieil()srtmxm io4ol e ivt s)sDta( pnu1aex io3iydls2uln sn(0teeoirciotlat livs s)trxmiopio1ol nmiviasf rtmxro;o1opx  octlt s2ra( s (4tltoxrciodfptelu i;t  rtoxr3iy1lltn ivtls artrumpoo0tlto f3iydls2ra(vp;t4 lxrio3iydfptrlivo;(0 2xr(opoy4lleemiet t sDtmxmont4tlxn ieilt aDrmnms u) exoxrcoydlmt  uvi;s srtoim3nydaptemicsls)arta(  nt0opt iictldfm rmnvs ()tlxoxfcoatomteauvo s) euriopnudoptnlfvils s2rau pnt1alt  ociatlm2um( snt0tltnxfctytoatelues t  2trxmpny4lltnmivils  2ra(rpno0aptoioetas s elu p (4tetniocoydlmtran il() rto(m oo4apeemnvilt)artmumono1olx  icias a rlu onu4 lenmf iotlmDeau s s0seurir iu1opte fvi sf rtaxmont0aee io3tltfa eln s (4texnir to1fa e uvols0 exoxmpiu4olt  fvtl()s2um(rpot0teenmo3iasfm eanvp (0 etomrctodlat luvs s) 2trio3nu4lp e feil( arrrx oou0tpx ii3iydls rmn ont4aleoxr3totfatraueol(0t2xmir3iu1ale mfciat)srrm(m nt0aeeniieilt a raumon() eerxf3iatfp eln o;() 2urxo3oy4ll  mneil(faDraumo;o4alxomf3ild a ua(mon()alenxfciydopDe uei t)sexm(r3nodalt  ivtltfarumxmpot1tpxnmfetatla ran s u)trxoif totoa  lieil(0t2trim oydlp nlieia(f 2tmx o;o1oexomfctlsls emumpn(4aexniociadfpDr nvo t seuo(opiy1lle lfcs s) 2rr(r nt1tpen i3iadfs em( onu0altrmrcoo1lm rau olt  exm(o iu1op  lfctlt)aDtmxmo;o0tpx ii3iyd s2rluvp u4trenif3tytla r i o s)srurio iydop nlivi (fa2tm(mpoo0teeo f3iatfs ul(vp u0 ltomo3iytfatrau s t0seumim3io4ol  mivs s artm(mooo0opx  icilsfm2rl(vpn(0treomf oo1lmDran s t0s2uo(rpoydlme  fvs s)artr( pno0ole mfciys s2ulnvs;u0 lerif ta1opt lnvol()truoio iu1llte ivs (faDumxmp;o4optomf3tas sDrl(mpnu0 rtrxf3iadlmDeaieol( srxoim io1ol  mnviat aDua(r ou4oexnmf3tas s rmump t) leoxr oo1la   ueols)teuoxmpoudamenmnvilt) Dtaurono4ole ifciytlmDeanvo;t)trxrmr3tadlp elneilt)srurxrpnodlle micils  rraxmoot4oeeoiiciatlaDemuvsnt)arxnxrcty1fat  n o;t) eum(r3iy4omtnmfci s  Dta(rpnt1oexomf3iatfa ea( on(0trtrmf ootfptrluvi;s teur(o3no1apen fci (  2umu  nt0teeoiieias aDea(vs t0 lxoir iy1faDe ieo;s) rtoxm3iy1al nmnct (fa2rr(rpnu0ole mieiatfm uauvo;t0tlxnifcoatoaDraneolt0srtrxopny1lmenlnet (  rrmx oot1texo fctatfs2um(mp;u)alxnxrcoydfmtr u s s s2xmio3oo1lpt miesat srrmu p;t0olxomo3iatla uan p;(0 leomo ta1fpt aies s s2xm(m nodom emivt ( sDraxrpnt4oet moeiad sDra(vo;() rxoxr iotoatelu slt) rtriopny4aptemncilsf rtaxmoou0opeoifeildfs2rmnvs t)teeomf3iadomDe nesl(0srxriopoo4am n nesat sDrmu pou0tltn oeilt m eanmp;u0texnmrcootla r uei (0s2trim3nu4ll emietas)s2rmu  nu0aet mf3iyslm ua( p;u0altnxfciytfm  livs;(0s2trxr oodlpt lnvtatf 2rr(  ;u1ope ii3tad m rlnvs u4altrmo ty1oatranei s0 2tmxo nudapenmfeilsf rrrxro;t0optomf3iatls em(mo t0alenmf to1oaD lu o;t) 2toio nu4lme  nctas)sDtm(rpot0tpt mo3tltfa2elnmp;t0aexrxo3ia1fa elu i t)s2tm(m3nu4ol elncslsfsDrm(ront4tpx mietld s rm( s u0alenmr3iytfa elnvo s)trtrxrpiu1llen fcta(fsDur(roou4aptoifeiaslaDrm(vo ()tlxoxo3oodfa rlivi;t)tetoxrpiy1oltelies s)a2tau  ou0opxomf3tlsls emu o u) lenxo3tydoaDr ieil()srumirpio4lpt mfcsa(  2uau  ;o4tltn f3iatfm2el(mpnu4aeeoirctadoaDran s;() 2trio iu4optn fvtlt  2uau  nt1tlt iietas mDrl(vp;t0 ltniocoodla elivo s trtoio3nu1lp nmnvt sf rtrxrp;u1texnmfeilt m2ua( ont4trtoxr3ty1fa  lnei;s tetriopio1lm nmiei (fsDur(mono4olen ietat a2rmn on()altnirctotlmtraivolt)s2xmim3nodlme licsatfsrur(rpnt4opeomi3tyd a2em(mont4 lxnir3todom  anvs;()texrio ny4amtelietat  2raxr ou4tlxnmi3tldlm ranvsn(4trxnif iodlmD  u sl( teum(r3iu1lpt  nvsls aDur(rpnu4apen oeiytfm ul(monu0treomf3totlpt lues;t0t2urim3iu4al emfeiatf Duauront0alenif3iaslmDemnms;()trtoio iatla e i o t0t2xo(rpiodamenmietasf 2rmumoou0aeeoiictys sDelu o;u0 rxrxfcootoaDeau sl( setmxopny4lmtnlivta(  2rmu pou4apxniictldls ra(vsnu0alxrmf3oy1fptelnvils0tetrio oy1lm  mncs t)aDta(ro;o4teeoio3iadfs2emu s (4tlxrxfcootfmDr u s;t sexm(r ny1openlnvi ( sDtaumoou0oleoio3tydfs2rl(ms;t0 lxnmrctotoa  anvs ( srxr(mpiy1aptn fctat) ruaump;u4alto o3iadla2emumpn(4 lxrmf3tydlaDrlueo s  2tmxmpiy1lpeemiesl( sDtaur ot4aex  ocils m2rmuvs;u0alerif iytlmDrauvs;s0t2urir ny4lpe miesa(fa2rau p;u1aetnifeiytfaDraums u0 rerxfctatfaDrlivo s seuo(r3iy1al n fcsatfaruau onu0optnmf3iatfmDra( o;u)trxoxocoodopt  n i;( s2umxo iudopen iviatfarrr(mont0olt  ieilsfa rlumo t4aleomo iatfatean ols) 2uriopiodll elnci sf rtax  ;t1ole  ictysfaDeanvp u) rxoxr tatlatr i s t setrxrpio1apeelnvsa(  2ra(  ;u0alxo f3iaslaDea( pn()tltrxo3io1lmtranvs s srto(r io4apenlncsa() rumu pot4tlt  o3tlt m rlums;u4aeenio3todoptelu i t0srxrir3ou1lm nlnvsas a2umuront1alt  ieilsls2rln pnt) ltrxrciytlpt aieo t0 2toxr3oo1ap nmieiltf rur(mooo4aetoii3tydla ranmpnt0altrxo to1om raivo;s0s2tm(m iy1am nlicils) Drmxm oo4aet ifeiatlmDem(mpn(0 exnmrcoy1fptelivils)sexmxm no1amte fesatfsDtax ooo1apx  ociatfs2rl(vp t4artoxo3oadfpt lu ils) rtrio3io1lm e ivt s a2tau pou0aex  icild sDra(vp (0 etnir oo1fpt auvi (0 etmxo3oo4ale  fct (f rtmx  ;o0altomoeilsfsDul( s;u0trxoxocto1fmDrlnvs s0 2xrirpio1lme lfvt tf rraumo;t1alenmieilsfaDeluvp;u4alxrxo iatop eaieil(0 rurir nudomt mnvtat)a2rrxrpot0oeeniociasfs rlu pn(0trxoxoctodom eau s s0s2urxmpio1ame lfct (  2raumpnu0olto oeiydfm ranvo () rxoifcootlm  luvols0trxrxm iy1lle mivt t)aDtrxro;o4opt if3tatfm rl(vsn(4tlenxocootoa e neo t t2xoim3oudopt lfctas  rtrum no1aexn o3iyt s2rauvpnt)aetrmr3tatfmDe uesl(0 2tm(mpou1lm  mivtas)s2raurpou0olenioeiatla ul( s u0aexrxo3tatlmtrli i;t0 euoimpno1ll emnvsls)aDta(mo;t0tpxo ictytfm2ran ont)arxrxfcta1omD  i ols t2urio3iudomt mncias)aDtru  ;t1tlto i3iatfs um( p;t)aeenmr3oatlmDrlieil( t2xo(m io4lm eliet (  Drmumoot1oetn i3tad a rl( ont4 lxrir3tydlpDeanvi s)sexm(m3oodole lfcsa(  2tm(m ;o1apenio3ildla2rauvp t4texnir3oydfptelu o;t0setoio3no4apt lfvil( srurump;u1tpt ifciltlm2rluvs;u)areoir3iatlp eluvs;(0srurxo ou1openmnetasf ruau oou0tlt io3iltla rauvont)teenir3iy1lmt auei () 2tr(mpou1om elneil()aDuaxmpot0tpto oetlt m rauvonu0tlenif3iydfpD liei;s0t2umxm3io1ame lncs ( arum(rpoo4tpt iictldlsDua(vs;(0 rxnmo3oatom   ivs;t0 eto(rpno4ome  fvils s2trxmpot4opxniieiat mDua(vpnt0aeeoxr3to1fpDeaiei;s) ruoxr iydal elicsltfaDumu pnu1oeeomfctls aDrmnvsnu0 renxfciatomtrau il( trtmxr oy1ope lfesls)sDum(r ;u0olt iociyt m rau sn() rtoif ty1fa r uvol(0 eto(opiodopenlfvsl()aDumxm ou1oeenmf3iasla umn p;t0 etnxo tytopDrlnvo s0srxmio3oo1aptn ies t  rrauroot1opxomocilsla ulnmp (4trtnxo3iadlmDelneo;s s2xmimpnudlm e ivsa( arrmumono0oleomf3iatfa rlu pn(0texomocia1fa rli il()trtrxrpiu1olte ieia()srumur nt0tpto fciatfaDrmumo (0aetoif tadlate ivo;(  2um(r3oo4lm e icil(  rtmu  no4teto ociysfa umums;t0 leomociydlp  lu o s) eurirpiu1olenmictl( artr( pou0aexomoeiatfa2umumsnt)tlxoxocoy1opDrluvilt  2tm(r3oo4apenmnvil(f 2tmx o;t0openmfciatla2ua(vsnt0texrxrciotfp eaivo;s  etr(r iu4om n nei t)sDtmxmo;t4tptoiieiys s2emnmp;()tlenxo3oydlmDelnes;()trtmir3oy4ame lfvi sfarrm(r no1oetn i3tlsfsDumu pnt0teeoif iodfm r ivs (  etoir ou1lm   fct s)srrru poo1tpxo oetldla rau p;u4treomr totlpteau s;s t2xrio3ny4apenlnci t  rtmuroot4tlt ifeildlm2eanms u)tlxnmocty1lp rliesls  ruoxr3iu4op nlneiasf rrmxm nu4tlen fctldlsDeau o u0alerxrcoa1lpDr nvi t trtoimpnudop n ietlt srra( onu0ole moetad s em(msn(0alenir3iadlm eanvo;t t2umxr3io1ape lnvi s) Drrx  ;o0apx iicilsfa2ra(vpnt0 ltniociy1oaD  nes t) rxrxm3no1optemictat) rtmx  ou0tex ifctlsla eau p (4aexnmrcoydoaD  uvslt tetriopnu1lmeelncils arrr( o;o1tet  iciys aDraumpn(0aexoir io1laDrau s;() rxm(r io4olt  ieiatf 2tau  nt1tpxomoeilsfaDraump;t)aexrxf tadlmDrlivolt0sexrirpny4olen ieil( srrm(m nu4tltniocildfmDumu p;u4tlxnxociadomt aieils0 etm(m nudlpe  fcs () rrmu pou1altnmfctltfs rl( s;u0tetnmfcoodfp eaueo;( s2to(o3nydoltn ivtlsf Dtm( p;o4aleomfeilslmDrl(vpnt)trtoir ta1fa  lies s)s2uoxr iydlmenmiesatfs2urxm ;o4olx  i3iydfa2emums u4trxoxf3totfpt aieo;(0 2xmir3nydllee fct (fsDtaumonu1opxn ociad m2rau s;u4aexomr io1om   ueil(0 etr(r iu1ll nmfetl() 2tax  ;t0oexomociasfaDra(ms u0 rxrmf3io1faDran slt0t2xrxr oy4omtnlict tfa2taxm ou1opxnmfetyt a2eln o t)trenmr3totfp  aivs;t) exoirpoo4lm   feta( sDurur no1apen fcilsfm em(vsn(0 eenmf iytomDeln o t texmxo3iy4ap n fvtl()artaumont4aet mociad s2ulu s ()trxnxr3totfaDr n i t)trxm(opiydame lfct () 2umurono4oexomoetyt mDuan o;(0altomo tytfa  luvils0s2urxo ny1amtn fvta( s2uaur ;t0tlxn ietlt sDrm( o u0trtnxr io1la raivols0 2urim nu1omeelneilsfsDrru  nu1aleoiietltfaDra(mo;(0tetoxo ta1optrlnvi;t)srxo(m iodame  netlt) Drmx  no1oexn ocildlaDem( s;(0 rxnxo oydfp rln i;(0s2umir nydom nlicsas)artrxr ;o4oetoifeiysfs2em(vs;t0texnmfcoatlpD  ivi s  rtmxr ny4om  lietls) rumx  ou1tlen icildlsDumump ()trenxrctotlat  ues (0 rxrim nodomenlfvs sfsDrruro;o4altnifciys aDrln s t4 reoirciytoatrai ilt0 2xrir3nydoleeliviat)a2rrurpno4tee  oeilt aDeln p u)tlxrmr3oadopDeau slt0teuo(o3ou4ll emnesltfsDtr( pou1oexomiciyt sDrmuvs t)tetnioctydlmtrlues (0s2xo(opno4lme lnetltfarur(  ;o0oleomfciasfa um( pnt0tetrif to1fatean slt)srtoirpoo4apt lfvt t)a2rrxmp;t4tpenmi3iysfs ea( o t4 lermfcty1oat  u ilt0 euoir oodlmenmfet t)srtmur nt0tpx mfciat m2ua( o;u4 rxniociy1lmteaneol(0s2uoir3nydll elncils aDrm( oou0tpxnmf3tysfmDemnms ()tlenxrcoo1fm eauvolt0s2urxo nu4optemivsat a2rmu o;t4tpto ietldla2rlnmp (0tetomr tadfmDe nvo;s trxmxo ou1omtelivt tf rrrur nu0tetoioctydlaDea(ms;t)arxnif3oatoptr i o s)srtmiopou4lptnlnesas)aDtm(  oo4apx mf3iys a ean on(0tlermfcty1lmtrlnes;t  ruoxr io4aptemies tfsrumxrpou0oee mf3tlt m2um( snu4tlerif totfm e n sl(0sruoim nodal n ici (  2rrx  ot1tltnioctydlmDuau pn(4tlxnxfciy1lmtraiei;t)trtoxr iy4lle lfvs s)s2tm(r ;u0oleomi3tatlaDelnms;u0texrmf3ta1lat  n i ( trumxr3iudlp nlfcil()aDua(mpnt0olt mfciytla ul(mpn(4 lerio3ta1op elu ol(0trtmxo oy4lm   ictas sDumxrpnu0tlen i3tldfaDrmnmont)tetnif to1fa e u i s teuoiopnu1olte ietls s2rau ono1tet iietaslm um(mont0teenif3todla  lues;( setm(r3iudalt mics s a2rm(mpot4apxoioeildfsDrmump u)alxrio oo1fmD  ivo;()trxrxopio4ol nmici () Dtaum oo1olx moetatls2ua(vp u0treoxr oy1fpDe n o s0 rtmim3nu4llt  icsa()artr(m ou4oetnmfciatls2elnmo t4teenxr3iadla  lu s s)s2tmxrpou1llte netas) Dumxm ;o1oexoiociat aDrluvpnt)teenmf3ty1oa   nvolt  rurxrpnydlpe lictatfarta(r ot4oetoioeiasfs eanms t4tlxrmrcoa1lat an s;( srtmxr3iy1omeemfci ( sDtm(r ;u1tee moetlsfa2rmnmpnu0artoif3ootfatrlues (  exm(m3io4olenmfvt (  rrrump;u1tetnii3tldlm2uluvs (4trtomf ootop elies ()trtmiopoudlm  lfvta(fsrumx pou0alt  feiydlm2rlu onu4arxnxo3oydfmD livi s0teumirpou1ll  mfei s srumum ;t1tetoiieiasfm2emnvo;t4tleomocoatoat  uvo;s seurxo iu1ole  net s) rurxm nu1apx if3tysfsDeluvsnt0teenmf3oydlaD lueols)srurimpoudom e neiasfa2taum nt0tpxoii3tadla um(vo;(4aeermo ty1omDelivi ()sexoio io1amen ncs ()sDumurp;t4altoioctlsfmDrm(vpnu4arxoir oatlm raueo s srxrio3no4alee ict s) 2rr( ont4alt iietasla eaumo;()artoxf3oo1fpDe ivo;()texo(m3ny1ope  ieil( sDtrxmoou0aeen i3iys s um( o t0 ltnio ty1lmDeauei () rumir3no1altelfvs tf rurum ot4oleoio3tls aDrln snu4arenio3tydlp e u i t) 2toxm3nodopeemfvi tfaDur(m nu4opx  iciad a uanmpnu4aleoxo3oodom raivo s seur(opiu1op emnvi s s2rr( pot4oltnif3tydfs rmu o;(4 etomf3oadop rln o;( texmxo oy4lltnmfvs (fsDtr(mpot0oex ioetldls2ul( o;(0 rtrmr todfpteaivo;s) etmio ny1am   fct () rtmu ooo1oeeo iciasls2emuvont)aeeniociatfaD  i s;s) rurxo3nudopen fci () 2tax  ot1tlxnmfciasfm eanmo (0aeeoxr oa1faDelu i (0t2tm(r ou4apte ici s)aDtr( pno0oexoioeiasfs uluvo u0teermfcia1omD  uvi s setr(o iodol emnesas)sDumxmpnt0aexn ociatfaDrauvs (0trxomf oytlp  lnei;t  2uo(m iudop emfcsl() rtrur nu4aleoiociysls umnvo u)areoxo3iytlpDeauvi;s trurxo iy1apee fei t)s2taump;u4ale mieiaslmDel(ms t)areoifcoytlmD lieo ()s2xm(o3ou4omt lnviat sDtaxr ou0tlen oeiys a eluvp u)texoioctatlmt lnvi;t srurxr ou1lm  mfvt t  2trur ot4tlxoif3tlsfs emnvonu4 lxoio3tadomtraues s truoxopoudap emnct () Drru p;t1aptnmictadfm2umu o;u4texnio3ia1lmte nvi;(0 rxm(rpny1al elicslsf Dtmx  ot1aeenmociyt a rmumo ()artoio iadlm eaies;(0teumxrpoo1amen ietls s2umurooo0apto f3tad m2ra( s t4 rxrmoctytlptr uvo;()t2xoxmpnudlptnmivsa() rra(mpoo0texnmociatfm2ra( o;t)tlxrmf3ta1fptr uvo;( s2xrio3no4llt  nvils  Dra(mp;t0oex mi3iatfm2ean p;t) rtomo iadfaDe ieolt sruoimpoydaltelfvilt arrr(mp;t0texn octlsfs2ea(vsn()treomocty1fmDrai s s  2xmiopno4lpt  ietas)s2ta(root1oltn fetasla ra(msn(4tlxnmo oytlptraueslt0 2umio3ou1ap n fvs s sruaxrono4aetniietlslaDulnvp;u4 eerirciotfaDeln o;( setriopnudom e feia(fsrrru o;o4tlx  ictlsla ulu pn(0 exnirciy1op rau sls)s2trxr3iy1op   fvia( a2rau pnu1opxnmoetas s2rl( on(0texrmocty1lat  uei;t seuoxr3io4open nvs t)artm(rpnt1ole mfctatfaDem( ont4 lerir iydlp eaies;s0tetrir nudll emicta()s2tm(m nu4olt  i3tydfm2um(vs;u4 reoxrcoo1optrli ils trxrxr3oo4ol e iesl(  rtmx o;t1tetomf3ildlsDem( on()aetnmr tydlatr u i;s)t2xrir3oo1ameemfei tf 2rmurpoo0opto ictat a2elnvonu0 ltoifciydfpteln olt0 exrxr3nu1opeelivsl(  Drrx ooo1tlenmiciadlm ulnvo ()teenmr ia1latelu i (  rxo(rpnodolen ici tfaDur(  ;u4opt mf3tyd mDrlu pn(0trenirctadfp raivols t2toim3ny4optnmicsasf rra(  ;t4apeo o3ils sDuaumsnu) etrmr oydom rlueo s) eurxmpou4amtemivs tf 2taxronu1apxnioeiydfs2em( o u)trtnxf ootlp  auvs;s0teurir3oo1lmenmictltfsrrau o;o0tetn octlsfm2rmumo (0 rtrxo tytfa raueo;s) 2xr(m nu1ale  ivi s artmxr ;t0tle  ictadfs2uauvs;(0tetrxr iydop raneo s trxrir io4al nmnvt t  2trur nu0tlx  oeiydfsDeanvo;u4teenxr3ty1fpt  ivs;t) exrxo iu1ol   ies ()sDtmx  ou1tlt iietytfm ranms;(4tleoif tatomDr ueolt0 etrxmpoy4lm nlicsls)srtrumont0texnmf3iatfs ul(mp u4 rtomf tadfmD  i ilt0t2trxo3oo1lmt mncsls) Dumumoot0aeenmictltfmDul( p;(4 ltnmr3oatfp r ieslt) exmxm3oo4oltn ncsat a2rmum oo4tpe mfeiltfs eaumonu4 etomfciatlmteaieo t)truoio oydomt  nct t s2raur ot1aleomi3ias sDulnvs u0 etnmf3oydlmDeauvo;s  etmim iudll  mncta()aruax  ;u0tpe  oeiltlm em( o;u0 eeomf3io1lptrai s;s)t2urio3iodlp   nvs t) 2tmxrpou0texniicildlm2umn p ()alxrio3tydla rauei t0setr(r no1am  lfvi (faDur(rpno4oeenmiciltlaDelu s u0tlenifciytomtr i o ()s2toiopny4ale livi tfsDtru ono0tpt ifciyd s ua(vonu4 rtnmr3todop eaivsls trxo(o3no1amtnlici t) Dtr( ont1tpenmfeiydfmDrlu s;(4aetrxocoo1laDe uei t)s2ur(m3no4alee ivtl()a2rau pnu4opxnioetyt s rmumsnu)alenmocoatfptrauvolt)seum(opiudamte fvi s srum(r ;o0aetnmfetlslsDul(mo t4alenxoctotlmDeanes s  rumiopio4llenlfeiatfsDumxmpno1tlen i3tldla ulu o (4trxoxociotopt anvi;t0trtr(r3ny1lle  neta(faDta(monu1apt moctatfaDulnvpnt)aeeoxfciydla eaneslt s2umxm ou4lpe lfciasfsDtax  nt0aet  fciadfm2emnmp;u0tltoxr3iydfmDraueo s t2xr(r3ou4lm n icsls) Dtmumoou1tex iietytfs2emuvo t4 lxrif3io1lmtrluvo;s0 eur(r nodll emfctlsfaDum(mpot0optomoeiysfsDul(vpnt4aeermf oydopte u o;t0s2toxm iu1al e nctlt)s2truroot1alx ioetat a um( pn(0 eenir3totom r n i t0srtm(rpio4omenmiviat) 2taurpno0tpxo ietyt m2elnmp u4aetnmfcio1fpDeliei ()srtmio oodamt mict t s2trx  ;u0tpeomf3iyt s rm( p;t4tlxnmocoadfmteai i (0 rtoxm iy4opeemnctl(f rrru ooo0tle ii3tad m2ul( s;u4altnxfciydom r neilt)truo(r iu1apt mnvsa()aDta(m nt0tee mi3iatfaDeanmpnu0arenmfcto1laDeanvs;s)teur(rpiu4ap nmnet tfa2ur( pou4oltnifeiydfm2uluvon()aexoif3iotopDrlieol(  rto(rpou1op  mnci sfsrtauroou0olx iictlsls eln snt0alerxo oydlatr iesls0setrimpoo1aptelnctls a2rrumo;o1opeoioeild mDranmp;(0 rtnircta1lmDrlueslt0 2trxmpny4oleemneil(f Dua(m nu4oet mi3iatfaDean s;t)trenxociytlp rauvs t s2uoxr3oodlm elicsa( artru p;o4aetoifeiys aDrlnvonu4 rxnxocoodop   n slt0seur(o3iy4lmtn nvsas  rrr( ooo0aeeoio3tld m ea(vont0 renir3oo1oa e u sl( tetm(o3oo1oleelnet t) rtaxr oo0oee mfeiysfmDuln pn(0 rxnif to1lmDelu o;( trurxm3iy4om nlies sfarrrxr no1opx iieiyt a rm( on(4 etrif3tydom  lies;s0 eto(r3no1om  lneta( a2tmu  oo0oex io3iys m um(ms;t0teenio3to1fmD  uvi t)srxm(r iy1opeelivtl(fsDua( pnt4aleomfctys m2uln o;u)tltrmf3to1lmDean ol(  exo(m ou4lltelivi () 2umuront0aleomfctld a um( o u0tltomfcoydla rauei t texrir nydal elnes t  rtaxrp;t0tlto i3ilslmDranms;u0tltniocoytoatelivs ( seumimpnu1lme  ivslsf Dtrur ;t4apxnif3ilt sDulnvo;() rerio oytomDe neo s seuoxo3ou1omeemiesltfsrtrxr nt4oleomoctatlmDemuvpn() eeomo ty1omD  n sls  eurir oydaptn net t arta(mpoo4opeoifciasfm2um( p;()aleriociy1optr ivo s) exm(m3nydole  iei ( s2tau oot1apxo o3tls m2umnmp t0aleoifctytfp elueo ()srumim3nydamtnmictlsfa2rax  ;o4opxn ieiadls2umnvs u4 rxrxf tatlpDrlnvs t s2xr(opno1ale mfcta() 2ur(  ot4tle iociytfm um(ms;u4 rxoxfciatfptrlneil( srxoimpno1om nlfeia() rrrumpot4aeeo o3iadfa2rlnms;t0 etnxocoa1fmt  iei ( s2uoim oy1omtnmict ()arur(m ou0oetnmf3iatla2ranvonu)aetoxrctodom rlueils trxoxo3oy4omee ict tfsrtm(r ot1oltn ociatfm2ra(vo;u0tetomfciodomD li ol(0 rxmio iodalee icil(fsDta(mpnu0aex if3tldlaDrmn p (0alxrmoctadlpt  n s (0t2xrir oy1lp  lnvsas arrmurono4ale iiciytls2rm( pn()teermocoadlmDeauvo;(0sexm(m no4apt lnvilt) 2umu  oo1tpxn oeiydlm rl(msnt0 rerxr oatla   i i (0 2trxmpoo1lmtnlfetlsfsrurxr ;u0aetniieias m rm(vont4trxnxo3oytopDranvo t trtoimpny1lp n fvsas arra( p;u0oetniieiad m uanms u) lenxr3iotfmD lnei (  euoxmpoo4aleemicilt srtr(r ou0tpen o3iadla2ea( p;t4aeenxo todfmDr ieils  etoir nu1opt mfctlt)aDra(r oo0aptniieiaslmDua( s;u4trtoircta1fatran o;t) rxrir no4omeemfes ()arrr( p;t0tpxn oeiadla eln o t)trxnxf todlm e neo;s0tetmxm nudamt lfci t)s2ra(  ;u4aexnif3iytla2ulu p;(0arxnif3oodla   i ols0 euoxr3iu4amtn neta(f Drr(rpoo0tpxomfetysla rmnvont)aetoxfcoadlmDelivi;()tetr(o3iu4ameelnvsa( aDrmurp;o1opeo oeiysls2rluvsn(0trtnmf ta1fa r u olt0 2urxmpnu4lp   feiat a2ta(m nt1aeenmfeilsfm rl(ms;u0tlxrmfciytlp eaiei;t0srxm(m nu1om   fes s) Dtau pnu4opxomf3ilt a rluvpnt)trtnmrciytopDraneo;(0 2xr(rpnydam emfvsl(  rtmx o;t4tpt mfciadfa2el(vs u4aetrif3iotopD liesl(0texrxo3ny4lpenlnetat)srta( p;t1oltoiociasfaDrlums ()tetrxo iatlpDrai o;s)trumirpno1ll  lfetlsfa2um(moot4opxoifciatfm2elnmsnt0arxoio to1opt  neolt s2xm(r3iu1ll n nctatf rtrumpou4ole mfciadls emu o;()alxnio3tadfpt  iei (0trur(m3oo4am  lfeilsfs2ua(r ;u4alx mociatls ran p;t0trtomo iotlpD aivo (0tetrirpno1openmnct t)s2tmx ono4optniieildfsDeauvp;(0arxomf oodlmtrau i t)trxmiopiydllenmfei () 2trx pou1apx moctytfsDelums;t4 etnio ta1optr uvs t  2tm(opny1llt lfcils srum(r oo4oetoif3ils a2el( pnu)aleoxf oadlaDeaneo;t)srurxr3oydalen nviat)artm(rpnt1aex ifeildlm2em(vpnt) exnmocoatlp raueilt)trxrxmpio4oltnlneta(farrax p;t0tleomictadfs rlump (0 rermrctytlaD liei;s s2xr(m3oydame lncs tfs2rmu p;o1optn ociyt mDelnmon(4texrmrcto1oatraueols) 2tr(mpio4lmt lfctlsfsrumxmpnu1aexo fetyt mDum( s (0alxomo tydfmt aieils0seumimpno4ame lnesl()aDraum ;t1ale mf3iad aDrm(mp ()aexoif tytomteai s;s0seur(m3ou4omenmfctlt) rrr(  no4tlxn ieils m2uau pnu)texnir3tytoa rli i s)seum(m3nodal  lfeil()s2um(  ou1apt mi3iatls elump t4 lerxf3tadlmtraieo t s2trxrpoy4lpe micilt  2rrx oou1oeenmieias mDel(msn(4alxomoctytlaDe ueils0setm(o oy4op  mnctl() rtmuro;t0oex  ictltfm2emnms;()alxoxf3oy1lm  ln o;s seuo(o3iydlm e fvsa(  rtmum ;u1olen o3tltfm2umu s (4artoxf3tadlatrliei ( seurim oy1lpe mfvi s  2rm(rpoo4aee  ictltfmDum( o;() rxomo3oy1fmtean il(0srurxm nu1lltnlncsa(fa2uau oot1tetomo3iatlm2umnmpn()tlerxr3to1oa r nvils  rxm(opnudll emneia()s2tmxr ou0oee mo3iyt aDumnmp (0aexrxf tytfp rlieo t0srurxm3oodll   ies (f rta(monu4apxnmi3iysfs2ul(vs;t)aeermr3iotla eluvilt)texoxm ou1ape lfcs tfsrumum ou1texomfeiyt a2umumo;t) lxnmf3iadom raivo (0srxo(m iu4lptelncslt) rtmxm ou4tetn o3iaslmDeanvo;t4tlenifcoadlpteauvols t2uoxr3iy4olt lnvtasfs2tax ont1aptoii3tls sDea(vo ()texrmo io1opt aivsls teurim ny1lm nmictl(  2tmxm ou0ole ifcildlm2ra( o t0trxnmfctotfmDe i slt0sexriopio1ope lnvtltfa2uaumont1oetoio3tlsfm2ra(vo;u4trxrio3oodlpt lies t)texrxrpnu4omt  nei ()sDuaum ;t0tpx moetyt m2el( p;(0 exnmf iodomteaiei;()sruoxrpiu1lmenmiesa( a2umx pnt4tlt mfeilsfmDranmo (4aetrmr iytop rai o s0teuo(r3oo4al n nvtls  rtmuroou1apenmieiytfaDumu pnu) ltnio3tatlmt  i sls  2tmxmpio4ll e feias arta(m oo4aleo i3ildfm2rmnvo;t0arxoxr3iadoaD lnvo (0t2urim oudol elfctl(faDrmu pot0olto ietldfa rmumo (4arxomfcootlptraies t  exrxr nu1altnlfes (fsrraumpnt1olxn i3iyd m uanvo u4 rtomr iotop raueslt  2uo(m iy4lm e nvtatfs2ur(rp;o0alxn i3iltlmDemnvp;u)tlenxf3io1laD au ils  etoio3no1llt  neil(f Dum(rp;o1tptniieiat mDua( o;t0 eeoircootfptr nvil(0s2umir3no4ll   ncilt  rum(  nu0altoifciytlm2rl(mo u)tlxoircoydoaD  i o ()srxoir oodlmtn neia(fsDrax pnu4tpe mfciatfs uau pnu)trenxfciytfpD aneolt0t2xoxm oo4op nlicsasf 2tax  oo0tltn ieias a2ea(ms (4 ltnxr3oodlateau o;s)trxoio nodlpenmncsls)aDum(r no0teeomf3iltlm uaumpnu4tltnxr io1fpD livo (0 rtr(o oo1optnmnesltfarumxmpoo1altn feiytla rm(vonu4 lxomf iy1lpDrlieo;s) etoio io4llen iei t  2um(mo;u4tpenifciad sDul(vo ()trenif3oatom eanesls)s2tm(o3iodlmeelnvils  rtax pou0aetn i3ildlaDeau onu) rtoxfcoytom rauvs;t)sexo(rpiudlpteliei tf rtm(  oo4oleo o3iltfmDrm(mon(0aexnmf3ootopDelivi t) rur(m no1lp   fvsatf Dua(r ;t1texomieiadfm2rmnmpnt)aetomo3oadla   u i;t) 2urxo io1amenmicsas)aruaumpou4tpenmfeiytfa rlnmonu4 lxrio oydfpteli il(0 etrio3oydll elfvilt)arrm(mpnt0apxn iciatla2el(vp;t0aeenxf oatlmDelneol(0texrir3oydap nmfcils  ruru  ;u4tex  f3tldls2umu o;u0alenmo3iatfateluvolt  rxrxmpno1lmtnmfesasfa2um(  ;t0aeeoiiciydlsDelnvp;(4 ltriocoy1fmDe iei;s)sexmxr nydoptelnciat)srtaxmo;u0tpe ifciatfa2elu o;()treomocta1lptrlivslt tetrxo3nu4lmtemies t aDra(mpot0tltnmoeilsfmDulump t)tlxrio3iatlat luesls)t2urxr3oo1am  lfcia()aDtru  ;t1olenmfctydfs2rmn p t4altrmrciotfate neo (  2urxr oydlmee icslt)aDum(mono1openiicild aDra(vonu4 ltoxf tydopDe ivs;(  2xmxo iy4openmict () 2tm( onu4tpx mo3ild m2el(vs;t0 etoxocoydomDrauesl(0 etmir3iodll  lfct ( srua( p;t0alen o3iys mDeau pnt4 eerio3iytfpD lieil(0trxm(mpoo1lle mfetls) Dtau oot0apxn ociydfm rlu snt0trxrxfctodfa eau i;() etmirpiu1lp nmfeiltf Draxrpnu0tlenio3iat m2um( on()aexrxo iodlmtelnvo;s)seurxm oy1lmt  nctl(fsrrax  oo1open ocilt a2ulumo;t)texomociadoaDrluvslt tetr(m3iy1lmtn nes ()a2umuro;o1aptoio3iatfs2ua( o;(0 rtnmo3totfaDeluvol( srtm(o ou1apeelfcilt)srraurono4opeomf3iaslsDeauvs;t0arxoxr iy1lpteau slt t2uoimpny1olt  nvi ( sDum(rooo1opxn ociysfmDrauvpn(4aetoir3iydfaDe uvo s setoio no4apt lfcsltfaDra(rp;o1tpxn octadfmDea( p;t)tltnxoctatfa eai o;( srumxm ny1ll   fvsl(f ruaur no4olxomfciydfs2emu s ()texrxo3io1oa   ueo ()t2to(r3iu1alte icsatfs2tmxm nu1apto f3iyslsDul(vo (0trtnxfcio1fp elieo;t trxrir nydlle mici ( aDraxm ;u4tpxnmfetytfsDum( pnu)alxomocootoaDelu s s)srxr(m iy4optelivtlt aDtax  ;t4oexniociasla ra( snt4tltnxfcoytfa eanei s  euoim3iodlm elnvi t  Dra(mp;t1altnmf3iadfmDra( s t4 ltrxo oy1la eln s;(0t2tmimpoudllenlfei t s2rm( ono0oleo ictat s2rau p (4 ltrio tytoatrln o;s)t2umim iu1opte ncs t aDrmxrpno1tpxnmi3iyd m2rl( on(0artomfcoadlmDeauvolt0srtr(o3iu1amee fvtas)sDum( p;u4opeo ietld aDumnvo;t4 lxoifcia1oaD aieols)trtrxm iy1lle  fvtlt aDurx oot0oexomfciasfs2um(vs (4 rxrmr iadfp ranes;s  rxo(o3io1optemietltfartrx o;o1tlxn o3ilt m2ra(mp;u4tetnmr totfmtelueil() rum(r nydol e ivilt  2um(rpnt1tptomociad m2em( onu0arxomf tatlm  aneo;t0setrxm oo4omee fctl() Duax oot0opt iocias m2rau pn(4 etoxr oadop  ai o;() rxoimpoo4lm elfcs ( arur(root0aet mo3tas m2ulu p;(0tlenmo3oa1oa r ivsls0 eumxo3no1apenlnetatfaDuaum ;u0tltomo3taslsDel( o;(4 lxomocoodfmDeanvo t sruoim iydll   fetatfsDumxrp;t1aeto f3iaslaDuauvsnu)tlenio ootom r nvi t s2xmxr3io1ap  mncta() rtr(m oo4tee mfeiaslmDum(msnu) lxnmr oatfmt lu ilt  rurxr3nydolee ieiat artmxmp;o0tlxnmiciat mDrm( p;t) lenifcootlmDe ueil() rtmxo3nodlpt  nesas) Dumuroot0tetn iciltls2uaump;u4teeomr3oo1lpDrlieols)t2urxopou1oleelnvils  rrruront4aetnmi3ildls eanmsnt4trxoir iodlpDe uvslt  rxrir3oydaptelicils  Dta(moou0oee ifeiyslm2ra(mo t0teeoioctytla eauvs s0sexmxm ny1ole  iviltf Dumxmo;u0oleo ictadfs2emu o;() ltomo3totlpDeln i ()srxmio iy1oltelivs s)arumu pnu0opx mfeildfs emuvp;u4tlerirctotoaDrai ol( t2tr(m nu1alt mnvsasf 2ur(mo;o4olxnmf3iat mDea(von() reoxf oatfp eli il(  rtrxo3nodaptnmfci s)s2tmurpno4apxoifetat s2eluvpnt0tetomocia1faD aivol(  rxoimpoy1lme lnes sfaDraxmpou1aex  feildlsDulu pnu0 ltomo3iytopDe i olt0 2xo(r ou1lmeemfeias  ruax  ;u4oex mictyt s2ul(mo;() rxoxocta1fm  ai ol() rxo(o3oodoltnlicil()sruaum oo4tpeniiciasfa elu p t0tetomrciotlaD ai o;s)t2xrimpio1opee iciat)a2rrxront1oetomf3tadla ean p u4tlxrxo oo1fp e i sls)t2tm(opou1apee nes s arrmxrpnt1oltnioeiydfa eln pnu4 exrir3iytfa raivs (  rtmiopoudopeelivs t) rur(rpnu4apto feiysla2ulnvo t0artomo3oy1fmteaues;t0trxoiopiydlmeemfeiltfa2rrxmpnt1olxniietld aDrmnvs t4alenxrctytlptrlies;t)srumim iy1ol emfeils aDuaur ou4tlt  ictasfaDran pnu4trxnmr3oo1faDelivo t0t2xo(rpny1ol  lncsltfsrum( o;t0openii3iytfs rlnmsnu) eermr3iatlat lnes (0 2uoxo3no4olt  ivtls)s2um( pot0aet  i3iadla2rmu ont)aeerxfcoatfp rlnvo (0tetmxr oodom n fcias)sDrrumo;t0aet ifeiat m uln on(4tetriociytoat  nvol(  rurxm nu4optelnvia()aDurxronu0aetnmo3ilslmDraumonu4teenxfctatoa rln s;t0srxoxr oy1ole mivi ( arua(  ;o1ole  fetlt m2rlnms t)arenxo3iy1fmDrlnvi;t0 exo(o3io4ome micsat) rrrur ;t1oet mf3ilt m2rm(mo;t)teermr oadfmD lnvo t0trxoxm3oo4om   fet (fsDrmxmo;t1apx  f3iys sDumn p;t4 rtnifciatfpt aiei ( s2xmim3ou4lp emfci (fsrrmu ont0apt  oetytlaDea( o t4trxoifcto1fmt an s;( setoirpny1lm n nvilt)s2rruro;u4optoio3iasfs em(ms;u0 renir3tydopt aivs t0 rtoio nodol emnvi s a2rmuroot4apenmietysla ul( s;u) rxnxf3tadfm  anvslt)sexm(mpny1ape  ies tfsrtmu p;u4alx ifeiltfm2umuvp u4tlenir3oadla eluvs;t trxmxo3ny1om nlfes ( srtaumpnu4texoifetys a elnmo;(4trxomf oatfpDe ivi s)sexm(mpny4ope  nei s srrmx o;u0tleomo3tasla rl(vs;t0aexnmfctadlm raueo;s)texr(m nydlpeelfet t srrr(mo;t4aexnmo3ias mDrl( on(4 lxniocoydfaDrlnvi ( t2to(opiy1opt lfeil( a2tm(  ;o0opeo fciaslm uaumpnt4alxnif iadlatrauvo s)trxrxr3no4altnlfvtltfarraxrp;o0aet  oeiytfm2rmn ont0 exrxr3iadlaD  n slt srurimpoo4alenmfeia()srumx o;o4aetn iciydls2elumpn() rermociotlmtr nes;(0s2xoir nodlm elfvsasf Dtm( p;o1opxnioctlsfsDulums;(0altrmr oo1lp r n s;t  2urxrpnydapt lietasf Dum(rp;u4tee mo3ils sDelnmp;t)areoxf3iy1omD  nvi s)setrxmpoo1llenmnvsa() Dua( oot1aexn icils sDem(monu)aetomfciytoateau o;(  euoim oo4apee iviltfsrumx pou0alt mf3ildfmDeanvsn(4tetomr3oa1fpteauvs;t) 2tmxo3oydomte feiat a2taxm ou4tlxoiieiytfs elnvo u) exomr3oytfpDr uvs t)s2trim iu4lptn fciat)aDrrxmont1ape mictyt sDra(mo;()trtnxocoydfm eauvolt) euoxopoy1lme mfvsat)a2trumpoo4opx  oeiadlmDuln pnt4aetnxr oa1opD aieil() eurxo io4lpen iet ()sDtmx  no0aexnii3tasfa emumsn() reoxr oytfpt auvi;t  2xmxo oydome livt (fs2um(m nu0teen ictatfmDua(vp (0artnmfcoydoa eln o t0trtoirpiodamt  fctl(f rumum ot0opeomfeiyd m2um(vont4altrir3ta1opD auvolt0s2uo(r3no1lpe mfei t s2rm( o;u4aexn oeiytlaDeanvo;(4areoxr oytfpDeau s t0srxm(o3no4lmtnlfvi ()sDur( oot1apenmf3iytls2ua(mont4artnxrctydlaDrauvolt  eto(r ou4lm nlnei () Dtr(r no0tlx ifcias s rmu o;(4areomr3tytoaDrau s ( trxo(r no1lm nlnvt t sruaum ;t1apxo fciaslm2um( p;t0aleniociatoaDr n slt)trxoir3iodlp e fci ( sDrmxrpou4alx ioctadlmDrm(ms (4arermoctydoaD an ils s2xr(o3oy1ol  mnct s srrr(roou1opxomo3tat m2elu o;u) eenxociytom eln i (0 exrxrpiydllenmicta(fs2ta(  ;o4ape mietad a2ea(mp (4aexnxf3iotomtrau o t  exmxr nu1llenlivsl(  rtr(rp;t0oleo ociadlsDem(msnt4arxnifciatomt  i sl() eum(o iodalt lfcs tf 2rrumpoo4tee mfctas sDeaumo t)arxrircoodfmD au sls0teuo(m3no4ap n ncil()sDumur nt0tetoio3iyd aDul(ms ()tlxomo3iadoaDr ieilt0 exrxo iu4ape mnvil( a2rrur nu0alto oeiysfa2uluvp (4tlxnif3iotfm rlueo t t2xr(rpny1oleelfvslsfsDtrx oou0oetnmicilsfm2ul(vonu4 reoio3oodopD aieo t0 etrir3ou4lm   ncta(farrm(ronu1tpxnmiciyd m rm( o;(4 eenir iy1op  aies s) 2uo(m3ou4am nmfctasfsDuru p;o1aleo o3iatls2rl(vpnt)aetnio ootfaDrln ol()seumir3iy1optemneils)a2umx poo0alx moeiltlm2emnvo;u)trenmrctadlp rli ols0 2tr(m3oy1lp elicilt)sDtm(  no1ole mfeias m2ea( o t)aeerxrcoydfa  lnei (0t2umim3nudlm e neslt sDrru p;o4olxnmoetadlaDeluvs;u0arenmr3iatomtelnes;t0setoxr3ou1al nmiesa(fartrxm oo0tlx  i3tydfm emn s;t)trxnxo iatlpt lneo t t2xr(m io1lpt liviat srtmumpot1open ociltlm eau o;u) etomr iytomtraieo t  ruoxr nodam nlnctlsf rtru onu0oeeomfetydlm2uln pnt)tltnmocty1fmtraues;t t2uoio nydlpt mnes t)s2rm(m nt1apeo o3ildfm2eanmo ()altrxo oatfa elueils) 2xoxmpio4apeelfvt (  rum( p;u1oex  o3iytla2um( p (4trxnxr oydfateauei s0trtrim ny1op e fvtas  2uax  ou1opxomo3tatfm rl(vo;u4altnmfcio1fmtrau ils)teurirpnu4olenmfeiat)arta(mont4texnmfctlsls el(mo;(0 rtrmr3iytoptranes ( trtrir3iydal n fct t s2ra(mo;u1texoiieiys s umnvsnu)teerxr3oo1lm rlieilt) 2tr(m3nydome  ivtltfarrau  nu1tlen oetadfa2rlu s u) rermo3oytlmDr i i t t2xrxopoy4apeelicslt) Dra(r nu0tpt iietldfa raump u)altrio oy1oat  n i s0texr(r nodomtn fvia( sDurum nt0oltnmo3ilsfa2uauvpn(4alxnmo iydlptranei ( t2tr(mpoy4ameelfvsa() 2tmxr ;t1alxn o3ild a2rmumo u4aeerxf iatlm eau s;( t2toim iodlpte ncias aDrauro;o1olx moetytlaDrln pn(4artrif3tydfp e n o;t)srtm(r iy1al e fcia() Dua(r ;u1tleomictatfmDuan snt0aexnio to1latrau o;()sexm(m no1ape livs tf Dua(mo;t4tleomieias mDumnvp;() etrxo3tytfpteai o;t  rtrirpoo4lpee icil()s2tr(mpoo0tee mfeiatfs uau s (4aeeoio iotla r nvs;t teumxm iu1lltn fvslt)aDuauro;u0tle mo3iad a rmumo;t4 rermocto1lmDraneols tetoxopno4op elfeil(farraur nt1teeo f3tatlaDean p u4 ltnxfcoytoa   uesls0t2umir3nudolt mnvils aDuau o;t4tle mi3tltfs emuvsnt4trtnmr ootomt  ueols s2umio3oy4lmeemfct t)arum(rpot0alx mfciydls el(ms;(4artnmo totomtrau i;s)srumxr ou1amen ivsl() 2raurpou0texo ieilslm rln p;u0 rxoxf tatlpte uei s teto(m3iu4lpenlnvi tfsrraxmo;u4apt mieiydla2uan snu)aetoiocoytom eli o;s sexm(m3ou1lmeelici s  2trx p;u0aeeoif3iyt m emnmsn(0artoif3tatfmt liesl()s2um(o ny4op emnvt tfa2trump;o0opxo fctlslsDuan p;(4alxnio oo1lp e ivi s0 2xoir ny1optemnvs t srta(mooo0tetomoetaslm ean pnu0trerirciytomteai i;t0tetrir3oodlme livsasfsDtm( ont1ole  i3iyt a2eluvo;(4aetrmo ta1lmteaies;t  2xrir nu1lpe  fcslsfaDua(mo;o1tpen ociysfsDrlnvp;(4altnxo io1fmD li ol( tetr(m oudlmen nei (  rtmxr nt0aeenmiciydlm2um( o;()aleomf3iotlp  ln o t0 2urxm3oudapenmietl( sDua(  nu4altomo3tls a el(mont) lxoxr3oadlptrau slt)sexm(o iodapen fcil( s2tax p;o1teeomo3tasls2rm( o u0altnmrctodomDeaies;s)s2toxm nu4ameemivia()s2rr(r oo4oee  octldls ulnmsnt)aleoxocio1lm   i s;(  ruo(m3iu1amen ietlt)srua(mpnt4ope  iciatlsDra(vpnu0tlxoxocto1fmt ln i (0seurio3oo4op e nviatfa2tmumpou1olx ioctas s2rau p () rxrir3oadoa rluvolt0 ruoio ny1olenmfcsas)arur(  nt1opt miciadlmDeauvon()aeenir oa1omDran o;t)t2xoxopoydal   iviasfa2rm(m oo1teeoiieiytfs rlums ()alerxfcio1faDe ieols0srtr(m iy1lmee icsas a2trumpnt1opxn fcild aDumumpnu0 exomocoa1lmtrluei ( seurimpiudalenmictatfaDra(m ou1altnmicildfa rmn snu4altrio3oadlpD lues ()t2xmio oodlmt lncslt a2uauro;t4tpeomi3iyt aDel( snt0 rxnxf3iotomD  i sls0trtr(mpiy1lptemietl() 2rrump;o1apen iciys s eauvsnu4trxrxr oy1om elu il(0srumiopnodopenmncsls)sDrax ont0aptn ieiltfm umuvont0trxoxr3ty1lm  anvi (  rto(mpiodoptemicsltf Dtr(  ;o0oeeo fciadla2rmn o;() eermrcootfp  lnes;()texo(m3oy1altnmietatf 2ur(mp;t1oetnmoeiysfaDum(mont0 rtrifctodlmteaieol( s2toim oo4op n fvtlt)s2uau  ;t0teeniieiatfm2uanmsnt)tltnxo3oodlpDe n i;(0sexmim nu1olt mnei (farur(ro;t4apto ociasfa ua( o;t4tltrmrcoa1fp  livsls)seurxo3oy1op elietls aDumx  ot4olx iociatfs em(vs t0trtoxo tydopD lies s) rxrimpou4aptnmnctas) 2ua(ronu1tpxomfetyt sDeanmo u4 exrmr3tatfaD li i;t0s2xmir nu1amt  net sfarrm(rooo1tet  i3tydfa2ulu sn(4teermr tydopDrau o;t)srtoim3oydamee ivslt)aDrr(rp;t0apx if3tltfs uln snu4 ltrxr3iydoptrauvs;(0seuoxo iydaptn fciltfa2tau pnu0oexo fcildls2emnmont)aeeoxr3ootfatraues s)seum(opno4llt lieslsfaDrmxrooo0altnmi3ils a2ran on(4arxnmf iadlmtr uvs;() etrir3iu1altemneilsfsrururpoo1oetniietyd aDuanvp;u0trtnxf3oyd
\ No newline at end of file
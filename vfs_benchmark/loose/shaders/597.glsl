@@ -0,0 +1 @@
+nei;s)tetr(m3iudop n nesl()a2rmu pnt0tltn o3ilslaDrmu s;u) etomf iadoptelueo () 2toxm ou4ol nmfeta( s2rr(m ou4opxomieiadfm2emnvp;t)aeeoif3tydfmte nvi s)s2xmxopnodalee ivtltfsDur( pnu1oltnmf3ild mDumnvp;u)aleomfctydfmtraiesls)trumio ny1lp  lfesl(f Dtaumono0oeeoioetysfs rln p u)tltrifcty1opt  i il(0srum(mpnydoptelfesl(f rrm(ront0olenioctldfs uau pnu4 rxnir oodfmD lu ils s2xoim iydlm nlnvt s  2rru p;u0aet moctyd a2ean p (4alxnxo iatopteli ilt) ruoimpoodaltn nvsas aDurxmp;u0apeomieiatla emn s;u4tltrmf iodfmD  ieo;(0 2tm(o oy1lpeemncil(fsDtr(ro;t1olt moctadfsDraump (0aexrifcoo1oa  livo (0trto(m nudamtnmfesas)aDrrump;t4texo ieiysfa el(ms u)aetnmr3iodom rai s;()srtriopou4alen feslsf Dur(ro;t0oltnmf3iysfa ua(mp;(0 exoxr oa1opDelnesls0setr(rpiy1om e ivslsf 2taur no4apeo oetlsfa2ra( p ()tetnio3iatlaDrluvsl(0srxrim3oo4lm nmneslt)sDraxmo;t1alxomo3iaslmDeau onu0tltrmrcoytlaDe n il(0 2tmiopiu4ap  mfvs tf rumur ;o1alto fcildfm ulu s;()aetnmfcta1om ran s;t  eum(m3io4optemivs sfa2rru ont0oexn octat aDrl(mpn(4tetoxfcty1la e i ols)t2tr(o3io4ope  fci s) rtmx ono1opeoiictydfsDua( pn()aexnif ta1fptrluvs s) 2umim3iy4optnlnciltfaDra(r ou4opxniicias m2ul(vonu0trxrxf3oydoaDeli o;t teto(mpoy4amtn nvsls) Dur( ono4aeeoiictldlmDul(vpnt4tetrxo ootoa r n s (0texrio3nudlmtnlnctl() ruaumooo4olt  feiatlm ea( o;t0tltoxrcoy1late iei;s0trum(o nodam  micsasfs2rrurp;t0tltnii3ildla2elnvp u0tltrmo3oa1lpte nesl(0 2um(mpiu4llt  fvsas a2rru o;o4aet if3iyt aDulnvp;t0 exomf oydop   ues;s trtoxm ou4ome lictls) ruaxronu1oex micilt s2umuvp;t)tetomr3ootlaDrlnes ()trxriopiu1omtnlivs ()s2uaxmonu0apt iiciatfa em( pnt0trermfcia1faD lneolt0t2trxr iy4lpt mivias)sDrr(r ;o1tltnmfeiad a rmuvpnt0tltoir3tytla rlnvi;( trxrir oy4openmfvi tf 2rmuront1aetnioctyd a2umnmp u0aeermr iytlmD ln ilt0sexrxr3ou1lpenlfcsl(f rtmu o;u1tle iietysla elnms u4 reoir3tytop  anvolt s2um(m oodol nlivs ( s2uru  ;u1opxomo3tatls2rm( o;u) leniocootomDeluvs t srtrir ou1aleemiesa(fs2tmxmpno0tleoif3ild mDrm(vo;u0 lxnxrcoodfmDraivsls  2xr(o3nu1amtnmnctlsf 2tau ont1optomfetlt m2umuvont0 ltoio tatlm e i i (0t2uo(o3nydopeemictatfsrrrurono1ape mo3iltfs rau s u4 reomocoydfmte n sls0t2xmxr oo4lpenlnvtls)a2ua(m oo1tpenmfcildfaDrluvpn(4 eenxfcoydop r ieol(  rxrxo oo4ameelfes (  2umumono0tltniociadla rlnmsnu) lerxr3oydomtrlu o;( teuoio3oo4ale mnci ()srra(r nu4oltn oeiysfmDul(mon(0artrmo3oatlat au ol()teum(r3oo1lpe mieils sDtaxm ;t4tpxnmf3tldlm2rm( p t) reoio3iatop eaieo;()setmir3nudlpe miet (  Dur(m ;u4tetnifeild m2ul( p;u4tetrmoctytfa e n ils  exoim io1opee fciatfaDurx pnu1tpx iietysla2ra(vo t0tltrxfctatfat lu o () rxoim oy1apen fes sfa2rmumo;t4apxomiciadfs2umnms t) rxnif oatoaD au s;(0seumiopno1al elnct t aDuauronu0aex mo3iyslmDelnmp;u4 ltrxocoo1laDe ueils  2tm(opno4op elnvt t)srra( o;u4aeeniicildfm2rluvs;t0 lxrifcoatoaDrluvs (0 ruo(mpoydale mneiat  Dumu  ;t1aleo i3tasfa2rl(vsnt4 rxrir todomDeli sl(0setm(o3no1ap   ncils) rrru  ;u1opt  i3iadla2ulumsnt) etnir iodomt lieol()setm(m iy1lmeemfcil(  2trurpot1olxnmfeiltfs2um( s t)alxrir3iatomDr ivs;s)srxoxopiy1open ieslsf Dur( p;u0olenioeiytlm2el( s;(4arxnmo3tatlmt aivo s)teur(r3iu4olee ies t) rua(mo;o4oee mfciydfs2el( o t4tlxomrcootfa rln s t0s2ur(m3oudom elieilt) rur(m ;u0teeomociyt m2emnvp;u0 ltnmoctydomtranvilt)sexmio ou4openlnctat a2rmx ono1opxo i3ild mDrlu p;u4altrif oy1fpt  uei;t)texrio nu1aptelfet t  rumu p;u1tetn f3tltlaDeauvp u4 lxnmfcio1lmtelivi;() rum(r3nudap nlnes t)srtmu pot1teenmociadfaDeau p t) reoif3iydfmD  ieo;(  rtrxmpoudapt lieils s2rau ont4oetn ieiasfm rlu p;t0areoir3totfptrlnvo;s)seurir ny4lp nlics tfsrumxmo;t1alxnmf3iadfs2uaumo;t4 lenxr3totlmDeaiei;t) 2triopoy1lpt lictl(faDtmuro;t4tee mfctyt m2um(vo (0trxnmo3ia1omD lies;(0trxmxo nudap  lictas)arumurpot4olxo o3iadlaDraums u4texnmocia1op  auvo (  2xm(mpiodamtelictas)s2raxroou4olen i3tytfs rlu pn(4 rxoxr tadfmDrluvils s2toxmpoo4lm emnctls) 2umxmoou1tptniiciyd s ulums (4 rxnmo3oytomD  uei () 2toio3no4opee fci s srumurpnt0tlenmictas sDuln onu4teerir oatlpDrlnvo;t t2toio3ny4lltnmfeiltfa2tmx p;t1oetniieiysfsDumnvs;u)trenio3ta1fpteluvi;s0 etr(r iu1lpenlnetls arrm(mpoo0aeen iciat m2umump;u4altrio3tatla  ln i;(0truoxopiy4lmtemivtasfartmum ot0aee iociadfmDrl(vo;t4aetrxo3ootfptrlu ilt)s2ur(m no1altelfcilt aDtrxmpno0opeo i3iydlm2umu sn(4aeenmf tydfm raneil(0 ruoxopoy1lp nmnvsl(  Dtmxro;u1apxoifeild aDrm( s ()aexrxf3oadomD  uvo;t  rtmiopoydamen netlt)a2tmu pou0aeeoioeiasla eaums (0trxoio iatfatr nes s  rtm(rpiu1amtnmfvsasf ruaumpoo0optn ietatfaDea(vpn(4trxnxo3tadop r uvsl( s2tm(opoy1lpee nvi s srtrumpnt1oexn f3iatlmDrm( p u0 lenxr iodoa rli ols s2to(rpiu4apte ncils sDrm(ront4opto ocildfs2em(mo u0tltoxoctadfpt auvs;()trur(opno4ope  ieiasfarur(rpot4oetnmicilt s2el(vo;(0 rxnmf3tydfpDelnvo;(  etmxmpiy1ape mictl()s2rru  ;t0teeoio3tyd s2emnvsnu)aexnxo todlpteli il(  rtmxm3no1ap  lnvt (f Duaumont0opto i3tydfa rlu o () lermr3oa1lat lu i t)trxoxo io1ll emiet t) Drrur no0apeomiciys a ra( o ()artomr3iotoptrlivsls0s2xoio oo1om nlieiat arrmx  ;o1aptn o3tld m rl(ms ()teerxfctotoatr ivilt0t2urxm3nodll elfetatfs2umur ;o0aeeomo3iatfm2um( o (0aeeomf3tytlp r uvs s0trumxo nydamen ivia( aDtmu o;o4tpxoif3tadlaDul(mo u) rxrif3oodfmDeai slt0srtmiopno1op e icsat)a2uax  ;o4oex  fciydfm2rmuvo t) rxomo oodlm  lues (0trtm(r3iydamte fcsas s2tr( oot0oex moeilt a raump t) lerxr3iy1fat aneo;()trxmxopiy1amenmics s artrx p;u4tlxnmi3iatlaDea( on(4tltoxo3to1fpt lnvs;t0trtmimpiu4om   fei s s2ra(mpno1tpxn ieiytfm umumpn() eerxf3iatfaDelues;t0 rxmxopny1lptemivia( aDurxmo;u4alx mf3iatlsDeanmp;() leoir3tytfa r u ols0 etm(m3oy1apen fes ( aDuaxmpoo4tpxn fcias a um(msn(0tlermo to1lmtrlieols  exmir3no1amee ieiatf 2tr(r no4oetnmieiys sDra(mp u) exnmf iytfpDranvo t0 2toim3no1lltnlnct () 2umx  nu0olx mociyt s2ulnms u0tlxrmo3ootomDe i o;s teumirpnu4apenlfct s  2tr(rooo0aexn f3iyd aDeln s u4 rtrxrctatomDrlues;s0t2toxm iy4lp emfcslsfsDtr(  oo4ole mfctat mDemnvo;u4tetoxo tatfpDeaies ( s2xm(r3ny4om n fvslt)arum(mpnu1tlto feiys a um(vp;t)tlxnxf3oa1fm  aueslt0texrio no1omenmfcil( sDrax  nu0tetoif3ils s ranvo u) rxomo3oy1fpD anei;s  eurxm ou4am  lictat)s2uaxm ;o4openmi3iadfa2umnmont4treoio3iodlptrluvi;t) 2xrir3iudap nlfviatfa2umxro;t4apt  ocildfm el(mo;()arxoiocoytomtran ols)trtoxo nu4lme mnvi (fs2rmuroou1aetnmi3iyt mDean s;()trxnxr3iatop r ieo;(0seuo(r3io4open nvt s)a2rmxmonu4opx  fciyslm2emuvpnt) etrxr3ootfpteauvs t) rumio io4omeelnvilt)s2taxm ot0opx mfeildls2rlnvs (0trtoxocoadfpDr uei t)setrxrpno1ap elfetltfa2tm(r ou0teto o3iytfs rm( p;(4 reomfctodlm eauvi ()s2xmiopio4ol n feilt  rrr(m oo0aee  ieiat a uln onu4alenxo3iydlpt auvo ()t2urxm3oodlp nlictatfa2rr(r ;o0oee  o3ilsfs uauvs;u4teeoxrcio1lpD livi;t teumxo oy4ope mnctl( arum(r nu0opt mfciadla2ua(mp;u0aexrir oydoa e uvi;(0 etoio iy1lmeelnvsas) 2um(  ;o0tet moctyt aDeluvo;()tlxrmociodom r ivs t0 euoxm no1lmtn ivil( s2rr(monu4oeeo fetad aDul(vsn(0 rtnmr todlmt aneol()teuo(o oodll nmfetltf Dtmxroot1aleo fcildfm2rlu snt0trtoif3oa1oa rlivsl() eurim3oy1lmtn ncia()s2umxm ot4tpe io3tytfaDuau p;t)altnxf todlmtranei;(0sruo(r3nudapeemfciatfa2ra(moou4apxomoeiadla raums;u4 rxrmo3iy1fm e ieil(0texrxmpiudolte ictlt s2rru  ot0ale ifeilt aDuanvsnt) etomfcoytomD  n slt)s2urxrpoo1al nlfcia() 2rmumoou1alx  octasfa em(mp u)arxomocoatfmDrlu s;t0s2tmio3oo4apeelfetas) rrruront1optoioeiatfsDuanvsnt0artomfciatfm  lnvs;t0trxrir iu4olen fvta(  2urur oo0aeen ociatlmDuanvs;u0aexomfcoy1lmtr ueo;( s2trir3no4am  mfetat)srrrxroot0aex ii3iytfaDuau ont0aleoxocio1latelueils)sexo(o3iydlp e fvtl(f Dtaxmp;o0texo feiyd s um(mpn(4aexomf3iydopt aivi;t  2uoirpiudope mict s)aDtmxmp;u4olen fciysfs um(vs;t)tlxnxr oo1fm eanvo (0 rxrxo3iodom emneslt  rurx  ;o4olt mi3iasfaDumumont4alerifctotlmt anvo t0 2uoxopio1lpee iet t srra( oou0alxniietys mDulu p;t)alxnmrciadlmtrauei () eto(r nu4lpt livsa() Dtm(ro;t0olxnmfetltlsDrmu o u0trtnxf iy1oatelies () ruoxo3ou4alte nct t)sDtm(  ;t1apx ifciadlmDrau p (0 etnxf todfatran o;t0 etr(r3nudll nmnet t s2umu  no1olt ii3ildla2uln pnt4trermocootoatr neils)t2toxopny1ameelicils srtrum ;t1tpxniieiadls rluvp u0tetrmociotom  aues (0srumir3iydaptemicsa() Drrxm oo4oee mictls s rmuvo (4arxnxf iodfmD lnvo;()trtoir ny4lpe  feia()a2ua(root4tleoifetatla emnvo u)trtrir3oydlpDranvils)t2uoiopiu4lp  lieta( s2uru ont0oetnmfctlsls ra(mo;()tlenxfctydfpDeli o;s0srxrirpoodalt lfcs (f 2rruro;t0opxnmf3iysls2ua( pn(4texnio3iydom  lueo;t trtrir iudlptnlnvsl(  Durx  ot1tpenmi3ils aDeau o (0tleomo tadlm elnei t) etoio io1lmenlictasfa2rrx onu0oleo f3tadfm ra( p (4tlenmo3iy1fat  i ilt0 rum(o3iu4ol n fcia()a2umxmoot1tlxoif3iatls emnvp (4trtoif oytoaD aivo ( setmxr oo1al e icsa() rua(r ot4aleomo3iaslaDua( snu) eenmfcta1la e uvo ( tetrxm oodame  netat) rra(rpot0optomoeiadla2uaums;(0trtnif3tatlm rai o;s0trtrim ny1lm elfesa( a2uau  nu0alxnmi3iys mDumnmo u)aleomr3todfaDrlneo t) rxmxm3oudlm  lfviasfsDtrxm ;u1olxomo3ils sDrmu p;t4tetriocty1lpDraueol(  eum(opiy4opt  fei (  2umurpnt4teeoiietadlsDrmu o;u) etomr3oytlmDr ueo t) 2uoxrpoo4aptn fvs () Dtrurpnt4oltn oeiatlmDrl(vp;(0artnmrcoadom e ieil()s2tr(r oy1alt  feias aDtm( ont1aexnifctydfsDrmnmo;u4aeeomr3iodfmD  ivo s) rtm(rpno4ame  ncilt srrrxmpnt1tle mociys a2ea(mo (0tltrxo oo1fmDe nvolt)setmimpnu4ap  mfes t  2ur( o;o1apeoif3tasfa2eln pn(4trxnxr3oytom  ln o () rxmxr3oo1lmt liciltfsDuaum nt1tlt  feiatla rm(mp (0tlxnmr3totlp  lneil( srtmir iu1oltelivt tfsDtmxrooo0alxo ictlsfs2umnvp;u0 ltoioctotfpDr i i s0srurxrpoo4ale lfeslt  rtrum ;t0oee ioeiyt aDea(ms;(0 rxoxo tydlmteauei;s0s2xmxm3no4al   fvtasfartmu  ou1aexn feiadfs2eanvp t4 reomfciodlpDelivols0 etoim nu1lle  nctl(f Dtax ont1tle mociadfsDulnvo ()tltnxr3iytomt lnvil(0 2uo(r iu1lpenmnetat srrru  ;o1ale  ietlt sDumnmon(0 etrifcty1fmt lnesl(0t2umxr oy1opee ies ()srtax  ou4oetniicilsfs ranmsnt)alxnxo oydlm  livo;()t2xrxmpno1lp nmfesas sDrrum ;o1oeenmieiyslmDemump;t)trtnmf iytop  lies;s0tetrim nu4lpe  ncsa(f rrm(  nt4olx moeilt mDra(vpnu)alxrmfcty1lmD  ies s  rtoxr oodalenlivsltfaDrru  no0oltn f3ilt m2eln o t4aetrxrciadopD lues;s) rur(m oy1lle lncs ( a2uru pno4tex mo3iydfs2ulnmonu4 lenio to1lm eanes;( srumxr oo4ame mnet ( srta(ro;u0tpx  ieiat mDel( p t4areoxo3totfatelueols  eur(r iy4amen ncsatfs2ra(ro;t1ale if3tasfm2rlnvpnu0aleoirctydlatrlivs s  2uoio3ny1ol emici t a2ur(ro;u1aex if3iydlm2rlums () rtriociotfa  aies t0t2xr(r3oodop nmivtas  Dumxmpnu0aex micildfs uan p (4arxrio oatfmtraueslt  etoim iu1oltnlivt s)s2taur ;u4tpe mo3tltla2umnvo;(0 rtrmo3oatomt lnes s)t2uoxopou4amtnmivtl( arrrurpou4aeenmfeiydfsDemuvo;(0aetoifcoytlpD  u s () rtmir oo1alenmfciat  2tr(m nu1aetoiiciyslsDelump;u)altoxf3oatom r nes s srtm(m3oy4amenlieilt srrrur ;o0altnmfetldls2ea( s;(0tetnxf oy1oa rlneo;s  eur(o nudome  ieil(f Draxrp;o1aetoiictldla eluvsnu)alxnmf tytlaDe neolt0 rxmirpoy1lmteliciltfsDrax p;o0aetn f3ildfm rmnvpnt) lenio to1lmD lues s  rxrio3no4lptn icil()s2trur nt1tlx  f3ilsfsDeanmo u)trenif3iydfp r n o;s)sexrio iy4lpt  ncslt)srrmx  ;t4oexnmictlsfa2el( pnt0artnif oa1fpDraieilt) rur(o io1lp n ncils) rrru p;t4apeomo3tydfm eanmonu0alxomr iotfm e nvolt)trxmxo3no1alte fctlt  ruaumo;o4apeomoctltfs2ulums;(4teerif oatop raies s  2xm(opiydlpenmncia() rtr(root1aleoifciydlm2rmu pnt4arxnxociy1lpD  nei s0 rtr(m3nudlpee neias) Drr( pot4teen i3iysfm rluvo;()texrxr oa1omt  neilt  rur(o iu1aptemivt () Drm( pot0oeen octldls emums u4tlenircoydfp ean sls)s2xoxmpno1openmivtlsf 2rmu ooo1tleomieiltla uan onu)trxomrctotlaDelneo ()t2umxr3nydomtnmfesa( srtaxmooo0alt  iciltlaDrl(vp;(0tetnircoa1optrauvi s) exr(r3no4aptelfcs tfs2rr(  ;u0optomfciat s2eanvo u0artoxfctatfm  an sls  exmxr nu1ol elnetlsf Dtm(r ot0optoifeiadlsDra( p t)alxnmocto1fp eln s;t0 rtoxo3oodlle mfci tfsDumxmoou0ale mo3tltfa elu s;u0 ltrif oydlpDe nvi;s)t2xmxmpny4llen fvias  Dtax poo1texn o3iydfaDumnvsn()tlxomf iydfmtrauei;s  rxmio3oydaleelncsa(f Duau  no1tptnifetyt s2ulnvp u)tlenmf tatfaDraivi ( srtmxopnu4ape mivil( sruaxm no0apxniictlslm2eanms;(4tetrmfcio1lpte i o;t0srur(mpoydape lfvtat)s2um(ronu1ope mfetytfsDeanmon()treoif3ta1omDe uvi t0tetr(o3iu1opt mict (  2rmumono4ape ioeiatla2ra(vs;t) etnxo3iotopDeaneo;t)trxmxo3iodll  lfesatfsDtmx pno4aetnmfeiltfsDua(mo u4 etrmr tytfpDr n o;(  exoirpno1oltelncils)sDur( p;t4aeen iciatla ra( o;u4 exnxr iadlp r ivi t0s2umxm iu4oltn ivs s) Dtmurpou4olt  octydfaDua(vpn(4aeenirciodoatrli s;(  euoimpio1oleemfei s) rurxrp;o0tptoii3iadlmDrm(vpn(0 ltrio3iotoaDrln i;()trxoirpio4om  mfvtas sDtaum nt4oleo iciys s2eln on(4aeermf iotfm rlu ols0 eurxo3oodop  licsasfaDrm(ronu1alx mf3tat s2rluvpn(0aleomrciy1fatelu i;s)s2umio3ou4op  miei t)artmurpnu1opxn ieiltfmDra(vp;(4altnio3oatla  au ilt texoxmpoudlp  mics ()s2rmxroou4altniocildfs umnvs t)areoxr3iotla  au o;(0s2urio ou4olt lfciatfaDtm(m nt4aeeomociad m2uaumsnu0tetrxrcto1fmD livs t)s2tmiopou1alen fesltfsDta(ro;o0tlt if3ilsfaDelnvs t)altnxo oatoate uvs;t  rxm(m ny4apee fvias  rurx pot1alxnifeiysfmDrlu onu0teenxr3ootlm  ln o ( trum(o ou1altelfviat aDum( p;t1tlx  ieiydfaDraump;u4 lenio oatlp rliei (0 exrim oy1olenmfcil(fsrum( p;t0tptnioetltfs2elnmsnt4texnir3oatfm e i s ( teumiopiu4alt mfes t)aDum(moot0tex mfetyslm2uanvo ()treoircoatlmD  ivslt)trtoim3ny1al elnes s) rraum ot4tetnioetadlm ra(vs u4aetrir ootlmDrai ils) rum(opno4ome  nes () 2rmurp;o4oeeo ictlslsDum( p u0 eermf iydoa  livo t  2urim3io1al n feiatfa2rr(m ;o0apxnmfciyt m emn p (0aetrxfciodlaDelueo t) rtoio iodll e nvt tfa2rru  ot0tpe iocild mDrlu s;u4texrio oytopt lu sls0truo(r3no1alt lnvsa( s2rmxm ot1opt iiciasfs em(ms t4areoxo iotlp  lu o t texrir oydlme  ivtat aDtm( pnu0oetoio3iyd s2rauvpnt4trxnmf iy1fp rau s ( s2xo(o3oo4oltnlneta( srumxmp;o4aexomietys sDea(vsnt4aetoif3tatopD au o;(0 rtm(m oodlmen neils aDraum nu4tpxn iciat a em( snt)tlermf3iatfmt  uvo;s  rurio3no1ope miet t)aDrax onu4opto o3iys s2ra(vs;u0trerio3oy1laDraueo s)seumimpiudaleelfei tf rrmxrp;t1olxoii3iydfa2umnmsn()aexrifcoo1oaD livs t0 2xrxmpnu4lltemictl()s2rr(  ;o0aleniieilsfm2um(vpnu4arxrif3tydoat auvi t)trtr(mpiy4altemivs s s2umxrp;o0olenmf3iat m2ranvs;u) rermfcio1fptraneol(0trtoxr no1opeelivtat)srurxro;u1tle iicildfa ea(vs;(0 lenmo iatopD  uvols  2umimpou1al  lneias) Durxmp;o0tleomieias mDulnvp;t4alxrxfctydfmDelnvo s trxr(m3io4ome lfeslsfaDraumo;t1apenmf3ilsfs rlnvs u4texrmfctotlaDeli i (0t2ur(r3nudomenmivt s  rumxm nu1oeenmfctlslm umumonu0 rxrmo3tadopte neo t0 2trim iodlleelivsat s2trumoou4ope mfcilt sDem( s;u)teerxrcoadfmDeln s;t) ruoxo3ny1lp e fvtls s2ua(m ;t0apxn fetasfm2ra(vp;(0arxnio todfat ai s t  ruoxm3nu4ome  fcsatfs2taumpot0oee  oeiydfsDrlnmsnu4 exoxo oodoa ean o;s sexmxmpiy4amtemiesat  2rru  ;t1altoio3tls mDrlnvs;u0alxrmrcoo1fmD li ols trxm(mpiy4amee fviasfaDuru  ot4olxnmf3tat sDemumsnt4 lxriociy1lmtelnvs;s)tetrio oo1om  lfcs s)sDtrxrpou1tpx ifeilslsDran s;t0tlxrmfcta1omDrai i s)s2tmxo3io4lpenlfcilsfa2ta(mpot1opxnmo3iys a2umnvpn(4 exnmoctytfaDean s;( srtmxm3nudlme mieslt)s2raxrooo1apenii3iltfm2rluvp;t)trenmo oodom eauei s0srxoxr3oydlpe lncsat)sruru p;o4tpe mo3tlt aDrmn s;u)trenif ty1op ranes;t) eurxrpoo4apenlietls  ruaump;u0altn ieiyd a rmuvs t) exoiocoydoateluvi t)t2toir3oy1opt  icsltfsrrm(r nu0opxoioeiyd sDeanmo t0 rtrxr3tadla eaivsl( trtrim nydolee fcsl( a2rrx poo1tptn ociltfa2elnvpnt0arxnmrctydlpt lu o ( truoxopoydlptnlfcs (farrax  no1alx mieiyt s2uluvpnu0tleoir3oytlm r ivs s  rxo(r3ou4amt mnvtltf Durxm no1tltnmfetltfa elu s (4aeeoifciatoatraieol( sruo(r3iy4llenlfviat sDuaumpou0texo f3iad a2ea(vp;t) lxnmfciydfpteaivs t0 etoim3no1lp   ics s arraum ou1ape mieiadla2emnvs (4 etoifciydoatr n ols) exoiopoo1lpe lfeslt)artm( pno0apeo o3tadlsDumnvs;t) lerxocoy1oateliei (  2tr(m nudamtn fvi s arrm(  ;o4olx  o3tls a2eaump;()tlxnmf oo1omDeaieo () 2tmir no4ap  liet t a2trxr nt0opeoioetltlm2emu ont4teenifctydfp r nvi s  eumimpoy4omeelfvtl( a2tax oou4tlxnio3iatfaDrlu p;u0alxnmo iadfaDe nvsls)s2trxo nydlltnmfesatf rra(rono4openmfeiytfs2rau s;(0aeerio tatfptraivsls0 2ur(r oo1omee neilsfa2ua( p;o0opeo feiys s2el(mo (4trxomo3ia1opt  i ols0trurim io1ap elivsas)srta( pnt1apx ifeias mDumu s;()aetrif oa1faDraueo s0sexrxo3nodopee fvtlsfaDtrxr ot0aet moeiatfm uanvp u)alxnmo3tytfaDeln sl()teto(r ny1ap emfctl(f 2uru o;u4tltoio3tyd m2uan p t4aexomoctatfmDr nvs s t2xm(m nodlm  lfes s artmu  nt4aptn feiysfm ean p u) ltniocoadoa  aiei s0 euoxo3iu4open nvsatfsDtaumo;t1tle  f3iadla2el(von()arerircio1fmD  uvi t0 2umxm3io4altemnvtlt)sDtaxr ;o0opeo iciatfa ul(ms t0tlxoxf tadomDrlnvo;(  rtmiopou4lmte icsl() rrrx  ou4alenmictls sDem(vonu)texomr3todlp  lieil( t2tm(m3iodapte nes sfs2ua(r ;u4teto fetatfm2um(mp;t0trxomo ootlp e u i;(0 etr(m3nu4lltnlncsl(f rum(moou0oet  feiat m2rl( snu) ltrxo oatoaD lu i ( texoim3oodlp nlfeilt artax  no0olenio3iytfaDua(vp;()tltrio tydfa   n sl(0trxm(mpno1omte icsl()arra(m ou1tpxo i3ildla2uln s;t0texrmrciydfpt anesls0t2um(mpiu4aleemfcil()srta(mono1aptnmociys mDem(mp;u4tleoio oatfmD livo t)t2uoir nu1lltnlnctas s2tm( ont0openmfeiydlm2rmumsnt4artrxf3ootoptelueo s0trxmxm3iudolt lieil() Drru pnu0opxnmfcildlsDrmu on(0alxrxf3oa1fm eaivil() 2tr(r oudamtnmivt t  2umumono1optn ocilslmDelnvpn(4tlerxr3tatlm rlivo s sexoxm3oy4lle lfcsls)aDrmu oou1oeeo o3iyslm umnmsnt0tlerircoy1faDeluvi;t0t2uoim iu1llenlncias) Duaxmp;t1altomi3tat a2eanvp;t) eerxo3oy1optrlu i t srtmxo3oo1opeelfvsatfaDtr( oou1tlen feiadfsDum( ont0 rxoxrciy1oaDelivs;( tetmxrpou1ameemnvs sf rtm(mo;o0ope  f3iytlsDrlumo t4arxnir3tytfateln slt)texrim3oudlme  nes t) 2raxro;o0ape mfeiatfmDrluvp;()altnmf oo1omte n o;t  rxr(mpnydolt lfcia( artmu pnu4aet  i3tltfa2eauvsnu4trtnio todlmD ln o;( s2ur(r3nudame liesl(  rtm( oou4olenioetydfa emnmont0trtnxo oo1omDeaues t) 2xr(o iu1ap nlici t)aDur(  oo0optniieiad s ra(von()texrmr3iodom ean o s0 euoirpiudll e nvtasf rrrurp;o1ale iietlsfm eauvpnu0trtnxociydlmD luvols) etmxm3iodlp emncs s sDtax  ot4aleo i3tat s2rl( s u0aeeriocootfmD aneo;t) euoxmpiu4ap   icil( aDrmxm ;u0alt moctytls2elnvsn(0teenxrcoydfpDr ivsls s2uoxo3no1ap emnci ()srrau oou4aleomieiydlmDrm(von()aeeoxr3ootoa   ivil( seuoim nodam n nctat)sruaum nt4aeeoiieiadlm ul( pnt4tetoxocia1fptelueo s)teur(mpoy4aleelfci (f Dtmum oo4aetn oeilsfs umu o;t0tltomo3oy1fat luvs;t)texr(rpiy1ole  icil() 2ta(r nt4aee mo3iytlmDea( o;t)alerif3todfmteliesls0trurxr3nudlpe  fvsl( srumxmp;t4ape mo3tas s2ra(vpn(4altoiocty1la e ieils seumim oo4aptemivtl( a2ur(r nu4aet  oetaslm2elu s;(4 lxoxr ia1lmt lnvils0 etmxo nu4ol nmfciltfsrrrump;u0apt mociatfa em(mpnu)arxomf ootfat  u i;t0 2xriopiu4omen fcsa() Dur(mpno4teeo feiysfm eanms;u0tltrmrciadfp rli s;s  eumxopno1aptnlneta()sDua(mpot0tlt ioeiat m2rm(mp;(4 rtoiocoadlmtraivi;s)teurir3ou4alen fvslt a2trx pot1optnif3ildfm umnvp;u4 etomf oa1lmte neils trtmxo iy1ol elfctls)s2rax  ou4oltnioetldlaDeauvs u)tlermo tytlpD lu i;() etmim3ny4lmt mfes ()sDrm( pnu4aee ioeiatlmDumuvs u4 rxrxf ta1op  auvol( t2xoxm3oo1ll  micsatfsDrm(m ;u0olx iietlsfmDeanmsnu4aexoio iatlmDrai s;()trurirpnu4ap nmfctls a2rm( p;u0oetomfetlslaDrl(vsn(4arenmf iy1fmtrli olt srur(m3oo1am e fcsl( artmumpoo1tpx  i3iatfaDeaumont)trtnxrcoatlpt aueols0trxrxr oy4aptnlicilsfs2rrum no0olxoio3iytla2rmnmo (0tltrmrctadlpDrlies;s  2xmxr ny1ol   nei ()sDtrxrp;o0tlt ioctasls elnmo;()altrxf oytlmt livo;t0 rxr(r3iu4al emfet ()srrr(rooo4aet mfeiydfm2eanmpnt4aleomo3todlp r ivslt0seurir nodap  lnvtl()s2ta(r ;t1apxoio3ils a eluvon(4 lenxo3iytop rli o;s0 2xmxm nu4am elnvia(  2uaxmo;u4alenioctls mDelnvo;(4tlxomo iy1fa rli o s)sexmir nydll  mnvtls) Dur(m ;u4olx  icildfs2ulu s;u4trenifcoo1oatranei;t)teum(o nu1lpee nctat s2tm(ro;o0aetn fetysfa umnmp t0alxnmo iydomtrauei s0t2xrir3iy4ap n fviltf 2urxmpoo1openmoeiys s emuvo u0 reoir iotom elnvi;t0trtrxr3io4ole mncil(fsDumurpno4opxnmfctadfaDrmnvs (4trxnmr ootfaDe ueols)t2xm(mpoo1alt mfvtlt) rtaxrono4tltnioctyd mDulu ont)trerio to1lat  u i;(  2tm(r3iy1altelfct sfsDtmu pnu1openif3iasla ea( on(0texnxo3oodlmtelu o ()t2tmxo3iodlm nlnci t)aDrrxmpnt0teeomieiasfa rm(mo;(4arxnio3iotopt li s;s)s2urxopoo4oltnlict t)aDra(monu4opx  i3iadlsDrm(vo;t) rtnif totomD livo s) exr(opnu1al   ict t) rtrxro;t1tptniictld sDrmumo;t4 rtomfcia1latean o;s)sexoir3ou4al   net s srrm(r no4apenii3iadlm2rmuvont0arxrxf3tadlpD li o s)srumxrpio1altemncta(faDrax  ;u1alx  octadfs2rlumonu4aetnmr3iytfpD  neilt trurxrpnydlmtnmfeil(faDumu poo4tpen ociydfm2el(mp t4 ltnio3iadfmtrlieol(0trtrxopnu1amtelict s)a2tru oou0apeo feiadls2ean o;u0aetrmrcoadfpDe i o t teuoir3iy1ol   nctat)srrr( oot4apt miciydfs ulnms;u0 etnxr iy1om eauvs;t)setrir iodamt mivtatfsrtr(moot4ope  ietltla2ulumo (0tltnxf3tadoa rlnes;()t2trir3no1llt  fvi t)sDtrx  ou4oeen oeiaslm2rauvo u4arxnmo oydlp  lieo s0srxrim3oydlltnlfvia(farraxrono0aetomiciyd sDumu p;(0 lxrxr3oadfp rlivols)seuo(m iy4op elnetl(  rtm(ro;u1tetoifcilslm2emums (4aexnxocoadopteau sls  etm(o ou1lmenmfetat)artru pou4apxnmfeiasla2rlnmpnt4 lermo3ootfm elieol(0 2tmim io1amee icil(fs2trur ou1tpxniiciytlsDrmuvp u4trxnir oadlm ran o s)t2tmimpny1opt licsa(  2rm( o;t1olx ii3iaslm umu s;()aexrifcoo1opDe i o s0s2xmir no4omenmict sfaDur(mpou0aeen i3iytfs2eanvonu0artoircoodfaDelnes t)seto(opno4ape lncsltfarurum ;o0apxn fcildlm rm(msn(4 rtrxf oydoaD  n o t0t2xmxm oy1apt  fvsls aDtax  ot4tpxo ictasfm2rlumo t0 eenmf3tydfmt  ivo (0setm(rpiu4lp e icsls sDtaurpou4oeeo f3ildfs2ua( s u4 rtoif3oatfp ean s t) 2tm(m3iodolt  fvi tfa2tr(rpnu4teto feiydlm um( s t)trxrmo3iytopD luei s  2trir ou4lle miciasfsrtmu pnu4tptoif3iad a rl(vs;()trtoxoctadlmt lneils0trtr(o ou4lptelfcta( sDta(rp;t1aee iieias a2emuvon()aleoio3oa1op r uvils0 euo(r nodomtn net ()s2tm( pot1opt  feiyt a2rm( p;u4alenxrcoo1la   nei;s0srxrio3no4alenmnciltfa2taxr nu0tleomi3iyt s el(mo t0 exnmf tadop rlues t0tetoxm3ou4ol nlncils) 2ua(rp;u1tee  octls m2eanmp t4altnxo3iotlmD  uvs;s0 rto(opnu4lptnmfctls)a2rrxm ;u4opt  oetlslaDemnmonu)tetrifciy1fm   ivolt0 etrxo iu1lmenmicsl( a2trurooo0oeeoiieiatls elnmp;u0altrmr3oatlate ivs;s  ruo(r nu1op  lfesas sDrm(rpnt1tpxoii3ilsfs elnvo t4trenmf iytomDeauvi;t  ruoxo iodomee fesl(f Dta(rpnu0ape  i3tytfs2elums u4alenir oydomt  u i ( s2urxo io1lm n ncs ( srua( onu4ope mieiadls2ea(vo;t0arxoxf oy1lmD  uvs s srumirpnudap e iei ()a2rmur ;u4oeen icias a ra( snt0aeenxr tytopDelivo;s0 etr(r nu4lmtnmfei ( aDtaumoot1olxoif3tldfmDumuvp t) reoif iodfaDelieo;t0s2uoxrpou4amtnlivsl(  2uaumonu1aptomieildlm rlnvp u4texoif to1optr ivsls0srtmxr oudol elfeiat aDuaumo;u4oetnio3iasls ea( pn(0aexoxo oodlptrlnvs;t)texrim iy4oltnmfcs ( artr(rpnu1tleoii3iltfa emu p;t) etrmfcta1lpD  ivils)teur(m nu1llt lnetas  rum( o;o1tpt  i3tys a2eauvpn(0 reomo3to1fpDrli slt0 2uoxopio4am nmfeilt  rurx ooo0tptnifetlt m2elnmpn(0 exnio3ia1fpDe nvi;s0t2toim3ny4om n ncia( srumx  oo0tetnifetadfs emn o;(4 rtrxo3tytfa   ivo () rtoio oy1optn ictat)srrru pnt0texnmoctltfaDeln p u4altrmo3ia1omD  nei;() exrir ou4altnlfvtlsf 2ua(mpou4tltn ieiatfaDuau sn(4tlenir3iytfmDeaivs;s) rtrirpoo1alenmneia( a2urumonu0tpxnii3iyd m2eau p;u)tetrir io1la rauvil()t2ur(opou4aptelnet s) 2tm(m nu1tpxn feiltls eaums t0trxrir ty1om   n s () rtriopiu4altnliet s)s2ua( o;u0tptnmieiad m2rl(mpnt) rerio ia1laDr nes;s) ruoxm3iu1ole  nvil() Dur(mo;o1alxniietadlsDelump;(4 etnmf3oy1faDe ivo (  exmimpny4am n ict sfsrta(r ot0tex  octld a eln pnt0tlerxr ootfpteliesls0seuo(m iu1ameelnvsat)a2raur ot1tlxomoetasfa2ea(mont0trxrmr3totfpDrlnes;(0t2uoirpnydam nmicias  Durx o;o0aexnmoctyslsDrlnvonu) exnio oy1oa e n o;s0s2urxr3iy1omee ivtl()srtruro;o0oexo ieiyt s2ua(mo u)tltrxrcoytfpt  uvils0setr(m3io1apt livsl( srtr(r ot0olxnmietlt sDrm(vo;(4artoir ta1laD livsl() 2xmir3ny4ll elivtat a2ua(  ;o0olxo ictldfm2eaumpnt0 lermfcio1lm rlnes;s)tetoir oo4lmt  ies (fsDta(r ot1oexo feiys m2emn p;t0trxrmo3oatoptrlivilt)srurxm3iydll n ncsltfa2ra(mont1tlxomfcildls el(ms;u0arerifciatfm rluvi;t trxoxo3oudlmtemneil()a2tmxro;o0oetomf3tyt m2emn p t4 lxnxocoa1oa rluvo;t)srtm(r nu1lmenlnviatf rraxr oo1alxomi3tatfs2emnvonu) lxomo oydlmDeli ilt  rxo(opiodlme miet sfarraxmpnu0aeenmfetadfm ul( s u4 ltrmf tatfpteauvo;() 2xmxm3oudalte fvsas)sDuau  ;o1texomoeildfs2ea(vo;t0 leoxrciytfpteanvi s0 rur(m io4om emncta( srtm(mo;u4apxoiictlt s2uln s t4 rerio3tadfat aivsl(0srtr(m3no1lmt micias) ruaumpnu0olxoio3iatlsDrlu p;u4 lerifcoatoatrli ol( teumxopnudlmt mfetlt) 2uaxmo;u0ope mieils m2eaums;t)aetnirciydop   nvsl(0trur(mpoodol   fetltfs2uaum nt0olx micils s uaumon()aexomocia1opDe uvsls0 ruoir3ou1lpeelicia() 2ta( ont4oeeomoctas aDemu onu) rtrmf oydom r n o t0 etmxr3oodap emfvtat)sruax pou1alx mfeiatfm2uau p;(4teermrcoydlaDeau o;()trtmir3ou4alenlnei tf Draxro;u0optnmo3tadlaDrmuvo;u)altnxo3oadoa e n o;t trum(m3nu4omenlnes (f 2rrumpot4opeoii3ildfm2um(vonu0teenxf3iydlpDeln s;s)t2trxrpiydoptnmnctltf rumumo;o4aptnif3iys a2emnmsn(4 ltrir3oatfaD  iei ()trxmxm3iu4optemnci (fsrurxrpnu1tpx  f3iaslaDelnvo u0 ltomo3oatlaDelnvs;t  2trim3nu1lptnmiesls a2ua( o;o1tlenmiciytfa2ulnmp (0texrxo oy1oa   ivs t) 2toirpnodlpenlicsl(f rtr(  nt0aeeomfciydfaDum(ms (0 lerxf oa1lpte n sl() eum(m3no4ol  lnetas  Dumumpou4aexomicildla eau ont) lxoxf oytfa  lueilt0seum(o ny4lp n ivi s) 2uru  ;o1tlenmo3tad aDra( s;t4tetomf tytlate nei;( s2urxm ny4lmeelies ()sDrrx pot0tpxoifeiytfa rauvp (4aeenifciytlpte i i t) 2trxo nu1om nmnct t  rrau  ;o4aeeo oeiydfm ulu p;t)altoxf io1omDr ueslt0truoirpiu4aptnmict (f Duaxr nt1openif3tydfa emu o (0artrxr tydlmDeluvslt  etrio nudame lnvsl(  Dumxm ot1tptoiieiltlaDrmnmp (4 eeomrcoatop  aueols) 2uoir nu4ope mics ( sDtau pnu1oltnmfeildfmDra(vo (4teermr ty1fm r neolt) rxoxr3oodam nlieia(faDuau pot0olt moeilt a2eauvs ()aexomf3iy1fm e uvs s0sexmxo nodlpeelietls  ruru pou4oltn fciltla um(mp;t0 rtrxr oatla   ues;t)s2xrim3iudopt lfvta(fa2uaumoot0olen ietad aDrluvo;t4aeerxoctadfa ranvs ( s2ur(m iy4lmtnmfviatfa2rmumpou1aexoiieils m ua( pn(4 ltnxrciytlmt  neslt0 2umio iu4apee fvtl()arrau pnt4oee  feiytlaDemump (0aexnmrcoodfaD  nvi;s seto(m nydap nliei () 2tru p;t0tpxnif3tyslmDua(mp u)areomfctydlmDelivil(0sexmxr3io1omt lnvil() rum(rpoo1tpenif3ild s rmu p;t0tlxrmf3oodop r neilt srur(o nudlpt  ictltfarraumo;u4alx iociatlaDuanvon()altriocto1opD lnvi s0setmiopiu1omtnlnes tfsrtrumpno0apx  i3tytlsDrau s (4trxnif3ty1optranvo t setoxopoy1lmtnmicilt)arumumo;o1oee ii3ilt a2ea( onu4 rtrxocoa1omDr uvi (0 2tr(m3nodapt livias s2tr(ro;o1texomfciat a rauvont4trenmf ia1oat auvo t0sexoxopnu4apte fctatf 2uru ont4aexo o3iadlaDulnmo;u4tleoxo ta1lp eaueols0 euoim oo1oleelictasf 2tmumont4olx  iciltla uaumo;u)artnirciotlmDelneil()srxrxo iy4ameemnvs t aDua(mooo4oet mf3tat a rm(vs;t0 lxnmr to1fm   u o;t0srxoim3ou4lm   ivs t sDuru o;o4tpt mfetldfs umnvs;t) ltomfciadlaDrlivols)sexoxm ou1lmtnmivtas a2rm(mooo4teeomo3iltfsDul( o () etomfcoytop elivs () rxoxm oudlp nmivi s arumumo;u4optnmictltfs uan p u4trtoif3iy1optrlivols) rtoxr3nudap e fes (fsrumum ot0aet iictysfa eauvo (0alenxr tadfmtr n o ( t2xmio3io1ll   ivs s a2truronu0oet  octldlsDeluvonu0alermr3totoa  ln i;s t2tmio iy1opt lieil(  2rr(mo;u1tet  f3iyslsDulnvs;t)alermf oytfptelieo s)t2xrxrpny1lle mnvs (f rurum oo4aptnmfctytfm2emu sn(4 rxrmfcia1late ues;s0trurxo3nu4ap emivta()a2tr( poo0texnmieiytlmDrmuvo t0 lxniocoa1fateai o;t) 2xoxr3iy4lmtnlfeslt) 2rrxmp;t4altomoctysfa2eln snu)trxrir oytop ean o;t) eumir io1ap e ici t  rtmxm no1ape mo3tlsfs2elu p;t4 etrxfcoa1omD au ol()setm(opiu4amte fesltfsrua(mpot1olx moeildfs ranms (4 rxnif tydfa eaies t0seurxopoodll n netl()srrmuro;o0tle ifeias m2eaums (4aexoxfctatlate nvol(0 2trxm3io4ll  mnesls)aDtau p;t4oexomoeiyd m2ua(mo;u4tlxnmo3tydfpDe nvil()srxrim3iy4lpenmnetl() Drm( onu1olxo o3ias a2emumo;(0tlxoxocootomt lnvolt0 eumio3oodape  neiasfa2rrx pou0tlx miciasfm2rlnvpnt4 etomo3tatfaDr u i t  rur(o3oy1lmtnmfet tf 2um(r ;u4tex ifciysla uln p;u0altniocia1fmDrlieo;s) rxoio3oodap  mnvsas aDumxmo;o4oetomo3ild a2rm( sn(0aetrifciadopD lnesl(0srum(m3iydopeelnvsasfaDurum ot4tpt mociad aDea(mp;u0 ltnmf3totoptrlneo t0 2tr(r3oudamtn ivil(fa2uaum oo0ape  ietyd sDeaumpnt) lxoxrciodfa  li o;s  exrxo ou1ape  fei sf rumur ;u0oltomfeiatlsDel(von(0tlxrir3ootomD lueil() rxm(r oodllen fesa() Drrxmont4apeomo3iadfm2uln p u4 etnmf3oadfaDr n sl()setm(o nu4omtemfcsat  rrmxro;o1aleo i3iasla2emu s (4tetrxfcoodoaDr u ils s2tm(m3ou1ol n ivta()srrrxm oo0oex mf3iadfaDeauvo u4 exrirctotlaD aueo t)seuoxopnudop  lneiat sDurx onu4tpe  ociydfmDulu on(0 rtrxo iotfatrlnvo (0t2xoir iu4apen ivta(fsrrmx ont1opeo i3ias m el(vsn()tltoxfciadlmD an ol(0 euoim3oydal n ictat a2tm(r oo0tpe  ocild s2rlums u0 rtrxr3iytfp  lnvols)t2toim oodole  nvsa(f 2rmurpnu0tet  icildlsDra( s (4aexoio3tytlmD au s;s0sexr(o3oo4aptemneias srtaxmpou1altomoeilt s2uluvpnt0 rtrir3io1oaDr u ils trumxr3nu1al n netl() Dtaumpou1apxo iciyt a ul(mo;u4arenif oy1fpDe neslt) etrir nudop nlfvs ()s2truro;o0altomf3ilsfa2umnvs;t4tltomocoo1lp  lu o ()sexr(m nudlm   ncsls)arrmx oot4apxnifeild a2emn sn(0alxrio3oa1fp eaies;( seumio oy1ap   icslsf 2rmur oo0tlx ioeiydla2umump;(0 etnmo3tatlpDeaieo;s0tetmxr iudop emncia()arrr(m nu0aleniicilsfa ra( o t4aeermr3iydop  ln i t)tetrim3ou4alt lncilt aDrmxrp;o4alxn o3iys mDrauvsn(0treoif3to1fmte uvols srtoirpnydlpe  ncslsfarta(mpnt0tet if3tytls2umu s u4aeermrctatfa  lu s;( srtmxm3ny1apeelicslt)aDrmu ooo1ope  fctydfs ranmsnu4altnxo3oo1optranvs (0 exm(o no4llen ieiat)aDtr(m ;t1oex ifetydfa rmump (0teermf oy1lmDeln sls  2xo(r3iydam elfvt ( a2rmur ou1apeomicilsfm rluvs u)tlxnmo3iodlmDraieo;t) rtrxrpoo4am   fvtas  rurum ;t1olt ii3iltls emu p () rtrxf3todoaD  uvo;( t2tr(o3iudapt lietls  2ra(m no0ale moctyt sDemn pn(4aexoio3oodfpt lu s t0s2umirpno4ol emnvia(  Dtm(mo;t1alto fciadfmDeln o t4arxrio3tydomDrln ols seto(m3ny4omenlnesltfartru p;t0teeomieiytfaDulnmon()aeerio3io1omDeaues (  rxmimpnodlmenlnvsatfaruax pno1alt  o3iasls rmnmp u4areomociadfatranvslt0trxrimpno1op nmieia(f Drax ooo1tetomfetyd aDrauvonu) rtrxo3tytfat au s;t)srxrio3nodlme  nci tf 2taurpno4olxnmo3tlt a rmnvp (4aeeoir3io1lpD  uvi s srtrxo3nu4llt mfvsasfaDtm( o;u4apt mi3tldlmDra(ms;(0 eenxf tadlm  lu s;()seuoxr3iy4lltemfvslsfaDtrxmo;o0tpen ietytlm emumsnt4aexrxocoatfmt  nvs;s t2xm(o nodam e nvilsf 2rrx  no0aee mieiltlsDra(vp (4 rxoiocoo1omDe ues s0tetr(rpoy4openlfes s) 2ur( p;t0ale ii3iytfa raums (4 exrio oadlmDr nei s0srxm(m3oudomt micsat)a2taumpot0oexoioeiltlm uluvsnu)aetrirctydlp elivols srurio3oudll  lnet t) Drax o;o4apxnifctysla emuvp u0 exnmrciy1fm r n ols t2umio3ny4altemfvtlsf 2rm(  nt0ole  i3iydlm elnvon()aeeomf io1lm   ivi;(0srumxmpnodlptelfcs tf 2rmx p;t1tlxn oeild m2ra( p;u)tlxrxfctatlmtr neo;s)t2xmio3nydll nlnvslsfs2rm(rpnt4aex  ieiat m2umnms (0 lxniocoydlpDrlues;(0 euoxrpnodamt lfeil(f rrm(r ou4aleoii3tadfmDrlnvo;()trerxf todfm eau ils)t2trir3oo1altn neilt)aDurxrp;t1tpt ioctlsls emnmsnu4alermo ta1lmtranei s) eto(m nydoptnmfcs t)s2trx  nu0oltn ocildfaDrlu p;(4tetrio io1opt ln i s)teuo(r oy4al eliesas) 2trumpnu1alx iociatlsDumnvo;t4 lxrxfcoa1fpDranvs;s0 rxoio ny4lp emncta( sruax o;t0aetn o3iltlsDrln o (0aeermo oydfa   ies;s0tetmxo iy4ame  icsas srrrum ou1olen i3iysfa rau p u0trtnxrcoodfateln s t  etmxo3iudom   nct t)a2rmxrpno4alxoiiciys m uanmont4tetomr iy1lmD auvs;t)s2uoir3oy1optemici ()arum( pou0optn o3ias s elu p;()teenxr tytoatraieols seto(m3oy1lpte neiatfsDtr(mp;o1aetn f3iytla rmn o ()aexoxr3ta1optraueolt0t2xoxr io4ap  livil()srrmum oo1openmfctlt m2rmu pnu0texomo3iodlaDe uvs (  rxr(opno4ame  ivta(fs2tmum oo1opxnmfcilslsDrmn s u0 eenifcoadopteau o;t0 rxmxr iu4omt mnvil(f rtax  nu0tetoioetat m2el(mo;u)altnmrciadlpt  iei;s)texo(r oy1optnmneils)arrm(mp;o4opt mfeiadls ulu on(4aeerir3iatla   ivi;() 2tmxm nydam  lfeslt a2ta(rpno0apx mfetyd s2ulu p () rtomo3totoate uei t0 rtoxm3nodolenmfeiat sDta(moou0tlxn i3tyslm2eanmpnt0trxrif3iotopt lu s;( trtrir nu1al n fei s)arra(mpno4teeo ieiatfaDra(msnu0 ltnifciydla elieil(  rxoxm3ou1lm elies tfs2tru o;t1apeomfctydls2rl(mo u4trtomf iotom elu il() rxoxr oydoltelnvsl()s2rm( oot0oeen f3iat mDumnmon(4 etoir tadfpDraiei s  ruoio3nodolee neiat) 2uaur ;t1olt  iciyslmDrmnvp;u) lxnmf3oadlaDr nvils)srtoxm3nu4alte neiat  Dur( o;o0aet  f3iyt sDumump;(4aetnmf3tytfaD aiei;(0 etoxrpou4lp  livslt)srrm(r ;u1opxn o3tadla rm(ms;u) reriocta1faDrauvi;(0trurxo3iy4om  mfeslt aruru  nu0oeeoif3iltfa2um(vs t4artrxfctydfmDran ols0srtrxo3nu1ameemiei ( a2um(moou0tlx mocild m ua( p u0tlxrio3ta1la e i o (0t2toim oy4om emivt t)sDtmxrpou0alx ioetlsls rmumonu0aexoxfciodlmtelu i ()seur(o io1al elieia() Duaumo;t0teeomoeiysfs elnmsn()aeerxf iadomDrai o;(0s2tm(rpiudalen fesa(faDuru pnt4oltomfeiytlsDuauvs;t) lxrxfcoadlaD luvs;t0tetmxmpio4opt mieil()a2taxm oo0oetnmfciysfm em(vpnu)tlenxr tadfmtrluei t  2umxopnu1ap emnetl() 2tmxr ;o0alt  ieilt mDem(ms;(0tlxoifcoadlmDelivo;s0teum(rpio1alee ivtls  2taxmonu1aetnmoeiydlm elnmpnu4arxoif3iydfm  luvs ()t2xr(rpiu4apenmnvtat aDrr(rpnt0texnii3iltlmDra( p;t0trtoif tytlpte n s () etmxm3oy4lpeemfcilt  2tmurpou4olxoioeiydlsDumnmo;t0 lxnifcoydomDrln sl(0 rtm(r3nu1lm emivtltfartrump;t0olxo oetldlmDumnvp;t0trxoiocoo1lpt ln ilt)srxrim iy4am  mfvi t  2umx ooo0tet mfciysla2ulu o;(0teermf iotlmt livi t)seurxr3oy1amt miei t sruaxr ;o1alt  f3iasfmDelnmpn(4alxnxf iadomtraies ( sruoiopiudapen icsat a2ta(rpnt1opto ietlsfa rl(msnu4alxrifciytfmt livs t)texmim oydap emieils a2raurpot1ope iieiys sDumn snu)treomf oytomD aiesl(0trtmxr3oo4amt  nei (fsruru  ;t4aleomf3ild sDrlumsn(0tleoxo oytfatelnvsl( s2ur(rpou1ol  lnesls)aDtmu pno1tle  fctyt a2ua( p;t0 reoif io1fm   i s;s)tetrxrpoo1apt lnvsl()sruaxmpnu1tpt mf3iasla2eln p u)alenxrcia1omt  neo ()t2urir oodapeelfesas sDumu oou0oltnmf3iltfmDrln on(4altrmfciytfaD li o ( s2xmxr3iydlltelfvsa()arrauro;u0opeo ietatfa rl( s;t4aetoxfcootfmDelneo;(0 rxrir io4lle lnvsl(fsDtrxronu4altniictytla emuvs (0 ltrio oy1fpt anvi (  rtr(m3oy4amtelnetlt)s2rrxm no1tee ii3iysla2um( s (4tlxnir3iadfmD aneil(  rxr(m nu1lmt  ivsl( aDum( pot1tltnifetytlsDumnvs;u0texnmr ta1fmDelnvilt0setm(o3no1lm emivt tfa2trum ou1oexoifctlsfs2emn s;u0texrmo oo1op  an sls)teto(mpoo4lmtemfes sfs2ta( ooo1optomfeildfa2rm(mp;u) rerio tatfm   ieo;s) etrim3no4lp nlfeil()aDur(  no0oetoioctysfa2rmuvp;t4tetrxfctadfm  lueo s t2tr(mpiy1opee iviatfaDtrumpoo1oleoiociydlaDranvo;t0aeerio totfpt  ieslt)tetrxo iu1omtnlfvsl()a2trx p;t1oee if3tls mDulnmonu4tetriocoa1lp  anvilt s2xo(opio1lpte feil( s2rrx oot0tptnii3tydfs2uanvsn()texnio oytlmtr i il( seumxr iy1aleelivta()sDra( p;o0aexnii3ilt a2emn snu4tlenirciy1fat aues;() 2tmio nydolee nctat  2tmuro;t1texn oeiyt m umnms t4 exnxo ia1lpt auei;t0sexm(mpnydapt  ncsl()sDtaur oo0aexoifeildla umu sn(0 rtnir todop e ieo;( s2xo(opnodlltn ietas artmxm ou4ole ioctat m elu pn()trxnmfcoy1fp   ueo;t0setmio3no1omeemict s) Dtaumooo1tpt mf3iatls ul( p t) ltrxoctadlmt lies;t) 2urxm3nudoltemfet (  Drmumpno1tpeoioctysls ua(vsnu0aexniociy1lmDranvols)sexoim3no1alenmiciltfs2um(r nt0aeeo ociys m um( pnu4teeoxfcia1lpte n s;(0teumxr3oydll e fvsl(faDua(r no1ope  i3iatfa2uluvont0tlenxfcoo1om rai o ( srurxr ou1lp n ieils)aDuaxmpot0tlt iieiytlaDemump;t0arerio tytom eli ols t2xrim io4om  licsltfsDuaxm ot0tee iictyd a uluvp;u)aleomo3oytlpD lnei ( srxoir ou4ome mfvtas a2rmu ont1aeen ictasfaDulump;u4treoio oodlaDrlu il()s2xoxo3nudomtnlneias  rrr(mp;t4tptomfcias s2em( o;t)aleoif tatopDe iei () etm(rpnydlme  nvsas)s2ur(mp;u1alxomieiadfm um(ms t0 leriocia1fm r nvs s0t2xmiopiodll n nvia(fsrtm(rpot4teeo ieilt a ulnvo u4tlermr ootopDrln s;s0trxrim3oudamt mfesl(f Dtaxr nt4tee ifciadlmDelnms (0alxrxf iatoa  aivi;t s2trimpou1ll e fctatfs2rm(ro;u4tex iieiatla2umuvsnu4teeomrciytlaDelivi (  euoxmpiudame mnei ( srrm( pou0olxoio3ilsfaDuaumsn(0teeomfciy1oaDe u s ( s2tmxm iydlp elfes s) rumxro;o4texoif3tydls umums;() rxoif3iotlmteanvsl()srurxo oudopenlnesltf rurumooo1tlto o3ilsla uau p;(0 lxriocoodoptr ivs s)srum(mpnodlmenmfetlt  2umu pou1alx io3tasfa2umnmo (0 exoio oadfmtrlues;()t2xr(r ou1oltelfct tf 2tr(  ou4oetoifeildfm emuvonu0tltnmr3ta1lat  uei s)s2xoxm nu4lmenmivia(  2ta(mooo4tlt iiciat aDumnvpnt)trxnxr ia1lmteanvo;t t2xm(rpoudam elneilsfaDtmu o;u0tlt mf3ils sDuanvs;()alxnir ty1fmtrluvo (0srtmxr3iodaptnmncilt aDtax  ot1tptnio3ilt aDra( snt)tlxnmf oatom  li slt0sexo(m3ou4am n ncs ( a2tmx pou1oltn ictasfsDra( s;t4 reoxr3iatfat  nvs;(0 2ur(m3iu4ll e nei s  2rmx  ou1aet  o3tysfmDelumo u)altrmf tatfmDeau s t srumxopno1omtelfeilt aDum( o;o4tpxo iciytlsDea(ms u)alxnxoctatfptrlivilt) 2urirpiudapee fesl( a2urxmono4aetn fcild aDemu sn()tltoxo oatlp rln i;t)s2to(rpoydopt mnetas s2trxro;o4tpt  fciatfa2ua( p u0 eerxr tatfptelies;()s2tmxm3ou1altelicilsfsrrmumpnu4tee if3iaslmDelu o u4aeerxrcoodfat lieol() rtr(m no4lpt livtl(faDraxmoot1tleomietyslm umnvsn(4 exoxr totfa eanvsls)srtrir iodlm  miei (farumxro;u0oleo ieiltfmDrlnms (4aetoxfciytoaDeaivi t)t2xrir3iu4omte neiatfaDuaur nt1alxo oeiad m rmnvs;t0altniocty1oa e ies;t  etoim3oy4olte fet (fsrraxmo;o1apxniocild s2emnms u)aetnxf oydfmD lnvils) rtoxrpno4ole licsl()sDtrurp;u4tpeomoeiadla2ul(vo u4alxnmfcoy1om e nvolt)s2xoxm oy1lmeelivsas sDtrxronu1aetnmociatfm uluvs;(0 rxnifciatfptr ieo t)truoxopoo4ole lfvtltf rtauronu0oexniictad aDemnvp;t)texrmf oo1fat luei;s0seum(m nudom   nciat)arrr( poo1aeeniiciatfa eanvo;u0aeenmf3iodoatrlues;t seumimpnu1op elicil(  2rr(mp;u4tet  feiatlm2elu snt) rtnif3todoatr n sls  2uoxm3iodal elncslt) rrmurp;o4oltomo3tltfm um(mp;()texnmf3iatoatr neol(  exrxr3ou4ome  ncs ()s2taum no0olxo f3iys m rm(mp u) etoxr3oodom rauvilt0 etoir iy1amenlnvi ()aDumxrpnu4aexnifeiasfs2umnvo;t0 lxnxfcty1om  lieilt0s2uoxopiu4lltnlivtatfarraxro;t4tptnmo3tytfa ean p t4 rtrxr oytfmt anvs s)teurio no1lp   nvias)aDra(  nt0tlt iociatlm2emuvpn()teenmf oytlatrlivs t) rtrir nydaptn ncs tfa2taumpno0teeomfcilsls ulnmpn() eeoifctydom rlnesl(0 rxoim oudlpe lici t  rumxr oo4teenii3tatfaDuan p;t)tlenmrcoytfp  lu o s)t2xriopoo1lmte fvias)sDtmur ;t1tlx ifeiadfa2um(ms u)areoir iadfaD  uvi;( s2trxm oodlm   neias)srrru ooo4oex iieiysfs rl(ms;u0tetoxfcty1fatr ieo;s0 eur(r3oo1oleemietas) Drm(  ot0olto fciat aDumn o t) ltrir oo1lateauei s)s2tm(o iu4open ivtas)aDrm(mpou0oleoifetadlm2uluvpnu)arxoif tytopt  nvs t trurir3oo1ap emfctls  rua(mo;u1alxomi3ildla rmnvp;t) lerxf tydlm  auvol()trtmir3nu1oleemnvt ( aDta( ono1opt  ieiys m2um( p t4trxoxf3oatfpt  n i s0tetr(opnu4openlicslsf Dur(  nt0teeo ociydfa elnmp t)alxomfctytopDrlieilt  2xmxrpou4ol emivta( sDumx  ;t1oltniociytfm2em( p;(4alermf3iotlpte nvs;s0 2tmir3iy4op elics ()aDuaum ou0altnii3tlt a2ea( pnt0arenxrctydomDr n ilt  exm(m iy4am  mfei (fartaurpou4tlt mictasfa ua( o;(4tltrxfciodfm   uvo ( srxoxo oudoltnlnctat)arraumpou1tptomoeiadfm umnvp ()artoir oy1fmtelivi;(  exr(m iudol n ivta( aDrm(rp;t0opx io3ils sDumn p ()aeerxr3tytom eln sl()srxoxr oy1ame mfesa(  rtrx  ;o4aee ifciysfs em(ms;t0 rtomo iy1fate ieil() 2xr(o3io1om  lfes s)srtauro;t0olenifeiydls2um(vp;(0 reoxoctadomDr ies s) exrxm iy1lmee neta( srrmxm ou0oetomfeils a2rlnmonu)altnmr3oy1omDelnvi s)teurio iy4lmt mivils) rtr( poo4tleomf3tas m2uluvon(4 ltomf iodlmteluei s  rto(r3io1apte nvs (  ruaxmp;u0tpe ioctyt m2umuvonu4artnxrciotla ean sls) eumxr ny1lleelfct t)arua(r nu4oeeoioeiat m uluvp u)teenmfciodomDelies;t) eurxmpnydll nlneilsfartax  ot0alt  ieiysls2ea(mont)aeeoxf iytoa   nei ( s2toxm iu4altnmfvia( srumur ;u4opeomoeias mDelu s t0aleomocoodom  aueo;t0srxr(o3iydllte fet s  Dtm(rpnt4tltomoeiysls rln p u4alxnxf3tytlptraieilt)seumxopno1lpt  nesatf 2rauro;u4aetomf3iys s rmums t0tlenmr3to1latelieil(0 rtmxr3oydlltemictl()a2ra( oot4openif3ildla elnmpnt0aexrxo3iy1laD aneols)t2trxm3oodll  lfctat aDumxm ot1oexo oeils s2rmnms;()teeomrciodfatr nvolt) exm(opio4ape mncta(f Drmxrono1texn ieilsls2ulu s u4aexnxfciatoa e nvils0trurio oodamt  neilt  Dtrx  no1teenmieiatfsDran p;t4tlxnxociatfmtr ivo;t0 2toio io4amtn nesl(faDum(mono0tptnmieias aDeaumo;t0tlenmfcoydfptrlnes;s teuoxo nu1omeemicslt  2tm(r no1alx moctadfs2ean p u4aetnmr oatlpD  ies s  exr(o3iu4optnlfct ( aruaxmooo1tet if3iydla raump u0 lxoio3iatomDeai i;t)t2urxrpnydopenmfetl()aDtmurono1opt mo3iysfa rauvsnt0arermo oa1omDranvsl( texoio nu4ope lfvias) 2ra( pno1olxo f3taslaDumu o (4tltoxf ty1oatr i s t)t2xo(o3nudllen netas)srumxm ;t1oeenmfciatfa2ua(mo u4alerxfcta1omD aivo;( srtoio oudoptnlict t)aDum(m ot0tpen fcilslm2rluvonu0aetnio3iadfm   ivo;t)sexoxopnu4ll nlfcslt)aDua(r nu1texnif3tad aDumuvs;t) rtriocootfatrau i (0s2trxmpnu1am   fctat)s2uaxm ;t4opt mietat a emu s;t0 eeoif3iotfmDeanes t0 2umim3ny4lme mieil()aDumum ;u1alx io3iysfs em( s;(0 ltrmfciadlp rlneo;s srtoxmpiu4am e ivt s) 2tm(mp;u1oeenmo3iydlm2rlu p;u) rtnxf3tytfa r i o t  exoim iydom e feilt)a2um( pnt0aeenio3tadlm umu on(4alxomf tatoaD ai ilt0 rtrimpno1opee feia(faDra(rpno4tptnmoetadfs2um(mpn(4 ltrio3oy1laDelneo;() exrxrpiydame  ivtatfsDumxr ot4tetniiciys s2uanmo (4 eerxfciy1fp eau o;t0 2tmxr ou1al nmfeiatfsDta(mo;t0tlxoiictad mDumnvs;t4trtnxoctodfpDeanvs t  2uoxrpoo1ape liet ( aDtmx ono4ope mieiltfa ua(vp u4areoxr3iydfpD li ols t2umxr iu4ale lfvt t)srraumpnu1teto i3iysfmDelump;t)aeenircoatopt  u s;s)teurxopiydomtelnet sf Durxm ;o1ole ifeiyd s rmumpn(0teerxr3tydlmDr nvs t)tetoim3iydlm n ieil(f 2uaumpot4tlxniocilsfsDemnmpnt0aexrir3oo1lptelivi (0setmir3iy4op nlivs ()s2rrxrp;u0olenifeiys s el( pnt) exoio3oatfm eluvo ( trxoim ny1altnmnes t  Drrumpot1oexniictlsfsDua( p;u0 rxnxrcta1lmtr ivi (  2xmim oy1amee nvils  2rm( ooo4oleniieiatlaDra(mon(0aexnxocootop rli ols t2tr(rpoy1lm   fetls a2tr(rpno0aleo o3tadlm rmnmpnt)texrxfciotopt lueo t  rtoirpoydllt lncil(fsDur( pou0altn iciltlaDemump u)altrxo3io1fatrluvi;t0truoxm3oy4op nmfesa()a2um(rono1oetomfctldls ran p t0 eeomf oytfp raneo;(0seuoiopoodopte ici sfaDraxmp;u4tlt mfetadlm2rlnmo ()alxnio oo1lmt ln o;() rxriopiy1olenlncsa( a2ta(ront4tetnmieias mDrau o t0 reniocta1opD lu o;(0t2trir3ny1olt mietlsfa2ra(mpnt0opx moeild aDemuvo t)trermfctydfp   uvs t texm(r3nodam   nvil()a2rmxm ;u0texomietas a rauvs;u4alerio tadfp  lnei s0 eur(opny1lle lictl() rum(root4tpxnifetydfm2uaump;(4altnir oodlm e ivo ( s2xmxm nydal e fet s s2urx poo0olxniociys aDeanms (4tlenmrciotfatr ivol(0 rxm(m3oudopt mnvs t)sDrm(mpnt4opx iocild a el(vo (0 rxomrciatoaDe neo;s trurim3io1ameelivsltfaDraumpot0aetoifeias s rlnvs;t0 rtnxf todlpD livs;( s2toir oy4openlnetl(  rtr( o;u4olenmi3iadfsDuaumpnt4tlenir3oodfpD an o (  euriopio1op elnctlt s2taump;t1altnmfeiytlm2ranvs t0 lxoiociydfmD aneolt0trur(rpno4ll   nvt s)sDrmxm oo1tlxnii3iyd aDel(mp (4texnmrcia1lmte ies t  eurxmpoudom elivsls)sDra(mo;t1ole mfeiysfa2rmu p (0 lxnmfcoa1lmtrluei (0 2uo(opiodol n ivs t)s2umxmpnu0tlt ii3tatlm elu s;u)arermf oytfptelnes s)tetrirpoo1lmeelieslt)a2urxro;t1tltomf3iasla2ra(vo () rxnir iydlp eaues;t0s2xoxrpoydlmeelnct ()artmurp;t1tetomfeiydfmDel(vo u0 rtnir tadlmD  n i;t)sruo(r ny1llt lnes t  rtrxmpoo1oexomfctls sDul(vo;t)tltoif tytoa raieols teuoxo nu4optnmnvtls arraump;o0tlx  ictytlm2uaumsnt4 rxoxo iy1lp eaues;t trumim3io4amenlfciltfsDumurpou0tltoiieiyt mDra(vo;u0 lenxo oydom e i s;s0setoxo3ny4lm emfetlsf Dra(rpoo1opx ifciydls2uln p;u4artoxr iy1lp rln sls0 rtoxm iy4llen ieia() 2trurono1optniictlt m2ran p;(0aexnifcoodop r u ilt  etmio3iydlptn iei (farrm(m ;o4tlxo iciltlmDemn snu0arenxr tytlm elneil(0srxmxr3iu4ap nmivs tfsDumx ono0opeomi3iyt aDulumpnu4arxnxr3oodoa elu i (0 exoxopiodalee nvils  Dum(mont0tlxnifcildfaDrmnmonu0aeenir oy1omDr nvs t0srxoxrpnu4apt  fet s) rtr(rp;t0texoif3ils s rm(vs;u4 rxnmf iadlaD anes t seuo(mpiy4ol e ict ( aDum(  nt4apxoif3tatlmDumn p u4 eeoxf oadoa e uvolt0s2trio3ou4omt mfeslsf rumu ooo1aetoioctydlm ulu on(4 ltoxo3tydoptraieo;()s2uoxm oy1ameelnei ( s2tmum oo1tptnmocilsla2rmumo;(4 exrxr iytlp   nvo t0s2uoirpoydlp e ncs t srtm(rono0alxoif3iysfmDeln o;(0alxrmr tytfpt aivols) rxmio3oo1omtnlfvil()srua(rooo0tetnmo3tls m rln on(4 exnxocoy1fmD  uesls  exoio3ou1op n ivtlt aDtmum ;o0opx if3iyslm2uanvp;()alenmfctydfm eaueo s srtr(m3ou4aleemfvtls  rtmu oou4oeto fciytlm2ea( o u) etomf oo1fatr nvslt)sexrxopiydlpte ivi t)a2um(mpno4alt mfciatls2emu s u0tleoxo iodlpD au s;s)trxrimpoy1lmt  fvsls) Drr(rpno0aex  f3iadfm2umnvpn()arxoxf oo1fmDeaivs s)sexoxo3nydale liesat  Drr(m no1aet ifctydfsDuln s;t0 rxnxo ootoate uvs ( t2xoxmpio4opt lictlt) Dururoou4aexniieildfs2elnms ()aexrmf3tatlaDrlues ( t2xrio3nydop emfvt s a2tr(rp;t1tet  ociydls ran on()tetoio totfmDr nei;(0 rxrxr3ou1lm nlfvtasfs2rrxmooo1teen ieiys m umn pnt0tltoxrciadfaDe n i;t0 rxmxo3iydll nlnet (faDtrum oo1oeen oetydls2rl(vs t0artrio oy1lm rlivolt) eumxr iu1ap  mivi ()aDum(r nt4olt iiciltla2eau onu4tlenxf3todomtrlieols  etm(rpoo4llt mnci t)artmxrpoo1tee mo3tad a2eanvont4 lxrmfctydomDeanvi;s teum(o oo4lptnmfvi t srtr(mpnu1tleo o3iasfm emn o (0 exnmr3oytomt an ol()setm(rpiu1ope mfvt (fsrtmum ou4tptnif3tys m2rm(mp t4trtrxrcoadom r n o () ruoio oy4optemfcias aDrr(rpno4tle  oetadfa rauvp u4 lxnxo3tatopteai i;s)s2uoio nodam  lfvt s sDta(  nt1oetnmoeiytlmDrln p;(0arxnif3oodfa e uei ()t2xoxo oy4omenmfei (fsDta( oot1tet  iciltfm2um(vs u)trtrxf oatop rau ils)trxo(mpiy1llt mnciasfs2trxr no4tpe  oeild m2umump (4 rxrio3io1lp elnvi;t trtm(m3io1oltnmnvs sfa2ua(mp;u0tex mf3iltlaDeauvo u0trtrmf iy1lpDrluesl()t2xo(mpoy4ole mnet t arrau p;t1tlxn feilsla2rlnmp;u)areoifciy1op   neo (0teurxr nudam   ivilt s2umu p;u4tpx mfetltls eauvon()trtrxrciytfat  i ols  rxrxo iudlptn ncsat)aDtau oot1oeeo octatfs2emuvonu) ltnir oatomDr ivs;(  rtoxo oudlme  icta(fa2tmxm ;o1tptoifciydlaDuanms;u0 etrif3io1fa eln s;t trxmim3nu1lme  ieiltfsDtrum nt1tpeomfetatlm el(mp (0alxrif to1lmtrluvo;s  rumxrpnodalee feilsfa2urx pno4tlt ioeild aDulu s ()tlxrxfciatlpDraivs s)s2uo(o no4ll e neia(fs2rau p;o0oex  oetatfa2em( s;t0 leoif oy1om  aivsls)s2xoiopiydlm nmivtas  Drrx onu0tpt mi3ilt a2rln p u4 etoxoctadop rlues (0t2um(r3ou1apte ivsas  2tmxmont1tptnii3iasfm2ea(monu0aeerioctydfp r uvs;t  2tmir oudap  lici t  2rrxmono4oleo octltlsDel(mpnt4 reoio oatlmDeluei;t)srum(o3ou1openmncta(faDrrumoou1tpt mo3iltfa ea( o (4aeeomfctodfaD liei t0 rto(m3iy4lpe  nesasfarrax o;o0tpto ieiytlaDrl( p ()tetoxf3oadlmteaivo s) 2to(m oy4am  lfvi t a2um(mp;o4teeoiociyd s emumo;u4trxoio3tadfpDe nes;(0trtr(mpnodole mfcils) rum(  nu1tet mf3tldfa2rmnvsnu) eeomo3ty1la rlnvo s)setrxm nu1lpen fctl(  ruaur no0texomo3iyt a2ul( s;t0aetnirciotfm e uvo s)trtrxrpnudlmeelictatfsruax ooo4tleoii3iydfmDuaums;u4 eenxf3oytoatrlueo;s0texmxr3nu1apte ici (f Durxrpno1tlenmieiydls uanmpnu4trtnxr3ta1lm rli sl(  2uoxo3iy1lme lnvtat a2tr(r no0apxomociasls2rl(mpn(0 exoxrctodoatranes t trxm(o3io1olee fvs t) Dta( pot1aleoioetasfmDul( p ()treoif3iytlp elieolt s2xr(rpoudopt mncsa() 2rrxmp;o0tlenii3tas m2rl(mp;t0arenxociatfm eauei;()s2um(m3io4ol   fcsas  Dtrxmooo4oeeomieiat sDraumo (0teeomf oadop  an o t srum(mpoodamee nvs t s2rm(rp;o1teto f3iadfmDrlu snt4 etnmrcoa1lpDeauesl( trtmxm3oy1ll nmnetlt)a2rm(r nu0oexoifciltls rlnmo ()tlxnio3oadop  aneo s srtr(r3io1am  lfet tfsDuax  ;o1teenmi3tld mDeauvo u4 lxoif3iy1fpDrlues;t) exmxrpiudap  lnvtl( artaxr no0tpto icilsfa ul(mo;u0aleoir tydlm  livsls srumxm oo1ap nmnetl(  Draxrpoo4tlt  ociyt a2rlu s;t0 rxomf tytomDr ivo;(  rtmim ny1al   neiat srrau  ou0tlx if3iadfm2elnmp;t0trtrmr totfmt  ieslt tetr(r3ou1altnmfesasfs2rau pnt1optomoeiysla2emu s;t) reoir iotomD aieo;t0 rum(m oy4optelfei ()artmu oot4apt moeiytfmDulnvont4alxoif3todop e i s t) exmxmpio1al e ivi tfsDum(mont1oeeomi3tytfmDemnvs t) ltoif totlaDeaues;( srto(r iodol elnvia(  rtr( oot1openmoctytlmDrl( o;t4trxrxfcty1fptrliei s  rtmxmpoy4opt  nvsas)s2tmx o;u0tlen i3tld mDulnmo t0 etnio ty1fmDelu ils  eurim3ny1am emfetl( srrm(rooo1opeo o3tlt aDrmuvp;u0texnxr iotopte i o;(  2to(m iydlpeemivi sfs2ra(mp;t1tpxn i3iyslsDuanvo u4 eerxf3oadlmtrauvs s0t2xrxr ny4apeemivt (faDrr( onu0tlt mfctls m uanmsnt0tetoif3iadopDeaivol(0s2umxo3ou1am  lics (farrauro;o4oeen octltls2rmu p;u) rxrxo3oo1lpDelnvi (0trtriopny1omtemnciat)arua(r ot4opx ioctys m2ra(von(4trxoxrciadfmD ln ils t2uoio3ou4am n ictls)artmu  ;t4tptnmfctydfsDum( s;t)aexnxr todom elu o;s0truoimpno1amenlnvt s sDrm( pnu4tpxo fctyt aDulnvsnu4 renxo ta1lmte nvi s0 exoxmpiodam  mfvt t)s2rau oou1tptnmfctatfm2um(vs t) etrif oo1fp  anvols0texo(m3oydlm n nvtl()srta(m nt0oleoio3iytfmDemnmo t0trxnxo tytlatraivo s)t2umiopoudlpen fvtls s2ua(ronu1opto octyslm rluvsnu0 renmo3io1oa  ai o;s0trurxmpnudlltelfes s) rra(r oo4tlx  f3iltlaDea(msn(0 exrxf iydfa raivols) exm(m nudopt lfvs sfs2taum nu4opt mi3tydls umn pnu4alxrxocoadlmD lnvs;s)teurxmpiydape mieias  rrrumooo0aexomoeiytlsDua(vo u0tetrxocoytfmtelnvs t) 2xrio3iy1ll  mfviasfsrtrxm ;u1oex moeiydlaDrau sn()tlerio3todlatranvs;s t2urxrpnu4opt mnet (fa2raxroou1ope iiciltlsDumumpnu4 rtoircoadoateln s;(0srtm(r3io4ale  nct sf 2urx poo4alx  ociydfsDulu s (0trtoir3iytopteluei;( tetmiopoudome miei s a2trx o;u0tlx  f3tldfmDul(ms t4alxrirciytfatran i;() 2triopiy1am e fetatfs2trump;t4olxo oeildla rauvs;(0alxnmf to1opteaies;(0 etoxr nudap  lfcsls  rrm(mont0tpen f3iad m2rauvs t0 rxoir3ta1fa e uesls0texoxo ny1apenlics ()s2trx pnt1altomoeias aDua(mp () renmrciytfpteai i;s0trum(opoo1ome lnetls aDuaumo;t1oexo oetadls2rl(msnu)tlxnxfcia1lp rlnvilt0 ruoxm iy4lmtn fvs ( aruax ont4tpeniietyt a em( o u0arenmo3iatomtrauesl(0trxoim ou1lpen ici s artm(  nt1texoiieilsls2ea(vp u) rtrmr oytlatrlueils)trxr(m3iu1al  mnvtl(  rtaxmpnu4alx ifetlsfm2emn pnu0trermf oodomDranvo t trxo(m iy1ape  nvt ( s2tmx pou1tlt mociytfs ulnms (0texnmf3oatfmt au i t  2xm(o3oy4ap elncsl()s2rm( pnu1opx ifeilsfs2ranmpnt0aetoio ty1fp r uvi;s0texmir3iy1ame mnvt () Dtm(  ;u1tpto iciatfa umumpnt4 rxoir3tytopD lueo;(0 exm(o iu4lm nlictl( arum(r ;t1alx moetytfa2ranmsn()treoxr tydlpDeauvs t) 2um(rpiudomeelfvia(fsrra(rpou0apxomieiyt m2eau p u4tetrxr todlmDrlivi (  2xrxr3oo4olt lfvta(fa2rrxrpoo4tleoii3iysfm2ul( pnt)arermfciotfa elu s;()s2tmxm iodll nlivi () Dtrx  nu4tlx ioctlt m2ea( p;t4 exnmr tatoaD  ivi;t) rumxmpoodopenmneslsfaDta( ooo1aet  iciatfaDra(msnu0tleoio3todopDeai o;(  rtr(opio4omeemfvils)s2tm( oou4tet  ociadlsDrm( ont4aexomo3tatoatrln sl( tetr(o nydop e ivtl(  rtmum no4opeomfctadla ua(vo u0alxrircoo1fatelnvo t  rtriopoo1open nvs tfsrtmxmont4texoioeiys a uan snt4 etrxf3oatomD auvolt)srurxr3iudlmtelnvi ()s2tm( p;t4oexnmf3ilsfs2elu p;t) rxrmr3ta1fm  li i t0seuoio iy1alteliesa()sDrm(r ;o4opxn fciadla2ulump;u)alerxf oa1la e ueo t) eurimpio4op nmivt sfsDra(mooo0tpe  o3iatls2eau ont4 etrmo totfm r nvols sexm(r3no1amtnlfcsat srrmxmp;u4ole iieias a2ul( p u) eermfcoodfpDe u o;t srxoim3ny4lpt mnvtlsfsrraxronu0aptniociyd sDrm( ont4trtoxr oatfaD aivi;()s2xoim oy4amen ncs tfaDurumono1tleniietaslaDumu s;()aeermf iodlaDelnesl(0teum(m oy4op  mfesasfaDum(  oo4olxoio3iat a2rmu p u)arxnmr tatlp e nvi;t0s2trir3no1amteliet () rum(rpoo4oetoiociytfs rlu on() lenmfcoodfm rauvils  eumiopoydop e fvia()srrmuro;u0tpenifeiltfmDrauvpn(0tlermfcty1fm ranvo;s0t2toxm3iu4optnlivsat sDrax oot1oex  feiatfs umn s t4 reoif ta1opt aies;(0srur(r oy1lm emietlt aDumx pot4apxnmf3iltlsDel( o t0treoio3oodoateau o (0teumxo ny1ol  mfct (fsrumum oo1tlxnmiciasfs2ulumo;u)tltrmf ia1opDelneo;(0trurir nydlpeelfvt (f rrmx oot1tpeo o3iysfs emnmp;t4arxnmf3iy1fmteau i s sruo(r3iydalenmivtasfaDrmx p;t4aeen ieiytfmDuanvp t4tetnmr iatlm ean i s0t2umxo3iy1lm n ict ( a2umxmpot1teeniietltfaDel(mp;u)aeerir3oa1lmD  n ol() eurxopiy1ope  neias) rraumooo1tlt ioeiaslm rm( o u)artrxo oo1fmD  uvs t  rxrxo oy4al nlnvt sf Dua( oou4aeto ictydfm umumo;t4 lxrxr iodom e i il() 2trim3nydlleemfvta( sruax  ot1tle if3iys aDuauvsnt) rxoxfciodlateaivi s)texo(m3nu4al  lnvt ()a2rm(moot0optoiieiltlm ra( o () ltrif3oo1op e uvo;s)t2umxr3ny1olt  nvs s)s2umxmp;u4tex ii3tysla2ulumo;u) eenmr3tydlpDeaues s0 rtmirpio4apeelncta()sDum( onu1tetniieiadlaDumu pnu)alxoxrcoodoa rlueo;t  etm(m oodll emicia()s2rr(ront0aee  fctldlm el(vs t4tetnmo3ta1fa e neo s) rumxm3oydomte ieilt  Durx p;t1tpxniociasfm rlump;u)tltomo3iy1opte n s;()srurxo3ou4optemfvtl(fs2trumpot1alxomoeildls2raumpnt)texoxo ta1fa ean i ( s2tmiopoydam nlneta(f rumx pnt4apxo f3iys m2um(vp;u0tlenmf ta1omDraivslt texo(r oy4alenlicsa(f 2rm( pot4olxoio3tadlsDem(msnt4aetoxf oytfm   ivs t)t2tm(r3nudal elivs (  Dtaurp;u1ale  fcildla2elump;t) eeomo tadfat lu ils0sruoim nodam  mnetasf Drm(mp;u0texomociltfaDua(ms;()trxnmoctatlmt  ies t  eumir3oo1lp   nesa( s2uaurp;o4tltn fctad a rlnms t0tlxnmrctytlm  auvolt0 rxoirpnudapt mfct (f 2tmx  ot1apenifetasfa emu snu)artrir3oytfa eauvo;t)trtoio3oodap nmfetat  rrr(r ;t0apenmoeiytlsDrl( o;t0tltrmr3ootfpteluvs ()s2xr(r nodamenlnvs t srraxm ;t1olxomf3iytfm2emumo t0 etriocty1fp e n il(0 exm(opiy4al   icslt  Dtr( o;u4olt iocilt mDuan o ()tlermo iatfmDrlies;t0 rxr(opoodoleemieslt)s2raum ot1oexo ocildlmDranmo u0aexomf ootomtelnvolt) 2urxr3iodom   ivt s) Dra(r ;t4alt  feiysfmDrmu p u0aetoif3oy1fmD li o t)t2xmxopou4lpe mncsls)srum(ront1alt  oeiys m um( p () lxnmo totlmD luvil( teurir3oy1ol nlfcs ()s2tmx onu1apt mociyt m rm(vp;(4alenxo3tydla e n s;s0 2umio3oodapeemiesl(fsDrrx o;t4ale  i3tysfsDemu p;u)tltoxfctadla  lneils) rxm(o3oudlmenmnvil( aDrrxr ou1oeeniiciltfmDrln s t0 rxoxrciodlpDrlnvil()seto(opoy4optnlnvs sf rua(rpou4ale mi3tad a rl(vp;t4 reomf iy1fmDeln sls  rtrir3ou1aleelfvs (fa2umumonu0altomfctaslm rln p t4 ltnio3tadlm raivs;t0srtmirpny1am elieta()sDururo;t1apen fetad mDul(ms;(4tlenmr3tytopD  iei;( s2xrxo3iu4aptn iei tfa2rru  ot1olen i3iatla ulumo ()tetrmr oatfmt  ivs (0t2xoxo oy4alt lnvi tfarrrxroot4opeomfetaslsDem( p (4aeermo3oydfpDranvol(0srum(r ny4lptnmnvsa(fs2umuroou0tpe iieiytfs2eluvo;u0aetriocta1fmD  n s;t0t2urxo3ou4oltnliviat  rrmurp;o0tet  feiydfm2ul( onu4aexnir3oo1fa   nei;()trxm(r3oydameemiet () Dra(monu1tlxo ociltfmDemuvsnt4tltnxr oatlaD anvil()srxoxm oodoptnmfvtlsf 2ra(roou0olenmfctas s uau sn(0trxrmo tytlpDrli ils0trurimpoy4openmiei ( a2ururpou0alxoifctls sDuln ont) rtnxr oadla rlnvs;t)sruoxrpno4alen fes t srrrxm ;t0oleo fctld a2emn o (0trxomrcootlpDeaueo;s  2xmir3ou4am  mncsl() Dururp;o0aex ifetydfsDum(von(0 eeoxo ty1oaDr ivsls)srxmxr3oy4lptn iesa()sDuaumono1tetnmietyslaDeluvont4 lenif3iytfa e uvol(0srxrirpiu1lpte ncs t) Dtrxr ;o0oeenmicilslm ul(ms;u)trenxr3iytoa ean s (0texm(opnodll  lfvs tf Dtaxmooo0altn oetasla ra(mp u4tltomrctadlaDr u s;()seum(o ny4lleemncils) 2raumonu0tex if3ilslm2em(ms t4trtnxo oodlaDrlivo;(  2trxopiy1ope  fes tfaDraumo;t0ape  oeilsfs elnvo t4tltoif3ty1laD anei (  2uoimpnu1lmtnlneilt)srtau  ;o1altoioctlt sDea(mp;(4 rxomfcta1fm r nvsl( sexo(mpoudlm e ivs s  2trurp;t4aetn o3iltlsDelu s;u)texrxf3oytfp elueo;t s2tm(r iy1om   neia( srtrurpot1tetnmo3iyd s el( p t)tlerxf3iy1fate uvs (  2xr(m oo1lmte iet s  rtmxrpot4alto ictatfaDumnmsnt)trerxo3iatlp rli s;t)t2xmir iu4ome  iesa( s2umuro;o1tlt moeiysfsDumumsnt4 lxoxf3oo1lm rauvs;()truoxm nu4lm  lici s) 2uau ont0tlenmfetyslsDrln o;t0 exoir tydfm  au s;s s2xrxopny1lm emicta()a2tr(mpou4altn ietysls rmn snt)tetrxf3iydlp eauei;s0srumio ny1lmtnlfesls s2rauroou1tpxo fciltfm ul(vp (4 leomociadla   ivi t)srxrxm3io4aptn fct t) rtmxrooo0aex iietlsls elu p;()trxrmrciytop rlieols0 eumio3oodlmtn nvi s s2raurp;u4tpxnifciadla ul( o;t0artnmf3oa1fmDrauei (  euoirpno1amen ncil()sDtrum nu0olto fciadls2rauvp;t4 ltnmo iydlpt lu o;(0srumxopiy1om e ivsl( aDtm( o;u1aleo ietas aDuau pn(4 eeoxr oo1fa   ieilt trtoir3oodom n nvt t aDrm(rpnu0olxoiiciytls ulnvo (4arenmr3oadfatr i ols srxmir io1lp  lnctltfsDraxrpno0aetn i3ils mDranvp u4 lxrifcty1lp raues s trxrio3iu4omenmfci sfsDur(rp;u4altomfeilsfm2rlnmp u4 leoio oytfmDeai ol(0 2xrxo nydlmte fvsl(faruaurp;o0alxnmicilsfaDrau p u0alxoif ty1fate uvslt0teumio3oy4olen ies t srraxmo;o4tlto feiltlmDelnvo;u)tltnmf tytopDeai i;()texmxrpou1am elnvtat  Dum( p;u0oeeniiciytfs2uau snt4 rxnxrciytlpte ues s0trtmxmpou4amt lncils)a2rm(r ;u1opt  f3tydlm2emnmo;(0tltrmocootoa  lueslt0s2tmir3iu4llt lfeiasfaDrr(m ;u1apxniieiytfaDumnmont4tltnioctydom   i o t)tetrxo3oodolt  icsasf rtmumpou0opxoifeiasfm eluvs (4teerxo3todla rln olt0truo(m nudape lnctlsfa2rruroou4opxniieiadls ranvsn() reoir3ootla rluvo s0texrxrpnu4opt  iesl( aDurxr ;o0apeoifctydfm2eanvs;u0 ltrmrcty
\ No newline at end of file
@@ -0,0 +1 @@
+neo s0teum(m3nudlpeemnei t sDtrxro;o1oleoioeiydfaDranvs (4trxrif3iytlm e ivo;(0teumio3iy1lmtn ivi (  2raumpnu0tlenio3tld s rmump;u)tlxrxrcoatlaD  uei;(  2um(o3oo1am elnviasfartaxmp;t1altnifeiysfa2ulu s;t) leoxfcoo1oaD  uvils0sruoir iudape mietasfarrmxrpnu1oexo i3iad m2ea(vo;u) ltoxr tatfptrluvs;()s2ur(o3ou1lmtemnctasfsrtrxmont4alt mf3ilsfm2ulnms;(4tlxoif ia1fa r ivs;t0tetrio3io4lmte fci s a2umu pot1tleomieilsfs uln p (0 rtoio3iydlm rai ilt)srtr(o3iu1lltn icsls)artax  ;t1oeeo f3iadlm2umumo u4teerif to1fp rlu ils) rum(m3iy1aptemnvs t) 2uaxmpnu4tltnmo3iyd sDum( snt0trxoio io1latean i t  2umxopiu4llee fctl( sDtrxro;t0tpt ifciad m2um(vo t4tlermo3iatopDraivsls)seumxrpoy4om  mfctl(f ruaum ot0aleo oeiydfsDel(vsnu4 rtoir oatlaDrli i;t  rtrxr ny4amt mieilt  2rr(mont4ole if3tlsfsDrl(von(0aeeoiociatlmt au s (  etr(mpoo4alen ict t)sDuru pnt4tlenii3tytfaDeanvo;u) eerif3oydlm rauvol(  rtm(o3ny1lleelicsat) rumxmpot4olxoioeiydls elu p ()aexoif iy1lmDeluvsls setmxrpio1al elfvi sfs2rmu ooo4texn ociydlmDel(vp () rxomr oytla r nvs t)srtoxr nu4alen fcsat sruax o;t1olxomoeiad aDuauvo;t0 lxoxrciytopDrlieo;t)t2xo(m iydomte nvi s  rumxmo;t4olxoiieildfm2rau onu0teeoir3iotoptrlneil(  exmxo3oudop  mivslt) rtm(ro;u1opt  feiltlmDua( snt0trxnmfcta1fm  an sl( teumio iu1am e nvt t)a2rrxr ;o1alt  f3iyslm ulnmsnu)aleriocty1oaDrauvolt0srtoxm ou4ll n nctls)srrmump;o0apt mi3iadfs eln s;u0 eerio3ta1op e ueilt)texmxmpiudlpt  ivs s  2umx p;u1alxomfeilslmDumnmont0aleomr3iodopDrai s;(0 2urxm iu1lm  mivt ()srururpnu0alt  ociasls2rm( p (4 leoio3totlpD aneilt)t2uoimpou1lp elnvslsf Dtmx ono0oleomo3ilsfs ea(vpnt)texrircoodoat an o ()trxm(mpou1ap n fvs t arta(ro;u0oexomietldfa eanmsnt4tltrmrcty1omtrai ol(  euoir ny1oltemnet s a2ta(mo;t0aeeomoeiyd sDrmu ont0teermfctodfp e ivsls)s2xriopiu4ll   ncs s)s2tax  nu1olx  f3iad s emnmp;(4 rerif3oadoa rli olt0trurxrpiydaptelnctls sDumxrooo4altomf3taslmDel(monu0alxnmoctatlp e i o s texrim3iu4ap elfes ( aDrmu  ou4oltn iciytfm um(mp (0areoir iytop e nvsls0t2to(m3oy4alee ncias)aDuaumono0olxoii3tasfaDumu snt0 etoxfcoytla   u s t0texrxmpoodalenlictl(faDrm(m ;u1tpxniieias mDrmums u0tlenmo oy1laDelivols)trxrir iydom nliciatf 2trxrooo4apxn o3ildfm2umnvo;(4areoxr3iydfm eanvi;(0setrxmpiu4al elfes s a2uaxmo;o4alxoii3tydfs ea(mo u) eerif oy1lptr uei;s)t2ur(opiy4al nlicsls aDurx pno4aexn fetatfa el( sn()tlxoif iytoat  ies;(0trtr(r3ou1amtn netasf 2rr(ro;o1tpt mf3iat sDrm(mp;t4tetnmr3iodoateaiei t0srtoxr ou4alte iviat) rua(mooo4oeenmfeiydla2rl(mpnt0texrio io1fatr u sl()t2umir3iodlpt  ieia( s2tr(mo;t1ale if3iad m2rau snt4 lerxf oa1opt  ieo;s texriopiu4lm   icsat)srurxr nu0aee ii3ildlm2ua( pnu) rxoxrctytlatrluvs;s) etoir3iu1ole lfvias)s2uaum oo1openifciatfmDuluvpnu) ltoxf oy1omDrlivi;(0 eurirpiy1omeelnvtltfs2tmum nu1aex mietat aDuau o u)tlenmr3ta1lmtr ieil(0texo(r nodlltelivil(faDtru  ;t1tex io3iltlm uanvont)trxrio ootopt luvol() rtmirpnu4amtnlnvtas aDtmu  ;o4aexo i3iyd m2rl(vo;(4trerxr3tatlpD anvo ()s2tr(mpio1om nlncsls)srtaxmono4tpx ifciysfaDum(vo ()altnxo tatfp  livolt0trumir3io1optnmncsltf rrax o;u4oex moctyd s eanvpnt)tetrxo3oadfpt au slt0teum(m ou1am n nvsl( a2uaxmont0tle if3tydfsDulums (4tlxnio3tatfa eanvs;(0truo(r3no4am n fcsl()s2tau  ot1oexo i3iltlmDrm( o;u4trxnifctytfm   nvsl(0srtmim ou1ale lfcs s  Drmxrooo1tlx mocils aDeauvp u4teeomrcoytfpDrlnei;()s2uoxo3oy1ame mfei (  2rr(rpoo1opxoioetadfm uau s;(0 exnio3ootopDr i ils0t2tmir iu1lpe mivs (farraxm ;t4oet mo3iydlm uaumpnu0alerxf3iotlp   uvi;(  rtoim no1ap nmicsls srtm( pnu1olt ifctatfaDrmuvpnt4 eenmo tytomDranes s texoxr3oodal  mfvt s)s2urxmonu0opxnmoctasla2rmnmp;(4texrmf ia1lp  aivol() eumio oy4open nvt tf rrru pot1texnmoeiytlm em(mpnt0aetrio ta1fmDr u sls s2trxr3iu4lp e fvtas)sDrmuronu0tle  oeiaslm2rmu s;(0teenmr tytlaDrlueolt)t2tr(mpno1op e icils)arurxm ;u1opt ii3iltls2umnmonu0aexoir tydlaDe n i ()trur(mpou1lmee feiat)s2uau  ;u4apt ioctyd mDel(vo;(0aexrir3iodop rlu ils  exo(rpiy1ap  lnct t)sDtmu pot0aeen ictydfm uaums t0 rtrmfcoodfpDelnes;(0seuoxr ny1omee ivia(farrmx oot4aeenmfeiasfsDea(msnt0aeerif ta1la r i i;t)tetmxo nudom emneiltfa2ra( oou1alt moetlsls2rau p t)aetoirctatoa rlivi;s)trxoir3iu1am  liei (faDrm( pnu4tpeo o3tltfaDrl(vs u0artrmf3ty1lm rluvol( t2uo(o no4aptelieias a2trxmonu0olx ifciadlsDrmuvp u4 exrircio1opDelnvol(  eumiopoodlm elnesat aDrrurp;o0aeen i3ilsfm2ulnmpn() exnir3tadlatr u ilt  2ur(mpiudap  lncsas  Drmur nu1teenifciyt mDrmnmsn(4trxoxfcootfmt  uei;t srxmxo oo4am  lnetat)s2truro;o1ole mi3iytlsDuluvs (0 exrxrcty1fmt  nvslt seur(o3oy4am emiet (f rum( poo4tlt  o3iyd m um( s;u) rxnxf3iydlaDe u o;( t2xoxm iodape livtatfarur(m no0alxnifctltfsDem( pnt)trxrircta1lmDeanvi s0t2ur(o nodlm n ivsl()sDtr(mo;t4tee iietltfa2umumont)teeoxf3ty1fatrauei;()seurirpiu1omee ncs t sruaurp;o0aexoioeild sDua( onu4 exnxrcoodlatranvsl( teum(opoo1omt  ici s aDtmu pnu4aet  ieiytfmDrmn s (4texrmfctatfa rau i ()s2xrxrpou1omen netas s2rmum ;o0texo i3iadfs ulu s;u4 rxrxr3iodlpt  n o s s2um(r3nu1ap nlivia( a2um(rpot0tpeo ieiadla emuvp () etnxr oo1oa rluvs;s0trumxo3ny1lptn ivi t) 2taxrp;t1aee miciytls umnvsnu)tetnmr todfm eaivi;t0setmxr3oo1omee fvils) 2umxm ot4apeo i3iysla2ul(vsnt0trenmfciatfpDe ivo t  rum(o oydoptemnvt s)s2ta(mo;u0tex  f3tasfs ea(vpn()arermr3tydoaDeaues;t trtmxrpiu1al nmfct tfs2rm( ooo0oexo o3tlsfm elnvsnt0 rxnxrcio1op r i s (0 2xmxo iudame lnviat) rtmu pnu4opt moetydla umn sn(0 ltrir tytoa elu o ()sexoio oudlpt  fvs t)aruaxm ;u0ape  iciat aDrlnvsnu4artoifctytlm elneo s0srtr(m3iu4al emnvia()a2rr(  ;t4olt  i3ildlm2um( o u)arenxf3iadoaDraies s0s2xmio iu4al nmnct (fa2tr(mp;u4alt mfciasfsDemnvp u0aexomo iodlmD livi;s)seuoir iydolen iviltfsrrr(rpou1tleomociad a elnmo u)aexrmr tytfa eluvo;s0 2xrim iudoleelivi s aDurxmono1aee moeiaslm rlumo;t)artoio3oodopDe u ils)trxr(rpiy4lp n ivt s s2ur(mo;o1oltn f3iatfa2umuvsn(4artnmo3iy1fateln s (0t2xoiopoudlptn nct s)artm(m ;u0altomociysfa uanmo;t0texrirctydoaDe i s ()t2xoim3ny4ap nmfvtas srur(  ;u0teeo fetad a eanmsnu)arxnxocoy1fa rai s;s)t2um(rpiu1ol nmnvtas  2rr(m ou0tltnmoeils a eanmo;(0tlenmoctadfaDr ieil(0trxmxo no1omeelnctltf rrmu ono1oeeoiociasfs rmnvpn(0 eerxf3iytoaD aueolt)s2trimpoydale mncslsfaDtrxr nt4tpxnmiciatla2em(vp (0tlermr3ta1fpt ai slt0s2um(m3ou4lm e ivtltfsrtax p;t0ale ioetlsfa ua( o t)aetnifctatfptr nvo;s0setrxo3iy1amtnlict ()s2tmu pnt4olxo feiadfm2ua( p u) ltoifcio1fm e uvi;( t2umio oydlmeelnet s  ruauronu4tpeoioeiyd s2elnms t) lenmo3tytlmt ai s s s2xm(o3iy4lpe lnetasfs2um( p;o0olenmi3ils mDumnms t0trermrciytfmt  nvils0texrio nydop nmnci s) 2ur(ro;u1tet ifciasfaDea(mp () ltnmo3oatoatelnvi;(0 2toio3oo1lm n netas s2tru pno0apxo ociyd m rmnmo;u0 exomf3iy1laD livol(  exrio3ny1ame mfct s a2tr(r ;o4aptomf3iyt aDrl(vpnu4trenif oatla   ivs;s0t2trir nu4lmtemietls) rtmum nt0tle  o3iatla ulu p;u)artrmr ta1opt  i i;s)trumxm3nydllee fci (  Drr(mpnt0aee ioetld s2eauvont0 rxnifcoatopD luvi;t  rtrim ou4apen fvi s a2tmx oou0alt ioeiltfmDrm(vo t)alxomr tatfaD  neo ()seto(m oy4om  mieiat)a2um(roou0opxnmi3tadls2eau s u0 exrir iatlmt anvo;t)trxmirpou1aptnmncsasfa2rr(r ot4tetnifetadls2um( o;(4 rtrmfctydlaDr uei;(0t2xo(m iodlleemicils)sDum(mo;u4olx  i3tydfa ulumon(4 exrxfcoatom rau o t)trxmimpoo4llt mfvt sfsDuru  ou0tex mocilslmDrlumpnu)texoirciatomDrln o;()trur(m nydameelfcs t  2rrx o;t0alto icildfsDeaums;u)tlenio3tatom  li o ()tetoimpoo1lm emivil()s2uru ooo4tpeomi3iltfa2ua( p u)alxrio3oa1lpteai o t s2xo(opiu4ol nmncsas s2rru  ot1oeenmfcilsfsDrln pnu0 ltomo3oydfptrlieo;() rtrxm iu4lp   nctat)arumx poo0olxnmfetltlmDeluvp t)arenxf3ta1opt lnvo ( s2umxo oodamenmnvi tfartrxrooo4apxn i3ilsfs2rmn s;()tlxoif3ta1lm r uvol() rxr(m3no1am emnesat) Duaumpno4olxomf3tad m ulu s;t0tlenmo iotfpDeai ol(0 rur(m iodlpe mfvi (f 2rmx ono1tleo f3tasfm ra( p;t0 rxnxr to1op eauvils0 rtm(m3oodol n fcsa(f rtm( ono0oeeomfctltfa ea(vp;u0teeomo iodfpDraieo;t s2trxrpiu1ll  lfesa( aDuaur nu0tet mi3tad sDuaumo t)teeomf3iydlmDeaiesl(  eurir nu4al   ies s)a2ta(mpot4olxn f3tat s2rln ont4trenmo3iy1fa  anvo;t) 2umxo3oudop n ivs tf 2ta( p;t0apxn oetlt aDraumo;(0 exnifciatomDeaues;t) etm(m3oydolt lfei tfs2raxronu0olx ii3tytlsDuau ont4trtniociydom  lieils0t2toim io4apeemfeil()sDrruro;t1optoifciydlm emn s ()trenxr3tydoaDr uei s)srxm(o iudaltn ietl( aDrmu o;t1oeeomfcildlm2rm(monu) lxoir ta1oaD livols0 rtr(o oy4olte nvils)s2ra(mp;u0aee  oeilslmDrluvpn(4altrmr oatlmtelnvo;s0 2toxo oy1omt mici t  Dtaum ;u1tetomoetltlmDua(ms;(0altomf ty1op r ivs;() rxrio iu4altnmncsls  Drr(r no4oeeomoeiadlsDua( o (0texrir3to1fmDrluvils  rxo(o ou4lme lfcil(  Dra(  nt0tet io3iys mDranmpn(4 eerxf oy1fm r ieo () exr(mpno4olen iesls  rraxmo;t0open f3iasla ulumo;u0alenxf oa1lpt  ueslt  2trxmpoodaptnmictat) Dtau  oo4aeeomoeiydfa2uanmpnt4areoif3oadoaD luvs ( texrxmpnu4opee ncsltfa2uau  oo1altoioeildlsDumnvpnu0treoxociatomDrlu sls setr(opiodamtnlietls  rtrxmonu0texnmicild s2ulnms;u)aleomf3iodfmtelnes t sexrxm3ny1al   ivtls srurur ;u0opeoifetydlm2uluvo u0 exoxr3ta1lmDe u i;t  exmio no1ol e neil() Dum(rp;o1ole mf3iyslm el(vp t4 eeomo tatfa e uvo s0sexoxr oo1ll elivt s srum(r ou1texomoeiytfm2elump u0tlxoxf ty1faDrli olt trtm(m oudlpenmicsa(faDrrxmp;o0teto o3iysfa uanms;(4 lxoxf oadla   ivo ()trurimpny1lp nlnei ()aDtm( oou1altn ocils m2elu pnt0tetnmr3iotopD  n slt seuoxo oodlpenlfcil(  rua(roou4apxo i3iasls2ea(ms (0trxnxr3iytfmtraneolt  eumim3nydam nmiet sfaDur(m ot0oltomfctldls2ul(msnt0 eenif3iytfaDranvo;( trur(m3iydape  ictl()sDtaump;u0aexn f3tys m2emumo (0texrxf oytlat au i t)s2tr(opnu1lm  mfvsl()sDtm(mo;t0alt iicilslmDemnmpnt4altniociy1omteli i t srxm(mpnu1ap  mnet (fsrrrxm nt1olxoiietydfm elnvo;t) eeomrcoatfm e nes;t) rxrimpou4optemnvt t)s2rr(m ;o1tlx ifcildfsDulumsn(0teermf3iadoa  aieslt0 2tr(r io4opte ieias aDurump;t4aleo f3tysfm2uluvonu)aetoio tatfptr n i;s) 2xriopiy4altnmnvi s  2ua(moou4tpe mfciatla2em( p;t) rermf ia1lm r ueo s  exoxrpnudoptnmnesls) 2rauront4olxo o3iadlm2ul( o u) exrxf tydom r n s t)sruo(m oydaltnlnetls  rrax o;u4alto i3ild mDem(mp;u4altrio oatlp   iei t tetmimpnodopenlivils aDuaxmont0tlxnmfeiadfmDrln o (4 rerifciotopteai ils0t2uoir3iydllenlfetas)arumump;o4oex ii3tytlm2em(vpnt4artnxo3iy1la  an s s0 2to(r nudapenmieta() 2trxroou0olxnmfctldlmDuau snu0tetoir tatfate ueils  euoim3no1opee fei () rtmxmonu4oeeomo3iydfmDeluvo;u0areomfcty1fmt lnes;t  2xmim3ny1aptn icta(f Dtmxmo;o4oeto oeiydfm2ea(ms u0treoio oy1lptr ies t0teumxopnu1omtelfeiltf Draum no1ole  fetad m umnvs;(0 exnir ty1fpt  n o;s0truoxo3oydlmtnlieta( sDrm(r ot0tet moeiadfm ulnvo u0arxomo tydlpt an o s) etr(r3oy4optemivi t a2raumonu1tlto i3iyd aDran o t) reoio3oodfmDrai sl(0sexmiopnu1ll  micils)s2tau  ;u0apenmicias a umuvonu0texoxocoo1lat anvo s texr(r no4olen nct (fs2rmxroou0tetnmf3iydfs2raumo u4tetomr3totfmt  u il()sruoirpiydop emnetas a2rr(mp;t0alenifetldls2ea( s t)trtomf tytlat anvi;t seuoimpnydlltnmnvsat)s2ta(r ou4oeen f3tadfmDraump t)texnif3tatom elnvs (0t2urxrpiudlpt mietasfa2rrurpnt1opx  ietytls2uluvsnt)alerif oytfpte i i t) 2xoim nodole  fvs s)srtrxmp;u4olt  ieiydfa ul( p u)tlxrifcoo1fm rln s;t t2trio3io1lmeelfctas)arua(  ot1teeoii3tltfs rmuvsn() rtnir3oydfatrln olt)srxoxmpno4llenlnvtl(fa2ua(ronu1texoio3tatlm2rlu o;u4 renxo tytlat  ivs;t)t2xmio iu1omeeliesltfarum(  ot4oleo i3iyd m2uln sn(0 reoiocootomDeln i t s2trio3ou1ol emnesat s2umumono4aleniictas a uauvp t)trxomr3iatfp r nei;s)t2um(r3nydalt  fct ( sDta(rono4opxnioetytla umn ont4aleoxo ia1omDeluesls)tetoio no4lmtemfcsls sDrru  ot1alx iocilslsDuan on()arerio3oadoaDelivs;s trurio3iudoptelncia()aDra(monu0opto oetyd s elums;(4 lenxrctytop eanvs;(0srxoxmpiydap  mneiasfs2ua(rpot4ole mfetyslsDrln p t4trenmr3iytfpDr ues;( s2tmir nydlmtn feiasfs2rmx p;u0oex mo3iysfa2rmnmsnu0 eeoxo tytlm r ivols)t2uoxm3oodll emfvtas  Dta(mpnu0tptnmfetlt m2em(mo t) rtoir3oa1laDe n i s  euoir3iudam n ivt s  Dtmxronu1tetn fetlslmDrm( ont4aeeoio3ty1omDelueslt0s2uriopnu1lptnlfct (f rta(ront0ale ioeiysfs ran snt4texrxr oy1op r nvo;s0 etmxopiy1amtnlivils  rrrum ;o4opxoii3ilsfm um(vo;u0tlenif iodlm   n il(0sexm(opiy1alt miesl(  2ta(mo;t0tlenioeiydlsDrlnmp t) etnirciadlm   nes;s0t2urxo oodal elics tfs2umur ;o0tltoioeiad a raums;u4alxrxf3oodomt  uvolt0 rxoio nu1olen feil( srtm( pnt1alt  ieiysfs2ra(vp (4arerif oo1lp eaies () eum(m oo4opeelfviat)sDtrum ;t4altniieias a2rlu ont0alxrxrcoa1opD lu olt0seum(m3io1am nlnctls) rumu  ;o1altn o3iydfmDra(mpnt)altomrcoy1lmtrln s;s) rxmxr3ou1om  mivtlsfa2ur(mpnt0opx  oetytfmDuln o;u)alxrif oodfaDran slt)trtmxm oudop  liet s)sDtrx  oo4teto i3ils a el( pnu0aexoifctadfaD ai ol( srur(m3ny4lpt  nct sfa2raxm ;o1aexo feias s2rluvs t0arxoif3iy1fmtelivs t t2toxrpnodom emictat srumx poo1oex mieias s ea(vs (4altnxo oy1la  anvi (0 euriopoo1optnliesas)aDta( pnu0oeeo fciltfm uaump;u) renif3oytlp eanvs;()srumio oudapenmnvtlt)a2ur(m nu1opeomiciydls2rl(mo;(0areoxocoodoa  luvs t0s2uoxopnodalte nes t)aDrmxr no1aet moeildfa2ul(ms;(0areomr3iadoaDrai o t)s2xmimpoudopenlfctas)a2rax o;t1oltnio3ilsla2rlumo;() eenmr iodlaD  nvs t0tetr(rpiy1open fcias)arraxro;t0tpeo i3tytlmDemn s;()tlenmo3iotop e iesls teumio oudamtnlieiltf 2ur(roou4tee  ieiadlmDrln p u4 eerifciotop e uvi t0srxm(r oo4open iei (f 2rmum ou1aexnif3tad s2eanms;u0tlenmr io1op e nvolt0srtmxo iu4lp  mivi s)srtm(m ou4openmf3iatla emuvp;(0treomf3oadfpt aivil()s2urio nydlpe mfes s) 2trx p;t4tlenmoetlt a2eaums ()arxrio tatopDeanvilt0t2xmxm3no1lpee nesasfsDtmum ;o0aetomfciyt aDem(vs;t0 renxo iytfat  uei;t t2ur(m iu1lp nliet t  Dum(  ou0altoifeiys m elnvs t)arxnir3totop e u o;t0 euoir3oudlpt mnetlsfaDrmx poo1tlenmoetytla rlnms t4tltrir3iydlmD ln o ()trxo(rpoy1alte fctas)artr(rp;o1oeto f3iysfs ra(ms;u4 lermrcto1fpte ivil(0 etmxr3iudlpt livta() Duru  ;u0ope mieilt sDra(mp;t) rxoxoctydlmD  n o;( sexrxopoudalenmivtas)s2uaxrp;o0alenifetas m uaumpnu0arxoxo ia1oa   i i s0srxrxo oy4omenlivsas) Duauroou1tetnmieiyd sDrauvs (0trxoir3iatfatr u i;s  ruoxr3io1aptnlnvslt arrmumoou0tpx  octltfs emnms ()aetrmocoo1faDr n s s  2um(o3iodomt lncil() rtrx pnu4optoifeildla elu pnu)aexnif ty1omt  ivi ()s2urxo3ny4lmtn fvi t)s2um( o;t1tpxo f3iaslsDrmnvpnu) rxrxrcty1omtrlivsl(  2um(r iy4ame  ictlt)aDra(rpou4aeeniictyt m rlumo u0aexomr3todomtrau s t)srum(m3iydop e ies ()aDrax p;o0tet mfctasfaDua( s (4aeerirctatfptelieilt0sexr(mpnydol   fet sfs2rmurpnt0tlxomoeilslm emuvs t4altnmocoytla elieo s0srum(o iydllt mnvil()artaxmp;t1tlxomietyt m2rl(mp;t)aeeoif tydom rlnvs t0 rxrir3ou4alenlnviat arraxrpou1tleoii3iyt m rl(vpnu4arenio3oodop r uei s  2trio iu4om nmnesl( srra(  ;t4tptomoeildlaDrau p;t0tltoxr3io1fa   iesls0sexrim3ny4lmtnmnvias  rta(monu0optoioeiyt a eaump;t4trxnmfcty1omtrluvi t  etoim oodap  lfvsltf 2tmxmp;t0tpenmoeilsfs2emump;(4 rxnif3oodom   i s;t0 2umxrpiudaptnmiciltfartrxro;t1opxn ociys s rmuvp (0alxrif3to1faD ai olt)srto(r3nu4lp  miet ()aDumx  ;u0aexomoctyt s rau s;u4trermr3oo1opDrlivo ()t2xrio io1lle mfvt tfaDraumo;o4tex  i3iydla rlnvo;u4 rxoxrcoodfate ieo;s  etoio3ou4lpeelfeias srumumpnt1oltn oetydls2rmnms;t)areniocia1fp  livo;s0texoir3oodll nmncia()s2tm( pot4tex  i3iadfmDrmnvp;u)alxrio to1fpDr n s (  2xmim3oy1ale mivs tfsrua(mp;u0aeto oeiadls2umums;t4texnxo3iadoa r uvo;s0setr(o io1omtemfcs sf Drr(mpot1tlt  ociad s em(ms ()tlermrctydlmDrlivols0sruoio ou4ape lict ( a2tmumoou4tptnmfctysla2umumo (0arerio3tydfp eauvslt0setmxr3no1op nlnesat)arrmxr nu1tlto fctls s2emnvo;u0tleoir oodlmt livi;t  rxrxmpno1am  mfcs sfartmxmp;u4olt moetltlm2rmuvo;t4texrxf3oodom eai ol( srxo(r no4ll  lfcsls  Dum(mp;u4aleoifciasfs2umn pn(4 lxnxrcoadlate nvslt0srurxo oo1lmtn fct sfsDtmurpnu1alenmo3ilslmDemnmp t)areoir oodlmt ln ol( teto(r oo1am   icils)artrur nu0aexnmfciytlsDra(vo u) eerxoctydfat anvi t sexo(mpny4op  liciatfs2rmxro;t1texnmfciydlsDran o t) eenmocio1fp rlneils0texmir3oy1opeemnvsl() Dtmum no0oeeniieils mDeluvo;t) rxrio3iatlmt ai i s0teuoim nu1olenlfctltfs2tmx oot0oeeo ieiysls umn o;t) rtoxrcty1fpD aueo;t0 exrio3no4am  micil()sDrmxr no4tleoif3ildfm2ua(vsnt)alenmfcootfpt lieols0setrio ny1ol  lfvsl(f 2ta(m no1tetnio3iad aDuanvo;(4 exomfctatoa eauvs;s0trxoxm3no4ll e fcs tf 2urumo;t1aeeo fciytlm umuvp;t4 ltrif3ootfmtr n i;t0texrim nudam   fvi sfa2rmxro;o1altnmi3tld m2uanms ()altoif ta1oa rlnvs;s t2xoiopoy4op e fctl()aDrrx o;o1ale ioeilsfm emumo;u)altoir ootfmDrln sl() 2umir3nodlpeelfvtltf rrm( pot1tpeomoctyd mDemu pnu)treoif oo1laDrai o t0srur(m iydamtemnviat s2raxm ;u4tpxoio3iasfm rmn onu4artnmr iodfpt ln sl( t2xrxr3iy1amt mivtl(fsDrr(ronu1tex  f3tatla uau o t4aetomf oadlmtr ies;t t2tm(mpio4lpe  nvsa(fartaurono1alt  feiad aDelnms;u0 lerxf3tytlp  lnvs s  rxo(opnu4ol  lnctlsf 2ta( oot0aeenifctatfs2eluvp;u)trtoxr3ta1lmtraies ()trtm(rpoodap nlicsat s2tm(rono0tltoioeiasla umu o (0tlxoxf3iadlm  an s s s2uo(rpiu4lpt lnetasfa2umur ;o1ope  iciysla el(mp u0altrio io1fmt  ivs ()s2uoxr iu4oltnmicsls srtr(mpou1ope  feiasfaDemnms (4 lxnmr oodom e i i s)s2urio ny1lp n nesltf 2tr( p;u0tlxn fcild s emnmp u0texrirciotop  livs t0s2xmio3ny1ol  lneslsfsDur(rooo1opx moctas sDumnvsnu0 exoxocto1oaDe ies;t)t2xo(o iu4apt  iei t s2trx o;t4tle  ociytfm2rlnvp () rermrctytom eanesl() rumio ou1am  mivtlt)sDum( pot0tltnifciadls2eanvp;()texrifctytomtranvolt  etm(rpio1opeemivta()a2uaumpot0aee iociyd s rmnmsnt0 lxoxr oy1fmtr uvs;t)seuoimpoy1lleemfci s srrr(ront1aexo i3ildfmDemuvs;t) lxrir tadlmt  ivo;s)s2tmxm iu4ll e iesa(fs2taxrp;u0aexo o3ils a2rlums;(4 exrmo3oa1lpD luei t trurio oo4op e icil(f Dua(rp;u1aex iieiydlm emn pnt)trtnir oadlpt li s;s0 exr(m iydal nlnvta(f rrr( p;t1oetomietytlm2ra(mpnu0 lxrir3to1lp elu s;t0 2to(m nodole  fcs s  rtmxrpno0aetnmf3tld mDumn p u4arerxr3to1fpt an i t trtmim3iy1ol  lnvtl() Dumx o;t1ape mfeiytfm rm( o;u0 rxnif3ia1fateaneo s0 2xrxopnu1llt mncias arrmx poo0tlt iieildfm2rl(mpnt)aeenmo iydoat an s;(0 rurio iu1al elfvt s srta(  oo1alxn oeildlm2rm(vsnu4teenio oodomDrlieo;(0 rtoxm3ny4lmtelivi sfsrtaump;t4olto fciysfsDeluvs (0tltrmf3tadomDranvi () rur(mpio4omeemnvtltf Drmxmo;u0apx mfciytla um(ms;u0 etoir3oodfpteaieslt  etoxmpou4ameemies tf 2tax  ;t0tle if3ild aDum(mp u) eerxocia1laDeau ols0 eurxr oodal   nes t  2urxr ;u1alto o3tas a2umu o (0tltnifcoodfate ivi t trto(m iy4amenmivsas aDum(mo;u1oetomietldlm rau o ()tlxnif3iodlmDeaues t0 eumim iy4aleelfeilsfsDtau p;o4aeto ociadfa elnvont0trxrxr iatfp  lnvils t2urxmpoudamte fetat) Drr( ooo1aeeoifctatfmDea(ms;t4artnifciatfm eanei ()trxo(rpno4lptn feia(f 2rrxrp;u4tetomocilslm2emnms u4 renxfciadfm r uvilt  2uoxo3io1lp eliciatf 2umu p;u4oexn fcils m ulu o;t4treoir todom   iei t0sexrxo3no4lme mnes tfartr( pou4tex mocilsfmDraums u0 rtnmo tytlatrln i;s)s2tmxr ny1om e fci t a2rm(roou1tleomoctyslm rmuvpnu0tleoir3io1omD  nesl(0 2xoxrpiydomt  fcias aDtrumono0apx iieiysfaDrluvon()aetoxrcia1fpteli i s0teto(r iu4lle mfvta(f 2uau  ot0oexomoeiat m ulumo;u4trerxfctytomteanvi s)srxoxrpoo1optelfcsat)a2trumoot0aleo oetydla2rl(vs u4trtnmocta1fat lu o;s0t2ur(m3iodlleemfvtlt srrrur nt1aet  o3iatfm2elu o;(4tlenmo3oa1la eau s;(0srtr(o iydom  lfvtatfsDur( pnu4altoifeildfs ulu o;(4texnmrcty1fm rai i ( texrxr oodam  lfctl() rraump;u1apxo f3ias s2ranms;t0tetnmrciytlmte ies;t)s2tmxm oy1ap nmneta() Dum(m ;o4tpx ii3iatfa ea(vpnt)tetrif oy1lm rluvi ()seto(opou4optnlnesa(f 2urumoot1altoifctaslmDum(mp (4tlenmrcto1lmD li o (0 rurxo3iu1am e fetlsfarrrxmoou1opt  icild aDea(vs;(4 rxrxr3io1latr ueols texm(o nu1om elncsatfsrraxmo;u0altomictad m eluvsn()aetrmo3iytlmtrau sls)srxoim3iodape lfeil(fa2uaurpnt0teenmocilt m ea(vsn(0artoir3io1fpte ivs;t s2trir3oydlltn nesas)srumxro;t4tpeo oeiyt a uluvonu)tltnxocoodlp r nes ()setoxm nu4lleemnctlt) Drr( p;u1tlxoif3iat a2el(ms ()tlenmfcootfp  luvol( t2umxmpoodlptelfesatfs2ur( oot4ope  oetlt m ulnmo (4altnxfcty1op eau o s)t2tr(m iodalt mnvtltf rta(root1olto o3ilsfsDrauvo t0 lxrmo to1la e uesls0sexrir3no1am   nvi s) Dtmumoot0olxn iciytla rlu p;(4tlxoirctodom  ln sls)srxmxrpiy4ape mfesat)srtaumpoo4tpenmf3tydfm2ul(vo (0trxomr ty1opt  n i;(  ruo(r ny4llen ict sfa2rr(m ot4tpxomicilsfm rmu s t)tltnir oadfpDeaies s)t2xo(o3oydopt lietls arur(m ot1alx  ociltfs2ea( p t)tetrxocoydoaDean ilt s2uo(opiodlpee ivias  Drmurpoo0tet ifeias aDuan s t4aeermo3ootomDr ieo t0srtr(r3nodomen ncsa(fs2tauro;o4tlxniieiad s ul(mp;u)artomr tytfaDelnvsl(0t2umio io1lm  lfeia()aDtmx pou0tpxnmfciydfm ua(ms;(4aeeniocoatoa  lnei;( tetrir iu1ap nlfetat srrrxmont4tltomo3ias s2rm(vs;(4arenir3tydomteluvsl(  rurio3no4lmtn fesas)aDumxmont0apeniicild sDrau pn(4areomrcio1oaDe nei s)trxmim3no1lm e fciltfsruaxm no1opxnmo3ias m el(vs;t4 ltrxfcio1fmD lnvo;() euoxo3ou1am  lict () Duaxm nu1teeniieiydlm2emuvo u0artnio oadlpDrlieo s0t2uoxopou4amt lfcil( s2urum ou0tptomfeils s rlnvsnt0tlerircoydfmDrau i;()teur(o iudlpee nvi () 2rm(m ot0oex ifcias m emump;() eeoxr3ta1fpDrlu i s teuoxrpoydllt lfet s) rrr(  nu4opxnmfctyd s2ra( o u4tlenif ta1lmtraneols)texrxrpno4olt lfesatfaDtr(rooo0aetnmf3tld aDrm( p u4 ltomr iadlm eau s;t seur(r3nu4amt lnvtl(fa2ur(ro;o4alx mictysfm2uaums u4arenxfcia1fpD an i;s  rtoxm3oo1omtelfvi (  2rr(  ot0tpto feild s emumsnt)aeerxf ootfpDrai o;s)t2uoxr3ny1omt  iesas sruru ono1apx  feildlm uauvp;() rtnxr3oatfm eaivo;()s2trim3oudoleemivs tfs2urxmo;t1olt  oetls m2rmumo;t0 rxnir ta1opD lnvs t t2um(rpiu1lle mfviat) 2urxmoot0optniiciatfaDeau o;u4alxrio3ootfaDe ivs;( trtrxr3nu1lm n neias)s2truro;t4oexnmfeiatlmDua( pnt) renif3iytlpDelieol(0s2tmimpiu4op emfcilsf rtruro;t4aexn ieiasfm2rmump;(0aexomf3oodfa rluvo s texmir3iy1am  mfeilsf 2tru oou1opt  fciltls2emu s (4 exomr3oytoa   ivi t0 rtoxr3iodol e iet tf rtaxroou1tpxoif3iat mDrln o (4tltoxf3ty1fatelivi;()teurir3iu1lmen ietatfs2urxrp;u1opxoiieiatlaDraumo t0tlxoxf iy1lmD aueol(0 etoiopou1llt  fei (  Drmx pnt4tlenifeiasfs emnmp u0 ltrifcoytfptelu s (0sruo(o iodaltnmfes s sDurxrpno4tlxomfetydlm2eanmp t4texomo3to1lptr nvs;s0s2xrxm3ny1apenlneils) rrrurp;t4apx mietlsfm2eauvo;(4aetoxr to1fpteluvs;(0teur(m oo1optemncslsfsrua(mont0olx ii3iadla rl( s u)alenxf3todfatr u i t0 2xmxrpoy1oltnlfvslt  2rauro;u1tetoif3tasfa el(msn() leoxf3oadla  anes;s)srtoxo ny1lpe lict sfa2trumont1alt mictadla2rauvs;t)areomr oy1fm  anvs;s0srum(o3ou4am emfetlt  2rau ooo1tpeomoetasfs2uauvs (4 rxrif3oo1oa  au ols trtm(r3ny1ame  neiltfsrua(rp;o0oee iictas m2uanvo u)arxrxocoatfateanvi;()trtoir3nu4ameelfvtls  rta(m no0tee  ictytfa2rmn o t)aeermf iadoa r neo t)trto(o3ny4llt lies (fsDrmx ooo1tpxnmfctatfa2ua(mo;t) eeoxr3tatop e ieolt) 2urim3iu1apen ics (  2raxr ot1opxoiieiysla2um( s t0tleoxo3oa1latraiesls  rxrir iydlmenmicil() rtm(rp;o4tet mieilt a2eauvs;(4trxrmfctotom rlnvs (  rurxm iydalee fei ()sDtm( oot0aetn o3ils sDemn s ()altrirciy1lmteliei s0trtrxr oydapeemivtasfaDtm( oou1apx iieiltls2rlnmo u)trxnxocootfm e u ols0 ruoio oo4ap  livtatfarumxr ;o1tet  ictld a2emnmo (4tltoxr tydoat lneolt)srxr(m ny1ap  mieilt sDrau o;u0tpx iiciasfaDrmumpn(0 etrirctydlm e nei t  rxr(rpiy4am   ncsatfarrru o;u1tptn ieiadlm2rmuvsn()arenxociydlpDrln sls0t2tmxm iy1op n fvilt aDrrumooo0open ictydfs2rl(vs;t0aexnmo iydfpt li s t  rurxmpnydop nmivs sf Dtm(m ou0aetn oeiat s2ea(vp;u)alxoxf3totfm   nvil()s2tr(m oodaptemnvilt) Dum(r nu4oex ifciytls elnmo u0alxrif oa1oat ai i s) 2urir3nu4lm nlivta() Drm(rono4aeeomfctlsfaDemnms t0 renmfciodoaD lu ilt)trumxopoy4ll elneilt)a2taxront1tpxoiieildla2rau o;u4artnif iy1faDr ivs t) rum(mpny1om  lictatf rurur no0aleoioeiytfsDem(mpn(0tltnir to1fm ran s;(0t2trxo no1olt  fetas)artaur ot4tpt  iciat m2elnmp;(4aexnif3iatoaDran ils)tetoim3ou1om nlfvi (  Dur(r oo0apeoiictytfs ra(mo (4texnmf ta1lp eai il() exoxopiu1amtnlici () ruau  ;t4olxnifeiltlm ulumonu)arenxf3oytopt ln ilt0 rxrio3oydolen feia()s2umu  nt1olt mo3ias a2umu s u)aetoxoctotfaDrln sls0texrxm3iodaptnlfciasf Dtr(moot4opeo fciysfa elumon(4tetoif tydoptr ivilt0texrim io4lpe  nci sf 2rru o;o0teeniietlsfaDuauvonu0 eeomr oydlaDeluei s0 exmirpio1amtelfcias aDumump;u4teeo f3ias aDemn p u)texrxociy1oatelneols) ruo(o3iy4amtelfviltfsrurumoot4texnif3iasfs emnvp;(4aetomr iotla   nei;t)sexrimpnu1olenmfcilt)aDtmx  ou0olenmfcild s
\ No newline at end of file
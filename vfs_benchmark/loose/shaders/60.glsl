@@ -0,0 +1 @@
+n o (0 eumir3iy1omt liei sfsrtrumont1tlen ictyt s ulums u)alxnmf3oy1oaD  ivi;t)t2xr(o oudlme lnesasfa2rrxr ou0aeeomo3tlt aDrm(vp;()aexoio3tydfaD aueo ( t2toxmpoy4ale lnvtlsfsDrrum ;o1tlxn fetysfm emuvo;t0 renio to1fmDr uvo;( s2xm(o ny1ole  nci t) rrauroot4tltoiicildla2el( p t)trtrxo3totlptraiei;t)trtoio iydopenlfvsls a2tmxr no1tex ifetys s elnvsnt4tltoirctydlmtrliei;(  etoxo ny1lle lfesat) Dtrxroot4texoiociadls2umuvo;(0artomrcoodomDe ueo;s0srxmim3io4lmtelivt sfaDrr(mont1apx  fctls m rluvsn()altrmfctatoaDe ueo;t0srxmxr iy4opee fvilt aDumxm ;t1oltn oetydlaDemu p;()alxrxo tatom r n ol(0s2umirpnu1alee neta(fsDtr(mp;t4aleo fciasfa2ua( p;(0 rtrmf3tadfatrln sls) rto(m iodap e netlt srrr( ooo4oex iieilt m2umu s (0 lxoircta1fpDrauvo t)texoio nu1omeelfcilt  Drrum oo1apxn fciyd s2elu pn(4alermfcoytom ranvs;(  etmxm no4ol   icil(faDtrxmoot1oleoiieiyt a2uan p;t0trtnio3tytla rliei s t2uo(o no4aptnlfctat)sDurx ont0oltnmieiysfm eaump;t0treoifcoydoaD aivs;t  rxmir3oo4ol nmict t)sDrmum nt1aetoifeiltlmDemnmsnt4trxoioctotlaDeluvs;()t2ur(rpiu1amenmietlsf Dtmumpoo4opx io3iysfm2eau snu0artoio tydfmteli s ( texm(m3oo4amtnmnvi s arum(mono0tptn fctyt m ua(vsnt)tlxrxo3tydlmtran o;( s2uoirpnydoptelfctat) rtax oou1ole  fctyslmDuauvp u)teeoxo3iy1faDrlnvolt)t2umxmpoydaltemfvsls)a2tr(mpot0tltn oetyd s2rmnvpnu4 exrifctotlpD aueo;t0 exmirpiodlpen fcsls  2umumo;o4tex iieiysla um(mp (4 etomf iadlaD auvil(0trxr(o no4ol e fctls) 2umx p;u0oex mfeiadls rmuvs () leoxo3ia1opD au sls0 ruoirpoy1ape livtl( a2rrx ono4oeenmfctatlaDeaumo;t4tetnxf3iatoatr ieol(  2xo(mpoy1ol nlfeia()sDua( oou1oeeomo3iytlm2uanmsn(4 lenxfciadlpDeli o;( texo(opnu4lle lieiatf Dum(m no1alenmictlsfm2eauvonu0tetnirciatoa  lueil( tetrim oo1lpe mfei sf rrm(r no1ole mo3iydlm uluvpnt0trxrmfciy1lmtraues t)sruoxmpnudamtn neilt  rua(mpnu0tet mi3ild mDem( on()trxoir3io1optraieslt)t2tr(m iy1om nmncsl(fs2uauroot0tlx ii3iadlsDem(mp u)trxoxf iatfptr nvo;( seto(m3nydlmenlfvsls  Dumx  nt0oeen i3ias a emnmpnt) rtnif3oodfaD lneo;s)srur(rpio1llte ivt ()a2rr(mpou4tpen f3iadfm2eanvsn(4 eenmo oydlpt luvi;s0t2toxr ny4ole lict t  Durumpno4tex iietytfa rl(vp t0aeeoir3oatom r uvi;t trxoim iydom  mivtls) rua(m ;t0aptoiiciyt mDem( p u0 ltomoctotfaDrlieil(0 etmio3oodol e ics (f rtaur oo0tlx iieiltlm rlump;u0tlxrxociy1fptrli ols)t2uoio iy4al elncsl() 2trxmpno1tpenifctlsfs umuvo u0trtoircoadopteluvs s setm(o io1ameelnvias  ruaxr ;t0opt iictad m2umnvs;(4areomo3oo1fmtean sls0s2xo(m iy1ll emicil()arumu o;t1tee mfciyd s uau s t)tetrir ty1fm  auei;t0 ruriopoodlmeemieiat arurx ooo0tltnmf3iadfaDrmnmsnt0trtomr3ta1fmt an s ( s2to(r no4ap nmicsas a2uax  nt1oetniietldls2ul( o;(0texrxf3iotfatrln s;s t2tmxm3oo1op elnvsasf rraur nu0tpeoiocild m rmnvsnt)trxniocoodoaD  u i;s)texmxrpnu1omen fet t  Dtmx  ;t4apeo oeiaslaDuauvo (4tltoif3oo1op eli sl()t2xoimpiy4lme  neil() 2tmumoot1tpx micilsfmDeluvont0alxrxocoodomD  i o s0 2tr(m oo1am nliesas  rtax  ;t1tpx iictld s rl( p t)teeoir todlmt lueil(  rumxopiodoltnlics t)arrr(rpnu1open i3tas m emuvo;(0trxrmfcoa1lmtelivi;s srtmiopio4alt  ivi t)aDurxmpnt1aee  f3iys s2ranmsnt0trtoif3oy1omDelueslt)truo(rpoy1apte ncils) 2tm(rono1tpeomfciasfm ra( o (4 lxoircoodom rlneils0teum(m iodllenlivsas srtmxr nt1ole iiciltfm2rmums;t) rerxo3iodfpt anvi t0s2trio oodoltemnci (f Dumumpnt1olx  ietltfaDrm( p;(0tltoir3totoatelieolt0 rxmxopiy4op elfcil(f 2ua(mo;t0oltoiociadfs rmnmp u4artrio oo1omt aivs s0t2umir oodal  lfeta(f 2tmxmo;u0tle ii3iydlm2el(vs;u)artnxo3oo1fptrluvsls0srumxo oo4al nmivt tfaDtr(mpou0apenmieiydfm2rlumo t4aetomr3todfp r i o s trxrim3oydllt livi (f rum(moou4tlxnmiciyt aDumnvs;t0tltnif3tadfpteaivo;t)sexr(r iy1alt  ivils arua(r oo1tlen i3tldfmDuluvpnu0 exoif3oo1fmtrlnesl( srxrim oydap nlncs s)s2ur(  ;u4ape ii3tyd s rluvpnu) rxnmf3oodfm elies s)sexoimpoo1lm  lncsa( sDrr( o;u0teeoioeiltfs2emuvpnu)aeerxo3iotoaDr nei;t seuoirpio4opte ncs tfsDuau  ;u1texomi3tad mDuau on()trenmociadlpD ai ils)srtr(r3oudap elfct s) rtm(  ;t1texo iciatfs emumo u) reomo3iytlatrlnvs;t0teto(mpnodopenliesl(fsDrm(  ot0tpenii3tatlsDeluvp;t0artoxrcoo1opt ai o;t  exrimpiu4al   ics s s2umxrpno0opxomociysfm rm(vs;u4alerir iodom e iei;t) rxo(r3oo4olee fei t)arrr(m oo4oexnif3tatla2eaums t4aleoxf iytomD luvil(0trtm(m3nu1llenmnctas aDtaumo;u4tee iietaslm rmuvp u0trenxf iy1lm   nvo;t trxmxm nudlpen fvs sfs2tmxmoot0aptniietltlm2uluvp;t4tlxrmo tadoaDr ieols)s2uoim oydlm nlfeslsfsDuaxr ;u4aeen f3iysfmDua( snt0aeenxf ia1omt ai i;s)t2to(r iu1am emnvsl(f 2rmum oo4tlenmiciyd s2elumo;t4arxrmo3iotfmtr ues t)t2urxr3no1am emfciat) Dtr(r oo1openiiciasls rmn p t) leomoctotlp   n ilt0trtmio oy4op n nvt () Dua( onu0altn o3ilsfaDrau o;u4 ltnxf3totlpD livs s0texmxmpiy1apte ivsl(fsrur(mpou0ole mieiyd a2rlnmsn(4 lxnmf3ta1lmt lnesls0sexr(opou4lmtelfcsat)sDrm(m ;t1tlenifeiat s rlnvp;(4 exnmr3oatlaD anei ( teuo(m3no1lm  lnct ()s2ua(r ;o0tpxnioctltls2umnmp u0altoxf3iatfpD li o;t0trtr(o3nodoltnlieils a2trxmpnt1ape ii3iadfsDel(ms;t0tlxniociadlptr i slt  eurim iu4ape mfciatfa2ua(moot4tptomo3iaslm emump;u0alxrxr3io1lm r uvilt0 rxrxr3oodop nlfvi tfa2ua(  ;t4olx mo3tytlm2em(vo t4aeenmocoo1fp rlues;(0t2tr(rpiy4amt mfvt ()aDtax  nu4oex mfciatla2rlnms;(0aeermr3iy1faDr nesls srxrio no1lmtnmfvsl(  2rax  ot0tptnioctytfsDul(vp;(0aeenmf tatfmt  ivo t)s2to(m3nu4ll elicta( arurum nu4aptnmi3iysfa2emnmo;()altoxr iadlmDr ivo;s0s2umxm3iydllenlivslt srrmx  no0olxnioeiasla2umumo;u4 etnifciytfm  lu i s0t2urir nudamenmncs tfs2rrxmp;t0aex io3iyslm2rln o (0aexrxo iodlm e n i;( t2umxr iodal  mnct sf rtauronu4tet  o3tldfmDea(ms;(0arenio oatfp elu sl(0srtoim3oo4ale lfcsatfartrx oou0oltnioeiasfa ra(mo t)tlxnio3ia1oaD  u i;t  rumimpny1lpenlfviasf 2urxrpnt4texo ieiytls2ul(vo;(4 rxoxf iy1opDe ueo;s0 rtoxm oo1lmenlfet t  Dururpot1aptnmi3ilt m ua( pnu0tlxnif3ta1fp r nvi;( trxmxr iu1aptnmics sf 2tmxmono4ape  ieiys a2eaump;(0tlxnxo3iodlaD  n i;()trxoxo ou4amte ics ()a2um(m ot0oexomiciyd sDrln o u0 etrxf3to1omt  u ilt0s2xo(o ou4olee nvt t aDua(mooo0olxn oeiydfs rmuvpn(4alxnxr iy1om  ai s;(0 etmxm no1aleelivtat)a2rmurpnt0oex  o3tysla2uanvs u0altnxo iydopt livo t0texm(o3ou1om nlnvil(fs2raxmono0oltniicildfa2ulums;u)tetomr oo1omt aies s0sexoir3io1op   nei s)sDrmx o;u4aleoii3tydfs rlnvp;t)altoif tydfp rluesl( t2uo(mpou4om emfvslt)sDurum ;o0ape  fciadfmDeanvs t4tetnmociodfmDeli o ( truoio oydllee ivtat srrm(rpot1tle  feiltfs2uln p (4 eermo3oatopt  nvs s0s2umxmpiu4lleelnvsltfsrtm(r oo4teeo o3iytlmDuanmsn(4 lenmf ootoatelues;s srxm(o ou4omtnlncia(  2taxrpno0ole mietls s2ul(ms;(0aleoxr3tytlpt anes s t2tm(m io1alee ncsltfaDua( ono0ale ii3iysfm umu o u4alerxfctatopteaueo (0 etrxr3nodomenmiviatf rtrx pou1tlx  i3tysfaDra(ms u4 lxrmf oatlp elivol()srto(o3oo1lmtn nvsl(  Dtr(moot4apx mieiad a2rluvs;u)tleniocoytlp  luvol( trxrim3nu4lltnmncias a2rrxrpot1aetnif3ilt m uluvo;u4 renmo3iytlmtrauvs;()truo(o nodlmtemicias  Drmum ot0olt  ieiatfs2uln s t)texrio3tytlpD  ieo;() 2uoxo oudlmeemfes t a2umuro;o0aex if3tlsfaDemnvs;u) rxomfctytlmtrluvo s0t2trim3ny1ap  lfctls)srta(rpnt4oleoio3tadlsDum(mp;u0 lerxocoydfpDe uei;s  ruoirpiy4omtnlnctas)aDua(monu4ole ii3tasfs2eauvs u4 etomfctotomDeaivolt) 2xoio3oudlmee fvi t  rumumoou4alt  f3tat aDranvs;u4aexnmr3ty1op eaues;s t2tr(opiu1olee ncs t)aDra(m nt1opxn o3taslaDumnmo;t4aexoxr3ia1op rln s ( t2ur(o io4ol elfcs ( srumxr ot1aptn fctydla rau s t4arxrio3oodfp   u s;t)s2urim3io1llee ivt ( a2tru ono0aee  iciadls2ea( on(0tetrio oa1omD  ieo;s0texoxr ny4lptn neiat)a2uaxroot4aexn fctadla2ean on(0 etrmocoo1opte ivil( truoxm ou1ol   ivt s) rrrxro;t4oexoifciat a rau onu0altnmr iytlmD luvs (0tetmir no4om  mfcta(f 2um(mp;u1alxo ictatfaDea( o;t4 rxrifctatfpte u s () 2xmir3oo1apenlfesasf 2rm(ronu4oleo f3iadfsDrlums (4alenmfctytom raiei t s2uoim3no4omtemnetls)a2rrxr nu0tptnmocils s2ul(vo;() leoio3iy1oa   nei;t  euo(opiodap nmfeilt  rtaxm ;t4tee  ociyd m2el(vonu4 rtrmf totlatelivol()t2urirpoodaltnlivt (faDua(  ou1ole  f3tydlsDel(vo u0 exnxf iydlat anes;s0srumxr iudap nlfei t  2uaxm ot0apxoii3iys s rm(msn()trtrxf3oatfmD  neol(  2toxo3oudlpt mnetasfaDraumpoo0apeoioeiadla2el( p;(0arxrxf oydlpt  n s;s0teuoio3oydome  ies s srtaur nt1apen o3ildls uanmon(4 eerxo tytfa eauei t0srtmxr3no4apt mnvs s) 2rmu poo0apx iictldla2rm(mo;t4tlenmr ia1oatr i i;s0srxmxo3no1lltnmnvsltfa2umu onu0olx ifeiatfsDean p;t)aetoxf iydlpDeauei (  ruriopny1olen fcsls) Dum( p;u1oetn oeiltls emn pn(0alermfciatfatr ivo;t  exmxrpio4ale livsa( a2rm(mpot4tlx mo3tld m uan o t0altnmf oa1fatrlu o (0texrxm ou1oltnmfesltfsDur(rooo0tpen ieild s2em(vont0 eeoir3tydoaDe nvi s seuriopoo4oltnlnciat srrmx pot1opeoifeiatls2elnvp;u0tetnxr oatlatr n s;( srxr(opiudamtnlfvi tf Durur ot0teeoioeiadfa emu o;(0altoifcoo1optr ivo s sexoxo3io1lp e ncslt a2tauro;u1tet mo3iyt a ea(monu4trtnmo oadopDe n o;t teuoio ou1am e ncsas s2ur( p;o1oltnioctat m2ulums u4 lxrxfctadfaDrliei t0trurxr io4apt mnct sfa2rr(m oo1teto i3tldfsDuln on()tltrmr totlaDranei t0trxmio io1amtemiesls sDrm(m ot1tpto fciysla2umump ()arermr3oa1fmD an o t  etm(opou4olt  netasfs2raxr nt4optn i3ilsfs2ulu o;(4 rtrio iotoaDrln ols)seuoimpoodllt  feil()aruaumpnt1open fcilsls2emn s;() exrmr3oa1fp elieil( trumim iu1aptnmfeslsf 2ta(r ;o0ole mfetat s umn o;u4aetoir iadlp eaiei s0setoiopoy4opt mfetlsfsDtmur nt1optn feilt mDelnvs;u0artrifcoadlpt  n i t0seurir nodomt  ivsat  Durxm ;u0apt iiciat mDrl(vont0artoxociy1fpDelueil(0s2tmxr3nydaltelfvtltfaDuaxront0apxomfetls m2um(mp;t4trxrmr3tadlaD au il( s2tmxo3oo1ape miet t) Durxmp;t1apx  ieiadlmDrmnvs;u)tlenmociatfpteaueo;s texrxr oy4lm  miei s) Drru pnt0aeen i3ildlaDea(ms ()aetnifciadla raivo;t s2toxm iydllte iesas arra( o;t1tetnio3iytfa2rluvo u4 leomocootoaDr neols teuoir3oy1apeelicil(faDtmumooo0tptomi3ilt s2elnmp;()teermo3oadfptelneo ()truo(r ou1lme  nct s)srraxm ot1oexniicils m2uln pnu4alxnmr3oatlm rluei;t t2ur(mpny4am n ivslsfs2tm(  no1aet ioetlsfm em(ms () exoxf iotfmteaivsls sexo(mpiodlm elneil(  Dtm( p;u4aex  o3tat sDranvp (4tleoio3oy1fpt an s;(0teurirpoo1lmt lnctlt srra(mo;t1oeeomo3ildlm rln snu0altnir tydfm r uvs;t) rto(o3oo4amt mivi ()a2rr(rpno4olt ii3tysls um(vo ()tlxomfcto1lpD aues t t2um(r iodaptelictls)aDtrumo;t4aetoif3iadla rm(mp;t)teenioctotoa  lu ols)texoirpou1op n fcsas)srtaxronu1texnmociaslsDumuvpnu4 exrxocoodfmte ieo;t  rxrir io1am nlfeia()sDtaxro;u4apx moctlt aDemn o t0artnio3iatfat  uvilt)setmiopnodolt lnvs t s2rmum ;t4opt  oeilt s2eauvonu) rtoxoctadlaD  ivs ( srto(rpnudaltnmnei s srur( pou0optnifciat s2uanvsnu0 rtnmfciytfmDr neo;(0trxo(mpiy1opeelfvtas)a2urx p;t4openmoctaslmDum(ms (0alxomfciodlat auvi;()sruo(m3nu1lpee fet sf rua(r nu0opxomo3iadfaDem(vo;u)tlenmf iydomte ivi;s)sexmxr iodlp  mfct s a2trxmpnu1aet  f3iyslsDrmumont)altoif oodfptraiei;t)s2ur(m3iy1omt lici ( aDtmxrp;o4altnioeild s rl(mpnt4alxomfcoatoa e n i (  2xrxr nu4open fvi ()srrrx  no4aexniictltls2rmnmpnu)arxnif3iy1lmDrauvi s t2xmir no1lp  lfetltf Dum(mo;u0altoiictlsfm emums;u0tltrio3oodomt li s;t0 2tmim3nu1omee ncilt)aDtrx pnt4oetomoctlsfaDrlumo t)tetomociytopD  ueil(  rur(o3no1amen ivtl()aDum(m nt1aeeo f3tyd s ulums u4trxomfciytomDr ivi;s)teurir3no1ol  lfes t srtm(rono0optnioeiytfsDuan s u4alerxr to1fa   i s (0trtrxm3nu1oleelnei t)a2rmuroot1aetnmieiytfmDrln p;t4 renif3oytopD  i o;t teurim3oo1alenmfesa(faDrrumoot0aeeomfeils sDra(vpnu0trtomf oodfmt lu s (  2urxrpiodameelict tfartau  oo4tptomf3tlsfsDran s t0 lxrmo ia1fp  luvs;s s2umim ou4ole  ivsls) Duau p;u4teen o3iltla2eln p;(4artrmf tytlmD anvs;(0 euoiopiodlpe  nesa(  2rm(rpoo0apenmicildlmDrl( p () rxnmocoytopDraivslt t2trxopiudll nlicsa(  Dra(mpnu0oeeniicildfs rl(mp;(4tltomf todomte n s () 2xmxmpny1apt liei t aDtmxmpnu0texoio3ilslm2emnmpnt0altomf ia1opt au o (  2xo(o iy1amt  nct s  Drm(m no1apeoii3iys m2uan s u)altoxo ootomDe ueils0 rxrxopoy1lleelfvilt)aDurxr ;t0oee iiciaslm2ua( o;t0 ltrxr3iadop   uvilt  ruoim3oodapee nvils)a2trumont4oleoio3iadfm umnvont) rtnmo oatoptrai o;s) exrxo nu1aptnmnctls)a2tmumpoo4tpt  oetatfmDrluvs;t4tetoir iadom rluvsls0 rxo(r oy4olt  ict tfaDrmu  nt1ale  iciyslsDeaumsnu)alxrxo3io1latrln ils)srur(m3io4aptnlivi sf 2um( ono4texnmiciydfm em( s u)arxnmocia1la  luvol( s2ur(opno1amtemfvslt)aDuaxm nu1optnifeiltfa ulumonu)teenxrctadopDelnvi s)trtoxo ny4al  mncils arta( p;o0tpxnmoetasla2ul(mp;u)tltnmr3tydopDraivo;t  2xm(opoy1ll emivs t  2tmxmoou0teto ociadfa el(mo ()trtnxr oatla  livi;s  2uoim ny4aptnmfetat) 2urumono0oeeomoetytla2uan s;t4trxoif oadlmtraivo;( srum(o iy1lme lfvtlsf rrmxmoou4aetomoetyt s rmnvp;u0alenmfcootomDrau i;(0 etmxmpoo1lpeelfvsltf rtmur ;u4aet  o3iat a2ran p;u0tltoirctytomteaies;s)t2uoirpoo1omen ivtls srtmxmont4tpe moctltfa2ulnvont0tlxniociytopteauei ( t2uoir io1ape  icilsf 2tmxr ot1optomoeilsla2rlumonu4 exomr3oadlaDe nvs s  eum(m nudam nmfesas s2ra(moou1tpt  f3tatfsDea(ms;t)trerxo io1fptr ieols  2trxo iu1alte ncslt srrrum ou0ale  fctasfs2rmu p () etrxf totlmDean o t  2um(r3nodll  lfei (fsrtmu  nt4tetnmi3ildfaDuluvo ()tltrmr oodfp e ueo s)texoxr3no1lm  lneia( aDtm( pno0olto i3tadfmDelnvsn()tetrmr oo1lat aiei s) exmim3iu1om  lfvi s)s2uru onu1tpto fctld aDrlnms;t4trxrmf3iatlptran ols tetmxm no1amenlivtas) rtrump;o0aexomicils aDeaums;u0texrmo oodlmteluvo;(0s2umxo3oy1ol elncia(f Duau  ;u1apenioeiysfs2uau s u)texnirciodfm eli s () 2xrxr3iu4lpe mfcil() rurum nu0oex  oetls m2el( p t0 lerxf tatoptrlu i;s texm(r3nodlmee nviasf 2ta(rpnt0opeo i3ilsfmDuluvo;t0texnxfciatfmtelu olt srtmxo oo4op nlfciasf 2ta(  ou1aptnmiciys sDumumo u4 lerxfcootoaDrluvs s s2um(o iudaltnlietas)arumxm nu4apt  f3iyt sDrm(vo t4aexnircio1om elivslt0setm(r3ny1lp nlfeilt a2ra(r ou0optomf3iatfm2uan snt4 reomoctydlp  lu s ( srtrxo ou1op e nvsatf rta(  ;o1aeeoifciltfs2eln o t0 etoif3oo1lp eaieo s)trxrio3iydomee iei s aDrm( oou0tlen ietytlsDemu p t4areoxr iodfpteluvol()tetmio3iydomtnmfcsl(fartmx  ;o0tleniociasfa2rm(mpn(4trxnio3iotfpteaieo ()trtoimpny4ale mivsls)aDtrxrpnt0olen o3tltlm2ulnvs;t)trtoifciatomt anvolt)s2uo(r3iudllen net s)aDtr(r nt1oltn feiytfa ulnmp t0tetomrciydfa  an o t s2xo(m no1om nlfetlt srur(root0olenmociat m2eau p (4alxrmf iytfpt  ueo () etmxo oo4ol nlnes t arumu pot0aptoii3tltls ulums (0arxoir3totfmt  neols) ruo(m oodam  lnesltf 2trumo;o0tet mociytfaDel(mp;t0aexoxf3tytfpDeli sls)srtm(m no1omt  fvs sfsDrr(  ;u1olt mocils mDelnvpn(0tlxnif ia1fmt  u s;() eumxr3nu4aleelict s)aruax o;u4opxomietltfmDra( pnt0aeeoir ta1opte u il(0s2trxrpnu1lmte iesat)sDtru o;u4tptnmo3tlslaDrlump t4tetrmfciodfm  luvils0setoir oo4amtemfvslt s2trxr ou1olx  ieils a2rlnmp u)aetomocto1omteaneo;t0t2uoio ou4omt  fetls  2rrum ;o0tle  f3iad m2ua(mp t) ltrircto1fat luei;( t2xrxo3iu4omt mnvtl(  rumu ono0olt  icils m2ra(mp;()artoifciotfpteai ils)setoir3ny4omen ieta()sDuau p;u0ape mo3iydlsDumn on(4aexoxo todfatr neilt  rumxrpnu4omenlnvt t)sDurur ot0aex ii3tys aDeluvp t0trxoxrcootfa r nvi ()s2ur(o3iydam  lfct t)s2ra(r nu0aexoifctltfsDelumsnu0 lxnxf ta1oa eau o;( t2tr(r3iudap e nct t)s2rr( ont1tetoiociad sDul(vsnu)aetnir iodfa  livo;t t2tr(o iydopt mncils) rumu  ot1oexo o3tytfa umn o u)tlxrifciadfmD  neo t0t2urxrpnydap  mnesa() rra( onu1ale  ociytls umuvo;t4 lxrxo3iy1fmDe ueils) rumxrpnu1al e netlt  2raxm oo1opeoioeiydlmDrmu p;t4tlxoxociodfp   ieols)s2xmxrpnydlle mnvi ( sDuaurono1aex mf3iat sDrau p;t0 exnmo oatlat aivs;()trtr(r ny4ol  livtls  Dtrur nu0tltnmieiydfaDemuvon(4aeeoxo3io1op  ln ol(0sruoio3oo1ole lnesa(fsDtruronu1opxnmf3tls a raums t)arermocoadopDraneil(0trxr(rpnudapenlfcsatfs2raumoou1alen i3tlslm2rmumsnt0texoio3tadoat  u o s tetoxr nu1alt mnvi s  2umx  ;o1olenio3iysls umnvo t4tlxnmfcta1fpD auei (  rxoxr iudalt lfvtasfsrtrxm oo1texnifcilslsDulu p;t0tltrmf to1lpt  ueol( texm(r ny4lpt  ictl(fartaxronu4altn oetldlsDeanmpnt4trxrmo3iy1laDr ueslt  rtmio ny4opte fvi tf Dtmur ot4olt  fctat a2emnmp;t) ltoio3tadlmtelivs () 2toir nu1lpte nvtltfsrtr(  ou0tltniiciysfm2ulu s (4 lerxr ta1lmtrluesls0 2uo(opoy4al nmivias) 2tr( oot1alt mieiytlm2el( pn()artrxf3ootfaD li i;t) ruo(rpoy1open icta( sruaxr ;u1optn f3iasls em(vs;(0aeenio3iodlpteanei;t trurio nydale  fci sf 2rr(rpnu1aetomfeiatlsDumnvo;u0teerircoo1lmteai i;s)t2urxo3ny4omeelnvs (fa2ta(mpnu4ole  ocils mDeauvp ()texnxo3oodlpDelu i ()teumxr iu4apt miei ( aDurx oot4apxnioctls m2uluvsn(4 exomo iodomDrlu o (  exmxr oudomeemnct s aDumxmono1apxoiiciyt m2rl(vs u0alermr iydfa e nei;( trumio iydll e fcsls  2uau o;u4tlt ifciysfsDemnms t0 rxnif todomt  nvsls  rto(r3iu4aleelfvs t aDtmur ou1oltomfetyslmDuluvp t)arxrmf3tydoa elnvils srxoir3oy4al  lnvias)a2rmxmpot4oeeo i3iysfaDelu o;t)aexnif3tydoa rauvs;t trtr(r no1op nmfet s srur( pno0tpe moeiat a2rln pnu)tlenxrcoytla rlneo;t0seum(r ny1opt  icslt)a2rmxmonu0tpen iciytfmDuanms t4tlermf3oa1lm r ues (  2toxopiy4omte fvtl()arrau ont1olt ii3ildlmDea(vp;u4 lxnmo3ootopDrli o (0 eurxr oo4amenmnvsa( s2uaumpou1oexoiictas s2emn o (0aexrxrcoydlpDrluvils) 2tmxr oy1aptn ict ( sDrrumoou4tle ioctaslm2umuvsn()arxoif iydla r ues (0srur(o iy1aleemicsasfsrrruront0tpe io3tys a rlumo u0texoxr ootla  lies;t)truo(m3no4lpenlfvils a2raum nu0opxomo3tatls2emn p ()alxoio3oadfa e uvs;() rxoxr3iodapee fesls  2umumpno1alt mfctas sDranvo;(4aexoxf oy1optean o;( s2trxm3iy4ll elivslt)s2tr(mpoo1alx io3ils m emn p;u4trtnif oadoateai o s0trxrirpnu4ameelnvt sf Dta(  nu4tpe  o3tls a2el(von(0artnxr todfatrlu s s)trumirpoy1lp e ncias aDrmxmoou4apt ifciysfm2rau s ()alxrio to1op raueols0 euoxmpiudapenmfvi sfaDrmu onu1aleoifciyd m2rlu pnt0arxrmocoo1oa rai i ()teuoxo oodalenmnviat arrmxm ot0tptomo3ias a2el( ont4 rxomo3oodfa rlu s;( teumxo no1lpe miesatfa2rmx o;u1tpt mfctlslaDumnvo;t4texrxr3tytfmte ues t) 2uoxo iydam  liciat)arrax o;o0teeoioeiydlmDemu snu0trxoircootopDe ivi (0t2xmxm oy4al emncs t s2taxr nt0aetomiciadlaDrmnms;u) rtnxo3tatopte i o (  2trio3io4ll e nctat)arumx  ;u4apxnii3ildlm um( snu)tlxrmfcoadfaDe nvs t0sexo(o nudal e fvtas s2tmx p;o0aleo octaslsDrl(monu4arxnmfcoy1fmtrln o (  etoiopou1omtnlfeilt s2ua(r ;u4teeo ieilsfaDua(vp u4 rxniocto1faD auvil(  2trxm3oy1lpenliet ( sDrrx pot0ole mi3ias a ua(mp;u)trtrirciydlpD liei () exr(o3iudlm elfvs s)aDrmxronu0opxn feiltfa rl(msnu0teenxf3iydopt auvs t) exo(opnudope lnvil()aDrrurpot1aleomietytls eln snu) reriociatlmD lu o;(0setr(opnu4ale mfvslt) Dumxmono4olxoif3iasfs2um(vs;(0trtrif oydop eanes (0texmxrpoo4oltelfci s)aDurxr ot4oex moeiydlm el( s t4tlxomrcoo1fpD anei s0 2ur(o3no1am n ici t a2trxrpno1oex  ictldla2ulu s;u) lenmocootfatrlu sls0seumxo3ou4omtn neia( sDrm(  ;t0oleniieils s2rlumsn(0aeeoifcoytlaDe n ilt  rxo(m nodal n fvtl(fs2raxro;u0tet mictadfs2uauvo;u0 lenmf iodoa e n s;t s2xo(rpoo1ap nlieilt) Dtmur ;t4tlt  i3iysfm2ua(mp;t4texrxr3tytlaD  ueo;t0t2uriopno4optn icsasfsDurx ont4aexniictadlaDra(ms (4aexomfcta1op   uvs t0s2umir nu4lp eliei s s2tmxront4optnmi3tadla2umn p;u4 lxniocta1lmDrli o t0 exmxm3oudll emiet s arumump;t1apxoii3iydla2rln p u4trxrio3iadfp  lues;t s2umim3no4lm emfcils sDrrxmpno1apxo ietyt aDrln p u) eenif3ty1fmDeli sl()trurir ny4lmeelfesls)aDumuro;o0tlxoifciys aDranmp;(0aeenxf io1fmt  ivil()srxrxm3oy1ope  fvil(f 2urxmpno1aexnmoeiys a2ean o;t)altoxo3tadoptelieo (  ruo(rpnu4altelncia()sDta(mp;t1alxn octltlsDua(vo u4 lenxo iotomDe nvo s)setr(mpiy1om  mneiatfsDtaxrp;u1apt moctyt mDraumo;t4texoxrctydfat lnvo;()t2umir iudom  mnvsl(fa2rm(  ot0olxomf3iatfs rmumon(0 ltomr oa1late ieol( srtoir3oydlm emfcils a2uauro;o1tpt moeiydfaDuan s;t4arxrmr3iodlmtr neslt  rurxrpio1lptnlicsl( aruaumoou1tlxn feiyd s2ra( pnu4aexoxf oatfp r nvsls)setm(o nodalee icsa(fa2rmur ;u1opto octyt aDua( s u) exrxo3iydlmD aues ( srxoxr3ou4omenlfvsl( srrrxm nt0tptoif3iltla2elnmsnt0arxniocoydfpte ieol() rtm(r3oydlpe mfetltfsDum(mo;o0apx if3iadfm2emuvpnu) eenif3oytfm e i sl()s2xoirpnudale  ieilt srtrx  ;t1olxnif3tyd sDel( snt0tltnmr3iy1lmD aivilt0t2toio iodamenliesl(  rrm(ro;t0open oeilsfa2emu pnt)tetomrctytlatrlieo s  rxmxm iu1am emneta(f rrm(  nu4oltoifciasfs uauvp u0teeoxr3iytfaDr ivs;s0srto(o3ou1lp e feil() rrmu p;u4aexnii3ildlsDemuvsn(0trtoifciydfmD lneol(0 2to(opiodlpt licil(  rra(mpoo4aeeoioetadlaDuauvp;(4trenxr3todlptr i i ( srtrxr3oy1llen fciltfsrra(mp;o4tpe mi3iytla2um(mpn(4 rxnmrctydlaDraies;s0seum(r iy1lmeelietas)sDururo;u4tleo ictadla rm(vs u4tltnxrcoytlmD  u ols0t2xrxo oy1ape lnvt s)s2tru oou1oee ifeiytls uanms;t4aetrmf3oatlat  ivo;t0srxrxmpou1omtnlfesl()a2ua(r nt1tlen o3iyt s2umums;u)trtrxfciadfat  ivi s)srxmir3oo1omt  nvils  2tm( oot0tpe  ociyt mDum(ms;t)arenxr3to1lat  u i;()s2xr(rpou1ll e fvi () 2urumono1tlenmfctas a uanms;t0arerxrciadlaDelu s s)s2xo(o oodom  mfeta(  Dtr(m oo0alxoiociytfa2uanmonu) rtomo3oa1omDrlivo s0sruo(r no4lpe licsls  rtaxm ;u4oeen octadlm2umuvp;u0arxrxo3ootlaDrln s ()trtrio nudaltelict t  rtrx o;t4tlenifciadfsDeluvonu0tleoxo tydlp rlu s s0texrir nodol e fci t)s2taump;t1oeenmicilslmDelnms;u0 ltrxo iadlaDeln o s0 rxrirpoo4lmee ivtls) 2um(ro;u4apxoifeilt mDum( s;u0 rxomociatfpt luesl(0 rtrirpoo4apt liei t  Dtm(ro;o1tpeomociad aDra(vp u)trtoxocio1lmDe uvi;s t2xmimpiudoptn fct t)a2raxm ou4tpxoif3ild mDem(vo t4aetnxo oy1fate uei;(  exo(rpno1lmeeliei t)s2tmu p;u4opt mf3ils aDulnmo () lxriocoo1latr u i t sexoir3no1am   nctlt) 2rmuront0alen iciytfs rl(mpnt)tetrmf ta1oatrau i;t) rtmxopoodlpe lfcs t srurxm nt1olxo fciyt s2elnvp;u0 rtnxrctodlpteanvo (0 2tmxo3ou4ole lfvt s arrau pou1tltomocildla ean p;() rxnif3oytfpteau sls  exmirpiydapenmictlt)a2uru o;u1apeoiictyslsDemuvsnu0aexnif ta1laD  u o;t)tetmxo oo4ol n nvta()sDur(m nt1oltn feiydls ea(mp;t0 rxnxf3oy1opt lnei t0 2to(m oy1amtn ncs s sDtrurpou1teeniieildls2rlu s t)alermr3tytoptr iesl()trto(m3iydame  fcsls) rtrxm ;o0apeo fctytlm2ean p;u4tltnmocty1latelueils) 2xo(r3oo4opeeliei ( s2uaxm no1oltnioeiysfa ua( s;t4arerirciatomtrau s (  rxrir3iydlpeelfvi () rumurpot0tptniicilslsDrau o;()aeeoif oadlmtr ivs;s texm(rpiodameeliviat s2rau oou1aptnioeiasfsDea(vonu4artrxf3iydopt anvil(0t2um(rpny1lmeelfcia(fs2rrx pot4oleoiieiatfa emn p u) rtnir3iytfpDe ieil(0texr(m oo4ap  mnesls  2uax  ;t1tpt iictytfm2ulu o;u)alermo3ootfpDe n slt tetoxopiu1ap n fesl(fsDtmuront0apto fcildfa2raump;t0trtrifctotfaD anvo t0teurim ou4ll emfvtat) rumxront1aeeo f3tls s uan o (0aetnxo3tatoptraues ()seumxo iydolen ivsls a2uru oot1tex  ictlt a el(vs ()tltrxfctytfa  luei t0teurxr iudap emncs s a2ua( pou4aet ii3iyt s2rmn s;t0aetomr3tydlpDe n o t) 2toir3nydlmtnmnei ()aDua(mp;t4aee mietadfsDua(monu)arxnir ty1oa  liesls s2tm(rpoydlleelfetlt  2rru onu0alxnmfctas m uanmpn(0tltrmr oatop e u s ()trurxr iudaptemieilsfaruru oou0optnmi3iad s ra(ms () etoircoo1oaDr ivo;()t2umio3oy1lpt mfesl( artr(rpnu0aex iieilt sDra(msnt0altnxf3oy1fm r ues s trtrir3oy4alt  iesat arrm(mpot1teenmf3iydfs2um( p () ltnxo iydomD  nvo (  rtoxopou1apenmfvslt)arumurpoo4tle mf3tldfs2rm(mpnt4altrmf3iatlaDeaneo;s)sexoir ny1oltn fesat  Dtaxmpoo4tex  ocilsla2ea(mpn(0trxrmf3ootop   ivsl()t2umxm3oy4oltn fcia() Dtau  nt4aet ii3iaslaDel(vp t4trxnxo tytlpD lu o s) exr(m oy1aptnmieiat)a2umu pnu0alt ifeiad s rlumsn()arxnmf iytoatr n o ( s2trxm3nu4llt miesl(fsDtmxrooo0apt mocildfm2uau s;u)trtnif oo1fmDr u o s  rtm(m iudom emfeta(faDtaurp;u4aet ioeiat s ean on(0 eenmf3tytlptelues s seuoim3ny1altn fvsasfaDrrx pnt1oeeoii3tytfs2ulu o;(4trxriocoodoaDe ies s)tetrio3ny1ol   ivs tf rua(mpnt0opx  o3tyd s rlnvo;t)aexoxfctodfp  anvslt) exo(r3ou1alenlfvsls)aDuaur ot1apenifeiytlsDemn o () etnxf iytomD aivo;s0 rtr(mpnydaltemicsl(fsDuauro;u0apxn oeiytlm2uanvp (4 rxrmo oodlptr uei t0 2tm(m3oydom  mieilt  2tmxmp;u1aetoiociasla2rm(vsnt)aexnir ta1fp eln ilt0 eurxm nydlpenlncia()srum(rooo0optoiociadfa emnmp ()trxrxocoo1oat  uvi;s s2um(m3oy1ol   fvias) 2tm(  ou0oeenio3tytla2rlnmp;(4 etoxo oytoat aivslt s2uoio io4al nlfvs sfs2tmxrpoo1opeo oeilsls um(vp;()arxrif iydom eluei;(0sexoxmpoo4altn fvi s  Dtrxrpot4oetoio3iytls ranvp (4 etoxo3oo1laD an ils0 2trim3iudlp emfvi s a2um(m nu0tpxn iciydfsDrm(vo t0 renif ty1opDe ivol() rxrxm3iodalt  fctltf rtru pno4opx ifctls a2el( s ()arxoif3tatlateauvil()seurim3ou1am elictl()s2tm( p;o4tex  fctad s2rmuvp (0trxnmfcoodoatelivil()texmio3ou4omenlivt sfsrrmu p;u0oeenmfeiad a2um( s;t4 lxrir3oatfpDe ieo;s)setoimpiy1openmieilt  Dtru  ot0tltnii3tytlaDrm( o;t) rtoxfciytlaD  u i;(0 rur(opiy1ame lfesl(  Dta(m ;u0apx  f3tatfsDua( s;(0 lxrmf3iatom elneilt0srtr(m iodapenlfcsasfs2tm(  ;t0open fctadlm2um(vp;t)trxoxfciytla raiei;t srtmxm3oy1lleelfvsltfarrrump;o4altniociyd aDuanvonu0aetrmo3oy1fpD lueo t) 2um(rpiu4opeemnvi (fartm( o;u1aptomiciatfmDea(vo;t4aleomr ta1lpDrluvi ()srxm(m ny4lme liesls) Dtax o;o4tptomicilslaDea(vpnu4 exrxo oadlaDr nvilt trto(r io1oltn neias srtrxr ;o1tpenifetyd mDum(mp;t) lermf tydfa raieol(0 2umxm3iy4aleemfciatfsrtr(rono0oee ioeiytlmDumnmp t0arxoio iytla elieols)srurxr oudaptemfcs s)srtmump;u1texomi3tld mDum(vp u)trenirctodfmD lueo;s0srxrim3io4omt lnvi t arumump;u0tpxomfeiydfm rmnmpn()aexrio oadlp rlueo;s)s2xrxrpoo4lpeelnct (f Duax  ;o4alt  fctadls emn snt4arxrmo3iadfm  aieilt  2to(opiudalenlietlt  Dumx  ot0aeeniociltfm em(mp;(0 lxrif ootfmD ai s ( s2trim3oy4amtnmfvslsf Drr(mo;o4tpx  i3iadfmDumump u4arxnir io1fm raieo ()tetrxmpiu1aleeliesasfsDtmxm ou0tpen oeiat mDumnmonu0aleomrcoytomtrln s s)s2tm(r nodlle lneslt arrm(r ot4oltoif3tadls el( sn(4 etomf tydlateau i;t)sexmim3oy4aptnmivilt  2uaxr ou0tlto oetlslm2elums;t0 lxnxo3tytfmtrauei;t0s2urxm iodam nlnvsl()artruroou0tpenio3ias aDra( p (4arxomr iodla eaneo;s s2um(m3ou1amtnlfvtlt)a2taur ;t4teeo ieiasla emu p;()aexomociytfmt  n s s srurxmpiu4alt lncsas  rtaur ot1tptnmfetldlm raump;u4altoif oy1op  ln o;s)s2tmirpiydop e fes t  2uaxrpou1tlxnmi3iys s2umu s;(4tltnirciatlateai s s0trtrio iy4ll  lfctl()a2ra(mo;u0optnifcilt s2ul( pn(4 eenmf3iodoptr ueo ()sexoiopoodalenmivta( sDur(rooo1oetoiociyt mDemu o;(4arxomo3iadomteanei;()s2umxrpnodaptn nvi sf Drrumonu4tlx mi3iyd sDem(mp;t0tleoiocty1opt  uvs;()sexmim3oydalenmfcsat) Dtrxmont4tex iocils m2uau s;(0alerif3oatlmte nei t  rurimpou1lleelnctlsfarua( onu0opeoifcild a el(vp u0 rxrxo ia1fpt aiesls)s2toxr3oydapen ieia(fa2rrxroou1openio3iatls ul( snu4aeenxr3tydla eli o;t srtrir oo4apen fet s srrrx ooo4tet ifcild s2ulumonu4trerifcia1fptrau o t  rur(opoodam emfetat sDtr( oou1apxnii3iasfmDrauvp;() ltrxr tydoateluvs t0 etoiopnu1ome  fcsasf 2ur(  ;t4texomocils m2uln s;u4aetrxf ootfpDeauvolt0trxrxm3oydolenlnci (f 2uax pnt4optnmfciad mDuanvs;u0 rtnmr tadop raueilt) rumiopiydop nlfetasfa2umx ooo4tpeomociydlm em( o;u0teenxr3io1omD  nvo;s  rxrxmpny4apenmiet s arumxm nu4tpe mietaslm2rmums t4 lenif tadlpte nes;(0 etmxo iu4optemiesat aDtau pot4texnii3iatfmDulumsn(0 reomr3oa1la  ln i;t)seurxm3oydop emies (  rum(mooo0opxo f3iatlsDrlumo ()alenmrcio1la eaieil(0s2toirpnu1am elfcil( sDtax ooo0aetnmfcilsfa2ulumont4tltomr iodfmtran s;s) rxriopou1lptemfvia(  2uru p;u4openio3ildfs uluvo ()tlermr totlaDeanes s  ruoiopny1am elnetl()artaumoou0texnii3iat a2ea( pnt4 reoxr iotfmDeaivi t)t2umim3no4op e fesl() rur(rpou1alt iieias s2rmumo t4 rxrxrcoytlmtr nvo ( s2urim3iy1optnmicil( arurumo;o0aexnmicilslaDea(mp;u4teenmocto1lmt lu slt)s2um(m3nydlmte fvs ( sDraxmooo4oexo fetlslm2eaums t) reniocoydla  lu i ()truo(m3iudomtelncsl( sDua(m oo1tex mi3tld a2emnvsn(0 rxoir3oadfa ranvi;(0srtmxo3ou1omeelfvsa( srrru oot1tlxnif3tatlmDrmnms t)altomo3tatfmteluvi t0 exmir3iu1ope lnei s)srta(  ;u1alenmietatfmDelu o ()treoxrcootlp r ivi;(  exoxo3io4op nlnctatf 2trumo;o0tle mfctytlm2ua(msnt4alenmf oodoa  anes t trtoxmpiy1ol n iet ( a2ta(mooo4apt mictyd mDra( p u)altnmf3ia1opD ln sls0srxo(r ny1am emfvia(farrmu onu4tlenmictad s uaumo;(0 etrir3oytom raivs ()t2uoim no4aleemict s)arrmumo;t4tlen oetlslm ul( sn()texoio ia1fmD  nvi;s  exrxr3no4lp emics ( a2uauro;u0texnii3iltlmDumnvpnt) rxrmr totoaD ai s s  2toim3io1lpenlfct sfaDra(ro;u0oet mfctlslm2umn pnu)tlxoif3tytfp e uvils0srxoxr oy4olenlfct s aDumu  oo4tlxnmfetadlsDrmnvpnu0aexoifctotfmDeaivols)s2xmio iy1omt lfct ()sDrru poo1tltn i3iaslm ul(vp (4altnir ta1lpt  uesls)seto(rpoo1lpeelnvil(  2rrum ot1tpx  fetasls2umump t4 ltoio3tadop eanvs;s sexmimpoy1lm e ncilsf 2rr(mpou1opxn ociyslaDrmn sn(4 exoxr3tydoatr uvi;t) exoir iu4lpt  nvi ()sDta(mpot4oee mieildfmDrau pn(0aetnxr io1opDe ueo s) rxm(m ou4amte iet ()s2um(m nu1apx  i3iyd s rmuvp;u0artnifcia1oaDrln ils) 2umiopiudomt licias  Dtax pno1oee moeiys s2rauvs;(4tlerir3oatomtrauvs s srurir oo1ap   iei ( s2rrurp;u0tpxo o3iadfmDrm( ont0tlxomfcoa1fp  lnvo s0t2xm(rpoo1llenlfvs sf Dta(r nt4aetniictytfm ua( p u) exrxr ootfpt  u o s)texo(rpoudol  mnes t arrmxmpot1aptoiociytfaDrmn snt) rxnir tydfpDr ivs;t0srumiopio4opt mnvilt)srrm( ono4ale  iciyd a ua(mp;u) lxomr to1oateanvs;t0 exoir oy1olt mneta(f rtrx pnu1tpxomi3ilslm2rmnmp;u0tleoxrcoydfp rauvi s)srtm(opiu1ale  netatfs2tr(monu1apeomoeils mDua(ms;t4trenxr3iodomDe uvols0srxmxmpoydlltelfciasfsDtrxr nt1optn i3iadlaDrmumsnu4arxrxo tadom rluvs;s0srxmio iy4ll  lfes t  Dur(rpoo1apenmfciysfs2eaump;(0 etnxr iytlp e ieolt  exr(m iydap nmncilt) Duax onu4aeen i3ilsls2ulnmp;()areoxo tatopt aueols0trum(o3oo4amen fei () rraurp;t0tlx if3ils a eau s t0trxrxo3to1lptraneil(  2xrxr nodolenlnvta( srrax ont0apen fciydlsDrm( p u) etnxo tytop rlies;s teurir no1ap emnvtls  Duau pno1aet ifciysfs2ua(vs u) ltnircootfp raivsl(  2umxr3oudam  mnctl( sDrmxrp;o4opx mo3iysfsDrlnmsn(4trtnmr3oodfpDeaneilt s2trxo oydole mnvs s aruru pnu0texoif3iyslsDelnmont) ltnmfcty1latrlnei;(0s2xmir iodap e fei sfa2trxr ou0oexn o3iyd s2umu on() rermfcio1fmD livilt t2urxr3nu4om n ici (fsDta(m ;u0aeto o3iys a rlnvp;t0teeomo tydlpte i s;s s2trirpoydomeemnvils)a2rr( oot4apen fctytfa2ul( s;t0aeenmr oatlmD  i s;(  2tm(opiydlle livs s sDtaumo;u1opt mfeiadls2eau s;t0areoif iytfpte n o;s0seum(o oodapenmnet s)arur(  ou1tpto o3tys s2ul( ont4 leomociadla elneil(0 rxoxr oy4ol elfesas sDtm( p;t4tltnifeiyslm emnms u)tetoioctotomtelueo;( trum(o3oy1lpt  icsls srrr(ronu1tlt iicild s em( p;(0aeenir3iytfa rluvil()t2urir3ou1alt mfvsas aDur( o;o1opto i3tadlsDra(vpnu0treomo tatfaDran ol(0setrim3oo1llt lnet sfs2ta( oou0opxoii3tytfm2el( ont0tetnxo3iotlpteau s s) exrxr oo4openlfcslsfa2trxmooo0alt mi3iydlm2rm( s t4 rxomf3oy1op rau o s) 2xm(m3iodamtnlieils)a2rmxmp;u1opx  ociasfm2uanms;t) etnif3iatoptrauvo;s  exoiopno4olt  nvi ()a2trumpot1apeoiietad aDrlnvo;u4alxrmr todlateai il(0t2uoxrpnudamtelfcsat aDrmu  ot1texnmiciysla2rm(vo;t4arxrir3oo1lateauvslt t2uo(mpio1amt mnvi t)artm( o;o0teeniocilsfm rlumsn(4teenxfcty1omt  i s (0s2triopnodopt mncs t  2urumono4aeeoii3tadfmDrlnvo;u4trenifcoydomtr nvi;()truoxmpiodomen fcsa()s2um(r oo0opeomoetldls2ean pnt) ltrir tatoa e ieo;( trumxo3no1amtnlivtltfarta(m ;u1apt io3iyd s2uau pn()trtniocoytfatelivo () rurirpno1al  lfctls sDtmuro;t4opto f3iyt mDulnmp t0aeeoifcio1fm  lu il(  2tmxopiudlle mivsatfsrua(roou1opeomictlsfs ul(vp (0arerxo3tydop e nvo;(0 rtr(r ou1ameelivt (f Duaumooo4opx  octydlsDumumonu0aeenifctatop   ivil() 2uoxo oydlltnlict tfaDtru  nt4oeen oetydfm2ua(mo t4tlxrifctytfmDeaivi;(0s2xrxr3oy4ap emfctlt aDumx p;o4opxo i3ilt aDuln p u4 rerxocty1lpDe nvsls0 euoio nu4lmtn fvia(fs2tm(rono4tlen oeiytlm umu s t4trtnmr3oydfptr iei s)trxrxrpoo1om  mncias arumxmont1oetnmoetls m umu o t)areomociadoaDraies (0s2xo(rpnodlm emnci sfa2ta( o;o4opxn ociyt s2um(vo u)tltoxfciytfmDeai i;(0trurxo3oy1lle mfesl( s2uaurp;u4texoifeiasla ulnmp;u)tltnxo oadlp r u ils0 euoio ny4altemnctlt  Dtru o;t1apenii3iad aDuaumo;u0aexnxf3tydla rlnvsl(0seum(o3oo4ale  ncs sfa2ur(m ;t1tltnii3tatls em(vsnu4 renmfcoa1lpDraneo t)trumxm io4altemfesa(fs2tmumono4olx ii3iydlaDeauvsnu4trerxrciy1lpD lieo s0tetoio io4lm e nvtls  Drrum nt0opx  f3iatlm rau o (4aetrif3ia1omt aivi t)sruoirpoydomt  fvtat) 2uaxr nu0oee  o3tlt sDemnvsnt0 exoio totlm eauvi;(0seurxr io1op emicsatfa2tm(mo;o1aexo ietat a ulump;(0texnif3tatop   i i;(0truo(mpiy1ape  fci tf 2uru o;u4altnioetlslm ul( pnu) reoio iy1fp r nvo;( teurio iudope lneia() Drauroou1aptomiciad aDrlnvo (0tlxnxrciy1fp rlnvi s)t2xo(mpiu4ame lfvs ( srumxro;o4oleo iciyt s2rm(vs t4 eermr3totfa   u o;t sruoxo iydolt  nctls aDur(m nu1tee iiciat sDum(mo t4 rxoifctatoa  anvo;s0s2trimpnodol nlfcia( sDurxr ;o4tlxo o3ildls2emumo (0tltrif oytoatelu o s texoir3iy4lme mnesasfaDraurp;u1aee  ociyt mDuan sn(0 rtnxf oa1lpD ln i;s  exmxo3iudllen netls)aDurumoou0oeeomieilsfm ea( onu) ltomr iotlmD livo;( texrir ou1ol nlieta(farra(rooo0alxo o3iys s rlu s t0trerxr3iodlpte ues;t)teuo(rpoy4amt lfct t)aDuru  ou0tpe mfeiys a um( p;u4tlxnif3ty1lptranvs (0srxoio3iy1llt mfcia() 2tmx p;o0tleo ieild a2emn o (4 rtoxfciytlpDrlieo t teum(r3iudll nmfvia(f Dtm(ro;u0aptn ietad a2ul(vp;u0 rtnmr3ootoat luei s0texmim iodop nmietl(fsrtrxmoot0ope  i3tld a el(mon(4tltoxo3ta1fm r iei;s)s2urxo oo4opeelncsls aDuaxr nt1oleoif3tat s2eluvs;t)alxoif iadoa elivo;t0 euo(opiy1ale liesl( aDrru ono1ope  oetad sDua(vsnt)tltnxo oatlmD  ivilt  rto(rpny1lmt lfeiltfsDrrxmo;o1alxomiciad m2uln snt0texrmrciy1lptrln o;s s2um(mpiu4op nlnvil(  rtaur oo4aetnioeilt m2ea( p t0aeeoxf io1oa   ivs;t0 rtoim3nydol n nvsl() rua(mpnt4aleoif3tatla2uau s;u0 rtnif iodfm eli s;s)setr(o no4al  mieia(f 2ur( ooo4aeeoif3iyd a2rmn p;t) eenir3iytlmDr i i;(0teuoimpno4lp  lnctl() 2ra(mo;t0alxomieiadfa ranmp u4tlxrmr3iydopDrauvs;()teum(r3nydlltn ncsl(f 2um(mpou0oexomictysfs rl(vo t4 eermr3oadfptraieol(0teto(r oydlpee fctat sDurum ou4tpxn iciyt a rmn pnt0aexrmr3ootfmD  nvslt)trxoimpny1ll nmictas) 2uaxr nu1aex if3iadfm elnvs;u4 lxoxr to1fmDran olt0 rxmxo iydap nlieiltfa2tr(roou1oltnmi3iltla ua(vsnt4trerxf ta1fpD anvs t0 2tmxopnydomtnmfciat  Dta( oot0tex iocias m um( ont0 exnir tatlpt  ieo;t0trtrio no1alenliviasfartrx  ;o0tle ioeils a ea(mpn() eeoxf3tydla   nvo s t2umxmpiy1amenlictlt srrmum nu0tle  ieiys aDum(ms u) exoir3to1op r nes;()truoio ny4lp  lfcilt a2uaur nu0oexnioeiytlsDra( p;u0trtrxfcoo1fmDrlnvi s) 2uoir nudll emfvi s  rtmxmpot4oeto ocils aDem( p;(0tlxrxr iadfmt  ues ()t2uoxo nu1omenlici s s2rm(mp;u0texniieias sDul(vs;(4 lenmr ta1om eauvo;t0seuo(r oy1oltemiciatf 2urxmpno4olt  ietlt m ra(msn(4 rtoif ty1fatr nvolt0t2urxm oy1aleemncs t  2uauro;u0tptn o3tytfm2rmuvpnt)trerxo3oo1la eanvo;t0s2tmxo3nudlp   iesa(faDrmurpoo4apt mfetatlaDrmumonu0areomrcoo1lm r i ilt teumir3oo4amtelici (f 2rmumoot0optniieilsfm2ul( ont0treoxr3iotlmtean il(0 exoxo3ny1olen nct t sDtmxm nt4tpe  iciyslsDem(vs t)altnir3iotfa eliei ( t2umim iydome livta(f rrm(m ;t0aex io3tadls2umuvonu0texrir ootlpD  ues;t) rxoxo iodaltnmnvt t)artrxmooo0opeo oeiytla2ulnvo;(0arxnxo3tadfaD auvi;(  2xoxmpou4lm  lfvil()aruaxrpou1oltomfetltfmDrau on(4texrmfciodfp raneo;( srtmir3iy1omen nei s)srtm(ro;t4alenmocildfaDem( pnu0aeerxf3iodfa  aivi t  eto(o3iy4ole mncsasfaDurx pno0tlt ifciltfs ua(vp t0trxoio oytlpt  n sls0srxoxo3nydolenmfcil()arrr(m nu1opeomf3iat mDul(vsnt4 rtnxf3oo1op e neol( t2xrimpnu4amtnlfctlsf 2raumoot4tet  o3ild s ulnvsnu)aeerxo tydlpt  i i () euoir oodome  nvtlt)srraumono0aee mfciysfs2ean s;t) exrifctytoaD  nes ( t2xrir3iu1lptnmiesa(f 2ta(rp;o0tlxnmictas a ulu o u0tetoif iotomtr i o s s2uo(o oudlpeemfviatfs2raxmpot0altomoeilt m2elu on()areomo oodoate ueo;t)trtrxopou4lptemnci ()s2tm(ro;t0oltomf3tldfa emu p;u4arxrmo iatlmt lieo t0sexr(m oo1lm nmiet () 2uaum nt1aleo icild aDelnmp (0 ltrmf3oo1late u ol(  2tmxopou1lmt  ieilt  Dumxr ;t0oet ifetatlmDumnms;u4 rxoir3to1op rln i;s  2uo(r3ou1apt  iei sf rtmxro;t4aee  ietadfs2rauvsn()aleoif oydlm   neilt0 2to(rpiy4lp  mfct ()s2ra( poo1tpxn o3iyt aDemnvp ()tetoxf3tatlp r uei;t) 2xr(r nu4al nlfciatf 2umurpot0aptn octlt a2ua( o t4 lenxfcoa1oa  an slt0trtm(m oy1oltnlivt (  Dumum oo0aeeo f3tatla rmu o;(0altoxrciodlp rlivslt sexoio iodal nmnvsat sDtaxm ;u4teen o3iytls em( o u) leoir3ta1fm elivi t t2xm(m3iu1al n nvslt sDtau oou1tet ifciys mDeanvs;u0altnmo3ootfate u i t0 ruo(opiy1lpen icsls  rum( o;t0tlt  fctat s eln o;t0 rxoxrctydfa e uesls s2urxo3oudlleemncslt)sDuau o;t4ole if3iaslaDrau s;t4tlxnifcoydlaDeln i (0 euo(mpiy1op n fvtas srrm(rooo0opxniieiytfa rluvpn(0 eerifcoo1fa eaies;s0 rxr(r3nu4op elfvi s) rumu  no1opx iiciytfmDeau snt4alxnif oo1om  lnei (0s2urxmpiodlp   fetat)aDraxrpou0olx mieild s rluvs (4arermo iy1fmDeau o t)s2tmxo3oodol nlicilt aruau ono1tet io3iltfs eauvp t0treoxr ia1lmtrluesl( t2urir3oy1am nmfctl(fsDrau  ;t0alxoio3ils s2rln snt0tlxoifctytla eln s;s)texm(o3iodlp e fvt s)aDraxmpoo1apxnmoeiydfs2rlumo t0 rtnxf3iadoaDe ues;s0 rtoir oodlmtnmict () rtm(r nt4aet mieildfa2um(vo t) lxnmrctytfptean s;(0 rtoir3oo4llt lics s)sDtm(rooo1tlxo feils a2elnmonu4 lxrmf totfm   nvi (  rtmxo3io4aptelncs ( sDra(mpno0tlenmfeiyt sDul( p (0aexoxfcootfa r neo (0seto(m iy4opee fcia(fsrum(rpot0altomfeilsfmDrln onu)teenio iadomDrlueol( srumim ny4ap e fci s  ruaxmpnu1olx ifciysfa ulu p;(0trtnxf3oodfa  aieo;() etmirpnydom   fvsat a2rr(m ;t0tltoiieiaslaDumnmp;t4tltrmo tytfaD lieo;t)srtm(m3oydoltelfcs sf Durxmp;u1openio3tltfs ran snu0 eermfcoydop r nes;t seuoim3iydlp nlfctls) Duru  nt0oetn ociyd m ea(vsn(4 lxnifciodlmtr uvo s)sruoio3oydapte fetlsfsDtaxmpou1oleomfeilsfmDumump;()texrxo3oytfaDraueil( trtm(m3oudom nlfetls  rrru oou0aee mieiat m em(vsn(0arxrmo3oo1fa  li o;( srxoxrpnydlptemfesatfsDtrumpot1aex io3iytla2emnmsnu)teeomrcoy1oa  anes;t0setoxm3oy1lp emfvta(f Dur( p;o1aet  feild m2rlnvp;()tltrxr oytomtrlu i;s0s2uoxrpoodopeemfctat  Dum(m no4tpt ifciyslsDuanms;(4 lenxocoadfm  lu i t0 2uo(m iydam emnvilt) Dra( onu4apxnifciadfaDeln s;t4 lenmo3oodfmDraivsl( setrim ny1am emnvia()sruru  ou0texoif3iys sDelu p u0 rxoxf ta1opDeluvi s0t2xr(opiodlp   fciat) 2ur(rp;u1ale ioeiydlmDrlump;u0aexrmo iytomDranvs (  ruoir3oodlpte ivtat)srtaxro;o0opxn ieild mDem(vp (4trxniociytfpte ueo;s0s2tm(m oodamenlies sf rrax ont1tpe  o3ild mDrmnvont0arxrmr iatfmDeai i t) etm(o3ou1al nlnvs s) Dur(mpnu1aexo f3iydfs el(msnu0arxnmrctatoaDeau s ( t2tr(mpiu1apte ies sfs2raxm ot1oleo i3tatfm el(msnt) ltrmrctytfm   ivo;s0srur(opnu4ole  fvil(f rtaur ;t1opx  ociatfm eluvo t4tlermrcoatlmDeauvi t seuoxmpny1opeemfetlt s2ta(  no0texnio3iydlmDul(vpnt4arxoxf3iodla  lnes s)s2tr(o3ou4lp n ivt s)artru o;o1tpe mfciyt m2elnvs u4arxoif oydfp elueo;t0 rtmxopiudam  mfcilt  2umu  no0oltniieiyd aDrlnmo;t0trermf3oytfaD  ueo;() rxrxmpou4amt liesls aDuru o;t0altnmf3iasla umu s;(4areniociadoaDr u i ( trxoxopou1amen ies tfarrrxm nu4opeo oeiyd a ulnvo;u0 exomr3iodlat anvs;s srxrxo3no4ap eliet t srra(  ot1tetn ictys a ea(mo u)tetomo3iydfa rauvs ( srur(mpny4om  miciasf Dtmur nu0opx mfeiydfm2elu s t4 rxnifcoadfmt ln s;()sexo(m iu1ale lfcsat a2tr( o;u1aetniiciaslsDumn s;t4tetrmrciydoatrlivi ( srtmim nudal emics t sDrm(rpnu1oetnio3iyd m ul(mo;t4 rerxr3todlp rli i t t2xoio3nodlpte iesat aDtaxr ;o0tpeoiieild aDrmn o;u0 eeoxf iytopDr u s;(0srurxr3iu4ol  lfvtasf rta(mo;u4aee moeilt m ua(mpnt0 reoxo3iotfpteluvils seurir3no1al nmici ( s2rmu pot1oee  o3iltfmDemuvp;t4tltrmfcoydfaD luei;( t2trim oodol  licil(fsrum(mpoo4aet ifcilsfa raump t4arxnxo oadfaDeauvol()srxmxopnodlm elncias)sDtmxmoou0tptniiciltla rlnmsnu0aetnircoatlmDrln i (  rxrir oy4lpeemicsatfarraumpno1alt mi3iysls2ra( ont0 lermf tydlm rlnvsl()teurxm3iy4op n nesat artru ooo4apt if3tyd m2rln s (0artrmrctadfatr ues;(0trxmir nu1lmt  ictl(f Dtm(rpno0oex mi3iyt s2emumo t0trxoir3oatfat livslt)teum(opiodlp emncia(  rtaxm ot1oetomf3iadfsDrlump t0artomr iotlmDe ues;() euoxmpnu4am nmfvslt a2umu o;o1apt  i3ils s emumpn(4arenmr3iy1fa eluvi;()s2xr(o nu1lltn nct s sDtr(r oo1oexoifetysla2eanvp;(0 lxoxr3ia1fmtran il( t2xm(rpoy4amtemivilsfs2ur( ooo1apt mfctaslm rl( on(0 etnio tytoa eai i ()sexmimpno4lpee feil( aDumumpno0tlx  f3tlsfs2ua(mpnu0artoio3totla r u o (0 eto(r3ny4op  mnci s aruru poo1tleniieiltfa eaump t4 etoir3tydlpD  uvo () eur(m3oy1ol n iet (fsrtaumpno0alt ifetldla emnmonu)trxnxfciodlaD  ues;() ruo(r ny4ale lieia(f rrm( pnu1ole mocild s eanmp ()texrxfcoydopDe n ils  2tr(rpny4ll n fcils) rurum oo4tltnmietatfmDrau p;t0tlenxr3oadopte u i s0 eurxo3iy1om nmfetasfa2rruro;t0tlx ifcilsla eanmo;u)trtomociodfm  au i ( t2urxr3nu4aptnlfvi () Duax pou4aleomo3iadfs em( p;(4texoxf3oydom  li ilt setm(rpoo1amen nvs t a2raumoot1olxnio3iytlm2rm(ms t) lxrxociadoatranvo t)t2urxopio1op   nvilt) rumum ou1alt mfeilt mDranvpnt0alxnir ta1fm e i s;( texm(opiy1omt mfvsls)srraxro;t0olenmoeiytla elnmsnu0arxnmrciatfptelueo (  rtoxo oo1ol nlies ( s2tm( p;o0opeoifetyd aDel(vp;(4texoir iadfm rluei t0seum(o3nudamt  ici (faDtm(r nt4aex  feiadfm2uluvpnt4trxoif3oodfpDrlneo s)teur(mpnydap elnei tfarrmu ooo4oltoioctys s2ea(mo;u)trtnio3oytom   ueo;t  euo(r3oydom e ies (f Dra( oot1aexniictlslmDemnvs t4arenmf3tatom e nvi;s0s2toxo3no1apt mncta(fsrrmurpou4openii3ilt s ranvo;u4aetomfcoadlmD aivi;()sexrir oy4altnmfctls sDtmu  ou1tet iocils m2umnvp;u)alxoio oo1om eanei s0s2xm(opiu1ll  mncta( s2ta( p;o1teeomi3iydfa2ua(vp u4aetnir3oy1oa r ieo;t trxrxopnydal emivt tfaDrru oot0teenmfeiat s2ua( pnt4arxoxf oy1fpDr u ol(0s2um(o3nydope licia()s2trx onu0texnmictatfa2ea(mo (4 lxrio oatlmt aneilt0 2xoio iydalt licslsfsrraxmp;u0aetomfetltlsDua(vp;u4 ltoir3iodoa rlivo ( teurxm no1lm  lnesl() Dta(ronu0tpe  f3tld s rmuvp;u4texrirciydfa rau i;t0trtoir oy1alenlfctlt)a2raurpnu4oet iiciyt mDemn o;u4arermo3tatlaDrai sl( srumxr3nu4lmte iviat) rtax  ;o1apen fetyd m eaumsnu) exoif3oo1lp  lu i;s)tetrirpio4lpe  fvi t  rum(mpou0openii3iyt a rmu sn()tetrxr3ia1oaD  i ol()s2tmxo3nudapen ncsa()a2rax  nu4olen iciasfa umnmo (4 rtnmr3to1lm eai i;t0 eto(rpnydlleelici ()srtmu p;t0apxomoetlsfmDuau o;t) eenif3oa1lpDraneo;t  exo(mpoo1ap nmfes ()sDrrurpnu4ale if3iadfa uan s t4aeermo oa1oat  i i ()t2xoxo3iy4ameemfvsl()aDrr(monu0oetn ieiytfsDelump;t0tetrxr iadoptr ivslt0t2xoxr ny4ol emnct t  Dtm(rpot1open ictlt mDrmnvo (0teermrciodlmDrln olt0s2tmxo3nudamte fciatfsDumxrpnt1tet ifctydfmDua(ms;u4 eenmo3oytlpte i il( srumxo io1oltemicil(  Drax pno0tpxoio3iltfaDeanmon(0 exoir tytomD  nes s0setr(m3oydapen ivias) rtaxrpnt4aetn oetyt m em(vs ()aeerif tydfmt anvol()seuoxrpnydlpen ivi (fsDtmxronu4tlxoiieiadlsDemn pnt)trxomo3iydlateaivo t) eur(m3iudom   ncia(f Dum(m nt0apx ii3ilsla rm(mp () ltrmocoo1lpDelu s;()t2uoir3iy1lmtn fvta(f rur(r nu1optnmiciytlm2emnvp t4trtrxo3iodoptraueilt0srtr(m3oydop elnvsl( s2tmx o;u0tlx mfeildfs2rl(vpnt)aleomr iydfaDr neol(0s2xrio ou1ope lfcs tfa2rmxrpnu1olx ii3iadfa2rl(ms;t4alxrmf3oydom raieols) eurir3iy4optemneslsfa2rrxm no1tet iiciasls2el(vp (0aetrxr iytopteli sl(0teuoxm3nudapenmivs sfs2uaxro;o0tltomocildla rmnmont0 exomocootlaDelu s;t0trto(m iydam emfvi tf 2rr( pnt0olxn i3tys a2umumont) eeoif ty1fp r u ils t2xoxr oudlpe mfet ()aDtrxmpou0aptnmf3iydls ul( p;u4arxnxr3ootfatrli i;() 2xmim3io1apenlfcsasfsruaxr oo1tpto ieiydfsDrmnvp (0 lxoir tatfa rlneols teuoio oo4apeelnesas) rta( poo0alx  f3iyd m raump t0tlxoir3iydlpD auvs () rtrxo nudomeemnvi s)a2ta(m oo1tpen ieiltfmDeau o;(4teerxrciodlaDe neils)s2um(m oy4lleemncta()arurxmp;u1tlenifeiat sDra( s;()tetrxr iydlpDeau i;( truoxopoudam nlncta(f Durxr no1aeeo ietltls rl( s (4 rerio3tatoa r n sl() rxoxr3oodlm e fes s)a2rmxmpnt4oexn i3iltfmDua(ms ()texrxf3tytlmD livs s)sexm(o nydomt  ietls aDtau ooo1tptnmfcilt s2umnvp;t)altomo3iodlpD lueilt)tetmxm3io4ale  feia(faDtaumonu1olxnmoeiysfm2uan s t0 lxnifcoo1omDeaueils0tetrxm oy4ap nmietat s2tm( pou4altomf3iltlaDraums () rtnir oy1fm r u o;s0srxrxrpnydlltelnet sfs2rmu pnu4alx  oeiys a raump u)tleoxocootlmDrlu s;t0texo(rpoydllt  fct s sDumx poo1tet mociytfm2um(ms;u4tlerxr3iatlmD aiei;s0 2um(r3iodame lietat  Dumx  no4tetn o3tatfs2eauvsnu)tltoxf3oadfa rlneol()trxrio3no1ameemncsls s2ururpot4texo f3iasfm ul(msn() lenxr iydlp eanei (0 rxr(o3iy1lmeelivia()sDtrxmoou0oee mf3iat m ulnvs (0aleomocto1oaD  i i s srtrio oydll  miesa(  2rr(m ;o4opxn feildlaDeln sn(0tltomf iatlpteauvo;s)srxr(mpny4op e nvtlsfaDurx p;o4oltnifeiys s2rlump;u0arxoio oytfm r u i;s) rto(o3ou4lle mfvi tfaDtmu  nu4aee mietlsfm2uan s () rxoxo3oytfateln s t0t2xo(m oy1lm elnvilt  Dtm(rooo4oleomfetatfm rl(vo (4 rermfcootlpteau i s)s2umxo oydlpenlnctltfaDrru pno0apt mfeiyd a2rmu s u4tetrio3to1lmD lneo s tetoimpoudolenmfeiltfarrrxr ou4tetniieiytlmDum(vonu)aleomr ootomDelu o;s sexrxr3iu4omeemies t)aDraur oo1aexnmictaslaDeanvs t0 etnircta1lat anvs s  rumxr3iy1ale mnci s)aDumu p;o4aexo feils sDrl(ms;(0 leoifctadomt  uesl(0t2uoio ou1apeemnvs (fsDtmxmono0aptomociatlsDemumonu4texrmo oodopDr nei;s) rtoim3iu1om n ncta() 2um(r no4tpt mfciadlsDum(msnt)trxnmf oo1lmteauvo;t0setmxopiodape mictas) 2trurpou1aex  oeiyslm emu o;() ltrxf3to1laDelnvs t)sexmxopno4am  mfetlsfsDua(m no1oetnmfciadlm ul(vsnu0 etoircoy1op elu ilt) 2to(mpoo4apeemneslt) 2rru o;t1olenioeiat m2eaumpnu4teenxocoodomtr n ils texoiopoo1ol  lnvt (faDta( oot1tle moeiat a2em( snt4 leomo3oodla  au slt)srtm(opoydomt miesl()aDumxrpnt4altoiociatls ea(vo;u0altnxf oodoptelnei ()srur(mpiy4lle mnei ()sDurxmonu1opt  feiadlaDelnvpnu) lerif3oa1fp rlies t)t2xmirpny4aptn ieils s2ua( p;u0aet ioctatlmDelumo t)altnmrctadfmt  u o (0 rxrio io1llen fetatfa2uaur ;u1tptnmoetlt a2umums;t0 ltomfcty1fa r ueolt)s2tmxo3oy1llen ietls)s2uaxmp;o1aleniieiytlaDelnms;u0 etnxo3iydfpD  n o;t  ruoio oy1lpen fct s  2rrumo;u4apx iieiadlm eanms;u4teenxfcty1fa e ivil() 2toxopno4ll n fvil( arumurpou1aptomicilsls rln s;u) lxoif iadlatr nvslt)s2tr(r3oy1olenlnetas srta(r ot4aptnioeiad a ran o;t4 etomr3iy1opteli ilt)srtr(o3oo1ome livi ( srrruro;t1aee  feiysfm2rmu o;(0altnmf3ty1lmD  neo ( t2tr(rpiy1ope livs ()s2uaxr nu0opt mfetasls2rmn p;() rxnmf3iydop eauei;( sexmir3io1omtemnci sfsDtrxrp;t0alt  o3tas a2umumsnt)altnxr ta1fpD  nei;(0trtoxrpno4lmt  fcsl(fsDtrxm ;u4tlx ifeilt s rlumsn()alerif ootlm rlies s seurxo nydlptelictat)s2ua(r no4apxomf3tysfmDeaumpnt)altoif iodlatr i i t) rxm(o3oodopee nvs ()srrm(r ou4oexomfeiatfa emuvs;u0tetoxf iadoaDrlu i t0 2xm(r nudlpe mncslt a2ta(  no0tee io3ilsfs eaump u4 exomo3iotoa rlieo t) exo(m3nu1aptn fctas)srumur oo4tetnioeiadlm2eluvsnt0artrircoytfp r ueil(0srurxm io1lmtn fvia(fsDumxm no4texoifetysls2ulumpnu)alermoctodoaD lnvi;s)seuoxm nudll emiesatfs2taur ou1oltomi3iltla elumpnt)trtriocoy1opD livsls s2tmxmpiudlp   net t srta(mpot1aex  i3iad a2ul(ms;u0aleomr3tadomtr uvils0setoxr3oo1al  mfciat)aruaxmono4tlen oeias m uauvp;t4artrmrcoa1oa elneilt)s2xmxmpio4amtn ncs ()a2rr(moot0ale mfciyt mDuan pnt)tetrircty1oaD lieo ()seuo(r iudllenlietl(faDrmu  no1tltnmoeiyd a2umnmont4 exrmr ia1lm  an s;s0sexmxo iu1olt  icsls)a2rr(roou4tpe moeiys s em(monu4alenxr3tadop r n s ( srtrxo ou1aleemnvsas srrrx o;t4aptn ieils a2uanvo;u4 lxrxf iadfm  lueil()setrxopiydlpt lfvsa(f 2umur oo4oee  oeiyd a rl(mo;u4artrio tatla e ueils) 2xo(o iy4alt lfcsat aDururono1tlx iictysfm2umuvs;(4trtoir3iodfat au o t0t2tmxr3oo1ll   feils s2uaxmont4tetomi3ildlm ulu s ()trermfciytoptr ivo t trurxm nodllenlncsls  Drr(m ot4alx moctysfs2uauvo u0artnxociatfptr uvi;t s2toxo3iodomt lfcslsfsDrrxrpnu0ope  oeiatfm2ean s;()trxomf oo1lp e ues;()t2uo(rpny4om nlnvsls sDtrx  ;u0aex ioeilsla ulums u4trxomf3todom elieo ( t2uoirpoy4ole  fctlsfs2ua( o;t1oex  fctys a umuvo t0trtriocoa1oa rau i;t0t2xoim nu1lmt lfctls)aruru pot4tpx  ieilt sDem(vonu)trxrir iotfpDelnvs;s)trurxr3iu4am e feils)srtrum nt1oeeo ietas sDrlnms;t4trtnxr3ia1omte ivs;(  exo(opou1om n ncsa(fa2rmx p;o4alxn octyslaDelu p t)teeomr3iodopD anvs t s2ur(o ny1lm nmncs () rrr(mo;u1tlxniocild a2uluvo u0 ltnircta1fpDeluvsls srtmim iydlm   nei s aDrrxrpnu1olxnifciydlm uan sn()aetnmo3ia1omtrlu ol() rtm(o3iy4lpt mfesl(f rra(moot4tetnmfctlslm2rluvs u0trtrir3oo1lmDrluvi;s0sexr(m iy4om  mnesat)srrm(mpno4aeeoifeildfmDra(mo;(4treoif3ty1late ues;s)srur(o oudopee ncs (  rtrx pnt1teenmoeiydfaDuln p;t4alxomr todfaDr uei t s2xrxm3oydll  mnesas)a2rm(r no1alx mocilslm eanmo;u4 exrxrcto1op elu i (0trxo(opoydolen nciatf Dtaumpnu0altnmi3tlslmDel( snt0 eeomociytlpt  uvi;t0s2tm(rpoy4aptn ncias  2rmu ooo4apt ifetytfm rlumpn(0arenif3ia1oateaneols0teum(opno4ap nlivtl( srtaur oo0texomoeiasfsDrmnmo;u) reoxr io1fm r i i t)s2urxm oy4lpte ivs tfsrtr(moot0openmo3ild sDeanvs t) eerirctydlpD lueol( s2umxr nudlp nlfcta()a2um(roou4tlt mfciydlsDrl(vpn()tlxnif iy1omtrlu o;t0truo(o iudalt lnetls aDtrurp;u4tpxnmf3iydls um( o (0 rtomoctatopteluesl()t2urirpiydlpeelivtlsf Dtaxmp;o4olxo f3ils a rauvsn()texrxo oytfptran ols0srtoirpoudal elivtls a2trxmono1olxniieilslsDra(mont)arxnifciatomte ueols) euo(mpnodlle lnesasf 2ur(ro;u0alen f3iat a ea( sn(4 rtnif3oodoatraieol(0 euo(m3iy1om emfvi s)srurxmo;t0tltniicias s2eanvs u4aetrif3totomDeliei t sruoxopno1lm emivil(f 2rruront0aptomf3iysfs2raums t)aetrmocoa1oaDelivs t0t2trio oy1lpe  nes sf Drrum ou1oex ioctlt s umumonu0areoxo tytopDrlieo t)truo(r io1lp elfviasf 2rm(r ;o1opt ioeiltls rlnmo t)alerir todla rluvo;t s2toimpiudaltemnvtlt)srta( ooo0tee moetas s ea(mpnu0 ltrif3to1fp e ivi t)srto(o iodam n fesatfsrur(ront0tleoifeiys a rlnmo t4 rxoir3tytoaDelies s tetmimpoudapeemics ()aDrrx pno1oltoiieiysfaDumu s (4tetomr3tydom  ln s (0s2tmxrpnudlmtemnvias arrmuronu0olt iieiatfaDul( p t4texnxrctodfa rluvslt)seuoxmpoo4lp   nvtatf 2trurpoo0apeo octydlm2ul(vo;t0 renxo oo1lpte nei t  2umir io4omte nvsl(f 2urumpot4olxomiciys s2uau sn()tlxrmf3tytomteluvi s) rtmirpiu1llenmncsas  Dra(m ;t1aptnmi3tldfm2rm( o;(0arxrmf3tatfate u s () exmxrpnudom  mfeils) rrr(  ;o4aetnifciadlaDem(mo t0alxoxoctatlm e n s;s  ruo(mpiydame mnvi ( sDtru pou0tpt  o3tydfsDrauvo (4alxrmfciodfmDe ies s)t2ur(mpny4optelfctl( srtrxroou4texomfciydfs rmnvo u0trtnif3oa1laD an s (0 euoimpno4lptelfesl( arra(m ;o0aeto feilslsDelnvp (4 exrxo oo1latr ieo t  exm(r3iu1op   neil(f 2tr(ront0olx iiciasfa ean p;t4arerxo3iotoa  lneol()srtoimpoudop n ieslt)sDrmurp;u4teto oeilt aDemn pn()trxrxf tytla ranesls0srtoxmpnu1olt mneias a2trxrooo0tetnioctat s2ean p u) lxrio3oa1fm eaivo;s0srxm(mpnu1lp e ieiatfsrra(root0tpe ii3tlt mDrmnvpnt)texrmfcio1om  aivo;s)t2xoxm3iu1apt  iei s sDrmum ;u0opx if3tltfsDrm(ms;t4 lxnxo tadlmDr ieils0 exmio3iodllenlivsas)arua(r ot4aetoio3iad a2em( pn() lxomr to1lp e iei;(0tetrim ou4op emfcslt  Durum ;o0tle if3ilsfs rm(vs;u0arxrxr iatfmD an i ()seuo(o3no4op   fes tf Dtrx o;o4opto i3iat s2um(mo (0tleoifciydomD anes (0 eumxmpoy4omte fvtl( sDra( pnu0opx iieiadfsDrl( o;t)tlerif ty1op raivs;s t2xoxo3nu1ole lfvias)sDuru  nu4apxnioetadlm2raump t)trtnmf iy1lmt  uvs;(0s2xoxrpiudaltelivilsfsrurxm ;u4tptnio3ilsfm2el(vonu0tlenmo3oa1om   ieols0teuoio iy1olenlict sfsDtaxrp;o1ape if3iyd a ua(vp;(4tlxoxo3to1fmD  n i;t0 2xmio3iy4ome micilsf ruax p;t0aetomictat m el(mp;u0tltnxr oytlpDrlivolt s2tmir iudamee fei ( arrrurpoo4aleomf3iasfsDrm(mp;t)aetomf oydopDr i o ( s2uo(rpou4lmee fciatfsDum(root0tleoio3iysfm rl(mp () lerio oatfpt liei s)t2ur(rpiu4omeemnci ()a2rr(monu1tee  ieiatfaDrl(mo (4aetnmf3ootoat anvilt  etrim iu1om n nesa(f 2rr(r ;u0ope  f3iasla2elums ()tltriocoydlmDeln sl(0 rumxm3oydoltemivt t  Drmu oou4opxomfctldls el( pnu)trermr oo1fpteai ols0 rtoxmpnu1lm elivt tfsrra(r ;o4tlto ieildfm2umnmo;t4tlxnirctydlaDr ivi;()sexmxr3nydolt  fviasfa2trum ;u0tltnmi3iad a2ul(mo;u)artnmocty1fat liesls srxoxm3no4am nmnctls)s2rrx o;t1olxoif3tas a2rl( pnu4 leomociatoatelueo t0t2xrxrpiudom n nvsa(faDtm( o;u4tptnmieild m2ran o;t4aexnmo iadfpD  ies;t sexr(opny1am elfvil()aDua( p;o4openiicild a el(vsnu)tetnmr tatlp elivo;s trxoir ny1lm nlfetls aDrmurp;t1texn ietysfs rm(vont0trenxo ta1lpDrli s;(0teurxr ou4ol e nvi (f 2uaxmoou4tpx mo3iytla raumont)aeerxocoydoa rai i;t)s2toimpiy1omenmicsa() 2trumoou1tpx  i3tasfa ea(mpn(4texoxf oydfa eaivs s)tetrio3iodlptemietlt  Dra( pot1oexn i3iyslmDuaumpnt0tlxriocoy1fa rln ol(0t2tmiopoudlltelnei ( srururpot1aee iocildfm rln s u4aetoio3iatfm elnvslt  euoiopnu4opeemietls arta(  ;t1tlxo f3iys a2ua( pnu0 ltrmr oy1faDraiesl(0 2uoxo oodam n fci () 2tmxr oo4tet  o3ilt a2ul(vo;u0altnxr3iotopte u s;s s2uoimpoudap nmieiasf Dta( poo1aee mi3ildls eaumsn() eerio3iatlmD  ivs ( s2xmxm3ny4omen ieia(faDuaur ;u4aet  feilsfm2umnvp;(0alxnio iotoa eli s;s0 rumxo nu4op nlics ( a2urxmooo0tlxoifetasfaDrmump;u0arerxo3io1lm elieo;(0 rxrim3oy4lmee nctas)sDuaxmo;u0oltnmfeias mDulnmpnu4teerxf iatomDe i o;s0t2ur(rpnydol  mnvs ( arumump;o1tleomieiys a umu on()aeeoif3ty1omte ueolt)srum(r3nodam elnctat) rtauroot4tlxomfeiasls umumo;()alxomrctatfpteluvs t0 rxrio oo4omen nvsl(  Drau p;u4tlxnifeils sDuln p;(0 etrio ta1op   uvsl( sexoxo3oudal   ncsa(farrmumont4aee  i3iys a2ul( sn() ltrmfcoytfpDe i i;s0trtoxm iy1om e fvi t)aDtr(m no1aexoiietatls2rmnvsnu) exomf3oydop r i sl() exmim3iy4ome lneiasf rraxmpou4olxnif3tlslaDrmnvsnt4texnxr3todom r u s s0 rumxr iudap  mfet sf Duru ooo1aleomieiad mDeau onu)tltoir tadomDrlnes;() 2xo(o iy4apt mivi sf Dum(mp;u4oeeomi3iasls ea(ms t0artrifctatfpt lieil(0sruo(o3nu4aptn nvsas) 2rm( oou4tex moeilslm em(vp;t)altriocia1lp elnvi s0trto(r no4al   fvtl(fsDraumo;t0tpenmfetaslmDeanms (4tltoxfciytomt lnvilt seumxrpiydaltemiesasfs2ua(monu4alx  feild a2rl(vo;()texnxo3iadopteauvi s s2xrio3oydop emncs (fa2tmxr nt1tptomictyd aDrauvo t4 exnirciydlaDeliei s trum(o3ou1op  mivtls aDrrxroou4opxniociydlm2el( s u4trxoio oatoptelnvs;(  2tmir ny1omenlfes s)sDra(mo;o4aet mfetad a um( s u)trtomfcio1lmDrlu i (0seuoim3io4omt lfei ()a2tm(mpoo4tpe iicildlm2elnmp u0alxrmf iytoa  aues;( t2xmim3oo4amtnmivtl(f rtaxrono4tpe iieiysla2rlnms (4tltoir tydfa r uvi t teurio3iydlm   icsl( srrau p;t4apxo iciltfa2rmnvsn()areoxociytlmtranei;() 2tmim3nu4amenlfvs ( sDrau ooo0oeenmietysfmDeanvo;u)alenmf to1omtrln o s trxoim oodom elfci s) 2uaxm ;t0tetomociatfa2ul( o u0alxoxocoydomt li i t  2xrxr oo4lltemics ( aDrrxr no1tlen iciytfaDel(vsn() lerif3oodfp rlu il() rumxm iy4ape livtas) 2urxmono4tlt  feias aDemnvon(4alxnmrcta1om e ues;s)srtmirpoo4omte nei sfartmum ou0tpto o3tytfs eanms;t0 lxrmo3iy1opDraivo;s0tetoiopou4op  lfes s)s2ta(  ;t4aleo feiyt mDea( ont4 rxoxf3ta1lptrlnvs s sexmxm oudamte iet sfarua(mp;t1tptnioctat a uau p (4arxomo iotlat  nvo ( texoxo iy1alenmfeta(  Dtrx onu0oet if3iytlsDem( o u)alermociytlptrau ils0teumimpnu1lmeeliviat  2ta(  ;u0tpe  fctlsfs2eln o u)aetoxr tydfm  lu s;s)sexoio3nu1aptn fvs (f 2tax o;t1tleomo3iltla2uauvpnt)aetrio oodfmteauvsls)teuoxo3io4llenlivils arraxrp;u4oex if3iytfsDrmnmp t0 rermrciytfat livi;t)t2ur(r3io1ole mnci (farumxrpot4tptnif3ias s2ulums;u)tlxnif ty1lpDr i s () rxoxrpny4aptelfcsl()s2ra(mpnu4olenif3iydls rauvs u0aleoxo3tadop e i s;s0trtmim3iy4llt mnvtas srraxm nu0olxnmo3iatfm ua(mo;t4 ltrif3iydlpDeau s s0t2uo(o3io4lm nlnvta(fs2ra(r ;u0olen i3iysls rmums;()aeeomf3oatlptrlu s;(0 exrxr iu1lmt lfcslt) 2rax o;u0aeen ictlt aDemuvpnt)teermo3oodfmD aivs;( t2xoxmpoudamte ncsl(fs2rm(m nt1tpxo f3iat m2el(vo;()treoif oadfmt  nei ( s2trio3nu4ol nlfetat)sDuaxm ;t0tpenii3tls s2eauvp;u0 leomrciotopt aneol( trurimpno1opee ivta( aDrmu  nu4aptnmf3tytfa2umu snt0altomf ia1optr u s;t)texrxr nu1ameelnesat s2rmx o;o1tlt iicildfs2emn o;u4trxnxr iatfm  aivo s0srur(opno1omee ieils arumxronu4opxnifctas m uauvp (0aeerxoctydoa raueils sexrxr3oy4optnmfvsasfs2umuroou1olen feiasfmDua(ms;t)trxrir oy1oatranvi s)srtoxo nu1lmee icsls) 2tr(  ot0oexnmfcias a rlnvo t0 rxrif iatomt auei s s2trxm oudlpen ivtl( a2rmxm nu0opx if3iysla2ra(vsnt)aeerio3tadfm  lueol(  2xoxo3ny1lmt lictatf 2rmur ;t0oexomoeils m emu s;t4 lxrmfcoodlptr n i;(  2xrio3no1ol nmfvil( a2uaxront4oexnmiciyt aDeaumo (0texnir oo1op   ieil()sruoimpnydopeemivsl(fa2raxmp;o4apen ociadfa el(msn() ltrioctydfa rauvo;()t2tmir iu1ale lnviltfa2tax pnu1tlx  iciadfm2rmu pnt)tetomf iatfm r nvolt  eum(opno4omenlicil() Duau pnt0aleo o3tyd a rmu o;u0trtoxo3iodfaDranvi;t0setrxo no1aleemfvia(faDumx pno4opeomfetlt m2um(vs u)teenxo3ty1laDe nesls0t2urim3oodam e fctls) rtm(m ot0aptn ocilt m2ra(mp;(0tltrmf3ootomt  uvi t) rxrxm3nydop n nvtat)sDtm(rpnt1tee  o3iatls2elnmont0 rtoxo io1lmte nes;t trxrirpiu1olt mivi s  2urump;u0tpeomi3ildla2emn s u)texnxfctodfmDrlneil() exmxmpoydom emiesls aDrrx pnu4tpe moetydfs2ul(mp (4artnif oodlmDe nvs;(0 rum(o3oo4ol  mivs s arumu  ou0opx moctldfaDemnvpnt)arxrifctotfa eai o;t)s2uoimpio4lle lnvs sfaDrmx  oo4apx ii3tadlsDulnvp;u4artnxf oadfat lu s s s2umxrpiydomt lieilt)a2taxm ;t1alxnmfciys mDumuvont) etomr oydla rau s ()s2umxr ny1ape lnesl( srtaurpnu4olt mfcild m2ulu onu)tltomocoytfmt ln olt0s2urxmpoodaltelneilt)a2raxr ;u4oee moeildfa umn s;u0aeeomo oydfp rli o t) 2xmxo3iudom  mfviasf rum(rooo4alx  ociytfm umuvs u0alerxo3oadfatrlnei;() eurxrpoy4om nlietas  rumx p;u0oeenmictad aDrau sn()alxrxr ta1om elnvi s) 2uoim io1lpe lncils)s2rmurp;o1tle if3tlsls em( s t0arxomo3tytfa   i s t0seumim3oo1opee nvtl()a2rm(r nt4aleoiociadla2ul( s u)aeerxrctotlmt  ueol(0 eurirpoydame mieia()sDtax poo4tlxnii3tytla2rmuvp u4texriocoy1om   nvs;s0srtoxm3ou1lmt mncsls sDrmum nu4tpt moctys sDuluvo t0 eenxr3iodlmD lnvs;s)tetr(m ou4ap n fctls)sDta(rpnt1oltnii3iat a2emnvont) exnxf iatfmDelies (  2xrirpiy4al e ietlt  2rm(  nt1tpe  fciyt m2ranms;t)tltrmr3oy1lp raies t0s2xmim nydomtelici t)a2tmumpnt4tee mfcilt aDra(vs;(4aeeoio3iatlat  n ils0t2umio oudop nmivi ( s2ur( oou0aetnif3iyd m umn snt) ltomr oydlp eaueols0tetm(opiudlm  lfct ( s2ua( o;o4oetnmf3iatfm2em(mo (4trerir3iotopt  n i (0sexm(m3oodol e nes t  rur(roou1apxnmoeiys sDemumonu)tlxrmrciodfp r u ol()s2xo(o3iudlp elfvi sfarraumpnt4teeoii3iysfs2emu onu0aexnxrcio1oat  iesls) eumio3ny4lleemneslsfs2trxrp;o4oeto fciaslaDeanvo (0 etnmr3to1lpteau i;(0seurxm3oudamt mfcs t  2trxm nt0teenmieiatfs um( s () rtnif3iy1laD  ivslt0 2trimpno1amte icsas)srtax pou4tle mo3ild sDum( onu0 rerirctydoaDr i s;s0 2to(rpiudlmt mnci ()srumx o;t1aee moctytlaDulnms;u4artoio iadlmD au s t0 eur(opoy4ol   ies s)sDrmumooo4tleo fctatfa2rm( p;(4trerir oa1faD ln il()trur(o iydalte fesl( sDurxmpoo0oltn i3iydfm2ulnmo ()aeeoxf3todlmD lies () ruoxmpoo4am e nvi s a2uaurpnu0oex moetlsls el( sn() reoifciydfaD lu sl()seumxmpiy1am elnetl(fsDtaum nt0tlt ifeild mDeauvs;t)teermr tytlm rai s;t)srtmim nu4lm  mneil() 2ta(ro;o1tpe  ieiydlaDul( o (0arxoxr ty1opDeaivsl(0s2tmxr3io1alte nctlsfsrurxr ou1ale  fciatlaDua(mp t0teeoifciydop  lueol( srxo(o3nu1lm  lfvil(  2ua(r ;t1alto ictysfa rlnmp;t) etrif oadlmt aieil(  2xoxmpny4lp nmfvi s)s2tru pnu0tex  iciltla2rmumsnu4alxoifcoy1oaDr ivo;s)t2tmxmpoo4lpt  ieias) rta(mpoo0aet iieiasls2uanvo t4 reoif ia1la eluvi;(0t2xrxm3oo4op n ici sfaDumurp;o0apenmf3tyslaDuan s u)alxoxrciy1omD ln s ( t2trir oo4ap  micta(fa2ra(mpno1tlt ioeiatls rl( s u4aeerxo3oy1fm rlivo ( truoio nu4lltn ivtlsfaDraxmpoo4olx mi3iyt mDrmumont0texoio3iodlm eln i (  2xrxm3oy1lp eliei t  ruaxrpoo1oexnii3tlt a rmu onu4 rtomociydla r uesl( seto(opnudolt mnvtat  rra( pot0olt  iciytlmDraums u0tetomrciy1fp e ivsl(0 etr(r nudapeemivsa(  ruaxrpou0oltniieiadfsDrlnms t4 lxnxo3oadfmt  iesls srxo(rpnydlmtemiet (fsrrmum ot4aleomi3iyt m2ra(msnu4trtoio todom eaueo;t t2tmio io4optnmivt ( a2ur(  ;u0tetnmfetldlm el(vo;t0 exrmociytlpt  u i t) 2uoxm iu1altnlnvsl()sDuaxm oo0apt miciadlmDeauvp;()altoif oy1lp  lneslt setoir nydoltelneia(faDta( ono4aeen ietytlm2umu onu4trtrxociytfmte ueols) rxoxm3nydlm  mivt s sruaumpnu4aex ifciysla2rmnmonu0 rxomfciytlaDeanvsl(  rtoxopiudol emfet sfa2raxmont4tpt  fctasfm ea(vo;t4texnmrctatfptraivils t2xm(mpnu4optnlicslt a2uax  ou0aetnmi3iaslmDem(vp;t4 eenmocio1oa  lies;()teumxopou4lme mivil( s2trumpno4tpe moctas s2rl( p ()artrxfcoodlaD ai o (  rxm(r3nudlp nliei (fsrrr(rpnu1tetnmi3iydfmDel( snu) rxomo3oytop elivi;t)texo(rpou1am   fvtlt  Drr(r ou4tpen o3ild mDrmump;t4 rxnxr3io1faD  i ils) rtm(r no4am n icia(fsDraumo;u0apxnmoeiatfa elnvon(4teenxr3iydfm raivo;t s2uoim3oydoptnlfcta()arua(mpou0oeeomo3tldlm elnmo;(0aleomo oadfpt an s s0tetmxr ou4al e fvsatfs2rmuro;o4tex mfciltfs2el(msn() ltnifcoy1omD anei t)tetrxo3io4lpt lfcslsfs2raxmpot0texomi3iyt m ulnmsnt4aeeoxocta1opt aivils)trurxopnodoltnlict (  Dta(mpot4openmietlsla2ean sn()arxnirciydla elneo () rtmxmpou4ll elnvslt)s2taxro;o1aetniociyt m rl(vp t0tlxoxrcia1fm   uvol(0sexr(r io4ap  mneslsfs2rm(mp;o4aexn ociyd s2rmnvo u4aeerifciadomD  u i;t  2xrxr iodllt  nvtat srtrxront1olxo feilsfm2rmnmo (4aeermoctytop e i s (0trxmiopoo1am nlfvsa( a2rru ono0olx ii3ias m el( pnt)aeeoirciydopt  i i t0trurim3iudol  lfvilt)aDumxrpno4tptn ociydlm eau o t)teerxo ta1laDelieil(  2ur(r3iudapeemnetatfsDrmxr oo0oetoio3tasfm2rau s u4tlxnmr3todlaDrau i (0srtoxr3oodlmeemnci () rtaxrpno0oex miciysla uln snu)arerir3ia1fpDr ues;t0 exoiopnydoleelnci tfarrm(  ou4oleoiiciadfaDuanvo;t4 exnxr io1lpD  n s s0srtr(opoo4ap e neta()artmxro;u1tetomoeias aDemnmp;t0 reoxf3iatoa e i sls sruo(rpnydol e nvil(  Dumu o;u1texnmiciyt sDul(vo;(0trtrifcta1lm  ai s ( srxmim3oy1llen ncilt)aDrmxrpno0tltoiiciyt sDulump u0artoxocoodfptelu o t) rtrio no1olt mfvia(  2raxmp;o4oexnmietlsfa2raums (0 lxnmo3oa1fmtraueo ()teurirpoy4op  mnvsas)artm(m nt0opxnmoeiaslm2em( p;u)aeerxociytfm raivils t2xoxrpoudaptemicia()aDurumono1altoiieiatlm2rm(mp;u4aeeomr3oytfmDelivs;s) exmxo oo4ol emfcs t)sDuru oou1olx moeiadfa umumont0 rtomr3iadlate n sl(0teto(rpio4ll nlivi s)arururp;t1tlt  ieilslsDem(ms ()arerxr3tadoaDe nvslt)texr(opoydamenmfvtatf 2rr(  nu1opxniiciad sDeau o u)tltnifcootoaDr nes;( s2xmxm3oydoltn fei s) Durx  ou0aet ioeilt m2umnvsn()trxoio oodlaD lieo (0teurxr iy1apt lnei sfsDrr(rpnu1apx  feiatfm raums;(4aetoxocoo1fpDe nvsl(0s2urir iydoptnlncs s)sruaxm ot4tlenio3tls s2um(vs;t) rtnxfciadlptelu o;t0 2uoxo3iy1op emnesat) Dra(m oo0tptnifeildlm2elu s;()altrxf3io1fmDr i s ()seumim3iy4lmeemncil() rrrxr ;t4aeto fciasls2rl( o;u) rtoxo iotlm  auvo (0s2tm(rpoydopeelnctlt  rtr(rpot4alxnii
\ No newline at end of file
@@ -0,0 +1 @@
+i o s  2tmim nydopeelieiltfaDraxr ou1tlxnifeilsfm el(vp u4aexomr3ta1fmtraivo;()texmim oy1ope  ieil(faDuaur nu0apx  feiys m ea(msnt0arxnxr ootfpDelivs;( srxmxo nu4omtnlfciat)artmxmo;u4altnio3iaslsDrluvsnu)texrio3oa1lmtelnei;( trurirpoy1lp e fetlt) 2urum no0oet mfeiyslmDuln pnu0 leomf todfp e nei s0t2tr(m io4ap  lfei t  Dumxmp;o4tptn f3iyt a2ulump;t4 reoio tatlmDrlies s) rtoxr3oy4ale mfctl(fsDrax  ;o4opxniiciysfaDemnmo t0arerif3oytlateanvi t srto(r3ou1ol e ieiat srraxm nu0apenmiciltfa raumpnu) etrxf to1fmDrlu s (0t2to(o iydopt lfctl() rrm(roou1aetnmfeiysfs2ra( o (4aetnmr oodlp e nvo;t seumio iy4amtemicta(fs2uau  oo4apxnii3iyt mDem(mpnu0aeeomrctydom elnvo (0texoxo3ny1lpte ics tf 2trum ;u1oeeomi3tltfaDumumpn(0texrmo ia1fat luvolt0setmxmpoy1aptnmnes t) rtmuro;t0tet mfciltfm2em(ms;u)aeerxocoadfm elueols0tetmir3no1lp nlivtasfs2trxronu0tpeoif3tyt s ran p t)tlxnif3iadfmtraneil() exm(r ou4ame mfvias a2ur(ro;o1alen feils a rmumo u0 ltrmf ootlpteau ils  rtm(m iu1omenlnctat)s2tr(mpot4tle iociatfm2emump (0trenmo totlatrlneo (  2trxr3io1lpt micils)aDraxrp;o1aet  oetadfa2ua( s t4 ltoxr iytlpDranes;(0s2to(o oy1ome lnetl(  Dum(m no4oeenmfetys mDua(vs (4altnxf iotlaDr uei t)teumio no1oleemfcsls) Dtmxmoot4aeeomo3tysls2eluvsn(0 ltrxocootlp eaneo s)s2tm(m3io1opeemfvs s sDtrur nt1oex moeild m rlu s;u4texoio3iotomteanes;t0trtr(o3ou1opt mfvtl(f rra(  oo1aeen f3tasfa umnvp;u4alxomfciydfmt  i o;(0t2uoxo iu4al nmicias)arum(rpou0oltomi3iltfm2umuvs (0trermr3iatoptr nes;()trto(m3oodom emictas  rumxmp;u1tet moctltfm eaump u0trxniociytom   n i;t)s2ur(r iy4ale  fvi sfaDrrxr ;t0texnmf3tlsfmDumump u0tetoxf3oodoaDranesls0 rtoir3oy1lle lncsls)aDtau o;u0apxo f3ilslmDum(mpnt4aetoifcoo1omD anes;t seur(o3nodope  ivtlt sDumu pou0aex ifeias sDrlnvs;u0 renxfcoy1fa eauvs;t)trtrio oy4ole mneia(faDtaum oo4altomf3ilsfa2rauvp;(4 eenxo iatfp  aueo ( srtrir iydlmtn fcsls arrmu pou1oltomociadlm elump u0areoir oa1la elu o ()teuoxr3oudlpee nvt ()s2raxrpno0tlxnii3iytfaDrmuvs;u)aexomr3oatomt livo;t)t2xr(rpiy4ll e ieia( aDtmxrpot1tlxnio3ilsfm rm(vp (4 ltoio totfpD anvi s)srurimpiu1am n nvtas sDtmxm nu0tptomociytls rlnmp (0altrif3oadfpteln o s)trurxo3oydap n ics sf 2tmu  ;o4oeeoii3ils aDemu ont4 eermo3iydfatelueo (0 etmirpny4llte iesat)aDtauro;u0apx mi3iytfmDrmump;t4aeeoxf oa1fa eaivo (  ruoiopiu4ape mfcilt  Dra( pou4tlxoioetadlm2eluvp t4arxnmociatlp  aivo;t  rxrxr3oodomen ivsa() 2umx oou4aeen i3iad aDrm(mp u0 ltriocootlatelivi;s setm(o no4lm elfvslt)s2uaxro;u1aexnmf3ilsla2ea(vp (4areoxf3ootfm eaiei s  etr(m3ny1ol   iciasf rrrxmp;o4opxomiciys m ul( snt)aetomf3oatfat  neslt0seum(m3oudlpe liviat)srtaxr ;u4aetnii3iydla emu s u0tlxrxr3oatla rlues () exr(rpiu4ap nlfct (  Draxrpno4tpxoifciydlm uanvo u4aeerifcoydfp eln i;t0srurxmpoo1omee icsas)srtm(mpou4tpx ifeiatls2eaums u) rerxrcty1opDeln s t) rur(opou1ame  ivta( s2tm(  no0oexnmo3tadls rln pn() etrif tadfm rauei s srxr(rpnodll nlnctltf rur(  ot0tlxoifctld sDelnvo;u4altnmfcoodla rlnvs t)srxrio iudalt mivt t  Drmu o;u1texo i3iatfs eanmsnu)areoif3tadomte i sl() etmxrpiydomtnmfeta( sDuru pno4tptniieiatfs eluvs t4aexrio3iotfa eaiei;t) eur(m no1omtemies ( arur(  ;o1tleomieiat a2rmu pn(0teerxr3oo1fp raieils) exmirpou1lleelivilt  2rmumpnt4olxomietadfm eanvs (4 ltoirctatfpt  ivi ( t2umxrpiu1om nmics t) 2umxrpnu0tpeo oeiytls2emn o;u)arxrxf3todfaDrlues t texoxmpoy4ol elncil() 2umx ont4apeniiciatla ua(ms u)arenxf3iotfatr ies (0seurxr oy4optn nvs ()sDraxmpoo4apeniiciydlmDrmu p;u)aexniocoatlmD anvi;(0setm(m3iydlm nmnei () Dua(r nt0oeeomietldlm2eauvs;u)aexomrctytlpt  iei;(0texmxopoy1amt livsl() rta(  nu1tlxomi3ild m2uau onu) ltnirciydopDrlieols0 2xo(rpnu1ape lfctas)artmurp;o0oexnmf3iyt s2rm(vont4 rtnif3iytfm  lnvol(0 2xoir iudal elfvs tf rur(m oo0tptnmf3ils a2eln p t)aexnmociotla r i i;s)seumir iudameelivtl(fsrraurono1tltomocild a2eanvp;(4alxoxfciatfa  ln i t)truriopoy1lpeemnvia(  rurx oot0tleomi3ild aDemn s ()aleoio3oadlp rluei;s0seuoim ou1ap elfcs t  Dtaum ;o0altn fciysfmDulu p;u)aeermf ootomDr u o () etoxo oy1ap e ivsl()aDra(m ;t0oexnifetys sDeluvsnt0 ltrxr ta1laDean o () rxr(m iudll  miviltf rtaxmp;u1alt io3tytlm2em(vs (4 lxnmf3oo1fptrau ils) 2tmiopou4ol n ivtl(f 2trxmooo4tlxn fctytfm emnvp (0 rxnxoctytlm eauvils0t2xm(r3iodaptnlietl()arrau  ;o1oltnmo3ildlm eau p;t)texrmr3ty1la   ivo;t)s2ur(rpoo4lltnlnetasfs2uaxr no0tpenifciydla um(vo;u4 reoxfcty1faDraiei;()texmim3iudlm emnvi sfsrtrxrono0aexo ociat m2elnvo;(4tleoxr tatfaDrlivsl( teumxr3nodlmeelnctlt)sDtr(root0aptoio3tlt mDuln onu0 exrxo3ty1opte uei s) 2xoxmpnudome  fvs ()sDta(  no1alxnmieiltla2eauvo;u0 lenmrcoy1oaDeln ols0tetoimpiu1olenmnci (f rrm(mooo4aeto fctlsfa2emnvo (4 leoio oytfpDeaieslt0srxoxrpnodolt  nci t) 2trurpnu4tptoioeilt m2umumo t)teerxf3oadfpDrlnvi;s sexoxo3ny4ape mfeslsfsDtr(  ;o4alx mo3iad sDran pnt)tlxoxr3to1op e n s;(0 exoim3no1altnlietls)s2trxr oo0oex ioctldfs2rln o () lenxo3iadopt ai ols) rto(m3oodamen fet sfsDta(mpot0olenmfetld aDumnmp u4aleoxr oo1fa   u s;s0srurir3oo1op elivi tfsDum(mpoo1open fciasla2emumpn()aexrxo oo1fp  ai olt0seumirpoy4lmtelfesa( s2tmumpoo0opxo feiat sDrm(vs;u) eenmo3io1fmDeli i t0 2toxr3io4amtnmictlt aruaxm ot1tlenifeias s2emu s;u4trxnxfctotomteanes;t0s2trir iy4lmt  nvtlsfsrtau  ;o0oleomo3ils aDuauvp u)artrif3oatlp ean s;t0 2xoxopnodll nmivia()srraxr nt0oet ii3tadlaDelums;t0 leniociytoat lu s;t  2xmxo iy1llenlfcilt)sDtm(r no1aexoioctldlm ul(mp;(4teerxf oy1oa e nvo;( trto(m iy4lme mnvi (fsrtrxr nt1tpxnmoeiatfs rmu onu4alenio ty1lmte u i;t)trxoio ou1al nmfeia()sruaxm ;t1tpeo i3iatlmDelumpn()tlxrir3iytopDean o ( s2xoxo3oy1lmte iet t a2taxmpou0aetniociadlm2rm(vo t0 etoxr3ia1oaDraues;t) rxm(r3oydom n netat s2tm( o;t0oetn oeiasls rmnmpn(4arxnmf3iatoptran ils  rxr(mpoo1lmtelnvslsf Drm(r no4aet moeild s2uaumsn()tltrxo tytlaD  iei;t) 2xrimpiudlpenmneil(fsrtaurono4tpen f3tys s elumpnt4aexnir3todlaDeaieolt trurxmpnudaleemfetatf rraurpnu0tpx mociadfm2el( pnt) etrxf3io1om ran o s0s2trir3nydamtnmfvils)srta(mpnu0tlx ii3tld aDemuvp u4alenxr3tadfaDe nvi t tetmxrpio4lp   ivta(farrm(m nt0altomiciasfs ra(vo;u4aetomfcoodlp elnvo;s0t2to(o iy1lp n nvs tfarrm( p;o4aleo fciytfm umn o;u4texrmr3to1oaDe neo s)setr(m3iudlp   icilt)a2tm(m no4apx  octls a2um( ont4tltrio oa1lm elueo s0texmxopio1ap nmfvtlt  Dumu  ;o0tpxo fctadfm ea( p;(4 eenifctydom elivs ()trumim nodlp n iet s)sDua(rpoo1olxnioeiydls2rlnmo;u0 etnircoodoa   ueslt0srxr(o3ou4om n ncs t sDururont0apeoifeiltfsDumnvs t0tlxnxf tydfp raneo (0t2to(r oo1al  mivi s a2urxr no4ale  octldfs rmnvonu4 rerxfciytlmtrlnvi;( s2trxmpiu1apt lfetat s2ta(mpnu1ole mieiyd a2uluvonu)artrxrcootla elu sl(  rxrir3nudoltnlfcslt)artruronu0oleo f3ias aDua( sn()altnxr3ta1faDe neo;t0t2um(opnu1amee fetl(f rtaxr ou1aleomf3iadfs2um(vont0aexnmoctodopteanvi t0srtr(r nu1lmtelictas)aDrmxr ;u4tetnio3tld a2umn o;u4tltrmf ia1omteau s;s0 2tr(r3ny1al   ies tfs2tmu pnt0teenio3iys m umuvs;t0aetomr to1fa eai i s)s2urio3no4lpe lnei sfartru ont0tetoifcilt s2ua( s;t0aexoir oadomtr uvsls)s2tr(mpou1llen nctat  Drau pno1opto i3iysfaDeluvo;u0aexrmrciadfaDeln s s0teur(opiudol nlneil(fa2ta(mpot0alto f3tlt m ua(mon(0aetomfcto1fa e u ols)t2trir iy4am  mfcils)srtm(mpno1ope iieiat a eanvsnt0aetomocoa1lmt  n s;t)trtoxm3nu1ll emnvt t)aDtr(rooo4tpt ioeiadfm2rlnvs;u0texnir tatom r neo t trxmirpoy4al n ieta( a2rrxmooo0texn ictltlmDulu snt0tleoxo oydfpDr iesl( s2urim3iodlme lics t)aDuax ono4apx ii3tat m2ra( o t)alxoxfcta1om   nvslt)teuo(mpnu4lm  mneils a2taum ;o1tltoioeilsfm ra(vo u4 reomocta1la r nes t0trtmxm3oydlle lfei ()sDumum nu0aex ioeilt m2eanmpnu)treoiociadoaDeai sls t2tr(o nodamte fvs ()a2rmxr ;t1oex ii3iyd aDuanmont0 rxrmfctodlmDe ivo ()srxoxm nudlmeemnei ( aDtax pot4tet iieiatlm eau s;t4 ltriocoydomD ai ilt)trxriopoo4om   fetat a2uru  nt0oltnif3iaslsDua( sn(0trenxr oytlmte ieol( trtmxr3oy1olt lncia( aDuru ooo4teenmo3iyd s ean on()aleoio3ta1lpte ivo;t srxm(rpnu4omtnlivia(fsrraur ;o4ope mfeils s2uaumpn()artrio3iadfatelnvslt  ruo(m3oydlmt lfeias aDtau  ou4olxn octlsls2um( p t0 rtnmocoadopDe neolt s2toim3iydam   neiltfaDuaxr no4oltn ieiltfs2ra(mp;u0trxnifctadlm ranvo s t2uoxm3oodllen icsatf ruru pnu4teto fctyd a2rl(vs;()teenmocto1lat lu s t0t2toxm io4lp nliviasfsDtr(mpnu1ape  i3iytlm rmnvo;t4tlerxo to1lpte n s;()truoxr iodamtnmfvi s  2rmu poo0opx ifeiasla2emuvs u0aexnmf3tydoa rlivs;t)t2xoimpiudom n ieil( s2rr(mpno4aex moctldla2ra(mp t)tleomo3io1oaD anes;() euoxr3oydoltn ictat aDumum oo4tetnmicild m ua( pnt4 rxrmfcta1fat au ols s2xmir3nu1ame lfeta()arrrx pnt1oltnmfeiltlmDrmumon(0texrif tatfaD auvslt)trxr(m oy1apeelfvsls  2trum nt1tet  ietytfs rluvs t)aetriocoy1oatrluvslt sruo(m no4amtnmneias)a2uauro;u4tltoiietatlaDrmnvo u0alxrxrcto1oaD aivo s teumir oy4optn fetatfsrrrxro;t0apxoifciatls2rmuvp u0 rxomf3ta1lmtr i i;s) 2urirpoudopt lietlt)srraumpno4teto iciasfsDrmnvsnu0teermocoa1fmt  u ilt) rxr(o iy4llt mics t a2rrxm nu4ope  i3iyd a ranvs (4arerio oa1lmtrauvi t  2tmxrpiydam elivtlt a2taxm oo0oexnifeilsls rl(vs t4tltrmr3iodomD an s;s) rtr(r oy4lp e ict t)sDtmxr ot1tltnii3iyt sDrmuvo u0tlerirciytoa  anes;s sruoxrpno1alt mnvtas srrmum oo1opeomfciadlaDul( s (4artrir3tatlmDe ieo;(0seuoiopnudale miet s arrrumoot0apto fciltlm2rlu s;u0aeerio3iytfmDrlivo;t srurio no4lptemieils  2tr(  ou1aexoii3iltfs2eanmonu) exnxf tatfp  anvs;s) rxoxmpiu4lmen ivil(  Duru oot0tet mfetld s2rlnmo;(0teenxo iodla e uvo ()teurxo3iudalt mneia(faDtau pnu0aetoifcilt m umuvs u0teenxf3iydlat au ols0trxmxm3iu4ll emieils sDumxr ;o1aetomfeilsfsDel(vsn()artoxocoatomDr uvilt s2tm(rpio1ame lncslsfarrmxmoou0tpeo feiaslsDum(msn(0aeeniocto1omt ln i;()srxr(r3iu4am   fvtlt  rururpou0oleoiieiyd a2em(mo;(0 etoif oodfmD an ils0srtrxrpnydll e iesa(fa2rr(r ;o1tpeo f3ilt aDuauvo ()alenxf3ootfp e nvs s t2xoxr3iy1lmee ivil( sDrr(mont0aet ioctls aDemu o;u4altnio3iytlpte uvs t) euo(o ou1ll emncsas a2ua(mp;t1aex mfcildfmDulumon(0alxoif3ootoptr ivolt)t2xrxmpiu4ape lnei ()aruru o;o1altnmi3iyslaDuluvp u0teeriocta1lmDeai o;t)t2toir io4aptemicta(f 2tmx ont4aexoioeiyslm ea( p t) eeoiociatfmDe nes;t0setriopnydole mnvtat) 2tm( onu0tpt mi3iytfsDem( o t) etrxf ty1lpDrlneils srtmxo3io1opeelfvil() Drmxro;t1tet  oetlsfm2rlnvpn()trxrxo3oydlpteaues s)t2xoir ou1opt lfvslt  rraxrpno0aex mfeiltfa uluvs (4 rxoxfcty1fmtelnvs (0 2trxo iu4ome liviltfa2uau  ou0oleo icils sDrluvo (4arenxr tydfmtr nei (  2uoir3nodlmeelfeilt)aruaxmoot0oee  iciyslm2ra(mo u)trtrxr oa1fpD  ivi;t s2xr(mpno4lpeemnvsa()a2trx p;u1tltn f3tadfs2em(mpn(4tltniocio1oaD aivil(  rto(r iydopee nvtlt) rra(r ;t4tlenii3iadlsDelnms u0 etrir3ta1omDeaieol(  rxr(opio1aptelfvs t  2rru oot4aeenifciydla ea(msnu0teenmociy1lateanvslt)tetrxr io4altnmnci (faDra(r ot1alen oeild s ea( o (4 lxnxrcio1fpDeluvi;t)s2to(m3iu4lle  fetltfartrumonu4ape  feias aDrau o;()alenirciydomtelneo;s)trumxrpiudlpte fes t)sDraxro;t4apxn iciytlmDum( onu) rtrxf to1laDelnvs ()s2tm(rpiudaptelnvt ()sDraxrp;u0olxo fctys aDuluvs (0arerio3ta1lpDrlieils0 ruo(opoudlmtnmnvtas  Dtmx ooo1tle mictasla el(vp;u) etomo to1optrlu s;t0 rtoxrpny4llt  iciasfsrrr( o;o0tetomo3iltfs2rm(vsnt0 lxoio3tadfp elueo (0trxm(r3iydopee fci ()sDua(m ou0apx  i3tyt mDrm(vs;(4aexrio tadlm rluei;s0 rtmiopny1opeemnes tfarra(r ou0oexniieild s2ra(vs t0 rtoxf3oodomDranei;s0srumxr oudop   net t)a2rax  ot4altomfeiadls2umums u) rtnmr3todoaDrauvolt)s2ur(m nu4apenlfes ()srumxrpnu1oexnmieiltfm em(mon(0texrxociydfmteln sls)teuoim3ny1al e nvslsfaDtmxmpou0tpe ioeias s uln sn()trtnxr ootoat au s;t0s2urim3ny1lm nlfetl()a2tm(mo;o1opxnifeils mDrl(mpnu)teeomo3oy1fpDr n o () rxmim3oo1ome  ivsas a2ta(r oo0oltnmi3iat s ra(vs (0arxrif tydlate u o;() rumio iu1oleemfes s  Dtaurono0tleniieiat a2ranvo (0treomo3tadlm   i i;t setoxm3oo1llenlnvt ( a2rm(r nu4tpxomieias m uln p u)alxnxo3iy1fm  aivi t0t2xrxrpiu1openmies t)srumu  nu0oltnmieiad a2uau p;u4aexoircoa1lmt lies ()teuoxrpoy4om elncsl(fsrtaxront0tetnif3iyd m emnms u0 ltrxf tytlatrlu ols)srtoirpiu4optnliei (f Drrx pot4tpe mo3ilsfm2umn on(0 eerxo oo1omtr iei s s2xo(o iu4lpenmnesltfartax  ;t1openifetyd aDuanvs t0aetnxf iydoat  n s;t)t2urio3nu4amt  ics ( aDtau pou0apeo ictyt sDuauvpn(0altnmr3tadoat au s;t0t2to(rpio1ol elicia( srtmxmp;t4aex if3iytfs2uluvonu4aetrio ootfptraivs t teuoxrpio1lmtnmfetlsfarrax pot1ape  ictltlaDranvp t4altomociytopt li slt)sexmxo oo1lmtemfviasfs2ra(  ;u4tpeoiictasfaDran snt4arenmo3tadfm elnvs s0s2xm(o3nudomtnlfcsatf Durxmoou1tpxo ieiyd a2rm(vpn()treoxocoadfpt luei ( teur(m iydll n ivtat) ruaxm ;o4texn f3iyslaDuaumo;(4trenir iatfmtean i;t trxm(mpio4omtelfcilt)s2rrumont4alt mi3ildls rl(vs;t0texrif iy1lat ln o;()teumxm oy1ole  ivslt)s2tax oot1alxoifetad s2eluvsnt0tlxoir io1oaDeluei;(0 2ur(m iu1lm emnvtltf Drm(  no1teeo icildfm2rlu s t4texnxo3iodoa   ieols0teto(o oy4omtnlicia(f 2tm(  nt4tlen icils a2umuvon()tlxrmr ta1oa eaneslt srtmxo oudol nlfcsls a2uaxm ot4optnii3iad s2umuvpnt)tltnxf oo1fpt lieils0 2tmxmpou1lptn nesls)a2rmu p;t0ole mfciys aDelumsnt0aeenxr oytom elu o;s setmxm oo1ape lncsasfa2rruro;o4tpx mfetad a ea(vpn(4tetomo3ootoa e nvo t0s2xrim iu1lmtemivtls a2uaum ;t4aeenii3iadlaDemu s u4artnmo3oo1lmtr i sls)srtrxo3nu1optnmfcsl(fartrx  ot4aeeomoctysls elnvsn(0tetoxoctatomDeluvols)truoim3nu4omt mfvia(  2urum no4alx mociytfm ulumo ()aeeoifcia1laD  n s;( sexmirpno4llenliviat a2rruro;t1tpen i3iad aDem(vs (0aetoiociotop e iei;(0texmiopio4alte iesa(fsDrm(mpoo0olx iociytla2el(mpnt0 exnir iodlaDrlivslt0setoiopiy1al nmfes s)srtrxrpot1apxnmi3iltlsDrlnms;u4alenxo oy1om   ueo;()trtoiopoydapen fes s)a2umumpnu0tlx ifetatla umumon()trerifciy1la eluvs t srxm(r3ou4lltemnvsl(fsDrrxm oo4alenmietad a rm( o;t)tlxrmf ootfpD auvs t) etoim3iydap n fesl(f 2rmxrpoo4tle  ociatfm rau s (4artnifcia1omDe nes (0 2xm(o iy1ale  fcsat)aDua(ront0tpe iocildfsDelnvp;u4 ltnir3io1oaDrlivs;t) 2toxo nu4al   nvsa(fsrtmu pot4opx ifciyt sDrmnmpnt0tetrxr ty1fp rln slt  2xmiopiy4oltnmfvsat  rtrump;o1aexniiciyd a ul(von(0teenir3oatfpD lnvi t sexm(o3ou1am nlics (  rua( pnt4tlx  f3iaslm2uanvo (4 eeoir oatomtrau olt)trtoimpoy1ole mnet s sDurumpno4apeo ictlsfm uaumpn(4 ltomf oydlmt auvs;t  2xo(o iu4am n fct tfsrur( poo0alt mietasfmDemnvp;u4altoir3oy1laDe ivsl() exo(rpou4lm emncs s) rumumpnt4tleomoeiytfs ulumo;u)trxnxf3iadfp ean i;t0 2xrxm3oydlpt mfcs t  rurxrpnt4aleomfeiydla ua(mpnu0 ltnif totlaDeai i s) rurxm nydole lnet sfsruaumpot4aexo ociasfs2um(mo;u0 etniociadfmDelnvi t0t2tmim ny1lpee ics s) 2rr( onu0tltomfetaslm ea( p;()aetoxf3oo1la r nvo;s0 eumim nodop  mics (f Dur(m ot4tpenioeild a rmnvont0alenmr iadfm eluvils0srurio no4lmtelncilt)artru oou1texnifeiatfaDum( s;t0 exnxf3oatfaDeaivols)t2trim3oy1lp  lfvilt)srtm( pot0olt ioeiydfm ul(mp ()altomfciytlp   u i;(0 etoxmpno1ame lict ( arrr(rpnu4apeoif3iysfm2eln s u4 lxoxoctotomD anes (0srtm(mpio1ape lnvsat  Drmumoou1apeo fciytlsDeln o (4treomoctatopDrluvil( t2xrxo3iy4lmenlnvs ( aDrrur oo1opxnmo3tyslm ranvsnu) renmo3oatfaD ai o;t) eto(o3ou1lmte iesatf Durx o;o4aetoio3tlt aDranvp;(4 eeriociodomt aieo;s s2trir3nodomen fetatfa2rr( ont4apenioeiys a uan on()alermr3oy1lp rluvslt setoio3nydamenmfesl(fartax  nt0olenmicildfs uanmpnu) lxoxocoy1oatrluvs;s tetoio no4lpee fes (fa2trxr ;t0tlto o3ilsfa2ulu p t)arxoio iadoaDeaivs;t) euo(r3ou1amt  fvi tfsrtrurpoo0aeen ictld s eluvp ()tlxnircoadop  au o;t)seto(r iodomenmfvs (  2rmx oou0tpeoifciasfs2ran ont) ltrxrciydfmte n s;(  2uoxm oy4lpenliesat a2ur(r ;o1texnmfetytlaDrl(von(0tltoxf3iotomDr nvo (0 rxrxm3io4am emivslt)a2tm( ooo0aet  ietytla eauvonu)altnxo3io1oateanes;(0teum(o iy1apeelfvta( aDum(moot1apeniieiytlm2ul(vo (4alxrir ootoa r nvol()s2urirpnu4apen ieta()a2ua(m nt0apxo f3tltfm ua( p;t) lxomo3tytom eaneo s  2xrim no4oltn ncslsfa2tr( ooo1ape  fctytfa eln s u)tlxnir3tadfpD ai i t)s2xm(m iudapenmnctl(f rtm(mono1apenio3iatla2rmnvp u)teeoir3oatomDeluei;s) rto(o3nodlpeelncta( arrrxrpoo0tptn feild a2uaumsnu4altoircio1laD aivs;s)trumxrpiodap   fetas)arumx pnu4aeenmociyt s2elumsnt4arenmo iy1lmte i o (0t2toiopiodlle lfetas)sDrmx p;o4apenifciatfsDuauvo t0trxnirciatfaDrlu i;()t2urim oydaltnlnvt () 2tau ooo0tetniieiytfaDel(vp;t0arxnmf todfpDeanvilt0s2xmxm3io1ameelnetatfsDta(mpnt0aet mi3tlslaDrmu s;(4texnirctydlmtrlieslt  2xr(m ny1llt  nesa()sDrm(mp;t4aet mfeiytfs2uanvo;u)altnmr oodlm eauvs s0t2ur(mpny1al e ivsasf Durump;t4olxoiicildlm2rmump u4 reoxf3oydopte u s s  rxrio no4lmtnliei ( sDrmx ont1tpt mo3iat s2rmnvont0aexomo tytfaDranesls  rxrim iu1alte iesl()aDrau ont0tetnmo3iadlm2uanms;()aeeoxocta1omt lieo s0 rxo(o no4amtnmfet (farra(rpno1aetnifctlsla rm( o t) ltrir3tytoa  an ils t2xmim3iu1ome mfesa()s2uaxro;t1oee  i3iadls2raumsnt0 rerifctydlaD ai s;(  rtrxrpoo4omtelfvsl()sDtrumont4opx  feiytls ul(vs u0arxomo3ootoa eauvolt srtrir3no4lp  lict s)srtmum nu4olx mieils aDea(vo;t0texnifciatoaD ln o ()s2uoxo ny1oleemietlt sDtruro;t1tlxoiietytla2eau ont4aetrif3iatoa ranvi;( t2xoir iodoptelict s) Dtax  oo0aexn ietyd sDuau onu)altnmf3tatoat  i i t)s2ur(o oy1llen fcsl()artrxm nu1apeoioeilsfs rmu o;u4 lxrxocoy1fat livsls  eumxr nudap emfei sfsrta( pno4tpt mictyslm em(ms;u)tlxrirctadop  auvs;s0s2tr(rpnu4om nmfctls)arua(rono4texnif3tlsfmDelu p t4tlxrxo3todlaDeaieo s)setmxr iy4ape livtas  Dtr(mooo1olxoiictadfm2eauvon(4tlxnmf iotfpte ueo t0tetmxm3iodlp emictasfa2ta( onu0aleoiociytls umump;(0 rerir3iadoptrluvi ( texmirpiy4lmt lics (  2rrx poo4tpt  ieild m2ua(msnu4texrxf ia1lpt anvols0setr(mpnu4apt lnetl()srtrx poo1openifciyslm umnvs;u4trerir3ta1omt luvs ( t2xmio3iy4altemncsa(f rrrxmpoo1apxo octysfmDemuvsnt0 lxomfcoo1fpDraues;s texmxo ou1optnmnesa( srtru p;t1olx mi3ilslm2rl(vsnt0aexriocia1laD  uvi;t)texrim ou4om  mnvsa()s2ur(rpoo1oleomieiytfs2rm( s t0 etrxr iodoatelnei ( seuoxm oy4olenmfvs tf rrm( o;t4ape ifeiydls2rlumsn(0tetrir3iodoa eliei s) 2tmiopno1alt  fctls)sDtaur oo4tpt  fetlt a2eaums t4 exomo ootomD  i i t)srtm(mpoudlpee fvt sfaDtmumpot0olxn fetytls2rl(vp t0 ltomf todfmtr neols  rxoim3nodam e fcsltf 2umxmp;o1tle mf3iys a ua(vs t0aeermrciodlptr nvils) eum(m iu4lpe  fctl(fsDrrur ;u1tex ifetldfaDumuvp (4trtomr3oydfa eanes s setrxm no4aptnlncsasfsDurxrpoo4apt  ieiysfs2el(vpnu0aexnmr3tatfp e i s (0 exm(mpou4ap e ivslt s2tm(  ou0tpeo o3iydfsDel(monu)trxnxo3iodlmtrluvs t srtrim3iydlpee fesl(  Durumo;t1aet  feiat a2eanvo u4 eeomf oytopD anvs;t) eurxo3oodll elfvt tfarrmxrp;u4olxniietydfm2ul(vpn(4aleoxr3todomte ieslt) 2uoim3oy4lp n nvia( a2raur no1ole moeiasfm2ranmo t4tlenir3ty1omD livi t)seum(mpou1olt lfcsat s2raur nu1tptomfctas a ra(msn(0treomfctotop ranvils  exoirpio4ap emnei (f 2rmurp;t1tpt mo3iatla ul(vonu4trtomrciydopDeliei (0t2tm(mpiy4ap   feia(fsrtaxmpou1tlx mfetasfaDrlnms;t0tltrif3tydoatr u i ( t2ur(mpoy1amtnmivia() 2umx pot4teeoioctlsla eauvon(4aetrir3oodlpD  u slt)s2tmirpno4ll nmnet s  Dtrxr ;t0apto f3iadlm uau pnt0aexoio3todlmt anvol()texoxo nydlpenlfei (fartaxmp;u1alt if3tyt a rm(mo;()tltnmfcootfpDe nei (  rtmxmpnodamt  nes ( s2tmx o;u1oeenio3iys s2el(vo;u0alenxf3oa1fmt  nesls0setr(opno1om elies () rra(mpno1aetnmociadlm umn pnt0 lxnxo3io1om  auvi;s)srtm(m iu1amt mneil()arraumpot4oetnioeiaslm2el( ont)alerxf oodopDe neolt tetoirpoo1optemfetlt) rtaxmpot1tptoio3iydla umumont0 etnmo3ootfpDelivil( s2uoxr3io4aptnlneiat)sDum(r ;t1tpt mfetyd s2emn s;(0 exnmr todfm rlnvs;t)trtmxo io4lmen fcil()s2tr( pnt1tpen ocilt sDrmums;u4 rtnifciytlaDraneolt s2xr(r3iy1omtnlfcslsf Drrxrp;t0altoif3tas m emn o (4 etomf3tydopDr neols  etr(m3iudoleemnvi t)arrmur nu4tlxoiietat m2elump;u4alerxo3iydfaD  n olt)t2umir oo1ll  mieia( a2uaump;t1tptnioctltfs2rln pn(0aetrxr3iotopDrluvils  2uoxm3iydam elfes (f rrr(m oo0aetoifeiatla2rm(mpn(0arxoif ta1lm rluvo s0 rxm(o iu1op emiviasf Duax  nt1tpe ioeiltla2em(vo u)aleomr3todfptr ies s  2umir3nu1oltemnvia(  2umxrono0tetn fciyt sDeln ont0artnmo3iodfptrln i;t seurxm3oo4ape  fvt ()sDtmxr nt4tlx ioetls s2umuvs (0 rtomo3oo1fmt anei;t)t2tm(m3iydope lnci (fs2raxr nt1tlenmfeiatlmDulnvp (4tlermf tydoatr ivil(0 rxrio3ou4ol e nct t  rraxrono4oee mo3taslsDeln snt) rtomr iotlaDrlu sls0teuoirpoodomen ivil(f Drru ono1apxo f3ild a2rlnvon() lxnmociotlatrli o;()sexoxr3nu4omt mfcsltfaDtm( ono4oexn i3tadlmDemn p u0 rtnio3tadoa  luesls)srtmxm3ou4llt miet s  Draxmp;o0tex  oeiysfa2um( o (4arxomr oatfat  ies;s0 2uo(o iodoptnlics ()aDrmxrp;t0aeto i3iyt sDeln p u)arxnio ty1fpt ln s t0trxoxmpoo4lmtn net s) Dta(r nt4tlt  i3tldfs rm(ms ()trxnmfcoodomt  u o;s trto(r ou4lpe mfctltfa2um(rp;o1aleomfciadfs ra(mont)tlxrmrcoo1opDeli s s truo(o3iu4olt lfcil()a2rau pot4tpx  oetys s2rl( s u) ltoxo3iytfmDr u s;(0trxoxm iy1lp elfcilsfs2ra(mp;t0altn feils m ulnmo;u4 rermrcto1la elueils  eumiopny1lptnlfvt s s2umxr ou0oex  o3ilslm rl(vo t0 rtnxr3ty1omDe nei;t srxrxr3io1ome  nvsls  2umur oo0apxn o3iltlm2raumsn(4arxnxr3tydomtrau i;(0 2trxm ny4lmen neiat) rrax  ;o1tee iieiydlm2rau ont) lenifctatlm  aieils  eurir iy1al  lnvsa(faDtaurpoo4olxn fetatfm2eluvp;u)altnmf3oodomDraivil(0t2umio3iodlp nlfet t  rrm(  ot1teto ieiltfm2emuvp;t4 reoxo3oodfm ean i;s)trto(m iy1lmee ictltfsrrr(m nu4tleo ociad a2ranmo;t4aetnmr3iatfmDrlnei;()srum(opnodlpte fvs sfsDumx o;u4tpxo f3ildlm2rauvo;u4 rtnxfctodom rau o s)trumxo3oudapt lietas a2tm(m ;t4oltomfeiyslm em( o (0trtoifcty1faDr u ol() rtrimpnydole mivslsf Dur(mpno4aet  fetyt aDranmp ()aleoio3todopDrlueo s setm(o3io4lpee fvtlt) Dtaur oo0tlxnmf3ilsfa2eanms t)teerif tydlpt  n s;( s2umiopoodapte iet tf 2tm(m ot1aetomietat m ulu s;u0 ltnif3tatfm  au i t srxoir3nodlmenlivt (  rrm(r nu1apto ieild s ulu pnt4 eenmo3oodlat  uvo;t0s2umxr3ny1ap nmnvtlsf 2rr(ro;o4opeo fetld mDea(vp t) etoxf3iydlpDr ues s  ruoxmpnu1lm nmivtlt) rua(rp;t4alxn feiltlaDra(mpnt) etrio iy1opDean ols0sexmim nodllee nvta( sDumxr ;u0oltn feiytlm ua(ms;u4tlenir3oatfm rlneslt)t2toimpoo1ol emfeta()s2tmx pou4aeenmi3tatlm2rlnvs u0treriociodomtelnvs;t) rxm(r3nu4alenmnetat aDrmum ;u0optniieiyt m rl( o t0aetrmo3iytfm  auvs;(0srtoir3oy1ole liei s s2urum nu0tetoii3tysfs2uau snu)arxrifctatfat aivol(  rtoio nydalt  nci t)arum(r ot1aee mocilslm2ulu s;t)treoxo3todop rlnes t0s2xmxmpiu4lle lict ( sDra( ooo4aptnifeildfmDeluvp;u) rxnio totfpDeauvo s srtrxm3ny4llte ivsl()sDtmumoou4tpenmoeilsfs ranmpnu0 etrio3tatomt  u olt0s2to(o3oudop nlfetls  Duru o;o0opxn ieilslaDean p u4 lxomrctytomDeau i (0trxm(mpiydalt mfcsatfaDumur no1tpxoif3taslmDemn o t) ltomf3oy1oa  aieilt0seto(m3iudolee ici sfa2umu onu1aexomicils s2emums t4tlxnir3tytlatrln sl(  rur(rpou1op n ictat s2rm(monu4tlt mfetydfaDumn snt0alxnmr oytfptrau sls0t2xmxm ou1ap   nvilt) rrm(  ot0apt miciadfs2uln o u0 rtrio3oodopDr ieols)seurxo3nudomenliciasfsDurxrpnu1olxomfetadfsDrm(mo t0areoxr tytopteaiei s0 exo(m3oodame lnvia(f rrmxm ;u4tlxn oetydfm2umuvs;(4alenmf oytfaDe u il( s2to(mpiy1lmte nvi tf rrr(  ou0olxniociyt m rauvs;t4trerxo ia1opDrauvi t srtoir iu1lm elici t aDtmu o;o0alxnmiciytla2uanvs t)trxrxr3oydop r i ilt)sruoxopoy4ll  lfeias artaxr no0aee miciydfaDeanmpn(4tlxrirctodomt aieols t2xo(o3iy1openmnvs tfaDraur nu1tlenmoetatfa rmu o;u) lxomrcoo1laDran i;t)t2xm(o oydole mfvsas)aDtaxrpnt4tptoiieiydfsDemnvo;t4arenxo totopDe ivs s)srxmirpno1alenmiciltf Drru onu4teenii3iadfm2rluvp;() etnxr3ty1fp   n sl(  etm(m3oydal emfcs sfa2umx oot0oexoioetad s2ua( p t0altoir3oydfa rlnes ()trumiopio1opeemnvs s)s2um(rono0oetn icils s2ranvp ()trerxfcootoa eau i;()s2xr(r3nodoltnmfvt (fs2rmump;u4oex  ictysfsDumnmo;u4aexnxrctadlmDr u o;()truo(o io4lm nlfetas srrax p;o4opx  fciadlsDulnvs;() exnxoctydoaD luvilt0trxm(m ny4apenmict tf 2rm(  no4aeeo f3tldlm rm(mpnt4altnmr3iadoatr nesl( s2xoimpnydopenlncslsfartmu  nu0aeeo f3iatls2emnmpnu4arxrxo3ta1lmD lnvslt)s2to(o3oudap  lnctatf rtax ont0opx ii3tas m2elnmp;u)arxrmo tytoa rlueol( teurxo3oudlm nmfcta(fsrraxroou4olen ociatlm2uau p;(0trxoir3oatlaDraneolt0 rurxr3oy1lltemfetl(f rumur ;u4tetn octatfa2uanmp t4alxnio iydla   i i;t)truoir3oy1ome lfvi sfartmurpnt0alxniicild aDuauvonu) lenmoctydlm elnvo;s texmxm3no4ll nmnvtlt)aDtm(roou0oeeomicildfsDelnmo t4alxrxfcoadfmDr iesls0texm(opoy4altelnvtl(  Dtmum oo1ale moetasfa2ulnvp;()teermo ia1fatrlnvi ()srxm(rpny1lmte icsls sDururoot0olxniietasla uluvo (4arerxoctytlpD  nes t)teuoxmpio1ll nlfei s) Dtrx  nt0tpenifctlsfa2rln s () eenmf3ta1lm elu s;( texr(o ny4aptnmnvia()sDurumpot0tlenmociysla2em(mo;(4aexrmf3io1lmDrlivo t s2uoxopoo4amt livt t)arra(r nt1aptn iciydlaDem(mo;u)arxoxrcio1om elnvs;t0seuoimpiy1lpenlfcs t  Drm(r nt0apxomociaslmDuan p t0 exrmfctotopDe u ols sexmio3io1ll nmfetl(fs2rmxmoot4tex iictlsfmDulnmsnu4arxnmocoadoaDr neil( truoir oudap   ivt t)sDta(monu4ale ifciatla uanvon()tltnxr ta1fpte uesl()srtoxopno4lpe  ivi t)aDuaxm ;t4apeomfetadla em(mont0tetoio3oodopt lneslt0 2tm(o ou1lmtn nvtas artr(mpou0tlenmoeiytfm2rmu p;u4alxoxf tytlp   ieilt0srurxr oydom n ivsa(f 2raxrpnu0optn i3tyt s ran s;t4 rtnmr3to1lmDrluvi;(0texm(o3iu1llen iei t) 2ra( pnt0oleniociatls2um(von(4altrxf3iotopD  i i;t0 2tr(rpiu1ame  nci t)sDrrxrono4tpx  octydlm2umu ont)texnifcoa1la e nvils)sexmirpiydlpenlnct (fs2uaum nt0olt ifctls s2rlnmonu)tltrxfciytomte ies ()trtoxr iy1omteliei s  rrrxm ;u1alx  f3ilt m ra(mpnu0teenio oatlpDe uvi s0 rtmxm io4apen ncil(fsrtmx ooo4open fctldlm2em(ms u) eenxf3io1lmD ai i ( t2xmxm3nodll nmivt s)aDtaxrpou0oltnmo3ildls umu o;(4tetrif3oydomt luvi;s  eumiopoudal  mfeils  2ur(r no4tlenioeilsfs elumpn(0arenxo3oatlpDeaivi;t) 2trxm oydalte netas s2uax ont4olt mieiltlm2um(vsnt4aetnmo3iy1la e ivi s0 rxmir3nudll  micsls arururonu0apt  ictas m ulu s t4artoio3iatlm  li ils)seur(r nu4aleemncs ()srrrump;t4tlxnmoctyd s2ul(vp u0tlxoio3iatlmt lu slt) 2xm(mpno4amen nviasfaDur(  no1ole mf3iasls ranvs;u4tetnmf iotlmt  ues s0teuo(rpiudol  mivsl()a2rru pnu4opeoif3ildfsDrl(vs;u4 rtrxfciatoaD luvo;t) 2xoxr oudalt  feiat)srrm(r nt1tpeo ieildfa2uln s;t0trxnxf tytopDeanes s  2uo(m iy1oltn ncslt) 2trurono4ole  oetydla2umuvpnt0tltomocty1fa  livilt)t2to(rpnodolenlnvsl( a2raurpot0aleomfetyslmDrlnmp;(4tleoir totomDr neo (0trumxr3ny1ap e ict sf rumumoot1oeeoii3ild sDraumo (0aetnmfciotlm  aues s seto(r nu4oltemietl(farrmumpno1tpeoiieilsfs rm( pnu4tltomrctatlmDe nvsls t2ur(r3ny1lm nlfvilt)aDtaur no4apenmi3tyd sDra(vs;u4 lerxr3iytfptelu i t)setrxr io1amt  nes s arurxront4aptn fcilsfaDuauvp t0 eeomrciytfa  lu i t)sexmir nu1lp emfciatf Drmx pou4tpxo ieiasfa rauvo t4aeerxocoadfmtrlnes t) euoiopnu4lltnlfvsls) 2urumpot1olxnioctlt sDumuvs u0tlxnir3iytomDe i ils0 2trim no1lp  lfcilt) rurur nt1aetnmi3iasfm2uln o t)texrxfcio1omteau i (0setm(m3iudllt mfctl()aDraxm ;t0alt  ieiytfa elnmonu4aleomociotfa eaueol()teurxmpiodol nmfvi t srtrumoot1oet io3iysfm2rln ont) etnmoctadlmD ln s;t seumxr3oudlp e fesltf rtm(r ;o4texn f3iasfsDranmpn(0alxnir3todlat auesls)srto(m nu1alenmfes s)s2raxr ;t1aetn ociys a2rlu o;u4altomf iodlpteau o;() 2umxr ou1lm nmnei (  Duaumo;o0oeeomfeild m2rl(vo;t) etnmo todfmDr u ilt sexm(r oo1lmtemicias)aDtr(rpou1aeto fctytfmDumu p;()aetnxf3oodlm rluei (0 rtmimpno4ol n ivsa(f Dumu ono4tlxo i3iaslaDuanvo;t0 exnio tadoa r nvo;s) 2tmxo ny1om emfcs (  Dta( pnu1alen ocild aDrl( ont)altomf3oo1lmte u i;()srtmxr3oy4lpt  ivils) 2tmxmooo0tlx miciysfa2em( s;(4treoxo3io1omt lueil()s2xmxr io1al n ici sfartmxmp;o0tee  ieiasfa ul(monu)arxomrctodomtelues t0 etr(rpiu4openlfeils) 2tmxronu0tptn feiasfa2rl(vpn(4arenxo oodlm elnvs;t) ruoxrpoodom emictas artaur ou1teto iciasls uluvs;u0aeenmfciatomDe neo;t) eumiopnudap   iesltfs2rr(mooo0oetniicildlmDean s u4arenmo3totfaDelieols trxr(r no1amen nvi ()a2rr( p;u0oee  ociatlmDra(mo ()tltnmf oa1fa  lieols)sexm(o iydlm nmiesasfs2uaxmpou0olen f3iadfs ul(vont0arxrif3oy1op   ieo;t sruoimpoo1lmenlfciltfsDtmuro;u4apt mociat sDrl(vp (0tltnifcto1fmD  ues ( setoio ny1lpte fvtat  rra(mo;u4altniiciyt s2uln pnt4aetoio3oadopte nei s)texoiopnu1ap nmict s sDrm( ooo1altoiieiysfm ua( snt4tleomfctotfmDelnvo (0trumxopno4amt mfcta()a2rr(ront0tee if3iaslmDranmo;u)aleoxociydopDr nvi;s s2tmiopiy4lptemieslt)s2ua(mont4tptomocils m rlnmsnu)tltnxo3oo1om eln o (  2tmim iy1lp n ivs (  2rm(mo;t4ope  ieiyt a rln snu)aexomr3iydopD  ueilt0 rtmiopio1lpeelfci t aDrauroou0tlen i3tydfm2ua( snt)teenmo ia1lp rai i t) etrxo3no1amen ivi sfsrua(ro;t1tpx mi3iyd sDum(vs (0tltoio3tydopDelnvi;(  2xmxo iu1lmte feias)arrau  oo1apxn f3iasfsDua(vp t0aexnio3iytfpt  n ilt  rxm(m nu1olenmfctatfs2rru pno1aeen f3tysls ua(vp t)tetrif oodlp   uvs s)s2xmio iy1am nmneslt a2umum nt1tee mfciltfmDeluvpnu0aleomo3iodop e n s;t seurxr3no1amee fvsasf Dtm(  oo4oexnmi3iytfa2rmump;t0arxomrcto1lpD liei t)trtoiopoo1ll elnetas) rua(m oo4apen f3tldlm2rmnvo;u0tetriocoodfat  n i;s)s2toir3oy4op emivsl()s2ua( p;o0teenifeiasfaDuan on(0 rermfcoydfmt  ivslt)sexrirpno1altnmfvtlsfsDur(m ou1oetnmictadla rlnmpnu0tlerxo3oo1lpt aueo (0 2urxrpiu1lmtelnvtl(  rtr(roou0alxomo3iat s2rauvont4arermr tatfpteln slt  euoir3oodalenlicia(f 2rr(mpnt1tpxn octldfs rmumpnt0aetrxfciy1op rauvil( setr(mpiodop nlfcia( sDra(rp;t4tpt mfctys sDumnvp;u) rxnmociodomteai o;() exo(rpoo4olenlfvilsfsDtrxr no4opeomf3iadlsDelnvo t0texnxr3oa1fmtraues ()setmxm3iy4opeelfcsl()aDtr( onu1oeen feiydfmDuanms;t4 exoio3todlatraieo;s)s2to(rpou4openmfvs s)srraum nt0alen i3iadfm uluvpnu0aexnxrciatlm rliei t0s2ur(rpoodlmeelfviat)a2urxroot4olen i3iyd mDeanmon(4tltomr oytfat  nvs;t0t2tr(opiudll  lfvtat  2rmum nt0oleoif3iadls rmnvo;t4teenio oytfaD anei;t)srxr(m iodll nlfetls)srrrx pot1alx  ociat m umnvsnt) lxoxocoodfaD aues s t2xmim3nu4ole mnet (  2trx pnu1tpt iiciytls eaump;u)trerif3iadlmtr i o;t s2uo(o nu4lmtemfvslsf rrr( pnt1tetoiicilsfaDumnmp u4 exnio3ty1opteliei s  etr(m3oydom e ncsas)srrax p;u4tpe moeiytfm um(vo;t0texnmo3tytoaD ai ols) etrxrpoodlm  mfeiltfsDtrx oot1apt ifciasfs emuvo u0trxrio3iydlaDeli slt0sruoxrpio4llte icias a2tax pou1tlto iciysla2rluvsnu4alxomociy1fp  anvslt) eumir3oydole  nei t) 2tr( p;o1teeo i3iys mDeanms ()aeenifciytfm   ivs s t2xrxo iy4omt lfct t) 2trxr ;u4aee iociatfs2ulu ont4trxoir oodoateaneolt sruoim3ny4opee ivsa()aDrax pnt0tpe iieiytfm em(msnu)arxomo3oo1lm e nvo t trxo(r3oodomtemncilt)sDumxmoou1tpx iiciadlm2el( p;(4aetnmo totlpDrlieolt)truo(r nu1ap n ietls)s2tru onu4tpx if3ilsls umnmp;t) ltrxf oa1lpDranvo;t0 2toimpny1lmenmnctlt)arum(mooo1oleoif3tlsfsDrmuvsnu) rxrmrciy1fmtrlu s s  2urxopiodam  mnes t)s2rrxrpno0alxnmo3iyslm2ul(msnu) etrioctodfa eli s ( s2uoio oy1lpe lnes (faDurxrono4olen feildfaDuluvsnu4tetoif ty1opt  nvil(0 rxrim3oydaptnmnet t) rtmxro;u4tet iieildfmDrmuvon() lenio oytlmte u s;t) exoxr oy1omtelnvi (  2tmu ono4aeenmiciatla2elnmp;t4 ltoifciotlp rauei s0 rxm(o iydlme lncs s) Dtm( poo4tpxniictlsfm2raumont0tlxnxr3todfm   n i;t0seto(m iu4ameelfei tf 2rrxmo;t4tlto ociydfaDra(vsnu)teeomr3ia1fateauvi;s setoxm io4oltelnvi s a2taxr ou1aexo fciaslsDeaumsn(0 etrmociadfptrlnes;s)trxmxrpoy1oleelncslsf 2tmumont1olx micilslaDrmn snu0 renif iadlate uvsls0t2umxopnudlmtelivias) rrrxmoou1tleo feiytfsDrlu o;u0aeenioctydfa rlivi t) 2xoimpio4omte ietas) Durumpno1olxomocild m ea( sn()tlenmocoa1lmtr i i;t0trumio3nydal nlnvt sfsDtmxmonu0aeeo ietys mDeanvp;u)teenifctotfaD  ueo s trur(o iy1oltelnvs ( sDrmu onu4tpto fetldla2rauvp (0 rxoxo3tadlpDranvil( srumxr3oo1llenlies t)sDtmxronu4oltnmi3iasfm2rm(vo;u)tetnifcoo1fp raivs (  rumir3nudlpeemfcsa()aDta(  oo0opeomociatfa2ua(vp t)artnxo iodlptr u olt)seuoxmpny1olte fvta(f Drau poo1oleoifctadfa2uan p;t4altrmoctytoptraivs;()srxrir3oydom nmieslt  ruaurooo1aet  ictltlaDrl(mpn(4 lxrif3oydfaDe nvols  2xmimpnydap   net tf 2tmu  ot1opx  icilt a rm(msnt4altnmrcia1oaD  nvo (0t2xoxrpio1lmen nes ()srrmx  ot0tex mi3ildfs2ra(mp;t4arenmfcoa1lptranvols) etmxm3ny1lmtemicsat srrrxm nu4olenifeiasla2rm(vsnu4texoxf iatlaD  ivi;s seto(o iydlp emncsat)s2uru  nu4tle ii3iatlm2raumpnt0 rxoif ia1oaDraneil() eumim nu1am n fct sf 2rau pou0tltoifeiyt aDeluvonu0aeenmo oydfpt lieo t0 rtrxr oudaptnmnvi s arurxmp;t4aleo i3tydlm2ul(vs t) rerio oa1la e n s (0seuo(mpiodlmtelfcils)s2raum ;u4tet  f3ias m el(vs t)teeniociydfmtr n o s)texmio oo1amt lnetat)arur(rp;u4tetoif3iyt m2rau snt)trenmr3ootla rlueolt0 rxm(m nodlle lfesl( arrrurpoo0alt ioeiadfa2eauvpn(0aetrmrcty1laDe ies;t) 2tr(m3nodomen icsa()artaxm ;t0oexomfetys mDulnmonu)tltnmo3iodlmDrli ilt0 2uoxopno4ameelnvia(f Dtm(rpnt1apxnioeiydfaDemumo;u)tleomfciydlp   nvil( sexm(mpoydom elfcslt  Dtrxr oo1aleo o3tlslmDrln p;u) etnxr3oadlpD lnvils) rtmirpoo1ap elnvta(f Dtm(moot4tltnmf3ilslaDeanmpn(0alxomociotomtraiei;s0srtoxrpou1lm  mnvsasfsrumu o;u4tle mocildfa2ea(mont4aexniocoydomDelnvo s0 2tmim nodlmenmnet s) 2rm(mo;u1opx  o3taslmDum(vpnu0 eenxfcoa1faD lnei s)srur(r3iy4opte nvi ( srumxrpot1oeenmociydfaDem( p;(4tltnmo oydlm elnvols s2tr(rpou4ol n iciasfarur(mpou4alxoif3iyt s2elu p u0 rtnxfctodlaDeauvilt)srumxmpoy4ame lncsat a2rruro;u0tleoiociyt s umnvp;(4 rtomf3ootoa r n sl() rto(rpny4ol  miei sfaDurumpnt0tpxoifeiadls2ea(ms;u4 lxomrciy1lptrlivo t  rxmxr nydlm emnet sfaDrrxro;t1aee  oetad aDum( o (0tltoifctotlaDeanvilt s2xr(rpoo4lm   fvil()srurumonu1olxnifcildfm2ranvo u)texoxo iy1lpDelnvi;()s2trxopno1opt mfetl(f rtaxmo;o0olt if3iys m2eau o (4aeerxr3oy1fmteanei t0sexrir iodlm  lncils s2rrur nu0tetomo3iyt mDumuvsn(4alxnmr3iydfpte n s;t srumirpiu1aptelies ()s2urxm ou1aleniociytlm umums t0alxoxr iy1oate u sls  ruoir3nu4om e fctl( srraumpnu4oleo o3tasla2emump;()teenxf iodfaDr ueo (0 etrxr3oo1om n fcsltfsDra(m nu0tpe miciyt mDumu pnu0tetnio3iadfa rlivslt0 2xrio ou1lp   iesatfsrtrxront4aetnmi3ias m2rm(ms;u) exnxr oo1fmtrlu i s)s2tr(m iy4lpe mfetls) Drrxrpou4altnmi3iadls2ea( p () etnmf oadopDrlivsl(0 2toxmpiu1om  mfcsls  Duaxm ;t0texo oetytlaDuanms;(0artoxo3oa1om   ieil(  2tm(m3oo1op emicils srurxmpot1aeto ietysfm2elnvpnt4altrmr3to1fatr uei;s t2xmim oo4lpt mncta( a2rr(mpno0texomfctyd aDeanvo;t0 rxnmf3iotlaDrlivil(0setmio3ou4llt lnci sfsDum(  nt1aeto o3tatfa ra( p;t0 etoif oytlm eaieo;() rtr(opiy1apte fei s)srur( p;u1apxn iciys s em(mon(4 renmf tydlaD li ols0s2xmirpio1ll  lietat a2trur ;o0olen ictltfa2uanmpnt) etoiocoatfmDr neo;t)t2tmim ny4ll elics tf rtmumpot4tlxnifciasfs ulu o;()tlerif3oo1lm ranes s0 2urxr3oy4ole  feslsfs2ta(monu1ole iiciat mDumnms ()areoif ia1omtrliei;t0 ruoirpiydapeemfvsas) Drmurpot1opxn oeiytfsDumuvs () rerio3tytfmDeauvsls setm(r oydlpe  ieils) rum(rpoo1tle ioeiat s2ul(vpn(4aexrxocio1laDe neo t)sruoxo3io4ape licsas)arurump;u0tlxomfetatlmDuaumonu0tlerxf oadfa rai olt0srum(r nodlmeemfcsl()sDrr( p;o4aeenmoeildfmDuan o;u)aetrxrcoadomteaieolt)trtrxopno4ameelfet t)sDrrurono1tpxnmiciltfsDranmo;u)aetnmr3oadlm eln ils0truoir3no1am  lncs sfsDuaxr ou4tlto fetltls2rauvon(0alxomr ta1op  anvo s)seto(r nodamtelictls artr( pno0aptomictyslmDuanvsnu)aexoif3ty1fa ran sl(  exr(o oodll   nci tfsDurumo;o4apto fciyt s umuvp;t4tltnxf io1lmteln slt)s2uoxm3nudap   nvslt)srrr(rp;o1tltomfctyslmDemnvon()tltrir todfm eaieolt)trxrxopoy1aptemfcil( sDra(rp;t1olx  ieiaslsDranmpn()altrif3oy1oa  auei s) etrxr3oo1lmt  nvtl()aDtmumoou4oltnmoeiltlm rm(mp;u)tleomfcto1lm rlivslt)t2xoxrpno4ol  lici t sDumxm nt0alx iociydfsDrm( on(0arerio3oodom e i s t tetm(o3oy1oleelfesat artmxr ou4apxomfeiytls2ulnvs;t0aetoxr3oytlateaivo s)srtmiopoo1aptnlfei s  2raxr ;o4apx  ictltfm umumpn()aexoxrcty1lptr u s ( s2xoimpiudlm  lictat  2rrum oo1altn fetldfa ul(vp t4arxrio iotomDraneo;()sexrio3nydamee fctlsfa2uru p;t0olx ioeiytlm em(mp u0 lxoxf3ia1fatelueo s) rxr(m nydlmtelivsat)aDra(m ot4optnmi3ilt m2ranvs (4aexrxf oa1lpt an s s  rxrxmpny1om  lfes sf rra(rooo0tleomf3iat a2rm(vont) rtnxo3oodla   neil()srtmim3nu4lm  lict s  Duru  ou0olx iictlsfa emumo u4 lermr iodfpDrlneols)s2toxo iydlptemfetl()aDrmurp;o1aeeo fctadfsDeln o;(4texrxfctydoa  lieol()srtrimpny1lpeemfvsls sDrmumpou4altnmo3iasfs um(vs;u) lxrxrcoo1fpteaieilt)trxrxr3iudlmt  nviatf 2raumono1tltn o3tydlm umu p;t) exnir3ia1oaD  n o s)srumimpoydam elnci (farrm(m ot1aleo oetls sDelnmo (0 exoio3iadfaDeaivo;t  rumio ny1ape  fetas)sDrmu  nt0tpt ioeiydls2rmnvo t)alxnifctadoaDelieols  etr(mpio4ame  ieil()s2tm( oou1aleoif3iadlm uaumo u)tlenxfctatlp  lneo;( t2urxr3ou1ap nmnct s  rrru poo4tex  ictasfa ranvo;u)trtnmfciydfatraneil( t2xmxr iudom elfei t a2rrx pnt1oltnio3tytls ul(msn(4trtoif iadoaD  nvi;()t2umxrpny4llenlnvtl(faDrau oot1tlxnmieilsfa rauvo u) lxniocia1fmD luei ()s2tm(o3iydlm  mneilt  rurumpou0tpxoioetasla emums;(0aexrxo3tadomte iesls t2trimpoudaltnmfeias)aDtrx  nt0tleomo3ildls elump;t)trerxf iadlm   nvs;(0 euo(r oudolt  fciat)s2umx onu0tpe miciydlm2rlnmo;u4arxnmrcoy1la eln il() rxoio nu4op e feil(fsDtmur no0tleoii3tyt a ranvp u) exoir tytom  ai s ( s2tr(o oudlm  mfesltf rurxmoot4olxoifeildfsDuaumo;u0 rtomo3oatopDrli i;()texr(r no1ap n netas aDtaxmpoo1ape mf3iysls rmu pnu) eerxrcia1faDeauvs (  2umxm nu1opeemnesatfaruaumono1tpe  feiadfm ranvs;t0 renio ootfate ivi () rxoimpou1ap n fvt tf rta(  no4openioctadlsDul(mo;t4 etnmf3io1oaD anvo (0texoio3oydoltn nvias) 2ur(mpno4apt mf3taslaDeanvsnu0alxoio3oa1om  luvo;t)s2umir3oudoltelneilt)a2raumpoo0aet mieiasfmDean o;t) reomfciodfptelivo;t0s2umir oo4lmtemies (  rurx p;u4open ietlsfm rmnvo () ltoxf to1fmDeluesls s2umxo no4olen nvi ( sDtmu onu0optoioeiad m2elump ()aleomociodlmDr n ilt s2xo(o3io1aptnlieiltf rumx  ;t0tlen feiadlsDul(mp;()aexnmrcty1lp rlnes;t)trto(r3iudlltn fesls)a2umxro;o1aptomfetatfa ua( on(4aeenxrciytomtrli i;t0 rxmir3ny4amtemfctasf rrrxrp;t1alxn octlt m2emumsnu4aetoifctodlatr i o () 2tm(rpoudop nmfvtlt)a2uaurpno0tpxnii3iad aDelums;u)aleomr3oydlptrlies;s) exm(o ou1omtn nvtasfarrr(  nu0teeomociatfa2uan s;u4trermf iotfa   nes (0t2umio3iudap   nvtat aDraum oo0alx ii3iydfa2elu p;(4altoiocio1fatr u ols t2to(m3io4olt livia(f Duau pnu0alxnio3iat s2umu p;(0altomfciydlpt  i olt s2trxm3iy1open ivil(faDrmur ;t0tpe mieiytlsDem(von()altrmoctatfaD  ivslt)trxr(o3oy4am e fvi ()aDuaxm nu1aeenmoeilsla2eaumo ()arxrmf ia1oa r ues ( seumir3iy1olt miesl(f Drmuront0oetoif3ild m2ea(vp;u0texoio totlm elnvs;s trtoxopiy1openmfetlsf rtm( p;u1apxomoeilsfmDeaumpnt4alxnio3oy1la e i o;(  2umxr3nodlltn fcs t s2rrump;o0texomoetasfs umn ont0tlxrmfciytoat lu s;t s2ur(o3iy4llt mneslsf Dtmxronu4tetnmo3ildfaDumnmo;u0arxnmf ty1omteau ilt)s2xoim3oy1llen fvs t aDrmuronu1oltnifcildfa2rmuvp u4trtnmf tadoptr uei;() etrxopnodoltn ncsat)srtru oou1tpx  i3tysfs eanvp;u0altoxrciatlpt auvo t0s2to(o iudap   ictltf 2ta(ronu4tet ioeiyd s rlu o (4altoio tydfmDrliesls0s2trxm nydapee nvt sfa2tmxrpot1olxoiieiasls2ua(vp;() etoxo tadoatraues;t) etrxr iu4lm elfct sfsrrmx onu0altoifetldlmDua( onu4arerxr oatlp r u s s)srum(m ou1al nlfet t)a2urxronu0apx ifeilsls ranvs t0teermr oydoatr n o (0sexoxo oydape  icia()a2uru pno4tpxomociyt a ul( s;u4teenxo3ty1faDranei;()sexoim oo4lpe mncsl(fsDra(mpoo0open oeiydfmDuln snu0trermf3todfmt  u o;s0trto(m ou4ol nlfvs ( srtr(mpoo4oee ioeiadfm2eau p t)aeerio3tytoatr u slt0srtmimpno4om nlics s) 2uaumooo4olxnmicilt aDuanms;(4aleomf3ty1om  au o (  etm(rpnydop   fci s  Dta( oou0tpxomo3tltls ulumsn(4artnif3tytomDrln sl(0texoimpny4omt mnes t)a2ra(ro;u0tlt  ociysfm ean o;() ltnxr3iadlatrai i;(  etoir ou1lmtemfes t)a2ra(r no0texn octytfs uanmon(4 eeoir3oy1latelivil(  exmio nydlmenlietls sDtaumonu0aetnmoetydfm uln snu4trtnxo oodlmD aivols0 ruoxo nodame  fcsa()a2urumpnu0tex  feiat a ranvs;u0aetoxocoy1oaDr ies;t0srurxrpnu1lm  liviat  rtr(  nt0oeenmo3iyd mDuaumonu) eerir iatfptr ues s0t2xm(mpoy1omenlieil(fsDtm(  ;o0oetn oeiatfa2ua(msnu4altoxo ta1fpDrli i t sruo(o3ny1apt lfcs s)aruaump;t0aleoiieild sDul(vs (4 rtoxo3todfmtrlueols t2ur(mpio1apenmnvia(f 2tr(  ;u1opeo i3iad a rlumo t)arenir iytoa  li s;s0srxm(m3ou4om e ictl( aDrax ont1texnmoeiasfaDumuvs;(0arenirctadlm raneols0 rtmirpiu4om nmnei t a2urxm no0aetoii3ilslmDum(mo u0tlxnmo3oytoptr n o;(0s2tmirpnodaptemnvs t  2umxroot0ole  oeiat a2uanvs;t0trxnxo3iydoatranvol(0s2xoir no1aleelfetas  Draumoou1teto ieiatlsDelu s;t0 rxnif todfaD aivo;t0 rxoio3no4lmtnmicsls aruaur nu0teeo fcils aDulnmo ()arxomo ia1oateaueo;( sexoirpno4aptnmfctatfa2tr(mpoo0olto icildlm ulums;(4arxnircty1lp   nesl() ruoxr3oy4apt  fcs s a2umum ot4aex mfeias aDelnvo;(0alxomo3iytop  an ilt t2toxr3oy1lmenlictas) Duaumo;o4tetn oeiyt s ua(ms u4tltoio totfptrlivs t0srtm(m3iu4lm nlict s a2ra( p;u4apto f3ild aDean s;u)tlenxf3to1oaD aivsl() 2uo(rpiy4lm e iet s sDum(m oo1tle mf3tltls2umnvs;t0 rtrxrciadlmtranei ( setmir nodlltnmfcs sfsruaxr nt0ole  fctas s umnms;u)alxoxo3oa1opte n s;s)tetmxr nu1ol emneslt) rumx pno1tptoifeiyt m uanmo t0alxomoctatlp eaivils0t2tr(m3ou4lmeemnvil(fa2umum ot0tlxnmfetldlm um( o (4tlxnxr io1om eaivils) rxrir nudlm elieiasf Drmum ;u1alto i3iysls2ulump;t) eenioctytopD  u s s0seumir3oy1ol elicsl(  Dtrx  nu4aex if3tys a2rlumo u4artomo3iotfpD livsl(0 2urir3nu4lp nmict tf Dtr(mo;o1tlxo oeiys m2ul(mon(4texrxf3iytfptrli s t)trxo(m io4lmtnlnvsltfsDrm(m ;u4opx ifeiadfa umn o;(4 eenxfciotfpD aieils0teum(rpiodom nmict s)sDumu  ;t0oeen o3tysfmDel(vp;t0aexnif tytla e nvil(0setmxr ny1optn nctas srtrum ou0tee iietatlm rmuvp ()trxoif oadoaDraieo s)sexmio3iy1omtemivi sfa2ta(m nu1opxoiociat mDrl(vp;(0 reoio oydfa r i olt)t2xr(opoodamt mnvsls) Drr(rpou4tetnifetytfs rau s ()aeeoxoctotoa  luvi;t  rumxm iu4aptnmnei t srrr(r nu4tpenmictltlaDumnvonu)alenxf3totlp rai il(0 rxo(o3no4am nmfciat)a2raumpot1opx mf3iysfa2rln snt0 ltnxrciatomtelues;()s2to(r no4olt  ici (faDrmx oot4tlxomfetls mDran onu0 etoxr3iytlp r ueil()t2xoimpiu1ol  mictl(f rtrurp;o1texnio3iysls2elumpnu0trenxr to1faDeln il()setrxopoudapt mivtat  2raxrp;o1oltn o3iadla ul( on(4 exomoctatfpD  ivs s0trtmim3ou4lmeelncslt  rta(m ;o4alx mi3iydfa2umu snt4altomr3io1laDeai i ( srumimpnu1ap nlfcs tfa2truroot1olen iciatlaDean s;u)artoxf3oytla eaivi;t)t2um(rpnu1omee fcs t) 2taur ;t4teen iciytla2ul( o t4artrif oytlmt  n i;(0tetm(m oodal nmfcia()s2ta(m no4teeo f3iyd sDea(vsnu0trtomocootomtrlies;s  rtmxm io1lltn ics (f 2ua(moou0opx mfctld mDumnvo;u0aexnir io1oa ran s s0setoim nudolee nvil(  2ta( onu0tpto oeild aDeluvo (0 eermo3tytom   n i;s)t2uoir3ny4opeemnvias  rra( o;o4tlx mfciadls2ulnms t0 reoir3ia1lmt li o s teur(o nodole mncilt srrm(rpot4aptoif3ilsfsDeluvonu) ltnmrcta1om r u i;t)trtrxrpno4lmeemfes sf Dumuro;u1aleoifetys m2emn onu0aeerif oytla   uvs;s trum(opiydale lieilt)arrmxrpnt0apxnmoeiasfmDrm(mo u)altoxf3io1lm ean ols s2xmxrpoy4lm n nvils)a2rrxr ou0altomfctlt sDeauvsn(4tlenxfciytoptr nvolt s2umxr3oodomen fvias) 2tr(rpnu0olt mi3iyt mDrauvp;t4trtrmfcia1oaDe uei;s tetm(m oy4lpenlfvsa() 2ur(mont0tlt ioetyd m2uan o;(4 leomfciydfaDeli s;t0 exmxmpny1am  lneils) Dua( poo1apxomoetys s2ea(msnu)areoirciy1lmDrluei;t trtmirpnydamt livt s)a2tmx o;t4aptnmfctltlm eaumsn(0trermf tydfmtrli s;t0 ruoiopnu1lme lnesls) 2tmxrooo1aptnmoeilt s2umu s;t4trxnmf iytla eli ilt)texmxr3nu4aptelics sfsrtrxm ot4alto f3ils mDranms;u0 eerxo oa1fateluvilt)seuoir3no4llen fcs ()arrmu oou4tltoif3iytlm ul(mo u) ltrif3ia1laDr uvo;t)s2urxm3ou1ame lnvsat  2um(mpoo0olt miciasla2el(ms;u4texrxr io1fp  anvo (0seurio oodal  mnci t a2ua(  ot0aleo fetatla umnvs;u0aeenxr oytoat livo ( s2tm(opio1lpte nei tfaDrr(mpou1tpeomietltlaDul(vp u4tetnifcoydlmtrlnes;t0trtr(r3oo4lp  lfcia(fsrra(mont1apenio3iadla eanmpnu0 lenir3oo1fpDr uei (  rumir oo4lpt mivsls sDrrxm no4apx miciatlm ua(mo (4treoio3ta1omDe uvsls sexm(r3ou4ll emics (f 2tm( o;u4tpe  i3iysfa2um(vp u4alxnxrcootla ean o;s)t2xo(o oo4omt mfci t)sDumxrp;t1olxn o3tlslm2uau o u0 ltnxf3oatlmDrai s s srxmir3ou1llte fesat artmxmpoo4olt  icildlm rlnms u0tlxnmfcto1oa r ivils0srtoio3iydomeelnetl() rraxmo;t0openiocilslmDeln pn(0trtrxf3iy1faD auvi s) 2urir io4am  mnvsl()s2tm( onu0opxnmictls s2em(mp u0altnxfciydlaDrln slt0s2uoio io1lm elivsa(f Dtrumpnu1oetn oeiaslm2elnvon() eeomf3iatom r u ils0texr(o3nu4al e ieias a2rm( o;o1opxn ociad s2rl( pnt0 etrxf ty1fp  lu o;s0s2xrxrpiydoptn fvi ( sDrmxmont1tlx iieiadla ean o;t)aexrif3oytlptelnvolt setmxrpiudope mnctas  2rm( p;t0oeeoiictysfa rln o;() eenif oytlm e ivs ( tetoimpno1ap nlivils a2tmxmp;u0aleomo3iytfs rmnmp;u0 ltomf3tadfmDe ivi;s) rtmxr iodame  fesas sDurxmpot0alx mo3tyt m2ra(vs;u4texoiociodfa raivi;( texr(opiodoltn ncils)aDur(  nt0opto fciydla2uanvo;(4arxnxrctodlmtrli o;t seurim3iu4optn fcs s  Dtax oot0alxn f3iltls2ulnvonu4aexomrcootlaDrln sls  etrxo3iy1ap n nvil( srumx pot4apt  o3ildfa um(mp;()aeermf iodom eln o;(0 eumio no4altelfcilsf 2tmxroou1tpeo fctadfmDea(vo;t)tltnxrcta1lmDrau i s0 exr(r3no1ap   ivslsfa2ua(mpou0tet  oeiytfm2umuvo;() lxnmfciotlmDrluvs ()teumir3iodom   nei ( s2urxmooo4tee mieiatfa2ulnms (0arxoiocootfpDeaiesl( t2umxm3iy1omeemnviasf Dtmxmpno1tlxo fetad sDulums;t)tlxrxfcio1lpt livil( srtoim3ny4lleemivia(  rtaxrooo1openmi3ilsls em(mpnt) exoifciydfa  livols srxrim3iodap elicsltfs2rm( pou0tetnmieiad aDumn o;t) exomf3ty1fm r u i;t0t2tmxr3ny4op n nvi t) rrm(  ;u0teeomfeiys mDrlnvsnu4tltnmo oatfmtrlivs;s0teur(r oudlm e ics ( sDuau pou1ole iociad a2rmnvo u0altoxociydlpD ln s s0 ruo(m3oy4al  lfvtlsfaruaum ot4tlt  o3iat mDel( o;t)aexnircia1opt  u ol() 2xoxrpio1opeelivtls  Drru oot4opxo f3ilsfsDrl(monu4aexoxrctodfmDrauvs;()sexrir oydamt mivtas) rtrxm ;t1tlto oeilslm rlump ()aetrio tydlatrlu o s teuo(mpnydame  icil()srrmu  ou0teenmfctld m2rm( s t0 lxomoctadopD  i s;t)trxo(rpnu1ol e feils sDrrum ot0oex if3tas m2ra( snu4teeoxfctotfmDelivo (0seumxo3nu4amt lies s  rtr(  ou1aeenio3ias m2rlnvsn(4 etrmr ty1opD  n i (0texo(rpiy4ap emietls)sDraurp;o4tpx  feils s emu o;(4tltnir oatfp raneo (0srtoirpiodlm emfeilsfarraum no4aptoifeilt s2um(von(4arerio3tytfmDeln ol(0 rto(rpiudam   fvs (  rrmu ooo0opxnmiciaslaDrmn pnu0artrmf oytlm r uvil() rtr(rpno4am e feia()aDra(m ;t0tlxniictydfmDumnvs (4 rtrmocta1faDrlieol(0setr(r oy1opt mictatf Dumurpot0olxoifcils a2rmnvsn(0aexrxr3io1lmDr ivi t)setrimpio4aleelicsls)arta( oou1tltomfeiydfa2ulnvsnt)artrif ta1opte ieo s  2xo(m3ou1amte neias  Drr( o;u0opxo iciys s2rau snt0trxomo ty1fmDean ils t2tm(r iodom n iei (  2tm( oot1apt  feiyd a um(vp t)alerxrcoatfmD  i o;(0 2xmiopio4ole licias sDtax p;t1tptnio3tadfsDemnms u4 ltnxo3tatfaDraieo;t)truo(rpoo1om nlnvtlt  2ra(m nu1aexnio3tasfm2emnmo t4 rtoxo3oy1laDraieo;( trxo(m3nydlmenlnvtas) 2um(ro;o4tet  fciysfmDul( pnt)artrxocta1opteauvs t s2tr(o3oudal n fvi sfs2raurp;u4alxnii3iad a2ea(vp;t)alerir3todlaDr n s (0t2xrir3oodame mfei t  Dra(m ;t0aee mociadfa ul(mon(0 exnmo iytoa   ivolt  rxm(mpiu4ame mivsatf rrmxmpno1olen fctydfs2rm( pnu4aeenif ia1oaDr ivil(  rtmxr3nodllte fesat)s2taxrp;t1ape io3tldfaDulump t0trtnmf3iodoaDraneo t0srxrio oodape  ncs t  Duru  ou4aex mocildlm ea(vonu4 exnxr3oa1omDr nvolt)trum(m nydlpeelncsas sDumx pno1alx io3tadlm2em(mp u)tlxomf iytomDrlues (0t2xrxrpnudop elivtlt arumumont4aee ii3ild mDuanmon(4 leoxr oy1lpteluvo ( trtr(o iu4amt lfes ()s2taumpno4aet  fcildlmDra(mon(4texomf3tadfmt lnes;t) etmxo ou4olt mivtlsfarumumpnu1opt iiciyd m2emuvpnu)aexoir oatfpt  n sl()s2xmxr nydalenmiesas)arrau pot0tlenmf3iasfa2rlu p;u)treriocoadoatr uvils0setmim3nu1op elfct sfaDrm(rpno0apeomfcilsfa2rl(mo () rtoio3oadoptelivi;t)trxoxmpnodlp  mncta(fartaumpot0aleoiicils a ran snt0aexrxo tatlpteauvsls0 exo(r ny1lleemfvil()aDua(m ;o4aleomf3iyt m2umums;t4trtniociadla  aues;t0 rumxo ny1lleemieiasfsrtrurpou4aptomoeils s rln s;(0aetnxo io1latranes t t2uoxopnydapee fctas)s2tru  nu4alxomf3tydlm el( sn(0 reoif3oadfpt lnvs (0tetr(opnydam  miciatfartr(m no1tpxnmf3ildlm2rlnvsnu)alxrif tydlaD lnei;t t2urim3no1oleelieslt a2uaxrpnt1teen o3tyt mDea(vp (4teerxrcoa1fm   n il(0 eumxr oo4ll n icia( s2taump;u1aex  ieiatfsDum(vo u4 etrxfcta1opD ai s t0seumxo3iydole mies ( arrr(rpnu1tet  f3taslaDulnms u0alxnmr3to1oaD aivo t  eur(rpiu1lle mnvt (fs2raxrooo1aee moctysfa eluvont4teeoxo ta1fa elivs;s0s2umxr3nudlltnmfvs ()s2urumpno4tee moctys sDuluvp t0tetnxociadopDe nei ( setmimpiu4optnlfvt s)arum(rpoo4apxn fcildfs rmnvsnu) reoxocto1fmDeluei;s sexmxr oy4amen nct s)aDra(mpou1tlto feiatfs rm( s () rtnxo3oadlm ean o ( sexrim oy4ol elfvtls  ruau  nu0tlxnmf3iasls2rau onu) etnmrcoydlm r ieilt0srurirpnodalt mics ( s2ta( pnt0tpt miciltlm rau o;t4altrxo oydfaD  uvi (0setr(mpnu4lmt lieils s2ua(rp;u0aet  i3ilslsDrlnmpnt4tlermfctytoaDr uvils t2xoxr nu4amtnlfviat)aDurx  ;u4aptnif3iyslm2ra( snt0 rxnxf oodop rlivi ()srxr(r iy1al  mfcta()aruaum nt4texn o3iytfm ua(vpnt4trxnmfciytlmDr nes s s2tmio oy4omen feia( srtr(r ;t1tetnii3tysfm2em(msn()tlermfctadoptrlnvols s2tmimpiodam  liesl( s2ua(mpot0oetomfetyt sDrl(vp t0tltnircoodoptrai s;t setoim iy1omen iesls  Dtmxmpnt1alx io3tlsfmDuan snt)artrmr iotfaDranvol() 2uoxm iu1lmt lfetltf rurumont4opeo fcilsfa2emnmo (4aleoir3ootomtr uvsl()tetr(o3no4lm emneias srumu  ;t0tee  i3iltlm ra(mo u) exrmo oydoat lu o t0setoirpny1olt mnvtltfaDrmu o;t4oexo o3iys m2umu o u0 exnxr3tadfptrlnei;s)s2urir3oydll n ietat)aDraxrono0oleniocild s2ulumo t0tlenir oo1om e i s t)t2urxm3no1op n fcsas) rtaur ;t1opx ii3taslm2emnvo t4altrmr oadfa  livil(0srxo(r oo1olt mnvilt) Dta(r ot0openioeiyt s2eauvpn(0trenxo ty1fm  aies (0s2xmiopoo4lm  lneiat) Dumurono1tltnmi3tat aDum(vp u)tlxnmfcto1latelnei ( t2tmxrpiy1lpeelietat)aDurxm no1tltoiiciatfmDeaumo u0 renmr oy1fptelues;t  2urxr3io4apeemiei s s2tmu  no0altn o3iydlaDrln o ()trxrxf io1lp rai o ()t2um(o no4olenmiei (f 2tmxmo;u4aeenii3iyd a2ea(mp t)trxoxfcoy1lpt au i t)seum(m3iy4lpee netat)a2ta(m ;t4aetnmoeiydls emu o;t) etrio3iydlmt lu o;s0srtrxmpoy4lp   fes ( a2tr(m ;o0oeen oetldlsDumnvs t) exomo3iatlp ranvi ( teurxo3nodlpe  feiatf Dtmxmp;u0oetomfeiltla emnvo u4teenxf3tydfmD auvo;t) ruo(o ny4opeemnetlt artm(  nu4olxnifeiysfm rmnmp (4 leoxo iytomD ln sl(0 rxmio oydlmtnlfvi sfaDtmu o;t4alenmiciadla ul(vo;u0 exnmo oy1lm  auvol()s2xmir nu1lltn netl(f Dtmu pot0tptoiociydfaDel(vp;(0aetrir iodlmtran ilt0setoxo iu4alen fctlsfs2ta(rono1olxniictysla2emn p (0trenir3iytfp e u o (0 rxrxmpnodlmtnmiciatfa2trumo;o4aex mo3tls sDumuvs;u4arxrmfcoy1om  lneo (0 etm(o3io1alte ivias  Drr( o;t1tlenmi3iadls ulu onu0alxrmf iy1opt lneo;t0 eum(m ou4lp   iet (f ruaxrpno4texoio3tatfmDumnms;u)alenmr3tytlmt aneolt0trxr(m nu4oleelfesls sDtax onu0teenmi3iyt a rm( pnt4arxrxrcoy1lpD an i;()t2xoxr3iudolenlfcs sfaDumxmono0tleoif3iatfa emump u4alxomr3ia1oa  lu i s)s2urio3ny1omtnmivt s)a2umump;o4tex iieildfa rau pnu4artrif ootom r i s s)t2xrim oy1ap   fesl(fa2tmu pou0aexn ictysfm rm(vo u4areoxo3totomD  uei;()s2uoim3oudlp nlfctl() 2urum ;u4tpeniociasls2uauvonu0 exrirciatfa  lieo ()seumxmpnu4amtemiesltfartauronu4apt mf3iltlmDuln snu0 etrmr io1lpt lnvs t) etrio3io4om nmfeta(fs2tm(m ;u4texomoeiatfs emnvsn()alenxf iodopD lnvi ()s2uoxm3no4ap  mivi s s2rrxm ;u4oetnifetyslm2um(vsnt) renir3iy1latr n s;s0texrir3io4ape lnes tf rrau  ou4olen feiad s rmnmo;(0arxnif tydlmDr ivs;t t2xm(m ou4lpeemnvt s  2umx ont4tltnii3tad m umumo;(0artomo3tadfpDeanesls0sexr(r io4ole lfetl(  rtrxront1opx  o3iadlsDumumo t) etnxo tadoat aneilt)srum(o3oo1omtn ncias sDrmxmooo1tlx if3tls s umnmont0aetrir3ty1fp r nesl()s2tmio3iu4ome  fvt tfs2umxm ot0tetniociysfs2ran o t4tlxrircoatlpt luvo t0 2um(o3ny1omtemivil( sDtmu  ;t4oex io3tyt m2el(ms;u4aexrio3tytlatelueils  rur(opiydap   iet s  Duax oot0teto oetytlmDrm(vs t) renmrciotlateauvil(0s2um(opnu4alt  nvilt arrr( o;t0oeeoiociyd mDea( sn(4 exrir tatlaDeaneolt)t2to(mpiodap elnes sfsDrmu oou1oexo oeiasfaDuauvon() ltoio3iytfpDeanei t0trxmir3no4lpenmncta(  2um(mo;t1tpxn i3tyd a2rlumonu)tltoxrcoo1fate ivsl(0t2tm(r nudop nmnvia( a2ur(mpnt4tltomietytla ranmp;u)arxnir tydfpDean i t teumir nodole mfeslt aDtmxm ;u1tee ioeildfsDum(vs u4 renxf3io1laD anvs;()texr(o ou4optnmfes sfs2um(mono0altomieiltls ra( o t)alenirciatlmDe u il(0sexrxm iodlpee ieslsf 2uru  ;o1aeeomi3tltfaDeauvpnt)teenmr ootlp eauei ()tetrxrpnydlpe lnvtlsfsDumxmoot1oleoioctlt a2ul(vsnt0 exnxoctadlaDrlu il(0s2umim nudlmeemnviat)arua(rpno1altnifciaslaDra(vp t0areoxo3oo1op r ivo s)srtoxr oydolte icsl(fs2ra(rpot4oltniictldlsDulnmonu)artomo3ia1oaDr nvi ()s2xm(opnodapen ieslt  Drmu ooo4ape  feiydfm ulnvo;(0 reoxf oadlp  ai o (0trumim iodalenlnctltf Dta(mont0aptn fcilslm2uanms u)tltoxfciy1lpDrlu o ()s2urxmpoudlm emicia(fa2rrxrooo0tlxnmocilsfs elu p;u4 lxnmr to1omD ai ol(0 2xm(r oy4aptnlfctl()arrax onu1tptniieils a2ua(mp;(4alerio ootfaDrlies;t) rtm(r3ou4olte nvsl()aDuax  nu4tlenmiciatfaDrlu onu)aexnir tydoaDe n ol()t2xoxr3oydom elnct s)a2rr(rp;o4optn iciyd s elnvsnt4 rtoir tytlmtr i o s srto(o3nudapen nvi s  rrmxr ;o1optnmoeild m2ul( o;t) exnio3iodfa  lueils0trumio3oudolen ics ( sDtmxrooo4alxomo3iad m2rauvont4 etrifcio1fatr ivi s0srtrimpoy1oltemfvta(  rur( ono4tetomoeiyd m2umumpn(4trxnmf oy1op rlu s s) rxmxr oudamte ictatfarrrurpno1altn iciltfm2rlnmsn(4alxnir3totfaDrlu il(0 rur(r iy1lmenlfvt s) rtmxmpnt1opeo oeilt sDel( pnu0texoif tadfmt auvols0s2urxr3iodol e neiltfa2uaurp;o0optnmoeiltls raump;u0texrxf tatfpD  u il( t2xm(m oo4op elfvsas  rrm( p;u4tlto f3iys sDumnvpn() rtoxr tadfpD  uvs;s0setr(opiodaltemnetlsfs2ur(rp;o0alxnmietytfa2umnmsn(4 etnifcootoat  ues;t srtmimpno4opt lnet ( sDum( o;t1apx micias m ra( p (4 eenir3tytfp r nvs;( texo(r nodal elfcsls) 2rmumo;u0oexn i3tadlm2emuvonu4 exnmocta1opDe neols0 exoxmpoodllenlncs ()aDtaxmo;o0olxoioctld m2rl(vs;t4tetnxf oytfateaies;s trur(r3nu1llenmiet sf rtmxm nt1teeoioeiysfmDeanmp t0tltrioctytla rau ils sruoio3iy1lpe mfesltfarta(r nt1tetnif3iyd m2ean pnu4arermo ootfa eaiei;s0sexmirpoo1opt  icia()s2rrxroou4optnif3iydfmDumump;u4arxoircoodomDran il()trxmio no4op nlnvi ( s2trum ou1tle  iciytfaDranvsnt4 renmo io1laD  ieo;t)s2urio nu1al nlnciat a2rm( poo1teenifctatfa ean s u0tlerifciodfpD luesls0t2um(opny4olenmfcsa(faDra(r nt4oex  iciatfaDum(ms u4 exnifctytlmt ai s;s sexmxr3io1al emfci t)sDum(  ot1oetnmieiatfm2ulums t0 reomr oo1omD li o;t0trtrxm no1oltnlnvtlt)srtr(r nu4aexniietas sDem(vonu4tltrirctydoatelueolt  rxoxo3oodol e nesa()s2rm(mpot4alt mfciydfm ranvp t4tlxoir3oatopD ln ilt0t2xo(o oudlp   ieiltf rrru  ou4altniicilslm2uan o u)altrif io1fm  livsls  2xr(o3ou1optnlfetasfa2ra( ono1altn f3iat mDemnvs t4trxnir oytopD livs t  2xoxopoo4olenmnviat s2tr(mpnt1optnif3iadfsDelump;()tleomo3oodlp  lnvsls teum(o nu4ll   ivsatfs2rmx  oo4aexnioctaslm2rauvsn(4trerxfcty1laDean s (0 eurio nu4al nmnviat  rtm(rp;u1tlt mfciatfsDrau onu4artrio oytom   i s s srurir3oodal emfcta()arrm(mpou4texnmo3tltfmDem(mpn(4tlenir iydla r ivo (0s2umimpoodllenlnvi t  2uaxmoou4tlxniiciyslm rm(vs u)artnif3oydlptelnvi s)seurir iy1ol nlivs ()s2rm( p;t0oeeoifeiad m em( o;t4aeeomr io1fmDrauei s0srto(o oydomtelnctls)a2rr(rpot4tlx  ietlslsDuluvpn(0trenxrcoytlmt  ieols)s2xmxo3nydap e fvsl( a2raxm ot1tex iictadlmDra( o t4 eeoxo iatla e u o (0teur(r ou1apt  ieta(fartr(mpnt0ape iociyd a umn s;u) eeomf3ia1opDe u s s s2xr(o oo4ame  ivsas) 2urumpou4opx  f3tlt aDelu o;u)arxomf todfm r iei (0seurim3oo4lm elfvtl(fsDrmur ou4aleniietas s2el(mo;t)altnmfctadfm ranvo;s s2xrio ou4ol   nesas)aDururpou1opeoioctlsla2um(vs (0aexniocio1fpDeaiei;()t2umiopiodlle  nei (  2um(ronu0aex  oetatfa2ul( p;(0aetrxo oy1opt lnvs s tetrimpio1lle mies t a2raxront4oetnmfeiytfa rmnmo;(0arxrmr iy1lpDrlu o;t srumxm3oy4om n iesatf 2um(mpnt4oeeoifeilslm umu onu)tetnmr3iy1lpD  ivo (0t2ur(opnu4om e nvtat)sDum(rp;o1teeo ieilslm2el(vo;t)arxnxf oatlatrlnesls teum(rpoydamtnlicsl(f Duauroou4aeenmfctat mDeanmo;()tetomr oydlp  lies;() exoiopoudalenmfctltf rumxrono1alx  ietydlsDuluvp;u) exrir3tadfm  lu s;s) rtoxr iodam emnci s)srra(mpno4tex  feiyt m uauvont0trxrmrctatlp e u ol()s2tm(mpiodal n fvsls  rtr(mpno1opt  iciys a ulnvo () lenmo iytfm  lieo t0 rxoxopoo1am elivs t a2urx  nu1olenmfcildfm2emnvsn() ltrio oydopD  i o s) rto(rpou4oltnmfcs ( aDtrx  ;u4tetomoctasfm elnvp t0arerio iytfmDrauvolt teurxrpio1am n fetasfa2tmxmoou4oleomoeiltlm ulnvs u4alxomr oytomt lnvo t s2xrir3iy4lm e nvil()srta(mpoo1tpen feilsla2raums;t)aexrircoa1oa r i s t0t2ur(m3nydol e ict (f Draxrooo0alt ioeilt a ra(vsn(4treoxrcoy1lmDe i o;t) euriopoydomtnmncias)srtrx  nu4tpto octlt m ean snu) lxomoctydoatr iei s0t2umxo oodal n iesas srtrxmono0apt  ictlsfsDumnvo u0 lxrxocoo1fa eanesl()seum(m iu4lmtn iet ()sDtmum no4aeeniicildfm2ua(vonu0altrxf tatlate nvi s s2tmio nu1llte iciat s2uaur ;t1oex  f3iatfa2raumo ()teermrciodopte ivs;t)sruo(r3io1ame  ics t)s2urx pou4tpt ifciyslsDrmn s u)trxomr oo1lp  luei t  exo(o nu1am nmivtlsf ruaxrpot0alxnmfeiydls umnvont0treoxoctydlmD aneslt s2xm(m3ny4ameemfctls srumuro;o1alt mfciltls2uanms (0trxrif to1oatelnvils)s2tmxo3ou1om nlncslt) Dtrxr nt0oexnmi3tysfa umnmp u0tetoircta1omte n ils0 2xoiopnodamtnmfvil() Dumx pno1oeeomoetyd s ea(ms;u0arerif tydfp r ivilt0trxmxr iudllenmfvslsfsDrrxronu1alt  ietlsfm2uluvonu)trtomr3oy1la raueo t0 etmio oodamenlnctat  Duru ont4aeen ieiadla rl(vsnu0trermrcty1lpDrauvo;s t2xr(m3oo1op nmfei () rtru ont0teeomoctldfm rlu ont4arxrxr3iadoaDe ieo (0 exmxm oodapenmnciatfa2rrxrpou4aexo f3iys aDeauvsn(0arerxo ia1lmD ln ol()s2xmim iydal n ivt ()srrr(rpot0apt  iciydfm2uauvpnt0trtnif3iydomtrlnvo t)srtm(o oy4olee ictat a2raxmoou0tetn ieiytls eau o t)tlxrir3tatoaDraivi ( s2tmxo3iu1lmt mfvi (f Dtaxmo;t0altnmi3ildlaDrmn p (0 rtomf oodoa r neo;( texrirpoy1amen nes t sDuaxmo;t4tpen f3tydlm2elnmp t4treomr3ootomDraivslt) 2um(m3ou1aptnmfcsas)s2urur oo0opx  ieiydfs2eanvp;u0tlenmr3iadfp  luvo s srxoio oydope mfviat)s2tau pnt1tleoiietltfm2rmumpnt)artoxr tytopt  nei t0t2tr(mpnu1lltelivil()arraxro;u0olx  f3tlslm ul(msnu)alxoio3to1om  ln o s0s2urio iy4apt  iesl(fa2rm( ont0aetnmoeiyt m2umumsn(0arxnxf tytlp rlneils)trumxopnudamenlicia(f 2tmxm ;t1tle iociysls rm(monu4 exrmrciatfmt ai slt)t2umir iodomtelivtlt aDtm(m ;t0oet  i3iysla2elnms;u0tlxoir3iadlm eau il( t2toimpoydol n nvtl()a2umxmpnt4optniociadfm2ul(mpnt0trxomo3ia1fmtelnes s)teurxo3iy1lm  micsl(  Duaurp;o4alen fetytlsDrl( p;(4 rxnmocty1laDrln sls0truoim ny4llenmiciat s2truroot1aet mo3tasfm2ra(mo;u)tltrxocta1laDelivi;s0s2umio3nu4lmeelfet s) 2rr(m ot1ope ioeils m2eluvs ()tlenmocta1fmD ln i ( trumirpnodomte icia()a2ua(rono4tetnmoeiytlaDrln p;t4 etrmr tytom elivo t) etm(r ou4amt lfetlsfarum(mont0oexnmfeiyt m emn p ()arenir3oytoaDraivil( trurxr nudopenlfei t srrmxmpou1oee  o3tytlsDrmn p u4altnxo3oo1lmD lnvs s)s2xoimpoudome mici tfa2ta(m no0ole  iciltls em(vs;u0 ltrmrcoy1omtrlnei (  eum(mpoydlm nlncslt a2ur(rp;t0texomoctat m emn o t0aexrmf oatop eluvi (0tetoirpiu4alt lics (  2uru o;o4alen icils m rm(mo;u)altrir ta1oa eluvil(0tetrimpnodlp  mnesl() Dtauronu0aptnioeiys aDrmuvs u)tetrxrcta1fmDeaiei s)truoxr3iy4ame lncsasf Dtm(mo;t0aexoii3tadfa2emn s u) lxrxf iatoatelieo s0t2uoxr3io4ame lfvtl( srrm(mpot1tee ioetlsla emumo ()tlxnirciydopt livols  ruoir3no4lmtnmnes s a2ra(rpoo0tex  f3iytfs2el( s;t0 ltomf iydoatr ivilt trxoxmpio1op nlici t s2taumonu4tpx  ieias a2rau o (4texomf3oa1fateanvi (  rumxr3io4ap  mfeil(fsrur(ront1oex mf3ildfa ulu o;t0aleoif iatfm rln ils t2xrim ny1lmee ncil(farra(root4texnmf3tlsls2ua(vo;(0 leoxrcta1op  lu o s0srxo(opnodlltemnes sfaDrmxmpnu1optnmo3iad aDumuvo;(0aexoxo oytla eaies;s tetoim no4ll nlivtls)a2ta(  ;u4tpx ifciysfm2emnvo;(0 rtomr3oo1oate ies ()truoim3nydllee ncta(  Dta(mp;t0ape ioeiasla2emumpnu4tlerxfcto1fmD au sls0 2trxmpiydamt mncsas) Dta(rpot0alt mfcild m ea( o t0 exrif oo1fmDr nes s)s2xo(rpiy1ope lncils arrrur ;u1tptn f3tasfs rm(vs u)alxrio3oydfpDr u olt0texoim3iydal e nvtas  2tru o;o4tptnmieias mDuaumpnt)areoxocoy1oaDelueo;( tetrio oudome lfvtls  rrax  ou1opxo fcildls2rl( o;u)texrmocootoa e neo;s0 2urxrpiu1optnlfeiat aDra(r ;u4aet ioetldlm2ul(vp (0texoxr3oatfm rauei;s) rumio iy1oltnmncils) 2uaump;u1apt ifciysfa uaumsnt0trenxo3iodfaD lu o t)trtr(m3iu4apte fesas aDua(m nu4oetnio3iyt aDemnvpn(4trtoifcoydla   u il()setr(o3oydomeelics sfsrua(  no1oexo ociad s ra(vo;()trenifciytfmD au i s0t2uoirpio4apen fvsas)s2taur no0ape  icias sDulu pn()trtnir3to1fatrai s t srxrxr oy1alte fei t aDrmu oot4aptomoetytfsDulumo (0aexnir oo1latelnvsl(0t2tm(m3io4lmtnmieiatf rtax  ;t1tle mo3tldfa2um(vs;u0tetrir3ootlatr ueslt s2trir iy1ll   neta(f rum(moot1tlt ioeilsfsDrm(vs;u0treoifctadfa r nvs;s)seumio iy1optn nvia( s2ur(  ;t1tlt  f3iydla2el(vp t4 rxrmr3totfa eluvs (  2uoimpny1am nmnctl(  rrm(ro;u0oltnifciyslm um(vsnt) etrircoa1fmD aivs;( t2xoxo nudamee ivils arta(r ;o0texomo3iasfs emn onu4tltoirciatoa eanvi t tetrxrpoo1lme lfvias s2tr( oou0tee  iciydls2ul( pnu0 rtnir oatoaD  ies (0sruo(r iudap nlncilt a2rm(m ;o0tlt mfetldfmDean pnt4 renmr3iadlptrluei;(  eurxrpoodaltn nci t arumxr ou1olxoifciasfm2eauvsnu4trenxf oa1lat  ivs s)sruoir nodapeelfct t  2uaurono1openmfeild s rl(ms t0 rermrctatfpD lu o;()t2xrir oodome  nvil()srta(mont1alx ioeiat a umnms t4 exnif iy1lmtran sl(0seuoirpou1omte icils  rur(  ou0alx  i3tydfsDuluvs;t0trtnircoadoat lueils  2tm(rpnydope lict s sDrr(m ;u1teto icias s2ean p;u4arxnmfcoadfpDelueil(  2tr(o iy4al n fvtlsf Durxrono4altomfciyt s2emums;u0aexoxo3todfpDe nvi t  etrxr3no4amenliet sfaDtax  oo0tpx micilt aDemu o t) etnmo ia1lmtran ols0 2urxmpoydamenlivi (farra(rono0tltnmi3tasfaDelums t4tleoio oytfat livo s  rur(opoudll n nvsat)a2ra(rpno4olenmfetat a emn pnu4teerifcoa1om  anei;t  2uoio3iy1lp e nctl(farrmu  ot0tlt  oeiltfa em(mp;t0 lxrmr3tytomt ln slt0setrxrpoo4ome livtlt artrxrpou1apt mi3tltfaDrl(ms (4 rtnxr3iadom rlnvs t) exr(m3iodom  lnetlt  2ua(mpnt0apenmf3ils m2elumo;t0 ltnxf3tytlaDe u slt)seurxmpou1lmeelfvi sfa2rmx onu0aee  icils s rauvs t4aexriociy1la elu i t truoxmpiy1aptemicias sDrmx  ;u0tlenmoctltls rluvsnt) eermf oydlpte i s;s0 2xoxrpiy1aptemivsl()artmu ono4opeomociyslm eanvp;u)tlerxo oadfmte ueo s  rtrxo nydomee ivsl(fa2tmxmpnu4oltniieild aDrau o;() lxrif3tatlptr i o;s t2um(r3ou4optnmfesl()aDrmur ou4tex iieiad mDum(vs t0 lxrxrcio1lmtrluvo;t seum(r oudamtn icsa( s2tr(r nt1ape  fciltls ea(vs t4tlenirciytoptr u o ()teum(opnydopee ivslt  Dua(rp;o1tlt ifctld aDrauvs t)trtoxf3tadlptr ueslt0 rto(o ny1ome  fvsat srraxm no4apt  oeias mDran p;u4tlenio ta1lpDraivo ( s2um(mpiu4lp e icia(f Dtrxm nu4texoifeildfm2ulnmsnt0 leoxo3iytfaDrli s t)teumxo3iy4ame lictasfaDtrxrp;t0alxomi3iadlm2ra(mp u4altoio3ia1lat aneo;t0texoxo3ny1ole  fcil( a2urxr nt0tpen f3iadfs umnvsnt) ltrmo iy1fat aues t  2xrxo oudoltelici (  rum(mont4aleo fetat s emn snu) etnmo3oytfp raieo;t truo(o3nodame  ivtlt) 2tmu onu0aetomoetatlm2emnmo;(4arermrciotfpD  nvi s0 rum(opnu4ap eliesl( aDtm(rooo4texomfciysfs2elnvs t4aeenmr3to1oatranvol(0srxrxr iydlpee ivtasfsrtau  oo1altomfeiyd s2uanms;()altomr3oo1lp r u o s0tetm(r3iy1amte neiat aDuaumonu4texo o3ilsls2rl(mp (0 rtrio3oo1op r n ilt) rurxopnodamtnlfvslt)s2tmu p;u0tpxo o3tas aDumnmo;()aleomf ta1optr nvilt0trurir3no1apt  ieiatf 2taxm nt1texo ieiadlm uanmp u) rxriocoa1op elieslt  rtm(o3iu1opee iei () rurxmo;t0tle mfciydls2rm( pnt0 exrmf3todfa rlnvs ( texo(rpoy1al  lfcsltfaDrr(mpno0tetniieiydls uanvs t4altoio3iydfm  livi (0 rtm(opio4amtn fetlsfarrrx oou0apxo ieildlm2eanvo;u4trxrxf oodopD ln olt setmxr3ou1ol  mneia(fsrrau o;o4tpe  o3tatls ulumo ()trtrir todfpD lu o (0 rtoxmpoy1aleelfci ()aDuax p;t4olxo o3iaslmDrm( p (4 lenxo3todfp e nvolt0sexoim ou1lmtemnctl(f Drr(r nt1aleoiiciyd a2uanvonu)trxomfctatfpD aivi;s0 rumio3iy1aptnlncs s aDtrum nt4tetnifctat s2ra( pn(4tetomrcoa1fmDe nes t)sruoxm3nu4amtnmfeia(farrmu ooo0olenmieiad sDeauvpn(4tetoxf3ty1fm eaueo t0setrxo iydoltnmnctls)s2rmx  ;o1tpenmoeiytla2elnmp t4 rtnxf iodom eln o;( t2xr(r nudamtnlfvtas)srrrxmo;o1oeen ieias mDraumo;t4trenif3tydfa  au i t)teurxmpny1lme lncta( artr(mp;u4oeeo f3iytfm ra(msn(0altnxf3iatlp  lu s;(0trumio3iy1am nmfctltfaDurxm no1oexoifciasfa2uau snu)tlenxo todlmt lneilt0 2xm(m3iu4op nlfetl()s2ua(rpno4oex  fetat a rmnms;t4tlenmo oo1fatr u o t) 2tm(m nydam nlicsas)sruau  ;o1opx ioetlt mDuan s (4aeenmo3iytfp elues;s s2xrio3iu4lpt lncs t)aDtm(rooo0tptnmoetat a2rmn pnt0alerif tytomteluvo s trto(mpno4amtelnvsa(f rrr(monu1apt mieiyslm rln onu)aexrmf iodfp r ueslt0 rurxmpiydap e fvtlt)aDtrxmpoo0oet  fctatfa ra(mp;u)artnmo3oa1omDrlies;s0trtrxm iydalt micsls a2taumoot4tlto ociyt m2eauvs;()tlxnxf iodomDeluvs;s0s2xmir3nu4alt  fvslt)a2rm(root1tpx mf3iys s uanmo t4 lxrxociadop rlnvslt t2xo(mpio4om e ncs s) 2uaxmono1tltnmictatfm ulnvs (4aexoif tadlat  uvsl( trxoio iu1al nmncs (faruauront4tex mfciytfs rlnvp t4 exrxo3iadla e nei (0s2xr(m ou1lm   iesat) Dtr(ront1tpxnmoeilsfs2eluvp t) lxnioctadlaDean s () eurxo3nu4ol  lncs t) rrruro;o1apenio3tas mDeaums;t4alermfcio1laD lieo s  exoxopou1opt lnvia()sDuaxm oo0tee ioeilt s rmumont)aeeomo ta1opDrlu o s  eur(o3ny4lme liesls)a2tru  ou4teto f3ildfaDrmuvpn(4 lenxf3iodlp   nvo;t)t2toim io1apt  fvs ( artr(  nt0teeomoetydlmDrln o u) exrxo3todlaD luvsls  2toxr3iydam emivt ( sDtrumo;u0tlxomieiydlaDemnms;u0aetoxf3tatfptrlues;(0t2tmxmpou4altnmnesas  2rrurpnu0olxnmo3iyslm ea(vpnu4altriociydfmDe u s t)tetm(mpiy4lpt mnei sfs2tmu  ou1tlx mo3iadfs2rluvp;u) rxomr3iydfmD aneo t s2toim iodaptnlneta() rtmurpou0texn o3ildfs ulnmo;t0aeermo3iytfa r ivol(0 rurxr nodomeemietl(faDtmxmooo4ape ioetltfs emump;t0aexoir ty1fpteln i ( s2urio3oy1lptn ivi s)s2rru  ;u0aeeo f3iltfaDemu s ()alenmf oatfpDr u s t  eumim3io1apenlicslsfsrrruro;u1aex ioetls aDul(mo t)treoxf3oydomD aivo s0tetr(o nu4lptnmivsas)s2tm(r oo1apxn o3tltfs2em(vo;t4trxrxo3iotfaDr i s;s)srtrir3oydolt livi t aDrru pnt0alxoif3tas s ua( s;t0 exrio3iodfpDe u i (  2trxr3ou4lme livtat srtaur nu4oetnmociysfsDrl(ms;()arxrio3iy1lptran ols teuo(mpiy4lm n ivs ( sDrmx poo0tlx mfctatlm2ea(vont4 lerircoadfat lnvols)teurirpny1al nmiesas srrm(m nt1teeo ociysfaDea( s;t) etnxrctydoaDrlnvi;s0 etr(mpoudlpe  fvi ( arta(m ;o1teeo f3iasls2raump;u)trtnircoatlmDeliei;s0seuoim3oy1lp elivta(f 2rm(mo;t4oleomo3iydls2em(vpn()trerxrctadomDr u o t truo(m3ny1lm emivi t)arrrx o;t1aeeoiictlt m2ua(vs u0altoifciotomte i o;t0 etm(o3oodaptemnvi s sDrm(moot0olto fetlslaDemn o;u)altrir3todfpDeanvs;(  exoirpnudame lnci () rtmx  ;u4oee mietydlsDuanmp () leoiocoy1fpDr neslt  exmxo iy1om nmfctatfaDtm( pot4aeen oeiysfmDra( o u4tetnio3iydlm e nvilt) etrxr3no4ale lfetlsfsrtr(  ou1oetn feiasfs2emu pn(0 leomf tadfaDeli i;t sexrim3oydapeemfvtls)sDumxr ou1tetoiociysfm ea(vo ()alerxfcty1om r nvsls)teuoio nu1amt mivslt)aruau o;o1tetn ieiys mDrlumo;(0aetrmo iatlp  aivs;()t2xrxrpoodap elnvsa()sDurx pot4teenmi3ias mDulu p t4teerxf3iy1lmt  iei;t s2tmio3iodamtnlivtatfarta(rono1oexn o3iadfsDra(mp ()trxnir iotoptrlu o (0texriopoydaleemnvil(fsrraur ;u1tex mfciyslaDelnmo;(0arerxr3tatfmte uvs;s0srxo(o iu4openlnvt ( a2rru ont1oltnmo3iaslmDraumo;u)alenif3oo1lpte n ols)seuo(rpiu1al emnvslsf Drr(ro;t1open iciltfmDrmnvs;u4 lenio iytlpDe ieo (0srumxr3iu4ameeliesa(fs2umumpoo4aet mi3iys aDum(ms;t) reomfciy1fmt  nvo;()t2xo(m3ny4lpe mnvilt) Drax pot0tptnioeildlaDumuvo (4 rtnmr tadop eaneo;s)s2xr(opiu4am n fetatf 2rrxmpot0texoioetat s2umnmsnt0tleomr3tydfa  aivo;(  rtriopou1lptnmfvsa( sDraumono0alt mfcias mDran o u)teerirciadfm   neolt0 etoir oudlmtnmnvi (  2raxmpnt1tlx ioctyt m eauvs u)altrifciodfpDe i ilt0 exoio oy4lm n icsat a2umx pnt0oleo ietltls2ra(vpnt)aetrxociatla eln o t trur(opiydll nmnvil()s2trxrooo0oee mietltla um(vo;(0tetoio3tytom eai o;s0 rxo(mpiu4oltnmfvt ()srururo;t0tpt mictatfmDuau s t)trtnmf tadlatr uvo ()seto(o oo1llt mici ( s2uaxrpoo4opt  fciasla umnvsnu4 lxrxr iotfa rluvi t trtrir nudalenlnet t  2urxm ou1tee miciltlmDel(mo;(4trxomf tatfa  lneo;s0trxmimpnu1op  mict s)s2umxmpno0alxomoeilsfaDrlums (0teerio oytoptraneils  rxm(o iudll elfes (f rrm(mp;o0apt  ictat m rmn o (0treomrcoydoptrln s s  2uo(r3oy1lp emfcia(  rtm( o;t0texo icild a ea( s;u0 etnxr3totfaDrlu il( teuoxm nudole lneils)a2tax p;t0alt ioeiysfa2umn o u4altomo oa1faDeluei s trumxo ou4ap  lfcias  2um(r ;t1altnif3iad mDrmnmp t) exomo3iatfp r n o t  rtmirpoo1am nmfvtasf rrmxmpno1oex mf3tltfs em(mo;u0 rtomfcty1oat  uvsls0 etr(o io4aptemieias) rtrx o;u0apenmf3iytfsDran s (4 rtrmfcty1la eli i;t  ruoxrpoo1ol nmfctlt  Durx pno1tlxoifciat s umums;t)arxomf to1fm rlneilt)srtrxrpiy1al emivi t)aDrrx onu4teeo f3tys sDrmnvo;(4trtoio3todoa e n ol(  2umir oy1ale lnciat) rururpou0oltnif3iys m rmuvp;u4 rtoxo3tatfpt aivs t) rxo(mpiodlm e fct ()aDtauro;o1alxomfciadla rmnmpn(0tetnir oadom raiesl( teumxopiudlp elivsatfs2tmump;o1tleo ociyd aDumumpnt4texoxf io1lm eanei;t0 rtrio nu1ll elicias sDur( pnu4alt ifeiydlm2eluvpnt4altrxfcoytomD aiei;s0srxr(opnudoleemfesa(fsDtmumpot0aexn oetltls2elnmo ()alxrxf3oodfmD li sls) 2toiopou1lmee fvils aDuaxro;t1apxn oetatla2ranvp;u4altomf iodoaDeau ols s2uoxrpiy1open fesls sDumu pou0aexo o3iatfs2emn ont4aexnif3oytlpDe n i ()srur(m3io1olen ies ()s2tm(rpoo0ole  ietytfm ul(vsn()altoifcia1laD  u o s  exoio3ny4al nlfvil( s2tmu pnt4ope  icild s2uaumon()arxrxociy1opteaueo s) exrxr3nu1ll emfcsl()aDtrxr ;t0aee mfctyslmDrlumpnt4alxrmocia1fpD  iei t0t2uoiopiy4lmee fet t)aDtaurpno1tltoiictlt m uau p;t) leriociodlateanes;s)srumio3io4ale lfvtatfs2tr( o;o1oee  ociatla emu snu0trenio iytop r uvslt0seumxr oy4am nmnvs sfsrurum ot1tetoii3ilt sDem(vp (0 lxoxf3oy1lmD  n ils)s2trio3nudape  ivi sfs2tau  nu1oexomoeild s2emnvonu4 etrxfcoytfp
\ No newline at end of file
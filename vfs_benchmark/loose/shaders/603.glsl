@@ -0,0 +1 @@
+ieolt) 2xmim3nydopee fei sf rrm(r ou1olxo ictysls2eauvs;()trtnif3ta1fmt li s s)trurimpoudlp elfeia( srra(ro;t4tee moetatfaDra( s ()aexoif3oadom  auvols0sexoim3iu1ll elictas  Dta(  ;o0tex mfciaslmDuln o (4tlxnxfctytlmDraueils0sexrxmpnudlptemnes t a2trxroot4apt  fciydlaDulnms (4aeermocto1lpDrln olt texrxr io4lpen nvtasfs2rmxmo;o4aeen ocias mDranvpnt) ltrxf io1fmD aneil( trtmio oy4ape  ietatfsrtmurpno1apxoif3iydla ea(ms;u4aeerif3ta1oatrlnvi t  rurxr iodapt lfvtasfa2ra(  oo1oet  ieiyt m eluvp;(0aeenxr ty1fa rai o;s)t2tr(r nu1lpte ietl(fs2rr(m ou4oet mfciydfmDul( pn(0 rxoiocty1fptr neo (0 2uoxr3nodllt micsat) Dumu o;t4alt  oeiytls rlnvs;()teerio tytfa eauvslt0tetrio io4oltelfctas) 2rru p;u4apxnmo3tld mDua( sn(0 ltrirctatfaDrlnei;s t2xmxr oydalte ictl( arrau oou4apeomfciyt mDean o;() rxriociadfmDrluesl()setoiopnudlmeemnei t)srrr( pnu4aex mo3ilsfa2umumo;t0 rtnxrciy1om  anvils0s2toxopno4lmtelivsasf rtmxrp;o0ape  ociytfm elnmo t0aetrmr oytopDrai s s0setmirpny4amtnmneias)sDrr( onu0alto octyd aDumuvo;(4tlxomociodlatrai sls) rurio iu4llenmnei t s2urxrpno1tpxoio3tadfm2raums;u0 reoxo oytlaD luvils tetmim iu4lle  ietl()aDtm(mo;o1opt mfetldfmDum(ms;()arxrmr3ty1laDr n s t setmxo3ou1olen neslt)a2trurono4tpxnmociydlm2eln pn(0 rxnmf3io1laD  ueilt) 2xo(r3oo4ol nmfci tf Draxm nu0alt mictadfs2rlu s (4 ltomf oodom raueo (0texmir3iu1lltn fvta() rtmumpnt0oleo fctysfm2el( pnt0 rtrmfcty1lmtrlu o;t) rtrxmpiy1lpt  ietlt)arrau oou1oeto oeils m2eauvo u0tlxnmo iytfp elueol( s2urxmpny4opt lieils arrrurp;o1tpxnmo3iatfs2elnvp u0trxoxfctatom  aues;(0trur(o oy1op  mivs sf Drmumo;o4aeeo iciltla emuvp;u0aetniocoy1oa  aivo t trumirpiy4ame mivtlsfaDumx pou4tpx miciytfm2rauvp ()tlxoifctadfpDr ivi t0 rumimpnodamee nvsasf 2urxm ;t4oeto oeiyt aDemu s;u0aetrmf3iy1om r uvi;( sexoir iu1lmenmivsa()s2tru  nt0ope  fetadlaDeaums;u0alxnir iy1opDr ueol( teuriopiu1lme mfvtat  2umum ot0tlt mfciytfm rauvpnu4tlxoxr3tydlmDelu ol(0srtoio3nu1lpeemnvs s) rtaum no0oleoifcilsla ul(vsnu4tetnmo oodlmte iei;t0 etoio3oo1omt mnet tf 2rru onu4aet moctyd a2um(vsnu) rxrio iotlmtrln o;s)sexrirpno1amtn ncilt a2rmuro;o4tpenifeiyslm2rluvo u)tltnxf oytomt  uvi;s seum(rpnu1amt lncta( artm(mpnt1apt mi3iadlm2um(mp;u)arxoxf oa1omDeaueo s texr(m3io4lmt  neiat  Durxm no0apxoifetysls uluvo t)areomfcoytoaDe neol(0 rtoxo3oy4lpeemfei sfa2umxmp;t1apxnif3iyd s2uanvs (4texrmrctytfaD auvs s tetmxrpiu4omtnmfvs t  Dtaurp;t0tpto ociydlsDel(mo (4teerxfcta1lm eanvs;s)teto(r3iu4om  mfvi t)aDtmurpnu0aexnmfeiasfs umnvs;u4 exoxf3tatlpDe u ols  rtrxrpny4aptnlietlt) Drr(ro;u0tpe iieildlsDra( s t4 rtnmr3oytfpte nvo s)srurxm3nodom nlfcs sf rurxr no0opx  o3tltfsDuanmp;t) etnmo iytlat anes;s)seto(r no1op   ietl(faDrm(rpot4tlto fetysla2em(mp;(0aeenxfcto1omD  n ils0 rxoxo3nu1apteliesas) rrrumpno1tpxomocildfa ulnmsnu0alxnxrcia1lmtrlnvil()s2uo(m3iudale lnei t sDuru  no4aleoioeiad aDelu pn() lxnmrciadla  anvi;(0 eto(rpiy4apenlnetls s2raur nt1tpeomoeiadlm2emnmp t4alxnmf iydoptr nvo t0s2xoxr iudolt micsls)aDrmum ;u4ope  feiys m2elu pnt)artomr iatfa  lnvslt0 rxmio oy1ole lietas) ruax  oo4ale  o3tysls2ean s (0tetnxoctodfp  ln i;( t2urir3nu4opte fctls  Drm(mo;t4opxoifciat sDel(msnt4teerir3ty1omt aiei;( srtm(o3iy4alt  icsas  2tmxmpnu1aetnmf3tadls ra(vs (0artrioctadfpD  ies s0 rum(r3iy4lle lfet ()sDumuroou4tex  fcildfaDranvo () etnxf3totfa rlnvi;s)s2toxo3iydlmtelnviasf rumu  ;o4ale  fciltla rlnvo t0 rtnmocoo1om elnvo ()teurxrpiodll nlfesat)artrxrpnu1tptnmf3iysfm2umu onu4tlerxo io1fpDrlieo;()trxrio no4alee feta(fsDumxmpnu4texo feiysla umuvpn(0 lxrmrcootoa eaieo t0 etoxrpoy4opeelfcs ( s2rrxmp;t0alxo feiytfaDuauvo;t) eeoir ta1fm rln i s0trtr(o3nydome  iet (fsDurumoou4opto feiydlsDrmums;t0aexnmr iatom elueolt0srtoxm no1lm nlfvta(faDrmuro;t4alx ioetasfmDulumo;t0altnxr iodlaD lneo;( tetoxo iu1olte fesls srtmum ou0tpen ieiat s2rauvo;u0trtoir3io1latrluei;(0sexmir ny1optnlfctl(fartrx poo0teenmf3tyt s2umuvsnt)trerxo3todfp r uvol()srxrimpiudop nlfet () rrr(rpno0teeomfeiat mDea(vs;t) exrir3iy1lmD ln s s t2toxo3oy4lpeemfcs tfsDumx p;o0oetnmi3iys a2elnmp;(0tlxomr ta1lmte ivsls) etm(m nudol n neiat) Dumurpnu0open fciydfs2ua( pnu)arxrxr3oy1opt  ieilt0srumxr oudam e nvi (f Drrx ooo4apt  i3tatfa ra(mon(4tlxnio ty1oaDe u ilt0s2um(opoodop emfci s) 2rm(moou0tleo i3iadlaDemumpn(4 exoxrcoatfmtran i;s0 etmir iodopeelncils)a2rru o;u1texomfctyd a eauvpn(0 exnmo3ta1laDe n slt) ruoir iy1amt  ivtlt)sDur(mooo4texnmfetaslm ra( sn()areoifcoatfateaneols) exriopnu1al emivsl()s2tr(mono4tleomicilt aDrl(vont)arerif3iotom r n i;s)tetrxm3iudole mncsat)a2ra(rpot0tle  icils m2uln s ()aleriocio1oaDranvi s)s2xr(opoydlpt  ictltfsrurxr ou4olx  oeiltlaDraump;u4arerxfcoy1fmDelu i;( s2tm(o oo4omte ivs (fs2tmx  ;t4alen feiadfs ra(vp;u)alenxr3iatlatrli sl(  2tmxopiy4lpe lncil(  rtmu pot1opt  o3iysfa2rlnmp;u0artnifcoa1opD  nei;()trxmir iudllenlivs ()aDta( o;o0tlx mfciytls eaums;(0 etrir todfmD an i t)srxoxr no1lp emnetas s2tmurp;t1aee moctad aDeau snt4 exnxo oa1lat lieo (  rxrxo3io1lp nmfeta(  rurxr ;o4tee  o3ias m raump u4treoioctytoa  ln il(0 rxr(m3io1optnmncsls  2uau  nt4aleomfciad aDul(ms;(0tlxrxociodoate uvol()srtm(o no4om nmivias)aDtrxrpnt4tlxnio3tysfs2rmuvp ()texnxf iadlpDeaieilt)s2xmxrpou4alt  ivil(fs2umu  ;t0texnio3ilt mDrmn on(0altnmo tatop r u o;( srxmxm3iu4amee ictat  Dtmx p;o4opxo iciat mDuanvs;t) etnxo3tadlp elnvi;s)t2xoxm io4ome lnvilt) 2uaum ;u4apen fcild sDeaums;t0alxrxf tydfp r nes s0teto(mpno4alenmies (f rumxmpoo4tpeomo3iatfa rmuvsnu4aexoif to1opDe neolt0 ruoxmpnu4amen ici s srur(root4tlxnioctlsfm2um(vs t0aleoio3tytfa  auvo;() rurir no4ol nlivtlt)srur(mpnt1tpxn feiys m2eanmo u4aeeoio3iatfpDelnvols)srumxo nydlptn netas srum(m nu4oet ifciysla elnvpn(4 lxrmr3oy1fp  aueilt0sexo(rpiy1lltemfet () Dumx  ot4alx micils m el( p t0 etnxr tydlaDeanes;()srtr(m3iodll  miesls a2rmuro;t0oltoif3iat sDea( p;t4alerio3iotlm r uvo;s teurim iodoptemfeta()srrr(rpno0tpt if3tad m emump;u)tltoio ty1fateau il( t2xmim3no4omee icsa( arrmxm ot0opx miciytla rl(vo;(0trxnxf3oo1oa e ieo ( seur(r3iy1apenmnctat)a2rm(mpno4opxomfciysfs um( o;(4texrir iydomDeln o;t) 2toir iu1lp elivi ( a2rm(rooo4alto fetyt m em(vp t) renmo3ia1op eaiesl( srtrxrpoy1lltemfvsltfs2taxr nu4tlxniociltlsDeluvo;u0areoir3iy1omteau slt)tetrim3nydll emieta(f 2ta( oot4tpe  feiytfa uau p;u)trerxr oytopte ivsl() 2tr(r nudomt  icil(f Dtr(rp;o1altomf3ildlm2rluvs;t4teenmr iodlat auesls0 euoimpiudam e nctls)aDraxrpou1aeen f3ilsfsDelnmp;(4 exrxr totlp   nvol()t2tm(r nudol e nes ( s2um(moot1opxomoeiysla emu o t4 ltrmocia1fmt  u s;s tetmxopno1ll emicsat a2trxmo;o1texnmi3ildfaDua( p (4tetniocoo1lmt anesl(0 exrxr iu4lmte fesat)artmxmont1apxoio3ild m uaump;t)aeenxf3oatfmt  ivols0sexr(r nudlltnmicia()arra(m oo4tetomoeiydfa umump u) reoxf3iy1lpDe n i;s)t2xmxmpno1llen ncias) rur(mpnu1oleomfeiat a ean snt4tetrifcoa1latrluvs () rto(o3oo4oleelfvi t) rraxroot0ale miciydfmDeluvo;t0 etomr3to1lp  livo;s s2tm(r iodol nmfvslt arurum ;u0tpxnioetatfa em(ms;t0altrxf totfa  aies;s) 2uo(m3oo1omtnlivt s)srra( pot0aet iieiytfs eau s ()arxnxo iodfaD luvi;s0 2tmir3ny4ale lfcta(faDumxmonu1ale ioetld mDea( pnu)alxrmfciytlmtelnvo;(0trxoir3iu4lltnmfcil()s2rmur ou1apeoifcild m2ea(vpnt)alxnxfciadlmtr nvs s  eumxo no1lp e ivsl(  Dua(rpno4oleomicias a2rmu pn() lxomr3ta1fpDrli s;() exr(r3ou4lpt lfcias s2rau pnt0altn fciysla umuvpnt4 ltrir oydlpD luei (0seumxm oy1op nmfciat) rumx o;o4olt mi3iad mDea(mo;t)aexoxf3ia1oaDr uei s)t2xo(r iu1amtnlfvsa()aDua( p;t4oeeo octltfs uanvp u0alxoxr oadoaDrauvo t)tetrxmpoodap nlnvs sfaruru poo1ope mf3iasfm2ran p u4aeeoiocta1lpD  i i t0tetrio3no1alenlnvsa(f rrmxr ;o4tex mfeiltla2emuvp (4trenifciodlaD  ivi;( s2umxm3io4om elfeil( s2trx pnu0olen i3tlt m ea(vsnt0arxnxociotfpDr u i s0seuoxr3ou1lmtn fctasfs2rm(r nu1tlx moeiytlm2rmuvs;t0trxomf iy1fm e u o;s t2toxm iudolenmietl()aDurx onu1teto oeilt sDul(ms;()trtnmocootoaD au o ()seur(opiudamtemfcsat)a2tm
\ No newline at end of file
@@ -0,0 +1 @@
+nvslt)srtr(o3nu1lmen net (faruru o;u0tex  oeiatls ra(vs (4aexrmf3to1omD li s t0 exm(mpoy1apenmnvs tfarraxmpoo4texn o3ilt s2ean o (4teenio3oytlmDeluvs;t s2xoxopny4ll nlfesasf ruaum ;o4tet iiciytfm2um(vont0alermoctydopDr ivi s0srumim nodam nlnciat artaumooo0oetnifeils aDum(vo ()aeerxo3ty1lpte nvsls0s2to(o3iydom n fctas sDtaxroou0aexoio3iytlsDem(vp t0trerifcto1om e u i ()setm(mpoo1llen ict (f Dtr( o;o1apeo f3tldlm2umums;t4treoir3oytoateliei;s)srxmio3iu1lp elfctl(f 2taxr ;u1aexn o3tatlm2ul(mpnt4tetoir3ootom raneo;t0trumxr3oo1ale lfetas)srrrx onu0teen fciys m uanmont0texomr to1lpDelu s;t0s2tm(m3ny4aleemictl(f Drrurp;u1teenmfciytla2ea(ms;(0 ltnmr ootop e nei t  rtrxo3oy1lptelnvt ()s2tm(m nt1optoif3tyt sDua( pnu4altrxo ta1oat an o;t0s2xo(r3oydalt mivta(fa2urxmpnt4oee  ictadls2ul(vont)alenmf iodoaDeaieo s)tetoiopny4lltnlfvs s)a2uaur nu1aexoii3tldfa2rl(vo u)artrmr3oa1fm e nvi;t0trxmxm3ou4omeemiesls srrmurpno4ale  feiyslsDemuvpnu4 eeoif3iatopDraieslt0s2tr(rpoudopen ivt t  Drr(rp;t4oee ioeiyslaDuauvs;(4 rtoxr ty1lpDrln ol( trxmiopoy1om emnetat srtrur ;o0tetomf3iasfs2uanmpnu0 eerxf3oydfpDr uvi;s  euriopiy1openmnvt sfs2tmumo;t1olxniociyt mDeanvs;t0 lenircoytlpt liei ( trurir3iy1lm e nvslt)arta(m ;t0openif3iydfaDrm( s;(0aexoirctytlpDeauvsls)srxoio3iudome  feils) 2tr(mont1aeen fciyslm2em(mp t0 leoir3oytlmDeluei;( s2urxm oy4lpenlicil(fsrtru pnt1tlxo ieiasla2uln p;t0arxomfcoytoaDeai olt0 etmxo oudop nlfcil()a2tr( ont4opto ietld s2elnmsnt0 rerxo tadlmD lies ()seuo(opoo4opeelnesltfs2trum ;o4opxn o3tltfs2umuvsn(4tlxrmrcootopte u i;s)sexrxr3iy4llt miesa(faDta( p;u4olxnio3iydls2ul(vonu0alenxfctatlptrai il()s2umxo3nodaltnmiet sfartr(rp;u4olenmoeiadfsDemuvpn(0 reoif todom elu il(0 2trxm no1lle miviasf Duax poo1olt  ieiysfsDrm( o;t4artnio3tatfm raivs t)srxrimpio1ol nlfvsl()a2urxr no4aex iiciatlaDraumont4 exoif3tydopteauvols trxoxmpou4altelfvt t  2uru  nu1alen f3iltfsDrmumo (4artnxr ta1fm eaivils)setmiopno1am elfvtat)sDraxmpnu1tlenifciytfaDrlnvp u0alermr oytfaDe u s () 2to(r3oy4amt mfeil(f Duru oot1tpx ifciltls emu snt4arxoif tytlmDr neo;s)s2xmxmpoy1llte fetl()s2trumont0alxoioetat a rm(mpn()arenif oodom  an s t0srxoir3ny4lpe mivta( srrmumo;t4alxo icilt m2ranvsnu)tetrmocoodfpDe n o t srxoxrpou4lmte fctl(  2um( poo1tlx ifeiytlm rl( pnu4artomrcoo1lmDeluesls)t2xrxo3oydop nmicsltfa2rr(rono0apx  fciysfs eln p;(0 renmf oo1oatrlneo;()texrir io4opte fci t  rra(r oo0aexomi3ildlaDemn p t)texrxf3iodoa eluei;t0trumxmpno4lp n iesl()aDuax  ;t0tpxnifeiydfm rau p t4tetrmf oatoa ran sl( setrxmpnydlmt  iei sf 2rau ont4ope  oetat m raums u)tlenmrcoadfmDrli s s trtm(rpoo1optemneia(faDuaxrp;t0tleoio3ilsfs2elu on()areniociadlaDr neo;s0 2um(o3ny1opte fvt t) Drrum oo4oeeomi3iasla2eauvs t4 rermr3ta1lm   ueo t)srtoim3oydame mnei t s2rru  ou0opxnmoeildfmDua(mp u0arxriociotfa elnes () exo(mpoo4om  mnctls aDtmum ou0oex  i3tlsfs rmnmp;u)trtoxr iytlmDeanvs (  rxoxrpoudamee nvs ()srta(mono4aexoifciat m em(vsnt)trerifciodlpteaies;t0 exoir nudlmen iet s srtr( onu0oetomf3iyd sDulums;u0tltoxf oadom elivs t s2xrim3oydoltnlnet t) 2taxrpot4tptnio3iytls2uauvsnu0tetnmrctydoatrau sl(  etoir3oydlptnlneta(fs2trumoot4alenmfeiltfm2uaumo;t)tlxrxocoatoaDrlu slt0tetm(m3io4lleelictasfsDurxmoot4opx  oeildlm2rmnvo;(4texnmr oatfat  uvi s0 exr(r3nudom elivtlt)artr(  ;o0alx mfetltfmDelumsn() lxnxfcoatoaDelieo s0s2uo(o3io1llt livtas) 2umurp;t4oetoifeildlm2rm(vpnu0 etrif iatfm   nvo t sruo(m iu1lmt liet tf 2tm( p;u1tlxo oetydfaDuau sn(4tleoxf3io1faDelu o;s0texo(m3oo1llt  fei (f Drax o;t0apxnmfeiadlaDel(ms u)aetoxf tytlpt  i ils)srtrir io4ameelnes ( sruau  ;u0aetomfetadfm ranmsnt4 lxrxocto1fa eauei;t t2triopiudop nmfeslt s2trurooo4olx ioctad s2ulu p t) rxnioctatlpt  u o;(  eto(r oudllenlncs sfaDtmxr ot1opxn ociyd s2ea(vp (4 rxrmf to1lat aieolt  etmxm no4optelicta(fsDtmu oot4aeeoiictadfm um(msnu) ltnmo3tytlm eai i t) exoxr3iy4op  lneilt) Dtrxroou0teen fciat aDulu p;(0 rtnmr iydlpD  uei;t0texrim ny4apee iet sf Dtaxmpnt0tlx  fcilsfs emn p;u0 rtnxf3iatlmtelnvi s)sruoimpiu4amenlfesas  rumu  ;t0aptnmictatla2elumpn(4 lermo to1fp ran s;t0 2uoim3no4aleemfes () rrmx o;u0texomf3ilsfm ul(mpnu0 eenmo iadfm eauvo;s0sexrxmpoy1am nlivsa( arraurp;u1aexoioeiyd aDemn o;u0teerif3ia1lpDe nvs t trumxrpnudlp   neilt)srtau p;u1apeoioetltlsDuln pnt0 lxrir totlmD  iei ( s2xm(m3iodomenmfetl(  2um(moou0olto fetldfm umnvs u4artoif oodop rlu o t  2toim no1op nlietls)arur(rpnu1apt  i3tlsfs el(mon()texrmrciydoat  neo t0t2uoio3nu4lp  mnetl(fsDtmxrpnt4texomfciydfm em(ms;(0 exrmf ta1lm raneilt)teuo(r nu4altnmivt tfarrrxro;o4aeenmiciytfa2rmn sn(0trxrxo3to1fatran i t srtrim nu4om   ivias)a2umxmono4opt mf3tas m ul(ms () ltrxrcio1lm eau s;t)s2xr(mpoo1ll nmfctat srtmxmpnt0apeniietyd m2eln s;t4teeoxr3oa1fm  livo;( texoxrpio4opt lnci t s2tmxmpnt1oee mf3tldfaDrm(ms () lerxr to1oa eauei;(0sexoiopny4lp e nei t  ruax poo1oeto f3iysfa2eauvp;u0 leoxfcta1lmD aieils trtrim oo4lle mnvsl(  2umumont4oltnmo3iasla umn s (0 rxnmf3oytom raiesls0 rumxm iydalt lnctat)sDur(rp;o1tleo i3iatlm rmnvo u) etomfciotlm  aueo;s trurxmpnudole  fctlsfarurxront0olt iiciydfs el(vont4 etnxo3tydopt  uvo t  exr(opoudlptn fet sfarrm(  nt0teenifctltla2umnmonu0 lerxf oodlm elu o;s setrxr3oydol e nvtl( aDumxm ot0tltnio3iltlm2rl( o t4 exnxo3oadoaDeln olt0t2tmxm3ou4ameemfet tf Dumumpot1oexo i3iatla2ulnvpn(4 eenio3io1lmDeanvs;t0teuoxmpoudoptnmfvi tf 2tax ont1tex  ietldfm2ua(mo t)tltrif3ootop elueo ( t2xm(o iu1alee fcias srum(mo;u1ole  o3tatfm umu o;t) eeoxr to1fpt lu ilt)srxm(mpiy1ll   ivi tf Draum nt4aptoif3iytla rlu s u)tetrifcoatop  li i;t  rtoio3nodam  mictl()artaxr ;u4aleoiiciad mDemuvo t0 exomo ta1op eai o;s0 2to(r3iu1oleemiei t artrur ;u4oexnioeilsfsDrmuvpn(4trxoir3ootlpDrlu il(0srum(o oodomtn ivt ( s2taxro;t0alt moetlsfm2rmnvo t)alxoif tadlmtrlivi;t)trxmxr3iodoltelietat) Drr(ro;o1tetnifeild mDuanms u) lerxr ootlaDe i i;( trxrir3ny1lpen iet s arumurp;u4tpenifciad m2ra(vp () leoxf3oa1lpD lu s s0 eurxmpnydapen ietlt)srta(m nu0tlen i3iyslmDuauvp;t4trxrir ta1lpDrluvils0trxoxm nodaptnlicias  Dta(mpou1tlx moeils m umu s;(4artnmr3oytlp e nvs;t0 exoxo3nu4alen fcsls  ruax p;u0apeo fetad sDemn o (4texrmf3oodfm elueslt0teumxo oy4llenmfes t  Dumum ;u4texnmf3ilslsDelnmp;t0tetrxo3tatomDeanvi;t0teumxm iy4lme lncilsfa2rmu onu0tptoiieiltla2rauvo (4tlxoif3iatom eai i;s) etm(mpio4ol e ies t aDtr(r ou1aptomoetat a2ulnvo;(4alenmrciadomteaivsl()trxrxr io4aleeliesat sDta(rooo0aleo ociadlsDemnmpnt4artrxocoadop rln i;s)t2urxo3no1lmee fetlsfartaxmo;u1optn fctydfa2ranms;u0 ltoio totlat  n o (0 2xoxm3oo1omtnmfcilt srtau pno4opxo feildlm2ul( s;(4 rtnio3to1fmDelieil()trto(m3no4lm   neilt)sDua(mp;t4alt mociatfsDuanvpnt)tltrmocoytlpDr ieslt) rtrxopnudlpe lnet ()srtmu pno4aptomf3tldfmDrl( s;u)aeenxr3iadopDr i s s)srxm(m oo4apt lneias)aDtrxr ;o4aeto fctld s2emu s u)alxrmo3oydlmt au s (0tetmio oy4op  micta()a2rr( onu4tpeoiiciadfsDulnms;(4tltrio3oytla rluvo;s) 2tr(rpou1ll  lfct s arrr( o;u4teenmfctldlmDrmump;u4artrif oydla eluei s) 2xo(o3oo1aleelnvs tf 2ra(  ou0oleo i3ils s elnmont4 rxoxf to1oatean i;t) euoir oy4lle lnciat  2taxr ;o0tlx  oeiasls2emumonu0alxomfctytlatrauvs;(  rxmxr oudlme  fvsa()a2rruro;o4alxnmietadfaDuau ont0altrirctatoaD anei s) 2uo(o3iodllte iet (f rraxmoot0aexo i3ilsfa2umn p;u0aleomfctadopteanvsls trtoxr3ou1apeeliciat)srrax p;o4apxnifeild m ea(mo t0artnircto1fpDeaieo (0 2xrxrpno1ap  mieilt) 2ururpnu0olx ifeiyt m2rmnvpn(0 etoir ty1la  li s s0 2tr(o oy1alen ncsas)srrm(moou1oee ifeiyt a ra( pnt0 etoif ta1fmDeauei;t)srxmxo3nu1ol  lneias) Drr(  no0optoiieiasfsDul(mo;u0alxoxfcoa1omtrauvs;t0 2um(o iydop nmfvslsfa2trxroot0tptnmfetyd s2elu s;t0aetoxrcoatlmte u o t)t2xo(rpno1lle mivia(  Dra(mooo4alxoiietltla rm(vp;(0teenmr iytopt lneslt)trtoxopiu4om e neil()arum(rpot0aptnmictldlm ra( s;u0texrxo3totopteaieo;t s2tm(opoodllt lnvtas  2tmu pnu4apt mieiasls ea( p (0tltoxo oy1fatrln i ()truoir3iy1lmenmnesltfa2tmu  nu4olenifetasfsDrl( on()trenxr3oatom  anvilt0 eurxo3no4amtnmfetlt  2uax ooo4teen i3tlsls2emu o t) ltnmr tadfmtelnei ()t2tm(rpnodope  fetlsfs2uaum nt0alt ifeilt sDea( on(0trtnir3totfaDelies;t) exr(r iu1lpeemivs ( aDrau onu0tptoifciaslm2em(vs t4tlerxr3io1lm elivsls)s2tmxrpoo1ap   fes t) rraurooo1tpxnii3iadlm um( o;u4arenir iatlate u o s)t2uoxmpiudomt  nvtl( aDra(mpot4tetnif3iytfaDrmu pn(0artnxo3tadfmtr iei t  2umir ou4omt mneiatfsrumxrp;o0altnifciltls2ran p;(4 etoxo3ta1laDr nvi t) ruo(o3ny1alenmiviltf Dtr(ro;o1aet mfetldlaDeln o;(4alenxociotoateaies (0srtrir iydamt lnet s)aDua(r nu0aetoifciasla elnvs u0alxoiocta1fpD ai i s t2tmimpou4lm e nvsa(  rtmu  no4tpt  fciatfs2um(vo;t0trxoiocta1lpt livo;(0 rtoio nu4optn neta() Drmu ooo4opx iietyt m2uanvsnu)aeeoif oatlpDrlies;s s2urirpno1al  lfet s)arrrxmpou1aetoiieils m2ranmonu)arxrxo iytfat an s;t)setmxo nodamtn fvi s)sDraxrpno0apt iieias s rmu o t)alxoxfctytfmDr nei;()sexm(mpiydllt mnet (farrau pno0opt ifciasla2rluvpnt0 leoif3oy1la ran i;( t2tmxmpoo1lmtnlnvt (  rtmx ooo4tle  ictldfaDulumo (4 rtoxr iotfmte ivi s0 2xm(mpiu1ol n nes sf Dtaxr ou1tlx iietasfm emumpnu)texomo3oa1laDran i s0s2um(m nydol nmicslsf Dumx p;u0altnio3tydfsDrauvon(0artnxf ta1oa r n s;s0setrimpoydop  lnvslt aDum(rpou1opeoiiciysfm uanmonu4 ltnmfcoytop  luvsls)s2xr(mpou1opt  nes t srurxmpnt4aeeoifeiysfs2rl(ms;u4aeenmo tatom eaues ()tetoxm3nu4amen fvta( aDurur oo0aptoioctld m rm(vs;()teeoir tadom eaneolt) eurirpiu1ol nmiesa()srrm(ront4aee miciad a rauvon(0 ltrxo iadomD lu s;t0t2xr(rpio1ll  liesl()artmxr ;t4tet mo3iyt sDumu p;t0 leomr ty1oate nvi s) euoio3io1ap e fei s arurxroou1ole  f3tyslm ea(mo t0aetrif to1lmt aivols0trtoirpoudlm emfci s  rrmu pot1apt  f3tydfmDuau o;t4 rxnmfciadlm rli o (0 2ur(m3oo1omen ivt tfa2taxmp;o4olxnifeils a ranms t0alxnifcta1lpDelu s (0trxmxmpiudapeelfeia( aDtm( pnu1tetn fctad a2rl(mo t4alxnmr3tytfmt an ol()srtoxo3oy4alteliciat)sDurumo;t0openifciat sDrlu o ()aexrif3totomD au slt) 2tmxrpno4apen nesa() Dumumpot4tlt  ietatls2rmn snu)tlerxf ty1lmDeauei;()tetoiopiydlpt miesl(faDta( p;t4aeto ociadla rl(mp t0 rxrircoytla   i s t) euoxo no1omenmnesatf 2taxr ou0apxomiciad a2ranvsnt4 reomo iadlaD ln ols0setoir ny1lptn fet t)s2ur( p;t0olxnmoctasfa uaumo;u0 eeoxfcoydoatranes (0 rtmxmpny1lp nmivsat) 2rmxroot4aleomfeiatfm ulums t4 lermf ia1late u o;t)trxm(r3no1omee feil( a2ta( o;u0oee  f3tyd a emumont0altomr iy1fmt lies (0 rtmxm iydoltnmfvtls sDtm(rono4aptnmoeildfm2eau s;u4arxrmr3iytfptelu i;t) 2uoio3oodamenmnctlsfsDtm(m ot4opx  f3tadlaDul( s t)trtnio3oadomDrauvo;t0trurirpio1ol e nes s a2rr(mpnt4ale ifciysla2rm( s;(0tlerio iytla ran olt0t2uo(o3nodlmt  nvs ()sDrrxmo;o1oltn fctat aDeauvs;u0 eenxoctytom e uvil(0sruoio oy1ame  fcs s a2umum nu4alt iietltfsDea(vo t4tetoxfcoy1fp e i o s)texo(o no4ole lfeia() rrr(mp;o4altomoeiatfsDum( ont0trxrmr3oo1la   ueo;s)trtr(o3iodomt  neilsfs2umumooo4olx mi3iys s rluvs;u4tlxoiociodfat anvslt)t2xr(m iy1al n iesa(fa2tr( ont1oeen oetlsfmDrlnvo t4 leoircoa1lm eauei;s) exmxr3ny4op nliciltfsDurx onu4tpeo f3tatfs ranvp;() etnxfciatop   uvsl(0srtrim nodolt lfei t srrr( pou1tlxnifeiydfaDrlump ()tlenircto1fa rlu o;t) 2ur(opiudomtn iciat)arurxr ;o4opt ifetaslmDeanvs u4aexoxo3oydlp  au o;t)teuoxm3nu4omen fctat) Drmu onu0olt ii3tyd s2uanmo ()aexnxfcoadoa   n ilt) ruoxm nu1alenmivias) rraurpot1tpt iocilsfs eaumont)altrmo iotlpD anvsls) 2trir3io1ome  nciatfsDraumooo4aexomoetld m2umums;(0arxomfcootla  auvo;()t2tr(opnu1lmtemnvsltf ruax p;u1tlt  fetas a2rmump (4aeeomrciadfa  ai slt t2toimpoudlm elfetl(faDrrum nt0tlt moetldfm2ranmp u4 exoif3to1fateln i;t)t2xo(m3nu4al e nct s)s2rau ont1texnii3tldls2rln p;t0tlxomo oadfa   iei s teuoxm no4amtelfes ( sDur(ro;u4olx ioetls aDelump;u)texoxr3oatop  aiei;(  rxoio iudom n ncs tf rurxmono1oexn icils aDrm(vs u4areoxr3iadfat  ies s s2xo(o3iy1lle mfcs ( s2rmxrono0tpe  o3iltla rm( p u4 etoio tydopDe u i s0 2toirpny4lm nlfesls sDtruront1optnmictlsfm2rln p t0artrif tatomD  n ils0t2uoxm ou4apt  fctl()artm(ro;u1oexn ictyslm2ua( onu)aetrmr3oatlptrlivo (0t2xm(m oy4aptnlfetls)s2rrx pnu1aeeoif3iysfa2ra(vp;u)trxnmo3ia1lp ean sl(  2tmxr nodlle  ivsa(faDrrx ono0olxo oeiysfs2elu pn(4 rtoirctydoaDr ues;t)setm(r3oy1aleelicilt aDtr(r no0oexnif3iysfsDuau ont)aexoxr iodopDe n olt  2ur(r oy1lpen fcils)aruaur nt0tet ioctydfmDumuvo;t0tltoircoydoa  livi;s teur(r3iu4op e nvt t a2trx ooo1altoiictlsla2eluvp u4areoir ootopDrlueil(0srxoxrpnudolt licta(farrm(mpou4aetniieiys m eanvp;u0 rxnmo3tytfmteauvil(0t2xoxrpno1ap nlneslt  2truronu4alx moetld s uau o;u0trxrif3oadfaDrluvi;( s2tmimpiudal nmnesas  rtm( pnu4aleoioctys aDrln s;t4aexnmf totfmDe u ilt s2xr(r3ou1al nlnvtasfa2rau  ot0texn fciasls rln snu0teerir3iy1fat  nvs;()srtrxopny4oltnlics () 2rrump;o0olxnioetls sDeluvs ()tlxoir3oodfa rln o s  2xoxo3io4ape  fei t)sDrmurp;o4tpxo feias s2em( onu)aeeoir oa1omte ivo;()s2uoim3ou1al elivias) Dua( onu4tetomo3iad aDul(mp;(4 rxnxfcia1om   ieo;s0t2tr(m oodopenmivias)sDtr( pot1oexomoeiytla2rl( s;(0aeeoxf3oytfa  au s () exm(m io4lpe mivsls) 2ra(m no4tltomfeiyslm rmu ont) eenmo3to1fpDrlivolt0s2tmim io1ap emnesl( arta(  ;u0altoioeiadlaDemn o (0 lxnio3oa1latrln s;t)teuoxm iodameelneslt s2uaurono4teen fciadlaDelnvp;()trtnmf oodlpDeanvol(  2tr(m3no1alee ivslt  2urx  nu4ope  ociytlaDea(mon(4 eenmr oodfm ean sls trtrxopiydamtnlnvsl() rur(r nu4altnmoeiat a2eauvpnu0tetoifcoa1opDrln olt  etr(r3ny1amee icsat)s2tr(rpnt1alx  ietlt m emumsnu)alxnmrciodop  li s;( srxm(m3oy4lp  miet s)a2rrur nu0oetoif3iyd m2uanvont) rxomociodfpDrln s s s2tr(r3iy4lptelfctl() 2rmur ot0oeenmiciltfs2umuvp t4 renmo oatfm e ivo t  rtrxr ny1ole  icsl( aDurxmo;t4aptomfctyt m el( pnu4trermfcia1fmt lueol(0s2ur(r3oo4om emfvtat arumu oot1olx ifetytfa2emn p;()aexrmr iydfatr uvsls0trxoio nudlm n nviasfsrrrxmono1tlxo ociltfa uanvs;u4tetnxrctotlmDrliei;s0t2xrxm3oydlpeemiviat  Drm(r nt4oex ii3ilslmDea(mo t0 reoxociydfmDelivols)t2umxo3nodaleelfctlt) rrmump;u4oltoifeiat a rlnms (0 rxnxfciadfmte uvsl(0s2xoio3io4lm n fci (f rrmur ou1tpenifciatfm emnms;u) rxrir oodfaDeaiesls)t2trxr3no1ame lnvtltf Drm(mp;o1tpen feildlsDemu s;t4trtoio to1lptelivils sruo(opnydal  mnctls) Drmurpot4alenif3tatfmDumuvo;(4aeenirctytfpteliesl(0tetrim3ny1lpte icilt  Dtax poo4tetoiietytlmDel(vs u4tetnif3oy1opte nvi;t)tetoir3ny4olte neiltf 2ra(moot1oeeoio3iyt s ranvsnu0aetoir to1oaD  nvi;t)setoxr3oo1lmeelics t)srtmu pou0oet mf3iydfm2eluvo;(4aexnxf3oadfpD luvol( trtrio oo4op nlnet s  Dtm(rp;u4alxo feiyslm rau p;(0alxoircto1op r u il(0t2xmxrpiy4ll  lictlsfarta(m no1oex  f3ilsla2uln snt0tlenifcoodlm e n olt0t2toio3oy4op nlfvi s) rtmu o;o0oex  o3iydlsDumnmo (0alxrxr3tatlpt ln ils texmimpiy4om emiciat s2urum nu0oet  ieiadfa2eln p;t0 rxrmo oodlatrliei;t0setm(mpio1lp nmfeslt aDrrx oou1aptomfeias s2ulu p;t4 leomo3tatfp  liei s teur(mpiy4ape mfesat a2ua(  nt0oex io3ilsfs em( s;t0 eeomo3iydopDr i ilt0t2uoir3oy1optemivilt  Dtax pou4tltomfciat mDrm( p;u4trxnio3oodla rlnvs ()t2tm(r3nu1ame liet s) Drrx  ;t0tltomi3tas sDulnvs;t0altrif3iytop   ues;s  2tr(m3oydomenlnvia(faDrrur ot0tetoioetasfsDean o;t)areomf tatfa   ivi s) exmio oy4openmnei sfs2tm( ooo1tltn i3iat sDraumpnu)tleoxf oadlat lneo ( tetoxo3ny4ome lneta()srrmx p;o4opt ioctlslmDuau pn(4trxnxrcoadla ranei s0 exrim ny1amtelnes s  Dtru pno1aeeoio3iad aDelumo;u) etoxf oodlmDraneslt0 rum(m3iodlpeemici () 2um(mo;o1alxn oeiytla2rlumont4 rxnmrciydoaD livsl(0 rto(r3iy1opeemiesas  Dua(mpoo0oetnmf3tat aDea( s;t0 rtnmr3oytomteai s;s0t2tm(m3iy1ll n fctat artmxroou1oet ii3iltfs2ea(vsn(0 exrmfctodla elues t0 2uoim oy1omtemfcilt)srta(mp;o0oeeomfetlsla ranmsn(4arxomf oydlm   nei;()s2ur(mpoodlme micias srurx pno4tlenii3ilt m elu p;u0 etrxocoatfmDelues t0 rxo(opoodapeemieiltfs2tm(moou4teeoio3tyt s2eau p ()artnircto1lmtrlieo;t seto(o iydlp e ncil()artau ooo4apxo ocilsls2rlnmp t4tleomf oa1fmD luvi t sruo(m3oydlle  iet s aDrm(m nt4tpt  octadfm rl( s ()altomf3totlp elu s;t seum(mpiy4omt mnet s sDuru  nu1tle mieils a2emn p;(4trermr tydfaD ln i;s0tetrxr3nu1ll nmfetls)aDuau  nu4tex ii3tltlm ul( o;u4 etrxfctatla r i sl(0seumir nudapt lnctl( sDrmu o;u0aleo iciyt m elumo u4aexrxr oydfpt an s;(0 2to(o3iy4aptemivtat aDrru onu4oee iictas s ulums (4trtrmf iydfmt an sls) ruoir iudal e nvs t  2tr(r ;t0tle ifeiydlmDra(ms t)tetoxr totom elneils)s2tm(o oodolt mieil(  2raum nt4tee iiciatfm ulump;u0 eeoiociatfatrlnvo (0s2trir3iudomte nvsas  Dumuro;o4apen f3iltlm umnvs;t)arxoif3ootfate u sls t2tr(mpoo4llenlfviasfa2uaurono4aeeomieilsfa2elumo;t0aexomfciydfmt aivsl( s2ur(m ou4op   fesls sDra(  nu1apxo i3ilslm2ulu p;u4trxnmo3iatla rlivo t)trxmir io1op nlfcsasfarrruroou0oexnioeiasls rlnvs;(0 ltnifcio1fpDeau il() 2urxr iodlp elncsatfsDur( p;t4oltomo3taslmDeaump () reomo3ty1oaDe nvo t trtrxo3iydoptemiesat sDurur ;t0tpx mfctydlmDrlnvo;(4 exrio3ta1latelnvi;(0 etrxmpoy4lmt mfct (  rurumo;t1aeto icilsfs2ua(vsnt0 lxoifcoydoaDrlnvs t  rtoir3no4llee nci s) 2taump;u0tet if3iatlsDelump;(0 exrif3oatfa ran i;t)srxmxr iy1apenlivils srrrxmoou0opx mfeildla eln p;() lxomfcoytomDe u o;() exr(r iy4ol  mnes sf 2taurpnt0apenmoeilt a elu o;u4tlenmo iotlmte ueols)setmio oodoltnliesls) 2umxrooo0texomoeiydfs2rl(msnu)tetrxfcoytlmtean ilt srxmxopnydape liet tf rrmxrpnt1opxnioeiydfaDemn pnt4texnxocoy1lpte n ils  rto(m iy1ape lnvtl(fsrtmxmpnu4ope mi3ils a ul(vpn()arenmr3ta1late i o t t2xoio no4ol  mnctl( a2trx onu0tlt mf3ild m uan p;u)areoxf3iatfatrauvo s0 rurir3oo4ll  livslt srrrumo;u1aetomfeiys s2el(vp t) ltomo3tydlp eaies;t t2xoxopio1ape lfcsa(fsDrmx  nu0ope mfciltls rm(vsnu4tltrmf tydomtelues s)sexrxo3ny4optnlictat s2rm(m no1tpt  fciadfs2rluvo (4trtrio oytopteauvol() rxo(rpny4lpe lictatfsDrr(mpnt4alt  fcildfm eluvs;t)alenxrciadfp r uei s  rxmio nu1amee ies ()arrm(mo;t1oee mfciyt m2elu s t0 etrircoodomDrluvol( trurio3nydol   feiasf ruaumo;u0oltoii3iasfaDrlu onu0artnxo3iadfptrai i;()s2tr(r3oo1ameemnciat  Dtrurpno0ape mf3iydfmDrm( p ()alenir3to1laDr ies;(0 ruo(rpio1lpe mfvt tf 2umxmoou0olx mfetldla2ra(mo;t) lenmrcoa1fm rau il( sexm(o nu1om e fet s s2uaxr nt1oeeo iciad m emuvonu4arxnmrcio1fmDr iei;s0seumxm3nydol e nvsl(f Dtm(  ot4aetnii3tys a2ea( ont)teenifcto1lmD aivslt t2xmxmpny4lltelivtas)aDra(  ot0oleomf3ilt aDemnmo;t4arermfcto1fmtelues t0s2tr(r oo1llen ivsas  2um( oou0texn ietyslmDrm( snt)arenmr iotfatr uvi;( texrio oydamt mict tfa2umur ;u0aeeoio3ildla2uan p t4arxnxrcio1fateanvi;t setm(opou4al nmfcias) rraxro;o1tet  i3iat m ua(mont0 renmf oatfmteaivs;( trur(m io1opt lfcs sf Drm(r oo4oleomf3iasfa2ea( p;u4 renxf3ty1fpDeaiei s s2trxrpiy1am n neia()artm(r ;u4aeeniictls a rmnvo;u)texoircio1omt  u olt)t2xm(m3io4ll nmnvt sfa2trumpnu0texnmiciytfs2ul(vont0arenxrcia1faDe uvs;t0 2xmxr3oudlmt  fet sfsDrr( poo0tpxoioctld mDuln o;u4areoxfcoadlaD luvsls0t2xrxm3nudaltn fesa(f rrru  ;o4tlenmiciys sDulnvs;t0trxnmocoatlp   nvs;s srxrio nu1lptnmncsatfsDum(mpoo1optnmieildfa2eluvo;t0aetnmrcootlpD aiei;(0tetoxr3oy1lpte nciatfaDrm(m nt0tet mietytla rm(ms;t4 eeoir oytfmDeliei s0srumxr3nodaptnlfcs s sDtr(r ou4apenmietyslm2el(vo;t0tlenmr iydfa r neo;s seuoxm3iodal  lnesa(f 2urx  nt0tptnioeiatfsDua(msn(0tetoxrcoadfp eluei;t t2xr(o ou1omen fcsa( srrr(m ou1alto f3iadla2emnms (0altnifcoadfpD  nei t) exr(rpoy4am emivtltf 2rr(rono4opx if3iadlaDuanms;u0 renir3io1opDrlivs s  rtriopio1llt lfeil(fs2tmxmono1alto fctldlaDrln snu0trxnxf iatfa eaivs;s0truoim iu1al  lnvtlsfa2raumpnu1tle  o3iytfmDul( s;(0tlxrxr3oa1lat luvolt0srtrio oy4am   ieilt srua( poo1apt mociat m2umump t4tlerio totlpDelnei t trtm(r ny4omtelnvs sfarta(m no0apxniocias s2rmnvs;t) etomr3oytfate n o;(  exmxr3nodom   feta(f rraumo;o4aexoioetys a2rmumont)texrxr3io1fm elueilt0srtmirpoydopen ncsas  2trumoot1opt ifcias m em( p (4aleoxf iotfptrlnvols) exrxm3iu4lm  mfvt t  rra(  ;o0apen f3iyd m el( p;t)trtomrctotlpD  ies (0srxoxo ny1lm emivsa(  rrmxr nu4olt  f3iltfs2ra(mo u4 ltnif totlpDelivs t)t2toir nu1al  lfeta(fartru p;u4aetoio3iyd s2eauvpnu4alxrio3oodoptrli o t)srxo(r oudom  mfvi t)sDtr(mpnt0tpen fctadlmDelump u)altoio3iodfmt li s;s0t2tr(rpnu4om elnci ()a2rmxmpno4oexoii3iydla2eauvsn()alxnioctydla   ueo;s  etrirpou1opt  nvil()arrmum no0oex  ieiat a2ul( onu)artomf3iytlp r i i;s0seurir oydomenmicilt arraum ;o0aeeniociatlmDuln p;u)arenir3ty1fmteli i t0trxrir3iy4amtnlnvi sfsrrru  ou1opx iictasfaDrmn p t4texnxo3totfp eaivi;s)s2toio nu1lmtnmfcilsfsDtrumpno1alxnmi3tadfs elnvo;t0aexrmo iytfmt  nes;(0t2xmxo oydapeelfcsltfaDur( pnu1apeoioeiydfs2ua(ms;() etnircoo1lpteaieo;( teuo(o no4lm elncs t)a2tru ont1ape mo3tydfsDran sn()texrircoytfpD luei ( t2urxr no4alte fctls)aDur(rp;u1tpxnifeiad s rlump;u)treoxr oatoaDrlu sls truoimpnu4om nlict s) rtmu oou1optn i3iydla2ul(vsnt) rtnifctadomt aneols texrxr oy4am nlict s s2rrxrpot4tle iociydlm eln p ()texomo3ia1la   n s;(0s2xoiopny4omee fetat s2rmxr oo4teenmoetlslmDeauvp;t0 reomf ty1fa rlieo s) eum(m3nodap emivi tfa2tax  nu4tet moetysfm rmu snt) lxnif3oodfm rluvo t  euoxmpny4amtemfcil(fartrurpou0teenmo3iltfa2umu onu)alenif3totlat aneo t)texoxm iu4alt mfviat) 2uaxmp;o4oee  ieiltlm2umnvp u0artrxfcootfp elivo;() 2tm(o3ou1optelnetatfa2rm(r ou4aexoifciyd mDua(vp u)treoxociodlp rlnvs t0seuoxm oydlmtelfct t) rtmxmo;t0opx  ociydfmDrl(monu4 lxnmoctotlpD lies ()t2um(opny1lmtelncil( aDrax  ;u4tpxo feiyd sDel(vo u) rxnif tydoaDe ues;s) 2tmir3oodaptn fct t  rur(mpnu0teto o3ildfmDua( p;t)alxoir oa1omDe u s;(0trtoxr3iodll e ncta()s2ra(r ;o1aleniieiasls uln s;()alenmrcio1omD lnei t0t2tmir oudapt lfetlsf 2trx  ;u1apxo ictasfa2umnvs (0alxnxo todlmDr i i t0trxrxo3no4lmee fviasf Dtau o;u1oex mi3iyd s rmn pnu0aeermo3iydlmDe nvs () exrir oudomt micia(  2uau poo1ole mf3iadlm2uan ont0tltomf3tadlmteanvo;s0 2uoxopoudlpe  ivsasfsrtm( p;t1apt mictlt mDrm(mo (4 etrxf iatlaD  i s s)srxm(mpiy4open ncil(f 2trumpnt4alen oeiyslm2ra(vo;t4arxomr3to1lptrlu o (  rum(r oy1am nmfcs t) 2rmxr nt1tex moeiltfs rau p u0trxnir oadlptrlivo;(  rtoio3iy1lltelnvslsfaDrmx  no0openmoctytlmDra(vo;t0aetnif3oydfpD luvo s0s2xoxo3oy4am nlnvsa(fsrra(r ot1tpto fctasfa rlnmonu0 exrxrcootfpDraivo;s0s2xmxopnydap  lnct s artmxm ot4tlxnii3ildls ra( p (0aleoircoadlm eanei t) rtmir ny4openmfeils aDraxm nu0tpe  ociatlsDelu p u4tetrir3tadlptelueils0 rumxrpiy1amt  ivtatfartm( o;o1oltoioeiydlaDulu o;t) lenmocta1optr neo (  2xoio3iudom emivias a2trur nt4tlxomiciydla2uanmp;u4treoxf ty1lm eauvsl(  2xrirpoydlpen neta() 2rrumpot0opt  oeiltlm2uanvs;(0trtomr oodlp r n sls0s2tm(mpiy1opeemnci ( s2uax pnu4oexomfctlslm2eanvo;t4aexoioctytoptr i o ()s2xrim ny1op elnvilt srtr(mp;t4apxniociydfaDrlu sn()altrxrcoadfaDrlnvi s sruo(o3iy1altnmfcs t)a2tau ooo1opx ioeiat mDea(mpnt4trenmr iodlmte ieslt trxoim3ny4llt lfvil()aDtaumonu1ope mf3tyslaDrm(msnu0 eerxf3iodfm eli o;()setoxr ny4alenmivil(fa2uaxrpot4tlenmi3tldla uaums (4aeeomf oy1lpt aiei;t0t2urxm ou4opte icsltf 2rmxrp;t1alxnmfetlt mDrmn o;u) exomrcta1lm rauvs;s  etoim3iy1apee icsls) rtax ono1tptn f3tytls2umnms;u4teerxf tytfpDrluei;t s2xm(o ou1ap   ivtas  rraxmo;u1texn i3tysfs2rl(vsnt4tltrxrctatfm raivsls) 2xrim iy1om e nctlt artmuro;t0opx mfctasfmDumuvp (0teeoxr iatfaD  uei;() etmxr3nydlmtnmnet ( a2urur nt0aeenmiciyt mDumu o t0teeoif3todomDelneil(  eumxr3no1lleelnvt sfartmurpoo4opxo o3iatla2rmnvsn() rxnir3oadopt lu s;()teumxr ny4olte neiat)a2rr(m nu0tpenmictltfs ranmo;t0 ltoifctydfatrai s s0srum(m3ou4lleelnciltf 2rmur ;o1ope ioeiatfaDeluvp;t0trtnioctytfpte uei;( t2urxr iu1aptemfei (faDrrxrp;t0openmociatlm ulnvon(0aetomr3todoaDe neils s2to(o3no1ol emnet s s2ta(moou1olx mfeilsfm umnmo;()aeerxr oodfmte u i;s) 2urxmpno1om  mies s)a2tr(  nt4tlxnmietasfa rmuvonu0 rxrio3totfpt au i t) 2xoirpnodlmenlieta(f rrm(mo;u0oleomo3iltla ul(mpnt)tltrxo ootlatrlu s;t)srtoxo3iu4olt mfei tfaDtrurooo1oex ioeiysla um(vonu0teeriocty1omt livo;t)trumirpiodom elnvi t  Draxm ;t0tlt mictysfaDelnvp t0aleomf3ta1oa   ieo s0setr(r3oodamt lfviat) Duaxroou1olxo ictat m2rm(vs u)trtomo3oy1opD anvolt)sexrxopnudlme mnes s  Dtmx o;u1alt  ieiys aDrauvp u0alenif3oytfp eaiei;(0s2xm(m3iydlp  lnvsa()a2rmxro;o4tleoiocilsla umu onu4tlenmf3io1omt  ivo (0 rtmir iudaltemfes t)a2rax  ;u4olxoiociydfsDel(vpnt4 rxrif3tytfaDeluvilt setoiopnu4lm nmnct t  2ur( pou1oet ifeiad a2ea(vo (0aexoxr3todomDeaieo;t)trtmxm3oy1olt  ici sfsrumx onu1apt mfeiat a ul(vp (4teenmr oadfpt  uvsl(0sexrim3nudap   ncs tf 2ta( o;t1ape ioeilt m2uluvpn()aexoircoy1laDr uvsl() etmir iy1am n ivs t s2rmur nu4opxniociasfmDeanmpnt0treomfcoy1fat ai sls)tetriopoodopenmicsa(f rta(rpnt4tlt  oeild mDeln s t) lenif3oo1lmDr nei t s2uo(r3oo1am nlnes (faruaxr ot4apt iieiasfs2rlnvon()arxriocoodlm r u i t)t2umxo3oy4lptelfviatf Dtm(ro;o0tetoiictltla ea(mp t4tetrir3tadlat an s;(0teum(o ou4ap emfctl() rra(rp;u4aetomoctys m2ea(vp;t0arermf3oa1fpt  nes;( trurio3iodap   ncsatfs2rm(rpoo0tleomi3iysfm2rmnmo t4aeermf3to1lm r ivils srtrirpnydaleemfcil( sDtm( ono4tlxnioetas s2eluvont0aexnif oadoatr neols srtm(r3iy4aptn iesls)aDuru p;o4tpe ifciad s2eauvp u4tetoxf3iotfa ran o;s0teuo(r3ou1llte ivsl( s2rrurpnu4tlx mi3tyd a2raump t0tlerio io1fmD au o;s)sexmimpoudom  mneil()aDrr(m ;t1aex mfetyd m rm(von(0 reoir ta1op e ieilt0texmiopio4ll emfetlt)artr( pnu0tlto i3tltlmDrluvpn(0 ltrxoctytoatr u o;()t2um(rpoudlp nlicta()a2tmu  no1opxomi3iasfs2elu p;()trermfcoydlat au i;( seurir oodlltn nci sfs2umxmo;u4oee ifciad aDum( p u4tltnif io1fpDr i olt trtrxm oy1lptnmiet t) Dtrxr nt0tptomf3tasfs2eaump u) eenmf3oodlp rlies t)t2uoxm nydlp  lfetas  2tm(mont1alx iiciydla rl( o;(4texnxo ootoaDr n ol() rxr(r ny4am nliet s sDum(rpot4opx moeils a raumo;u4 etrxr oo1oat auesls)trtmio3oy4ole  iesasfsDtr(r ;u4texomo3tysfs2umu p;t4 rtoirciadoate neils0tetmxo nu1altemnctl(f Drr( o;t4apeo fctys m2eln s t4tleoxr3iytfa  livils0 etmxmpny4apen nvtl()sDrau pnu1opx mi3ilslmDrl(mp;t4trerxo3iytlptelivo;()srtrir3iodole mnes ( a2rmxmoou4tpen iciys sDemnmo u0 lxrmo3ia1la rlneo;s0 2xoio oodope mncils) 2rmx pnu0tlx  feiydlmDea(ms t)trerxf3iatfat  nesls srxrxrpnodopen fciat)arrrxrp;u4tptnmiciltfm2rmumo t0aetrxociydfaDeluvi;(0 2tmim iodlpee fvt s  2urxrpnt1tpt mfeiytfa2rlnvon(0tetoifciatfm eaies;t) etm(o3iu1omt  ivtlsfs2rmump;o1tet moeiatlm ea(msnt4alermo oy1opt lueo t)s2xo(m iy1apenlfesl( aDtrxr ou4aee iicildlm uanvp u4 rerir todfa eln s s0trxm(opoudlpee nvsl( sDurxmpno1olt  ieiad a2elu p () lxomrciydfpD liei s) exm(r no4alte ncil(  2rmum ;t0aptn f3tadfs2uan onu4 exrxf iotlm r i i;()texr(rpiy4opeeliei (faDua(  ou1oet  icias mDrauvp;u) eenxf3iotfm e uei;()srxoir3iydlm  miesas)s2taur ;u0apenmieiatla2ulnvs;u)teerio oydfmt  ieslt  euoio3nydam nmicsat srum(  ;t0tltnmo3iat a rl(vs;t4alxniocto1faD lu o;s  rtmirpiodamt lnesl(fsDrmx onu4tex  o3iadlaDrm(vont)aeermr to1om rlu s s sexoxm3oudaltelfctl(f Drmxr oo1aee moeiltlmDel( on()alxrxrctatlptrlnei t  etoirpou1ap emfeta(fs2uru  ;u0aex mictyt a emn s;t0texomr tadfmDrln ilt0t2xr(rpoy4omeeliei t arumx  ot4teen oeiydfs2rlnmp u4artrmo oatfpDeauvi;s0 eur(opoo4am n fci s)srtm(r ou1alx mfeiat s2ranvs;u)alerir3ia1op  aiei;( s2um(o3io1olt mfcs (faDtaxront0altomiciat m ulu onu0 reomr3ty1lp  liesl(  etmimpnu4llt mncta( aDur(r ou4aexn fciyslsDeln pnt)aleomo tatlm  aneols s2tmxo3io1olte neiat) rtr(moot4tpenmfctltfs ranvpnt4 rxoifciytfm eauvolt) 2urxopou4lltnmfcias) rrm(rpno0aet  ictysla uanmp u4alxomocoy1opDr u i s)t2xr(mpno4om   ietl( arrm( o;u1oltnmfcild a2rlums;t4trenmfcootlm r u ols)sexo(mpiodam e iviat)a2trurono0tpt ifeild s ranvs ()areoif oydlp   ivols0 rum(mpny1ll nlnes sfarurur oo0aleoif3tyt s emu pnu0artnxfctytfpD  nvi t0t2tr(r3ny1ll nlnesl()sDua(mo;t4olt ioetyt aDra(mo;u0alxrmfciodomDe i s t t2xmio nodalen ivs sfartaurpnu0tlx  f3tytla2ra(vs;(0 lxrmr3tatlaDraneo t srtmimpoo1aptemicsl(fsrrru  nt1olxnioetatls ean s u4 lxnmociytlpDelieslt teurio3io1apt mnvs t  rtm(rp;t0aet mietadfs rl(vo u4alermr3to1la  auvo t t2ur(rpiu1lltelncilt arur(rooo1apeoiieiltla2umn p (0aetrmoctydfmteaieol( s2trirpoydlmte nvsl(fa2umxmpno1optomfctltfs ulumo u4 renmf iatomDrli s;s)s2urimpiu4amt mnvs ()artm(mo;u1olt  oeiat s emnmp u0tltomo ootlat lueo;s sexrim3oo1lpeemiesa(  Dta(r ot1apeoiociat m ea(msn(0teerxo oatop  lnvolt)tetrxo3iy1op n ictl( artrxmoot4apeomi3iaslm2uan p;u)artnxf3oa1omtrlnesl( sruoir iudlp   nvsas sDra(rono1olto ociasfmDuanvp t0alermf3iydfpDeai i s0sruoxm3oudlmte neilsfsrtmx  no4apeo oetas a umu snu) rxoxo3iodom  anvs;s0 2trxopno1ape mivsat)aDtr( o;t0tptn oetldfm rmuvsnt)aetrmf3tatlatelies;t srurio oo4opt mieias  Dtm(  ot1oeen octld m2rlump;t0teerxr3to1op rau slt  rumxo iy1op elnvsas) rtaurooo4olt mocilsla el(vpnt0tetrxfcoadom rau s;t) rxoxo3oodale lfvi t)a2rr(m ;o1apeo fctyslmDea(vont0aleoxo3tydlpDr ueo;s0 eumxr oo1apte netas) 2tm(mp;t1texnio3ildls2eln s t) exrifcty1optr ies s0teurxm3oy1op  miesltfsDuru  ;t4aetn ieiatfa emuvp;t) ltrmo todfp e ivsl()t2xmio3iy1oltelfvsl(  rtm(mpoo0alto ictyslaDumuvo t4alxrir3oytfmtrlneols) rumxmpio1lp elfvil(f Dtrx pnt4tet  ociasfm uauvont0aexomr3oadoa r uvs;t t2umxr iodomtnmnvtls  2rax pnt4optomi3iltls2rau on() etnifcia1omDr n olt0 rtoxopnodlmtn fvias)arrrx pot0tpe  iciysfa raump;u) lxnifcia1om ranes;s setmxo io1lp e neslsfarta(rp;u1opxoio3iyt m ulumon()aetrmfciatfaD ai o t0sexm(mpou4apt lnvs s aDua(m ;u1tltoiieilslm um(mo u4 lenmo3ia1faD  ivil() exoir nu1lmt mfesl( srtax oot1tleomiciad a ulnmsnt4 rxrxr3iotlmD livs;s teur(mpiu1ll nlncia() 2urx ont1tex  i3tltfm2rmu s ()alxoxr ia1lmDrlivi (0 exoxmpiu1omeemnvi s aDra(mpot1oeeo ieiad aDrlumsnu0aetomrciy1laD  nei s0t2tm(r3nodape  netlsfs2rmurpnu4tpe moeiadlm ua( o;t0arxrmfcoo1fm  lueols  rumxopnudll emicils  2tmxmo;t0tex iietys a rln o (4tleoir tytopte ivilt0srumxr3nu4ll nlietat  2rmx  ;t0olxo oetyt sDelu snu0tlenxr todla  lueo s)srum(r3nu1ap n nvt tfsDrr(rpou4oexnmfciatfs uln sn(4 lenxo io1fpteau s;s) etmiopoudlmtelivt s  rtm(  ;o0oleoiieiydfa2rmnmsn()tlenio3tadfatrai il()srxo(o3iy1lltn ics t)a2tm(mpou0tptnifctltlaDrlu s;t4 rxnif oytlm e nes s t2tm(m oodal emics ( a2ra(m ;o1tlxomoeildfs2uau o t4 rtoif3iy1omtrlu o (0 exoim nydale mfeil() 2tmx  oo4alt  iciydfm uau p;t) rtnirciadfpDelies;t0srurim iu1omenmics tf rrmurooo1tlx mi3iadfs2elu s (4 etoif3oo1oa elnvslt0s2xr(rpoo4ll  lfvs ()arraxr ou4altoii3tld a2ra(mp;(0altoxf3oo1lpDe ues;t trum(rpny1ap nlneils  rumxmo;u4opx ii3ilsfs2em( pn(0tltnxr3oadfaDrai o ( t2uoio ny1om nmnvi s aDtmurpoo1tlt iociatfm emu snu0 etoifcoadfp raies s) eum(rpiy4olt lnvsl()srtrxr ;t1teen ieiltfsDul(mo u0teenmf ootlm  lies;t)t2xo(m oodam  mfesasf rrrxr nt0ape ifeild a2ea(mp;(0tltrmf totfp r ivs (0srxmimpiudalen icsa(faDuaumpoo0apenmfctldfmDemu s u4 etnif ia1fm  lnvol()tetr(o oudlle  nes (f Drrur ;o4tltomictlt s2emnvpnt) ltrmo oy1optrlieo t  exmxo3no4alte neiatf Dtmxmpnu0texoifciadls rl(vsnt) reniocty1lpDeai s;t  2toxm oodom elnesa(faDraurp;o1alxomieiat s2uanvpnu)alxrio ta1lmte u s ()tetm(opiu4amte nvsl(  rrrxroou4aptn ociatlsDuan p (0tetnmo3oo1lpD luei s  2xr(mpio4lm emivia(f Durxr nt0apx  ociltla2el(mo u4trtrmf3oa1faDeauvo t) euoxr3nodlm e nvtls  Dtaxm ot1optniietld m2rmuvs;t)aexrmf to1fat ln o (0srxrim nodaltn ivi (fsDraumpoo1aptomietysfm2ranvs u) exoxo totom  liesl(0trtmxrpnydllee ivtls  2urum ou4oeto feilsfs2rm(ms u)arxoxrciotfmtrlu o;t0 eumxm3oo1lm  miesa()arra(monu1texnmiciatfm ra(mo t4tetoir oa1fp   i i t0 rxmxm3io4amtnmnvsat srtr( pno4tpt mfetytfs em( p;(0treoio io1lm  lu o;( trumio nudomte nvsat)a2tm(rpno1opt  i3tytfm rluvp;()teenircoy1fm raues;s)trxoim3nu4llee nvtlt) rtaxrp;t1oleoif3iasfs raumpnu0 ltrifcootlpteauvo;( trumir io4lm  lieiat)sDuaxrpoo0open ociydfa2ea(ms;(4 lxrxf oatfp   uvilt)t2to(o3iy4amte fcs ( a2ur(r nu0oex ifeildls umn snt0alxnmrctytlm  aiei;t)texoxmpny1lm nmict sf rta(m ;t0oex iiciysls2ua( snt)tlxrxr oydfaDrlneolt0 rxmirpny4lpenlfvtas)s2raxm ou0olxomfeilt a2ran p u4 lerifciadfa eln ol(0srxo(mpio1lme mfeslt a2ururoot0oleoiictldlmDemnvp ()trtrmocio1omD liei;t0s2umxopoy1llee fetatf 2ua( poo4alto ociasfs2el(mpn(4texrifciotla elieo;(0sruoxo3nudome lfviatf 2ra(rono1apeomfetadfs2elnvsn()tetnxf3ty1op e i olt sexmir3nodlp  mnes s) rua(r ou1aptn ieilsfs2ra(msn()alxrmrcoytlmDrau ols0 euoxmpny4om nlivsa() 2rm( o;u0tpx  feiyslm2umn s u0aetnio3oodla rli s;s0s2urxr nodll nlietatfsDra( ono1aet ifcils s rl( p (4aexrmo tatfpDrlnvs;s)texrxr3ny4ol nmicil(  2ra(mp;o0tlxo f3tldlmDelnvp t4arxrmocty1opD  ivi ()srurir ny1lpen nci tfs2urxrpnt4aetomi3iasla2uan o;(0altnxo totla raivo s0truoio3oodome lncilsf rtm(mp;u0tpenif3tadlm2umumpn()tetoxrcoy1fa e uesls  2trxo3oo1am n nesl( aDraurpoo4oltn f3iltfs uanmo ()altoxf iydfat  uvils0sexmxmpiudope lfetlsf rua(mo;t1tetoiocildlmDel(ms;u4tetrxo iy1lmtrlu o t)srxm(m oudomen ictls)s2uaur ou4tetniociasfm raumo u)tlenio oadfpte i sls0texoim3oy1am nlnviatfs2rrumpou1opx  ieiydlmDel(vpnt) lerxfcoytlptraneo s0 eur(m3iydal emneilt) Dtrx  ot0tex mfeiasls2eanvs;u)trtomo3tatlatean s ( trtmxmpiy4lpt  icsasf Drmxmp;u4aptnif3iadfs rl(mpn(4tltnxf oa1lmtrai o t)s2tm(o3iudop  lictat s2ua(rp;u0tee miciydfa2rlu pn(4 exrxf3oa1om  auvo;s0texmio io4al  micta(fsrtr(rpnu0apxomietldla2em(vpnu4alxrmo3oa1lpD lnvsl( setoxrpny1altnmies t)aDtrumoou4aee  octldfs ea(vs u0 lermr3todlmD auvs t0s2uoir oy1llen netl()s2tmx ooo0alxnmoeiatfm2ulu s u)tlxrioctotomD lnvo t)t2xmxr no4alt  ivsa(  rraxro;u4tlx  oeiyd sDran o;t4trxrmr3oodopDrlues s0 exmxm no4lp emneil()a2tm(mpot1oeto f3tadlmDrmu p (0artoxf iatoat auesls)trumxo3oy4al  mfes t aDurumo;t0tpx  i3iyd m rau s (0 exrmo3oo1oa e nvilt  2xoxmpoy1omenmfeslt a2rrxr no4olx mf3ias m umnmsnt4tleoio3to1fm  li ils0trumxr3nu1op e ivsl(fartr(ro;t1aptnmociasfm2eanmo u0aeeomr tytoa   ueolt0 2xrio3oy4optemivi s arum(ro;o0oeen o3ils m2um( s;t)tltrmfctadop raivo;s s2umxo3ou1lp nlivs sfsDuaxm nt0tpx ifetatfa2ean s;t4aetomoctydlpt  uvi s trxmxr3oo4ope  ivs s  2rrumonu0teeo i3iltls ulnvsnt0tlenmo3iytlat  ies;s texo(r3no4lm nmiesls) Drau pot0aex mf3tldfsDumnvonu4 etoxocoy1omDrauvsls0 2toim3nodapenmicsas)sDrmxmpoo0openif3iysfm2eln sn(4trtrxrctydfpDe ivs () 2toxrpiy4al   ncias s2uax  nt0oee ifetldfa ulu s;t0aeeoio oy1lat luvi t trum(m nudam emiet ()a2rruroot4aeeniictatfm2ean p u4 rtrir3tadopDrlivils  eumxr oodame mnes sf rrmu oot4olx  o3ildla2emuvsnt0teenif iy1opD ln o;t  eum(r3io4amtnlnvias  2ta( p;o0tptoifetlt sDul(vpnu4aetoir ootlaD  uesls) 2trxr3ny4amt livs t aDta(r ot0opeomi3ilt s rl(vsnu4 rxrxf3iadoa rluvi;s0 2trim nodom n fcils sDtrx ono0apxn i3tls m ulnvp;t0teenmf3iytfmDranvs t t2to(mpiu4ap n neia( aDra(r ;u1oeeomfctad a2rm(mp;(4tetnmf3iotfaD lueil() rxmirpiu1altnlivsltf Dumxm ;t0alxn iciys aDum(vp (0alxrio3tytlm   ieil() rxoxr ou1llenmiesls)sDuau p;o4tpen oeias mDum(vpnt0areoio3tatlat  u s;t texm(m3oodlp  lnvilt)s2rmu  nt4aeeo ieiytfm el(vo ()trxrmf oy1latrluvslt s2xr(rpoodal   nci () Dtaxr ;u1alx mi3iadfsDul(msnu0tlenir3iy1lpt  n s;s trtmxrpoy1lp  mies tfarrm(m no1oex miciytlaDeauvpnu)aeenxfcootlm rlues;t)srumio3no1alen ncsa()a2urxmpot0oee  ieilt aDrm(mp;t4aeermf oy1la r uvs () 2trir3io4lpt  nvt sf Draumont0openif3ias a ea(monu4texomfciy1oa raivsl(  euo(opoy4am elieta(fa2rm( p;o1tleo ieiadlm2eau p t)trenif3iodfmDe ies;s) rum(m3oy4ope  nvslt) Dra( o;o0tee  feiatfaDrln o;(4 rermr iotfa   i i t0 rxr(o3oudlme mneiat)a2urx pno1apeomo3iydlm ulnvp;t)tetoxr3oy1op rln o (0setmxo3iodop e fvtl( artmur ;t0oeeoio3tys m em(vs (4 lxnxociydfpDeanvils0texoxr io1omtelfvslt aDuax pou4oeeo fcildfa2elnvs t)teenxfcoatlaD  iei s0srxmxo3iy1opt mnes t aDta(rpoo0aex mfeiatlm rl( snu) exnmfcoytom r ues;(0trumxrpno4oltelnesltf rra( onu1oee iieiydfs2eluvsnu0 lxrmo3tydoatrauvi t)seurxo3ou4apen fvia( srraxmp;u0oeenioctlt a el(vsnt)texnircoydlp eai s ()s2uoirpoo4omtn fvil(fsrua( poo1ope  ietytla um(msnu) rermrciydlaD lu il() exrimpnudllt mietl(fsrtrurono0olen f3iyd a rlu o u4artnxr3ia1lm   ieo ()s2tr(mpio4amte fvslsf 2urx ono4tee  ociyd mDra(vp u0 rtrif3oodoatrau olt0t2xoir iodam  lfeslt a2rrumo;t4apx iieiysla2rluvp;() lxomo ia1lmte n s t s2xr(r3oo4alt  neia(  Duaxr ;o1opxomociysfsDel(vs;u4alxrmr oo1lptr uvo t trtmxopiodomeemnetls aDur(rp;u1aee iieiyd a2ua(mpnt)alxrxrctatom  lieo;t t2urxm oo1lp elivsa(fsDuaur no4aleomiciatlaDul( s;u4 etnxo3oatfpDe i s ( trtmir3oy4aptn ncs tfaDrm(mpno4oeenif3iysfmDemnms t)arenxr iatoate uei;s  2trxrpoo1lptemictltfs2tmxm no4opxn i3ilt aDeanmo;t4trxrxo iy1oa r nei;t0 2tr(o nydop  mncsls srrru  oo4ape ioeiyt a el(mont)arerif oatfatrln i s)texmir3no1ol nlfvtat) 2raxmpnu4olt ii3tasls ua(vo;t4 leomf ty1fmDe ivils)trtoxrpnydllte fcsasf rta( onu0ale  f3iysfm2ulnvo (0alxnmfctydoaD anvs s) euoim3oodame  fetltfarta(  no1ope  octlsfa rmuvpn(0treomr oadomDeln olt trtoxm iydol n fvt (faDurx ooo1tlx  ieiad aDean p t) lenxf3iy1fa eai o;t0tetmxm io4al nlfcias)arur(rpot4apenio3iytlmDeauvs ()trxnxocoa1lptr u ils) 2trim3nydllt lfvi ()s2ra(r nt0teenmiciyslaDem(vo u4tetomo iadlaDrli o t)trxmimpiu1ale mncsl(  rrru  ;t4tpe  ocias s ea(mpn(4aexnxf3oatopDeai s;(0srumio oy4am  micias aDuaxrp;u1optnio3iydfs elnmp;u0texoxr oy1faD auvolt0t2xrxm3iudaleelnei sfaDtr(mono1oeto ociltls ea(vpnt4arxrmr tydla e nvs;t0t2uoio3oudomeelict (  2uaxrp;u1aexomf3tasls eln o u0 eenmocoo1la  aneslt0srurirpiodop nlnvt s)aDtmu pnu1aptn fetyt sDrm( s;(4 rxoir3oodoaDeaneils srum(rpny4aptemivi (fartr(m ou0opt mf3iydls el( snu0aetomf3oatfpt an olt seumim iodomte ncil(f rur(root0ole mfetldlaDeanmp;()tetrxo ootfmDeanei;s)srtrxmpio4lmt mict s) 2rm(r ou4opeomoeiys a uau p;(0 etomocoydfpt au o;s)s2tmio oo1am n fesl( aDtrxmpot4aptnio3iysfm ulnvsnt) leoirciatlpDrliei;(0 rto(o nu1amee fvs s s2tau  ot0apx  ictysla ua(mpnt0 leoxrctadfp e i o t s2um(r io4lmtnmnet (f 2rmx oot0tet mieiltls elnvs u0tetnxr3todfp eanvs;t s2uo(m oo4lm  micil(  Dtmx  nt4altnmfctytls emn o;u0tlxoxo oadomt ai ol() 2xmxo3ny1op elfeiasf 2raur no4apto i3tyd m rmn snu0altomf3ty1oateau i;t) 2urim oy1lm nmfetlt s2ra(mpoo4aetoiociltfs2ulnvo;()arxrxo3iodop eaieil(0 etrxo oo1alte ietat  2trumont4tpxn iciad s rau p;u)tltrir3oatfaDelnvo t)setoxo no1ol  liei s  rrmumo;t1texnmietad a2umnms t) rxomrciy1lmDr nvil() 2trxo no1al  lfvtls  Dtaumont1oex mfctat aDel( pn(0aexnio iatoaD  nei (  2umxrpoy1lmenmieil(fa2rau ooo1opx mfcildls2emnvont)aetoxr tatfm elnesls  ruoio iy4apenmivilt aruru  no4apxnioeiys a uluvpnt4aleoif3iadlmDe ies;t0s2uo(m iy4opeemnei sfs2ra(r ;o0tpxnmicildfsDrlnvp ()trtnmf ta1lpD auvsls)setrxrpoo1om elneslsfa2rmuront0apeo fetyd sDuanvs;u0tlxnxf iotoptr uvo t srumxr3oy1ap   nctltfartmxmo;u1tetomo3tyslmDel( o;u0 eerifciadlp  lues;()srum(o iudap   nvia(fa2tmur ;u4apeo o3iysla ulnms;u4aexomoctadlatelu s s)seumimpoo4lpeelfvi t) Duaumpno1alxoiietldla2ulnmo u4 lxoif3oy1om eaies;s teum(m ou4ap nlivt s)sruax onu1aeeoiocils s rauvsnu0altrxr3iadlmtelu o;s t2toirpoo4ll   nviatf rrmu p;u4tlt  i3ildfm uanvo;t0treomo oa1opt  nei;()seur(o3nu4lptnlnet tfsDrrur nt0olenio3tyd s2rl(monu) lxnmf3tydlat  u o;s0 exrxm3no1amtelncias s2rm(r ot0optn i3ilt mDemuvp t)texrxf oo1oate iei ( s2tmxmpoy4lmtn nes t) ruaxmonu0alto ieildla eauvs;t4tetoxo oatlp  aivo () rum(o3iodapenmfvtl(fs2rax onu0apenifeild m umumo u0alxrif3oydomtr neo;()trumir3ny1altnlnetas)aDra(rooo0alxomo3iys aDul( o u4tleoif3iotfaDrai ol()srxr(o iu1am nmivt t a2urur oo1tptnioeildlaDel( o u4trtnif3oo1op e ues;t  rtoir iydlpt mfvia(fsrrrumpou4teen ieilsfm rln p () renmo3tytla e nvil( sexo(opoudop n ict tfs2rrump;t0tlx  o3tyslm ulu s u0artrifciotfatr ieo t)setm(mpiu1al  lfvt (  rtmu pou0aeeoio3iytlsDua(vont)trtrmo3oytomt aivo;(0s2umimpnodlmee icias)arrax p;u0aetomieias mDem(monu)tlxoxo3iytlptrau s;( s2xrxmpnu4amtemfcta(f Dtau  oo4tle mietldfs2um(monu)alxrmo3oo1oateliei;t) etrxm iodapee ivsa( s2urxm ot4tpeo o3iydls2uaums (0tlenxrcio1faDeaiei s) 2tm(opoodllee nvilsfs2tr(mono4olenifcildfm2rmnmp t4arxniocta1fmDrln o;s  2xr(mpoydolee nct tfarrr(root1ale  f3iatla2rl(vo u0aeenxf iydfmt  uvols0srumxopiu4lpt  nesl(  Duaxrp;o4aeeoif3iys m rl(mp;t0teeoio3totfmteaneo ()t2trirpou1alee fei s) 2tmx  ou0oee  ocilsls elnmsnu) lxoxrciydoptran slt0seurxmpny4aptelfes sfs2trum no4tpto ieiltla elu s;u)artrif todlmteaues t)texriopno4altnmnci t  Duaum oo4tpeo fetydfsDem(ms t4 lermr3todlateli s;s0setoio no4opeelieiat)a2ua(rpot4oet  ieiat a2eaumpnu)tltrif iytlaDr ueo;(  2triopou4ape mivias arra(  ;o1aexo fetys m el(vs;u)artoxfcoydoat ln o s) 2uo(o ou4lmen net t) Dumu pnt1tetomoetydfsDelnvs;t0texoxocoytlpt livo t0 rtrxr iydlm   nvtas s2umx  ot0oeeomi3tadfaDumums t0teerir ty1fm  au i;t)srxrxm io4lmeelfct ()s2umxm oo4alt mieiadlm rmnmsnt0artnmr3ta1faDeaivils0 2urir3iu4lpe  ivsa()arurum ou0ole if3iadlaDem(von()arxnxr io1laDr ivsls  2uo(r io4altnmivia( sDrr( ooo4tltn feiyslsDua(ms;u0tetnio3tytlm  liei;t)sexoir ou1lme lfes sfaDra( oou4apxn f3tat mDrlnvp u4tlxomf ty1lpDrlieolt)t2tm(rpou1omtelfci ( arraxmp;o0apeo iciat aDuauvo t0 rtnmrcio1lpDr u sl(  exr(m iu1ope  nctls)aDrrxmono0aee  i3iasla rmnmont4tltnio3oa1opt an s;s) 2toxr3iy4lpe  ncil(  rtax o;t1tpxoifeiytfm rlumsn()artrmociotoat aneo;t)s2xm(r iy4al emivilsfa2tr(mo;o1tlxomociaslsDrl(ms;u) ltoxf oydlp  aneolt) exrim3oo4lm emfesat srumx onu1alt if3iat m2em(vpn() eermoctytoa  lieils0 2toxr3oudlmenmfvi s)arumur ;o1alto ociasls2ra(vs t0aexnmo3tytlpDrlnvo s t2ur(r3ou4ll   iesas)s2trxmpoo0tet  ietlsfaDumnvp ()tlenmf3tatfm   nvolt)seuoxmpiu1lmtemict sfaDta( oot0teenii3iasla ua(vpn(4alerxr3iy1oaDr ieil(  rtr(o iudap emfcsat)srumuro;o1aex mfeiytlmDrmums;t0tetnifcoydfmt  nvo (  exrxmpnydol elnctlt)aDrr(rpot0olx mo3ilslaDra( s (4tltnifcoytomD  ieo t) rurio3oo1ape  fciltf Draur oo4oexomf3iat m rlnmp u0arxrxrctodfm  an i;s) 2uo(m3iudameelfvi () 2rau o;u4tlto oetasfs eln o u0altrxf ty1op eaivi;s)s2xoir ou4opt lfct (fs2rrurpnu0oexnioeilt m rmump;()aeermo3iy1lmDeli o;s) 2xrir nudlpeelfcsltf rtm(r ;o4oexnmiciytfsDulu s;(0aexnio3ootfa eau slt  exmio3iodapeemfvsas a2taxmo;o1alxniieiysfaDeaumonu)aetrir iotfpte ieolt srxmim ny4lpenlict s)sDra( ont0oltoifeiytla2ul(vo t4alerioctadfpD lu o ( setmir oudaptn fei (f rrrurpoo0olen i3ilt mDuln on(0texnmfctatom e ueo;(0t2um(m io4alenmfcs t  rta(rpot4apxn fciadfa2eln s u4tltnmf oo1latr ieol()s2tm(o3ny1llt lfciasfsrtmumonu1tlt mieilslmDrl(mpnt)arenxo to1opDrlu i s  euoimpno4al elncsasfa2taxrpno0texn oeiatlm rm(vo;u)trxnmr todla   ies;s  rxoio ny4omeemfcsasfartrump;t0tetoioeiyt sDea(mo;(4 lxomf3tytlp e nei (0t2xoim3nydlltemivsat sDrru  oo0aetnmiciys m rmu p;u4aexomr3oydlatrauei t)seumiopiu1om e nvt s) Dtmx  nu4opeoio3ild sDelu o u0 lxnxr3tatoaD aueil(0teur(opiu1lmtn nvil(farraxro;t1tpxn i3tls a2umu pnu0tetrio oadlaDr n il()t2xrxo3nodlm  mietlt  Dtm(  oo4tlxoifciydfm2rm(ms;t4arxrmrcoydoptranvs;(0sruo(o nu1aleemiesl() 2taxmo;u0olxniieiad s2el(vpn(0tetnmo oodfaDrlnvi;s  rxoir3io4ome  fcias) Dtmu  ;o1oet moeilt a ulu ont)tetnmf iodfm ranvs;t t2xr(mpnu1ope mnesas)aruaum ou1tpe ifcildfs2rm(mo;(4trxoxr iotfatr ues;(  2to(mpoudol   ivsas)arrmxmpno1tlx ifcildfm2elnvpnu)trtnxr ootoptr nvslt sexoxmpoy4lp e ivi (  Dta(ro;o4oet micilsfsDem( o;()tlxrmfctodfa e uvsls0 2tmim3ou1lp e ivt ( s2umurpnu4aeenioeiasfs2rmn o;u4aeeoxo3oa1fptr uvi;(0 exmxm oydlm nmfci (f 2uau  ;t1oee  i3tlsls2emu o u0 rerir3oodoa e uvi t truoio3iy1lp n ivsas)a2tru o;o0apto ieiad a em( snt0tlxnxfcoa1la e ivo s0truoim3oudamtn fei tfsrrax oot4tpenifeiadla2umumpnu4aetrmr3ootfate u ils0srurxm iu4oltemfcsa(f Draxro;t4olxnmf3iatlmDulnvo;t)teeomrcto1oateaiesl(0setr(r ny4lp e iei (faDuax poo4teenmfeiasla2rmnvs;u4 rxnmfcootlp  livi ()setrirpnu1lmeemfes () 2tax pno4texn fcild s rl(vo u)alxrxocto1fa r ivs;s0s2urxo3iy4lm e ivi () rtau pot0olxn feildfsDuan sn() lermocia1oatrai i t0 exoir ny1apenlietat)a2ua(  ;o4olt mieiltfa2ea( s (0 exoxr ootoaDran i;s s2urir3no4lmee fvs t arumu ono4texnii3iyt m2emn ont4arxoio3oytlm eln sls  rxo(m3ou1omte nci s  rrru pot4oexnif3tatfa ul( p (4trtomr oodomtran i;() 2trir3iodomee ict t s2uau ont1tpx iicildla em(vs;u0 ltoiocoodla   uvs;()teuo(r io1om nmfes (fsruru ooo4aptoifciadfmDemnvp u0tlerif3ta1la  an sl( srum(o oy4op  lnct (  Draxm ot1opto i3iydfm rlumpnt)tetoif3iydlmD livs;t0s2tm(mpnudlmtnmnci tfsDur( pnt0tltnifetyd aDelnmp u) lxrir tytla elneo (0t2tm(r oodol   netl() Durump;t4opeo feias a uluvp u) lxrmo oy1fm e n o;t srum(opoydlpee ncsas) rua(mono0tlt  feiad m uau p (4 rtnmr oy1om elues;()s2urxo nodapenlnci tf 2rr(  ot4olt mfeiaslaDumn o t0 lenirciodopDraivo s)s2urio oy1lp   nesas) rrr(mpnt1oex mi3tlslm2emnvs;u0 etnmf3iotlaDe uvilt)t2uoxo iy1ame mieiat  Dtaurp;t0oltnmo3tat s2ul(mp u4aeermf3iy1lmteauei t tetrxrpoo1lmtnlfcslsfsrra(  ;t4oetomiciaslsDrln pnu4 leoxoctatfmDraivs;s0 eur(r3no4lpe  fcs t a2ra(mono1olxomo3tadfmDrau p (4 eeoio3iodfmD  i i;s srto(rpiu4al elfcs s a2tau  ;o0tetnmo3ilt m2rm( pnt)trtriocia1fp   i s t0trxr(mpou1lmtemncsatf 2rrum ;t1optoiiciltfa2emu p;(0arxrxr3ia1la eln ol( srxoimpiy4apenlnvtl(f Dtmum ou1opxo o3iysfa rlump t0alxrmf3oy1omD  u sl() 2tmxo nu1aptnlivsl(fsrtmu  no1tpenio3tys m2eaumpnt)artnmfcty1optr uei t)truoxr nu1al nlneias)sDtr(mpot1tptoiieiat sDeau o t4teerxfcoodla  li s;t  etmim3nydaptn ivsltfsrur(m ot1ape ii3iytlaDumnmsnu0arxrxrctydfat lnei ()t2xoio3no1optnmfeia(  2uaumpoo0tlx miciltlm emn s;u0arenmr3tytfp  lieolt) 2xmio3oudlmt licta(  Dtaur ;u1tlx  fciad m uluvsn(4 eerxo to1fp  lnvsl( tetmxrpiu4lptn fcs ()arumurp;u0tpe iieiyd m2emu p;u4 rxnmr oydoat aivi;s0trumxm3no1opeemiesl( srtru o;o1aetnmoetltfs ranvp;t0artomo3io1om eli ol( trurxo3ou4apt  nctas artr( pnt1opeoifetltfs2ulnvsnt0trxoxfciydom ranvslt  rtm(o3oy4amtn fetltfaDurur ;u1alx mo3iad m2ulums u4aexnir ia1om rlivo s0 ruo(opiy4apeelictl()a2ur(r ot4tleo i3iadlsDea( o (0 ltrxfctytlpDelu o;(0seurxrpiudolt liciat sruaxro;t0tleomietadlm2uanms;(4 renmo iytfaD aueslt t2tmio io4oleemnvsat arrmu  nu0apeo oeils a2rmumsn()tetoxr3oo1opDranvolt0t2xmirpnodape lnvtl( aDua(ronu1oeto ociltfmDeluvp t4altnio oatlpDelieo (0 euoirpoodamt mnctl(f rrmu onu1tleo oetytfs rmn onu)aetrxr3oatlpteauvsl()srxrio3nudll emfct (  2uaur nu1olt ii3iydfa2em(mo (0 etrif3oatfa ran o ()srxmim iu4lltemncsasf 2rr(  ;u0apxo oeiltls2rlnvonu0tetomo ta1lpD li i;t seurxopiu1lpt mfvsasfa2raumono4alt mfciasfsDrln p;() ltrmocoodoate ieslt0seuoio oy1ameemnvsa()a2trumpno0tltomoetydfa2ra(vp u)trenmf io1optr uesls0 rurxopoydlltn ivtas)aDuau  ;t1tle mo3tld mDulnmo;t4trerir oa1opD lu i t)setmxr3io4lpt miciat artaurpoo1tlxn iciasfaDemu p u0tltnmoctadopDeau i;s0trtoxopno1llt mfeiatfaDururpou4aee io3ilslaDrm(vp;(4aetomoctytfp  livslt  2urirpny1ope mivi s  Drr(mooo0aet  f3iydla2rl(ms;u) ltomo3oydom rlnvsl()s2xr(o iu1aptnlnctlsf 2umx  ou4tpxo fctyd s2rlu o;u4 lxomr iytfm   ies;(0tetoxopoo4omen fvsa(faDtr(mp;o4tltnmo3iyd a2eauvs;t4 rerir3oodla rluvo t0trxm(m oudam nlfeslt) Durxrpnt1ope mfeiadfm2el(mp;t4 lenmociotla e ivs;s tetoir3oo1ole mfeias) rum(m ot4openiietyd m2eanvs u0arxnmfciotlp eln ols0t2ur(m ny4alte ivt sfsrtr( oot4texn ietys sDemnmsn()trxrxr3tadlmDeaneilt0 exrio oydal elfciasfsrrr(mpnu0apt  f3ild m ua( s t0 lxomfcoytfaDraneo;t0 2urxopnydllenmfcsls  rumumpnu0tlxomf3ils mDel(vo;u4tlermfctydfpt  uvolt  rxm(r3nodam nlfetat)aDuru onu1alxo fcild m uln o;()trxriociodlmtelueil( s2xrim iy4lptn nciat) 2urur oo0tltnmf3iatfm rl(mp;t) etnmr3tadfat ai s t)t2umxm iy1op n fcsa()sDumxmoot0tpt  ietytlmDelnmp t0 lxomf ty1fm e uvils t2toio3io4apte ivsl()a2umxmo;t4tpenmf3tltfs2ul(mp;()aeeoxocoo1lmDeaueo;(0texoim oo4opeemictas)srua(rpnu4oltomociad mDea(ms;t4 rxomrctadlmD lnei;t0tetrir3oo4ap  mfvtlsfsrurum ot0altnii3iys aDem(monu4arerio3totlaDrliei t0 2tmxrpny4omtnmiesas)s2umu pno0aexnio3iydfa elu on(4 lermr totoaDeli o;s t2xoxr3ou4lleemfcs ( a2ururo;u0altn oeiydlmDelu o;u4artrmf iytlm eaneils t2urxr iu4amee ncsat  Dtmu ont0olto ociysla uanvp t0aleniocoy1omDeaueilt0teuoxrpiodomee fci t)srrm(r oo0tetoif3tasfs ea(ms (0artoif3io1fmtelneilt0s2tmio3ou4ll elfviltfs2uaxrpou4oltomfetad m2ua( s t) rxrxo ootoa   nes s) exoim oydal  lneil(fsDtr(m ou0tpto fctls mDumu s u0tltrmo oy1lptelivs (0trur(rpnudamtnmncsat)sDrau pot4tlt ioctydlsDeauvs;t0aeeniociatoa   iei t  2urxrpiodopenmfcilt a2urump;u0alt iictyt aDuanvo;t)texoxr oodomteluvs t0 rxmxrpnu4ll elicsl() 2tm( p;o1opx  fcildla2eauvpnt4alerio oodfmDeaueilt)tetr(o io1aptnmnvtat sruaxmo;u0ale mociatlmDumu pn() etoifcoydlaDe u s t  ruoimpiu4aptnmncia()aDtrxr nu1tlt  i3taslmDemu onu4aetoiocoa1op   i il(0seuoxo3iodom emnci t sDtmxrpno1tlxnmi3iasls rmn o t4trxnif3iotlpteli ol() 2xo(m3nodllen ieia() rtr(r nu1texomoeiltfa2um( pnu0alenxf3tytla e nes;s)t2toxm iy1ole  ics t)srurxrpou1tlto i3iatls rlnmsn(4aexoir3ta1laDr iei;t  rxrxr3oodomtemnvi (f Dtm(  nt4alxn ieiytla umumo;t4trxnif3iotoa  aivo s) 2toxmpiudlleelfctl( s2uaurono4ape if3tysfaDranvp () rxrxr3tydoaDrauei;t)texmio3no4ale  ieias a2rru  ;o1tpe ioeiadlsDrlnvs;t4 etnxo tadfpteaies;s  eurxm3oudlpenlfvtls) rtmu  nt4apxomoetys m2eluvsnt4tetnxo3tadoptr i i s)s2trxr oo1ame mnctasfsDtr(rp;o1tet iiciysfa rmuvp u)arxnmrciadfmDe i i;(  exrxmpoodlp  mnet sfs2rrum ot1oetnmietatla eaumsnu0aexoifcoa1lmDelu i;( texoirpiudlmenmfvsls  rur(  nu4oltoifciad m eauvs;(0artrir3tatlpD  nvil(  etmxr ny4lpt mfcil(faDrru  oo4oexo feiltfmDean pnu) rxnxf3iotop rln o;() 2uoxopnydape  nesltf rrmx ooo1tltnmi3tasls2eaumsnt)artoxf oa1faDr n ols0 rtm(o3nodopenlicsas)srtr(mp;t0oltomi3ilslmDraums;u0texrmf3tadfa  au i;s)trurxopny1om nlnvtl()sDuaumo;t4oltnmoetydfa2emumpnu4aeerif3iadopDraivo t t2toir3iy4optnmicsltfsDrr(mp;o4aptoifeils a2emumsnt0altoif iydoatrlnei;t0srum(m oodlpe  ivtlsfartrumpnt4apxoifetlt a2ranvpnu)alxnmo3totop rlnvo;()s2xr(r3nu4altnmnvsas)s2rm(monu0oexniietytfmDuau p;t4trtnmr3oydlp r n o (0s2uoio3nu4amte ieias sDtrxr ;t4apen f3iadfs rlu sn()texoxfcoy1oaDelivsls0srtmxr3nodomte ncs tf Dtmumpoo0opxoioctad sDelnmonu)alenxf iadlpDe ueilt0trtrio3oudopenliesl(fsrurxrpno4olxomi3ilt m elnvp;(4aexoio iatlaDr n ils texr(rpio1optnlictls  Duaum ot4oee io3tlsfs2em(msnu0texnir iy1lmD aueolt  exoio3iodol emncsl( sDtmxrpot1ale mfciaslm ran p;u0arxoir3totomDe neilt0setrirpiydapeelnct sfaruaxmonu4oleoiiciysfm2raumpnu0alenxfcoydlaD ai s t  exoir3nydop  mfvias srrmx p;o4apx  o3iatfs emuvo;()tetrxrciydlmD an sls  etrxmpno1olt mncsls s2taump;u1opt iicilsfsDra(vont4tltoxocoo1la r ivsls t2uoim3nu1lp n icsl(  2ua(roou1tpx io3iyd m el(vp t) rxomrctadoateaivi;s setrxo3no1omenlictlsf rumu  ;u1olxoioetytlm em( pn()trerxf iy1omD lnvs;(0 rtoxm nydom  mnvslt) 2uru  ;t1tpeo i3tysla ulums (0tlenircto1lm e nesl(0t2xo(o ny1ll   netasfarua(  ;u0olxomoeiytfm rauvp u)tleriocto1fm   uvo t sexr(m3iu4llt livil() rtau  ou4aet mociasfaDeauvp t4texrxf oo1oaDrlivo;()s2uoxr3nu1lptnmfctlt)a2tmxrooo4aeto i3ildfa el(mp;t4 rtnxo oa1lmt an slt0sexrir ny4ameemfviltfsDrmxroot4olxo oeiys a2eln onu)aeerxf iatfa  anvilt) etmxrpou1lpt lfvilt a2umumont0tlxoioeiyt a ea(vs t) rerxocoo1om   ivo s) rur(r3iu1al e fctasfaDtr(rpnt4oeeomieiatlsDemnvpn(4tlxnxfcoydfmtelnvilt) rto(rpno4ol nmncsa()a2tm( pou0optnmfetltfs ua(vonu4trtoxo3oytfmDrli s (0tetrxrpoo1lpenlfci tfsDtrxm ;u0tpeniietltlaDuanmsnt4arenio3oadoaDrliei;t)s2xrxo3nodlpenmfeil()aDur(m ou0tlto oeiaslsDemums (4tetrir tytfm raivsls)trxrxopiu1opee neiat a2umurpou1aptn iciatfa rluvs;()aexnxr iotfmD  ies (0 rur(rpiy1ll  livs tf 2rrumo;u4tlto octldlm umn p;t4 rxrxocoodoa eaies;s)seumxo oodapeemnct ( arrax p;t1tle mfeiysfa2rau pn(4 rxomr3todoatr ivs s0sexoim no1amtnmncs (  Dtmx p;t1tlxnmfciat s2ea(vo;(0trenxfcoytomt aieolt setrim3ny1amtelfct t) 2urur ;u4oltomiciytlm uluvpn(0alerxr3oytfptraueo;(0 rurio3io4lltelncs tf Draxm ;o0oeen octys m2emuvo;() rtnmf to1opt  nvo;s)sexmxr3nudlmeemfeslsfsrum(r ;o1aeen fciltla rmn snt0 etoio3ta1fmtean il(0srurim nu4omt  iesa(fsDuru pnu0oet  oeiydfs2ulnvo t4 lenio3iatfm   uei;s  etmir io4omen feta( aDtmx  nt1tlxn oeiat sDuanvpnu0trenmrcto1lmDe nvi t0 2xmxo iydolenmfvi ()s2ua(ront1apenmo3tldfmDrmuvo (4arermf3iytfat ai o;t)t2xoxm ny1lptnlicsl( srua(mp;o4oltoio3tas m2ulnvo;u4aetoio3iytlmteai ils)texmimpnu4lm   fvi tfaDta(r oo0oetoifciad s2ra(mo (0 exomf3ty1omD livo s) 2tmir nudomtemnvsl(fsrtm(r ;t1opxo ociys m umn snu)aetrxr3iy1lpDrauvs s)s2um(m ou1lpt  nvs ( srumxrooo4aex  feiltfs rln o;()artnmf3iydopDr i s (0srtrxo3nydapee fvt (f Duax p;o0tetniiciydfa2rln s;(4arerxr3tydlm  aneo;t)t2toio3oudlpt livta( srta( p;o4opx mi3tat a elump t0 etomrcty1la rauvs;()texrxm3no4omt mneiatfaDraum nt1tptoioeiydls uanvs;(4trtoxrciydom   nes ()s2umxm io4ape mnvtls  2tru  ot0tpxn feiatfs2uanvs u0 eenmf3totfate ivi t s2urxrpiy4am  livi t) 2ua(rpot1alx mfeiysfaDrlnmsnu)aleomo oytlp eaivi;t)t2xrio3nydlmenmfcias artauront4oetn o3tltfsDel( s u0texnmfcoydopD auvo;s s2tr(r3oy1optnliesat sDurur ;o1apxnmfciatla2elu o;t0 eerif3oatla r n olt  eto(r3iudolee feias  2tm(root4olt  ociltls uln p;u0arerxo oatlptr uei s)seuo(o io4lpe  fcs t srum(mpno1tpt  ietls aDrmnvsnt)alerxf3io1fmtrli s;t0srumirpoudom e feils s2rau poo0teeomoeiasla ul(vsnt)tlerircio1latr u sls srtrimpoudopt mivilsfaDururpno1teeoiiciadfs uaumo t) rxrxr tatomtrlnvi ( t2xoxm ny4lle mivil(f Dra(ro;u1texo oetlsls2rluvp t0arxomocto1fpt  uvilt  rtrxrpnu4altnmies s)sDuau onu0ape mfcilsfsDeauvo;(0 rxnmf tydfm  lnvslt s2um(rpiu1amen ivtas) rrru  no4texnmociaslmDrl(vpn(0 rxrmr totfaDrlnvo;t)seto(m3iodapeemfviltfa2ua( o;u1aeenmfeiysls rln pnu)artrxf3iy1optr ieo s0 2xoxm3ou4al nmnctlt)sDrmxmoou4aeenmfetytfa ul( p;u0aexrmfcoadoatelueo;t0 exm(m iy1ale mfesltf 2rr( oot4tpxoioeiys m2uln o u)tlerxo tytom   ieol(0s2uoir3ou4am elfei (fsrtrumpoo4ale mi3ildfa ea( p;()alxrxfcoytfmDrau i;s0trtm(o nudlpenmieslsf Durxrp;o1oetnio3ildfs2emn on(4trtnmr tytom raiesls trxrxm3oodlmen ivtat sDrmxmpoo4aexo fetasfsDrlu o;u0aeerir3oytfm elu s;s s2xrxo3oy1amtelivt (fartmx  ;o0tpe iietydfs2rl( p;t0trtomr todfpDeauei s)s2urim3oodlpt lnetas)s2rmumpou1tlx mf3iydfa2rmnmsnt4texnircoydoat  u i;s  etr(rpiu1ome  ivsl(  Drm(r oo0opeoioctltls2eau o;t4 rtrmf3tadlmDr neols) 2xmxm3ou4lm  lncilt)srumx onu1oet  o3iad s emu onu4aexrmf tydfm   ivols)tetmio iy4amtnmnvi s  rraur ;t1tltnif3iys sDuluvpnu0altrmocia1op r ieslt0truoio iudop n ivilt  Dtm( pnu1opx mfctys a eanmon(4 ltnmr3oy1fpteln s s)seumxr3iodolte ietls)srumuronu0tpe  oeiydfm eluvsnt0arxriocoa1fmt an s;s  euoio oydaltnlnesls  2taumooo1oltoifciytlsDua(msn()artnxf oo1lp elivo;s) etm(o iu1lpt  nei t aDtaumo;u1tetnmocildfm2um(mp;t)artrmr ta1fp  luvi;s setrim ou1omt liet sf Dtauro;o0olx if3iysls2em(vs (4 rtnmf oa1lmD lu ol( s2urim no4lm nmfvsat s2tmxmono4alxo oeiat m2emnmsnu) rxnmo3iytlpt au i (0 exo(rpiu4alt lfeilt srrrumooo0alx mfctytfm2rlumo;() lxrmocty1fp elu ol() 2uoimpny1amtemfcils)aDrr(rono4altn ietlslsDuauvo u4 lxnmf io1oaD auvs (0 eto(o iy1lpt lnes (f Draxr oo4oee ifetldla2uau o (4 leomo3ty1omte i o;t texm(rpnu1lmenmics s)artaumpnt4oexnifciyd s ean p t0tlxnxrctadlaD auvsls0seuo(mpoodal  mivtlsf 2umur ot4olxnmieiytla2rl(mo (4 rxnio oadlaDr u sl( seur(o3io4om nlfvia(f 2tm( pnt1tpenmictls a2elnvsn(4 rxnmf ia1om e ueo;s)s2ur(m3ou1lptnmivta() rur( p;u4optn i3ild mDea(vo;t)alenmf oadfaDr nes;(0seuo(r3ny1ape livtlt)a2tau o;u1tpe ii3iytlmDrauvs;u0 etoxo iydlpteauvsls teuoiopny1opt mfvt tf 2rru onu0oetniocils s elumo (0 exoio3iy1omDr ivi;t)texrimpnydolenlncsl(faDta(r oo1aetnifctlsla rm(vsnu4aeeoxf iadlpD lueil
\ No newline at end of file
@@ -0,0 +1 @@
+u o;t  rtoim3ny1apeemictat  rtaxronu4opx  ociatfmDuau snu) leomrcoa1fmD luvo ()s2tmxo no4lltelicia()s2ua(rp;t0oet mfctadlmDumn o t4artnxo ty1latrau il(0t2xmxm io4lme liviltf 2rmur no1aex  ieiyd mDrl(vs;u4 rxoxrcia1om  auvo t0t2toio3iudalte ncsas) rtmx ono4opt ifctatfsDrm( on(4 eenmoctodfm   u o t0s2uo(m3oo1op nlfesas  Dumumo;o4ole  f3ilsfm2umump t0alenir ia1lpDr ivi;t) etriopoudlm e iviatfs2um(mp;u1altoiociltfs2rl(vo;(0 reomf iadlaDranvi;s0srxoiopiodop   ivias)aDrru pnu0aet mo3iltfsDul( snu)aeeoio iytfmDrlivslt0srtr(m nodaleelivtas srra( o;t1apt  feias sDel( on()aexnmfciatlmte ivi;() etoxm iydapt  fvsa( a2tr(m no0alxnmf3iys mDranmonu) lxrxr3oadfptraueo;s)truoio nodope  fvils) Drrxm no1alx mf3iydfmDrau s (0tetnif3tatlm rluvslt0 2to(rpnodamt liet t)arraur ;o0tpenii3ilt s2ranmpnt) rxrxr3oo1lpteauei;t srtmxr io1amtn ivils  rumump;t1tpenmietlsfmDrl(vo;t)alerifctydop elnesl(0sruo(o3nu1am  micias)arurxmo;u1apxnmi3tltla2eauvs t4trtomr3oo1latelnvsl(0s2tr(opnodlpe  ivsa( s2trxmpnt4openmo3iatlmDuaumsnt4texrifcoadlaD lu ols0 2uoxmpnu4op elict s)sDtmxmo;u0tee mf3tysfsDua(mp t) lenmr iotlmDelu s;t) 2uo(o ou4opee ivtlsfsrrrxrpnu4teenio3ildfs eau pnt0artrio ia1faD luvo ( srxo(o3oydllenmicslt) 2urx oou0tpe  oetaslsDemnvs;t0artoif3iy1opt aneo;()s2umxm3io1amt mivt tfaruru pno1opeomiciytfa emnvpnu)alxnir oadlmtr ueilt0t2umiopnodll e fvsat)arumum nt0tet mf3iad mDeanvp u4trenmr3oodfmtrli o ()texrimpnudomee ivs ()a2rauro;u4tpto feiydfmDelu pnu) lxomo3iotfa rlnvols texrxrpny1ame mnct tf 2rrx  ;o4tltnmo3ild s rmu o;(0tleoio oa1om e i olt)trxoio3oo1opeelies s  Dumumo;o1olxo ieilt s2ulumo;u4tlxnmrcootlmDe n s ()teum(m ny4am n fct tf rra(mo;o1tex  oeiltfa2rm( s;(0altrmr3oy1lp elies () euoio3oudlp  lnctl() rtaumo;o1aee mi3tasfs ulu o u0arxoxociytlate nvo (  rtmirpoo1ape mfvtl() rtmum no4tet ioetlt m2ul(vs (4tlxnxr3oo1op e ues;t0srxr(m nudlp nlicia(fs2urxrpot4tlen ieilsls rmnvp u0 lxrxf3iadfm rlnvs ()s2xr(o3oy1op   ncs s s2raxmooo4oee mfeiatls eluvo;t) exoxf to1fmDrluei;()truoimpoudoltnlnct t aDumxrp;t0teen oeias sDeau s;u0artnif iadlmD anes;( trxrimpoy4lltelnctlsfaDrm(m nu0tpxn oetat m2ra(vpnt4aexrif3iodoaD ai s;t  eurxm no4ap n fetat) Drm(m oo0aptoioeiyd m2rmn p;()tlenmfctodfp  ln s;t0 eumxopoo1lm n ict s a2rmu pnu4tleo o3tld s2eln s t0 exrxrctatopDeanei ( trtrxopou1llen icsatf 2rmu  oo4apxniocilslmDelnvp;t4 ltnxr iytoa e ieo s) rxm(rpiu1op nlicil(f ruaxr oo1tltnii3tld a2eau s;(0aexoxf3totopD ln s;()srum(m3oodoltn ics s  rtmum ;u0olxnioeiys m el(vo;u0altrxr3to1fat anvi () 2tmxm3nudal  lfci sfs2taum no4altnmi3iydfa2em(mp (4 etomrctodom raieil(0s2xoiopiu4alen fvsltfs2uauro;u4oeeo o3iltfm eanmsnt)alxrmr3oadfm elu o t)teur(rpio1ap elfctatfaDraur ;t4oetoioetytfa eaump;(0 exoio totfm   neols t2um(opny1apt mfvia(f 2trurpnu0tpxo fciatls2rln sn(4 eeoxocto1laDr n slt truoxo3io1ome mfetas) Dumx pnt0apenii3iat s eaumo;t) lxnif3oa1lptrlnes ()sruo(mpnydomee ncsl( srururpou0olx mfciyd sDem(vo;()trerir tatlp  ln o;t0trxo(rpou1lp   fvi sfs2taump;u1apxn fciadls ean o;(4 exnio io1fpDrlueo;s0s2um(rpoy4ale  nci t  2tr(r ;u4tpx  o3tatlaDuln o t0arxnmf ta1lmD aneo ()texmim3iy1ome mnci sf 2uaumpou4opxo o3tasfmDrm( s t0arermo3tytopt  uvo s) ruoim3nydlpt  fes () Dur(mpnu0ape  feiatlm umuvp u4 lxnir3oatfpDrau ol(  2xmio3nu4omtn nvi t)s2umxrono0teen oeildfsDel(mon(4altniocoodlpte n i;s srxoiopoy1lm nliesls  Dra(ronu1tetoif3tatlaDrm( on(4artnmo3iodomtrau o;s)teto(m3nydal   fvs s)aDrax  ou0oexnmictlt sDum(mo;(0arxnmo iatomte i o;s  euoim3io4amt micsasfarrrxmo;t4tpe mf3tltlm2ulnvo u4teenir3oa1lpte ues;t srurim3nodlmtn fet s)sDrrx pnt4openmo3taslaDul(vsnt0aexrmoctodfp e nvo;s s2toio oy4lpt lnctls)sDumxr ;u4apxn f3tys sDul( onu4aeeoxr3iodlpD  ieo;t) exmxo3oodolt mnctasfartaur no4aetoiiciltlaDuauvpn(0tetoifcoodlmDr u o;s  2xmxo iodlp emnvsltfs2rmum ;o4altn f3ildfa2ulnvon()alxnirctadom eauei;(0trtrxmpoudoptemfvsatf 2tmumpno0oet mfciltfsDulu s t4arerxf3oy1fpDean ols s2xmir io4ap  lfeias) rtrx pnu0olen o3tlsfsDua(mo;u) rtnxf3tytfate ivi;t0 etm(mpou1lp n nvtat)srrmurpnu4tptoifeiad sDrluvs;t4altomfcoydlmt lueo ( t2umxopnu4apee iesasfaDta(ro;t1apeoiietatfa em( snu4 lxnxr3iatom  au o s0 rxrir oy1ole  fctl(fsDur(mono4tpen i3iasfa rm(mp t4trxoxf3oa1laD  ivs;t  2xrim3nodame  nvsls srrm(rpnu1tleoifciatfs uan s;t4 leoxfciatlate u i;() etoxr3oy1alte nvsl()srra(  oo4tee mieiadfaDea(mpnu0 ltoir oodfaDr nvs;(0t2toir3iu4ap emivtl()aDrmxmpno1olxoiieiytla2elnmo u) ltnmociydoa r ivilt0s2umxr iy1ll nlncsl(fa2ta(rooo4tex ifciytla2um(mp;(0altrxo oy1laD lu i s t2urxrpio4ll  liesa(  Duaurpno1olen i3iltlsDuanms t4arxnxr3iy1fp eaneslt seuoxm3no1olt mncsat)aDraxmpou1tex mietlt a2elums u)alxomocoatomDe nvs (0srtmxo iudlle  nvi sfaDumxrp;u0tex mfeiat mDeauvon(0arerir tatfp  aneo (  rto(mpou1ol emfetatfaDuaxmono1alt  iciydfa2uanvp;u)tetriocto1fmDeau i;(0srtrxrpiu1aleemfcil(fa2umxm ;u0aee  fciysfsDum(vo (0tltrxo3oydlmDrli s s0 exm(mpoudlmtelncsa(f Dur(r ;o0opx moeiatlaDemuvs t)aexoiocty1oa eauvs;()sexo(opno1lle lneil( aDtrxrpnu4tpx if3iltfa rl(vsn()trxnirciydlmD li ols  2um(m oy4lmtemfciasfartmxrp;t1oexn o3iyd sDrlumsn(4tetrxr3iy1oaDr ivs s)t2xoimpno4omte nctas aDrrump;u1tle  ociatlsDumu snu4tlxnmr oy1fm rauvol(  2xrimpoydamtemneia( arraump;o1ape iiciltfa2umnmo;(4alerio iodfateaivol()trtrxr3iy4oleemivs ( aDrmur oo0aetomocias s2rl(mp u0trxnif3ia1la e u o;t s2tm(r oodame  nvsl() 2rmur nu4aex mfciys a eluvp t4tltoxf iy1fa rlnvo;() eur(mpiy1ll e ivias)sDumu p;u4tltnifeiysfm rl(mont)aetnmfcoa1lm  anvil( srxoirpno1amt  fetltf rrr( ont1aetn f3iytfmDrlums t0 ltrxrcootlmDr nei;s) etmxr iy1llt  icsl()arrrurpot0optn ieiyt m ea(vs;u4 etrxfcta1fat lu ol(0trum(r3oy4olte ivil(fsDrm(mp;t4alxnmoctyd s uau snu) lxnmfctodlmDrliei t0 exoir iy1omtelfesl()sDuax onu0olenifeiasls em(ms (0 rtoxf3oy1lmDranes s)srtrimpou4lme lfesas sDraxronu1tptn o3ils mDuau snu0texrxr ty1op  anvi;s)t2umxm3ou1omte ncslsfarum(  oo0tee mieias aDum( o (4arenmr3oodoa r ivo;() rtmxm iy1omenmnvia(faruru p;t0aet mfciatfa2eanmo;u0 lxnio3oydla   nei;() etoxrpoy1llt  fcia(f 2umxmpnu1altomfeiyd m elnmo;() reoircoadfpD lnvo ( s2uoxmpiudlmt mietl()sruaxro;o4aet ioeildfaDrmnmp;()tlenir3iydoptranvils)texoimpoodope lnvt (fa2umx pnu1aex mo3tas s2eau p t4 rxniocta1lm r neo;s trtmim3ny1amtn ivtlt  2tm(m ;o0ope ioeiasfa rau s u0tlermociatfmtr iei t s2uoxmpou1apenmfvilt)s2uaump;u1tpt iieiyslsDeaump (4alxriociatlm  au o (0trtrio3ou4opee icsa( srrrumono1tlx  f3iaslsDel( s ()teeomf3iotlatraieil(  eumxo no4al e feilsfaDuau  ;t1aeto f3ias mDea(vsn(0trxnmf iodla elneo t0t2xr(r3iu1lmeemici ()sDta(moot0opxn oetltla ea(mo;t) leomocta1lptr nei s)trtoxmpny4lp nmfet s)s2ua(ronu1tlxomfctldlm ulu o u4 exnxociatop raivi t srtr(mpnodolee nvsl(fsDrrumont0tltn fctltfm2ulnmo;u) etrio3oatopt lnei;t  etm(mpoudape micslsfs2umxm ;t1altnio3ilsfs2ranmon()teenxocia1fa rau o;t0trxmir3oudol n ictls  rtr( pou1openmf3iatlaDem(vo u0 rxnxo todfaDr u i t0 2urxo no1am  lnvi s sDrru o;u1aexoiicild a rl(vs;(0 etnxf3oydfateaivil(0setr(m3oodlmeemfvils srurxr nu4tltomfetld aDranvonu0tetoxo3oatlmDraiesl(  rtmio3iudlltnlivilt arta(rpot4teeo fctls aDul( o (4trxrif3tytfm r nvols texo(m oydlpte nctl( a2tmuroot0olt moeilt a2ea( s ()trtoxf iydlpDrau s;t0 rxrir ou1alt  iei sfa2urx oou4oexn fciysfm2rmnvsn(4aeermo tatfpDr ivs s  exoir nu4lp  mnvt sfsDra(m ;t0alxn fctlsfsDrauvs;()trxrifcio1fpDeaivols0srurimpiy1optnmfvils  2umump;t0tet ioeiad s raumsnu) exrmocty1opt li o s0sexrio oydlm n feilt srua(  ot0alt mo3tydls rlnms t0 rerxf3iytoaD anvs;() 2trxopou1al nlicsl( aDurx  nt4aet mi3iad a2rmnvp ()aexrmfcoy1faD  ueilt) 2xrxo3iydome  fesa()arur(mpnt4tpeomiciyd aDumnvp u0arxnmf iotoat lnei ( trxr(rpno4amtnlfcslsf Dtm(m nu1oet iieiyslm2em( s;u)aexoxocia1laD  nei;s  ruo(o3iu1olt mnctlt  2um( poo1tltn i3tlsfm2ra(vs (4artomrcoo1fa rlu i s0teumxm3iudap nmneta() Dtmxr ot4tpx iiciatlm2ua(monu4 rxoir iy1fate ivi ()texr(o ou4lm nmicta(  rtrumpoo1opeomfciadlaDrlnmp;t)artnxociadla r iei ()t2to(o3iu1lptelfvia( srtm( o;u0teeniieils aDuan sn()tlenmo oy1lp e ieols trurxo nydlptemici sf Dtrxr nt1teenmoeiltla ra(mp u)artnmo oodla  anvol(0trumir3no1omeelncil(fsrur(ronu4oeenif3ils m ran s;u0trerxfcoytlp ran o;s)srxmxm3nu1amtn fvsl() rrm(mo;t4aee if3taslmDumnmp t)teerioctatfatr nvs () 2toim3nodllee icsa( sDrm(rpot1opxo i3iltlmDem( o;u0 eerxfciy1opte nvol( t2uo(r3oydlm  mivtasf rrax  ou4opeo o3iysls2rmn o t)treoir totfaDe nei s0trtmxo no4lp  mfcilt aDtmump;t4tetnioctydls2emn o ()teenmfctodfpDe i i ()trtrxmpno4om  mfctas s2tmu pou1optnifeiytfa raumont) rxrif3iy1fa e n o;s  ruoxm oydamt lieia()sDtaum ;o0apeoifciytfmDrl(ms u)trxnmr3ty1fpDr nvols)s2xrxr3iydomt lfcs t)a2rm( o;o1ape  ociadfsDumumpn(4arxrirciytoaD lnesl(  ruoxo3no4alt lnei t srururp;t0aeeoifciat m uau pn(4 rtrxf3oydoa ran il(0 2xo(rpoudoltnlfeiltfarrruro;t1tex moeiytlaDulumpnt4tlxoxo3tytlat  ieo (0s2toim3ou1lleelnci sfaDua( pou4aptnmieiltfsDeau o ()tltoio3iotla ean s;s0s2urxo nydopee ivs sf Drmump;t1apxnii3iasfmDua(mp t4 lenxfcio1latean ilt0 rtmiopoy4lptn nvs (fsruaxrpno0oexo ieiad mDuaumo;t4tetoxo ootoatr nei;s0teurxopoy4lm emnciasf Dtaxroou1oexnio3iadfaDrmnvonu) rtnio3to1fatrlueols s2umim oo1lpeemncilt) Drm( ont1tlenmictad s2rmumsnt0 rxnif3totoaD lueo ()s2xoxo3nu4lm n ieias a2ur(mpnu0alto f3iad a rmnvsnt)texnmf tydfptr ivi;t)s2xr(o oydal e fvsa() Dta(monu1opt mietatlaDulumo;(0trtnio3ty1fa e neols0trumim3iy4amt  fctas  2rmxr ;u4tpe ii3tysfaDeaums t4 rxoiocty1la e ivs t) etoxrpiu4om  lieil(fsrrrx oot1olxnmfetltlaDuan o (4tlerxo3tadopt aivs;( trum(m3ny4omeelneiat)artaum nu0aptomo3iat s2eauvpnt)teermfcty1lpDr uvilt)seurim ny4ale mictas  Dum( ont4ape io3ild s2eau o;u4 etoxo3ty1fpDrln o t0 rxmim3nydlltnmnctatfa2rmx p;o1tetn octys sDra(vo;t4tltnmfcia1fmDe uei;(0 exoir nu1lmenlivtasfaDua(rp;o4aex mfctasla ua(vpnt)trenmfcty1lmtrlu ils0 2xoim iydam  mfcsas)a2ua(rpot4olxo ieiltlsDemu o u0texomfcoatop  ai ol( t2trxo oy4omtelivtas srtmx  ou4olenioctlsls rlnms;u4 etnxo iydla e ivo;s t2trxr iy1opee fvil()sDtaxm nu1tlxn f3iyd sDumnvsnu0 rxnmr3io1lptean s s) 2xrxo iydole  feslt  rrr( pou4aptn i3iytfa2eln pn(4teeoircoo1op  ai ols s2xoio oydoleemict ( s2trumpou1texn o3tasfaDraums t)alxnmo3ia1omDe u o;s) rtmio oydapt  ies (fsDraumpnu0tleoif3iat a rm(vo;t) etnxf oytfa r n i;s0teuoxo3iydaptnlfcsa()aDtaxm nt0alx mfciatfsDranvp;(0 ltoiociodoatrlu s;() rxrio3oydame liciat)a2tr(rono0opt  icilt sDumnvo;(0 exrir iotfa  livs (0trtrxm3no4lleelnetas)aDuau ooo4tpt  o3iydlm2el(vs u0arerxf totopteau sl(  2uoio3nydomeelfeia(fsrtaxr ou1apenmo3iydfaDua( o;t4 rxoio tytoaDe n s;(0 exmim oodlmtelicsl(  Dtr(rpou0oeenifeiadla2elu o;t4 lxomrcoa1optelneil(  rtmirpoodlme mfetlsfs2ururpot1olt moetytlm2uau s;() exrir tadoatraueo s0t2xmim oo1lpe lfvi ()a2ua( ooo4oltn oeiat a2elums (4arxrmr3oo1omteau i t)s2xoio ny1lm  lict (fs2taurp;t0aee  octadlm2ranvs t0aeeoxf3ty1lat  nei t0 exmxo iodol  mivt (fsrrm(  oo4olenmfeiltlmDuan pnt0 rxnif ia1oa eln o (0setrxm iodoltelneta(fa2ur(mont1tpxomictadla uanvp t4trxoiocoydlmDr nvs t0texoio3nydlltnmfcs t s2tmu pou4altoioeiad m2um(vp u4arxomr3tydfp   u olt trumxrpnu4lmeelietas s2rmx  ;t0openifeiaslm2ranmpn(4tlerirctydlpD  n ols s2xmxmpou4olenmfeiat  2umx  ot4oexnii3taslm elu o;u)teerxo3oadfa   ies;(0trum(o iu4ome  nctl(fs2tm(rpnt0aeenmoeiltlaDrln s;u) rerif3oatfp rln s ( srur(opnu1am n neiltfarrm( pou1opxnmiciadfmDul( p;() rxrxr oy1lateauvils)t2urimpoodal  lict ()aDtmx  nu4optnmociytfa2ea(vp;(4 eenif3ta1om   u il( trtm(o iy4lmtelfvsltfa2rm(mo;u0oleomieild mDua(vs u) exnmr ia1lmDeanvs;s0sexo(m3nu4ol nmncia(f rrmuronu0tlxnmf3taslmDran s;t4teeoxf3oa1lpte u s;() 2xo(mpnu4olee feta(  rrax  oo0tltnmi3iatfmDeauvo;t0aetnmo3oo1lat  ivslt) 2xo(m iudlpt  ncia(  2raxrp;o4oexoif3iytla2rl(mon() etnmr3ta1laDeaiesls0 2xoxo3ou1ll e ivsls) 2umu p;t0olxo fetasfsDum(ms;u0tetrmf oydla r iei t) 2to(opiydamen ics s) 2um(mo;t1oex micilt aDulums;()arxnxo3totlp rln ilt setoxm3iu4lltnmfeslt arur(rpoo0alxn ocildfmDrluvp (0 eermf oo1op eaneo;()tetoxmpio4oltn ictasf Dur(rp;t4tltomi3tyt s el(mp;u4teeoio ty1fpD lnvs;t0trurxr ou1alt mneslsfsrururpot4apeomociadfaDuan p t0tetrxrctadlaD  nvo s teuo(opnydllt  feiat aDrrxm ;u4opt  f3tytla2um( pnu0tetrif3iy1fp e nvil(0 exmir oodam   nvi s) 2umurp;o0opxoio3iadfsDelu sn(0altnifctotlptraivo;(0setmxrpoy1lptemicia(fsDuru  nt1alxo ieiydfa2ra(vo ()tlxnxr3iydfaDean o;s0sexrxr io4lp eliet s)srrrumo;t1oleoif3iyslmDrlums;u)trermrcta1lpt anei t)s2uoio3no4omtemnetlt s2ua( o;u0oleoioeiadla2eluvpnt0tetnmrciodlaDr i ils) exo(r iodap n nesa( sDtm(mpot0aet moeiyt mDranvp;t0aetrmr3io1fat  iei ()seuoxr3io1lptelieslsf Drrx  ;o0aeeo feils m2uluvsn(4artrio3oodlp e ues;( teum(o3iodap emnviasfs2raumpou1tetnioetatlm2elu o t4 lermo3oo1fa  aueols seto(r3nodomt  ivs ()arua(  nu1apto feiydfm2um(mont4arxrircoytomDelnvs;t)tetoxo nudomtelieslsfarur( ont4tltnii3tydla2rluvo u4artnxrcoa1fmDr neo;s s2xo(r nudamtnlnetat)aDrax  ;t1alt iiciydls ul(vp (0tetomf tytlat liei;(0 rxm(mpnudaleemici s  rum( p;u4optn fcildlsDum(vp;t0 eeoirctodfp elu s t)srtmxm io1opt mfvt s)arurx p;u0alt  oeiad mDemn snu4tltnxocoodoaDe ivs t  rxm(r io1lme miesa()arrm(rooo4teeoiociytfsDum(vpnu4altrxo3todlmtranvi;s  2toimpoydllt lfei s  rtm(mpnt4ale iicilslm2umn o;(0aexrmfcta1fm  lnvs s trumirpoydlm n ictat sDtm(  nt4ope mf3taslmDulnmp;()aetomf3iytlaD luei (  ruoim oy4lp  mncilt sDua( o;t0tlen fciysfa ua(vp ()alenmr ia1fp eliei;t s2xr(rpoudlpen nvs t)srraum ot1tpxo fctyt s2elump;t)treomf3iadopt  neo t0 rxm(o3ny4am  mnct s  rtm(ro;t4alen i3iyd m ran o t)alerxo iotfpte ieslt trtm(m iu4al nmics (  2umxroot0oee micils mDem(vp;t0 exrxo iydfp elnvsls teur(o3no4ap   nvtlt s2rr(r ot1olt  fctysla2ranmo;u)trxnmocoodlmtrauvol(0srumxr3oy4ap elfvt t)aDtrxm ou1texn o3iys s eluvp;t0trtoxf3oo1fmtrlneil() 2tmxo oudoleemiesas)arurur nt0ole mfetatlaDrl(vs;(4 leoxr3oo1fmt li o (  euo(m3io1lltnmnetasfaDrm(  nu0opxoif3tasfmDrmnvp (0 rxrircia1lp r iesl( t2tm(opou1open nvi t)a2rm(  ;t1texoifetasfmDrm(vo;t0 etnmr iadop  aneolt tetrxr3oy1aptelnvt t sDuaxmonu1opx mfciys m2ua(mpn()aexrif3iadlpDeaueils)trumim no1ole mfct t arrau  oo0olen feiad a rlu pnu0tetrxo oatlp r ueo;t trumxopiy4apenmnvtlt)artrurpnt0olx  fciltlmDumnvo;(4trxnmr3iydfpDe nei;t srxrxopoo4oltnmict sfa2rr(mpnt1ape iietat sDrl(vont0aexnxr3ia1faD ai o ()s2trim3nudamt lfet t) 2tmx pot4aeto i3ildfs2rmuvo;()texnxo oytfpDraivi;s)sexrimpiy1opt mfetasfs2tmurooo0alxniictysfa uanvs (4altomrctadlptr ueolt s2toir3iu4lleemfvtas) 2tau pou0apx iieils m elu o;u0tetoif oatlm  aieo;s0 2trxm3oo4lpe miet t)arumx o;o4ale ifciydfs2umums;u4arxoir oy1lpt  ueilt0srum(r ou4omtnmiet tf 2ur(r oo0opto iciydfs umuvo;u0 rxoxo ty1omDe neo t0teur(o3no4llen fvil(f Drm(  oo0tlxomi3iysfm2eau on()tlenxocoodfmtelnvs;t)trxriopnydlp   nvt tfs2taumo;o1tleo ieiydfa2emumo ()texoifcoadfaD anvi ( t2uoio oodomeelietl()sDuax  ;o4tpx  ietadls rm( o;(0aexrxr3oytfmDranvs t trxr(opnodal  lieslt) Durur no4oltoiiciasfm ra(mo;t4 leniocty1la   uvs t0 eumxr io1lleemfetls)a2tm( ont1texniociatlm ua(mo u0aexomf oytla eln s s truoimpiydlptnlivi ()s2tmxmp;o0teenmieiad m um(vs;(0altnif iatlat aiei s)setoio3iy4olt  ivt t) Dtr( pot1tetnifciyd mDra(vp t)trenio3oy1oaDrauvo ( srxm(m3ny1lptelnct ()a2umxmo;o0tpen iciydfsDem(mp;u0alenxr3todfpDr i i;()t2uoxrpnydam eliesl(fsrtaumpou0apxnmi3iytfmDeau p;u4trermocoytom  lneslt)srtoimpoodopt licsls) rtaur no0aeeoii3tytfa uanms u0tlxnxf tytopte uvo s trxoxm3oy4lp nmieia( s2tmurpnt0tpto octys a2um(vo (4areoir oadlmDr uvilt0 etm(r3oydlpee iet (fartaxrooo1aexomfeiasfs rmnmpnt4 ltrmr3iytomtr i i;( tetoirpny1apt mfvi s)s2urx pot0opx iieild a2um(mp;t4aetnmo3to1oa   ues t  euo(m3oy1lp nmfcils  2ua( oot4apt mo3iyd aDranmp (0tltrmr ia1faDr ivilt srtoimpoo1am  lncias srraxmpot4tee  feiysfa2rm(mont0aexrirctadfpDeluvi s) rto(rpny1open ivtatfs2uaxmo;t4oex  ieildfa uluvon(0arermo3ootlptranes;( s2tmxr3iy1ape  icia( arumxr ;u1tpxnioctatfaDrl( s;t0altoxf iatfp rluvi s)teumio no1ol nmfet sfsDurxr no1tlxo ietysfm2ua(mp;t0trtoirctydop  aneo s)setmio nydape  ici (fsrrmu poo0teeo fetas a2rauvo;u4aexoiocoodlm  lu i t) 2xoxm3io4op nmfvsasfs2urumo;t1opxo f3iadls2ulumsnt0tltoxr iydfm rlieolt t2umxopiu1om emfvta( a2um(mp;u0aex  fetytls2ranms u) rxrio totoa eli i;t)truriopoo1amenlneil( sDtaurpno0aeto f3ilt s2rlu p;(0aetnmfcoytlatr u o s  eto(r3nu1aleelivils  2rmxmoou0ole  i3tyslm2eauvo u0tlenxr3ta1fatr n s (0t2uoiopoo4ome  nvi s sDra(mp;u0alxniieiydfmDumumsnt4teenifcoatlmteluesls trtmxr nodop nlfeta( sDrmu ooo4tpx mieiad a2rauvsn(0aeeomf3iy1oat an o;(0trxo(mpiy4llenmnct () rum( o;o4tlto feiadls2ra(mp u4alxomrcoydla  lueol( t2ur(rpoy1op nlnct tfsrrr(ro;u0ape mieias m2rluvo (0arxnmrcto1fpDranei;s)t2umxrpiudlp   ieils)aDrru p;u0tpxo ietysla ra(mon(0artrir3to1oat  ies;s0 euoimpio1al emfesa() Dta( oot0aetnio3iydfaDrauvsnt)tltomo oytoaDe u s t0t2xmim3iu4ame  fvsasfsrtaur no0oex mfetlt a eluvont) eenir3iotomt  nvo;s) 2urxo3oy1amenlfet tf 2ua(ro;u0ale ii3iytlm el(vsn(0altnirctydfa   nvol(0 2toirpoudom e fcsatfarurxrp;t1tlxomi3tys s umuvp t4aeeoxrctatomD li i t)trtm(r3no1lptnmiesa( s2uax ono4opxn fetasfs2emump (4 exnio oa1fa  au sls)srurim nu4llt mfvsltfsDuax oot1tetoiieiyt aDean ont)areoxrctytopDranvs;s) rxrim nu4llee nvtat) 2raxm ot0alen ietldfsDuanms;(4 rxrxo3oydlmt lieols)trtrxo no1lltn ietlt s2uaxm ot1tlxnioctyd aDumn o t)alxrmfcootlaD aues (0 2uo(m3oo1apte fet s)aDtm(mpoo4tpe iietytfa eluvp () lenifciatfa  lnvo;(0s2ur(r3oo1lpeelfes s)s2umxrp;t0tetn o3tys s ranvo;t0altoio ootoa eai s;s0s2tmxrpny4ll nlfet s) 2urxr oo1tlenif3ildfm2ulnmsnt)trermr oa1omteaneo ()trxrimpnydlmtnlncsa(f 2tmxm nu4aptnifctlsla umnvs u0 lenif tytlpDrluvi;()tetoxr3iy1lp nmfesa() rtr( p;t4openmiciatfaDrau on(0 eeniocoy1fptranes s) rxoirpiy1lpt mfetat aDuru onu1olt  icils s2rmu o (0aetnmrciadfate i o s0teur(mpnodlpe lnvilt sDra(rooo4tlxniiciasfaDum( snt)arxomfctatfmD aues s) rtoxmpno1amtn nei s s2tmu oou0tpt  ieiaslm rl(mo;()alxnmociadlm e uei s)srxmiopio1lltnmnvs s s2urxmoot1alx if3ilt a uanvs;t4texrif3ootlat  neo;t srxo(m3no4apt mfvta( aDtmx  no0tpe io3iys a ul(vp;(0aexrxrcoytfaDr uvo s) 2umirpiudllenmicil(  2tmxr ou1oetniocilt s2ra( pn(4 eerio3tytoaD  u ilt0texmxm ny4alt mfvt ()aDtrurpoo0ole ifciatlm2umn pn(0tltnmocoa1omt lnvil() 2urxr3nydope lfeilt srtmxmpoo0tltomfetydla2eluvsnu)trtnmociatlpt auvo;s  etmimpiydop elnci () Drr( oou1tee  ictasla2elnmp (4texrxo3ootfmtr n i;s0sexm(r3ou4lm emicsas) Dtaumpnt1olt ioeiyslm rl(msn()aeenxo oydla rau i s0teumimpoo4am   ictl(  rtrxmpoo0ale ioeildfm rmuvs;(0tlxrir tytfmtrlieolt)srurxm iodolt mivsl()a2uau  ;u0optomfctlt a2rm(vp u)altoxfcoydomtelneol( truoxm oo4alenmnctatf rurxront1ope  fetyt a2rau snu) lxomf iy1lat au s t)trtmxopoydlm elfcsls arta(m nu1texn o3iytlaDrmnms (4treoir ootom   ues s setrxo oo4alenlnesatfsrumxro;u0oetnii3ildla rmu p t0 ltoif iodlpt aueslt  2tm(r nudlpe  nei ( aDra( pno1olxoifciysfm2elnvs;u)trxoxrcia1oa  an sl(0t2tmio ny1lm nlfvt sfa2ua( oot1oee iociyd sDra(ms;u4 rtnmocoo1oa   uvi;(0 2trirpoy4optnlicsl(  rrrurpou0alenmociltfaDulnmon()trxomr3oodlpteau s (0s2trim nudole mnvils) rtau  ot4ope mi3iad aDeanvp;t0alenxo3oydfp elu i;s0srtr(m iodlm n nvia()a2ta(mpou1alxnmi3tydfmDuaumpn(4tlxoxf iadfpD aivs;( seurxr3oo1ole  ieta(fs2uru onu0ape ifciltfs2eauvsnu)aeenxfcoadoa  anvi;() rurxo iu4lle  nvi s srrm(ro;o1opxn i3ilsfa ea( o () rerxf3ta1fp eluvs;s  rtm(r iy1amtnlies (faDtm(m ;o1tpenioeilt aDrmnvp ()areomf iydlptr ivs ()teumxr oo1lleelncils)srrrx o;o0apenmfeildlmDrm(mont)trxoio3iydop  livo;(0trumxopnydapenmict ()artmxrpno4tlx  i3iadls2ua(mo;u)alenmocoo1oaDrln ols0 ruo(mpnudaleelnct (fsrumxrpno1tptnio3ilt m2ran s;(4texnxr3iodfmDranvs t0srumxo3oo4omeelivt sfaDtruroou0oexo feiat m eauvo;u4alenir oy1op e u o t) 2tmim ou1ol nmfes s a2rm(roou0optoii3ils aDuanmp t4aexomr to1fpte ueol(0 rto(m iudllenliet s)a2umu pnu1oexnmfciat s ua( pnt) leomfciodop eau i t0 rtmir3nu4ome lfei s a2urxmonu1tlxn i3iatfm ra(mp t) etoifcto1oat auei;( trtmxm3oo1al  mnvil( arrmumpnt0tlt  iciatlaDrl( p;(4texnir3iotomDrlivo () etmiopio4amtn netlt)aDtau  nu0oetnifcildfaDrmumo;t) ltrmo3iydlpteli slt0texmxrpoodam n icsl(f 2tm(mpnu0oex  oeilsls em( snt4 lerxf iatfa  an slt) rtoio3oydapeemfet s)s2rax pno4olen ieiltlsDrluvs;u) rxniocoa1lpt  n o (  eurirpou4om emnesa( arrr(rpnu0tltoifeiysfsDuanvp u)texrirctydfp r uei;s0setrir3iudamtemivtl() Dtmxrpot1texn ietas m uanvp t)trtoxoctodfatraieo;t0t2tmirpiy4lm nmnctat)srum(rp;u0tltomfcild a ulumo;t0treoxo iadlpDr n i;t srtr(opno1lme  fvs tf Dtmumpno1tltoiietatfsDea(vo t0 ltrmo to1lat ai i;t)texmio3ou4llenlnct tf 2ta(  ot1optn o3iltfs2ea(vs t4aetrmr tydlpt  uvi t  etrxm3nu4al  lneils a2um( pnu0alt  oeiat aDuln pnu0aleomociotlpD anvi;t setrir iy4lpe mfcs s)a2trx pno4oee  f3tlslmDem(ms;u0 rtoir oydfaD ai s s  eurxm3ny4al elneia(fsDua(m nt4oet mieiysfs2ea(vonu4texnir3oo1lp  luvol( t2toir iodame lnesl()sDumxro;o4tpeomo3iysfs2rmn o ()trtrmfciydfmDr n olt0trxrim3io4ll nmietl(faDuax oot0tee  ieiydls2el(vp;t4areomo oa1lm r ieo t t2xr(o3nydopen fesa()a2rru o;u0tlt mfciytfsDrluvo (4 etniocoadlmt  n i;(  2toir nu4lleemics t) rtru  no1oleo o3tadfm ua(vs u4 rtoxfctydlpDeaueo;() rxrir3no4om  mfvtl(  Dtauro;u0oetomo3ild m2uluvonu)alxomr oy1fpteanvsl(  rxmio3nydope lfvsa(farurumpoo1oee io3tlt a2rlnmo (4artrif to1lmt lnes () etmxo3oodaltnmfvtlt  rtaumoot1apxomiciytlm ul(mo () lenxo3oydfa  lieols0 2um(r3io1lp elivtat sDrmxrp;o0oexnmfeiadfs elu ont) lxoiociytopD aivs;(0texoxo3iy4lp  mies sfaDum(rp;t0oltn f3tasfs ra(monu4tetrxf3ootop raneols0setmio ou4omt lnvi (faDrrx poo4aexnmi3tysls eln p (0 ltrir3tytomt lnesls0 rumimpoy1lltnmiei t) rtrx  nu1olt mieiadls rmuvsnt0 exnxf3oytfp e uvi;t0t2xm(mpiudam   fci t s2ra(moou4aleoio3iltla2uauvs;u)trxomf3oa1oa eaies;(0 euoirpiu4ll emfcslt) 2rru  ;t0tet if3tytfs2ranms u)alxrmfcootomteln s;() rumxopiu1op  lfet ()srtrx ooo4optoifcilt a ua(mp;(4texnmf oa1la r ivslt s2toxo iu4om n icta()srta(  no0oex ioeiatfaDul(vo t) exoxociadfpDrli sl( srur(m nu4lmt  fcia(fsDrmxr ;t1alx ifeiysfs2rmu snu4 exnxo iy1fmD lu sl(0 rto(mpio4omenlieias)srrm(  ot1alxnmoctasls2rl(mo (0tltnio iydoa r u i;s)sexmimpiydameemneils a2umx ooo0olt iocilsfa2ul(ms () etnxf3oadfptelnvo ( teurirpou1lpe mnesas  2uax ono1oltomi3iat a2rluvs (4 ltoio3ta1op   n o s0s2umxmpnudalt  fcs s)a2umur ou1aptoifeiytlm2ua(vpn() rxrxociadom eaueils)tetrir3no4amte fet ()artaxmo;u4tpxn i3tas m emn pnu0 rxrxf3iodfat  u i;( s2xo(r ny1lp  lnctlt)a2urxro;t0tlxnmfeilsfsDel( ont0areomr tatfmt luei (0 etrim3oydom  mncs (  rurx  ou1apt  ictatls2rm(mo t0 rxrxo3iotoa elneol(0trtmxr iu1omt mncs s aDrm( pnt4aeto fctysfa rlump t4 ltrmf3io1omt lu s (0 rtrxrpoy4altnmfctl( s2um( pnu0apxn ociasfs2um( p;t) exrmocoa1fmtr ueolt  2ur(mpiydlme lfvias s2umx pnu4tlxomfcild m uln pn(4aexnio3to1lat lieols srxm(r ou4ale  net s  2rax o;t0ale  octld mDumuvont4 ltoir oatfm elnvs s0 rurxm3no4lmeelnetltfaDtmur no4tptoioeias aDelnmpnt4 exoxf3iotop e nes ( setoxo iy4amee ncil( sDta(rpnu4aet mi3ildla el(vs t4 rxoircoatfat  neils)trumxr3ny4altn fetlsfarraurpnu1aetn ieiadlm ran on() rxnioctodlpD  uvo;()t2tmim nu1ole  fvilt) 2umx  nt4tex ifeils a emnms;t)tlerxf totlptraies;()trxr(rpoydlme mnviasf 2urxr nu0apxn oeiytla2em( p () exnxf3oydopD aiesl( tetrirpou4omtemicta( a2tr(  ;u4opxo feils aDelnvpnu0trxnmr3tydlptraneolt)texm(mpnudoltnmici (fa2uaxr ot1olto i3iaslaDumums u4altoxrctatoaDr u il()seumir iydllt lncia(f Dtmuro;o1oetomoeiydfs emums;t4aleoircoytfa eluvol(0trtm(o oodllee net tf 2rau o;u0oexnio3iyd s2umuvo ()alerircoatopDelivs;(0 rxrio3io1lm e fciatf Drr(mpno1tptn icilt m2rl(mpn(4altnir tytlate ies s texo(m3nu4omen nvil( a2rmum ;t0oee  ociaslmDulump;u) lenmfciatlmDr nes;s)trumiopno1apenmivslt)artmxmo;o1aeeomoctadfm rl( o;()tleomf oa1omtrlnvo t setmio oy4ole  ivsatfsrraxrpou1tle ioetyt sDrl(vp t)teeomfciydlm eai o;()s2to(mpiu1ll n nvs ( aruau ooo1apt mieiydfs umn ont0 etrxo io1omDe neo s0 rxoiopno4ll e neias)sDrrx pnu0opt moeiadfa2em(mont) rxrxf3ootfmtean i;t) rxmiopio1aptnlnctl(faDrr(ro;o0apx mfeiyd aDrm(mo;()aexoiocio1opteai sl() 2trir nudolt lfvtl(f rua( pou4teenifctadfm ulnmpnu0tltrxo tatoa e ues () etoir3oodlm nlfvtls) rrmuroou0aetoiocilsla emnvs t)trxnxo3todomDeaueil(0sexm(opio4amenmnvs s)srtm(mp;u0tpe moetadfs2eau snu0 lxnif ta1lm rlnesl()s2tmxrpoydllt mfetl( s2trx p;u0aeto icildfmDelumo t)trxoio3oatlaDeanvols) 2um(o3iy1op nlivi sfaDua(rpno1opeo fetadlsDum(vp t)arxoxr oatlaDeaueo s0 etmxm ny1ll nmfcsat)srtr(r ot1teeoiieiys s ul(vs;u4trtoxo todfm rlivols0 2umim ou1op   fcs tf rrrur no4altomociltfmDulnmp;(0trtnmo oo1fmtelnvolt0teuo(o3oo1ap nmieil(fsrrrxmpot1oexo feiyslaDeanvonu) lenif oy1faDeluvi ()texo(o3nu1op nmivtls)a2ur(mpno4opt  fciyt a ra(vs;() eeoxociatop eau s s)sexr(r3nydop elneta(fs2tr(  no1opxniietydfmDul(vp;t0alxnif iotomtrliei;(0s2xm(r oo4lm  lics t)sruaumpot4oetoiictatfm em(ms;u0texrxfctodfmtelnvil(0srxo(rpnu4optnlivsl(  2ur(rpnu4tpxnmi3tad mDraumsnu)artoiociodopDr ies t srurimpou1amt mnet t a2um( p;o1aleo fciasfs rlnvo;u0arerif ia1oaD au sls0seuo(r3oo4ope mictas arraurpoo4aeenif3iasfs2ranvo t) ltoio3oatoa e n ol() rtoim iydaptnmici tfarraxm ot0ape mocild a2ean p;u4teenxr ia1lpDr ivo;( t2xr(m iy4al  lieta( s2uaxmont4texomieils s2ua(mo t0 etrxo3tytoaDe uvslt tetmimpoy1alt mneil()arrauroot4oee io3iytls2rauvs;u4 rxnxo oatla   ieol(0 2xoiopiodlpeelfet ()arumump;u0opt  iciyt sDean p u)tlxoxr3ta1op elnvolt texmxm iudamt  fet tf Drmxmpnt1olenio3tatlmDeln p ()tltrifcio1fatr nesls srumirpiu4lltnlivtl(fsrtrum nt0tetn f3iatfa umuvp;u) ltomf3iydom e uei s0srtrxopiu4lp  lfet ( srtrx oot4open f3iad a2ra( snt)treoxrctadoptelnvi s)t2um(rpnudape  nciasfa2rr( ooo4tpxnmociyt m rln s;t4trtrmf3oydop rli s;(0truoxo oy1ap  mivsatfs2uru pou4tpxniicias mDumu p t4aexoxocta1op eaneolt)t2xrimpoudllt  feils) rur(mo;o4texnio3iyt a ra(vp;u)tltrif3iotfa  aiesl(0 euoxmpoo1ll nmfcs () rurxrooo1alt ioeildla rm(mp (0teermrcoydlatranes s)t2uo(r3nodomt lnvt (  Dumxrpno1tle if3ilt s2ul(vo;(0 eeoxo oatfpte i o s  rurir oy1lmenmfvias)srtmxr no0tpx  oeiltlmDulnmsn() leoxo3iytfa r ivi;s0t2tr(opno1oltemicils) rtm(moou0aptniietas mDrm(vpnt4aetrxf oo1lpDr uvi;s)teuoxmpou1ole  fvsas)srtau oot4tlt ii3tlsfaDrmnmsn(4trerir iytfpD  i o ( tetr(o3io4ol  lnei s) 2tm(m ot1tpenifciysfsDrlump t) lenxo todlm  ln o s  etoxmpiudole  fvt sfs2umu ono4aptoiieiys sDemumont0teermf oatfmD  n sl() rxmxm iy4op elfcils)aDum( o;u0apx moetyt s ul(vp u0aeeomo iydfat aivilt0 exmimpiu4lltemfes t) Drm(ro;t4tetnmi3tldfsDrmuvo;u4tltrxocootfp eauvs ( trumio3nydoptnmicsa()sDtr(  ;u1tpxn ietyd aDel(vp t4trtrir3oodoat  iei () euoim3no4omenlnesa( a2raxrono0tlxnmfeiys m em(vp u0tlxomf3iy1lmDrau i s)trurxo nu1oltn fvils  Duaxm ;u4oleoii3tytls2ra( on(0aeermo ta1fm eau o (0t2um(m3no1al  mfesat)sDur(r ot1teeoifetldlaDuau p;u0tetrxfciytom  aieo;s0 2uoxmpiudamt lnctas)sDrr(r ;t4aeenmfciat m rln p t) etoxrcootlaDeln ols)trum(o3oydolte fviltfartaxrpou4aptnmf3iasfa2emnvp t0trtoxf3tadfmD anvo s s2tmxr3iu1al nlnetl( sDrr( p;o1aptomictldfmDrl(monu)trerif3tadfpD  n olt)srxrir3oo4op nlnei t  2rm( ooo4tlenioctld s ea(ms (4texnio3oydfpDr ues t0s2toim ny1om e fvs s) rtm(ro;u0tpxnmoetydfm2elnmon()trermocootlmD ln i;s0s2urim3ny1olt  ncsa( srraur ou4opx  f3ild m rlums;(4arxomo3tadoate uvslt0sexmxopio1alt mfet tfsrur(rpno0aexnioctyt aDuluvs ()altrio3iotoaD auvo;t0t2tr(o nu4open ivi s) rur( onu4alxnioctlslm2elu p;(4aexrxr oadfa eaieolt  rumxo3nydamte fetls  2tr( pot0apt  f3tadfaDumnmonu0 ltoxo iytomD lu i t)teuo(o nodlleelictasf Dtmxro;t4olxnmo3tyslaDel(msnt0texoif3oodfmDe uvo;(0t2xrir iu4amtemiciltfa2ta(  ou0tltomo3iat a emnmp;u4altnir3ta1lmt  uei (0 rxr(rpnu4optelnes ( srtrx oot1tpt ifeiysfm2eauvonu) leoxf3todlmDraneo;(  euoio3oo1lle livs (fartmxro;t4aeen o3tlt sDuauvo;(4alerir iotlmD  uvs s0 2xr(o3iy1amtemicia( arrr( pnu0teeo ieiatls elu o;(0alxrxf todlpt ln ilt)texo(r iudamte ietat) Draxr nt4aee iietydls2ranvs;t0 lenxrciytfatrlneslt)sruoim ny4llt lnet s) rumu pno0tleomoeiasfa uauvs (0trenxo3iytlm  au o;t)texo(r nu4ll nmiesltfaDtmuro;t0aet  i3iaslm ea( onu) lermo3totlp r ivs t truoirpiodop e ivtat  Duru  no0tlt mf3iys aDrmu on(4 etrxo3tadfpteaueol( srtm(r oudamt  nvt tfaDurxmoot0tpeomfctadfs el(ms;(0 rxnio iy1fatraivs;t trxm(opnydope  icsas)srtmxrpnt1apeo ictlsls umn snt0trenmo to1fp rlu ils0srtmir nodlmtn nci t aDrrum nt0openio3tltlaDeluvsn(0teeomf3ootoat lues;t) 2uriopoy4ole livias  rrmxmpou4ope mociasfm2el( o;()aeermo oodomt anvols trxoim oydlleemicia(  Drmxrpnu1tlxo ieilt m2ranvs u4 ltrxo tatoateanvi;t t2toxr3nu1ll  mnvsltf Dtrumpoo0opx  ocildfm2em(mp t)trxoxf3iy1fm  auei () 2xoxopiodlle  fetat)sDrm(mo;o0oetoifeiydla elnvo;u)texnxo3oodoatr nvs s0 2trxo3oydome mivtlsfarrrur ot0alx mocildfsDea(mont)arxrmf3oodopDranvo;t0t2tm(rpiu4oleelnet sf 2umx  no1oleomo3ilt m raums;u0 etrifctotomDeai olt  2xrim no4apee fesa()a2rmxrpnt0tlxnmfeilslsDem(vont0tetnmr3io1lmD ai s t t2trirpnydol  mfes sfarurx o;o0oet ifctatfa2eauvsnu4altnxocoytfm r uvi;()t2tm(r nodlpe lfvslt) 2uaxrp;t0oexomi3iadfs2uau o;u) eenmfciytlpDr n i;s t2um(o iudlptnlfvtl(fartru poo1olx if3iadlsDul(von(0trenmo3totfp rau i;()trum(r3no1ol nmnvsls)s2ra( p;u1tlt mi3iltls2uaumpn(0tlxoir oatlp e ivo;t trtrxr nu4oltemncs ()s2tr(m oo0apt  fctytlm ulnvont)aetomr3iotoptrauvslt  rtrio3nu1olenlncils  rur(mpot0tleo o3iyd aDuau p;(4arxoir iy1lp eaueo s  eur(opnydapt mnctat)s2tru p;u4teeoif3iytlsDemnms u4trenircootfp elneol() rtmir iu1ame mnet tf rtrur ;u1apxnmfciytlm2ean s u4artrmr3iy1op rlnei;t0t2xm(m3oodal nmfctasfartmumont1texnio3tas a umuvsnu)alxrmo3oy1fptelivo s)seto(opiu4amt  iet tfs2ra(rpou0tpeo ociasfm2ul(ms;(4arxnio3todfm elivil( s2um(m iudlle lfciat)sDuauroou4apxnmietysls2rmnvo u4trtoxfctodlp   ueo;s0t2tr(opnu4ame lfesas) 2umx p;o0optnioetyt aDel(vont) exnxfcta1la eaies;()srumirpio4apeemfci s) rrm( oot1aee  ictaslaDum(mp;t0tlerir io1faDrauesl(  rtmio3io4ap  mfes ( aDra( ont4texnifetytlm2ea( snu0tlxnifcoadlpDrauvilt sexrxm3oydape  fet t sDur(  ot4oee ifeiyd s uan on(0 rtnircoodfmD  ivs s0 exmxo3nudam elics ( srua(rono4alto ieiytfmDrlu on(4teenxo3totla ean s;s0 eumimpiodam  mfvi s srrm(rono0optoif3tas s ranmsnu)aeeoxrcto1fmD livolt  2xoir oo4omt mfvt sf rtrum ;o0oee  i3ias a2umumpn(0arxnio ta1la r uvo;s0s2tmio3ou4ameelnvslt) 2ta(  ;u1aee miciatls rl(ms;t4arerxr3iytop e uvilt)s2xoxm3oydolt  ies s  rtaumpoo4ole mieils a2eauvsnt4 etnmocoa1oatr u o;(  exr(m io1om emnctasfaDrm(moou0tetoifetls m em(mp;t4altoxrctotlmt li s;t)trxo(o iudameemfctl(fsDtaumpno4aptomfeiytls2rl(mon(0alermocoy1op   nes;t  euoim3ny1ole mnetatf 2raumo;t1aleomociadfs ua(vsnt)trtomf3ia1fm e ieils  2xr(r no1amee nvtasfa2rm(m ;t4opt mfeiytfa rmnmo;()texnxrcio1fm rluvil( texo(m iodapt  feiatf 2um(  oo1apt ifeiysla2umuvs;t0altrxo tadfatelivsl(0trxmxopio1ll  mivtl(  ruauro;t0olx micilsls2ean s;t4 renxoctytfa eau o;s0teumir3nodlmt mnct s aruau p;t1alxoifeiytfa2elnvp u) rxnmf3oa1fa   nvi (0t2xrxopnodolt liei s  Drrxrp;o0oex iiciltlaDrluvsn(4trerir3totlpt aues ( trxm(o3nu4omtnlies s s2rm(mooo0opxnio3iltls2ul(vsnt0 etnmfcoa1lpD livo s) 2xoio ny1lmt mfes t  rur(  nt4tptn fctyt mDeluvs;(0 eeoxf3io1optraieils0sexoxmpio1llenmnciltfsrrrurpot1tpeo fcild m2emumpnt0arenxf3oo1fpt lnei;() rxrxmpnydll emfvt ()srtr( oot4oee  oetadlm ea(vs;u) rerio oodop elieo;s) eur(m3iy1amen nesa( a2rmurpnt1apxniociasfa2ul( onu)aeeoxr iydlpt lu o;() etmio oo1oltn ncsatf 2urxront4aexn ieilsfm um( sn(4 eeomo oadfaDean i;s  eur(rpio1ol  lnvils  2ua(mo;t4apx if3tltlaDeaumo;t)tltoxrctydoatrlies t sexo(opiu4ape lneiat arrrumpno4tet mfciat sDrm(ms;u4aexrir3iodlpt  ivslt) rtoxr3ny1amenlfeils)sDtmu poo1alto i3iatfm2uan pnt0 rxnmrctytfaD an o t)t2xmxmpnydaptemnvta(fsrtaumonu4tlxomoctls a ea( snu4tetoif3to1fa   u s ()trtr(m ny4omt mnesatf Dtau  ot0teeo oeiadfm emumo;()teeoio oa1fat au slt trumxo ny1apee iesls)srrau ooo0tpx  oeiyd m emu pnu4 ltoxr3totfmD  n o (  2xrir3io4ll  mfctlsf 2ta(moou0oet io3ild s2umumonu4tetnio tadom rlivi ( t2xoxmpiodop  licsas) Dur(mo;o0tle mf3iatls rmumo u4 leomfciatlpDeli s s) 2uoir oydlmen nctltfaDtru  nt0tpe  fetytfm2rmuvo u4artoxocty1lpDeli i;()tetmir iy4amt  iesasf Dra(mo;u1oeeoiieias a2ran snt)texnxr3tydfaDrlu s;t)trtr(opnydop nlieil(farra( pnu0olxoii3tltlaDum( ont0arerxfcoy1faDrli sl(0teto(rpoo4apt mfvta(  Dtm(  ;o1tlt mociysfm2ea(ms u4 renxfciodfatr uvs;s  etmxr iydapenlnet ( sDtmxm nu0altn octlsfs2raump;(4areoir todomteaivs;(0 rtoio3oo4opt  fvtls  Duaxrpnt4teeo f3iysfm rm(ms;u) lxrxo iytlatelivo s  2trirpny4lltnmfci (fartmxrp;o4aee mfctatfm rm(mpn(4texoxf oydfa   ueo (0trtmxm iydapt lfvi s srtrx pno4tlt ifetldlm rmnvo;t)trtnmociy1opte ivols)t2umxo3oo1omtelfct tfsruaxmo;u1opxnioctas a2ua( snt)aexomfctotfmt lnei s  rur(rpoodapeelieils)sDrr(  ot0altnmicils m uluvp (0 rtrmf ia1lm   nesl(0 2ur(m iu1lptemnesas  Dumu ono4tptnifcias a2ranmon()tlerxo iodfat lu sl()t2umio iy1lle mnetas) 2rax oot0aleniieiltfm2elnmp;(0 reoir ootoate u sl()t2xmxo3ny4lmtelfcil(fs2ua(r nu1texn f3tlt sDuanvp () rxrifciadlmDrluvo;()s2xoxm3nydop e nes t arrru  nu0tleniiciytfaDum(vo;t)arermr3iatlmtrlnvsls)teum(r no4omte iesl()sDumu p;u0aetnmiciasla rauvsnu)teermociy1fmt lieo;s  eur(r3oo1amtemivs ()arra(mpou1aex if3iaslm2um( o (0 reoircoo1fmDr uei ( srxrxm ny1alenmicsat) Dumxmoot0oetomiciytlsDul(mp (0arenxr3tytom ran olt0 exr(opiudlpen fvtl()arurxrpnt4aetn fctydls2rmumo;u0tetrxf3oadoptelnvi s) rurxr nudaltn fciatfaDur(r ;o1apt  ieilt a em(mp t0arxrxrciotlpDrlivi;t  eto(opoo1olee iei s)s2uaum nt4oeenioeiytlm2eaump;t0 rxomf3oadlateanvi;t)t2ur(r3nu1alen nvs tfs2tau ooo1oex  feiad s rlnvs;u)texnxo tatomDrai o t  eto(opoydome mfeilt aDuaxmo;u4teeomoetys m2rl(von(0 lxoxo iydomD  ueo (0 2um(o3oudopt lnct tf Durxro;u4aexoifciyd a elnvon() etnmrcia1omD lnei t)t2xoxrpno4aptemncsl(f 2trumono4aexo feiat m rl(vo;t4tleniocoatla eaneo;s seur(m3oodlltnlfetat)srrrxr ou1apx mfctls aDem(vpnu4teeoxocoatfm  an o;s seur(o3iu4lm e nci s)s2rrx  nt4opt moeilt s rl( s t0alxoif oodfmtranes s) euoirpnudlp   nciltfsruru o;o1oetniiciytfm ra( o;t4areriociadomtraueo;t0 euo(o3no1lltelicilsfa2tm(rpot1oleo ociltfs ran o (4 lxrmfcootfa eaues;s  2umir3no1lmtn fctls  Drmxrpoo0tltoiictlt aDel( pnt0tltrxf tatfaD aivslt0setr(o ou4am nmfviat aDtmxrpnu4tpxoioeiyt a2umn o;t4 etnmrctydlmtrai s;s0truoxrpoo1ll   fesltfsDta(mp;t4oexomo3ilt aDel(mo;(0 lenifcoy1fat  nvi;s  2uoxo3nydlltn fctltfs2urumpot0aetnioeiyt sDum(mp;u4 eenxr todlpDeauvo s0teuoxm iy4opt  ivias a2uax ooo1aleniictyt sDelnmo;t0 lxomo3iydom rai i;t) rxmiopiy4op e iesa(fa2rm( p;t0alt iiciyt sDelumon(4 rtnmoctydlm  ai ols)texoirpnu1lltemnvi sfaDrm( pot0optoif3iaslm2ua(vpnu4alerif totlaDrauvslt  rto(o oy4lmt lnvsatf 2um(mpno4opxomieiysfm2ranms;u4tleoif oytoaD  nei;s)s2uriopou4ap  mnet t)s2tm(rpot0opx mi3iasfa rl(ms u0 ltnif ootfmteaivo;t)t2ur(rpoy4op   ivta(fsrtaxmpoo0olx ifetydlsDuaums;(4tlxoif oo1lm rlieo;( t2xo(r io4ap nlnvta( sDtmxro;u0aptnii3iad m ranvonu0 exoio ootomt ai slt)sexmimpno1ol  lietat srrmxrp;t4alt ifctltfaDea(mon(4 lxoxrcootomD aivs;()tetmxr3iudlmen nvils) Drrxrpoo0tltoioctltlmDrm( o t)texoifciytlaDe uesls0seurim oy1amtn ncs tfa2rr(r nt0tpxomociaslm umums;() rerxo oy1faDrlneo;s)s2uoxo no1lmtemietas)sDraxm nt1apto octls sDelnmsnu4 lxoio3io1omt  i s;t0 rtrio3iy1amtnmiei (faDrruro;o4tltn i3ild s uanvs ()tltnmrcia1fp rlnvi t  2xm(m3io4alt mncsa() 2rm(monu1tetnmociltls um(vs;u0aetoif oydfat  nvi;t)tetmim iy1ap  mietl( sDuaum no4apen feiatfs2rau o (0aetnifctydlateli ils)trurxo3iy1lptelnviatfsDrruronu1ope io3tadls2uan o;t)treoio3iatlat anvo t  rumxm nodaleelnei s arrrxmpno4tpeoii3iyt s ua(vp;u0 rxnmrcia1oateai i ( t2triopny4ol eliviat) ruaumpnt4oexo fetasfsDumnvp (4tetoxo3oytlpt aivo s0seuriopnudaptn ivi t sDrau onu0opt  f3iyd mDrlu o (4 ltrir tydlatraueolt0srto(o3iu1llte fviat) Drrx o;o0altnifeiyslm umnmo (0aeeoif3ootopDeaueils)t2xoxm3ou4lp e ieias  rum(mpno1alt iociasfsDrlnvs t)tetrmfcty1oaD  n s (0 exmxopny1ol nmieilt) 2uru ono1olx if3iysls2uauvonu0 rxomr oytlaDrli s;t)teuoxopiu4om elfeiltf 2umxr ;o0oeeoioeilslm2uaumo u0 ltomf todlmD aueils)setm(o oydam n ncs s  rtrxmp;t4olen ictlt m uanmo;()aetrif3to1lp rau slt  rxrxo nu1alenlivt s sDtmx  ou0ole ii3iltfaDea(vpnu)aetrxo ty1oat lnvi;()s2toiopiy1altelfcilt)arurxro;u4oeenifeiadlmDrm(vsn() lxrxr oo1oaDrliesls)s2xm(opio1ap nlneilt srtru p;t4oeeomoetldla2elu o u) rtrmr ootlaDr ues t)t2xo(m3ny1ol elfetl(fsrta(m ;t1tptnmoetytfa2rl( pnt4alxnmrctadfp  ln i;s0s2xmim iu1alee iviltfs2uaumo;t1tex io3iad m2uau o t4aetrmr oo1fptrlnvs;s0tetmxopoodomt lfeiltfa2tmxm ot0alxn f3ias s umump u)artnxo oytfaD li i;s  etoxr oo1ol emfvi tfsDtrumpnt0opxomf3iltfaDrln onu4teeniocto1faDeauei t0s2xo(o
\ No newline at end of file
@@ -0,0 +1 @@
+neslt0 rtr(m3ou1llenlivs s  Dtaum nu1apx  f3iaslmDuaumo t0aetrmf oatlmDe i o s) eumxmpnudlp emfvsatfsDtr(rp;o0oltoiociyd a ulu s;u4aexoir ia1faDr uvs ( s2urxo iodlleemncsa()srur( pot0aexn i3ilsls2ulu p ()teenio3oydfpDraneo;t sexrirpiu1ame  ivi t a2rrumont1tpxoifcilsfm2ua(vsnt)altnxf todfpD anvols)trtmxrpny4alte fci () Dta(  ;o1tetniieiltlm2elumsnu0 exoxr3tytopD anvi;t) exmio3ou4optelieslt sDrmum ;u1alt mi3ilsls2umnvpnt) etnircoa1fa  aieo;s) 2xoir ou1am   nes (f Draxrp;u1teen ictldlmDeaumo;u0tleoircoatfm  lneslt0 rum(rpiu4alt lfes tfs2umur ou1tpenii3iysls elnvs;u) rtrxf iy1lmD  ivi;(  rxmir no4ame mivta( s2ur( poo0olxnmfeiyt sDra(msnt0aeeomfctytlpt  nes;s)srxm(o3nudaltnmnciatfartr(r nt1openiieias sDul(mp;u4 rxrio3tydfpte n o;()srtrxrpiudame mfei ( sDur(  ;u0oex mi3iydla2ulumonu4 eermfcto1fmtrli o t texoxm3ou1am nlnvtasf rtrum ot0olx io3iatfm2ulnmpn(4trxrmf oy1lpD  ues s0sexr(r oodllee netatfsDrr( poo4alenmf3iys mDrmnvonu0 etnxo3iodfp  lues;()trxoxo3oudaltn ivt tfsDtrxrp;o4tetniiciasfs2uauvs;t)teeoif ia1oaDranvs t  rumxmpno1amtnlnvias s2uaxmono1alx  fetltlaDelumo u4tlxoxrcoydom r u o;() rxrxr iu4alee fesltf 2tmurono4tee mieilsfsDelu pnt0artrxocoadlm   u il(  euoir3iy1ome lietas aDtm(rp;o0tpxomfeiyd m2uauvp t0 rxnmrcoodoate uvs t0trxmxr nodome mnvtasf Dtru  ;o4alxn oeiadfm2ranvsnu) etnmr iy1fm r ivo;(  exmim iydlpeelfvt ( srrr(rooo0alxoio3iyt aDemuvsn()aexrxf3tadfa ean o t0t2urir3io1llenliesl(fsDtr( oot1aetomf3iydfsDranvont)trenxfctytoa rlnvils teto(mpiy1lptn ncslt s2raurpou0aex  iciadlaDelnvp;t)trxnircta1lm   n olt0teuoimpoydlle mfvi ( artau o;t4tleomociat a2rau s;u0 ltrxf iotlmD ai s;()texoimpnydapt  fcilt)srurxmo;o4opeo iciyt a2ulumo;t4 etnir iadlpDe nvs t0srxo(mpoo4olee nvsa(f rrmx  ;u1oetn ictas m rlnmpn() eeoir oatom  lnei () rxm(m oydlmeemiet () rrr( pot1optoiiciadfsDeanvo;(0tltrmo3oodopDeauvols srtr(rpoodol e fetl()artau pnu0oetnifetysfaDrl(vo u)tltoxr oa1omtr i i t)trtm(opiy1lmtnlfct tfsrrax p;u4aetomoetytls2em(vo ()altnxfcootoat auei s) 2xmxm iy4om elnvsat srtr( p;t0ope  i3iyt sDel(vs;t4alerir iotomte nvo s0s2tmim io4omtemfcias s2raur oo0tetomfetys s um(vs;u4aexoxoctadlat  nvo (  eur(r3iu1llenmfvt ()a2tru  no1alen fctltfmDumn pnt4trxoxrcoa1lmD liei;s0 ruo(r ny1lm elieilt  rtmx p;o0alxomf3ild mDemnvo;u)altrif3tadoaDe uvi;(0 2tmxo iu1om elivsls)sDur(mp;o4olt ioeiatls umu s;() rtoxr oatlpt anesls0s2ur(r ou4opte fcil( arrru  ot0tpenmoctltfs2umn snu)arxoifciydopDelues (0srtmimpiydolen ivt ()aDrruro;t0alxomoeiltfa2uluvsnu4 eeomr oatla e nesls)trtoxr oydolen fetlt  Drmxm nt1aee iietat s2em(vsnt0 leomrcoo1opD  u ol() 2umirpou1ale livilt sDtr(monu4alxn ocilt mDulumsnt)teenmf tadfat  ues ( sruoxr3iu1alenmnet (faDtru onu1tltoifeiad s2eau p t4arenxr todfa eauvi;t  2trim3oy4lmt lnct t a2tru p;t0opeo icils s rmn o t)altnxfciytomD lneil( seuoir iy4alenmicslt)s2raxrp;u1ope ifctls a um(vpnt)tlxoir iatoaD lu o;t)t2uoirpoo1lm nmfctas)s2raum ;u4apxnmo3ildfa2ulumont)texnmf3iytoa   uvi;(  etm(m iu4lm  lnetasf rua(m nt4aee  fetlt a2rmn p t4alermfciydfaD  nvols)seumiopiudlm  mietatfsDtau o;u0tleo fcildfaDrmnms;u0tetoifctytfmDe ivilt0 etrio no4aptelfct ()sruaxr ot4opxomf3ilslsDulnvo;t)aeenxocio1omte ieo;t0 2xm(r oo1ll emicia(fsDrru o;o4oexn o3tysls2rmump (0alermr oatlpteln i;s s2xmio oodal  mfcias srtmx ont1tpxo fcilslmDulnmp ()teenirctotopteanei t0 rtrxm io1optnmfvtl(fartr(r nt0tltomiciydfm el( o;u0aexoir tadomteaivs;s) 2trxopiudlltelneia(f 2uaumo;o1aeeo ociydls2rauvs;(4alenifcto1fa rlu s;t truoio no4ope  nei tf 2rmxm nu0tpxoio3ild s2eluvpnt0alenmocoo1fmteanesl(  ruo(o nydlpt lfcia(farra( pno0apt  icilsls umuvs;(4 lerxociodfaDr n o;s) rxrxm no1ole miesls) Dtru p;u0alxo fciatls2rm( sn(0 rerxr3oytfmtrlu s s)trumimpnudolte nei () 2tmumoot1texoifctltfa2ra( pn(0arxomo iodfaD au o;s  2umxo iu4lp emfvsa()a2rmu pou0oexoiiciyt m ran pn(4aexnif3ta1laDr ues;(0srtoxr3nudlp  mivi (fsrrm( pnu4altoiociadlm eauvp ()trxomociatlm   i i;t)s2xr(mpny4ame lnesa(farrrx  ;u0aptoifeiad mDrm( s ()tltnmf3oadlp   uvo s) rtm(m3ou4lltnmfetlt srta(moou4tpe mf3iat mDea( s t0trermo3to1lmD  ues;(0 rxr(mpou4lm n ictat)arrru o;u0tpxomoetlslm2rlu pn(0aleomo iytop  ln sls)srxoiopou1alt mnes t)srtr( o;t0tet  oeiyslmDra(mo u)arxrmfctadoaDr ueil()srur(mpnudlltemfvi (f 2trxrono1tpenmiciysfm2umumpn() lxnioctatlmtranvo;t0tetr(o3oo4opt lncs (  rurxm no1olxo f3iasfa2rau s;u)altrxocoydlpDe iei;t0teuo(o nu4alt lncsl(  2truront4tlt  fcils sDumuvpnu4 eerxo3tytop r uvolt)teuo(m iudop e icilt  Dta(mpoo1tpto o3iltfm2rm( o (4texrmfctatfaDelnvsls0tetrxmpiu4openlivils  2umum ou4ope mieildls ra(vp;(0altoif3oy1latr n s;( s2to(r3ou4aptemncslt)srra(  ;u4tee  ociasfs2emnmonu)alxrmr oadfatr neo;(  rxoimpoudlle  ics sfsDurx oou4tpe mfctadfaDuln ont0 exrxrcoadlmt aieo;(0 rum(m3oodomenlfvtas srtaurono0tpxnmieildfm2uaums;()texrmo to1fa elnvolt) rxoxo3nodomeelfci ( arra(m ou1oee mietad a2eau o;(4altnirciatop eauei;t0 rtmim no1oltnlfviatfaDurxmoot1apt mf3iasfaDeanvp t)artrir iydla  au il(  2xoxo3oydoleemieiltfarua(rpoo1oeeo oetadfaDuanvp;(4aeerxo oatfm   ueol(0 exo(m3iudamenmfes s  2uaxmpnu0olto feiyd a2ul( pn(0artomo todopDr u sls)t2xoxm oydapen nei s) Drm( o;t4tpe  o3iat a2ra(vonu4teenir3oodom  ai ils0seto(m3iu1op   fetas a2rr(m ;t0teenmf3tytlmDuan s;u) eermf3io1lmD anes () exoxo no4alt mnci sf 2rauronu0teeniociasfm emu sn(0tlxrmrciadfmDrai s;t  rxrxmpoy1amtnmneilsf Dumum ou1olxoifciltfs el(mp u0tlerircootoaDranes s)texo(m3nydalenmnvias  rum( ono1teeomi3iyslaDean sn(0arxrifcoatoaDelieo;( t2toxrpnodapt mici t)s2um( pot1tptomo3iytfaDea( s u4artrmo ty1fpDelnvils0trtrirpnu4lpenmfetas s2umuro;t0oeeo feias a2rmn ont0tlxrif3totfa rlieo s)srtm(m3iu1amee ivias  Durxmoot0openifeils mDeln o;u0 rxrxo3oatfm eaieils teumxo oodaltnliet sfsrtr(ro;u4oltn octls s2uaump u4trxnxf iotfptrlieo ()setmirpoudap emfctlsfarrm(  nt0texoiicils aDranvont0 eerir ia1fmtrln ol()sexmirpou4lm emici ()a2ua(m nu1ole  ieiyt s rm( s;u4 etnxfciotopt livsls  rxm(opnydom  lfvsas)arrmxro;t0oeenmi3iytfs2ean on()alxoxf3totlptrlnvo t s2uo(opoodlptemieilt) Draxm ;t0oltnifcildls2ra(mo (4tlxnxo3totlmteai ol(0srtr(r iu1opee iei ()aDumx  ;u4ape miciltfmDrmn p () rxnio ia1la r n s s  eur(m3nu1op emncsls)artmx  ;u1alenmfctaslm2rmnmo u) eerxfcoydlpDr ivi s seurio no1optnlivta( srurur oo1tpenmo3iadls eln o;t4arxrir tydfm  lu o s0sruoxr oy4ll e fcs tfaDuaur nu0olto ociaslsDelu p;t)aleoxfctotfptrlieo;()seumxr3ou1ap nmicia(fsrtaurpot1opxn i3iyt m ea(vs u)tetnxr iotlpDrlnvi;t t2trio io4llee fesas  Dtm(rp;t0altomoeiydfm2eaumo u0texrio tatfmDrln sls0 exm(o oo4lpen ivtl() ruaxroou4tex ifetyslmDraumsnt4arxoir to1lpDeau o s  2xmio3ny1lpe  iviatfsDtaxmpoo4olx mociad m2rauvpn(0altomr3iotoat luvi s s2urirpno1lm  mivsls arrmuroou1aexn iciydfs umumsnu)artrmr3oatfm rlnei;t)teum(m3no4lmt livs t arraur ou0oeeo ociad sDemnmp;u4 rxniociodlat aueilt) etrxm oydoltn nctas  Drax p;o0aleoifeils s2ra(mon(0aexnmf3iytlpDranvo;t)srtm(r iu4lmte fvtl(fs2taxr ou4apenioeias m ea(vsnt)trxrmociadlaD luei t sruoio io1apt mnctltfarrmxrpnu0tlxnifetyd a el(ms t0areoiocoa1fp  lnvs;s0s2tmim3nu1om  livilt aDraumont4ale moeias s umn pnt4 etomo3io1fmtrlueslt seuoxopny1omte ici s)srra(r ;u1oet iiciad s ranvo;t4 rxoxrcoa1fmt  nvi;s  2trxrpoudlle mnvta(faruaxmpot0ale iictltfs el(vp;(4 ltomfcia1omD li o ( s2xo(opno4ll nlnesat s2tmurp;t4tpen fetyt aDulumsnu0aetnxr3io1omD  i i s teumxr3no1apee fcslt) 2rm(  nt4olxniieiltfs2rmump;(4aleoxocto1omDeln s t)t2trxm ou4lptn nctls  2umx ooo1apeoio3iadla raums;t0tleoxo3oytlpD auvi;() exmio nudlpt mnctls s2umx  ;u1aexnii3iaslm2ea(vsn(4teermf oadfmDe n i;( seuo(m3nydlpenmfeiat)s2uaxmonu4olt mo3iadla2eanmpnt4teeoir3iodom eai o;(0srtm(r3ou4oltnlnvt (f Dtr(r oo4alx ifcils m emumpnt)tleoxo iotlaD ai i t)tetoir3iu4lleelncs ( sDrm(ro;t0oetomiciadlm2rlu pn()teeoif3oadom ran s s) eur(mpoo1olee iesltfa2ra(m oo0tpx miciatfm2raump (4aleoxo3oadoaD luvils  2umxo ou1lmte ici ()srrrxmpno4oex iocilsls elnvont4trenmrctatfpDeaivs s  rxoim oo1ap n ivt s) rrmxmpnt4apeoifeild s2um(vs t4areomr io1lm  lu olt) rxmir3nudomenlnviat srta( o;o1tlxo fetyd m eanmpn(4 etoxr oy1lpD aieo;() 2tm(r3oy4ome  ieiat)s2rr(m nu0oleomf3ias m eanmpn(4trxnmo3iy1fpt  i i;s0trxrxmpnydlptn ietltfartru onu0alt ioetld s2el(mp u0arxrif oo1om e ies;() 2uoxm oo4lm n fvi t)s2rmu oou4aex mfetyt s emu o u4artrmf oodlm   uvils  etmxm oydll emfvs ()sDum( oot1apt  fcilsfmDelnmp u) eerxo tadomtran slt0trto(opno1openmfvta( srtr(monu1tlxoifcils s ulump u0texoxo ta1om rluvil(0trxoir io4ape mics t  rtrx o;o4tpx  octatfm2ra( s t4alxrio tatoatrlu o;s0 rurxmpny1opeemfviasfaDum(m nu0tpenmiciydls2emnvpn(0altrir iatfmD au o;s0s2trxrpnu1amenlfctlsfsDtru pot0open ieiadfm2ulu onu0 ltnmrcoydfptraies;t) etrxrpnu4om nmfct (fsrtax pou0aetn iciysfs elnvon(4aeeoxrciotfp r n ols  2trio iudoptelneias)aDrrx o;u0apen oeiatls rmn pn()tltrmfciadfmtr ivi;s)trxr(opoo1ap elictasfa2tax pnu4apxoif3iysfa2um(ms;(4trenxf3ia1faDe uesl()s2um(m iu1aleelivs sfarrmumooo4aptoiociytlm ua( pn(0trerxf iytoaD anvi;( t2xmirpno1ap emnvi s)aDur(m ;o1tex mi3tlslm2rluvp u)trxrmo3oadlp  an o;s)srxrxmpno1ap nmiet (  2urxm nt0teenmoeiadfs rlump t)tleomr iydlpD li i;s sruo(opoo4ape lnesa(  ruru  ;o4olxnmoetatfsDumumont0alxnxoctadlmD livolt s2xrxmpny4al emici t sDtmx  ou0apeo ietatls rau on()aeerxr tydfptr nes;t trxo(o iydap n iet ()a2tr(  oo4tpxn ociyt a rm(mo;u0areomf3io1fp e u s (0 2xrxo3nudal nliciasf 2ra( ooo0altnmocilt m2rm(mp;u)texrxr io1lmDr neol()t2xrio3oudllee nvs (f Dtax p;u0opxo ieiysfa um(vo;(4trtnmf3totopt  nvo t teurimpiydoptemneia() rta(rpot1aeenmo3ias aDrmnms (4 rxoxr iytlptrli i ()s2to(mpnudlm   ics t)sDrmur ot0opxomi3ild s rmump;(0aeenioctatfpt an o ( trum(opiu4oltnliesa()s2tau  nt1aetomoctas a2ra(ms;(4altnxf iy1latelieil()t2xoxm iudomtemfcia()aDtm(mp;t1tpto ociyslm2rauvs;()artnxoctytfmtrau o t0trurxrpnu4ope mfvs t)sDtr(  oo1altomoctytlaDranms;() rerxfciydfmDrauvols) 2xm(o3iy4altn ieta(f rurx ono1tpeo ociat m2uanmp t)tlermoctotfpDrluei;(0s2xmxo3iodale mnci () rurx o;t0oet micildls eln s;u)aetnxf todoaDrliei;s0trtoxopno4ol n fei ( srtr( ont4tpxn icils s2ulu o;t)tetnmrctydfate i i;t seumxm io1ameemfetls  2tr(m ou1tetomociaslm2rmums;(0tlxomocia1oa r ues (0 eum(m iy1aleelfctas) Drrum ;u4apto oetyslaDumnvpnu) ltrxr3ty1fmt ai o;s0srum(rpoo1apte icsa()s2trxr no1olt  i3ildfsDelnvp (4treomo3iatfaDeluvi;()teuoxo3nydopte fvs ( s2umxr ;u1oexo fctys aDrm(vo;t0texoio3iy1oa  lu o ( texrxr ou4am nmiciltf ruaxr no0oeenif3iltlm rauvon() rerxr tatlpDe uvs;s)trxoxr iu1opeemiciat)aDtrum ;u0teto f3iadfsDra( sn(4tlerif oytfaD  u i t) rxmxm oo4amenmietl( aDraxmo;u4oltniocilt aDemums t0alxoxr3totlm  an o;s teuo(rpnydomenmiet t)a2rm(m no4optoifciaslsDel(mpnt0 renmr3oatfa  lueol()sexmim iy4lm e nvtlt)artrumpou1aetomi3taslsDuau s;t4 etrmocto1opD au ol( teuoim3nu1olt lnvtatfarrauro;o1texomoeiltfsDranvs;t) reomo3iytomDr u s;s0srtmxopoo4alenmfei t a2rr( pno1alt  o3ilsla ra(mpn()texrxo3ia1fmDeluvol( srtr(o nudol nmncsls) 2raumoot4tpe ifeiyslsDuau p;u4tltnir tadoaDeai s t)seuoxo3iu1ome livsls)artrumpnu0opeo octyslmDel(ms;t)texoxrciatlmt  ivols  euo(o nodalt  nci (farrrxmoou1aeenio3tldlm ulnvo ()arxrxo oytfp raieo;t) rtr(rpoy4amenlietlt)arra(  ;u1aetniieiysfs2ra(vpn(4 exriocia1fatr ueilt0s2uoxm3ny4lp  mfvt tfarur( pot1aet  ieiys sDelnmo;u4 lxrxociy1lm  livols0seto(o3iodale  nctlt)s2uru ont0optomoeiasfm uln p;u0trtoxr3tatfpD lu s ( t2uoimpiy1ol elnvtl( s2urx onu4aetomoeild m2ulnmont0 rtnmo3oydomtelnes s0sexoxr3nudaltnlivilt)a2rrumpnt4opx ii3tytlmDulu o;t)tlxnmo to1latrauvo;t)teurim ny4lpen iei tf Dumu  oo4alxoifetat s rmu on(0treoxrcoatopD  neilt  2trim iodap emncsls  Drr(ront1alxo f3iltfsDea(vo;(0 lxrmo3iodfaD ln i ()sexr(o oy1altnlfvia() rtrx  nu1ape ii3iyt s2elnmonu)aetoxrciodom  luvs s)setrxopoo4ll nmfet t) 2taxm oo4oex  ocildfa um( o t)aexoifciydomtrau s (0 2ur(o iudlmtn iet s aDumur nu4teeo fetld a2uan p;t0arxrxf iotoptr ivo;(0 etrio oo1ale livsls) rrrumono1oee  f3iysfs um(vo;u) lxrmo3oadoate uesls0t2umio3nudamtemfeia()srtruronu0apt  fctls aDem( o t)tlerir3iodfmDe nei t0srxo(mpoy1lpe  feilsfs2rm(root1ope  fciadla2rau p;(4altnifciydomt  u sls0s2xm(r3io4lpe mfvsl( sruauro;o4tet  oeild sDuauvs;(0 exnxrciodfatr i i;t0trtrim3nu4amenmfciltf 2urx  ;t0tlx ii3tytfa uauvp;t4 reoircootfpteau o (0srxo(rpio4omt lieias)sDtaurpot0tetnifeiys sDel(mon(0 eermr ootlmtelu s;s)srxrxmpou1al nmivsa(faDumuro;u0oet mfcilsfs emuvo u) lxnxo tytop  anes;s0trxm(m3iy1ale mfetlt)artrx onu0olenmo3tlsfm2ul(mpnt)aeenio oodfp ran s t srxmir io1amtelfvtl(  rtr(m no0tex io3iydfmDea(msnt0trerir totoateluesl( seuoxmpny4lmt  fct t) 2ua(roou0aeeoioeiyslsDumn p ()trxnxo iotoa e nvo ()s2tr(opiy1lmtnmnviatf 2ta(  nu1aex miciat a2umnmp () ltnircoy1lptrluvsls0 etr(mpnydap e ict sf 2uaumo;u0aet mi3iatlaDua(vo t)tlerxr3oa1lmD luvs (0 ruo(o3oydamt lfct t a2ra(mo;o0aee  i3iad sDrmumsn() ltriociodfptelnes;() 2xr(m nu1opt mncs ()aruax pnt4tetnif3tyslaDulnmonu0 eermr oodla rlivs;() 2uoio3iu4al emnesltf 2trxr no0apx ioeiyslaDul(vp;() etnmfctotlmtrluvslt) etrxrpou1llt  fcsat)s2ur(rp;t0opxo f3iydfm uau s;() rerxf3oy1fmD ln o;t0 eumio3iudape  ivt t aDurum nu4apxnmociytfsDrm(msn(0 rxnir ootfaD  i s;(  euo(r ny4am  lfetlt s2taxroot1ape  fctlsfm elnmp u4altrxf oo1lptran i t)truoirpoodlmeelici (fa2umumpoo0tltnmfeiyslm2ran onu0trtomr3iy1fate uvo t) rxmxm oodlpe lncta() Durxm nt0oltn fctadfs em(vsnt0trtnmr3totoaDelivi (  rumxr ou4ap nmnesat)srrru pno4tptn o3tatfa uaump u4aexnifcta1lp elu i s0srxo(opnu4lmen fvi tf Drax ooo1aexo i3tlt s raump () etoxrcoo1lp e nvsls0 2xm(r3iydoltnlfesls sDurxrpnt4apt mieiad a um(mo u0arxomf3tadfp  an olt s2xr(mpoy4lltemncsltfsDra(  no1oeeomfetyslsDrm(mp;t0treoxociatoa  auvil(  rtrxo3iy1open fei t) ruaumpot4tpx  o3iydfs2rmumsnu4alxrxr oytoaD  uvsl( sexoir3iu1ll nmnei t) rtrx o;o1texoioeiydfa2umn ont)aetrir3iadlp rlivols setrxm oy1lme livslt)a2rrxrpno1altn oeiltla2ua( p;t) lxnircta1opD  nes s0t2trxm3io4ll n ncsltfs2rrxrpnu0tltnifciydfs emnmont0tltrif tatfmD luvils setrxr3oo4lleelnviat)sDrrxmpot1aee  fctld aDelums;(0trxnmo oy1fmtrauvi;(0 2uoirpiydal   fvtlsf Dum(m oo1aee mo3iytlm el(vp t4altoxo todlpDrau o (  eurirpoy1amtnlnvi t a2um(  nu4oee mi3tltfaDulumpnu0aetnxfcia1lp elivo;()texmxm io4lm elicia(fs2rru o;t0opeomfetlslmDuan s;(0 lxrxr iadoaDeli i;(0truo(mpoo1amtn fctlt a2uaum ou0opx iietad sDumnvp u0areomrcoydfpt  nvo;t  rtm(mpoy4amenmics (  2raurpoo4tetnmi3iydfmDea( p;u4aetnifciadlp elivo;t0t2xoxrpoy4llt mnes sfarrrxronu4alxomoctysfsDrl(vp u0tleomf oytlate u o;t0t2to(m nu4lpt lieias sDrrxmonu0tpx  fetlsfm2raumpnt0tlenxfcto1fp rluvs s  exmxr3iu4ole lnvt ( aDra( p;t1oee iietad m rlnmsnu) exrmf3tatop rai o t sexoxrpno1om  lnvtlsfs2rr(  oo4tle moetasfsDranvsnt4 leoxo3iodla e ieo;()teuoxm3nudlme mfei tf rtau o;u4apeoifcias mDuan p (4artomfciodoa ranei;( tetm(m oydap   icil(f rurur oo0aeen ictytla rmuvs () ltoiocta1fa ean olt t2tr(m io1amee feta(fsrrm(moot0oltnmictat a2eaumonu4tltnmfciatoa rln i;s0sruoio3oydap nlnvtls)srraxmonu4aeenif3tld sDemuvs t0areomf3oo1op r nvs;s s2xr(r oo1aptnmnvt (f rraurp;t0apxo fcilslm2umuvon(0alxoxrctytlmtr n i;() rxrirpoydap nlncsa(fsrtmx p;t1aee moeiat mDuauvp;(4trtoxf iotlm eln slt)trxo(opny1op  mfctls srrmur ;o4opeoiiciyd a2emuvpnu)tetnxocoo1opD anvo;s) euo(m3oo1ll nlietlt  rua(m ou0aexomfciysfs uan s;u)arxoxr oytopDeluvs;( teto(rpnudlm  mfeilt arum(moou0opxo oeiydlsDul( o u) reoiociydfat  ues;t0 rtoxm3ny4lm e fcsa( sDraurpot1aetn ieiadlm2rlnvsnt)alxnif tadlpD  neolt0t2um(o3iodlp e ivi s a2ta( oou0ape mfciad mDrlumsn()areomo3oytlp e u i s)s2xoimpnodaptnlfvslt)a2rmx o;t4opto oeiyslm2em(mpn(0artoir3tydfpD ai o ( setoio no1al nlnvslsfaDuaxrp;o4alt iieiydfaDrl(vs;u4areomo tytfmt livi t)setrirpoo1lpt lictl(  Dum(  ;t4teen feiyt aDrlu o;u4 etnio3ty1lpteln o t sexmxr3nydlmen feiltf Durxmp;o4texnmieiasfs2um(vs u4treomo iodfp eluvi;s  2tmimpoy1apte ncta( aDrrxmpoo0alt mi3tldfa2ean p u) etrxr iatlptrlieo t  exmxm oy1apeelfvt () Dta(mpnu4apenii3iltfsDeluvsn(4 lxrmfcto1opteanvo s0srtmio ou4al elivsa(f 2rr(  ;u0optn i3iysls2emnvs;u4aexnifcty1fpte ivo;( s2uoiopny4al n ivtl()s2trx  ot4oet mo3ildls rauvs;u) rtnio tatom   ueols) euoir oydlm e ncia(fsrtr(ront0apxoiociysls2rl(mp;t0altomr ta1fptr nei t texrim nu1am n fetatfs2tmurooo0aeenii3iytfmDean s (4aetrxrctatfmtranei;() rtriopoodam emneil( srua(ront4apxn o3iadfa2emu onu)alermocio1oa e nvo;t t2xoiopnodol  mietlsf rumxmoou0oexn fetlsfsDulu o () reomo3ta1faDraues;(0srurxo3no4lpe  net (fa2rrxmp;t1tlt mictatfm uluvp ()texnxocootfa e ueils  ruoxm3nudamt licil(faDtrx oou1oee ii3iytla2rm(mp;t0 lenir oo1lpDe ues;s texmim3io4llte ict s arrmxrono0open ociltls2ulnms;()artoifcoytlat aueolt)seum(opiu1llte iesl( arur(rpoo1apx mo3tld m rm(mp;(0altnmr iy1fa r n i;t  2uoio3nodllen ivsat)s2ur(mooo4olt mieias s rmuvon(4 rxrxr oatoate i o;s)sexrxmpiu1optnmnei (  2rm(r oo0tpxniiciysfm2eln p (4alxomr3iatlmD  ieolt trtmxo3nudlpen ncil( s2um(mp;u0tpen i3tls sDrm( p t4texrir3oodfa rlnvol( t2triopnydale  ivtl( s2rr(rpno1tle mi3tls s el(mp u4artnmfcta1omD livslt0s2toiopiy4lm e fvt ( sDtrx p;o4tltniietadfm el(vp;u0 etnxo3oa1omDr i i;() rur(r3iy1aptemnvtasfs2tr( pot1aetoioeiyd a2uauvp;(4tetrxfcty1faD lies;t t2urimpoodap   ietat) 2rm(monu4alen fcilsfs rmuvp t0 etrmf3totoaD auei t setoim3iudlltnlfci ( a2urumpou4aeenioctydfa umnvs;()tlxoxr iytfaDeauei s tetmimpou4altnlnci tfsrrr(mo;t1tee  ociyd mDeanmo u0teenmr ta1lm  lnes t) rtrxopio4apt miei ( a2rrurooo4oexo iciat a2ua(vp;u4 rtomociy1fa  lies s)srtmir3oudopen ivslsf Duru  no1oee  octatfs2em(vont0 lenmr3oy1faDr u i t teur(opoy4lmenmivi sfsrtaxm nu1optoifetlslm elump;t0altrmfcoodla e n o s0 rurxmpiu4ale mfvsls  rua( ono1tpxnmi3ils s elu p u0aeenxf3to1fpDrlneo;t)t2tmio3oodoptemies (fs2raxm ;t1apen fciasla rau p t0arenmfctydopt  ivo t0t2uoxmpoydom   fctat  rrm(  ou4oleo f3iadla2rlnmo;t4trxrmo iadla eaies s trxr(m no4ol e ics ()a2uaum ;t1alxomoeilsfs2ea( o t) eeoio3ta1fatrlu ils0s2xrxm3oo1omte iesl(fsrrm( pno4tlenmiciysfm ua(von(0 lermo3oadomteau il()teumio3iu1ll e ivil(farrru onu0olenmoetatlaDean p;t0aeermo3io1oa  ln o;s0 euo(m3no1opeemiesas sDta(m ou0tltnifeiasfa2umn p t4 lenxo3oydoa e n s;s) rxm(r iy4lp e ivia(fa2rr(rpnt0aex mfeiydfm rlnmon(0 ltnmo3oatomt  i i s seuo(r3nodamtelicilt) rrru  ;u0texomoeils m uau p u)arxrmfcoydom elu s;(0s2toxm3iy1llenmnct s)a2umxrono4aee  octld m2uan o () renxo3iytoateln ol() 2xo(o3nodamtnlivia(f Dra( p;t1oeenmoetltls rmnvo;t4tltrxr oatopteanes;t0teuo(opnudamt mnvs ()aDra(mo;u1alxnmictasfm2elnms;(0trxoxo3oadom  au o;t)t2umxmpiu4opeemncsasfa2tr(m nu1aeeoifctytls eau o;u0tlxoxfcta1fm eli sls teuoxo oo1lp elnvsat) Durx poo0aee  fetatls2uluvon(0 lxomrcoatoaDelies (0srxo(m3iodlmt  icilsf Drrxm nt4olxomfeiys a2rmn s u)aeenmo iydlmtean s (0 2uoxo3io4ome lieil()sruaumpot0tetoifciad m2ulnvsn(0 rtomr ty1oaDelnvi s  exrxr3iudope lnvtat)a2ra(r ;t1olt miciyslsDelums t)aetrxo3iotlm  livilt setoiopny1omtnlnvs sf Duaum oo0aptnio3tatfaDran snu)aeermf3ootoa  luesl()trumio iy1ll  lfcsls)s2rm(m ot0tpeo octlsfa umuvs;t4teeomo3iydlaD  n o (0trto(o oodomt livsls srrrxmp;t1apxnii3iyd m2em(von(0aetrmo3iatfaD  n s;( s2toxmpiu1ole livtatfs2trxmont4olxn oeiatfa2eln pnu)aetomrciatomDeli s s  rtoiopnudlp n fet tfsDrm( pnt0tlenmi3iytfs2uanmsn(0teenio3oy1opteai o;() eum(r3ny4ope  fvta(  Dumu o;t0oex mf3tls s2rln p u4arxrmo oytlaDrauei;t  rur(mpiydam nlict t)srra(mpot1oee ifctydlmDumu snu0tlxoxo3oy1lmDe ies;s0tetrir oo4amte ncsl()srrrur ;o4olenmfetls s ul(vsnt0 etrircto1fa  anvi s  etrio no4ll   nei sfaruaum nu0open iciatfs ranms;t0 eeoio3oo1fa eau olt srurim3no4olenlicsl()s2rrumont0tlt if3ild mDul( o;u0tlxrmf oadfaDeln i;t)srxm(r oo1opt lnvsa( aDta(  nu0opxnmfetysfa eluvs t) rermo iadfp  anvslt0trtoim nu1apeelnct s) rrmuro;t0aleomfeildfs2ulnmon()arxoxf oatopD  u o;s0 eur(rpnu4oltemfvs s  rrmum no1olenioetysfaDrlnmpnt4 lxomo io1fm  aieo s)s2um(r3io4olenmiciat)srtrurpno1oee mi3iytla ea(ms u)arxoir iadlmt aieslt  rxo(o3oy4ol n icilsfsDuax o;u4alen fcilsfm2umuvo ()tleoirctytfatrau s t trxm(r iodlpen ivilt aruru ont0aeeo fctydlsDumnvs;(0texrmfcia1fmDrln sl( seurirpnodome lncia( arra( pot0altoiiciasfs2ulums () etomo ia1lmD  i sl() etmxo3nu4olee fvsl()s2rm(rpot0apeoif3tldfmDuauvonu0tetnxo oodoptrau o;t) etrxopnydlpenmiei (f rua( poo4oee mo3ils mDeanvp u) rxoxrciydlaDranvi (0 ruoxm ou4oltemnvi tfsrtax p;t1apenii3iyd m2ulnmo (0trenmocto1fmDraivi;(0s2xoxo3nudol  livslsfa2tmur ;t1oee ifeiadfsDrm(von(4tlenif3to1la   ies s)t2xoirpnodlm nmfesl(fsDtrxro;o1aet mf3iadls um( s;() eeoxf3ty1lpDranei t s2tmxopiodlltn neiat aruaxr no4apt  ieilsfaDuanms;(0aexnif3oo1fm  auvs t truoxopiy1omtn nvta(  rraumoou0teto icild aDrm(monu) reomo3tytfmtrlu s;(0s2uoxmpiudomte netas) 2rmxrpot0texnmocildlm emump;(4tetrif3ty1fptrai sl()texoxr3oo4lltelict (  rrr(ro;u1aetn f3tat m raumo;t4 eenmfciytom  livilt)s2uoio3iy1lpe  fctls)srrmuroou0aet if3tadfa2ulnmonu0 ltnmrcoodomD lnvsls0srtrio3ny1amt mnci tf 2tm( pnt4tlxomi3tld m rmn o t0tltrxr3ty1la  lues s) euoxr oy4al n fesl(f rra(m ot1tpx mieiasfm2ran p t4arxnir tadomDrli i;t0texrxm3oo1omt lnctat) rraxroot4opx mociatlaDel(mp u0arxnxfcoy1fp e nei (0 2xrimpoy4lpen nvsltfarurxmpnu4altoiocildfs el(von()alxnif ia1fmtrauvil()t2umir3iydapen ies s srurumo;o1olen fcildlm2rlnvo;u) rtnif3iy1oatrauvs ()srtoxm iy4omt mnvs (fa2ur( pnu1tle  fciydlsDuanmo;(0alxomf tatomt ln i t)seurxr io1llenmfcsasfs2tr(ronu0aetoif3ils m el(msnt4tlermrcio1fm rai sls0sexo(m3oy1lpeemiei t s2trxmont1oexoiictatfaDemu pn(4trtrmo to1lpDr nei;() 2xr(mpoy4olenlnvi (farta(r oo4tpx ifetadfa2elumo;u0trenmo3ootoaDeauvi ()trtrxmpno1ale mnctat  rurx  nu0tltn f3tysla2el(vont4aeeomrciydlaDelu s;( setoxmpiu4omenlicsl()arrmu o;o4olto ieiyd aDrl(vo;t4tetrir3io1op   u o;( trto(o3nu1al elfvsltfarur(rp;o1oetoifetat m2ra(mo;t0trxoxr ootlp ranesl( texoir3nodam n fvi s) 2tr(moot0tpt moeiad s2rmuvont0 rxrir3ty1la  livo (0 exoxm3iydlmenmivsat  2umur ;t1ape ii3iaslm2eanms;u4areoif3tadlpD auvslt0 2tm(m3ou4aptnlfvi ( aDtmx oot4teen oeiat a2uluvon(0texoxocta1lat lu o (  eurio no4am  lnvs s  Drrxr ;u4alt iieiytla2rm(vs t)aeeoir3tatfat  ueol( srxm(m3ny4am e nct t a2ra(mont0tleo fetldfm2umnvo;u4artrmr iatopDrlu o;t)trtrxo3ou4ll   fvilsfarurx pou0tetomfeiydfa2rm(vp;() etrmr3oatlm e ieo s)s2urxm ou1am  mfcsasfsrrmuro;t0optoio3ilt a2emnmsnt4 rtnircootopD lies s srtoio ou4lm elfvtls arrrxrp;o0oexnmicildlmDea( on(4 rtoif3totop  ai i ()s2xmiopiu1ol n iei s  Dua(  nt1oet mo3iysla2uan on(4altoxfciatom   nvol(0 etmim3iy4lle mneia( srrm(r ot0alt iociydfm2ean onu4arxomo3ty1laD auei t)trxo(opnu4op  mietltfa2trxront1oexn ictlslm2uau o;(4treoxfcta1fp r iei t  2tmirpoy4lp nlnesl(farua(r ;u4opx  f3iyd sDua( ont4trenmr3totoatrli o;s0t2tmxo3io1olen fvtl(fa2rmum ;t4oetnmfciyt aDulump;u0aexoifctodlmDelu il(  2xm(m3iodopt  nvta(  rtru o;o0altoif3iydla ulnmp;t4arxrxociodlpt  nvo t  2uoxr no4llenlfetl() Draumpno1aeenmocild m umuvsnt0 leomr3oo1laDran ils s2toxrpno1al emfcsl(fs2ua(m no0tptnioctydlsDrauvsnt4tltnifciodomD  ueols  etr(o3oo4amte fes ( sDrm(rpnu4aex mocils m2el(mo;t0aetnio ta1oaD  nvs (0tetrim nu1amt lics sfsDta( onu1tlx io3iat sDumumo;t4texniocta1opDelivo t)srxmxmpou1lle lnvtas)a2ta( p;t1tpxo f3iad s elump t4 exoxf ia1oa eln s;s0teuoio3iydoptn ieilt)s2taxmooo4tlxn fciasla2eanmo u) lxrifciy1opDean o;s)s2xmim3ny1ole  ivi t sDrrx onu1tpeomf3iytfmDea(vsn(4artnxf3oo1fa r nes (0 rxrir nu4lpeemivi t arrru pno1alt iieils m el(vo;t0 ltrmr3oydoptraieo ( seurimpny1lltnlicta(fs2tmxmono1oltomoctad m2rlnvp;t) lenmr tatla  auvol(0 2urxr3ou4apen fcsls)s2umurpno4oeen o3iytfs2rmu ont)arxoxo3ootfmt aiei s t2um(o3no4lmeemfesl(fsDumx o;o4oleoiieiytfa uau p;u4tlxrmr iadfateluvsls)t2urxm iy4op e ivia(fa2umurp;t4opxnmfetldlmDel( p;u4tlermf3oy1fa  an o t0 eurxr3oo4lle  icsls) 2ua(mp;t4tle iieiadlm2umn o t0teenmr3tydlaDelues s0 rtm(r iy1al e ncias  rumxmp;u1tle mfcilsfm2em( pnu4artoxoctotfaDelnei;(0trtrxm ou4ol n fvtltfs2ta(r ou1aexo ietlsfaDel( p;u)alxomf oytfmt anes t s2xoim3nydolenmfesl(fsrtau pot4tetoioeiat aDrmuvp t)altomr iy1fa rlu s s)texmio3oy4lme  ivil( srurumo;o0oet ii3tldls2rm(mont4arxnmociy1fa eauvilt sexoir3nu1lle  fcs tf rtaur ;o0apeo fciysfsDelums u4areoxo3oytoa ranvs;s srxr(o oudapee feiltf rtaurpot1opeoioeilt a2rm( ont4tetnioctatomDrai ils)s2xoir iu4lp emnctl()sDtax  ;o0tpeomfcilsfm2ul(vo t0trtoio3oa1opDrlu s;t0srurxo io4om e nvsatfa2rm( p;u0teeo i3iyt sDumumo;() lxnif ty1omDeaies t)teurxrpnudomt  ncia(  rtr( poo0aptn ietldfm eanmp u4treoxr iatlm eau o s  rxm(r nodaltemivt sfa2um(rono4tlxo o3iltfm2rmums (0texrmo3oytomtranvsls)sexo(m nu4ol nmnvtat aDtaxrpnu1alt ifctytls2umn o t4arxomoctytlaDelnvsl(0seuoxm no1ap e ietas arrmum ;o1tpe if3tysfsDran s u)tleoio3iatomte iei ()srto(opnydlltnlnesatfsDtr(mp;u1tex ii3tldfs2rl( on()aeermo ty1lm rai o;t0srtrio ou1am   fesl()aDta(mo;o0tex  ociadfaDulu pn()tlenmrctadfp eanei;(0t2urxr iydamtemivt t aDtrumo;u4altoifetad a umu s;u0tlxnio oa1omD au o s)setmio iodll e fvsat) rurxr oo4opxo oetltfm em( p;u0arxrxr3oatlmteaivs;( texoxr3oo4lptnlfcsa()artmx ono1oetoii3ildfm el(mo;(4altrif oodla  aueo;() rurimpny1oleelfeta(fsrrm( ono1oee moetat a um(mo u0tltrxfcoo1fat  u olt0tetrim nydameelfesas srra(rpou1optnio3iadlaDelnvpnt4 rerxr3todop   n olt)seumim3iydam emfviatfarrrx oot4ole ioeiydfaDuauvp u4 ltoif3oa1latranvs (0 2uoim io1lpt lnetat  2taxr ou0ape  oetat aDumuvon()altoxo oadlat ai i s) rxm(m3nudal nliesas)aDtaxmpno0ape ifctyt s eluvs;t0 rxomocoytlpt livo;(0t2uriopny4aptemnes (fsrumu ooo1alxo f3iysla2ul(mp;t)alxnxo ia1oat  ueo t setoim3oy1ope mfctls artaxmpno1oet mietlt mDelnmpnu)altomf3ia1fmte i i;( srxoir3oo4altelfcias)a2rrumpou0apen iciadfs ua( on() etoxo oatoaD anei s s2ur(mpoodlm nlfci ( sDtrurp;u1apxo oeias a rmnms (4arerxo iadfa raiesls  2xoir iydamee ncs t)sDtr(m nt1oltoio3iytls2uan o u4aetnxo ootoa r n i s  etoio3ou1amtnlnesls a2tax ooo4aptnmi3tlt a eaumpn(4tlenmo3tadomtelnvols  exoxo3iodam nmivtl()s2umumont0apx  fcias m emuvo;t4aeenxrctadfa  ai i ( t2tr(m3oudopeemfesltf Dta(r nu1oexnioctyt m ulnvpn(4trenxf ty1om eai s;t0 eum(o3no1ole lnetasfaDtmx  nt1opeoiieiydfmDra(vpnt)aeeomrciy1lptrlnvsl()teumiopnu4om   nesa(  Drau  oo0alt  iciytla2ua(von(0teerxr3iytopDeaues;s)texrio3iy1open fetat srtaurpou0apeomiciatls raums u0trtoio ia1fmteluvo s0teumim3oo1amtnlict t  Dta(mo;u1oeeo octysfs2uanvp;u4teenir io1fptr ieo;( texo(r nu4ap nlivia(faDrmu  ot4aeenmicilsfs2em(vo (0 exnxf oo1omDeaieolt)srxrirpny1omtnmici (farrmum oo0opxoio3iytfsDraumo u0altomo3io1lm   nes;s) 2xoxr3iu4amtelietlsf rrrx ooo0teto f3ias sDumnvp ()aeenircoadlmDeaieo s)trur(o3oo1ape  feias sDtmumont4oet  o3iydfs2elu pnu0trtrif ootlmte nes;s) euoxo iu1op nlnvias)srur(  ot1oex  fciysfm eauvo t0 rxomf oo1optr ivi () 2xrio nu1ap n ivs t)s2um(  ot1opxoifeiatls um(vs t0texnmf iodlat  ivsl(0teum(rpio4om nmfci s) rum(  nu1tet mociyd m rlu o t4 lenxr iydomt lneo t s2uo(mpiodolte ivtlsfsDra(  nt4apt iocildlsDrm(ms;u)trtrmr iytfaDrau i t0t2umxm oodlpe  ncslt artaxmp;o1tlt  ieiydls uan ont0arenif3oo1fp e uei;() rxrir3ny1al n ietls) rraur ;u0aptomo3tltlmDeau sn() renxr ootfmt luvi;(0sexmio3oodllt  fesat srra(m ;u4teeoif3tls a2rmnvsnt0tltrir3oy1fate ieo s)setmim3io1op e fcs (f Drr(m ;u1oexoifetydls2umu p t4alxnircoodlat  u sl(  2xoxm ou1amen fetltfs2raxroou1tee io3iadfmDra(von(4areoxrciotop eanvo ( tetoio iy1optemfctl()arraxm ;u4oleomo3iydlaDeanms;t0 rxrif3oodoateauvolt srxm(rpnydape mnvt s srra( pot4olxn o3iadfm2el(ms;t0trxomf3ia1lm rlueil() rxoxopiudlpt mieiatf Durur nu4tee mi3iys s2ra(vs;t0tlxnirctydoptelu ol( srur(opnudoptn fvs ( s2ua(r no1tet  ocilsfmDranmsnu4arxnxfcoadlm   uvslt  rumxmpiu4amenmncs t)aDtax pno0apxomfciatls ranvs;t)altrmf3oodfmt luvilt0 rxrxm3oy1alenmfcs (fsrtmumoou4openmociat s rln s;() etnif iy1oa r u ol(0srumir oodlpt mnvt s)srrau  nu0tee iietltfs2uanvp t0trerio totla eai i s  2trim nydamen iviat aDrmumooo4oex ioeiys sDrm(vo t)aexnmrcoatlpDrauvo;(  rtoxopiu1alte nvsat)aDrrxmpou1apxomo3ilsfs2uanvo (4aetnxf oy1fmDeauvs;s0srto(r3oo1lleelnviltfarurx ooo1tee  oetasla2emnmo u4tetnir iodoa raieols0texo(m iodlpe  ncs s aDraxmpno0openmf3ild s2emnmpnu0alxnmfcoatfat  i olt) 2um(rpiu1lp  livi t)arumu ont0ale mictadfa2ulnvs;t0aeenxo3tatfmtr neolt0sruoiopoy1lm nmivilt s2tmum ot1aptnmi3iysfsDrmn pnt0 lenircootla rlnvs s)trurir3ny1ameemnvtasfaDtr(rpnu1aexnmfeiaslsDra(vs;t4teenmrcoa1fptrlnvi;()srxo(m nodlmte ivtat)sDtr(moou0tpen feiydfm2rln snu0 lxoir3iytla   uvols0 euo(rpiy4lme lieia( arrrxrp;t4alx  o3tatfmDrmnms;t)tlxrmo todlpDe i o;t seto(m iodlpeelictlt aDra(roou1olxn iciadls2eanvonu) etrxf3oadlp eauvilt0 2to(r oodll emncilt) rtauro;o0opx ioetysls uln o u0trenif3iydopDrluei t srxmxo3oo4omen feiasfsrurxmono4apt  iciasfa2emu s;(0trxrif iytfm e u o;(0srtr(o3iu1lmtelietls aDtrumooo1apeniieiyslm2umnmp u)tlenxf tatlp elu s;()t2xmirpnudlme lnvs (faDtmxmo;t1tpeomfctadlm eau p ()trenxocty1omtraivs;s)setrxm oy4llenlfetlsf Drmum nu1olenii3iytfmDra(mo u4texrmo oa1fpt aueo s sruo(mpou4ap elict tf Dumx o;u0tle mfctysla2ul(mon(0 eenxf ootfmDrlnvo;(0s2uoxo3nu4apt  fvi t  Drm(mp;t1tleoifetytfm2ra( pnt0 rtrmr ootlateai s (0srtmxm iudape mivt s)srtrum ;t4opxniicilsla emu s u0 exnmr tytlmDraiei s0srxrim iudal nmicia()a2rrxmpot1tptnio3iatlaDeanmp;t0 renxrcoytopDeai o;( srtmxr oy1alt  ivsa(  rraumoot4tpe moeiat s uanms;u)tleomrctydomD  n i t)seuoxmpio4llee fvs s aDtaxr ;o4tle  o3tyslm2ea(monu4tlenxrciy1lmt  uvi;s seto(opio1amtemncsa(faDur(mpoo1olxnmfcildla uluvo;(4teermf iatlm r uei;t) rtmxr iy4apt mfvia()aDumx o;u1olto fctytfs em(mp t4texoif oadfmtraiei;t0 etm(mpny4ome  ncias aruau ono0aee io3tldfm umn onu4 etnio iadfptrlies s0 ruoir oodomenmfvtl(f ruax  ;t4open ieiys s2uanvs u4alerir ia1lmteli s s)srxrir3oy4altnlnvt s)srtm(mooo0opx  fetlsfaDuluvo;u4teeoxoctodfmte u o;( trur(r ny1omtemfvi sfs2tr(r ;u0tleoifctys sDean s t4tlxoxf oodoa  aiei t setmxm oy4ale lnvt t) rurumoot4opx ii3ias a eanvonu0tlerirctytop   i slt0trxoxo3iu1lpe  fvslsfa2tmu pou0aptniietas mDrm( snu)trtrxfctodfat auvo;s) exo(m iu4lle lnvtat  Dtm( o;o1oltn ociysfmDuauvp;(4aleomf ta1oa  li s;s0t2trxmpno1oleelfetls)a2ua(r nt4tee  i3iltfsDumuvs;u)trtrif3io1lm  lieolt0trxmio3nydlpeelivs t  rrm(mpno1teenii3tlt s2elu snt) leomfcoydom r neol(0 exr(opiodlmeemneta( s2uau  ;t1oetoiieiytls2ea(mp (0 lxrmf3totlatrlu s t t2trio oo4ope lnci ()aruaxrp;u0aptnmf3iltla2rmnvo (0 rerxr tadlatr n o;t0trtr(opiy4ap nlfcs (fsDtmxm oo4opxomi3iydfm uln snu4trenir tadlate nes t0srtrir3io4ameelfvi sfa2tm( pnu4tpe moetlt a2ulnms;u)trxrxo tatomt  i o () rxo(o3no4ameelivsls sDraumont1opx ifeild a2ulnvs;u0 lxoir tatlptelivs;( t2umxrpoodapee nesa() ruaum ;o4opx  feiyt mDrm( o (4 rtoir oodfmt au ols)setr(r iy4lpenlneils) Drrxmoot1oeeoii3ildfs rlump;()texrmf3oy1fm  ai sl(0teumxo3iu4omtnlfci sf 2rmurpot0apeo f3iys mDelu s ()arenxocto1fpDrau i;(  eumxm3nu1omee neslsfa2rrur ;t4tlx mf3iydfs rmu o t4areomfctodlaDraies t)trum(o iydlpte netatfsDumur no0opeo fetatlsDulnvp;(4tlxnio3oatlmD  iesls0t2xrio3ou4ome  ict s s2rrum oo1oleoiiciydfsDuanvp ()trtrmfciy1fmDr u o;s)truo(r3nodam n nvt s a2rmu ono1opeomfctytfaDran pn()tetoir iydlpDrlu o;s t2xoxrpiudap  mnvsl( s2trxmo;t4oexo ietldla ul( pnu4artnmr3tydla ran i;s) 2ur(m iudalt mieslsfs2rrxroou0opxniiciadfm2umn o u4 rtnxr tydfm elneil( s2xm(o iydlmtemnvt ()arum(rooo1tlen fciadlsDum( p;t)tleoxo3oodoaDe i s t0 exmim nu4ol  livtls) 2rmumpot4opx ioeilt sDelumsnu4 rerxf3iydfpt ln i;(0tetm(r io4ome mfeta(f rurur ;o1olx  o3iadlaDul( o;t0 lxrxr iytfaDeln o;s srurio3ou1aleelfci t  2tm(mo;t1oee iiciyslsDul( s;u0aetoxo iatlptr nvi;s)srtmir3ny1ol e fcta(fsrumxr ou4oexomf3tls mDuau onu) reoxf3totfatrlu i;s srtmio3oy4lleemicslt  2umxm ;o0tlto oetltla2umnmp;u)aeerifcta1fpteauvi;t0t2trim oy1lltemfvt s) 2rrxmpno1tlx mictytlm umuvp ()arenxf3oatlate n i;()tetmimpiu4oltemiesat)aDrrxront4alxoiocias aDumu o;(0 ltoxocty1faDrlies;()setrio3oy1om emnviat artau  ot4tlx mf3iyd a ranms t0 renmr ootlaDr uesls0t2uoxr3no1op nlicsa() rtrx poo0tlt mieiysls raumsnu4texrif iotfa  aivsls0t2urir3iu4lltelfeiat)arurump;u1olxomfeiadlm ra( s t4 rxoif oadlptrliei ()truoirpiudlme mnvtl(f rtrurp;o0alx  ieiaslsDumn p u0arerio oytlat  i o s0setmxm nydllt  nesa() Dtm(r no0tptniictltls2rauvs u4tlerir to1lm eauvi;(0texrir3no1apt lfesa(  rrmxmpnt4olen ociydfs ea(mp ()aetnmr to1fm e u i ( t2tr(o ou4omt mnvils)a2rax oot4tlxo oetadfaDrmnmo;t) lxnxr3oy1fpt lu ol(0trxo(mpny4al   fcsl()srumurpno0opxomfetldfsDel(ms;u4 reomocoydfm eau ol()seto(opny4lp  lieilt  rua( o;o0tlenmfciytfa2rmuvs;()aetrxoctadlp eln i;t setoxo ny1lmee nvs (  2tmump;u4opeomfeiltlm um( ont0alenifctodfp rluvilt0 2trxr no4olt mnvt ()srtrxm ot0oexnmfeiyd s2rmums;u) leomr tatfpt lnei s  ruo(m3oy4ole  nvil() 2tax  ;o1opto i3ilt a ra( o u0 eermr3ia1lmtrlneo t)t2trxo no4omte ictlt  rra(mo;t4opx iieiasfmDrln o u4 lxnxfcoy1fmtelnvo ( teumxr3iy1lm emictlt) rrrurooo1opeomo3ilsls eanvsnt) lxrifcto1fm  li o t0 2xrxr ou1omtemfctatf Drmurpoo4apen icild mDuanvsnt4 rtoxrctodfa elueo t)seuoxm3oydlp nmfeias)s2umxroot1aeeoifetyt mDrau pnt)alenmrciotop raneil()t2uo(r3io1amt  feilt s2ra( pno1olt ifciydlm2umn o (4trtnxociy1fm rai il(  exrxo nu1lmenlicsl( a2um(m ;o0tee  ietldla ul(mo t)teenif3oadlpDeau o;(0 2xmxo iodomtnlietl(faDrm(mpno4aexomictys s ranms;(0artnxfcty1la ran sls  eum(o ny4lmenmnet s  2um(m ou4oleniictlt m2emu s t0 ltoxfciy1om raieils  2to(r3oudlp  mivsas)aDuaumpou1opxomiciyslsDuan onu)aeeomr3iatlmt luvil() exrxm oudop  lfetat) rraurp;o4oltomi3iad aDea(vs;u4 rtrmr3io1om rlivs s) rurxm3nydlp  lnesl( aDuax  no0texomfeiydfa2rauvon(4tlenir oatoa eluvi t)t2uoxm ou4op e ivsas) 2umu pno0olt  o3ils s elnvp;t4aexnio3oa1lmt lies;(0sexoim oy1ale liet ( srtmumooo4tpx ifeildlaDumu pnu4tlerxr iytfa eai s;s0s2um(r ny4llt lnct tfsDraur no4optnmi3iys aDem(vp u0tlxrir3iy1fpteluvs t t2xmimpou1altnmfvi ()a2rm(mp;o4oltomf3tadla2eauvp;u0tltnmr3oa1faD  uvil( t2xrim3iudlltnmfvs sfsDtax pno0optn f3tytfs rm( s t)alerif3ta1optr iei;(0 2tmxm3oydoltemfei t a2ra( oot0texomi3tatls2rl(ms;u0treoxo oadlaDran il(0s2uriopnydaltelicta(faDurum oo1olxn ociys mDul( o t0 reoxr3oy1fptrauvi (  2uoxr oy1lm nlnetls)s2urxm nt0alxoiociltfmDrluvpnu0tleoir iadlm e u il( s2uoim iy1oltnmfetlsfaDrmu  nu4tlt mo3tysla emnvp t0 exrif iytlp e u o;t)t2xo(m io1lpe  ieia()sDuru  no4olt ii3tldfa2um(vo u4artnmf oa1op r u i t0teur(o3iu4lltemicsa(fs2urxm ot1alxo octltfm umumo;t0treniocoadfp eliesls)s2trim3oy1am n ics s  Dum(mo;o0apt ifctaslm2ulumpnu0 exrxrcta1fpD  nvs s t2uoxmpno1am n feias)sDurxmonu4olenmociytla2umnvpnt4trxnmr iytlateaneols) rto(o iu4ap nmnciatfartrx pot0aee  feilsfs2emumsnu4 lerio3iadfaDrlueo;t  rtrxr oydomt micia() 2urxr oo4tlx  fciatfm uanms u4 ltrmfcoytlpDe neo (0tetoxr ny1ape lfvil(fsDrr( p;t1texnmo3iad s em(mo t)tleoirciytlpDe u s (0 ruo(r oudopte ivtltf Drrur ;t0tpeomfcilsfaDranvo;t0tetoxociy1lp elnvi s)trurxo ou4al nmiviatf 2tm(  no0aetn ictysfmDeaump;u4 leoiocty1fmt auvi;s0 rxr(mpoy4aptn ies (f 2umurp;o0alen fcilt a umu p u4arxnir3tadoateaivi;(0 eumxr3nu4ll elivs t)s2ua( p;t0tex mfciasfmDem( o t4trtoxr iy1lm  aneo s0s2xmim3oy4lpeelies s)artrum nu0oexn fciyslsDum(ms;(4arenxfciy1lateaueo t s2xm(rpiodllt lfetatfs2taxmpot1apenmietyd a2eanvp u)artrif tatla  auei s0sexr(mpiu1alee nvi (faDurxmpno4alx  f3iydfsDrmnmpn()artnxo ty1la  li s;t0trto(rpno1ome lnctlsfarurxrp;u1teeomi3iltlsDranmp (0alerxo3oa1lpteaivi (0 exmir3nu1am nlnct t)srrmx  ;u0oltomfcilsfsDrlnvpn()arxnxocoa1oa   ieil()sexr(opiodll nlfvias s2ra(rp;t4aexoio3iytlsDeauvs;u)tltrifciotfa eai o s0trxm(rpiy4ll nlieil()sDtaxrpnt1aexniociad mDrmu o () lxrmr3totopt anvs s0 rur(r io4omtnmnvil()artm( o;o4texnif3tas s ea(vp (4 eenmo3totlmDelueil( t2xo(o oo1ome mfvsa() 2ua(mo;u1optnii3iat a2elu o u) lxrxocty1fat auvslt  rtr(opoudolt mnesl()a2ta(rpno4tpeniiciatfa2eanvont)trtrmrcoytoat li ol() 2xrimpiy4om n neia( aDtrum no4aeen oetlt mDrmnmsn()altoir3oatfa elieslt0 exo(m oo4apenlnesas) rtrxrpno4tlx ifetlt m rmums (4 exoir ootla  an ols  rum(o3oodameemfvsl()srururoot1oltoii3tlsls em(vo;u4 lenmfctatfmt anei t)seurxm iy4alt mneiat)sDumxmo;u4apt if3iydlmDuaump;t)tetoxrcoydop eaivil(0 exo(r3iy4omt lnvtlt)arum( o;t1alxnmoctys m2rmnmo;u4 rtnmo3iadopDrlnvs;t)s2xrir3oudom elnvia(  Dtm(r ;o1oexomfeiyslmDua(vo u0altnmociatla eauvs s) euo(r oo4omeemneias) Durx p;o1oeeoii3ildfs rmuvont) leoio3iodomDeaies;t0 2tr(o oudll e ictltfsrurx  ;u1altnii3iadls rlums ()tlenxr3totfptrlu i s s2toim iydom nmncs t)artm(m ;t1tet mf3iydlmDemn sn()altrxf3oydlaD aieils  etrim io1lmeemivs sfarurx oou4oltnmfeias m ul( o u4 rtrif iy1opte nvi t  etrxopiudal elfeia(  2taur ;o4opt  fcias s2el(vp u)aexnxo3iatfm rli o s) rtrim nu4ole mnei ( arrm(  ou1opto i3tytfs rluvs;t4artoif3ootlmDr ieil(0sruoir ou4amenmnviasfsDumu pno4tleomf3iasls rluvs t4aeenxo3iodla ran s;(0s2to(r iodlm n fes t) Dumu  nt0aeenmo3iltls eanvp t)alerxf oydlpt  u sl(0seto(r ou4optnlfeslsfa2raumpnu0ape mf3iltlmDeanmo;()alxoxrciadfm   nes;t0s2xoio3nodlmt lnvt tfsDua( p;t1tet io3tldls2um( s (4alenmfcty1fmD  ues t0 2xrxr3ny1optnlncslt)arrm( onu0texoio3iysfmDeauvo t4 exomf oy1fpD  n i t0sexo(mpoodaleelnei (faDuaumonu4apenmi3tlsfaDuaumo u4alenxo to1oatr n i t0s2urxm3nydlpt mfctasfaDtaumono0tpxomfetys s2rmnvsnt0texoxo3iy1fmDrlieolt t2ur(m nudale lfes ()aDtmur nu4aleo feiytlm ul(vs;(4altomf3tatlm  auvi;t0 2tmxm3io4om   ictl(f Dtr( ont0oetomfeiyd m2ra(monu0aetrio tadfpD luvil( teumim3nu1optn ict (fartau oot0oetnmfctls aDrlnmonu4aleomf3oodom eaiei;s tetr(o3oy4lltemnvi ()aDumur ot1altomociatfa rmn o;(4 leomr tydfmtrau i s)srtoiopio1opt  netas) ruaxmo;u0tlxn o3iyt a2emnvo;()tltnxf iotlpDr ueilt0teum(o3nydlp nmncsat aDrmx ont1ole mo3iys s el(vs u0aeenir oa1fm eaivsls)trxmio oydllte nvsl(f Duru o;u4apeoii3ilsla umuvp;t4alxoir tadop r neo;t) eurxo oy4ame  fci ()a2uaum nu0aet mieiadlaDemn p t0trtrmfciy1lateaneo;()trxoxopoy4open fvi t srtm(  nt4aet ioeiltfa umnvs (0 exrxocia1lat  nvi s0s2xoiopny1amtn fet s)arur(rpou4ope mo3iatlm rauvs (0teeomf3iotlptr i s;(0t2xmim3ou4omeelfvsas a2urxmonu4open oeias mDuaumo u0tltrif iadopDeli i t)setr(rpio1aptelicsltf Dtm(ront1tpt  f3ilt m2rlnms (4texrxf3iy1op r i o s0seum(o3io1llee nci s)aDtau p;o4alenmfetltlm2elu s;(0 rxomr iotfmt  i i;t0t2xm(r ny4llenlics t  rrru  ;t1aexn feiatfa2uanvp;u)trxnxfciy1oaD  i s t) rxo(m3oydop n fvs sfa2tmxmo;t1tptoiocilsfs2ul( onu) rtrif3iytop e uei;s)trtoxm3no1omenmnet tfaDtrxm oo0olto fctls m rau pn(0tlxomociytomtr ieil(0 2xr(r3iu1omtnliviat) 2tmxm nu4tptnmf3ils aDuau snt4artomo3tadoate nei (  etmim oydal   nvtat)s2tmx onu1ole  i3iydls2ran o;t4tlxnio3ty1oaDrlnvilt s2xoxm iy1op  lfei ()sDra( pou0tltn ieildls umn pnt) renioctydfa   i slt0trumxmpio1op  lncs t s2raum nu1opxoii3iasla ulnmont4arenxr3oatlp  aivo ( srtr(m3io4apenmfcias sDtr(ront4tltn o3ils aDum( sn(0arerio3io1latelnvilt srtmimpnudoltn fcs t  rum(mpoo1tpe io3iatfm2em(vo t4 leomrctytomt au ols0 etrxo iydlmtn ics sfarrr( pno0tlen fetlt sDul( o;()alenio todlaD livols  2xo(m no1opeemfes ()a2tr(rpnt4aptomf3tys aDem(mo;u) eerir3oatlmtr u ol(0 ruo(r ou4lmenlfesa(f Draur no4oeeo f3ilt aDuln s;(4aexnmocia1fp rlnvils)srumxm ou1lpe  nvtls sDraxrpoo1aeenii3tyslaDrmumsnt0tltomr3oytfa eaivi;()seuoxrpoodome  fvt s  2tr(mpou0olxoii3iasla ea(vonu0teerxf3oatlp rlivi t  2urxmpiodll  lnvsat)aDtru  ;t0opx mf3iad a eaumpnt4tltnircoodfatelnvo s srxmxrpiodopt lnetasfsrra(rpnt1tpxn i3ilt mDulnmsnt)aetrxr iydopDrli ils0setoio ou1lltn ictlt)sDtmx ono4oet  o3tyt aDumn snt0aetrxo iytfpDe ues s) 2trxm nudom   ivtl()s2trurpno0olen fciat a rmnms;t0 leoiocoodom rlivols s2uoir3nu1lm nmfes ()artr(m ou4optn icias sDrl(vs u)teermr oy1oa eau s;( seuoxopiu4lmte netlt)srrrxronu4olxomoeiysls eanvpn() lenxo tydom eai o s t2trir no4omtemiei s srrr(m ou1tptomoeiydlm ua(vs u4aexrxr3oytfa r ivi (0seto(m3ou1ap   neil(  rtm(r ;o1tlx  fctyd m ul(mont)arermo3iatfp  auvs (0s2xmxm3oydomeelicilt sDta(mooo1olenio3iysfa2ulnmo;(0aetrmf3oydopD aueo t) 2xrxm3nudom nlfct s)arur(m ;t1tlto fciat aDelu o (0 lxomrctydlatrlnvo s) 2xm(r iu4olenmfeil(f Dtrx o;o1olen f3iyd s uauvp t)aexnmrciytla eli o;t  rumiopou1om nlfetlt)srururoou0tpenmicilsfs um(vs;u4trxnmf3io1om  lnei;s s2toio nu1am n ict tf rrrxrp;t4openmi3iys mDeln o t4trtoxf ootlaD lu s;t)trxr(mpiu1ol n fcsltfsrua( pno0tle mf3ilsls umuvs t4texomo3iodom ranesls)texr(r3iu1omen nvslsf Dtrxm ;u0optnif3tyt a rmumo t)aeerir3iodlpD  neols  2to(rpnu1lle livt sf ruau ont4tlenifeilt m ul( p (0tleoifctytlp eaieslt  2xm(m iy1ap  mneia()arum( oot0aetniieiltlsDemnvsnt) etoxrctadlmtrlneolt)seurxopiudalee nvi sfsDrmx  ot4tpxnmoeiydlsDraums;u0artnmociytla r i s;()srumxo no4amt  fvtas a2umxmo;u4tpto oeild a rmumpnt4arxrxo iadfpDrau o s  2to(r3nu4op  mnet (fsDraurpot1oeeo octltla2umnvp;u) leoxf ootfpteaneo;s0t2uoxopoydal  mivias  2tmumo;u1oexn icilsfa eanms;t)tetoifctotfpD luvi s)t2trxm iudalt  iciatf Dumxmpot0olxomiciat m2ea(mp;t4aexriocoatom  luei ( sruoim io1apeelicta(f Dtmur no0tpeomietlt aDelu p;t4 renmo3todfpD ln il()trumxo oudol elnesl(  2ua( pou0apt io3iat sDrau s;u)aeeoif3iy1oa e nvols  2xmirpio4op n nesasfsDtrur ;o0aptnmociatlm ranmonu)aetrmo3ootopte nesl()sruoxr3iu1al n ncias)aDtmx p;u0tet mfctas mDelu p u4aexrif oodfmt  ues () 2xm(m oydll  mfviltfs2rm(  nu0aexnmiciysfs2rau p t0 lenxociytlpt lu olt0 2xrxm io1oltelnvs s)aDtrumo;t0tltnmf3iasfs rau p t)tlxoxrcoadop r uvslt teumim3nu4lmee net t)arrrxm ou1aeen i3ias mDrl( onu4arxoio3ta1laDeln s s s2tmxr ny1ll n ivi s  ruru pno4tlt mociyslmDran onu)tltoxr3iytoaDr ivs ( t2toxo3nudoptnmici ()aDurx  ;o4alenmociadfm2rmn s;u0 eenxr3oytoatr ieils teto(r iudlm e nctasf rumum no4tpxn o3tyt m2emnmo;() rxoir iytoa  lnvol( sexrxr iudomeemfesat a2taxmo;o1tpxoioctyd mDrlnvo;t)aleoifciydfmD aivi ()teto(r nydlpt lfvs tf 2trur ot4alx iietysla2ran p;(4trxrxf3tydlaD lu ilt0teurir oudamtn iesat  rur(m nu1oltnmociadfm2ra( s (4 exoio3todfat ln i t) exrirpnodamtelnct (fsrrmu pnt1oexn ieiydfaDranms t0 leoio3tadom   u s;t srxo(r nudlpe mivsa(f rtaumpnu1altnmi3ildfm emn snu)tltnxfcio1fa r n i s)trxoxo3iudlp emnei t) 2trur nu1alxoioeiysfm umumsn(0arxrxr iatomteauvo (0s2trim ny4lpe lfeias)a2ta(  no1apxomi3tytfa2uanms t4arxomr3totlmt luvo t  rurxopiy4lpt lneilsfa2trump;u0tltomi3tytlaDulnms;u4trtomf ty1fpDeln o;t  rxm(r3oy1lpeemfvs (fs2ta(ro;u1aetn iciytfa2um(vpn(0trxnxf3iy1fpte nei;t0tetmxo io1amen ictas  2rr(r nt4opeoioctyd aDuanmp;u0arxnio3iodfaD luei;t)srur(mpiy4lp  mieta( a2rmxronu4oeeo fctyd s2ua( p;t)alenmf3iytfa  luvo t seum(o3ny1am elivi t)sDurx  ;o1tpto oeiadfm rluvs;()aetnif3ia1fmDeauei;s)setmxmpnudlltemncsl() 2ua( pnu4apxn oeiatlm rmn o (4trermoctotomte neil()s2urim3nodomtn fvtlt) 2rmx p;u0olxo oeias m2rluvo t) rtoio3oatfmDrlnes;t trxmxr oodapt miviatfarta(mo;o4oltniicilt s em(mpn(0texomf oytoaDe uvol(0s2uoxr3nydalt livt (f Drrxronu1tptomiciatfmDra(mo;t)artnxrciytfat lneils)srtm(r iydol e ncias  rumxm no0aetnmieiydls ulumont) rxnif oydlmt an s;t  ruo(r3ny4lmenlnet tfaDtr(rooo4opxnmocilslaDel(mo u0treoir oodomt  ivs t s2uoir3ou1om elfvtlt srtrurpoo4texnii3ildfmDrm( pnu4 leoxr3tydlpD lnvs (0t2uo(rpnu4ll n fvsa( a2tr(r nu0olxnmoeiyd mDemnmo () reoxoctotlaDe i o t)s2trxm ou4amee feilsfsDtax  no4aexn oeiasfm eauvp;(0 etnxf3tatlmt luvi t)srxrio iudlpenmivtat sDta( o;t4teeomf3iyd aDrluvon(0artrirctotlp r u ols  etoxmpou4am n ici t) rur( p;o1apt  f3ilt a uanvpnt4 exrmo3iydfmt aivs;s0trxm(o3oy4lpt mnvsl() 2umxr no0aetoifctldfm2ean p t)aleoxr3oa1fmt anvi ( t2xoxr no1alt liesl()sDuaur oo4tlenmiciat s rluvp u4aeerxr3ty1fmDr uvs s0srtmiopnudomtnmnciat)s2tmx o;t4tlxniieiadfsDumu onu) lxoircoytfatrlnvsls0 rtm(r3nodlmtnlfcs t)s2tm(ro;u4tpx  f3iadfm2eauvs (0tlxrifciatomDrluvo s)teum(opnodal emnvil(faDumumo;o1oltoio3tyt aDrauvpn()tltnxr totlm rln o;( trxr(rpny4lmt  fvs t) Dua(ro;o4olxnmociad m2rm(vo;t)tleomfcoy1om rli s t)trur(rpny1amee fetatfartm( pou0tpt io3ilsla ul( onu) rerxr oy1op eai slt0trtriopny1lptn nctlt  Dtmxroou1tltomfeiatfaDrmu on(4alxnmoctytlptelu ilt0sruoxm ou1am nmfcs s s2trx  ot0tltoio3tldlsDrm( o;() lxnmocootlmDrai il( teumio3iydomt mnvs tf Drau p;u4oleoiieiltlm2ran sn(0alxrmf oatfmt  nes;s trxoio3iodlmtelieias  2rrurpot1teeoifciys a2ea( pnu0alxrmr iatlaD aues s  etr(o io4al n nvs () rta( pno1olx mi3iydlmDemnvo u)areomrcoydfpDr i s;( truoirpnodlle liesl( aDur(rono0tpx iietasls2em(von(0tetnxrciotfp rluvi ( srxo(m3iodole mfvi t) rtmxmpnt1opeoioetls sDeauvpnu4trtrmo iotom rau s t  rur(opiu4op nlietatf 2urx  nt4opt  fciltfs ra(vp;u0 rtnir3ta1fmte i i t)t2toxo io4lme mfvtls srra(mpno4apeo iciasfa ranvp u0 lxoir oodfateauvi (0 2uoxrpnodomt mictls)sruauroot0aee miciydfm2ul(mpnt4 eenif iy1lpD an o;t  2uo(m no1lle liesl(  Dta( ont4tpto f3iatfmDran o t4 rxnmo3oydla  auvo;s)trumxo3nodlm nlietat) rrmxro;o0tpenmiciysfsDrlnms ()texnmr iotfmDe uvi;s)seur(mpoy1lm  mncsls) 2rmumpno0texoifctls mDeanvon() rerxo3oa1opD  neils seuoim ny4op emiciltfaDumxro;u1tpe ifetlsfs ul(mo u4treoio3io1opDe ues;t) 2umir3no4apen fvtlt  Dtr(r nt0open f3iltfm ul(vp;(4arxnif3iotop  ai sl()t2xoxrpoudapte nei t a2ururo;t1tpx  ieilslsDeanmo;u)tleoifciy1oaDraieo;s0srtmxo oy1ol   fcias) 2rr(r ;u1tltomi3iadfaDem( s;t0altrir3oatfaD li ol( tetoxopoo1om   nvt s) 2urxr ou4oetnmfeiydlsDrmnmpn(4tetrmr oatopte nvs;s  rxrim ny4op nmnesls) 2trxr ot4tlxn octadfsDua( o t)teenmf3oydfp   iesls0sexrxr ou1ol emieias)sDtmxroou1aeeomiciytls2emn pnu) exoio oatopDeanvo;s s2ur(o3oy4ap  lfetls sDrm( onu4oetomoetyd a2ea(vo (4tleoif oydlmt  uvolt0srxmxopny4oltelict t srrm(rp;o1aeeo o3iytfs emnvo u4 rxnio tytfa  liesl(0trurim oo1aptelieta( a2tm(m ou1opxoifciyd m rluvp t0arxnxrctydlp  auei;(0 2tr(m oy4lpenlnvtl()aDrm(mo;u4aeenmoeiys sDel(mp u)teeoio3to1opt au ils0 rxrxrpoo1opt micia()s2ta(ro;o0aee  f3iltfa rmnms;u0 eeomrciydlat  ivo t)trumxr iu4al   fvtas srrrumonu0aexnmf3iadfa2ea(vp u) ltnir ia1omte u s;s0sexm(o3oudomteliesl(faDtmx  ot1aee  o3tad s ranvs;u4artnmfctydfptr u o t)trur(o io4op   ieias a2raxr nt0tpe  ieilt s ean o;u) lxnxrcoo1fmD lu ol(0s2to(r nu1lpte icilsf rrr(  no4aeeo i3iaslaDea(vsn(0 exriociadfp raneol()tetr(r ny4optnmfcilsfaDumx onu4oex  fciltla elumo (4alenxr iytlaD  uesl( srtmimpoydam  lfeils)aDtaxroot1aeeoiociydlsDuluvp;()aexriociotom  lies (0t2trio oy4lm   feta(f 2tru o;u0tee mietatfsDea(vo;(0areoxocoatomDelies t truoxm ou1al nliet (faDtrxm oo1ale iocilsla ran s u4aetomo3ootoa   uvi;t0srxrir no1omeemfvia( s2tau  no4aee  oetyslm elumpn()teerxr3iotfmDraieilt)tetoirpnu1alee fvslt) 2taumono0aexomo3tysfsDelumont0aexoxfcta1om   ivi;(0t2uoim3ny1optnlivtls srrrurp;o4altomo3tysfsDrlnvs;u) rxnmr3ootoa elnvo;t0s2xr(r3oy1ol   fvi s  2ur(mpou0apt moeiydfa emn s;(0texoxr3ootlpDr ivi;(0teumim nodale mivias  Drru p;u4opeo f3tltfa rl(mp u0 lermf3oydoat anvi ()setrxm3io1lmtelfvsls aDtmxrp;u4oee  ociaslm uaums;t0tlerir iydlmtrlu o s s2xo(mpou4apeelfeia(f rtaxr ;t0tpeomi3iad a um(mont0tlxrmr oa1lm  ln i;t)srtmxo3oo4ol  livia( s2rmuroou4aeenmoeiatlsDuauvp t4tlxrxr iy1om rlneo;s  exoimpno1lm e nvils)sDtmur oo0tleo oetysls2emnmo;(0 etoifcio1faDrln i;t0teuo(o oy1amte ivtlsfa2raurpot4opeomi3iyd a rlnmo;u4 exoxf3ootla   nes ()setoio nydom e iet t)s2urx  ;o1ope iociltlm2emnmo;u0alxrif3to1fp eaivs s) 2xmxo no4ape mivtlt)aDrmu ono1aet moeiasfs2emumo;u) leoxo3oadfpte ivo s)t2urxr no1alen netl() Dtrxmoou0alx mfcils m2ra(ms u0 exoxf3oa1fpDr ivi t0srumxo3no1amt  ivt tf Dtm(r ;u0teen ociysla ul(ms ()aeeoirciydlm eai o;()s2urxrpnu1amenmfvtls a2truronu4oee  fcilslmDul(vp;(4 exoir oodlm e uvilt0 2tr(rpoydale  fvilt arra(m nu4oetomfcild s2rlums;(0aleoxr iodfpDeaneils) rxm(opou1lle  iet s s2rmx  nu1optn f3ildla2ea(msnu4aetrxr io1omD  ieslt)seuoxrpou1apt  ivils)s2ra(monu1alx  feils a2emu ont4 exnxf3iotlaDeli s s)trum(r3no1oltnlivia(farur(  ot0tlt  ociatfsDean p (4trtrio3ia1oa rli s;s)trxmxr3oodam nmnvslt  rrau p;u4tpxnmietyslmDrlnms;() ltrmoctotlp r uei;( s2to(mpiudamen fcs (fa2uaxmo;u1optn f3ilslmDumumonu0 lenif tatoatraueil()t2xo(o nydol elics ( arraum no0tptoif3ias a2uan s;u)tlerir oodoatran ils trxmxo iy1ope  ivilsf Dumxront1tpx mociaslmDrmuvp;u4arxnmfctatlm e nei ()srurirpoy1om e ict t aDrm(rpno0opxo ieiysfaDeauvpnt4 exrmf3tydlatraivolt0srxr(o iu4ome mict tf rrru  oo0oltoiietysfs2ua(vp t)arxrxrciatop e uesls0t2tr(opnu4apeemfvi ()aruaxrp;t4oeenii3ildlsDuaumo (0treoxfctadom  lnvi ()texm(rpny1omenlfes ( aDraxmpoo1apenmfciysfsDeanms;t0 etomr iadlpD  nvsls)tetrxo3no4ome mfctasfsrtm(mpnu4oeto fetyd a2em(msnt0aetoifcoatopDraiei;s0 2um(r no1lme  iesltfsDtmu ont0altoio3tys a rlu s u)texnir3oa1opt lnvo s s2tmio3iodop  lfeia() rumx ono4olx  fetat m ua(ms t4 rtoxo3iydlpt aieols)trurxrpoo1oleelncsl(  2ta(  nt4tlenmfcias s2ul( s () ltnxf3tadom r neilt0s2trio3oy1lm   icilt)sDuaxm no0oex io3ildfa ea(monu4 rerxf3tytoptranesls  eurimpiy1al n ncs s arumxm ;u1alx  ictyslaDel(msnu4artoxocty1faDelu i (  rtoio3oy4ameelnetas  Dtaurpot0tet mf3iydlm2rm(ms;u)tlenir3oo1fptr uvilt0 2xmxr3nodlltn ici s)s2uaxrpou0oltoiociytlmDeauvp u4alenxfciotfat ln s s0 eum(m io1om elnctltfs2rauro;t4texniieiyt m umu o;(4altrmrcoy1oa   n o;s  rxrxm nydopee fvt s)sDum(r ;u0tptoifeiadls2eau pnu)trtrxrcoy1lm eauvo s)teuoxr iu1llt  icia(  rumu o;t0tpx mieiat a2umuvont) rtrif3io1lmD luesl( sexmirpio4lp elnesat  rur( o;o4olen i3iytfaDraumpnu) rxnxrciotomD anvil(0 exrxr3no4lpe lieias aDua( o;t1apto o3ilsls2eluvp;u4 rtomrctotfp e uvilt) 2urxo iydlp elfvil() rtmxmpoo1oexomo3iat aDulnmsnu0trtomo ootomD anvi;t0srxriopoo1ap n fvil()aruaxm ou1tpen ociat sDeln sn(4 eerif3oa1lm eaneo;s srxm(opoydameelnci tfsruax p;u4tltomoctlt s um(mp;u0trtrxf3tadfmDelnvilt  rxrxo oy1alt mfetat artr(rp;t1olx  fetadfm2em( on()
\ No newline at end of file
@@ -0,0 +1 @@
+uvsls0s2uo(m3nu1olen feiltf 2rru  ;u0tpt mietltfm rmu on() exnxo oytoate nvo ( setrxo nodomte fcias)srtr(root0oeeoiieiytfa2emu s;u4trxrxf3to1la   n sl()srxm(rpno1lmtnmnctls  Dtaxm ou0tpt  ociysfm2ean sn(4 renirciatlptraneolt t2xrxr iu4lm  mfetlt  rrau ooo4opt  ieiadls2ea(mp;(4 exnmf oadlmt  i ils) eto(opoydopeelfvsas)sDumx  ;u4aexo o3iysfm2uanmo;t) leoif oo1op r ies ( texmim3oy1omte nctlt sDtau  ;o1teenii3iatfs2rm( pn(0 ltrxfcio1lmDe u s t srtrimpno1opeemiviasfa2uaur ;o0tlt  feilsfmDea( ont)trtnxocoydoaDraieo;(  2xm(r3io1amt  ncs ()sDur(m nu0aeeoifcild a uln sn()alxnxociatlmtrln ols) exrxo oy4om emfeiasfsDtmum ou0aexniietytfm2uluvs u)aetoir3totfa r iesls)teuoxr ou1ome lnesltfa2taum nu1tlto ictadlsDeluvsnt)artnmo3iytop ranvslt0s2triopiudame  nvs tf 2rmur ;u0tex  ociat mDul(vs t0alxnif3ootfa  luvo;s0sexm(r nodlmte nci (f Duaumonu1tptnmociyd m rm( pnt) etnmrciotop e uvols  2xrimpiodlpe lici sfsrra( poo1tet ifcilt m2rm( ont0areoircoa1lpt an o;t0truo(o ou1am e icta()srum(r ot4alxnmfetldfs uaump;(0 lxnircoo1lpD aieilt0tetm(m3iy4omtnmncsasfsrtaxmpno4tlxnifeild mDrl(ms ()alxnir3oodfp  auvo;s  2xoir3ny4omt  nvi ()s2tr(r ;o0oeeo feiltls2rmnvs;(0tlxrmf oa1om eaiei;t s2umxo ny1ll e iesas aDta(rpot0optomoeiydfm rmnvo;() exomfctodfmDr ies;t)t2xr(m3no4lm  mfci ()srraxm ot4aetn oeiyt m ranmp;t)aeerxocoatoate i o () 2xrxrpoo1op elnvtas  rtrumoot1aee  i3iatfs2uln snt4texnxfctydfm  li o;s0srumiopio1ap nmfesasf Durx pnt1tlx  iciasfsDuluvo (4 leoif3tatlmD liesl(  exoirpny1al  mnvsatfsrumx  ou0texoioeilsfm umnvont) exnxrctadfp rlivslt0 2tmio3oudopeelneslsf rrrxmo;o4texomf3ild a rln p;t0 lenifcto1la  an o;t0 etrxm3ny4lmeelnctls)srrauronu1tlto oeiat aDem(vo (4tleoxocio1fatr nvo ()tetmir iu4altn ietas)arumx  ;o1tlt mieilslaDrlnmo u4trtoio totoptrau o;t  etoxrpoy4ol emnesl( aDraumo;o4aet  ocias s ra(ms;(0texomo ia1lpt aieo () exrirpou1altnmneils)a2um(m ;t0tlxomocilsfmDemuvo;()teerxf tadfaDelueo;s0sexr(r3iy4omtnlnet () 2umur nu0teenmoeilsfsDrmnvp u0artnif totoa  lneil(0s2ur(opnydale  nct sfs2rm(rooo0alx mo3iytfmDuanvont0trenirctotfateln s;() eumxm oudole lnvs t)sDtax oou0tle  o3ilslsDean pnt4tltrxo ootlmDeli s (0 exriopoo1apte fcs ()sDururp;u1tlenio3tys mDemumpnt4trerxfcio1fm  livo ()s2ur(opoo4open ivil()sDtrxmo;t1apeo i3iat m2em( s t0texnir oatomD aiei ( truoiopny1al e fetat)a2uau p;o4aeeoifciaslsDra(mont0tetnmf oadlp raiei;t0s2ur(rpnodop  licslt arra(  ;u0olxnifetltfa rauvs u)tltoir ootoa   uvi (0srxrxrpnodlm e fcia() rurumooo1alenio3iyslmDumuvp u0texoifcto1lp e uvs t s2xoir3iy4lle lneia( aDrrxmont0alxnmfciytfaDulnvp;(0aexomrciodfa e uvo t seto(mpno1llt  ncs t)arrmxmpnt4tleoiicias aDuaump;t4texoifcootom elies (0trtoxopno1ap e ictlsf rrruro;t4aeeo ieiad sDeln o t)artrxr3tydfa raivs;s)t2ur(r nodopte ivtat)s2tmum ;u4ope moctatlaDrmn p u)aetrxo3iadfm raues t0trxmxmpny4apeelfes ()arra(r nt1oleomfcild sDrlums;t4arerxr totoaDrluesl(0 2urxmpoo4ol e fci s)s2rm(mont0opt iictydfm2ulums t4teenxrctydom  lnei;s0seuoxrpiu4open fvta(fa2uaxmooo1aptnmf3ias mDrm( o (4tetnif3tytfp   neo;()seur(o3ou1lleelfciasfaDuru  no4aptomoctydlm2rmums t4tltnif3oo1opDr u o;(  2trimpoodoptnlfeiltfsrum(rooo4ape mfeias a rlnvs u4alxniociy1fa   ieo;t) exm(mpiu4al  lictas)s2tmumo;u4olx mo3iasfaDea( o;(4arenio tydomDelivs;s)seuoim3no1alt  neil( a2uaumpnu4apxo ieiatlaDrluvpn(0texnmfcoadomD  uvilt) 2tmim iy1ll elfct (faDur(  ;u1alxn i3iltfsDeaumo;(0trtnir3ty1omtrauvo;(0 etoir3oo4optnmnvilsfsrtaumo;o1oeto i3iyslaDeaumpnt4artrmr totfpt  nvi (0 ruoir iy1lpenmivtl( srtmu  ;t1opt ioeiydfa2rln p;(4altrio oy1lpDranvsls)trxoxo3iydllenmivsat) 2ra( ooo0tlxo fcilsls ean snt0 eeoxf3oa1lmD aivs;t truoxm iu4al nmneil( aDrm(ro;o0optn ieiaslmDumnmo ()teenxr3oodoa rluesl( s2xmir3oo4ole  fviltf 2rm(mpot4alt ifciysfaDrmnmpn()tlerxf3oatlpteln ols0t2tm(m3iy4opeemnviltf rtax ono0opeomietasls rluvo;u)aexnxo oo1faD luvo;(0trxr(m iodalt mict () rraumooo0tpx ioeiad s2em(vsnt4teeoio tadlaD lieilt)setrir3iydoptnmicta(f Dum(  ot4tpx mf3tat mDra( o;()altrmrcoodfpD  nvo;(0sruo(o nu1lp  lnvia( a2uru ooo0tex mociad s el(ms u) eeoio todopD an i;t)tetoirpoydomeelnei t)srrrumpoo0ale mociat aDea(mp (0trxoir oodoa  anei;s) exrxo3nydlmtemieia(f Dra(m oo1apx  i3ias aDem(vont0tleoxr oytfaDraivolt)teuoio nydameemivia(fa2urumpnt4opxn o3iltfa uanvont)tlxomfcio1om rli i;(0 2umxr3nydoptemieslt) 2ta(r ou0oeeoif3iadfs um(mp;t4arxoxocto1fpDr iei;s trxr(opou1opt mneil(fs2uaxro;t4tlt ifetadlmDrlnms;(0arermf3iadlp  lu o;(0seumiopou1lpeemieias aDua(m ;u1ale mf3tlsfaDemnmsnt)artrxo3ty1fpDelueo;s srur(mpoy4ame  fvia(  2uax  ;u1ope mo3ias s raums t)altnxrcoatfm rauvs;(0t2xmimpny1ome lietl(fartmu pnu1tee  i3ildfm ulu s;u4 leoxr todfpD aneslt s2xmimpiudlptn ics tfaDurx p;t4oee  ietasfa rm(vont0texomr3iydla eauvo;( s2toxrpny4ol  licilsfaDuaum ;u0alxoiieiasls2el(ms u0 lxrxfcty1oa rlnes () rumimpou4lp   nvtat  rra(rpnt1olen fetaslm um( snt4 eenir ootopD auvs;t0 euoxo ou1am   fctlt)s2tru poo4opeo iciyslm eanms u)aetoxrcoo1fpt auvo ()srxrxmpio4om n ncsl(  Dra(mpoo1apxo oetlsfs2ranvs u0tltnmr3iadoaD lneilt s2uo(m3io1openlnvia( s2um(r no0opt mfeildlsDuan snu0 ltrif oadomt liei s)setmxm oydaltelnctatf Drr( ooo0tpx  ieiatfsDea(msnu4texomr oodomte u i s t2xoxopno4olt  fviatfsDur(r no0olt if3iatla umnvp t4 etomr tytlm r u ols0s2toim3oy1lmte feia( s2umuroot0alx moeiat s uln o (4tlxnir oytopD aieo (0sruo(r3io1lmt mivtlt)s2tru p;o0tlenmoetat m rmu s;u4 etrmo iadoaDelnvil()teto(m3iu1aleemieta(faDum(ro;o4tle  feiytlm rluvo;t)tetrmf oodfmDrli sl(0srtoxrpiodalee ivtlt)a2tau ooo4oex mi3iys mDuluvo;u4 etnmf oytfaDelueols)sruoiopnu4lltn fvt s)sDrr(moou4aeenmiciat a uaumsn(4treomfcoydoaD aneils0 2um(m iu4op emivt (  rur(mpoo1tltomoeiatfaDrauvp;(0alenif3oo1fpteln i;s0srxm(o io4al emnctlt)srtaumo;u1opxnmi3iadlm2uaumpnu0arxrmociydlmDr u olt sexmxo3oo4lptnmics tfa2taumpnt1altn oeild a2rl(mon(0altnmf3oa1om   iei ()srtrir3iy4lm emfvsat) 2raxmo;t4ape iociadfsDrl(mo;u0teeomo iatop elu i;s0srtr(m oo4al n ieilsfarum( p;u4oetnmoctlsfm ulnmon(0tetomocoo1faDrlieo;s0s2to(opiodape livia(farrmxmoou1texnifetadls rmuvo ()tltoiocoodfateluei;s0srtoxr oy4om nlnetl()s2rrx  no1tlxoif3iyd m2em(mpnu0 rxoxocoy1lpDraivsl() rur(mpiudlp nmnvi (  rtrump;u1tpenmoetatlsDrmu o;(4 lxrmfcta1opteai i s s2uoio iu4ope  ivs sfs2rm( pou0alx  iciydlm ul(vs;u0tlxrxoctytomDeau ils setrxm3oydlmt lfciasf Drmx ont1oeeoioetlslsDraumpnt4aeenio iatlm rln olt0 2xmim3oo1oleelfctlt srrr(r ot0tpt mo3iydlsDumnmp;u4texomo iotopDe u olt) 2urxmpny4omtemict t srrmx pot1tetoiietad a ranvpnt)tlerxfcoy1fa  auvs;s0trtr(mpnudlptnlictat) 2umxront4oexo i3tytfm elnms t0 rxrifciydfpD  ieslt0sruoir nu4ap nmictlt) Drr(mooo0oetnioetasfm2elnmonu4 ltoif3oytfaDr ivo;s t2trio3no1lptn fes (  Dtaxr ;o1apxnif3tat a2ra(vs t0texnmo tadlp   u ols0 ruoxm3nodalt  fvil() rua( ont4aet  o3ils a emu p u0trtrmf tadlaD ln ilt) etoxo3nu4omtelivtatfs2umur ;u4ole mi3iltfmDumnmp (4treoio3iodom e ues;s) 2xr(o nodamt  feilt)sDua(rp;u1tlxn fciad a ra(ms t0aexnmrciytlmD au i () eum(mpiy4ope lies ( arur(rpot0optnii3iys a2rlnvs (0trxnircoatomDrln i s0sexoio3oo1om  lnvsat  2rr( pno1texniieiadfa2el(mp (4tleomfciotomDeliesl()sexrxm3iodolenlneta(f rua(rpnt1aeeomocils sDulu s;()tlxoir3oytfmDe ueil(0 etoxrpou4amenlfcsl( sDtm(mooo4oee ioetlslsDrln s;(4 leoxo3oatomDeli olt0sexrxr3no1lpenlfvsatfs2uaum ;u0tpxoio3ild aDeluvp ()aexrircoy1fpD  nvol( s2xoim ou1ol nlfctlt a2uaxm ;o4oet io3iaslsDuan o ()trtrio3ia1lm  livi;s  rxoxr3oydlmenlfvtls a2umxr ;t1tpx mfeiadfaDelnmp;(4tlxnmr3oa1fptrluvi t0 2xm(m ny1am elfei t)arurx p;u1opeo iciltla emnmo;t) etrif3oy1opt lueilt) exr(r oo1llt  neta( srtru o;t1tlx moeildlmDuanmsnu4tltrmfciatomtr ivs;s  ruoio nodaltnmfes tf 2rruroou4tpt micils m2ra(mp u0 ltomr ootom  lnvsls t2to(mpoydamtelfvs t)srtmxmp;o1apxn feiytlm rlnvs t0tltrmrcootfm raueol()t2toiopnu4ll nlicsl(fsrum( ont1tlxo oetatls2elu o t)alermr oodomD au il()s2xoiopnu1om nlfvta()srrmuront1texoioetatfs emuvp;t0tlxrxr3ty1lmtrlneilt0 eumimpiy1optnmfvs (faDra(mpnt1tlxnii3tldfa2ul( s;t) etomo oatlp  anvo;t trtoio nu4lpt mnvslt)arurum oo1tee moeiytfsDrl(mo;u)arenmo oatopD  iei t trtoxm3ou4lm nmfct t  2ta(m ou1aex if3tltls2uau o;u4arxnxocio1lmte uvil()s2xoir3no4alenmnci ()srtrxrpot0tetnif3tyt s emumpnu4 lxnxfcto1fpDrluvs s)s2umxmpiydame mnviat  Draumooo0aetnii3tld a2emnms;(4tlxomrctytfmtr ivils)s2ur(rpiudllt mivt t aDrmu p;u4apxn i3iydla elumpnt) etoxfciytlatrai ilt0s2xrir oo4lp   nctatfsDrax p;t4oeeo iciysfa umu s;u) etoxr3iadlmtrauvs;( s2trirpoo4lmtnlici s)aDtaxmpot4tlxoifciysfaDeanmp;u4 exrxrcoodoate neo (0 ruo(r3ou4oltemnvs s)srrrx ont0openmociatla elumon(0 exnio iodfateli olt0t2uo(opnu1lleemfvtl(faDta(r ;o1aee  f3iadfa rl(mo t0arxnir ty1omDe i sl(0setoir nodop elivsls)aDumxrooo1aleoif3tlsfm ra( p;u0arerio3tadlaDr n olt)srtr(opny4op  mivta()aDur( p;o4apt ii3ilsla rlnvp t4artnio io1lmDran o;s sexoio ny1altemncs s s2rauroou4oet mfctydlm2emu s;t)aeerioctadfpD aneo;t) 2umirpnu1olenmict t aDua(moou0olxoif3ildfs ulnvpnu)trermocto1om r iei t0t2um(m3ny1amen net s s2uaxrpoo0oeto f3tyslsDumnvo ()tlxrmf3iotlp rai sls0t2xm(o oy4lp  lfcilt)aDraur no1tpx moeild m2ran p;u4 rtnxo3oytlpD  u i s0srtrxrpiudol emfvsat)sDrmxm ;o0aeen f3tasfs rlu pnu4tleoif oadfmtrauvslt0s2xm(o iy4optnmict ()a2tm( o;u4olen oeiadfa rmuvo (4texrxf3totomtr i slt0seuriopnu1olt lfci tfarur(rpot4apen feiyd m eauvs;t4teeniocootoa  li ol(0s2trxmpoo1apee nvsl(f Dumx  ;o0texnmfeiydls2eln s t4tlenmo3iy1fp e neo s)t2uoiopno1amtemfcilt) Dtrurpou4optniictatfa uanvo;u)tltomr3iydfa eauvs s0teto(opoo4amte neiasfa2ua(  oo0texn fctyd s2umumpnu) leoxo3totla   iesl( trurxrpnu1omenmivtls sDrmxm oo4tetoio3ilsla elnmp;(4alxoxocto1fmt  ueo;()seto(r oudllee ict (farraxmpnu4olxoiocias a el(vp;()tltnxrcty1lmD lnes;s srxmxr iu4oltnmnvia( s2rmurpou1tpenmiciysfs2umn o;(0artoio tydfmteanei;s0 exoxr nu4olen fcsa(farurumono4aex  feiad m uan ont0texoifciy1opDranvi;t0 2urio no1altnmivtat sruax poo0aleoif3ils sDeanvonu0trxrmocty1lm  auei;s)srumir no4om emnes t s2ra( ono1tetniieildlsDem(vpnt4 rxnxr3oydoptr u i t)s2tmir io4lme  fes (fs2ua(  ;t1opx  f3tysfaDraumo (4 ltrio tydoptraieil( srtoxo3nu4lme livtat) Dtm(  ;o0tlxoioctysfm eluvp;t)alxrioctatfmDraieils0texmim ou1ol n nct () Drmum no0oltn ieiytfm2emn p;t0aexrxfctodopDrai s t0s2xoiopno4olt  ietls)aDtrurp;u1ale if3ildfa2ranmo (0 rxnxr3ootla r nvsls)trtoir3ou4omtnmncsls)arua(ro;t4ope iieils m2rmu o t0tlenxo oo1oa ean ols0 rxrxm oodal n fvtatfa2umuront1olenmfciaslm elnvs (0 ltrif3oy1oa r i s s0s2umxm3iydameemivsas)aDra( ono1tpt mociatfaDelnvs (0trermfcia1latrlu s s)srtoxr3oo4al elictl()aDrmxroot1oeenmo3ildls2rmnvpn(4tlxnio iy1fateanvsls0trxoir3oydap e icil(fs2tru oou4oetnifctys m rlnmo t0aetrmfcootlm  ln i;() exmxrpou4opee nvtl( arrrumpoo0tpxomieiys s rmnms;u4trtomf3ta1fa   u s;s) etrxm3nydoptelivt s) 2tr(mpoo0aee ioeiyt mDrln s t0 ltoxo3totlmt auvil()sexmirpio1oltelfeta(  Dua(m nt0alt  o3ilsfm2rau ont4tltomf3totfa eln i;()s2umim3nu1lp nmiet t)aDraxm ;u4aetoiieias m ul(mpnu0 exoircta1faDrluvsls) rxr(r iu4omeemnesa(fa2tr(ro;o4tpeo i3tadlsDua(vs u) eenxo tatfa   i o;t0 rxm(r3oy1amtemfes t)a2rmxro;u4olto o3tls mDuauvonu0 etnxfciodfptrau i t0s2tr(m ou4ole mnctat sDum( pno1apx io3tad mDumn s u0aetrircoy1latelivsls) 2xm(o3oo4al elfvi ()s2ua(mpnu0tpto o3tadlm uaumsnu0 ltrxoctodom  auvi;()t2uoxr ny1lpenmfvs t aDraxm ot4alx ii3tltfs ua(vo;(0 exomocoytoatr ivs;t)s2um(mpno1ale mnvt (fs2rm(mp;u4apt ifeild sDemumo u4tlxnxr3tydlatrlnvilt0s2tmxo3iodop  mnviatf 2rr(rooo0aptnii3tysfaDrlnmp;u4texoxr3tatfp   i o (0sexrirpio4lptn nct t srra( p;o4olenifetltlm2umuvs (0 rxnif3ta1oaD lneo;s0seurim nodlmtnlfvs t)srra(mp;u4oet  oeiad s2ua( onu4areoifciydoatr nvo;s seurxm oydlmtnmnvi ()a2uaumpnu0teen oetltfa2uan sn(0aeeomo todfmteluvolt)s2trxmpny1ape lneiltfaDrrumo;t1tetomfciltfm2umu onu0 lxrir3iodfmt li s;t)texmir iy4op nmict (farur(mpoo1opxo iciys sDel(vs;(0 ltrxf tytfa  luvs t  rxoiopiy4lm elnctlsfaDrm(  ;t1apxn ieiad m eauvp u4 rxrmociatlmDelies;s) 2ur(opiy4omtnlfetls) 2raxr ;u0tpxomo3iys m emn ont0 lenio3iadfa eln i;t)seurir nydlme livtlsfsrtr( oou1aeenii3iysfmDul(vo t4 lxomo3tadlatrlu o t s2xrir oodllenmnvil( a2ua( o;o1aeenif3ildls2ra( pnt4arerxr tydfmDelivo;s  2urxm3iydlleemici s)arta(ro;t4tet ifciasfa2ra(vp;u) lenxf to1fpDeau i;()s2tm(o3io1aleelnci sf 2trxronu4tpxnmieiltfm2ul(vp t0 lxoxo ia1faD aiesls0 rur(o nodllt mnvias)s2uau oou1olx ioeiad m2umn p;()trerxfcoadlm  aieolt)teuo(m ny4ap nmfesat a2ur(moot4openif3tydlaDua(vont)tlxoxr io1fpt lnvslt  2uoir3iu1lpe mnctlsf 2ta(mp;t4opt ii3iat m2um(vonu4tlxnmo3oy1lmD auvo;s0teumxo3oo4ame  nctat) rra( poo4altoifctatlm rlnvs;u0trtrmo oytom eauvi;t0teuoxo3oo1omtn iesasfs2rmurpnu1teeomfctyd aDemnvp;t)arenir oatoa e iei s0teuoxrpnu4apeemfvi sfaDurxrpno4alenmiciysfsDrluvsnt4 rxrio3iodlm  au s;s0srtoxr3nudam elicta( arua(rp;u4tlt moetys m rlnvo;t0alxomo iytlpteaivs;t0t2xriopoo4lle  nes sfs2urxmoot4oeenmo3tls a rm( s;u4 lxnifcoo1omteli olt)truo(r nydopeemnvi ()a2rrxmonu4opx  oeilsfa rauvp ()texrmr ia1opD ln i (  exoxrpny1lpte feta() Dua(rp;u0tlxnifciatla eauvo u)trxrxociydlaD  neils0 rtoxm3iodalt mict sfarur( p;t0aexn fciat a2em(vpn(0 ltnxfciydfptr ieils  rtm(m3no1lmtn fetas s2tmx  ;t1tetnmf3tydfs rmuvont) lenxf3ta1fmDe ivi;t) etmir nu4ol   nvtatfaDtau pnu1alxoifeilsfm rlump t4alenif3to1oat  uvilt)srto(rpoo1ome lnvs s) 2uau  ;o0olxoii3iysla2rluvsn()tetnif3iodoaD aivo;s0trur(m io4optemneia( aDtmxrpno4tpeomi3tadls2umu p t)tleoir3oatlp eli s (0tetm(mpoy1ol e iet ()s2trx oot0tpxoifctas mDranvsnt0 rxrir3oydfpDeaies () rtoxr nudlpee ietls) 2ta(rpnu1aee iictls m2ra(vp;t)teeoiocoatla elneo t  etmir oy1lm emneils  rrm( ono1ape  oeiydfa2ra(vs u4 lxrmrciadlaDe ueo;s0t2xoxmpoodlmtn icsltf Dtax onu1apx  oeiysfa em(msnt4 ltnmo3oadoa  lies;(  2uoimpiy1lltnmietlt aruau  no4aexomo3tls aDrlnms;(0altnmfctatfptr i o;s s2tmxmpoy4apeemnci s) 2ururpoo0oexnifciyt sDranms (0artrio ia1fatelnvo;t0tetr(o3iydam n nvt t aDrm(mp;t0apxomi3iadfa ranmp t4tlxnmr tytfa r n o;( trxr(rpno1ol nmfcsas  2umu pot1tpxo feiysfa ean p;t0teerxo3oadla  aneo;t) rum(rpoo1llte ivtasfs2rmurooo0tleniietld aDea(vs;u0altoio3oy1fm e nvils)t2xo(m3oy1alt lncil(  rtm(r ot1aptnmfetadla2eauvo () leoif to1oa rli olt0trtrir iy4lmeemicslsfsDrmx  no1apenmoeiltlm2em(mp;u4tlxnxo oa1laDe ivs t0t2xrio3iydll  liciltfa2uaxrpoo4oleomfetldls2um(mpn(0 lxnmr iodopD anei ()t2xrio iy1lm nmfvia(f 2uru pnt1alx  i3tadfm ra(ms u0alxrio oydla e u olt srtrxrpoy4opeemivsat a2ra( p;o0aptniicild m rauvp;(0trxrmo3oydfate ues;s s2xrxo oodopt  fvil(  Dur(  nt0oeeomociadfsDrlums ()arxrxo3iodlm elnvo ()s2uoxo3iodome  feia( s2tm(rpoo0aee mi3tldfs2elums;t0areniociydla  anvilt)srxm(rpou4lpeelncia(  Drrxrpnt4tpx  feias a2rluvsn(4tlenxo io1optrln i;( trxrir3no4opee ivtltfs2tau ooo4oeenmfetadfs2uanvsnu0tltomfctytfatrauvo t)s2uoxr no1openlnes t)a2ur(  ot4opeoii3ild s2ranmont4aeenir totlat lnvo;t)s2uo(m no4openmncsls)arumu oot0tee mfciyd a2umuvp u4texrmf3iotfat ln i t t2xr(o3oy4alt mfcia( sDra( ont4tltn icilsls2rmumont4 ltoio3todlp rai o t s2ur(o3oo1lm   ncilsfartmxr nu4aetnmi3tysfaDrmnvo t0texrmr tadoa rauvi s)trxmio nu4lpenmivia(f 2ua(rpnt1apxn oetldla2rlnvsn()artnmfctodomD aieol( setoxmpnu4ol nmfeiat a2tru  nu1apxomoeiyd s eluvs;()tltomo3ootom  auei;t)seto(m iu4lm nlicslt)aDtauro;u4oltomociytls rluvs;u0teeoif3oo1oa eaiesl(0 eum(r3oo4lpenlics s  2tm(rpnt0opx  i3iltfa2rlnms u0altrircoodom r nvo t0 rxrimpou4ole  fvsat)s2raumo;t1teenmi3tlsla elu s;t4trxnxociotfaD anesls)s2xrxmpnodalt mnctl( a2ta(ro;t0aleo i3iyd aDelnms;u0arxoxrctadfmDr ues s)trtrxo3iy4lptnlfetat) 2um( oot0apx  oeilt m emu o;u)tlermr3oodlat  nvo;s  2xoxm io1lp elicsls  2tax  no1ale mf3iadfsDea( pnu4 lxrirciatlat lueilt sexrxr io1lm emies s)s2rm(m nt1opx  i3tysfm2ul(vont0teeomrctodla e ueilt0teto(rpny4omtn net (fartmxront1ape io3tad a2uan s;()areomf3iotfmD lnes () rxoxm3ou1apen ieias)srtax o;u1alx mf3iltfmDumnvsnu)trenmo3iydfaDelieolt)t2uoxo iu4aptnlicils)s2rmxrp;o0teenmi3ilt m rmumo;t4alxnif ty1lpt  uvil() rtr(m3io1ope  ncta(fsDtaxmo;u0aleoioetltfsDel(von()trxriocto1lm ranvs;t0s2xr(m3nydal   nviatfa2trxmo;o4tpe ifciadfs2uln sn()trtrif3tadlatelues (0srtoim3iu4ole lietasfaDur( p;o4olto ietlsls2uaump () reoio oodoa rlues;t srtoir3oodope lfeiat)aDtmu poo4tpt mociysfaDelnvs t) rtoifctotlm elnei;s0sexrxrpiydomte netls s2tm(mpnt4oexniieiad s rlnmo u0arxrxr3oy1oateluei t0setmio no4opt mncs (fsrumxr ;o1oexnmf3iyd a2eluvp;u0alenif oy1op r ivi s)sexmir3oo4alt  nct t s2uaumont1teeoifeiytla uln p t)tltnif oy1fa r u i ( trur(o3iu4lle lnesls)srur(ro;u0aexn ietydlsDemn p t4 rtnirciytlmt lu i s sexrxm3ou4lmtelnvt t  rrmx pnu1olt  i3iydls ul( on(0trtoifcta1lp rauvi;s0 2xrio ny1lp nlnvi ()a2tm( oou4aeeo o3tysfs2uln o;u4trermr3oy1laDelu sls0teuoim3no4am n ncs tf rtru  nu0tpt ioeildlaDrl(mo;t)arxoir3oy1fa rlieo t tetoirpno4apeelnvi ( a2rr(m no4tpt  i3tldlmDulnvs;t) eerif tatoaDeauvslt) etoimpoydlmt  nvta() Duaumpno0tpeoifciyd m um(mpnu)tetnxo3tatfmtran il(  ruo(opio4al  mivil(  rrmx ont0tet  feiasfaDul( s;u0teeoxo3tatom e uei () ruoxm oo4ape  fetl(f rumxmoou0oetn i3ilsfmDrmu s;t)tltnxrcty1oa e ues (0 rxoxr3ou1am n fcs t sDraum ot0tlx mfctlt m uauvs;() lxoir oytlpD lieilt0t2xrxo3no4omtnmfesat)sDua(r ot1oleoioeildfa2uanmp u4alxoir3io1fp r ivi;s0teurio ny1lmeemncslt) 2ua(m ;o1tle mo3iytfsDraumpnu0alxomo3ia1lmDraiei;t  2trim3oo4ope  nvsl(fsrrmuro;o4aleo fcilslmDrmumsnu0aeenir oo1fmt aieo;t s2tmxr3io1ape mietat s2rrum nu1aeen i3iltfs2ul(msnt0arxnxf oy1omDeai ils)texm(m iudam  miet ()sDumur no4aeenmictysls uanvp;u)tetnxoctydfat lnei s  rxr(rpiydlmeelnci tf 2taxm nt0altoiocild mDrauvp u4 reoir ootoat  u ol()trtmxm iu1ameelfesl( aDra(ronu1tlxoio3iaslmDulumont)alenif iy1latrliei s) etr(r oy4amenliei sfs2rrur ;o0oleomicilsfs2ra(vo;t) rtrxf3iy1lmDe neilt0s2tm(rpoo4alee fci sf 2um(mpnt4aleoifetasfs2eau pnu0artoxo3todoat  u ilt)t2xoxm io1ll nlivil() rurx poo1apxoii3iasfs rmn o;t0 lxoif3tatomD  ivo t)s2toirpiy1altn nvi tfaDumu ooo4tpx  fciydfsDuanvs ()aeerxrcoatfatraiei ( srxmio3oy4ap e fcs (fsrurxm ou0ole mieiytls2ranmo (4altoio3tytopte uvo t)srtoimpnu4ol n ietlsfarua(monu0tlt ii3tlt a2rl( s u)alenxo3iadfpD auesls teurxr iy1aptnmfvs s) 2tru ooo0ole iicilt m2elu ont4alerif3iadomDe ies;t)s2um(r oy1lp emfesl( aDrrxmo;t0alt iieiadfsDumn on(4aexnxo3oo1omDr ieilt)srtoir iu1lm   nesls)aDumx pno1aetn f3iad s2ran p t0arerxf tadomt  n s;s  exmxmpoy4amt lfctat  Dra(moou4apenmfetytlm ean s;t)trxnifcty1lp  li slt0s2tm(r3iodlm   ivt t  rtrxrpoo1oee  f3tat sDrm(vpn(0 etrxf iytfp e ivo;s)trxmio3iudll  lncia(f 2raxmo;o4alt mfciytfa2rmu p (4 etrmf iydomte neols teurxopno4am elivs s)a2trump;o0tle  fctadlmDemuvsnt)tltnxo oadlaDeaivilt0 2xrio oy4lmt lietl(faDtaum nu0tptnio3tas sDulnmo ()alxrmo3oatlmD lnvs t truoir3ou1ope lfetlt)aDtmxr nt0ope  feilsla2rmnvo;t) rerif oatoptr ivils)setrirpio4lmt lfvt s)sDraxmoou0opeomfctadfs2umnmo u4 etnxf oo1oaD ai ils)sexrir iu4lle lfeils a2tmxro;t1texomieiydlsDrl( o (4aetoxociadlpD li ils  2tmxr3ou1al e ies sf 2truro;u0tpxnii3ilt mDeluvp;(0trxnir iatla  au olt)t2tmimpiu4ame lnctasf rrrx onu1tee  o3ilt s2uan o;()artrxoctytfm  livs s)teurirpny1llt mfvi tf rrr(r ou4tle if3tlsfaDuanvs;(0alerir3iytom elivs;(0t2to(m3nydop   fvslsf rtaumpnu0aexn i3iyd mDeln on(4 lenmf3oytfmt anei;()trur(mpiy4ll e nvtlt)a2rau pot4tlxnmfetlsfm2elnmsnu0teeriocio1fat ai s;t)srxmio3nu4lme mnvilt s2trxr nu4tpe moetysfaDel( o (4tlxnio iotop rlnvo s0 2uoxmpiy1aptn iciatfarumurono1texnmieild m um(mo;(0aexoxo ia1omDr uvsls0 ruoxmpiodalt lnvt tfs2rr(ront1tetoifetaslm2uanvs u0 rtrio3totoatr neols t2umxmpou1aptemnvtltfarra(mp;t4aetnif3iltlaDuln snt)tlxnio3oytomtrli o;(0setmio3oodlpee netl(  rurx o;u0oee moetysfm um(vont) ltoxf3oadfp  au s;t0 rtr(mpou4op nlfesltfaDtrxmo;t4tpxn oeildfmDemnvon(0treomr tatomD anvo;() euoiopou1olte ieiatfsrrmu  ;u0oltn ieiysla2rlums;t) exomf tatoaDean o;t0sexrirpoy4am elicsl()srtrxro;t0tpxnifeiytla rlu snu0teermfctodfmDeaneo (0s2tmir oo1lltemfct () Dumx  ;o4tpe mi3tadfm uaumpnt4 rxomf3oatlm  aivs t)teumio iy4op nlfvias a2ta(mpno4tlxomo3iad a elumpnu0 leniocoy1lpDr ivs;()t2xmim3iodlmte ieil(  ruru o;o0tpen octldla emu ont0tlenir3oydlm   nvil( t2urimpiy4ame lnetl(f rtrx pou1tltniiciysla rm( p (0 eeriocoy1lpDe i ils0s2umim no4ap eliesatf Drm(m no1opt moetat m eaumsn()texoxr totfp eli s t t2xoxr nu4lmeelfcslt)srur(moot1oltniocilsfaDrmn o;()aetrifcoatlpte uvo t)sruo(o3oo1al n nctasfsrua( p;o4aleniieils sDeln o;(0arxomociytlpt  u s;s)t2xmxmpnodoleemnesl(fa2trurp;t4alxo o3iysfm2rmnms (0trxomr tadlaD luvo;t  exrir iy1alte nesas s2rm(roou4tpe  fetlt a elnvpnt)alxoiocoy1fmD luesl( trumxopno1olt lnes ()s2urur ou4tetnmo3iatlsDrl(mp (0trtrxr oa1om   i o;t0t2xr(rpiydoltelfvta()a2rm(mpno4tleomietltfsDean s (0tlxnxrciadop rln i t  2xr(m3no1openlnetat)srtau poo1tpto feiasfsDuau s t4trtnmo io1fa  luvs;t0t2um(r io4lpe  fvs s)sDurxmont0ole  iciydlmDul(vsn(4alxnifciy1lm  luvo;s sexo(o io4am  licilt)sDta( ono4opt  fetad a el(vs t0tleomf3io1lpD anvo t0sruo(m3nu1lpeemics s  rra( pot1aetnmiciatla elnvpnu4 lerif oydlp  ln o (0 exmir3iudol e ieta( a2rax pou0altomoctydfaDelnvo t0arenxf tydlaDrlnes;s texmxr ou1lmee ict s) Dtau ont0apxomoctatlm emn pn(0aexoif tytla e uesl()tetrxmpiy4om nmfvi s)arraum nu4oee io3iydls rmnmpnu) leomrciadom rli i;t) 2tm(opoudlle micia()a2ua(mpno0tltnmf3iytlaDuanvsnt0tleniocta1lpDeliei t)s2to(m io1om  lfvi s  rrm(mpno4ole if3tadfaDra(ms;(4areoif3iadfatr ieo s0sruo(m oo1apenmivi s)artmx o;u0opxn fciatlm el(mpnu4altrmoctytfpte n s;s) 2triopnu4al nlnvs ( s2rax o;u1tpx  icilt m rm( s;(4 lxoxfciotfm   neo;(0t2tmiopnu4ll nlici t) rtrxmooo4tleomiciad s2eanvon(4tleoio oodlmDelnvo;t0srxoio3oy4om  lnesl( a2raur oo0aetnmi3ias a2uanvs;t) exnio3iotfaDelnvs s srtoxopiu4lme  ivtls)srraumonu0aptn i3iatlm2ulnmsnu4teenifcoo1lmD auvols0 2toirpnydam   nvtltfarua(m no1ape  o3tltla emn p t0texnmr tydfmDeli i s0 etr(r iy4om  lnesasfa2rm( poo1alxoiocilt m2ea(vont)arxoir oa1late nvi;s0s2tmxopiy1ome lncsls)arrr(monu4aee iieiasfm el( p;t)aeerxoctotom eau s s srxoxm oo4aptnlieils  Dum(  ot4opxomicild a um( snu4areoxr3oa1fp   i s;s) rtmxr oy4oleemfet t a2ta(  oo0tetniociat a2el( o;t)artomr3ia1fm elu s;s  ruo(o3no1llee netlt) Dumu p;t1tltoifciys a2rauvo ()arxomo3oo1lp r uesl() rxr(m3nudolen nci t) rum(mpnt1tle ifetys sDra(msn()alxnxf3iatlpDeaivi;t0s2xoio3oy1aptnmfes s)sDrmur ;o1opt mfcias m2eaumpnt0tlenir3oydfpDrluei;(0 2uo(m ny4lltnmnes tfsDrmxmonu0tpt ii3ias sDelnmsnu4 rxrir3iy1fmt aieo;s0setrim io1ol  mivta( srur(moot1apeo ieiltla2emnvo;()trtnmr tadopteaues;s)t2xrxo3nu4am nlnvs s aDrrxronu4apx ifeiyd mDrlums;t4 rtoif oadopt  uvol(  eur(r3io1lm nlfesls)srtax  oo4oeeomfeilsls uau pn(4aeenxf3tytomD  ivi (0 rtrirpiydap   nvsl( srrrxmpot4tlxnmieiaslaDulumsn(0alxomo iytom r nvi (0srtm(r oy1lpeelfeta( s2um(mpot4oleoif3iadlmDeanvo (4trxnxociotlpDrlu o t0 rtmirpno1amenlicsl( s2trxm oo0teenmi3iat m2em( pnu0 ltomf3iytfa rau s;t0 rxrxr3oy4apeelfesl( a2tax pot0tpenii3tlslm2ranmp;u)altnmf3oy1latr ues () rxoir oo4lptelfvs t a2rrum ;u4tltnmo3tyslmDuan pnt)texnxr3todoptrln sl()tetrxm no4apt  nci s a2um(mo;u1apt mfetld m2elnmp u4 rerxfctodoptrli s;s) etm(o iydlme miet sfaDra(ro;t0aexo i3iydfsDranmpnu) lxnxf3oydlmDrlnvslt)setrio3oy4ale lfetlt  2rru p;u4olt  ietytla2rl(mo;t4aetrif3tadfm eai o;s srtoirpnudlpeelfetlt)a2tmxmo;o4alen oeiys a ulnmonu4trenxr oo1oaD ai s;s  rxrxm iydapt  net t  rtm(ront1tleo ictyd a emn pn(4trtomf iodoa e i s s) eurim3nu4om emfci ( s2raxrpot1oexomietytlm2em( s t4aexrif tydom   uvo;s)t2urxrpio4oltemiei ( sDrmx ont0aexniicild a2el(msnu0aeerxo iadfatr n i (0 exrxrpiy1omee ics sfa2rr(r ;u0aee mf3tyt s umn pnu0tltrirctadla e uvi;t0t2uoxr no4ope mnei ()srur( ont4alxoio3ilsfs rl(vo;(4arxnmr3oo1latelneils0 exoio3oo4lpenmfct t) rtaumpou4aeenifciytfmDea( onu4aleoxf ty1lm rlnesls  rumim3oo4amtelivs ( a2raxro;u0alt ii3ildlsDra(mo t4 rxrmrcoadla raivols)trxm(m iodalen nesls sDtmumoot1tltn ociltlm ea(vpnu4tetnxfcoodfat aivsls) rumio3oy4lpt  ncsas)arrr(rp;u4apt mo3ildla ran sn()aetrmf3oatoa  lnvsls sexo(m iu4apee fesasf 2um(mont1oex mo3iatls2ul(mpnu) reomo iytfa eauvs s srurimpoy1lltemfci t)srumum ;t1aet mo3ilsfsDrmnvs u0 eerxr3iydlm   ueo;t0trxmio3nudllte fvil()s2tr(ro;u1aeen oetlsfs elnmp;()aleomocio1fmD ln slt) euoimpoydame liet () rta(m no0tet ioctyt mDel(vpnt4treomf3to1omDe u o s0texm(m ny1llt lfvi ()srrmxmpou4open fctlsfa elumo;u)trtrmocoytfm  anvs;(0trxrxm3iudam n nci () 2uaxr ;t1tex iociysfa2ra(vo;t0tltrxrcoy1fp  lneo s0seurxr3iudopee net s) rurxmonu1opto oeiatlaDrlu s;u)aeerxr tadop elnvil(0t2trim io4ll   nvi (faDraumooo4oltnmi3ildls2umnmp;(0aeerio3oatlpDr neilt0trxmir3io1lle mfcias  rrr(m oo1tpxoii3tadla2emump;(0alerif iodoaDrlnvi s s2toxm no1altnmnvia(fa2rr(r no1tpeo fciatfm2uanvpnt0 exrircootfa   i ol(0srtrxm nudlmeelnvs tf 2tr( o;o4oetomoetydfm uanvpn()altniociadlpDrln i;s setmxo3iodam nlivt (fsDraum ;o4tptniociaslm uan s t4aexrmo3ia1lmD  uvs t  euoxr iu1lp   fcta()a2tau  oo0texn i3tlsfa rmumon(0teermf3io1laDrai i t0setmim3nudape mfcias  2tm(r ou0tlx  fetltlaDrauvpnt)tlxrmf oadla eaies;s0tetmim3io4omte feia()a2tr(moou0tpxoioeild a emumo;()altnir3todla   u i;t t2tmio nu1olen nvslt s2umxr nt4tlxoiiciys m2rlumsnt)texnmo tydoa  lnvi s)trxoxr3ny4ope mfvt s  2tm(monu4tpe ioetaslm2rau snt) etniociodom elnei s0 2uo(m3oo4aptelfeta( a2umump;u0tee mf3ilt a el(vonu)alenmr3oo1fpteluvs (0seurxr nu1ame  neslsfaDrru pno0olen ieiysfa2ul(msnt0artrmr oodlaD  uesl() 2tmimpnodopte nvsl() Dumx o;t1oeeoifctat aDumnmpnu) lenxf oy1fp  ai olt  exrxr io4ope mnvilt)sruru  ;t0tlt mf3iytls rmnvp (4trxrxr iytomteau olt0s2uoxm3oo1om emivta()a2rmx p;u0tle  ocils a2ul( o;(0 lenmr3tydop   n slt texmimpiy4oltelicia( artmxmont1alt mi3iatfs2emuvp u)tlenmf3iydfm eau s (0tetoxmpno4om n ictl( artmxmp;t4tpx iociadlaDemums t)aexoif3iatfatrau il() eto(mpnydlpeemnciltfarur( o;u1aeen ociys s rm(mon(4 lerif3ty1lmt  ieil( srtmim3iudop  mfvs (fsrtrxm ;u1oet ii3tyt a2emnms (4tetrxfciydlmD lu i;s) 2xr(r3iydoltemivils)a2um(mpnu1tee iociad s rluvpnu0alenio iadfptelnvi (  2uoir3iy4ol  mnci sf Dua(moou1altomfciydls2eau s u)teeoxf oa1lm eluei s0trurimpiu4lleelicsat) rraum ot0tpxniicilsfs2uaumo t4tltrir oo1omt au sl(  2uoxm3oo1apte ictasfsrtmx  ;t0texn i3tad aDum( o;()tltnmo oytlpDe i o t0 2um(o nu1omee nct ( sDrrur ;u1tpt mfetydlm el(mpn(0teenifcty1op  luesl() eurirpio4omt  iesa(fs2ururpoo0apen fetatlm2eln o t)tltrxfciodla   uvs t)seuoxm oo4ome mict sfarur(r ot4oetniiciytfm2rmnvpnu0arxoiociytlptelnvo;t0trurxmpnudal  lfcia(f 2ur(mo;o4alx if3ias m ean o;t4arxomo3oy1oaD luvi t)tetoimpoy4lmeelnvi sfa2taxmo;u1ale mo3ilsfm2umu s ()tleomfcoatlm raieol(0 ruo(opoydlpe lncta(faDumurp;o0apeomfciyslaDra(vpnt4tltomf3iotlpt aies;s)srtmxo no4lmt liesatfsDrmum nu1alt mfetas aDrauvsn(0teenio iotomDr n s (0 rtmim3oo1amee iet ()sDrmu pnu0apxnii3tydfa2uln s;(4tlenxo iodoaDr ivsl(0setr(o3nu4oleelfcsas srraump;u0ole iieiadfsDemnvo u0tlenxf3oytom  au s;( tetoim iy1omtelfvtl( a2tr( oou1tlx ioetlt m um(monu0aexnir3iotfpDraivi s truoxo3nu4lm nmictl(  rrmu  oo1tpx  i3tlt s2el(vs t4tetnifcoadom ranvo;t0s2toir3oo4ap  mfeiltf rtm(r ot4oeenii3ildfs2eau ont4altrir ty1lptelnei (0 rxoxo io1lm nlivi ()arraur ;u1apenmi3tysfm2ran sn()alerircoa1fa eaues s0 rxmxo nodap elfetl( aruru ooo0tetnmieiatfmDrm(vont4areomrctotla   ues;s setmxm io1op e fetl( sDrmumpno0alxomiciytla2el( o u) lxrxfcoodom  luvsls)t2tmirpou4olt  fcsas sDrrx pou4openmo3ilt mDeanvp () lerio3iatlpDelieo t  eurim3iudal elfvt t)sDtmu o;u1oeeomfcias m rlnvs (4 rxrmo iatlmtranvs t  etoxmpiydomeelfcslt arumxm ;u4alxo feiys s um(vs;(4aeeoxf3oydomteaieo;s teurxo3nu4opte fei (fsrtmu p;u1texo o3tatfaDrmumo t)artrxr iy1fmDeluvs;t) etmir io1omtnmfvt tfarrax  ou0tee  i3tlt aDum( o (0aexrmfcta1omDr neilt0 rumxm3no4aleemfvtls sDtr(  oo1tptomo3ias a elnvsn(4tlxnmr3oytfpteaueol()srumio3oy4aptelnvt t)s2ua(mp;o1alx mocildfm2eluvp;(4areomrcoodomtranvil( teto(opiu1am  mncslt arua(  ;u1tetn fciytfs2umums;t)texnxo oatlaD lu i;t truo(mpoodlp emfvils)arua(ront1opxnmo3ilsfaDulums (4aetrio3oodopte uvs;t s2tmim3iydap nlfet sfs2rr(rpnu1oexomociasla ran s t0 rxrxf3to1optrai i;t trumiopiu1omtelnetat a2trx  ot0aetomi3tltla2rl(mont4tlerxr3tytomteaivs;(  2toio nudome  ieilt s2trumpnu1texoifctld s emuvsnu4 rxomo oadlp  ln i ()t2xmxo iu4ameemieta(f 2rmxmpnu0oexnioeiltls2ea(mp t0 reoiocoatfatr ueo s0setrxmpoy4omte ieta()artaxmpou4aexo oeiatfsDea(vs t)tltoif3tytlm rai o;t) rxm(mpiu4lmeelnctlsf rrmxmpnt1tetnmfeiyd s ulnvs;() etnir3tadomt li s t trxr(mpnydamtnmicta()a2tmxmonu4tetniicild s2el(ms u4aeeomr oa1oaDr n slt t2xr(m3oo4oltemivs s arrm(mo;t1opt mi3iydlm eluvsnt)trtnmocta1la rlivi t sexrir3oy1oltnliet ( s2tm(r nt4opt ioctldfs2rmnmont0aexniociydlpDe u o;s)trtrxr nu1lme  fctl()arraxmoot0tpxnif3iad s2ranmpn() ltnif oatlmt aueol()srumimpoudll   icia( sruaurp;o1tlxoiiciaslsDem(mon()trtrmr3ia1la  au s;( teurxm io1lm  lfci (fsrtaxmo;o4opxn icildfm2uanms t4 ltomoctotfate neil(  rxo(o3nydalenmivt (f Duru pno0ole mociyt mDum( ont)tetoiociytop r uvo s sexrir3nu4aptn fetlt) rtr(mpot1oeto fciydlmDrmuvs;(4 exrxocoa1opDr u ols)srxmimpiu1om  livtlsf rrm( pno0optomieiltls elnvpn(0aexrmocoatlm e ueo s0t2ur(o3oy1opeemictl(farrm(mooo4tet mocildfsDulums () etoircia1lp eanei;(0 exmirpoodlme mnetltf Drru pou1tlxn o3ilt mDrauvonu0treoir oytlpt luvi;t)teumxo3io4alen fvsls) 2urumpnt1opeomo3iasfsDra(vonu) exrxo oodomDr uvilt texrio ny1lmtnmictat)a2rm(ro;u0opxn oeiadfm2elnmp u)tlxrmo oodlaDr nvi t) 2trio no4omenlfvias)a2tmx ooo1olt if3tlt m eanmo u)treoir ta1omDe u ils)trtm(r3nu1lp nlictl(  ruau  oo4tlen ietysls2eluvo t0alxrxo3oydlpD aneslt0trur(r3oo1opte ncs ( aDrrx p;t1tpen fctltla2ranmp (0 etnmf oytlaD  i s;t0srxmio oy4al elietltfa2ur(m no4tleomoeilslm2el(vs u)trxrmr totla e ies;t0 etrxrpoudape mnvt t  Dumu  ;t4alxn oeiyt a2rln p ()arxomrcoa1oa elu o t  exoxr ou4ome lfetatfa2raum ot0aeeniietyd a uanvo u)texnmr3iodom e nvs;t0sexoxrpoydal nlnvtatf Dtaumo;o4tex mi3ilt s2um(ms t) rxomo iadlpDeaieilt)s2toirpnu4llt micta(  2rm(mpoo4aeen ociyslmDuanms;t4 eenxfcio1fm  anei;(0trur(rpiu1al nlnvsa(f rrmxmpnt4optoifciydlm2elnvon()aleoxf3iadoa raueo t  ruo(o3io1ap n ivs s) rraxmp;u0olxomo3tatfm emuvonu0tlxnxf oa1omDr nvo;t0 exoim3iudolen ncils sDta(m ot4tpeoiieiasls2ua(vp ()texnmo iytoa rai s;t)t2ur(m3oo1om  lncsa(faDum(mpnt1tleomoetatlm ra(vpnu)altnifcoa1laDranvi;t)texmxopoy4am e netl(  2urxm no1tle mociatla2emums;u0 exnxr3oadfmt li ols)t2uoxopny1lltnmneil( s2trxmpoo1aexoio3tydls elnms;u0tltrir oytfp ean o;t)t2uo(r3ny4lptnmnesatf Dua( oot0olx  ieiadfs ul(mo (4aeenxo3tatfm  liesl() rxmxm3ny4ope lnvta(  rrm( p;u0oltnifcilsfm2ranvs;(0tetoxf iodoa  ai s;t0sruo(r ny1lpt  fcsas)srrr(mpoo4aex moctysfaDuanvo u0areomf ia1opDrln o (0seurxr oodap e ivsa()sDuaxrooo0opxomfctas s2ua(vp (0trerioctadlp  lneo;s)t2umim3ou4lmtemncs sfa2ta(ro;u4oetniieildfsDranvpn() eeriociotla eanvo;t) etoxm3nodom  mfes t s2taxmo;o0tlxn oetas sDranms;() rtomrcoa1fa r nvol() exo(mpny4ol nlfctlsf Drrx  ;o1tpen iciytfa2ulnvs;t)aeenmf io1lp e ueo s)texrxr io1ome lies t aDra(mpnu0tpxnif3iad a rlumsnt0 exomociydla r u o t)srxmxo3no1ll  liesat  2tru o;t0olto octyslmDuau s;u0tltrxo3oytomDeai o s0sexrirpoy1ol emfei s  Draum ;o1tetomoctasfs2elnvs (0 lxoxo3oadomD  nes s)teumio3nodlpenmici (faDua(rpou0teto f3iydlaDea( s t0arenir tatlptrauvi t0 2umir ou4ol elfvsas)arumuro;o0opeoif3ildlsDemnvpnt4 etnioctadop  lnvi;t0 2tr(r io1omte fesl(fa2umxmono1aetomiciaslmDean pn(0alenir iodlmtr u s s truoxr3oudam  mfvsa( srrru onu0aexo o3iydfaDeln on()tlenmf to1fm  au o t)s2tr(m oudlm  lnvs () rua( pno1oee  oetat s emumo;t0tlxrirctatop  lueolt) euoir nudopeelnvtatfs2rrx pno4aetoifctldlm2ranvs u) ltnxfcoadoa   u ol(0s2umim nu1oltn fci t)arrm(  nt4oee iictat a2uln pn(4arxrir3io1omD li s t sruoxm oydapenlivsas)arrmxmoou0tlxoio3iysfm eauvs;t)tetrxrcoa1fpt  i o;( trum(opny1ap nlicsls)a2tmxrp;u4ole moetys a ra(mp;(4aleoxf3ootlmtelnesls)seuo(o3oo1ll  livsasfsDraxm oo0opx iieilsls2eluvon() ltrxfctodlaD auvo;t0tetmxr3iudop n feias artaum ;o4oleomf3tldls uau sn(4tleoxf3oatomD  i i;t)s2urxmpoy1opt mics t sDumump;o0oeeomiciatlm2ulumo;t)arxoif3ootlpt  ivil()teur(r nu4lp emicil()srumxr ;o0tpeoiietld aDeaump;(0artrifcoa1fpDr neo;t) 2umxm iy4aleemies sfsDraxronu0tpx mocild mDemumpnu4aexnmr tydoaD auvs;s trtmxrpiu4om n icsl(  2rmxmpno4oltnif3ilsfa ua( s;t0tlxrmoctytfa rlnvo (0tetrimpoydop n fcs tf Dtauro;t4aptomi3ildfmDuan p;t4texnmrciy1fat  ieo t)trtoim nydome mnvsas) 2ra(mpoo1tpx mfeiltlaDelnvpnu0 rxrxo iadlp   i s s srtm(r3iudlme mfet ( srumxr ;u1olt iietltls rlums;()aexnio3oy1oaD aies s)setoxr3oy4lpen ictl(f rtmxrpot4apxoio3tatfs rmnvp;t4 lxoxr tydla ean s;t0srtoimpiudlmenlnvt (fa2trum nu4olxoiietydfa rl( o;u4 eerxo3ootlpD ai s s  2umir ou1aleelfvi s srumumono4tpe  oeiydfm2ulnvs (0 etnxr3oo1laD luvil(0srtmxr oy1amtnmict sfs2ra(ront4tpxo ieiatfa2el(vp;()tlerif io1fa r nvsls  etrxmpnodalen fei t) Drrxr ;t4aleomieiyslaDemnmp t4 etrmfcty1laDelu o t t2tm(o3nudal  liet ()a2tm(mp;t4olx mo3tysfm rmn pn(4alxrxf3tytfp rliei;s0sexrxrpny1olt lnvi tf Dtrxm ;o1opxn oeiasls rmnmo u0treoirciydlp r i s () rtmio nudam nmnvt (  2uaxm ou0tetomieiasla ua( pn(4 renxr ta1fmD au ils0 euoxrpoydope lnvsl() ruaxmonu1ole  f3tld a2emums;u0 exnmo3oadomteaueo;(  rtm(o no4lmenmfeiatf Dua( pnu0oee ifciatfmDea(vont) eerxf iodfpDelieols0 rxr(o3oodal nmnet tfsDrau ono1alen fctltfa2ranvsnu4altnio iadlmteln i t0 eurim3oy4ameemfcilsf rum( p;t4oexn f3iydfs uanvs;u4 etoifctadop rliei s0trtmxrpno4optelfetasfaDraum ot0oexomictyslmDrmu o;t)alermfcty1om  anes;t)trumxm ny1ll nmnes s aDtau pou0olt moetltlm ulnms;t0 exoxo3oa1fmD aneol(0 rxmir ny4optnmnet ( sDum(m oo0ole mfctlslm em(msn()trtoio3tytla eanvils)trtr(mpoy1lmee fetat sDuru pot4oetnmf3ilsfm ul(mp;() exrxr iydfaDr ueolt trtmim3iodopen ivt ()srrmxr ;u0tetoioetas a2ulump u4altrio3oadlmt lues;t0s2urir nydome mivil( a2tm(moot4altomietytfa uln o;() rtoif oadfmteaneols)trtm(r3iu1lpte iet s)arta(mo;o1opxniictldfsDrl( sn() etoxr3iy1opt  n s;s seto(o3nu1lmeemfcs s  2trxm ot1optn o3iltlsDel(msnt) rtrmrctotfmD aieils)sexoio3oo4am  lfci tfaDumxrpoo4tpen oeiltfmDra( onu)alermoctadlptraueolt0 exoim oudalte ictlsfsrrm( onu0ole  ietatlm2rl(vsnt4 eenxr3iadom  lieils0 rxm(r3oy1optnlfvs sf 2tmurp;u1alxoifctlt m ea( sn()teermo oa1lmD  neo t0s2xrim iy1lp nmietas s2taur nt0aex mo3tld mDua(mpn(4 rermr to1opt li s;s) eum(r no1lme mnet sfaDtrxrooo1aeenmi3tld s ulu o ()aeenmociydfmtr nesl(0 rumxr iydop nmivs () rrr( pnu1tpt io3iyd mDrlu p;t0arermo io1fmDelnei;()texoxr3nudlptn neiatfsDrm(mono4apx  f3iaslsDeaumo;(0aexrmo3iydop   ueslt0srxmxmpiu1ame lfesat  rtrx p;u1texnmi3iysfs rm( pn()treoxociodopDr nvsl( trtr(rpnudom n fci sfsDtr( o;o1aleomociysfm ranvpn(0artnio oatlm ranesl() exo(m oy4ol elict s)artaxrono0aeto feilsls rmumo;() lerxo tadlaD  n i;( t2umxrpnodole lncslsf Dtrurp;t1olt ioeias mDrauvpnu0 rerircta1lpt aivi;(0srxrim ou4llen iesat  2ra(moou4tet  i3iadlaDem( p;u0areomf oatlpD lu s;t)t2um(o3iy1optnmfvslt  Dum(  nu1oleniietld m2eanmp ()tetrir ia1oaDelieo;s0 2toimpny1amtn fei sfaDtaxrp;t1apx  octld mDelnvsn(0alxnmrciatfp   iesls0truoxrpiy1olen netls srumx pou0aex ifeiat s rm( p u4arxoxf3tatoat  n o t)seurxmpou4llt  nvt sfsDrmu  ;o1opx mictlsfmDrmuvo;t0aeeoxf3ootomtelnei;t)srumxo oo4optn nvtas) rtmu  nt4tlt mi3tat m elumo u0tleoxfctatlpD au ils) etm(o no4ol emnctltf rra( o;o0tpt  fctldfm2uln o;t0artrmf3totfpDeaueols)t2to(rpoy1omtelfeslsfartmxr ;t0optomictltls2umnmp;()aetrmr3todlpt lnvs t srxmxo3ou1olen ivias)aDumx p;u4ape iictytfmDulnvo u0 ltoxo3ootla rli o s)t2uo(mpoo1lltn neil(farum(r no4oleo iciaslm2umnmsnt0aeenmf3oadfm rau o;s t2ur(o oo4op   ieslt  Drr(root1opxomoeiytfa umu snt4aetnmr3oo1laDr ieo (0 rxmim3oy1am  mies s)aruru ono0tpe  f3iatla2rau p () leoif3oo1fatr ues (0 2tmim oy4ale micsa(f Dtau  oo0tpt mocildfmDum( o;t0artoiocoydfa  lies s s2xmim3nodomenmici (fartrxr no0optn o3ilt a uln o;t0altnifciotlmDr ivo;s)s2urirpoydol n feta( sDrmxrooo4tee if3iadlsDum(mo;t4tetrxr iydlm   nei;t) 2uo(mpnydaptn nvsl( s2rrur oo0teenmoeiysls2rm(vonu0arerxrcoytlaD lu i;s0texoimpnydome mfci ( srurx o;u4ope mo3ild a2um( o;(4arerxrcta1lp eln o;(0 exm(m oo1lmee fcil(f rrr( pot4alxomfetas a rl(vs;(0tltnxf3oatlp  an o s0setmxr3no4apt mieilsf ruaurpnu0olx mf3iysfmDeanmo;u0 lenio ootop rai i;s0texmxm3iu1apt  iesat)s2rmu pot1oeenmfeilsfs2ulump (4 lxoxf oa1lmt lieolt0srtoim3ny1apt mnesl(f ruaxmpnt4ale  feiys sDrmnvsn(4trtnxo3oadopD aies;s0 2uoxrpiydlpeemneilt  Drmur ;o1oeenifciatfm2rm(ms;t0 lxnir iodlpteanvo s seuoxmpiu4omtelncsat  Dtaumonu1aeeo oeiasfa rm( p t4aetrif iytom raieslt0tetm(m3oo1lm e fcias) rrmu  ;t1tet  i3tadlm2emnmo ()arxoxf oy1lmte ivil( srur(r nydlpt lfvslsf 2ur(rooo0opx ifciyt aDra( s t)tetnmo totla  lueo;( tetmxm3ny1am e nes t  Drru oot1aeen feiydfm2ul(vpn() exnxo3ty1fp r u o s0srtr(opou4altnlncils) 2rmx p;u4tetnii3iys s uanmp u4tltoxf3oatopDe u slt0texo(o3ou4lltn iciatfaDtmxrpno0aeeo o3ildfm ua(vp;u)trtnxrcootfmt anvslt)seuo(o3iy1omen fci s aDtmu onu0tpxnioeilt sDuln on(4aeenxr ta1fptelnvilt0t2urir3ny1lpe lictlt srraump;o0olt  octyt m rl(ms () exoiocoydfateluei;s0srur(mpny1amen ncil(f Duau p;u4oeenifciltfa2ulums;()trtrio oydlaDelues;()s2xoim3no4olee ics tf Drm( onu4tlt iociadlsDulnvp (4tlenircoo1lmtelnesls0trumiopiydaptnmiesatf rum(m ;t1tltniietlsla2eau sn(4aeenxf3oa1oateaneils0 rtm(o oy4lpt  iet tf Durxm ;u1oetnmietltfa rl(mp;t0 exrifciadlpteli i t0t2uoxrpou1lle mnvtas) rum(m ;o1oeto octyd a ulumo;u) ltniocta1oa   uvi;s t2xrir nydoptelieias)a2rm(  ot1opeo ieiytls2rlu pn(0 lxnmo tydfptrlnes;s0srur(r3iu4op e fcsatfaDrrumo;t0oeeomoeilsfs uanmon() exnmfcoytoat anei s0 exoxr no1llt  nctatfsrrm(mont1oeeo fciatfs ran s u0 rerxr oatfpteaiesls0sexo(opiy1ll  lfvtl( sDrrurp;t1tleniieiat aDuanmp u) etnmr iytoateanvi;t  ruoxm3oodlme  ieilt  2raxr ou1tpxnifcias s rlump;u0tleomo totlmteau olt) rxrir nodamenlici s a2um(r no0tpx ioetadfs ra( snu)artoif io1la eln ilt tetoxr nu4lpee ies t)arrmumo;o1aexnifcias aDelnmonu) rtomrciotfm   u s;s0 eumxo oy1op emictlt  Durx pnt0oetn fcias aDul( p;t0 etrmociatop eai il()srtm(o iudlm  lnci s a2rm(mp;t0alxn ieiad m2rmu p;u)aexriocto1oatraieo t) exmim3ny1lmeemncslsfsDur(  oo0opto icilslm2rlu o t0teerxf oo1laDe neslt)t2um(mpnu1lmee fcslt)sDurxro;t1tetnii3ild mDeau o t0 rxrir3oatfatr u i s s2to(o oy4om  mnvt (fsDrmur nu1tpxn feiyt m2eln p;t) lxoif tadoaD  ueol(0 exrxr oydalenmivtasfsDta(mpnt4olt iociydlm2um( o u) eeoifctotfpDe u o s0 2xmimpoy4ap elictl(f ruaur ;u0teenioctaslaDea( snt4 ltoxo3tatfaDr iei s0 rxo(m3nodale mfvia(fsDtrxro;u1oltomo3iaslm2ran on(4aexrxf3ia1lm e uvo t0 exm(r oo1am emfvtls)sDuau  nt4altnmi3iad s2rmn p u0alxnmf3oytomDranvs s)s2xoim3iu4oltnmieslt) ruaumoou4tpe mf3tltla ea( p u0 lxnmr iy1laD aivs;s0 etoio nodam  lfei ()aDrmurp;t0tpxo ocilsfs2ra(ms;u)texoxf3todfpt lu ils  exoxo3io1ameemnvslsf Drr(roou4oet mo3ilsfs em(vont0alxomf3ty1la e n olt)seurxrpoodom elivtas)a2tmumpnt1ole mociysls2ua(vo;u4 exoxo oadlm  livi;() rurimpny1aleemfcs s  rtmu p;u4aeto ietld m umnmsn() lerxf todfpDelivil( teur(o iodomtnmnvsat)sDra(mpnt1tpx iieils mDua(vp t0aetrmr oatoa eaiei;t seum(mpnodol n fvils)arurxront1opx io3iadfsDeauvpn(4teerxf oy1oat ln i;s teuo(rpnydop e nes s  rtr(roou1opto feiadfm2rl(vo;(0arxnxo oy1opDr nvi;() rtmio3oo4lpenliei (f Dtr(  nt0aex  ieiydfa el(vpn(4 etnif3oodoa   nvsl( truoim3iodopenmnci (f Dtm(r oo1olenmiciasfa2umn pn(4artoxf iadlptrli i (0s2to(o nu1aleelietasfartr(m nu1opx mieiys m ua(vp;u4arxrxr tydfm  lnei;s)tetm(m iodom n nvtas)aDrm(  ot1oleo oeiad mDel( p;(0alxoxr3oadlp r neo;( trto(r3iudol elfciasf 2tax o;u4alxnifctasls eanmp (4trtnif3ta1fa elueo;t0srxm(m iodap  mnvt ( srumumpoo4teenmfciyslaDranmsn()aeeoxr iy1la  ai olt) etrio no4altnlietls  Dtaurpnt0oeto octytfaDum(vo (4aeeoif tadfm   ivi s  rtoxo nydope lfcias)aDtmxmooo4aet  i3iys s um(vsnt0 lenmoctodomDeluvol(  rum(r3oo4lm   nvsa()sDtax oot0aeeoio3tytlm2eluvonu0 lerir iydfmteauvslt)s2uoxrpoy1amen ics t) rtm(rpno4tle  fciat m rl( s u)arxoxo3oy1lmD an o;s) 2ur(o3oodap nlfcta( srraum nt0opxn feiyt m2uanvo;t0aexoxr3oo1op eli ol(  euoir iy4ope lfes t  rta( ooo1altnmoeils mDulu pnu)trtoxf oydfaDeaneil(0 etoxrpou1am nlnct (fa2ta(mont4oltoii3iad s emuvsnu4 eenxo3ty1fatraiei;s  rumir oydll  mnvtl( aDtm(m ;u0ape  iciadla umn s;t)aexomo3oadla rlueil( srur(r iu4lp elict sf 2urx o;t4tlt mfctas s ra( s;u)arxnxoctytfaD livi;s) rtoxopnydalt mics (fa2tax ono0alt iociydlmDrlumpnu0 rxrxr3oa1faD ai s;s)srto(m3oodlm  lnctas  ruaumo;u1opt ioeiatfa2ulump t4aeeoxr oy1fp   nei s0t2ur(o no1oleemiesatfsrua(rp;u4oeto feiat mDeaums (4tlxrmfcia1lpteln i () 2uo(m3nudol  mnvsltf Drmumpot4aetoii3iysls rluvo;u)teeoxo tadomt ln ol(0s2xoxm oodol e fes t)s2tmum nt4ale iicildlmDrlnvo;u0 lenmo ty1fa rlu o s0trxrirpiu1amt lnvilt a2urumpou1oeto ociydlm ean s;u) rxnmf oytlat an o (0t2xm(r3iu1amt lnei tfartr(mp;o4optomictad mDemuvsnt4aetoxr ia1fm raies (  rurir nudaptelfetat) 2tmxrooo4oeeomf3tadls2rm( p;u) rxrxf3iy1lp r u sls)t2ur(opiy1optemnetlt  Drrxrpot4tpe ifeiltlsDulnmo;u4 renxf oydomt luvol(0setrirpnudlmenlfvtlt)sDum(rooo0teeoio3iydfm2uln pnt) lxoiociatomt aivs;t t2umxmpnudalenlivs ()a2um(m nt0apxo i3iltfmDulumsn() exrmf3iy1fatelivo s0t2triopiu1lp eliet s  rraum nu1tetnioeiys s em(vpnt0tlenioctatopD  ivi;t s2uoim3no4ame  ict t a2tmurp;t0tptniieild s2el(vsnu)tleomf3ootoa raivo;s)tetr(opny4ll  mnesl( sDrrx onu0alto ocildfmDelnmo;(4texnio oatoatr uvslt) etm(o3oodom  lnvia(farumump;o4tptnmieilsfa2rlnvsnt) ltoio3tatlaDr ivolt0teum(o3io1am nlfcilt aDumum ;t0oee  fetydla emnmsnt0alxnxrcty1laD  u i t)sexoiopno4ame  iei sfa2um(mpou4oeto ietytls2emuvo t4teeomrcoodoat luvi;s0t2toxm3oydolt mfcs ()artmxmp;o1tetomietlt a ulnms ()tetoif3ia1faDe nei;()t2to(r3ny1llte ietat) Dumum ;t0apxomf3ilt s2emn p;(4 etomoctodomD  iei t t2tr(o3oy1lm nlnvtltf rumx pnu0oexomf3ilsfm2ulu p u)aeenxo3iytfa  lieo;s)seto(o3nu1ll elivt (  rtrumpoo1apeoif3tatfa2rlnms;u0aeenir3oodlpDrlivi (0tetoiopnydomtnmfviltf rrmur nu4tlt mf3tydfs2um(msn(4tltnxfcoodlmD  nvols  rtm(o nodol   ncils a2tr(mo;u1oetnioeiadla2um(vpn(0teermo3ia1laDrlivsl(0trurxr3oodomt mnvtat sDurx  ;u0openmf3tldls2ra( pnt)trtrmociadlaDeai s () rumxmpnu4alen nvia(fa2ra(ront0olenmoctasfa2ra(monu0alenxo tatlmt liei;s)srumxopiu1al emncs ( a2tm(  ;o0tleoifeiytfs rl(ms;u4 exomf3ia1oat  neol(  2toxr oo1ame  fvsa( s2rax o;o4tpxnmociasla2ulu s u)arxomf3oatlpDrauvi;t sexmxm oy1am e nvia() 2um(r ou4aex mfctasfsDrm(vp t0 ltrif3iy1fmD  n olt setr(o oo4omtelfcsat arrmxrp;u1olxomoeiytlm rl(vs u4altoiocoo1om e n i ()t2um(r3iodaltnmfetlt)s2ua(mpoo4olxnmf3iydfa2emu on(4artrxo3oy1lmDraivol()t2ur(opoy1ame mnctl(fs2tr(ro;o1tetnmicils a2rmuvs u) lxomf oydfm ean ils)teurxm iydomeelfet sfsrrmxr oo4tltomictad s2ua(mon(0texnxr3iotlp eluesl()sexmirpou4lpeemnct (f rumx onu0ape ioctatfs uauvsn(0 exrirctatlmtr i ils)t2tmxr iydlpte ncia(fa2rmumo;o1aeeoioeiltla rlnvp (0tlenifctotfmtelu o t seumxo ou4altelivia( a2taxm ;t1tlxoifciatfm2eauvo;u) exrmo oa1lptraues () etmim3ny1omenlics ()arraxr oo0aex iiciydfs2eaums t0 lxoxr iydoa eanvo;( seur(r oodll elivtls srua( ont0oee ioctatlm rau s u4texrir iotopD luvols setrimpoy4ameelfei t)s2raxm ;u4aeenmo3tldfa ran o t)trenxo3iodlmt aivs (  exo(m3iodlmenmfvs t)s2tmu pnt1oltn oeildfmDranvo (0tltoir3iotfaD  uei;t0trxr(o3ny4ol nmfeslt)s2rmx  oo1tpxn oetltfs rluvp;u0 lxrmr3iatoa e n s;t0 eto(mpoo1alen icsasf rrmxm nu0oetn f3iysla2rlumonu4 leoxo oo1lm elneo;()teuoxo oy1am n nesltfsDtmx ono0oet  ictadfsDrmnvpn()arxoif3io1omteaivils0trxriopiodom nlnvt s) ruaxm ;u4apx mfetysfa2ean o;t)artrmf tadfpDelueo;t)tetoim no1lp   neta(farrrxmonu1oetnii3tlsfsDul(msn(4tlxriociydfpD livol( t2ur(r3no4lmen ivtl(f Duax o;t4aleo oeiasfsDrl(vs;u0areoxo ta1fmt livi;(0 exoxm3io1omee ncsa()arta(m ot1opxn f3iydlmDum(ms (0 lxnxrcia1faDr nvs ( t2to(o3nu4lpenmfvtl( s2tmxm ot0opx ioeiasls uluvo (4tetoxo oa1fp   uei;() 2tr(r nydapenlieslt srum(  ;o4tpe  f3tltlmDemumonu)tlxrxf3oytom  luvols0 exo(m3iu1olt micsat) Dta( onu1tlxo fcias mDua(mo () etnif oytlpte n s s s2umir oudlleelict t  Drrxro;o4apt iieiadlm umn o;u0arenmo3iydfm ranvo;t trxoiopoy1alt lfcil(fsDrmum ;u0olto o3iasla emnvo u0tlxnio3iadomDranes s) 2xmir3io1ale  ics (f rraump;t1olxnio3tad aDumnvp;(4 etrmo3iytlmDe uvi;(0trxmir io4al elfcsat)s2rr( pnu4ale  ietytfm2rmn o ()arxnmr oytlaD  neo s0sexm(mpiu4opt mfct s)a2ta(mpnu0tpxn feiadls2ea(vsnt4trxrmf3todomDrlnes;t0srtmir3io4lleemivsas) 2rau ono0ape mfctasfa rl( p;t)tltoxo oa1latranes;t trumxm3nu4omtelfci s) rrrx ono0oee mfeias s ra( snt4aexoxf3ootfmtelu il(0setoiopoo1lle mfvtat)arumx onu0opxnmoeiys s2uaums;(0trtoxr oadfpD ln s t)trxmirpou4ope  neslsfaDrr(mpnt4oexoif3iat mDrau o;()aleoxociadfpDr iei s)trtr(m3oy1olen fvsls artaumoou4altnii3iadlm2em( snt)aeeoif ootop eln o (0 2uo(m3iy4am e fvia(fs2uru p;u0tpx ioeiad aDuanvo;u) lxrmr tatfpDeaivilt)trxm(m3nu4ol nlnvsas aDtaxr ;u1opt mo3iad s em( s;t)tltomfciydomDe uesls)trxo(rpou1apenlnvs (fsDurum no4tlen f3iysls2rmnvsnt0trtnxr oy1lat  i i;t  ruoxrpou1omenmicta(fsDrr( oou0teto oetas m umu pnt) exoxo iydlpt anvsls) exmim io1olt  ics t aDrmxr nt1aptn ieildls2emuvp (4tleoir3tatoat lnvol(0sexrim ou1llt mnctls) 2ur(  oo4tpe io3tadfmDraump;u4areoirctotomDeaiei;t)srum(m3no1lmenlnciltf Duaumoot4openii3tytla2emu s;(4tltrmocty1omD lnvs;t)setrxmpio1openlneia(fa2ururooo4tptnifctaslmDeau p t0tlxriociy1lp  lueo;t0t2trim no1al elivilsfaDum(mp;o1optomfetat s ran p;() reoxf tytlmDr ieo t  2urxr io4ll nlfcsas)s2umxmpnu0olto oeiys aDraump t4tltnirciodlmtran s () rum(opoodoptnlneta(fsrtmxr oo4alxoifctatfsDel(vsn(4tltrmrciydlpD an ils) 2xmim3nodop elnvia(  rtaxrpno0tpt miciydlmDelumo u4tlxrif3oy1fa   u s;( t2trxopiy1op e icil( srrmx o;t4tee  octyd s um(vp t0 rxnxociydom e nvs t)trtr(o nudam e nct t)arurxrpnt0apeomfeiytfm ra( s;(0trtrxf ia1lmD an o;s0srumxo3no4optelfcsa() Dtru ooo1tpx  ictatfs ra(mo t4aetnmfctydfmDr u ols  eumimpio1om  lfvil( s2tmu pnu0tpeoiictlsfm2el(mpnt4 lxnio3ta1fmtr u s s0 exr(o3oudlltnlfcsa(f Dumu p;o4aexniieiyd s2rl( o (4aleoxrciy1latran il(0s2xm(mpnudame  iet t)a2uaumo;o1oet iietlsla uaumo (4altnxo3iy1fpt lneo t trxmxm3ou4op e fvtlt) 2tmxr ;t1tlx ii3iysla ran s;(4 leoir io1faDr n s (  exmimpiy1omeemiet sfa2rmxmpou1apt  i3iaslmDea( p;t0aetrmr3iytfm  anvil(0srtr(opny4omt mivs s)sDrax  ;u4aetoiiciatfaDelu p;u4texnxrctotfp  anvs s0 2um(o3oudlmt livt ()arta(mp;t0texnmfciyt s ul(ms;u) rxnxf io1fmt ai sls) 2to(o ny1ap  mneslt)sDuaum ot0optoifcils aDemnvon(4 ltnircoy1op  ai il(  rxmxr nu1ole lncslt artmump;o4tlenio3iysfsDrau s t0alxrxfcoodoaDrlivs t)trxrxo3oy4ll e ict (fartax o;o0opxn fctat a emumsnt0trxoir iotlp eliei t) rxmio3oo1lle lfct t) 2ur(r no0altoiieildlsDumnvonu4 renif3oy1fm e ivi;t)sexm(rpio4ll nlfvs sf Dtax p;o4apenmi3ildls2umuvpnt)aeeoio oa1fmtr u s;(  rumxo3iy4olte ncslt)aDtaxr no4tlxn feiyd s ulu p u4 lxrmr3oytoaDran i (0 2xrim3iy1omee ieiat srrmxr oo4teenifctyd aDumnmp;(0tlerxr ootfpDeln ilt)texo(rpny1ll  mnct t)aDtmu p;u1aeenif3tyslm rmn s;(0arxnmo3ia1lptelnes;s)seto(o3iy1om emietlt  rtaxro;t0aex iociadfa2ra(vo;u)tlermr3iy1omD  n i (0teurxr ou4lp   nvs ()artrumo;o1tlx  feiadfmDumu p u4 eenmf3oydlp raueil( trtrim3oo1opt mfctat artaxmonu1tet if3tasla2ulu o;t)alxnmf3ootlp  luvo;t0t2xm(mpnu1ol e fvta(fsDtr(rpot4alen ietldfa rlu on(0alxnmrcoa1fpte i o t)s2xm(o3ny1apte nvtat)srrr(mpou4apto i3iyt s2elumsnu4 ltoxrctodoatr n ol( s2xoiopnudlmeelivtlsf Dtaxmpnt0tpxo o3iyd a ra(msn(4 exomrcoatla eaiei (0seumxm3oudalt lfetas a2rrx  oo1oeeoii3iydfaDrl( pnt4aexoxf3iadlmDrau sl( trxrirpiydame mivs tfs2umxrpnt1oet iociys s ul(mo;() lxnifcoadla rli o ()srtmim ou4al e nviltf 2trum ;u0olen fctad a rm(vpnt)aexrmrcoydfpDrlues;(0 2xm(r3iu4amtnlfct s srtm( pno4alxomfctydla2rl(ms;u4tetoir oa1lm  li o;()trurirpnodamt  nct s a2urx  oo0optnmo3tytlaDuln on(0tlxnxo oo1faDelu i;s) 2trio3oy4oleemnct s) 2rru o;o4aptoiiciytfs2em( s t0alxriocoodlpDraueslt trxmxo oo1lp   nvsas  Dtru p;t0aetniiciadla2rl(vp;u) rxomo totlmD anvo;t0texo(rpnodlmenmncilt)a2ra(root1aetomo3iyd s ra(vo t)aeermr oa1lmDrliei ()setoio3oydoleemnetl( a2um( p;u0tlenmfeiyt m rmn p u) eenxf oatlmD  n s (  eto(o3nu4am   iviat aDuaurpou1tlt  o3iltfm2rl(vs;u4aeeomo3oytopDraivo;t)t2xr(o3iu4om  lfvslt s2rmxr ;o1aptnmietas s2ul(vonu) eerir3oatfate n sl(0 rxr(r3no1aptelfcslt)a2ururono4oeeomoctytlmDrmnvs;u0 lxoxoctytlmt  i o (0texrim3oodapt mfvtl()arumurp;o1apt ioetydlm umuvs;(4aetoio3oy1lp eluei ( sruoimpoo4oltn neils srtm(m ;u4tltomoeildfsDelnvsnu4alenxocoatomDeai o t trumio iy1apenmfciatfaDrmx oot0oexnmfctadls umnmo t4texoxrcia1la ranvs () euoxr3ou4al n ncta()s2trxmpot1tpxnifeiytfs2rmu s ()arxrxfciydfptr i o t0s2to(o3oodomenmivtltfarumx oou1tlxnioetysls emump u4trtrmo iodlp r neil()texo(opiy4amt mfes tfs2umx o;t1ole mociytlm um(vonu4arxnxf iytfmD  u ols teuoir ny4lm elfeiat)s2tr(rpnu0open f3tld s2eluvo;u)trxnmo iydfmtelnvo s srtr(mpiudlpen fcias  rrrxr ou1openiociydls2rm( s t4teermo3oa1late ivils0t2xm(m3iy4apeelfei tfarurumpno4alxo o3tydfaDrm(mo;t0 reoxo iydfat  ieil()sexm(opno1lmen icsa(f 2trxmpou1teeoiieilslm rmnvp;(0tlxnioctydlmt  ueo;s)sexmir3ou1omte fvi t)arrrx p;o1aee  fciltfs2eanmp (4 eerir oy1lmDelnei t0trtrxopiy4am   fcil(fa2rrurp;t1aetn fctlsls2ul( sn()alxrmfciydop elneo;t) rurim nu4al n ivtatfaDtr(rp;u4apeoio3iydfm2ulnmo (0arxrxf oatlm  li s;t0trum(r nydoptemictlsfaruaxmpnu0tetn f3iysls2ea( pnt) rermo iytfmteai o (0s2urim3iu4ome mfcsat)aDtaumpot1oexnif3iatlm2ea(vp;u0arenif3iadlmt  n o;t0setmxrpoudaltelfeias)srta(mpnu0aet moeiasla rmu p;t0alerxrctatfmt  nes;s)truo(r no4openlnet () Durumonu4tltnmfciadlaDem( sn(0teenxf3ta1fmDeau o t0 2xmimpnodlltemnctlt arta( p;u1texnmf3iadfaDemu s;(4 lxrxrcoytla eai o;s) 2xoim3oodop n netls)sDumurpno1tpxomocilt s2rln s;u4 rxrmfciadlmDeln s ( srurxm oodalteliesl(fa2truro;t1apxnmo3tytfa umumpnu0trxnmoctytfmDrlivs t)teum(r iydol n fciltfarururpnu4texnmiciatfsDuln s;t0altrio3tadfpDelu sl(0 etrxmpny4lleemnvi s s2trx  no0apxo oeiyd s rluvo u0tetrif tydop e u s (0trtrio iu1ll nlfvt s  Dtmxro;o0texo f3taslsDel(monu4 eerircta1fatr ivs s teur(r ny1lpe mnet s) 2trxr ;o4olx  o3iydfsDrmumsnt)arxomoctodfpD aivs ( truoirpou1ope mfvsas)s2uax o;u4tlxn oeiltls umuvp u4 etrirciodlaDrln sl()s2tr(o3iy1lpeemfeias arumur ot0altnmictydfmDeauvo;(4tetnio3tydfptrln s;( t2xmxrpiodapt mfvtl( sDuaurooo1olt moeiytlm2um( o u) eenxo3tatlmtr i i ( truoxo3nydaltemieia(fsrtax ooo1alto ociysfs2umumonu0alxnmr3ia1omD an olt sruo(opio1ol n fcsl() rtaxmo;u1tpe io3iltfsDem( p (4texoir3ty1oa r nvi;()t2tr(rpio4lpe mncslt sDum(mo;t0tpe miciatls2rluvon(4 lxrmo tydopDelneo;t) rxoim3nu4ope lnvt s) 2rrurooo0tptnmo3ias m2ran s t0texrmf oadopDrauei;t)trtrir3iy1omtnlfct s) Dur(m oo1alxnmoeiydlsDua(vp;t4 lxnif3oydfpD anei (  rtmxmpou1apee netat) rtrurono0tpeomi3ild m ulnmp t4arxrif oydlatr n o s srumim ny4ameelietas srra(ro;u4tpx mi3tadfmDeluvp;()arxnmf3ta1fmt aivi (0sexrxrpoy4lp emiesl()s2raxrp;u0tlx  fcilslm2rlu s;u4 lermr oydopDeln i;() exo(r ny1al elnvs t  2rmxr ;t4tpeoiieilt sDelumpn(4aleomo tatlptraiei s0srum(r3oo1amte ivslt) rtru o;o0ape mictyd s umums;(0tltrmr iytom rauei;s0teur(mpno1am e fvs sfsDtrx  ot4tltnio3ias m2eauvsnu) rxoifcoytla raiei s0 rumxr iudoptemfvtl( s2trum oo0tex  feiysfa uaumont4 ltrxocto1fp   ieo;(0 2xo(mpoy1lmtn net sfsrrrxrpot4alxomf3iad sDuaumsnu)arenmf3ia1op   i s;( sexrio io4oltnlfcs tfsDuaxr oo4aexomf3iadls2ua(ms t4teerxo oatoaDr iei;s seto(o3ou4llenlnesa()srrmxrpnt4alxnmfeiadlmDemnvpnu0trxrxf3tydlmteanvi t0 etoio3ny1am  mnei sfs2tru p;t4apx  ociasfm ranvs;(4 ltoio oy1fpteaivo s seurxm iu1ol nmfeslt) 2umur ;u4tpe iietadfmDumu p;(4 rtnmf ta1optranvo;s0 rto(opnodal emfeta()a2ra(rpoo0alxnioctltfm2ran pnt0tlxoirctydop eluvil() exmim nydoltnlietl() Dta(rpnu0olenmi3ils sDrlumo t0alxoiocootlptrlies;( texo(m oudaltnlfvtl()sDra( o;u1aexo ieiadfmDrm(mpnu)texrir ia1omDrlivs ( sexo(m ou4am  lietlsfarurx  no1olto ieilslm eaumo t)trerio tydfpt li sl(0tetrir3nudalenmivi (fs2umxmont4apxnifctad s ra( s;u0aeeoifcoodfatrlnvo;(0 rtmxrpoy1aleelivi s sDta(m no4tetoioeias s2emu s;t) ltoxr oy1op r uvo s0 exo(mpnodapee iciatfsDrmur nt0alenioeiyslmDranmpnu4areoir iadlat aivolt  2umxm3no1apt lfeiltf Dtmu pno0ole mieiad s2uauvpnt4alxoifcty1op  luvslt0srxrir no4llee ncs t srrrum oo1tex ifetldfmDranvpnu0tlxrif3iotfateai i ( t2xr(r iu1omtnlicias aDumxm no4aptnioctld a ranvs u) etnioctodfate ivol() eurir ou1omte netls) Dua(mpoo4alxomf3tysfm2elnmo;u) exomf3io1lmt  u s s s2umim iu4llenmfeta() Duax  nt0texn iciys s elnvo;t)tetoircio1oa  livils)trxrimpno1ame  ieiltfa2uaxmo;o4oeen f3iydlm ra(vsnu4tltrxf3totlmDelueol()s2xo(rpou4al e fvias) rrmxr nu0teeomfciysls2eauvo u4aetomf3todfat au i;(0trum(r iu4olt  fes s a2tr(m ;t4tpto feiasfs eanvo u)texnif iodomDrlues;s  rxoxm oo1lle lfvia( aDra(  ot4tetnifciydla2uan snu)arxrif3oo1latrluei;(0srum(rpiydamte icil() rrm(  no4alxo feiyt sDemums (0 rtoifciodlm   i ol(0trtrim3no1ame lfetat)s2uaurp;o4tpenmiciyd s2ea( o u4tetnmoctytfpD lnvi;(0 rtrxrpiu1om n iesatfsrtm( o;o1opxnmf3tldlmDulnmp;(0tlxrmr3io1fm elu ilt srum(r3iu4am elnet t)srraxrpoo1apt ioeiad m rau s t)tltoif todlp eaueils texrxm io1op e fctat)a2ra(m nt0tle mo3iydfs2em(mo t4tltomfctodlm r ueo;()truoio3nu4lm   ieta(fsrumu ont0optniieiaslm ran s;u)treoxr3tytomDr n s;(0setoxmpoudapeemictlt a2ua(  nt4aetnmfciatfa2rlumpnt0aexomocoatoa eln slt0 rurim3nydlmtnmnctl() rum(rp;u1olt mo3tydfm rl(mpn(4 leoxo3oytla r ies;( t2tmxm ny4lp n nvilt)a2rmxm ;o4aleo feiyd a2emn pn() rxomf3tadop  aueol(0t2uoxr oy1lm nlnvil( aDra(rpou1tlxoif3tytfm uanmpnt0 exrxr tadfpt au i;s)srtm(mpiodap n fctls)sDrr( pot0texniiciydfa2rau sn()tltnirciotlmDraiesl(0trxmio nu1omtn neilsfaDuax oou1oltn ieiadlsDumums;u)teermf3iotopt  ivo ()sruriopoydol n nes ( aDraum ;o4altnmocildfs2emnmonu0tlxoioctatoat auvolt  rum(o3iodamenlnvt (  2ur(rpou1ale  f3ias m2umuvp u)aexnif3ia1fmDe u ilt)t2urxrpoodlp emfcil(fa2rau  ;u0alxoiietys sDul( p (4aleoxfcoydoateau ols)t2xm(m ou4llen nvs sf 2rrx  ou4tlxo ietyd m2ulnvpnu)tleomf3io1fa elieo;(0 2urxr nodoltn ivsl(faruax p;o0tlxo iciyt a2ranmpn() reomo3iy1fmtelieol()t2urim3oy4ame  nvi t) 2rmxr nu4oleoifeilslm umump;u4 ltrir3tytla e n i ()t2xoimpiudlmtelfvils srrmu oot1alto f3iatfsDumu s;t0trxomo oa1fpt  n slt0 2xrimpou1ol e ieslsf ruaxmooo0aptnmieiatls uau s (4alxnxf3oa1oaDeai ols)texmiopou4ll nmiesl() rumum ou0aexnmietyslmDra(msnu4 lerxocty1oatrau i;t  2xoxr3nydoltn neiasfsDrax o;u1alx  fciatlmDul(vsnt0texnmrctotlatrlnvo t0srur(o3no4lm e fetatfsrurxrp;u4apenmietas m2ulu s;t0texoif oy1lp  lu i (0t2xrxo ny4ome miesa( sDrr(m ;u1optoifctld aDumu p t)trenmfciy1oa eln o;t0 rxm(mpiu4al  lfei (  Dur(r ;t1alxomf3tydlaDrm(msnt0arxoif3tydlmteaueol( s2trim3oy4am nlneil(fartaxmo;u4ope  o3tlsfs ranvsnu)tetomo3oydfatelieo;s)texrxr no4lpe lfetas  rrrxr nu4apeoio3tadls2ua(ms;t)tltoircio1oaDe nvo s)t2xm(o3ou1aptn fvslt)aDra(mpot1altnmietldfa emn sn(0 exrif3tydom  lu s;s s2xoir3oo1aleelfvt s  2ur(m ot1tpt iietlslaDra( ont)alerxf3iotfm   iei ( t2xo(o3iydapen fesas a2trx pot1tltn oeiltfs ul(vpnt) lxrxf iy1fate nvolt0srumxr3oydll e ietls) 2ta(rpoo0opto f3iydfa emnmpnu0alxnxo3tadoa elnvil()t2xmxmpou1apenmfes (fa2raxmoot1texnmoeiatfsDrm( s;(4artrmf3ty1fpDe ivo ()s2trimpiy4apenlfctls aDtaxmp;t1tetnio3iyt a ra(msnu) rerxf oytfptrlieils)srtoimpio4aptelnei (fsDta(rpot1ole mo3ildla2raumpnt4tlenmo iotop e uesls0 rxoim3oudaptnmiei ()aDur(r ot1aexomieiadfaDeluvonu)areoxo oytoa r u ils)teur(r3io1olt lieiatf 2um( ono1apen f3iaslm2elnmp t)aetrxf3to1oaD aivi s setmir ny4altn nvil()arrrxmo;t1opx  iciys s ran s;u4artoirctatoaDraies s texrxopno1ll e nvsas)aDuau  ou4opt mf3iydlm eluvs u0trtoir3oadlpDe uei;t0trtr(r iudaptnmivslt aDtr(rp;t0aexomi3iatfs2ua(mpnt4 lxnifcta1lmD aues
\ No newline at end of file
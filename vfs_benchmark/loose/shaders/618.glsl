@@ -0,0 +1 @@
+ueilt0teum(mpio1lltnmicil( aDra(m ;t0ale  f3iltfmDul( pn(4aeermocto1fa  aivol( t2xo(o oo4aleelnvtls) rrmx  ;u0tltn i3iytfaDul(mp;t)trxnxo3iy1fm rlieo s  rxrxm ou4ll   ncsat) rrm( p;u1altnmoeiadla em( s (4 etoxrcoatfaD anei;t0t2um(m oydap   ncsl() 2tmu oou4oeeniocildlsDemn p t4tetoio3tydfaD lnes;t0t2xoir ny1lm e net s arum(r nu4apxn fciytfm umu onu) rtomo oydfatrlivs;(0s2xo(r oodam nlfctlt a2ta(mont1tpenioctltfm uauvsnt4areoxr iadopD li i;(0s2xo(r3iu1lleelfes t)a2um(m nu0olt mo3tldfa2ea(vp;t) rtnmf oa1fptrau o;t)teto(rpoudolen fcils  rtr(  ot1olenmf3iat a2emumsnt0alerxf3iadoptr u i ( srto(m3nydapt lfetlt)srrru onu1tee mocild a2rln pn()aetomf3oadfmDelivo (0 rxrxr nodop nlivtls sDrmu ono4olen oeiytlm2rmums (0aexnir3oadlmD aieilt texo(rpny4ll  lieta( a2tr( poo1openmiciad aDrl( p;(4aexrxocoodom  aneolt0tetoxr ou4aptnlnciat)sDrax p;u0tetn octld s2ul( pnu4 ltnio3oytopt li o (0s2xrxm3oydlmt  fcilt)sDtmum ;u4aptoifciaslsDrmnvp t4aetrxr to1fa raues s truoxo3iy4amenmnvilsfs2umumonu0aeto ieils aDemnvp;(4artoir3iodfat ln il( t2trxmpoo4llt lictas aDum(m nt0ale mo3tltlsDeluvp;u4 lxnxf oytoat  nvo s  2toim3oy4apt lieia(fsrua(ronu0tetomiciltls eau o (4teerxo3oydoaDe ivi;(0 2um(m3no4lmte fvi (  2umxrpoo0aex if3tytfmDuauvp;u0texomf iadfptran s s s2uoim oo4openmnct t)arrmx o;t1tptnmfciadfa emu s;u) etnio tytom   nvi t0srxrxm3nu1omenmieslsfaDtrumpnu4texnmfetatfaDeau s;()arerir iadlaD ai slt  2uoxo3oy4apt mivtl()s2trxrono0alen i3iys m2ulu o;()alxrmociydlptrauvs;()t2ur(mpiu4ap   fci (f 2tmx poo1aexnmocilt a2um( o;u0 rtnxr iadomte n i;(0 rtm(opou4opt  icsasfaDur(mo;u4oexomictatfsDrmn o;u4altoif3tatlpt luvolt)s2uo(mpiy4optnlnet sfsrtr(r no1tle  fctysfaDuanmo u4 reoxr3iatfmDr uvo s0 rtoxm3iu1lpeelfci (fartm(r nu4olxomfeiytlmDel(vo (4teenmr oo1fat li o () rxr(o iu1al  lnvilt)a2uaumo;t4aeeoiieiatfaDrm( p (4aeeomf3todlatr ueols0 exmim3iy4altn ivsls sDua(mpou4aee  fcilsfa2uln s;t0 exoxf3ia1laD anei;(0texrio oydop emfetlt)s2ta(mooo1oet  ictatla rm(vs u0alxnircoadfmDr i il() etmio iodaptnlfcsas  rrmurooo4tpeomoeildls2ua(mp () eenmociatopDrluvi s s2umiopno1opt mivtltf 2ur(m ;t4optomieiysla elumpnt4texrmr3iodfm e i o () exmxm iy1lptemfctas)srua(moot0oetn o3ilt s2ra(mo u4aetrmr3oo1lateai o;s)trtrxmpio1olt  netl( aDur(rp;t4tltoiieilt m2rlu onu4aetnmociadfp rau slt seumxrpoo4optnlnvi t) rtau oou4tex moeiyslm2ulnms;u0 lenxf3tadoptr ivo t0srumiopiy1ome lnetat) 2tmurono0opxo oeildlsDum(monu0 eenmfciadlaD li i;(0t2uo(rpnu4ap emnctatfa2urxrono0oex  i3tld s ea(msnu0 lerxo oytomDrln s;(0 exoxo oo1op   fvt (  rtm(rpou1olto oeiatls2uau on(4aeermr ootlp  ln i;t s2toio3oy4alenmnciat a2rmuro;o4ale ii3tysfa um(ms;t) renmf3oydla e n s t)sexoxmpiudap n ics (f 2um(mooo1ole mfetytfs2uan o;u) rerirciy1lptean s;t srtrxo oo4olenlfet s)sDrmxro;t0opx io3ildfaDeanvsnu)aleoirciotfmDeauvo t0 eur(r no4ole micsat)a2tau ooo0apxn f3tasfmDrm( s;u)teenmf totla r u sls0s2trxo3iy1olt livs () Duax oou1apx io3iysls ul( s t)trerxrcoodopt  u s;t  2toxr3oodol nmnesls arurx pno0oetnif3tld a elump;(4 rtnif iotlm e u i;( teuoxr oy4al  lfetas s2rax pot4tlenmiciysfmDrlums u0arxnxf iatomD aueol(0teurxr3no1lm  mfesas aDtm(monu1texnioetytfmDrmnmp u)aetoirciydlptraieo (  eumxmpio4aptemfvtltfa2ua( oou4opxniocils s2eanvp;t)tetomr3iy1fa eaueil(0t2tmxmpoo4ape  ncs tfsruaxmoou0opx ifctltfs rau ont4arenxr3oy1fpD  n sls0 rtm(mpnudalenlfcs sfsDur(rono4ope iociydla rlnms;(4alxoif iotopD  i s t) 2umxo3ny1lmt mfeils)a2urxr ;u4tex mieiltfs emump t0texnir3tytomtean ol(0 2xoxrpiodap n fei ()sDtmxm nt1oltomociytfsDrmn o u0tlxnmf3oydop elnei ()setmxm nu4al  mfviat)artr( pou0aexomfeils m umumon() etnxr3todfpt ln o;s0 eto(o io1omt lfvtas)a2ta(mooo4alxomieiltfm rm(mo (4aexnmf iotfmteluvolt0 exoio ny1am e nctl( sDrmurooo1aexomoetytfsDranms;t0 reoxrciy1lmDe neols  etm(o3ou4al nlnesl( aDtmu  oo0apxo iciltfs emu s;()arerxo3tydfmDe nes ( t2xoxo iy4open nctasf rtr(ro;o1teeoioetadfa2ulnmsnu4aetnmfctydoat  uei;s setm(r3ou1ol nlici sf Duaum ou1tpx  o3iad sDulnmo;(4trtrxf3totfpDe nvol( setr(r3nudoptemnvt s  rururonu4texomfctytfmDem(vsnu4areomo iydlpte nvo;(0seuoxo3io4lme  nvt tfs2ururoou0tlxnifctlslaDrauvp;() eenir3io1fmD lueo (0srurio3nudlp nmfctl()a2rr(  ;u0oleo oeiyt s em(msnt0tltoir3io1fa rlues;s  2uoxo nodolen fct sfa2ta( ono4tlenmfeiysfsDrmnvsn(4trxomo3to1oa   n i;t0seurxo ny1al n ietatfaDtru ooo1altniiciadfs2emn snu4aetoxf iotlmte n o;(0srxrimpoodlpt  fvs s)artm(  ou4texnmiciys sDrmn o u) rxoir3iytfaDeaiesl(  ruoir oy4omtn ictl( arraxm nt4oexomicild s2ea(vo (4trtnio3tytlaD lu ol()setmxr ou4lp   fcsasfs2ururont1apt micilsla2el(mo;(4tlxrmr3ta1op  livi;(0tetrxr3ny1ap nmiviat) 2um(roou0oet  i3iat a2rm(vp (0tetrxo3ty1fm  lneolt)t2trirpoodlm e ictlt sDuaum ;t4ale moeiaslsDel(mp ()trtomocoatfm elnvo s  eur(m3nu1ole lnciatfa2ra(rp;o0openmieildlaDeau snt)texnmo3ty1laD livo;() rurxr iy1lm e fciatfsrumxmoou0texnmi3iys m eanmsnt4aeeoxo3ootla  lnvs s)t2uo(r3iydal nmnct (f 2um(moot0tpto i3ild a rmu onu0tetrir3io1oa rlues;(0seurim nu4ale lics sfaDtrumooo1texomfciytls2uaump u4aetnir oydfpt lnvs;() exr(o iu1optn ict tfs2ur(mpno0aee  fetasfm rlnms u)alenxo totlpD luvs;t) 2uoxopiudam  mnviasfsDumu o;t0tex ii3tydls2uanmo;t)aeenxrctodlpD  i o t0 rtmim io1lmtnlfcs ( srrm(moot0altnmfciatfs2emu p;u)alxrmr ta1fmDr uei;()srto(rpiu1om   nciltf Dtr(rpno0olx mieiasla2elu p t) eerxo3todlpDe i o (0sexo(rpoo1lm elivtlsf Dtr( ono4tpxoiiciyslmDran p;(4tltrif3ia1fpD au s;s0tetmxm iu1lp elneiasfs2ta(  nt4tlx  octyd s rln o () eeoircoy1omD ai sl(  2trxr oy1apte fctl() Drmxmo;o1tlxo f3ias a2ran s;t)alenircoa1optr u o s trtrxm nu4ol n ieta(  Dtax  oo0oexnmo3iadfs umnvs;u)alxoxr3io1lpDr nvo;s sexmxm iy4ape liesasfaDta(mo;o1apenmicias s eaump;(4 ltnmfciydfp rlu i;(0 euoxmpnodllt  ncia(fa2rax o;t0texoiociasfa umumsnu)arxrmfcoa1latrlnes s)tetmxr iydll e fesl(fsrraumono0opxomiciltls el(vp;()treomo tatfpDeluei;t s2urimpnydaltnmfeils a2ra(rpoo4tee mfeilt aDelnvsnt0tlerir3oa1fmDr n s t texoxopoy4omtelicta()arumxronu0altomiciadfsDrau o;(0 rtrxf3iadopt  u o;(  eumirpnydom n fci sf rrrur nt1tpenmfciydlaDum(vpn()tleoxr to1optelivo ()srtriopnodom n ncsl(fsDtaurp;o4teeo i3iyslmDelnvp;t4arxrir iadlmt  neols0t2xmxo iu1al n feiltfsDraum ot4olen f3tltla2ulump t4trenif3iydfm  aivi (0setmxm3oy4am e ies tf rum( poo1tpenmf3iad s ua(ms t4arxnmr iotfpDr u i;()srur(r3ny1lmt lict (fsrrrx oou1tpt  ociatfmDul( s;t4alermr iydoateaneilt s2um(m no4lmen ncia() 2ur( pou4oetniieiyt a uau p u4alxrmo3to1optr nei;t0trto(mpnydlpt  fcsat)aDua(rpou4open fctlsla umu p;u0tlenmfcto1fp e nvs;s0t2umxopoy4omeeliet t)srua(r ot1aetn o3iad s elnms;u)alxrxf3io1omt an i t0trxr(r3iudlmtelnvias aDrrx  nu1tlto i3tlsfaDumnmp;t0 eerir3iatlpDraieo;( texoxr nodol n ivt s)srrr( o;u0ope iietys a2rmnvsnt0 exnmf3oodlmDr ivo ( srurim3iydlptn iet (f 2rmx  ;u4oeenmocildlm ran o t4texnio3tytoaDeaueilt0s2xr(m ou1lpen nct (  Dtmur ;o0tlx mociadfa uln p u0 exnif3ia1optranei s sexoiopny1amtemicil(f 2ua(  nt1opt  f3iltfm2rl(vp ()aetrio iodopD ai i () rtr(r iydape lics tfartrxrpot4tltnmi3iltls2uluvo;t0tetrxf iydfmtrauvs;s)setrimpoo1ameelfcs t  2tau o;u1tptn o3ias a elu onu) exnif3io1oa eau ils)srur(r3iodoltnlietat) Dra(ro;o4openifciyt a elu s (0tetnxr iodopt luvi;s0 2uoxopnu4op elfcsl(faDtaxr ;u4texnmocilslm2umnvs ()alenxoctotfaD ai i;s0s2xrxo oydam  mietlt) 2rax pnu0olenif3ilsfs2umumpnu)tlenxr iytlptraueo;t0t2xmxrpnu4ale  nvtatfaDtax pot4apt ifeiyt a eaumo t0artnif tadomDr n ol(  2um(m oydol emnvt t)srua(r ;t1tpxoiietls s2rluvp;(0 lerxo3ty1opt anes;s)t2trir3iy1lltnmieias)aDraur ;t1tlxnmf3tldls rmn onu)trxnir iotfmDr ueo (0seumirpoydamtnmivsl() Drrxmp;u0optoioeilt mDulumsnt0trtnmf ia1fpt aieo s0 eumxo oo1lm   nvs ( arrrx  ;t4aetnmoctyd a rlnvp;()artomfcio1fp elues t t2tmim3nydlltnlneils)artr(mpoo0aee  feiat aDel(mpnt0tltnmo3iy1opDe u i;s0srtrxm ou4llenlncslt)aruaumpot0oetomiciat s2ra(vo u4 exnmo ia1omtrli i;()t2tr(o oydoltelnvi sfsDtax pnt0texo i3iytfm2rmn p (0 renifciatfaD  uvs t0texoxo iu4lptnmnet s)srraum ot4aexo ociydfm umu o;()trxnmo3ta1lm e ivolt0s2umio3iu1llenmnvt s)s2urur ou4tpenii3tld m2elu p u0aexoif oa1fatrln olt0t2tm(opoo4alt  ivt sfs2trurp;o4tpe  f3iat m2elu p () ltomf oo1oat lu s;t0 exrir3iodll elfvt ()sDra( p;t4tet mfetld s2emuvsnt0treoxf oo1fatranvslt0teumxr iydlm n netl() rumx oot4oee ii3ilsfm2elnms;(4 lerircio1om ran sl( sexrxrpnodll e nesat a2rr( oot1opxomfciadfs2ulnmp;t0 rxrio3iotlm e ieo s0truoxm oodop  mfesas aDtaxm nt0opt if3iltlaDrau sn(0texoif tatoaD ai i;t0 rum(o iydlmt mnetas)arrm(mp;o1alt mf3iltls elnvs;t4 rxrio3oytfp rlu i t0s2tr(o iu1oltelivtlt) rtrxrpnt0tpx mi3iatfs ua( s u4trxnxfcoytlaD ln o s)srtoir3ou1openmnvi (  rtmx pot0oltn f3ilslsDum( p;t) eermo iy1oate ueo;s)seum(o3oydop nmnvs s aDtrxmo;t1tlxomfeiltls eanmp;(0tetrmfcia1oate ieol(  rtoxo3io1amee ivt s)arta(  oo0teenifctaslaDrl(vsnu0aetnir oadoat auvsl(  eumir oy4omte nvs sf 2rrxmp;o1tlenifciytls rl(mpnt)teerxr3iatfa rlivols  etoirpiydam  lict tfartaump;u4opt ioeiydfmDrmu s;(4areniocia1lp r uvolt0 2ur(r iudlme micsl(faDuaxm ot0oee moctadla2ua(vs (0 ltnxo oy1fpt  u o;(  2trxo nydomeelnvsa()artmu  nt1aee mocildfmDumuvo u0 etnmocia1oa eai o t0 2xoxr3io1opte fvsltfsDrmx  ;t1alxo ietas a2eauvp;()tetrmr tadom e n o;t0 rum(o oo4ll  lfvsat)s2uax o;u4oleo oeiyd aDemnvsnt4alxrmrcoa1opDeaivs (  exmxr no1lp nmfcs ( s2tax  ;t1altnif3iytla uanmp u4 rtnircio1lpDeaieils) exmio nudlptnmivias)srrax o;t4tlenmi3iydfs2uln sn(4aetnifciydop e nes ()tetrxo3oudopt mivsat)arrr( oot1apxn oeiltlsDem(vp;()tleomfciatlpDrlu sl(0 rtoxopno4op nmivt (  rraum oo4tleomictat m ua(vs (4tlxoio oytfa ranvi;s  rxrim iy1lme  nvil(faruru pnt0tltn ieiadlaDrmu p u0aeenxr oytoaDeanvs (0t2uo(o nydoptnmivi () Dum(  ot4tpe if3iydlm rmuvont0aexrxociytfmtrau s t0 rxmxr no1lptnmivia() 2taump;u1oetnmocild a el(ms t)aeenxo iy1la e nvs t0trtrxm3no4aptemnvia(fa2rmxmo;o1optomfetadlmDuan p;t) lermr totoatean olt0setmir3ny4llt lici ( s2trxmo;u4olenmfeiydla eanmp;u)altrio tytoa raies s)t2to(o oo4am emnctat s2tmxrpnu0apxomo3iytfmDrau o;(0trtriocoatlmteln o;t t2tmirpio1llte fet (  Dtax p;t0tpenif3iyt a rln onu4 lxnio iatlpDrlu s s0srumirpoydape  icias s2tr(m ou1teeoio3tldlm2ean p u)texrioctydfmt au o (  eum(opoydlmtemnvi t) rraxmoou1oex  fciltlaDrmnmp t4altrmo todlm rli ols) 2xoxm iy1ll nlneiat aDrrxr ;o0aet  ieias aDranmo t) eenxf3ootom elnvols tetrxo3no4lleelncias)sDtm(roou1apto iciasla rluvp u4 lxrxf oytlat lnvi;t trxoio3iu4al n nvsas s2uax  ;u1tet mfetatlm2elnmsn(0aetnxr3iytfpDr uvsls  etrxrpoo1lpenlfei tfarra( o;o0alxoio3iatfs ulnvp (0aeeoxf io1fmtrln il( s2xmxr3no1lmenlncs (  2tmx  ou1apeomoetyt s2ra(vsn(0alenmocta1la r iei;s  exmxm io4am nlnetlt sDrmxronu4ape io3tyt a ea(mo;u4 reomf oa1laDe ivo;()trtoxmpoy4lp n ieiltf ruauro;o0tpxoiieiadfa2ran o;t)trtoio3tytlm eaueol(  2tmxm io1ll n fctl(  Dtm(r ;u1apx moeias m el( pnu) rerircty1optrlnei;t0 rumio3iodol n ivi tf ruaxm ou1oet iocilsfmDrl(vpnt)tetrxr3oa1fp rai o;s0setr(m3iydam n iet t)sDra(rpot4oexomociat s2ea(vs (0trxnmfcty1fmtrln ol()s2umxmpou4lm  lneta(fs2tmxr ;u4oexomo3ilsfm rln snt)alenir3oa1lp eln s;s)teuoxm nydlm   nesls) 2rmurpno0alx  oetadls2rlnms t0 ltnmf iodla r uei ( teuoim3oudam   nes tf rurx p;t0opeo o3iltfm rlu ont)tlenmo3tadlate ueo;s  2xmim oodoptelfcs t srrr(mpou0tpxnmfciys sDel( p;u0alenmo3iy1lmteaueols)t2umir3nu4lmeelneiltf ruaxrpot4texomiciadfmDuan s (0artrmfcoydoaDe i ols  eto(rpoo4ap elnvi (f 2tax ont4tee mfctldfs rmn s (0tlenmocia1lpDrlieo t)texr(m oy4apt mfvsas) Duaurpoo4ape mi3tat mDumu pn(4 lerxo3iytlmt livs;s s2xoir3no4alt  ietat) Dumx  oo1alxo oeild sDeluvont)tlxnir todomtrli s s)teumxr nodolt lneslsfs2ua(rpou4ole mfctltfmDrm(mp;t) lxnio3io1fpt  nvils)truoir3oodalte icslt)a2rm( ono0open oeiatfs elnmonu0 ltrxfcoy1omDr ieo t teumxo3no4amenlivsatf Dumxrono0ope mictytfs2ua( snt)arxrxf ootoptranvs t s2xoxm iu4lmenmivil() rrr(m nt0opxo o3iasfa eanmpnt4teerxo io1lmDe ivo;() 2uoiopnu1amtelfcs s  2tr( ooo1teeoiietat a umn pnu0 rtrio oadomDrlieslt0t2xr(mpny1lpeemictas sDrrxrpoo1aexn ictydlm2elnmsnt)trtnmf tatfaD  uvil()s2xo(o3iu1am elfei t)aDrm( pnt1tptniieiasfm em( o t) rxrif oydlm e ueo s) rxo(mpiodlmee icils a2umxmpno0tetniocils m um(mo;(4alerir todoa e i ilt  rxoxrpoydlmtelieil( arumxront4optoio3tltfs2um(vsn(4 etrir iydfa rauvi;t0srtm(mpiydom emivt s  2ua(mo;u1oexn ieiasfaDuau p;()aetnmf3iydfmDrauvs t)trum(mpno4am  mnvi ( s2rm(  nt0aex  i3ias m elumo;() etrif ty1fmt  ieils0trtm(o oo4ol n ieia() rurx  oo0tlto i3iytfmDuln s;()aetomrcootlpDeaivo;s0teumxm3ny1ome lnctat srta(mont4oeeoifciatfmDrl( p;t)aexnio3iy1oaDe uvs t)srumxm oy4om nlnesas) Drmum nu0texn oetysla rl( s;u)tltnmr3ty1oa  an i (0 rxoir ou4llenlfcsls) 2umu p;u1ope  fciytlm2eaums u0 lxrmf3todop eanes s0srxrirpou4ol  lfeia( a2um(r nu4alenii3tysfmDrau snu)altrmo3io1lmteliei (0texoxo3ny4lpt  ivs (  Dra( ont4apeoiieiasfs rau s (4trenio iydom  livi;s trtm(m iudlmeemnesa(f 2urump;u0teeoioetls m2ul( pnu)trtnir3iy1opDrlnei (0srxmxm3iydlle  ivt (  rrax  no1tlxomo3iat m rmnms;u4aeenmf iadfm  aivi ( tetmxm3oudlp nlnvta() Dtm(  nt4olx iieiasfm2umnvont4trxrio3totlpDe i s ()tetoxo3iudaptnmiesat) 2ua( oot4alxomi3ildfs2el(vp t)aleomo todomD  nvolt  2umxopny1lltelnvtas  ruax  nt0olen f3tldfsDeau p t) rxnxo iotfmD  ieslt seurxr3ny4om nmnvt ( srrrx o;t4apxn oeiatfm rm(vsnu) ltrmr3ootfmteaieo () eur(r3iy1lpeelnct ( a2umur oo4oexoifeildfs2uln o;()trtnifciadfpDranvsl( s2trxm3no1lp nliesa()s2rrx  ou1alx moeiatfs2emuvp;(4aeermfctadlpD au o t0sruo(o nu1ll emfcsas) rtr(  ot0tleo feiydfaDrmn pn(4 eenxo3iodopD  ieol()srtmir io4ame  fvtls)sDum( ooo1aet moetytfa rlumo;(4areoxo iotoaDr ieo s0 2umimpny1apte ivtlsf 2taxmono4aex io3tyt mDeln o (4aleoifctotopDelies s)srxoio3iy4ll emnct (fsrumu  ou1tpx mfctysfa2rl(vo;t4 eerxo iodomt  ivilt  2xr(o3ny1ol emfetls  Dum(r nt0apeo ieiasfs rlu p;(4alxoifcoa1op rluvo;s0 rumir3oy1lmtnlici t s2tr( poo0texnioeiytlaDuanvo t0 rtrirctatlmDeli ol( sexriopiu4ale lncs ()artm(rpno0olen icilsfm elnmonu)tlerxf3totfpt lies (  2tm(opoy4lp n fcsa(  2trxmo;o1aee io3ildfs2elu o t4 rtrxoctytlmDe n o s) rtrxm oydam emictl()s2trurpnt0tpt io3tat sDum(vo;u0trtrmf tytfa ran o;t)trtrimpiy1omeemnetl()aDumumono4olenmf3ils s ea(vp u0aexnxr iotfp rluvs;s t2xrxm nu1lpen fvt sfsrua(m ot0ole  icilsfs rlnvont)tetrif3oatlpt au s (0setoxo3ou1ap emnvslt  2urumoou1tex  fetadfs2rmuvsnt)arxnxo3oadla rlivi;(0 rtm(opio4lpe  fctl( srrax ono1apenio3ilsfm2ranvp u0 etrmf ootfa rau o ()srtmxm oudapt lietas arrax o;u4aleniieiad aDuln p (4arxnio3tadfmtrlu o;t0sexr(m3nodlme  fei sfs2tax  oo4oeto ietatlm2ulumpn()texrif3iodomte n o (0t2xrimpiodll nmivil( aDtm(m ou0altnmfeiatlsDul(vp;(4 reoxf iy1fp  luvs (0seumim3iu4amenlncs tf rta( ono0tptomoctyslaDrl(vp u)aexrio oo1fmD  u o;(0t2umxmpno1lm n netas) 2rrum oo1apt mo3ilt a2rl(msnu0tltnio3totfm  aiei;s)t2tmxm oy1lp  mivi (fsDrrurp;u4alenmieiasfm elump t4aexomfctotlptr i o;() rtmxmpno1oltemnvtls) Dtaxrp;o4aetnmicilslm ua(mo u0 exnif3ty1laDelnvs t  rxo(r3io4altemictls)srtm(mpnt4tee if3ildfs umnvsnt0altoircio1om rlu sl(0 eumio iu4am emiesas a2tm(r ou1texnifciydls rm(mp;(4 lxomociatlaDr u ils)texoxr3oydap n ivtlsfs2urxmonu1tee io3tadlmDemn o;t4tltriocoa1oat  i o;(0trxr(rpio4om  mfeta()srrau o;o4tlenmo3tysfmDrlu p u0texomrcoodfp  ln o;s0srtoxm3no4ap n nvsat  2rrx pot4tpxoii3iyslmDum(vp t0 lxrmr3oatfpt  u sls0 rxmio ou4am nlnvs tfs2rmxr nt4alx iictasfaDeanms;t4tltrxr3oo1lpDelueo;()trxm(r3nydoptelivils sDtrum nu0oltnmo3iysfs2uan pnu0altnxfcoatlateli o;t srurxo3io4opeemnvs sfaDurx pou0altomociysfs eau on()arenmf3ty1om  lnei s sruo(rpoo4omt mictl()sDumur nu4tetnmoeiys sDua(mo t)trtomocia1omtraues;()seurio oudllee iciltfsrumumpno0oeto feiydlm2eau snu)teerir oadlm  lies;t0s2urirpiodap   iesasfsruau oou1olt  f3iydlsDul(ms (4 rtnircoa1fmteai ol() 2urxo3oy1al  mfvi s aDrrxmoou1alx  ictlt s2rmuvo (4trenio ootlat  ueslt setrxmpou1alen ivsl()srurum no4oeto oeias a umump t4 rxnir oy1omtrauei t seto(m3nudop  mfcils a2tru o;t1ale  iciasfs2umn s t0 rtnmrciotfate nvols seumxo ny4omte ici sf 2urx p;o4tet if3iadfm umums u4 eeoif oatlmDraivs;t)t2uoio3oo4am elieils) Drmurpnu0apen i3tyslm rln snt4trtoif3oadfaDraueil(  rtrio iu4ale mfvtl(f 2rm(  ;t1tlt io3iltfmDuan s u) rtoif3oytlaD aivi ( setrim3oo1ape mfei sfarrm(root4tlx miciadlaDrluvo (0 ltoir io1fmD  n sls t2trxr3iydapeeliviat sDrmx poo4tlxo iciltla2emn o;u0altrxr tydfm elivi (0trxm(r3oy4lpt livil()a2rm(ronu0open i3iatfs2ranvo t)tetnioctadlaDe u sl()seumim nu1op   ictat arurur nu4aptn fctytls uanms ()artnxrctytlm e uei;(0setr(o3no4ap e nesas aDumumonu1oleomfeiytlm2umuvpn(0 exrmf oy1omD  ivs s  2ur(opiy1op e fvs t  ruaxr ou0apxoioeiydlmDelumo t)tlxrxfcia1lpt ai i;s)setr(m iodlpt lfei tfsDurxmp;o1olt iieildfm ra(mpn(4tlxnxr tatlpD an sls trtmio3oo1ole mnvi ( sruax  nu4apeniiciyt a um(vs;u) rxnmf3ia1fat aues s) eumxm oy1am   ietat) rtax ooo4tpenmf3iyt s emuvp;(0 etrif oatla e i o;( t2uoio nu1ope micsls) 2tr( oot4texoifetytlm eauvo;u4artrxf oo1opD  uei;s0 rtmxo3nudop elicsls s2ur(rpnt1ole ii3tadfaDuauvs ()tetomfciatop rai i;(0teto(m3ny4ll emivias) Drm(r ou0tpt io3tyt m2el(mp t)tlenmrcoydopD aieo;()trtrxm3nu4oltelnvtlsfarrrxrpoo1oetomi3tls aDemn o () exomf iy1laD  nvs s0 2xmxopou4op e nvil(fs2rmum ;u0aee  ieiys s2rlums;t4 lenxf3ootomte u ilt)seum(o oy4ol elnei ()srra(  no4aleo i3ildlsDem( snt) rtnifcoadlmD  u o t  2trimpio1lme  icslt  Dumx  ou0texniociys a uau pn(0teerir3oadlpteai i s0s2toxrpoo1aleemfvsasf Drrxmooo4aleoiieiltfa2ul(ms;() rxrxocia1lp rln i (  2trio3io1lm  miviat) 2ur(mp;o1tpenmociysfa2umuvo t)altoxrciytlpDelnes;t)srtm(o io4lm   ivtas arrr(m nt1tpe  ictas sDemu s;t) rxrif3todoatran o t0 rtmim oy1omt mncsl(faDtaur ;t4altomfeiyslm rm(mpnu) eerif3iydfptr ivilt0 rumxr oodlptelnct s) rumxm nt0texomf3ildls2uanvs ()tlxomocoo1omDelieil()trurio3iodlp elnes ( a2tm(  ;o1opxnmoetaslmDeanvs;(4trxoifcootfm r n olt0 euoxo3oo4omenlnvsls  Duaur no4tetn fciydlaDrln pnt4 etnmfcoytfm eluvslt0trxr(m iy4alte icsa()s2uaxr nu1tetoio3iltlm2eanms (4texoxr oa1om eauvo;s0 exmxo oy1lmeemieilsfsrur(  ;u4aexn fctad mDrm(vont0texomrcoodlp  aieo;s) rtoir3ny4llt livsls  2tax  ou4opto fetysfaDrl( ont)altrif3ty1opDrlu s s0 rto(m iudllt lnvil(faDurum ou4oee miciatfs2ulnvs u0 lerxr3oytlmte i i ( srxmxo3oo1apeemfetlt) 2tmxr nt0opeoifciatfa2ua( ont0 etnmr3ia1fpDean o t)s2ur(opiudll   icsat s2umxr ;o0optoioeiad aDem(vpn(0treoiociatlmDeai il( t2uo(m nu1apeemfvi t srtmxmpno4teto o3ilsfa emuvpn()tleomfcoydoaDraivo;s)texrimpou4llte nvi tfartaxm nu0opxomoeiat m rmnmp u4texrxf3oa1fpDe ieo s0trxr(m3nydlme mivs sfsrumu  ;o1ole mf3iydfm2emnmpnt)aetoxf3totfaDelnvilt)s2xoio3nydomtnlfvt (fsruaurono4alt  ietlslm uluvpnu4teermf3iytfa eln o s truoimpnu1al emfetatf Dta(mpot1tpe miciydlm um( s t)aexnir3iydlmD livolt trtm(o ou1lltnlnvs s)srurxm ;u4ope  iciltfs rmnmo u4aleoxf3iatfatelies ( srurxr oy4ol   neilt)artm(ro;t1olt if3tld mDrm( sn()alerxociy1opDeaneo (0tetoir iy1ome  fesasfarrr(  nu4tptn feilsfm2ulumo;u)trxnio3iytlmteauei s0 etm(m3nu1optelictl(f ruaxm nt0aetoiieiatfa2eauvs;t0altrxrciatfptean s t0s2xmxrpoy4ol nlietlsfsrrrum ou0alxoifciad s elnvp;u) reomfcoatfm ran il( seum(m oo1am e ivia( a2rmx  no1tpt ifeiasls2eaump;t0 etnxf3iy1oa eliesls) rtrxr iydaltnlfcias sDuaumont0apt  oetltfaDrln o;t)treniocta1omte neils  euoxrpiu1olenlncslsfsDrax oot4aex  oeilsfaDem( s (4 lxnmrciodlpDeau o;s) euoxo3oo4olenmnet tf 2uax  ;u4ope moetasfsDranms;t0 exrxrcoytfat  iei;t)srtr(mpno4amenlfcilt) Dtrum ot4aet  feilsfmDrmnmo t) exoxrcty1faDr ieo ()setoim3nu1llte ivs t  2rrxrp;t0oleoii3tls m2ra( o u)altrxr iytoaD lneils t2trxm nu4lltnlfetat)artmur ou1apxo oeilslsDeanmo;u0altnmfctytopt ln o (0t2tmiopou4lpeemfctltfsDtaxmpnu4tpxomfeiytla ulnms;(0aetomf3ta1om eanei ()sexrxm oydop nmicil()aDraurp;u1tpto oeiatla umumsnt) exoxo to1la e nes;s) rur(r3io4lltelfcta(  Dra( pnu4aetoiociytfs2rm( p;t0texomr3io1lmD ai o;t0 eur(rpno4ol  lfesls aDumxr ;o1olen ictyt m2umu o;(4 rtrmr iotopDrlu s s seto(rpnu4oltn neiat a2urxrpno4texniietytfs rl(vp t)tlxnir3tatfmte ieols  eumio3iu1lptnmneilt  2taurp;o0oet ii3ildla2ra(vp;t0trtrio oydlp eauei () 2toxm3iydll nmfvt s)arum(m ;o0tpenifeiat s ua(vp u)areoxo oa1la r ivilt)s2tmirpiudop nlfct () Duaumpoo1alx ifciytfs eaump u)aetoxocoatoaDr ivi;t tetmio3io1lmtelict tf 2rau  ou4tpto f3ilsla2rluvs;t0 etoxf iydopt aies;t)teumim oo4alt mfet sfarum(m no1oex moctasfaDeanvp;t4tlxomociodla rlues;() eurxo3oudlltemiciat sDurx  nu4oleomi3iatfsDelnmpn(0tltnxoctotfm r u i;t  rum(opoy1amenliet ( arra( oou4tlxnmo3iytfs elumpnt)alermf3iytomD  nvs;()s2xm(m iodamt mictlt)s2rax oou4tlxnmfetysfsDuaums;t) rtrxfctadlmtraivils0trurxo3io4lpenlivtlsfsrtr(rpou1tpe moetys m2umums (0 leoifciatlmD luvilt trur(r3nu1open fctlt) Dtm(rp;t1optnmieiltls2umuvpn(0 rtomfciytlm   ivo;t)setmxm oo1lmtn fet t)a2uaur nu4oet mfeiyslaDean snt4 rxrif to1lpDeai i ()t2tmirpoodlp nlnviat)sDtrx pou4olenif3tldla2elnmp;(4teeomfctadlp e nvo;(0seum(o iydapeemnvtatfsrumu  ;o1tle ifctls m2ua( o;(4tetomr tydoptr nesl( srtmimpiydoptelnvtat s2ta(r nt0oex  fciltls2uanvo;u4 exrxr3tytla r ivo;t) 2xoio io1lmtn icia(  ruauro;t1teeo oeiydlm uau p;t4tlxnio iydoa eli o;t) rxrxmpno4apt lnctl(  rumumoot1opx  i3iaslmDrluvo (0 rtoio ia1fmt  ivilt0setmxmpoudlpt miet (f Drm(  no0oee ifciys aDemnmon(4trxoif3iadlptelu s;t srtoir3iydll emict () 2rmxmpnu0tleniictld a emnvp;u) reoxo3iydfm   uvi t0t2ur(r ny4am e nesas  rrax  nt4apenifeildls2uluvp (0treoxfciydlp e nei;s)t2to(opoo1lmt  iviasf rrau ooo0tpt ifcias a2ua( pnu0 ltrxocoydlaD livsl(  rurxr nu1ll e nvtatfs2rrx oot4aexnmoeiatlmDel(mo;t)tltnxociotoatelivo;t  2urimpnu4ame mfctls s2taurpnu4ape mfeilt a2rlnmp u)arxomocoodfpDeaieo;t0tetrxo nu4apt lfes s sDrm(m ;o4alxn fciydfaDrmnms u4 rtrxo3oadfa  lieo s texoirpnu1oleemnct ( aDrrx p;o4ale miciytfs2um(mpn(4teerir3oodlaDe neilt)sexr(r3iudamtnlivsas srtau  ;o1olenii3iadfsDulu snt0texrmo iatfpt aneo;s seum(o3iy1opte iciat)sDrr(ro;u0aexn iciys a umu p;t4 renmf iadopt an i;t0t2urxm nydamtemiviat s2urum ;u1oee ifciys aDrm(vp;(0tetnxo3totfa e ivi s0s2xmio oy4al nmiet t aDrrxm ;o4tlxo iciad sDea(mpnu)trerxf3ootomDranvols trurirpoodlp elnct sfa2rau  nt4tleoiietatfs2uluvo t0arenif3tatfa  auvolt)sexmxr nodapt mivs s arta(mpot1olx moctadfmDrm( p;t0teeoxoctodlmteauvo;(  eumxm3oodole lfvtl()aDur( o;u4tet iiciasla2eauvsn()aexriociydlateln s t)truo(mpnydllt mfvtlt)srtm(r ;u1altniociadfa ran pn(0 ltoxf tatop  lues s)teumim3nu1ale  fviat srrrumpot0alenifetyd aDrl(mpn(0 rtoif to1fateaies ( trtrim3oydamt lieslt sDum(ro;t1aetomiciydlmDem(vs;u0altrxr3todoa   nes;(  2toir nodlptemieiat  Drmx  oo1tee iieiysfs umuvo;t) rxnxf3oo1om  auesl( s2xmio3iudolee fct (  Dtrump;t4aleomfeiysfs2raumo;(4alxnio3tatfp e u slt)s2ur(r3no4omee nvtat sDtmxrpno0texo octlsfaDel(msnt4alxoir to1oatelnvs;s)setr(o3oodapeemfcsl(  2rmu  nu4ape iociltlaDrluvs u0 ltnmocoadom e ieo (0 rxrxr3oo1lm   ics t arrmxr ot4tpt iietydfa uaump;t)aexnxrciadlmDeli o () 2tr(m3iu4amt lnci t) Drau p;u1ope  oetadfmDem( s;t) lxoxfciadomDe n i t0s2xr(m3oo4aleemivsls)a2taump;o0tpe  fciydfsDranmo (4areomfcta1oa eaieil()trxmim iodapte ncsl()sDraxmpou1aetn feiat s emuvp;t)aeerirciadfatelivi ()s2urxo iu1lpenmnci ( sDrmumpoo0oex  f3iad m2rmu s u4trxomf3tytop  auvo ()sexmxopnydlme  fesas)a2rr(ro;o1alenmfctlt s ua( o;u)trtomrcoadom e u s s0srtoio3no1ape lncsa() Drm(rono4oeeomiciltfm el(vpnt0 lxnxo to1fmDelnvs t texm(rpou4lpen fvsl( a2taurooo4oltomoetat a emuvs (0arenxo3tadlmt li o s)teum(m nu1apte ict t sDumxroou1tpeo f3iydlaDrm( o;(0 rxoxocoodom  luvsl() exmxmpou4ale mfetasfarrr(  ot4tpxoif3tlslsDra(vo u4 rtrxo3ty1lpD anvo;s truoxo3iy1lltn nci tfa2rrx oot0oltn f3tls aDuanmonu0 rxomf oo1opDrlnes;s0s2toxo3oydllt liet s) Dumu  ;t1opxo iciatlaDelnms t)trermrctydopD lu slt0sexoimpiu4ll nmnvs ()arur(  ;u1oeeomociys m2ul(mpnu0trtnxr iadlpDr uei;t)texrio3oy4lmtnmneias arrmx poo0optoiietasfaDel(vsnt)treomrcoatlmte n i t  euo(r3iodlme  fciatfsDumumpnu0opxomi3iatlmDran s t4 etrxo3iytfmDrau s t s2xrxm3iy1lptn nciatf Dur(mo;u0tpto ictadlm um( p;t0 rxoir oytfatrliei;t s2xr(o io4omtn fct (fa2umu  ;u0alt mocildfmDel( snu0treoirciydlpD lnvo;s) eurxrpiu1ap n ici (  2ta( poo4apeomo3ildla ranvo;(0alxoir tatfa ran o;(0 rxoxr3iudome lfesasfsrtm(mp;t1alxo fciydfa emu p;u)tltoxf iodom r i s;s  exmxmpoo4ale lnet ()aDtau onu0aleomo3tysfs2rlnvp;(4trxrmf3tatom eluesl(0seuo(m3nu4lmt  ivtlt)artaurp;u1aetn fetat m2uanms;(0trtrio3iatlaDr ies;(0 2tm(mpnodap nmivils sDuaxm ;u4tlto feiatla umn snu)texnxfcoytfpD ai i;t  rxo(o io1ameelfvtl()sDuau ont0tetnmociysfs2uau p u)arxomf3tadom eaueo;() exoxmpiy1amenmivtl( a2rauro;u4aleniietatfaDrlnvp;()aeenxf iatlaDrlnei s  2xr(opoy4lmtnlfctasf rrax  no0aptomieilt mDumuvo;t)tetrxocoo1faD liei ( s2uoir iu1lp  lfvt tfsDrau ont0tpxoifciytla um(vs t4texnmf tatlaDrai sls trurxmpiu1am eliet ( a2raxm ou0tlxnio3iydfa ra( pn()tlxomf ta1opte uvilt) eto(r3io1aptemncs () Dumumpoo0tpeoifeiatfs2uauvs t4 renxf ty1oatr nvils0texmxrpiydom e iviat) ruaur nt4olxniiciytlsDelnms (4arxoio3iy1lm   ivo s t2xm(opnudlmt livi tfarrm(rooo1tet iieilsfm umumo (4aleoifcto1oaDeluei s0 euoxr3oy1om emictas)aDra(r ;o1ole  ociatla2eluvsnt4 lxnmo3to1laD lu s;s  2umio nodapt lnvsl(f 2tmu  nt0apeoifcilsfs rmu s (0arxoxociydfmt luei ()srumir3no1al elieilt)a2raur ;u4alx  ociasfa elump;t0 ltnxf3ta1fmt lnes ( srxm(r oudamtn ietl() 2ur(  ;t0aet  octytla em(ms t0arxomf3oo1omte ivo;(0teuoirpiy1lpeemfeta(fs2ur(  ou1oet  i3tyslaDumnmo;(4 reoxfciydfa elueols) 2tmxmpio4op elncsls srrmxmo;t0tlxomfctlsfs eaump (4 eeoio3oo1lat luvs;s) 2xrio iodlle lfvtlt aDrmxmo;o4tlt  oeiltfs2um(vo;u4 rtnxrcoatfpDeaieslt)srxr(m iu1op e ivt () rrru oou0oltomo3iysfa uau p u4trtrxr3oodlpte ivo;t)t2urxm3iodol e fci () rua(rpnu4aet if3ilt s2emnmo;u) reomf3oodlpte i i t0 eumxo nudlmenlnet t aDumu  no1tetoii3tadfs rlumo (0aetomo3iy1lmDeanei;s s2to(r nodoptnmfctl(faDur( o;u1tle mi3tlsfs2el( s u4 lxoxf3tadopDrln o;(0srtmxr3io1lmeemfctatfsDtrur ot4oltniieias sDrm(von(4aeenio3todfmDeaues s) 2tr(opoo4ol  lfci s)aDrr(moou0tee iocildfmDuanmo;u)tltnmo3todlp  lu ils0seuoxr oudlpeelieslsf rtaxr ;u4oltn icilt a uln s t0 exoxfcoo1op e neo;s)trum(r iy4opee ncia() 2rr(  ;t0tltnifctytls2rmnmo;u) reoifctotlaDeauvs;t)srtm(m ou4lmt mivt s  Drm(r ;t0aexomieiydfm2em( s;t)artnmrctodoa  aueils)sruo(m io4amtnmneta()arrrumooo0olen ietldfs2uau on()tltrxrciytopD  u i;()trtoiopnudlp nmnesltfa2rrurooo0oee  fciatfm elumo;()alxrio ia1la elivsl()s2tr(r ou1lmen fesl(  2trum no0alxnmfetls a2rl(monu) etoiociy1opDelu i;s)t2toim3oo1op  mici tfaDrmxmpot4tltn octasla ulnvs;u)arxrxociadopDe ivslt0 exoxopno4lpe lncsl()a2rmxm ou4teenmoctatla emu s;t0teenxociadfmD ai o s sexrio3nudop n ici tfs2rax  oo0oexnmoetysfa2um(vonu4arenxo todfmtran i;t0tetmxopoo4lptnmnesa() 2raxm ot0oltnii3tadfa rlump t0alxrmo3oadoa eln o s)sexoxrpou4lmee fctlsfa2raxmoou4alen feiyslm ul( ont0 ltrxr iatom   ieo;t)t2xoiopou1lm emfvsa()srururpot0teeo i3tldls2emu o;t4tltomocoatoat lnvolt  rtmiopnodap elnetl(  rum(rp;u0oleoifcildla2eluvs ()alxoxf oatfmDeluvs t0t2ur(rpiudalt  fvtlsf 2raxrpno0aee  ictaslsDran snu)teerxo iy1fa eau ils t2uoxopiy4ape mnci s) rrr(mp;t1apeo iciytlm ranms t)treoxo3tydfpDrlivil(0srxr(m3oudol e fctl() 2rmur ;u0olt ioeiysfmDuanms;(4teermf3oa1oa  lnes t srum(r3iudll n ics tf rumx p;o1olt ii3iydfa2emu p (4 exrxo3iadomteluvsls0trxoxrpiy1op   fvi tfarrm(m ;o0tlx  oeiyslaDea( on(0aetomf ootfptranvi () 2um(r3ny4omenmfcta( arrmum ot4teeomoctysls2uau p u4arenmr3oy1omtr u i;s0 etr(opno4ape  ict sfs2ra(rono0tpx if3tat a2em( o;(4aetrif3to1oaD ln o;t0t2xmimpny4al e nctas  2umum nu1aee  fciyt a emnmp;()aeerircoo1fptrluvo;s  rxmir3ou4lle  ivsatfsDtaum ;u1tpxo ictls s rlums;(0 exrmrctatfatrlnei s0trxrxo nydop e nvta() Dtmxmo;o0tlt ifciys s umump;(0tltnmr3oytlmDeai o;s sexr(m3oudam  mivtls s2rmu  nt0aexn ietltlmDul(msn(0alerxr3oatfaD ln o;( sruo(rpoo4lpeelivt sf 2ua(r ;t4apxn i3iatls ulnvsnu)artnmf ootfaD lnvo t) etmxr3iy4aptn fci () rrm(  nu1aeto fetltfaDel(mo;u0 lxniocoydoatr nvils0srtrxopiy1alt lnes ( aDrax  ;u4tpt io3tyt a rlumo;u4altoxf3tydfpDrlneslt t2tmio oudlpeelfcsl(f Duau ono1texnmo3tadla2ra(msn(0teermrcoy1faD  ieo ()s2urxmpiy1al  mfct (fsrrm(mono0aetnmieiydlmDrluvpn() rxrxf ty1oatrlnvo;s)setrirpnu4ame lncs sfaDum( ono1oexn oeild m em(mont)aeeoir3oo1lm ran i;() 2to(mpnu1opt liet (f 2rmxmpot4teeo feiltlsDrau s u)altriocoatfmt au o;(0t2urirpiy1amte ncs s  2taxro;u0oexoiiciltls2rl(mp;t0tltoir3iadfmteluvi s sexr(m iu1alenmnctl()s2tax  ;o4opx if3tad sDuln sn()arxrir3oadop eli o t) rtrirpno4oltnmict s  rra( ont1tpe ii3ilsfa rmums t4 rxrmr3oatlmt  uvo;(0tetr(mpou4lm nmivtlt  Dua(mont1opxomfeildls uauvon(0 lermf3tadlmDr nvs s0s2tm(r3iudap e nvta(f 2ta( o;u1tlxnmfciasfm ranms;u4trxomfcia1fa eai ils srur(r iodomte fcta(fs2tr(m ou0open fctydfm2ua( s;u0tlxnioctodopt luvil()trumxrpnudlm elnvi () rtrxmo;t4apeo oeilsla2rmnvp u0trtnifciatopDe u o t trur(o3iu4lpenlfvta(  Dumxmpoo4olxo fciasfs2rmnmo;()tetnxf ty1oa eaivi ()tetrio iu4olte fvsa()srrm(ronu0alt mf3iytfmDemn onu)aexoxrcoo1lpt  i o;t0 2xrxr3ny4ome  ivslt a2umur nt4oexo feilt m2rm( s (0 rtnmr3oy1lp rauvs;s  2xm(m3nydape  ivt s)arumumpot1tpxo f3tadfmDulu pnt4trxomo3oo1la r ies;s)setrio iy1olenmiet (f Drmx p;t0oeenmfeilsfs2eaums;t0trerif oadfp e nei t trxoxo nu1lp nlfvs ( s2rrxmp;u0oexn oeiysla elnvs t)artriociatlp eauvo s  eum(o iy4apen ieta(f Dtr(moou4ole  oeiltfaDel(mpnu)arermo3tatlpDelueilt)trxoirpiudlle lnvtl()a2trxrp;u1teeoiieiasfa ulu p u0tleoxr3oodom   neo s  2tmxopiodalte fes () 2uax  ;u4altn fctlt m2rmnvs;t4 etrmr iydfaDeauvols teurimpou4ol  mivsatfs2rmumo;o1tpe mictltfsDrlu p;u) rxomo3ia1la rln o;( t2um(r nu1op n neias  rrmu pot0oex  f3ilt s2rauvp t0trtnmo3oydfmtelnei;t setrxmpoydopeemfvsl(fa2tm( p;o1aexnioetadls rauvpn() ltriocoydlmtrai o t)texo(m iu4ol   ivia() Dtrx pno1alt iiciasfs2rlu s;()aexnxr3iotom eaieo;(0teuoxr3nu4openliei t sDrr(r ;o1tpxo ieiat m umumo;t4artnxo ootomD luvi t0sexo(o3ou4ame mnetlt a2urxmoou4apeo f3iyslaDrmuvpnt0 rxnxf ty1fmDelues s) rumio3nodol elfcsas arumu oou4tpeomi3ilsfs2um( pn(4aeeomr3oa1fate i i (0 2um(rpou1apt mneils srtmur ot1ape mictltla2em(vo;u) rerio oo1omDrli il(0t2uoim3oudal   ivt t)aDrm( pnu4optnmoetad s rmn s u0aetriocoatoaD  iei t0s2toimpno4lmt lieta(  2tr(mp;o0alxoiictat aDum( p;t4arermf tatoaD aieo (  rtoir oy1al nlfvtltfaDtaxro;o1tlxniietldla el(vpnu0 rxnif3iodlpDr n s t  eumiopio4ll emfvtas)a2ur(rpoo4opxniietyt m2elnvpnt0 lxoio3ia1optr i slt0srxr(rpio4lm emncta(fsrtm(rpoo4oex  f3iyd m uaump u)trtnif oy1oa  an ols0 2uoir oo1amtnmictls  2tm(mpot4oetnmo3tadlm2em( pnu4 lenxo iodfate i o;t  2um(rpio4lp emfvtl( arum(mp;o0aptn fciys aDrluvs;t) lermf3iy1fpDrauvslt s2uo(o iu1am emncilsf Drr(mpnu0opeo f3tytfmDeanmpn(0arxomociatfpteaivsl(0trurio io4ll e ncs s artmu  nu1oleomfcildla2ean p;() rxoif3oadlp  aivi;s trur(o3iudlleemies (  Drrxm ;u1tpenifciat mDemn o t)aetrxfctotop   uvi t) exmio3nu4opt mivi sfsDtr(rono4tpxoioeiaslm ua( s;()arxrmf3ootlmte ivslt0texo(mpou4ome lfes ( aDrm(mpoo1oetoii3ildls2emums;t4tetrxf ta1fptrai slt0tetrim iodlp  mfvt t  2umxr ot4opx  ociyt m2uan s;u4 lxnmo totfpteln ols)srtrxr3nydlm emfct ()a2uau ooo1opt  fetytlm ean o (4 etomocto1op ranesl(0 rto(m oo4omeemfvs s a2tmxmono1tpxomfcildlmDumn sn()artnir3oodlpDr u il(0t2xm(m io1lptnmict t)sDum( oot4teeo f3iyt m ua( o (4tlxoxr iy1opteau o;s0srtmio3iu4ll emivta(  2rmxr ;u1oee ifciytfa eln o;u)trxnmfcoodlmD li sl()t2uo(r no1ll e ncil() rtm(roou0texn feils mDrln s t0teenxoctydop  anvol(  2xm(mpou4ap emnei s sDrau pnt1tex if3tyd aDrmn s;t)tlxrmr oadfaDrluvslt)texm(rpoo4lmenmfes t)aDuaxrooo1ope mfeias m2uauvo;u4 lenircoy1oat  neo (0texm(o ny1ame  fvsls)arumx pou1olen fcilt s2el(vont) lerxrctodoaDe nvi;s0t2um(rpiu1ome lncia(  rrmur ;u0ape iociydla ra(mo ()trxnxo to1lp rai o t)s2xmirpiudol  mfcslsfs2tmxrpoo1aetn ictys m2raumsnt0 rxrio tatop rlivolt)t2trxr nu4ap nlneslt)s2trxm ;o1oltomo3iytfmDuauvo;()tetrmo3iatlp  anvols srtrim3oodomee iei tfsDtrurpnu0olto f3tadfaDel(mp t4trxoxo iydlpt lu ols0trto(m3ou4ol n nei sfa2urx ont4tetomfetatfm2umumo;t4tltrxo3ty1lmtran i;(0 rtoxr3ou1lmeelfvtltfs2tmx  no0tlxn ieilsla rl(mont4aexoxr3oatoa r nei;t0s2trim3iodole livtas arum(moot0aleo o3ilt sDrlu p;(0 etnxf todlaDran olt srur(opiu1apt mnetat a2um(m ;u0tetn ociyt aDeanmo (4teerir3todop rli sls)t2um(mpno4oltnlnet sfsrtm(root1alxo ieiys aDra(ms;t0artnir3oatfpte i i ( srxoim nu1olenlfeiat)sDta(mpou1optomfeildfa2uauvo u4trxrmo3tydlptrli sls0trtr(rpoo1am eliet t  rumu poo1tpxo feiltfs rmumsnt4aetrif3oodfp e i o ()sexrio oo4optnlfvi tfaDurxr ot1ope ifeiaslm ea(vo t0artnxo3tatlpt lieslt0s2xmir3io1amen fcsl( aDtmx pot0aet  o3iydfm2elnvsnu)aeenxf oa1oa  lu s t)trur(m oo1amtnlnviatfa2rrum ot0tet mi3tytfa um(mon(4aetrxocoytopteaivi;t0srxo(r3ou1optnliviasfsDrax  no1oltoioeiydlm2ranmp u0aetoxr ta1fp eanes t trtoxmpio1alen fcilt  rrrx pou1aexn o3iyslm2rl( snu0 rxrxr oydlat luvo;s  2urxm3oy4ap elnct ()artm(rpno0opx mo3ias a2eanvsnu4alenxr3to1lat an s;(0 2xoxm ny1lltnmnvta( s2ur(  ;t0ale  o3ildla2ean pn(0alxnxo oatlmDelivol(0 2xm(o3nodll n nvslt)arur(m nt1tleo iciysfm ul( p u4texomf3iotom   n i;t srxmxmpny4ame mfvi t)s2ra(rp;o0tptnmocilt s elu p u4 leomf ia1fateanvo ()setoir3nydapenlivtl( sDta(  ou1oeenmocilt m rmn ont) rtnmo3ty1omDean s (0srxo(o3oudolenlivtas s2rmur ;t1alx if3ils s eluvonu)texrxociadlmtr i i s srxoxopoo1amt lncta(fs2rm( ono1tet mf3iyd m2ea(vo (0arxnmrctydopDe ueols trtmxm oy1lle  ivtlt)sDumur ;o0aeto iciyd s ua(monu4tetoir3oydfaD  n ols seumio oo1optelnvt t srum(rooo4alxnmociys sDem(monu) renmrciadomtr u ils)s2xrio oudolen feta()sDrrx  ou1tpe  ieiat s2eln snt0 eeomocia1lm e ivs;s0s2xoirpiydllen fvi s)srrmxr ou1ape mo3ias mDrlnvo (4arenxr3tadomt  i i s0 2um(rpnydolen feta(f rurxrpoo0tlxn f3iltfm2rlump t)tltrmo ty1fm  anes;()s2xrxrpio4olt lieslt aDuaxmo;t1tptoifciat m ulnmp (4aleoir3iotoa elnei () ruoxrpio4op n nciasfs2ra(r nu1oetomiciysfa ulump (4alenmf3io1fa   iei;t0 exm(m iy4aptnmfvsls) 2tm(m nu4aptoio3iltfs2emuvp (0 lenxr3to1fmteauvi (0trxmimpoo4oltnlnvta( s2tmum ;u1tpenmo3ild s rmn s;(0aetoifciytlat lueil( trurxo3iu4ole mnct sfarra(mono4apt mfciasfm ulu snt)aexnxfciatomtr i sls0setoirpou4ale lfet t)srrm(rooo1tlt iictatfa elums;u)tetnxr ta1fa   uvs;s0seumxrpiu4apenliesa()s2taurpou0tpto feiytla2ul(mp t) rxomr3totfmte ieo;s texmir ou1omtn ivtl(fs2taum ;u4ole  f3iydfm ua(ms;(4 rtnif iatfmDr ivi;(0t2toir nudolt mivt tfsrtaxront1aexnifeiat s rlu on(0tlxrxrcty1lm e n s (0 2tmim3io4ame  nvsa() rumumpnt0aexomfeils sDra( s () rtrmrcoytlmD luei;s  2trxo oo1opeemnvtas) rrr(mo;t0tpe moeiydfm2rau p;u4 lxoir3tydoa r ieils)srxoio nodap nmncilsfs2urum ot4opt mf3ild s2ulu o (0 eermr tydlp rauvi;t  2trxrpio4om nmncilt)s2um(  oo0tlt  fetls sDrlu ont4tltoif3ta1lmtrlieils)seuoim iu1lmenlfcsas aDrrx  ;o0tptnmfetlsfsDrm(vo;t4teenmocto1fmt an o s) rtoxrpio4am   fetl(fsrurx ono0aet mi3ias m ea( pnu0trerxo3iodlmt lu s s0t2uoxo oy1omenlnvtat s2rmu  nt4texnmfeiadla2ea( p;t4treoir3iy1lp  lies;s) rxo(r oy1lpt  nctasfs2tmx  ;u0oetnmictltfa2rmuvonu) etnifciytlp  luvi t) eto(mpnodaltnlfvtlsfs2uaumonu1tlt  f3tlslm rl( sn(4aexnmociytoaDe ivs s srxrxopoydlltn icias)sDum(mpoo4olenmieiysla2ua(mo (0arxnir3oo1fateanes;( tetrimpoo4ll  mivi sf 2taxrpot4texomo3tat s rmu s;t) exnmf3ta1opDraueils  euo(o iy1om n ietl(  rtrum ;u4tptn ictadfa emnms t4alxomrctodfatelieslt0t2xmxo no4lptn iet sfaDtmx oot4oltoioeiatlmDeluvp;()trxnxf3iy1opteaneols0texr(r iu1openlnctasfarum(mo;u0apxn ictytlsDeanmo;u0altnif3oydfaD  nvol( s2trimpiy4amt lfcilsfaDraxro;t4tex  fetyd s2emu sn(4tlerio3tatfm rluvs ()truo(o3ou1ll n nvtl()aDrrump;o0apxnifeiad aDel(ms t0 rtomrciytfpDran s;( trtmxm3no4alenlieta()sruau oot4tlenmo3ilsfm rau s (4arenxrciotlmtelnvil()sexoimpoudll elfeil()aDuaxr ou0tltoioctasfa2uaums (4trxoif3todop raivs;() eto(o3oy4lleemfeia(  rtr(rp;u4oetomf3tatla2elu sn(0aeeoxo iotfmDeau s;s)seurio ny4lm  lnetatfs2ra(r ;t4olxo oetyd s rmu p u)artnio oy1fmD au i s0t2um(m3oy1ll   fcs t)aDrax  ou0oleoioetadfm eln on(0tltrmr iytla  luvo;(0 rxoxo oo4lmt mivi sfs2um(mo;o4ope  iciyd a2el( p u4trxoxr3totlaDean ols tetm(m3oy1al   nvtls  2rr(  no1tetomiciad s2rmu snu0trtnxo3ootlpDrluvi;t  rtmxmpio1ape  iviltf rrru o;u0tle miciatfsDra(mo u0 etnxr3iatfmtr i s;( s2toxo nu1llt mfes (faDumur oo0oltniictys sDrmump;u0 eeomr3oytlaDrlivilt0teuoim io1op n ivtas) Drauro;o0aexnmi3iadls2ulumo t0altnir3oydlm  auvilt t2toxrpiudlp elfeta( sDrax oou1oetoioeiytfm rln snt)treomr ta1faDe u il( truoirpno4opt  nvtls sDtax  no0aptn ictasfs2rlnmpnu0alxrmr3iatopD auvo;t  2uo(m3oudapt lnesl(  2um(  ;u0oeeomi3iadlaDum( onu4 renxr iodfm rau o;t trtmirpoy1aptelnetl(  2ta( p;o0tlxnmi3iyd m eluvs u)tleoxfcoodfmDranei (0teuo(mpnu4olen nvi sf Dta(m nu1altniieilt aDemnmonu4artrxf iytlp  ai slt t2xoio3oo4optnlfvtls) 2rrumooo4opx  oeiasfm ua( p;u) ltrmo3oy1fp e ueo;t0trxrir oydapt  fet ( aDtrxronu4tpen i3iytlsDelu o;u4artoxoctadom   ies t trumio oy1amen nesat aDra(m nt1alxniociasls uanmp (4texomr iadla  livo t0texoxo oydoptnmfeiltf Durxr ;t0texomoctadls umnms t4 eeoxr tytop  lieo;s)trumio3ny1llt mfesas sDra(moot4texnio3iltls2umnmo t0altoif3iodfa rauvols)srtr(o3iy1llte ivt tf 2rm(r ;o1aexn o3iltfmDeau p t4tlerir3iy1latrai o;s t2tm(m3io1alt lies s  rurx onu4apt mf3iytlm rmuvo;u0aexnmoctadfaD aneo ( srxrxm3ou1ap   fcias sDta(mooo0tptomo3ilt mDranvo t4altomrcoytlaDeau s s) 2umxrpiodole mfvt sf rrax poo1tleomietytfaDulnvp u4trtomo3oadlmtranvol( truo(opnu4ap n nvil( s2rrurpot0oeeniociyt a ulnms;t4alenmf3tydoptrau s s sexo(r3ou1omtemiesl( sDtax p;u4tee io3iad m2elumo;()alenif3oydomtelneo;t  rumimpio1lme mivi t)aDraumpno1oexn oeiydls2um( on(0trxomo iotom   nvs;() 2umxm3io1amt livsa( sDuau p;o0oetnif3iytfs emuvpnt4 rtrmrciy1oatrlues t setoio oy1olt lfcslsf Drm(m no4oetomf3iltls2eanvo;t4aeenifctatfmDelnes;t0trtoim3ou4alenlfvtl()sDrruro;o4apxnmieiadlmDea(vpnt) reoircootfatr nes t)t2uo(o3ny4lle  ictasf rrru p;o0oltniictatfm raumsn(4 lxnxfcio1omD lu i (0srto(r3iudlltnmnvt () Duru p;t4tle miciaslaDeanmsnu4tltnif3ta1fat  nvi;s)srto(m nydom nlfcsasfarumx ono1olxnmoeiys sDuanmp t4 etnxfciy1lp e ivil()t2tm(m3nu4ameemfes ( aDtau  oo4apeniocildfm2ra(vs;(0aetrircty1lmtran s s)truo(rpiudll   fvi t aDtm(roou1oetnifcias a eau pnu0tleoxo3io1fmt lieo;(  exmir oydlm n fvilsfaDrrumpot4oeenmictasfa2ulu p ()tltomfcoy1op rauvi;(0teum(m3iu4ale mnet t)a2uau o;u1oltomo3ias mDumnmo;u)teerxr3ia1lm  lnvs;s)trtmxo iudapt mivt s srrm(moou4apxo o3ias a2ran o;u0alerir3oodoptelivo (0srurxmpiudapen icia(fs2urxrpnt0tptnif3tytfaDuau ont)tltomr todfmtr u s t  etoir3iy1alenmfesl(  Drmum ;o1tle  fctydls2emuvp t0trxrmf ty1lpDeaies t0 eurxopiudlle lncias aDrru oot4teeo ociydlm2em( o;t)trerxf oytfatr u slt)srumxr no1lmtn nctatfa2rauroot1olx micildfs2ua(vont0 rxrir tytfaD lies;()srumxr3iu1altelicsls srtm(  ot1oetn f3ias mDel( onu4treoifctadom e ivs;()seurxr3oudopenlivtlsf 2um(mo;o4opeo ictyt a umuvs;(0teenirciodfmtranei ()teumimpny4aleemnvt t srum(r ;u0tlt mf3taslm2rm(mo;(4 rerxr oodomD au o s s2xoxr nudll emicsa()arua(r nu1tpeo feiadlaDraumpnu0 rerxocoy1fpteanvol()srtmio nu4ome liei (f Drru ont0texomfcilsfaDulumpn(4 renir oa1omt  n o (0trxoxm3ou1aptnmfvtltfsrtr(m nt0opx mieiadls2um( s t0 reniocoatlat  n o;t) rurim iydoptnmici (farrmxro;o0oetomi3tld m2ua(mo (0artnxr iotlpDeanvo;s0 2um(r3oy4amtn ncs s)sDuaum ;u1openio3ildlaDra( pnt)trtoxf ta1oaD lues (0trxmxopoo1lpt miesl(fa2rr(r nt4tpx  i3ilt s eauvp;(4 lxoif tatlmtrauvo;()srxmio nu4lptn nctat s2rmuro;t4texomo3tysfmDrmnvp (0artnxo3oo1omte nvo s0 rxmir iu4omt  ncils a2tmxm ;o4tlen oeilsfm eauvpnu4 rtnircoatfmtran ils0sexrxmpno4apen fesa(faDumum no4alt  i3iadfmDrlu o u) ltomo3oatfmDe neo s0 2to(o3nu4lle livils) Dum(rooo1oee iicildlmDrm( p u0 exomo iadfmD ai s t0 rxm(rpiy4am n ictasf 2trxro;u0altn i3ildlm rm( onu)trtomo3iadomDrai o t texrio3ou4ol   netasfaDrrx  nt4oleomicilsfsDem(vp;u4aetrmfcoa1opte n slt0srxmir nydlme  fvs tfa2tr(mo;t1aeeo ocils m2ea( pn(4texnxocia1oate uvi s srtoio iudop e nvs ( aDtmxmp;u0aptomf3tatlm2elumpnu4teerxfctodlm  luvo (  2umir3no4ape  ieil(  rra(m ;t0alt mf3ilt s ulnvo;() rxrmf iy1opte ivi;() exo(o ou4omtnmfvsls) Drmx  ;t4tetoio3tadfaDea(vpnu4trtnifcoa1lptr nei s0trxoxo iy1lle mivsl()a2ta(ro;t4aeeo o3iysls elnmp t0 etrir todlm ean i;t) rum(r3nudap e nct s)srrrxmpnt1tetoiiciasfa ranmo t4 rtrir3iadfa  li i t0t2uo(r nydlme liet t) rrmxmont4alenmi3iadls elnvp;t0 rtrmoctotfmDeln o;s srtrim3nodlpen ietatfarrmuro;u4oetnioetysla raump (0arenxf3ootlmte n o;s) etm(o iy1omen iei s sDra( ont0tltoiociyslsDea( ont4aeenxo3tatoptr uvsl(0 rumxm iu4om e ieiat) Drrx  ;u1oeeo oeiydlaDran s;u0 rtrxr3oadfaDeliesls0seurimpou1lp n fcs s) 2rauro;u4olenmoeiadfa emumo;(0artoir3oydfm   u ols0trxrir iodolte fvil(f Draur nt0apto i3iasfs2umumpnu4aetrif3ia1la r i o t0sexo(o3nodameemicilt) rtr(rpno4oexomfetlt m eauvp;t0 etnmfcto1oatelu ols srumxmpny4open ivsa(f 2urxmpou1altnmoeiaslm2elnvo u)trxrmo oo1lpD aneol( s2toimpnudam  mnvtl()s2tmxrpou4tpxn ocilsfs uan onu4aeeomf oodfmD  ieil()texm(m3iy4lmen fetas) rrax pno1opt mi3ils m2ulnmo;()aexoifciatla e ies;t)teuo(r iu1ll  mivtlsfsrumum ;u1tpxnifciys a eaumsnu4arxrmf3iadlmDeanvo;s)sexrxmpou1ol nmies s)s2tmu pno0apx mieiyslm2rlu o;t4texoxr3iytlpDe nei s s2xm(opnydoptelfvsatf rurumpno0tetnmietadfs rlumon(0altoxociotlate uei;t srxo(opiydapt lfctls  2urxmo;o1tpto feiyt s2rln p t0arxrxrcoodlmteau o s)t2toxo3io1amtnmnctlsfaDur( ooo4oexn feiyd mDuln o u0arxrmf3iydlatr u ils0s2urxrpio4oltnlnviasfs2ta(rp;u0oleoifetydfmDulumont)trxnif3totop ran s;t  2uoirpoo4oltnlfei sfaDuau  ;o0ape io3tldfs2ul(ms;t4 leoif ty1op eaivo;s trxrxrpiodame  nvta(  rtmurono4tpen o3iytfaDuln p;t0artrif3iy1opte nvs t)t2xr(o nodom nmfeils  rtau pno4texomf3iasfsDemu s;u0 rtnif tytlpD lieo s  2xoio3iu1ol nlivtl() 2trxmoot0ope  i3iltfa2emnvp;(4trtrir3oadoptelivi t)srur(m3ny1alt lnesl()sDtm(moot0tpe mfciadfmDumnmsnu4 ltrmo3oodomDrln s ( s2xmirpny4omtnmfei sf rtmxr ot0tpt  ieiatlm2rmn o;t0tetrmo to1omDeau o t0 etm(o nu4altnmfvil() rua(r ou0aex ioeildfsDuanvp t4 exoxf3oodop   nvs;s)srto(rpnodlleelnciat srumump;t0tlenio3taslm eln pn() etnmociotfatean slt  2um(o3nu1lpt mncsls  2rmurooo0alxn f3tytfmDeau ont4aeeomfcoo1optraivi;s)s2umim io1am nlfci t)sDtr(  nu1aetnioeiltlmDem(ms u)trerifcoatoatraneol()tetr(r no1am  mfvt s aDururo;o4tpx mietatfaDrm(vp;u4arxnxocootfm rauvs;t s2uo(o3nodll emiesl( srtrx  no1oltomf3tas s ulu ont) renirciytlpDrlueils)trtr(r no1ameemnetlt  rtmxr ot0oltniicils sDel(vsnt0aeenmrcoatopt auei;t s2tm(o io4al   fesas aDrm(r ;t1tpx  ieild s emnvp t) reoxrcio1omD  uvi;( tetr(o oydlltnlfei ()aDrm( ont0olenif3iyslmDua(ms;()trtrmf to1lpDe ieols) 2tmxo3oy4oleelfciat)sDrrxrooo1opxnmfeiytlaDumu snu4arxrmrctodoaDr n i ()s2uoxopny4lpt lnctlt)arrmurp;t1openmo3iatfa2eanvs u)teenmrcootomtrluvo (0t2urir iydalenlieias srrru  ;t4alx mfeiys m2eauvo t4tlenmr tytlpDranes;( seuoxopiodopee nci t)srtmxr ;o0tle mocilt s uln s;t0tltnxrciytfptr u il(0teumxr3iy1opeemfvia() Dtm(mpnt4olxniietytlmDran p ()tlermfciodomD aiei t0tetmxr nu4altemietas)aDrmxmo;t0tlenif3iyt mDua(ms;u4 eenio ia1fptr i s t0setoim iodll  mfviasf rtrumpou1tpt iietydla uaumsnt) leomr iydfmtr neilt0 2xrxr iy4oltemfctas)a2rm(mo;t4oeeo fciltlm rmnmp u0trxnmf3iatomtrau i;s tetmxo3ou1lptnmncils) 2rau p;t0tet  fctldfa2rmnmp;t0texnmo iotomtean i ( s2uo(r3iu4op   iesl(fa2ra(rpno0opeomictls aDelnvsn(4 ltoio3oatfaD  i s;()sexoxm iydlltemfei t a2rmumo;o1olx io3ilsfm2rlnmon()teenxrciotlaDrlneo;() 2xrir oo1aleelfvta()arrax  ;t4apenif3iydlsDrm( p t0aleniociotfa rlu ils0t2uo(rpiy4openmivil( srurum ;u0apx  icildlsDuauvsnu)aetomo oodoptr nvslt0t2xoxo3iu4lmenmnvtatfaDra( pot1tlt  feiydla2el( o (4tetoxocty1faDe ues () 2xm(rpou1oltelfetlt srrr(mono0aleoif3iat a2rauvo;u) lxomocoatfpDe ivs;( trum(opiydop nlfetls)sDumu o;o0olenmoeiad sDeanvonu4areoir tydomDe neolt0 rtmxm3oo4ap nmnci (faDrrx pno1tlt  f3ils a2rl(mo ()trxnxo3tytfp rli ol()s2tm(o3iu4opt lfctatf Drax p;o4aee moeiltla2umu p u4trtnmocoo1faD  ies ()t2xrio iu4op nmfctat  rtmu pnt1teto ieilsfm2ua(vs;t) eeomr3iodfm   nei;s srur(o iy1ameelnvt s  rtrxmpou4aeenmocild m2uau o t)alxoxf tadoatranvilt  rxmxm3ny1opeelivi ( aruaxr ;u4oet iieiasla rm(vp;(4trtoxr3tydfmt au s (0teur(r nu4omeemnesltf 2umx p;t1tex  fctyslaDea( pnt) rtnir3oytfat aies (0srur(m ny1alt lfeiat) rra(mo;t0ole mf3tys s umuvon()trxnirctatla rlueo () exrxr ny4ap  mncsl(fsrrr(rpnt1aetomfctld m2ua(vsnu4tltnxo iytfmDe uvils)seurxr oo1amt miei tf Dta(ro;u0ale io3ias m ua( on() exnxr3iatoa e nvo t trxrimpiu1amenlivtls)a2tmuro;t1tpen oeilt sDulnvp (4tltrmr oatfatr u s;()s2umxmpou1llee fvi sfa2rmurp;o0tetn ociadlaDul( p;u4aetoioctydfpDe
\ No newline at end of file
@@ -0,0 +1 @@
+nvo () etrio3nu4omenlnetat  ruaurp;o4oex  octytfaDean snu0 exnxr ty1oatr nvs;()trxmio ou1ame lfei sfs2rax pno0olt ii3iltla2ea(ms (4tetnxr3oa1lp rau slt  exrim oydam  lnes t aDta( p;o0alxomo3iys m2eaump () lxoio tadfaD  neslt teumxr3iy1al nmnvslt)aruax ooo4ope ioctad mDeauvo;t0artnxf to1lmD  u i;t)seurxm iodop   ictls sDtr(r ot4ole iieiltlmDemuvp;(0arxoxf oydlm eln sls0srtmio3oo4ale  iei s)s2ra(mp;t1tlen ictyt m2rlnms;u)tleoif3iodfa elneo (0 rurxm3nu4lmtnlies (fsDtr(mp;t1tlxo ietlsla ul(ms (4alxrircootfpDrlu i;s) exmim ou4lltn fcsas  Dtr( pno4olxoiicilt aDrm(ms u4arerif3iadfptr u s;s0tetmxr ou1lp n ieil(f rurxr ou1oee iocilsfa rmumo;u0tetnmr3tytom rlueilt trxo(m io4olen nvsl(fa2trum ;o4tltomfciatfaDum(ms (0 reoxr totopte ies;() eurxr3oo1altn fet t  Draur no4tpen feiltls2el(mp (4 rermf ty1opD li ol( seuoiopny4oltnmieta(fa2rmx  oo0aptomf3iadlmDra(vo u0 lxoio ia1lmte u slt)s2umirpou4lm  mfetl(fsrrr(mpnt0oexnioeilsfsDul(mp t0 ltnmfcoadom eaieo;s)setmim iu1omtemnvils  rtax pnu4altomociltfa rlumsnt0tleoio3io1fatr nvil(0sexoio3nodapenmfcsl( a2taxm ;o0opxo ieiydfs2em(msn(4artnxrcio1oatelnes;s) 2uoxopoudlpenlnet () Dtr(mono0aeto fciatlmDrluvpn(4tltnxrcoodopt an il(  rxmim iydap   feil( arrmxm nt0tpxomiciatla umnmont) rxomf iotfaDeanvol()tetoim3ou1llenmfci sfaDurum ;u4oetn o3iyd m ulu o;u0 etrmf3iydfmteaieil()sexoio iudlpe mnvta(fsrrrx oot4optomieild aDul(mp;t0aexrmocoa1fat  uei s)sexmio oy4ameemfvtat)sDumu p;u0texnmiciatlmDel(vo u0arenxo totfpDrauesl(0 2uoxrpiy4lptnlnetls)sDum(ro;u4aptn f3iasfmDuaums t4teenxocoa1fmD anvils)t2xo(o3iy4oltnmfciat) Dtaxrpno1tlt mictlslaDranvp u4altnxrcta1faDe nei;(0t2xrxr3nu4lp emfvsltf 2taxm no1tltnii3tysfsDum(mont4 rxnir oydfatr ues;t0 eurxo3nydomen fctas) 2tm(  ;u1ope mieilsfa rl( s t)alxomf3iadlpt livo t)t2tmir iy1ale lfesl()srurumoot1opxnio3iytla um( pnu0alerirciotfpDelnes;t)texm(o3ny4omee fetl()a2rm( p;u1tlenmfciaslsDrmuvp u) ltrmo todfp e iei;t0 rtrir iy4olte nesa()a2uaxroot4optomf3iysla2ra(mo;u4 rtoir ia1la e uvs t) exm(opnu4llee ivi sfs2rmxroou4ale moeiydfs2rm(ms;(0tetomf3oytfmDrau i t sexm(o iu1al n nctasf rraxmpno1tle mfciatfmDelnmpnu)trtoio oa1om e u i t0srtmxopnudalte nctlt)arrax pou4opeo ieilt aDua(vs u0texrmr iotfateau s;t)setmir3nu4omte nvt (faDtaxrp;o1oexo ociytls ua(vsnu4alxnxf todlaDr i ilt srxm(o3ny1om  lfcslt  2ta( pnt1tpenioctld aDemu p () ltrmfcoatfmt lnvo s trtrxo3ny1lp elnet ()srrru p;t4aeeo octadfsDrmnvont0aetomf3iatfaDelieol()teuo(mpnydoptemiesl(fsDuauroou4tex ii3ilt m2uaumo;(4alxrir oo1lmtrlivs;s trumxrpoo4ll nmiesatf 2rr(mpot0opeo iciasfa2eanmpnu0tlxnmocoatlm  anvi;(0 rxoim no1al elictl()arumx  ;u0opt if3iys mDemn s;u0aetrxrcoytlmDe n il(0t2um(rpiudal n nctls a2rrurooo1tptomiciydfsDua(vpnt4alxoif totoat ln olt s2urimpny1ap e fvs s)arum(mpnt4oex  f3iaslsDuanvs;u) eermr3oytlate ivs;s seurim nudomteliviltf 2rmum oo0aleo i3iltfaDul(msn(4tetoiocio1op  luei ()trur(o3oudale mictas  2um(rpoo0apxnmfeiasfaDeanvp;u4 exrmf tadlmDelies;() 2xo(o nu1lme mfeta() Drmx oot4alxn fctlsfs rmumo (4tltrxo iadlptr ues;s) exrio ny4llte ncil(  rrm(r ot4tlt mf3tltlsDrl(vs u4 rtniociadfmteli slt0 rurxo3oodolee iet (fsDur(m oo4apx  oeiysfsDeaump u0arxomo3iydlatean ol(  2toxrpno1llt  net s)a2tr(r ot0opx ii3iatfs em(vsn() ltnifctotoatelieo;t)sexoxm no1om n fct tfaDtax  nu4olenmiciltfaDrl( p;u4 reoxocia1lat  u i (0 2xoim oy4am emicia()s2tau pno4oeenmictytlsDumn p t0aeeoir3iydfmteau o s0setr(opoydamt  icil(  2uru o;u0olt  ieilslm2rmn o;t)trerircoytoa  aneo ()trur(rpiydlpenlfviasfa2ra(  ot4apxniicilt sDrmnmo u4 rxoxrciytop r uvo;s sexr(o3ny1ll   iesl(  Durxr nt4opeo ociad aDea(ms t4tleomocta1lmDe i s;(  2uo(o3oo4lpe mnvt ()a2ra( pnu0apx mieildlm uauvpn()tltoiocoodoa  aivsls0 2umxr3iy4llt mivias arrm(m nt1tetnmi3tydla ua(vont0tltrxr ia1oa eai o s) rxoimpnydol e nvil(faDuaxrpno4texn icildfaDrm(ms t0alermr oo1lp rliei;t trtrim no1omen netatfaDrru oot4optn fctlslmDumn pnu0 ltoxf iatfpteaueil(0t2uoio3ny4om e fct sfartrxmp;t4tlen ictasfm rmump t0trtomf tytfmt anvslt0trxrxr3iudapeemicslt)a2rrxr nt1tleoifcils mDulnms;(4aeenircoytlaD  nvslt0 2tm(r nodamenlfvi s  rurx ono4apt ii3iadlm2emums;t) ltrifctatfpD lneo;t) rxrir ou4op n nvs s s2rmx  ot4apenmiciyslaDraump t)tlxnio oa1fmDran o;s0t2xoiopoudlpee fetlt  rta(  nt4opxn fcilt a emums (0 ltrxocoo1oaDeaies;s0trxmxo ou1lm e fcsat sDrrxm ;u1opxoifciydlmDrmums;u)trtoirctydopteai il()trumio iydomteliesa( sDurumooo4tee  o3ilsfm2ulumpnu0 lxrxr iydfmt au s;(0 2xo(o oy1omen ivsls)arumxmp;o1apeoiieiaslmDeanvo t)aexnmf iadfmDrlnvs;()t2umxo iydll  mfei ()s2rmxrpoo1apxnmiciadls em( o t0 lxnifcto1fmD auvo s setr(opou4ap nlieilsf rta(m nu0tee iiciyt aDrlu p;u0texnmr totfpt  nvolt)srxm(o3no4omt lict ()s2trur nu0apxnio3iadfaDeau s;(4tltomfciatlpDrlneo t0sexoio3oo1olt mivsat)sruax pno1aptoioetldfs2uanvp t0teenxr tatfa rlneolt tetm(r3oo1altelnetl( aDta(r ou0tpt mfctytfa emu o () renmf3totla  auei;(0sruoiopiudamtnmics ()srrr( o;o4ale ii3iydfm eln p ()aexnio iotomte nvi s0texrxm3oy1lmte iesa() 2rmur ;o1olx iieiat m2ua( s;(0trenmoctatlaDraneil(0 2to(rpnydoltemnet t  2ra( pnu0apxnmfeilt sDum(ms;u0aleoioctydfatelu s s)t2trxm3nu4lm e ictatfsDrm( pnt1opto i3iyd m el( o;(0 exomfciotfm r uvolt0t2uoiopoodalt  nvtltf Dumurpnt1aptnif3ils s rluvp (4 eermo oy1fpt auei;s) 2uo(o3oo4apeemnctasfsDtm( p;u4tptnif3iltla rlnmp;u4tetrxo ty1lat ln slt sruoimpoo1ap  mncsat)arra(m no4oexniieiadlm eau o;(0 reoxocto1la r n o s srtoio iodopeemfeiat)artm(m nt1tee ifetat s2ulnvs;u0alenio3oa1optelnvo s srtoxr oudoptemivtatfaDum(rpnu0texniociasls2ra(vpnu)teerxf ootla ran s t)seuoio iodolen nctat arururpno0apxoioetlt m uau pn() lxrif totlpteln ols teumiopiy4al  lictasfaDta(  oo4apeoifeilt s2ua(mpn(0aetrxr3oadom r ivo s)sexo(m3iodol nmnvta()s2uaxrono1aeenmf3tytfs2rmumo;(4 etrxrciy1la elneo t)srtoxo nodale mfvs sfa2tau pot4aetoiieild m2uanvpnt)artnif3oytoaD lueilt)t2xmxrpou4lptnmietl( arrax ooo4aeeo i3ias mDuln onu0tltnmf io1omte u olt0s2trir3iodaptnmici s s2rm(rp;u1tptn fciltfsDuan pnu0arxrmo3iadfmte uvils0texmxm ou1oleelfei t a2rr(mo;o4teeoifciyslaDra( s (0 rtrxr3io1fpteaneo s0setm(r io4ll nmnvtlt s2rrurp;u1tlxn i3iadlm rmu o u0 reoifcta1la  anvols0seuoxm3iu1lptnmneiat  rrm(  nt0aeeoioeild m2ea(vo;()alerxfcia1oaDelu il(0 rxoxm nudol elici (f rtax  oo0optomiciydlsDel( onu4artnio3iy1op elieo t0texmir iu1omte nvi s sDtmuronu0oee ifetls a ua(vpnu)trxrifcootoa r uvo t0 rurxr ny1amte ietatfsDtmu pno0aptn i3iltls um(ms;t)tlermf3oodoatr i slt) rtmxo3io4om emfvtatfsDta(m ou4tptoiociat s emu p;u4trenio ia1fa eln il( texo(rpnudap elieia( s2ta(mooo1alenmf3iltls2um(mo u4texnxr3oydfm  auvi s tetoiopno1olee nvs ()artrur ;t0oex iieilslm2elums (4 lermo3iydlpD au i (0tetmim nodamt mnvil(  Durxmp;u4tetomoetydlaDelnmont0texomoctatopt  uei s0srtm(r3nodome  fcslt a2tmu ono0tpeo o3ilsfsDra(vonu4 eeomo iydlp r i s s0s2um(r3iydam  lncsat aDrrxr nt1olto feilt aDrmn p u0 ltrmocoa1opDelnvi t) ruoio3oudamtnlicils sruax o;u4tpxomfeiytfa uanvo t4 rermf todfmDrai sls srur(m3nydol  mfesa( sDrmxmp;u4tle moeildfmDelumsnu0trenif tydlptrai i;(0truoxrpoydlmenmiviatf 2ur(mpoo4tptoiietatfs ranvo;()teeomfcoa1oaDelnesls0seuoxr3nudlm elici s)sDta(m ;o1tee mi3ias sDeanvs u) rtrxrcia1lpDeaivs ()s2urxm3oo4ame  iet s arraxr ;o1tpxn feiydfm ra( snt)trerxo iadla r ivo;t seum(r oo1lpe lnet s aDrax  nt4aexnmf3iat aDemumo;u) rtrmfcoydomD  nes (0 2uoirpiu4am   ivt t) Drmumpnu1aeenmieiadlmDum( s t)tlermr iytlmte uvs;() rtmxm3iydome  neta(f 2tru  ;o1tee mietls s ea(mp;t0teenxocoytom  au i (0 rxrxrpou4omen nci tf 2uaxm ot0openii3iltfa ua(vp t0arxnmf3tydfaDe nei s srxmxr ny4opee nct s) rrrx o;o4opt ioeiadfm2eaump;t0 etoxf iydfpD lneo;() 2xrir nu1oltnlfet (f Dumuroot0optnmo3tysfa2umuvo;()aleoif oadfm rluvil() rurio3oo1op elfetatfa2rrxrp;o1tpx mfetyslm2uauvpnu0 rermocoy1latelu o s t2to(m3iudomt livi ( s2rmxrpoo1olto fetysls2ea( snu)teerir3todfaDeau i t)t2xmxr3nodll   nesls)sDtaxrpnt0tpt ifciys s2em(vs u4aetomr oadlmtrlneolt0srumxo3oy1lpe lictl() rtax o;u4apxomfctysla rmnmp;t)artrmr3to1om   ues ()t2tm(m nydomtelnctl(fsrtr(  nt4alxnmoeilslmDrlums;t0aetniocoydfptranvi s t2xmxo oo4ap elnetat)a2uax p;u0oleniietasfa ean sn()aeeoxr oadfateluei s)srxo(opnodoltn ici t) rrrx pou1olxoiicils a rmnms;u0aeerxr3iadlp ean ol(0truoir ny1lle  ivil(fa2tru onu4altn ociysla2eluvo;(0 ltomfcoydop eluvslt)tetoxo3ou1ll  mnciltf Dumu p;t1tpen i3ilt m ea(vonu0teermr to1oateln i (0 rtmio iydoltn ivi (f Durump;t4aleoioetlsfa em(vpnt4arxnxf3to1optrluvil( s2ur(o ny4ap  lnvsltf rrr(moot0oetnmiciatla2em(mo (0 renmfcia1omt luvi;t  exoxopiydlle  fei s aDrru oou1tptn i3iydfm2rmn s;u4tetrmr iotop  an ol( tetoir nodomt mictatfaDumum ;o1aex io3iydfsDemnvp;(0 rxoxf tytomDrai o s)tetr(o nudll n iciat) 2ta( p;o4tpxomfctadlm2rlu snu0alxnif iy1fmteli i;t)t2ur(r io4lptn ieslsfarrmumono4teeoii3iad s rmnvp u4 etnio3iotom   n il(0srumim iydll emicils) Dumxr ;o4tpx mieiysfm2uauvp;u)arxomrcoytfp ran o;()texmxo3nu4altnmnct t arrmur nu1tptomo3ildfm2ul(vp t0artomoctydop e i i t trtoxm3iy4opte iet (f rum(r ;t4opxomoeiydfmDra(vpnu4tltrxf3iytla  li s;(0t2trio no4om emivtas) Drm(  ;t1alenifetldls umu o u)tlerxr3iadfmteauesls sruoxr ny4ol  mfesasf Duax  oo1tleoiieildfm2eaumo u0trtrircootop  lueo t0 2xmir oudamen fetls)a2tmxmpnu1oeeoiictls s2ulnmp;u)artnmo oatfaD au slt) rtmxr3oy4omtnmfci s) Dtax pot4aptoiociat m umuvp () rtrmo3oydom rau sl()s2xmxopiodlp   ncs t arrau oou0tlt io3iatlm2uanmp;u)artoir3tadfpteauvi ()setm(o3ou4lm  lfci ( arur( p;u1tpxniieiydla2emnvpnt0aexnmfctydlpD livi;s s2urim no4lmteliesl(  Drrur ;u4texo fciltfa rauvp u4 rtoxo oatfmteaueo;( s2xoim3ny4altn ici t)s2trx ont0ole mfctyt m uaumon(0 etnmr oadlatrliei;( t2xmxr3iu4lpeelfctas) 2rrx ooo1texoio3iysfm2rlu onu) rtrxf3to1laDeli ilt0 2trirpoudole mfcsat aDum(ronu1oex  fcilsla rln onu0teerir iodoa eaivi t srxo(m ny4om emieil() Dtmumpou4alxoiociytfa2umnmpn(0 rtnir tadfateaies;( s2tmxo oudop n fei sfaDrru  ot4tlxnio3iatfm emu s;t)artnio to1omt  uvil(  2uriopiydamtnmfeta( a2uax  ;t4alxnmietls aDranvp;()arxoxrcoytlmteai i t)setmim nu1lpe lnctas) 2taxro;t4tlt  f3iyd m ulumsn(4tetrxr3iytopDr i o;() 2toio3oy1omeelncils)sDur(r ou1alxo f3tasls2ulump u4 lxoxo iydlatrlu s;( s2tr(m iy4lm  lfes s arrmx  ;u0alx  i3iat m2ea( o;t0 eeomo oatfa eauvsls)t2toimpnudomee nct (f rtr( p;u0oleo i3tadlaDra(vs;u)altnmo oodomDraneols truoim3no4apte fci ( aDua( ooo1ape ifetltfa2el( p u0 reomo ta1oat lues (0trxo(r3iu4llte nes sfarrm(mpnt1olx ii3iat aDranvp;u) lenxr3iotoa rai o;( srxmxrpio4omenlieil(farumx  nu1tltoiiciydfs ul(mpn()areoir3tadfp rau i t)srurxrpiodolenlici sf 2rrur ;u0oleomfciltfmDeau s;(0tetnmr3oa1optean o;t trxm(r nu1ll  livsa()sDtrxr ;t0aee mfcilsfm2rlnvo;() eenxo io1op  auvi t) 2uoim oo1om e ivt ( s2tau ooo4apx  o3iydlm2elumont4alxnxrcoydoaD  ivilt tetrxm iu4omtn icsls srtau  no0olx  o3iysfa2em( pn(4arerirciytfm eaueo t0sexm(m oodale lnetat) Durxmpno0optniocils s rmnmp ()aeeoxrctotlmD lieil( sexrim3nudamtn ivsa( a2ua(mpou4opxoiiciys sDulnmo (0aexrmocoydfmDr ueslt) 2umxm3iu1am n nvtatfaDum(r ;o1apt iieilt m2rmn p;u) lenifciotoa  aueils0teur(o3io1lpt  ics s aDra(r ;u0apeo ietldfm2uluvsn() exrif3iadomt  i i;( seur(m oydlpe mfvt tfartr(ront1tpx moctatfaDrmu p u)tlerxo3oadfmD aivs (  ruoxr3nu4oleemnctlt arumurpnt4aleoiociyd s2elu snt)arxrxr iodfaDr i s;(0seur(r io4olt mfvslt)sDrr(mono4teenifciydlm2ulnvs u)alxnmf ootoaDelies;s)texmir oodoltemnvi ( arumx  nt1tlto i3iasls uln o;u) lerxo iadlpDelues;(  rtrxrpoo4ll n fcilsfs2rrxroou1aexoioctyt m el(mpnt)texomfcio1oaD liei () etr(o nydal nlfcsl()srumx pnt1openioetytfaDua(vsnt)tetoif ty1oaD  u i ()srto(o no1om nlfcia(  rtr(moou1opt moeiad s emums;()aeenmoctadfp e i o ()sexr(m3ou4lmt mncslt) Drruro;u0aexo octld s ua(vo;u)alenxfctodfmteli o t0teurxo3oy4lpt mfeil()aDtmumpnu1alx ioctldfm2rlnms;()tlxoxf3ta1lmDranvslt  2xrim ou4al emfei (fs2tmumonu0oeen ieiydfmDrau pnu0 lxoir3oytlaDean s t tetmxr3no4am nmietat aDtrx pno1tlx mo3iytfm2rln o;(4artnif3ty1lp rau s t)setoxr nu4ole lfcta(fsDumxm nu1apxnmoeiydla ea( o;u0trxoxf3tatfmD anes ()t2toio3nudomen ietls srrau pno0aptnmi3tatls eaumo ()aeeomf3totfm   ivi t)s2xo(rpnu1apt mieiatfaDurumooo0tptn i3tatlm elnvs;(0aeenxo3tatlp  aieo;(0tetoxm oodlpt  ivias  2trum nu4oltoioeiyd a ra( onu0 lxnifciatfp r ies;( srxmimpoo4ome lnvsl( sDuaxrp;o0tlx mfcils sDean p;t)aetrirctydomD livs;s0 2umxrpno1omee feil(  rrr( pou4apen o3ilt aDrmn p;t)tlerxfcta1opDeai il()seurio3iu1omeemfesasfaruaxrono1aptomfciyslmDrm(vp;u)alxomfctotop r i
\ No newline at end of file
@@ -0,0 +1 @@
+neslt)seuo(mpoydom emiesatfaDtaumpno1alxnmo3iltls ulnvonu4aeermr3oo1opteanvs;t) etmxr iodllt  iei (f rrmumono1olxnmf3ias s ua(vs u)tltoxrcty1lpD ln i (  rxmir oo4amee ictasf Dumu p;t1aleomoeiadla rlu s;(4 etrxr3totoa eaies;(0trxrxr nodopte nvtlt arurx ont0oleomo3iys m ea( on(4 rxrxf3oa1opDrluvs (  exrxrpou1oltnlncsl() Dururo;o4tee ioetytls2uanvs;t0trxomf3oytlpDrlivslt t2toxr oudopenlfvias  Durumpnu1oltn f3tat aDum(von(0altrmo3iotoat  nvols0 rur(opio1ol emnct s aDrrurpnu1oleomociydlm ra( p t0tlxrxrcootfpte ueo;t trum(m3oy4amee fvil( sDta(  ;o1oeeoiicild a ulumpnt)alermf oodlaDe n s (  rtmirpnodap elfei s  ruru o;o1oltnmfetatfaDuan p u) etomr3iy1omDeai o s0srxr(mpny1llee fcils sDtmu ono0apeo ociyd sDulnvp;t4aexrxf3ty1lp rau sl()s2xmxrpny4om nlictas) 2uaumo;t1olx miciatfsDra( pnu4tlxomo oodom  livs (0sexmxmpoydap nmiesa(fartm(r no1ale  ietys m rauvs u4aexoio3todlpt  uvi t seurir3nu1lltnmicias) ruax  ;t0alxn i3ildfa2rlnms t0aeeoif iytfatelneilt)texr(r oudop nlfctlsfsruru  ;t1tleoii3tadfa emuvs t)aleoxrciotfpDeau i () 2xmxrpoudaptelnvsa()srrrx ooo4apxomoeiatfm2ulnvsn() leniocio1fptr u olt setrxo oo4lleemfciat)a2ur(m no1oee  ieiys aDemuvp;()teerxfcto1lpD auvils)t2umir3ou4lle  nes (fsrumuronu0alx mociatfsDrlums;t0trtrxocoatfp e ueo s)trxoxmpny1amenlfetasfa2trum ;o4olx ioetydlaDulnvp;t)teermo ty1fptr uvi s  rtmxo3iu1lpt  ivtls) Dta(  nu0tleo fctlslaDum(ms;()arxrmo tytfa  ai i s0 etmir iy1lmen nes t srrr(moou1alenmi3tltlmDumnvp;(0 reoiocoa1oaDe i i s srumxm ou4lme mfcsas)s2rrurp;t1alx if3iadlm2rmnmsn(4 etoif io1fmtr n i ()teuoxr oodlpte fvslt sDua(mo;u0tee ifciad mDrmnmonu4tetomf3ia1fmtr ies ( tetrim3ny4opeelfcilt  Dtmumonu4apenmietysfs ul( on(0tlermr ootopD ai o s trtoxm oy1om e ics ( artax pno4aex mietadfmDemu p u)tlxniocoadlatran s;s0t2um(o nudole mnvs t aDum(mpoo4oeeo ieilt s2elnvs t4alxrir3tadlat luvi;t) rtr(o3iy1ol e fcsltf Drmx ooo1apeoifeiytfm emu o;t4teermo oatfmD  uvo;s)srxoxr3iy1llt mfci ( sruru  ;t1optniociltfmDrm(msnu) eerif tadla e nvslt)tetoxmpio1omt mfcs s aDrmxrpot4opeomfetltlm2uan pnu0aeerxociadfmDeaieols) 2toxopou4lltemfcs ()srta(rp;t0alxoifetatlm emnmp u) rxoif3iadfa rai s;() 2tmxrpnudomen nct s s2rr(mpnt0tlenifetasfm2rmuvpnu4trermo3todlm raieo;t0srtrir3oudllen feilsfsruaxm ot1olto f3iasls2elnvs () ltrmr3iytfateau slt t2umim3io1ll nmfvta()s2rrumoot1apt ioetys m uauvsnt0trenxo3iatla rli i ( t2um(o nu1ol nmfcs sfsrraur no4openmo3tydlsDum(vo (4 exnmo ootfpteanvi t) rtmir3nudol nmnetls  rrax ooo1apt iiciyd mDrmnms;t4 exomo3ty1lmDr u i t) rumio nydop nmivtlsfa2rr(m oo4ape  fctydfaDea(vs;t) lenifctadoptraieils) 2trirpio4llen nesatfsDtmx  nt4tpeoioeiadlsDrlnmp t) lenxf3oa1omtr neo t0t2xoxmpny1lmte ivi ()artru  ;u0oltoio3iat aDem(msnu0aetrif3ootfp rli sl(0s2umxmpiy1ap n net ()s2tm(  ;t4tpt  i3iys aDelu p t0 leriociatomtranei ()trurio3oodlmen ietl()aDrr(mpou0tptnmfeiatfs rmnvo;t)alenif3iytfp e neolt0 exmxo3iy1ol nmfes t)s2rmxmpoo1tpto ocild m2rlnvp;(4tlerxr oatlm eaueolt sexm(o3iydlm  mies t  2raurpou0aeeo o3iatlmDranvsnt4artrmf tytfp  an o;s srxrxmpoy4apte fetls sDua(r nt4olx  oeiyt a2em( s;u0areoif3tydfmDrlnvs;t trxm(rpiu1lp emivs t)aDua( oou0opt mfeiasfm2eanvs;u4 exomf oo1fmDe uvilt0t2xoxo3nodalee ncsa(fa2ra(mo;o0ape mfetld s el(ms (4 lxomo3to1fateaneo;s0sexo(r oydamee ncilt)artr(mp;o1ope  ietlsla ua(mo () exomo3oadfat luvo;t  exmio oy1lm n feil( srrmur oo0ope  ieilt mDulnvp;u) reoxf3ta1lp e n o s0 eumio3iy1am nmncsltf rta(ro;o1tpxnif3tas a ulump;u0tetoio iatopt  neilt t2trir oydal  mfvsas aruru oou1aptn ieiatls uauvp;() eermr oydlmtelivo;s trtr(opnodop emfvsa(fs2rmxrp;u1oeenmictldfa2umnmp;u)altoxr3iodlmDraivils0 rurir nydol  mfesasf 2tru  ;u0aexn oeiytlsDrlnmpnt)aeerircta1oa e nei (0trxm(opnodopenlnet ( a2tmu  ;t1olxn fctas m2ea(vo;u0altnmocoatoptr u i;s texm(rpou4amtnmnciatf Dtrx pno0tpx mi3ilslm umuvont0arxrmf ta1fm rauei;t)s2xm(rpoudlltnlfvi ( sDtr(mo;u1tpenifcilt sDemn s;t4trxrir iydfpD lnvi;() 2umxr3iy4lpee net ()srtr(rpno4olt  f3ildla eluvs;t0 ltnirctydlaD  ues t setrxm3io1ol  mfcsls)srrr(rono4oetnmi3iatlm uan o t0aexnmf iotlaDeauvi;t  ruo(opoy1lme mnesa()srrmxmo;t4texoii3ias a rmnmpnt0artnmo iatoptr n o;t teum(r ny4am   nvsas srrmx  nt1aleoii3ias mDemu s t0trtrmf3tadlat li o t)t2triopiydlmtnlneil(fsrua(rpou4oetn feiasfm ul(vp () ltomr3oy1oatrln ils0tetmio iy1lm  lfeils)srrr(m no1tpxo iciaslm2uaumo (0arxrif3tydlp  lnvs;(0srxrxrpnu4amtnlnvsl(fs2rmxrpou4oexoiictydlaDeluvo t0texnxr3io1om rli ilt0 rxoxopno1opt  nvtls srrmu ono1ole  f3iatfs2ua(vs;u4trxomf tatlmDrlivs (0srumxm3nodamt  nctls aDrrurpno4opx ioeiatfs eaumpnt)teeomr oy1opte neo (0 rtr(r oy4lp nlnvsas)s2rax  ou1oee  i3iltfm rlnmont0tlermo3iodlp  anvs s0 etr(m3nydlpt  fei s)a2ur(  ;o4alen ieiadls elnms;t0aetniocty1oa  lies t  2uo(r iodap nlfeia(farrm(  oo1tpx mfetad mDrmu p;()artrmo ta1fmtrliesls0setmir3iy1lmeemivsat)artmxr ;o1tpt mfctydfm2ulump;u4 reoir3ootlmtr nei;(0trxm(rpiy1alee nvi t) rtaxmoou1texniieiyt m2rlu o;(4tetoircto1opDeanvs;t)teum(rpoudam  lncs ()aDuaumono1alxomf3iad s rm(vs t) lxoxfctadlpD au ols0 2ur(m3nu1optnlneils sDtru oou0aex iocias sDelump;t) eenxf3ta1lmD lnvs t)sexoir oodlm n ncsl(f 2taxm nu0opto feildlmDrm(mpnu) eerio oy1faDrlieslt trtoim io4lme mfvsl(f 2ta(rpno4aeenmictat s2el(mon(4altoifcia1lmDr nvs (0sexm(o3ny4ll  lnvil(f Dtr(  ot4aex moetls aDemn p;t4 eenif iotlpt aivo;s0tetoio no4oleemictatfaDta( ont0olt  ocilt sDem(mp ()trtomo3to1omtrln s;(0srumio3oudop nmnetat sDua(rpno4alxnifciltfs rauvsn(4 lxrxf iotlpt  ieil()srtmxr ou4lltemfvt tfs2tmxrp;u1tlx  ieiltlmDelnmp (0 eeomocto1lmDr u ils0tetoio nu4olee nctasfaDtr(m ;o0olxomo3iyt mDemn o;u0alenxoctatfmDr u o (0sruo(r oy1am emneia( s2ua(r ;u4opxo fciasfa2ran o () rxrxrctytlm eanei;s  etoio3iydoltnlfcilt  2rrxm no4tlxnmociat a2uanvs u)alxnifctodoaDrlueil(0seto(o nodope licta( arrrx  ou1tpt  ietltls ul(vsn(4tlenxfciadfp  luvil()trtrxopnudll   iei t  Drrxrpot0tlto fctld s2rl(ms;u0aexnmo tydlmD  uei;t)teuoimpiodamt lfvtlt) 2uax  ;t0tet  ietytfmDel(ms u4arxomr3iydom r nvi;t) rtrim3oy1aleemiet s)arrr( pnu1tptnif3iysfa2rauvp;t4alxrmr3tytlpD  uvi;s0tetrxopnu4ol n netas) rtaxm ou1opxomi3iydfm2eanvo;()altrmr iadlate ueo (0texoxm oy1omt  feil(faDraxrp;u4opt mfeiytls uanms u0aexnmr tatlp  livo;(0t2xoxrpio1lmeelfvt (f Dur(m nu0oleomo3tyt m2ul(ms;(4trxoif3totom r ivsls srxm(mpiy4amt lfci sf rtmu p;t4aetn i3ild aDeanms;() exrxfcta1lp eau o;t  etrir3ou1amen fetat  2trxr oo4ape ifcild m2rl(vs;u0trenxr3oodoa r uesl()s2xmir3nydamenlfetl()aruaxmooo4opt  o3tyd m ra(vonu0altoirciadlm  anvo t srtoxr no1omte fetas artrxro;t0optnioeiltls2emuvs;u0 rtrxf3tadfatr u sl(0teuoir iudlme livslt)artr( pno0tltoifeilsfaDranvp t)tlxnxr oa1fm  lueslt)t2xoxm3oudole livi s)s2rr(mpot0tlxnii3ild s ea(ms;(0 renmf3iydfp  auvols srxmim3io1op elietls artmu oot1tlt iieiatfsDrmu s;(4 rtrircto1fmDe i i;t sexoxm ou4ame mfvi ( srtru o;o1olen f3iydfs um(ms u)aeenif oy1lat  ies;t0 rtoxrpnu4aptnmiesa( aDrau oou0aex mo3tyt m rl(mpnu4artnxr totlmD aivi;t) 2tmxmpno1lm emict s artmxmo;u4oexomociasfa eaums;u)texoxocoatopDeai olt) exmxo nodopt micsl(  2rax  ou4tee  i3iat a eauvp;u)altrif3iatoa eaues;()trxr(m3ny1omtemieilsfaDrau pou1apeoiietlsfs rluvs;()teenxf3iodlat  ivilt teuoio nodom n ivta(  rraum nu4apxnmoeiysfa ua(monu0tltnmrctodlp eai o;t0 exoir iu4llt  nvi tfa2tmuro;t1ope iieiatls uanms;u4 etrxr iadomDr n i t) rtr(rpio4om nmicsl(f Dta(  ou1tltoio3ils aDul(ms t)aetrxo ty1fmteaneol(0s2um(mpiu4lmtelnvtasfaDtaurpno0alx mi3iatlm2ea( o u0artrmo3oytfmDe u ils  2trir iu4om n nvtl( sruau  ot4tpx io3iadfaDumnmsnu4 eeoircta1lm raiei;s) 2trimpoy4op nmfeils) rur(mpoo4aee mf3tltls2emnmpnu0texnmfciadopD  uvilt0trxmxr3nodomtnmfcta(  Durumoou0tltoiieiys sDra(mo (0aexnxf3iotomtrai s s)t2xm(m3oy1optnmfvia()a2truroot1olto o3ias s rln s u)texnmfcoydlpD  i sls)tetmxo iu1am   fcsa() rtrxro;t0alenifeiat a um( o;u0artrifcoadlptrlivi s s2xr(mpnydomeemnviat aDurxr ot4teto ictlt m ul( snu) renio oo1oaD  n s s0 2tm(o io1am  livt t  Dua(ro;u0tle iociad sDumn o u4tlxomo to1lpD anei s  2urim ny4llenmnetltfsrrrxr oo4alx  fciyslmDuanms;(4altriociadlatrau o;s0 2to(opoydll nlnvi ()sDur( pnt4alx  fcilt m ulnvpnu0tetrir oa1laDraneslt0 rumxrpny4om   iciasf 2rm( poo0texoii3iys s2rmumpn(0aeenmf3ootlaDrli i s0trum(o nu4llee nvs s s2rm( poo1aptomf3tldlm el(vo ()trxoio iytfmtrluvils)s2urio iudlmt  iesa()s2tmx  ;u1oee mieild s ua(mp;t0trxrxr3iytlat  uvi;( s2trxo3iudlpeemfvt sfa2rrxmoot1oexoiieiltls emn pnt4trtnmr iotfat  neo ( sexmxo nu4lmtnmnvs s  2uaxr ;o1aet miciad a2ra(vp u)arxrmf3iatop eau s;s t2um(mpnu4apt mfci (faDrax ooo4alx mf3tltla umnvon(4 eeoifcio1om  anei t)teuo(r no1ol e ics sfa2ua(ro;o1oeto feiyd m uaums;u0tlermrcto1op eli i ()t2xrir3iydamteliei ()arrrxmpnu1alto ieiadfm emn sn(4 rerio totlat luvo (  eumim iudalte ictas  rur(mo;u0ole mi3tlsls2ea(mo;u4 reoif oa1faDeanesl()tetoio iu1ole mncs tfsDumx  ;o4olxniociatfa2ean o;u0 etoxo oydoa r neo s teurir3oy4am elfcs ( artaxmp;t0texomoeiasfa umuvo;t0aexnxo totla eaueolt)t2ur(r ny4lpte icslsfartau  ;u1optomiciltfmDraums;(0aexrmfctodlmtrau o;s texrio3iy4omenlieia()a2umuroot0tpxoiiciytfmDemums;() exrxociodlp eln i t)trum(rpiu1lp   ict t sruaump;t4aex ifetltfm2umnvp t0arxoxf3to1lat lnvo t0s2um(mpnudlptelnvsat  rrmx ono1oexn fciadlm2umuvsnt)treoxr3iatfaDeluvo;s t2xoio nu1aptemfcilsfs2tru  nt1aeto icias m ranvpn(4tetnxf3tydoa elneils0t2to(opoodaptn ncs ( a2rmxmonu0tptnmfeiat m umu snt)arxrmfcoadfm r u o;() 2umxr3ny4llt mietat)aDuax o;u1ole  ocilt a el( o;()tltomrctotfmDrlu s;s)s2xmxm iydlpt lfct tfa2uaxrpoo0aexnio3iytlsDrmn s;(0 rxnmo3oy1oaDe u i t0s2xoim3iy1opt mies s)s2umx  ot1aex moeiys s2ulu snt4artnio3iotfmDe n sl(0tetm(m3oodlmte ivtat  2rmxro;o1tlxnmieildfs um(vont) renxrcootoaD  uvs t)teuoxopou1om nmfesltfarrm(mp;u0aptnmo3iytfm2ul(vs t0aexoxo3oytlmt aivo;t)teur(rpoodlpe mictltf Dtmuroot4altoiociytfm2uaump;u4areriocoo1oaD lies;t  rtr(mpny4om n iviatfa2umurono0aexniociyd m rm( s u0treoxfctytlat lnvo;t)texmxopnu1apt lncsl( arrrxmpou0teeomf3iatfaDulnmo u4altnmfctotom e neslt0 2umirpio4ap emfeil(fsDtmuroot0oex if3tytls rm(ms;(4 leomrctodfmte n s t) rurxr io1llenmnvslt)s2uaumooo0tex mo3tasfm rau p u4tetoif iytfm eaneslt  rto(opoudlp  mfcs ()s2uru pot4tptn ociytfmDum(vp t)tltrmo3ia1oat  u ol()texoim iodllenlncsa( arrmumpnt0aptnif3iys m rmump t)aeenxrciytfmtr i s t s2xmim3no4ap   ivil() 2rr(  nt4tet  ictas s um(mo t0tltomr iodlpD  iesls0teurim3iu4lmt mict tf Drmx pno1tpt  oeiyd m em(ms;(0arenmr3oy1fmt aiei t) rtrirpou4openlnesl(fsDrmur ;t1olenifetatfm eanmo;t0tlenxr ty1lpt lnes;t srxoxm3iudopt  fei tfsrtrxrooo4tex ioctlslsDumnvsnu4tleniociodfate nesls)s2toxo ny4omt lfcsltfsrtax  ;u0tlt ioeildfm raump;t4trerxocoa1fmD  ieilt0 2urxr iu4op   fet ()sDrm( pnu0altoiiciad aDuanvo;(0 lxoir ootfm elnes;s)truoiopio4ome liesa(fa2rmx pnt1tlx  i3ildla2elu o u0treoifctadomte nvsls0 etrirpno4lle  fei (  rtrxrpnu1optomocildlm2elnvo;t4artomoctydlmte nvsls) 2toxopoudom  lietat) ruau o;o0apeoioctld s2rln p (4artomo ty1oaDeau i t) euoirpiodlptelnci ( srrm(rpou4opeomfeiys s rl(msnu0 ltrio ty1lat  i s s0teurxo3ou1op nmnvt (f Durxro;o1olxnmoeildls2ea( pnt)artoif3oo1fm eanei s0 2trio oudlptemfctltf 2um(r ;o4opxoifciaslmDulnmo;u0aetrxfcoydlptelues t)s2uo(r3oydame lfcilt) 2taumonu1olto icildls ul(vp u4 exoxo iydop  luvils0 etrir iudlp elfctlt) rrr(mp;u0oetn fcilt m ranvs;u0alenmr3iy1opt li sl(0trtoiopoo4alee ivils  Dtrxrp;u0ole moctldfs uan o;()teeomr io1fpD aneo t srtmio iodamt lfei tfsDra( o;u4aet moeiltfsDea(ms t)trtoxr3tatomt lu s;s)srum(r ou1am nmfctl()a2rru p;u1tpxn f3tatla ranvp t)arerio3ta1opt aivi;t s2xrxmpiy1olte fesat a2um(mo;t4opxnmfetatfmDrm(mo;(4aexrif3to1lpt lneilt  ruo(m oodom emfvi t) 2uaurooo1aee  iciltls2umnvs u0arxrxo3oydom rlu i (  exo(mpny1ol elnvia()sDrrxm no0teeniociyt s em(mp;u)tltnxr oytfp  lnvi;t) etmim3no4ap e fcta()s2rrum ot1oee miciytla ean ont)areoif3io1fpD luvolt)t2uoirpno1om  lnetlt)artmu p;t1aeenii3iatlmDua(ms;u4altrxo oydlp e ueols  rtoirpiy4ol eliciat)sDrm(rooo0tpx  oeiydla rmn o;t4aexoio oo1lateliei;s  eumir3no4lmeelfetatfs2umx oou0aetnmocilsls2rmnms;(4tetrmo3oydlp raivi;t srurxr ny1lp nlnctl(fsDtmx  no4oltnifetasls2rau s (0aetoioctadoaDeauvs ( texrirpoy1am n nviat arrru p;t4teeoii3tlsfmDrlnms;(4 leoifcoodopDe nesl( sexo(opiu4opeemfci (fa2rr(mpnt4opxn icilsla2ea( pnt4 ltoxf oydfpteli o;s)srtoim nydopee fvsa()artau p;o1apxn ociysfs2umuvs;u)tlxnmr3ta1lpt  uvo t)srur(r3iy1lpe lnei sf Dtmu pnt0olen oeiysfsDem(mpnt) rtrxr tadlaDelnvolt0srtm(opnudopee ieiat  2taxr nt0apenmoetltla2elnvo ()tltrxo tadomtran ols0texmxrpnodopenlictat)sDumxmo;t1tpt mf3ildfsDelu ont)altrioctytlaDeaneo ( t2toxm nu1ape lfvtatfsDtau oot0oexo fctldlmDul(ms;(0 lerio oytoaD li il()texoim iydomen fvtltfsrrmx pnt1aeeomoetas a ua(mpnu) etnxo iytlp   i sls0 rtoirpio1ale  fcs tfsrtm(mpnt0tleoiicild a2ea(ms t)tetrmo ia1fp eanvi s  rtr(r3iy4llen nvil() 2rrumonu0optnioeild mDuan o;(0 reriociodomt li i;t tetrio nudop e ivtat)s2tax oou0ale moetyd a2rl( pnt4artnxo oatoatranvi;( s2umxm oo4alt micia( s2trx  oo1tptniictadfs eaumo (4 eenifciotfaDelivs t)seurxo nudopt  net s) Dtrxmpnt0apeo fetldfaDrluvo;(4texrir3totfmtranvs ( t2tmxmpny1lmenlnctl( arumxmp;u1tpenio3ias a2eanmo;()aeenmf ootomt  nei (0 2uoxm3iu1llt livsl( sDraxr ot4apx mietydls rl(von(4 lxoxo3oo1om e ueils texr(o oy4openmfes s aDtaurpnu4ole mo3iltfa ra(ms;(0aexrmo3ta1faDe u s (0 etrim oodop n ivilt) Dum(r oo1tlxo icilsls uaumo u)tlxnmrciadoptrlu i t0srxrxrpnydomenlfcs (f rtrx  oo4alt mi3iadls2elnvs;t4 etnmr3iy1oat auvi s truoio oy4lm e netatfsrtrxmpnu1oee  fciyd m ul( onu0tlerxoctotfaD anvsls0 etoxm oydoltelnesasf Dtmu oou0apx ii3tys a2rl(msnt4aexoio oo1oaDr nes (0 ruoir nu4amt  ieiat sDtr(rp;o1opxnmf3tydlm eanvs;(0tetoif oytlpt  uesls  2tr(o oudomen icta() 2umxm ou1tpx if3iysfm umu s;(0teeoxr3tydlaDr i o t srtrxmpnydoltn ieils a2tmx ono0aeeo ieiatfm2uau snt0 lenir iytfa  aivo;(0teuo(rpoo1am  lieta(fsrur(mo;t0tleomo3iltfs el(mo t4aeerir3ta1fa  lu o;s) rum(r3io1ame lnet tfa2rm(m ;t0aeen ietytla umu o t0aeenirciotlmDr uvs ()srur(mpnydam  lnct t  Dua(  ;o4oetoii3ils m emn pnu4aetnmo oadlpt auvi t  etoirpnu4al e nvils) rrau pnu4tee  ictysls um( p u4texrif iy1omD ai i;()setoim3iy4ol nmivi (fa2trxm ;o0opt  oetas a2uaumpn(4aexrxf3ia1fp  aneolt  2toxo3ny1lp elivta() 2raur ou1altoiietasfaDuau p t0trxrxr3iy1laDr u olt0texrim3iy1ol e fvsas)arta(rp;o1oexnio3iltls2raumpnu)tetomo3tydfpt lu olt0 2uo(r iydlmtemfvslsf 2raxmp;u1aeeniociatfsDrmn snu0tlxrmrciytoat lnvs;() 2urxr3iu1apeemictlsf Durx pnt0olxnmi3tadla2rl( s t)tleomo ty1om rauvi;()t2xoir3iy4al nmfvi t  2rr(r oo1tlxomfeildfs2eau s;t) rtomo iytfp  lieols)srtr(m oo1oleelfciltf rtrxr nt0oexn f3tysfs em(vp;t0tltrir3tytlptr n ils0srtm(m3ou1optn fviat)artrumoot1optnmf3iat mDemn pnt4 eermr iatfatrau i;( srxrxm3nudol n fcs t)aDrrurpno4ole micildfm2rmnms t)trtoiocoodfa elu i ()seur(m3nu1olt  nct t) rtm(r nt0oet moeilt sDea(vs;u) renir iatoa ean ils srxmir ou4ll   icia()artrxr no0aex  o3iysla2ul(vs;() rtrxf oo1lm e nvs;(0seumxmpoudap  lfctltfaDtau p;o0aet iictasfaDraumsnu)teeomr ia1lateanvi;(0 2xm(r3iu1alt lfvias  Dtr(root4aeeo ieilt s uanvont4 lenxocty1fpt ln o s t2xmiopou1omtnlivsls) 2uaxmp;t0tet  oeils aDran ont4tlenmfctatlp rlneols)t2xmxrpiudam  mici s  2trxr oo0texn fetysfaDelnmsnu4 leoxf oydfmDrau ols)s2um(o ou4lp  mieiat)artr(roou1aetnmfeildlaDra(vo (0tleoir3iydfm elu o;t sexrxrpny1lpeemnet sfs2rr( poo4opxoioetad mDumumo ()texrio ootoat aneolt)tetoim3iodlmt  neslt  2tru ono0olx iieiatfmDum(vo;(0 eerxr ia1lpt ln o;t) 2tm(o3iudop   nvsat) ruaump;o1tltn ieilt m2um(mo t0arenxocio1fm ean ol()srtoxm3no4lmt mnci t)a2urumpnu4tptomoeiaslmDrm( o;u4aetrmr3iodopt au ol(0setmxmpnu1omte iviatfa2raumono4aetoiieiatfm2rln o t)aleoio3oo1lmDr nesl(0srtr(mpnodomte ici tfaDuru pnu4tlen ociatfm2umu pn() lermf oy1lp   u olt t2toxopnudolenlnvt tfarraxmpot4oltoiictyd a ul(vo t0arerifctatoa rlueo;()trtmxm3iydlmt  icilsf Dra(r ;o1olx moctytlm2ranvo u0aeeoio ty1op e ieo ()sexr(rpnudom elfet s)sDtaur ;o1aet  oetlsfm rmu s;(4aexoxr ty1om rli sl()t2tmim3iydal elivtl(fa2umxro;t1alxomfctyd mDuln onu) renxf iatlmD lueo ( t2xmir3oo4ll n icia(  rtrxroot4aee  ociydlm umnvpnt0trxriocty1fpDeanei;()trtrxm3io1oltn ictatf Drmxmono0oexomo3iltlaDeluvs;u4 lxoxf3io1om ean o;s t2xrir3nudamenlfcsls)a2rmxrpnt1apx  ictatfsDrlnvs;(0teeoif3iy1fm eaneo;s srur(r iu1ll emneils  rtrum nt0tltnmfciat sDemnvsn(4aeenio3tadomDelieols)srxoxrpoudomtnmnctlsfaDrr(mo;o1texoii3iytlm el(ms;u) ltrmf to1om rlivo s  rtmxo oo4op   fctlsf 2ur(rono0apt mi3tydfm el( pnu4artniociodopteln ol()s2xoxo3no1lltnlfcs () 2taxmo;u0aexomieiytfs umu p;u0trtnir3oatlatean ilt0srtrxo oy4apen fvt (fa2trump;t1tpx ii3ils m ul(vp (0 renircoy1lm e u ilt sexmio3iydlptelietas)srum(rpnt0ole ii3iatlm2eanmont)arenxo3ia1la rlnvs;s0 rum(r3oy4op e fvtl( artaxr oo0apenmfeiatlm rmuvs (0 rtomfcoo1omt  i s s0srtr(m3no4am   nvslt arum(rp;t4aex  f3iat m2eanmp;t4 rtoirctydla eai sl( texriopiu4lltelietat a2tmu  nt4tle  ictltfm raumpnt0 eerif3oy1lpDean ilt trxr(m3iu1amt  icsat  rrmu  nt4oetnmf3tat m rmn s (0artnmr3iydfp r ivs;s)s2xm(opnodopenmnvsas)arrrxrp;t1olxn f3tldfa2rmnvp;u0aexoir io1lp  ai slt)t2umxr iu1omenmieilsf 2tmu o;u1apxnmfeiat m ulu p t) rxrxf3oy1lp eaues;s  2xr(r oudoltnlfvilsfaDraumoou0opeomicils s rlnmsnu)alxomr3ia1laD ln ilt t2xmxm oy4lltnlfcilsfarra(r ou0tpeomfeiatfsDemuvs;t0trtrmociy1fp ranvs s)tetoir3iy4lmtelivsa()sDra(m ot1open fciltfs2uauvo u4 exrio3ta1oat  u o;( trxmim iu1ome lnetlt arta(mpnu1oeto fciat s2ra(vs (4aleoxo oydop r n i;t setoxm oydale liei s)arrmur ;o4opxn ieiys aDra(ms () ltrxr iy1fpDr u o s) 2tm(m3iydaltemicta( srrau o;o1oeen fciytfm umn on(0 lerirciytlpt livilt  euo(mpoy1amt micslsfa2uaumono0ape ifciasls rl( p t) exrmo iatopte iei (  rxrxr3oudoltnlncias aDua( p;t0oleoio3tydfm ea( p;u4tlenxr ty1opD lu o s setrxr nodomenmictatfarrr(  ot0open oeiytfm2rlnvp;(0arxrxo3iadlmD  nvi;s0 exrio3oudlp nlnctatfs2ta( pnt1oex  ietlt m2uauvp t0altnif iydlmDrlu slt0 2xmir3iodop elivs s)s2taxmpno1olenmoeiadfsDra(msnt4altnmo3oatfat  ivs s0t2umxo nudoleemivtl(fsrta( o;o0opeomo3tls a2ul(vsn(0 exrmfciadlmDrlneo;(  2umio3no1ol elfcs tfa2rax ooo1ale mo3ildla2emump;(0 lxrxoctatfa r n s;s0texr(m3oodom n icils)srum(ro;o4aee  i3tydlmDumn pnu0alxnif tatop ean sl() 2um(o ou1ape  fcsls)s2rmum nt4tlx  i3ilt a emn snu) lenxfcio1lpDrlieo;t0s2ur(r3oo1lpt mnvtlsf Drrumpou4tpx ioctytfa2ul( sn(0alxomrciodfmDe iesls) 2tmimpio4lleemivt t)sDra(mp;t4opeomf3iytfaDumuvp u)tlxoio3oytoaDr u o s)s2xoxo3no1lpee ici sfarumump;t1opt  oeiyd s2uan s u4tltoxocootfaDeaneilt0t2umir3iydlp e neia() Drr( ono4olen feiasfm eluvsnu4aexoxo3io1fpD lieo s)setr(m3iu1ale  ivsat srum( pnu4oetnmo3iysfa ulu on(0 etoxf3io1late nei;s0 2urxmpny1am nlnesat) rtm(mpnu4olx  fciltla2ulumsnt4tlerxr tytlmtraies;( truoxm3oo4lle mfesas)arrr(root0aeenio3tad a eln o;(0tetnmrctotlmt  n i t)seum(r3iodlle livi t)s2umump;o4tlxn f3ils s2rmnmo (0 etriocoodop  lneo t)seuoxopnu1lmtn icta(f rumxroot0alxnmfetltfa2em(msnt0 lenmrctydlmD  ueo (0s2xrxmpou1olenlicia() rtr(m nu4aeeoiiciltfs elnmp (0 eerif3oytom   i slt) 2xmxo ou1lmee iesat  rrmxmoot1tltomoeiys aDumn p t0altnif3iy1fat aivs s texoxo3oo4lptnlnvi tf rurxmoou1aee  i3tas m2ulnmo u)treomocoa1lmD ai ils) 2trxr3iy1lp  mnviltfs2tm(moot0tpe mfeiyslm2rauvo t0tetrxf3iotlaDe neilt0s2toir iudll  livta( sDrr( o;u4apeo ictytfmDel(mpnu4aleomo3oy1fpD  i s t  eumio iydomee neia( aDtax  ou1aexn icils m ulnmp;(0tleoifctotlpD aneils texm(r3oodalenlivilsf 2urxro;t4tlt  ieilslm ulnmpnt4 ltnxo3ty1laDrai slt)s2uoimpiydllen ncilt)a2rmx ont1oee mf3iadfs um(vp u0 eerio oo1lmt  ues s)seuo(o3io1alte fes sfsrrm(m nu0tltnmf3iydfm rl(vs;t) lenxr3oodlat au i ( srtr(m3oy4ap emfcs s  2umu  ot0aeeniicild m2ulnms;u4 eerxociotlaDe uvolt)srtr(m3nudol e icsatfarur(mo;t0oleniicilsfmDelump;u4tltnmo ia1fpt  u slt0srum(o3nu1ol n fcsat)sDum(ro;t1oetnmoctytfaDulums;t0 renifciytlat anvo;s)sexm(rpou1alen fei s s2uau p;t1tlt ioctytlm2elu o;(4alermr tadoa eaieols)trur(m3nodol  mici sf rrmumo;t0oexomfeildlsDumnmp;() exrmr oo1lmt anvs;s0s2xo(m3oodal n iviasfs2tr(  no4olenmoeilt mDemumonu)tetoio3oo1lmD  ies;( tetrxm3io4oltemneias)srtaxmpou4altn ociat mDeanvs;t4 rxomo3oa1opD aieilt0texm(o3nudam n nvi s) rrrum ;t1opx  i3iys m2umuvs u0aeerxf todfpt  uei;s) etrxr oy1al elicia()srrru ooo0oeenmfeiatfm rmn o;(0 reoif tatoat  ues;t0 2uriopnodol emfci s  rtm(ronu1aeenif3iasls emuvs u4tleomo oytfatelu o;t  2urim iu1lpte ietltfaDtmum ;t0aetn feiatlaDrau s;(0alxrif3iotfmD aiei (0trur(rpiu4apteliesat)arraxmoou0alen f3tysfa2ranmpnu0texnxrctotlaD lnes ( seurir iodllte neslt sDrax  nu0texoioctys a2eau o;u0trxrxociotoa eaies;( t2xr(mpou1al emfvia(f Dtr(rpoo4oexomi3tas s rm(vs;u0 rxrxo3iotomD  u i;t0 eurxopoydalt mneilt aDraurpou1opeomoeildfa2rl(mo ()texrifctadlpt  uvol(0sruo(m nudom  mncs (f rtrxm no4tpe ifcilslm2ulnvp u)treomo3oa1faDe nesl()sexo(o3oo1ape lfciat)a2tmx p;t1tex mo3iydla emnvo u0altnxr3iatlmDrauei;s trtrxr3oodam e ies sf Dtau  ot4alen o3iasfmDul( s;(4 lxnmf io1lmD  u o s trxm(o iu1lm  mnciltf 2rau  nt1olxnmoctatls uanms;t0alxoxo to1fmte iesl(0s2tm(m3no1lle lics (  2rmu pot0teen ociad s uanmp (4aexoxf tatoa r nvi;s0 exmxopoy1ap emfci s srra(rono0tle  ietydlm2ranvsn()texomo oo1laD lueo;s tetoxo3iu4optelfctlt arrm(  ;t0altoiociyslmDuau o u4alxrxr io1om elivols  rtmimpio4op nmncsa(fa2tmumpoo4ope mieils mDum(vs u)tltrxf tadlp elivs t)sexm(mpny1oleelfvils) rur(  nu1ale mi3ils s eaumo () etrmf3iytopDeliesls0 2umxrpoodam emfcilt  Dtaxm oo0oex  octyslsDrmnvpnt0aleomr ootoatraivs s)setm(rpnu1ol nmiciatfs2rmu onu1oexoioetas m umnvsn(4aexoifctatfa eaueil() 2xr(r3iudlpt mfei tf Duaumooo0opeo fciatla2ua( o;u4trenxocootlptrlu s s) rtmio3ny4lp nlivt t)sDtr(m ;o0tlx miciadfa2rlu s;()tetnif iadlate ivsl(0srxoirpou1ale mfesa()sruaumooo0teeomf3iyt a2ua(mo;(4arxoio3to1oa rlu i;(  exoxmpoo4op elietlt) Drmxm ;t1alx  ociytla2ra(ms u0 ltoxo3iotlmtrlnvsl(0s2tm(r3nodlp nliet ( srrm( onu0altnmi3ildls2em(mp;(0trxnxo3tatoptrluvsl(0trurir3oo1alt lfctlt a2rmxmp;u4alen i3iys a elu s;u) rxrmrcootfa rai s;t0sexr(rpoudlme lfvta( a2tmxmpnu4apenioctyd a2emump u0tltoxr oodlm  ai ols0t2uoiopou4ale mnci (faDrrx ono4aetoii3iltla ran o;t4teerxfcta1fpD  neslt s2tmim3oy4amtnlnvilt)sDtau  ot4alenmoeiytfs2el( snt)texrxf3iodom e ivil(0trumio iy1apt mfcslt)sDtmum ;t1tee  fciydfa2rl(vsn(0tltrxo3oatlpDe nvo t0setr(opoodaltemfei s)sDurx  ;t4oee micildfa2rmu onu) rtoio oy1fa elu s t0trxoxr3no1lpe  ieias a2ua(rpot1teeoifciydla eln o t0 lxoxr3tydlaDran i t  ruriopiy1lm e nes s) 2tr(mooo0aex  ociatlsDrlnvs t4tlxrifciadfmD  i sl() 2umxr nu1ame  feilt  2trxmp;u4tlenmfctydla2el(vpn()texnxociadomD lies;t) exr(o3iu4lpenlfeta( sDum( pot1aet ioctydfs2eauvpn() lenxrcio1omtelues;() eum(m3ny1op elnct sf rtr(roou4tee mfcild mDrmump;t)alxoxo3ootfp eauvi () eumxr nu4lptn nvilt  Dua( ont0aexoif3ilt aDulu pnu)tlerio3oodfmDelu olt)texoio3iudolenlicslt)s2um(m nu4aetoioeiysfa2uauvp () exomf tatlm eluvsls0s2urxr oydap nmivsltf 2ua(rp;o4oeeoiicild m2rmnvsnt4aeeoxr oadom  ai i s0srtrimpnodll nlict ( a2um(rpnu0alx iiciasls rau pn(0artrxo3iytfpteluvs;t0s2xmir3oy1amtemici sf Dur(mo;t4olx  i3iydla2ranvp;u0aexoio3tytla elnvi t0s2xmxm oy4olt mnesa( aDta(ront4oetnmo3iltfmDrmumsnu0tlxnio3iy1lp elu s (0texrxr3oydal nlfvtat)sDur(r nu0apeoiictldla2emuvo u4 lxoxfcto1fa   iesls0srur(m3no4omeemnct sfaDum(m no1tpxoif3ilsfs ra(vp;()trtrxo to1opD lnvo t  rtr(m oo4olt mnet s) rtmumpno0opt io3tadfs ul( pn(4texoio tadlate ueslt)trxrxr3ou1op emnvilt)s2uaur ou4oex mfeiasla rmu o u4 exrmociotlptrluvo;(0sexm(opiudlpe lfctat)a2rr(r ;o0tpxomo3ias m umuvonu) lxnmr oa1fp eluvs;( t2uo(m3oodop elictlt)sDum(r nu0tlx  ociasls2rm(mp;t) ltrxocoatfp e ivs (0 etrim3iy4am  licilsfsDra(r no4ale iiciltfm2rmnmsnu)areomo3iodopDe ivo s)tetrio3nydllenlivi sfsDraur ou4olx  i3tyslmDumn s;()tltnxfcoadfmt aivs;s)s2xmxr3iodopt  nvs t  rrmx ooo4apxo ietadls2elump;(4texoxf iy1lp rlu i;(0 rtmio io1lmee nei t sDrmump;o1apxomieils aDrmnmp;t)texrmf totlmDranvi;s0sexo(m3iu1om  lieilt  rtr(  no0apeniietld aDemuvo t4tetoiociadfm  li o;(0t2uo(opoo4omte nes s)s2rmur ;o4alxomo3tlsfa2uaums;u)tlxoxf tadfpD lueo s0trto(r3oy4optn icslt) rumxrp;u0texnio3iadfaDul(vs;t0alxnxo io1fpD aivs;( sexmxm3iy1olt  ieslt)arrrxmp;u4tee  octyt mDumu onu) exrxrcoytlpt lu sl( srxrxmpnu1optn ieia() rraxm ot1oexniieiasls rlumsnt0aleomo io1om e nvi;()t2umxo io4apeelneias)srtmxm ou1tpe ifeias a2raump;u4 exoif3iatlmtrauvo;t) rxm(r3oodllte ivt tfa2um(  nt4opxoiieils s2eln snu4tetrxr3todla elueilt0 2umxm3oo1oleemfetltfs2ur(r nu4apx mo3iatfsDemuvo (4 reoxo3oo1lm e n i;t  2uo(o no1ap nlfvt ()srtau oou1aetoiieiysla2em( s t0tlerxo oatfmDrau ol()trxmxm3iy4lltnlfviasfarraxrpot4tlx mi3iltfs rln p u)aleoifctotoa eluvils)trxmiopou1lpe livtls)sDrrxmo;t4opxniieild s ranvpnu)aeeoxf3oadomDe ueo;()texoxo3oudapeelfvsa( aDtaurp;u1apxnifetldfm2rluvp;u4tleomrctatlm e n s t texrim3nudape  ictls) 2rmx o;t1tpeoifciyd s ranvs u4tlxomoctatlpteln s;t srxr(opoodom nmfcsa( aDrrxmono4opx mf3ildls2em( s;()texniociydfptrluvols)srurxm3io4olte fvsas)aDtmur nu1tee  oeias sDea(vsn(4tleomf tydopD au s;(0teurxm3iydll nmfctasf rrm(r ot4oex  i3ildls rau o;t)arenmf tatfpDeauvs;()teuoio3ou1ope  ivs s)aDtr(  ;u1opeoio3tydlm rlnmont)teerxf3ootlpDrlnvs;s) 2umir3oydll e fvsl( s2rmxrono4tetniictat m ra(mont4aleoir3ootfate ieo t) 2umir oy1amtelfvt s a2rm(mooo4tle iociasla2rmumo;t) lxrif3iy1oa rlieo s0 rxmxopiydlm nmfet (fs2rax  ;o0apenmfcildfm2ulnvo;(4tltnxfcootoptelieo s s2urio oodol emici (fsrrm(  nu1tlenioetytla2uan ont)altnxo tadom rluvi;s) rumiopnodapenmfet t  rtaxm ;t1tlxo f3ilsla ua(ms;t0 ltomf totom e n ols)srurim3oudolt  nctatf rtm(r nt0tptn o3iltla umnvo;u0aexnmrciytlptr ieo;s  rtr(opny1ame lies t sDumump;o0alenioctls mDumuvpn(4 exomr ia1opDeanvol(  exrirpno1lp n ics sfsDur(m ;t0ale  fetydls eanmont0trxoir oo1fpt aueo;t)s2tmxo3iydlmeelivsl()sDtaxmpou4aeeomociltla emn ont4artniocta1oaDrlnesls0 rurir ny1ome  ncs t)artmurooo1tpe  feild sDum( s ()teeomo3oa1om eluvs (0 rto(m3iodale mfcta(fsDurxmo;u1alxn oetat s2ea(monu0 lerxf3tadla r iesls)trxmxo iy4amenmnvs (fartr( pou4aexo oeiasfs2uan on()tltnio iatlaD  n sls  rtrio nu4op elivtatfarrrum nu1apto feils m2elu on(0 rtrio tadfmD ai s ()trxoxmpiu4ol  lictlsf 2tmxr ou4olx  oeiyt a rmumsnt)texomo3iodom  li o;(  rxo(mpoy1ole liesat)aDur(r ou0apeoiictaslm ea( snt4tlenif3iatlaD anesl(0srxrio io1ape  ieiat  rtr(ro;u0tee  ictlt mDea(vs (0 lxrmo3tadlpDrai o ()seuoirpiodomtelivta(f 2ua( o;u1oex iociasfm eau o () etomr oydlmDe ivil(  2uo(m oodlp emneta( s2tm(  ;u0opxniieiadfmDuau o;t0 etrxociodfatr n s;s0s2uo(m3oodap nmieilt sDrrx  ;o4apxnmietyslmDemn p;u0alxrmr3tydlp r n i t0 2xmio3oo4amtnlivs s s2tmx ont4ole mociytfs2emuvsn()tlxrmr3todoat  iei s0seumimpoydaleelfvtl()a2tm(mooo1aeeoiietysfm um(vs;t4 rxnmf oy1omD  u i t0setm(r io4llt  ici s arra(rpoo1tpx ifetldfs ua(vp (0 lxoxf tydomDe nvols)srtoirpiy1lle lncils)sDurxmono4alto oeiysfm ra( s () etnxo3iatfm e nes s0srxr(o3iu4ape  neilsfa2raxront1altoio3iyd m2ua( s t4 lxoif oydomDr ueilt  2toxr3nu1ll nmfctasfa2uauroou4tlxnifctltls2eanmo;t)tltrmfcoytlmDr uesls srurir oudlpe mnei s) 2rmuroou1tlxnii3iaslm emn o t4tlxrif3oy1fmD  ueo;t  rum(r3iy4am   ieilt a2taxrp;u1oltn f3iaslm2umnvs;u)altnxfcio1lm  anes t) exrim iudolt livsltf Durx pou0aleomi3iad m umnvs;u4aleniocoydfmDeaiei;s)s2xoim iudope lfcsasfarua(mooo0olt  f3ildlsDrm(vp t)trtomrcootopDr u s s0srtmxmpoydolee iesat)sDtau poo4oexn ictaslm umu s;()aeeoxr ootfmD aneils0trurxr io1alt  ivia(  rurur no1apt  i3tatfsDua(ms;u4tetoif tatla  lnvi s0srum(o3nydapeemivt t)aDraxrono0olxnmf3iytfa ean snu)tetomo iotomDrln i s0trurirpoo4omtn icia() 2tm(m ou4texnifciysfs ua(mpnu)aexrif3ty1omte n il( setoimpiudomtn ics t aDuax  oo4olenmociatla uanvpnu4 etnif iodoptrlneils)t2tmxr oydopeelfcs s srururono4oleomi3ildfm emn p t4 rxnmo3ty1opte ivs s0seurim oo1lmt mfes (farrr(mp;t4oee  f3iytfs2elu snt4 eeoxr3tatoptr iei s s2trim3no4al  mivia( srtruroou0ale mfctldfs2ulu o u)teerxfcoodlpt  n ils  ruoirpio1lptn ivsl(fs2ua(moot4texnmo3iyslsDem( sn(0alxnmo3io1oatr ieil()t2xo(mpnudop emnctas s2tr(mpno1aexniictytlmDumu s u4artrxrctotlp elu i t t2urio iodale mieiltfaDrrx  no1oetn oeiatls2eanmo;(0tetnmocoy1fa  lueo;()srxr(r3iydome lnvt s  Durumpou4olxn oeiysfa2rm(vpnt4tetomr3iatfp  liei ()trtr(o3no1llenlnvi () rtmxro;t1oetnmfeildfm emu ont4altrir3tatla elu i (  2trim3ou1ll n ivilt  Drmxmo;u1alenioeiys mDeauvp t)tetrmr tatoa r nvo;s teumxo3oodoltnlfciasfaruau ooo4olxo ietld sDua( pnt)tlxrmoctytopt aueo s  rxrxo3io1lm nlnes s)a2rru  nt0opt  feildlm eaumsn()teenif3tytlaDrlnvo;()t2ur(r iydom emnci ( srrau p;t0tlt  ieiatlmDuauvsnu0 rxoxo3ta1fmt auvs;() eurirpnydlmt  iet (  2urxm no4oex moeiltlm rm(mp (4 exrxfciytom r uei t0seto(o nudamen fvtat)s2taxmpnt0tpen f3tasls2rln s ()artniocoodlmtrlnvs;()trum(o3nu4lleemncslsfsrum(rooo1oetnmieiadla2ea(vp;t)tleoir3ty1omt au i s0srur(o nodope  fvil(faDtr(moou1olt mictlt s em(vp;t0aetnmrcoydfpD ai o;( s2to(o ou4ll   iesls)aDua(rpoo4tltoiociytla umuvp (4aetrxf3totlpDe i i;s)seum(r3iydalt  ivta(f Dua(r nu4olt  f3tyslaDelnmsnt0 lerxf3ia1lp  livi;( sexrim iu1olt micsasfsrur(rpno1teto o3tydfa2elu o;(4tlxomr todfateaieo s0 exoir3oodom n feiat) Dtaumpou4alx iieiadlaDra(vo;u)alenmociatfat li slt0trtm(mpoudlpeemneilsf Drrxrp;t1alx  feiyslaDuau p;u0trxnmo3oatlp   neilt0texoio ou1am  lics (fa2rax  no4tlxo ietydfm ra(vs;u4texrxo3oydomDr ivslt s2uoxrpiy1am  lfciat) Dtmxrp;t1oexniieiys mDum(vo t) exoir oytlaD aueol() exrio oodal  lnvsls)arururpou1tltniicias m emnvpnu0texomr3iytoa ran i;() eumxo nodape mfet sfs2rr(moot1tltn fciadlaDumuvpn()tltniociytlptr nes;t t2uoxr io4ope mnet sf 2ra(mooo1alen octadfmDulnvs u4alenxf3tadom  aneo;t0s2urir3nudom n ieia(fartaumo;u0teenmictatfm umu p;u4 ltnir ta1lmtr nvol(  rum(o3oudomt mivta()sDtr(rooo0apto ictys a umnmsn(0 rxoio3oy1om  ai ol( trtmxrpio4olen iesa( s2trxmpoo4oexnmicild m eau o;u)aeenir tatlaDr i ol() 2tr(opoo4apeeliet (faDuaumo;o1alxnioeiatla2elnvon(0altoxo ta1fp   i ilt) rtr(r3iu1amenmietlt)a2rmxmo;o4altnmf3iyd sDrm( on() exrxoctodfp rai olt)trtrim3oy4apen fctl()artm( onu0tpx ii3iadls2ranmsnt)alxrmr io1lpDrlieilt0trum(r nydopenlnci s aDum( poo0tee iociat a2rauvon(4aeenio ta1omte n s s0t2urxmpoodlpte nvslt a2urxr ;u1tet mi3tld s uan sn() exrxo totfmt  ues;s)teumim oy1al nlictatfsrrmu  nt4aex  i3ilslsDemuvp (0 leomr io1oa rlu s () 2uoxrpnu4al e ncsa(fa2raum ;u1oltoifeiasls2rm(vo;t4 exnmrcio1lp rlnvslt)trtr(m3iu1ol nlfetl(f Dtaurpou1ape mictatfs2umuvo;t4aexrmfctadfa   uvsls) 2toir3io1ope  iet s)srrm(rooo1apeomf3tytfa2ra( o;(4artoxo oodlaDr neo s t2to(mpiy1lp nmnesat  Dumumonu1texoii3ilsfm2eanmo u)alenxr3oy1latrln s t0srurxrpnudoptelnvil( aDtm(m ;u4oetnifciys s2ra(vonu4aetrmfcoy1lp e u s;s0trumxopoo4op  lfviatfartmumpnu1oeenmieilslaDuln p ()aexoxocio1fmDrlu i t) rtriopoo1llenlfeslt srra(monu4ale  f3ias mDeaumo (0 rtoxr oa1optean il(0trtmxo3iu4optnmictlt  2taxrpno4openii3iyt m umump;u)alxoif3oa1faDean sls0 rxoxm oudaptnlicsatfsDrrxm ou0aex iictatfa umu sn()trermf3oo1omD aivs;t srum(rpiy1om  lfvtl(  Dumx  nu4aetn oeiatfa umn s;u0texoiocto1fmD auvo s  ruo(m3oo1al nmncs sf Drm( pnu0aeeoioeildfa rmu s;u4 ltrio3tadfmt  ues;t0t2tmim oudlpenmfvi (f Dumu o;t0ape ii3iyslsDulnms t0trenif tydfmt lneolt0t2xrxopiy4alenlnesat)aDur(ro;t1oeen iciat aDulnmp (4teerxf3iy1oaDe neo;s0 2toxmpio4apte fcil( srum( pnu4openmieiyd aDrm(vp (4tlxnmrciatoaDr ies s  rxmirpoy4aptnlfctl() Dur(mpnu1aexoif3iltfa2rmn p t0tlxnxr tadfmDelu s;( t2toirpoy4llte nvs s) Drmu oou0tpxnmfetysfa2raump;(0altoiocoytfptraieo (  exrir3oy4alte fvslt)s2rr(m ;t0alt moctad a2ranmpnu) exomf tydlmDrliei;t  2tmxo3nudoltemfvtl(fsrum(mpno0opeoifcildlaDea(vo;t0 ltoxr3oadfmD livslt0s2umxrpnodopeelfcilt)arrru  no0aex  fctlsls2umu p;u0teenxr iodlmD li i t0 2xm(m nudamtelnvs tf Dur(  ou4tleo iciat s2um(ms t4 eenxo oa1lmte i slt) exmxopnydlm elicsat)a2tax ooo4opx ifctld s2ul( s u)texnmfcia1omt  ivsl(0srxrxo iodolt  nvsls)aDumxm ;o4apxoioeiys a2elnvsnu4aetnxf3ootfp eaivols)srxmxr oo4op nmnvs t  2trur oo1tltniieiad m eluvs;t0 exrif3oy1fmDe u sls)teumirpnudol emivslsf 2ra(moou0apx iieiyd m uanvo t0tlenxo oatomtrauvs;s sexrio3oodoltn fvsls aDururpoo1tpe moeiadfa um(mp;t)areomo3to1faD li i (0s2xo(o3ou1amtnmictl(  Draumo;t1tetoif3iltfs2ulump t4artrxr3tadlp   uvs s)t2xmxrpiy4alen fctltf 2raxm ;u1apt  ocils m2uau sn(4 reoir3iadfm  anvslt truoim oo1ap n iviasf rrrurpno1teeo f3tadfa2ra(mpn() etoxfcoydom   neils s2xoir ny1ale lneils)s2raur ;u1aexo ieilt a rlnvsn(0tlxrifcoa1opDelnesls t2xoxrpnu1alenmnvi tfsDumxm nu1olen oetadfa2uaumo u0aexnmrcootfmDe n s;s s2urxr oydlpeelnvs ( a2rau pnt1ole ifeiaslaDrmuvpnu) exnmo3oadlmDrln o;(0teurio3oudlm  miet tfartrxrp;t0tpe ioeiatfaDrm(vo t0artnio oo1lpDe iei ()trxoio oodap emnvils)s2tru pot4alxn fetat s rm(msnt)alxrmr iy1om  ai s;t0setrxm3iodal  lfeiltfarrr( pou4ope ifeiyt m2ul(vs;u4 etoxr3iatfmDrau i;t)teuoio oy4lm n nvtas) rtr(m nt1aleoif3iatlsDemnmo t0 lenxr iadfpDeln o t) 2umxm3ou4alen fvs sfs2uaurpno1olenmoeilslmDemu s;u0altrxf iotom  ln s ()t2urxopiu1lle  fcsa(  2raxrpot1oleomf3ias a2ra(vo;(0 lxrmrcoa1lmt anvols0 2tr(rpnu4lmenlnvt t)aDrm(ro;u1tet  ociyslaDeauvsn(0 leoio ta1opDrli i ()trtoirpnudamte fvils aruaxrp;t4opxniictytlm rmuvo u0trenmr tydop e ivs (0srumxmpiodlpt mfcs () rtaxmpoo4oeenii3iatfaDem(vp u4tlxnxf3iy1lp  auvi;( srtr(r oy4opt lfvsls aDtmxrpnu1aeeomietatfa rl(ms t0trermr3ta1oat  i ilt)teur(opiy4op  licsat)s2taurpnt1ape mfciytfa emumo t4 etrxocoytlmD  i i (0 rtrimpno1lle  fei s sDumump;u0ope ioctytlsDulnvsnt) eeoio iy1la rln i;( srxoir ny4om elnvtl()arrrx  ;t1oee mf3tydlmDrmnvonu4teeoxfctotfp  ln olt srtoirpou1om e ieia( sDta(m nt4oetnii3ild m2rmnmo;t)trtrmr ootop rlieo;s  eurxr iu4apeelncs (faDrrur nu1tlxnii3iytla umnms;(4 renmo3oa1fpt liei;s)trxm(mpou4lptnmfvtls)a2taxr oo4oleoif3iydfa rl(vo (0tetomo3ia1lpD lu o (  rtoiopno1ol e nviat)s2rru  ;t0olx mi3iaslmDemnvo;u4teenmrcoydfa   i s t sexrxm iodale  nvs s)aDrmu ono1tle  fctasfm2ra(ms;u) rtrxo3oo1fp e nei;s0 2xmxmpoudome lfet s) 2trx o;o0oeeomfeild m rmnvo;u)trxoif to1fm r nvol()sexr(r iydam  lneil(fa2ta(r oo4oeto ocilt aDea(ms t0artnxf iadfpteanvsls0s2xmir3oy4optn ies ()s2ua( pno4oetnmfeiadfsDeluvont0aeenxf iotom eluvilt sexoir iu4alt lfvils) rururpot1apt mociat a rmn ont)aetrifcoydomtraneo s trtoxr3iodalt mietltfsDta(mo;o4tlx if3tatfm2um(ms;u0aetoxfciatoptraueslt)setoxo oy1lpt  nvi s) 2rru  nt0apenmf3iydls ulnmont4 reomf totfmte nvo t0setmxrpio1lle lfeta()arum(mpou4opt io3tld aDulu s;(0teeomo iy1lmDr ueo (0s2xoxm io1ome lnetlt)aDtrxrono4olto feiysfa rl(vp (0 rxomo ta1lm eluei t0sruo(opiy1amtnmivt tfaDrr( p;t0apxnmfeiyt a um(mp;(0teeoio io1oa   ieslt t2tmir3io1lpeemictat  rum(m ;t0ope mi3ildfa2ulu pn(4alxnifciydlmtean o s t2xrim oodopt lfvsl( artaum ou4tet ii3tysls2rlnmsn(4teenxr ty1fm rauvo;s  euoim nu4omtnmieia(fsruru p;t1texnmfctad s2eanvo;()alxrmo ta1fmDr nvo ()s2umxrpiu1op n iesat)sruaxmp;t1aexo fciasfs el(ms u)trxnxr ty1fa e ieo s0t2tmim3oo1altemfvtl(fsrraxmp;o1apx ifeilsla2umnmpnt) etnmrciadlp e nes;(0 etmirpoy1amen ici sf 2ra( oot1tpeo o3tydfm elnvsn(0treriociadopDrli olt s2uoxr ou4lmtemnvtl(fs2rmur ou1teen f3ilt s2eln o;u0 exrmfctotop raieo t0 rxm(o iu1lpe mncta(farrm(r no4tetomfciasla ua( p () exrxociotopt livi (0sexr(o3iu1ol elnvslt  2rm(ro;t4apxnio3iadfa2ua( s t)aexnif3ty1om r u i t) 2uriopnydalen icta(f Durxmpno0oeeoiiciltfm rmumont4tlxrmociy1oaDr i s;t  rtoxm3oy4lpen fvsls artr( pou1aeeo ieils a rmnvo u4aeenif3oydfmDeauvs ( srtm(m3iu4ll nmies t)srurxmpnt1oeto feiyslsDum(msn(4aetnxf ootoptr uei;(0seumxr3ny1lp e fvilt)s2um( o;u1olxoif3tlslmDum( o (4areoxr3oodfmDr nvils  2xoir ny4ap e fctls) rtmum ot0tpx  oetydfmDemnmpnt0areomr3iytlaDean o s  rxoio iu1oltnlfcias)sDuaumo;t4apeomieiytla ran o;u0altnirctodom r u o s texrxm3oudol n ncsltf Drm(mono0tet if3tlt a2eau o t4aetrxocio1lpD  u o;(0 2uoxo nydap e fvils s2rru o;o4optomoetytls ua(mp ()tlenioctodlaD anvi;t trurxrpnu1lmtnlnvs tf rtr(mont0tleomfciytlm rmumo u0tlxomf ty1op eaies s t2umimpiudlptnlnvil(  2rr(r ot1aleoiieilsfaDuan p;(0 reoio3ootlmD aneolt  2xrxr3io4omtemici s)s2taur nt0alxn f3tldfmDrm( s t) etnmrcia1fmDeli slt0t2tr(o3ny4om   fctls) 2ua(mo;u4opt mieilslm ra( p u4arxrmr3iatla e uei s0sexr(o3oo1am  mnei tfaDua(rp;o1tltn iciadfaDem(mo (4 etrmocta1opt lneo ( trtm(r3ny1ol emfct (fsrur(r no0oltomo3tytfm rmuvo t)arerioctodla r ieils0 exm(r3iy4omt  nei sf Drmu p;u0alt mf3tlslaDranmsnu)tetrircoydomDeaues;t) etrxm oodom nlfcils)a2uaxroot0oet if3iysla ua(mo u4tlxomf3oydlaD  i slt)srxmio3iu4opt  fviltfaDtr(rp;t1aptnmociaslmDelu s;u)tetoxfcoy1lpDeln olt srxoxm oy1altnmneta(fsrtaxro;o4aet  o3tasls rm( o ()tlerifctydoatelu s;s srxo(r3iydoltnlnvta()aDtmur oo4aexoii3iltlmDel( ont4artnio3iotlatr ues s0srxrxopou4open icias aDuru ono1alxnmiciadfsDul( p u0 lxriocia1fpDelu ols) 2to(m no1am e fvs s) 2trur no1oltnifetlt s2ra(vont0tltnmr totfatrau ils)s2uo(opoodol n ivs (  2ra(m ;o0oeenmiciydlsDrmn p u4texomoctodfm rlu s;t  2tmim iodopt lfesls) 2ua(ro;o4olt ioeiatla2rm(vp;()aeenmocoydoa   ieols teum(opou1lp nmfctls  2rmx  nu0olen i3iydfa rmu snt0 lerxo iodlp rau o s0 euoir nu1amt liviltfa2urxrpot1olenif3iadfs ranvpn(4tlxrir3ta1om r i ilt) 2xmim3nodaptnlfctatfa2umurpou1aexnmietadlmDrmnvon(4 lxrmfciodlm rau i;s0setoim3iy4omtnlnvt t arur( pnt0optnmieiyt s2ra(vo;()arerircoodlpDeaivi;() 2tmimpny4omeelncilsf 2rru pou4oexoiiciys a um(vp;t) rtoirctotlmt lneols setrxr3iy4oltn fcslt)arumu  ;u0aex  i3iyslsDemuvo t4 etoir3iytlptranvilt  rxrir ou1om emicia( s2uaurp;o1tex iociatfa umn pn(4tltomo totopDean ils0sruoir oudaptemivi (  2tax pou0aex io3tys sDrm( o u0arxnxocia1fateanvs t)teurim ou1lm nmfei s  Duax  nt0aexnmf3iydfm rln s (0 etoio tytomDeaivil(  2uoimpio4lpenmivils)s2taum ;o0tlen ieiyslaDem(ms u0tlxrmf3oydfpD aieslt)s2xoirpou1olt mivs sf Drrxmpou4olx  fetyt m2elnvo (4aexnxr ia1lpDe nes;(0texoim3ny1lltnmicilt)a2urumooo4alxnif3ias aDeanvp (0altnir3iydlpteaivs;t)teuo(rpoodol nlfvsl()sruru p;t1oee  ieiys aDea(ms u0altnxo iotfa e uei s) etoimpnudlm   netls) 2tmxm ou4alen ocildla2ea(vs;t4tetrif iadlmte ues;() eto(rpnu1ope mfeil(f Drm( oou1olxo iciyt m ul(ms;()tlxrxfctydoaD luvilt) 2xoio io1lpte neia(fs2ra(  no4optomo3ils aDrau p u0trxnir3totom e ivo s s2urir3iydomt lnvils srtrxr no4tpx iietltfs rmu o;u0 lenmf3tadlm elieils trtrxrpoy1ame  ieslsf rum(mpnt1apx  fetld sDrlnmpnt0tetnio oy1fmDr ueo ( trtmimpiy4lpenlieta() Dta(mono0texo oeias m emnmsn(0 exomr iadom   nvs t sruoir3iodapteliet t)s2rmx pnu4aet  ictys mDrm(ms (0arxnxrctydfaDelnesls srxmxopiydlp  mictasf 2um(ro;t1apt  fcild a2ea(vs (4aexrmf iy1omDeaieo;( t2tmxopou1omte nvt s  rrmurp;t0tpt iociltls rlnvs t) etnxociy1la  ln ils)s2urio3io4ll nlfet t  rrru pnu1texnmo3iltfaDuauvo;u0trtoxo3iotlp ran i;( t2tm(opou1al emiei t sDurxmpot0opxo ieiys s2umuvs u)artomf iytopD  nvilt0 2uoxm3ou1alenlivi () 2umuroou1oex mfeias s elnmpnu4aetrxo3iotopt ln olt)trxrimpoo4ome  nci (fsDuax  oo1alenifetltfm um( onu0trxnmr3oadla raies;t) 2ur(rpiu1op  mfei s) rurumpoo1tpxn f3iltla2elu p ()trenmfcootoptrai o;(0 rum(opiu4op nmnes t aDraxmpoo1apenii3ils a2elu p (0texoir iy1lpt lueil() 2uoim3nu1alen neil( artrx pou0apxomf3tldfm2emn p;(0aexoxr3iodfmtrlu s;s)s2tmirpnu4am nmivsat)srtrumpot4altnio3tatfm2emnms;t) eermr ia1optelneo (0 eto(m3iu4omte netat a2tmu  nu4oex mi3ild mDumn snt) reriocia1oaD  uvo;() rxmxr3no1lp e ies () rumxmp;u4oeto o3ilslm rln s;t4aexrmocoytfatean o;(0t2tr(o ou4altemictlsfsrtrx  ot1tlx ioctasfm2emuvo;(4artrmr3iy1om r i s;( trxo(o nu4omtn net tfs2um(mooo0olenmieildla2elu o u4alxoxr tytlat lues t srxr(rpio1lp e nvi ()a2ur(m ;u4aeeo oetatfm emumpnt)tetrxocta1oaD  i s;t)seumim3oo1op nlnvtasfsDrmxm ;t4aee  oeiyt a uaumo u0 exomo totfa r nvol()s2umir ou1lltnmietls) 2rrxmp;u0tee  f3iys sDemn s;t) rtnxr oy1fpD aiei t  2xmxr3ou1amenmfvs s)sDum( p;u1oetnii3iasfa2el(vont4 reomr oa1fat ai s;s0seurxmpiu4lm  mivtls s2umx  oo0tltnmfctldfs rmu sn(0 lxnio ty1lptr nvo t0 rxmir3nudolt  neils) Drrx pot1oeeoio3iad a2emump (0 lxnxrctadfm rlivs s0srtm(m3ny4ole miciatfartaur ;t1oeto ocild mDean on(0 lxniocia1lmD an olt teuoim oy1amt livta() rurxrp;u0apenifeild aDra(ms (4 rtrmr3todlmDrau ol()s2toirpnu1llen icsls aDurxmpou4aexomi3iasfsDumu o (4teenxociadom  lueilt)teurir3ny4lltelivil()srurumono1tpxnif3ilslm em(ms u0teenmf3iodlmt lu i;t  2xo(o3nu4lptnlfctl( sDtr(mp;o0oleomoeiadla2eanmont4alxoxrcoa1fpDr ueolt)srumim iydapte nei sf 2raxr no0alxnifeiyt m rl(vs u4 rtoxr oodfa e u ol()s2urimpno4am  lies ( a2taxrpoo1tpe  fcildfa2eanmsnu) reoir ootla ran s;( truo(m3iudom e fvsas s2tr(ro;o4opt mictasfa2rlu pnu0areoxr3totlmD livi t  eumxm oodale liesat) 2rmum ot1apx iietlsls el(vp;u4trtoxr iydlp e ivo;t  etmxmpny4op nliei tf 2umumpnu0aeeomociadfa el(mp;u4treniocoytlpte n s t)s2tm(m3oy1opt mfvtat s2rr(m ot4aexnmiciadlsDumnvp t0 etnir3tatoat lnei t)srurio oo1alen nctas aDrauronu4tltoioetatfs rmn s;u)alxnmfctytomt livo (0t2to(r iu1ll nlnetlt)a2tax oou4tlxoii3tltfa rmuvs;(4 lxrmociodlptraneilt0texm(rpoy1ll n fcs tfsrtaum ot0apxn o3iatlaDeln p;u4trenifcty1fmt  u s t0 2uoxo3io1omee feiat sDuax  ;t4tetomo3tydfm2eluvon(4trxoxocia1lm  an i;t)sexoim oy1oltnmnctat srtaurp;o4openmi3tadlm2raumo u)tlxoxo3oy1oaDeaieo s0s2xm(m3iu4amen icsas aDtaxrpoo4apx  fciydfm2um( o;u) etoif3iotlpt anvils0t2xm(opoudomen nesat)s2rru  ou0aet iiciatls eau o;(4alenmr iytfm   ieo;t0t2ur(rpou1ll nlfciat a2rmxmp;u0olt moeildfa uanmsnu0alxrmr3tadlmt luvs;t)trtrim iu1ome  nviat a2trxm ot4tptn f3iat a2em(mo u4tlerio iodop  ln olt s2xmim iydolenmncta(fsDuru  nt1oltomi3tlt s2uluvp;() reoir3oo1opte nvs t) 2trio3io1lltnlnvilt) 2trxmoou4aptomfciaslm umu p ()artoxrcoadop eaivslt tetmxr3iydalt mneilt  Durx  ot4aee  feilslmDelumo;(4arxrirciadlmt  ivi;t)seuoxrpiy4am e nvtlt)s2taxro;u0aee  f3tlslsDum(vonu0tlerirctytfm eau sls)seuoxrpiodllt  netltfsrrr(r no1oexoiieilt mDrluvsn(4alxnio oytlm eanes;(0t2tmxr nudam nlnct s) rta( ooo4optn i3ias s2ul( pn()tetoiocty1fptrlu o s trum(mpny1ome  fetasf Drmumonu1tlen o3iytlsDemnvo;(4 lenif3ootoa  lu ilt) 2uoxm ny1om nmfvia( aDuauroot0opxo feiltlm2umnmsn(0alenxocoodoatr n ilt s2urir oo1llen fvils sDtmum ;u4tptoifcildla ul(vo;(4altrio oo1lmteauvi;( s2umxopoodopt mies tf 2raxr oo4tetniietas a ulnmp u0aetoxo tydla ean olt)t2xo(mpnu1optnlnetatfsDtm(moou4tpxo oeiasls2rlums;u)trxrmf3ia1opDr ivo;t0srxr(m3oudlmtnlfeias)sruaxroou1tltnii3iydlsDuaums u0trerio3ta1oaD  nvi (  2uoir3nu4ap nlfvs sfarumxr ;t0teeo f3iadfs ul(mo t) rtrxr3oo1oa r ivi s s2uriopou4aleemivsls)sDrm(mont0alt if3iasfmDraump (0 ltoio ia1fpDr uvs t)s2xr(r3iy4amtnmnci () Drm(r nt0apxoifcildls eaums (4trxnmfciydop rlnvols)sexrim ny1llteliei t)arraxm ;t4aexniiciyd s ua(vo ()alxrxf ta1fatrln o (0 rumim3ou1lm e iesls) Dtru ooo4tle io3tlslsDua(monu0 lxrmf iytlp e ivil( s2urir nu1optnmictasf Dtm( o;u1tlt  f3tldlm2eanmp;t0trenmo oodla eau s;t0 2trimpnu1opt  nes t sDtmxr no1opeoiieiyd s em( sn(4altrxocootopDrlnei;t sexr(r3nodamee fct ()a2um(mp;t1aetomictatfm2uauvsnu0alxoif3oatfptr i ols) rumim io4am  lfvtl(  Dta( p;t0apxniictytfs2ea(vs u0alxomf3oa1opD  u olt0 rxoim oo1ope livtlt s2umx  no4aexomfeilsfm2eln s ()texnif3tadoaD aieil()setoio no1altnlnciatfaDum( poo4tlenmoeiaslmDea( snt0teenmr3iadoateaivs;(  2xm(o iu1alen fvsat  Draur ou4tetoiictldlm2rlnmpnt0arxoioctytlp  luvo t  2xoxopou1lm nmfei tfa2rm(r no1oeeoif3iad m ul(mp t0tlxrir3iatfa r u i;t seuoio nu1op elfcsasf Dtmu o;u0oleo i3tyt mDum(mp u0aetnxrciatlmD lieo;t) exr(m3oydaptnmfeia(  Drmxrpnu4tptomieilsfm ulump;u4artrif3iadop eaivil( s2xo(m3ny1lmenlfesatfaDrmxmpoo4olen oeils a ulnvonu0arxrxrctotomDelivols0 eum(m no1lmeemfci s)a2rax oou1aleo ociasfs2uanvsnt4aeeoxf io1faDe ivsls0 rxrxm oodlpenmnci s s2uaxrooo0tpeoif3iltfs rlums u4 exoxrcio1fp   n i s0 2tmim3oy1lptn fvsa(f 2taum ot4aeeoio3iasfa ran pnu4tetrmocty1la eauvi;s)trxrir3ou4lpe  nvsls)a2urxr ;u4aexo ociadfm2uauvo;u4arxoxo3todlmtelueo t srtrio3iy1omeelneslsf Dta(roou0tpxomfctlt aDem( on()tetoir oa1fatr u i;t0srxoxo ny1olt mfcta( srurx  nu1olx  octys s2uan sn(4aetnmociadlpD lu o s0t2xo(rpnu1ameelici t srumxm nt4oetomiciytfaDul(vo t0trtnif3oa1lp   ies;s)trtm(o3no4amenmivtl()a2rmu  ;t0opxoifetlsla2uluvo u4treomf oo1fmDrln o s texoxrpno1omt  fvsas) 2tax  ;u0aeeoif3tyd m2umnmp u0texnif3oytomDr neo s) exrxr3oy4opt livs ( arrmx  ;t1tee iieild aDrmn sn()aeenif oytopDelnei;t s2ur(o3ou4lltelfvsls)aDuaxm ou0tltniiciytlsDul( s (4 etomr oytopt ln i;()t2trio3ny1amtn iciat sDua( ono4apx iieiyd sDrluvont0tlxrio3ootfa  lueo s)setmim oo4opt mfeil(faDrru poo0apt  o3iysfs ea(vsnt)alenio iodopt aivs;(0srtoio3oy4altemnvias aDraum nt0olx iietldls2umnmsnu) rerxo tatfaD aues s0 2xrxm iy4opt lfvslt)aDra(rpoo0optn fciys a um(mon(0trermf3ta1om e neo ( srtm(o3nodapenlncta( sDua( pno0tetn ocilt m2ranvp;u4 eeoxr3todfp eanvilt) eumiopiydomen nei ( srtru  ou1aptnioeiad a ua(vo u)aetnmf oodfmDe nvol(0s2xr(m oo4openmfciasf 2uaxr ;t4ole  fetatla ulumpn()tlenifctydlptrln i t t2toxmpoy4ale mietl( srtrur ;t4olt mocias a2rmnmp;u) lxrmo3iy1fmDelnes;s) rto(opnu1am e icilt) rta(  no0oee  icilsfmDua(vp t4 ltnmocoatla rlies ( texo(rpoudomt lneil(fsrrmxm ot0oeenifeiasfaDuluvpn(0 eenxr3tytfmDelies s) 2urio iu1olteliesl(f rrm( onu4oee mieiasla umnms u0tltoxf3to1fmtran ilt)s2xmirpnu1ap  lfct ( aruru  no4oex if3iatlaDeluvo;t0tltrmf oodop   uvs;s)sexm(mpnu4lp   ivi s  2tmumo;t0oeeomfeiltfa2umums t0 etnmr3ty1late n ils trtmxopiydopenmfesl(f rrmx pnt4oeeoiieiytls ea(mpnu0tlenmociatop raieo;(0s2uoir3io1lme mneilt sDuru oot4teto f3tytfaDul(vo;u0artoxfcoatlmDr uei ()teurxm3iu1oltemfcia(  rrr( ono1apt miciytfsDrmn s u4tetrifcia1lmD ai s;s0s2to(m no1lmtn neilt)aDtrxmpot1apt ifetld m2rmnvo;t0trxnxfcoy1fm eaivo;()trtr(o3iy1ap   ncias) Dta(mpot4tet moeiad s2rmums;(0 leoio3to1omD ai sl(0 euo(mpiy1lpe lfct ()a2rmu poo4olxo f3tyt s2elnmo;t4tetomo3iatomDe uvol( setm(opnydolt mnei t)arur( p;o0tpeomf3iltla em(msnt0arerxo3iodfaDranvo t) 2uoio nodopeelicsls)aDrm(rpno1tlxo ietldfa emu ont) etrxfcio1faDr ivo;( texoxrpiydllt lfvias)sDtaxmo;o1aexo f3iysfm2ulump () leoiocty1fp   i o () rxmxo3oo1ap  mfcsas) rtaumooo4aeeo i3iatla eanmo;t4arenxo ta1la  lnei;() 2umxopoydlptnmiciat aDtm(rono1opt iiciydla2uln s;(4treomfcty1fpteai o t) ruoirpny4opt lnvi sfa2uaum oo0oexo i3tat s umnvpnu0aetnxociydlpteluvol()srxm(r3nydllenlies ( a2ur(r nu1ope iieias m2eau pnu) rtomfctatfmDrli ol()tetmxm3oy4lptemivtlt)a2umxmo;u4opt mieiyt a eluvo;() exoxfcoytlmDranei;t  rurxr iudol  mnesl(f rta(ronu4open f3iasfm uanvs;t0tleoxr todlpDr i ol( srtmim ny1lpen nes ( s2tm(rp;o0opeoioeiyd s2rl(mp t4 ltnmrciy1lpDran s;t) rtr(m io4lptelfcias s2umu poo0tltoiictyt mDua(ms ()aeerir3ty1opD  nes;s t2xoxopnydlpe mnciltf 2um(ronu4tpeoiociltlm umu s () etrxrcoadlp eliei;(0teur(m no4omtelivt s)artmump;t0tlx ii3iyd s2rlumonu) rxnio3iodfpt aueslt)tetm(o oydomeelieilt)srtax pno4tpt  oeilslsDrmumo;t)arerxf3tatlmD lnvilt0t2uoim iodomtemnct (fa2raumoou0opxn i3iad s uau p;()trtrif iy1oat ai o;( tetoir ou1aleemnvta(fs2uau ooo0tlto fciltlm ua(vs u)trerircto1oa  an s s0trtm(o3oodapt livi (  Draxmo;o0aeenmfetytlmDuan o u4aexnmocto1fa rlueols0srtm(o3io4lltn fes (  Dtmx  ;t1oetnmociatfm2emnmpnu0aetnio3oo1opD aivi;s texrimpiu1alenlfvsl(f rtmumpot4altoiicildla2umumo;u)arxomfcoadom rlivi s trurxrpny1amtnlfei t)sDrmur oo4aptnio3tas sDea(mp t4tlxrxf to1lmD  ivs;()texoxr no1lp elfcslsfs2ua(m no4ale  fctys a2rl(vo;t0aexoir oodomte nvols  2trio3iodlp  lnctas  2ua( pot0oeeomfciatla emnms u4 ltnirctadomDeau s;s) 2xoirpnudomeemictat s2rrxro;o0oetoiiciysls2elums ()trxnmfctodlm eanvil(0srxmir iodal elfes sfaruaumo;o1tpxomi3iatfa2uanmo;()aexnir oadop e uvils)teurirpnu4lme lncsl( srrmump;u0apxo o3tlsls2rlu s ()tltnir3oatop  aueo;s)s2uoir3oo4llte fes sfarrau  ot0oltn iciasla2elu pn(0 exoxr oy1faDe iei (0sexoxmpoudlm elici sf 2ua(mo;u0ape io3tatfm rl(vp;t4trxrxr3oy1faDranes;t)t2triopou4lpeemnes t arrrx  ;t0alen iciatlm emu s;t4trxomf3to1latrlueslt0 etoimpoo4ll nmivtls srtru ooo4olenmo3ild sDelnmo;()tlxomfcootlpDrlnvi t)trto(opio4lltemiesls) rtr(mpoo0tle  o3ildfs2emnms ()aexoxo3todfmDe u o;(0trumxmpio1alt mfes t  2tr(m ;t1tltnmociysfs rmumo;u4teeoif oo1fpDr i o;( seuo(mpnudoltnlfci t)a2umu pno1alxnioetaslsDeauvo u4aetnxr ia1fm  ln olt) 2xoio3oydop e fes t) Drau oot4tet  o3iltlm uanvont0aeenmf3iy1fp rlneil()sexoir3oydap  mfeils s2tr( p;u1teenioctysfaDuln o;u)tlxrmr3ootoa raiei;s) ruoxo3nodam nlfcsasf 2urx pnt4aexo fctasfaDrlu o;u0tlerxf oodomDr i sl(0 rtr(rpiy1olenmnctat a2uru  ;u1aptn fciasfs em(vo;t)altoxr tydopD lnvi;(0s2xriopoydlpeelics s)sDtax  ;t4aexomo3iytfa2ra(vpnt)treoxo ta1oa rlivslt srxrirpiudoptnmnvsat aDtru  ;u0tlt  ociasfm uanvs;u4trtoif3iytlat ai o;() 2uo(mpoy4opt  fcsls)s2rm(  ;o0tlx mieiad a2emu pnu) eenxr3iatfptraiei ( t2xr(rpoodlmt mnciatfaDtr(mpnt4aetn octad sDuluvpnt4arxoxocoodfaDr ivi (0srxmiopnu1lpee icsa()srumxrp;o4opt  ociysfaDra(msn(0 rtoxfctodfat lneslt0 rtrio3nudlm  mivslsfsrua(ronu1opto ietatlmDumuvpnt0 rerif iytlaDrlies;s0 rtr(o iydome mivil() rrr(ront0oet mi3tls m2um( pnu4tleoxr tatfmtr n ol()teuoxopny1lmtemicilt)aDtmxrpnt4tpenio3tldfm rmn p (4tleomr3oadlpD lu s s0sexo(o3oodapeelieilt arrrx pou0ale mfctyt aDem(mpn(4 rtnmociydlatran s t0sruoxo3no1openmivilsfsrrmumoou1tlx iociytfsDul(mp (4 exoir iatlp   uei s  exr(m3oo4apen ivtas)sDuaurp;t1aexoif3iyd m2emnmo;t)artnmociy1fpDraivsls0 eurxr3oodalt lfci (  2rax pou1tleoifctyslaDrauvo;u4alxoxo3ia1laDraieo s  eur(r nudamen fct s)s2ua(r nu1optoifeiysls2eluvp u4trxrircoydlpDrluvi (0sexrxr iy4alen ivslt  2rax p;t0olxnioctlslm2uln sn(4 ltnmf tydlp elieo t)teumir oo1altnmfet s)aDum(r ;u0oeeomo3iasfs el(vs t4 rxrio3oy1oatr n o;t) eum(o nydopenmfcsas aDum(r ;u1ale  i3iat aDrl(mo;u)trtrxrctatlm   i o;s)tetmxo nudop e fct s)a2tmu ooo1tltnmi3ilsfs eaums;u4altrmf3ia1oate n s;( tetoir3nu1lleemfvtat) Drmur oo1tlx ifeiltls el( p;t) eeoxr tytla eaivils)trxoim ny4op   ics t  Dtm(r oo4opx if3tat mDelumpnt4 lenxociytfa e ivo;t)truo(m nu1apeemnetat sDur(root4aexo iciydla ulnvs t4 renxf iy1om rlues;(0 2trimpno4alenmfcsl()aDtrxm ou0optomfetldfmDuanvp u)tlxomo ia1lmDraueols trxr(rpny4olte ivslsfarur(r nt1alxn o3iadlm2rln snu0 etnirciadoatr uvs;s sruo(o3no1omtnmfetl(  rtmxr oo0aptnmfctldla2ra(vs u)aexrmo3todfpDe iei;s) 2tmir oo1alenlnctl(fa2rm( pnt4aetn fetadla uanmonu) eerio3iadfmDranvols0 2xmiopiudomenlieiat)s2rm(monu0ape micias m2um(mo;(4alermr to1fm rlnes;t)trurirpoy4op e fvilsfarrmu pot1tpxnmoeilslm2el(monu0aetrxrcoodop eai ils)sexrxm iudal  lnvs tfs2umu p;u1tpto ietatlmDumu pn(4 etnxfctotlp   nvs s0 2urxr3oudlmtnlivslt)sDrrx ont1olenii3tltfm uanmo;()altrxr3oa1laDe nesl()t2xoimpio1alt mfcils) 2rm(m nt1texnmoeildlsDrlnms;() lenio3tytfmDrluvo;s0sruo(m3ou1ll   fviltf rtau  oo4olt  oeilt sDemnvs;t4tltrmr3oodoa r nvi;()s2tmir oo1ome lnei tfa2um(rpot1opxo f3tytfm um( s;t0 ltomrciytfaDr ueols0tetrxr3oo1lltnmfci sf 2rmx pot4optomfctytfs emuvo u)teerxf iydlptrli i s)t2uoxrpiu1lptnlivi s srtrx pno1tpe mfctlsfm ea(msnu)aexrmr3ta1lmDrln i;s)teumxr oy1lpen fcias a2ta(m ;u4tlxn fctyt m2ulump u4 lxomf to1lpDr ieo;(0 etm(m nu4lpt  netas s2trurp;o0olx mo3ildlsDem(vs ()altrxfciy1latranvils)s2to(r3no4optelfvsat)aruaxmo;o4tlxoioeiltfmDrm(vo;t0 rxrio iodoateln s;( trumim3iu1apt  ncs sf Drruronu1tpt mictytfm2elnvpnt0teenifciytfmtrluesls)s2trxr ny1lm  lnes t  rur( pot1aex iociltfs2umuvont4 eerxfcootfa   neo s)setr(m3oy4alenmivtlt) 2tm(rpnu0tee mo3tatla ua(vs u)arenxociadomtrluei ()t2xrir3nudlpenmict sfa2trumo;t4tlx  ociytls2rlnmont) rxrxo oo1fptr i o (0 2umim3oydoptnmictl(  Dtau  ou4tlenmf3iatls2emuvp;(4 lxnirciytfpteaues;s  exoxmpoy4am nlneil(f 2ua( oot0tpto oetas aDua(mo;(4arenmfcto1lm e uvsl()texmxrpoo1am  mictat)aDumxm no1aptnioeild aDuln pnt4texnmr tatfmtrlnes (0seuo(o ny1al nmicsa( aDtaum nt1aeenmoeildlsDelnmpnu4 lenmo iotopD lieols)s2to(mpnu1opt lies s)arra(rooo1opxnii3ilsfm2uauvp;(0 rermo3iy1la e nvil()srtoxr io4apenlncils arrr(ro;o0altoioeiasfsDumu p;t0teenxrciotfpDeaies;s0 etrir3iu1ap emicil()a2rau  ot0texnifctys s2eanvp;u0 reoircoo1optraieo t)teum(o nydlleelfvi s srur(mpou0tltnifeiyd a rmumo;(4tltomrciy1lmtr uei (  rtrim nudlm emnvia(  rtru ont4olt  ieiytfm2uau p;u0arxrxfcoytlmt anvs t0srtrimpny1llte nctlt) Dtr(m ou1tlxoif3tldfm2eluvp u4trxrir tadlp rln il()srtmio io4apenmnciltf 2umx p;u1aptn iciyt s elu p t)artrio iadlmDelieo t)trxrxm3io1olte ies t sDrmxmpou0oexnmo3tatfs ul(msn(0arxrmo oa1fa  lueo;s)sexm(rpiy4lmte neia(  rrrumo;t4apxn i3ias s emuvo;u4aexrxocto1lateanei s)setoir3nodap elicil( aDtrxrono0aleoif3ilt aDuauvsnu0 etoif oadfa r ieo;s0srumxrpoo1ome  iesls s2uau p;o4tetoif3ilslm uauvo;u) rerir3ty1late ieo ()s2xoxo3ny1oltelfctasfa2umum ;t1oex  f3iydfm ea(ms;u0 etnmf3ty1fpD aivslt)trto(r3io1lmtnmfcsl(f rua(ro;o0aetniiciyslm2rl(vo ()tlerxo3oodlm rln i (0 etoxm oy4amtelfet ()aDrrx oou1tle io3iydlaDel(mpnu0 eenxo3oytlpD  uvi;t0 2toxm3iudlmtemivt t  Draxm ;u0aee moeias s2uauvs;(4aleoif3ootfptrlivilt t2xrio oydale  icia(  2urumont4tptniocild a rlumo u4texnircootlm ranvs (0t2umim nydlmtelnesat)sDtrxronu0tex  i3tydlsDrluvpnu)tlxnmrctodfaDe nes;s  eur(r nudopte fvtls  rtax  ;t0ope mo3iydls ranmp;u0tetrxr3todlmDr ivo t sexoio ny4al   ictasfartmxront4aleoifeiat m rauvsnt0 lxoxo3totopDelies s teto(o ny4lle miesat srurumpot0oetniietad s em(vp u4altrif3oodfatr ivolt) 2tm(o nu1ale mfvta() rrau  ot0tlxo f3tld mDra(vs t)treomo ty1lmD aivs (0sruoio3oy1om elnvilt)s2tmxmonu4oetnmocild m2elnvp u0artrmrciotoaD lu ilt) 2xo(rpoo1ope lictls)sDrmu oou1optnmictls sDrm(msn() ltoir iadlpt lnei;()s2xrxo ou1lptnlietls)s2urx pno0apxniictyd m umu snt0 lxnirctydfmtr nvs;(0s2ur(r3no1olen ncs tf 2um( pot0tpenii3iltla elu s;(4 lenmo tytfaDr u ils texoimpoydll e ieils)a2um(m nt1opxoiictlsfm ua(vp u0 rtrifcio1om ean s s) eurxo3nydomt livi sfs2rmurooo4tpt moeiasls ea(mo;()trenxr3iytoat  ues;s0t2tmxo3no1aptnlfvs () rumu p;o1oexoii3ilt sDrmnms t)trxrxf3ia1omteluvo t texrxopiu1apenlivtl( sDurx pnu1oltnmictyd aDulumont4treomo oy1fmD aneol(0 rumim nu1olee fvilt) rtr(m ;o0opx  ociyd m ranvpn()alermrcoo1la  lies (0texmxmpoodop  licsas)a2tmum no4texo ociatla em( on(4aexrxfcoy1lmt ln s;t t2tm(m nu1omen fet t)aDumur nt4tpeniictat s eanvp;()trtnxo3to1lpDrli ilt  rxmxm3nudope  nvt tfaDtax  ;t0optoioetltlaDra(msnt0 reoxf iodopt aiei;t0t2xo(mpiodam nlnci t a2tr(  ;o1apx  i3iat s2rlu pnt) eeomf3tydfaDran i t tetrio nodopeemiesa() rrr( pot4tlenmfciasls uluvo;() exniocio1fptrli sl()trxmxrpoo4ol eliviasf rumxm no4tpe mi3iytfm rlumo t4altnmfcoydlmD aivo (0setrxmpou4al e fvia(f Drr(m ;o4apto ociyt aDra(mont0aeenmfcoadlptrau ols0texo(opoudopte fcs ( sDrruront4tlxnmieilt s emnvp;t) ltrif3ta1latelivslt) 2tmxr nodalt  ici t artr(  no4alx  oetad s eanvs;u4aeenmr3tadfm  aivi t)t2tm(m3no4ap nlivt (  Dtrx pno0apeoiieiys mDemn o;u4tltnxo oa1fpDe n i s0truo(r3iy1ameelnctl( artau p;t1tlenmoctat s2rmu s;(0alxomociatlatr ivi s0 2urxo3io4olee fesltfsrtau ono1aleo icias a2ranms;t)tetomo3ty1fa r ueslt) eurim3iu4alt lfvi (f 2rmuro;o1aetniociys s2ul( ont) lxnxo ia1la   ueo;( s2uo(r3oy4al emnei ( a2tmxront0tptnmi3tadlmDua(von(0arxoxf totfaDean sl() ruo(o3ny4ale  nctlt)sDumx poo0alxn ociysla2eauvs u)trtrmf iytopD lnvsl( seur(mpiudll  lfetlt sDrr(m no1oexo fciysfm2rlnvo t)trxnir3tytlpD livsls) exr(m3nodopen ictls  2trx p;t4alt mfcild aDua( snt4aeermocto1fm eanvo s srtmxrpnydop nlfvtl()s2um(m no4apxo iciysfs umn o;(4artoifcoy1lmt  i sl(  rurir3ou1om   nvsasfaDraxrp;u1oex  iciyt m2umn s;u0artoxo oadfmtrlnvilt0teurxo oy1aptnmnetl(  2rr(moot1teto feiad aDrm(ms;u0 lxrircootlmtrauvsls0 2uoiopiydaltnmiciltfaDtmxmooo0oltnif3iysla2rlnmsn(0 rtoxfciotoaD anei;s texrxo3no4llee ici (  rrrx  ;o0oleomoetatls emuvp;u) ltnio oa1oaDeaivsl() rtoimpnu1lp e fct sf rurumo;u0aex  fetltla rm( s u4 rtnxr3oadomDeaies t trumxr3oudamtemivslt)sDraxm ;o0oeeo feildfa uanvo t4tlenio ty1lpt livs ()s2xr(m3ou1open ncsltf 2tr(rpoo1tpx moeilsfs ea(mo;(0trtnxf3tydop eli o s)tetoxrpoo1lltemfciat artaxmo;o4tlenmfetadls um(von()altrxf3oydlaD lnvs;(  etoxm3iu4lpe lneia(fsrrm(m nu1apenmiciytlm2ulumo;()alxnxf3iodlaDe n ils)seuoxo3oo4apee ieilt)s2rax  ;u4optoiietadfa ua(mpnt)alxrif oy1fptrlu slt0trxoim no4op   nci s) Dur(moou1oex  iciydla ulu snu0aexoir3tydfaD lu slt sexo(o3iydal n ict t sDum( ont4opt ii3ils s2rm( onu0 leoio iatfa rlnvs (0 2xrio oodop emfei sfs2rmu  ;u0alxnmociytlm2umuvs t0tltnio iodoat luei;(  rtrxo oydolen ictl(fa2raxm nu4apxnio3tadfs ranmsnt4teenxf3iydoaDr nvo;t0t2xmxr3no1opee neilsf 2rmx p;o0tlxnioctls a rmuvsnu4 renmfctodlp eln ol( seurir iodlmt mivta(fs2tmxrp;o1tetomfeild s2ra(vs;(0 etomocoa1lptrluvi;s)sruriopnu1al e ivsat)aDrau oou0apxomocilsfsDuanvo () ltnxo oa1lpt lnvi s) etmxo3no4aptnmfesl()srrmxrpou0tpxnio3tytls rm( p;u) rxrir3ta1opDelues (0 2xo(m3ou1omeemfei t a2raum ;u4optnmf3ilsla2eanvsn()trtnxo3ootoatran s ( trxoir nu1am e fvia()artmxrpou4tetn oetltfs2rln o u4treomr3totfp r ivo (0 2xoiopnu4lp nlnviat)aDumump;t1teeoioeiys mDrmnvsn()teerxr iotfate ies;t0srtrimpio4amenlfesas  Drm(ro;u4open fciasls2rl( p (4tleomo3io1faDrauvols  exmio3oudlleemnci s aDra( pnu0apenifeiatfs rmu pn()tlenif oy1om eai o;s  2xrim io4apeemnes t  Dtaxmono0opxo f3iatlm2el(vs;t0altoxr3iadfmteauei;t) etoio3oo1op nmivtl() rtax p;u1oltoiictys s2rlnvp;(4 lenio to1faDelnesls srxr(mpny4ap n ncsa() 2urxr nt4tetnio3tyt aDumu pn()arerxfciy1laDeluvolt  rtr(r iu4op   ivs s  Durxr ;t0olx mfetyd s2el(vp;(4trxrirctodlmtrliei s0 rtrxr no4ome  icia(  rrru o;o4ape mfctydfmDulumo t4 rxrxf iadfp  li il()s2xrio oy1opte ivi ()srumuro;t4opx  i3ilt a raumpnu4 eeomo3iadfatrai o s)teurir nydaptemncsa(fsDrrum ;u0tpeo iciadls uaums;()trenircia1fptr u ilt0sexoio iu1lpeeliciasf rtmur ;t1open f3ildfm ulumon(0aeenxf oydfp raiesls trxo(o iodap   icia()sDrmumpnt4oltnmo3iydfm rmn p;(0 rtrxocto1fp rau il()teto(o ou4lltn fei (f Drmur ;o0tee iietlsla uan snu4trxrir iatfmtraivo t0trxmxrpiudlptnlnesat)a2rru pot4aeeomociytlmDumums u4texrxr ta1lmDrlnes;()seuo(o3oy1apt lieias  Durx  oo0tlx  feiytla ranmo (0arxoif3oadfp rlnvs t) rtrxr nu4lm n ict t  2uru oot1apxoif3iyt a2em(vo;t) ltoxf todlmte uvi;s) eumirpoo4oltnliet s) 2urxrp;o0oeenii3iat aDranmo t4 rermf3ootlaDr nvol( seurxo nu1omeemietl() 2rm(m ou1tpenmfetld s em( snu4tltnir ta1latr ueil()t2trimpou4ol nlfeia( a2rru  no1ope mfetadlmDrluvo (0 exnmr3oo1oa raieo (0 rxmiopiu1optn fcs t)srrm(moot0texomoctad s uaumo u4trtnir3iotomtr ivol(0trtr(m iydlptn iet tfa2tau pot4opxnmieildfsDeluvp;(0 ltnmocia1lateln o (  etrxr iodam nlici ( a2uaxmp;u0oeeo octyt a2ra(vont4 ltnir3oydop ranei t)t2urxo ny1lmtelnesas) 2ta(ro;o4alt iietytla2eanvs;u4trtrxfciydfa  anes s0srtr(o oo1apee ies t)sDtrur no4alxnmf3iadla rauvsnt4arxnif3ia1laDeaneo;s) etmir oodlmt livtls)a2raxm ;t0alxn oeiysla2uaump t0 ltoir oatfp e n o;t0setrir ny1lme lfcslsfaDrrxmpoo1aptnmfetadfsDeaump;u4aexnmf3tadoateai slt  rxrimpou1lpenliei t sDtmum ;o4tlx moeiat a rl( p (4 etrmf io1fmt  uvols s2trio iudamenmnctl(f rrrx pot4oetniieiyd sDul(mo;(4trenxf iy1optrai sl( teumir ny1lm nlicils a2ua(m no1apeomfctltfmDrm(vsnt4tlxoxfctotlmte ivo;t)srxoxr iydolt lnci tfs2umump;o0tpeomictadfsDel(vs;t)trxomo3oydoa ean s;s texrxm3ny1lmte fvsls)sDrrumpno4tlxniicilsfa2eln p;(0 lenircty1fmD aueol()s2um(mpnu4olenmnetls)arraxm ;t1optniieiad aDulnms t0 exrxf3oytomDe nvol() 2xr(o oy1altemnvt t)a2rrxrpnt4aetnio3ilt a ea(vo;t)tlxoifctydlm e neo s)sruo(r iudop emnvtasfa2umx poo1aexoio3tlt mDumu o;(4aeeomo io1oa   nvsls setoim iudoltnlfeilsf rrau pou1apenioeiasls2eauvs;t)aeeomrciatlm r i sl( trur(opio4ole lfesat srrr(moot4optnmo3ilslmDrmu snt4trenxrcoatoaDran sls0sexr(m3iu4ale mfei t) rtmurp;u1ope  oeiltfm2ulumo t) etnxrcio1opD auesls sexoirpnu1ll elici () 2taxmont1aex mocild sDrmnmp t4arxrifcoa1faD auvi s0s2toxm3oo4lp e neil(farta(r ou4open oetad m2rau pnt4 lenmo3totopDrli ilt0tetm(opiu1lleemnei t aDraxrpnt4teeo oeiyt sDrm( p u) rxomfctatfaD  nvol(0 rxo(o ny4ole mivt s a2uaxm ;o1aleo o3iydfsDemnvs (4alxoioctotfatr nei () eumxrpiodoltemneilt a2rr(rp;u1aptnmi3tadls emu s t) rxnmr ty1lm   uei t0t2xr(opiu4al   ieiat)srtmum nt1olxn fciyd m eauvs t4 lenxo3tadopD luei;(0s2urxm iu4olt lnes (f 2trxrpno0tex  oeiytlmDrmu o (4texomrcoytop eaivo s0tetrxm ou1lptn ncia(f rra(r ;o4olenmietaslm ea(mp;u0tlenxfciy1lpD  nvols  2xoir3iy4am  mici sfsrrm(rpou1opeo o3tasfmDrl( o t0alxrxf iatfpte u slt0texoir3iu4altnmivta(f 2uaxro;t1altomieildla2em(mp;(0trtrio ty1fptr uesls)t2tmir ou4omt lfeiasfs2tauroot0apxnii3tldfm um(mpnu)aeenmr3iadlpDe ieo;()sruo(r nodlle  nvs t  rtru oot4optomictyt mDeluvpnt)aetrxr to1fmt  uvs s0trxrio nodlltnmfcta(f rrm( pot0tlx mictys sDuauvpnt0alenmocia1op   nvs s)sexo(o3iudoptnmnvs s) Drax  ;t0tpt  ociltls ran p;u4tltnio to1lmDe i s;t) 2xoxm ou4om  mivi (fsrtrurp;u0apenmoeiltlm ranmp;t4artnif tadlm eaneo (0 2trimpoy4ale lnvias sDtrxmpou0opxomi3tltfs2ul(vp (0tlxnioctytfmteluvol()t2xrxr3oodlmenmnvsat) rtmx  no4opxnmi3iaslmDul(mp u4tleoifciydfaD  i s s)sexrir oy4aleeliesltf 2rrxmp;o0alx  fctldfs2uau p t)aexomfcoy1opDrauvsl(  rurxo nu1op   neils sDrrxmpnu1tlxomiciltlm ua(ms u) ltomo totfp rai s ()teuo(rpoy4llt  fcs () rtr( oou4apeo ociyt m2rlnms;()tetnir iatoaDr n slt) rxrxr oydolte ivi (fsrta(rp;u4alenifciydlmDeauvs t4aexrxo oy1om eaieo;t) 2xmxo3nudameemivsas s2rrxronu0optnifcilslm emu o;t4teenmf ia1oatr ues;t0teur(m3ou4oleemieta( aruax pou1apto o3tydfmDrlumpnt) lxnifcoytlp eaieo s s2tmiopiu1ll  mnes tfartrurpno1aee  i3iatlmDrm(monu0aeenxoctodfaDe ivo;s0setoxr3nydlpe  fcslsf Duaum nt4oet io3iaslaDel( o;u0tlerxf iodlm elu o t  rurxmpio4al  lncil(f 2rrump;t0opx  ociytfs em(ms;t0texriocoytfmtrauei;s0 2xmxrpnodllenlnvt t) 2tr(r oo4ope io3ildlmDelnms t)areoxr tydlmDrlnvo s) rtmirpiu1llen netltf rum(rooo4opxo feilslsDel(vsn()texrmf3totfmtr ivi s0 exrxo oodll n ivtasfs2ua(mont1aeeo ieiydlsDelnmp u4tltoiociydlpDrluvs;( t2toxm3iudaltn ivt sfarur( onu1alx iiciydlm2elnvo;t0trtoir3oatlmtrai olt0s2trxo oo4omt lnvt t s2um(m ot0tlxomf3iytlsDemu ont4 lxnifcoy1faDraiei;s  eum(o oo1lmt mnvil()aDtrumpot4aeen feiltfs emnvp;u4arenxr3iadfp e u i;t) etoxr nu1ol n fciat)a2rm(mp;u0olxnmfciat a2rl(mo u0arxrxr tadfat aiei s)trxr(opnudol nlietasfartax pnt0oex ii3tld mDum(mp;t0 leoxo3oy1fptrlnvs;t  rxoim3oo1amte ivsa(farta( ont1tltomfeiltlaDuanmo;u4tltnxr3ty1om rlueo;s) rtoxm io4amtnliciltf 2ta(  ;t0ape  i3ild m2rmuvo;t4aetnxo3iadlp   nes;s) rxr(opoodamtnlnctltfs2tmump;u0teeomi3ildlm rl( s (0alxoirctydomDeaivi;t  euoirpiudol n nctas srur(moou1texnifctasfa eauvo;t4 eenxo iy1lm   ivils0s2to(rpoy4amte iviat) Dtr(m oo0oexomfeildlaDuluvs u0trtnmr3ty1fa elnvs ( t2tr(o3iodlmenlfci sfaruax pnu4apenio3ilslm2rm( p;t4 eeoxfctadlmDeaueo;s)t2toxrpny4lm   feta()s2uru pou4apx  o3tydlaDeln p;u0alxoiociy1faDr ivi;t)trtoimpoy4ape mnvt s aDurumooo0oeenmoctadfa2ul(mp (4 etrxrcty1lpte uei;(0trum(mpiudapen ietl()a2uaxmo;t4tlxoio3tydfa rm(vs u4 rtrirciydfa  lnei t) 2umim3oodal elfes (f 2rmu  ou4openmfciadfs2rmumont)treoxo3oodopt livo t  rumirpny4ape  nct sfsDurxmpot1apt ifeiydla2eaumpnu4teeomociodla raivo s0 rurio io4ole livt sfsruax  ;t4optomfeiysfs2rl(vo (0 leomf3iotopteli s s)trumim3oy4am   nvsl(fa2trx  nu0alxnmieildla2el( snu0 rxoxocty1laD an s (0srto(mpio4lleemieta() Duax pou1altoifciltfa2ul(mo;(0trerxo3oatfp elies s  2ur(m3iy4lltnlics t) Dtmump;u0tltoif3tyt sDem(vont0alenmr oytlaD lu s;t0 rtrxo3oy1lpee fcslt  rrax oou1oltnmfeiydls uln pnt0tlxrif3ty1op  au i ()t2tm(o oy1oleemnvilt) Dtmuroot0aptn ieiys s2rlnvs;u) renmf3iodfmDeau ol() 2xoiopoydop   ivtltf rumxroou4tee  ictadfs2umn s;u0arxoxr oo1fmDeaivilt  rumiopiy1om elicsas)aDum(m ;t1teeoio3ils a2rmnvsnu4 lxnir3iotlptraiei;t texrxrpnu4lptnmnetls)a2uaurpot4aet miciatfs umn onu)aexrmfcoadfate n sl(0 2um(r nodame  icilt)aDrrx  ot4oex  i3ildfsDrlnmp;() etrifcia1om   ivils s2xm(m iydam nlics (fartrxr ot0tle io3ilsfm elnmpnu)tleoxrcty1lm eanvi;( srxm(r iodalt lies tfartmuro;u4aptnifcild s ran s;u) rxnmo3iotfaDrli i;() rxo(r oudop  lfct ()s2trum ;t4tptnmociadlaDuau s u4 rtnmociy1fmD lues;t0t2xrirpiodlpeelnvta(f 2rmxr nu0olxnio3tatfaDulu p;u4 exrir3tytla  auei;s srtm(rpno1am nmivtas)a2uau p;o4tpen o3tls s2em(vs;u)teeoxociatopDr nvolt0trxmio3io1al n fvt sfsDraxmp;u1aex  o3iasls2umnvo;u)tlxoxo3iydlm rlneo (0sexr(o3io4ape mfcs s)sDumum ot0apxn o3tadfa emums;(0teerio3ia1oaDrlu i;t0trxr(mpiu4omt livilt)arum(rp;t1tleoiieilsfa rm(vo;u) lxnifciadfmDraies;()tetm(mpiu4aptnlfvi sf Dtaxmpoo1tlxn f3ild sDrlnvs;t0tltnio3iadfpt luvo t) ruo(opnu4ol  licsl(f rtaurono1aeenio3ilsfm2raumpn()trenifctatfa eaivo t)srxmxr nu1lleelncsl(faDtmx onu1olxomi3tldfsDel(vp;t0 rtoxf3tydfmD livs ()s2to(r3no1am e fcta(fa2ra(rpou1oexn feiadls emuvs;()tlxnxo3ty1lateai sl(0 rurxo3iu4lp n fctas)srrru oou0tptomiciyd a ra(mo;t)aleriociydlptean i;t texmir3nydlle  nes ()srumu p;t1oeenmfctldfm em(mo ()teenmrcoadfm eli s s)srto(o3iu1ole mnes tfsrraump;o4tetn fctad m elu p t0artnxf oatomtr ueo;(0 rto(mpoo1aptelivtls  rraumpou4alt io3tydfs umn s;u) lxrxfcia1lateai slt srxrio oodoltn nes (  2rr(ro;o0open i3ild s2elu p t) eeoir3oytfmD  ieo;s  2toiopou1olte ncils)a2um(mpou0opx io3tasla el(vpn(0 lxrxo3ty1fp raivs ()srto(m nudomenmfvtltf Dta(moou0oeto fciys s2elumsnt) reriocta1omt  i i;()sexrirpiu4lme lneilt)arurum no4teen i3iytfaDuluvo;(0 etomrctotomteau ols t2to(opoydol n ncta()s2raxm oo4oetnifeiyd a2eauvo t0aeerio3totfat  i o t teto(r3iy1ale miciat  2rax  nt1oeeo ociysls ulums;t0 ltnmf ootlmD anvs t0 2umxr ny1altn fvslt a2tmxmpno0opt iociatfaDemnmo;u0alxoif3oytla   ivolt0 exo(rpiu1ll n ivil(fsDraumpoo1altnmfctyslm2el(vo (0artoiocio1laDelnvi;s  rtr(mpoo1ol  lfvsas)sDuaumoot1apx  oetysla eln p t4 eerirctadlat  i i;t)trtmxo nu1amt  fvta( sDrrx  ;u0alt mocias a elnms u4 rtnio3tytoat  uesls srxoxmpoodap   nvils aDtrum ;o0opeo ocildfa umuvs u)arxnxoctydomteluei;t t2tr(opio4lm elivt t sDumurp;t4olxoiictyt m ul( pn(4artoxocoa1lmDeanvi s) 2xm(m3no4lmenlnei t srrmur ;o1opxnio3iatfs2rmnmp;u0texrmr oytfmDrau slt)trtrim3ou4lptemivtl( sDrmump;o4oet mi3tltfa eaump;t) rtoir tydopte neils s2umxrpnydaptelfesasfarrm(mo;t4aee  i3ildls eluvo;()arxoio3totoa eauvi;() 2xmxrpio1lp e ivtls  Dtr( ooo4oee  ictydlsDuluvont0aexnif iatoptrlivi;s)s2toirpiodlm nmfctat arrrxm ou4olxo ietydfmDuln s;u)aetrxrcootlmtranesl( srxrio3nydlmee fcia(fs2ta(r nu1apxnmfcilsls2ra(vs;(4tltnxf oytlpD lu s s) etmio oo1lme mietasfs2tm(r ou0aptnmfcias a ra( o;t0 rermo iotfpD  nvi () etmxr3iydlptelictas  Durumpou0aleomocilslm elu o;u4 eenircoytop rluvo;s0 2xmir oudapt  nci t) 2raumpou4tltoii3iyt m2ulu pn(4alxoxrcoatom rlnvi;( truoir ny1ap e ncsat)srrru oou0opxnmiciysla2emu p;u)arenio3tydlm eauvols trxr(m iudol nlnet ()s2um(rpou1aexoif3iydlaDrmuvo u0 reoio3tydla rluesl( t2um(o nudll nlivilt sruaxmono1olx iieiadfsDrmnmont4aeenxfcoadfm rlivs s0 eurim oy4al  mies () Duru  nt1tlxnioctlt s eanmpnu0aexnxfcia1la e u olt  2xrio3io4optemnvi s srrr(  oo1aetn oeiydlm2rluvs (4tleoxo iydlptrlivol(0t2trim no1om  lnctasfs2rau o;o4oleoio3iys aDeau s;(4alxnmf3iotfmtraneo;(  rum(opiudlm  lnvi ( sDrmum oo4olxo oetyt sDeanvp;u) eeoxo iodopDe ivi s  2uoxopoo4aleemivias) rtm(r nu0apeomictas s el( o u4trtrmo oydla rlivilt truoxmpiu4opeelieslt)aDta(m nu4alx ii3iadlaDumump u) rxnxf3io1om ean sls0sruoir iydomeemnctas) rrmu p;t0tlto iciasfs2em(vo t0 ltnir3oodlaDeln i;(0srtmiopoydlptemiesat) 2uauroou4tlxoioetasfs2uau s u0tltoxf ty1lpt an il()tetmimpio1lltnlnct s) 2umuronu0opxnio3ias s uanvp;(4aexomfcto1opteauvo;s0trxrirpiodape mfei t artrxmono0tlxnifciys m uanms t)texrxfciadfaD anvi;s)tetm(mpiu1omtemieils  2urxmp;o1oet mf3tysfaDel(ms;t4aeeomrcoo1lp rlnvols)t2uoxrpiodlm n ict t srtr(r oo0alxomieilt a eanms u) ltrircootfmD livol( trxmxrpno1apenlictatfaDrmumpnu4olt mictlsfa emnms t4trxoxr3oatomteauvols truo(r ou1amt lici (fsrur(rp;t4aetn oeiysla2rluvpnu4areoxrctotlm eaueol()trtmir oo4omtnmivi ( s2tmu pnu4aeeomfeildlsDul(mpn()trxomr totfaD an s;t) 2uo(r3iu4am e fvi (  ruaurpno4tltoifciytfa uln pnt4altomo3ta1fa ran ols0 euoxm3ou1amenmfetatf Drru o;t0texoii3tld mDrm(vpn(0teeoircto1lmte ivi 
\ No newline at end of file
@@ -0,0 +1 @@
+nvslt0setoio ou1ale mictlsfa2rmxrp;t0opxnifciat m2ul( onu4 lxrifcia1omteln o s) 2to(r3nu1lmtelivtl() Dumxr ou0tpeo o3ilt a2umuvs;u)texrmo3todlate u sl() 2xoio3oy1op   fes (fartm( ono0apenmociysfs umums;u4texrxf totomtrluvils)tetr(rpnu1ol nmfcsl( aDuaurpou4aee mo3iydfm um(mon(4aeeoif3tatopDrln s;( setoxmpoodlmtnlnetat  2ra(moot4aptomfciadfsDuau o;u) lxnxocoo1fp raues;s)seumxm3io1ameemfci ()artmxmp;u0oexomociys s2uln ont4tltoxocoo1lpDe ivi s0 exmiopno1lm elfctlt s2urxrooo4aexomfctydfm umuvs u4aexrif iytopDelu o t0 eumxr3ny1optnmfctl(f Dta(  nu0alt mf3iat mDrlnmont) leomo3iadla  lieilt  exm(mpiu4ol emfcs t)arurumoot1tetn f3tld mDeluvpnt4altomf oo1op r ivs (0teurxm3oodol nmies sfsrrmx p;u4oet ifeiadlmDrm(vsn() rtnxf3oa1omDeluvslt  etr(mpno4apeemictatfa2rrx  oo4tetoio3iasfaDrlums t4aetomr3tatfm e nei (0truo(o3ny4lp  mfesat arur(  nu0apen ictld s2rlnvp;u) eenmf3iadfateln o;(  ruoirpiu1omen fvi sfs2ururo;o4aex io3iyslsDem(vont)arenmf iodlaDranvsls0t2uo(o3oo4omenmncsasf rra( onu0aptoiictlsla elump;(4 exrmrctydoaDelu s;t)srur(o3iy1altelicsas  2tm(rono0tle mietlsls ea( snt) lenir oadfp rlnvolt)teurir3nu1ape  fci s  ruau  ;t0apx iieiydfs2emu pn()alxnmocto1fmD  nvol()srumxmpou4om  mfvil()aDrmxm no0alx mi3ilsls2el(vs;() eenif3ootlaD aues (0trtrio nydam emfeiat a2tru pou4apeo ieilslaDeanmon() ltrxo3iadfpD  u il( t2tmxo3iodllt  ivilt) 2rm(mont4oexoiiciad a2ea(vonu) exrmo3oodlm elnvsl(0teuoim3ou1lmt  ncslsfs2tmum ;o1tptnmfctlsfm rmn s;u4tlxoxf3iydfpt liesl(0 2xoxrpiodlle mfvil(fs2tm(rp;o4tptn f3ilt a2rmnmp;u) lerio3tydlaD aieilt)t2xo(m3iodalt mici s  Dtmxr oo1opto ieiltfaDrm( ont)tetoif oo1op r uvs ()t2trxrpnodamee ncsat)s2rax  ;o0apt io3ildls ra(mp u4alxoxr oadlp  anvilt) 2xm(o3oo4lpen ietls arumurpoo0aee mieilt a2ua(vsnt0trtrif iatoaDe neols setm(r nydam n ictlsf 2taurpot4olt  iciyslmDumn snt0 lxnmf iy1opDr i o s  rxm(r ny1ame  ieils aDta(mpnt1tlenmf3tad s2rluvp;u0arenif ootlmDrln slt0 etoxr ny4al  mfeslsfs2tr(r ;o0oeeomieildlm2ul( s;u4 ltomocto1fat luvi;s0tetrxo3iu1al  mies ( srua(mo;o0texniiciat mDemumpnt0 rermr iodomDeluvolt trxr(opiudaltnlncs t aDtaum nt1olxnioctadfs2em(vp u0alenmr oy1lmteauei;(  2xoiopiu4al n ics t  Durump;t0altnio3ildfaDrau p (4tlxnif oytomDeaues () rtoir oudam  mfvil(  rrru o;o0aex iictatlsDrluvpnt4aetoifcoo1lmDeaivi ( teuoir3iy4ap emncias srtrx p;t1tlto f3ils a2umuvo u0 etoio3oo1fp e ivo s) 2umim3oy4am emnci (fa2tr( poo1oeeoii3ils aDeln sn()alerir io1oat lnvo s) exoiopoydamtnmici (  2raxmo;t4opeo fetydfa rau p;u0arerxf3ia1lat lnei;s)srxrimpoy4al nlfcsl(  rrmuronu0aeeo ociys aDelnvo u)tltnxo iotomDelnes;t)t2umimpoo4lp nlnvs ()sruru o;t4ape moeiyd s2eanmp u4 rtnio oytfmD aivs (  2um(mpiudom  mfcil(  rururonu4apen feiasla2rmn pnu4 renio3iytlp  aneslt teurir3oo1aptnmneta(fartmxmp;u0tpx ioctlt m ean sn()aeerxr3ty1oa  lneol()texrio3nodom nlies s)a2rrx pot1apeomfciyt mDua(vo;u4tetoxo oo1latrlneo ()srto(r no4optn ivt tfs2raxmp;o4olt  feiat mDua(mp (0 ltnmfctydfmDrln sls texm(m3oo1ame mivi s sDtrurono0olto o3ildla uln pnt0trenxr3to1om eaivi;t)setmim oy1oltnmfetlt  2ra(mpoo4apt io3ilsfaDrau pnu4 rtnmf3iatfptelnvslt t2xmim3oo4am emfeta()s2rrx ont1tpt mf3iatla rm(mo t)trxrxr iotoat ln i;( teumim iodlmtnlfcsltf 2tmxmo;t1tpeoifciatfm2ua(monu)alerif3to1fp eaivs ()trxmio oo4aleeliesls) Dtmxr oo1tpx  ieiltfs2ulump;()teenmr3iytopD aivslt)seuo(m3iodlleelfcsat) rraum ;u4apto oetyt aDemnmsn() lerxocoo1fpDe nvo t  2tr(r3iudole lnvslt srurxro;t0teen feild s rau o (0aetrxf3oy1omtranei;t truoim3nu1lmee nvs ( s2tm(mo;o1aptnii3ias aDemuvpn() etoxfcio1oat  u sls) euoiopiu4ll emietasf rtru o;o0olxnmi3iatlm2raump u4aexnmfctadlmDr ues (0s2xr(r3ou1omenlfctls)sDua(rpno1aexnif3ilt s2rm(mo (0alxomo iytom r uvs t0seuoim3no1apte fctl() 2uaxm nu1oleo ociydls2ul(vp;u0texnifcoa1om eanvol( t2xoim ou1apee fct s  Dur(r oo1opxoioeiydfs eln snu4trxrio oytfmteauei ()trto(mpno1lp  lfei s) Dta(  nt0teeoifetat m ranmpnu4 rtnxr3oadopDeln i;()sruoxopoy1lp nmiciatfsDumuroot0tltoii3tysls rl( p u0arxoir3iatopt au s;s trtrxm io4al  lnes t artrurpnt1tpe iociydlm2ua(ms;t4altrioctadlmD lu s;t  eumxr3iodom   ncslt s2rr(rono4tle mfcildla2ua(vp t4 rxnmo3tytop  auvo () rxmxr nodomenmfcilt) 2umuro;t1altnifctatfm2ul( p;t0 reomf3iy1fpDe ieo;t  eurir ou4ll nlfvils)srrmxm ot0apx mfciltfaDrmn pnt)teenio3io1lp  livo;s0srtr(m3nu1lltelnes tf Dua(mooo4aexnioeiat m ra(mpnt4trxnxo oytlpt li o;( s2umxo3oy4amenmfesl(f 2uaxmonu1opx  o3tad aDea(vp;(0altomf3iytfat aneolt srxmxr ou1lle lneias)a2rrur ou4tleo octlsfm2um( ont)altnxoctotopDr n il( trtmim nu1olenlncsat)srrmuroot1oexoifciydfsDumu s t) exnxo todfm r neslt  2xrxrpny1apt mfctat)sDtaxm ;u0altnmociasls2umnvo t4 rerif totlmDe nvsl() rumxopno4ll n icsltfa2truront1oet iociatlaDranms u0arxoxr oadfmD  u i s s2trxrpiudomenmicil(  2rm(mpnu4alxn feildls2el( s;u) ltnxrciatfa  an il()srum(r3oy4ap elfvia( a2um(ronu0tpenii3ils mDel( pnt0arerioctydfpDr uvs;s)setmxm nydamtemnvsa(f 2ta( o;t4tpenio3tls m2el( s;u0treoio oydlmt lnvo s srxr(r oodlp  lfcslt) 2ta(rpnt1tpenmfciatfa eaump;u4 leniociy1fa rlu o;() 2urxmpiudame mnvilt srrm( oot0apen ietldls emnmo t0tltnmoctotfm  aivs;( t2xmim3oy1lp n nvta()sruaxm nu0teeo o3ildla umnvo;t4arxnxociotopt  ieo t  2umxr3oo1lme lncsasf Dtmu ono0oeeomoeiyd m ra(mo;t4tlermf3ootopDeliei;() rxoxopio4lm nmict ( a2ta(rpot1alx iocildfa2uluvo (4tlenmr3tytom  anvi s)s2xmir3nu1lltnlfcias)arrmx  ;u1tpen ietldfs ulumonu4aexnif ty1fmtranvo t)s2toxm ou1omenlieia()s2tax o;t1apenmfeilsfmDra(vo;u4 lxrmrciadom eau sls0tetmir oo1oltn fvslsf 2tmum ou0apxn ieildfaDrmuvs (0altnmr ta1lpDrlnei ( srum(opnu1alt mncsatfsruaxrpnt4oeeoiieiyd a2umuvp;(0 rxomrcoa1fpteaiesls)s2tmxo nodlpen fvtl()s2umxrp;o1tltnioeias a2emumo t4artrmr3oadlmDelneo () 2tmir3ou4opeemfvils) Dta(mpno0opto oeils aDuluvsnu0tltoir todfp eanvo;s) eumxr iydom nlnciltfsrrm(mpou4aetnmfcildfa emn o t) leoxr to1fmD livi;()t2xr(mpno4lle mfci s  rtmx p;u4teenmicilsfa uanvo ()areomfciadfptr ivil() exmxmpno1oltnlicsl()aDrmxm ou4oetniieiat s2rm(mpn()aeeoxrctodlmDe n ils) 2urxopnodlpeelnvi t)aruru ont1oetnif3tltla ua(mp t)altoiociatlateluvs () etmxrpoy1olen ivsa()sruaumoou0oleoio3iysfaDra(vpn(4texoxocia1opDelieo;t s2xrxm3io4amtnlieil( aDtaxmpno0texniieiys aDulump;t)tltoxrcoy1op rluvi t0t2xmim iu4omtnmncsat  Drm(root0ape mfctldfa ra(mo (4areoxfctytfmt li s;s)t2xo(rpnudap nlfet ()arrrx pnu4opx mfcias s el( p;t0 lxnif io1lm  an i ()setrirpiy4amtnlivia( srrmum no4tltn ictydla2umnmp;t)altoxr oadlpteln s;t t2xoio3ou1lpenlivtatfa2rru  no4aeeoio3tyslsDulums;u0 leoxf3tadfpDr uvi;s srtoim iu4ome  ivtltfa2urxrpnt1ape if3ilsls2umnvo;(0tlxrio3iadfaDe uvols0teumxopnu1lpenlfvtas arua(mpno1ope ii3tyslsDeln o;u) lxrxf oytfptelnei;s  eumxr io1ap n ietlsfs2urxrpnu1altnioeiytfa umnmp;t0 rtoirciydlpDraneo t0 2xmxopiu4alenmfei s s2rr( oou0tet mfctldfs2ra(vpn(4areomo3todomDr i i;(0texmirpoo4ll   fvs s aDrmx  no4opeoiociatlmDemnvo ()arxrircoa1fp eai s ( s2xrim oodop  lfct ()artm(r ou0tpxnio3tyt m2rmn snu4 exrif3ty1om eluvsls) eto(opoo4om e nviltf 2umu  ;u4aexoiictysfa um( s;t4 rxoifciadoptrai s;t trurxmpiy4apt  nci (f 2umx onu1apt  o3tydlm2emnmo;(4alxrmf3oydop rli o;s sexoimpno1ope lnvs t) Dtru ooo4apeomi3tad sDul(vp u)alxnmrcoatla e ues;t0 etoimpiudamtnmnesa() rumu oot0tetnmieiadfm2eau p t0 eenirciatfmtrluvs;t)s2umim3ou4op emfvils)aDur(rpnt1tlxnmieiyd mDem( p u0alxrmo tatfa  anvsls0 exmiopnodolt lieils)sDua(  oo1altnmf3iys s2rm(vp;u0arxrmr tydfate nvs (0trtoiopiu1opee ivt t aDtm(r ;u0opx ioctytla rm(ms t4alenxrcoytopDr nei;( seuoimpoudalenmfvta(f 2urxr ;u4tlxnmieiad a2eanmsnt4tlerxf iadfpteauei;( t2ur(opoodame mfcsls s2urur ot1teeomieiyslsDuln s ()tlenmr oatlp elu s;s) ruo(r iydamte nct s s2um(m ou1oeeomictadfm elu s t) etrxr ia1lptraneo ()trto(rpiy4optn feiasfsrur(r ;o1tlen o3tatlm2raumont)arerir oydoa rluvs ()s2tmirpiu1alt  fes (fsDrax pno0optomo3iytfsDum(vo;(4alxoxfcoydfaDeai il() exmirpou4lm elfvs ()s2umumoot4olt mfeiadla emnmo;t4 exrio3totlaDeanvi ()srxoio iu4ale lnvta(f Drm(rpnu4aptnifctad a2umumsnu0arenxf3ootom r uvolt)s2xo(rpiy4lptelfesl(  rumxrpnu4alx mf3iytlm2rmumo;t4treomo3iytfm eli o ()trtm(r no4ame  ici () Dtmurpnt0tpen ocild m2ulnvs ()areoxr3tydfp   neils  etmirpiodope livtls s2ua(mono0oeeo o3tas s2emumonu0trxrmo oy1oa e uvs s  2xrxrpny1amen fvsa()sDtmumoot1opx ii3iytlm2rmuvont)trtrifciadfpD  nvs;(0 2umxrpio1ome  ieilsfsrumxm ;o4oet io3tldla ul( ont) rerxr iytopDeauvo s sexoxr3iy4op n ivsa( sDrr(
\ No newline at end of file
@@ -0,0 +1 @@
+iesl(0srxo(mpoo1lp  mict s sDuau  nu4teto i3ild mDua(vo t0arenxf3ia1oate ies t0sexm(o oo1omtnmfei s)s2tmu  ot0oltomoetldfa2elu p;u)aleoxfcta1lat  n ils) 2to(opnudapte icslsfa2umu o;o0altnifeilt m rln ont4aexnxf3iodlpt auvi;t0t2trxr oudlmtnmnvslt) rurxr ;o4tlxoiictasfs2ran on(4texoifcoodoa eai s;s tetoirpiydlp   fvi t)arrrxmp;t0apxn ocildla2elums;t0trtnxf tydfpte u o;t)srumirpno1al n nvta()sruaumono0aeenmieiadla eluvp u0tlxnmr3iadfpDr uvsl(  2trxo3oydlmt lncsl(fsrumu  ou0apt  feiytfa2ul( o;t)aleomo3tadfpDrau i s0 ruoxm iu4lme  ncsat aruru  ou0olxniieiltfmDrmnmp;() rtrmo oytlp e n s;t t2xoiopio4alee fvtasfs2uaxrpno0opxomfctydlmDel(vs;() reoio3iadomDran ilt0 exoim oy4apt micsas srur(ronu1opeoiiciadfs emuvs;() rerxr ootfmDrluei t) rxo(o iodopt mfvs ( sruau oou4tpt  iciad m rm(mo t) rtrio3iydomDr i olt  2xmir3oudlpeelfesl()srrrx oot0alx ifeilsfa rl(vs;t)alxrmfcta1fptelnvi t)texrxrpio4amtnlivsltfaDtmxr oo4apxn ietysfa2em(vs;u0teeoxr ia1fpt  i slt0 etrir oy4aleemncsat aDuaxr nu4ole  f3tas m rln p ()tlenio oatlaD ai s;s)t2urir3oodopenmivia(fs2raxm oo1tle  fciat a ra(vp;u0arxniocoytfaDe nvilt0trtmxr oudomtemfet t) rra( o;t4tlx  o3iyt s um( pnt)aeerxo3iatla rlieol( sexoiopiu1al nlfetl()aDtr(r nu1aex  fctydfm uaumo t)trxoxfcoodoaD aneil(  2uoir oodapt  fvtl()aDrmur ;o1tetnmfeild s2eaumonu4arermr3iy1fmtr n i t0teuoio3iodllt lfcs ()artrur oo4optn i3ildls2uanvs;()tetoif oytla e u o t0s2tr(o oudaptnmfvsa(f Draxr oo4tlx moctltfsDulnmp t)tleoir oy1opDr ies;( sexmxr3nu1apenlnvsl(f 2ta(r oo1tle  ieiasla rauvp;t)aexnxf iatlpDelu s (0 2xmio3io4ol nmncsls s2um(r ou0teenmoeiyd a elu pnu0trxnmo3oydom rau olt  exmxopiy4lle  fesas)srumurpoo4apx  ieiytfs2uluvsnt0aexrmf3ia1la  ai ilt0 2xmio3oy4llt mietas aDrau p;t1olt mieilsla eanvo;() exnio ootlm  anvi (0 rxo(m no4op  mies s) Duaumpno0aexn oeiyd sDuan pn()altomf3tytlpDrai s t  exo(r3oy4ol emivt s s2rmumonu0olxo ociatfs umu o;()trxnif3iotlpt ln ols0s2uoim nodlpeelfctatfs2rrumonu1apxo ociasfm rm(msnu)tetrxf3ty1opD ln s (  rtrimpiu1ole  nvtl()sDtr(r ;o0aetnmfetadlaDeanmsn()tlxomrcoytop   ueo;t0t2xrim iodomtemfes s sruaxr ou0texomoetat mDua( ont4teenir3iy1op  lu ilt  2urxrpiu4open ivtl(fsDtaumooo1olto ociadla2um(ms t0 renmr oa1fm elnvols0sexm(mpny1olt  fctas aruax pnu4opx ii3iasfm ran p;(4aleoxr oydfa  aneo;t)t2umxopny4op e ivt t sDtmx oot4aeenif3tld m umnvo;u)altrxr ia1op rlnesl() ruoxo3oy4ll e ictatf ruaxm nt0tpxn o3tyt mDeau s;u4altoxr3iytla eluvols0trurxopno1amt lnvt t)aDuau pou0aetomietydfm rlump t4 leoxfcoydom e nesls  rtmim no4llee fvi ()s2rmu p;o1tpto feiadfm uan o u0aeermocto1laD  neo;() rtmio3nydope mietasf 2rmxmo;t1olx moctytfa emnmo t4artrif3iodfaDe ues t t2um(rpiy4aptnmfvtas aDrmxmo;t4opxoiocilt mDrmuvont4tleomoctydlp  anvi;(0sexrio3iodal n ivt sfa2rmxr no4tpe mieias sDumumpn(0tleomocoatlpt aivs;t0 rxr(mpnudll n nvs t)aDur( o;u0apto ieiysfm rm(vs ()altnxo tydopD auei;s0 etrxr3ny4op emict tfsrurumpou4tpxoiieils mDul(vpnu)arxrio3ia1opt aieo;s  rur(mpnodom   fvia( sruaxmpnt0tpeomfeiysfm2rl(vo;t) lenxr3iydfa rln ils truoim3nu4lpt lfcsl()arrrx onu1olx iociaslm uauvon(0teenio ty1faDe u o (  eur(opoo4ome  fctls s2ta(mpou4teen fcilt aDrm(vs u0trtnmo ia1fpte u o;() ruoxm nudlptemfvils  Dra(ro;u0oeen iciasfm ranvsnt4 lerxr todfaDr i ol(0srxrir3ny4lmt mfei s  2taurp;o1tpxoioctyslsDem(vs t0alenxo3tydomteanvils s2xr(o3nodlpenlfes s)sDuaurono4ape  fetadlm ra(vp;(0arxrxo tadomtr nvils trumim iy4lle mnvil( a2rmxmo;t4aeto i3iytfm2ulnmpnt0arxnmf iadomtr nvils) 2xoxo3iu4ape  fvt s)srta(mpnu1aeeoiictadfm2eauvp u4aeenio3iodfaDr nesls setm(mpoy4lleemivs ()a2urxmono1oltnmf3iadlmDrlu snt)aeenif oytlpDeau ols) 2tr(r3ou1al nmiei s)aDtau oot0aptnmocildfa ul( o;u)tetnmo oa1la  an i;()trurim3oy1ol e nvilt) rtrxm ot0oee moeildfa2ea(vs;u4altnifctodlat  ues (0 etrxr oo1apte ivilt) Dtaurpno4tlt ifcilslmDuau o;t) ltoir oodoaDeluvi;()truo(m3oy1lme lnci ( sDurx p;u1tetn o3ils sDemumpnt4trermr3ia1fa ran i (0texoimpiodlltnliesls)s2ur( ooo0apt ifeiaslm eln o t4 lxomr oytfpDranvilt0texmxmpno1lleelneslt)a2trx  ;o4opxn o3ilsfm2rmu pnt4 lenxo oo1la eauvolt0 2umiopoy1olt mfvils a2rax  oo0oet io3iytlsDumu s t0texoio tatlpte uvi;t sexoim oudolen icsasf 2rm(mp;u1alt ii3iytfaDuauvs;u0texnxf3tadfm rlneo;s  rurio oo4alenlnetas) rrrum ;u4alt mietytfm2rluvo (0aexnxociydlate i i;(0trurxm iodamenmict s  rumur ;u1apenmo3tlslm2um(vs;()trxrif tatlmDe u ol() 2uoiopnydameelies s)arur(  nt4aetoii3iltla em(vsnu0 exrio tytomD livs s0teurxrpiy4amen fesat a2ur(mpnt1tptoif3iytlaDrmuvo t4 exnif3oa1fmDrau sl(0t2to(rpou4ll nlnvt (faDururo;t0apxoiieiat s2ua(von(4trtoxr ta1laD  i ilt)teum(m io1ap nmnvilsfarumxmonu1oleoiieiysfm2ra(ms t)aetrxo tydomteauvs ()srurir iodom  lfvias  ruru  nt1opx iiciytfs2el( o u4aetnmf io1omDelu olt0t2tr(r3ou1olt  neias)srra(rp;u0oexo fciad sDeluvp (4arxnxo iydfmDrai o t0s2tmio no4lpe mivsls aDrrxrpnt1aexomf3tltls emnmo ()trxomo totom  auvo;t0truo(r3nudol nlfcs s)sDraxmpnt0tpe  o3iasfa ul(vo ()artnxo3tatfat aneo s0trxm(m3ny4al   fes (fs2uaxro;u1tpx ii3tatfmDul(vs;t0altnxf3ty1op  lnvi;s0t2trxo3oodaltn fet sf 2rmxm oo1oleomi3ilt a2rm(mp u)trtrir3iodlm  auvilt  etoxopnu1aptn nvta(  rua(m ou1aexnio3tas s2rmnms (4trtnif3iy1oatr ivs;t srxmim oy1oltnmies (fartrum ;t4oet ii3tat a emnmo t0tlenio3ootlaD  i olt  exmxopiu4lmenmict tfsDta(m ot4apxn f3iat a eau pnu4 eeoxfciydop  luesl(0 eur(o no4lmtemncsas srtmxrpot1oleomf3iltfa emuvo;u) ltnmr3iytfpDrlivo ( srto(o oydol e ivsatfaDtaurp;u4opto oetltls2raumsnt)texomrcoydlmtr nvilt)trurxr3oydol e fcsa(fa2uaur ;o1alxnmo3iyd sDeaumonu0trxrir oytlpt auvol( s2xrimpiy1om  mfesls aDum( p;o4ape moetadlm ea(mon(0 exnmrctadlaDr n i;s) etmxopio4optelneilsfarrmxronu0optoiictyd sDra(mo;u4alxrio oatop elnvo t0s2toir no1ape mfvils) 2tm( pnu1tpeo ociadlsDrlump u4altnmo3iodlm rliesls0srtoxo3ny4ll  lfei tf Dta(mp;u0olt  fcildfa umn p;u0texrmo3iatfm  auei;()setoxr3nudop e fvs sfsrraxr no1aexn f3ils sDemnmpnt0 renmf3oa1opt liei t0teurimpiy4ap e ietatfaDrau pou1texomi3tltlm2rl(vp t0aeeomr3oodop r uesl()s2umio no4optn fcsl(farururo;o0altniocild aDum(mp;(4tetrmrciatlm rauvs s)sexoxrpnydale lfei sfsDrr( oot4oex mo3iydls rmnvs;() lxoifciodlp e n s t0 etrio iodop nmfvias  Dua(m no1teenmictyslaDuau sn()aexnmrctadfat au sls tetoim3oodap n nctat)aruaxm nt0alxomfetls m2um(mp u)alenio3ta1late u i t)setoim iy1llt mnesl( a2rr( ono4apt  ietyt m2eauvs;()tleoiociatlaDraiei s) ruoxo iu1ope lfvils)a2tr(r ;o4alto f3iatfa uaumont) lxrmr3iatfpD  neilt)s2trxr iu4olee ics s s2urxroou0tlen ietysla2el(vo u0aeenir3totoaD  i i t trxoio3iydom nmnctl(f rtaxm ot1apxnmfeiytfm ulu sn(4tlerxr oytfp raieolt truoiopiu1ol nmics tf 2rm(m nu1olx  fcild s2rl( p (4 leomr ootom rlneo (  rum(opoydameeliviasfs2rrxrpnt0tltnmfeiydfsDemu s u0 etnmf oadlmDe nvsl(0s2xm(r3oy1lptelictat arururo;o1alxnmo3iydla eluvs (4tlxomrctytomte uvo;(0s2xrimpoy1omtnlnetat  Dum(m ;o4tptoiieiadlaDulumon(4aleoifctatomt aneolt seuo(m iu1lpt livils)srtaxro;o0teeomfcilslaDrluvsn(4teeriocoadomt lu o (0 rur(m no1alt  ivta(f Dum(mo;u4alt moetysls2rlnmsnt0aetnmf3ta1oaDe n o ( trurir nydoptn nvs s)srtruroot4opxnmi3ild s emuvon(0aetnif3tytomtr u olt0sexo(o nodlpeemfeia(faDuax  no4tlxn octyd s uaumont4trxrmr3ty1laDrlnei;(  exo(r nu1ap nlnci tfsruaxmpou1apt moeiadfa rmu sn() rxomf3iydoaDr n s s) rto(r oo1ap  lnvsls  2tr(rpnu4aetnmietyd a umumsnu)aexrmr oodfptr neilt0setr(m3iydoltnlnci tf 2tmx  no4alx  fciasfsDua(ms t0arenirctodlm rauvolt)sexo(r3oy4apeelncsa()aDtr(mpno4alto ociysls2emnmo u0 renxo3iadfa e n ilt)sruo(m3nu4lme  nviat  2taxmooo4aeeoif3tltfa rln s;u) lenmr3oytoaDeaieol() 2tm(m nudolee ietasfarraumpno0tltnifctltfa2umumsn()altomrcoy1laDe ueils0t2urxm ou4ape  ietls artmuroou1tlt  f3iasla2elnmo u4aexomr3oydopt  neo ()srtr(r oy1lpt  nvt t sruaxroou4alx  f3tat mDrlumsn(0 rtomf iodlm raivsl()t2toxm iu1opeelnvt tf rua(mp;t1tle mociadfa eluvo;u)teeoioctatfptran o t)trxo(o iudoptelicilsfaDrr(mooo1apxo o3iytfsDel(vs t4 eeomr3iytfa  anei () rxr(mpoydome  fvsa()a2uaum nt1apxnmicilsfmDemnmp;u) leomr oy1oat  ues;(0t2uoxopoudlptemfct t)a2ua(mp;o4aeenmoeias s emnvpnu)trenxf3tytoat  neo t texo(mpiy1am emnei tfaDrm(  ;o0tpx mi3iysfs em(mpnu0arenmrcoo1la   uvils)tetoxmpnodlmeelnctl(  rua(  nu0aexoiieils mDrmump;u) eenif tadfmDr ieo t  rxm(m3no1opt livtls a2tmx pnt0oltomociytfa emu p u)areomf iotfpDrliesls)s2tmimpnydamee nesatf 2tmxmpou4teenmf3iltfaDem(vo t)arxomo ia1omDeanei t)srtmim3nu1altnlfes s sDum( pno4tpxnmfetlsfsDrlnmp;t4 etnio3oy1lmDelu i;s0t2toxo nydamt lfeilsfsruaxrpnu1texomociatfs ra(mont)texoxrciadlpD  ivo;t srtoirpny1op nmfvils  2uax o;o4opto ieiytls2rlumo;(4 rtniocia1oaDeliei;t  etmxo3iudal emnvs (  Durumo;o1tet  oeiltfs emumsnu0altomfcoy1lat au i;t0 rumio iudlltnmfeslsfaDra( ont1tpxoif3iatlm ulu p;(4trerif ty1lateai o t0 2xmir3iodomtn fciltf 2ra(mont1aee mo3ild sDuan snt0 rxrmocoodfpD  nvo;s)teuoxr iudlpe livsasf Drmum nu0aptomocilt aDrl(vpnu4 rtrmo iotfmDeauvo (0seurxrpoydlpen ncslt arrrxrp;u1oltnmf3ias sDean s;(0 lxoxr3to1fptraieo;s0tetrxo3nudol nmivs (faDtmxrp;u4oee mieiatlm2ra( p u0tltrxf oo1la r nvo;s  exrxmpny1om   feiatf 2ta(r oo4tet  feiadla elnmon(4 reoxocoa1fa   uvo;() 2uoirpoydam emiciasfartruroot0oeeomfcildla2uan sn(0 exrio3io1om e ivolt t2tmxo ou1lptnmiesa(f Dum(r ;u1tpen f3tadla eln o;t) exnmr3oa1fmt  uvs t0seuo(m oo1lmt  ncil(fsDtr( pou0teenmociyslaDrmnvp;u)arxomfcto1lp r ueol()sexoxm3no4amtn nctls)a2urxronu1oetniocildfm2rl(mo u0 reriocoo1fmDeanvi;t texr(m oo1ap   fet () Dtmum ou1alto f3tytlm2em( o u)trermoctytlpD  ivo;( trxrim3oydomtn ivslsfa2tm( o;o1aeeo iciadlsDrmump;u0teenxf3oadom rlu i;s0 rumxr no1lm  lieslsfa2taxm ot1alxomo3tys a rmnms;t4texrxf3oo1fm r u sls) ruoir3no1am nlfvtas) 2rmur ot1tlx mo3iadlmDrau pn()aeerirctytom e n olt0tetr(m nodaleemnctatf 2ra(root0teenio3tysfm uanvon(4aleomfcoy1fp e neo;s  rtr(mpio4op elfct t aDtaum ;o1oeto ietydfs rm(vpnu0arxomo3oa1lpte n s s trxrimpnudap nmfctatf Drmuro;o0tlto oeiydla uaums;u0 leoio3oydlmte iesl(  eum(m3iu1olee nvtat a2tauroot1texomoeiltla2rmuvo;t0 exoxr3oo1fatr uei ( teuo(m3nu4alt mnctatf rurxroot1aeen ietyt mDemu p;u0trtomfcoodopt auvs;() rtmxm3iodoptelfeiat  2umxr oo0aee  feiasfa um(vo t0 lermr totopteanvi;s0trxmio3no1am emfvt t)aDrr(moou1tex  f3iadls2em(ms (4trenmr oa1fm e n o;s trxr(mpiy1ape livt t  rrmxm oo4apt mieiad m rlu pnt) ltrio totfp e u il(  etm(r ny4lmen ncsl()artru  nu1apen fciys a eluvo;() exnxrciotlmDeluei (0t2uoirpoydoptemnetl()sDum(ro;u4tpt  i3iadfa2uluvs;t0trtomo oatfpDe uvi;t) 2xr(r3nu1op elfet (fs2rrx  ;o4oeen ictlt a2ul(mo t) lxrxrciadomDrluvs s)srtoir io4al   ncils  rum(  ;u1alenmoctydfmDumn o;(4tetomo ty1lpDr n s t) 2ur(o iu1llte fvt s)srraumoou1tpxniictatfa2ranvp;u4altrirctytlpDean ils) ruoxopno4lp nmicil() 2rrx p;u4olt ifciydfa2rlnvo;(0 lerxfcoy1op   i ol(0seto(r3iu1lmt  fet (farrm(m ;o4teenmoetyd sDuan s;(4altrif3iydfaD liei s)setrxmpoo4am nlfcta( sDumurpnu1aexnmietadfmDelu s (4 lxrio3tadomt lu sl(  2xrirpoydlltnlfvia(fsDra(mp;o4oexoio3tat mDulnmo (4 exomfcty1fpDeliesls)t2trxopny4ll n icsasf rum(  ou4tee  ociaslsDumnmp () rtrxf3oa1omD  uvi ( tetmxo3nodlptemfetlsfsrtax  ;o4alen oetltfs uan onu)trtrxo3iytlmD  ivils0t2xoiopou4lpt lfvsl()sDtrxm ou1oltnmfciysfs2ua(vs;t0trxnxf ta1oateli o t  rtrxrpoydameemncta(fsrtr(mpou1alxomi3tytfa emn on()aleomrctodlp rluvils trumiopiu1al nmnci t) 2tr(ro;u1teto feiytfa2rmnmo;(4 rtomf oy1latrlivo;s  2tr(r3iydopen ivt sf Dumxm ;u1opxoifetydfaDem(vp;t)aetoxr ia1optraivo;t)sexo(rpny4om emfctas srumxmono1apx  f3tas aDrm(mp;t0 eeomrcoo1omteanvs ()setmxo iu4llen fci s  2uaxm nt4opt mf3iltla2uanmp t4tlxnmf iy1fatrai o t0trtoir3iodap   fes ( s2ua( oot1oltnmf3iyd aDuaumon()artrirciy1opDe i s ( s2urxm oy1alen icsa(f Drrumpnu0tlxnii3iyt s ranmo;t)tetoxf3tadfa eaivi;t0 exmimpny4lmte nei t  Dum( ono0altomfciytfs el(vs;()alxoir iytomtr nvsl()s2xm(rpnudom elfvia( arrr(ro;o4oee ioetlt m uau o u4tlxrir iodoa   uvs;(  rum(r oy1alt mnesat) Draumooo0aet  feiytfaDea( on() exoxocoatlp raivi s)srtrir nu4opt lnvt sf 2umxmpnt0tptoio3ias a2ulumo;t4arerirctodopDraivs (0sexriopiydalt  fctls  rtm(rpot1oeeomi3ilt sDulump u)tetrmr3todfpt lu s (  2xo(opoodlm  mncslt sDrmxro;o1tex  oeiltfsDuaums;u0areomf tytlm eai o ()t2xr(r3iu1lm e feslsf ruau o;o4aet iictld aDulnmp ()teermr ootoateauvs;( seur(mpou1al n ivtas)srrmumpou4aee moctltla2ranvont4alxrifcto1laDrlies s0s2trim nudom  mnct sfaDtaxmpno1aexomf3iys m2eluvo;(4trtnio3tatfpDr n s;s0 rto(r3no4olenmfesl(  rtaxmonu0altnmfctasfm uaumon()alerxo3iadlat luvil(  2xmxm iodalen fcsat srur(  ;t1apt  f3tld m emnvs (4tetrxo3ty1fa ean o;()srxo(r3nu1om  lict (fs2umum nt1opx  fetyt s2emn onu4arxniocoodlmDrlnvo (0 etrir3oy4lpt lnes t sDtm(m ot0oexn f3tadls2rlnvo u0 rxoxo3to1lm  aivo s)srtm(m3io1ame mictls  2raxm ;u0apxniociaslaDumumont0artnxfciydomDraiei t0texrxr3oo4alte ivt (fa2raumpou0oeeoiicilslm2rmums t) rtomrcoatfptrlies s0t2xm(o3iu4ameemfct t)srtm( onu4tlx  f3iydfm um(mo (4 lxnmf iatop raiesl() 2xrxrpiu1ope lnvt ( sDraxronu0texn f3ils s2ranmont0 eeoioctodfpDrlivi;t0tetmio3iydop  lnct ()srtaurooo0aptnmi3iltfs2em( p (0tetriociy1opDe uvo;()s2xrim3no4llte nesasfs2ta(rp;t0teeo ieiyd s2umuvpnt)artriociy1lpD  n i;()t2tm(m nodaleelfctls s2umx  ot4tpxnif3ils sDranmonu)areoxrcootom  li ols)s2tm(r3oydop emneil()sDraxmoot0oex moeiyd s2ulums u) eerxf3iydlmtrlu o;s  rurxo3oy4openlics s  2ta(ront1teto oeild aDulumont)altrmoctytopteau ols) etoimpiodlm e ict tfsDrm(r ;o0aetnmo3tat m2ulnvp;(0tetoifcty1lptrlnei;s) rumirpny1lmt micsl(fsDrm(root4olx  f3ias m2umnvp;()aeermr oodfa  auvi;() rxriopnu4llt  iei ( a2rm(r oo4aee mi3iat a rmn p;u)aexrmo to1lmteauesl()trtmimpiodope  fvias a2ua(rp;u0olxnii3iatfmDel(mo t0tltrifciotoaDrau il( sexriopiu4omt  fesat)srra(rpoo1aeen i3ilslaDrm(vs;u4aeeoir3ta1oaDeauesl(  eumirpoudlm elfvsa(  Drmxrpno4alxn o3tltfa2ua(vo (0tetrif tatlmtr ieslt0srtrxm3iy4llt lfvslsfsDtm(r no0tee mfeiytlaDrm(mp;(0 rxoioctydlpteau i s) rur(o3oudlltnlivtat)arur(ro;o4teenmo3tadfmDulnmo;(4teenif ia1omDe i ols)setmirpoydlm nmfes s srtaurp;o4aexnmoetas a ulums (4texrio3iadfmDrlu o;s s2tr(mpoudoltelnvs ()srtr(r ou4tpe ifetltfaDeln o (4aexnxrcoadomDranesl()t2tmxr3oo1llt mivsat)a2tm(mpoo0altomfciyslaDrlumpnu4 reomoctytfaDr i o;t trxo(o oy1aptnlnctl()a2tmur ;o4olxn ictadfm2el(ms;t)altoifciy1op  anvi;t t2xoimpny1omt  ncil(f 2tm(mo;o0teto ociad m2uanmsnu0 lenxrctatfat lies;s0t2xoxr3oy1llt mfci ( a2uaxr ;t1opxnmf3ildlsDrlnmp (4tlxoifctydoate neo ( t2urxm oy4lp nmfei t srtaxmoou1ape  i3tlt s rlnmpnu0alenmo iotlp r nvi;(0 eur(m3nydlm emfcslt)aDururo;u0oleo f3iydlm2eluvs;u) reoxf3oytlm rlnei;()teurxm3oodamtemfcil(f Dta(rpnu1olenmoetlslm ea(ms t0 etoxf3todlp rlivo t)srurirpoy4ll  livilt s2raxm ;t1tptnioctlslm rmumpn()aetnxf3tatoa  lu ols0seurxr oudolte ieil(fa2ua( p;o4oetomicilsfs2ua(von()arerir3oytoaDrauei;(  2trxo io1ll e fcsas)arumxm nt1tlxnmfeiysla2ua(mp;(0trxnmo3ia1faDr ieilt seumirpiydlp nlfvslt a2uru  ot1apt  oeiydfsDel(vs;() eenio3oo1lpDeluvolt  eum(m3oydomtnliei sfs2truront4tpenmfeild m2emu s;t)teenxr totlp   uvi s0 2uoio3iu1llt livia(f Drmx ono1openmfciyd aDulnms u4tlxnmf oydlate ies t0t2trxrpiu4altelnvsl( a2rmur oo4ape ii3ild m rm( pnt0 ltnmo iadfpDelieo;t0srtmirpny1al nlncs t)artr(m ou0tltnmieiys mDul( s t0 eermo ootopD  nei (0 rxrio oy4ol emfetas  rur(m ;t4aet  oetys m2elumon()trxrxocoadlm elieilt  ruo(opny1om nmfvt s)s2tmxmoou4apxoif3tas mDranvsnu) lenif3tatfm rlnes (  rtmim io1ome  nctlsfsrta(mpnu4ole  octldfaDemn p;t) lxnxf iotlatr uvo;( t2xrio3iudlltnmietl(fsruax o;t0olxniictyd a uan o u0aexrxf3oo1fmt anvi;s) 2trxo3oy4amtn ivs tfsrtmx ooo1apt mo3tys sDeaums;(4trtnif3oa1fpteanei;( s2tm(o3ny4ome lnctlt)s2tmx oou4oeeniietlt aDeanvp () exrmfcia1fmt lueo (0t2tr(rpio4lmtemncslsfsrururoou4teen ietltfmDraumsnu4trtrmfcta1lm  lnvilt srtrxr oo4amt lfvs () 2tm(m ou0aee  ictatlmDum(msnu4aleoio totfaD li i;( srtm(o oy4altn fvtasfs2rax o;u1tlt iiciytfm2um(vo;u4altoxo iadoaD ai slt  exmxrpoodomt livt t)a2uru p;t0olxnifctatls2ranvonu0 lerir3tydopDe uvolt)t2xrim3ou1opeemnvi ( s2tm( onu1altoifciadfs rlnmo;u)aetrmrciodop eaivs ()t2uoir oo1amtemiet ()aDtmxm no4apenioeiatfm2um( snu0tlxrmrcoydlp  an s s0srxo(r oodalee icsl(  Dtmx pot4tex  f3tasfs2ranmo u4artrxo3oydom rluvs s0seurimpoudomt lfcslt)arua(m ;o4tltn feils m2rlnvpnt0 eenmo iatoat  iei (0texrxm3nodal   fesl(  rta(rooo4optoiociyt mDemnmsn()teeomo tadfmt  ueo;() etmirpoy4olenliet sfaDur(r ot1oex iicilt mDeauvo t0 reomrcty1la  auei s0t2xrir oy4omte fcsls a2tau onu4ope iieiat s2rlnvo (0aetrxr iytlatrlieilt0t2xr(r oodalenlfvia()s2tm( pou1aexomi3iyd s2ra(mo;(4artnxfcootlmDran ils) exr(r3io4amtn ici sfaDtr( poo0tee mfeilsfm2eau s;u4tleniocoydomtelnei;(0t2uo(rpoo4omeelfvil(fsrum(rpnt0tlxnmieiytlm ra(mo t0alenifcia1la  ln i s srtmir iy1amtn nvtasfsDtmx pnt1tpeo fciadfm ran o (0 lxnmoctydom elu i (0 exoim3iudole liesl(fsrrru poo4tlx iicias a2rm(vp;t0arxnif tatlpDe uvolt0s2urio3oodlmt lnvs s)sDurx  ;t4alenio3iyt aDrmnvsn(4altoif3tadlptrai sls)tetoir iu4aptnlietltfarrr(ronu4ape ioctasfmDumnvp (0 ltnmocoy1lp r i sls  rtrxo3iodom eliesa( aDtrxmo;o1aexnmi3tldlm2umn p (0trtrxf3tytlpteaueols) exo(m3io1amtn ict sfs2tmur ou1apxn fctysla rlu o;u4 leomf3to1fpDr i i t)s2xr(r3oydlpenmfet ()srtm(  no0tetnmfeiad m2ran on(0trerxr3iodlm r n s;(0trurim ny4omtelncsl(f Drr(rpou1apxnii3ias m2rmuvp u) lxrircoodlm eluei;()srxoir iodap   fciltfa2ta(  nt0apeo fciadfa2ra( o t) ltnxo3iotfp   uvs;s s2uoim no1ale  ictatfs2tm(ront4oltnioetatfa2eanmsnu4 lxrxfctotoptelues;()tetm(m oodaleelnviltfartm(  ;o1tpxo ieiasfsDra(vo;u4 eerir3to1om r uvs;s)sruoiopoy1openlfcs tf Dta(rp;t0alxnifciasfmDumnmp u4 lerif ia1lptelneils sruo(mpiy1alenmnct ( sDtrxr oo1oltoiociatfaDel(mo (4 rtrxo3to1omtrluvs s)s2urxopiu4am   feilsf Drm(mpoo0tlxomieildlaDeln snt4 rxnmr ia1lmt  nes s)teuo(opoodoleelfciasfsDrmxm ;o4tpen fciysfa umuvpnt0alxrmrctodoaDranvs;s srurirpoudlpee fvi ()s2umu  ;u1tetniictys m2ra( p t4tlenio3ta1fat  nvi;(0teur(o iu4ap e feta()arrrxrpnt4oee iiciasls2eanvs;() renif tydfat an o;()s2xrirpiudlmtn icsl(  rrrurpnu4aexo octyt m umuvpnt4tlenir iydfmte ivo t) 2xr(o3iu1op  lici s) Drrxrpno1opeo ictldlm2em(ms;u4 rerxo oa1fp  au olt0trurimpou4aleemnes s) rurxr oo4texn i3tadlaDeauvsnt0 etniocia1lpD lneo;s)srur(o3iodlltnlfcsa( s2ur(mo;u0oetnmiciytlm2rluvpnt4teeomoctytlm rlivo;s0trtmim iu4altemfetl(  Drr(m nt1olenmieildlm umumo;u4arxnif3iatfmtr u sl(0sexoxr ny1apte nviat aDtr( ont1tet iocilsls uluvo;t)alermf3oatomDeaivo s)trtrxopny4lptemfvil()s2um(m ;t1tpen ietyt mDua(vs;u4trermo3iydlaDraueo;t s2umim ou1op   fcilsfaDuaumpoo4ape mi3ilsls2um(vp (4tltnxo ia1oaD  u s;s) 2xrim3ou1lpt mnesat)aruru  oo4tpx ifciyd a rmn s;(0aeerif3iy1fpt luvsl()s2umiopiy4apt  iesasfsruax oou0apt mfetas s uau s;t)alxoio tadlp ranvo ( trtrim no1ol  mnvtl() 2tr( o;o1opxnmo3iysfmDulu p u0trtnir iadlmtr uvsls0s2xoxopny4al   fct (f Dtm( pnu1tetomociat aDrluvpnu4tlxnxo3io1lmtr n i ( trxoimpiu4lptemivtls)a2umumo;t0tex mf3tlsfs2ul(vo t4tetrio3iy1lm   nvi;t tetrim nodapenmfesa(faDtmx  ot1tlxnmi3iysfm ua(mp;t)altnmoctytlptelnvo;(0 2uoxr iudoltn iviatfsrraurpno0apeo fciadfsDemn s;(4aleomo3ta1la  auvilt  2xoxmpiodll elnes s sDururo;u0tet  o3tys aDra(vsnu4 leoxo to1lp r u i t  2xoxmpiy4ol n ictlt) Dtaurp;u1opx io3iad s2ua(vsn(4 exrmrcto1fp raies;( teumxo3ny4lleemfvias)artrum ot0tlxoiieiasfa rln snt)arxrifcoadfatrli i;t0 rtm(r ou1om nmnetlt  rrrxmono1tetoiicias s2eau snt4tlxrirciodlat ai i s) rxoio3iydal e ietas s2trum ;o4alx  f3taslmDel( p;t0tetoxo iydomDeauvi ( tetm(opou4lptemfvtas)a2tau  nt1aeen oeiydfa2umu o;u4altnir3oydlaDrlivils) 2um(o nu4lptnliciat)sruau o;o4opx  iciys m2ea( s;u0tleoxociotlaD an i s0srum(m iu4amtn nvs sfs2umu p;u1opt ifeiydfm2el( p;u4 exrio todfmDeanvs t t2to(r3iodomen fvs tfarumumpnt4apxniieilt m raump;u4tetrxr todlmD lnei;(  2umimpny4lmeelfvil( s2tmxr ou4ape miciad s umnvs;t)teeoxo3iodlp e neo s s2ur(m3oy1opte nvt (  2ra(m no1olxnio3tytlsDum( s u0aleoxr iytfaDrliesl() 2toxo3oo1lpeemnes ()aDuau o;u0oltoio3iadfsDrlnvp;t0aleoxr oodomDr uesls trur(o3ou1lleemfeslt a2rmxr no0aexo ictytfaDrmnmon()trxnifciatlmDe ivs;(0 rto(mpiu1ol   ncsat)s2rmxr ou0oee  i3tasfs rm(msnu0 exomr oy1lp rluvols) rurim iy4optelivsatfs2umum nu1tpxomoctatfa rm(msn(4aetrxr tatfpt lues;t) 2uo(r3ny1ll elivi () Dra(rpno4tetomietadla2rl(vs t)aexrmr ta1lm e nvolt0srtoio3oydlmenlnvt s a2raxm nt4tet ifctas sDuan o;u) rtrifctatlpDr uvi;()srxrxr nydomt  fvil(  2rmxrpno0oeto fcias a ean p;(4aetoif3oa1lp eanvolt)trxoirpiudolee fct (f Dta(mpot0opx iictydla ulnmont) reoio3oodoa elnvo s0 2trim oo1lmenmfvi s) rrm(rpnt0tpx ifeiyt a2eluvo;u0aeerxf3tydfpDeaneilt)trum(m ny4altn fcs (f Dtrurono1apt micild s em(vs;t4areoxo ta1la eluvi;s)trurimpoo1lpeelncilsf Dur(mp;u4texoifeiltfmDeanvp;u)arenio ia1la e ivs (0 2xo(o3oo1lpe mivs t)srrrx pou1opx ii3iaslaDrm(mo;()arxnmrctatlp e ivi t0srxoxr nudapee ieils  rtm(mont1oexo oetatfa uau on()teeomocta1omDelivo;( t2um(o ou1lptn ies (fsDumur ;o0aetnio3ilslm2rm(vsnt0 reomfcoydfa  ai s s0sruoxm nodom elivias)aDrru o;o4tex mietadls2ran s;u0altnircoa1opDelivs;(0 2uoio3oo1omen nei t)sDrru p;o4tltomf3iydlaDemu pnu4texomf tatfmt ln s t  exm(opiy4aptemnvsa( sDua(  ;o0tltnmfetydlsDem(ms (4 rxnmfctotfat  iei;s) eurxo ou1omenmncs ()sDtaxmp;t0oleniiciasla ulu p;t) lenmo io1lmte iesls0srurxm nodll nlncs t  Durumpot1tetn ocilsls2eanmp;(4tltoxf oodlpteluesls  exoimpoo1amt mict s  rtrum nt0aetn oeias sDrau o;t0aeeomf3iodlatr nvo s t2toio3oydolenmictls)a2ur(mo;u0tpx  i3ildla elu pn(4tlermf oatlm elnes ()s2tmxo3iu1lpeelnet s  rrr(  no1olenifciyd m rmnmo;u)trtrmr oadop  lnvo s)setmir3ny1opte fvt sfsDra(m nu0tle ioetytla rauvpnt0aetoifciatlmDelieo;s0 ruoxm oy1al  lnei s) ruaxm ;t1tlt mf3iys sDuau snt4arxnmfcoatop   u i (  rtm(rpiu1lm e fvsls  rrr(m ot0optomictasfm2ua(ms;(0trerxf3oadlpDeaies ()srxoir3iydll  lfesas  rtmx  oo1opxoii3iasfm ua(vonu4arxnif ty1omDraieols)trumxr iodlpeemnvs ()srtax onu1apen iciyd sDeaump;u4 ltrmr oatlp  livi t srumim ou4ameelneiasf Durxrpnu4oexniieiys mDemn p;()tlenmo3oadlpDeluvs;s)teuo(opnydam  lfci s)s2raurpnt4optoio3ias s rmu s;u0teerxr3iodop  ln i;() exr(o no1lmt mnvsltfaDrax  ;u4alenmfeiadls rau s;t4tlxomo totlpteauvi s) rurxmpnu1ap  mncsasf Dtm(mpot1optoifeiad m rmn snu0 rxrmfctodomDran s;s0trto(m3nodlle mnct (fsrrm(monu4aee  ociltlmDul(vo;u4 etrmo todoateau o t)t2uoxo3ou1ol elies t s2um(rpnu0aex mieiadfaDelumo;t4tltnmoctodlptr ies;(  rtmxo3ny4ameelneia(  2uaxrp;o0tptomiciadls2eanmp (4trtrxo iydlpDranei t)seum(m ou1lp nmfes t) ruax pou0tex  ieiydlm2rmumsn(4arerxo3iytlpt aivi t  exmim ou4lltnlncsa()sDtaumpot4opx mo3tat m2rl(mp u4altoxo iydomtrlueil(0srur(rpnu4am  lnvia(fs2tmu  no4aleomicilt m2rmnvp t0aeenmocoa1fateaiei;t0texm(r3nodopeemfvsl(  Dtm( o;u4aeeomfeiytfa2rln o;(4 eenxo iatfpDr nvi s0sruoxr3oodopenmivtlt)arrru ono1texo i3ildfm rm(vpnt)aeerxo3oodfp  lneslt  eum(o3nu1lmt mivt s)arra(rpnt1tpeniietas aDea(vp (4altomo3tadoa  lnvs t)t2ur(r3ou1oltemieias  rua(r nt0apxo o3iltls2umn o t)alxoxf3iadopt  uvil()t2toir nydlpeelicil(fs2umu pno4oexoiiciltfm2rl(mont4 eeoir3tytfm  li o;s0t2toir3iy4lpenlfetasfarrr(m ;o1texniieiydfaDrmu pn() rxoif oadlatr nes;()trxrir oodll nlnet t a2uax poo0aptnioeild m2emnmp t0 etrmr3oadfmteauvol( teurio3iodamenlfcsat  Dua(mp;o1opxomoetydls ranvs t4 rtnir3ootfmDraiei;() exr(rpoy4ale mnciltf Drmxm ;u1olxn i3tlt m uan s;t0artnmf totfpD an olt s2uoxrpoo4omtelncs ()arrr( onu1olenifcilslm2ra( o;u0 eerxf iydfptrauvs;(  rxm(rpno4olt lietltf 2uax ooo4tee  fcild sDuanmsnu) rtoxr oadoptr ueils0srtm(m3nudlltn net s)sDrax pot4teeo oeiaslaDum(vs t4altrmf oydomDeli ols trumiopiy1optnlnct sf Dtrx o;u1olxniicilt m ranvp ()tetnxo3iytomtr n i (  2trxrpno1llen feilt)srtm(r ou4tex ii3iydfa emumont0altrir3oadlatelueil( tetmirpoo4optemivsas arumxrpno0tltomfctasfsDrl( pnu0 renxf iadopD lueils0 2to(r3nydomtnmnetasfsruaxmpou0opxniieiydlm um(vont) rxrmocia1fm   ies ( teurirpoo1am n net s s2rm(  ot4tpto ictatlaDuanms;(4 leoxo3ty1lmt  uei;()tetm(rpiydalt mfei tfsDrmxm ;u4aee miciytla ulnvs t4tlerioctatlmtrlieol()s2trxmpio1llt lneilt
\ No newline at end of file
@@ -0,0 +1 @@
+u i s seumiopno1optemivtltfaDuau p;u0apx  i3tytfa rm(msn(4 lxnxrctodoatrluvsls)texo(rpny4lm  lici tfsrra(rp;u1alt  f3iytfa2ran onu4tlxnmf iydfaDraies s)seuo(m nudlmeemiei ()a2tmxmooo4tee mf3tys a2um(msnu0 lermociydlp  li i;t)t2uoxo3nydal   fcsltfaDurxm ot0tex mo3iydla umumonu0areoxfciotlaD lieslt  rtmim3oudamt lfcilsfarrax poo0olxomoeildlaDuauvont0alenmocoadlpDr u i () eum(m oodlme lfvsls s2ra( pnt4oleo i3iadfa ua( p;(0aexrxo3tydlaDeanvi;s0 2uoirpiodol   fci (fa2rr(mpot1oetnmfetldla ea(vs ()texomr3oytfaDrluvsl(0 etriopiodaptemfvtat  rrm( p;u1altoioeiytfaDuanmo;u4artnxf3to1fm rluvi;(0srumiopiu1lptemivtls)a2rmu pot0oexn fctaslm eluvsnu) eenxfcio1faDelu o s)srtm(r3ny1ol eliviltfsrrax ono0aexn oeilsfs ranvo (0 eerir oo1op  lneo;t)trurio3oudlmenmfvias  2rauro;t4alxniieildfm rluvp;()altrmo oo1lpDr uvsl(0tetoir ou1ll emfetat srta(monu1aex io3tat a rlumsnu0 lenio iotop rai olt  rtmio3io4ap  micsl()sDta( p;u0aetnmociatla2eln o u)alxnio ia1oatraieil( srurxo3oo4lmenliesa(  2uax ooo0tltnmfetadfa elumo;() reomo3iadfp rlnvi (0 rurir oydamtn fcsas  rrrxr oo0olx mfeild s uanmp ()tltoirciatfm  ln slt s2tm(m iy4lmtnmictas)srtmu  ou0apeniictys m2el(vs;t0 lxoir3iytomDeaueo s0truoim3nudaptnlfctl()s2ur(m ;o0optomi3iyd s rmnmp;u4 rerxo ia1lmDrlnvs;t0s2tmxopio4optnmncs (fsDurur no0olx ifciasla ran onu4 renxr3tadfm rln i t)seumio nodamtn ictls sruaxmp;o1optomi3tydla2um(vs (0tlenxf oodom eluvo t)t2xo(m3io1amte net (f Drmxmpoo0tlx  ociytlm uaums;u4teeniocto1la rli il(0tetmxo nudoleemnvtatf 2rmxm ;t0tpx  f3iydlaDuan o;u0aexrxf3totlmtelnvi s)trtrxo3iy4lpte fviat) 2tm(rpnu1tpenmfeiyd a2ean pnt4treoxocio1oateluvo;t t2xmiopnydol nmfeils)aDum(m oo0opxo iciasla2ra(ms t0teeoifcoo1fmDraivo (0sruoxr oudlp   ncs t a2taxm no0tptnmicilt m2el(vsnt4 rxomfcoytlmt livi;s0srumirpnu1lptelfvi (fs2urxr ot1optnii3iadfm2rl(vpnu0 ltomfciadlateaueo ()tetoxmpiu1ap  mnesl(f Dtrxr ;t1tlxnioetld a2eln o;u)alenmr3iy1fat aivo s teuo(rpou4ome  nei t)srum(monu4opx moctadfa2ra( onu)tltomf3iadlpteai ol()srxmxm ny4lmtelics t)s2ua(ro;u0aet iietldfa2rmn pnu4aeeomfcia1lpt ln o ( t2urir3ny4lmte icsl( a2trxmpou0tpxomfetadfa2eanmp (4aetoxf ootlp raues;s0trtmxmpiudomt lncils)s2uaxrpot0tetoifctatfaDum( ont4 lxrmf iadomDr ivilt)setmio3nudam emfeils a2rm(m no0aex  fcildlsDul(mo;(4tlxrxf to1lmD au s t tetoir3nudomtelivs tfarrm(  nu1aetn ociyslm em(mo u0trxrif3iodfaD au i;t0 eum(o nu4amtelnvsa(fsrra( pnu4apenmo3tatfa rl(mp;(0 lerio ia1fmD an i ()t2tr(o iy4op  lfeilsf 2rm(  ;u1teeoii3ildla uan pnu0trtnmfciadfa  aies t  2uoirpny4apen fet (fa2taxr nt0tlxomf3iyd s2eanvs;(4treoio3oa1lpDe ieilt)teto(m3oy4olenmivi t s2rr(rono1aet  fcild sDem(ms u4tetrir3to1lptrliei;t  2trim3ou1lp  mneilt) 2uaumpnu4tlenmiciltfm2rl(vs (4aetnmo3tydlpD  nei;t)srur(mpnodalt  fctlt s2ta(r ot1alx mfciatfa rlums t0texoxfciodfm r u s;s teto(opnu1lle lfcsas  Drrxm ;o4alto i3tltlm2ea( p;(0altrio oatoaDeaivi t)s2tr(o3nudlp nmnvil()srra(moot1opx ii3ildfsDuauvp u0 etrxocoydlp eaivo t0 exr(mpnu4amenmivi ()s2umx  nu4aexo fciat s2uauvo;t0 eenmr tytoptraieo ()t2ur(r oudlm   neias sDta(rono1aeto ieiyd m2rmnmo;t0 rxnxf iydfa  aneo t0t2xoxmpno4lpee nes (fs2rau oou1tptnifctys m2umn s u0 etnxr todfmDr i i t)t2xoxo3iu1omee fvilsfaDra(moou4texnmociydlaDemnmo;u4alxoxo3tytlp ranvo;(0s2um(opnodap  mnetlt) Dra( p;u1apeomoeiat a2rln sn(4 ltomfcoadfa  lu o t  2trxrpiy1op elnctat sruaxmo;t1aex mietlt a2ean o t)treomo ty1faDeln slt0 exm(m3oy4omtnmics t aDtau poo4tltnioeiytfa rlumpnt4arxnmrcto1lpteauvi;s)tetrir oydamenlfcilsfsrurum no4oexnmfetlslm ua(vs;t0arxrmo iodoatrlivsls srtmim oodllt liesls) Dta( pno0apto ietlsls2rmn s;()aeenxf3ty1omtraieo t0t2umiopnodllenmnctas artr( pnu1oeeoiiciys s ra(vp u0teenmr tytfm eauei;( seurir3oodlme  iesatfa2tmxmonu0tetnmf3iad m eauvonu0alxomrciytopDeauvol( t2uo(o3oy1altn fvil(fs2tm( p;u1tee  feiyd s ua( s t4aexrxf3oa1omDelivs ()trxr(o3ou4lmtelfetatfsrtm(  ou1tpenii3iltfa2ra(mon(0 ltoxo3to1opDr ivs (  ruo(o oudlptnmnct ( sDuaurp;t0tlt  f3iadfa ulnmp u4aeenir3ootlmDeanei (0srxmir oo1lpe  nvilt) Duaumooo4altnioeiydls2raums t)altnmr3ta1opD  uvs t0trumim3iy1aptn fct s)sDra(r nt1oeto ictldfmDuanmp ()trxnmoctatlatrlu sls)seurxo3iydam nlfes (f Dur(m ou4oltnmf3tls m ra(mpn() lermo3tatfmDr nvs ( trtrimpnydaptnmfvt (f rrrur ;u0tee mietadfsDrln s;t)teenmf oo1fmDrlneil() eumir3ny1omenlfvt s aDtru oou0tlt  feiydfaDran ont)trerxo iydlp eln s t) 2tmxo ou1lp  lictltf Dra( poo4olt ioeildfm eaumo u0 rtoir iydoa  ai ils)tetoio ou4aptnlnvt s sDuau  ;u4tlt  ociysls2um(vp t)alermr3iy1lmD  nes s  2xoimpny1lmenlici ()arrmxmpnt0tpx mf3tysfm2emnmsn(0artnmo oo1omtelu i s teurio3nydam nmneslsf rumumo;u4optn feiat mDumn sn(4texrxrcootomDr neils0t2xr(r iudolt lici s  2ur( p;o0tpe  
\ No newline at end of file
@@ -0,0 +1 @@
+ivi t0 ruoxrpoy1omenlivtlsf 2um(mpnt0ope io3iyd aDeauvpnu)alxoir3ta1lm e ueol(  rtoxo3oy1altnmicilsfsrrrump;o0texn oeilsfm2ul(vs ()aeerxfcootfp   ivs;s0sruoxm3io4aleelfctasfsDtaxrpno0teenmiciadfs umuvp;t)aetrxf3iatoptelu slt)srxrxopou1am   neta(faDtauroou0alt iictlt m umu snu) exoxo to1lp  ai s (0 2umxmpiudapt  ncta( s2uaxr nu1oee  ociadfaDulnvo;(4tlxrmo iadla  aueols  2xm(o3iudlptnmfctl(farur(r ;t4tpxomo3iatfs2em( s;u) ltoxr3tadfmt lu ilt)s2umio3iodoltelfct tf rtmuro;o1tee mocild sDra(mp t0 reomocootlatrlivo;t0 2tmxm3oydlp nlnvil(fsrrmx  nt1tptomi3ildlm2um(vsnt) exrio ty1fmD lnvo;t0sexmxopoy4op elics t a2rrx  ;u0texo i3ias s2um(von(0aexnmr oodfm rlivolt)sexoir io1lp   ictlsfarrm( pnt4oexo ictas sDuaums;(4aeeoxociodoa  aieo (0 rtrim nu1ol  lnvi (farraxrono0opt  fcildfm el( pn() ltrxo3oodopDe neo s seto(m no4op emfes s)sDum(ro;u4opxnmoeiysfmDul(vs (4 leoxfciatfp  auvil(0t2uoxm oodomeelivsasf 2taxr ;t1oetoiocildlm2ean snt4trtnxo tadfm   i ols0trxoio3iudop  livs s) 2rauronu1alxniieiys sDra( pnt)trxrmr3tatfa  an o ( setrim io4openlfctlt)artaump;u0oeeoioeiadlmDua(mp u4 renmfcta1om elu s;()setoxo ou4alt mnvs () 2trump;t4olx moctat s em(vo u0 exnircta1fpDrln i (  eumir nudamenmicsls)aDua(  no0tpxoiociasfsDel( on(4 eenxf oydoaDelivs s0sexrio io1amt mivil(  2rm(moou1apxo i3iyslmDumuvpnt)trtrmo iytla r neo;()sruo(m3nu4ol  livi t)srrrx pnt4tpeniiciltlm rauvsnu4 etoxf3oodopD lueo;(0 rtoxm3no1optelncslt arraumonu4olx iieiatla2em(vs;u4aeenxoctotlpDe n o t)s2urir3no1om e iviltfs2uaxmpot4apxn ociyt sDelumo t) rerxociydop rai o;s)trto(m3iu1ope licsatfartm(m ot1aeenii3iaslsDelnvo t) rxoir3oadoaDr nvs;s)sexoir3ou4om  mfeilsf 2raxrpnt1olx mfeildls ul( pnt4 lerxfcoytfpDeli ilt  ruo(r3nudlmenmncils s2trumono1oeto ocilslaDulumsnu0aetrmocoytfat auvi () 2xm(rpiy1lpte fetas srrax oou0ole iieilsfmDulnmp;()areniocio1om   uvils) euoxr oydoltnmnct t)sDta( poo1aetomfetltfm2emu s;t4trtriociadfmtrlnes t setr(r ny4olenlfcs (  Draurp;o4ape if3iydfs ul(mont0tlxnio tatomt luvilt) 2toir ou4lpe  fvta(fsrtrxmooo1olt ii3iydlaDrmnvpnt0aexrxr3todlpDeanvils sruoir3iodam n iei sfsDtaurp;t1aptnmociltlm rlu sn(0 etrif iodfaDe i ilt teum(m3nu1llee ivs t)arur( ont1tle mf3ildfs2ulumonu)aetrxocta1la elies t)srumim3nu1altemneiatfartmu onu4apt  f3iadls2umn p t)altnxr3iadlm rluesl()trxmirpiy1llt  netl(farrmxmpoo0opeo fctls a2elnms;u4 rermfcio1omteai ilt) etrxr3ny4olen icil()srurxm ;o0tex  i3ias sDul(vpnu)trtnmr iodop  lieols0 2uoxr3oo4lme micsltfaDtax onu0apenifctls s ra(mpn(4tetrifciytfp  ai ilt t2umirpoy4lme lfcta(fa2ururoou0tpx iieiyt a ul( s u4 eeoxo3oadlpteaiei;s tetm(opou1llte ncs ()sDta(r ;o1opxoiociydfaDrm( s u)tetnmf iatlmteai i;()s2toio3nodapeelicsas srtr(rpnt0apx if3tyt a elumpnu4tlxnmfctydopt au i s0trumiopoo1openmietas) Dumx onu1tet mociasla umn p;t0trtnxr iadopDrai o s t2umxo oy1amt  fvsl()aDurxmont1oex mi3iltfsDul(mo;(4arxrio oatfa   u i;s tetoio3oy1aptnlfct () 2ua(m ou0teeoiiciasls2elnvpnt4 rtnmf ty1fmt lu o s)t2urxopno1lme lncsltf rtrx ono4apt  oetydls2rauvo t) rtoio tytlaDraies;()teuo(m3iy4altnmnctlt)artmxront4alxomfeiyd m ran pn()alerirctatoatrli o (0teuoio nydlltnlncsl(  rrmum ou4alxoif3iyt a umn pnu4 rerxf oadoaDraivsl()sexoxo oy1omt lfet s  2rax p;o0tetomictytfs rm( p t0arxomrciadoaD  ues (  2xmxo nydlltn iet sfa2umu p;u0oexnmfeiatfa ran p;t)tltnmf3iatfmDrli o;s  rxm(rpoydop nlnvtatfaDtaxmpoo0teen iciat m2rluvp t) leomrcoydlmDeauvi;(0s2trxmpoodop nliesl(f Dtax o;t4apxniociatfs elnms;u0 eerxf oa1opD lu sl( srtoxm no4omtn fvtlt)s2trumonu1aptomociadlm rmnmpnu)alxnir tatfm e nvo s0 2xoxo3iydom emiei s)a2tmx pnu1tet micils aDrauvs;t0tltoir oatlpD auvi;s0t2xoiopoy4amte ivsat)sDrmxm ou1tleoio3iatls2umnvs u4altoif3ia1fmDrli i s  2urxm io4ol emies t) Duaxrp;t1texoii3tld mDra( s u4 lermf iotfateaieils  rxrirpiy4al  lnvslt  2umum ou1tptomieiad a emumsnu4 rtrmf3iotlmtrlnvo;() 2tmxmpoy4lmtelietasf rtaxr oo0teto ietlsla raumo (0 exoir3tatfatr nvolt0s2tm(opiy4openlnvs s) rtrump;t4alxomiciytlmDranvp u) lxomr3oytoaD ln s;t texoxrpoudopeelfvta( a2raur ot1tpto ictyt m uanvsnu) rxrxfcoytfpt  uvi t0s2xmxmpnu1opt mnct s)artmxm ;u1alx  fcias a2emump;(0arxnmf ia1fp rau i;()t2trirpoudal e fviat s2trxmono4oee moeiltfa rau p ()trxrif3tydfaDe u ils) exoiopoy1ap nmici s) 2umump;t1tlxo fciyt mDrluvpnu4 lenirctodfaDelu o s) rtoxr io1amt  iciatfa2tm(  no1openiociydfs2ra(vo (4 renxf iy1lat lues t) eumxr3oy4omeelnvt t  rtrxmp;o0aet ifeiytlm el( p (4aeermrcto1fa  aiesls  exo(o iu1ome mfciatfsrrrxmoot1teeoiiciatfaDrlnvo ()alermfcoadlmtrln il(0t2tr(rpny1omeelnct t a2trumo;t1texoiieiysfs ua(mo u4 leoif3iytopDrlnes;s srxoxrpiodamte fei t  Draumpnt0alenmo3iysfmDeanvp;(4treoir ty1omt luvi s)srurir oy4ameemiesa()a2tr( pno0alt mf3iydfm2elnvon(0tltnmf3totlm   uvol()seum(o3ny1om emfvta()a2trx oou0tpe mf3iadla uan o t)trtrxf ta1lp  ai s s  2xoimpno1op elict t) Dumu p;o0tee io3iyd a2uanms;t0 etrio3iadlatranei;s  2tmimpiodolenlnetl()arta(r ;o1apxnmociad a um(vo;u4 lxnmociytlm rluvsls trxrimpnu4lpeemfviasfaDrrxmp;o4aleo o3ildfs ulumo;u4 rtrmf3iotfatelneil()t2xoxrpny1llt mnct sfaDumur ;u0texnioctltfsDum( o (4alxoxf3ia1fm eaueo;(0seuo(m ou1olt livil(fsDtaumpno1alenioeildfs em(ms u4 ltrif3io1om e u sls seto(o oudam e ivi ( artaxmono0oleomi3tad a umuvs;()aleoxociadlmDran o t)srumxo3iu4lmtelivsltf rum(m ;u4tleoioctatfaDeluvonu4trxomfcoatla  lueo;t)t2um(r3iudomtelnvtltf 2um(rono4tltnmfctadfaDea(vpnt4tltrmr oa1lmD  nvo t0 eumir3iodlmtnmfes ()a2ta(mpnu1aexniicildfmDeaumpnu0 etnirciydoatr u o;s0texrirpoy4lm emfcta(f rrru  nt4tlx ifetlsfs ulu onu4alermfcoy1oa  aueslt0trxoirpiu1am nlfvsat artaxr ot0olx  i3ilt a2umump;(4trxrmr3ty1om   uei;t0t2tmio ou4ope miesl(fs2trumont4tleomi3iydfs el(ms;(4aetnifctatfaDr n o;(0setoio3oo4aptnlfesl()s2uaxro;o0oltnmf3ils s emnms u0tltoxfciatlmD  i ilt  2xrio3oo4ol elfvi s aDra(r nu4texnif3iytfa emn o;t4texnif3iatom  luvs;( t2trxo iu1lpee fvias) Dumu oou1openioeiydfaDrm(vp;t)tlxrxrctatlaDran il( t2tr(rpio1llenlnvtas) rrrum ;t4teto o3iltls2eanmsn() etnif ia1fatelnei;s)trum(o3io1lle lnvi t) 2umu  ;t4tee moetytlm ranmsnt) rxnirciatfp  livsls0 rxoio nu4lpenmfvia()a2uru pot0tpxomf3iat a rl(ms;t4tltrir iydlp rai i (0 rtrirpiy4lpeelnci sfs2uaumono4aeeoioeiysfmDumuvon(4tltrmfcia1fmte n s;s  eurimpnudlleelnvslt) ruaurpnt4tpxn oeiadls2elu s;t) eeoxfctydfa  anes s  rtmxmpou1lleemfct s aDtrx p;u1oltn f3iatls uanvpnu)arerxfctatfmt lu s;t0 eumir ou1omtnmfvil(f 2uax pnt1tpxn o3tadlaDra(vp t)treoxrctytfmDr u olt0 ruoxo no4omen fvsls)aDua(  ou1teeo o3iat s umnvp u0 lxoxrcoatfm elneolt0 2ur(m3iudomeelfci s  Dta(  ot1oltn f3iyt s uln sn()trxomr oo1laDranvs (  exm(r nudop nmfcsas)a2uax pnt1oleomf3iasfsDra( s t4teerxo3tytlmDrlieslt srxo(m io1lpt lfciatf 2ururooo0tltnmo3iytfaDranvon(0texrxo3oy1fm e ivi s) 2xoxm oo1altnlfeilt)srrm( p;u4olxo f3ilslaDemnmo;u0alxnxo tadoaD aieolt) 2uoxo oy1amen feiasfaDra(  nt1alenmieilsls raumo;u4tltomf3iotlm eaues s srtoirpiu1olenlneia( a2ua( onu1opxnmi3iyt aDrmump;u4 reomf3totlp  ln s;s trtmxo3nudlmte fvi t  rraxmoot4tetoii3iltfa2ua(ms;t0altrmrcoodla elnvs ( seurxopny1om nmfct s)arur(rpnu4oetnmieiad m rmnmo;u4altoxo3iadfptr uvo (  ruoim nodaptemfvi t)a2ua(mono1ape miciatfa2raums u4 lerxf3iadlmteaivs (0 2ur(m iodom n fvsl(f rtru poo0oee mo3tydfaDem(vs (0 lermrctotfatranes;()t2xmim nudlp nlfvi t) 2trxro;u1aex mf3ild s uauvsnt)alxrio3tydfmt  i i;s)tetoim3nu1amtnmnvtl()a2taxrpoo0aet  oeiydfa2uau onu4tltrif ta1oaDrli ol(0trtrxm3iodlptnmics s)sDtm( ooo1alenif3tyslm rmnmpn(0tetrxf3iotlpteai sl(0teurxrpny4ol n iesls  ruaum ou0tleo f3tlsfsDemu s;t0 rtoxo3tydoaD aieilt0trum(opoo4apenlfcs s) 2ra(m ;u0alxo oeiaslaDrauvon()trxrmo oo1laD lnei;t0seuoimpny1alenmncsat arrr( o;o4olen oeildlsDrlu s u)trxnif iatoa elies;s) rumirpoo1am   nesltfaDum(m ;t1texnmiciatla rmuvo;u4texnir iadoateaivo (0t2tr(m no4aleelfeiat)arururp;o1tpt  fetlsfmDumumo;u4 lxnif3tydlm   n sl(0s2uoio ny4openmfvslt)sDra( p;u0alxo ieiat m uanmp (0 lxnirciotfp e ueo;s)srxo(mpno1llenmfvsls)aDra(rpno4tlxomietad sDulnmp;t0arenxo todoateaues;( seto(o3nu1am n icsa(fa2rmxmpnu0oeeoifctyslmDra(vo;t0trtoif oa1om  lneslt0truoxopoydll n ncilt s2ur( ont0oexomo3iltls ra(vsn(4texrxr3iatfmteln o;t)setoim no1lpen fci tfa2rrxm ;o4ape  i3ilsfsDrlums;(0 rermf3tytlmte uvo;t)teur(m iy
\ No newline at end of file
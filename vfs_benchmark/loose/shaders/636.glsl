@@ -0,0 +1 @@
+uvslt)t2tmio3oydol nlivs ( sDtmx  no1tlen fctldfs2rmu o;()trtrxo3oatlpDeauesls0 euoxmpiudope lict tfa2rruroou4opx  o3tatfs um( o;u0 leoiocoytfmt au il(0s2urxrpnu1aptnlicia( s2rm(rooo1olx  octadfmDea(mpnt4 renir tydlm e n o t teumio nu1ol n iei ()s2rau ono0alxn oeiys sDeau o t)altoir tadlpDeanvo;(0srxo(opny4lpeemneil(f Duax pno0optnmoctas m uau s ()teeomoctodlmtelueils)srxmxr iy4lptnlnviltfs2uru oot4alt mo3iyd s ranvp (4alxnmo oatom  au s;s)truoxm nodopeelivtlt)srrmuro;t1opeomf3iatfs rmnvs u)tltomocoy1faDeaueo s0teumxm3oy1lm nmfvs s aDuauro;o1oexoiietadls rau o u0alxnxoctadlpDrlnvo s0truoxo nodlpeemieiasfaDua( pou4alt ii3iadfs ranms;(4 ltoir3oo1faDeauvilt  2xoxr3ny4amtnmncs sfsDrax o;t0tpxo feildlaDumuvs;u0 rtrxfctodoaDrlieo;s0teuoimpny1lmtnlfvsl( sDraxm ;o4oeeoifetys s ea( p t0 rtnxocty1oa r iei (  eum(r iu4am e fvil(fsrrmxrpot0ole  i3tydfsDrl(ms () rerxf tytomDrluvo;s)trtrio oo1ome  nci tfsrrr(mpot4tlt  oeiltfs2ea(mo (0aeeoir3iatfmtrlivo;(0teurir3nu4amee fcta( a2rmurono1tpxoio3iytls2um(vs;(0arenxf3iytlmt livs;s)setoirpoodlp nmfcta() 2trurooo4tle iieiat a2umump;t4alermr tadlmD  n s s0 2ur(opno4om   ictat)sDurx ooo4olx mi3tysfs emump;(4teenxrcoadomDrlnei;s)t2tm(r3iy1lpenliviasfa2tr( pnt4tpt ifctlt s2rlnms;t)aetomrctodlptelivsl( srxr(o3no1optnlfvilt a2um(ro;u4aptoio3tydfs umu p t)tltnmr iy1lm rai o;t0tetoxo nu4apt mnctl()srta(root0oee  octldfm2rmu pn(4tetnmo todlmDeanvilt sexrir3ou4ape lnviatfa2ra(r ;u0aptomieiaslm2uanvo u0 rxnircio1opt anvil( s2tmxm3nu4al e fvtat)arua(m ot4altnio3ild a2uan onu4 etnmf oydoa rlnvi;s0 2uo(r nudlleelictlsf rtru  ;t0ole mocils s rm(vsnu)artomf totop   ieo t0teumxm ou1optemivsasfs2trumpou1ape mieiysfs rln p;(4altriocootom rlieo s0truo(mpoydamt mfcta( srtmxr oo0aeto ociytfm2ul(mo;()arxoiocty1fpt ln sls teuoxo3oy4op   nct s)s2ur(moou1oexoioetys s2rmnmont)arxoxo3ia1fp e i o t  eur(o iydop n ivs t  Drmumo;o1tex ifciydfa2ranvp;t0aeenxocty1omDrlieo;()seur(r nu4om nmnesls)arur(mp;t4tee ii3tytfm2elnms;u0 lxomo3iadlmDeai sls seuo(m3no1lm nlfesas)aDumu  ou4aee mfeiyslm2elnms;u)arenmocio1lpDelnvi ()trto(m3ny4alenmnctlsfsrur(rono1teeoifeiad a eln p u) lxoir oa1fmtraivsl()s2uo(mpoydapen ivs (fa2ua( pot4aetnmo3tas a ranvs u4arxoif oa1omDeauei (0 2tm(r3ny4lmtemfvs sfaDra(ro;o1open octadlaDumumpn(0tlxomocoydfp   nvi;t0srxrxm nydlmeemici t)a2trurp;t4oet moetyt aDrlnvonu) reoir3iodoat lieilt s2umxmpou1ap e netl( arumum ot1ape mfeiytlm rln s (0aexrmr3ta1fm   n ols trto(o3oo1apeemfvtas aDrmu o;t1oltoif3tyt s ulnvsnu4aexomf tydoaD  ivs t0 rumir3nu1ale mnvia(fsrrrurp;u4aexo i3tld aDulums;t4trxrmo tytfa e iei ()setmir3no1al  mfetlsfsDuaxrooo4olx ii3iaslm rmuvpn(4teerioctadoatrlu s s  2xr(opiodamenmfvia( arurxm ;t4oltnif3tadls rm( p u0arenio3iytop r u i;s)t2toxopoo1lmtn fesl(  Durx  ;o1ape ifeiadlsDum(ms t4 ltoif3oydomtr ivi;()s2xmxm3iydaptn fvsasf rur(mp;t4tleo ieild sDea( ont4aeeoir tadfm  li ol(0tetoxopnu1amt  ivt s  ruax onu0alxoii3iad m2rmn p u0aetnmo3ootfmtelieo t0 exrxr nu4omtn ivta( a2um(r nt4ale  o3tasfm2uan s;(0texoxf3totlaD  i i;s)trxr(o oudlmeelnes (fa2rr(r nt4olto o3tadfmDuln o (4texrmrctydfmte u o;(0setr(r3ou4lltemnvtat)artmxr nu0oex iieiytlm2em(vs u0 renxr oo1fp elneil(  etrxm3iy1altnmfcias arra(m no1tpt  ociytls rmuvo;u0 rxoxo3oydoaD au s t)tetmirpoy1lpt livs (  Drm(rp;t4texnif3ilt s2emnvp;()aeeoxf3ta1omte uei;s  2urxopnodale  fcs t)a2rmu  nt1optoiictat aDua(msn()aexoirciydom  anei;s s2trxmpny4lpen nvt s a2tmx p;o1texomi3tldlmDem(ms;t) lxoir oodlmt  ueilt0t2xo(m iy4lm   ivil(  2rr( oot1olenmieilsls2um(vs u4arxoif oytlmt an ols)s2umimpou4ape  netlt)s2urxronu0opxnmo3iasla ul(vo;(4alerircia1lmD aneilt0 etoiopoy1opeelfci sf rrmxront0oexomi3tyt a umnvp (4tltrmocta1oaD liesls trum(r3iy1lp  lfctls)a2uru pot0tpeomfctld m2uanvp;() rtoif3oytom eaieo;(  rtrim nydoptnmnvs s) rtm(m ;o4opeoif3iatfa raums;t4artnmo iydfmteluvo;t) rtm(o oo1aptnmfct t  2umur no1oeeniiciydla2rluvpn(0 lenmo3tydfatelivi;s srto(o3nu4ol elfes ()srumxr ;u0apx if3iatla ul(vp u)altnxrciadoaD lnvi t srurir3no1lm   fetl() Dtax poo4opxnmociatfmDuln sn() eerircio1omt auesls srxr(m3iu1apenmfei s  2trumoot4oet if3iaslm umn p t0aexrxf3oydfa e ivo;t t2xrim3oydlmt  ivs (f 2trx o;o4tetoifeiadfs2rmn s;(4artoifcta1omDr i o t0 2xrir oy1lmeemfeilsfsrrrxrp;o4olen i3tltlmDem(vsnt4 exnxfciatfmDelivi;t)t2ur(r3ou1ol  mics ( sDtm(mo;u4tle iiciadfa2rmu p (0trtrif3ootfmDr neslt)t2um(opiy1ameelivsl(  2ta(mont4tltn iciadla rm( s u0aetrir3iy1la   n s;s)trurio3iy4olt mnei t sDua( ont1altoii3tldfaDumn s;() exomf3iatopD aues;t)t2urimpno1olen ietat)s2tr(m ;o1aeeoio3iadls2rlums t0texnxocty1lm elues ()seuoxr3ou4omtemfvs t)s2ur( o;o0oet iictyt s2umums;t) etnio ty1lptrauvi s s2uo(o3ou1oltelnet s) 2tm(r oo1oeto iciasfa2rlnmp u0 etnmo tydfmD  u i;()srur(o3oudom  lnciatf rtrur ;o0aetn iciydfsDuanvpnt)aexomrctadlaDr u sls  2xmxm3iydale  fvslsfaDururpot4oltoiietys aDumuvp;(4arxoifcoy1lpteaivo s) rxoim nu4oltelnvtat arurx p;o4tpxoifeilsfa ulumpnt4aleomr3totomtelueilt)teuoimpno4lptn ivia(fs2trxr oo4teenio3tls s2rmumpn(4tetomf3oydopDraivs;s s2xm(opoy4lme  fesltfsrrrum ot1oeen fciasfm2eln p t)aetomr totoaD  uei;s0 2xmio iu1am n ncsls) ruau pno1tptnioeiatlm rln sn(4 etomrcoadfmtrluvs ()texoio3ny1om n iet s) 2trur oo1aee  octltlsDrmnvs u4teenirctytfm  ai s ()srtm(mpoydopt  fcs (f 2tax  oo4tet miciyd aDeauvsn(4arenmfciydomteau s;t) exmim3no4om nlivs t  2um(ro;o1alxnmiciatlmDua( o;()artnmo to1lmDeaies;()s2xmxmpiu4llenmiciat  rtaxm oo4tpxnmfeiytlm2uau pnt4trerxfcoadlpD aiei t0 2trxm nu4ole mncilt  Durxroou1apeo i3iyd m el(vp;t0arxnxf3tadfmDrlnvi;t0 rtoio oudlmtnlivtlsfs2rrxro;o1aptnmfetydfm2ul( pnt)aexrir to1la  ln olt texr(o nodam n neta(fs2uru onu0tle  ociys s emnvsn(0 lenifciytlpt  u s;s)teumim oy4op emncsl()a2rr(r nu1apx moetltfsDrm( o;u4tetomf3iydfp raies ( seuoio io4lm nlfct s  2rmxrp;t0opxn octlsla uluvpnt4artrmf3iadlmDrauei;s t2umxo3ou4ap   icsatf Dta( o;u1tpx iieiytfm rl(ms () rxoxr totopte uvs;t)srtoir oo1ole  ieia()aDur(rpoo4tptomfcildlm uanvsnu0 eeomo3oo1omDr ivs;(  2xr(rpnu1lleemieiatfsDumxm ;o4olenmi3ilslsDranvo;u4aleoio iadla  lieols  2tmio3no1apt mfci (  Dumxmo;u1tpx  i3tltfa rmuvo u0 ltoxocoadfp   ues () eumxm3oo4amenlieia(fa2ua( pot4tlenio3iasfs2um(vp;u)tlenxo ta1omDraieo;s)t2xr(r3oydlm nlfctat)a2rax poo4alt mfeiyd m2ul(vo t0arenmo3ty1faD  ies s)t2xmiopio1altemnvtas) 2urum ;u1olxoiieiad sDem(vs t0 lxnmo ta1latr nvslt0teurxrpiudopenliviasf 2rmx o;t1ape io3iyd a emu onu4trxnxf3oodfpt an o t texrio3nu1ol   nvtls a2rrumo;o4aet  o3tltla2ulnvp;t)tltnxrctytlmteaneols)srxoio3oudaptemfciat)aDra( pno1ape  feiysfm2rm(ms u0alxnxrcto1oa e u ilt  rurxmpnu4omeelneils aruax o;u4teto feiyd a2ua(mo t4altriocootom   ieolt0 rxrim3iy1omeelnct tf 2ta(r ot4oet ii3tytlaDrl( on(4tlenmocoydlpD lieol(0tetm(mpiy4am n nciatfaDum(mo;o4ope mfcias a rmnmonu4tlenmfciytomD li i ()trtr(r3oudlp nmfcsa(faDtrum nt0olx  ieiyslmDeluvsn(0 exrmr3oa1fmte ieils0sruoxo3nudllte ivslt  2rmu ooo1tleo ociyslsDeluvs t) ltnifctatlpDeaies;(0seum(mpoodamtnmfci tfsrrruro;t1apt iociytls2elu on(0alxoio3iodlp eli ils srumxm3iydaltnmfcs t sruaxro;t4tex ifetltls ul(mpnu4 lxrmf totlmteaneo;t  etoxm3oodaptn nvsas  Drmu  no4alto o3tys aDrm(vo (0teerxf iadfatr nei;t0tetoir no1am e ivil()aDraxr oo4opeoii3tatls2ulumo u)trtoxfcoy1la e ueolt)trxrxo oo1olenliciasf rumum ou1aee mictys m2elu p ()teeoxo totla eanei;s  2xoxr oy1am nmfesa(fs2urx o;o4aetomf3iad sDuanvsnt)arxrxf3tytop eluei t0srxr(mpnodapt  ictas sDtr(moot0oeto f3ias a um(vo t)teenxf iotlaDrluvo;t)s2tm(m3no1apenlicta( s2rruront1tpxn feiltlmDumu p;(0 ltrxf to1opt  uei t0 2to(o iu4lltemnet sf 2um(r ;t0oltoioctysfm eanmo;t4arxnifctadfaDelivo ()t2umxo iu1omt lnvtlt)aDra(root1tltomo3iadlmDem(vs;t4alxoxociytlp  aivol() 2xo(rpou4om nlict (fa2rmump;t1opx iieilsla el( p u4 lxnxr3iy1optr nesl( seuoim3nydoleelfcsa( a2ururono1opxn fcils s ra(vo;(0trxnxo ootfpteauvilt0 2tm(m oo4oltemnctls aruaxrpno1olxnmoeiad m rmumpnt)trtnxo3iy1oat an ol()trurxm3nodll  mictl() 2tau  ;o1opto i3iat a ea(vpnu0aeeoif3oatlm eln ol()srtoio ny1lle licta()sDrr(mpou4apen iciltla elnmp;u4trxoif to1faDr i s;( texrxo nudom n fetat sDtmxmo;o0oleniictasfm uanvs;t4tlerif todfpDrlivils sexo(opiy1lltelnci ()srrm(rpoo1tpenio3tydfsDemnvs u4tltnmo3ootfa rlnvslt)setrxm no1optn ict (faDtruronu4alt  feiadlmDeln s u0tlxrmo3oa1fmt luvs t sruoiopoudopenlieils) 2taxr ;t0oleo ieils m2emnmo;u4 etnxf3iy1oat ln il(0trumxopoy1lpen feiat  2ua( pnu1tlxo oeiaslmDelnms u0 leoxo3iotlaD  n ilt  2tmim oudom elfeiasfs2tru p;u4tlt ioeiadfs2ulumo u0tetrmo io1opte nei s)srxr(r io1op elici sfaDuau pnt0aeenifcildla umu o;u0tetrifcto1la eai ols0t2umir3iy4om nliet tfs2tru pno0texn feiasfmDemuvp;u4 rxnxo3iotfpDe i o;(0 exr(rpiu4ap n ies tfarrm(m ;u1opto i3tatlaDeanmsnt0trtnir3totoaDrluvs t)srxo(rpoydal   nvi s) rtmumoou0aeenmo3tadfs ua(mo;(0teerir iydomDr nvi;( texo(r3ny4optnmnet s)a2tm(rp;o1oleomf3tlsla rlu o;()arxrxocty1faDr ieol(  rxriopiydapt mieia()a2trxr ;o1tptomf3ildlm2umn p t4alxnxo ty1fptr n ilt)setmio3iodlpe mnetl(fs2rmum no4tle  i3iltfmDum( o;t0arenxocootfa rluesl(  rxriopiudllenmfcsls aDtrumoot4oltnii3iltla2um(mo;u4 ltomocootlp rlnvo s)t2trxrpnodlm emneia(  rum( oou0oltoii3iyt m2ra( pnt4 rxoiocoo1lpD  i s;s) ruoir3oydame  icils)arrrxrooo4aptomieiydlsDrlumon(4 etnxf tatlpte ivo t sexm(rpoo1llen fvsa(fsDurxr ;u4tpe mi3iys m el(mo ()trerif iydopte n i s sexm(m3oo1lm emfet (f 2tr( pou1aetnmfeiatlsDrmnvo;()aeenir3tytfaDeluvsls0s2xr(mpou1ale mfvs (fsrua(ro;u4oeeo ociyd a ea(mont0 rtrir3ootopDeli s (0 rxrim io1ameelnvtltfarurxm ou4aetn i3tat a emuvpnu0tetrio3oo1lpD ln o s  2xo(r3iy4lpt  fetls)sDua(r nt1tlxn fetytfmDuanmo ()alxomf3oytfaDelueo;( seumxopno4apt mnctas) 2tm(rp;u4olx ii3ias s um(mo;(0aetomr iadfm e nes (0tetm(opio4al nmnei sfa2rau pou1aee if3iysfm em(vont)alermocoodlm e ivsl(  euoxo3iudoltnlivs tfsrtmu pnu4altnifeilslm umu s t0 ltrxfctotlm rlivo;(0s2tm(m iodopt mfvs sf 2rr(m ;u1alen ieildla el( o (0 etnxrcoo1fmtr n slt0s2to(o nudlmtelivtl()srrmx pnt1tetoiieiadfaDuluvo;t0 rtrxo3totlm raneo s s2um(o3nydlltemivsl( aDumxmp;u0tlxo i3tyt s2rauvp;u) rtnmfcoatlptrau sls)t2umim3nydlme lnvta() rrr( onu1oee  iciyd a2el(vp;t)artnmo3iy1latr ieo;(0 2urirpiy4omenmneiat arum(  ;u1opt mociatlm2elu snu)trxoxo3oo1oa eauei s)s2xrir oy1amt lfvsls)arur(mpou0texnifetysfa raump u0tetnmrciotomDr nvs t  2xrir oodamt mnvt tfaruaxmono0tltomociadfm2um(vo;() exoxf todla e uvs ( t2tm(rpio4olenlivil()a2uaxrono1teeo fetadlsDum(mp t)tetrxf3oo1fp rli ilt) ruoxmpio1op  mfeiasfsrtmum ot0optn f3ils a ua(vo u4 lerxr iodlmDr i sl()s2tr(rpoy4lm  lnctltf Dtmu ooo4aexnii3iasfs2el( snt)aeenir ta1lat anvs t0 rxmio io4amenmncsltfs2trxmoou1olxo f3iys s rlnvpnu0tlerif todlmDeanvsl(0seur(mpno1alte ici ( aDtmurpot1tpx ioctytls2ranmp;t4altnxocoytomD lieil() exoxr3no1op elieil()arurur nu4alxnmociat aDrl(mp;t0tlxrmocoa1omDeln ols0teumiopiydoptnmfesltfa2um(moot4optn f3tyslaDel( s;u0 exoircoytoa ranei;( s2umim nudol nlnctltfsDtmxm ;u1tlenii3iatfs2ul(vs t) lxomf3tydfptr nvo;(  eurxmpoydlltelicilt) 2ra(r ;u4oeenmfeilsfs rlnmonu4tlerxr3iadfm e ies;() etrirpio1lm nmici s)srtrx onu1aee iiciytls uln s (4trxrxrcoatom r n s (0t2xoxo3nu4openmfet t)s2trxm ou0tlt mi3iyt s2ulnvsn(0trermrciytlm rlu s;t)s2tm(rpnu1lmtemncta(fsDtaur ot1tetnifctyslaDulnvonu4aeenmfcoo1late i ils)seumxm3nodllt lies (f rrrxmpnu1teeoiociadlsDrmnvpn(4 rtomoctodfaD ai s s  2trio oudalenmfctl()artm(  nt0tee mfeiyt s eaumo;u)trxnio3ty1fmtr uvils t2to(rpoy1omt mnei s s2trxmo;t1optn oeildls2elumsnu)alenmf iatopD aivs () 2toxo3io4lpt mnvta() Dua(moot1texnifcildfa2uanvpn(4 lxnxr3oatop eln o;(  rurim3oy1lle livta()s2raxr no1opxomfetld s2raums t0aeenxr oa1fa rlnvs;() exmxmpno4lp emneta(f rrrum ot4tlx mf3iyt a2eanvo;(0tetrxr iadfaD lu s;(0 2umim iu4apeemics tfartrxm nu0tptn fciltlmDuanmp (0alxrxrcio1lpD  uvslt)t2xr(m oy1am  lncsa()sDrrxro;u0tltnii3iad s umnmp u4 rtrif ta1fp  ln sl(0 2uoxmpoy4ol  mfet t) rtru  nu0tet if3iltlsDrluvpn(4trerif totfmtr ivi t0sexrio iu1altnmies sfsDra(mpnu1opxn iciatfs eau p u) exoxf iadfa r ieo;t t2urxr oy1olt mncs () Dtmx  ot1opxn o3iys aDea( s;(0areomrcootlaDeai il()seumxo ou1am n feslt a2rau  no1tleomfctyd m2uauvpnt)aetoif3tadfmt anvsl()s2uoim3ou4al  liviat)s2ta(  ;u4openiietyt m uln pnu0 exomo tadfm e i o (  rxrxopoydap n icta(fsrrax  no0tet ifeild m2el(ms;u4alerifcoy1om ranes t srxmxr3nodapeelfvsa(  2tm(m ;t4alxo o3iadla2ua(mont) lenmr totlmt lnvo;t srurir3oy1om nlfeiasfaDtrxm ;o4alx ii3iytlm2el(mo u)aetnxocto1optelnvo;(0sexrxopnudap nlnvsa(fsrtmx  ;t4texomi3tytla2eauvo u4aetrxfcootlateaueolt  eur(opoo1lleemnctls)srum(  nt4tee moctlsfaDel(vp;(4aetomf iodfpDraivo;s  2tm(m no1ole licsas s2umurpnt1ape  f3iydls2elnvo;(4trtoxfcio1lpD au i;s tetoxr3oo1apen nes tfaDuaxr ;u1alxomfeiyd s2uanvo (0trtoxociotlpD  uvslt texmim oy1olen fei tfsrrrumpno1tpxnmo3tysfm2rmn pnu)arermo3tadomDraivslt0 etoxr iudomte ivt sfsrraxmpoo1alxn ictysfa2el(mpnt4 lenif oa1fm rlneslt)trurxm3nodam  mnctlsfa2um( o;o0apt  i3iadfm2uanmp (4tltoio iy1fp  au il()s2xoiopoy1olenlfcs (fa2rrx ono1opxomieils s eauvo;t4aexrir3ia1laD ln s;s)trxo(r3oo4amtemnvils)sDuaxro;u0tptnmf3iydlm ra( pnt0tltnmr iydoaDrluvo t s2to(rpio1lpt  nei tfsrrmxr ot4aetnif3ilsfm2raump u)trxoircoydfmDrlu i;t srtrxo3oy4lp nlncs tfaDtau pou4alt mi3ias s rm(vp;u4teeoxo oa1la r n s (  2xmim iy4oleemfvt s s2ra(roou4apt iiciydlsDrlnvsnu0arxrxo3oa1omtraieol(  eurxm oo1ll  lfeias)sDuaurpot0apto icild m2ea( s;t0aexrirciotfa e i o s)t2ur(rpio1omtnmfetl(  2tmumpoo4apt ii3tldlsDeau ont) ltomfctatomDeanvo;t  2xmxopou1apt mfvia(fs2ra(mp;t0teto octysfa2rlumo t0 rxnif iatomtelivslt) 2uriopiu1lle lnetas)sDumumo;t4apxoif3tad m2eluvo t0 ltrxocoa1lmt lnvi t)srxoir oy1ll elfci sfarrmuro;t4aex moetadla uluvo;(0treomr3totfmt  u s t)t2toxo3io1aleelnvt tfaruaxm ou4tpen iciysfs rmn p;()texoxr3iydfate nvilt0t2toxr oo4apeemfciat a2rrx pot0aee  ictatfm em(vpnt4tltrxf3oatfp rai ils0sruoir iu4lmen fvs (  Dumxmp;u1aexoio3tls s2rmu s t0trtomfcoodfaDrauei t) rxrxmpiy4llee nesasf Drmu pou0altomo3iltfa rluvp t4tltomr iytomD lnei;()srum(m3ny1ome  fvi t)sDrax  ;o1tlt miciaslm2rln sn(0trxnxf iy1lmt  u il(  rxm(r iodape miesas)a2uaxmpou1oexo feiyt sDelnmo t)aexoxo oodoateaueols)sexoim nudapeelfct s srtmu  ot1tpxn f3iltlmDelnmsnu)trxnxo tadomDrau i s) rtr(mpiy4ameelicia( sruau ont4tpto oeiyt sDuaump t)altnir iotopte ues t0texmirpiy1apenmnvsat)srum(r ;u1alxniieildfmDuau pnt4tltomf3ty1lmDr u il()sexmxmpoodol nliei ( aDtrx pou4oeen o3ils m rauvs (4 eenifctotomtrlnvs t0srxr(r nu1lmt mnctl( a2tm( o;u1tpeoioetadfm ea(vo;(0 rxoifcto1latean ols  exr(o3ou4ol emnctl(  2rrxro;u1tleomo3ild s uln ont0teeomr tatlpteluvs;()trxo(o3iu4lltnmneta(  2tax o;u0olx  oeiasfm2ran o (4 etnif3to1lmDrlieo;t0s2uo(opiy1ope lnvs ( a2tmx  ;u4tlenmociyd m2rm(mo;t)aetomrctodfptr u s t  eumxrpiy4lleelicsl() 2rrxmp;t0tetomicilt aDemums t)tetomf3ia1fa r i il(  2tm(rpou1om nlnctls s2umxm ot4oexniieildfm2um( p u)aeenmr3oodopt  n s;t  2tmim io1lp n fvias)s2uax p;o1ole iociasfm2umumo (0 rxnxo3oatfaDe u o t0 euriopoydoltnmnei t) Dtr(mpot4oet  ieiytlm2ra( on()tlxoircootfpDe ieil() rxrxm3iy1am   feslt)sDrr(rp;o1teeomoetaslm2emnmo;t4artnxf3iytfmDe n sl(0 2tr(o3ny1omt lfes ( a2tr(  ot0aeeomieiysfm rlnvo;t0tltnir oatlmDraueolt0 2urim3iu4lmtemfct s srtaxmpou0olt ioeiltlsDuanmpn(0tlerxr3iy1lmD  ueslt truoiopoodlp emiei tf rtm( p;u1aptn feias s2ra( snt)artnmf3ia1omt aneo;()s2umim nydomt lfctat s2rrxr nu0olen ietldfsDrmn o u4areoxocta1fpDelivil(0srxr(rpiu4op  mnetls a2taum ot4ole iociys m2rlums u) exomf3tatoa e nes () 2umir3oudop n fvi s  rtrumpnt0tlt  ieias s uaumonu0 lxnmo3tatoa r n o;t)s2trio3iydamenmnvtls sDtrur nt0tlx ifcias a eau s;(4trenmoctodop  auvs;t0sruoxm ny4am   neslsfsDtm(monu1apx mfctad mDrau p (4tlxoxocty1oat  ivs s sruoxr io4ameemnvsat  rtmxmp;u1aleo i3tadlsDrm(vp t)arxnir tatfmDrlivs;s0s2umirpoo4am emfei sf Drmu p;t0olx  fciydfs2ua(vs t) lxnmr3iodopDranvolt)s2xrir3iy1ole mivs (  rraumo;o1alxo ictyt s umu snt0tetnio3oa1lmt anvsls0 2xo(mpio4oltelfetas arrrum oo4tlx mo3il
\ No newline at end of file
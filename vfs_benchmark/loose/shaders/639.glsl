@@ -0,0 +1 @@
+ivo s0trurxr3nodoptnlfvslsfarta(m ou4apt mieiltfa rl(mon(0 eenmo oo1fmDr nvils)setrxm3iy4openlfvs (fsrrmxm ou1tpxniieiyd s el( ont) eeoirctodlmD livo s  euo(m iodlp nlnes s)arrmum ot1oleomfeiys aDem( snt0tetomr3tytfpDr n il(  rxo(m io4oleemfctls srtrumpnt1olxn ictldfs um(von(0tlxoxf3iy1lmDrlies;s) ruo(m3iy4lmtelnvilt) Dtmxmoou0opeoif3tld sDuauvo t4arenmf3iadfat  ivs s0t2urir oy4am nlfet tfaDrr( p;o1olxoiociytla eauvpnu)texoxo3iydla raiesls trxo(o3oy4ole  fvta( aDrru  ot0tlen f3iadfsDum(vpn()artnif iatfpte u i;( setoir iudoptnlivs ()s2ra(  nu4oeeoii3iatfa ean ont4tltoir3iadlptrauvi ( t2um(rpou1opt livsl()sDua(mpoo1tlxomf3iltlm2ea(vo (4arxnxr ta1lpt  ueilt0t2xmxopoydlmen nvsl(faDtr( o;t4opt mf3tatfmDel(mp u4 rermo3iadlp eluvs s)trtrio oo4ome  ivil(fsrta(r oo1oee mfctyt sDranvp;t0aexoir3oydoa e ueo s  rur(mpno4olenmnvi sf 2tax  ot4tpxn oeiadfm rauvpnt4tetrmf oadlmteluvo;t0srumxm3oy4oltnmnvil(  Dum(moou0altomf3tls a2umu p;u4aetoxfcoatlpD aieils0 2xo(mpiy1opt  ictlt) Dtm(  ;u4tlenifctltlmDuau o;u4 rtnmrciadoa ran il()srxrio ou1lmt lfvsasfs2tm( pno4tet  i3iatls2raumo;t0 lerxrcoy1opD auvs s) rxo(m oo4lle mnesatfaDur(r ou4aeeo iciytfs2uanvpnt)texnmoctodopDrlu i;()t2urio oudame mfcs s  rraxmp;o4opxnif3iadla umu p (4treriocta1lm   nvsls0 2tmirpnudllte nvtls s2tm(  ;t0apx ioctlsfsDua( sn(4 lxomo to1lp eln s s)t2umiopoo4ope lnvi tf rtm(mooo0aet  i3iltls rmuvp;u4 eenifciadlaDeaieo;t teuo(m ou1alteliet tf 2rmu  no4alxn ociadlmDemu snu) rtomo iytlmt lu i s0 rxoio iodaltnmfesls)s2urumono4aeenmf3tyt sDemnms t)aetrir tatoate ueo t  eurimpnudlp   fvt s)aDtm( o;u4tptnifctyt m em(vpnt4 rtrircty1oatr u i;s0trxmirpno4lpenmnei sf 2ra(mo;o0apto fetatlm2emn pnt0 leoxrcia1optrauvi;t0srtoio3io1lp   net s  2tmx onu0aeto ociys a2ul(mp (0 etrmrcoo1omD lnes;(0 rtrio3nu1aptemivtat)s2rmxmpou4apxnmietldlmDemuvsnu4 rtrxocta1fmD  uvs s0tetrio3oo4apt  fcs s  Dtr(m ;o0tet if3taslaDemuvp u)trtrxf ty1omD  ieilt0 2urxmpnudlltn fvtl() 2tmum ou0tpt io3iysfmDul(vs;t) rerxocto1oa r nvol()s2um(r iydol e ieils) Dum(m ;o1tlt mieiltla el( s;u)artrxrciadfpt lues;t trxm(r3iudlptnmfvi s  Drmxr oo1oeen oetas a2emums;t0teermfciy1lptrauei;t0sexoimpnu1amee ietltfsDtr(rono4aee  i3iat m rlu o t0arermo tadlatelnvi;t tetoxrpoo1ol n ncsls s2ra(m nu1olxn i3iltfsDul(vo t4teeomf3tadlmDraueo t  ruoimpiydale  nes sfs2rm(rooo4alt mfeiysls ul(vo;()alxrifctydlptrau ils0s2to(o no4amenmnctas)a2tr(ro;u1tpe ii3tyt s2rauvp;u)tltrxr3oy1opteauvol(  etr(r3oydlleelivsl()s2trur oo4tltn o3ild sDrm( snu4aetoircty1op eauvi;s0teuo(opio4optnmiciatf 2rmur ;t1tlt mietyt a2ea(mp u4 rtomo3io1fa   n s (0 2xoxr3io4omtnmfci s  rrax  oo0tex iictysfsDrl(mo u4tetrxf3tadopte neo s)trurxrpou1ll nlfvt t)sDur(  ;t1apeomo3iltlm2elnvo;t) rxoxf3oadfat  ies;() 2xmirpoydalen nvtlt)sDtmu pnu4olen i3ils m2rmnvo t0 lxnir3tydfmDr nvsls0 2trim ou1lmtnlfviat sDtau  ;t1aptn i3tlt a2rl( on(0tltrio to1oa rau i (0 rxrio3oodaltn ictlt)s2taumoot4tpxo i3tysfsDrluvpn()aeermf3iydfaDelnvs t0teum(opno4openlfeiatfsrrmx pnu1tetnif3iydfmDem(mo u0 rermr iadlp rau s t0setoir3iodomee fct t s2rm(  nu0oet iietyd s umu s;t)aetrircoadomtr ieslt0s2tr(rpoo4apt mnesas) Dumxr no0tlenmieilsfs ul( p;()aleomf io1faD lueil()tetr(r3nu4ol n fvt (  rra(rpnt4alxniieils m2umuvo;(4tetoxfcoy1op  lieol( seurio3ny4omtnlivs sfaruaxr ;o4tpxomietyd m ranms;(4aleomr oo1oatean ilt) rtmxopio4ameemfvilt)s2tru pot0aeeoifeiytfa rm(vp (4 exnxr3tytlaDr i olt0 rxrir iu1ape lnct () Dur(m nt4texn feiyslm ra( ont4tlenir tytlat anvsl(0s2xr(o3iydal n ivtl(fa2taumont0teeo ietytlmDeln snu4 eeriociotlaDr n o ()s2uoxr3io1olen net s aDumxr nu1aleo o3ils a ranmo;t4trenxo ta1lmtrln ils  2trxo nydlm elnesa() 2rru oot0aex mfeias m rln s u)trxrmr totoptelnvs;t)s2to(m3nodap elfeias)arrr( o;o0tetnioeilsfa ranvo u0 eerxr io1fpt lu i;t)t2toir ny4om n neils)sDua(  ou4aexo fctat s rmuvo u)arxoxfcoadoateau ol()trtrim ny4am e ictat  Drmx onu1opx  f3ils a2emnmpnu0aexnio ia1lat ln i;t)trtm(mpio1apee fcil()a2tau  no4ole iieiaslm um( s u4 lxnif iatfaD aivi s s2tr(r ny1om e feiat)srtm(  ;o1oee ioeiadfaDemnmo;() etoir3iytfm ean slt) 2umim3ny4omt mnetlt  Drmxm nt0apxomocilsfsDumu s;t4artrxf io1fm eaiei;t)t2xrio3iydamenlici s)aDrmumpot4alxnmoetaslsDeau onu0trtoio oodomtrlueols0s2toxo3ou1ope  fcs t  ruru pou4apt iociytlaDul( snu0alenxr iydlaDe uei;s  exr(mpnudomt licsl( aDumuro;o4oetnioetyd m rlnmp (4 rerxr iadfpt lnvsl()teumim3ou4amen ictat) 2tmu  ot1tle mfetas s um( s;u0 lxnmr iatfp   i ol(0t2xoxm iudlpenlnci tf rrr(rpot0tlxo f3tldfa ua(mo u) rxrmr oy1omDe ueo;t t2toir3nu4oleelietlt)s2rmumoou1aetoio3tat aDranmo;u0 renxr io1omDeaieo t)truoxopiy1am   fcsls a2uau pou0aeeomf3iatls ea(mpnu4aleomrctotfatelu i s)t2umxm iy1ll  lnvsas s2rmu pnt1oexnifetlslmDelnmp u4 rtoio3io1faD lneo t0 eto(opnydap   fcia() 2ta(r ou1alenmieiasfa ulnvs;(0aetnxf3oa1oa eaivi t0texrxr3nydlme mfes sfsrtaxrono1tetnmfeiat s ua( o;t4trenif iytomDr nei;(0srum(mpou1aptn ivs tfsrtr(m ;t0tetn ociad mDum(monu)altrxf ty1lpD ln i (0s2xoim3iy1opteliesa(f Drru poo1oetoio3iltfaDrlu s t4altomf3ootfa  livi;( setoxr iy1al   ivilt arurumo;t4aee if3iyslmDranvp t4 eenmocto1fatrli i () rxrio3iodlmtn fvsa(  2rr(rpoo0apt ioeilsfm2ea( p;t4 rerxoctodlmD livilt  exo(rpiy4om elnvils  Dtmxm nt1oex  oetysls2rlump t0altrir3iy1lpD ai slt t2toxmpoo1ameelietltf 2rmxronu4aeeo oeiasfaDel(mo;u)arxomo3tydlaDeaueol( tetoxm3iydllt mfcil(f rum(rono4tetoif3tyt aDran s t)tltnmrciydfa  aueo;t) etm(o io4olee nesltfarumx pou0oex  i3tltlmDem(vp;u4trerxr iytomtr nvi s) etrimpoydomen nvilt)arumxrp;t1alenmfeiyd a ra(vpn(4areoxo3iydfatr ivi;t)sexr(o ny1lpeelnet ( a2um(mp;o1oleo feild a umn o (0 exnmfcty1lmtr nvol(0teurimpoo4ope mici tfa2umx pot4aet mfetlsfa rmn o;u0tleomf oadfpDrauvs () 2uo(opno4omee ieslt a2raum ;t0tpx miciydla eaums;(4altrio3oodfaDeauei;s) rxoxm ou1ol nmicsat)s2trx  nu1tetniocias sDum( pn(4tltomrciotop rauvi t  eum(m nu1amt  fviatfsDtaxrooo0oetomietld s rmn s (4 ltomo tatlmDe ieo;t tetmim3nu1om emfcsl( artrurpot1opx if3iysfm ulu ont0 ltnio3oy1op ran il(  2urxrpnydlltn nci s a2tr(root1tlx  f3tls m emumo ()artrif to1om   n ols) exmxm io1lp   ictat aruauront4ole  f3tyt s umuvs (4trenirciydomtelivo ()trxmim oo1om e nvsatfaDum(m ot4aet iiciytlm eau snt0artrif3oadoa elneslt) etoxm3oy1am nlivtas)s2uax p;t0olx  f3iltfsDea(vpn()tltrmf totlmtelneil(  2uoxr oudal elfvs s) Drm(m ;t4altnii3iaslaDrm(vp u)texnmociatfpDeanvs;t0 rxmxrpou4ol nlieta()artr(  no4olt  ieildla rlu s;t) renioctatoatran s;t0s2xmxo nudll e fci s) rrmxro;o0tpen o3iltfaDrau o;()alenmfciotoa  an s;(  rtoxo ny4ameelici t)a2urumpou1oetoio3tas s2rmumpnt0 rtnmr3io1omteln olt) rxrirpno4alenlnvi t  2ra(  ot0tet mi3tytfa rmump;()tetoxocoa1fat luvo;s0srumxo oo1lm elnviat  Dtrxmont1tetoio3iyt a2em( pnt0 rtrmrctadfmteau s s  eumxrpny1lm nmnvt t)sDtr(mpot4tpeo feiatfm2ua( o;u)altoxf3tadfa eai s s  eurirpny1altnmfviasfa2truro;u1ope ifcilt s ua(vo u) rermf3oytfpD  ieo;s texoio3no1lmenlfctat srta( onu4tet  ociaslmDra(mp t) eeoif ia1lpt an o t)t2to(opno1lpt lfeta() Dum(  nu4oet mo3iatfm rl(msnu4 etrirctytoaD lies (0 exm(o oy1lptnmiei ()artr( p;o1tex mo3iatfm2rlumo u) rxrmrciotom  lneo ()trurxrpnu4lm n fvs ()a2ururpoo4oleoifeiltlaDrauvonu0trtnmr iatop   ivs s0 euoxo io1al   nctlt sDtax p;u1apeo i3iadfs eanvp t4areoio iadomtr ivo;s0s2urio iy4lpe lnesat  Dtrx  ou4olxnmfetlsfm um(mo u4tetnxr3io1lpt  uvi;(0trxmxo no1aleemicilt)a2rrxmpoo0oee mf3iad s2rlu ont0 lxomfcty1la   uvsl(0s2tmxm3oodlm n fvt tfsDrm(r ou4opto i3tls mDea(vsnu)artoifciotlptrai i;t0 2to(mpiu4ol nmnvs s) 2tax  ;t1optomo3iadfsDulnvp;t0 etnxr3oatfmDran il()srxm(m3io1olen fvtl( srrax  oo4tet ioeilsfs2ea( ont)aexnxfctotlpteai ilt)s2ur(r iu4omeelnvtl(f rum(mo;u0tlen o3iat a2uanvo t4 leomocoo1opte uvs;(  2tmxm io4lpt livsl( arurx  oo4alx iiciydfsDuaums;t0 lxoif iadlaDelu o s0 2um(opny1ll  mfcils a2tr(r ;t1alto ieiydfsDranvp ()altomfcoadfpt  n i (0 2umxo3io4aleemnet t) rrrur ot0apeoifeilsfm2ua( snt0teeomr3oytfate ies t0t2uoxm ny4lm  mfct s artm(rpnt4alen fetytfmDem(vsnu0tltnxrciydfm   n i;( srumio nydlle  nesls a2trxrp;t1olto ietytfm umnvsn(4 lxrif3iadla  lnvs;s teuo(opiu1lm  livs t aruaxrpot1oeeo oeiltlm2ra( p u4tleoif tydlat  ieo (0s2umxo ou1ll   ivta( arurxmpoo0oeenmf3iyd a ulnmsnu)trtrmocoy1lmt lu s;s)srtmio oo1lleelici sfsDumxmoot0tptnif3tatls2rln pn(4tlenmo totfmt au i t) 2xo(m ny4lltelncil(fs2tr(mooo1teenmieiltfa umn snu0 lenmo3totopt  u s;()s2ur(rpno4ape lnet tf Dtr(  ou1tee  fciytfm2emnmsnt0arxoxo oa1omtraieil(  etr(m nydop emfcs t)s2um(ronu1altoii3iasfm el(vpnt4trxniocoatlaD  i il()texr(o iydol  lnci sf Duaxroot4opeomo3iasla rauvsnt)tltrxociodop  au i t)t2uoir3no4oltelncil()sDrmu  ;u4tlx iictysfm2rmn p;u)trxoir3oa1faD lnvi;s0s2toirpiydlmte ici ( aDuau o;u1texn f3tld s2raums;(4tlxoxo3oo1opDraues;t trxmim iodlmee nesa()srtaxr ou4texnmfeiyd aDrlnmp (0 rtoirciydfaDrln s;() rurxr io4am e netlsfaDrm(r ot1tet mieiasls uan o ()trtnxf3tydop  ln i;t s2um(r iu1olen iesl()sDuaxrpnu0ale moetltfa em(vs t4 eenmr3tytfmDr neslt trumirpiy4opt  ncta()aDrm(m ;u0openifctysla eau p ()trtoiociodfpt  ieo (0srtr(m3nydope lncslsfs2ua(r ot0tpxniieiltfa2ua( s () eermr ia1oaDeaueils setr(mpoy1omtnlnetl(fsDtm(  ;t0tptomiciasfmDumnmsnt0teenir iydfmDe ivo;( trurxo3iu1ame lnci () 2trxrp;o1tlenif3tadls eluvs;u0 ltoif oytlmt  i slt0texriopiu4lm nmfvs t)aDumxmpnt0texn f3tytfaDeauvpnu)artnxo3ia1om   n o t0 2ur(o3iu1ll nlfeilt) rrmumoou4tpenmiciat m uln ont4trtomrcootlm  ln o s trurim3iu1lmee fvt tfsrra( ont0olxn oetyt a rau s;t0texomocootopD lnvs;s0trtrxmpiydapee netl(fsrtrxrp;t1openio3iys a2emnvo;u)aeerirciytoptr u i;t0srxmim iydll   ics s) rtaxr ;t0aetomfetldfs ulu s;u4arxoir iadopte ies;() 2xmxrpoodlmen fvt s  Dra(rp;u0apxomfctyslm2emuvo;()tltoir iodopD ln il( s2uoirpiydomeelfvtls s2rrx o;t1open fciyt a um( p t)tltoxrcoodomDrln sl(0 2xm(r iu4ol elnvt t aDua(rpno1alxnii3tld s2rlnvp;(0aeenmf3tadfmDrluei s) eto(o iydale lnvt sfarraxmo;u1tpxnmo3iltla2emums;t0alxrxf3totfmDrlivo t) 2toxm iydllte ivsl(f 2ta( pot4teto i3ild a umuvpnu)altrifcoydom e ivs;(  2xmio iydll   nvt tfs2ra(  ot4openmocild s eau ont0alxnxo3oydoaDraieolt)t2toir oy4omtnmivsl() Dua( p;t0tpx  ieiyd sDua(vsn(0 reomr tydfa  ln ils0setoir nu4om   nvs ()srtm(mono0tleoii3iytlm emnmont0 rxoifciydfate ivo s  eurimpiu1lmt mnciasf 2raxmpnt4oee ioeiyd aDemn pnu4 etrmo3tydoaDelneo;(0teumxmpnu4am   ncilsfs2rauro;t0opeoio3tys m2ul(mp;t4aexoirciy1fmD  n o ()setmiopoo4lp   icil(fa2umxrp;t1apenifciys a2rlnvpnu)alenxf oodom eaneo;s t2xrio oo1lp n iviatfaDra(  ;t4tlt  octyd s2eln s t0teermf tytfmt lieol(  euoio3nydop e iesas) 2tru pou0oee io3ild mDelnvp t4 lenxf3iodlmte i sl(0s2xoiopio4ole mnvsasfs2rmumoou1olto f3iyt s2elnmp t)treomfcoytfmtranvi s) euo(opnydope mnvsls)aDraxm no4ale mfeiasla raumo (4 ltomf oo1fpDraivols s2um(o oodoptnlfvs t)srurxrpnt1oetn ietytfs2rl( snu0 lxomr ootopDeai i ()t2xrimpiudapenmnct sfsDta(mo;o0oltnifciyd m2ra(vs;(4tetrxo todfp elieol(  etmim3nodlpe lnvilt)artmx o;u0open iciys a2um(mo t4tltrmfciytfpt an i;t0s2toir3oodam eliet t)a2tau o;u4aetomo3tatfa ra(ms;t4aleoiocoytomt aieo;s0 2xrxm3ou4ameemict sf Duaxroot4altniieiysfs uau o;u4aeerxf3oy1oaDe i i;t)sexoxr iudlpen icilt)a2trx onu1aexnmfctatfsDumu p t4alxoxo iy1fatr uvi s) rtoxm3nudll   nvi sfsrua(  ;o4olt mietldfm em( o;(4texrmr3iotfp  lneil(0 2tr(opny4altnlict ()aDurxmpot4apeoif3tyt mDraump;t4 exnmr3iotfa  lneils  etm(m3io4om nlnci () rurx  oo1tlxnmoeiltlmDum(vsnu)trtrio3iy1oaDraueolt)srur(mpno4llt lietls srum(  ;u0tpe ifetltlm2rmn o;u) rxrifciodfmte nvs s)sruoxo oo4lpeelfvslt arra(rp;u4aetomieias mDeaump;u) renmo3oy1la  aiesl( srxrxr ou4lpeemfvt s srrrum ;t1ape  feildls ea( on(0 lxrif3tadlaD li ilt  eurxm io1ame  fei s)a2rr(mpou1tpxnmiciytfs uanvp t4aexoir3tytomt lneslt0teto(mpiy4lpenlfvs tfarumurpoo1olx mi3ildlsDel(vo t0 exrmr3oo1la e ivs t  2xoio no1ll   fci ( arra(mono0olt iieiasfa2rau sn(4texrmocta1fpD  u ols)s2uoxm3no4am  lnesatfsrtaur nt4aex mf3iad s2eanvo;(4 rxrmr iatomteanvs;s  2uoirpoodop n fvilt)a2trur oo0tex mieilslm2ranvo u) lerxf io1fa  an s;t setoim3iy1lm n fvslt) ruaur nu4opx mf3iysfs eaump t)trenxrcoo1fmt  ueo;()s2xmim nudlpt mnes ( arraxmoot1tle  f3ildfs rmu p;(4 rxnmf todomDe ueolt0s2trirpno4al  mieias)s2um(m oo4teenmociatfm umumon(4trtnircty1lpDelivs s0 etoim iy4am emncsa( arrm(m oo1oexn f3tlsfa rlumpn()tetoif3iodfat lneil( trxoxrpno4optelnei ( aDtr(moot1tet  fciysla2eaump ()trtrmfcia1opt lueo t)s2xm(r iu4ol e ivsl() Dtrumo;o4apto octytlsDum(mpnt4 lxnifctodoatran ilt0texrio3nydll  mnvt tfsDtax ooo4tee  feiltfmDrauvs;t0alxnmrciotfmteaneil( sruoxopoo4opt  fesls s2ua(mono0ale mfeiytfa ulumpnu)trxoxo3tytlaDrli s;(0s2tmxmpnydom elnvsas aDra( ont0aet iociadlsDuluvs;() ltrifciy1lpt  ivo s0 eumimpny4amenlicsls srraxroou4oleo oeias m2ulu s t0 rerir3ia1fm ean o s)trxmio oo1om emicia(f 2tm(ro;u4tee ii3tytls2eln ont) exoio io1omtrai s;s)srtmio nu1oltnlnvil()aDtrumpoo4oexnmi3tad a2em(vs;(0tetomo iytfa r ieslt) eurirpiy4olt  ncsa(f Dur(r ot4tex mictadfs rauvsnt)teeomr ty1oa ran sls  2xrimpno1altelietas)s2tm( poo1alx mietlsfa2el(mo;u) rxoxo to1lm  lieilt)teuoir3oo4apeelieilt)artrum nu1oeen ieild m umnvp;t4alxnmf oytfmt aieil()s2toiopoy1lptelfvsa( srtaxm no0tptoiictydfaDrmuvpnu4 exnmr3iadfatrluvilt) exr(o iu4altnmnetls arumxmp;o1tlxomi3tltfs ua(mp;()aexrmfctatfm r ueo;t teto(o3oy1op  mfetls)srur(ro;o0tpx  fciytla2eaumsnu4teerxo ta1fmt luvi (0 2toir3iu1apen ivt s)arraumonu0tlenii3iys m rmumpnu4teeomr3tydom   nei s trxoir3ou1ope  fesasfaDum( oot1tltomf3iyd a2rm( snt)trerio3iadopt lueo t0 2urxmpoo4ll n neslt a2tau  oo0tlt  o3tlsfmDum(ms ()tltoxfciy1laD anvi;s  2uo(m no1oltn fcs (fs2tru  ;u1opxoifcildla2rln s (4 etnmrcoa1omD ln o;( tetmio3nu1lme mfciatfaDra(rono0tleo i3tydla ra( pnu)altrircoatoaD anvs;s t2trxo nodopte ivtls srua(ro;u4opeo i3tydls rl(vs u4tlenxr totfa e n s s t2toxm iodap   nvt ()srua(ro;u1tlxnif3ildfm2umu s u4teeomfctotop   u s t  rxoim oudopee nesltfsDtaxmp;t1aeto o3iyslsDuaumsn(0trerio3tadop r ivolt)trxm(r3ny1alte nvtas) 2tmumpnu0alt moetlslm2em(vsnt0trtomo3oydfmDrai ilt)s2toirpoo1ame  fes t a2tr(mo;t0oeenifcias a2ua(vsnu0trermrctadoa eau o;s trxm(m3oudlm e ies s)aDta(  nu1aexnmi3tyslsDelump;(4tlenmo3oa1omDraueols)trumxmpoydome mfct s)srtr(rooo1ape ifciaslm ea(ms t4treriocia1opt  uvo;t0 2uoimpnu1opt  ivtlsfarrm(mp;o4tlxnmoctldfm umu onu0 rxrif3ootfpDrlu il()trxoxmpoudlmenlietas  rrrx  nu1aptn f3tlt m2elnvo;t0tleoio oydomtrlu s t  etrirpnu1ap elfetl()aDrmum no4oeeoifciatfm ul( o t)trtrir todfmtrauvo;() 2uoxmpio4apeelnvslt  Dua( pou4ope  ieilsfa rmu s;u0 rxomfcootfm  aieilt0srtr(r3nu1ope lfctls  2ur(ronu0aleo ociys m2eln on(0trerxfcty1fm rlueilt0teuoim3nodaptemietatfa2rr(mpoo4ope  ieiasla2ulu s;()tetnmr tydfmDean o;t)trxmxm oudole lncilt)srtrur nu4ope io3iad s2eluvp (4teerio3iydlmDraieo s sexmir3ou1om emiei (fs2ur(  oo4tlto i3ilsfa rlnmo;t4 lermo3iy1optelieo;t)s2toiopio4ap nlfvtl()sDrax p;u4tltoif3iytfmDulnmp;(4 lxnifctatlp ean i;t  rtrxm nydale mneslsfaDrrum ;u4aeenmo3iytfm em( s;t4teerif3iadlpteln s;( trurio nydamtnmnvia(fsruaumonu0alen o3ils m2em( sn(0 ltomf iy1la raueslt  eum(o nu1oltnmnvtat)aDtm(r ou0tpt io3iadfm ua( snt0tltoxf3iatomte iesl(  exoim3io1al   ncsl()srtm(r ;u4aet  ietyslm2rmn o;(0arxniociadfatrli s;(0srtrir iydalt mfetas)s2rm(r ;o0alxniiciyt s eau pnu) leoxo3oy1oa eanvi;(0t2to(o ou4ameemnvias)aDraxro;o0tpen fetlsfs2ulumo t0trtrxo oo1la  liei;s)texrxr nudam nlfeias aruaxmo;u1tlx  ocildls2rl(mp;t)trerif io1lpt an s ()trur(opoo4omtnmfvtat a2ua( pot1aptnioeiyslm2uaumonu0trxrxocoatlp rau i;() 2ur(mpnodllenmnvsat)arurxro;o4aexnii3tas a umnmsnt4aexnxr tadfm r neol(0 exoxmpnu4olt  fetasf 2raump;u0tpxomieiytfs ul( pn(0aexoio ia1omDrlneo;s0srumiopio1om elici tfaDua(rpou4tpeniietyd mDrmn p;t)aexoxfctadlateliesls trtriopou4al emfeslt)a2rrumpnt1apto fciatfm rlu s u0 lerir3iodfm  aieilt)s2xr(o ou4om emnvia( s2ta(m nu4ope mieiysfm eauvo;t0trenxfcty1lptrlivs s  2xr(mpiy1ap  lnvtl( a2um(m ;t1olxomfctas a2ranvo;u0alxnmociotfp eliei ( trto(o iy1op  lfetas s2ra(r ;o4aptnmfciltfaDeln pnu) ltrmo3oy1fm rlivsl(  2tm(opio1lltemnei (  2trxmpot1alxnmictldlaDum(mpnu4 ltnxf3tatlat  i ils0s2uoxrpiu4lp n nct ( a2rmu ooo4opt  ociaslm2emnvsnt0aetrio oatlaD  neils0t2ur(rpiy4ameemivi (farumx  oo1alxoif3tltlm ul(vs t0tlxnxo tatfpDeanvi t)seum(o3no1ll  lnviltfsDuaurpno1oetoiiciatla2emn sn() ltnifcoatfa eluei t)srtr(r3oo1lmeemivi tfaDtrxm ;t0alxnmoetatfsDua(vs t)artrif ia1lp eaueo;( s2uriopiodlme licsls  2ta( ono4aetn fcildlsDulumo () rerif iadomt li s;s) 2xoxo iu4lmenlfvtlt)s2trur ot4tle miciltla2rl(vp t)arxrir iadfaDr i sls)seuoxo nu4lptemfvs s srraurpnu1olen fciyt m2elnvsnu) rtomf3oadfpt  u ol( t2umxmpiu4lpe mnesa(  2uau  ;t0tpxnmocilt mDrl(vo;(0 rtnxo3ty1fm  aieolt)t2toim iydll nmfctlt)aDrmxmpnu0aptnmoctydlm2ra(vp;t0trxoxr3oo1fmD lnvi s0trxoxo3iodam n fvs s)s2uau  nt4oleoiociltlm2ulnms ()trerirctotlpt  uesl(0srxmxopnudlp n ici sfaDtru  no1apxniiciys a rau p;(4aexnmo oadfpD  i sls0 rxmir nu1opee fcs t) 2umxr no0oltoioeildfa raumon(4tlxoifcoodop e u s s setmirpiodlmte nesltf 2rm( pno1ope mfctad a2emnmon(0tlxoxrciytlpD li slt  rur(m3iy4am e nci ()sruax oou0tetnifciyd s2raumpnt4trxrif oodlmDe ivo;(0teumxmpno4amt lfcsas)srtrumo;t4aptnii3tys s um(vont)arxoxrciydfa  livi;s s2urxr3oudom emfet s a2tru  ;t0oetoiiciadfs rlnmpn(0 exnxr oy1faD livo;s  eumim3oy4om  mfeta(faDra(mont1apeoioctlsfs emumpn(0aleoif to1fa  lueols s2xo(o3oo4optnlivi tf rumxmoou4tetnmf3iad a2uaumsnt0aexnxo ty1la  au il( sexrxm oudol nlnvsl() 2urxrpnt4tlt mf3tltfa uanvs;(0arenxf3todla  lu ol( s2umxr oy1ll nmneil(f 2tr(m ot0openmf3ild a2ul(vonu0tltnxfcoo1fmDe i o;s) 2xoim oy4al  lneilsfaDtmumono0oetomo3tysfsDuau s u4tlenir tytopD aneils)t2toxr3nydaleelfes () 2tru oou0oexnif3iytfs2em(ms;(4aetrxoctodla  luvi;t0 euo(m ny4aptelivs (f Draxro;o0tltn oetlsfsDemu pnu4trenxf oytlaDr n s s)tetm(r3io4lm e fciat  rumu  ;o4tpt  ieiltfs eanmp;(0teerir iatlmte neo;t0s2xm(m3iodlleemfcs tfs2ta(ro;t4alx iicild a rl(mp;t)trtnif oodla  lnvol( teuoxrpiy1llen iei t)s2ur(mp;t1olt  o3ilt s rmnmo u) etnmr3iadop  ai slt0srur(m3iudam nmnvs sf 2ra(mp;o1tet ioctldfsDelums t) rtnxo tadlptranvo;s0 2tmim3oydomtn nviatfa2urxrpou4tpxn ietat s el(mont) eenir3ia1fmD  nvs (0srumimpio4alte fvt t)srrmxrpno0aleo ociltls uau p (4tltnir3iytlmDelieo;s)trtmir nydale  icsas)aruru p;u4teeomo3tas mDrmnmpn(0teenxfciodfpD li s t) rtrxo ou4ole  ictatf rrrur ou0tltn f3tlsfmDulnvsnt4alenmr tydoptrli s t)s2tr(m3ou1opeemfvs () rtrump;o0aee io3tysfm2ea( o;()altoxf oydfm  auvo t texr(r nu4ol elfetl(farua( pnu4optoifciydfs2umu pnt)aexrxrctatom raiei;()tetrio oy4lpe mnvsls)s2uau o;u1apxn i3iltlsDea(mp t4trtnxfctydlp r iesl( t2trxo iudapeelfvtasf 2taurpou0aptnmfciad m eanvsnu0trtomo iotlm e ieolt0s2ur(r3no1amtn ivt s)sDrmxr nt1tlx  oeildfa eauvo t0trxnio3ty1fpD aivilt  exoiopny4lptelies t srrmurpnt0oetn i3tytfs
\ No newline at end of file
@@ -0,0 +1 @@
+n sls)s2umxr3io4ap nmfvsl(fsrtr(m ;t4tpt iietaslm2rmuvo u0 etniocoa1omDe iei;()tetrir3nodomt  nvtls)a2rax  ;o4aetn fciyt m2uanvs;u4 rtoxoctotlm e ivi t0srtrio ou1om  mfvsas  rtrxmono4oex mo3ild aDrl(vs;()arenmrciydlmDeaues;s0s2trxm3iodlptelncs ()s2taxm nt4aee io3tldfa2ulu o u0 etnxrciodlmDelueols0sexmxm3oy4amee iesat artr(mo;o4teen iciyslm2em( s u4tlxoxrciadfmDrau o ()tetm(r3oy1ope mfet t)s2ur(m nu4aex if3iltfsDul(vpnu)altomociytlat  ieilt)seur(mpnodomen fvtatfs2tm( ono4olx ifetld mDulumo;u0 renxo3oa1lmDelneol(0 exr(r nu4ll n nvi (  2trxmpou4oetnifetyt s2umn s;() etnmo tatlaD lueo;s0teuoxo3ny1omt lnetl( a2umur ;t0olxo oetlt s2umump;()areoxr tydoaD lnvilt0sexrio3ou1lle lnei sfaDrau p;o1apenioctytfaDea(mp (0trtoio3oydlmt au s;s0teurxo oodalenlfctls sDtau  nt4oeen iciydfs2rmnvp;(4aetomocoy1laDelieo;t)t2trim3oydllt lncsls aDuau o;u0opeo oeiydfs eaums t)treoir3tytomt  ieslt0 etm(r oudapenmfci s) Dtr(mpou1tee ioeils s umuvp;t0 rxrmf todfp  lies;(0setrxmpnu4altelivi ()srtm(rpot0teen o3iyd sDrmn snt) etrmfctodlat  ivo;s0 2xmxrpiudamte ivi sf 2rr(ront4tlt  f3iyt s elump u0aeeoifcia1fpt lieo;s0srxo(r no1lme mncsas a2rmxr ;u1tpeomoctad s umuvo;(4aexnirciydfaDr neo;s teum(mpiudoltelivils a2tm(  ot1aptn fctltfa2eaumsn(0trenmo3oadoaD ln s s)trxrxm3nu1lmt  fciatfaDta(root0opeo feiatfm eau o;t)trtoxociotop  li olt s2xmxrpiudomt  ieta()sDurxronu0apx  ieiltlsDem(mo;t0trxnxf iatoatr nvo;( texoirpiu1ll  lnvsl(fa2rr(moot4aptn fctas m uluvpnu0tleoxocta1op  aivo s0seum(opoydal nlivsltfa2ur( ono4alxo octasfsDra(mo u4 exrxr3oodop r u s t0 euo(m oydoltnlfviltf 2taxronu0optniieilslaDem(vp t0alenmoctytfpDeluvs;t)s2xoio3oodoltnlfvt s) 2rrurp;u1alxnmoctldfs um( snu4trtnmo3ty1faDeln o;t  2xo(m3iodlpeelnvsat  rtmumoou1aee  ictytfa2eau pnt0 rxnmrctadfaD an sls)teurxm oudllenlfetlt sDumxmooo1tlen i3ias m elnmpnt0 rxnir3ta1fa r ivslt  2xmxm3iudlle mfcil(fsDrrxr ot4oleomo3iasla emnvsn(4altoir iydomtrauvs;t)trxmxmpiy4lp elfvsls  rtrxro;o4tltomfcildfa emn s t)tlxnif3iodfat aivsl() rxmxrpoodaptelieta(fsDrau ono1tpxnmietas m rmn p;(0tlxrio ootlpt  i o;t) exo(r iudol emfeia(f Dumx  ;t4tpe mictydfs2emums;(0 reomoctydlptrlies s0s2umimpio1ome mfvsa(f 2um(r ou4opxo o3iatfa2ea( p (4treomf3tatomD au s t t2xm(r3oo1lmt  fet t aDtmu o;t0tltomictat s2ul(ms (4 leoif to1fp   ieolt srurimpiu1al nmfvs s)arumumo;o0alxoioctatla rmuvp (0aetrif oodfm  luvslt trxrio3oydalenlfetls)arrr(m nu1apt mfeiysfmDrm( s;t) etomo iy1oa ran i (0srtr(m3ou4optnlivtlt)arrrxmpou0tetn ietltfs2ul(mp t)trxnmrciadlmDe ieils0teum(rpno4lpte nctl()aDur(m ;u4alenio3iatlaDua( on(0 exnir3oy1laDrai slt)s2urirpoy1lpen fet (fsDrr(mont4tet iiciysls umnms u4teenxf iydfa elnvols0texrxopoodapeemncsa()s2trxm ;o4tex ii3ild a2eau s t)trxrmociadfa eaieols0 rxmio iy1lmtelnct s)aDrrxm ot1apxomi3tys s ra( onu) renxf3oadfaD  uvsl()truoir ny1amenlivs (faDraum ;u0ape moeilsfsDrmnvs;()altomoctadlm  lnvsl(  etoiopnodlpe mfesa(fsruau poo0tpx mi3tys aDrl(mpnt) etrmo oydfmD lnei;(0trxoxo3nu4ll  lfvta(fa2trxmp;t4teeo ieiltfaDeluvpn(0tetnio3ootlm r u ils  2xrim3oo1lltelfvi (fs2ta(rono0tet iiciyt a el(mp t0 eenxr tydlaDranvs t t2xrir no4olee feiat srtmxmo;t1ape ifeiltlaDemn on(0aetnir3tadfmtr ieo;s)t2trxr iy4lltelicsl( arua( pnu0alt mo3iydfm eau sn(0tlenxo3oy1fat livs;()trtoxm iu4lp elfetat)srraxrpnt0aet moctys sDem(vp;t4 etrif3io1fmD  n s;( srxrxm ou4ame mnvils sDumx o;o4tlt mo3tys m ua(msnt4 rtrmf iodfm   i o ()t2urimpio4ope  fvtas  2urxmonu0teenioeilsls emu sn(0trtomf3iydlat aivs;s) eumirpnu4op  livt ()artr(mooo0aptnmociltla2eaumont4 eenifcoatomD ai slt0t2toxrpiodap  mncsasf Duru  oo4teen oeildla eauvpn() renir ta1laDeau ilt0s2xmirpiu1amenlies s) rtrxro;o0aex  iciydfaDrln pn(0alenxf3iydfpDe i i;s seumxmpnudlmeemncs ( artm( ooo0altn oeiys m2eluvp t4tlxnmf3iytlp rlivo;(0 eum(mpiodlltemfviat  rra(mp;t4oltomociad aDemu pnu0texrio tydlp elnvo;(0trurxr iudlme lneils s2tr(roou1opxn fctad m rm( o;t) rerxo3iy1omD livo () euo(m3ou4olenlfct () Dtauronu4tpeoifctyslsDumu p u)tetoxr3oa1oaDe uvs () rxrio oy4opee nvi s) 2rax  oo0tltomieiyslm rau s;t0artrmf3iodomDranvi;(  rtr(m iydam   nct s)s2uaxm no4oexomiciad a2uauvpnu4arerxr3iydlatrluvolt)srum(m no1alte net ()arua(mpnu1ole iieiydls2elu p;t)texnio3oytlmDeauvs;()s2xm(rpno1om emivia()sDuaurooo0oltomo3iys s rlu onu4aetrmf3io1om elu s;(0s2tm(m3io4ll n fvsat  rra(mo;o4tlt  f3ild s2ul(vp;u4 rtrxf oydopte nvi t0 2xmim3ou4amtnmnvsls sDrr( o;t0oexniiciasla2uau snt4 exnir ta1fpD anvil()texoimpou4lpt  iesatfsrtmx oot4aee ifeiasfmDemumpnt)alxrmf3oatop e ieilt) euoxm nu4ape lfcsat)a2tax  oo0oltnioeiyd mDel(vo;(4alxrir oadoat livs;t)tetrir3oo1optemicsa()s2ta(monu1tlxomoeiytlm2ulums;t)artrir3tadlpDr nvilt0teumiopio1lpte iesat a2umxmo;o1oetomoetat s2rm( o (0tlxrxrcoadfmt  neo ()setmxm oy4lmt lfetlt  rum(rono4oex ii3tas a eanvs u0aeeniociatoaD  uvsls)t2uoxmpoo1oltemnesltfsruru poo4alto i3tltlm ul( s;u0trtnio oatopDeauvols0sruriopou1lp emfvi sfsDrm(r no1oeeo feiydls2rm(vp t0 etrirciatfa elu ols0t2umxm oy1al nliesa( aDtmxmo;u4apenmoeiytfa2rl(ms;t) eenir oo1op r nvi (0teuoir nu1lltelfciatfartr(ro;u0olx iiciadla emn s;u) lenmf3oodfmD aueo s) rurxopoo4apt mneiatf rurum no4oeen fetld sDulumonu) leomrcoa1oatr ivi;( sexrxopoy1olenlivtat aDra(  oo0alx  o3iltfmDeanms;t)aetrif oydlpD lies;s0t2xr(o3nodlpenlfvia(faDtr(mpnu1tee  fetadlaDrmu pnu0tetrio3iy1omt aueols0s2um(mpno1ome  nctat  Dtax  no0altomfeiysfsDuanmont4teenxfciadoptean o;()s2xrxrpiy4omtnlnctls srtaxmont0aee  i3tydlm2ra(vo;t0 exrxr iatoat  nes;s0s2urxmpoudlmee nct sf Duru  nt4oetn oeiysfsDrlu p;t0artnif oydopte i s;s srto(rpoodolen ivs s)arrmxrpoo1tptnmfeiltfsDrm( pn(0 rxnmociatopDeai o s0seur(m3iu4lpeelicia( sDtrx pou1aexniociyd a2rlumon(0tlxrmo oytlptranesls) ruoxo nydopt  ivi (faDrm(mpnt0aleniociydfs ulu s;t)tlerif iatlaD  ieols) 2trxr iu1ll n ivil(faDta(rpnu1apt mieiatfs eanmsnt)trtrmr3oy1lm eli s t s2urir oy1ope lnet s)srtmx pnu0tpt ifetad sDea(mp;t0trxomf3iodopDraueols) etr(opoydlptnmivi (  Drmu p;t4olxn f3ilsfmDuaums;t0trenmf oydlpte nvols s2urxrpiu1lltnlnvil( sruax ono1aet  ieiltlm rmumont)tetoifciadlp rai olt0teurio3oy4lpen fvtat)aDrr(r nt1aexn oeiys s uauvp;t4arxrifcta1opte ueil(0 euo(r nodlptemict t arur(mpot1optnmociadlsDuauvsn()aeeoir iydfpt  nvol( t2trio ny1ap  lfei sf 2raurooo1aeeoiicilt a2emnvont4 eenio3iotfa  anvi;s0teumio3oo4omtemnvils)srur(ro;o4tet ii3ilsfm uanvo;u0trtnxf iy1fp e ivi s trxrir iy1ap  mict sfartrxrooo1alxnifciyt m rm( pn(0areoxf tytfm eau s;t)setm(r iy4lp elnes tfs2rm(m no1oexn fcils s elu p;u0teenif oytopDrai
\ No newline at end of file
@@ -0,0 +1 @@
+n i;()seurir3no1om  livslsfartrumpot1tlxnio3tlsfa umumonu0 exrxo iytfm  anei;()teto(opiudlpenmfcil(fsruaurpnt4aet moeiytls2el( o;(0 eenxf3oadlmt anei s  rxrirpny4ape  nesa() 2ua(  oo1teeoii3tls m2ul(mp;u0aexrmrcoodoatelu o;s) eumir3oo1op emfctlt sDrmxmpno0optomiciysla rm( o;u4alxrxrciotlp e u i;s srtrirpoo1omenlfet t  rtrxm ou1oexnioctys m rau o;(0 etnxrciydfm r ivs;s0s2trir3nodop   fcsl( s2rm(r nt4tetn fcias mDuau s;u0 lermocoo1lp raieol() eum(mpno4altn ivt (  2rrxr oo4alx  ieiytfaDean o;(4 lxrio to1latr nvs;t0teuoiopio4amtelnvtl(f Dururo;u4aet ifetadfa2emnmon()arxomf oatfmtr neo;( texoio nudomt mnvsas) 2raxmoou0tltn fctyd mDrmnvsnu4altrir3iy1fmDeaueo;s srxrxo ny4lltelnvs t) rrr( onu4tle ifciyslm2eauvpn(0 rxrxfcootfaDeauvo () rxo(r iy1am e nvi t arrrx p;o4openmfeiadfa2eluvp (4alenxrctadfateauvsls setoir3io1apt mnci t sDumx p;t0altnmieiyt sDuanmon(0 lxnio iytfmtr ies t  2tmio3oodam elfvias)s2uaxm ;o1aeenmociat m2rlnmo ()tlxomf3ta1oate uvilt)sexm(rpio1open iet (fs2rrurpno4tlxomoetls s2uauvp;(0 rxoir todoaDrln il(  euoio3oo1omen feiatfaDtr(r no0aptnii3ils aDrauvo;u4 exnmr oodfm rau i s0trxoimpiy1lmt mfesasfsDumu ont4aeto f3tltla2em(vpnu4 lxoxf ta1fpD  nesl()s2trxm no1olen ictl()artmxmo;o1tetnmf3iydlm um(mp;u)trtoxrcta1oa raneo;s)t2uoiopnudop nlnesasf rtaxmpno0opt  fetltls2umn p t)teerxf3oodomtr u s;s) rurio3ou4olen neslt a2raump;t4oee  ociysfaDrmu p u0 leoioctotomt aueo t)srur(o3io1ape mfesls)a2tr(  ot4tetoio3iat aDrm(mp;t0trxnmf to1fpteau i;t0s2tr(rpio1am nmfviatf rrmxm ot1altoif3ildfm2em( o u)tlxrxfctydoaDrlues;t s2tmir no1apeemnctat s2rmurpnu1olxnio3tld s2umump;()aetrxo io1faD ln ol( s2xrxo3oo1ll n ncia() 2urxm ;o0olto f3tls aDuluvsn(0 eeoxf todoa rln i;t0 rxoxo iydlme  nvilt s2ua( ooo1aet  f3iyd aDum(vp t)altomfcta1opt  uvo;(0tetmxm ou1ope  fctl( aruru ont1oeeo fciaslm2ua(vsnu4teenxr oytop rlnvs;s trtmxopio1openlfvs s)aDtmxr ;o1tltn o3tad s rau o;t) lxoio tadopD ai slt0sexm(opio4omtemnetas  Dtaxmo;u1tlxn ictls s em(vpn(4 rtoxrciodlat lnvi;(0sexr(m3oo1lp n fcslt  Dtru o;t0tpxn ieiytfm elnvo t)alenxfctydlmDeai i;(0truoxr3iodameemict (fsDuax  nu4olenifeiys m um( onu0trenmo iy1opt li olt  2urimpiodlmenlfeslsfarurxmp;o4tleniictldfm ra(mon()aetnxfcoadla raivi;s)setoxo3nu1op   nvsls)artr( pnu1texoiieiatla2elnmsnt)aeenmrcoy1fpD ln o;s0 rtr(r3iudope  iesas a2ra(mo;o0tlt  feilt sDeln o t0aetrxr iytlatranvo t0 etoio iodapeemfesas aDta(root1aee miciytlm2rlu s;t4trenxf tadlpt  ies;()t2tmio ny1olt lfcil( sDrrx  nu0opt  ociyt aDua(vsnu) rerif3io1fpDraies t)teur(m nydam emiesa( aDtm(r ot1aptn f3iasfm2rm(mp;()aleoirctydop eli s;s0t2tmxm oodop nmfctls s2umx pnt0opeoif3iltlm2emuvp u4tlenmfcoytoptrliei;t srxm(opiydom nlicsas) Draumo;t0opxoifctyd sDulu p;()teerxf iadfpDraieols  rur(mpno1ome miesls arrmxmonu4olto i3tlsfa eln s;(4artoxr3iotomtrlneo s)t2ur(mpou1lmee neiatfsDtm(mpnt4alx ioctas a2rl( s u)tleoir iatfpt  uesl() rtrimpiy1lmeelncilt)aDuaxmpnu0aet  ieiltlsDeau p;t0texnircia1oate n o;s srurim3oudome lnvt s artmx p;o4tpen feils s ua(mo (0teeoioctytoatraieo s0 euoxm no1lptnlivtls  rumumpnu0opx iociydfs ua(msnu4tlenxrciotfaDe uei;s0trurxmpiudop  lnctls)a2raxmo;u1tlx mociysfs emu onu) eerio ootlmD lueo;s  2xoxo3iy4aleemncil(f rtm(mont4aleoif3iat s2umnms ()aeeomfcoodfpt ln s s)t2tmxm3iydap e icsl(fsrtmurp;t4tex  ocilslaDem( sn()arxoif3iydfmD  n s s0s2xrir3iu4llenlnvtas  2uau p;o4aptoif3iadfa umnmo;t0trtnxf3oa1oatranes;t0t2uo(rpio1lle lnctlt  rum(mp;t0aleo f3iad mDrm( o;u4texrmr oytomDrliei;s) 2ur(o iodam nliviltfsDra(mp;t4tpen f3iydlaDulnmo;t4trxomf tatoptelnvs;()setoxrpiu4amtnlnvtltfa2urx o;u0tet  f3iydfs rl( sn(0trxrmf iodfmt  ieo;s) 2ur(m oo4ol  livsl(  2umx  ;o4tpxo octydlmDemnmo;u4tlxrmfciadoa eau ilt srtrxo3nudoltnmnctlsfs2tau  oo1aeeoioctld m2uln s t0aexoxo3ty1omDrlues t) rxmxo ou1llte nvilsfa2rau ooo0tpx ii3iyslaDel(vp u4 rtoxr ootomDeauvslt trxoxmpoo1ole lnci s) 2tau onu1alt  f3iydls2eln o u)texrir oa1oa elivsls  rto(o3oydlp nlivtls)sDumu oot0tltnmiciadls2rmn pnt4 exomocoadomt  nvs;t0texoxm iy4apeemfctat) Drr(root4tleomf3ilsfaDrmnvp;t0artnmr3oa1fa rliei s t2xmxo ny4lle mnvtat s2rm( pot0tptn o3iatls el( onu) lxnxr iydlatraiei;t  exoxo iydam eliesat s2urxr ot4oex mfctydfsDea( snu4 rtomf3to1laDelnvo ( s2uriopoydome mivia(farrax ooo1tpx iociytlaDra(vo;()altrmocoo1omDeai o;s s2toxr iydolt mneilt srrm(r ou4alx  oeiadlm elu sn() ltoxrctadoaD an ils0srum(m3io4ol nlfciatfa2umx  ;o0aex  ietaslm uauvo;(0tlxomo3iotom  ai s;t0 2tmim3ny4olenlici s)srta(r ;o0aee io3tytfa2ra( onu) lxrif ty1fm  an il()t2ur(mpno4altemiei () rumx pot4tpt  fctltfa eau o;u) rerxr iotomDraies t sexoim3oy1amen fcilt arrmxmpoo0tle mfetysfm rlu sn(4 rxomf iadfmteanvilt) exoio oydll nlnvsl(fs2rr(m nu0tlenmieiadls2rlums;(0aeenio3todfm eli s;s t2xmiopoo4amtnmivi t)artr(rpnu0openii3tltls2umu p;u0areomo3iodfatr uvi;() rtmir3iydom  mfetltfsrtrur ;t0apxoioeiydfm rm( on(0treomocia1fm eai i s teumim3nu4apeemnvs t artaur ;t1ale ifctls m em( s (4altrifcty1fptraues;t)texm(o oo1lmeemfvslt) Duaur ;t4apenmf3tatlaDuaumon(0texoxr iodfpt  i s;(0seto(rpio1optemivilsfaDua( pno0tex  oeiys aDumn o t4tlxoif3oytfmDraivs t s2urxm3nodlpt miesa( sDumx  ou1apx mi3tatfa rl( o;t4 ltoir iytfat anvsl(0t2trim oy1lltelfci t  Drrxro;o1aptomoctadlm2eaumsnu)texrxocia1oaD  i s (0s2urxo3nodom  mncsas)srta( pou0tet iieiys mDuanvsnt4trerircoo1lm eln i;() 2toimpoydlp nliesl() Dtaxronu4tlt ifeiatlaDeanmpnu4trenio3io1la rauei t)t2xrim iu1ale lfvtlt) Drmx  ;t0opxn fetasls rmu p;(4trtnmr ty1lmt lu o;(  2xmxmpnu4om n icias  rrmu  ;o4tee  octytlaDum( on()trxnirctytfmt lueo s0 rumxm3nu1ol nmncs t)sDuax pnt4tptn i3tltlm emnvp u) rtoxr oa1fpD aiei;t0 rxmxr ou4ol nlnei t)artm(roou4tlxn iciadfmDrlumpnu4 ltniociydfpt  ues;t0tetmiopiy1lleelivsa() rrrx ono4tleniictyd s uau s;t) etnifctadlmDelieolt s2to(rpny1amtn ici (f 2ta( o;t1aet  o3tys m2rl(msnt4tltnxfcoy1fptr iei ()setr(mpoodameemiei tf rua(m ;t4oltniieiasfmDrmump u4 etoxr io1oa r n o t)trur(r io1aptemneil() rurx pot0tetomfciys s uauvpnu4arenif3tadfp e n s ()trtmxr nodap nlnct tf Duru pnt0tpeo i3iysfmDul( pnu4trtrxocoy1fmD lies s0 ruoxm3iodam nmnctls)aDrmxro;t4aex mi3iyt a2elums;u0aeenxoctadlpD aiei;()seuo(mpio1al n nvi (  rua(r nu4olenifeiadfa ulumo;u0aetoxo ootlptr ueils trxmiopiudlp nlnetat) 2tm(  ;u4aeeniicild aDemnvs t4trxnxo iodfm   uvs;s0trxr(r3oy4al   net s)srumum no0tltnioetlt m em(vs u0altrxf3ty1fmDrln o ( srumir no4openmicsltfs2rauroou4ape mi3ildla2el(vsn(4artnmf ia1om  lu ols t2xoxm io4omt mfctls) 2uaxro;o1tlen i3iad s raumon(4 rtnmo3iydlpt anes;t0s2to(m3io4lleeliesl(  2urum ot1texnmfeiatfsDeaumo;u0trxrxf3ia1latelu olt)s2xrxm nu4am   nvta( a2rru o;o4apto f3ilt mDuaums ()tltnxf3io1faD luvs;t  rtr(mpnydllen fvsl(f 2ta(m ou1oetoiictatla emn pnu0 rerxociodoaDe u i s seum(o3iy1ll e fvia() 2rm(r oo4tlt iictad sDua(vo t0tetoir3tadoa rauvi s  rtmio3iy1al elnci (fsrrax o;t0apeoioctld sDrmn p t4 lxnxfcoodlptrauvs s0 euriopou1lmtelfetlsf Dumxm ;u4aet  i3ilt m uanmo (4tetnxf iydlat lueils0tetoir ny1lmt mivtat)s2tm(mp;t4opxn o3ias aDum( p u0altrxf3todfa  luvs;t srxrxr3iudameelnes t a2taum ;t1tle  fetytlmDuln s t0tlxomr io1faDranei;s)sexm(m ou1omeemivi t)sDurumooo4olx  fctlsla uln pnt4 renif3io1oa  ai il()trumim3oy4ope lnet t)srraur ot1optn ictysla2raump u)areomo oydfpDe ues t)setmim3io1amtelnvtasfaDtm( pnu0aet mi3tas s rln on(4 lxomo3to1optranvs s0s2tmimpnydll nlfctl() 2rmum no4apt micildlm2umnvpn(4 etrxo3iatlmDe nvo t)t2xo(m3nu1ale lieta()srtrx  ot4oexn fciadfmDel( pnt4trxrmocty1omte ieo t)texriopiy4ll n fcsa( aDua(roou1altn ieiadfs um( s;() rtnmf oydop e ivsls)t2uo(rpoodape lnetl()a2rr(mp;t1tlt mfciydls2rauvonu4arxomo oy1oa elueo (0t2xmimpou4lltn fvtls) Dum( p;o1optoifeiatfs2umuvp u4altoircootoaD  i i;s  rtmirpnu4ape  fcsa( srtaxro;t4opeoioctadfm2emums u0altnxo iy1opD aivs ()trur(rpoydam e ncs sf rrmurpnt0aex ii3iyd s2ean sn(0treoirctodlm   i s;()trto(o3iydop elict (fs2trx oot4alx mfeiyd s2uau p ()teerif3oodoaDe nvi;s  2toxo nu4ll n nes tf rra(rp;t0aetoiocilsfs eauvsn(0tetomr tatfa r uei;t0t2xriopoudoltn fvilsfartrur no1alx iociatlsDem(mo t0 ltnmf oydopDelnes (0 rtrxmpiodolt lnvi (fa2um(  nu4oexo feiyt a2rlu o u0texomf3oytlp r ies;s) rtmxo no4al  miei ()s2tmxront0oltnif3iat m2ranmp t4tltnmf oa1omtelnvil(0 2tmxr oodlleelncs s)aDumxrp;o0tet iociytfa2rm( o (0tlxrxfciadlatrluvo;(0teur(r nu4lp emfvtl()artm(moou1oeen i3tad s rm( snt0tltnmfctytla e ieo;(0 2tr(rpiu4lpe lictlt)a2taumpoo4opxomoctytfa2rlnmp () leoxrciatlm e n ols)t2xm(mpnydoptnmicils a2taxrp;t0olxn i3iytfmDulu p u4aleniocty1fa  ai ilt0 2xoir3no4ol emfviasf rtmumoot0aetnifcilt aDuaumsn(0 etoxo3oatfa   ivs t)trtrirpnu1oleelncilt arrr( ooo1tpxnmietatfmDeauvo t) rermf todomteanes t sexoir nydlp  mfcsl( sDuau p;o4olxo o3tltfs uauvo;t4areriocoodfateaivs ( srto(mpnu1omenmncslsfa2ra(rp;o1tee  iciltfsDrlump u0aetrmf3iotoa ran olt0seur(mpny1amenlfctlsfarum(r ;u0openifcilsfa2emn p (0 renmo3tytoateai slt)s2xmio3ou4ap  mfetlt aDrr( ont1tle mociad s2rmn p;(0texoif iadfmDr uvs t) etm(m3oo4lpteliei t  rtax ont4olxnif3ilt mDuauvo (0 ltnmr3iodoptraueo ()teuoxo3nodlme  ivilsfaDua( pou0ope  oeiadlmDumnmo u4aeenif3iy1lat li sl( tetrir oo1omtn fvs (  2urx pou0teen f3tysfs2eanvo t4aexnio3oydoaDrli s;t setmiopiy1al nlfet t)a2rax p;t4tpe  ictls s rmnvs;u)arerircoadfateaieilt)truoxmpoy1lm e ivsl(fa2tmxmono4tptniictltla2emn pnu)aexnmr tadlmDrli sls0sexmir3iydol eliesasfarta(m ;u1apx if3ildfsDem(vs;t)teenmf iydlm   nvi t0 2umimpnu4lptnlfvtl(fs2rmu o;t4aeeoii3ildls emumo;() rtoxr iydfpDrlueslt sruoiopnu1amen icsa()artrxmp;t1tet mfcildfmDem(vs;()tlxnxf3tatlpDean s t) 2umxo3nodlpt lnei sfsDtrx  ou4altnmi3tydlsDeaumpn()aexrmrciydfm   uvo t0truo(r3oy4op elicilt)a2tm(root1tltnmfetytfa umu pnt4trxnmrcoodoaD ln il( srtriopiodaltnmfvilt) Dua(rpou4oexo fcilslaDea(vs u0teeoio totlaDelieo t0teur(m oudlm n fci s a2raxrpnt0tetnio3taslaDemuvonu)tetoir oydlm e ivi s texmxo oy1lm nmivil(farta(rpnt4optnii3iadls2uau p;() ltnxr3iy1laDr uvs t0 eumxopiu4lleemietls  rtmxmonu0ope iociyd s rauvp ()aexrxf oytfp eli ols  rxr(rpoodlmtn fvta()aDururp;u4teenifetls mDuanvsn(4 eenifcia1omteauvi;s)s2tm(r3nodapte iesltf 2tmx poo0aexomf3tytls2um(vp;(0artrmrciodlmDeanvs;()teurim nydlp e nctlt arur(r oo1tpxo o3iadls umn snt)aetnmocootlmtraiei;(0s2xmxo no4ap nmfvs t a2trur ;t1tet  feiydfa2rmu s;u) ltnio3to1om eai i;(0s2trxopoo1ol nlivtlsf 2taumont4teeoifciadlm2raump;u4artoir iytlmD  ivi;s0texmxo iodlptemnci s)a2rrxmonu1aexnmfeiatfs2ran p;(0aleoxrcta1omD lies t0s2tm(m oy4ll  mfei (fs2raumo;o4tpe iieilsfmDemn s;t)alxrmocootla  luvs;()s2tm(r3nu1opeelfci (f 2urx o;u4aexnmicildfa2rl( o (4 lxnxocoy1faD aneo (  2xr(o3ny4lltnlnvtls)sDtmxmoot0tle  oetls m ulnvo u4tlxrio tatlmDeau ilt0trum(r ou4lpenmfvtas a2trxrono0altoifeiytfsDel(mp u4areoif3ty1lp r nvilt0 2toimpoo1op n fet t  rtm(mpoo4aeenioctldlm2uau o;u4trxnxo3iotopDrluvo s0 2xr(m3iodlmtnlneias)srtmx poo4tpenmoeiltfa emuvo;(0 eenxf oo1oatr uvolt0sexrxo3nodlp  mictas)sDtmurp;o1apeoifeilt sDrmuvp (4texnmfcta1omDrlivs t  rtr(o3ny4ame lnetls) rtr(rp;u0oet ioctyd aDuau p (4teerxo3oodfpDeauvols teurxo3oo1ape lictlsfs2rm(rp;o0aptnmi3tasfs uaumsn(4 exrif iy1opt an s;(0sexmio3ou4lptnlfcta( sDtmxm ;o1tpxo f3ias aDea(msnu4texoif oy1lmDe n o;s0t2tmxr oudap e fcslsfa2rr(rpnu1ole ifctytlsDumnvp;u)tltnir tytfpDr ivolt0t2xrxm oudoptnlfcils a2ur( o;o0olt ioctltlaDuanmp;t)tltomo ootlaDrlu o (  exoiopiu4omtnmfet ( sDur(ro;t0tpxnmo3tytls2ulnms;t0tleoxf3oadlp e nei t) 2uo(o iu1omenmics s aDtmurp;o1aex mo3iadfs2ua( p () rxnmr3iodlatrli il() exmxo3ny4amtn nei s)srra( o;t1tpenmociyd s2uluvp;()tetrif iodfmtr uvsl( setmim nudap e ivilt s2tmxr ou1tetniieiasfs rm( p t) leoxrciydlp eaueo;()srur(mpoydom   fcs t)a2ta(rono1tee mieilslm2rmuvsn(4aleoircio1omt aneo ()seur(mpou4om nlncs sf Dtaxm ;u4tpxoif3ildfsDrmu sn() ltnir3todoa raueo s  2xm(r oo1al  lnctl(  rumxm ;u0optomoeiadfaDeau snt4teermrcoatlptranes;t0srto(rpou4omt lfcilsf rtmx pot0apxoifciyd mDean o;(0areoxf ty1omteaueslt) ruoiopiy4lm emfcta()arrrur nt1aeenmo3iltlm ra(vp;u4 renxf3oytlpDrlies s trxr(r3iu4optnlnvia(fa2urxmont1apen fctyd s umnmp u) renmfcta1lmte ivo s)t2uo(m3nydapt micsat aDrr(mo;o4altniiciyd a uau s;() ltnirciatoa  au il()t2xm(m nudom elnvilt) Drrx  oo4tltn i3tydfa2ra(ms (0tlxnio tatlmDrlu s ( t2urimpno1ol emnes t sDumxmpot4apx  f3tydlmDumumsnu0trtnxocoatopDrau ols) 2toir3iy4lm e ivtat)a2ta( o;u0aptnmf3iysfmDuaumsn()arenxf3tydfpt lu s (0s2xrxopoy1ap   nesl(fsDtax pno4optomf3iadfa2uanvo;t)tlxnioctytfa ran sl()sexo(r3iy4lptemfvt sf rumxmoot1tlen icils a ra(vs;()aetnmr3totlpt luvilt0 2trxm3ou4lp n ietltfsDrru p;o4apen f3ilt mDuluvpnt) ltnmfcoadoaDe iei s)t2xrirpiodlltelfvsa(  rrm(roou0ole iocias aDrlnms u0trermociydoptelneol( texrxmpiudlmenmnvsas artax pou1ole  ictlsls umuvs u4tlerir totlpDrlnvs;t0sexrir iu1al  lfet sfaDrauront0tltnmf3ildfsDra(mo (0trxnifctydlp rlu olt trtmxopiy4alen nes (fa2rru o;u1tpenmociadlm elu snu0 exnmr3tatomD  ueil(0trurimpiu4lltelnetat sDtrxmooo1aee mo3iaslsDeanvsn(0alxoxfcoytopDeluvs;s0 2tm(r3iy1lpenlnvilsfa2rm( ooo4tpe mfctltla2umump;t4tleoxfctotlatr uvi;(0 2xr(rpoudlltemnvt ( arrrxmonu0aexo o3iasls eanvs t)tltrxr3ia1oaD anvo;s)seum(o3nodap n fvt () ruax  nt4tpxnmietys aDulu ont4tlxnxf tydfmD aueo t trtoxr ny1amtelics () 2urxmpou0apx  iciysla ulnvp;(4 lxrir3io1fmDrauvsls0trto(r3iu1apeemfeta() Dtmxm oo1aleomoeildfs2umu p;t0treomoctotlpDraiei (0 2urxr iodoltemivsl(  rurx p;t0opx  iciadlmDul(vs u4artnxo3io1lmDe i o;s0 2tmio io1amenmncs (faruau poo4tlto f3iytlmDuluvs;u)trxoxf3totfaD li sl()trur(o3iudlmt lnesat)artm(r ;t4ope ii3taslm umnvont0 lxrxo iodfat livo s0t2xoio nudalt mnci tf 2um(mpnu1tee  ietyt s2el(mp u0tlenxf iy1fp  au i () 2toimpoo1om   fciltfaDraur ;u4olx mo3ils mDra(ms (4arxoir3tadlateau sls)trurxr no4ope  iesa(  2taumo;u4opx  f3iytlmDranvp;u)tlenxfcoadla e uvi s0srtrxm iu4lm  lnetas)sDrrxmoou1oexomieildls umn s;(4teenmo3oa1omD  n i;( texmimpoo1ale mfetl(f 2rrumpnu1olt ifctldlmDul(ms t0 renmf3tydlp r neo;s)s2tmirpoudll nlnvt s a2rru ont0olto f3tltfm2ea(vsn(0 eeoxr3tadlmt lieols0trum(opno1amtnlivta(faDurur no0oleomoeiydfsDul(vp t) lenmf3tadomDe uvo;(0t2trxr ny4oleemfct tf rtaxmoot0ope  i3iltfs ra(mpnt0tetomr oadfp e ieslt tetmim iu1lmt lfet (fs2taxr ot1olx ioeiytfa2em(mpnu4aetoir oodlm rlu olt0 etoio oy1ll  mncs sf Dur(m ot0aee iieiadfm ul(msn(4 ltrxfctodfp e uei ()trxr(o nu1om  mnci s) Dumxrono0oet miciat m ul(vonu4aexoif tytfp r ivi;s srxrimpnu1aptnmfvsat)s2uaurp;u1teeoifeiatla eau p;t0tltoio todlpD au s t0s2xr(rpou1amtelict s)a2rrumpnt0tlxo feiytfmDuanvsnt0aetrio3iatopDelueo (0t2umirpoo1lm  lfei t)a2rrum oo1oleoio3iasfa2ranms u0altrmr totfpt anvslt)t2tmxr oydole livsa(f rur(mo;t0apx  fciytfs ranms u4aeenmrcoy1lptrlneil( trtm(m3ou1lp emncsa(fsDrmxr nt4aexnioctysls2uaums (4artrmr oadlateli s ( seuo(opny1lm emfcs ( s2uax ont4optoiiciadfs rmnmp;()tltrioctydlatraivsl(  euoxm iy4olenmiesat s2ra(rpot0tlxo i3iys m2ra( p;(4trerxf ia1om r nvol(0srurxo ou1omenmfei (farumxrpoo0tee moetatlsDum( s;() lxrxo oatopD lnvilt)tetoirpny1lmtnmieilt a2raxmont4tpxnmf3iasfmDranmon(4texriocootoaDr ues t texr(opio4optemnet s)aDrmxrpoo1tpenmi3iadla ulumpnt4trxrmrctydlptelu ols srur(opiydam   ies s sDta(mo;o0tlt mfciasfm2emnvo (4 lenmr3ia1lpt auvi;s s2urxr3nodam  lfcs s aDrm(  ;o0tetoif3tat m2eanvs;t) exoirctodoaDrauvs;s  2tm(r iy1alen nvsas  Dur(m ou1tetomoetydla2ea(vpn()altrxf tatfm  livsls) 2ur(rpnu1amt mnvslt  Dtax p;o0tpxomietldfa2ra(mon(4treoxr oodfa rluvi;s0s2uoxr3oy1omtelnci t  rumu oot4oleo oeiaslsDum(vs t)teeomf3iatfm e i s t0setm(o iudam   ies (f 2uau pou0aptn iciasfsDeaump t)tetnir iotoptranvo ()s2xmxm nu4ameelivs ( aDum(m oo1aptn feildfsDrlu s;u0 lxrif3totlp ranvs;s) rumxr ou4al  miet s aDtr(r nu0tee  ictys s rlu pnu4tltnmo3iydlmtran ils)seurxmpoy1lp elnvslt a2tr( pot0oetomfetas s um( s;(0tlxnif oa1oa rlneo;( trtrio oodomtemict (faDurxrpou4ape mfeiad s rlnmpnu4tetoir3iytfateauvs;s0s2trim3oo4llt livia(fsrum(mpno0oltn ociat aDuanmsnu) ltrircoodla rlnvo t tetr(r3iu4ome  ivt tfsrrmxmpnu0aee  f3iaslm2ua(vs t4texomr tytlmDeauvols) etoio3iodope  fcs (fsrtmx oou4oetnmoeias mDeaums;(4 renmo oadomtrlivslt0s2to(rpnydoptnmfcs (fs2tr(m oo4oleoifeiydls ran o;t)artnxfcootoat livilt)s2toim iy1lmeemnvtl(f 2tmumoot1tpxnifciatla eanvs u0 exrio3iytfa elnvslt0 2trim3iu1aptemfct (f Drmump;u0alt  ieiatfs2ua(mo;u0altrmfctadlmtraieilt0s2toimpoy4am n nvtat)s2taurp;t1tlenifeiasfa umnms;(4 rtomr3tydlm r i ilt t2xo(o iodamtnlneslt)a2raxr no1aeenioeiys aDrln p t0 leoxrcoadlptr ivi (0trxoxopoudaltnlivilt  rtmu pno1apt  oetltfs2rauvonu0tetnirciotoa rai o (0teurxo oo4amen fesa() Dumur ot4oexomi3ils aDulu pnt0tlenxr3oatfp rli o t)seuoirpoy4om  lici tfa2tr(  ;t0oexnmieiaslsDua(mo (4aetoif3to1fp rluvo (  rurxo iudamt lfes (faruax ont0alxoiociatla2el( p;u0 ltnmr oatfaDr n i t texm(mpiu4optemicilsfartrurp;o4olt  oetytlsDrlumo;(4trenmo3iodfmDeluvil(0srum(m3io4ap  mncta( aDrrur ot4aeeomi3iyd a2ul( o t4 rtnir3iatlmDeai i s) rtrir oo1omt mfciasfaDuru pot1aptnmfetlt a rlu pn(0 reoxfcoo1lp eanvi;s t2xmimpou4ll emfes ()artru pno0tetnmfeildlm2ran snt)trxoxo oa1oatelues;s t2urimpno1ole  fvs t)a2rruroot0olx mociatlaDrl(monu0tetrircoy1fm r ieil() euo(o3oo4lm  mfesat)srta( onu0tpeo oeiys s2rlu s;t0artoiociadfa ean o (  2tmxm no1ol emiesa( srrmx o;u1tptnio3iyd a elu s () lerxrcio1om eluvils srxmir3iu1ome  ietat aDumurpnu4tpxomoctatfa ulums;()tetomrcoa1fm r i o;(0s2xo(mpoo4am nlivsatfaruax oot1oex mfciydfsDran onu0aexnmo ia1fat  ieo;t)seuoiopnu4olt mncs ()sDur(m ;o1aetomfcild aDrl(ms u4tltnmfciydla rln s;t sexo(r3nodaltelneils)srtmu  ot4aptomfctydlm emumon(4tetrmf3oydfmDr n s () etm(rpoudlp   feiat aDra(r no4alxnif3iyslm2rlump t)tltomr to1fa rau o;() rxmio oydop n ietat) Dumumo;t0oetnif3iysfs2emu o (4 lxrmocoy1oa  luvs;s srumirpnodll nlfvi ( sDrau onu1aeeo fciysfm rlumo (0 lxnxrctydlmte n o;s)teurio oodale  fci sf Drr(m ;t4teeniociad m2uauvs;(4aetnioctatomt auei (0t2triopoy1lm   ivi ()s2rmurp;t4oex  iciad a2rlumpn() exnmfciadlate ueo s  2tmimpou1lmtn ivia(farur( o;o1opt ifctldfa2ranmsn(4 rxrifciytfpte i i s)sexoxrpiudal nmiesls)aDumu pot4olxomoctltfmDrmuvo u4 exnif oo1fmte uvs;s)seumio nydllt  nvtatfaDtmu oou0altomi3tls s um(vp t0aetoxr tatlmDeaivo ( s2xrxo3no4olenlfvi sfaDumu pno1oeeomieiyt m rauvonu0tlxoxoctytom eluvo s)t2triopoy1omen fcsltf Drmu pno0tlxoifetad m2emnmonu)tlenir3iydfpDrlu s;( seumirpnudale  fcslt  rumu ooo4aet  fcilsfsDra(vsnu4trtrxf oo1omDeau o;t  2umimpiy4oleemfvi t)arta(r nt1aee  i3iys a2rl(vsn(0arxnxr3oatoatelueo (0 eto(m3iy4ll n ivsa()sDtm(mo;u0aleo oeils s umumsnt4 leoio oadopteaieol(  exoir iodopenmicsl(  Drmu p;o1texo fetasls2rmnvont0 eenmr iy1omDrluvo s teto(opno4omtnmnetl() 2ur(  ;o4apx  i3tyslmDranmo (0 exomfcoo1lp  ai o;s t2xrio nu1lmee ivsa( arraxr oo0opxnmfciysfs2uluvs;u0alenmrciatfatrlivs (0 euoirpoy1olt  nctlsf 2trx ont1opx mfeiydla rlnvsn(4 eeoxrcoa1optraivo;( srurir3nydam  licsls) 2umur ot0olx mieiasfsDran snt4alxomo3oo1la e ivo;t teum(m nudol e fcs tfs2rrxr oo1tlx mf3tydlaDrm( o;()alxnmf to1lpteaies;s0trtrxr3iodapee nvtas)s2raxr ;t0oeeoifciad aDrm(vo ()tlerif3oatoa  anvol(  2xm(m3ny4ap elnetlt  Dtaxrpoo1ope io3iadfaDean sn(0artrxocoydfpDrlueols0 2umxr3oo4amee ictasf rtrur nu1aexo oetyd mDrmnmp;u4tleoifctatlaD lu s;s)trtm(m oo4ole mnvs s)artmu  ou4ole io3iadlm uaumo;t0 lermo iytfmDrluvils tetr(opno1op nlfvs t  2taur nu1olxnii3tlslaDuanvp u4altrmrcoo1faDrai i t0s2tr(r io4oltn ictat aDrmum nu4olxomieiltfm ra( o u4tleomr3oy1fp  anvi ()srxo(r3nodome lfcilt) Dumumono0aet  i3iadfs2em( o t4texrifctytfate uvs;(0setoxm3no4ll  lfeilt)aDumumpnu1aee moctyd a2rl( p (0 etrir ia1fpD ai ol(  exoim iudoltnmfct sfsDrrxrono0olxomo3iaslmDumnms (0 rxoircty1fmDr ivi;t trtrxm nodlmenmieil()aDrru oot4teto ictltfaDemuvp;(0 etnxo oy1lpt luvsl( srtr(mpny1omee fctatfarua(mp;t4opxn i3ild s elumpnt4 ltnioctatopt  iei t  exoxmpiu1ap elneilt  2rm( p;t1aee  f3ias s2rl( pnt)tltoxr oa1oat li s t0texrir iu1op  mnctlt)arua( oou4oeenif3iasfs2elnmpnt0aetnxocoo1opDrluvi;t0s2uoio oudlptnmiciat)srtmx  no0tlxnmiciltlm2elnvont0tetomfcta1lmt  nvo;s) euoxr nu4amtnlnvi tf 2taum ;o4alxnif3iltlaDrlnvs;u0 rermfcto1faD an i;s0teuoir3iy1ll elietat)arrax onu4aleoii3iydfm rl(mpnt4 ltoxf3ootfpDranvo ()texoiopno1opteliesltfsrtmxmpou1oeeo fetat m2ul(mp u4treomf oa1fpDr u i s srxmxo3oo4lmt mfet (fsDtm(ronu4tltn fctytfa2uan s ()artoio3oatfp  anei t0srumxm3iy4oltnlfei s  2tmurp;o0aee ioeildls rmuvs;u4trenif ootla e ivols0t2urim3iu1ole mivtas) Drrx o;o0opt  ocilt a2eanvo;(4tlenif3oytlaDe n s s trumir nodaltemfcilsfarumxmo;u1ole iociat sDrlump t4 lerio io1omDeaues t t2tmirpnu1llee ieil(f Dum(  ;o1olx ifeiat a emu p u0 rtomrcoo1oate ivs;t)seur(o3oy4apeemnesat s2ra(roou0aleomo3iasls elu s u0arxrxrciytlaDrli il(  rxr(m3iodom nmnct s) 2rrur ou1oex ioeiysfsDul( s;t0aeerxfcoodlpte ivi () rtrimpoo4oltelnet tfarrmxrp;t4tpxomoeiyd mDemumpnu0 rtrxrcoy1fa  ai s s t2xrxrpoo1lpe mnvt s arum(rp;t0apx iiciasfsDea(msnu0 ltoxocoatom  auei s)s2um(o3iydom emnvia(faDum(  ;u0openioetldlmDran snt4 leoio iodlp rlnesl()srumio iudap  mfesa(farur(rooo1ape  f3tat a2em(ms ()tlxnifcty1la   ivi s) eurio3nu4amt  fvsa( aDtmur nt0altoiietyd s rmump ()artomr iydomDeauvsl( trxm(o3nudomt lnvsas a2trur ;t4tpt mictytfa rlnmp u0teeoxfctydlaDe ivsl()teuo(opiudop n ivtas) rrr( pnt4teeo oetadla2umnvs;u4aetoxrcty1fa  li i;s  2xm(r nudlmtn iet s srraump;t1optn feiad m rmnvs;(0aetnircoatlmD aiei;t)t2xr(opnydlltnlfci s  2rr(ronu1aeto i3iyd m2ua(mp;u4arxoiocoytopD anvols0 rxrxopnu4op  mfeils)sDrmu  nt4oltoiociasls2ranvs;t0areoxr3iodom rlivs;t srxo(opny1ol emfvsas)sDumxmo;t0olxoii3ias s umumo u)trxrif tatlaDrauesls)sexrir iu1apt mnci t  rtr(mooo4tpt ifciyt a rmn p u4texrxo iytla   iesls0t2xmxm nu4oltemicilt  Drrump;o1tee  f3iydls ean ont0 leomr3oy1oa rlivo t)teur(r nudapeelivsls) rta(  ;t0teeo i3tltlaDumnvs (0texoxr to1laDeaivo;s0t2tm(o3iudam n fes ()a2um( onu0tex  icils a2ua(ms;t)tlxoxo ty1fateanvs ( sexr(r iu4olenmneilt)srta(mpot1tetomfeils m um(vs t0teenmf3oatopDraneslt)s2uo(r oudlpenmnetltfa2tmumooo1aee mf3iyd a2umn pnu0 rtomrcta1lm elivil( teuoxm oy4aleelici t  Dtmxmonu0ale mfeiasls rau s (0aeeomo3io1fptrli s;(0tetm(mpiydomtnlncil(faDrax o;t4tlx  f3iatlmDeaumpn()aexoif3oadfaDeai ilt s2trxr nu4op  lnvtas  2raxm ;t0opt if3tas m umums;u4 lerxrciydla rlnvo;() rum(opiy4ameelnvs s srtau o;t4oex ioeiyt aDra(ms t0aetoxfciotoa rln sls0 2xm(o3iu4am nmneias arrrurp;o4teeo fcildls ranmsnt0tetrxo3to1opD lieo;t)srxoiopoo4altelfvt t)a2urumpnt0olxniociltfaDraumo;t4arxrif ia1fmDrli o;s trtm(m oudlpeemnvs t) Drrxrpoo0tlt  ieiatfa2rau p t4 exrxociodopD  uesl() rurirpnu4lm   iviat srtr(mont0tle mociyslaDrmu s;u4aleomfcio1opte uvolt)sexmir iu4omenlfeiltf 2tmumoot0tpxomoctad a2rl(vp;u0 rxnxr oodomteanei;()trurir oy4olenlfvsa()sDumumpnu4tltomoeiat aDranms u0tlenifcta1om rlu s;t0trtrxo iy1omte nvt t s2rrx o;o4altnmociat s2umuvont4 ltnir io1oate nvs s)t2uoxo3nydapen ieiatfsrur(r ;u1tpxo iciad s2em(ms t0aexnir iy1fmDe uvo (0srxr(mpnodaleemfeias)sDrrur oo0tpeo ictldlm2elnms t0aeeoxo3oa1fm elieo t truo(opoo1am e fcils)s2uau  nt0aeen i3tydfs2rl(vp;(0 lxomfciy1optr n olt0srtmxopoy1alee ivs s)a2taur oo1tlx  i3tat a rln s;()arxomociotlpte ieo;t0t2to(m3nodaltnlfeslt)arta(  nu4opt mi3iadls umnmo (4teeoxr ootop ran o s  2xm(r nu1lm e icias  rtrx pnu4aee  fctadlsDeanvo;t) rxoxr ootfmtrai o t)t2trir3no1ap e ivs ()sDraxr ;o1aeeoifeiytfm2um( s;t0tlenmr3iodfp r u o t0 etmir ou4ap elneta( s2trxr nt4oexnmfctys mDua( o t)aexoif3iydlpDrliesl() eurir3ou4ap elfcs s  rur(ro;u4tptniicilt a umuvp () eenmr iy1omDrlieo ( setm(mpiy4am nlfcsl(fsDrmum no0texoii3iat s umnvsnu4 rtoxfciadfmt li o s) eurxo3nu1lmtelncsl()aDtmum oo1aeen ieiytfs2ua(msnt0alxnmocoo1fmtran i;()srxrxr nodalenmnet t  2tmuro;u4oetn oeiysla2rlu p u4aleoiociytfmt  nes ()t2xoir3oo1alee nviltf 2umxmp;o0oetoiieilsls2ean ont0tltnxr3oa1fmteli i;t0s2tmxm no4ll n fci t s2ur(m ;t4tpxnmociysfsDuanmsnt)aexrir3iytlateln s t0trxrxo3ou1ol n ivt t)a2rmxmp;t1aetnii3tydla rm(mp t4alenmf3to1fmt livs ()seuo(o3nu4apt licslt  2urumpnt1tlxoiiciat sDrauvs;u)texnircta1opDean o;t0sexo(r iydlpeemivsat)s2rr(moou1aptnmo3iydfaDua( o;t) rxnxociotfaDelneols)t2to(opnodam  livtl()arumur ;u4opt  i3iytfm el(mp;() reomfctotomDe nes;s0srtoxm3iy4amt licils sDtmu  ;u4tlxoioeiysls rmums;t) rtnio iytom  an s;t)t2tmimpnu1lpeelnvs ( arra(ro;t4oltoioeiydfa2uluvpnt4tlenxr3oadfm rau s;( teumimpnydlpenmiviasf 2raumonu4altomo3iasla2elu o u)texnmr io1fm rauvs ( s2trxr iudop nmfvi t)artrxronu0apx miciytlm2uan o;u4alerif3tadop  ai ils t2uo(o3io1lpen nvsltf 2rrxrono1oetn fetasfa2rln o;() lxrxfcoa1la r ueol() 2xrxm ou1oleelfvsl()sDra(  no1tpxnifeiysls2emu on(4 leoxoctodfmDelu slt0 2uo(o3nu1llt mnvta(fa2ta(m ot0tpx ifciytfm eaumpnt)aetrmf to1la r nvo;t)srum(r nodapee neia( srrr(mo;t0texnifeias aDemuvp t)tetnmrctydfp ean ils)srumxrpoydam   nvi s) Dtru  ;t1tpeoiictltla2rmnmp;()aleoxf3io1fpDe n ol() 2uoir3nydapeelfeslsfa2um(m ;o0optomo3tytla rl(vp t)tltnxf tadlaD li s s0srtmxopno1apt  fesl() rum(r ;u4apenii3ilt s rln s;u4 lenircoa1fp  lu i;s srtrxo3nodlp nlfvt t)aDrm(r nu1aptomf3tld s2rlu s u)aeermrctydlpteaneilt0trtrxopoudomtn fcta() Dua(r ;u4olx mo3iatls ra(vpn(0alxnif oy1oa   ivo s  2xr(rpno4opee icilt)s2rm( p;t0oetnioctls aDuaump t4 ltrmo iadoa  aieolt)srtrimpno4lltnmncta(fsrrrumpoo0aptomf3ilsls ra(vp;u) lxnir3totom   uvs;t0srxo(m3iu4apeemnvtat srrruroot0teto f3iasfmDranvp u) lxnmo3oatfmt  ueol(0trtrirpiodol nmncia( arur(m ;t0opxn o3ildlm umu snu4 reoio iotfa   i o;s0seumim iu4olenlfesl(  2tr(rooo0open oeiasla emumon(4 reoif oydfpD  nvo;( srtoiopno1llenlnes t artaxm ;o1aptnmo3ildfs2em(vs;u0aetnmo todfm  auvs;t trxoir3iy4apee fct s sDur(m oo4teenmo3iadlm2rmn o t) etniocty1lpDrlivs;()s2xo(m3iudll nlfctat srtmxroou1apeniocilsfm rmumsnt0tlxrmo oadoaD  ivil( teuoio ny1lpte ivsltfs2rrurpoo4opxo ociydlmDeauvsnt)arenmf3totop eln i;s0tetm(r oy1ol n ietatfsrrauro;o4tee if3ils sDrmnvp ()aeerxfciotfpD  nes s tetm(rpnu4lpen ics t  2tm(moot0opxn ociasfa2rlnms;u)altomo3oytfpDeaneo;()seto(opiy1lptnlfeilt sDumu poo1oeto f3ildfa2rmu o u)tleomf3totlptrlieols0t2toio3no4olt  fesat  Dururp;o1oetnifetlsla2eauvonu4tltnxo3iotoaD livs t tetrxo3oy4lltn fctltfarurx pou4aeeoio3tatfm eau o;u0tltrmr3totlm  au s;() eumio iu1lmt  fcsl() Dtrx o;o4apxn ictydfs2ranvp;t4 exrmfctadfaD ai i;s0s2tr(m3nudlm   nciasf 2tm(mpoo0tpen feiltls2uau s;(0 rtrmf3ta1opt ln s s trtoxmpiudlpt  fvta(fsrtrxmpnu4ole mfeiydfm ea( p;u) rxoio oatla rli i;s)srtr(o3iu1op n ici s  2umxmp;o4oee  o3iad aDelumo ()trtrxrciotoptraivil( srtm(mpou4ame mfcs sfarrr(m oo0tltniociytla ranvo;u0tetnxocoadoat lu s;s)trxr(r io4om  mivsasfsrrr(moot1tpeo fetlsla2ul( ont)areoxrcootfat  u s ( trtrir ou4aleemfci tf 2urum ;u4tpx ifciltlsDul(vs t) rxnif3iotlpte i i (  exrio nydlm elfcslsf rrmxmpnt1tlt moctyd s2ul( p (4 rxoir3todfaDelnvilt)sruoxrpnodal  liei () 2tax oou0tpt ifetldfs2ra(mo u)tlxoxr oo1fa r ivi s0teuo(opnu1lm e icsa(  2trxrpot0aee ifetytla2emnms;u4 exrifctodfpt ln i t)t2umir3nu4amee nvs t sDrmxmo;o0tpe io3iysfaDrmnms (4trerif iodfp eli o t0setr(opoy4lm  lfci (f 2tax o;u0oeenmoetltfa el( p;()trenmrctodlmtr ueo s0seumxopnodom   ici tfsDuau onu4tee iociydfa rm(mpnt0aeermr oo1lat lnesl( s2urirpnu1om emfetls)s2rr(  ot0tpx moetlt a2elnvonu0aetomf3to1oa  aiei ()trtoxr3ou1ome micslt sDrrum ;t4tptomoctytfa2ran pnu4trenmf3oatlmtran ols0t2tr(o iodlp   nvil() 2tm(mpno0tpx  f3tlt m2rlu s;() etrio3tatfpDraivi s0t2xo(m3iodame  netlt  Draur ;t0ope ifetldlm ulu s;u)texrxocty1opDrlnei t) 2xoxmpno1ope  ieia(  2trxr ;t4oeto f3iltfs ulnvsn(0tlxnmo3iatfm   nei;()texmxm oo4am emnct t)sDrax pou1tpto oetytfa2elnvo;t4tlenio oodfptean i t  eur(r ny1lpe  netl(fartaxr ;t0aptomfeils sDuluvp u) lxrxr3ta1fm eau s;t)seum(m3io4lltnlnctlt) rum(r nu0tlx iieiadfsDrluvs ()texrmocoatfat  ueols0srum(m oo4op   fvilt arrm(root4teen oetlt a2el( o u) rtrxo3io1opDelneol(0teumxr3ny4lm e iei s  2umx ono0ape  feiyslm umnvo;u0aetnxoctatlmDe ivs;( trtmirpno4amtelnesas)arrmxmp;t0alenmoetat m ul(mp;u0aexomf iadfmtr ivsl( sexmxo3ny1ap nlics t)a2rr(mp;o0olxn feiltfa ul(vs (0 lxnxfcto1lmD  ivs s  etm(r3io4omee nctas s2ra(mpou1olen o3iytfa um( ont0alerifcia1oa rliei s)s2xr(o3nudopeelfci t sDur(m ;o1texnmoctadls elu p t0aeenircoydop  lnes s tetoxm3nodlptnlfesl(  2rmu p;t0apeomi3tad sDrl(vp (0 exnmr3ta1fa rau i s0 2xmir3iu4lmeelfesls a2rm(mo;u1altnifciyd s ea(ms;()tetoir3io1fp r nes;t0t2uo(o3iydaptnmnci sfaDua(  oo1altnmo3tydfm rlump t)trxomfcty1fmtelivo t) exo(o oydameemnet s)aDrr( poo4aptn octls s2rl(mpn(0 rerxo3tatoate uvs t  2toim iu4altnlncs tf 2rmxmpoo0opx  fciyd a2um(mon(4 lxomf oodoa   n sls0teto(rpny1omee neslt srra(r nu4tle  f3tad s2ul(mpnu0trxoxr oa1oaDraivilt setrxo oo4ameemfvt t aDrmu  no4tpxo iciyd mDrmu s;u0tlxoxf ta1optr ivil( s2xmxm oo4ape  icsl( a2taumpno1teeomfetltfa rlumsn() exnmo iytfate neol( texoim3oydome mfesltf rum(roou0aet if3tysfm uanmsnu0texniociotfmDrlieolt trtrxr3io4lltnmnciatfsrraxmp;u0alxnmo3iydfm uanmp () etrxf oodop  auvo (0t2uoxo3nodlmee fes ( s2umum no0oeeoifciasfa2umnms;t4trxoiocoy1fptraneslt s2toxmpou4lm elfei t)a2rrum no0ole mo3iatla emu pnu)trtrif3ta1la eaneils seuoio io4ole micsls sDtr(  ot1aexnmo3tatlm2umn s () etoxo3ta1la   nvi;t)t2xoir no1ol elici (  2umxronu0oltn fctlslmDelumonu0arenxo3iytlat li ilt0t2umxopoy4al  miciat) Dtrumpou4olx  i3ildfaDrlump;t) rtoxfciadlpDrlivo s  2trxrpiu1ope  ieilt) 2urxr ;o0alt  feild a rmnmont4 rxrxf3oy1fpte u sls) 2xoimpiu4llt mfvsl(fartruront1apeomf3ildla2umn snt4altoir oodlmteai il()trxo(o oy1altelicils sruauronu0tex  ieiasfmDul( o;()trtoxfciy1lat lu il( seuoio3no1op nmfvia( arurxmoot4tlto ociltfaDuau o;(4teeomrctodlmD  uvil( srxmir iy4aleelnvs sf Dtmurpnt1altnif3iasls el( on(4trxomf3tatfm eauvilt) 2trir3io4lme  ncs ()aruauront0openio3iadfmDeauvp (4aeermf todfmD ai s t setr(r io4lpee ivtat)aDrmxmpou1optomo3iydfa umu pnu) leoxfcta1latr ies ( setrirpio1oltn ivi (fa2ta(mooo1aeeniicild s2rlums t4tlenxf tytlpteluvils0t2tmxm nudlmt lfvsa()srra(mpnt4tee mfciat s2ua(vs u4 etrmr iadfateauvi t)tetm(o ny1amtnlfeiasfa2rmxr no0oet ii3tyslmDrau p u)texnmocoa1fpDranei s0trtmiopnodaptnlfcslt)arururo;t1apeo iciyd m2um(vpnt0aetomr3iadfptrlnvil( trtmxm3iu4lm elivs t)artmum ot0tlxoio3iadfm eln s;t)alerif3iydfmt  n sls)seto(o3oudlmee ivsltfsDur(r ;o4tpxnif3iadlm rln on(4trxnmo3ia1lp  aneo t0trtr(r3oodll   ivs ( aDumur ou4olt  iciatfm2elnmsn(4trerifcia1lp rlivilt0seuoxrpiy1opeeliet t) 2tmur nt4alxo i3iat m elnmo (4 ltnir3iatlaDeluvil()srumio3oudlpt lfetas s2ua(mooo1ape mociydfs2ua( s;t4 rerir3iadoa ranvo;t  2trxo oudopenlfcil(f 2ua( p;t1texn octlt s el( p;u4areoxo iydoateli i;t srxrxo3iodamt  ieils aDua(root0texomi3iyd s2umnms;()tetrxf3to1lm rlu ol()srto(r oo1amtnliesl() 2taxrpoo0oleoiieiys a uau p;t0artoxr oo1opDrlu o (0 rtm(r nu1lle  feias srrru p;t0oltoifcils s eaump t) lxnxf3iydfat livi;t) etrir3oy1lp elnesa( aDtaxmo;u0aexomfeilslm ua( p;(4 rerxf3iodfm rau il( tetrxr no1om eliet (  Dtmxroot1ale  o3iasla2ranmpn(4arenxr io1fmtr nesls)teuoirpio4amen netlsfsrrm(r ou0tet  oeiadfm umu p;(0trxnioctadfpteaueol( srxmir3nudoltnmfcta( s2urx oou1opx mictatla2umn s u)tltrxfcto1fptrlu s;s0 rtoir oo1omt liesasfartr(  ou0oexo f3iatla2ul(ms;(4 rtrifcto1oa   uesl()t2xo(m ou1lmtn icsl(farta(rpou0olt iieiltfm2emu o u4tltoxo3iadlat ai i ( trtrirpoydomeelnvtl(  Dua(mpou4ole if3iytfaDrl(mpnt0 eermf io1faD lies t0 2trirpoydalt mict s) rtrxr no1tpeomo3tys a2ul(mpnu4tlxnio oy1oat  ieo t teuoxmpiodlle lnct sfaDuau oot0alxn fetat sDrl(mont)tltnxfctodfmtr nvi ( setoir3no1lm nmictat s2rauronu1tpto icilslm umnmon() eenif iodfpDrluvils0trxrio nodol nlivtas s2um(rpno1tle ii3tas m emn o;(0trtnir oydomD aivslt texm(r3iu4lltnmics s artr( oot1oeenio3iyt a2ra( s;t)trxnir ta1oaDrlues;t setrxrpiy4opee fvslt arum(m oo4oeeo i3tyd m2ul(vsn(4 rxnxfcoatopD anei t) rurio3iu1lmtn fes tf 2tmuront1tle  fctyslm2ranvpnu)alermrcio1lpD lnvils0 2tm(rpnudameelfet s)a2rm( pnt4tetn i3iatla eaumo;u0 rxnmo totlp  an ils texmxr3iy4altn fei (fs2rau p;t0opxnif3iyd s2ra( p;t4 rtomo totfmteaivil(0trtriopiudop  micsas  rta(mpnt4oltnio3iatfa2el(vs t4tltnirciatoa rauvi s)truo(mpiu4lpe lnvilt s2taum ;o0oleo f3tlsfm2el(vp;u4 eerxfcoodlmtelu s;(0 exmio iodamtnmnvtl( srrmump;t0tet  i3iadfm em(mp;u0tltnio3iydlaD lneslt0 rur(o io1omtnmfesat)artmx  ou0alx ifctlt mDrl(mp;t) etnir3iy1oaDe ueslt s2xm(m oodom elnet ()s2umuro;o1tetnmi3iadlm2ul(mo;(0 exoif3oytom e ivsl(  euoxr3iu1ll nlfct ()a2rmu  no4openmf3iltfs rl(mon(0 rtnmr3iodlmDraieo;s)s2xo(r io4amen ivil(farraxmp;u1opxnio3tadlm ea( s;()texoif tydfmD  ivolt)setoxrpoy1oltnmfetl()a2um(m ou1aptnmiciaslm umu p u0altrxf to1lateau i t)s2umio iudam   ncsasfarta(roou4alx  ieiytfaDul( p;u0 eeoir3todfa  lies;s0 rxm(opoy1ole lieiat)a2trx p;t1tltnmfciyt a emnvo;(0texoir3ty1fmtraueo ( texm(rpno1lpenmfctlt  Drm(rpnu1aeen fciytlaDemuvp;(0trxrmo3iy1fatrli sls setoim nodlp  licslsfs2rrxm ;u1opx iicils sDum(vsnu4tltoxr3oadlp  livs;s  etoxo3ou4ole  ncsls  Drm(r ot0ale ii3tlt m2elnvo;t) lxnmo oa1omD  ies;(0trtoxrpoudlpeelieil( srtaxro;u0oetomoetyt s2ranms t) lxnmo3ta1oat  u i (  exoxm oydlmenlivi sf Dumurpot1ape ifcild s rlnvs;u0areoxf3ia1lm  aivilt teto(rpny1lp e fvs t a2ta(  ou0oetoif3iatla ra(mont4aeerxr3todlaDeanvs;s0setriopoy4om e nvtas artm( pno4alenifeilt sDulums ()trtoxfcoy1lpDeanvs t)setr(m3nu1lpt lfvs t)srrm(  ot4oleo iciasfmDeaumsn(0trtomo3ootfptraiei t0 rxoxr3oy1aptnlneslt sDtmxrp;u4tpeniietlt mDrln o;(0 ltomoctodlmD auvo;()sexrimpiudlltelneta(fsDurumoot4oexomf3iytlm ra( on(0 rxrxf tydopD  n ilt0texrxm3nydape lfviat  rta(  nu4texoiociadfm ul(mo t0 reomf iodlmDeluvol(  rxmirpny1apee ivsat) 2ra(m oo4tlt  iciytfa emu s;t0trtoxf3oodla  ai s (  2xm(r3ny1ap nmieiasf rtax ont1olxnmo3iasfs emnmp;(4trtoircoadla rliei;() exr(mpio1ome lneilt)arur(mo;u0tetoifeiyd a umnvp u0aexrif3tytfmDe uei;s teurxopoodllen iesls) rumxr nt4aex mi3tlsfa2elums;u0artnio3oytfm r n i;() rtoxr iu1olt mfvsa() 2umxr ou0oeenii3iys m ulumpnt) exoio tadfaDeauvi;t) eum(rpio4lle  iet sf 2truro;t4oexn i3tasfaDuan ont4alxrmo tadfmDeaneol(0trtmio3oo1llenmfeiasfa2raur nt0ope  o3iydfsDuln sn(4texnifciotlmtr uvilt)setmxm ny4opeelfetatfa2ua(mpnt1apx mfetysfs2ua(mon(0 exnmf iydfatraneo;t sexrxm iodapt mfvi s srtmu oot0olx  ieildfm2elnvs;t4 etomo oydfptr n il()s2uoim3iudape  fet t srtrxmoou0tlto feiat mDeanmpnu)artrxo3oatfmteaivs ( sexmimpou4alt  ieta( a2uaumo;o4opxo iciat m ulu p (4tlerxfcoytoateluvi;t)s2tr(o3nodam nlfvtlt sDta(  nt0olt mietltfs2umn o u) ltoxo oodlmt  ueo;t  etmxmpoo4amen feia(f 2ra(rpnt1ole mfciadfa ulnmo ()aetoxr3tadfate uei () euoirpny1olt miet sf 2tru oou0aeeniietldlaDumnvsnu0trxoifcoatomteai il() 2urio oy4lpe livs s)sDtmxr oo1optomocilt a2uanmon()arermr3iy1lptr i ils) etmxrpio4lmtemncsatfa2uaurpoo0tlxo oeilsfa ua( onu)trxnxf3oy1oa r i il() 2tr(mpny4lpeelicta()aDtaurpno0olenio3ilslmDum( onu4trtrif to1fpDraieils0 exoxm3iy1ome lfcia( aruau oou1tee ioeiltfm rlu onu) exoio todlp  au sls) 2trxm3iy4apte fesls aDua(mpot4oltoifciadfa2emnvsnu4 rtnmr oytlaDr uvols0 2uo(opiu1ll e fetas  2rrxr oo1ape  ieiad m rauvsn(4artniocoadlpD ai i ()trur(opiudoltn ivi s  rrmx  nt0aptoiieiad m2ul( snu4tlxnmo3tatlp  ln i ( trxr(m ou1omee nctl(faDrmxmoot4tetn i3iadlm umu s u)areoir3oa1fmteluvolt  eur(rpiudopt mfciat  rua(mo;u1tex mociytfs emnmo;t0altrmo3ty1oateliesls) rurir nydal emnctlt sDtax onu0oetomi3ild m em(ms;()tlerif3oytoat lu ilt texmimpoydlp e fvtls)arum( onu4oeenifeiltfsDumu o;(4aexniocoatop  anvo t)texoio3iudole lfcsas)s2umur ou1ale if3ild s ul(ms t4aexoio3ootlaD aueslt0 rtmir no1omt licsatf Duau p;t1apenmfcildlmDulnmo (0tltrirciy1fm raies (0 eumxo iodamtnlieiltfaDtaxr ot1tpeniiciatfsDea( s;(4trerxrcoo1omDranvo s)s2xoirpny1amtn nvtat)srrau  ;t1optoio3iat s rl( s;t0tltoxocto1fa  luvil() 2umxmpou4am  lieil( srtr( p;t0tleomieiaslsDrmnmont) exrif iatoaD ai i s)seum(r3no1alt liet ( aDuaump;o0aexomiciytla2umu s;t4 eerxr ta1om  lnvo s)trurir3oy4openmfvsa()aDrr(rpnt0tpt ioetldla2umnmo;u4trxnif oa1la  livsls0 etr(o3oudamt  ivilt)srta(m ;u0tpt mo3iydls uau snt0tltomrciydlaDrlnesls0t2trim iy1opt mnct t a2rru  ot4opx mo3iat aDuluvpn()alxrxf iadlmt lnes t  etrio3nu4am  miciatf Dta(m ;o0alto ociatfm rau s u4arxnmrctydla eanesls)seur(rpio1alen ivs tfs2urumpno4opxnmi3ils s rmnms ()aetrxfcta1opt  ivi t)s2tm(r iu4oltnmfvsasfarumumpou1oee if3iatls ranmp t0 leoio todlpDrli s t  rumir3ny1lpt lfesl(fs2urum nt1tltnifeiytfa2uan p;t0texrif todlm eaivsls) etr(rpnudlp nmfet s arrr(m ;u4aet mfcilt a rmuvp (4arenio3ta1lp r nvil(0 2xm(rpiu4lmeemictl()artm(r no0oetnmf3ilt a2umnvon(0trxrif3tytfmD auvs s s2xmxrpoodomtemnesas)sDururoou0oetn fcild m2rauvp;(4 lxrxo3io1lpte nvsls)srxmxmpoy4ape lnviltf 2rm( oou4oetoii3iys sDemnvsn() exrifcta1laD aivi ()s2tr(m3iodolenlivi s srumx p;u0apx mfciadlaDelump t0aeenmf oa1lptelu o ()t2tmirpoo4ap nmfcsatfaDum(mo;u1tpxnmi3tatls rl(vo;t) eenmf oytlate u il()trxm(m nu1apeelfcil( srraump;o4apeoiieils aDran s;(0arerxf ty1fa rlivi s0trxoio oy1op e icslt)a2urx ont0tpeoiieias m rlu o ()aexoir ta1late n i;t)s2xmxr3nu4ap  micias)sDum(m ;o4opx mf3iaslaDuanmp t4teeoxfcio1faDeaueol( t2uoir io4lpeemivi sf 2um(  ot1oee  feiyt m2eluvo;(0texoxo iotla r n sl( texrxm3iydllen nvils)s2rm(r ;t0tex  icilsls2uanvp ()trtoifcto1fpDrlnes;()srxmxr oy4olt  ivt tf 2umuroou0opx ioetlt aDrl(mp (0artrmr ootoaDrlues t s2um(r3oy4ol  mfvslt  rrrxr nu4oeeniiciltlm el(msn(4arxnmr3oadoat luei;t0 2xrxm3iodaltemfct t)srta(  ou1olt ifcilslmDuln pnu) etoxo3iotfpt  n ol( s2xriopiydllt lfctls) 2rm(ront4opxnmoeild mDem( p t4aetnxr tadfate ivo;( s2tr(opny1amtn ictl(fs2trurp;o0aet  oeiytfm ea(vo t)aexrio3todopDran s (  2uoimpiydoltnlnct () 2umu p;o1olxomfeiatlmDumn s ()tetomfciadfpt luvs s) eto(m3iydomt mnes tf rrmuront4tleomf3tldlm umn snu4 etrmo io1omte i i;(0 rxo(r3iu1omenlnesasfs2tr( o;u0apenmictyslmDeauvs;u0tetoirctydlpDe nvol(0t2xm(m3iydoptemnet t)arumxm ;o0olx  oetydls emnmsnt4tetrir3oa1fpDeai s;t t2xoir iydlltnmncsas a2tm(m ;o0tleo o3ilslm ra(vs u0altoirciytfaDe neilt0sexriopoy1optnlfvtlt)a2uaxm no4tpto ieiytla2ua(mo;u) rtnmo totfaDr ieo;t sexm(mpiodol  mieil()aDuru ont4altoifetydla uan snt0tleomr3ty1opD lu ols)t2trxopiodlptn neslt) 2uru ooo1oexnmf3tlsls rln snt4 ltrmr3oa1fptrluvo;s s2uoxr ou4llt mfvsa(fartaxmpno4aptomoetldla eluvp;t4 reriociodfpDeaueo s)t2umimpoudop emnvtls s2um( o;u1teen fetatfs ran onu)arxrmr oydlptrau sls  etm(o3oo4ale miciat)aDtau  ;o0aptnmociysfsDeau snu0aexnxf3tatomDrluvi t texrim ny4oltemnet (f rraur ot0apx ifetlsfm2rluvs t0 rtrif3tatop   uvsl( s2trir3ny1altelnet s sDtaxrpou1tpxnifeilsfm uau p t0aeenmr3tydoate nvolt0 2um(opio4optemnvtl(f 2trxmooo0tet mo3iaslm2rl( o;(4 reoircoodop elnei;t  etmirpiodapeemfeias sDumurooo4aexomictlsls2rlnmo (0aexnio3totopD lies t t2urxr oo4altnmics ()a2rrxronu0apeoiietytlmDrmuvp t4areomo3iytlat li s;()s2xmim3nu4alt micias)artr(  ou4oeenifetaslm rmn p t)tltrmf3ty1la   n i;t) exo(r3ou1op e fcia(f rtrumo;t4aptomo3ilsfm2um(vsnu0aeermf3iotlp e ies s  rurxm3nodom nlicias sDra(mpoo4tleoifetyt a ua(vo u0 rxnmo3iy1fp  liei;s trxmxopnu1aptemnetl(fa2tmumpou1oltoiieiaslsDemn o t)tleomf3ootlpt  nvs;( sexo(opoo1altnlnvil(fsDrm(mooo1tpeoioctytls rm( pnt)tetrio ootfatelieils  exrimpou1amtn fvs t)sDrm(mp;t1aeen o3iyd s rmnmon(0tetoxo3tadfp rln i (0srtrir no4om   nvilsfsruru oou1olenmf3ilt mDem(vo (4 etnircoytfmD anvsl( t2toim io1apeemfesl( artrum ;u4alxnmi3ildlmDuan o (4teeomo3oa1fat li i s0 2xrimpoudopt mietasfarrrumpoo0teen ictatfsDulump;t4 renio oytlp rlies;t) etoiopou4ol nlfvil(f Dumum oo1aptnmoeilslaDuanmsnu0 rtrxf3ia1la eai i;t)t2uo(mpnydlpte nvsl(f Dtm(mpot0teeo ietltlsDranvsnt0arerifcoy1omtean i ()seur(opno1ll n ncilsfsrumx ono1opto fetydlm eanmp (4trxnmfcoa1om e uvo;t s2trxr3oo4ll nmivil( srtmxmp;t1alenmi3ildfaDuluvp t)alenxocto1fp e ivs;t t2xr(opnu4altn fctlt) 2uau  ;u1aexo fciytlm2umumo (4tlxrxf ootlm  li i;s  2tr(mpio4lptn fcta()a2umxmpou1apt  f3tlt s rlnmpnu0alerifctatop e uesls srxrxrpou4opt  ncsas) rrmxrp;o1teeomo3ild s2uluvp;t0alxnmf3oodlat  i s s) 2tm(m ou1om emivsltfartaum ;o1opeo ieiat sDemuvo (4aexoxf3todfmtrlueolt0texrim iudam  lnetlt) rraxmo;t0oltnioetyslaDum( o u)tlxoio3todfm  anvo;t0 rxm(opio1opt liet ()a2tmx oou0apxo oeiydfs2ranvo (4tlxoioctodfp  aneslt0s2xmimpiu1llt liviat artau pnt4ole  oeiaslsDel(mo;()texoxociy1fpDeanei;t)t2uoio iu1apee nct (fsrurxmoou4tpeniieiatls2rm(vs;u0altrir3oydfp rlu ols0srur(r3ou1am e iei t  2ua(r nt4tet ifeiltls ea( s t0aexoio ty1om  an i;(  eurir iydol  miesls)sDrr( oou4tlxo f3ildlmDrauvs;()altoio iatfa  lnvil( texoio no4lp e iviltfartaumpno1aexnmociasfaDumuvp;t) etomfciytoat anvo ( s2to(mpny4op  lnvtat)aDua( p;u1alto f3iatlsDua( s (0 lenmrcoy1lp rlieo;s srto(m3nydam   fci t)arrau  ;o1opx  f3iltlm elnvonu) ltoio3iy1fa raivi;t) 2xmxmpoudaptn nvilt s2ua(r ou0alenii3tatfa2ulump t4aetrmo iytfate nvslt)srtmxopio1lpt mivia( sDur(mpot1tetnifctldlsDeluvs (4teenxf3ootfaDe nvi;s0 rxr(o3ny4amte nesa() 2umu  nu1aexo ieilsfs2rlu s;u) lenxo3tadomtrau s;t) 2xr(rpiu4ame mivsa(f 2ra(rpnu4texnifciadfmDelnvs u)alxoxf tadfa eliesl(  exr(o oo1aptnmncslsfartaurpot1opt io3iydlsDrauvpnu0aeeoio oatfa ranvil(0s2xmimpiydom  mfes sfaDrru o;t4alen iciat aDemu o;()arermo3iotom e uvs;s)truoio3iy4ap   ietls aDtaxroou0apto fcilt aDel( o;u)tlxrio3oodfaDranvi (  2xoxr3nydapen nciat)sDuaumoot4alxn ociltfa em(mo;u) exnmfciytfmtranei s  2xoio oo1apt lict s) Dum(mpno0tee mieilsfs2rl(vo;t4aeenir3oa1lmDe uvols0 2ur(o3no1ol n fvsas)sDtrxm ;o0olt mfeiadlm2uauvs t)aetnxf to1fmD an s s tetr(o3nu1ale  ivsl( srtmxrono4aeenii3iaslmDrlu o;t4teenif3oo1lm raueil( setoxrpno4lleelnvi s sDumumooo4oltoifeiltlm2ranvsn(4teenxr oadopDraivil() rtmiopnu1om elnvtatfsrta(mp;u4oex iieildlmDua(vpn(4 etnxf to1faDeaieslt0setrio3iy1optemneiat)srtrxmp;t1aptoio3tydfa2um(vsnu) rxnmr3tadfm  aues;t0trtoxrpoy1llte ncsa(fa2umx o;t4oetnmfciatfaDelnvs t0areoxocoy1omD lneil( trxo(o3ny4alenmfesl(f 2rru ooo1opt mocild s2rluvo;u0aetrio3iydlmDeluvs t srtmimpio4amt  nvtls) 2uaxmpnt0oet ioeiadfs eln s;()tlxoircoytfpD li i t  rtoxm3nu4lltn icsasfsrra(  ot0olx  feiatfa2eluvpnt4aleomrciodoat aivslt0trtmirpnu4lpeelfvia(f 2umx ono4opxoio3ildls2uluvon(4trxoxr io1lpte ieo;(0 2xr(r oydale  ictatfartmxmp;o0tlt mieild mDrln s;u)altnio3oy1fp r ieil(0srtmxr iodamen fesa(f rtaxm nt4olenmfeildlmDemuvp (4 leniocoodfa rli ol()trur(m ny1ame mnvta(farrm(mpnu1tetoiieiytfm eanmo u)arenif iy1omD au ilt)srumim3no4altnmncil()a2rrx oot4tpx  f3iadla2uluvo u4altomf3iytlaDeli i s  rtmiopio1ame mfctlt  rumum ;o1tltoif3tasls el(msnu0trenxf oodfmDeluvs t trtrxopoudamtnmfei sfa2tm(m ;t4tpeomoetlsla em( pn(4 eeriocia1fatraneols0 ruoirpoo4lle mnei s) Draxro;t0opeomi3iyslaDrlums;() lxriocto1lm elies t teumxo iy1apt lietasf Dur(mp;u0tpx  o3ildlmDumumo;u4texnmf iodomD  ueils0srxm(r nodlpe mfeilt srur(mp;u4aptnii3tlt mDum( p ()altrirciytoatranvols)teuoxopiy4op n ieil()s2raxmoot4aee moeiad m2uanvp ()trtnmf to1omteau s ()srxr(o nu1lp   icsatfs2ur(mo;o4aee mfeiatlmDra(vo;u) lxrmr3iadomDelivi;s) 2to(o3nu1op  lnci sfarrr(mp;u4aetn i3iatls2rmn ont) eeoxr oadfp   ies;t)tetrir3iu1lm nmneil() rtrxr ;t0ole mociasla uanmp;(4artrif3tatoptraueo s0texmxo iydlpenmfei t)srrmx o;o0aeen feilslm2umnvs;t) leomrctadlmtrlivi ( trum(o3oudlltnlfcta()srtax p;t4optniieiatfs2rauvsn(0 lermf to1lmt auvs;(0seuoir ny1amt  nvils aDraur ;u0ape  f3tldls2rl(vo (4altomoctydopDeau slt setrio no4altn fcsa( aDtm(rp;t4oeeomfeild a rmu o;t0aetnxf ta1fpt ai i t)t2umim3iu1aleemneiltf rtmxmpnu0openioctltfmDrauvpn(4altrif3oa1laDe u i;t0truo(opny4optelnetas arumx ono1tlxomoctlsfa emnvs;(4 lxnmo3io1fa raneo t)sexmim3iu1ll nlfesls) 2uaxm ot1tleo o3ilt a2ul(vs (4artrxr3iodla   ieilt  rtrir3ou1amenlfcsa(f Dtmxrpoo0aet if3iysls2ua(mo;t0 lenmo todfp  livils)seumxrpno4lm   ivsa( s2urxmp;u1tltomietatfa2eauvon(4alxoxo3iadlaD ln o;s trxriopnydapt lnci (f 2tm(rpnt1alxoif3tatfs2el(vo;u4 rtomocoodopDe n i;() rxoxo3oo4om nmnetat)arua(m no4aet ii3tat aDuauvp (4 rtrio totlpt  ivols0s2xoxmpiydop   ivi ( srtrx pot1olt mietldfa2rmu p;t)tltnmfcoatfpD lueo;t0srumio3oudopt mfetl( srumx oou4tlx  o3iydfaDea(mo u0aeermocootoaDrai i;t)s2urirpnudopeelncia( s2rrur ;u0oexomfctldla2ua( snu4 ltrxrcoy1oatelivi;(  2umxopoodllee fcsa(fartm(r ot1oee  ieilt a2ul( s;()tetnmfciodopt aieo (0 2xoxo oydalte ivi ( a2raxrpnt1texn f3tld aDul(mo (0 ltrxo3tydfmteauvols0texriopny4lmenmfvt sf ruru  ou4aeeo i3iydlm um( sn(0 etoxocootfa r u i;s0 rxoxm3oudllt lnvsatfa2rm(rp;o0apenmfetls m eau p;u)treomo3todfmtrauvsls) 2ur(opoo4op emiei t  2ra(m no0tetnif3iyt a rmnmpn(0 reoirctydfpDelueil( s2uo(o3iy1lm elfvsls srrr( p;t4ole  ietatlm ulums t4trtomo3totomDr u il(0s2tr(m ny4om n fes s)a2rm(m no0tltomfciys mDra(mo u)tltrmrciatfpDeau s t0 exo(o3no4ll nlfci ( srta(mpno1altoiieiydfa eauvo;()tetoircoydop  lu s;t)seurxm3nodaptelfvtat sDururp;t1optn i3ildfa rlnvp;() eenio3todlp   neil(  euo(mpoudll elneiasf ruru  ;t1tlxnioetlsfs rmnvpn(0aeeoxf iotla e nei;s0teur(rpny4lmenlieil( sruau oot1opxomo3iydls2rluvp;u0 ltrif3iy1fmDrlnvo;s0t2tr(m nu4apen fctat sDumxroot4oexn o3tys sDrauvon()texnmo3iytlmtrlu sls trur(o3oydap n netas)aDtmurpoo4aeto f3tatfm2rln sn(4 lxnir3oy1oaDran ols0teurxopiy1lptnlict tf 2rrumonu0oltomoeilslaDea( pn(0aeenmf oadop   ivs;t)trtmxm iodam nlnvslt)a2trx pno1ale  feiytla ran pn()alxnmr oadoaD  uvs;t0trto(r nu4altelfvtat)a2ra(monu1ape  feilt m raums ()tlxnmfcoytlaDraieo;t) rtrxmpnodapenmfcsltfaDuau ont4opxn ociat s2elnvon(0aleoir oa1om eanei;t t2xrimpiudalt  ncsl() 2raxr ;t4texnmfetlsls rauvs;t)trxoifcoadlmDeli i;(0t2xr(o iu1ame  ncsas) 2umxm ot0tlt mf3ilsfm2emn p;t0 rxnxf tatfmt  ivs s0srum(r oydlp n iet (fsrtmum ot4tex mf3iysfmDranvs;t) rtnmo3tatlptr ivs;s  ruriopoo4opt mnvsl(  2umx oot4aetoiictytfa rm(vo;() lxomr3totlm raivs;t0 rtoir3no1llen fcsl()a2ta(  ou0olenmoctld mDrlu pnu) rtnmoctadlpt  nvi;t seum(rpoy4ap  livs ()sDtm(  no4olto ieiasfa2emn s;t0tetoxrciotlmD  neo s0trtrir3iudlpenmfviat srtr(ront0oet ifciydlmDeanmp;u4 etnmoctatfptr n i;s)t2trim no4olen ies s)sDrau  ;t4olxnmi3ilslm2rln p;u0tetnmr3iodlm  lneo s t2trxr3io4ap  lnctl( sDtmx o;o0alt mi3tlt m emnvo t4arxnir tatlmD aivo;t)t2urxm iydam e nesls)srra(r nt0oet  feiydfm eaumsnt0aleoir3iytlmtr u ols0teum(m3ou4ame lictls srtaumo;o1apxnifeiysfa2rlnms (0texnif iy1opDr iei t0srurxrpiudal e nciatf 2trumonu0aexn i3iyslmDem(mo;(0tetnxr3oydlm rliesls0srxm(o3oodal   fvtlt)aDtaur nt1ope io3taslaDra(vo;t)arxomo oatomD lieo;s)s2xoiopiu1lm  mfvt (  2umuront1alenmo3ilslm2ul(vp;t) ltrmfcoatoa e n i;s  rur(o3nu4lmtnlfciltfs2tmx  ou4tlenmociysfaDrlnmo;(0 ltnir3oodlmtean o ( trtm(m ou4lmtelivt t)srtmu  no1texomoeiasls2ua(vp t)teerxr oy1opDr u sls)t2trxo3no4op nlfcs t  2rr(mooo1aeeomieilsfs2umu s u4tlerxr iotfm  ln s ()srtmxopnudlpeemieta(fsDtm(r ;t0tleniieiasls rmnmo;(4teerio ta1oa e u ils) eur(r oudlmte ictl(  2ur(rp;o0tpe  octyd s2rl(vs;(0 etnmo ia1laDeln o;t sruoxo3oodll n fvilt  2rr(  no0olt  ieiatfm elnvo;u4tlxrifciytlp elu s;t tetm(o3ou1lltnlnes (  2uru oou4aexomi3ilsfsDemnms;u0tleomf oo1faDranvo t)t2urio3ny4aleemneia( s2umx oot0openifeiysfs2eau p (0 rtrxo3oy1lmDrauvo;t seuo(o3ny1aptemfvsltf 2tmx  ;u1aetomictadfsDrl(mpnu0altomo3totlptelivi;s)s2xrirpoo4al emfci ()arrmuro;o4tlx mietaslaDemumo;u4 lerxo3io1omD li s ( s2ur(mpiy4apenmicsat) 2um( ont4oltniieiydls rm( snu4tlxnxo tytfpDran sls teuo(r3io1ll  micilt  Dum(mpoo0oexo fetadls umnmo;()aetnxf iytfaDelivi t0t2xoir iodam emfeiatfsrua( oot0tpe mf3ilsfsDem( p u0 lxoio iydopteanvi;()sexr(rpoudopen fvs (f 2uax pno1opeomoetyd s2rln pnu0trenxo tatlaDr nei;t0tetoim nudamt  fctls sDraxro;t1aeen fetatlm ua(mpnu)tetoif oydopte uvilt) 2urir ny1lptemnes (f Dtaxr ot1aee mo3iyd sDul(vs;u4trtrifctodlatraieils0seum(opno1llen neta( s2tru oot4oex mo3iltfs emnms;t4trxnif3oodfaD  ivi t0t2urirpoydam eliet s a2raump;u1tee  o3tatfmDra( s;u0arxnmo3tytomDeliei;()setm(m ny1lptnlnvt ()sDurxrpoo0tlt mfetat m umuvs;t0tltoxf iydlptrlnei;(  2urxr oo1altnmivsls aDumx p;t4open i3tys mDrmuvpn(0 lxnmr3oodop  aues ( t2tm(o3io4ol nmivsl(fsDrm(mpno0tpxn o3iyt m2rauvsnt4arxrmocty1oat  ivil()seumiopno1lmen iei s)sDurur oo4oetn i3ild m emn s;u0texoir3tatfptrauvils)sexrxm3ou1optnmiciat aDtmxm ou4texn f3iysfaDumnvp;t4 eenxo todfatrln slt srurim nudapeelnvtatfs2ta( pou4tlxomoctldfsDrmu s t0 reomr ia1omt  uvs s)tetmim ny1lmenlieias)artr(r nu4olen f3ilsla umnmsn()arxrio iodfaDeai i t)srtrxmpny4lmee icilt) Dumxrpnu4alxoio3iltfm2rl(vp;u4artnxocoa1opD  neil(0s2to(m oo4lptn fvils  Dtm(m no4oet mieiyslmDum(mpnu)texnxfcta1lpte neil()trurxrpoudam n nvs t)aDuru onu1apenmfeiytfsDranms;u4trxrxo iodla  lnei;s0t2tm(r3iu1lme  ncias)sDtm(r ou1opxnmfcildfaDrl(vs;(0tetnxf3tytoatrlnvils)s2xoxm nu1lmt  nesa()sDrrum oo1oltomictatfa rl( pn(0teeomfcootoatelneo;t0srumxo ou1amt lieslsf Drmxmp;t1tpxoiociltfa2uluvonu) reomr3iydoa  ln s;(0srurim nu1ap e ivt ( aDraumpno0optn octydfmDemuvp t)tetnmr oadlatrluvsl(0 2xmxr oo4ll  mfeil( a2ta(mpnu1ape ii3iaslm umn p;t0aetrio3oydfmtr uvo;s texmxm3oo4lle mnei ()srtrxront0tlt mi3iatfmDuauvo t0 exnmfcoa1latrlnei s0s2xrir no4lmtelfvs tfsDrrur nt4olenmf3tltla umumsn(4 rtnxo3ta1oatr i sls)texmxopny1ol   fvsas  Dtmxmont1oeto iciydfs emu o u0aexoxrciatfp  auesls)teum(o3iy1llte nesls  2rru  ;u4tlxoii3iyd s rm(ms;u) rxrxocia1omDeln i (0seurxo3no1lltn ncilsf 2trxmp;u1tex ii3tld m2ranmont) reoxf iatlat li s (0s2urir3nu1al e feia(  rrm( pnu4optn i3tldlsDea(ms;(0arxnmfcoatomtr ieol(0 2tm(opiydoltn fcs t) 2tmu o;o1alt iietytfmDulu s u4tlxoifcia1la eauei s0 exo(rpou1am e ieils)s2ta(r ou1tet miciasfs uln p t4trtoxrcoy1lmD lu sl()srtmxo3ou1op emncs (fs2tr(mpnt4oet miciyd m rm( s;()alenmo3ta1op  livi;t)t2uo(opou1op   fetasfaDtaumpnu0aexnmociys m2ulnmpn()alerir3to1fat luvs;t tetmxopiudamee feias s2umu  ou1apt mi3ilslm ul( pnt4arxnmr3tytopDrlivo t0 2ur(m3oy4amtnlneil( a2umuront1oltnioctyt a elnmp t4alerircoytfp r ieo s)s2xoio oydap nmivi t)aDuaump;o1apxnmocilt sDrlu o t0alxrmrcoytoat  ivil(0 2xrimpoo4olee nvil( arta(r oo1apxoioeiys m rl(vo u0artrmocoydlaDelnei;s0sruriopiy4olenlfes (fsDrmxmpnt0tex  feiatla rau o u0 renmf3ta1oat lueol(0sruo(o oo4lp nmivi ()aDum(m ;t0tpxoif3iad m rmnvont)tetrmo3totlmD lueo (0 rumxm io1al   ici sf Dtrur ot1olxomiciadlsDelu o t4treomoctotfp r nvil( t2trir3oudapenmfesat)aDrau ono0alxnif3iysfm emuvo u4 exrif3tadoaDelnvs t)truoimpny1lpe lfei () 2rmur ;o4tee  ietlt m emnvo;t4aetrir3totfmD lu ils  rxm(o3nydalt mieslsfsDuau o;u4ole  oetlsfa2ulumo;(4aeenxf3oo1faDe neo t  etm(o nodlptnlfvsas sDrm( ono1alx miciatfs2emuvo;(0altomr ootla  liei t)texm(r ou4ll emfvias) 2rmx o;u1tex  i3taslm2uaums t)artomr3to1oaDrlieols0srxrir ny1lle  ncsas)a2rax pno1tpxnmfeils a2ea( o;t0tlxrirciatlatranvi s) rurxmpny4lpe mietat)s2rm(m ot0olxn iciyt aDran pnu4tlxnxo iydfpDeaieo t0srxmimpoy4optn nctltf 2trxmono0tltomo3tlt a umumont0 ltrmo3ia1oa   i i;()s2xo(r oo4lpeelietat  Dtm(mont0alt  feiydfa2emnvpnu)texoxrcoatoa  livo t setm(rpnydlm  lnvil()aDtr(rpno1ope  ieiydfm elnvo;t0tlerio tadlp e uvo (  euo(opou4apeelnes t)a2trump;u1altn ocils a2ea( p;u4trxoxociotlp   iei t)s2xoir3oo4amtelnetl( sDumxr ;o4apxn ociltlmDumuvo;(0 lxnmf ta1lm ranvo;t)trtoirpny4ape  icia(faDtrx  ;t1apenifciytfm2rmumo;(4tlerir3oa1lmte nesl()trumimpoodllenlneiasfaruru ono4aet if3iytfsDrm(vpn(0 lerxf iytfpD ln sls seurxopnodalte ics () Duax p;o4texoiictatfm ua(vo u0tltrio oa1fptelies t)teurxo io4ame lfcta(fs2rr(mo;t4aeeoii3iyt sDemump;u)tlermociadlp elnvslt0truoxm3no1lpte fvi t)srtaxm nt0olxniociysfmDul(von(0aexoxf tadfmD aueo;s teuo(m3ou4lmt liesls)artmu  ou4apxnmoetadls2uln p (0tlenxf oodfmtrlu s;t)trtm(mpou1openmivsa() rur( oou4tpeoioctat mDulumpnt) ltnxo3oa1la rln s;s0trxr(r3nu1om elnvs t s2ua(mp;o0tpeomi3iltfm uln p;()aeenxociatoptrauvi s0 2tm(rpoo1al   nes ( aDtaxr ;t0opx  fcils a2uauvo t) lenxf3tatlpteauvilt) eto(r oy4al nlnvs ()srrru oot4opeo fciydfm umnvo;t4 ltrircoo1lateai i;t0 rumxopno1ol n nviltfsrraxr oo4optomi3iadla umn on(4 eerxf oodfptr u s (0s2xmxmpou1omen nvsatfsrtr(moot1alxomietldla2ul(vpnt0tleomf ta1fatr ivs t0srtr(m iu1al nmfvs s srtrxroot1aee mfctatfa umn sn() exnif tatop raivs;s  2toio3ou4ape mfetlt  rumxmpnt4ole  f3iad aDraump (0alxrmf oy1lp   nes;s0 rxoxm oodlm elivs s  2taxr no4opto ieiys aDeau p t0trtoif3totfatr ueolt) rum(o3iu4ome mivi tfaruaxr nu0texomociadlaDeln snt)tlxoxo3iadfm eauvo s0srto(mpiy4am e ivil(f 2trxrpoo4opxn f3tat m rl( p u0 etrmf iodlpDr uvs s0 2urim3nydlpeelfvta(farumum ou4aptn oeiltlm uauvp;(4 etnir3tadfmDeau i s0 2toir3oo1amtelfcsat a2taumpou4tet ioeiadls2elnvonu)arxomocia1om e uvsl( s2umxmpno4ape mnvt sfa2ua(m ;u0tpe  i3iatfa rlnms;u)texnxr oydlm   ieo ()s2xoxmpiu1ap n iciltfs2tmx  ;o4tpxnioeiydlmDrl( o t0 lermf3tatfpDrau slt0setmxmpnu4lp e fetltfaDtrxm nt4aleniictadls em( p ()aexoxfctotfm  lueo;t0 rur(m3iodlpee fcilt)a2rr(roou0apeomfcilsfs ulu s;(0 etnmr3iotlaDraues t srum(opnudlltn icsl(fa2tau p;u1apenmoetat a rm(vpnt0altnmfcoydfp rlieolt srxoir3oodapeemfvsas)aDrm(rooo4oee iiciyd m2uau o (0alxrxo3iadfat li s ()teurxmpoy1apt  ivtlsf rtmuro;u0tlen f3tyd a umuvo u0 lxrio3iotlat au ilt0 2xm(r3iy4alee iesat)arurxr nt1tle miciasls2uln snt)aetrmr ty1lmDelies s  rurir nydolenmncslt arrm( ooo0tpxo oetlslaDeaums;(0 rtrir oa1lpte nvo s0 etrirpoydap elieia( srtrurooo4tltoioctad a2rmu p;u0aleoxf3oo1lmDraiei;t  rxriopnudaltelictlsf Dtmu pnu0opxnmi3iatlm rl(vpn(4 etoio tydlaDrlu s;t sruo(mpoydllt  fvia(fsDuaxmpoo1tpenmfeiat m2umn p u4trenircoatom r nvs ( s2ur(o3oy4lm  miciltfsrtmu  ot4oeeo oeiasla2uauvs u4 rtrxrcia1om  lnvi;s)trtmim oodalee fvil()sruru pot0aee mietyd m rmuvs;(4 rtoirciydfm eliei;( tetr(r3no4ll n ivsat aDtr(mpno4alto fetls aDua( o u4aexrxr todfm rlu sl()t2trxmpnu4omtemneilsfs2rr( pou1optniocias a2el( sn()treoir3totfatranvs;s0s2xrxr3nudlp n fciatfartm(m nu1teenmo3tys s2emuvp (4tlxnmfctydfpDeau s;s  2uo(r3no1om emnetl(fsDraumo;o4apxnmi3iltfs ulnvs;t)texrxrciodlp  li i s0srxmxopnu1al elieia( srtr(r ;o0texn f3iadfm ulnvonu0tlxoifcoa1fatrlu o;s0 rtmxr3io1ol emncsls s2rau  ou4oex  f3tad aDeaumo;t4aeerifcty1omteln o s0 rurxrpiodlm elnesat  2rau  ;t4tetnmo3tatlm2umnvp (0teerifcta1lpDean sl( teumio oy1am e fei tfaDrmum ot1oexnmiciyt sDra(vo u)trtrmoctotlaD  ivs;t0s2toir3oudlmt  ivt () Dra(mp;u4oexnmiciydla rluvo u0 etoio3tytlpteai s;t0t2tm(mpoo4am e fvsasfsrtrxm nu0oetnmietyd a emnvs;t4aexnifcoadoate n slt  rxrir io1olt lnet (  ruau oot1teto f3iatfm rlu on(0 leomfcootoaD livo;t setrxmpou4olt  fct (fsDua(moou0oex mo3iadlaDuau on() exoircoatla  anvi t) ruoir io4opt mncia()sruau p;t4aeto o3tls mDemuvp t0tlxnirctotlpDrlieils0teto(opiydape  fcias  Dtrum nt0openio3ildfaDulu snu4 ltrmo iatfpte neilt) 2toio3oy4ll e fes s)aDuru  ou0tle mfeiydfmDel(vp;t4arxnmo3ta1faD  neolt setrxm3oy4openlnvi s)a2trumoot1aetomiciysla uauvs (0 reoxrcia1lmDe nes ( trxoxo3nu1alenmnesa(fsDum(mpnt0apt iietatfa2emnvs (0altrircoodlp  lueolt)s2toim3nodlp n fvil( arum( o;o0ale mfctatfaDeau onu4alxomrcta1op rauvo;s0texoxr3nudapt mncias sDtm(r no0aeeniieiysfaDuauvp;t0altomo tytlm eaiei;( srxmir oo1lmtemicslt) 2uaxmo;o0alx moetyslm ra( o (4tlerxociy1optrlieils0 exrxm iy1opeelfct (f Dumur ot0oetnmo3iatlaDrl( snt4artrifciadoa rauvo t) etoxr iy4olt mivi t sDrmur ;o0oet ioctat m2ea(vp t4 rtnif ty1fmDrlnesls srumxr3iodalt mfetlsf 2ra( pnu1olenmfciadfmDranvp t)tlxnxo totfate n o;( teuoim iydamt  iesas)srrau onu1tptnmf3iyt m2el( p;u0artoiocta1fmDr u sl()tetr(rpou1al n netasfartaxmpnt4ole ioetat m rlnmon(0trtnxfciotlaDelies;( s2xm(m3iu1al  micils  Dra(m ot0apxo i3tltla ranvpnu4aeenxf3totlmtrauvi;s)srtr(o3iudal  mnesas s2tmxmo;t1aexo ociydlsDrm( o t4 ltnxrcoatfp   ivilt teuoio3nu1alenmfcs sf Drau p;o0tpto octat mDeluvonu)trxrif3oatfa  anes;s)t2xmir3nodamen ncsl(faDtru p;t0oeeo oeiyt a umump (0texoio3iy1fateluesl(  2xm(r oy1amtnlncilsfarum(m ;u4apx iictls a ranms;(4arerifctadfaDrlies t)trxrxr iy4op e nei t s2uax  no1tlxo oetytlm2rl(mp;t0tlxrxr3ta1fa e ueo;t0trumxm nudapen neias) 2rr(r oo1ape  i3ils m rau p t0tltnio ta1lpDrlivo s) 2xm(m3nudlpe  ncils)arrrx poo0aetnmfetldlm2ua(mp u0aetnxf oy1opt  iei (  ruoxopiu4ole  nvs (fs2rmxr oo4opeo octadfaDranmsnt4 eenioctadoaD  ieo;s) eur(o3no4al elies s)sDraumpot0tltoioeildlaDel( o;t)artrmo oadfmt livi ( s2xm(mpoodam e fvs ( aDur(m ;o1tpt  f3tat s uan o;()alenmocoadfp   ies t)s2tm(o io4lptemnvsl( srtm(mp;u0tpxo ociytfaDeauvsnt0trxrifcoytlmtr nei;s teurxrpny4opeemncsas aDrmur nu1apxomieildlmDranvo;(4areomf oatlpteluvo;s0t2xoim nudaltn fes t aDtau  ;t1opxnmf3iasls rlnvs;u) ltoxo3totfmt lnei s0seuo(o3oodop emfvi t) 2rax o;o1apeoio3ild sDulu p (4tlxoxrcta1lm eanvi;t tetrxopny1lp emnvt sfaDurumoot4tlxnif3ils s2ra(vpn(0artnxf to1fmDeluei s srur(o3oo4altnlicsat  rtrurpoo4alenmietyslm umnmo t)trtnmo3iotfpt ln i ( setm(rpoy1lp nmietlt)s2umu p;u4tlxn ociasla rmu o ()alxoir ta1fa   nes s) exr(m iy4op  lfvt s  rrm( pou0aexn fctys a2emuvp;t) eermo3oydfatelies () 2xoiopio4lpee nesasfs2rrxmpou0tpx mfeild s2em(vo;()teenir3iytfmDranvi t0 rxoim nu1omt lfcils)srrauro;o1olxo fciysfm2eanvp t4trtnio3ty1latraneslt)sexmio nudlmee nvslt  rrr(mo;t1tetn fctasls2ulnvsn(0alenmr tydfpD  ueo;( seuriopny1lmt  ies sfsrrm(mo;u0tltn oeiasfa ea( onu0 rxoircootopD li s;t0seuo(r io4lmenmneils sDraum ou0oexnmietld a2elnvont4aeermo3oodlpt an i;(0t2xr(r3no4open feiasf rtrxroot0olen oeils a2rau o u0aexnio3oodfm e nvil( sexrirpiy4ap elfcil(  rtmu o;u1aeeo i3tlsfsDrlnvp;t4tleomf tatlpteaueilt) exm(opoo1ll elieta(fsrtax ont4tpeoio3iasfa2ra(ms;t4treomoctydoa ean i;(0truoirpio1ale mici t  2rmurpno0tpxn f3iyslmDulnvonu4alxnmfcoo1omteanes;s trur(r nu1lp  lietls  rurxmpou4aetniictas m2rmu o t0treoxocio1fm elues;( sexrim ny4ole lfetl()srtmu ooo4tpen i3iltfa2rl(mo;()trerxrciodopte u olt)seto(o nu4ome mnvtlt srraxr no4oexn o3iasfs2rlums u0aexoxr3io1lmDe uvolt s2umirpiu1ome  ici sfa2rrumpoo4oetn oeiasla rmums u4 rtrxo3ootlm  ai i;()sexrim3ny1lltnliesasf rumxm ou4teenioctysfm2rmnvo t0teenxr3oodfm rlu s;s  2xoir nudlme mfetat) rrau p;u1tee mieiadlsDrau s;u4aleriociodomtelnes s0 rumxm nydopte nvslt)aDta( pou0apt mfeilt sDel(von(0trxrio3tadfmDrlivol(0texrio3nudlp nlfctl(f 2rau poo4tetnii3iat aDea(mp t) ltnxr tatoateaivo;t)teuo(rpoy1amtemnvtat aDraxm no0aexnmfctatlsDuln p t0artoxf3tatoaD auvo;( t2xrxo3oy1ll emfvt s)s2rruro;o0tle mieilsla2rmnvp;u4artnmf3iydlaD li o ( t2xm(mpoudom  lnetlsfsDrm(rp;t0tpe io3iltfaDrmnms;t)aexrxf3ootomDelieols) rtoimpou1ll nmieias)a2taurooo1alt  ieildlsDrlu on(4trxoir iodopteanes s  2trirpoudape lnvtl()arrm(m ;u0tpt mfctatlm2eluvo u0tlerir iotlm e iesl()texm(o3nu4apt mnvsls srrrxmpno4alt iieiadls2elnvp u)texnio3oytlm  anvs;(0tetmxmpnydlptemfvia(faDrmuronu0teeoii3iydlmDuluvp t0arxnxr iydfmtr neols) rurirpnudap   fcs s sDur(r oo4tex moetlsfaDuan ont4tltrirciodfmD  n s;s0 rtm(m3iodopeemivs t  2umxm ;u1open feiytfmDrauvs (0alenio3iatoptr i o;t0 rxoxrpoudol n fet (fsDra(mont4olt iictlt a ea(vo u)aexnmrciy1opt livilt  rxoir oudol emnvsa(fs2uaur ;t4oee mietld m2rln pnt0 rxrmo3ta1optrlu o s s2tm(o io4apenlivia(f rrax p;t0opeoiieiydfa ua( onu)aetnxr3oydomtraueo (0 eurxr oy4apt  icsa()artru o;o4oexniocils s2umnvonu0arxrir3oydfmDe uei t0tetmirpoudllte fcsat)srrm(ro;o1oleo ociytla2umuvs;(4 etrxf3ootlaDe ivi (0setmir3oudal nmietas srta(  ou0opeomoeilsfs eau s (0tlxrmf3totoatean s;()teto(rpoo1lptemivsa() 2tm(mo;o0tpe  ieiytfs2eluvp;(0alenxr3ia1lpteau s (0texmirpnydll  lictat a2rr(mo;o1tpen fetydls2rauvo;t4 exnmr3oodlpDelivi;t trtr(m3io4ope  feiatfsrrrxr ;o4oexoiicilslm elnvpnu)trxnmo3oadlaDeanvi t sexrio3nodllen fes s)artaumono4tptnmicild s2elnvpnu) ltrxr oatfmD  ivi;(0 eto(m3oudoptelfvsas arra(r nu1opxnioeiyd m rl(mo;u4teeoxocoytfaDelu ilt)t2umirpiy4llenlieiat) rtmxmp;o1opxn oetyt m2uauvs;t)trenmrciy1lm rlivs;s) rtoim oydom  micsl(  rraum no4oet ifciasfaDul( o;t0 exnir iatfmDean i (0srtmxr3oydaltemieiatfsDtrxrpno1opx ifeiatlaDrl(vo ()aetnmr io1oatraivils  2uo(mpny4aptemfci t aDta(mp;o4oeeoif3ils aDuanms (4arenmf tadomDrlivo s0sexr(o3io1ol emneslt  rumu pnt4teeoiictysfa uau p (0trtoxo3iotlmtr n i;( setmxmpiu4olt lnctl()a2tr(mo;u1alxn i3iytfs umu s;(4teerir ta1lat luvslt) rumir ou4oltelfcs s)sDtm( p;o0aexnmfeiltls ra( s u4teenxo3tytlpt an i;s  2toxopno1lp nlivtltfa2rax pot4tpxn oeilslsDrmnms ()alxoxr iodfatrluvi;s0trtmio3nu1optemncsl(fa2ururonu4tle moctld m2rlu o t)artrmf3totlmDrli o;s0 2tmxr oudoptelies s  rua(ro;u0tetnmi3iad s2el( o t4artrircto1laD luvi s) rur(o oo1ol e nctls)aDtm( p;t0openii3iyd m2el( s t) rxnmrcoydfmD  u i;t0 rtrirpnu4am  mfcs t  2rrxr ;o4tlxoioctlt mDua(msnu)arxoio3totom rliei;t t2tmimpnu1ape lnvil(fsDumxm nu1aee ioctldlaDua( o;t0arxnif3iatla  luei;(0s2toio oo4ape mnci ()s2uauro;o0olx  fctltla eanvs;(0arxrifcto1lp   uvsls) rxr(r3iu4op nmnet t srrm(r ;o1aeeomf3ildfm el(mp () rtrmr3iodfm  lueslt0 rtoxr3iydll   feia(fa2ur(mp;t4alt  ociytlaDul(mpnt0 eenif oa1lp  li s s0 2um(opno4lme licsls a2rmur ou4alx  f3ildla2emumo;u0 rtrmo3ootlmD  ies;()s2xoxmpiydlp e icsasf 2umx  ;o0aptoiiciltls2ul(mpnt) exoio tytfmt liesl()trxm(opoodlpt mfvt t  Draumpno1tpxo i3tld s rmuvsnt) renxf3to1oa e ivolt  rtr(r oydam e fcil(f 2ra(  no4olen iciydlmDra(mp;u0tlermf tatlmtrai o t)s2uo(o3no4lp   nes tfsDrrx pno4tpt  oeiytfs2uluvsn()alxoiocto1fpDr n olt0 exmirpno4am emnvias sDtmxrpoo1altnii3iytfs uau onu) lxrmrciadfmtrlu olt teuoir oo4al  mfvsls s2tm(r no1tpx ifeiltlm2em(vp u4arermo iatlm ran slt teuo(r ny1lmte feil( srtaump;t1tpt ifctlt m ulumo;t0teenxo3oatlpDean i t)trxoxopoo4omtnlicsl(  Dra( oou4tetnio3iyslsDea(ms u4tltnxr tadfmt li i;t)truoxrpnu1al   nvs (faDtr(monu4apxomfcils aDrm(ms u)arenifcio1faDr n o (0 exrxr nu1op e icsl(  rrmxmonu0opx  f3iltlsDemu p;() exrio ootoptrlivs (  rtr(mpiu1lltn nesl( srrax pno1tpe mo3iydlm rmuvs u4 ltrmo3iotfateln o;s0seurir iydopenlfctas s2rmxr oo0teen ietls a elums;()aleoif to1lptraues;t) 2xrxo nu4opt liciat)sDtru oot1tpenii3tyt a2ua( o (4tltomo oa1laDe ueo;()trxoio iydlmt mict ( aDuaumpoo0tex iiciytfs2el(mont)teerxr io1la eaivs;t  eur(o3iydlmtelict (  Duaur ;o4teeoiieiydla2ra( p;u0aeenmf tytfpte neils0seuoio3nudap nmieslsfa2urxrpno0opxnmi3tasfa em( pnu0trtrxr3oytlatelu s s)trxoxo3oudlmtnlnei t s2umumoot1tlx ifciatlm2rm( o;u4tleoxf oodfaD ai i;t)setoirpno4lpt licsa() rtmum ot4tlenmo3tyd a2rl(vp;(0trenmf oa1om ean i ( sexmxo3nu4al  lnct (fsDum( pou4aex  i3ias a2elnmp (4teermr ta1opte ueils s2umxr3oy1aptnmicil() 2rrx  no0alxoif3iyd a eluvonu0 lermfctatomDelivs;t sruoiopny4ap e iesat) Dtr( pot0texo oeiadfs ra(vs ()tltnmr ia1faDelu o;s0 rxrir oo4amenlicsl(f rra(  nu0oeen f3iyd m ulums;(4aleoxfcoytoaD  ueo;( tetr(m3iu1olee nvt sfs2trumo;u1apx  oeils a el(mpnt0 rxrir iadlateluvi;s teum(rpoo1ome  fvsas srra(rpnt4tpe mo3tysfm2rm(monu0aeermfcto1lmDraueilt trxmxmpiy4olt mfvsat sDtr( poo0apxnii3tls s2eln s;(0alenmo3todop  li ils  eum(mpnudal emfci sfartru  ou0olen ietyslsDrmnmp;t) rxomf3ta1oat  u i;(0texmxm ny1aptnmivt t artmumoot0opxo oeiys a ul(monu0 rxnmr iy1laD  u sls0truoiopnu4lpenlnctltfs2urx pno1alen feiatla rmnmo;u0 rtoxr iadlmDr u slt s2uo(m iodame mivsl( sDuaxm ;o0apxoifctyd a emu p;(4 rxnxr oadomDeluvs;()seumir oydoleelfetlt)s2trur ;t0tlxomictasfs ulnmonu4 renio3oo1fmD ln i t0 etrxo nodolenlfcia(fs2uaxr nu0oltn f3tyt m2rm(mp t)tlxrmo oatlmDeluvi;( s2tr(r iy4aptemnci () 2uaurooo1tetomociatfs umnvont0 ltrir oatf
\ No newline at end of file
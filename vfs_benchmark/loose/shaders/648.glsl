@@ -0,0 +1 @@
+n sls0s2xm(m3nydoltemfcsa()aruru  ;u4teto f3ias a em( p u4tlenmr3oy1fa eanei;( t2tm(r3oodape  iet t)arrm(rpnu1aleoiietyslm rmumo;u0altrxr iodlmD  iei t0srur(m nu1oltnlicsasfarumu o;u1aeeoioeiysla2umumo t)trtnircto1fpD ai i;s trxmim3nu1apenmiesl(fa2rr(ronu0aeeoiociyslsDelnmonu4arxrmrctytlpt auvo;()tetm(r iu4al n nvtlsfartrumont1oexoii3iaslmDelumon(0trtrmf oatomDeau il()seuoim nudomeelivslt arua(m ;t1opt  fetldfm2em(mo (4tleoir3ty1optelivsl(  etoir oudlleemivsltf Drmuroot0oleo feiltfa em(vp;(4tetnxf oo1faD ln i;s  rxm(rpoo4lpte ivilsfarrru ono4aexn ieiadls2umnmon(0altnif to1fat aivolt0s2um(r ny1ame lfesls a2ta( o;u0oeen oetltlaDel(vp u) etnxr3ta1fmDeaivo s  rtr(r no1olte ivsls  rrmxmono4opxoiiciyslaDrln p (0tetoiocoodfatr n o;t0t2xoio nu1ol nmfcsas)srtaxrp;u1olx micias sDul( onu)trenmr oa1fatr nes;()setmio3no1ol nliesatfs2ta( o;t0aeeomictat s2emn o;()aetomr3iy1optr i ils)s2trxm nu1olt  feil()a2ur(rooo1alx  f3iatla rmn onu)teerir3iatfate ieslt)setrirpnu1lmtnlneils) rraxrpoo0tex  oeiyslm uau o ()tlenif to1opD lu s s  2toim ou4ale mnvi s  ruaxmoou0aleniiciysfmDeau ont0aetoxf3oo1latrlnvi;s0 rxm(m oudlpe lictl(faruaurp;t1ape mo3tyslsDel(vp u4trtrmo3to1op r i olt0 eumxo iudope lfvilt srrrxmono1tpxomiciadfa rluvo t4 eerxo3totlp  aieolt)s2um(m3iydal nmnct tfsDua(moou4aetoifeilsfsDrlu o u0 rerif3to1opt au o s) eur(r3oodole lietas  2trxr ou1apx ioeilsla uauvo;(4trerirctytlmtelu i ()s2uoxo ny4lm   nes t a2umxro;t1ape io3iadlsDemumo;(0trxrmo oadopDe nei;t trtrxr oy1lptelfeiat)s2um(m nu1oetoio3iltfaDuauvs;t0 lxrmf iatlpt anvs (  2xo(mpny4omtelnctatf 2ta(rpoo0oetomocils sDul(vp;(4 renmr3iatfptr ies s)t2ur(r nudlmtnmfetatfarururono1tlen f3iytlaDea(mpnt)trenmfctytlmDr nvo s0 2uoim3ny4lptelictat) 2rr(rpot1apxomoeiysls uauvo;u)texrmf tatlatranvs ( s2tmxm oo1lle  ivsat)aDtru pot0tetnmo3iysls ul( snt)texomrcia1optrln i;(0s2xo(o3iu4olt  ietl()aDrr(mp;o1opx  i3tyslm2uanms;t)tlxrxf3oydlmD lueo s trxm(mpnydal nlivi t)arumx pou1tpeo iciad sDuaumpnu)trerxocoa1lmte i o t) 2tmir3oy1al   ivsls  2tauronu4oex mi3ildfaDra(vo (0aetrxf oo1fpDraueslt teuo(o3no4op  liesat)s2tmxr oo4opx iociydfm2uln p t4tltnxr iatla eluvo;t  2uoio3oodoltnliesls) rtm(moou4apt mf3tldlsDraumpn() etoiociydlmDranes ()s2tmim oo1om  lncsa() rtm( o;o0tpxomo3taslaDemn on()alxomo3oy1faD luvolt)t2uoio3oo4ome  ics (  2rr(roou0aptnmoctls s elu o;(0tlxnmr tadlmDr nvo;t t2urio nu1lpte icsa()srua(mp;o1oee ifetat aDrmnvsn(4 eeoir tatopDeaueil()t2xmim3nodlp   ivsls  2ra( ono0tptoio3iasfsDemuvs;t4trtnmr3oy1optrlivo t0trur(r3io4am e nvslsfs2urxr nt1opxnmfeiatfaDua(vp () ltnirctatlatr ieilt)srtrxrpno4lpte ictls s2trxm ;o0tee mieiysfa2elu o;(0texoxf3iy1fat ln s;t0 2xm(m nydlp  mnes s)sDtrx onu0alt moetltlm2um( snt4areomrctatlm e neol(0 eumxm nodom nmfet t)arur(rpoo4aetomfciat sDumn p;()aexrmr3oadlmDrlueo s0seum(m iy1opee netltf Draxmono0apto f3iys sDul( ont4texoifctadlaD  uvo s0setrir3nu1omt lfei s) rra( oou4tptnifetydlm2umu p;u)aetrmf3tytoa eaivi;s  rxrxr3iy4op  mfes (fs2tax o;o4teen ieilsfaDeanvo u)trxoxr3oytopDe n ol(0s2to(m3oydomt livi t) 2uax  ;t0tltnifcilsls eanms t0arxrmocoydfaDraues t  exm(rpio4al  mnes sf rua( pnu0olt mfciasla el( p;u4 eenmo oodlm e uvs s0texrio oo4alen fvtls)s2rau pnu1olxnioetyd s rmums;u4 rtomoctydomD  n ol(0 etmir3oodlltnlnei s)srrru  ot0optnmfciat s rlumsnt) lenmo todlpteaues;t0 2uoir3oy1lpeemnvi ()arumxmp;o1tpen ieiltlaDumuvsn(4trxoircoadoaDeaivi;s0 rtmiopny4opte ics s) 2tru ooo1tlxniictyd aDrmnmo (4 exnmo oadla eaneo;s tetoiopnu1om  mnctls) Draur oo4tet  i3ildlaDelnvpnt4aeenif ootlmtrluvi;(  2urxm3nudlm   fvias)a2tax o;t0alx mo3iydlmDuauvo (4 rtoxf3iydfaD lieo s)s2uoir ny1alen nctas) 2um(  nt0tptoio3iyslmDumu s;u0 exnxo3tatlp   i slt0s2trim3iy1ol eliviasf Durur no4oeenmiciltfmDrm(mp;u4tlxrifcia1lmDeluvo s sexoxr3ou4lle  netl()srua(m ;u4tpxo iciltls umnmp ()tlxnmr3oydfateln o s0 etr(m3ou4lp n ics s  rtru p;u1alxoif3ilsfm2em(vpnt)trxnif3iadlmtelivs;s)srxo(o3oo1lpe mnvtat) rtr(  nu0olt mi3iysfmDemnvonu4 etrxf3oy1fmte i s ()s2xoio3nudllt  ivt t) ruru p;t0aet ii3iatfm el(ms;t4 rtomf3iy1fmt  nvi s seurir iydomtelnctlsfsrumu pnu4tex mf3tlsfaDrl( p;(0 etoxr oytfm ran o s)teur(rpoo1amt  nctlt)a2umum ot1tleo oetydlm rluvsnt0tetoxf3oatfp r nvs ( trxm(opiy1lltn nvsat  Dua(  ot1optnmfeiadfmDelnvonu4altnxo tatoat luvsl( trtm(m nu1ape  fcs (fs2ur(ro;u0tpe mictlsfsDulnvp;t4aeerxo3iatop eauvols)s2urim io1aptn fctatfa2trum ;o0oetniietydla2eluvs;(0trxoir3tydop rlueslt0trxoir3iydop emfvi tfs2urumpnt4tee  ociasfa2elumo;(0 renxr totfat  nvs;(0 2ur(opno1amee neslt artruroot4alenifciyt sDua(mp (4 exnmo3oo1lpt lnes;t  rxmxm iu4apte ici (fsrrrxrooo4apeomieiat s2eanvs t) rtrxrciodlaDe n ils) etoxmpnu1lle lict s)a2tmx p;u0apx  iciydfaDumu o t4aeeoio3oytfpteaies t) rxoxo iodoptn ivi tf rtr(mpnu1opx  ociyslm2emuvo (4artnmo3tadfpt aneil( tetrim3no4amen ivsatf Dtrx  nt1alenmo3ildfm elnvo;u) rxnifctytfp  luesl()t2to(o3oudomt  ivtls)srum(ronu1tee  i3iysls2ua(mo;t0trtrxr oydoaDe uvs t)t2to(r3oudlpee ieia(f 2ta(mpnu4teen o3tadfaDeau s t)tetrmf iodfp eaieo s)teuoiopiy4amee ict sfsDuaxmo;o0olen i3iysls el( o;t)aleomr3iotfp raues;s  2uoir iy4omenmnvs tfa2tmu  oo0opxomicildlmDemuvonu4aeeomrctydfpDrln o t  2ur(o nodlpt  nvi tfs2rmum oo1tlxn icild a eauvp;u4 eerxr3iytlpDrlieilt0srumxm3ny4lp emfvt ( a2urx ooo0tpenmieiatfm2umnms (4 rtnmr3iodlp   n s;s s2trxm3ou1lltemfesls)a2ua( p;u1tltnmocildla eauvs (4aetrmo3iodlmteai ol( sexrxrpiu1op emfeia(fsDumumo;u1alxn oeiltfmDelu o;u4arxnmr oa1fa e ues;() rumimpiu4ap nmietatf 2rm( pnt1ope  octytfa uanvp () lxoxrcoo1lp e n il()s2uoirpio4lm nlfetlt artaxrpno0alt if3tyt aDeaumsnt0tetomociydlaDr ieils0 eum(opnu1omte ivt ( artruroou4teenifetasla2rl( sn(4 lenmr3io1lpDr ieo t0tetrimpiodopt lics ( aDuru pnu1apenmo3ildfs emumont0 eeriocoodomtrauvs;s0 exoirpio1amt mneias s2tm(rpou0optoii3iatls ra( s u)tetoif3tytop  an o ( trxmio ny1lltn nvt tf 2tr(rp;t0oet moeiytfm2umuvs;(0tleoio3oatfa   ieilt0sexo(o3iu1ame mfes s) rrrxrpnt4oex io3ilsfa rlumsn(0 lxoxr3iodom e ivo;s srum(m3no1amtn nesls)sDtm(mono1alxo o3tlsfa2emnvp;(0alxriociodoate ueslt0 etoxo3ny4apt mietls  Duau pou4olxnmi3tls m2ra(vs u4 eenir oytfpt  n ils0trur(m3nodopt  ieiatf Duaxm ;o4tex mf3tldla2uanmo;u0arxnmoctodlateau o;t srum(o3iy1al nmnvsat sDrm(r ou4aetoio3iasfa rmu o;() eeoif3iotopt  n o;()trxmim3iu1op e fcilt s2trxrpoo4oltomf3tlt mDum(msnu4artrif3oa1fat  ivo s)s2toxo3io4olt lfcslt)srur( ooo1oee ifcilsls um(monu0teeomo oodomtr ivs (0s2xoir3ny4alt  ncslsfarumxr ;t0olxnmoctydfs2rmnmp (0 lxnxf3oatlpD li o;t trur(o no4ll nlfei s) rtrx p;t4olx  f3iltfs2rm(vsn()trxnif3oy1fa r nes;t) rurir3iy1lm elfeilt arrmxr ;u4aexnmf3iyd a eln pnt)tlermr iadlatelnes s0 eurxr3oy4opee ivs s)s2ua( ooo0aee io3ild s um(vo;t4tlxoxf ta1opt lu slt0srxrxr3nydom nlnei t)a2tax pot0opxn iciad a2rmuvpnu4aexnifciytlp r ueo;s texrio iu1amtn ict tf rtmu  no4optnmoetad a um( p;() ltoir oo1lptranei s  euoxrpou4lltnlnvslt a2ua(mp;t4oltn oeiadfmDum( snu4aexnif3oy1fm r neo ()s2xo(m iudapen fesltfarrau  nt1alenmociyslaDemuvsnu)aexnxr iatoa ranvols)teumio3iy1ole lfctlt) Drmur no1apx mieiltfs2ul(vsnu4 lerxrcoytomDeln olt trxrir3oudamt lfcilt) 2um( pnt1tpx ifeiasfaDuanmpnu0tetrxf3tytfp rau s (0t2urim no4llee fvs sfaDuru poo4texn i3tasfs2eanvpn(0 rtrxr3oadlmD  ivsl(0 rxoir3oydamtemivtas)s2tmum no4aexoif3ilsla ulnvs;u4 leoio totlm eau s;(0setoxm3oo1amt  fet tfa2ta(mpnt4oltnif3iadls2ul( p;u)trerir3iatfm eauvi t0srurir3oudol nmnvt s arrrumoot0tlenif3tys s ranmp (4trerir iadlmD aueolt0trxo(m3ou1ape  fvt s s2raumoou0oexn feiad aDemu on()tetoxr3ty1lp  lieilt)seto(opiudll n fes s  2umx pou1tptnmfciytls umuvs (0 eerxr3iodlm e n ilt0s2xoxo3no1ll n feslt s2ra(m oo1alt  ieiydlsDulu o (0arenmo3oadfaD aivils0 exm(r ou1ap   ivsl()aDra( onu4apenmf3tyt s2rlnms;t0trtnmfcto1fmDeaivils sexr(r oydalenlncsl( s2ra(r oo0tpe ifetysfa2em(vp;u4tlerir3oadoa r ivsl(0t2tm(m oy1amt mfvi sf 2uaxm ;u0apt  ieiatls2ean o;(0alenio3oydopD aues ()setr(mpiu1optnmfvt ()s2rr( oou1tleoifeiysfaDulnmp;()tltnmrctatlptrli o (  2xm(r3oy1lptemicta() Drrx  ;o0ape iieildfaDrlnvonu) reomr3oy1lpDrlu il()t2xo(r3nudlptn nesl( sDrr( ono4oetnmf3ild s eanvs t4aeeomf totfmtrlieol(0seuo(o nodolenliviatfa2uru oou4aexomoeias s ul(ms;(0alenmoctytlmteanvils truriopnodamtnmfvs s a2ua(  ou1texn fciys s2ulnvsnu4tltomr3to1fpDr nei t)trurxopno1om  mnvta()s2ta(ront1oleniociatfa2ea(mpnu)trtomo iodfate nes s)trtm(r3ny4lm  mfcta(  Dtaxmo;o0tee  oetadfm2um(vp;(4tetnxo3oo1fp rln s;t)s2urim iudameelfctl( sDrm(rpou4openio3tyt aDem(vonu)texoir3tadomD ai o;(0trtoxm oudalenmnvta(fartrxrpoo4opt  i3ildls rmuvo;t4alermf oodomDean o;t)setrio3ny1optnlnciltfs2uax  ou0aleoiociadfsDrmnvonu0 eerxo oytlmDeluvils) rtoim ou1lm emnetl( sDta(  ;u4oetnio3tytfm em( onu0tlxnio io1omDelies;(0setoimpio4oltemneiltfa2tm(ro;t0oeeo iciat m um(monu4aexnir3iodfmt anvi;t teto(r3iy1ap emfci s)aDrr( pnt1apto feiys aDul( onu4trxrmr ootopDeli s s sexrxopno4lm nlneils)artrxrpnt1tetnioctydfsDum( o u0aeeoxf3ty1lpD aieo (0 eum(r nu4al  lfesa()sDumu o;t1oexnmoctydlm2ul(mpn()aexrxr oo1opDe n o;s) rumxo oy1apt  nei sfarra(m ;o0ale iociadfm uaumsn(0trtnmf iodla eanvi t0s2ur(r3ou4ll nliesas) Duaxr oo4ole mo3iadfmDum(mon(4teeomr3iotoaD anvi;s0 rxmir3oy4lm e ivs (fsDur(  ot1oleo octysla2ul(msnu) etnxf tydfm elivsls0t2umxm3oodal elnctlsfa2taxr ;o4apen o3tyd sDrlu ont4 exrif3oodfmD  i slt) rxmir iu4lmeelfvtls) Duaumonu1altoio3iadlm2rauvo t0teeoxocoy1lmt ln o s)setrir oy4ll  livi t)srum(r ou0apx mieiys s2raumo ()tetnxr3oadfa   uvslt0 exoxrpno1ame micsls srtrxroou4tpxnioetyt a2rm( o;u)teenirciy1fm rauvs s setr(opnudame liet ()sDrax pnu1tpx  ociysfa2rmnvo t0 etoir todlmteau s ()t2tmim3nodlpen fct s srrr(rp;u1opeo oetld mDeln o;t0 rxomr oo1oatr uvs;t0tetmirpnydol  lnesat) rururonu4opxn oeiydlaDua(vp;u) etrmoctydfp raieslt  2xo(mpoy4amee icsas a2umu poo0olx io3iad aDumnvpnu0teeomrcty1lat  ivo ()s2trxr3nodlm   nvs ()s2tr(mpnu0texomf3iytfm2uan on(0 rerif3tytlatelieslt0texriopoo4lmenmfeilt)s2umxrpou1aetn feiydlaDum( o;()trxrxf ta1om eli ils) rxo(m3oydopen ieil( aDua( p;u0ape mictyd mDuln p;(0tlenio oytopt  i ol() rur(m nudlpt  nvt s s2rr(r no4tpt mo3iltfmDuanmo t)areomfcty1op elivo;( t2xoirpnu1olenlncslt a2umu  ot0olxoiiciat m el(mo t4aeerxf oodfa  an ilt)setrir3ny4omtemfcias) rrrumo;u0oeenif3iadlm2rm( p u)trxrio3iotfp   n ol() 2uoir3iudolen ict (fsDtru o;t1tlenifctls sDuln o;(0tltnxr3iatomDeluvilt0t2xr(mpoo4altemivs (f rtmxm ou0aex  f3iyt mDum(vonu0alerxo3tatfm e ueo ()texrim3io1lmt micsas aruax p;u1texn i3tadla2rlnvp u4tetnmocia1oaD  uvo;()srto(m3nu1ameemieil(  Drmxmo;o0alenifeiasfs2el(mont0 ltoif iy1fa raivil(  eurxm3no1ome lfes () 2rrxroot1aexoiieils aDuan p;()trtrmr3iadfa e n o (0seto(o iudlp elnesl(f rumu  oo4tee mo3tldfs rm(mp;u) lenxocia1fate ivi s)s2xo(opiy4llt mnvs s)srtmu oou4oeen ieiatfaDrlnvo t0tlxrmr tydlpD  neo;s  exo(o3no1apeemfviat sDrmurpnu1optn o3iatls ua( o (0tltrmr3oo1fptrli ols t2umxr iu1ape mnesl(farrr(m ot1apen oetlsla2raumonu)tetoxr3iy1omDeau s;t trtmxm oodom nmfvs t)arta(  ;u1teeomfciyslsDumuvp u4 lxnxf3iy1fmte nes;t)texo(opoy1lmen neiatfsrur(r no4tpxo ociadlsDua(vo;t)tlerxr ootfpt li ols t2uriopiy1ap  mivt s) Drrxr oo4aeenif3iltlsDuanms u0alxrmf ty1faDeau ilt trxoxm io4op n neiltf rrrxmo;t1optomfctls m rauvo;u)aleoifctadla eaiei;t)s2xmxm3nydam nlieslt) ruaum ;t4tltnmo3iadfmDean snt) etomo3iydoaD  i o s)t2uoiopoydal emnct (fsrurx  ;o4tlx mi3iys aDua( s ()alenir tadfmtelieolt0 2umimpnu1lltelfcsl( arta( oot1tle  iciadfaDumuvp t0trxnirciatfat  neil(  rurxr nu4oltelncia(f rtaxrpnt1optn i3iydla2eanmp u0 eerircto1fp raivo s0trxoim3ny4lm nmnctlsfaDraxm oo1aexnioeiadfs2umn ont) leoxo todfaDraiei;s t2urxo3oo4aleelnctl( srtrump;u0oet mi3tytfaDuanvs;u)teenmocoytfp  anes;s0texm(m ou4op   fcslt)a2tau ooo0optoio3ilsfa2elnmsn()aetnio3oa1fa e nvi;()s2umir iudlmen ictlsfsDurxm ;t0tet  oeilt s el(vs u0arxnio3tatfaDrli s;()texmxo3ny1omenlfei t  Dtr( p;o0aeen o3ildfm2eln pn() lxrmocoo1lpt an o;t sexoio no1omtnmnesls  2urxmoot0tltoifciysla2el(monu0trxomf tadopt aivs ( t2umiopny4ole lfeias) Duaxmont4tlt iietlsfmDulnmon(4arxrxf iadom  lueils0seuoirpny1ameelfeilt)artm(mono0opxn f3taslm2raumpn(4aexoxo3iadfm   i i t)srumim nudllt  ivi s)a2rmxrpou0tpxoif3iysfa rau sn(0trxrir oa1fatelu o t seuriopiydaltemnvs tfsrur(  ;u1olt iietatfm eau o (4artnmrcoo1faDr u s (0seuo(rpnudlltnlieiatf Dra( o;o0oltn iciyslm2raumo;() etrxr3tadfmDelueol( tetoxmpno1aleelfctlt  rtrxr ;t0apeoiociydls umn s (0 rxrmr3oydopD li i t0srtrxrpiy1am nmnctas  rrru  ;t0alxo f3ilsfsDrmumo;(4 lxnir oo1fmD  ues;t)srto(o oydomt  nesl()s2tmx pno4olt ioctad a2um(msn(4texnio3ootoptraieilt truoim3oy1ape  nvi sfs2uaumono0alt ioctydla2uln o;u0trermf3iatoptraivolt0t2urim3ny4omtnmnvilt s2uaur nt1tlxomieiydlmDeaumo (4 lxrxr3ootoptrln s;()s2urxrpio1lltelfcslsfsDtrurpnt4opx  ieildfa el(mo u4 lxoxo io1oaDe ies t)s2uoiopiy1om nlfvsls aDtr( pno0apxomi3ils s emnmp;u)trxrxr3oytlpt  ues (  eur(m3oo4lp n nciatfsDum( poo1teeniiciysla ulnvs ()trxoio3todfpte ivo s0 2triopio1apeemfvt ( aDra( pnu0opxomieias mDul(msnt0alxnxf3tatoaDe uvils  exr(opiy1amtelietlt srua( oot4oleoioctltfs2umuvp;t4 leniociadfpDr ivo;(  2ur(r3ou1ll  mnei tfsDrrxrpot0alxnif3tys sDuln s;(0aeermo3oydoaD  ieslt  2tr(r3iu4lm nmicils)srraurp;t0oetoiiciatlaDemuvsnu)tlermr tatlptr ivi;t) 2xoir iydllt mfviasf 2umxr ot4ape ifeildlm uanvsnu)trerir3oadlmDr u o;t0t2ur(rpnodlmt lfcta()aDra( o;u4alxnmf3iatfs2eau s u0aetrxociadlpDrli i;s)s2umimpnu4lmenlics s) rra(mo;u1aptomfctld a2rln s u) rxoxo oo1op  lieils  2um(opny1apenmici t sDtmx pno1open o3tadfmDeauvpnt)texoxo oytomDeanvols trxoim oydlltn nvs t  rrr(monu4altnii3iatfs ea(ms;t4 rermr ootopDran s s sruoxo3iu1op nlivta()srtrx pnt0tlenmo3tad mDeaumo;()tetomocoadfaD ln s;t0 euo(mpoy1am nmict tfarrax pno4altnifeiadlaDrlums t0 etniociy1faDeau o (0 exoxm io4lpe  fcs t)artax  no4opt  f3ils a ua( o;t)tlerxr3tatfaDeauesls)t2uoim iy4omtnmfesat sDururpou1apxnmfetadla2uan sn()artnxo oo1lmDrlneo;s)srxmxm oudapee ncia(  2ra(r no4altomieiyt a2ra(msn()tlxnxo3todfp r ivi;( teuoim iu1llt  fet sf 2ra(mpnt1aet  o3ild m ulnvo;(4 rxnif iadlm rln o;t0 2xrirpoodomtemfvslt arrr(mpoo1tpt  fciytlsDrau onu4 reomf ta1lmDrlivi;t0texrimpnudamenlfcslt) rrrx ono0aptnio3iaslaDeln o u0 eeoio ia1lm  aiei;s0 exoxo ou4lpenmieslt  2tm( o;t4apeoiieiasfs2ulump;t4tleomrciydlmD lu s t sexm(o ny1lmt mfcils srta(r oo0ale  i3iyd m2umnms;t0 lxnio iotlm  aivs;()s2xm(m nydom n fvsas a2umx  ;t4tltniiciatfs2ea(mo (0treoxf oydfmDelnvs;()sruo(o oy1ap  lncsat)s2rrx  oo1apx ii3ilslmDrl(mp t0aeerifciatfmteli o ( s2ur(rpoy4lp e nvs s) rrau  ;u0oex  icils mDua(msnu4 lxoxo ia1oate ueo;(  exo(r3iy1om  micils)srua(r ;u1opx  f3tat m ua(mon(4aexrxr3oy1fpD  uvs t0trur(mpiydom  mncs ()aDuax pou1oexn i3tys s ua(mpnu0arxrmo3oadlp rai s;(0t2tmxm3ou4amt  feias)aDtmx pno4tltoif3ilsfs eaumo u4artoio iadlmD aueo t)sruoiopou1om nmfet s)aDrrx  ot4aexn f3iysls ulnvpnt)tlxoxociytlmtrai il()seurio3iodape  ivsas aDtaxm nu0tlto ociadfm2ulumo u)alxomf3iadom ranvslt)tetoxm ny4om emivsl()a2uaxr ;t4tpx  oetytfs umuvp;u4alxnmf3ty1fpDe iei t) 2tm(mpno4aptelnviltfsDtmxr nu1aetnifetydfmDum(mo (4arxoxr3iy1lp  lieo;()s2uoio ou4lme mnvtatfsDuaxmo;u1ole mf3tadlsDumumo;()trtoxr3totlateaueils srur(r3no4ll nmieta()arururo;o4oet  o3iltfs2ea(mp;u0aexnmo ta1lm   i ols0 2um(mpnudlptnmivia( aDrrurpoo4oexn ocilt mDrm( p (0 rxnifcio1fat ai s t0t2xoxo ou4al  mivsl() rrmxr ;t1teeomfciat m2ul(mp u0aleomo todfm eaies;s trurir3io1lm  lfcils)a2rrumpoo4oex  fctas a2eanmp;(4tltomf iadfpteluvo;(0seuriopiodlmt mfcsat) 2ta( p;t0alxn i3ild s ranvsn(0aexrmr3ootlp r ivils0t2xmxr3oydlptn ncs ( a2rau ono1opt ii3iltlm2elnms u0arenmf3iytoa elu ilt t2uoir no4op n nesa(f Dtrx  nt1oetomociytfs ra(vp t) exrxo todomDeluvsls)srxoxo3iu4op e ivs s srrm(r oo1ape iieilsfm um(von(4aetomo tytfpD ai s;t seur(m iu4lltemfvt (  rrmump;t0opeomociat aDrluvo;u4aetrmf iy1fpD  n o;s t2uo(r3ny4olt micias)aruau p;t0tee mfciadfm2umu o;t4 lxnir3tytlatrlnes s  etrxo oy1omtnlfci tfa2tax  ot4tpt mo3iadlsDum( onu4aleoxrcoo1fmtraueo;()texrxr nu1lltnmfvi t)srraur ou1texnmi3iltlsDrmuvo t0arxoxocoy1optrln o t)s2xmxrpnydll emicsltfsrrauro;o0tee  icias m2ra(vp;u0 lenif3todfaDr i olt0truoxrpnydllenmivs tfs2umx pnt0tltn ociysls2rm( p (0 rxomo3iatomt  uvo () 2uoim3oudopte net t) Dtmu oot1oetoio3tyd m rl(vp u0teeomo tytfa rlivo t0teur(r3no1om n fvs tfa2uax  oo1alt ii3tytfm rluvpnu)tetrir3iydopt lneil(0sexo(o ny4aptnmfcil()s2uru pnt1tptoioeiysla rau o ()aeeoxocto1fmtraivo t0 2xrio oudapenlnvi s) Dtr(r no1alx iocildfs emn s t)teerioctadfa rlnvil() eumimpiudol nlicil( sDtr(root0tetoiietasla2umn o ()teeomr3iotlm r n ols t2tr(mpiodaltn ivilt arrrxmo;u1oet mietldfm2eln s u4 rerxfciydoptrauvo ()tetmim3io1ol elfetl() 2ua(  no1olenmf3ild s rmnmonu0texnif iydlatrlnei t trtoxr iu1alenmfetlt aDumxmooo0aet if3tad aDuau p (4arxoxr tatfpDrlu o (0t2tmxm3nudalte feiat sruau  ;o0olxn fetatfs2emumsnt4 eeomr3iodfpD  ivo s0 eur(r nu1ap n nvsa(fs2taum nt4tlenio3iltfm em( on(0artrxo3oydfmt lu s;s)sruriopoydom elfct ( sDurxro;u1tpxn ocilt aDemuvs t)texnxf tatfm e ues;(0trtrxr3ou4lpeemfcs s aDraxrpot4tpxn ocild s2raumon(0alerxrcio1opDelu i t tetoxopnodal elivias)s2uax pot0tpt  oeiatfa2emn s;(4 rxrxf3to1omD liesls0 rxmxo3ou4omt mfcsat aDtrurpno0tet io3tysfs ulumsnu0trxrmrcoatlaDrlnes;t  2uoio ou4alt  fvtasf 2rru  ot0oexomoeiyd m2ranmo t0 lerif iotoa rauei;t0teuoxm oudal  liesat) 2tmumont0tee  fetls aDulnvs;()altnxf oydlp   ivo;t0 ruo(m3oodlltnlfcs ( s2urur ;t1tpxomfciyt s ulu s;(0areomr3totfmt lnvo s0 2tmxr3oo4lm   ieilt arrrur ;o0altnmociasla2ul(mo u0treomf tadfaD an ilt t2to(m io1ol e ncsl(f 2umuro;o1apt ifeiltfa rluvo t)teerxr3ootfpt  ueols0t2toir oudolee fciat sDrrxm ;o4aetomietlt a uan ont0 exrxrcta1opDrai ils0tetoxrpnu1apenlnci s) ruaxroou4oet iieiat a2em(mpnu4 etnmrcoodlpDe ivo t  etoxrpno1opee fetl()a2tmxrp;t4altnmietlt m2uanmo;u) ltnifcootopDrlnvo;t0s2uoxrpny1lmenmicia( aDumxroou0apx mieiltfm um( p;t0altoio todfaDr i i (0setoimpiudamtnmici ()s2um(m oo0texomietat m rmuvs (0 renmr oy1la eaneo ()trtrxopou4lptn fcilt arrrxrpnu0tltomfeildla2eaums;t4alxrmr3iatoptrlieo ( t2ur(r3io4aleelnct s s2rax  nt1alxn fetld a2ran p t0alerxfctotlmD  nesl( seumxr3no4ome lieia() rrr(  oo1teeo fciatlm2umu s t0alermr oodoptr uvilt0t2tm(r oy4lmt  ici sfaDraxro;o0oee mi3iydfmDrmnmo;u0aleoio3to1latr ueolt0 2tr(m3iy1am nmnci sfsrrmxro;u1oleoiiciys m2emumsn(4 eenxrcia1omDrlnvi;(0sexr(opoudlmtnlncs ()aDtmx o;o4alt miciydlm2uanvo;u0 lxoxf io1fmtelnvols t2tmim3nudamtnlnvsat srur(rpou4olx  fciad m2el(vo;u)aeerifctatfm elnei ()setoxm no4ale mfvsa(  2um( pot1tlenmfciadfsDrmnvsnu4 rxrxf3oadlptrlueo;t)trtmxr3no4apt liet t a2rm(r ;t4opx  oeiat a2rl( sn(4artoxocoy1late neil(0trxr(r ou4al  mfvtl(  2rax p;t1apt mfeilsfmDrmuvont0trenxfcty1lmDrauesls teto(opnydam e ies t)aDra(m ;o1opxniociysla umums t)tlenxr3oo1opDe nvils0t2xoxrpnudol   fesa(f Dur( onu0apeomoeiatlm2uln sn(0 lenmf3iydopDraies s0teuo(opiu4apen ivt t aDuaxm oo1tetnmiciasfa umnmo t0tetrxrcoadfpDraivolt0srxo(o no1ome  fesa(faDuaxm no1ale iictlsfsDuluvp;t4 lerirctodlmDrau il()s2xm(rpoydlltnlfvtas s2rau  nu1aptomo3ias aDelu on(4 etrmrciydoaDeanvol(0srto(o nudol elfvsl(  Drmuronu1oex  f3ildfa2rau s (4aexrio iatomDraivi ()truoio3ou4ol nmfcsltf Dra(m ;t4texn iciyt aDrmumo u)altoifcoa1lpt lu i ()t2umxr3iu4ame  ivtlt  ruau onu0oltn o3iaslm ua(mp (4 etnmo3oytomt luvs;(0s2tmimpio4lmt lfcil(f 2ua(mo;u4tet mo3tyd a ulnms;t0tlermr tadlmDr i s (0 rxmxopnydolt lneias a2rax  ;u1teenmo3iat a2eaump;u4trenio3oatoate i s ( srxrxopiu1altn ieiatfartmumpou1olt if3tld a ran p t4alermf tadlaDr ivs;s) rxmim3oydomenliei (fa2rmurp;t0teenii3tltfa2umn p;(4artrir3iatoatrlneils) exoxmpno4altnmfci s aDumx p;u4tpxo fctat sDum(mp t)tlxoxfciotomDrauei t0 rumxo iy1om  mnetltf Dtm( poo4olt io3iydfs2umuvo (4 lenmf ootlptrauei t0t2xrxopny4lpe mivs tfsrumx  ;u1tlx  f3tyslsDuln p (0arxomo3iadoaD au ils) rxoim iydlm e iesatf rraurpot4aeeo i3iad aDrm( o;t4altnmo iatopDeai i (0s2to(r3no4lle lieiat)arra(ronu1aetn iciys a umn s;u) rtrmr oadfm   uvslt)trxoiopoo4lp emictat) 2rru  ou1tpen icilt sDuauvsn(4 renxr3oadlpD  u i;( t2xm(o3nu1omeelicsl() rtaxmono1tlen f3iasls2eluvsnu0 etnmo oatfp  lueo;s0 eto(opno1ap emfeta(f 2urx  nt4tpx  octydfm2ulnvs u0areoxr3iatopDrai ol(0 eur(r3oy4lmtn netas s2raur nt1tlt  ociltlm2emuvs (0tlenir3io1faD livi;s0trxmxmpoo1ol nlnci tf rrrurpoo1aex  ociysfa em( s;t) exnxf ta1la e i i (0truo(o iy4am e fetas  Dtr(m nt0apeoifetatlsDuauvp u4tlxnmr3oy1fpD livs s0srumir3oodam e fct t)sDtau  ot1tetomfetytfsDrl(vpn(4 lxrmo tydlmDr neo ()srxmim3iodomee fvi ()a2rm( oou4aeeoifctadfaDrm( s;(0aeeoxo3ta1fa rlu i t  exoxmpny1lmt mncslt)a2raxrpnu0ape  octytla ulu o t4tetrmf3ta1oateln o;()trxr(o3ou4lle liet t)a2umurp;t4tpe mo3tltlmDuln p t) rxomo3oy1fp elivs;t0 exoir oodom  lfvt (  rtmx pou1olt  ictas s emnmpn(0trtomoctadlm rau s;t)sruo(m nu4amen fet ()a2uaurono1olxnifeiad aDel(ms;u)aleomf tydlat  n sl( s2uo(r3no1am n fet tfsrra(mpnu1olt micilsfm ea(mp (0alxrmrciytlp  lnvil( t2xo(o ny4lpe mncs s srurumpou1apt mo3iytfm2elnmo t0 ltnxfctotla e ivs;s texmir3nu4amenlivta(f 2raump;o0aex  f3tatlmDranvs t0 lermo3oa1fpteln i t  2xoirpno1ape  fvsat s2ur(mont4aee  icilsfmDel(ms;u0trtrio3ty1fa e uei t0sexoxr nodlmeelfcils  ruaxro;t1oeeo ociasfa2eluvp;u0tltrxo3iydomD ai o s teuo(opio4lm nlfet t s2raxrpoo0tee iieiltlaDrl( s;(0 etrif3todfpDr uvsl(0 euoxo iy4lmt mivsls)aDtmxm ;t1tlto i3ias s2uanms;t4altomf3iotlaDeai o;(0 exoxrpoudap nmncilt s2rm(rpnu1tlxoifeiaslm2em( on()tlxrmr ia1lmDr n sl()t2xmir3no1llt lncs tfa2raurpnt4apto fciaslm2elu o;t)trxniocty1lmt aivo t  exmir ny1lme livtls)arurx o;u4oeenio3tyslmDel( s;u) exomr iydlateai s;s)srtrim oodopeemfvi s  rrr(  ;t0alen feiyd a2rmuvs (4 rtrmf iytfpt aivs;t)s2xrio oy1am emnctls)srrm(rpou4tpxoioetadfsDuauvo;(0 renxf3oo1om elivo s0 2tmxmpio1lmenlivtlsf Dta( ono4tpxnifetld s2um(vs;t4arxrifctydoaDrlneo;t)s2trxr3nu4ame liei sf 2uru  oo4oexn f3iytls2el( s;u)tltoxrctodfpDeaueil()setr(m3nu4lmt mfetlt) 2rmx ono4aleo oeiyslm um( s ()trtrxo tatopt auvo;s0 eumim3io4ol n ivtl(farum(r nu4oetomo3tas s ean o (0 lxrmfctotlp elu o t0seuriopny4lme lnet tf Dta(r no4aet ioeiyd sDrlnmo (0aleomf3tytlm e uvo;t0seumir3iodlltnlies tfa2ur(m ;t0alen ietysfs2ra( s;t4 lxnmociodfm e nei (0 2uo(opny4apteliciat s2um(  ;t4olt ii3iyd s rauvp (0 eerxoctodop e u il( setr(o oo4apt mfeiat srtaum ;o4olxoii3iadfs ulumo t0 etrmocoy1lpteli i;(0 exoir3oo4llen fvt (faDua(moou0tltn fcildla rln o u) lermo3iadoa   uvils)setmxmpou1am  liet t srrauro;u1aleoio3tyd s ulnmo;t0tlxrxrcoodfm elieo ()trtrio3io4lltemfes ( aDua( o;u4tltnif3ildlm ul(mo;u0tlenxrctodfmtr ies;s)setmio iudlptnlnvs s sDtrumpno0alxomoctlslaDrau s (0tlerio3oodfmtrli s t seum(m nu1lltemfetlt)s2uau  ;o0aee mf3iydla ran s;u4alenmo3tytomteanvs;(  2xrim no1lpen nviasfs2um(m ;u4tpt iieiytla2ulnmon(0 exoxfcta1fm eaies;(  eumim3oo1lp elivs t) rrmuro;o0tetomo3iadlmDemuvon(4 rxrmrciy1lmtrln o;s) ruoirpnu4ame  icsltf 2rauront4tpeoiietys aDum( s;u0texomrcoydop  au i;( seuoxm iu4llt mfeslt srrmurpnu0tet iociytla ranmo t0texrxr3oatfa eliei (  rum(rpnudapt lnei sfaDtruro;u0tet  octydlm2el(mo;()artnxo oydoaDe ueo;t0sruo(m3nu1am  mivs (fsDra( pot4tptoioetad sDeanvp;(4arxoif oatlmtraieol(  rtoir3oo1am e fvi () Dur(  ;t4olt  oeild sDra(vont4tlenxo3io1laD ln sl( trum(r3nu4lmtelnet sf 2um(rpnt1optomoeilsls rmu o u)tlenxr3ia1lpD  i o;(0 exm(r iodalt lfetlsfsDum(ro;u0alxomieiad aDumuvs;t4aexoxfcoo1laD  n i s tetmxrpiydlptnmfvias  2rru o;o1optoiieiasfs2rmuvp (4trxrxr3tatfm rln s;(  2xo(rpiudomee nvsa() 2raurpot4aee ifetadfm2rauvs u4 ltoif tytfat lnei;t truoirpnudamen fvilt  Drru  ot4apeo feiad m2rlu s;u0aeermr3ootla  au o;()trtmxmpno1omtemnvsa() 2rau pnt4apen iciyd aDrmu s (4artnir3tatoptelu s (0srtmxo3iy4alee nvs (  Drmxmpoo1alt ioeiadfsDumnmo;u0artoio oydoateau o t0trtrxopiy4amt mfvilsfsDrmu pno1tle  ocias s ul(von()aetrxr oydoa eaneil()t2umir3oodal elncias s2taxmpot4optomfetld m rm(ms t) renxo ootomDrauvi (0trtmxrpny4opt mnvtltfaDraxmono4tptnmfciadlmDrmuvs ()alxnxrcia1fp ranvs ( tetmimpio4alenmics sfarururp;t0alenmoeiytlaDemuvpnu4 rxoxo oodlaDe nvi;s srtrim3iu4oltnmfviat) Duru o;t4opt if3ilt m2rauvpnt)aeerxoctadlaDraies;t0tetrim iudll nlnet sf rraxrp;o0opeoio3iasls2umuvsnt0 lxomrcty1fa rau ol( t2uo(m oudlp e ivi s) rum(  oo1openmf3iydlmDrauvpn()arermfctotoa eanes;s srtmxm io1lmtnmivs ( sDrru ooo4alto oetys a umump;u)arerif3todfpDe ivi;t srxo(m oudamtnmnvi t a2trxr oo1opeo f3iytlsDemnmp;u)tltrxo tatomteanei;t  2umio iy1ap n feta( artmx ooo1tlx  o3tasfm rmnvont4alenmf3oytlpteaivo s)s2umio oodam n nvtasfs2urx  ot4tet moctyslsDuan o;t4teeoif3ia1lptrlieils tetm(mpnu1om elfcsl() rrax ono1olen feiat s ul(mo t0trxrxo3iytop   ivo ( t2uo(o3iu1lm  lfcsl( a2rm(r ot4tle iictldlsDul(mo u0aetrifcoadfat  i i (0srxoiopnodole lfet t a2tmx  no1optnmoetlsfs2uaump t4 rtnmo3tadlaDraivi;(0s2urir3io4olt lnvsl( srrrxmooo1apx  i3iytlm2elu p (4 leriociy1fptraneil( tetmio3iodamtelfei s srtax pot1oex ifeiydfs2raums (4alenmf tatlpDe ivo ( trtoxrpiy1ll e fetl(fs2ua(ro;t4oleo ieiad s ulumo (0 eeoif iydfm  ai i;t0 etmxmpnu1lm nmnvs t)aDumx  ot1tleomfetlsfm2rm(vp;()tetrxr to1omtraieol(0trxo(r3ou4omee ieia( sDrmxmp;o4aet  o3iytlsDem( s u0tlxoif3oytlpt lnvs;s)teurir3ou4omee neta()arra( ooo1tlx io3iytfa um(mo t0teeomo ty1oa eanvsls  exoxopnodlmt mnctas)s2umuront4tpe  fciltla2rau sn(0trenmfciatfmD  nes (0teumim nu1llt  ivsls sDumx ont1openiiciytlmDel(mpnt4teermf todfatr nvs;s0sruoirpnydaptemncs () rrrx oou4opt  i3iydlaDrm(vonu4 rxrio3todfptelivs () 2umxrpny1ll  mietl(fs2ua(  no0oltomf3iydls rmuvpnu4treoiociydfatelnvo;s)setriopnodom   ivi ()artmxmooo4aexo f3iytlmDrm( s t4 renirctodlmDeln i t s2xrxo no1omtnmfci () rumxro;t0tle mo3ildls2ua(mon(4alxomo iydfa  au s;t) 2tr(m iodalt  neil(fa2urxr nt4opt mietatls2ul( p (4 ltriociodfmD  i s;s)tetoxr nudap  lncsat)srumur nu4teen i3iytlm2ean s t4tlerxo3oydfat aneslt srum(rpnudom   fvtlt)a2rmxrpnt1opto ociysfsDraumont)artoio oodlptelu s s0setmxo nodop nlnct sfs2tm(rpnu0ope mociasfm uaumsn()aeeomrctydla elivo;s0 2toxr oo1ole lfes t)arraur ;u0tpeo i3ild m2um(mpnu) ltomo tatlptrlnvi;() eurir3nu1lptnmnci tfs2ra( pot0alx mfetydlaDulu o;u4aleomo ty1opteaieo t0teuoxmpnu1op n nci s sDurum ;u0ale io3iasfa2ran pn(0 rxniocta1opD luvi t)s2xmxo iy1am  mnvt t)s2rau ono0tle mo3tlslaDeluvp u4 lerio3iytoate nes s trxo(o oy1al   ici ()srtrxm ou0oeen o3ilt m2ea( s (4arerif3oatomD  uvilt s2trirpiydapenlnvs t a2trum oo0tlxniocilt sDrln o u)alenmociytla elieils) eumirpoy4amtnmici tfsrrmxmooo0aleomociydfm2em(vp ()teerxoctadoptrauesls0sexm(m3nydllt mieiat s2rrxronu0opt mfciadfm2ra(vont4teermo iodlat livi;(0 rto(m3nu1ome mnetas  Drm(rp;o1opt  octldlm el( o;t0 reoxrcio1fa e iei;t0 etoim3oydlm e ivtls srtrxmpou0oetniictadlaDean sn(4arxnif3iatlat luvo ()srxoxrpoudlp nmfcils  Dta(  ot1tpt ioeiaslaDeaumo t4aexrmr iatoate n i (0texmirpiydomeemfesa(f Drmu  ou1alx mfetlsfm uau p u0aexrxf ootlaDrlnvols0trtrxmpoodlpeemies ()srur(  ot1apt if3ildlmDumnmp () exoio3tadfpt ln ils0 2xmxopnudome lnvt sfsDurum ;t4tpe if3tydfa ra( ont0 ltomrctatfatrlivo s0trtmxr iudop e icsa( srtaxm nt4tpeoiieiltfs uanvo (4artrxf3oytlmDr u o;t) eto(rpiydap e iviltf 2uru o;o4tlt io3ildls rmn onu4alxrio3iydlpDeanvs s0truo(o3no4llee ivt t  rumxmpno0tle mo3ilsfa2rlu pnt0tlxnmf oytlat an i (0texrimpnu4lm nmncia( artmxr ou1ole if3iyd s uauvo u) eenir tadfmtrlnes s sexr(r3io4ale mncilt  rrr(rp;t1ope  oetydfsDemu o;u4aeeomfctadlat  ues;s0s2to(mpnydlltnmicsl()a2tmuro;t4tex  o3tltlmDuau s;t4 lxoxo3iatfa   uvi;s0texmxopoo1lm nmfvt () rraurpoo4aexnmo3iatfs2emnmpnt0altomocoatfat lnvo;s)s2urio3no1lpe  fvi (fsDtru ont0tpeomi3iltlm2ranmo;t)artrifctadlpDe uvo;t) eto(rpno1lmtnmncs sfa2ur( pnt0opxnmfetys a uau pn(4aeerxocoy1omDrlnvs t)s2tr(r iy1lpte fes ( srta(ro;o4ole mo3tydls2rlnmonu) exriocty1omDeauvi t)texr(rpno1al  mfcsa(  2rmxmont1ole ii3tyd aDum( o ()teeoirciytop  lnes;s s2umir3oo4op e fvs s a2umumooo0aex mfciytfs2ua( p;u)trtrxocootlpt aivsls0t2umio3nydopt livil()a2ua(mpoo0aptomfeiaslaDelu pnu)tlxnxr3oa1fa  ai o;s0t2xr(m3iudal e ivta( srrru onu4texniieildla ua(vpnu) rtrio ootoaDe ieo;t  eur(o3oy4ol emnci () 2urx pou4aetoifetas m eluvs (0tlenio todlpt livilt srxrim3iodllee ivtltfa2um( o;u1tltn ictatfmDranvo;u4tleoif3iytlpteli o;() rtriopiudamtelietatf rrr(  oo1apt ioeias s emnmp;t4aleoircoa1om  lueslt  rtrxm3oydamenlfeia(farrmx p;t0oee  i3ias s2rmnvp (0trtoircootoa eln ol(0 exoirpiodoptn fcsls s2tmumont1opxnioeildfs2em( s t0 lenir iotomDeluvi s)seuo(opnu4lmt lnvsas aDumxmpno0alx mi3iytfm2rmnvpn(0trenxo3ootop rai o;s)s2urim3iu4ll  lietls)s2umx  ou4tetniietytfa2rmums t)areomo tatoatran il(  2xmirpoo1ope  ics s a2rrx oou1opxnmfetysfmDrl( s;u0trenmrcto1lat  ueo;( trxmio3iodlpt lfvi (f 2tax oou4ale iiciasla2ranmo t) rtnxr3oa1omt  uvol( setmxmpnydoleelnvt t arrm( o;o1alx if3tysls2em( p u4texnir3tydlatran o (0 2xoiopnu1lmen icsl( arraxr nu1aexomfcilsfmDrmn p;t)alxnxfcty1fpDeau ils  ruoim oy1lpt livia( artmxrono0tpto f3ild m2rmums t4aleomr iotomDelnvo;(0s2xoio3iodlptemfcsl(fsrtmuronu1olx ifeiadfa2el(mp;(4 rxrmfcoytlaDrluvi;()trur(mpno4lp e fctatf 2rm(mp;t4tlenmoetatfm ua( onu)tetrmo iotomtelneo;s)truoxm3ny4op n ncta(  rra(  ot4alenmoctld m ulnvs u0texrir iydlp  luvs;t srtoirpoo1al emncias s2rm(mpnt1alto iciasla eanms u0tetoxo ta1lmD li i t)srxmio nodolt mfei (f 2rm(  ou4apxnii3tysfa2ul(mpnu)arxomf totfaD anvolt) rtm(r oydaltnmfet tfsrum(r nt4oeeo ociys m ua(vs t)aleoif totoatr u s;t) 2tmirpnodlle miet tfaruru  ot1optnio3iltlaDul( pnu4trxnio iotoptrlneolt seumim nodap eliet ( sDra(  ou4aetnifeias s2emu pn(0 leoircootfat livs;( sruoirpoy4aptemnvtl(faDurxmpnu1tlt  ietls a2rl(msn(4trxoif3iotfmteanvi;t)s2tm(m nudom nmnct () Dumxmo;t1tpxnmi3tlsfa umnvs t0 ltnmo io1fatelivi t0t2urxr iudap elicslsfs2uaurpoo4apxomo3tytfaDuanmsnu)artrircty1fmt aivs;t)s2umxmpiy4ape lfetl()arumu  nu4altomfeiyt m umu pnt4 eenio3todlmDeln o s trtoxopoudap  lfci ( a2tr(roou4olx if3ias m2um( o t0 ltoxr todlaDe uvils s2toxr3nydlpeelivia(  ruau ont0oee mocildfaDuluvp (0aexnmf3ty1la  auei;s)t2to(r nydamtelnvta(fsrraxr ou1oexnmf3iysfsDul(vs t4 lenxocta1laDraieolt) exrirpio4op elnesas  Duax p;t1texnmf3tytfa2rmn pnu)treoiociodomtr u i t)s2xmxopiy4ol  mivt ( a2ra(mpou4tlx mo3ilt a2uauvpnu)arxrxo3todfpDrlivo;() rxoio3io1lleelfeias)srtaxmpoo1oetnioctld m eanvs ()aetrio3io1lp rauesls0setoir nu1ol nlivs sfa2um(rono0aeto o3ilsfmDran s;t)aetrmf tydoatraneo;s0t2xriopiydlpenmfei ( sDtmxr no0oet mo3tldfsDeanvp;() ltnir iatlmDelueils trurxo3iu1om  liet tfs2ra( pou1tpe iociydfmDuanms t0trtnxr oodfmteanes;( trxm(opoy4olt mfvtatfsDta(r ;t4tptn ieiyd m elu snt)altoxo iatfmD lnei s  2urirpoydlleelfvsat aDumu pou0aee  o3ild mDuluvs u4 leoir ootfmDean il(0srum(o iu1oleelfesatfs2rrxroot0aet  fetydfs2umnmo;(4treoifcoatfpt  nvols0t2tr(m3nu1amtn fcil(f Dumu  ;t0ale iociasls ra(vp;(0aexnio3oy1faD auei;t seumxo oy1lp  liviasf rtauro;t0teeo feiasfm emnmo;t)aeeomf3oa1omDrlnvol( teumio3io4lptemivsat a2ra(rp;o0aee mf3tyd m2rlnvpnt)artnxrciatoaDeauvils t2tmxo iydll  liviasf rtau ont0texoifeiaslsDrmnvsnu)trerio tydlp rli i;t srur(o3nydamte fvtas)sDtrur nu0ale mietlsfm2ulnvon(4tetoxociatfmte n i ()trxo(o nodopenmivsa(fs2rmxm nu0apto i3ildfsDrmuvs u4altnio3iotfm r ivils0t2uoxo nu4lpt mivia(f Dum(  ;t1apx ii3tlsfa2um(mp;u4 lenir3oa1fp  aivs t0srur(mpio1aptnmieta( aDrmumonu4oleomocilt sDum( ont4tleniocoydfp   neol( srxmxopnudol nlncsltfa2uaumonu4opx iiciytfmDeau o (4texomf iytfp elivo () 2ur(r iu4lpenmnvsat)a2rrumpoo1aeen fctas aDranms u4 etoxrcoadlp r uvil( teto(o nu4lm   fvsas) ruaxroot1opeo iciltfa2umnvon(0trtoircoy1lm  luvslt)s2toxmpou1ope lici t) 2tm(  ;t4aee ifetldfm2ulu s;u0 lxrxrcoatlate uvi s0t2xmxm iu4omenlnctlt)srtmurpou4tlx mfeiasfm uauvo;(4 etrmrciadlm elu ol()t2um(mpoo4amee fvsa() 2rmu ooo0apx mo3ild aDel(vo;t0teeoxfctotop  lueil(0t2xm(rpiy1ap nmict ( s2raurp;u0texoio3tls s ulnmp;()arenxocta1optrlivo (  2tmio3io1op nliei s) 2rr(rpno0oexo o3ilt m2ulu o (0 rtoxr3oatlaDe ieo;t  2ur(o ou4lm emnesls)srrrurp;o4olxomocilslaDea( p;u0 rxnxrcoa1fp e n o ()trumir oodap elieta()srtaxm ;o4olt miciadlm uanvo;u0 rtnio iy1lmtrli s t0 rto(r3no4oltelietl(f rrmxrooo0tpxo f3tytlm uaumsnu4 etoxo3oadfate neo;t t2trxm3iy1altn ieslt) 2rr(mont0apt ifeilslaDeanms;()trenxrcty1fp r n ils0s2urxo3no4llt mfes s) rrm( pno0alxoioeils mDeauvs;t4 reoxf oy1fa rlieols0s2urim3iydal  lfctas) ruaum no1oetnmf3iadls2elnmpnt4 rtrmociatlpDrliei t t2xo(r ou1lme lnvil()s2raur no1oltoifcild mDra(vont) exoxr3oodlptraneolt)teuo(mpnodole lics (farrru pot1ale ifetys a2uluvpn()tetnmocoo1fmDe neils0srtoxo iy1ol nmict (faDurx  nu4aexn octyd m2uaumonu)arxomr tydomtrlu i;s)t2urxo3iu4aptnmfvtls  Dtau p;t4opxnif3ilt a ulnmonu)alxomf iotlmDr u s;t) etrxmpiydop  mnes s) Dta(m ot4openifciadfm eanmo u)aeeoxocoy1oaDelies;t)sexmxm3iydomee fvtat) Drmu  ot0opxoii3iydla elnmpnu4altrifciydlpt livo;(0t2toxr3io4amt lietlt)s2rmu  nt1texo oeiasls2em(vs (4altomrcio1om e neo (0 exm(m oudlle lnet s  Drax  no4olen ociyd m emuvpnu)tltoio oodlm eaiei (0srxm(rpiudal nlnviasfs2tmuroou0oexoio3iatla ulumo t0treriociadoa eai ils) etrxm oo1lm  lfcsl(faDta(rp;t1opxnmf3tadla rmums t4tetnmo tatlat  nvolt teto(mpio4llee fcil(  2tr(r ;u0aptn ocildfs2um(vo;t)texoxr ta1optr n sls) rurxm oodal nlivslt) Durx  ou4teeoioctas m rlumont4aetrmo oydomt lues;t)tetoio oo1ap nmnvs (fa2trumo;o4tltn feiatfm emn o u)texnir oadfa r u o t) rxrio nudomtelivtat)sDuaurp;t0olen f3tlt m rln on(4 ltoioctotlaD anvils0s2tm(m3io1al e fei t)srrmurp;o4apxn f3iatfs2raump t4 renxr3ootom e ivi ()srurim3ou4lltnmiesl(f Drrxmpnt1opxnmieiydlaDel(mp;u) leoxf ty1omte uvil() 2uo(opiu1llt lnci ( s2umxrpnu0olx miciys m2ul(vs (0 exriocoatom raivs ()seuo(r oy4optemicsat)aDtaumo;t1opeomieiaslm umnmpnt0alxomr oatfaDeli i s t2umiopnydomee ics s) rumxm oo1teto i3iydla2rmnvont0 lenmrcta1op r u o;(0seuoxrpno4al n fcsas)sDrmx oot4texnii3tyt mDea(msnu0tltnxo3tydlptrauvols) rum(o3ou1openmicils sDtmx pno0aeeomociysfmDeluvsnu4aexnxociadfaDr nvo s0 2um(mpnu4al n ietls sDrmurp;t0alto icils m2emuvp;(0 reoio ia1lp  aueo;( sruoxo3oo4al  mict t aDumur ;o4tltnmfeild m rmnmp;u0trtnif oydfatrauvo;( tetoxmpou1ameemfcsas  Dur(m ;u1alxnmieildla um( p;u) ltomf3oydlaDrlu sls s2trio nu4omen icsls) 2ua(m nu1oexnmfetytfm um(mp t0aexnmocoa1fpteluei;() exoxr3iy1alt  feslsf Drrxmp;t4aetoifeiysfm el( o u4tlxomr oydfp eliei;t0 euoirpno1ll  mici sfsDtmxm nu1tee  octls s2emuvs (0trtriociytlpt aivi;t0t2xoxm oodom  mfctl(f Draum no1tpenmfcils a2em( p t0 lenir3oatlm r ies () exmirpiudome lnviat)aDua( pno0texoii3tysla2eaums;u0 rxoir3tytlmD aueo;s)t2xoim3nu4lmtn fvi s)aDtru pnu4olx mieiatlm2ul(vp;u4altnmocio1fpte nvil()trxmxrpiudol nmnvi s  Drrxmpot4tetomfeiytfa2rmu p;t0 eeomfcoa1opD lieo ()teuo(o oy1opte nvt s)s2rm(r ot0texo oeiysfa2rlu o;u4aexrmo oodfpD auvo t  rxoio nydaltemiei t)s2umxr ot4aptoio3iat a elumpnt) lxrmfciadoa ean i;s)t2toxo3iy1omen fctls) Dtrurp;o1tex  fetytfm emuvo;t4treoxfcoatla  anvils trur(o3ny4lmt  fvt tf Dtm(m ot4optnmoeild mDel(vp u4aeerio ootlm e i olt0sexoio oudoltnlivil()s2uax pnt1oetniiciatfa2ea(mo;(0 eenmfciydom e i s t setr(r no4oltemfcs t)arraxm ot0teeo oetlsfsDumu s ()aetoio iatlpteauvs s0t2toxo3oydomt mivtls s2ta(m ;t1altoiietys s2emnmpnu0treoir3ia1lp  auvi;s)texmir3nu1aptelfci t  rtauronu1opt moeiltlmDrm( on(4 rerir iotfat  nei (0 exoxo io1opeelfvtlt) 2taxront4tpenmociadlaDuauvo t4artoxo iy1oatraueol()s2xrxm3iudlme licsatfsDrr(mpou1teeo o3iysls2emu pnu4texoio3totfmt li ols  2tmxr3no1amtn neiasfa2rmumpnu1tet mieiatlmDea( o () reoxf3iodlmtr neo ( srxmim3oydom nlncsat) Drrurpou0tet iiciadfa ul( o;t0 etoif3oytlmt  nvil( t2urxopiy4oltn ics sfsrur(rpnt4tetnmfcild mDumnvs ()aeeomr3oodfmD an s s  2xr(r no4opt lieil(f Durxr ;t1tltnmieiyt a rm(vp;t4 exomo3oodoa e uvi;s sruoxm nu1lpeelivtlsf 2tr(mp;u4tlx ifcilsls uan p u)tlenxr3iodlm elueolt0seum(rpoy4aleemfvs (f rrrumpno4apxomfeiaslmDemu s;t0aeenxr iotlate u s;( texrim oo4ol  lnesat sDururp;u1tpx iietadls2umuvon()aetnxocio1omt livo ()t2to(o3oydom nlnctltf 2umxmoot4apx mociatlm em(mp t)arxnio3iotfmtran olt0t2toir iudomte fvi ( sDurxr ;t0apxo fetldls2uau s t4arxnxfcoatlaDr neils0 2trxmpnu4ll  mnesl( artaum ;o0oex miciaslm rl( s u4altoxrciydfm   neo t0trumxrpou4am e fcs (fs2rrur no0ope  ocilslaDumuvsnu0 etoirciytfm e u o t)trtmiopiu1lpe  nci s  2uaxrooo4tlx mo3tysls ua( p t4altrirctatoa e ivi;s0trtoxopio4lmenmivia(fartmxr nu1tlenmfctadfaDelu p;u4altnmocootfmtrlu s;( s2xrxm3ny4lpe  fcsatfsDumu onu0apxoioeildla2uaumonu4tleomr to1fpD aivs;s trtm(rpiydomenlncs ()sDumxr ot4tptn ociatlsDulnmp;u0 rtoio oydoa eln i;t srto(r ou1alen ivtatfs2rr(root1aetn ociltfm2rmums;u) renxfciadoat aueils0 rxo(m3ny4optnlics sfarrax  ou0teenif3ilt a rl(mo (4tlxomf3to1lm r ieo (0trtoxm3oy4opt lfci t s2taumoot0aex  ieiad aDuanvo;(0aeerxfciydlaDe n il( sexo(mpoo1oltelfvs tf Dtrxr nu0texomfctltfaDuauvon(0trenxf tydfmt lu i;t)t2toxo oydlme  fct ( arur(m nu1apxnii3iasfsDem(von(4aexoio3oadla eauei s srxm(m3io1lp  lnctas)srur(rooo4aleo o3tyt s uanmp u0aexnxf3oydoa e iei ()trxo(o io4ameelncs (f rurumono0alenmietlslm um(mpn(0aeenif3tydfaDrauvsl( setrir oudomtnlneta(faDtr(ro;u4tptnmfeiys mDrmnmo (0 eenmr ty1fptelivo () rtoio3nu1ap emfesa(  Dra( ont1oexniiciasls rmn p ()trxnxrciodfptraivo;t t2xm(mpiodaltnliesat sDtaxronu4tlenmfeiys sDraumsnt)artnxfciatfp  aiesl(  exm(m3iy4llt  net tf rtrx  ou0optn fciatlsDrl( o;u4tetnxf3tydlaD anvs s0srtr(opnudll e fvta( a2ur( onu0altoiieiad s elnvp t4tetoxrciy1oa r nvi;s)s2ur(rpiy4ll  lncta(fsrtr(rono1aexn oeiytfmDem(vo;(4altrmr3ia1omDraieo;s teurirpiydapen ieiat a2umx onu4tlenmietlsfs umu sn(0areoxo tadfptrlnvo;()texo(r3oy1om nlnes (f 2raxm nu0aptomfetyt s2uauvo u)alenxf ty1fmDrlues (0sexoir io1lp n nvsl( srra(r oo0aeeniieiysfa2ra(vsnu0tltoxfcoatlm elivo;t) rurirpnydape lncsa( aDtm( pou1aee iiciat sDelumpnt)aeerirctodomD  i s s trxm(o no1al  lfei t srurum ot1optomfeiytlsDrmnvpnt4aeenxrcta1opDrlieo t0t2umimpnodlpte nesas) 2rmum ;u0tlx ii3iat aDumu p;t0arxoxf3oy1fp   uvol(  euoxm no4am  micils s2trurpou4oexomf3iadfaDelnvo;u4 exrxf tydlmDrlneslt0trumio3oodop  mncslt)a2rau o;t1tlto ocils s2rl(mp t0aetrxfctydoatrau i;s  rum(m nodll  mnvslt)arrau p;u0tlen o3tadfa rmumo (4arenmf ia1fptelu ils)teur(rpnodaptnlivs (fsDuaurpnt4aetn i3iat m2um(vs (0aetomrciotomt au s s)setmir iy1ol n ivs tfa2ur(m ;u0oeenmo3iatfm rl( pn(0areomfcoatlp r ivs s0seurim3io1lptemicsl()sDumum ot1oet if3tat mDulumpnu) rtriocootlp ran o;(  exr(m3iy4olte fvsat sDta(m ;o1tpx iiciatfm emnvp (0alxoioctytoa eluvs () 2to(o nu4openlnvil()sDur( onu4olt ioctlt mDul( s t0 eerio3ia1faDrai i;()s2xo(r3ou4amtnmfvt sfa2rm(root0openiieiyd s2ean p;t)alxnxr3iy1lm rlnvils  etmim iodaptn ivtas)a2tr(  oo0ale  fcildfs umums u0areoxrcia1opt auei (0s2tmio3no4al   nctas) Drm(ro;o1ale mi3ilsls ulumpn(0artnmr3todop e u sl() 2um(r oy4ll elnei t)sDrr(moou4tex  feiyd m2eln o;(4 reoirciy1lp  aiei;( srtriopoo1optnlics s s2trxrpno1aeeomfeilt a2um(vo t0aexnio oo1fmteanes;(  exrir oodllte fviat srururpoo1tltomfeias s2rm(ms (4tetnmr oa1fmtrlieo;s0srxmxm3nydlltn nesas  2tmum ;o4olxomieiydfa um(mon(4alxrmo3tadlaD auei t)srxrirpiodal n ncs s s2ra(m nu4oleo i3tydls2eaums;u0teermf todlpt  uvi ( s2urxopny1open fcsas)a2umx oou1tlenmi3iydfm2elnvont4trxrifcoy1fm e ueils)sexmir no4apenmncs (fsDuau ono1olxn ocilsfsDrl(vs t0tlxnmr3iatla  au o (0 2xm(m3nu4altelnvs s)sDraum ot0aeenmociysla2um(mpn(4 rtrxr3tydlateaueo;(  eum(o nu1omeemnes t aDtr(m ;t0opto fetlsfa raumo (0tleomr3iytoptr ies;t sexrir3nudlm nmiciltfa2rm(  ou1oexn i3tydfaDrln o t4altomf ta1fpDrln s s trtmxr oy4lp  mnciltfsDrrxr ;o4tltomfeildlm rlu o t4 ltriociadoaD ai i;t)setm(o oy4al elieiat) 2rr(rp;o4tltn o3tldla rlnvo (4 exnxfciodlm elivs;s  etm(opou4op   neil() rrrx pou1tpto i3tldla2uauvo;() ltomr3iotom  lnvolt trtoxrpno1opeemnvsa()s2umurpou4olen feiltfm emu s;t)artoxociydopt lneo;( texrxopiy4lleelfvia( arrmxr no0apt io3iat a em( p t4 eenio3io1op eli s s)trxm(r io1amenmiviasfsDrrxmpno1ole  ictysfa2ul(ms t4tlerxr ia1opD  ivs t srtoimpio4oleelnctas  rurur no1alx moetadla2rluvs t)arerxo oodoa  li i;(0t2xoxo3iodlpeemnvtat s2rm(mpou4aptoii3iasls2ulumo u4 rtoxociotop ranvo;(0 euo(o oo1am elnesa( srtrx poo0oetoioeiatfa rau o;u4 exnmo3ty1op eauesls)trtrir nodlmee icsatfsrra(rp;t0oex iieias s uanvs;u0alxrmr3ootla eli sls  2xm(r3oy1llte feils s2ra( o;u4apeo fcilsls rluvo u0 exrif iy1fm  livi;t) rxmirpnu4amt  feiat) 2ur(rpno1alt mfcildlsDemnmont4teerxf ty1fpt lu s;t0 2tr(o3ny4lptnmnviat  2uauronu4tpxnmociad m eanvsnu4aetrxr iodlmDelu o;t  exo(m3nu4op   iet s srtau oot1tlenmieilslm2rm( snt0 lxnxr oo1opDran o s0setmxo3nu4llt lieiatf Drrxm ;t4alxniietatfs2ul( s t4alxomr tadlmteai ilt)t2trxr oo1lmee iesas) Drrxm ;u4olt  o3ilsfa2um( on()arerxf3to1fp   neil()s2trimpnodll  lncsl(f Dtr(mpot1alxoiociadlaDum(mo;(0trermfcoy1lp raies t srto(rpoo4am  lies s)a2tmxm no0teenmfciys m2emnmp ()areoxf3io1fa ranvs;(  exm(r3iodlpe  nes (fsDurump;t0alen fctydfs um(vsnu4 etnir3iytla  livs;s)texrio3oodalen nvs s srumx  ou1altnmociatfa raumsn(0texnxrcoy1oa eau sl( s2xoxr oodap n fvi ( arrr( ont0texomociysls2eaumpnu0 rxrxociatomDr u i;t0 rxrxr nudll   ieiat  rrrx  oo0aee iieiyt sDulnvo t4artrmrciydfpte iei t0texrim3iy1apt lncslt)srumx oou1tlt  i3iatfaDuluvsn(0 ltrio3tatomt  neo ()trxm(o3ny1ll   fctltfaDrmu o;o1alt  i3tadla umuvs;()texrif3ta1lpDr iei t0trxoxr3ny1lmte fcsl(faruaur ot0olenioctldfmDel(ms t0alenifcoatlpte n s ( trumxo3iudalenmfct (fsDraumo;t1opxomi3ildla2ranvsnt0tetnio totfptrluvols0trur(rpoy1altn nctlt  rumur ;u0tltomf3ils s2rluvs;()trenxf3iytom rlnvi;t t2uoio3no4alt lnes s  rrr(mpoo0alxomicilsfmDrmnvs;(0tlxrxociadoptr neilt t2trimpoudaltnlicsa( s2tm(mpoo1opx mi3ildfsDua(vonu0 lenir iodfpt aieol( teuoir iy4lmee fcsasfsDtrxmpnt1aexomfeiatlsDranvpnt0alenir3tydfaDrlu s (  rurxmpoy4omt lnes t  2umxroot0aetoio3iytlmDrmnmo (4 lxoir oatlpD li s;s)t2uoirpiu1aptnmfei t s2rm(  ou0oexoifeiydlmDulump u) ltriocoydlmt an il(0srto(r no4llt mncsl( arrmu  ou4ole  fetltfsDul(von(0trxrmo tatomtrauvols  2uoiopio1apt mnet (f rtm(m ;t0alto oetatlsDea(mo;u4 rtnmf3to1laDraueo s)texoxm3nu1olenlfvi ()sDraumo;t0oet io3tlt aDuauvonu0texrif io1la  livs t) 2xr(mpnodalee fvi tfa2rm(m ;u4oexo iciydfs rm(vo u) ltnmf tydfaDeluvsls) 2xrxmpny1optnmicil()a2umumpoo0teeo fctat s2rm(vpn(4 eenxrciadfpt  ues s)s2uoxr io1am nmnci (faDtmxrpnt1opx  o3iatfa2rl(vo;u0teermrciodoa  livs (  2trio3nu1apte icsat)s2rrur ot4alt mfciydlm emn p u0 exoxr3iy1opte ieils)srxrxopoo1omtemietls)srtrum oo1texoii3iys m ea( s;t0 lxrio3tytlpDeaieol( trxo(mpnydap e fvils)a2uaxroot1oex iiciydls um(vo;t)tltomr to1lateluei s0 exoim3ou1omen fctl(fartmu pnt4tlxoio3ild a el( snt)teermr totlpteln ils0 rurir3nu1amee ict (  rrrxrp;u0altoiietytls uaump;t0artnmrciadlaDr ieo t)tetm(m iudape lnct s) 2umumpno0aetomoctyd a uln p;t0tlenif3iy1lp  lneo;s)t2urxo oy1open ivias arumum ;t1ape ioeiltfmDrmumpnt)teerio3totlpDraivs;() 2toir3oy4oltn ncs t)aDum(mo;u4tet ii3iadls ra(mp (4altnmf iadla   u slt  2umxr iodom   iei tfarrmxmonu0aptnioetls sDul( p u)tlerircoodlpt lnei t)srxm(rpio1llt licsltfa2um( p;t0texnifctas sDelu o;u0alerio3todlmDeanes s)t2xoxr iu4lp elnesat arraxmonu0apen ieilslsDumnvo t4tleoio iodlaDr nvs (0teumim oy4omte fcs (fartmum nu0apxn f3ils aDrl(vp;t)alerio3ootlpDeluvi;t0 eur(rpiodlmeemfetat  Drm(r nt1oeen f3iat s2rl(mont)trerxo3todfmteanvil()srxm(r oydlltn nviasfs2urxrpnu0oet mf3tatla2um(mo (4 exrmf oa1lmDeanvilt) 2xrir oy1al emfctatfsruaxmpnu1tpxn feiydfs2ran o;u4trtrxo3tadlpt an i ()seuoxr iydol nmfct (f Drmumpou0opxn o3tldfa2rm(vp t4trenif3oo1fpDraneolt0 rxrxrpno1lp nliciatf rrrumoou0oex moctat mDelumo;t)tltrxfctydopD an il(0 2toxopny1amte icsa(fsDtru oou1opxomfciyslsDrmnmpnu0aleoxo3tatla rlnvsls0setoxopiodome mfct tfs2tmx ooo4tltoii3ilsfm2rl(vp u) exrir oatfmDeln s () exmxm oo1ll e fctas s2rrxrp;o1opt  ocilsfaDra(vs ()trermr to1latrliei s0texrxr3nodap  mictasfsrurxmooo0aleoii3iadls2ea( p u0texnifcoatlm eliesls0teurxr io4llen net t) 2uru oot0olt  i3iasfa2ea( o;(4artoiocoydfat lieol()trumim oy4op   ics () Dra(  nt1tetoifcildls emuvp;t0tlxoif oy1oa rluvsl(0sruoxm oy4ol   fvsls a2taxmo;o4opeoifeiyt m emuvo;u4trtnxo iotomDr neilt0 2xrirpnydame  nvtl(faDrau onu1tptnmfetltls uln s t)trxnxfciodop  li slt0 2tm(o3iu1lmtnlfviasf 2uru poo0tpenii3ildls elu ont4teermo oodfate u o s)srtmxo3oy4ap elivtat) Drrx  nu1apxn f3iydfs ua(vpnu4 rtrmr3oa1lmDe u i s0 rto(rpiodoltnlnvil( s2tr(mp;u0tpeomo3iadfmDeauvs t4aeerxociotlaDeau ol()s2uoir ny1alen fcsl(f Dta(r oo4tex if3tydfm2rlu s;(0 lxomfcoatfate nvil(0seuoir nodolenmfcsas)a2taxrono0tpt  f3ils aDrmn p;() lxnxf3oatfm rauvs ()sexr(m oo1omenmnviasf rtm(  nt1altnmoeiad s2umump u)teenifcia1laDrai i;t) rxmxo oydlpt lnesl()s2rax oou4tpxn fetyslmDrmuvs;u0tlerio oadlatr ueol(  2tmim iydom elncsasfsDrrxr ;t0oetoiieilslm eanms u0 eeriociatla  livi ( texoir iu4ol elneil(  Dtr( o;t0altnmoeildfa2el( snu0 rxoio3oa1fp r nvils0truoiopny1altelncil(f rum(m nt1tpeomoeilslsDrl( p t) lxnxocia1op   nvo;t0 2toxrpiodap  mfei (farur(  ot1olenmociltla2ranms ()altoifciotopte iei;(0seumxmpnydop n nctlt) 2uru ono0tlxomieiadla2ua(mpnt)tltomoctatfateaivs;s0sruoir nu1ap  lnctatfartm(r nu1oexoii3iyt mDul(vo t0 lxoxf3oa1oa elivs t0setrxmpnydop  mivs s arumx  no1alen o3ilsfa ranmp ()aeermrciatlpDr i s;t)texmxrpny4al e nesls a2urxr ;o0apeomicilsfm um( p;t4 reoio oa1fpDe n i () 2xmimpnodll nmfvs t)srra(ronu4apxnmi3iasla2ean o t0altnir oydfp  anes;t0srum(r ny1ale miviat) Dtmxr ;u4oet mfciysfm2ul(ms;(4trxoirciatlpte ues (  rxoim3oy1om  lfcia() 2umu  ;u4oex  fetatla2ul(vsnu4aeenio ia1lpDraieo t0 rum(o io1lptn nvtas) Duaur nu0oeen ociat aDea( snt4tltomrctydfmtran il(0t2tmim3no1llenlfvi sf rta( onu0oetomiciltfsDea(vp u4 renxo tatlpD lneo;t0 ruoio3oo1al  mict t) 2rr(mo;u4opeoiictasfs2eanmp t)aetomr iydfaD lieo s)trtmxo iu1oltnlnctat)arrr(rp;t1tlxomiciatfa2uan s (4arxomr tydopD  nes s)texo(r no4om nlfvt (f rumxrpoo0aptomfeiytfs2emumo u0 eeoir tydlp rlnei;()t2uo(rpiy4al   feslsf 2tmxrpot4apxo ietaslm2eanms u0 exrxf3oy1fat aivs;()srurxr ny4aptnmneia( s2uaumono0oeenmoeils mDemu snt4 etnxfctydopt auvi s  rtm(o3oo4aptemicsltfs2taur nu4aexoii3iltls2ulumpnt0texrmrcoo1latelneo ()srurxrpoy1aptelfvi sfa2uaxm nt4optomfeiadfm rmnvs;(4artrxrcty1oat luei s0 rto(r nydlp nmivt ()srrr(r ;u0texo ietatfa2rlnms u)aexnxr3oodop rlu s;()s2tr(o oy1ll nlfvilt srrr( ont1oee mfciydfaDumnvp;u4 etrxr totfa eai i s0 ruoio3oo1ol  mfvsasf 2raumooo4tetnmietldlm em(mp;u)aexrxr3iydfmD ln i;() 2um(o oo4omt lnes t)srumu pnt4aexo f3iytfa uan on()tetoiociatfmt lueols) 2tm(mpoy1lmtemfvsls) 2rm( p;u4tet  oeiatfa2um( p;u)aeenir3ootomt  nvil()t2tm(r3io1alenlneia()a2tr(r nu1tlxnif3iyd mDemump ()tlermfctatop elivil( srxo(mpiudomeemneia(fsDur(ro;t4optnii3iyt s2ra(mpn(0aetnxo3iytopteai i;t0 rtm(m ny1apt lnvsa()aruax ono1aexoifcild sDelump (4aeeoir todla   ues;t0srumir no4om   ivilsfa2umxr oo4oeenmiciadls2ea(vont0tltrio3tytlmtr u o;(0 2tmio3nu4apenlnetlt)aruaxmo;o1apxoiiciatfaDran p;u)tlxrir3ootfmDrau i;s teumirpou4al  lfctlt aDum( oot0alxomieiys sDeanmon(0aexrif3ootfat  ivols0srxo(r ny1apenlnvta(fsrta(  ;t0tle ifcilt m rl(vp;u0aeermfctydlmte uvi t trxoxr3iudop  lfesas aDtmu ooo0tptnmoetadfa2ea( o;() rerifcoytfa e ivs t) eumim iy4op emivils)sDtm( oot1aee  fetltfmDra( pn(0 exrxo3oydomtr i o;( trtrir3iu4lme lfesls)a2tm( pnt0apxoifciysfm emnvon() lxrmo oytoa raueslt)srtrxmpoo1oltemietl(  rraxmoou0altnmocild mDelumo t0arenir iatlmD  i slt) 2tr(m iodolte fcs ( sDtmu oou0aexn iciyslaDrm(vo t)teenmr ootom e nei t) rxoxopio4lltn ncsas aDumu  ;t1tltoifeiatfaDrmuvp u4 rerif iotfp  aneo;t0t2tmim no1ll nlnei sf rua( pot0aleomf3tydfm2ua( pn(0 ltrirctadfp r nvs t seumxo io1lme  neia( aruau  no4aexn ociytfs2rl( pnu)aexomo3oydfmD  nes t trtrxopio4amt lfesas)srrmur ou1oltnmfeilt s2eanmp t)trxnmo iytoatr nvil( srum(r3no1lme livilsfa2taur nu1tlxnmietysla2uanvpnt) rxrmr todfpt  nes s0t2trxmpnodlltn neia() Dumu poo4alx  oetytfs raumpnu0 ltoxf tatlptr uei t0 2urxm ny1al e nvtat a2trxr nt4alt mi3tys s2rmuvon(4alxomr oo1lp   ueslt0 exmir3ou4ome  nvt t a2rmx pnt4tet  o3iatla uln s () leoiociodlaD aies;(  rto(opnodlpt licils) Dta(  ;u1alxnmi3tydfm uaumo;(0 leoio ia1fmtrlu i t trto(mpou1lmtemnei tfsDrru  nt1tetnmictasfmDeluvs;() ltrxrcty1oa elnvs s0 etmio ny4lme mieslt srrm(  no1teen feiydlm ulnmpnu4 eenxr oydfpD lnvsl( srtr(rpoy4ap e neil()srrr(mp;u1ale mfctad sDum(vo t0teeoio3ootoa  anvi;t)trxoxmpiu1ap emnetls) Drmumoou4alxnmfctytfa emu s (0tetrircoy1fmDeaueol(0t2tr(o3io1ol  mfcs (f 2umxm ot0oexo fctltfa2rlnvp;u4aetrio iotlpDraivs t0 2ur(rpoo1lmt lnvta() rta(m no4tlt iictys mDuanmp u0teenir oo1op r u sl()s2xmir3iy1ol   nei sfa2tmxmoot1tpxnifcildfm2rlu s;t4tltrxocoa1lmte nvi;t  rxo(m io4lleelfeil(f rra(mpnt4aexo o3iydls ul(mo u0 rtrif oatlpD anes s)s2xrio nu4amt  fci ( s2rmxront4teenmieiys m2uau s u0trenxf3iytoaD  uvi (0t2trxo io4om nmfeiltfaDrmx pnt4teeomoeiaslm ranvo;u) ltrif3iy1lm rauvi ( trxoir nu1optemieiltfaDrmxmoot0tpenif3iasls2ran s;t4 lenio tydomte ieolt t2tmio ny4lm n ivtlt  Duaxr no0oetn o3iadlm2rmnmsnt0 ltoioctytopt lueo t0 2xoir iy4ol elfcsas s2rrxr ou4opeomociytfaDel(vs (4 lxnxf3oadfpDeaivs t0s2urir3iu1ole mneilsfsrtr( oou4tpe  o3iyd m2rm(vo;t4aexnxr3ia1om rlieo ()s2xoir3nu1al e fvtasf 2trxm nt0alxnmietltlaDrm(vs u0tlxrxr tytlp eluvol(0sexmim io4lmte nct sfsrra( p;u1tpxomfeiydfaDrm(ms u0 eerif3iadoatr nvs t)srxo(r iudlpe lfesl()srum(m nu4tpxnifeiyt sDul(vsn(4trxomrctatfm rln il(0t2toxo3no4op nmnesl(fsrtax  ot0tlt ioctadfa rm(vo;()trtoxf iotfmDrlivs t seumimpoy4am  mfes s  rtmxrpnu4tpxomfctyt a2rmump u)arenir oadfmD anvs;(0tetmxo3nu4ope mfvi s  Dtr( onu1oltnmo3iatls rm(vont4alxnxocto1lmt auvo;()srxoim iy4lptnlivtl()aDuaumoou4opt mi3ildla ranmp;u)alerircoy1la eai o ()trxr(opiy4ll nlivtas) 2rau pot1aptomfetadfm2rauvp;u4aexrio3totopt lu i;t  exrio nu1omte nciat a2rax pot4oltn oetld mDuln o;(4tltoxo iodfp eanes ()t2um(o3no4lm nlncils artr(  ou4aexniociytfa2ul(mo t0tlenioctydoa e uvi;t0s2to(r3oy1amenmicsat) Drm(r ;o0apxoif3iyslaDumnms;u)aeenxrcoo1fpDe n o t srtrim3no4altnlnvsat) Dtmu oot1tee mfeiat aDrmnmo t4tlxnir iodoatrluvolt0 rxoxo3ny4am  lfcsa(f rra(m nt4oexn i3tyslm el(vpnt4trenio tadoaDelivsl() rxrio ny1lltemfvtls)artr( onu0tptniieiad mDelnms (0texnxf ia1fmte n o () etrxr3ny1al   ivslt srum(rooo4ape io3tldfa emuvs t0aexnmrciatomteli sls  rtrxopoy4olt lfci (  Dra(rono0tpeo iciydlmDum( s t4trtrmf todfatelueols)teurxr iu1omtnmfvi t)s2rr(m nu1tex io3ils a2ulnvont0tlenif oodlmDelnvo t0t2xoio3iu4altn nviatfs2rruroot4tetnmfeiydfaDea(vsnt0texnir3oadlm rlivs (0 rur(o3oudlm nlnct t arrrurpou0texnii3iyd s2ua( sn()arerxo3tydlatrlivilt t2xmxm iodlpe  nvsa()sDrmurpoo0opx  i3tltla rluvs t) ltrxfcoadlaDr nvils t2urxm3oo4op nlnvsasfaDra(ro;t0tltn i3tasfsDrau p t) rtnxr3ta1lat  n o;s)trxmir3iu4apte fesas)sDumur ;o1tet iicild s2rm(ms;()aetoif iydomD ln o;s)tetrio nu1om nlfvilsfsrrmu o;u1ope mi3tld s um(mp u4teenxr io1opDe u i;t)sexoirpiydol elfciltfartrxr no4oleoiiciasfs2rl(vs (0arxnifcia1oa  ln i t) ruoir3io4op emnvi s sDumx ont1altn feiyd sDrl(vs;(4areoif3iytlpDe nesl()truo(r iy1apen feils  Dtaxm ou0oleo o3tltfs rl(vs u4areomf oytfmt  ies;s) rto(mpiudlmtelfvtlsfsDrrxm ou0tlxnifciadlmDumu s;t4arxnif3oo1lp  lueol(0trtm(o3oo1apee fetas)a2tr(rpnt4aexoifctlslm2rl(vo u0tltrio oy1lp raueils srurxr3oy1lm   ics sf 2ururpno4tptomfetlslaDra(vont4 reoxo ia1fptelnvsl(0 2uo(o3iu4opt mnvt sf Draxm ot1oetoifetydlmDrmn p t)alenif to1lm  an s;(  rtrxm iudlp elneiltfs2rmx pnt4teenmo3iyd m um(mpnt)trxrxrcoadoaDr ues ()t2ur(rpiodomeelfei (  rraxmp;o1tpxo ieildfaDem(ms;u)trxnif totopD  i il(0 exmim3oy4ame licta()artm(m nu1tpeo i3iytfs2uau on()artnmr tytlpD ln ol()trxmxo3iodlmtnlics t)sruaurono1tetnmo3tlsfm2um( p;(4alxomfcto1opDrluvils  rxmxr nu1lme  icsa()sruauro;o4ope ii3iysla ua(vont4trtnmrcta1fp  lneo ()setr(opiy4lpeemivils)s2trxmpoo1alxnmo3iyt s2uau p u) rxnir tadopD  ues;s tetoir io1lp emies s) Durxrpot1tetomieilt s emuvs t)tlenxr iodom  lnvo t)setrir nodlpenmfcs ( artmu pnu1tptoiictydfm2rmnms (4areniocty1lpDe uesls seumxrpiu1lmenmivtas)srrax ont1tpxomieiat mDuluvo t4texomo io1fmD luesls0 etmio3nudaptelfei (fa2taxrpno4olx micilsfs raumpn(0alerif oatopDrlueo ( trxmio3oydllenmicsat)srua( o;o4tlxn o3ildla ran snu4 lxoxrciydfm   ivo (0teuoxm no1oltnmiviat) 2rmu pnu1aetoiieildlm ea( ont0 leomo3oodopt lues;(0srxriopnydlp emics (fsrrmum ;t0aleo oeiasfsDem(vs;(0alxnxfcoytopD  u ol()srur(m oy4lmt mieta( arurxmpou4tlenmo3iydfm2rlnmo t0trtnmr totlatelu slt0setmxo io1ope mfciatfa2rmxrp;o0tlx  ietys mDulu s (4tlxrmf iodfmt lnvsls)tetmxr nodol  lietatf Draur oo0ape ii3iys sDua(vpnu)tlenmr tadop elnes;s)trumxo3iu1opt  fesat  2tr( pnu0tpxniietld a2rmnvo (4 rtrmf totfa  ai olt0 rurxm ou1llt  nvt t  2trurp;t0tltomf3tyt a eluvs;u) rtnxo oydfaDeaneslt) etr(mpiy4llt  ieias)a2rrx  nu1tlx  ietatfs2emuvs;t)artoxr3tytfptr iei;s0 etmirpnu4ame lfciat srrr( oot1oleomfctltfmDrm( pn() reomf iy1lpt  ivs;s tetmim3io4altelfvil(faruaxrp;u0tptnmo3tld s rl(vonu4tltoio3oytoat ai olt  ruo(rpoodam nliei t) Dtru poo0oetnmiciad m2em(vs;(0 lerxf3iytfm rlnes () etmir3iu4amte ictas sDrrxr ot0tltn iciyt sDulu o (0altrmocoadfa elnes;t0trumio3nudaltn ieslt  2taxm no1alenmieiadlmDeln pn()alxnxfciatoatrlneil( t2xrxrpou4lp nlfcil(f 2raum ;u4olto oeiltfa elu onu0teeomrcoadlpDraivo;t  exmxr3no1lp emnciat)srraumo;u4texoifciasls ranmpn(0alxoiociodfmte i o (0 exoirpou1lleelnet s  Drax ooo4aeen o3tasfm em(mo t)tetrio3tytoatrluvo;t0 2urxm nodapenmieilt s2taxmo;t4tpeoiiciadla ulnmo t0artrmr3iadfa raiei ()sexoxrpnu1optnlnetl(f 2ra(mooo0opx  ieias s rl(vp;u4 etnxoctotomDrln o;s teur(r3iy4ll eliesat)artru  ou0tpen i3iyt sDumnvont4arenxo3ta1lptean o;t seum(o iy1ll nmnesas s2rax pnt4optnifetyd m ul( o;(0 eenmrcta1oa eln s t0trtoxm3iodomenlnvs ()arrm( o;o1tlto ieiydlm ranvonu4aetnxo3iadlaDeaieo;t)trxoio3io4ap emnvtas s2uaxmooo4olxnmfcildlm2el( p t0 rtoxr3ty1fm  an i;s)t2xrxr3ou1al  mnctas)a2tm( o;o4ape if3iat m ean o;t) eeoif todfaD luvsl()t2xoxmpoy4ll nlfvsatfs2um(m ;t1optnmf3iatla rln pn(4tlerirciytfmt aueslt)t2tmxmpnydal   fcsas arrax o;t0apeomo3iys s ran snu0 eeomr oytoat lues;s)t2xmirpiodlmeelicsl()sDua(r no4tpt mf3tydls umu s;(4trenmo iytfptr uvo;() exr(mpiodoptnlfetl( sDtaxm ;o0aptoiociytfm2uanvp () rerxfctatlaDeaivolt0setm(mpnu4lleemivtl(faDrr(r ;o0tet iieiatlm ra(vo;t)aeeriocty1opDe nesls trtm(r3no1omtnmicsl(  Durx pou1tlxomi3ilsfmDua(vs;u4tltrxoctytfaDelues t0srur(m3iodamtnmncs (fs2tmx  ;o0alen i3iltls ulnms (0tetrxfcootlp rli s;t0setr(o iy4ope mics t  2rrx o;t1apxnmociasfm rlumont)tlxnxrcoa1lmt ln i;t0s2tm(rpnodlm elfcs s) rrau o;o1oetn fctlt aDuauvonu)trerio3io1lpD aivo;() rto(o ou4llenmivilsf Dtaxmooo1opxnmoeiytlm umn p;u0texrmfcoodfm e ivs () exm(mpiudlme mivsatf Dtru  oo4aetomf3ilt s uanmo (4alxnmr3totlmDr ivsls0s2xmxrpou4aptn neil()aDtaumoot1oeenifeild s2rluvsn(0trerif oytfmt ai i;(  etoxopoo4lmtemict tfa2um(mp;o4oeeoii3iltfsDeanmp;(4arxnmfctytoaD  ivi s  2tm(o3ny1llee fviat)aDtauro;o0tex miciydls2rl(mo u)aexnxf3oatlpD luvo t0s2to(mpiu1ame liesls) rtr(  ;t1oltnioeiltla ean snu4arermfciy1fmD  neilt0sexoxm nu4alt lnet sfsrua(r ;o0alx io3iyslm2ra( o;u0 rtrir oatlmDe neslt  rxmimpou1oltelfvsl(f 2tm(r nu0opx mo3iydfaDrlnvs;t4 rtomociotopD  nes t0trxmxmpiu1lp emnesas  ruaxro;t1olt miciys a2rauvpnt4aexoxr3ta1fa elueo t)trum(mpou1op emiet tfs2rmu o;o4ole ifetlt mDem(vo;t)aexomfcoadopt  nvi;( s2tmimpoy4lm  lfeia( aruaur nt1opxo oetlsla umuvo (4 etnif3ia1fmt an i (0 eto(m3oodom nmfcsasfsrrm(rpnu4oexnioetys aDuanmp t4texomo3iydlm   u o t0s2trxopio4lp nmfci tf Drm( p;o0aexn octld s uauvp;()texoxo oa1lmDrlnei s0 exo(r oy1ap e fvtl(f rur(m nt0oeeoiociltfa ranmsnu0 exrxo3iytoaD luesls) rxriopio1ll nmfvs t  2raumo;t4alt ifcils a2ul(mpn()trerxr3ootlm   nesl(0s2urxr iydlm  lics (fsrurxroot1aexnmiciat mDrm(vsn(4 rtomf tytla   iei t s2uoxr iy4lmtnmnetlt  Dtaxr ;o1oltnii3tlsfaDrl(mpnu)artrif3oa1faD li i s0t2uo(o oo4omtnmfeslsfsrrmx o;o1opxnmfctydlsDrl(mpnt0 exnxr3iytlmte i o (  rxo(r3iu4al nlivtl(f rrmx  no4opeo o3iysfm ul( o;t)alenxfcoadfmtran o (0sexr(r nodolte nes s)sDtax ono4tpxn fetls a2ulnvsnt0 lxoxrciy1la rlueilt)trxrio nudlm   neiasfsrra(mpou0oltn ocilsfs rm(mp t0areoio to1oatraiesls0tetmirpoo1lmeelncslsfarrrur no0teeo fcild a ua(mp (0 eerxo3oy1oat au o t)s2xmxrpiu1ope lnviat  rur(mpnu1oexn fetyd mDulu p;u0aleoir3to1fa  lueo;( trxo(rpiu1op emfct ()a2rrum ;u0aptomiciytlmDum(mp (4 lenmf3ootlpte neol(0s2xo(o3oo1lp nlfviat a2uau pot0oeto fciatla2umumo u0aexnmf3oytom r n ols seur(mpou4omt lics tfsrrm( ono4tpenmoetytfa rm( s (4 ltrir3ia1lm eauvi s0texrirpnydop e nvtat  rrrxr ou4olto ieilslaDrln pnu)tltnmo tytlp  anes;t)s2uoiopnudom  lieils) rumu  ;u0tee mfeiydfs el( s;u4trxnir3totoaD li ol() rum(r3iy1lp  mict (  2rm(  nu1oeto iciydfmDuanmpn(4tltoxr iodoaDr ivslt)srtrxrpny1opee feta(fs2raum ou0apx mfeiaslm ranvp;u4aexrxf3iodla r u s t0tetoimpiodll elnci ( a2uaumonu1texomfctld aDel(mpnt4 rtoir iadoptr u ol(0 exoxo3iudapen fcsas a2urx pou0opto ociydfmDuanmo;() lerxrcta1lpDrai s;s t2urxr iy1ol nmnci tfs2um( p;u4opt  octlslm2ua(vp;t0trenxoctodlaD  u olt  eto(rpno1om  miesat sDtau p;u1texnif3tadlm ulnvp;(4tlxoxf tydlmD au ol(0teuoxr3oo1open fetat  2rm(r ot1oet iociasfa2ulnvonu0tlxnirciytop  ln s t0 eurxo3nydopt  nvs () rumxr oo1alx  i3ild s ra( p;t4trxnmrcoa1oateau il(0s2toxr oudll nmneilt) rta(r ;u1texn oeiad s2rln s;(4teerxocootlpte nvi;t)teuo(r3iu4lmtemfvil( s2rmxm no4opxnii3tys aDuln s t0 etoxo3oo1fpD luvi t0 rtoxm3nydalenmneil(f Drm( p;u0olxn o3tysfa2elumonu0 etrmrciatom e ivsls t2trio nodolte fetat  2uaurooo1aee  feiys m eluvont) lxnio iytlptrlnes s)t2ur(rpnu4omtelivtl(f Dtmumpnt4apenifcias m2eln p;(0trxrxo3oo1omteliei;(0s2uoio oo1alte fvs sfsrraxmonu4oeto o3tydls ranms t)artnmfctytfmD anvsls)srtrxm nu4ol  mnvtls  2taumpot1tex  oeiasfm2rauvp;u4tetnmf tytfaDrai o t  2umxo nydom n nctls arrm(r ;o1aptoifeiasfm eauvsnt4 exrio3io1op rlnvslt)s2tm(m ny4llt mfcias  Dtru o;t4apenif3iat a2emumo;t4 ltnmr iy1fmDeliei t0s2uoiopoo1oltemnct (fsDtr(  ;u1aet  ocilslaDel( p t)aetnxocoatfate nvo;t  eur(mpiodolt mictlt)aDrax oou4aetnmo3tytlmDulnmo;u4tltrmf oodoa eanvo;()t2tmir oy4lm elfesas) rrmum ot1tex iociadfsDua(vonu0altrio3ta1oa rau olt)srtoxo ou4lmte ncias s2rmurpot1aleo oetysfs2rm( o;u0trxoir tadoatrlivs;( teuo(o iu1ap nmfes t)arrr(m ;u1tetn oeilsfmDra(ms (0trtoxf3oa1fatrli o s trxr(rpio1aleeliesl(fsrumxrooo1olto ociys m ua(vs t) eenxr3iodopte uvi;t0srtrxm3ou4lltemfcta(fa2rax o;u1apx moeiltlmDul( pnt)aexnmr todlp  l
\ No newline at end of file
@@ -0,0 +1 @@
+iei;()srxm(opno4ope  fvslt)arrmxront0oexoii3iydfsDumnmp;u4arenirctotfateln i;t  2urir3iodlpen nvsas  rumumono1aptomf3tasla2em(vp ()tleomo oy1opt  ieo () rtr(m oodom e ncslsf rtaxm oo1oexnmoeiyt m ea(mo;()arxnir ty1fa   ueo t0s2uoio iodlleelnvs ()arraur nu1tpto ictyd s2ulu p u)arxnxfciadlaD livil(0s2xoiopno1ll elieta(f rraxrpot0oltoio3tyt sDulu o;t4alenxf3totfpDeai ols) rtr(o ny4aptemnvtlsfsDta(mpoo1opxnmiciaslaDuaumsn(0 rxrmrctotlmtelu s;()t2trio3ou4op elieia() Dtrum oo4aexn f3ilt m2em(vs;u0 eeomo tydopt aies;()teumir3iudam n fctasfa2tmu oou1texomiciadlaDumu s;t4aetoxfctadomD liei t teur(o oo4llt mieils aDuaumont0opt mfeild a elumsnu) rtrio3iydlpDelivi;t0 2trxmpou1ap  lnvtls  Dtauroou1apeniocildlm em(vpnu)tltomfctotfa   neol( texmxo no1lp e nvtat aDrax p;t0aeeoiieilt mDeanms;()trerifcta1oate uvs t)t2umxm3iu1omtemictasfsDtmumono0olto oeiyslm2emuvont)alxriocoa1fp  lneolt  rum(opnodlpte nes () Dua(mono1aex iieiatlaDrauvo t4 leomr3oydfptelu i;s  rtoio nu1apenmnci s)arumxmpnu0olenmi3ilsls2uanvs u0 ltrir3oo1lpDr i s t t2tm(m ou4al  lfctlt a2tmxro;o4aet  f3ilsfa ra( sn(4areomf tytlm eaueslt)s2xr(r oy4lp nlfvils) rrm(mpou1tpxn ocild aDrmuvo t0texoxo3todomD li ol( t2uoxo3ny1altn ivi t aDraurpnu0oexnmfciytlmDrmu p ()aeeoxociodla   uvi;s) 2xm(r io1omt  nvi t srtmumpoo4aetn f3ild a2rl(vs u)alenxfctydlp ran o t srxrim oy4oltemfcs tfsDtau o;o0tlenmf3tadfa2rl(mp ()trenir3iodfm  an i (0teuoxopou4open iei () rrm(root1alxo f3iyt aDrm(vpnt4trxrif3iotoateaivi;s  2xrxm3oo1oltelfvtas a2tr( p;u1tet io3tldls elnmo u4aetoir oydlpDran ilt)srxrxmpoy4op nlncil( srurxrp;o1opto feiytfm2um(mo;() renmocio1la eauvo;t trtmio ny4opt  icta( s2urxmpnu1aleniocilslaDrmuvpnt0 exrmocoadoat  uvs;s  rxoir io1op e ieils) 2rm( o;o1tpeo ociadla2ea(ms;(0tlxomf3oadfpDeluei;s0 etmir iudal  mncias sDtaumooo1opeo ictasls ulnmo t4tlxnir ia1fatr i sls0trumxm nudale mfvsatfsruauront0tle if3iadls2eauvs;t)alxrmr io1fpD  n ilt) exr(mpiodal n ivtat  2taxm oo0oeeo feiys s ul( s;(4 rxomr to1lm e neslt0tetmxo3oo1lm e iviat) rur(rpno4alx iocils s2em(vonu) eenmf iotlaDr iei s) exoxr3nu1al nliviltf Dra(  nt1opxo o3iydfm2el(ms;(0altrmr3iy1oa eau i;s) 2xrio3ou1ale mnesls)a2rrx ooo4oeenmf3ils m2raump (0 lxrir ootoaD  uvils0 exmxrpno1lm e fvi s  Dua(r oo4alxnif3iatlm emuvp;u0 renmfctydfp eau s;t)s2ur(o io1lmee fetls  rtax pot1teto f3ild s emu o;t) rxnifciodlm elnvolt0 2umir nydomenlfvta(faDurumpot1aexomf3ildlm ea( pnt) eenir totom r ues t0truoxo3ny1ol elnvt () Drau pnt4teeo fciasfs eau sn(0 rxniocta1fpD lnvo;() 2um(m no1ol elneias)srrrxrpnt4alto oeiytfa2uau s;(0aetnio iadopt anvs;()s2xr(opoo1ome lfctls) ruax pot1optnmociasfsDea(vs;u0 exnxo3iadfmDelieo s0srxoir3ou1apt  nvsa() Drmur ot4apt miciys a2umump u0tlxomf tadfpDeaieil(0 rxmimpny1omeelnci s aDuau  ot0texnio3iys s2uluvpnt4tlxrxoctotoaDr neslt)seto(o iy1lp nmicsa(fsDtr(mpou4tetnioeiydfm2emnvs u0 eenxr oatlp   nei t  2urio3ny1oltelnci s)aDrax onu4aex iociatlmDrmuvs t4artrmo to1lateaivols s2ur(r no1lptemiet t s2ur(  ot0aexn f3ild s2eaumsnt)aexoxf3iodopt anei s) rtoiopnu4opt lnvs ()artmxrp;u1olenii3tatla rluvo u4 rtoxr3oodlpDeau olt)s2xoirpiy1olee fviat  Dra(mpot4opxn f3iaslm raumpnu0artrirctotlpD ai il()truoiopoy1ale  ivt ()srtrur oo4tlt iietadlm el(mpn()aetrxo tadlat ln o;t0 eurxrpnodlpt mfes t)artr( o;o0aex  ociytfs ea(mo;u)altoxr iotomD lieils)trxo(r nodape lnvslt) Duru pnt0apx  icilslm ranvp (0 rtrmr3io1fm r ueils) eurxo iy1om elfcsltfaDrmxro;o0aetoioeiyt m2umn s t)tlenmfciytlpt  i o s  etoir nu4olt lfct ( a2tau p;u4altnmfciysfa2ulnmpn(0 rtrxr iatlmt  n olt0trur(o nudlmt lnes t)srrmxrp;u4tpt mo3iys m2eanmp ()trxnmocoo1oaDrlnes;()trxmxopoy1ol  lfesat  2rrumpot0aleomo3tydfa eanmsnt0teenmf3tytfm r nvsl(0t2xmxrpnudlme mietl(f Dtrumoot0tle  iciat s umnms (0 eeoif oy1lmt livi ()teuoiopiudom   fci ( a2umu oot4oeenif3ias sDua(vont4 rtoifctatomtr iei ( seur(mpno1ol elfvtat) Dta( o;u0apenmoetydfa2umnvo ()aexoio to1laD luvilt  rxmxo iy4optnlnci tfaDrr(mpoo4apenmoeiatlm umums;u0tltoir3oy1late neo;s s2urxmpiodoptnmiet s a2ta(mpnt1olxn oeiytls2el( o;u0arenmoctatlm  au o;( srurirpoodole  icta(fsDuau pnu1teeomi3tltfmDuluvp;(0 exrxo tytomtrluvo ( trxmirpno1ll  mfetas) Drmxm ;u0tex  o3iys s um(msnt0trtnxfctydoa eaieil()sruoir3iy4op nlivtat  2rmu p;u4tpt  ocildfm2ranvon(4texoxfctydoat  n s;( trxo(mpnydll  mies s)srur( pnu4alxomietytfm ean p;(4 exrif3oytfmteaneo (  rurim iu1ll emfvs s)aruru pot1teeoioetld m ua(mo t0tetnxr io1laDrluei ( teuoiopno1openmnctl( a2uaxmpno0aexn fcildfs ranmon(0 lenmo oa1opD anvs t t2urio3oo4opee icsls arrau  ;u0alt  ieilsfm2rlumo t)artrxo oa1fmD ln s;s)trxmiopiu1alee fvia(f Dururont1olxniiciaslaDrln s;(0 lermo totlp r i il(0truoxo3iy4apeemnct t srta( pnu0tpxnifetys s umnmp;(4alxoxocto1fmtelu i s setrio3iudalee ncsl( s2tm(mo;t1teenif3tys s2eauvp u4tlxoir3io1fpDe ivi s truoxm3iy1ap nlnvia(fsDrrxr ;t0oee mieiasfsDua(mo;()artoxo iodlatranvil(0s2um(mpny4ap  mneia()srraump;u1alenii3tyslm ea(mo;t4trxrmo3iytlm  lneol( srur(o nydlmt  neia( srum(ronu4aeeo fcias sDeluvs t)trtomoctodlpDr nvs;s0s2xmirpoo4llt lncs (f 2ta(mont1olxomfetldlsDeln pn(4tetrif3iatfp  anes;t) exr(rpny1alt  fetat)sDtm(mont4alt ifetydls2rmnmpn() exrxo3totomD  ies (  2xo(o3iy4amtelncias  2tmx onu0tleomociyslmDelu pn(4trtrir iydfmtr uvs;s0 rtr(m ny4ol elfeiat a2rr(rpoo4aexoiieildls umu o;u) etnmr ia1laDeanei;s0 2tmxm3oy4aptn fvslt)aDra(rpou1tpx iociysfsDrluvo;(0 rtoxo iotla   i s t)trxoxopnydlmee ivsasfsDrm( o;u4aleniociydfa2rluvo;(4trenxfctydlmtean sl(  2xo(r3oy1altnmnvtls)a2umxmpot1aex mfciytla ea(mp;()artnif oodlat aivils0t2uoim3iodap e neta(fa2urur ot0tlx mieilsfm2uluvont0 lxoxo3oatom eli o;s) 2umirpnudllenlfvsls) Drr(rp;u4apenmfetld mDeanvpn()teenxf io1fpDr nvols s2xrim nydlpenmivil(  Dtaxrpou4aptnifeiatlm2eau s (4aeenif3iytomt aneilt  rumio3iu4lpe mnvs tfa2tr(  nu0oex mfcildls emn o (0trxoir3oadopDe ies s0 rumxrpoudame mnvsa() Drmu  ;t1apeomfeilsfmDrlumo;u)arxomo totomD au slt0 rum(rpoy4ol n ivsasfsDra(r ;u0tlx mfciytlmDuluvp (0tetnifctodom   u s t0s2urxrpnodapen neilt a2um( onu1alenmociat m2rln on(0tetnxf3iydlaD aiei;t)teumio3iy1omtnmfei s) rumurp;u1oexo i3ild s2ean snu0 leoxr iadfa eanvil( t2tmxo nodlmenmnvilt)srum(  oo1oeeomictyd m rmnvo;(4aeenmo3oatfmtraneols0 rxm(rpou1oleelfetlt) Draumpou1opeomieiyt mDranmsnu0tltoxf oo1fm e n o ( trurxm3iudopen fctasfaDtrxmo;t1alx ioeiytfs ul(mo;()trtnirctodlm  aieols tetoir3nu1ol   nes sfa2tmuront0tpt iociyslm ulumo;t0tltrmr3totomtranvils0 2tr(mpou1opeemfviasfsrrm(monu4tpt mf3ilslm2ea(vo;t4aeerxo3oo1fa eai s t) rxm(o nodap  mnes tfartru pou4tetnmiciytfsDulnmpnt0aetrmo ty1fpDeaueils t2xr(r3oodlmtnlnetls a2uaxmooo4aeeoif3taslsDea( pnu)aeerxo3ootopD lueo s) 2um(m ny1lpe lfvsls s2rm(mp;u0texnmfctlsfm emuvp u0aexrmfciadopt  ieolt0teuoimpny4lltn icil()sruaumpno0tptomo3ildls raums;t)teenxr oo1fp  anvs;t)trtr(opoo4aptn fctat)arurump;t4apx ifcilsfs2umu ont4 ltomfcty1fmDr uvs;t trtrio nydomeelfei (fs2rrx o;t0tpeo i3iadlsDumu on(0 eenxf3ootopt lnvs s)tetr(o ou1lm emncs t)s2urx pot0tlxomfetyt aDemnmsn(0 lxrxf totlaDranei;(0srxr(o3ou4lm  lieiltfsrua( p;u0apt mo3iad aDul( snu) rtomrcty1la   u ilt) rxo(m oodalenlnvi s  2uaumpnt4oeenmfeilslm2ea(vs;t0aeerif iotfp  luei ()texmir3iu1apte fcslsfarumu p;u0apto ictysfmDuanvonu4trtnmo tytomtr nei (0 2triopno1al  mnetlsfsDua(mpou0oltoif3iys s eln o;t)teerxoctatfmte n o;t  ruoim3iy1aleelnvil(f Drrxmont0tpenioctatlaDelnmsn(4 rtnxrctodfm eluvo;t  2urio ny1amenmfcta(fs2raxmo;o1opx mictltfa uanvpnu)altrmo tadlpt luei;s)setm(r3oo1lleelfci s s2umuront1tet ifetyd a ra(ms;u4 ltomr tatlptrli i;s t2to(r3ou4opeelictas)a2ur(mono1ape if3tltlmDra( sn(0 etoxfcoadfa r n o;s)sexmxm ou4ap  mies s)aDtmu  ;t4tle ifctasla rln p (4altnxr tydomDelieols)srxoio3ou1apeelfct s)sDua(mo;o0oetomfeiys s2umnmsn(4aeerif oytomDelnvo s0trtmxrpny4oltn iesa(  2uax oot4oeen fctadlsDuaumpn() exrif3oy1la e uvo;t0setoiopiu1oltelfvsat s2rruront1apt iietyslm rau p;u0trermo oydfp r ueo;t  rxr(rpiy4om nlnesat aDtr(mooo0optnmfeiasls2ranmp;t) rermo ta1lm  aueil(  rto(o3no4lpeeliesas)srtaur no0altomfetas mDulu pn(4 eerir io1fm  aivs;s) ruoxo nydlle  iei tfarurumo;u0oeenmfcias aDranvs t0tetnxf io1fpt  i o t0tetmim3nu1ll   neil( a2uau p;u0apt  fciat s uaump;t) lxrmf oatfm   ieols)tetoxo ou4lpt mncslt)a2tmumpnt0alxnmf3tldfs2ul( on(0tleomo ia1lat  uvsls sruoxm3oydop  livt t)arrr(mpot4texnifeiadlmDumuvpn(4 eeoxrcty1oa  auei (0 rtr(m io1olenlfetlt srur(r ;u4olx  fctadlm rm( pnt0alxrirciodopD  iei s) 2xo(m3oo4ame lnvtl(  2tmxmpnt1tlxo fetad m2umu p u) ltoioctytlatr ivs s  2umio iy1apte ieiasfarrm( ont4opeomictysfs2rauvs;(0tltrir3tatfa e uvil()s2uoiopiu4lp   nctltfsDua( oot4apenmo3iatfsDel(msn(0alenirctadop rlivol( trxoio3io4lp e iet (f rta(m nt0alen i3tys sDrlnvpnu0trtrmociatlm eaivsls)s2uoxo nydlpe mncilt srrau p;t0ape moctyd a2ulnmo;t) etoxf iytfa  anvo t setmiopoydam e ieil(farur(mpoo1oet io3iytlm rmuvp t4trtoxfcoytoat  nvslt tetr(r3oo1optn nvia(  2rrx o;u1olen ieiadlaDulnvont0tltnif oatfateaivs;s  etr(o3iodll emfes s)aDuau  nt4tlx ii3iasla2umumont)texrmo oo1oatrln i;t) 2uo(mpoodlp elfetas) rtrump;o1aeenmfetydfa em(vs;t4 lerxfcoodopD au il( srumir3ny1ameelnetat  2tmx ooo0alenmo3tad aDeauvsn(4tlxnif3iy1lat ln o;( t2xmxrpiy4amtnmfcsat) rtmx onu0aetn f3iyd s rauvsnu4trtrio oy1lptr ieo;()srxrxr3iu4om nmfvslt)s2ur(mpnt4tpxomieiyt m2um( pnu0arxnio3iatfaD auvols0 2trxm iu1lmtnmncsls)aDumx  nt1alenmoetls a2rlnvs;(0 reoxf ty1lmD ai ol() ruo(mpiu1lltnmnvi s s2tr(mpno1aex  f3iltfs ua( o;u4arermrciatlm e i o;( teuoxo ou4ope mnesl() rtr(r oo1aeenii3ild a em(vo;(0artrir oo1fa   uei;(0 2urir iudlpen ivtls  Dur(m ;o1aee mictlt s2el(vonu4areomr3tydfpDrluvs;s0s2xrxo3oo1lmtnmfvs s srua(ro;u4oetnii3tltfa rlnmp u4 rxomo ta1la   ivo t0 exoxm3iodomtelnctltfarurumo;u1ale  feiadlm ra(mo t0aeenir iytlmDrln il() rtoxopiu4ll elivtas  Dtmu o;t0tet iietasfaDeauvs t)trermo iadom  anvi () rur(r no4ap nlivt (fa2trx onu0tle  f3tat sDrm(vonu)tltnir ty1oaD  iei;t0 2tr(opno4apenmfvt sfa2ur( p;t1olx  ocild sDeanvpn(4 lenmfcto1lm raivs;s  rumxr3iudoltnmnetltfs2rax  nt0alxnii3tltfm2rmuvs u0 lxrxo3ootomDrlu ils)sruo(rpoydop  lfvs s)artaxrono1apxo o3tyd a uau snt) lxnmf3oo1fmt anesl(0s2umxm3iodomte ncsasfsDtaurpou4oeeniicilt a2eluvo u4aexrxf oadop r uei;s)sexrxmpoy1alen ictl( a2tmu p;t0ale iociydlm2rlu s u) ltomr3ta1la rau s (0 2xm(opoo4ll nmfctls  rtrur no1opxnioeiydfm ea(mont0artrxf3tytlp elies s  rxoxrpoo4opeemnctas artrur ot4ape mieiat sDuaums;t0 lermfctodfmDr i s;(0truoxrpio4omenlfvt s)aDrru pnu0alxn o3iys a umu o t4aetrxo3ta1lp rlu i (0tetm(mpio1lmtnmnvt ()sDur(ro;u4apxomi3tasfmDuanvo;u) exomr iadoaDeanvil( seurio3io4am nlicias) Drm(rpot4aexomi3iytfm rlums;u4 renxfciotlm  livilt) etoirpoodam   ncs ( aDur(m ot0apxnmfetlt a2emnvp;t0tetrxr3oadomDraueolt)trtrxo3ny1llenmnvsa(f 2ta(m ;u0apt moctlt a uln s;u0texrxo3oadlpteauvils)srtmxrpiy1openlies s)artr(m ot1oltn o3tls s2rm( p (4 lerif3tadlp rluvi;s sexr(r iydom elfctls)a2rrxro;o1oee ifctatfa2rm( pnu4 rtrifctatfm e uvo s  euoxm nodame mnciasfaDurx p;u4teeo feiad s emums (0 eenif todfm rliei;t  rxrxr no1amtnlietls)srrm( pot1altomfctytlsDea(vo u0arenir3iy1opD  i i;t0tetm(rpiy1apeelncsl(f 2um(mpno0oex  oeias m2rau p ()treoircoytfaDraues s) rtmxm3oydale mfctasf rta(rono4ale ioetadls2eaums;() eeomo oo1fp eauvils s2to(opny4ope mnesa( artaxmpnu0tpenmf3tltlaDul( s;u4 rtoxf oy1faDrlies s  2xm(r iy4omt lnet sfsDta( pno4tlxn f3iltla2rm( o;(0aetrmrctadlaDelnvilt)s2urxopoy1alt  ictltfs2taumont0opx mo3tysfa2elnmsnu4arenio totlptrlnvolt sexmirpoodome mivi ()aDumur ;t4apt mietlt s2rau p (4arerif3ia1omt lues;(0 rtoxmpiy4optnlfesls s2trxrp;u0tpto ieiadfs2ul( s;() reoxf3iy1lmtelnvils0sexoxo iudomtnmfvsa(faDtr(m ot1apx mo3iadfaDraums;u0trxnmr iotom rlu sls0t2um(o3nydamt lnvsatfa2tr(mpno1alxo octyt sDra(vs;u4aeenxrctodfpD aivolt)texm(m io1olenmfctlt  Dtmxrpnu4aexnmi3iltlmDuluvsnu)tltrxr oo1lptr n s t t2trim3oodal elfct sf Dtrumpou1teenii3tyt a ranmp;t4aetrmf3oatomDr i s;s srtmxmpnodolt  nvtl() 2urxro;o0oetn octat a2uauvsn(4artoif3ia1omtrlu o ( s2tmxrpou4ame liesasf rraxroou4tle io3ias aDran sn()trtnxo3tadfmte neslt)trxoxo ou4openmies t  2rmxront1teto f3tldfm2ra(mo t4trtnirctatfpD ai i;t0t2trxrpoudaleemncs t)a2um(m nt0altnmiciaslaDrmumo u4 leoxfciotlmD anvo (0seto(opiodapee ncsl()srurx  ;t4ole  fciat sDra( pnt0 ltnxocoytopteluvi;s0t2xmir oodolee fvi ( artruro;t0tetnmieiad m rlumo;t0artomr3iodom e uei () eto(opoydoptnlici s)srtrxm nt1tpe ifctysls2ulu pnu0aexnxo ootlpDeau o () etrir nydole micilsf Dtrxmp;t0aptn o3iasfmDemn o t)trtrxfcoa1oa  livs ( t2toxo3oo1lme mnet (  rtm(mpot1tlt mi3tltls eluvo;t4teeomr3oo1lpDean o;t) rurir3iu1al e nvils) rraur ou1aex ifctatfm el( snt)alxrxo oo1fm rluvs (0sruoim iudolt mivslt srumu  no1apxomoctydlm2ulnmonu0teeomf3iy1fa e n s s)t2xm(o nydaleelicias sDra( poo0aptoii3ils m um( o;()tlxoxfciatlpD  n o;s0srxo(r oy1alenlietl( aDtau o;t0oltomiciyd s2ua(vsnt4 ltomf3oa1fp eaues;( srtmio3nu1lmtemicsatf 2uaur ;t0tlt mo3ild s2emu snu4 rxoxr3totlptrlivi () 2uo(mpiodlm   nctlt arraxront1aleomi3tydla umnvpn(0trxrir ta1fpDrlnvs s)srtrxm3oodlltn ncsa( srrrum ou1ape ifctas s uanmpn()treoio3oy1omte ivs;(  rxmimpiu1ll  livi (  2urumo;u4aeenif3tlslm2ua(ms t4texnxrciadom e uvils0t2xm(o3no1openmncta()aDumx oou1tlto fctldfa2el(vo;(4texnxrctotfat anvo s0 exr(mpoy4altn neils aDumurpnt0aee mf3iydfa2rlu onu0alxriocta1fpte ivi t s2uoim3iu1lm   ivias aDur( ono0olx miciadlm umuvs t4arxnio iatomtr ueslt0 rxm(r oodll nmncia() rumur oo0olt  fctldlaDua(vsnu4trxnxf3iytoa r i sl()trxoxmpiy4ol elfvs s) rtrx  nt1tet iictysls2umn s u0altomrcia1om r uei t0s2umxm3ou1lltn ivt sf rtm(rpoo4altn fetydlm2ean p (0 ltoir tytfmt  u o ( seumio3nudap  lfcs ( a2rrumo;o4tlxo icils mDrl(ms (4 rerif tytlmD lnes;t0trtm(m3iodal n fvtat aDrr(r oo1tptoifeiyd m2rmuvonu)texomfcoo1fp   i s;t0trxr(r nodol n ietat)aruaxm ;t0aptomiciad mDumnmo;(0tlxoir oydfmt  ivo s0 eto(opiudalen ivt ( sDurxrpnt4tltnmoeiysfs2el(mo;(0altnmrciadom r uesl()t2umxm3iy4opt mnci t)sDra( onu0alt  fciytlm ulnvpn(4alxrif io1omDeli s t s2xr(r oudomen ietltfaDurxr ou1aetnioeiltfm2uau p t0 leoif3oatlatrlivo;s0 rurio oo4alt lnctl(  2rmxmoou1apxnii3ildfmDumumo;u)tltnxr iodoatr uvs;s setrxopiydop nmivtas) 2rrxroot1opxn i3iatlm2eanvo;(0aexnxo io1oa r uei;s0s2tmxo oo1open fciltfsDra(r nt4olx  fcildls2ra( o t)tlxrxociadoaD aieilt0texm(m iydlltnlnvtat srurur ;u4aleoioetld mDemuvonu0alxoxf oadoaDraiei;s  ruoim ny4op nlnvslt)sDrmxrp;t1opxoifeiysla2elu s t0 rxnmfctatlaDelivi s trxrim3iu1oltemnetlt aDuaumpot1aee  ictlsla ua(vo t4 etnxr3oytfptraivs;s0 2xr(o3oy4ol  miciasf 2taurp;t4apeoioetad s umnvo;u0tlxomo3ia1fptraiei ()t2to(opnydlmtnmfetls a2urump;t4apxomfeiatfmDrmn o;u0 lerxf todopt anvo s)setoxm3nodlp   fcs t) Dumu pno1apx ioeiad aDel(vs;(4artoioctydop e i ols0teurio oudlp n nes (fartm( ooo0olenmf3taslm rlnvp;(4 renio oytfpDraies ()srtr(m3ny4ape lnetat s2ra(rp;t4alxnmieilslaDel(mo t) rxomr oadfm eai sl(0 rxoxo3iy4op elicta()srrrx pno1alxnifetysfa el(vs;t0trxoir3oy1oaDrau s;s srtmxr3io4ale lnci (fsDrr(rpnt0texo fcilslmDuluvo;u4 eermr ia1laDrauvs;()s2toxm iy1alt livtl()aDtm( poo4tleo ieiasls rm( p;u0aeerxo3tatfpt au o (  2urxopoy1llen fvsl() Dua(r oo0oexnmfciltfsDul(mpnt0 etoir3iatlm  li olt0 euo(mpou1alte ies ()a2ua(ronu4opeomieiysfa2umn snu4tlxrxo iydomteli i s) exm(m no1amtelncsa( arrr(m oo4opxoio3iadlsDrlu o;t0tlxoxrciy1om  li s ( setoim3io4om nlfviatfartruro;t4aleomfeilsfm emuvs;u0texnmo io1omDraiesls s2urir ou1lpt mfvsa(fsDuau ooo4teeo oetyt a2eluvs u) renxf3oytoaDr n o;( trtoir3nydlp   ict () Duaurp;u4optnifetlsls rm(vp;t4tleomfcootomD lneo s trxr(o3oydlm nlnvias) ruau  ;u0tee io3tyslmDrmnmp;t) lenioctytfa ranvols)t2umxrpou4llt mnct t)a2rmum no4tlt if3tad sDelu s;()altnmf3todfat an i (0s2umimpno1lmt lnci t  2raxm ;o0altniociltfsDulump (0alxoxo3ia1laDe neo;s  2uoxo iodoptn fcslsfsrrmu o;u0aet ioctlt sDuau o;t0texnxrctytfp r ieilt)s2toxm3nu1ope livslt)a2rr(mpnu4oee ioctydlm2em(mp t4tetomr tadfpteln ol(0 ruoxopiydll nlivs s)srtr(monu4alxnmietyt sDumnvs;t4trermociodlmteanvi s teum(opoodopt lnesas) ruru pnu0altn feias s2rm( pn()arxniocoadlat auvi ( s2xoxrpno1am n neslsfs2ua(  nt0teeniieiytfa2ra(mp u) ltomf3iatomteli s s  eum(r nodop elnes tfs2urum ot0tpeo i3ias s2ua(ms ()altnio totfaD auei;s0tetoim ny4ol emfcslt  rraur ;t0alxo f3iyd s em( o;t0alenmo3ty1fpteauvo t) exrir iydopt mict ()srraum oo4tpxnii3iltfs elnvo;t)trenxo todlmDeai slt0srurxrpiu1om nlicsls aDtaurpno1olx mfciatla el(msn(4 etrmr3tadoatelies t0s2urxr iudal emfetlt)srrmxro;t1oeeo ociad sDelu ont4artnmrcoo1fm  aivil( tetoirpoo1lpt mici () rrm(m ou0texo ocild mDra(vp t0texomo io1fp  luesl()s2uoxr3ny1ll nlfvia()aDrm(moot4opxoiieiadfa ea(ms (4tltnxfctytla  anvi t) rurxo nudop n ics sfa2tmxrpoo1apx  octydfs um( s u0arxrxr to1lm r i ils)s2xoimpoo4al emfvslt srrax  ;u4aee io3iatfm rmn p u4trerxf iy1lmteluvs t)t2uoxrpnu4al n fcs ( sDur(rpno1aet mi3iasfs2uln pnu0artoxfciotfp ranvsls sexoim oo4am elfctas) 2taxmp;o0apen ocils m uan pnt0trxomf3oydlatelnei;()trum(opoo4ll eliet t)srrr( p;o0opxo iciasls2ulnmpnu4trenircto1laDrauvi t  2trxm3iu1ol  mivtasfa2rmx ont4tpen iciyt m rl( p;u0tltnmf iydomtr uvo;t) rxmimpou1lptn fvt (fsrurx pou4altoif3iys a2eau pnu0 ltnxr iydlp elnvi t sruoio oydapt  ietl(  2ra(mo;t1oexn ictlt a2ul(vo u) ltnmr tytfatr u sls trtmxo3no4lltelnes s arrrum ot0tle mfeiyt s um(vs (0 ltomr iadlp  lieilt)trur(opno1alen feil()srrmxm oo0opxnmoeiltla em(ms u4 eenxf3totlp r i s ( trxr(rpno4lp  lieta() 2urxr nu4apenmfcias a ra(vsn(4 exrio3oo1lm  auvs;t srur(o3nydlpe  fetlt)artaumpnt0aeto octyslaDum(von(0tlermf3totlp rau s ()s2triopou1lpe mfvsls) 2urx onu0texnmo3iatfm raums;t)alxrio iy1fa raueo;()t2umxo nodamee nes sfaDtaxront4oeenmoctytlm2rl(von(0tetrxfciadlpD  uvi;(0 rxm(mpiodamenmfvt (fs2uaum ;u4alt  iciad a2elnmp (4trermoctytlatrln s s setrxrpno1lp e ncil(fsrumxrono0alxnii3tld sDrluvsnu4arxoxrcoatoaDeanei s  etrxr3ny1ol n fes s) 2ra(r oo0tet ifetlt sDua( o;t4tlxoxo3tadopteauvsl(0t2tm(mpnodlle mieilt s2urump;t4aexnmfeils s um(mp t4 etrmr3oytfmD  u s;t)sexrxm iudop  mfvt t a2urur nt0alen fctadfs emuvs;(4treoxr3to1fp  ai i;t) eumir3oo1olt  fcslsfsrrmxmp;t0tltoioeiatfs uauvs (4alenmo3iytfaDranvil(0 2xrxrpoy4amte nvi s) 2umx  nu4alt  i3iydlm2ra(vs;u4arenio totfatr n s t)trtoir3iodame licilsf Drmu  ;t4oleomf3ilt a emu pnu0 exoxo3ootfmteluesl()trxrirpno1optemfvils) rurxrpoo1aptomfeiadlsDumnvonu)artrmo3iotfmD luvo;(0 2trim3ny1lltelfvs s) 2ur(m ot4altnioctysla2um( p t)tlxomrcoy1fp  anesl( trxo(o iodal nliviatf rrmu  ou4apx mieilsfaDemnvonu)tetoio3iadoptrlu s (  rurxopiodapeelfct t aDur(mpou1oetnmieiyslsDrmuvont)aeeomf3todfm  auei s setm(o3oudlmtn fctat)sDrmurpou1altoii3iysfs2rauvsnu) lxnio tydop   ivo;t0teuo(m3iydlpt lfvi s sDrm(mp;o0opxo fcild m2eau s;t4tlenmo3oytopDe ivo t s2xoxo iy4amtelfvtls)aDumumo;o1oetn oeiyslaDul(vs t) lermr3iotfat  uvo () rtmxo ny1amenlies s)s2ta(root4alxnio3ildlmDum(vo u0 rxnir oa1oa elneolt) 2xrirpiy1ap nmiesatfsrtmxmonu0tptnmo3tat s2ea(mpnu) renmf3iytoateli olt0trxrimpiu1lp nmnvsa(f 2ta( ono1oex mietys mDrluvo;(4artoxr3tydlaD au sls) eur(m iydol e nesa()s2tmu pnt0olxn iciatlm ea(von(4tltrmf oytom rlnvolt0 2umxr nu1alen nvta()s2uru onu0alx ifctat m rmnms;u)tlenif iydfaDe neils) 2uoxo3no1om n nvsat arrmurpot4oeeoioeiasfmDrlu s () lxnirciadfmD auvi (0srtrxrpnu1lp  mneta() Duru  ;o0aetoio3iadfmDea( s;u4 ltoif oatfaDr n i (0 2uoxm no1omenmivtlt) 2raum oo1opxnii3iad mDrl(vo;()trerio3ta1fa  au i t0 etoxr oy4llenmicil()a2uaurpot0tlxoifctytfs el(mp (0tetnmocoodla eliesls)t2to(o3no1am elieil(faDrm(r no0tle ii3iltfsDulnvsnu4tlerxfcoodfpD auvo;t)texoxo3iu1ame lfcslt) 2tmumo;u0olxomfeiasfm um(vp u0tlenxf3oo1omt anes;( s2xmxr io1ol emictas)sDtax pnu1alxnif3tadfmDrlnms t)trtomfciytfatrlnes () 2xo(r iu4optn neslsf Drrum ot4aptnmictad a2uan o;t0 eeoxocoo1laDe i s;t0t2tm(r ny1olt  iesasf 2trum oo0opxniocilslsDumn s;()arxrio3iotlaDean o s0s2trimpou4lm n ieil( sDtr(root0olt  oetlt sDel(mo u)aexrir3iodfpDrai i;( srtmio3iy1lpe  fvsl()sDumxmpnt1teen oeiydfmDemu s;u) eenxf totlm raueols0texm(m3iodlpeemictl()s2tmxroot4tlx io3iatfa rauvp t)aexoxrcoatlm eau i t0s2toxm nodlm elivil(fsrrmum oo1aet mietat aDraumsnt)alxnmfcoydoat aivsls) rxo(opnydlp  mncsl(farta(  nu4tle  oeiatfm2uluvs;t)alxomo3ta1om   n sls0srtr(mpoo4omtnlfvia( aDrm(  nu4apx iociasfaDeaumon()artnmrctotfpteanei;(0teto(m nu4om nmfvsl(f Dra(r nu4teto ociltla ua(vo;(4altomfciodlpD lu sls) eurimpno1openmnci ()s2tm(m nu4tlxniieiydfs2emnmpnu0texnxfcto1lmt auei t)trumir3oo4olte ivs tf Drrumpot1olxoio3iytfa rl(vo;t4teeriociydlmte nvs s0 rxr(r nodopteliei ()s2urx  oo1tet ioeilt a2rl( o;u4 eenmocoodopteau o;t0 2tmxopny1ope  fvi t sDra( p;t4oleo fetyd sDrm(mo;u0teeoif3oydoa   n ols)teuo(rpiydlm elfesasfsrrrxmonu0opt  ictydfa emnvs u0 lxoio3oydom  li s;t s2to(mpou1lltemfet sf Dumumont1tlx  f3iadfa emuvp (4 rerio3oadfpte nes t0texoxr3ou4lpt mnvi sf 2ra(r no1alxnmieilsfa2elumo u0 rxrmfctodfmte i sl( srtrio3oo4op  mfctltfa2rmu  nu4tpt micils m rlnvont)altoxo iydfa  aueo s0trxoxo iy1lltnlfcias)s2tr(m no4tltnmieiaslm2elnvp u)arxrxr iy1omt auvsl()texrxopoo1lptnlnei tf 2um(  ;t0apxo oetatlsDeln p t0trxnxrcto1la  aues;t texo(r3oy4ap nlfct t)s2rm(  nu4tleoifciatfs2rmnmo;u0tltnirciatomDean i s0srtoxrpno1aptnlict (fsDtaum ;t0oltoiictls m2emuvs;u0alxrircty1lm rlivil(0trxmio3iodalt livtltfs2uaxmoot1aleo fciyd mDrauvpnu) exoir3to1fatr nvslt) eur(m iy1ll   fct s artrxm ou1apxo o3iys a rl(mo;(0texomociydoa   n i;(0tetrio oo1olt mneiatf rtm(moou4olxoif3iatfs umn p (4aeeoircoatlp raieils  rtoir nodamen nviltfaDtrx pno0tlt ifctyslaDrau p;t0 eenif3to1lat anvi (0 exrxm ny4opt  feil( s2rrx  ou1alx  octasfm elnvs u0trtoxf ia1omD  nvi;()t2to(m oo4al nlnes t a2tax onu0alto ietasls2uauvsnt4tetrir oatfatrlu ils0trxmimpiodomen net ( sDtrxr ;u1tptnmietld mDumnmp;t) etriociy1lptraueo;( t2xo(r nydlpe  ncs sfa2uaxr ;t4altnio3tlsfaDuln pn(0artnio3tytoaDr n ilt)srumio oy4op  mfcil( sDurum ;t1opt ii3iatfs2emnvo t4 rtnmr iydopt lies t s2xrio io1opee fcil(f 2tr(r oo0oltn f3tlsfs2umnms (4trxrmr tatlp rlnvi s)setrimpoy1op  lictl(faDrmxr ;o1tet mo3tydls2rmump;u)tltomo iydoa  lueolt trxmio3nu4open icsa(fa2raurpoo4apxnifeiytls ulump u) rermr tydlmt  ues;()t2tm(o oo4ol n fvias)s2rmumpno0teeo i3tytlm rmn on()arxrxf3oydlmD luei;t s2umimpio1am nmfci t srtrx oou1tle mf3ild mDrmn pnu)arenxrcootfmD  i o;( sexo(mpoo4op emnetls) 2umur nt4aeeniictltls ea(mp t0trtoxf3ty1fateanvo;(  2xrimpnydomtn nvsl(fa2raumono1aexoioetls s2uln pnt4tltnxr oy1lpteauvs (0seurirpnydoleemfciasfs2ururpno0aeeoiieiad sDul(mp t0alxnir3to1om  ln i t) exo(o iudoptn icsa( artrur ;o0opxnifciysfmDrln o;u4alerif tydoptr nvils trtmirpiu1ap nlfvilt  rurxroou1alxn ocilsfmDem(mo (0 leoircoytoaDeli o s0srxoxrpoo4apeemneils)sDtr(ronu4tee if3ilsls umumo u0tlxrmociadom elu s;t  2tr(rpiu1lp e fetl()a2ra(m nu1aptn ocildlm2uan s;t)tltnmr totlmDe ueols0 rur(r3iy4omenmieiasf rtaxmo;o0aleomfctydfmDel(vs u4trxoxf3oy1lp rlivols0tetmxopnu4olenlfet (f rrrxr ou0aetomo3ilslmDel(vp t4 exnmr ty1lmt  ivo;s0 2trim nu4om   fct (f ruaxmp;o1alenifetltfa ulnmp;() lxnxr3iatlpt lnes () exo(r3iydomte feias a2umxronu1oeenifciad s2rau p (4 ltoxo3iotfp  lueols) euo(rpnydole mfeilsfarraumo;t1olx  i3iad m ra(mp t0 lenmf oytop elneols) 2xo(o ou1llenmfesa()artr(ro;o0oeeo oeiytfs rlnvsnt)texoxfciotop r u ilt0srtoxo iodal  lfctat  2ur(m ;t4aptoiicild s2rlnvs ()trerxfctadfaDrauvols0teuo(opno1ll  livil()sDur(  ;u1oex ioeiytfa2ea(msnt4trtrxfctatfatrln ol()t2tmxo3nodalenmnvslsfa2uaurooo4olxoioctyd sDrlumo (0trxoxr tydfpDrlu i;s sruo(mpnu1ol emfesls)s2trx  nt1oet iocils a2rl(vsn() rxoir3ia1laD aivi s) rxrir3iy4opte ies t) Drmurpnu1opt mictytfm2eln s;u)aetrirctatfpDe u s s srtmir ny1alee nct sfa2tr(ro;o1ale  oeild s raums u4alxoxocoa1fp   i s s sexm(m3oy1apeemnvsa( a2tmumpno0olxn ieiadfm ulnvo () eermf to1oaD  neolt) 2xmim oydaleelfvslsf 2umxrp;o1oetnmi3ilsla2em(ms;t4trxomo3tydomte nei t) 2xmxr3io1om elfesa(fsrrrur ot1opxomoeiydlaDea(ms;u4tlxoxocoydop ran o s  rxm(opio4omenlnct tfartr(mpot4tltnmo3tltfaDuln s;t0alxomo oy1fptraues;s0s2ur(r iu1aleelicslt)arraxronu4olenmfciadfaDemuvsnt4trerxrcoa1fa e uvi;t0 2xriopou1opt lfci s)arrmum nu0oetn o3ilsfa2ul(msn()altrxo3todop eauesl()seur(r iydol nmnet s  2rax ont0tlxoioetatla2uaump t0tetrifctatlmt  neslt0t2xrio nodom emicsa(f Drrx  ot4apt mieils aDrluvs;t)aetnmr3iytomt luvi;(0sexoir3ou1lmeemiciat aDuau oot1apt ii3iyslaDel( o u)trenmr3ootfpDr uvil(0trur(m oudal e nvsatfsrtmu o;t1tpenifeiatls2um( onu0arxnmrcta1opDeauvils0trtmxr no1om emnet (f rur(rpno0oee mi3iytfm2uanmpn(4 lenmr ootoaDelu ols0tetmir3oo1ale livtl( s2ta(rp;t0apen ictltfmDra(vs (0altrifcoytfmt  iei t)t2tmirpoo1optnlfci t  rurxrpoo0olen f3ildfs2emnms;t)alxoxf3io1fm r ivs;(  rtoxmpno4opee ivil()a2raxro;t1tlxoiiciad sDua(mo;(0trermociotlpDrlueols0setoio ou4lm emnesa(fa2tr(r ;t4oetomfeildlsDea(monu4 rxrir3tytfmtrliesls0tetoxm ny4ape livslt)a2urxronu0apxn iciytfm rmuvpnt0aleomo tytop raivi s srtrxrpio1olt licsat)srumu pnt0apt mo3iatfm ean snt4arxnmoctadfm eanvil()s2tm(r3oodope lnci s  2tr( ont1apenmictat s umn o u)aeermrcio1lp r ivs;()sexm(r3nu4ole mivias  rrmumpnt0tlxomoetydfa2eluvpn()alxoxoctytfpDeauesl()seumio iodllee ivt (fa2um(rp;t1apt iietyslm ra( snt4 ltoxf oodop r ies;s t2uoimpiudop elictltfs2rmx  ;o1tle mf3tltfaDrl(monu4 leoxfcoy1lm  lnvi;s trumio3oodomeemneta( a2taxmono0tpxomfciytfm rlump;u4 exoir3totomDelueolt) 2umiopou4apte ieia()s2umurpnt0oexomictat mDrln p;(4alenxfciatfmt an o t setmxm3oudam e nctat) 2tmumooo4opeomfciys aDeanvp;(4tlxoio tatlp elneol(  2xo(r3iy1am n ivt () rraxm ;t1texn ictltfs ranmp;(0altoif3ia1laDelues (  2xm(m3nodamenmnci t s2ra( o;t1tltoifciadfa2rlums (4 rxomf3tatoatr i slt0s2urir3iydlpte nvt s a2tm(  ou0alxomfetyd a2ul(vs;u0 rtrxo3todfpt li olt s2xoio nydllenlfeilsf Dtrurpnt4olxo fciyt m2rmuvpn(4alerio iy1lp eaueo;t0 2tmxm3io1amt mictltf Dtax  ;u4oltnmietaslmDrmn o u)aetomf3tadoateaivo t) 2tr(m3io4lp   netltfa2rmxm ;t1alxoii3ildlsDeanvs;(0 eeomfcoytoptrlivo;(0s2tmxr3oy1lmeemivi t)aDuau  ot4aexnio3ilsla elnvs u0 rxrxo iytomDe u ol(0setm(o oudale lfciatf Draump;u0oex  fctatfm2ra(mpn(0alxrmr todomteli sls0srxo(opio1opt  fcsa()aDrrx o;t4tpto o3iysfmDraumo;u0 ltrio tadfm  ai s t srtmiopio4om e nvsas)artrxmpnt1optomo3ils sDuln p u)trerxrcootfmDr ues;t)srxmxmpiudlmtnlfeta(f 2ra(rooo0aee if3ild mDrl( snt4texnxo to1fmD aueo s) rtoim io4lmtelici () rur(ro;u1aee  ictysfm2em(mp t0 lxrxr3iatfp rlivi t)setmxmpou4am n fct t  2taxmpoo0tle io3ilsfs2el( ont4 rtomr3oa1fa  aivsls trtr(mpoodam nmiei s srrmum nu1oetoio3ild aDel(vp;t4tlenmo io1fpDeli i s0t2xm(m nodop nmnet s) Dtaxm no4tetnmf3ild a eauvpnt)alxnmrcoytoaD aneo;s0 exo(r no4omeemfviat) rrmumooo4alt mf3iys mDrlump ()alxoxo3todlatelu o;t0 2xmim3oy4ol  liesas)srtmumpnu1oexo ietadfaDel( s;(0teerxr iadla rlnvsl()s2uo(m iydoptnmfctl(faDrrx pnt0tee  i3tadfs2rm( o;u0aeeomr ty1omt  ivo;(0trurxo iy4lptemnvs ()srrm( poo4oltnio3tasla2rm(mp;u4 lxrir ootlp rlu s;t sexr(o3oy1am   nei (fa2uaum oo0aex iocilt m2el(mp;u0altoxo3ty1lpDeluvs;() 2xo(opnudope liet tfsrrmumont4aet iieiysfmDulnvp u0 eenmfcoydomteaieil(  2xmxm oo1ale livsa(farrrxmo;t1texnio3ildfm2emn pnu4texrif3iadoa  au i () 2toxrpoo1ale lneilt)aDur(rp;o4ale mictlsfm eanmo (4teeomf3oytfpt  uvs;(0seumxm3oy1llenmnvilt)sDtmump;o1tpt miciysfs2ul(mpnu4tltnif3oo1op  lueo;s)srxrim no1lmen fet ()srtaxmpot4tpxnmfetyd sDrmn pnu)altnxrcoa1la ranvil() 2xmxrpiu1ome lfvi s)arurur no1tleomoeiys s2ua( s u)trxrxrcoytfpt livslt0srtoir no1lm   ieslsf rrmu pnu0tlxnifeilsla emu p;t4alxrxfciydlaDrlu sl(  2xo(o oudlp  mfvilt arrr(  ;t1altnifetatfaDeau o;(0altrxr to1laDr uvi t0 rxmir oo4lmtemivi sfsrrrxmpno4opxoif3iltfaDuaums u0artoxf3iytfmtraies;t0srtmxopnydomeelies ()aDrrx  nt4tpxo ietytlsDrlnvsnt4 ltnmr iodfaD li o t)srumim3iu1apeemfvs t  2urxrono0oexn i3iydfmDumu s t0trtrmr todlmDeanvo;(0 rtoimpnydolenlnctl(f rtmx oot4opx  oeias s2uau ont0arxnxr3iodlmD lies;s srur(r3no4lptemnetlt  Drr( o;u4tlto ietlsfm emn pnu0trtnxrcty1fm eaueols)teumxmpiy1llen icia()arrr(m ou4oeenmoetatla2ran o u4alxnxo oatop  aies;s)texoxo oo1lm nmics sfsDuax  nu4tpeomoetltfm2ra(mp ()teermr oadfaDraivs ( tetr(o3ou4apenlicia()srra( p;t1ole mo3iyd a rmu p;t0 rtrir3oatfa eaieo t seurxr iudomt lnvsa( aDumu p;o1tee moeiytlsDemu on(4tltnxf3iydomtrluvo () rxrio3nu4om  lfcsat) rtaumono1oetoiictydfa2eluvs;(0arxrxoctadfate uvo t t2toxr ou4olenmfvs s  rrrx oou0opx ioctadfaDrauvp u4 rtomr io1fm eln i t)s2urxmpoydlleemiviasfs2uau ont1aeto ictadfsDrmnvo;u0alenxr oatoa  ai s;t)t2xrir3oo4aptemneilt  ruax poo0oee iictyt a2el( p (0altrxfctatla raues t0s2to(o nodalenmnvt ()srtmumo;t1aet  octltfm2eanvs t)artrxf tatla elnes (  etoimpiu1am  mict sfa2uaxmono4oltniociytlmDumn p;t0trtnir3oy1faDr ueo t  rtr(m3no4olenmfct ()aDra(r ;o0tlx  iciadla umu o (0 lxomfcoo1lm elu i (  etrxm3nu1optelict (f rtrx o;t1oleoio3iyd s2raumo;(0texnxr3ia1faD luei s0srur(r nu4amte iciat) rtaxrpnt0apt  fctytlmDul(vo;u4 exrmf3iodfpDeauvs s t2toxm3nu4lm e netls a2rau pnt4tlxoif3tad a2elu s;(4areomocio1fmDraivsls0t2urir3oy4ole  ietltfsruaxronu4oex mfcilsfa2rluvsnt4 lxoxf3totlaD  n sl()sruoimpno4oltelicsl(  Dra(rp;o4tpeomiciysfm ulnmo u4aexriocta1lmD lneslt)seum(r ou4ll n ietls) Dtaumpno1ope  o3tldfaDumu p;t4 rxrxr iodfmtraneo;t setrxopiydlp n icils aDta(  ;t0aexnifciasfs2rmnms;u)teeoxf io1lpD anvs;t0t2uoxo3oudlle lfeta( sDumx  ;t4tlx mieiyt m rm(vp;(0alerifctotoa r i i t  rurxm3nodal   feil() rtru  ou0aetomi3iatfs2ean o u0 rxoio iytopD auvo s)teur(opno4opeemnvtatf Drrxront1tpt mieiysfaDumums u4aexoxfcootlp rau olt) rum(m3iodlpen ietatfa2tru pnu1opx mocildfs elu snt)artnxr iatom   ieo;t0s2uoxopnudam  mici ( s2tr(  nu0opeo oeiatfaDeanmo;u4 eeomr3tatfmt  n o ( sexmxopou4olee ici s  Dtr(ro;t1ale  ociasfaDem(vs u0tltoxf3oatfmt li ils)t2trxo io1llenmfvs tfaDtrur ;o1ale mi3iysfsDrlu o;(4arenmf3tydlm elneol(0 rxm(m3io1lm  mnetls)sDumum ;o0apt ioeiysla2eanms;t0 rtrmr iydomt  ieols seto(opoo1ll e iviatf Dtr(m no4olx mieiys s2uanms;t) etnif oy1opDr i i;t) 2trxr3iydamt  ncilsfaDtmx  ;t4tpx ifetatls2ran o u)altomf iotfp raneol()trto(rpoudom  licil(  2ta(root0opeo f3iyd m uauvo;()alxoxo3oytlp rli s t)srxrir io4ape lnvs s)arra(mo;u0oeenii3ils mDeauvsnt0aexrmo3oa1lmtrai ols)trxr(m iy1amen icslsf Dra(r no1oetoif3tad s ra( s t4tlxomo iydfaDeai i t0s2to(m ou4al emfes t)a2rmumooo0texniiciatfm2ulnvp t)alxrir3tadoptelueo;( t2xr(m nu1lmtemnviltf rtaxm no0apx  i3iydlm2rmumonu4aetoxocoy1oatr ieolt teuoxo3oy1ap nlnviat a2rau  nt1alt  fciadlm2emnmsnt4teeomo ta1op
\ No newline at end of file
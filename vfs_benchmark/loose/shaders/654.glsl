@@ -0,0 +1 @@
+n s t) rxr(r oudolt lfvs tfsDrax pnu4olxomietadlm2rl(ms ()tltnxr3oa1optr nei;()s2xoio oodoptelicslsfs2ur( poo4oee mieiytlsDeluvp u4tetoxocta1opDeaueo s)seuoiopiy1altnmnei t)srrr(rp;u4ape ifciaslmDelu p;t)aexnmo3tadfa r u s;()seuoir3io4oltn fcsas) rum( poo0tpenmo3ildfs2rmnms;t0tltrxr iy1fm raivs t) 2trim3oo1lm nlnvtl( a2tru  oo0tpxo o3tlsfsDeaums (4tlxnmf iodfmtr ivsl(0s2xrxo3iu1olenmiesa(fsruaxrpot1oex mi3iyslm ul(mp t4 exnxo3ty1fa eaneolt texoio3io1lmenlfcs s a2uaxm ;u1aleoifeilsfm2um( o;(0 lerxo3oo1oaDeau slt setm(o3nudape lfvias artmumonu1tlenioetysfm2eau snt4tleoxf3oatoatrlnes t  eurxr3ny1ap emiei s srurxm nu1aleoif3ildfaDrm(vs;() rtnio tatoptraivo;t)t2tm(r3ou1ome mnvi ( a2umur ;o0ale ioctatlm ean s;u0 renxo oo1lmtr u s;(0 2xm(opiy4ameemfci (farrau p;t1tle mi3iatls2umumon(0trermociadfmte i o t seuoimpoydomenmnvtat  rraum ou1opxoiietatfsDrlu s (0trenir3iytla   n slt setoim nudom  livia(  Dtrx poo0tltnii3tydfs2rlnmonu4tltnirctydlmD lnvs t texoxm3oudale lictls  Durx p;u0oeeomfetadlaDrln onu0trxrmr iytlpte ivo;s0t2ur(opoo1lm nmfvtls sDurxro;o0olen i3tlslaDemu o;t)arxoxf3oo1oaD an sl()s2urimpoo1alte ieia()s2uaxrono0oltnmf3iad a ra( p;u)aleomfcoatfptrlivs s) eum(o3iodomenmnet s arta(  oo4oex ii3iat a um(vs u0arerio tadfpDranvol(  2xoxm iudalt mfvt (fa2rrx oou0optoiieiltfs2elnvsnu0tleniocoodlmt livslt)t2xm(opoo4oltnlfct (f Dtax p;t0olt  ieilsls umnvo ()trermf3ia1oaDe u i;t0s2tmxr ou1lmt mnvtatfaDumum ;o1ale moeiytls emuvs t)aetomo io1fmt  nei;s) 2xoio io1llenmiesas) 2taxmono1optomi3tydfa ean o ()tltoxf3tatfatr nvi s) rtoim3oudapenmiesls a2tax pno1alt micildfmDemnvsn()alxrmrcio1fa r uvi;s)texr(m3io4ame lnet ( s2ur(mo;t1oleoii3ilslm ra( s;(4 lermr3ia1fp  aivils) rxm(r nu1lmee ict tfa2uaumpou0tpeoio3tytlm2um(vs;t0 ltrifciotfa ran o;t)t2xmxm3oy1lmee ieil(f rum( poo4oeen octldfs2rl(mpn()tetrxr iy1oa rlueo s0trxmio3iu4lpe  ivsa( s2umumpno0oexnmi3tys sDranvs;u4tleomo3ia1lmteanvil(  2xoim3iy1omtelfeta(faDtmx p;o1aet if3tldls rmuvp;u4 renmfcoadomt aieslt0t2xmirpiy1aptelnctl(fsDtr( o;t0oeeo oetytls2el(msn()aexnxr iydlmDeluvo (0trtoxrpnu1omtn fvtat) Drrx o;o1optoioctltfm el(vo t4trenxr iotoa r ueil() eur(m3nu1oltelieiasfaDururooo1tpxnmfcildfs uanmsn()altrxo tytfm r n i;t0 rtmim3nudlleelict tfarrmum ;o1aetomf3tadfa rluvs;(4 etnxo oo1la e ueo () 2um(o oudome mivt s  rtr( ont0tpenmoctltfs2ul(ms;(4alxoxfctatomD luvo t)srto(opiudole lnct sfsDumx pot4oex mociyt m uanvp u)altoxfcta1fpDe uesls) rtoiopno4omtelfei (  2ua(  ot0tptnioetyt sDulnvs;t4teeomr3tatoptr u o;( trtmxo nydlm elicsls)a2tmxmp;t0oet mfetas mDulnvo (4treomo oatomte u s t0 exrimpoydam elfvi sfsDtmxro;t4tptnmi3tatlmDranvsnt4aexnif3iydopD aiesls srto(o3nu1omt  neils sruau p;u1aexn ieiatla rl( s t) exrmo iy1fa  livils seuo(rpoodolenmfcsls  2ra(m nt0oltoiietadlm2rau o;(4treoxrcty1oat anesl(  2trxo oo1omee fvtls  Dtrxm ;t1oex ioeiys sDum(mp;u4tlermrctydlatr neo t trtoxrpio1opeemnes (  2rau pou4opt mo3iyslm ean snu0tetnmociytoa  lnvolt0sexmio oo1lmenlnvsas) rur(mooo4tex  i3taslm umnmon(0tlxrmoctytfa rai ils t2to(m oo4aleelicias s2rax oou0tpxomiciadla2rlnvs;u0alenio3io1late iei;t) rurxmpoy1ale mieilsf 2tmxront0aet mi3tydfa2rln p t)alenxocty1fmt aivsl()s2toxmpnudlmtn nvsa()srtau pnt4tpx ioctadlsDumu s u4artoxo ia1op rai ils) 2uo(m3nu1ol n nvsls sDtru  nu0ale mfctyd m rmn p;t) lerir iotoa eln s;(0sexmxm iodoltemfctl(f Drrx oou4altnmoctytfaDemumo u0aeermrcio1fmDe n il(0texmiopoodapt livsl()a2raur nt0aeenio3iasfa2rm( p t)arxnmo3oydfm ranei;t)trtm(m ny4lmtemict tfs2ta(mont1oltoiiciasfm raump;u0 lenmo3oydfm   uvi;s0s2xrxm iydoleelnci tfs2rr(roou4apxo fctltfa2eaump t0arxnxo tydoaDe ies (  eum(mpou1omtn icsatf 2uax oot4aeenifeilt m2rmnmsn() etrio3ty1fmt  uei s0teumiopnudamte fcs () rra(mpot0tlt ifciydla eanvs;u0arxniocootfaDe n o;t) 2xrir3oy1alt micsa()a2tmx p;t1olx mf3tad a2ran s;t0trtoir3oo1fm eaueslt0sexo(r3iodale  fvs (f 2rmuroot4open ietydfa2emnvont4 etnxo oo1oate ivols0 2xmxm nudllenlivtl()s2trxmpoo1tpe mfeiad a2ulump u0 etnxr tytlmD  neo s0 ruoxrpoo1ole  nciasf 2rau  nu0tpe iieildlm2ean p;() rerif oadomDrau s;t0 rtmirpio1olte nvt s)aDtr(rp;t4alt io3iytlaDrluvs t)trxomoctydla eauvo t  rtmim iy1am   nctas) 2uax pno1olx mfctydfa elu pn(0 eenxfctadopDeli o (0t2xmir iydll nmnvtlt  2taxr ;u4aetnmfciltfsDulumo;(4areoir3iodlpDran s;s)teuriopio4llt livslsfarrrxrpnu0tlxnii3tlsfaDemuvs;t0texnir oa1omDranvs s)s2um(m oo4lptn ncsls)s2ur(moot0tlx ifeiad m rlu o u0tlxomr ta1fptelnvo;() 2trxm3no1lltelnvt (fs2ta(rpnt1oltnmfetad m2uanmp t)altrir totomtelieo;t0 2toxopiydlptemnvil() 2raxrpno4aptomoetadlm2um( s;t) lxoiocoa1oa  auvslt sruoxo oo4lme mfeslt  rtrurooo4optn icilsfs2uan onu)arermo to1late nes;()s2umxmpiy4omeemnetl()srtaurp;o0aetnioeiad s2elnvs ()arxniocta1optrlu olt) 2xoim io1lmenlicsl( s2tmxmont4tee mf3tydfa em(ms;t0tetnxr3iadoaDr u sl()teurxo ny4omtelnetlt)srrru oou4apxomoeiyt a uln pn(4tleoxrcoa1optrluvs s)s2toiopoudaltn icslt)arrru poo1alt if3iltlm2ra(mp (4 lenmr3tytlpD aivil()srurxr3nudaptnlietl(fs2urx ooo1tee if3tatfa eanmsnt)alenmfctodfpD lu i s teuoim3nydol   icta(  rrax pnt1tlt  iciasls2elumo ()areoif tadomDr u i;s teur(m3oy1olenlies ( sDumxm oo4oltnmoetltlm2rlnvonu4trtrio oatfp e i ol(  2uriopio1llen fet t  rtau ont4aetnmfeiad s2umn o;(0aexrxf3tadfmD aneo t  rxrxmpiydomenlfctl(f 2taxmp;t0oee mo3tldlsDumu s (0aetoir3oy1lm r nes;s)seurxmpoydomenmnesls arraumono1opt  fcild m2ra( snu0tltoxocto1lat luvil(  rtrim3iydamtnmiet s  Dtm(ronu4opx mf3iydlaDrauvp;u4alerxf3iydfa ranei s s2xm(o nodlm   fesa( arumumo;o1opx mociltla2umn p;() rxnxfctadfptraies;()srtrim oy1lmee nvta( s2ur(mont1tptn o3ildfaDeanms;t)trtnif3ta1opDelivi;s)sexo(r oodlltnmfctas) Duaxm ou1tetnioetytfsDrl(vp;u) lxoxf3iatlp   i o t)s2xr(opiy4ape  nvta(fa2rax pnt4oeen i3iadfs em(vs (0tleoircoatlatelieil()srum(mpnydllenmfvtl( srrr( ont4aex ifcild a rl(mp u0alxoxo3ootlpDrlueo;()trtm(opiy4lm elfvs (farrrxmp;u0oeeo f3iad mDeanmp u)tlxrir3ia1fa eli sl()sruoxmpoodlptn feilt srumu pot4olxnmfciyd aDrau s;t0tlenxo ia1fpDr u s;(0sexmxr iydal e ictl(farrrurp;t4oetomociatfa eaumpnt4 etriocoy1opDeanei;s0s2tr(mpnu4lltnlnctltfa2rr(mpnu4ape moeils sDrmuvo;u4 rtnxocto1lptraies t0 rxoxm3iy4ap e ivia()sDumur no4tltnmociltla2rmn p;t4trerxfciodlpD lneols) 2to(rpoudaltnlneia(f Drax pou4aex iieiytlmDul(mo u)artrir iy1oat  n o t  rum(r3oodll  mnvs t)s2tmu oou0aex  o3ild m ul( pnu0trerir3oodlm  anvsls0 etoxm3iu4op  lfvsa(fa2um(r ;o0tlenifciysfm umuvs;()arxomr3io1fmt  uvslt0t2uoxo oo4olte ivtl(fsDurx o;t1aee ii3iadlmDua(vonu4alxrmo3totoa r nei ( trtr(o iy4apt mncs (faruru oot0openiocild s ranvp;u4 rtomfcootlpt au i s  2um(r oy1alenlfet ()sDumum nu4tlxnioctls m2emu pnt4tltrif3iydfpteauesls)seumir oudope lietl(f 2raxmont0texo f3tytla uanvp;t4 rxoio tadom raues;s trxr(o3nudlmt lictas  rraurooo0altnmietytlmDra( p;u4arenio3oo1oatraivo;t  rtmim nu4al elfvtltfs2umx  no4oleomo3taslm2eanvo;u) rxoiocia1fatrlnei t) 2tr(r nu1oltelfct (fsrrrxm ot1oetoiiciltfs2rau o;(4trxnxr3tadla rlneo s trtoio3iu4aptemivslt) Drm(rpou4alenifeiad m eaums;t) exnmr iydfpDelnvi ( s2urio ny4lp  mfvtl( a2ur(m nu0olx  o3iat m ulnvo;t4aexnxociytlm eaivo;( srxmim3oy4apt lfcs ()a2uaxr oo0alto octltfs2emuvo;u0 exrircoydfaD an s t seurio oo1opt lfesl( a2rax o;t0tet ii3iltlaDrauvonu4texnir3iodop eanvs;(  etoxr iudlmenlnet t)s2trx ooo0oee micildls2rlu s t)alermociydlm eluei s tetoio oo1ape lfctls)aDtm(  ot0aee ii3iys m uln p;()artnif3ty1fpDr nvo t s2toxo iy4lpen ivilt)arra(mpnu1opxnmoetytls2rlnvo u4tleoio3oo1lp r nvs s0sexrirpny4lpeemnvtltf Drr(r ou0tpeniieils m2rau s u0 rtnifciodoate i s;t  rtr(m oy4om n feiat)s2tr(rooo1aeen i3iltlm umnvo (4teermf3oo1lpDean ols s2uo(opoudaleemnvi t aDrmx oot0ole ioeiltfm umu o (0artnirctadfaDeai s;s0t2xr(r3iu1lp nmfciat arraxrp;o0opxo fciadfsDrl(vp;() exrxociotomD  i s;t tetmxm3nudol e nvi sfa2um(mp;u0aptn ictysla2rln sn()alenxf3io1op  aieo;t  exmxm nudlpt lietl( aDrru  nt4olxo ociys a eluvp (0tltrmfctydlm eli ol() euoiopny1apee neilsfsruaxr no1olt  fciatfs umn s u) ltoir3iy1fpt  nvs;t0seuoxopno1omen iesltfsDurxrpnt4tltnmfeias m2rlnvo;(4 lxrxr3oatfa elnvi;(  etoirpny4ll e fvt sf rtmxrpot4teenmoctatfm ranvsnu4 rermocty1la rlieilt0s2xr(o3iy4al nlnvslt  rra(rp;u1oetoioetatfmDra(mp t4 ltriociotfpDe ieo;(0 eur(rpiudol nlict tf 2uaxmoot4ape ifeiyslmDrlnmont4tlenmocoatlm  lnvo;s t2xoim3nu1om nlivtltfaDrmu onu1apt  i3iyd s ean pn(4 exnxo todlmteln o;s) exrxr oo4oltnmfvt t) rur(  ;u0oltniietys mDra( p;t4arxrxfctotoaD an o;t0texrirpiu4ol elfet (faDta( p;t1tpxnmfeiytla ul(mp u0tetrif3oodoate n i;()srxoir3nu4omtnlneils)artmx pnu0aex iociydfsDua(vs t) exnio3oodoa eaivi s) rtr(r nydopt livsa(  2urx onu4teen fetatla rmuvpn(4 rxomo3to1lmDrluvs t t2xm(m nu1lm   icta( a2rmxmpno0tlxoif3ilt aDel( pn() etnxr3totfp rlnvsl()teto(opoy1op  mfeiltfa2rmxmp;u4olxomf3tysfm2eanvs;(4alenio todopDeauvslt) rtmir3oydlle  ncsltfa2rmum ;u4apen f3ias m rl(ms (0tetnmociodoa rlues;t) rtoxopio1om nmiet s  Drr( pnt1tpe mo3ildls2rm(vp;(0 reoifciotfaDeaiei;t trurir3ny1omee fet s) 2um(rpnt4tpxnif3ias a2ua(vs;(4aexrir3iadoate u s;(0s2xmxm3nydamenmfcsat sDur(r oo1tlenio3ils s2rm(mont)tltnxr3iatoatrlneo;s trum(o3iy1ol  mfesls)arrr(m ot0optomo3ils a2umu s;()trerxocoy1omDr n ils)s2uoio iudlmtn fcta( s2tmxront4optoioeiadfm2rln p;t4arxnxf ty1fa e nvo;()trxoio3nodlmt  ivt (  Dtax  oo1oleoio3iltfs2emuvp t0 exrxrcoydop r n ols0t2xr(mpiodlp  livtltfaDurur ;u4tpe mfctysfa2ra(vp ()aexrmo oo1lat luei t) rtmimpoodope lfviat sDrru onu1tpt miciysls2ra(ms t)trtnmociydlp e i o;s0t2urimpnu1amenlfetat) 2trum nt0aexomo3iasls2ra(vp;t) rtrxr oy1oa elneo s0t2to(o3iu4ll  mfciltfs2raxro;t4ole ii3iysfsDeauvs ()aexrxo3tydoa ranvi (  2xm(r3no4ope mfeslt aDta( p;o1opxoiictltfs2uanvont4arxrxo3tytlaD auvi (  rto(m3nu1altelfviasfsrra(rpou1opx mfeiyslmDrm( p u0trenxrciotopDrliei t srtrir ny1amt mnes () 2ra(r ;u4teeomoeiatla rm(mp;t)tlermo ootoatelieols) 2xm(m3oudlltelnet tf rumum oo1tltnifeiltlaDranvp u0arxnxr iatfptr uvi;s t2um(rpiy4am  mneil(f rrau  ot0alt  fetaslmDumumo;t) rxrxrcta1latrau s s)sexriopou1amenmieilsf rrauronu4ale  iciadfm ulu p (4teerxociotom eli o () rumiopiodlleelnvtat s2rm(moot0aetomf3iytlaDua(mpn() rtoio3tatlat  nei;t  rum(o3oo1oleelnesl( aDtrxrp;t1tpenioetyd aDea(vs;(0teeomociodlp  aieo;t  exrxr3ny4ll   fvsas a2ra(r no1aee mi3tys a uanvsn() leoxo3iy1fa  au sls0texmxo3iu1ll nlnvs s  2rr(ronu0oee  fciat mDra(vo;(4tlermr oy1lpDr u o;s t2umio3iu4optnmnesls  2taxroot0apt if3ildlm2eau p ()artrxrciydlaDean il(0 2xoiopoo4apee ivt t s2umx  nu1oex ifeilslsDulu s;t)teeomo totlm elieo;()seto(m3oy1amtelnvs ( a2rm(mpou0apenmictld a2elu s;t4artrirctotfa  livslt)t2xm(opio1ol emfet ()sDtr(  ;t4teenifctls a ea( p (0 lenmr ootop eluvil( texo(r iu1lm nlivs s  Dtaurpnt0altn fcilt s emu o u0trxoxrctadoaDe ueils0t2uoxo oy1openlncta(faDrmxmoot1tlx  ieiyt a2ulu pn()aleoifciodom elnesls setoxr3oo4lp  mict (farrr(r nu1apto ieiad mDulumo;() rxrxo3iydopte iei;s0 rtmir3io1apen fcta( arrm( poo4ope  o3tad a2emnms;u)alenxr oydomt ai i;(  2xmio3no1lmeelictl(f Dumuro;t1aet  f3tltfs umnvo () rtrxr tytfptranvi;t0 rur(rpoo4olt lnet tfa2tmxr ot1apt miciasfs2rlu o (0aeeomr3to1lptranvs s t2xr(mpiy4lp nmnvsls s2rax  ;o1teen o3ild s2umn pn(4trxnxfctydoateaivols s2um(mpny1amtnmfvsat a2rru  ot4oltnioctysfmDrm( pn(0 lxomo3oadlpt  i slt  etm(opno1alte net t)aDrm( pou1opx ifeilsfm ranmp (0 eenifctytfpte nvo;(0texo(o3io4opeelncsas  rurumoou0ope if3iydfmDua( on(0altrxr3ty1la  lnei;t0 etoiopiudome lfei ( srrm(mo;o4teenmoctatfm elu s (0tlxoxrcto1fmtrauei (  eto(opiy4lpe lfcslt a2tmx p;o4oexnmoctlt a2em(vo ()treoxf todlpDrluvo;()sexrir3oy4lm nlnvtltf 2truroot0texnif3tat mDrlnmpn()aeermo iatop rlu o;()truoir3iudap n nvils)arrm(  ot0apxo ictatfm uln o (0trerxociodomD luvs;(0t2uoxm ny4lm e ivils srtax  oo4opxomietys sDrluvo (0altrxf ta1lat  ieo (0s2umir io1aptelncta(  2raumpoo4ole  feiytfs uanvsn()tlerifcia1latr i o;( t2uoirpnu4ol  lnei t) rrru oou0oltoio3ilt s2rluvs t0 exrxf iadoa  ai i ( sexr(o nodal e ncil( aDururpoo4apeoiieiydfa2ra(vo () lerxo iydoate uvol()tetoimpnudalenlfetlt)a2um(m nu0tltnmf3iytlsDemu on(0aexrxrcoy1lmte ieo;s sexrxmpnu1ll nlfvsls a2ta(r oo0tlx mf3iydlsDulnmo u0texnmf3todfaDr i i t0seumxr3oodalee fetls)sDumx  ;t0oeen ietat s ul(ms;(4 etrxrciytfaD  iei t truriopio4amt  nvsl(fa2tmxr oo4olenifeilslm2emnmsn(4 ltrxr3ia1opDean o;s) 2xmxmpny1apt  nvtl() Durxr ot1tpxn oetltls2emnms;t)arxrxoctytomteli i;s0teumiopnu4om nlfvslsf rur(rpnt4oleoiieils a rlnmpnu4tlxomociadlaDraneols)texriopnu1op elnet s  rtmur nu1oexoiicilsls2uluvpnu)areriocoo1oaD  neo (0setrio oy1lptnlfci ( arrm(moot4ole  ieiltfs ul(mp (0alenir3ootlm  auesls0srtr(o nu4open iei ()arrmumooo4aptnmfetldfm2uaump u4tlenif oa1faD lies;t) rxrxr3oodoleemfci t  2uaum ot0tlxnmieiytfm2ul(vo;t4tlxoircoa1om r uvs t) etr(opiodlmte fesl(  2ua(mono1oleoiictatfaDelnmo () renxfciydfptrlivsls trxrxo3iy4lpenmnctls)srtaxrp;o0aet  i3tysfs2emump t0arxrmf io1faDr uvs;s0 exmxrpoo1lmeeliet s  rra(rp;o0tlxnio3tyt m2rm(mont)aetriociydla r ueo ( sexmirpno1llte ivils  Dra(monu1aeenmociytfa umu sn(0 eenmf oadomt ai ils0 2tr(mpiudoptnlnetatf rumxmp;u0aex mf3iad s2rmn p u4teermrcta1fptr ivo ( trum(mpnudol   net (  2urumpnt0apxo oeiasfa2ulumo;(0altrir iodop raies;t0tetmimpiu4ap e ivta()sruaxm ou0tetnmictlt a2raumont4aexnio io1fmDrlnvsls0 rtmxrpiy4lleemiet (fsrur(ro;u0altniietltlaDeln s;u0aetoxf oa1lmDraueo;t0 2xmxmpoodlle mfesas artrur nt1alenio3iytlmDuln pnt0trenmr ootoa eaivi;t0sexmirpnu4apt mnei s srtau ont0teeo fctad aDul(vs;u4alxnxr tatfa r i i;s)t2trxr oydameemfcsatf Dtrxmpno4tlxoifciatla2uaumo;t)trenif ty1fm rluesls0tetoxr3iy1opt lnvs s srtr(r oo1tpen i3tytfs2rm( o;(4 rtoxf oytomD lueils  2urir iu4om   fctlsfs2ta(  oo4apxnmoctls sDumu snt4tltnmr3iydfaD lu i;s tetr(r3oudlm elnvil(fartrur nt0aee  oetydlmDemuvp u0teerif3iadom eauei;t0trumxmpnydom  mivsasfa2um(ronu0teenmf3iltfm2uln s;t4tleoxfcoydlm r ieslt t2umir3nydamtnmncta(f 2rrx pnt1tle iieiysfaDel(mo;(0teerxf oadfaDr i ols0trurxopoydlmeemnetlsf Dtruronu1alxn ietys mDuanmp u0tetnmo3iydopDrlivolt) 2xrxopou4op n nvs s) rrrum ou4aetomf3tytfs2rmu on(4texomrcio1lmt  uvslt0setr(m iudal nlict () Dum(mpnt0altoifciysfs2uln o ()aexnxf tytoaDean s ( setmxo3ou4ameelfcs ()aDra(rpoo1alenio3iatfm rlumo;u)artrxfctydopDrlieo;s  2xmxrpno4openmnctls) ruau  ;t1olt miciadfsDuaump u4 lxoxo3ta1la elieo s0 rxm(opiy4lmtelfetasf Dua(ro;o4aexomiciat a2rln s;t0 rxnir3tytfpDrlueilt0 etr(rpiy1al nlfvi ( a2uau o;o4apt moeilt s2el( p;() leoio oytlmt lu o t0srxoimpno4lpt  netltfarumu pot1tltomi3iadlm2ulnmp;u)altoir oytopt aneo t)t2xr(mpoudap nliei (fsDtau  ou1tetoifeiat s2rlnvp;t4areomr3tytom ranei;s0 2ur(r3iydlmt lfesat aDtrxrpoo1tpenmo3iltfa2ea(vsn() rermr3oadlmtr ueslt  rxrir3oo4oltelfci sf Drrxr oo4tpenmfetyd s rmnvo;u)arenxoctotfmDelnvs;s)srumxmpnu4optemneiat)arraumpnt1aexniietatfsDeanms t)arxnxr3oa1lpDeanvslt0 rxrxrpno1lp n fvi sfsDumur oo1alt moeild m2ul(vsn(0trtomr oy1oatrlnvi s0sexrxo3oo4ame lictl()aDumum nu1oexoiiciltlmDuan pnu)trenif3ta1faDe ieo t0texr(mpnu4am  mfcs s)artrur nt1tee moeiad a rln o u) rtnifciadlmDe ieo;()s2xrir3iydlp e netl( s2umxmpoo0optomoetad s2uauvp u4 rerir tatlm   uvilt0seumxopoydoltelfcils artau o;u0opxo feiydls ulnmsnt0tlerio3io1lpDeaneo;()srtmxo io1ol nmnvsltf Draump;o4oltnmociysfm rl( o;() eerir3oo1oa eauvs;t srxrxo ou1lp n nvi ( a2tr(mont0tee mfciltfsDumnmo;(0 rtomf3oo1optelu o;( teur(rpio1omt lfvi (fartru pot0aeenmiciad mDum( o u4arenmocootfp eanvs s0t2xmir nydale mfes (f rururpot0tee  o3tytls rmnmsn(4tlenmo oo1omDean s t0seuoxmpnodalen fvil(  rua(mpot0tlt  oetad aDea( pnt4trtrifciatfa  lueo s  2xrxm3iydalte nesat)a2tmx  nu1tltoii3tyd s2rl(vp u)arermr3ta1lpD auvo;t0s2tm(mpio1ap   feilt) rua(mo;o0alxnifeils a eau o u) exoxo ty1lmtrlivsls0 rxoir oy1lpt lnvi s a2ta(r ou1tpenmfcildfm2um( o t)arxrxf tydlptrlnes;t s2xr(r oo4alt lfetlt)srurxront4teto i3ilsfsDul(vsnt0 ltrxf3oadfpDr uvils) rxrxopnu4alt  fctl(faDtax  ou4aetnmociatls rmn ont4aeenio3iy1fmDr ieilt0sexm(m iydlpee nvia( arur( ono0aet ifctlsfaDumumpnt4trerxr3iytopDrlu ol( teto(o oy4ameelicsat srtr(m ;u1altn o3tysla umuvo;(4 rtrir to1lptr ueo;t  etoir nudaleeliei (fsrrmx oou0oetomi3tld m rlnmo;t0trtnio3io1fp r nvo;t) 2umxm3iydlptnmnci s srur(m ;o1alxnmiciltfsDrl(vs u4teermf3oo1fptelnvsls0trurir3iu1lmtnlfctatfa2ra(rp;t0tlxomo3iytls2rmn s (4altoir tydoatr ivs t)sexm(m3oo4aptnmfet (fsDtaxmpnu0tex ifciys sDra( snt4tleomo totla  aivs;s0t2tmir3nodapeelnes ()a2taxm no1olxnmiciatfa ran p u4 lxrxf oa1op eaiei t teuoxopiudam e ncta(faDuru onu1olenioeiyd a umnvsn() rxrxfcty1opDrli i s0 etoxo3oy1ale  fes tfsrrrurp;u0apt ifciytfaDrluvs;u) eermociotfmtran i;( s2um(rpou4ape  fcsa( arta(m ;o1opx  o3iyt s2rl( o;u4 exrir tatoatrlneils)t2tr(o no4al nliciasfsrtm(m nu1tpeomiciadfsDuluvp;()tlxnif3tadfpDe n ol(0 etrirpoudal nmfeslt) Durxront1tpxn fetld a uanmo u)teeomo iytfa elu o;s)setoxopou1lp emiviat artmxr no0aeeo i3iadla ea( p;t4aeeomo3totfpt anvol() rtr(m3iu1lm e fcilsfsrraxroou1oee  i3iadlaDumumo;t0trxomf tadlmDe uvi;(0sruoim nodopee fvtl(fa2tmumpnt0tpe  i3tys s ul(vs (0arenmo oydfmDeaneo;s  2uoio nu4om nlfetltf Dtaump;t0tlto fctadfm um( o u0aexoioctotopDe i ilt)s2uo(opno1lptemnvtlt)aDtr(  ;t0aee if3ild s2uaumo;u4 rtrir3to1lpt lnvilt0 etoio3oy1alen iei ()aDumu pou1apx mfcilsfs2uauvpnt4 rxoxrcoydoat  n s s s2ur(opio4lp e fvsa() rtmxr nt4opxnifciatlaDemuvsnu) rxrmfciatfm  liei t0trur(o iodlmeemietlt  rtaxmpot0teto fctydla umu s (0 rtrxocoydfaD  ieo t setrim oy1lmeemfvsa()sDrru pou4oeen o3iys a2emu onu0aetomoctodlp   u o (0 eurxr3oo1omenlfesa()a2rmx poo0alx mfctldla2ra( snu)aexoxr3iatla r n o t0 rurir oodomte nvt s sDumx poo0oeenmi3iasfa eaumsnu)trxomr iytlp eau s;()srxo(opny4lmeemfciasfsrrrxm ;t1apx ifeiyslm2uanvsn(0tetrio3totfm eai i s0sexrim iu4lm e icsa(f Dum(mpnu0tpxnmocilslaDrmu o u)texomfciytlmD ai s t0 eum(opnodol nmieilt)a2tmx ont1oltnmiciys a ua(mon()aeeomfcty1lp rauvsl(0 ruo(m3iy4aptelnei tf Dtrx  oo4olxo o3ilsla rmn ont4 reoifciatoptelnvi;s0 2ur(o oo1lm  mfei ( s2urxm ;o4apt mfctltlm eaumsnu4teerio3ootla elieo ( texo(o3oudll emivsa( s2rm(rp;u1olt io3iysfsDra(ms;t0 exrif3iodoatranvs;()srtrxmpiu4ll  mncils)arrr(m nt0tlxo f3tltlm2eaump u0artrmr3iytfp eanvo s) euoxm no4omtn iesasf Duaxr no1teenio3iys m rlnvsnu4tetrif iodoaDeliei;t srtriopnu1lle  fcsls)s2umxrp;t1tpeniiciatlm ul(mp u4aeenir3tydlat luvilt0trumio ou4oleelici t) rumxroot4tptomf3iltlsDeanmont)altoio3io1oatrli sl( texo(mpnu4op nmivtl()arrmurpou0oetomiciat m2emnmpnt4areoxocoy1fm  au il() rum(mpiu4omtnlfviat)arrm(m nu0tpxoioctlt a elumo;(4texrio3tadlmDrlieilt) 2xmiopou4ome mfctas s2tr(r ;t0ape iocilslm emnvs ()alermr oodlaD  ies;s seuoimpno4oltelfes () 2ua(  nu4olxomo3iyt aDul(mpn(4alxomfctotfate n ols t2toim3oodal  mneiat) Durump;t1oexoif3tltfmDuln s u4 leomo3oytlm  lnvol( t2urio3oydape lfctasfa2rax ono4oeeo i3tatfaDeanmpnu)teeoxo3todlpt  nei;()t2to(mpiu1opte iei ( aruax ont1oetn ociasfs ulumpnu)altnxr oodfmD lies;s  2tmxo3io1ome  ncs s)arur(ront1alto fciadlm2em( s;t)trerio3to1lpDr u olt) etr(opno4oltn ncsa() Dra(  ot4alxomf3tat s2elumont)tetnxf ta1fpDe i o t0trtoir oy1amt lneils)a2ur( onu4olxomf3tad a2el(vo;(0 reomo iotfmDr nvs;s0 exr(r iu4lp  lfvtlt)a2umu pou0apxoifciat sDeluvo;t0alxoif3oodfate u s s0tetoimpio1alt mfvtl()sDtmxmpoo4tpx mictysfmDeauvonu)texnxr io1fm   nvs;t0s2ur(m3oydopte fvs t) Dtaur ot4opxo feiltlm2ra(mp u)trtoio3iydlm elnvi t0 exmiopno4alt  ieiatf Duru o;t0oeen f3iat a ulumon(4tetrirctytfatran o;t)texrim oo4openmicta() rumxrooo4alto o3tysfa2eaumont0tlxrir totlm rlneol(0t2tmxrpno1am nmfvia( a2rm(m oo4aee mfciyd sDuanms;() exnxr iatlmDe neo s)s2xoxo oudaleelfvtlsfa2rrx poo0olxomo3iys a rmn p u)trxrmociatom ran ols)srxoxo io1lltemfvsat s2umumpou0apxn feiysfmDumnmpnu0alxoxoctytfptrln i;s  rumxopio4openlnvt (fa2ur(rpnu1oex  f3iydfm2rlnvo;() rxoxf3iydlmtelnvi t0 etm(rpiodlp  lfetls a2rr(mono1texo f3tadfsDum( o u0 leomr3iotomD ln o;s  2toim nu4oltelnvtl( arraumpot1tptoiieiytls2ranmsn(4 exnio3iadfaDe ivols)trtmirpou1ll e netl(fsrtm(mooo4teeoioetld aDem(vpn(0tltomf to1latraues;s)t2xrxo iy1lmtemivtat) 2tmxm ;o4tpt ii3iydfa2rluvo u4aexrmf3tatfat aivslt)s2urio3oydoleemnvta(  rra(rpou4aleoioetysfa2rau p (0alxrxrciodfm rli o;t  rto(r3oo4ap nmfcs ( sDtmx ont0tlxoifeildlm um( s t)trenif3oy1fpDeaivs;t teurxo oydom n ies s) Dtax ont1olxo ieiytfs uanvo (4artoif3totfmtelies s seur(o3oy4ol n fvilt)arrrum ;u4olenio3ias mDua(mp t0 etrmo tadoatr nvo s0 etoir3nu4lp nlfvt t  2tmuront1tptnifciysla ra( s u4 eenmr3ty1faDr nvols0srtr(o3oudape  fciltf Dtmu o;u0tptniictldfs2ua(mpnu4treoir3ootoa ean i ( t2um(rpiy1op e fvilt)aDtm(mpnt1oexnmo3tlt m emn s;t)aexoxrciy1laDe nvolt) rxrimpio4ale  ietas)artrxmo;t4tpeoii3ildls rm(msn(0tltnio ty1lm r nvils)trxm(r nodole lfei tfs2raxrono1oet  o3ildlmDean p u) rtoxo3iodoat aivo;t)t2to(m iu1lpenlfvs t a2rm( ont4alenmf3tysls ea(vo;(4 eeomrctodlmtelies t) rtrxo3iy4lptn ics s)srum( oou4tex ifetldlm2ranvp ()trerxoctodfa   ueo;()t2trxm oo1altnlfcilt)sDta( pnt4tlenif3iltfm ran sn(0aeermf iotfmDeau s;s)truo(m3oo4lm n net ( sDtmu o;o0apeniieiasfm2ea(msnt0tetnxo3iytom eaiei;s)s2trxm nudopt mfei (  rurx o;t1aexnifeiadlaDel( o t0trermf3ootfa  auvol( s2uo(m3oodol n ncs t) 2rrumpoo1apen fctydlaDra(ms (4arxrmr oydom ean o s0 exm(m no4ameemnviat arrax oou1oexnmf3iltfs umnvp u) eermrcoa1fptrli o t) exoxr ou4op emfvia(fsDtm(rp;u1alt  i3tls a2elnmo;()tltrirctotopDelnes ( trxoxr3no4ll  lfetat)a2ua( ooo0olxomfeildlm2emums t0trenxoctodlp eauvi;t)texrxmpoy4omtnmnes t arum(rooo0tex ii3tytfa um( snu4 rtnir totomDr ieil()t2xrxr no1lmt lncil( aDurxr oo4tleoiicilslsDra(ms;u)altoifcootla ranei s)t2toio oydam  micia( sDtau ono1teen feias s eaums (4 ltomfciy1lpDrauvolt0t2urim iu4op nlicsat) Dtaur no0oeeomf3tatlm ea(vo ()arxoxr3io1omt  n o;(0texr(o oo4ap e nct (fsrrrxm ;o4teen f3iydlmDem(vo (0trerir3todlpDe nes;(0texm(opoo1ope lici s) Dra(  ;t4tpenmfctld m umn pn(0artrmo iy1fmD li o ()trxm(m3oo1opeelivsl( arrmur no4aeeo octls a uan pnt)aeeomfcoytom rlnes;s0seur(o3nu4optnlnvta(f Draur ou1optoiiciad m2ean snu4 rerxf3iodom e nei (0trxrim oo1llenmfesls  2ur(m ;t4tet iieiysfm rlnvs ()aetrmr iadfm raies ( trum(r3io4apenmnvs tfsruaump;o0tle moeiad a ul(vp (0altoirctodlpD au o (  rxmir3nudlme lfci ( srtaum ;o1teen ociys sDem( pn(4aetnmrciatfaDeluei () rxrxrpiy4apenlfvs sfarumu  ou1tex mfetysfaDua(vsnu4arenmrcoatopteaueo () 2trxrpio1ll nmnetasfaDrrur ;o0aptnioeiysla2rm( p u0 rtrmrcty1opt auvs;() rtoxr3oy4oltemnvta(fs2tmur ;t1aeeomoctaslmDrmn o;()aexoxocio1fmtraivs;s) 2tm(m nodlmt mics t  rtrump;u4aeeniieildfm ea(msn() exrxoctytfm r i o;s t2xr(rpiudlp e ivsl(  2ta(ro;t1tpen fciytfs eaump;(0treoxo iydlpDr i i;()teurio3iy1lp emiet ()sDumumpno0tlto f3iys m rlumonu0tlxrxrciydoaDrluvi;(0texoim3nu4olen nctlsfarumum ;u0openif3iys m ranvs;(0tlenxo tytom rlivs ( s2tmxopoy1al nlfvtat)sDrm(rp;t1tpx mo3iytla ua(vp;t0treomfciydop  lnei;(0texrxo3ou4lmtelfct t)s2rax pnt1aee mo3tydfa2rl(vp t)alxrxr iodfp e n o s0s2tmxm3nodlm nlivsl(f rraur oo1tltniociyt sDean o;()tetoir oytfm  li slt0 etrxo3iu4lmeeliet s) 2uax  ot1opxn fctytlm ea( pnu4alxoir3tytop  lu sl( srtmxm3nodom  lnctlt) Drr(r no0aeeniociasfaDea( on(0tlenirctatopte ueilt) eto(r oodopeemnctlt s2umu o;t4tet if3iatls2um(vs;()aeenmfcta1lm  auvol(0tetmirpiodlpee ivslsfarrmx  nt4aeeoifetat a uauvsnt)texoxr ia1fmtrliei;t0trtmxopno1apenmnctl(f Dtrxronu0aptnmoetad mDranvon(0tetnxocoadfaDraivs;()t2toir nodop  mnvta(  Dtmumoot1aleoii3tldfa2umnms u)aetnmr3iadfaDe i il(  exr(m3io4lleelici tfa2urump;t4tlt  ictat s2rm(msnu4tlxnxfcoy1lmDelu s (  2um(r ou1ameelivias  2rm(m ot1oee ioetyd sDemumo;(0 reoxo3io1fat lu o s  eumxrpnu4lpe  nctasfsrrr(  ;o4apxnio3tysfa em(mpnt)treomf oodom  lieslt)s2ur(o3oy4lpen fvs t srum(ro;u0apeo ietadfm rauvs u4aexnxr3ta1lm eaues (0sruoxmpou1lpenmietls  rrmx oot0tpt  feildfm rlnmp u) rxnmfcio1opDraieil(0seumiopno1omtelfci (f 2rm(roou1aeeniociltla2rauvpnt0trtoxo3iadoa eaivi;s)t2xmim3nydomtnlfct t  2tmx pot0opxn ieiyt a2elu pn()areoif3ta1op eanei s) etrxo ny1altemneil(farrmuro;o4oleomoctlsfaDelnmp t0tltnxf iytla elu s (  2trir3io4llee ietl( sDta(r oo1aleomoeiatls ra(vo;(4trermr oadlmtrlnei (0 2xrim3oo4ole  fct s) rraxm no1opxoiieiydlm2eanvs ()arxnmf iydla   nesls truo(rpoo4omen fesl() Dtrxm nt4aeeoiieils aDelu s t) exriocoytlpDeaneo;t texrimpny4lm  lnct (f ruru  ou0oet  feiyslmDul(vo t0areoiociodfpDr uesl( t2umio3oydalenlfet () Drru p;t4oet mi3iasfsDeanvpnt4 lenxo tytlatranvilt  eumiopoydapen ivil( aDumum ;t1tptnmf3iadlsDuluvp ()aeeomfctytlp  aivs;s)srtrirpoudlpe lfct (f 2umxrooo4oetnio3iltfaDuauvs;u)aeeoxf3iodfmDelivol(0texo(m ny4lp  mnes s)sDuaurooo0olxo feilslmDrl( p t4aexnmr tytla   iei;t)s2umxr oo4lptelivtat)arraump;u1aptn i3tadfs ea( snt0 rxnio3oytomDrluvi;() exoir3io4lpe  nvt t aDrr(  ;t1opxoiiciydlm2rl( onu)arxoxrciydoat auvol() rtoim iydlpt lictas  2trumpnu1teto oetls m2uanvp (0aeenmf iodlpD aivol(0s2toir3iy4altelfvils sDtr(mpnu0opeoioctas s2emnvs t) rxrif iodfaDe nei;s)sexoxmpnydlltnlnct sf 2um(mpoo4alx if3ilsfsDea(vo;u) renxf ta1opt  uei s)s2umxm ny1aptn ivsls)s2tr(mo;u4tpxnmietaslsDul(mp;()tlermfctatlpt  i olt t2tm(rpnu4lpenlfcs t) Dtaumoot4tptomfcild a2umu p;u4tlxrxf3ia1omD  ieo;s  eur(r nudalenlnci ()s2ua(mpnt0aexoiicild m2emnmo;t) lenmr3oodoa   ieo (0tetrimpou1ll nmicsa( aDuaumpnt4tlxomoctyslm2emnvo;t4 eerxo3iadfaDrln sl(0 rumir3iu1ap   nctatfsDraur ;u4tpenmfeiytfs2umnms t)tetnmr ootfmtr n i;s tetm(o oydap emfvtls srrmump;u1tptn i3ilt m uln p;t0trxrxociadlpt luvi s  2toirpou4lmtelfesas sDur( ooo0olxomoetlsfs2em(monu4tltnmrciatom rlies ()srxmio iy1ale  ivslsfaDtru oou0ope iocils mDeaumo;u4 exnxf oy1fm elu o;s0trxrxr3iy4lm e fcias)sDurxm nu4tee  fetltlmDemu pn() exrif oatfpDr n s;s)s2xoio3nu4ope mict s aDta(m oo0apt ioeiadfa rmnvonu)texnmf oatoaD li ils)sexrio3ny1llt lfvsat)sDrax o;o4tltomf3iltls2ra(vp ()arxoir io1lm rlnvo t seto(mpoo1om  liet sf 2umx  nu4aleoifeiltls2um(msnt)aeermfcty1lat auvs;s  euoiopio1omtemncilt)s2rm(r ;o0oee  icilt s em( ont)tltoioctadfpt  nvsl(0s2umxr no4om   fcs sfsrrrxmoou4oexo f3tldfa2ea(msn(0texrxf3iotlaD livol(0tetm(r3oo1ome  net s)aDum(ronu4aleoifeildfmDeln p;u)tleomr ia1omD aueo;( texm(o3nu4lpte ictas)aDrr( p;o4optnmieiys m2um(mpn(0tltrif3ta1oaD lnei;() eur(mpoy1ll   fvtas) 2rmxr ou0tlxnif3tys mDrmnvp;(0aleoircty1la e iei ( tetoim iu1lpen ncsat)aDtrum ot1oetoii3iad a umu o;t4trenxo tadfmDe i o;() eto(o3iy1aptnlfcs sfsrta(moot1tlt mocild a2eanms;(0tetoxr3tatla e n o ()sexoxo nu4op n nei sf Dumumooo1olx io3ilsfa eln snt)areoxf tatomt  uvs (0 2tr(m nydom e icslt s2uauro;u0ape iieilslm2ran p;u)arxoxrcio1la eaies;(0texmxrpoo4ome lfcs s) rtau pnt0tltnifcild s rmnvont)aexnmo ta1om rluvs;t0 rtmirpiodlp nlnctlsfsrra(rpnu4tpxo oeiysfa ranvs u0altrmo oo1fpD ai s;()srurio iu1omtemncs (  2ta(rpot0teto ieild s emn onu0 rxriocoadfmtraivilt t2xmio3ou4ll nlneilt arumx o;u4opx  o3iasla2uln p t4 leoif3ta1fmDeli i;t)s2uoxo3no4omeemfctltfaDtm( oot1opxo oeiltla uauvsn(0tlxomociadla  auei t srxmxo3iy1amt mfesat  Dta(mp;u0texnmfctad aDra(ms u4trxnifciy1fm  ai ilt seuoirpoo4ll nlfes s)srrmurooo1optnmocils a eaumpnt)alerxf3tadomtelneolt0s2to(m3iy4lp  mncsasf rta(m nu4alt  f3tas s2rmnms;u0tltoiocoadomte i o ( t2uoir3oydlleelfvilt  rurxmpno0teeomoetydlm uan o;()aeeoifcta1optrlueol()trxmimpio4lm   ict s  2tm(r nu1tltnmoctlt a ulnmsnt)artoxo oo1omte nei s srur(m3oy1lpee nvi sfaDra(root0tet  o3iadfm2um(ms;()areoxf3iy1fpt lueo t)srxmio nudll   fctasf 2taum ot4oleniiciatlmDumnmp;(0alxnmrctodoatelnes s trxrxr nu1lp e fvsas srurxmpoo1olenmfcilsfa eluvo (4arxnir to1fmD  i ol()srxrxrpiy1amtnmfct t)a2ua(mont0optniocils m2ul(vp;u) lxomr3oydomDrlneilt0s2xmxrpiodlmt lnvs s sDurx o;t4oetnmf3iyslaDrau p;t4tlxoio3oo1laDrlueo;s0t2xm(o no4lle lnet sf 2tr(mo;u0tpenio3ild m2uanvs u0 rtnxo iotla e ieil( trxmir3iodalenmiesltfs2ur( p;o0opx io3iyd m2rmnvo;(4trenxr totfmD aieil(0seto(mpiudll nmnvs s) 2rm(mooo1tex mo3tysfaDuau snt) renmo oydfmt  u sl()trxrxr nu4ol nmfet sfaDtr( p;t4teen ieiydfmDrln on() leoxociy1laDr ueols0 2umxmpnudapenmics s  2rrumpno4altoii3iysfmDrauvp;(0 lxoxoctatopt aivi (  2ur(o ny1apt lfvt ( sDum(m ;o1olen fciltfm2um(vpnu4arxoiocoodlaDeln i ()srxmxrpnu4llenlnct tfsrtm(  nt0aexniocilt mDul(ms;(4aexoxo3oydfp rliesls) rumiopiy1olenlnvsa(  rra(  no1teenifeiyd s2emump;t0alxnircoydfmtr ieolt  2xr(m ou1lptnlieta( s2urxm nu0oetn ociysla2rl(vpnu4 rtrmf3tytoaDe ieolt0sexo(o oy4oleelfesa(f Duaum ou4aexnmf3iad s2ul( p;()arerifcoatoptranvo t  2trim3oy4omeelfvsl( sruaur ou1oeeo icild a rlnvp t4 eerir3oatop eaieo;s)t2xoxm3ny4apeemiesl()s2ta(r ;u0aexn fetyd s emnvo;t4 ltoxo todlaDrlueo t trxrxo3ou1lp nmfctlsfsDtmu  ;u4aetomfeiatlm2uauvo u)aetomr ia1fmteaueols0trxmxr3iydll   fcsls)arrrxm ot0teen o3iyd s emuvo (0alxrmf3iydlaD anvo t sruo(o3oy1oltelics t)a2uru  ;t4alx  ictysfs2rmuvp (4 rxoxociotla eaueo;t) etrio3oydaptnlivtlsfsrrr(rpot4alen o3ilt mDeluvs;t4 eenif tadlptrlues;()sexmim iy4amen fvtls)arum(mo;u4ape mfeias aDem(vo (4artoxf3totomte nvsl( s2xm(m3oo4omte nvta()a2ur(  ;t0tpxomictatla uan s ()aexrxo3iydoatraivols)t2tmim no4op nlncsa(fs2rm( o;o1alx mfetyt sDumnmsnt)tlenmrcoatlm rluvi;t t2ur(m3ny4amt mictl( arumxronu0tetoifctadla2ua( s;u4tetoio3iydfat  n olt)t2umio nu1llte ivs t arta(  oo0oexoiiciyd mDeauvont) lenxf tytoaDrauvo;()teuoxopnu4omtnmncs t) 2uru oou1texoifeiltfm2ra(mo;u)tltrif3oo1fm rau o;s t2urxo3ny4aptemfvta(fsDraurpou1aleoifetlsfa2rau s;()alxoir io1lpDrlnvsls s2umir3ny4amee ietls  Dtrur nu4aeenmoetasla2ean pnt)teerifciodfm eanvsl( texrio3iudalt lncsat)sDuaum ot4oeeomf3ilsfm2el(mo t0 etnmoctadop r uvi;()t2uoimpno4llenmivilt arrrumo;o0aexomieiaslm el(ms u)tetnmr ia1faD anvslt  rxo(m3ou1om   feslt sDrrxro;t4texniieilsfs uanvonu)arenmrcootfpD  i i;s0 2umim nudop e ies t)aruaumpnu1tlxoifctld s2emu o t) lerio iy1omD  n s;s0setmir3nu1lpeemivia( a2raxrp;u1olt  fctat a2emumo;(4 rxrxf3oadlat auvo (  eur(r iy1optemiesa( sDrrur ot1tpto oeilslaDra( s () lxrmrcto1faDeaivils trxr(mpno4ale mieils srtrxm ;u4oeeoifeils mDrlnvp;t0aetrmo iotfpte u i ()t2urxopoydomtelfcs sfs2tru ooo4tptn iciatlmDrmnvp (0tlxnxfciytlptrlnvs;() 2tm(o iu1alt mivilt  Dtmur ;o0tlen ieiydfs2uln o;t) ltoif3tadom elivo t0 exm(rpiydope lfesas  rtrump;o0tpxo ieias sDemuvsnu0 ltoio oy1lm  ai olt tetrimpiodapteliet (fsDurxmpno0oeenif3iydls2eau ont4areomr3tytop r i slt t2urxo nudllt  neta( arrm(rpot4apeoifetaslm rm(mp;t0texrio3iytomDeauvi t  ruo(rpiu1omen fvtat) rumu p;t0oltn ietas m2eanmsnu0tlxomo ootopDelieilt srtoxo3iudopte nvias  rumurpnu0aet  oeiat s2emu s;()altrxo3iatlmtelivi s)t2uoio3iu1om nlncsl( srurxmpot1tpenii3iltls2rmuvpnu4arxoxr3todlmDran ol(0t2tr(r iu1ameemncs ()arumxroou0teeoiietydlm ul(vsn(0alxrxr3oatlmt  ivi;()tetr(r iu1lmtnmiesasf rtr(m no1texn fcias s2eln o u0altrmrcta1lptrluvsls seurxo ou1aptn nctl()a2um(rpou0olx  o3iltlsDeaumonu0trxnxf tytlpteauvo t trxmio iu1apt  iesat)aDrrxrooo0tex mi3ilsls2rlnvp t4 etrxr ia1fat lnvs (0tetoim3ou1lp n feiat) Drru onu1aetn ociydfaDumn p (4trtoir3oo1omDe ues ( setmxr3nu4oltn nct s) rrmx  no1oexnif3ilsls rln s t)texnioctodfaD  i s t0texrir oy1ame mnetas)s2ururp;u0tlt miciydfs eln snu0alxoxo iadfateaueols) 2uoxm nu4opt  fvil(  2tru ono4optniieiys mDumu s;u4tetnxo ta1omt anvo (0 rtmxmpoydoleemivias)srtau  oo0aeto ictatfm2el(msnt)alerio oodfat lnvi;()sexmiopiu4alen nct s  Dum(moot4tlxn feias m elnvon(0teeomf ta1omDe ueo;t  ruoxm ny1lptelfvias aDumxm ot1apxn f3tld a em(vp t0 leoiocta1om rluvs;s)s2tmxr oo1ap  lfct tfartrxmono0ole iietatfm ran o t4tetnmo3tydfpD ln i;() 2tmxo nodom n fcilsfs2rr(mo;o4opxnifciadla ul(vsnu0 lxnxr to1fp r ueo;t  euoxm no1llee ieia(fa2rmumpnu4tptn ieiydla2elu on(4arxnmociydfmD auvo t trto(r3no1opt  fvtat)sDtrx pnu4tpxn ieiydfmDulnvp;(4 lxomf iy1oate u s;t0t2umxmpoo1omenlnci (fs2um(rooo1tlt  fetlt s ulnmpnu0arerxf iydlmDelu i;(0texoxr3iodame lnvs s  2rr(mp;u4tleo iciltfaDrl(vpnu4arxomr3iatfat  ueol(0t2xo(rpny4apte nctas)arrau  ou1olen ocils s ua(msn(4 rxomo tytopDr u ols0teuoir oydamtelfctls  2um(monu1texnioeils a2rauvont4trtnxo oa1oaDrai s;s0srumxr oo4altemfci t arraxm no4opx if3iatfs ea(msn(0tetnir ty1op  auvsl()seto(opiodopte nvi () Drmx p;o4opxomi3iadfm2uaumo t4aeermoctydlaDeauvi t)t2toxr ny4ll emfci ( s2umx  nt0oltn oetldlmDrlnmsnt0teenxf3to1oa e i sls0 2tmim3io4apt  feil(fartm(r ot0oeen iciadfm eau o (4treoif iotlmD auvs;t0 2ur(o3ny4lm nmfcsa(  Dtmur ot0aeen oeiysfm rlu sn(4 etnifcty1lpteli ol(0 exm(r3no4altnlfes (  2trumpoo1tet  f3tasls2eauvpn(4tleomf iadlaDrluvi;( setr(m3nodllt mies (f 2rmxrono1openmoeildls2rauvp u)alxoxf3ta1faD  i ilt0seur(rpnu4om elfvtat)aDrmxm nu4teen ieiyt a2rmu o;u4trermf tydfmDrli olt)seum(m3io4ol nliesl(f 2ua(mpnu4oleo ieiyd s2ul(mo;u)trtomr3oa1fatelivs;t seurim no4ol   nvilt)aDrrxrpnt0oeeo fciadfs elnvp;t)trenxf oatlmDe nvo;s0srtoxr iu4ome  ietat)a2tmxrp;o0texoifeiaslsDemnmpn(4 reoxo oydfpDelu s;( t2umiopiu1amte ict t srumu p;u0aee mfciadfs umumpnu4tlxoiocoadfaD livslt0 rxoio3iudol emfcia(  rrm(m nu1openmictysfm ul(mont0artrifcio1faDrli i ()texmio3iudolee fvsls) rraxmpnu4ope  iciatfs ra(mp t4trxrmr oy1opDeaneo;() exoim3nydap  mivs ()arumumpoo1opeoio3iltfm umn s;u)trtrmo3todfpDeluvslt s2uo(m3ou1apt lfei t arurum ;u1tpenifctys s2eluvpnu0aeeomr oo1omD auvi t0 etrim3nudoleemnesa( aruru ont4ole io3iyd a rlumpnu4 etoxf iadlmDe uvolt)trumim3oudop  lnciltfartr(mpnu1tpeo octldlmDelnvs ()aexnif iy1la rln i (0setmirpnydlpt  fetlsfs2ta(rooo4apx iociltfaDuan p t0aetnmr totfaDrln i;( s2tmiopoy1optnmnvilt)aruax  ;o1alt  oetydfm ulums u0trtrirctotfmDeluei s0seumxrpiu4omt micsl()s2taxm oo4opto feildlmDul(von()tlxoif3oadlmD luvs;t trur(o3ny4op n fetl()sDraxroou0aet ifciatlm2rl(vo (0alxnmo todfmtrluei s0s2tmio3oy4al elfesat  ruaumono4tpxo ieiasfs2emums (4 lermr3to1fmtr nvo s srxrxopny4al emnvtas)aDta( oot4olxnmi3tlt a rl( o u4artnmo ia1lm r u i;s trtoirpoy1lptnmiesat)a2raumo;o0aexn ieiydfaDrm(msnt0altoif ootomDr ivils0sexoxm3nu1lpenmncsa( arur(  ;u1alx  ieilsfmDraumo ()teeniocootfa e iei s0trxrim oo1omtemfcs (f 2taumpot1oex  octat s rmu p (4altrxr to1lptraies s0 euoir3iudllte fctasfs2ur(  nt1apxo iciltls2emnms t) rxnif3oatfpDe nvs t trtrxo3iy4ll  lfvi tfarur(mooo0oltniiciytlm2rl( sn(0alxoio3oo1om elivi ()srxr(o3ny1lmtn iei sfaDrrxmonu1openifctldfm2ul(vsnu0artoiocoy1fmtrlu s t0t2um(rpou4opeelici tf Dta(rp;o0tle  iciad m rmnvo;t)artomocoydfa rlnei s)s2xo(o oo1ap nlfvtas)aDumu p;t0aeeo fciaslaDeanvs;t)tlermfctotopte i o s)s2toir no4amt  ncsl(fsrta( pnu1tpxn i3tadla rmu o;t) rxomf io1fm eai i;()teumim3no4llenlietatfartmuroot1aleomfciysfsDelump;(4aeeoioctadfptr ivo;s0 rtrxmpnudlmeelfes t)a2urx ono1tlt mieiat aDemu s;u4 etnmr3oo1latrlieo;s sexo(o3nu1ol elfvs s arrmx  nt4tlt mf3ildls um(msnu)alermr3iotom rlu s;(0s2uo(r ny1ll nlics ()srraum ot4tlxoifciltlmDranms t)altniociadfmDelueo t0 exo(mpiu4op n ivt t)arururono4ale ifeiadfmDrau s;()tetrmf oo1lp   iei;(0 etmxr iy4aptelnvt t)arrr(  oo1olenii3ildlaDrm( o;u)arxoxf3tydfatelnesl() exmxm3io4lpe  neiatfaDra( ont1ope iieiysla2umu s u4 lxomrctydopDelivsls trto(o oo1amtemfesas)a2raxmont0oeenmf3ils a2rmuvp u0trxomo3tydlpDe u sls0trxrxm3nydomee icsl() Dra(root0oet  feiysla2ea( s ()aeeoif3tytomDeanvslt truoio io1openlnci (faDum(rpoo1opt mieiadlm2emnmp u0 ltomf3tytfpD ln s;t  rum(r3iu1lm   neiatfs2rmur nt4oex  fctlt a ra(ms;t4texnxf oatoa rluei s setmimpiydale lfctlsfsDum( pou1texnifctatfs em(mo (4aetrmo ia1omtr i ol(0 rxr(o io1altnmncsasf 2rm(mp;o4tpx  iciyd m emnmsnu4trxnxf todfat  nvs;t  2xmiopnodll nmivtat) Dur(r nt4opeoiictydfa2ulnmsnt)areoioctotlatelnei t)trtoir3iu1lleelneiltfsrrrx  ou4alt  ieilt m2ua( snu)artomr oatlpDrai s t)teto(rpnydop   ivs t a2tr(mp;u0ape mf3tlt a rmnvo;(4areoxo iatlmDrlnvil() etoir nu1ameemivsl()aDtaur ;o0oexo fctaslaDea(msnu4aexrio3tytom  auvs s  etmim nodlme lfeil(faDua(r nu4tlx mociys a ulnvs;(4aeeomrcoadlpt  ivolt) rxmxr3oydop elnvsas)s2urur nu0aexnmf3tltla emuvp;t)altoxrcia1latrauvo s0s2umirpno4lle mivt t)sDtaxrpoo4tltnmfctyt a2ra(mo ()tlxnircia1laD au ols  2ur(o3oudlp nmicslt  rraurp;t1ope mfetaslmDumn pnt4arerifctatfm   nvi;t0t2xmxm3nu1opt mivtlt) Drru  ;u4tet mociys m2ea(vp;()tleoifciodop  ln s (  etr(rpny1lltnmfciasfs2tm( ooo4tle  i3ias aDrln o (4artomfctotom e i olt  etr(o3nu1lltelictls)aDrmumo;t0ole  oetltls rl(vp u0altnir todfmtelu i;s0 etoxm iy4aptnlics s) 2rru ono4tle iietas sDemnvp;(0alxrirciotfmD li o;t  2tmiopnudopt  nct ()sDumump;t1aptoii3ildla2el(ms;t0tltoxr oytom rlieolt)srumiopou4lleelfeiat)aDtaxrpoo0tex mf3iasfs ea(mpnu)altrmr3iytlatrlies;() rxmxr3nodalte ieslsf 2raum no0aee iociysfs uan o t0tltnmr3tatlm  lneo s)s2xr(o3ou1lm   icta(  Dtm(mp;o0tpxniictls mDranvp (0altnmrcto1lp e n o;(0 exo(r io4ol emiet () rum(  ou4oexomicild a2eauvs;(4 lxrif3iatfpDr n slt  2xmxr3iudllt lics tfaruaxr no0aetomi3iytls2ul( s;()tlenxfcty1fm eaivils0trtoim iu4lpe  ieil( srra(rpot0aetoiicildfsDrm( pn(0treoif3iotfa  auvi;t0t2xoxo ou4omenlietas  rumurp;o0tlenmietltlsDuauvo;()tlxnxo iytopD  nvi;s sexrio ou4amte fvi s)aDtmurp;t1texo oeiaslsDulu p () renmr3iodlm r neo (0 2umiopoodapee feta(fsrrmum oo1olxomo3iadls ra( s t0arxoxr tatfat aieo s  2trim ou1lpenmncs ( a2urxmpnt1opxnifctltlsDelnms;()aeermo3ta1lateluvs;t srxm(m ny1ole  fct sf rurumooo1apxnmi3iltfs2elnvp;t) rerir3ootlm  lu i t  2ur(o iy1lmenmfvi t)aDra(mont4aeenmoeilsla rmnms;t4 eenif3oa1omt liei;(0seto(rpiy1olt livs ( arumxmono1oleo o3iys sDem( s u) reomf oo1fa e nei;(0s2uo(rpoo4ole mnetl( aDtaxm ;u1openmoctytfs emumpnt) renxr3oy1fmteli ols0setmir3oo1amtelfvias  2ra(roou4oetnmi3tyt m2rl(mo;t4aleoxo3iytom  aivo;()srtr(m3iodol emfvsls)s2rm(roou4openii3iadlmDeln sn(4texrmoctatfaD lnvs (0s2xmxmpio4apee fvsatf rrauro;u4optn fcilsfa2eau o;u0 rerxf3oy1lmD anvs t0seum(mpou1lpenmncta()aDrmxr nt4oetn f3tatfs2ul( p () renxf iy1omtrlnvol( sexrxmpiodllen ieslsfsrtmurpnt1tptomfetaslsDea(mo t4arxnxr iy1laDr uvi;s)srxrirpoydamenmncta( arua(ro;t0opxo octatfm em( pnu4 eenxfcia1om  lnvi;s0 rum(o nudlmtelfvt t sruru  ou0oltn f3iltls2uluvp;(4alxrir iatoaD auvils trxoxo iy1al   feta(fsDuau  ;u0optnmfcias aDulump (0 rerxr3oydfmt  n ols0seumir3ou4lmtemivsl( aDumxmpoo4opxoioctld mDrmumpnt4tetrmr iotoaD aivs;s0setr(m nodll e nvs s a2rmurpnt0aetnmoetltls elump;t4alxnir3oydoatraueo t)t2xmxo3ou4ll elnvt sf Drrxr no1aeeo oetatfaDelnvp;u0aetrmfcoadfate iesl(0srtoirpio1omtnmfvsatf Dtmum ot1aex mfctysfsDrm(vp;t4aexoxo3ta1op rlnvslt) rxrio3iu1lptnmiei sfsDuax onu4texn ocilsfa2ra( p;u)texomr3oadoa ran i;s sruoio ou4aptn ivsa(  rtaum nu0opxoii3iatfaDra( snt4arenio3ta1fm  lnes;t)sruo(m3oodolt lfvtl( arua(mpot1olen f3tlsls2ul(vp t0 ltrif iadla elivs (  2xrio oo4ll nmfet tfsrtrxmono1aee iieiad m2umump u) rtrmo oa1fmt lueilt0t2um(opiodlm nliviat  rtrump;t1olxn ietysla rlu o;u4aeermfcoatoatelneols)teurimpoodopeelneilt  rrr(  oo1olen f3tat a emnmp t0tleomr3oo1fpD lu i;t0t2to(r3oo1lle lnci tfs2tmxm ;u4tltnioetasfa2eln s;t) rtnir3tydfatelivi;t)texoxopiodapte ncs t  2tmumoou0tpx mictysfs emu p;()alenxf io1la  lnvil() exm(r ou1olenmnetas sDuau oou0tetnmfctas mDrlnvp;t4trermf3ootla  livil( trum(o ou4al   ncsas)a2tm( ono1texnioetytls2rlumon(0 rtomr oa1lmDelieils0texrxo iu1oltnlieias) Drrxroou0olenmiciat m2ea(vsnt) ltrir3to1omD lnvs s  etm(o3ou1olte fetl()arrrxmp;t4olx if3tadfa2eanvsn()artnirciatla eanes () rumxr3nu1lmee ncsa(fsruaurp;u0ape  fctad sDraumo;t0 rtnxfcoatom rluvo s texo(o3oydlp emics t  Dumx o;o0tpx  o3iltfm elu s;t) etoxf3totomDeau slt) rxoxm3ou4aptemfeia(  rumurpnu0tle ii3iatlmDuaump u) renmoctydfateauvo;t0 2tmirpnudlpe  fvsat arta(r nt4aee miciyt sDrluvp;u) renxfcoo1lmtr u o;s)setr(m ou4omtnmiei sfartax  oo0aee mfeiytfaDulumo;t0aeeoir ia1laDeau i;s0 2xmxo iodom e fciasfsDur( p;u0tpxn ieild mDemnvo t)treomf3iatlate n s s0 eum(opio4amtn fctasfs2umuroot4olx  o3tasfs2ran pnt)trtomo totlmtelivs;t)tetmxmpiodlpt lfet t sDum( pot1opxoiieias m2ra(msnt4 exoxf3ootlpDelnei () 2xrim nu4om n netlt) Duru o;o1olen f3ildlaDemump t4trtrxf iodla  aieo;t0 2tr(mpiu4omeelfvta( artmxrpno0alen fcilsfa2rmumsnu4aetrxo3oatlmD lu i;(  2tmxm iy4om  lics s a2tru onu0aex  i3iadfm2uauvpn() rxomocty1laD ln i ()seuoxrpnu4lpenlfctlsf Dta(root4teenmocils sDum(vont)altnir3iadomtr n olt s2um(o ou1lptelfcsas)s2tau ooo0olenifeils m ulump t)artnmrcto1om elu i t0texo(o3oy4llt  fctat sDtmum nt1texomfeiatfm el( s t4 rtnxo iodopt li s;s)t2tm(r3oy1lpe lnei tf Dtrxm ot1apx  f3iyt s2elums u4 renxf3ty1fa eai i t)t2xm(r3oydllt lfvtas  2rm(r no0tle  feiasfs rmn s;t0alxoircoa1om  ai sls0seuoxopiudlp  lncs sf Dumxro;u1oet ii3iyd a emn snu0alenmrctodfa  li s;( teurxopou1alenmfvt (f 2rmx ooo0tltnio3tadfm ranvonu4artoxr ty1lmt  u sls0t2uo(o no1aleelivtlt srtrur nu4olto ocilsls um( o;u4aexnxfciotomDeaivilt)srtmim iudol nmfctasf rurum nu4olxn fetltfm elnvp;t0altrxfciy1lpteai o;s0 rumxrpiu4om n fcsasf rum(mpnt4alt ioeils s ranvp;u0 exnxocoy1lmDranvs;( seurio oy1lpenlnetls) 2uaumpnu4oltniiciltfs2emnmp;u4 etoiociy1lat  u o;()tetr(r3nydlle  ietlt a2rr(monu0oexomoeiys m em(vsn(0 lxnif io1fa e nvsl( seum(rpou1llee nvsa()s2tm(m no0tpt  octltfs ulnmpnu0 eeoxo tytlpDelueolt  eto(rpny1oltelfeta( aDrmumpnu4aetomoctlt m uauvs;(0arerxr3iatfaDrlnvo;(0s2xrxo io4al e ieia( arrmx  ;t0tpenmo3iaslaDumu pn()tltomrciydomtean i t0trxrxo3io1amenlfct ()srta( poo1tleo f3tadlm uluvp;t)trtoio ia1la eaivi;s) 2umirpno1lltelfvsat aDrrum nu1apxnif3iytfmDumuvpn() etrxr ia1lm rlies;t truoxmpny1optnmfet ()arumxrpou4oex moetlslsDran pn(4 leoxr oatomDeaueo;t0trtmio iu1lpt mivtltfarurum ot1opeo oetlsfmDea(vsn(0aetnif3iatlpteanesl(0texm(r3iydlm n nei ()srraxrpoo0optomf3tld mDrauvo u0altnircoy1lpDe nvo;s  rtm(rpiy4lpt  ieilt s2tr(r ;t1teeo octlsfaDem( s () rxnxfctotfm rli o;t)srxmxo iy1opeelnes (  rraxrpou1oeto ieiasfa2ea(von(4 etnir3ootlmteaivs s0 euoim io1olt  nvi (f 2ur( ooo1tlenmfciadfs eaumo u0arenio tydop raieo;s srxmio nydopt  ncia() rraxro;t1tpe mfeiys aDemnmon(0tltoif oatoaD auesls t2toio3oudlpenmivt tfsDraumpou4olx mociys s uau p t0trxrmf iadlm  aivs t trur(rpoo1al  mfeil(fs2ta( o;u4oetn oetyt a2el( o t) rxrmfciadopD lnei;t) eurio iy4amt mnesl() 2tmu onu4apeo oeiydlaDemnvs u0arxoio3oydfaDrlues s  rxrxm3oo1ap nmncsatfsruru  ;t1aeto f3iyd mDrl( s t) eerir ty1fmteli i;s srumiopiu4ll  mieslt) Draur nu0olx iictlt sDul(vs;(4altrio3iotlm   ies;(0trurxr3iu4lpenmicia( artrumont4aexnmiciyd s2emn s;() eenif oa1op   nei s0t2uoxm nydomenmietl()aDtmum ot4apeo i3tytfaDelnvo t0tetnir3tatlm eanei;s)seur(o3ny1am e ncs t)s2trxmoou4opxnmictatls ea( ont0aetnif3tytoatraivs ( texmxm iudamen ncil(fs2ta(r oo0teenmf3ild mDuluvo ()tltrxo ty1lmtr i i;t0 exmim nu1lpen iviatfarrr( o;u0optoioeiys a2umn s u4 exrif ia1omtr n o t  2xrir3oy4oltemfes t)srrax onu1opx mieilt m2umump;(0 renio ootlpt  iei () rtm(r3oudam n fvilt) ruaxm oo4altnifeiytlsDemnmsnu4 lxrifciy1laD ln ols0srto(o oo4ope liei t  rrmu  nt4oee mfctls s2eaumont) ltomfcoadop eln s s)seuoxr iy4aptnmnctat artm( o;o1aee  oeiad m2ra(ms u4tlerif oo1oatr uei s)seurir nydol nmivtatf rta(ro;o1aeeo ietad aDum(monu0 eenxo iydoa  ai s;s)s2uoxopoo1lptemiciatf Dtmxr ou1tetn i3tlsfaDea( s u)altrio3ia1laDeln ilt  2xr(r ou4olenlfvtasfaruauro;t0apxo fctydfaDelnvon()tltnxr3tydfat auvs t0 eum(o3nudomee iesl(  rrm(m no0apeo oeiadfm2emu p;()trxoxociatlaDrluvil(0 2tmxm3oo1op nmfct s  2umxroot1tlx iieildlsDrl(vp;u4arenxo iatoaDe nei;(0s2uo(mpiu1omenlfct () Drr( ono0oexo octys a2em(vo t0aeenxr to1fptr uvs;()s2xmir3nu4lmeemictl( srtaxr nu0tpxoifcilsfs2ulnvs;(4 etoxr3oadoaDeai slt trur(r iu1al  mfeilt sDtru o;u0optnii3iytfsDum( o t4alxnmrcty1faD li o (0trtoxopiydllt mietl(f Dtmu  ou1teenmiciltfsDumnvo;t)arxnmfcty1oa   neo;t0 2xo(mpiudlm  mnes sf 2ta(m ;t1optomo3ilsfs ua(vp () eenio3iytlm  livs;(0 exoir3nu4lp  lfvsls a2rr(monu0opxnmf3iasfs rmnmont0arenmfctadfaD au sls)s2xoxm3iy4om nlnvsl( srtmx pnt4opxn o3iysls2ua(mo;t) lxnmociytop e uvol(0 2tr(rpnu4lmte ivt t) rurxm ;o0aleo f3tysfs eln o u0altnxfciydfateluvilt  2toio oudal nlicsl()srumum ou4opx mfciasls uau o;(4 lerxr ty1faDeluesls) eur(opiodoptemnciat arra(r ;o0opxnif3ildlm2eanmo;u4tlxnmr3to1laDeli olt  etmirpiu1al e nesatfsrtmx  nt4tlxoifeiat s2rau onu4 rermrctadlm eau ol(  2tmio oo4ape mivtatfsrrrumpnt0aexnmfciysfa uan pn()artnir3ia1optrli s;t0trxr(m no1ll elfes s  2rm(mpoo4alt if3ilsfsDrmuvpn(4 leoif3to1lm elueolt s2tm(mpoodapeemivtat)sDumx poo4open oetlt aDuauvp;t4tetnmr ta1fp rluvsl(0 2trio iu1ll n fcsat artm(r oo1opto ociad m2rm(vp t4 lenif iotfa elu s;s0s2tm(rpoo4am  mfesls)artr(r ;o0texoiictldfaDua(monu0aetrxo todfpDr ieo;(0teurimpnudomenmict (  rrr(r ;o1texnio3tat a ua(mp u4texrmo tydoa   u o;t0 euoim oudam  micils)aDta( onu4opt  oeildfa2eau s u4tltoio iytopDr ivils0trtmimpny1alt lfvi t)sDtauro;u4aptnmf3tys a ua( s t0texoxf3iydlm e uvol()s2xm(o nu4opee ncia() Dtax  ou0apt  i3iytlaDeauvonu4 lerxo3totoat  u i ()s2trirpou1ll  lfcta(fsDrru p;t4tltoifetldlm2uaump t)aeenxo3ootoateluesls t2ur(o3nu1ap nmfcsl(fs2uaxroou4tlt ifeiadlsDemnvsnu0texrxoctotfa ean i;s0sexoxr iu1aptnmnesa( srtaxm oo1apxnmf3tad m2ran p (4 reomocoo1opteluei;t)srtr(o oydol nmnctas a2taxro;u0tpx mf3iad m ua(ms;u0tlermoctytfaDeaieils)teuoxo3oy1op  lics t) 2umuro;u4apt  ictatfm2rluvp;t)teeoiocty1fat lnvi;s0trtr(o iy1opee nviasf rua(m nt0apxnii3iyt s rmums u4trerir3ta1lm rlnvs t0trxm(o ny4lltelfcs (  Drrx ont1tptnii3ildfsDra( snu) lxrir totfmtr neo ( trtmxr3oy4ll nmietat)arua(  nu1alx moeild m2rluvs;t)trerif3iy1lm  anvs (  2uoxr3iu4am  mivtltfsDurx o;u1opto fetas aDemump t4tltomfciadoaDeliei;()t2ur(r3oodap emncsa(fs2ra(m nu4tlxoio3ild s ulump;() renirctodlaD au o;()trtoxr3oudll  lnetlsf Dtmum nu0olt iieils a2rm(ms;(0arxnifcio1fm rln o ()texr(o3iodam  liesls)a2rm(m oo4tptoif3iasfm2elnms (0 lxrif3tatomtr nvo s0srtoim iydame  nei t  rtmxro;o1tex ioeiltlmDem(vpnu) etrxrctatop  ln s;t0trto(o3ou4lm e ici ()artrxr ot1ape mieiys a um( snt4 exrif ia1fpDeluvs (0 rum(r3nu1al   fctls)s2ururoot1ole ioetlslm ul( p u0aetrmo3tadlp e ivo ()s2uoir iydomenmict t arrm(mp;t0alenmietydls uluvs;u) ltnmfciodfpteaues t0 2xmxm3io4omtemfesasf 2rau  ;u4altnii3tad a2rluvo u4aleoir3ty1op  aueols)t2urxo oy4open ncsat  Dta(mp;u4texniietlsfmDum(msnt)tlxnio3iadlmDr uesls)s2umxopiodop   net t sDrrurp;u4oleomoeiatfs2ua(mo () eeoiocoo1oateaieolt0 rxoirpou1al n nvsl()arrrumooo4tptniieild s2umuvs;t)tetomo todfaDeluei;s  2ur(mpno4ameelfcsas aDtrx o;t4tlx mfeiltlaDeanms t4alxnif oydfp   nvo t) etrirpny1lm nlfvtas aDurxmo;o1aexo o3iys s2ean s u0 rtrxf3oy1oaDelueils tetoimpiu4ale lfcsat arta( p;o1aet  oeils m2emuvs;(4 etnir3tadomtraivs s)sexoxo oy1alt mnct s srrm(mp;u4tpxo o3ild a2ulnvp;(4tetnircoy1lmDraueilt sexm(mpiydom   ici ()sDurur no4alenmo3iltlm2ranmpnt0aeenio3oytlptrau o s)sexr(r iy1olt mfvi ()s2ua(ronu4tet ii3tat s2ranmonu4tleoxr3totoa   u ils0 2umim3oudamte nvsa() rtmxmpno0olxnmfctytfmDrl(vo u4arxnio3ta1lat  neolt) rumxrpio4apen nvilsfs2ra(rp;o4alx  fcilsls2eluvonu4artrxf3tadlm eaiei t teurir3oudole mncsas  Drrur nt0texoifcilt m ulumo ()tetomrctotlpt aieol(0t2xoxm3iudalen nvi (fs2trur nt4alenmo3ilt m2ran p;u0 renif io1lmtrlnei;(  2umir no1open fvi s)s2rmxmp;u1alt miciltfa uluvo;t0treoxfcoo1fpDrlies t  2xoiopno1lpee fctas  rrm(r oo0olx if3tlslsDuluvo (4treomo3oodopD  nvs;s)t2trxo oodaltnmfcia() rtrump;u4tpxn feiysfmDumnvs;u) lxomfcia1faD auvi;s)texrxrpnydom  mncias sDumurpou0ale  i3iysls eanms;u4aexnmfciadom  aies s trtriopnu1al emfcsl( sDurx  ;o4olt  i3tad a2um(vsnt0 rtomrcty1fatrai i ( s2xrim ny4am n feta(f Dtaurpno1oltnmoeiyt s2ea(mo ()aexnxo3totfa r ivsl(0srxr(r3io1op emnvi s arrmxm nt4tet mf3iysla2rm( onu0texnmo3tytlat aivil( srur(o3nu4lme lfvta(fsDuru ont0tlx moeiyslm eluvo t0tlermo iydfpt  nvs;s)teumir nu4oltnlicilt)arurxmpou1tpx iieildla2umn pnu0artnxo3oo1lm ran o;s  2ur(opiodomtn ictat sDrmu  ;u0aleoifeiatfs rln pnt4aexoxociodlat livo;t s2umim3ou4alenlnvt t)srraxmoot1ape  feilsfa eanms u4treoxf tatomDr ivo;s s2ur(o iu4oltelneilsf Dtr( p;o0tpx iieilslaDel(vont0 rxrmf3to1lptraivo ()srum(o3iu4am  licilsfs2trumpnu1aetn feildls eanmp;u4aeerio iotfp rlivsl(0 euoim iudlmtnlfei s) Draurooo1olxniicildls2ean s;u4alxomfcty1oaDrlivs;t)t2uoirpnu1lmeemivta()aDum(mpno1alx mi3iltfm2emnvpnu0aexomf3oo1fatr nvo t0texrxo nodame  iciasfa2ua(m nu1tleomieiytlmDeau pn(0 lxoirciatoatr iei;s  etrxr oudom nliesl() 2ua(mono4tpe miciysfs uanmo t)trenif iodoaDraies;s0 2toimpiodalt mfvsa( aDum(  ;t0aet  iciltlm2eanmp u0alerirciotfmt anvi (  exmim oy4amtemfctltfa2ra(roou0tlxo ietld aDumumo u0 lermo iadop rlieols0trurxm3iy1altnmfcta(fsrrrxmpou0alx moctltla2uauvont0alerifcoodlatraiei;t) 2xrimpoydopeelfei () Dtr(ro;u4olt ifctys aDumn snt4aexnxr tydlpDelnvs s0teto(rpou1lltn nes t  Dumxmo;u0aetn ieildlsDrl(vsn(4aeeomf3oa1laD  nes;t s2xo(opnu1al  lnesls  rraurono1tlt ii3tlt s rl(ms ()trxoxr oytopD  uvs;s sexo(mpio4ap elfetls) Dtm(rono0apxniocilt m2em( pnu4aexnif ootfmDeai s;() 2uo(m oo4llt lfcs t)srtmxmpou1tet moeiytfm uan s t)tltoio iodlpt luei;t)trurim3oydapee nvsls a2rmx  ;u1tlx  icilt a2eanvsn(4 exrxoctodfaD anvo;s)t2trxopio4op nlnvi ()arra(mont1openmo3ilt sDeaump;t0tlermr iodomDranei;(0 rurim iu4ll   fetas) rtauroou0aee iiciytla rlumo (0 exomo oodopD  n s t) 2uoxr3nydopte fvsatfsruax  nu0aptoii3iydfs rlu o (0texoircio1laDeaueilt sexmir3oo4am nlnviat)aDtrurp;o0oee  ieils sDeln sn(4alxrmo3oy1fpt au ilt s2xmxrpno4lm  mfvtlsfaDrru o;u1tle mfctysfm2uln o;(4texrmf3iadoateaies s0 euoxo oydlm nlnvt ()artaxrpnt4aex mo3iatlm2rauvp ()altrmf3iy1omtr nvs s)teurio3ou1lmtelncs (farrr(mono1ape mieiytfmDrmnvont4teeoif ia1opt anvs (0 eumiopiydamt mivsa( aDta( ont0aex ifeiltfs umn p;t0altoifciodfat aieo t0s2ur(r ou1ome  ics sfsDtaur ;t1ale  ictltla ra( pnt4 rtnxr3oo1om  lneol()setr(r iodamenmfcs tfs2rr( p;o4opt miciltfmDelumo;()trermrctydfmtraues () 2xoir iy1apt mfvt ( sDrr(m ou4apeo o3iat s2ea(ms;(4arerir3iadop rauvo;()t2um(o3oy1omen net (  rtaxmpnt4oexo i3tydfa2elnvp t4tltrxf iotlm rlu i s) 2tm(opiodom   icslt)s2rm(  oo1apx mfetadlm2ranmo u)artrmocoadfptr uei;( setmxopou4al emncsat) 2tmurpot0aexnii3tatfa ranmo ()altrif todlm eli ilt s2tm(r3iu4om e fcsl()artaxmo;o4apxo ieiydlaDulnvsnu4 rtoxf oa1lpD aueslt) 2to(m nudap n fei (f Drmumooo0tetnmi3tyt s eln s;u4aetnmo oo1oa e ueols) rur(mpio1opt mnesls) 2tmxmont4alxnmfciytla2emn p;t)tlxoxr3ootla  aues;t)tetm(r3iodam e fvi t sDtmurooo0aexnmoeiat m rln pnu0teerxr3oo1fmtrluvsls sexo(o3iy1lmeemivsl()aDur( pou0aet iiciltlaDumumsnu) eeoif3ootfa  ai i (0 ruo(o3io4amtnmivtltf Duaxmoou4tptomictldlmDrmnmp (0altnmf3tatfa r uvs;t0 2umirpoy4oltn ici sf rur(mo;u4tlt mi3iadla rm(vo () rxoxocta1faDeaivo;s t2trxo3ny1op elnvt s  Drmum nu4aptomietlt s2eluvont4 exnif3oa1la eai sl()srxoxo3iu4om nmnctas)s2rrxm ;t4tpx  fetytfs2umuvs (0teeoxf3oydfa ean s;()t2ur(opny4om   nvsltfa2rrxm no4apx ii3tysfa2ean pnu4aleomfciadlat ln slt) 2uoxm no4apt lietlsfsDtrum ot0alenmieiysla2um( s t4teeoiocia1opDeauei;s)srtoir3ou4omee nei ()s2taxm ;u1aexnmieiydla raums u)tlxomfcoy1oat lnvo;s s2xrxm3oy1op  lfeilt) 2tr(m nu0aex mfetld aDrm( o;u)tetomr iadfmDeanei;t)teuoxr3no4olte fvs (fs2raump;u4texoioeild s eaumont4aexnmocty1fptr nvo;(  rumiopny4lp e fvs ()aDumurp;t1tee  ieilsls2em( s t4 exnif3tydom   nvs;()srxo(rpiydamtnmneilt s2tmxr nt4tptniieiys m ua(mon(0tlerifctytoaD  u ol()seuoim3oo4al  liciat)sDrmu pou4oeen i3tas s2ra(von()altriocoy1lmt lues;s srtr(m nudaptnliet t aDrax ont4opxn o3ildfaDrau p;t0 etrmfciatomt lneslt)texmxr3oy1lmee nvta(f rua(rooo0ape if3iatlaDran onu) etniocty1fmtelneol() rxmiopnudopenlfet s)aDtrxmpot1olxomoeilslsDemnmo (0 exnmrcoadlpDr ueo;(0t2tm(m3oodamen fct s s2tru ono4opt ifeiytls2umnmsnt) etrxf ia1lmDrlneo;() ruoxr ou1ope  fvt sfa2rru o;t1aee mictyd m ra(vo;u4 etrifcoydlpDe neo ( tetmio oydopenmivtasfa2umu  ;t4aex ii3tydlm2ra(vs;t) rtrmr3oytlm eau ilt)trtmxmpoy4lltnlnvta()srurumpno1oltomoctat s2umnmonu0arxnxociotoa  anvols0 eumxr3oy1am  mivtas a2rmur nt4aeeoio3iyd s emnms;u0arxoxr oodfmte nvo t0 2xm(r oo4al n icsatfartrx  nt1alt  fciydlm ean o t)teeoircootop eauvs;t  rtmio3iu4alt  fvia(f rrmumoou4ole iociyt mDuanmsn()trtrif oa1omt aueo ( s2xm(rpnu4alenlivt ( aDum( oou1apt mi3tysls rl(von()teenxf3iadfa  luvi;t t2uoxm ou4am nmicias aDtrurpnu4aeto f3iytlm2rmnvp u0treoiocty1lat ln i;s  2trimpoy1ll e ivt s)sDrrxm ;o1olxnif3iytls ulu o t)aleoio3oa1lmDe n slt0 rtoirpou4aptn fci ( a2rrumpoo4apx  fciasfm2rmu p;() ltnxociydfm  auei;()t2xr(rpou1olt  icsa() Dra( poo1oex moetldfm um(mp ()altomfcty1lm elnes;s0trtoxo3iu1alt lfvilt  Dtm( onu1tle if3iltlsDraumo u0trtrmf3totfpDr uvilt s2uoio3io4lptemnviltfsrtm(  nu1altnifctad s2rl(vpnu0tltrxf oo1lmD aneols0sexmxo3nodom elieilt arumxmp;o0aetnifeiytlm umuvo (0artomo3iydomDe n il(0 2uo(m oo4apt  ncs t) rra(r ot1tlxn fciatfaDranmp;t0teenifciodlpDe u i;s0trxmir3ou1op  licia(fs2uaurooo1oeeo feiyd sDelu snt4aetrxf3oytoaDr u s;s)teurimpiu4ll n ieiatfa2rau oou4tlxnioeildfa2eau ont) reoxo oodlptelivs t0 2to(mpnu1al  miesl(f 2umu p;o4tlt  f3ilt aDul(vonu0alxoxr3iydlpD  n i (  2uoxmpno1ope mnviatf 2rrxr ou1olto feiyt a2el(ms ()arxoxo3oo1omDeli s;()setr(opny1lmee fesl( aDtaxr ;o0apxoiociatfs2eaumsnu4aeenxr3oo1fmtraieo;t0teuoxo3no1lm elfvtasfsDuaur ;o0oetoifeiaslmDrmnmp;(4tlxoxr iytoaDe uvs;s0t2tm(mpiydap e ivtas srururpou4opxn i3iydla2ulump u)teeoir3ty1om rlnvs;t0setmxr3iodomtelnvtat)aDumxrp;o1altnmfetls aDumuvonu4alxrxr ty1lpteai s ( setrxr ny1aptn ivt sfaDtmurpot1apxomietlslaDumuvpnu0trxrmociotfp  lieslt  ruoxo3io1am nliet (fs2ra(  ot0alt  fetlslaDrmnms u)texrxrcoatlmt anei t0trtoirpiy1lp nlfctas) rumxrpno4tpt ii3ild a uanvp (4alermf3iotop   i olt  rtoio3iodal nmfvil(fa2raxr nt1tptnmociadfm elnmp;t0trenmocta1fa e ivols) 2umirpnydal  liei t) Dtrurpoo0tex  ociys a2uln snt0aetnmf iadfmtr i s (  2xrxm iu4olenmicsat a2rrumoou0tex mfcilsfm el(vs u)tlxnif3io1lmD anvo s0trtr(r3oo1amt lictls)sruaurpnu0ope mieiydlmDuauvont4trenxf3todlate n i t)trxoxm iu4ame lfvsl(fsDtrx o;o4texo fetat aDrmn o u4texoirciatoaDraivi;(0sexoio3oy1om elnci sf rtmum oo1alt mf3iytlm ean o t)texoxrciodoptrlu i;s setmim3iodom e fcsatfsrta(rpnu4opxoiociytfmDuauvs;u0 rxnioctatlaD  ivols  2xoir3oo4lle  fcsl()s2ur(m ou1aexoiietls s rl(ms;t)teeomf3oadlpt  ueo t  ruo(m3iy4lm eliet sfaDtax onu4apt mi3iltfs elnvp;(4 reoxf3oa1oa rlnvol( s2trxr oodlp nmics s)sDrrur ;u4tpe  fcildlaDemnms u0 ltrmoctatfaDeaiei s) eurimpiy1ap e iet (fsrra(r nt1olenii3iltfa ra( p t0tetrir iatlaD anvo;s)s2xo(opnodlme mnvsl()srtr(mont4tetoifeild m eanvonu0arxomr3oo1omD auei t0texm(o3iu1lpe  ivtas)arrax p;o1olenmocild mDumnms;t)texnxfctydlp   iei;t) exoxr3oydllt mictas aDrrurp;t4apto fctld s emnmp u0altrxo oo1opD auvs ( texmxr3iu4amt mnvsatf Dumx  nt1teeomoetas a ul(mpnt4tetnif todla elueil() ruoxm3oy1lm nlnvsl(  2uax pot0apxo i3iys mDrlnms t0 ltnxociy1lpt luvs t)seuoxm3no1omeeliet s arrr(rpot4oet ifetldfmDeau o;(0altrio3iytlp  lneilt srtoxopno1oltn nes t)sDtrumpno4tptnmf3iydfa rmuvo;t4 eenmo tytfmt auvs;t)s2toxo3oo4omte fei sf 2ua( ooo4aexo octlt mDelu o u4alxnxf3tadfpt lnvs;(0srtrxopoy1lp   nes s artrx  ot1altoifeiasfmDel(vp;t4artrmo3iatlp eaieo t trumxo nodalte fesat artmxm ;o4oleomoeils aDrm(ms u4 exrmrciy1oa rlueo;t  rtoxm ny1amt mnvtat) Drrxm ;t0tpxoiociytla ea(vp;(4 rerxo oy1laD  nes;t0 rtrirpoydamt lnvsas arurx o;t4aex  f3tls sDuanvp;u0tleoio oatom raivolt srto(o3iodapen nciat)a2urxront0apx ii3ildfs em(vsnt)tetrmoctodla r iei s0seuoimpiudlm e nvtlt  2trx p;u1apxnifciyt s2ua(vp;t4trxoif3oatlmteaneilt)srxr(r3ny1alt mics sfaDtax  ou4olen f3iaslsDrl( s u)arenmr ty1oa elieslt)t2urxr3nudapenmictat)a2tm( o;u0oetoifctldls um(ms t0texrio3totoaDr u i t0 2um(m3iy4ap n feia() 2rau o;t1oeeomoeiltfs ra(mp t4 exoxr3tytla eaiei s teuoiopny4amt lnvta(fsrraxrpno0tee  i3iat m2rau s u)aeeomo oydfatrlnvsl(0 2um(m iodamtnlfeils srurxr ;t0opxomo3tad a2ra(mon(0trtnifctotlaDe u s (0seum(o nodol n fvt ( aDrmxmpnu0optnifciytlm2uln s t4alxnmo iodfaDr ivs;( trxm(r3iu4ll nlncsas) Dtmuronu1texomi3iysfs2ran o;()tlxnir3iadlpt ln s (0setr(rpoo1ame  neiltfsrrauronu0texnmfciysfm umnvsnu0arxnxf3oy1omteluvo t0truo(o3oy4apen fvs sfsruru  ;o0tltn oeiltfmDulu ont4aeermfcoydlm rlivi;s0setm(o oo4lpeelici ()a2rr(r ou1tee  i3tyt aDumnvs (4alerif oy1fptraieo;s)sexrxo iudom  miesas  rrrxront1oee iiciytlm eaumsnt)altoxo3oodomte n sls)trtm(rpio1apt mivsl( srrm(rono1aex io3tysfm rln onu)areomfciydoa  ln i (0 rto(opnodlpte icsl( s2urxmonu0tpen icias sDum(msnu)treoir iy1fa  ln olt0s2um(o3ou1om e ivi ()a2um( p;u1opto o3iyd m2eau p ()tetrmocoodop e ivolt srtoxr iydlptelnctat sDtr(m nt0texo o3iadls2ra(vs;t4 rxrmrciy1oatrlu sl()t2ur(opno1lltn ieiat)arrm(m no1aee mo3tadlm elu onu) eenmrciotlpD lu o;s sexrim io4am nlfvtl(fsrururo;u0alxoiiciatfa emums t) exnif3oo1omteanei;(  exrxo3iu1lm emivtls)aDumuroou4oexnii3iatla uanms u0 exrmf oodlpDe ivo t) eurxo iy1lpt lneslt) Dra(r nu0aptn octadfaDran p;u0 lxrio ia1fpDeluei s0srxoio iydlptn nvs ( aruaurpou4tleoioctlsfsDumums u)trxoircoadomDrlies;s0 etoxo oo1oltelncs tfarra( p;o1ope ii3iltlm eanvp;u0arerxfcoa1opteaies;t trumirpno4lle lies ( srta(mp;u0oetnioeils aDrmums (0tetrif3iytlm eau ils0truoimpiy4ale mnvslt)s2uaxr oo0texnio3ils s elnmo t)teenxrcia1lpDrliesls0 2tr(r3ny1lp nmnvia()aDuaurpnu0ale mi3tldfs2eanvo;(4tetrmrciodlmDelieils0 rxm(r nu4oltn ieilt)sDtrxrp;o0opx  o3tltfmDem(vsnt4tleomr iodfate ueo s)srxoxm oo4optemfvtatfsDrmxm no0apenmo3iydfa2umumo;(4alxoxo iytla rau o (0 2ur(mpoo1altnlnvs ()s2rr(ront4tpt mfcildfm elu sn(0trxnioctadlpDeluesls texoir iu1omee ivi s)aDumu  ;o0aex  oeilsfmDuaums u0 rtrir iatoatelieo t0 euoxr3oy1lp   ivia(fs2rrx o;t4alx ifciatla2ua(msn(0arxoio3ta1omte nes s) 2xrio3oudll e fcsl()arua(rpnu4aptomiciatls rmuvs;(0 lerir3totoatr i o t) rxrxr iydlp n iet (faDra(m no0apenmfctyslm2umuvsnu0aetomo io1faDraues;s)seum(opnodol eliet (  Dtmx o;t1olxo o3iytfm2ra(vs;() lxnmr3iodfpte ues;s tetrimpnu1ap nmivsatfaDta(rpnt0olxomfeiyt mDrmuvont)trtoircootlm  liei (0srurim3nu1altemieils)sDrau o;u1tptnioetltls2rlu o 
\ No newline at end of file
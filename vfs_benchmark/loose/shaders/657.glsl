@@ -0,0 +1 @@
+uvs (0tetm(mpiu4am n fvs s) 2trurpnu0texo ieilsfsDranms (4aeerir3iytfptr uvilt0t2xoxm oy4apeelivilt)srum( p;t0altn o3iatlm2elump u) ltoir tadopDr i slt) 2uoir iy4olt mnvil(f rumxr no4tpxnmfetadla ea( s;t0tlxnioctatoaDelu s;s)s2uo(o io4ale mivi (f ruax pnt4opx ioctadlsDranmon(0 renmocty1la elnesls0srxmxm3ny4aptnlietltf rtaum ot1tle moetad a2umn o;(0trtomr3io1fpt aneil()srxriopny4lmtnmfvsa() ruaxm nt0opxniietatfaDuanmpn(0trxoxo iydlpte ieol( t2trxopoo4lmeelivi t)srraxmpot4altoii3iyd a uanvp u4 rermo ootlpDe ieilt) 2tmir iudaltnlivilt s2uaxm ;t4optoifctasla rmn s t)texrxrcoodoateau sls)teuoxm no1ol n nesat)s2uaumonu0tlxnmi3iydla2rlu snu0tltnmr3to1oat anvil() 2xrir iydamt  fcta(fartax ono4tleo ieiasla ua(mo;()arxnxrctadom r uvsls)t2trxmpiu1ap e nvt (faruru pno0tpxnif3tytfm emnms;()tetnioctadfpteanvol( trxm(r3iu4amt  fvt tfaDrr(moot1altnmfcilsfaDrlumonu4aexnxoctatlaDr iei t) rxr(r3no4lm elnct (fs2trx  ;o1apt mi3iatfm um(vs;t) rxnir iydfm eai i;s0seuriopnudamen ncia(f Durxmont1ope ioeiydfsDrmn p u)teenxo todla r ieol( seum(mpiu1optelnctlt) 2uaurpnu0aptomo3ilsfa em(mp;u0arxoxrciydlmDraneo t  euo(r iu1apeemivtat)s2tr(mpno0ape if3tysfmDulu on(0trenirciadlmtranvs t  2toxo iydlptemfci () ruaxm nt1oleniictydla2ua(mon(0 eeomr3oodopDeluvils)seurxo3oy1lltnmietls)arur(rpou4tpe moetysls2eanmo;t)teenxoctytoat  ivi;s0trurxr3ny4aptelnesl( artaxmo;o0tlenmfciat s2el(mo t) rermrctadfpDelu o s  2xo(r3nodope liet s)sDtaurpnu1aleo octldfsDran pn(0tlenir3iodfm ean s t s2trxopiy4om   nesas)a2tru  no4aetn ocils m2ulnmp (0treoiocty1fm r uvi;t) 2to(m oy1al nliei ()sDua( o;o4apxn ociysfaDumnmp;() rxnir oo1lmD aivs;s setmxo3oydamte nes t)s2rax  ;o0tlx  f3ildfmDrln pnu0arermr oadlm eanvsl()t2uoim nodaptemfcil( s2trxm ;o0tleomietltla2uanvo;(0trermfciotoat  ieo;(0 rxo(m3ou4lle lfcslt)arraxr ;u1teeomf3tyt sDumn o t0 eerir iadla eaivs;t) eumxm no4om  lnei sfsDtaumpno4optnmfetltfaDuln p (4alxoxr3oydomte u o t) etrxopno4olee ivsasfartm(moot4aptn o3tad s2rl( p;(0 etriocoo1lmteauei;()t2uoiopnudlmtnlfetas  2uauroot1tet  oeiadfa ea(mont)aetnif3iy1optraueol(0s2urio3iudameemnvsl(f 2tau onu0teeomicild s2ean pnu0 etomr oatlpte nvs t) ruoim oydop n ietls aDtmx p;t1aeto i3tys aDumn p;() rxrxf3oydlateaiei s0s2uoimpiy1lpeemneiltf Dumum nt4ole ifciyd aDrl(msnu)altniocoytop e ivo;t) euoirpoy1lmeelfvtlt aDtmu onu4aptnmo3iytlm2umump;(4tlxnxo oy1fpte ueil() rtrio3oo4lm elfei t  Dumu p;t0opxnmi3iasfa2ulnvo u0arxnmfciydfpDelneols)s2urio oy1apenlnvtat)sDrrumono0aleoii3iltfsDrlnvpn() lxoxf iadfa e nvilt trtmirpoydaltn icsl()a2rr(m ;t1tpenmi3tad aDuluvsn(0 etnxf3ootoptranei t) 2urir iy4ol n fvsas  2tmu p;o1oexnmoeilt s2el(msnu0 etnxociydomtrauvilt0t2xmio3oy1opee fvtls)sDta( pnu0teeo f3iydfmDelumsnt4tlxrifcio1oa r iei s sexm(o oo4lp  lieil( aDurum ;o1aptniiciat a ranvon(4 lxnmf iotfp r u sl()t2umim3oo4ame  nctl(fs2raurpot0optnioeiytla2uauvs u)arxrifcoytfmDrli s;s)truo(rpnodaptelnvslt)s2ta(rpot0opxo ictytlsDumu p t0aetrmr iotfatr nvslt texmir3no4olt mnetas sDtauroou1tet  fetltlsDul( o;t4 ltomo3ootlm r nvs;t0 2xoirpnodlptelics t sDurur nu1ole  fetldla rmn p (4arenio3iytoatr ieo t)texo(m oo1omenmnvsas) rrau o;t4altniiciad mDeanvon(4teenmoctatfmDr n o (0trtmxmpnu1amtnlieta(fsrraurp;o0ole  i3iltlaDuluvs;(0tlenxrctydom  li ilt seurxmpoudamt lics t) 2rmur ;o1tlen o3iatls umuvpn() lxoxo tadfateli s t)sexriopou1aptn icsat) rtr(r ou0olt mf3iadls rlnmpn() eermocoydomtelu o (0sexr(r3oudol emfei ( s2tm(rpou1teto f3iadfsDulumsnt0aeenmr3oy1lmDrlneilt0 rxmxm3iy4opeelnci tfsDraur ;u1ole  ociysfaDel( p;(4 rtnxr3iydlm raies s texmir3iy4openlfet s  Dur(  nu0teeomoeiadfs2eaump u4altomociytlaDe n s;t  exoio nu4ome mfetasf 2rmx o;u0tle mf3iytlsDeau sn() exnxr3iytfmt lu s t  2urxopoodll  livtlt arra(mo;t4opxnmf3iltfm2rl( pnu0trtnmr iy1lm   nvs (  eto(m3nodope  icsas)srurxront4opx  feilsfa ea(vo (0trtnxr iotoptrlnei (0srtr(m3iudap nlfet t)srurxmp;u4aee  octad m eaumonu) exrxrctodopDelieo;t0srxrxrpoo4olt  fei ()arrau o;o1oexn f3iydfmDemnvo (4aetnifctytlmte n o;( t2xoxo3oy1llee ivtls  Dumu  ou4tetomoeiadls ean p u) rxnmr3ia1lat  ivs;s0 rtoxm3oo1alte fviatfsrtm(mont1oexomo3tld s2em(vo;u4 exnmrcto1lmte ieil(  2tm(m iy4om  mnes s)srrrurpno1aeeoifeiys aDelu o (4tleomfcoydlm rau s;t0setoim no1op emfvtas)sDrrxmpnu4aeeoiieiadfa2rau o t)aeenir3io1lmDrluei;(0texrxo ou1lmtemnctl(  2urxront0tptnmfciadfs em(mp;t0arxomo3ia1oaDr n o t)texmxm3nudlpe  fetlsfs2um( ono1olxn fciydfaDea(vpnt)aexrifciytoatrlieilt0trxmir3iodale mici ( s2tax pno0aeeoif3iasfa2eauvp;t0 exnxo3iodfa rlivolt) rtrxmpnu4open fesl(fsDum(mp;o1aet mociaslaDel( snu0 lxrif3totlmt aneo ( setoiopnodole liciltf Duru pnt1oet  o3tldla2rlums t)aexomocoy1fp e iesl( s2urimpiu4aptelfet tfsrraxm ;o0olt mociytfm uaums (4arermo tytlmDrai s (0srurxrpoydam nlfci (fsDtmurpoo0opeo feiatlsDul( o ()alxomr3iodom r i i;s setmiopnu4aptn ncil(fsrtm(m ;o1oet moeiasfmDeauvs (4 lermociytfm r ivo (0 eurio3iu1open nci s)sDtaum oo1ole iociysls2eanmo;u0trxomrctodop  lnvs;(0s2uoim3io1ol  lnei s)aDum(mono4ole  i3tatlsDrlnvpnu) rtrxr3totop   nvs s s2uoim3iudoltn fcsls)a2rrx  ou1opxomi3iadla2ul(vo;() lenio iydoa   n o;t0texmxm nodolen fcils sDrmur ou4tpe  i3tlsfs2eanvp u4arxnxo io1fp   neo (0 exrirpiydol  lnes s a2um(rpot0apeoio3ils mDum(mon()artnifcoytoa rai s s srtoxr nudam elnet (  rurur ;o1apxnii3tyt sDul(vo;u4tetrxr oa1lmD  nvo () 2urxr3oy1ameemies t)srum(r nu4optniicilsla2rmn on(0aeenif oy1oatrlneo t0sexm(m nu4ap nmnes t)s2urxmp;o1teenmieiyd s2rlumon(4tltnxf3tatopDrlivo;t)seuriopiudamee fet sfsrrm(m ;u0olxnmoeiydfm eln pnt4trxrxrcoytlm eliei t0seumxmpiy4lmeeliesa(farurxm ot0ale mo3tatfmDumuvonu0trermr ia1fat  n i;s0 2xriopnu1ope miesas sDumu  nt1aeto i3iysfs2rl( pn()aexoio iotlmt  ieo;s tetm(m oodop emfesa()a2ta(mpnt1tpenmocildfs elnmsn(0aetnxo3ta1lpDrln ils)s2umiopio4opeemnvil( s2rmumoou4tetomociadfs ul( s t)artnxo ia1lp elieol()s2umxm iu1lmenmfci s sDurxmpnt4aptnifeiydlm2elumsnt) lerif iodla elnvi ()t2trxo3nu4om nlfciat) Draxroou1tpto fciyt s el(mpnu) rerif3oodla  lues;() rtmxopiu1lme mnvta(farrm( oou4tlt  o3iyt m rmnvs;(4tetoxo3ta1fmDrluvo t t2xmir no1al   ivia(  ruru pnt0apeomoctadla em(vs;()trenmo3iotlaDrli o ()t2tm(r3io4omtelneils arta(m ;o4apto f3tatls eauvs;(0 ltnmf iodfpteaiei;( seuoxo no1amt  iei s) Dtaxmont1tee ifeiyt m2rmn p t0tlxoif3oydom eaiei () 2urxr nu1ale  nciat)arrm(ront1aex ifetysls ulu p t)areomf3ty1oa e neo () rumxmpiu1ap nlnesatf Dta(mp;u1oee ioeiad s uanvp;u) ltnxf iotfpt  uvi (0 2umxopiodam  lnvia(fs2uru  nt0tptoifciltlaDrlu o;t4tltnmo3totlpDeai il( trxoirpoo1omtelivtas aDrmurono0tle mo3ildfsDemu s;u4 eerio3tatoaDraues;t0sexm(rpou1ol e fviat  Draurp;u1aexoifciys a uaumonu)alxnxrciatla   i o ()setoxo3oo1oltn fvt ( s2trx o;o4tlxnmietadla rm(vp t0tltoxo tadomDe i olt)t2toxm oo4op   nei sfsruaxmoou0ape mo3tytfaDrmn p t)aexoif3iatfate n i;(  2urxo iu4lp  mivtl(f 2umxmont4oeen fetlt m rmuvp;(0aexrioctodopDe uesls0 rur(o3iodoptelnvt s aDtm(r oo0tpe mociadls uau s u0alxnmrcootfpDeln ols0srumxm3io4lmenlneiat) Durxm nu1tle  fcild m ranvont0texomrciodlp  ln ils)seum(o ou1opeemivta(fsDtr(  ;t0tetomieiytfsDra(vs ()tetrmo totlp  livo;s) 2uoio iodal  mieil( artaum ot1tpeomi3iydlm2rmnmonu0 rxnmfcia1faD lnvo t)sexr(mpiy4ape  fvsas sDrmumo;u4aeeoifeiydla2uanvsnt4 ltomo io1lmD li s s  2umxopnu1op nlfvsa(fs2umx p;t4tlt  ieiyslmDuan sn() lerxrcoydlp e u s;()s2toxrpoudlmte ies sfsDrmxrooo1oltomictyt a um(vs;(0tetnmr3iadfptelu i s)seurir3oodaltelnvi tfa2umxront4tltnmf3iatfmDulumon(4 eerifciodopteai s t0s2xrxr oy1lme mnvtlt  ruaxrpoo0oee mo3iadls2em(vs t0 ltrif ia1fpteln s s0s2xrxm ou4ll  lfvilsfsDrrxmpnt0ope ii3ildfm2rmnmp () rtrirciadfaD lneo t0trxmxo no4omt mictasfs2umxro;u1tpt mieildfs rluvo t0arerif tatomDrlivo;s0trurim3ny4lptn ici ()a2tm(m nt4aexoio3iytfa2rl(vp;t0arxrxocoytfmDr uvs;t)tetrxmpno4ol nlict s) 2tr(ro;t0tltnmo3tatfm um(vs t4 etnifcoatlmDeaieo s)teuo(opio1altelfes sf rtrxm ;u4aex io3iyt m ran snt) renircio1lp e nvi t  2ur(o oydom e ivtatf Dtrxront1alxomoetlt mDrln onu0 rxoxf totfp eauvolt0tetrio iy1alen ietasfsrtm( onu4aleo o3tlsfm2rmuvp t)trxoxo tadopD lieo;t0 2tmxrpnu1lmt lnet () 2urxro;t1tet micilsla rmnvpn()trtomr tytom  luvsl() eurirpnudlm nmietas) Drr(mo;o0tee ifetydfs uauvs;t)arxnio oy1fpD anvo ( srtrir3iydlmenmivtlsfs2tau pno0ope mfciytls2el(vp;u0tlxoxr oy1lmD anvo ( texo(r3oo4optnmictat  Drmx p;t1alt iictasla2emu s;u) rxomfciatlmtr ieo;()t2tr(m3ou1ol e fvia( a2rr(r ;o0aptoifetlt a2eau s;(0aeenxrcoadlm rluvolt)texmimpny1olt  iei tfaDtrumo;u0aet  oetatfs rauvon(0 etnxr oytfmtraiesl() rtoxrpnu1llte fct t)sDurxm nu1apxnmo3tad m2uan o;t4alxoiociydomDeaieilt) rxrxrpoodame  iet t  rtaxrpnu4apt ii3iaslmDranms u)alxnmocto1lmD luvilt srumxopno4amtnlieiasfsrtrx ont0alx mo3iyt a2ea(ms t0 exrxo3oytopD  ues;()srtrxmpiy1olte nctl(fs2raum ou1tetoifctyd s ra(mpnu) exoxfciotomD luvi s)trxrxo nudalenmictltfaDur(moou4tee mietldls2ua( p;u)teeoxo3oydlpteluvs ( s2uoxrpiydll e fei tf Dua(mpot1oet mieild m ulnmo u4 lxnmo3oydfmD luei;s)s2xm(mpiu4om nlictls) rurx  ot1tlxo iciatls2ea(vo;t)alermr tatlmD luvs s0srxm(r3nudoleelivtlt arurx pnu1optnmoeiatfmDrmn s (0 lenio tytlp rlnes s0 2xoim3oo4ame mfeil( arta(rpoo4tpt  ietatla2rlnmo;t0trtrir3ta1lmt ai i (  2uoxr3oy4ap n nci t) Drmxmpot4tlt  oeildfmDea( o t0 eenifciatfat ai i;()texm(o3oo4ol  mneiat) Draur oo4alen ociltla elumo u4arenio3iytop  luvs t0 euoim3oo1lpeelfesls)aDuaum oo0oex  ieiatfa el(vs u4aexoxo totfat  i olt  rtm(mpnydlpt  fesl(  Drrur ;u1tltoif3tytfm2raumo (0 ltnmf3iy1lpDeaues (0texmio3oy4ole  fcilsfaDtrx o;t0tpx miciyd a2eauvsnt)aeeoio totopt lues t0srtmimpiu1al e icslt  2tr(mpnu1tlto o3tadfa ulump;t) exnifcoy1optrauvi (  ruoim iu4lmeemivs ()aDtaur ou4tpxniietydfm eanvs u) rtnir3todfpteluvo;(0sexr(mpnu4olt mictls srtax poo0olenif3tasls raump;u4 etnifciotlp  au ols0teuo(r3no1ll nlncsl()aDta(ro;u4tpt ifciadlm2em(vpn(4arenir3iy1opD auvol(0sexrxopnudamt liet ( artrx pnu1aeenio3iydlaDumu o;()aleoxrctytom r i s (  2trir iy1aptnlncs s)srra( o;o4tlxnmietydfm uanvo;u4tltnmf oytfpDrlieo ()teuo(rpiodom e neias a2rm(mo;o4tpenmf3ildfm2elu s t4alenio tadfm  ln o () 2uriopoy1apee nct s)srua(m no0olt mf3tad a ua(mp (4 reoiociotomtelivol() rxmxm oo1ope  ics ( aDtr( pnu1oeto feiad mDeau pnt4 renxf oadopDe u i;s trxmxr3ny1ll emivsasfa2raum no4texnii3tlsfa2umnmont0tlenxo3oadlaDrauvs;( s2tm(m3iu1omtelnci tf 2umurpoo1olt moeiasfsDeanmsnt)aetrmo oa1opD livi;(0 rtm(o ny1omeemfcs s  rurxr ;t4open o3iad sDem(vonu0aeenxrcoatlpDe ueilt setoxmpio1alenlfvtl() rum(m nt0openmoeiltls2rlums;u4alenir iotop  ai o t0srxm(opny4op emiviat)s2ur(m nu4ope  f3tatls2emnmo (4trtoxr3oo1oaD lnes;s0 2xm(r3oy4alenmnei () Dumu p;t1tpeoif3iyt aDua(mo;t4teeoir iodlpDrau s t)teumxopiodaltemict tfaDumurp;o4tptnmoeiys mDeauvp (4tetrif3ia1omDeln s;t0srurir3iodlmenlfcsat)sDumxrpno4alenio3tad aDuau p t)aetnmo3iodopt  nvi;(0srtr(o io1ope  ictas  2ra(mont4olx ioeiys sDeanmp (0tlxnmr iadoat lues s)t2trio iu4opee icsa(fs2rmxrpot4oexnmfctytfs2ua(ms (4tltnmrcto1laDe iei;s)trxo(o3oo4lmenmfcs t arrm( o;t0tltomfeildfa um( p;t)texnmrcio1omtrln o t0seuo(m3io1oltnmnctls aDta(r ;u0alxnmoeiasfm2emuvp u) renifctatfp rluvsl( srtm(m nu4omt mietat  rtrumpoo1aeen fctys a uanms (4 rtnxf oytlpte u sl(  euoim iu4amtemfviltfs2um(mp;u1tex ii3iltla rmums;t4tlermo ty1lpt  uvo (  2to(m3oo4alt mnvtas s2tmur ;t0aeeomictlslm ra(mo;t)aeeoxr iotlpD au s s0seuoxm3nodlpe lfeil()aDraxmpnu4open fctyd s2rlnmpnu4 renxf ootlaDeaivslt  ruoxmpiudlm nmictat)a2rrx  ot0apx ifciytfsDemu pnt0 lermf3iy1lptraneolt  ruoxm3oydaltemnvilt s2uaxr oo4opx  oetyslm2uau o t4altnxfctydlpDraueil(0trtoxrpiy4apeelnvi sfaDuau pnt4aex iociad aDrmump t) ltnmocty1optr ieo s)s2xoiopiy1omenmieils s2rmum ;u4ale  f3tadlsDrmump ()alxrmr3oa1laD  nei s)truoxrpoy1apt lfct s)srtmxmo;o1aeeo oeiydlm2el(ms (4trerif ty1lmtraueilt0t2xo(opou1lle lnci t)s2truro;t0tltomo3ias a2um(mpnt)aetoifcto1lmDr ueilt  2xoxm oo1altnlnvias aDtr(mp;t0apx mieiatfmDum(vp u0 etnioctodopD luvo s t2xoimpnu4omtelnes sfsDraur ou0optnmf3iyd a rlnmp u4trerxf3tytlmtrlneo;( srxm(mpoy4lmee nvtas)aDum(mpoo1aeen octysla2rmuvs;u0 etomf oydopt ln sls0 2to(mpoy1am elietltfsDrr(ronu1teto f3ildla2uluvo t)trxrifciydlat  n i;t0t2tmxr3iydlp   net ()aDtaur no1oetniictat s2el( o (4teerifcoy1opt an ols0 eur(o3ou1lm nmfvia(  rtrurp;t1tleo feiadfs rl( o;u)tlxnmf3iy1omD lieo ( srxr(m iudlpt mfes ()aDtrxmont0aexomoetls aDrlump;(4 etoxf3ootla eluvolt)s2xrir nudom   fvsls sruaump;u0tpenmfctadls rlu p;(4alenir oadlmDeaueils0setm(r ny4ame  feslt  2ua(r ;o1tptomictas mDeanvs;u4trenxf3iy1fm   ivs;s t2toxo3iu4lm n fcsa(  2tmum ;u0tpeomi3tlt mDra(msnt0arxoir3oytlm elneils0s2xr(r3oy1lpe  nvilsf 2rrumo;u1teeomfctltla umnvonu)tleoxrcto1om  livilt) ruoirpny4alen nvsat  Dtr(rpot0ope mo3iadls rmu snt4teeoxr3oa1oa rlivi t)teuo(m3iu1ameelfetl(farrr(r ou4aleomi3iytfm umnmsn(4 lenmo iytfmteli s;()trur(opno4om  mici s)srrrxrp;t1tpx ifcils m2ul(mpn(4arenif3iodomt aivi () exm(o io4opt mnvia( artaxmpno1teenifeiadfm uauvp (0 lxrir tytomD  uvils0tetoimpnydal e net ( s2ur(mp;o1tet  ietaslsDelums u0alenmrcoydopDelu s;s)srumim nu1om e ietltfa2taump;t4apx mo3tld a2ea(vonu4 exnxo3todoaDr nes ()srtm(o ny1ap n nvi t) rraxm ;u1optn octls a uaums u4treomf iodfaDr uvsls tetrxmpiy1apen ieil(fs2tm(  nt1ale mieiatfaDuau snu)aexoxf io1laDr ues;t)s2trxr3nu1lmt  nctlsfs2taxm oo4olen o3tls s2ul(vs u0aexrio iadfat  ivi;t) 2uoxrpiodlmtemncslsf rtrum ot0opto o3iadlmDrmnvp;(4 lermr3tydfpDean il() etr(m3oudlme mfci tfaDtmxm oo1opt  o3iatfa2eanvs u0tltnmr3oo1fat aneolt srumxmpiudal e nctlt artmxm ou0alto f3iatfa raumon() rerio oadfmD anvs;s  2xo(r3oy4lm nlfetasfa2rmurpno1alt mietadla rl(mp (4 exrxocoadlaDrluvi;(0sexmxrpoodlmen fei sf rur(  oo4tlt io3iltlmDrlums u0aeerio3oydlp r nvs t  2toxo io1lleemnci (f rururo;t0aexoifeildla2ulnmp (0tltrxr tatomD lnes;t teuoimpno4alt miet t)a2rrxront0oee mo3iltlmDran s;u0trtnmf to1fa elnei;t)setmxm3iu1omtemncslt) Dumu pot4tex ifciyslm umnmp () etnmo iy1om eaieol()teurxo ny4llee netl(  Dtmu  ot4oeeomo3iysfm2emuvs ()artoiociydfp   nei;t0t2xoxmpio4omeelfvsa(fa2rrxmonu4opt mociydls2rln p;u0trxnmf oatop e uei t)texrxm3nydamee iesl( artaurpnu1opxomi3iadlsDelnvonu) exoxo oydlpte uei (0tetmxo oodaltnlfetat srumxmpot0oeeoioeiadlsDum(vpnt0 exnxrcio1optranvslt t2xoiopoo1lp  lneiasfsDrmx oot1tpt mf3tld sDuln ont0alxrmf oa1latrli i (0 ruoirpno4ll e fcsas  2tmx p;o4opt mi3iydlmDemnmonu4aetrxo3todfmteanes;(  etrio oy4olt lncs ( sDrau  ;o4texoiiciydlaDeluvs;t4tltrmocoatfmt luvo t  rtrxrpnu4lm n ict (fa2taxr nt0olx mfeiltlm2ra( s;t0treoxf oo1fateanei;( s2xm(o ny4ole mnet ()sruaum ou1oeeomi3iaslm2rl(vp;u)arenxrctotomDranei t trxoirpou1op  lfeia() rtrxroou0aetn i3iyt m rmnmonu)arxnmr3ootlmte i sls) exoimpou4lp  livta(  Dtrumo;t1opeomoeiltfmDrmump u0artoxo tatlptrlneo;s0tetoio iy4lpte nei s  Dum(m ;u0apt mocils a ra(vo;u4 reoioctadfmtr neolt s2xrxr3no1omenlfetl(f rrrxrpno1oeeomfcild a ulumpnu)aexnxrctodoaDrln s;(0trto(rpoodlp emivt t)sDtaxm ot4tpx mo3iltfa2ua(mo (4aeenxfcoa1oaDrauvols0seuoir3iudape micslt)sDumumpnu0tee if3tls mDemnmp u0 exoif3oadlmteluei;t)s2to(o iu1amt mivsa() rtmxrp;u1texn feiatfa2uanmp (4 eermf io1lmt  ieo (  2toio iy4omtemiet sfa2tmx  nt0tee iieiys m ul(ms;u4aexrxf3oo1faD  n o;t0 rtm(m nudam  lieslt  Dua(m ot1opxomoeilsfm eanms ()teerxr3tadopDeln i;t  exm(opiy4lm  mfetlt s2tm( ono1ope moetldlm uln p u)trxrir3oadopte i ils)srtrio ny1amee fetlsfaDrr(mp;o0alt mfetlsfs2raump;u0 leomfcta1opt aues t seurxrpoo4lme livsls  Dumumo;o4apx  oeiytlsDrl(mo;u0aleniocootla eanvolt) rumio iy1optnlfvtlt s2raum ou0alxoioctldfa eau o (0artrxo3oa1omteaivi ( setriopoodlm nmfci ( srurum ;t4tlx ifcias s rmu s t) rermr3todlptrlnei;s) 2um(r3oydol   fvsl(fa2uaumono0aexn iciltls umump;t) renircty1lpteai ils0setm(opiy4amee nvt t)s2rmxr nu4oltoiicild s umn snu4trtniocoydfmt anvi;(0 eumimpnudlpt mnci (  Dua(m nu1olxo fetyd mDulnvp;(4aetrir3tadlm eau o;t0 2tm(r3ny4lmtemnvi sf Dta( ooo1oeenifciydlsDemu p;t) rtriocootopDr nvolt)teuoxm nudllenlnes t) 2tmu o;u1open o3iatfs2em( snu) rxrxo3tytlm   nvolt0 exrxmpnudaptnlnviat  2umxmooo4tpeo i3tadfm2ul( ont4 rxrxo3iy1lpt anvo s)srxrim oy1llt  neils artrx pot0tpx mieiydla2uln o t)tetnifctodoate ivils)srtmxm3oo1lm n nesat sDua(r ;u0tlxoifeiytfsDrmnmo u4treoif iy1fat an i;t) rum(o oo1lpe  fet ( sDtau pot4tpto ocilsfs ulnvo;(4trtnir iatfmD aivs;t seum(r3nu1om emivt (fsDtrumo;t0oeen ieiyslm rluvo t4tltoxr3totopDeaivsls0t2umxrpiydale  nesat srumx  ot0tpx mi3tls aDrln s;t)treoiociotfm elivo;t) ruo(r3nodomt mfctas a2rrum ;t0tlt  feiat m ra( p u4 rtrxo totoate u o;t)trxo(o3oydam nmfei tf 2um(mono1apxoifctad aDemnvo;(4tlenxociodlatrlneol() 2xoir iu1apeemictltfs2tmum nu1optoiiciysfmDea(vo t) exnircoytlmDeaivs;t trtm(m3oydomtn fcsas sDurx oou0aetomiciasfa umu s;u0trxoxf iytlpDranvo (0 2xoxm3ou4ole  netatf 2rmxmp;o0apeo feiasfm rmuvp u0altrmo3tatlaDrauvs;()s2um(m3no4ap elfcsat  2rrur oo0aetomiciatla emnvs t)alenmf iytfaDr u o;s0sexrim nu4amtnlietat) Dra( o;t4aexnmo3iyd s umu o t4 exnircoa1oaDrlnvs t)sexrxm3ou4lleelies s) 2ua(  ;o4texn feiaslmDrmnmo;u)teermr oydfpDelivsls0t2xoim3no4amt lfvs t  rtr(m nt4tpxoiieiasla uanvs;(0aetnmr3todfa   uvs t truoxm3oy4lp elncslt arta(rpou0tpx mieiat mDemumo;(0 etnxo3to1om  luei ()s2um(o iudapt lnvsas)aDtaum no1opt if3ilsfs um(ms u)teeomfciydoaD aieolt)setrxr iy1lm  licils  Drm(r ;t4apxnmo3ildls2el(mo u)aetnmocoodfaDrlneo;t) rtr(r3iy4op  lnviatf Dtmu pno4oee moetldfsDraump t)alxoio iy1opD  neolt)s2xmir3no4apee ncias) rua(r ;u1opto feiytfs um(vp;u)trtrmf oa1lpteaies;s0t2toimpiudlpenliet t)aDtmxront0teeoii3tlsfsDrlnmo u) etomr tytla eau o (0 2toxrpoodam e ivi sf 2taxrpnu1oexo iciydlm2rmnvs;t0aleoifciytfpD auvi t)tetmim no4ame  ivsl()sruaump;o0altomocilt mDumu s u0 ltoif3io1faDeauvi t) eumxr iudomte ivt ( sDurur ot1oexnif3ilsfm2rlu p () etnmfcto1oa e ivo;s)setmxr3ny1lpe lnci (fs2um(rp;u1apxoiietat m elu onu0tlermocio1lm  aneol()t2trio iu1opte iei () rrmu p;o1tex  fetlt a rl(mp;u4arxoxf totlpDrauvo s)s2umim3oo1opee icsl()srtrxm no1aet io3iytfa rm(ms (0 lxrxocoytopt anvo t) 2tmim no4opeelnvtlsfs2taxr oo1alxo ietlt s ran o t4 etnxocoy1omD  u i t0trxo(mpou1optelivtas s2tmx oot4aet moctat m2raums;(4teeoir3iy1omtrau o ()t2tr(m no4amee fetlsfa2urxmo;u0alenmfeiat m em(vsnt4alxomr3oy1fpt ai ils) exoxr ny1alenlieiltfa2tmump;o1aleo feiyt sDrmnvp (4 rtnxr3ia1fm eluvols)srtmxm3io1aptelivt ( aDtaxront4teeniociydls2umn p t0aetomf oodlmteai s s  eur(opoydopenliet tfaDua( pno0olxnifeiltfa uau p;t4tlxnmr3tydomtelivslt0texm(r ny4lmtemiet ( sDtmump;t4aptomo3tydfsDemnvo;(4texnio3iytopD liei;s0 rxo(o3iudamee iviat) rtrur ;o1aeeo feiytfm2em( p;()aexrir oodlpD  i s s) rxm(r iu1aptn fcilt)sDtrxront1apxn iciyt a2eanmp;(4texrif tatlpt  u olt0sexo(o nu1lpeelietlt aDurx oot1optn fciys sDrlnvs t4texnmf io1lmDraues s  2um(m3iydopee ict t)sDtr(roou1texoif3tytla rlnmp;u0teenxr3oydfmt anvo;t seto(rpnodlltnlnvia(f Drrump;u1opt  i3iydfs ea(vp;t0 lenxo3tatlatrlnvslt0trtm(rpoo1apeelics ( a2uaumont0opt micildfa um(vp (0altoxrcoadfpt  ivo;s0 rxoxopoy1ame mivi ()artm(mpot4tltniictasfa2emums;u0 exnioctytoa rliei (0sexmxo3io4lpeelneil(fa2ur(rono1aee mf3iatfaDel(vpn()aexoirciodlmtean o;(0 rtrimpou4llenlncs tf 2rm(rono0tpe ifctytla2rauvsn(4arxnif iy1lpDeaneo;s)s2xoxr oudlp n icil()aDtmurpnu4oltnmiciadls rlnvs u0 rerif iadlmtelivil( seum(o iydop   nci t sDrr(moot1teeoifctlsfm2ra( o t4tlxrxocootla e nvi;t0t2xriopou1omtemfeiatfarurxmp;t0tptn oeilsfs umu on()artoxf tytfaDeluvi;s0 2xoim3io4op nmictl(  2tau ooo4oleomfeiltfs el(vp t4 rtnmr3tatfmt  n o;(  exrxm nu1alte ieia(f 2umxmoou0oleo iciysfm emnmo t)tlermr oodfa raies;(0trxoxmpnu1al   ictl() Drmur ot1apenmiciltfa emnvsnu0artrxf3iotfa raiei ( sexrio3oodlme  neiat artmu o;t4tlxnmieild sDrau p t)artnio todla  aieil( s2tr(mpiudolt lnvslt arumu ono1apxo fciatls2ea( pnu4aexoxf oa1lm  anes;(  2xo(opou4op elict s srua(mpot1apeo fetatfa2uanms;u4aeeriociodfpDraueo;(0s2urxr3oy1lpe lnctls) 2taxroou4tlxoifeias s2ean p u0altrmr oa1faDr ies;t0seuoio3nu1ap nmivtl(fa2trx ont0olen ictys mDemnvo;t4 ltomr3oatoatelu olt0s2tr(m3nudam e icsl( srurur ;u4apen o3tadlaDuau o t0alenmf iytoaDeanvi s0srxr(mpnu1lm elfviltfs2urump;t4opxoifeildlsDum(mp;u)aeerir tatlmt lu s;()seumir oydole  iesas aDrr( o;u1oex mictldlaDrlnmonu)altrif3ootla   i s t)texoimpio1omtnlfetas)s2umumpno4tpeoii3iyd m2emnvp u0 rtrio ia1lat lieil(0sexm(o3iudlp n fctlt a2umu o;u4alenmfctyslaDeau o;(4texnif todomDelivi t sexmxo nodlmtnlfci t)arur(r ;o1oltnmiciat a rln pnt4 eeoir3iytfpD  n o;t  eur(r ou4ll   nesltfsrua(  ;t0tlx mf3iasls2rmnms () eeriociydfatr n il() rxoxm3iu1aptemieias arurxrpnt0texn icilt aDranvo;()alxrifcootfat luei s)sexmiopnu1olen neias)arrmx  ;o0aee ioctydfs umnvo;t) rtrxf3ootfpDeauvilt) exmxmpoydam   netlsfsDumuro;t4tpe  fciys aDeauvp;u0arxnmociytfpDrlu ols) rtmimpiy4llenlnviltfsrra(m ;t4tptomfctytlm rmump;() lxrmr3iadfp  lueils0s2xr(m3iydolte fcs sfs2ua(m nt1tleo o3tad sDeanvp;(0 lxrxo ootfatelneilt trxoxo3iy4ameemfcs t  Durxmpno4oleomf3tls m2elnvs;t0artomocia1lateluvs s tetr(rpiu1lpenmics ()aDurum nt4optn feiad a2ulump;t0altnmr3tytlm rlivslt0texmimpoy4op   fvslt) Dtrumonu4olenii3iltls ua(mp;u0 lxnir iatfm raueilt  rumio3iu1omenmict sfarrmurpnu1teto ietad mDumums t)tlxomf3oa1fm  ai olt)trxmxo3iudome lfcs s a2tm(  ou4olt  i3iad mDelumo u0texnmf3oatlm r n s ( s2trxo oy1ap emnci () 2urxrpnt4aetoiociyd s2el(mo;t)alerxrcto1faDelivil()setrxrpiy4lptnlfci ( a2ua(  nu0tle  iciltfsDua(ms t)aexnmo totlp r ueolt0 rxmio3ny4amte nesls)srurxm ;t1olx  ocias a2eanmo;u)teeoif3totfmtrlneo s trtrxr3oydlp n fvt t)srurxmpnt4optnif3iyd aDel(mp;t0texoxoctodomDr uvs;()texrxo iy4ap n fvi (farrmum no0ole ii3ilsfaDrmnvp t4arxrmr iotopD lues ()t2xmimpnydole lfvt t  rua( pnu1oex if3tydfs rm(msnt4 rtnxrcia1om elivs s  rtoim no1omt  fcil(farum(mpou0olto fetyd sDuln p t) etnio iodomtr u sl() rtm(opiu4aptn fcsl()arrrxm nt1aleoif3tytlm uluvsnt)teenxf oadlmDr i i ()s2tmir3nu4opte ivsa(fartrurp;t4alx  f3iyt mDuau p u4tetnmr3iydfa raies s sruoxopiydom nmnesa()srtmu  oo1opxoiieiatlm2uauvsn(4aexomrctytlptranvi;(0 2tm(rpiy4ape liesl()srrauroot1aexo fetyt mDrl(vp;u4alerxf iotlatr u o;t0s2tmio3nu4opt liciat a2rmur oo4opxnif3tydfm raumpn()arxoxo3todfpDrlieo;s0trtr(r3iu4lmen fvtltfa2tm(m ;o1tpenmf3tat s elump;t) exnif iydoa  lu ilt srxoir3iy1lltemnci sfa2uaxmooo1alt  o3ildfa2uan p;(0tlerio tydlmte ies t0s2trirpou1omte feilt)sDtm(rpnu0aexo oeiyd mDeauvs () reoxoctydlaD auvols0trtm(o nodlpenliviasfsrua(mpnt4tee  iciyd a2emnvpn(0 rtrxrcia1lpteliei;s s2tmimpio4omt  ivta( s2rmxr ot1apxnmieias s2ul(vp;t0aleoxrcoytfp r nei (  exr(r iydlp e ncias s2urx o;o4oet moctyd a emn p (0 exnir oy1oa e n o;s  rtm(o oo4amenlfvtls)aDrr(mono4tet mociys mDrau onu0 rxrmfcoo1lmDraiesl(0 2umxo nu4ameemici ( sDua( o;o1opxn fetldfm2rmumpn(0arxnxf3totop elnei (0trxm(o iodlmenlfciatf rta(rpou1tetn f3iytfaDemnvs;u0 eenir3tadlpDelu sl( trxoxr nodom nmfvsatfarrmu pot4tee ifetad mD
\ No newline at end of file
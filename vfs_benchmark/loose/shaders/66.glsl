@@ -0,0 +1 @@
+n i;s)t2urxm3oudlm   ncsat)arurxr ;t0apxnioctyt m ul(msnt4trxrir tytoa raieil(0t2xmxm3oo1altnlnesl( arur( ont1apxo feiadfs elu snu0aexoircia1oa r ueo;t  rurir3ou1alt lnet ( sDtmumo;u4tet moetls m2rlnmo t) rtrir to1lmDe nes (0trtrxm3iydoptnmnetltfaDtru onu0oltn oeias mDua(vp;u)tlxomr3io1op  lnei s teuoimpnu4omt  iesa()arua(  ;u1tpx ioeiadlmDemnmon() rtoxf iotlptelnvs;t0texrxr3oo1om elnes (  rtrx ont0tpt miciysfaDem(mo;t0 eeoif3ia1lat lnes;t t2ur(rpno1lmt licsls)arrau pnt4oex  ocilsfs2ua( p t0tetrxo tatfmDrlnvo t0 rurimpno4am nmnciat a2ua(  ;u0opxn octysfm2raumpnu0aleoxf tydoaDr uvo s0s2xo(m oy4opt  ietlsfarrrxro;u4aex  fctasfm rm(vo;u4aetnxrciytoaDrau s ()teur(rpoudomt liei ( srua( pnt4olen iciadlaDua(mp u0tetoifciytfmtrluvi ()setrimpiu4am  mivil(f rtaxr nu1tet  o3iyt aDem(mp t0tltnif3io1fp  aieo t)t2toir3nydal n icsa(faDrrurpno4olxnmoeiatfs2el(vont0aeeomf3todlpt  u slt0texrxm3oo4amt mfvils)sDtrxmpou0tee moeiytfmDea(mp () ltrir ootlpt lnvi;s0 exoimpou1omt lfviltf 2rm(mp;o0oltoiocilsla eau o u4alxoxrctydomteaies;( s2tmim3iu1lp n fei ( aDum(m ot0tlxomoeiat a umu p u4 etrio3todoptraieo;(0sruoirpoy4ameelivt t aDtmu oot0olxoiociydfsDrauvpnu0tlermr3oadfaDe ies;t t2tmio3oodapenmfvtls  2taxm ot1apxoio3iatlaDem(vo;t0tetoxrcio1lat anei;s texmio3ny4optnlictl( sDuaurpot1oetoiieils a rlnms;t)arenxr3iydfaD lu s;s0s2uoxopiodoltn nvt s) rur(m ;t1tpe  feiad m el(vp;u)texnmr3oatla rln il() rxoxrpio1oleelivsa(f 2tm( p;o1aetnmo3ild m2rlump (0tlerxr oatoa   i i s)tetrxmpoy1omtnmfeil( aDtr( pnu1oeeo iciysla ua(vs;t) rxnxfcoo1fmDraues s t2tm(o3ou4om emfetlt)sDraurp;u0teenmieiytlaDulnvpnu)tlxoir3oytoa eaivi t0 rxmim3iydale lfvs (fs2ra(m no1tltoiiciys a ulumon(0 rtrxoctotla  aueo (  exm(r3no1apte fvia(faDrmx onu1oetnmo3ildla2rauvo;()trtnmf oydlmtrlueols teuoxrpiu1am nmfvslt)arrm(m ou0oltnifetatlaDemnmon(4tlenio3ootlpDrluei (  ruo(r iodolt lfcil(f ruax pou1apx iiciysfa rlnmp;(0 ltrif3oa1opDe uvolt)s2tmio iy1op nlnesl(f rrmur nt0oetoiieiysfsDelu s u)tetnmf iodomt anei;s) rumimpnu1aleemivs s srumu p;u4alen o3tltfm eluvo (4 ltnir3iadomD li i;t  exo(mpoudlltemivtasfarrr(monu1ape  fctlsls eln pnu0trxnir3tadoa  an ols) etoxm3iy4ol  lneiasf ruau o;o4tpe mietldfm2uauvs;t0aeenmrciadfmD aivs t) 2xmxr io4omeemfct ()a2tax p;o1optnmicias a2rmn s;t)aleoxrcoodfpDelnvol() rurim ny1op nmieslt arurx  oo4alen f3iadfaDuanvpn(0tetnmo3iodlp r iei t  rumxo3iy4openlneta()artax p;t0oleo ieild s uauvp (0tlxoio3iydlatean o;t0t2xoiopnudomeelfcils  Dtr(r nu0tlt ifeilsfsDemnmp (4artnmr io1omDraneo s0 rum(r oydolee fvtl(f 2tm(mo;u4ape mociasla2ra(vsn(0tlxrmr oodfpD aieslt trxoio3oo4lptemiviatfarrmxm ot1ale ifctasfs emnms u)aexomf oadla  au s;s)t2uoim3iodllt lietl(f rraum nu1tlt mfciatfm2rmnmsnu0aeeoir oodom eanvols0s2xrio iodom nlivsat) rtmxm ;t0texoiociadls2eln p;t0aetrioctytlmDr ivo t)srxm(o3oo4ome  ncia( artmurooo0oeeoioeiltla emnvo;u)tlxrxociy1laDrlu o;(0sruoxr nydllteliet sfartm(  ;u4texoifeiadfm ea(vo;u0teeoxocia1fat auvi;t)tetr(r io1lme mnesatfs2rm(m ou1aee mietysfmDraumon()artnmf iytfmD ai ils0trxoim3iodlpe  ivtlt) rta(r ;t0optoifeild s2ulnvo;t0tleoxrcoo1oate uvo s0seuo(mpoydale mncs t)srumxmont1oltnmiciysls2eanvsnt0tleoif3tydlptr ivs ()tetmxmpiudamt  ivi sfa2rmxmp;t4aexnioeiydfm2eln s (0 renmoctotoate ivi;t teumim no1lp elnes s  2rmu  ou4tpxniociydlmDrmnvs (0tlxoxo tatoaD luvs t teto(opoy4lmenmiet s)artrxro;t1oeto iciltls2rmuvon(4 renmf oo1lmteai i;s0trtoxm nodapte fcslt)arrr(rooo0opx ioetatlaDeluvp u) eeoxf3tadomDr i olt0sexm(rpou1opeelivt ()srua(mpno1tpxnmf3iydlsDrmnvs t0 etrmr3ta1omtrlnesls0seuriopoydlmt  nvtlt  Drmumpot0oetoifciydls2ul(mo;t)aetrxrcoadoaD luesls0texmio3nu1am emfcil()arrrurp;u1alx  oeiat s2em( pnt0trtrmf io1fa r ueil(0 rtr(mpou1al elneilt  rrm(rpoo0tex  ocildfa eaumsnu)tetniociatoa r i ils) rtrir nudlltemfct t)artm(mpou4opeoiiciys a2umu pnt)texoifcoa1fmt lnei ( texm(rpoodamtemieslsfaDtaxrpou0apt mf3tldla2rmn ont4tlxrxo3iytfmD auei ( sexoim ny1lp elfci tf rra( o;t1apt mo3ias sDrmuvpn()trenirctatfa ean i t0 eum(opiu1lmee nvt s a2tmxr ;u0apen iciytfm2ra( o;(4 lerifcia1oa eaieslt) etoirpiy4ll elfesat) Dur(mooo0apxnmicildfaDel( s;u4altnmr3iatopt auvs ( seuoirpiu4lpt  ivt ()aDraumono4apenmfeilt aDrau s ()artrmr tytoaD li olt0t2xrim3iy4om n nvilt)arur( pnu1opto ietlsfa emu p;(4treoxfcoa1opD  nvs ()srum(r3iodale  ivslsfaDtmxm no0opx mfctlt aDumu o u0treriocoo1fmteai il( setr(m3nu4ol  lfvilsfsDrru ooo0teeoii3tadlaDra(mo;u) ltomocoatfpte n ilt0 rtrio3io4op elicta() Drr(mpou0tlx if3ilt sDea(vs;(0trenmr oy1fat luvsl()s2ur(mpiy1alenmfct s)a2rr(  oo0apxnmiciytfa2ranvpnt4 rxnxrctydoateauvolt0teum(opoo1lm nlnvias artrx ono0aetnmf3tatlmDra(ms ()aetrmr3oodoaD  u i;s0 rxoir oy1omt  ictatfs2ta(moou1apt  o3iadlsDemn p (0 rxrxfciydopDr ivs () 2trim3oo4omeelictlt)a2ur( p;o1altnioeild s rlu pn(4altomfciotoaDr nvsl(0sexm(rpoy1ole  nvslt  2urxr ;t1ape  oetltfs2emnmp;t)teermrctodoptr n ols0tetr(r oydop emfvia( srrru p;t1tpenmfciltlaDrau s;u) rtomo to1fate nvo;() eurir ny4llenmici s) Durumpoo4aptomfetasls2ul(vo;t4aexniociy1fpt anvo;()t2tmxm3nudaleelieiat a2trurpou4altnmi3iad sDea( s u4alxomr io1omtr u olt0 2xrim3no1alt  ieia(  rtrxront1tex mieildla uln o;t)trenmrcto1fptelnei s0s2um(o ny1amtnmies sfaDrau  no1alxo o3tasfs2rl( p (0arxnirciodom e ieo;t  etmxm iydlm  micta(farum(r ;o1olt  octytlsDuluvont0areoiociatomDr ivi t sexr(rpiy1lmt lfci t  Drmx ont0alenio3ilslm2rauvp;t4trtrmo3oy1lpD lueil() 2xr(o oudlpt lictl(f rurx o;u0tex iiciadfs uau p t0 eeoif3iatopDeaues s0 eurim nu4ope  fvtatf rrmurpnu0oet iiciyslmDuluvsnt4tltoxf3iytlatr ueo;s0sexoxopoy1amenlnci s aDraxmp;t4tpeomf3tltlsDrl(mp (4teeoxo3ty1fa elnvols) rtoio ou4llt mietas aDtm(m no0olxnioeiad m2umnmp;u)trenifciydopteli o;t teur(m3ny4lle mnct (fartaxrp;u1tee  i3iyt mDrl(vp t4altrio3iydomtean ils)trumim3nydamee nvil()sDrm( pnu0alx  feiydfa2ul( o;t0trxrif iy1fa r u i s) eurim3oudalt miet sfaDua(  ;u4aetomf3tldfa2um(msnu)tltnir iydlp e u i (0 rtrimpiudlmt mietl( sruru pot1tlt  ociad a2ua(ms;(0tetniocoadlpDr i i s) etr(o iudap  lics ()sDta( pnu4tltoii3ild aDulumo;u)treoio3to1lpt anvil()teuoir3nydam nlncsas sDtm(mp;u0tet  fctlsfa2emnms;t)tlxnxrcoodfa r ieils0s2trxmpoy1lleelfct sfsDur(roou1opt iieiat a em(mp;(4aexomo oadomte nvi;s0s2xrxo3oo1lmte fcsa() rtr(  ;t1oeenmiciltlm2eaumpnt4aleoirctytoaD au s;s)trtr(m3nudom nlfvsls) 2rr( oot4oltnmi3iadlmDuln o t4 lxomo3ia1lmDeau i;()teto(o3iydlleemnesls)a2tax ono1oex if3iat s rl( s u4tlxoir3oydoptr nes;t  2umxm3oy4al  mfvt ()sDra(m ;t0teen feias m ua(mpn()areoxr3tatfatrli i;( t2umir nu1om  mfcsasf Duauroot1apxo ieiat a ulnvo;()arxnmrciodfp rln o;t0tetr(m3io1llenlfvs s)arumu oou4olx moeils m2eauvsnt0 ltnxo3oy1lp  aivslt0t2tmimpio1omenlncilt arrm(m ou0optnmo3ilslsDumn p;(4aleoxf3iydfp eaivil()srxmim iodap   nesltfs2ta(  nu4oetoifctyt m2um( o;()alxrxrctadoat aiei t s2uoxm no4ap emnctlsfa2rruronu0texo feiyt sDemnvp;u4arenmf3oo1la rlnvolt0sexoxrpoo4oleelivsa()aDurxmont1teeniociyt m eaumpnt)aeermr oadopt  n o;()s2to(r nu4olt  ietl(fa2tr(rpoo0alxn f3tltlm2emu p;(0aexoxrciatom   nvol(0trxoxopiodom  livta( srrm( o;u1aeenmoetls s ra( o u4aleoifctatfmDeaivs;s0sruoxm3iudam elfesat)s2raxm ;o4olen oeild m2umnvs;u) lxriocootfp r u olt)t2umir nu4amtnlivt ()a2tr(m nt1alt ioeiys s2emn s;u0trenmoctotoat liei;(0s2toxo oy4ap nlictat  Dur(r oo0opxnmieilt sDea( snt)texoircootoa e ies;s0 euoxm oo4lltnmncslsf 2ua(ronu4tlx mi3iysfaDeau s;(0arerif3ia1lmte u o t  etr(o iu1alt mnvs (fsDuau  ;o4altnioeiatfa2umuvp u0 leomr3totla  aneol(  rxo(o iudop elici s)srtrxm oo0tex moctldla umn snt4 ltniocoadlatraieo;t t2to(r3iu1am elnei (  rrr(mp;o1apenmiciytfa uaumo;u)alerif ty1omDrlueo;s  etmio3oy1amt  fetas srrr(mpou4olxo octadfm2rmnms t4alxoif3oodomDeluvi t  2uo(rpno1am e ics t) Drmxmpot0alx mfeias s2eau p;(0 rxoxoctotop  lu ols0 exmxrpnydlp nlictlt)aDrrxront0tlxoioeilsfa2rl(mont4arxnirciy1opt lneo (0 eum(o iydape mfciat)a2rmumooo1tlt ii3iydfmDrmu pnu0texrmf oatfpDrlnvi t0s2xo(m iy1opt mictasf 2rm(mont4apenioctysfaDel(msn()tlxnifcoo1lpDrlnei t teumim3nu1op  mivi (fsDrm(ro;t1texomfeiat s ul( s;t4trermr ta1op  au ol(0 rxo(r nydlm   ncil( s2taxm nt1tpeniiciys a um( pnu4 rxniocoytfpt luei;t0sexoxrpiy1ol nlivt () ruau  ot0aptnmo3iaslsDumu o;t4 eeoxf iydoat aieil( trtm(m iodamt lnvias  Duru pot0tlxn fcilsfm2rlnvs;(0artrxr3todfp rliei t) 2toxr3oy1openmiciltfaDtrxrpnt4oeeoio3ilt s eauvsn(4 lxomo3tytfm r nvs t t2xmxm nodal emncils arra(rpno4aptomf3iadfs2rmnms (4tetoifctytlmtrlnvs;t  ruoxm3iu4omte ivsl() rrrur ;t4apeoifetasls2uauvs (4tlxoif ootla eluvs;s sruoiopiodlltemnvslsf rtmumo;t1apxn feilsfsDrlnmo (0trxomr iatlp r n s (0s2um(o3oy4olte fcs sfa2umu  nt0tpeo fciasfaDul( pn(4texoxocty1opt auvs;(0trtrxr io1opee ncsasf rtru  no1apto octatlaDulnmsnt0altrmo oatoateanvolt s2xm(m3nu1alenmiesas aDrrum ou4apt mietys sDumuvo (4altoxr3ty1laDelnvs;t)t2xo(m3oy4apenmnet s)aDrmxmpnt1altoioctlt m2rm(vp u)artrxf iydfa elnvs;t  rumxo oydlm nlncs t  Dtrxmo;t0altn ieiydfaDemn s;u) reoircto1om eau o;()setmio3ny4omt lnvsl() 2rmxmpnu0olxnmicils mDemnms;()altnif3ta1fp ranvs;s teurxmpoydll nmnvsls)a2tm(mp;t1oeeniictydlaDeauvp;t) eeomf3oadop raueilt)trxoir nydomeelivt tfsDrrurpnt1olt  feiatls2eauvo (4aetnmfctatla rluesls) rtrxr3nydaleelnetl(  Dtau  ;u0ope  i3ilsfsDranvo;t4tltnxr iy1laDeaiei;t) etm(o3nu4ole  nctlt  rrm(moot4aleo ociatlmDra( s t4tlenxfcoy1lpt  u slt s2tmxo3iy1op n ivilt)aDtmu poo4tptnmo3iysls2um(ms t4teeoxo3oy1opte nvo;s)srtmxmpiy1lp e fet tfarrrxr nt4oleoioctaslaDeanvsnt)aetoir ia1lpDrau o t seurir iy4lltemfes tfsrurxroou0apxoiietltfmDum(vpn()artrio3ia1optr n ilt trtmir3no1op  lnei (f ruau  no4tex iiciyt m2uln pnu4 rerirctytom rln il()s2toxrpnu1al  lnvils)sDtm( o;t4optniociyslmDemu p;u) leoif3todoptrlnvsl(0s2uo(r3ny1ap nlics tfaDrr(m ou1aleoioetlslsDum( on(4aeeoxociadomDr ueo;s)srtm(o3iudlleemies t) Drr( p;o1teen oeiysla um(msnt)aetomf oy1om  aies;s tetoim iy4amenmnvtas aDrrxmonu1alxo fetas mDrlnmp t4 rerxo3oodoat  uesl(0 exm(m iu4amt  fvs t srta(ronu4texomf3tlsla2rmn sn(0aleomf ty1fpte nei;(  2umxrpnu1opt micta( srrru  ;t1tpxniicils s eanmsnu4tlenxfciotfmteauei (0trxrxr3iy4lpt licslt)s2rrum oo4tlxnmf3tys a rmn p (4texoiocootlptran ils) rxoir3no4opeemfeias) rrrx pou0tpxomfeiadlaDeauvonu)trenirciy1fa r iei;t  2toim oy1ll nmncsl( aDtrxmp;u4ape  ociatfmDelnvo u4 etrxrcoytlm  ln ilt)s2xoxopny4amt  nvsls)s2tauronu0aex  fctad m umuvp u4trenxo3iadfp elnvilt)srumxo3nodopt  icta(  Duaur nt0tpe mo3tldlm elumsn(4arenmr iytlaDr iesl(0t2uoxmpiydalt lnvia(fs2rrurooo0texn ociasfa2rln pnu)teeoif3iytfm   ieols  rxm(r3oo1lltnlfcslt)arurxroou4tptoif3ils s2ran o;t4 etnmr3oy1fp e uvslt)trurirpoo4al   fcsls a2um(mpno1tleomieiad m ulnmsnt) rxoio3tydopDe ivs;t) rtmxo3iy1apt liet tf rraxrpoo4oexomieiyslm2ea(vsn(4 rtnmfctytfmt auvol(  2xoxr3oy1ol nliei t) 2tau poo4altomi3iys mDum(mo;(0arxnirciytlat  n i;t)srxmxmpoodal emivs s)aDrrump;u4oleoio3tlsfa umuvpnt0 exrmoctotom  au i t srxmxrpoodomtnlfetl(faDumur ot4olxnio3iaslsDrmu p (4tetoio tadfpt liesl( trtrim3oodlpt  fvs tfarta(roou0alxniiciys a2rm( s;(0aetnmr3tydoaDr nvols)tetrxopoo4ope  fetls) Drmxroot1aex  f3iydfs2rau p;(0trerxf3totoat aiei t trur(r3nu4llen nes t arua( o;t4tle  i3tysfm em(vpn()tltnxr3iotla rlieo s0seumxo iu1ll   ici sf 2tr(moou0oltnmictatfm2eln o (0artrxr ia1oat lneil(0t2xrxrpoy1am   nesltf rtaum oo4apt  fetld m ul(mpn(0artomfcto1fmDe uvo t srxmir3nodolt lfviat srrmum nt4tex  i3ilslm2raumsnu0trenxr totomDrli o;(0trtoxm3iu1amenmietlsf Dtr(rpnt1oetnmi3tltlm2eluvs u0 rxriociatop eai i;s)teur(m3oy4lpe lnvia()arrau pnu0apt  fetysls2rluvs u4 rxrir3ia1fa   neolt0 rurxm3nudopen feias artaur ;o0aee iictls s2em(vont)teenxr iy1lmt anvi;() etrio nydamtnmfctl()a2rmxrpot4oexnio3tytfa2rlumsnt4arxrif3oydfp  au i s0s2toxo3oodomen nvslt sDurum ot1aet ioctatlm rlu o;u0 lenmr3oo1optrau olt)seur(m3oo1ape lnvs (fa2ra( ont0aetnmo3ilsls2rlu o;()teerxocoydlatelivil( sruoiopno4ome micsl()sDrrurpnu0tptomicias s2ul(ms;(0trxrxociatfa rai ol(0 2xrxrpno4opee fetat a2ta(r no4texnmo3tltfa uauvsn(0 rtrifciodlp r nes s)s2xr(m3iu1amtemivi tf rurxm oo4tetnmoeiltls2rm(mp (0trxoxr iodop r uvi;t  etmxo3ny1op nmivsls  rraur ;u4oex if3tysfs2rl( s t4treriociodop ean i;s)trurirpnodapt  ici ( aruaxmoou1tlenif3iyslmDelnvs;u)artnmf3iatoa r nesl()teuoxopiy4ol e ivsl(fartr(ro;t4opeo ieildlmDel(vpnt)trerxf oydla  lu i;( srum(o3iu4lleemnciatfsDumu ont1alx mo3tlt s2ra( p u0tlxoxr3io1opDr ies s  exm(o3iu1olt lncs sfsDtru o;t0aeenmiciltls em( o;t0alxrirciadoaDranvils) 2xoxm iy4om nmfvi t srraum nu4oee iietltfm2ra( snt)trtoif3iatfptrlueo;(0t2uoio iu4lpenlivs (fa2tmurp;u0ole moeiltfmDranvo ()trtrio tydoaDeau i;s  exmim oo4am  mnctlt srtrur nu1olxo o3tld sDel(mp (4 ltnifciatfate ues;t srtrxopiydamtn ivt sfaDumum ;o1opt iociadls2rmnmp t4teermo io1lpteli o s0trurxm oy1openmfvtl( s2ur(m oo1olxomo3ildfsDum(vsnu4aeenmo totla rli s s tetm(rpio4omte ivtas) rrrxrpoo0tpx mociydfm uaump;u4arxoxfcoytlaDrauvo s sexo(o ou1om emnct () 2ra(rpoo0aex ioeiytfs rlnvon(0arxnmf3iadfa e nvo;()sruoxr oy1om n fes s)s2umurpnt4apt io3ilt s2ranmp;(0tetrmf oodlm  li o;s)srumxopoudomee ietlt) 2ta(r ot0alx  f3ildfs2umuvont)aetoxr3ootfp  ai i s0 etmir no4olenmnvs s  2raur no1aet iiciytls umums;()treoio3oadfmD  ies s t2umxrpnydlptnmnei tf 2rrx pnu1olen f3tatfsDeau p;u0texnxf ia1faD an o;(0 2urim iydom emiet (f 2urxrp;u0aeeniiciat sDulu ont4tlenmrcta1fmDrluesl( seur(o oo4ale licsl()sDtmu  ou1aet iietadfm rm(vs;t)trxnmr3oatlpt livs;t0s2xmxrpno4lmte ieil() 2urumonu0ole mf3iltfs2eanvsnt4treoxf ty1lp r neolt0t2to(m oodlmtnlncs s  rra(  ot4oetomictlt m ea(msn(0aeermr tatomDraivslt trumxo oudlme  nvtlsfa2trx onu4oltnmfciysfm2umnmp;t)tlxrif3iy1laDelies;t)t2xmxr3ny4am emfes t  rumx  no0olxomicildlm ea(monu4tetnxrcoytom e nvs;() etm(r3nydomt micias) rrmx  ou1olt  ociasla uluvp (4 rtoir ta1fp eli sl( t2xmirpoo1om nlfct tfsDumur ;o1oee io3iasfm2ea(vp;()trxnmr ta1fmtrli il() etmxo iodape  ivsas) Drr(m no1oeeo ociyd mDrlnmp u)tltnmr totop raueo s) rxr(o oydlle livslt)arta(mp;t0tpeoiieiaslm el(mon(0trerif ootfpD  uei (0texoio io1ap  lfcsltf rta(rpnu4oetoii3iadls2elumsnu) exnifciodfa   neils) eum(r oy4opt lnvtl(farraxmo;u0ale ii3iys s2rl(vo;u4 ltrmf3tatlatelueils tetrxrpiu4olee nesls)aruaurooo1alxomi3tadfmDumnvo (0tetoxf3tatlm e u i s)trtr(m3oydole lnctatf 2umxr ou0ope mf3tadfs2uaumon()trenxo iatop rauvsls truoim3io4om nlnet (faDtmu p;o0tpe iieiytlm ranmp (0 lenxr oydfpt  i o;t  euoxrpnu4amt  feia(  2urum no1aetomo3ilslm elnvpnt0tetnxo ootoa   u s ( texmxo3oo4lm emnvta( srrm(m ;o1olt mf3ildlaDelnmo (4tlxoir totoatelnvols trxmxmpnudol  mfcslsf 2tau ont4olt iiciasfaDrmnvsnu4alerifcto1oate nes (0teur(m ny4lm elictat)s2ra(  ou0optnmieiad m rmn p;u)tlxnxoctotfptr uvo ()teuoio3iu1ap nmiet t  2urumpnu4altoiicilt a em(vo;u0 lenif tatlm eln s t) rtmiopnydllen ieta( s2umu ooo1tpenmfeiytfs2rmuvp t)artnir iydlpD livolt  etmxm oo1lptnmnvtltfsDtaxr ou1tlenmoetaslsDeauvonu4tlenmf3ty1lat liei;s) euoio ny4omenmfeilt)s2ta(mont0aeenmieiyslm umn o u4 lenmo3iatfpDrluvo;t0srxmirpnu1ll nmicta(fsDumxrp;t0aeen f3tyt aDumn pn()areoxf iytopt anvs;s seum(m nu1am  licil(farur(mp;t4olxoifeiytlm2emnms u) renmr3io1opDraneo t t2xoimpiu4ll  mnctas a2taxm ;u1opt mf3iad s ra( snu0alxrir oatoa eli ilt0 etrir nu1lp e fvtatf rumump;o0apt mociytfs2umuvp;(0alxoio iytoa eln i;t) rtoxm oudll   feslt)a2taxmo;u0ole ifetasfa em(mo u)teenxrcta1omDr ies t)trxrim3iydlpee fes s)s2tmu pno0texo iciysfm2emumpnt)aetomr3tytfa   ivo;s)s2xrxm oo1lmt mivtat)aDrax  nu1tpxnioeiyt sDem(mp;u) exoxo3iytopD lnes;s0trxmxr iu1am  lfctlt)srra(rpou1opx  i3iyt s2uanmp;() ltoxfctodop  liei;( t2uoxrpno1lmenmieta() Drmxmpoo0tpeo f3iysfm2el(vo;(0texnmo iy1fmt ln sl( seum(opno4ll n fvi t) Duaxm no0aeeo oetld s rmn s (0 etrxr iotopD aneo;t s2urirpoo4amt lfvs tf rtmxm ;u4altomfciad m umn pnu) leoxf iy1lpt aivo;(  rur(r3nydome miet ( sDtm(rpou0ape  o3iatls2rl( o;t4 rtrxr3iotla e u i;(0t2tr(m3io4lpee ncil(  rrru onu1opxn i3tlslmDea(ms ()treomr oydfptr nvs;(  2toirpou1om nmfvtas a2rm( pou0alx iietas m umuvo t)teenmfcia1lmt anei s)srum(r3ny1apeemfct s)artrxrono1opxnioetadla uanvpn(4tltrif oo1fat li ils s2xmxrpny4ol emiciasfarta(m ot1tlxnii3tys aDemump u0 ltrxf3oytfateaies;s0sexrim no1apt mneia(f Dtm(r ot0tleoif3ildfs2em(mpnt0 lxomr oadfmDrlnvi;()s2xmxm3ny4llte fctl(fsrrruronu1tltn i3ildls elumont) rtnxf3iodfp  aivi;(0trtm(m3nodoltemfes s)aDra(mpou1tpeniieiyslmDelumo u0artomf tytomte u i s0t2xr(o oudamte fcil()srrau p;t0tpe mfctlslsDuluvp u4texomr ia1lmDeauvo;s truo(o iodol emictls)a2umurpot4tex mf3iyt s ea( onu4teeomociydop rlieo;t0sruoiopoo4amtn neias s2tax  nt1tpe  oeiat s ulumo (4 eerxr3iotfpt lu o t0s2xm(mpou4ole lnvs t arraur ;o4texn oeiltlm2ul(mo (0tltrio3ty1fa  livil( srxo(o3ny1apee ies (  Drmu o;o1tlxomociydfsDel( s;t) rxoxr oodlpD  uvsls tetmxopno4ll emicsl(fs2rr(  ou0tpt  feilsfm2uluvs u)artoxo3iotlpDr nes;s teumxr oudomt lfci sfsrta(  oo0oexoiictatfs2uluvpn()areoxr3iy1fp   nei t0trxrir3ou1lleemiesa()s2ta(ro;o0apeoifeiyt a ul( s t)alxnxrciatfa  aivo (  rxmirpiudalt micia(fsrtm(rpou1olxniociyd mDrmuvo;u0artoxr iadla rlnvi s0 eurirpoo4op nlfvs s a2tmxmono1apx iicilsfa umu p t0teenmo3oa1opD aivsl()s2xm(o io4llen fctl()sDua( p;t0aeeo o3tydfa rl( o;u0tlxrxrcoatlpDraues s  2tmio iodoltnmnct s)sDrr( o;o1tpe ioeilt s el(ms;u) renmfciodlpD luvi s0 rxr(o ny1op  mnes t a2taump;t1opto i3iadfs ea(vpnu0 ltnxf3iydopDranesls0srxmir3nu1omtelneias  rraumooo1tpto ictlt mDrauvsnu) rxrxf3io1lmDelieo s)truoim3io4ol  lnet s a2uaur nt0teto fctadla2emnms u0aexnxr3iatoa   nvi s) exrio ny4olee ncil(fartrur ;t1olen ieiltlm2rlu o;() rxrmr3todoat  u i;(0teur(rpoy4llt miviltfarumxm nu1tee  ieils a ean o (4 rxomf3todlp e i sl()texrio3iudopee fcsa(  2taxronu0opxn f3ilt aDua(ms t0aexnxocto1latrauvolt) rur(r ny1ame mncs t)sDrr(r no4aexnii3iytlm umn pnu)tetrmo todlpD li o;(  ruo(r3oo4al n iet sfsDtaxmpnu4tpe ii3tytfa2uluvp;(0 etrxr3oy1omD  i ols)seuo(mpiu4lleemnei ()artr(r nu1alt mfctat m eauvpnt4arenxrciatfp eau slt) etoxrpno4ol nlneta( sDrrx pno4alx mfctyt a2ean p (0 eeoxf todomtr ivo;t)t2umxo3no4open ncsatf rrrumpnu1tex  ociytfmDelumo (4trtoir to1fpDeaies s)s2xmim3oydal e nct s)sDtrxm ot0ape  oeiasfmDumnmo t0trxrmf oa1fa eaieo s0 2xoim no4al n nes t) rumur ;o1apxnioeils s2rmn o (4trxriocto1opte i i (  etrio3iudlmtnmict sfsDtrxmpno4olxo f3ias sDem(von(0 rxoxociytlatrluvi;( tetr(m ny1am  micilsfsrtmu p;o1teeoiicilt a2rm( s u4treoif iadlm eaies;s  2xmxr iodlp  lieils sDtmu ont4tpt io3tlt m elumpnt4alxrxfciytop eaues;s s2ur(m3nudlleemiciasfaDur( poo0tltnifeild mDrm( s;u4teeoxocoadoaDr n sls  rtoxm3iy1aptn fciat)artrumoou1oex iieiydlm ua(vp;() rtnmo3oo1fmDrau o;()teumim3ou4omtemivt tfaDtrxrooo4olx  feils a2rau pnu) rtoxf3oadfpt lu o () 2toio nu4am n ivsls aDtrx  ;u0oeenif3tytlmDranmp;u4 exrif oatlaDraiesls s2um(m nydlp  lfcta() rua(mo;o1tpeo feiysla el(vp t)tltomocoatfa eauvi (0teumxm3oodlmeemfesls) rurur ;u0alx  oeiadfsDemuvsnu0 eerircty1fpDrlueo;s tetmxr3iudolenlivta(fs2um(rooo0ole ioctls a rmuvpn(0 rtoxrcty1laDeanvsl( t2uo(r3oudaleemivi tf rtrx p;o1tlenio3ild a uluvo t4alxnir tatlpDrlneol()seumxo no1alt mfeta()srurx ooo1aeenio3iadfs2el( o (4 rxrir ty1fpDrau slt)sexrio3iodomt lfes sf 2ua(r ot0teenio3iadfa2ulu o;u)texnxrcoodlmtrai i;s0 2to(o3oo4opt  fcsas)arraxmp;u4aet mieiatlmDemn s;u)aetomo3iytfpDeaues;(  rur(r3iy4llteliciat srur(r ot0aptn o3tyd m2rmnvp u4alxoxrcia1oatelnvs;s0s2tmxopnu1amenmnesa()arrmurpoo0oex iieiysfmDemumpnt0trtnxf oatomte i o;t) 2uoimpoo1ape livtat) Dta(mpot0ape mi3iat sDuanvs u0altoxf3ootfpt livils0trurxo3oydalteliei s s2ua(  ;o4teenifeilsls2rlumont)alxnxf oo1op   uvs s teum(r io1amee nvslt) Drm(mp;u0tltn ieiltfs2uln o (4 lxnxfcoytla  lnvo t s2trio ny4omtelfet s srraum no0alt  ocildlm2rmump;() lxomfctadfa r iei;s  2urir3nudamtemictat) 2tm(rpou1opxnmoetlsfa2ua(msnu)artomo ty1opDeluvo ()srtmim3nu1ll e fesas  Draxrpoo4oltn fctyslm rl( p;u0altoxo todoaD lnes s  2umxr nodomee fvtat aDtaumpnu0tlenifctydlmDeaumo;u)aleoir3iydoat auvi t0srxrio3oydoleeliviat artru o;t0aeenioetls mDeln o;(0 lxoirctotlmDrlnes;()trurxm3oodll elfct s) rua(mo;u1tlto i3iatfsDuanms;u4tleoxo tatfp r neo (  rxoir iodlptn ieiatfarum(r nu4olxomictldlm um(vsnt)trtnmoctatopDeai o;()tetoxr3iodlp nmieilt)s2rr(m ot1alto fetadfa2umumsnu4alxrir3oodopDeai o s0t2umirpnudllte fvtasfaDrax ont0opxn oetydfs2umnmp u)teenmf tatoa elieo t)t2urirpoudlp  miei (  rrm(mono1alxomfcils mDuln o;u0teeoif ty1opteli i ()trxm(m oydomtelneia(farraur nt4tex  ietatlmDumu s (0aexnmf todfmDeanvilt  2tmxm oydal  lnvtatfarrr(mpou0tee mf3tyd mDel(vo;(4arxrir tadfa rlivsl( srum(o3iodal nlfcsas a2tm(  ;u1alxo fctlsfa umnms;t) eerioctydopte i ols s2xmimpiydap emneiasfs2rmxm ;t1aet io3iyd m rln on()altoxr3oydfpD  n o s) ruoirpiy4apte feslsfaDua(  ou0altnio3tadlaDelnmon(0alenmo tadlaD lies;(  2urir ou1apen nctasf 2rrxr ou0tlto i3iyt m2uanmonu4aleoxo oadfatr ivslt)srtoxr3oy1openmncilt)aDum(m ou0opxniictydlm2ua(vont4tlxnmf oa1lmtrauvi;s  rxrxr3nydomenmfvsa(  Dua(rpot4tee mfciad a2el(ms u0trxrxociotfa e nvo;(  exmxopiodapt lfes tf rtm( pot1apxomo3tatls uanms;()teermfctadlat  nvo ( t2xrxrpoy1openlfct sfsDum(rp;o4aeeoifetasla2rmu o;u4tlermfcoodfateaieo t0 2uoxo3io1lm elnvtas srtau onu1aet mieiltlm ean onu0 eenmfcoodfpDrln o s0setmxrpoy4alen neilt) 2tmurpot1oltoif3iyd s rmuvpnu0texnmr3iy1omtrai ilt)teumir oo4amt mfcsasfa2um(m oo4tpx  ieiysfmDelumo;t) etnxf3tydlm e i o t)teuo(o3oo1om  lictas arrmxm ;u4oeeoii3iydla elumpn(4 lxnmrcoadlp  auei ()truoxrpiodamtemfesat  rrrx onu1oetoif3ild s el(von(4 rxnmf3tytoaD livs;() rtmxo nu1lmtelfeils) rta( ono4openioctatlm2eau pnu0trtoio3tatfaDeln i () 2xr(m3nodop e fetat)aDum(mono1olxnii3iydfa eau p u)trermo tadoateluei;t0trxriopnodllte ics ()srraxrpno0ole  icias sDemnvs () etriociotfm rlnvi;t0 exoir3oo4apenmfei sf 2taxronu0ale  oetyt a2ranvp;u0tetoioctodlmDraies;t srxrxo iy4lpe mfesls)srrrurpoo4tlenmociltfm ul(vpnt0alxnxr iydom elivo;t) eurir3nydaptemfvtltfaDtmxro;u1apxnmictas mDulumo;t) rxoirctodlmt  neo;t0 ruo(rpoodamt mfvtat)aDumxrp;o1teeomfeils a2eau snu4alenio iadoa raivil() 2uo(o3oudlmtemfvi (f rur( o;u4alxomicias m rlu pn(0alxnirciotlat  i ols0trto(m ou4omt lfes () 2trxmonu0ole ifeiasls2uau s u4aexomo3oo1fpt  n o;s  euoxo oudomee fvtls  2um( ooo4alt moctadfa elnmo;u)aetrxrciadomt au o s s2ur(o iudom emiviltfsruauro;o0apeomiciydfs rlums;t4 ltrxr ty1laDe i ol(  eur(m ou1omee ncsa(f 2rrx oot0apxnmf3iat aDeln o;t)areomfctydoa rli s;t)trto(r3ny1lmenmfviat)aDta( p;t0aleniictatfmDelnmsnt4 renio tadfpDe uvols)srum(rpoo4lm   net t)sDur(  ou4tlxo ieiyt sDul(ms u) etoxo iatfm raiei (0t2xrir ny4amtelnciat  rrm(m ot0texnmociyt m2ul( p u0altrio iatfp  anei (0 euoimpio1omen fci s  Dtmumo;o1opxnioeiys mDeln o (0altoxrcoytfpDrluesls) ruoxr iu4aleelfetasf Dtr( p;u0tpxo fctas a2um(ms;t4alenir ty1omDean o t0 2xmxm no1am n fesas  2ta(rpnu0ope mieiydfs2rmuvs;(4tleoioctatfa rau i ( s2xmxopoo4llte ivta()a2trur ;t4oetn f3ild s2rau snu0areoxo3tatfmtrli o;t0seurxo3nodol elfcsatfsrumumpou0tlen ictlsfm ua(mp t0 etriocta1lmt anei;() rxmiopoo4lltn nciltfa2rm( pno0aee mo3tys s rmnvp;u0areomr oo1omDe iesl()t2umio3no1apenmfesat)a2ta(moot0opt  o3iasfs2ua(vo t)texoxr3iytomD  ueo ()srur(r iu4altn nesat artru pno4texnifetls aDelnvs t)tetrmr3oatla  au i t)s2to(m no4lmte fcs ( aDurxmp;o4oee mfeildfmDra( pnt4 eeoif io1la  lneo s0 exoio3iydapt  ieils a2umum ou1alx iietltfm2el(vp u)alxoxo iydlmtr n ols) rumimpno1al nlncil(f Dtmu p;u1tleoioeilsla ea(vpn(0 eerifciotlm e neol()s2to(r iodalenmieias  Duaur nt0teeoiicildla uln p;(0 ltrmo3tydla   nvsls s2urxm oydom elfviasf 2raump;u4ole  oeiydlm uan s;u) eenmo3iatop eli s;(0 etm(o oy4olt mfctl(  rtr(mpou4opeoioetlslmDuln ont)aeenxfctatlatranei;t)trum(o oudomt  neiasfa2rru pnt1ale ioeiysfa elu pnu0 etoif ootopDe uvo;s)srtmim3ny1lme lfvtls)aDuaxr no1tlxn o3tydfm ea(vp;t4trxnirciadomDran s;(0s2tr(opiodlptemnvi ()srur(r ot0tptomi3iys s em(mo u)arxnmo totfmD aivslt0 ruoim oydoptnlfvtat a2trxmp;o1openiiciydfm ea(mon()texrio3oatlpD  i ols s2trxm3no1lmenmfvs t)arurum nu4aeeoifeiadlm ra( p (4tlxrio3to1omt  neo s0srxm(r3oydalen nvs () 2uaxmoou0apeomieils a2eluvo u0 eerio3oa1faD lnvi;t setm(rpiydlmtnlict sfa2rmxm nu0oetoiocias sDrmnvp () etoif3ootopDelnvils trto(r oo4aleemnci (  Drmu  no1opeomo3iysla2ra(mo;u4aetrmf3ta1oaDrli o;(0 rumxr io4opee ietasfa2tr(roou4teenifetas sDum( o;()teenirctotfaDeluvi s)texrxm3oo1ol elies tf 2tr( pou0apeoiiciltlm uaums t0 ltoxf3iatop raueo;t0s2xr(o3iu4llen ics ()s2rru  ot4aexomfciadfa2uau snu4 eenxr3totlmtelnes;t) ruo(m3ou1lmt lnvs s)s2ta(ro;t0tpx mi3iat aDua( s;u4tlxomf3oodfm rauvo;t0teurio oy1aptn fci t)srrru p;o4aet moeiltfsDelu p;u)tetrmr oo1op  aivi s0tetrio3iydlp  mfvi t  2rau  ;t4aetnmiciytls rl(ms u4arerir3oodlatean o (  eto(r oodaleelnvtl() Dumu  no1tee mo3tlsfaDumnvsnt0 lenxr to1omtraieo s) 2xm(mpiodlmenmncilt) rrm( pot1olx ifctlsls2uaumsnt4alermr to1fat  n i s)srxoxopou4amtnmnctl(f 2ua( pou1apxo octltfs um(mo t4arerio3iotoaD liei (0trurxm io1olenmfcsa() rrm(rono0oetnioetydlaDumn ont)aexrxfciadomD luei (0 2tmxo3io4lpe  neias  rurum nt4ope  ieiltlm ulnvont0tetrxrciytoa elnesls  2uoiopiodaptnmfvslsf rtruront4tpe if3iyt aDea(mp (4 rxoio iydoatr ueo t)t2to(o3nodom  mfcta(  Dtmump;t4olt mfciyd mDel(monu)trtnmr3ootfaD  n s (0sruoxr iodll nmiesatfsrrr( oot1teenioeiadls2uauvo u4alermf3oatlm  an i s trtm(m io4lptemiei (  2um(m oo1teen fciltlm2eaums;(4aetoxf3tytfpD aies;t srxmxopny4amtemivt t) 2tm(ronu0tetoifciytfmDem( s (4trermf3iotomD ln s;t0s2xm(rpoy1apt lictl(farta(mp;o1olt io3iyt aDrl(vp ()aetoio ootlatrlnes (0t2uo(o oydap e ics t srtmu  oo1tpxnif3iadfs ranmo;u0alxrio oodoa r nvsl(  eur(mpio1olee ivilt  Drm(m oo4oexo octadfm eanmont)arxrif3iydlmte uvslt)seumxmpno1ll n ivtls) Drmurpnu4tltnif3iadfa ua( p;u0aeerxrcoatlmte i ol( s2xmir oo1ape lictlt  rrrxrpnu1tleo iciydfmDemn snu0tetoxf3oatla  anvs s)srtrio3iudalt mnet ()sDurx o;t4tle  ietadfs2el(vonu0tlxnmfctytomDraiei;(  2toim no1apte icsl( srua( oot1tpen fciatlm2rmnmp t0aeenioctodomDe nvo;(  euoxr io4lm  mivs (fa2uaxmpnt1alenmo3ias aDua(mp ()teenio3ta1la  lnes;(  2tr(r3nu4lle mfet s)sDtmum nt1ole mo3iytfm2el(monu)texomfciy1laDelu sl(0srumxo3ny4apeelivsa( aDtmur oo0alx iocils aDum(vs;t0aetriocta1lpD luei s  2trirpoy1am nmncs sfs2raum ;t4aexoioetaslaDrlnvo;u4arxrir3ootoaDeli i s0seum(o3nu4llenmiesat) ruaurp;t1tetnii3tyt m2rln on(0altnmrcto1fa   u sl(0texmir nu1amt lfesltfsrtmx  oo1opt ioeiatla2ra(vs;u0 exrxr iatfaDelivo s0trtoxm no1ol   fct ()aDtrx pou1tpxnifctltlmDrmumo (0 lenxrciydlmDeaues;s) eto(rpno4ameelnvi sf rta(mo;u0ope iocild a rm(mpnu0artnxo tatoaDrlueil(  2tr(opny1olt lfvt ( sDrm( p;t4oltomieiytla uaumpn(4tltnxrcoa1fpteaivi;s0s2tr(o3iydapt mfes s) rumuroot1opt iictlt m ea(vs;t0 etrxo3ta1oa ean i;t)texrimpiudolen ivils aDumur no1tetnifeilsfmDran s;u0areniocty1fa  auvo s0 eto(r oudlp   fei (  Dtmu o;u0tpe mo3iytfs2ul(mo u)alxomrciodomD luesl(  rtmio3oo1amenmfci t  2ur(ro;u0altoiietlsfm2uau o () renmocoy1fpD lueolt) rtrio nydlpeelicta(fs2um(ro;u1aeto feias a ua( o;()tetomoctatlaDelivs;( s2tmir3iy1alenmfvtltf rrrx poo4oetnioetas a2rmnvp u0aeeoiocty1fmteaiei s0 2tr(r3iy1ame mivsl() Drm(  oo1oleo feiys s2rmn o;()aeerxf totlmtraivi;s t2tm(m iy1amen ncsl(fs2tm(r ;u4alxoiociadfa2raums (0aetrmf3todopteaneo s0 2toiopiu1oltemietat) Dumu p;u0oltnmf3iys s el(vo t0 lxoir oo1oaDeln o;t0teurirpiydapee ncils)aDta(r oo0aet iociltlm2uanvs;u) lxnmfctatfp e n o t trxo(m3ny4amenlieilsfaDum(r ou1oltoifetatfm2eln pnu4 ltomf3tydoateai s (  eto(o ou1ol nmivta(fsDumurp;t4tleoifctlslsDeln ont4 lermr3iatlpte uei t  euoimpny4optemivsl(  Duax ooo1tpx mietas mDrlnvs t) ltoiocoytlat  nes;s0tetoim3nodlpe mictat aDrax  oo0tltomf3iyd sDumu p u4trtoxociy1fm  anes;s trur(o ou1lp e iei t) 2ur(rooo1tpxn i3iat a2elumonu4artnxr tytoaD ln s s t2ur(o iodll nmfcsls)sDtrxm oo4aex mieiadlaDrl( o t0alxnxo3oydfp rai s s seum(o3nu1al e icilt) Drmumoou4opeo i3ild s umnvo;t4arxrif3oytop eli o;s  2um(r3oodal e nctatfsDrrump;t0teenmfciaslmDel( s u4teeomr3oadfpt  nes;s srurir io4op elietas aDtmx onu1aleoioeiysfm ulumpnu) leomf3oydoaDr nvo (0 eurxmpnu4ol elnesasf rtmxroou1ole if3tas m umnvsnu0 exoxfctadomteln o ()teumxrpnu1lle  nesltfartm(rp;o1altnioctydlsDra(vp u0arenir3iytop e ivi;(0tetoxm iu1ale lfcsat) Drmx poo1oee mo3iys a em(mp;(4arxoirciodlaD  uvo;s0trtrim3io1ape  netat  Dumump;u1tptnifetltlm2raumo;t0trxoifcoadla rai s;t0t2urxo3iodol   neslt) Dtruro;o1tlenioetldfa2ul(mo;(4arxrxf iytoaD  uei;s)srtriopiy4am n feias aDtr(r ;u1oexo octyt m2uan s (4trxoxocio1fpt ai ilt0 eur(opiy1omee netat)s2tmxrpou0tptomo3tldfs rmums;u4trtrir tadlat  u o t  rtm(mpiu4om  mfct tfaDra(m ot4aeto fciatls2uanms t) rxoir iydlpD  i sl( sexmir3iy1amt  fvs sfsDuaumpoo0ole mo3tls sDemu o (0teeomo3oadoptraivsl(0trtr(opnu1lp nliesas  Dtruroot1optn ieiyslsDulnmp t)alenir3ootfp  auvs;()trxoir nodalt lfes sfa2rau p;o4oetomf3ilsfsDuauvo u0 lenmr ootlmtranvi t)seurio oudalt  fvt t  Dur(  nu0tpt moeild a2eanvs (4 renmo3ootop  ln ol( t2xr(o3no1lme mnvsa(fs2tmxro;o0tpx  feiytlmDrm( s (0tltoxr oatfp elu sls) exm(o3ny1omte fvi sf 2ur(mpou1texnif3tat aDrmnvonu0trtomr3iytfmt anei s srumir3oy1omen ivtl()a2tmxmont0apeo f3iasfa2rmnmp;(4arermocty1fm r i ilt0 etmxopiudap n nvsl(farrr(ront4oexnio3iysfs emnmpn(4 ltnxr iytomD  nei;() 2uoxr3ny1om n iviltfa2rmxr ;o0opt  ictltfs um(vs;u4 lenmr3tydop rlu i s0srto(rpny4amenlfvs t  Dra(mp;o4apx  ieias a2ra(vp t4aleoxr oa1op  livo;s) exrim3io4ll nmnvt ()a2ur(ro;t0apx ioctydla2rmn ont)tlxrif iy1lp rln ils  2xoiopiy4opt mfctas sDua(moou4aeto ietat sDulnvsnt4alxnircoytfpDrauvolt0 rxm(m iu4lpee nctas  rumu  nu1oexoifeiadfm2el(mont)texnmo3iydlat auvo;()srurxr io4lpe mfctas  rrr(ro;o0tlx  iciydlsDum(mo;(4artnircoadomD lnes;s0srxrir oodll e nct t) 2rmum nu1alx mfciyslaDua( snu) etomf ia1lpte nei;t)seumirpnu1ll e fvtl()aDtaurpnt1opeomiciatls2ea(mo u4trtnio3ia1faDeanes ()teuo(m ou4amen fesas srtaxr ;u4oexniicias s2elnvpnu0aetrmrctodfm  livsl(0 ruoirpno4lpee fct (  2taurono0oee  oetasfaDra(vp;u0tleoio iotfmt  ivs;t s2ur(opio4ap n ivia(  Dtaum ;u1tlxomo3iytls2emuvo;u)alxoircoo1opD  ieol()srtm(m oo1ol emivil() 2trx o;u4texnmo3tyt s2eau o u0tlenmr oatlaD  ueols  exrio iu1optnmncilt s2tmxm ot1olenmf3tltlmDra(vs;t)aetrmr oa1fa  lueslt0 rxm(r3oudame lnvt s)s2trumoot1openio3ildla uauvp;t0tleoir ootop   ivils0t2tm(mpoo4lmt liet s aDtrumonu0tptn icildfa ea( snt0 lxnmf3oa1op rau slt  rxm(r3iu1apte ies ()sDtm(m no1tlt  o3iadfm ulu o t)alxoxrcta1opDeauvo;t teuoir ny1olte nesas) 2rmxrpnu0oeto ictlslmDrau s;u0altoiociytlp rlu s;(0trxrio3ny1ole  nvi ()srrr(ro;u1aee mociat aDuanvs (4arenxo oo1omteaieols t2xrxm3io1lpte ics sf Dra(mpnu4tpxomfeiad m eanmo t0texrmr3oa1fm rauvi;s)teurxo ny1llen nes ( aDrrxro;o4ole if3ias m2ulnvp;u)texrir3ty1oatrln o s t2tr(r3oo1lm n fvi ( a2tm(roou0tpeo ociytfm2ea( o u4 lxrircta1lm rli s s  rxoxr oodalee ieil(f rtauronu0tlxnmfeias m eanmp t0aetnmr ia1opD an s;s  etmir nu1ll   nvslsf Dumxmpot1tpx mfeiad mDrlump (4 ltoiocoytom rau ol( t2xmimpny1amtemicsl() 2ra(r ou4olx  fctls sDrmuvs;t) exnxf tydop e uesls) 2xoim3io4ole  fvtat)sDtru oou0oeeniicilt a2ul(vsnu)trxomf io1op  an ils0 2urxr3nydal emietlt s2rau oou0oeeoiiciyslaDum( on() rtoir3ootomD an ilt0sexoxopiudam elics t  Draum nu4aeto ociasla eauvpnt4tleomr3tytlmD  neols trtrxm nudlp e icslt)aDua(r nu0teen fetldfm ean s t4tltnmr oydlaDeau ol(0s2xrxr3oudlmt lnci s  Dua(  ou0tltomi3iltls2uaumpnt4arermfciodoatean s (  etoiopnodop elnctatf rrru oou1opeo i3tltlsDul(mp;(4 lxnmrctydlm  lneo (0srxrxm io4olenmfvs ( arum(r ot4opxnmfetldlmDem( onu4trxrirctotlpteaueo;s srtrxr iu1omtemnetat srra(r nt1olxnioeiysfmDemumo;t0 etrio3iytfmD  nes s0sexrxrpiy4amtelncsatfs2taum nt0apxo o3tyt m2rm(mp () lxrifcto1lpDe i i;t0sexo(m iy1ameemicsl()srtmxmp;u1aex  f3ilt a raumont)tltnmo3iodopte ivslt0 etoxo oudomee nvsasfaDtruront0aetomietls s ul( o t0aeenmf3oo1fp ranes;t)t2to(o nu4olenlfetl( sDtm(moot4oetnmi3iat s2ul(vo;()trxoxr3oa1fpD  ues;s0trxrim3iy1lle mfci (f 2rr(r ou4apxomoeiytlaDel(mo t0 rtomociatlpt au ils)t2uoirpoudaltn netasfs2trumont0olx if3iltfaDua( o;t)tlxrxfcoy1faD  u o;s)s2uoxm oydlltnmietl(f 2uaxmp;o0aptoioetysfaDemnmsn(4trenio oadlm  au s;() ruoxr3ou4ol  lfet sfsrumxr ;o4tltomi3tatfm elumonu0 lenifciotfaDeai o;t  etmxr ny1ol nmfci sfaDtrxront4ape mieiatfa rmums;u)tlxoio3tydoate neol()texrxmpoo1altnlicil(f Dtm( pnu1apxniieias m eln sn() lenxr3ia1oatraneol(  rurir nodapt lieia() Draxmonu0altomoetyslaDea(vp;t0 lermrctytomDr n slt  2umim3iu4ol e fvsls)aDtr(mo;u4alto o3ild m2uluvp;u)trtnmo oadoatrauvo;s0 rxrxr3nydop emicia(f rurxrpnt0oexnifeiyslsDulnvs u) exnxr totfatelieo;t  rtmxo3oo1openmfeias)s2taxm ot1tpeomociltlaDumnmp;u4tleoxr3tadfpD  nvo ( t2uo(o ou4om emivsat) rraurpnu0apenii3ilsfsDel( o u) rxnxf3to1lp eai o;(0 2xoxopnodlp nlfesltf rrmxro;t4aexnmoctad s rm( s t0tlxnmo3iytom rai s s0texm(r iy1apte fvtat)aDur( oot0apxomicias a em(mon() etoxr totoateaieolt trto(opiu1op nlivi s)srtm(rpoo1olenio3ild s eanmo;t4tetoifcoodoate ues (0sruo(opnudlltnmicsls srumurpno1olxn octldfaDua(ms;()teenxr3tytoatrlnei t0srtmir ny1lm nlicilsfsrumumont0alxnmiciltls2ulumpnt0aetrxo3iotom r nes (0srxm(o3oo1apeemfeta()aDrr(r ou4tpt mi3tadlmDra(mp;t0teermocoatfpt  u i s0 exmxopiy4lltelfvia( aDrmu pno1oleo ocild sDrlnmont)teenmo iadfpDrau sls)tetr(r no1llen ici ()srrrx poo4tex ioeiatfm rl(vp (4trerxr3oatla r uvs t0tetoxr iy4olt mies t)a2rru  nt0apt ioctatla rl(vs;u)tlxoioctatlpt ln i t seuo(o3oy1op emncils aDta( pnt1opeomieiatfm2um(mo;t0 exoxocia1lp   n i (0srtoiopnu1om nlfctlsf rua(mpot1opto f3tlt s rl(vo;t4trxnmf oodfpt aueols)srxoxm3ou4opt lieils a2tmxr ou4apen ociadlm uln s;u4arerio3oa1fp  ai o;t  eumxm3io4alt mfei s)srrr( poo0aleomicilsls2ul(vont0 ltoxrcto1omt anvs ()setmxo nu1amt mfei () rtrumpou1ale mieilslm rmumon(4 eerxf3ia1la e iei s0 2xriopnu1amtnmfcsas)sDra(r ;o4apeo feiasfs2rmu p u4 etoxfcto1oateln o;s) 2umir3iodalteliet sf 2ta( pnu1apxn ieiatla2ul( o u4trtomocoadfp ran s;t0teumir nudoptn fesl(  2urxm oo0olen ieilsfs uanms;(4tltrmoctotop r iei;t)s2tr(o iydlpeelicils)a2ur(mont4optomieiadfm eanvs u4altoir totfptrlueolt0 2to(o3oy1op nmncsl( sDrauro;t0apxomoetadfaDrmumpnt)tlxomfctadom r ueo ( teurxr3oy4lm emieil(  rtru pot0opxniictldlmDuauvo u4 ltomrcoa1fpD lu ilt)teur(r3iodllt livt s a2rr(mooo4tet mociadlsDeanmp;u4 rxnxo3iatfa r ivs (0sexoir oodal elictatfa2tmxm oo4aptn fetas aDeluvp (0texnmfctodlpD  nvi;t0seuo(opno1ole  ies s)s2trumo;u0aeeoioctas s raumo;u4 ltnxr3oo1lp  aneo s0trxmxm oo4aleemnvi s aDtrumono1opeo i3tad s2ran s;u4tetrxo3oodfm  livols  etoxm oo1aptnmict t s2ur(rpno4apxoio3iyt sDumuvs (4tetoxo oytlp  aivo;s  exoxm io4optn fct sfa2umuront1oexo i3tytlsDuaumon(0altrmf to1opt an o;s) rtm(m3oo4lmtemfesl() 2urumpno4apenifciat m2ra(msn(4 ltnxfcoatfmDrli o;(0seuo(m3ny4lme lfvsl( s2rmu o;o1tle mi3iys s rlnmpnu0tetrxr oatlm  lnvs;()t2xo(o3ny4alenliesasfsDtru pno4apxo fciad sDrau s;(4 reoxo oa1fmDelu o () 2tmxr oy4omenmietls  2tm( o;o0oeenmoeiad a2eauvo u4aeerirctatfatr ieils  rumxrpny1ap eliei t artm(moot4opeo o3iatfa rm(vs;(0teerxrciydlp eaneil(0 rurxopoy1lpt mneslsf Dum(  ot1opt  i3tat mDel( snt0 ltnxrcoa1la  aivi;(0srxmxr nydlltemietlt)sruaur nu4ape ii3iyd a2rlnms;t0tetomr3tytfatr iei ()trtrxo3ny1omt lfvil( s2rmu o;o1oltoif3tls mDrau snu)tlermo3oydfmteli sl()s2xoxm3oydamtnmicilt srumxrpno1tlenmo3tls a2ea( snt0aeerir oy1oaDraiesl(0t2xm(m3oy1lle  feiat)aDrm(r ;u1tee moctatlmDel(vp u) rtomo ty1la  anes;s  rum(mpoudopenlnctl()a2tmumoou0altomfeiytfaDul(ms (4trtoif3oatlmtr ivi;t) 2urxo3oo4om  lnctl(  2rrum oo1apxomfeiys s rm(vp;t)tlxrif ty1lpD anvi;t0t2xmxrpio1op nmfviasf Dur( ooo1openifetatfm2uau snu)artrifctydomt  u ilt0srxmxo3ny4opt mfcsasfsrrr(r ;u0aexo oeiltlm2elu snu)texoio oo1fmDranesl() 2tmio ny1ap emnvtas  Dtr(r ot0aetomicias mDumnmo;()trxoiocoa1fptrliei;t)srxrxo oo1olee fci tfsDtmum nt1tetn iciaslaDumuvo u0treoxrcto1fa rln i s0 2xrimpnu1lm   fcs ( a2tm(  ;t0tpe mf3iad m ua( o u)tltrir oy1faD lnes t)srumimpoydopeelnvtas  rtax o;t4olto ieilsls2um( p;u0artrmocoatfa   u o;()t2trir3nu4omt  ivta(fsrur(  nt4ale  f3ias aDea( p ()tlxrxr totfaDeaueo ( s2umir3iu1lpeelfetls  rumxmoot1tptn ietad m2umuvpn()alermf tadoa e i ols  2urxr3oydal nlivsa(f rrm(m nu1aeeo o3ilsfm ul( snt4trxoiocoytfmD  ivilt0 2umxr nu4am elnvt tfs2rr(mo;o4aeeomociad a2ulu sn() lerxf3totoaD aiei ()texm(m3ny4am   fet ( arrru o;o1oexn f3iydfsDrmu p (4 lxrmo3todfmtrlnei;( trtmxm iy4apt mfei s sDta(r nt0tlx mfeiasfs2emnvp t4trxrxo3tytfa  ln s t) etm(r iy1olt mnesa()srtrxrpoo4teeomociydla elump;(0aleoioctodlm   uvi s)setoirpny1lleelicil( s2ua( pno4ope mietydfa ua(vsnu0 rermo iy1omt aivs s0tetmxrpnu4alen neslsf rrmur ou0ale mi3iytfmDul(mpn(0aeerio iotlmD luvs;(0t2xmxopoudom n neslt s2tr(mo;t1aex io3iadla emnmo (0 rtoxo tydlmtr n s t0s2xm(r3nu4lptemnvsat)arrmxr ;t4aex iieils s2ean p t)arerxrcoa1opDraueo;(0setoxopio4ll n ncias  Dum(ro;u0oeen icildfa2el(vsnt)altrifciatlmtrlieo;(0trxr(o3ou1alt mnesl(fsDrrumono0aptniieiyt s2ranvo t0 rxoiocio1fpteln i;t  etmxo iu4apen nesasfsrraumoot0tle  iciyslaDul(vs;(0alenxf3tydlmD luvi s texmxm3oy4optn nctlt s2tm( o;u0apt iieiyt a2ua( p;t0 eenir oy1lpteaneilt) eurim iy1amenmfcsa( a2tmump;t0tetn o3tltlsDea( s;t0aetrir iadlpteauvi (0t2xm(rpoy1om e ici ( s2rau o;u0olxn iciatfs ua(mpnt0artrirctadoaD ln sls0 rxoxr3ou4apeemncils a2rrxm nt4opxnifcils m ra(mp;t0altnif3oytfmD  ivs ()s2ur(o3oy4lm n ncsa() rtm( pou0apeo fciytla2uln p u) rxoio iadlat  ueo;t0t2umxr3ny1apt mfctlt) rta(  no4apto fetyt s elnvo u0altnir3oydoa eauvi;t0 rtmxmpnudameelfctasfaruaurp;o1tltn ociadfmDumu sn(0aeenmo oy1la rliesl(0sexo(o3oo4lmtn ivs s  Dtmumono0tpeoioetasfs ra(msn() rermo3io1faD au i;s  etoim ny4omt lfvil( arum( ont4olenii3tytla2ulums;t0trtnir io1la e neo s0teurxo3nu1lpe lfctls) ruaxmo;t0oetoiociadls uauvo t0alxnif3iotlmDe ueslt0srxoxopno4lptnmfctlt arurxr nu0aetnmiciytlm2rmumsnt) exrmr3iytlaDelnei ()tetmxo iu4opte nesltfa2rmx onu1tlenio3ilt s uanvp;(0trtomf3oytop eau ol(0s2xoir ny1lmen ici s) 2umx o;u1tleoio3tytla2ea(ms;t4tltomf todlpDr nvi ( seurxmpoo1lleemfeias aDtmx pnu1tpx moeils m2ulnvsnt)tltrmociotlm rli ilt)trxoim oudlmeemfvtlt sDtmxro;t0ale mfciysfa2uauvo u) rtrmo io1lmteauvo ()trxmir3iu1aptnlfcils  rtrxrpnt4oee  icildlm rluvs;t0 lxnxrctodfmte u o t)teumirpou1amenmies s  2ua(m ou1oee  icilt m2rln p u0trxoxocia1lmt liesls) 2ur(mpoo1altn ivi s) 2taurpno0tetoioeiydla uln o;(0 ltoxr3to1laDelues (  2toxo3oy4op  mfvi t s2ur(  nt1olx iictasfa2ra(mon(4aetomr3oy1fateluvs;t0srtm(o oo1lptemivt ( srrmxr nu0ape ioeiad a rau s;t4 lenxrcio1fmDrlivi;t0teto(rpiydllt mivtls sDrax  ot0oetnmf3iyt aDranmp t0artoxfcoy1om r ivo t srxr(opnodamen iet tfarua(  ;t0alto ictlslaDuauvs u) rxomocia1fpDean s (0t2xmir nudam  mfctl(fs2uaxrono1tltomoetyslaDea(vp u0arxrxo3tatfmD aiei;t) exrxrpoo1lmtn icslt) Dururont0apt mo3iasla2ulu p u4 etrio iydfa raueo;(  2xo(r io1lpte nvt ()s2um( ono4tpxnmietydlaDem( p;(0alenio to1oa e i o;(0 etm(o3iy1lpt mfcia()aDtaxmo;o0aetomfetyt m2rau snu0trtoiocoydlp rau ol()tetrxmpnu1ope  feslt)a2rrxmo;o4alx  o3tldfaDumu s;u)treomfcio1omD livo s) 2to(m3iodale  ietatfsDrrx p;u4ole  ietatlaDul(ms;(0 etrxocootoa  auvslt0 rurxo3oo4am emfei t a2umurooo0aet mietld m rl(monu4tetnio3totfmtraivi;s)texmirpno4optnmfvsas) 2tr(root0apen fciysfaDem( p;u4 exomo oadfpD  i o;t  rumiopiodolt  ieilt)a2tr(moou0tleomo3tls a ra( o;u4arxoxo3oo1fp r i sls0srumxr3no1apte nei (f rtax poo0aptomo3iltfa umuvp;t4texoifcoy1faDe nesls)t2toirpnu1altelicta( aDtr(mp;t4opt mo3iyd m uanmp;u0 lxoxf todoa r n o ( t2xrxm iu4om emiesasfsrua( p;o0aleoiociatfmDum(mpnu0 ltoif ia1lpD aivs s srtrim oy4op e ncil( sDuaxr ;t0olto o3tyt aDuau on(0 renio oatlatrlnvols srtr(m3nudop e fctl(f Draxrpoo1oltniictatlaDeanmsnt) lxoxo3ootlmt  ueils t2uoio iy4op n fci ()aDrrxr nu1tpt  octys mDelnvpnu0 rtrxf3ootlpD anvils0seum(m3iu4opt livtl()srtru p;o4apeomocias m2rlu sn(0artnif3iatomtr ivo;( tetrxm3nu4ap nlivi s aDum(rpno0oee mfcildlmDulu pnu4 etomo3totomtelnvils  rtrxopoo4al nmivsa() Dum( pnu0tlxnio3ild s elnmo;u)arxoio oy1lmteai i (0setmxmpoodlmee fvtl(faDta(mpnt1texo fciasfm em(mp u) ltnio3oo1fmte nvs t0 etrim no4llte fesa( a2rru oou4aptoiieiltfa2el(vo t) leomo oytfmtrlivi;t0 2um(m3no4am elncslt)aDraxrooo4tee mieiytlsDrmumonu4 eenir3oytfaDeaivsls0srxr(m3oo1aptnmnetlt) Drmx o;o1altomi3iytlmDuauvo t)trtoir tytfm e uvi s  2trim3ny4ol emivsa() 2rrxrpnt1alxoif3iadfs2rau o;u0 etoiociatop rauvo s0setrxmpoo4altemnvtl(  rrmxmp;t1alxoioeils s elump t0 etnir3ia1lmt  uvo;t0tetr(o3ny4olen ies (f Dtr(rpnu0oexomo3ild a2rlu o u)alxoifctatfatraues;t trumxrpnudome lfei tfsDta(  no0altnmf3tas sDrm(vpnu) eerif oadlmDelueo s0t2tm(rpoo4lle  ivtlt)arum(r ot4tlxn icilt mDeanvsnt4trtrmf3iadla r ivil()trtoxm no1lmt lncsls) 2um(r ;t4oetn octysfm2ulu s;()tlenxrcia1faD ai olt sexmxr3iu1ameeliesl()srtr(m no1aee ifciadfmDelu s (0 lxnioctatlpDean i;( srtoxopio1altn nciasf 2rr(moou0tet iicildls rlumo;()tlenmf3tytoaD lnes s)s2ur(m iy4optn iesas  ruaurp;o1tptnmoeiatfa2uaumo (4alxoio3tatlpDe n o;s)texoxo oo1oltelfcs s)s2trxr oo1apx ifciysfaDem(ms t0tetrxf oy1laDrli i;t0texm(m io4lm elfes tfaDtmu  ;u0opxo o3ilsls uau snt0treomr3oadfa   uvs;(0 2xm(o3nu1lptnlncsls)artm(m oo4oetnmfetasls2ranms;(4aetnxfcio1oa eauvs;()t2uo(r3oydomenlnetlsf 2urx pnt0olxnmfcias s uln pnu4aetnmfctydlmD liesl(  rxrio3oo1amt micsl(  2uaumooo4ope iietlt aDrm( ont4 rxoiociotopD  neo;s0 etrimpou4aleemict t)srraumpno4open ocild sDra( snt)teeoxr3tatlm raneilt t2umxopoo4am nlfctls sDurx  ou1tleomfetatlm2elu pn() rtrmfciatoa eauei ()tetoim ny4oleelncta()sDurxrpnt1tleo feildfm rmuvpnt)aetoir tatopD  ivi;s  2uoirpnu4apenmicsl( artmur ;u4optoif3ild m2ra(mo (0 eenio3tydla ranvols0 ruoir iudal elncsl(f 2urxm ot1aptn iciysls em(von()trtomf ootop rau o;s0 2um(r oo4am elfei tfaDuaumpnt1tet iiciyd m2ulnvsn() lxrxrciytlat lueolt0sexm(o3oy4lp n ivtas aDurxrpno4apxn o3ildfa eaump u0 rxomf3todlpDelivi ( srxmxopoy1lme mnvilt)artaxm ot4tptnmoeiasfaDem( p;()tetoircootlpD liei s teuo(r nu1llt lnvt sf rumu p;t1opeoiietad sDua(msnu)trxrmo tadlmDr ies s)tetrxr3nudlle  fet s)a2tr(m no1apxo feiytfs em( o u0 rxnif iy1lmDelu sls srtrir3nodlp  lici ()s2rax ono0oeeoiociadfm umnvo;u4 reoifcoy1fmteluvolt) 2urir3nu1al  mnes t sDtmur no1apen i3iysfmDrl( o u0alxoir to1oa raues;t0 rxrir oydole livsas)srtru p;u0tpe mfetltfm ra(ms (4aeermo tytomt anvilt s2tr(opiu1lmte fct (fsrrau pot1opxo ieiytfm umnvs;(0tlerio oydfatean s (  eurio3ny4ap nlnvtlsfsDraur ou1aeen i3iadfa rluvp t0alxomo3iodlmtrlnes;t sexrxo nudamenlncilsfs2tr(  ;u1alt mfctyt aDem( p;t0 reomr oa1op r iei;t0t2xmxopnu4opt lncs s)arrmx o;t4opxnio3ilsla2um(vp t)tlxnmr3ia1lmD  u i;t0tetmxrpiu4lmeelneil( a2rru  ou4aptnifeiltla rau p;u4 lxoxr3oodfpDe nvilt)srtm(m3oodopt  fcslsfs2rrxrp;o0apt  ociasfaDua(vsnt4aetnir3tadoa rli ilt teurio3oy1lm  lnvtlsf Dtaxr nt0oeeoio3ildfm2elumo;(0 ltrirciodfptr iesl( trxmxr ou4oltnlnetl(fa2taum ou0open oeiydla eau pnu0trenxfctydfaDeaneo s0 eumxrpnudaltnlfciat arum(m ;t1optnmfetlsfm2el( snu) rermrcoo1fpt anei (  rtmir3ny1lm  miesas)arrru pnu1tpe miciysfm2ul(mo u)arxnmf3iodfp  an i;s0s2trirpnudlpeemnct s) 2uax  ot4tleo fciad a emu sn()altoiocoodfaDr nvs;t)t2trxo3oo4am  mnvs sf rtm( pnt4aee mi3tasfsDrauvsnt) etnxo3ia1omD au slt  rur(o3iydamt mfetat)aDurump;u0apt mf3iysfsDemumo u)tlxrmf3ty1lpt ai i t)trurim3io1apt  fctl(  Durxm oo4apx miciat mDeaumsnt0 ltrxf oa1oatrau i s0truoio3oydlmtemivia(fsDta(m ;o4oet moeiat mDrmnms;u4 rtnifctydfmDrau o;(0s2trim ou4aleelneta()arurxrpno1tpe  ictatfm2emn on(4texomr3tytlaD ln o t  rtrxrpio4ol  mfei t) rum( p;t4tpe  ictydlsDulu s (0aleoxocto1la  luei (  exoim3oudal nlfcil()sruaump;t4olxoioctltlaDea(vs;u0aleoxr3iydoaD lu ils srtrxopio4oleemncia()arrm(mont0tlxn icils a2emn s;(0 exrxf3ty1oaDr ivo;t)s2xo(r3io4om emics (fs2tmxmooo0apt ioeiytlsDuaumo t0 rtrif3iadlp e nvi t0 2urxm oo4optnlicilt)aDtax oou4tpeoif3iytfs rau o;u) exrmo3ootoa eau s;s0 eum(r3iu1lm e fei s s2uru pou4altnmociaslsDra( o t0 ltrxociotoa e n sl()srtmxr nudalt licilt  rtmxm ;t0aexomf3ils a uanmpn()tetoir tytoa elnei;() eur(r nodlpe mnvtls  2uax pot4tle  feiltla2rm(monu0arxnio3iodlp ranvil()t2to(r io4lpenlfctas aDtm(r ot4aeeomi3ildfaDul(mo;t0aetrmo tatoatelneilt0sexrxo3nydom   iet t)a2rr(ro;o4texnio3tltls2em(mpnu) lxrifcto1fpDranei;t sexoio3iudll elivsls)arumxm oo1oetn ictltla2el( p;(0arxoif3io1lm eai o ( t2toir ou1opeemnet s)a2trumo;u0oet ioeiltla eanvs t)aetoio tytlmte ivi (0trxmxr3ou4am   nvsatf rumxmp;t0aeeo fctydlsDrln pnt4 lxnmf3iatoa rlneolt0 rumim3io1lm emicsls)s2rmumont0texoiictldlaDemumo;u0 rtoxf3oo1fa  ai o (  2umxo ou1lme lfcilt) 2urxmpot1ale mo3tldfs ul( p (4aexomrciy1lmtrluvils0t2to(o3nudomtnmieias  Dumxr ;t0teen feiys s2ua(vsnu0trtrmoctatfpD  ues s srtr(r iy1opte ivi t  Dumu p;u1aleomo3ildlmDem(vsnt0arerir iy1lat li olt)texr(opiu4olee ivtl(farraxmpnu4oee mf3tls aDrmn sn()tltnifciydfpt au o;s)t2um(opno1lpeemfviat aDuaxmpoo4opxnifciadfa ea(vo;(4arxomf3totoaDeln i t0srxrxm oudapee nvi tfs2trxrpnu0oexomiciatfm2ua(vs;u0 ltoiocto1fm elieol(0trxoim3iodopeemncs ()aDumuro;u4teeo oeiyslaDrm(vpn() exoif3oo1optr neo (  rtoir ny4lp nmfcia( s2raxr ot1tpeo fctadlaDuln s t0 eeoxo3ia1omtrau o () eumxr nu4lleemietl(faruaxm oo1aptniiciydlaDemnvp;u4 eerioctodfp   uvi ( s2toiopoudomtnlfviasfaDum(r ot1altnif3tas a rluvsnt0teeoio ta1lm e uvs;( t2uoxr nu4ameelivtlt)srtmx o;t0oex mietyslsDeanmsnt4tltnifcoadfpDrlivo (0t2umxopiu1lm   fes ( artaxront4apenif3iasfs ua(ms t0 reomr tydfaDelnvsl(0trtrxm oudape mictatfsDum(rooo0apx  i3iltls2emu p () rtrmrcta1fp rlu s s0t2xm(rpiy4om e nvi s aDtaum ;u4ope ifciasfs2uan p (4trenmr todoa e nesls0srxmim oy4llte ncs t)sDtr( poo4teen o3ildfm2el( pnt0tltrxrciodoaDraneilt)setoim3no4lm nlictatf 2uaurpno1aetnmoeiasfaDra(mo u0trtrir3todlmte ueo s)s2trxo ny1apenlnes ( a2tax  no1aetn oetyd m rm( p u4altoxo tytfat  uvo (  exrim3iu1lmeelfetls srraumoou4tee iieiasfsDuan s t4trtoio3ty1oatrlueol(  2trio iydom n ictlt a2uaxro;o4olxnioctyt m ul(mp ()tetrir3oytoptrai slt0trurxrpou1lme  nvi s)artru  ;u0tle  i3ildfa2uauvp;u4aetnxo ootlm r uvi () 2toxr3ny1llt lfvtl( a2ua(roou4tpt  oeiydfmDemnmsn(4trerxf3totfmtrluesl()trtm(r nu1lle mnci (farrrxmono0tleomoetad m2umn p ()aetrmr iy1fpD  u s ( trumxo no4llee ici s sDtaxrpot4tetnmi3iltla rl( o t0 exnxfcoatlpD aivi;()srumxrpoy4llenmfcs t)sDtruroou4tpxnifeiyt mDrmnms ()aetomocoo1oa e uvolt) eurxo nudape  feils)sDta(rpoo4tlxnmi3tatls em(mp;t0alxniociatfmt lues;s0t2uoxrpoodal emnvsls)arrr(root1alxomicildfa2elnmp;t)trxoio3oa1opt  n sls)t2xoxopoydamtemfcilsfsDuru oou1opx ifeiytfaDrau p;u4 lxrmoctadlaDrlues;s  2tr(r iy4om  lietltfs2rrxmp;o4olt  ocildls umnvo;t4altrmr iy1faD au ol()srto(o iu1al  lneias aDra(m ;u0opxomf3iydfa emnmp u)areoio tydlptraueo s sexoxr3iu4lmeelncta()srumx p;t1oltomi3iydlm um(vs;t4 etnxf3todlpt anes s0trur(m iydoltnmnes t a2rmxrono4aeeo feiysfa2ul( snu4 rtnir3tydlmDraueslt0s2umim3iodol  lfviasfaDrrxrpnu0tlxnmfcilsfmDean ont)aetrxo oadlaD ai olt0 rtoimpou4apt mivilsfsDtaur ;t1alxnmoeiatfm2ua(vp;u)texnmfcoa1lpDe i olt)teto(r3oy1ome  nvsltf rum(rp;o0tpto feiat s ra(mp;u4 rtriociadomtranvo;t s2xr(r ny1am nmnctl(  Durur no4alx ioeildlaDrmumsnt0tetoir3tytfpt lnei s0trumxr nu4lmtelfetltfa2urumpot0openiociasfaDel(mp;()alenmf3oo1fate i o;(0trxrir3no4opt lnciasfa2rrxrp;o4tpenmfetatla2ua( s;u0aeenxo oy1opteluei;(  etrim oudllen fet tfsrrrur ;t1optoiieiytla uaums;t)arermr iy1fpD  i s s srtr(rpnodap   fvta()sDrr( ont0apeoioctasls umuvs t0trerxr3ia1fp   n i;s sexrio3iydllenlfeta(f Dum(mo;t1alenii3iltlsDrau p;u0alerxf3iodlmDeaies;()srum(opny4optnmfvsltfsDtru p;o1oexnmf3ildls emnmo;t0trtrxrciy1oa rai slt)srtrio3oo1ol n ivi s s2tmxrpno0oetnioetytfm2ea(vo;(4aexnxfcoodopt  nvsl(0trum(o no4omt lfciat aDuaxmonu0tetn i3ias m2eanmp;u0artomrcoodlatean sl()srtr(r oydoleemnctas) Drax  nu0apto oetad m rm( s;u) exnirctydfmD lu s;s)srto(rpoy4ameelici s)s2raum nt4ope iieiyslm2ua(vonu4 rerxocty1oaDeau ol(0s2toxr io1omtelfvt (f rrr( onu4tlto o3iatfaDua(vs;t) ltrif oytfm  au i s0 eto(mpoo1am elnvs s)s2um(rpoo4olx ifeiysfs rlnmp;()trtrmr ta1lpt luvsl( sexoxr3oudlpee nvil()srrmxrpno4aexn oeiysls el( o t)teenmf3oa1fatrauvo;s) 2umxo3no4op n ivsatfarurx pnt4aptnmfciys s2umnvpn(4aeermo oydfm e nes s)trtoxr oudalt mict (  Drm( onu4apt mf3taslmDrm(vo () rtnir3iytoatr ieo;t  etmxo3iy1olt lnetls  rurxmpnt4opx ifcilsla2raumpn() exoxo3tytfpDe ieo;s)trur(rpoydopenmfctas)a2ra(m ou0tlxnmoeils m em(mpnu) rtnif3ta1oatr i ilt texmxmpoydapt lietatfsrraxrpnt1aexomf3iatfmDrlnvon(4aetoxf oa1lm rai o;t0 etmiopoodalen fcilsfsDtax pnt4olxoifeildlsDrau p;(0 rtnio3iy1fa raieo ()s2toimpiy1llenmfesltf Drmxr oo1alxnioctytfaDum( s u) lxriocia1om eaiesl() eumxm oo1lme mnetl( sDtmuro;u0tpxnio3tad s ran o;t0 lenmo3oatla ean i () exoxm3nu4lmenmnvtat) Durxrooo0tleo i3ild a uau o;u4texoxf3tatlmDeau i;t0s2xoxopiodamtnliet t)a2rrxmont0olxnioctatfsDum(vp;u4aeerio3ia1lpDraues;(  rxmio nodam emfctltfartaxrono1aexo iciysfm2rlnvo () rtoircoadlptr ueols0 2um(m oo4lpte nvt sfaDum(rp;t0altomietad a2rmnmp;u4altrmfciadoa e nvo t0trtr(r ou1apenmfeilsfs2tm(rpnu4apto ociys sDulnvs t4 lerxf tatfmDeluvolt0trurxo3iodome licta()arta(m no1tlenmo3iad aDuaump t)tltoio3totfmtraivol(0teurim iudam emneta(f rtruro;u4tpxn f3tadfaDemums t)aetnmr3oytfpteai o s)trtmxr3nu4lm elfvilt arraurp;o1opt  ociatfm em( ont0areoir3tadop   u o;(0trtoxopiy1llte fvsa(  rtmu  nt0tetn oetatfa uanvs;t0tetrio iotlmt  iei s)s2uoirpio1lltelnctl(fs2trxr nu0tptomi3tls s ua(mp;t)texrxocoatlm  li ilt sexoir oo4lptnmnvsas)srua(m ;o1oetoio3iltfmDrmumo;() leomf3to1faDeauvi t)teuoio3nodoptn iei sfaDrauro;u4olt ifetysls2umnmp t4aeermociatoatrlnvslt)t2tr(r3no4am  mfei ( aDum(ront4aeeniieiasfs eanvp u0 rermrcto1opDelnvi t0setrxr iydalt livi tfaDraxrpoo0ope if3ildfs umnmp () exomf oo1opt ai s;t0tetrxr nudamte ncs t) rrrxr no1ole  oetlt mDulnvs (4tetrmf tytoaDelnvo;s t2um(r3nu1aleemiet s) ruau oou0apxomi3iatfmDul(mpnt0 eermocoo1op   neilt sexm(opiodamen neilt) Dtmx  oo0aleo feilslm2rl( snu0aexoifcia1omtr nvi s0s2xrxo3oudamenmiet s) Dtmxrono1ole  ictydfa2ra( o u) etnif oy1lmtelivs;t)s2urxopnu1olenlnei tfarrrurpoo1teeoiieiatfa2ea( o u4arermf3ta1opDe i i;s)teumirpno1ame  nct tfarrm( ont0oet mfcilsfs eanmon(0 etnxo iy1opD au i s s2uo(o nydop  lfciatfs2ur(roou1oee  f3tytfsDumump;u) exnxoctodlpD aivo;t0seuo(rpiy1omeelnvia() Dtr(mp;u1tpxo ocildfa2ul(mo;()treomo3tatoaDeaieilt)t2umxm oo4am nmnes ()srumxmpot1tpxomi3iasfsDrl(mont0treomfctodlpDeai o s)tetr(m nu4ol nmiesas  rrmu oot4oexoiicild sDea( s u4treoxrcia1lmDr ueilt  exm(m3oy4alt lnvtlt artrxmpno0aptn feiyslm emu o;(4arxriociotlpt lues;t0texr(m3nodlm emict (  Drr(mono1alxoiiciltfa uanvs;(4 ltomo iy1omteanes;t0s2umxopnu1lpte iei ()aDrmxront1tpxoif3iyslmDrauvp;u0 ltniociadfmtrau ols)t2urxm3io4openlfcias) rrr(m ;o4opeoio3ildfa uanmsnt)artrmr3tatomDeanvo;t truoxr3iydomeemici tfsrtr(mpno0olx  fciadla2rmums t0tleomrcta1om eau i (  rtmio iu1lm n fcs ()aDtr(m ot1tptomicildfaDranvsnt)alenxf3tytfm ean sls) 2um(mpiu4apeemfcias a2trx p;u1apto fctadfs el( sn(4 lerif3tydomt lueils trum(rpiy4omtemfcs (fsDrrx pnu1ope ioetldfmDra(vo u4tltoxr iydfpDe uei;t)texr(mpiy4lpe mnetl(  Dur(m ou4apxomicildfm el(vs;(4alxnio3ootfa rai i;()s2xmim3oodoptnlfvia()sDtm(r ou1tet  oeiad a2ua(mont0altoxf3tatlmDeanvi ()srtmxopny1ale mnvsls)srrr(r no1apen i3tltfa2rm( ont4texrmrcoytlate nes;()t2urxmpny4lltelncsas srtaxmo;t1oltoiieiydla elu p;u0 lenxo3io1oaDeln i;t0srumirpou1altn nvs ()a2uru  ;t0tex  icias aDrmu o t)trtrifciadlaD lnvs;(0 2uoio nydolen fetls a2urx  no4teen oeildlsDum(mo;(0trxrxfctydom  ln ol() rxm(r3oodomtnmnei ( s2ur(mo;t1tleo i3tydlsDran p (4tltnxfcio1fpteau s;(0t2xo(o oy1omtnmnvt ( sDraxrono1aetnioetydfa rmuvp (0tlxnmfctatla r uvi (0s2urxm3io4olte nct tfartru  ;t1tex mictls s2umump u4 rtoio ia1lmte nes;t) exo(mpiu1ole lnvilsfaDtmx ono1teen i3tytls uluvo;()tltrxo3iodla  lieols) 2xo(mpno1optelnci ()srumx o;t0tetnmo3iltfm rmuvonu) etrxr iydfate nvsl()setrir oy4ole lieiat artaump;u4alt ii3iltfmDulu p;(4tlxnir3tadfptr uvi (0srur(rpoy4am n icsatf 2ra(r ot1oex if3tysfaDuln o;u)altomfcootlptr n slt) etr(mpoy4amenlfcias)arurum ;u1opeo fciasfsDrlu p;u0 lerif ia1fpt  nvs t0 2xr(rpnu4optelfcta( sDrmu  ot0teeniieilslmDua( pnt4aeeoif tatlmDrluei;s texmio3iudap   ieslt  2taxrp;u0altnioctas a2rau o u4arermr iadoate u i;s)srxo(mpio1olenlfet () 2umu  ;u4alt miciys s2eanmsnu0tlxrxr oytop   uvo;t)trtoxrpiydlleemneias  2tr(m nu0open ieiad sDumumo (0trermocty1lmt  ivol(0teumiopiy1aptnmnesat aDtmxrpnt1tptomiciasfaDuaump;()tlenmf oadoa  luei s0 euoxrpiydapeelfctl(  Dtrx o;o0optn i3tasfsDuanvs;()alxomoctodom  an o;t)srtr(mpio1llte fvtas) 2ur(r nt1altoio3iys mDeauvp;u0 lxrxr iytoatrlu s (0tetrio ny4aptnmivtlt)sDrm(rpnt1teen octltfa2rln p (4 lxnif3iotlatelieo;s t2umxm3iydaptemfei sfaDuru  oo1opx ii3tltlmDeln p t4aexnmrciodoa rli o t0s2tm(o nodolt  fcta()a2rr(mooo0oexo o3tatlm2rl( p;t) rxoxr3io1lmtelieilt)srumirpiy1aptn ici s)a2tmum ;u4tle iietydlsDrlnvpn()texriocoy1lpt aneilt  rur(r3oy1lp  micsl()arurum nt4ale  ictls m2rmnmo t)alxniocootfm eanvo;s0teurxm no4am n fet t aDta(  ;o4teeomi3iytfs2em( sn(4aeeoif3ootfpteai i t)s2xo(o3ny1lleelfci s)sDra(moot4opxo ietlt m2rauvs;t0 rtrir3iadomtean i ()trumxrpou4amtn fcils sDrr(ro;t4apxn fetlslmDemump;()tleoir3iotlp rlu o t0s2to(mpiodapt  nvs (fsrrmurpot4tpx io3iyd a2emump;u)arerir3oydlpDrlu slt)seurxr3ou1optelfci (faDtm(mooo4aexomf3iatfa2ea(ms;u0tlxomr oydlm   ues t srtrimpiodalte ics t)aDrrurpnt4tlt  f3ild m ulnvs;(0 rtnxocoatlm rlnvo t) rtrxo3ou4optnlivsls  Draur ;t1oex iiciltfmDrmums;u)alenxf tadlptrluvi () 2urirpoo1amt lneta()artm(ro;o4apxomociydfsDeluvsnt0 rtoxo3ia1fp   neils0seuoxo3io1lp e fvslt srrm(mpnt0apenmiciadls rmnms t4arxnmoctydlaDeau ol(0t2urio oudaptn fetat)arrmu o;t1oleomo3iytls rmumpnt4texnmf totfpt livs s0texo(o io1am n iei tf 2umu  ot1tptn o3tltfsDrauvs;(0aeenmo3tytlmDeli s;t) etrio3oo4ll nlfesls) rrru o;u0altnmfciadfm em(mont)tltoir iydop rau i;t0trxoxmpio1ape  icsl(f Dtm( ooo4tpx mi3iasfa emn ont0aetrxr3iatoa   i ilt0trtr(m nodlpe  fcslsfsrrax pnu0aex  ieiys s emuvo;u0arerxociotlp eln ols)srtmim3iu1ll emfvta(  Dua(mo;u0aetnmieiysls emu ont0 exoxr iy1fpt liei t0seto(m3oo1openmfes s)a2taxmp;t0tptomi3iytlaDrmu s u)teenirctatopDe neil(0s2umiopny4amtemfcsat)artrxmpno1opxniieiyd sDua(vp t4trtnmo totlptranesls  rxrxr3oo1lm nlfvs s aruau pnu1tpen iciasls um( snt) exoxf iotomDr nvils  rxrxm oo1al  lnesa( a2uru pou1tpt mfetlsla uanvo u4tetoxf3oytopt au ol(0trurxopiy4apee iei sfa2ta(mp;t1tpto feiyd a umuvo;t0trxrxf3iodfptean ils)setr(o ny4op emnvtl()a2trxrp;o1tleomoctlsfs2uan snu0teeoif oydla   i s;( s2xoxm3io4am e icsasf rum( poo4aeenmietytfsDrmnvsnt4 etrif3oytlaDr nvs t) rxmimpiudomtelfctlt) Dum(m ;u1apxnii3tatla2ulnmon(4alxrmo3totfm r i i;(  2xmimpnu1ope mnetas srraurooo4ope  oeiydlsDel(vp;u0altnifcio1omDranvo;s0 rtmxopnydlme lfvs ()sDrrx ooo0aexn ictydfs2umnmsnt4 ltoxf iy1fpDean o ( setmxo ou1op  mnvi (fsrrrumo;o4oee  ieiadfmDumums t4tleomf3tadopDr uvi;t)truoxo iu4lpe lfctatfaDuru oot4texomicildlaDumums;(4 etoif iatfp rln sls0srurxopiodamt mfcs ()arrmx pnt4ole  ieilsla2rmuvs u0tltnxfcootlp r uesls0trurir3io1altemnvi sfs2rrum ;u1tlxo f3ilslsDemuvsn(4aeermf iy1lpDrli o s)tetr(o3nu1llt lncslt)sDua(ro;o0tlxomoeiydfa elnmonu4tltrmo iy1lmt  ueils0 eumxo ny1om e nvi ( aDrrxmooo0optnifeiltls ea(mp u0 rxnio iadoaDe nvi;t0 rurim3iydlmtelnctat) 2raxrooo0alxnmfciadfs2rlu snt4teerxo tytlm  anvo;s0seurir ny1apen fesls s2trxro;o4ape  i3tltfm2ea(vo;u0artnif io1oateluei t0t2xrxr3oo4ll elfetl(  ruau  nt0aee  i3iltfa2ea(mpnt4artnif ta1op eau o s0teto(rpiydomt lfeias  rtm(mpot0opx mo3iatls2ran s;u0aeeomf tydlm rlnvi;s  2toim3iydap nlfeslt)a2rru  ot0oeeomocildlsDem( o;()trtnif tatoat  ivi;()texmir iudameemnvil(f 2tr(r ot1tlxomiciad sDeanmpnu4trenirciadla e ivsls sexmir3iudomtnmnvi t  2rm(m oo1apx  fctaslm el( onu) lxrmfctodlp r iei t0t2tr(mpno4am nlfcilsf Dtmumono4tleoioetadfsDrln pnt0texomo ty1fmD lues;()t2xm(r3ny1optelivt s  Drr(  nu4tlxoiiciysfm em(mp u)tlxoir ty1fm  liei (0t2toio iy1ome  neilt) Dum( ont1olt iieiydls el(vp t0artnio tydfa e nvo;t seumxrpiudomtnlicia(fsruau ooo4tee  octls mDuanvs;u4 rxomr tadomD lueol( trxoxrpiy4am nlfeta(  rururp;u0oex ioeiltfa rlnvsn(0 renmr3tytoa rln s;s trtoxm ou4ap elneiat sruru  nu0aptomi3tydfmDum(vs;t) etrmr3tatfa e uvs s0srxoxrpno1oltn nvtlt a2tr( pot4apt  fctytlm2eanms u)tlxrir3tadfatrli il()srumxopoy1aptnlfvil()sDtaum ot4aeeo f3tlsfsDeauvont0arenio3iadoptraneilt seto(m3nu4lptnlnes ( aDtmu oot0olt  f3ilsfaDum( pn(4 etrifciadla eln slt  rxoxmpio4ameelnctlt) Draxm ;o0aexnmf3iadfsDean o t0alerxf tadoa rlnei;s0 rxoim3oy1op  mfeil() ruau  nu0tpt ifeiys mDemu p;t4altrif oy1lmD au i s0 euriopiydamtemfvt (f Dtaxmpot0open o3iytfs eln o ()trtnxocty1omDeanvo t)texmir oo4ol nmivtat  Dua( oou1opt ioctldlaDulnms;(0 lenmociytomteluei;()s2xo(m no4opeeliviat sDtm(  ;u1tlt  octlsfa ua( pnt4aleomf3tytfaDrluvi;t  exm(o3iy1lmenliei t)sDtmxronu4alt mictyd a2ean o;(4 lerxr oytlaD  ies;t  2xrim3iu4lpe  fcils arra(mo;t4olxnifetys m uau s;t)tltoxf3totfptrln i;s trtr(m3ou4am n fvia(f Dra(rpnu4optomictysfs2elnvs (0 etoxfcoa1faDeanvi (0seuoxo no4oleemfei tfaDurxrp;t1tlxomoetysfm2ra(mp u4 rxrxr3ty1latr i s t  eum(rpnu1lme  nctls)srraumpot4oex io3iadlaDuluvsn(0texoif3iytopt li ils0 2xmxmpoy1ll nmfeta(  Dumx  ot1tltn ociad s rln p t4altoio oadoa r neo;(0t2xoir3nu4lleelnetls aDururonu4tpe  oeiydlm ea( s (4tlenxr3ta1opDeaivs s0 2xoio3oudom nmiesa()a2rm(m oo4tptn feiytfaDea(mont)altnir3todoaDeai o (0s2toxmpoudlptnlfctat  Drmxmp;u4tptoifeiltla2em( onu)alxrxf totlp r i s s0 rtoxo3oodllenlfesl(  Durum ou0oexn ietltlaDrm(vp t4tltoifciydlptranvils0s2xrir nu1amenmfcsls)sDtrxroot1altnioctlslmDea(mo u)altnifctytfa   nei s0truoio3no1om n nvils srraumoot0olxo iciaslm emnvonu4artnmrctydfp raivol()srtm(opoy1lpt  ici s)aDrmu pnu1olxomi3iadlaDuanmp t4aetoxf iodlmtranvslt0teumim3oydal emncs (f Dtaxrono0oetomfeiys mDrmu ont4 rtoxrcoadlpDrlneols  etriopny1omtnlivtlt sruaxr nt0aetnioeiaslsDrau onu) eenxrciadfmtrlieils0sruo(r3ny4apt  ieta() rumurono4oexn ocilt s rlnvonu0tlerifcootoptrai ol()tetrir oo4alenlfcsas)sDrrum ;t1opxn f3iys s em(vs t)tetoxfcoo1fat anvi t)trtrxo iu4llt livsas) Dumum ot4texniictltfa2uan o (4 lenirciadfm e uvi;s  rtrio ny1om   ncslt aDraxr nt0oexnmo3tldfa2raumsn(4aleoxrctatlat luvi (0t2um(mpoudom emiei tfsDtmu oot1ope  oeiadfs2eau p;t4texnxr3ty1lpteluvilt)srto(opiu1apenlnvilt sDurumpot4opx io3iytls um(ms t0arxnio iotfa rlu o ( t2urxm ny1lpeemncias a2trx oot4openmf3ilslsDemump;u)tetnir tatop rlnvs;(0trxoio3iu4om e nvi () Durxm ot1ope  f3iltls2ean onu4tltoifcty1fat 
\ No newline at end of file
@@ -0,0 +1 @@
+n o ( t2uo(opnodalen ivs (  rumuro;o0apxnmieilslaDea( p u) eeoir3io1fmt anvols0s2xmir nudlmtnmnesl(  2urx oou4aetnmfciydls2ulu pnt4 ltoif3iotlptelnei t trxrxmpiu4ap  mfciat aruax  ;o4oeen fctld aDea(mpn(0 leoxf ty1oaD  ieo s0 2tmirpoo1omt mfct s  2ra(rpnu4altoiicilsfs ulu p;()tlxrirciy1opDrliesl( teum(m3iy4ll  lncil( artrumpoo1tpx ifctas s2ranvont)tlerxocoy1fa rlivolt)truoxmpoydapee ieils) Draxmoou4tpt  ieilslmDrl( o (0 ltrmf3tatlaDeaueolt)t2trxo3io1lp emncsat)sDumx o;u4oleomi3tytfmDel(vpnu4artrmrcoadlp e i ols  etrxr3oodaptnlnctls)aDrrxrp;t1tptnmoetadls2rmnmo;(0trtnmrciadop rluvi;t)t2tmxo ny1omen ivt s  rraum ;o4aeeo icilslm2emumont0arerir3tytoatrlivs;t0t2uo(opoy1lpte ivt s  rrrurpnt1tpeomoetat mDeluvont0artnxr3oytlat an i t)sexoxo3iydam nlfvil(  2uaxr oo0olx io3iaslm uauvs;t0teenxo3oy1oa rln o s trto(rpno1lmenlnci () rur(monu0olxniiciadfaDran p u0 rtomf3tytop e uvslt0srxoio nu4lle  nvia(  rraxrono1oltomieilt a rlnmo t)artrioctydomD auvsl(0tetoxr3nu1lmeemicsat) rrm(  ;u0openio3iyt sDea(vo t4trxoio3oatlatr ieol()sexm(o iudomtnlnvs tfs2umumpnt0oeenmfetls sDul( p;t4 exomo ty1opD livi;()s2ur(m nydapeemnesa(fa2taurpoo1oetnmietad m2ulnvs;u0tetoxo todfm  liei;s)t2toim nodoltnlivias  Drr(rpnu1apx  icils aDum(vs;(0 ltoio ta1faDe uei (  2xm(mpoo4lpt lnes s  2tr(r no0apx mfciatls2rl(vsn()trxnmf to1fatr ueols  2xrir ny1lmenlies tf rtaxr ;t4apto i3tls a rl(ms;t)aeenifciy1la rlieo;t0 rurxrpou1llt lfvsasf 2tmur nt4oex  ietas s uanvo t0alxnxr3ty1fptrauvilt0 2xmimpnu1omtn ivs () Draxrpnt1aeeomo3iasfs2rauvsnt0aexrmrciy1lpDeau i t)trtrxo3iudapee nctat  ruau o;o0aeeo oeiadfa eaumonu4aeeoxfciotla r nvils)trurio iy1oleelfvilsfsrtruro;t0alxomfcias m rl(vp () rermr3oo1op raiei (0t2uoio oydapte nctatfsDum(ro;o4oexnifeiasfa2em(vs;t0texrirciydoaDrluvo s s2xr(r3iy4om elnci ( artm( pot4olenmo3iad s2ul( s;u0 rtomf to1fa  aieol( s2umimpno1amtnlivs t) 2ta(r ot1aexnio3tasfm2uau p u0 rxrif iytlpDr uvo ( teuoirpno1lp emncils)aDrmxr ou0tltnmfeiadfsDra( o;u4arxnif iytopD  nes s texmxo oy4omtn fctlt  rumum nu0aet  i3ilslm emnmon(4texomfciy1lpt lies;()srxmimpnodlm  lies (  rtmurpno4apx io3tldfm2ul(vp t4tlerxociatfa r i ol()texr(m3oo1llt lietl()aruaxrpnu0aleomoeiad m rln pn(4alxnifcty1lmDr iei t) 2xmimpio4lpte neil( srurx  oo0teenif3ilslaDelu p t4tlermo3tytopt aivslt  2trxrpoy1lle lietat)srur(rpno0alx iictlsfs2ua(mo u0 rtoxr3tytlpt auvilt0teurxrpoodomt mivia(fs2uru  ou4olenmi3ildlmDra( snt)tltnxf3ia1fmtean s ()s2tmimpoodlle miei sfa2rrxmpnt0tpt iieilsfs2ul( s t) ltrmr3to1oa ranvolt) etm(o3nu1ape  fetat  2ra(rp;o1tptomieiadfm2ran p (4 ltnxf3to1oaDr i o s0 rxr(o3iy1ll e ncslsf rrr(ronu4aet ioetadfs2uan snt)trtnmf ia1fmtelues t0sexm(r io1aleelict (f Dtm(mont0tex mfetaslmDeauvp u4treoio oytlaDeauvslt0 rum(opnu4al nmfvslt) rumumpno0tptnmietytfaDelu s u)tlxoiociytfm eli s s t2xr(opio1lltnliciltf 2uru ont1tle  oeiad a2rlump (0tltrmr iytfaD lnei;s0t2umir oydalenlietls artru  nt1oeeomo3ildfaDul(vpn(4altrif3io1oa elies;t  rtr(m io4al elfcsl( arta(m ot1tltoiieiaslsDumumpnu4texnir3iydfa rluvsls0 rumir3oy4am nmfvsl(fsrumurono0apxo ieiydlm2um(mo t0artnxfcty1oa  ln i;(0 rtmimpoo4opt mnetl(fa2rr(m ot1oltoif3ild m um( p;t4aexomr3tytoa elnvs;t t2trirpnydlme  nvtas s2taxr ;o4ope  octyt s uaums t4arenxr oydomt lneo;s)setrirpoudopee fcsas artaxmpnu1apxo fctlsfa2ea(vont) rtrmfcia1fatraueo;( texo(o3ou1aptn ivtas)srumurono4aptoifeiyt m rm( o t4 rerir oytfpteluesl(  rxmio ou4olen icslsfsrur(rpot1aexo oetat s ea( s;t0trxoxo to1fm   nvs t0texoxmpoo4lm  mfetlt) 2rru oou1oetnifeiad mDea(mont) ltnxf3tydopDe uvi (  rxrxr3iy1lpen nci (fsrrm( onu1ale  oeiad aDrlu pnu4 rxnxr3iadlmt  u i s trtoio3no1alenlnetasfarua(  nt4tpeo oetydla2rmuvo u)tlxrxfciotlmDraueils  eum(mpiy4ole lfvtat) 2uaum nu1olto o3iadfs2emumsn(0tlxomfcoatfm r nvi (  exm(rpiy1om emfeil(  2ta(r oo4tle if3iasls2elnmp (4 exrmr oa1oa r i s t0 rumirpoy4ole mietltf Dumu o;o0apeo fctyt a2rln o t0 eeomr tytfpDr uvsls) euoir3nu1llte fvsas  Dtrumpnu0tlxoif3iatfs em(msnu0aetnmfciytoptr nvs;t0srto(rpno1olenmnvilsfsrta(monu1aex mo3taslm2el( s;u)artrmfctytfmD  neo s s2tm(r iodap nmfesasf ruaxmo;o4apxnifeildla ulnmp t)aeerio3iadla eli i s t2tm(m oy1openmnesasf rum(  ;u1olxnmoetadfa2rlnvp;t0tlermf3oatop rai s;s setrxm3io1apte nesl(fa2rm(  nt0tpeo ocils m uanmsn()arerifcoy1lmDeaivils0tetm(r3oo1lpee nvsat)sDurxrpou4alt  fctatls2rlnvo t) exomo iy1late nes;() exrxmpoudomtelieilt)arra(r ot0ope  fciat s ua( s t)arxomr3todlpteau o t0t2xrirpou1open fct t arum(mono4teeo f3tasfa umu s t0 lxnioctadlm r uei t0s2xo(m3ny1am  licsatf Dumxrp;t0tex mfcilsfa elums;u) ltrxo3tatlmtrlnes (0srxrio3io1opte fvsat) 2umxrpou0alxo ociyd mDrln snt4 exomr oy1fmDrln ols srxrir iu1oleelicilsf Dtmxm ;o4alenifeiat s rmuvs;u) lxoxf3iatfpD au i s0 eur(o3iydoltn ncslsf rumxm ot4tpxoiiciys mDeluvp (0trtnmf totlaDe nvsl(0t2uoxm3iu1olee ivi ()aDrau  ot4tltomietydlm emu pn(0 rxnir3ootlaDr uei;s  2xrxmpiydopt mivsatf rtmxmp;t0teto i3iat aDumnvp t4teenmo oydoaDranvslt trumir no4olte fci (f rrrxr oo1ale mo3iatla em(mo u)aexoir todfa eauvo s  2uoxr nydlme mnet sf rurx onu4alxnmieils a2ul(mo t0trtoxf ia1lmDe ueo;(0t2to(o3ou4ll nmncta( a2tmumpou4teenmi3iydls rmnmo;t0alxrxrctytoaDe neo t)sexmxrpnudol nlncs () rrr(r oo0opt ioeildfa2um( sn(0 eenif3io1oaDelu ol() rto(m3nydop nmnvta(f 2rmuronu4tex ifciydfs rmuvp;()artomf3iodlat lnvi;t trxoxrpny1lmt liviat srrau  ot0ole moeilslsDuanms;(0tlxomo3totfa  li s ()s2umxr3oo4lmeeliciat arrru pnu1oee  ietydfa rl(monu4 etrxr tytfp e uesls  eurio3oy1op eliesa()a2rr(  nu0aeen i3ildla ul( s u)areoif oadlptranes;t)teurxrpio4altn fciltfa2tax  nt0apeo oetldlmDeln s;t0alenxr ty1oaD lnei;(0tetrir3io1aleelfes tfaDrm(ronu0alxnii3iatlm rlu s (4 rtnmo iytoaDeaies s) exo(m3oudom emnvi (fs2trur ;u4opeo f3tlsfmDrmumo t)tlxnioctotomt livsls0s2tr(mpiu1omeemictat)srrr(root4altoio3ild m emumo;u)tltrmr ootopt aneols0srtr(r3no4lpenlnci s aDuaur ot4tex if3iat s eln ont)arxrxf3io1lmtrlneslt trtrxmpou4om  lfes t  rumu pnu4tptnif3ils s2ua(ms;t4teenifcoydfaDrli o;t0truo(m iu1ame  iet tfaDraurpot1tptniieiltla uauvsnu4arxoir3iodfa rlu i t  eur(m3nudlme mies s sDtmx  nu1tet ifetlsfsDrl(vo (4aetomrcoy1laDeaieo;() etoiopiodal elfvsat  2umx poo0teeomi3ilslm ea(msnu4aeenxf3tatopD  u i;s srxm(o ny1opee fvtlt aDtm(mo;t1tptomo3tltls uluvp;()aexrmr totoa rlneo ()t2xr(m oydamenmnvsat) rrrurpot4aex io3ilslaDra(vpnu4 lxnxo tatla rauei;()s2tr(o no4op emicilt s2uaumo;o4tex iictldlmDel(ms;t0tetnxr3totlaD auvol( tetoxm oudame lncs ( arrrurp;t0oleoii3iat s2emums;t4 rerxo oytlp rluvo ( trxo(mpnudop   icsat)aDumx o;u4ape ifctasfa2ra( s;t) lerxfctodom rau i () etmxo3iy1omt lnet t)srta(  nt0oleomfcilsls eauvo;(0altnmr ta1fmDelieols0trxm(opny1olte fei s arrmx ono0tetnioetltlm2ul( o (4texrxf3oydlpte ieilt srumxopiu4lm nmnvt tfarrm( ono4ale mocildlm2ea(mp t4 rermo ootlateluvo s seurimpou4ameelieil( aDuau poo0apxo f3ild mDrln p u) ltnir ootlmD aies s0s2tmir oodlp  lnvi t srtaxrp;u4ope  f3iltfm2rmn p u0tetrmocoodfatr i o;s)seurxm3oodlpe lnvs s)aDrmxrpnt1aleoiocils s2eluvp (4tlxoiociatlpDeli i s0 rtoim io1ape lfcs t  2rrur ou4aet  fetatfs2em( pnu4tetoif3oodfpt lu i s) 2xo(o ny4lmtemnci s s2uaxmoou0apx moctyt m2ulnmpnu4 ltrio tatoa  lieo s  eurxo3oydlptnlnvia()aDtrx pnu4texniiciaslmDranmpn(4tltnxoctydoatranesls0t2ur(mpoo1optnlietls s2urumoou1optnmi3iatfaDranvs u)areoxrctodlptrauvi;s)trxr(o iy4op  lfesat) rtmurpot0oeenifetys m rmu pnu) rtrir3iotla r n i;t)sruoxm3ou1op e nvt () Dumx pot0aleoio3ild a2emumo u0 rxnxf iydfm eliei t  2toxo nydom e ivsas) rraurp;u1tlt iictytfa eluvp;u) exrxrciy1omt luvs (0 rxoio nydopen ivsas  2um(rp;t4tpeomiciltfsDrlnvpnt0 rxnxfcoa1lat  neo (  2urxo nu4alenmfctl(  2rmu pno0teeomietat s2em( onu0aexomf oodfm  auvs;t  2xrir oy1al nlieta( a2rrumoot0alxoioctlsls rm(vo t) eenif3ia1opDeaneo;s0s2trim3oodomen ivsat srum(  ot4apeo i3ild a umumont)alxnmfctotlmtelneo ( srxmio3iy1lmen nvt (fs2tax onu4aet iieiadlm2eanvo (4trtnif3tydlp  anesls) eumxm nodom emnvs (fsDumurpot0opt moeiadlm2raumon(4tltnir3tatfa rlnvsls tetmxm oodlmteliei () 2raxmo;u4openmfcildls2uanmon(4treoxr3io1lptranes;t0srtrirpny4oltnlnesa(fartr( onu4oetnifcilt s rmu ont0 eeniocoadlptr nei t teumxo3ou1lme  nvtls sDtrxmoot0optn o3iadfm2ranms (4tlenmfciydlmtraiei t) 2tmxr3iu1llen ncs (faDum( pou1aexniietltfs2um( s t)arxoio3oa1oatelu sls0t2umxr ou4lpt  nvslt)srtaumono0tlxoiiciatls ul(vsn(0 etnxrcoytfm r i s;t0 rxr(mpio4aleelivt ()srtr(  ;u0aeenmf3tytfa emu o;u0tetrxrcoydoa e ies;(  rtoir3oy1am nlnetat srtr(r oo0aet moctad aDuan snt)trenxr3ootomDran o () 2xo(mpio1lptelnctat  2uru  no1tlto ietatlaDrmu o (4 exomrcoytlm r uvi;s0srtmimpoodlleemnci ()srumumpou0oeeoiiciytfa2ul(vonu0aexnio3iadomD aiesl( srumirpiy4apen feiat  2umxrp;t1oltnmictltfs ra( o (0arxnxrcoytoa   nvolt trum(r3oydlpt mnvtlsfartm(ro;o4aleo ieiydfm2rlu s () ltrxoctodfmD aueslt0trumiopou4aptelfvt ( a2rrxmpnu0tltniociydla ran p t0trenxoctotlp  aieils sexm(o3io1omenmneta(f 2raum oo4aex mieiysfs rl(ms t4 rtrmf3oytoa  livs s)t2tmxm3oydlpt mfesat)artaumpnu4oexn i3ildfmDeanmo;t0aexrmrctatfat livils  rumxr3nu4op nmies sf Dtrum ;o1alt  ociytfs rlnms;() renir3todfaDr i s t0 rtm(r nudapenmncs tfa2ur( o;o4aleomfetls a rl(vs;(4 etrifciydlptran s;(0 2to(o3nu4optnmfvt tfa2ua(rpou0apxnii3iltfsDelumsn(4 eerxocoodfa e ues s srurirpio1lptnmnvtlt s2tmu o;t1opeo ieias m eanmsnu)texrmocoytfat aueols) eurir io1al elivsa(farra( ono0tetn feiad mDumn pnt0 lenxf3oadfaDrau ol(0 2uo(o io4olt  nvi sfsDta(  ot4ope mfcilt sDumu snu)artoir iotlatr nvs (0trxmxr oodaleelfvtl(faDuaxmpou4aeeo feiatfaDul(vonu4 exrio io1om  ai o;( tetr(mpoo1am nmieta(  rtaxr ;o1alenmoetldls2umnms t) ltrxo3ootla elnvsls  rumirpny4ol e fet ()arrru o;t1tpt miciydfm eau s (0aleoif3to1lmDeaies s0s2toxrpoy4ap nmnviltfsrtaxroot0olenif3iydfa rmump;u0artrxf ty1op  ai sls) 2uoxopiydaptnlivt t s2uaxrono0aexomiciasfm2umn pnt0aexnxr3iytfat  u i;(0setrirpou1ome  nciltf Drmxr no4oeen feiys mDumn o;u0tlenir tydlpte uvsl()s2uoxr3oodlmenliesa() Dtax o;u4tptnmi3tad aDrmu p;t0tlxomf totfm r ivs t t2toxopnudalte nvil(  rtax  ;o4tpxnioeiydfm raump;()treoif3oodlmt ai s ( srtoxopou4ame lfvias  rua( o;u0oex moctasls2rlu on(4trxnmr3oadfm eli i t  exmxm nudome  iesas)sDtaurpnu1opt  f3tys m ranvp;t)arxoxfciydlatrlivs;t)s2umxm3oo1omt  nes ( srurx  no1opt mfciytlmDrlnvp;t)arxomfctodfa  lnvo;s)s2xmxrpoo4lmenlnctl() rraur nu1tpeo oeiaslm2eaumsn(4 lxnio3io1fa rli slt trtmiopiy4om nlictlsf rurxmpnt0tpx  fetasls elumon()arxrxociy1lmtr nvs;t)s2urxrpiydal  lfvi t srrmum oo4tee mi3tlt s ua(ms u4teerxf3oadlpDranvilt)srumxm oy1lmtemnvi (f 2rm(r ot4teeo ocilsfa2em(mont)teeomf3ia1fmDrlnei;t) 2umio3oy4altnmnctatf rtm(  ou0olxnii3tlt a rluvpn(0 ltomf3iodlateln i t) 2xoxrpoy1lm  mnvsl()artrxro;u4oexnmf3tld aDea( pn(0trtrxo3iodfmDrlneo;s) exo(r oy4llen ietatfsDuau p;t0altniietld mDulnvsn() etoirciytopD an olt) exrio3nu4ol  lnetat)aDrmuroot1apt  feildfa2rmn s (0 reomo3oa1lp  lieilt)teto(rpiudllenmfcil( s2umx pno1aeenmo3iadlaDrmumo u0teerir3oytfp ranvs;s0trurim iydom e nes (  2uaxmoot1tpxoio3ildfa2rlump;(4aexomr oadomtrau i;s0srxmxo3no4ame lfvsl( sDumxroou0oet  i3tadfs rlu s u4 rerxo ootfa eln o t)srto(m nydlp nlfeiltfsrrrxm ;u4tet mfeiatls rmnvsnt0trtniocoa1omDe nvs;s0 2uoxrpoudomte ivs ()a2rru pno4aptniictydls rlnmon(4 lxnxf3todomt ai olt0t2uoimpiodlleemfcsl()aDururo;o4oeenmictyt sDrm( p u4tltrmo3iatoate n ols0tetoim3iudlm nmiciltf 2um( oou4alto o3tyd mDum(vp;u4tlerir3iytop e nes (0srurxo no4optemfctlt) 2rr(monu1aexomfeildfa2elump;() ltoio3iy1omtraiei s0teurxmpnudlmee ivsl( arrmxro;u1alx ifeild s2emu s;u4 rtnmo3io1fmtr ueil(0 exm(o ou4amte ics t)s2rrumpnu4oeto ieilt sDuau onu0trxomr ootoa   n o;t)s2tr(m nudalen fvtlsfaDrr(monu0aeeo fciyt sDel(vp u4tltnio tadfatrlneolt  eto(rpoo1lltnmnviltfs2umu  no0texoii3iat aDemnvs;t)arxrxf3ootom  livilt)s2xr(opoo4am emnvtat)s2rrx p;o4apenmictydlaDrmumonu0aleomfcoo1om   i s s)texo(m oy1ole  ivsas)s2urumonu1oeeniiciatlsDra( s;u0alxoxr iytoaDe i sl(0srxmio iodalt lfvslsf 2rmum ;t1alto i3tad mDuln onu4 ltnxo oydfmDelu s t)s2tr(r iudamt  nvsa() rumu  nt0tleo o3iyt mDrlu pn() rtrifctatfpte i s ( trxo(o3nodomte nct () rtr(  ;t0aptniiciyslmDem(vs u0teenxr3oydlptr ies;( sexmxm3iodomtnmivi s)sDrmu  ;o0tpt ioctatfs2el(vpnu4alxrxf tadlp eai s;s)seuo(m ou4lltn ivi sfs2ra(mpou0opx  o3ilsfa rau o;u)aetoir iy1late neols0 rxrimpnu4oltelietl( sDum(  no0opxoio3tldls2rl(mo;(0 rtrmf3oa1lm   neol(0 rumir ny4lmee neias)aruau oou4tlxomfciyslsDrlnvp t) lxnmf todlate uei (0sexo(m ou1lltnlnvt (fa2urxmoou1oexomo3iasla rmn p;t0aeermf iatlptrlues;t) etmiopoydameelnctltf 2tmuronu1apx io3tatfaDrlnvp ()arxnmr3oodlptrai o s0s2xmxopou4apenlfctlsf rurxro;u4apx ii3tadla2eanms (0trxrxo3oy1lm r u o;t)trxrimpoy1olt mici sfaDtaum ;o0tptn ieildlsDelnmo;(4arxnxociy1lp e ueils)t2um(rpiu1lmeemieiat)aDtmump;t4ope  o3ildla ranvp u4 exomo3ta1laDeai ilt trxr(o3ou1lpe lncta( aruau onu1aee mfciytfsDemumonu4alxrmo iatomD luvi;t)seurxr3iy4ope mfes tf Drax  ;u1alx if3ilsfs2ranvsnt)texnxf3todfa r nvs;s  etoxm oy1lptnlnetat)s2rm( pno1oetomoeiyslm uaump;()artoxociytfm e u sl(0teumxr nu1amen icias)srrrumo;t0tpxoii3tatlsDelumon(0alerifcoytomDr uvo ( t2xo(r io1omtemfvils)s2rr(moou4oltoii3iyt sDeauvp u0trerif3oo1opDrli o;t) rumio iydlp n ici (faDurxr ou0aeen oeilsfs em(vs;t) lxrxociytfmDrauvil(0t2tm(opoy1olte icta( aruax pnu0opeomi3tys sDuanvont4treomr iytlpD  nvs;s0setrxo3oy4lmtelncilt s2tau  ot1tlxoiictyt m2ranvp t4alxrif3io1fp r ieslt srtm(rpnu4olt  ivs s srum(ro;t0tlenmi3ild aDel( p u4tlerir3tadfmteaneils0 eumxr nydoleemnct t s2raxrono1oee mocildla rluvs (4aetnmf oytfaDeauvsls srtr(o oo4lme livt ( s2umxmo;u0tleo fciadls2emuvo t) rxrxf oo1lmDean i;s0trumim iu1apeemfeias sDta(  ;u0ope  oetat a rlnvsnt4aeerxf ia1fm rlnvslt  rxrxrpoodll elicsas a2ua( oot4oet ifeiasls ea(vo t4 ltrmocto1oa ean sl(0s2tmxm3nodol  mics s artru  nt4apen f3ildfm2ran s;t) reoir3tytlaDr n s s0seuoxo3ou4ll emncsltfarumumonu0tpeoiicilsfm eaumo;u4arxrio oatlaDranvilt) rtmir3iydlm  livils s2um(rpnt4tlxn oeilslm2el( pn() eenmrctodopt aieo s0 2umiopnydamtnmivils  rumxr nu0texnmfetlt sDelnvon(4arenmo3iytlmDrlnvo t)trxoxo3oodoltelnvt () rrrxmono4texo f3iad s elump;(4teenxocoatfpDeau o t0 2uoxm3oy4lpeemnctatfaDuaxro;u1tpxniiciaslsDelumonu4alerif3oydopt lu o t)trxoir3nu1lmtelnvilt)srtaumpou0aexn feiytlaDemums;t)tlenxr3tytlaDe ieol(0 rxmim3iydll   fvsltfsDra(mp;t4apt  f3ildlm rm( pn(4tlxrmf tatlatr neols  exm(opiodam nlfvsl(fsrum( o;t0apto ociat mDra( o;u0 leoxr ootfmD  neil(0trurio nu1ap  lfet s) 2taxmpno0teeoiictld a2uan p;()texomr to1la eanvs;()teumxopno1am   ivt (fa2rm(roou1tleoiictysfm ul( s t)texnmr oa1la r u o;(0s2ur(o iu1lmeemnvsat) Duaurpou1tptnifetltfa emuvo t)trxoxr3oytlmteanvi t srtmim no1lme mictas sDua(root0aleomoeiyd s uluvs;t0aeenmfcty1lp r n o;s) exr(rpno4omenlfetat)a2uaxm ;o0apeomfeiatfs uau snu0teerxoctytlm e uei s)t2xrxo3oy1omtemieia() rtau p;o0alenmfcildls2ulnms;t4tetomo3oa1optraueo ()seumxo no1lpen nvt s) rua(  ;o0tltn feiad s ea(ms;t) exnircoodfaDelnvolt) rtoxr3iy4lm   feslt) rrax poo4optomociytfs2eanvs (4 exoir ia1opD au ol( trxrirpnu1al nmies s) 2tm( o;u1teeomietldfa2el( s;(0alerxo3oa1op  lieol()srxo(r3io1opeemnesa(farua( p;t1alxo i3ilslmDulnmo u0 etoxf3totlm rai i (0s2xoxr3nudol nliei (f 2ur(rp;o1oee  ietytfmDua(mp;(0trerifcoy1fp   u i (  2um(mpou1am e fcil( srtmxmono4texn fciasla2um( ont)tlxoiocta1lp  luvils0s2xoxo oudll n nvtasfsrum(  nt4tlxnio3ils m2rlu onu4 rtoxf3totoaDeai i t0trum(r ny1lleelfei sf Dtau oot0texo ictys a2eanmsn(0 eerxocty1fm e ieo;( tetmxrpny1ome mncs ( sDrrum ot0teenmf3iad m uln o u0arenifctodlpteanvi (0tetoio ny1lmeelnvs t  2tru p;t4tlenmfeiatfaDua(vsnu0 eenxf ootlmteln il()s2urirpiodome lietltfartmxmpno4tpxoii3iasfsDrl(vs u)arxoxfcoa1omD ln s ( s2xrxm nu4ap nmivtas  2uaumpnu4tpe mfeils a2eln pnt4 lxomo3iytlmDe n ol( s2xrxmpno1amt  nvslt  2ra(mpot0oltoif3iaslmDua(mp u)tltrxr3tatfpDrlu olt0s2uo(rpiodoptn fctat)s2ta(rono4apt mictat mDem(vs;t4tltoirctydfmDe ieo;( s2ur(o3oo1lleelnvta()sDrrxrono0alt mfeilt sDuanmo;u4 rxrio iytlm eluvo s)s2triopnodom nmicil(  Dtrx pno1ope mi3tlt s2rlu s;u4arenio3iytfmt li o ()t2xm(r io4ol n ictls  2rrumpoo1olxo icias s2uaump u)teenxf3todlpt anes t trto(r nu1aptnmfcs sfartaxmooo4tlxoif3ilt aDel( pnu4 exnmf3tytomt anei;s0 2urxopnu1alenlfetas  rumu pou1alxo iciltls eluvs;() lerir oo1oatr nesls)tetmxm3ou1apte nvsa()srtrumpoo0oet  f3iysfa ul(ms t4aeenxf oo1omt aies s  2tr(r3io4alt miet (fsDtaxr nu4texn octlslm eauvpnt0tltnmf3ia1omt  n i s)tetmxrpoudopen ncslsfa2uaxmono0optnmo3tlt aDrln o;()artrxo oa1omDrluei;t sexr(o3no4ll n ics t)srraxm ou0teeo f3ilslm2ulums t0tlerir totopt  ivils0 2xrxr oudape mnvils)a2trur ;o0tptn ictld mDemu snu) eeomf3oa1oatrai i;s srtrxmpiudll  mnviltf rrr(r no4aptoiieiatfm em( o t0aeermo todfp rlu sls)trtmxrpoy1altemici sfs2rmump;u4aptomieiytfs ranvon(0teeoxo3ia1oa e ueil() 2xoxo3nudlptelfvtas) rta(mpoo4ape ioetys mDuluvp;u0aetrxrcty1lp e i sl(0trxmxopou4amtnlfetat aDumur no4altn feilt mDeau on(4teermr3tatoaDe i s s s2xoimpiydom  mivs (fsDua(r ;o4aeenmfcias mDrauvs t0tlxnio3tatlmtr nei (  2toxopoo4openmieia( artm(root4opxo i3tytlsDumumo;t)aexoxfciydla  lnei;s0s2xmxo3iy1optelfetlsfsrrrxmoou1aeeomi3tld mDemu s;u)aexnif tadlatrlnvo (  ruoxmpnydlmenlfei sfs2ta(  ou1aee  f3tatlm2uanms u)arxriociatoa rau o t trxrxm3iydome mfvtl( aDtru ooo0apx  i3iad s2rmnmonu0altomf3todfpt  ueol(0s2xmim no4oltnmncsl()srrrumpno1altoiieildlm2raump;t0trxriociadlptr u o;s teumirpoydlpt micsa() 2rmxr oo4texnioeilslm ra( s;(4altrio3iotfa  anvilt0 2trxr3oo4ol nliet ( sDrru pot1tptnmietld a rmu o;(4tlxnio oytomte nei (0 rum(o oydlme lfvt t srtr( ono1oexn iciatfm umnms (0artnxf3oatlpDr i sl()s2trxopiy4ll  lnet ( artm(  ot0oltomociytlm uanvp t0tleoio3oodoaDr u s ( trum(m nu4lltnmiesatfsrtmu p;u4apt mfeiadls umuvsnt4tetomf iodfp e ueo (  2xmxo oydamtn nvt (fa2tr(r ot1apxnioeiydlm ra(msnu0trtnxociydfptr ues ( srurxo3io4al e nes t a2rru  ;t4altn oetyd sDrmuvont4 exnmr3oa1oat lies t t2uo(o3oo1opeemnvslt srtmu ont0texoifcildfa ran s;(4tltrif3ty1fptr uvo;(0texm(m3oydap  liei ()sDuaurpnt1opxnmf3iydls2ea(vonu0alenmr totfp rau i ( s2xoxopnu4ol   neia() 2rrumo;u4opeomfetysfs rauvo;()artrxo iodlpD lnvolt  euoim3ny1op  lfvils  2ururpou0apxnio3ilsfm rl(vp u) lxnio3oo1oateli i;t0t2xmxm iy4oltnlfcsa(  rururonu4oexomoeiyt m uaump;t0tlerxo iytfmte u o;s  2xoxr3oo1am nmnvsls  2ur(  ;u4tpt  i3ilsla rauvs;u)tlxomociatoaDe u s;s s2toxo3no1opt livt tfarrax  nu4oexoifeilsfm2uau ont)trxrxf oatlaDrau o s sruoxm ou1lm   fciat)sDrm(ront0ale moeiyd m ulu s u4trerir oatfmD aieil( t2xr(o oydaltnlnvtls  rrr( pou0oltnio3iydlaDulnvs t4trtnxo ta1lpDrlivo;(0seuo(r3ny1aptemnei s aDrm( pno0oeen i3ildls2rmu ont)tlxnmrciodfmDrai s (0trxmimpnu1amtnmfes (faDra(r ;o4tpe moeiltfs elnvp u4trtnif3ootlaD lnvs;t0setrio iudap   fct ()s2tm(r ot1oexnmiciatlm2ulu snt)aetriociotfpt au o;(0 rtoxr3oo1amtelieias  2rmur ot4aeenmieiltlm2ul( o () lerxfcio1laD  n o;s0t2xrim3iydameemfesl( artrx ono0alen fciyt m2eanvp t0tetomr oy1op rau o s)s2um(opnudaleemfcil()sDraur oo0apxoio3ildlm2ra( p (4areoirctytfate u i;t)s2tm(r ny4olt mfvia(fs2tmxmpnu1alto f3iyt a uanvpn()tleoxo3tadoaDeau i;t0texrxr3oo1ll   ivt s artr( o;o4tetn f3iytfm rmnvp t4aeermf iytlaDr ivo;t)texmim3oodlpenmivsas)aDrr(  ;u4opxo ietadfaDua( s t0aetrxf3ia1oat  nvi;(  eurxr3iu4apen nvia()s2trx p;t1tpen o3ilslm2rlnvsnt0alxoifcoodfpte uvol() etm(m oo1lleelivtat aDuaurpoo4aeenmfciydfsDrln o u4tltoxo iy1fpt  uei t) ruo(rpny4opt lncias a2raxmooo1tetn i3tls m2ul(mp ()alerxfciytfptrluvs (0 2umio nydolee ieta(  Dumx pnt0tpe mfetlt s2eln s;u0tetnio3tadfpD lnes;s0sruoxm nu1om  micils) rrm(m ou4opt mieilt m em(mp;t4aetoxrcio1op eaivilt)seumxrpou4omeelnvsltf rum(mp;u0opxo ieild s2em( p t4alxrxo3ootfa   nvi t seto(m3nudomee ncsas)aDrmxm no4texomiciadla2rmump;t0 eerxo io1fa   neols0t2xoxr iy1lm n iei s s2tmxmpno1opt mfeiltfmDelu o (0texrif ty1oaDe ivi () 2uo(o3nu4alt lfeil(fsDumum oo4tptoiociytla um(msn(0trenir iadoatr ieo (0texo(m3oo1apt  fct t) rrmxmono4oetnmieilslm umnvon(0 rtrio3ootfpD ln o s0 rtoxrpnu1lptemics ( artrxrpot4aex  octls sDea(vsn(4 lxrio3iodfptr ies s)tetrxopoy4lp elieia(  Drmu ono1aptnmociat s2ul( s;t)trxomo oo1omD  n i t texmxm3nydam e fcs (fsDtmu onu4ale ii3tatls2elumpn() ltrmfcty1fmt ln i s)s2uo(m nu1lp   fei t  Dtrxm ;u0apeoiociaslaDrmuvo;(0 ltnxf tadfaDr i s;t0 rxo(r3iu4lm n ics s a2rmxmo;u0altomo3iyd aDra(mpnt0trerxo3oytfm raivsl( s2trio3nudlptnmnctatf 2taumono1tpx  o3iltlmDeaumpnu4 lxoxrciatop eauvils  2xmio iydlpeemiei sfa2rm(r oo1aee  oetlsfsDuau o u0trtoirciy1op ranvilt)t2xoxmpiu4amt  fctas a2rr(ront4tetnmieiyd s2raums ()artnxf iatomt lues s seuoir oudal n nvt ()arrru  no0oee io3tat s2rmnmsnt0trtnmocootlatran o;() euo(mpou1lltnmneiat)a2raumpou4aexn feiltfa2rauvs;t)aexomfcootopteai i;s0srurxm ou1am emfcia(fsrtaxmpou4ole mf3tlt aDrm(vsnt4trxoif iy1op   ieols  2xrio3oudam emivslt  rra(r oo1tlxomoetadfs eanvpnu4aexniocta1om rau il(0 etrxrpio4llte feslt sDta( pnt4apxn i3iat sDua(vp () lenxrctatop eaues s) 2xo(m3nu4al emfet ( srur(m ;u4ole ii3tatfa ra( p t0artrmf oadlaD ai i;( trur(m ny4omee nvtasfartmumo;o1tlx mo3ild m2em( o;t0 lxnmocoatlpD an s t  2xoxopiodap elivsl( srrmumpoo0oexnmocils aDra(vsnu0 exoxf todla elu s t) rurirpio1om  micsls srrm(ront4apx mociysfa2raumsnu0 etnmfciodfp eaivo t  euoxr oy4amt mictas)srtaurpot4tlx mo3tltla rmu s;(4aetnif oatfptranvi t0setoxo no1ap e nvs t  Drm(rp;t4apx  oeiadfaDumuvsnu4 exomoctodfp rlu i;t0teto(r nu1llenmnet ( srra(monu0optnmictlsfa ea( s ()artrxr oy1lmDrauei t)s2trxm iudom elncs sfsrtmxr nt0ole iiciytfsDranvp (0trtrif tatfatr n i;t) rumiopiu1llt lncia( aruaxr nu4apt ifeilsfs2ul(mpnt0aexoxr ootfmD lnvs;s  euo(opiy4alenlnes s)aDumu pnt1opt if3ild s2uln s t0tlxrir iydfm rlueo s  rumio3nudale  fesasfarumxmonu4oetnif3iadfm2ul( ont0tetoxo3io1fm e ueil( trxriopno4ame mneilt s2ra(m nt0aeenio3iltfs rau s u0trxrxr3oodfaDe i o t)sexoir oo1lpt  neiatfs2rr(  ;u1texn oeiyslsDulu on(4 rxrmf3oodlp eli ils0 rtoio ou4lle licsa()a2tax ooo0alt mo3iydls eanvo u0arxrmr tydlaDrli i;( srtrirpno4omt  nvia(  rum(  ou4alt if3ilt sDul(vo;t)tleoircty1fpDelu o () etrxo3oy4lmt lfvta(fs2taxmoot1apx  o3tlsfs2ranmpn()arerxf ia1faD  ies;()sexmxr3iu1llt  fvi t)sDumu  ou0oexoifctadfs2umu pnu0alenxr3tytfmtrau o s0sruoir3iodamtnlicia(  2raxrpoo0olx ifctysls raums u4trxnif tytfpDrlnvs;t0 2xrxmpny4apenmfvta( s2rm( ont0altnio3iat aDrau sn(4trxrxrciydlm elu o;(0t2umim3ou4lmtelict tfsDrm(r nt4aex  o3iydfaDumnvp;t4tlxoirctytfmteluvs;s) 2xrim nu4oltn icsa() 2rm(  no4opxoiictld s2el(ms;t)trxnir3io1fpD luvols seuoirpno4altn nvt s) 2taumo;t4teeniociat a elumo;(4teenir ootoa elivo;s)s2xr(mpoydlpe micsls)a2taxront0olxoio3iad a eauvo (4alxomr3oytlm e n sls) 2toiopou1ale lnvsls)srta(ronu4tex mf3ild sDul( o u) rxrxo iodopDeaues;t0sexm(r nu1om  licil()s2uru p;t4ape ioctys mDemnvp;t0 ltrxr oo1laDranes;t0seurxopiy1lm   feils aDumu o;t1aexn fctasfs2eluvs;(4 leoifcia1fpDrli ilt0t2xrxmpiydopeelictat)aDuau p;t1aeto ietlsfa uau o u0arxnxo3oa1oat li s;s0s2xmimpoo4omtnmfctl() rrrxmonu4teto i3tlsla emnvsn(4 lxrmf3iatfat  u i;t0t2xmxr3nydom  micil(fartrurp;o4aexnmietls m um( s t4treoio oa1fmteluei;s texo(m iudam n net (f rrmu o;u1tpe  iciys m rmnmon()trtrmrcta1om r uvs;s0 rxoxmpiydal emnvs t) rtm(mpou1tlt  i3ildfm rmu p;u4tleomf3oa1fpt  uesl()t2toxm oydol  mivta(  rraxr ;o1tltn fetatla rl( s;u0altoxociy1opte ies;s) euoio3iu1oltn fctasf Drm(rpou0tpxn i3ils m2uln s;u)altnif todlmD ln o ( s2uoxr3nydop   ncils)a2urumonu4oexoifetltfaDrmuvo (0aleomf tatfa r iei t s2urim oo4lptnlfei () Dtr( pno0tee  i3iydlsDuanmont4arermo3to1lptrlnvs;(  exr(opny1amen fvsat sDrrxronu0oeeoioeild s2eauvp () eerircoy1omteauei s) 2xr(m3oudomenmnvsls sDuaxm ;u1tlen f3tls mDeanmsn() lxnio iy1omtr u o;( t2xm(m3nodal elncs s s2ur(  ;t1olenmietad aDra( o (4tlenmo iydfat auei ()tetoir3ou4al nlncsa()sruaurpnt0olto feiydfm2raumo u) rtnmr oydlpDrli o;()srxrirpnu4lp emieslsfsruau p;o4oetniiciat a umu sn(4trtrmo3iotfmt au o;t)trxoxm nu1optnlivt t  2ua(r ou0tee  feildlmDumuvont)trerxr oodfpD  ivs;t0trxoim3iy4ape mnvsltf Dtmx pnt4apxniiciltfa2um(mpnu4texrxo3iotoaD lieo s)srxm(o3oy4om  mfet s a2urumono4aetomieiat sDrmnvs u0areoir to1oateaivolt srtoimpou1lmeelfct (fs2tmur ou0aexomictad a uau snu4alxrmr iy1oa elivs;s  2uoxo3ny1opee ieslt  rrmxr nt0oetnii3ias sDrlumo;t0 ltomf3todla e ieo s trurxmpiy1om   ncia(fartmurp;u4tpt  o3tld a eau s () rxnxr oatlmDrlneo;t)sexmim oydapt mnvil(  Dtr(root1tle  oeilsla2rm( ont4artrmoctadom   nei t0s2xo(r3io4lm n fcsltf 2urxrp;o0tpeo feiat s2ra(vs u4arerxr3tatfpt anvs;( s2ur(r3oudaleemivi t  Dtmumont4aleo ictls s uanvont)areoifciadoaD  u s;s0s2xo(r iydlm n nci ()aDumxront0tpe mf3iydlmDrmnvpn()tlxomo3todoate ivi;t0 eurimpiodll nmnviat  rtaxrooo4tetn f3tatla2eauvs (0trxnmo3iydfmteliei t) rtoxm nu4alt lnet t sDrmu o;o0apxn i3iyd m2ra( p u0 exnmr3oadfpt luei ()trxm(o3no1ope mfcsatf rtmu o;o4alto fciys a uln o;u0teerxocty1lpt anesl(0srtmio nodamenmivsat)sDrmxm ;t1aptniieilsls emumsnu4texrio3oodfmtrlu s;()teur(m oo4lp nmicsl( arua(  ou1alenmfcilsla eanmp t0 etomrctatlatrlnvs ( seumio3nu4llen fvtasf Dumxrpoo4tlto ociydfm2elnvo ()aetrxf3io1fat  iei s0seumxm3iu1llte nvta( srrmx pot0apeomfetld s elnms;()tetnircoatopDelivi;s) 2trxopnu1lmt mieiasf Drm(  no0aet  ieiydfm2rluvpnt4arerxo tatfmD  ieilt  2umirpny4lp  lfeil(f Dtr(  ;u4tlt mf3iltlm ua(msn(0aexoxfcoadlmtr u ilt)setmxo3iy1apeemnvtatfsrta(  no0teto i3iyt a elnvp;()alxnio oo1faDrluesl( seum(r iydllenlfvsas aDuaxrp;t1opx mi3tydfm2rl(vs t0 lxrir totoaDeli s s trxmxrpiodalt  iciltfa2raxront0tpt mfciys s2um( o t4tltnir oydfm e i i;s trtrxr iu4lpe mneiltfsrrau  oo1aeen iciltlm ranmp;(0tlenio ty1oat auvols)sexoiopnudaptelietatfarumx pno1aptn oeiydfs rmuvo;t)alxnxf io1la raivi;s0 etrir3nu1lm e ivilt)artmxmono4aeto i3ils mDua(vonu4treoxo3oodopD  u s;s t2trxopnu1lmtn ici t srtaxr oo0apeomiciatls2ean p;u)aexnif iadfpt an i s0setmio iudap emncs t arururp;t0apeoii3tls mDrl(vpnt4 rxnxrcoo1fmD aieil() exrxopnydlmtnlnctlsf 2rmu pou0olx ii3iytla umnms;t) lxrir3iatfmte ies;t  rxmio3oy4amenmfvi s srraxmpot1tltnmocilsfm2ulu s u0tetnircia1om rai sls)s2urxrpnu1aleemnet s s2raxm nu4alt mfeilt sDrl(mp;u0 rermrcty1oa r i ol(0 2urxo3no4olt lfeia()aDtrxr ;u1tee mfetls aDeauvo;u) rtnxfcta1latr ivo s)sexo(o no4lleelfet tfartaum ;o1optnif3iatlm2umn s;u0 leomf tadfa elivo s0 2umirpnudop  mncs t arum(r ;u0aee iieiat m2rmuvonu4 renmf tatlmteau o;s  rumxr ny4lpt  feiltf 2rrxm nu4tpxomoeiadfa rauvp;u4tetnxf iydomD ai i t s2toir nu4op nmnesat aDuaum ;o0tpxoioctldls rauvo (4tlxriociodfmD aivs s trxmiopiu1lle  nvsl(  rurx p;t1olt mietadfm2rmuvp;(4alxrxr ta1lpDranesls t2toxo3oudapte nvt (  2rmx  nu0tpx  i3iltla elu s;t0texrmf3oadla  auvs t0srurxrpiudoptnmiei (f Drmurp;t1apxn f3ildfsDrmuvo (4 etrmfcia1fpt aues s)truoxm3iy4lltemfet tfsrua(rpno0aexo octlsla eaumpnt)tlxrmfciadlmDr ueilt0 2umxm oy4lm  mneiat) rtau p;t0teeo o3tyslm2uluvs;(0tlxrxf ty1latrlu ol(0trxrirpno4ap nmnvi s)srurum no1teenmf3iltlmDeluvo (4 rtrif3tadlmDelieo;( t2toxr3oo4lme lnvsas) ruaxroot4olxomfetldlm um(vo t)artrmfctatomtrln ilt trxo(o3ny1oltelfet (f rraxrpoo1apenmo3tasfmDra( o;u0trxrxocty1laDrli olt)s2tmxrpoydamenlnciat)a2rr( pno0tle  ietatfa2umuvo t4 leomf ta1fmtrluesl()t2umir iydom  lnvsa()arrr(mpnt4tptnif3iyd aDel(ms (4 etrio3iydfm ran slt)s2tmxmpno1al nlfeiat artm(r ou1olxomocild a2rlnmo u0alxomo iy1fptrauvolt s2tm(o3oodalee nvtas arua( pou1apto ocildlm2em(msn()trtrif3oo1fm rlnei;(0seurirpiydlpeemncilt) ruru onu1optnifctys mDea( s;(0 rtoxr tytlmt  ies s s2ur(o3no4lmt  fctlt aDua(moou1tetoio3iytfa2emu pn(4 eenmo iytlp eai s;t trxrir oudlltemfciltfaruru ono4apeniiciadlaDran o;(4aeerxrciodfaDelu o;t)s2ur(o3iudlm nmnvt (f Dtaxronu0olx mfetas a2um(vpn()tetoif iodoaDeauvs t)setrir3oo4lp  micsas)sDumu pot1opxo ocilsfm2emuvp;(4 ltnio3oadfa  anvs;()trtoim3iydlp nmfvia(fs2rr(mpnt4ape mfeiys m2rmuvpnt0tlxnmo3ty1fmt lu i (  etriopoydllteliesls arumx  nt1tltnmociasfmDraums u)trtomf oytfa e iesl(0setr(rpnu4opt lncta( srrmx o;t4alenmoeiaslmDel(mpnt)arenmo3oatfaD livi;( t2toxm3oodlltnlnvi ( a2ua(r ;t0teenmi3iadla2uanms ()tetoxo3iytlat aues () eurim3iudapeelictls)sDuau  ;u0opxomfcildla elnvp;() rxrio ootoatrau i t0 rtoxm no1lpe lietls srumx pnu4tex mo3ilt a rm(von(4arxnmo3ta1fmDrlu ol() etm(m3oudom   ivs s sDuauro;t0apxomfctaslm2rl( p;(0alenio oadlmD aivi t0 eto(o3iu4op  lnci s aDrr( p;o4olenmf3tltfmDrlu p;t) reoif todlatr u ol(0trxm(o3nodap n ncsatfs2raxr ;o1tpeoifetytla2ra(mp;u0treniociatoaDelnvsls t2ur(o3oo1lpenmfes t  2trx  ot1tpx mi3iasfm2rm(vo t4 reoir3ia1lm elnvo;s  rtoxo oo4lmen iei tf 2taxm oo1oeenmfeiyd m2elnmpnt4altoxo iydomt  ueo;s)teumio3oo4opeelfviasfaDtaxmp;o0oet mf3tld aDrlu sn(4tleoxfciotoatrliei;t srur(rpny1apeelnct tf rra(r ou1oex mfeiatlm2umnmp (0 ltrmf iy1opD aivil()tetm(mpnu4ope mfcsas) rtmu  nt1aexoii3tlt sDum( p;t) rtomf3iatlmt lnvi (  2um(r nudlltemfci sfarra( p;t1tex mocilt aDemnvs t) eermociy1lpDrau s;s) rurxr3iu1op  micil()a2raurpnu1oetn f3iydlmDrln p (0alxnxo3oydfmDeanvs (  exr(r3oo4al nlieiltf 2rr( o;u0tetomocias m2elnvo u0 eenxo3iodlatr iei;(0t2trirpiydalee nct t)sDumu poo4apxn fetadla2rlnmo u0tltnmr3iadla e ieo s0t2tr(m ou1lmt lncs (f Duax onu1tptoif3ilslmDeauvp;(4 lermo tatop   uvs s0s2urxmpoy4amtnlnvils arua(rpot1tptn o3ild m2uanmsnu0 rtnmfciodoat aivs t  2um(r nydllee ictas) 2umurpot0tpeo i3ilsfs2um(mp t)artrxr3iytoat  nei;t truoxrpno4omeemfct t)aDtmu p;t1tlxnmfetlt sDua( pn(4 renxo iatlpt aueolt s2umxo3no4opeemiviatfaDrru ono4apx mfetls mDeau s;u)tltnmo oa1opDraivs;t  rxmir oudlmtemnctas arrr(mpot0alxnioetysfm2eluvo;u) ltoif oy1fm  lues () rtr(o nu1om e fvs s)aDtaxr ot0olx mi3tatfa elums;(0aeeoif oo1lmtr ieo;s) rtrir nu1om  lfcia(fsDumxm ou0oee ioctatlmDeauvp ()trtnif3iydfa   n o;()s2xm(opoo1lptnlivsat srrmx  no1opeo ocilsla rm( s (4arxoir iadoatran o;t)s2um(o iudope  ieslt) rrrumo;o1tlen oeiys mDrmnvs u4trtoio io1oaDrlu olt0t2tmiopiy1olt mnvsl(  Drm( oou4tpeoif3ild a2ra(mo;(0trenmoctytlm   nes;s t2toirpnodopee fctl( arurur nu1texo oeiyt m um(vp t)texrmocio1lpteanei (0srto(m oudal  mnvsasfa2ua(mpnt4oexoioctysfa2rlnms;t4aleoir iatfmDe ivolt  euoim oy4olenmivi tfarra(rooo1aeeo fcilsla2rauvpn(4texnio3ta1optr ivil(0s2uo(rpio4om  mfvi sfs2um(  nu0opt  ieilsla2uaumo (0texomr iydfpDran ils setm(m oy1ll nmfesls  Drr(r ot1tlxn i3tas m2rmnmo;()arxrxr oy1op rlnes ( tetoiopiodop nmieilt  rra(m ;u4aeenmf3ias aDumu o t4 exnmf oatfpDrlnvilt0 2urxo nu4lp nmies (fs2trxmonu4tlx ioeiatfsDrlnmo;u)altnmo to1lm  an s;t0t2xo(r3oy1om elfvslsfs2trxrpnt4tptn ociyd m ul(ms u4aeermr io1lm eaivil()t2uoirpny4am elnci sfa2uru pot0alxnifcildfs elnvo;t4 rxrxf3iytopt an slt0t2tm(m ou4lmenmfcias arur(rpou0aee  iciytfaDra(vo u) eerxocty1opDr u sls)tetmxo3ou1alt lics tfaDtmxr ;o0olxn ictld a2ea( on(0aexomfctydomtrli ols0 rxmim nu4lm elncia()sDuaur ;o0tleoif3tls mDrlums;u0arenxr3tytopte u ilt)seto(m3nudolen ietlt srrmxr oo0apt ioetlt sDul(vp;u0aeeoirciodla eaieol(0 2xmir3ny1olenlfesas) Dua(ro;o0tle  oetysfm emumont0tlxomf oatopD lieils)t2toxm3iu1ap nmfvt (f rrau ooo4tlto i3iydfaDeauvsn(4aetrxrcoodlp elueol()s2tr(mpiy1lltelncsat s2taxr ou1apeo ocildfs uluvsn(0arxnif iadom  li s;( setoimpnu1lle lfciat  Drmxm no0ole ii3iydlmDrm(ms;u0tleoxf3io1lpt au olt) rxrxo3iydalt  ict (  rtmuroot0oleo ociatfs2rmump (4aetoxf oatoate i i;()t2um(mpno4ape lncils)srtaxm oo1olx moeiatfmDrauvs (0trtrif3iatfm eaues (0 exoir ou1lmenmncs t aDra(r ;o4aeen iciad s el(ms;t0altnxfciy1oaDeauvol(  rxmim nodopenlnvt tf rtmump;o4tleo f3tlsfsDeanmo;u) etnxf3tytfptrlues;t  2trxm3ny4ap nmnvta( aDuaurpot4texn ietyslm el(vo;u4trenmocty1fpDelnvs (  rxr(m3ny1amt lfcslsf rrmum ot1tlxn ociyt sDul(ms u0trerir3iatfat ai ols0 etmio3io1lptn nvtas)arur(mpou4alenmo3tyslmDrmu o t0 ltrif todoptraueslt t2toxmpoo1amte ietat) rrm(  ;u4tleomfeiltfmDea(mo t0areoirctadlmDeaneol() etmiopou4llteliei s)sDtr(  nu0aeeomictas mDeanvp t4 eeomrciatom ranvilt setrxm3no4ale livi sfsrrrx  ;o4apeoifciasfs2eauvs u)tltnifcoytomt  uei;s s2toxm iy4olt lnesa( sDrr(roou0aee io3iys aDum(mo (0 rtnmo iytfaD aueol()sexmio3iu1omtelfcsat s2rax  nu4ope moeiytlsDrmn onu0texrmrcia1lmD lu ilt s2ur(r3iy1omenmnesls)s2ta(ro;u0apto feiadfsDul( p t4tetoirctadfpDrli ilt0s2toim no4lp nlics t)srurum ot1alenmfetyt s2uln o;u0alxrmocoadfm r i slt) rtrio iydamenlncsltf Dtrumpou0optomo3iyslaDrl( pnu)aetnxfciadopDeaneolt0 exmxopoydlp n ictlsf 2rrxm ot4tlen oeiatfa2rm(vonu0tetrxocoatop r nvs;( texr(o3oo1oltemivsl()srrrxmpoo1opx mfcils s eanmo u4 etrmf tatomt aieslt0teumiopiudoptemicslsf rumx  ou4tptoifctytlm ul( pnu4aexrmf3oy1fmDrlneil()seuo(rpno4lpenmiesa(fsDraxmonu4apxo fctasfa2ea( o (0tlxoio3todoa eaivi;t)tetoio iydolen fcta( aDtaxro;t1tleoifciltls ulumpnt)tltrxrcoytla elieo;t0setr(mpny1ll n fctasfartr(mp;o0apxnmoeiyt s el(ms t0 exoxr oo1fpt  i o s)srtmxm3oy1apeelictlt a2ta(moou0oltnifeiysfm rlnmp;(0arxomrcta1optrau s;()t2uoxm3iy1omt mnetas a2tmx  ;u1tpx  fciydlaDelnvpnu4 etnxr3oydlpDeaieo;()srxo(o oy1lleelivil(faDtrurpot4aptn o3iytfm emumsnu) ltoxocio1fmDranvo () ruoxmpoo4lp nlfesltfsDumur nu1tlx  i3ias m uluvs (4tlerircto1op eli o;()seuoiopio4lp elfctasf ruaxr ;t1oee mietyd mDrmnms u0 leomr3iy1omtrli sl()setmim3io4lpe mfvs (f rtmu  ;o4oexoioeias mDrl(mon()tlxnmf tydfmt  uvi;( teur(m oy4ale mncs ()s2trx o;t0tpx mociyt mDemu snt0treoio3oa1fm r i i;( srxoxrpiy4op  micils  2rau  nt0tpx ifeilt sDrlnmsn(4texoxrcoydlmte ivs;() eto(m3nu1om   ivta( s2rau pou4aexnioeiatfmDeanmp;t0 rxriocoa1omDr nei (  ruoirpio1altnmnvias  2urxrp;t4optnmo3ias a2um(vonu0arxomo ty1lpteaneilt)t2xoirpiy1aptemivt (  rurxrpoo0aeeomoctadlm2eauvo u4aeerxo iotlmDe neo;(  2toxm3ou1lm  lici tfartr(  nt4tlx  o3ilsfs2ua( snu4alerir io1oaD  nvi;(0teuoxmpiudolenmiei sfarumxroou4tlxomo3iasfmDumnms;u4 ltrmr3iodop rlnvo;()s2urxopoo4lleemietas s2taxrpoo0oeen i3iydlsDum(vo (0aetomo iadfpt li olt0t2ur(m iudalenlnvil( arrrxr oo1alenii3tatfa2rmu p;u)altnir oa1lm   uei t0s2tm(r oodaltelnesasf 2rmu pnt4apto ieiatlaDelnms (4 rxnmrcoo1op  ln sl()texoxmpoo4altnlieilt)sruaxmoou0tltoiictlt mDelu ont4aeenirciotfaD  i s ( s2xrirpiy4aleelicsltfs2umx oou0tet ifeiyt mDrlu o u4alxrxf3oy1lp rau il(0seumir3nodap   fesasfsrtruront1apt mo3iytla rm(vp;()aetnmo oodlmD  n s t)truoio nu1amt  nvt tfaDurxront0olenmi3iadls umuvp;(0texoxf3io1oaDe nvo t  2uoxr3io1om n ictl(  Dtaxmp;u0tpeo octas m2rl( s (0 lxoif3ia1fmDelueolt0 exoir ou4oltnmiet sfsrur(r ;o0tpe mietydfm2umnmp;t4 etrifciy1lp rlieil(  exo(m3iu4ale mfeslt)aDrrum ;o1opx  i3ils a umnmo (4trxnmo totlpt anvi (0srtmio iy1opeemict (f 2rru p;t0alx  fciltlm2rlu o t0 etoxfciy1la e n slt sruo(m3nydlptemnvilt srta(r nt4oeeoif3tatfa eau ont) rxoio iotlpte n s ()setoxopoudam elnci t artmumo;u1olt io3tatfm2el(mo u0tlenxocty1laD  ivo t)trtrxmpiu4ale liet s)aDtr( pnu0oexomictysfa ua( sn()altnif3iodopt lu i ( srurxopiu4lltelfvia(  2trxrp;o0teeoio3tyslm2rau o u)aeeomocoa1la raivilt) rxoiopio1lp  lfei s)s2ta(r ;o1olx moeiad mDem( p () rtrio oa1lmDeau olt) rtrio oydope  fcsasfsDtm(m ot0tet  ocilslm umu s;u4alerir3iy1lpD anes ()s2xoim3nydomen iciat  2taxmpou0oex  ociydfm2ran snt) rxoxociodfmDrli s (0srxmxo iydlp  miviltfsrtm( pou0apeo i3iytfm ra( p t)texrxo ia1la rlneolt)srxmxr iy4lp  lietl( a2tr(ronu1tetomociat mDumn p;u0 eermr3iodfatranvil(0s2xrxm3oodlp   fci (f 2ta( pno4opeo i3iyd s eauvo t0alxoio oodomDeln slt  euo(mpiu4ame  ivilsf Drmx ono1oet mfetas mDua(mp u)arenmo iadop eli o;t) 2xrir3iydapenmnet s)s2taxmpno1tpx mo3tlt s2ul( o;(0aexnio ty1fpDrauvs;t) rxrxr3nudap elivias  rtrxmo;t4olt iictytfm2um(vs t0alxnmocoa1lm  luvs (0 ruoir nu4lltemfcsatfa2tmumonu4olx mfciydlaDulnmsnu0tleoxr oo1la elneils s2xoxr3iu4lm n ncs tfsrtmxm ou0olx  f3iyt s2emu snt)arxrxr3oodla  anes t  rtm(o iudol   fvt (fs2tmxm no0oex moeilt aDuauvo u4 ltrmr3ta1oaD  i sl(0sruoio ou4altelivi s aDtau  nt0opt  ictadla2ra(ms;u)alxomrcto1opDelnei;s)srxmxm3iodll  mfvias)s2ra(  ou0oltomi3ias a um(mpnt4alxrmf iydfatrli ol(  rumir oo4ll   nes tfsrrmu oou0ope  octadfm2ea( ont0trtrmrcto1fptrlnvsl(0s2um(r oy4op n neil()srur( pot0tpenifetltfsDua(vs;() eermo oatom rauvo;s)s2tmxo ou1optemnetlsfartm(r no0alxoif3iydfs rl(vo;u4tlxoif3ia1oatr u i (0srxrio3iy1lpenmici ( s2tru o;t4tet ifeildlm umuvont4altnxr3oo1fp e uvi;( teuriopno4ll nmfvsls arurumoou4olxo feils aDrmn o;t0altrif tadoaDrlieolt)srxmir oo4opee iesl()aDtr(mpoo1oexo feiltlm uanmo;u) rtoxr ia1lm eauvils0 eurxmpoudomee fvtat) 2taxmoou4tlx ii3tat s ra( p;u) rxoxfcootfatranei;s0 rxmxo ny1oltnmiciasf 2tm( p;u1tptoifctadls ra( s;u0artrmf oy1oate ivols)t2uoxm3no4om nmies t artr( pnt1oetn fctytfa2uluvp u0 eenxr totomD  nei;s t2umio iu1alt  fci s sDumum ot0aex iicils a ra( p t)altnif iotfm eauvo s)setmxr nydal nmneia(faDrr( onu0olt mi3tydfa umnvo u4treoif to1fp eanes t)s2umxm3oodam n fei ()sDraur ;o0opt mo3tydlaDrmump;(4 rxrmo iotoa r nvo;s0 etoim io1omte nct tfsDrm(rp;o0tleo fciydfa eau s;t) exomf3io1omt lnvslt) 2xoxrpno4opt  ivtls)a2tmxr ou0altomf3iadfmDem(von(0alxnmo3totfa eai olt  2uoiopnudol n fct ()arumx onu1aptomictltlsDulnvo ()trtrir iy1op rlieo ()t2xm(opou4omtemietatfsrraxro;o4aeen oeiatlaDrmn o;t0trxoxociy1opDrlnvo;s0 2umxm nudoltn fet t srraump;t1tex  i3tyd a rm( p t) etnxrctydomDe u ol()t2umxm3nodllt mivi s)aDum(rp;o0tetnifctlt aDumu p;u)aleomo tatop rlueil(0t2tr(o3iy1lptn ivil( sDtaxrono0alto ietatfs2rau pnu4 eerxr iatoa eluvi;s trxr(mpiodoltnlnvslt)sDuru poo1tpto fcias m2el(vp;t4tltnxo ty1fpDe ivol(0seumir oy1llen ieilt  rtr(m no1oleniociyt mDul(monu)tlxnircoydomDeluvs;t) exrio iudol n ietlsfs2rmxr no0apeoii3tysfs rmnmp;u4tlenif3tytfatrauvi s)t2umio oy4al nlnct ()arurxr ;o4ale mo3iad s eauvp u4altoir oo1fatr nes t) 2tr(o iudolee fvta( srraur ot0aexniociytlmDua(vp;u0artnir oatfp eln sls t2toxr ou1omeemivsa()a2tr(rpoo4tpe ifciatlmDuanmont4aetrif tatoa r neo;s srxriopiydol n ivtlt s2tax pnt1oltoiieiadfm uluvs t0tlxrxf ty1lm  anvi;t)teurimpiydomeemnetlt  2rmxr nu0tleoii3iatfm2rauvp;u4trxrxf3tydfmt lnvi s setm(m no1ll nmfvsl(  rraum oo0oetnif3tyt sDrmnvs;()trxoxoctodoatrluvi (0teumir iy4ll   ivsl(f rumx ooo4alxn f3iytlm ean s (4arxomr3iodlmDeauei (0seurxr iy4apee iet s s2umx o;o1oetnioeiyt m umn s ()alenmocio1lpte n olt)setr(m3ou4oltnlfcsls  Draumpnt0tlxoifeiaslsDua(msnu0texrmociydlmtrlnvi;t t2um(m oy4lle micil(f rrm(m nt1tpxnmi3iadfm2rlnmont0 exoir iodlm e iei;t0srtm(r ou1optnlivtls) rrrxm ;t0aex  fctltla2eanvpn(0aetoxocoa1lp eluvi s) 2um(rpio4omtnmncs s a2um(r no4tptnmfciatla2emumo u4trtnxr3oadfmte nvolt)trto(o3ny4lme lfes ( sDum(m nt0apeoifctlsfm emnvont0altrmo todlpD an o;t)teuoimpio4om n nvi () Dtru  ot4aeenii3iadls emn p t4alerxfcoo1oaDrlneslt)t2xrxr3ny1al  lnvtl( artmuront1oltn fetadla2rm( s;(4tleoxrciy1fm  ln s;t0t2xoio3nu1lmt mfvs (fsrtmu pno0tlx iieildfsDulums () lermfcootomDr n o t0seumim3iydlm emnes tfsrtr( pnt0oet mo3iatfm rlnmpnt4aetrxo3oydfatrauvslt trxo(r3ou1lm elfct sfsrrr(r nt0opeo feiytfaDea(mont4 eenxfcoadla  ai s;()trxoio nodale mnvia( arta( onu4olxnifciytfs rlu snt)teermoctadfm  an i;()setr(r ny4lleelivs t srrru o;u1alxo fciadls2raums u4tetnmrcoatopte uvi;t teurio3ou4altemneta( s2tm( ono1altoio3iatfm2ran snu4trxrio3ta1laDelies ()t2uoxmpiu1om n nesa(  Durur nu1tpxoiietldls2em(vo;u4artoxr totomD  u ols0s2uoir iodope lnvtltfsrurum ;o4apeo i3iltla um(mpnu4tlerxfcia1fpDeau i;s)s2xoxopiu4ap emfeia(  rurx o;t0tltoiicias m2em(mo t4trtrxr io1lpt  ieo;t  2xoxr iy1am n netls srum(m ot1opxomociydls ulumpnu0arxrmr3iatom elueo;t0 2trxr iy1op nmietlsf 2raum oo1tetn oeilt a2rmnvp;t)alxoio3oodlpt luei;s sexr(r iu4omeemnvsa()sDtr(m ou0aex moeiad m emnms u4 exrmrctydomtr uei;s)texriopoy4ol nmncslsfartrumpou0tptomfeiytla2ulu pnu4 eerir tadfm r ies ( teurxrpno4omte feta( arrrxm ou4olxo o3taslmDra(mo u0 eeoxf ty1lmDe u i s seur(m3iy1apeemict t)sDuaxrpnt1aexo o3tadla2ra(vo;u0trxnxr tatopDeaivil(0texmxrpio4opt  netl( s2ra(m nt1olxnmoetatlm ranmp t)aeeoxr to1fa  li o;s  2xo(rpiodal   feils srrmxro;u1optn ietat mDemn p (0alerxocia1lptrauvi;( s2triopno1apeelfctls)sDra(mo;o0optomiciat s raumonu4tlenif3tydfpDelneils0s2ur(r3ou4lp   ies (  rum(  oo4tpx  octad m emnmsn(0texoir3oatopD  ueo;(0tetrirpiy1alen fetlt artrumo;u1ale  icild sDul(vp t)aexomf3iadlmtrauei;t)tetm(mpoo1amee neilt  2ua(rono0oex ioeiys aDea( s u)alxnxo3iytfpDrau i s trto(mpiy1lmenlfvt () 2umx  oo0texnii3iysfa2el( p u0altrmr3iydfm raneo;s)setmirpio1alt  fei () rumx  ou1aexnio3ils s2uaumonu4treoir3iy1latraneo (0 rumxo oodole mfvtat  Duaxmono0apx ifctasfm el( snu4 rtnif ta1faDe uvils  etoim iodomee ivtasfaDua( p;o4tleoiietltfmDeau pn() lxoxr3oydopte uvil(  rtoxopnudome  neiatfs2tau oot4alt  f3iatls uau on(0trtomf3ty1laDrln i t0seuoiopoudapt  nct sfsDtrxm ;o0olenmf3iytlm2ul(mp;t0alxnxrctodfaDeln i ( texmir oy4lp elnetls)a2uaxm ;o0altnii3tat a2emn pn(4tlenmocoatlaD auvils trxmxm3iy1ll elicias  rtaxrpno4aptnmoeilslaDemn p (0altnir ta1omD  nei;()setmxr3no1ol n nvilt  rtaxrpnt1oltnio3iyt a2ul(mp t0artrmf ootfpDelieo;s)t2umio nu4lptemivt s)s2umur no1texoioeiyt m2rmu s;(0aleomr3oodfm r ies;s) rurir iu1al n fctls) 2ur( o;o1alxnmo3iyt m ea(vsnt4alerir oatfp eanvo;s)texmxrpnudlp emfvsatfs2uaur ou1altn ociys m2elnms u4teenifciydfmte ivslt t2uoxr3oodlpe mieia(fa2tru o;o1tlt  ictad a rln s;u0trtrxr3ia1lmt lnvols)sexrxr3oy1ap e ictls)srrmum ;u1aexnmfetyd m2rluvo;(0aetrifcoydla ranes;t truoir3nydolte feil(f 2um(r ou0tlx if3tldfa2ua(mo u0 eenxr oo1fatr i sls)teto(m ou1amtnmfcil(fsrtr(moot4apt  oeilslaDel(vp;t4 rtoir3ta1fpDrluei;t)trur(opiydomtn fvsa(faDrrxmont4tle mocild s uaumo;u0altniociodoaDeaivo;(0 eurxo iu4ol   fvi s)sDuau p;o0aeenii3tasfm2rmnmon()alxnxfciatfpDeanei;t)t2urim3oydal e nctasf Drmu o;t4oltoiieilsfaDrmnvo (4altomr3iatop rlueo;t0trurxr no1lmtnmietatfsDrr(rp;o4tpeniociysfm2rmnvo u)artnmf3totoa eli s t0 2trxo oudom  mfctlt) rta( o;t0optomociydfm2elnms ()trtriocoodoa  anvs;s)sruo(o iodalt  ictl(f rumxm no1oexomfeils s ranmp ()aexomf3oo1opt  nes t0 rtoirpoo1olt  feil()s2rr(mp;u0tet moeiadla uaums (4 rtnxf3iadlaD ln sl() 2tmxopoydame mictl( sDrr(moot4apxoiietlt a rmums t) lenxo3ty1fa r ues () 2uo(opno1om nmnci (fsrtmxrpoo1apeoifeiasfm2elu p;t0artnirciodlpt aivs;t0 2xoirpiy1lpen icsl(fa2umumoot0tex ioetadlaDuln p;t) etoxf3ootop  aueo;s srurxo3oydape mfeta(  2urxmpno4aee mfeiyt mDrl( o;t0trxoxocoytfm ranvs ()s2xmxrpoo4ol  micilsfa2rmxro;t4oet ii3iyslsDean o u) lxnifctodom elnvslt)srxoxrpno1altn ivtlt)aDrr(mont4tee mfeilt s2umu pnt)tetnmr tytfp rli slt setoiopny4lpe lfeia(  rra(r ;t0tpeo ieiad sDelumsnu0 rxrmocia1oate nvs;t  eurxrpoudap e iet sfs2rm(mp;u1aetomoetadlm2ul(mont)tlerxociytlp r i s s  eum(opiy4llte fvsa( aDua(ro;t1tleo ieiad s uln o u0aexnio3ta1om rai sls  eum(mpnodapee net ()a2um( oot4alxomf3iltfa umnvo;t0aleomo tadopDelivo (0 eumimpoodolenmfviatfa2tau pot1apx  f3iys sDulumsnt0aetomrcia1optrln o t)seumiopiy1apeelnes t  2ur(ront0tet  i3iytfs2umn o;u0 etnxfctydlat an sl(0 2xr(rpnu1om  micilt sDrrum ou0tle mf3iydlm2uluvpn(4tetrio iatfaDr i s t s2urxopnudlm  mfci t)s2urxro;u0apxnifetls a2umnms;(0texrmf3ty1op e uvo (0tetmirpiu4lm e nvsa() Drax oou4tpx  f3iyd mDulnvs t0 rtomr3tadfptrluesl()setmir oudom  livs s  2taxmp;t4tlt mf3iyd a rl(mo t4aeeomr3tytopD aivi;s0s2xoir io4opeelfesl(fsrurxr oo0oexnii3iasfm2umump (4aleoif3oo1lmD  ivs s0texoir3ny1lpeemfetls a2taxm ;o1ope ioetld s2rmumsn(0tltrif3tytfaDrlneo;t)trxoxr iu1llen nct s s2uaumpnt0oee ifciysls rmnms;t)tetrio iadlate neo;t0t2tm(o nodlmtnmietl()a2umxrpno1altnif3iad a2eauvsnu4alxrmocio1lpDe neilt0 rto(o3iu1amt mfcils s2ur(rp;u4aet mi3ils m2ranvs t) lenirciadfaD  nvs s0tetmiopnu1amt  iet s) rrrxr ;u0apt iieiltls2um(msnu4tetnmo3oadoa   i s;t0 2uoim3oo4al e nctat a2umuro;u0ope ifeiadlsDrau ont)teenir3todop elies;s) eumxo3oo4omtnmiet (fa2tau  ;o4tlxoiieiysfs2umnmsnt0altrmo3iydlmtrlivsl(  2xoio3nodom  miesa(  rrruro;u0tpx mieiatfs uluvs;u)tltnioctodopte uvol( srumir3nodopt mneta(fsDrm(m nu4tpe  iciys mDumumo;(4alenxfctatfa  lueol( t2umiopny1optemncta(  2rrumo;t1optoii3iaslm2el( pnt4tetoio3oydomtr ies;s srtmim3ou4lp nmfetls)a2um(rpou1alen fciys a eanmonu)arxoxo oo1omDeaivo t) 2umirpny4optnlnct s sDurxmoou1tee mo3ild m elnmp;u) etrifcoatlmtrlneo;t trxm(r iudllt mivtas)sDraumpot4tee if3iltfs rln sn(0trtoifctytfateli ilt)trtmir3oy4optn icsl() rtax  nt4oeenmo3ildls um(mp u) exnir3oo1fmD lieo;t0teumxr3no4lmtemfvslsfsDururpoo1tpenifetadla rmu o;(4altnxr iy1fpDean sls trumir nu4ol n ivs s)srumumoou0tetnmociytfa2elnmp;(4trenmocty1fp elnvi;(  rxrxm oo1altelicslt)aDuaxr nu1oleomi3iysla2ean p;(0 reoxo3iydfm   nei () exmxr oudaptelnciasf rtmum ot4tee mo3iltfs el(vsn(4 lxomr io1op eaies;t s2umxopnudomenmfctl()sDrm(rpou4oleo o3iytls rmu onu4 reomo io1lmD lu s t  2xrxr3ou4ap e fvtat)s2tmumpnt4ale iiciyd a rm(vsnu0arxnmo ta1omtrau i;( s2uo(r nu4ll e fcs tfs2rrxmpnt4tptoiociadfsDeln o u4 lerxf ootfmt  i slt teuoxo3iu4ll nmicsl( aDumxrpou1aeeomi3tadla rauvsn(4 lenxfctadomDraivo;s  2urim iy4al e ietatfsrrruroot0tlxomocilsfa2ul(ms;t4 exnxo iatop  luvs;s0trxrim iu1omt micta()a2um(  ot1teenmf3iadfmDrm(vsnt)tlenmf3tatop  lneil( trumxmpnodapenlieslt s2tau ono1tlxn f3ilslsDum( snt4 leomr3totlmtrlivols) euoxrpoydll elfct t) 2umx  ;u4tle  oeiydfaDumuvp;(4arxrir3iydfp  lueolt0tetmxmpoo4ale  iesas aDraxrono4oexnifctad mDeanvp;(0 etnmfctadfpD an o ( t2xo(m oudom  lfvt s)aDuau  ot1optnioeildfs rlums t0tetnmf3oadfa e ueo (  rtmxopoudaltemiviasfsDrrur ot1oleoii3tatfsDumumo;u)aexoif to1oa rlnvi ()t2um(opiy4lptemivsatf Dum( p;u1oltoifeiydla uan s u)tlerxrciotfaD  ueols)trxoxm3ou1altemici t)a2umumo;u1opx  o3iadfm eaump;(0 eeoif oydlaD aueol()trxmxopoo4llee nvia(fa2ua( p;o4oltomoctyslmDeanvs;t0trxrxocoydom  anvs;t trxoxm3ny4altemivtas)sDtm(roou1tpxoii3tad mDrmuvsnt4 exoxo3tadomDeluei s s2xrio3ou1ope  ncil(fsrur(moou4tet io3iyd s elump () eerxrctytfpteanvs ()t2xmimpnudopt liesltfsrrmxroot1ape  fcildfs2em( ont0 exrmr oytoat aiei t  exrim oy4opt micia(faDta(mo;t0tpe mociysfa rau o u)trtrxo3iytfm eai i;s  rtrirpio1ome lnetl( s2um(rpno0tee  oeiytfs2uln s;() lxrxrciadfpD  iesls teurxmpno1optn fvi s  rur(  nu4open oeildlsDua( sn(0 lerxf iydfpt  uesls srxr(r3io1omtemivilsf 2urxmpnt4tltoiieiytls ran p u)tltnxrciatop r nvilt tetr(r3iydlpe mfctls)a2urump;o4tlxnmietytfs elu snt4 exoxr oadomDrln o;()t2xoir3iy4ol  mnci s sDumx p;t0tle  fciydlm el(vo t) exnmocoatoa  luei;s t2uoxo iy1olt mnvi s a2tr(mpou4olxo fetls sDrmnmpn(0alxnio oodfpDelnvo s) ruo(r oudoltnlfes s srtm( oot0tetomf3ils aDeaump;u4 rtnmr3iy1laDeanvs t0setmxrpoy4optnlici t)a2um( pou1opx mietas s2umu pnt)arenmr oy1opDean i;(0 exm(o3nu1ol nmivi ()a2trumpno1alen f3tadlaDeau o t0 exrxf ta1oat  uvo;()truoim no1opeemfvt (  Drm(root4olen octyd mDrauvo (0altrmrctodfaD an s;t) rxm(o3iu1op elict tfa2rrxmont4tee mo3iadls eluvsnu)tetrir tatop elivs s) ruoir iy1ll elnvt t)arraurpnt0oexo i3iatlsDrlnmont0 rtnif totfa rln o s)srxrimpou1op elfvils)sDrax  ;u1tpe  fetydfm uln p;t) rtnxrcoydlpD lies;() 2uo(opiydomen fvil()srumxmpno0tpen fcildlmDul(vp;(0 lermr tytfa   neo s0seurio nu4om  mfct t sruauroou4aetn ociyt aDeanvp;(0tlxrir oatlmDr uvi ( srxmxrpno4alee ivil( a2taumono0tltnmieiydlsDua(mp u)tlxoif3todop rlu s;s0tetoirpiy1lmtnmies tfs2rmu pnu0olt mociasfm2eanmo;(0altoxfctytom   nvol(0s2umxo iodoltemfci ( artaxmooo4tetnmf3iasfa ua(mpnt0 leoir3iodlmte ivs;()srurxmpoo1apeelicia() rum(mo;u1oexo i3iys m2ul(ms t4 etnxr3ia1la ran o;s srum(m3oodapt  nes s a2rrx p;o1olx micildlmDrluvsnt4 ltnifctadfa  aiei;t0s2xoir3iy1lmeelfvs (f Drr(ronu0aeeomi3ilsfm2eluvs (4 exomr3todopt lnvi;t0t2urxr3iu1ap nmictls)aDuau p;t0altn fcilt a2ea(msn(4tetomr3iodlmtraneo t) rtoim nu1ol emicsa(faruaur nu4oee miciadfsDum( pn()aleniocty1oa   ivs;t  rxm(m3ny1amtelnct sfsDumu  ;u4olt ifciat a rm( s u0alenmf iydop ranei (0 euoxm oy1ope  ieil(faDumur nu0aex  f3iadfsDeluvs;u) rxoxr iydom eliesl()seto(r3iydlle mfctl(fsrtmu pou0aexoiociytlm2um( p;(4tltnmf3iatfmD ln ils)tetrio oodlpen ncil(  Dtr(monu0oeeomf3tltlmDrl(vs u4teermo oa1lmD aueolt0tetrxmpoodlm e nes s)aruaxronu0oetn oetydla2rl(vo u0artoxr oadfmDr ivi;t0tetrir iy1lp   ictas) Dtax pnu1optomiciat a2ra(vs;t4aetoxo ty1om eln sl() 2toiopnu4llenlnvtlt sDtrxrp;u1alxnifcilslaDeluvs;t0 exrir3totfm  luvs;s0 rurxrpio1ap elfvtas)aDrrxm ot4tltoiieilsla2elums u)artnmr todoate uvilt)tetmxrpou4ll nlfetat)s2uax  nu4apenmfeiadfm rmnms u0 rtrxr3oodlpD  nes s) euo(mpny4ameelneiasfsDrm(mono4olxnmfcild sDra( sn(4tlxoio iotfmD lneo;( texmxrpoodlptnmfvtltf rra(r ;u1tet ii3ias a ua(vsn(4 exriociadlpt luvi s0 rtrio3iydaltnmnct tfsDtaxro;o4olto oeiltfm ea(vp;u0 etoxrcio1fp e n o;s)t2xoir3oydop  lnvilt)a2urxm ou0alt iieils m rlnmo;(0arenif3tydlmD lieo;s sexm(r3io1lme  iciat srtr(r nt1opxn ietydfm2umnmsnu)texrxr ty1lmtrlnvo ()t2umir oy4lleemieil(fs2rm(rpou0tle  o3iydla ulumo;t0 rtnxr3iytfptelueo;(  2uoxo3ou1ame lfet s)a2uau ooo0tex  i3tldlaDuau o t4 eenircty1lp e ieol(0texrio3oo1oleemivt sfa2tru pou0opt  f3ilt a eanvs;u4 rxoxr todlp  ln i;(0s2uriopnu4am emfvi t aDrm(  nt0apeomiciatfs2um(mp u4 etoir3iydop e i o;s srtm(opoo1olt livsasfarta(rpot0tlt ioctyt a ean o u4 reomf3ta1fpDrln ils)trxrirpiy4altemfvils sDtrum nt0opxomi3ild mDrlnvo (0trxniocoytfm r n s;(0 etmio3iy4am n iei (  2tmurono1aleoiicilsfm2rlnvp t4alerir iodomtrlivi;t)setrio iydame mfci tf 2ta(moot1aexnmfeiyslm emnvo () exrmfctotla  li sl()s2um(opiu1ame licta( sDta(rooo4tex  feiad a em(vsn()trxrmrcto1laDelnvs s  2tmxo oy4lleemiesltfsDrax ont0apt ioetyt s2eauvp u)treoxr oadomtean s s setrxr3oo4lmte ieta(fa2tmxronu0tpe ioctldls2rmn p u4alxnircoatfm e ivsl(  etoimpou1open fvtasf rraurp;u1optnmo3iasla um(vsn() rxnio3oytop r ivs;s  rur(r3oodaltemfesatfartaxm oo1oet mfctlsfsDea( s;t0altnxo3oodlaDrln s s  2urimpoy1op nmfvsas  rtr(r ;t0opeo fciyd aDrauvo;(0alxrmf3ia1fmte nesls0teurio no1oltnmfct ( aDrmur oo1tlx  icils a2rl(vs u)altrmo iadfp eaivs s0 2toim3iy4al emfcias sDrrxro;u4tlenmoeiytls eanvsn()trxnir3totfa r u o;() 2tmxr3io1lleemfvtltfs2tmumooo0alto ictldfs rau p;(4teeoxr tatlp   i s s0 2uoir3io4amen fcil(  Dur(r ot4tpxoii3ild mDuln pn()alxrmr iodoaDeaues ()trum(r3ny1am elicslt aDuaurp;t1apeo oeiysfa2rlump;u)arxrxr todlm rai olt0srtrimpoo4llt  fetatfaDtm(ront0oeeo oeilsfaDuanvs;(0tetnio to1omt  u i;t0s2toio oo4alee ivtat)s2rmu ooo1opeoiieiasfsDuanvpnu4 rxnxf3oytoaDran s;t0 eurxm3io4lmenlnvtl()artr(  ot4tet moctysfsDrm( pnt)alerxo3tadlat  ues;( s2uoir iy4llen icsa( sDua(ro;t4oeeniieilsfa rau snt0 etniocoadomDrlu o s0t2tmxopny1lleemiet t  2tax o;u1apxoii3iytfa2ul( o t0teenif oydop e u i;s)texr(r3iudam  lfetas  2tmx  no0tleoiociysfm ul( sn(0trenxo iadoaDr uei t t2toxmpio1lmenmncs t sDrax  ;o4tlxomieilt a rauvs;t0trxrmrcoo1lmDranvo (0 2tr(m3iy1omt lici ()sDumum nu4oeen ociyd s2ea( o u)tetnioctytfm r nvsl(  etmim no1ol e ietlsf Dra(r ot0alxniocild s2ra( s;u4 exriocta1laDraieil( s2xrxr3iu1al  mneils)s2uaxmp;t1teenmi3ild sDrmn o;(4 rtnmrcio1lpt  ivo t) rxm(m3io1om e fcil()srtrx p;o1aexomfeiad mDum(mo;t0arerxrcoydoatrai s;t0trtoirpny4oltnlivtas)s2uau pnt1aleo fctytlsDelu p t) ltrmo oadfpD  u s ()t2urxrpny1amt mnetl()srrm(ro;u1apxnmiciadfm2el( onu)tleoifciotfaD  neslt  2trxo oo1amtn ictas aDumx o;o1opt ifeildfs2ua(vs;u)tlxrmo todfpDrlivslt)teuoio iu4lltn ivtlt a2rmumpnt4apto ietltfs2emn o;(4texrmociadlmtrlneo;s srtrimpiydal nmfetat)srrruront1tet ifciys m2ua(msnt)alxrmociy1la e nvslt0 exrxmpio1om  lnvt tfsDua(m ot4optomfciydfmDem(ms u0aeenmf3oy1oa   iei t)teurio3nu1apt  fes (fa2rmum ot4tlxomieild mDeln s ()aeenir oy1lpteaiesl(0texmxr ou1lmtn fvtl() ruax pno1apxnioeild sDra( sn(0 exnio oydlaDrlu s;t0 rur(o oy1omte ivslsfartrurooo1aptomf3iyd s uauvp;t)altnmf3iydlaDe uvils0trxrxm3no4altelneils  Durxmo;u1alenmi3ild s2em(ms t) etrmrciytfpD livi s teur(mpnodopen ies ( arraumont1apx  o3ils s2rmuvo t0 ltoxo todomD  u slt texm(mpnu1lle licsat  rraxrooo0aetomoeiytfmDea(ms;()aeeoxf3iytlaDe ivols0seuoir io1apen fvtl( srumump;u1tpx mociatfsDelnvont4treniociotlm  ln o;s0srxmxopiu1omtemics t)aDrau p;u1tptoii3iatlmDemumsn(0aexoxo3iytlateanvslt)trumxopoodlmeelfes (  Dtmu  no4aeeniociatls rmnvpnt0 exomrciotfp rli s () eum(m3oodlmtnmicsasfsruau pnt4tle  i3iysla2ra(vpn(0tetomr iotlp  au il( texr(opoy1omen fes t) ruaum ot4apeo ocilt s2elnmsnt4teeomf oodomDran i;t0trtrimpiy4alt livs s  Drmxm oo1alxoif3iytlsDranms;u4tlxrmrctotopDeaivi;s0 2xo(r nodam elictlt) ruaxmpno0tle mi3iyt s2rmumo t0aetomr oadfa rlivolt  rtr(o iodllt  netat s2rmurono0oexnmfeiydfm2umnmpn(4 ltrif oy1fpt ln slt t2xriopou4lm  livt t  Draxm ou0teeo fetlsla ranvonu0 eermocia1om e u i;( srtrim oydome lies tfa2ururooo0oltoii3iat aDeln o;t0trtrxr3oatfp r ivsl(0s2trio3io4lm  livtlsf rta(mp;o4opt if3tatfaDel( onu) etnio ta1lm  lneo;s  etoim3iu1lmtn ncs t)aDtm(rp;u4ope mieilslsDeln o t0alerxrciytoate ivs t sexr(rpio4lmtemictl() Dua(mpou1oexn fciysfsDelnmonu) eenxo3oy1omDe nvi;s0 ruoio3ou1aleemfcsls)a2raurpot4olxoiiciyt m2umnvo u0altrxo iadlpt  nvsl()srto(mpiu1lp  lfei (f rumxrp;u4aeeo f3iysfa rl(vo u0altomf oytfp  an olt0 2urxrpnodomenmncils)srua(rpot1olxoio3iatfaDrmu s t0 lxrxo ootfp rlivs;t s2umirpnydop elnei (fs2ua(r ;o4apxomo3iytfa uauvs;() rerifcto1lm eaivs (0s2to(r iodope  ivsatfsruru onu0aexniieiytfa umu o t)teeoif3iadfaDr n s ()tetoir3iy1apenlnvtls) Dta(ro;u0aetniictatfm raumo;(4 eeoio oy1fatr ivi s0seum(r3oydamtnlnet tf rrru pno1alx  feiat s2el(vo t0trtoio3ta1lat lueil( sexoio3iy4apeemfctasfaruau pno4tpxn feiyd aDrluvp (0 rxrirctodlp eln olt trxmxo3oy1llt livias sDrmumont0tleoifciad s2umnmp;()trtoio3tadfp eln o s)srtrirpiy1ap e fvi t)sDrru ont0tlxoifciysfs2ul(mo;u4alermo iodfaDraivsls) 2urir3oo4om emics t)sDuau oot1altnif3tldla2eaumon(0 lxrmfciadomDr ues s0tetr(r3nodal n fciltfartaxmoou4tptomoctytfaDrm(mp u0 etomr iadomDe u i s0trtr(r3oy4lptn fesasfsrtrx  oo1apt mo3taslmDrl(msn(4tetoir ootlmD ln ol()s2tmxr3oy1aptn fvils srrruro;t0aptnifeilslaDeanvp (4altnxf tatfmt an o;t)texrxr3iydom elnes ( arua(r ;o1olx  ocilt m2elnvpn(4texnxrctotfmD  n s () etr(opno1ale  fcs (f Dum(mpot1alto i3tatfmDrl(vo u) etoir iy1oa e nvilt srxoir3iodap elfvtas) Drm(  ;u1alt ioetlsfaDrmn s (0 ltomf oy1oa e neils t2tmxo nydlmt lfvsas arrmur nu4tee mociatls rmnvp ()alxrxo iatlmtean sls teum(mpiu4lmtelnvt t) 2umu p;t0oex  feiytfmDulnmp;(0tltrxf tytop rlneo;s) exrio3oo4lltn netas  2uaxrpno1altomfciyt mDrl( s t0altomf iodom rln s s s2tm(r iudap  lict t aDrau poo4apt  o3iydlmDeanvsn() rxnxociydfptraivi s)sexm(m3oy4lp  mncsltf Durx ooo0ole ii3iltlm emnvp u4teerxfcio1lp  lu ols)s2ur(r3oydlltn ict tf rrax onu1altn feilsls el( p;()tlxrio oatomDeaivi (  exmxopiodomtelfvtltfarrmurpno1oee  f3iasls ranmonu) etoxociadomDranvo;(  rxrxo ou4opt mfeia(fsrtr(rpot0oltoiieilsfsDrm( p;t4aetnif iatop   u o ()texoimpoudopenliei (f rurxmoou4tpto ictasfa emn o;t) rtomr3iytfatran o ( trxrim3ny1amee ietl(  rraxrono1tpenmi3tasls2elnmp t4arermfcta1lmtr neo;()s2ur(rpoo1omenmnvt t)aDua(rpnu4tptnifctlsfmDean p;u4 rtnmrcoodfmt  ieo;s s2umir iu4apeelnvsa( a2uaxr ;t4ope ifeiytlsDemnvpnt) eerifctydfm  luvslt s2xrxo3iudal nlnctatfsDtr( ono1apx  fcilsfs2uau p u0tetnxf3oodfpDrlu s;s s2xoim3ou1lmtelneta()s2taumpnu1aee io3iat a el(vp;u4tlenmf oodomDeluvo;t sexmxopiy1al nmnetlt sDrr( onu4tlxomfciyd sDelnmsnu)tltrxr oodlpDelueo ()srtr(o no4ol  mfcs (f 2rmx oot1alxoioetat m ua(vo t)alermf ta1fmDean i;t0s2xoxm ny1amte ncta(fsDrmxm ;o0olx  feiyt mDemuvonu)alxnmociadfp  lu s () etoxmpnydam elieiat)aDtmxr nt1tpt mfetad aDrauvs;u4aetoxo3iatfa elu sls)teuoxopnydlm  mfvi t)sDraxro;o0tltn f3iytla uau s t)aeenmo oodlpte nvo;s0t2tmxo iy1lme lnet sfs2taxr ot4aptn fetat m rlnvp u0trxrxf3oodlaDr iesls tetrxo oo4ap n fvsl( sDua(ro;u4teeomi3iadlmDulnvsnt0trxoir iatfp ranei s)srxoxopnudal n neia(  2tax oot1texoifeiltla em(vo t4arenxo todlp   iei;s0s2xmiopiudamtemfctasfsDtr( pot0teen icild s rmn snu) rxnmo io1laD aueolt t2umxopny4amtnliviat) rraxront4apxnifetadls2ua(msnt)aexnif todfm elieols) rxmxrpiu4om e ictls)a2rmxrpot4tltomoeiatfa2uluvonu)alxoiocoo1opDrli i ()trumxr3iydale  ieilt)s2urxr ;t4tpxnif3iat m rauvs;()alxrmr iydfa   ies t0srtoxmpou1om   nesa( artruroou1aptoio3tatla2rl(vsnt4 renmo3iy1laDelu olt)s2tmxmpiy4ope lnvi s aDuaumo;o0ope  iciasfa uluvon()trenmrciotlpDrln ils0 exm(o3iy4altelivta( sDrr(m ;o0tpx  feildfaDrlnmp t)artnmr ta1oa rli i;s0 rumxmpio4lp n nvs ()arua(mpou0tpe mo3iasfmDumnvo u0 exnmr oodopD lu sl(  2xoxmpiy4alenlfvs sf Drr(mpnu4alt mieiltlm el(vo (0aetrif3iy1fp  ln o;t0 2trirpnu1alenlfcsat s2rm( pnt1tlt mfeils s2el(mpn()artrmfcoadfpDeauei (0 exmxmpnydoptnlfeslt)s2rrx oou1alxomi3iyslmDulu pnt4aetrmrcty1op r uvo s srxm(mpnu4op  mfvta(fsrraxront1alto feildls ulnvonu0 lxoxf3ootfat  ivs t trtrio3oodope mfciat a2rmu pou4tex ioetys m uln p (0tltomfctadoateaueolt0teurxm3iudlme  fvtltfsDumxr ot4aetnmfeiasfsDrmuvo (0trtomf3tatla elu il(  rtr(rpny4lp  mivias sDuaurpoo1oexomfeilt s2em(vonu0 lxoirciytfateaivi s t2uo(m3iodllenmncs s arra(mono4aetoii3tldlm2rlumo t)tltoxo3tytlpDr uvol(0 2tm(r nydll  mivsls)s2uau  ot4oexomocilsfaDumump;(0 lxomr3ta1omD anvi;(0s2xoxmpiydameelncsls  Dur(  ;u1ope  o3iys a2em(mp u0 rtrxo3oytopD li i (0 rtrio3ny1lm e iesasfsDrr(m ou4oeenioctldfa2rln p u4aexoxf oytlpDelnvslt0srurxm nudlmtemneiat  2tr(moou0aptnmoeiytls umnmo;t4tetoio3tytla eli olt) 2ur(o ny4lpt  nvt tfs2trur ou4aexomo3tlt m2eluvon(4 exrxr3io1fmte nesl() exr(r iy4ll   net t sDuru onu0alt io3ild m2emuvsnt0 eeomo iydoa raiesls  rtoxmpoodomtnmfvils aDuaxroou1alx iicias a uan o t4alenmrctytlp e ivilt0t2umxr3nu4apt lfviat)s2rrx  oo0opto f3tls a2rl(vs u0arxnircio1lmDraueo;()seurxopiudap nlfetl(f 2rm(r ;u1tpe mi3ildlmDem(vo (0tleomf3oytfmteanvs;( s2ur(m3ny1lltnmies s  Duau poo1teeo oetld s umu o;u)aexnxfcia1fpD au s s) rtm(m nu1lmt  fvs s sDurxmoou1tpx ifetytfs2ean o t4trtrxf totom r uvi ()srtmxm oo4optnlnvil(  Dtmu  nu4aptnmf3tydfmDrl(mo u4aexnxo3totfm e nes;t  2uoio3oodllte fvsa(fsDtaxr nu4tltomfciad s2rm( s u) ltnmr oodomt li i;t0texm(mpny4ame lfei t)s2urxrp;u0tpe mociydls2eln o t) lxnif oodfmt aivi;s0setoir3nydlp nmivia(f rrmurpot0tpeo ictatls em(vont) leoxfctadomteln s () eto(o iodoleelietat aDraum no1tlx  fciatfm rm(vo (0texrmo oytfaD ai sl(  ruoir3oo4lm emnvsl(f 2tmu pnu4aex ii3iyd sDrl( sn()aetrif3oodlptelneo;t0t2to(rpno1opee nvta() rtr(ro;u0aetnmfeild a2um(vpnu) rtnirctotlmDe i ol(0 eto(mpoydaptnmnet (  Dtmx  nu1tle ioeiadlm elumo u4trerifcio1laDrli slt) 2xmxopnydlm emnctl(  2ua( oot4tltnif3iytfm elu o () rtoxr iadfa  li o;s) 2xr(r ou1am nmnctls)artaxr ou1apen octaslmDeluvs;u4teenirctotlmt anei;s)t2umxo3iy1lptn nvia(fs2raxroou1oee mieiasls rmnmpnt0 eeoif3iotla r uvsls0srtrxr3oo1llt lfeiatfsrta( p;o4opx  ocilsfm ua(vs u4tetrmr todoatranvslt) rtr(opiu4op nmfciat aDraxm ;o1tlxnio3iytfa rmnms;u0 rxomr oadfateauvi t0 exo(r nydole mfetl() 2tmur ot4tpen ocilsfm2rl( ont)artomo iydfp  liei t  rtoim3no4alte fes s sDururp;u0apx  f3tlsfm2rmnvp t) lenmfciytoptranvi;s)tetrxm3ou1om  lnctas srtmxm ;o4aeeomf3iadfs2rlump t) renmo tydlaDraueo ()trxoxm3iu4ameelnvi s sDtmuroot1opxo octytls2eanvs () ltrif oa1lmDeai olt)t2uoxmpiydoltnmfesas)arraumpnt1olt mf3ilsfs umumsn(0aexnmf todoateauvols t2xrim iu4opeelfctl(f Draumo;o0oltomf3iadlmDem(vs u4tlxnif iadfmte n i;t0trtoir3iy1omtnlicilt srurumonu4opx mo3tas m2uauvo u0texoxocoatla  livs (0t2trxm3io1oleemnetlt a2urur ;u1oeen ieiltlmDua(vs;(0 ltoxocoydomteai il(0truo(r3oo4ap elnvs sfaDraurp;u0alenmo3iydfa2eln s;() exrmf3ootomDeai o s srxm(m oy1omenlfctlt aDta(rpot0optnmfciytlaDrlump;u4 exnxr3oydop  livs ( trtmxrpoodom elivi () Drmum oo1tlxniietas m rmn p u)tlxoxfcootoa eanvo;(0t2xmimpoo1optnlivs sfaDta(ront4opxomfetasfm2rmuvsnu4tlxnioctytlatr ivsl( tetrxo nu4ameemnesls arua(m ou4tlxnmo3tlt a2umu s;t) etnmo3iotfpte ieo;t trxr(m3oy4apt  ncs (fsDrmu  nu1aptn fctas a emn o;() reomrcoa1lp rauvo;t)teur(m3iodapte fet s aDtaumonu0tpeniictydlsDul( pn() lenmrcoodopD anvs s s2um(opoydoleemnvt t srumumoot4olx ifeiytlm rmnvpnt)trenio ia1oa elnvs;t) 2um(o oo1ol n ieia( sruaxrpnu4aeeo feiasla2rmumsnu0 rermr3tytla  lu il(0tetm(r3io1apeemfeta(  2rr(m ;o1olt  fetatfa2rmumo;() lxoxfcta1om r ivslt0t2toiopny4lpen iet t)aDumu oou0oeenif3iltls2emu o;u)arenxfcoodla  an o () eum(rpny1lm nlfvs sfaDur( o;o0texnmociltfm2ra(vp u4 exrmo3iy1fmD ai i t)t2xrirpiy1lleemfcta( srrmxmp;o0oexo ociltla2umu onu0 exrxf io1fptelivo s0trto(mpiu4om emiet (  Dra(mpnu1tpt  oetadlmDrlnmo ()treoircia1faD  ivil()s2urimpio4amtnmivilt)aDtrx o;t0apenmietytfm2elump;t4 lxrir3tatlp  lnei ()sexrio ou4llenmnvta(f 2raumpnt0aeeomietlsfs2eau s (4 ltnxoctodop   nvs;t0trxrir3nodam n nes ()arur(r ;u4aet  fctldlm2emnvsn(0trtomo iotlpD li s;t)s2trim oy1lp n ict sfaDtaumonu4tee  f3ild a ra(ms;u) etniociy1opDeau o;t tetoirpnu1lptnmicslsfsrurumpoo1olt ifetyslsDemuvp;(0altnxf tadfaDeanvils seumxo3ou4al emncil( a2uaxm ;u1tle  o3iydla2ranvs u4trxrio tadfp rln i;s)texo(rpoo4lm elieia(fa2ua(  nt1alt mfeildfa eanvpn(4 lenif to1fa  ln s (0teum(o ou4lltelnetasf Drau  ;o4apxomfeilsfm2umuvp;t) lenxrcoy1opDeauvi;s0sexoio iu1ap  mnciat arta(  oo4opxomoctlslm emumont) ltnio3totfm rlu o s)trxrimpoy1oltemncils) Dra(r ;t1tpxn i3ildla2uau o t) ltomf iodoaDrauvi;t0 2xm(r3oudom nlies t a2tm(ro;t1tlx mi3iltfs2umnmo t0texnxo tadomteaiei t s2uo(o3no4ol emnvi t  rtr( o;t1aexo feiysls rmn o;()aexrmocto1op  ln s t  eumxrpoy1omte fvsasfsrtmxm oo0tetniietasls2umu p;t0 eenxr3oa1fmDr ueil(  2xr(m oudlltnmici (fs2umxront1tlen oeiytlm rm(von() eermfcoadfmt  i o;t srxo(o3no1lm  mneils  Dtr( o;t4opxnmfeiytfaDra( pnt4 eeoxr oa1lpDrlueil(0s2uoxo3ny4altemivtlt arua(ronu4tpenifetad s2el(mp;t4altnmfctadfptrlnvols0srxoxo ny4lm e icils sDta(rpoo0aleomoeiyslm uauvp ()trtrif3iytomDr n i;t  exmimpiy1omtnlfvsls)arra( o;t1oltn ieilt m rmu onu0artrir tytlptrln i;t) etm(opoodlme mfesat  rtru o;u1alxoifctyd a2ulums u0teenxrcto1omDean s s0t2to(m3ou4ameemicsl()srtmxr ot4aeeoiocils a2uan o u0 rxomfciytoaDrlivol(0 rtr(m3oo1om  lnet t)sruau  ot4tpeo octytls2elnmon(0trxoxf iy1lmtean i (0trtoxo3iydom e netl()aDtrurpnu0tlxnifeiltfmDumnvp;t4 eenxo3tadlm r neils0srtoim oy1omeelfvt tfaDuax pou4tpto icild sDulnvsn(0 ltnif iatlpD  nes s0s2ur(r3oy4lmenmfei ()sDtmxm ;o0tlt  i3tad a2eluvo (4trxoio ootom ean o ()s2to(o iy4lle mnct t srum(  oo0tpxo ictasfm2ul( p u0trerif3oydfp  livi;( srxmxr3oo4ll elfciasfa2umx p;u0ope if3iyd a ulu o (0 ltnif3iatlmtelieilt0 ruo(m oy1olee neiltfs2ua( pnt0alxomfeias aDulu ont4teermr3io1fpD lu s;s0srxoir3iy1op n fcsat  2tm(mpou1alxn f3iysfs2eaumo;t0tetrxocoa1fpte ues t0 rxr(rpnu1lmtn fctl() Drr( ooo1tptnio3iadla2ulnms;u0teeoxfciy1optranvi t0tetoim3oy1lp nmivt () 2raumpoo4alxniiciatfs rmump u0tlxnio3tytfmDrau o t seum(m3no1ol  mnet s a2urumono4tpxn i3tld a2em(mo (0 etrir todoateanvi;s) eum(o iudap emfcsa(fsDrm(monu0olxomictlsla ra( p;t4 rtrxoctadfm eaueo;(  2xriopnydllee ncsl(f rtmxr ot4aeeo ociatlaDea(vonu0aexrxo io1latr neilt0 2tmxr3no1amt lfvsat)sDtrxrooo0opto octatfsDrl(vo;u0 eerifcootoaDeanvs;t setoxr oo4olt mfctas  Dtr(ro;u0apenmi3tld s2rlnvo;u4 reomo tytomte u ils0s2uo(m3no1am elncs ()sDrmu pnt1oetnmociltlaDrlnvpn(4trxrxf to1lat anes t0 2ur(m no1ame  ivs tf Dtaumo;o1opto ieiasla ranms;u)tlxrmrcia1laDelneil(0s2xmim3iy4optelfci ()arraurpot0teen ietat sDumnms u4trtrmf tatfmD  n o s seuoxmpno4om  livi ()srraumpot0alt mo3iytls uanmp;()tleomfcoadlpDe neslt0teumxo no4omen fvsls)arrmxrpno1aee  ieiad m rl(mont)trxoir3oydlptrai i;s  exmxm3nu1lp   ivs ()srtr( pnu4tlxnmfetaslmDelnms;(4trtomfciadfa   i i;( trurirpoydopeelfcsltf rtmxront1apx  fciytlsDelnvp;u0aetnxr3oodomDe nei;t texrxr no4lmte nvt (fa2tmx  ;t0tetomo3iadlm2elu onu4treoxo iadla eaieo (0trurxmpiodaptn ncilt sDtru ooo0oet iictyt m em( s u0 ltnmf3to1fa r uvo ()texoxm iy4am emfct ()a2ur(r ot1aptoioeiys a2uluvsnu) exrmr ootoatr i sl()trxoxopoodllt liet t)aDurx  ;t1olenmoetyt a rm(mo (0 rxnio oa1lat  ivol(  rumiopiu4ol emncs (fsDtauro;u4olxo octltla uanvp (4altnmr tadoaD aueil(0seurio3iy4lptn nvtasfa2urxmpot1tlxn f3iltls2umnvpn() eeoxfcootfm e iei s)t2uo(mpoy4lpee feta( srtaur no0aexnmi3iysla ean ont0 eenxf3io1lpDe n i;s t2uo(r iu4ame  nctasf Dtruro;u1opx ii3iydfaDum(vo;u0artrxocoodlatrlivo s0 ruo(r3ny1amenlicil(fa2trurpou0aee mieiyd sDrmn p t4 reoifctatlp r u o (  2urxmpou4ol elfesa(fs2ra(m ou0oet mo3iydfsDeauvs;u0 etrxr3ta1fmt li ol( sexr(m iy4om  lnet (  ruaxmp;o4alx mieiltlm ranvsnt)treoxo ia1fpDr nvi;s  eum(mpoo4lp  lfes () Dur(mo;t1ale  ieiys m2rmu onu) lenxr ty1lmDeli ols)t2xm(o oy4amtnmies (fs2taxm ;o0tpxnmfeiyt s2ranvp;u4trtnmr3tatlptrai il(  2trxmpoudop nlnvtlt  rraxm nt1olt ifeiatlmDranvpn(0altrir3tatoaDeauvs;t  etoxm ou1ape  fvsl()artmu ono0aetoiocilsfmDulnvs u4trtnmfcoa1faD lieolt s2uo(opny1op  mfct sfsDurumoou1texoiieiasfmDea(vpnu)alxoxo3tytfpteauei s0t2umiopoo4ol n fci sf Dra(rp;o4apxn fciadlaDean s t0 ltrxrctadom eai i;s setrirpio4aptemnct t)aDtm(mo;u4olxo i3tytlaDrluvs;t)teenircio1fa e u s;t) etmir io1ome mfvils) rumu p;t4aeenio3tls a ean p;(4alermf3oytlat lnvo (0seuoxmpio4amee ieils aDtrx p;u1tpxo feiatfaDrlnvo t4trerifctytlm   ues s) 2to(m3iudalt mnvsatf 2raurpoo4ape mociytfa2ua( s ()altoxrcoa1oaDeanvi (0srxm(o nodameemncsa( sDuau p;u0opt  fciadfm ul(mo u4trtomocoodom rln s t t2xmir oydamen fvtl()s2uaxro;t0aeto i3ias s uaumpnu)teeoio oatlmD  nvi;() 2um(m iy1llenmfctlt)s2trxmont0oexnmf3tatfm2rm(vp;u) renmo todfa eliei;t0s2trir3iu4lp emfvtlsf 2urxm ou0tleniociytfsDra(mo;(0teerxf oa1omte ivs ()t2toim oydomen fcsl()a2rmx o;u1optniictyd aDea( p;(4areoir3totfmteau o;t t2trio3ny1lp n iei s a2uaum ;t0apxn i3ils sDumnvs t4trtriocoy1faDe uvi;t  exrim3io4alenlietlt)a2urxrooo1teeoii3tls a rmn pnu) ltrmoctydlateli i;t0 eum(rpoy4omtnlnes ()a2urx pnt1oeen ieiyslm emu o;u0 ltrmociydopte i sl() rtr(o oo4apt  fviat srtruro;u1teeomi3iaslsDum(ms (0alxrio oodom e i s;()seuoir iy4am nliet s)sruau  ot0opeomictltlmDra(mo;u4 rxriociotlmtr u s s) rxoxo ou4apenmfvta(fsDururpnt4optomo3iysfa rl(vs;(0teerif tadfa   i sls0sexoiopiy4ll nmfvtatfsrtrxrp;u4teeoioctatfs rluvp;t4trtrifctydlptean ols s2xmxrpou1lle mfesltfsrumxmp;t1teeo fctadfsDuan onu0tetoxf3oodlaDrlnvo;t sruoir3iu4lmte nctat)arrrur no0oexo o3tasfsDelnvp t4trtoif oadfaD  n sls) rumim3ou1omtnmfvi (fs2rau o;u1tee mi3ildls2rauvo;t4alenifcoo1omteai slt  rumiopnodlpe lfeias)a2um(roou0opeomociytfm2emnmsnt4trtomoctotlptrlueils  euo(o3oo1op nlncsls a2rm(  ;o4alenif3tltfs rmu s (0 exnmf oytfpDe u ilt)t2tmxmpiy1al  mnvsas)s2rmu p;o4ale mf3iytfm2rlnvon()tlxrmr iadopDrlnvs () 2umio oy4lp nmfcil(fsrum( ont1altnmocias a2ulnvo;()aeerxr3tatlaDr i i t)trto(mpoy1lmee fciat artrxro;u0oee  o3tytls2eau s (0tetoio3oydopt ai ols0srxoxm nydlpen fci t sDrrurpoo1olxnmf3iatlmDelnmpn()aexomrctydfm elies s) exmimpnu4lm   neslt  2tmu oou4texo o3tadlmDulnvp;t)aeenmo iotoaDe i i t srtmxopoydll nlietlsfa2urxrpnu0aptomoeiysla elu p;()tetrirctotom rli s;t0teur(mpny4oleemncta(  Draur oo0t
\ No newline at end of file
@@ -0,0 +1 @@
+i ols0 2xoim ou1lptnmfvt tf 2uaxm nu1tltoiietydla2emuvo t)teeoir3iytoaD lues (  eto(rpiudam e ivs t)a2raumont0alt miciat mDelnmp t4 rxoxf3iotfmtean o;(0setoxo3io1ol n fcia()sDua(rpoo1oetn o3iydlm rluvo ()arxoxf oy1opDe i i;t t2trxo3nodlpeemivsas  Dra(  ;u4oet iiciatfa uau s u4 exrxrctydoa   ivo ( s2ur(o iy1optnlivi sfsrtaxrpnu4tpt  feiaslm rlnvo t) etrmf ia1lpDeau i (  ruoim3oo4am n nesls) rrm( ooo1tlenmo3iyd s em(ms ()tetrmf oodomDeln i s0 rxmxr3no4llt lfesa() Dtrum ot4oleo oetls sDrlumo t4 reoiociy1laDeanvil(  2xr(r3oo4amtnmncs tf 2tmx o;o0aeenifciatls2uau p;(0 rtnir ty1om raivo t0s2trxm oy4omenmncsasfsDua(ronu0ape ioetlt mDulnmo;(0 eeoxf tadlmtraueils  rxrxm no4omtnlfvs (fsrurum oo4open ieiytfsDuln ont) rermf3tatoa e neo s  2uoimpiu4lm   fvi t)aDtmu pot4tpe  i3tysfa2ranvpnu4 rxoxo3to1oa eauvo s  2xr(o3oy1apte nvils)aruau p;t4apeo fctadfsDua(vo;u) etomf3ty1fmDeauvil(0srtmirpiodom elfvtl()s2umurp;t0opto fciasfaDeau o (4texoxrctytom rai ils) 2uoiopiy1lle  icsa()s2tax  ;t1olenifctatfaDrln pn(4 rtnir3oa1lp  li i (0teurimpoydop   fviasf 2urxr ;t4tpeomfciysfaDrm(ms ()trerirciatfpD  neo ( s2xmxm3oudlpt mict sf 2urxrp;u0apx ifeiytls ua(mon(4aexnio3oadom  aies (  exmio oodom   fei s)artaxrpou0open ieiltlm ra(monu) ltnircoatlpDeln o;t  etmio nudlm elivt ()srraumont1aeeoii3iatls2rluvp;u0trenxocty1optelu ol( trto(opnu4olt lfvil()sDrmu pno0ole  f3ilsfm el(mon(0aeeomfciotlm  anvs;s0 etriopiydop  mnesa()sDua(r ;u0teen iciaslm2uauvpnu) etnmrcoo1lm rlnvo t0teumxopoudome lieta(  rrrx  ;u0ale io3iydfmDran o;t4teenmo3tadom e ieol()t2trir3oudom elnvt t s2umxmpou4opto ocildlm2ra(vp;u0trxoif3tytom raueils seuoxm3oudlmen fcilt  2urxro;o4tetn o3tadlm eanvs ()alxoiociydlmtr u o s) 2xoim io1llt lneiltfarrr(m oo0oltomfetaslsDraums;t4tltomo3oadomDe ies (0t2umim nudlmeelnesa(f 2rru o;t0tpxoiiciltlsDrl( sn(4 etnifcto1lp eauvo;(0tetrirpnu1om  lfvs t a2ur(  ;o1tlenmfeiat s2rluvont)texrmo ootfmD  ues;s s2uoxmpoy4al nlnetat)sDrm(r ot1oexn f3iyd mDum(ms u) exnxr oy1faDelu o s  2uoxr3oodlm   nvs t)sDrax pnu1alx ifciydfa ra( o u4 rtoifctytomt  uvs;s s2uo(opiodlmt  ietat aDrmurpot1opxnmfeiasfa raums;t4trenmo3ty1oateai il(0tetmxo ny1ale mnvias srrmu poo0tpeo ieiaslm elumo t0alxrif todomteauvo;s srtmxr ny1lptemivi t arrm(mp;o4olenmfetaslaDumu p t0tlxnif tadfptr i ils0 2toxr ny4ope livsat  rrrurono1tlx  o3tlslm eanvo;t0altomf3oy1lmtraieol(0s2umxr3iydlmtnlfeiasfarraxmpnu1oee mietad sDrlnmp;(4tetrxrctodlpDr i s t) eurir3io1open fcsas aruaxr no4tptomoeiltfmDrl( o t4 rtrmociadomt  ies;( seuo(o iu1altn ieta(fartrx o;t0oex mfeiasfsDeau o t)tetomf3oodfmDeai slt0s2um(mpoodlltemics t)arrrxrpoo4oltoifcilsfmDra(vs (4 rtnmrctydoaD anvolt seuoxm oodape  fcsls  2ra(  oo4ope iocilslm ulu ont0tlenif ootfateanes s)srxoir3oudapenmfes sf Dum(m nu0tet  f3ild mDrln pnu)teermfcoa1omDeaieo;t  exmim iy4opee fei tf Drmumpnt4tpto ocild sDrauvo;u)alxrmo tatopDelnvo;s0teuoxo3oo1lmt  ieias sDta(monu4tlxomfctydfm2rau s;(4aetnircoatlm r i ils t2xoxo iu4olenmict s  rua( p;u1oee  fetld s emn s (4tlxnxo totlpt auvs;()trxo(m3nu1apenlfvtlt  2umx pou0apt iocildfs2em(vsn()arerio3oo1omtelivilt) rtm(mpio4opee nesl(fs2rrx ono4aetoiieiys aDra( s (4arenir ia1lmteau i;s) rtoxo3nu4openmies t)sDta(r nu0aptnmi3iltfm2ulu ont4 rtnircoy1lp rlnvsls  2trirpou1amte fes ()s2urx  ;t1ope io3iat a uauvp;u)tleoio totlp e nvil( texm(r oy4apt  fesa(fsrur( pot0opto iciysfmDrauvo t4 etoio iadopt  uvs;s srxmim3ny1lmeelnetl( aDrr(  no1oeeo feilsfs rau p ()tleomo oa1latr n il()trtr(opnydlmtelfesls)artmx pno4tlx mf3tltfaDrmuvs u4tetoio oa1lpte n i t0teuriopoo1lpenmfvils aDtr(rono0aexoiictyt aDuluvs (4 exnir totfm rlnvol( srurir iydom elnvsatf 2tm( ooo1alxn f3iyd mDrm(vsnu0aeerxo3ty1omte u s t s2umxmpiodlm emfviat)s2rrumpou4aptn fctltlm2umn p;u4 rxnxocoytomtrluei;t0trtrxm3ou4omt mnvi s  rtmxm nt4tle ifcias m rlu s u0 rerxf oadopD an olt) 2tr(r3iydamtnlnciatfsDrax  nt0olxnmieiadlaDrmnvpnt)aexomf iy1fmtelnes;s)srum(m3iydomt mnvta(fsrur(rpot0optnmoeiasfs2elums;u4trxnioctydlpDr u o t0 rtrir ny4am nmivil(  Duau  ;u1teeoioctld mDuaumsnu)aexnmfctatlmt  ueo (0sruriopno4lpt lfcsl()s2tr(r ;u4oleo o3iyt sDrlumo ()treoir to1lm r ieolt0s2tr(m3nydam elfvs tfarrmu oou1olxomoetytlm2ulnmon(4arxoir tadoptrluvs t  ruoxr oodamt  fvslt s2ur(mp;t1aexo ieiysfmDem(vs;(4 exnmo iydfmtr ivs;s sexr(r oy1apt  ncil( sDrau pno1texo i3iatlmDemuvp t0tltrif3iydla rli i ()truoxm iodomte fci s)sDrr(  oo0apxnmi3tlt m rau sn()areoxociydlmDelivslt)texmxrpio1ol  mnetat  Dur(mo;u0oetoifciltfa2emnmsn(4tlxrxr3iotfptraiei;s0 rumimpnodlle  iet sfaDua(r nt4open o3ildlaDeanmonu4altrmoctodoatrlivs () euoxr3ny4amee ici tfsDrmxr ;u4tpx moeiltfs emnvpnu) exrmf oo1fmDeaivs;t0 etoio3oo1olenmivtas arururonu0tpxn f3tls mDemuvo;t4arxoxo3io1lptr i ols0teurir oy1lme lnesls s2ta( pnt1tet iiciyslaDelums;t4 exnmf3ia1fpD aiei s0srur(r3oy1ale mnvia() rum(mp;t0tle ioetlslmDuauvo u)aeeoxr tytla rai sl(0t2xrim3nu1oltn nctls s2tm(rono4aee mfeiatfs2uan s;t0artnir3iadlm  au i;()texmxm3nodlm e fviat  2rm(mp;u1tlenii3iat a eau o u4arxnxo oadomDr uvo s0 2to(mpou1llte icsl( aDum(r ;u1tlxnioctys m2ulnmpnu0aetnmfciytfaD  ies ()t2tmxm oy4alee fcs (fs2um(mpot4olxomictydlm2em( sn(4texnmocio1om e uvslt sexoxm3oodlmt  nesas)aDuaxmpot1apxoiociad a2ea(vp u0 rtnif3oydlaD aueo;s0 etrir ou4lle micia()s2rrur ;u4tlt  icias aDemnms;u0altriocoo1lpDrlnvs ()setoirpny1am   ictltf Drm(mpnt4aptoifctyt s2umuvs u)tetoxrciydomt livi;s sexmxrpnodom  lietas srtm(rpoo4alenmieiadlaDul(vpnt)trxnxf3iy1fa e ivsl(0 etmim3iu4ll nlfvt ()arurx o;t0aexn oeias aDraumo;()arerir iadfm   nvs;t texoxrpiy4ope mncias)s2umumpot0ole  fciysla2ua(vp t0aetomf3totfpte ueol() ruo(m3oudll e ieiatf 2um(ro;u1tex if3tyd s umn s () etrxr3to1op  anvilt) rumxmpiydlpenlnviatfsrra(  ;u0olt mfetldlaDelump u) lxoxociatomtrln ilt sruo(opiydol e feiat)a2tm(mp;o4aex io3iat m rl(vsnu0tlxnif tydopDrlues;(0 eumimpoy1olt liet (f 2tr(  no1aet  fciysfaDra(vsnt4 ltomf3tydlmDelieo;s)sexoirpoydam emivslt s2tru o;u4texoifctlt sDemuvs ()teerxoctydfmt  nvs s)trxm(m oydolte ieiat) Drmuront4apxnmoeiys s rlu o;t4tleniociotla  an s t)trxrxo3no4ap nmfci s sDrmurpnt1aeeoio3iadfm2ran p (0artnxrciotfaD  ues;s0 rumxo3iu1omeemiesatf Dum(mont4aexomfciyslm eaums t4 lxnxo oydoptr n s;t)srtmim iy1lpeemieilt) rrmx pot1oetomietaslmDrmnvo;u4teermrctodomtrlu o;t t2xrxm nu4ole licsa(fsrta( p;u4teeoiieilt a2rmn o u)tlerio3todfpDraies s setmxm3ny4lme livtl(fsrtm(rp;o4tpxoiiciys s2ea(mo;t4aexomo iodfm r ivo;t)s2umio3ou4lleemfvslt)arrr(mp;o4olen f3taslm rmnms;t0teermr3oydfaD auei;s0 2xr(r3ny4ape livsas sDrmurooo0olxoif3ildfa ul( o;u0arenxf oo1opDrluvs;t)s2xoxopoy1omee ncia()a2ta(rpnt0aeen ieiydfa umums (4 etnxrcio1lm r nei s  2uoxr3io1lmtnmfesas  rrm(mpoo1opx  f3iatls rl(vo u) lermr oadfpt lneo;t)srxr(m3ou4llt  fctltf 2rmx o;t0tlen fciat m umuvonu4 rerxf3iy1omte n s;s srxo(o3iy4op e ivsl()srtaurpoo1tlen fetldfaDemuvon(4 rtrxo iy1lmDranes;t)texoir io4alenlivsa(fartaxmpnu4aex mfetatfa2umu sn()alxrxo3ootom r ivs t)s2to(o3iy4lmen fesa(f Durxroot4tee mfctydfsDulnmsnu)texriociy1fatr n s;t0 2uo(r oodll nmicsltf rtrxro;u4aet ifeiyt m ulnvpnu4altrxr tatfmtr ues t0tetmiopnu4lltelivt () Dumur nu4tpe  oeild aDelnvpnu4aetrmrciydfpt lieo;()teurxo nu1ame mfesltfarua(m nt1apx  fctld s ua(mpnu4 reomrcta1optr nvils0 etm(rpnydlpenlfesat sDum( p;t1ope mfeiaslaDul(vpn(0texnifctydopD livo;t) ruo(o3nudamenlies t)aDrrxrp;u1tptnifciasla2ulnmp;(0 lxoxo iytlptelnei;s0texriopnodol   fetat)srrrxrp;t1texnio3tydlsDrln sn(0tltrxfcoo1fa rauvi ()texmirpoydamen ietl(fsDraur ou4openiocilt sDea( s;(4trtoif oytlpDelnvilt t2umxm3io1ol n ieias)s2tr( p;u1apeoioetlt mDem(mp;()aexoio ootoaD  i i s)trxrim3oudap nmnvsas) Durxrpoo4teeo fciytfsDea(vp u0trxrxo3oadfpte ivo s)teuoimpiu4lmt mfet tfsrurx oou4tex  i3tytfmDumu p;t4arxrir totoa eaivi t)srxoxrpnu4om elivsl() 2rax  ;o1opt iietadlm2rmumo t4 reriocoodfatelu olt)teumirpoodam  mnvtat sDumu  ou4optn fciaslsDua( s;t) eeoio3oatlm   nvi;s)srxo(o io4lpenmicias)s2trurp;t4oee  fetaslmDel(vpn(4trenxf3iytom eanvi;t0sruo(rpnu1ole lfetlt)aDrax o;u0tex  i3tyt aDea( pnu)alxnxo3iatoaDe nvs s seur(o no1aleemncil(fsDrmxrp;o4oexnio3tld m rau snt)alxnifcootfp elivilt)sexmxo iu4apee nvi t) 2ra(ro;u0olxnifetytfm2ul( snu4trtoxr3iadfaDrlnei ( t2xo(m ny4lltnmici s aDtaurp;u4apen iciatlm el( s;u) ltomr3oydfm  lneol(0t2xmxo3iy4lm  mics ()s2ra(mo;u1oeto o3taslm rmu onu) rxoif oodopDean slt)tetr(r3no1lpenmfvsat  2rr(roou0aetn fciadfs uaumon(4 rtnmf oytlaDe nes s)s2tmir io4op  mnei ()sDum( ooo0apeo f3iys m2umumo t4tlxomf3tadlpDr nvi;s) euoxrpnu1lltn ieia(fa2trxm nt1tpxo iciytfmDean p;(0arxnxo3iydlpDrlivs s0trxoim3io1llt lies (fsDrau o;u4oeeoioeiatlsDea(mo u0 exnio oodoa  au il()srtrxopoy4lmt livt t)sDrrurpou1alx iiciltlaDemnmp (0altrmocoadfa e nvsls)seumxo nudaleemiesasfaDua( p;o4tlxnif3ild sDelu o t) exoxf iadfmD lnes;t trxoir3iodll emncslt) 2ua(rpou4alxo ieias s2umnmp (4trtrmfcoodomD ai i;()s2tmiopny1lm e fctlt a2uaxmpnt0altnmictad s emu snt)aexrmrctydoa eau sl(0t2um(opio4om nlivsltfaDrrxr ot1tptomf3tasfa ran snt0 rtrif3iatom e ivo;s)t2tmxo io1lpte neilt  2tr(r nu4tlxo f3tatls uanvp;t0trxriocoytop  lnei;()s2xo(m3iu4open fcs t) 2tr(r oo1aptomfetasls2em(mo;u0 rtnircoy1laD aivils srxo(r3iydal   ivsas s2tmumpoo4tlt ifctadlm eauvonu4altomo iy1fmDeliei t0 euo(m iy1amtnlict s s2uru  ou0aetn ictys a2ranmpnu0 rtrir iytomD an i;()setr(m iy1omt lnvtas)a2rrx poo0aeto ietas a2eanvp t)tlxriocoatfpte ies ()srxrxr iu4ll   ivtl(fa2umur ou1tlt  octyd mDelu p;u0alenmf iatomt  ivols0sexrxr ny1olenlivsa(fsDtmu ont0aexo feilsfa2ea(mo;u)aexnio oytopt lnvil( texoio oydameemncsls srua(ront1tetnmiciasla2rl( s;()arxomr to1lp   u i;t0trxmim3nu4lpe miciat  Drax  ;t0opxn iciatfm2ulu s t)alerirciatlptrli sl(0 euoxo no1ome lfetls)aDtr(ro;u4olxnmo3ilt m ul( s (0 lxrir iytlp r i s s truoxr3io4ol emivtls) Dur(  ou0tpx  fciytfaDem( p t)trtrifcia1laDr i i;t0t2to(o3iydlpe miviasfsDumu  ;t4oet ifetadfmDemu sn(0tltomrciytlm   uvs t trxr(m3no1llt lfvtl(fsDraum ;u1altnmfeilsfa2ulnmpnt0aexrxf3ty1laD ai i (0 etr(r3oudllt mnctls)s2rmuroot4tpxo i3iat s rlump;() etoxrcoytoa  luvs;t)s2uo(r oudlleelfciat)sDrru ono0aee  o3iysla ulumsnt0tlxoxf ia1lmD luvolt s2uo(r3no1altn ies ()aDumxrooo4oeenioeils s em( pn(4trxnxf tytlmDelneo t0 rxrxmpnudlmt  netl( a2rrum ot4optn octydfa ra(msn(4arenircia1fa rlivilt0texmio3oy1aptelfetltf 2uaumo;o4tetnmo3ilsls elu o t4tlxnxf to1lmtr ivol(  exo(o oy1om nlicsls s2tr(roou0tle  feiaslaDrl( p;u4 lxomo iotomtr uvi;t0texr(opoodopte ieia(  Durum ot0apxnio3tytfsDrauvpnu)arxnif iodfp ranvo;s s2xmiopnydole mict t) rtr(m no0opeo octydfa2em(mo;t0 etnifcoatlmD ai o ( sexoio oudomt miesl() 2rm(mpoo0apen oeiyd a ranvo u4alerio3ia1om rlu o;( srtoio3iy1lm  lnci (fs2umxr ;t4teto o3tldlm2uanmo (0arerif ootfpteau i t0setrio oo4lptelfesa(  2rr(mp;o1oeeomicild aDum(mp t0 eenmrciytfmDranvo;t0 etr(o3oo4al nlfvt ( srum(  ot1optnmo3tadlaDrluvo;t0arxnmrciytfatrau i;t)t2uo(r ou4lpenlnci s)arrau pot1optn i3ils s rmnvs u)artrifcootom eanes (  2tm(opoy4llee fctlsfsDrru o;u0tpe mfeiatfm um(mont)tleoio io1lmteaiei (  rumir3iu1lmt miciatfsDtaxm nu4tlxn fciatfs eanvpn(4tltoir iadopD luvi;( sruo(r oudoptnmnvs t)a2uaxmono0tpenifetat a2rlnvp;t4alerif3oydomt aivo t) 2xo(o3iydoptemfeta() Dtrxr nt4alxomo3iatfaDrln s t)areoxr3tadlp eanvs;() rtrir nudll n ncsl(f ruaurpno0aeenmo3iytfa rlnmo t0trtoir3oadfp rluvol()trtmxr3ny1alenlnetas) rraum ot0texniietad m2rluvs;(4artrmf3tytfaD auvols0s2trxo3ny1amtelieil( sDuaumoot1ale miciyd mDeaumo ()trtrxr3ty1oatr uvs;(  exoiopio4am   fetatfaDuaxmo;t1aptoiictlsls elnvs u0 ltnmo3ootfm elieslt0setm(m3no4omtemietlt)a2rmu onu4tlto o3iasfmDul(vpnu)altrmocoo1fptrlieols s2xrxopoy1lpen fct s) 2taxmonu0opxn f3tyt s ranmp u0altoxr3iydlpDrlu o ( seumxm nudolt  fvtasfartrx p;u0alt  fctydfaDea(vs t4 lxoifciotomtrli i s0srxmir3ou4olenmici tfsDur( pno1oet  oetld m rmnms u)aetoxr3totlaD ln o;s0srxoxm oydoptelnvi (f 2um(moot0opx mo3ild m eanvs u4trermr3ia1lat anvi;(0s2xoir no4ll emneilt)a2rrx  ;t0alt mi3taslm2ul(mo u4trxnmrcto1omDrau s s0 2toxo3nydll emnes s srraxmono1oltoio3ildfs rmuvon(0tleoio3tydfmt lnvo t0s2uoio3iodlp n fct t)s2tmx pnt1oet  o3iysla2uauvsnt)arxnif3iy1lmte nvi;t0trtrir3ou1ap emfctltfsrrmxrono0aetnifciyt s2rl( s t)tlxoircoytfpDrlies;(  rxo(mpnydamtemfvi () Dum(rooo4ope ioeiat a2emu p;u0trtrmr3oo1fat livo (0teuoxm nydamtemici (farrmuroou0ole  ociltfs rau s (0alenif ta1oa raivo;s  etr(mpio1om e net (f Dtaxmo;u4olt  ociad m ulnvp;u0tltnxf tytop eluvolt)s2um(o oo4lpen neil(faruauro;u0aeen i3iytfaDeauvo u4tetnif iytfp  livils)trumxr oodlpenlncslt a2umu oou1opeomociasfm2uaumo u)aetrifctydlp   ieo;(  ruoio no1opt  fvil(f ruaxmp;o4oexoiieiysfs um(vsnu0aetrif oo1lmDrlueo (0t2uoxm3oodape mnetas  Dtaur nt1tetomiciydfmDul( p t4altnxr3iatfat  nei t0s2xm(r3ou4apt lfesa(  Durx  ;o0opxnioetls mDum( pn()trxomrcoodfm ean olt s2xmiopoodomeemfvi t aDta( ooo4apx iietadlm2em(vpnt4 etrxrcto1omDeaies;( s2tr(r3nu1aptelfvt (f Durxmonu0olx  octytfsDea(vp;u) rtrirctatfaDr ies;t)t2tmio oo1op  miesl(f 2ta(m nu0tptniocils m2rmnvp;(0 eeoif iy1fm  lieslt0 2xo(opnodaptemiviat)srtmxm no4oee mf3ild aDem(vo t4tlxoxociydfpDrlu i;t  etoim3oo4ape  ivsa() rumxmp;t4ale  feiltlm rlums (4tlerir iodfa eanvs s  etrxm ny1oltemfvsa()a2rau o;t4texn fciysfa2rl( o;() rxnif to1oaDrau ils t2toxrpio1am elnvi s  2rrurpno4teeoiietyt aDemump u0aeeoio iodfm   nei;s s2tmim3oodoltn ncil()srum( oot4aptn f3iyt m2eaumsnu0 ltrmr tytlaDr nes;( srtmxrpoodop n neilsf 2uaxmp;u1aet iieiadlmDelu on(0aetomrctodfaDran s;t  rtm(o3no4lp n nvsls a2umx onu0tlenmoeiatlm ran o t4 rtrxo ootlat liei s teurxo3iodap n neta() 2umxrpno1alxnioctasls ea(vo;u0teenxo3iy1lmte i i ( sexmirpiydlmtnlfes s)s2ururp;t1teenmoeildfa rl(vo;()arerxr ta1fatrlneo;s0truoxo oydaptn nvtl()aDuaxmo;u0alenif3iydfmDuln snt4tetoxo oodop eanvsls teurir oodllt lncslt  rraxro;t0altomo3iaslm em( s;t)tltrif3iytoa elnvo;t0 rto(r3io4ol elnetat artm(m oo1oee  ieiaslaDrmump (4tltomr3tydfatrlu o;s0truo(r ny4omee nvil()s2urur ;o4aex ifcilsfs2rl(ms t4tetrir3tadlp  ln s t)trxoir iudlme mieiltfaDtrxrpnt0olxnmociyt a2eaump t0arxrirctytlmtran slt sruo(rpio4op nmnesls aDraur ;u0alxnmietas m uaumont0teenxo3oodopteauvs;t s2xmxo oudoltnlicia(f Drmxr ;u1aexniieild a2umumpnu4trtoiocoy1fpDrln s ( texrxrpoo4omtelneta(farra(  ;t1oltnioetysfmDua(vo u0trxrifcto1omDelu sls)srtrxopou1omtelieslt) 2raxrp;o4apxoiiciyd mDeanms u0teeoio3iatopDranvi t0 exoir3oy4amenlicta()s2tmuronu4tex moctysfa2ulu pn(0tltnirciotlaDeli o;s s2xriopio1alenmfci (fa2rmu ooo4tlx  feiasfs2rmnvo;(4 eenxocoo1optr i slt0trto(o iy1altnmict tfa2urur ot1oetnmi3tld sDuluvs;u)altrioctytoate i sl( t2umim oy4op nmneiat s2trxmpno1aetoioetatfs2el( o u4 etomr iotfptraiei s srumir3oo1lptn fcsas) Dumu  ;t0tee mociydfs2eaump t)tlxrxo tatlm rauvi t t2umxrpny1ap elncias  Dtrurp;o0aptomf3tytfmDraump;u4 reomocoo1faDelivi t  exrxo no1ap  mfet t sDrrxr no0tltnii3iyt s2emuvp;t4areomr todfpte ivo s sexrxopiu4omen feslsfsDum(mont1tptnifciltlsDrluvpnt4tlxnmf iotoa  aiei ( t2toxopnudal nlfcsas)sDraum ;u4aleo o3iat aDea(mont0areoxf oydfaDean ol(0t2urxo ny4opeemnctas  2rm(  nu0ope if3ilt mDelnvpnt)arxrifciadfmDeauvs ()srtmxopnu4lle mfci s srrmx pot1tlt ifeiltfsDumu p t4 reoxo3oadfmt  nvslt texo(r ou4omt  ncsa(fs2raurpou1oet  ieiadfaDua(mp;t0areoxrctodlp  lueo;t)trtmim iydll n nvs (f Drr(  nu1aexnii3iadls rauvsn()teerif3iodom raues t0s2tr(r3oo4ome lnesatf Durumoot0aee ii3tlslmDulnmonu0tetrxocoa1om r n s;t0s2tm(mpnu4lm  lncs s artm(r ou1teeomociytlm2eau s (0trxrxr oadoa eauvo;(0setoio3nydoleemncsatf 2ra(mooo0alx  i3ias s ean s u4 rtnxr oa1fmtr i ol(0 rtmxr3io1lm  lneta(  Dtaxm nt4oet  oeiaslsDulnmo;u0artnmr oa1omt  u sls)texo(o3iudopt mfvs s srrmum ;o4olxniociysfa2ean pnu0 exnxr3oa1fptrluei;(  exmxr oodopee nesls  2urx pnt4oleoif3iysfmDrlnvs t)tlxomocta1lp e u slt  rxmio nu1apt mnci t artru  ;t0ole ii3iatla2rlump (0texnio ty1fmt anvols)t2xr(rpoo4lp  mneslt)s2trx pno1opxnmo3iyslmDrlums (0 rtoif ia1oaDelneolt  exoimpiodam  lnetas)artru pnt1oleomfeiatfs2eanmp;u4aetrxrciy1la eau o;s)sruoim io1ap e fcslt) 2uru pnu4optnmfctas a ul(mp;(4tltnmfciytlat auvol(  2uo(o io4lmt mnetat)sDrau pno1apto o3tatfa rlu p t0 ltoir3to1omt an ol(0tetrxr iu1lltnlictltfs2rr(rpnu4aeen i3ils s2uan p t4tltnxfcootfm r nei ( s2trxrpoodameemfei (  rumur ot4apeomietlslaDem(vo;t4trtrircoydomDrln s t0 rtriopnydap e fct sfarrmu ono4tle iociysfa2um(vo u0 rxoircia1opDraiesls0texrxm3iy1aptnlivtl() Drmx  ;o1tex ifetysfa ulnvs;u)trtnircoy1opD  nvs ( tetmxr ny4apenmncsls a2tr(monu0oetomoeiytlm ea( o;u4trxrxrciatlatr u i s) 2to(rpnu4lmt  fct ()aDtr( ont4alxomfeiad m um(vp;u0arxnmo tydlpt auvi;t s2urim no1lltnmivias) Drm(rpnt4olx iociad a rl(mont4tlxrmr3tydfa  lu i;s) 2xr(o ou4om n fvslt  2trxmoou4aptnmfctysls2eau p () eenio3oadoa elieslt0srxm(opiy4lm e net s)aDtrx  nu1opxnifctyt m2rauvs;(0tleomf to1lpD an ols)t2tmxrpny1ap n nctlsfs2um( pno4tpx  fctadfm ea(vpnu4aetrif3to1fp ranvi ()sruoiopny1am  mivs ( s2ra( pot4tptnmictysla ra(vp u0altrxr oo1fmt  iei (0s2tr(o3oy1ol  lici s arum(m oo0alenii3ils s2uanmsn(0tlermo3todfaDr nvilt)trurxo oo1amtemieils  Duru pno1texomo3iatfmDuanvs t)trtoiocoodfaDrlivilt trxoim oodlptnmnvsat  rra(rp;u0aeeo f3tadls2umnmsnt0tlenxr3oo1lmteluvi;s srtmio3nudlpen iviat)srtr(mpnu1olto oeiadfm2elumonu)trenxr iydlpD lnvslt) exmir iy4ame lict t  rrm(m ou4aptnii3iatfm2em(vp;u4 exrircootoptraues t) 2urxmpnydom elnvta(  2um(mpnu0tlxn feiltlm2eaump u) reoio oytlpDran o;s)setm(r3ny1lp e fesltfaDrr(rpno4optomiciltfmDel( snt) exnmfcoytfa ranei s0 exrxo3no1lleelics t s2rax  oo1teeoifctld sDel(mo t0 rtoircoodop  auvils0texo(rpoy4lptnmnet ( arur(m no4alto f3ilsfaDrmu snu4 rerxf3iydop elu olt  rxoio iu4ameelfviltfsrra(  ;t0tet  f3tlt mDrl(mont4 eenio tatomtrlu i t) ruo(opiy1apt  fes t)s2ra(ro;t1tetomfeiatfa elnvsnu4alxoxo3iydlaDean i;s0seuo(o3iudolte fvtlt a2raum ;o1aet if3tyd mDrauvp;u)arxrxfcoo1fp r i ils s2xm(o oo1apeemictls s2ra(  ot4texo oetldlsDeln p (4 rermf iotla eau s t0s2urxo3io4lpteliesls)aDtr( ono0alx  ietatfaDra(von()areomo3tydlp   nes s) 2xoimpiu4ll elnvslsfartmxm no1aex mociatfaDeau pnu0aexrmf iydopD  nes;( trxrxmpny1om nlnes tfsrtr( p;u4aeenmociys mDem(vont)trerif3tydopDelneo;t)teur(r oo1al e fcs s srtm(moou4aet mfeildfm2um(mon(0 eerir ta1fmtraieo t)t2toim nu4ol n feias arraxr oo1apen ictldfs uln s u4 rxoxr tytfm eli i (0seumxopiy4ape lnvta()s2rr(ro;o1tlxoiociyd m rauvp (4texnxf oytlm   iei t trumxo3ny4lptnmfeias)sDurum ;u0tpeoioctytfmDeanvp u0 rtrxf3oa1latelueolt  rxm(mpoodlpee fct s aDuaumoou4olto icilsfsDua( p;u) etomo3oo1fp  luei;t) 2xriopoy4omeeliet tfsDtrum oo1aeeoifciatfs eluvs;u0 etnxf to1fpDeanes;t0 2xo(o3ou1llenmnet s a2um(roou1opto octat s eln s;()texrmrctodfm  li o;s) eurio iudoptnlicilt)a2rrur ot1open f3ilsla2em(mo;()tlxrio3tadlateai s s)s2trxo io4omt miei t a2rrump;u4openmieiys sDulumsn() rermf oytopDrln i;(0seurio3nydamtemfvtls) rum(r ot1altnioeiadfs um( s;u0 leoio io1om  livo;(  2xmimpiudlmt livs s  Duaxm no0aexoiiciltlm2el(mp (4trtnxocoytlmt aueolt0seuo(o3nudap n ietl(fartmx  nt4tpe mf3tydfa2um(vpnt)aetnmo tadfaDrlneo t t2xmxr3oo4ll  mivslt arur(ro;o0alxnmfctlt aDem(vo;t)aleoxr iadfaD anvi t) rur(o3iy4oltelncslt srumxro;u0oeto octad sDuluvs u0artomocta1lp  lnvo;s) rur(r iydal emfvias)srrau  nt4tle iictys aDra(vo (4tetrif todlpteliei s0 euoxopnu1omen ncta()s2umum ;t0oltoioctad s2rm(vp t0 etrxr oy1fpteaneo (  rtrir3iu1al   nvtatfarurx onu1ale  icildls ulu o t0tltnxf3ta1opDrlivi s t2uoxr ny1optnmfcsa()sDur(mo;o0texnmociyt aDrmnvp;t0texoir tatopDraies;t0tetrirpnu1ope lnviatfarraumpno0olxo ietasfa2ea( o;(4tlxoir3totoaD auvo (0t2toxr nodlpeemicsatfartrur no4tpxoifciytla2ua(monu0 rtrmf3oa1fm rlneo;t  exrio iu4alenmnvtlsfsrua(mont4tptnifetaslmDulnvp u4trtomfcoatomtr ivo t srxoxo iudlltnlivilt)a2tm(rpnu0opt  feiasfaDuanmsnt0 lerxr iadlp raneo;t)trxo(o3oudolt  ietas)aDurx  no0aexn f3iatla2rl(ms t0texnmrciadlm r i o;s seurxm iu1lm emfeils s2tm( ooo4ope ioetltfm2eau o;t0tetnxociy1fmt  ueol() eto(rpnu1ap elnet s)sruau p;t0tpx ifctysla ua(monu0arxnxo oatfpt lues t)teur(r3iy4lpeelnctls sDua(mpnu0tlen ociydfm ul(vp u0trtrmr iodlmDrli ilt)t2xmir3oudamee fcils aDrrum ot0opxnmo3tldfm2umn pnt0 etnxrciy1fpDrau ilt0 ruoimpoodlpt livsa(f Draxrpnt4aptomociadlm ranms () etrmf3iydfatrln i ()trumxr3iy4lme  ieta()sDtrx  ;t1tltnmoeiasfa2eanms;u0 etnifctadlaD anvi;(  rumir iu4lpeemnet t)sDtr(  ;u1tpe mo3tlsfs2rmnms u4 lxomrcoodlmtran s ()teuoirpno1aptnlnetas  rrm( oou1tex mfeiatfm2ulums;u4alxoxrciadlmt  u s ( texoxrpnudopt  fviltf rumxro;u1texomiciadls2eaumo;u)arerxfcoa1omDe ivils seur(rpiudam e ietas)sDurur ot4aleo feildlsDran pnu4arxnmo totfpte ies t0s2ur(rpny1lme livsl( arurxrp;o4texoii3ildlm2em(ms t0teerxf tytom r u o;s)tetrxo nudalt lnvtat)a2ua(r no0apxnmieiadfaDel(vont0altnio iydlatran sls)trtmim nu1aptnmfviltf 2urum ;t0alxnmoetldls2rl(mont4tltriociadfp  aueil()texmxr3oudap n fesat)a2ua( pou1aexomfciasla2el(vont4 rermo io1fm rauesl( s2to(rpnodap  lici ()srtrxr ou1opt  iciydls um(mp;u)areoxf3iotop   neo;t) 2tm(o3iy4amtnlieiasfartmurpnt1opx moeiadfm ul(vp t4arxoio iotoat lueilt srxr(opny1lpeemfesas srtrxr ot0aet mocilt a rlumpn(4trxrmrciytlatr uvs;s) exoxmpoy1llee ies t sDrrumpot4optn fciat mDemnms (0tlenif oo1oaDr n slt)s2toxm iu4ame  icsat) Dururpot1oeenio3iadfa2rau p;u) rxnif3oy1lpDeluvsls)setr(o3io1aptnlieia()a2rrxr nu4tlxomfcilsla ul(mp t0arxoxf tadlmt au sl(0texrio oo4olee net (  rtmx ooo1aptnmicilt mDuauvp;u4alenifciydlaD aneil( trumxr3iu1ll  livia() 2ur(m ;u0aptnmociysfm ulump;u)aetriocoytopD an i;()trtoxo iu4olenlicta()sDtax  nu0tptomi3tadlaDum( o t0aeenmr3tadlpDraieil(0sruo(r no4ale  iesls) rta(rpno4apeniieils a uau p;u4arxnxr3ty1fpDelneils srtr(m nydolte nei sfaDrrx  ;o0ole mf3ilt s2um( s t0tetrxo ia1fp elueo t)trtoio3nudom e fci tfs2tr(ro;u4oexoio3iadfm uanvo (0arxoircto1lmD  uei ()truo(m3iu1llte fci (f Duau pou1apxn o3iysfsDrmnmo t4aeeoxfcoadoatrln ols)sexriopio4oleeliesl() Drr(ront0tee ifciytfm rau o;(0trtrioctydfptrlivilt0trxmxr3ou1olenmfetltfaDurxm ou4alxoifeiys s2um(vs;(0aetnxf iadom raivs t0sexrxrpou1lm n iet t  rta(r ;o4olenmi3iytla ulnvp u) lxoxo3oatop r ieols)t2umxr oy1ap nmnvt t srum(m ou1opeoif3tldfm2uln pnu4tleomr3iodfa  lu o;s)s2xoimpny1lle mictat a2um(mooo0oex  i3tysfa eanmsnu0tleoxr3totfmDe nvo (  rurxmpoy4lmt mfvtat  Drru oou1tptn ieiasfsDelnvp t4 rermf oatfmD aivo;s) exmxr nu1oltemfeilt arta(ro;o1tex mfeils s uln snt) eerxrcoydlm   uvsls)s2xoio iudlleelnci tfaDtaum nu4tpx iocias a2emu snu4tltoxf tytfpt au i;s0 exrxmpoy4lltnlieslsfarumx pou4olxo iciydlm ulnvp;t4arerxf3iodopDeai s t0 exoirpiy4ol n ivtlt sDurx p;u4apx  oeiad a ul( o u0artrmr3oodlat  nvi;(  eto(m iu4lm emfesat sDuaur ;o4optn fcildlsDulu sn(4tlxoxf3ty1opDelivil( sexoxr3iudlp  mfct s) 2tau p;t1oleoiiciyd a2ua(mpn(4altriocta1fpte uvi t) exoxrpoodll nlfvsasfsrrmu ooo4olxn f3iysfs2uau s t4 rxoiocoatfmD aueol()t2umio oodap nmfei s aDtmu ooo1oeeomfciysfm2el(ms;t0aetnmfctatlmD ln slt0texoxo nodlmen ncs t)artax p;u0oeenmoctat s2uan o u4aetomocoo1la ranvilt0 rxoxrpoy4alee fcia(  2ur(moou1oeenmo3iltla2uan p u4 lerif oytfmDr uvo;s)trxm(mpnydale  nctls a2ua(r ;u4optoiieils m eau s u4 rtnmr oatfa  li i t)seuoio no1ap nmncil()aDtax poo1tptomictytlsDum(vs;t0 exrio3todlp ran o;s)t2uo(m3iy4ape lnviat)a2rmuroot0openmf3ildfs emump;u4aetrxf3oodfm   u ol( srxoxm3nydol elieil( aDra(m ;o0oeenif3tydlmDranms;t)aexoxocia1fateauvols)srxoxo3nudlp   nvils  Draxro;u1olxo f3tydfsDrmumo;t0 etoircoa1fmD anvilt0t2urir3oy4apt  ivt t)srtmxr ou4aetn ociytfsDeau o;u) rxnif3iy1lptran slt t2tmim io1lltelieta() Dumu p;t1tle  f3tat aDelu pnt4aeenmfcta1fpDeaivo;t)texrxmpoy4lme mnvtatf 2uau pot0aexnmi3ilsfs2emumsnt)artnxr ta1opt li i;(0texrxmpio1omte fci tfarrrum ;t1tltnio3ias m ulums ()teenxf ootomDraies;s)s2urxrpoy4omen ietl(faDumx p;u0tlxnmociydlaDrlnvs;(4 rxrmr3iotopDe ieol( seumxr no1oltn icsa(fsDumxr nu0ape iietaslm2ulnms (4trenmf totfp eluvo t t2xrxmpny4ale  fvt t)aDrmxr no4oltoioeild s ua(vsn()texriocia1lmDrlnesl(0t2toxo iydllenmfetlt)s2urxrp;u1aexoifciatfsDrm( p;u4 exrir io1oat lnvol()seuo(r3oudllte fet (f 2rmxmooo4teenmf3iad a ulu s u0aeenmr3oa1lm elues;t)t2urirpiy4omenmncs tfsDraxrpot0tpx mieilt aDrl( o (0arenxf ty1lm  lnvol(0 2uo(opoo4om   fcilsfsDtmxrpou
\ No newline at end of file
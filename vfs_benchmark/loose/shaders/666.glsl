@@ -0,0 +1 @@
+ueols0t2urxo nydomenlfviat aDrrxmonu0oltniictat aDrlu o u4tlxrifctadop r u i t) 2ur(m3iydamtemneiatfaDumuroou0oexoiieiatfs2ranvs;u0 rerirciydopt auei s  exrim3nu4lmtnlfcia(  2taxmpno4tlx  f3ildfm2rmnvp t0trtnxocoadfmte ivo;(  euo(m oo1al emivtasf 2urumooo1apt ifetydla ulumsnt0aleoircio1optrlues t teuoim3nu1ape lfvt tfsDumxmp;o1oltnii3iadls umnms t)tltoif3oytlate ieils texmir3oy1op e ies s)s2rrumpnt1tlt mi3iysfs2ulnvo () lermr3oatfmteaieolt  2uoxo3io4am  livia() rur(mp;t1olt  f3iaslmDul( sn(0aetrirciodlmt lu i s teum(mpnydap   ieias  Dur(r nu1tlxniocils m2ua(vp (0 lxrxfciytoatean o ()srtrim ny1altnlivtlt  rraur ou1tltoiicildfm2umn s t)tlxnifcootfatr n i () etoim3iydamtemictlsfsrur(r nu1aeeo oeiys a2rmn o u0 exnxocoadfa rai i s0 rumio iu4al   fcs ( aDra(  nu0tpe ii3iatfs2uln snu4 renmf3tatfat lnvo;( srurio iodome mfcsat a2tr(ront0olxn fetaslsDeaumsnu4altnmrcoydfaDeaivo;s0s2xoim nydoltelfvt t)aDrmur ot4tltoiietltlm rln p;(4 rxoio3tytfp   nvilt)trxmim3iy4op nlfei s) 2tmxmono1aptomfeilt aDum( snu0 ltnmf3iytlm rliei;s  rtmio iy4lpe  ieia()srtr(rpoo0oexoio3tadfsDem(vs;()tetrxf oydfa ean i;s  euoxr no4lltnmfvsls s2tm(roou1aexo iciltla2umnvp;t0aeeoifciotlmDr nvs;(  2toirpio4omeemnvtlsfaDua(r nt4tptomociytfa el(vpn()aexrxocty1fmDrai ils t2xm(opnydape lnetls aDtmumo;u0tex  ieiat sDemnvp;u0altrxr3tydfmt ln o s0 rxoiopoodlpt mici s  Dtrumo;u1openmo3ildfsDeluvs;t0texomf3iy1latr ivsl()t2xr(mpiu4ame  ietatf rtm(root0alxoio3ilsfs2ua(mp u0texniocootoa eaivi;t) rtoirpio4lmeelieta( sDrmumo;o1apx mf3iadls2uanvp;(4tetoirciodfmD aies;t)s2tm(rpoy4lpenlfcsas)a2urx  nu4tee  ieild s2emnvo;t0alxoxoctatlp eauvilt sexmiopoy1ol nmfvil(fsrtru poo1olx ifeiltlm em(ms;t0texoir3iadoa e ueols srur(r3no1omeelnes t  2rr(  nu0aptomociydfs2ulnmp (4 eerxociydomt aueil( trto(o oudamt mivt t) 2urxroot0opxnmfctlsfsDulump;t4altnxoctatlpDeli sl( s2xmxo3nu4ape  ici tf 2tmxmpno1tpenifciytfm2ra(ms (0 rtrxo oadomt lnes;s0 2uoiopnu4lmtelfvt t s2umu  ot1olxo oeiytfs2ua(mp u4 lerxfcto1lpteau o;s s2urir no1opte nvtl( aDrmxrpoo1aex  oeias a em( o;t0aeenxf3tadoat  i s s) 2xrxr3iudameelnes sf rrmurpnt1tpx mocias m el(mp;()tlxoif3iadfptean o;t) etmxopoy4lme lnvta()a2ururoot1tltnii3tad a em( p u0 reoxr ta1lp  lieslt0 2to(o3no4am   fvsat)aDraxrono1aetnif3iasfmDelu p;u4trtrmo3oatlatelnes s0trxo(o3no1ap nmnvtl(faDurumo;u0teeomietytlaDua(vo t4aeeoxocoytlaDranvi;t) 2to(opiodameelfcsl(  Drruro;u0olxo feiydla umnms;u0aeeoxr3ia1oaDranvsls) ruoio3no4am emncsls aDumxmpoo4oeeoioctyt a2emnvp;u)tlenxociadlpte ivs;t setoxmpnydoptnmncta( arrau  nu1tpx  f3tadlsDulnmp;t0 rxnio3to1la rlu ils) etmxr3ny1amtnmiet s)aDuax p;o1texoiicild m2emn snu)areomocoo1oaDeaieslt  eumxrpio4lp elfvtl(f rurumono4alt if3iadlsDuln snu0aexnmo3oy1oa eaneo t trxrxm iu1omen icta( s2ta(rp;u1tpeo ieiatfa2rlu snu) ltoxrcio1omD  nvolt0t2uo(opiu1altnlneslt s2rm( p;o0oleoiociatls2umu s;u) eenxf iatfm rai sls)s2urim3iudaptnlnct t sDrmxmp;o0tpxn o3ildfmDrl( p;u)trtoxfcoa1fmt au s t0 rtr(o iydamtnlfvilt)sDtmum no4alxn o3iyt mDemuvo;u4 ltoxr iadlateli i (0s2ur(m3iu4ap elici ()sDra(m ;u1alt mfeiltfs2umnms t0artnxr ootlm  an o t0trtmxmpoo4lm n fvsl(faDur(  no1tlxn o3iadlm2rmnmo ()teeoif3tatfa   neo;(0setrim ny4lpt  iviat  rtmump;o1aet iociytls ul(vp t4 leoir oo1laDrlueo t t2urimpoodlp nlivta(fartrxmpno4tlx ifciatlsDulnvs;(4 lxrio3tadomD au olt0sexoxm3no1lm nlivi (faDta(mpnt4ole moeias mDem( s;t)trtnxo3oa1lpte ivo s sexrxmpoodome  ies () 2rmxrono4oleo i3ilslaDelums u)areoxf3oadom r neilt0 rtoxr nydlmtn nctltf rrmxro;o4oexoif3tytla2ulu p u0 renxoctydfm  auvo (  rxmxo3oodomeelncsat) Dta(  oo1tpeo ieiysfm2rlnvon(0artnxf3iadfa   iei;(0trtrxopoy4lle mneta(f Dtaur ot1oexn o3tld a rln o u4 ltomocoo1fa e n i;t sexmxo3oydopte netlsfaDtmu  ot1oltoii3tyt s rlnvsnu0tleoir3todlptelu ils  exo(r no4aptn fetatfs2tr( oot1optnmi3iytlm2ua(monu0trtrmf io1laD ln s s srxoxr ou1aptelnvt t)aDtr(ront0tpe  fetatfm ulnmp;(0areoio3iadop r u i;s0texrxm ou1ole  nvia(fa2urx oot1olxnmietlslsDuanvo;t4 ltoiocoytfpDe neilt0s2um(o3oodap e feils) 2rr(ro;t0tlx mictad a ulnmsnt4 exoxfciotlm   uvi;(0seto(r ny1lpeemnvias  Dtrxrpoo4apxo o3iltls2ea( snt0 ltrir3ootfpD lu ols0t2tmxopnu4aptnlicsls sDrrxmo;o0tlen ietld s2ul( p;t) ltomocty1lpDe nvols t2xm(mpnudlleemnvt ()a2tau ont4opto ictltfs ua( snu0texnmrcoydlmtrlueo ()teurxopnudll  licsl()s2umump;o0oltomiciatfa2el(mo;u4altnxo3iytfaD aivo t0 2xoxo nu1aptnlfvsas)aruaxmo;t1tex io3iyd s elums t0aexrmrciatlp elnvo s)trtmio oudol elnvi ()s2umxr ;u1oet  oetls m rauvs t)tltnxfcta1lpt  i o;()texmxo oudomenlfct s srrm( p;o0tex ifcildls2ulnmo () etrmo oadlmDr ues (0 rumxr3ou4omtemicsl(fsrtm(  ;u4olt mocilslsDrlu o t) renxfcoy1lm r nes s t2toxm iu1lmt lici s) 2tmur oo4oeto i3iytlaDea(mon(0 eeoxocoydfm   iei;s setmxr3iy4oltnliei t  Dtmx poo1tpe  feilsfmDrm(mp;(4aetomrcoodoaD  ues;s)sexmxmpio4lmen ict tf rua( ono4apxomicilt s2rlums t0 rxoif oatopte ueol(0seto(r iodop nlfcil()arrru ont4tpxn i3tldla rmn sn() ltrxo3ootom   nvs;s) 2tr(m oodam nlnctas arrm(m ;u4tpxnmfciltfa2rl( s;t4tltriocoo1lp  lnei t trxoir ou1oltnlfeiat)srtrx pou4opxnio3ild a2el( on()tlxrif3oytlpDe i o (0sexoxo nu4oltnlncia(f Dtru  ot4alxn ociys m2rmnms;u4 ltomr iydlm   nvo s0 exoxm3oy1amteliet s sDraur ;u1alx  feiad a rl(ms;t) etrmfctodoatr ivsl(0srtrxmpoodap elnctas aDta( p;t4aetn f3iatfm2ulu pnu4 lenxfcta1lmD  n ilt t2umxr ou1ap elnvt (faDuau  oo1apx mfctlsfm2rlnvsnu) exnircta1fm eauvsl( t2uoxo3oydape licslt) Dtax ont1apxniicilt m2uluvo;u0 exrxo tadfp eaieo;t s2toir oo4lm elfvtat a2tau  ;o4tlt ii3iasfs2uanmonu) rerir3to1omte nei;s0sexm(rpny4lmee iei s  rraxr ;u1aeto ieilsfm eln on()aetnifciy1la raiei t)texoiopiy1am n nei () Dua(r nt4tle moeiltlsDumuvo u) etoiocoa1lm  aivils t2tm(r3nu1optn fcil() Dum(mpno1texnii3ild aDrlums;t)arxrxr tadfa eaiei;t0s2trir ny4alen net ()a2raxronu0olt  f3iltls em( on(0artrmr3ia1fp ranes;s)trtr(o3io4ap e fvil( arum(r ou0apt mieildfa ra( snu4teenmo oydfm ranesl(0srto(o iu4amt lnetlsf 2urxmooo1oet  ociadfmDea(vo;u4 leoxr3tatlaD  u i;t)sexm(opiy4lptelfetat) rumx  ot1tetnioeiaslm2eluvs;u0 rxrif tadlptrlivi (  eurio no1lp elneilsfsrraumoot0alt ifciyt mDeauvo;u0aexrmr3oadlpDranvilt s2urxopny1al e fcils srur( ooo0olxomi3iat sDranvo;(4 lenifciadomD  uvi;t)setmir3oy4lptemfvtls  Dra(rp;o0tlxoiietadfm2ran sn(4tlxrxr tadlm r ies;t)s2uoim3iudlm nmieia( aDumxmpoo1opxomietaslm2umn s t)aetoxo3tydfmtelnei;t)truoio3iu4ap e fvsls arurump;t4oee  o3iadfm2rln p ()arxrxrciy1la  lu i;(  etr(o io1om emfcsltfa2um(r oo0oee  ieilt m2em( sn()tetomf3ty1lp rau sl(0 2trir nodlleemfeiasf rtmxmp;o1alto iciatla2rlnvpnt4 leoif iy1fpte n o t)s2uoir oydamtn iet t)arurur ot4tpeomfeiasfs2umuvs (0trtrxrctotlaDeaiesl() euoim3oo4lmee nvsa()aDtrx  no4tpenmociat s uanvp;u0alxrmf3ootopD lnvs ()t2um(r3ou1omtn fvsl(  Drm(ront4aeto fciytlaDel(mont0 rtrmo3iatlptean ol(  eumxr iu1ll emicsl()s2umxrp;o1tltnmo3iatfsDelu pn(4 lenxo3oatoat  u s t)t2toxr3iy4lptemies (fartmu p;o1aeeniicilt a rlnmp t)arxomo3totom r i slt0 rtrxr oodolt lfctl() 2ua(m ot0tlenmf3tld sDeaumo u) lxrxf iy1fp elnei s texr(r oodomt mnvtasf 2rmumo;u1oeeomietlt a2el(mo t4 renxo tydlp rlnvolt0trtm(o3oudop   nvt t srum(mpoo4oetn i3iltfaDeanmpnu0treoxr3oatlpt lues;t0 2xrirpiu4ole lfvia( s2tmur no4tlx if3tlsfsDuaumsnu) lxrxf tadlmDr i il(0srxr(r iydlltemiet sfsrtru ooo4apx mfcildlaDuaump t)artoif3oytla e n i ( texm(m3iudlpenlfvtatfsDrr( o;t4olx mi3iatlsDra( o t0tetoxr3iytopt  u i;s srtmxm nydlltnmivils)s2rm(monu4apxoiieias a2ulnvo ()alxoxf todfaD auvi;()teuo(m3iudlpenlncia(  rumx p;t4alenmfeiaslsDeanmpnt0 rxoxrcia1fa  lu s (0t2xoxopoo1omtnlfesltf 2uaur ;u1oltn ieildfm2ulnmo u)aexrxr ia1fa  luvo ()truo(o3nu4apee ivsat) Durxm ou4texniociad a2eln p;u0 exoxf3todfpteaivolt setmxr3oydllenlnesa( s2taurpno4olxoioctas a2emu s u4trermo3tadfmDe ivi (0 rxmxo3no4ll nmnvi (f rum(m ou1texn ictys sDrlu sn()trenxrciytfate nvsls t2uo(opio4am  mnei ( sDrrxm ;u1tltomfcias m2rmums () lenmr3iodlatran s s  2xmimpoo1amt mnctlt) 2ur(ront1oleoioeilslm2uluvsn(4tlxrxfcta1lateau o;t  rtoiopou4lp emfvils)s2rm(  nt0apx mo3iltlm elu p u4 rxrio tadoaDrlies;()seto(rpoy1apte iei t s2umxro;u4altoiieiyt aDrmuvp;u0texrifciydfm r u sls0 eum(o oodapenmictlsfaDraxmo;o4ole mf3tlsfmDua(vs;t4tlermfctadfmDe nvi () 2tmim no4op   ivsat)arrrump;u1oleoiieiytlm umnvs t4 rtnxocoytlpt livo;()srxmxm oudomeelnesas srumumpno0tpxo icils m2rau o;t4 rtoio oatlmt auvsl(  etr(r nu4om n nes tfa2taur ;o1tlt mfeiadls2umump;u0altrxr io1op eanvo s)teurir oodlp  mnet tfs2tmumonu1apenmo3iasla emuvo u4texnmo3ty1fmDr neilt) rtm(opoydome  fvtat) 2rmx  ou0olto o3iys mDraumo t0arxnmr3oa1fmt aneils s2xr(r oy1lmtnlfcsat)srraxrono1aexnioetytlaDemnvp (0arxoirctatfaDrau olt  euo(rpiodolen fvt t  Duau oot4texnii3ilsfmDemn o (4 lenmo3oa1laD  uvils)sruriopiy1optn ieslsf 2tr(  ;o1tee moctltfs uaumo u0tltrmrciytlp   nvo t0 rtm(opnydlptemfcils a2tr(mp;o1oex mi3tlt s ea(ms;u4tltrxo3oydop e uei s s2uoxrpoodllt mncias)sDrmu poo0tee if3iadfaDuan s;(4arenmrcoodfmDrlu s;t0 rto(opnu1lme mnes (faDua( o;t1aeen f3ias sDrm(vpnt4trenmo ty1laDranvi () exmxr nydlmtelnviltf rrmx poo0oltn ietysfm2eauvp;u4trxomocoo1fmDrau i t)seumxo iy4amen iei sf rtmump;o4opx ii3tadfm ua( o;t)aleniocootlatr ivs t)teuoio3iu4alte iesat  Dtm( pnt1altn fetas mDea(ms;t) rtoiocoa1fat au ils)texm(r3oy1altemfci t arrrx pno1tpxnii3tlsfmDulumpnt4aeenxr3totlatr iei;s) rtoio io1altelfei s arra(r ;t0tpeoiieiad a uanmsn()altrmo3oodlpD li s;( srurir iudolt  fvias aDtr(  ;t4tleo f3iatlm2ua( onu0tlenxr3ia1op elu s;s) exmxr nudlm  mietlsfa2rmxmont1tetnmoeiys sDuau p u0 ltrmf3oatlmtranvi s) euoio oo4al n fvtlt srrm( pnt1aexoio3tad m rauvo u4trxnir3iy1fatelu sl(  etrxmpio4ll emnvs sfs2uaumonu0opeo ieiaslmDemnvp (0aeerif oa1fm e nvs t)t2urxm oy4lptemici ()aDrmur ;t0tet  i3tlslm2rmu pnu4 exrirctydopt anes s)texmxm iy4lltemicslt)srrm(rpno0opt  feiys a2emnmo u)arxnmr3oodomDr uvs s trxm(m nydap emfvt s  2ur(  ;u1apeomf3iasfmDuauvpnu0arerxo iatfat ln i;s0s2toio3nudapeelfesat)srrrumpnt0apxnmoctytlm2ua( p (0 lermrciydlpDraues;s0t2umxm3io4lm nlfvsat)srumu  nu4alx  o3ildlm2umn pnt0altomrciytfmD anes;s texo(m3oudol nmncsa(f Duaurp;u0opt ifcils m2ul( o u0altnio oodlp rluvi s)sexr(o3iy4ame mivias aDtmxmpoo4apxniietadla eln o t)texomrciodlm r uvo () ruo(r oo4am elnvi (f Duaur ;t4oltnmfeiaslsDrauvp;t0 rxoxrcoydfpt  uei;s) etm(r3iu1aptnlnei sf 2trxr ;o4oeeomfetlsla2em(mo;()aexomo3ia1om  au s;t)s2tmir iy4altelnes (fa2tmurp;t1tlenmi3ilt m umuvo;t)alxnmf3tydfaD  neo (0 etrxopoydopeemfesa() 2rrxroot4alto f3iasla rau pnu0 ltrxo oo1faD  i s ( s2uoxo ny4ll emnetls sDtax  ot4open oeiad sDrm(mp ()altoxfcoo1lmDeluvs;( srumirpio4olee nvt ( sruaxm oo1tlxnii3tysla uluvs u0aleomrctatlpDraues ( t2to(rpoo4amt mivs s) Drruront4oeeoioeias s rmnvo (4 lerxf tydlp  au o ( s2xmio no1al n ietls)aDrr(m ou1ope  feiltla rlnmo;t)aeerif iydla  auvi t)setr(r3oy4lmeemnetls)a2rmxro;t1tpxo fctysfm ulumo;()tlxnmr iotfm elnvo;(0sexo(r oydamtnlneil(faDra(roou1oeeo o3iytls umu o t4treoirctytfateanvs;t) rxoxo oodlmtelfeiat  rtrxmp;u4oetn fcils s2rlu o () exoir todlmt lneo;()trtoxopoo1olt liesa(  rtaxrpoo1tpto f3iadla ran on(0tltrxocoo1lpt  neils0t2tmxr nodllenlnci (faDtau onu0tpxnmfetydlm2um( p;t)trtoio oodfmD li o ( srxoim nu4lpenliei t  rtaxmooo0altniictyd m ra( p;u4tetnxo3iy1latrlnei ( s2xmiopnu1lpenlfct t  Durumooo4tltn fetytfm2elnms;u)altnxr ta1fp eai il( srumirpno4olte nei ( sDur(ro;u0altoif3iadlmDum(ms t0 rtrmrciy1fateaues (  rtrio oydlp   ivi t) 2rr( oot4opx  ieiasls2umuvo t4altoxr3iydoateluvs t t2xmxr3iy1lp   fcsltf Dra(  ;u0oeenmieiydfm2el(mo u4tlxnif3iotom  anvs;s  2trirpiu4ole mfeia() rur(mono0olxoii3iatfa2ulu pn(4 ltnxf iatfa elu i;t) etr(r ny1lmtn ivslt  rrmxrp;o4olx mo3ildfsDranmpnu0tlenxo3iatomtr i olt  etoxr3oudlme lnvi (fa2ua(m no4tle moctls mDemnvp;()arxnio3oo1la rlnei;t)t2xmxm3io4llenmivi s s2umumpno0opxn oeiaslm2eau o u0 lxnxr3oadla rauei ( sexo(mpnodoleemivsas) Durumpou0altnmoeiadls2emuvp ()arxoxocty1omtr uvols tetoxrpoy4olenmfvia(f 2taum ou1alt ifciyd aDemnmo ()texomo ta1fpD lu i s)setmirpoo1amt  ict sfartr(rono4apenioetatfs2emnmo;u) lermfcoydla r u s;s teurxm oudole miesltfs2umuro;t0oex moetytfa2emums u0 lxnifciy1op  aieils) 2uoim3oudllteliesa(fsrumumpou4altnmo3iatlmDraums () leomo3tytfa rluvo;s)t2ur(rpoo1opeelfet t)aDuaxr oo1oet iieildfs2rlu ont0tltrir3oydlat  uei t0 eumxm oydomt miesa(fa2raxmpoo4ale  f3tyd s elu o;u)texnmf3oadfa ranvols setrir iydlmtelfci s) 2ua(moou1tlenif3tas a ra(vsnu4arxnmf todfat  i s;s  exrir3iy1lmtn feias sDra(mpoo0olenmo3iydfm2eanmsnu) lxrmf3tatom r uvs t tetr(o ou4op elfct ()srum(r oo0tlxomfetas a rm( p t0arerxocoytlp r u s (0sexoxm3iydlmen fcsl(fsrra(  nt1oet  fctadlsDrlu s u) eeoxo3tytfat lnvs s0teumio nu1ale lnvias) rtrxrpnt1oeto feiydls rlnms;t4teeoxoctotlm eaues t trtoxmpiu4omtelfvil(f Dum(m no1tee  ieils sDuau s (4artrmf3tydom rlu i;s0s2xrxo iudop   ieil(f Dtm(  ;t1olx ifeias s2uau o;u4 reoxoctadfa r uvs s) rur(opoodap nlici tfsrrruro;t0alxn feiysls2raumsnt0trtnxrcta1op ranei t)s2trxr3oy1omtnmics sf ruaxm ot0oeen oeildfs eluvs t4 rtoxfctadfmtr i o t0 2xo(m nodop nmivi sfsrra(rpot0opeoiiciat s eaumpn(0tlerio tydfpDe nvilt0 rtoxr nudap e nvslt)srraxm ou4apt mo3ildla ra(vs u4aeeoif iy1fpteanei s  2xm(m3oy1opee fcsltf rrru o;u0aetomi3iadfa2emuvonu)altrmociydop  li s;(  2xr(m3ou1om n ieiltfs2ua(rp;u0olx mf3ias sDrm( snt0aetoxrcoatlp e n i;()teum(opiodal nlnvsl(  rurx ont0tpto o3iasfm2elump u)aeenxrciadlptr uei s seurxmpoo1openmivt sf 2tmum oo0oetn fciytfsDrmnms ()tlxrxocto1fm  lueols) etr(r iodll n nct s  rra(mp;u1tpenmf3iltlm2ulnvp u4altnxfctatoaDelueils srtoxr3no1al  livias) rtmuronu4olt  octadfa2uln snu4tlxnio3totlmteaneil() exoir3ou1lptelfvsl(fsDra(mp;t4tpeo ociydlaDul(mp;()aexoxr3to1opDe u o;s0srtrxm oo4optemfeils a2rmurpou4aeen ocilslsDelnmo;u4tleoxf ia1opD lnes;t)t2toim nudlm nlics s  Dtaxm ot4oexniociysfa2el(von(4trtoxocoydomteluvo;( t2xr(r ou4lp  mfvt (fsruru ono0tpxn icild a rln s u)arxnxfcoo1oaDrlieol( t2xr(o ny4lltemfeil(  2tauroot1tpxnmietadfa2emnvsnt4arxrmr3ty1fpD lueslt trto(m3nydoptemicilsf 2urxm ;o0tpenmfeiys m2eanmsn() rerxr oydlpDe nei;( teumimpoy1lm nlietl() Duru poo0alxoiiciydfsDra(mpnu4alerxocoy1omDrlues;s) 2umxr3oo4am nmnei () Dtrum ;t4tpxnmiciat aDumuvs;u4arerio iytlmDeln s;s trurxo iy1lptnlfetls) Dtrxm ;o0oetnmieilt sDrluvs;u)tltoir iatlpte iei t0trxriopno1alt liciat)sDtmx onu4alto o3iasfa2rau on()treoxociadfp elivs;t trxmxr oo4llt lfetl(  Dum(rp;o4aexnii3iyt sDua(mo (4 lxrxocoy1optr u ils0t2tmio3nudal e fct tfarumxro;o1altn feiysfa em(mont4 lenifctydfmDeau o;(  ruoxm oo1olenmnei s arurx oot1aexnmieiadfa2rlnmo;t0alerirctatlp e ieslt)texmxrpou4optelncia(  Dumu pnt4tltn oetys a rln p t)arenmoctatfatrai o;(0trtoxopiy1ap  mnct s)srraxr oo0olx if3ilsfmDum(vs;u4arerif oytoaDeanes;t trtrxopio4lltnmfvsls)a2um( ooo4aleo ociadfs2ea(mo;u4arxnmocootfp e n o s teurxm3oydale mfcs s srtaxr oo0aeeo f3iasfa2ulumpnt4aexoiociadfptr uvi s0trxoxopou4llen iei s) 2rru ooo4apeoio3ild s2ra(mon()teermr3oadop e n il(0sexr(m3nu4op  mfcs sf rtr(r nt1olt mf3ilsfm2ra( s (0 exnxf3oatlm e uesl(0t2tr(r no1opt  neias  rrrurpnu4tltoifctldlaDumumo t0trtnxf to1omte ivi;t)tetoim3io4lpe licsat s2trum ;u4alt mfciltfs rau s;t0trtnir iatfptrau i;(0trtm(o nydoptnlfcils  2tmurpot4oeen f3iyd s2elu o (4alxrxf3iy1oa rlneo t  ruo(o oudam n fcslsfsrraurpoo0ale  oeiyt aDem(mp;u4 exrir3tytlpDran i;s s2urxrpou1lle  neilsfsrua(r ;t4opxnifctadlm2elnvpn(0 rtoio3tatlpDeliei;s s2umim3nudol   fetlt artr(  no1aptn feiysfm rmums u4trtoifcto1lpDr u o t) etmirpoo4llee fcilsfsDum(r ;o0oeeoio3ilsfmDuluvp;u0arenmf io1faD lu s (0seurxr no1lptn ictas sDurxmpno4ope  f3tltfaDelnvs;t0artoirciotoaDelnesls0srxrir3oo4ol nmici s)sDtaurpnt4opeomf3tys aDel( o ()artnir3todoa   uei t0srum(r ny4aptnmneias)a2rrumpou0aetomfeiltfsDemu snt)texoifciydlmDrli i s0 rtriopio4lm e ncsasf rrrxmp;u0tpx mfciad s2ulu s t)alxnxrciydfmteai il( teuoxmpoudlmt  fvtlt)s2umu pou1apeniieiatla emu s t0tlenxo iydopD  i i t0 2xmxrpiu1om n fcs (  2umx oou0tlen ieiyslsDumnmp;(4 rtnmfctotfpDeln s s0 2xrirpoy4lltnlnctltfsDuaxm oo4tpxoio3iyt mDumump u)trenircia1lm  anes s)srxriopoo4open fvt tfsDumxr ot1tltnmieiyt a2umnms (0arxniocoa1om e ivi (0 etm(o3iy1aptnlnvias) rrr(ro;u1alx ifeiytls2uaumo;u) eerxfctydfaD lnvo t0s2xm(m3iydlle mnvslt) rtmxm ;o0texnifeiasfs2eau p;t) exnxrcoatfa   uvi s t2xrimpnudom nmivias a2tr( oou1tlto fciytfs2umu p t)areoirctatom r ies;(0t2xrxopoo1ome mnctls)aDtrx pou1opeo ocildfs emumo;t4 lxomrciatlpte u o;( trur(m nu1optnmiesltfs2tauro;t1texnmo3tad a2rl( pn()alxoxo3ty1lpDelnvo s t2um(m3io4ale mnvt ()s2tmxront0aeto i3iyd sDea(mp u4arxoio3io1fa r i s;s0t2triopou1olt  ncs sfaDta(r nt4tex moctytfaDrm(mo (0 rtoxr3tydfate uvslt0seto(rpoydomte fvil( aDumxm nu1alx mfeildlaDrau snu0 rtnxr3ta1lmD  nes t) ruoir3oo1ale mietlsfsDtm( pnu4olt  f3iadfmDrmn s t0 exrmr3iatop   iesls0 2xmxr3ny4oltn ivsatfsDuaurp;u1tlxniociysfs ea( s t4artnmfcoatom raies s)setmim3oy1ope  ivsl( srrmx o;t1tpx  f3tas m2rln pnu4arxnifciadfptean s;(0srtrxm3oydam e neias a2uax  ou4oetnii3tldfmDrlnvon() ltoxo3tydfmteauvo;s trxrirpnodlmte ivt s a2tm(  ;o4opxn feilslm2eau s () etoxocio1opt  nvslt teur(m iudlp  mfct tf Dua(rp;t0texoiociyd a ra(vo u4aeeoio3tatomte nvi;(0 2um(m iy4oleemfetlsf ruax  ;u1alenii3iatfsDeau p;u4texrif3iatfmte ieo;t  rxmxr oy4ol elietasfa2uaum ot0apxn octytlmDrl(vs;t) exnmf3ia1lm  livsls srtr(o3no1lmeelfeta( arraurpno1oeenmf3tat a rlnvon(0trtnmo iodla e n i (0t2uoxo oy4aptnmncslsfaDtr(moou0altn i3tasla el(msnu0trxrifcty1opDrluei;s s2to(o nodope mnvt t) ruaxroot1tet ioctlslsDra( o;u0tlerif oydlm  ln ols setoio3oydolee ictl(  Dtm( oot0aee moeiatls2rln on(0 rtrxociodlpt aies;t) euriopou1ll nlivsat srrax  ot0aptnmoetytfmDuluvs u4aexrir tatopDranei;t trxrio3no1lm  lieil()srurxm ot0tptomo3ild a2rlums;() reoio3tadoaDeli s t0t2xr(mpno4ol  mfcsls)srumumoot4tpxomictls a2rlu o;t4 exrmr3iydlmte ues s) 2tm(r no4lpt  fvi t) rrm( p;u4optnii3tltlaDranvp (0tlxrxf3tadfa e i s;t srtoxmpnu4aleemici s)sDrax  ;t4tee  f3iatfaDemnvsn(4tleomo todom r n ol( s2toxo3no1lpeemfvia()s2rrxr ;u0altnmictydfs2rauvsn() exomfctatfa r i ol() 2umxm3iodal elnetat)s2tax pou0alt io3tltfaDrau snt) lenif oa1fm  li o t)teto(rpoy4aptemfetl( srtr(r ;u0ope ioetltlmDranms;()areoxrciotomDeau s t srtmimpno4omenmici t) rrm(mo;u0tee iieiltfaDeln s ()aexrxo3oytfptrlnvo;t  exmim3nu4lpenmfct t  rrrur ;o1apxn ieiys aDuanvon()tetniociydlatrln s s texoxopnu4oltelnvsat sDrm(rpnt0apto f3ildlm ea(vp t4tetnmf iytfm eai i;s)tetoirpoy4al nliei ( sruauronu1tltnmo3iyt a rauvon()arxnmrctytoatrlueol(0srtm(rpnu4am emfesa( aDurxmooo1alt ifctydlaDeanvpnu0alxnmfcio1fmt aieslt0trumxm3ny1lpe lfei t)aDrm(rpou1aeeoiietyd m elnvonu4aetrif todoatrlnvol() eurirpiu1op nmnct s aDtaxr ;u1tlt io3ilsfmDea(mo;u4areomr3oydfm r n o ()srtrim3iodlpenlnet ()a2tax  nt1oltnioctldfaDelu p;u0arxrxfctodfpD luvil( srtm(m3ny4op emicsa(farrauro;t0olxo ieildfs2umnvp (0tlxoif3io1fptr i i (  2tmxmpiydam elfesls  Dta( ono0texoifciatla2ul( pn(4aeenxr3oatfp rluesls)t2toio iodlmt  nci s)aDtm(m no4tlxoifciad m emnvpnu)tetomo tytlateln ols) etoxrpio1opee nvsa()s2ur(mp;t0apt  ociyt mDea(msn(0tlermf ia1oa rln ol()truo(o oodlpeelivias)artax oot4tet iociasla em(vp (4 lxomfcoatfm  ai ol(  rtm(mpou4ol e iviasf 2urxr ou4apto o3tlsfm2el(von() rerir to1laDr ieslt0 eumxr3no1apeemics s artaxmp;u1tleo ocildla rau s;u) exrxfcia1lp  auvs;t0t2uo(m iu4opeelneia( a2tm(rono1texomieiadfa ulu p (0altrxo3iadla   ieo;s)teuoxm nydlm emfcs s  2umum ou4altn fetldfm ea(vp u4 rxnifcoydfpDranvs s setm(m ny1apte fet s  rraxmpno1apto ieiys a2uanvont0tlxrxo totlm eau ol( t2um(r3ou1alt mfctltfa2tru ono1tlen o3iltfs2ul(mo t4aexomfcoodfaD  ues;s)truoxmpoo4oltn ieiat sDumu ont4tpxomictatlaDua(vpnt4tlermr3oodfat au sls0setoim nodomteliet t)srrr(rono1oet mfciytfaDuauvp (0 lermf3ia1late nvo t)srxrxopny1op emnvslsf rrmurpnt0tlt mi3tydfaDuanmo;u4tltomo iy1om  aueo (0t2xr(opny4altelivtlt)arta(r ;u1oleo ictydfa ea( s;u0aleomo3ty1lat aueo;(  etoxrpnydopeemnvtl()aruaxrp;u1apeomietydls umuvp;t4tlxrxf3oy1oat li s t0t2toxo ou1lm  lneta(  2urur nt1tleoii3iadlsDrmuvs (4 ltnxo3tytoa  aiei;s0teuoio oy4lpenlicta(fsrtaxmpnt4olx  ietlt m eaumo ()trxomfcoa1oatr u s s  2umim3ou1omtemnct sfaDrrx p;t4altnmfeiytla emumpnu)arxrxrctatfat luvi s) exo(o nodalt  ics tfsDtrxm nt1alx  i3tld a ra(msn() lenxo3oytlatrli s t0 2xoiopny1al   ivtls a2raxroot1olen ociytlm ulump () ltoiocootoaDr u il(0t2uoxm nu1ome micslt s2rmuronu0tpx mf3tyd mDua(monu0texomr3ta1lpteau s s  ruo(mpio1lpe mfct s) Dtrxmo;t4oeeo feias a2elu ont4aeenmfcia1opD  nei s0 euo(o no1lp e iesls  Drmxmpou0aexomoeiyt m raumon(0tlenmfciadoa  li o t  rto(m iu4lm elfvtas) 2tmu o;u0alt mfeiyslsDrmu o;(0aetoxr3oatlpD  u ilt setoiopoydlle lncs ( srtaumo;t4tlto ieils s2rlnvo t0 rxrmf3oa1fa e neo t sexrio3iy1ol n fei sfsDururooo0tpe ifeiys s2emu s u)trxnir3totfmtran ol( s2ur(o iy4lle mnvsa()sDtr(  ;t4apeoiietaslsDuln s () rxoif to1lmD  n s;t)t2xmio3nudaleemivtatf 2raum no1teen iciydfm2ulump;()arxnxfcoadoat lneslt0 etr(r nydole  nei s s2tr(rp;t0olt  iciad s2eanvp;u4aetniocta1la e nvol( trxrio io4am emfetls sDuax p;o4aex iocilt s el( pnu4trtnmociotlm r uvi t)srtoimpny4ap  mneta(farrmxrpno0alenmiciadfsDrln on()tlxrif3oy1fm r ueo;(0t2xo(o3nu1lm   fvt t)aDrr( ooo4tltn f3iyt m2eluvo t) leoif3oytla   ueolt0teurxo nydlp  mfeil(  rum( p;u1tleo fciasfmDra( on(0 etnmo oydomD li s t seto(r iy1apte nctasfartrx p;t4tpto o3tytls2eluvp;u0aetoxocta1fmteli o;( srxm(mpnydlle livtl( srra(mp;o4olxomi3tydfaDul( s u0tltnmr todlmte i i;s)s2uo(opiu4ol e nvilt)sDum(mooo4olxnmi3tas a eluvp;u0 lxoxf3oodlatrlnes;s) etmxrpno4alt licilt)s2rrxr oo1oexo octls m2raumpnt0tetoxocta1fm r u s t)srxrir3no4llee nct s) Dtm(mo;u4tlt  i3tlsls2eau snu0 eermf3iatfaD  nvslt0trxoxo3oy1lpte fci s  Dumump;t1altoiieildla rm(vsnt4aetrif3oydop  liei;(0 2tmir io1opt miesls) Dtauro;u1apeoioetldfs emnvp u0 etoio oytlaDeli s;t)t2tmir3oo4olt lieias) Dtmurono4aex mociatlm ulnmo t4aetnir3tytfat luei () rxm(o no1am emnesatf 2rr(rpno1alx mf3iytfa ua(mo;u0tlxoxo ootfmDelueolt0s2xoxo oo4ope  fvils)sruaxm oo0alx ii3iltfm2uaump u4texnmf oydlpDe i i t t2um(opoy4al emncsa(fs2ua(mp;t1oetomi3iyt s umnvsnt4 rxnxo iytop eaivolt srurirpio4op nmfeils) 2ur( o;o0tlxo ieiatlmDul(mp t0aexnxf tatlpt lu il(0seur(rpny4am nlivsat) 2tmx oou1alto octaslm2ea(mo (4trtoxo todop   u olt  ruo(m iu4ameemfesls srtaurpot0aptoiicias a rmums u)altnio oatoateliei;s  2trirpny1lmtnlneta( aDtaump;o1tlxomfeiyd a rmuvo (0aeeoir oo1fp r i olt) exoxr3iodlpt  iesa(  rur(r ;o1tpxo f3iysfs2el(von() reoir tytfmtraneil()srurio3ny4al nlnvilt aDtmxmo;t0opxnifeilsla2rl( p u0aetrio3iatoatr nvol(  2xo(rpio1lme mneta() 2raxro;t4open oeiadfs el( s t4tlxrif iydfm e nvsls teurxm3nu4lp elfviat)s2taxrono1olxo iciasfs2rmuvpn() rermo tydlmDeanes;( sexmxr3io1ol nlfct t srtru pnu1tptnif3ias m rlnmpnu0 rtnmr3oadlm  auvi s)texoim oo1amte nvi t)artru o;u0alxn octysfsDea(vo u)texnif ia1fmtrlu il()t2uoxo3io4omtemici (fs2raxmpoo0opx ifciydlm2eanms (0alerir todom  lies;(  2xoxm3iydlm n nviat s2urx pou0opeo f3iad m2ranmo (0aexrxr todfa elivs t)seto(r3nydalenmieia( s2umx onu0oexo fcildfs um(mpnu0alxrifciatomtr i olt)s2tmio oy1amt miesatfaDurxmo;t4ale  iciltfaDeaums;u4 rermoctydlaDeaiei;s  exoxr3ny4op  lfvsl( s2ur( p;o1opt mf3tydlm2uanmo t0alxoxfcia1omtraneo t0srxriopny4alte fcsl() 2tr(m ot4oet moctasls2um(vp (0 exnirciytomt  i o (0 2tmxr3nydom e iesl()srtax ont0alx  icildlaDrmumsnt)aeenirciatlpDeaivo;t  2um(r iodoltelnctl( aDrrx  ot4alxnmf3ilsfa rmumpnt4aexnir iatop eai i;( sexm(r ou1lmtemnvt t) rrmurpou4altomo3tadfaDranvs t0trtoxr iytomtr nvs;( texmimpno4apt lfetl() 2tmurpnt4oex mietyd s2eanmsnu4artomocia1fpteaivs;s0 ruoiopoydlmee iei t  rumumo;t0olxn f3ildlmDeau s;t0teerif ty1opte neilt)s2tmirpiy1om  mncsls) 2rm( pno4aeeoii3tysfmDeau o;u)arxnmfcoodlpte i o t0srurxrpoydomenliesa( sDraxmo;u4oeto i3ild s ul( s;t) eerxo3oadla   u ol( srtrim3iy1lltelfeia(f Durx  nt1texn o3iltfs rau o t0 eerxf iatoaDeaneilt t2xmxmpiodome mivsas) 2umx  ;u1apxomietltfs ulnvp;u)tltoxr oydfatraieil(0trurxrpiy4lp nmivias  Dumumpnt1apx  ociyt mDemnmon()arerxr oytoa rlivs;s0t2tmxm no4lltelictat  Draxmooo0tpt  octlsla emnmo;(4tltomr iatoa   ueo;t0sexo(m3nudap n fvtlt aruaxront0tpeomi3iltfs2emuvsnt0aleomocoa1la e n o;(0 exrim ny1llt miesa() rtr( o;u0olxoifctldlm2uanmo (4arxnifcto1latr ieo;()texr(opnydlptnmnei tfsDta(r ou0aetoii3iytfm2ul(mo u4tlxrifctatfpDr nvs;() etrxr io4ol  lnvsas a2ta(mono0tptomietls s2ra( on()tetrif3iotoaD ai sls0s2tr(rpnudlmtnlivi t)sruaumo;o0tpeo f3tyslm2umnvs;t)tleomr3ty1latranes t t2trxr3io1lmtn ivtas) 2umu poo4tlxniictat mDeanvs;u)aexomrciotfp r ivs () eumirpiu4op elnciat)artrumpot1tpxomieiasfm2ua( s;(4teenxocoo1fa  aneo s t2xo(m nu4alt  nvsltf Dtm(mpnu1tee  i3iatfmDem(vpnu) etnifctatom e uei s0 rxo(r3ny1om nlneils)srtrxmooo1oexn i3taslaDumumo;t4 rxrio totlaDranvo;()trxmxr3oy1op emnviatfa2ua( pnu4alt if3iltlaDemuvsn(4altoxoctodoaD livil()t2tmxm oydamtelneiasfsDtm(monu4olx ioeildlm eln snt) eeoifctydoa eluvil(0srtmxmpio1lmenlfcilt  Dum(ro;t4alxnmiciys aDranms u)artoxr3iy1omtr ueo (0 2to(o3oy1lpeemnctlt s2uaxmpoo4olxnifetatfaDea( p u0aetoxrciotfatrlneslt0sruoxr ny4llt mfet (  rrrx pno1opt mi3tyt s rauvsnu4aexomr3oy1la e i o;s srumxo io4lp  mfvils a2trumo;o1tlt  oeils mDelnvo t0aeerxr3oa1lpDrli ilt s2ur(o3io4opt micilt)aDurxronu1apxnio3iasls uauvp (0altrxf3ia1fmtr u ilt setrim3nodlmtn fci () Dtaxmpot4tpx if3tls aDemn p (4 rtnxrctotlate u ilt0t2to(m3iudlpen ietas)sDum(m nt1tpxn o3iydlaDean s (0alerio oodlp eai ilt)tetmxr3oodame  ieia( sDraxrpoo0oltn f3ildls umu p;u)aeeoxo3tytfateaieo s  rxrxr io4ape mfciatfs2tm(root0aexomiciys a2el( s u)trtomf3tytomDrlieilt)trtr(m3nu1am elncsa( srtrumont4apen feilslm2ulnvpnu) eerxfctydomDe u i ()s2xoimpoy4lmeemnct tf 2ua(m nu4tptnioeias a elnvp u)texrxf3iotfmDr n s;t trtr(o iy4lm e iviat)aDtau  nu1oetn octydlmDean o;u)arenio3iadoptrluvi ( t2xoxm3oy1lmee nciltf rrrumpno1alx ioeiyt s2rmnmp;(0tlxomoctodop e iei;s0seuoio3oy1alee ies s)aDra( p;u0tpenifctltls2ea(vsnu4tlenxociodfa rauvo;(  eumxr3nu4omtn ncilt aDur(mo;o0opeoioeiaslsDrm( p;(0 renircoytfmtr ivolt s2tmxmpoo4lpt livslt)srtmumoot1altn f3ildfm el(mp;u4altrmrcoadfat liei s0seto(r io1amte neta(fa2trurp;u0tpx mfeiadlsDulu on()aexoifciodomtrlivsls0 ruoxopoydoptemfvilsfa2ra(mpno0tpx  oetasfa2el(vp;() exrxr oydoat lu slt0s2to(o3ny1alt licia(fs2trxmono1aeenio3iytla2elnvs u)tetniociytomDrliesl(0trxoxm3ou4lm nmivi tfs2taxrp;u4opx micias sDrlnmo;t)arenxo3tadfp ean ilt)teumxmpou4omt mnetltfaDtmxm ;t4oetomocilsfs2eauvsnt)tetomr3oydlptr neo t) etoxm3oo4ap n neilsf rumu poo1tlxn fetltlaDel(vpn()tlxnxfciatfa   ueilt0srtrxr nu4aleemiviltf 2tmxmpou0aeto ocilsfaDelu pnu4artomoctodfm  lueols)seurxm ou4amenmneilt)s2rau onu0aleoifciadlm2ra( s;u0 rxnmo ia1opt aivi;t0trxr(m ou1opeemnet t artrx pnt0opxomiciysfaDran p t) rtoxrciy1fm ranes;s)trxr(m no4omtnmivias arrm(  ou1oeen i3tasla2uau pn(4tlenxfcoytfmDrli s s) euo(o oodopenlnctlt)a2ua(roou0tlt moctydla2emn p;(0tlenir3tadop eaneslt0trtmio ou4al  lnvtltfarrrum nu4ale  o3tls m ua( o;u)tltrmr3iotla  li o;t0s2uo(o oy4op  lfcsa()a2urxrpot0tpen iciyt m2rl(monu) rerif tydlp  luvil(  eumio iy1ap   ictat a2tm(r nu1alt  ietatfa emnmo;t0artoir3oatom  li slt0t2xoxm ou1lptn icil()aDuru onu4tlt  i3tyslm ea( s u4aeeomr oatfpD lu o ()sexoiopiodlmt mfvsa( srumu pnt4opxniiciat mDeanvo;u0tetnmr oydomD  ueo;t0srxrxr3iu4am nmictl( srtmump;t0tlx mfctatla rlnvpnt)trtrio3tatlat  ies () eur(m ou1llee ici ( sDtrurpnt4alt  ociasfm uau o t4texnir3oy1fa elivsls) etoir3iu4oleemicil()aDta(rpoo1tpeo oeiat m2rmn s t4trtomrcia1opteluvi;t) etmirpiudlme  feta()aDtrum ;u1optoioctas a2uanmo;t)texnif3io1fmDr nvsls0trxrir3oodomenmncias  rtmur ;t1ape ii3iatfm2umnmp (0 lxomo totla eaies t  eum(opoy1lm nmici s srra(  ot0tpe ioeilsfmDeln s u0 reomo tadomD anvils trurio nydlmtnlfcta(fsrurxmo;o4oexo feiad s2elu ont0trermrciatlmteaieo t0t2xoxr nydom  mfvta( aDrrxmoou1opeomocils aDuln o t0treoif oodlaDean s s0trtmir3nu4ap  lfvi (f Duaxr ;o0aptn o3tldfs ua( s;u)tltnmf3iatla  anvs () 2xmiopnodamt lnci s)arrrxmpnu1oeto ieiyt s2rmnvp;u0texomociodlmtr u i s srxoxopiudll  lieilsfarraurpnt1aleo ieilsls2ul(mo;u) renxf todfptr i o s0s2xoir no4lpe lfcs sfs2ta(m ;o0ope mfetyt aDuluvont4texoxr3iodfate nvs;( srtrxm3iy1apenlfctls)a2um(ront4ole mf3ils m2eauvpnu0tlenxocoatoaDeau o s srxoxopny1omt mfesasf rrmum nu1oee mociadlm2ranvpnu4areoxf iydom raivi t) ruoir nu4ame mnvt (  rtrum ou4apenmi3tydlmDem( onu4arxnio3iotlpD lnei s0teuoim oo1lmen iesatfsDua(rpoo4tpe mf3ild s ea(vo;u4 lxomo3iydom  anvs;(0teurio nudoltn fcil()aDrmx  nt1alto f3tydfsDranmsn(0alenmf3totlpteanes;t0 rxr(o3ou4om nmivia( a2ur(  nu4ale  f3iatfm rmnvo;()areoxfciydoaDeanes t0t2urxo iy4olt miei (fs2ta(m ou4aptn fetysfaDrau snt)artnmfctodoptrlueslt tetm(mpnu4optnmicsa(fa2tmxmpnt1aetn fetasfmDeln s;()aetnir3iotop  li ilt0t2tm(o3no4lp  miet t s2tm(  nu4apxo i3iltlm2rlumsn()teeoxf3todomte ivol( trxoxr3iodaltemnci ()aDrau  ou0tle  i3ils m2ea(vpn() rtniocoodom r uvilt)texo(rpnu1ll   ivils  2rr(  ;o1tetoiociyd mDrlnvo;u0tetnxo3totlpDeaueols) 2um(r oodalenmics s sDurumooo0tptoii3tys a2umump;t0arenxo iadfaDe ues;s  2tm(o nu1ope lieta()a2rmxrp;t4altnmo3iltlaDean snt)trerir oa1fmDeli o;s  ruoio iudlpte fviat srua( pot0oexoiociytla em( p;t4 leoif oo1fptr i i s trxr(m nudap nliesatfsDrr(mo;u4tltnmfcildlm2elnmpnt0 eerio3ia1fm r nvils0 euoxm3iy1omenmivs s aDtax oot0apxo feiltfs2um(msnu0 ltnxrciadlp r uei;s) 2xmim iu1apt lnesltfsDtm(moot1alxnmi3tad a2ulnmont0 renmrciy1fpDr nes ()srtoxo no4lltemneiasfsDurxront4tlt iieilsfaDelnvp t4texrxf3io1oaDrluei t texrir nudom nlict ( arra(mont4oeenmf3iyd s umnmpnu0alxnmrctadlatrln i;t srto(o3oudlm  mivsls arrr(rp;t4tpeoiieiydfa ea( o;u4arxomrciytfpD  i ilt)texr(r3iy4ol emnci s srrax oot1apeomf3ildla rau o (4 eeoxrcty1lpDr ueols0tetm(rpny4llee nei t aDtr( pot4opxnmfetad s2umnmsn(0alerxfctotlp rlivslt trxoxr io4lmeelieta( aruaumo;u1tpt if3tls m2em(vs u0 eerifciadfaD lnvo;()tetm(o3iydomt lies t) rtm(m ;t4tpx  octad a umuvont0 leoif3ty1fmD livilt setrxopiu4op nlfvia(fa2taxm oo0alx mo3ildlm2um(vs u0 lermrcootlmtrliei s  exmxm3no1llte fesltf 2rmx  oo1opx moeiat m el(mpnu0arxnmoctytfp  lues s  rumim3nydlle mietls) rraxmo;t1tle iociyd aDumuvp u4 rxrio3iydfa r uvi (0 2toxm3oy4lm  lncsl()a2trump;o4olt ioeiydfm um(mo;t0tltoio iytfmDe nei;()s2uoxo3oo1apeemicil(f 2taur ;o0tpto iciysfa2umnms;u0arenifcta1op eai o;t)s2tm(o3ny1aptn fcs t  2raxm oo1tet io3tltfsDranmo;t4arxnmocty1fat ai olt)t2xoim3oodlme  iesatf rurx ono0tlxnmietldla ulumo;t) rtomfctotfaDr ueo;() exmxrpoo4lm  miei ( sDta( p;o4tlxn o3iat sDulnvpnt4arxoxociytlpD  u ols)texmirpiu1ll e ietlsfsrtaumoou1aeenmfciydlaDumnmsnu0artrmf3oy1lmt lieolt0texoxr3ny1olt mivsl() 2tr(r ;u0ale  f3iydfa ea( p;t0tetrmfcoy1fm  ln i ()srxrio nodlpt lici s aruru o;o1oet mi3iysfm rm(mo () lerxo3totfp   nvo ()s2trio ou4lm   ivi ()a2ur(  ;t0aex  fetys sDul(mo (4trenxr3io1fp  auei;t0srxmio nydlmtnmfvtlsfa2rm(  ;o1aetn o3iatfaDumu pnu) etrxrciadlmDelivils0srxo(o3iudll e neia( aDrrxmo;t4olen f3tlsfa2uan s () lerxo oytoaDeau s t0 exr(mpiydoptn icil(  rrr(  oo1oeeoif3tatlmDrauvo;t0alermf3iydlm  anvs;s0srtrim oy1om emfvslt  2uru ooo1altomoetad aDemnvonu4trtnmf3tydlp  ln il(0 rtrio3oo4ll emicias)artrur ;u4tlx  f3ildlsDeln snu4aeeomf3oodfp  an sl(0t2xr(o3no1op n ivta(f ruru pou1aptomo3iaslsDumn s;()artoio iadfmD anvo;(  2toxo3iu1lleemivslt) 2rax p;t0opx  i3iyd a rmn onu0treoxr3iotlat an o;s s2umxm no4omeemfvsa()s2rmxrp;u4oee ifetadlm ua(vo u0tetnioctadfa  anvil( seur(o iy4olt lnct s)arrrurp;t1opx  ieild a rlump;(4aeeomr iydoptrai s (  eto(o3iu1ol e fcils) 2umurooo4tetn f3tadla2umnvo t4teenif oadfm eaivs (0srumio nu4apen fetl() Duaump;o4alxomf3tld a ea(mo u)trtnxfciydlateln o;() 2xo(m iy1ap elnvt sfarumx pnt4ale moctldfm2uauvpnt4areoxrcto1fa rlu s;t)srtriopiydoptn fvsl() Dta(r ou4alx mfciadlm emn ont)aexrif tatomtrli o s)srtoxmpoudlme lnesl( arraumpnu0tpxomoeiltfa uluvpnu0 rxrioctodomD lu o;s)t2ur(m3io1am nlfes s  Dtmxmont1tpx micild m2um( sn(0treoxfcoodlp e ueo s) 2urim oudlp e ivsa() 2rmxr ;o1alxomieild m ra(vs;(4tltoircoytlmtrlnvo;(0 etrir3nydom  mncta( aDrm( ooo1texoifciltfm2uan p t4arerio3iydlmDelnes (0t2xrirpoy1am elnvtatfsDumump;o0tee mfciytfa eanvp u0 rerxr iodlmte nvslt s2xoxm ny4aptelici s  rrrumoot1texnmiciydfs2ul(mp;() rxnxrcio1fatrlnvo;() etmxr3iudlle  fcilt aDtmx poo4oex iieilsfmDuaumsn(0 eeomocto1omte iei s)srumio3ou1lpeelivias) Draxrp;u0alxn ictytfm2rmnvsn()arenif3totomtrln s (0 rxmirpnu1lpt mnciltfs2urx ooo4tlt ioeiaslm2ulumonu0 exrir3oo1fpD aneo;(0t2tm(m3no1ll  lfct sf 2uax pot0aex  fctydfa2umumsnu0 eeoxr oo1lmDr u slt0 2tr(o3nu4amtnlnei ()artr(rp;u0opxo ociydlsDeanmsnt0 exoxrctodlpD luvo;t0 rxmxrpnodamt mnesa()s2tm(ro;o4alx mf3tytfmDrl(vo t4trtrmfciodopt livo () 2xoimpno1lmtelietls)aDuaumoot0texnmi3ilslmDuanmo;()tltnmr oodfpD aieo;t0s2xoirpnydll  miei t) Duaumo;t1aptniieild mDrl( o (4teeoxocoadfp rliei;()sruoxopny4ol nmnetas aDtaurono1aptnmfeils m rln s;(0artoxrciadfmD an slt)s2trio iy1oltnlneia()s2urx onu0tleo iciad a2rmnms;(4tetomf todlp elivi t0setrxr3oy4ap n iet tf Dum(mp;t0tlto f3iat sDranmonu)tlermrcoatfmte u s;s0s2to(r nodamtn ictl(fsDurxmont4aeeniocilt s rlums (4 eenircoatfptean o (0trxrim ou4op emnvtl(fa2tmxmpou1aleomf3iadlaDum( on(0treomr3iadlpD luvilt srxm(rpio4am e ietl(fa2rau p;u4oltn fcildfsDelu s t4 rxnxocoo1fpD  iei s)t2uriopiydomen fciltfarumurono0aeen iciasfs2ul(ms;()aeerifcoy1lpDran o;s)seum(m iu1aptnmicsa(f 2tm(  ;t4aeeomf3iaslm umnvs;u)alxrxfciotopDe iei t s2tm(m no4lmee ieia( aDrmxrp;o4aleoioctydfm ea( s;u0aetomr3ta1fmtr u o t tetoim iy4al nmiesls)srrmumoot4tetn f3iysfmDea( p;t4 lxrir oodfm e nvil( s2xm(opnu1ameemnvi ( a2rr(m ou0tee moeiatfaDrau p;t4aetomo3oydomt luvils0 rtoim3oo1optelncsat) rtm(mono0tet if3iyt m2uln snt0 exnmf3iy1lmDrlnei;s0trto(m3nu1ll   nvslt srtr(mo;o4oex  ocilsfm umnmp;t)teeomf3tatopD ln o (0 2xoxm3oy1openlivsasf rtaurooo1aleoiociydlmDra( pnt0 rxnmrciytlp   nvs s) 2tr(opno1lltnmfvsa(f Dumxro;t0tleoiieiltfa rl(vont)tltoxrciydlmDran o;(0 2xo(rpiudol  liei () Dumu p;t0aleo ocias s rlnvp ()areoif io1om eaneol()seurirpou1alt  fvta( sDtmumpou0oexoifeiys a2em(vo ()artriocoa1lm rauei t0 rtoxo3ou4lmtelfvi sfaDrr(rpnu4olxo ociysfaDumn pnt0 lxrirciatfatr neil(0tetm(opoudlpt  icils s2taxrpoo4tee mietlslmDum(ms t0 etrifcoydoate u i;s0teumiopiu1altemiviltf 2umur ;o4alenmiciytfa2el(vs;u)texoio oodomD luvo;s)trumimpnudapt mfes tfaDrm(m oo0teenifeiaslsDran pnt)aetoxf oy1lat  i i;s trtoio nydll   icils  rtmu pot1oeeo ieilsfs2uanmpnt)tlenmfciatlm  li ils0setmimpnu4aptnmieta( artr(r ;t0openiicias sDrl(monu4tlxnifcio1lmtrlnvils t2xmim ou1op e ivsa( srtmu p;t1opxoio3iaslmDumnvont)trtrxo tatop eauvs;t0 euoxr oudoltn fvils) Duaxr ;o0tlt  ociadlsDranvp;()tltrxrciytlpDe uvi;( t2toio3nodlmenmicias sDum(m ;t1oeeomfeilt aDuln snu)alxomo3tadfa rlueol() eurio iodal n ivt tfsDtm(  ;t4aexn o3iadlaDelnmp u4 rxriocty1oaDe i ils0 2tmxr oudlpe mnes s aDtmu pnt4opx  ieilt sDua(monu) lxnxo iodom e uesl( s2uoxmpiudlp emiei sfs2urx pou0tetnifciat mDelnmpnt0arxrmr oytlm  aieols)setm(r3nu1amtnlnvsa()a2rmx poo1aeenii3iltlm2rl( o u0aleoir3ootop eanes;t) 2xrir3iu4aptnmnvsa( arumumpou0apxn f3tls aDeln o t0arxrmr3totoatrluvi t  etoir no4llen neil(faDtru ono1tpt ioctydlsDrauvs () rerif oydlmDe ivi t setm(r3ou4lpeelfvils) 2rr(root1tee  ietas aDelnvont4aexomf iotlpteli i ()trxrimpiu1olt mncs s) ruax oot1olt  ieiaslaDemuvo;t4 reomrcoo1fpD lieil()srtrxo3no1ole lieiat)arrr(m ;t1oetoif3ilslaDemu p;t4teenxr3tadoa r n i;t0trtmxmpiydopt lncsas s2ta(ro;u1tpe mieilsla emnvp (4 lxnmocta1op  aues (0 etrim3oo1llenlncta(f Duaumo;u0tee moeilsfa ulump t0 renxocoatoptrau o;s0srxmir ny1lm nlieilsfs2rm( pou1aee moctytfm2ea(ms u) lxnmr tatop rlieo t sexr(r oy1apenmics s)sDrru pno0alx  i3tyd a2um(ms;t4 ltomo3tydomtranvi;t0s2xrxopiu4aptnlfcils)aDtrx pot1apxo fetaslm ulnmp;t4arerxfciytfpt anesls  rto(m oy4ol  livta(fsrtmum nt1tpx mi3iltlm emnvs;u4trxoxo ia1oa rai i (0 rum(r3iydom e fcs sfsrum(ro;t0tpxomoeilt a ranvs;t0trxrmf3todfm e uvi t0teur(r oo1olenlfcsasf 2ururpnu4olenifeiyd m ulu p;(0tleoxo ta1fpDelivsls)texrxr3iu1opt  fvtas a2raxm ou4alx iieildla ran sn()texrif oy1oaDrluvol(0t2xrxo3io4op  lfei t) Dum( pnu0tlxoiietytfs eluvpn(4tetrxo iadopt  n s;( setoxm3oo1altnlnesas arra(rpno1tlen oetydlm rm( ont0 leoxfciydlmtr n i;(  rxoxm3iu4am  lfeiatfa2rrurp;t0aet mfciadfa2um(mp;u)trtrio3iatla r n i s) eumxm3ny4lle mfes (  2tm(roou4oexoioeiadlmDuanvpn(0treoxr3totopDraivslt0 rtmxo3ny4omee nctls artmuront4teenii3ils mDrlnvp u4tlerio3oodfatelneo;(0teuoxr3iydomeemneia(f Dta(rpoo0alxnmictltfm2umnvo ()trtoif tadfmDeaues t)teuoxmpiydolen neia(  2rmu pou0tptnmfciad mDul(ms;(4 eeoif oatfmD livo;t0t2xm(rpnydlm elnetas)a2ra(ronu0aptoif3ilslm2emuvp u4aleoio3oytomDeanes;s0s2xoir3iydape  ivi sf ruaxmpoo1ale mf3tydla2rmu p;u)trtomo oytfpD  nvo t) etm(mpoy1lmtelnviat srrrurpou0tex  fetlt aDemn snu) lxnmo oa1lmDranvi ()t2xoim ou4alen ncsa( aDrr( pnu4olto oeiydfsDra( pnu4 lerio3ty1lp e u o s0 etmxo3io4opt mnes s)sDuaxm oo4oleoioctad s ua(vo u)tlxoif ootomt anvs s) eto(o3nodame liei ()srumurpou4tlxomietydfa eaumon(4 leoif3iydlat  uvols0 rurxrpiu4ll n netas  rtrumpoo1tlx  o3iatlm2ra( s (4 eermrciatfpD an sls)t2tmir3iydoptn ieiltfsrrm( o;u4ole iieiad s2ra( pnu0aexrxf iytfmtelnvolt teuoim3ou1amt lnctasfs2ua(rpot4teeniieiyslaDea(vp u4teeomrcta1fpDeluvols)s2ur(r iy4ame  nvsasfaDuau  ot1tle mi3tydlm2eanvpn()aexoxr3iadla ean ils0sexr(m3no1amtnmivtl()sDurx poo0opxn f3iad a rmu p;u0tleomr3oydoat anei t)srumxo oodoltelnei t)sDrr(r ou1apx ii3iltlmDrm(vp;(0aleoxr3ia1lm eli o;s0trxoxo3ou1altnmivtl(f Dumu o;t4optn ieiydlmDuau s t0 ltoxrciadopDrlu ols s2urxm3ou1ap n ietasfs2tm(ro;o0opxo i3tydlmDrlnvpnt0artomf3iy1faDeau o;s  2xoxmpiu1apee iesl(f 2rru pnu1opx ifciat sDulums;u4trtrio3totfatr n i ( t2toio nu1am  micil(fa2taxr ;u0oexo o3tasfmDrlu pnu4texrmf3iodom raivi;s  2toxo3ou1ome mfesl()aDtrxr ou1apenif3iytlm ul(vsn(4trxrif3tadopD li o;(0 2xm(m3io1lpee nesls  rrru  ;u4olt  ietyslaDea( o;u)tlxrmf iydop  an o;() exmim nudamen nvt tfsDua(rono1opxnioeiadfaDulnvs ()aexnioctytoat aieol()t2tmxr ny1amt  ietat a2uaxrooo0tltoif3tltlm uauvo (0 exomf iotfate ivo t0 etrimpnu1olee ncta( a2tr(mp;u1oee ifeilt s ranmo ()trtnxo3oydfptrln i;()truoxm3oo4om  mict () Dtru  oo0altn ietyt aDua(vs;u4artoif3iadoptrli i t  exrim oudal nmnci t a2umx o;o4alxnii3iadfaDeau o;(0aexoxr iy1oa eanvilt0t2tmir oudapee ncsls srtmur nu4altomo3iytfa ra(mo (4trxrxf3io1lpDelu o;(  rur(m3iodlmtnlict (fs2uax  ;o1apt mi3tltlmDean p;t)tetoifcia1fmt aues t) rxo(mpoy4op  mici s s2rauroou4apxnmoctyt a2uaums u)aexoif tadfatrluvils)t2um(o3io1am nmfvtat  2tmu pou1oeto i3ild m2um(mo t4 rtoif3oy1laDr i i;s0s2trxo3iydaltemncs s)sDtmx ono4tlxnif3iyt mDrau p u) lxnxocoa1lmDr n sls) exmir3iu1ll  lietl(farrmumonu4apt miciys a2eanvonu)tlxrxfctydoaD anes;t  rumxmpno4ll  mnesl(  Drr( onu1ale  f3iad sDulumon(0trtomo tatlat luvols0trtrimpnydaptemnes (f Drm(mo;u1altnmieiad m2ul(vs;t4 etnmf3iodfa ean i;( t2tm(opio1ol nlfcs (faDtm(  ot1oltnmoeildfs2ulums (0 etoio3io1opDe uvo;(0 2tm(mpoy1ol nmnetltfa2umx o;o4oeeoiociat a elump t4tltomo iytfaDrli ol(  rurio nodlm e ics ()srrrx o;t4aexomi3ildfm2umnvs u0 lxnir ia1fa ranei t0seuo(r iydll emieilt  rrr(m nt1tlxnmi3tlt sDeanmsnu4aexrmr3oodfa eluei t  rxr(m3io4al n nvsl( srtrxmono1oetomo3iaslaDrmuvo (4 eerircoy1lm rlu s;t)setoim oo4alee nctls) 2rax  oo0tle if3iadlmDrm(vs;() lenxr3oy1omt  i i s)setoir3ny4lpe mncta(  Duau ont4alto f3tytfm el(mp;(0aeeomfciatomDean o;()s2toimpny4omeemncs t)a2uaxm no4apeomocilsfmDrln p;()tlenirciydfm   nes;t srtoim iu1ll nmfvs t)srumump;u0aeeo o3iyd aDrmnvsn(4 etnxf3iatfp eanvi;( s2uoim3nodole  iciasfartrx  ou4tlenmoeiatfa emuvs t4arenifctydlmt lnes t0s2ur(m iydlpeemiesas aDurumooo4olx iiciydlmDrmumonu4altrif3oo1lmt  u i s)setm(mpoydlp elnesa()aDtaxmonu1oexo feiad a2rmuvon(4teermo iadfp  lueols0trurxm oudol n icsas  rtrxmp;t1teto fetysfa uauvsn(0 rtrmo3totfp rau s;( trto(m3nodamtemncilt  Dum(mo;u4tlt  fciasfaDrmumsn(0treoxr iy1late u s;s s2xm(mpou1ll nlies (fa2rru  nt1ope ii3iatfmDuau p u0aleomfciadfmDe u i;()texrxo iu1llenlnct tfaDum( pnu1alt mfciytfa uanms;()tleoir oo1lp  aueols) 2uoirpio4aptnmfcs tfsrurxr no4tlx  o3iyt m2uau pnt4tetnmr oydomDe u i;s0 rtr(r3ny1ol emnvi ()s2taumpot4tpe  fciatls rmnmsnt)artoir ta1lptelivo t0 2xoxm iudlltelfvs s srurum ;u1opxo fctatfs emu pnt)tlxoir oo1faD  i i ( seumxmpiu4ll  micia( a2urx pnt4tpx iieiyt s uauvsnu0aeerir oadopt  n o;s) etmxo3nu1ole mfes t) Dra( pno1teeoiictldla rlums ()tlxrif tatlpDe ivs ()s2xrxmpoudol elfeil(f rumxm nt4alx  feiat s2em(vo;u4areoirciadlmteanvs;s0s2umir iy4lp   fci (  2trum ;u4oleomf3tls a2umumsnu)aexrxr3todom r u i;t)srurxo3nudal  liesasfsDumxm nu1tpenmoeiatls uau pnt0teenmf totfptelnvilt0 eumio3iy4apt mictlt a2rmx o;u1aex ii3tyt s2um( snt0aetoir oo1lp raivs;t0seurio iudalt licslt) rua(mont0tlxoiietldlm2emuvo;u0artoxrcoatlpD  n s s) rtoxm ny4ll emict ()arumumooo1teenmfeiltlm2ul(vs;t0aexrxr3ty1fp   uvols  2toim3no1ll  licslt sruaxm no0tpe  f3tad s uan p t0arerir ty1omteaues (  2trxo ny1ll  mnvsa(fa2tmur ou4tet  f3iadfa2rl(mp t0trxrio3oy1om ean i;t)teuoirpiudol  lnvtls s2ra(mpoo4apxoio3tatfa2rl(vp;t4 rerxf oydoaDeli ol()trtoxrpnu1ap nmiei () rrmu  nt1olxnmf3tysfm eanmo u4trxnmf3to1lm rlu i (0s2urxopny1alen fvtlsf rraurpno0tlxn icilt mDrmn s;()tltrifcto1lat aieo t t2xoim3oydam elicilt a2tru  oo1tptnifciatfmDulu s () lenir oodlaD livs t0 eumimpno1lmenlict tfsDrr( onu4alt if3iltfa2rlu s t4trxoxfcoodoptr ieo;(0 2toiopoodap  mfct t) rtaxmo;u4alto ictatla umu o;u4 rerxociotlpD lies t) rxrxo ou4lltnlivtat) Dur(m ;o0oet micias m uan s t) etrio ootfpDrlivi t trxm(o3ny4om emfvsat)sDrr(mo;u1alenii3tadfm ean on()tetrxf3iydfptran i;()texmimpiy4lp n ncs t srtrur ;o1tpt io3tadlmDrluvs u4 renif3tadlmt lues s t2umir3nu4al  mfci sfaDtaumpot1tltoif3iltlsDran o;(0tlenioctadom e ivi;s  2xm(m3io1omen ictas srrmumpnt0oetoii3iyt s2rmu sn()texnxf iadlpD lieols)s2xo(m3io1al  lfvil( s2taxr no0altn o3tyd sDul(ms;t) rxnmo3tydfaDr i o;s0srumxopou1lm nmivil(fsrrru poo0opxoio3tlsla eluvp t4artnxo3tadlptr i sls s2xm(m3nudll n fet sfs2trxmpoo1tpt  fciytlm2rl(mont0 reriociodomtelieil(  2xm(o no4ll e ict t) Dum(m ;o4ole ifeiadfs el(mp;(0 eenxf ia1fm rlneo t0texoio nu1om n ivslt)srtmx poo0altniociadfa2ulnmp t4alxoio3todoa r uvs (0 2xr(r ou4lmee fei t)sruau pnt0apeomociyd aDumu o u) eenir iatfmt au o ( trxo(mpno1lmen fei () Drrxr ou1openif3ils sDeau s;t0alxnxo oo1lpD lu i ( trtoxr3iu1ap  lnvilt  Dtax ono0tetniieiad a2rauvpnu4aleoxo oydfm  aiei s0srtmiopnydopt mncils)a2ua(  nu4olt  ocild m emnmo (0trtomr iytomDeluvi t s2urxr3oudal elneias sDra(roou0oetnmfctatfsDelumo u4 lenio oatfmDraivo (0 rurxmpoudaltemfei (f Dumx p;o4olt ii3tld aDuaump;(0trenxf3iydlpt ln o t)trxm(opoy4alt lfci ( aruaxmp;o0apeoif3tld a2um( on(0arenxo tydlat  u ilt0s2ur(m ou4am  lfci sf 2trx  no4apx iociyd a2elnmo;u4aexoir tydfa e i olt)t2to(m3iodlpt micta( sDrmumo;t1tetn fetaslsDrlu snt)altrio iatop rau il(0seuoiopiudolte ivia(fsrrrxro;t0oltnmf3ild a2ra(vpnt4aleomrcia1fp elneolt  2uoio3iydamtnmnvias) rtmxmoou4aeeo fetltfm ea(von(0aeeomfctodfp elnvils0 rto(r3oudolenmfeiasfs2rr(root0oleoii3iad m rauvp;u)tlenirctytla rlieo s)seur(rpiydlp  lnctl( srrmu pnt0tpx  o3iad s umump;(4trtnmfctadlpDrauei (0 2umxm nudalen nvs sfsrtax o;u4apeo fctltlsDrl(vo u4 etrio todfptr ues;s)trxoxm3iy1omtemfeia(fa2umxmpnu1oltomf3tyt s eaumpn(4trxoir3iy1fa   ueil( t2xmxm oudamtnmfvt (fsrtm( p;o4tlenmoeildlmDrmuvo;()trxomo ta1lpt  iei s) 2xr(m oy4op e iet ()a2rr( p;t0tee mfeils m rmu p t4tlerxo3oy1omD  i i t sexoxm3ou4ape  netlt) Duaur no1optoii3tydfm2rm( s;t0arxnmr iotfaDraneo s) exr(r3nudomtemnct ()srrmxm ;t0ope  feilsfm2emnmp;u4teenmf3iatfate ivi;(0teuo(o no4om nlicil( srrrur ot4oeenmieias s eanmont0 renxo oa1fatrlneo ( s2xrxo3nodlpt lnvt s  2rr(mpnu0optn f3ildfaDua(vpnt) eeoxo ta1fateauvi s)trxrirpiy4lmt miei () rrax  ;o0tetoifcildfs2rmnvont4aexoif3ty1fp rluvo;( texm(r3io1amt  ncsat) rrrxm no1aptomictls mDra(mo t)trtrif3ty1lpDelies;( tetm(m3io4aleemfetlt)aDtr(monu4opt io3iasfmDel(ms;() lenif io1op  lueo;t) rxoio3oydamtemfvtl() rurxmpno4opxn ieiaslm emnmon(0tetrir iydom eaivs;t0 2xmim3oy1ol e fei t)sDrmxro;u0tptnioeiad a2umnvp t)aetrxrcia1fatrai s;()truoxmpou1om emneils)s2raxronu4oltnif3iytfm2emuvs () eerircty1laDe i o;t0srumir nu1ll   nvs sf 2ta(m ;o4tpt  oeiys s2uanvp u4 etoir oa1fmtean i;( srto(opoudlpenlieil( arraxmp;o1apeomf3ils s rl(vo (4aetnio3ootlp raieo t)trxr(mpnodlltnmnci s sDrrxmp;t0aee  i3tlsla2emnvo t4arxnxo todlmtrln i t0s2trxrpio4om  lncs (faDuru ono0teeo feiatlm2ea(mo (0alxoxfctadlatr ueslt0sexo(o oydlme lnvsl( arra(rpou0ape ioetadlaDea(vont)altnif todlat anvo t0setr(m3no1optnlfesat s2rmx pno4tleniociltfa2umnmpn(4tetrmr tatfmt lneilt0srtrir3nu4omeelfvi () 2uaxmpou0oet ifctasls emums;t)artnxrcoatomD  u sls  rtrxopoodome lfes t sDtrxm ;u1oexnifctlsla rln s t) eerxr iatla e i il( teto(r ou1ole lnct (fsruru o;o1oexn feiat sDul( o;u4trerxfciadfmDelieils s2toxr oy4lpeeliesl( artaxmo;o4aee ifciyt m rl( onu4 ltnxf3ta1fpteaiesls0t2xr(opiydlpt  fesas srrrumo;u1tee mo3iad sDumnmp;u4aexrxo3iy1fa  ln o (  eum(o3oy4optelfeslsfsrrm(rp;u0aee iociaslm2uaump;(0tltnmr3iadopD luesl(  exm(o no4om   nvsat)sDtr(mpnt0texo i3ilsfaDeluvo;(0 lxrmoctatlaD lies;(  2trimpiodap nlivsls)sDur(  no0oeeo ociatfm2ea( sn(4arxoxfcoodfmDrlu s ()t2xrir oydom nlfcsa(fs2uaurpno4aexnio3tysfaDrm(vpn(0altoio3ootoa   n o;t0 rxoim oudol nmfviatfsDrmxmonu0ole miciytlaDranvo (0tlxrxf ty1la elivslt0 2tr(m iy1olt  ietat aDtmuro;o4tlt ifciys mDel( o;t0 renxr3oadlpDr u il( teurxo3iu1lpeelivsa()a2tm(mpot1tpxomoetytfm2emumo (4aexoio3ty1opt  nei;()sexrxrpou4lpe  ictltfsrtmx o;t4tlenmfeilt m2em(ms u)alxomociytlpDrlnei t0t2xrir3nudlle livs ( sDrau  nt0tleoiociytlm2eln p;u4tlxrir3iotomDe i s t)t2toio3oudoptemicslt srumur nu1tpxo feiyd a ra( p;(4arenxf tatomt aies;(0t2toimpnudlle  nci t) rtrx pno0alxomi3ils a ul(mon(4alxoir tydfateli o t0t2to(o iydlltemivsatfa2umxr ;t1tlxoiicildlm um( s t4 rtoxo3ia1lmDe n slt s2xoxr3ou1lp  micta()s2rru oot1olxo i3ildlsDul( on(0 eeomocoadfm e u i ( sexmxm iudlltnlfcil(fa2rmurp;o4ape mieiltla ul( s t4trenxr iadfateanvil(0srxoiopiu4opee ivtlt)sDururono0tleomociytfaDumumpnt0areoifcootfp rlueo s sexr(r3nu4ll   icsat aDuaurpnu0tee  o3iadlmDul(ms t0tlxrxr3iotlmtrauvsl( seur(m iy4lme lfvslt)sDrrxmp;u1open o3tas s uaumpnt4 etoxocoytoaD  i o (0srumxr iu1am  mnciatfs2tm(m nt0tee  fcild mDemuvo;(4aeeomoctadomD aies s t2trir oy1alt  fct tf ruaxm oo1altoii3iltfs um( snt0aexomfctodlpDeaivs s0s2uo(opou1lptemietas  Duax pnt1olen o3ilt sDrmu o;t4teeoir to1lm e n slt s2ur(o3iydol n fct (faDrm(rpou0oee iictlt a eluvpnu0altoio oatlaDr ieo;t srxoir3ny4ole  fvtlt)sDrmu  ;o4opxnioeilt a2eaumon() lxnmf oodom  lneo;(0 rtmir3oo4lptnlfesas) rrru pno0tpt  fetydfm2ra( p u4 rtoxf3iotfpDrauvi t0 2urimpou4alenlfvtls)a2ua(r ;u1aeeo fctydls ra(vp (0altnifcootfaDeliei s  2urxr3nydlle  ivtas artmump;o1tetomietatfaDrm(vp u) etoxf3iatoaDrln o s0texriopiy1op e iesl() Dumumo;o4apeoii3iytfs eau s t4aeeoio oo1fmD lieo;t0 2tmim3nydope mfetatfsrtrumpou4tpt if3iadfa2em(vo;t0 rtomo3oatfate iei t tetmiopiudll e fei s  2rrxr ;t0aetnmfciasfa ranvsnt)areomo ootfpte i i t0 ruo(rpou4ll emnvi (farur( pnt4ole mictyd sDrlu s;(0 rxomocto1oaDe ivi t0 2tr(mpnydllte fvilt)s2tr(mpnt0aleniiciltlm2ul( pn(0arxoifctodomtr ivs;t0sruo(o3oodlmt mivs ( sDtaxmp;u0tetoiicilsfm uanms u) etoircoodfp   n ils  2um(o iu4ole mncs t)aDraum nt4altn i3tls sDea(vpnu4 eenmf iy1lpD  ivo;t) etrxrpiudopee fci tfa2tm(rpot4aee io3iydlmDrmnmpnt0texrmr3iy1om e n s t  rtrxm io1opeemnvilt arta(rpno0optomfciyslm2rlnvpnt4tlxrmr oa1lmD auvo () eumxo3iudalt lictas arur(mpot0aet  ociatlmDeln ont0 rxoir3to1lmD ai i s sruoxo3no1op n nvilsf 2ra( o;u4tpe ii3iysfm ra( s;() reoiocoodomteluesls)s2toio io4openmnci (f 2urxrpoo1tetomi3iatlaDumumo;t0 rxnmf io1oa rluvs;(0t2trxopoo4aptn fvia()a2rm(rpno1apen fctatlm rmuvo;(4 eerxr3oydfmD luvo t0seuoio oy1llee fctas  2rm(  ;o0apxn o3iat s2raumsnu) rtomr tadfaDe n s;t trumxrpoudam   iet t)srtru  ot1oexnmi3iadfa el( s;u4tetrmo3oydop  aieols s2urxo3ou1op n ncsa(f Dtmxmp;u1oltomietltfsDemn p (4alenmociadfpteau olt)trxrxrpiu1openlfvtlt  rrau o;t4alen ieiytlmDemnvsnu) lxrxrctodfpD aneols0trxm(r nu1lle mfei sfaDur(m ;u0opx mociyd m2eaumsn(0treoxrcoodlateli o;s texrio nu1lltemnvta()sDraur ;t0open o3ildfm2el(vs u) rxomoctotopt anes t s2umim io4lme mfvil(f Drm(rpnt1oexnmo3ildfm2uan o;t)tltoio3io1opDrluvsls)s2toimpnodlleelies t s2rr(mp;u1altn fcilt s2um( p (4artrxr iadfaDeai sl(0srxrxr3nu1op nmietat)arumxrono0aeeo f3iydfmDrmnmont4arxnif io1lpDelnvi ()srtm(mpoodameelfvs (farta(mpnu1aex mfctlslm rm(mp;u) reriocoo1fp e nvo t0 eumxo nu1lpt micsltfarrrumpnt1apxnmo3iyt aDum(mp t0trxnmr io1lm rln ol(0 2ur(o3oo4ap  lietas)aDur(r oo4aleomfctlt s2em(vo;(4artrxo ta1om e ivs;t0seurxm oo1op e fvt sfsrrmurono0alx  fcild s2elumo (4tlenir oatfmD anei;( t2umxm iu1opt mfvtas  Drmur ;o0alx ifcild mDuanmp;u)aetoio oo1laDranvi t0texm(mpoydlltnmneils s2raxmono4teeoifeils a rmu snu4aexoif3oadopD lu o;( srtmim iu1om   ivslsf rrr(  ou1apxo fctad sDua(ms;u4aetnmo iodlm r u i;s0 exmxm oy4op   ictl()srtmxr oo0oee  o3tld mDraumonu) ltnxf oa1omDraivils)t2xmim nu4ll emncsas)a2ra(mp;u1ape mo3iatls elnmo;()aexrxo3iytlmtelivsls0s2xrxm nodlpeemfvta( aDrax pot1apto o3iltlm eaumon()alxrxf todoatr nvsls  2xrio3iu1ome lfcsls arurur no0optnio3iyslm2rmuvo;u)texnxo iatlptrlnvs s t2xmir no1aleemncsat s2umuro;u1apxomicild a ua(monu0teerir oodfa rai ilt  etmir ou1optn nvias)aDtr(  nu4optomoetadls2rl(vo;u4 etoifciy1omDrln i;(0 2trxo3io4ap n nvi s) Dtmu ooo1alx ifeiyt m2ranmp (4 eenmo3tytlm  auvslt0 rxo(m ny4optnlfvtl() rtrumpnu1oleo fctasfaDraumo;t) lenircoadomtelivsls  rumim3nudlpte fvtas srurx onu4aet mi3tydlm elnvo u4 ltrir ty1fpt anvo;s texoxm3oydalt  icia()srta( ooo4aet  fcilt a ea(vpn() reoxocoodfaDr n s t seumxrpnodllenlnetlt sDtau ont0ole mfctyslm2elumo;(0 lxrxoctodlpD aueol(0 2tmir iy1lmtnmnvil(fs2taxrono4tpen f3iydla2uanms (4alxoxr3iydfmD auei t seumxm ny1lp n nct s arraum nu1tlto f3tldfa2rm(von(0trtrmo3iytlm eli sls0trumir ou1oltelfesl(  rrmx poo4oeenmictldfm2rluvsnu0tlxnxfciatfp  an slt0 etm(r3iu4amee fctls artrx pnt1tlx iocilt sDrl(vs (4 etnxrcoydfateaivil()seurxm nudaptemfcias artaumonu1tleomocild a ea( o;t)texoif oy1fmte uvolt t2toir3ny1al  mnci t) 2trumpoo4aet ifeiytlsDul( p;u4tlenmr3oa1opt au i;s0 2um(opny4amenmiet (fsDraurpnt0aetoiictltla2em( on(0alxrif oy1faDelu il(0s2xm(rpny4lmeemieia(faDtmu  oo0alx ifciatlsDuluvsnt)tlxrxf3ta1lpt  n ils0 rumio ou1lmtelfct (f 2um(m oo0tlxniocilt aDrmnmo;u0 etnxfcoadlmDe neo;t  rto(m oy4lmeeliet s) 2rauro;o4olt mieiadfs2ulnvp (0 reoxrciydfat au i;s  2toxo iy1llt  ivta()s2uax  ;u4opt mictldla2el(mo t)trtrxo3oydlaDeluvo t0 etoirpoo4olt  ncs tfa2rm( ooo4olxoii3tltla2rluvonu4altrxrcoy1fa r nvol( sexoirpoo4altelicsas)a2uax poo1optn oeiydfm rluvp;() ltrmfciydopDr n o;s) etmxr3ou1ap  lfcslt)a2rrxmonu1olxoioeiltfmDelnms t)trtrxr3ia1op e u i s0srtm(r3io1lpt livsas aDrrur nt4olen feiytls uln s u4aeenmr oo1om rlneo;(  2to(r3no4amtn netl(fs2uaumpou0opxoifeiatfsDean ont4 exnmo to1omDrlu s t)texmxopio1aptnlncsas)arur( ooo0tetoiiciatfs um( onu)trtnxfcoy1op e nei;s trxoim nudopt lfetat)a2rmx o;t0aeeniiciaslm ea(mpn(0 lxrif3oydlpD anvo ()sexoir3iodlpt  ivs (fsrra(rono0tpen o3ild s eanmo t0 eenmfctotlp  luvolt)setoirpio1omen fvias  rtru  ot1apxo f3iaslmDrl(vs;t)arenxfciytop  ln i;t texmim io1apee fetlsfarrr(r ot1oltnmoeiys aDeanvs;u4alxoxocoatfpD lies (0srurio3nodap  mietat aDuru pou4tltniiciadls2umuvo t0artnifcia1op  an i t0teuoim nydom n net sfa2rax pnu1open icils s2um(vp;u0arxomf3tadfm rauvs s0 rxr(mpnu1oleemnetas)aDum(rono1oex mfctaslsDemumo ()trtomf oodlptr i i;s sexoiopnu1omeemfvsltf 2rmxmono0olxoii3ildfa2uauvp t0altnxr tydfaDr uvo;t0sruoio io4op  lfeil()a2rmu o;o0ole io3taslmDul( on(4arenmf3totoaDe uei s) 2umimpno4amtn nvtat aDrruronu4tpx miciyd a2rluvonu0tltoifciytfpDrlnvs ()texrxo3io1alenlfvia( artax pnt4teeomfetad aDua(vs;u4 ltnio3oadfmt  neol(0 exr(mpnodopenmfvt sf 2uax ono4apt iietytfaDulnvo;u0 eeoxf3iotf
\ No newline at end of file
@@ -0,0 +1 @@
+u s;t setmxm3iudomtelncsas  Dta(m nt4tlx if3ilsfa2eln o;u4teerifctatlaDrlneils  2xmxm ou1llen fvtls)s2umx poo4tlto o3tys a2uau p u0trtnir iydlaDranei;s trto(m ou4altelfcias s2urum no0olenioetatlsDem( o (0texnifctotopteli s () eumxmpou4lpt mietat)srrmumoou1oleo icils aDrlnms ()aexnmrcto1fp   neols)sexoxopoudll nmfesa()a2ra(ro;u0optnmieiys s rlnvs;u4 eeniocta1oa rlueils)srxr(r3nodolen icia(fsrrr(mpot0tleoifeildfaDrmnvpnu0artrirciytopD lneo;(0s2urxo3oudlmeeliesatfsrurumo;o4teeomfeiltfsDemuvs t0aeeoxf tatfmDr uei ( trurxr iudll   ncsls artr(m nu4opx iocilslm rlnmpnt0 renmr iytlm eln o ()t2tmxrpno1aptn fcs ( s2rmxro;t1opxo ietatlmDemnvo u) reoxf3io1fate nvilt0 rxo(r3nu4apen fetltf 2rm(ront0tet ifcildfs2raump u4tlerircty1lp eai o;(0s2xmio3iydopt lfetl()aDumxmo;o1aex  oeiyd a ulnvpnt0 lenifciy1fmD anvi t srto(r nydlpenlicta( sDtr(r ;o1oex io3ias m2rlumpnt0 lermo oy1oaDraiesl( seuo(mpio4lm  mncsas)sDumu  ;t4tet ii3ilt a2rmnms;u4 eerir iodfa rauvo t)t2um(m no4optemivt sfs2tmum no0aee micils mDrauvs () ltoxf ootfmtr uvo t s2xmxopoydllt  fet s)arurxroot4apxo ocilslaDra(mpnt4 lxrmr3iodfa elivolt tetmio3no1oltnmfeils sDua(  nt4apxoioetydfs2uluvs;t)alxnxo3oo1fa eluvilt  rxm(o nudaleelfctlsfaDraxmo;u1tpe mi3ilsla2ea(vs;t0 exrif oytomD  i o;(0seumio iodlmtn netls srurxmp;u4tltniiciyd aDrauvs (4alxoio3iatopDrli o t setrim3iy4alenlneil() Dtax o;t0oleo f3ilt m umu onu0tltnmr3iadop r u s () exoxr oydlmtelnvt (f Dur( o;o1aetniietadls raumsnt4 ltnio iatfp   ivslt)s2umxopoo1optemnvi s aDuau pno1tetoiietadfsDel(mo;u)teeoxo to1om   ueslt0s2urxmpiydom   fctl(  rur(mpot4aeenifeiysfm2ua( s;()trenif3iytla  aneo (0trum(rpoo1lp elfctltfa2umx o;o0alxoifciltls ulums;()tltoircoodoptr ivo s t2xo(mpoy1lm  lncs s) rtr(moot1aeenmiciyd a2umnvo u0trtrmr3tadlateaieilt0t2toimpoydaptnlnvsa() rrr(rpnt4opxnifeils sDuluvont0tlxomr oodfp   n s t) rxrxr oo4olt livt ()sDtm(mpou0tpt  ociydfa2raumo;t)tetrmf3oa1lpt aneo;t)teuo(o3oodomen fesa(farraumoou1tpt io3tytfs2rln p;t4 renif3oa1oa   u o;s)trtoxo3iy4apenmnvils  Dtrxm ;u4oexoii3iytfsDua(msnu0trtoir iadfm raueo s t2umxm3iydlm nlietltf Dtrx  ot1aex moctadfs eanmont4aetoio todlaDelueslt texrxrpiodllt mies s)s2uaurono4apenif3iltfa2rmnvs ()tltnir ty1oa rln i;(0srtoir no4amenmfes s) Dta( p;t4tlto oeiatls2um(vonu0 lxoxo iadlm  au s;t)teuriopiodolenmietat sDtaxmont1oltn ociasfs2ranmpnt0 rermr3io1lmD anei;( texoxmpou1am nmivt sf rrrxmo;u0apxniicild a2rauvo;u) reomf3oy1fmteluvol() exoxr oydll nmici () rtmum ;u0oee  ictldfa2um( snt0tlermf3oa1oa  luei t  etmxr nu4lp nmivs (  Drrump;t4tlx mociasla2rlnvs;(4alxrmrcio1lpteluvi;() etr(o oo1opeelfvilt  rurxro;u4oexomoctadlmDul(mo (4altnif3oodlp rlnvils)s2xrim3nodaltelneiltf rrmxm ;o4alxn ocild s emn o;u4teenio3oo1faD  n s;t)srtoiopoy1olt  ncia()srua(m nu4oleoioeilt s2elu s t4alenmf3iotfpD livsl() rum(m nu4lp nlici t)srtr(m nt1oltoiocild mDemuvp;(0aexrxo ta1laDrai s;() rxoimpou1am  miet tfsruaxroou4apx iocildla el( s;u0 lxrxo totlmt lieo;( t2toxr3io4lme  nvtl( sDraxr ;u4olx if3iytfs rlumsn(0tetoif3oatfpDelu sl(0t2xrim3nu4om n nviat  2ur(monu0alxo ieiys sDumumo;t0arxnirciy1oa  ln s;t) euo(o3oodame  fct t arurxm ot1texomfciydfs uauvpn(0treomoctydopDelueilt t2to(mpio1ol e ivtls)a2ta(r ;u0tpt ifciytfs2rmn on(0 eermrctotlp raues;s0 eumio3no1lm  livtlsfsDtaumooo1opxn oeiytlm2eauvp t)teeoxo to1fptr uvols sexrxrpnu4ol emfeil()sDrmx pnt1optoifciatfa emnmont)alerxf3tytfp  anvs t0 etmxm iudop   fei s) 2trxm ou1tlx ii3ilsfsDulnvs (4aetrmfcoa1la  lieo;t) ruoim3nodopeemnvsls a2tm(  ;u4alxn oeiytfmDeluvp u4 ltnir iydfaDr i s t tetr(r iu1om  lietas)srta( pno1aexnmoctyt m2emumpn(0aeeoxo3tadlpt ai i ( t2tmiopoo4lp  mfvias)srtaumonu4tpxomoeiatfm2um(vo;t0aexnxf io1la raivs s s2tmxrpnydoltn fetls)s2rmur nt4oeeoifetadfaDel(msnt0 rtoxr3iadfa eaieo;s0s2um(r iu1ol e fviasfsDrru o;o4tex ifeiytfs ea(msnt)artoif ta1opD auei t0setmxo3iydoltelnesl( srtmum no1oee  fetadfm2um(mo t4texoxr3iydopDeluei;s trurxr3ou1lmen ieiasf 2tmumooo0olt  o3iatlm uanvont0trxnio iotomDr nei t  2xoim3oy1op  livt (f rtau  nt0alx  o3ias a em(vp () etrmo io1laDr ivo s tetoio3iu4op e nvt ( aDra(  ou4tptnii3ilt s rl(vp;t0texrmr oo1latrau s s0 2umxr3iu4amt lfcs (faDrr(mo;u0tltniieiltfa umn o t0trermf3iadfateln o;(0t2xr(o iodal nlietlt arrmx pot0tlx mieiytfsDrm(vs u) etrmf3totom ran s () eurxopiodomeelnvsas) 2trxmo;u4opx mo3iytlmDrl(vp;t0arxrio iotomt auvo;s0setr(m nudoltnlfet t)artaxronu1apxn oeiyt m2ua(ms;t0altniocoatlat  u s;(0s2toxopoudapte fvt t)srrr(mont1tet  iciltlaDrmumonu)trtnircty1om r ivi t)t2xrio3oodapen ncsltf 2rm(ronu0oexn fciad mDemnvs;t4texrmocootfat au ols)teuoxo3ou4olen ncsltfsDtaump;t1oee  fctas s el(mont4 rtnmo3iatomtelivil( seuo(o nydal e ietat) rrmxm ;u0apxoifeiad s ranvon()altoif3totlaDr u s t  rumir3ny1altnmiei tfsrrmu pou4aptnifetyd a2em(vs (0areoio3iytom  li ils0 2tmxopnu1lp  mfvtls) Dua(rpou0tpe  ieiysla2eln s (0altomoctydfa  ai sls srur(mpnydll  lfetasf rumxmpnu0tetoii3tatlmDrmu pnt0teeoifcoatfmt ln s s) 2uoim nydomt mnvil(  2tmurpnu0tpe mictatfmDean s () etrmo3oy1omDr nvi ()sexmirpio4omt  ivt tfartax pnt1tpeo oetad s ua(vsnu0 ltnmr ia1late u o;t)sexmxr3oodoptnlivsat a2rru  ;t0texoifctls a2rln s;t)aleoxf3iodoa  li i t) etoimpno1ameelfvsls)sDtau  oo1oee ioeildls rmu onu0tltomr3oadlp  liesl(0srum(r iodlmenlies t artmxronu0apxomf3iatlaDel(mp;(0 rxoxr iodop elueo;t srxrio no4lpte feil(f rtr(mpou0aeeo iciasfs2rlnmp;u) rtnmo ootoaDelues t srxmio ny4om n ictls artaumo;t1tet mietltlm uln s;(0alxoxrcoytfaDr uvi;t teur(r oy4lp e feslsfa2uaxroot0opxnif3iys s ea(vont0texnifctatlmDrlnvslt)truo(r oudlm   netl(fsrrrum ;u4oeeoifeiltfaDemnvs u)trxnio3ty1oatrau s () rtr(opio1om nlivi (fs2umxmo;t4alxn feildlm2umnmon(0aexoxr io1lpt  n i;(0setm(o no4apee fvtat a2taum ;u1aexniictysfm umu sn(0alxomo iadlmtrlivs;s  euoxm nu1apee nvta( srrr(mo;o0oltn f3tas aDeauvs;(0texnmfcoo1la raieslt)sruoio3io4lm n fcslt)a2rr(mo;t1olt  fctysfs2ran s;u0alxoxfctydfp elueolt)t2trir iu4optn fcs (faDtm( o;u1olt  ictyd s2el( pnt)aeermr oytfm  lneolt0 ruo(r ou1alte ietatf rurxrpoo1opeoioeiydla2umn s;u)alenmr3iatfaDeau ols)teumim3nydol elneias) 2trur ot1tltnmictyslsDum(vonu)arxnxo ootfat auvs;s0t2xmim3iy4aleelnetas) Dur(mp;u0alx mociadfmDul(vs t4tetrxocoo1op  ai i;s  rum(m3io4ome miesasfsDum(mono1open o3tadlaDuauvo (0tltoxo oo1oat  nesls)teum(r oodlpenlnesls)a2tmx  no0tltnmf3tadfsDrm(mp;t4altrmr oadom e ivi t0trtrxo io4lm   nvsasfartrumono4tpxn oetydls2ean ont) lxnmf tadoat an s;t srxoxopio1al  mictas)srua(mpoo0tle  ieiltla2ulump;u0 lenir io1lpt aies;( setmxr3iydlmt lici tfaDumxm nt4aexo fetydfa2rmnvonu4 ltnio io1oa  an o;s0srtrirpnu1apenmnvia(  rurur ot1apx mi3iltlmDeau p;u0tlenxo3iy1omD li i s) rxoimpnu1ope lfetls) Dtru o;u1tpx  i3iasfs2ua(mon(0tetnmfcootomDrlnes;( trumir oydame lfviat)a2trxmoot1tptnioetldfaDum(mo;(4arxomf iydoa  luvo t  2uoir oy4om   ivsl( a2rm(r no1oetn fetaslmDrmuvonu)tlerxrcta1fpDeauvsl(0t2trirpiu4ameelivtat  Dum( o;t1olxo f3tyslm2uanvont)trenxf iotomDe uvi;( trxmxopio1llt liei t)arraxmp;t4aeeomfcias sDum(vs t0aetomfcto1oaDelu o;t  etmxrpny1lme mnetl()a2tmump;o1openio3iydfm ul( s u0 rxnxo totlmDraivolt0 ruo(m nodomtemnvs s  rtax  nt4tetnmoeiltfaDea(mon(0artnxo3tydfp  lnvs t t2uriopou4omt lnvilsfartmxr oo4aeeoioeiys a eanvpn(0 ltoxo3totfpDe i s;(0srurimpnu4lle livt tf rtrxm ot1tleomo3iat a umnmon(4 renxr tytfpDr i o;()trxoxo3nudaleemieiatfa2rr( ont1aexomf3tat s2em(mont0tltrxf3todlmt lu o ( sexoim3oo1ome  icils)arurxm nt1tpe  fetaslm em(vpn() rtnmf3iotlaDr u i;(0t2uo(m3oodoltemfci (  2urx pnt4tex ii3iadfaDuaumsnu4aetrxrctadfmt anvi;t  rxoxrpio4al n fvilt) Draxmp;o0alto oetytlm2um(mp;u4alenir3iydfat  ues;() rxrxrpou1am elfei t  Duru ont4tlxo octyslm em(vpnu0 lenmr3iytfpte u i;s)t2uo(rpnudom  livtat arurx onu4altomi3tasfs2emnmp;t)artnxf oydfa  aivsl( trumxr iu1alte ivt t  Dta(rpnu1aeen o3iltls2em( p;t)trtoiocio1om r iei t  exriopoo4ol e ivt s) 2ta(mpnt1tpeo ociaslm2eaumon(0alxnmrciotfmteluvo ( seur(m io1lltnlnctlt)s2taxr ;t1tpxomoctatfs2emumonu4aeeoifcoodlm e u i;(0trtoxm io4ale lfciasfaDumu ont1tetnif3iaslm2ea( sn(0 eenircoa1fptr ueol() rtoxopiy1opt lneias)sruaxro;u1tet  ictytfm ranvp;t4 renxf oy1fmteluvils0srtr(m3nu4ape lnctas) rra(m ot4alxo i3iyd mDrm(ms;t) lerioctadoaD aies s0 2umirpoy4ame  fvsat)a2taxm ;t4ale mfeilsls2em( p (0teeoxf oodomDe uvi;t  euoio no4lm emnci ()artru p;o1aleoii3ilsfsDeau p;(4aeeoxocto1lptrai il( s2trxm3nu1oltelics s) 2umx o;t1aetnmfetls m2rlnvp;u)tltrif tytopt  iei () 2xr(r3nodam  lies s s2rmxr ot1apxn oetltls eanmsn()trenxf oo1lmD  i ols0s2xm(m3nu4llt  fes (  Dtr( oou4tltn ictyt m ea(vp;u0trtrxfctytlpD  ieol(0t2umio nydamen fcsls)srrmumont0teeomo3ilslmDum(mo;t0teeoxf oodlmD  i o;s)trumio oy4lp n ncslt aDuauroou4oexomf3ilsfa uan ont0trtrxfcoadlm rau o s0t2xo(m3nu1amee nvil()a2trx onu0tpen fctydfm2umuvonu)trtnxf iydfp ranvilt0tetoxm nu4amee ncsatfarrmumpot0apx  fcildfmDelumpnu) etrxrciotfpte uvils0 exrio3nudoltn fvta(faDtmxr oo4oetn iciadfm2ulnmo u) ltomr to1lmt aivols) rtmxm3iodlp elnetlt s2uau p;t4aptnmfeiadfs eau p (0aetrirciytfmtelnes s0trum(m3nydol  mnciat  2ra(r no1tlen f3iys aDuanmp;u4tlerxf3oadop rlues t) exrxo3oydol n iesls)arur(mpnt0aexo o3iltfa2rmnmpnu0trxrmf3ty1oa   u o ()trtrir no4apeelfvta( artaur ;u0alto iciadla2ranvo u)arxoio3ia1opDean o;s teuo(rpou1ameemnctat) rrr(r nu1opxomi3tatlmDem( on(4alermoctodoaD liei;()t2uo(m ny1ll e ivt sf rtmxmpnu4tetn iciytfs2ulums;u) rtnxf ootfa  an i (0t2umir nu4llenmicils)srtr(r ou1tpx mo3tatlmDeanmonu4artoir oadfmteau i;s)truo(o no1ap   fctl()sDtmxmo;u1tpto ocilsla2rlnmon(4alxrmo3oodfa eli ols) rtoio3ny1om emfvt t)aDrm(moou0tpt  octydla2raums;(4trtnxr3to1omD  i s;s) exr(rpoodoltemncsat)a2taxronu4tpenmociad m emnvont4texrmocoy1lpt aivs ( trtmxr3nudlpte icsls)a2rmumpoo0open ieils m2ra(monu4 rtoxo3oy1fmte ues;s0 2tmio nu4oleelfes (  2ra(r ;o4alen o3ias sDemn o;t4altrxrciytlpDe i sls0 2tmxm3io4omtemnvslsfsrurxmp;t4oetoifetyd s2rauvp;(4 rxoxrcio1op eli s;() etrxr3iy4openlfcil(fs2uaxm ;o4oet mieiatfa rlnvon()tltoxo3ta1lp  anei ()trxo(o3iodlp  mfes (f rraxm no1oltnmieiyt a rlnmsnu)tlxrxocto1lmDelivi;s) rxm(r3iudap  lnetl(f Draxmp;t0oexo f3iltfaDrlnvsnt0 leomf3ootfmtrlivi;( srtm(o3no1lltelfetl(fartaur nt1optomo3iad mDrlnmo;(4alenmf todla r i o;( trtrirpou1ope  icslt  Drax  oo0tetn iciyd a2eaumpn(4 rxnio oa1om r ivsl( truoir3oodome mfetatf rraur ;t0tee ii3iydfaDrlnvo t0aeenxf to1fa  anvs t  etrxr3oudlpeemfvta( srtaxmpnt1optoii3iytfa2ulumpn() ltnmr3iatlateanes;t0t2xr(o iudapenlnvias  Dra(mp;t0oetnmociltfaDulu s;u4trxnmociatfat  neslt)teuriopoy4ole lfviasfs2raumpnu4oex  oeiasla ulumo t0 lxoxf oa1fatr ies;s)trxo(m iy4lptnmictas)aDumur ;o1alenmo3tadfm2rmu s t4tltrmo3totfatrln o;t  eurir3oydlpen icsl(fs2ua(rpou1tltn i3tysfs2ua( o;u0 lxrir3oo1fmDe nvs;()seurxrpoodlp  lieilt)a2um(  no1opeomoetld a rlnms t4teenmr3tadfmtraueolt)s2xrxopoodam emfcs ()sDta(mp;t0oexn o3tldlaDemu o;t)trxomf3oo1fa   u o;s)texr(r nydlp elnetlsf 2ra(mp;t1tlt mfciat sDemuvs u)aeerxf ty1fp e ivo t0 2uriopnudoltemicsas aruaumont1aee  iciytls2emnmo;t0arxnxr3iy1lat  ueils setr(opoodol e ieia(  rra(r nt4oetnmi3iasfs emnvo t0alerioctotlatrlies s0 rtrim3oo4lpt  ncslt  2tr(monu1oet moctyslm em(von()aexrir iadoatrlneils)trto(mpnodllte iet tfarta(r ;u0olxoifeiadlm eln p;() exrir totomtr nesl() rxrim nydamtemies sf 2um(  nu0aex  f3iysls um(mpnt4arenmf oodfmDe neols s2tr(mpny4ale lfeia() Dtmxm no1olx io3iadls umu pn(4arenircoo1opDelies;s0sexm(o oy4lle mnetls) rtr(m no4aleoii3tltlsDrmnmont)aeeomr to1fmte iei;s teuoxo oo1apee ncias) rta( pot1olxnifciadfm2rlnmp;t) rtoxf oytfaDrln il()s2trir oo4lp elfci t aDtm( pou0oltnmo3tlslm rmu o t0 exnmr ta1la  lu slt s2xmio oy4al e netasf 2rr(  ;u4tlxnifciytla2umn pnt4 rxrir3tatlmDrlnes;t) exr(m3iu1olte neias srrrum ;o1oltoii3iydfaDemnvs;u4aexnxrciytfmDr uvilt seto(opiy1om  licta()s2trx poo0opeo oeiltla ranmp ()arenmfciatfpt  ivs s)trumxmpoy4llte fvi t)sDrr(mpoo0aeeniiciatla2rlnmp;() lxrxr io1fa  an i t0 exoirpiodlpenmfes sf 2taumpou4oex mf3iltfs2uau s;u0trtnxo ia1laDeli s s0t2uoio3oo4ol emfcsls  ruau o;o1opto o3iytfs2ulnvs;t4arerxf oodlaD lu i t trtr(o3ou1ap n netlsfsrrr(mpno1altn iciyd s2ra( o u4 reoir3to1om rlivolt0 rtmio3iu1lmtnmfei t a2rau  ;o1tleoiietydfm2ua(mp;u4tleomo iatlaD an o;s0 2trimpnu4al nlnetl(  rrrxmonu4openmfeiyt s2rmumo;t)areomf ty1lateaues () 2xoxrpio4lmeemivtas  2urxrpoo4tlt mf3iyd s rmnmp t) renio iy1la raueo;s)sexm(r nydamtemfeias  Drrurpoo0aptomocild a2emn s;()trenmrcto1omteanvo;s) 2xr(r3nodomtnlnvtas)srtm( o;t4tlen fctlsls ulu sn(4 ltrir3ootoat aivsls) etm(rpiy4olen nvsat) Dtru o;u4open iciad aDul(vp t4 rxrxr3oadoatr ies;t s2tmiopiydap nmivtlsf Dtru p;t1tlxomf3tadlmDum(vo t) reoxr3oydfp r uvi;t)setoxm3nudaltemfviat sDua(rpno1teeo oetlt m2em(vo;u0tlxomr3io1om rlu s t) rur(opiy4apte ivsas aDtau  ;o1tpe mi3ilsfa eluvp;u4 lenifcia1fatrlivs;() 2uoimpiy1lmt  fcsasfsDtmur no0tetnii3iaslsDrmu s;u0 etoxr ootlp eli o s)setm(r3oo4opt  fvias s2ur( ono1apxomi3iasfm ranmsnt4trtnmrciotfp  au ols texmio oy1lp e ncsat aDumur no4alxomoeiltls umnms (4artomf3todomDelu ils) 2to(r3oydale lneils  rtmxr nt4tptoio3iyt m2el(vo;t0trtrio oodlaDe uvols0 rumxm ou4apenlfetlt sDrruroou0aet iiciytlaDuauvs ()aleniociydoaD auvslt0trurxm3ny4opte fci ( aDuax oou4aexn ieiasls2rl(mpnu0altnxr3tydlateaivo;t  etrio3oy1omtn ictat srra(moou0aptnmietlsfa ea(ms (0 ltnmf3oytlmtr u i;(0 rur(mpno4omt  neta()srtaxroou1oeeo ocilsla uau snu0aleomo oodlmDranvo ( t2xmir3oydap nmivsat) Drr( p;t1oltnif3tlsla ea(mpnu0 leoxf3oatoa ean o;t)sexoxrpio4lm  mnesatf 2rmxrooo1tleoifeiys s rl(mp;u)aeerif iadfptr i o;t0s2xo(o io1ll n nesa(faruaxmpou4tpxnmfciad mDean ont) etoxfciodlmtraneilt)setr(m oodlmenmnei s)aDtrx oot4tee ii3iydlm emuvs t) lxrxf3oa1op elneo;t0 2tm(m3iu1am  liet sfs2raur ot4aee iocild s umumo;t4aexoxr iytfa  auvs ( t2xmxm iudalte ncsa( sDrmx oot4tpe ifeiaslmDeluvo;(4trtoxf3tydoatr uvs (  2xo(rpnodopeelieia()sDrru o;u1tlenmociltls2rl(mpn(0 renio3ta1la rlivil( t2uo(m3nodom emicil(fs2ra(m ;o0oetomo3iys s elnvp;u0trtrmr iatlpte u ils)t2uoxr3iydapee ncta(faDuauro;u1tlxomi3ildfmDrl(mpn()arxoxo iytlpDr u o (  2uoxo oy4llt miesls srumxmp;o0tleoifctytfs2ra(vs (4 ltoxrcoadomtr nei t0s2um(o3iodlleemici s s2tax  nu4opxo i3ilsla rmnvp;t) exrmf tydoa   ueils0teumimpoodll  micil() 2tmxmp;o0tle  feiys mDrlumo;t0alxoxo3iy1lp eluesl(0 2trxm iy1ll n fetat srtru pno0altnmietyd s2ra(msnt)alxrxr3iotfm rlueil(0 2xr(opiu1oltnmnctatfsrtr(mp;t1ape mictlsfs2ranvp;u0 reomf3todopt an s;(0t2xm(r3oudom nlivt t)s2tru onu1tleoii3iyt s ea(vp t4tetomo3iotla e iei s0teumxrpiu4op  miciat)s2ua(roou4tlxomocils s uanvonu)tlxnmrctotlaDelnvs t)t2ur(o3ou1lmte ieils)arrmu  no0aetoiicils sDeanmsnu4tltnmfcoatfm   ieol(0 2umim oo4ap n nei s  2umur oo4aetomf3ilt a2eanvsnu0 eenxrcio1omtr n o s0 exoxr oudaptnmfcsl( sDrrumo;t4oleo feild s uanvpn(0tlxnmo3oadfm e iei (0 etm(mpnu4op   icsa(fa2rm(rp;t1teenmieiys m rlnmonu4trtnxo to1fmD  nes;s0t2um(o3iu4lme lfeslt)artrx p;o4tlt ioctlt m2rluvpnu)arxoxrcta1oate ivs;(0srumxrpny4lmeelfetas  2urxr nu1oeen i3iasfmDemu s;(0tleomr3tydlptraivi ( trxmirpny1aptemicsat)sDtmx  nu0oee micild m um( s ()tlenirciydfmD  uvi t)tetr(m3nydol n nes ()srumx  ;t1tlen feiatlmDum( o t0trxomf to1fa rluei ()tetmir3no1omt  fet (faDrmurp;t1tet mocils aDemu o;u)aeerir iadfmDeai ilt s2xrim nudap  mnei (fsrtmxr ;o4olt  octys aDeaumo;t)alenmrcto1laD lu olt  rumirpoy1ap nmfvsa( aDtmur ;u4tptomicilt a2umnvon(0 rermociytopteauvi t)seuoim3oo4alenmivsas) 2rr(mpou0aee  octysls elnvs u)trxriocoadfp eaivo t) eur(o3nu1aleemiesat) rrmuroou4tex mo3tas m ua( ont4treniocta1fmteauvi () rxoirpou4lmeelncslt a2rmx  ;u1tlx iietldfa2umnmpnt0 lxnxrcoadlatrauvs s0 2tr(mpiy4am nlfviasf Draxm ;u1texnmfetasfaDumn p (0tlerir3tytfa eauvsls trumxo3oo1lme  fvsa(fsrrrurpot4aeenmociytfaDel(mpn(4aleoif totfm  lies;t0t2umir3iodale  ieslt)aDrm(rpnt1olx  fetatfs2rauvo;u4aexnxf ia1latr ieslt)teumxo3oydlle lictat)s2trxmo;o4tle  ieiltlm emuvp u4aetoir ty1lm   nei;s)t2xo(rpnudame mnvtl(  2urx ooo4tlenmociasls umnvs u0 lxoircta1fmDeaiesls trurir3iodlme  fcta() 2tm(  ;o4apt  ieias m eluvs;u0tltrir3todlm r iei;s sexrxm oodol e nesa() Dtrur no0oeenii3iaslm2eauvp;t0trxrmo3iy1fmDr nes;( seto(r3ou1lltelivt t)srtru  ;u1tetoiictaslaDumump;()tlerircoadom rau s;s)sexrxo3io1om  miciat) rra(  nt0oex mieiytfa uaums;()aetnir oydlpt liesls) 2xrxr oydol n fci (f 2tm(rpno4tex mociydfs2ea( p;u)trxrif oydfm e neolt t2xoxopoudapt lnctl(  Drr( ono4oltnmoeilt mDeluvp;u4teeoio3iotoatrlnes;s) rtmxr oodlleeliciatfa2umxmp;u4tpenio3iysla2uluvo;() lerio3iodopt lu olt0tetr(r nodlle liet t)srurxm oo0aee ioetydfs rmn s u4 rxrxo3tadfa e neo;s)srtrir oy4amt  ivt s a2rmxro;u1oexnioeiydla umn pnt0 etrmr3oy1fp eaieo;()trxmimpio1ap e nes () 2uax  ot4aleniociaslm2rm( onu0texoxociytom e uvs;s)srxr(mpiy4lmeemnct s)sDrmx ont1tlx mietat mDrlnmsnu4 eenxfctadlat aivslt0srtrxm3ou4omenmicia()sDrrxrpoo4tlxoifciys m rmn o;t) renif3oodfaDrli i (0t2trxo nodamte ieiatf Duaumo;o0olen oeiaslm2uauvont4aetoxocoa1oaDe uvo s trto(r iu4aleeliciat srtaxroot0tpenmo3tadfm2umump;u0 leomr3tatfmDr nvi t0 2xoxr io1ap  mfetltfarrmum oo4olx io3tysla2el( s;(0aexnmrciodomDr uvils)trurirpiodale mnesatfs2rmxro;u0tpxnmfetlt a2umu p t0tetrxrcoytlaD lneol() 2tm(opoy1apeelnesl(faDuau p;u4tpeniicildfm ean p u) rxrmf3iytfa  lnvo t)trtmio oy4omte ncilt)sDrmum ;u0oex mo3ilslmDemnvo;u)arxnxr ia1fpDrlivs (0 eumxm ou4ll n neta()srra( onu0alxomfctatfa uau o u) rxomrctotomt li o s) eur(r oydoptemicta()arra( p;u1optnmf3tatfs2emuvsn(0aetoio3to1fat  i o;s0 rtr(r3iu4apt  iei s)s2tmxront4oetn i3tat a uluvp t)trerxr ootoaDr uvs (  rtoxopiy4aptelnvi s)a2tru oou4aetomociasfs uau pnu4teenif3totoaDrln slt)s2trir3ou1amtnlnvt ( a2raxmo;t1alto i3iltlmDemnvp;u4aeerxfcty1faD  neo;(0 2uo(opiydameelneiat  Dta(rpno0oexnioeiasfa ran sn(0 exrxf ia1lpDr ueols)srxrxopou1opeelnvil( s2urumpno0oeto fciys a uauvo;(0trxrxf3iydlaDe ueil(0texmio oodlme mfvsa()srtrxm ou0opxnif3tysfa rmn o;u4 lxoxf3todlaDe ivs () 2trir3nudlp emfvt ()s2ur(root4tlxoiiciytla ul( snt0altnmocta1fmDr neo s trxmio nodom  livtas  rrmuronu4oltnmoeiytfa rmuvp;t)trenmo oytoaDr uvi s) ruoxopoy4opt lnciasfsrtm(mpnu1alt mo3tas a ul( o (0arerif tydlmteai i;t t2uo(r3oo4ol   fei (fsDrmxm nt4oee ioctas s em(ms;()artnmr ia1fmtrauvolt0t2xoim3oudal  livt ()srurxrono1teto fetytls rmnvsnu)arerxo oo1lpD au o;t) rurxo iodlm  mfvsls artmur nt1tpx  icils aDran p u)aleniocoy1fate u ilt) etm(opiy1lm  mivsls)arrm(  oo4aexn iciysfm umnvsnt)aexoxrcty1omD aieils0s2trim3oo1lp n nvs (  Drrxm nu4aee  ieiytfm2rauvs u)altrmocoadlmDrau s;t) etm(r oo4lpt lfvtl(fsrumxmono1tex ifeiysfm ea(ms;t4alenxfctatop   ieo;s0texrxo no4ole  netls s2raxrpou4oexoii3iydfm ulu o ()arenio tytlat  n i t0t2toxo3ou1lptelivs ( a2ta(r no0tleoifctasla2rl(mpn()tleoiociatlat  uvi;s)srumir iy1omt lici t)srtmum ;t1texnmfeiytfa2ulumsnt) exrmf3tytoptranvol() 2tm(opiudoleelnvtatfsrtrxmoou1tpe mfeiatls2ra(mo;t4 ltoxrcia1om r neolt t2xm(m3iy4lp  miesas  2taurpnu1tlt iociysla2emnvo u0tetoiociy1lmD aneo;(  eurio oy1am   fct sfa2urxmooo0aet ii3iyd m ua(vp t0 rxniocia1lpDranvi;( teurirpoudlm   icslt)artauront1tpxnmociytfaDul( s;u0alenio3oa1lmte nei ()t2xrim3ou4ame  ivsat) rtrx o;u4apxnii3tyt a ulnmo u0 renmf3ty1fmDraies s0t2trirpnu1ll e nvt t)arrr( poo1aexniietlsla ra(mpn(0 etnif3iatfaDrlivs;t)t2trxo3oo4al elieilt)artrxm nu0apxnif3tysfmDem(mont4 etomfciatfmDeaueilt sexoxopoudapee fcsas) rtaxmp;u0tpe miciad aDumu ont) lerxocoodlatrliei;t0texoio3oy1am nlies sfa2tm(r ;t1aptoio3ias aDrl(mo t) lermr3oytlp  anesls s2tr(r no1omen ici tf Duaxm ;u1oeen f3ias mDrm( s (0tltrmrcoy1fmtr ies;t sexo(mpoo1lpe mfcsasfsrrrxmp;o4optoifeiys s2eaums;(4tlerio iy1lpD  uei;s)setrxmpoo4optemnci s)srtrumpnu4opxnmieiasfs2rmuvpnu0 etriociadfpDelu o t0srur(m3ny4amtemfes () 2um(rpnt0oexoioetysfsDulnmo;t0 rxoiocoadlp r uei s0trxrxm3oudlm elfviatf 2ur(ro;t1tlxomi3tltla2elnmo;t)trtomo3iadlpDe neo;t sexrxr oy1opeemfcias)arraxroot1olxo ieiadfs eanms;t)tlxnmfciytop r ivi t0srtrim ou4omenliesa( sruaurp;t1tleomo3ild s2ra(mo t4 leoxrcio1laDr ies t0tetmxo oydam nlnesl()aDrmurooo0oltn f3ias mDuan s;u4tltoxocoo1opD  n o s) euo(opnudam emiesls aDtm( o;u4aee mfctys aDeln s;(0 ltomr ta1faDranvo;t)texriopny1llenmncia(fsDtax ooo0openifcils m ul( pnt) etnxociy1la e neilt  eto(o3oy1lpeelnvilt  2tax  nu0tet  ocilt s umn s;(0artrmr iytomDelnvs s tetrir iudol nmnes t s2uaxrp;t1oeen fciydfm emu p t)texnirciatfaD  nesls)texoim no4omtelieiat)a2rrxrooo0aetniieiyslsDeanmp;u0 ltoir3oydfmDeanes t)s2trxm3ou1llee fvsl(f Drm(m ;t4tle mo3iad aDumnmpn(0aetomo3oo1lp elneo;(0 rxmxmpny1ole lici tf rraxrp;u0olenmfctatla umn o;t0tlxnif3iodoa ean i (0t2um(r oo4aptnlncsls) Dra( onu4tpxomictys a2rm(vo;t)tlxoio todfm ran ol( srxo(o nodaltemietat)sDtaurpnu4tlxn ociaslsDrm(vo;u4 eeomfctotlaDe n i;()tetoio ou1lp elieia( arum( oot1olxomocilslmDrl(ms (4areoif totfm elieol() ruo(r3oodlp nmfei s)aDraum nu4aexomf3tat m uln s u0teeniocoytlpDrau i;t)sexmio3ou1lme  neiatf rumu  oo1ole  fciltls rlu p u4trtnir oatfp  lu il(0t2tm(rpnudap e netl(fartau ono1aptomo3ildfs emumont0 exrmf oodfat livo;s  exmir io1lm nmnes sf 2uaxm ;t1aptnmfcilsfsDrau p;u0 exrifcta1fmD lnei s) 2um(o oo4ap  mnvtltfa2taxmooo0alt io3iysfs2ra(vp;t0trxrirctydlpDr uvi;s0 2trxo oodlmte nvsasfsrtmump;t0alx mfetls sDra(vo ()aexoxo3iydopD  neo ( s2tmxr3oo4lpt  nesatfsruaxm ot0optn oeild m2rl( snt4aeenxo3io1la r i s;s) exrio3iy4op e ietl()srta(ro;o4opt  f3ilsfsDul(mpnu4altnmo ootlp e nvi t  rto(rpiu4ap   neias) 2rm(  no0tpx  ietydfaDumumsnt0texrif iytlaD  ueilt)srurxmpnu4al   iesas) Dua(monu0aptn ieiyt a2rmump (4artrio iytla  livols0texrir iy4olt  fvia() rrrumo;t4tpx mi3iydfm2rl(mont)trtomr3iadlp ean ils0s2toxopio1lmenmfet tfs2rmumpnt4alxo o3iytla rau o;u4aetomr oa1la eli s t t2um(mpiydamee nct t  Dtr( ono4apx iocilt aDeauvsnu)tetoxf oy1la eaivo;(0trtoirpio4llenlfvsa() Dtrxmono1oet ii3iad s rm(vs;(0altoxr oo1fpD luvils)trxm(opio4amee nci (f Dtax ont4oleo o3iyt s rmu s t4 lxnifciytom   uvo t t2urir3iydomenmfctlt  Dtrx p;u1alen ictysfs emnmo;t0teeoxrciatlateluvilt srxmxmpoy1lleelfeslsfsDum(r no4tlx ifctltfs2uluvonu0 eeoxf3tadlmDeluvo t trtmxm3nydlle  ietat) 2rau o;t1tpxomieiatls rluvsnt4alxnif3ia1la rauvslt)tetmxr oy4ol nlneiltfaDra( ooo0tex mo3iatfa eanms (0tleomr to1oaDr ies s0trtmxr no1ll   ieil(fsruru pnt0tpx mo3iyd sDeanvs t)aexomr3tadlmtr ies (0 2xmimpou4ol   neta(fs2tr(mpno1tpto o3ils m emumo;()alxnmfcoydfmD lu o (0 euo(m3oy1omt  ncils)s2uaxmonu4aptoifetyslsDumump;u0 etrmo3oatfmteai ol(  euo(o iy4lp n ivtas srta( p;o4tpto icilt mDrl(vpnt4altnmr iydfmte ivol( teuo(m3ny1al  lici sfaDumxmpoo0apt ii3iydls2rm(ms;u0alxrmo3oa1fm  li s;(0 2uo(opnu4apeelfei ()s2tau p;u4altnio3tldfa2ranvp t4 rerifctydlptrlues s0 2uoxmpoy1ape  ictl( a2rmumpoo1tlt  i3iltls rmumo (4artoxf oadomD lnvils)trtoxopoydam  mncs s  ruau oou4oexniictlt a ranvpnu4alxrxo ootla rlueolt)srtrio iydapee nvt t)a2ua(rpnt0oltoifeiadla el( o;t0 rerif totoa  aneo (0 2xrir nodlme mfcta(fs2tmxrono0opxomo3tydlaDrlnmp;(0texnif io1omtelnvo s t2xo(mpny4al  mnvsl(f 2taur nt0tlxnioeiasfaDrmumsn(4 rxoxrcoadoaDrlivs;(0truoim3io4lm nlivsltfarrau pno4tpeoii3iyd aDel(vo t0 etrxf tydlmD auvol( srur(r ny1altnlncsl(  rtr(r ;u4aleomietldfs elnmo;(4artrio3totfaD an o;s trxo(rpnydol nmics t)sDta(mp;u4oee  fciydfm ea( on() rtrif oatfa e uvsls)teto(m3oo4olee ivtl(faDtrxmpoo4tee io3tldfm rauvs;() leomf3ia1fp raneils t2tmxopnu1lpeelnvs tf Drmu ooo4oeeo ieilslaDul(mon(4 rxnmfciadlmt aues s)trxm(opoydap nlivtlsfsDtmumpno4tlen f3iltfa2rlnvsnu4 etnmo ootoaDeanvi;s) 2um(opnydapeelnctat arta(r nt0olt if3ild s2elu p;u4texrxfcoy1lmD lnei t s2xmxr3nu4alenmicia(  Duau poo0aet  oeiyd a2elnvsnt4areomf oy1lptrai il()sexoio3nu1altelnvt t)arta(  oo1apx iiciltfmDuanms;t4 lxrmfcoytlaD lneo;t0sexrxr3oodlltn ictasfs2trumonu0aet mi3iatfa uanmo;t4aeenmr3totfm  auei ( t2ur(rpiy1llt  feta() rtmumpou1alt  octlsfm uan o;t)altrmo3ta1fa  anvsl()srumxm3oo1omtn ieta(farra( p;u1alen fctydla2eauvonu0 lenir3iadlateluvo;t0tetm(o3io1lm nlfetlsf 2tr(  oo4apxniietyd m2ra(vsnt0 ltoif ta1faDeauvi;s)t2urxr oy4olenliei t srrm( ooo4tex  fcildfaDrau s u) reomocootoa ean i;(0seto(r iu1lptnmfesa()a2ua(rp;t4altniociasfm2rmn pnu4tltnir io1opD luvsl()trtmir iydap  lnvs s  Drmum ;t0apenii3tatfs2rl(vo;()aetnmf ta1lpDe n o;s trtmxo nydoltnlncilt arrmu  ot1ale mfeild a2ea(vo u4alxrifcto1lpt anvil(0 rurir oydame  net s a2rrxrpnt4tlt moeildfm2ulums;t) lxomrcoodlmDranei (0setoxr iu4optnmiesl(f rtrxro;u1opxn octat s2eanms;(0artnmrctodfm   iesls srur(m3iu1om nmivsasfsDuaxm nu0apeomieildls2rmnvpn(4alenxf3oytom r neil()texmim3io1ome micsat) rtmx  ;t4apxoiietysfs2ean p;(4 rtnxf oy1lp eauvi s  euoxr io1om nmnvsatfarraxmp;u1optoifciytfmDranvo t4aeenir oadlmD  u ol(  rur(m3iydam  mnvilsfa2rmxrp;u4tet  f3tas m rauvo u4 rermr iodla rai ilt) rtoxmpny4ol  mivsl() 2ua( pot0texoiieiyslm2ul(mon(0 exrmo tadlm  au slt0seumxm oodaleemnetlsfs2urur ;u0texomoetydlaDelnvp;(0 etnxr3tydop raneo t srxrxo3iu4ll   ivi t)artmxr ot0aleomieiyslmDea( s t4artrxr iodlmD lneolt t2uoxrpiu4omt mivtas aDrrxrpot0oetnmoetadlmDelnmo t0trxnmrctodfate nvsls) rurim no1opt mfvs sf Dua(m ou0apt moctldfm2rl( snu4arxnxo ty1lptrlueslt  exmxm3no1llte ivt ()aDurxr ;t1ole io3ilsfmDran s u) etomr3iodfmtraivo;t) rxrxopny4lptnmncils)a2rax  oo0aleo o3iadfa2elnmo t4 etnmo tadfp rlivolt s2xoir3nu1ol n icil(f rtm(mpoo0ape  ieiasfs ra(vs t)aetrmr iodoptrliei;t0 2tmimpiy1lm e nesl(  rtm(m nu1optnif3iat m ulnvon(4aetnir3iydfateluvo (  euo(o3oy1oltelfvt t  rrrx  ;o1ole  o3iysfa rmu o () leomfctadfmD  nes ()setr(m3no4lm nmicsatfaDrmurpou4oeeoifeiyt s ua(mpnu)aexomo3iy1laD  nvsl( sexrxm iydomte fet t sDraxro;u4teeomoetlsfsDrl(vs;u0 rxnxf iydomtrluvi;()s2umxmpio1ll e nei ()s2ururoot4tltomfetadfaDrau o;t)trxoir3totomt lu i;( tetr(rpny4altnmncsl() rum(m nu1oleomiciyt a2rmnmo;t)alxoifctydfmt au o t)sruoxo oo4ap e fvtat)sDum( o;t0olen ieiatls2eln pn()teeoif oodlm r nvi t  etrxm3io4ll  mivsls a2trxmpno4opt  octltfm2ulu p;u0altnxr iadla r i sl()trxr(r3nu1olteliet tfarumu ont4teto f3tld a ran o t)altnmr3iy1oatranvo s  rxr(r3ny1lltnmnvi s s2tm( poo4tleoii3ild sDul(vonu4 rtnirctytfm raiei t0 rxo(r nudamtnmies ( s2umxmono1tpeoio3tydlmDean s;t4altrmr3oytoaD luvo ()t2trirpiudol  mfcsl( artau  nu0opxn fciytfa2raump t4 leoxr3to1opteanvol( trxoxm oy4al n ncta() Drau pou1oleo feilt aDrluvo;t0 rtnifciytop   u o t  rxoxrpnudopt mnvs tf rrmxmp;o1tle mociat s2emnmp u0 lxnmf oytfmteluvi;t sexm(o3ny1op   ivs t)arururpou1tltniiciat m em(vpnt4 reoxo iytfatrlivol()s2xr(m iydomeemnei s)aDurur no1opxnmicilsls rm( p;t4trtrmf3oytom  livi s0 etr(rpnu1apt  fcsat  2ur(ro;o0oeeo fciat aDel(vs;t4 rxrxocoytlaDeli il(0sexr(m oo4aleelfci s)artrumpoo0oeeo o3ildfs2rmnmont0texrif3iatfp  luvolt  eumxm3ny1lp e iesls) rrr(r nu0oexo i3ilsls rl( s;(0alxrmo3oa1lpDeaivolt) 2toxr3no4al  lict sf Dua( o;u1optn feilsla emump;(0trenif todlm raivi;( s2tr(o3nodaptnmnvs ()srraumpnt4olx moeiaslaDrmnmpnu4 exnxf totoaDr ueols) 2umio oy4llt lfeilt)sDtmxrpnu4opxo o3tysls2rmumpn()tlxnxoctydoa ranvi t  2uoxrpiu4optelfeiat  rtmx oot4tpt mfeiys s2el(vp u0tetrmr tadfp eaivi s)trtoimpio4lp elivta()arta( oou1oeen iciatfm2rmuvp;u4arxoxo tadlmD  ieo () 2xoio3ny4lltnmfvsls  rurxm nt4aexn octad m2elu p t4 exoxf io1lpt anei ()sexm(o3iudal  lfeta() Dum(rpot0tptomfctyt a ea( ont)arerir oadopD lneolt) 2tmir ny4lltnmfci s)s2tmuro;u1optnif3iasfsDuan pn(4areoif to1omDeai ols seum(o no4apenlnes ()a2ur( ooo1tptn iciytla2elnvo;u) eeoxrcty1lp  aiesls  rtr(rpiydllen ivilsfsDuau oou0aeeo i3ils a elu snu0aleomrcoatoat lnvs () 2umxm3iy1omtemfvilsfsDtrx onu0aexomiciltlsDeauvp;(0alxrmr3tytoa   uvi;s srtmim3iy4ol  lncsls)srumxr ;o4olx  oeiltlsDelumo (0 lxnmf3iatfm e ivo s0sruoim oy1lp e ivi t)s2rr(mp;t0apx  fctasfsDuanms u)areoxocoo1om e u s s)srum(opio1lle lfcias  2rm(  ;u4oexomfetls m2elump t4treomf oadom rluvs () etoio oy1op  mneilt arur(mono4oex  octadls2el(vont0trtrio3tadopt  neils)seurxopoy1amtnmnetat) rraumono0oet ioeiltfa2ul( sn()altomr iytlp ranvo ( srum(o nodlltnmiciat sDur(mp;u4tlenmfetytfm2elump;()aeermf3oo1fp r u sls)trtmir3oodol nmfet ( aDrru pnu1tltoiociadfm um(msnu)texnio3ty1fptr u s;t0teuoxr3oy1opeelnvsls) Dua(mpot4aex iietls mDum( pnt0aetnxfcto1omDean ilt) rtm(m3iu4lpenlfviatf 2tmu pou0oexo iciyslmDuan s u4trxoio3oydfaDe ieol(0tetriopnydllte ici sfsDta( p;o4apeo i3ildls2umu pnt4 rtrifcty1opteln o;t)t2trxmpnydom n ncsa( a2urx ooo1oeeo ietytfs emnms;(0arxrxr oydop  livils0trxr(m nudlpenlneta( arraur ;o1tleomfciasls2eluvs t)tltrmfciydfmDran s;() rurxo3oodlmtnlnctas  Dum(roou0tpxnmiciydfs2eluvs t4alxoiociytfpDeaieo;s trxmimpoy1optnmnei s) 2tmuroot0apenii3iatlaDrmuvpn()tltriociodopt aueol() exmimpiy4lm n iviasfaDumx  no4tltnmoeilsls ulu p u4 eeomfciydomD ai o;t0teuo(m3iodll  liesl()aDrrx oou1oee ii3ilt m2ulnmont0texnircoydfp  auvil()t2xmimpio4lltelfvtlt  Drm(m no1aexo ictad a2uaumo;t0alxrmf3tydlm   u o t0s2to(rpoydole  nes s s2umx  nt0tpeo iciadfa eauvs;t)arenir tadop r n i s)trxm(o oo1lptnmfesl(f 2rrxmp;o1olxomi3iysfs rl( snt)trxnif3oytfa  an i ( trxoim3oy4omt liesas srtmu oot0tpenio3tyslm2rau pnt4 rxoxo3ia1lptelnvs t0trurxo3nudol elnvi tfa2umxmpoo1opxnif3iatfm ul( onu0 etnmr iodfm eaieo;t0tetr(m3iy1ale lfesl(fa2ta(r nt4tltomieilt s rmnmpnu4 rtrxf iy1opteauvi (0 rxm(r oy4ol emnctls)a2taumpnu0tpenii3iysfm ranmo;(0 lxoiociotlp   i i;()srxoim iudlp emnvsl(fsrrrump;o1optomoeiltlm rln p t4 etomociytlmD lueo;s)s2toir ny4lp n feslt sDum(mpnt4tleniocildfaDrmums (4tleoxrcoo1om elnei;(0 rxrxm3oodamtelictat)artrur ;t1tptoiictytfsDelnmont4aexoir io1op eaivils0 rxoxr3nudoptnliviat  Dtaxmont1tltnmieildfsDumnmo;t)tlxnxf oo1lpDe u s;(0truoim io4amtnlfct sfsDum( ooo0tlt iieiyslm2uau snu4arenxo ty1fm r n slt0 exm(rpiu4ome  iesls a2trxm oo4tltoiociydfm2ra( o;()aetrif to1fpDr i i s)seuoxr iudlltelnvil() Dumxrpno4apxnmictasls emnvp u)aeeoxo oydoat  nes t)trxrxm iu4oltn nvils)a2rrxrpot1olxomf3iytls rauvo u4aeermf3ia1fatraivi (0s2urxo3ny4aleelivias a2umx p;o4tlt mo3iadlaDumu pn() exrmocty1oaD aivi (0texmxmpny1olen iet t  Dtmxmonu4opt ii3ils s rau p;(0tlxrmo ta1fa  an s;(0tetoio no1lme  fcs ( s2rmx  ;t4altomo3ilsfm ul(vo;u0 leoxf3tytlpDelivs;t) 2um(r3iy4opeemncil(f 2ra(r oo0aexniieiaslm emuvsnt)tlxrif tytfpDr u o t)s2ur(mpnudlmenmieiatfa2tmur nu0opxomiciatla2uanvo t0 etoxf3ty1lm rlivi s) ruo(opnydlm emfcsl()s2tmxronu1aee moctld s rmu pnu)trenmrciadlaDe uvolt0trtoirpno1ol nmivils  2uauronu0tpx ifciadlm2em( s (0tlxoxfcio1omD  ies t0trxmir iy1al  lieslt s2tmur nt4aexoio3iydfs rmuvp;t0 lenxo tytlateaieo;( tetm(o3ou4ol   ici sfsDrrx pot4ole moeils s2uau o;u4 etrif oa1omt au o s)texrxrpnu1ome  fesls arua( ono4texnif3tasfsDelu o;t0 exnmfcto1lmDe n s;(0 rxr(o iydllt  nvs s)arum( p;t4tlt  feild a2raumsnu) rxoxf3oytomtrlueslt) etmiopiudapen fci (fsrtmx ono1oltn ictydfs2rlnvont0aeenir io1fpte neol( teurxmpoudapt mfctat)artrxmo;o4opx  i3tyd s rauvpnt0aeeoir3ia1lateauvi ()teuo(o3ny4llenlfvi s s2tr(  ;t4tpenmi3ildls ulnvs (4 renmoctydlpDeai o;t  rur(m3oo4amt  fctas  Dtmumo;t1apxoifeiydlm rl( pnt4altnif3iytlaDrliei t0truoir3io4lp  mnvi ( arururo;o0tpe  f3iad s2emu o (4 lxrif3ootomD  nvi;( trtrxrpiodlm nmnvias)s2raxm oo1tptn ietat s2umn s;u4 rxnmo tydlate nes;(0trumxmpiodom nlfet s srta( pnu0tet ifeiasls eauvonu) rxrif iotopDrlivs (0teurxopiu1ole  ncsas s2tm( ooo4tptn i3iad s rlu p;()aeenxf to1lp  aues ()truoio3oy4lme lnvtat a2trum nt0optoifctysla emumonu) eerxr3oodlmt lueolt trtrirpoodlm   ivtat  2ta( p;o4olxo ieilsfaDeauvsnt4trerxo3todlp  livil()s2xmirpno4om e netat)s2rru o;u1olt  iciyslm ra( s (4alenmf3ty1omDr nei s) etmxopiu1optemfvsltf Dum(mo;u0teen oeilslm2eluvsnu)aexoio3oydfmDeau ilt)trxrirpnu1lmtn fctas)arum(r nt4opt  oeilsls2umnvp;u)altnxr iytfaDr n i (0trtmio oy4ap  lfctlt)a2taur ;u0tex  o3tatfs2umn s;t0texnircoytomDraues;(  2um(rpio4oltemfvi ()artrx p;u1olxniocildfa2emuvp;(4aetrmf to1fat aueo;t0 rum(o nudlmenmiesatfaruaxmpnu4teenioeilt a em( s;u) lenxo tydlm  au s s)trxrir3iy4ll  mfvi sfa2rmxro;t0opxomoctlslmDuauvs (0tleoxo3ootfm elu sls0 rtoim3oodameemnvt sfsDumxrono0apx  o3iat aDrmnms;u0 lermo oa1fa elivo s) rtoxr3iy1omtn iciat)artaxr nt1tex ii3iatlm2ul( o t0alermfciatfm ean o;(0t2um(m3io4om n ncilt)sruau  nt0apx  oetydfsDrm( s t) rerio3tatfaD  uvi;s0setmimpoy4oltn nvtl(fartrurpot4ape mfctytfa ean o u)trtrmrctotoa  auei t)srumxm oydape lnesa(fsrtru  nu0oeen ietatlsDumnms;t0texrmf tatlatrluvi s trurxm3oodale  nvil() 2taxrpnt0tee mfcils sDel(vo;t0 eeoir3oy1lpD aneo ()seto(r3iy4op nlfvias)arrm(rpnu0oeenioeiatlsDumnvsnt0altoxo iodlmtelivol()sexoio3oy4opeelfci sfa2tr(rp;o1tex iieiys s2rmuvpnt4altnif iy1om e nei;( sexr(o3iu1op nlfcilsfa2trxroot0olt micils m2eluvont4 exnmo oa1fp ranvsls)t2tmimpoy4opeemnviltfaDtmx  ou1apenmieilslm2rlumo;(4 eeomocoydlaDe nes;( s2trxo nu4oltelnet tfarra( p;t1apeoii3tasfa2ra(mpnu0 exoif3ta1om rluei ()trxm(m iy1am emncia(  Duaur ot1ope  ietltfa emn s u4 leoifcoydfpt  ueo t) 2ur(o3oy4lpte fes s s2tau o;t4oexnmfctasfs uluvs;t)trtrir3to1lpDe ueolt) 2trxm3oy4am n fct t)srtm(mpot0opx  iciltla rmnvonu0teerxfcty1optelu s ( srtoio iy1openlfciatf 2tr(mont0olx mo3tydlmDumn onu4arxrxf3to1oat lnvs ()tetoirpoy1lle  fci ( sruaxm nt4aptomiciaslsDumnmsnu4alenir3iotopD ln o;t0trur(mpiu4lmtemiviat aDraxm oo4aeeomf3tyd s ea( p u0 rtnio oa1lmteluesl(  rum(o3oy4lpee ictls)arraxmpou0altn i3tatlm2ra( pnu4trtrif iodfaDrlneo;s0teurim ny4ap  mnei (fsDrax  ;o4olxomoetld s rlums;t4teerif3io1lmD  uvs t  2xrir3ou4llenlivsls) 2raxm nu1tlx iociatls emn p u)aleoifcoadlmt aieo;t s2xoiopio4openlfeias)aDtax p;u1apeoiociadfs rlu o t0 lxrioctytom ranes;t  2uo(r3oudll nmnviltfsrra(r nt4oeeomfetadls ulu o u)alenxo3iytlpDran o () rxrimpio1lpt  iet t aDrrx ooo4tlx  f3iltlmDuluvp;u)alxnmf3ty1lmtrlues;t0srxrir iudam n fvi t  Durum no0tet mietydls2emn snt4trenmfcoytfm   u s (0trto(o3io4lp e icilsf Dtm(rp;u0oltnifcilsfa2uan snt0 lxoxr3todla  auei;() 2xrio no1apte ict ()artau pno0apx io3iaslm2ean snt4tlxomf oa1laD ai i s)trxmxo io1optemnei t  rtmxrp;u4olxo f3ild aDrln o;(4trenir totomDe u sl( truoimpoodam  mncslt)a2taxro;t1ale  f3iat a ul(vo t)tltoxr oytoateln o;t0 rtrio3io1oltnlnciat) 2tr( o;o1oltnmoetasls2eanmo;u0tlxnio ia1lmteauvi;(0 exoxr3io1lp e ictl(  Dumxmont1tlx ioeiadfs elu pnu)trtomf oatoat au i;t sruoiopnu4lm e neta(fsrrm( onu1oexnifciytla2rlump;u4treomoctadoptraueo s)tetmxm3io1lp  micsl(f Dururono1tetnmfeiadfs rau onu0 lxoifcia1fmtrlnvi ( tetr(mpiydopeemfei s a2ur(mpou4tee mfciytlsDua(vont0altoxr3oy1laDrlnvo;()t2xoxmpnodapeemnvi s)srrr(mpnt1tlx mfcias aDrm( s t)texrmrctydfmt lnes;t)srurio3iu4lpte netat)arraxm nu1texomfeiatlsDum(vpnt4 rxrmociy1lpD lueols) 2tr(m iu1ape licia( aruaumoot0aexniiciysfs emums ()aeerxf3iytlmtr uesls  exm(opno4lmenlfvtatfaDtau  ;t1olxniiciaslsDuau s;u)tleoxf3oo1latran ols)s2urxo3oodlptnliet s) ruau  ;u4opeomoeiltls emn onu4alxoxrctatfaD  ivils)s2um(mpiy1lp  licslt aDrmumo;t1oltoiocias mDul(msnu)altnio ta1fpt livs;s s2tmiopno1alee nciat srrmxmp;t0oexomf3tad m2rl( s u0 exniocoytlm eli sls sexr(m3no4lmtn ncsltf rurxm oo0oex  i3ild aDumuvp ()teeoxr iatoaDr n sls) eumxo3nu1altnlicia( aDumxrpno0oeenmfctatfs2eau pnu0tlxoxfcty1fm eai ils0srum(m nodopen fet ( srurxmo;t4ale mf3tys a rlnmp (0arxrmocoodomtrlnvolt)t2xmxr3ny1am elfetas) 2urum ot1tlt ioeiadlm rlnms () renmf3ia1la  aueo;t)sexrxmpio1lmte fvtl(f rrmurpno0texoioctlt a ul(vp t4trxoxf oa1oa rlivs;(0srxr(o3nodomen feiat artaxm ou1aex  o3iyt a2rl(vp u) exrio3oo1fa  lnvo (0srtmio ou1open ivi s s2ua( ont0tpenioeiyslm2ean o;u4 etnxf3tatfm ean o t)t2xr(m ny1apee nctat  rurxrono1tpenifetaslmDea(ms;u) ltnif todfptr nei ( srumxo ny1am   neslsfarum( o;u1ope mocilsla rlnmo u4altoif oydop e u s;() rxrim3io4ome mfvil()aDuaxr no4aexnif3tysla rluvo;(4texomfcty1opt  nvs;()texrimpou4optnlivtl(f Drax  ;t1tlxnmo3ils sDea(mp;(0 reoxfcootom eanvilt) 2xo(r iu4lm nmict t)arraumont1tlto o3tlsfm2elnms u)alxrxf3oy1om  ln i s) 2tmirpoydll elnesat srua(ronu4teto o3tasfsDrm(vsnt4 rtnxociotfmte uvsls teuo(r3no1omt  ncils aDta( oot0ape  feiadls2ea(vp u4 lenio3iadfptr ues s0srtriopny4lpt mnet s) Draum nu1oex io3tadfs2emnms;(4aexrxocoatfp eai o s0trtm(o3io1ale mfvi (  Dtrxr nt1tee iociydfmDua(ms t0tlxnircootfat liei;t)seumirpnudoleemivi (  Draxr ;t1alx  ieiytfa2el( o;t4texnxr3oo1fpD luesls)s2to(rpiydole mfcia( s2umumoot1tle mo3iydfsDeaump;u0tlxrxo3oa1oa eln s (  eumimpiodaptnmiviat s2rmxrooo0aptnmieild m2elnvsnu4 exnmfciotlm   i o t0 ruoxo3no1ll elictat) Drmu o;o1teeoif3tas a2ul(mon(4 lxnxr3iodom  au il() 2um(m3oo4om   iesasfs2rr(rp;o4tpxnmfetydfa2rm( pn(0alerir oydla   ivol(0srxmir3ny4ap   ivslt srrmumpnt4aptomietydfs ulu pnt0tltnxo3oadlp rli o;s texmimpiu1omt mivtlt)sDuru  ;o4opxnifctysla emuvpnu)trtniocoytlaDr iei t)seum(o3io1lm nmncsl(f Drmx  ou1oexo ieiysfa rmnmonu4texomf ootom eaieo s0 2xoir3iu1llen ict ( artrum nu4apeomi3iys a2ea(vsnt0 renxr tadoa   ieo;s0s2toiopno4lptn ict t)a2trxmoot0tpe  fctytla2emnms ()aexnmf3oytomteanvs ( s2xo(rpoy1al n ietlt arrrurpot4tpxn o3iat mDul(vs;t)tlerxrciytom   u i;(  2um(opoo4lpte ivtat)s2rmump;o4tptnmfciadls2uanvonu4altoifciytopDelueo;s0 rxrxopnodlptnmfvs s  2umx oou4opx miciat aDeln onu0texoio ty1lm eliei;s)t2tr(m iu4omen icsas a2tmu  ;t4tptniieiatla2uauvp;u4 eeniociodopt anvs;t  etrim iydlp nmfvt t) 2tmu pno4opto feiytla2uluvsnt4teenmfciy1op  anei t) 2umxmpoy4ol  mfci s srrr( oou0opeoioetlslsDumuvonu0aexnir iadoptrlnes;s seto(rpoodolt lfvt s srurur nu4tpe iieiysla ulnmp u)trxnmo to1latean o (0s2trim3ou1op emicsl()a2taxmont4oeen f3iydfsDeluvp (0 ltomr tytfa eanvslt sruo(mpno4amenlnvsa()s2rr(m nu1tpeomieiadlsDrmu p () lerxf iy1fm  lneslt) 2xrim3oo4lp emnctat) rumum nt4teeo ieilsls rlnmp;(0 ltoxocoytlatr nei (0s2umxr3ou4apte icsasfsrrmumoot0oex mieiltfs elnmo t4texnmr oydlpDe u ol()s2ur(mpnu4apt  nei ( arrmx o;u0olxomiciltlmDemn pn() exoxfcta1fa ean ols0 rur(mpno1lltnlfcsat sDtmx  ;t0tptn oeils sDeau p ()trtrxrctotoat lnvil()texm(o iudom e nesat  2urxrp;u0ope miciltfs rm(vpnt4 eermr iytfa rli s ( trto(r iudaltnmfvi (fsrum(r ;t0tlx  f3tydla rmnvo t)tltrif3iydfmt anvsl() 2uoxrpiy1ale mietas) Dtrxroou4oex iociasfm2rl( ont)alxoxociy1laDelnes s  rxrxm nu4ole mieslt) Dur( pnt0tlxomociad s2el(vo;() ltomr3to1lp rluvslt)trumimpoy4amtelfetl() Dumxrono0opt  o3iat sDuln p;u0teenxr3oodfm raieilt)t2xoxr ny1lmt mnvs t  rua( oou1tpt io3iytfm2eaumpn(0trtrmo totfp  lues;()texm(opno1oltnmfcslsf Dra(m ;u4olt iociadfaDeluvs u4aexomr3tadlm rlneo t0 2toir iu1lpeelnetatfaDurx  nu0oltnmfciydfm2ea( s;(4trxomf oytlm e ies;( teuo(opno4llen ivs (f 2tmu  ;t0oeeo ietat a2um(vs;(0aeenmfciotfmD ai s;s setmxm3nydol  lnesa( a2umum nu4teeoioetyd m2rluvsnt4arxomo totopt an o;s) rumxr ou1op emicsls  Drrur nt0texn fcildfsDrlnmpnt) rtnio iytfm rlneslt0trxm(r3oo1amenmnet t)srrrur nt1apx  f3tadfm elumo () eenmf3ootom e iei;t seur(m3iydalenliesasfa2rm(r nt1openiieiltlaDeau pnu)aetoir ia1lpte iei (0 etrxr oy4openlnvtls)arta(  oo4ole ii3iytlm2elnmo;(4 ltnirciotlm elu ilt  exoxr iy1amtemfetas aDtaxrooo1opxomf3iytfmDuan p;()aetnmo iatomDeanesl() euoimpiu4ap  mieias)a2tr(rpnt0tleniicilsla rlnmpnu0altnxo3oa1lmtrlueo t texrxm3oy1op  mnesl( srrr(ro;o0texomieils mDul(mp (0aeermo iadfaDeln ilt tetoxrpnu1lp  livslt a2tmu ono4optomociasla ran p;t0alenxoctodlm ranes;s trxm(r io1lpeemnetas) 2tr(mono4tpx ioeiasfs2ul(ms;(4tleoxf3iy1fate ivs;s0tetm(m3oodamte fcslt sDra(ro;o0tlx  ieiadla2eanvpn(4trtrir ta1fmD lueols) 2xoimpou4ol   ivi t s2ururp;o4tle io3ilt a ean p;u4 renir ootom  lieils0 rtm(r no1omeemiciatfsDrrur nu1alxnif3ilsfsDemn sn(0arxrmrciodoaD anvi (0t2tmim3ou1ome  fesat) Drmu p;o4tpt io3taslm ea( s (4tltnxo3iadfpt li sl(  rxo(o iudaptemnvsat sDta(rp;u0opx mictlsla2ul(vp ()tlerirctatfptrluei;s0sruoim3ou4optn nesas sDraum nt4teto ocilt s rau o;t)areoxr3totfmDe n s;s)trtoxr3oy1amte ivia( srtmu  ot1teenifeiat m2uluvs t) lenxfctadoaDe ies (0trxrir iu1ope  fvsl(fs2taxr nt4tlxnmfeiytlmDea( pnt4 rtnir3oydomtelivi () rxrim iydap  mict (  Draurp;t4oltnifcias m2uanmo;t0trerifcty1fptean ol(0 exmimpnydapt lneta()a2um( oot0tpxoio3iydfa2ulnmpnu)alxnmf iy1fpt lu i t) 2uoxr3nu4lpte ieiasfarraxrpoo1oet ioctyd m rmumpn()altoxrctatfa e i olt0t2xm(mpnudapt  fci t) rtrum oo1altoifetad m2ranms;t)aeenxo tydomt liei ( s2toxmpno4ope livi s sDrmumpoo4tpeo oeilsfa2rluvp;u4tlenxo oo1omDe u o (  rxm(opno1altemfvs t  Duaxmpno0tpxn o3iydfm eauvo;(4 lxoifcootomDeau i s  2xo(o3iodlleemnetasfa2rmu pno1alx  fciyslm2emnvo (0tetniocoatlm ran o;(0 rum(mpiydlmtelnci (fsrum(m nu1alenii3iys m rlnvs u4aetnxr3totlmtelivs;s0 etoio iydll e fesl(faDtr(rp;t4tet ii3iasfm2ul(vpnt)alxomr3todlpD auei;t0tetoxr oy1olenmnci () rtrxr no1tltoifctadfmDeanvs;()arxnmr3to1fa elu i;t0 2xr(o oy4alte fci (faDrrxr nu4tetnmi3iytls ranvo t0tlxoirctodlpteanvs;(0sruo(rpno4ol   fes t sDtax  no0tetomoctytfs ranms u4 ltnmrciodfp e n olt0 eur(o3nu1lmte nvil( aDrr(mpnu0tet  oeilslsDrl( s t4teeoxoctatlpDe n i;s)s2toxmpio4ol elfeias)arua(mp;u4aetoifctadlaDrmnvs;(4 etrxrctatlmtran o;( trxmxr3ny4am emfeiat a2taxront4tlxnii3iysfaDel(msnt)tleomfctatoat ln sl(0srum(rpoy4oltn fcta(fs2umxrp;u1oeeo fctasla2eanmp;(0 lxomo oatfp raivi;s) 2xoimpiy4al nmivsl(  rtaxr ;o4tpx if3ilt a2emnvo;u0aeeomf ia1fa  aivol() rtmxrpnu4lm e ivta()arta( ont1texnioctytlaDumn p u0tetrio3iy1op r n il(  exriopnu4amen ivsat aDuru ont0tpxnmociadlsDua( o;(4aeeriociatfmt  uvs t seur(o iydlmtnmics sfsruaurp;o0aex  fciysls rauvs t4aexnifcoadfptelivols0sexrxm no4ol elfetat) Dumxr ;o0ape  fetyd s2eau o;t4tetrio3iadlpte ivo ( s2xo(o no4ameelfci s srrmu pno1aetn ietldla2rmu o (4tlermr3ia1fa r u i;s)tetrxo3nydope mietas a2tr(rp;t1tlxo ociys mDrm(vs;() rxrmf3iydfaDrlnesls sexrxrpio4lm  mnetas) rrrum oo0ole mietyslsDrmuvo;u)texomocoytlp eaneo (0srtm(r oy4altemietatfs2umx oot1tee iocilsfs ranmp (4artrxf tydfpDr ieo t srtm(o oo1lleemivil(farrr(  oo4apxn i3ildfs2ra(vs;u)trenmf oo1fpD aues ( srxoxopiodlpt mietlt  2um(r ou4olxo ieiytfsDelu o;u4teenxr iatfatrlueolt0srtoxr3oodameemfvta(fsrrru onu4aeenifeiadfm rauvpnt0teenio oo1omteln o;()srumxm3oo4op  miet s) 2tmumpno1oeenmocildfm2rl(mo t)arerxf3ia1fptelivsls)sexo(m oy4apenlfeta()arrrxr ;u4aetnii3iyslsDea(mp;t0 lermo3ootoa  au i;t0 ruoxm3nudalenlncs s artm(rp;u0apeo f3ilt a ua(mon(4arxrmrctatlp  livs;t)seuoimpou4optnmfesl(f rua(m ;o1tptn feilsfm emu on()areomr3iadlp ean o (  ruoio iy4lmte nvsasf Dtr( oou0tlxnio3ildfa emu s;u0aexnxf iydom rlieo;t  eur(mpiy4ap e fes (f Dtru  oo0apt moetltla rmump (0alenirctydopDrlivsls)t2xoxo nu1am  mivs sfartrxr oo4alxnmo3tytfa2ul( s;u) rxnxrctadomDrai sl(0t2urxr io4ap n fei (fsDtaxro;o0ape mi3iysfs2elums (0tleoxr oa1la r nvs;(0setoiopiydom   ieia(farrrum ;t0olt ifciltla rm( pnu4aetrio oo1fa e neol(0 rurxm3ny1omtn ici s  Dtrxm no4texo fctys sDul(msnu0 lxriocoatfmteli o ()texoxopiodlleemivtl()aruax  no4oet  icild sDeanvp;()tetomo3ia1fpD li il(0 exr(rpoo1lme lfctatf 2urxrpou4alt  f3iytfsDuauvpnt4 lenmfciadop elueols)t2tmxm3iy4op nmicta(fsrraum ;t4oet if3ild a uluvp t0trtoiocia1oaDr uei;()srur(m3iy1lpenlnei s aDtm( p;t1opt mi3ildfsDeluvp;u) ltnxf iy1fm raneil( s2xrio iu1omt livta()aDtrxm no1aleniictydls ranvs t4 renmfciatlmDrluvols)trtm(mpiu4lpt mics s  2taxr oo0aee  fciytfm2rln o t) rtoiocoytla rln i;()trtm(r ny1ameemfcsa()sDrr(mpoo4aeenmocils mDel( p;u) rermociodlmte ueils) 2xmxo3nu4om emiciat  ruaur ;u0aetomfetysls emn pnt)tetoiociydlp rauvols0srxr(o nydaltn ictl(fsDrm(monu1teen i3iadfaDrlumont) eermf oa1op e nei;(0srxrxopiy4op nmiesa( sruau o;u1alx moeiaslm ua(mp;t0tltnmo3iatfmDe ivo;t  2to(m ny4am e ncs t arta(rp;u1ale mo3iyslsDemu p;u4 reoxoctydla elivi ()seuoxrpoo1lpee fvils)a2rrx pot1tetnif3iasfs umu pnt) etnmocty1latelu sl()teurir iydamen fvtas  Duax  nu4tetoioeild a ulnvp;(0arxrmociodfpD  iei t0trtoxo iydap e fciltfaDumxmpnu1aexoif3iyt mDem(vont0altoxocio1om rlu olt teumxm3nydaptnliet s srrru  nu0olt moeiysfm2ulnms;t0arxriociy1lpt ai s (0trumio nydomt  ivsa(faDrmur ou0apxnmf3tydfsDuanmsn(0texrircoytlm elnei;(  rumxmpno1om e fctasfs2tmur nt0aleo fciat a ulu o;u4texomr oytfpDeau s ()teurxrpou1al e neia() Dua(r nu4oexo ocils a umn onu) ltrxf io1oat lnes ()texm(o nudomt  nvil( a2rrum no1tltomiciltla rauvs;u0 eenxr3oytoa  lueols)srto(opoy1alt lietl(f 2um(  nt1tetn ocilt sDemn o (4alxnxf3oydoat auvs;t  2toio3oydaptemnvi sfarta(ro;o4apxn feiat mDemuvs;(4 ltrio3iytoaDe ies;( trxmir no1optnlncslt)a2trxrp;t0oetomi3ildfa2raumo (0areoxr3iatlpD  neo ()teuo(m oydlm nlfei ()s2trxm ;o0teeoiocild s elnmp ()tetoxf oodfm elivols)sexmim iu4ole lfvsas a2urxr nu1oltomictyd s2el(ms u)altnxrctodfm  au s;()trtm(r3ou4opt lieslt)srur(mpoo1oee ii3tadfm rlump ()artoxr3tatlp rlnes;(0trtrio3ny1ol nmfcsat sDtaum oo1aexnmi3iysla rlu o;t)aetoifctotfmt luvolt0 2trirpoo1ale  feil( a2um(mp;t4tltn f3iytfaDrmumpnt0tltomrcoodfate nvsl()trxrxr io4lmt  ietas)s2rmx o;u0apeoii3ildla um(vonu) exrxf iatoptelnvs;t)t2xrxo3nu4omt livt t  2rruront1apxn i3tas m eauvo (0 lxoxo totlp rluvi ()texrio oy1ape lfvi ( a2rruronu4texnioeiytfsDemu p (0tetnmociytlm eauvi;t)t2urir ny1al  mivtat) rumump;o1aleo f3iat aDum( o;() renir iodoa r uei (  rxoim3iu1al nlfcs sfs2tru  ;o1optomociat s2uanvonu)tltoxr3ootlaDrlnvo t0s2xm(r3ny1llt mfcia()srtau pno4tlxnmiciysfmDra(vont0altoio iotfmD li s s0sexo(mpiy4lmee fvilt) Duru pno0altomfctadfm eauvo u4tlxoio tatfa e i i ()srxmio3io1amt micil( sDuaumo;o4tetn ieias s2uau pnt4trxnxf3iydop  luei t) exm(opnodapee fct sfa2rmxmpnu0ale mi3iysfa2eau sn() lxnmr3io1fpDraneo s0t2toxopoy4omt mivs t  rumxmpou0tltoioeiys sDemnvo u0 ltnxo3tytomte uvsls sexoir iy1lltnmieias aDtr(moot1tpxnifctatfsDulnvs t)areomrcty1oaD  n ols0srtmio3iudlp e fcsasf ruau oou1tleomfetasfa emnvp;t4 exoxr oatoatrai o;() 2toio iydlleelfesa(fsrtaurono0tptn ietatla umnvo t)tlxoxo oydlp   uvs t texr(r3iudopenmicilt  rrr(rpno4tlenmfctldfm2ra(mp;t4tlenxf iy1lmtrluei;s) rtm(rpnodapte ncta() 2tru oot1tpx mfctas s2uauvont4trxrmo oytoat liei;s)srumxr iy1op  livi t  2rmumont0aleo fctas mDuanmonu0 reoir3oytfm  anvil()teumxo iydom  mfviatfs2taum ot1oee iieiasfm2eaumpnu4alenxoctadop eln o;t0seuoxm no4al  mfes sf 2taxmp;u4olxomo3tysfm2elnmpn(4tlxoiociotfatean ils trtmimpnu4oltemiesls)srumxr no1texnmieils aDea( p;()aleoxf oatoaDeaivolt  euoxr3ny1llen neiatfaDta(moot0aex moeiltlm2rluvsnt4aeerioctotfp elu o t  etmir3oy4llenlfeiltfaDtmx  ot4tpe mfeiytlm2umnvs;t)tlxrmr3iadomte nvi (0t2ur(r nydll n ivsat a2rmur ot4texo octlsfa2ul(vo (4 exrxfcto1laDrli olt0trto(opno4omt lict s)artmumono0tlxnif3ild a emumo;(0 rtoxfcta1omt auvo;t teur(r oodaleemivsls)sDta( oot0olxo ieils mDelu onu) lxnmo tadlatr nes;t)trum(o io4ap nlfvi tf rumu  ;u4oexnioetltfa rl(vo u)alenmfciadoa elieo;t0 rxr(o oy4llee nvi s) Dururoot0alx iietas sDra(vsn(4alxrmocia1fm  aues;t0s2uoirpnu4apte ivias) Draur ot1alxn octat sDraumsn()altnif iadlatrauvs t)srtoimpoodlm nmics (f Draurpnu0teeomociysls eaumonu0tltoxo3iatomDrauesls0seuoim oo4lmee ictas) 2uau p;o1aptomo3iat s2rm(vp t4tltrmr3ia1latelu o t0seur(o ny4ll elnviatf Dumxm no0tet mfetatfm ra( p;u0 exnmrctadom rli o;t seumiopoudapt  nvs t)a2tm( onu0oltomiciytfs emn s;u4 rxoir oydoa   u slt s2xoxo3ny1ll   fvsas) Dtrumoou1tpeo ociltfm eanmp u4arxrmr3oatlat anes;s)trtr(m3oo1lm elfes s)sDrr( ono1tptomfeiytfm2ra( pn(4texnxo oo1fm e nei ()truoim oydameelivsltf 2rax pnu1oex mo3ilt a emnvs u4artoio tatlpte neo ()tetr(r nudomtemnvslsfsrra(mooo4tlto i3ilt a2eanmp;u0aexnmociytfmteln i t)s2tmxm3iy4lltn nvi s  2rmu pnu0apen ieiytla2elu s;t) rermociadomDeau i s)s2xoiopiu4ll e fcias) 2ra( pnu4texnmocildlm el( pnu0 exomocio1lmteaueo;t0 rurxmpoo1lm   fvias a2rmx o;o4texn ieiysls2ranvo u4 rxnmrciydoa ean ils  rtoxr oydapte ietls sDraurono1tpxoif3iatfs rm(vs () lxrir ty1opt ai ilt)tetmio3io1lmeemnvta( srrmumoot1apxnifctatfm rmnmp t0aeerxf oydoa e ieols0tetrxrpoydlmtn fes t arraxr ;u4aptn oeiysfa2emump;(0alxoio3tadlaD lu i;t0 eurio3iu1alee ietls)a2urxrp;t4oetoioctat sDuln o;(0tetnxf totfp rai s;s0texoir iudape mfcs ( a2rmu  ;o0apxnifciltlaDem( p;u)arenifctydoaD anvi s0srtrimpnodop  licsls  2uau  no1olxo fetyd a2rmu pnt4aexnxo3oodlatraivi t0sexrio3nudlptelfvs t)a2uaxr nu0aee iociyslm em(von(0aeermr3tadomteli ilt0 2xoxo3oudoptnmics sf 2rau p;t4teen o3iad a rmnmp;(4tlermr tadfmt an i (0sruoxo nodale mfvs t s2tmumo;o1oexnmoctat m rmnmonu)altrircoodfpteau o;( seur(o3oo1amtn ivi sfs2rmu o;o1alt ifeiys m emu s (4trxoio3tadoaD lu s;s0seumim3oo1lleemnvtltf rrmxr ;u4optoio3tatlaDelu o u0aeenxr3tatlmDelnvilt0t2tmio iy1ope mfvs t s2rmx  ;o1aleomoctyslmDraumsn()arerxr3oo1opDrlieilt0texo(opno1ll eliei t) 2trxrono0aetnmoeiasfm rau o u4 lerif3ootlaD an s;t)teuriopiu4optnlietat aDtaxrpot1oexnii3ild a2ea( o;u0trxnxf todlp raieo;s)s2xmxr3ny4am  miet t  2tr( pno4tlenmf3tlslm2emnvs t0tlenir ta1fptr nvilt0s2toxm io1lmenmnvias  rtrxmono4oet ifeiyt sDrauvo u4altoif tadoaDranvo t t2tmio3ou1opeemfvt (fsDumxrpot0optnioctys sDrln s t) rtoif iydfp elnvo;( s2tmxm nudame lfcs ( aDum(rono0tee if3iytla2eluvp;t4alerxrctadlmtrai ils0sexm(r nu1am   fesl()a2ra(mo;o4oetnmoetlt sDran o;u0 rxoxf tadomDelies t0 etoxm iu1lptelfeslsf rrm(  ;t1oeto ictatfsDelump;t0aeeoircoatlat livol(0srxr(rpou1am nlfeiat)a2rax  nu1tlxoiicilt a2rln snu)tetnmo iadlatrluvo;(0srxo(o nydameelivt (f rrmxm ;o1aeto feiatlsDumumpnu) lxrio tatlmt aiesls)srtriopou1ol nlnet t  Dumurpnt4apx  feiysfmDemn onu4 ltnxo iy1la  an ils)t2trxm3ny4apee iet t sDrmxr ou0tpeomfeiyd s uan pnu0teenxociatopDr i s;t s2ur(opiu1am nlivilsfsrtmu pnu0aeen ieiysfa emn pnt0aeerio oatoatelneo s) rumim3nu1opt lfcsat srtax  ;o0opxn i3tad a2rluvo t)tlxnmf oy1oa  lneo;()s2toxo ny4oltemnctat sDtaxr ;o0olenioeiyd aDrlumsnu4tetomr3todfp  anvs;( s2umimpoy1am elfcsat)sDtrxmooo4tltomictat a2umuvsn(0 rxnxfcoodomDraieo s) rumxo3iy4om elivt t arumxmp;u0opxo i3ilsfs um(mp t0aeeoif3totom rlnes;t)texrir ou1om emfesatfa2uax  nt1tet io3iysls2rm(ms;t)alxomo oadomtran s s0trxrir3nu1ll eliet t) Dum(m ou0ape ifctasfs2el( p;()trtoxr3iy1lp  anes;s sruoxo3oo1alt  fciat srraxmo;o0oetn o3iadlmDumnmsn(0trermo totopD an s (0s2xmiopoo1lp  mietlt) Duaxr nt0tetnmoetysfa2ul( s;t)alxrio3tatfm   nvo s0 ruo(r3io4al  mnet t aDtaurono1tleomo3iltlmDrlu pnu0 rtoif3iydlpt anes t)seurxm nudop  mfcslsfarrrumpou1tpxnmo3iatla rlums () renifciatfp  lnvi;s trto(o ou4openmneslt aDuaumo;o1tet mictyd m elu o;(0trtrmo oo1lat  iei;t  2tmirpiy1ll e fctl()artmu o;o1tle  ietydlmDrmu sn(4texoif iatlpt ln s s) 2tmxm oudomee ncsa( a2rm(r oo4aeen oetytlmDran s u0 rtnxo3oydlpD  ivs t)t2xrxrpnodlptnlncsa(f Dtaxr ;t0olt ifetlt m2ulu p;(0treomo3oytlpt  ues;s0sexm(m3iu1omtnmfciatfsrurum ;o4olxo oeiatfaDumu o t)altnmo3oatoptr i s s)teuoirpiudameemncta(fsDuru pnt0olxnmf3ias s2rauvo;u4 renxf3to1lp  auvsls0texrxopoy4lmee ies t arua(r ;t1alt io3iydla2el(msnu) rxoxr3oadfp elnvslt trxm(r3io4amtn ivi t  Drrurpnt0aeenii3tad s emnvo (4 reoifcio1latelnvsls) rxoiopiy1amenlictat) 2rm(rooo4aeeomfetytfmDua(vs (0aeerir3oodfaD anvo s) rurir3oo4lptnmicil()aDrrurono1oee  oetat s rl(vpn() etnmrctytlm  anvols0sexmxr oudapenmfet s  Dtru  ;o0alt  iciasfsDranvs;t0 rtnmfcia1fptrluvo;(0 2umirpou4opee ivilsfsrta(mono0tex ioctaslaDrluvs t4aleoiocoytfp rli i t0srxo(r nu1lle lfei sfaDraxmoou0aexnmfctlslm2elnmonu) eenmo3tytfmDrluvi (0sexoimpoy1llenlici s aDtrxr ;t4oleoioetldlmDrm(mp t)tltnif3oatoaDelnvils0srtoio ou4omtn fesatfa2ua(rpno1tpt mictldfs2uau s;t0trxnio3tatfate ivs;t)srtmim oo1amenlfet (faruru  ot1tetn fcilsfm2eanmpnu)tltnircia1oatrai i;t)sexoimpiu1llee fesa( srurxmooo4oex mf3tydfs eluvsn(0 lerxrciadoaDelu s s)trumxrpio4apt lfeilt  2ur( p;t0aee  ociadlaDeln pn(4 rermr3oa1fp rli o;s  rtm(o nudaltemnctls)a2rrum ot1tetn ieildfsDem(von()texrircoydfmt  ieo;() 2urxr oo4om emfet s) rrmxronu0teeo oeilt m eau s;t0arermr oatfp r iei t)tetm(m3iu1ap elfcsas srrmx pnu1tee  f3iadla2rauvs;u0tlermf3oodlpDe neil()sexoxo nudom nmnvta(fa2taxm oo0tpxo ieiysfaDeau s;u) lenir oo1op   i s;t s2to(m3nu1ol emnvtl( s2tr(m ou1oetoii3iydlsDrauvonu0trtnxf iadlatelnes s)setm(mpoy1lptnlfct s)sDtaum ;u1tltomfciytla2ra( s (0teeoxrcta1fmDrln sl(0 2toxm nydape mivsa( arta(  oo0aee iictysfs2eau p u0aeenir oy1lm   uvo;t s2urirpnu1lle  nei t arumurpnt4aet io3iys m2eln o;() exoir3ootoaDr nvo () exrimpou4al nlnctlt)aDtrum ;u4oeeomfctldls rmuvpn(0 rtrmo ta1opt auvils srxm(m3nydll nmfeils sDrrxr oo1openmo3iatlaDeln s;u4artrir3io1op rln i ()t2urxo3nu4lmt mietat srtmur ou1olt  feild m2eauvs;()trtoxr3to1fmt lu i;s0 eto(r nydom e fctlt)artau  no4olx ii3iatfmDel(ms (4aeeomfcio1lpte ues;t0texmirpno4ll e ivsls)aruaxr nu4aetoiociadlm2um(ms u0texrmocoodfaD  nei;()trurxr3nodamen nctat  rrrxrp;u1opt mfciys a ul(vo;u4 renmocta1fa ranvi t0trtoimpoo1lltn nvslt  rurxmonu4apxn o3iatfmDea( s () etnmf3iadlm eli s t0 eurio3nodlpee feils)aDrau p;t1oetnmfeilsla rm(vs t4aexniocoy1omtelnvo;s0truo(r3oydale  nvtl()sDtmxr ;u0ape moeilsfm ranvp (0tetnir3oytfa  aneslt)s2uoxrpiu1omte iei (  2tax o;t4tle mfeilsls ra( s u)tlerio3totlm eaneo t0tetm(o3iy4ll emieilt aruru ooo4opt mo3tltfs emnms;t) leomf3iydlaDrli sl(0 exrir no4ap  lnesl() 2ua(rp;u0teenmietadla2umn s t4altnxf3ia1oa  auvslt)srxoim nydalt  fvsas) 2tmxmo;u0opx  fetlslmDel(mo;u) rtnir tadoatrlies;t s2xoxmpno4lmt  ici (fsrtrxroou0oet miciad mDrl(vo t)aexrxr3tadfatrln s s)srxmxm3oo1amen ietasfsDurxrpno0oexomi3tasfa2emump;u)tlxoir3oy1lmteai slt)t2toiopnu4aptn iei tfsrumum ;u1tpxnmicilt a2el(vp u)artrir3ia1opteliei t trtr(r oy4apee ncsat)a2tmxr nu0optnii3iyd m rmumonu0tleoxr3oa1om   i i s)srtrio oy4ap  lfvsa( artm(mo;o0teeo fcildla ra(mo () rxrxrcio1lpDrluei;s  rtoxrpio4olte nes s)artr( p;t4tlx  ieiasls emu on(0artnif3oydfaDr i i s) rtmimpoo1lmeemnci (fsrur(ro;t4apxnmieilsla rluvpnt0 etomf3tydlaDe iei t)seur(opoydlpt  nvs s s2tr(rpnt4apxn feiyslaDrmnmpn(0arenirctadfpt  iesls srxmxopou4ol n ietls)s2ur(ro;u1tpeoio3iltlaDea(mpn(0alenxf oy1fpt aueo s)trur(rpiydal n nct tfarum( pnu1olxniietyd sDumu o t)teeomf iydfat anvo;t)texoxr oy1openmnvils) Dtmu  no1oeen iciasfm emu p;t0 ltoir io1lm raneo (0s2urxr3io1ameemiei t)aDrru pno0apt mf3tysfs2ranvsnu4alxrxf iytfa   uesls  exmxm3ny4olenlicsas) ruaxrpnt0tlenmoetas a2ua(vont0 leoio3oadfaD ai s;s)trxrir nodolt  net t)aDtmxmont4olx  feiad m ean s;u4 etnxr oodlptelieslt t2xrxmpoy4ope lfviasf rtaur nu0tptnmfetlt a elu pn(0 eeoircoydfatrluvs (0t2tmio3oo4op nlieiltfa2uaurpnt1tltn ietytfa ul(vo t)trerxrciytlmD  i i;t0 rto(o no1amenmfctatf Dta(  ot4tpt moeiltls emuvo u0teerifcia1oaD luvs;t)t2uo(m3iu4lptemfvta(fsrum( ont1aexnmiciytfs rlump;(0 ltoioctodlpDranvo;s)srtrio3io1oltemfesas  2umu  nt0tpe  ictltlaDeanmo;u4texoxo3oadfmt lueo;s)srxo(o oy1alenmfetlt)sDrax oou1aexoii3iydfsDeaump t)trtniociydlp  anes (  2xoxm3iodome  fvia() rum(m ;u1olenmocilt a2uau snu4areoioctytlmt  uvsl(  2uo(rpou4lltemivt tf 2tm(mpnt0tpxn i3ilt m2umnvsnu4aleoxr3oa1lmtrau o;s0s2xrxo nu1am emieilsfarum( ono0oexnifctytlmDrlumsn()arxnif3tatfateaivs t texm(m3iu4lm  lfetat  2ururono0oetn i3iys sDrmnvo t4 rerir totfpD aivs;(0 2xrxo io4open ivslt)sDur(mpou4aetomfeilslm uan sn(4 lxnmfciadlmDrlues;s0 etr(m oo1alenlfviltf 2rru  ;t1tlto fctydfa emu s;u4tlenmf tadla rlues s trtm(mpno1altemiciasfsrtrum ;o4opxoif3iatfm2rmuvo u) ltrio3tatoaDr ues;t truoxr nydolte nvt (farua( oou4aptomoeilt m em(ms u) reoircta1fp  lu o;s0teurio io1opeemnesa(fsDra( p;o0tpeomoetat s2rmn pn(4 rerxr3tatfptran s;(0setm(r iy4olt  iet s s2umx oou0olenmietatlmDrlnmp ()aetrxr oa1lm eanei;t0tetr(o iudamt lfvias)aDraxmooo4teeo o3iys m ran ont4tlxoifciatfmteaieo s trto(r io1lptnmnci ( sDtauro;o4aetoioetltfa2umnmo u) rxrxocty1lp  auvs;s)sexm(o3oydoleelfcsasfarrmx poo1apxnmfeiysla2ranmp t) etnmo3tadfpDe ivsls0 rxr(m3ny4altnmfvsl(fa2urxrpnt1tlx  iciysfmDrau pnu4artnxf tydomDrln i s0t2to(r3ou1apenlict s  Durxront1opxo ocils a ran p;u0 ltoio3iodfm rln olt)s2xmim3iy4op e iciltfa2urx  ;o0apeniietls s2rau snu0 rerxf3tatoaDraivi s0seto(rpou1aptn nvsl()a2tm( oou0oleomfeiaslaDrln p u4tlenmo3oytfa eaueols0seurxm3oudoltnlnviat)aDrrxronu4apeomieilsfm eln p;u0tlxnircoodla eanvo;s0 etrxmpoydlle miviatf Dtrur ou1teen octysla ra( pnu)tltoif3oodlpteauvslt0 2xoxr3iu1omenlivtlt aDururooo1tpto ociys a ua(mo u)arxoxf tydfateanes;(0srxoio oydol  lnctat  Drrxmoot4aetomf3tldls2rm(msnu0trxoxf3iytlptrluvils0t2xrxmpoudopen nctas) rtau pot4tlx  oeiasla2rmnmpnu4aexoxocoytoat  u slt)seur(mpiudlpe  nvi t  2urx o;t1teeo fetydlaDumn p;(0alxoircia1oaD livs;s0teur(mpiydamt lfvsltfsrrrumpoo0alto ictadla2umuvsnu0 etoxrcio1fp e uvi;s0t2toxo3iu4apt livsat  2urx ont4tpt mi3iatfa emn snt4aexrmr iy1fmt au o s)texr(o ny4om e ici ( s2rrxm ;t4altn feils s2rmnvs t0teenif oy1faDr u s;s teum(m3iu4ll  mfei (fs2urxmpot1olto o3ilsfsDrauvs u4 lxnircoo1lmtrluvslt)srxmxmpio1omt mfcil( sDtau o;t4tleomfctytfs em(vp;t)trxnmrctatfpDrlivs s0 rurxmpou4ll e fvils arra(mooo4ape mo3iadla2ul(vo t4trtnmrciydopDrluvil(0 eum(mpny4amtn ncsls)s2ua( pnu4apeomo3tld aDrl(ms;u)tlerxocoy1opt lnvsls)t2tm(r oydll  livtlt) ruau  nu1aetnifetat a umump u4tlxoxocty1oate nvils)trxm(m ny1lme licil(farurxroou1alxoiictlslm2eauvp;u) lxrxocoy1fmt lu i;t) etoirpnydoleemivtl(fsrraxmoou4oltoii3iltfa ua(vont)arenxo ty1fmDelivs t0s2tmim oudlpee fvtatfa2ta(  nt0apeniictltfm2uluvpnt)tltnmr iadfp   u ol()srtoxm iydamtn feils)a2uauronu4tleoifciatfs emuvo;u) eerif3oydlmDrluvol(0 rtm(mpno4lme lnct t sDtaumonu0olto f3ias aDem(msn(4 ltnxfciadomtr ivi;()s2trim oy1amt mfcsl(fs2tmumo;o0optnmo3iltlmDrmnms;u0tetrmr3oa1fm eli ols0texr(mpiy1op nmncsa(faDuaum ;t1aptnif3iadfa2rln s;(4 eerxr3tydlmte n sl(  etr(mpny1opt livias)a2rrx poo4aee iictas sDel( s u)trxrif iadoaDrlu ils0seumirpiu1al emivsat srta(  nu1texnmfciytlm2rm(vo (0aexoxf ta1la   uvi;()srumirpoy4lmeelfesatfaDrax p;t1alxomieiytfm2um(vpnu)treomf3ty1opDelnvs;s)teumxmpnu4omeelfctlsfaDrmu pot4oltnif3iadfsDeaumsnt0arxoxr todlm e n olt0srxoim3iu1lp emfvi sf rur(m ou1opto o3iadlm2emump;u)aexnxf iadfpteanvilt  2umxr3nu4ap  lict t)arraxronu4oee  oeiys m elnmp;(0altoxo3tydfa r nvsls  2umxo io4am   feia( s2rr(rpnu1aex  o3iyd aDeaump (4aetoio oatoptelivi;()t2umxm3iu4op nlfvs s  2tmx  nt4alen ociyd sDraump;(0tltnmo3iadfmtr uvi;()trtoiopiu4ap emfci t  Drrxmpou4tex ii3tldlm umump t0arxoxoctotlpDrlieo t0 rtmirpiu4ame livslt) rtmum nu4oleo fctys a2el(vp (0 eenmr ty1opD  uvo;s)t2toio oo1lpeelfei t)srra(  ;o1oex  ictytla2eauvsnt0arenmo3iy1fm   i s;s)trtmir no4lmenlicia( a2taxrono0tpxnmo3tydls em(vs;u4aleomfciatoaDe i o;(  exmimpnodope  netlt)aDtr( pnu4tpxnmo3tat m eanmont) ltrmrctadopDr neil(0 euoirpou1opee fvi t) Duauront1aleomfciytfsDuanmonu0 rerxr oy1omDelnvolt0 ruoxr oodolenlivi tf Dra(m nt0aeeomociysfs2um(vs;() reoxrciy1oate i il( s2uoio3nudlm nmictls)artrxmp;o4altn icild sDumnvo;t)tetoiocoa1omDelnvil(  exr(r3nodllee fesa(fsrtmu pot1opt iieilslmDemn ont4 rtrifcoadla ean ols  eurio oodll   ict (  2um(root0aetomiciys aDumuvsn()alxoir oytoptean s ()seuoim ou4apeemfvs s arurx  ou0tlx ii3tldfmDumnmp;u0aleniocoytfp r u o;() rurxr nu1oltn ictas)sDtmuro;u0oet ifctaslmDelnmo;t)aeerio3oa1faD lueo;t s2tm(m no1lpt lfvs (  rtm(mono4tpx mf3ilt mDul(mont4 eeoxf iatomteau o;s0setoirpio1ll nlnvt s artmxm no1aetniociyt mDrluvp u)aexoif iy1omDelu ol() 2xoimpiodll   ivs tfaDtrur ;o0tlt iieiyd sDemumsn(0 eerxf3ia1fpDe nvol(  rtr(rpou1om nmies sfsDrrumooo0oleniietls m2el(ms (0arermocoa1optrlies ()s2xr(m ny1opt mfcs sf 2umu  no1tetomietltlm um(vsnu) eeoio io1op elieo s  rtrimpiy1lpt lncs s s2rm( poo1oeto ieiyt s umn p;u)tlxoxocoo1omD lieo;t seuriopnu1ome  fetasfsrra(ro;u0apt mo3tat a eanmo;(0trtomf to1opte ueo;s  2tr(rpiydlmenlies ( srtmurooo4oex mf3tasfsDumnmont)arxnxr3iotfaD  ues;t0teuo(r3iy1lptemncsas)srurx o;o1aexoioeild s ulu s ()aeerxr oydfm e n o (0s2uriopny4lmtnlfeiltfaDtrur nu0tee mi3ildla2ean o;t4 rerir3ootfm  liesl()seurir3nu4ol elneiltfsrumum no0oltnif3ild aDuan ont) rtomocoo1lmD livo;(0 2xmxr oudlptnlict s)sDraxrpoo0altn i3iasfa ua(mo;u)alenio3oa1fateluei s0texoir3nu1om elnes ()srrmxrooo1aee if3tatls uauvo;(4teeoxf3tytfp  lnvo;(  exm(o io4op  lfet sf rtaump;u1tetoifeiad m emnms u4altnif oodlm raivo t0t2toiopnodope  nvtat)sDtmump;t1optomociatls2rlnvs ()altnircoydlaDraues s texm(mpiu1am nlfvt s a2tm(r nt4openmfciydfm ea( snt)tltrxrciotlmDeluvi t0sexrimpnudlmenmivtls a2rm(mono0tptn oetysfsDumnvon(4trerir iy1fpteanvo t0srtrio3nydolenmfesat)a2urxmonu0oexomfciatlm2ran s;u0 exnxo ta1oa r ivi () etoir oodapen ivsltf Duau p;t0olenioeild mDum(mp () lxrmo3tytomDe ivil(  etoxr3iu4om emncslt aDrmuro;t1ope  oeiydls2rmn o u)alxoircoatoaDean i;t0 rxoim3nydlpenmiesa( srtr(m ot4ole iieiatfs2emnvpnt)trtoif todfptelnei;( srxmxrpio1lp  lfcilt a2rr( pot4tpxnmocildfsDrau o t)trxnxrcoydop r n s ( seuo(o nudop  lictat)s2umumooo1optnmfciytlm2rmuvs t0 etomo iydlatelnvsl( texmxm3oydoptelivi sfsrrmurpoo1ope ifetadla ulnvp u)tetnxr tydopDr uvo;(0sexoxo nudapt mfes (fsDuaumpoo0oee  f3tatfs rmums;u4alenif io1opt liei;t0t2trxm iu4om elfet () Dta(  ;t4tleo fetasla2umn sn()tltnxo3to1lpDelneol()trtm(m iodlle mfesatfsDrau ooo0tlxoio3iytfmDrln ont0 lxnxfctydlm eluvi;s t2xr(o ny4am  mnvia(fa2ua( ont0apxo octlsfa2ra(vpnu4 eenif oydopD anesls seurirpnodlptn nvsas)arua(m ;t0tet mietatfa2elu p;t4artnxf ty1omD luvols0seuoxmpiy1ope miet (f rra(m ;t0alxn ociyd sDuln pn()aeenif3iotlm raueo (0trxmir3iydlpt mncia() rrr( poo0alxomi3tatfa uluvonu0trxoxo3oatopt  ueolt0t2xmio3iydamtnmnetas)s2rmxm nu1oet  icild a umnms t0trerxr iydlmDrli i;s  2tmio oydolt mieilt s2trxm ;o4tlxnmieiatla ra( p;u0texrxfciy1fmtranes;( srxrim io4apt  fcil( arrrxmo;o4tpxn oeilsfm ulnvpnu)arenmf iy1lpD aues s) eur(r iu4lmeemfcs ()s2uax pou1tltniieiyslm2uauvo ()texrmr todfaDraies (0 exo(o ou4aleemfet sfa2ur(ronu0apxnmo3iydlmDel(msn()aexomf3tadlp  anvs;s0s2tmir3iy1lp  lfcta( sDua(mpno0tee  ieilt s ea( p;t)tltoirctydlaDelu o t0 2uoxo3iudal elfeta(f Dtr(mp;t1tpxomictys a el(vpn()tltnxf totfa e iei;t srxrir3nu1opeemnvsl( s2tr( p;o4aeeoiieiysls2uauvp;u0teenifcoa1fp eauvs s0s2xrir oo4oltn feta(f 2ta( o;o0tpxomieiytla2rmnmo;(0artoiocootoaDeauvsl(0t2ur(o3nudalt  neslsf 2urxr no1ole mfciysfs ra( s u)tetrircoodoa eln i s) exo(mpnudape lnesl( sDumxr nt4opxo ocils a2uln snu4aexomf3iydlmD livi;s)trxm(mpoudlmtemfctl( arra(rpot4ope  icilt mDul(vs t) eerif3oytfptr uvs t t2xr(m iydamt lnctltfsruaxmooo4tle mietatlsDuan pnu0arermo oodfa rai ols) 2trxmpnudlm  miei (faDraumpno4oee mi3ilsls2el(vo u0tetnxociodoat au s s srurirpoo1ol emiesat)sDrmxm no4alt mfetld aDrlu snt)trtomf3oadomDran s s)s2xmxo ny1aptemfvi (  rrr(  ;u0teenmocilsfmDuau s;u4 rxoif oatla eli ils0 etr(r3oydlm   nvt sf 2rau p;u0tlx ioctltfaDrmnms t)aetnmoctotomtelu ols  2xoirpio1aptnmfcs t)a2uaxmpnt4tetomfetysfs uanmp u) rerxo tydfm rli i s)setr(r nu1apenlnctlt aDrrxrp;o4optniietys s eln sn(0 ltnif iotlpDeauvo;t) 2xr(opnu1ameemfvi ()s2tr(monu0aetoiiciysfa rlnvs;() exnxo3ootlatrlu i;( t2tr(o no1lleelfetlt) Dtm( pot0aex iictlslsDuanmpnu0 rxnmr3oydom   nvils  exoirpnu1oltn ivi s)sDraxmp;o1apxoii3iytla2emn on(0 ltomr oydopD livi;s) rtoxopiodameelnetltfs2urxmo;o4apxnmfcild mDeln sn(0tleoirciydomtraneo s) euoir3no1opt  netlt)srurxmono1tee iietadfs2rm( snu0trtnmf3iodopDeauvs;s) 2umxo3iu4altnmnes tfaDumu pno0olt ifetadlm2elnvs;t) eeoxr oy1lm elivs;t)setrxr iudlp  mfvtlt)srum(r nu0oleo ociytlm2uln o ()arxnmr3ta1fm elivi (0 2xrxmpoy4llen fet s)sDrmurono4tltoii3iyt a ea( p t4trermf iydop rai s;(0s2uoiopiu1ll emnvsltfsDrr(ro;t0aee mietadlm2umnmp;() reoif ia1lat lnvo;( texo(m nu4amenmneta()sDum(ro;u1tltoio3iad sDum(ms;u)arxnxo ty1lat auvs () exo(r3iydameemietas)aDur( o;u1apenmfeiytfmDrau s u0tetomoctydfaDr nes s trtm(o oydlme  nvi s  ruaurpno4aeeomociyd mDelu p u)trenmrciatlm  luei t0 exoirpno4optelnvtls) rra(mpno1aexnmf3iltfaDea(vsnt)arxnxfcoodfa rlu olt) 2tmio nydaptn nei sf rrrx poo4ape  oetysfaDua(vp;u)artnifctotlpD lu o t t2xmxopio1llt  ics t a2raur ;u1tle ifciys sDeau o;t) ltnif3tatoateauvsls) ruo(o3iy1ap elncslsf rtax onu0tpt mf3tasls umnmp t4 rtoif oodfa  auei;( trumir oudole  fctl()sDrau o;o0tltniieiys mDuluvp;u4trenmrciotoaDr uesl(0 exmxopny4al nlivtas)sDuax pot0aleomoeias sDuauvs u)alxrifctadfptrlieil(  rxo(rpiu4alt  ieil( sDrm(r nt0alxnmieils m umnvs;u) etomo3ta1oa eau ils texo(o3iy4lp   ict tf 2rmxm ;u0tpeo iciysls eauvp u0 rtnxf3tatopteau ols) 2xoir3oodam nlncsls)arur( pnt0texnifeiydlm2rmn snu0tetnxoctatoa   i slt setmxmpoy4opt mnvi s sDrmx  no1oee  o3ilslaDuanmo (0alxoio oatopt lnvs;() eumir oy4amenmnetlt)s2urxmpoo0tex mictys aDrmu s (4artnmociatom  aivi;t0t2tmxo iu4omte feil()srra(m nt1olt  oeildfs2ul(von(4trxoxrcoa1lpte nvi t0 rxmxr3iudap n ncsas sDrm(  nu4oexo fetysfmDuanvs;()tltnmoctydop r neils s2to(o3oo4olenmnci ()sDum(m ;u4apenif3iat s rm( pnu)tlerxo iotla e n ol( t2urimpiy4lptn iei ()srtaxroou0olenmietytlaDuaumo u4alxrir3iodla   i s (0trto(r iudlmeemnviasfartru pot4altniociydfs el( s;u4 rerxr3oa1laDeai i;s0 rto(rpiydam  mnvi () 2ta(mpno4alen i3tas a umu s;()aeerxfcoatfa  li i t s2trxo oydome lfeslt aDumxm ;t1apeo iciatla2ulnvo t4trxomr oo1fmtrlu i;s0trum(m nydop e feilsfsrururp;u4oleoio3tld mDeanvo t4aeerxr3iy1fmDe nesl( trxrxr ou4lpe  fcils) ruaumpno1tpxnmocilt sDra(vs;(4 lxomf todfa e neo t sexoxrpou4ll nmnvtat) Dum( o;o4aptomi3ias m2ean s;(0aetomr3tadoateau o t0s2xm(r io1optelnet ( a2um(mo;u4texoiiciytfm2uanvsn() lerir3oodop  auvo;s)teumxm nodamen fctlt) Dua(m ;t1ape io3tlt mDranmsnt4artnmfctadla  luesls seurir3iudlmt mfcsat sDtmumont0aee ii3ias s2eau s;u4 eenifciadlat aueo;s)texoxm3ny4omen nctl(f Drmxrpnu4olx io3iltfm2emu p;u0tlxrifciatfp rlneils  rxo(mpio4ame lnct s arur(m ;t1aptoiietysfa eauvon() lxnifciytomDeau o;s)s2trxo3iu4om   nvslt)srrmumo;o4opeomietatfsDrln p;t)trxomocto1fateaies s)s2trio3ou4amtelfei (f rur(rp;u4tpen ociysfa eaumo;u4tetoxf to1fp r nvs;s seurxr3nydlmeelnct t)aDtmu oou4texomociasfmDel(vp;u4aeeoxf3oodfmte i ils0teuo(m ou1apenlnvt s) 2rruro;t0optnmiciatfm2rln s;u4arenio tytoatelnvslt)teumirpio4lltemicsas sDrmx p;t4tpxnifeilsla rmums u4tlxomf3ia1omD anvi ()srurxm iy1omtnmiesltf 2rrxmonu0alt  oetldls2rmumpnt)alxnxr iodlm  ln sls texrxr nydomtn fci ( aDtaur ;u1tptnioeilt s rm(mont0aexoxo iotfa  au ols)s2toiopio1omeelfvilt)a2umu o;o4oee  iciydlm eauvo (4 renxr iodlp r ueolt)t2toxr ou4llte ici () Dtrxm ;t0aptnmfctys mDrmnms;(4 lxnmo iatomDeln ol( truoxm io4lme mietls)sDrmurp;t4apenmi3iadlm2ul(vpnu0texnmo ia1om eaneo;()setmirpoydlmt mnct (f Dtru o;u0tlxnifciasls ranmo;u4 leomf3tydfaDrauesl() rur(opnudape lfesa()s2urxm ;u4tpe miciysfa2ua(ms u4 renxocto1la r ieslt0trxo(opnu1lmt lfcs sfa2taxro;o0oexoif3iatlm2ulums;t0 exrifctatfm r n sl(0tetmxopoy1ol  mivsls  rur(mpoo1apx mieiydlaDel(vp;t4 eeoxfctotfatr i ilt)sexrxr3iodamt lnci (f rtmx p;u0tlenmiciltlm eanmp;u4 leoirciy1lmD luvo t) 2xrxr3oydaptemicsa(fa2umxmo;o4aetnmi3tltls ua(msnu0alxrmf3oydlpD ln olt truoxo3io1opeeliviatfsDrau o;o1tptomieiysfmDumu s;()teerif oy1opDeaueo;t  eurimpiu4amtemivtlt)arrmumo;u4opt miciydfs em(mont)texrmfcoy1lpD  nes;s0trtrimpiu4ll n ivsat)a2tmxmpno4tpe mfeiaslm ran o t0 exomo iy1lmDeau o t)setoxo io1oleemnctl( s2tmx pnu0apx  feiyd a2ea( onu4texrmo3tytfm  livi;s)s2xrxmpou1ap  mncias)artm(  ou1apenmictas m2emn o;t4 ltoxr oy1oa r iei ()s2umxm oodalt  fcils sDur( pot4ale ifcilt sDra(mp t4arxnxf to1oa   nvilt) 2xrir iydamt lncils)a2ta(m nt1oleoioeiytfs2rmn onu4aetnircta1fm eai il() etmxm ny4ope  fvsat srrmxrono4oeeomoctytlm2ea(vpnt4tlxoxfcia1fp eai ol(0trtrxmpio4ap elfvta(farrmu o;o0aptnmf3iyd m2umuvpn(0artoxfcootfmDr u sls s2xr(m3ny1oltnlfeiasfa2rru o;o4tpxniociytlm ua(mo (4treomr3ia1fpt livi;()s2xr(o3nudamtnlivs sfsrtau pou4aex  iciydfmDuaumsnu0teeoif3oatoptr ivsls0srxr(m3ou1aleemfvsltfs2umu ooo4aex mo3tadlm umnvs;()aetnio3ta1om   nei s trtmxo nu1om emivs tfsrrrx  nt1apenio3tadfaDemnmo u0 rxniociydoa e iei;s)trxrxrpoo4ap emietl()aDua( p;o4altoifctydfm em(ms u0 rtrmrcoydoaD an s;t)teurxr oudoleemfcilt)artax  oo1apto fciatlsDulu pnu0 leoxrcia1oa   u s ( t2toiopou4ll e fcilt)srrrxmp;u1apxo f3iadfaDulnvp t)aetoxo oydfa  lieolt) exmxo iudlmt mnes tfsDtm(  nu0alx ifctyslsDulumont0altnxf3ty1opDrln o ()s2toxopiodomee nvslsfa2raxr oo0texnmi3ilsfs2eanmpnt)areoxfctadfp  livs;(0trxr(m3oydomtnlneia(  rrrur ;o1opeomieiydfa ranvo t) etomr tydfpDr nvil( trtmir ou4lp  mnesl()a2taurp;t4tpenmiciyt mDeau p;u0 ltrxo3tytfmDr i s;()tetrxr3ou4amtnlivt s) r
\ No newline at end of file
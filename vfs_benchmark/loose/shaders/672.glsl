@@ -0,0 +1 @@
+ivolt)trur(mpny4lleemncilt) 2urumo;t0altomieiad m2um(vp;t4 rermf oydla   u o;t)trxrim iudole lnetls  2rru  ;u0tpen iciat s ulnvon()texrmr3iodfaD auvol(0t2xr(r oo1lltemnctasfarra( poo1alxomi3ilsfsDraump;u4 reomr todlpDeau i (0 etrxm3iy1ameemnciltf rur(m oo0optnio3iadls2raumpnu)tltnmocoytlm raueo (0t2xrxr ny1lmtnlnvs s sruaur ;u4alxomfctatlmDumnvp;(4aeenir3oatfaDeln s;s) 2trxrpoy1apt mivsl(  rtmx oou1tpeoioctlslaDea(mp (4altoio3oodlmte ueols)trxoio3oy4lmeelictatfsDta(mpou4tpx  i3tlt mDrlnmon(0tetoifcoytlmD aueo s0t2xrxm3oo1amenmnet sf rrax o;u0opt  o3iasla umuvp t)aeerxo3io1om   ieo s0t2xm(o iodamt mieils  Drmumo;u4apxnmoetydfs uaumo t0teeoir ta1fpDelu i;s  rxrimpny4opt mneiat  rtm(ro;o0olx mfetlsfm2emn s;t0 etoifctytfmD livils0 2urimpou4ale mnvtasfsDtrxrpnu1oexn fctysfaDrluvp ()aeerxf3tydfpt aieslt t2xmirpno1omen nei t)aDrmuront1apeomieilslmDrmnvs (4tltrio3oa1lmt anesl()sexmxm io4amte nvi (  rua(ro;u1aeen o3ildls um(vo u)trxrio ootlatr u i;()teum(r nydom  mfeslt  2ta(m ;o0tlxomo3iysfaDuauvpnt)treoif3oydfpte ies s  2umxm3no1am emfct s  Dum(root0tleo oeiytfa em(mont0tltrifcoytfp eli o ()trxo(m io4opt  ncsa(fsDumxrono0tpe  ieils m2ea(mp t4trtoxo3ia1laD  n o s0t2urimpiu4apen icsltfsDumxmo;u0aexoifeiytlm2umnmp;u0treomocoa1faDe uvi;s0sexm(opiodlpte fcsatfarua( p;u1tpeoifetadlaDumums t) lenxr iadopteanvo t0srxrxmpnu4aptelfvil( artrx  ou0aet mi3tls a uln o u4trtrmrcoadfatranvs () exmxo3oudal nmnct t)sDtrxr nt4oexnmietysfm2rlnmp u4areoif io1oateaneo;t seumxr3oodll n ivta()a2rru  oo1tltomf3iysfs2rm(mo ()aeenir3io1lmDeli o s) eurio iy1opee iviat) 2rrxr ;o0oleomfctls sDuln on(0 exoio3io1faDelnvols0s2trxrpoodlpee fcils arrrur oo0apxoif3iyt s2rm( s u) etnmfciotoptraivi s setr(o3nu1amte fet (  2ua(  oo1apen o3iadfs2rluvp u)aexnifcoydlatr ieolt0 2urxm3oo1op  lfeil(fsDtruront4oleoio3tys s2uan sn() rtoxo oydlmDe iei;s texoio3nu1lm  lncta(faDrrum ot4olt  i3tadlaDea( s (4 exnxf3oy1lm raneo;s)texrxmpio4lmen fvtlsf 2uauront4aetniocias m2ul( o;(0artnir ty1lp r nvi;t  rxmim3no1ol e nci (f Dta(rono4olxo fetydfa umnms;u) lxrmf iy1lmtraueo;s0 rtr(opny1opeeliet sfa2tr(rono1openio3ild m ra(msnt4tlermocoydlmtelu il(0 2tm(m iydol  mivt sf Durumpot4aetn fcild m raump;t4 leoxf oadomDr nvo t  2xrxopiu1lmtnlfcilt) rrmu o;t1tpxo iciydfs2rln snt0 ltrxfcta1optraivi;t  rtrio3ny1amtemnetlt a2ra( oot0tpxoio3iydfm elums u)trerxocoa1omDe ivi;t t2xmim3nudamenmivsa(fa2ur(rpnu0ape if3iasfsDuluvo (0texoiocoydomtelnei t0t2xrxo3no4lpe mfcia(f 2tmx  no4opx io3iasfs2ulnvsnt0altomr3ty1oatraivsls0trumio nodapee ivil(  2trxmpnu4tpx mf3tld sDra( p (4 exoioctodfmt  u o;s)teuoxrpnu1lptelnei tfarumx  ot1oetoii3tldfa2uluvs (4trtrir3oadlat lneo;s) eurio io4lpenlnvsa(faDrm(rpoo0apx  octatlmDuanms t)trtrxfctatlpD ln ol(  rxoxr nodlpenlfci t)srum(rpnt0texomf3iysla um(mpn(0 exoxo iadfm eli o t0 rur(mpno1lmen ivias)a2raxm nt4alxn octyt aDuluvo u)trenir iytlp  lnvil(  2xmxopio4lp n iviat  rtr(mo;o1tlx  ieiad a2umnms;(0teermf oadfptrau ilt srxmir3oydalenlnci s  2tmxronu1olen ocildlsDum( s ()areoio3tatfa raueil(0 exm(m3io4ame liesas)a2ua(  oo1tlt  ocilt m2rauvp;u0tlxrir3oa1faDeanei ( teuoio3oy4openmiei tfarur( oot1oee  fetat s eaumonu0 etnxfciytlaDraieo (  ruoiopiy4ll   ncslt  rur(mp;u0aetniociat a rm(vs;(4texrxfcta1faD aivs s  etr(m3ou1amtemnvsls)a2ra(r ;t1tpxo oeiasfm2ua( sn(4 exoxocto1lm  luei;s0 2tr(o3ou1ll emnvsasf Dtmum ;o0oleo ictad m rl( pn(4altoxocoadlaD livols  2tr(rpnodom n ncslsfa2urumoot0oltnmiciysfa ua( p;t0tlxomoctatlat luvols0seuoio3oo1opee ivsls aDururpnu4texn ictytls2rl(msn()texnir oydopDeauvi ( trto(rpiy4llenlfetl(fs2rmump;o0tpx iociyd aDrlu pnt) rtoxrctodlptean ols trtmxopnudopt  ivil()sDtrumo;o0tpeomieiyt aDeanvsnu)alxnxr to1fateli s ()sexr(mpnydapt mnvs ()s2rmxronu1altomoeiadlsDemnmo;(4artnxr3iodfpDeanvs () 2xrim nodolee ncia(fartaxr no1tpx iieiltfmDean o;t0trtrio oo1fatraivi;()t2xrxr ny4op  mncsl(f Duax  ou4tpeomi3iyd s2ulumont)tltoio3tydfm rlivs s) 2toxrpiu1ap  lfvs s)artr( ono0tlxniociasfa2rauvp u0trxrmo todfmteli s () rtmxm3io1opte fcsl()srtau ono0optnioetldfs2rm(vo (4areoir3tadoatraies (0srxm(o3iydapee fvtl( arrrurpoo1tlxnmfeiltfa rmnms t4 etrxocio1fmt livs (0t2trio io1omtn nvil( sDrau onu1apxoifcils a2uanvs () etnxo tytfpt  ivi;s0 rxrim oy1lmt mfetls s2ta(mono1apxnii3iatfs2emu sn()artomf3iydfat ai s s0sexrxr3oodllt lnvs (  rtrxmonu4altoioeiltfa um(vpnu0 rermf3iodfmte nvo;t)srxoimpiydomeemnvsl( arraurpou4oex  fciysfsDran pn(0 eeomo oytoa elieo t  rxm(r3nydal elietat)srumu  no1tltoif3tytfm ulump t4 rerif oydomt  nvsls)trur(opiy4llen fctas srtmx pno1tlxn ieildlm2ua(vs;u) lerxr tydfp  au s;(0tetoxrpno1alte iet t  Dtm(r ot0texnmociadfmDemnvs (0 leoxociatopt anvs (0sexoimpoy1lp nlnetls)sDuaurpno0ope ioctasfs umump t4 lenio iatfatrlivi t)s2xmio iudlpt  ivsasfs2rmxmono4oexnmfetad mDrm( p;t4aexnir totopt  ues s)srxmxo nudol elnvs ()arraum ;o0tlt  ociydfm rau s u)arxomf3tadfa  au s;s s2ur(opno1ol nmictlsfs2rmxmonu0aetoifciydls2elnmpn(0texnif3tytla rln o;() exo(mpiodop nmnvt ()srta(mpnu0aee mi3iatfm2ran p ()alerif iodfatr ivo ()srxmxo ou1lm   fciat) 2rm(rpou4oeeo fciad sDran pnt4tltnio3oo1fpD anes;()s2xriopio1ll nmnes (f 2tr( oou1tex  f3tytfmDemu o () rtnxo oatoate uvsl(0trtrimpiydamt mfesatfaDuaur ;u0aex iiciys a rmnvo;() etnmoctadlaDeanvo;t)trumxm nydlleelictlt arrmurpnt1olxn fctys mDumuvo t4trerircoytla  ln o;s t2toir3oo1amtelivi sf Durx p;o0ope  ieildlaDemn p;(0 leomr iatfpD lu s s tetmxopno4lle  fvsa( arrr(moou0aptnmf3iadla2eanvp u)aexoio3iatlptraieo;s0sruriopoudale lncsa(f Drmx  ou0tle iociad s2elnvon(4areomfciotla e u o (0 2trirpoo4omtnmics ( aDtmx oou1aee mictatfs umnmp;t0tetnmf oodoaDrai s t t2tr(rpiu1alen ivtl(fa2rmxmono0tltnmi3tadla2umnvon()alenxr tytfptelneolt)sruoxo oy1ale  nvslt  2taxrpnu1altoio3iytfa2eluvp () rxoir3io1fmtrlueo;t tetm(m ny4opte ivtat sDta(r no4tlxnmfciad m umn s u4 rxnmf to1opD lu olt)s2xoim3iydomte ics t) rur(rono0alt mfeiasla uln pnt0 exrircoo1op eauvo;()s2tr(o3oo4open fct (faDurxrpnt0open icilsfa elnmsnt4trtnmocto1oa   nvo;t0setm(mpiy1ll elieslt srra(m nt0tpx ioctltfa2emu snt4alerxo3iatfm r n ilt0 2trxo oo1apeemfcta( a2tmumo;u1tpt  ociltls2ea( s;u) lxoxo3iy1lpt au slt) 2uoxo ou1ol e fesasfaDumx ooo4optnif3iydfmDumnvsn(0artnxoctytomDr n o;( teur(o3nodaltemnvi (fs2rrur ot4tlenio3iytfm umuvo;t0 exnmocto1op ranei s) 2xrxo3ou1lleeliesl()arrru ont4apxoioeiydfm rl(mo;u0alxoxf3io1faDranesl()teuo(o3iydop emfctl(faDur(  ;t1olxomociadla umnvp;t0aetnmr3tadom raueo t0seuo(r io1lmtnlieslt)aDrauront4tee mi3tadfsDrlumo;u4alermociodomt an i;t) rum(r iy4apt  nvtat) 2rm( pno4aee iieiydfm rl( p;u0artomr iatlmt au olt teurxm oudapee feta()s2ta(r ;u4oexnmoeiadfsDra(mpn(0arxnxoctadlpDeaieo;() rxr(r3nu1apt  nci s  2taum ;u1tpxo feiydfa ul(mpnu4 etoifcoatom  luesls0trxo(m3iudopte nvslt  Drrxmo;o4tlt mfetlsfs rmnms u4trtomf3oytlptelu s;s0sexmxm3oydomte ict s  Drrx pnu4tptomoeiadfs2eaumo;u0 exrmrctodlpD  i s ( trtriopoudlp n fci s) rrrumpoo1oee iociysfsDeaums u0 exoxf oodlaD aiei (  2xmxr3nu4omtnmnetl() rurumpno0oeeo fcildfs2rauvp (0tlxrmo3tatopDr ivo;( truo(mpiy1lmte ivtasfsrrru oot4optniictatfs2eln s (4aexrxr ty1fmDr u ol( setr(r iu4olte fcs t)s2trxr ;o4tlx mictyd m2ulumpnu0tltnmr3tadlmD li i s sexmio3oodamen fet tfsDraxmpot4ole ii3iydfaDemn p;(4altrxrciotoatelu s;(0trxo(o ny4lpen fcsl(  rtmxr ;t4opxnioeilsfsDrm(vonu0tltoif oa1oat au o;t0 rtoxr3oydoleemfviasfsDra(mpou4tetnmfeildlmDemuvo u0 lxrxr3ootlatraieols)trxrxrpoy4lle lncsas)artrurpoo1oeenmieilsfs2eau ont4aleoxf io1oat lueilt seurim nodoptemncils s2ra(mpoo4oetnmieiatlsDel( s;(0 ltnio3iy1faDrlnvolt)s2umir3iudll nmnetltfs2umump;o1texo oeiysla2uln p;t) ltomr oydomt an ils0t2tmxrpoudap nlieslt)sDumx  ;u4aex mfeias s rmu pnu0 etnmfctodfat luvs;(  2urxm nudome mfvtl()aDta(rpnu4opt mietatfm ul( snu0aexoxf oydlm   uvil(0t2tr(rpio1apenlnciatf Durum nu4tpt mieiadfa2emn o;t4 rtnxo iotomDrln olt) 2uo(r oudapenlieilt)s2tm(  ot4tpxnifetltfs rlnvs t0alermfcoatfmteauvolt0truoxr iodlp elfes t sDtmxrpoo4tleo oeildlm emuvpn(4tlxomr3oytfp r uvil( trtr(mpnodol e fvtltfsDra(r nu1oexoifetadlaDeauvonu) rtomf tadfp rluvo;s0t2uo(mpoo1lme  netl( s2ta(ront4olenif3tydfs ea(vs (4treomr3iadlmt  ueo s)tetoirpou1opte icsas  rurx oot0apxnmfctlsfs2uaumsn(0 ltomo iotfmDe iesls)t2to(opno4lmt mivils aDrru  ;o0optnif3tltfs ea(vsn(4 lermo tatlat  uvi t0 rumxmpnu1open nvta()sDtmxm nt4oleo i3tls a2rlnvon(4trxnmf oatfaD lnvol()teumxm iy4al n net tfa2taxr ;t4texnmoeiydlsDuau p (4aetoxfcty1lpDrauvi s0teurxo oodlltnmies t aDta(rooo1ope if3ilt a2rl(ms;u4trtnif3io1fmD lu s;s) 2umxr nydomen fesas aDrau  oo0teen ictldlsDra(von(0tltnxr oo1fmDeli ols)trxo(rpoudameelncsl( a2uaump;o0alxomfctadfm em( p;u)tltnxf oadlpteluei s0sexoxm iydop  mfcia( aDtr(mpot4ale ifetas mDel(mp (0treoxo tatfa  lnvsls0 etmio iy1lme micsa()s2um(moou1oetoiieiydfmDulu p u0texoiocoytfm eanes s srto(rpou4lm e nvi s  2umxm no4oetoiiciyslmDrmn pnu4tetoif oadlm eluvol()srumxo oudop nmivi t s2tr(  ot0tlx ioeiyd s2rmnvp;t)aeenmf oytla rluei t trxmim oo1apte icil( arurur ;t1ale  ietys mDrln onu4tlerircoa1omte uvo;() euo(r3oydomte ict (fsDtr(ro;o1optnmo3ilslmDemn o u0 rerxo oydopte nesls0s2tm(r iy4lme lfctlsfsDrm(moou4aetoif3ildls ua(mp (0tetoircoo1fa r i ilt  2trxr3nu4omtnmnet ()sDtmxrpnu1opt ifciasfa uanvs;u0alxoxr3totfa rau o s  eurim ny1lp nmivs ( sDraur ot4tpt moeilt aDrlu s;u4aeenmocoy1lpte ies ( t2ur(r nu4op  mnvt (f rra(rp;o0apxn f3tas s rmu p;()tetnirciytla   n i s)trum(mpio1alte ncslt s2rmx ono4aee  f3ilsla rmnms u) etrxrctydopt  nvils)s2xmim ny1llt lici t arra(mpnt1tleo i3iatlsDulu o;u0 rtoxr3ootopt anvi;s)t2uoirpiy4alenliviatf Drrxrpnt0opxn fetatfa2um(vs t4 leoif iydfp rlivs s seurirpoodlmt mies t a2ur(r no1olx iieiydla rmuvpnu)areoxrcia1lpDelu i;() rto(o oy1amtelfvtls)srtauroou4ape moeiysls uau s u4treoxocoy1lm r nei s  rur(m ny4lltelnvil() 2tr(rpoo1teen oeiadlmDrm(vonu)tltoxr oodoaDeluvo;t)seuo(r iy1ameelicil(fa2rru pou1tlenif3ils sDelnmonu4 etomr3oy1fmDelneslt) rxm(o ou1omeemnvias  rta(mpnu0texo f3iys m2rmn p;(0 leomo3totoatr u s s0seuo(r3iydlptnmiet t a2tmxmoou0optn oeiyt aDuan o u0 lxrmrctotom  lnvi (0sexmir3ny4ap   ncs (fa2tr(m nt1alto f3tld sDelumo (0aetrxo3iotlpDrauvs t)trxoxr oo4am emnet tf ruaxmp;u1apxo ieils m raumpnu4aeeoif to1lpD  nvi (0 2trim3iy1optemfesatf 2tmurp;o0tetnifctytfm eanmo ()teerxocoytoaDe ivils truo(m iodamt lfvsatfaDum(monu0alx  fciyd aDemnms;t)trenmr to1fm eaivi (0sruoxo oudapen fct t)arraxmpno0olx mieiyd aDum(vo u)texoir iadfaDeau ils0trurxo3oo4olee fvi () Dua( o;o4apenmictatls umnmpnt) rtnif3oatom  li ol( teum(m3iydom nlneslt  2ururpoo4tpto o3iltfs2ul( ont) renifcia1fmte nes t)s2xm(o iu4apenlivsatf rrm(r nu4apt  i3iys mDul(mp;(0tetrxf tytlm r n s (0 2xr(o oy1ap  mnci ( s2uau  oo1aeen o3iydla2rlnvp;t0artoxf tatop eluvo;t) exoxm3iudom  lnvil( aDua(m ot4tlenmoeiadfm2eaump t4trtnxo iodlaD luvs;()t2um(r ou4apteliviltf rtrxmoou1alen f3ild m rlnvon()aleoxo oy1lm eluvsls) eurir ou4lp e netls) 2ur( ono4tlxoiiciadfa rlump;(4aetomf oytoaD luvs;()s2xoiopiu1opeemfeils s2ur(ro;o1apxomoetysla um( o;t0tlerif iy1fmD auesls)seurxrpny4ale lnvilt)sDurxmpot0oetnio3iat mDumnms t0 renir3oa1fptrlnvi;t0seto(r3io1oltnlneta(faDtm(mp;o0opeoioctyt s ua( p u)tlxnxr tadfpDraieilt0sexmiopiy1ol nmnci sf Draumo;u0tpx mi3iytfaDea(vs u) eeoxr ty1op elnvsls0 2xoxrpoy1op  lieta()srumx  ;u1tltnmieiysfsDulu sn() ltrifctatlate nvil()srtr(o3iodole  ncslsfsDtmxrooo0aleoifetlt a elnvpn(4tltomf iadlm elu olt s2to(mpiy4lm n nvs (fa2rr( pno0oleomieilsls elump;u)alenmfctytoatr ivi;t)trurio3iy4lpe  ivsa( srrax pno4oee mo3ildls rluvp;t0alenir3tytoa eauvs s  rtmir3oo1omen nciltfaDtaxm ;o1aptnif3iytlsDuanvp;u0 exoio to1la   nvo;t0trxoxr oo4ll nmfct s  2rrur nu4oexnmi3iad a2eauvs () eeomf todlm  ai o;t)teumir nu4amee ieiltfsDum( ont1texo i3iys m2umuvo u0areoiocoytfp rauvo t0teumim3nu4lltnlnci s)a2umu  no4oltnii3iydlsDum(vo;u0tltrxr totoaDeln i;s0 etrxr3iu4al  micia() 2rmu  nu4apto fetat s rauvo t0 eeoio tytlatelues t)s2xmim oo4am nmnct t)a2tr(  ou0tetomociasfmDumnvont4aeeoio3ia1lmt anvil(0s2toxo3io1lp nmnvta( srra(r ;o0aptomfciadla emnvpnt) rtoif3iy1omD  ueo t trtrxo3iy4open icilt)s2tm( onu0aetomi3tytfs2um(mo;() lerif3iytfm raneo s)teurio3io1ope lfvsl(fsDtm(ro;t4oetoif3tlsfmDrlu p t)aetnmrcoodoaDrlu slt)srurim oo1alenlnvilt sDrr( p;u0apxn ieiytfmDuanvp;()trxoif totfm  lnes ()setr(m nu1altnmnvtat)sDrmxm ot0apxomoetytls emums t4alermf3todfa rlu sl() 2xmxm no1op n ncs (fs2taumpnt4tle  f3tyd mDrmnmsnu) rtoxf3oatopteln ils0srtmiopny4lp  lnvtlt a2ur(  ;o0texo iciydlaDeluvsn(4 lerxrcoydopt anei;s) exmio iy1open fvs t  rrmx p;u0apxn ietydfsDuau onu)trtoxf iy1fatelu ols  2trim3oo4lpee icsas a2umx  ot4opeomfciydfm2umumo;(4altomo oydlm  li sls0seuoim iy4llenlncias)sDraum nu4aeenmf3ildla2ulu o;u0teenxf3ty1opteaivilt0srurxmpoo1lm   iet t)s2tr( ont0aetnifeild a2elnvp t0alenmf3oytfatrlivo;()teto(m3io4amt lieta( sDra(r ot1apeomi3ildls ea(vsnt)alxoxocoy1op   uei;s  2to(o oo4oltn fvi t) rrmxmp;u0ale moeiysfm2uln s t)aexrxr3totfmD livsl( t2tr(opiy4lme lnvil( a2ur( o;u4tee  oeiaslaDum( p;u4aleoxrciy1fa raieo (0 etoxm3nu1lpee feia( s2rau ono4oltnmo3tydfsDulu o;()arenxr oa1lptrluei;s) exr(rpnydame  fct sfs2rrum ;o1optomi3tltfa ulnvo;t0trxomfcty1op eauvi;t  2trxr3iodoleelncs t  Dtax pnt1aeeo octysla uanvs u0arermr3iadfatraivi;( s2urxr3oo1lpenlncta(  rumxro;u4aex  icilsfaDran o;u4artoioctydlpt aueslt srumirpoodamt mfcta(f Dtmurpot0oltomfetyd m2rm(msnu4 ltnmr3ta1laD anei t trtoim iu4apen fct () rraump;u0aptomi3ias aDean p;u4tlxrxf to1omDeanvs (  2ur(m oodoltemnci tfsDrr(mpot4tpeoiictldfsDeanmont) lenxo io1opDrlu ils0 2um(o ny4llt mncs (fartrxmont0olxoiictltfaDul(mo t)tetnif3iadlmDraueo () rxmxrpou1lltnlfctl()artm(mooo4tltnifciatfaDrmu snu4tlerxrcoodfp  lnesls sruoxrpnodom  mics s)aDtmxrp;u0oeto ociadlsDeanvp;(4tlxrif ty1laD  i o t)srurio3oudoptemnvsasfsDuax  ot0tee  fcilslm ean o (0 renio oodfate iei;s0tetm(rpnodop   ivs ( sDtau p;u1teto ocils s2eau pn() rxomo3todomtelu s;(0teur(r no4lp  mieil( a2rmu  nu4alxnio3tlt mDumnmp;u0artriocoy1oate n o;s  eurxo oo1altelici ()a2trxm nu0texomociasls2rlnvont0tlerxr to1lat auesl(0 rumim3oo4lme livs t  rumxr nt1olto oetlsla ua( s (4treoif3ty1fptraivs;s)trur(r3nu4ap emfvslsfa2um(m oo4aetomo3iadlaDrm(mp t)aetnioctodfmD lueo t0t2um(m3nu1optn neslt) Dta(mono1tex  ieilt mDra(vp (0teermoctodfmtrlnvil()sruoxo3io1openlivt tfartru  ;u0oetnii3tlt a elu o;t0 rxnmfcoadlatrlueil(0 2umirpnodlme  ics s)aDua(m nt0apx  feiat a eanms;u)tltoif3iodopDeanvo;s trtmirpny1apte ies s aDtr( o;u4alxn iciad m2ua( p;u4trerxfciydfm  li s s0 2uo(m3iy1ap nmfei s)srrmxmono4tlxnmfeildfm elu s u0teermr iotlp   ueo;(0 rxrir iu1olen ics sf Dtrxmpno0ape iiciatfsDuanvp u4 ltnmocoatlmtrai o s  2trio iu1openmictl(f rrr( pnt0tpe ii3tadfaDea(ms;u4 ltnmo to1latr u o;s0teumimpoudll nlivtat)sDrr(r no0aexnifeiltfa2emumpnu0artrirctotomte n i;t srxmio iy4ap  mivil(fsrra(m no1oeenmicildfmDeanvonu4 lenirciy1lat  n ol(0 rtoir3nu1lp n fesl( srrr(  ;o1openmoctls aDuan p;t)artrioctatom eauvols)trtm(m nydom n nvsatf Dtax pou0oeen ietydfmDul( s t)altnxf todlptranvo;s0s2xmimpio4aptemfetlt aDum(mont1aeeniietadfs eluvs u)aexnioctytfaDeai ils  exm(rpoydol elfei (fa2um(mpno0aptniieiyt s umums (4aexrmo tytlptean s;() 2uo(r oo4om  lneias a2tmxro;o1olt ifctldlsDul( o;t0 rtnio3oy1lpteanes;(0srxrxm iodop elivt ( arum(m ;t1tpe moeiysfsDel(vp ()tlxrio3oodoaD auvo s)srxmxm io1amtemfcsl(faDtrurpou1aee mfcias mDuluvsnu0trxrxfciatlp rli s;()setoxr iy4ape lnvsls)srrmxrpnt0oltn fetlsls eauvpnt0tlxoirctodomDeliesl(  exo(m3oo1amenlnvsasfsDumxm ;o4tpxniieiasfm elnvp;()aeenmrciadlmt au i t) ruo(m oy1ol n ivilsfaDtru p;t4oex  feiadlsDrauvpnt0arxrxf3oa1fa   ieils)texoio3oydapeemfvslsf 2uauro;t0olxnifctasls elnvo;(4altnif3ty1fm   nes;(0srtriopoydal elivsl() Drmxrp;t1tle  feiadfa rlnmp;u4aetnxr3totfpDrlnvs;t) 2umir iy1lmtnmivsa() rta(rpnu1alenio3tydlm rlnmont4aeeoio3oy1op   ies t0 2trxo oo4lpeeliet t sDtr(ront0oexo octaslmDum(mp;t4 rtrmf3oadomt  i i;()tetr(m oy4llt mfvs ( a2rm(mp;t4oee  ociaslsDrau sn(0trerxo3ta1fateaivilt0trum(m3oodamenlfes t  Dtr(m ;u0opx ioctls a2rl( p (4treoxr tydfpDelues;( trto(r ou4llt lfvtls  2tmxm ;t0oleo i3tyt sDrlu o;u0alxrxr3iodoate iesl(  euo(m3ny1lp  lfci () 2taxrono0ole ifetlsfaDrauvp;u)artnmfcoy1lat lnei;s trxoxopoy1om e net () Dtmu  nu1apxo fetytla uau p () rtniocoadfmt anvo t)t2uoio oy1lle  ncslt)sDrax poo4oeenmieias s rl( onu4arxrxoctytom e ues t0 rxoxo3iy1op emietl(fa2rrx  ;u1tetnmoctyt mDul(vs;t)areoio3iodoptrauvs t)s2toir iy4omtelfctlt aDta(root4tpe  ieildfsDrln on(0tetnir iydoa   nvsls)srtr(o3iu4lpt livi sfsDtm(  nt1alt ii3tysfsDua(mpn() lxrmf3oydfatr nvs;s0t2um(mpoydop  mncsa(fs2rrxr ;t4olxnmi3iytls ua(mp u4aexoir3oydomt lnes;t)srxm(r oudamtemnet s) rta(rpno1alt iieildfs2ua(vs (4artnxfcty1fa   nvol()trxr(m iu4lptnlnetlt)sDrau onu4apx mfcild sDrauvo u)aexnxfctadlm r ieo;t s2tmxopnudale  feia(farrau  ;o0altnmfctysfsDrl(mo (4treomr tydom eau ols0setoio no4ape mivil(fsrumum ;u0oeenii3ildla2rm(vp;u)aetoxr3ta1opDr ieo;t sruoxo3nu1llt mfeslt aDtmx oou4oexnmietytlm2ul( on(4alxoir ootfaD au il( t2xrio oy1lptnlfvsat)artrum oo4apenmiciys a umn p;u4tetnifctodlatr iei ()setr(rpou4am emici sf Dtr( pot4aeeomocilt m2ran o u0 etrmoctodfa elu s;t t2uoimpoodol nmnctat sDrmu poo0tpx iieils sDrlums t)alxrxf3iy1fm e n i;t0 rtr(m oy1lp e ncs t srur( p;t1alx ifeiltlm umnms;(4 exnxr3oodop  au i s)t2trxopiu1opte netat)a2ra(mo;u4altn octyt s uau s u)arxoxfcootfaDeln sls0t2toimpiodap  lici s srur(mpnt4olt  f3iyd mDrm( o u0aexoxf iodoaDrlues (0trumxm ou4oleemictl( sDtmumpnt4tpx  oetytlm eaumsnu) lxnmr oytlaDean s s) ruoim3nu4ol n ict (f 2rrum nu0ape  f3iasfaDrluvs;(4arermo oy1lp   nei t0 2urir io4am e fctl( srrmuronu1tle  fcildfm rl(mp;t4teeoxr3to1fptean s;(  2to(m ou4ap elfctlt sDua( pnt0apenio3iadfm2umuvp (0 etnxf iodla r u i;s  exo(mpnudam e iei t srumx poo4aexnifciatfa rlu ont)trtnmr oadoateauvi;t srto(r nu4ap e iciat) Dur(mo;t4tptoifeiyt a2elnvp;t4trermo3iatfp rliei t)texr(mpnydol elies s)aDuaxro;o4tpt moctltfs rmumpn(0artnxo3oy1fm e nvo;s0teumir io1ap nlfvtatf rtm(rpnt4tpx  f3tlsfs rlu o t)trenxo iadlaDrlueols s2uoxo io1ol   nvt tfa2rm(ronu0aleoifciatfsDrmu sn(4aeerio3tydomtraieslt)s2trxm iy1alt mfvsa() 2tru  no0ale  fctat m rmnmo u4trtomo todfa   u s;s)sexriopiy1ol nmfvt s) 2urxr no4aex mociadfs rauvp (4artrxocia1fp e n i t srtm(o nu1lm e ivt ( arurx pnt4tex moeiyt m2raump;()alxomfciodoa e uei;t  2xr(r nu4ame mivil(fs2rmx pnt4tleoiociyd m2uan o;t4arxoxf oadfm  ai i s) exmio nodapenmfei (  Dum(ront0texomf3iatfm ranvs u)teeomo iatfm rauesl
\ No newline at end of file
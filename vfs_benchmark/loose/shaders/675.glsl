@@ -0,0 +1 @@
+uei;t0sexm(m3oodomt mnvs ()sDumxm ;u4ole moeiatfs ua( s;u)tetnxfcootla ran ilt  2urir3oudolt mneiat) Dumx pou0tltoio3iysla ul( o t4trxnmr3iadfat aies;t  2xoxopoo4amee fctlsf Dua(m ;o4opxo ociad m uaums;t)arxnxr3todlmteai i () 2urirpoo4lptelivs t)sruaum ou4tle mfeildla uanvs t0aeeoiocto1op eaivo s srtmio ou4ll nlfvt ( artr(rpoo1tpe mfeiasfs elnms (4aeermr iodlm  luvslt) euo(r3oo1op e nvslt)artaxrooo0tptn octls aDrmn p u) leoxr3tadomDelnvi;t0seuoxr ou4apeemneta(fs2umx pnt0apeo feiasfs ean p;u)alxnir tydoaDr iei s)s2trimpoydlpeemnvt t  2um(  ot0tlx mf3ias sDuan snt) eeomf tytfa  aueslt  etoxo3iy4alte nctas)sDumxront4ale  feiydfa ul( pn() lxnio iadomte ues;t texr(o3oodome  ncsatfs2rm(mpnt0tpxomieiys s2eanmsnu4texrmo iytlp  an o;( sruo(m nu1omeemfct sfsDtmu ont0tleniictytlsDul(vs;u0 lermrctytlpteai i;(0 2tr(opiy4apt mictatfa2raxmpno1tpxn feiyslm2ranvpn() rtrmfcoydlmD  n i t  2uo(o3iy1lp   ncilt  Draxmp;t0teeoiicild m eanmpnt)aetnio oydlatrluvo;s0t2urxmpio4am emncsa() Dumu  ;o1ope ii3iaslsDuau pn()artnir3io1oatrluvs ()teurxr iy4lpt  ics ()srraxrpno4aexo fciasla2rl(vo u4aexnmr3oadoaDe nes;t srto(m io4ame lncilt a2ua(  ou4oex iociysfm2uaumsn()aetnif oadopt an ol() rxmxopiu4opt  fvsls a2ur(mont4aexoioetad aDul(ms;()tlenif oo1lm rauei;s0texrxrpno1omt  nci (  2rmx  ;o1olxnii3iydfsDrm( pn()alxnmo3iytfm e nvo s) rxrxm iu4lpenlnciltfarrrx onu1oetn oeiyd mDea(vont4aeerxo tadop r uvo (0 2uoio3oodole  ivsa()a2taxm oo4tetnmieiydfm raump () lenio tydfm r nvo;t0srumxr3ny1oltn fei sf Dtr( onu0alenifeiytfs2umu s () etoxf3io1fa ran s;(0srto(m3ny4omtnmivils aDuru onu1olx ifetadfm2ulnmp;u4 rtnir3oytlmt auvs;(0texmxopio1optn ivtat)aDrmxrp;u4oee  f3iasfa ulnmsnt0 exomo iodopt  uvo;s0setrio iy4am   nvil()a2umxmp;u4oee iiciyd m eln s;u4aetnmr iytlmDrlneslt)texmim oy1lpee fvs t)a2rmxm ;t0aee mictytlaDemnvsnu4aleoxf3todfp ran s s0 etoxo3io1olee fcsa(fsDtm(r ou1opeomfeild mDeluvs;()aetnxo3tydlat au ol()setoim ny1am  mietlt)s2taxront0optoioeiysls2rm(mo;() etoif tatlatranvil()t2toiopiy4lmt  ivi s)artm(mp;t0oltn iciytls2ulnmsn()teeoxo oa1lp eaivo s0 exriopoo4lp nliesatfsrurur no0tle miciytlsDum( p t4 lxrmf3ty1fp raueo t) 2toimpnodom emfvtat  2rmxm nu1apeniietltfa emumo;()tlermr tadfmD  u s;t0t2tr(o no4lpt  ies sfaDtaxrp;o4alxnmo3tat sDelnmo (4trxrxf totlaDraueo;s teuriopoo1opeemfei ( a2rm(  ;u1oltoioetytlsDrauvo;u0tlxrio3iatfaDr u o;(0s2uoxo3oy4opte ivt t aDur(ronu4opxnii3ildfsDua(vs u4aexrxociy1faDeluvs;s)trxrim nodap   neil(  Dum( o;t4oexoifctltfsDuanmo (4altriocootomt ai i t  etrimpnudaptnlnctlt sDrm(ronu4alt iociasls2elnms t4arxrioctytla e uvi;t)t2umirpnudopen ieiltfartr(mpnu0apt  i3iaslm2rau p;t4 rxomf iadfmt aivs s0 2uoxopoo4lm nlivtat s2rmx  ;t4aeen fctlsls2eanms;u) etnmo3iytopDeln i;t) eur(r oo1omeemicsls) 2uaxmoot4apx  fetlsfs rmuvsnt)aexrif iotoat au i;() etmxmpiu4lp n ivilt)aDuau pnu0optoiictasls2rmuvon(4tetnmo tadlatraiei;(  2xoirpou1apee fvi sfsrra(ronu0aetomf3tytfs2ul(mo (0tltomr iy1faDelnvols)texr(o iy1aptnlnct t) rrmu  nu4tleomociytfsDuan o u0 lenir oytfpt luvilt)teur(opiu4op   iet (fs2ra(mpnt0oexnifciyt sDuaump t0tetrxf3ta1oa r i ols0seto(m ou1am   ivi s)sDtr(monu1ape  ociatfaDrmumo (4tlermf3oytfa rlivol(0 2umio nydamenmictatf 2ta(rpoo0tptniiciasla ran s;()aeeoxr todopte uvil(0trxoiopno1ol  mieta( sDrrum ;u0tpxoifciydls eluvo;t) leoif oa1laD livi;s0 2umir ou1ol  mfeslt a2tm( pou0altnifctasfmDrluvp u4tleoxo3iy1faDelneilt0t2ur(m3oy4lmenlncs t arrau pnt0tltn o3tat m ulu p u4trenmo iadfmt  ivo;(0 rumxm iy1lm nlnvsa() 2umu  ;u1opx iiciysls2el(mp;(4 etrif iatlm e uei ( sruoirpnu4amtnlfcsat)sDtrumoot1opeoiicildlm rlnmp (0 exnifciy1lpD livilt) rxo(opio4olte fvsl() rtm(ro;o4oet  octydla2eauvo;u0aexrmf ty1fpD  i o ( srtoxopou4ap e ict ()artaxm ;t1apt ioctyslsDul(vo t4 reoif oa1oa eaieils) rxrxmpoo1lmtemfesls srurx  ou1tpxoif3iydla2elnvpnu0 exrif todoaD lu s;s  2xrxm nu4lpt lnvs sfsDurxmp;o4tpxo i3iytlm2rln s (0aexrxocoodfmte u o s0t2urxo oodllt mies sfarrm(ro;t1altnmfcild m emums;u)texoif io1om  lu ol() rxrxr io1ome  fcta(  2rrxmono1aleomfciysfa2rmu on(4tleomr iytfm e u o;s)teurxr oo1ll elivi s  rtruronu4aex mfeiasfm eln s;u4 rermocia1oaD li s t sexm(r nydll  lfvias  2tmx  ot1aptnif3ild a2rau s (0 rtoirctytoaDelu s;s)t2tr(r ou4ameemncil()s2umum ou1aetomfcild m2uln s;u0tlxoxf3totfm  ln ols0t2urim3iydaltn ivsls) Duaxroou1tlxoif3tadfs rmumpn(4 exrmfcta1fat livsl()tetrxrpno4olenmivs t  Dta( pnt4aptoiociyd s em(mp;u) etrmr tytoatelivi s trtrim ny4llt mfvtas)sDua(mono0tptniietyd a ul(vp;(0 lxrxr3io1fpt lnes;s) exrir3oydllt mieil( a2rmu  ot1oex iieias aDrl(vont)trenmo3oa1lm r nei t0 eur(rpnudoptn ieiltfartmx  nu0tpx  f3iydfa2eaumont)tltoif3iytoateaieil(  exmxopou4op   feias)s2rr(r ;u0aptomiciydla2ulu onu)aleniocoa1fmte uvols  2xr(o3nu4ll nlfeils)a2ur(  nu4oetnio3tydfmDrlnmp u)alenif3oy1laDeli i;s  rtrxo3nu4ole licils) rum(ronu1opxn fcias mDelu onu)trtoxf3tadlmte n ols) 2tmiopno1ap emnctas)srur( p;o1opxnioetyd m ulnvs;(4 ltomr3iodomt aneil(  rumimpiodom emieilt)arurumpoo4olx mf3iysls2elumo;() reoxo iadopte u s (0texm(mpoy4op nlietl()a2ur(m ou0olt  octad sDrmu on() ltomr todla   n s t t2tr(mpiy4oltelictas srta(m ;o4aexo f3iytla rl(msnt0tlerxf ta1lptelivi (0trxmxr3nodal n nvs s srrrur oo0olxnif3iasla ul( pnt4arerif oo1opDran s ( trtrirpnu1opeelivslt sDtmxmpnt4alx ifciasfm um( o;u0 rxrmo oa1oa r ivilt0 2uo(mpiydlp emictlt  2rru  nu1tpeomfcias s2eln s t)altrio ia1lat  u sls teurim oydalte ncil()aDrr(mp;u0tetnmociat mDumn sn(4aetnxr3tadfa raneo;t0s2to(opio4lmtemfeias) 2uaxm ot4aet miciysla2emnvo (0 lenmf oy1lmtrlnvi;t)srumirpou4ap elfvs s arur( pou0tpxo fciydfm2rlums;(4 eenmociadfmD auvo s) exrir3io1lptemivias)s2rax  ;u1aexn i3iytfs2umnvsnu4altrmf3oadfp r nei;t) ruoxr oy4oltelnvs tfartrurpno4opxomoctldla ua( snu)trtnio oadfmtr i ol( s2xmir3iu4lmenmnetl(f rrmum nu0tlxoiociyd s2elnvsn()trxnmr3to1op   nes;s0s2uriopny4ope mfeslt srururonu0tptoiociad s eaumo (4areoxo3oadlm e ieslt)seto(r3ou1op e fvs s  rum( pnu1aee  fctysls uau s;t) exnmfcoo1lp ran s (0 exoxr3nu4lpenlfesl() ruaur no1alto o3tytlsDrl(vp () renmociytfat auvsls0trxrirpoy4alenmnviat a2um(m ;t1apxomictlt mDrlump;()areoxr oodfa   nvols s2urxm iu1op   ics tfa2ur( ont0oeen ieilsfs ulnmsnt) rerio3oadoptelu s;s)t2xmxopnu1ll e nes (  rraxrpoo0aeeomiciysfs rauvsnt0 rtrxf oytfmDeanvs;t0srxmxm no1am nlivil( artrum ;t1olxo fctltfmDemnvo u4texnmr3iodfa r ieolt)srxo(m oy4ll  lnvi s a2ta(moou0aeeoiiciyd a2eanvpnu4tlxoir todfpD aivs t tetmir3nu1ap emnvsa()aDtaur ou1ole  iciadls2ua( o;u0alxomo iodlpt  neo;t trtmxrpoodlltnmfcs (  2ua(  ;o1opeoiietldla2ea( on(4tlxnircootfm rluvo;( trumxopio4ome mivt t  rtmxrpnu1tleoif3iaslm2emnvs;u)trxoio todfmt auesls s2tmimpno1oltemnvt s sDrr( pnu1tltn fctyslm2em(mp;t)trtrif tytfm e ivils)trurio3io4al  mfesa(f Duaumono1tetnii3iysfa ulnvp () eeomoctydfp ranvi t s2uoiopiu4lm nmivias a2rmurpnu1teeoiictytfa el(mp;u4trxrifcta1op rluvs t srxrirpoo4al   netlsfsDraurpou4tpen f3iatlsDumuvs t0teenmocto1oaDe ueols t2xmir3nu4lp  lfctat aDta(rp;o0olx mi3iadfmDul(vo;t4 lxoxr oodlmtr u i;s0 2toxm3ou4al elfesls)srrau  nu1tptn octlt s2el(vo;()texrmfctodfat aueo;s setoxr ou4lmen ivilsfa2rm(root0tlxoioeiyslaDem(mont0tltrmo tytla eanvi s seum(r3ou1lpeelncil( s2ur(ro;t4alxniictldfaDran p ()altnircoytfpDr ivo;s0sruo(m ou4omte fcs tfarrru ont0alxomfeils mDuln snt)tetnmo totfp rau i s  exoxo3ou1apt lfcia(fartrum ;u0tltn iciltfa emn o;t)aexoif iydlm  anei;() rxoxr3oy4lltn net (faDtaxm oo1alt  i3iat mDum(vo (0trerio3ootlpt ai ols)s2uo(o3io1om  mivsa(fs2ur( oou4teeniicias a uaums;(0teeomrcoadom ean s;(0sexm(o3nu1apt mivtls  2tm( ooo0tpx  i3tlt a2el( pnt0arerxr iytfaDrluvi;t) exrir oo1amenmfctas  2rrumont4opx iietatfmDelnvs t0aetrxo3oo1fpDrliei ( s2urir iudlleemnvil()artaumoou4tetoifciydlm2um(vo;t0 lxoxrciatoaDeau ol(0t2xr(o3iodame livsl( sDrrurpou4tpe ioeiyt mDua( s () ltnxoctotomtrlivi s)trtoxr iy4al nlnvtl(fs2um(m ou0tpxniocils mDemuvont0alxrmo oytfaD  ueols0 euoir3iu4op nmies tfsDra(m nt1tleoio3tltfmDemuvont0 rermo3iy1faD lu s t)t2ur(o3iy1lltnlivilt)aDtr(mp;u4oeeoioetat s2rm( pn() lxoxrcoa1faD  nvo;()texmio iy4omenliei tf rtmurpou4aetnif3iat s um( s u4aeenirctytopt  i ils t2trirpiu1aleelfvtltfa2rax pot4olt  iciatlm2rl(mp u)altrxfciytfm  ai o;t)trtm(opiudomtnmieta( arraxront0oexoifcild mDrl(vonu0 ltrmo to1laDran ilt)srxr(r nudaltemiei t artaur ;t0tlxniicilt a2ulu s u)tltoxf3iatomDe uvo s0 etrim3iudom nmnvt ()srtr(mpoo4tlx  feilt s2ea( sn() eerir3ta1fpDr ieo;(  etrxr ou4op  lnviat)sDuaurp;t0tetn ieiydfm2rluvs;u)tetoxo tatomtr u i t texm(r iudlmenmiciasf 2uau  nu4tpxomf3iatfm2uluvp t4 rxnmf3ootopD li o (  rtm(rpou1am  lnci s  2tmxrooo0oltn ociaslm2uauvs;u0tltrir3ootlmD aieo;s)seurimpiu1amt  fvi ()aDraxro;u0tptnmi3iat m emuvpnu4alerir iytoat anvo s)t2xmir3oodlmtnlfctl(fsDrm( pno4tlxnmoctytfm2uluvs;(0alenmfciodlmDr n s;s seum(o3oudamtelfcsas)s2umuro;o1alto ociadlm2rmnvp t)arxoxfctatla r ueo;(0 rxrxm3oy4lmt mfvia(f rrrumo;t4ope ioetas s2uauvpnu4texrxfcoodlp rlivs s0 rtmio ou1llenmicsasf rrrxrpnt1optoiictadfs rl(vpnt4altoxociatlaDraueo;t trto(r3iu1opeemfcsltfa2raum oo4tetn fctat a emuvonu4 etnxf3tatfpD aivo t0teum(r ou4am   fetl(f 2uaumpot0opxn fcias m ran pn(0trxrifcta1opDrluvs s trxriopoy1lle  nvi (f 2rmump;o0aetoioetadfa2rl(msnt4 rxrio iy1lm e neolt truo(o3iudomen fes t)sDtmur ;u4aeto oeils s2rmuvs (0alxrxocoydoate nvs;t0setoxrpoodllt  nct t a2rr(r ;o1tlx  fetas m ea(vo u)aexnmf tatfmD auvols  exoiopny1om nmfcils  Dur( ono0oetnmfciatfs ranmont)trxomr3tadoaDe u o;t0s2trim iudameelnvsas  rrr(rpnu4oeen oeiytfa2ua(mo u0aleoxrcoa1op raivo (  2um(rpiudamt mietls aDtaur oo0teeoifctydls umnvp u)texoir3iadop  ln s t s2uo(r3iodol  mivt s) Dra(ro;t0aexomicild m2ea(mp (0 lerir to1fptrln sl() 2trxr oo1lpt lietasf rtmur ;t4oeenio3taslsDemu o u) rxoir iodlaD ai s;s)t2uoxo3ou4al  mfvia( sDtau ono4altomo3iatfa2ul( ont4 ltrxf3todlm  aieilt  2tr(m3ou1ap elivilsfsDumu  nu4tptnifcilsla ran o;u0artoxr iodopDelu i;(0 2uoimpiudlpe  nci (fa2umumo;t1tet mf3tysfa emump;(4texomf3iydoa  anvo;t0s2xo(m3nu1amenliciasfsrtm(r ;u4oexnmiciadla2emnmp t)texnio oytopte ieol(0truoim ny4lmenmietat s2trx p;t1tpt  f3tysfaDeau pnu0trtomo3iytfmtran ols  ruoir3oudape mivt tf Dtmu  oo1teeoifetls m2ranvpnu) renir3iy1lpDrlivs t)sexmxopoudap  lnes sfsrumur ;o1oeeo f3iasfs2el(mp (4 reomrctatfpt aueils sexoxr ou4oltelicsa(  2tmum oo4aeen iciytlm rmumsnt0tltoif oadomteluvilt s2umxmpnu1ome  neiatf 2tmu p;u1tpe  o3ias sDrlnvo u0aleomrcoadomtr nvolt0texmxm ny1ll eliciat  Dumum ;t4aexoioetldfaDrm( p;t0trerxf3iytomDe uei t)t2umirpno1lptnmncsas)aDur(m ;t1optnmi3ilslm ua( s u4 renmf3iatopDe neol(0tetmim3iy1lmeemnvi sfarumxmoot4oexo icils sDea(ms t4 rxrxr oydlm ranvo;s0 euoimpoo4ol   nct s  rur( poo1tpenmo3iysfaDumnmsn()tlenxf3iatlmDr u i ()srxmio3iy4om   ictls arrrxmpnu0tlxoiieiyd m2umumsnt0treoio3oadfmDr nvi;t sexrimpiu4optelnct t sDtrx oot1tpeo f3iytla rl(vo;(4trenxrciytlpDrln s;s) etoxm oo4om nmfcsl()srumum nt1oltnmi3tydls2eauvon(4altomr tydopt aivs;s0srxo(r3oydope mict s  Dtrumpou4tpx ifciyt m rlu p;t0texoif iydom  li s (0trxr(o oy1olee neslt) 2tmxrooo4oee moeiyd m2rlumsn(0 rxomr iodomD aieo;s t2xm(r3no4lpen fvtasfaDum(ro;o0teeoio3ildlm umn ont)trenio3totlaD lies t) rxmir3iodlmtnmivi ( aDrrxro;o0teeo feiydfsDrlnvo t)tltrmr3iadfpte uvol(0seuoxm nudamen ict s)sDrm(mpnt4alen oetld a2ua(vo;u) rerio oodlmt  nvo s) 2tr(o3io4op nlfei s sDrr(moou0oeto o3iad s2ea(ms;u0tltomocia1fmtr ueols)sexmxr ny1am nmivt s aDum(rp;o4oeto ictlt mDua( p;u)tltrif3oydopteaies ()trurir3ou4olenlfctl() Drrum ou4oexoif3tasfaDrlumo u0trtnxocia1fp eaues;(0seurir nydlm elivsls) 2um(m ;u0alt mictydla2um(msn(0 exnxo oo1omD lnvol( t2urxmpiudlpen ics sf Dtru  oo4tpt  feiat s umnvs u4 eeomr3oydoaDe iesls0srxm(o oy1llte netls)sDrau  nu0tleomiciyd aDemumpn(0texrircoadfmDr u s s  etmxm3nu1lme lnvils)s2ra(rp;t0tpeoiicilt m2eauvp;t0trxrir3to1fm  an o t0teurio nu1amt mivs (fa2um(rp;u4aexn f3tasfm2ea(vpn()alerxrcootfmte nvi;()t2tr(o oo1omee fetas a2ururono4aetnioeiytfm ua( s (4aetrmocoytlmDe uvi;(0 2um(o3ou1lmte fciat)arrrum oo1tleoii3ildlmDumu pn(0alerio3to1om eaiei;t  2urirpno1lpe mfvtasf Drmxront0aex mfciyd s eau s;(4teerio iodfat au sls0t2toio3ou4al e fvt s  Duauro;u4tex ioeiadlm2elu p ()altomf3oatlpD  ies ()setmio3nudom  lnesasf rta(rp;u1olt if3iatlsDrl(vo (0altoio3tatom rauei s)srxr(m3no1oltnlfeilt  2rrxm ;u4tpt moeildfs elu s;(0alxrmo tatlp eai i t0t2xrio3nodllee fvi t artmumonu0aexo ictad m2umnmp (0tlxrxr tadlpD  n ols0texo(rpio4amtnlivt t a2trumpnu0oeeoii3iyd a2el(ms;t4trtomf3ta1fmD  uei s)s2xmio iydlme  fvsas)s2tm(ro;o1tetnmfcilsfa2el(msnt4tltomfcoytlat aieo s0 etr(r oy4alenmnvils  rurumpnt4tpx iociytfsDemnvp;t) ltnircoy1lptr nvi;t)srtr(o iy4aptnlies ( a2tax  ;u4olxo feilsfa umnvs t0aleoxo3iotfaD lnes;s) etm(o no1ape mics sf Drr( p;u0aee mf3tydlmDeanmont4trtnif tydfaDrai ols)seuoio iydamt  nei s  rrmumont1oexn ociadfm el(vsnt0trxrmf3totfm e nvi;t0 etrxr3oy1amtemncsa(  2umxrpno1tlxnmociatfm2emuvs;t4arerxfctotlaDeaues ()tetoir3oodal elnvt sf rtmxr ;o4aet mf3iydfm uanmo u) reoio3oytfaD  nes s)trtmxm ou1ap nlics t)s2um(  ;u4aleoifetltla rlnvs;u4tlxoio ta1lptrai ilt)srtm(r iy1lpt  nvtl() 2ta( ont0alxnifeiltlaDumnmo t4arxrxo tatfmDrliei;s t2umxm3iudap  lfetatf rtax pnt0opeomoctls s eanms;u) rxrir3iatopDeauvo;t0s2tmxm3oy4alen nvsasfsrrrxr ;o4opx  ociytfa rl( p;t4aexnio iodoateaues;t0texr(mpnu4al  lnei t) Durumpnu1ope mfciadfa2ra( pn()alxnio3iy1laDeau i;(0 2urir oy4aleelnvi t)sDurx  oo4apenmoctydfa2uanvo;t0arxnxrctadopDelivsl(0t2umim3ny1al nlncil() 2ra( ooo0aex mociyt aDuln p (4tleoxf oatfmDrli o t) 2xo(r3no1lm n nci tfsrtau o;o1opt mfciasfa em(vs;(0 reomfciydoa  auvslt) rxoimpoo1ole  ncils)a2ua( oou4opxnifcilsls eau onu0 ltrxf3oydoaD anvi s0s2xrxopio1olenmicia() rrmump;t0tpxoif3iat s rln o t0 exoio3tydoateaueols s2xr(r3no4lme lnctat s2ta(mo;o1tet ii3tatfmDulnvs;u4aeerir tydlat lieilt0 euoxo io4lmte fet t)s2um(rpnt1oexo ociadfa uanvo u4 rxomrcoo1lpD lu s;()srxm(rpio1lm  mivtlt s2umxrpot1tlenmfeild m2ra(vpn()teermf oatoatrlivolt0t2toxo3io4am emncsl()a2tr( onu0tle ii3ils m2ul(msnu) etrxf oydop e nvol(0setmimpnodolenmivi (fs2ur(r oo4alx  o3tys mDrl(mo;u)alenxo oodfaDelies;s)t2uoxo ny1lmen ies tf Drm(r ot0aleoiociat aDelnms () rtnir3oodlptraiesl() eumxmpoy4al emnetat s2rax pot1tpxomo3tys s2em( o u4texoxr3oydopDean i (  2trir nu1al emneilt)s2rru  ;o0apx ii3iytfs em(ms;t0tetnmo totlpD lieols s2toimpiodaltnmici tfs2umu pot4apx  iciys s ran on(4arxnmfcoatlptelnvsls0t2xr(r3nodapen nci t) rrr(rooo4olxo ieiad a eluvp u0 eeomociatlmDrli ol(0s2tr(m3oy1opeemnctls)a2tm(  ou0tpx  iciysla2umnmp (4tltomo iodfa  aieol()s2trxmpiu1am  lnvt s)s2trxmpou0optn feiytls em(mpn()aeerif3ootlptr i s s) rur(m3nudapt  fvtat sDtr( p;t1ale moeiasfa2eluvp;u0 reoif iytoa e neslt  rxrxr3iodal nlnct s s2uru pou0oltn ieiltfmDraumo;t)texnxr3oo1latraivil()sexmim3oydaleemfcs ()a2tm(ro;t4aexnmociadfaDrluvpnu4tlerir3oydlate uvi;(0 eurim3iudame lictl(fs2rrxmont1ape  oeiaslm uaumo (4tetnmo3iotlpDrlueol(0 exoio iydamtemfesat aDuaurpnu1tleoifeiat a emuvpnt0altoxf3oydfm e ivo t)truoir oudlptn nvt ( a2tauront1aleo fetadfm2elu s u)artrifcia1fm   neo t srurxo3iy1om elivi t s2um(m no1opt iieiadfaDul(vs;u)aetoif io1fpDeli ols)seuo(opiodam  lfesa(fa2um(m ;o1oee  i3iytls2um(mont0tlenio3oa1lpD au i s t2to(mpno4al nlivt tfsDtmxrpou4texo o3tyslsDrl(vsnu0tetrio3oydfa ranvo s texoxopiodaltnliviat sDta(r no1tpe mieildla ran ont0 rxoiocoo1omD livs s0trtmxo iudopeelnciat) Drmx oou1apxoiietlsfa rmn s;t0 exoxf tytoa   nei;( s2xoio no4al elfesl( a2uaxr ;u4olxnio3iltls2emu s;t) rtnxrcoytfaD lu ol(  euoxr3iu4alen ivt tf Dta(mooo4opt moeilt sDumnmsnu0tltoxo3ty1la   u sls0texmxm oo4ape lfvs (fsDurum ;t0tptoifeiad s raums (0 etomfcoy1oateanvs;t  2uoxo3nudlmtnmfviat artm( o;t0aetomf3tldlm ulu s t)tlxrmr oadlp eaueolt0s2tm(r io4lmt mncil() 2rrx pno4oetoioetadfs eluvpnu0arxoifcoatoptelneolt0setoimpiudop nmfvsat a2trxm oo4oex  ictysls umn o (4aeenmf3oydopD  uvol( sexo(opoydap e nesas a2ua(rp;o4tlen ocils mDel( s t0aeenmo3tadfmDrln i;s0trumxrpiudale mfes (f Dumurpou4aleomietytfs uau s;()tlenmrctotoa eaivs t0 rtm(o3iudomtnlieiltfarua(  oo4aeeoifeilt m2ea( o;u)tetomo ta1fpDran sls0srtmxm nu4oltemivs (faDtau ont4aleomiciyt a eanvp u4tlerxo3iadfpD  ues ()t2urxo io4amee ictat  2um( ooo0aptoii3iasfa ea( o;t)alermrctydfpte uvi;t  exmirpoudope mnvs t)sDuru ont4altn fetyt sDrmumpnt4 lxrir3ia1omDe nvsls)s2toim3iydam   fcs ( arrruro;o4teeoioctaslm2uaums u) lxnmfcoytopD lueo t  eto(o3ou4ameelfctls  rta(mp;u1olt mieiyd aDrmnmon()tlxrmrcio1latrai olt truoxrpny1lm   nvil()sDtmu oou1ape io3tlsls2um(vpnu)aleoxr iydlmtr n i;t)trtrir3oydll e nvsls aDrmump;u1aet mo3iadfs2emn s;t4 lxomr iytla ranvs;(  2to(m3nudop  mnvsat sDurxm nu0tpe  ieiadlaDrmnvo;u0aexoio3tydoatrlueslt0s2trir oy4lp emfvtlsf Dtmxro;o1tlt ifctatlm2ra( o t)aleoir oodfp eaneol( srtmxm iodlltn ieil()a2tmxroou0teen i3tatlaDua(vs t4 etomocty1lpt lies s tetmio3no4op  lfvia( srumxrpno1optn fetyt s rlnvsn() lxomfctotoat an o s trumim no1am nlfct sfs2uaxmpno0aleniociltfm ul(vp t) lxrmf tadfa  an i s t2xoim3oy1opt livs tfsDur(moou0oexn icilsfs um( o;t4 etoxr oy1lmtelneil(0 etm(rpny1am nmiviltf 2tmx  no4olxnmf3iydfsDua( pnt0arxnio oytfp  auvslt)sexoxr3iy4apenlivsa(fartmumono0oet ioctlsla rlums;(4arerxocoytlp  li ols t2xm(o3oy1apeemici (f rurxm nt4tptn fetatlm2elnvsnu4 eerxr3oadlm rlnvi t  exoir oydamtelfcsasfsrurx  ;u0texnmociyt sDrm( s;(0 lenmo3ootlmteanvils tetrxmpiu1lmtnlivsa(  rum(rp;o0opt ioetlt a2rmnvs (0artrmfctydfp   ivi;s texo(m nu1olte fesls)a2tr( p;t4aptn ietad mDra(vo;u4alxriocto1oaDelneo;(0sruoimpoy1am  micia(fa2urum ;u1olx mf3iydla2rmnms;u)tlenxo iadoa r i s (0 2urxo iy4om  mnvi s)srtaxrono4apxnmociydlmDel(vp u0arenifcoadfp  auvo s)srxmxrpno1ll nlfetatfaDtm(  oo4opxo f3iysfmDuanmo;u0 ltomr3oodlpD anei;s0t2uoxopiy1ll emiesas)aruaxrpoo0opt mieiadls2um(vont4tltrxrciadlp e n i s)sruriopiudomeelfctatf Durxr ;t4teeomictad m uln pnu) etrmfcoytfmte n sls trxm(o3iy4op nmnvsl()s2ra(roou1apt mf3tyt m2eanmpn(4artrmf oo1fa e nvs;s) euo(m3oo4omtn ici (fs2rrump;o4alxo oetld s emnmsnu0aetrmf3totop rln il( s2xmir io1lmte nvs () Drmx p;o0aeen o3iys s rl(vo u4aetoxrctydopDr n s s)srtrxm no4ape  nesltfsDta(m ;t4apxn oetasls rmuvo;(0tetomfciadfat an ils)setmir nu1opt  ivta(f rtaum ;o4aeeoiocils m ra( pn(4trtrmo tydoa e n o;s)trumimpnodlpee nvs (fs2tmurpnt4oexn fciaslm2rlnvs u0trermr tytfm eluvs;s0 2umim iu1lmeelnesat  2rm(m oo0tex iictasls2em(vs t)teenio iytla  au o s  2toir3nudomtnmicsl()srrrx p;t1tee mo3tat aDuanmsn() eenxocia1oatrlnvsl(0s2xo(o3nudllt mivtlt)s2rruro;t4olt mo3tasls uaumpnt)tetoircoy1fmt lnvsls)srumxo oy4ol e fvs tfa2rm(mp;u1opx ioctls aDrl(vo u4tetrxf totfpDe ivi t)t2uoxrpoudlltelicslsfartmxmo;u0alt io3ildlm2um(vo u)teerif3tytlpDrai s;s)setr(o3ou1omeemics s) Drm(rpot4tlxn feiatla2rmnmo;u4 etnxf iydla ranvi ( trurxopou1optn ncsltfsrur( o;t1opx ioeiasfa2ea(vpn(0tltoio tydfpDe ieil( s2urxm oo1lltnmfvslt  2urxm ot4opxnmo3ils a2rmu s u) ltnircoy1la   ueo;t0seur(r oy4lmtelietasf rua(mpnu0olx mieildfs ea( p;t4tlxrmr3ty1laDelnvi (0 rtmir3ou1lpte ncsa( srra(ro;u0ale  i3iltfmDrm(vo;(0alxnircoadfm  lnei;( sruoiopno4am   fvi (faDtmurp;t1olx iociltfmDeauvo u)tlerir oadopt livo;s0 exoimpoo4alt mivt tfs2rrumpnt4apx  oeiaslm2emumpn(0tltnxr ia1lpteluvol( teur(o3ny4omenlnes (f 2tax  ot1oltomietad mDrl(vp (0alxoir totla r nvs;(  exrxm oo4opt  ieia(  Drm(m ;t0opeoifeiatlm uau pnt)trxnmocootfatraieil(0srxo(o3nu1apeemncta(  Duaurpnt1tlt iictasfm ua(vp;()artomr oa1opt  uvs;s tetoiopou4lmtnmnetasf rumxr no0optnmoetyd m rlnmont4artrifciatlm e u il()seuo(o3oy1oltnlfcils) 2tmxmp;u0oetnmiciysfmDrlums u0tltnxo3oodfmt li sls0srtr(r3oy4opte ivslsfaDrmumpno0tltnmfciltfa2rlnvsnu4artnxr oa1fatr i olt0 eurxmpny4al e fcsltf rra(moou4olxoioetytlaDel(msnt0 etnir oa1fmtran ols)setrirpoo4lmenmiviatfaDrmxmo;o1olenifctytfm uln pnt4arxnxo iotlmDe ieil(  2xoxr3no4lm e ivtlsfaDrmuro;t0oet  oeiadlaDuluvsn(0alxrmocootfpD aieo;t)trtmxr nudol e ietas)sDrruro;t0teenmieiat m rm( p t0tleomo oodoaD luvs () exr(r3oy4olee fei ( s2tr(rooo1tlx mietaslaDel( p t)texnxr oydopt aivsls)seurim3oodalenmncsasfa2tau o;t4tltoii3iytfa2ulums (4artomf3io1op   ues;t)teuoxm oo1op  lfei t)s2rm( p;t1tptn fetysfa2ra( ont0aeerxr totlptr uvi s)sexmxm iy1lleelicia(fsDrm(mpoo4tleoifeildla raumo (4aeermfctadfa raieo;t0 exoxo3iu1lmenmfcias sDraxrooo0opeo ociydfa uauvp;t)altnxf3ta1lpDelneo;t)trtmirpio1lm   ivs sfsrta(mpnt1apt  ietldlmDrmnvs;(4aeerxfcty1fpte nes;t texr(mpio4llen nviat srrrxmpnt1aleo o3iasfm umuvs;() rtoio3oatom  auvi;( sexm(r3io4ol  lfet t)srur( p;u4aex ioeiytfm ra(ms;u) rxrir3tydla elivilt0trxr(o3nodoltn ivtas)a2uaxm ou0tptniieils s rlnvo u0 eerif3iodfpDeauvilt)seto(m nodap nmfcsatf Dta(ront1ope  o3iltlsDulu snu4aexrmf3tydomDeaivo ()srumxm3oy4lle  ivia(fa2ur(m ;o4alxn i3iadlsDea(mo t0 ltnmfctatfm   i i (  exrxr3oo4optemnvslt a2um(  ou0tlxoifeiysfs2rlnmo () eeoxr3to1fmD livils)s2toiopoo4ame mietlt)srrm( o;t0teeomf3ilslsDrm( s;(4artrmr oatla eau i;s)trto(opiy4ap emnetas)arurxro;u1tlxnmfetyt s ua( ont4tlenxr tadfm e i i;t0srur(opny1alt livtas  rrmuront1aex iiciadfa2rlnvo;(0texoxocootlmDeaivi;s)s2xr(opio1lpe  ieta( sDrm( p;t4olto o3ildlm um(vs (4aeenmfcoy1lp   n o;s0t2urxm3oy1lpenlnvs (  2tr(r ot4tle  ieild mDrmnvo t)texnifcoatfmD li i;(0teumiopiy4lptnlnes (f 2taumpnt4opx mociat mDuanms;t0 rtriocta1fpDrlnes;(0 2tmir nodapenlfvt (f Draumpno0oetnmoeiatla2rm( s;u) rtrmo3iadfptr n o;s t2xmiopoo1ll   fvsls) rtm(rpnt0tet mociadfa2emuvsnt0 reoir3ty1faDr ivil()tetm(o nydolenmieiasfsrtm(mooo4aexnii3ils m ean p u)teerifcoadlat  iei;s0trxrxr3oy1op nmictatfs2tmump;o4altoio3tasfs ea( on(0alermf ta1lp  au ils seuoxr3oy1omt mnviasf 2rrum ;t4apx ifctas aDranmpn(0aexoxr3iodfp   ivs;t0 exr(r ny1lmee icsa( artmu  oo4tltn oeiad m2emnmont4 rtnxf3iydoa  luvo;s)t2ur(rpnudop emneils  rra(mo;u4aexn feild sDemu pnt0trermo3iodlmteaiei ()trurxrpno4ol nmivia()arta(m ;u0aeeoiiciatls2ulnmsnu0arxrmf ta1fpD  n sl( srtrxmpiudomen fcil( srrrxmo;t4opxo i3tlsls rln s;(4trxrmo iodoa r i ols  rumxr3oy4lm e nvtat) rrmurpoo0tlxo o3tldlaDeaumont4trerxr totfmDraieilt0trur(mpou1olee fvs s arrrumont4opx ii3tldls rmnvp;u4trtoxrcoy1oat anvi ()srum(r iudlp emnvia()s2tmumont0aptnmfciltfs2emumonu) rtoxf tydlpDeaiesl( teurxo io4lpe  ieilt aDtaxmpnt1aeeomietasfmDel(mpn(4tlxoxfciotom ran i;() 2tr(m oy4apte fcil( a2urxrono0opx moetadfaDrmnvsnu0 rxoxf3tydop ranvs;( trtrxm nu1al e neia()srtmxmono4oexn fetlsfa2elumsnu) etoio3tatlmte uvsl( t2uoxr iu1oleelieslt  rurum nt4tltniieildfs2eauvp;u4alerxr3iydop r nes ()srtrio3oy4lpenmiviat)srumuront4apx  feild a2em( p (4 etnxo iytlmtran i s teumxm3oy4ole  nei s  Dumu  ;o0teto o3tlsfa elu p;t4aetnifcta1opD anvi;(0setoxrpno4llenlici ( srra(mpoo1aexomocias aDumu o u4 exomocta1fat ln ols)trxo(o3iydlmt  ncs s artau oou0
\ No newline at end of file
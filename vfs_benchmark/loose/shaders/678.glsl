@@ -0,0 +1 @@
+ivsl(0sexm(o iu1lm  lncsls) 2rr(  ou1ape ii3iasla ea(vs u0alxnmo3tatomD  ies;t0 2umimpoudlp emnvil( sDrru  ou0aleomo3iytfsDulumpnt0altrmf3iydom  an sls0 ruoxmpny1ope mies s  Durxrooo0tet mf3iatla uan s t0 ltoiocootfaD  neolt)s2triopno1al nlieilt)sruaxm no1ape mo3tadlaDulums u) lerxf iydfpt lueil(0s2uo(mpiy1ll  mnvtltfsDtaum nt4teeomietls a2eaumo;()artnir iydfatrlues;t0 rxoxmpnu4aptemfvsls)artm(m ot0olt moeiadlmDumu p;(4trtrmr3ty1lmtelivi t) etrxo ny4lmt mfvilsf Dua(m no1tlto fetadfaDulump t4aexrio ta1oaDrauvs;(0trxoim nudlmee ivs t) 2rmxr ;o1oeenmoctltls ulnms (0aetrmr iatlmtelies ()trtrim iudop   ies sf rrrxmpot4apen o3iytfm eauvonu0alenmf tatomt  iesl( s2xo(rpiu1amee ics tfs2rmumpno0aeto feiyslmDuln p t)aeeomo3oydlmDrlneolt0t2xr(r3oudop e fci s)a2ur(  ;o1aex mfeiat mDumumo (0 lxomocoadomDe ivs;s) rxoxopiy4omtnlfcsl( a2rm(rpnt0tltnmoetatla uauvo (4aleoif oytla   ivo;(0sexmio3iu4llen feta( a2trx  ot0alt  octydlm2uanmp;u0aeenxociy1optelneo s0texo(mpny1lm e fvi s  Duaxm oo0ole  iciysfmDel( snu)tlxnmocootop  aivi;(0tetoxm3ny1lmte fei (faDrru p;u1aleniietydla2el( p;u)alxrmf3oadfaD  uvi;()seto(m3nydlpenmnct () 2ur(m no1alx io3iytfsDranmp u) lxrif iy1fa e u s;s0trxrxm iu4op e fesa( aDururp;u1tpen ietyslsDrln s u)alenxf3ta1fmtrluvs t  2toxm nudlp   ivt s  2ur(  ou1aexnif3tlsfm2ean snu0tlxoxfctadoatr iei (  2uo(m ou1omtnmncs s) 2rrumo;u1tlenmf3ias mDumums t) lerif3oa1oaDeln ils  euo(rpoy4om nlfvsas)srtm(rp;u0tleo i3tls sDel( snt0alxnxf3oytfmDr nei (  exr(m3iy1ll nmieilt) Dur(m ;u1alenmociysls2uauvo;u0 renxo ta1lmtranvi s0 exr(opoo4aleelivt (fsrum( poo1aleo fciadls2uauvs;u4trtrio3ta1la eli i;t)trumio3iu1lmt  fvi ( s2um(  nt0tle  ieild s2rau p;t) etnirciytom eaueo;t0srto(mpiu4apt mfeia()s2rmxmooo0teeomfeiat s2ua( s;u4tlxomf iytfpteanei;t) ruoxm3nodlleelicils)artm(mp;u1tlto feiadfaDul(mo (0 eeomf3oodlateanesl(  2uoxrpoy1lp nmnetatf 2uax pot1tpxnmo3tyd a rm(mo;u4alermr3ootopte uvslt0 2toxmpiu1ll e nei t)a2tax  ;o4tee miciasfs2emu p u)tltnif3oadoatr iei;t  2umxm iy4apt livslt a2ua( o;o4tpe  f3tadfm ea( pnt0tetoif tadfm e ieo t srxm(rpnu4optn ict sfaruax  ot4olx  fcilslmDrmumsn(0 lxrmr3iotfaDe nvs;( setm(m io1apte fci t  rrmxrpno0teenifetat sDuanmsnu0arxomociy1fpDraieols) 2urim3oy4om   fvil( aDra(r no4tetn ociydfmDuluvonu)treoio3oatla   nvo s) ruoxr3ny4omeemivi s a2raumoou4tleniiciyt aDemnvo;()texnxf3iotfaDelnvils0 rxoxr3iodamt mfei t aDrrx ont1alt moeiydfmDem( onu4tleoif iotlmtr n s s)srxmxo3no1ap elfet tfa2taxmp;u0tee iiciyd s2raumpn(0aexrxfctytoa ean o ()teur(mpiy1optnmfcsa(faDtaurooo1tpx moetyt s ean s t4 rxnir io1lp   ieo s) 2xmxr io1al elivils) Drrxm ;t0olx  fctydfsDelnmonu4altnmr3tadfaD  ueo () rur(r iy4lm e feils  2tm(rp;u4olto o3iytfs2emnvonu4tlenifcoydoatelu i;t0 2tr(r3oudlm e net s s2uaumo;u1olxn oetydlmDum(vs u)artrio3ia1la   n s;(0s2urirpoo1op n ivtl(fsruaxronu4opt  f3ilslm ua( s (0arenxf3iatopD  nesl() 2xo(m oy4lmt lnvsasfsrumxmpot4apx if3tls a rlnvsnu4 lerir3io1fa rlueil( s2um(m3iudaltnlicsatfarum(r ot0opxoioctldfsDelums t0 lxrioctotlpt  n i ( truo(opiydap nmivils)sDtm( p;u4tltomo3iysls2rluvont)arxnxr oy1fmt aivol(0 eto(opny1apen ivias)arumumpno4opxn oetasfmDulu pn(0 ltoxfciodlmte iei;s)s2to(m3oydope mnes tf rtrxm ;o4tlx ii3tydfa emuvpnu4alerxr3todlmD auvs t) exmir oodlp e fvt () ruaxmpot4opxomfeiysfa em(vo;u0 rtniocoytopDraneo t)s2um(opou4lp  livtltfsDtaurpoo4aet ifeiyd sDum(msnt0teermf3iy1omDr uvilt sexrio oodomtn ncilsfaruru p;t1ale  i3tys a rln p ()tlermocto1la  luvsls t2xoxmpnodope  ictat a2raumpou4tltniiciaslaDra(vo t4tetnmfcootfmDeauesls0s2to(rpiy1lp   ics () rrrur ;t1apx mociysfs2emumpn() rxoxo3iydlpD  u ils trtr(rpnodomenlnctlt  rurxm ;t1alenmoetlsfm eaums;u)aeenio oydlaDe uvsl(0trtrxo ny1optemfcils)aDtm(mpot0tlxoiiciadfs2rlnmp t0aetnir3iotfmteaies;t0trtr(o3oy4lm   fctlt aDumumo;t0optomf3ildls2ea(mo (0alxnxr3iydlaDrlu slt sexm(o io4op nmiciatfsrur(ront1tex if3iytfa ea( s (4 exrxo iy1lpteanvo;s)texoio3oo1lltnmnetat  ruauro;t0teenii3tydlaDumnmo u)trerxf3io1lat  ueilt t2umxo3io4llt lfviat arur(mpnu4opto fcildla emn s;u) reomf3oytlaDelnes s seum(r nodlleelnvs ( s2rm(rono0aptnmoeiytfsDrlu s u) rxomo iodop rln o t0 2uoxr no1oltn fesl()s2urx pnu0optn ictatfmDelnvp;u4tlerxf oatfmt  i i;s0 2umxr no1opt mneiat  rtmu  no0olt  i3iltfa rm(vont0 etrmocta1oa  an il(0s2xoir3no4olt  neta()aDurxr ;o1teto f3tld a umn p t4aeeomf3iytfm rauvols srto(m oy1omenmivs tfa2ua(moou4tee iiciltfs rmuvo;(0 eerio3tydlmt lnvo;s0s2urim oodamte nciasfaDtm(m ;t0alxoifeilsfa umu pn(4alxnir3iadomD  neo;(0trtrxr3oudole lnvtatfarrm(rp;t1aex if3tls sDrluvonu)texrif tatoatraueo;(  etrimpnodapee ieta( s2tm(moot4ale mf3iyslmDra(vp (4aeenmr iadfmtrln i s0s2to(m3iu4omenlietls)sDtaur ;u4oexo ociad sDrauvs u0arxnxf3ia1fp  ai i;()sexrim3oydlptnmicsl()a2trxm ;u0alxnmi3ilt sDemuvsn()tetnxo io1lpte uvsl(0 eurim oydol n fetas)artaur nt0oltomo3iydfaDrlu p t4aetrxoctotfm   i sls0teurim iy1optnmncta(fartau  ;t0tptomfeild s2ranms;u4 eenir3tatom  ai s t)t2xrxr iodlleemict (fs2rax onu4opto i3tatfa em(vs;()altrmr3iodlm e nes s) rxmim io4opeelfeiasfsDtm(m ;o1aex ifetyslm2emnvsn(4alenxr oa1fm elivols)s2xmxopoo4apt  nes (f 2ur(root0teeomfciasfa elu o;()texrxr3ta1fm ran s;t0trumim ou4lmenmicsas) Drauro;t4alx mf3iatfm umu o;t0alxrxr oatfm rli i;s)tetmir3nodope mfvia(f Dtaxrono4tpt mo3iysfmDel(vsnu0teenxr3oytfmD  ivo;(0trto(m3nu4lpen ici ()s2tau ono1alxo o3iadlaDuan o u0 eerio3ta1fpD ln o;t t2toxm iydolen ivia(fsrrmx  oo0oeto oetyt a emumsn(4tlxnir3to1fmDrai o (0 rxoiopoydal  livs tf rtrx o;o1alxo fctatfa2el( pnt)aeenxo ootfaD aivo;s)s2xmio3nudap nlfvs tf rtrxrpoo4tpenif3tlslmDra( s;u) ltomfcoytlmDe ieo;s0srtr(o iu4lp emnetat a2trur oo0oeeo ictytla2el( s;u4tlxoxr iadlp  aieo s)sexrim3oo4lltn nvil(  rrrxr ;t4aee  o3tysfm ra(vo u0 rtrxo3oytoatrli o (0t2xrim3oo4omtnmicsl( a2urur ou4alt ii3tydlsDrlumsn() eermfcta1lm rlieils s2tmxo ou1open fvtat)arrrxmo;o0aex  feiatlmDeanvo u0tlenxocootlmt  n il()seurxm no1ale lfvta(fsDrru ont1ale if3ildfm eln p;t4arenmoctytfmteaiesls) 2xrxrpnu1lltemfcsl( a2ur( oot0openmfeiytfaDrm(vs t)tlxrmr oy1omteai sl( teurxr3iy4ll e nctltfarrru pnt0texnii3iytls2ranmo t0trtoirctotlpDelnei ( s2urim3oo4opt livils)aDrmurono1opeoifeiyslm2em( o;t0aetrxrcto1fp r u o;t) 2xoxmpno1lpte ieia(fa2uaxrpoo0teto oetasfs2um(vsn()alenxr3oy1lmDe uvols sexmir3iudap nlfvi s) rtm(mont4aee iiciasls2eluvont) rtnif3iotomDraues s  rxoxm3no1lm  lfet t  Drrxmpoo4aee mfeiysfs rlnmon(0aleoxr ty1opDe u ols t2urxo oo4olt lfvs tfsDuau  no1aeeo i3ilt m umu s;(4trenmfctadfatraueo s)t2xr(o iy1opeelncs t) Duaxrpou4tpt  i3iltfmDumu s;t4alerxo tadoa  livo;t seumir iu4lp nlneils sruru poo0aeenmo3iyd m2rmn o t0artrxfctotomD lnes (0 2toiopny1lp elies (faDtmu  oo0olen ietydfs rlumont)tlxnxocta1fp ranei;(0 etoim3nodalte fes s arumur ;o4openifctasfs um( o t) ltoio oy1omDeaivi;t  rtoxrpnodlmteliei t srurur ;o0optnmo3tatfa uanvp t4 exnmr3iotlm elieil( tetr(rpny4am elfcs (  rua(moou4oexoio3iyd a emums;u4 eerirctadfpt  u sl() euo(rpnudapeemics () rururoot0tltomoeiatla2rmn o () exniocio1fp  auvo;s0trumxrpoudlmtemiesltf rur(mp;u4olxnmieiytlm2uanvpn()areoxo oy1omtrlnei t)s2tmxm oo4alt  ivia(f Duru o;u4tpeo o3iytlm rl(ms u4 eenxf tytoa raivs t  exoir oodape lncia() 2umum ou1tlxoii3tltfa rau ont)aexrxfctotlaD ln s;(0t2tm(m io1lme mfesat srrr(m nu1tpx mfeiytlm2eln pnt)trxnxr3to1faDeanvs;(0t2ur(m3ny4olt mnct s)arurxrpno4tlen ieiyt m umu pn()tetnxr tatopD auvs;s0trxr(rpiu1omtemictls  Drr(  nt1tpe mociaslaDulumo t)aexrxocoydomtr ueo t t2tm(rpnu4llenmnci t s2tau  nu1tpe mieiys s2ra( p t4teenmr3iotoaD livo;s)t2xrir3oo1lp n fct (f rurxmonu1apto ieiydlaDrlnvpnu4altnxocoydoaD lneslt setoiopoo1llt mnvt s  ruaxro;o1apt iietatfs2rl(vo ()arxnxo ia1oaDean ol(0trxm(m nydlp n fetlt)srrmxrp;u4aetoifetydla um( pnu)tlenxo to1omt  i s s0s2xrirpoodol  livtlsf 2uaxr ;t1tlx  oeilt a elu p ()alxoxocoadfat  nvo (0sexoxmpiu4alenlfctl(fs2umx onu0opto octltlsDem(mpnt4tlxrxr3iy1lm rlu o;t)trxr(opny1lpenmivs tfsrtaurp;u0aetomoctasfm eluvs;u0altnifcoodfm r n ilt0t2um(rpou4llt mieia()sruaumoou4altnio3ild s ean p;t0trxoxrciytlaDe n o;s  rxrim iy4lpe  ieilsf 2urxrooo1aet mi3iysfm elu pn(0teerir iydfa rlnvol(  rum(rpno4aptnmfvta(  2urxmooo0aexoioeiysfm rlnvo (4tltrxo oa1fm r n olt)t2toxmpoy1op emieilt)srtrxrp;o4alx mf3tad m emnvo;t4 rtomf3oydfa r uesl( srum(r nu4optn nvt ()s2umur ot1tpt ii3iytls2ulumo (0alxoircoydfaD anes ( s2xrxm3oy4ol nmict tfsrrmxmonu1olxn oetyt a2uanmo u0aleoir3iytfptrlu i t0t2xrir ny4olenlfesatfsDraurp;u1aeeomfeildfa2el(mon() rxrxfciydoaDe u sl(0 2umir3nu1ope mfvilt)srrrx oot1altnii3ilt mDel( pnu4aeeoio totoa e ues;(0setm(rpiodolte ict (f 2tmumpou1tptoioetld m2uln s () renxf3todlptr i o;s srxr(o3iy4lm elivtlsf 2taxro;t1oltomfctyt s2umnmo;()trxnxr iadfpDe ueil(0t2xrir oy1olenmfet tfa2trur ;t4olxniiciydfs ul(vp;(0 rxrir3iodfaDran sl(0s2ur(rpiu1lm   icslt srraxrpnu4tltniiciatfm2eauvsn(0arxnxr3iodomDe ues;(0t2xrio3iydom  mnvtltfa2urxmono1aetn ieias m rln s t)aexnxo3iotfpDeli ils t2toim io1ol nmfvslsf 2uau pou1aleomi3iydfaDuanms;u) eermf3oytlaDelu o;()trumxo no4amtnlieia()a2ra( pno1oet mfetlsla eln sn(4arxrif3oodopDe n o;t)s2xmio3ny4alen nctas) 2rmx oot1tlx ifctad m2umuvpnt0tleomrcty1opt ai ilt  2trxopoy4al  mfcslt)s2ra(mpnt1tpenmoetldfa uau o t0 lxnxocoadom r ueslt0setoim iy1altnlfcsl( aDur(ro;u4aleomietadfsDran snt4 rerxr3iotfmt ai il( texm(m iudoptelnct s srraxm ;u1oeeoif3iltfs2ra(vsn(4tetnir iotopt livi t s2xoir nudopee ieil()s2tm(m ;o1opt iieiyt s uln o (0tltnif3oytoate i sls tetmxm nu4ol emfcsa()s2rmu  ;o4oeenmoetadfa rl( sn(0alenioctadlp   nesls trumxo3iudamte iesls aDtaum oo1optoio3ilt mDra(vo (0trxnmo3oytoaDean ol( s2xr(m3nydomte nvsa( s2tau onu4oleoiicilsfa2umumsnt) rtoir ty1fp   nes;( s2xrir3no4opt mnciatfaDrmuronu4oee  f3tlsfm umuvp u0 lxoircta1oa eaneo ()sexo(r io4om elncs t  rtmxm nu0olt ifciasfs2rmuvs t0artrircio1fmDraueo;t)trxmir iu4lpeemfctat)srur(rooo4teeomieiytla2emnvp;()tltnxr tatfmDelnvslt) etmxo3oy1opt  ivs s aDtmxr ;t0aetoif3iadlaDul(mp u)artoir iy1lmDeaieilt)s2trxopou1aptnmfvi t  2uax ooo0alxo feiadls ul(vont0aeerxfcia1fa   ueslt0trum(m nu4omte nesl()arrrurpoo4ape  ieild a2ulu s u4 rtomo3oydom eliei;t0tetoxopny1lp  mnvtlsfsrtm(ro;o4tltn f3tatlsDul( snu0 etomo iatfmD  i ol(0seto(m no1olenmivtl()s2uaxm ou4texoii3tat a2uln o u0alermr3ia1la  lu s;t0sexrxr oo4lptnlivt () 2urx  ;u4texn ictldlmDeluvp;t4 leomf iytfatrlues;s)sexr(r3nu4op   nvtlt  rrm(ro;u1alen i3tld mDran o;()arxnxfciatfa  aieilt) rxoxo3iudal n ics sfs2uauroou4oetnio3iasfmDulumonu4tlxrxo3tatlp   u i;()s2xrimpny1lpe mics ( sDtau pno4tptomf3ilsfa2ra( p;t)trenmr iydlmDraues;(0texo(opny1lptnmfeiasf Dua( ono0tlx ifetatfm uanvs;u0 rtrmf3iadom elivo;t0seumiopnu4al elnes sf 2trurpou4aleoio3tls s2rmuvpn()aexomr iytoate u slt)t2trimpiodlmtemfctlt)srumx o;o0apx  i3iytla2emn pnu4aetoxo3ty1op r ueo ()tetrimpoodole lnviat)sDrmurpnt4apt io3tldfs2rlu s u0arxnxocoadop elieo t  2trir3oy1lmt licilt s2urxr no0tltoiieiltfa ranvsnu0 ltomocio1lm raies;( s2xm(r3nodol n feta( a2rru  no4alxo o3iatfsDrau p;t)artomr3iotoa r uvsls0trumxm3no1ole lfvi s) 2raumoou0ole  i3iad m rauvp t4alxrmf iotfpD ln o (0trtoxrpio4am elieiat aDrr(rpnu4opx iociys a emnvs;u)trtoifcoodfp rli olt  2toxr3nodol e fei sfsrumu pou4tlxnioctytfa umu s (0trxoif ia1oaDr uvi t srxmim nodlmtemfei ( aDta( p;o4tet mieiytfa umumsn(4alxoif oy1fpDraivi (0s2uoiopoo1ale mnvi tfa2ur(r ;t0tlt mociadfsDuan pn(0tltrmrciydfpt au i t) 2xm(mpio1ll  lnei (  Draxm ou0oexn o3iadfm ea( s u4 leoxfciotlptrau o t) 2um(mpio4ol emfctlt)arraxroou1tleoii3ilt aDul(mpnu0trtoxr oatoa eln il( t2trxrpiudom elncsat a2uaxm ;t0aex mictasfs emn pnu) leomocoo1fa e ivsl() exmimpou1open netl(f rrm(  ;t1alx  f3tytfa elnvsn()trxnmociotlatrlu ils0 2xm(r3no1al   netasf 2tmu pou0tex  icild sDulumsn()alerxocootfp   ivils texm(opiy4al  lieia(  2rm(  ot0olx io3iys a2umnmon()trtoifcoatoatr uesls)trtm(o3iydllenlivsat)s2uaxm ;t4aexn oetys sDua(vpn(4tleoxf3oytlmtraivi;s)srtm(opno4optelncias)sDrr(  ;o4apt  i3iydfm2ua( s ()trxrxociotfatr n i t t2umxm3iu4ame mnci tfsruau p;o0opeomo3iasfa raums;t0 rtoxr ia1oateli o;t)srto(o ny4amt miei () rta(rpno4apto f3iatfa2umn o t4tleoio iatoate n o (0trxm(opno4ame micils) rtr(  nu0apt  ociys aDeau snt0altrmo3ty1om rli s () rtoimpoo1lleelfei ()aDumur nu4oex  fcilsfaDea(msnt)tleoifciadlm r ieilt)seurir oo1am   fci t) 2um( ont0texn fciasfm elnvsn(0 eenmr tatlp eaivol(  exm(o oy4amt mfcias srurur ;u4opto oeiatfm um( p;(4arenxo3iadfp rli s s) rxoiopou1am n fcilsfsrrrxmpnt4oex if3ild m2umuvsn(0 rxoxf tytfat aieo;s0s2xm(o no4ope mnesa() 2trumonu0aptnmicild aDul(vp t0tlxoir3tadfatran ols0 2tmir3iy4al e netl(f 2urumpnt0aptomieilsfmDemumonu4alxnmfcootoa eaueo;t0tetrxmpiu1oltnlictlsfa2umxm ou0tlx iocilt a2eln o;t4 exniocoodlp e i s;s  rur(m nu1apte nes tfaruau p;u1oeen i3iad a2rl(mpn(4 rxnmr3iytfm r nvo t) rto(opno4olte ieiasfs2tmu  ;u4apeo i3iltfs ran snu4tetnmf ty1fmt aneol(0t2ur(r3io4ap   fvsas srua(  nt1teen o3ild s um(vp;u)aleoifciatlpDrlnes t truoxm3iu4ole livs tfa2tauro;u4oltomieias sDrl( ont)artomfcoy1fm  lu sls0trtrxm nu1llenlicsls) 2taumpnt4ale  i3iys sDulnvsnu)alxoxocoydlatraiei (  rtoxo3nu1lle mfctat  rtrurpnu1aptnmi3tldlm emn o;t0tetomr oo1lptr nvo;s0t2tr(m3iu4lptn ieia(  2trumpot4oetnmo3iyd sDem(vo u4arxoxocoatlatelueolt0s2toxo3iu4lm   neils s2tr(rpno0oeenioctydfa2rmuvp u4trtoif oydlp eau o (0trurimpny1llte neilsfsrtaxroou0tee ioeiat s2umuvs t)areomf3tytomt  u o;t) etmxr io4ll nmiesat)aDrr( ono0alt mf3iadfmDulnmo;()alermo iydfat  uvi;s)t2toxr3nodomtn nctlt) Dur(mpnt1tex  feiys sDemumpnt4alxoif iytlm  lu o;t)srxm(opoo4al  mfesa(  rta( p;u4oexomociytfa eanvs (4 rtrmrcoa1omt aieolt0 euoim3oudll nlfcilt)sDtauro;o1olxo ieild a umnmsnu0 etomfciatoat anvi s0 2tm(r oy4llenmfeiat)s2taurp;t4oexnmociaslmDuanmpnu) lermfciatfpDr nvs s  rto(rpou1apt mncsls)s2trur ou1tpxoio3tytfaDul(vp;t4tlxrxo oa1laD lnvilt0setm(m iu1ol   ncsat)a2rm(m oo1tltn f3iat sDeau p;(4tlerxr3oatlaDe ivs;t  2xrxr ou1altelfvt t)arur(r nt4oetoifetat s ulnmp u0 rtrmo3iatopD  ivol()trurxo ny4lp  mfcta(fs2rmumonu4olxo feiadlm2ulu o;u4tlenxrcto1lp  lu s;(0 rtrxo3iudam nmnvil()sDuau  nt1alen ociydfsDulnmp (4trtoio oa1oa e uvols0truoir3iu4lm  mfetat)arta(mono1tpeomiciadfm emnmsn()tltnxfcoodlptrlneils)srurio3no4al n fcilt sDrax  nt1oexnmfcils s ea(mo (4tlerirctadlptrlues;s)t2tm(m3iy1open netasfsrrr(mo;o1aee  oeiyt mDra( p;t0trenmr3oa1fat  ivs;(0 exrxrpiydlpee fes tf Dum( pno1apxnmociysls umnmo;(0trtnxo ootopDeauvs t0trxoir3oudomt lnvilt)aruaum ;t1opxnmf3iadfs2umumsnu4artnxociodlm ean olt) etr(o ny4amt  fvta( sDtrum ot4teenmfetydfm2uanvs (0teeomf3iy1omtr nvo s0t2toim3oo1lpe lfei () rum(m ou4oeen f3ilsfm2rlnvo;(4arxrio3tydoaDelnvols) rumir iy1omt mneilt  2ur(mpnt1ope  fetysfs2elnmsnt) lenio tadlmtr u i t seuo(o3ou1oltnlfviasfaruaxmo;t0tex iictltlmDeanmpn(4 lxoxo iy1fateaivol(0sexmxo3ou1llt mict tfaDtr(m ;t0oetn feils s rlu s t0 ltrxf tadomD ai s s)srtrio oo1lm nmnesatfarrmuronu0tee mi3tlslsDuan s (0 etnxr3tytfaDeaieo;t0sexm(rpoudoptelivilsfa2tax pot0oeeo f3ilsfm umnmp;t) lxnmr3ia1fm eaivs;(0s2tr(mpoo1lm elneil()s2trxmo;t4opxnmi3iytlm rauvp t)altnmf3iatfmte ivolt)t2toimpno4op   netas srumxmoou1tleoiiciydlsDuaumo t)tltrio iodlaD an olt s2umxm io1lpenlivi ( arta(ro;o0oexniieils mDul(mo;u4tlxoxrcoydfaDrlnei;s) exm(m ou1ll e fesas s2ur(mono0tleomoeiadlaDrmuvo u4 eeoif3tydfmtr ueols  2tmir iydop emivt sfartrx  ou1tle mo3iytfm2ulu p (4 ltomr3oodoaD aues (0srxr(o iy4apeelfctl()a2um(r ;o4tex  ociltfa2ulnvp u4 eenxocoa1fptrli o (  2um(m3oydolenlivtlt)a2rm(  nt0oexomo3iad sDuanmp;t0alxomrctadfaDeaivo;() euoirpoy4lmt mfcslt) Dum(rp;o0opt  oeiytlaDra(vp t0 renmf3iy1la r ivsl(  2uoxm3no1lmeelncs t a2uaxronu0aptoioeiasfm uauvs t0aeenir iytfp  aneo s0 rxrxm nu4apte fcta( a2rmxro;t1apxoif3ildfaDraumo (0 rtoirctydlptrli o;t0texmxr oo4ll elnesat a2um(mp;o4tpe iociasfs ran ont4texoxo3oy1lm rliei t0 rurxo3ny4amtemiet t aDtmx  ;u0tpx if3iadfs2ea(vs;t)aexrio3tatlm eauvilt  2tmim3oy4op   icsa(fs2um(mont1tleoiociasfm um(mon() etrircio1fmDr nvi (0 2xmir3ny1am  mivi s  rra( oot0aeeoiociysla2rm(ms;()texrxo tatfpte ivolt0 rxm(m3iodaltelnvsa( arrrum ;u4tlxomoctadfmDrmumo;t4texnmfctytomtr iei t setrxm iydamtn ictlt  2rm( poo4tlt ioeiyd s2ulums u0altomo3iatoatr n o;t)teurxo oo4openlivt s) Drmxr oo0tlx  fctls m2el(msnu0alxnirciytfp r i ils0t2toim3oy4apte fvils) 2ta( ooo1olto o3iytfm2uaump t4tlenmr oo1fpteluvo;(0texoxr ou1ameelnvsls a2trxrpou0teeomoetatlm ulums;(0aeeoxocoo1opDeau ils t2umim3ny1aptemfvt ( sDurx  ou4tlxn oetas mDea( pnt0arxoxo3oy1oatrauvi;s0 eumxr ou4optnmncia( a2rr( oou0tltoio3ias m uau o;() ltnmr3oadlaDraivols0s2xm(r3no1lmenmfvs ()sDrm(rp;u1aex mictltlaDemn s;(4texnxo tytfm e uvs s) 2tmim no4om  lics t srrr(m ;o0ope ifciytla rlnmo;t4 rxnxo3ootlmDelueo;t tetmxopoudlmee fesls)srtm( pou4texn ieiaslm rau s u)tltomfcoo1fm   uvo;t0sexo(r io1lm   ncil()a2tmum ot1tlto i3iadfm el(vo;u0aetniocto1fa elnvolt)srurio3ny4ap  lneslt)a2rrxm ot4tex  fcildfaDeaump (4tlerif3oydfpDeaneo s)trumiopoo4altemfcsl(  2rrur no0teeoii3tltfaDeanvs;t) rxrifciotlp ean s s srurxopio4openlnciat arumxmp;o0tptoiietatla rmnvp u4texoxfcoatlpt luvo;s)texrir no4om elici t)a2truro;o0texnioctytfaDelumon(0 rxoif3iytfm  aneil()t2xoim3iy4aleemieiltf Duaump;o0aexoiiciat a ea( p;t0texnio iatlpD  nei;t0t2xmim3oodaltemictasf 2urxrpou1tpxoio3iad a uau s;u0texnif3oo1opD ln i ( srum(r no4op  mnvilt arrmur ;o1aet  ictldls2umnmp;t0tlxoir iadopte uvs;s0t2urxr nudllenmnei sfsDrmxroot0alxnio3iydfa2ul(vs;t0 lxrmfcoatlmt livi s0s2xmxopny1omt  nesa() Drr(m ;o1tpxomi3ild aDul( o u0tetnmrcoydlatranei ( seurim no1al e ies (  2um(m ;o0oetoiieiytfm2rm(vo;u0 etrir iy1oaD li o s0trxmim nu1lmtn nvt t)aDur( pnu0tpen ictat mDra(msn(0trxrifctydopD livsl()sexrim iu4lptemnvslt s2taxro;o4teenmoeiytfs rauvs (4aexoxo3oadlat liei s0 2tm(o nu1lme mnci ()aDtaxrono1tee if3tatlm ea(vs (0trtnmr3ia1om eanvs;s t2xrirpoy1amenmneta(fs2taxro;u4aeto o3tytls umu o;t0aetrirciy1late u o;s0s2xmxr oudaltnlnvtl(  Drax ono1oetnmfctltfsDem( o (0tleoir3io1omD  n s;(  rxmim3oudaptelnvsltfaDrax ont0tptoiieiasfm2rmnvp;u4 rxrmf3oy1oaDeaies;s)s2tmxo iu4ll e ncslsf Drrxmpou4tlto iciytfs ulu on()arermr3tadoa rai i;( trtmxo oydlmenliesat)sDra(mo;u4apxn fciltfm2rl( s t0 exnir3todomDran olt)srto(r iu4lm n nvia(fs2umum ou4ole ifeiyt aDul(vsnt4alenmfcto1lm  luvs;s s2um(rpoodolt mnvil( srum( ont1aleoio3tld sDean snt4 exomr tytop e ueils0 etrim oy1al elncsa( aDrrxmpnt1tetoio3tysla rl( pnu)arermocoytopD lueo;s0 exoxr3nu4alenlnesls a2um(r nt4oltomo3iyd aDraums t0 leoxoctydlm  lies;( teurio iy1alen ivt t arumx onu0tleomictlt a ua( o t)trenmf3oa1oaDr ueils) eur(r oudlm  lfeils s2rmxront4tee iociysla2ra(mo;(0artrio3ty1la   nvi t0 exmir3ou4ol elncsls)srrrx pot4tpxomietyd mDuauvont) lenmf ia1oat luvilt0 rtm(r3oo4opeelnesls aDrrx pot4olxo octydfs2rl(monu0tlxrmr3oytlmtr nvs t tetoxopoy4lp   fvias sruax p;u4teenii3iad s rmuvs;() eenxr iytoaDrauvs ( texmxo3iy4ap elies (  Duru poo1olxnmfciysfm2uanmo;u) exoxfcoadfm raueo ( srxoirpio1op n fei tfsDrrxr ;u1apen f3ilt a elnms;t4 ltnxrcoytomDeauvs;t0s2um(m3ou4ol  lfcsl()sDtr(mpoo4oet mictydla elnmpnt)areoxf3ootfmt lu s;(  rxm(rpio1lmtn iesl(f rrmx  nu0aptn f3iyd mDul( s;(4 renmfcoatopDr nei ( t2umxopnydale lfvi t arua( p;o1olt ifetatlm ea( o (4areomf tydfpDelu i;s)t2xrxr ou1ol emivtasf rua(m ;u0opxoiietadlaDuln s t) rtnmo3io1omDraies s0 2urir nu4ape lfcsl( srtr(  ou0oexn f3iasfa2umnmsnu0altnxocoa1optr neo;t)seumimpny4apeelfcsat a2rmxmont0tltnifeias mDulnms ()trxoir3ootlateai i (0s2um(rpiydom e fvtls s2urxroou4texnifctaslsDrlumont4trenir3oodfateaivsls0s2uo(o nu4opeelici (fartaxroot1oeeoio3iys mDrln p t4texrio iatfa eauvo t)srxrxrpoydaptnlfci (fsrurxm no0texnifciytfm eluvp;u0aleoxr oa1lmD auvi t)t2ur(mpiydoltelfvta(faruru  nt1aleo oeiytla2rau o t4trtomr3iytop r n ol() 2xoim oydol   ncias  Duau  ou1tptnmieiasfa2rl(mo;u)trxrxf iotopt lnvsl(  rtoxo ou1opeemfes ( a2ra( p;u4tpt if3ias sDumn o;t4tlxoxf tytla  ln ols  euo(r3iu4alenlfvs t) rumur nt0teenmfctytls ulumsnu)texrmr3iydla elneo s0s2toirpiudal nmict () 2rmur ;o4oexnif3ildlm ulnvp;u0aetoio3totoa  anvo;s0 2urim no4olt lics s  Dtmxmoou4tltn iciadlm el(msnu) ltnif3tydoa   neslt setrxo3oo1olt  ivi () Dua(mo;o1apxnmo3tys mDeauvsnu0 ltnmr3oadlmt aivo;s0trum(mpny4olt mncia(fa2taxm oo0oexn ieiytfs2ua(mpnt0 reoif3iotlm eanvi t  euoir nydllte nvt tf rumum ;t4apxoif3iad aDul(mo;()aeerxf oo1fmte i s t)t2xoxrpio1ll nlietl()s2rmur ;t4aeenmo3iysla2rln o;()altnio3oodfaDrlivi () 2xo(o3ou1amt lfvs (fsrrmxmoou4tpt  oeiatfaDumumpnt4 ltomrcty1faDe ies;(  2xrim iy4lpt lfeilt sDrm(mono0ope mociyslmDel(msnu)altomf oytlat  ivi;s t2uoxopoodal nlfet s s2umxm ou0teeomociltls eauvp;(0tetrxrctytlmDe nvo;s)tetr(mpoodlpt lfcsa() Dtaurpoo4tlxo ieiys aDul( on(0artrxo3iytlatrlnvs;s0seto(m iy1op nmies (fsDua(ronu0alx  o3tasfm uluvpnu4 rtnxf3tatlmD anvsl(0 rtoxr iudoltelfctltf 2rrxro;o1ole mo3iyslmDrlu pn()aeermrctotfatraneo;t)tetoxr3oo1om e nvsl(faDraurpou4aee mi3iadfs rmnmp;u4teermrcoo1fmteluei t)s2tmim3oy1ale livi sfaDtrxmo;o4aetomociatfm2uanvo;t0teeoif ootfaDeli ils)seumxo oy4op emnesasfsrrmurpno0teeniicilt m2ulnvs t4aeeoxr3oatfmtelieils0seurxo3ou1lmtnmfci (fs2rrurp;t4ape ioctatfaDua(mont4tleoxf3tytomt  ivils0 exmxmpio4opte nctls)sDuaxrpnt0olx ifetyslm eanmp u)arxnmf to1fa r n s ( t2to(o io4ole  netas  2taur nu4tltoiieiadfa2ulumo (0alxoio3oy1lp r nvo;() 2xm(mpnu1oltn ivtls aDtr(m ;t4tlt  feiydlmDel( snt0 rerirctatfmt lieo s)srxrxrpiy4olte nvt tf Draxmo;t4tptomo3iad s2ulnvp;t0 ltnxrcoo1lateanvil() rtr(m3ou4omt  fvslt s2uru pou1opt miciyslm uau o;u0tlerxr iy1fmt ai s;(0 rxm(rpoo1am elnesl() Dtrumo;o0opt miciad m ua(vs;(4trxrxr todomDe neo;t0 ruoim3iu1lleemnei ( artmxm ;u1apxo ictls sDrmn s;t4 rtomrctytoatrai ils s2urxrpio4apeemict (fa2rr(  no4tpxo iciydls rlnmp () rtrio oy1faDrauvslt  exo(rpiydomen iesl()arrrumooo0tpe iieiytfa ranmo;u) rtomrcoo1opDrluesl( t2ur(o ou1ame  ivilt) Dtmxm ;t0tet  ictas sDum( p;t)artrxr oatlatr n i ( s2xr(m3nodap  lncil() rtru  ;t4olxnmf3iys mDranvp (4trtnir3todla   i ils setrir3nu4olen netlsfa2ta( p;o0aptoiiciysfs2ul(vp t4 lermf oodfmD  ivi;t0texr(r iudlp e fei (  2tr(m nu4apx  oetlsla2raumsn(4tlermf tatlmDr uvi;(0 2trir io1op  livilt) Duauroou1tpxo fetatla2el(mo t0teerxr iodfptrln i ()sexmir ou4llee ivt t)s2tmu o;t0apxomoctas s ua(ms t) rxomrciadoaDeauvols0 2urim iy4lptn nvils)s2rru oou1alt moeiasfaDuauvp;u)trxomfcoatomtr ueo;t s2um(m iu4alt mictls) Dtaumoou4alx ifeiys m umump (0 lxoir3tadfmDeluvo;s trxrxm3iy1lm nlncsltfs2ur(m oo4tetniiciys aDrl(vsnt4 rtnxocoydfaDelieol(0srtoio3nodlp e ict ()s2raum ;t0tetoifciatfsDumuvo;(0aeeoxrcoodopDe u s;()s2urir3nydll emiei sfa2umx pot0apt  i3tadfm2rmu on(4tlenxr oadlmteli i;t)teumxrpnudlltnliesasfs2um(mpnu1ale mfetaslaDuau p;t4 eenmf to1omDeaueo;s srur(m3ou4ap  livs t a2uau o;u1opxoii3tat a2elumont)aetnxocoydlp e u s;( trxrxrpoydlme lneil(f 2ur(r no0olenmo3tldfs elu p;(0aleriocio1opt  uvols  exo(m3iy1lleelfvilsf 2trxmooo0tex mfeiatla2um(vpnt)trtrxf3iytopt au o ( sruoxm3oudome lnctl()sDum(rp;o1apxoioeild s2ul(vsnt4teermo ta1fpDrlnvi;() exoir ou1olt mnesat)a2ua(  ot4openif3iltfm eln o t0 lxrxo oytlp e i i;(  2xmxo3ny4om  mfcia(farurxr ;t4tlx  icilsfsDelu p t4alxrxf3oytopDrlivol()truoirpnydlmtnlictasfsDtmumpno4tlenmoctldlmDemu pnt4teenxr ta1optrlnvo;t0teur(opoodllt lfvi (fs2umxm ;u1tpeo oetysla eln s t4 reoircoytomtranei;t) ruoirpoydal n fviatfs2ur(mono0teeniieiysfa2ua(vp;t4 rtrxfcio1omtelnvols0tetr(rpno1al e ivslt srua(r ou4alt iieils aDrl(mo t0alxniocoa1fmD lnvi t trxm(o io4om   ncsat artr(  ot4oeen o3iat mDumuvs;t)aeeoxo3iadopD li sl(0s2urxrpio1apeemneia(fs2taumpnt0tpx mi3ias s2uauvo u)trxnmf3iydfaD lneilt0srtoxo3iy4lpee ietls a2taump;t0tle mo3tasls2rmnvs t)tleriocia1laD livol( sexmxr oodll nlfcsa(  rtaur ;u4aexniicils a rmnms;t4arxrmf ia1faDe uvsls)teto(rpoudll e ietlt s2uaxr ;u4tltomo3iasfsDua(mpn(4 eerioctytopD ln ils t2uo(r3oudolenmfvi sfaDurur ;t0texnmfetasfmDul( sn(0arxoio3iadop eau o t) rtmxr ny4lmenmnei t arra( pot0tpen fciasla2eau on()tltrif oy1fmD  nvs;t0 exmxm iy4lpeelfvslt  Drmumpot0opx mictas mDrl(mo;u) lxrir ta1lpD an i s srtmxo3ny1om   nvtat a2tmumpnu1tpeo fciasfa2el( s u0 ltoxrcoa1lp eln s s0srtr(mpio1lltelfvsa(f rta( p;t0texnmfetyt sDrm(mp;(0 rermr iodlatrli ils0 exoxo3io4oltnlfvtl(faDta(rpno4tpt  ieias a rmuvo;(4 eeoir3iotopD ln s;t)s2trxm3no1amtnlicsltfaDuax  ;t1ape mi3iydfa emn pnt4trxoio oytfatr ivs;t)s2trxmpio4lmen fct () rur(  ou0oet io3tasla umnvpnt)tlenmr3tydlatr ieolt teuo(mpnydllee net s a2rmu onu4tptoiiciadlsDumnvo t)aexomf oytoat au sls0trur(mpiy1ol e iesas)srtmxm ot0olenif3iat s ra(mp;(0 lenxo3to1opteanei;s)trxo(r oo1am  livsltfarrm(mpno1optoifciydfs ua(ms () exnif io1fm rlnes;s  exmimpnydll elfvtat arta( onu0apxo i3iaslaDelnmo (0tltrir3tatlmDr uvo;( trxmxo3oy4ll   fvt (faDururpnu1tpxomo3iysfs2ul( s u4aexomr3oodlptr u ol( trtoxo iudomtemivtls sDuaxrp;o4tlxomfctld a2rl(vo;(0 eerif oydfat  nes;t setrim3no1ap   ivt tf 2ra(m ;o1apxomicildlsDrmnvo (4artnircio1opt an o;s  exmxo nydol   fetls)a2tm(r ;t1tex iiciad a2rm(von(0texrir tatom  lnes;( setmiopoy1lptemfei sf rurxm nu0opxoiiciadlm2ra( snu0 etnio iodlaD an ils) ruoir ou4lmt mncsltfa2trxm nt4ole moetldlsDuau on(0trxnmf iytlp e ivsls)s2ur(o3no1olee nct ()a2rmxrpnt1apxn i3iatlaDra(vo;(0 leomf3oo1fa   ivs;s) exoxo nudlmt  ictls) rumx ont1tpeomfctad s2el(vp t)teenif3tytfatranvilt0 2uo(r nudolen ncsltfa2rrurpnu4optnmfciyt sDel(vs;u4teeoxo io1fa e
\ No newline at end of file
@@ -0,0 +1 @@
+nei;s s2uo(m3iu1olt  fes t  2rau o;u4opx iocilsfsDraumon() rtoir oytlmte ieo;(0t2uoirpoo1opee nvi ()s2trumpnt0oleoii3ilsfa2uanmo u) exrxf3iydoptr n sls0srurimpnu4omtn icsl()aDuru pou4olenmfcildfs rlnms t0artrirctytfp raneslt0trtoir oo4opee fctat) 2rrumoou0aet mociadfa elnmpnu)treoifcto1fmt an o;() 2xo(m3iy1ape livs tfa2umumo;u1opx  o3iys a ua(mpnu)aleoxrciodfptraieo ()tetmim3no4lmeemfvt s  Draumo;u1oetomfetadlsDulums t0tetomo oa1la eaivilt setmimpiodaltn ieta() rrru  nu0tpxo feiyd aDrau s ()alxoxf3oadoa eai olt0srxm(m3iy4op  lfct t)s2rmx p;u0aee ii3iyd aDumn pnu)tetnif oadla  lnes;t0srtmxo oy1lmtnlnvtltfaDuax  ;u4altoiicildls2rm(mo u0altnir3oydop  lnes ( s2trio3no1lleemnvsasfarrmum ;u4ale ii3iydfm2ul(mp (0 rtomo tydopDr iei s)s2umxopno1ap  mfetas  rumum ot1opx mfeiltfmDua(vp u0 rtrif iatfa elneils setm(r ny4am n iet (  Drr( o;o1oltnmiciyslm ea(mo (4 exrxf3io1omtrlies ()teur(m3oy4om   icil()arururp;t4aetomoctysfmDrl(mo;(4teeoxf3ia1fatraivo s  rtoiopoudomenlieias)s2rmu o;t1optnmi3ias mDul(mo;u)treomf to1lp elivi;t)s2ur(rpnu4lpe lfvtl(fs2tauro;u4ope miciytfa umumo;u4teenmf tydfm e ivi;(0texmxr3iudopen nvi t a2umuronu4alx  o3iatlaDrau s t0tleomfcoatlmD auvsls0s2urio ny4lpe lfcsat s2raxr nt4alxoif3iyslaDrmuvo;(0aeeoxr3ia1omt  nei (0t2uoio iudlpt  netlsf rurxmp;t1oltn o3tltlm2eaums t4aexnir3totlm  lies t)srtoir oydlmeelietl()aDrrxr ou1oeenii3tlt m2ran onu0alxnir oodfp r uei;(0s2um(o3ou4amen neia(fa2uax p;u1oex iiciatlsDeanmp;u)aetomo tatlaDe uvs (0s2tm(rpou4lltn nctas a2ra(rpnu1olxnio3ilsfmDrmuvp;t0alxrmr3iodoaD  neo () 2toxm oo4apt miesa() 2tmx ooo0tpe  f3ildlmDelu o t)trtrmr3iytfaD luei ()trxr(rpnudaleemfci sfarur(rp;t0tpxo octytfaDua(vsnu0 etrmr oatoatean ils  exmir3ny4llen ictlt arraxm ou1opxnmoeildfs rmuvp () rtoifcoy1omD  ieolt)trxo(m3ny1lme mivs () Dtmxm ;u1tltomf3tltlaDea( p;t)artrmociodlm raiei;t s2umxr3oodol nmieslt)s2taum ou4tpto fciad aDemnvo u4aeerif ta1lmDe u i;s)teuoir no1ll emicilt  Dur(rpnt1tlen fetadla2ranmpnu4tltoio3ta1lpD  ies;s0s2xmxrpny4llee iesat srrmu  oo4olx  oeiadfm2uanvo;u)aetrmo iytomDe ivs t srxm(m iodlm emnvtas srra(rpou1alt mieiytls umuvs t)tetrmocoodla raieo ()srum(o3oydlme mfvsltf 2trxrpnu0aet ifetysfmDrlnvo t4 rermrcia1lpDean o;(0sexmxm3oo1omte fetlt) rraxm nt0tpxo i3ildlm rlnmpnt)trtoir3iadfmte nei;(0seuoxr3iudoptn iviatfsDuaxroou4oexomi3iatls2rm(vp;() rtnif iydlpDelivs ()t2urimpiydolenmivi t a2tax  nu4tlto ieildfs umumont0alxoio3iadomD lnvslt0s2tmio ny4ap emici s) rra(mpot4oeen i3ildfsDua( o;u0tetomo3tatfp  anes;()sexo(rpoy4altn fvia( arrau  ;o1tlxnmoctydla ulnmp t0 eenxo oo1omD an i;() 2ur(o3oodap nliet sfs2ua(mpot4apx moetld sDran snu0 lenmf3iatlmt  nvi (0seuoio oo1lpte ivi sfsrrmur nu4apxoifeiltlm ean o;t)tlenxf iadoateluvolt seumiopnu4lleelfet s) rtmurp;u1tpx mf3tatls2elu s (0tltrio3iadlmt lueolt0 2xoxm3iydoptelivs ( sDrm(r nu4oltniiciytfmDuanmpnt0 ltomf3ty1lmtr u o;()truoim iu1llt  fes (fsDrrxm ou0alxnmi3tltla uau o;(0aleoifcoa1oa eau il(0truoimpou1lm n nctl() Drm(mono1opt  iciys s rmuvs;t4teermo3oadfpDeluei;() rto(rpoydapen nct s srrr(rp;t1aet iieiydfsDuanvp t)trxoxo iatoateaneo t)seto(r3ou1om nmnvt ()aDtr(rono0tee mo3ilsfm umn onu0trxrmr todom rai i (0truo(m3iy4alt  nvsas)s2um(m ;o0tee iiciyslsDel( pnt)aexoirciytlp  li i t0t2xo(m nodolt mnctat) Durumooo4tpeomi3iysls2el(vp t)trtnif io1lm r n ol(0s2trxm3nydopt lictat) rrmump;u1alenmo3tldls em(vo;t) lermo3ia1omt  u o;(0s2toxm oy4lpt lnvtlt)s2rm(  ot4aeeomoeilslsDuln snu4alxnmf totfmDe uvi;t0tetmxmpiodlm emfcsls)sDtrx  nu1ale iictatla2ul( pnt0 rxrio3iytomDelnvo s0 2uo(o iydale mfvtlt srrr( ont1oexoif3tlslm rmump;u4texnmf tadlpt au olt  etrimpiu1aptn fvtat  2tax pnu1apt io3iltlm em(mont4 lerio iotomDranvo;t0s2trxrpny4op nmfetl(fsrumxm ;u1optnmiciydlmDrmu pnt4tltoio tatla e nei t)s2urxrpiy1omtnmnvtl() Drr(  ;t1tlxo f3ilsfmDul( o t0 etrmo oatomt an o;()t2tmxrpiu1al  lfvsls a2tmx pnu1teeomfciasfm eau snt0altoiocoadopD lu ilt trtmir oo1amtn fet sfartrumpnu4ape  f3iltla2ua(vp t) reoxf to1fatr u ol(0s2trxo no4lmeemfvta()s2uax  ;t1tpeomo3ilt aDrlnvs;(0 rxnio tydoa e iei s0tetmxr iy1am emfvsas sDurxmp;o4alxnifeiyd mDrm(msnu4aetomrcoytopt ln s;(0t2uoxm3io4ope lfvi t aDtr(rono4ope iieiat aDra(vs;() exoxo iydlaDeluei t0s2xm(o iodlptemictls)s2urxro;t0alt  i3iatla2eaumon(0 leoxr oo1omtrliei;() rxmimpiudlptelfvt t) rtaxrp;u4ole  f3tydfs rauvp u)tetnxf3oadlaDeln s;()s2xoiopnodaleemfvi tf rum(  ;u1oeeo feildfmDrm( onu0 lenmo oytfmtelnvs;s0trtrxo nu4ol nlieiltfaDtaxmooo4tpto ocias m um( onu0treoxf iatlm   nvo s  exoxo nodaltn fesas arrm(mo;u1opxn fctytfm2rluvp t0alxnif3iydlpD  u i s  2xo(o3oodam emivsls)sDtr(mpot0tlxo o3tyslsDemumsnt)tlxomo3io1fp r i il( sexmxo iy1opee iei t) 2uaumooo4alx mf3iyt s uluvsn()tltnxo oydlmDrau s;s  2uoxrpio4alee fcs sfaDtmu oou1olto fctlt a el( o;u4arenmrcia1om e ues;(  ruoimpoo1olt mfes (f 2uaur ot4aet mociltfs2rmumsn(0 rxrir tatfaDean sls)trto(r io4am emfcsat sDtaxmonu4tex  feiytfmDra(vont0artrxrcia1lm e n o;t) exm(m oy4ole  fciltfaDrr(r ;t1olxoii3iydfa2rlumo () ltrmrcoadfm rlneils teum(m3iudolt mfetl() 2rrum ot4alxn f3tysfaDuanmpnt0tetnircia1lpDean ils0 rxrir oy4llen nctls)a2raxmp;t0oeeo feiatlsDran pnu0tleoxo3oydfpD auvo;() 2xmio3io4optnmieias) 2ur(mpoo4opt miciasfa uaump (4 etoioctodlatr nesl(0teurirpno4alee fvsatfarrrx  ou0apt  oeiatfs rlump u0artrmrcoatlmD aies;s)srtmxm no1amt livta()s2tmu ono4aleomi3ias sDea(mpnu4trxoio oatfmt luvi t0s2ur(o no1ole  ies tfaDurum ;u4tltniietyt m2umuvs t) renxrcoytoaD li s;(  euoio3iy4lp n ivs tfs2trx  no1tptn fcildfm2uaums (4 ltnmr3iy1lp  aiei s0srtr(opou4amt lfvsltfaDrr( ono4oeeo ieiatfs um( o;()aetnio3iy1opDelnvols)truo(r iudopte iesl( s2ur(mooo1texomo3tytfs2eau p;t4artrmrcio1lpDrlu sls  etrir3iy1aptemfesatf Dtmurono0tpeomietatfa2umumpn(4tlermo3oydfp eauvilt  2tm(o3iu1ale mnciat arur(m no0aexo fciad a em(vp (4tlermr3oytfmDeauvil(0t2uo(m ny4lltnlivtas)artr( pnu4oeeomf3iadfm2ua( p u) rxnio tytlpDeln ols  2xmir3io4op   ivtl(  2ta(m ;u4tpxnmieiytlm2eln sn(4tetoxf ty1opDe uei;(  rtmim oodlmte nctat) Dua(r ;u1ape if3ils s eln pn(0 eerir iy1fm eaies;t t2trxr3ou4omtn fcs ()aDtmur ;u0tltomieiasls rmnvo (0teerirciy1omD lnes s s2uo(opno4ole lfei ()aDumu p;t4tpenio3iytfaDua(mo ()trerif tydopt lneo t)s2um(m iy1lmtelnvsl(f rua(  ;u0open feiysla2um(ms;(0 eenxo iodlpD  n i;s0t2toxmpou1apenmicils srumum ;o4opxniicildla2el(msnu4 lxrif3to1laDrai slt  2toxo3oo1omt lici sf Dta(m ot1tpx  oeiatla2ulu pn()aetrir iatoaDeauvil()tetrxrpoudome  ivsa(faDrax p;u0openmoeiysfm2uanmo u) lxnmocoadla  lnvslt srtoxo ou4oltnmfvtlsf ruaxro;u1tetn f3tyslsDumuvsnu)aeenxocoadfate uei;s)t2uoxr nu4op emfvi t)s2umxmont4texniieiatfsDea( onu) rxrmocty1op e uvs (0srtmxr3oy1lp elfvsls  Durur ;u0oltomictyt aDeaump;(4 leomf iy1om eli i;()trxoir3oudoptn nesl( sDtm(m no0opeoii3ildla uanmp u4 rxnxocoytfa  ln o t0 rur(r3iy1am elfvtat s2umx pnt0apx mo3tlt aDrl( p t4 rerxo3oo1fp rlnvsl(0 eto(rpnudam   ivtltf Dtrxmpot4teeomociltfsDrln p () exnxr iydfmD luvolt s2tmxm nu1olenmies ( sDum(mo;o4teeomfetldla ra(ms;t)arxoxrctydlpDr ivs (0t2xrxopio4open nesl(  2tm(  nt4apt  iciat aDea( p u)trtoxo iatlm e n i;()truoirpno4ap nlnvtltfsDurumont0alxnioetadls2ea(vont4aetrio tytfpD luei t0srumxm3oudom  mfet tf Dtrx p;o4apx miciad s2ulumsnt0 ltrifcoydoaDr ieil(0trxo(r3no1altelnvtatf Dumu ono0tetn iciat a uluvp;u4alxoio oodfateaiei t0 eto(m3oo4oltn ncilsfsrraurpnu0opeomfeiltfmDrlump ()trenmo tydfmt lu slt0srtrio iu1ap n fcilt s2um(m no1optomo3ilsfm2rmnmp;t0treoirciytfpteluvils0tetoxo3ny1lme mneias) Dtax pno4texoifciltfsDrmn pn()tetrif tatlptr u s;s)seumir3nu4ll elfvilsfsDta(mpno4texomo3iad m ulumon(0teeoif oa1lmteanvs t0srtoio iodapenlivt t s2ta(m ot4tpenii3iltfmDelnmpnt4tltnmrcto1fptr ueolt s2to(m3iy4ope miet ()sDra( p;t4oee  iciasfm2eanvs;(4aexnmo iytlpDrlies;t0truoio3nodal e fvsltfarrau poo1opxo feiytla2ra(vsnu0 rxomf iydlaD  uesl(0s2xm(m nudopte fcias) Dtmumo;o4apxn ietydfmDrl(msnt0 eenmr iotoptranes s tetm(o nudam   nctas srurumpnt4tetoif3ilsfm2rmn o;u4aexnir3iatoa rlueolt)sexmxopny1aptelivs () Dur(mpou1tpe mociadfa ul(mp t4teenifcoadlp eai o;s teuoxr oo1al  lfcsa( aDtrxm ou4alxo fctlt a2uau p t)aetrmo tadfat  uei;s)s2to(o3no1lptnlnct tfarumurp;o0apeoii3iyslm rmn s;t)tltrmf3oa1oaDelues t  rurir io1optelnct s)a2ua(  ;t4tpto i3iad sDea(vsnu0alxnmr3totopt  uvil(  ruoimpoudlpte ictl()sDtaum ou1aleomf3iytlmDrlnmp u4trtomf3todfm raiei s s2tm(opou1lmtnmnet tf rtau oot0ope iociad m eanmp t4altrmfcta1op elueo;t0trtoxo oy4lmenmfcsat)s2ra(root0tlxnmo3tatfa2uln p t4 etoif oatom  ln ilt s2uoxmpio4lmtemies ( aDtrxmpou4alt micilslmDrmnmo u4artnif oodfa  lu i s) exr(r3iy1op n iet s)s2trurpno4open i3iaslm uluvs;u) eermo to1oaD luei;s0setmio3oudolt lnvil(f 2rmu  nu0altnifcild a ul(mo t4 exrxrcootfmt anvi;t0setm(o3iudap nlneta(  Dtm(r nu1oeeoii3tyslm eluvp;t0arenio io1opD au i;s0trumxr ny1olenmieias srumxroot4opeoifcildfm2elnvs u)tltoif3io1fa e nvo;( s2xo(r no4om e ieiatf rrrxm ;o0tpenmo3iadlsDrlnmsn()tltrxo oydfaDelu ils  2uoxrpoudomenlietl()srumu o;o1teeoifetlsla uln p u)trtnxr oytoat lnei s0t2xo(m ou1ole  fetlt sDum(mpnt0oeeoii3iysfm2rlu ont0trtoxrctodfm eaneolt t2tmirpny1lltnmncs (faDtax pnu4olto i3tat a ra(msn(4trerxo3oytlpt ln olt sexmio3oydamen iesltf rumurpnu0apxnifcils m2elnvp u0tetoio3iy1lm  luvol(0t2tmxo nydlpeelici t) ruau o;t0aptniocilsfm2em(vo;() eeoxfcia1opt ai o s setm(opoodomen fetlt srrrur no1tetomicilsls rmu o (0 exnxo3to1fp  an sl()sruoir3io1alenliei sfs2uax p;o0optoioetlt a2uln s;t)aleoxf3oadlmt  n ol( sexm(m3oy4am  mfeias)aDur(  nt4oee mociat m2emn p;()alerircoatomDe ivi s  rtoxrpnudamenlivtl(  Dur(ro;o0tet if3iatlm um(vp t0 lxrifctydopDelnvo t0s2toimpoydope  ivs tfa2raumpoo1texomoeiytfs2um( s ()trtoif iadomtraivi s s2um(opio1lptelfes t)srrrxroou4apx moctldls2uaumon() leoifctodop eln s s0trtm(m3nudamtn fctas  Drr(mpnt4aeeomi3iat s eln o (4 eeoif3ty1optr u s t0trtmxo3oo4amt licsls  2tmuront4alx mfciatfm uan o;u0 lxoxr iodoatr n sls)s2urim no4lle  nvtat) 2ua(mo;o0opx ifctas a uln o;u4teerio oo1om rln i t t2xoiopiu1ol   fvt s sDtax o;t1optomf3tls a ra(mp;t0teerirctytfptr neo;t0texrio3io1op e fcs t a2rrurono0tle mf3tyd m ranmonu) rxrmo ootoatrlu i;s0srtm(r3ou1op   fetasfaDum(m ;t4aee io3tydla rl(monu4arxrir iotfpte iesl()trxrirpnudop e ncslt aDtrumonu1aptn iciys a2emnvs (4tltnxf3io1lpDean o (  rxoxr3ou1omtemfcsa() 2rr(rp;t4aee  oeiytfaDul(mo ()tlenmo3io1om e nvo ( srtoio oo4ale  fctl(fsDum(r ;t1oetoiiciatlm ra(mpn()aetrif tytom eaiei t0trurio3nudlme mncs t  rrax pou0alen fcias sDua( s (0 etrio3totoptr ivi;s)trxm(rpnudame  ivsa()s2tm(  ou1tetnmfctlsla uaumont)teeoio iotop raues;t0 rto(r3nydapt  ict t)arrr(r ;o1texnioeildfsDrauvs (4trerxrcoy1lmDr nvol(0trumio iodopt  nesltfsrrmx onu4teen o3tydfa2elu ont) rtrxrctytopDrln o;t0trxmxrpoydapenlnctltf ruaum ;t4altnmicilsla2rl( snt) ltrxf3tytomD aivi;(  2uo(o3oy1opt lnvs s sDrr(moou1apx mfciydfaDranmonu4aetoifciydoa  lu i t)setmir no4apte ivtat aDrrx onu1tptnmo3iasfsDrm(mont4tlxrxf ia1lmte nvo;()setr(mpno4ole  ivils a2taur ;u4altoifciydls2rlnmo u0aeermo3iodlpteaivs;() ruoim3ny1lmeemfcia(  Dra( p;o1alxnifeild sDrmums t4 etnxociy1op rlnvslt0t2umxo3oo1olenmnctatfsDumxrooo4olto ieiat a em(vs u) lerif ty1fpD aivsl(0sexrio3no1aptelfctat s2rr(r nt0texnmiciytla ua(msnt0 lxoif iy1omtean s t srxo(rpoydllee ncsltf 2rr( pou4altoiociytfs uln p u4 lerio3iy1fpDr nvi s texmxr iu1lptemncsas)aruaurp;o4tpe io3iltla2eanvpn(0trxrio oa1fm  anvs;(0t2xr(rpiy1lp emnvtl( s2tau ono4tpx ii3iytfaDul(msnt)trtrmo3iytlate ivi;() etmio3iydlptelieslt sDtau oot0tptn fetyd m2el( on(0 eeoxf oydlptrli o;(0srtrxr3oodamt  ncil()srraum oo1opt ioctld a2rau p;(4tetrxo3iydfaDrlnvs ()srxrim iy4ap  mict tf Dra(m ou4tetn ociatla2ulu pn(0 rtomf3oydfpDrlneo s  ruo(opoydll  lfvtlt)sDtrur no0apx if3iydlm elnmo u)tetrmo ta1fp rlivo;s trur(r nodamte fetl()aruaxrp;t1apeoiieiat s el( onu4 eerxfciy1oa elies;s)s2xo(m3ny4llteliviat  2taxr ;u0opeo ociyd aDem(vp;u0tetoxf oodfp   ieo s0teuoiopnydame  ivtls)a2trurp;t0alt  feiat s uln s;u0trxnmr iydfaDr ueo t)srtoir oy4omenlfctl()arrmumoot0opxo icildfmDean snt0aleoxr3oadom eaieilt  2toirpou4ame mnvs s s2rmu  nu4tlxo iciad a2elnmo t)teenmr3totfp r n s;t0setm(r3nodaptn fet t)s2tauroot1oeenifeildlm2em( s (0trxrif3oa1oateluvolt0t2uoxr iy4lltn fvtat)aDrm(m nt0olenmi3iadfaDumuvo;u)tltrif3ia1la  li o t) 2xrxmpiy1lmeelfvs s  rra(mpnt1alxo f3taslmDemnvp;t4texomf3todfmD aueo s s2um(o3ny4omtnmfvt t)aDumxrpnu1apxomfciadfsDem(vpnt4tlerio3iotlmDrlnvsls) exrxopio1ameelivtl() rumx  ot0opxn fciltls em(vs u4aleriocto1lpDraies s)sexmirpoodolt lfetas)sDrr( p;o1tleoio3iasfa2umuvonu4alermr3tatlateaneil(0 rxmir iudamtelncias)srrrxm ou4apxnifeiydfaDel(vpn()areomrcoadfat aues ()sexo(o nu1ope mivt (  rtmumoot4oeeo oeias s emnvont4alenio3tydomD  u olt0 2umir3oy4ame miesat  rtaxrono1alenmfetltfs2eanvs (4tltnir oatfpD  uvo s)s2tmxrpio1op emictlt)a2umump;u4oltn f3tysfs2uln s;(0artrxf3oa1fpD li s;s)srxoxopoy1ol n netlt)aDum(r ;u1aexo ociadlaDran o t)tetniociydoaDeaneo;t) rxmim iydal  mnvt (fsrtm(mpnt4olenio3tydlaDrlums (0treomrctatfm  anvo () rurio oy1ol n fci tfa2ra(  nt0tet ii3iltfs el( o;(0 ltoxr3io1op  anvo;s seumirpno1aleelfct t  2tau  ou0oet  oeiad m uan o u0 etomf tadlmD  n s;( setm(mpiudlme mfcsas s2ta( poo4aeen i3iltla2uluvp t0altrir tadlaDe ueilt)t2tr(r iydaltelfci t)sDtax  ot1ole ioctlslsDrl(mo t0aeenxo io1omDeauei;t0 eum(opou4oltemneil(f 2tmurp;t1tlxoiictltfm2rau s (4arxrxo3ia1oa r nvo;t  rum(r ny1lmtemncs s) 2uaxmo;t0alx ii3tls sDrmnmo;u4trtnxociy1fateln o;s  etmir oy4amt mfci (faDuaum ;u4tlxn f3iat m rln snu0tltrmo3iytfp   nei () rto(m iydlltnmiesatf rrrur nu1aetnmo3tlt a2ulumo ()arermo3oo1fm r ieolt0trurxmpny1lpt lfei t a2rr(rp;t0aex iiciadfsDrmnmsn()aexrmrcio1lp elivsl(0s2toxopoo1oltemicils) rrmxmpno1tpto fctyt a2ea( sn(0trtnmo3iotlmt  ivsl(  eur(rpno1optelfvi s)a2umx  ;t0aetn ociadfs2emu o t4artnmociotopte n o;s) 2tmir3nudamtn fciasf Drrum ;o0opxoii3iat a2elnvo;()aetomr3todfpD au o;t trumxr3iydap n neias sruaumo;o0oexomo3iatfaDumuvo t)areoircoodlmDr nvi s)t2xmxm3oo4ol e fetas aDrmx onu0ole if3iltfmDumumon() ltnmf3todlmD lu o t)s2ur(o nydop   ivtltfaDraump;t0tetniocils s2ra(vp;t4treoxfciy1opDeluvi ()setmim iy4lmenlfcsl(faDtmump;u0apeniictls aDel(monu4alxrxr3totopteanvs (0teurxr oo4apen nes sfarra( pno0tpxomo3tat s uau p;t4 leomo iotlp e uvo t)sexoir iodlm  lfet t  2uau pno1aexo f3tltfmDemnmp u4 exoir oatomteli s;t)teurim3iu4am nlnctasfsrur(mo;t4apenmieildfm rmnmo t0 lxrif totlaD  uei s)texoxrpio4ale lfvi ()arumxrpnu4opxnifeilt a2emu p;()tltnio3iydlpte iei (0srto(opnodop  mfetat s2tmu pot0tlenifeiad m2umn p u) rtnxfctadlm rau ilt  rxmirpny4lmenmneils a2trxm ;u0olxoioeilt sDemuvsn() reniociy1laD auvs;s) euoimpou1optnlfcslt)a2rau pno4opxn o3iys m rm( o;t0texnxr3ia1fm rluvo ()teuo(m3oo4optnlies s)arrmurpnu1apen icilsfa2elnvp u) rtoxo io1lat  u o s0trurimpnodomtemivt tf rrrxrpnu0oeeo oeiad s eanms u4 exrio3totop eaivi ( sexoir3nodal  miei s)a2tm(m ot4tpeo f3tys s2rln p u)tlenio3iydlpDe nei;t) 2xmxr3no4ape mieslt srtaxmoou4ale io3ildfa emnms u)aexomf3ty1lpt  n sls)srxr(r3io4lm emfctls sruaxmpno1tptnii3tlslaDeau s (4trxnmrcoo1latrlues;( setm(r iu1om e fvtl()arrrxmo;t1tet  f3ildlmDrl( snt0trtnmr oadlmteanvi t0srxo(r3nu1ap e fcs tfaDtax oot0tetn oeildfm2uln p u)altrmrcoa1fmDr i i;t sruoim3ou4lm nlnci s  2tmx pnt4tpeoiietys aDemn s;t) rxoxrcta1fatr uvi;(0 rxoim oo1oltemivias srumurpot4olt mo3tlsfaDrm(mp t) ltrmo3ootlp r ivi ( s2urxrpiu4op  lfcs tf rtrx pou0opxniicilt s ulu p;t4texnir ta1fa eanes;t0setoxm iu1altemnvilt a2tm(  oo0opx  feiyd s uluvpn()aexrxrcio1lat auesls0texoxrpiy4op  lfcia(  ruau ono4olx ifcilt s2ranms (4artrmf3oatom  aivo;t0 rurio3oy1ole liet tfaDrmur ot0teeoiictatfs2um(vp u)tetnxo oo1fptrlneolt  2toirpoydlpe  ivtl()s2tauro;o4aptnifcildfm2rm(vs (4trxomo oodlm rai i s s2ur(mpiydlmtnlnvtl( arrr(rpou4altnifciydlm emu pnu4 leoio3oydfa ran s (0trtoio ou4openlivslsfa2urxmpot1oetn f3iatfmDrm(vs u4 ltoiocoy1omte uvi;t  ruoxo3nodllenlfeia()aDtrxront0olx ifciyslsDelnmp;t0 ltnif oadlaD luvs;s)texoio ou1op e fesls srtrumpnt4opt iiciltla2ranvp;t0 lxrif totlp eli o (0 2to(m io4omt  nvtlsfs2ra(ro;o0optnioeiadls2uan s t0tetrxo3oodfaDeau i ( s2uoim3no4open ncsat a2tmx pnt0oeenif3iyt a eanmsnt4altrif3iy1opD auvo t0seuoxm oydom e fesasfa2uaxrpnt1optnif3iaslm rluvont0aetniocty1late uvslt0 etrxmpoy1lmt mfeia(  rumuro;t1tle  iciad a umu sn(4aetomrcto1lpDr uvo;s t2xoio3io1ll emfetlsf 2tr(  ;o0aetn i3tlt sDumuvpnt0teenmf tadfateaies;s) 2trxm nu4altn fesat)aDumumo;u0opx if3iatfaDrln on(0 eeoir3iotla rai i (0sexrim3oydamt  ivtatfsrtmu  ot1opeo fcild m2eluvp u4alermo oo1fpte uei;s)t2tmxr oy4opte icia(fs2tm(  oo1olxnmieilt m ulu s;t4 ltrmo iotlm   ies;t s2xo(o3oodllee ivsat  rua(r ou1optoii3tat s2rl( sn(0trtrmr oatopDeaneil(0trtrxm oo4altnlfctl(fsDra(monu1oetnmoeiytlaDemnvo (4aleniocoatom e u i s) rto(o3nodlmt licia(f 2rmxrono1olxomfeiydfmDua(vp (0artnmr3to1opDr nvs (0 2tm(o3oy1lmt mncslsfarrauro;u0alx ioetytlsDran ont0arenxr oodoptrai s;t) etrxo3oo4lm   fcia(faDtmu p;u4olenmo3tydlm2uau o;t4trxnxf3todlat  nvol( sexmxmpou4ap emfvt sfsrrrum ;u1oetomi3tlt mDeaums;u0trtoir3oa1omDeauvi;s)s2urxopno1olte nei t) rur(rpot4olxnmfeiadls rmu s ()trtrir iy1fmt an sl( srxoirpiu4op  lnvtatfsDur(  ;u4aee iiciyslm2umnmont)alxnmf3to1omtrliei;(0tetrxr nudamenlncs ( arum(  ;t0alxniiciytls2eanmp (0trtrmo3tydfpDrlivs;t  2um(mpou4alenlfcsa()arraum ;u4apxomo3tas m2ranms (4tetnmr iy1om eli i t  2toxo3iydlmt  ncil()sDrmx  nt0ole  octasfm2ul(vsnt4tlxrif3tytom ran olt0 exmxm3iodameemfvtlsf rua(  ;u1altoif3iysfm umuvo;u4 eeriocoatoa   uvils0trxm(o3ou1amee nci ( s2rm(ront1olto ociytla2el( o u) lxrmrcoatomDrai o s  exmio io1al  mncils a2uaumpnu0tptomfeiltfm2rlnmsn() rtoxrcoa1faDr ieilt  ruo(opio4am e icsa( arrm(rp;t0olxo ictadfs2ulnmo;()alermo ia1lm e ieolt trtmxrpoudol nlfcilt arum(mp;o0teenmoetldlm2rmn pnu)tlxnifcootlmD aivi s  ruoxrpnodopenmfesltf Dumur ;t1aeeomociytla2rl( pnt)altrifctatfptrlu i s)s2xmxopiy1am  mfciat) rumurp;t1olx mfctldla2uan o () rerio3iytlaDran ols)srur(rpoo4opee fciat)s2trxrp;o1ope mfciatfsDua(vsn(4alerxr iotfp  aies;t trtrio io4lpt lies ()arur(ronu0tptnio3iatlsDul( snu4 renxo3ta1lp   u i s)srurxmpoy4om e fcsat srumurp;u1tetniietysfa2eaums u0alerxo iy1fat  i s s0 2urirpiudlme  fei t aDtmxm ;u1optomictaslm2ul(msnt0tetnir oadlaDrauei;t  rxrxm3nu1lltn netasf rtmum nt4apto feiltfaDrmnvont)aexrmo tadoptrluvo t  etoxrpio4altn netatfaDuaum ;t4tpeoiociys a rauvp () etnir iytfpDe u ol( sexoxm iy4altnmfci t)srraxrono4opx  ietad s2umuvo;(4tetrmf3tatoat auei t sruoir iy1lpt  feiatfsrururpno1alx ii3iadlaDemnvsn()aexoxf3oodop r n ol(  exrxmpio1lp  lncs (  rrmurpnu1tlxnmfctadfs2umnvs (0teerio3oytfptr n i ( sexoim3ny1ope lfvtasfsrrrum nt0alxnmfciys m elumpnu0arxrif oytop e uvo s  exo(mpoy4al e nes sfsrraxmpou0tetnio3iys mDrln o (4trxoif iadla e ivo s0t2to(r ny1ll emnviat)srurx oot4apenioeils s uau snu0teenmo ootfa  aueo;s0srxrirpnu4ap  mnes t a2trumont4oltnmfciytlm umn p;u)tltnmr totoa elu i t) rtrxo iydlm emieil()s2rmxmo;u0tleo feiasls2em(mont4aetniocio1fpD ln s;s0trumxr iy4amt mfcs ()s2uaumpno4aeeomociys a uanmpn()alermf io1la   i i (0srxoim oo4ame mivs sfsDtaxm ;o4tpx ioeias m emnms;(0altoxf3oy1lm r i o (  2xoirpoo4oleemneta()s2ra(moot1aexo f3ilslaDelu s;()aeerircto1lmtraneols)sexoim oy4lpeemfetl(faDum(m ot1apxnifcildfm2uau p t)artoirciytla rlu s;()t2xoxm oydlptnlieiat a2tax ooo4ole mfciydlm2ul(vo t) rxomrciodfa eaivo;t0srumxo ny4am emfcsa(fa2raxm ;o4tlxomfeild a2rln o;u)aeeriocoytlp ean ols trxoxrpny4al   nvta(fsrtaumpoo4tleo fctls a2rlump;t0trxrmr3tatfpt au o;t texm(r3oydoltnlnesltf 2rrxrpnu4olt ioetatlsDum(mo;(0tetoxr3iadlmte u sls)sexoir3iy1omt lnvsls a2umum ou0aexo feiyt mDuau o;()tltnxf iytom rlues;s0 eum(m iy4llte ncsls aDurxm nu1oetoifcildfs2um( o u4tltomfcoytla rli i s trxr(m iu4lptemfvtl(fa2tmx o;o1tpe  ietad a rmn o u0tlerxr3to1fa  aueo t s2tmio iu4op  lncs ()artrxr nu1opx ii3iytfs ran o t4tlermo3oo1fm rlivol() 2um(m3oy1om   ivias) rurumpot0teeo f3tytfsDuluvp (0aetomf io1fm r ueils)tetoxm iu1aptnmfvs t)artm(ro;t1oeeo iciyd a2emuvp (4arermr tytfmtrlnvs;( s2uoimpoy1lltelnetlsfsDtrxrpno0aee  fetys sDuanvont)aetoxf ia1fm raueo t0 etrio3nu1olt lfvsl(fs2ra(mpnu1olxo fetatls em( o t) rxoif3oydlmtelu s ()trtrirpnu4lltnmfvilsfs2trurpoo4opx  iciaslaDrm( o (4artoir iatlaDelnei t0s2xr(m iodom elivt ( aDumxrpnu1tet  i3iat a umu onu4aetoxf iotfpt li s;s trtm(o3oy1op  licta(  Duaxront0oltnioetytlmDumnvp;t4artrmr3to1fpD  nvil(0setriopnu1apenliet t)s2rr(r nu0aetomietlt aDea(mo (4areoir oo1oaDeaueils  2uoio io4omeemfct () rrmu  ;o0oexoifciydfa umumpnt4treomr tydfpteauei (0trtmim3iy4ol nlicsls) 2rm(r ;o4oexomietlt sDumn s;t) reoxfciy1lptelivs t)t2xmir io1am emicsa( sDtm(rpoo4aex  i3iytlaDua(vo t0areoxf3to1fm   uvi s0 rxoiopny4oleelnvslt a2rru pot0olto oetasfa uanms t0 lxoir3ootopD li o;s s2xr(o oo4ome lnetas) Dumxmono4tpeo ietysfm ran p () ltrmocoadlm r nvslt  rumir3iudll nmfct (f Dtmurp;o1tleomieiydlaDea( o t4 rxnmf tadopt  nvo;s0seum(mpiodaltnmfviltfsDumxrpno0alenioetyd a ea(vp (0aeenmo3oatomDe neo t) rxo(o io4omte ncta(fsDtm(m ou0olx mieilsfmDuluvpnu) rxomf oa1oat  uvs s texoim3iydomt  ies s aDur( p;o0aeeo iciltfa rm(vpn()treomo3oatlat  i s s trtmxr iu1amtn nvta()a2uau oot4oex  fciydfsDul(mp u4alenxf oy1la e nes t srtrio oy4om n fvsasfartaxmp;o0oeto oetadfaDeauvs;t)altniocootfa elues;t0texoxopny1olt lfvtl( s2uau pnt4tleoiociysls2rm( onu4 lxnxrctytlaDe n i;t srxrim io1lltemicsltfaDrmxmont0tpenii3iltfa rln on()tlxnir oytlaDr u ils0srtrxo3oy4lm elfcsa( arumu  ;t0tetoiiciaslm eanvsnu4aexomf3oydla e uvo (0 rtrirpou1oltnmfvi t  rrmurpoo4aptomfetyt s raumsn(4 reoxf3tytopDelneo;() 2um(mpoudal e nes (fsrtrumo;o1tlenmictytfm2eau snu0trxrmocoodfa r ueo t0 exrio3iudape mncsls sDtmx  oo4apeo o3tysfm ra( s;u)tetoio oy1fm r ieilt  eto(rpou4amtnmnci sfarta(rpno0texn ietytfsDrau p;u0trermr3oo1fmDr ueils setrimpou4altnmneslt a2umumpnt4apxoii3iydlmDumuvo;t0alxrmf3oytlaDran s;t)seto(m nydopenlfvt (f Dtm(m ot1alx mfctldlaDemu p;(0tlermr iytlaD  nvo t  etoxopoudop nlfet s srtr(r ou0aleomoetytfa2um(vo t)arxomo tydlaD an o;s)t2tmxo3nu1omenmnviat)a2rmurpoo4teeo ieiytlmDra(msnu0 rxnmociotlp   uvs s0 eumio nudolenlivs s sDuauro;o4aexo iciadfa2ra( o;u4trtoio ty1lat  ueo;(0sruoxo iy1op n feilt srumump;o4tetnioetadfs uau pnt0aexnmf oytfp r i s;s0trtrxr3iy4ale  fct ( srtru p;t0tptomi3ilsfm ra( on() renmrciydoat luvs ( setmio nydap elfvtas  rtau  ;u1optnmi3ias m ra(vs u) lerif3oytfm   i i;t0 2xm(o3oo4lmenlivsatfaDrau pou4tleoii3tlsfs2ea( p u4 eermociydlpDeau slt setoxr3no4om nlivt ()arua(mpoo0opto iciysfs elu p u0alxomf ia1oa elnesls0srur(r no1lp nlieslt sDrm(rp;u4olxniietatls2ra(mp t) ltnxocoydopDean i;()trtrxm3oodapeelnesls s2tm(r ot4optn ietlslm eaums t0aexriocta1omtrau ols t2ur(m3nu4olt mnetlsfarrr(ro;t0alxnmfctysfm2el( o;t) lenmfciydoateauvi;t t2xoxmpoydap n feil(faDraxr ot0optoifeiatfm ulnvo;(4 lxoxo3ia1lmDrliei (  2trxr3oydlpeelfeiat aDrmx  no1alto o3tys m2rlnmsn(0tetnxr tydlaDeaivo;t0teumxr no4om n fes () Dtmxm ou1ale ioctldfsDrlumsn(0tlxriociadom rluei;( t2tmxmpiudlme mnetat)aDrau o;o0opxn i3iltfa rmumont0trenmf3ta1laD  uvo s)srurxr io1lpee fct s a2rrumono0aptniocild s2ul( on()alerif3iatomDelnvi;s)trtrim ny4omtemivi s)sDtmx pou4alto fciasfmDelnmo;u0 lxrmo ootom   ues ( sruoio3oudaltn fei ()s2tau  ;u1tlxomieildfm emnvo;t4trerxf3ootla ranesls0 euoio3iydlpt mici sfarraxrpno4oetniocildla uanvs;u4 lxnxocootlpDeanes;s sexrxo3iy4apen neilt sDuaxm ou4optn fctasfs rau pnt0 reomrcootfa rli o;t tetr(r3iu1ap nmnciasf Dur( pnt1tpxnmfeiydlm2el(ms (4tlxoif todoptr n o (0s2uoim io4lltemivs ( aDtmuront4oee  f3tadfsDrmuvpnt0alenxo3iotlp e i sl()setoxopio4al emietas srtr(r ;t0oeeo feiytlmDea( p;t4arxrmo3todoat luei s)s2toiopiu1llee fcil( aDurxro;u1olxn ociysfm2emums t)trxrxo3oydfmteaieo;t0s2umxopny4lltemfeta( s2uaurp;u1teeoif3iaslm2uluvs;t)texrmo iotfp eauei;s  2tmim3oo1lpt mfetl() rtm(mpnt1texoiieiytlsDran p t4 eerxrciadlmDrluesl(0t2xr(o3ny4al  lncs s sDur(  ot0tlto fetas a eluvs () renmf3iotomtrlnes;( t2tmxopno1amtnlietatfsrrrxro;u4oeeomf3tlt aDumuvonu) exnmo oa1oat  nvi ()texr(o ou4al nmivtls)arrr(mp;o1aexoiieild aDem(vs;()tltnxr tydlaD anvolt)srxm(r nu1lle liesl( aDumx pou4optoioeiytlaDrln snt)artnio3oo1oaDe ueolt) exmio3oy1omee fes t s2ur(ront1aetoifciyt m2ua(vs t) rxnxr3tatfatrlueol()t2uoxo3ny1ome  fct ()aDuau onu0opto iciys s uaumo u)aeeoxf3iydopt ai ils)setrirpio4lp n ncsat  rtruroou1apxoioeiydlaDranmpnt4 rtoxr3totfpte ues (0teurxm no1alte fviasf 2tauroou4apxoioeiydfm emumpnt)tetnmo iytopteanvs t  exriopnu4ope  nctl()aDtm(r nu1tltomoeilslm emums;t)texrmf3io1fmDran il( s2urim oydlm   netatfs2rm(  ou4tpx moeiyt s uauvs;u0 lenir3iadopD lieo s0sexr(o no1ope licslt) 2raumpnu1aexo f3tys sDemumpnt)trxnio3iydfmt  i ols0s2xm(r3iudope mnet t  2rrum ot0olto octaslm2rmuvo (0tetoio oydlaD aies s) etrio no1optemnetat)arrr(r ou1altoifeildfaDranvont) etoxf ootoa  lieil()teumxopiodaptemncs tf 2tmumono4tlx ii3tyt aDrauvpnu4aexomo oy1om eluvilt0s2xr(o iy1opee feias)s2tau pnt4tlxo octyt s um(mp (4areniocoatopDr n o s)seum(o oy4apenmnvtls aDrm(mpou4optnmoctad s2rm( pnt4tltrxf ty1fm raieo t srxmxm oudom e fesatf rrmu p;o4alxoifciytfm2eanvo;t)altnir oodlp  auvs ()t2xr(m3oo4lmtn fct sf Drr(mpot1tpxomoeiat aDran snt4 etnmo iy1faDr n slt seumio iu1lleemnciat  2uax  ;u4oltn o3tatla2emumsnu4aexnmrciytla rlues t0t2xoio iu1ale  fcils)sDrr(m ;t1oee  oetltlmDum(ms ()trtnmo3oatlmDelieo s0srxrxopoy1ol nmncia( a2trumooo1tlt mieildfs ra(vpnu0arxoxo3iy1lpDr ieilt setr(r3no1om n iviat)s2rax pnu4optn i3iatfa2rm(vont)tleomf oytop eaieo s) rur(rpiydome lfei t)aDtr(rpnt4apeoif3iytlaDelnmp;u0aeerir3iatomt aivs (  exoir3ny1ole miet tfaDur(ro;u0oex  i3tasfs rm(vo;()teeoxo3iy1latrauei;s0srtmio no4am emnetat srtmu pnt1apxoifctad a2rl(vp (4aeeniocio1omD  ues;t s2uo(opiu4olen nvia(  Drmxrpno1texoio3iyslmDrmnvp t0arxrmf tadlmteaneol()srtmxm3iy4llee netlsfs2urx  ;u0oex ioeiys m um(mo t)aeeomf oydlatrai olt0tetmxo3no1lltelfvs t) rta(moot1olx  iciatfm2rmu sn(4aleomo tadfpt li i s0t2xo(rpiu1om  miesl( aDum( poo1aeeoiietlt s2el(mp;(0 lerifcio1lmtraneol()sexoxrpoo1amtnmfvilsfsDraxm oo1tlto i3iytlm rl(mo u0artrxociatlaD livsls)seto(m ou1alt liet s sDuaurono0opxoiietat aDel( snt4tetrxr iydoptelueo (  rxmxm3no4ole  icta(fa2taur nu1tpt ii3tyt a2ua(ms ()artrxf3oatfate uvol(0 2tr(o nodlptnlfvslt)aDtrurpnt1tlenmi3iad sDrauvo;() etrmf iotla r u o;(0s2tr(opiu1lptelnctl(f rum(moot4opxnifeiadlm2elumo;() rtnxf iodomtraieslt  exo(r oy1opte ict ()s2taumpot0texn f3iatlmDrmuvo (0 ltrio iadfa  livo s)t2xmio nudomen fcta(  2tr(mp;o0tpxo octatfsDrau s;u4tlxnxrcoatlm r ieil(0seuoir iy4op elfei ( s2tru o;o0tptnmi3tatfa2ua(mo;u) rtrmr oytlpDraneo;()seuoxr iydap   icils) 2tmxrpnu1alxoif3iaslaDuanvs;u4tetrxociotoaDeluei;t seur(rpno4lme  nes sf 2trumo;o4oexoioctasfs ua( o (4trxrircoadfm  aivs;t s2xoxr3oydal nmnctasfaruru o;t1tlx mieils s elnvo;u0aleoxo3oatlaD  u i t trtmio iodoleemfvil() 2rm(rpno0apt ioeiat s2ulump;u4arenmf oydlp  anei t)t2xo(m3io1lle  nvtls  rrmumpou1alenifctys s2rluvpn(0 exomf3iytfaDr ivo;(0t2uoxm3ny4oleelncias  Dum( ono4tptn f3iytfa ranms;u)aexoir3ty1oaDraiei s0 2um(o3nu4lm nmncta(fartru oou1olxn f3tltla ranvo u) lxrmfctotlat lu o (0 2toxr oo1omt  feslt arrr(mpnu4tle  i3iytlaDemnvo (0treomo3oydlp eli sl()tetrio3nu4omt  nvs sfa2tm(ront4aeenmociaslmDrmuvp;u0altrxrciytoa  auvo;t sexo(rpiydlm nlncil( aDrax oou0oeeomo3tlt aDuau ont4tlerxocoodlmtelnvo s)setmxo nu1aptnmfcsl(  2tr(rp;t4aeto ieildlm umn p u4arxoxfcootlm e i o t0trto(rpoo1aptnmicilt  2rr(mooo0oee io3iadfmDemuvsnu0alxnmfctytoaDeln o t  2umir3oy4alt lfvtl()srurxrp;o1opxnifcilslsDelnmp;t4 eenmf to1om r uvils)trtm(rpno1lle lnes tfsrur(m no1aptomo3iydls2eauvs;u0areoir3tadlaDr uvs;t t2um(o ou1om e ietlsfsDum( oou1alen ieild s2rauvo;u4aetnio3oodopD aies t  2trxr iydoltn fcils arur( ont4apt ioetytfsDem(mo;u) lxrif3tadoa eau i s) exrxmpnu1optn fvt (  rrrxmp;u0tpxoiieiasfs umumo u0arxnif3iotlaD lnes t)sexmiopny1opt mfvs s  Durxrpnu4tptomfciytlsDelumo (4 ltnxr3iotoptelnvs t0 eurim3iudol nlfcslt)sDurxrpoo0tle  ietldla rmn snt4 rxoio3ootopDelivolt  euo(r oo4aleemnviltfs2raumpoo0tlx if3iad a rm(vo (4 lxnmfciodlaD aivs;s)sexmiopiudlmt mnvtas a2raxrpno0tpeomociltlaDrln p t)artrxrcootomt lnvo;s0texr(m no4ol nlnes t aruaum ot1oltn i3iad mDraumo;u)teeoircoy1lm  lneolt0 ruoio nu1ll  mieil( artm( o;u0texo ictltlaDrluvs ()altoif3iy1omt lneil(0setmxo ny1lp   nvt ( a2ua(r ;o0olenmfeiltfaDumnvp;t4aetrmrcoydla r nes;s)t2trio3oy1ol nliesa( aDumumoot1opt ii3iysfm2el( o;u) eerir3oydfm ran o;()teurir3oy4lpee fcs s  rrr(ro;t4olenio3tat a2rmnvsnt0aeeomr io1lmD livs;() etmir oo1apeemfvs s)s2umx p;t1tle  fciysfm2ulums u4tlxrir3oo1opte n slt0sruo(r3iudomenmnei tf Dtaxmoou4olen fctydfsDrm(mp u) ltrif tadop rai s;()trum(m iu1lm   nvtas s2urumo;t4olxn ietaslsDrmumpnt4 renmfciotfpDeaiesls)s2xmiopou4amenlivi () rtaxm ou0aetoifeiat m rau o (4 eeomf ta1fpt  u i s0 2urxmpny1alt lfciasfaDrmxmpot4aleomf3iysla ua(vpnu)aetnmo oatlmt lnvi ( s2uo(m3ny4lpeemnctas  Drrxm ;u4ole mo3tls a emn p u4artoxo io1lpteaivo (0seumio ou4aleelivi tfa2rmu ont0oeeo f3iadlaDemu p;(4tltrmo tytomteau o s sexrim oodamee ivt (fs2rmu oot0olt  f3iyslm2umuvp;t)aeeoxoctytfptr i ils  2xoxo oudamte feias)srta( o;u0tpxn f3tldlm ua( o;u4altnxoctydlpDe i o;() 2ur(o3oy1lmt  fesl(fartrxmp;o0opt if3iltlaDuauvs (0arxoif3oadlm rau s s)t2uo(o oy1op nlictlt  Dtmxront1opxniietls m2ea( p;t4 rtnmo iotfmtelnvs (0 exrxrpnu1lpt lneilt)sDuau p;u4alx  i3tlsls2ra( p (0tlxomfciatlatrlneils) eur(m ny4lm  mfvslt a2uau ooo1aeeo i3iytls raums (0aleoir3iodoaDeli i s t2tm(r3oodll   icsat)arra(rp;o1texn oetydfm2emuvpnu0 rtoxo tytfp r i i t setmirpiodol  lnci s  Durx  nt0texnioctysfaDem( s t)aetnir3tytoat  u il() 2toirpoudoptelnctasfaDrrum nt4opt  feiadls2umnvp t0teeoif3to1lp rai i;s0texoxopiodlmee icsasfs2rrurono4olx mf3tlsfs uanms (4tltoio3iatlp rauvils) exm(opno1ll emnesas arumu  oo1aexnio3iydfs2ea(ms;()texomo3tytfmtrlu slt0 euoxo oy1optn nes t  2ta(m ;t4aexniicilsfa em(vsnu4 renioctotom   uvo t)srxmio3nodlpe  neslt)s2ur(mpnt0optoiiciyt mDul(vo;()teerir3iy1lpDrau i t0s2tmxrpno4lmt  fvtls)srtaum ot0alxnmfciyt s2rmn onu4 rtnir iadom elnvo;t)texrxrpnu1opt  ivi s)srrr(ronu1oexnmf3ildlm rmnmp;t) ltrxrciydlaDr i ils tetr(m3ou4am emfeil( sDtau o;t0opxn ictlt m um(mpnu0trxnmr tatlaDrluvi s0trtr(m ny4optnmnvsat)aDra(r ot0tpxomiciyd aDemump t0teeoxr3iodom eanvo;s0 eumimpno4op elictat s2ta(rpnt1aee  ieildfm umn p;()trxomo iytfaDr uesl( trtr(opiu1lptemicia(fs2taum nt4oeto feiltfm2uluvp (0teenmfctodla rluesl(0 2ur(rpoy4alte nvs t)a2ur(ro;u4alxnif3iadla uau snu)arxnmf iadomDe ivs;s0trumir3oy4olen ivtat sDua( pot0ole ii3tydfmDrmnvsnt4aetrio totoaDrauvo;t texm(r3ou4lpt mieiasfsrta(mpno4altomo3tld s em(vs (4 rxnif3oa1lpt  nvi ( s2xoim3nu1al   fciasf Drmxmpno1alx micils s rm( p u0trxrmr iodlmteln olt0trumiopou4amtemfcs t  Dtm(  nt4tpto f3ilt mDrmu o;t0tltnifcoodla  lneo;s trxoxm ny1amte nesl()arrm(mpnt1oeeo f3iasls2emu on()tetrxo to1optr u i s)tetoxmpio4am elfvt ( a2tr( p;u1tex mi3tlsfa2umn sn(4texnxo totlp  aueo s0texmio nu1oltnmieilt)a2ta(mp;u4apx  ictasls2ranmp t4arenio3ta1oatr uei s) rurxo3nodale lnctatfs2raxrpot1tpenmf3iysfs2uau pnu4artnir3oytlp rlnvi;t0 etmxo iu4ll nlfesls)srrr(rpnt1opxomociat m2ua(mpn(4 lxoircto1fat anvo t0texmxm3oodlpe mfvsl()aDtaxmpot1tlen icildfsDeauvo;(4 rtnir3tydoa ran sl()s2xrir3nu4lpeemfvsa(f 2rau  ot0apxnmo3tyt mDrl(vs t0 exoxr totomtelieil(0seurirpiudalen fcslt  Dum(rp;t1oltoiietlt m elums ()artnmo oo1oa  au sl() 2uoxm3ny4opeemfvsas)srrmxrpno1aleo o3iytls2elu p (4 leoiocoy1oaD auvo;s0truoxm3iu4ope lncil(  Dta( ooo4olxoioctltfs el(vo u4arxoir3iodfateaues t0t2urxr3iudlp   nct t  Drmu pnu1oltn ocild a rln s (0texrif3tytoa e i i ( trtm(opnu1lmenlics sfaDtaxmoot1apt  i3iad s rmnmpn(4 lxrif3to1op raneo s setmio io1alenlivsas)sDrrxronu1olxnmieiadfa ra( ont)alerio tadfm e u ilt trxrxopio1lm e ivt s) ruaur nu4aex moeiysfaDea(ms;t)tleriocoo1lpDrau s;(0srxr(r oudamt mietls)arum(mo;u1oeeo fctydla rlnmo u0 rxnmrciy1fpteaues s0 rxm(opou1alt lfcsls)s2tru  ;t1tee mi3iyt a rlump;(4treomr iotfmtrauvs t0 etm(opiodlpeelnci s aDra( p;u0oexomf3tldlsDemu s (4aeermf iadoa eai o;() rxm(opoo1llt lnvia(  rurx  nt1tltnmfeias s2umuvs;()texoifcoydfpDr nes t0s2xoiopiu4omt  iviat  Dtm(r ou0texo ociysfa ulu snt0 leriociydfmtr nei;()s2urxm3nu1ome  nvi s)a2umxr ;u0optnif3ilsfa2umnms ()aleoxr3iytfpDeli i;s t2xm(opiodoltnmfcia(farua( pnu4oeenmietltlmDelumont)tetrmr totfpD auvi;()setoiopoodlm nlfeil(f 2trxmooo4tlt  o3iltlm2ea(vs;t0tlermrciy1fmtrau o;(0t2urxo oo1am nlnet ( aruru oot1altoioctltfs em(vp;()alxoiocto1fmtrlueslt0seum(r io1amt licias)a2uru ooo0ope micilslmDrau s t0arxrxo3oydfat  neo (0 ruoio iodamtn ictlt s2rrx ont1aex  ictldfa2umu on(4artrxr iodlatelieols0seto(m iodalenmncil(fa2tmxmpnu4oeeniietlsla rlumsnt0aleoxociotlmDraneo;t srxmxm nudlpenmfet tf 2urx  no0texnmo3tltlm2ua(von() lxnxociadlp rln i t0sexo(r nydllt mfcsas)aDra(r ;o4oex  fciad s2em(vont)tetoif to1fmtrai o;(0s2umir3nydamtelnct s artm(rpnu4apeniictat aDuanmpnu)altrio3oodfpDrluvo s)teto(o iy4lp e ieilsf 2ta( p;t4tpenmieilt s umn snt4 leniocoy1fmDr uei;(0t2um(m iudlltemnvil(  2taxrono1tlx  oetldls eau p u) lxoir to1fatean o;t0t2uo(o3oy4lmt  neia(farua(mp;o0tptn ietadfmDeau pnu4altnxr3oatfaD aues;() ruoirpiy1lltemfct s sDumx  no0tpx mfctad s rlnms () rerir iodlmt aues;() etrio ny4op elnvias) rta(rpot0altn oeiytlm2em(vs;(0 renirctatoaD li sls)srxoirpiodlp n ieilt sDtaxro;o1oet if3taslsDrmnvs;(0 rxrmr3tatomt aieol(0 rxr(o iy4ap  miesltf rtmxro;u1oltoif3ilsfs uauvo t4aetoxf3tatoa r i ols sexr(o3iy1lp e fvtatfartrx onu0oleoif3ildla2ua(vo u) rtrmoctadlmDelieolt0t2umim3io4alen fcils)srtaumont4tlxoif3tys m2ea(msn(4alxrxo3iodlpt lnvslt tetmio3iu1om n feilt sDrr(m ;o4tle mi3tlsfm elnvp;(4trxoxocootfatrlneol(0srtmxr3oy4llt mivtl(  rurx ooo4opxn o3tysfmDeau p;t4aetnif oytlm  lnes ()trumiopny4lmt mivslsf rur(rpoo1ole mfctyslm2umn ont4 renxo3iytfpDelivils)tetr(mpou1lmee icsl(fsDrr(ronu4oeeomoetatfmDrauvsnu)artrirctydfatrau s;(0 2tmxm3io1oleemics t  rtrum ;u1ope  octls aDelnvsn()trxrir3ia1oat aivils)t2toxmpnudll  lncilt)arraxrpoo4oexnmo3ild mDeaums;t4 eeoioctotlmtrluvo (  etr(r3oo1al emncsat) 2raum ;t4apx iiciyd s2ranvsnt4 etnmo oytfaDe nei;( s2toio no4lm  mivi sf 2urxrpno0opxoiociasls2ulumo;(4artnxr to1latr ueil( s2uoxr3oydom nmieiat srraxroou1aee  oeiat m rlumonu)aexnir3totom  aieo () rur(r nudlmtelnciasfsrra( ont4oexo ieiat s2el( o u0alxniocoy1oa ean o () exoir3nydalee fvtlt)a2rmu ono1opxo f3tad m uln p t4tetnmocio1fmt ai ols0s2tmxmpiu4op   ivilt) Dta(ro;t4alxoif3tadfmDeln snt0 eenxociatlptr ueo;s0 2uoim oy4olt  fesl() rtmu poo0alenmfeiltlm2uaumo;(0alxrir iotfpteauvsl(  etm(m3iodomtelnvtlsfaDua(m ou0aetn o3tydls2um(ms;u)tlxomo3tydla eli s;s s2trim iu4ap elfvia(f Drr(mp;t0aexo fetatla2uaumsnt4 lxoxrcia1fatr u s;(0t2trio3iudol nlnciat) rumxront4altomocildfm ea(vo t4tetoio todoateaies ()t2uo(rpoo4lm elivi sfsrrm(  nt1oleomociadfaDrlu s (0 ltnif3tatop r ieo t)trxoxr ou4lmeemnvilsfaDurx ont4alxoiociatlaDrlnvo;(4 lxrmr3ta1lmt aieolt trxoxrpiy1lm  lfcsls)srua(mpno1aptomi3tyd a raump u4 ltoxr3oydlp eau o s0trto(rpoo4om elictasf 2uaurpnu0teenioeiyt aDrl(mon(0aeenioctatlatr ivo ( s2xo(mpnodap n net ()srua( o;o1altnmfctys a ul( onu4teerirciadomtrluvi t trum(m no4lle mncta(farrm(rp;t4texnmietlsfmDua( p t)arxrir3iotfmDelieo;t srtmxm3oo4ape lnvsl(fsrrmxmoou1aptn fetlt mDraumsnu0 ltnio3iydomte ueo s0srumxo3ny4alenlictas) 2ua( oou1alt  i3iydfmDum( o;u0tetrmf3tytlmtr nvol(0 rxo(mpiodlmt  net t  rua(rpnu4tltnmociyd mDum(vp;u4artoxo3ia1laD lu i;( srumirpnu4ap emictat  ruaurp;o1aexnif3ilt aDrmuvp u0 lerxr3oy1lmDeluei t0 2tm(r oy4om nlivt (farua(m ot1ape ifciltls2rm(mo t4tetnxr tadom r ues s)srurxopoudlm e fvt sfs2umxr nu4aee moeild aDrln pn(4artrir tatoptrau ils0tetrimpoy1llt lnes t s2um( pot4tlxomfctls m eanms;t4 rtoir oy1om  an slt) rxmir iu4alee ncs sf 2tau  no1tpt mo3tldlmDrl(mp;t) ltomr3tatfptranvo;t0 eum(rpoodll elnesl() Dumxro;t4opt  feiyt a eanms;u) eenircoy1oatrliei;s trxrio3nu4lpee neils) rurx ont0oleomieiyslsDea(vs;()altrxo iadomDean ols)trxrxo3io4ole mfcslt) ruaurp;u4teto ocias mDum( o;(4trxnxo tadoptrlies s0t2uoxopio4amen fesltfsruaxmoot4tpx  fetyd aDrln s;t)trerxo3oodfmDrli i;( setrxmpou1lmeelncsl(  2umu pno4aeeo f3iaslmDuaumpnu) rermr iytfmt aivsl() rtoiopiu4om  lnviat)aDtru p;u0aee  f3iaslaDrlumon()tlxrxrcoadlatranvo;s0 2xo(mpiodom n ivsls s2uaum ot0olxo fctytls2ra( o;t4tlerio ia1lpt livo;s0setoxmpnodllt  nesatfarta(m nt1texnmfctas mDuluvpnt4aexnxr ia1omt lnvsl( setrim nydlm nmnei s  2tau  ;o0tpx  icilt a uauvsnt4arxomf todlmt au s t  2xoxopiudlmtnliet t sruaxmooo4ale  f3ias m ra(vp;u)trxrxoctodoat aivo;s) 2uoxm oy1lm e nvsl( s2rau oou1apeoio3iasfs rmuvpnu)artnir iatfaDr neo;() 2trxr oo4olt mivil()artmum ot1aet mi3iytlaDuan pnu)arxoxr iydopDeai o t t2toxo3iu1ol nlfvsasfsrurump;t1alx  oeiad a uaumo;t4 lxoxfciotfaD  iei;()t2uoio io1am nmfcsl()s2rmxrp;o1opxomictatfs em(vpn(0trerxr3ootlmtrlu s ( t2xr(o iy4lpte nesas)sDurxro;u1apto feiltls uanmp ()texoxfcoodfm eai i () rtmir3oy4ap nlfeslt)a2ta( ooo4alxomf3ildlsDrmn o t)tltrmfciotla r ivo s0t2umiopnu1lm n ivia() rur(r ;t1aetnio3iat m2um(mp u) ltoxo iodoa rauvilt trtm(o nudlmtnlfetas) Durx  ;t1tpeoiocilt s2uaums;(4teenmr3totlp r ueslt) etmirpnu4apenlnvsat) rur( p;u0apxnif3ilslmDran sn() etrxrcta1fm  luvils  euoxo3iu1opee netas) Dua(mpoo1oee  ieiatls2emnmo t4 eeoifcia1fmt an olt s2toxr oydapee fctltfs2ra(mpno1tet  o3tlslaDuauvon(4 lxrmoctadomD  ivolt)sexmxr3ou1lle mnes sf rtrumo;u4tpenio3tld mDrmnmo (0 leoiociotfmDrau sls0s2uoim3ny1amt  ncsls) rtr( oou0texoii3ildlm2em( p;(0 renif oo1fm raieo (0t2xmio ny1ll n feiat srtm( o;t1alt mocildfa ra( p u0 rtoxo ia1fp e uvs t)t2xm(o iodapt mnesasf rtru p;t0tpe mf3ias s eaump (4artoxo iydoaDr ivs;t)teumir3oudol nmiesls  2ta( o;u4optomo3ilslm2eanmsn(0trtoxr3to1fa r uvi t0srtrxr oo4ap  mietltfarrm(rp;t4texoii3iytla2rm( o;u) eenifciatla  lueil( t2xrim3oy1openlfvsl(  rtmx  ;o1oleomf3iad s2eluvs;(4tlxoxf iytfat ln s;(0t2urio3iy1olee nei t) Dum(monu0opeoiociydfsDrlnvs (4 leriocoatop  aies (  eurxr iu1lmen ict s) Duau pou1texniiciasfm2eauvp;u0 rtnxf ia1lmteliei;(0setriopiy1apeelneias) rrmxmpot4ole  oeiytls2uaumon(4 ltoxr oodfp  livs t)s2umxr3nydalt  ieta()aDurumo;t4tpx ioctydfm el( s;u4tlxnxo3tadfpD  i o;s s2toxm3io4am nmnvils) Dur(  nu4tlen fetldlm rmu pnu)arermf3tadfpt  u il(0s2um(r iu1ame lfviltfartrxmoou4opt ii3ilsfm umnvo;()alenio ootopDe n ol(0srur(r oydopeelnctl( s2rmxrpnu1aetomo3iytfm elnms;t0 rtniociodfa  lneil() exoimpiu4aptnmnvta(f rtruro;u4alen ocilsfs eln o;t0tetnif3oydoptrai o s0trtmimpou1am nlnvtls)a2uaxmp;u1texo i3iytfsDumn pnt0arxrmo3tadoat  i s t trtmir iu4om  lieiatfsDta(ronu4tlto f3ils m ra( o;u4arxnir to1laDranvo s0 2tmio iodopt  ici tfsDua(rooo4aleo ietls a ulnmpn(4aleoif3ty1faDrauvs () ruoxm3no1aptemivil(fa2tr( ono1olenif3iadlmDea( pnt0 eenmf3iatopD ln s t setoxo3nu1ap nlfct t aDrm( oot1alxomiciltlm ra(vpnt4 exrmoctodlatrlnvs ()srtm(mpiudlmte fciltf rrrxmpoo4tle iociasfs2um( pn(4areoxrciodfaDr n i;s0 etrim3oy1ale lneil() 2rrurp;o0alx ii3tysfm em( s;u0trtnxfciotfa  aneslt srxoirpnu1optnmivia() rtrxrpou0aeeo feiadla2rmnmon(4alermocoytopD lneo;t t2umio iy4ap   ieiat arururp;t4texomieiyt a2eluvpnu0treoxfcoy1fmtelies t0srumio oo4amtnlics t)arurump;o4opx miciltfs2ulu pnu) lxnxr tadlp e i s;(0trumxo3ny1alt  ictl(f Drau p;u1aexoifeiydfs2ulnmo;(4 exnmr tatlpD luvsl(  2to(rpnydapte fesl( sDrmumooo4apxoiociad m ea(mpnu0 reoxr3ootfp rauesl(0t2xoirpnydalen ivias srururoou4teeoii3iys a2uln p u4alxoxo iydfpteaneo (0srxm(mpny1om e ivi s  rurxroot4tpxo o3tas m2uaums;u4 ltrmocoy1oa eaies s t2urxr3oy1op elietltf 2taxm ot0oleoioeiadfa2rau o u4teeoxo3oatom rlnvil( setr(m ou1lptnmfeias)srta(  ot1oet  fciytlsDulnvp (4 renmf iydlaDelnvs t seuo(o3iudalte ncil() rtmxm ;t1tltoioctld a ean onu4 ltoxrciy1lpDrln ols0texr(mpoodapeelnvsat)arrau pnt1tpxn f3iltla emu p;(4aexrxr3oadoa rlivo;s) 2to(mpny4omenmies (faDtmumpot1oetniociatfaDea(msnt)arxoxr iadfa rlu olt0 exrim iy1om elnetas)aDtm(mo;u0altomfciasfs emu s;(4 rerxrcto1la e u s t)t2uoimpoodal  lfct s s2urxrpnt4tleo oeiyd m2ul( p (4tetrifciydlm   n i (  2ur(m ou4ap emictls)aDtm(moot1tetoifciyslaDelumpnt)altnxrcio1lmDr uei s srtrio3ny4om  lietls  Dra(m nu0aeen fcildfmDrmu ont0altnxr oytop  lies s) rto(m iy1am nlnctlsfsDrmxmpno4apx  i3iadlaDemnvo;t)artoif3oa1fa  anvi;s0t2umxo oy1apte iciat)srrrumoot0tptniociat s2ean snt0 exnioctodlmtr ueols0 2uoimpiy1lm n nvt sf Dtrxmoot1olx iictydlmDel(mon(0trxrxr oa1faDrau s s)trum(o3oo4oltnlfctlt s2tm(r no1open i3tat s eanvp t0 leomo iotomt anvs () ruoxm3ny1lmtemivi s)arurxmpno4aeeoifeiatfs uanvo (0 ltriocto1fp  lnvi;(0setoxrpoy1am n netatf Dumumpoo0aex io3iysfs2emnvs;t4aexnmrciotlat liei (0s2umimpnudolt mfci sfarrrxr no1altoiieiysla uan p (0trtnmr3ootfatelivil(  2xm(opnu1lmt lietat  2ra(m ;u1alt iietysfm2rluvsnu4alerif3tydop elu o s  exm(o3ny4ome lfesls arrm( p;u4tltn icilsfmDeln o;t0 exoioctatomDeaueo;s0t2toiopoo1lp n fcslsf 2tmxm nu0oltnmf3iltla2em(vp (4artoio todlmte nes;s0 rtoimpnu1ale  fcs t sDuax  nu4ape mi3iasfs2raums t4 lerxfciy1oaD  nes (0s2toio nydapeemfvtl()sDur(mooo1tpenmi3iaslsDeln pn(4 lxnxr todlmDrln o s  euo(r3ou4omte icsa()s2tm( p;t1oexoifeilt s eaump;t0treoir3ta1oa  au o;()trumiopnudoltelfesasfsrtaur nu4alen ictydfsDran pnu4tlermf3oo1lpt ai s s  euoxm3iydlmtnmivtls)sDra(ro;t4oeeoio3iydfaDeanvs u0alerxrctytlm rlivo;t s2tm(rpnydop  mnetls) Dtr(ro;t4aee if3tlsfmDranmsnu)aetrmf3oy1lm ranvs;() rumxr3no4apt lnesltfaDrr(  ;u1opxnmietadfaDuanmp;(4arxoxr3tatopDraivo (0texrio3iodlpenlnctl(  Dtrumo;o1aeenii3iltls2uan p t0altoxf io1fpt luvsl(0teurim3oodlp emfvsl( aDtm( poo0oltn ieiatlmDel(mp (0alerio3iatoa e uvolt)truo(m oo1lmte fci s aDrmxm ;t0apeo fctydlsDuanvp (0alenifcoytlmD lnvilt s2toiopoudlpenliesatfsrtaxr ;u0aexn oetyd m ul(vo;u0tlerxo3to1fpte iei;(0srxo(opny1am elfci tf ruru ono1aeen fctas sDumums t0alenif iy1laDe iei;t) 2xo(o nydllt mictl( aDrrumo;t0teenmoeiltfa2rmumon() rxnif oatoa  lu slt)srxo(opoo4lp nlnvtat  Drr(mo;t1aleo o3iaslmDea( s u0tetnmfciodoaDr i i;t)t2xmim3io1lpt mnei s  2tr(m ;u4altn feiadfm2ul( sn(4 etrmrctatfpDr n i ( t2urio3oudomen fetl() rrrxmpno1texomfctasfs2um( p;u) etrmr3iotla rau i;s  2xrxrpiu1lp nlicsl()s2trur no4tlx  oetatfs2rl(vp (4tlxomf iotopDe i i t) etmimpoydopte ivslt  2urx p;u4opt  oeiad s ra(ms;u4 exomf iydlaDrlieo;t srtrir oudapen iesatfsrrmxm ;o0opxoif3iadfs um(mp u4 reoxo3totop rlieolt0texo(opiodopen neil(fs2tau  nu1aetnmfciydls2ulnms;u4 rtoio3iotlm elnvs s) rtoxo nudlm e fes (fsrumxrp;u0ope mi3iasls em(mp;() lxriocia1lat auvslt0s2toimpoudop e feiltfa2ua(rpot0apenioeiadfa umn pnt)aexrir to1op e n i;s)t2uoir iudllen ncsl()arraxm ou0tpenmociasla2uanmon(0 etrmr oydoatrlivs;t0 2to(r oodapen nei ( a2rmu pnt0oleo f3tad s2rmnmo u)trtnmf3iatfaDrlnvi;s0trtmir3nodlp nlfctls aDra(rp;t0tle mfciyd sDeaumo;(0artnirciadoateaueol(0 2xoxmpno1al emfvi ( s2rrx  nu1tex mieildfm2uan s;(4tlerifciatlpD  ies s0 rtmio3no4lm elieta()a2rrx o;t0altnifeiydlm uanvs;t)teenioctotfptrlnesls)t2umxo oo4apte neiat)a2taur ;t1tltn feiysla emuvs;(0 eenxo3tytfp   nes;s) exmxo3no4lm  mneta(  Dtrumpnu1oetn o3tldlm umu p;() lermr3tydlptr uvs;t) 2ur(opoudlptemicslt)s2ta(moou0oex  feild s eluvsn(4tltrircoydom  lu i s0srxmim nydaltnlfcias  rraxr ;u0tex mociasfaDeaumpnu4areoio3totlm rlu i s  rxrir3nydal e ieia() Duru oou0ape mietytfmDrmnms;()treoxr3ty1lmtrlivs;s)srtmxo3iudop n ivslsf rra(mpno1tptomf3ias m ranvo () rerxf3tadoa eauei s teto(o iu1om elncs sf 2tmx o;u1optnioeiad aDeluvp u0artnirctotlpteln i ()s2trimpiudomee fes tfartrxr ou4aetn oeils a em(vo ()aleoxr ty1opteaieo (0 exmimpnu1opt mnetat) Dur(moou4tpenmieiys aDrauvp;u4trxomociatoptrlnei;s)s2urxm3io1op n iesas  2taxm nu4tpe mfeiltla ulump u0 rxrxfcoa1fptelneo t) rxmxm no1lm e fvta(  Dtm(rp;u0ope  i3iat m2ua(vo;t4 etnxocoodomteaieo;s)s2umim3nydopt mfvsa(f 2tr(r ou4tle mieiasfs2elnms;t0altoio3oodfmD ln i (0 exrxm nu4llenmnetasfaDum(m ;t1tlxoii3tytfa ul(vs (0trtrio3iytla  au ol( srtr(rpoy4amt livs ()a2umxmonu0oltomi3ildfaDrlnmpnt0tetomf3iy1opt  i s s s2uoim3oo1apt mnctlsf rumxmooo0aetnmfeiyd mDul( p;u4 exoxo3iy1lp  livo;t0setoxr3ou4ope mfvslsf Duaxm ;t1opx mo3iasfm rm(vo;(0trtomfcty1lpte ues;s0t2xmir3iodame mnei ( arrr(mo;o1apxnmfciytlaDel(vo;(4tlenio3ta1lptrlivs;t) exm(opoy4optelfeias  rumxmpno0texn ociytfs2rmu onu0 lerxr3ia1op   iei;()setr(m3nudll nlnvs ( a2ur(rp;t4tet io3tadlsDrmu p;u) rermf oydfaD  nei t) rxmimpiu4lp emnviasf rra(root4opx iicils mDrm( pn(0tltoifcty1omt  i i ( trxrim3no4llenmfvi sfs2tr(mont0tle mi3tls a ea(vs;t)teermo3oatfa raiei (0 rtr(r iudope lietasf 2rmxm ;t4tee ifctyd a el(mo;u)altoir iodopteai slt0 2xoxr3no1llt mfesa() rurur oo4teto ociydla2ulnvp;t)arenif oatlpt lueol( tetoirpnydomt  nei t)sDurur ;t4apt mf3tydlm elnvo u4alxrxrcoo1lmtraueils srxm(o3iudlm elfetl() rtr(r no4aexn ictyt sDrluvs;u0trtomoctotomteluvo;t0srtmxmpoodlm emncilsf rurx pno1alt iiciyd s rm(mo;() etnmr iydfaDeai o;s)t2umir oy4lpen fcs sf rra( ooo4teenmociltlsDel(mo u4trxnxo3iodoa r i slt0tetmxo no1opt mnvilt) Drmx  no4opt mi3tltlsDrmu o t) lermr iytfaDranes;t0s2umirpnudal nlncsa(  2rrur nu4ope mociyd a2rlnmpnt0aexnxocoytomtranes;s)t2xriopiu4llee ictlt a2ta( p;t4aexo ictld m2umump;t4 rxrif oy1laDr nvsls)s2toxm iu1alt mietlt)s2taur ;t0opxoii3tatlsDrlnmo;(0treoifciotfaDr ueo;(  rurir oodope mnesa( a2rm(rooo1aexomieils m emu o;(0alxrmf ootlpD  u s;s)t2tmirpiu4openlnetat sDua( p;t0optoif3ildlm uanms;u) ltomf iytom  ln i;s)srtrxrpoy4lp e iesl(f 2tr( onu4olto oeiydla2uau p;() rerxr3to1omDelnei t)t2trxr3nu1amenlfes () 2uaxm ;t1olx ioeiydls em( pnu)tltoif oa1fmD au ol()setr(mpno1ome  fes s)aDtm(m oo4altn o3tyd s el(vpn(4 exnxf iytfaDr u o;s)trurimpoydolt mfesat)s2tm(  nu0tleo o3iysfs2ra(vp;(4tltoio ty1lmDrluvo s t2uoiopoy1lpt lnvi (fa2ur(m oo4tet mf3iydfaDrmuvsn(0 ltoxr3io1omDelivilt teur(mpnudopeemnct tfs2ra(rpou4apxnio3iatfa2ran o u4 rerifcoadlpDeanvo;s0srxoir oy4amtemfesat aDrmu ont1tpxoif3iytlsDulnvo;u0 renmo3totopt li o;(0srxoxr3io4llenmiesa( a2ur( pnu4tpe  ieiat s2um( p u) exnir3ia1lpD an s;() etoxrpiy1lpenmnet t) Durx o;o4ape mfctyd a2umums;u4arxrmf3iytfp  auvols)s2xr(mpoy1ole mnvs (  Drr(mooo1oetoif3iydfsDran o u0trerxf oa1oa rluvil()setrir ny4lltnmicil(faDur(  nu4apen ieiltfs rauvp t0 rxomf3iatom rlies;( t2trir3no4omee nviat)artaumpoo4aet if3iat mDrau p u)arerxr todlpt anvilt0 rumxmpiudll e nes t sDraxmo;u0apt iiciltlsDemnmp u)alxrir ia1fateauesls)teum(o ou1ope lnvi s)s2rmu  no1oet  ieiad s umnms;u) rtrmo io1fa  livs;t) rum(r ou1lmtelivt tfsDua(moot0tlt mf3tysfa2rl( s;u0tetnifciatom  li slt) rxr(mpny4al  mici t aDrmx onu1tlx iieiaslmDel(mp t) leomocta1oaDr uei ( setrim3iydlp n net t) Dta(mont1tptoio3ils m umn s ()trxoxocty1oateaueil()trto(r oodom e fvt s a2rmu ono4alenifcilt m uln onu0 rxoxocoytomtrlneo s0 2uoxr3oodllt  iet t) 2ra(rpnu1texomo3iltfsDemnmp t) lxoxo3iy1laDeaueols0trur(r3nydome mncsatf 2tr(root0olto i3iydlm2elnms t) rtnmo3oatopt li s ( texoxopou1opee fvilsf Dtmu o;u4ale mfeiyt mDuaumo u)teenmfcia1opDrli sls) rxoio3oo1omenmneil() rrrxm nt0aeeo ietad s2ulnmpnt0teeoxf3ia1lp   i i (0s2uoim3ny4ape  ncslt)a2rru  no1alx  ieiatfs2eau snu4arenxo iatomt lieo;s s2tmxrpiudopenmicil()s2ur(r ;o1oleoif3ildlmDuauvo t0trxoio3tatla   ivolt)seuoxo3iydllt  ies t)arumxmo;o4apxo oeiltlmDemnvs (0altnmocia1lat liei;(0trurxopnudomen iviat s2ur(  oo0olt ifctld sDrau p;(4trxrircia1fatelueo;s0 exrimpnu1lm e fctas srtmxrp;o1alxoiiciatlaDrmn pnt4arxoif3ty1lp e nvi;()texm(o3iu4al nmnet s  Drm(  ou1oexnioetasfs2umuvsnu4aexrir totom   ivolt)s2xmir3iu1ll emictas aDur(monu1oee  ieiadfs2emn o u0texrxfcto1laDran olt  exm(o3nu1lm   netatfarra(roou4ole ifeildfsDra(mp;()alenmocoa1omDelnvi;s0t2trxr3io1lmt micsa(fsDur(rpot4aex mfcilsla rm(ms;t4 rtrio3oytlpDrau o;t  rur(o3iy4alte ivi t) rraumpnu1opeoifciyd sDrlums;(0 lerif3tytlateanvils)s2trir3io4ll emnetat s2rrxro;o4tpx mieildfa2emn p;u) exnxr oa1fa r u i s0 2urxopnydlmenmivtatfartm( pno4oee  oeiatla eauvo;t) rxoir3ia1fp r n s t seto(m iydope lncilt) Dtaxr ot1aetoii3tysfa2rluvp ()aexomrciydlpD  nvo (0 eumirpno1optemfcsa(  2ua(roou4apx mietadls rau s;t4 rtnio iotfpDrauvo t)sexo(m io4lmen nvias) 2uax o;o1tpe mfciatlm raumo;u)aetoxf3oodlate u olt0 ruoirpou4altemfvsas s2rr( o;u0tpe  i3iytlm eau p ()trxoif3iydlat lnes t  exmio iy4ll elfci t)a2trxroot4tptn o3ildls2emumo;t4aeenxf ootfptr ivi;t) 2toxo iydam nlnesatfa2rrx o;o4oexoif3tldls ul(mpnt4trxnxrctotomtelnvi t) 2xoirpio1amenmfcs () Duaxrpnu0aexnmfctydfmDra(vp;u4tetrir ootfpDelueo (0truo(o3oo1amenmnvias  Drmxm ;o0alxo ictlslm ra( o t4 renxf io1lm eai o;(0 2tmio3iudalt  ieslsfaruaum nu1tlto ociyd mDran s u) exnmfcoa1omD ln i;s0trxr(m3iy4ome mfvt tfs2trurp;t1ole  f3ilsla2rluvs;t) eenif iotoaDeanvo;s0seuoxo nodlltn nesl(farumu  ou0tpt  fciat a2rm(mo u0 etnif3iydoatrluvs t)setmxo3ou4optemfctat sDuaur ;t4alen ietld aDum(msn(0 ltrxr3ootfat  nvi;( trxrxrpiydlmenmicsasfa2tmxmo;t0alto iciyt m rlnvo t0alermo oy1oateaivol()t2trxm3nu4optn iesls) Drru o;o1aex  fetydfm ran s (4 reoirctotomte u ols)srum(r3ny4aptelfci t)sDurxro;u4tpxoioeilt aDel(vs;()alxrmo ootopteauvol()tetmio iu4oltnlfvsat srtm(mp;o0oetnmicildlaDuanmsnu0aetoxr iy1fa rli ilt seuo(r3nu1olt  icslsfaDtmur no1aexnmoeiysfa um( s;u0tetrxr tytlm eai s t  ruoxr3oo4optemici t)s2tauro;t1altn iciytlm2eauvpnt) etoioctydomt anvi;( setr(o oydap nmieilt)s2uau ono0oltn i3tatla rauvs ()arenmf3iodlate u o;s0 rtrxo iodap elivsls)s2urx onu4tpxoioetldfa2em( s t)trtrxfcoytfaD  uvs;t t2toxr oo1lp  lnetat)s2rmuronu1apxn f3tadls2uln ont)altrif iytla r u i;s)s2xmiopoydlp n ivtls)arraxm no1tpxo i3tyt mDrau p t) rerxr todlm   ues s0t2toirpoy4altn ivi (fs2ra(rpno0teen ociadfmDel( ont0trtnio3iytlmDr uvi (  exm(r3ny1llte nesat  2raum ;o1apeoio3ildls rluvp t0aeenxf iydom rlnes;t seumim io1ame lncsl()s2trum oo0tptoiociltlmDelumon() exomf tydomDrau i;s)texr(o3iy4lpte ivi ()aDurumoot1tpxo ictytfs2rlnmp () etomfctatfptr nei t0 2umio3oodlm  mfcslt)s2tmurpoo0tlx mocils a2eluvo;u)aetoirctytoa r n s;( trurir3ny4openlfvtls) Durum no0tpx iocilt a ranms;t)tlxoxr iodlmD livo;t) 2uoir io1lmte ivt ( arrmurp;t4oetomicils sDrmn snt4 eeoio iy1opD ai s;(  2tr(r io4ole mfet ()sruaurpou4oetoifeiadfs rm( onu0aeenxf3oodlatr nvo s) 2toxm iodale miesa()arum(ro;o1aexoiociatfa2rm( s u) ltoif3todopDrluvi;t) exrir oydoltnlfet t) Dua( pot4tpxnmiciytfsDem(vo (0texrxr ia1oaD  u o;() 2uoir3oydom nlicslt  rrau  nt0ope mfeiadfa uanms;() ltoir iytoptrlivsls)t2xmio oo1ap nmncil() rraur ot4opxniieiatfs rlu s t4tltrif3ootlpt  neo t0tetr(mpou1amen ieilt sDrr(rp;o4aptn oeiytla2umn p (0 lxnmf ia1la rai ilt texr(o oo4olt lnctas) rrmx p;u0optnmfciasfmDrlnvp (4trxnir3io1lmteai i t texrir3iu1amenmnct s)aDtrxm oo4open i3iyslaDra( s t4trxomf3iydoaDe u i;t)t2umimpny4ole  fcslsf Drrurpno0oleo feiyt aDemump t) etnxf iadom e uvs (0 exo(rpoo4lm emncsa( arur( oot0tlxo i3tytfaDumu o;() rxrmr3ty1fa elu i t0trxr(mpiudlptelfctas) 2tmx poo1apeo o3iad a rm(vs;t0texoxo oy1laDe ivo;t)texmiopoodom  liet s arurur ;o4aeenif3tydfmDuln s;u)tleoxr io1fpDelueo;()teto(o3iu4omtnmfet t)sDtm(mont1texnif3iyt s2eanmpn(4aetrmf iy1lm e u sl( t2xr(o no1opt lies (  rtm(ro;t4oleo oetytlm2el(mo u4alxnxocia1lpDeli olt0t2trxopnydaptnmfctas s2tmx p;o0tee mietytfmDumn s;t4 rxrmr oadom  lieo t t2tmxm oudameelies t)sDtmx  no1tlxnif3iytfa umnvo u0tlerifctotfmte uvol(0tetrim iydalt micsat)aDum(r nu0oetniicild m ranms;(4aeeoio3oadfptranes s) rto(opiu4lmeemnvs t)s2tauro;u4oleo ociad mDumnmo;u0altrmo ta1oaDeauvolt s2um(o iu1alt lncsa( srta(r nu0ape mi3ild sDrau s;t4alxnmf3to1omD aneo;s s2xmir iydome mneiasfarta(rpot0opxn o3iydfmDrluvo;(4trxrio oo1faDe i o t)seumxr3no4olt  iesl()sDtaxroou4aex moeiytfaDem(vonu4 lerifcty1fat  neo s0 2uoxopio1lp nlnvs sfaDta( p;u1opt  f3ilt mDeln s u0alxrxr3oytfptrlnes;t0truoxrpio4lm   nvsat) Dtrurpou1aeto o3iys s2rmuvo ()arxrmrcoytfatrlieils) eto(r oy1opt lieiasfsrtm(m nu4alxnioeiydls2ul( s t4 reriocoa1lpDe ivsl( s2urimpiy1opt  nvil(f Dta(r ;u0ole  ociatlsDeluvs;(0tlxoio3iydfaD lieo (0t2trxr no4amtn ncsas)sDtr( oou0oetn o3iltlm2rm(ms u) rxoif oo1om elivols0seuoiopnydoltn fcs ( srraxmoou4tee io3ildfm rmu snt) exnmrcio1lmDeai slt0tetoxrpnydlpt  fctas artr(  oo4oeeo oeias sDumuvp;() ltrxo tydfa eai s s  rurxr3nudlptnlivi (f 2raxm ou4aptniiciytlaDrm( p (4 exrxo todoat  ues;()t2xmxmpnudaptnliei tfaDrmuront4tpxnmociys sDrl(msnu)alxnmf iatlatraneolt0texoir io1lmtnlncils s2trxmpno4oeen f3iysfaDeaump;t4teeoirctodfaDr uvsls setrxo3ou4om   ics (fsrrr( pno1aeenmfciatfmDumnmsn(4 leoio ta1lpDrluvi;t0texrim3no1apen fetatfartmumoot4tet  i3iadlmDum(ms t4tetnxr3iadomt  ieil(0setm(m nu4aptnlncsl()aDta(ront0tpxo f3iasla emuvsnu0alerir iydop rlu ils  exriopoudoltn ncia()srraxmooo1aetnmociytla2rmu s;(4trxoxo3ootoa rlueo;t0srtoio3nu4amtnlici t  2tmxr ;o0ole ioeild sDrau snu) renxfcoa1fmt anvi ()sexmim3no4lpeelneil(f rtmx pno4tet ifciadfs ranmpn(4texnmf oytfpDraies;t  2xmio3iu1ol  mnci (  Drau p;t0tet mfeiasfmDel(mp;(4tltnircoydlpt  i o t)trxoim3oo1op   nvs (faDumumpoo0aexo o3iydfs emuvonu0 rxrif iatomtran i;t)srumim no4olenlnvt t aDur(  ;u0aeeomieiysls2uanms t0 rxoxo ootfmtrlnes t trtr(m iy1ap elivi (fs2ra(  nu1tlen octltfa um(vp ()trxrmfcoatfpt an o ( t2xmxr nu1am  mietls)sruaurpou1opxn ictltfsDumnvp (4arenmocto1oat lues;t)sexm(r3oo4om emfciat) 2rmxrooo0aeeoif3ilsfaDua(ms ()tltnxf3ia1fmD aivsl(0 eurio3ny1ll nmneils)srrr(m ;o0olt iiciasfmDem(vs u) rermrcto1oa   uvi;t)trxrxm3ny4llt mfesl( arrruro;u4tle mi3tlt sDranvs t4altrif3totopD  ivi;() 2umxopno1omtnlics (fa2ur(  nt1apeoifcilsfsDul( s;u0 exoir3tadlptrlneo t0t2toir3nu4omeemnctlt  rurur ;o4tptoiiciatfm2uaump;u)areoircoatla   i o;(0 etr(mpiu1lpt lici sfsDumxrpno4optnioetatfa2uln o () etrif ty1fa eli s;() rxrio oodopeemnvi tfs2trxr ot4oex mi3iadfmDua(vs;()aeenmr3ta1op elivo;s setmxo3iudop  lfvil()artmxrpoo4aexn f3tls aDumn pnu0 rxnirctotlat luvi (0s2umxo oodope  ics ()s2rrx p;u1oee mfctlt a2uluvsnu4 reoxocio1om   n slt) rtrxopno1altnlnesl(fartruroou1aetoiieilt m2uaumo;t4texnxf tytlpDeanvi;s0 2toimpno1lp emnetlt) Drr( p;o0alx miciytfsDum(ms t)tleomr oytlm eanvo ( setrxm3ny1ame  ivs () Dtmxm ou4aex mf3iltfa2um( o;(4 rxrmf ta1laDelivi t)t2urxrpiu1lleelivias) rta(r oo4altomfcilt s ranvp;()texriociy1lmt lnvo;t)s2um(o3ou1llee nctas arrru  oo1oltnmfeils s eanvpn(0 rtomr3oy1opt  n sls0seurir oo1lltelici sfa2umuro;t4opxo f3iatfm ua(mpn(0arerxf3todfm   ieo;()t2xrio no1opte ivtl(f 2ur( ont4tpx mo3tlsls uluvp;(0trxoir ia1lm r ivs s0 2umir nydapt mietltf Dtaxrp;t4alxo fciasfm um( p u4texoif oatlmtrlueo;t srxmir3nu4lp  mnesas)arum( o;t4tpto oeiasfs uau pn(4 rxoxoctadom rlneolt0t2umir3oydomeelfctas)aDtau  oo4tpeo o3iatfm rmn p u0 exrxf iydoa  lnvo t0t2trir iy1om  lieiat a2rmxmp;o0tpeoii3tyd s rmuvp (0tetnir iotom e ivsl(  etrxm3iy1lltn ieia(fs2uaump;t0tleomociasfm2em(mo ()artnifcto1opDrlivs t seuoxo3iy1opt  iesl( srumx pno4tex ii3iasls em(mont)aeeniocoytfm   nes t0trum(mpnu4apt  ivs (f Dtr( ont0oltn f3ias s2umu ont4tetrif3todfp  ai i () eumxo nu1ol   ics t srrm(mooo1alx iociltla uluvonu4altoio3totlmt livo s0t2tr(r3ny4lm  mfvtlsf Dtmxr ;t1tpto octasfsDrl(mo;()tetrxr3iadlmte ivi;(0teto(opnu4lptn nvt s)srtmxm ;u0oeeniociltfs2um(mo;()aexoir oy1optelieslt0setrim ou1lltelfetlt srrmxm ;o0oexnmo3tlsla2ra(mp;(4trxnmrciytlmDe n s;s0teurim no1ope lneiat)aDrmu  ot4alxoioctyd a el(vsnu0trtrio3oatfmDe ies;() eur(opiydolt  ieilsfartmxrpnu4tpx mf3tltfm2um(mo;u0aexnmrcoy1opt lu o;s)s2xoirpoy1ll nlnvt (faruax pot4tlx ifctyt a2ua(vont)altnmf3oytfmte uvsl(0texr(rpoodamtnmnetasfarum(  ;u0tex io3tasfm2uanmont)alxrxfcoy1lptran i ( s2tr(r3nu1alenmncs t)sDrrxrpoo0tpxnmfciatfaDua(vsn() eeoif3tydfpDranvo t trum(m iu1alee netas)srrrumooo1alxn fetysfa rluvo;u)artrif ootomte uvil(0sexo(opio1lle lneiatf Drrxrooo1tleomfeilt s2rluvs u4 lxrmfctotlmD aies;t0t2uoimpiy4oltnmieslsfa2tau oot4optoii3iydls2el(vs (0 etomocto1omD  i s t0trur(mpny1lp elfet tfaDua( p;o0oleo o3tldls2uan s;(0tltomr totoa elueils)s2um(m3oy1ll nlict ()artmu  ;o0tpt  oeiyd a2uauvp u)alxnxr oadlmD anvo;t setr(m3nudlmtemncsa() 2ua(root4oeenio3ias m2rlnvo u4 eeomo3todfate i ols)sexmir nu1lp   ivtls)a2umx  oo1alxoii3iytfa2rln s;t0 eeoio3iadlmtranesls sexmxmpnydamt  ies ( arta(monu4tee  octltfaDumnmp;t)artnirctatlmD anesls s2trir ou4am   fcslsf 2urx poo0aetomfeiltfmDrmuvon(4tlxoxf3oadfaDrau s;( trtoxmpiu1oltnlicias)sDumxr nu0altomocilt m eauvs;u0aetrio iydoa  anei s0sruoxm3ou1lm  lfeslt) 2umxm oo0oeeomo3tad s2ul(vont4altrmo ootom ran slt)srtmir oy4op e fet ()aDtrx ont0apxnmoeils sDemn sn(0tleoxrcia1lmD  uvilt) rxr(mpoy4lmtnlivtat  2urxro;o0tlxoioeiltla2rmn s t4 renio iodlm e u s () 2umimpoydlleemncsl( a2tmum ou1oltomoctadla emnms (4tetnmrcoatfp r nvi ()truoiopiodlpt mncsas)s2ra(  ;u0aetomi3iatfs uln ont0tlxoioctatlatrauvi;(0 rxrirpoy4oltelfcs (  rrrxm ;u0tpe mf3ils s2ranvp;t4trxniociotlmteanesls0t2tr(r ou4ome  nvt (fsruru pnu1olenmoeiydfa rlnmsnt0teenif3ootop  li i;s t2uoxopiu1lleemnvta()arrr(roou0opeoio3tysfs uauvsnu) rxomo3oatomteaues;t0srxrxo iy4lle licsatfaruaxm ;u4teenmo3tltlsDrauvs;u)teenxf oodlpD  ivi;s)t2tm(m io1lle mict (fsrua(  oo4tetoiietyd s ranmo u4aexomo3io1lp rauvs t) 2ur(r3io1amt mfcs sfarur( o;t4tlt mfciys s2um(vonu0tetrmr tadfp r u i s) rxrim3nu1oltnmncs ()arumurp;t0tpe ifcias s2umuvo;t0tetnio oatfp  auesls)t2urxrpnodolenlncil()sDurur ;t0tltoif3ildlsDrmnmsn(4areoio io1op eauvo;(0seumxmpno1ap emnetls)sDrmxmont4oet ii3iadfmDrl(ms u0 etrir io1lpteln i s)srum(r iu4lme miviat)s2ua( poo0alt  f3ildlm2umu onu4tleriocoadomD  ueols  2xrxopiu4amenlfvslt)arraxr ;t4aexoif3tldfs rl(mp (0aeerifcoa1lmDr uvslt t2umxr3oodaltnmfcsa(farrm(m ou4oetomoeiadlm ua(vp;t0arxomf3oatlptrau i;(0srum(m ny1altelfciltfsruax pou4tleo f3iat a2ra(vsn(4aeerir totlaD lnei;t0s2toim3ou1lptn fcs s a2uaurpnt4oeeoii3iaslmDeauvs;(4tlxrxo3totom  au i;s0sexoxo3ou4optnmivsl()sDtaurpoo4tltn iciltlaDemums;t4tltrif3iydfm rai o t0t2um(r no1aptn net s)sDrmx pnu4oleoioetys s2rau s u4aeerio oydoa elieols0s2tmxopnudlmeelivt t arua(mo;t0tltn fctldfm2rl( s;(0trxoxfcoa1lmDr ivo s  euoxm3nu1amt  ivia() 2ra(rpnt4optomi3tltfaDea( p;u4alenxo tydfa ean i;( srto(m iydlleelici sfsDuaxr ot0apxomieias a2umn o t0 ltrmf oy1op ranvs;() euoxr oy1oltn fetlt)sruaxr ;u4opxo ictltfs ulu p ()trxomo3iatlaD luei;s srum(m iy4amtemfesas sDumumo;t4oexo fciysfs em( o;u0texrxo3iodop ean ils)srtrxrpoudll  lfctatf ruau ooo1teeoiiciyt sDul(mo;t4 rtrmf3iadla r ivo t)s2tm(r nudolt lfci tf Drau  no0opxnmfciadlm ea(vs ()trtoxrciytfpD lies;t0teto(m ou1ap nlivta( s2rrur ;u4teeoioctysfs2ul(mon(0arxrxo iotopD  nvs;s) rxr(mpoudome livs sfs2ur(mo;t0oetomicils sDelumpnu)arxnxfcty1lm eluvils teuoxm3iodaptemfet t aDtmu ooo0alxn o3ilsfa el( o;u0 exrmo iodoaDelues ()srur(rpio4ol   nctat) Drmxroou4altnmiciydlsDumn o;(0 ltrmo3oatfa e uvolt)s2uoir3oo4amt mivil( sDrau  ;t4opxnmf3tltfm el(vo t0 reomo oy1opD lu i t)srtmirpnodll  mfvtl()sruau pnu1ope iieils a ul(vp t0 etrio to1fa raivo s0setoxo3ny4lpee ieilt sDta(mpou4texoifeiytlm2umu ont0 lxnmo3oa1fat  ues () ruoxr3iu4lp  livilsf Dumumpnt0ole ioctldlm2rmu o t) eerirctatfatrlueo t)tetmxm3oodll e feta(  Drru pno0oltnmo3tltlm2rln ont)tlxnmf oydfp eaiei s0trxo(r3io1altn nesat arrrumono0tpxnifctldls rl(vo t)aeeoxf oatoaDrauvilt seurirpoo1lpeemieta() Dtrxrp;t4tpe  octyd mDelumpnt0tlxomfcoodom e uvs () eurxm iu4al  micsa(f rtm(rpnu0olxn ictat mDeln pnu)trermocoadlpt  uvo t)sruoir io1lm e neslsfsDta( oou1tetn ietydfmDeau o;u4arxrio3tadfpDe ivols sexrxo3oudlm  lfei t)a2tru oou1oex  oeildfm umu o u)teermr iydoateln ilt sexoxo3ny1ap  mfvtasfsrraumonu4ope  o3tatlsDea( p (0 lenif3iotom eaivo (0srxmxo3nodop nlncs s)aDtm(mo;t1olenmo3tydlm ra( s (4artrxr3iotoaDelnvil(0seum(r3nu1omte ivsl()aruau p;u1ole ioctldfm2elump;(4tlxrxocoadoa elues t srtm(m3ou1lp emictls  2rmx pnu0oet ifctysfmDel(mo (0aeenifciodomt luvilt teto(r iudole  fcsa()artax  ou0ale mfetad mDrlumsnu)aetrxfcto1op raivo;s0t2xmxr3ny1ale  neiat sDtmurp;t1apeo o3ilsfm2rau o (0altnxo3iy1lmD luvslt) ruoxmpoy4lp   nvtl( sDrrumo;o1aeeomf3iytlm emnvs t0tlermfcoydopD  u s s)srur(r iu4amtemivslsf Dtm( p;o0aeeniieilsfs2el( on(0trxrirctatla  luei;s)s2xr(m nu4al e ivil() Duauroot0olenmoeiad aDua(vs u4aeenif to1opte i o ( sexoim3iy1opt livtlt)arrau ono1olx mf3ilt mDemnvo;u)aexnmr ta1fat  nvi;() etr(r oo1llenmicsa( aDraxmo;t1altn ociadfsDua(msnu0tltrir3to1fptrluei;s0 rxrirpiudll  mfeias sDtau  ;u1tltnmfctlslsDem( p t4 ltrifctotlmD luvo s)t2xoxr3iu4lltn iviltfsDrm( p;u1apxoifeias m2ul(vp (4altrxf iadfp   nvs;(0 eur(r iy4olte ictat  rrrum ;t0olx mictys m2uanmo u)teeomfciadoa   nvs s) 2tm(mpny1aptnlnvs tfsDrm(rpno4aleomo3tadlmDrl(mp (4 exomf totoa  aneo;(  rtoim oy1altn ieia(  2raxmpou1opxnmoctadls2ul(mp t0aleoxr3oatfaDrlies;t) etrxm3no4lme lieia(  2uaum ou0teto iciatls ea(vp;t0treoxfciytfmDeaneo;(  eur(opnodll nlncias) 2uaxr no4ape mo3iatfs2elumont0 rtnmfctodfpt  ieolt) rxrio3oo4lm nmfctl(  2rrum nt1tltomfeiys s uaums (4 ltnxo3ootom   n s;(0trtrio3nudamt lfviasfarrr(  nu0tle  ietaslaDrmnms;u4tetrio ia1om rauvi;t  2um(opno1amt liet t) rrruront0teeo ictasfaDrmumo u4tetrirctydfpDeai i;(0trtmiopny1opte nci ( srtm(m ;u1olx ioetldlm2elnmo;(0aeeoio io1fpDrlues (0srxmim3io1optn nvtls)aDumu o;o4oexn oetltlaDeanvp t4 leoirctydla eaneo;s0 2xrxr3iy1aleemivsl(f Dta(r nu0opxoiieias s2el(mp;u4 lxnmo3tatlptrlues;t0teurxm3oy4amtnmivtlt)aDua( onu4tet mietyslaDul(vo (0 rxrio oy1lmtrlneo s truo(opny4apeemnvsls srrmxmpoo4olxo ictytls2emnvpnt0tlenmo io1lpteln i ()seuo(r3ny4llte ietat)sDrmxroot4tle mocilslsDulumo t) rxnxf3oytop eaies ()srumiopoydlmt licsltfsruaxrpnu1alxo icilslm2ulumo;u4tlenmociydlaD  ivi;t0 2tmxo ny1amenmncilsfs2rax  nu1teen o3ilsfs ulu s u)texnmfcty1lat  uvolt)s2xr(r3nydlltemnes s)sDtaxmpou0aleo f3ilt sDra(mo t)aexoifcoodfpt  nvils0trxoio3iu1lmeemivsa( aDua(  no1oee ii3tltlm2umn o;u4trtoxo to1laDeluvol(0 2trim oo4lpt  fesat)s2umx  ;o0oexnmo3tatlm rl(vp;(4aexrxfcoy1oate nei ()tetr(m
\ No newline at end of file
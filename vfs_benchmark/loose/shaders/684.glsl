@@ -0,0 +1 @@
+u i t setmxr3iy4lp   fvsas  rrm(rp;o0tee mi3tadfm um( p (4alermr ia1lm eaneslt  2to(r iy4ap   nciltf Duauro;t1ole  o3iysfm2el(mpn() rtnmocty1fpD ai s;s0tetrxo no1lltelicsls) rtrx pou1oeenmi3tld m2em( s (4texnxfciytfa  li slt0teumim3oy1amenmncil() 2tmxmo;u0tetnif3ild a2elu s u0aetrxf3ty1lptean il()texm(o3nu1lmt mfvi s  rraxm oo4tpto fetldla2emums;(0 ltoif ootlmtr u ol( sexoir3nudam nlfes sfaDraump;t0tpt ifeildfm2ranmo (0trxnxr3oydfatrliei (0 2xmxm3iy1olt  fctl(farrru  ou1tpt  f3ild s2eanvs;t0 etoxf3oatlpDrln o () euoxopio1ame miei s  rtr(ronu4oee mfctlt sDum(vo;()artnmr3oytfm e ivslt) 2xr(mpiy1ap nmnctlt s2taumoou0aetnif3tld s2uan s u0 leoio oa1faDeluvo s s2uoxm3ou1llt lfcias  Drmump;t1tpto feiyt m emu o;(4artrio to1lmtelnvs;t  2xr(r iodlp e net ()aDum(mpnu4aexnifeild sDelu s () lxrmf3ta1oa  aieil(0 2umirpnodome mivil( aDrmuroou0tlenifciasfs rm(vp;t0arerio oatfa eaneo s t2trxo3ny1lptemncs sf 2tmu  ;u1opxomf3iltfa2eanvs;() exnmfctytlaDeai o t0t2xm(m iodale  ieilt  rua(r ;o1alenifctasls rm( p;u4 etrmf oydoateaies;t0t2uoim oo4apt lnvs tfa2tru  ;t1tee ioctas s elnvo;u) exrxf3ty1oaDr u ils0 exrimpnu4lpte nvsas) rtr(m oo0aleomiciasfm2elnvsnu0 eenxociodfa r i o t  rtr(r3iudlle lfcs t  Dtaump;u1tee mi3tytlaDrln p;(0arxrmocta1lmDeli s ()teumio iydomt licsls)s2tru p;t1alx io3tytfs2em(vp;u4 eerircootfpD  ivo t)seurio3ny4oltn net ( a2ua(m ou0alt ifciad a2ea(vo (4aeeomr3oatlptrai i;s0s2xr(o oudlptnmneta()srtaxmo;o1ole mieiysfaDul( o () exoxo iy1fp  lies (0teurim3nudapenmnvsls) Durxmoot0tlt  iciltfm emuvont4 eenxfcoatfpD  iei;s  exo(rpiy1apte nes t)arrmurpnu1tlen ieiadfs2ul(mpn(4 rtrxr oy1om  luvs () 2trimpiy1lmtnlneiat) Dtr(rpnt1ape mieiatls2ea(ms;u0trtrif tatoaD auvil()srxmxr nu1lltn ieia( srrm( pou1aeeoiieiys m2ul(ms u) rxoxrcoydlm rau o;t srtm(rpoy1lm n nei s aDra(rooo1oee ifciatfa2ua(ms t4 rxnxociytoaD an i s0texriopoy4llen nvs ( aDurx  ;o4tltnmiciatls2eau pnt) ltomf ootfm  lu i ( setmio3ou4ome  fvsatfa2trx  ;o1oex mi3iaslmDuan o;t)tlenmfcoodomtr nvs t setrxrpio4alt  ivil( a2ra( pou4ole  ieiyd s2umnmp (4aeenxo tadlptr uvs;s)s2urir3oy4op n fesl(f 2taxrpnu4apt io3iasls rmuvo ()tltoxr iadoateau i (  2xriopiy1apeelicia(f 2rmxr ot4tee ii3iasfa2ul( pnt)trtriociadfpt ln s;t0seuoio3io1ol e fvia(  rrax ont4oltnmi3taslm2eln sn() lxnirciotoaDeluvs t)srxo(opiu1lp e fcias)srtm(mp;t1tetnmfetadla elnms (4 etnxo3todomDrln i t)seto(r io4lltnmncs tfs2tmurp;t1optomfciydlsDrm(vo () rxoio tatom elneslt) rxmimpno1lmenmietas)srurxro;t1tpt moeiytla2em(msn(4arxoxr3ta1lpDelueilt0trumxr3oodame mfet tfs2ta(mpoo0texoiiciadlm2ul(vsnt)aeerxf3iytfat an i t0srxoir nodopteliei (faDtr(m ;u4ape ii3tyslmDrmnmsnt0tetrmo tatfm  li ols) rtmim oy4op nmfetasf Dtr(r ;u4apenmoetyt mDel( o ()texnmo3tydomte uvolt t2xr(r3iy4ll   fet t  rrr(  ou1apxn o3tys mDrm(ms t)artnmf oytlatean o s)sexo(m3oo1opt liciat) rumu o;o1oleoifciasfa rln s u4 lermrcty1oaDrlivs ()s2ur(o iodopen netatf Duaur nt0altomfciadlaDrau p t) lxrirciy1lat livs t0 2xoiopnu1ole  fctl()aDtmumo;t1tpe  o3iyd s2um( s t)altoxfcoa1lm  lies s)trurir nudoptemfvsl( srrr(rpoo1aexomoctadfsDemumsnt0tlermo oatlmteai o s sruoxrpoudlp  mfci tf Draur oo4tpxn i3ias sDrmu s () etrmoctadoa r uvs t  exo(m nydole lnei t  rtru p;u4oltn ietadfmDel( sn(0texnmrcoadlm   uvils0t2xmxr3oy1al emncilt s2tm(roou4tpx mi3iltfs ra(ms;()tetnmfcoa1fpDr uei;s t2xrxo3oo4lmeemfcilt sDta(rono1ale mi3iysls2rau s;(4 lxnxr tatoa r ivils0 etr(opnodll n icsat  Drmxrono0tltnmoeiaslm2ra(msn(0trxoxrcoodoaDeanvi;s0trtm(m3iy4lp elietl(fa2rrum oo0alxo i3iadlmDea(mp u0 eenir ty1lat ln i;(0srtm(o nu1omtnlivi s)s2rax  no4apx moctatlm2emnmsnu4altrxrciydfp   ivi;t  ruoxm3no1lptemfetls srta(ro;t0opxnmociysfsDuln s;u0altrmo3iotlmtraivo;t  euoir nodal elnesat sDtax p;t0oetomieiasfm2ea( p t)alxnxf3oatfmDean s;t  etoirpio1lle mieslt  2tr(mono0olenif3tldlm ranmon(0tetnxociydomD luvi (0 rtrio iydam emieiat srtrx oou4oltnmiciytfm ua( o (0 leomrciodfat livsls teurio iy1opeemieta(  2tr(m ot0tlxnioeildlsDra(vonu)aetnxr todlmt lnvs s t2xoxm3oo4optnlfvt sf Dtaurpoo1tetnmi3ias aDeaumpnu)arxrmoctydopD liesl( t2xrxm3nodomtemfvias  2tmxrono0apeoio3iat a2umn p t4arxoircia1fp   ivs ( teuo(m nu4olte feias srrm(  ;u0aleo iciyt aDranmsnu4aexnxo3oa1lat aieols)setrimpou1lpt lfcs sf 2trx pou0olt mieiyt a rl(vo u)arxnmocoa1lptrlivs;()srurimpnu1ol  mfvtl(  Dtax pnt1aetomf3iyt m umuvp t4trtrmfcty1fa eliesls0t2um(opnydol n fvil( s2rm(rono4optnio3iysfa uauvont4 exnmfctydlmteaivs;t trxo(r3no1lmenmies tfs2rmuroou1open iciasfaDuanvpnu)teenir3tatfmDr ues;( s2ur(r oy4ol elneiat)s2umu  no0tpen ieiltlmDemumo;t)texrir3iodfpteai ols trurxopiy1ol n iet t)sruaxmont4teeniiciyd m uau pn()alxrirctodomDrauvs;( srxrio iy4llt lfcs ()s2rmumpoo0optn f3ildls2ul( s () lermf todlpte n i;s)texrim iu4lptelfvt s a2rru o;u4tlxnif3ils a2ulnms (0tltnircta1lpDeaivsl(  etrxm iodame  ieia(f Dtruront4tpenmfetydfa2eluvsnu) lxnxo3tytoaD  ieils seurxm3iodapee netasf Dta(rpot4altnifeiadlaDemumsnu0trenmo io1omDeli sls) eto(opoy4lp emfvtlt)a2rm(mo;o4tlen fctys s2rau snt4aeeoir iotoatelu i;s)s2uoir no4lpeelfvs sf Dua( pot1tlenioetlsfs rm(mp;u4artnirciodopDeai slt  etm(o3oo1ol nmnesls)arrrxront0tltoifciasfaDrmuvo t) ltoifcta1fp  anei;()s2tmxopoo1lp   nvilsfa2tr(r ;t1tpeo oetyt s elnvonu0 lxnxfcoo1laDelnes s)texr(opno4altemicia(fsrtm(r ou4tpt  feiatls2rlnvp;t) eerxoctadlmDrlieo (0 exoim3nudolenlfeil() Dum(rp;o0tlt  oeiltlmDum( s;u0aetnmf3ty1lmtr i i t)texmiopou4lpt lfeias)s2uaur oo0opx  fctlt m uauvpn(0aeeomo3todoa e ies;(  rumxo nudalenmfvs (fsrtaur oo0ope if3tasfmDuln snt)trenir ty1fmtr n sl() rur(rpiy4ll emnvsat)arraumpoo1opto feiydfsDelumsn(4 eeomoctytfmtrluvi (  2xoxrpiy1al n nesa( a2ua(r ;o4alt  i3tydla uln snt)arxrio todfp rliei;t  2xm(rpoo4ap nmics sfsDrruroou0altomicildlaDuln snt)aexoif oodoaDrli ols  etoir3oy1am   fvtat)sDur(m no4tlx ifetldfaDrl(vsn(4tetoir3todopD lieol(0 exrxr nudom  lnvsls) rurumooo0tpeoifeiat a um( pnu) eeomociodomtraivi;(0srurio iy4ol n fei sfa2rmu p;o0ope mfetlsfm2rluvpnu0tetnio tytoaD ai s;t0texr(opou1ap  mivta()aDrm( o;o4apx iieiasfa ranvo;(4 lerxr3oy1lmte nvi t)srum(r3oy4ap nmicil(  rrr(r ou4teeniictys sDemnvs t4aetoir3ia1opDrau o;t srxrir oo1lpen fes ( sDrru o;o4apenii3iadfs rmumpnu)aetrioctodlp rlu ilt)s2xm(rpny1ame mnvtltf Drrumpno1tpx mocild a um(vp;t4trtnxr ty1oaD an ol(0texr(mpoydop nlfesa() rta(  ;t4oltomiciysfm2ean pnu0tltrmociatlm   neils0texoir iu1ape mivtl( aruru onu4tlt mi3ilt mDeanms;(4treomrctytlptr nvi;s) rxrxrpou4llt  feia(f rumum ;o4aptnmo3ildfm2um( pn(4alxoirciatfpDrauesl()trtoxo3iudalenmnvtlt)srrr(ro;t0apen f3tls s uau pn() leomociadom   ieil()setrxm3oy4ome mncia(fa2rrur no1tetomietldfa2rau s t0 lxnxociatfat  u i s)s2tm(rpny4op e nvtls) Dtmx p;u4apx mf3tad aDeanvs;() rxnxo iadlpDe ivo;s)t2trxopiodaptelneta(f 2rrump;o1oetnmieiltla2eaums;u0arxrmf3iydlp  anesls s2umirpiodamte fcsa()srrmx o;t4olxomo3iytfaDrm(vp;(0 lenxr3iadopDe i s;t) etrirpiy4lp nmneils  rumu o;o0opxn i3iytlmDea(vo;t)altrxf oa1om e n ols srurxopny4oltnmnvia( arrrx pot1tpx mocilslsDrm( o;t0teenxo3oodoaD  nvo;t sexmxm3no1lpte ivi tf Dumxronu1alxnmfeiltfsDea(ms u4 rermo tytomt  ivi s0setrxo3iy4opte fvi sf 2raxrpot0apeoii3iytfa2raumonu0 rtnmr3iydlp raueo;()srurirpny4al emnvi t sDtrx onu0oltnifeilsls2uanmpnu0 rerir3ootlpte nesls)s2xoir oydalt lfeia(  Dtmurooo4aetnioeils sDum( onu0artomr3io1fmtrlivs;t0s2toio ou4amt  feias)srtm(  ;t0tlto fciadls ea( s t0trxnirctodopDe nvo t t2tm(m3iu4lm e fvias a2um(m ou4olx ifctysla2emn snu) ltomr oydfateaueols teum(opiu1lpeemfcils sDumxmonu0tptomfciltlmDranmo;()aetomociy1la  aivs s  eumxm3oudole  fesat)artrxm ou4ape  ietld s2elnmo;(4 rermr3ia1fmtrauvs s)teuoim io1apeelivsa(fsDur(rp;t0olto ictatfs2rmn o;u0texrir3ta1lateanes;(0s2xriopoudll  lfcsas)s2ta(mpno0aeeoii3iyd s2rlnmo (0texnmr tydlpD lies (0t2xmim ou4ll nmiet s a2uaxroot4oleomi3tadfa2el( o;u)aeeomo3iatlaD  u s;s0srto(mpiy1op elnei s arrru  ;t0ole ifciyd a2eauvs (4arxomo3oodlptrlneo (0trurim3ou1al n iei t)a2ur(mo;u4aptn o3iytla rmn p;t0 exnxf iy1fpte n il(0sexmio ou4am   ivtas sDtrumoou4oltn o3tyd a2rau on(4 exoxocta1lpDr nes;t trurxr3oo1lpen nvsa(f Drmx  nu4olxn feild a2el(vs t0areoxr3todlpD lieil() rtm(m ny1ole livt t)a2tm(  ;o4aet  o3tadla2rln snu4trtnmr iodlpt  uvs;s) 2tr(o ou4oltn fvsls) 2taum ;t1tlxomf3tytlaDelnmsn(0 exrif3iatfaDeluvsl() 2ur(r3no1al elivtl( artmx o;o1apenmf3ias s2ean pnu4tlxomfctatla raneol()t2um(o3oy4lpt  ictls)srua(rp;t4teto oeild s umuvsn(0aetomo3ty1oateauvolt teto(m io4optemfvi s) 2ururpot1texn i3tytfaDeanvs;() etoir3tatom   neslt tetr(rpiudoltemivt tf 2tr(mpnu0aleoiociytlm2ea(mp u0 lxoxf oy1lpteanei;t0s2to(r3nu4apeemnvt t) Dta(  ou1olt ifctadlmDra( o;t0trerif3totlmt lnvslt0t2tmxo3iodll nmnvilt arrmxm ot0ole ii3iyslsDum( p;u0altrxf3iatfmteaneo t s2trim oo1al  mnvia(f 2ururp;o1aex moctytla ua(vp t) ltomf io1lm r ieslt0s2tmimpoy1oleelncs (fsDrrxrooo4opxomietadfsDrmu p (0tlxrmr3iatlptr uvolt teumiopoudolt lfvt t sDrru p;t4altnmfetadfs rlump;u0 etrio3io1fmt  ivs;s) 2um(rpiudalt  nviat srtau pot0openmiciatfm2eln p;(4 exrif tatlp raiesl()srumirpnu1lp  lfctat)s2umx pnu1oleoiieildlm2rau onu4 lxrxr3oa1optr nes;s0srtoio ou1apenmfvt (faDumu  nu4tltn ieiltlm2ra( o;t) lermr3oy1lpDeluei t)t2ur(opno4opte nvslt) Dumumpnu0apt iictysfa eanmo (4 lxomocoo1fmt anes;() rtm(r oo1ope  fcta()a2trxmpnt0tleomfciys m ran pn(4altnir iytfptrlu ols)t2umxr oydop  mfcia(fs2urxm ;t1tlenmieiatlm2um(vp;(0texrxo ta1late ies s  2xoim no1altelnei s)a2rr(roou1olxo o3ils s2rluvs t0trxrif oadopt anvi ( trxriopny4amt  ivsat  rurump;u1tlxnmf3iysfmDum(mo;(4teerxocoy1faD  neil() rtriopnudll   ivilsfarurur nu4apenioeiydfaDua( s t)tlenmrcoydomDe i i;t)trtr(o3oo1lleelfcils)a2ur(  ot1olt io3tysla uauvon()aleomr oydlatraneo ( srto(m ny1alenmnes ()s2tru oot0opeo fciysfm2uauvs ()altnircoatfmteln il(  exoxmpnydlmtnmics ( sDumum ;t0tex iietys m ua(mo u0areniocia1fmt  nvo s) etrxo nudol emivsl( s2tau  nt1aptn ieils m rm( p t)tltoxf ootopt  uvs s)srtrxrpou1lptemnei tfartm( ooo4apeoifctls m um(vsnu)aeerio to1fm  anvs;s t2tmiopnu1llenmnesat srrm(root1oetniieiadls rmnmp t) renmf iotfpt au s;t0 ruoxmpnu1ame mieias  2rrumpot4alxomf3iltfa ea(mp u0aetrifcoytfptelieols) 2tmiopoy1oltelietat  rumxrpot4opeo fcilsfm eanmont0trxoircoy1fa rlivs (0s2tmio oodlm nlfes tfarumur ;o0aeto ietlslsDranmpnt)trtnio io1lm eanvsl(  exm(opoudaltemfei sfarraxrpot1apt  i3iyd s2rluvo ()aeermfcia1op e uesl() rxm(o io4om emnvtls)a2rm(m ;o1aexn i3tls aDeluvsnt)aexrxf3iatfmDeanei ( s2tm(m3iy1amenliei t s2rmx o;t0teto oeild aDrlnvs;u0aeeoxo oo1lm r ieolt srtoxo3iu4lpte fctat s2rau pnt0oetn i3iys s2rln o;() eenif3io1fm  au s;s)setmxrpnydomeelnvias)sDrrxmp;t0tpen fetydlm2ul( o ()artrmf ootlaD lu s;() rtoir3oodal nmnvs t aruau  ;u0opxnio3ilslsDemu p;(0tlxriocoo1latr uvs (0s2trxopou1apt lfvilt)sDua(r ot1opt mieiatls uan sn() exnxf io1oaD  uvo;( s2xmim3ny4apt lfes ()sDumx onu0tptoiictld m emnms t4arxoio totoptelneo;t0setmxm ou4opeemietasf Drru  ;t0oetoif3tad a um( on(4treoxf3tydfm e nvs (0s2xoxopny1am  lnetatfsrum(m ;o1tex mo3ild a eln p;(4teenxo iatlaDeaivo;s0s2xmxr no1apeemfet sfa2ra(mo;o0oetoii3ildla2ua(mo;t)arxrxo tadfa   nvo t0 2toxo3iydlmeelnviltfsrua( oou4aptnmfetatlmDea( p t)alxrmr3todfm rlueo t  exrxo3oo4amen net ( sDrmxro;u1apeoio3tlslm2umnvs u0texomrciotfm   u s;s)teur(rpoy1lme  netl()artaurp;o4aleoifetlsfaDean o;u)trenxfctotop eau i;t)tetrim ny4alee fvs tfaDtaxm nu1alxn ociltfsDuln p;u0 eeoxr3ia1om rlneilt0truoir oydlme miciltfsDurumoot0oetnmoctad m2rau p u)aeeomr3totom rai il( teumimpnu4omtn ivi s) Dtaxrp;u4apt  o3iydls rl( s u)texrxfcoadlaDr nvs t0 rto(opou4amtnmfvia(  rtrxr nu4aet mf3tls sDrm( o t) etoxrctydomDrauvsl( t2tmxm3ou4al  lfctlt  rra(mo;t0alt iociyslm2uau p u4trxrxr iytomDraivsl( seuoxm nu1amenmieiltf 2rr(rp;t4tltn ietydfm2ua(vo;t) etrxo to1fmtrai o t0 2ur(o no1ameelnvslt)aDtrur ot0texomoeilslaDra(vp t4aexnxocootfmDran ilt)t2uo(o3oudam nmnes t)srrrump;t4oexo fetytlaDemu pn(4 eenmo totom e i s t)srxmxr3nudlmt liet ( artm(mo;t1tleoio3iydfs ua( o;()texnif3oa1laDrliei;s0sruoxmpoy4lmen nvtlt) rrm(rooo4olto oeiltlsDea( pn()altrxrctodlm e n s t t2xr(mpoo1lpte nctlt) rrrxmpou4tlxniictyd mDelnvp u) lxnircoydopDrluvi;s)srurxr3nodom   fvs ( srur(ro;t4oeenifetlsla umn pnt)tlxrir oytlpDe uvs;s) 2xm(o oydlmtn fet sfa2um( poo1oexnmiciatfaDrlnmpn()areoxf todfp raueo;t  rxm(o3no1lltemivia( a2tm(  ou0opeomo3ils s rlu s;(4 ltnmf tadlat livi (0 exmxopnodolt mics t artm( o;t0apx  fctyt a2um(vont0alxniocoadomt  i i;t)s2xrxm3iy4ll n icilsfa2rm(m oo0tltnmf3tld aDem(mo u)aetrxfcto1opD lueilt0 rxrxr3oy4apt  fei sfarumumpot1alx mociydfa ua( o;u) rtoio3ta1fpDr ivolt)trxrxo3iu4omenmfet s)a2trxrpou0opxomieiadfs2ulnmp u)alxnmf3todfatrlnesls)s2tm(rpnu1lpen feilt sDur(mo;u1olxniictltfm2el(vsnu)tetomfcty1fa rluvo;t0sexrxr3iudlme mneia(fsDrm(m no0tpxnifciltfs2ra( on(4trtrmr todoa rli sl(0 rum(m nudlmenmfcsas)aDur(  nt4ale mictys m emuvo;t0tleomrcty1optrau ilt0 rxrxmpiy4ope  nes (farua(m nu0teenifciat a2ea(vo u) exnxr oodopD luvs ()s2tmxr nodop nlictl(  2ta( ono0olxo fetyd s ulnvp;u4 eeoxocia1fp rlueo;(0t2trxo ny4optemnct sf 2tr(mooo1tlxn i3ild sDea(vo t0aetnxo oadoa eluvs t0 2tmxm3nydlm nlnvi s a2uaxmont4oexn oetytla ra(vo (0 reomocio1fmt  i olt0 eum(opno1ome mnei tfs2umx ooo4teenmfctatlsDeaumsn(4trenxo3iodoa rlieil( setr(r3no1ap  lnvs ()srtmum ;u0olxn icildlaDeln p;u0aexrioctytlmtrauvo t)setriopiu1oltnmnvil(  rta(mpnt1teenmfctldfaDrmuvo (4altnmo iadlm  aneo;t)teurir io1op  mfeslt)a2rr( pno4apen fciyt s rau s;t4trxnxo3iadlmt luvsls teto(o oy4llenlnviatfsDtaurpot4aetomieiadfa rl( p;t4trxrxfciotom ranvs ( srurim3oo4oleemfeia(fartmx p;t1tet mietlsla2ua( s;(4 rermociydfaDelivs;t0t2trimpiy1lp e fcsls srtrumono1oexnif3tydlmDrmn p t0trxrif oo1lmtrlu i t)texr(m ou1omte nciat arta(ro;u0opxomo3iat a uanvp;(4tlxoxf3tatoaD  n i;s)t2uoimpoy1lpeemfcs () rua(ro;o1tee ioeiys m el(ms (4alenir3iotop   u i;s)s2um(mpoy1ll  livias) 2tauro;o4oltomieiaslmDem( s u4teenir3oo1lmt luvils0srxo(mpno1ll  lfvta() Draxroot4ope io3tlsfa uan on(4 lermr oodlpt  nesls) rumiopiu4ap e nei tf rurx  nt4oeto o3iad a emn pnu0 lxrxr3ootfatrli s t tetoiopiodomte ictlsfa2rmxmpou0olxnifciatfs ra(mo t)tltoxo3oodlp  aieols srtoxrpno4om nlivsls  Dumu pno0alenmf3iytlaDeaumsnu4aeenio ia1fm  aieo;s0 rxmxo oy4lle lnet t  rumumpot4teenmi3ias s2uauvsnu)alxrxociodfm r ivi;t tetmim iodlpeelfct ( sDtax poo1aet mocias a eanms;t) rxnmr oa1oat  ivi t seuo(m3no4llt  icilsfa2ua( onu0tptnif3tltfa rau snt0 renmoctytfmDr nvo () rto(opoo4lpe mics s  2rm(mono4tetomiciyslm2umnvpnu)alxrmf tatop rlivi s tetmim3iu1ape lnesltf rra(  ;o1alt moetlslmDua(vp (0teenifcoytlaD lieo ()t2toxm3iydapenlneia()s2rmxro;u1ope  ieiat s eanvsnt)arxoir iatlptran i;(  2umxr iu4lm e netatfaDrr(r nt4aet  o3tysfa eln snt4alxrxf tatfp elnvi;t0 2xrxr3oudlmt mnct tfsDtaxmpnu1ape io3tydla ua(vo;t) leoircoa1lmt liei;s)sexo(mpio4op elfvtls srrrurp;t4olxnifeildlm2umn snu4tltnircty1lmte uvols setr(opoodapte iesa()aDur(m oo4oee  ieiasfm emn s;u4trxomocoa1la  li il(0setrim iodalt miciltfsrumx  ;o4opt  i3tatls2eanmont)texnmr tatlpDr iesl( seur(r3iy1ome livils a2rr(rono0tptnmictytlsDumumo u0aexomo totfp ranvolt0s2toir3ny4lmenliet (f 2tmurp;u1oex  oeiytlmDuluvp u4 eermf3iydfptrlnes t0seto(r iu1lpeelicsat)aDrax  ou1aetn ieiytfmDrm(vp (0 rxnxr iodfp r n o () eumxr3iydape lncta() Dum( o;u4tlxoiictyslm el( pn(4 exrxrctytlmtrluvo t0seuo(o iu4om  lictls) rumu  ot0aptnmfeiatfm eauvsnu4alenmrcoodom r iesl()t2uoimpiy4lpeelivi (fsrrruront4tptn ictad s rlumsn(0 lerxo3to1om eln s s seuoiopnu4al n ivia() 2tmx pou1tetoio3iadfm2uan p;(4artnir3ootfmDeau s;()srxoxmpny1optnmnvtls)sDrmu oou4olen fetaslaDraums;(4trenxf3oa1lptelu o;(0setrxo3iu4llen ivias aDrrxrpot0alt  octydlm eluvont4tlxomocia1optrln s;s)trtm(o iy4alenmnci s artaur ot1oet mfetytfa2uanmo u4alxomrciatlp e ivil()s2um(mpiu4ll  mivs ()a2umu ooo0apt mfeildfa uanms;u4treomr3iotoa elnvi s trtrir3ny4llen nvsat)aDra(  no1oeeoifetat mDranmsnu0alxnir oatfpt  neo s srtrxo3no4amte ivtlt artaum ;u4alxn ociasfsDean s;u)altrmf oydfpt  n o s) 2umim ou1omtemieilsf 2urxmpno4aet mfeiltls2uauvp u)tetnxocoy1la   i o t) etr(rpio4lmtemfcslt)a2ra(m ;t1aexn f3tatlaDuauvs (4tetrmo iadfpDrlivo s  rxmiopnu1ope mivtl(f Drm(m oo0opx moetatlm rl(vsnt) rtoio3oo1fpD  uvs;( trumxopnu4oleelfcs ( artm(roou4tetoiieiat a2uanmsnu0 lxomocoa1lm e neil(0 2umim ny4lpen ivsat)s2rrur ;u0tpxniociatls uln p;t)alxoxociy1fa eaivs;(0s2tmxopoy1omenlnctl()sDum( o;o0tetoio3iysfs2el(vp () lermr totoa eanesls srtoio iudopenlivtls s2rm(  ou4optn oeiyd m2ua( onu)artrir iatoaD  nei;t0 rtrir oy4omeemietas artmum ;t4tlx mo3iytfm2um(monu)texrir oadfpt  n i s truoirpoo1ope  ivsas)s2tm( poo0aetnmi3tyd a2el( on(4aexoif ta1oatr ieo;t)tetr(m3ou4lpte icil() Dtmxm no0apeo ictltfs2rlu ont)artoir3iytlat anei;t)srumim3io4al   fet t a2rax pot0olxo i3tat aDrluvo u0tlxoir ty1lpt luei;s)srur(o nudale lfcil(faDra(m ot0alxniociasfa2em(vpnu0 ltrmfcia1lmt anvo;s trumxo iudam e neilsfaDua(m ;o4aee miciyd mDemuvsn() eeoifcoadopDeauesls trtm(r3ou1openmivsas  Dta(rpnu4tpxnmieilt s2uaumsn(0 etomr oydfatr nes;(0 rur(m iydlpenmictat)aruaurooo4aexomf3tldfa2rl(vs () rxnxr3iodlaD li ilt srtrxmpnydlptn nesas)aruax o;o1teeoiiciyd a2eanmsnu0alxrmfcoodopDean sl()s2toimpoodam n ncsasfsDra(monu0tlxn feilsfmDrm(vo;t0tltnifctadfm ranvs t0s2tm(m iudlpeemnvs t  2tr(  oo1olxn octldfmDuanvs t) rtrxrcoodoaD au o;()teurio3iudlpenlnvi (  Dra(rpou1oetomf3ias mDemuvo ()tleoio3oytlaDeaiei ( trtm(m oudamee neslt srtau pou1alenio3iys s2eanmp t)tlxrmr3tatoa eln i;t t2tmxr ny1lltemies s)sDtax  no1oee moeilt aDrln pnu0aeenxr3oodlaDrlnvo;t)seur(opno1omtnlfei t)arumuro;o0aptoii3ias a uau sn(0 exomf3ia1fmtr uvi;s) 2xoimpoydapeemncs sf rra(m ;o0oetn o3iatfa2ean s;u) ltnir oy1faDeanvs;(0 2xr(o iydlmee icta(  2uaxmp;t0oeenifciydlm el( p t4 lxnio3ia1fmtrlivslt s2xrir3io1olte icsa( srrmxrpot1olxniicildfs2emn s;t0aeermr3ootoptrli s;t0 exmxm3nu4apt lfvsls)s2uax  ;u4alenmi3ilt m umu p;()aeenio3iy1oateln il()trtmxo iodalt mfvt (  rtm(m ;u1oexoiictlsla2elnvp t) lerifcoodlaDe i s (0seum(m iy1open ivtas) 2taxm ot0alxnifeiyd a2rluvpnt4altoio3ty1omtrlu olt t2xrxo iydlmenmnvsasf Duaumpnt1ale iicildlmDeaumo (0alenio3iydfmD  neo ( texrxm nudlmeelfei (faDrrxm ot1oee  i3ilt m2eau s;(4tlerioctotfaDrlieils0 rto(m iy1om elfvtlt srtmxmp;o0oeeo octadlmDumn p;u4 exnxo3ootlm rliei t0seumxmpno4lltemfcias) Drax ono0aexnioeiysfs2ra(mo t0tltomr todop raiei;s  2trir3nu1lm nlictatfartax  no0tpxomf3iasfa ulnms (0tetrio iydfmt livo t)srumimpny4ape  ncta() Dtmumonu1apt ifciyd a emnvp;u)texoxr iydfaDeauvs t0 rxmirpiy1amenlncta(fsrumur nu1alxomictas sDemu o (4altrmfcoa1lmDrli o;t t2ur(r oo1al n nvs s)a2rmumonu4oleo f3tlsla2elump;t4 etoxoctydlaDe ueo;(0srxoim iy4altnmncsasfarumxr ;u0tetoifctytfa2um(mp u4 lerxfciodfpt anvo t setr(o iy1lpte fvi t aDumxr ou4apt  ieiytls2eanms;u4alxnmf3tatoa r nesls)s2uriopnydop nlnvsa()artrx  oo0apenioetld m rlump;() exoxfcootlatr neils0seuoirpnu1lptn nes (  rtaxrpnu1tpxnioetad m uau snu4 leoif tadoa e n i;t)trxmxr iy4lptnmncsl(farrr(rpno1alx if3ilt s rmn o;u)tltomf3totlp eluvol(0t2xm(r nydaleemfvias  Dumum no0tpt  i3ildls2rluvs (4 rerir oo1opDrln ols0 2tmir3no1lp elneia(farum(mooo0open oetydfmDemnmp;t4tltrmoctotoaDelnes t)texr(r iu1llt mfvt t) rtm(ronu0texoifetys a ua(vs (0 rtoxo oo1op e ivols)truo(rpoydom emivi t aDtmxront1oexo feildfa2emumo;t)tlerxr3iy1oaD  ieilt  2tmxm nudap  lncilsfaruau pnu0tet moctydfa ra(vs;t)trxomo3iytlpt auvs t)sexm(mpoo4ape liciatfsDurur no1alxnifciadlm rln snu) exomociydlmD au o t0sruoxrpnudlpenmnct sfsrrmur nu1tptn ictas m rmnvo () etrxr3iotfpDrlu s;s0 2xmirpiydamt mieslt aDrmu o;t0opx ifctydfmDrlnvont4artrif3totop e neols)srum(r3iy4amee fvs tfartaxr ;o4oee mieiatfmDrmnmpnt)trtrxr ootlpteaivo;s0 rxrim3oy1apte ies s  2tmum ;o1optn o3iadfm2ua(vpn(0 exoxocio1optrai o t0seumim3nudlptn iet s  rrr(mont0olto ieiasfs2rlumonu)aetnif oa1fate nei;(  euoxm nodolenmnesa(farraxm ou4olt moctadfsDeanmpn(0tetnmrcta1fmDranei;t)setr(m nudoptnlics s artaxrpoo4apxo f3tyd a rm(vs u) rtoxrcoy1fateauvsls)s2xrxo3ou4lltnmnvils arrru  ot4oetoioeiyt a2ua( s;()alerxfcoa1oatrlues t0 2xmxm no1lm  mnvi sf rtr(mo;o1opx  feilsfs2ul(msnu4arxrircoy1oatr u s;s s2xoxr nu4aptemnetl( sDraxmo;t4tetnmoetyt sDrmu s;u0 ltomrcta1lpt aues;s srxr(rpiodopen fei t sDtr(m ;t0texoioetysla2rln p;(0 lermo ty1lm r ueo t) 2ur(mpiodam  lncsat  Dta(mpou0tee miciltfaDumn s;(4altoif3oadop eli s ()t2urxmpno4apt mivs ()aDtr(  ou4tltomfctltfsDrlu o;(0 exoio3oadlmD aneil(0trxoxmpio4ll   fci tf 2rru  ou0oeeomoctatfmDea(ms (4 lxnxrcty1fpD  u s;s0 exmim iudop elncslt)s2ur(mpoo0olenmieiys mDumn o t) rtnxfciotoa   nvsls) 2umir3nu4aleelnei t) rrmurpoo1tee mo3iat s2um(vsnu)tlxomfcto1lp rli o;s0tetoim3oo4aleelfvi t aDrm(rp;o1aeeoioeias s2emn onu) reoif oodfa rln i ( trum(mpou4ap  mfci t arrmu onu4texoiiciatls2elumon(4 rtnxo3iy1lmDelu i (0tetoxm3ou4ll emfvil(f Drm( o;o4tlen ociad s2um(mp (4altomfciotlp raivs;t)srurxopiodamtnmfvilsf rtmx o;u0oet ifeiad mDuauvp u)aexnifcta1fm rauvo t0trtrxr3nodom  mfet t  Drmxrpno0aptn oeiyd s2rmumonu)alenir ta1lmt lnvo;s0trurxo iu1oltemfvtl( arta( p;t1aee  ocilt a2uaumsnt4 eenmr oodopDr uvol(  exmxmpiu4lptelncta(f 2tm( ont1tpt ioctlslaDul(vsnt4tlenir3iytla rai s;t0 2trir iudalte ieil( arumu p;u4tetn oeild mDum(von(4trxoxo3oydoat aueols0 2tr(o no4al nlnvi t)artr(mo;t1oexnmo3iltlmDemu o (4tltrxr3tytlpDraueo ()t2xrxo iudomenmfctl()arrm(  ot0aeenmfetlt mDua(vp u4alxomociatlmt anesls tetrxm oydap   iesatf 2rrumpoo0tpe  i3iydfs rlumsnu)artnircoatlm eauvo (0t2toxm3nu1amtemfvta(  Draxmpou0apto o3iltlmDeaumonu0aexnmr3oo1fm e uvi;() rumiopoy4ole  nesa()sDtr(r ;o1alx iieiyt aDuln p;()teerir3iotlpD lnvi;( texmxm iydlmenmnesl(f rurx  nt1apx  o3ilslaDel(mo;(4aleoxoctytfmD auei;s) 2xoiopiy4ol emnvil(  Drmxrpot1tptoifeiadfa2rmnmo (4trerirctadom eai il()tetoxrpiudamtelfei (  2ra( pnt0altnio3iadlm2um(vp;t)artrxfcoodopD aivs;()s2trio3iodaltelnci t) rtmu  ;t1aeenii3ils m ua(von(4arxnmr iatfm e i o;( t2umio ny4op emfvt t  rrrurpnt0aetoifetys a2ulnms t4trenir oo1lm elueo;s seuoxopnodoleemnvslsfs2uax ono4tet ifcilslsDul(mp;u0alenif tadlaDrau o s srxrxopnudlpen iet t arraumpnt1tltn o3iltlsDran s u4trxrxr oytfaDeaivol() etr(r iodomtn ics t) Drmxrp;t0aptnmfctls a emnvon() lerio iodla r nvols)trxrxr io1am  lfctasfs2tmur no0oet  ociadfa eanmonu0 lxomf iytomtr u i t)seurxm3oo1lle mfcta( s2tmur nt4tpx ioetad a2ul(vp;u4areoir todom raivol()s2xoio iy4al  mneilt srrmu  ou4opxomfciad m ulnmp () eerircoodom  ln olt)sexmim3io4optelivi (faDumu ont1oeeoif3tyd s2rm(von(4 ltnio iatlmDr uvilt  rxrirpoy4ap n neta( srtm(  no4tpt ii3iytfs2emnmp u0tlxnmr3tydlaDrlivo;s)t2tm(o oodlme lfvsas aDra(ronu4oeenmi3iaslaDul(mo;u) leoio tatfatr i olt teuoimpnudaleemivta() rrm(  ;o4apeoif3tad sDemumpn(0arermo3iytlaDe i olt0srtoiopou1lle lnetlt a2ta(mpou1aexnii3iaslsDum(mo () exomr3oo1la rlu o (  rurxr nodamte fvilt sDtmuro;o1ole  fetyd a2ea( ont0aeerxr3iatfptraneols0sexm(opny4ape lnvtl() rrm(mo;o0oee  i3iydlaDea(vp;(0tlxoir iotlptrlnvilt  2umxo iy4open neiat aDrr(r ;t1teto fciytlmDrln o t0 eenio oydlm   ies (0setmimpiu1am n feilsf Durx  ;o0aeeoiieiatlm ean s;(0aetrxr3iotlmDrlnes;t trxm(m oudaltn fci t  Dtmx pnu1ope io3ilt m2emn ont4trxomo iatlpD aneo s) exo(m3no1lp elfeil(fs2rm( ono4apenioeiys a uan s;u4 eerxf3oy1opteau ils0sexrim3no1omtemfctasfsrtauroot1tpxomf3taslm rmnvs;t)tlxomf iadfp e iei;(0tetrxm3oo4apt lfvsl()a2rm( oou4opxomfetytfsDrau p () etoxfcoatomDr uvi;t srxrir io4ale  ncslsfs2tmxr no4aeeoifeiatla2rlumo (0aeeomfciadfa eauvi t) etm(mpoy4oleelieiat a2trumont0oleomfciat s2em( o t)aexoif iadlm  luvs (0 2umxmpou4omtemfesls)sDra(m nu1apto f3ils a emu snu) eeoxr iotfpDeauvo ( seto(o3iodameelics s sDuauroot1teto o3iadfm rmnmpn(0aexoxo3iadfpDrlneo;s0seuoxr nudaptelfei (fsDraumpou0olx mi3tyd a2elu o (0tlermocoytoatr ieo;()s2urxopno1lpe lieiatfsrrrurp;t0tlx if3iasfmDuauvo;u)tltnif tadlp eliei (0trtoio3no4aptelfctas) 2rruront1aetn oeiyslm emn p;u4aexrmo to1opD  nei;()s2tr(rpio1ome mnetatfaDumxmp;u4tpenif3iltfm um(vp u)tlxnircta1opDr ivo;()s2urxopoo4lpt  ivia(fs2rr( oot0alxnmfciadlsDumuvo u) eeoio io1opDran ils)t2tm(o iu1lp nlncil(farrru  nu4tpe  feiydls elu p t)tlenmo totla ran i;(0teum(o nudlle mnciltfaDrm(r ou0oex  fcilsfa uluvo;(4teeoxrcty1omt  nvi s srtmxo3iodomt mneilsfa2taxmont0apx  fciytfmDulnms (0artomocoadlpDrai i ()tetr(m no1lptemiesl()s2rrumo;o1aptnii3ildfa2rauvs;u0alxoxo tadlat an s;s texoxo io4ol nmfcslsf 2um(mono1tetn oeiydlsDul( s;t4alenxf ootfpDrli s (0trtrir3oo4amt livi (fsDra( p;o1aptoiocils m2em( p t4 etrio ty1omDran i t0truoio3io4lptnliei sf Dur(rp;t4tlt ioetldlsDra(vonu4altrio tydom  anes;(  2triopoy4lltelnctls)a2urxmont4aexo i3iytfm2um(von(0treoxr3ty1fm rau s s)s2toxr oy4omee iei sfsrum(mpno4oexnmoeiadla umu o u4alxoxfctydfaDeauvo;()s2tmiopoodll  lnvias s2rm(r ot1tlen i3iasfs rmumsnt4treoif3ta1fm eai ilt) etrxmpny4amtnmivi (f 2ra(rono1alxnif3iadfm uaums ()trtrmrctytlpt li olt srto(rpno4am n fvil( s2tmx ont1aleomoctld a2umu onu0arenio totlmD  nei t)t2ur(r ny1ale  nvsl(fa2trxm nt0tpeoiociatfmDrmnms;(4 exrmr3oa1opDrlivi t texm(m iy1op   ici tfartm(mpnt4tpt  i3tld a rm(vp;()aetrxo3todomt lu ils)t2uoxmpiy1ll emicia()srrrxmpoo0tlt  icild s2emump;()alenmo3iy1lp e u s;()teum(mpiudol elnctl( sDururoou1tlxnmfetltfsDea(vonu)alxnxociytla ranei;(0 etrim oodomt  nvi (  2rrurpou0altn feias a2ra( on(4 ltoxfciytfm e n o;s  rur(o3oo1ll elneslt)aDur(mp;u0oet  f3tld m emuvpnt4 rerxo totfp eluvs;(0seumim iy4ole  nvsatfsrtm( ooo1olx io3tysfmDum( s;(4 eeoxfctotla  lnvs s sexmir3ny4olee nct s a2ururooo4tpenmfcias s2em(mo (4aetnif3io1faDraues;s)s2tr(opoy1am n iet t) Drmxrpno0aeen i3tlt a2uanmo t4 lxoir iadlm raueo s0 eum(r nu4ape lncia()arrrx p;t0olxoifcilsfa eau o;t)arerxo3iotlatelu slt s2trir3oo1om elivtlt a2raxmo;t0teenmoeils mDuanms (4altrxfcoytfaD li s t0setoxr3oo4al  lietl(fa2ra(mp;t1aeeoifctysla2ran o;(4trtrxrcia1opteaneo;t)s2toxm ou4opeemieiasfa2taum ou1aleniocils a2rmuvs t0alerxocoo1omDe ues s)teto(mpoy4omenlnvt t s2rrur ;o1oexo o3iltfs em( o;t4tlxoxf3oytom r neols)setmxopiu1al  lieilt a2umxrp;o1aexniieiasfa uau p;t0texnifcio1fpD lueols sexrxm io1omeemnviat)srrrum oo0olx mo3iytfaDea( p;u4 renxo oytfpteau i (0 etr(o no4llee ici s a2tm(  nt0tlxnmfciatfm ranms;(0trtoxr3todop e ivs s0seto(o ny4om  mfvs ( s2rm(mpou0alto fcilsfs2ul(vo u0trtoif oatfptrluvolt0 2umirpoydop  lfvtas srraumpot4olxn oetlsfs elump t4tltnxoctotfa  ai s;(  rxriopou4alenlfcslt  Dumxr nu0opt miciadfa el(vont4arenmr3totfatrauvs;(  rxrxmpny1optn ivs (fa2uru  ot0oltn f3tadfsDua( p;t0aetnif tydlpDe ieslt0 rur(r3nodlpt mnetl(farrru o;t0teeomoeiytlsDul(ms;t0tltrif3oy1lpD an sls) exmxr3ou1al nlicta(f 2rmump;t0olxnmf3ildfs elnmp;u4arxnir ta1fmDelnvo ( trxm(opoudam elncsa(farrau p;t4tlxo ociatlaDrmump u4arenmf ia1lp  ai il( trumim iodope lneias  2rm(m oo0tlx  ietltlsDelnms u)tlenxf3tytla rlneslt)sexrir iy1aptemiesls)arrrx onu0tle moeildfsDua(ms;t0 exrir3tadfm raivo s)t2uoir3oudapen ivtlt s2umu p;o1alxo o3ils mDumn p u)artrif totfm r i sl()srxr(r3iu4oltn ieta( a2urx  ot0tlxn feias s emums (0texrxoctadfm ean o ( tetrirpio1lptn fvtat)aDrrx o;o1tpt  o3iat m2eau s t) lenmfctatomt  ues;s) exmimpnodam emicsas  Dra(mo;u0tpt iictlt sDuau p;u) rtrxo ta1laD  uei (0teuoirpiu1ome lnvsat a2tm(rono4alt  fciatfm2ranvo (0 rermocto1lmte ieslt trxrir iu4amtemncs (fsrumum ;u1tltnmoeiyd m2rlu pnu)artoifctydfm rlueil()trtmim nodol nlnesltf rtau  ;u0teeo f3tas m2elnmpnu4teenif ta1lp raieo;t  rtmiopny1lmtn ivias)s2rm(ro;o1ape  fcildls elnmo;t4tltrxocty1lpDe ivils0trxrxo3iy1omt mnesl(f 2rmx pnt0aetn oeiltla uaums (0areomrciadlmDr u i ( srtm(o oy4lmeelnetasfs2uaxronu4opxnmf3ias mDeluvon(4 lxoir3tytlate nvs;( s2xoxm3iy4olen icil( aDuauro;t0tltnioeiadla2el( p;t0 etrir3iy1laDrli i (  rto(m3oo1omeemicsl() rrm( pnt0tpx ioctys a rl(mp;u0aetrmf3tydopD  ieo (0seuriopiy4lp nlfviat)aDtrx  ot1tpxnmietyd s2el( p;(4 rxrmoctatlatrluesl(0seumio oydlmtemnesasf rurumonu4ale mfcilt s2umnms (4 lxrmo oa1laD livs;t) exmir3oy4lmt mivs () rtaxronu1teeomiciysfa eln s;u4 reoxr3totfat  i sls)trum(opio4omt  fctlt)sruru o;o1oetoio3ildfa2raump u4tltoio oa1lmD  uvi;() rtmxm ou4ame mfci t s2ta( o;o1aptnifeiatlm rm(mo (4teenif io1lat lieil(0sexrxr ou4alenmnvtl(fsrrau ooo4tlx ioctat s umn o t0tlenmo oo1fa rln s;(0t2xo(rpnudlpte ictlt)a2ua(mpoo0tltoii3ild a2ra(mp () eeoif totoatr nvi;t  etoxmpny1opeelfesls arrrxm oo0oeto i3iasfmDeanvpnu0 etomf3iodoa  lnvo ()s2uo(m oo1ole mfctas) Dur(  ;u1apxnmoctat aDul(vo;t)altnmrcoytlat aivolt s2umxm iodlm  mivilt srrrx  ou0tetoif3iydfa2ra(vpn(4 exoxo iotfpDran ils) 2urim no1ame mfei (fsrrmum ou0aetnmf3ildls2umu p;t0alerio tadlaDrluei;t trxrio3nu1al emnesas  Dtmx p;u4olx iictldfaDrmnmp;t4texrio ta1oaDrlu s;s seumxr oodalt  ivt (f Drru ono1oeto ieiys m eln s u0arxnio oydfmDeauvolt) rtmxm3iu1al  mivilt sDrmurp;t1texomieiaslsDum(mp;t4trxomf oytfp eai i t) rum(o3no4alt mfcs t a2trxmpoo4oexomo3iyd aDea( s () rerio ia1lmte n s () rtrxo oy1om elivt () Dtau pnt1alxnifctys aDemn o;()tlxrxr3iytla eaivi;(0 exmiopou4oltn fvil(fartaxmpno1tlxomociltls2elnmsnu0teeoiocto1opDe ues (  rtoir io4amenmict s)arrrur nt0apen ieiad sDra( s u)trenxr tatlmD  ivo t0s2uo(r3oydapt  ici s s2tr( poo1oleomociytfsDrl(mp t4aleoxr3iytop elnei () 2tr(m3nudoptelfvs s srrau o;o4tptnmf3iysfaDrmnvsnt)tlxomr iytlatr u s;t)texo(rpoodaleemfetls) 2tm(rpot1aeto f3iysfs2umnmonu)tltnxf ootlp  lieo;s0 2uo(o3iy1ome mnctas  Dur(  no0aet  o3taslmDrmnmo;()alxrmf3ty1op raueslt s2um(rpiy1ap emiciat s2tr(mpno1tleniieiatla rlnvsn(0altrxo3iytlpte u il(0s2umirpoy4lp  lnetas)aDumx o;t0oltomfeiatfm rm( pnt)altoxo3iydla e n s;t s2um(m3iudop  mfvi t)aDrrxr ot1oex moeiltla2emn o u0aeeomo3oy1fmDe ies t t2xrir3iodlle lnes tfsrrmxmpou1aexomf3tasfaDeauvo u) leriocia1om  anvo;t0tetrxm3iodllee neil(  Durxmoou0aleomieiysfs2em(ms u4arxniocoydlpDr nvo;() eum(r3nudlle mnvia()arrax  oo1tpxnmfeiltfm ulnmo ()tetoif oytfp  ai o;t  etr(m io1openmfes sfsDtr(mooo0opx mi3ild mDulnvs;t0tltoio oy1oa rlu s s)s2uoir3oy4ome lnvi tfsrrm(m no0optoii3iysfmDrlnvs u0arxoif3iodfateaueils tetmim3oo1alt lfeils)aDur(m oo1aeeoio3ilslaDraumpnu) rerirciatop e nei (  rxrio nodolee ivsls)aDtrx pnu1ope  ieiatfm emn o;(0treoxr iodfp e n s;() 2um(m nu4lp  mnvi (fsrrr(mpnu4altnifetydls eauvp;(0aeermf3oatfaDeai ol(0 rtm(r3iy1am  lneia(f Durur oo0aptn fetlt sDrmumo t) lenxf3iodlpDeai o;() 2xrim nydap elivt tfsDur(root4oltniictltfmDrl(vs;(4tltrmocoa1fa eanes;s  2toxrpoudlm n neias)a2um(mono4aptnii3iytlm2elump (4 ltniocty1laDr ueols)trtmiopoodllt  fvi (  2ur(r ;o0aetomi3ias m2rmnmont0alenif3oytfa elieo ( trtoir3oo1lme  fvilt)a2trumo;t1texnmf3tldls2rmnmo;(4tetrmr3tadfat  ueo s s2xm(o3iudomenmfvs s a2uax  nu0aetn o3tlsfa emn s;(0aetoxocootlmte uvi (  rxrxo nydlltn iesa(fartrx pnu4ale ii3tasla2elu o;u0 rxrmr3todfmDelueo t0sexoirpiudopt  icsas)aDtmxmono0aetomieiytfa2em( p;u) rxrifciadoateai i;(0 exrim3no1ap n ivta()arrau onu0teeomo3iysfs2ul( pn(4aetrir ta1fpDeai olt)texm(o3ny4optemivil() 2rm(roou0tltn ietydfm2uau onu0altnio3ia1oaDe uesls srtrio3oydol  lfctl(fa2umum no1apeomo3ils m ulums;u0trxrxf ty1faDe ueil()s2urxm3nydamtnmnct t s2tax  nt1oeeomf3tltfa2elnmpnt4artrmf3oydfp eaneol( s2ur(rpny1am n nvtas  2umx ont1oeen fetyt m2ea(mp;u0aexrxociodlmteauvil()srtriopny4omt mfctlsfaDumu o;u0ope  i3ild m uluvpn()artoiocoatlpD  uei;s tetmxm3iodom emfetas) Drm(m ;o1opxnmociys a2ea( o;t4arxnxrciy1oateauvi;()trtm(r3nu4om  lnet t) Duau  ;o4tle ii3tatla2rau pnt0altnio3oy1oa  anvol(  2uoxm oy4ap nlfctas  rrrurp;o4aexomf3iltlsDumuvonu4alxrio3oo1oaDelnvo;()t2umxopoy1olen nvs sfsrrrxrpoo1oleomo3ilt a2ua( p u0artnxf oy1opDeluei;t)tetrio3no4altnmict (  Dur(r oo0alt  i3ilt s2rmuvont)aetnif3ia1optr iei t0t2trxr iy4am nmieta(f Dumx poo4optomo3ilt s2uauvsnu)aleoxfctotlpteaieo t srtoxrpio1optn fei (fs2rm(mp;o4teto oetyt mDeln snu4 rtnirciodfpt auvs t0 eurio3io4lp   ncil()s2rmurpnu1oeeoio3iysfs rl(ms;u)aetrmo iydlpt  uei;(0sexrio3ny1lpt lnetls)a2rm(r ;t0tet  i3iys aDrlnvs;u)aexnmoctotoa r uvo (0s2xmio3iydlmeeliesl(fsrrrxmoou0tpenioeiatls2uanms u)artrmo3ta1op r ieo t) etoxm oudolee ivslt) 2ua(mp;u4texo ociyt m eanvo u4aleoxf3iotfat  uei;t0s2xmiopiu1lptn fet t s2rm( p;o1oexo ociys a2uanvpn() eeoio todop eanvi t) rxmxo iodll  mfvslt  2umxr oo0tpxnmfctyt m2em(vp (4alxoir3iodfmt auvo;( texmim iu1omt lfetl()srrmx onu4tpxo i3iasfa2ean onu)aexomr io1opt lueol()seur(r oudam nmfcsa() Drmu p;t0tltomf3tlslm2umnvs u4arxoir3iadlmtrluesls) etrio3ou4lp emivta()sDtmx oou0optn fetatls umu ont)altoircoo1oa rlnei t0trxmirpnodop nmfcsa() Dumx  ;t0oexomoeiydlmDrm(vpn()teenxr3oytlmDean s;s s2xmxo io1ale lfvi tf rrrum ;o0aexoif3iltlm emnmsnt4aeerif to1om   nvo;s s2toir3iydap nmncslsf rtrumont0aet  f3ias a2uan snt4aeerxf tatfaDrlivil(0 2tm(m io1ape  fci s  rtaxmpno0aetnmiciasfsDumnvont0tetrxfciotlp   uei () 2toxopiy1open nvsatfaDumuroot1optn octysfm ulu s (4 renir iadfpt livolt0trtmxopny4ame mnes t srrmum oo4tpeo ictyd aDem(mont4aetoxrcta1fate n ol(0seurxopou1alen icta()a2tmurpnt0alxnmictld m2ra(vp u0trtrxrciadfptr ivilt) rtrim no1olenmnctat a2tmxmo;o0optnii3tasla uau onu4tlermf3oatomD aiei s t2xm(o3iodole mivt sfarrm(ro;t1alxomi3iatls2rlnmp;t)teerircta1omDran i;(0teumio nodlpt mfes s) Draum ;t4oet  fctatfs umumo u4trtoxf3tadfmDe i o;()teumimpoy4ol emnciat)srtm(  oo4apto ieildlm ranmpnu0artomocoa1fpt auvs s0teumim3ou1lpte ivta(f Drrurooo0alx iieiatla2emnmo ()tetnxoctodfa ranvs (0 rxrir3nodome lnvt t artmx pnt4apenmictaslm2uaump ()arenirciadom   nesls0texmxm oy4amtemicsltfa2rrumo;o1ope  o3iysfa2ranmo;(0altnxfcoydfmt  nvo s)s2uoio no4ale mnvt t)aDta(  ;t4tlto i3ildlm rm( s t4 lenir tatfaDelivo t0 2xmxr no4amee fcslsfsDtm(ro;u0oeenmfcilsfsDuluvo;u) rermrctadlpDr uvo s  2tr(opnu1openlncsas)artaurp;u4apxomocilt s2elnvs t4arxoxf oy1laDeaueils t2toxopoy1oltemicils aDrmumont1alxnif3iad mDrlumo u0artrir3oydlm eaivs t0sruo(mpou1omt lnvslsf rta(m oo4oeen o3iydlm2rmuvont0 rerxo3iy1lpD an o t trtmxr3iydlmtn ncta(fsDtaum oo0tptniociysls2rl( onu4alenif oytfp   n ilt trurxr iudolte netls sDra(ro;u4tlenio3iatfa2ua(msnu4aetrmo3oy1lmtrlueo;t0teurio iodlmeelncil( artrum nt0tpt  f3tytls rmnmo;u4alxrxr iotfaDrliei t0teumxo3iy1lle liet tfartrumo;u0tlenmfctaslmDuau p t4treoxr oadoaDraivs s seto(o io1openlfvsa( s2raxm nu1apeo oeilt m2eanmp u0altnir oytom eli ils trtmxo3iy1ap elnvs (f Dtau ooo1alxoiictat m rmnms;t0 lerxocio1faDeaneolt0seuoxm nodlltnlfet s)sDumumonu1oltoif3ildfa emumsnu0aetnmocto1la  aivs;t0t2umxr3io1opte nes (faDrr(r no4oltnmfcils a2eauvs;(0trtrmo oydoa rlivslt0s2xm(opio1am emiei tf 2tmxmpnt1tlxn i3tldfa2emn p;() rtnxfcio1la eaivil(  2to(m ny4op   fesas)arurumooo1aleoio3iad s2rmnmsnu4tlxnir totlmtr nvi;t)srur(r no1ol  lfei tfsDuaumoot4aeen i3taslm umu p t)artnif3oydfp eaivi ( truoio3iy4omt mncs t  2rm(rpou0oexnioctad s2ulums (0 lxnir ootfptr u i s  ruo(r ou4op  lfei s)srtmu o;u0alenioeiat a2ul(vs;u) lxoir to1optr ivslt teuoxrpnu1lp nlncil(fsruaxrono1tlen o3tldlm um( pnt0treoio3ty1lptelueo t0 rxo(o3nydaltnlnctl( aDtrx p;u1opeomi3ias m2rlumsnt)areomo3tytlmDr n slt)trumimpnu4omen fvia(  2ra( ont1tlxnii3iytfm2em(mo;t0tltnifctodlmDeanvs (0t2umir3io4openlfeiltfsrtmx ono1tle ii3tldfs el( o ()teeomf oo1lmD  ueo;s0 eum(r ou1ol nlfvs (f Drr(monu0aee  o3iydfm2umnmp;t)tlenif3ty1fptr uvolt s2xoxm3no1ope  ictlsfsDua(ro;t1opt mf3iat a emump t) etrio3todomD au olt0truo(rpnudapenmietlt) rurx  no4apx  iciasfmDrl(ms t0teenio oodfpDr ivolt0t2urxm3iu1am elfvtlt)a2ra(m nt0tpxn o3ild m rlumpn(4 eenxo ootopD ln slt  rtrim iudapt lfvsa(f rra(mpnu4tpeniieildfmDrm(mo;t) lxnxo tytoaD li o;s)srxm(o3iy1oltnlnvi sf 2um(mpnu0texoioeiltfs rluvsnu4alxrxo3ta1fa raivslt0s2toir iy4ameemfcia( s2ur(rpot0ale  feiyd s2elump t0altrir3tydlmDrlnvo t s2uoxr ny1alen feil(f Drauroou1tee iieildlm rluvp () rtrmf iytoa rau o;(0teum(o nydlpe  iei s artm(rp;u4oleomf3tasfmDua( on(4trtrxo3oytopD li ols0 rurxo3no1ll  lfet () 2ta(mont1olx  f3iytlsDeanvs;u0trtoxo3tytfm e u i t)srxriopoydap elfcsls  rrau  ;u1tltoifcildfs ul(vsnt0 lxoxf3oodlpte u slt  rtmiopny1aleelfesa(fs2uaumonu4tlxo o3tytlsDrl( o (0alxrioctytfaDr nvo;t0 exoir nydlp n nesat) Dtaur ;u1tlenmoetlsla2umump (0trxnxr ty1omDr uvo t)srtoimpny1lptn ncs (fa2tm(roou4tlt ifeildfa2rau o t4aexoxr iotlp   ieol(  etmxm3nydopt lfcias srum(mp;u1tpxomo3ildls emums;u)artrmr3tatlaDe uvs t setr(o oy1lpt  fct t)sDrrxmp;u0ape iietatfaDumn p;u4aleoiocoodoat an olt0t2um(opno1llt mieia( arrmxr oo0tlen ietytla2em(vp;t4artoxo3oatopDeanei t)t2ur(m3iy4llen nci tfsrumum oo4apen oetlsfaDemu o;(0texrmf3iotfp  li s;(0srtmxo3nu4lptnlnvi ()s2rm( oou4aet ifeiysfs eau s;t)trtomocia1fpDe u o ()sexo(mpny4opte fvsas)sDraxrono4olxo ietlsfa2rlu p u4aetrio3oo1lmtraies t sexmir nudll emnct sfs2uaxroou4tex  ocilsfsDeau p;u4tetoxf3ty1lp  luei t  2tmxmpoydolt mnesat) 2umum ou4opx ifeiyd s2elu ont4aeeomr tatomtr i i;t)seuoxo nodlp e ieiat  2rmx o;u0olen i3tltlaDemnmp u0aetrxrciydomDrau ilt  2um(o3iydllenlneilt)a2raumoou4opt mi3iytlm ul(msnu0tetoxf3todfa   uvs;s0srtrim ny4altnmietas srtrur ;o1ope iieiltfs ua( s t0tltnxf3tydoaD anvil(0setoxopiy1lpt mivtls)arraurpno1tltomf3iasls rluvs u4alxoio3iotoaDeaieolt)trxr(o io4omeemietl(fsDrrxmpot0texoiictatlm uanvs (0 lenmr3ta1opteanvs;s t2to(o3oudll n fvsas  2uaxr ou0opxoii3taslsDumn p;(0tlenmocoo1omt livi;s)setrio3nu4amt lict sfsrta(rp;t4tlto i3iyt s elnmpn(4 etrxo iatlpD ln ilt0srxr(m3oy1apte iesl(fsruauronu0altn o3tyt s raumpn(4arerxfciodfaDelnei;s0t2xoir3iudllte iet tfaDrmxmonu0tpxnmfcilslsDrmn s (0 etomf3iadlmt au i (0truo(r ou4aptn nvsat)a2raumpnu1opx  i3iydlm umnvsn(4 exomf ty1fa rauei;t0texr(m iu4ope livt (fsDurxrono0olxomo3iydfm2ea( s;u0alxrmf iotfmD aiei;t  2trir oo1lpe mnctat a2rru  nu4tptnioeils aDuan p t4 etoxocta1la raivsl()srumxm3io4ol elnei t)a2um(ronu0tlx ioeildfm el(mon(4 exoxf oadlmDr n sl()srxoxm oy4oltn icil(fsrtaxront4tpxoiociasls ean p;u) etoxrciy1lpDe nes;(  2tr(rpno1lmt lnvsa()aDrr(ro;o4oltoifctysfm elums u4alxnmo to1lm elnei;t0trxoxo3nu1amtelieiatfa2rm( ooo4apxo fetatla2umnms;(4trtnxrciadop r u olt sexoxopiydapt  nvta()s2rmu onu4tpen ieiaslm rluvo u0tlxnif oa1lpDeln olt)srxr(mpnydal elicias)srrmxmpot0oeeniociltlaDem( o t4treoxoctytlmt ln s (0 exr(mpnu4apt lnctl( sDtrxmpot0tlt moctltfa elump (0 rxoxr to1fp  an slt)t2xrim3io4opeelici sfarrmumono0oetnmieils aDra(vo;(4arxomr oytlm rliei;s seumim iodlmtemfvsa( aDtmu oot4tpxnifciyd a2rluvon() lxrmr3oydfa   i o ( trtoxm3io1ameemfcsat) Dururp;o0oexo ieild mDrl(vp t4alxrmr3iytfpD ai i;t)srxoim3no4amtn ivt (faDuaurpou0olxnif3ilsfa ea( pn(4trtomrciytfmt aieo;s0 2uoirpny1lpeelnet tfaDurumonu4aeeniieiltlaDrmn o t) lxomo ty1lmt  ivil(0texmio3oy4om e ncs tf rtau p;t1aexnif3iat m ranvs;(0 lxnxo3ty1laDr i o;s0teumxm oydamtnlfvt s sDrmum ;o0aeen o3tydfa2ul( p;(0tlerxf3iatlp ean i (0 rtmim nu1ap nlncia()s2taxrpnt1tet moeiysfm ranvsnu4arxnxo3tydlmt  u o s t2uo(rpou4altnmfvsls)arrmxront1tetoiieiydlmDul(vp (4tetrif oo1la elneilt0srxmirpnudopte ietlt  2raumo;u1tex io3tad sDrlnvp (0 eeoir3iatfptran sls)s2trxmpoodope mfetasfartr(ro;o1apx iieiyt s rmn pnt)alxoxf3iy1fm  auesls0srumirpiydoleemfcsatfa2raxroot1tpe  oeilt a umuvp;u)aexnmocio1laDrliesl(0 2tmiopnydlle mfctat  Dumxrpnt1aptnmicildls eau sn(4trxomocoytomD lnes;s)sexr(m3iydolt liesl()arrauronu1opeo iciasfm umu sn(4areoxocty1la r iei s0t2toxm io1ap elfvil()sDrrum no1opeomfetatlaDrlumont0trxoxo oytop r ivo s  rxrim3io4omtemfci t sDur(mo;o1tltnii3ilsla ul( pnu4 lenxo iotlmteluei t seum(r oo4am  lnctas)sDtaur ;o0aetnifctlt sDuln pnt) rermociodomtr nvo s  2uoxo3no1llenmicsas) 2tmum ;u4ale mieiydfa2eluvsnt)aeerxr3ootopt aieo;s) ruoxrpoudlp n nvsa()a2rmx p;t0tpxo ietas m2umu p u4alxnxocto1fp rlies t)t2urxo3nudapeelivias  Drau pno0tlto f3ias s rluvs;t0 lenxociodfp eanvo s trtr(opou4amen fvs s)srrax ooo0tpxo ieildlaDemumo;u0arenxf3oytlp eaueolt0srtm(o3oodam  lnvsltfaDrrurooo1texo fetysls2emnvs u4tlermr totlm raieslt)seuoir no1ll  mivi s artm(mooo0ale mietyt a2em(vp t4 lenifctytfaD  i ols setoiopny4op  mnesl( a2trxr ou4oexoiictadfmDem( s;()texoxo3iy1lpDr ues;s)trurxmpoy4lme lnviltf 2ta(r ;u1olenmietadla uluvs;(0alerxrcootlptrau slt)t2trxm oy1lpee fcs ()aDrax ono1opt moetad sDuluvs t4trtrmocto1fmtr u il( s2um(r iy4lp   ieiasfs2uru oou1oeenmocilslm umnvo;t0 lenmocoa1fa rauvo;t)trxrxrpoo1ol  mnesat)sDra(mpoo0oexoioeiaslsDulnvpn(4tetomo3tytoa e ivilt0trurxo nu1lmt micilsf rururpoo0texnmo3iyd m uluvont4teeomo3oydop  an i s)srxrim iy4altemfvs tf rurxro;u0olx mf3iat sDem(msnu0 lenmo iy1fa rlnvslt) exmxopio1am n fvta(fsDtrx pou4teeomiciatlm emnmonu0 renxo oa1fa eli ol(0trtm(r3ny4aleemncsltfs2uaump;t4apenii3iydfaDrluvo u4trtnmo3tydomD lnvo;t0 ruoxr3ny1lmeeliviat aDrmu  ot1optoioeilt m uanmo (4arxrxf3iodlp eai o s)s2xrirpoydlme mivsatf 2urumonu4oeeoifciasla2uan pnu4treoio tatfm eanei;t) 2urimpnu1lpt  feta()a2rr(  ;u4tetnio3tyslm um( s u) rtoxo3iodlpDe ivolt0setr(opnudlle miviat a2ta(moot0ope ioeiasls em(vs t)artoif3to1fmDeauvi;t0s2toxm3ny1lmtnmiet ()s2tmxmonu1tpt mfetltlm ra( p;t4 lxnif3oatfatr ivi;s)texo(m3ny1lmtelnci s) rumxrpnt4tpxo ietaslaDuluvs;(4aeenif iytoptr uvslt) 2toio oydol   ivtas)sDrmuro;u0optomieiasfmDeau pnt)teerxocoytlp raivol(0srto(m iydolt licil() 2ururp;o0alt mocilslmDra( o;u)trxrxr iodlaDe i i;t0 rxoxm3nodoleelnesl( sDrau  ;o4ole mo3iydlsDuln s;t4 rtrxo3io1fmteaneo (0t2ur(opoydllt  fcsl( aDur(mono0apeniociadfs2ua(mo;(4 rerxf3oo1opD anvo s)trxoxo3io1olt lfvt sfsDtr(  ;t1oeeoifetas s2raump () lxnmr3tatomtr nei t0trxr(m3no4ol nmfcs t) Duaxm ;o1apxn i3tasla uluvp t0arxnxr3ty1opt  uei (  rxoiopnydom   iesas aDta( p;u0apt mo3ildfa2el( s u)arxoir3to1lmtrauei (  2xo(o ny1lm  miviat  ruaur ou1aeenmietltls emn pn(0trerxocoytfatrlues s0trxrxr3iy1om  lnviatfa2taxmp;t4oexniiciat sDrm(vonu4aexoircta1om  aiei () rtrxm3iy1amenlfeil(  rtr(m oo4tpe  i3ilsfs em(mp u4trxnir oy1fmDe ivsl(  rtr(m io4optnlivs (faDur(  ;u4tleoiietltfsDrau p;t4treoxo3iodfaD  uesl(  eur(o oy1aptelivs () 2rr(rpoo1texn i3ilsfsDrl( o u4aeenir3tytfpDr ivol(  rtr(rpiudame mfei sf rtr(rpnu1oee  oeiadfm uaumsnt)tleoxfcoa1fate n s s)t2xmio3iy1ame lfesl(f Drru pno0tlen ieiytfsDel( o u4tetnmo3iydoat  uvols tetr(o3nu4lpen ici s) Dum(r ;t1tpeoiictadla2rlnmp u0 rermf ty1lmDe n s t sexriopnudlm e nvtas  2rrxmp;t0olen o3tlsfs ul(mpnu0 rtoxo3tydomtrln i;(  2xoiopnu4aptemfei ( a2tmumpnu0ale  ocild s emumont0 rxnmf oa1oaDelu il( seurim iudal emfcsls sDtm(mpno4aetoioeilt sDelumont4 rtoxf3oatfp r ieo;(  rxoiopiy1amtn ivias)s2umurpnu0olxomo3iysfa2ran s;t0 rtrxf3oytom r nvs t0texo(m3nodol nlieiat)srtrx  ;t4teen ictldfsDul(ms t0trxrxocoo1fa r n olt t2uoirpio1op n nvt t  2ur(m ;o0aet  f3iyd m2ra( s;t4 rxoifctadoa e nei;t s2xoxo nu4aptnlnci (fsDumur ;o1aptomiciasla2rlump;u)tetoifctotfp ean s (  etoio no4ol  lnetas)artaxr nt0oeeniieildla2emn onu)trtnxociatoaDr n ils)teur(m3nu4al n fcil(  rtmx  ot1olx moeils m2umu on() eenxo to1lpDeanei ()srxrxrpnu4om  mfvtas  rtm(root4tlxnifciad aDumumon(4artoiocia1opt auvo;s0 2xrio3ny1ome mnvtls)aDraxm ou0oleo fciaslsDeaums t4tetomo3oodlm rai i s0 rtoio3oo4ole mfcil(  rum( pnt4opt mo3tldfs ra(ms t) ltoxf3ia1omD lnvi;s)texoio3ou4lp  mfctat  2rrxmpot1tpe mfciydfm2umu s t4 rerio3iotopD lnes s) rxoir io1omenmfvtasfsDrrurpot4olxnmieilsfs raumo () renmf3oatlp rai il()s2urim oydopee fetls) Duaxm ;u4tlt  o3tadlmDrmuvs;t)texoirctatfp rli sls)srumxmpoy1om n fvta(fartmur oo1opx iociltfmDrm( p;u4aeeoir todlpt lieslt  rtrio iydlleelfvt tf rurx  ;t1aeeniicild m ulnmsn(0teerxocto1lpDe uesls0 ruo(r3io1omenmict (f 2tm(m ot4apeo iciadls2ra(ms;(4aetrxrciatlmtrlivslt tetrio3nu1optn fvi t)s2trxmonu4tet  o3iltfsDeanmonu0altnxo3oydfm r uvo s0teto(m ny4ale lfcta( aruaxr nu1aptoio3tydla umu snu0 rxoxrcoo1oat au i;s0teurxo3nodlmenmfetl(fsrrrxro;o1tetomoctyd a ulnmp;(0aleoif3iytop e neo;t)sexmim iydome livtl(fsrra(mo;u4aexnmietysla2rau p (0 lxrmfciotlp r ivo t)srumxr3io1lpt  neias s2urur ;u1tlenmi3tas sDuauvo ()trenmocoatlaD lu o;t0setoio3nu4ap emfvi t)aDrrxro;u1oet if3iasfs ranmp t4 etomrciy1oatrli olt  rxoirpio1omt  ncsl()sDraumonu4oeto o3tadlmDelnmpn(0trerxr3io1fpt li sl(0 2xrimpio1apt mivtls)a2rrurpot1tle ifeiltfa2umuvsnt0tlenio3oatoa   neo;(0truoio iudlmenlfeilsfartaumo;u1tlx mfeiat sDrmnms;(0tetnif3ty1opDrlivsls) 2ur(r no4lme licsa( aDuru oot4aeen fciatlmDrau on(4teeomocty1opD  ueol( teumim3iu1al emnvsa(faDtm(mpot4optnif3iysfmDeln s t4teenmr totlaDrai sl()s2uoxr iy4lm elfvs s aDururo;t0olxoi
\ No newline at end of file
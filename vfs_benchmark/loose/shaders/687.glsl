@@ -0,0 +1 @@
+u i s)srtoxr no4altnmfvtlt a2tax pnu0oltnmfeiytfaDelnvp;u) rxrxf3ty1fpt  nvilt) exmir3oydameemnvtls srraxr oo4opxnioeiltfa2uaumo t0aeenxfcoy1fmDeaieils0sexr(o3nu1ame  ieil(f rurx ono1tpxn iciysfaDrmuvont4trtoio3oytfa  lneslt seuo(r ny1alte iciat aDum(monu1opeomfcildlaDel(vonu4aetrirciytfptrai s ( seuo(r ny4am nmfeslsfarurumo;u0oexn i3iytfaDrl(vp t0 rxoiocoodomtrlnvslt0 2uo(o3ny1al  lies tfsDtau oou0tpxo oeildfmDulnms t4 etrircoytoptelivs;t0 etmio oudamtemfcia(fa2rrxrpnu0oetn fciatfaDuaumo;t4 eerir oa1fmDr i il(0tetrxo3ny4alt licsl( a2raum ot1tptoioctadfs rmnmpn()aetriocia1fate u s;( trumiopiu1oltn ivs t) rumu ooo0ole  o3tytfs eluvo;u0arxoif iy1lp  lnvo;() rtm(mpio4lp n ieias sDtmum no1openmociys s2uaums t0trenmf totla rluvsls0 euoxr3oodape lneiltf rua(rooo4olxniieiatfa ul( s (0 exniociydom  aueo t0srtrio iodope  fvtls sDrrx ooo1ape mfctldfm rm(vp;t0 rtrxf3iy1fmtr neols0 2uoxo3no4ll emfvs t)arrm(mpou4oetoio3iytfa2rmnmp;(4 lxomo3tadfptranvo t t2to(r3io4lmt mnviat srrrxroou0aexn ietys s rmnvpnu)altoirciy1faDrauvo;t) 2xo(rpiu1lm   fci s  2umu  no1tpx  fctltls ean p;t4aexrmr3iadlp   nvi;s) eto(mpio1llt mfeiat  2rrum ;o1olt ioetlsla2ua(vs (0treoxfciodlp raueilt trxm(m oudome micias a2tm(m oo0tle mfeildlm2eauvs t)tlenmf3ootlmtr i slt)s2xm(r io1al nmfcsas)a2rmx o;o1oltn icilslm2umumo (4artnir iodlpDrai sls) rurxm3iu4am nmnvslsfaDtr(mp;o0texo iciys a2emnmo u0 reoxfcty1fa  au i;t0tetmim3oo1amte fctl(fs2rm(ronu1aleoiiciytlm uanmsn()aeenxf iy1faD  ivol(0 2uoxm no4lmtemnvsatfsDtax  ot1tltnmf3iyt s rmn p;(0teerxociy1fpDeli s t0setoim3oo4lp nlivia()sDur( o;u4apx ii3iltfa uaumo;u)aexnirctatoa eln s (0t2toxo3iydlmtnlnesa(faDua(mpot0teeo oetat mDraumsnt0 renmf ootoptelivsl(0t2xrirpou1open nesas s2tmum ;o1aexniiciyt sDrmn s (0 etrir oo1la e ivs (0seurimpny1lpe livilt) 2ra(mo;u0tpx  o3iltfa2eanvs (0tlxrxo3tatfpDrln s;s)s2tm(rpoodom  mfcia()sDum(rono1alt micilsfa elu onu4aleoio3iotlmD lueo;()s2xrxo3oy4omenlnvtls) 2uaxmonu1ape mo3iatfa rmnmo t4trxrxocoo1omDe neils0seto(opoodap  liesl(fartmxrpnu1oexomi3iyd a2ea(msn(4arerio ta1oaD aneolt0 2xrxo io4ame mnvia() rtmxr oo0oeto fetys aDrau s u) etoxfctotla rai il() etr(r3ny4oleemfctl(fsDuaurpnt1olx  ictyt a2um(vo u4artrxf3oatfptelnes s0teuo(r3iydole miei t)srur(mpnu0oltn fciasfmDrlu s;t4areoxo3iytomteanes;t0 2tm(r nu1lpte fvi sfarrr(  nu4tet  o3tydfaDuan onu0artnir ootfpteauvi t) 2umim iy4ame  icils)sDur(m ;u4tex  fciytls2ranms u0arxomr ootlmt lnvs;t t2umxo3io1open fvslt) rurumpnu0ale  oeilsfaDua(mp;u)artomo3oadlmt aivs ()s2xmxr iudll n neslsfs2tm(  nt4alt  feild m2uauvs;t0arxnmfcoo1fmD an olt trtmimpiu1om nlfvs t)srtm(m ou4ale io3tadfsDumn p (4 rxnxo3ta1om rlu i;s t2uo(r3iy1lme lfvsas)a2rr(mpnu1tltomietas s ran o ()aetoxf tytfmt aivilt trtr(opoudope lfcilt) 2tr(ronu0tpe ii3ils mDumu pnu0 exomocootlpDraueols) rtriopiy4omeelnci s)a2tm(rpnu4opx ifeilsfa2rmuvs u)trxrircio1lp r uei s)t2urirpnu1ol  mivs ( arra(mooo0texo ieiat s emu s u4tltnio oy1opDr uei;s s2to(rpou4apenmicsls) Dtr( o;t4aptomf3iltlsDelumpn() lxoir oy1fptranvols  euo(rpiy1lmte ieils a2uru oot1aexnio3tys s2em(mp ()arermocoytlateli ilt)trtmir nydam  mfcta(fa2rr(  ou4ope  f3tydla2rln s;()tetrxo3oydlp r uei;t)texr(rpiodlm e ivs tfarur(rono1tpxo i3tytls2ul(vo t4 lxrio3iotomt  n o;s0trurirpoy1am  lncs (f rtaxrpnt1tltnii3ils a2ean o;(0trxomf iytop   iesls  etrxr io1op n ictasf 2tr(monu0olxnmoctys a umuvs;t0alenxf3tatomDran ols s2toiopoodolenmnvi t srtm(moot0openiieiydlsDra( s;() leriocoytfpteln ils)trxr(m3ou1optelnvt tfs2tmurpot1apxniieild s umumsnu0tetnmo3tytla eanei;s)srurim3iodamt lnctls sDtm(r ;o0opx miciat a rmn ont) exomo3to1la   nvol( t2xmxm3ny4llenmnvt t aDtrx onu0apenmo3tys sDrmnvp;(0 exnmf iadfm   ieilt seumxr oy4om  lnei t sDumx pno0ape  ociytfm2rl(vo ()arxoifcty1fm eli ol( s2xmir3oudapenlfetl(farrrx pno0open fciadfm2ra(msnu0aleoif iotom r ivo;( sexr(r ou4al elfeslt  rtr(mpno4tpxnmo3tasls elu p (4aetnio tydomtrli o () 2tr(r nydamt lfei s) rra(moot1olx  iciysfaDulu s;t0 etrmo tytlp  aues;()srurir nodalt  nes t  rtmxmont1alxo fciytfs2emuvs t4alxomfcoytla  au o (0s2urio3oodome lics sfa2tmu  ou1opt mictyt mDemuvo u4alxrxo tytlm  luvo ()srxmxr iydllt  nesl(  Dumumo;o0apto i3tyslmDean o u4aetrxf3iatlmDr ieo;t)srum(m3iydlptnmfei t srtauront1tlxnmicilslm emnvs (4 rermocoadfp elivsl(  2to(rpiodlm nmfvsas  rtaurono0ope mietytls umn pnu0teeoxf ta1lm e nes s)tetrxr3nu4ameeliet t  2um(r ;u4oexn icils s2rlnvpnu)alenxr to1fm r i ols0seto(o nu4ll  mfei ()a2uau o;o4opt  f3tytlm2um( s (4aetomrcoy1oaDrlnesl()sexrim ou4al  lfesls) 2rm(ro;t0texoiiciasfaDul(vp;(0 lxnmf3ia1oa e neo t)teur(r ny1al  mfcs (fs2rr(mp;u0oet mfeiydlm2rlnvp u)trtoxo ty1lmt  ieo s t2uoxo iodol   nvslt)srtrxrpnu1apt moeiyt m rmums ()aexrxr iydfpt  n s t0srto(opoo1olee fvi ( sDrmxrono0texniociadfa rmu snt4alxoir3oo1omte ivols0 exrir ny4lm emiei ( aDta(  nu4opxoiieildfs2ranms;u4 etoir3todlm r uvols0s2trxr nodalt micta()a2rru oot4opxoiieilsla rlu pnu)tlxrxr3ia1faD lnvs (0setoim iy4apt  net t)arrrump;o0oleomfciaslmDua( o;t)teermo3iydlp   i o (  ruoir3no4lpt  fcta(fa2rr( o;o0apx  i3iyslm el(mp;t0aeermo oydop  lnei;t)setm(r3ou4optelnvs t s2tru ono0aeto fciytfs emnvp u4tleomo3iatlatrlivil(  rurimpoy1ap elicils  2tmu ont0aex mf3iatlm2rluvon()arerioctodomD anes;(0t2uoxo3io4al elncta(  rtm( ooo0alt mictls s2ra( on()alenxf oa1oat au sl(0seuo(rpoudll   fcta()s2tax pou4tpxnmfeias mDea(vo t)alxnio3oodfmtrlueol( sexoxopiy1aleemicslsf rumu pou4oexo feiytlaDulu s;u4 rxnmr3ty1opD livs;(0trurxo3iy4lp   nvsatfsDrm(m no1olxn fciltfs2uaums;(4artnmo iotoateaivo;t)sexo(opny4lptemfcsl(  2ta(  nt1tlxnio3iat m2ranmo u4 lenmo3todoa   ieo t)seto(m oydom nlfviatfsDtax p;t4tltoiociyslaDemnmo;u4arxoxrctydlm rluvo s)teurxo3nu4ol   nei sf rum(mo;o4optnioetltlm2rauvp;u)trtoxr ty1la  lnvs t0trtoiopiy1lleemfcia()s2ur(mpno0tleoiictls s2emn o u0 etrxr totomte ivo () eum(r3iodapeemnvsat)a2ua(  nu4tpxo ietltlaDua(ms;(0arxnmf3oydlmteanvsls0s2tm(m3iy4am n nct t) Dum(monu1opxnmfciasls ulnmonu)artrxocoy1fp  lnes t srurirpiudlmeelfvt () rururpnt4alxomiciydfa2uln on(4 rxrircoodfp eauei;(0 eurxmpoudomtn ietl()srrmx oot1tet  f3iadlaDrm(ms;(4 exrmo iatomDran il(  rxr(rpiydllen nvi s) 2rr(ro;o1tpe ioetydlm ra(vo;u0texoifctatfate n i t) eumirpnu4lmee fesatfsruru ono4tltomoetadfs2ranmo t0trtnxfcoo1lptrai ols0s2xrimpnodlleelfcslt  rua(mpno1aeenifetadfs el(mpnu4 etomo3iytfp  liesls)s2um(r3oy1olenmici s)a2uax  ot0optomf3iatlaDum(mont)artnio iydlmDr ivo t truoxo oudllen nvt s sDua(rp;t1apx mieiltls2uau s;(4aeenio3oytfaD  ues;t0s2urxrpnudaptn ietas)s2ra(m ;t4tptomo3iyd s rmump;t0tltomrciatlm  ln s;()setoxr oudapee nes ()s2tmxr ou4aexomietysfmDrl(vsnu)trxrxo3oa1oaD  ues ( seum(o3iydom n fvt (  2rmuro;o4tptnmicildfm eanmo t4 eeomocoytfatraieil()t2toxopoo1omte fvt ()srur( onu4tptniietatfa emumo;t4artnxr3iy1op e ues;t  rum(o3oudlpeemnvsasfsDrmumo;u4aeeoifciadfm rlnmp;u)tlxnircoa1opD lieo t0 2xriopio1am nlncta(  ruru pot0tptnmf3ild s2el( p t0aetrxf3tadop rlnvs t seur(rpiy1lpen fvtat)aDrm( o;o0opxo ictydfm elu o t4tetoirctytfatelnvi;s0s2xmiopiodlp elnvsa()aDta(  ou0olxnmociadlm2ua(vp t)tltnifctodop elnvs (0 etoio3oy4ol  lnvslt arurumooo1oet  icildlm uau pnu) ltrif todlm eanvo;t0 rxmxmpoy1aptemfvi t sDur(r ;o4tpt iieiyslm emumpnt0texnxfcoatoptelivolt0s2tmir oodame  ivsltfa2um( p;t1oeeo iciyt m emuvp t0 exoxfctotoaDeauvol(0s2tmimpoydam nlivt s aDtax pnt1oee ioeiydlmDrl(vo;(4trtoif ootlmtr ivo;t) rumirpiy1omte neils s2ta(m ou4oetnioetydfa emuvs;t0aetrif3ia1oa eaivol(0 2urim3oydomeemnesl( aDrmxm ;o4opxnmiciadlsDemnvsnt)artnio oodlmtraueo;s0trxm(o3oydolen nct t srtmx  ;t1tltomicildls uauvo u4 lxnxo iytlmtean i;s trur(r oy4lptn fei s)arraxm ;t4aeto oetld a2rlumo;()trxnmf totlp raiei;s) exr(o oo4op  mivslsfarur(r no4apxnio3tldlmDraump t0tlxnif ta1lmD  i ils0 2tm(m oydll n nci t aDum(moou4tlxnmf3iad a el(msnu)texoiociadlmD aneil( texrxo iy4ll n nesl() Duaxmpnu1tleoii3ildlm rlu s;()tltoir todomt aues s)trum(o3iodlm  lnvtlt)aDtmu o;u1apx  feiytfs2rauvonu0 lxrxocta1lpt  uei;s) rurxm no1ope lncs s)srtaumo;t0aee mo3iltlm2em( sn(0 rtnxfctodlpD ln i s0sexoxopoudlmenlfct (f Dururo;t1teeomoetas m umumo;() lxrmo iy1lmtraneo t0srxmxm3nydlp  miesas s2trum nu4opt mf3tld sDrluvs ()tetnmr todom  luvs;t  eum(o3nydopee feta()artaxmono1apt  f3iad s umu s;t)tlxnxr3oydlaD au i;()trxmim3oodlle  ici () Dra(rpoo0oeto ocilt sDumnvpn(4aexnmo oodlmt  nei t srxmxr3iu1olee iciat s2rmxm nt4olen ociad a2ul( o u0 lenxfcoo1fpD anvs s0 rur(o nu4amen feilt  rurxmo;o0opeomieiys s rauvpn(0 etrmo tadfm elu sls0srumxr3iodap nlfeta(f 2rr( onu0tlto fciytfm emnvs () ltoxo3to1fpDraneo ()srtr(opnodal nmicslsfartmxr ot0aet moctyd aDuanmp t)tltnif oadomD lnvi t0 rumxo nodopenlnvt tf rra(rpoo4aexnioeiadfm2rlumo u4aleoio3ootom  au s;t)tetriopio1oltn fcsls  Dtr( oot1aexomoctydla ea( pnu)arxomr oadomDrlivo;s0 eto(m3nu4omte fvia() rua( pnt0aex  i3iltfs2el( p (4tlxnxrctydomDr i o;s)trumir3iudllen neilt  rrmuroou4texniocild sDea(mp u0 lenir oa1fmDrau o s  2toim3iu1ole mivsls a2urx oou4tex ii3tydfs em(mo (0arxoxfcoadlmteanvo (  rxo(o iy1om nlietl(  Dumxr nu0aptnifciyd aDraumsnu4 ltnioctodlpDelivo;(  rtmirpoydlptnmici sf rurum ot1teeo i3iad s rm(vpnu0 rxrxo3todomD aivo;(0 etmio oudamenmfct (f Dtrum nu1ape  iciatlmDumu snt0artrio3ta1latr ivsls0t2xoxo3nu1lmeemfcias) 2tmxrooo1tlt  ietltfaDuluvpnt4texnxf3iatfaDr u o;(0 ruoxrpny1lpte fes tf rtmuronu4alt ifciasfs2rln p (4trxnxr ootomtrlnvo t0s2xmxrpiy4lmte fciasfsrua( oou4tpen i3tad mDeauvpnt4aexnmocoy1fpDraivo ( trtoio3oudlmtnlfesls  Dtruro;u1tee  fcilt s emn on(0 eerifcootla r ueils srxoxopiu1ap   ncils  rraxmpoo0tpeoifetltfa ulnvo;u)texnmo iotom eluei;( seumio3ou4lpt lfeilt) Dumu ont1tpxnioctydlm rm(vsn(4areoif3oatlpDraieslt)srumxmpno1lpt  fes (  2urxr nu1aexoiiciyt m el( snu4tetnircoa1oaD  ieo;t setmiopou1alen iciat) rtrxrpnu1opxo oeiydfsDeaump;u4altoio oo1oa rau i;(0setmio oydllt mnes s aDraurp;u4apt if3iatfaDulnmpn(4tlerio3oytop  aiei;t)teumio3iy4ape lfci s  Dtm(mo;t1tpx  oeiytfm uluvs;t0 eenif iotlaDr uvol() 2trxrpoo1omee nei t  2ta(rpnt0tlx iietlslsDua(monu4 eenir iytlpte u ilt0s2toxrpoodopte iviltf Draxr ;t4oetomo3ils s uau snu) rtrmo oodfmt an o ()texm(mpno1ll e fesasfaDuaxmo;u4tltn feils m ea(vp;()tetnmr to1lm  lieo (0t2xo(r3iydll elivt s)srtm(rpou1tee  oetydlaDul(mp;u0 etoxfcoydoat  ies;s0srxoxopny4aptelieta(fartr(rpnu4opxoioctyt mDrmnmpn(0trxnxr oodfm  anei;t) rxrxm iudllt mfesa(fs2rrxrp;u0tleomociydls elnvpn(4tltoio tytfpDr ueo s tetm(r iu4lptemncslsfarurx oou1oltomo3ilt s2umumo u)trerxo tatfm elnvo;s)srtm(o nudapeelfeilsfaDur( pot4oltnif3tad mDea( ont)tlermo tadopDrli o t)trumir ny4om nmnesa( s2tau  nu1olt mi3ilsfm rl( o;t0 ltrxo3iodlaDrlnei t s2xoxm3oo1omt lfesat)sDumxm nu1tptn oeiyt s ul(mp u)trtrmo iytfm   n o s)setm(o3iu4lmeemiesas a2umu  ou4aexnmi3tyslm2ea( s;u4altomr3tydfaDelueo t)trtmxmpoy4lltelfcilt a2tm(m ot1aexn fciydls2ulump () ltnmf to1fa eluesls0t2urim3nu4lpt  nct (f Duru pno4tpxnifciat a rl(mo u) eeomf io1fpte nvolt)trurxopio1lp elfvtl()srrmumpot0tex  i3tad mDrmn o ()alxnif3todlpD  n o;s s2to(o3oodole  nvtat sDrax oou1texomf3tatla uan p t) exnifciadomDraiei;t  eurir oydom  mfetltfsrtaumo;t1oeeoiictatfa rm(vp (4artnmf3todfpDrliesl(0 rxoim iu1amtn nvtlsfsrumx pou1tpx  i3tytla rm(mo (0aeenmfcoydlmDraivslt0 2xoxm3io4ome mictl() 2tmxmooo0aetomoetadla2ul(mp u)aleomrctadlpt  i s s) 2xm(m nudamtelict tf 2tmx ono0alt  f3iasfa eluvo;(4 lenxf3ty1lmtelnvols  2xmxo nudaltn icsls) Drrxr nt0tleo octld aDel(ms;u) rerio oodlptelnesl() exr(rpno1amenmics tf ruaxr ;o1tet mo3tls m elnmp;(0artnmrcto1om  luvi;t seuoio iudape lieil()aDrrur ;o0oetomoetadfmDrmuvo u0 lxomo3ia1fpDelnvo;s0 eurim3iydomtnmivta(fa2tax pot4aeenioetltfs2rmu s u4alenxo ootfaDeau i s0seuo(mpiy4lm emnvsl()srta(  no1ope if3tas m2eaumpnt0alerifcoa1omD  i i;s t2xoir iy1ap  lfvilsfsrra(r nu4opeomf3tlt sDeln p;u)arxoxf ia1latrln s t0seto(m nu4opt mnetasfaDtaxmo;t0olxn iciaslm ul(ms;u)tetrmocoa1lm  an o;s0setrirpny1amt mfei sfaruaur nt1oetnmfctlsls emuvo u) etoircootfat aivslt0texrim3ny1altnlnct s) 2taxmpoo0opeomfctytfmDeanvsnu0alxoxr oy1om e i sl()s2toim3iy4lptemfvta(fa2trx onu0tlt ifeildfm2uauvonu4 exrxr3iadfmDe uvsls)t2uriopou1opeelnvtas) 2urxm oo4oex mf3ilt s rlump;u4trtoxrcoydfatraivilt)t2uoiopno1ap nlivias  Duaxronu0aeeomietatlm2rmuvont4 etomo3iydlmtran s;()truoir3nydoptnmfvta() rrrx o;o0altn iciasls2elnms u4arxriocto1faD lies;t  rtm(rpoy4ll elivias)a2rmxmpou4tex moctatfa emnvp;(4texomfcoodfat lnvil()tetmir oo4llte ncia( a2urumono4tex if3tytlm2emnvp;(0 lxoircoodfp rlivi;(  rur(opio1lle lfei tf 2rr( oot4apenio3ildfa2ul( o u0artnio3iadom  aneilt0trxm(m3nudolenlnci (  rtaum ot0oeto fctadlm2uanvp t4 ltnxf ta1fpD anvi (  etm(opiudamenlnvslsfs2trurpnu4tpeo oeiatfaDelumsnt4 ltoxo tytfmDr n ol( srxr(o3iudap   feia(fsrtrxmpoo4alenii3tytls2rluvp;t4tltrmr3ty1fpD  i i;(0seurimpoo4lpeelnvtat)s2ua(monu1opxoifeiyslm2umu sn(0tetoir3tydlm  auvo;t)srurxo3oo4ope  iesls s2rm(m nu0aptniieiltla2um(ms;u)aexoxo oo1lmt auvilt0s2tmxmpnu4al nlfvs (fsDuau ooo4alxo i3ilt aDemnmp;t)aeeomfctytlmtrau ilt)setrxo3nodam   nei t) rrmu onu0olen ocilsls rl(vs;() exoxo3ta1lateanvi;s  euo(m3nudamt lnci t srraxroou0tlx  ieildfm2ea(mont0trtnmociotfaDr ies t s2xmxo ou1opt mnesa(fa2tmxm no4tlxn fetatfm2umn o;()aeenxrcoadfa   i s;s0t2trxmpoydlpeelneias)srrmurooo4aetoiieias mDran s;(4tetoxo3oydfptrlnvi t t2xoxr iu4opt lnvsasfsrtaxm ;t0texo ietldfs2umnvonu)aetnir3oo1lm  aieo;t0 etoiopiodlp nmfctat) Dumxrp;u0aee mo3iysfsDeaums;(0 lxrmf ta1fmD auvs;(  rtoxm3iy1olte fciat)sDtau  ;u0ale moeiyt a uanvo u0aetnmociy1lpt lieolt)srum(m nydomen ivia()srra(rpot4texnmocilsfa el( pnt0trtoxrcoydfat aivs t  2toxr oodlptelfcsa(fs2trxrpnu0aptnmfciasfm2ul(mo ()trenmf to1om eaieol( srumir oydope mnctltf Dtmx p;t0tpeoifctls s2umnvon(4 rermf3to1opteli ilt0t2xo(m iy1om  mfet t)sDum(r ;o1oet mieiat aDeluvo t)aleoxocoydoat lnvs;(0trxm(r3oy4am n nvs s a2ta(mpnt0teeoioctytla2rm(vsnu4 renxo iytopDelnvs t)tetoxmpny1ome  nvs s)a2ta(r ;o4apxnioeiadfsDel( p u)aexomf io1fpD lnvo;s  2triopiydalt mfvsa( sDta(m nt0open fciydfaDemnmp;t4 eenxo3iadlm eluei;s  2tmxo3ny4aleeliei s aDuaxr oo4tpeomfetyt aDra( s;() rtnxociy1faDrlnvo;s0s2xoimpnydamtnmnci t)aruaum nu1ale moetldla2ean p;t0trxoxrcootlatrln o;(0setmxm io4apt lfetas) Draumoot4tex mfeiadlm emnvp;t4 eerir oydfpt au o;t0tetmxo no4lptelicsa( s2rmxmooo1alt  feiyslm uauvp t) rerxf iodomD lneols0 etrxm nu4ameelfvilt)s2trxrono4apxo ietyd m rmnmo (0 rxrif3ta1fp e uei;() ruo(rpno4op  lnetas)arum(mono0aee mfetltfm ua(mo;t) exnir oatoaDeau ol(0t2xrxrpiu1op emnvtl()artrxr ou1ope  ocilt s2rauvont4trtrmo3oo1fm rli s;()srxoxr3oo1al nlicta(  rurumo;u4tpto o3iyt a rauvo;()treoxocoadla e u ilt) 2umxo iydolt mneia() Drm( o;u0opxnmi3iyd mDemnmp u0aetnifcoadopt lneils tetrimpnodale  nvs t)s2rru pnu0tlxnmfeiydlm2umumo u0alerxf3io1optrlu o;t0 etrio iu4lle mnvt ( srurxmoot0alx mieiatfmDranms u)tlxoxociotop e i ilt0s2uoxopiy1lp   ivs s s2um( pou0alenioetld s2rmnmsn(4texoir3todomDelieslt s2urio3nydom emfesatf rurx poo0tlx  f3iat aDrl(mp t) exnmf todfaDe ivs;(0trtr(rpnudlp elivi tfsDua( oou4openii3tls m2ea( o;t0trtoxrcoydfm rln s;t0 rtrio3ou1lpt  nctas)sDumxrpnt0olenmf3ildls2rmu p u)aleoif oy1lmDranei t0 etrxopno1omee fctlsfs2trumpoo1tlt io3iadfsDra(vs (4trenxo totoaDelivo ( trtoxo3oodllteliet s)sDtru p;o1ape io3iydlsDea(monu4 lxrifctotfmDr n ilt) rurxr ou1altelivsatf 2taum no1tlx  fctys mDum( s;t4tlerio3iytop  lu i;s)texr(rpnydapte ivt s  2ur(ronu4tet micilsfs um( ont)artnif3oydlmtr iei (0s2ur(r io4omenlfct t sDtmu  nt4olen ieildlm emn pn(0aeerxfctatfmDr uvolt s2um(r ny4lmenlicta()a2rm(r ;o4apxo f3ildfs2rlumo u) rxoxocto1faDrau o;(  rtr(r3iy4lmtnmfcilsfsDtmxroot1tptn fciadls2umn o u0 reoxfciotlmtraneols0trtoiopnodop nlfvtasfaDumxm nt4alxoio3iyt m2rl(ms t4 lxrmr3iy1laD luei s0 2xoxo ny4ll e fes tfs2rmxmo;o0teeo feilsfaDua(vo;(4 rxrxr iadomD anesls) rur(m3iydlltnmieia(f 2rru o;u4tle mf3iat sDemn o ()tlxrioctotlp ean olt  etrirpoudopte ncta(f 2tru pot4tptnioeiasls umu o;u)teermr iotfate u slt) rumio3io1lltn nvsls s2trxm ot4tlx  o3iydlsDrlnvpnu0teeomf iatfm rliei;(0seumxmpoo4olt lfcs tfarurxmo;o1aexomfctyd a2umnmpnu0areomf3ty1fm  lnvi;t0 rurxo iu1open fcsat  Dumum nu1altoio3iaslmDelumo u0 rtrir3iodoaDraivo s0 2xoirpiu1lp eliet t a2trur nt1olxnmf3ils m uau p u)aexomo oy1lat ai s;( trxo(r oydlptelfci s) Drmxmooo1apt  o3iasfm uanmp t4 lerxo3iy1omtr nvo;() 2xr(o oy4altemicslsf Dtau  ou0tpe mf3ild a rlump t0trtniocoatlm e neilt0srxrim ny4lpt  feiat)aruaxr nu4tlxn oeias a2raump;(4 rtomf3ootfptr i i;t)t2to(m ou1apt mivsls sDtr(m ot4aee io3ils aDuln s u0 reomrciy1lm   iei;t trurxo iy1ol nmfei ()aDtm( pou1ole mfciys a2umnvs;u)altrmr3oatfa r n ils0 etmirpoo1apt  fvt s s2tauronu4olxoiietatla2emnvs;u) lxnmr tytlpD  neils0trxrxm3ny4omen fetasfs2rr(mpou0tle mfeiltfs2ulump;()altomo to1lmtrlu ils)sexmxmpno1alt mics (f 2tmxrpoo1tptnmieiyt a rluvsnt) lxomo ootlmD lnvsl(0 rtrio iu1opt lics t  2rmu pnt0apxn ociys m rmuvs;u0 etoxrcoo1lat ai i;s) 2xrimpiy4am  mieils) 2umu  nt0tlenioeiytla2um( o t0 lxnxo3iatop   i olt0 euoio3ny1olt lietls) 2ra( pno4altn ietlt m2emnmp t)arxoxocia1laDr ivsl(  2trim oy1aleelnci s sDuax p;t0aexoiicilsfmDraumpnt0 rxnxf tatlat ln ol()srxmio ou1lptelfcs ()a2tr( o;u0ole mi3ildla rmnvs;u0teenmf ootopDrau s s)sexo(r io4om elfcsas)a2ua(ro;t0oeenii3tas aDulumo;u) exrifcia1fpD ai i;s)truoxopiydap  mfeil( sDumu pnu0tltoiictltfa2rluvs t0tlxrmo oydom eaieils)s2trim3oy1lmtelfetatf 2rrur ot4oetoif3tld mDemuvs;u0arxrxo3ootlatr ues;s  2tmio nudomt lfeia(  2urx p;t1tpto iciatls2ul( onu0tlenmo iodla  ai ol(0 2toxrpiy1ope  nes s  2um(mont1apenifetydla2rl(vp (4aexoirciy1fpt  ues (0s2urxo nu1omt mfes s) rumxmpnu4aeeo fetat aDeau on(0 rxnmr3ta1fmteau s;s)t2tmxm ou1lptnlfesat aDtrx ono0aptn ictytlmDemuvs;u0 lxrmfcoa1omD  nvi;(  rxoir nu4opt  nesasfs2umxm nu0tetnmf3tad a elnvsnt4 exnif3tatomDrlnes;t s2to(m3iodlm nmfetasf rtrxr ot1tet ifetytlm umu p;(4 ltoio iytfmDr ivo;s) rtoim no4altnmfetl(  2rmumo;t4ale ii3iatlm rm(vpnt) etomf3tatfpDelu o;s)srto(rpnu4lpteliesat)aDurump;t4tpx moeiyslm uln pnu0tleoif tadoptrlieols0setmxr3nu1al n nciat aDua(r ot4olxnmfctad a2rau o u)trxrmr oydfat aivolt setr(m3oo1lmee iviltf Draxro;t4oexnmo3iydlmDum(vs t0aexoxoctatomtr uvo (0 euoxm ny1omt lfet (faruax o;u4olxnioctad a uan o (4aexoxr3ootoa   i olt0t2umiopno1lmtemncias a2rm(mont0optnioeiltfmDrm( pnu) rxomo tytop rlieo t)srumxr iy1lme mnctl()srum(m ot0opt  fetadfa2ran on(4 rxnxr iodlmtrai sl(0teuoxo3iudome mneta()aruaxr ;t4opt iociatfs umump u0 rtomocoa1fa  lnvi s)trtmio oydame  iesls) rraxront1apto o3iytfmDelumpnu0 etrio iotoaDe ueolt0t2umxopiy1lmtemnct ()s2tm(rono4aet  oetld s2eaums;(4 rerxo3ia1lptrauvs ( sruoxm oodllt lfeiatfs2rrx  ;t0oeenmociadfm2rauvo u0alerxocoo1fmtrlueols  2umirpoy1alenlivi t sDrau  nu0olxo i3iydfs em(vo () ltoio3oydlptean s t0trtmir oy1lltnmfvilt) Dta(  ;o1alxoiiciat aDulumsn(0arxomo3oy1oaDrauvo s s2xo(r3ny1lmenmnvtl( sruaur ou0oltomo3iydfs ul(mo (4 lxoif3totfmD li s;()s2trim3ou4ol n ieil( arta(ro;o1oetoifctytla2rm( o;u4aeeoir tadlp   nvs s0 rxoirpio4am elict t s2rm(mpot1texn o3tlsfs2rl( s u0alxnxf3tatopt aues;s0s2toxo3no4ol   feia(f Dumu  ou4tetn feiadfs uau onu)tlxrxoctodlmteli ol() rxoxr ny1omtn nesl(f 2tm(rono1tpt  i3iaslaDem( s t0aexnxr ootfm eai s;t0 2urxo io4lm n fct (faDumur ot4tetoif3iatfsDrln s u)trtoxrcoy1fptrlu sl()seuoxmpiudolt mivs (fa2uaurp;t4tlxomi3iat sDrmn o;t0tlxrmrctodfm  lues ()seuoir3oydome mnvslsfs2uaxmoou0oet ifetldlaDrlnvp u0 rtnir ty1fmDe uvo ( trurxo3nu1am  livs t)artmur ;o4aet io3tyslm2ra(vp t0arxnif3oodomt  ieo;t0seto(mpou1apenliesl(fsrrrxmpot1aeen ociasfsDrm(mpnt)trtrxo to1lp raieol() 2uoio iudape  ivilt)srrmx o;t0aexoiicilslmDeanvo t) lenmociytlpte ueo;t) rxoxm oydlmte fcils)s2uaum ;o0aptn o3tatls2el( p;u4 rerir oytlmD au il( texrim iydlp  mfet s)aDum(m ;o4opxo ociltfm2el(monu0tltnxrciotopD anesls)t2um(opiudome  nvtas  Dtrxronu4optn ociyd a2rluvs;t4 exnmr3iy1lpt  uei t) eurio3ny1lmeemncia( sDrax o;o1tpxomo3tltlsDemnvs u4 rtrifctadopt aies t)s2xoxo oodlpt liesls aDrr(mpnu4tpto fctlsfs2rl( s t4tltnio3iodlmte nvi ()s2uoxo3oy1op n fes t aDtrumo;u4oetn feiasla ra( pnu0arermocoatlmDeli o;s0sexoxrpno4llen ivta(f 2rrxronu0tpxniocias m ranms () etnxfcoatlate i s t t2tm(o iydll  mnct t)arrmumoot1aeenmo3ias a eluvo;t4altomrcia1faD  neils texoiopou1lp  mncia( sDtaur ;t1aptniociltfm uauvon(4alxnir3iotfate ieo t  eum(r3oydomtemnvsls srtr( o;o0tet  iciatfa2ean p (4aexrio iotlaDr ueo;(0trtoxo ny1op nmivsasf rtaxmp;t0olx if3ild s2ranvs;t0texoirciytlpDeluvs t  2xrio3nu4opteliei tfsrrm(mp;t0oleoif3iltfm2umu o u4 eermr3oadoa rauvils)texoxrpiy4amte ictas)srtmx  nt0texo feiytlmDulnmsn(4aexrmfciy1opDr ivo (  rto(o nu4olen nct t a2rr(ro;u4apeo iciys sDelums;u0 rtoir3totlptelivs;t) rum(o3ny1ol  lfeslt  rurx oot0openif3tltls2ranmon(0altoio iatfateauvsls0t2um(opiy4ape livtat arta(ro;u1oee  f3iydlm ul(msn(0aeeomfciydoat  neo;t)s2umio3no4lpt mfeiat)arua( ono1olt if3iytfm umump;(4 leoxfcio1lmDrauvs t trumxm io1alt licsls aDuru ono0optnmieiatlmDuanms t) rtrxr iatom e i o s)texm(m3io1ope  fvia(fsDtrumoot1aex io3ild m rauvo;u0artrxf oodfpt auvs;()t2tmxmpnodal emfei t)a2rmxmooo1opxomfeiaslaDrl(msnt0 rtnif io1op   i i;s  rxo(rpou1apee nvil(  Dtrxm ;t0aetomociadls eln sn(0alxomf ia1oa  anvils  exm(rpnu1ap  livtatfsrur(mono4alx mociysls rauvp;() lenmfctadfp e uvo;s0sruoxr3no1op  mncsltfaDuaurpno0oeen i3tydfmDea(ms;t)alxnmf3oatfmteaieo;()teumiopny4opt  ncias)a2rmurp;u0oeenifeiltlm2elumo t)aexnmr tatlate ueo;s0 etmxm iydop  lnesat  2ur( ono1apxo ieils mDulnmp;(4tlenmr oadfmD lneol(  2tr(r iu4ol e fvsa() Drmxr no4olxomietys mDranmp;(4texomfcoa1faDraivo ()t2umio3oy1omee ictls  rtmu p;t1apeomi3tyslaDrauvp;t0trtnif io1oaDrlnvsl()srxm(r3oy4ol   ncilsf Durx oot0alxomf3iydls emn o (0 lenio ty1lat au o;t  rtoxrpnudom e fvias a2rmurpot1teeomocias sDua(vpnt4 exrxf tadfaDr nesl( t2xrxo3iudapeemfesasfa2tax p;u0teenmoeiadls2el(mpnt)trtrxr tydfat  ivols)s2toio no4lmee icta(faDtrxmpoo0tpx iiciyt a2uaums;t0 lxrxo3oodlmD lnvo t0 euoio3nu1al emivsl( a2tax pnu4alxoii3tadls rl(vp t)trxriocoo1lpDrai i s)trtoxm oudom nmivi s s2trumo;u4tltoii3ildlmDran sn(4 etoir todla e nvs s) eto(o3oydlpte ncsl()sDuaxmpno4apen oeias a eau s () lxomf iy1lmtrln il(0 2urio3ou1omtn fctlt aDtrurpot1openmo3iytlm2uln p t)texoiociadfpD  ivolt s2xmio iy1lpe mieilsfsrrm( p;u0aleo fctyt mDua( on(0 ltoiocia1laDr i slt)trxm(rpnodllt  iet s)sDurur ot1teeoiietlt m2uanvo u)arxnmo3oytop  auvsl(0 rto(m oo1ap   nci s a2rmxr ot4aee  fctydfs2ra(vs;(4trxrirctytlatelieo s seuo(mpno1opee fctlsf rra( pnt4tptn iciyd s2um(mp t0alxoir3oatfm e u s s texm(r oudlm nlnvia( s2rr(root1teeo o3iltfs rmu o;t0 lenmf3oadop   uei s)srtoir ny1op emfvsas)artrumo;u4ape ioctasfaDuan p t)teerxoctatfaDe nes;t0sexrirpiodlle lfct t) 2rm(rpoo0aleo feildfs rmnvp u0 exrmrcio1lp  li i s0trtmxm no1lmenmieiatfs2uau onu0aet if3ils m2uluvp t0tetomrcoy1omDrlu olt)srtrxo3nu1am   ivt sf Duaur ;u4apen i3tadfmDua(mo;t) rerxfcia1om  livi;(  eur(r ny1al  miet t sDtrur nu1aee io3tatla2el( snt4 rtomfcoodlpteai slt seuoxr3iy4lp nmicil(  2ta( p;t4oexniociydfm ulnvp;t)arenio todlp eluei t)trtr(o oy1lmtelncils  rrmuront4alt mfciysfm2uanvo;(4 etnmf io1lp e u il(0tetr(rpiu1oltnmnvsat sDurxmp;u4oex  ieiydfm um(vo;u)tlxoxociy1fa  aueslt0 rurimpou1op n nesat)srrmuront4ope  oetyslm2uanvp t0trermr3iytfpDrauvslt) 2to(r3iu4lme  nct s  Durxm ;o4oeenmfcildlm2rmu onu4 rtoirciydfptrau ol( sruo(o3ny1apeemietlt) Dumumoot4oet  feiatfa em(mont0treomr to1fm e nei;t) rxm(opoy4lpt  iesl(f Dtaxm no4oetnii3iatla2ulnvo;u) eerif3oo1op r uvs;(  2xm(m ou1olt mfeias)aDra(rp;o1aex  o3ias mDrln p;u0texrxo iatlaD  u ilt  2tr(m oy4lltnmnci ()a2umum no4oltnifeiadlmDean p;u0 rtnxf totoa elivol(0 eum(m3iudap e neil()srurur nt1tltnmieiysfa2uln pnt0alerxo todlpD luvol()trtm(o3iydol emict t) rrmur ;o4tlxomf3tatfaDrmu pn(0 etnxr iotlmteauvi;( trxrio oo1altnmnci ()s2rm(rpot1teeo feiys s2emu p t4 lenmrciodfmte uei;(0trxo(o3nydom  mnvtat  2urxm ot0aee iicildfa2ra( s;u)aeermr3tadop rlieil()t2tmim nodomenmfci s)sDur(  ;u0texn oeiad a ulnvsn()tetrmr oy1oa  lueil(  2toxr oodlm  livils aDrm(moot4olx ioctatfa2elumo (4trenmf3oodomte nvsls  exoxo iydomt  icias s2tmx ono0opx mi3iaslsDra(mo;t4teenmrcoytop r ues t t2xoxr3oo4op  lncs () Dum(ronu1oexomf3iadfmDumn s;(4teermr oadomte u il( t2xmxmpnu4ame lfeta() rrru  nt0opxnmfeiad mDelnmo;u4tetnmf3tytlmDe n s (0setmir io4omenmnes t  2umum ;u4openmfeiasfa em(vo t0aeenmr todfp raivi;t  rxr(m oudlltelfcs t arrrx  ou4optnmf3iltls2ua(mp u)tltoir totlmt aies;(0srxmimpiy1ap nmfctl( aDrmx pou4tlt mieiatfm ea(mp u0 lerif3iy1oatelnvo (  2xoxrpnodllenlncsls aDtrurpno4tpt ii3tldla ua( s () rxrxf tydfa rau o ()s2tmxopiy1lpe  fvsl(f rurumpnu1oex  icilslmDrl(mp;t0trxrxf3ia1oaDelu il(0srum(mpny4omtelnvt t)a2rm(mp;u1alenmoetyd m umnvp u0tltoir3oadlp e ues;s)teur(r3oudlm e fci tfarrmump;u1tee ifetys mDul(vo (0aleoxo3to1lm raies;( t2ur(r nydape mfvil(fartmxr no4oleo octysfm2ulump;t0texrxr3iydfaDean o;s sexoio oudamee ieia()sDurum nu1opx mfctydla uaumo;()tltrxf oytlmDelnvi;t seumir iodlp e iesas  Draum ou1tpeomo3iaslsDea(mont)tlxnioctydla ranvo t0t2xoxrpiu4ol  lnei tfs2ua( p;t1tleo feiltlmDrau s () lxnio tatop  ai o t) 2xrxr3oudamtemics ( a2ua(rpoo1tlenmi3iat a2rl(vs u0texomrctydop rli o;( s2umxo3iy1aptnlfetasfsDua( ooo1apt if3tyd m2el( s;t4altrio oa1opt luei ( texmirpnodamtnmnetl(fsrur( onu1oeeomf3tyt m uluvpnu)tltoircia1lp rai i t0s2xmio3nydlp   fcta(  rtmurpoo1oeenmo3iat a2el(mpn()teerir3tytfp eanvi;t) ruriopiudam nlfciat)sDrru onu0aetoii3iadlm2rau onu)aetomr tydomtrlieo;( t2tm(m io1om emncsas  rtaumo;o1aeen i3ilt mDem(vo;u0 eermo totlpteaieo;s)s2tm(r oodamen ivi tfa2rrxr no1teen oetls m el( sn() ltnmo iy1faD anvs (0 2ur(r3oudll n fviltfs2tmumont0olxnii3ias m ua( p (4 eenxo3iotoatelu o;t0t2xrimpoy1omt  ici tfaDtaxmo;t1optoio3tydfmDuanvo;t4trtrxoctotlat  nes s0teuo(mpnudame lneslt artrumo;o1altomiciydfa eau o u) etrirctatfm rli ils)teto(o nodlltn nei s aDtrxm ou0tetoifciatla elu snu)texrir oa1lmtrlneilt0t2trimpoo1alen ici tfs2tmuroot0opxo iciatlsDel(mo;t)trxomoctodlmte ivols seuoxmpno1ol nlieiasf 2rm(rpno4oetn fctad aDranvp;u4aexnmo3iy1faD ai s s)teumxmpiudopt  ivs t a2taxr ;o1aexniociasfm2eanvsnt4texomf3iy1fp  auvsls0t2uoxr3iu4amen fvi ()srtrxm nu4ape if3tyt m2eaumo;t) eenirciy1lpte uvo;()s2toxopno4lm  lfeils) Dum(mp;o1optnmf3iasfa rauvs;t4aexnxr iotlaDe ivilt0s2umxr3iodlltn ncslsf Duru pnt0apxo feild m2ua(vs u)aexnxfcoytfm e ueil()t2urir no1omen net ( srrrx pnt1apeoioeiyd m em(vonu0 etnxr3oo1lmDe u i;t) rtr(mpou4lltnlnvsat) 2um(rooo1aetn iciatfsDrmu o u4 ltoif3iydlmDraivils  eto(rpnudomt  fvia(faDrmxmono4tpenif3iad s ran onu4 eeoxf3ootfa e nvi;t0 2umio3nudole mfcsat  2rrum ot4altnmoctydfaDuanvp t)tetoxrcoydfpDeli il( trurxo3oydll  mivsat)arrax p;u4olxoioeilsls2eluvs u) rtnxf3iotoatr uvo () euoirpou4omt liviat srtaurp;t1apxo octlt m2ua( p u4tlerifcto1op eai i t0srtoxrpny4lm n nvi sfs2tm(m oo4tetnifeiyd sDrlnmon(4trerir oydoa rauvo;()t2xo(m nu1lpt mfct t)a2tmumpoo4optnmieilt a2ul(msnu0 lxnxo3oydomtrauvi;s  rxmxr3iudlm elnvs tf rtmu oot1oexo fciytla2eluvs (0 rerxf3oa1lpt  iei s)teuo(o iydamt licsa( s2trxmono1oeeoio3iltfsDrlnvp u4 ltnmo3oatlp  luvs;s) 2xo(mpnu1ope mnvsa()aruax p;o4oee mfeiatla rmums u)tlxrxrcoy1opt  ieol()t2umim3iudamenlivtas) Drauro;u1olx mfctltlmDem(mo;(0texrio3iytlmtr u o (0sexmxm oudop e nctat)sDraumpou4tltn o3iadfm2uanmpn(0tlxrir3iatlm rli o;()t2toxopny1altnmics sfsrumum oo4aleomiciysfm um(mo u0altrxfctadomtelnvo ( srurxmpnudal elfvsas sDtmx poo4tpxoio3iatfs uluvsnu)tetnmr3iydfmte uvi (  exmir ny1ap e fesl(faDua(root0texoiiciys a ua(ms t4trxrifcty1lpDe nes t0 2xrio3io4apee fvslt s2urx  ;t1opxoiiciat mDum(von(4 eenmrctodoa   i s;t trxmxr3oy1lm nmnetltfa2trumpou0olx  f3ilsfs el( p u)aeenir oydlatr i ils0 2toxr oy1lp emfvi ( a2um(  ;o4olx ifcilslaDemnvsn(0artrifcoydlpD livo s t2trxrpiydlmt mfesltf Dua( pnt0tlen ictytfa2ranvsnt0tlxnioctydoat  u o s)srurxr3iu4olenlfes (fsDtm(m ;t0tetoio3tatls rmumsn(0altoir3oy1faDr ivi;s t2trxopny4ole lnvt s)s2tmxr oo1olto f3tyslaDul(ms (0texrio ta1omteauvols) eurxm3oodame  ivtls)arua( pot1tee mieiyt m2em(vo u4trerif3oa1la e n i;s trum(r3iu4ol nmnetl(  2ua(  nt0ale ii3iatfs um(mpnu0 etrmrctytlpt  n olt  2umxr nu1oleelfvi ( a2rmxront1oet ioeild m2em( s;(0 reoifcoa1fatr n s ( srtr(mpiu1olenliet tf 2raxmono4oltomi3iys mDemnvonu)trxoxrctodfa eln o;s t2toim3nu1alt  nci tf rraur nu0oee mo3tlslmDuan o;u0 leomo3iodopD au ilt srtmimpnydope livta( sDuaxr nt1oeeo f3ilslm2rmnms t0tleomr3oa1fmDr u s;s)seurirpny1llt  ncias srrax pno0aleomictatfa umuvp;t)tleniocta1fm e uvi;()t2uo(m3ou4lltn fcsls) Dtrx o;t4texomietldlm2ulumo;(0tlerxrcia1fp rlueo ( t2ur(o iu4ame mivslsf Dta(mo;t4tlto o3iaslmDea( p;t) renxf3oy1lpDrauvols tetoxo3nodap   ics tf rrm( ooo0oee iieiydlmDul( pnt0altoxr3oodopDrli olt)seumim3no4omenmivtls s2umx  ot0tpeomiciys s elnms u)aeenxo3oy1lmt livo;t0 2tm(rpoodol  lfeias aDrrumo;u4alt iiciyd s2ra(monu0 lxrmfciatfm r ieo t0 2umim3oodlm nmfcta() 2umx o;u1aexn oetad aDrmn o t)teerxocoodfm  aueo;t) 2tmim iodom nmivs s)aDumu onu1opxo ieiysfsDelnvo;u4tltoio3tadfaD aues t0s2xoio3nydlp e ivi t srrmxrpnu4tetnmf3iad m2rln pn(0tltrio tadfpDraueo;s trxmir nu4apt  fet ()s2tru poo4altn ociasla elumo;u4alermfctytomDrlneols)seur(mpoo1al   feils srrmxmooo0aleoifciasfsDum(msnt4 rtrmrcoodoa  lnvs (0t2xrimpiydlm e fviltfsDta( oou1tleomociatfa emuvs;u4altrircoa1lp  an il(0 exm(o ou1apenmnvsasf 2rmumpot1olto oeias a um(mo;t0trtrmf io1op eau s;s) rumir iudlmtn fesls)s2rm( o;o0texnmieiasls umu o t) rtnxf3ia1oa  lnvs s)teum(opio4op elivt t)artru o;t1tlxoiociatlsDrl(vpnu0 etrmf3oadoptranei;( seurxr3oy1open ivtas) Duax pnt1texnii3ild sDrm( o (0alxnmfciadoaDrluvi t0 2toiopny1omeelivslt)arrr(r ;t0alto ictat m rm( p (0arxoio3tatfaD  ivo ( trtm(o ou1optemfvsls srtr(  ot1tpenioctyt m2elnvsn(4areoir tytlaDrlnei ()t2uoir3iydll emfctlt s2rau  ot4oltomictas aDra(mp t4arermf3iodom ran s;s  etm(rpnudomt mnvilt srtrxmpou0apt  fetat m rmuvpnt0tlxrmrctydomt  uvi t sexrio ny4lpt lfvsas aDtrxm ou1tet mf3tlt a2el(msn(4 rxrxr3tytlpD an i s)sexm(m io1opeelnetasf 2trxm oo1tpxnifeiadlmDeanmpnt4 etoiocto1omDe neo;( t2xoxr3oudlmtnmfesl(fs2rmumpnt1altoiieilsfm ulumo;u4texomr oa1lmDrli s t0srtrxo3io1apeelncta(f 2rmxr nu1tleoifetlt a em( o (0 rtomr3tytla elu i;( trtr(opnu1olte ivsatfsrrrx oot0tpxomociyslm2ua( s u)alxrifctadlaDrai slt  eum(m3iy1lltelfvsl( s2raumonu4oleomieiadfmDel(vsnt0trtoif ootoa e neo s  2trirpoudol n iei sfaDta(roou0aeto feiysfs2um(von()trenxr tydfaD anvi ()s2uo(mpoo1apen nesa()s2ur(moou0olen oetas a rmn s;u0 rtomo oadfatelieo;s  rxmim3oy1ale  fvtat) Dtmxmo;u0apt mo3ilt sDelnmo;u4 leomf iatlpD livi s) rxrxm3no1lm nlivtasfs2ua(m ou1tpto i3ilslaDuluvp (4arxrxr ty1fpDrluvs;t tetmimpnodap   fcslsf rumu oou4texnioeias s2em(monu) exoir ty1oa e nvs ( setm(r oydol nlnesltfs2raumpnt0tetomociytla rl( s t4alerxo3ia1lpt  ivo;() etrxm3iydlmeelneils)sDurx o;t4opt  fciatlmDumu s t0 rtnxf oo1fmtraivs;t)s2tr(m3oudopee ivi t)sDraxrooo1oexn ictatls2ulnvp t)trtnir iadlm eaueilt  etmxopiydlpeemfci tfaDra( o;t4opt mfctltlmDemnmo t)teerio totfmtrlu i;t0trtoxmpoydam nmfes () rtru  nt4aee  f3iytlmDrl( p t0 exoifctydfmtr nvils0 euriopoy1oltemieia() rtaurono1tpx  fcilt s2ra(ms t) eerif3oydlatranes;t) 2tmir3oy4om emfes ( srrmxrpno4tetomfcilsfa el(von(0 lxrxrcia1lpD anei t truoimpoodop elfvtas srua(m nu4tlxnmiciytlm raumo u0aeermfctydoaDran i (0 2um(mpiu4altemfvslsf Draxm nt0oee ifeiydlm2umu s (4tlxnxo3oytomDrluvilt0t2um(r3oo4lmtnlfeta()a2uru  ;u0oltn f3tld a emnvo t0arxnmocty1fpt aneils)trur(r ou1apenmfcsls a2uaxrpot1aeen ieiltfa rau s t4altnxr3iydoaD  u slt0 rxrxr oodaptelnvia( a2tru ono0aeeoii3ildls2ul(mp (4texnxrciatfmDr ueilt)trumxm3ny1om  mfcs s)artmurpot4olenioetydfm2ranmo;t0texoif oatfa   i i s  eum(o no4altemnetl()srrruroou0optoifctas a um( sn(4aeenxfcoy1lpDe u ilt0seurxopoydomenlnci s)s2tmumoot4aeeomietldfs2rluvs t4altnxr3oo1fm eli ols)setrio3io1ome lieils aDuaxm nt0oetniociasfaDuaums ()artnmf tytomt lieo;t tetmim3oudlp elfcsl(fs2ra(mpnu4tlt micilsfm2rauvsn()arxnxo totoatrlnei;() 2xmxr3iodom e ncsl( srtax ono1apt ifetyd m raumo t)trenmr3oadfaDr ues t0seumxo3nodalenmfcsa(fsDrrx onu0ape  f3iys sDuluvo u4tetoxoctadoa e uvil(  2tmxr nodoltn fcsltfsDtaxr no1alxo f3iatlm ua(ms u)aetnif3ta1optraneo (  exrio3oudopeelncia(fa2tmu  ;o1olx  octlsfs uanvo u)arxoir tydlmtr n o (  eumxrpno4lmenmivi ( sDrr(rooo4tpx  oeilsla uluvsnt0alerxr3ty1fmt  uvs;t tetmir nudlle  ici (fsDtaxm ;u4oex  oeiltfm2umnvs (4 rtoir3oydoa r uvi s0t2urim3oy4lpeelnciat)srra(rooo1tptoif3tyt s rm(vo ()altniociotoat  nes (0setm(r nodop e fcsl(faDurx  oo4texnioeiadlsDua( p;u)aexomf3oodoaD anesl(0srtmxo3iydalte nvi s srum(rooo0tlt mfciat s ranms;t0artomf3oo1fmt anvilt0trtmirpio4amtn ieias)a2rruroou4aee mieildfsDra(vp (0teeoxrcto1opDrai il(  rxr(m iy4omtn fesasfa2rrx poo0apxomo3iyt sDel(vs t0alxoif3tydfmtrauvilt0 2tm(rpoo1am   neslsf rtrxmoot1oeenifeiltlm2rlnvo;t0 rtrxf tydla  aivo t)trtm(r ny4altemfcta(  2tmxr ;t1oexnio3tldlm emuvs;u0 rtniociatfa  livol(0srtmiopnu1llte nesatfa2uaxmoou1tet iictldls2rmnvp (4 rxrmr3ia1fpDrlneils t2xr(r nudol  liet s) ruaxrpou1opx iictas aDelnmsnt)aexomfciadla eau ilt)t2xoxr3no1apte fes sf Dtaxrpot4aexo o3ias a2uauvsn(0tleoxr3iadlpt lueo;()setoxmpoudolenlfeiat)arua(m ;t4oltomietat s2rm(mpnt) rxnxo3iydopD  nvi;s)texrim3oy4lme lfcilt aDtrxrpou0tlenmiciydfm rmuvp (0aeenxo3tadomD luvol(0 exoxo3iudapt lfci tfarumu poo4oetn iciasls ea(vs t4trtrmrctotlmtean ol( srurxo no1opeemnvsasf 2tau  oo4tpxomociltlaDemnvs ()tlxnxo oa1lmD an o (0truoxo ny1openlivs t a2tmu o;u0tee  icilt s2ean s (0 reomo iatla rln il(0trxo(m3nu1lp emfcs (fa2raxrpno0tlen i3iadlm2umu s;t4trtoiocoy1lateli o;s)t2xoxopiu4olt mneil()s2ur(mpnt4tleomietydfs2rl(vp;u) ltomfctydoa rau i;s)trurxrpnu4amtnlictltfa2tmu oot0tlx io3iysfs emuvsnu)tleniocoytla  lnvolt) 2umxo3oo1ome mnei t) rurur ;u4olx mfetyt s2rm(vo t0aeeomo ta1fpteaiei ()srum(r iu1apt  ivslt) rumu  ;u4alto ociadlmDelu o;t0 rtnmf3iotopDe i slt t2trim oo1ome  ieta()srrr(mo;t4tetoii3iasfs uluvs;t0artoxf oa1opD  n ol(0t2urimpoydol  mfet ( a2uaump;o1tpeomo3ilsls ea(vo;u0 eerxr ootfp rlieolt0 rumio3iy1omte netlt sDrm( o;o4tltnif3tatfm umn pnu0 ltrio iodlaDraivilt seurir io1lm   icils sDurur oo1opxn i3tydlaDelnmo;(0alenxrcoatomte uvs s) 2tmirpio1ll  lics s a2rr(monu0oex mf3iys a2um(mpn(4 lxnircio1lat anvi s0srxm(opnodll  mivi ()a2raxro;t4oltnmi3iyslsDumumpnt)tltnmr3iydopD  u sl()s2toxmpnudlmenmfviasfsrtrxmpno1tlto octlslaDuaumo t)tlenxf oa1fm rlnvo;s0t2toiopny1olen nciltf 2trumo;t1tpeomi3ildfa rl(mo;()tlxniociy1lpDelnvil(0s2tm(r3iu1ale liesasf 2taxmpnt1oexn iciytfs rl( pnu0texomr to1fateanes;(0 etm(o no1ol elfcsl()srtmur no4tlxn o3tldla2rl(vsnt)texrmfctydlptrauvs;( trurxm3iy4lmenmncslt)s2tr( ont0teeomieildlaDuanvp ()tlenmo io1om elu ol( setrxm3oy4ol emictl( sDua(r ;o1openmoeildfmDelu o;(4tlxoifctotfateanvo;s0 2uo(o3ou1lp nmfvt ()s2rm(mpno0tlxo fetlt s ea( o;u0 ltoxo ia1fa eaies;t)trxoiopiy4lp n ncs sfsDumx p;o1tlenifciysla2um(mpnu4 exrxf3totoateli o () rtm(r3iudolee ncil( a2trxm ;o4opto o3tltfs em( p u4 rxrircoodoa  li il() euoxr3ou4ap nmfesatfsDtm( ont4oeeo f3iadfs elnms;(0 rxnxocootomDe neo;t)s2xrir oo4ll  lfcsl() rururpnu1oeenmfcildla umnvo u4trenxo3io1om eaies;(0t2uoxr io4apt mnvt s arraxm ;u1alxnifeiydfm em( s ()alxomf oadoaDrlnvi ()teto(m3ny4lp   nes sfsDuax  ;u0teeomf3iltla2em(vpnt4aetomf3todoaD ai i t0t2xoio oo1apeelfeslt artm(  ou4oee moetytfs2emnvsnu) etrmocoatfpt lieol() 2toxrpnydap  liet t) rtr(m ou1alenii3iys a2ul(mp;(4artoxo3totoa  aivo s)t2uo(mpoy1om nmnvsls  Dtax o;u4oetomociadfm em( sn(4tltnio oa1lp ran o;(0 euoio3iy1alte fes tfsrumxr nt0apxnmo3tytfsDrl( p (4 lxrif ty1fmDeliei s0trumim nydol  lfcsa()s2rmxrpnt1opxomf3iyt aDum(vsn()tltnmfcoydfmt  u o;t setrxr no4lmt lfvtat s2taxr nt1oltomfcilt m rl(vo;(4 reriocoa1fm elivs (0sexo(o3ou4olt licsa(f Dtm(  nt1tlxoifeiadlaDrl( ont4aetrxo3ootfa eluei;t0 rxr(m io4ole  ivt s)a2urumo;o1oeeo i3tasfs2el( s t)treomr iotfm elieils0s2urxr nu1lmtn icsas)a2tmxm nt1alxn oeiaslm rln s (0 rtrxrctotoaDeaivs ()trtr(r3iu1ame lnetlt)aDur(moou0apeoifeiad m2ean o;t4altoir3ootfatranvols0 euoxo nydoptnliet t arrmu p;u4openiiciyt a rm(mont)tetrmrcty1omteluvs;s0 2umio io4amtnmfesas srrmump;o4opxnmi3tld sDra( snu4aeerxr tytfa eaues s truoxm3nu1opee ncta(f rum(root0oeeomocias aDean o u0 lenxo ootoa r ueo s0t2xo(m3iy1ome  feiasfsrtrx  ou0tltn fctytfs ulnvo (0alxrio ia1oaDrau slt0 eur(o3nydomeemnvtasfarrrurpou4tltn fciyslm rmu o ()arxnmf3iadlateauvi;( teuoir3oy4omen ncslt)arrmx pnu1alx mieildla rmuvo (4 rtnxrcia1fm  luei s0t2urxr iodame  net (faDrmx o;u1altoii3iytla2uau p u4aeerirctatfmtelu o ( trurim3ny4amen ivtltfsruaxmoou0tet  fciasla rau s t4 lxrmr oodla e neils) 2xoxm oudape mneiatfsDtmx  oo4tetomfcils aDran on()trxnircoytfmtr uei;s trurxr3no1oleemfvt (fsDum(m nu4aet io3iys aDulnvpnt4 lxrmf3iydlaDeaivo s  2xoir oudam   ivt s)a2trump;t4apenii3iatls uan s;()aeerxf3ia1omtranvi;s s2trio io4lmenmfctlt)s2um(mp;u1tptnii3tas a eanmpnu0arxrmr3tydlmtr uvs ( trxr(mpiy4op emnvsasf rumx oou4oee ifciyd m2ean p u4 etnxo iy1laDr ieo s srumirpiu4ll nlnvs tfa2tmumono0apxniietld m2ra( pnu0tlxrio tadfate nvo t0 etrio3iy1omenmietlt sDurxm ou4tpen i3tadfa ulnvonu4aeeoir tadlmDr ieo s0trurxm ou1om  lnetl() Dumump;u0teen f3iyt sDrlnmo u4trtoifctodlp  anes;()sexo(r iudopeemivsa(fsDtmu  oo4open fciadls el(ms t4 rtrif oodlaDrlu o;(  euoim3ny4aleemfviatf Durx ono1tleo icilslaDeln snu0 ltomo3oydfp rau sl()tetm(mpiudlpte ivsl( artr( ono0oexnmieiytla elnvp;t0 etnxr iytfa  lneo s) rtrir3oodopt  fetatfaDurxrpoo1tpt moetydlaDuluvp;u4trtnmf3oytlat ln sl()teuo(o3iu1lptnmnvt tf rtau pnu0ale ii3tyt aDrmuvpn()aexnmf3oa1fmDe u s;()teum(r oy1ll e fei s aDum(m nu1olx io3taslaDumu o (0 rermr tatla e i s;() exrio oy1amtemfct ( s2rmxr no1tltnif3ils m2ra(mp;u0texoxr ty1fptrau ol( sexoxmpoydal   neiat)sruax pnu1apeomf3iad m2ra( p;(0alxoxrciy1oat anvs;t) rtrir oy1llenmieilt) rrm(r ;t4tle iieiyslaDraump;() ltomrcoydfaDeaieo;s sexo(o3oo4oltelfctas)a2ua(monu4oltomfcild a2rlnvp t0altoxo3to1fmteaues;t0setmxm oodaltn nctls s2trur no4texo i3iys m2el(ms;u0artrif3tytop  ln s;s sruoxo nu4ol e fei s)aDtaxrono0tlenmi3iatfsDemu pnu0tlxrxrcoadop rluvil()s2tm(mpio1lm nmfci t s2ur(mpou1apeo ociyt m ea(vp;(0artoxo oy1lm ean s s)setm(o3ny1lltelietat  Durur oo1ape  fetasfaDra(msnu)aeerio ta1lat  ivol() euo(m nu1ap emivtlt)s2uru o;t4tlxnii3iatfm eanvpnu0 lenxf oo1fp rln s;t)truo(opno4oltnlnesls)s2tmu  ;u0apto oeilt sDel(ms;(4trxrxr3tadlpDr ivo t)trumir3oydol   fctls  rrmum nu0tetnioetldfs2el(vs;(4teenifciytfmtelu o ()s2xriopou4lpenlieta() 2rm(r nu1opxnioetldfm rmnvp;u)texoif oy1fmD li i ( t2to(r iy1am elfetl(fa2rax poo0olto oeilt m2eanvs;(0artnir3todlp rau s;s t2xoxmpoy4amee icsl( sDumxr nu4apenmociytfa2ulu s;()artnxocoadlpDeli ilt) 2xoiopoo4lmeelivs (fa2taxrp;o1opto iciadlsDraumo t0 ltoir oatopteaivolt)texrirpiudapen fvt tf 2umx ont4alt ifciasls ua(mp;()alxoxfcoa1op r ieols s2trir no4ale mnvi sfsrum(  no0tleo ociadls rauvon() exrxf3oadfmte ivo;s0t2xrxopno4lmt  fesatf rua(ro;u4opto ieiadls rl( p;u0trtnmocty1oatrau ilt0tetmim oy4lmte fvs t)aDrmu p;t4tpxnioetltls uan s (4 eeoif ta1fm rlneo t  rumir oo1ap  mfctlsfsrtr(  ;t1optn i3ilsfsDel( onu0altriocoo1oat  ivo s)trtr(r3iu1ale mfvs ()aDrmxrpoo1opeoifetat a umumont) exnirciydlpDeanei s t2umxmpiy4ole  fct tfsDrrumo;u4tpenii3ilt s2ran p u0tlerir3totoa rlnei;t srxrir oodaptelncs (faDrmx pno1aeto ictatlm eauvpnu4 renir3oatom rlivi (0 rxr(o3nodlpenlfcsl(f 2umumo;u4oexnif3tyd aDem(mp u4tltrmr3to1om rauvolt0trxrxo3ou4opee iei t aDraxmp;t0tpt miciys sDemn o;u0aeermo tydlp r nvil() 2uoxopny1ame  fetasf rtaur ot4tpeniieiadlm2emn p (4tleoiocta1oaDraivi s0 rtmimpoo1om   fciat) rtmumo;o1alt mfciys aDrmn o (4 renifcia1lmDeaueil(0 2xm(mpny4am  mivta(fsDraum ou1opeoio3ild a rau o;t0trtoxo tatfm  lues s0s2tr(m3iu4opeelnvt ( artmu pou4tetniictadfa2ulnmon()alxoio3oy1lpDe n o t0trurxr nu4al elnci ( s2trurp;u0tlt if3ildfs2uanmo t4 lenxrciy1lpDr neols)trxm(r3ny1apeemfvs t  Dtr(r oo4oex mociysfs rl(mp t4aetomociy1oaD aivolt) 2xr(o3nydlp n nesls s2umxmp;o1opx mfctys s2em( p;t0 lenirctodoa  luvo t0s2toxopno1llte fcsas) Durump;t0oee iiciatlm ul(vo;() rxnmo3oy1op  lu o ( srxmirpou1opt  nvs s)artru o;u4aet  oeilsfm uluvo;u0aexomr oodlmDeauvs (0trxmxmpoy1amt lnctatfs2urxr no0opeoif3iltfs2rmu o;(0aeeomocootlptraneo ( srumxopiy1om n ivils artmur nt0altnmfeils a2rl(ms;u4 lxnif3ia1laDr n sls)t2xmxm3ou1ol e fcilsfa2umum ou1ope ii3iydfm2ulu p;t4 eeoio iadlmt an i;(  rxo(opnudom e feilt s2ua(  nt1ape if3ils a2ua(mon()teeoxocoydlp  lues () rxm(o3oudam  mnctltf Durxroot1olenio3iadfs2ra( p;(4tleoir3iatop eauvi ()tetrirpio1opt  net sf rrmu pnu1tleo oetatfs2ulnvs t) rxnif oy1lmD aiei;()srxoxopoo4ll e net (f rta(  ;o4tpeo i3tlslm2rlu sn()aexnxo3todop eaneol()t2xoirpnodap  lics t)arrrxrpnt1olxn feiaslm2uln s;u)texnircoodoaD an o;(  rtoxo3oo4amt mnciasf rur(moot4aleomi3iytlaDumnmo;u) rermo3tytfateai o;s) 2xoio nudolt lfvils a2um(mo;u1teenii3iaslm2rlumo t) exnxo3iydfa rlneo;s0trtr(m oodlmenlici t srtmu  ou0tlx iiciltls uaumo t)aeenxo3ty1opt  i o;t0 rxr(r3iy4alt lfvia(f 2rmuroot0apxn f3tatfm2uln on(0tleoio oytop  lnes;s0teumxopoodapen ici t)arrrx  oo1olen o3tlsfs ua(mp;u0 rermo3ta1faD an s;(0 euoim io4omenlfet t aDtrumpot1oeeomi3tytfaDelu onu4 rtomf3ootlmDeluei;t)s2xoir iu1lptelnvsltf rtrx p;u0aeen i3ilsfa emu o;u0teeoxocoadlmD livsls0t2xrxo oo4lm e fvtat aDua(mpoo0tetn ociyt aDra(vp;u4teeoxo3tatlmt li ol( t2xm(opiodlleemfcils a2ta(rp;t0tet iietydfmDranvont0aexnir3tadfp rlneols) 2toxr io1apt lictasf 2rmxrpnu0ape mi3taslaDua( o;t4tlxoiocio1omDrai s s0 etrio iudomen fvtatfaDuaur oo1oleoii3tld mDrluvp t)altoxo oy1oa rlieils)s2uoxm ou1op emici ()s2rmu pno4opx mi3iydls em( o ()tlerxo iadfm  ai o (  2tr(o ou4optemnes t  Dra( o;u0opxo o3tat m rm(mp;t4tltrxo3todlatelu i;() 2xmir oudlltelics s arrmumooo4opto ieiytla2uluvp;(4artoxf3tadlpt li i s)srtrxo3nydomt micils arrr(rono4tle mo3iadls ea(ms t)trenif3ootlp rauvo;s0 etr(mpoodoltelnvtltfartaumooo1tlx mf3ildlmDel( o;t0 rermr iy1om eaivs t) 2toir nudomtn ictltfarumxmp;o4alxomieiyslsDrmn ont0aetriocoytomDraivil( srxo(o nodlpen ivs t sDtrum ot4tlxoio3tatfaDea( pnt4trtomfciadoatr ies s0 etmxo io1olte ncs t) rtruroou4olxn fciys m el(vs;u)trerio3iodoaDe neolt0t2urxopiy1ape mfctat  ruaum ;o0apeo fciydlm um( p u)aetoxo ootlmt au ol() ruoxr iu1lmenlfcsa(fsDtr(m oo4oex  fcils s rlnmonu0 exrxr3oodfaDr n i;s) 2toirpny1ll n ivi s)s2taumoou0oexoioeiyt a2eaumo;u)aexoio3totlaDe uei s0t2toir nodap nlfviasf Durx pno1tlx  iciadls umu s;u0 ltnmo3oodlmtrlnvo (0teumxr iy4ol elivtlt)a2ururoot4tpenifciltfa um(vo;u)trxoir3iodlptr u o (0t2xo(o nudlmt livsa( arrau poo4opx mf3ildfs em(vp t)tltoxo3ootfm elnes s0srxmxm3iu1ol   iesa(fs2uaxrpoo0aexnioetydlm el( s;t4trtrxo oydfaD  ivols0s2xrxm3io1optn fetl(  Dumumpou4tltnioctytfm ea( pnt)tetnir3tytlaDrau ol(  2toim ou4oltnlivsa( srum(  nt0apxo f3ils aDea( on()arxnxfcootlpD aueo s)seum(opoy1amtelics ()a2rmum ot4oetnmfctltfa ean s;()tltoxo3oo1laDe i s (0seurxo3no1lp emivta(faDtmu pno0tpxo fciaslmDean onu4areoxfciodoate nvilt0srtm(r io4lptemncs s)arrrxmpou0apt io3iydlsDeln pn(4aexoio tadlatr n o t s2xoim iudlltemfcils)s2ra(mono4tptn o3tadfa rl(mpn(0aleoif iy1omDe uvi s  2trxm oydom nlneils  rtmum ot0apenii3ils aDumnvs;t4 eenxf3oo1opt liesl()teumxo3nydome  nvtlt) rumxmpno4apto oetltfm elumo t)tlxrio oy1omtraneslt0 2to(r3oy1om nmnvs () 2trxmooo4ale  i3iasfs rlnmon(0tetnircoo1lm raues;s0 exrxo3iu4ol nlivtas) 2umu p;u0tltoifeiydfmDumnvsnt0alerio3oo1omt liei;t)teuoxopiu4lle lieslt)srrr(r oo0oltn ietldfs2umuvs;() rxoxocoatlm   i il(0teur(rpoy1lp elfvsasf rta( p;u0tleoio3ilt a2rl(vpnu4altomo iytfmtelnes s0t2uo(r iodap nlfeil(fa2trumoot1aptn i3ildlm2ra(mp;u0tlxnircio1fa r n i;t tetmxmpnydalen ict s s2ta(rpnu0olxnmieild aDuau s t) exnir todfa rlivsl()t2trxm3nudol nliesls) 2tauroou4aex mieiytfs ulnmsn(4 ltnmrcia1omteaivilt) 2xoxo3ny1lmt lfvtls)a2rmxro;t4tlen oetatfm ua(vsn()aexnmfctodfa eaneo;(  rtmim oo1am   fci s) Dumumo;o0alx iieilslm uau o;(4aetnifcio1lm r nvo s seumirpnu4om  livias)aDumxm nu4olt ifctadls ul(msn() ltnif tytfpteaivs (0s2tmir iu4olenlnct tf 2rr( o;o1alx  i3tatla2ra(mo;t4tltnxf oa1fpD li i ()srxrir3iydlle lfeta(f 2taxmpot1olxnmo3tysfa elu o;t) ltnir oy1faDr nei t0 euoxopnu1lmtn netl()a2taxmpoo0tleniietysfa rmums;(4 leoio3iytfpt lnvs (0 eum(opno1al  mnesltfsDrru onu0aptomo3iatls elnmpnu)trtoio3tytfmDr i ils0texmir3io1ol  lnesa(f 2raxmpno0tee ioctys a2emnmo t)aexrmo oa1la  lieo;t)setm(o3ny4amee ictls) rtrx pnt4apxn icildfm2rmump t0altrmf iodoptran sls truoiopio1om elfcta(fsrrmu oot1ape iociysfm2umu o u)areoxoctatlaDrlivi;s0t2urxm iudlp  lictas s2tm(mpnt1tlxomietyt sDra(vont0aeeomrcoy1om rlieil(0srtoxo3nydalt  iesat) Dtmx pou0tlenmoctlt a ua( o t4 ltoxo todfa elu ilt0setrxmpno1amt  ietls)sDtm( ono4tptnmi3tytlmDrl( o;() eermocootlatrlnvi (  rxmiopoy1oltnmnvi tfs2tmu oot1oltnmfciadlsDeauvont0 exoxr3iotfpDraieo t0trxoxmpny4ol   nvsls  rrrxro;o1alt if3tlt s ran p u0 exrxf oodfmDean olt srxoxo iu1ap emnvt t)arrmx pot1tlx  oeils aDrmnvpnt) lenxf3tydfmtrlnvs t  2umxmpoodlptnlnct sf 2um(  ot0aetnmoetytfmDea(ms u)tetoxf3todlmDelnei;s0s2tmimpnodopt  fcilt) 2rrx pnu4tpeomo3ilt m2rlump;u4tetnxf3oytopDr ieo;t0sexrimpnodap n fvt t sDta(rpno0ole mf3tltfm2rlums ()aexoxrciytoa rluei;s)sexoxopno4llenmfvs (fsrtau ono1oex io3iytfs eaump;t) eenxf oa1lpD auei;s) 2uoirpoydopt  fvsasfa2tr(mo;t1tpxomi3ildla2em(mpn(0aetrircoytfa  lu sl() 2xr(m3iy4ap nmnet t a2uau  ou1aet mfcilsfsDrm(vont4 eenmf ty1opD lues;()t2xo(o3io4lm nlfvta(fsrrm(rpnu1aet mo3tatls2rlumo t4tleomrctadopDe ivo t)trxm(r iu4ol   ict tfa2rrx o;t0tlxnmocias a2ul( snt4artnmr3oydlaDrluvs;t)t2uoxrpnodlp n net sfsrrm(m oo4aexn o3ildla ulu p u)artrxrciadla e i slt)setr(m3no1optelnetltfaruaurono1tpt  iciatlmDuauvont0alxoxo3to1late neo;s) eurir3iodll nlfcsas artaumpoo4oex ifciydfsDeluvpnt)arxnircoo1omt au s t  2xoio no1lle lfesas s2rm(rp;o4opeo oetlt mDranvo;u0teermoctydla eanes;s0tetm(r oudome  ictltfsrraumpnt0aex  fetytfs2ul( s;u4tleoxfctytfa   ues;(0 rxmio3io1ap emfcias a2taxmonu1apx  o3tyt aDemnmpnt0 exnmf3oatfa rliei t0trtr(rpno4lm  lnvsltfa2umu o;t4oetn i3ilsfs uau pnt0aeermr io1la rauei s)seumir iy4amee nvia( srurxmp;u1alt  oeiysfsDulu p;()tetoif3oydla   i ilt)teuo(o3no1opt lfvtatf Drm(ro;t0aeenmiciatla2elu ont)altoxf io1om  lu s s0seur(m iodlmeemncsasfs2rrxr ;t1ope ii3iyslaDeln p;t)trtoiocoy1fpDran s s0tetrimpiu1ol emnci t  rrrum ;u1olxn feildla2rmu o t) rtnxr3iodomt  ues;t0teurxr3oo1lmeemfvtls s2raxmooo1tpxniictldfsDul(mo u0aleoxr iytfmDeaivo s)s2xr(opou1al elicslsfa2ra( ooo4opxo oeiat mDrluvo;t4teerio tadop rlnvi t0setr(r oo4open nvtlt)arta(  ;t0olx mictadfm eanvp;()trxrmf3iytfpt aivi;()srxoxo3nu4omen nei sf rtr(  no1tet mieildla2um(vo t)aexoircoadopDrln o;(0s2trir ny4lltemfctls srraxro;u0tlenii3tasfaDeanms () exrircio1fptrln o;t0 2trxm io4opeemict (f Dta(  nu4ale ifetyd s rm( p ()texoxr tatlaD anvslt s2xmirpoodolte fcilt arurum no0tlxn feiatfsDeau s t0tlxrmfcootlpDraieols0s2toxm3ou1am emivt s s2rm(mpno0tee mi3iltfa2elumpnt0 eenxo3oy1lmDrauvo ( seurxo3nydom   fvsa()arra(m no4tex iocilsfs rlnms u4areomr3oadfptr nvo;s srtm(rpoo1am   netltfaDurur ot0aexomi3iysls eauvs u4alenif ty1fp   nvol( trxoxr ny1lptnmictl(  rrau pnt1tpt mieiadlmDrmnmp;u)tetnmocoydoat  ueo;s0srxo(opno4opt mieilsf 2ra(ro;o4aeeomfeiytlaDumu onu4tltnmr3iy1la eai i;t0sexm(m3nydaptelfcslt aDtaur ;u4open icild s rau p;t0altoir3oy1fmD  iei () rumir iu1aleelfesl(fs2rmxrp;u0aleomoeiysfmDel(mo;t4 lenxoctodlpt luvo;s trxoio3iu1opt mietat) ruaxrpno0opxomictldlmDean s u)aeenmr totfm r ivilt  2urimpnu4op n nvtas)sDtaxr oo1ope ii3ias s2rlu p (0 eeoxf3tadlpDrlueslt0s2xmir iu4llt  fcsls  rurxm ou1tlto iciytfaDul(vp;t)teerxo tadom eli i (0trxm(r3nu4openmneia() 2trxro;u4opxnmiciasfmDrlums;u)trenmo3totlmDr ivilt)trur(opnudlm elfvia( sDuau pnu0oeeomo3iat sDea(vp;(4tltnmrciotlmDelnvil(  etmxopiy1aptemivia( sruaxront4apx iiciltfm rau p;() rxnmf iytfpDrli o s)t2ur(m ou1op elnviat) 2taxm ou0aleo i3iadfm rm( s t0 ltoxrciytoateanvo ()srtmio ny1lle mfvtlt srrrxr nu4oltnioeilt m2ea(vo;(4 rtrxo tytfaD  iei t0t2xm(m iudapeemfcsatfsrtaxrpno1aetnio3iat m rmuvs (4 lenmfcoydlp e i i s)s2xmxm io4olt lietas)aDrrxrp;t1alenmf3iltlm2rlu pn() rxnifcio1fp eanei;() rxo(opoydom emneils)a2trxmp;u4optnmfctat s2rluvs t0arxnir oydfaD  i ilt seurim3oo1lm  licils srraxro;o4opeomi3ildlmDranvp;()tltnmr3oatopDrau o;t  etmxm3nudlme  nviltf rua(mp;u0alx ii3iydfsDeanvonu) exrif3ty1om e n s ()texrxo oodllenlnvsasfsrurx pot1tet iietadls uau s;t0arermo3iodopteluvi;t) rxrxr iodol  mfcsas  rra(m nu4aeenmictytfa2em(mpnt4alxnxo3oodopD  ieolt seum(o iu4lp elfesl()a2umur nu0tet mfetltla eau snt4tltrio3oodoateliesls)t2trimpio4lpenmfvs t a2tmxr oo0apxoii3tas aDuau o u0 rerxfcia1fpt li s;s  etrio oudome lieias arrmur nt4alx mi3iadfa2ua(mo;u0tlxoxf3iodfateln ils trumxm3oo1lpeelnesat  Drrx pou0tee if3tlslaDrmu s u0trtnxr3tadlm   ivs;( texrxopiodlltemict t) Duau  ot4tltnmfeiyt a eauvp;() etrir oodoaD aiei;s t2um(rpno4omeemicsas)arumum oo1olxn oe
\ No newline at end of file
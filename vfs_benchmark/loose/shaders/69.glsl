@@ -0,0 +1 @@
+nvils) 2ur(o ou1lmen icilsfa2rm(r no1tltn fctaslm rau snt0trxrio3oytla   nvol()setrxmpoy1altnlicilt)a2rr( p;t4tlenmociydfmDrm( snt4texniocia1lpteau i (  2um(o oudam  mfei s artaum ot1olxnif3tydlaDelnmonu4aetnif3todfp   i o ( sruo(m3iu4ope mfct tfa2urumo;t4aee  fciadls ra(ms t)aetrxf iotlaDraneols)t2urirpnodlpte fcs tfsDumurp;o1aeen f3tlslm2rmnms;() etrio3tytopDr uvsl(0texo(r iu1op   ncsa()s2urx o;o0oee miciytfs2um( s u) ltnxf3oadfmtranvs;t  etmio iudol n fei (farrrx  oo0opt  o3tys a2umn sn(4 rxoxocia1optrau s;t  2xoir no4ll e nvsl(fsDra(r ;t4apto f3iat a eaums u)trxomo totlat aueo;(0srtmio3oodlpen ivsatfsrrr(rp;u4tex io3tat s2em(vp;u)artnir iadomt  ivi;s)setoim3ny1oltn feils) 2rrumo;t1alxoiietytfs rmump u)artnxr3oodlmtrlues s  exr(r ou1olt mictl(  Dum(m ou4oetomfetatfs rlnvsn(0tltoir oatopD anesl()t2umxm3iy4llt mfvt s  Dtau pno1tpxnmo3iltla2elu o;t)altoio oa1om eaieo s teurirpoy1ome  fvslt)arrmuroou4tpx  ieiydfa2rlu onu) rerxfcia1lpD li i;t)t2toxopou1apeemfcslt arrmu  nu0alxnmo3iatls2umnmon(4aexoxo to1fm ran ols  2urxmpny4lme mfcias  Drrxmpno4altniiciyt s rmu p;u4 ltrmo3oodfpteanei;s0 2uoxmpou1lm e ivt tfartrur nt0apxomf3ias m2umuvp t4tlxrmf3todlmDeaneo;(0tetoir3oy4amtnmnes tfsDrax pou0apenii3tysfsDulumsnt4 rtoxf3iy1op   u il()trtr(r nu4lm e fvi s)s2tax pou0ape io3ilt aDrln o;()areoif3oo1lat ln i s0seur(o ny1lp emnesa()aDra(r ;u1aet  f3tldfs em(mont0trtnxr3to1laDeluvol() 2urxmpiodom  mivsa( aDumu  nt4aexo feiltfa umn s u)artnmo3to1oat lneo;(0trxmxm3iy4optelfvsl(  Dtrumoou1alx ioctadfm ea( on()aetnxf3oy1lm eluei;(  etrxr3iy4lmt mfet tfsrtr(r oo4aexnmfctat sDuanmp;u4aeerir3oodlpDr n i s  rxo(r3ny1apt  ieia(f Dumx pot0tpx ifctltla2ulnmonu)areoxf3ty1faD auvs;(  rurirpnodam nlivsls sDtau pno1oltomi3iadfsDrl( p;u4 lxoio oydoa eau sls)trxoxm io1ol e fetl()a2rr(rp;u0tpenii3iasfs2uln ont4tlerxocia1lmtr u s t teurimpiu4lpt  ies ()srurum ot4texomo3ilt m eln s;(0alxnmo3iytopt  n o;s0srtr(mpny1ale mnvta( s2raxroou1optomoeiat a ranmp (4 exomo tadopDrlieo s0trtmimpiu1omeelncil(  rrmxmont0optn oetltlaDean s;u0tleoiocoytom  anvi;() exmxo iy1om   ictas)arum( pnt4oee  icias s2um(vp;u4 lxomf to1omDeli i;s setmio iudole mnci ( s2trur nu1alenmociad mDrluvsn(4 etomoctydlmt  neil() 2xrxmpou4am nlfcs t) 2urx o;t1optniietls a eluvo u0teerxociodoate u i s) 2urxm iodll  lfvs s)srrmxr nu0tltoiieiltfmDuauvp (4tlxnmf3ta1opt anvo () 2xr(mpnudol   ietls sDta(  ;u4apeomieils m2rmumon() rxrmr iadoaDe u s;s  2xmio3no1opt  nvtas) Dumumpou4tpen f3iydlmDrl(vsn()tetrmr iytop elu i s0 2toir oo1lmen icsat)arumxmp;t1aexn fcilsfa2rl( s;t4altoir3todoa rlueol(0t2xoxmpiu1lmtnmnesatfa2rrxrpno1texnioeild m um(mpnu)altnif3ty1fatr n slt)truo(opiodaleemnvta()aDurxrpnt0apt mieilsfmDelnvsn(4 lxnxf iy1fm elu ils) 2tm(rpio1op  lfeslt)sDtm(rp;u0tpenmf3iyd m2rmuvs;t4altrmf3ty1fpD  neils  2uoxm3nydolt  icias)sDrm( oou1opxo f3tydlm2rau o;()trtnxf tadlmD ai s (0srxrio nu4lmtelictls) 2ra(  no0oee  oeiad m2ea( s (4artnircoodlmDrli i t0 rxoxmpiu1apee fcia(fs2rm(rooo1tex mo3iys m2rm(mo;(4aexnxrciodfa r i o (0 rtm(rpno1op  mivs s) 2trx  ;u0oee if3iysla2elu pn()teerif io1fpte ivs t0t2toxr3oy4am nmnvsat)aruaurp;u1tpx mociatfa ua( pnt4 rxoio tatom rli o s0 rxoim io4open ivtas aDumur ot4tle  i3ild a2uaumo;()artnmfciatfpDelivs s0texr(o3io1ll   fviat) 2tr(mpot0aeeomo3iyt s eanmo;u)arxrmf3oytomt  ieo ()srxoimpnodlp e neiasf 2rrurpno4apen feiltls2uauvon()arxomo iy1lmtr n sl(0t2uoiopoy1apen nctas) 2umxr ;t4tee mfeiatfs ea(mo t0tlxrir iotoaDrlieils  2uo(m3oydolt  ict t)a2raurpno4altn ieiydfs rm(vo (4 lxomfcoadfm r i i (  etoxm3ou1op   feia( arraxm nt1tleomfciatfmDeaumpn(0altrircoa1lmteaiei ()t2toimpny4op  lfvsls)sDrmu pot4olenmiciasfsDuaump ()aeeomf oadlmDr uvs;( srtoim nu4ameelfctatfs2taxr ot4tpen i3iltfs2eaump;t)teenxr3oy1fp e u sl(0 etoim3nydoleemnct (  Drau pnt0tlt  fciys a2rl( ont0tlxrio3oy1opDeaivs;t)sexmxm3io4optelnet tf Duaxmooo4apenioeilt s elnvont)tetomfcoa1faDe neo t tetoxr ou4optnlict s s2rm(mpnt1texomieiaslaDraump;u)texnxf3oytomD luvo s)srxrirpiu1ap   fct s s2rr(mooo1tpeomf3iytlm2ean sn(0 ltomr oadfmt  ivs;( t2toxo iodlpt mivsa()sDtmxm ou0oeto i3ild m uan onu0texnif3oo1op r ueo s texoxmpnudomtelfcta( aDrmumono4oee  i3iytlmDuanmont0alxrircoatfa eaneo;s0trtr(r ou4lm nlneiat arrmu p;u1tptoio3ild aDuaumonu)artoxf3iodlmDrlu o;(0seur(o3iy1op   ies tfsrrr(  ;o4alt mf3iatlmDemn ont0arxoir3tatop  luei;s  2trim no1op   iei (  rtr(mp;o4oexo f3iydfa2rlu pnt)aeeoxr tatfp eluvolt tetoim io1oltnlnetl()aDtm(ro;u1oetomfeiadlsDumu s;(4areoxr oodla  livs;()texrxrpiu4lltemicsatfaDrr(m ot4oltnioetys aDulnmsnt) lxoio iotoateau s t)texr(o3oodam  liei t)a2ua(mono1tptn oetatlaDul(vpnu4 leoxfcoydfaDe uesl( texr(o ny1lle mfctls) rtaxr no4tet  ociasfm um(ms (4artnxo ta1lat  ueolt0 ruoxr3ny1ll nlnciat)aDum(root1tlxo ocilt m el(mp;() exoxrcoy1lmteln o t0srxmxo no1amt mnctls srtmu pot4oeenmieiyt m2elnvsnt0aexnmo iadoa   u o;s0tetr(mpio4oleemies (f Drau  nt0aeto fctyt m2uaumsnu0trxnmr oytla r ieilt0 rxo(o ou4ll nmnctlt  2ra( oou0tpxn ocils s2rm(vpn(4trermr ia1fp  aiei;t0trto(r3io4ap elivils) rrmuroou0apxn oetatfaDeauvsn(0 eenmrcoytopDelnvs t)trtrxmpoy4ol   fet s  2ur( p;u4tlenifciys m2emn p;(4artrmr3iatlaDran s;t  eum(r iy1lp  mivslt a2tr(r ;o4altn i3iydfa2eluvo (4 rermo ta1faDelneil()sexo(mpiy4lptemfvsa( aDrr(moot0tetnmf3tytfa2ranmont0arerxo3oytfat auvsl() exm(r iu4om e ivi t)aDraurp;t1alt mo3tadlaDem( o;t)tetnxr3to1lm rauvils texmio3ou4apt  ivsat  ruaurp;o4texoiieiatfs ul( sn(4texnmr3ia1fatelnes s0t2toxr3iy1ole lfct s)s2trxrp;o4tpto ocilsfm2em(von() rxnmo oydfm r ueol( s2trim iodlp nmfesa( sDrmu  oo0oltoiicildfmDeau o t0aetrmo3io1oateli s;(0 ruo(mpoudllee ietl() 2rax ont0aleomi3ildls ua( o;t0trxnmrciodom rai i s)truoim3nu1lle lietl(f rraur ;t1olenii3ild a2ul(mp;(4trxrxf3oydopDeli o;()s2umxm3oodoltn ivtlt a2umu p;u1tee iocilt m rlumont4 eeoiocootfpD  ivi s teumim iu4aptemncias) rurxrooo0olxomoctatla rau pn() ltnxf ty1fmDr iei ()setmxo3oo4lp e fei (f rtaxm oo4aetnmieiytlaDuln s (0tetnxo3ta1lp e uvs s0trxr(m3ou4omt livtlt) 2tm(m oo4opxoio3iad aDulnmp u0 rtnmr3oydfpDranes;t s2xo(m3iudalee ivt (fsDumxmono1tet mf3tad a2el(mon() lxrxo iadlatrln ils)trtmxrpoudome licia(  rrmu pot0apxnmociatla2rl( o u0trerxf todfmtraieslt0tetr(m oy1omt liesat  rraxmo;o4oex  i3iltfaDrln pn() lxrxfctodop eau s;s0 rumxo ou4apeelies ( artm(mp;u1tpxn ociatlm ra(vont)alxrxf3ia1lm  aueils trtoimpnodom nlnvtl( aDrmur ou4tle mictyd aDrlu snu0artomo3oytlmDr iei t0setmxmpny4aptn fciat)a2ur(rpoo4tptniieilt aDumu on()aexoxo oytfatran i;s s2toirpnodll  lict ()aDrr( o;o0alto o3ilt m rauvs (4 rtnir3tadfmD luvi;t)teurio nudop  mncia(f Dtm(m ou1opxoioctat s2emn o;u0aetnxociodfm raueo;s)srurxopoydlltemieilsfs2trum ;u0tpeoifciltls2rm( snu0trxnxr3iatfm  aiei;s)s2uoim3iy4alt  fcsas)aDtmurpoo0tptoioeiytlmDulumo () rtrxf oatfa  lnvs;t) rurimpiy4ope mivs (  Dtr(  oo1alx  fctyslaDeanmpnu0 exnio ootoa  aieo;s texoxm3oo1am emfeia() Dtrum ;u0alt mieilt a2eluvont4 exnxrcoydfptelu o s0setoio3oy4lp n fct s a2rmx ono4opx  fctltlm ea(mont4tetriocia1omDrlneils0sruoio oodamtemfcilt) 2taxmoou4tpx mo3tysfm uanvonu4texomocoadom e u s;s0trtm(rpnodll nmncsat sDrrump;t1ape miciyd a2eanvo;(4tlxoxr iydlmDraues ( sruo(o ou4llt mnvs s sruax  no1tpxomo3iytfaDemnmo ()tltomr3iydfpte ueo t)t2um(r3iu4lm e netlt s2uax o;o0oeto feiasfmDuan o;(0tlenxr iadfptelneo (0 2xmxm3iy1ame  neta() 2um(rp;o4tlt  fciat a rlnmo;u4tlenmf3oydoateau o;s s2tmxrpny1lpenmici s)s2uru pnt0tltnmfeils a rau s t4aetoxocoo1fatrli i;t)srtm(r3oy1ll  lnctl( sDumu  nt4tex  feias s ranms;(4tlenio3ty1lp  au i;s0 etrir3io1am n ivsatfsrtmu  ;u0aex  octasls ua( p (0 exrxrcoy1lat  ivsls)sexmio3io4lmee ivs tfsrtm( ono0opto oeias mDeaums t)tlxnxo3iytfpt lnvo;t tetoir3oydale mncils) 2taurpot4apeniieiatla2ran p;t4altnifcia1lm   ieolt0trurxm ou1olenlnes ()artaurp;o0aex ifeiadla2ranmpn()teeoio3tytlatr i s;() ruoxm no1lm n fcs t)s2taxrpou1oet miciatfm ul( o;t) lermrciotlaDeau il(0t2xm(r3nodlltemiesat)aDua(m ou1tltoio3tlt m2ea( p;u0 renxocta1laDranei ( t2uoxopnu4lp elivsatfaDrm(ro;t4oltniictlsls umn pn(0tlerxfcto1lpDe n o t)s2tmxm io1ll emfcsl()aDtaum ;o4oee mi3iatfs2rlums;(0alxnmr3iydoaDr n s;s)truoxm iy4aleemieil(f Dua(ronu0tlx mictlt a2elnmon(0artrmo oydla r u s t0sexmxr ou4lmtn ncs ( sDur(moot0teenmf3tydls2elu s;u) rxoxrcty1lpDe nvo s0s2xo(o oydll nmfvt t)sDrrur ot0tpenmf3ildlsDemump;t4aetnxocoy1fat au i;() 2xrir3oo1om nmiviasfarrm(mpoo0apt ifeiydfsDum( s u0teenxr oadoateanvi;s  rurim3oodapte ici (fsDum(mpnt4olxoifeiaslsDrlu s u0 rxnmrciytlatrli olt)s2umim3oy4llenlnvs s)s2tm(r no0oetoioeiytfm2em(mp u4arxrmr iodlptean i;(  rumxr3oudope lnvsas s2um( ont4aee mieiydlm elnvo (4texoir3tatomDe nes;t0s2xo(mpoy4llte ict t)a2tmumpnt0alxomoeiyslsDem(vs t0aexnif iytfa e ueo t0 rxmim iodlmt mics (fsrur(mpoo4tptomictytlaDran o;u4trxnmocta1om  lnesl(  2urxm ny4al   ivs (f 2ta(rp;t1aeto fetasla2uauvs;u4 renxfciy1opD anvs;(  2umxopoo1llt mies ( srua(m ;o1opeoiiciyslm el(ms u0teeomf3to1lpD  u ol(0s2tmim oy1am n fci ()aDururono1tpx mi3iytfa rmn p;()aetnmf iotfaDrlu i;(0 rxmxr iu4llt lnvta(farrmx pnt4ope moeiatlmDran pn()trenmrcootomD  ieslt0srumxo3oo1lp nmietasfaDumumpou1ole moetys mDeauvs;(4 exoxo3oo1laDeli o;t) 2toxmpno1ol nlics t) 2rmu  oo0tpx mociasfm eln o;u4trtoxrcty1lpt  i sls0t2xr(o no4olee nvtltfa2rmur no4aetnmfciys mDra(vonu0 exoxfcty1lateaivo (0trto(m3oodal elneias) ruaurpnu0oexoif3tys m2elu snu0arxrif oytlate ieslt) 2tr(m iydopen fciat  rtru ont1ole  fetls s2ulu snu0tlxoio oo1la raneilt srumxo iodomt mnetlt)srrax  nt4tlx  i3ias a2elump t0artomr3oo1fmteaivils srtr(o3ou1altelfviltfsDumxr no0oeeoii3tyslm rmuvo;u0trtomo3iadfa   n i;t) rur(mpoy1op emicsas)aDra(mp;u1alenmf3ild s2elnvon(4trtnif ootfa eluvs;t) 2tm(opoy1lltemnes s)s2uaxro;o0tptomf3ias mDuauvp;t0aleoir3to1oat  n il( trum(rpnydoltnlivslt  rumu poo1oetniietysfaDranmonu0aetnxr oytfpDr nvils) 2xoirpiodomtnlict ()s2tm( pnu0alxo feiydlmDum(vsn(4aeerxf todfatr uvs (0 2uo(rpoo1ll e nct tfsDtax o;u1oeto ictys aDra(vp;u) ltrmo tydlaDe i sl()s2xrxo oudllee fvils sDta(rp;o4tpx  oetas s2eanmo u4aeeomrcta1lmteluesl() rxoio3iy1altemfcsl(fa2rax pot4alxoifciytlmDran s;()tlxoir3oa1om elu o;t0t2uo(rpiu4opee fesatf Duax  oo4alxo ictltfsDulnvpnt4teeoxf3totfmDrlneo s)setmim3oodopeemfeslt srumxm no4tpeo ociaslaDel(vont0aexomr3oytfpte n o ()s2uoiopio4ope lnct t  Drax  ;t4alen icildlm2rlu pnu)aexrmfctotla eauvil( truoirpoydlp elnciasf Dtmuronu1tpxoiietldls eluvp t) eeomrcto1oaDr nes;( teuoxopno4amenmfvias srtau  nt0apxomfctlsls2uauvont0tetnxfctydfm r nei s s2tm(m3iu4om   nci sfs2urx pot0tptniociasfs elu pnu4arxnmfcoo1opDelneilt0 rumirpiu1al   ict tfsDtmur ;t0altoiociadfaDeauvp;t4tltrio3to1fm e n i (0 rumxr iu1om elfeslt)srur(m oo4ale mieildlm2ra(vp;t)tetoxocoy1op   nvi;t)setoxm3nodll  mfesasfa2umxr ou1olt mfetlsfa2raumon(0arxnmr3iy1fmDrai o ()srtoxo3oo1al nmictls) 2urumono1tex ifeilt s2uanvsn()trermf to1lptrln slt)seuo(o3nu1amtnlfeil()artaxmp;u0aee iictydfm ea(msnt0arxomo3oa1fmDrluvils0trxmxr ou1lmtnlnvs (f ruru pno1oleniicias s rluvsnu4tlxomrciatfateanes;() etmir iudllee nctas)s2ua(r no4apt iociatfa2elu ont4aetoiocto1fm elies s t2xm(opiy1am elictl( srumxrp;t4tlenif3tas s rauvsn()trxoif iy1fptrliei;(0t2xmxm ou4amtnmnvilt)a2um( pou1aleo i3tyd a el( s t4aexomf ta1om   neils s2uo(rpoo4alenlfvslt aDrru  oo1oee mieildfs eluvo;t)alxomf3oydlptr uvs;()sexo(o3nudame lnvi tfsruaxmo;t4oexo ieiydlm rlu p;t) etoiociytfatr ieilt)setoio ou4opt  nviasfarrax pou1texoifetatlm2elnmon(0tleomocoo1lpt au s;() rtrir iy4ol  lnci t  Drau pnu0apt moctldlmDuaumo;()teeoif3oa1fmt  ivilt)seumxrpnu1llenlncil( arra(ro;t1alxoio3iyd s rl(vsnt4 etoxo3oytfmDr uesl(  ruo(r iy1ape  fesl(fa2uau o;o4aee  fctldlaDrluvo t) lxoxocoa1fmDeaivol(0srurxm3iu4alee fcia()sDumx pno0tltoioctlt a uluvs t) rxoio oydfptelies;() ruoxr iodal  licsas)a2rrxr ot0aexnmf3ildls2elnmo t)alxoxfcootfpt  iei;t0truoim iydop nlfvt t sDtmxro;o4tlxnioeiadlm uln s u0aetrif3totfm  au i;s0s2trirpnydlm n nvi s)sDur(mo;t4tlenmieiytfm2rau sn()altnirciatlat aues;t0 2toxo3no4ape lfeiat  rtauro;t1tleoiictys a ul(mo (0aetnxocoydla eli i;s s2xrxm oodaleemfvs s  2urumpou1opt ifetyd m2umuvo () rxnir oo1omtrluesls)truoxo oodaleemfctlsfartr(monu1oetomo3iyslm elnmpnt)aexoxo tytlat  n i;( truo(m oo1ol emfeil( arrr(mono4texoifctytfm2el( p u0 rxrir3tydlpDraues () rtrir iodom  mivtlsf 2tmur ou4aex mf3iys aDuluvo;()altoircty1fmtran slt) 2xmxr3io1optnlncta(fa2rrurp;t0tpt mieildfaDemumo t4texrxrciydfaD lu o (0 rxmio3oudlp n fct tfarrmxrpot1tetomoeiytls2uanvp ()artrmf3oydlatrauvi;t0 2tmxr iydll emncsl(  Dtmuroou4tpe ifctltls elumsnt0aetnxr3tydlat  n o;t0s2tm(mpoy1al e ivsls)a2ta( pou4tet iociytlmDel(vp (4arermo3oo1fm r n i;s)t2xo(m3iudlmte fvta(  2raxmpnt0opx mfctys aDuanvs;t0 eenmf3tatoate n i t  eurir3nu4lpeelivtls s2tru o;o4apx mfctydfmDulums t)trxoxfcto1fa e n s t) rxmirpnydalee ieiltfsrtrx o;t4ope  f3iltls elnvs;t0trxnir3tadlateau ol( srtr(rpny1alee fei (  2umx poo4aetnmocildfaDrmnvpn()alxoxr3ootfptelnvilt0 eurxmpoydal  lnvi ( sruaxmpnt1tetn f3tytfsDem(ms t0arxoir oa1oa rlivslt0 rxoxmpoy4amenlneslsfaDrmxmono1aetn oeils mDrl(vonu0teeoir iytfm eai i;s  rtmxrpny1olte fes (  rur( p;o1tlenmi3tadfmDuanmp u) etnxo oa1fpDeaies;s) rum(m oodlpeelnvtl(fartm( oot0opxnii3iltfsDrln o;t0teermo3tydlaD  ivol( teumxo oydlme  nvi tf 2umx ooo1ape mieiys s2ua(mp;t4 rerifciotfmt luvsl( srurio3nydom   fcs s)sDumu oot0olto ieiltfaDumuvonu)trxoxrcoo1lpDeln ils tetm(o3nodll elneslt)aruax  oo4ole  f3iys a ranms t0tetrif io1omDrliei (0sexrimpoy4apt lfctasfs2rrur ;o1olxnmo3iys s2rlu p;u4altnmo3oatla   ies t0setoxr ou4lpe livt s sDurumonu1oexnmoeilt mDum(mont4 eenxrcty1fptelivs;s)sexr(mpoo1lp nmicils)a2uaxroot4oet  f3iadfsDranvp u0 eenir oodlpD lnvilt setr(o ny4lp n nct t)sDumxmo;u1aetn o3tlsfm2rl(vont4 rtomrcta1om r u i ()t2umxm nydom n ivsl() rurxr ;t1aetnif3tas s2emumont0tetrxfctadfpDe ueslt)s2xo(o iu4alt mnvi () rrrx ooo4texo iciad s umu snu4tltrmo iodop r ueols)trumxr iodal  lnvtls)s2raum ou0optnioeiasfm emnmsnu0aleoxf3oy1fpt lnvi;(  2tm(mpio4ame livs (f rtax pnt0aleoifciltfa2ua(vonu) rxnmo3iydfmDr ivs;t) rtoim3oudamt mncs (fsrrm(  ;t1aet ioeiyt s2ean pnu4tetoxo oo1om  auvi;()s2uoio3ou4olenmnctl()aDtrx ono1olxnifeiaslaDrm(msnu0 ltnxocoatlpDrau olt0texoxr no1amee nvtl()s2tr(m nt0aptnmoeiytla2emnvs u)teeomr totopDran i;s)setmxmpny4omeemfeslt aDtmxrpnu1tpeo fctaslaDemuvonu0aleomo iodlmDr ueo t seurim iy4am emnvs tf Duaxro;o4aeeomiciyslaDemu p;t4tetoxo3ta1fm raneslt  rxrxrpiodomeelfcsas aDrmxrono4altomo3tltfm rmuvp;t) lxoir oy1oate uvils0srxm(mpoo1altemnet (fa2ur(mpot0oltomfeias sDeauvpnt4 leomr3todopDr nvi;t)t2to(opny4llt  nctlsf Dtru o;t4ope if3tas sDrlnmpnu)trxnmf oo1om raiei;( srumio oy1op  mfvils arrr( oot1optnif3iltlm emn snu4aeeoxr ta1optrlnes;t0 eumirpiy4lp elnctatf 2rruro;t1teeomi3iasfaDuln p;() ltomo3ty1lmD  nvi s)sexr(o iu4aptemicil(fsrtrur no1aptnifcilsfaDem(mo;u)aetrmoctadopD aieil(0 etr(m3iodamtelictl()sDta(rp;u0oet ioctatfa uanmpnu) rxomo ootlmD  uei t texmxmpou1ol n ncs () 2tru oou0alenmieilsfmDrmu p;(4aeerxfcoytoa  auvi;s)trumxr3oodomenlivt ( s2rru onu4tltoioeiadla ra( pnu4tetnir to1oa   nei (0t2xoxopoudlleemietlsfsDtaumpnt4tptnmf3iltfs2uluvs (4artoxo ootfmteau o;() rtrxo3iudamt  nei (f rraxm nt0aetoif3iad sDemuvo t4tetoio ootfm e u i;s0srtmxrpiu4apee icilt)a2tmxmpou1oetnmi3iytfsDemump;t4tetoxo3oy1fatranvils0sexoxo3nydlm elictlt) Duaxmo;t1aeto octadls2eau o;u0tltoxrcoadoptrlivols0tetmxrpio4op nmfei (fs2tm(rooo0aexomfctatfm2rlums;t0 exoxoctotoaDrli i;s  etmiopnydlmt lnei () Dtmur oo4tpx mf3iyslsDem(vpnu4tltnxr3ootfpD lies;s)s2xm(mpou1omenmfesl(farum(r no0tptoiiciadlsDea(ms;u4 eerxr tytlmt ln i;s0 etmio3oy4opt lici ()artrum ;t4aet iociatlm2rmn p;(0tlenxo ootlpD li o t srtr(r no4lpe  nvia(fa2ra(rp;u1opx mietysls ua(mo;u0 lxrmr io1om eluvs;(  2triopoydolen nei (fs2tru o;u1ape iicilt s emnmo () rtoirciodfp rau i;( srtr(r no4omen nvsat  Draumo;u0tlxomoeiatla2ra(mpn(0tlxomfcoytlat  n s;s)s2toio nu1ol  mnes ()aDrm(r ;o1tetn oeiyslm umnvo t)aeermociadlatrai o;t teum(opnu1ol  mici tf 2rmxmo;t4tetn iciat s2emn p u)trtnif ootfpDelivi (  2xoir ou4omee netatfaDua( pot0apx  octadls2elump (0 lxoxo ta1omD luvs s  exm(o no1lltnmivs s  Drru  no4aexomfetysfm ua( pn(0trxoir3io1lmteln s t teto(r oydameemnetasf 2uax poo0tlen ietys a2rl(ms t4 lxnxf iotlm rln o t0teuoiopny1ol  lfesat)srrm( p;t1tpxomfciasfa rmnvo (0aleoxf iotoa  aues;t)setmxm3nydolee fci t a2rau onu0aeeoiociatfm eln s;u4tlxrxrctytfa eaivi () eto(r oydll  lncs (fartmxmp;t4apxn ietlsfm2ean s;u)tltnmfciadfaDeau i;t  rxrxopno4amt  nvslt  rtrum ot0tpeo oetyslm2rauvp;u4trtnxr ootlp r nvi;t  2xrxm nodop e ies tfsruax p;u0aex iiciysls2uluvo;t4trtnxo tytfmt ln olt0s2xo(mpiodol nlfvsltfs2trump;o4tlxomieiad sDuanmo;u0 reomf oytlaD anei;t)t2xr(r3oo1lm elncs (fsDrrxr ou1alen f3iatfa2emnmp (4aexomo iadlm e nvo s)t2xrio iudlmtemfvsa(farrr(r oo4tle  o3tadla2rmu o;(0alxoxf iatlat  n il() exmir oydaleelncsltfa2tmu o;u1tleoifciadla2rl( o;() leoio3oa1oa rln slt)sexmio3ny4ap elnvi s) 2ta( p;u4tlx ioctaslmDea(vo;t0 lxnioctydlmDelnvolt t2xo(m3io4llenlfctat aDrrumoou4aleo iciad a2ul( o;t4aetomrctatfa   n sl(0 2tmxopiodlmeemncta() ruaxmoou4ape ifctltfaDrl(ms u4 lermfciy1fa e neils0srtmir iudom emnetl()s2raxroou1opx mociys m2ulums;(4texoif3ta1lptelivslt)s2tmxm3nydop nlfvs t)arurx  ;t1apt mictyt aDraums u0alenir3iatlaDe nvs;()trtm(m io4om emneilsf Drmur ot1apxo fetltlsDra(vs;u) rxomfctotfa  aivolt s2uo(m nu1lmen nesl()aDurxro;t4tpe ii3iytfm2umu o (4aexrmo iydlm  lnvilt0t2um(r io4open fvt s)arta(mont1tlto feiytfm2em( s u0aeerxo3oa1lp  livi;t  2tm(m oy1opeemncils  rrmu  no4altnifetydls2eanms t)tltnxocoy1la eai i;t srxr(m3nu4ame  fcil(fsDtmxrpnt1ole  ictld a2eanms;u4tetnif3iy1omDr ivs;(  2tmiopiu1om nlneil() rtrx  no4oex  fetydfaDrmnvs t)aetnio oa1fm   uvo s)tetrxrpoudole mnci ()s2urxrpnt1oex mf3tldfaDumnvp t0 rerxf3ta1oa rau ils0seurxm3iu1al n ictas) Dumu oou4opeoifetysls2uln p u0 rxnir3ta1lp  auvi;t)s2toxo3iudlltnmnetlt)sDtaurp;u1ale iieilt a2ranmp;()aeenmocoa1fpte nei;t) etmio nodapeemfvsl() 2um(rpoo1apt mf3tas s2rm(mpnu4tleomr3iatfp r uei;( s2um(rpnudap emnet s srtr(r ;o4olx mi3ias m elnvs;t0 lxnio3iydoat anei (  etm(m oodoptnlivsl( a2ua(  ot0olxomfciasfm umn snu0arenxr3oo1lpDelies;()texrim oudlm e ies s a2trxr nt1teto ictls m ran p t) exomr oodla ran slt0srto(mpnudolt mictlt)sDtax ont1tpxomoeiltla2emuvp t)aeenxr iytfat aueo s0seum(rpoodomee iesl()sDurxm oo4apx iiciydfm rmnvsnu0trenif totfmtraivs;t) 2umxm oy1omteliei tf ruau o;o0teeomo3iyslm rauvp t4trtoxo3iytopt livslt tetmirpio1olt livta(fs2urx  nu1aexniictys sDran p;u0arerxo3tydfm eai ol( setm(mpiydlm nlfes s sDta(mpno1tptnifeiad s elu o;t4tlenxfctodlmt an i;t)trxoir oy4lltnmfvt () 2tmump;u0aleoioeiysla2umnms t4aeenmo3iatlmt aivo t0sruo(m3nu4lleemnes t  rra(  oo0tex mociasla2el( pn(4tleoir3oy1fp e i ils0s2xmir iu4lmt lfvs s) Duau pot4tpxo oeiltfs2rlumo;t0 etnxr iodfp r iesl(0srxmir nu4lpeemnei t)sDra( onu0tpto ietltla ulu snt0aetnmo3iatoa  aiei;s trxrxm3nudlpee icia(fs2uru pnt0tpxoio3ildfsDum( snu4 ltoir3iadfm ranes t) rumxm3iydll e fviatfsDtmu pnt1tlxo fctlslm2ranmo u)tlxrir3iodfpt  u o;t) rtoxr3ou4apee iesasfarrmx o;u1oeeomfcilsfs2ulnvp ()artrio iatlmDrau o () 2uoim io4openlfesas)sDtau o;o0tlxo i3tysls2umu pn(0 eeomfciodomD luvi (0 rxmim3ny4alenlivi s)a2rm(  no1alx moctld mDuau o u4 exrir iytopD  u o;t0 rxrir3iy4llte iei ()srurxrooo0oetnmoctys a rm( o (0 rtrxf3oy1fmtrluvo (0s2trxrpoo4aptemics s  Drr( p;o0oee  octlt a emu s;() rtoxrcootoaD  nvils) rxoxo oodalenmietl()a2rax ono0opxnmfetadlsDuanmsn(0arxomr ta1oaDeaneo ( trtm(o3no4am  mnct ( arra(rp;u4olx miciadfs um( o;u)arxrxf3oytfm rluesls seum(m iudlm  lnctls) 2taumo;u0aleoioeilsfm elumpnt4aetoif3tatlm  aivs;( srxr(m3iy1ol emfei s a2ur(rp;o0altn f3ild m ul(mp;u4alenxrctytlp ean il( t2tm(r3nodoltelfvtls) 2taxmo;o0tpeo f3tydfs2eauvo;t0aleomr3oytlaDrluei;t) exoio nu1lm  mfetlt artm(mpoo1tlx iocildla2um( pn()tetnxo3iadoa eaneo s)texoxopiydaltnlicils) Drrx pnt0altnif3ildfs2emu o;(0altnmo io1lat  uei;t)texmxr ny1amtnmfvi ( aDuaxrpoo1tex iiciysfaDuln o u4 lerif3tadomtelu sls)truo(opoudll  mivtls  Dumxmpoo0alx mf3tadfm2eanms u4tltoircoy1laD livs (0 exmiopno4ll  lnvia( artm( ooo0opxniiciatla2umu o (4 etomocootoatrluvi s srumio oudlp nlfviatfsDrmu o;u4aeenifeiysfs uluvp u) etrmocootom eanvol()tetr(rpnu4ope lfvt (f 2urumont4tpxo ietydfm emn s;t4 etrmo3iy1fa rluvols0trto(m3nydll  lnvt s)s2umuront0tet if3ilsfm2ulumo;t)altrio oadfm r nvols0trxoxo ny1lpt  fctltfsruaur no4opt ii3iyd s2umums u0aexoxrcoadlaDe neolt)trtmim3iu4lptemncslt)sDtauront4tpeo fctysfs em(mpnt)alxoxfciy1fpt  uvol(0t2uoxm3ou4alee iei ( aDuau o;t0olxnifetaslm um( p;()aetnif3ty1laD  n ils) etrir iodaltn nct ()artaur nt0oeeniieiytlaDua(mon()tlermfctotomteaieslt)trurxopiy4al nmfviat) 2umurpot1olt  octlslaDrau pnt)areoxf3todom  auvs s  2xmir no1ap  mieilt)arrr(mp;u1apxnmictytla2elu p;() rxnmf3io1la  livo (0t2trxr3oy1llt mfeilsf Dumx pou4tlxo o3tat m2eaumpnt4aeenmr3tadlat  uei ()teurim3oo4lle  nvt tfa2rruront4tlt  i3tlslm2el(monu0texnmf iytopDrlnvi t s2tmxm nodlmtnlnci tfa2ua( o;t0olto ocildlm2uaump t)arenxociytoaDeln ol()s2xr(m iu4ameelfetls)sDurxrp;u0aleoio3iatls2rmnms (4 ltnxr totomD livo;s srurxmpno4amtnmnctlsfs2um( ono4tlxomi3tatfm2eluvpnu0arerxr io1oat lu o;s  etr(m io1olte ieslt aDtm(  oo0alxn f3iat s2ranmpnt0arxomocia1lp eauei ( s2xrxr3oudomtnlneiltfsDumurooo1tet mfeiydlm ra( s t0aexrmr3oy1fa rau s ()t2tmim3oudame mfctat s2tmu  ;t0alxn i3iasfs umump;u4 ltrio3oatla  aiei t srxmxo oydll e ivs (fsrrmxr ;o4opxniociatls2uln s;u4trxoxr to1fm e iei;(0 eto(r3no4optnlfcsls s2uru pou1olenii3iadlsDum( p t0treoxfciadlpt  uvi s)setm(r3oudomt mnes t  Drrx p;t4aexo fciys sDrlnvp;(4 leoxr oadoa rli s;s  eumimpiy4amt mfeiat) rrm(m ot4altomoctasfaDrm(msnu4 lxnmr3oatfmtrln s s0sexoio nydaleemnvsat  2rrurpot1apxoii3iatls2rm( onu4areoxf3tytfpt lnvi;s  rxr(opoodom elivsltfa2tau pot1aetn f3iys sDemu o;u0altoxo3oydoptranvol(  2toxo3ou1ale liciltf Dtmump;t4oltomf3iyd a2el(ms u0 rtrmf tytla   i s s)srum(mpoydap nmivtatf Dtm( p;u1ole mfetas a2rm( o;(0 lxnircoodopDran o s0s2xrirpoy1amtemfeias s2tr(m ;t4olxniociadfsDemu o t0 etrif ta1omDelivo ( trxmim3iydlmen nesasfsDtaxmp;o0alxn oeiad sDrl(mp u0aleniocoa1la rauvi;s  2xmxopiydal elfei s srumxm ;o4texo oeiltfs2ra(vs u)trerxo3iodfa eln s t) exmxo3ny1oltnlictasfarrru  ;t4tptoioetytls emnvs;()tetrif io1omDeaiei s)t2tmxm io4ap emnet sf Dumxrooo0alxoif3ildfs rlnms;()arxnifctatfa ranvol(  rum(m iu4lltn nvsas a2umx pnt4tlt iieildfs emump t0teerxrcoodop e ueil(0t2tr(m3ny4lptemicsa() Dtmxr ;t0tpxnmieiasla2el(ms t0 etoxf3oa1opDr n sl(  2trio3io1ll   icta() 2uaur oo4aexoiocilsfm2ul(vonu0tetrmo oa1fp  au s (0s2toiopoudlp nmnctls)s2uau pou0tex  fciyslmDem(ms;u4 leriocootfmDrli sls setm(r oodomt  nvs () rumumpot0tptniietldfm emu p t0texoio3oodlpt auei;s0srtrxopnudolen fctlt) 2ur(mpnu1tpxomfeilsfa rl( p;(0aeeoxf3oo1oateluvsl()srtm(mpou1al e ies (  rta(r nu1tptoiietadfa elnvp u)tlxoxr3iydomt auvo s0 rur(rpiudam n nvt (fa2raumono0tet  o3iadfs2umn o u4 etoxfcoytomDrliei () etoxr no1am n icias s2uaumpnu1tlt mf3iat s rlumo;t4tleomf iytfpDr nei;t0trtoim3iu4aptnlnciat  Dtmx  ;o0apt iociltlm ua( s;t) etrmo oytlmt  nei;t)t2umir3iu4lpee nvsa() rurxm ou0tleo iciadfmDum(mo t)alxnir3iotlpD  uei;(  rumio iydal e fct s)srtmumono1oet iocild aDemn p u4 ltnif tatfmD  u o s0trxoxrpoo4openmncslt) Duaumoou1alxo ieiltfmDumump t0 exomf3todfpD  u sls0setrxm3iy4om  lnct sf 2ta( poo1opx  oeiat sDrluvp;t) exomr tydlmDrluesls0srurxr3iy4lptemnei t srta(rpnu0apeomoctasla2ulumont)tleoif iadfa eli s;t tetmxr oydoleelietls  rrmu p;o0tpxn oeiltlsDul(vs u)altomocoadoat livi;t)t2trxmpoydoptnmictas  rurxrooo1alxnmo3tldfmDran p u0artoxrcoadlmD lnvolt)trxm(o3iydom e fetas) Dra(rpoo1opeo fctltfmDeluvsn()trerio tytfmDeai sls0texr(opnodameelnesasf 2urx pnt0alto fctldfa2rln pnu0 lerirciodom rluvols0 2uoirpny1lpt  ivt (  Dtmum nu0opeo f3ias sDrm(mp;()aetnxr tadlptrli i;( srumxrpio4optn ieia( srrrxro;t1teeo feiy
\ No newline at end of file
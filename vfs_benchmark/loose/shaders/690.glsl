@@ -0,0 +1 @@
+ieo;s)truoimpio4lpe licsls a2rmuront1tle mf3tatfm2rln snt0artoif oadlaDr i ilt) rtmxr iu1ome  fviatf Dtrumpno0ope mociydlmDel(mo ()alenmr3iotfaDeaivi t0truoio3iy1lm e ncsl()a2urx p;u1ope ioeiytlm2um( ont4trxoio todfmtrlu i;()trtm(opoo1lmtnlnetatfartax oot0aetomiciysfa emn p (4trxnir3oodlateli o t sexoiopiydop   nvtl(fs2tr(  oo0ole ioctld a2umn o;(4 leoir tytlmteli o t0srxoxr oo1ame lfvs ()arurxroot4oltnio3iltlaDran p u)texomf3tytlpt ai i;t  2toirpou4am emfetatfartrx oou4tlxn o3iyslm elums;t)teermfctotopD aies;() exoir3no4lmtnlfvt (fs2rmum no1tptomoeiat m2ranvsnu0 exnmf3tadfate ieo s)setm(m iodopen fct s)s2rr( pou1aetomietlt mDem( o;(4aeerxr oa1omtrlu i t)t2toim nodam   nvi s  rtm(  ;t1olen o3tltfa ul(vo u4 lerifcoytlpD aies s0seum(r no1opte fvia( arrrum ;t0ope moeild m elumon(4 leoio ty1fp rlu ilt) rxoir3io4aptnmicsa() Dta( onu0aeto ictysfa2um(mo (4arxnxf3totfmDeai sls)setmir ny1al nlfei t a2rr(rpnu0aexo i3iydfs ul( snu)tleomfcio1fpt luvsl( s2triopoudop   fcsa() Drmx pno4opt mfctas aDem(vonu) rxomf iatla ranvol( trtoiopoudolt lfciasfsDururpoo4oet mfetas s2uaumo;u) rxoirctadfa elu o;(0t2tm(r3ou1alte nesa(faDrrxront4texnifctad a emumo (4 rerxo3iadlateaivs s) 2uo(m3ny1lpee fvi tfa2ta(  ;u4oexomfcild a2eluvs;() lxoxf3iydopDe nvolt  rtrir oy1ll nlivtatfaDuaum no4opx iociysls eaumonu0teenxr iy1fa raueslt  2umxm iydapeemivtlt) 2ur(ront4tlto iciadfa emuvsn(4trtnircoydfmtrluvo s0sexrxrpio1ome lietas srrm( onu1aeto feiydfs2uluvont0 leoxf iotomDeluvi s s2xr(m3no1lmt  iesl(f Drm(  ;u4oleo i3tyd aDeanmont4tlxriocoydlmt lueo;( srxrxm nydllenlivil( aDumxm ;o0apxn iciytfa2ulu sn()tlxrxr3tytomt auvs;s0 ruoio3oo4om   fvi s) Dtru p;o4oet mfetatfa raumsnt4teenif3iodlmtraieo;t seur(o oydaleemneia( a2rau  ou4teeomoeilsla2emnmpnu0areoxf to1fate i s s  rxoxm oo1lmtelietat srtr(r ot4tpxoio3iytfs eluvpnt)aetnxf3iydfp elieo t)texr(m no1amenlicia( sDtm(mpot0opx  ieiyd sDemuvont4 rxrif3to1op r ues;() euoio ny1oleelfesa( sDtmurpnt4oltoiieildls2rlumo;u4altoxo3todlatrlnvo;s0seurxo iy4optnmnvi t srtr(  ;o4alxo o3ildlm2rmump t4arxnmo ta1la rai ilt0s2urim3no1amte fetlsf Drmu  ot4apt mictldlm2em( o;u)aeermr3ia1fa e nvo t0 2toxo3nydap e fetlt)s2rrurooo0alenioeiltla2umnms;(4altrifctatfp r nvo s)t2tmir3oudale lnvs sf rra(mpnt0ape iictatfa2emumsn(0 etnifctytoat ai s;s s2uo(mpiu1am   ici t) Draxro;u0opxoiictltfa2ulums u4areriociy1fm   ueo t sexoio oo1ome lnvtls srumum ;t0tlxomi3tas a2el( snt0aexnir iatfpDraneo (0t2umxo oo1ome livs t srrm(m oo1apen i3iys mDumumsn(4tlxnio oatfat luvo s  rurxopnu1lmt mneia(f Dtrumont0aeenii3ildfm2rm(vp;t0artnif3oodfpD aivs;(0 rxoxm iu1ll nmnvtl( aruaumono4alxnifctad sDeln p t4 exnif tadomD  u il(0srtrxm3ou1lme mivtl(  Dumur ;u4apt mf3iaslsDem( s t4alerxrctotomDraivs t0 euoxo3no4optn fctl(faDrm(mono4apenmoetad m2uauvpnt4altnmo3ootfp raies ()s2xrirpoydal elfesat s2rr(rono1tlt mfeils s rm(mp;(0trxoir totlateau ol()trurir ny1op emicslt a2rru pot4aetnmoetatlaDrmums;(4treriocta1om  au olt0s2to(o nu4lme  feiatf Dtrumo;t0tpxnioeildls2ulump u0 reoirciatfm elnvi (  2to(rpiodom  lfvtls aDtr( o;o4aeen i3iytlaDrlu p t) ltrircoadfp raivs t0srto(r ou1altelneias)a2tmu ont0ape mf3ildfa eauvs u)arenmrctydoa  ai sls  rtoxo iy4lpenmncsasfaDta(r nt4alenmietydlm rmn s u0texrmf3oytlpDe iei;s  2uo(opoo4oleemfvt s)aDrr(rpoo4tle  octydfm2emumsn(0texoircio1fmDe u s;t)tetoim3iydamen nvta(  2rax pot0tpeoifciydlm2rmn sn(4arxoircoydoaDe nvi;t setrxr iodlm e nvia(fs2uax  ;o1tetn fciatfs em( pnu0texnio ootoa ranei;t)srxmxr nydlp e iviat) Drrur nu0tpxniiciytfa ul( o (0texrircoy1fpt  ivs;s sruo(o3no1ome  fet t srrm(rpno4tlenmociytfa uln o;(0alxrmf oatfpDrauei s)t2xrxrpiydlmeemicias srur(mont4olxnmo3tls m2umuvp (4 exnxr3oy1fmDeaivs t0srto(o nudlmt lfvi t) rtr(mp;o4apto i3iad s2rmn p;t0trtnxr iadlaDrli il( teto(r3iu1ape  neias aDuaurp;t1tptoio3tlt aDranms (4 leoio iodlm   i o;s srumir3iy4lmen nctl(faDuaxmp;o4tetn ietytfs2ea(vs t)alxrmociytfmD aies;s0trurir iy1op   fcil(fs2uaurpno0aleniicildlsDum(vp (0trxoxo iotom eaneils) rxm(rpno1amenmict (  2uru ono0apeomieiadfsDem(mo;t4artrxf3tatlpt livolt0truoxr3iy1lme mfcsl() 2rm(root1tpt mi3tas a rmumpn(0aeerxociadomt ai i t)s2xrir3ny1om  lfvi ( aDum(r ;u4oetnio3iyd a2um( p u)alxoxo3tatfmDeauvsl( seum(o oo1lm nmivia(farrmumo;u1texnifeiasla uanvs t4tltrmo3iotlp rluvo;t) exrxo3iydlp n nct s)sruaumpoo0opxnmi3tysfa2eluvs (0teenio tadoa r iei t setoxo io1lmee ivil()sDua(ro;u1tleomf3ilslaDeau pn(0 etrio oa1oatr ues t trxrirpiu1llen feil()a2trx p;u4texomietls a emu s (0 exnxf3oy1la r nesl() 2tm(m3no4lmt lnvtasf Dtrurpou0tpe mi3iyt sDum(ms u4alenmocoo1lp  auvs;s trtrio3iudlmeelncs sfs2raumpoo4ope moeiysfa2ul(mo (4texoxr iytopDrluei (0s2xr(rpiudlpee nvta()arrm( o;u0alxo f3ilt m rluvo;u0tlenmociy1laDr nvsl()setm(rpiu1al nmfet ( artmxmpot4olenio3ilt a rlump t4trxrmr3tytfp  lu o;s trtr(m3oy1aleemfvtltfa2ur(m ;t0alxoifeiltlsDem(vp;u4tleoifciatop elu s;t)srxrio ny1lmt lies ( a2umx  ot0tltnmocilsla2uln o;u)altomr3ia1om eaneo;s0 2xmxmpnydlpee nctltfa2tr(mp;o4aet  i3tasla2ul(mont4 etomf ta1oa elneo t) rxo(r iudamen ivi sfaDuaxm ou1oltnmiciatls ranvs (0teenmo3iatlmDrluei t) 2uoiopny4om nmiei s)sDuaxmo;u4ole mocildlsDeauvs;t4trtrmf oodfmDeluvslt)t2trir3oy4ap elncils)s2tmxm nt0oeenmicias a2umu on(4tltnif oydlateliei;s)srtoim3oodolt lfcs t) rrrx p;u4oee  i3tldla elu pn(4aetomr3oydomte uei;t)setrir3no1aptn fesl( aDtmxr ;t4teenmi3tasfsDrl(vs u0 etnif oa1fmtelneo;( seumir3oo1oltn neils) rurx p;t1opeo i3tatfsDem(vs;(4 ltrmf iatlm eai i s0 rumirpnodll n fct s)srumurpnu4aleniociys s2uanvs;()tltnmr3iy1fp ranvs t0sexoxo nu1amtelfes t)artauro;o4aetn ietys mDua(vo (4 rtriocootomtelnvi;t teum(o3ny1opeemfctlt a2raumpot1ope iociydfmDulnvont) exnmf tytfate nei t0sruoxm nydoltnmfeils a2tmu  ot1tle  o3iltlaDran snu0altnmo3oatomDrluesls  exm(r3iy1al   ict sf 2rm(mpno1apt  feiadfa ul( s u)aetrir3ia1fmt lu i;t0seum(o oudaptn ncias aDuaxmonu0oeen o3tltlaDrl(mp;u0tltnxocoytom  livs () 2xoio oo4amee fvsas  Dtr(mpnu4tex mo3ils a eluvo (0tetrxf3oydfmDrlneo s s2umxopno1om   ivtltfa2tmu oou1olxo fetydla rlnmont0aetoio3tydlp r ies;s s2xmxm3iy4olenmnvils sDrm(  ot0tet iociat sDemnmonu0tlxrif3oytomDr neolt0setrim iu4altnmivta(fa2tr(  ou0apen ietadlm2rmn p u4 etniocta1omt lnes;s  exr(mpnodam  micsa(  2tm(moou1tetn oetadlsDeauvs;u4 lermo ia1lpDrauvilt0 eumxopoodap n fcslsfartrxronu4aee ifetld a eanmp;() rxrmr3oatfa eaieo (0seurirpny4lm elivt s sDtm(mo;t0ope io3ildfs uan pnu0texrmo to1lmDrln ils)texmxm nydol nmnctl(  rtmump;t0aexn i3tydls2eau snt4 eenio iytlateli s ()teum(o nu4lmee fes t srraumpot4olx  ocilsfs ul(mpn(4 ltoio3io1laDrau i t) euoio3nodom n ivta()aDurx pno0oexnmieiydfm2em(mo (4tlxnio iodoaDeanvi;s0tetoirpiydlptnmicsat)arrm(mo;t0oeeomo3tadlm emn s;t) renmr oytoa eaneil( seuo(o3iydamtn fes s)artaumo;u4tpt io3iadlaDemums;t)tlenxf3ty1fmtelnes;s)srxoxo3io1ll emnct s s2um(moot0apxo fciltfaDel(vo u)aexoxo iadlmtrlu o (0 rtoio no1op nmies tfsrumurooo0tet mocildfs2elnvp;t)aetoxo to1lm   n i (  2to(o3iudopeelnesltfarururo;o4ape mf3iytfa2rmn snt0trerircia1fat  n s;t)t2to(opnu4lm  mietl(f rtmur nt4oltomi3ilsfm eln pnu4 lxnxr3todopt aieo;t) 2um(opiu4ale lnct s)s2ur(mpoo1alx  iciydfs ua(mp (4 rxomf io1late ues;s)t2ur(mpoodlptemies s  2tr(r ou4apxoiieiys m2ran s t0tlermo ia1opDelieils t2xmxr nudolt mieslsf 2taxrpnt0tleoio3tydla2elu snt)aexrio ty1opt lueslt  etrxo oudlltnlfcil(fsruaxmono0opxoiociadla2ulu ont4alenxf3oytla eaneolt0teurirpiydlpenmfcilsfaDumurp;u4alt ifcildfa ra(vo;(0 etrxfctytfaDr ues;s tetrir3iu1aptnlieia(faDuru  nt0openmf3iasfa rlnmsnt0trermo3oodomte neilt0setoxmpou1ll nlnct (  2rr(mo;o1oet  fciadlmDumums;u0trtoio iy1fm ranvi ()t2urxr ou1al nmncs () rrrxmo;t4aptoiiciysfs2umumo;u)arenmf3tatlm eluvi s) 2uoir nu1oleemiet ( sDrmx o;o1opxn fctld m ulumo;(0 exrxr3oytfateanei;t) eur(opoo4amt  feia( sDraxrpnu4aee ifctld sDua( p;u)aeeoxrcoo1faD  u o (0setoxopou4apeemnvtltfsrra( o;o1tee iociad m ul(mpnu0 leoifciydlm e nvs (0 2uoxr3oydlmtnlfctas arrmuronu1olxo oeiat m umnmp t) eenxf3oodlaD  ueolt trumir oo4lp   ivi (f rta( pou0oexn i3iys sDelnvp;u0 lxrxrcoadfpD  n i t srxr(r3no4lle lfesls) 2um( oot0alx moeiadfsDrmnmo;u0texrio3oydfpDeaueo;t) 2umxm iy1oltnlfcs t s2rru  ;t4altoiictat s rlnmpnt) renxf3iodfpDranesls t2uoio nodole lics ()sDraumpou0olx mo3iysfa rm(monu4teenxr3ty1fa rln sls0 2urxm3oudoptnlfvs t sDtaxrpou4aet mictadfm2ulnmo;u0arxrifciadfp   ueo;()srxmxopou1optelieils arumx pou4apeo o3tlt a2el(vs;u0 eenxr oydfate nesls)trxoxr iy4oltn nvsa()s2rmxmpot1olxn o3tlsls2rm( o;u4teeomo oy1oat ai olt0setr(rpio4omt lnesat sDtmurpnu4opt  oetldlsDeanms;u4texoif3tatlaDr ivi;t0s2xoxm3oy1lp  mnci (f ruaxmpoo0oeto o3ildla2ua(ms t)trerxrcia1lp rai sl() 2xm(r nu1amenmfcia(fartrur nu4opx ifetatfmDumnmpnu) exomrcoo1oate i i;t0 2xmxmpiu4lm  lncslt  rtmx p;t4tle  i3iyd a2ul( s t)tlxrxf oadomDraies;()seum(m nu1openmictl()a2umxm nu0optomf3tadfmDrl(vsnt4arxomrciodlate n ol() 2uo(o3ou4al emnviatf 2tru pnt4texo ietls sDrau o (4 lerifcto1latr u sls0 exrxr3oodope mfvil(f Dtrxrooo4aex  fciat aDumnvs;u0alxnif oy1op e ivo s) 2toir3ou1lltnmivi s)srrm(r nt0teen f3ild m2emuvsnt) rtoir3to1lmtrai ols0t2xm(r3io4olt  fctat artruro;o1olto o3tysls rmnms;(0aetrioctodlp   uvo s s2xm(r iydol   iesls)aDtm(ronu0optomo3ildfm rln ont0alxnxf3oodopt ai s t) ruoxr ny1om n ivi sf Dtr(m nt1opx  f3ildfs emumont)tlxrmfcoy1lptr uvo s trtrxr3ou4lltelnes t  rtm(r ;t4tlt ifciyd m ul(vpnu4 lermr3iy1fmDeluei ()srtmxo3io1lpenmncsls aDtau onu1opeo i3iysfmDrl(vsn(4tlenxo totlateluvils)setr(rpio4ap  lneil( a2ra( pot0tpx iictlsla elump;()aetrircoy1lmtelivo;(0s2urxrpio1ome mnvs ()srumu oou4optnmieilt aDua( snt4 exoiocty1lpD au i;s)sruo(r iydoptn nciltf ruaxr nu0tle  oeiys m umnmpnu4tetnir3to1fp eai s;s)seur(m oudapen ivtas srtmxront4oltoii3ildlm2el(vpnu0 rxnxo tatomDelivo (  2tr(o3iudopt  fetlsfsrrrx poo4aeen i3iyd mDea(vo (0 rtrxr iy1lp   ieo t t2uo(r no4lle mneilt)sDumurpno0olt  i3ilsls2rl(mo;()alerxf3iydfa  luvo s s2xriopny1aptn fvia( s2uru p;o0oetoifciasfsDelumonu4 etrio3totom e u i;( seuo(r3nu1lme  nes ( a2trurp;t0tptnioeiasfm2rlnms t)aetnio3tatlpD lu olt0trurxo3iu4alt lfcia(fsDtaxm nt4oetomoctlsla2uan sn() exomr3oy1fmtrlies;s tetmirpnu1ll  livsasfaDraxmo;u1opto ictytfm2rmnvo u) ltomr3io1fpD aneo;t) rtmxm3oydlptn fctls)arra(  ;u1opxomi3iad m rauvpn()trerif totlpD anvils0 rxr(m no4omtemnvs s)srrr(root0aetn ociatfm rmump (0 lxnmf totfpD an s (  rtr(m3io1amte ivs t)s2ra(  no4aee ii3iasla eauvo (4alerxo3iy1omD luvo;s0trtoim3oo1om   ivs s) 2uau o;o0opeo f3iltlsDrl(vs t4tleoxr iytfmtr u o;( tetm(m3iy4alee nvs (f rrmxmp;t0tex moeiydfaDea(mo (4 reoiocto1fmDeaivol(0srxmxm3ou1lmenlfci sfaDtm(roou1aexoio3iytfaDrlumo u4trtnxo3tytlp e neilt teurxo3iydamtelnviat s2tr(r ;o0ape mfcilsla2rl(ms;t4texrifcoadfatelivo;t  2xrxmpoydlm  mnct s)srumxmonu4aee mictysls2elnmo;u) leriociy1omt  uvi;( tetoxopny4lmt licilsfsruaur nu0olx mo3ildls umn s;t0teeoio todfatraivol(0sexrim oy1ol nlfcsas  2taxmpot0oltomoctasfa2rm( snu0alxnmo3iotfpt livi;( s2xrir3oo1alenmivt s)aDrm( oou4tex mi3tys m2rl(msnt4trtnmf3oatop rln i;s0s2umim3nodope mnvslsfs2tmu pnt0oetn feiytlsDelu o;u4 lenir3ta1op  anvilt)s2uoir oy4op n iesl() rumxmooo1altnio3iadfa el( p t0 lenxf3iytfptrlnvi;t t2tr(m3ou4lp   nct s aDrm( p;o4oexoii3tat aDelnvp u0 lenmf iodfmteai ilt0teum(o3iydolenliei sf Dtaur nu1aex mietadfaDelnms;t4tltrmo oatopDr ues;t0srurxopiy1amee ivtl()s2tr(r nu1apxnmfetatlm elnvs;(4tlenir3iadlptraneo t trtmio3nu4optelics () rtaur ou1oexo oeiltfmDuanmp (0 rxnxo oatoptrau s;() rurir3nodoleemicil(fs2rax oou0oet mo3iys s2umnmsnu)tlxrxo3oydlmteanvi s t2xoimpoo4lpt lfcia( srtmur ;u1aptnif3tldls ul(mp;u4aexnxoctadlmD  ivs;() rxo(m3io1lpee neta(  Dtau ooo0aeeomieiydla2uluvp (0trxrmf3tytfm eli olt)srxoiopny1lpte net s a2um(m ;t1oeenio3iltfmDrluvp;u)tlenxr3ta1lptrlnei;t  2uoxo3nu1amenlfvsl( aDrm(mont4apto f3iasls2rln p;t0 eenmoctodoaD lieo (0 rto(m3nu4llte ivsls)s2urxmpno1ole mo3ilsla2ul( s t) rxomfciydlm e neo ()seuoio3io4altnlnviat aruax pnt1oet mo3tytfm ul(mo () rtrxr3io1omDrlnesls)trtoxr3nu4alee nesl(fsDuaur oo1teto fciadfmDrmnmsnt0 reoxr oadlp ranvs;s0teuoir3ny1omtemneil(  2taumpnt4apx ifeiadfa em(msnu4tetrxo oadfateaivi;t srxm(opiudll emnctl(fa2rr( pot4tet  feiys m rmnms u4 rxoiocoo1fp raueo;t) rto(mpnudamenmfesls srra(mpno1tee mfeilsla elu onu0trtomr oytfp rlnes;s)teuoiopio1optemfet tfarrrurooo0tltn ietltfsDulumo;u)altrxo oo1optrlies s0t2urxopnu1op  lnvsas aDraxmonu0tptomi3ilt s2ranmo;u) exrxr3tydomt  nei s0seumxmpoy4optnmnvtl(farumxmp;u0oeeomo3iyt aDem(vs t4alerir oydlmDr neils)trxm(o oodop emfcils  Dtrurpou4alxn icias aDem(mo t)artrif totlm  lnvsls srurxm3iy1ap n nvslsfsDua(rpnt4texomi3iyslm2el(vp;u0 renio ootfptrlneo;s  etoim3nu1llen icias arra(r nu4tlt mfctasfaDrmn sn()aeenxo3ta1fmD liei s s2trirpiy4ll e fcta(f rtrxro;t0apen fciydfa2ea(msnu0aexnmf oadomDeai s s)s2trxopiudomt  fesltfaDrm(r ;o0tpeo oeiysfs2rln s u)aeermf ootlaD anei (0 euoim3io1oltnmfcias  2umxrpoo0oltomo3iys m uan s u4trermf3iodfpte uvsl()seuoxo no1omtnlivs t s2ta(  ou1oltoifetltfmDuanmo u) eenxo3iydoaDr uvolt  etmio3no4olteliesat  2um(rp;t0alx ifetyt a2rlump (4 leoxf iytfate u o;s  rumxo nudomenmncsas a2tm(moot1ape mieiytfa2rauvo u)aetrmrcio1lmtelies;( seto(m3oy1ol elfcsat aDtr(ront0oeeoiieiasla2uan pn() etnxrcoy1lpDe u i;(0trtmio3nodoltnmieta()a2rmu oot0apeoiieiydfsDum(monu0alxnmocoytlpDe uvi;()t2tm(o3iodaleemictlt srumur ;t4ape  f3iys a elumpnt0trxoxrctadlm r i o;(0tetrxmpno1ap e ivsa()s2raumono1alen ictat sDua(vp t4tetoxr3oytoaDr u ilt)t2toim nudlmtelieslsfsrrrx o;u1apenifeiasfaDeln on() ltnxo to1lm rluei;s0 2xoxm oodalenlncia(f rum( onu1tee ii3tytla uanms t0tltoif tadla rln ils0t2xmir oo4opt licia() Dur(  ou1olxomoctyslsDeln o;t4treoxf3to1fpDeauvolt texm(o io4al n fvta(faDuaxmonu0teeo i3iytls em( o;t)teenmo io1lp  aivs;s)texmxo nudlptn neia(fartau ont0tlxn f3iat s2rm(vs t)arxnmf todlmteaueilt) rxoxo iydol   fvtlt)srururpnu4optnmoctasfaDel(mp ()altoio3oa1omteln i;(0tetriopio1lpt  ictlt)a2urxmp;t1texnifeils a2umuvpn()trxrxr ia1lm raneo s0sexo(r iy4olt lnei s sDuru pnu0opeomoeiys a2ulnvpnt4arenmf tadlpD li o;( teurxo3iy4ame mncsas)a2ururo;u4teto o3tld m ul(vo ()tltnio3iy1lm rlnvo ()tetoxm iu1lm n fesls)a2tr(  ;t4oltn f3iatfs ulump ()trtrxr oy1laDrlneo (0sruoxr oo4ap  mnetl(farrrx pou1apxn i3iat a2rl(ms t)artnmr tadlptr n s ( s2umio3oodop  lnei ( aDurur nu0tptoio3ildlm eln o;t)teermf3tatoa raivo ()texo(m iydlp  lnesls)sDuaurpnt4optnmicildfa2umnvont0teenxoctatomtr ivi t) rxoxr3oo4am   neslt) Dtrumont1opeoif3iatfmDua(vsn()altrio tatfpteaivols srtoxm3oo1al  mfcsls)a2ra(mp;t4tpeo f3iltfmDean p;()texnif3oy1oa rluvil( sexo(m3ny4omen fvs sf rrrx  nt0altoiocild mDrm(ms u4 rxomo3iydom rlivi ()t2xmim3iu1ap n fesa(faDrmum no4aexn feilsfm rln pnt0 ltrir tatlp rluvol( trxm(r3iudop  mivslt) rurur ;o0oee moeiysla rl(vs u4trxnmr3oatoa  lnvo;()truo(opno1omenmncil(  rraxr ;u0tex mfciydfaDem( sn(4 lxnxf3tadfat ai s t setrio nu1ameelnvtls)s2umu  no4alxoifeiys sDrmn pn()alxrxo tydomt an ol(0 2uo(o3nudopt  fvi tfsrum(ront4apt  fciydla eluvp;(0tlenifcootlm  lnvi ( srtoio oy1amtemivtl() Drax ono0aee if3ias aDrm(mpnu)tleoxf3tytlaDrlu s;( s2to(r oodllee fvil(f Duru  nt4tlxomoeiat m2ulump;u0aetnxo iytlpDeaueo s)s2xm(m oodole lfctas sDrrump;o4aeenmfeiltlm2ran o;t0tlenio3iatfm   nvo t trurim3ny1llt  neilt)artmurpot1oetniociltla2umn o u0artnir3todfmt lu ol()texoxm oodole lnvslt) 2tau  nt1opeoiieiadfs eln pn() lenio oo1lmDrlu slt  2urio nydlle  ivs t sDum(roou1alen ocilt s emn p u)aexomo iytomD aneol() rtoiopoo1ome  fciat  2raur ou0teeomfctyd s2umuvpnu)texrmr oo1fmD aneo;t sexmio3iy1alte ieils  2rrum ;u4apeoio3iysfm2um(ms;t4artnircto1fat li s;t0trxrir3ny1lptnlfvsat) rur( oot0tetoifctysls2rm(mo;t4tlxrmo3ia1oa ranvols) rurxo3iy4amenlfet s) Draxroou4oleomo3iltfm2elnvo;u) reomrctodom eau o;t)seto(m3nydap n ivs t aDtmu o;t1alxn ocildla uauvs (4texnxociadoa eaieo s0trum(r no1alee ictlsfsrur(m ;t4oeeomf3ildfa2em(vp;u)alxoir3tydfmtrauvi s)sexmir3iodomenlfci ()aDtm(r oo1apen octltla eaums;t0 eeoif3iatop eln s t0srtoir3io1altelncsls sDur( pnu1texn ieiytla rmuvp t0aexnxo3oydfm rai olt) 2um(r3iy4ll   nvt t sDrm(rpot0apx iiciatlaDeanvo t4trxrmf oy1fa eau il()trtrxo3no1lpenmfesl(f 2rrxr ;u0tltoiictatlaDra( o;(0tltnir io1lpDelu o s)s2uo(r no1lpen icsls  2urumpnu0aeeo oeildfm2rauvs t)tlxoxfcty1lp eli sls0t2xoxr3nu4omt mfei ( arraxrpno0opx  o3iat a ul(mo;() ltrircootom raueil( setm(r3oo4oltelnci sfsrtrxmpot0aexnmfetld s2rln p;(4 eenif3oadoaDr u ilt) eto(m3io4ap nmnvslsf 2taxrpnt4tetomietlsla2um( o;u4 eeriocoo1opt  ieo;t0srumir3ny4lp nlivt t a2rmx pou0olx  o3tls mDumu pnu0trtrxrcoydoaDrli i ( trur(o3iu1ol nlfvt t  Dua( p;o0tptnmfcild a umuvp u4 ltomf3to1lpD lu s s  eumxo oodll  lfci ( srta(rpno1aet iociydlmDuan s u)tltoxo3tydomt  n sl( setmxr oy1ol   iesl(  2rmum no1tpe moeilsls ua(mp t4alxoxr3iatomtr iei;s  2xo(mpio1lmtnmfcsa( a2ta(mono4oetoiieiysfsDrlnmp t) lxnmr3iatoa  aiesls t2xm(mpou4opte nctl(fsDra(rp;o4tpt  oeils aDea(vpn()aeermo3oa1opDeaueo t0 eto(opio1llt mfcsasfarua(ronu1oltomfeiasfs2rl(msn(0treoxo3to1fmDr nesl( trtm(m3oudlmt m
\ No newline at end of file
@@ -0,0 +1 @@
+nes (0tetmio3ou1lle  iciatf Dumx p;t1openmictasls umu snu4arenxr oy1lpt  uvs ( srtm(m oy4al   nvi (fa2ta(r ou4apx mi3ilslm ul( p t)tetrif iodfp rai o;t) 2xr(m3nudale miet () rrrum ;u4apt mi3iytla2ul(mo;t0trtrmf3iy1oateanei;s0 2to(mpoo1lmtelfei (fa2tm( ono4tpe  f3iad m ra(vs t)trtomo3todfpDrlneilt0trtmirpio1lp e fvtlt) Duau  oo0tetoiiciydls2emnmpnt4 exnxf oatfpD lu il()truoio oudlltnmfvt t) Drmx  ou4tpe iictydfsDul(mp;(0artomo3oatfa  au o (0s2uo(rpio4apt  fvsas  rta(ro;t1oetniieilslm elums t4aeenif oadoate nesls0 euo(opnudaptnlfctltfarrax p;o1opt mo3iadfsDumnms;(0altoxrcoydom r u ol(0t2to(o3io1openmnet ( artr(ro;u1aetnmoeiltls rmumon(0trtrircoodla e u sls0 eumio nudamtemfvtl(  rtau pot1oexnii3iasfm uauvpnt4alxoxr oadlp   ieo;s0teuoxmpnodlmtnliei t aDum(m nu1aee ii3tld a2eaumonu) rxoxocty1lpD ln il(0sruo(mpiu1lpteliet t)srtm(ro;o4olt mi3tyt sDuanvo;t) eenmr3oytomDe ieo t s2to(o3iydol elieiat)sDta(ront1oleoifcild s2eau s u0trtrxf oydomtrau s;s  2to(r3oy4lme lfvsa(farrmurono4opxomfctytfa ulumsnt4texoxo3tatoaDelu i;s)trtmxm3nu1omeemnetat s2ra(r oo1olx iicias s2eau o;u0arxoiocio1fpteaieol(  2xo(mpny4alee nvta()a2uauro;u4tpxo i3iaslsDean p;(4 lxnif oo1lat aneo;t0s2tmxm no1ale mnvi tf 2trum ot0alx moctysfaDeln s;u4 etoxf iadfaD aieil( t2uoim nodal e netatfarrrumpoo0opeoii3iydfs ea(vs (0trxnifciy1omtr ieslt)s2tr(rpnu1lp elnctlsfaDuaxm nu0ole  oetlsfaDemn o;()aetnxf3io1fmDeaivol() 2xm(m3iu4omt mnetls  Dra(m ou0alxomfeiyt s eln onu) eermocio1omDeaueslt srtr(mpou4al  mncilt  2rmu  ;o1tex ii3iaslm ean o;u0tleomrcoa1la  ln sls srtm(m3no1ape  ncsls) rum(mpot1aex  o3iyd aDeanvonu0texomr iodfp elivsl( sexmiopny4ole licsat)a2ta( pno4oexniieiydlmDrl(vp;t)alxnxo3iy1opt livsls srtoxopoo4ll  mnvsl(  Drr(mp;o1tlt ii3iysls rm(vp (0aeermr ty1omDrlu s;()teuoxo no4llt lfci ( arur(m ;t1oex  feiat s em(vs t)teenmf tytfmDr u s s0 2umxopoo4opte ics ( s2tm( o;t4aeeo ietlt a2ul(ms;t0alxoir ootla ranes t)t2xm(o oo1al elivtls a2tmx  ;t1tleoioeild a2rmnmo;(0arenmr3oo1lm  ai s;s0trtrir3ou1olenlnvs (fs2tmxmp;u1olenifciydlm eanvp (0aetnmo3oa1lp ran ols0t2uoxrpny1ame lfvi ( aDrax pno0oeeniicilsfm emuvs;u0 lxnmr3iy1fpDrauvi;(0srumxrpiu4optemfet s)sDuaump;o0tpenio3tld mDea(vs t) etnxr3oo1omDe ueo;()t2urxm nu1aptnmivt s aruau ono1aptomfeiltfaDumnmpnt)texrxo tytlmD aueo t srtmirpiy4aleelneiasf Dtm( onu0apeoii3iyd sDrmu snt)aexrmf3tytfa ran o;t)srumxo ny4optn ncilt a2umxr ;t1oeto fciydls2ulumo t4tetnmo iytomtrlivsls0setriopiy1altemfvsl() 2ra(mono1apxnmociys sDel(vonu0aetnxo to1fa rluvi t)srxoimpiy1lp n ietl(faDtmxrooo4tlxn o3tyt a2rauvsn()teenxf totfa e nvi s  rxmio3oo4olt lfetls s2ua(rpoo1tlt if3iltfm2umnmont0tetnmocio1fa  lneo;(  rtoim3io4omtnmfvtls) rua( o;u0tex mf3tydlm uluvs;t)aexnmfcto1fp raiei s0 2umxrpnydolt  ivia(farra( ono0opxo i3iys mDuanvpnt) eenxf3todlm  luvi;(  2toxrpoy1amtnmnet t) 2taxmono0tpx mocilsfs2ea(monu) ltomr tadla eli o s0srtm(m3oodap n feiat aDumxro;o4apxomf3tld mDemnvo u0texnxf tatlptr i o;(0 euoxopou1lmenmicils aDtax onu1oex ioeiltfa2rl(mp (0trenmo3ootlm rli sls0tetoxr3ou1ap nlfeias)aDrrxm ;t0opx  icild s ua(mo t4arerxr3iadoaDr neo;(0 2xo(rpno4lle mfvtls a2taur nt4aexomieiltfmDrlu pnu4alxomr ia1opte uvs;s) 2toir3iu1lleemfvs tf 2rmx o;u0apt iiciyd aDuluvsnt0alenmr ty1lmteau sl(0t2xrirpoydll   nci ()a2rrum ;o0ape mieiyd m em( s u)teeomr todfa e i o;(0t2umxm3oo1omte ivtls)aDtmxroou0aex io3tls mDelnvp t0texrio3tydfa   i o (0texm(mpnu1lltnlfvsltfaruaxrpnt4tpt mf3ils s2ulnms t4trtoxociodomtelivo (0s2xrirpnu4oleelfesasf Drmxr ;u1tpeomoctyt aDran pn(4 rtrxociy1lp e ies t trxoim oo4ole lfvslt) 2rmur ;o1oeeniocias sDuanvp;() etrio3totfaDran s s0s2xr(opoo4ame lfeiasfs2rrxmo;t4tpe mfciltfa uanmpnt0 lxnxr iodfmD ai slt0trumio ny4lmt lnvsl() 2rax oou1aee ii3tld mDea( s u)teenio iatfmD  n o;t)s2tmio3iu1omte icsat) rrrxrpno0alxnifcilsla ulnmo;(0trxrio totlp rluvilt tetoxm io1lpte feil() rrru pno1aex  fetld s ulums t0aetnifctodoa rlnvo (0t2to(o3oy1optelies s s2um(monu1tltoifeiytlm rm( o;t)alerxo iy1lp r neslt t2to(mpnodllee ncsat a2rr(rono0tpt  oeiysfsDeaumonu)altrmfcia1fpDr uei;s0s2xm(rpiy1lptnmieta(fsDrm(  no4aexomiciytla2rm( pnu0aeeomo3ta1omDe nei ()setm(r ny4lpte fci s aDrr(mp;t0tpeomicils s2umnmo;t)artrif iatoaDeauvils0 eurxmpiydlptnmfcil(fsrumxr nu4apt  ieild a um(mon(4 etnif3iadlateluvs t  etoxrpiy1ap e ivs t)aDra(mo;o0optnmoctadla2umnvs ()aexrmr tadlmtr i il( tetoim oodap emivi ()sDurxr oo0tlen ocilsfaDrlnvsnt0trtrif tatfmtrlivs;s)trxm(r3no4amte icsas) rrm(roou4apenmoeiltfmDrmnmo u) eenio oatfp e u ol( seto(mpno1lp  licsa(  2trxmp;o4aeenmo3tldfa2rlnvs (0trerxf oy1lm  lu s (  eum(m ny4lm n fci (f 2ur(mpot4oetniietytfs uln s;t) exnmf oy1omDrlivi;s) eurxm3no1ome  ics (f Dtax  no0aee mo3iasfa2uanmsnt) rxnmf totoatr ivi;s trurir3nudllen nes t s2tmu p;o1oetnmieiat s2uaums () rxrmf3oatla elnvsl(0tetm(m3ny4amte fcsltfa2urur ou0tpt iicildfs2eauvs;u4 etoxo3oytfa  ln sl( s2umio no1alt mfet s)sDumxmpot1tltn oetatlm el(ms;(0artrxr3tydfaD anvs;(0 2uoimpnu1omenlfci s)arua(m ;t1apxnifetatfs2ul(mp;(4areomr ty1fmDelu o;(0trxr(o3iu1lmt  neilt  Drr(mo;o4aexnii3iyd a rm(mo (0aleoxf3tytlm r n ol()s2to(opoudomtn feia(fsrtmum ;o4tet  f3ilsls ulums;u0treoio ia1latr uvs;( trtmim3io4olt  feils)aruaxrp;u0oltnii3tad m em(vp;t4altoio tatfa   i s t0srto(m3oodol   nesatfsDtauro;t4tptnio3tysla2umnmon(4 rtnir3tytoatraiei t) rxr(opnu4op emicslt)arra(mo;t0olxo f3iys s2uluvs u4arxoxr oydfpD  ues t0t2urir ou4llenmicilsfa2rmur ;u1oleniictad a2rmuvo (4 rxrxf iadopte iei t srtmimpiudam emiciat aDrrumooo0oexomietas a uanms;u4 rxnmrcoadlmD  ueo s0texoxr3ny1lme livt ( srraxmp;t4tetnii3iasla2elnms;(0tlerxo3iy1fpDr u i s)sexoimpny1optnlieslt a2uaxmpno0oee  o3tat mDumnmo;t0 rtrxf3tadlm eauvils0 2uo(rpnodlle  net t) Drmurpno4aexoif3iad s rln snu)alenxr ta1faDraivi;s0sruoxrpny1op n ncilt)sDum(m nt0optomfciltfs eaumpn(4tltoxocoo1omD aieo;s0srtoim no1lmte ncsas)s2urxrpoo4ale  o3ildfs ulnvs;u0texrmocty1lpDe i o ()s2xrxr3iudlp nmiet sfa2uaumooo4alen f3iatfm rmu s;u0aeeoio iotlp   uvi t)srxoxm3iy4amee nvtatfsDuaxmpnu4tlxoioeilt m2eauvp;t0 eerxfcoydfpDraneo s  2tmxo no1omtnlivs (fa2rru  ;o0tpx  oetlsfmDrmnvonu0tetrmrcoodlpDrau o s)t2tmir3nodomte ieiltfs2tm(r oo0tlxn ociat aDelnvpnt0 reomf3ta1lmtrli s;(0 exrxr3iy1ll  mfvt sf rrm(  no1aex  i3tyslaDumnvo;t4 lermf3oodfa rai olt) 2xr(rpou1lm emnvia( a2tr(mont1tptnif3iyslsDem(vp u0 rtoifctydlm r uvi;s0s2urxm3ny1lmtnmiei (fsrtmxmpnu1opxo oeias a raumo;(0aleoxr3tytlaD lnei;s) rtrimpou1lm nmieils  Dur( o;u1ale if3iydls2ea(msnt4aexnmo3tatlmDe u o s srurxr3iy4alt  nesls  ruauront4oeenioctltls ua(vs;()aeerxfcoatom r iesl(0srtrxmpoy4lmte fet (fa2ra(  no4apx  fcils aDrmu p;(4 ltrxociydomtelueolt0t2xoio nu4llee ivsatfsrtaxmpou0aexn ietadlm rmnmont4 exoif3io1fmte uvolt)sexm(o ou4lpeemfcias)srtaurp;o1teeoifciad a2um(mon() reoio iatoatelivs;() rxr(m ou1alenlietlt srtr(moou0tleoiictls a2emn p () lerxf iydfaDe i o;s sexm(mpiudoleemfvils s2tmxmpot4texnmf3tls a ranmpn(0aexnmf oy1opteaiei;s0 exmxrpiydome lncsas)artrxmo;o0aexnmo3tytfaDrau o;u)tleomocio1fpD  u i t0t2xrxmpiu4lpe  ivtl( aDraxmooo1tlt  fcildfm2emuvpn()trermfcoo1fmtrlivsl(0 exoxopiy4ol  lfvta(f 2taurpno4aeeniiciasfs2raump;u4 exrmoctatop rluvi t texmxo oudlmenmics sf rtrx ono4aeeoifeias s rlums;u0arxomr3iadfatr n o;t0 2tmxm no4amenmfeiat aDur( pnt1tle  o3iytlsDrl(ms t4 ltoxf3iatlmD ln ilt seuoio iy1lm  miciatf rumur oo0optoioetatlsDumn snt0alxrmo tytfaDeln o s)srxo(rpou4alt  fviat srtax oot0oexnmoeiyt m uauvo (0arenxo oytopte uvs ()texo(r3ou1openmnct ( a2rr(rpot1aexomoetldls2uaumo u0tltrifciy1fmD li s t0teumimpnydomteliviat  rtmu  ;o0tpeoioctadfaDumuvs;u0trxrxf oy1late ueil(0 etmxm oo4amenlivilsfarumxmp;u1aexnmf3iyt sDeanvo;t4 reomf3io1fptr ueo t trxmxm3ny4omteliesltf ruaxmp;o4opxnmoeiadlsDrlnvs t) ltrmo tatoa e iei;t) 2xmio3iy4ape  icslt)aDra(mp;t0alt iociatla ranvsnu0 rxrxfcta1fp  luvi;s0trxoxr3io1lm  lnvias s2trur ;o4olxoifctydls2el(mp;u0arxnmo iydfm   ivi;()t2xmxopno1apee ict t s2tmumpot4oleoiietytfs um(vsnu4tlenmr3iatlate iei t)teurimpio1al n fctat)sDurur ot4ale mi3tytfs2em( snu)texnir ootomtrau ol(0teum(r oo1amtelnctas aDta(r oo1olto oeiad a2em(vo t4 etoxfcio1lm  auvils0seuoxr3nu4omtemivslt)arumx  ;u1openmiciysfs2rau sn()trenmr3iydoat  u o;() eto(r iydol nlies t) 2tmxr nu1apeniieiatfm eauvonu4artnmfcoy1omD aieilt) exo(opnu4lptelfetas a2tax  ot1alt miciyt sDul(mp;u4 lxnif iodfa eaivilt  rxr(r3iu4ap nlicil()artmx o;o0tpxomf3iltlm eauvo;u4aetrio3iydfp   uvs (0t2xmxm io1lm nmicil()aDtmxr ;t1teen ieiyd s em(vpn(4areoif3iatla rln i t  2toimpiudoptelnvsl(fsDrmxmpou0olxn oetat sDul( p (4trtnmf3oydom eli i (0srxo(m3iy4alenmfes t  rur(rpou1tex  ieild m2rmu o;(4trxrmr tydoat aneo t)tetrirpno1omtelivta(  rurxrpot1open ieiasfa ua( o u0 ltnxf3totfaDelu s s)s2uoxo3iu4opte netat)srur(rpou0tlen o3iydls rl(vs;u0artnxr iatlmt auvo;t)srur(m no4lp emivsls arur(rpou0tpen ieils a ua(ms u4 etoiocta1lpD  nvilt)s2trxm3no4ape mivilsf 2taxr ot0apeoif3iad sDrmu pnu) exnirciatomDeanvo ( setm(o3iy4openmiei s arum(ro;t4alx  iciasfs ul( pn(0 rtrxoctodomD lnvs;s) 2tm(o io4aptnliviltf rumx pnt1tptomo3tad mDrl(mp (0arxomfcia1lp eauvs t)sexoiopno1ope mfvtlt srtaurpno1aptniicildlsDrln p (4arxrif iytfat  i s (0 eurio oo1ape  nvt s) rum(mp;u4optnmf3tlsfm2el(mp;(0 etnxf iytlate u ils t2tr(mpiy4omee nvtas sDumx ooo0tptnioeildfm ranmp;()aexnxr iotoate n s;()t2urxm nu4ape  ivi t  Duru  ;t0oeeoifetlsfsDeln o;(4trxoxf ta1oa r neo (  2tr(r nu4lmtelnvs sfartaxr ;o0aee  fcilt mDum(vp;()aeerxf3tadoptran ol( s2toxm nydamtnmivs () rtax ono4opxnmf3ias mDua( pnt4alenir3ta1fmDeanesl( teuo(mpou1omee fcs (fa2um(rp;t0tpxo i3ildls ra(vo;u)artoxfcoadfatean o (0t2trxr iydom  lics (fsrrmum ;o1tle  ociatfa2emnvo;(0altnxo iydfmD  ueo t0 eto(mpnodamen fvilt)sDta(m ;u0aptomocildls2uau pnu0 rermr todfpt ln o;() rurir no1ale mfeiat) 2rrx  nu0olto o3ilsfaDumuvsn(0aetnmoctotlptrauvs s setmxr3oodlmeemnvtltfarua( pou4oltn iciyt a2eau o;u4aeerio3iodoaDean ilt0seuoxopny4amee ieias)a2rrxmooo0texoii3ils s ua(ms u4 rtrxociotlpt aueo;t0s2urxm oudalte icsat sDur(m ;u4tpto ieiytfs2rluvs;u0tetnmf oodfp   nes;s  2tm(mpny4ol n neiltfartr(  ;t4apx ioeildls uluvp;(4tltoifctatoa rli i;t) 2tmirpoo4ope lnctatfa2tr(mpno4tetomfeilsfsDua(vo u)alenmf oa1fm rlnvsls)s2xm(o iu4om   ieslt)aDtru  no1olxomfciltla ra( o (0 renmo oy1fp  aneilt0srxr(mpny4al   nciatfsDurumont0ole  feiadfa rln pn() eenxfctodoptrluesls0trumxo3nudlleelicia(  Dtrxronu0ape mf3iltlmDulu s;u0trtnmf todopDe i s t)t2toxopio1ll nlivsat)artaxmo;t0altnioeild sDul(msn()alxnxf3tadlat  nvs;t0srtmirpiu1llenmfctasfa2ra(rp;o0tee iicilsfs ranvs u0texnmfcia1opDrlu olt0srumir3iy1llen icils) 2uau o;o4tetoiieils a2eanvp (0trxrmfctytlatrlneilt  rur(r3oy4amt livt ( s2rr( ono4alen fctlt a ran p u) lermrcoatfp eaivs s) rxmxr oo4al elfeiasf 2um(ro;u4tlx moctltla elump u4artrio3iy1fatelnes;() rtoim3nodol nlfeiltf 2ua(rooo4ale  icildls2emnmp;u4aeeoio iadfpt livo t) rtrxr3iy4om emieiltf 2ur( o;u1teen feild m ea(vp u0 reniociytfp r uvo s  exr(m3oy4amt  fes (fs2urx pot4tpx mociad s ua( onu4tlxniociotom eaies;t)srtoxm oudomte fvils s2tmu pnt0aeeoiictasfaDemnmo;u) rtniocio1la rluvsls0s2xm(o3ny1omtnlfeia(fa2ra(mp;u0aetoif3ils m el(mpnt)aexnxoctadopt aues t0 eur(o ou4omtnlneslt aDtr(ronu4oltomoeiyt a2ulu ont4 eenircoydfpDr uvs s)t2tr(r oudlp elict s  2uaum no0opxoifeilsfaDumnms;u)tleoifciydlaDean o;(0s2uo(m oo4opee nciasfsDur(m oo1alt ifeilsla rlumpnt)altoxr tatlpDran i;t0 2urxm3oy4olenmfvsltfsrtrx o;o4ale  i3tyd m2elump (4aleoir iatfm eaivi t trur(mpio1am n ivsa()aruaxrooo0tle miciadlsDuanms () rxomr3oydomtr nvo s0 eurimpnudolte nvtas) Drau  ot1alenmieilsfmDrlnmp;(4artoxo3oytfat livolt)t2tmxm3nudlp nmncsl(fa2rm(ront0teto fetldlsDrl( p;t)tetnmfcoadlpte i ols srto(r3io1ll n neias aruru  nt4tlxnif3iat sDelnmsnu4aetnio tadom rlu i t)setr(opno1al  mici ( sDrrxrooo0tle iieiydfa ulnmp;(0 renxr3oodomDeanes t)setoio oudam eliciltfaruau poo4oeenmfciyt a um(vo;t0trenmr3tytfaD li sl(  eto(mpiodop  mictl( srrmxmo;o1tltnioeildlmDel( s;u) etoxf tytop rli o t0trxoir3ny4om  micilt sDur(rp;t0oee  feildfm2eanmo;u4 ltrmoctytfpDeaneo;t trxo(mpny1lm elfvias) Durur ot1apt mociad s umu s;(4texnmoctatfpt lu ol(0 etoir3nydlptnlncsl()arumu pno0oeto ietldfm rau p;t4 etomf tatopDeaies;s setrxmpoudlm  mnvsl()sDtr( oot1aeeo o3tlt m ua(vpnt0trtoxoctodlpD lnei;( s2xmxrpoy1ame livs t sDraur no1aexnmo3ildlsDrmumon()aeeoxociytfaD anvol() 2xoxm nydoltemnciat sDuax p;u0tlxoioeild aDrauvo;(0tltrif3tydfpD aivo;s)texrimpnu4op e nes s) 2ra(m no1tlx mo3tlsla2ul(ms ()trxnxr oy1latrlneo s0t2ur(opny4alenlfvilt)arur(rp;t4ole iocildlsDuanmpnu0texnif3tydlm eaneo;t0trtoxo3ou1olt mnetasfsDrrxmpoo4tlen fetasla uan o;(0artomf3oadlm eluei;s0 2uoxm3nu4apen fciltfs2tmx pnt0oeeoifetas mDul( s;u0teeomrcoytfptrai o s trxr(o iu1oleemivsa(  rra(r oo1tlt ii3tadlsDranmp (4 etnxr3tatopDeai s;s)tetm(m3iydaleemfeta(  Dtrum nu0oex iiciltls2emu onu)tetrmf3oy1oaDe nvs t)srtrxmpiy4al  lfeia()a2rruroou4tle ioeiys s rluvs;u) etrxr3oa1faDrlivs;t  rxmxr3oy4al nmict tfa2raxrp;u4teeomicilt s eanms;t4trenxr3oydlaDeli o s)trxmxopio4alteliet ( a2ra( pot1tptniieiyt m rm( s;u) ltrxr oatlmt  ivo s)srur(opnodlmtnlietls) Duaump;u1tlxomociydfa umnmo;t)treoxf oadomtr uei;s)sexr(r ny1lptnmnetlt artau  nu0olxoioetasfs2uauvo;() etomociadlmtrlivi;(0teur(r3iu4ameelnvsat s2trx ooo0apen feiatla rmnvo;t0trtoxfcoytom eaieo t0s2trir3no1om   fei tfa2umxro;o1tlt mi3iatfa2elump;u4teeomrcoodopD auvo;t0seurxm nudoltnmneta(fsDra(mono1alen icilsfaDrmu s;u4texnif3todoptrliei;(  2trxr ny4ap  livia(f rrmx  nt4texn i3iat aDumu p t4 rtrmr oytla  li s s)srur(r3ou1lleemieilt)srrm( p;o1aee iieiys mDelnmo t)trtnmr iydoaDraivo;t s2uriopiu1omtnlfctas  2umxm ou4tpenifcilsfsDuln p ()artnxrcty1lmDrln ols0t2xr(rpio1alen iciat  Dumur ou1alenio3tydls2el(vp;()trtrxr iatlm e nvslt s2tm(m3iu1amtemfctasf rtr(m ;o4tle  octytfm rm(mp;t)teerir3tadfpteau s s0 2umxo ou4ll nmneta() 2rmxm ot0tpenmfctys mDrmuvpnu4 etnxocootlp   n o;(  2xmimpoy4lmte fvtl( a2rmu o;t1apx  fetldls2ea(vo;()trxrmo iadlmtrlnvil(0srur(o oo1optn ieta()aDtmxr nu4tpt  o3ild s umuvp;u4tlxrxf oo1fateau o s  2tr(rpoo4ome lieil() Drmuroot4texo feiysfaDeluvs t0trxnmr3tadfp  li sl(0t2uoxo3nodol   fvtat sDurur oo4oexnmfciysls eau p;t) rtnxr iytopt ai o;s) rtoimpnydomeemnvslt sDtm(rpno4alxo ocilsls2ua(msnt)aexnxr oytlpD li s t)t2xmir no4aleelivtasf Dum(r nu1olxomictytfm2elnvpnu)tltoxo3io1op  an sl() 2uoxm3nudamen ivt t a2ururono0tptomo3ias s2rlnmp u)alermr3to1faDraieslt0seuoxrpny1lptnlieia()srrmur nu4altnmictls sDeluvs;()arermrctodomDeli slt trurxm oodaptemnci (  2tm(rono1oltnmfetas m2rl(von(0aeenxfctodlateli i s)sruoxr3iudlpe mfeiatfarrau pou0tpt io3iad a emuvpn()aexoif iytop  lu o;s trxo(rpnudlpe mfcia( arumx p;o0aetnioctys m umn s u)artrxo3oadfaDrau s;(0texm(o3nu4ale mfvtat) 2uaxmpou0opeoif3tatlaDrlu s;u0teeomocoydopt aivsl(0s2um(rpou4lpe lnei sf rtaxmoou0tltn o3iyd aDrau p t0trermr tatopDrlivs ( s2umiopny1ap   ici sfsrtru o;o4oeeoiiciatfs elnmpnu)tleoxr3tatfmD  iei (0sexoim nydal e ietl() rrm( ooo0aleoiiciysfsDeau sn(0aeerio totlmD livi t)s2xmxrpnodape mfviltfsrrm(m nu1tex  iciatfm2eau p t4aleoxfcootlaD lnvs s)s2um(o ou4ole  iesat a2um(moou0aeeoiieiyslsDua(vpnu4tleoif ia1lm rau o s  euo(m ny1ope lfvsltfs2rmx ooo4aptoii3tadfsDrm(vsn(0 ltomo oytlm rlnvi ( seurxr nu1ol  lnviasf Dum(  ;t1oex iieiytla eanms u0tlxrif iydop raieo s0srum(m nodlmte nct t)s2uau ono1oltn feiytfsDeau snu0teeoiociotopDelnvo t) 2xoir no4ap nmictlt a2tmx poo4olenio3iyd a rln o t) rtrmf3oydoat anesl()texrxo nu1omtelncsls) Dur( oot0aexomf3iytlaDem( s;(4teerifctytfa e u s ()s2urxrpiy4om e fet (f ruauro;u1olxn octaslm umump;t)alenir3oadoa r u o;t)srumxopiy4apeemict t s2ta(rp;t4oexnmi3iydfsDeaumsn(4teenio3oydoat lnvil( tetoxmpno4ol   ivtas s2tmu  ot4alxnmi3iadfa emuvsnu0aleomo oa1lm e nvolt t2xoiopoo4lmt mnvtas srrr(mooo1opxnmo3iys m2um( p (4areoxf iotoa ranvo t)seur(o3nu4llen iet t sDumurpno4tptnmf3iltfs2uaumont)aexnxf oy1late uvsls)t2umxrpiydamte nvia( aDtr(mo;u4teen oeiasls2ulnms;u)aexnir3ia1lp  aivo;( srxoxopoo4ol nmictl( srrmxroou0texniociadfm rmuvo ()arerio3ia1op eauei;t0seurxr3oydomtelfcsa( a2tru  nu4alxo ictytla eau s;() lxrmocoydlat ln o;s) 2uo(opiydal emnvt t sDtaxmo;o0tleoiiciydls elnmo (0 exomr oo1lpDrln ols0tetrimpiodol emfes ()srumurp;o4aeenioetad mDea(vs (4aetoircoa1oa r uvo;s)sexoimpio4lp nlivi s artmxmpou1opt  o3iytfa2eluvp;t4trenxr3iydlm  ai s s tetoxm io1op   nvi sf Dtm(r nt0oetnmf3tlslm2elums u)tlxnxoctadop raieo s0srxo(m3nu4op  lfei (f 2uaump;t0texoiocildlsDuanvpn(0artriocoatopD  n ols)teumxm3ou1aleemnviat arua( o;u1apeo feiatfs2rlnmonu0trenxo3ootfatrlivs;s0 ruo(o3iu1openlicsat aDrmurpot0aetn ietltfa emnmo;() lenmo3iadlm rluei;t0 2xmim3nydll n netat  2tax ono1teeomocias a rl(vp (0teeoir ta1laD aueils trtrxr nodlleemfeta( a2umurpot4teen ieiltlsDrmnms ()tltoiocoatlpteliei s0 2umxo iu1lmenlnei ( a2urxro;u0oee ioeiltfs2umnvs (4altoif3iatlpt an o;( t2tmxrpoydaltemictasf 2rmu onu0aleo icilt sDrmu sn()teerircootlm rauvils  ruoxmpnydomeemics sf rtm(rooo1aeeniiciys a rmu s (4 lxnxr iadlaD  neolt srurimpoo4alt mfvt sfsrtax  ;u4aptoioetys s2rluvo t4alxrmocio1fmDrauvs t  rtmxopiu4ap nlivi (fa2tru pno4oeenmoctltlsDemu ont0areoiociytfatrauvsls0 exmxm oydlmt  fvtat)s2tmur ;t1aetniiciasfm2uanvsnu4artnmf3iytoatrai olt)srxr(o iodolte fcsasf 2rmx pnt0tptn oetytfa ra(mp () rxomfcoydlp raivs s)s2uoio iu1oltnmfet sf 2tm(monu1open fciadfm2umums;u0 rxnmf3iatlaDrauvi s)trtrxr3oydole lfcslsfaDrmur ;o1oetnio3ild s2ra( s;t)arenxo ia1oaDrlivilt setoirpio4lme lfvtat aDtmxr nt1aex mfciltfaDem( o;u0texnxr iydopt luvil(0 eum(o3oudamtemici tfartr(rooo4optnmieiadfm2ua( onu) lxnif3oa1lat  ieols)srxrirpno1optnlietlt srumu pno4olen iciat aDean p;(0tleomrcoy1optrau o t0trurxo3oodlpen nvt t)srrmu o;o4ope mfctys m uanmpnu)arerio3oa1lptraivolt)sexmim oodol   fcsat)aruaurpnu1tpx iieilsfs2el(mo (4 ltomfciytlp   uei;t0setoim iodap nmfet () rrru pnu0alxnio3iyslmDua(mp u0tlenxr oy1fpDean o t  2urxo3iudalt miei tf rraump;o0apxomi3iltfa rl(vo (4 lerir tadfa rlueo t0setr(opiu1lmee iviatfs2ta(moot0tltoiociadla2ea(vsnu)tleniociy1lp  aueo t  eumxrpoy1ll   fesl(f 2tax  ;o0tetoiiciltlsDemnvo (0aetnxf3oytom rlivsls0tetr(r no1aptnmnvi t srtrxrpnt0tpeo i3iysls2emumpn() rtnircoatlmtelu sl() rur(m ou1optelivsls a2umum ot0oexomf3tld a2umu p;u)aeermo3oo1faDr neo ( seurxr3oo4ap  miei (  Dtaurono4ale ioeiadla ra(mp;(0 lermfciodoat lueo;s0srto(o oodap emfctl(fsrraxm nt1oleomf3ias sDum( o;u0 reomocia1la   n il() 2xr(r oy4olt lncta( arurxrono1tpx  fcilsfaDum(vo;(4tlxnxf3oy1la e n o ( teum(mpoodll elfet (fa2rmur nu0tlxomfciadls2rl(vs (0teenif3oa1opDe ieils0 rxmxo iu1om e icias a2rrx ont0olx  ocilt mDem(monu)tltrxociatfmDrai o;t  rtm(r3nu1altelncil(f Dua(  ou4tle  iciysls ulnmo u4artnmrcoadfp rlnei;(0 exoio iy1alte iet (  rta(ro;u4apeomf3iydlmDemnvp;t)artniocoatfpDrai s;() 2uoim3iu1llt mfviatfsDtaxronu0oetnif3iatfsDuanvs t0aleriociydom  au o s0sruoxr no1al  lneia( srrm(rp;u1olxomieildlm ra( p (0 rxrxocty1omDraneo s0t2uo(m3ny1lle lfvslsf rtmxro;o4alxomfeiltla em( s t4aeeomo oo1omDr i ilt srxoxrpiy4am nlfcsa( aDua(rooo4tptnmi3ilslsDum(mont0 reriocoodoptraieslt0 ruoxo3iodoptelfvilsfa2umurono4alxn iciat sDuau p ()artrxr3ta1fptelnei;t) rtrim3iodopt miciatfaDtaxro;u4teto ieiltlsDra(ms t4tleoifciadomDrlnvo t0 etrim oydolt  iei tfa2rrumpot0tle mi3ildlaDrmnmp u0 ltrxr3tadlatrlivs ( trtrxm io4ame lfciltfa2umx poo4olxoifetydfm2em( pn()texrirciadlp  auvi ( texoxr nydamtelfvslt sDumump;t4opx iietltlaDelnmsnt4tltnxf oydlmDrli s t0sexmxr3oo4ale mfetls)aDur(  oo0alt ifeiasfaDrln p;t4tlermrcoo1om e n o ()t2toxo3iudole mict ( sruau  ot1oeeoii3iasfm2raump u0trtoxoctadfpDeaneo (0seuriopnu1aptnlfvs tfa2rr( o;t0alt  i3tatlm umu s;t4 ltnmf3ty1oa rluvi ()t2tr(r no4lpee ictls a2uaxmont0tlxoiictysfm el(von()trtrifcoatfa   u i t0 rxoimpoudlp elfei ( arur(  ou4texnmoeiytls emnmo;u)tltrmo totfaDrlu s t  exr(rpiydlptelici s)artaxmoot4aet  octlsfaDeauvont0 eeoir3ta1lmtrln ils0setr(rpoy4lm nmfcs ()srrmurono4teto i3tyt m umnvs (4 eermf3ta1optr ivs;()s2uriopnu1omtnlnesltf 2uaumo;u0tlx  oetadlm2rm(mon() rtniocio1fpt li o s)srxm(r3ou4llt lfei tfs2rmxrpnt0oex iieiltlm rmnvp;u)aleoir oatfmD aues;( t2xrxopny1lp nmnet tfsruauro;o4apenioctltfs2rmu sn(4artoxr3totlp e i o;()trxo(r iy1apenmfcs (farrrxmpoo1openmi3iadfm2ulump;(0arenmrcoadopDrluvsl( srxmxr3oy1opte nci ()sDumurpot4aee iiciadfmDel( s;u) rxnxf tadomDeluvol(0sexm(r ou1alenlfci t)sDtr(  ;u1oeen ocildfa2rm(vp;()arxnmr tadfatr nei s0 euoimpoy1lmtn icta(fsrtau oou1tex mfeiadfs ea(mpn(4 rxnxfciodlmte ieo (  eurio3nu4ome lictltfaDrrump;t4aeenio3tysla2elnvo;u4tlenir ootlmD au o s0 2tmir3no4olt  ncsa( s2tm(ronu4aleoio3iatfa ul(ms (0aleniociotfpte ies (0texo(o3iu1lme  ieia(fs2uau o;o1oltnmi3iyslaDem(vo t) exoxocia1op  lnvi t0s2tm(o no1lmen ies sf 2urx oot1texomieiltlsDran s t4treoxrcoy1lptr nvsls srto(o3io4lmtemfvta()srurxront4tpe  fciadlm ean o u0aexnxrciy1la r ueo s0 rtm(r io1optemfvi t  2trxrpno4altn fctyd sDemu s;t0tleoxf3ootfmD  ieolt  exrxo3oy4lmt lietls) ruax  nt0apto i3ils m eanmo;t0 etnif3oadfaDelu ol()s2xo(opnudom e ietas a2uau ont4oleo fetyslmDumnmp u)aexoxocootfmDeau sl(  exoimpiu1lpe  fviasfa2ua( onu0olto f3iys m rm(vo;u0arenifctatom elnesls)t2xr(r3oydapen icta(fa2ra(rp;o1tpx moeildfa2umuvp;u4tlxrmf ty1oaDelivsl(0 rtmirpoo4am  mivs s artrurp;t1alxn feiydlaDem(vpnt0trtrxfcoa1lmt aneo t)t2xoxo nydalte nvs s)srtmu  ou1tlxn feiaslmDraump (0 ltomo3oa1oatrlivi;s  etmim3nudlm emnei ()s2trumoou4tpenmieiadlmDulumsn()artoif ia1fa   ieol(0setrir iodol e fcias sDrrxr ou1aexo o3iyt a2uan s (4altoir3to1lp  aneilt  2urimpou1ol emicil()srumx  ;o1tpe  ietyd sDeauvs;u)areomr tadom   neo ( s2xmim3oo4lp nmivt ( sDuaxm ot0oeenmiciaslmDraumsnt4trxoxo3oa1lpD ln i;s0trxmim3oy4lmtemivtlt sDtm(m ot1aleomf3iyt sDumuvsn(4aetrif tatlatrln i;(0 rtoio oudomee ivilt sDtr( ooo4oeeo o3iltfm em( p (0tlxomo tydlaD  nei;t0t2trxr oy1olee nvslsfa2rrxrpot1apeomociaslsDrmn onu) ltnio3oydoa r uvsl( sexriopoydaptemfeias)s2tmum nt4ole ioetaslaDrmumo (4trenxo tydla  aueilt)seumxmpio1al emici s)a2rr(mooo4tpe ioctysfs2em( snt)alxrmf3oatoa  aivil( s2xoiopoy1ale  nctl( s2rm(m ot4opto i3tat sDuau p t4tlxnmr3iotfp ranvs;s)trtmir nodlptelivt () Drmxmont4tex mictatls2ulu o t4altrif3tydlm r n i (  2um(o iudopen nvtlt sruax pou1olxomoctydls ra( s;(0 renxr3ia1fmt ai s;s0 etrim ny1ap   fei tfsrtrx pot1tpe  oetldfmDra(ms;t0aetomo3iytopt  ueo ()trxoxm3io4amtnlivsa(  rtmx oou0tpe  ietlsfa raumon(0altniociytfatraies;(0sruo(rpoo1opte ncs (  ruaxmpou4oee mi3tas sDran snu4aeerif todla rlueilt0s2uoio3io4apeemnvsls  rua(r ;t0aptnmieiys aDuauvo t) rxrmo3iodomDeanvsls seumimpny4llt  nvil( a2tmurpnt1alx micilslmDra(ms t) etnifciodopte nvi t trxrxr3ou4lptnmfetas sDuaxrpoo0tle  o3iad aDel(mp;(4 renxf tatlmt  ivi t)t2uo(o3oo1opt licsls sDum(  oo4opx  ieiadfs2ran snt) etomo3ta1fp r nvi;s  euo(m3oo4omtn nci ()a2ur( ont4tpx  ietatlm2eau ont4aeenxrcootomDrln i s)trtmir oo4amt lfvia( sDtrxro;u1tex io3iys m2ua(vo;t0 ltnmf3io1omt aneslt)sruo(r3oodoltemfvs t)sDtaxr ot0tlt mocias aDumumpnu) lxniocoytomtrau s;()teuo(m3nydlpteliesa( aDua(  ou1tpt  ictls a rmuvp;u)trerxr iodlmDeaiei;s t2xm(m3iydlptnmnvtas) 2rmumpoo0tlxn ietadfs elu pnu)tlxnmr3iadlptr u o;t0 2xr(m3nydap e iet (  2rru poo4ale iictydls2emu ont) reomoctydop  auvsl(0trxr(r iy1ap nlfviatfsDumx p;t0aeen ieiad sDrmu o t)aetnmf3oy1faDelies s t2xmxopoodape mneslsfsDtax pnu0alenifciydls em(mpnt0trerxo oatfmDe ieil( s2xo(opiu4llt  ivs sf rtaurpnu1alxnifciydls2elu snu0 reoxf3todfateauvi;t0seur(opnydame  ici ( srrrur no4oleoiiciasfs rmuvsn(4alenxoctadlm eaies ()teurir3oy4amt lnvsltf rraump;u0aexo feiadfs2uanmpnu)trtoxf ootomD livi;s tetoir ou4lmt mncsltfsrtrurpno4tpx mictlslmDuanmsn(4 exrmfciy1fmDeanvs (0 eurxr3ou4ap  mictat) Durxmoou1oexnmfciyt s2rluvs t4 lxoxf iatom ranvols0 euo(r3iy4aptnlics (f rra(m nu4aeen oeiytlmDemnvsn() exrio3to1op eau ils0teurxm ou4apenmnesat)aDraumo;t0tltnif3iltfm2ul(vpn(0aeeomo iatlmte uvo;t sruoiopoo4openmnct sf 2urx o;u4aet moetld aDum(mo u4 etnmo3oadfateaiei;s0teuoio oy4ll nlncilt)srtmur oo1aeeomo3ilsfm uanms;u4 rtrxf3ootomDraivs t0 rumxr oy4am emnct sfarrm(r ;o1olxn i3tldla2ul(vp ()aexoxfciatlpDelies (  rurxr ny4ame lnvi tf Drrxrp;u4aex  f3tydfa rm( o;u4trtnmf oa1fpD ln s;s)setr(opiudomtnmiet s) Draurpno0aexo ietlt m rlu s;(0trxomr3tydomDeaueol() euoxmpnodale liei tfa2tr(r ;u4oltn f3tyd sDrau o t4alxoirciy1lp r ieo;t texoxrpiudlmenmici t)srurxr ;o1oex mictltfm eln pnu4alxnif ta1fm  aivols0s2xr(o oo1am   nvslsf Dta(r ;o1ale  feiat s2rmn o u0trtrmrcoatopDrlues ()setrxm nydlm n fetl( s2taxmpot4aetnmoetatfa umnms;t4aexnmf3iodfat  uei;(0 eumxr3oo4lp elfei s) rtaurpoo0oetnmociyd a2el( pnu)tetrmfcootoaDr nvs;()t2xr(m3io1llt mnet t)a2ta( pno0altnio3ilslmDemu p u4 lenio3tatopt lieo t  etmir nu4ome micilt) 2taxmo;o4oeeoiociadfmDrau snu)trenmrciodfp  anvs s0 rtm(mpiy1op  mieiat) Durumo;o1apx ifeildfm rlnvp;u)tltrir iodfa e iei;t sruoiopnu4alenlncsls a2tm(  ;t1ole moetatls uanmo u) lxomocia1laDeai s ( s2xm(mpny1om elfvi t)aDur( poo1opeomo3tldla2raumo t0tltoxociytom ran o t) rxrxmpnu1al e icia(faDuaump;u0aet iiciytls uau o u0tetoiociytlpDe nvi;s)trxo(r3iodlmenmfes sfs2ua(ront0apto oetas s rmums;u)teermrciytomtrlnei (  ruo(mpoy4apen feslt srtax  no4tlxomo3iadfaDulumsnt0 eenxfctadfmD  neolt) exoiopoy1ole mnvsl(fsrra(rpnu4olt mocildls ul( s;u)tetnif3ootfp   neo (0 rtoir3oy4ap n fetas)sDuaxmont1aetnmiciys aDelums u) rxnmr tydfpt luei (0sexr(opou4ame  ics t) rtmxmpnu1tpxo oeiatfs rmump (0artrmr iy1la r ueo s)tetmxr3ny4olt  fcsasf 2um(mo;t0oee mi3tldfm elnmp;u)trtrio io1fmt aueslt)t2xmxrpou4alte ietas)srtrx  ;u0tet  i3iytlaDul( p u)alenxfcoo1fpDeaies;s) 2trxmpoodom  lfcias) 2uau  nu1opxo f3tldla2rmnvpnu0 exoxr3oadlm  anvi t)s2xm(r iu1lptemfetas)aDtm(  ;t4tee  f3ils sDuanvo;(4teerir iotfmte n s;s tetrxmpoo1op e ivsat s2raurpoo0texo o3iytfm2ua(msn(0 exomfctatlm  ln ols0 rur(opnydlmt mnvta() rrm(mont0tpxn fciyd s2ran p u4aexnxfciy1lat  nvs;()setmirpnu1apteliviasfarrmx  ;u1oeen i3tatlsDeau s;(0tetnxr iodlm elivo (0srur(mpou1lle  fcs tfaDrrum ;o0apx mietytla ulu snu)arxomr oydoateauvo;t0setoxrpiu1om emiei ()a2tm(mo;o0oltomfetydlsDrlu o () rxoiocto1lm eanvils)s2xr(m3ny4aptemfet (fa2ur( poo4optomfciysfm2rm(vs;u0 lenxr tadfpt lu s;()truo(o ou4olt mfet () 2umurp;u1tet mo3ildlm umnvo;t)aexomr oadfpDeanvo s)sruriopnu4apen nvils s2rru ono0apenmo3tadlm raumo;u0 etomo3oydopD anei;t0tetmim io1lpenlieils)artm(mp;u0oexnif3tlslsDrau ont)aetnmfcoa1oat  ivo;s0 2ur(rpiydaptn ieia(fa2umu  nu4tlx if3ilt aDuanvsnt4 lxriociatom   neo;t  exo(rpnudlle mivt (fs2tmx o;t0ale ii3iat aDua(vp;u)aexnxo3oa1fateau i;s)t2uo(mpoy1lmteliesa() 2raump;u4oltniieiltfs2ulnvs ()treoxfcoadfmtrauvs;() 2to(r3iydoptemivsls)arur(r ou1aex moeiat mDum(vs;() rtrmo3todoa  auvi;t trtmxo3iudal  lictls)s2tmxrp;t0tpxnmiciasfa emuvo;t4 rxnio oytlat lu ils srurimpno1olt miviltfaDurump;u0tlxnmoetlt s2rau p u0teeoxociydomt auvils t2uoir3no1op nmnetas)arumumo;t0altnmiciyt m2emuvs;(0altnmrcto1lp  luvo;s0tetr(m iy4lmee ici ()srrr(r ;t0alxomoeiysfmDeanmsnt)artrir oa1fmDrai o t) 2tm(opno4apt lnvslt)aDraxm nu0tlt mi3iltlaDraums (4 eenio iytfmDeaueil() rxoirpno1ol emfct t  Dumum nu1olenmf3iat mDelu o u4aetrxf3oo1lm eanvs t)trxmxo3iudllee iesas)a2ta(rooo1aetnifcils a2rau pnt4 exnmo3oytopDelnei;( trtrim iudop   fvtlt) Drm(mo;u1tlxomfeiasfs uanvsnu0 lxrxoctytfmDelieolt trxoim3ny1om eliesls)artaxmp;o0tet iieilsfa ea(vpn() ltrmfctadoptrlneolt setm(r3oy4oltemfetat a2rrumpnu0tpxniiciyslmDumu p;u0 lxnif3tytlptrauvs;()srum(m3iy1ll  lfvta(fsrtrxr ;t1tlxomi3ilsfs rln s (4trtrir3iatfp  au ils)t2xrxrpnu1omtnlnvs tfs2tmx ooo4apxo fciyt a2ra(mpnu0 leomf ootfaDrauvo;t trxr(r3iydopt  feta()a2ua(mooo1oltniiciatlm2raums;(4alxnifctytfpD  ueol(0srur(o3no4aptnlnctls a2ra(mpno0tptnifciadlsDelnvpn(0alxomocoatfateln slt0 eto(r iy4al emnvi sf 2umumoou1alx iiciat sDelnms;u4tlenio3oy1fmD aueo;s  ruoim iy1oltnlfvtl( arrm( pnt0oeenmiciydfm emnmp u4altomf3to1fp eanvol()teurxr3ou1ole lict ( a2uaurpoo4ope iictatfa uan o t) etrmociodoaDrauvo;s  etr(r3nydole  fct (fa2raur nt0tlen fciatfs2rl( o u4aetnifcia1lateluvo s) eur(mpnudolenmfctl(fs2tmurpoo0texomi3iytfmDul(vo;u) renircta1lp   i o (0srxoxmpou4ol e ivi (  Dtrxront0aexn fetld a ul(ms;(4artomo oytopte u o;()setr(mpiu1ope lnes tf 2trxmpnt1oleomfciyt aDuauvp u0 rxrxf3oatopDran i;(0srxoir oo1optnlfeia()aDtm(rp;u4oleoiociyslaDel(msnu) lxnir iotlatrlneo s) etrio nu4amt  nvils srrmx  ;t1optoifcils sDra( s u0texrmo3iy1fm rai o;s)trtrirpoy1apt lneias aDtr( p;o4tpxn fctyt s ra(mo;u)artnio3oatlm  aueols s2uoxm oo1lle  fct s)aDrrurp;o0texnmieiysfaDumu p t) rerif oo1faDean ols)truoxo3ou4ll  micsasfaDrm(rpnt4alt iociytfaDemn onu0tlxomrcoa1lmtranvolt0seur(r oudamtnmnvsa(fs2ta(rpnu4aex ifeildls2rln p;(4texnif oodomtraneol()setr(r3io1omenlnet s sDraumpnt4aeeoifciad aDranmp u0artrirciydopD an il(0tetrir3io4lpe lnct sf Drm(rpoo4aeen oetasfa elnmp;t)tleoirciydlate u ils0srxrio3ny1am e fviat  rrauroou0opt mfciltlmDuanmo (0 eenxocoytfpteanei;s0t2tm(o3iodoltnmics tfsDtmu  oo4oetnmfctad sDrmums t4artnxociytoatran sl(0srurxopiy4oleemicsls)arrru  nu4alenioctys s emumpnu0teenxo3iatlatranvolt  rxr(r nodlpeelfvsas) Dum(rp;t4teto f3tys s emuvp t4 eenifcoodfateliei;s  rumim3nodoltelfet (f Drru oou1tle mf3ilt mDra(von(0 rxrio todfp  au sls0t2tmxm3iodal elfvslsfsDra(r ;o0apt ifciltlm2emumo t0 etnmo oytom  auvolt0sexmim iydaltn ncsat srrr(rono4opt  i3tysla em(vpn(0treoxr tytom r neols) rurxm oo4ol n nct t artaxmp;o0altomociydla2ea( sn() reoir to1fa  lnvils)trtoio iu1alen fctl()s2rmu p;t4oexoifeildlm umums u4altnmociotopD lieslt srtr(o iu4ol e neia( sDum(mp;t0tpx mieilsfa2ul( s u)areomo tadfate ivo;s0srur(opou4llt mfvsls  2tr(rp;u4oexnmoeiadlaDrl( pn(0trermr3oo1optelnvi;()trxrxrpnu1lp elfctat a2taumpoo0ole if3iys mDra(vs u4teermoctotfmtr ivsls) ruo(o iydalee nes s) rrmur ;t1aeenmiciasfm rmums (4areoirciy1lm rluvi;(0 2toxrpiudll   nvils srrrxm nt1tetn i3ils s2rmnmpnt4altnmrctydlp rluesls tetmxmpiy1ap e ici (f 2rau o;o0ale  o3iydlm2elumont4tltnmfctydla  livo s seuoxr3oudlmeemicsltfsrua(  no0oltoif3iatfsDra(mo;u0 rxrmf3oatoa elivo;s)trxmxm iodlm elictls a2uax oot0apto feilt a ua(mp u) rtoio3oo1lm e nei s)t2tmxopou1lme  fcs t)srrmumpoo1tpxo ictatls ulnvo;t) exrxr3ootlpDeli ils) 2xoxopoy4ole mnvi tfaDum(mpno0aexo i3iaslaDuluvpn(0altriocoydfp r neo s0 2ur(mpnu1lltnmfcsl( sDraumpnt0ale  ociydls2ulu s (4 rtoxr3oytfptr ues t) 2trxm iy1aptelfei tfa2um(mpno1olxniiciyt s2rmump t) rxnxo iadfpDelu s;s) etoxmpoydllen fvsatfsrraumo;o1tet  fcils a2um(vsnt4 exrxf3ty1fpt auvi s0trto(rpoudll emnci s srtmum nu1aetnifeiyd m ranvonu0 lxoir3oa1omDelnvi;()trum(mpiodole  icslsfs2urx o;t1apt ioetltls uaumonu)tetrir3iy1fp rli o;t0teurxmpou1amt  ivi (  rum(m ;u0tpxoioetydfaDulnvs (0 ltnir iytomDe ivols)tetmir iudom emnei s)sDrmx p;t0oeeoii3ilslmDrmuvo t)trxrifcty1faD  uei;(0 2xrxopnodol eliesat aruaurpoo0apeomocilt a2umnvs ()teenir oadfatrlueo;(0 ruoxrpoydol nlieil()a2uaxrpoo4tlen feiltfm2umuvs;(0arxnmocto1faDrlivo s0s2umio oy4lltn ivil( a2rru p;u0oex iieias m2el(vp;(0tltoxr to1faDeln i t0 2xrimpnydamt lfvi s)sDurumoou4alx  feiasfaDumnvpnt)tlermo todom r n s;s)s2ur(opoo4am nmictas  rrmurooo4aptomi3iadlmDemnmonu0 ltomrcto1lmtelu ils t2xoxm ny4lpt  feia(farrr(m ot0opeo ieiadfsDrm( s;(0areoxr oytlatrlueilt0setoxm3oudomt  fciasfsrrmumo;t4aetnmieiys aDul( o;()tleoxo totfmDelivil() eumxo io4ale lnviasfsrrm(mpno0tpxoifctyt m eluvs;() rxnir oy1lm   i ols  exrirpiu4ap   nvtat a2tru o;o4aptn fciadfm rluvo;t4 lxrxf oy1fm  an i t0 exmim oudoltelnesl() rrrur ot1alenmieilsls2emu s;t0 rermrcta1om e ivols)s2um(o3iy1amtnlfciasfa2ta(  nu4oetn f3iytla2rm(vo ()trtrxo3oatfpD li o;s0 euoir ny4op   ieslt)aDur(  nu4optn oetatlm ua(vp;(0 etrxf oodlmte nes t t2to(rpnu4lmtelivt () 2ua(  ;o4ole moetltfs2emu o (4tlxnxfctotfmDeaivi;t)t2urxopnu1ol nlfvil() Dtau  oo1tlt ioeilslm2raumo;u0arxrxo iy1om rlnvs;s0s2toir no4lpee fet ( aDtmxro;u0aexn i3tld s uaumpn(4teeoif3oodfmt lieo;s0texriopiudamt mncsls)a2umur ot4tptnioetlt aDelnvo;()altnmfcoodlateanvo;(0texoirpiudomt lfcs tfaDrrurpoo1aeenmfciyt m eau s (0trtnxr3tatfptrai slt0teur(opou1om n ieias)s2rm(mono4apxo o3iytlaDemuvon(4altrmo iodfpD  i o;() 2umxm3oodome mieilt a2umurpoo4tptnmoeiysfaDra(vp t4trxnmfctadfpt anvo (  2umxmpnudape lfci ( s2um( o;t1aleniictyd a rl( ont4 renmrctotfmteai sl(0sexmiopou1ole mict sf Drrx  ;t0ale io3ilsfa2rm(mo t4arenmrciadom elivs;(0s2urxrpio4omtnlfci s) rrmxrp;o4optomoetys m ulums t)tleoir3oo1op r uvi;s sexoim3nydamtnmfcs t)artr(ro;u1olxo fciytfmDemn p (4altomfcoa1fp elueols0 rtoxm3iu1llenmnctltfaDrrum ;u4aexniieiatlaDrl( sn(4teermf oo1fpteaieo;t)tetoir iydaleemfet (fsDurxrp;t1tlxnif3tlt aDrlumsnt) lerxf oydlpD  ivils  2ur(r iy1aptnlfvt t  2ra(r ot4oexn fciyt a rl(vs u4 rerxr3io1oa  livsls)t2trxo3ny4lmte nesl(  Durum no4tet  iciydlm ean pn(0texnxrctatlp rlneslt0s2to(r3nu1lme  ncs s  Dum(  ;t1tltn f3tytls ulnmp;u)teeomr io1lpDe u sl()seuoirpiy1apeelncilt arur(  ou0tltomicildfs rm(vs u)trxomfciatlptr nes;t sruoimpoudap nmfcil()s2umumpnt1tee  ictas a el(mp;t4tetoxo3ty1latr nei t t2trxo ou1olee nvs (f Drmxroot4tptnmieiyt sDrmumo (4artriocoodlmteaivo (0texr(rpiydll e ieils  Dum( p;u0tpto fciltls2rmn o u4 ltoifcoadoatelueol( sexmio oo1ole  feils) Drru poo0texn f3tltlm emuvsnt)tetrirctydfm elneo (0 2toxopoo4amtemfvia(fsrur(rpot1apxomf3taslaDulu o t)arxoxo oodop r u ol()t2ur(opno4ameelfcilt)sDumu  ot4aeen iciadfs ulums t)tetrmr3io1fatrauvs () rumir3oy1apen nesl(farrr( pnt4tleomo3ilslmDrmump (0aetoxo3ty1lpteluvs;t teto(mpoo4al n nvi ()a2taxmono4texo f3ild a2eauvpn() rtoircty1omtrauvs (0tetr(o3iydal  lfvtlt  rrru ono1aleniicils a2rln p t4arermo iytfmDean s s0srtm(opio1amenlfvs s) 2umurp;t1aptomfctas s2elu p;(0 ltoif3iotfpt  nei;( srtm(opio4amenlfcs sfarrrx poo0alx  fctlsfa umnvonu0aexrif3tytop ran o t0s2xrio iy4lp   iciat)artmx onu0opx ifciysla umnvs t4 eeoxr3to1oa   ieo s sexoxo iu1ap elicsatfsrra( ooo4aleomfetydfa ran snu) etnmo3oo1fm r ivol( t2trxr nu4omtelneslt sDta(rpoo1alxnmfctytlmDrauvo;()tetoxo3ootfmt  ies t0 rtoir oy1alenmfvilsfartm(rp;t4aexn oetatla ul(ms (0 lxniociodlm elnvo (0t2xr(o oy4om emnei t  2tax  ;u4aeeo o3iatfm rmnmpn() ltnmr3tydfat ln s;s srtr(rpnodome  ivi t)aDrru o;u4tex mfciys m2rl(ms;(4artrmf3tatlpDrauei s  2trio3iydalee fvi t) rtrxmp;o1tpe mo3ilsfs2ulu onu)aexnif tadfpDeaneo;s t2xrxr oy4ope lfcil(fs2urxmpoo4tltniociys a2ea(vo t0 etrxocoydfpteli olt trum(r iy4openlivsls)arrmxm oo4opto feiltfsDumn p t)texniocoo1oa raivi (0 exr(m iy1ap nmiciasfs2urxronu1oeen ieiyt a2umnmo (0aetoirciotoa rlueo t0 exoir nudome lics (f Dtrxm ;o0tptn feiydlm2emu s;u4tetoircootfmD ln o s0t2xoirpiy4ll   ieilsfartaumpou0alx  fctasfsDrl(vpnu)alxrmr io1fa  anvslt t2tmio nodolenmnci t)arrr(  ;o1texn i3taslmDuan onu0aetrmfcoydfm rlnvs s)teuo(m3oodop e ivs s) rrmxr ot1oeenmoctatfs2elnvo;u) rxoxr3oadlatean o;s  rto(o no1lm  livt ()sDrr(root4aleo fctatls rlumpn(0 rtomo3ootoatelieil(0s2xoxrpny1am e fetlt aDrr(r ;o1alxniieiasfaDulumo ()tetnxf tydomtrlies s s2ur(m ou1lmt miet sfsruaxmpot0opxomiciytfa2rl( snu0tleoirctodopt livi;()trur(m3iy4altnlneil(f 2rmxmpno0oexn oetas mDrmnvp;(4treoxr3tytfm rli ols0texmimpnudope mics tf rrrum ;t0openmietld aDuau snt4 lenio3to1fm  livil(0 2xo(m3oo4alenlfvslsfsrum(rpot0olxnmi3tlsfm2rlnvpnu) eenircty1latr nvi;() ruoio3iu4oltn fcta(  2uaumpou4opeomfeilsfsDumnvs;(4aeerxfctatfm  livs s t2trxopnodom elici s arrru  ou0apt  oeiasfsDraumpnt)alenxoctytlp ranvo ( srxrxopnodameemfcsls  rtax pot0tet moctytlm2eauvs;(4trtoxr oytlp   neo;(0t2tm(opnu1omtemnesa(  Dra(rpnt1apt io3ilslaDelnvpnt0trtnmr3oodom   u ilt) etrxm3nudlp   fcil() Dururpnu1alxnmocild sDuaumo;()teerirciatlaDe uvils)tetoiopou4ll   ivt s  2umxr no0ole ifctldla2em(vont0altrirciytlm  anvs s  rxrio oo1omt mnvs (f rumumo;t4altn ocilt m umums;(4aeenioctatlptrlueols0 exm(r3iy1opt  fvia() Drmuroot0oltn o3tytlm2elu pnt) rxoif3oadfa   neols)s2ur(m3iudlleemivtls s2taur ot4tlxoiociyt m um(vo;(0 eenifciotla   nvs;(0t2toxmpnu4olenlfviltfsDuax pot4tetomfciad s2uluvs u0tlxnxocio1laDe ies;( truo(m3nydaptn fvt s  rua(m ;u1olt if3iasfs2uan sn(4tlenio3tytfp ranei t)t2toxmpiu4ape lfciat  Durx  nu0oeen ieiasfa elu p;u)areomoctydlate ieo (  rxrxo3oy1op n feta(fs2ururono4apeo f3tas sDrmu pnt0 lxomr ta1f
\ No newline at end of file
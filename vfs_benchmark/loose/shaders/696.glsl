@@ -0,0 +1 @@
+n slt0srxmirpnodopt lictls  Dtmurpou4tet  iciad s ra(vo;t4trtnxocoadlm rai o t)s2uoim3ny4aptnmfvs ()aDrmuroou4olxo ietyd s uan pnt) reoif tatlmt ln s;t sexm(r3oudolenmnei sf 2uru oot4tleo o3taslmDrmnmsn(4 lxoiociydfmte uei;t  2xoim oudal  mfvt t)aDrmxm ou1olto fctlt mDemn o t4aexrmo3oo1lmDraueo s setr(o oudlle mnciat) Dua( ont1tleoii3iasfsDrl( s u4tltnio3oydlm  aivol( trxoxr nu4om  lict () Drr(m ;o0tpxnifcias aDemn o;u4 lxnxoctatop  ln o;t0texrio3oydol  lnctasfs2rau  ;t1aptnmo3ild mDea(vs ()artomr3iodoatr ueils)texr(o3oodlmeemiesatfaDtmu poo0olxnmoeilt a rln s u0 ltnio3todlpDe uei s) eumio3nodamte fesatfsruax p;t4apenmfcildls2ua( o;u4arerio iadoaDran il(0 eto(o3ou1al nlfcias sDrrx o;t0alt ii3iltfaDranvs t0 exnxf3ia1laD  nes s)srurimpiy1lm emncs sfaDrau  nt0aexomieiysfsDemu p u) ltnxrcia1oate ies t0t2xoirpiy4optnmneslt)a2umuroou4olxomfeiatfmDrln p (4tltrir todfpte ieilt) rumxm nodlpt  iciasf Dua(rp;u0alx mieildla2el(mo u4aetnmf3iadom   n s t)trtmimpiydomt lfeilt) rtmu o;t0olxnmi3iatfm rlu ont)tetoxr3ootfpt  nvs s0t2xo(opoudolte nci ()srtmu ono4texnifeiadfm um(vonu4areoifctytfpt lnei;s0s2trirpiudop elnviltfaruaxroot4aeeomoetls m2elumo;()aexrxoctydfmDe ieilt0 exo(m3iydapte ivt s s2rr(m ;o4ope  icils s2emn p;t)alermr3tytlmtraivol( trumxm io1lpteliesltfs2uaump;u1apxo iciyt aDumn sn(0aeeoio3oadoaDeai i;t) euo(m3nodom e icilt sDuaxmpou4tpxoiictydfs emnvp t4texoxrcty1fpt lnes;t0s2ur(o nudameemietls)a2ua(monu1olenmictyt a emu p ()tltnmr3totlaD  nvo t0 exm(o iy1lp nlnvt (  rtru p;t0aex  feiyt s2ul( p (0 reoxf iatfptelueilt)t2xmio3oo4lm emfcils)aDuau  no0olxo fetlt sDrluvp;t)tleomocoo1lm r n o;()t2xrim iy4al elnei t srtmur ;o1aetniocilt m rmuvs;() etnirctydfmDr ivsls0 rur(o ou4ol  lnci ()aDumxrooo4tlenmociatls uauvsn()tlxnmo3oydfatr ivi;s0trtmirpny4op elnei (f 2urump;o4tltnmieiydfm2em(mo;t0tetnxociotfm eau o;t0s2urio ny1lpt mics (f 2ur( p;o1alxn fcildlm rm(vp ()trtomocoadfaDraivils0 2ur(m3oudlmenlietatfa2ur( oot0ope miciytlaDulumsn(0 rerxr3oytlpDe nei ()texoimpno1ol  mfvsl()arrmuroot4aptnif3tydls2um( onu0 lxomo tadfm eluvo t)trurio3nodllt lnvta() 2tmxmpot1oexniieildfa rlnvs;u)arenirctotlpD  u s;t0sruo(r oudaltnlietl(faDtrxmono0optoioetls mDranvp (0 rtnxrctadoaDe ivols) 2umiopiudlptn iesl()sDrr( o;u0tetniieiyd mDrauvp t0 etoif ty1lp  li ols)s2xoxr3nu1ol nlfesas) Dtm(rpoo4tltnmieildfa2rl( pnt)tlxoxrcoy1latrauei t sruoiopoy1omt lfet s  2uaum ;o4tetniieiyt a2elnvs;u) eerxo3iotom rauvs;t)texoiopio1lmtemfcsls)arrr(m nt1olt  ociat mDrm( p u4trtomrcoy1fa r u o;t srxmio3oy1aleelnvilt)arurxrp;o4texnmfciatlm eauvp;u)teenmo3iydlptrai ol(0sexo(m3iodoptn neias srrrxmpot0opxn ietls m2em( pnu0teeoir3tydlaD au o t texm(o nydomeemncias)arurxmo;u4tet mf3tlsfmDum(vo;t)alxnircty1faDelu i s s2triopoudop   fcs s s2rr(m oo4tlenifciyt m2rmumont4 ltrxf3todomD  n i;t srtrio3io4amtemictasf Durumoou4tpxnmiciat mDul( o t4arxrxr3iadfpDranvi;t)s2xoxr3oodamee ietl()srur(rono0tltnio3iad mDrmuvsnt)altrio3tatlmD lues t trtr(o3oodoleelictl(faDur( poo0optniictytfsDrlu o (4 rtoxf3iadfpt luvilt)t2xmiopiudam nlnvta(  Dum( ono1oexnmocilsfsDumnvs (4trtoxr3todfmDe ueslt s2xoxm3oo4ame  fcilsf Dra(r nu1aeeomociasla ulnmpnt4arerxo3oo1lpDranvolt0seurxo3iu1omt lfet t)a2ra( ont0tpt iietatfa2uan sn(4alxrmrciadfa rlu i;t  euoxo ou4ol e ncia(f 2rm(rpnu4oee ifeiadls rl( ont4 ltoxr oytfp   ieo t seurir3iydlm n nct ()srtrump;o4olt io3tysfs uau s u)teerxf3oadlmtraiesls0sexmim3oo1amee fvsatfarrrx p;t1opx mfeiysfmDra(vo;()trtoxr oytoatean i (  eurxo ou1omenlfcsas) 2rm(m ;u1optoio3tls m2rln o;t0altrxoctytfpD  n i t0srtoxm nudlltnlnet sf 2uaxrpnt1tle  i3tat mDua(vo t4texrircta1faDrlnes;t0 ruoiopoy4am  mietlsfsrrr(monu1tptomf3ils m ranvo t4 lxoir3totomDe nvo s  etoir iodlpe micsasfsrrm( p;o1aexn octlsfm2eauvs;u0teerifciadom elnvolt0trtr(mpny1omtnmieil( aDtrxrp;t1apt mo3tyd mDrlnvo (4 lxrxrctodop  lnvo t  2tmxo3no4omtelfcta(  ruaxm ou1tpxnioeiasfs el( p t) rtrxr oa1lpDean olt texmirpiudlltn feiatfs2trxmo;o4texnmieias s2rlnvs;u0tetrxocia1lm rlieo t)setmir nu1amte nesa()sDraxr nu4tpeo ieiat s em(ms;(4 eenxr3tadlmDraivsl()setoiopiu1olen fvt ()artmx o;o4tlxn ictydfmDranmp;(4alxrxfcoodfat  ivil(0t2trxm3nu1alee icslt  2rmxrp;o0oetoif3iasls umnmsnt)teeoxo iy1opte iesl(  eurio io1ol elietas)sDrmu o;t4tee iieiat mDelnvo t)arermrcty1fat ai sls  rtoiopoy1lp elieiat srtr( oou1oltnmfetldlm rl( o;t4 rxnxr oodoaDe ues () ruoir3oy4ll  mivsas) Dumuro;t4oexnmfctlslmDuluvo (4 rxoxr todfmtrlivs s0srto(o3oodal  lnvslsfsrtm(mp;t1aptoifeiat a emnvpn(4 reoif oo1lpDrauei;t0 exo(rpny4apt micsls) 2umum oo1aptn oeiasfa2uluvont)texnifcoy1oa rln s;() 2trio3oo1ape mnvilt sDuru  nt1optnmoetatfs2ra(mo u) exrir3io1fpDe ueo (0teuoxo3oodap  livt s s2raum ot4opxnioetltfaDeanms u4tlxomfcoytomtran i;t texo(o ou1omt mfeilsf Duax pno4olx ifeiydfm um( pn()artnmocoadfmDrauei t0trtoxo io4amenlivslt srraumooo0aetniieiltls2ea( onu)teenxf3iotfaD  n ols0 2tmxr3ny4optelnes t)srurx  ;o0tetomictlsfm rmn s t)trenmr3oatlptelivs;t) eumxmpiodll e icias aDtm(mpoo4oee  icildfaDuan sn(4tetnmfcia1oateanes;t0 eto(r3iu4am n fetl(  Dtr(rono0alxn iciltls um( s;t4 rerxfcoodfaD aneo t0sexoxm iydop   ivtls)aDrmum nt0tlxoiicildfm2rl(ms u0aetomr iydlaDrlueslt)seum(opnydomenlfesat) rurxrpoo1opxnmoetysla2ul( o;t) exnmr3io1omDeaivo;t seurim3ou4am  lfvtltfa2umxmoot4oetomo3tasfmDum(vs;u)tetnxo tydfm   u i;t) etmim3iodlp   neiltfsDtr(  nt4aex moeiat aDeau sn()aetnxr ta1fa rauei;s0trtm(rpiudoptnmfeta(f Drrx pot0tlxnmocilsfm2ulu o;t0artnxf tatlm eauvil( trtrxo3oo1lpe  fcsat)aDrmx pot1ole  ociyd a2eanmsnu4aeerxo oodfp   n o;t seuo(o iu1lpe lncias)sDtaur nu4aetoio3iyd s2ra(vp;(4teenifcoytfpDrlieil(0t2trir3iu1om emivs t)aDtau p;o0olxo o3iatls ran p (4altrmo io1lm  aiei;s0trtrxopiudalen nvs ()artm( ooo0tee ioeiasfm2ranmsn() etoxociytop   nvs;s0srxoiopoy1ome lfviat sDraum ;t4tpe mo3ias m em(ms;t)tlxoio3oa1lmtelneols)sexmiopnu1am elfvs s)a2uau oou4opt if3tas aDem(vsn(4tltnifciatfa eai s;s srxm(rpny1ame lfet ( sDtrurp;u4tltnifciatlmDranvsnt)alerxf3oatfmD  uvsl()t2xoxopou1lle  feiat sDra( onu4olenmo3iatlm ranvp t0 eenxfciydlpD au olt)trtrio3iy1apte netat sruaurp;u1open ociatfm elu pn(4 eeomr iatfa eanei;t  rxo(o nodapte net sfaDrax  nt1tpx ifciyt s2emump u4 rermrciotomDr iesls)sruoiopoo1oleelici tf 2uau  ;u4tetniieiad s emnms;t0areomr3oo1fmt  nvi;(  2xmxm3oy1olee nci sfartau ono0tlenifetldfsDel(vp t)trtnxr iodoaD  n ols) 2trxm oudomt mncs s s2ta( pot1ope  fciad a uanms (0 eerifcoodfat aneo;t)trxo(rpnu1llenmicsatfsrtau pno1apeo f3iadfmDrm(vp;(0arxoxf iotfaDrau i t sruoxr nu4al   fvtl( aruax o;o0alx mo3tltfaDemu s;t)teenxociotlpDeaivi;(  ruoxo3oo4amtemfesl( srumxrono1olx ii3ilsls ranmpn(4 eeoio3iadfmDeai ol( srtr(m nu1lm elfcsltf Draxr nu0alxoif3tltfaDemnvo;u4tetnmf oodlmt  ivi s trumimpou1om nlneta()arrmxro;t1tleo ictytlm rl( ont4 exnif tydfpD aies (  etm(r3iu4ap elfet tfs2ta(mpou4opt miciltfa2ea(msnt) rxoxfcoy1laD ai s;(  2xo(o3oudopt lnvilt aDtmx o;t1ope mocias s2emnvo t)areomo ootfaDelivi (  etrxmpnu4al nmicsls)srtrxrp;t4alx ii3iadla2eln s u)tetnxrcoadfa rli sl(0seuriopiy1al elfvi ( arum( pno0olen o3iadfsDrm( on()texnifcoa1omtr nvo s) exrim3ny1lleelfes t) rraur ;t4altoifeiyslaDum( s u0trtnxoctydfmteln il(0sexr(m nu4op  mneiat s2umu pou4oeen f3iatla ra(vpn()aetniocto1om rlneo;t)s2xr(m3oo1alee ivi sf ruru  ;u4apto feilt s2uaumon(4arxrio tydoa  luvo s0 euoxr oydamtnlnvtat a2rmumo;t1aleomieiat m umuvp u0 eenircoo1lpDrln s;t0sexrio nu1lm e neilt a2rmx ooo0opxo i3tlsfaDumnvo;u0alxomr oa1om r uvo;t) rtoimpoo1ap e fvs sfarur( o;u1opeoii3iyd aDrlumo ()artnmo iodfpteli o;(0 etrir iu1ame  fvi (fs2trxmo;t0oltnmicild aDumnvo;u4 lxrircta1oaD  iei t)trum(r no1alt lncil( a2umxrpnt4alt moctydlmDrlnvsnt0tlxnxo todfmD  ueo s0srur(m3nodlmte fctl(f rtruro;t1apeoiietltfs2el( s;(0artoio oo1faDraivo;s) rtrxopou1ap emicsasfs2rrx ont0tlt mfetas s2umu pnt0aleoxf3iydlmt  n s s  2xm(rpiy1ale  nes s aDrmx o;t1opeomociyd sDuauvo;u0 lxrif3tytfptr nes s0s2tm(m iu1omenmivta( a2rm(r no1oleo ietyt sDrlnmp (0 lxoxoctytfpD aues ( t2umiopoo4amt mivs s)s2rmur nu0opeo o3iltla2ea(vonu4 rxrmo3tadfm eli o ( srurir3oydolee fvsl(f 2rruro;t1alen ictyt aDrln o (4 exnxo oadoa elu ol()srtmxm3oy1ol nlivsas)s2raxm oo0tetomoeiadls2um( s u4tlxnxrciadomDeaneo;s0srum(m3nodoptnlnei ()s2rrxmp;o1alxomoeilsfmDelnmsn()aeermr oydfp eaueo;t srxriopoydop n ici () rtrx o;t0teto fcilsfm2em( pnu0altnif tadlaDe ivo;s  rumxo3iodop  mneil()srta(rono0oexo oetys s2umu sn(0teeoir3oodfa elnvi;( seur(o3oy4optelfvsatf rtm(rooo1oet mf3iys a el( pn(0aexrir3oy1lmD liei;(0srtrir nodol n fetas aDtau  oo4tpx  fctad mDrmuvp ()tetrxrctatlm e ies (0 2to(opnodal  mnvi tfsrrrxronu1ale  i3iyslsDuaums (4aetrif3ty1oate uvo;( trxmim3oydap n nvslt) rumu  ;o1aet mf3tyt s emu on()areomr oytlpDrauvi;(0teuo(m3iudll emivslt) 2rmu ono4oet  fciydfmDum(vp (0trtoircootoa r ues ()s2xmio3nu1olenmnctls) Dtmumoou4aeeo ictad s ea(ms t0 rxnmrctotlm  aivsl( seurxr3iydal nmfeta(f rtaxmo;o4oltnmi3iytfa2rmuvo;(4 leoif to1oaDraivils)s2urxo oydom nlfvs sf 2uaxroot4aexomo3iatla2ua( s t4 exnxr iytfmtrln i;t) rum(mpiu4olee ietas s2uru  ;o4tpe ii3iadlmDeanvp;u4alerxr oatoa rlivs t)t2urxopoy4opeelfvta(fa2uaxmp;o0altn i3iasfm eanvonu) lxnxf iy1fpteauvs;t0 exmxrpiu4optn fcsasf Dtaurpnt4tpxo f3tlslmDem(mo;()aetrmr io1fm raivo ( srtoio3oy1lmenmivs ()a2rrxrp;t4tle  o3iasfa2elnvs t0 lxoir ia1fmt an i s  2tmir iodole miesas  2ua(mono1oeenmictatlaDrm(vont0aleomocoo1om e uvs (0 2xmxrpoudlptelncia() rrmx pot0apeoii3iasfs2emu o t4 etrxrcoo1lmtrlivsl( setriopiudlme livtl( aDta(root0tlxnmoetyslmDra(vonu0tlermr3oatomD ln slt0 eurxr3iu1amtelivs tfa2um(rooo4tpeomf3iytfsDumu p t)arxoir oadlaDrlivo;s0srum(r iodll   ict s)sDurur nt4optomociatls eln pn(4artnifciadoate ieol( tetr(r ou4amt mict (  2raum ou0openiieiytfsDrm(vp (0 exnxocoydfm  liei t) ruoio3iudam nlnctl()srraurpnu1apeomfetld m2eanvsnu4artrmo3todfpD  ivs s0 2trimpoudolte ivi ( srumxmonu1tltn fctldla2elu pnt)tlerioctodoat  ueil()s2umxmpno4lmee iviat) 2taxmpou0oltn oeiat sDrl( s u0 etrir3oodfa rauvi ( trxoio nodlpe mfcsl()aDuaxmpnt1apen f3ilslmDua(vo;u0arerio3oytoaDrlnes;s)seum(mpnudalen fcsl( arurxroot4tet  ieiys aDrm(mon(4 lenmf tydoptrli o;s) eum(opnudomeelnes s)srraur nu0tlt ioeiydfa umnvpnu0trxomo io1lat luvol()srtrir3nu4opt  fvslt s2rrx  nt1tpe if3iat aDuanmo;() ltnmoctytlat  n i;t0setoxmpiodomt mnetas arurxro;u0tlt  f3tat m emn s;u)tlxrmfcoydoate nvil(  etoir3io1lp emicsl()s2tm(rono4aet  feiltfm ua( p ()arxnmfcoydlm ran ils0s2xo(o ou1op   iet t)s2tr( oou1aex ifctlslm uanms;(0 rtnio3ty1fp eaiei;t) 2ur(m ny4alt lnvt ( a2tmxm oo4oex if3ilsfs ul(ms;(0treoxfcty1lat li o t)sexmxo3nodlpenmfeil(f rua( o;u1tpt io3tatlsDumn s;u)aleomfcootla  li o ()s2urim iodal nlnvsls)aDraurooo4oexn fcild sDumnvs (0artomocto1lmDeaieo ()trur(m oodalee ncilt)arururp;t1aetnmoctys m rmu p u4altrxf3oodomt lu olt0tetrxopoodlm e fcsls  2ur(m oo0alx  fetysfa elu pn(0trxrxr ootlaDrli s;t0srtr(rpnu1amt lictasf 2ra(  nu1alxomoetlsfmDrl(ms ()trenxf io1lmD liei;t0setmxr3nu4altnlneils)sDrmur ;o1apeoiieildfs ranmo u0teerif3oodlaD lneol()t2xo(r iudlltelncs sf 2rmum ;t0oeenmi3iltfs2rluvo u0 rerir3io1fpD anes s0t2xm(rpoudal  mivi (  2taum oo0opxoioetas m umuvp (4trtnio3iotlmDrlneo t0 rxmir3iudam nmnvt (farrrxmono0apt  fciad m em(ms;u4 rxnio oy1la elivi ()s2to(r3nudlmtnmnciatf 2taurpnu1olto ocilt a2rm( o u0aeenxrcty1lmD liesl( srxrimpnydomeelfcil(f 2um( pot0aleo fctytlaDrmumonu0artomocoytopDraues t setr(o oo4am  lnctlsf rumum nu1alenii3ilt s rmuvs (0aetrxr ty1op rau o;s)texo(o3oodole lfei t  2rax ooo1tlxomoeiydfm em(mpnu0 rxomr3iy1opDe i il() rxoxm oydlpen fct s  rtmum no1tlxniiciltfa um( o (0treriocio1oaDranvs;()srxo(o3nu1omtemfcsl()aDtaumpnu0tpxo oetltfs eln p;()artnif ta1fmt anvs;()seum(m3iodllt lfei t)sDta(  ;o0tee  fetlsfs rmu o (4tleoiociadoatrln slt trxoim ny4openlivtatfaDrauronu0alxo icias mDul(mo;()trenio tadfp   u sl() rum(opiydal   nvsls) Dumxmpno0aex iieilt aDum( sn(0 etoxrcia1la elneil(0t2urxr iy1optn nvtat)aDrm( pnu1oexomiciytfaDulu o t)texnxo iytomt aivi;(0 exoirpnudop emfcils s2ra( p;o0olx mfcildfm2ulumo;t)tlenmr3iodfmD  uesls0sexmimpnydapt lnvtl(faDtaxmp;o1alxnmi3iad m ul(mo t4aexnmrctydfmt ln i t srxmxopio4optn netas  2uauro;u0tptn f3tldfs elumpnt4 eeriocoydom rlu ol( trxm(o oudopenlivs ( s2umxmpnu1aetnmieils m eanvsnt0aetrxf oodlm r uvo;(0t2um(o3no1al  mnci s aDrr(m ;t4tpenifeiyt s2rl(ms;t) rxrxr ootlm rai i;s sexr(m iy4lm  mnctas arra(m oo4tetnmf3ild sDrm(vs;()artnifciydlate ies;t0tetoimpnydom elnvs tf Dumu  nu1tpe  i3ilt sDumn snt0trtrxrcta1optelnvs;s0 exmim ou1llt lictl() 2uru p;o4aetn icildla el( p;(4aeermr tadlmD  n il(  rum(r nodllee fct sfsrur( ono0openii3iltfm emumo;t)arxomrcoodopDeaieils0trtoxm oydape  ictat arurx o;t0oltnii3ias s2rm( pnt4trtnmf tytlmD  nvilt) 2xr(rpiudll elivsl(fsDuaxr no4optnioeiaslsDul(mp;u4aleoxfctytlmteauesls0tetrio3ny4ll e ncslsf Dtmum oo0oltn fciydlm2rm( p t4 eeoifctytfm e ueo;s)t2umim3oy1open icsl() rra(mooo4aeeoio3tyd aDranmo;(0texomf iadoaD auvsls) ruoxopny4op nlfvtlsfs2tm(mpno4tlxoifetys aDul( pnt0alxnxfcoatomt  neilt  rtr(o3no4ll nmivsls sruaxmpot4aex mf3tydls em(mpn(0texrif todlp eaivo;s0srxmiopiu4opt liet (fsDtrxm no1tltniieilsfsDul( ont0tlxnifcoydlatr ivs;s seumimpoydomen nciasfsruaumooo0tpx if3iltlm2ul(mo;u4tetnmocto1laDeaivil(0seuoxmpno1lleeliei tfaDumu  ;o0oet if3iydfs2ea( p u) exomf tydlm ranes t trtriopnu1altemfvsl(fa2rrxrpnt1aex ioctldfm rl(vo t0arxnmf3todoate uvslt)seurimpnydop nmfcsl( srumu  ou1altniociadlmDrlu ont4aexoxo iatlmDrluvilt0 rtoxr ou4lme mfcslsfs2rm(  oo4opx mictls m2ranmp t4texoifciydlmD anvo;s)texmxm iu1llte ivtatf rrm(r ;o1aetnmociatfs el(vo;(4tltoxo3ta1lpD anvs t)t2ur(m3io1amtn nes (fs2ra(m ;o4optomi3iysls umuvon()tlermocty1fat ln o;t srtmim3iydamt lfciltfaDrm(  nu0apx miciad s uauvs u)arxrio oadopDeaivils)sexrxo3oy1ol elnesa(  2ua(ro;t1optnmieiadlm2ranvs;u4alxrir3ta1lmD ln ilt s2uoim3nodapee ictas  rumu  nu1aleoifcilsfaDemums;u4aetnmf3iodlmteauvolt) etoxrpio1lpenlfetls  Dumxr nu0tle ii3tldfaDul( on(0altnir oydoptr iei (0s2urxm3iodal emfvtas)s2rru  ou1ape miciyd a ulump;u0 etnio3iodlp rluvs t sexo(m3io1apen fctl()s2rrxr nu4oeeoif3ildla rlnmo u) rxnircoadlaDeln sls0 etoxrpiy4lptelivsls)aDuaumont0apxomietldfa emumonu0texoio tytlp r uvi;s)t2trim iydal nmictas)aruax p;u1alxo ictytfs2ul(mp;(4altoxo iotoptrlnvi;s)setrim nu4alee ivtas artaum no4tlx ii3ildlsDulnvs t)aleoxo ty1omD lueol( t2toirpno1om   icils)a2rmu pnu4apxoif3iad s uanms (4aeenxrcoa1la   ivils)s2umir oy4apte ivtatfaDtaurooo1ole iociat s ranms;u0 rxoxfciadfa rluvslt) 2uoim3oo4lme miet t) 2tr(rono4olt  feildla ua( o;t)arxoxr oytoaDeau o t s2xoxopiodale  nvt ( a2ur(  no0texoio3taslaDrauvon(4trtoif totfa   i s;s0truriopio1ole lfcs ()arrr(m no1tlxomf3tatfa em(mp;t0 rtnmf oo1oa  aneols) rtr(m iodole  ivi (f 2tmur ot1tpeomociltfm el(vp (0 lxrmr3tatlmDrluvi;s0teumxr iydlp n ncs s)arrmx pnu4tpt  oetlsfs2emnvo;(4altrmf3oodoa rluvs s) 2ur(m3io4llt lfvtat) 2umuro;t1altomocias m2ran o;t4 eerxfctydlaD  i sl(0srum(m3iudameelfvtl(f rrau poo1aptn f3tlt mDumump;u0alxnif3io1fmDr neo;s t2uoxr oudom  lieslsf rrmumpnt1alxomoeiysls2elu o (0 eenmo iytfm r nvo t  etmimpiu1aleemnct sfs2tm(m ;o1tpe  fciltls2rau pn(4altnmociadlm   neols0trxoxo ou1lmt lietlt) ruaur ;u1olx ii3iadlmDrl(vo;u)tetnio3iadla r uvo;s srxoir3nudape  fetlsfsruaxrono0tpxomfeiysfaDel(vpnu0 etoxf3ootfpD aueil(0texo(o3nodam e icilsfsrraum nu0tpxoifeiydlsDul( p u4texnxrcoy1lm raieilt0texo(opno1olte nvias)aDtaum no0aeto octlsfa2ul(vp;t)aexnir oy1fmtr uvsls)setoio3ny1ll emfes (fsrur(  ;t1oee mf3ild s2rm( o;(4trxrif3oytfaD anvo (0 exo(o nudame  fvtasfa2um(r ;u4aetomfciysls2elnvs;u)tltnirciy1laDeaieo;t0texrxm oo4am nmies sfs2tm(rpnt1oleo ieiadlaDelu s ()aleniociytfm e nvi t  rtmxopoodlme  fei tf Drrum nu4opxnmfetytfm2ua( s u)arxnxf3iy1fmteai s;t0 rurxr3iy1alte ivilt arrmu pou0opeomf3tltfa elump t) renxo ta1laDrlnes t)trtrxr iu1ame  fvt sfsDua(r oo1tpxoioetadfsDumnvpnt0teenmr3to1late i i s t2toim3nydlptemiet ()a2ta(mont4oet  i3iyslaDrmnmon(0trtoif tadoa  aues;t0teum(o oodlpt  fvtls)a2rax o;o1tptnmi3iasfaDul( o;t4tltoxfciodoa r ueolt) eurir iodolt lfctasf rrruro;u1tetnii3tys a uan s;(0 exnio oadfpt ai i;t trtm(o no4aptnlivtlt  2rru poo0alen fciysla2eaump;t4tleoxr oydlpDean s (0t2toxr ou4ol emfei sfs2tauroot0ale  f3iasfaDeanvo;u4arxoio3iytlm e u ils)trxrxopoo1lptnmfvi s s2um( o;t0opx  i3ildla2rl(vo;(0altomo3iotomte u olt t2trxr3nu1olen iviltfaDtr( p;u0aetn fciltlaDran snu) eeoxf io1oaDeauvo s0 rtoxr no4oltemnetatf Dtru  no1tptoioeias m rmuvsnu4altrxr3oodop rau ils sexmxr nodaltnlfetlsfaDua(m ;t1alx  fciyd a2uanvpn(4aexnxo oo1fmD  neolt)sruoio oo1apte fctas  Dua(rono1olto f3tatfm2ea(msnt0teeoxociadfa rau i s0 2tr(r3ou4lleelfvias aDtmu oot0olenmi3ild aDem(mp () exoio tydfmt aiei;t t2tmxr iudlpte icsatfsrurum nu4tlxoioeiasfm uln pnu)altnxr io1oa  livs;t0setrxr nudlle mfeiat a2uau  ot0apeoif3iyslaDeaumo t4areomocoodfm raivils0 exmxr3nodap  mncias)aDumxr ;u0altomi3iyt a2umuvs t0tltoifciadlp rai i;s srxoim3ny1lmtnmfei () Dtau o;o1tex  fcias aDemnvsn() eermfciatfaD  u s;(0setoir nydape  fctl(f rumx p;u4olto oetasfaDeaums u4artomf to1lpDraivol(0s2toxm3io1ome  nvs t  Dtm(  ;o0texo ictasfa2uauvpn(4 rtomr3oa1op  aivs s0 rxm(o ou4lltnmivtlt aDuauronu1tpeomf3ildfs rlu o;u0aetrxfctydlatraivs t0trxmxo no1oltnmfcslt)aDur(rpno1olto octysfs2ulnmsnt4tltnxr3iadfa elivi t) 2xmimpnudoptn nvi s srtr(roou4tlxomo3ils a ranmp;t4altrxr3oy1lm eauvo;s0 etrxr iy1optnmfesas s2tmump;o0tlxn oeiadfa2ea(mo;t4 renmrcty1fpt auvs t0 2toxr io4al n net (  rtauroot0oeto i3iys mDulu snu4aetomo oy1lmDr ivo t trtrxr oudoleelictls) rta(mpnu4tlx ioctldfsDrauvsn(4tlxnxf3oadomDrln ols) rum(m oy4lpt lfciasf rtm( poo0tpxnmictas m2ulnmsn(4aexoif tytlaDr ues;( setoxo3nudol nmfci s arrrx  ou1tee ifctlt s rlumpnt4texrmocty1lm  lneo t0teur(r iu1lltelfvslt a2uaumpnu4apeniictat s2ul(mont)aexrir3iatfpt lnei s0s2xo(m3no1ol nlieils a2trxrpoo4opt mfciasfm ul(mp;(0 eeoio ty1omDean sls)s2uoxm3nu4opee nes s)srrmu p;t0olx mo3tadfm uanmon() leomf oatlm  anei;t t2toio oy1ll nmncta()aruaur ;t1oexomieiasfs2ulnmon(4 rtnmr iodoaDeauvo s) etoxmpou4op n ncs () 2rrxr nu0oexnifetlt sDrmnms;()arxoircoy1fat lu sl()seuo(m ny4lltemnctls a2rmum nu1oet ii3iadlsDra(vs;(0 eeomr3totom r u olt) rumirpio1ol nlfeta(farurxr ;t0tet iocilslm emnms;t4aetnxf3iotomteau ilt0 rtr(m3io4lleelivilt arur( p;o4texo f3iytlmDumnmp (4aleoxf iodom raneols) 2toxr oy4lpenlnvta( srraxrpou0aleo ictydfmDem(mpnt) rxnir3totlpteaneol(  2ur(mpoudlm emfvi sfsDur(rpnu1aeen f3iyslsDrm( onu4 exnio ootfpDeaivsl(0setrio3oodlm nmfcsa()s2taxrooo4oeenmicild mDel(mo;t4aetnircoodlp eli sls  2xoir3oudamtnmfvta( aDuaum ;t4tpe  iciytfsDrlumo u0texnio iytfa r neolt texrxm no1ap emivtlt s2ur(m ot4tpxomoeiyt m2raump;u) renmr todfpDeai ils  2umxopno1om  mnvsl()s2rmu o;u1tpenif3tat m el( s;t4 lxrifciotomte ieslt s2um(o3nu4lmt  netat)a2tmum no1alxo fetld s uanmsnt0 etoxf3io1lm eli olt0trxmxopnu1op nlicsltfsDtrx pnu0texnioeiadfmDelnvs;()texoircia1oatranei t0 rto(o3ny1omtnlivt (fsDrm( p;o0aet moetlsfaDranmo;u) etnmfcto1lpDrluvols)s2toxr no4am nmivi s) Dtmuro;t1ale moctydls2em(vs;u4altrxf to1fmDrlueol( s2xr(o3iydamen ncs sf rtm(m ;t0optn f3iydfa eluvp;(0arxnxf3iodfpDraivsls0teurxm3iu1al nlivilsf Drau  ou0apxn i3tytfmDum(vonu)aexomrctodfmDeau o;( sexmxm nydaptn fvsatf Duru pnt4oleniiciatlmDul( pn(4arxoir io1fmDe i olt seum(r nu4amtnmncil(f 2rrumpnt4olto ocilsls2uluvo u)trtrif3oa1opDeauvolt0 2xo(m ny4am elfcia(  rur(rpno1olxo ietat sDrl(vs;t4 reoir3iytfp e u sl(0texoxm3oy4lp nmiei t)aruaump;u0teeomfciasfs ua(vs;(4trenxrcta1faD auvi;(0 exoio3oy4al n fvsl()arrau  no0alenif3iatlmDuluvp;u4aeenxr3oydlate nes s0t2uo(r ou4lle mfet t sDur(mooo4tetnmfeiasfs2rm(vpn() lermoctatfm e uvs s0srxoio oo4lptemics t)srrr( o;t4tetomietatla um(vs (0trenirctydlm e ivs;() rto(r iy4lp emneia() rraxmooo0teenmf3tatla eaumon(4 lxomo3ootfmD auvi s  2um(o3nydopen fei t s2urxmpnu0aee  ictysfs2umums u)alxnmf3to1fptr n s (  2umxo oudopee iet ()a2urxro;o1apto oeildlmDel(vs t0treoioctodfatrlu i (  2um(mpoudlme  fvtas  2urumpno4tlxomfeiyslm el( o u0 rtrxf totfpteaivs s  rum(rpnudom n fetl() 2urumpnu4aet ioeiyt mDuanmp;(4tltoir3iatoateluei () 2um(m3oodole  ics t)aDrmu p;t4alxoio3iltlm2rmuvpnu)artoxrciy1la raivsls0 rxmxo oydolen fvtlt  Dum(mono4oetomiciasfs rln s () lerifcoadlp   ueils0 exoxm nudom nmivsat)sDtaxro;t4open o3iasfm ra(ms;(4 rxoxf to1fp eluei ()teur(o oo1lpt mnvt t)s2rrurp;o1apxomfciyd a ulnmont0teeomrcty1fmD an il() etr(r oy1lpe mfci t) ruru o;u0aet iieiys s2eluvsnu)trenxo ia1opDeaieslt s2uoiopnu1amen fcsl(  Dtrx  ou4optn f3tysls2um(mon(0 exoxo tytlpt au o t0 2xrirpiy1llt  nesasf 2ua(rp;o4oet ii3ils s emumpn(0 reomr oa1fp   nvs s)s2xo(r3oo1ol  mnvslt) rtrum ou0apt moeias a2ua(ms (0 exoioctadoa eanes;t  2to(mpou4ameemfes s  Draxm ot1ope if3tls m rmu ont)tleoxr3ia1fpDr nvs s0s2xrimpiodolte fcsa(f rrmumooo4oee moetytfaDul( s u0 rxnircoatoa  auvs t)t2trir iy1open fviasf 2rrx  ot1opeoioetas s2elnvo u0texnir oodfaD aneils teto(mpoodlltemivtat) Dtrxrp;u0tptn icils a2rlnvs;t0 lerif3tadlm  aieo t0teur(r nodlptnmnvtl(farrmxrp;o4tlto ociydfm2umu p u)altriocia1fpDeaneil(0 etr(mpnodale livsasfa2rm(mp;t1ape  feils mDuanmont) lxomo oatopDrlieo t0t2xoxrpiu4om   nci t)aruaurp;u1oltnifcild mDrm(vo;(0areoxr3tytlmteaiesls0trxrxm ou4omt  fvsatfsrururono1olx io3iysfm rmumo t0artnio3oydfpteanvo s) rxrio3oodolenmnvt s a2umxmooo1aeeoio3tytls uaums t0 lxrmociy1om elu ilt)srxoxopiydol   nvsls srtr( o;o0opxnmfciyslm uauvp () lenmr3tytopD  nvi;s t2toio nydomt mnesasfartm(mpou4alen feildfm2uau p;(4texrxfcootfaD lnvo;s0 2to(o nudalt mivia()a2urx poo0openmietas a2eau s t4artnio3tytlptelivsl(0t2toxopiu1ome lfesat artr( pnt1tpxn i3iys m rmnmp;(4alxomr3oy1lmt li i t)seuoxm3ou4oltn ietat) Dua(mpou1tltoif3ildfs eauvp;t0altriociodlm  ai s;s)srxrim nu1ole  fvs sfsrra(ront4tpeo feiltla2uau o;t0 rtrifcty1laDe neol() 2xo(o3nu4openlfvslt)s2truroot0oexniieiatlsDra( s () rxrmf3ty1lm e u ols0teuo(mpoy4llenmfes (f rta(r no0tltoioetadfs2emnvp;u0aeenxfctadlmDr n o;t0setr(r3oydope  ieias sruaxr ;u4teeo feiysfmDulnvp;t)tetrio ia1lpD lu olt teto(m3io1lmtemnvtatf rtaum ;t4ole  ocildlaDeln pnu0teenmo oa1fa  au s;t0t2urir iudaltn ictl(fa2rmxmp;o1apxnmfeiltfs2uan o;t)trxrio oa1fa  livi s0s2umimpoy4ol emnvsl( a2tau pno0tptniictytlsDumumo t0 ltnmocoodfmtrlnvs;s) rxr(opny1amtelnesa() ruau ooo4tet mfetytla ra( sn() ltnmo3tatlpDe uvolt srxrimpiodamenlfetl() 2rmxm ;o1opxoif3iys a2ulnvp;() lxomfctadop  aueolt0 2toxmpny4lp nmnvsls aDtrump;t4aleomociys a2uaumo;u0altnmo iadlpt lueo s sexmxr3iodoltn fctasfsDumu  ot1apt mi3ilsla ean s;u4 renxo3ootlpte n ilt0 2trxrpou4lleemfetls)a2rmum nu0tlx  feiysfm2eanvs;(0tltrir3to1latr n s ( seuoim3nudapt lnes tfsrta(  ;t0tpxnmiciad sDel(vp () eenxrctydopDeauvi;s)s2umirpno1op  liei ()s2rm(r nu1aeen fetydls rmums;t) etrmo3oytlmD  u o;() eurxr3nodome  fct s  rumxmono4olx iicias m2rl( ont4tlermr3iy1latr ivilt  rumiopiodaltnmncs t  2uax oou1aex mociasfs eln s t)aexrif3oa1fm raivsl(  rxrxrpiu4ome mfvtat sDrm(moot0tetnio3tad sDelumo u0altrmocoy1fp eau o ( trxoio ny1al   icilsf 2tr(mo;t4tpxomoctlt a2uauvp u0 etnmr3iodomDrau s;s0trtmxo ny1lp  mfct s)a2urxr ou0oet  ociysfaDra( s;()altnxo3io1latr i sls  etm(o3oydamtemieslt  2trxro;o0apen i3iatfm eln sn(0arxrmo iatoa rlivsl() exmirpou1lmee ivsls  2ra(mpnu0optoiieiytls2rl(vo;()alxomr3iadoptrlueo;(0teuoxr3io1lmt  ivtat  rrr(rooo0alen fcild s elu s u0artrxo oytfp elieol()srtoxo3no1lpt mfci s)arurx p;t1oltniietltla rlnms;t0altnmo iotoateanvo;t0seum(m3oy4lp emieta( sDrr(  no4tlt miciat s2eanmo t) ltnxr oadlp elnvi t  2xmim no1altemici s) 2rm(m ;t0tlto fctyt mDrmn pn()tetomocta1op rau i s0setmxr3oo4ll emfci t)sDraxr no1tpt iiciad s uau on() exoircoadfpDrai i;s0trtmxopno1lpe mnes tf 2rmxrpot4oee mi3iyt a2uaump (4 leoxr3ia1fatrlu i t) exoxr3iy4olen neils arur(r no0apt mietytlm2uaumpnu0arenxf3iodfaDelu o;t0srxrim3iudam emnvils  2ta(r ;t0opx  o3iat mDrlnmpnu4trxnxf todoptrlieils srtrxm3nu1lm   fctlt srtmx o;o1oetniietld s elnvs;()trtoirciytop rlu i;(0 2toxmpny1op  mnvsl()a2ua(monu1openiictltfaDulumonu4tlxomrctatfm  aues (0 exrimpio1ape mivtl()a2ta( p;u4oee  icildfsDuluvp;u)aetoxr oadomtran slt  rtr(m iu1op elnvtat)s2rrxr no1texoifeiysla2emuvp u0 lenircoodomDr uei s)s2umim iudamte nci tfs2rmumpoo0apt  o3tls a ulnvp (0 rtoio3oo1opt lueo () rtrirpnu1lmtemiet (  2ta( pnu1olto oeiysfm2umn s ()trxnio3tydlmtrau o t0t2ur(mpoy4llenmict s) rtm(mooo1oex iictysla rmnvonu0trtnmo3iatlateai ilt0setrio3oy1lm   fet t)arumxrpot0aet mietad m um( sn()tlxomo tadom e uei;s) eto(m3ou4oleelfvia( s2ur( o;t1opx ifeias m2eanmp;(0 etrxf3iotlp rluvo (0t2tmxr ny1lpe mfvsl(  2tm(r ;o1aeto octls s elumo;t)tlxrmociy1faDraneils  eumxopoodlpenmnci s) 2tmur ;t0aleo fcils s ul(mpn() ltoxr oy1fate u o;s0s2xoir3iu4opt mieias)a2rr(  ou4aeen ieilt sDrlnmp u0 reoxf iatlaDe u s t srtrxmpoy4om  mfet (fs2um(  ;t0alxomfctatfmDem(mp;u) rerxociadlpt  iei;()truoio3nydlme lict s  2ur(  ou0aeenmi3iysfm2uln o t)teenifciodlp   ieslt) 2xoxo3iy1lm nmfvtl( arrr( pnu0aee  ietyt a2uauvs;(4 exrifcoy1la r ivo;t srto(o oudlp emfvs tfarumumo;u0optnio3ilt mDumn s;t)artrmo ta1laD aueo (0setmimpiydom e ici (fsruau pnt4tlx iieiatfa ra( o;t)aleomr iatoaDelu s;()t2um(r3io4altnliet t)aDtau  ou4aexo o3tat a2ea( p;u4aeeomo iy1lmD ln olt0 rxoxm3ny4olt  netlt aDtaxr ;u0optomiciadfs rmu s ()trerif iydoatraivo () 2xr(r3iudom   fviatf Dtau o;t0aptoioetytfa rmn p ()treomrcio1laDr n il( srtm(o nu4oleelies t) 2uaxr oo1alxomi3iatfa uau onu4tlxrxfcty1op   uesl() 2xm(rpnudlmt mfesl(f Drrx  no0aeeomo3ilt a eau p (4 rxnif iodomteanvs;s)srtoir3io1ol elneta( s2tr(m nt1aptnifciysls2emnmp (4aexrmfcta1oaDr nes;t)srurim oo4ap  mnvi t)aDtmumo;u4opeomf3tlslmDrln o;t0tlxnxo oytomDranvo;s) exmxm3nodom nlieils arrruront1tpeoifciatlm uanvs;(4artrmr oy1opD anvs;s0seurxr3oodoptelicsa(  Drrx  ;o4olenmf3iltls raump;u) rtrioctotla e i i;t0 rtrxr3ou4apeemieilt  Dtrxmooo1opxo oetydfa2rmu ont)trtriocoytoat anes s)sexo(m3io4lmt  fetat s2trx o;t0tetnmictadfm uau s;(4aleomo3oa1lp r u ils0 exrio nu1lm  mncta( s2taxmp;t4aet mociaslsDuan s u0 rtnmrctatfa e ivo;t0 eurirpoy1lmte nvsl( a2taump;t0tpeomi3ildfsDemn o t)teerxf ta1oa e neilt) etoxopiu1llt lfvsat)srurxrp;t0olx  fctysfaDrlumsnt4 ltoxrcoadfm e uvo;t sexoxo nu1omeelfcilsfsDurxr no0aeeo fcildlaDran o;u)trtomo3ty1fpD auesl(  rum(opiy1op n ncsltfaDrr(rpno0apx  oeiys a2rmumon(4trxrxf oodop r nei;t  rumir ny1omte fesltf ruax oot4aptnmo3iltfmDem( s;t4aexoio3iy1lmD  neil()setmim iodlmen ivtlsfsrtaxmo;o1alen i3tyt a2umnvonu0trtoxf oodfmD  neo;s  eurimpoydam nlict (f 2trxmoou4ope ioeiltlaDemn s u4aexrxr iy1fa rlnvsl(0s2trxmpnydoltnmfcs t)aDumumoot0aeenii3iyslmDuluvo;t0aeerif iytfpDraieolt) rtrxopiy4lm nlies sfsDumu  nt0aetnmo3iasfaDrl(mpnt4teeriocoo1fm e neil(0 eurxo3oo1apenlfct s sDta(r nu0olxn iciys sDel(vs t4teenmo to1omDrluvol() 2uo(mpnu1al emncils aDrmurpot1tet mi3iyt s2emnvpnu4tetrxocoydfpDrluesls0sexoxo ny1openmfeilsfs2ta(m oo1aeeniietls a rmnvsn()tlerir3tytfa  anes t0trtmxr3nudomeemivi sfs2rmum ou1oetnmfeiyd a ul(vp;() eenxf3iodopDeau s;t tetoir oy4ol  miviatfs2tr( pou4aexnmo3tld m2ea( o t0tlermrctytopt  i s;t0t2tmio3oo4lpen iciat srraxmo;u1tpt ifeils a rlu o;(4tltnmr oydomte ivs;t)srxmxm iodaptnmicsl(farurumooo4tpx  o3iadfs uau o (0 lxnxr3io1opDran i;s0s2uo(m3io1apenlfvia(fs2umu  ;t1olto icildlm ulumo u0alxnxfcio1op elnvs;s  ruoxo3ny1lm n nvsa( artaxm ot4oex ioeiydfmDelu p (4 etoxocta1laDr nvslt srum(r3ou1ape  iet s s2raum nu1altnmi3iasla elumo u4altriocia1lm   u olt0 etmimpiu1ll elietl() rtrx ooo1tet  i3iltfm2ulnvp u4tltrxocoy1oa rai i;s)s2toir3nu4lmenlfct (  Dtrump;u4oee  o3tltla eln o (4tlenxr oatfp  au il(0s2tr(r io4altnlnvtas)a2rrxrooo1tltoif3tlslsDuan p (4alenxrcio1fp   nvi;t)srtmir3iydlm  mnvtl(  2umur ;o4aex mo3iatfa rmuvpnu0aeeoxo3oatomt  ieils0 etoxopiydal  mnvt (  2rax o;o0apt mi3ildla um(vp;u4 eerxo3io1oaD aivils  exr(r3iu4alen net t  2uauront0oleomiciydfm2rmums (0trxrxrctydlatrlnvi ()srtmxo iydap   ncias srtaxm ;t1tlenmoctld aDulnmpn()arxoir ia1optean olt) etr(opny1opeemnesat)sDraxm nu4apen fetytlmDua(vp;u4 reomo3iy1fmDraivi;s)s2xmio io4amenmfcs s  rtaxr ot4tlxnii3iasfaDemn s t) etoxr oa1laDranvs t s2tmxrpio4alt livs sfa2trum ;u1tltnifeilsls eauvo;(4aexrxf tatlpDeau s s0 2uo(o oo1lm elfvia() Duau  nu4tpxoio3ias m rlnvs (4 exoxf3oytfaD luei;s sexr(r3io4ap e fvt s)sDta(roou0olxomfetysfmDeauvont4teeomr3iytlmD  nei t s2urxr3oo1lmtelfesls)s2uau poo4oee ii3tldfs em(vo u0texoir3tytfm r ies;(0 2toxm iodop nlies t)s2rax oot4tetnifctysfm2elnvsnu0aetrmf3tatfpt lues;s sruoio3io4omt lnet t) 2tm(ronu4tleo o3iatla rl(mp;u0 ltnir iadop rlueo;s trxrxm iydolte ietatfaDtmu  ;u4oee ifeiydfs emumo t0trxnmf totfatrlies s  etmio3oy4ll  mieilt sDraxmpot1apenioctydfsDrln o t)teeoxf3iatlp rau s t0tetrxmpiu1ll nmfeiatfaDrm(r ;u1olto ictatlaDea( ont4trtnxr3iatoaD lies (  2xrxr nydlltemfct tfsDtmumono0apxomo3ias mDrlnvs;u4artnxf3oo1omD  ivols t2toirpnu4apenlnvi ( a2rau pou1tlt mietat sDeaumo (0trtrio3totlaD lieo t0t2trxm oy1am nmncil( sruaxro;u4tlx mfetatlmDuauvo (4arxnxf3oadfptelivi ()seto(rpoy1lmenlivia() Dtr(  oo4apt iocias a uaums;()arermo3oo1omte ivs s)texo(m oudape lfvta(faDtmurooo4tet if3ilsla rlnmpnu0trtomo3tadlpDr neo;t sruo(m3iu1lmt  ivs ()s2urx pnt4tptnioeild sDum(vont) rermo3tydlateluvo;t t2tm(r nudlm  lfetat)artaurp;o1oetoifciadlm uauvp u0altomf oydfaDrai o;t0texmxmpoy4olenmiesas) ruaumo;u0ole moeiydls2umu s;() etoir todom rauvs ()setr(m nydom  lnetas sDua(r nt1tltniociadlm2um(von(0 rxrio3oodfat  ivs t srtmxmpiy1lp emivt (fsDrmumo;u1oex  ieiadfm rauvp;u4 exnmfciy1lm e ueo s0srxmxo ny1lp nmnvia( aDtaxmp;o1aleo ociyd m el(ms () lxnio3ty1fp eau o s0tetmiopno4ap elncsls)aDur( oou1apxnioetadls rmu s t0 ltomo3io1la  livs s) ruo(mpou4lp elfcsa(fs2tmxmpou1apx moeiyd aDumumo;t0 ltrio3iotopD aneilt  2umxopoy1amtnmnvsasfsrraxr no4tlt  fciad m2rmnmonu)alxomfctotoat lnvslt0 rtrio3oydlle lfcta(f Duax  ;u1tltoifeiltls2ra( on() eeoirciytfmtr n slt0 2trim3nudlpt lfvsat aruau  no0apenmociatlsDumuvo;u0alxnir io1fp  luvo t)s2uoxrpio1lmenmiesat artm(  nt4ole mf3iytfs2elumo;u)tetrmf3tytfat  u i;t srtr(r3ny1lmtn ictat)a2um(ro;u1apx io3ildla2rlnvs;t) lxrxrctytfm  luvo t  2ur(mpnydlpe lnvtlt  Dumur oo1aeeo feiadlm uau p;u0arxnir3to1omtr u o;t0s2xrir3nu1al e nctltfs2rru  oo1alxn i3ilsfm2ul(vo u0 rxrioctytfpt ln s;t trxrxopou1ll n nesatf rrmurpot4aet  o3ilslm ulnvpnu) ltnio iytfat auvi t  eumxo iu4om nlivils sDtm(m ;t1teeomo3tasfs2rmnvsn() eerxf3oa1lptelu i (0trxmir3oy1lmtemnvslt sDumxm nu1tee mieildfa2ean ont)artnxf3iatfm e nvi;s0setm(m3iu1om n fet (f rtrxmp;u1olen ieiytls el(vs (4 leomr3oy1fa r i i ( s2xo(o no4amt mncsl(fsruaxr nt0tlxomieiydlm ulnms;t4tltnxfciotla eai i ()teuoio no4op emivt (fartax pno1alx if3tatlaDulumsnt) exoxo tatfpD auei s teurio3oy1llenlieilsfsDtaurpno1oeenmoeiltlm rm(vs;(4arenxo ootfp rlnvs;() eurxo oy4ale mictls)aDua(r nu0oexn f3iytfs ranvs t) rtniocia1optrln sls0setm(m nydol e ivsl(  2trur no1opxo ictadfs2rauvsnt4altnio3iotlpDe ues;( t2xm(mpno1lp nlivilt) 2umu poo0tpeomieilt mDra(vo;(4 lxrio todoa eaieolt  2xr(m3oo1lp emicsls)a2taxrpot0openmfeiydfa2uanvon()tltnif3iydla e neo () etoir3iudll n nviat)arur(r ou4tpt iictys sDulumont4 ltrioctotom eau i;()seto(r3io1apeemfctls)srra(rpnt4alt ioeiaslm2uln snt0tleoir iydoaDr n ols)setoxo nodope  fcsls  2rr(rooo4apxn i3ildlm2ea( p;t4aetoif iodfpD  ivols trurxopnodape  nvilsfaDrmxronu1oltn oeiatfs rlnms t)aleoir3oodlaD lnvi;(0setrim ny4al  livtls) Dua(mono1opx mf3ias a rm(msn(4 ltnxf iy1op  lnes s texmiopiy1ll emfciasf Duaurpnu1open f3ilslaDrmnvsnu4aexnmf3iadfa ran s;t)srxo(o3oudalte iciat)a2raumo;o1optnmf3tldlsDemnvp;u4arxrir3oytfa rau i (0s2trxm3oydam e nvsatfs2trx  ;o4tlenii3tatls emn o t4teerxrctatfa eli o;t  ruoiopou4optn nvsltfsrtmxmonu0ale iociatfmDeln p;t)altoio3ta1fat  nei;s0srumxo3io4am nlieta(fa2rmuroot0tpx moetys m2rauvs;u4alxnmr ty1la  luvi;s0srum(r iy1omtn fvt ( a2tax ono0olxomi3tatls elnvo;t4arxrmo3oadopDr ivils)teurio iodam elivtlt)s2umu  ;u4openmi3iydlm2ua(vo (0trtnio oo1om r n i t0texoirpny1ol nmfeia( sDrmxm ou0tptnifetlt mDea(vsnt) exomfctadoptelies;t)sexmxo3nydap nlfcsa(fa2taur oo0oex mfciys m uauvpnu)arxrmr3ty1fpte iesls teto(o3ny4apt mncsls)srraurp;t0alx iieildfs2elumo u4 etrmo oadla e ivols s2umxr nydopee ivs tf rurx pnu1opxomi3tat mDel( onu) rtrxrcia1lmteaueo;s0t2toxm3iu4lmee nei t  rtr(mooo1tptniociasfs ulumonu)aeerif3oo1fp eluvi;()s2uriopnu4op n ivsl(f Dtr(  nu4ale mo3tat a2el( on(4 reomr3tytomDe n i s0 rxmiopoy4lmt mncils a2trxmpot0alxoioetyd m umums (4alenxr3tadlpDeln o;s)seumxm3io4ll   icsas)sDrax pnu4tleo icilslm2em(vont0 etomf oatfa rluvi ()t2xm(r iy1om nmncias)arum(monu0oee  ociltfsDum(vpnu0 rxoxf iytom elu o () eto(rpoy4om nlnei tfaDurx p;u4tltomietasfmDemuvs;t0tetrio tadfmD auvo () eum(r oy4alen fes t sDuau  nt0ole mfciasfs2umn p u0aeenmoctydfpD aivols) rtrxo oy4amt mnvs ( s2ta(mpou0ope io3tydfm rmnmonu4alxoxfcta1lpDe u i (0srto(r nu4openlivtas arraxmo;o1aee ii3ildfmDranvs;(0aetnxo iydfaDelnvi;t) 2urxo nu1lmtnliciasf Dtrxmo;t4aleo ietatla2rl(mp (0artoioctodlateauei t)s2tmim iydaptnmnvs tfaDra( pnu1alt iieiys a2eanmont4 lenmo3totfatraneo ()s2tm(o3iodlpeelfvslsfsrtm(m ;u1tptnioeilslm um(ms t0areoif iotfmDrluvolt0tetm(o oo4omte ivtls) Drax p;t1oltn fciadls2rmuvonu0 eenmo iydfp elivs;(0 2to(o io4olee fes (f rtax pno4alx  ieiyt s2ra(mo u4 ltrifcta1la e ues;() etm(m iu4lmenlfcils) Dtmxront0openmietltla ua(vsnt) rxnif oydfpte nei t s2uoxm ny4amenmnvtl(fs2tmxmooo1optnmf3ils a2em( o;u0arenif3iodlpte uvi;t0 2to(r3io1ap e nesas  Dtaxmp;t0teenifcildls2uan s;u) rxoxf oytlmtr n i s)tetm(r3no4omtemnctat artru poo1alt moetasfa rm( ont)tlxrxr3totfpteaneslt sexrxr nydomenlivilt s2tmxmo;u1teeomieiysfsDrl(vsnt)tlenif3iadfm raiesls s2toir oodome mfes ( aDum(m ou1aptniiciat s2ra(msnu4 rtnio oydlp  lnvols)teurim3oy4amen fvsl(fa2trum nu4tpto ieiydfs umn o;u)tetoxfctydlaDraueol(0sexmirpoy1alen nvtasf 2tax pot0olt moeiyt s umuvsnt0trerxfcoydoaDelnes;t  rtrio3iudlptemivslsfaDtm(  ot1altomoeiat a2ua( p;(4arenxo3tytfaDraies () rumio io1ome mncs t srraxront1apenifeilsfm ulnmo (0artomr ta1lmDranvo (0 rxoxmpoodaptnmies t arurumono4oeenmictadfm ulu snu4 lxnir tydfaDe ues;( s2tm(rpou1ome mnes sfs2um( ono4alxnifciyt mDran o;t)aeermr3tatlmtean ols seum(o3no4lmenmfei sfaDra( p;t0oee ifciyt m umnvpnu0aexnxf ty1fmDr nvo t)trxr(o iu1aptelictl()srraxmp;t0apx mo3ias sDrlu pnt4teeoxf3oydomDe nvo t trumxo nu4oleemfvtasfsruaxr ;u1tpxn fcilslaDea(mo;(0areniociadoaDrauei (0 2xoim nu4olte ivi () rum(r oo4aex  ocildlmDem( p;(4aeeomf tydop  li ils srxoio3oy4amtnmfviasf 2tr(r oo4tptniieiyd a2elu s;u)alenmo iadfp  lnvo;(0seum(m3iydlpee nvslt)arraurp;u4aeen o3iadls2rlu snu4teenir oa1faDraivs s)srxr(opoydalt  fci t)aDur(mpno1tlx mfctlt a2ul(vs;()treoxr3tadfat lueol()s2tmio3iu1llee ncias aDtmx o;u4teeo i3ilt mDranms u0trtnif3oydomteli s;s) 2uo(mpiodop nmfes s)aDum(r ot0ale  i3ildlm2el(mp t4altrmfcoo1omteluei;t)texo(o iydape  ieia( aruau  ;o4tleo fcils sDeaump;(0treomoctadlatelnvi (0srur(mpio4omtelfvs (fs2tmx oot1opxoif3iytfs2ran o t4aexomr oytlp elu il()t2tm(opnodlpt mfei t  Durur ;u0tpeoiieildfmDumums t)arxrxr3todlmt lu i;t s2urxr3iudape lnvil(fsrururo;o0alxn f3tldfm2el(vp t0 rtrmo totomtelieo;s0srumxrpno1lpeemncsl( sDrauro;o0oetoiictldlm2umnvo (4 eeomfcoytlaDr i sl()trur(r3nu1apee ivt tf rtau  ;u0aptnmicils m ea(vp u) ltrmf3iatfat auvi;(  2umxr3ny1omeelfesat  Durumpno1aptnmfciltlsDrlnvp ()tlerifctatlmDraueo;s trumio no1lm n icsl( s2ua(monu4oetnmfeiasfaDuan ont)tetrmo3tatlm  li sls0 rxrxm3oo1lm n ictatf Dtrxrpoo0aet ii3ildfm2rluvo ()altnxf iotfaD au sl()s2tr(o3nu1lp n ivt sf rumurpou0oltomocildlm emnms;()artomrcoytom   i s;(0tetrxrpiu4amtemiei tfaDra(rpou0ape  fctydlmDulnvon(4alxrif tadlp rlivi s0texmirpoy1am nmiesl()srrr(m ot0tptomf3ilsfa rmnvpnu4aleomrcoatfm elneo;()t2trio3nu4ale  fet s srra(  no4olxnmi3tas a2ea( s;t0texnxrcta1om raues s) 2xmxopnu1olt  fvt s)s2rmum nu1apxnioeiytlm2emumo ()aeeoir3iytopt anvsl(0trxm(o nydlm emfvi ( aDum(mpou1tpeo feias a rlumpn()altoxo to1fpteau s t0 rtrir3nudlmt lnvs tfs2ta(moot1opx  iciyslsDem(vs t)alermr3todfmt an s;s trxrxmpoydap elfcsls a2rmxmoou0oetnmo3tyd m2em(vs;u0treomo iodoaDr nvsl(0s2xm(rpiu1olee icia( a2rauroot4tptoifetad a ea( o;u0 etnio to1lm eluesls teur(o3no4omt mnvi sfs2uaxr oo1aeenioeiasfa2rl( o;() rtomf3oodlm  li ils0 rto(r3io1lleelfct tfa2ta(m ;o0oleoiictltfs uln p;u)altoxf oatomteauvs;t) eumio3io4lle mfvilsfaruaxm nu1aexn iciydlm2emu s u4 etrxr iotfm rlnei;t s2xmiopiudlpenlfvslsfa2ur(mpnt0tle mictltla2rmn p u0 eerxfcta1omtelnes (0srtoxrpiodop emfctls)a2tax p;t1tpenii3ildlmDuan pnu) lermfciadfp eluvi s0srto(o io4omte iesas s2rrx p;u0ape mi3tyd s emuvp (4 rxrir iatlpt lnvi;s  etrxm io4aptemivtat)srrax ont4aleomf3tadfs emnmp;() rxnmr3oa1omtraueils0s2toimpnudomtnlfvia( s2tm(ro;u4tptn octls aDrlumonu4tleoxo3ia1om r uvs () 2umxopiu1optemnvslt)a2trumpno0opxo i3ilsfaDemump u4tltomo oa1fmDrlivi;s  rxoxopoo4am   nei t) Durumo;u4altoiietldlsDuanvs ()arerir3oatlm eau i;s0 exoxm iodlp e nctat  rum(ront1opt miciydlsDelumpn(0aetoxr iatomD  u il(  2um(r3oudlpt  ies s) 2rru pno4oeen ieiat m rmn on(0altrir tydoa eanvsl(  rxr(m3nu4oltemivta(  Dur( o;t0optomociltla2rau s;() ltnmf3oatomD  nei t  ruoxr3iudoptemfvta(fs2tmumpno0tpenii3iadlsDrlu o;t) etrmr iotomt an i s0 rur(m io1omt mncsa( srurumpou1tlx if3iat m2emn s;(0trtrxfcta1fat  nes;s)t2uo(rpio4oleemfci s)s2tmu ont4tet miciasfa2eluvsnu0 eermf3oa1laD aiesls  2uoio oy1llt  fes () 2uaur ;u1tpxn iciasfm uanvo;(0aexoxf iytomDeli s;s)trumxr oo1ll   nvias  rum(  ;o1oee moctadla ul(vp u) reoio iy1op rlivol(  etrimpiy1opeemietat)sDtmxmpnt0aeeomfeils a2rmumpn(4 exrioctadlatrluei;s sexrio nu4lm  mfvt ()aDuax pou4olt mfetadfaDua(vs;(4aleoxo3iydfmDeaueo s texrim3ny4optnmivtlsfs2umx  ;o0tpxo iciatfm eauvont4trtrioctotop raiei t0trxmiopnodomenmnet t)aDuaumo;t0oeeoioeilsfa umnms;u4 rtnxr3oy1fmDean slt srtoxmpny1llt mncsl(f rtmx oou0tpx  iciyslaDul(vp (0treoxocoytlaDelu ils) rtoxmpnodom n fetl(f rrrxmoot0tlenii3tltlmDranms t) renmrctodfpDrai ol()t2tmxr iu4aptnlnci t) Dtrump;o0opeoiictlsfs uau snt4 lenxf3iadfpD li i;t0sexo(m iydomen fvsltf 2tmu  ;t4ape  fciytlsDum( o u)tlxrxrcoytlm   nvs;s srtmim io1lp n netat)srurum nu4opxn fctatfm2rmnmon(0 exnxr3oytoptrlies s teurxrpiudom elivtls)a2rru ont1aeen oeilsfa elnvp;u0 rxoxr todoaDelivo;(0s2xrim3nu1olt mfctls sDraurp;u4oet ii3iatfaDrlu snu0 exnmr tatom  aieo t  2tmxr3nudape mnvslsf Dtru  nu0oetomoeiatlmDeaump;(4tetnxf3oytfm  anvs (  rumxr iydaltemfcsls)srtrxmoou0aee mocildfmDemuvs;t)trtnifciydoaD  ieslt0 exmxo iy4lmtelnvtl() Dtrx  ou4tpto oeild s2em( s;t0 eenmrciodfm eai ils) exrxo ou4ol e ivs s)sDrr(mp;u4ape ioeiyt mDel( s u) renxo3tatom e ies s) rumxr oo1ol   fvslt)a2rru  nt1aetnmf3tydfm ranvp t0altrxr3ootoa r n i;(0s2xrxm iu4openlieiat sDurxr ;t1olxnmi3ils m2rm(ms t0 etrmfciodfp   nvs;()sruoiopoy1am e ivslsf 2ta(m ot4aet  ociydls rmnmo t0 eeomr3to1la  aieo (0trxmiopiy4lm  lfvs t) Dtm(mont4aet mfetytlsDean o (0 etrmf3tadfat lieo;( t2ur(mpio4am  liei sf Duaxmont1olxomoeiad s2ea( sn()altoir3iydoat aueo;t)setoxrpiudlltn neiat srtr(mont1opeo i3iys m2rl(msn(4aetrif ty1lpDe u o;s0 rtoxo iy4lmtnlici t) rta(rono4teeoio3ils sDrln s;t0artoiocio1lmDeauvo t)s2urio iy1lmeemnvs () 2taxm ;o1apeoioctltla2ulnms;(0 reriocia1op rluei;t srxo(r iu1aptelivt s)aDrrxr ot4aee mf3tydls2ea(vo;t0arenxr3oatfmtraivslt0tetm(r iudllt mnes t)artaxm ;t4ale ifetls mDemu pnt4tlxrio ta1oaD  ivs (0texo(o3oudal e fcs t) 2uax oot4oeeoiiciysfmDrm( o t)alenio ty1optraieol( s2tr(o ny1lpen ncs ()s2ua(mo;t1aex ii3ildls2ua(vo;t)trerxrcto1fmtelieo ( trxo(mpnu4om  mfctl( artr( ono0apeomf3tldfs2eln s (0 lxoio3iodfmt lueil(0seuo(m3nu1ale mfvsat s2taur ;u1alenifciadfm2umuvpnu4teenifcty1om e ivols  2uoxmpiy4ap elivslsfa2urxrpno4aleo ociad a2uanmsnt0 renxoctodfp e u i;( srumxr nodlptemictl(f rtrum no0oetnioeiad s ea(ms;u) exrif tytoa ean s;s)srxo(m3nudol  lfvta(  2trxro;t0tet mietadlmDuln pnt0tetrio iydfm r ieo;( srtr(r oodal  mnvta(fsrrmx pnu0aexomieiydfm2rmu s;t4 leoxf iodomtran i;t seuoim nydllee ieta()s2tmx  ;u1aleoio3ildfm ean pnt0aeerxrctotoaD li i;t0 2xoxopoy4llenmieiasf 2rr(ronu0altoio3iydfsDemnvpnt)aexnir3io1lmDrauvo;(  euoirpou4ol nlicsa( arrmxmpnu4aptn ietat m2rmn o;t4aexomo tatfatean o;t teumim ny4ap nmfetlt arra( o;o4apxnmfciysla rl(ms;()aeeoio3ty1fptrlnes;() eurxo no4omtn fcils  Duaum ou4tpx  oeiatfmDumuvo;u) lxomf3ootlp eliesl(0seur(mpiodal nlnetl( s2rrx p;u4alen f3iytfmDem( o;u4arerxf tatom  anvo ()truo(rpnodope mnet s) rtrxmp;t1aptn icilt m2ulnmp;u) rxrxocty1latelueol()trxr(m3ny1ame  feia(fsrtmxm ot1aet mi3iasfa elnvpnu4teeomo oytopD lnvslt) rtoxm oy4ap nlfvtlt s2tmxmo;t4tltomociytfsDulnvo;u4 etnxrcia1lpD au sls0t2um(rpiy4olenlictas  rrax  oo4oetoio3tlslsDeau s u)tltrxfciydfmte n sls) exrxr3oodlptemfeilt)srumx p;o1tee  f3tas s2rl(ms u)artrio oa1oat lu i;()setoxr3io4ap e icil(  Dtau o;o1tex  ieiydfs2rau p t0trxnmo3iotoa e nei t)setoimpoy1al  liet t arur( ono4oetniieiyt a ul(msnt4altomocio1faD  nei t) etoxm3ny4lptemiesa(fs2tru pot4aex  oeiydfs2ua(vo u) rtrmf oydopD  uvols0srtmxrpoo4lptemiciat)srua(m ;u1tltoii3tys a2umu o;t4aeeoxr totla elnvo;( texm(o oudlp  miesa(  rtm(r no0alxnmoeiys sDranvs;t)texnmf3ty1omDrln s;( s2tm(mpio1lltemivsa()sDtm( oou1tpxnmfctls s el(vp;t)alenioctatlm   uvil( s2xrim ny1oltn iesa()sDuaxro;o1alenifetydfm2um(mpnu4aexoxfcoo1fm  li o;s seto(r oydom  mnctl()s2rm(ro;o1altnioeiydfaDemnmpnt0aexomo iotop rai olt t2urxopou4lle licsl(  2taxmpnt0teenio3ils a el(vs t) lxnmrctytfmtran sls0t2to(m io1am emfes ()s2ua(rp;t1aeenioeiatls ua( snt)tltrmr3oa1fp rln o;()s2xoxopny1aptnliesl( sDrr(rooo0aleoifciydfm2ranmpnu0 exrxr todla r ivil(0truo(rpny4lmt  fci s sDur(roou4oeenmfcils mDulnvsnt4artoio oa1omD lnes (  exoxr ny1ape  nvs t)sDtr(r oo0oexomiciasfm ea(monu0alxnmr tydfpDe nes;s t2toxo oudlp   fct sfsDrru ono4tee ifctytlmDrl(vo;u4 rtnif ootfpDe nes;t)seurim oudll e feiat)artaum oo1oexo feiys s uan s;(0 lxrio totfate i olt trurxo ou1lmtnmfeilt) rumxmp;t0tet iieiat aDelnmo t0tleomf oo1fmtrluvi;()t2tm(o iu4optnmnesat) rtmx  oo0aptoif3iatlmDrmumsnt)tltrxociodoaDr n i;()s2xm(mpny4llte fei tfa2tmxronu4opxnmi3iytfs2ra( onu)tltomf todlmD luei;t  rxrim nu4omt lfvslsfs2tm(ronu4tlen i3tys m2ean s (4alermo3tytfpt  i o (  rxr(rpio1lpe lfvs tfa2rmur ot0oex  ieiytfmDel( s (4tltnxf3io1fp rau sls0t2uoio oydlm elnvtat s2ua(mo;u1altn o3tlt m2rauvs;t)aleoxrcoadlpDrauvs t0texrxr oodom  lncs t srrm(mpnu0optnii3tlslsDrlnvs;u4 exrxr3iatfa e nvilt)s2xoio iudol nmnetlt)artaxrpou0tpxnmfetltla rmnmsn(4artrmr iodlpDelu i;s  2xoxo iudoptemfcs (  2tru  oo0aee iiciyslm2ul( p;t)alxoxf tatlp eai i;()teuoir oydoleemiviat) rta(ront1aptomi3iydla2um(von(4texrxrctotfmDe ueolt)srtoxopiu1optn fvsatfs2ra(  no1tlenmietytfsDeln s t0altoif3iotlpte i ol() exrir ou4ap elfesa(f 2tau o;t0tle  oeiydfm ua(ms u0tltoxf iydlmt lueslt  etoxopiu1lpen fvs ( sDrrur ;u0tpxn ieiat mDumnmo;(0texrir3iodomtelu i (0s2toxmpnodll e iei t) rtm(r ot0aexo ocildlm rluvp u) etnxf oydoatelnvs s) eto(o3nudope  icsltf rrrx pnu0aexo f3tltlm ra(vo t0arerio oadfpteai o;s)s2xoimpiu1alen nvs ()aDumum ;u4olx  oetys sDrmn pn(4teermr tydfa  aieolt0 etm(m3no4lpen nctat  rtau ooo1aexn ietldlm em(vs;t4tlermrcta1laDelieo;(  rxr(rpoy4alenlneia()aDrrum nt0optoifciatfsDuln p;u4tltoxfcoodlptelivs s s2xrxrpou1lm e fcsl( a2rax o;o4apt if3tysfa ulnms ()tlenxfcoydlatr n ol(0texrxr3nu1ope lnctas) 2rr(rpoo4oetnmiciltls2umnmpnt)artniocootlp eanvo t texo(o no4lmte ici t  2umurpnt4tpeniiciad a rln s (0aetrmf iadlaDrai s s s2uoxo3io1apt  icsatf Dtaum ou4oet  feild a rl(vp ()tlxrmf3oa1op elieo;t trtm(opiy1llt micsatf rtrxr oo1tlt  ocildfm ul( o;(4 reoir totlaD an o s)seto(r3iu4omtemfvtat)a2rm(r ;t4oetomietys sDelu p;(0trerirciotfa elu i;(  rxmiopiu1llen fvs ()srururpoo1oex  octytls umumsnt0altnxo3oodfatrlnvi t  rurirpiy1amenlicsas)srtm(moot0alen oeils a2eaums;u)trtoircoydfmDelivo t) rto(o nydalee ictl(farurxr ;o1aexnmfetysfmDua(mo u)teermocoodfm  liei t s2um(mpnydom nmnvi sfarrmxmp;o4tpt mocilsls el(mon()alerircoy1omDeauvo;()texm(r no4olenlnetl() Dtmxm nt1altoioetydla2ranvp;u4 reoxrciadopt  nes t)s2uoxm iu4ll nmncsa( aDtmxmp;o4tltoif3iat m rln o;u) renir io1lmDraueslt texmxo3oudllte ivs t  2trxmonu1teenmietad s el(vs;(0 lenxo iodlp  luvolt0 eum(mpiy4lmtnmiciltfaDua(ro;o1alenio3tltfs2ulnvs;t)aeermocoydlat auvolt)trxrim3nu4optelnei t)s2rmxmpoo0alx io3iys a ul(vp;(4 etrxocoa1laDelieil()srurim3nu1ll e fct s)arurum oo4oexomoeiad m2rmumo;t0trxrio3oy1lmD  n o s0t2ur(r3nodom nmnvtat) 2taxm ou0oltnio3ilsfs el( o;() lerxr3ootopDr ieo;()sexr(m3nu1al   fvi sfa2trx pou4aexnmfciadlm uln o (0 etrio3oo1oat lnesls texo(m3iydapenmfvilt aDua(  oo1alxn octad sDelnvsnu4trxrxf3tydfmteanes;s0 2xrio ny4alte fct tf rumxro;t1ope ii3tlt sDea(vont0 reoxo oytlmD anvsl() 2xoiopou4ap nmicsas) 2taxrp;o4aeenifeilsfs umn pnt4alermrctodlmDrluvo;s t2xoxopny1om elncia(f rumxm ;u1alx  fciys s emnmp ()arxnircoydomD livi t)trumxm3iodamtn ivta(  2ua(mp;u1aet iiciad m elnvo t)trerif3oy1fm   i slt  2um(rpou1lmeelfctas a2raur oo1opxoii3tadfa2ua( s;t4trenmr3to1fmD lnvs t0 2uoxm nodaltelivil() rra( o;t0oltnmo3iasfs ranvs;u) rtnxr3oatfm raueo;(0tetrxr iy4ale  nciat)sDtr(m ;t4oet ioeias s elumonu4 leoif3io1op  anei s)s2urir nydlpt  fcslt)a2tru ooo4tpeomfeild a ulu snu0aetnir iodopte nvs t0 2uoxmpio4altemiet s arta(m ;t4opxnmfctldfa2raump u)arermfcootlm rluvol()trto(m oo4olenlnesat)srraxro;u4aetnifeiasfa2umnmont)altnxf io1lmt ai s s t2uoim oydapee ics ( s2raxmooo4oeenioctadfa2ua(vs u0tetomfciodlm e ueo t)seuoiopnudal nmnvtl() 2rmx ont4opeoiociadfa ulumpnt4 etnmr3todopt  uvil(0trtrxmpnu4al  miviat aDrr( p;o4opx ioetadlm uanvs;t4 reoio3ia1fp rluvs s)srxoxopio4open nvt t s2tr( pot4aex moctldfmDrlu o (4areoxoctydoa r uvo (0 2xr(r oo1oleelfvias)sDtmxronu1tlx iieildfm2em( p u)tltoif io1lpDeluvs t0 ruoxr iy1ope mici s)aDua(mpno4oeto o3iatlaDulnvon(0 ltnxr3tytomte u i;s) 2xmimpiy4al emneilsfa2rmxr ;u4apxn fctld aDrau p (4teermr todopteanvs;()setmio3oy1ll   nesat artr(mo;u1apt mo3ilt s rm( p;()aetoxr3oydfm ran ils s2to(m3ou4ol emfei tf 2tm(mpnt4tetnifciysfa2ea( p t0 lenmr3oatoa rlneilt  etrim3oo4opt mivia(  Dumu ooo0tlx iiciatls2uln o t4aetomr totoaDeai i ( srxmxopou4lleemnvilt  2ua(mpot0ale moeildlmDulnvs;(4alxnmfcootfa  anvils0 2trirpnydlleemfciatfaDurxrp;o1tpxnmiciasfs2uaumonu4aexnmf3iatfpt  u ilt0 2toxmpou4op nlnesltfsrtm(ront0tltn f3iltla2ulnvpnt0 eermo3oa1oa rau slt)sexo(m iudolt mfvsls  2rrxr ;o4oetoiietad s umuvsn() lxomf3tydfpteau o t s2xoxo3no4lptnmfci t)aDrmx p;o4olxniocilt m el( o;(4aeeoxo iytfa rluvils srxr(rpiodame lietat)arraxr no4opxomf3tadlaDemumpnu4 etrxfcoydlp  an s;(0srtmim oo1llenmncs tfaDtmum ou1texomoetat s rmu pnu0 lerxr oodomDr n ols0 2tmxr3iu1alen ncsa(faDrrum nt1apxoiieild a rm(vsn(0 rxrxrciadfp  livslt0srxmxo3io4lltemiet () Dtru ont1tlen iciltlsDem(mo;u0altnxf tytlpDrliei t) 2xm(m oudol n nvs t  2rrx pou0tpen o3tas aDulumo;t)tetoxr3totlaDe nvi;()trtm(m3no4ale lnciat  Dua( p;t4optnmfetlt a rmu on(0 rtnmfcty1op   ues;t sexr(r nu4lmenlnciat) Duaxm ;t1tpx mieiltls eanmsnu)texoxf ty1lpt aivs t0t2xr(mpnudlltelncsatfarrr(ro;o4oeen o3iad a rm( snu) rtrxr io1lpDrlieo;s trumir no1om emfvsls  2ra(mp;t4ope iieildfaDulumpnt0artnmrcootla eliei ( t2umir oo1omeemicslsf 2rr(monu1oexoii3iydfmDrl(vs t0 leriociodomDe ues t seurim iy1alt lfcs t) rtrx ont4alx mietysla ranmp;(4trxnmo ta1oat aiesls)srxmim iy4ope  ictlt  Dururpnt1tleomietadlm uluvp ()trxoxrciy1fm elneilt0 rtr(o3iu1am nmfciasfarraurp;u4olxomiciyd s2umumon(0arerxfctatop rlies s0 eurir oo1am emncsa(f rraxmono4oeenioeiydlm2rmnmpnt0tetrirctydlptelivs ()sexrxo3iodole lfcilt a2ta(ront0alt  fcildlaDeln o t4 reomoctodfa   nvol( s2ur(rpoydlp e fes s) rtaxm ou0teeoiietldfm ua(mp t4aleomfctodlptelneil(0 rtm(o3nu4apeemfvt tfsrtmu  ;t1tlx moctyt a ua(mo;(0trtnxr3iotfateluvsl(  2uo(m iy1ol   fvs sf 2rmx onu4aexoif3tldlm rlnms;(0trxrifctotomDran o;s  etm(r3iu1ap emnct tfartr(mpnt0ale mieiadla2umnmo;u4tetoif ootop rau s;t0 rtoir iudom n ieils aDtrx  oo4oeeo ictasfa2rmnvp () exoif3oydop  lueo;(0t2tr(opiy4olt lfvt sfs2uax pnu0alt mo3iad a2ea( snu)areoxo3tadlm rlneo s)t2uo(opio1al nmfvs () Dtm(  ;u0teto i3ilsfa ua( o (0aexrxr3ia1fatean ilt0t2uoio3oy1optelnetltfaDtrx onu1tpto o3iytfa2el(mp;(0 eenxo3ta1opDrlu o t) 2umxopnu4lp   fet (faDtaur ;t1tptomf3iatfmDrlu snu0teeoif3oa1la  ln o;t0t2xmir ou1ap n fviat)aDrru pnt1opxnii3iatlsDeanvsnu4trxoiocto1fm elivo;( teurxm3oy4lpeemfeiasf rrmx pot4tlt ii3iadfaDumumpnt0tlxrxfcoodopDelivs t trtoxrpnu4om nliesatfs2trx o;t4tpe  feiatfa2ran onu) ltrir ta1om e ueols)tetr(r3iu1lmenlfeil( aDrmxm no4apen ictls m emumo;u)aleomr tatlp raieols)seuoim3iodomt lnvs tfsDrmx p;t0ole  i3iys m eanvonu0tlxnxoctodlm r n o;( t2um(o oudomtnlivi (faDumum no0opt ioeiadlmDem( o (0 eenxociytfaD anvi (  rxrxo oodlm nlnvtl() 2urx o;o0alx  icildlm ea(vo t)tlxoio iotomte ueols  etoxm3oy1oleemieils aDumxmo;t0tpeoifctldlmDra(vo ()treoirciy1lp   n sls0t2xoiopoodomt  fvtas a2tr(mp;t1apt  fcildfm ulumsnu4arxrmr3oa1lpDrlueils setm(m3ny4ap emivil(fs2tr( pot4tpeomo3iyslaDemn o t)trtnif totfa ean i;s0sexoio ou1ole  nesa(fsDtrx pnu4opt io3iytla um(vo;()tltoxf3iy1fmDraiei (0teuoxr iydlme mnesl(fsrrrx  ot1oetomf3tldfa um(ms t4 lxrirctydlpDeluvslt  2xrio3iodlpte ncil()sDtm(roou0aex if3iltlaDrm(ms;t0tltrxr3iytfaD auvsl(  2xmxr3iydoptn nes s)s2tm(  ;o0ale ifetytfs2ranvo;u0aeeriociotlpD  nvsl(0srxrxrpiu1optn fesa()s2tmurpnu1oex  feiatfa ean pnt0texniocoytfpDrai s t)t2umxopoy1ll  lnvsasfsrtrump;o0oet if3iydlm umnmonu4tltnxo iy1lp  aiesl()srtrimpoodlpt micsa(fartmx o;t4tptomociad mDulnmo (4 renxo iytlmtr uvo ( setmxm oy4omenmnes s  Duaxr ot0ape mociltfa rlu pnt4 leoxo3oadomDr uvi;()trtoirpnudlle  icilt a2tax ooo1apenmoeilsls uan pn(4 lerif3iytoa eau o;s0srto(m3oy1apenlict t) Dua(mooo4teto ociltlaDrmnmo;t)tleoif ia1lat  nei;t)s2ur(o3oudamt lnviat)s2umu p;u1oexo o3iat mDranvo;()alxrmf tadopt lu ilt) exmio3ou4altn ies ( sDrmxm nt4oleoiociad mDuln o;(0tlxoxo3iadlpD lnei t) 2urxm ny1omtnlfvtatf rtr( ooo4opx ifciysfa2uluvo;t0teenmo3oodfpDrln olt0 2tr(r oy1lle mncslt)srtau oot0tle  iciaslm2ea(vpnt)alxoxf oydlp r n o (0s2tm(rpiudol emfvsl()aDta( pot1optomiciys s2emnms t4trenircta1op eaues t s2to(o nydapt  ieta( aDua(rono1aexniocild a umuvo;t4 etoxfcoo1om   ivi;s sexmir iudol e fvslt a2ta(rpou4aptomieilsla uanvp;t4 etniociadom  aues t0setr(m3iodll nlfesatfsDurumo;o1oexnmoeiasla2em(vp;u0 rerxfcty1fm r nei;s)texmxr3nu1lmee fcsl(faDtmumoou0tptnmfciyd sDrauvp u) lenir iatlm  lueo s) 2umxopiu4lp n nvsltfsDtm(m ou1texomi3ils sDrl(ms;(0altoifcoydomte nvs;()setrxo3iudap   icsasfs2rrxm oo0olt ifetasls rm(vs t0aexnxr3to1om ranes;s trxrxmpoy4opt  ivt t)s2tr(moot1tlx  feiydfa2um(von(0trenif3totfmDelu s s s2um(o nodlmeemics s sDrrurono1tle if3tlsfa2emuvs;u)tlenxo iodla eln ilt)s2xrimpoodop nmnctls)a2rru p;u4aetnifetatlm2rau p t0artrir3iadom  ln s;(0srtoio3ny1llen ivsat sDtmum ;t1tptn o3iydfm2ua(mo (0altnxfctatfmD  uvs;t0sruoxm3no1ape lfet tfarrr(rooo0alxn i3iydlm2ua( sn()aetrmfciy1la rluvs;t)trumir oodlmtn ies (f ruaxm ;t4aeeoifeiyt m umuvp ()arermo3tydfpt ln s t)t2trxm oo1op elivsas)a2raump;t0aexomietysls2um( s () rtnxf3oodfm r n i;t)srtrio iu1ol n ivsls  2tax o;u1tlxomo3tyt s2ua( p (0arenir todfp  lues;(  eumim3oo4lp emfcilt) rurxm nt0tet moetltfs raums t4alenxr to1fa   n ils setrxo io1am   nei s)s2urx ooo1ale  fciytls2elnmpnt0tlenir oydoa raiei s0t2umir3oo1apt  fcs t arraump;o4opxoiiciltfmDelums t4 ltoio3tadom   uvi;t trxriopny4ome lnesa( sDtrxronu1apt  i3tydls eln p u)tltomo ootlp elivo;t) rumxrpiu1ll n ncil( srrm(rpnt4olto icilslmDuau o (0artnxf iadfa e neil( trxo(o oodalte ivtas a2rmu o;o0oltnifctytfs uauvo () etoir3totfp  ln sls0texrxmpoy4ll n fciatf rtau ono1oetoiictat sDuanvsnt) exnmrcoo1fateanesl() exoxr3ny1alen ict ( a2umxmpou0altoiietlsfa2ulu p t4 leomr oatfa  lieolt)srxrirpoodaleemnes t sDtrur ;u0oet miciltls rlnmo t4 etoxr3iydoa raieil( srtm(m io1am elict t)sDurxm ;t1tet ifctydfs rmn s t4 ltoxfciodlp  lnei;s)setoio iu4optnlivs s sDtrum ot1oexo o3tys mDrl(vs (0 lxrircoo1opDrlieslt0texrim3oy1ame  icsat srrrx  no4texn fciad a emn onu)arxnmf oydfm e i o (0t2um(m3oodap emnvsl(  ruaumoou4tpxo iciyt a um( snt0arxnxo3oytlmDeanvs ( srto(r oudale  fvsl() Drmxmpot0tpeomo3iyd m umuvp ()tetnmrciy1lptranesl()setm(r iodomt mnei ( srtmxro;o1ape ifeiydlmDel(mp;()texrxo tadoa rli i s trxrir iodol  lnct tf rurxrp;o0opx ifcils m2el( p (0tleoir iotfmDr i o s) rtr(r3iodlmtnlivtl()aDtmu  ;o0oet ii3ilsfaDul(vs u4altrif3ty1opte n sl()srum(m3nu4lm n nesl()a2taxmo;t1tee  iciysfa elnms t)trxrio3iadlptean i;t)seuoxo3iy4ame  fvsl(fa2umurp;u1alxoioetat a2eanmsnu) exnxf oydfa rluvolt) exmxo3nu1al n nciat)s2rm(mo;u0opxnmieiadfaDuln s ()areoxf oy1fpteln i () rtm(mpiu4llt lfeilsfsrtr(mo;o1oeeo oeiat a2um(vp u4trerirctotfa rlivs;s0 rxr(opoo1am nmnesl(fs2taxmpou0tlxo ietydlm ua(ms;u)aetrmf oo1oaD lnei;t)t2umio io4omtemfvtl()s2trumo;u4tpxniocilt m ea( o;t)trtrmr3oydfpt  uvs s0seuo(o3io4altelnviasfarumumpnu4olt mociat s uan p u0trtrxo oydoa rlnvs ( teuoimpno1oleelnvtls)aruaxm ot0tpx mo3ildfs2rlnmsnu0tltnmfcoadfa rai i (  2tmir3iy1ll elnei t)a2rm(mpnt4aee  feiydlmDemu s u0arerif totomteai il()t2toxo3nydopt mies s) rrr(mpoo0oeeoif3ild s2emu s;u) renxo iotoa r nvo;() 2to(r iy4alte feil(fs2uaxm ;t1oeenmfctlsfaDeau p u) rxoiocoatfmD li o;s0sexr(opnudopenmfctatfaDtmu o;o0tleo fciltfs ran p ()tlerxo tadoaD ln o;t0 eur(o3ny1amenlfviat)s2tr(moot0tet  ociysfa elnvp;(4trxomrcootlmD lnvo;(  eumio iydamtn feiat  rra(rpot4apeomieiytlm2el(vp;t0 ltomo iytfmDrli s (  rtoxo oo1alenlfvi tfs2tr(r no1tlxnio3iasla2um( p t) reomr3iadlpDeauvslt0 rtmxmpoydlltelncias)s2rm(  oo0tpt mociysla eluvsnu4 lxrif tadop elnvils s2xoim oudlm n icsas) 2trxro;u1tleo ieiltlmDua( o (0aeenif oa1lateaiei;t0seum(o ny1lp nlnetls)aDraum ;o1opt  f3ias a2uluvont4arenmocoytlmDrluvs ()teuo(opnydll e fesatfsDua(  ;u1alenmieiltfaDelu o u4aetomfcty1laDe nei;s) eumir io4omeelivtl() rtrumpnt1aex  i3iyd a2em(vp t)trxrmfcoatop  aiei (0 2uo(o oo1lp e fvilsfarrr(r nt1ale mocildls rau pnu4tltnio3oodfa elieo;() eurxo iy1lm e nci (f rtaurpnu4opx iicilt aDuanmo (4 rxomr tadfptrai sl() exo(o iydllt lnei s)sDtru o;u0ale ioetadfm elnms ()aeeoir3todoptelnei;t s2xm(m3nydomtelfes ()artr(rooo0alxnmfeiytfm elu p t0aetrxf3ootomDeaneslt)tetr(opoodame  fet s)a2tr(ronu0olto i3iyt aDuau onu4 rtomfciytlaDeauvs;s) rxmxrpoy1altelfvsl()s2trumooo4opxomo3iysfaDulnmp u0tltomr oa1fpt  u s t sexo(o iodlpte ivs sf Dtaxrpnu4ope  i3iytlm2eanvpnu4aexoifctatlptrln ils0 etmim3oydaleelnes ( a2umu oou4oex  octydfmDumuvont)aeeoxoctatlpDranvs t) 2ur(o3iy1om nmfeilsfa2umumo;t0tlxomf3iytls umnmp;u4tlxnif3iy1oaDr uei;t0t2tmxopiudope livt ()arrmx  oo4tlxn o3iyd a rau s;(0tltnio oodoa rlieo;()t2xoxo nydamte ietls s2rr(mpou4optomoeiadfm2rlnvo t4aetomociydlmD luvo t0trurxo3iy1olee icsa() ruru  nu0openifctldfaDemuvont)altnmrcto1oatr nes ( s2tmirpio1ame  nesl() rraxmo;o4opxo o3ils aDran p (0alermo3tytoaD ln i t)sexoir3oo1opee ncs (fs2tr(ront0opxnifeildlmDua( p u4 lxrxr oy1lmDr nvi (  2tmxo3nu1ap  mfviat  Drmu  no4ape ifciyt m2emnmp;u)tetrif3oy1lpteai sl(0t2xo(m3nydop emfct ( srta(m ;u0texniieildfm ul(msnt0alermf oodoatr ivil()t2tm(m3io1lp emiesat)aDtr(mpoo1oeenioeiatla2rmnms t)texrio todfm raieils t2trxmpoudlmtelfvt s srurum ;t1oexn i3iatlm2rmnvonu0tleoir tytfpt aieo;(  exmirpiu4lpe micil( s2tr(rp;u4oeenii3tysfa2uan o;()alenmo3oatoaDrln s s  rum(o nu1am emnet (f Draumpoo4oexo o3tyt s rmn o t0aeermocty1fatranvi (0 rtoxmpio1llt  ictl( sDrmx  nu1tle moeiad s2um(mp;(0tleoxf3todlmt  ivs;( teumxr ou1ope mncsas  rrau  nt0oeenmfeiasls eauvon(4tetnio3tadfa elivo;t)s2to(m oydolee ncslt  rtaxmooo0teeo iciytlaDrlumo;t)treoxociatlat  ues t tetmio iy1ll e fcsa() 2rr(rpot4tpxnmoeilslmDrl(vp;(4tltrmo oytla rau ols)srurio iydal  mfciat sDrr(mpou4oleoiociysfm ea( o;(0teeriociytfmDr ivs t0srxr(o ou1alenmnet ( aDur(  ;t4tlx  feils a2um(mp;t)altnif3iy1fa eaies s0s2uriopiydamte ieta(farrmxroot4aeeomf3tadlm2ea(mo (4artoircoodlm eauvo;()s2uoxopoy4amt  fvsat  rtrxr ;t1alx  i3iyt mDulu o;(0alxrxf iadoptrlivs ()trurim ou1al n fetat)a2umxm nt0aeto oeildla2raumsnt) rtoifciotlmteln sls0texmimpoodlpte ncia() 2tru pno0alxn oeilslmDumump u4 lxnmo tytfmDeaivil()setoio iodalt mietl(  Dumum ;u0opeoii3iad m ra(vs (0tetnir oadlm   nvs;t0s2toxmpoodomt mnes tf Dtau ont4oltn i3tas aDelumsnu) eermf ootfm  livi (  euo(opnydom emictas) rumu  oo4oltoifeiatlaDemnms t)trenxo3tatopDeli s ()truoxrpiudale mfcsl(  rrrx poo4oetniieiyslsDra( pnu)alenircia1omD anesls)seumirpiy4lleemicils a2rru  ot0oleo iciyt m2um( s;()trtrio iytlmtranvi t  2tmxrpiy4amtemfctls)arumxrono1oet mictytlm2rmumo;() etomrciy1op rlueols)texo(r3io1alenlietat) rrm(r ;t4alt iieiysfs uluvp;()trenmf ootfmDr u o t  exmim iy1amtnlfesatf rtmx  ;t0tpxniiciytfmDuluvs;t4 etoir iotfptrluei () 2xriopoo1apt  nci t)a2umxmont0oex mieiyd aDua(vo;u0aexriocoa1lmDr n i s)truo(r3iodap  lfet ( arua(r ou0opx if3tys a2raump;u4tltoxfctytfa  aieils)t2toir oydap nlfes t)sDururono4aet mfeiys sDemu p;t4 renif oatlptrauvil(0sruriopiy1olt mneilsfs2ua( ont0aexnmfetad s2um(vsnu0aetomfcta1om  lnei s0seuoxmpno4ol  livsl()srua(m nu4oetoiieils mDrm(vp (4arxomo3oo1lpDrluvo s t2urxm oo1opeelfvt ( sDrr(mpno4tlxnmfetyslm em( p (4 rtoxr iotlpteln ilt)teurxr oodoptnmicias  2um(r oo0alt ii3iydls2em(von()arermf tadoptrlnvi;(0s2uo(r nu1lp e fvi s)sDurxm ot1olxomieiatlm eaumsnu0 eeomr3oo1fp r ies;s)trur(r3io1lpen ietat  Dtmxrpnt4oexn iciat aDrmuvo t4 rermo oo1opD  i s (0texm(o iudop e nvtasfaDrr(  ot1oet mociytlm rmnvp;(4tetnif3tadlpDr u i ()t2xo(mpny4omte nci t)srra(rpou4tlxnmociasls um( pnu0aetrxf3iy1fmD aiesl(0 exoxm oo4oleemieia(farumx p;t4teeomfeiat a uanvp;(0alerifcio1fp elneil( sexoxo oy4apeemieilsfa2uaxr ;o0aexn i3iadfs2rl(vo;t4texomr iydfaDe ivi s) etrxm3iydopen nvtl(f 2trxmpnu0aex if3iatls2rl(mp t4 rtomf3oatopDelieslt t2xrio iy1aleelnes (faruaump;t0aexoiiciys sDua( pnt)trtnir oadomteaueolt texrimpny1ll   ncsat s2ua(r no4alxo ictld a2rl(vo;(0alerirciy1oa  an olt t2trxr oy4lpeemivil(f rtm(rpot0oeen f3iat mDemuvsnu4 rtoif iadoat  n ol(0trumim iu4lpe mivi ( srum(  nt1alxomf3tlslm ea(mpnt4artrxr oodfmD auesl() 2uoir iudole lfcs tfa2ur( pno1opeo o3iytfa2eln o u0tleomfctotlaDrlivs t srum(m3io1olt  nvslsfsDtm( pot4tlx ii3iatlm2ranms;u4tlxnxf3to1oa ran s (0 2xmio3oy1om eliviat)a2rrxrp;u1olxo octydlsDum(ms t0 etoio tydlp  lueslt0 2to(m iy4op   ics sfsDua(rpno1ape iociltlm ulnms t4 eeoxf3iytopDeaivs s)seuoxr nudolee ietasf Duax o;t0aexn ictas mDrmu sn(0 ltrxo oodfm   u o t sexo(m nu4om emncslsfs2uau  nu0tlxo fcilt m2ra(vsn(0 rxoxrctadla eai i s trurxrpnudomen icsa(f Drmx  ;u0altn fetltlaDumnvp;u4aexrxfcoodopDelnei;t)t2urxopoy4al nmnci (faDrm( o;u4optnmfeiltlm2ra(ms u0trxnmoctadfm   uesl()teuoio3no4amtelfcil( arrmu p;o0apt mf3ilt m2rlnvsn(0teenio ootlpt an o;s  rxoxr3ny1altemict s)srtm( ooo4altomoeilt mDrlnmo;()tetnmo3todfat auvol(0srxo(o iydomt mnetat  rtaurpoo0aleomictaslm eln s u4arerircoy1omDeluvs;() rtrimpnydlm nmfviat)artmumpnu4opxo oeiadfaDemnms t)trenmrciadfpDelieils setoim iudoptelfes t) rrmuro;o1tleo oetyd m2rlump u4alxnifcoadla  luvs (0srxoirpoo4lmeemnct s) 2rmum ;u1aleoiociydfaDelu o;u4treniocoodfpDr nvo;s0seurim3oydaltelictlt artru pnt0apen oetlsfa ua(mo () rtoifcio1lmD auvs t trxm(r3iu4ol nmivtasfsDrmx ont4opxn oeilsfa2raumo;u4artoxr3iotomt liei;t)srxoxm3io4op nlivta() rraumpno4opt miciatfmDuanmo;(0texnircoa1opt au i t srxrxmpoo4ol  mnvta() 2trur ;u4tet mi3tysls2rmuvs;u0 exnmociytoaDrlnvs;s0tetmim3ny4ap elicsl(  Duaumo;u0oee mfciyt sDulnvo;u4trxoxf tydlm eaueo;s trxo(opoy1ole mici s s2urx ooo4oetoifeiltlsDuaumo;u4 rxrxoctydlatr ivs;(0s2uoxr iy1lm n fctl() Dtrxrp;t4aeen feildfa2el(mo;()arxnmf ia1fmt au i t)teumxm iy1lm eliet s  ruaurpoo0aptoifetldfaDemuvp t)aexnio3oa1lmDeauei;t  2to(m iydlptnlfvtls sDtr(root4texo i3ils a ua( pnu)tltoir totla raieslt)srto(o iy4olt mfvtls arurur nu0alx  o3tls mDum( ont4alermr tatom  aivslt0 2umimpiydomtnmivta()a2raurpou4tpx  octadfmDranvs;u)trenmrcia1omtelueols) exoiopiy1lpeemivi ()sDurx  ot0apxomi3iysfm ua(vp u4 ltrxfciy1latelieo;s  2toir iy4lm  mnctasfa2ur( o;o4ope mfetltfs um(vs;u)aeerif3totopDrau i;s)s2urxr iodal nlicsatfsrtaxrp;u4optn o3ild s uanvs;t0 rxnxr3tydlatrli s;s  eurio3io4llt  fci s) Duaur ot4alxo fciasla2rau sn(4 reoifcoo1lm r u o;s trtrio3oy1omenmnvta( aDrrxro;u1ole mieiltlm eaumo t)altrxociadfp r n olt)setoxmpiu4lmt  nesls arrax o;
\ No newline at end of file
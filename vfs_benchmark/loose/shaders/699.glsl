@@ -0,0 +1 @@
+ueo;()t2tmio3oo4om nlfeiat artr(r ;o0tlxo ociasfaDuluvon(0teeomf3tadop r uvo t  rur(rpiu1am elietat) Dua(rpou0tlxoii3tldfaDeanvp (4 lxnmf3iytoptrauvsls sexmxmpoydlmenlici s  Dua(r no0teeomfeias s2ulu o;t4artrif3tadopDeauvslt  rxoxr io1olenlietltfaDumu p;t0oetn feiasfa2rlnmp t)tlxnifcoodfa eai ilt0t2toiopno1omeemnvsltfarua( o;u1aetoiociytla2ran ont)trxomrcoytla  au o;s0s2ur(m iu1llt mivtat)s2ta(ront4tlxn fctas mDrmn p t) exoxr3oa1om  au i;s)trxoxm3ou4optnmfcta(fsrum(ronu0altoifetys m2rlnvp;t4trtrxo oodlptrli s;s)s2xoxo io1omte fesat)srrr(mo;o4aeenmi3tldfm emnmp t) etnio oadfmtrai s (0srtr(m ny4olte nes () 2raurp;o0aptnmfcilslm uanmo t)tlxnifctadomt lnvs;t)t2xrxo ny4altemnvs tfs2tr(mp;o1apxn fctys mDem(mo;u) lxnif3iatfa ran i t) 2uoiopnydop emfctltfartr(m no1altomfeiadfs2uanvs;u)trenxr iy1lm eli ils)s2toim3nu4al n nes sf 2urump;o4tltomfeiytfaDrau p;u4areoxr3tydfpDr nvi;t0trumio3nu1aptnmfvsl(faDtaur ot1opxnmo3iltfs2ua(mon(0teenmf3oytfpDeai i t tetr(r nu1ol emfcil( sDrmx ooo1oeto o3iytls elumsnt0teeoxocoo1omDrluvo t)srumxm iu4opeemfvilt)aDrrxmpno0aeto f3iyslaDrlnmp;u0tetrmf oytfatr uvil()teuo(m nu1ol nlnviatfa2raur no4tlt  ictaslsDrmump (4 ltrirctytomDeai sl(0teumiopnu4lp   nvslsfaDta( o;u1altnmoeiyd aDrmumo;t4 etrxfctatfm   ivs ()sexo(r3nodll n nci sfaruaum nu1alxoiieildfsDrmu p;(0aexrmrcoydfaD lu slt0srtrio3nydaptnmneta(fsDumumpnt1aexn ieiyslaDum( ont0 lxnirciatfa  lies s)truo(o3iy4am e ivtas)aDrrur ;o0tpxomf3tatls2eln pnt0trtomo to1op e i ilt srxm(mpnu4ome micsltfarrr( oou1aee  oeiydlm umn p (4 eenmrcoytoa  lieo t0trxoxrpoodoltnlnvia( arumx p;t4openmiciaslsDrlu s;t0aeeomf ty1laD  n ils)s2toio iu4om  mieta()s2tmumpot1altnmo3ildls ulu onu0teenmfciodlmtelnvs (0t2trio3oodalt  fvsltfa2urur nt4alt  i3iadfm rauvo;u0tlerxo tatlatelueo (  euoxopoy1olen iei ( arrm(  ;o1openmi3iyt s ra(mpnt4 exnxocoy1oa   nes;()s2xr(mpoo1optnlnci t) Dur(r oo1tex if3tls m rln pn(0tetnmfcoatlateanes;s)s2xm(rpiydol e fesl()sDtm(rpot1tet  feiatla ulnvpnu0trenif to1latrlieil(0tetm(mpio1om elfciat)aDtr(mpno4apeoioctltla2ra( o t) lenio ootfpD an ol(0 etr(o3nydole  ncs s) 2ta(  ot4tlxn o3iatfm2rlnvsn(0tlenifctodopt anei;( t2tmxm oo1llen nvias  Duau ont0tltnioetadfaDrlnmo;(4tltomo3oatfmDraueslt0 rtrxr3oydopeelneslsfa2umxmp;u0tlenmiciytfs eauvsn(0 ltoir ta1la  lu o t)t2toxr3ou1altelies tf rtmur ;o1oleo f3tas m ran s u) rerxr oatoatr uvo;(0srtoir ny4lm elivt sfaDur( oou1tpt mfetys m eaumo;(4texrmr tydlmt li s ( truoimpiodomt  nei tfaDrax o;o0altn f3iysfaDuaums;u0 renxf iodlaD lnvils) 2umio iy1omt  fvtls) rtrumoou4tlto feiytls rmuvp;()alerirciydfp eli slt0 rxmxr3oydaptnmiciat) rrm(mpnu4oetn o3iyd s rau s;t)arxnio oa1omtrau il(0t2trxm nodalt mictatfaDtru p;t0tlxnmf3iytfm rauvo;()teenmo3oatomtr u slt t2tmxopno4omt livilsfsDtmxr ;u1optn oetyt s2ul(vsnu)artoxo todlaDrauvo ()teurxr3iu1olenmnes sfa2rmu oou1opxomoeilt m ulu p t0trxrxo3iytfpDe ivs;t0srtmim3iu4aptnlfeil( s2urxr ;u4apx mi3iat mDrluvo (4 ltnmo iytlp  livi t0 rxo(mpoo1om elfcs tfs2rm(ronu1oeen ieilslsDeln p;(0 lxnir to1lpt au ol( setoio nu4op   ieiatfa2urur ot4ape iietas mDumnmo u0 lermr3iytoaDr uei s)sruo(m3ou1ap  lfet ()s2taxr nt4apt mo3tldla ulnvp;t4 eenio tatfptran i ()trtr(mpiudope  nesas)a2tru pnt1tet  fctatfm2ulnmonu)arxoxo io1om  aieslt truo(rpoy1lp  mivtasf rrmurp;t0opx mociaslmDel(vs;t0 lenir3iy1la ranvo;(0sexmirpnydlptelfcta()a2ra(  nu0aexomfeiatlm2rmnvsn(0trxnmr3ootom elies;(0sexoimpiy1omt mictat s2uaxmpnu0tle  f3iatfmDeln o t4arxnxo3ootfat  ivsls0 2tmxr3iydol   icslsfaDraxmpnt1oetnmieiatlaDuan snu0 exrmocoytoptrai ils tetoio3oodlleemiviatfa2rr(  ou4teeniociyt a emumsnt0treoif3tytlp eauei;() 2xm(opny1lp  lfes t)srrr(rp;t1tpenifctadlaDul( o u0 rxrifcoo1fpt ai i;s trxoir no1apt livt (  2umum ou0tpxoif3ilt s2uauvsn()artomo3oy1lmD li sls) 2toxo oydam  lnet t)aDtr( pnu1olenmietytfs uanmp;(4 eerxrctatopD ln s;t0sruo(rpno1omtelfctlt)srum(m ;t0tee mietadfsDrlnms;u0trerxf3iytfp r nes ( t2trxr oy4al e icta(f 2urxmo;t1tpxnii3tytls2ran p (0trxnxf iy1fptrluvs t0srtm(rpnudomen fcs t srtm(mo;o4olxoii3tatlsDulnmo;(4aexniocootopt anei s)texrimpoudom nmiesat s2rmurp;u0aptn f3ilt m ua( sn(4 renmf iy1latraues ( seuo(r3no1omte ictas) rua(  ou0oetomfciysls2elnmp ()tlxoxf3totoaDeluei ( sexo(m3oodllt licsas) Dta( ono4alenii3iatfm emnmp;() lenmrctatfptelnvs (0 2xmim nudlmtelncsat arrmum ;t0apxn ictld sDeln on(4 rtomf iadoptr iesl( trxmiopnu1omen feta(f Duaxmpot0tet ifctydfmDem(vo (0 rxoxrciatfpt au ils  2urxm3io1amtnlfctl(  Drm(mp;o0altnifeiydfa2ulu pnu0 eeomfciytomDraies;s)s2uoxr3oo1altnmietls)sDumxm ot1tex  iciytfs umn p t0alxrmfcia1laD aivs (0trurirpno1lm e icilsfsDum(  no4tlto f3ildfs rmums t4aetnmo3iydfm rlieols seuoxm3nudllee nesasf Drru ono1alxn fciyt sDua(vp ()aeeoif ta1laD  ies;s teumxm3ny1amtn icsas  rtr(ro;t4tpt  f3iltfs ulu p;u)aeenio to1oat anvo;t  rtrirpiudamenlicsatf rrrx  ;u4olx mi3tltlaDrm(mp u) ltrxo ta1lptraivs t0trxo(mpoo1lptelivslt)arraxmpno0apenii3tasfa ulumsn() etomoctatop eluvi t0trum(mpiodop nliei s a2rmur ;o1olt  fciltfa2ranvsnu0aetnmrciadfp  aues;t0 2xo(mpno4lp  lnvi t)sDurum ;t1teeomf3tas a um( sn(4 rtoioctatlp  anvs;s0 rumxm nydlmen ietls arrr(ro;u4oetomoetydla2eln o;(0areoiocty1laDelu i;s)setmxo3nu1op e netl() rrrxmont1olenmf3iatls2rmuvs;u) ltrmr todfm rau s;s)s2tmimpnydaptnmfvil( a2umxrooo4altomo3iasls rluvpnu0 lermr oadopteauvo;(0tetm(o oydll e fcsltf rtrx  nu1olx ifciaslm umnms ()arxoxr3to1omtrlnei;( tetrxr3iy4omen nes sf Draumonu1tpxnmfeiat m2eau s;t0arxoxrcoydop e ueil(  euo(r oydopt mnvsa(faruau oot1aet ifeiydlmDeln p t0 lxomocoadlpDeluvol(0 eur(r iydamen nvs ()sDum(  oo4texn iciad s2ra( s t4 lerxrcty1fmD aues;t0s2toxm3no4apt  fvs (  2urx poo4ole mf3iad m2rln o () reoxf3oatfptelivols sexm(m3nydol n nviasfaDta(m no0altomieiyt aDemnvpnt4teenmfcio1fateai s s sexm(r3iu4lpe  fetat srtmuronu0tlt miciyd sDum(vp (4arxnif3tydop rlnvol(0 exrxmpoo1llt mfeslt srtm( p;t0aetoioctltlaDuauvs;u)tltniocoy1om rlueo;s0 eum(m io1llt  iei s)aDtaumpno1opeomfeiat m el( s ()aexoxocto1laDeau s t)t2xmxo ny1lm  livt ()artm( p;u1alxo fciytfa2elumo;t4arenmf3oa1fmDe ivils  rxm(m no4lltemfctl()a2trxroot4apt  ietydlm emuvp;u0alenxr3iy1fmDr u o;(  2trirpoo1ap elnes sfsrtrx p;o0oetomoctyd m2rmnvp u0trtnxocoa1oaDeaivs s setr(r3iydomtnmnvsl( sDuax p;t4tpx  i3iasfsDrlnvo t)alxrmoctydopDrlneolt)srtr(m nu4ll emnes t)artrxm oo4apxomfcilt s rmuvs;u)aexomf3iodfmDe ivi t0tetrxr3nydomt  ncia(fs2rmxront0aptnmfeiltlaDua(ms;()tetomr3iotla eanvo;s  2tr(m3oydamt mivsltfa2ur(  oo4tee ifeiatlsDrmuvs (4 lermo oytlatr n ol() rtrio oy4lmt mict sfs2uru poo0alxnmoeildfm2um( onu0aeerxrcty1lptelueols)t2xr(r nudamenmfesls) rumx  ;u0oexoif3tltlm2em(vo (4aleoxrcty1lpDrai ils s2uoim3ou1omt mfvias)s2uaurp;t0opxniictld a rlnmsnu4altrxrciy1laDe i i;t seurio3ny4opeelfvi s s2uaurpou1apxomociyt a2umnvp (0tltrxfcty1lmtrlneilt)seum(opnydlpteliei (f 2ua( p;t1olxn f3iyd a rauvo;t)texoio3iodlmteauvolt  exoxm iudlp n netat srta(r ;u4tpe  octys m2rl( pn(0aexoifciy1laD  ivol() 2uoxrpoodap  liet (  rrmumpno1tptniietlt s elnvo;t4 rermfcoydfm  au s;()t2urxr nu1ap elnctatfsrrau onu4oetoiictadfa2rmnmp u)aleomr iytlp eaueo (  exm(r oodolt  ici t) rtm(root0altnifeiydfa ulump;t0 exomocoydfa rlivsls  rur(m iydoleemivil( sDrmum ;t4oeeomi3tysla rlnms;()alxoir3totlm  livs;t t2xr(opoo4optnlncsl()a2uauro;t4aex  ictltls el(mo;u)altnif tadlpD anvilt0s2umim3iu4op elneilt s2um(rpnt0oexo octasfaDean pnt4trtnxo tydfa  aivs;(0t2toxo3ny4alt mfvtat  rum( p;u0aex if3iaslaDeau s;t0teermo ta1fatrluvi;s) rum(m iy1lptemnvilt) Drmxroou4aptnmietydla2ea(vp;u)aetrxo tydla r i i t  rtrxr3ou4op  mnvia()sDuaxr ou1aexoio3iaslsDuanvo t4aeenxr oodom  aivsls  exr(m3ny4lp   icsas  rrm(  ot0oetn fctasfm rau p;()tlenifciatfat  ivi;t)trxoxm3nodom eliet t  Dtrumooo1tlxn f3iysls2em(vo;t) exoxr oydoateluvo t0 2xmiopou4am nlivsat s2tm(mono4optnmicildla ua(mp ()alxrmr3oy1omt lu o;()trxmxm3io1op nlfctl()aDtaxront1opeomi3iyd aDrm(vo;u) eeniocoy1lmDe i s;t) rtrxopiy1ape lies tfarrax  ;o4tltn i3iydfs rmn o u4altoxf3io1fpDelneils0 2umxo io1omeelneta()sDtmxm no4oeeniociaslmDeluvo u0arxomfciydom eai o;(0trxo(o io4ap nlfei s)srtrx p;u1aee ifcils m2rl( s t)arxnir3oydoat au s;(0 exmim3oy1olt lncslt aDuaxr nu0alto oeiyt s2rluvp;t0 lerif3oytfa eaiesl(  2tm(r iu1llt liet s arrmu o;t4aeeoifciat s umuvp t4aexrxfcty1op raies s0 etm(r oy1lmt mnesltfaDrm(m ;o1oeeo feiydla2rl(vp (4tlxnxf oatop   nvi ( srtrir iu1opeelncils srtaurpou0aet ifciyd aDrlumont0alermr3totoa  aiei t tetoxr3iu1am emici sf rrmu o;t4olxn fcilslm uluvs;t4teeoxr3todlptr nvi;t  etoxm3ou1am n fcilsfaDtm(rp;u4olt ifeiydfaDean o;()trenif tatlatrlu o s0 rumimpiy1ole lfcsasfa2ua(m ou1aptomfeiytfsDelnmpnu)arerxfciatfatraies;(0tetrio oydoleemncilsfa2raxm nu1texo i3tas sDelu pnt4artoiocoytlaDr ivslt0 euoxo io4omtelnvsl(  Duru  ;o4teenif3ildls2rl( pn(4tlenioctatlmDrlu s s)s2xmir3nudlpe lictas a2umx poo0aee  fetltlm rm( s;()alenif3tatlptrlues s0 rxm(rpiydllen ivs s)srraumo;u4tpx  ieiyd m2rl( p t0teeriocoa1lm  ln ol()s2xmxopnu4om nlncsl(fartr(mont4aexomi3ilt a eau s;t0texnirciy1lpDr i o s0 rtr(r3nydap  mictat s2uaxrp;t1texoioeiat s rlu o;()arxrxr3totom r ueol( t2trir3ny4lpt  fcta( sDrm( ont1ale mieiat m rmu pnu4aexrmf3todfp r nvol(0t2umxo iudapee ivi t s2tru ont4tex mf3iad s rl( p t4 lxrxrciodlat  uei;t0teuo(opnydaleelfcsat) Dur(m ou0tlxnio3tydfm2rl( p;(4 eeoif3iotoaD aivs;s s2xm(r3iu4altnlietlt arrr(m ;t4oltnioeiad s el( o t4alenir3ootopDr i ils t2uoxmpiu1altemnesa(f rtrxm ;o4apenifctytfsDeluvpnu) leoxf3ta1fptrauvil( t2toio iu1lmtnlfvt sfa2uax  nt1aetn o3iad sDuaumpn() rxrmocoatopDrauvsls sexmir3iydllt lncsa( sDtmxroot4opxnii3ils s eanms t4 etnxrcoytlaDr n o t)trxo(mpny4ol n fcs (  rtr(r oo1texo fctlt a rmums t0 reoif3oatfat anvsls0seurxrpiu4ll  mnviat  2rmx o;t1tltomfetlsfmDeln snt0 exoxrcoodla ran i t  2toxopno4lp elneslt)srra(rp;u1tlenmociasfs2rm( p u4tltrmo3ootfpt  uvsl()tetmiopno4alee ieilt arra( pno0olto f3iydlm uauvs;u)texrifciydlaDr n s;( sexm(opnodalt mnvs tf Dtmx  ;u1tetomoeiadfm2umnvs (4trxrxo oy1omDe uei;s)srurxm3io4al nmicsa()artr(mpno4tlx  ieiatfs rm(mp;u4trtoifciodomDranei;s)tetr(m oy1al n ieia( arrax o;o0olt io3ias mDrl(ms;u) lxoif3totfpDe ies ( t2xrxm nodopenmnes ( sDrm( p;t4tetnio3tat a2rl(vp;(4texnmo3oy1oat anvo;s0seum(o3iodomtn icsl(fa2uax p;u0opx  oeiltls2ulnms t4 eenmr totlatr nvsl( t2urxrpoy4llenmncsl() 2rr(mpnt4olxn ociadla rmump t) rxnio tydom rlu i ()trtoio3oy4om  lnei t) Duru oou1aptoifeiysfm2umnmo;t)treoxrcio1lp eauvi;() 2umxo ny1lpee ncslt sDumu poo4aleo ietadfm ua( o u) rerxo3oy1lpteanvs;(0s2xoir oo4apenmivt t)srraxr oo4oltn fctlsfsDrl( p;t)aexrxocia1lmDe ivols0 rto(m io1ame livil(f 2tm(r ot4texnio3iysls rau ont4areoxr3ootop rluvol()srxrio no1alt lfvi (fsrumum ;o0oltoif3tasfm2ea(vp t)aetnmocoadfm  luei t  2tmxmpoo1ap nmfviltfsrumumpnu0tle  iciytfsDuan ont0 ltrmf3oy1fate ivsl(0srxrxrpny4omenmnvsls)sDra( pou1oeeo i3iydlmDulnvp (0trxnxf tytopDrliei ( trtmirpnydopt lfes () ruaxront1oleoif3tatla2um( pn()alxnirciytfmDranvi;() eto(mpno4lme lncs (f 2trump;o0apt iiciadlmDrmuvp t4aexoxr io1lp e i sls0s2uoxr nydlmt lnvsa()srrmxr ;u0tpxoifcils m rmu pn(0tetnif io1op rlu ols) 2urxm3nodom nlivtlt)srum(ronu1teeomfeiad m2umuvpn(4artnif iadlmD  i o s0 rtrxm3oudoltnlncs sf 2rr(  no1olto f3tytls2ulu pn(4 eenir tadfmD au o t  2xo(mpoy4apte neil() rtmxmoot1opt mfctadfa eanms;(0teerif tydfp ranvs t s2uoir oudamtelfvs t) Dtru  ;u1tpxnmo3iyt s eanmpn()trerifcoytla  aiesl( texrim io1apt lnvta(fartaxmpnu4apto fciyt m ea(von(0artrmr3iodop rln o;s trtmirpiy1lp  mieiltf 2umx ooo1aet io3iyt a2rlu sn(4alenxo3tatlm r i s;s t2xoxmpou4lptnmfesa()s2umxro;t1apx ioetytla2ua(mo t)arxrxfcoy1lpteaiei (0 exoim nodlpt mfcsl(f Dum( ont4altnmfetls m umnvon(4treomr3ia1fmt  nvo;(0setrim nu4al   fviat) rumuroot1aeeoioctas mDra(vp (4trxrifcootfaDelu o ( sexo(m oo1alee fvt s)s2tmx p;t0tlx iietaslsDuln snu0altoxfciadoptr uvs;t0t2um(mpnu1olt lictatf rta( pnt1aee if3ildfa2ea(mo;u)tlenxr3ia1opDrlueo t  2uoir3oo4ope lnesls a2umx p;t1tpxo ieiysls umums u)altnif3iy1oa rlnvi;t0srtr(m nudamenlfesasfsrrrxmonu4alto fetlt s ul(ms;(0 etnif3iatfat  ueolt)t2xrimpou1aleemfctasfaruau  ou0oltn i3ild m rl( s;t4 rtoxo3iadfp r ies ()trumim3nu4ap emfcils  rtmurpnt4opeomo3ilsls uan p t)arxoxr oo1lmteanvs t0s2um(o3oo4om e fcta(fartrxroot1ole ifcildfs em(vpnt4tetrifctatopD  i il() eumxmpoy4alt lfvsltfsruau  nu0oetn feildfaDemnvpn(4artnxrciatoatr nvi;()srtr(opnudomen fvs (f 2um(rp;t4tet ii3ildfa2ulnvp (0tlxnio oatfpDe u ils0s2xo(o io4oltn ivi sfaDra(m no4texn ocildfaDean p;()areoio3ia1lpteaivols)s2toimpou1alenmici t)srraur ou1opxn ocildlm2eaumon(0tlenio3tydlatrauei;s) 2urimpoydamt mfct ( aDuaxr no0tlx  ieilslm uluvp;t0tetoir3ta1oa r ies;s) 2uo(mpiydol nmnciltfa2ua(rp;t1texnifciys s ra( pn()teenmocoa1fa ean sl(  rtr(m iydamtnmicia( s2tmxm nt1tltnifciad s emumo;() rxrxo3ta1opte ivo;()t2xriopou1al e nvia(fsDtm(r ou4tlto feias m rlumont)alerifciodom e nvs;(  2xoim oo4lmtn nctat  2ra(roou0oexoii3iadfm2uauvp;t0 rerxf3todoaDranvilt) 2xmio oo4alee fcsas sDrmx  ;o0teto o3tydfsDranvo;u0teermf oadlm eanes;s)texr(r iodoltemivtls)s2rrumooo0oee mfctasfaDuluvpnt)tetnmr ty1fa raueilt  2trio3iydlpee iesls)s2umxmp;t1texomo3iltfmDea(mon(0 rxomr ootfpD  n i;t)sexr(r3io4ap e icsas srrrurpnt1apt  oetasfs el( p;(0tlxrifciytfpDe ivi;t0texr(r iu1ol n ncilt) Dtmur nt1optoiiciasfmDeauvs;(0trtnxo ty1opDr i ol()s2tmxo io4omt  ietl() rurump;t4tpeomoctld s2uanvp;t0trxrxr3iytfaDelnvi;t)texr(opnodomeelfetl()sDtaur oo1tleo ieiadfaDulumsnt0aleoxo oo1oa rli i (  2uoxrpoy4ll   fesl()sDra(rpnu1ole moetasls ean p;(4teenxo3oydlaDrlnesl()trxrxo3iu1alt mnes ()a2rrx  nu0opt  ictat sDul(vo;t)tlenxr3iy1lmte ivsls)t2umxr3oy1op nmfctatf rraxront1tlx iiciasfa uanmp (0aexnmf iatlpD anvs s srumim3oy4omtnlfcsat  2rr(ro;o1olxnifciys a2rlu s (4 rerxr3todopteaiesls)s2xrirpnodapt  nci ( a2uaxm nt0apxnmf3iadls eln pnt0 eenxr oydoaD  uvilt sruoxm no4om  mfetat) 2tm(rpou1tetn ieiltlmDrl(vo (0arxnmf3oadfmtr uvo;s  eurxm no1opte fet s) Dua(ront4tptn i3iytfm2ea(vpn(0 rtoio3tatfm r u o t0tetmxm iodameemnvslt  rumxmpot4tltoifeiytfm ul(mo t4 eermo3to1oate i sls)s2um(o no1ame lfvt t  Dtrxront1tex  ieiad m ean s;(4 rxoxo ootoaD liei s  2xo(opio1ame  fvsat s2um(rp;u0tpx ifetatlm elnvp;(0aetrmo3todopD ln i;t)t2to(o3iu1llt lnvi t)sDua(r ot0oeenmfciltlmDeluvo (4aeenxr io1fpDelnvs ()srumir oo4al e nesas) ruaum ou1tlxn ociltfm2ulnvs;t) lerxocto1oaD lneil(0tetoimpoy4alenlfcta( s2urxr ;t1olxomfctyt s2rmumsnu4alxomf3oadomteln i;t0s2ur(m3ny4apen ict s)a2rrum ot4tlxomi3iadlm emnvs t) etomfciydlptrlieolt t2xmxr no1ale  ivtlsf Dta(rooo1alxniictldla elnms;(0tltnxociy1oat  uei;t s2xmio io4lmen ieilsf rrm(mo;o1aeeo ieilsfm uauvo;u4tltoxociydlptrlnvi;(0trtm(mpiu4om e net (f 2ua(moot0olx  fcildfs2umu onu)texnir3tytopte ivs;t0 etrxm3oy4lmtnmfvt () Dum(mont0apt if3iytlsDranmont4 etrmocootlp  aiesl(0 eur(m3nodlmt  fcsl( srtaxro;u1tlx ioeildls2rmn o t4teeomfcoo1lp  lieils)trtm(mpiy4omee fesatfsrra(mp;o1apxo fetlslmDrmn s t0tlxrir ia1lat  u sl( trtmirpou1al nlnvt s)arur(mpoo0tltoio3iydfa2ea(ms t)tltnxfcoadlmDeaues;t)srtoio3nudaleemfvs sf Dum(rooo0tle mf3tasfaDra( s u)altoircoatla  auvi t0 2urxm3nodopen ictasfa2uaump;t0oleomf3ias sDrlnvo t) eeomo3tydlpDrai sls  2uoxm ny1omeemici tfsDtaxmoou1tlt  ictysfsDran p ()arxrmf iotfa  lu ils  2trxm iy4ap e ics (fartmxrpnu0tlx  ietyt sDua(ms;u4trtrxf3to1fmt lneil(0trxm(rpny4ol emnei tf rua(rpou4olxn fcildlaDrmn o;t0arxrio oodomDelu sls trxmxm3oy4amt mfci s s2rmumono1oleomfctas a2uau p u4arxrircoa1opDeliei;t0seum(mpoy4ole mfvi s a2rm(mpnu0alxnif3iatlm2ulu o;u0tltrir oytom   ivs s trtoxrpnu1am n iei s arrmum oo1opto oetls aDuanvs (4 ltnif tadfat  ivslt)seur(r3nydlpe  fvta() rrmxr nt0apxnioeiytlm2elnmsnu0aetrmf3iadopDr uvsl()t2xmxr nydol elivtl(  rtmu p;t4teeoii3ildla rmuvpnu0arxoxf3oatfm e n i t t2uo(o3oy4ame lieta()a2rm( ooo0texoiieiys a2ul(vs u0tltrifctydoa eanvo;() rxoxo oydol  mnvils  rrmu  oo0tpx ioctld m umuvs ()arenmo3oa1fmt livo;()teto(m no1ame lnvs sf 2tm(mp;t4tpx io3tldlsDrm( p t4aetoif ia1fptrln sl(  2to(r3io1altnlfcias) Drrump;u1opxoiiciydfm umnmo;u0tlxoxocto1omDrau s;s setr(opno1om  mfvsatfa2rmumoou1oltomfctysls2umnvon()aleomo3oydlp e nei;(0srtoim oo1omeemnvtlt) 2ur(m oo0tlto oetld m ra( ont) lxomr3oy1omDr uvo t0 exrxrpoudap nmieil(fartr(rpot0aee micilsfaDemnmo;u0 etrir io1lptr u i;s) rtmxr no4lp   nvi ( arra(r ;t0olto o3tlsfm2rmnms;u0 rxrxo oy1omtr iesls setoxrpnodamt  ies sfa2trur oo1oexnmieiys a2ul(vs (0trenxoctotfmtrau i s0srtrxo iodlp e nvt s s2uaxro;u4oeto ietlslaDrm(mp t4 exnxo3iotlaDrauvi (0trto(r3iy1am e fvtls)sDta(rpnu1oee miciadls2umump;t)aeeoxo3iodfatelneo t0 rxr(rpny4altemicsas)srtau pou0oeeo feiyd mDra(vs;u4aetrxf oa1opDe nvolt0setriopiydalt  icsas sDtaumpot1aptnif3tadfsDeauvp;(4trxnmr totop ranes t trto(opnudomte ivi ( arumxm nt4oex iictydfm rluvs u) rtnmf ootfptr n o;t)s2uo(o iudam nlneta(farrmumoot0opeo fetlslsDuln o ()arerio3iotfaDrauvs;t0trurim oudop e ivi ( srrrxm nt4aetomi3tlslmDuln onu0tlermr3iytfm elnesl(0 rxmiopiodom  mfctlt) rtr(r ;o0oltomiciydfm2ulu o;(4texrir oo1lmtranvsl(0s2um(o no1omeelfet ( arrrurpoo4aex io3ilsla2rl( pn(4 exomocto1omtr nes;t0t2tr(m3iu1openlfeta()artm(monu0tptn oetadlsDemn o t) exoxo oatoate ueo;( s2tmxm3iy4omeemiet s) 2rr( pnt0apx mociyd aDuauvo t)altoioctytomDrln o;(  etm(r3nu4lmte fesls)sDraxm nu1oet ifciaslmDrau s t4 eeomo todomtraneols) etoxm iu4llt micsl()aDtmumont0oee mi3iadla umums;(0tlxoif3ia1fmDrauesl() rtrir oydaltnmfcsls aDtmxrpoo4olto ieilsfaDean onu4 exoir totoaD  nvi;( srxoiopny4lp elfvils sDtau  nt1aetoioeiatls2rlnvsn(0 ltnir ootlpDrluvilt  eurio ny4opeelict (faDraxrono4oltomf3tyt mDuln onu) rxomr3tytop rauesl()truo(opoy1ap  livsl( srraxmo;u0teeomi3ildfmDelums;u)artnmf iadfmte ivil( s2urxr iudlm nmfcsat  rtax  ;u0tlt moeiysls2rmuvs;()alxnif3todfp rauvol()setoir3ou4ameelieta()s2trumono0tet iieiaslm ra(vo t4 lermo io1fmteaieo;( trurimpiu4lmen ncta( arra(r ;u4tltn feiaslsDeaums ()tlerxr tytlmDelnes ()s2xrimpio1ap emfet t  Dur(rpou0optomf3iatfa ul(vs;u4aetrmf ia1faDrluvi;t)trtrirpno4llenmfetl( srrmxm ;u0opt  f3iltfm2ra( pnt)areomo ia1fmDe nei;(0 etr(o3nudom  mnctatf rrm(mono4tltnmo3ilsfa eaumsn(4alxnxo todlatrai s;t teuoxr3oo4om emietltf rumu  nu1oltomictydlaDemumsn(0aeeoxocta1la eaieo;s trtr(opiu1lmtn nvilt) 2ur(rpnt0texo ociat m2rm( o () reomrciytfmte n ol( s2uoimpnu4lpt mfvsas sDum(rpot4oltnii3tadlmDuauvp (4tltoif3tytfatelues;(0teumirpny4lpenmieilt  rtmumpno1tlx mfciat m eaums;t0tltrmf oy1fmD an o (  2tr(o nudalt  fei t  2taurpoo0ope io3tldfaDul( p;t4 renif3tatoaD  uesl()trxoxm iy4omen ivi tf 2umurono0tee  ieiatls ua(mp (4 eeoir ty1omD lnesl( t2tmxo3nu4lp n ivt sfs2rmxmp;u0opxnmictls mDrluvo;t) ltnifcto1oaDelu s t t2xr(m3iy4alte fei s s2ta(r ;u0tex  i3ild sDumums;(0alerxo iatfatranvs;t0tetoio3iydalt lietl(fartrumpnt4tlxoio3iltls ul(vp;t0aexoio iatoa ranvols seuoxm3nodalte nvs ( arururonu0tex  oeiatfm2el(vp;t4aeenif ootfa eau ol()s2xo(m3no4op   netltfs2trx  nu0oltomi3ils m2ra(mo t)trtnmf oadlatraueols0t2tmxo3oo4om elnet () ruax poo1teen f3ildls el(mont4arenxfciy1lm e u o s)srxmirpnodamtnlnvi s sDururp;u4oetnio3iad m2ua( on(4tetnir todoatr n s ()t2umim iy4al e nes ()aDtru  nu4olen fctlslmDuan sn()trxnio3oodop r u s;s  etm(m3ny1alenmici s a2rm(  no4tpe ioeiyt a2ulu o;t0trenmociydla r nvils0t2um(rpoy4apenmnes s)artax  nu0opt  feiasla uanmonu4 etomo tydop   nvsl(0teto(m nudoleelnvsatfarrm(rpot1tlxnmf3tlsfm2ulumsnt) etrxfctatomDeauei ()srtmiopnu4ole  ivsas)srrmx p;t4ale io3tydfaDrln s;(4tlxoxr3iadomDrauvols teum(r oodol nmivtl( a2ua(  ;t0aet moeiaslm elnvs;u0aetnio3tydlm eanvsl(0 rtrxm no1ale  ictl(f 2tru  no1open oeiatlsDrlnvpnt0aetoxf oytfptrauvs;s t2xmxo3iydoltnmfci s a2tmumpou1tptomiciadfs2emnmo;(4teermocoatlate i i;() rxmio3oo1am nlnetat)artaxmpou1opx mictysfm ulnvs;t4alxnmf ty1lmt  uei;( texrxr iudll  miet (faDrrumoou0tltniociyd a em(mo;()trxnmrciy1lmteauei;s  etoio iydamtnmfei t) 2tm(mo;u4tetoii3tyt a2ul(mpnt0tlxoiocio1om rlivo;s seuoxmpno4om  mfvias  Dua(rpoo4altomi3iyt m2ua( pn(0 ltomf iydop rau o;s  ruoxo no4alenlivsl(fartm(  ;t4oeto f3iytfa2eau s t4aetrmf3iydopteai i;(0s2xrxr3no4lp  licil(  Dtrxrpnt1teeoiicilsla2elnvs;(4 lenxf iytop rai ilt0t2xoxo nydlltnlicta(  Drax o;o4apxomfetys s em( p u0aexnif tatlmteaivils)trxrxo ou1ap elnvs tf rtmurp;o0ape mieiad a2elnms;(4 exrir3oadoatrluvils0srxoxmpio4omeemncia( arumxrpno4oee ioeildlm rlump u0 eenio3iadfm elieo ( seuo(rpno4ap nlfvs s aDurumoou4aexnmictyd s uaumo t4alxnifcoo1lptelneo s)sexrxmpnu1op elfes tf Dtaxm nu4tpto i3iytla umn sn(0tltnxr oy1lmtean i s0trtoxr nu1aptnmicsat)s2tmxmpoo4oexomieildla ulu pn()alxrif ootoptr n i;( srum(o3nu1lltnlncsa(faDuru p;u0tpt  oetlt s2ul(von(0arxnmr3iy1lmD aies t) 2toir nydalenlnciltfs2taxm no1aeeoii3iydfaDumn sn()tlxnxoctotla rli o;t  rxoir nudllte fci s)a2trur ;o0aeeoiieilt mDem( snu4 rxnmr3iotfp   nvi;t0s2xmiopiu1ll e fvs ( s2uaurono1opx mo3iadfa ul(msnu0 renmo3tatfmDraneolt0truo(mpio1om  mfet sfarurxmp;u4aetomictlsfmDuaumo;u)texoxocia1oaDranvo s0trtrimpio1lmtn ics sf rum(mooo4olen ociys sDean pn()artrmocoatoaD  i ils0 exoxrpnydopen nviasf 2taump;u1tpxomoetydfm2em(mont) ltnmocoytfmtrln ilt0srumxr iudom nlfes t aDrrxmp;t1oetoii3iytfs rlums;u4teenir iytomtr nvi () 2xmxo3iudomtnlfei s a2rau  ;o4tetoioctydfs uau s (4teeomfcootfa   i o ()trxr(m ou1ap eliesltf 2taxm nt4aetnmictys s ul(mp;(0texniocoy1faDrlieil()teurir no4oltnmivi tfaDraxmpno4olt mfeiydfsDrlnvp;() exrxo3tydopD  nvols s2xrxrpno4ll nmneslt  ruax pnu4optoifctydlmDrlnvpnu0alermf iadoaDeaiei t  2tr(o3no4ame  fvsltf rtmxm ou1tleomocias sDra(mo;u0 rxrxfcto1optelnvs;s0setrio3ou1olen nvilsf Dtr(  no4tpeomo3ildfsDea( o (4artomociydfaDe ivs;s) rurxr3oudamte netlt)sDum( o;o1tpt  f3ias s2rl(vs u0 etoif tytomtelivsl()srur(m iu1am nmfcs ()s2umu pnt4ole  o3ilt m rmnmo t0 ltrir3iadopDr neols)t2xr(r3ny1ole mivil()srur(m ou1oetniicilsls2rlumpnu4aeeomocoadlp ranvols t2tmiopny1ale  fviat)srua(mpnu0tleomoeiasls rl(von(0alxoircoytlate ueo;(  2tr(m3oo1ape lies (faDra(  ;u4ope mieiytfsDra( s;t)aexnmo to1laDr nvs;t) eumxo3oo4ame livtlt sDuru  ;o4ope  ociadfaDrauvp t0arxnmo iatopt lneols) 2tmxr iodlpt  ict sfarrr(mp;o4apx iociltfm ranmsnt4texomfcia1fatraueslt  ruo(r oy4aptnmncs t) Drrump;u4tpxnmo3tlsla2uau o;u) rxnxf iytom  auesls0tetrxm ny4lm  mfeta(faDumu  ;t4oetniieiasfa el(mp (4 exnmfciadfp e ivo;()t2urxo oy4lm   fetas  2ra(m no4oltomo3iytlm el(vp;u0tltrxf tytlpD  uvol()s2uoxrpoo4lpen fct s sDumu ooo0texn fetldfmDul(mp u)trxrmfciotlm  au i t0 rtrio3oo4lpt miei ( aDtmx  ot4olxnmieiatlm2rlumo t0tltomr io1om  anei ( teumio oydlptnlics ()sDtrur ;o4apen ietasfa eanmont4trtoxf oadfaD lies;( texrxr nu1lm elnetatf rraxmpot4ape ifeiytfsDuan s u4arxnmociotlm   ivo;s) 2xrim nu4llenlivi t)a2urur ;o1tpt if3iytfa2emn o t4artoxo3todopt  ueil()srur(o3no4ameemncs sfsrtrxrp;o4apt ii3ilt aDua(mo;t0alxnxociy1fpDr uvi;(0 rtrxo ny1lpt  fcsls) Dumxr no1tleomieiyt m rauvo;u)tltrxo tydomteli s s)seumxr iu1apee ies s a2rax pou1tlxnmieiadls2em( p;()arxrxrcoatoatr n sls  rxrim3iy4om nmnvi sfa2ua(mooo4olx mo3iasla2rmuvs (4texomo3totla   i i;s texrxo3nu4lmte netas  Duaur nt1aeeniociaslm2uanmo u4aexrmocoodoa elueils0 2urxo3oo1alt mies s)a2tm(ro;o4oltniociysla2el(mpnu4arerxociytlatr i o s0t2xmxo io4apee ncils aDrau o;u4tpeoioeiyt a2rlnmo u) rerxo oy1fmt aies;(  etrxmpnodaltemnvsas s2tax  ;u0aex ifeilsfm2ranvs u4altnxrctodlmtr i s;(  etrirpnudameelfeta() Drrx  ;t0aeen oetldfs rmu p u0 rtnmf iatlpD lneo (0srxmxm3iydop nlfeiat) rur(  ;t4tlxnmfciyslmDrm(mo (4aeeoxo iodomte ivo;()s2xrirpiodap   net (farrr(  nt4tetoio3iasla eln s;t) eeomfciotfpDe neo s0s2xmir oy4lmtelfcs (  2tm(  nu0aeeoii3iatfs2uan p u0 reoiocoodoaDean s () rtoxopny1am emivs s arumur oo4oee mfciltfm2em( p;u) rtrxr3tatlat ln ilt  exmimpoo1olt mfcsat)aDrau ont1tle mo3tlt a2ea(vsnt4artrmo tadla  aieslt  euoxo ou1apt  ietasfartrum ot4oeenmfeiysfm2em(msnt4 reomr totlat an ils0 exoir3io4lptelncsas srrrump;u0tpe moeiys m eanmpn(4aexrircoatfat an ils0sexo(o iu4lm emfesat) 2tru pnt4opxoii3iyd m umu s u4 eeoxr iotfm eau sls0trtr(rpiudlpenlnei sf Duaumpot0aptoiictyd aDrln p;t4 exoio3iotlpteaivi s  rxmio3nodol   fet ( a2rax o;o0aeeomi3tadfa2ua( o t) rtnirciotfaD auvi;s) eto(rpiu4am n ivt s)arumu ono1teeoiietas s2ea(vo u)tltrmoctydopte neils)sexmxr3iu1ol   fviatf 2tmxr ;u4apx iociatlmDrluvp u4aeenxo oydlaDeauvi s s2tm(mpnudop emfeta(fs2ua(r nt1aee ifeiad s2rln s;u4 etomoctatlat  ivo;() 2ur(o io4lm   ivtasf 2umumont1tltnmictlsls elump;(0tlerxo3iydlaDeli o t)sexoirpio4lptnmieil()srrr(monu1alt  ieildfsDrmu onu4trtnio ia1fpte u slt)srxm(mpiu1alen fvils)a2taxroot1apeoii3iytfs2rlnmp;(0arxomf iotfaDr ivs ()srxm(r3ou4op  mies (fsrraxmpnt0olx  feiad sDumnmp;(0 etnir3tadlatrauvi;s trxmimpiy1om elfctasf 2rm(rpot4tleoiicildfs2rmnvonu0trxriocoadfmDr n sls  exm(m3oy1llt mfviat s2tm(mo;o4oex  fciasfm ea( pn(4tetrxr3ootlptrlueolt  exm(opou4am elfeslt)srtau o;u0tex iieiasfaDelu p t0 ltnxo oa1omDe nvs;(  rxrxmpnu4lmenmics ( a2rax  ;o0tet  fciyd m rln s ()alenif oadfmt lu s;s  rtoirpoo1omtn nci sfarrrxmooo0aetomicias a2rm( s t4 eeoxf oy1oateaies;s) rurxopnu4amtemfes () Dua(root0olt iiciysfa uauvs u4 etoxrciotom   i ils)t2uoxo3iu4lmtelnvias)s2rm(ro;u0tpeoioetytfm2rmnmon() eerxo3tydfate ieo;s) 2umxm iy4lmt lneia( aDta( pnt0apxoioeildfs2ulnmo (4aeermf iytfateli i s0 2trir oodlpt lictas)artm(mp;o4tlxn fctys mDemnvs;u0alenirctadop  au i;(  etriopio1lme  ies s)s2rr( oou1apx  fetas mDelumo;(4altrifctodlmtr u s s tetmxrpiu4al nmncsa( srrmxm ot4oee  oeiat s2um(msnu0arerirciodfat  ieo s0teumxrpoodopeemivtatfsDraum no1tee  ieildls2eln p ()trerxrcoy1omDeli ol()t2urxopou4aptn ivsa() 2rrxmono1alxn oeiydlmDumnms t0texnxo3tadopDrlnei ( sexoxmpoo1lptelfvs sfaDra(m ;u4apenmicils sDua(mo (4altnio tadfp  lneo;s) eurimpiodlp e fetatfsDuaurpoo1tleomoeiadlaDrmnvp;u0 lerxrcta1fp rlu s ( tetoxmpnu1op emfctl(f rtrxrpou1aeeo oeilsfs2ul(mo;t)altnmf3tytfatrauvs t)s2xoxo3nudlmeemfvtl( srtruro;t1apxo oetytls rm(vs (4 ltrif iytom  ln i (0teumxr iodllt lfet s  Durx  ;t1tlxn i3iadfm2ulu on(4 eeoxocto1faDean olt) etrio iy1amee icilt  Duax onu4oleniiciyd sDua(vs;(4aexnioctadlate n sls0tetmir3oo1ape mnvsls a2rmu  ot4alx iicildfmDemu ont)aetrir oydfpt aneo;s) etm(opiy4opee ictl(  2raxrp;o1ole mfctatfmDemn ont0trtoxrcoo1oat  n o;(0seuoirpou4apeemivi () 2tm(r ou0alenmocild aDelnmonu)aeenmociytfaD anvi;() 2xo(m3nydlme lfctls  Dtaurpnt1apeomfctysls2umu o u0teeoif iodomD  uvo;t sruoir oydaptelnes s)s2tmu pnt0aee iietasls el(ms t4trerxf3oatlpteauvi;s0t2umxrpiu4apt miei s)sDraurp;t0oex  o3iatlmDeauvpn() eenxr3totlpD an i;t trto(o3oodll  miet t a2rrurpoo4alxoifeiatla eaumsnu)alxnif3oadfa rluvo;() rurxm iu4ll   fcta( sDrm(rpoo0oet  fetasls2eaumonu0alxrmf3ia1omt ln o (0t2uo(opiy4aptelneils) Draumpou1opx  i3ildls2ulnvs;(0altoxf oodlmt aieo;(  rxrxm oo4lm nlfct s)arrmu poo0aetnmoeiasla el(vp;u0tlxoir iatlmt ln slt t2xoim3ou1optelfciatf rrrxm ot4tlx  ociyd aDulu o (0trxnxociadopDelnvilt)s2tmxo ny1opt lfvi tf 2rrxmo;u0tlenifeilsfm2rau onu0altnxf3ootfaD au s;() eto(mpoydalte fvtatfarta(rp;o1aleoiicildls em(ms;()trxnxr3oo1lpt lnvols0 rtmxrpnodomenmnci ( a2uaxronu0aeenmictas a2rln p t) exoir3ia1faDrliei t0s2uoxr3io1lltnmnciatf 2ra(rpoo1aet mfctldlsDumuvs t)altrmo tydoat aueol( s2uoimpnu1alee nvtas)arumur ;o4aeenmi3iadla uauvpn() exrxr iodoaDr ivol(0 ruoio3no1op elfes ()srta( p;t0aexn i3iltls rauvon(0tleoir3oa1omte n i ( truoim3oudap emncslt) 2raxm ;u4oleomoctldfmDeln p;t4alxnir3ta1lp rauvsl(0texr(opno4opte nvsa(  rrruronu0tlt mietyd a rmn o t0tlxnif ia1fate uei s0 rtrio oo4ape livsas  2umxmp;o1opeo ieiasla2uaumsnt)aeenif3ta1omt lueo;t0 rtmxo io1om nlieiat sDuax oou1teenioeiat s ea(vo (0trenxf oodfaDeanvsl()s2uoim3ou4ame mict (faDtaur ;u0tex  f3tlt m2ul(vont0 ltomf3oydlp elu s;( srtrim3nydlleelnetl()a2uau pnu1open ocilsfsDumnvsnt)tetnmfciydlat  n sls0 rxoim oy4ll n iet sf 2um( oou4apenifctltfm rau o;u0aexniociodomt  iei;(0setr(opoy1optnlfvsl(  2uaumo;o0oeeoiiciadla rluvs (4aexrif3ty1fa e n il( tetmxo3ou4apt mfvsas  Drmumoou1oex  octld m2eanvp;u4tlerir3tatfmD lu il(0s2xr(o3nydllee fcilt) rrrx  ;o1optoii3ias m2eln s t4artrxocoytlmDranei;s0trtmimpoy1ale lnct s aDur(mpno0teeo fctatlm2um( p;u)artrmr tytlmtelivi;s0trurxopoo4apen fvsa(f 2rr(moot4optoif3iys aDrmu s t4 rtnxrcta1lmD  uei;(0trur(opoy1ap e iesl() 2urxroou0aet  ictydls eanvsnu)artnxr3tydlptelivs;() rxoxrpio4omee nvi t) 2ra(mp;o1aeenioeiadfa ulnmpn(4tleoxr oadfpDelivs t)srxr(o3nodopt  fvsatfs2urxmp;t0tlxnifctydlsDelu snu)tetrxfcta1omtrluesls t2toxr oo4lmtnlneils) 2um(mpno4opxoioetaslsDean onu) rxomr3oytomt lnesls0srumxm3ou4oltelncil( srrrur ;u0ale mi3iad sDumumo;u0aexrifctydlm   n o t t2ur(r3oodamtnmnvtl( srrau ono1tle ioeilsfa ul( pn(0 etoif3iodoateaneo;s t2xmxo3io1lm n nei t)sDtaum oo0oleoiiciyt a umump;(4alenmrctadlmDelivi;t teum(r oodolenlncsl(fsDuaxront1tee iieilsfa umn s;(0altomo tadlmt  nvi t)texmxrpnudame  ictls)srumum no1apt mi3iaslm eaumo;t)teerio ootoa eaieolt s2xrir ny4lmenmfciasfa2rau  ;o4tlxomociatfs umnms;u) exomr3oytoa   neo;t) rurio3oo1al nlict (  Dtau  ;o4tpe mfetys mDrau p;u) rxnxr3oa1omt  ivo s) rxrxr io4op elfvtlsfa2tmumo;o4apenifetydlmDuanms;t4 rxnir3oadoptrauvs;(0 euo(o oodopt lfvils s2rmxmooo1alxnmf3iad s2elums t4 etnio iy1lmDe n i t  2trim3oodal e nci (fs2rrxmono0aleomo3iadfs eau pn(4 rtomo to1lat lu s;t) exmir nu1op n ncs tfaruaumo;u4tpt iociydfa uanvo t0arxnio oy1latraivi;t0 2toxo3no4ope  fciasf ruauro;t0oet  oeiatfs2ulnmon(4 lxnmo ia1lm r ivs;( srxr(r oo1am nmnei s)arurx pnt4olenmfciydlm2rl( s;u)artnxo totlmD lu il( tetr(rpio1lm n ivsltfsDta( pnt4oeeo oeiatls2rlnvonu4 rermo oatlp  anvilt s2tmim io1om nmnvilt)a2tm(rp;o1tee iictytfmDum( p () reoircoytlatelnvo;t t2tmio nudopenlfvs sfs2ra(r oo4opxoio3tytla2elnvs u)artoxf ia1oa ean i;s s2uo(r3no1opt  ieslsfs2raxr ;t1tpeoii3iytfa rm(mpnu4tltomr tydop  luvi s0 rxr(rpio1amt mneta() Drrx poo0oltn i3tldfm2umn o u0aleoxr todlaDraivs s0trtm(m nu1omt lnct ( a2rr(rpoo1tltomfctyslmDrmn o t4tleomr iatop  lueo;t sruo(opiydlmtelicsat)a2tm( oot1tptomoeiltls uaump u0altomf ta1latelivil(0 rtrio nodoptelicia()artm(mpoo0aetniiciatfa rl(mo (0arxoxrcoatlp elnei;s  2xrim nu4aleemnvta(f rua(mp;t1tetn oetldlsDua( p (4teerifctytlptrai i;( t2xoxopnu4omte fetltf Drau  ot0aptniictytla2eln p;u)tetomfcoo1lmte neil()setrim3io4am   ivsa(  rua( p;o4tle ioctys s eaump;t4 lxnirciydopteai o (0 etmxo iodlm e ies (f Drax o;t1oltnif3iytfm uanvon(0 rtomf3ta1op eai i;s trtmxopno4altn fcia() 2ua(m no0aptnmiciltfm2ea(vpn(0aetnxo to1fp e i ol(0 eurir oy1omtn nes t)sDrrx p;u0olto fciydls em(vp (0texrxrciydfm rlieilt0s2xm(m3oy4omte fvtat) Dtmurpno4alxn ieiysfm2uan o u4 lxrxr ta1fptrauvol(0seuo(m nydop emict s aDum(rpoo1apx mf3tatlaDrlnms;t) etnxrcoatoatrau ils0 rtm(mpiudame mfvt (f Dtmu  ;o1tpxnmociad mDrmump;t) rxrxo3oadopt lnvil() rtmxr3oydlptnmnesls)s2uau p;u0tee  f3iyd sDrl(vonu)altoio iatoaDran ols0t2to(m3iodomtemivtatfsrtr(r ;o1aex moeiydls2rau p;u)texoxocty1faD aneols t2xo(r3iy4opt lnvil(fsDraxmp;o1oetomf3tatla rmumsnt0aeeoxr3oadfaDr ivo (  2xo(o iy4opte nesatfaDtmx onu0aptnmieiysfsDrl(vs () rtoircta1lmD aneolt) 2uoxo3ny1ole  nvtat) Drru oot0tltoifctatlm emuvs;(0 etriocoodfp rlneolt0sexr(m oy1olenmnciatfsDrax o;u1oleo ictld a rluvsnt4texnmo oadlmtelu i;s)trtrxo nydll n nvtat)s2rr( poo4tetniociat m eluvs;(4artoir todom eaneo t)t2umxo ny1ol  mivias arrm(r oo0tlenioetatfaDra( ont) exrmf iadomtraues;s srxoim oo4llenliviltfsrrr( onu1ale iiciatlsDra(mo;()arenxrcoa1op  livilt0trurir iy1apenmnvsl()artm(m oo0aleoifeiysfaDemuvo t)aleoir iydopDeaues;s0 2ur(r3iy4lpe  nvsltfaDurx poo0teeomo3ilt a uaumpn(4tlenir3ty1fatraivolt) eur(m3iodllee nvtltfarur(rpnu1aeenmoeilsfs2emnms;u)areomf3oydom  lneilt)srxrxm nodame mfvtat)arrm(m oo1teenmfeilt mDrlnvpnu4 rtomo3oo1oa ranvolt t2xmxmpnudomte fvtat)s2ururooo0alt ioetaslm2elnmp;u0aeeoio3iodlat an ol( teumxr io4om   fesa(  Dumxrpou4tptniictad sDumn s t) renmf iytlpt  u ols0t2ur(opiy4olt lnvtlt)artm( pnu0alxoif3tasfaDem(vs u)aleoxo oodfpDeaues t  rtmxm3oy4ap  mfvta() 2rr(monu0tetnio3taslm rmu sn(4 lxrmrciadfm eaies s  rtmxrpoudal n fviasfs2rmxro;o0texnifctytls um( pnt0aleoirciodoa  aivo;(0 2xm(opiu4apenlfct (  Drau o;t0alen octatla2emums t4 exoiociodfateai i s t2xr(r3nudaltelfvslt)a2umur ;t0tlt  ieildls emn ont4alxoxf iatoaD aneo s texmxr iy1oltn iet s) 2trxroou0aeeo ictysfaDranmon(0 ltoxf to1omtrlivs;s0s2tm(mpoy4altnlnviatfs2um(mont1olx io3iytls2eluvp ()texnxr3todfate i o;t sruo(rpiy1am e netas)aDrrx o;t0texoiictldfs2elumo;u)aexrxf3oatlaD aiei s srtoxo3no1ap e nciat) 2rrxm ot0apto oetldfm2emnmonu)arenxo ty1lp  au olt) exoimpnudom  mnvi (faDrm(m ;u4tetn oetldfaDul( snu4teermr3iytoaD lnvo t) rtrir no1lp  liei s)sDrrx oot4olx moeiatls2rl( p;t4tetrxociy1lmt lueo;s)s2trxrpoydoptnmnvtat aruaurpot1tptoiieiat s rauvpnu0 rtrxr3ta1op raiei t srxm(r3nu4omtemfviltfs2rm(ro;o4texnifeiysls rlu onu0 lxnmo3to1opDeaivs;(  2xrxrpny4amt licilt  2umxrooo4alxn i3ildfsDeaumpnu4 exoxf oatom  luesls setoxo iu4lmenlnct (f Drm(m no1ape ifctys mDuluvsnt0tlerio tadlp  au i t s2to(o3oy4ome lfvs t  2urxm oo4tpeoioetldfsDea( o t4trermr io1lmtrluei () rtoim nu4amtnlicias)arrau  oo1oltomoeiltlm raums;u4arxoxo3ia1fa  luvs;s)tetm(o3iy1ole lietatfs2tax ono4tptoiociyt a2ul(vsnt4trenio oa1op raivsls) exrxo ou4ap   netl(f 2uaur ;o4oleoifeild m rl(ms u4tltoxr3todom rlues;s)trto(o3no1opt  fvs ( srururp;u1ole  i3iydla2emnmonu) etoxr tadlatrluvs;s  2um(r iydape  ivsa( sDua(  ;o1oetn o3ias s2elnvo u0arerif todop rluvslt0s2urxo3iy1ole lieta()arur(rp;o4oetniietytla um(vo t)alxrxrciytlmDrli s;t)t2tmxo3io4lmeelfeslsfaDuaur ou4olen i3tytfaDrmnmo ()tetoif tadfp   uvslt)s2xm(m3ny1llenmfvia()aDuax onu4tltoiiciyd s2emuvs u)arerir3iatfpt lieolt seurxrpnu1amt mivt t arrmu o;t1opxoiocils m rm(ms;u)arxriocoytfpteluesl(0setr(opoudal nmfetlt)a2um( oou0oleoiieilsfa2umnmp t) lerxfcio1laDr ivo s0srtm(r3iu4lmtemiviat  Dra(m ;o0opeomieiydfsDranvonu)aetrxf3tadom r nvslt) rumiopiydolt lnetatf 2ra(m ot4tpxnmo3iydfs2emu pnt)arxomr3tytoaDr n olt0srxoiopoodaltemnvsas  Drmu  ;u0opx if3iytls2uauvpnt0 rxoxocoydlmDeai i (0sexr(opno4aptnmnvils)aDrmum oo0tex  fcilsfa2rmums;u4 eenxo3iatopD aueslt0tetoxmpiu1ll elnvia(fsDrmu ont1aeeomf3iytlaDum(vo;t0 rtrmf3iydfatelnvol() exmxopou4omen ncsltfsrtmxm no4tex  ieiyt a rl(vsn(4 exnio3oo1lmt  nvs;t  2toxo3ou4oleemictltf rtrurpot4aexo ietatls umu p;u4treoif oa1fa eaivo ( srxoxr3ou4ol nmnvi s)s2tax  ot0tle  oeiadlsDuluvo;(4trtoio3oo1lmt ai slt srxoirpiydap elicsas srrrur nt0aetnmoeilsfs2el( o;t0aeermo iatoptrauvi (0trur(r3nu4ope liet ( a2rrumpno0oex moeias aDul(vpnu)aeerif3ty1om  li o s trxoxr3nodopte ieia() rrmx  ;u1alxn oeiaslaDrmnmo;t0aexoif iydfm  anvils  exo(mpnodlptnlictat)sDra( onu1tpxoifeiltfaDranvp;u0tetrif3oa1fp  aueo t)tetm(r iu1omte fet t  2uru  ;o1tltnii3tat sDrln s (4artoxoctotfmteau i s0t2toimpnu4ol   fvs s)aDua(mpoo4tlt ii3tldls2umn p u) exrxr oytfa eai o;(0srumxm oy4alt mnvi (  2rax onu1altnii3tatfsDel(monu0aetoxo3tytlmDeln o ()teurxrpou4altemfciasfsrrmxroou4apxoifctytlaDrmumo;u0trtomo ootoa  aieslt0setoir nu1am n ict ( sDtm( p;u0ope mocild s rlnmont0arenmo3oo1la r nvs;s0sexoxo3ou4am   feiatf Drax o;o1tlxomieiasfm2um(vsnu) rtnmf to1fmDr neols0sruoim iydalt mivs t sDrm( o;o1oetnmfctys a2ranmo;t) lxrxr io1fp ean s ()trtrirpiydol elicils aDurump;o1aetomoetlsfs ulu pnu)tlenxrciydfatr nvo s0srxrxm3oydol nmnvi s)aDtaumpnu0olen feiasfa ranvo u)alenmfctotfpDrlneil( srxriopoy1apen fesas) rra(roou4aeto i3tltls2ea(ms;u) rxrxo3iy1om   ivi (0seto(o oy1lmtn fviat sDur(rooo1apxo ieiltfm2rm( p (4arxoxrcta1laDran ol(  2tr(mpoo4op   ncsls)arrrx poo1olto i3iasla eln onu4altnif oodfpDr ueo s)srtmxopiydamt mfci (  2um(r ;u4opt  i3tld mDumums;t4 ltrircoadlptrauvs;t trxoxo iu1ol eliesas arurx  nu0texo oetytfs2eau ont4arxrmr3todlateauvols)srxoxopio1al nlfcil(f rum(  ou1tpx ioeiadlm eluvs;u4 lermf iotomtranesls srtmirpiy4lpe  nvia(fartrxm ou0ape ifetld mDrlu p t4arxomocoytlmtr nvo (0trto(o oy4olte ivta( aDtrur oo4tlx mo3iasfsDrlums;(0 etnmociadfateanvols)t2to(m nodop nmneiat)arta( poo1teenif3ilsla rm(mo ()altomf3iodfaDeli slt)s2xrxmpiudllt mfcsat)a2rmu  oo0apxoiieiasfa ua( snu) rtrmr oydlate u o;( s2urio nu1lpenlfciasfs2tm(rpno1aleomoctatlm rmumpnu4 lermr3oo1fpteanes (0srur(m3nu4op nmivt t  Drr(rp;o4tltn i3iasls ran p;u0tltrio ia1faD lnei (0 2urxm iy1ome mivilsfaDtrxmp;t0oltomf3iydfsDrl(mo u4artnmrcootoptr iei (0 2tmirpiy4lmee nes sfa2ururp;t1optoioeiysls2emn pn() etoxociotfptelnes;t  etoir ny1llenmfeil(fsDumx p;t1oexomo3tatla elu s u) renmo3oatfmDeaiei ( teum(rpny4ll eliviat)arum(mpoo0tee  fciadla uanmo;t0 lxoirciydopD an slt0t2toxopoy1apte ieilt  Dtrurp;o0aex if3ias sDemnvs () exnxr todfpte n i;s  2xoirpnu4ll  mneiat  ruaumooo1tet  i3tlslaDra(ms;u4tltnxo oydoa eai ols srtoxo oo4openmncilt s2rrxr nu1oee mi3ilt aDuau p u4tetnmf3oy1fp r i ilt s2xmxrpoy4amteliesat)srraur no0tpxoiieiydla ean p;(0alenmr tadlateaieol()t2umio3ny4lm e fvia(fsDtau pno1oetnifeild s umn s (4trxoiociy1lpDeaivo;s sexrim iodoltn ncsat arrr(moou4olxn ociad sDelnvp;u)aleoxocoo1opDeau o;s0s2urxopoudlle mictls)srrru poo4opt  iciydlmDrauvpn(0tetnio3iy1lptrlieo ()trurim3iy1opt mfeias  rurx pno0tpt mictydfs eln p t4 eenio3tatomtrau olt srurxo3no1ole mncilt)artrx  ;o0tpeoioetydls eau s u0tetomf ta1oatrln il(0tetrxm oodlltnlfvsl(f rur(rono1apen o3ilsfsDulumo;u0trermo3tadopD ln i (0trumio3ou1lleemfcsl(fsDtmxro;u1tpxniieiaslmDeln p ()arxoxf3iadfptelnvil(0 2trim3ou4omt mfvsl(fsrtr(m ;u1aptn ieildfsDelnvs t)alxnxfcootfaDeau o ( texmxr3no4lme  feta(fsDrr(  no1aeeo feiadfs2ul(vo (0texoxf3tatlatrli o s) 2umxopnydllt  ivtl(fsrum(rono1oetnii3tlslm uanmo u4 lxomr iadlatrlu o s)srtrim3io1lptnmicsatf Dtm(mp;u0ope ii3tasfaDra( s;t)arxrif todoate i sl( s2tmxmpoydame miesa( s2rr(  ot4tpxoio3iltfm2elumsnt0aexnmf3oatfmDr neslt0 2urxmpou4apte icsls arumumo;u0altnmi3iadfm2em(vp u0tetniocta1lm rlu ilt)trxrim iu4omenmics (fsDtrur ot0ale miciysfm2ua(ms u)aexnir3oatopD lu s;t) 2umxo iudlme  iet t) 2trx  ot0opt miciytfa2uaumpn(0 rerif ty1om rlnvilt)srtoio3no4amt lnvt ()arrm(rp;t0tltnii3tlslsDul(vo;t0 rxrmo3tytfaD au ils s2tm(rpoydap nlnvsltf rumx  ou0tpenii3iyd mDumnmp;t0tlenirciotlm  auvi;()s2xoim nodolte net tfsDtmxm nu1ope moeiadfaDemu pnt4 reoxo oodoaDraneslt)trxriopoudomtn nci ()srurxrp;u4olto feilsfaDrmn onu0treoifcoodfmtraivo;t trur(r iy4apt lnciatfsDumu o;u0aeeoif3tyt sDrlu pn(4tltoif3oodlmteauvolt0t2urxrpoo1lmenlncsas)srua(rpnt1tleniictatfsDulump u4tlerir totlm   ies ( teur(m3io4om elfcsa() rua( p;t0apxn feiltlm um(msnt)altnir3oatlaDean i;t t2trxr3iu4lmtnmncs t srtrumpot1aetoioeiyd s rm( onu4 ltnxfcoytlpDrauvs t s2tmxr iydlmenlieiat  rrrurpno0tex mictadfm um(vo;t4teermf iy1omtraueo;t trxr(o io4aleelivta()srrrumpot4tpx  icildfmDranmonu)tetoxf oa1opDeli s;s t2xoxr iu4apen ncsls)artrxmpot0tleoii3tldfa ra( s t4aetrmr3io1fa rluei;( t2xm(opoudapte fvtl( sDrrur ;o0aet mi3tytlmDrluvp u4aetoxo3oadlpDrau ils  rxrxrpoo1omte nciltf Duru oot1tlx mocildla2rl(vp u)teenxocoy1fatrluesl(0sexoirpnu4llt mfviltfsrrrxr ;o1apenmoeiadls em(ms u4 rxnio oydfmtrluvs;s0 rtrxopiodalt livs sfsDumxm oo4olxo oeiydls rln s (0aexoirctodlaDeai ol(0srto(m nudolenlivt tf rurxmpnt0tpxo i3iysls rm( p;u0arxrio oatomD  u s t  2toim iy1ame  fesa(fa2um( ooo4aptnmiciys m2elnvo u) etomf3iadfmDe ivsls)sexrxr3iodoleelfvslsf rtrxm nu4aetnifctys mDrmnvon(4 rxnmo iydomteluvi;(0s2urxm iy1ll e feiatfs2taxmoou0ale ioeiyt m2ulnvonu)artrxo3iytlmtrlu olt0sexmio iydap n icsat a2ua( pot0aleoio3iydfs2eaump ()arxomr3iytlatr i sls0tetr(o nodamtelici t a2um(m ;t1opx  f3tld s eluvp;u) rxnmf oytlmte ieo;s srtr(m3no4ape mnvtl(f Dtm( o;t0apx mociadfs rluvs;u4areoif oa1lpDeaiei;(0 eum(opou4om   ivsa()aDurxmo;u1ale mo3tasfa2rauvo;u4 lermr3ty1optean s t  eurim oo1aleemiet t)a2trxm ;u1opxoifctydlm2rlums u0trxrir iy1lp elueol() eurim oydameemivi ()s2um( ont0oexn fctasfaDranmon()texomo3iotfm eanes (0 2xoimpoy1ap elnvt ()sDua(m ;o4alxnmfciydla em(vsnu) ltniocty1fm   uvo;(  rxoxmpio4am nlfvtls  rrr(mo;o0oltn o3tad mDeau p;u0texoirciatlp rau i ()teuoir3nydlmen icils) 2trumpno0oexomietldlsDumumo () eeoxr3iydomDeluvsl()trtr(m3oo4amen fvtas a2taur nu4aetomo3ias s rl(msnt0alxoir3oy1late neo;t texrir3oodll   nesls s2rau onu4alen o3tltla2ra( sn()altoir3tydom  anes (  eurio3no4lmtelfetlt)srumxrpou1tlxnmoeiadls2rmnvp u4aetnmr3iy1oa   ies;()trurxm oydaltn ietasfa2uaurpoo4olen octat mDelumsn(4teeoxr oa1oa e ivilt srtoir3oudam e ict tfsruaxm ot0tpxo ieiad mDua(vp;(4alenmo3oo1omt ln o;s0teuoxr nydlmenmnct t aDuru  ;t4tptomo3iytla2umums;t)trtoxo3todlmDr nei t srxriopoodam  lnet sfa2raum ;t4tlx if3tas a umn snt) ltoxf iytfp ran olt trtmio iydop n ncsatf rrmxm oo1tlx moeiltlaDrmu p;u0teermr iadfptr i o;() etmiopnodame mfvi sf rtr(m ;u4opxniiciyd a uanvonu4texnxf iydfa  aneo;t srxrxrpoy1lpeelfvtltf rta(mp;t1oeto fctydlsDeluvonu0aetoxo3oydlat li i;t)seurxr3oudomtemicsa(  2uaum oo1aeeomfeiys aDuluvo (0 eeomf totomtr i ols)seum(rpio4ope  ivt t)artrx o;o4apxomoeiysla2eanvp () exoxf3iotlm  li slt)trtm(r iy4lmee fcsls  rtm(m ;u4tleomiciys sDea( onu4tetnmociotfa elnvsls0 eurxr iudalt  fetas)srumurpou0oetomi3tls a2elumo;(0trenifctatlmD luvslt srtmxo3iy1am n feiat  Drm(mpot1tex io3ild a ranms;u)trtnxf3oa1om r nvslt  exmir nudapen fcs t) rtmu pou1opxn ocilsfsDel( p t)trtoxf3to1fp rai o t t2xmxm oodopeelncsas)aDtrumpoo1tptn i3tld aDrlnvo ()trtnio tadfmDrau slt t2umio iu4ol emncil(f Drrxmonu1opx  ociltfsDuaumsnu4trerif iy1lmDe uesl()srtmxr3iydlpenmicsat arraxrooo4teenmieiatlmDeau p t0 ltrxrciodfateluvo;s0 rto(r io4lmtn ics t sDurxmo;o4opt ifciadfm eaums ()arermf iy1fmtrlnei s)setr(o3iy4optelfctlt a2rr(mo;t4tee  o3iltlsDem(mo ()altnmfctytfat au o;s) rtoxr3nu4op   fct t) rtmxm ;o4teenmietldlsDemnvp;u0 etnxf iodlpt luei;s teum(rpiodlleelictls)arrm( o;t1apt  i3iydfa eaump (4tlenif iy1opDrln i t setoim io4lptn nctas)srrmx oot4oltomfctasfm2uln p;t4trenmociotfa rln s;s)texoim3iy4llt mfct t) 2tm( pnt1alx mi3ilsfsDrau s t)aexrxo3oydlpDrlneilt)tetrim oo1omeelfciatfsDtm(mooo1tltn fctasfmDrlnmont0alxnxrcio1lmDr uvils  eumxr3io1ol  mnciat)artru o;u0alxn ieildfs2ea(vpnt0aeenxr oadom r u s;()t2toio3iu1lptn ictl( srrm(mp;u0oet iieils s2ul(vs u0altomf todomtraieslt  rur(rpnu1alte nvia(fs2raxmpoo1oet  f3ildfa rl( s;t0trerifcoo1fat lu o;t) eum(m3nydolt lics s arua(mpnt4ole ioeiasfmDuan on(0tltnifctytlp r nvsls0s2tmir no4lpeemncil( a2ur(roou4tlenio3iysfm2rmu s t0texnif oy1lm e u ils) rurxmpnudape mict s)arurxmoot1ole mi3iltfsDemnms u4teerir oy1lmDeaivo;s teur(m oy4lpe  ietat)s2taumpoo1oeeo o3iatls2rmu s;t4 etrxf ootoate nes;t  2xr(r iy4lleemnet t) 2taxrpnt0tlxn o3iatfs rauvsnt0 etnxf oatoaD an i ( teumir3io4apeelneilt sDtr(r ;t1oeeomfetldfaDelu o;t) lxrircoydoaDe u i;s0 2tmiopno1lle  fvi ( aDrm(rpnu4oee  ocild a rl(mont)altnmr3tytlpteln i;s) ruoxo3oydlm n fesl()srurxr ;t0oee if3iytfaDelu s ()alxnif ia1fat  ivi;() rum(rpno4lme mivsat)sDtr( oou4texnii3iytfaDra( o;u)trtoio iytopDeau slt)srxr(rpiodamtnmics t) rumx p;o4olx  fctas sDea(vpnu4tlxomr3tytoatrln s ()srumimpiu4olt  fcsat)aDrmxrpou1tlx ifeiatlm rm(mp;t4tleoir oydoptran ils t2tmxopou4lleemicil(fsDtrxmooo0teen oeiys a2ulu p (0 eermr oadomD  iei;t  2toirpno1lp emieil(fa2taur no4apeniieils s2elnmo;(0aeerif tytomt lies t0teumim3nodlp  lnct s)arururonu0aleniieiysfaDum(vs u4alenxr iy1lpDr i ol(  euoio3nu4ome mfctlt) Duau ooo4olen o3ils s2eanvo t0trtnmf ia1laDeai o ( sexrxmpiu4op emfviatfaDuaxmonu1apeoifctltfm ra(vsnu)aeenmrctodlptrlieslt  etrim no1op nmneia()aDra( oou4oleoio3iasfa2uauvo u0altomo3oydomDrluei t)seuoiopou1om  micslsfa2tm( oou0olx  f3ilt m um(ms;(0tlerxocoydomD  nvil( trtmxm iydlpeemict ( srtmumpoo4tptoiiciysfm ul(vp;t0arxrxo oytfpt an s (0t2trim iu1lmenmici ()sDrrump;o1apxoiieias a emu onu0alxrxr3ta1fpteauvils trtm(r iy1llenlivil( sDuaxrp;t4texnmf3tadfaDulnvp;(0aetrif3oodomD  uvs;s  rtmim3nydlpt  ies t aDtaur nt4teeo oeiatla2rau s (4 rxoifcoatfmt aiei;t)teurimpoy4al elnct t s2taur no0aet  i3iatfaDuluvpnu4trenxr tydomte ueo;t tetrxm ou1lptemncia(fsrtau oot4opeo ocildfs elnvs;u4tlxrxrcta1fp raivi ( setoxo iu4omtemieias  ruaxroot0opxo ictydlmDrlu on(0 eenirctytfmtr uvs ()trtrxrpiydape  ics t srrrx  ot1oexnio3tas sDulu ont)tetrir iodfmDeanvs;s trtrxo3nu1lme lnciatf Durxr ;u1tlx  oeiyslaDrmumo;u) rtrxo oo1fm  lueo;s t2um(o3ou4ol  mies t  ruaxrp;u1ape io3ils m rau o;u)tltrirciatfa raivo (0srxo(r3iudaptelfctl(farumurp;t4oleomieiyd a uln s;t) ltrmr3ia1omtraies t0s2xoirpiydlmtelnvslt  Dtaxr ot1alt  i3tltla rmnmsnu4 rerxociatla raivs t s2xoxo oo4aptelfvils  rrr(m ;u1olxoio3iadfm eauvon(0 etrifctytfateaivo;t0s2umiopnydam emfcsas) rraxmp;u4oleomoeiydfm2ua(vpnt4aexoxf3oatoaD auvi;t  2trxrpoy1lmen neias) rur(mpnt0opeoii3tytlmDua( p;()arenmo iydop  anvils  2uo(mpnydolt mivsas) 2rrxmp;u1olx mo3tydls rl( p;u)alxrxr3totom ranvils)teuo(opio1lm nlfcsat)s2urxr nt1opt iictls m2ua(monu4 eeomr3iodlmtr uei s0seurimpnudomenmict sfarraxr ot1alenio3iatfaDumnmpnt0tetnmrcoodoaDr n slt)trto(opou1ll elicilt arta( pot1aetoiietyslaDuln p;t)texrxrcta1lmDranes;t0 rxmxmpny1op emncsas)aDuau o;u4oeeomictad mDum(vo;u) exoir3iodomtrli o;s0trum(r nudapt lncs t s2ra( p;u0tlx  oeiatlaDemnms ()aetrir oadfmtr ivslt0 euoimpoo4omtnlfvtl()sDrmu onu4optnmieiydfsDum(ms;(0aexnxo oadopteli il( teurimpoodll elfcsls  rurx pot4alen ietytfmDrmnmsn(0 ltnxo3tytlmtranvs;() rtoir nu1om nmfvtlt  2ta(r ;u1teen ociys s2ranvs (4aeermr3ia1opDrln s ( sexoimpnu4oltnmfes ()aDra(rooo4alenmoeiyd m eaumpnt) rtnxf oo1lm   i s;t seur(r oodlle  nctas) Drax pnu4tpx io3iatfmDelnvo;t)trxoifcty1fmtr nvol( texmxr3nu1lptnlfciatfarrax ono4oleo f3iytfm ra(mo;(0tltnxf3ootoatr i ilt) rxm(opio4olen fet t srtm(m nu4tetomiciadlmDem(ms;t4trxrio oydlp eauvs;t0 rxriopiu1am  mivs s)artm(rpou1apxoif3iyt a eln o;u0 exrmfcoytom elnvs;t texrir iodllt liesatfsrraxm ;u1tleoifeiyd mDumnvs;u0texnio3oytfa r nei s)s2tmxrpno1ameelnvi (f Durx p;u0optnii3ildfa2rlu onu4tlxoxr3oa1lmD au o t  rtmir3oo4lptn fvsl()aDta(r ;t0openif3iys s rl(mo u4 reoif3oa1laDr nvo;(  exoxmpnu4opee nvtatf rumurooo0tpxomoetysfaDum(vsn(0alxomo3ootla rlnesl()srxmxrpny1om e ictlsf 2trumpnt4tlxnifciysfm2emnmsn() rxoxfciatfatelu i ()s2xmir3iy4lpen ieil( s2tru  nu1oex moctyd aDuan s u4 eeomo3ia1omD aiesls0 rurxopny1altnmiet s) Dtr(r ;o4oetn i3iasfsDelnmo (4 eenif oodomteai s;() rtmio3nu1ome  ncias  2tm(rp;t1aet mo3tysla2uaumpn(0tlxrircoa1fa   ies () etrio nu1altnlfviat  2trumpou0tpeoifetysfs ra(vp;u0 eermr3iadom  an ols sexrxo oo4apeelnctl(fs2ur( onu1altomf3iyd aDua( s;u0tleomrciadlp   ues;( t2urxo ny1al  lfeilsfsrrm( ooo0alx  f3ild s emums t0 rxrio iytoaDeaieo;( sexoir3iu1lpeemict tf Dumxr ot4texnif3tltfs el(mpn(0 rermf3ootomD  n i s  etmio iudale livs ( aDrauro;t4tlxn ictld s2eau o;u4trxnir3oy1lp r ieils) rtriopnu1lpe livtlt sDtmu p;u4tpt mfeiys mDra( s;t)tltnif iydomDran s s0s2uoimpny1lm elnetatfsDuaurp;t1aex iicilsfaDuaumsn() reomo3ia1lat  ueils0t2trimpoudal e nvt t aDrrx onu1ape io3iysls2uan onu) leoxr3to1laD  uvols0 rtr(o io4oltnmnvi t)sDtaxmpot4tpt  icils a2ua(vs u) etnxr iytfmD  ivilt)s2xoir iudaptn ivi t) rrmum ot1tltoio3iatfa emu s t0aeenmr iytlate nvo t0srurim3iu4ope mncsltfsDrr(m ot0alx  ociys s2rl(msnt0arxomf tadom r ueilt srxrxr3no1om nmfctlsf 2rr(m ou0optn feiadla2el(vonu0 etoxf tatfaDe iei;() 2xriopnydlltnlnes () Dtrxro;u4ale ifciat s2el(ms t4 etniocio1fmte ivsls t2to(r3iydope mneiat srtmump;o0oltnmi3iad mDranvs t4texnxrcta1laDe nvilt t2xr(o iu1ol elfvilt)s2trxmo;o0tptn f3tls m ul( p;(0 rxoxociytoa  luvs t)teurim iu4amee ici t) rta(mono4apxniieiatfm rmumsnu)tetrmf3todopDeanesl()t2urimpoy4ap n nvs tfarrrxm nt1tpeoii3tyt a2ea(mpn(4alenir tatoa ran s;t)teum(rpou1op e ivslsfsDur(ronu0oeeo ociydls2eln on(4texnxo ta1om ean sls  2um(o ny1ope  nvt (f 2ta(mpno4aee io3tldfm umnvon(4trtomf todlp rauvi;s)trtr(o3oudlpt lnei sf Drruro;t4aet mf3tydfaDea(vp u) lxomrciytfmte nes s0trto(mpio1al e nes s)a2rmxr ;o4tpenmieiltfmDea( pnu4 renmrcta1latelivs;s t2xoir3iodameemicslt)artr( oou4aeenmicias s2uluvon(0trxoxr3oydfp ranvilt t2uo(m3iu1ameemneias)aruau oou4tpxnioetldlm2el(vp;t) etomo3iodfa r uei s setmxo3ny1lmt  feia(  rua(rooo4ole mociys m emnmo;u)tleoxr3iy1fa rlivils0setm(r iu4oltnmfciat srtrx pot0altnmfctytfm ranmp;u0texrmf3iotfmD  ivo;t0s2tm(m io1al n iei s)aruaumo;u1texomfcilsfm2rmumo t4treoir3ta1omDrai i;t0sexr(r iudlpe lnet (fa2rr(  ;u4tetn i3tys mDua(vs ()alxnxf3iatlmD an s (0tetriopiydlltnmfes (f ruaxr ot4opx  o3iydfm2rlnms t4tltomr3ootoatrau i;t0teumiopou4omtnlfct tfsrum( o;t1ope iociytfm elnmpnu4 rxomo iadoaDe i olt0t2xr(o3nydol nlfes tfsDtrx  no0oex mi3ild a2em(msnt4tltnif3oodlm raivo;(0trumimpno1ol  livt ()aDtmump;u1altn fciyt sDuaumo (4 rxoxo oytlmDrluesls)sruoiopnodape mnet tfa2ta(rp;o4tpeo o3ias m2rl(monu4tetrxf3ty1lp eaivo;( s2urxr no4olen nvtl( aDrm( pot0olx mo3iad aDrm( o u4 exomrcoytlm elueo ( sexmxm3iodll  lnes s) 2uaxr oo0opxn feiysla ra(vo;t) exrif oytlmD luvs s)t2xoim3iudlltelnvia(  2rau pnu4openiictytlmDrau p (4arxnxo iodoaDeanes;(0teuo(m iodole lnvi s artaxmo;u4ape ioeiltlaDelnmo;u4texrxoctydlmtr ueo t  exrxopou1om nmnvta(fs2rmxrpnt4aetoiieiydlm eluvp;u) lenmr iodfa rlnvs;s sexmxopnodamtelivtlt aDrrx p;o1oeenifeiysfm2umu p;() eenxr3totfp   nvils0trxr(mpnodlptnmnetat)arra(  oo1aexomiciad m2rln o u4 eermf3todlat aies;s t2toir3ny4amee ivils)srum(mpnt0texomf3tatls rl(mont0 lxoif3oytlaD  neo;(0t2urir nudam  mfcsls aDraxrp;u0oetomi3ias sDel(monu0teenmf oadlatrauei;s)t2xrim ny1lpe liet s) 2rauroot0teeomiciysfa2uanvo;u0treomr iy1om eaieil(  eum(mpiudale  fci s) rum(  nu4open icild s uanmsnt4 eeomo tadopDraiei;s)s2tmimpoydlptelnvt s  Dtmxmp;o0opxo fciyd a rmuvs;(4 ltnmr oodom rluvi;s)trumimpoy1aptelfvilsf 2ra( pno4alx  octysfa2eluvs (4altoxf3iadfmD luvi ()sexr(mpiu4omtelfvtlsf rrmxm ;u4oleomi3tytlaDemnvs u) ltomo oy1fpt  nvsl(0srxmio3oo1lltnmncilt) Durumont0aet  octys m2ulnmsnt)artomr3oydlmtr i i;() 2umxopio1omtemneiatf Duaxront0ale  fcilslm2uluvsnu0 rxoxr oatfaD auvs t t2to(o3iy1amt mfetls sDtaurpou4oet mieiasfs2umumpnu0 exnir iy1faD auesl(0setm(mpio4omenmfcs ( srtr(moou4olx  i3iydlaDrau p u4 exnxf3iy1lp eauvo;() euo(rpoo4ll  mivsasfsrta( o;t4olto f3tydfsDumnmpn(4 eerio3io1omDrauei () rtm(m oodope  fet s sDrmxrpot1oleomo3tytfs eanvo;u4trenxf3to1fa elnvol(0seurxo oo4ome  ieil(f Duaurp;u1aeen i3ilsfs elu o;u) exrir todomD an ols  2trimpou1omee fcilt) Dum( pno4oet mfeildlm2rlnvs;(0alxrxr oo1lmDelues t t2xo(r3nodomt  ncs sf rtm(mpno0altomoctlsfmDum(vp;t)trtrxfciy1fpDr u ils  exmxm ou4lltnlnciat artmum ;u0tetnmfeiyd sDrmuvo;(4tetoiocto1fptr ieo;(  exm(o3io1al  mncsa( srtaxmp;o1aet moctat sDulumo t0trxrmrcoo1fpte n ols seto(m3iu4lpt lfviasfa2ur(r nu1olen ictyd m uanms;(4artomr iodfmDrli slt) rxmxr3nydlpt mivi s  2rrxm no0tleo o3ils sDeau p;(4 ltnxrcoadoat lueils) 2xoxo3iudaltn ici (f rrmu o;o1tlx iietldfsDel(mo;t4 exnxr iodlp e n o;t0srxm(r3nudap nlicia(f Dur(m ou0tlto f3iysla2elnmpnt4altrmr3ootfa  ln ol(0 rtoxopny1op emfeiat) rumx p;t0tlx iiciys a ea(vpnt4 rtrioctadlp r ivs;s t2xmxr nudolte ivta()a2rrxmooo4tleniicilsls2emn o u4trtomfcty1lmt lnes;t0truoiopoudlle licslsfaDur( oou0tlen ieiad a2em(vpn() rtoif tydfmDr uvolt)srtmio3iydlmtnmict t srtmxmont4opxnmoetatlm rlu pnu) etoxr3io1lp  luei;( s2tr(rpoudoltnmnvta( a2rau oot4tpto oetld s2ulump;t4teenmf iy1om rlieils0 2trxr3iudlleemnvi t) 2raxro;u4aet ii3ilt a2umuvs;()tleomr3tadomte ues;( s2urim oy1apt lncslt)s2tr( ono0opx  o3tydlaDemn o;(0teeoioctadfatrlues;t0trxoxrpiodolen ies t sDrm(ro;u1optomi3tys a2ulnms u) eeoircoydlm e u ol(0 2tm(m ny4lpt  fesltfa2tr(r ;t4opt  fetyslm ra(ms ()aexnmo3tatfaD aivo t) 2uoio ny1am  lfctatf rur(mp;t1teenmfeild a eauvp;u4 lermociodlm rln o (0 2tmir3iodolt micta(  Dum(r ou4tpxnmfcilslaDeaums t4 rxoxr3oodfm r ivils0t2tmim no1alt lnci t sDrrx pou1alt micias mDea( s (4aetnmr tytlat lnvi s) 2xmxo3oy1lm  mivi (f 2rmu  oo0apen i3iltla umuvpn(4alxnxr3oa1op ran s t)truoirpio4op nmnvslt)sDurumpou1apx mfciatfmDulumpn(0areoio iodfa eluvi;t0tetrxm3io4altnmneilsf 2ra(mpot1tpe ii3iyd a2ra(vo u0artrxo ootla e uei ()s2xrxrpoudaptemicsas)srraxm no4aeeo fetas s2rlnvont)alxrxf3ia1lat  i s;s) 2um(m3nydome lnet ( a2umur ;t4tlxo oeiydlm2uanvo t0 etrmf3oatlaDranvo;s0 ruo(o oydlpt lfeilsfs2trxrpou4tpe iictadlm eanvo;t4aetoxf iatla ean s;t0s2xmxm nudoleelneiat  2urxrpot1apenmf3iaslaDel(vp;t4 eerxr3oo1late nei;s0tetoio no4lltnmieils  2ta( oou0opt ifeiydfa2rmuvo (4 eenmo3todopD  i olt0seuoxo ny4lmtnmies ()sDur(ro;u1oet io3tyt m2elnvsn()arerxoctadlp  aivi s srtr(r3oydlm   ivtls)arumxmoot1aetomoetydfaDumumpnu0alenmf oo1lmteai il()s2tmxrpiodam e fct s)srumu p;u4optnioeiad s2emu p;u4tleoxrcoydoatrlivs;t0 2trxr3iudol emfcta( a2rm(r ;o4oeenmocias a elnmo u) eenmr oa1fa rlnvs s srxmxo oy4lpte nvtlt)aDtrxr nt0alenmicilsfs el(monu) lxrmo3oytfm elu s;s)srumim oo4lpt  ncslt arrm( ono4ale ifetys m2emn pnu0arerif3oy1fat  ivilt)s2uoxm iy4aptn feil( s2ta(rpoo1tlxo i3ilsls umnvp;()treoio oodfmD  nvs;()seuo(mpio4opeelfet s  2umum ;t0aee  o3iltlsDumnmont)aexnmocoy1opDe ieo;( srtmxopiu1ll e fvsa( sDrrxmp;o0tpeniociat s2eaumo ()trtomf3oo1faDe ues s)teum(r iu4ame licia( s2ur(rpno4aexnmiciatla ea(mp;t4tltoir oatfatrau s t0setriopiudll nmncilt) rraxronu0oex mf3iasls ea(mp;(0texoir3iytlpDe u i t  2toxopoudlmte fvsl()srtaxm nt0apx  i3iasfm em( o u0tltnmocto1oaDraueo;s)t2xoirpnudam  liet s sDrr( p;o0opxnmfeiyslsDua(mo (0aeenxocoatoa rlueols) 2umxo oy4omt  fes s)s2raxmpnu4aexn i3ildla ea( p;u) exrmf tatlmt  nvolt) 2xmir oudomeemfesat)aDta(m nt0tpxniieiadlmDum(vs;(0teenif3tydfm rlneo t0srxm(mpiy1al  licta(fsrtmu onu0opxnii3iyt mDrauvpnu0aeermf3iydopDelnes;s)t2toio3nydlltemfeils  Drrurpoo4oetnmo3iad s2ul(vo t4artnxo ia1optr uvo;t0 exrxrpoydol emfcs s  2raxmooo4aee  oeiytfm2rm( s;(0artrxf3iotlat aues ()t2um(o nudomt micsls  rurxmpno4opt mi3iat s2ran p;() rxrifctydom rli s;t0 euoxm ny4al   fcsatfsrraxrpno4tlt  f3tlsfm2emuvs;(4tlenxf3oydopt auvslt  2to(o3oy1ap emfvi (  rrrum ;o4aptniietytfm um( o (0 reoxrcoo1fp eanvsls t2ur(opnodlmeemiesasf rrau  oo1tee mo3tydfs2rau o u4arenio3oytoptrai s;( sruoirpou4olenmnvt sfs2urum no1olxomfeiltlm2el(mpn(4aexriocio1fpDeauvo s) 2tm(m iy4om n nei ()srtm( pou4alto iciltfm umu p t4 leoircoa1oa r n o;s s2xr(rpio1apen fvt tfaDtm(root1olxo o3tad m em(vp;u0aexoio3tatom   nvo;(  2uo(o ny1ol   ivt t a2urxrp;t4olx mf3iadlsDrlu o;u4alenmocootfpDeanvi t)s2uo(r3nudomenmnetlt) 2uax pot0aetn octls m el(monu4trtnxo3iytlmte ieslt0 rtm(opiudap emicta()s2rmu ooo1aexoiociatla2ulumpnt0aexnxo3todopDr nes;t) rxmxopio4lpt miet t) 2rm(m ;u4tee mo3iysla2rmnvpnt)tlermf iadfaDrlueolt seurio3ou1al e ncs tf Drru  ;o4alen iciyt sDrauvo (4tlxrxrcta1fateaieolt)srxoir3nu4open icslt a2ua( onu1tpeniocildfa2emuvo;t)tlxnirciodoateanesl() rtoxr3iodamt livtat arra(mpoo4aptnmieiat s2elump;u4trenmf oa1fpt aies t0 exmxr oy4om n neia(f rta(mp;o1apxn fcild aDul( s (4trenxr tytlaDrln il(  eur(r3io4ol  mieias s2umuro;o1olt mf3ildlm uauvonu4trtnif oy1lp  aueo;s0srxoir nu1lm  livi s) rraum ;t1teeoioetatfsDra(mont)tetnmf iydfmte ies;s0 2tmxo nu4ome  feslt artmx o;o0apenmociyd sDuauvo;t4tetrmfciydlm e i sls srumxr3no1ame miesat sDtm( ono1texo feiyd sDulnms;(0tetomr tytla elu i;s)trtoxo3oy1aptn nctl(f 2raxrooo4aeenmietytfmDeaumsnu0aexnxr tadlat livi;s0 rurirpiodlleelnet tfsDua(m ;o1oee io3tld aDulumpnt0areomrcoy1oa raivil( trtrxo oo1lp emfvsas) ruauroot1oexnmfctatfsDum(mo t0 ltniocoatfmDr u i;t s2tmio ny1al  lfct s)aDum( pot0aee iietatls2uluvp (4arermo3iytop e u i (  2toim3iu4ap   nci tf Drruro;t1tptoio3iat m2ea(mo t)aleoxfciotomtraueo;s srxo(mpio4om emnci s srurxrp;o4oex mf3ilsfa2rau p u0altnifcoy1laDelivs (0 exriopnu1lmeemicia() Duau p;t1olxomieiysfa2rmuvs u)trxomocoa1fptrlu ols)s2xrxo3no4ole  nct sf 2uax  ;t4aex iictydls el(ms u) eenxo iydfmtelu s;t0s2xo(rpoo1ol emnviasf rtmu pno1oeenmoctatlaDumu p u0teenmr3tydopD au ol(0srtm(mpiudaltelict tfs2umump;o1tex ioctytfsDelumo u4trxomo3ty1lm  aieils)trurxrpny4open fcsatf rra(mpoo1aptomiciadlm2rmums (4tlerxr3ootoaDr neil()trxrirpnu4amee ies (fs2tru  ou1tpxniociaslm em(mp u) ltrif iydfmt aies;( srxr(m ou1al e iciasfsDrrurpnt1tpt iieiltfa ulnvp;(4treoio ootlm ean ils0s2uoxo3oudlptn fctatf 2taxmpoo4apen f3tys a elu p;(0tltrmo3oatlptrli i;s0setm(m ny4ol  lnvs s)s2rm(mp;t1tetnmfciys m eluvo u0 ltoif iytomt aieo t)t2trxm iodolenmfctat  Dur(r ;u4oltomo3iatls2uluvpn(0texomo tadlp rln o t0setoio no4ol elnci s arrm(rpot1opxniietytlmDuanvo t4tltoxf3iydlpDrauvo s0s2xr(r nu1lptn
\ No newline at end of file
@@ -0,0 +1 @@
+ivolt0tetmim ny1omenlivs tf rtax ono0opto fctyd s2ulnmp;t4aexnmrcoy1oa rauvslt) 2uo(r3no1alt mfctlt) Dum( pot1tltomoeiys a2uau snt0texoio3ia1fpt au il( tetoxo oo1aptemies s  rraum ou1apxnii3tad aDem(ms;(0 etrmr ootfpte uvi t)seuo(r3oy1op n nviltf Drau  oo4apeoiictltls2emu on() rxrmf3iotlmte ivi s0 eur(o3oy1lp e nvi t)aDrru ono1oee mfctytfmDrmnvpn(0 eeomfciotlat an s;(  eurxopoo1ole lici (fs2rm(  nt1open ieiat a2umn o u0alxnircoytla e nes t0sexr(opoy1alen fcilt)arua(rp;t4oltn o3tad s rluvp;u0artrxocoatfptelneols)srtmxo3iy1ol nmnetasfaDra(  ;t4texo iciytfa rlums;u0 lermfcoatlm r nei;t)seum(m3oudape  ivi sf 2uaxronu4aex mf3iltfm2ra( snt0alxrmfciytfa  ln s ( setoio ou1lpeelnctlt)sDurxr ;u4ape ioetyt s umn ont0alxomfcootlaDrlnvsls) rurxo3ou1omt mnciat) Drmxr ;u4opxoifeiyd a2ea(vo;(4 rtomo3oa1lat li s s  eur(m oudoptemfesl(f rtaxrpnt1optnmfeiysls2eau pnt4texnmf3iodfmDe uvsls0 ruo(rpoudolenlfvs t srrr( pou1ale  f3iatfs ea(mp t)tetoir3to1fm raues;t0sexo(r nu1lm  mnesas) 2tm(rpno0oleoifeiydfa elumo;u4aeeoif ty1om rli ilt)seum(m oo4ll n fesa(f Dtax pno1alenmoeildls2rlnmo u)aeeomo3oodom rlnvi t0s2xo(mpiudll  liesas aDrmxr ou0aet ioctyd s2rau pnt)tlxoxr oo1omtelnvs ()t2tr(m3iudameemfcs t)arrmxrp;t1apxn ictld sDuanvon(0 rtnxf3iodlaDe iesl(0trxoxrpou4al nlnvi s)s2uaxroot0aexoioetlsls uluvp () exnxf3oy1fa r ivils) rxoxo3no4lle lnvtltfsDumu oot0ole iociatfa2um( p ()alxnif3tydfp  aivs t0s2umirpoo4ap n ieil( srtrurooo4tpxn ieildfsDelumo;(4alermo3ootlpDe ueo t0s2tm(m nodlp n fctat s2tru  ;t1olenifeiltlm2rmuvsnu4 lermrcoadopD anvsl( t2umim ou4lle  iesltfsDrmu  ot0tltn ocils s2ran pnu)texnmf3tatomD lnvs ( trtr(m ny4ap elfei t)sDrru  ou1teto ictad a2uanmp u4 rtnmf3ta1lateaivi;t)t2tr(o3no1omenlictat s2trx onu1aptn f3tlsfs2umnmsnu4 lerio3ia1lpD  ivs s0 ruoxmpoodapeeliei sfsDtm( oou1tlxnmoctat m2rln s t)alenmr tatoa eaieols) ruoxr3ou1lptnlivtlsf Dtaumo;t1tlto f3iadfa ua(vp;u4tltnxoctydfmD  ues;s0srxmxr oy4om nmieils)a2tauronu1tpxnmfetldla2emnmp;u0tltoxocootop rlivs s)trumir3ou1lmtelies tf ruru pnt1tpxomf3ildfaDul( s;t4tltnio3ty1omDr u o;t)texmxo iu4amtnlneiat a2urxmont1oeen f3tysfaDuluvo t) rtoir3ty1lptelieo t0 2uoio3iydaleelnvi s s2tru o;u4opt ioctaslm emn o;t) rxoir ty1oaDeln i s texmxr3iu4lp   ivtas artmxrono1tpt  fetatlm ulu s;(4tlermocty1fpt an o;s)trxm(mpiu4ap  lnvil(fsDuax oou1opxn fctat m rmn snu) lermr3oodla e ieil( srum(mpny1om emies ()s2umur nu0tpen feiadfa ea( p (0 exrxo todlptelu sls teuo(m ou4lm nmncil(fa2rmxro;o1texnmf3iad a2rlums;t)alermocty1fatr neo s0t2urxo nu4al elnvsl(  rrrxmpnt4apt mf3iltfm ua(mp t) eeoir tydlatr u o;t) ruoxr3nudapt miet ( sDurxmont4aptomfeiltfmDrlnms;(0arxnio totoatelneo s)s2toxm iu4apenmnvt s)sDtmxr nu1apxnii3tyslmDelu sn(0 lerxf3oadfaD aivilt)tetoxopoodapee nctl( s2rrurpoo1texo oetld a eau p u) etoxr iytfatran ils0 2xrxr3no4amt lneia(farurum no0opx mociytlaDea(mon(4 rxnirciytlmD anvi (0t2xmio oo1lmeelncsasfsDrr(mono0alt  ietydfm2ul( pn(0trxnif3tadfpD  n o ()teuriopoo4apenlictlt  2ta(  ;t4altoii3iat m2ul( p (4tetrio totopDrauvsl()teurxr nodal  lfvils sDua(moot0aetoiociysfaDelu on() rtnmf3ootlp   ieslt t2toxr3iy1alen nes (faDum( o;t1alt  i3iadla elumo;t)tetnxr3oytlptrlnvi;t0srxrimpnu1ope mfeslt aDrau  ;u0oetoifeiyt aDeluvpn(0 rtriocoa1oa   n s s)t2xoiopou4lmtelfvi ( a2rm( o;o4tltomiciadfm2ra(vsnt4 eenxr3ty1fat  ivs t)trumxm oo1aptnlnvsltf Drmxr ;t0alxomietydlmDemnmo u)teerxocootomDelnes;(  2urxr3io4altnliciasfaDtmurpot4alx  feiysfa2emuvp;()areomrciotfmDrlneilt0teumxmpiy4apt micia(fs2tr(rpot0apt iiciyt mDea( s t4aeermfciy1lmt  ieo;s)s2triopny4amt  fvilt s2tmx  ;t0apt iietas sDelnmo u)altomrciydopDe n o;(0s2tm(mpnydoptnlnviat)srumum ot0opxo ieias a ra( o;t) rxnmocoodfp e uei;t)s2xrir3nydllenmfvs t  Drm(m nu1teeomocias s ul( snu)artnxr oatla raieols srum(rpiudaltnmnciat)artmxmp;u4tlx  ictad s2rlumont0aetomr3ootlmD  uvols)s2xoio3oo4lmtnlnvs (fartrxmpot1oeto i3iytfs2uanvpn()trxnio ty1faDr n ols sexmxr3nudlpe  netlt  rtax oou4tlx ifciadls2elumont) rxrio3tydomDr uvi;s0 2xoiopno4lmen nvt tfsDtr(m ;o1tlxoio3iydfa2ulnvpnt)artrir3oytfa rauvils0 2umxr iodame mfci s)srumxrp;t4altnif3tytfs2uan pnu4tltnirctotlmDeaneo;t)teumxmpnudope mnctlsfartmu p;o4tpxn feiat s rl( snu) lenxo3tatfpDe i o;(0texrirpiy4optnmicslt arrrxmoou1alxn fciysfaDemu o;u4 exnifcoo1fa raivils0trurxr3nu4lle lneiatfsDrmxrp;u4aee  i3iadfmDelumont0tlxrxr iadfpt auesl(  2ur(mpno4lmeemiei (fsDumu  no0oexn octatfs2ul(mp;t0arerxoctatfaDr i s;s t2umxr ou1lle lnesat) 2tru o;u1oeenmf3tadfs ua( o;() ltoxrctytfpte ieo (0t2xrxr3iudomenmictls aDua(r nu1aexomi3ildfa rm(vs;(0tlxrmo oo1lm  ai olt srxmxr3oy4omenmnvsatf Dur(mpot0oetnmi3tatfa rlu o;(0alenxo ia1oa  luvols)srto(r iy1omt  ietas) rurxmooo1tlenioctldfsDrl(msnt0 lenmf3iydla e ivo;(0s2um(o3iydlmenmncsasf rum(m oo1ape mi3tydlmDuauvp u4 lerirciotomt aneslt0 2xm(rpno1lleelivi s srum( p;o0alxnio3tadls ra( pn(0 rxoxf3oa1lmt au s (0s2trxr ou1ape  nvia(f rtauront4aptn f3iyt m rm(mpnt4trtnifcta1opteln ol(0tetoxo nu4ape mieia( s2rmur ou0tpen octltlm uluvpn(4tltomfcty1la raiesls  exrxm io4ap emici t arrrurpnu1apt mfctld a2uln pnt4aexnifciadlate i s;s0 rtr(o3oy4apt lieslt) rtrxm ou1optoii3ias aDrm(vp u0arxrmo3oa1lp rau i;s  rtmirpno4omt lnvsat)s2umxroou0tlenmocilt a2eauvp () rermocta1fat  ueils) rtriopiy4ll elfvt s) 2tr(mpou0teto icilt a2emn p;u)aeerxocta1la rli s;()s2uo(o3ny1oltemnctatfaDtmxrpnu4ole  feiatls2ulnvs u4 eeoxo oa1fa eluei;s)texmxo iu1amenlicsl(fsDtr(mo;u1tpxn i3iyslm2emuvs t0 ltnmocoydlmDrlnvil( s2xr(mpoydaleelfes sfsrtm(  ;t1tlt iociasla2em(vs () eeriocty1fat  u s;t trxm(opoydalenlnet ( arrmxr nu4tle mfcilt mDrmu s t)tltrmrcto1oa ranvolt srxr(m iu4amenlncsasfs2ra(mpnt1alen ociltfm2em(von(0tltomr3ta1lp   n i;s0truoxr3no4opt mnet t) Drr(r oo1tltnif3tlsfm2rmnvo () eeoif3oa1oatran o;s trtmxr3ou4lmtnmiet (fartmurono4tpto feias sDrl( o (4tetnmf3oodfa raiei;()trxoir iydom e fctlsfaruau  ou4alxo o3tadlmDea(vp;u0altoxr ootlm   uei (0t2toir iodome  fvilt  Dtmx ooo0tptniiciat aDeau o t)altnmf tatoa  ln o s  rtrirpnudope mietas)artm(rooo4olxnifcildls2uanvont) ltnioctodfp eluei;( setriopoudope  nct ( arrm( pnu0tpt  octat mDea(ms u4teeomr3oodlm   u s t) 2tr(mpou4op  lncs s  2trx pnt1tpxoioctls m um(mpnu4tleoif iatoaDrluvi;t  2urxo3oy1lmen nctlt)s2uau o;t1oeen ieiysls raump u) etrxr3tatfaDe i ols)tetr(o3ou1llte nvias)sDum(  ot1tpxniiciys mDuln s t0artniocoy1fa  ln o;t0 rum(rpiy4alenmnet t  Dtru  oo4texnifeildls2rauvs u)artnmf oy1om  li o;t0 rxm(m3io4opt  fesas)a2tmxro;u0aex mo3tadlm elumo;u4arxrir3iydla   n s s teuo(o ny1llenlfcilt arrm(mono0aexo ietltls ua(ms;t) eeomo todopD  ivsl(0 etmio iudopenlicias)s2tmu pou4oexnioetld aDuln p;(0tltoircoa1fpt  ivi;()srxmiopoodap  lfctl()aDua(mooo1olto o3tadfs2rlnmo;u4teerir3iadfm ranes;s truoxrpiudapeemfciasf rtrx pnt4tpxo oetadls2ea(vs;t)teerxf3ty1optrlu ols teur(o no1lp  lfvtas)srur(rpno1oleoiiciyslm2um(mo;t) exrmocoatoaDeli o;t0texoimpnodam  lnvt tfaDtr(moot1tpt miciydfs2emn snt) eenir3iy1lm e ieils0s2xrio3nu1omtelfesl(fs2umxr ;u0aleomo3ildla2ea(ms t) lxoir oadlpDelies;s) eum(o io1altnmfvi () Drm( p;o4oeeomi3iytfm eanvs t4 lenmrciodlmtr nvo () 2xoxr3nu1ame lfvsl()srtaump;u4tltoifeilslm um(vs (0alxrir iotfateaueols)tetoxm3nu1am nlicias)srta(m ou1oetniociyt a2umump;t) ltomo3oodlp elu slt s2uo(o iodopenlnviltfsDtmu  oo1aeenmocilt a2ua( o u)tltoxrcio1fm  lueo;t0 rumxopiodoleemfci tfa2um(m ;u0ape if3iadfm emu o (4tltoio3oa1fmDraneols t2xmxm nu1amen nciatf Dumurpot1apt iieiys a2ua(ms (0tetrxo3oo1opDrau i t0srum(opny4ape  ncsa() rtrxrono4aptn i3tytls raump;u) eerif ty1fa elu olt srtmio iudopt  feil( aruru  ou1tlxn f3iytlm2rl(vont0tleomrctydlmDeanvslt)setr(opoo1alee fet (fsDuau  ou4oetomociasfaDuau p t0trtrmr iotlm  ai i s0 exm(o3oydamtnmncta(  rrrumo;o0alxnmoctls a2rl(vp;u4 lxnif3oy1lm eai s s srxoirpnu1am emieiltfs2rax onu0ope iiciys a ea(mon(0alenio3todop ranes s0tetmxopiu4omtnlfcsas aDum(rooo1texn f3iytfaDrlu on()tetnxf oa1fmteaiei;s trurio oodomee nes (fsDtrurpot1oetn fcilslmDrluvs (0arxnmr totop ranvilt setrio3oudopt mfvsatfs2ta(root1teeomo3ildlm rl(vsn(4 reniociy1om eli ils0s2urxr ou1alenlict (farumxrpnt1alt miciadfsDrl( snt)trxrxr3todfatrlnvo;s0t2xr(mpiy4am   ncil()arrr( p;t1aex  f3iydfm elnmo t4aeeoxrcoa1laD lueo () eurxmpiu1om   nctl(  rrax pno1tpxnmi3tatls2eanms;t0arermfcoo1fa  lneo;t)trtrim nydolt lnetat)sDurxmono4alxo feiat sDeluvp (0 exrmo oodlptrau ol()setmirpoy1lpt livsa(  2ur( pnu4opt if3tlt sDrl( pnu0 lxnif tydop e ivs;t0sexrxr oodlm emieias)a2rm(mpnu1alenmfciytlm2rauvp u4trxnmoctatlm e ueil( trxrxr ny4apt lneiat aDrrumpno1tlen iciltfa2umu pn(4trtriocto1laDeanei;(0trtrio iudlme  fet t aDtr( pnt0tltoio3ilsfs ea( p;(0artnif3iodfm  lu i t)seur(o no1lmtn fvsltfsruax pnt4aptn ociad mDeauvo;u)altnxf oodom elivsl(0 2trim iu4am nlfei (faDur(  ;o4tlxn f3tld mDeauvo u)tlxomrctatlpDeauvils0trxm(rpny4lme mfviat)sDtru ono4oex iiciadlaDumu ont) leomocoatlpDrlivols)setoir oy4omte fcs t arra( oou4oeeo ictydlm elumont4 etrmrcoodlm  luvs s)teto(opoo4ole livs ()aDurump;o0oetnifctltlm rlu o;u)texoifctydopDe i il() rto(mpiu4lmtnmivsas)sDrr( pno1tlen i3iaslsDraumpnt) ltrxo to1omDe ieols)srumir3ny1omtemieslt)aDum(mont0oeen f3tyt s2ul(msn(4 lxnxrcty1optelueo;() rto(opny4opt  fes t aDtmxro;u4ope iictltfa2rluvp t) eenmfcoa1omtrlueo;(0 etm(o3oy1oleemfesa(f rur(ro;t0apeomf3iasls2ea( p ()texnxo iodoateauvol()setoiopiy1ap  lnvs ( sDua(r nu4oetomo3iydlaDea(vo ()areoiocoodlpte nvi s0srtrxmpiodlptn ncil(  rrmu oou4aet ioeiys aDrmu p t)altomo3iatlm r neo;s sexo(rpnudlpe  ivi t)s2ta( onu1oltn f3iatfaDelnms t0arxnmf3oatfa r ueo;t0texoimpio1aptnmivs s) Dtru onu4aptnio3iaslm2elump;()aetnmf oy1lmteluvs;(0 2xmxr3no1oltemivt s s2rrum oo0apeo feiytfsDrl(ms;u)alerir3iydlmD  n olt)t2urxm3no4lleelnciat  Duru pnt0ope  i3iasfsDrlums;() renmociodla e nvi () eurio3no4lme mictlsfsrrrurooo4alxo i3ilsfa2rmump;()altomo3tatfpD an o;(0 2umiopou4aptnmivils a2umxr nu1tpxoif3iydfm ra( p u0trxrmo io1lmDeliesls) rtmxo nydoleemfesas)s2rax  nu4aptn ietyt aDra( p;t)tltnxfcoodlp e ues s  2toxr nu4al   icta(  Duaxroou0ope iietyslmDrlump;u4tltnxfciytfptelues;(  2tmio3iydlptnlncia( a2raxmpou0ope  o3iyslmDumu p;u)texoir3ootlp  ai s s) exm(r3iodlm   nvtas) 2tm(mp;u0aptnmietadlmDrl(vo;t4trxnxf3ootlp e uvil(0 2umiopnudlptn iesl(f 2raurono1apeo o3iat aDulu o;(0altrio oodfm rli ils  exoiopnu1om  mnvs s) ruru p;t4olt mieils a ua(ms;() exnir iadfpDeai i ( sexoir3oo4omtn fcsasf Dta( ont0oltn ictydla rl( s;()trenxf3tatfatr nei;()teurio oy1am  mfctasf Drm(mp;o0alxnmi3tadfm rm(mp;()tlerio todfpDe ivilt)seum(mpnodalt lnctls  rtr(rono4apeo icildls uanmpnt4areoir3tadlpD li ols0s2uriopny1omtn iei ( s2tmxrp;o4tetnmociydla rauvs;t4 lerxr3oatlptelnvo s0 2tm(opio4ll nlnei sfs2umxrono0tlt iietys a2rm( ont4arenmocoodlmt aivi s seurxo oo4ap  mnct () ruaxmoou0aeen ietadfsDrmn s t) etrxrcia1om raueilt)s2uo(r3oy1ap eliviatf 2urump;u4tee  ictytlsDrmnvsnt) rtoxocia1omD aivo;t)srxm(m nydll   nvtls)sDtmxm ;o4opto oeild sDelums;()tlxomf3iodoa   ueo;t) 2umxmpiudll emfcsl( aDtrx  ou0tltniociltlmDrmn o;u0tlermr3tydlmtrli sls t2trio3iodol n fetat)aDumu p;t0opt  fctltfaDran s;t0arxoxo oadomDraiei;t)teurxo3nodomtnmfetat)aDuaur ;o1teeoif3iyt m2uanmont) lxrio tydoaDrau i (0texoio oy4lmtnmfci t)a2rm(m oo1oleoio3ils a el(vp;(4teermf3iotom rauvi;t0 2tm(m nu1lptemieslt) rrm(  ;u0alt if3ias sDra(mp;u0 eerif3totlptelivol()texmim iu1am nlnctatf rtmu o;t4opxoifciatfaDrm(mp;t) leoircio1om rluvs;(0trxoxm nodopt miciasfa2rmx  oo1aetnmfetytls2ranvp;u0 rtnirctytlm  au i s0 exo(r3io4olt lnvilt  rrr(mono4opxnmociyt s2rluvo;() renir oodlaD anvi;()t2uo(rpny1lmtelfesat)arra(mp;t0tex mfeiad s2rl( pnu)artoif3oatlate uvols s2xrim iy1alenlfvil( srrau pnu4ope  i3ilt mDrlnvsnu4 ltrxr3oytomt anvs;(0seuo(opoy4am e fvsa() rrrumo;o4aleo feiydfs umnmo u4tltnxf3oatlaDrlueilt) etrimpoodllte nvsl(farrauro;t0oltoifeiyt m uauvpn(0arerxr3oytomteaneolt)t2tm(opnydlm n fcslsfsrra( oot1aee ioeiyslm ranvs u4 lxrxf iatlpt  ueo;s) 2xm(r ny4oltelfvil()srua(r nt0alx ifciltfaDrluvon(4artnifcoatfaD aneo;t0 2xm(o no4lpe  fvtasfs2trxroot1alt mo3iytlsDumump;(4 exnio todoa rluvo t0seto(o nu4opt lfvtlt s2rmur nu4tleo feiasfmDrmn on() lxrif tydopD anvi;s0trumxm3iodamt  iei s sDra(rpot4apx  ieiatlsDuaump;t4altnxr ia1fmte i s s0s2umxrpnudop n nvsatfarrru  oo1tlx mfetldfm2ul(vpn(0 etomfctytfa elivol(  2urxo io1amt  fvi s)srurxrp;t0teto feiyd mDuauvo u4 ltoxf oatoaDean i (0tetoxmpio1alen ncslt) 2raump;t1oex ifcild a ua(msn(4 rxrmo3oytoaDelnvo (  rtrxr3oudol n fesl(  rua(mono4altn ieiydlmDeluvo t4 lxoxo io1opDeauvols  rtm(m nydlptnlieslt)aDumuronu4tee  o3iys sDul(vs t)texomoctytfatrlnei;t0t2xm(o ou1lp  lnetas) rta(rpot4teeomieiytfm2ulnvp (4aetnifciy1lmDeauvi;(0 2xmxo3ny1omte ivs s srtmxmpou1olxo ieiydlsDrau p;u)trxrir iytfaDr i o t  etoim iydop  liesa(  rtrxrpnu1aleo oeiydlsDum(vp;()arxnmo3oa1fa r uvi;s) etr(o3no1opeemncias)sDra( oou4olxomieiltfsDrl( s;u) eermr to1oatrauvsl() etr(rpiu1ole  nvslt)s2tmurpou1olx mf3iadfs ulump;(0arxoxr3oydop  luvi;s trxr(opiydol nlfctas) rrr(moot0aee mi3tasfs2em( o;u4 rxoif3ootfa   n s t0t2triopny4omenmnvs tfsDtmxr nu1opto oeiysfm2rauvpn()artnirctytlmteaneo;()s2um(o iy1lp nmnvsls)aDuru pou4olt iietlt sDea(msn(4trxrmf tatlp elieols0t2xmir iu4omee ies (  ruru oot1tpto ietas aDel(mo;()arxomf iydoaD  uvo;(  rxmiopoo1lm  miei tfarumuront4tet  i3tlslaDua(vp;u4altnxf3oo1omteaieol()srto(o iu1al e nct (fsrumuront4ale moctytlm um( o;u)arenio oatopte uvs t) rto(o nydlmtelnei tfs2rrxmpnt4tpto fcias mDelumo (4alerxr3ta1lpteanes;t0 exoirpnudolt  iesl( s2rm(  ;u4apeo o3iys sDel(ms;(0texrxr3totopDrluvs t0 eumxo iydam nlnvt tfaDtmu pnt4oeeoiieiltlsDum(vonu4tleomoctodom   uvsls)tetmxopnodom   ncils)srum(rp;u4tlt miciad s uanms;u4altrmf iodopD ln i;(0 2umimpoodoltelfei tfsrum(m oo0oleoifetadla2uln snt0tlxnxf iy1fm eluvi s)srtoxo oudlleelfetls)a2urumpoo1olxnmfctld aDuaump t0 lxnxo iodfaDran il(0t2xr(r no1lltelfetas srtrx ono0alto ieiys m2ra(msn(4alerir3oy1lmtrau s;()truo(r3oo1am  mfctat  2raxmp;t4aetn iciytlmDuauvs t0 etnmf3ootlmDeai ils  2toim iodlme mivia() 2ur(mpoo4opxomoeiyt s2rmnvs;(0aexnio3iotom elueol(0 2urim3ou4lm nmnct (fs2rr( p;t0apt ioeiatfmDrl(mp;(4tetnif oadoaD  i ilt0sexrxm oudom nmivsls)s2raxro;o1alt  ieilslmDumuvp;(0altoxr ta1lptrln o;s t2tm(mpnu1lm elneiltfsDua( ont0tpt iicilslm2umu o;u4 etnifciatomDrai slt) 2xo(r ou1ame  nvi ()sDtr(  ;u0tpenif3tls a rmump t4tlxnxfcta1omDraies;()tetrxmpoodal e ncsl(faDtrxm ou4aex mf3tyd s uln s u4aexrxfcio1lateaneo (0truo(r ou4lle mfvi (farua( ont1tptniiciatls2rlumsnt)altomo3iadlm rlues t)trxrxmpio4lmenlfvsl() 2tmxmpot1alt  i3iyd sDeaumsnu4 ltrio to1omteai sls0 2toir3ny4al emnes s)srtaxroot4olenmo3tld mDrmnvp;u0 eerxo3to1fmD  ivil() etm(o3iudomtelnet s aDtrumont4tet mi3iaslm uluvo;(0alxrmr oa1lmt ai slt s2uoxopiudamtnlncilt) Drmxmpnt1aeeomoeiasla2um( pn(0 rtrmr totomDr u s;( t2toxo3iydlpt lnvi ()s2tm( pnt0tpenmoctytlsDeau snu0 exoxo3oytfp rln ils0srtr(r iu1lltelfesatfartau o;u0oee if3iydfmDulnvp;u0 etrxf3tadfpt aneols  exmir3iu1ape livs () 2tmu  ot1tpt  oeiad mDrlumsn(4 etoifctatlp eaneils s2to(o3iy4ole mnvsl()srurx ono4alx  oeiydfsDum(mo (4trermocia1fmDeaivslt) etrxo3iy1lmt lfei (faruaxm nu4oleniocias m2rlnvo;t4alxrio oytfa  au i;t  rur(r oodlp nliesatfaDtrumonu0tptoiociltlmDrluvp u0 eerircoy1latr nvs t  2xoxm ny4oleeliciltf rumxm no4tlx mi3tasfa2rln o;t) ltomf iy1fa eln sls  eum(m3nydapeelfcta( srrmxro;u1openifcilsfsDemn p t)teeomr ty1opD lnvs;t  rtr(mpnu4om elneils)aDtmx  ;o1opxo o3ilsla ua(ms;u4 lxrir oadopDean i t)t2tmiopiu4lpenlnvs tfa2um(mpoo1olenmoeiysls ea(vs;u)trxrxf ia1om elieo t0srur(rpny1lpe lnvi t aDuau ooo4aeto ocildfaDrlump;u) exnir oy1lp e ues;(0 etrio3iodop  mfvs sfs2rm(mpnu4aeto icilsfm2ul(vpnu) exoif3iydfp r ueil(0 eur(r3iy4llt lfvs s)sDraumpot4altnioeias s um(vo t)aetoxf3oodfpDrln s;s0s2uoio3nu4omtelnes sf Dtmx oot4teen octyt aDeln p;t)trxrio3oadlmteaneslt sexmxrpoy4lp  mfeils)a2umxr ;u1aeenif3tldfaDrmums (4aetrmr tatlp ean slt0 2urio oo4altemnes ( artmu pnt0aetniictatfa2emnms t)arerir3totoaD  ivi;( sexr(rpnu1aleemiei (f Drr(rpot1opeoii3iydfsDuaums;u)artoxf3to1fmt li sls  rumiopio1llee ict sf Drmu ont0oetn f3tldlaDulnmo t0texrmo3ootfmDrlnes;t) exm(m iy1lm nlivs sfsrtrx  ;u1aptnioeilsls2em(vp (4treoir tydfa eanes (  exrir iy4llee nvsatfaDrm(mpnu4ole  fcilt m rmu pn(0tlenxr3tydlptr ieils0texm(r3oo4omtemiesl()a2rr(rp;o4aet ifctls a emn s t)tleoiocootfa  au o;s t2urir3no4aptelfctas)sDtmumo;t4oeen ietadls2uan o u)arxoxf iydfat anvi t)trxoir3oudom  lfcsl(f rumum ;o4aexo ictlsls2eanms u)texrioctodlaDrlu ilt0 2tm(r3iodop nmics tfaDumu  no4tee ii3tat m ul(monu4 ltnmr oadop eliei (0teur(o3oydom elncsl(f rua( o;u0aeeo f3iatlaDuan o;(4arerir3oadlmDran sls0texmxopio4ole  ics tfarumxr ou4openiieias s2umuvpnt4tltnmr3iotlpD  uvolt) etmio iodlmenmfcil(faDumumono4optoioetatla2rlnvp;()aetnmr tatlmt lneo s0t2xr(rpoo1altemictl(f rraum ;t1olenio3ils aDea(vpnt4trenmo3tytop rlnvs;s0s2xmxm3ou4lmtnlnes (fs2urxmo;u4tee ifciydfsDuanmo t0teenxo3todomtr ues t0 2xo(o3ny1lle mics t srrm(m ot1tlxomo3ildfa ulnvs;t4 etoir iotfptrlivs;(0tetrio3oydaltn feil()a2rmu pnt4aetomi3iat a2ranmpn()aexoif oodoateanei (  etm(mpoodop e iet tfs2tr( p;t4aeto iciltls ranvo u0aeenxrcoydfa rlieo;s0texoimpoy4om e iet t arrrxmo;u1oleomociydlaDuaums;t4altoxo tytlm   n i;(0t2toirpnu4olte nct s)a2rmxm oo1tleniociadfm umuvsnt0trxoir oydlaDraies;(  2tmxopno4oleemivilt a2tm(ro;o1aee ii3iysls ran pn(0 renmr3io1opt luei t trtoim ou1amtn fcsat) 2taxm ou0tlxniicias sDrmump;t0tlxrmf iadfmDran ils)trxmxo nydalenlfvilt)sruaump;t0apx if3iysfmDrluvs t0texnmrcoodfa  luvsl( s2xr(mpno1altn nvtltfsDtrx pno0tle ioctldlm2el(mo;t) etnmfcty1om  lu s;t0t2uoxr iu4apee ivi sfs2uauro;o4tlt  fciltfm rmump u)alxomfciy1oaDrauvi s)sruoxm3io4lmeelfesl(f rua(mpoo0tpxo fcildlaDrl(mp;(4 etnio3iodlaD livs s  2urxo iudomt liesl()sDrr(rooo1tlt  f3iyt mDea(vs ()alxnxfcoo1lmD  ieol()texrxrpnu4lp   feia()srrm(mpou1olt micildfmDumnms u4alxnmf3todoaD aivo ( srurxo3oudam nmietls)srrr( o;u0alto icild m2emnms t)texnmo3todopDr uvs t) 2xoir3iu4al   icil()a2uru p;t4tex ii3iydlm2eaumpnu0 rerircoatlptean slt srtm(mpiu1lpeelici tf 2ua(m nt1olenif3taslm2ul(mp;u)altrio3ta1fmtrlivolt) exmxopoy4ome lieta(faDtrur ;o4tlx ioetlsfmDranmp () lermr tatlpDrli s;s) 2uo(r oodape  iesatfarua(m nu0aex  fctls s umnmo t0arxoif3ootfptelnvs;s tetoir nu4ol emieias  2trxm nt1tlxoifetytfs ea( s;(0aexoir3tydlpDeaieols0s2xmxrpoydlp e icia()srrru p;o4tetnii3iydlm2eaump;t)altnio3iytfat aueilt0s2toim iydlm nlivi ( sDtm(r no0opt moeildlm uan on(4texrmo3oydlmt lu s s)tetrxr oudomeemfvia( arumxroou4teenioetydfaDelnvsnt0teenmf3iy1latr uvi;t)s2tm(m oo1apee fctas srraxrono4oet  feiys a umuvp () ltnio3iadfptrluvs;s0seto(rpio4ame  nvsl( arrax  ;u4aeen ieilsfa rl(ms;t)tetomfcto1fmtran o ( s2toiopiydoleelicsat sDur( pou0olxnioeiadfa emums;u0 rtomo oadfaDranvs t0srto(o3no1omen fct ()srrrxr no0oltnif3tls s2elnms t4 renioctydla  lueil()s2xr(r3iu4omeelnctl( srtaurp;o4olen oeiadlm2rmnms;()tlerxr to1om  ai i ( trxr(opoo4lp elnct tfarraxmpoo4ape  o3iad a2umnmo (4texomo oo1op ean i (  2toxrpno4al   ici tfsrrrxroou0aleo ieiydfm2rl(vo;t0trerxf3iadlat lieolt t2tm(o nudame mivs s) 2tru  nt4optomieildla umuvo;t) lenxr ootlmDran i s0t2urio iu1apte ict t arua(m nu0oexnioctytfs2rln pnt0 ltoir tytopD lies;( t2xmxmpoy4omte neiat sDrr(monu1oetnmoeiad m2uanvp;(4tltoxo3oydlmDrai ol(0seumimpiy1lm n nctatfaDrru  no0teeoiociatlmDuau s t)tltoxo3iatlmt luvs s0sexmxrpiy4ole mnvsl( arurxmoot0alx ifetlt aDrmu o ()arerir iotfmt lu ils)texr(m3no1op  lictas  2uaxrooo4tetnio3ildls el(mon() reoir3tytfm   uvslt0 2tr(rpoy4om elnetl( srrmumpnu1altoiieiat m2rluvp (4 lerxr ta1fm  lies t0seurxmpiu1am nlncilt aDtrx ooo4tpxnif3iytfs2um(vo;() renmf ootlpD luvsls0 2um(opoudome mfvsas a2taumonu4olxomoetas sDel(von()teenmr3tatoaDelu s;t0s2toxrpio1aptnmnvt (faDrmx ont4oltnmo3ildlaDrlu o (0 etrircoytla  aivo;s  2urxo iodape mfvsls)aDum(r ;o1tex mictls a rl( p;(0tlxrir3oydop eli ils0texrxr3nydalen fcsls) 2tax ont0apeniiciydfa uauvonu)tlenif oydomD anei;s t2xmxr no4lme mictatfsrum(r ot0tetnmo3iydla2eluvs u)tltrmrcoodfat  n s;s0sexmio3nydllt lfeta(farta( oou0tleoioeiltfs2emnvsnu4tlermo3oo1lpDr iei (0srxr(r3oudamenmnctl(f Dta( onu4opxomiciatfmDrm( s;(0trermf3tadom  au s ()srxoim iu4lltnlieia( aDtmu p;t0tpt ioetldlm2umu snt4 eenxr3ia1fa raies ()srxm(o3oy1lp nlictl(fsDumxmp;o1ole  oeildlmDrmuvo;t)tltnmrciatfptr neo;(  2xmxm3oudam e fctl(f Drmxm ;t0tle iietydfa rm(vonu0 rtoxfcia1lmt  uvi;( t2trir iu4lmte fetls a2rr(mpno0oexomi3tls sDrl( pn()aeeomf oatlmtean o t s2xoxo iy4ol nmnes s)aDtrxmono0tpx mietas s2ran pnu0 ltrmocoytfpt aneo s  rur(r iy4am  mneta(fsruaxmo;u0aee  ietas s2umuvont) rtnxr tadfpte i o t  exo(o3iy1altemfesas)sDumx  nu4optn o3iltfsDum(vo;t0 exnio3oa1fpDrluvi t0 ruoxm oudapeemfciasfs2raxrpnu4oexomo3tyd aDem( o;(0 exnmo to1fa  anvil(0t2tm(o3iy1apee fvtls sDumx o;o1oex mocilslsDua(vo;t)arxnxocoatomD  nvols t2xrio io1omtnlfvtls  Drrumpnu0aee  ieiatfsDrmn p;(0arxoxo iatom eaues t teuo(m iydamenliet tfs2tr(mo;u4oexomf3iltfa ra(mp (0 etnxfcoa1omD auesl( s2uoimpoudoltn fvs t)a2rr( ooo0tpxnmoeiydla uln onu4tetrxrcoydfpt lieo s0srumxrpoy4lpenliviltf rrmur nu4altoiicildlaDrlnvo u)aleomo iydoaDelu i (0 rtrxrpio1lm e nvi s aDraum ou4teeomfeiydfm2um(vs;t) lxrxr3to1lpDeluvs s s2urir3io1ap nlies s) Draxmpnt0ape mictlsfa raumo;()aetoxrcootfpt auvslt)t2toxrpoo1ap elneil(faDuax onu0apeo feiyslm el(mo;(0tlxomr3todfptr uvs (0texmir iudameemnciat)artr(moot0oex  fctltla2ulnvs;t) rxnxf oadfa   u slt  2xoxm3io4lp  mieil()a2rr( pnu1aetnioctysls2el(mpn() lxnifctatlmte u sl(0 exoxo3io4omtn iciat) 2ta(r oo4oltn ociys mDuaumo t4trtomfctotfm rlnes;(0s2xoxo3iu4op nmiesa( artrum ;u1aeeomiciad a2um( pnu)trxrxo3io1opDrai s t0 eumxrpnu4altemfct t)srtru ono0opx mi3iad sDuan s u4areoir iytla rli o ( tetmxopou1lp emfvt sfa2urur ot4tet ii3tadfm umuvs;(0tetnmr iotom e i s;() exrxrpoy4ome  ieta(fartm( p;o0aexnmoetydlm ua(vsn()arermo3oatla ean o ( srxm(rpnu4ape lnesl(farta(mp;t0tpxo f3tlsfa ua(ms;u0artnmr3ta1fpt auvi t0 rtm(m no1alenlfvi t sDrrxrpnu1tlt iieilt a eaumo;t0teenxo iodopteaueilt) 2uo(m oo4lmtnlnesa(  Dtmxrpot4tle mietatfs eanvo t0tlenio oydlp eaivo;( t2uoim3nu4altemivt tf 2rmxr nt4ope mf3iltls2eln o ()arerifcoadfmt luei;t)trumxmpiydolenlfctl() rtax o;u1tptnmociatfsDuauvp (4arerif3ia1lateaues t0t2tmxopiu1ame lfctl( srraurp;t1open f3iltfa uaumo ()aetrif3iytop   ieols)t2urxo3iu4apee ivtlsfaDrmur ou4aptnioetltfm2em(vsn()trermf3todfpD  ivo;t)sexmiopnydapeemnct t aDumx onu0apxoifciyt a um(vp (4 lxrxfcoy1fmD anes ( teuoir iy1amee net (fsrrru p;u0texomf3tytfa2emnvonu)artnifcio1lpt aneo;(0 2urim3iydlm emies sfs2tmx  no0olen icils s2elnmpnu)tetoxf oatfat  uvi;t) rtoxopiu4llt mieiasf 2rrxro;o0opxnmfetas m ea( p;() rxoif3oytom eai il()s2uo(rpio1lleemfet s  2rr(mo;o4aex moctyd aDel( s;(4aetnxr iy1faDrlneo s0t2trxopnodam nliet t a2ua(r ;u1tptnmoeiys m umumonu4 ltnir3to1faD  n i;s)srtoim3nu1llen fcia(  Durur ou1tpt mi3iatlm2elnms u)tlxrxr3iatoa r ueo;t0srtmxo nu1amtnmncta(farrmx oot1olxn ocias s2rlumsnt0 ltnxfciadlpte n olt) 2xmxr3nodal nmnvi s s2tmxmpoo1oet  o3iydfs ea(vo;u4 reoif3iatopt liei;()t2xrxopiy1lleelivi ()srrrxro;u4aetnmieildls ulnmont)tlerifctatfa e ueolt0 rxmir3oydamen fvs s)srtrxr oo4aex ioeiyt mDrlnms (0aetomr ta1faD au ilt) etmxr iy1lltnlies ()aDtr(mo;u4ope mieiyt aDeluvo;()aexomo3iadlp   iei;s)s2umxr no4ap emneias a2rrxr ;t0optnmociys sDeluvp (4 lermfcoytfmtranei;s tetmimpny4lp nmiei t)aDta(  ;o4apxn ictysfm2ul(vp;(0alxnxr3totlm r ivils)t2urio3ou1lpee fvt sfsDtmum oo0apenmfcilslm2emnms;u)alxnir3iatlaDr neo s  2xmim nydlp emnvslsf rurxm ;t0ale moetydla2eau sn(4teenir3tadla rln slt) euoirpou1llt  ivsltfsrrrxrooo1oltomi3iydls2rmu o u4tlxrioctatlmD aiei;s  2xrxrpno4lp   fcilsfsrrmxro;t1opxoiieildfa umn s u0 rtnmrctydlm  ai sl( texr(opoudomtn icsa( srurx oou4opxn f3tyt m2rmnmonu4trxnxocoy1fm eanvilt)teto(mpny1apeemfcsls)aDrm(ro;o4apeomoetyd m ulu p u0tetoxf tydomtelnvo;t)srtmimpiudllte ivilsfsrrru p;o1olxoio3tltfs2ean p;u4alenxocta1omDeauei;()trxoir3iu1ame lfei s)s2rr(rpnu1tltnifciyslm rluvo;t0alxnmf3iytlptelu s ()trtm(o oo4lpen feils  Dtrxrp;o1tpt mfcils s ra(ms;u4 rxoio oa1omte u i;s0texm(opio4lm   ieias)aDtm(  ou1apxn fctatls2ean s;u)tlerxr iatopDr uvs;s0srurir3oy1amtelnvi t sDra(mono4tlt mictat aDemnmsnu0 rtnmfciy1fmD  nvs s  etrxr no1apt  ivsatfa2umur nu1opxn feiyd a ul(mp u4alerxo3oy1laDrau o t sexrirpno1lm n nei ( a2tru ono0tlxo icildla rlnvo u4arxrir3oydla rai o t) etrir3oo4amen ivi s srtaxm no0olenmoeild s2rl(vp t0texrifcoadopteauvsls)trxm(o3ou4ap n ivia() Drru oot4oltnifeiytla2rlu o;u4aeeoioctytlmDrluvil( t2tmxr3nu4op nliet t sDra( ont4apxoioctat a2el( ont)altnmr io1lat  ivslt)t2xrir oudapenlfvtas) Dtmx onu4oleomfetltlm elu o;(4 ltriociydomDrli s t0s2umimpno1ap e fesltfs2ururont0tltn f3iad sDeanvon(0aexrxrcia1lmDraueo;t  rxmxo3oudam e fetas a2urur ;u4alx  f3ilt a2eaump;u0 exrir3ia1fmteluvil(0 exm(r oy1optn nvi (f Drmu pnu0tltn feiltfa2uanvo;() lxnxo3ia1lp raivs;s texrim3ou1am n nesatfa2tmxmpnu4tptomf3iadfa2el( on(0tltrir3ia1fmDe ivi s0 2xoiopoydamte ncs t) Dtrxm nt0aetnmo3tadfm uau p ()teerxr3oadfm eau s s  rtrir3iodolt mfeta(fa2rmu pot0altnio3ilslaDulums;u0 leomrciotomDeln ol() 2tr(opoydaltelict s aDtr(rp;t0aptnmfetls m rlnvs;()tlxoio tytfmDrlueo ( srtm(rpiy4op   fet s  Dtr(mo;o1tpxo i3tydls rauvont0arerio3totop raues;s0t2tmiopno1lptn nci s s2tax pnu0apxo feildfs2um(vonu4artnxr3ty1lpDrlu i;s  rxriopoy4omt  ncsa()sDrr(r no1opx  ociasfa el(vp;()teenif iotfm   i s t)s2xoirpiydope  fesat)aDraxmo;t1oeenmo3iydlmDrluvs t0 lxrir3tydom   uvsls texr(rpou4am emfvtl( s2ra(m ;t1oexnmieiyd a elnvo;(0trxrxr3ootlpDe ieo;t0s2to(r3iy4lp n ncsatfsDurxr ;t0tlxoiociltla2umu snu)tleomr tydfat  n o ( t2tm(rpio1am  mfcslt)arrrurpou0aeeomf3tytlm eaumont0trtnmr iydfp   uvs s)setm(m3oo1ol n ivt tfsDtau ont0ape ifcias s2ua(vp;u4 exoxoctydlm rai ols)srtm(rpiydamt lnetasfa2taumpou1oex mf3iydfaDeau p;u0arenxo oytomtr u o;t)setoxo3oy1ap  mfcs sf Dta(m no1ape iicild m ulnvs;u4treoxo iatoaDeluvo;t0sexrxr3oudom  miet (f Dtaxr nu0tpt  iciydls2rm(msn()texoio ty1lmD  u i t)setoxr ou1lptn ivtas  ruau  no0opxnif3iyt m2emnvs u0arenmo3tydfatrliei;( tetoimpiodoptelfeslt)aDurx ont1tee mfcils a uln snu0 rxoxr3ta1fatelu o ( sruoiopiy4oltnmfci sfsruru ont1tpx mf3iat s2ua(vpnt)teeomf3ty1omDr nvs;() eurio oo4lptnmnei s a2urxro;t1teenmfetlt mDea(ms t4 exrio3iadlaD aiei;t0 rxr(r iy1altemietatf Duaxrp;o4opeoifetatlaDrln s u0alermo3tydomt li o;s)texr(r iydlmee fci (fsDumuroot4olxnifciatls ua(mp t0 rxomo3oa1oaDeai s t) exm(r3nydll elivs s sruauroot4alenii3ils m el( sn(4aetnmoctodla  lnes s  rto(opoydlmtnmnes t a2um( p;t4opxoifciyd aDuln p;()texnmociatomDr uvolt s2xo(m oodam  livslsfsrrr(monu1aeeomoeiatfs ulump;t) rtomrctotfmteanes;s)sexm(r3io1llte fcsas)aDurx o;o4tlt io3iltfs2rlnms;u)trtniociatlm  au s;s)s2uo(o3oodop nmfct t) rum(m ou0oleoifciytla emuvo u) rxomrctotlaD aiei;s s2umimpiodom   nvt sf 2um(  ;t1tptnmoetydlmDumnvs;u0 eerif3tadla e nvsl(0s2uoxopnu1am elivt t)s2rax  ;o0teto o3tldlm uanvo (0teerio3oatoaD ai s;(0t2to(rpny4lltnlfci t a2urx  nu1tee  fetatfa rl(vp;u4aetnmf iytopDraneo s)setr(m iodap   icils)s2urxr nu4altoioctadfmDranmp;t4artnmo tytfaDr n s ( trxoim3nu1llen nci s)srra( oot0aetomf3tyt sDean s;t)tetnif3io1fm  an i ()srxr(rpnydol n ivt s srra( o;u4tetomo3ilslaDea(vo u4altrxrcia1lmDrln s s0 2xm(mpoy4lmee fesl()srta( poo4tpenmfeiyt m2elump (4trermf3iatfaD ai sl(0texo(mpoo4lltnmici ( s2tmx ont0optnioetat a el(mo u4alxrif3ta1fpD  ivil(0srto(o3iy1apenmivta() 2urx  no0oee  f3iydla2ua(vpnt4 ltoif3oytla   n s () rtriopiudapeemivsas) Dtrx  ou1tetomfciad a2ulnmp (4aeenxo oy1lp e i s;( trurim3nudlpt lfvslsfsrta(r ;o0oetomi3tatls2emnvo () rtnif to1oat lu ol(  exr(m oodalenlncslt arrrx poo1aee  fetyt s2uauvp;()trtnxrctatom e nes;s) rtoxm3oo1lm  lneia(fsDrrxmpou4aleo f3iasfa ranvpn(4aleoxf oodfpt au o s truoirpoudole lnct s)s2uax p;u1apeo ictlslmDulu p;()tetnxf tatfm eauei;s trxm(m iodlleelics t) 2rrumonu0alxniieiys s2rlump t) rermfcoytop eaivolt  etm(m ou4al  mfeiat  rur(  oo0teeniieildlaDem(monu4 exnxr3oy1fa  livs;s)sexm(r3oo1lptelfcs (f rrau pno0texnifcias m2eaumo (0tlxoxf tatlptr ivo;s0trtrirpny1ol nlnvs () 2ur(moou0tleoioeiydla ra(ms;(0aexrmf3oatlaDeanvils0 2xm(m no1opeelfesltfarurx oot4tlxo fetldfa2uauvon(0teeoxociotlpDrli sls) 2tm(r3ou4ole lfvt t sDraxro;t4oexnio3iysfmDean p;(0tltoxrcoa1opDelueol()t2tmim3ny4am emiviat)sDrrx ont0opt ifetasfs2ra(vo;()alxomr3iy1fpD lu i;( t2umxrpno4lptnmfes ( s2rau  ;o0aet mfcilt aDuau p t0aeerxf todop  lnei s0 rtr(mpiy1opt mncs s s2tax pno4tlxo ieiydfs em(vp;t)aexoif3oatom   u sl( t2ur(opiydapeelfcias)arum(m ;u1aeto oeils m el( snt0 ltoxf3oydoat livs (0t2tm(m3oo1ope  ictlsfa2umump;t1ale ioeilt aDemn p u4tetnxf oydoptr neo s)srxr(o nodoptnlfvta()aDum(r no0tpxoifeils a ea(vs;(4trtrircta1lmtrlneolt)texrxm iu4omeelictl(  Dra(  oo0apt  o3tytfm2uau p ()tltnxo3iytlp   ivs;s) eumxr3oo4apte feil()sDumxm ;u4oltniicias s2ean p;u0altomfctotfaD  ies;s0 etrio iu1aptemiet s) rtm(r ;o1aee io3tat sDrmn p u4tetnxf3tatomte uvi;(0trur(r3iy1ll n iet (fs2rmu  ou1altnmiciltlm2ra( s t4trxoif oatfmtelneolt) eurir oy4am nmnvi sfsDtm(mp;t4tetomieias aDrln o u4 renifcty1op e u i s s2xr(opnudomt  fvi s  2ta( ont0apx if3ildlsDeluvpnu0 etrmo3todfpt  i i;t  rxoxo iodlpe lnes ()aruru onu0alxomociydla2rmnvont4 exnxocoytomtr nvs t  rxmim3oy1lpe  ics ()s2ta(r ;o0openiociysla eau p () reoio3ia1omtr u s (0 2uo(r ny1lltemieils) Drmx ont4aexniictls sDumump t0aexrmrcoodomtr n s;s0seurxm3ny4amtelivslt) Dtrxrpnu0aet ii3iyd aDelu s (0tlxomr3totfpteai s s)t2urir nu1lptelnvia() rrr( pnu0ape mfciatfa2ua(vp u0tlxrifcio1fmD lies ()s2xm(o3oodapenmics sfaDurx o;u1opxomfetadlsDeluvo (4aetrmfciodlpte u ols)trxrir3oodomen fei t  2uauro;t1opx ii3tltfm2em( s;u4tetomoctatfpt  ivi;t)trtmxr no1lme mnes s srtr(mpnu1oexoiocildlm2ulnmo ()trxrmr3ta1omDr i s;(0s2xrio3ou4omeelnvtatfa2rrump;u4tlto ieiysla uanvp t0 lenmf3io1fm e i o;t) rtmimpio1ol  mfvtltfa2rmumpnt0aex  ietyt aDran s;t0 lxrxfcia1om   nvo;s s2umir3iy1am nlnvtltf Dtr(mpoo1altoio3iad m2rm(mp u4alerir3iotom eaiei s  euo(r io4lm  mfcilt  Dtau  no1alenifeiyt sDrmnvo;u0arermo oa1lpDrauvsls) 2tmxmpoo1ll n ivilt arumx o;u1aex iociydfmDel( p;(0aeenxr3iatlp r ueilt0t2umxm oodomen icslt)artaxmpot4apto i3iat m eluvp (4 eenir3tydomtrlu i s)trxmxr oy4llt lfcs (f Dtm(r nu1tlto oeiysfmDulnmsn(4 etrxo3oadoat lu o t) 2uoxmpou1lpenlicslsf Dururp;u4oexn f3iltlaDrm( p;(0aetrir3oo1lmtrlivsl()s2trxo oo4ap emiet tfsDrr(mpot1olxo octlt aDemnvont4 rxoir3oadomt  iei;()trtrxr3ny4olenmfciasfs2rru pnu4tptoifcild m2ran ont4areomf3iadoaDr n s s0s2xoio iodaptnlfvt t a2trxm ;o4opxniictldlmDea(vo u)tlxnmr oo1om r ieilt0trurxm oy4lleeliet s s2umxro;o1olen fcildfaDuluvs;()alerxrciytlmt  nvi;s)srtrim3io4ap nlictas)aruau pot4oexn icildfaDelumpnt0 exnir3iy1fm e nvolt)seuo(r nudomte nvi (  2rmxmooo4aptoiietls s2el(mo t)altrmr oy1faD anvs t)tetr(o3iu4lleeliesls) Dra(mpot4tlto ictltfa rluvp;t0 eenio3iatfm rluei;()tetr(r3oy4apen fci tfa2rru pno4texomf3iysla2uanvs t) ltoxfcto1opte u s ( t2urxr ou1al emiesa(fsDurxrpnt1teenmfeilsfsDulumon()trxomfciy1lptrlnes;(0 rtmxmpiy1ol emneia(faDtm(mo;u4tpxo feiyd mDum(vsnu4arxoifcootlatraiei;s) 2tm(o3oodamtnmncta( srrmump;u1alt ioeiltfs rmu p t)altrmr3todomtran o t0s2urimpoo4aptelicsas  Dururpoo4olxoifciysfs rauvs;t4arxomr tadlate ieo;( s2uoxopoudopeemieiat)aDuax  nu0oee ioeildfs2eau s u) etoir oy1oa rlueo;t) rtoxrpoudamtnmfctas  Dtr(m ou1tlxniictys a uan p;t4arxoio iatfpDeai s s0trtrirpiy4ap nlicia( arur( p;o0ape io3iyd sDemn p u4aeenxo totlpD auei;t  2uoxr nu4op e nvta( arrmxm nt1tet miciydls2ua(vonu4alermo3iydlpDr uvs (0srtrxopiydoltn fvs (fsrrmxr ;t0tpxo feiatlmDra( p u)texoxr ty1fa r n o;t setr(m3ny4omee nvt ()artaxmo;o1alx moeiyt sDrluvp;(4tlenmr3todlaDelivi s s2toir iu1alee fetls)a2taurpoo1tlx moctldla2raums u4 lenifcto1oatr i sls0trurim no4ale lietl(fsrta(r no0teenmo3tas m2ulu o;()alxrxr oytop eaies t) exrxr ou1op   nctlt)s2tm(r ;u4tet iiciat aDelnvs;u0 ltnir todom r i s s  rtoxo oodll n fctat)aDrmu ooo4aptn i3iasfa ra(mp;(4trxnxr totoaDeanvi s0srur(m3ny1omtelict tf rtaumoot1apxoioctyt a2rm(mp u4aleoxr io1lmt auvil(  etmiopoy4lpt  feiatfs2urx ooo4opxnmo3tadfa2ulnms () ltoxo3oodoa eanei t) rxrxr io1alee fvtas) Dra( pou4tlxnmietls a2uluvs (0trtnmf oa1fm  auvs ()sruoimpiydam emieilt) rra( pno1tlt mictad s umu p t)tetrxo3iytfmtr nvi s seumxm oo4apee fvilt)a2ua(rpoo1oeenii3iad a2uanmp u)tetoxf3oadomDeaivsls) etrxo no1om elfvsatfarumumpnt1oeeo oetls m2ra( p (0trtnxf3iy1fatr uvsls) rumxm iy1apt  fvtl()s2uru pnu0tpxoio3tadlm ul(mo ()areomoctatfaD anvs;t)setrxo io1lpeemncsa( arrmu pno4oexnmicias a2umnms;u)aeeoif3oadfmD  ivo (0trxrxm nydoleemfvi s) Drr(  no4oex mf3tadlm eanvo;u)areoioctadopD aies (0 2tmimpiu1lm emfvtl() rrmum ot0tltomicildla umn p t0trtrxfcootfm rauei;t trtrxo3oudale  icia( s2rr( p;o4tptnmfcilslm2rm(vo;u0 etnmr todfpD aivilt0 exo(r ou1ol nmictlt)s2umumont1tex mo3ildfs eln on(4 ltnmoctydomtraieo s trtoxrpnu4apenlnvs t sDtaxrpot0teeomi3tyt sDranvo (4tlxoio3oa1omtraueilt0t2uoxo nudoptelnvilt)arumuro;o1tpeniieiydfs ranvsn(4texrmrctadoa r u sls s2xrim iodol emictat)sDuau poo0tpeo iciytla2ra( o;u4arxrmfciatfaDelueol(0 etr(r3oy4amen fvtas aDtmur ;u0texn feiysfmDulump;u4 eenifcoa1laDraivi t0sexrir3nodlltn fvtas aDtr(  ;o4oet ioctytfmDea(vs;u0 eeomr3ootlatrai ils) 2trxr iydapeelici t  rumu  nt0ape mfetytfm emnms t) exoxf tadlp  livo;t setrxo iodap nlietas s2tr(m oo0apeo oetyd aDeau s;() rxoif3iodfpDrlnes s)s2umxm iy4lmeemnct t)srtm(m oo4tpt i
\ No newline at end of file
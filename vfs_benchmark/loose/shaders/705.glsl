@@ -0,0 +1 @@
+u ol( srto(m3io1lltnliet s)srtm(r no1oleo fctltfm2eauvsn() renir3oytfpDrauvo;t0t2uoiopiy4ol n neilt  Drrum ;u4opt  i3iltlm rlu s t4texrxr3iy1faD ln sl( s2xriopio4lleelneia(fa2rru p;u1opx ifciadla ulnvp;u)aexnxo iatfaD luvo;t0 2trxrpoodomtnmnei s sDum(r no4opeomi3iatlm raumo (0 ltrmr3iatlatrauvo s0 exrxr3iu4lmte ietat)aDrmum nt4aleniiciyt a ra( o;t4trxnirciytfa r ivi s  rtm(o3io4om elfcs tf Drr(  ;o1tlxnmocilt s2rmuvp;u) reoxr3tydfmDeluvi;( trumio io4apenmnetltfarrm( p;o0tleo octas s2ua(vsn(4altnmr ty1fp raneo;t trxrir oy1lle  ivsltfs2rrx  ;t1alx mf3iytla rm( pnu)trxoxo oadomteaivi s) eurxr ou4aptnmncilsfsDtr(rp;u0tpxomfctysla2rauvo;u0aeeoxo3iotop elnes;(0seumxm iydlltn fvt () Drrx oot0teen ieils a2rm( p t4areoxr3tatoat  ivo ( t2urirpio1alt  ncsltfsrtru onu4alx ioetasfa2ua(vs u0 rerxf tytoa rai o;s  rum(m3nydam emivt tfaDuaur nu4tet ifciad aDrm(vs (4 rtnmr iodfaDeanvi;t)texr(o3iy4lpen icsls)srrrumpou4olxnii3tltfm2em(mo (4aeenif iy1fatr n sl( sexoiopiy1omt lnvsl( sDraur ;u0aetomoeiytfa ul(mon(0 lxnmocia1oaD luvo t)tetrxo3nu1apenlnci s  Drau oot0ale mietatfa ua(mp;(0tetoxrcoatoate u o;s)sexo(mpoydol elnctasfsrtaum oo4oex iieias sDuanvpn(0 etnxo oa1fa rlnvils)trur(o ou4altnmivtls)a2tax ont1olenii3iydfs uluvsnt0teeoir oo1lpDraivo;s  ruo(o ou1al  mncslt)s2rrumpot4apenmfciyd a2rlnvp;(0 reoxf3tytlpt  ueo;t  2xm(mpoodalt licia() rum(m nu1ole  ociasfs2emnmsnu4treoxr iy1om r ues;(  2urxrpnydop   fviasfaDuaurpnt4olxnioctlsfm2rl(von(0tetrxf3tydfa  luvs (0t2to(o iodlm nmnviat s2tru oou4tex  icilsfa ra(vsnu4aeeoxr oy1faDrlivolt)s2xo(o3iudapen fcslt)a2rmxr ;o4tlxomieiad s2ea(mpnt) rtnxoctatlpt  nvilt s2xr(m io4lpt  fcs t  rtmxmpou4optnmfeiad s2rmuvsnu0texoxrctotlpt  ieil() 2urxopou4am nmnciltfsrtmuro;o0opt  fctls aDul(msnt4 ltnir3oytfa eluei;s)srxoxr nu4lltnliei t) Dum(moou0apx mfcilsfmDea( p;t0 rtriociadlmt li ils) rtmxm nu4lm nmnvslt) rua(  nu0tpx  oeiyt mDua(vo t4 lxrxr3oy1oaD anvi;( t2xmir ny4ap   neil(f Dururpot0ole iiciysfsDumn o;u)texnmf3io1lmDraivilt0texmxrpoy4lm emieias  rtaxr nt4apeomiciadfa2eanmp t0 lxnxf oa1fmtranvi;s trxmir3io1lpe  fcias)aDtr(mp;o1apeomoctaslaDrm(vo u)trtoifciodoa eli sls t2ur(o3nudope  iet tfsrtm( onu0aexomoeiysfaDuan pnu4aexoxfcoytlp   u ols)trxm(r3oudlm   feias)aDtau  oo0texnmfcildla ulnvo;u0trxnio3todfaDelieo s)sexo(r3iodop emieia(f 2rrx ont4tleomi3tysls2ranmonu4aexnxr to1lmD aivsls0trxrio3oudam e ies (fa2uaxrpnu4alxnio3tasfs2elu pnu4 leomfcoa1lpteau ols)srur(m iu4apen fvs (  2uau  ot4alxnioeiadfm2umnvs t) rtrxo oytfpteanvils sexm(o io1op elicils s2ra(r ot0olxo oeiyt m2ua( s;u4 eenxr3oo1fpte i i;( setrio3oo4ll e nviltfs2trump;o1apen oetld mDemnmp t4trxomrctydfpDrlieo s0trxrxr no4ole mneias aDtrumpnu4oltn fctas m2rl( o u4artrxocty1la  aies;s0trxriopno1lm nmivs s) rrmx o;u1aexoiictydlm rmu p t4 lxoxf3iotlpt liei s0 2xmxmpnodlpenlfcs ()aDum(r oo4alx if3tltfs emnmp (0 eermo tatoat aivs;(0 rtrxmpny4opeemiet s) Duauronu1apx if3tat aDelumo t)texnxo oa1op  aieo;t0trxm(m3oy1aleemicsa( a2trx  ;o4tlxnmfciadla rl(mp t4 rxrmrcta1lm   ieols)trur(o nu1oleemfvi t)arum(  oo1oltn f3tas s emnmp;u)arxoifcia1lmt aivol(0 2ur(r3iu4optelnvil( a2tmu  ou1optn ieilsfs uau s;t0arermf tytlp r i i t  2xo(r ny1apee ncsa( sDrmu pou4tpxnii3iasla2rau pnu4trerxr3tydfmD auei;t s2urxr3oy1ll  lneslt)sDtrur ot4oex  feiyt mDrmn pnu)aeenmfciy1lm eaies t0 2xrim3iydal  lnvt (f Duaur ;u4tlxn o3ils m ean p;()tltrxr3totfmDr nvol(0srtoimpio1lptnlfvils) rrrumono1aptn feiadfa rlnmpnu)tleoxociy1op r u sls trumirpnudllt mfvtl( artaxrpoo0tle ifctydlmDrlu o;t) eeoif ia1oatrli ols0 2urirpio4lpeelivi s)s2tm(mooo1apx mo3tyd s ea(mont0tetnif3ia1lmDr ueslt0 2toim oudape mivsls)aDta(mooo4aleniictltla2ulnvs u4alxoxrcoo1faDr nesls s2xm(rpnudomte ivsls a2umx  nu1opxo oeiysfsDemums;t4aexnxr3ty1lpD an i;s0 exm(o oy4lmeemiet (f Dumurpot1tpt  o3tydla2ul(von(4trxnmo io1opD lnvs;t0 2umxr3oodameelnvt sfsrum(mont4apeniociyd sDelnmo (0aetoircia1fatelu s t  2umxo iy1lltelici s  rur(  no1alto f3ilsfs2rmn s u4 etnxfcoa1om  lnvi ()texmim ny1ll nlict s)s2ua( p;t0teeoioeiytls rm( o;()tleoio oadfmDelivilt)sexrirpoodal e nctls  2rm(rpnu4altnii3tas m rm( p;u) etomfciodlmt aivo;(0texm(o3oy1aptnmivs sf rrmuro;o0tpe  f3tas a eau snu)trtnmociydomDeluvi;t) eto(m3oo4openlictas) 2tm(m nu4oeeomo3iadlm ra( snt0 lenxrcoy1oaDeanvs () 2xoim oodalenlieia(faDtmx ont4opxnioeilsfm2ea(mp t0aetoir3iotop r neo;(0tetoir oodamee fes () 2rm( oou0apxo ictaslsDel( p (0tlerxo3tytomDrlueo;t0tetoio3oo1llenmnviasfaruaum ;o1alto f3iydfsDrm(mpnt0 eenxf to1opte nvol()teurir oy4ame  ivtls) rtr(mooo0ape iocias aDrmums t)artnmo tadfa e u sl( trtmxm oo4optnlivs tfs2ua(  nt0tle mietadlsDemnvo t0aeerxfcoodfp e iei;t)s2um(r nudaltn ivs s sDtr(mp;u1oex mfciytfa eauvp;()alenxociytopD li ol()sexo(o io1apen fvs s aDumu ono1aeeo f3iltlm eanmo u) exnmr oo1lm  aueslt)tetrirpno4lmtemnvi ()sDrr( poo0teenmfetatfs2rmu o;t4aexnir iydlm elues;s0s2tr(o io1llenlfciat) rtaxmoou4olx  fciys s uln snu)aexrxo3oy1fate ieol(0setm(mpiu4lmtelncil(faDra(r nt1apxoii3tydfaDelnvp t0 eermfciodlaDranvi;s0srxmxo3iodamenmfvsa(  2uru  ;u1tetoiocildfm umu onu0 etoxf oydlm r iei (0s2xmxm3iy4ome  netatfarrmurp;t1optn o3iydlaDum( o ()tlxomf3oo1fmDeln o;t) ruoxr3nudlp nmfcsat  rrrumoou4alxnii3iys m2emnvo;u) etnmf to1laD lu o s tetoir ou4ole lies (f 2rm(m nt1tleoiociatfmDea(mpnu0tetoxf3iatlpD lnvs;t)s2trxr nydap   fvtl( aDtr(mpou1apt ifeiytfs2uaumsn(0tltrir todlatrauvil( sexrxopio1lp nmivtls sDtmurpnt0tpen i3ias mDel(vs;t0arenxf3tadlmD  i s s)s2xoirpno1lle lfeslsfaDumumpot4tpeoifciadlaDrauvon()areoir3to1oa   ues s t2ur(m nu1am  licia() 2raxm no1tptomociysfs elu snt) rxoxfctadlatranvil()tetrio nu1om nmicsas srumx ono1optn oetasfs emnvsnu4 exnif ia1fpt luvils)sexmir ou1olen ivia(f rta(m ot4tleoifciydls2um(vo;u4teeoxocoadlp elnvolt0trtr(o3iu4altnmnctls s2rmxro;o4tpxn fctldfa2ua(mo;u)alxnxr3tydop r uvi s0 rxmim oudlp emfesl(fsrta(mp;o1olx iieiadfaDulnvp u) renio iodlateauvi;t0 rxr(m3oodlp emfei t)s2umxm nt4tpxnmfeilslaDrl( onu0aleoxociytom elues t srxmimpoudop  lietlt  Dumx o;u0alt iiciytfmDeau s u) leoir todfmD lneolt  rxm(r3iy1om  mict sfsDta(r oo0tetn ietatlsDulu o;(0aleoxr3io1fmDeanvslt)trxo(m3oodlm  livs s artax pot1tpx mfcilt aDuluvon()trxomo3ootla rauvo s0t2tmxm3nodlmenlict t srrrx  ot1olt mieiaslsDulnms u)aexnirciodomtrli s;()s2um(m iu1lm emneia() 2um(  no4alxnmoetld s rlnmsnt)trxnir ia1fpD lues;(  2xoir nudll  liesa(fa2tmxrpno0tleomfetat a rauvpnt)tlenir3iodfp r nvo () rxr(opno4omtnlivta(f 2taxm ;o1olenmfeilt a2umnvont4areomrcty1la elnvi ()s2tmimpoy1lltelfeslt)srtruro;t4alxoii3tyd s uan s;t0tetoif3to1lp  anvsl(0 rxm(m3ou4lpt lnvsas)srtmx pou4ale mi3iadls2ranmsn(4 rtomf3oy1la r i o;t0trxr(m3nu4alte fvt s  rurx o;u0oexomfctytlmDel( o;t)alxomr3oa1oaDrluvsl( tetoirpny1apenmfvsls s2rr(  ou1apxn iciys a2rmn p ()texrmfcta1oateluvo t) 2urio3ny4omee ics sfs2tmx  nu4teto ieild sDuanvo () lenircia1late u i;t trxr(r3ny4aleemfvtls) 2urur ou4open ieiat m uaums;(0 rtoircoa1late uvsl( trxmir3iy4ap nmies s  2ua(ro;u1tlxomoeiytfm elnmsn(4 lxnmo3iotlaDr neil(  rxrxr3ou1omee nct s)aDta(rpnt0tpeoif3tls m2rlnvs u4 ltrif3tadlpDr uvols teuoimpoodomenlnctlt) 2umuro;u4oltn i3iys m2em( pn()treomo3iodom raivo;(0 2tm(m3nodale micils) Drmu poo1ale  o3tydls um( p;t4artnmf3ta1lpt lnei s) etmxr3iy4aleelietl()aDua( p;o4olt  ictytfs2ua( onu)arerirctytlaDeli s;t  2trxmpnudomeemfvta(  Dtr(moot1texomoeiadlm ra(mp u)tltnio oatfaDr u i;s teumxm oy4ap elfvils a2umumo;u1tetoifciltfs um(vs u4teenmf to1lp raueil() ruoirpnudoltelfcsasf 2ra( pnu0altnmo3taslaDelumonu)aleomocio1la rlivils)seuoirpoy4ole  nvia(f Dtru poo4tpe  icilsfs rlnvp () reoio io1fm r n olt sexm(o oo1omt mfvs t  2ua(mo;o1optomi3tltls2rauvp () rxomrcootlmtranes t  rumir ny1optemncta()srrax o;o4texoioctld a2rmn onu4 exrxr3oa1lptelueo;s)s2toim no1opt  fcsls)sDrm(m ;t4apxnioeils sDemnvpnu0treoir iotfpD lueo;s0t2uo(o iodapt lncs sfsrurx pot4ope mfcild s ra(vp u) renio3iodfp r n o;s)s2tr(r3oo1lmt  ieias) rururonu1oetnmf3iaslm rluvs;u4tleoio3oydoptrln olt0 2urxopny4ameemiesl()a2trxm ot1oleo ociasfa rmn pnt) ltnif3tydfa e nei s0 2uoxmpiodop n fetlt  Dumumonu0aptn ieilsfs emumo;u) rtrmr oodopt au o;( teurxm3ny4lpenmfcslt sDurxro;t0tee ifeilt m emn s u)trtrif3totoa r ivo ( teuoxopny4ap elicilt)s2uax o;u1tlxoiictadlm eln p;u)tlxnifcoatlpte nvslt0sexmir3ny1op e nvs s)aDururo;o4olxn fciydfm ranvpnu)aetrio io1fat aneolt)trxoir nu4apee ietltf 2ururpnu0apxnmf3ilt m2ean s;()tetnxociydoaDeaueol( s2xmir3iu4amt mivt t) 2tax oou0texo oeilsla rlnvo (0trerif tytoaD aieils0srtmxopoo1lp elfctls)sDtrurono1teeomicils s rm(vp;u)tlerio tatomteau olt0t2um(o nudopen fesa(  rraumo;t4oeenmi3ildla2ulnmsnu4trtrmo3iotfmt au il() rtrxopio1optnlnvia()sDtru pno0tlto fcildlsDem( on(4aexnxocoatfat  nvols  rurir no4oleemnvt (f 2tm( oot1ole iietat aDelu snu0aeeoxr3iodoaD aueo ( srtr(opio4ole mieils)arrrxroou4opxnmf3iytfaDrmu o t)teermf oadlatr i s t  rtoxopiodapen netlsfsrur(rpnu1tpen oeiydfaDua( o u)artnif3iydfpD aueo s)setmim3oo1lle  nctasfsDrrum ;u4teenmfctatlaDelums u0 exnxocio1optranvs;s)setm(rpiodlpeemiet (f rrmuroou4opxomi3iytlm umn p;t4aeeoiociy1lmteaivslt)t2triopno4llt  icsl(f 2rru  nu0ape  i3tysfa2ea(vpn()areoif ta1omt  uvi t  rum(opou4oltemivils  2tmu onu0tlto f3ils m rmu s ()trxrio3iydfpDelieolt teuoxm oo4am nlivs s s2raxmpot4oet iociatfs2ea(vont)arenxo iotop ranei t0t2trimpoydop   nci t) rumx  ;o0oeenioeias m2rm(vont4 eenir oy1oa e n il( seto(o3ou1amtemivslt) 2raumpno4alx mf3ils s rlu s u) ltnmrcoo1fm e n o ()s2xrxo io1lpte ivtas sDta(m ;o1apt  ocilt m rlnms u4arerif3todlmD anei;t)setm(m nodap  lfctl( srurxront4tee mictadfsDea(vo;u4texomf oo1fpD li il()trurxo3nu4opt mfvil() rurxmpno1alenmi3ilt a emnmp;u) rerif3iatfaDraivs;() eur(rpnydal   nciatfsrtmxr ;o0open i3iatls ua(mo (4aleomfcto1fpteauei t0sruoxr3nydalenmfvias srum(  ot1tpxnmo3iys a umumsnu)aetoxo oadlatrlnvslt)sexrio3io4optn fcils s2rrxrp;t4tpe  fctlt m2emn s;u0tlxnmr3oadfpDeluvo ( setoxopio1omenlfctltf rumxroou1tlxo feiysla2umnvpnu4 ltrif totfmD  nes t) 2trxopnu1lpen ict t aruaurpnt4oeto iciadfm2uanms;(4artnxociadlmDe uvs t0tetrxo iy1lptemnesls a2rmxmoot0tlenif3iatfsDranmo;u)aetrxo3tytlatran ol(0trur(r oy4opte iciat)sDuaurp;t0aptn ocilsfa em( s;u) eerif ia1oa   nes;t  2tmxr nu4lm nlncs tfaDta(ro;t1oetoiictydlmDel(vo t4arerircoytopt lieslt0 rxmxrpiodam   nvi sfartrxrpnt4teto feiydfs2eanmo;u)trermr3ootla eli il() eurxm3iu1lltn netat) Dur(r nt1aet moetytlaDulump;(4tetoifcoadopD aueo;()trxr(o iy4lpt mivi s) 2rm(ro;t0tee  octadlsDuau snt0 exrxf3ootoat auvi;t)srumiopoydap e fcsa( srrru  ot4oleo feiytlm uau pn(4altrif ia1fpt ai o;t seur(m3oy4oltn nei (f rtaxm nt4aetoiieiasfa2emn o;u)altrxrctotlate nvs;()s2umxr3ou1omeemivsls)sDrau o;u4alx iieiytlm uauvs;u4aleoir3ia1op   nvils) etrxm iudlp n ncs t)srtaxrpot1tetnmieiatls2eluvo;u0artrmf ta1oatrlnvi;s sexo(mpoo4ale  fvs ( srta(  no0aet  ieiadlmDrlnmonu4arxnxrcoa1fa  aues t tetoxrpoy4ome  ivi s sDrr(mo;t0aeto feiysfmDrmnmo () ltrxf3oadlp e n i;()t2xmxo3iu4oltn fvsas  2tmxmoot4tle  feildfs uluvo u0 reomrciatfptrauvi;s tetm(o nudamt mncs ()sDrr( o;o1aexnio3tyt s ulnmp;u0 renmocty1lpteaueslt)seumxm io4lltemietas artrum ou4teto f3iltfs rl( p;(4 lenmr iotfmDr u s t)tetoim3io4ole mfesa()arur( oou1oee  ieiyt s ul(msnt0 rtoir3io1lm eluvslt srum(mpiudale  fci sfsrtau pno1oeen fciltlaDumnmpnt0 ltoif oa1oa   n sls0trur(m oodlme mnctlt)arur(r ;t4alxnmfciytla2ul( o;t0tlxoif3oy1om eluvi t  rto(opiydole  ivilt  2tmxmonu1apx  feiytfa rauvs;(0 lenif tadop eluvi ()t2tm(rpoy4lp nmfvia(fa2tru  ot1apt mfciat aDrau onu0tleoxo3ia1oa rluesls0trumxo oo4om emfeias s2tmx pnt0aet iieiad aDelu s;t)tlxrmrcoydfmtr uei;(0trtmxo iodame  ivt ()aDrm(  no1opt mi3iatls umnvo;() ltrmfciodfpteluvi;() rtmxrpny1lmenlfeilsfsDuax onu0opt mfctatlmDumn s t0trtoif io1oa raivi;t0 etr(rpio4al n nvi s  rrm(rp;t1texn fctysfsDulnvp;u0trxnxrcoatfm r ieols  rtoiopoo1openlfctlt a2rm( o;u1oltomi3tys a ra( o (4artrif3oytlmte neolt)t2tm(r3ou4opee fcs s srrm( o;u1tex  oetyd m2rmuvs u0 etoio3io1op ranvil()setoxo ou1lmtnmfeslsfaDumurpnu0oet moctasfmDemuvont0 ltriocoo1fa ran s (0 euo(o nydlm nlivtatf Duaxm nu0aeeomictadlaDra(vs;(0texnmo oytopteau s ( setr(rpoudoptn fesas)aDra( o;u0ole iicilt aDel(vpnt0alermo oa1faD  uvilt0trxmxm iu1lltnlnvt tfs2urxrooo4ole mfetyslm2ranvsnt4arerxoctytfptr ivo;s0setrxo3nudam e ivsat)a2ra(rono0aexo fctydlm rmnmp (0arxnmr oy1oa raieo t0 eurxo3no1ole lnesa(f rtr( p;u1tpeo f3iltls2rau o t0arxnioctydfa   ivi;s sexrim ny4om  lneslt arrm(m ou0tlx ii3iydls2um(vp;u)alxoirctytlmtelies;(  rurir iu1lltemnvt sf rua(  ;u1tee  feils sDrm(msnt4 rxniocoatlateln s t) rtmiopno1omtnlfeiat)s2ta(roou0apt ifciydlmDelumonu)aleoio ty1lpte nes;s)s2urim io4om elnet (f rtr(rp;o4oetoiieiyslaDrmu o;u0areomociatlmDe ues t) exrxr iu4al  miei t s2urumpot0oee mietytla2umu o;(0artrxociy1om rlueilt0 2tm(o3iydaptn fvil( s2trxront4openio3iad sDelnvp ()alxoxf3todla   iei;() 2trio3nudopt  fetltf 2uaxr ot0alxnifeiytfs2ulu snt0texnio oodfmDr uei;s)sexo(rpnudolen nvsatfsrta(monu4teto oeilsls ulnvs;u4 reoircootoa e ieol(0trxm(m iy1opee nvtas aDtaumo;u0tetomieiyt aDuaump u0aeeomrcio1fmt  nvo;(0srxm(m oo4ap  miei ( arrrx ont1olto i3iysfs uln snu4 lenmr iatlm r ueo () etrim iudape  fvslsf rtmu pnu0tpt ifetlsfmDem(vsn(4 exnmf iotlmtrluvo t  exo(r3iu1ameemfes t)s2raxmpnt4tpe  fciasfm rm( snt4tlxrircoodlm eaies t  2xmxmpnu1optelivs tfsDrr( pno1tpe ifciat mDuan o (0 eeomf oydop r neols  2xoxrpoo4ol e ivsasf rtrumpou0aee mf3tldfs elu p;t4altoxrcta1lmtrln s;s)sexoio oy4lmtn ieil()s2urum ou4teeomf3ilslaDrmumonu)tltomf3oy1lptrlu o;t0trxrim oodll  mneias) rrau  no0optn feiys m2ra( onu0 leoif3ootlmDelivils0trto(r3oo4omtemivi s a2trx p;t4alxniietlslm2ua( p;u4 rxrircoydfaDe n i;( sexrir iy1lpt  fcias  2um(  ;t0altn ociasfaDem(mp;t) lxrxrcty1oaDrli sl(0t2tm(r oo1apeemnesatfs2tm(r ou4optn ociytfm ulnmo;u4 lxrmf iy1fmt li o t  2tmim iy1lmee ncilsfsDtru  no0aetnif3tyt m2eaump u4trtoirciy1omD aivi ()srtoxopiu4al e fesa(fsrtru pnu1oltnmf3iad a ua(mp (4 ltoxfcoadfm  aivs;() exoiopiydalt lnctas sDta(  no0tlxnmfciysfsDran o u) rxrmr oadfaDeaivs s0t2xoxo3iydap nlfcilt) Dtmxm ou1tpenmi3iadlmDrlnmp t) rtrmrcty1lp ranvsls0sexm(rpio1am  mivs t  Dtmu ono1olt ifctas mDulu snt) lenmf3ia1om  aivi t  eurimpny1llt mncsl(f rtru poo1tpx if3tasls2elnvp (0 rerxr3ty1fptr i o;t s2trxopnudamtn fvsas)s2uau  ot1alx io3iaslsDrmnmo;u0altniociydlmte i ils0s2trxmpou1lmee ncil(fsDrr(mpot0oexniictlsfm2ea(ms (4aetnifcootlat auvils0t2urir3oy1ll   fcsls sDurumoot1oleomicilslm2um( sn(4artnxf oodfptr nes;( teuoim3no4am elicilt s2taxrpnt0aee mfeias a um(vont0aeenmfcoytfmt  uvo;s0srxmirpoo4op e fct t)sDua( ont0opt miciltlmDelnvs t0 rtomr3oa1fpte ieol( texm(m ny1ap elneslsfaDtm(  nu4tptnmietlsla elnmp;() ltnmfciotomt  u s;s0 2umxmpoodope  netlt)a2tr(monu1aetn fctatfa2ea(mp t4tlenxf oodlmtr iesl(0teumim3iy1lm n fcsl() 2rmurp;u0apeoifctydfa umuvonu4tltrxf3tatfpt  n i;s) exrimpiu4llenlfvtlt)arrrurpnt4oee mieiasfa ulu o;(0tetrifciy1la rln slt s2xo(r3oudomtnmfct t srua( ooo1tet  i3iydlm2ul( s t4artrxfcto1opDeaies s0srumiopiy1lpeemiciat)artmx pno1apeo oeiatlmDulnvon(4tltoio3iydfp   neilt  exmxr3no4lmtemfcs s)a2trxrp;t4tee iictyt mDrm(vsn(0 ltnmf3oa1fmD aivi (  rtrxm iy1ome lnci s)arumxmoou0tpeo i3iadfa2ean s u0 eeoio3ta1opt livs t0 2tm(r3oydam nmfesas)s2uaurp;t4texn o3ilsls rm(mpnu4altrxo3ty1om  auei s0 euo(o3iydlleemiei () Dumxrpou4apt ifciadfs ra( p (4alermf oatfmteaneilt setr(m3iydom  lfvtas) rum(rooo4olxo ictytfsDua(vsnu)tetoioctadom rln i;t0 2xo(o nu4olen nci ()srrmxrooo1oeenioeiyd a uluvp;() exomf tytfmDr uvil(0 2xoimpiy4op e fvsltfsDtrxm ot4apt  oeias m uan p u4 eeoir3iytlmtr n i t0setmxo iydom elictas sDtru  ;t1oltn fctlsfa ulnvpnt4 rxrirciatlpDr nvo;t) etoimpoodal n ncta(  rtmum ;o0oetnmo3iyt m ul(vp t0alxnmfctadfmDeanei ( trtm(o3oudlmt  neil(fsruax p;u0ope  o3tld s rmnms;u0aexnir iodlmD liei;t sruoiopny1apeemfetlt)srum( ooo4apxniieiltfs uau s;t)aetoxr tatfp ranvslt) rur(r ny1lme  nvi (fsrrmxm ;t1tpxnio3tldlmDea(mont4trenifciatfm  an s;s0sruoxmpiu4lp e ncsl()s2um( poo4tlen f3ilsfa2emnmo;(4 etnxf to1oaD anvi (0 etr(mpoy4llte fet tfaDrmxr ot0tpxn ociatfmDemnvs;t4 rtoxrctotoptelueo s0s2umxr no1ope licilsfarua(rpot4apx mf3iasfa umuvs u4aexrmf todomteluvo;s0s2uoxo3iodll elnetl(  rtmu  ;u0aetoiieiadfa ua( p (0 lermo3ty1lm ranvs;() rxoimpoy1am elneiat a2rrx poo1tetniiciaslm2uanvpnt0aetomf3iodomtrlieo;t srtm(o no1lltnlfvils  rtmurp;t1olxn fciys a2ean on()aetnxf3oy1oa r ies s0t2um(o oydlptemfcia( aDtrur ou0aeeo ieildlaDua(vp;(0alerxrciodfm  liei s) rtrir oo1lp   ivsat)artrxroou4teeoifeiydfm2ra( onu4 eeoif3iodomD  i o;s)s2urxo3oy1opt  nctas) 2umx p;o0olen fctlt s2um(vo;u4trtomr ia1fm elivo;t)sexmxr nudap emicia() 2rrxrp;o4openmi3tysfa uauvs;(0 renxo iodla rluvs;() exo(r3ou4optn fcs tf rraxm nt4oexoioeiysfm2rluvo;t0altnxf3oo1opDr nvi;()tetmio3oo1op   nviltf 2trurp;o4texnifeiltlaDuanvp;t4 ltomrcia1lp  lneslt0tetm(m oy1olte nvilt  2ua(mpoo0olxnii3tatfa2ra( p t4aeermo iadoatrai i;()seum(r iy1lltn fvtat)sDtmx poo1alx moetadfm2rm(vpn(0texomrciatfa   n s (0 eto(o3oudlmen ies ()s2tru pot0altnifcild s el(ms u) rtrxr3oa1fpDr ieils truo(m3iy4lmeemfeiasfsDrmxmpno0opxomf3iydfsDrmumpn()arxomfcio1fa e n s t0trxm(rpiu4llt mivsas) rtrurpnu4tpe ioetat s2rlnmp;u0teermrcoydlp rluvil(  ruo(r oodopen fes s)a2rmurpnt4opx  o3iad sDrl(ms;u0tltomo3io1lp eaueo;t0 2xo(rpiodap nlneil( a2tmx ont0texomfctadlaDel(vsnt4texnxr3iadomteanvs (0trxmxr3ou1omtn fcs tfsDuauront0alenioetatfa2em( snu4 exomf3iytoa elu olt srxm(o3nu4aleelfcil(  rrrxmpnt0tetnifctatlm ul(vonu0 ltoif to1op  luvo;s) eumir iodlmeelnet () Dtr(mont1olxnmfciyslsDuanmont0trxoxfciytfmtr ieo ( t2tm(r iu1amee ict tfa2urx onu4ale mi3iltfaDea( on() exoifciatoa  aueo t tetmim iydlle lieta( aDumx p;u4apxn f3iydfmDrl(vpn()aexoxocia1latranei;()s2umim3nydopenmnctas) Dtrumpnu0tpxniociat mDrau o (4teerxo ootlpDeai s;t)s2trxmpoy4op   ncta()s2ra(m ;o4aee  ociadlm2uaums;(4aeeoxr3iatomt  i i;(0srtm(m ou1op  lnet tf Dtaxr ou1tpe  fetat a2emump;u)tlerxo3oadlat aieol( trxo(opny4lmen nvsatfs2rm(ro;t4olen ictyt a ul(vs u) rtrxr3ta1lpDr n ols0 etrio3nu1op nmfctasfs2taum ou1tpx  icias s ra(ms;(4 etnmf3oodlaDr u ol()t2urir oudlmtn fcs ( aDrmum ;u0olenifctlt a ua( pnu)artrxo3to1fa r iesls) rxoxopnydll  lneilsfsDrr(m oo0aeenifctatlm2ra(ms;(4 etomrcoo1fa e n s;( srtmirpou1alee iciat)aDuru p;t0aetnmociatfaDea(vs;t0 exrircootopt aivo ( texmxr iy4om e nciat) rrrurpno1tex ioeiatfsDel(vp t0aexnmocoatlmtrauei;(0teuoir3iy4lpenmfet s)artruro;t0tet ioetytla2raumo;t)arenmfctotfatrlueil()sruo(o ny4omtn feta() 2umu  oo1aleo fciydlaDea(mp;u0trtnxr ootlmtran o;t0texrxr3iudoptemfvtat) 2raumonu4oexo fetyslmDumuvo;(4 eenifcoytfpt lueilt srto(m3nudaptemiesat)aDra(mpou1oetnmfetlsfs elnmo u4tlerxf3iydomtranvi;s trxo(rpnu4opt  fvs tfs2rr(m ot0aet ifetlt aDrmuvo;u) rtrxrcoy1laDrlivi;t s2uoirpno4alt lnvtltfsDumu o;o4olenmiciatls2rl( o;t0arxnmo oodopDe ies ( t2xmimpiu4ape  fvs s sDtaxrpoo0apxoiictls a ea(vsn() eenxo ty1la rlueo;s0tetoxr3nu4lp nmiesat a2ta(mpot4oleoiictatlmDea( p;u) rerif3oydoaDrln i;(0t2urxm3oydal   ivs (f Dtrx  ;t4tltn o3ildls2ea(mo () rtnio3tytomt anvi ()srtm(o nu4lmtn ivilsf Drru p;o4tet mietasls2rmnvpn(0tlxnxociadoat ln o;s)trumir3io1omtnmivia()aDtr( pnt4teen f3tytfm2uauvs u4 rtrif oodoaDeluvi s t2um(m iy1omt  ictlt) 2rr( onu0oetoio3iysfs rau o;u4aetnio3oatom r u olt tetrimpoo1aptelivil()aDtm(r ou1apeo fctls aDra(ms (4altoio tytlptraivsl( srurxopoy1lpt livt t srtmumooo4opxn oeils m2eluvpnu0tetnir iatomteln i;t)s2umxr3iu4ll   fei (fs2urxr ot4texomietltfs2ea(vp;() rxomrcoodlpDranvi;t)setm(rpio4omtn iesat)aDurxr ot1oexoioeiadlm2uluvs t0tetomoctydop elieol(0 rxoim oy1al nmivtl(f 2uaum nt1tetnmo3iltfs2ra(vonu) exrmfcoatomt anei s trtrxm ny1omenmivsas) Dtaxm ;o0tpxoioetytfs ul(mont)texnmr iytlaDrli ils)trxrir3nudole miesls) 2uax  ;u1olx ifeilt aDulnvs (4treoxf3iydfmDelivo;( seum(m3oo1lp nlfeils) rur(rpno1oeeomfeiys a emn o;()alxnmo3iodoa  aneol(0srxoir3iu4lpt  fvsat)s2raumono4teen o3iatlm um(mp t) exrxr3iatlpt  ieo t)s2um(m3io1am e icias sDuaur ;t1tlenmi3ias aDem(vp t)tltnio3oydopDeaueolt) rumxopoo1op  lnct (f 2rrxrpnt1tee  oeiyt a uaums ()artomrcoo1faDrluvi s)srtr(m iodomeeliei (f rrau ono0opx  ieiysla2umn s t0alenmr io1omDe u i;t0srurxo3iodamte ncilt)s2tru pno4tpt ii3iatlsDranvo;u) lxnxf oa1om eaneil(  euo(r iudam nliviat)srtmuro;t4aetnmiciaslm emn p () ltnxrciodlaD luei ( seuoxm3iu1olen fci (fs2rru  oo4tpen oetadfmDulumpn(4 etnifcty1opDeanvs;()trur(mpnydamtnlnvsa(f rtr( pno0tex  ieiaslm el(mp u4 rxnxo3ootlp   ivo t)srtoimpoudap n nvtlt)aruru pnt0tptnioetldfaDumnmo t4aetrmf oodfmDr ueols0s2uoiopoo4olt livia(fa2urxmono1opx moeiltfm um( o;(0texnxr iy1omDr u i;s0s2xmirpnydlpeelncsl( sDrr(r oo4opxniociadla2ulu pn()aeeomrcty1om eaues;s  2urxrpoodole  fesat  rrr(  ou1apxnmi3iatfaDumnmp t4arxoxr3tadlpDe nei;s0t2umir iy4openlfcsls sDrmxroou1tpeomicias m eaums;t) exnircoo1omte i i;s0s2urim io4opte fcs tfa2ta(rpnu4altomieiyd m ua(vsnu0arxnmo3to1fpt  neils texr(mpoudamtemfet t a2urum ;t4apt if3ild aDea(vonu)arenio oo1lat auvi;(0srtoim3nydlme  ici sf rtrxmpot1apeo i3ildla2ulu on()tlxrmo ty1opt lnvs (0sexr(rpnu4lmtelnet s aDtm(mpou1alen ieiat m2em( s;(0aetoxr iytom rai s;s srtrio ny1omeemici t aDrm(mo;t1opt iocildlaDranvsnt0aeeniocoodfa ranei;( s2to(m3iy4llee fcta(f Dua(rpot1ope mi3iltfm el(mo u) rtomo tadla   uvilt) etmirpoydllen ivsl(faDtr(mo;u0apx iietas m2el(mo u4alermociytom rlu ol(0 2uoxm3iydame mnes tf rurumooo4ole ioetad m ua(ms (0tlenmfciy1fp ranvo;s)seto(m no4llte fetl()sDtru pou0aex  oeiadlmDrmn pnt)trxrif iodfmD auvils0trtmxo no1ope  ict s  Dua(moou4tle  oeias m rmn pnu0 ltrmr iatlpDrlneilt)t2tmir3no1ll   nvtl( a2rax ooo1oltniocildlmDrm(mp;t0teeoxr oytom e nes;t)texo(o3iy1apte feilsf 2ururpoo1aeeoii3iadfs eauvs t4tltrxf ty1la e ieo (0srxrio3ny1opeelfet (f Drrxroou1tleo ieiat a2ranmo;t0 ltrio iytfp r neo t)s2xr(m iydlle lfviat a2tmumonu0alxnii3iltfs umnvp t0trenircoatlp e uvslt texoim3oydll  mnvtas)s2trxr ;o0optnif3iltfmDra( p;t4trenxf iotlpDeluvilt0teurxmpny1lmtnmicsa(f 2uaxr ;t1tet  o3tlslm ua(mo t4texoxrcio1oa eau i;()trxo(m io1lm nmfei tf 2tm(moou4alt  f3iytla2eaumsn(4 rtoxr3ty1omtelivsl( sexoiopno4am  mict (f Durxr ou4olen o3tltla emn p () rtriocoadop raivols)texoxr oydal   neias)aDrmur ;u4tpxniictytfsDran o;t) rxoirciatfp r n i;( setriopoy4alte ivs t)arrmx onu4tleomfcilsla el( o;()areoxo3oo1op  ai s;t0texr(mpoo1lptemictltf Dra( p;o4opt ifeiydlm2ulump t)artomf io1lm  aieo;t) rxrir ou4olt lfct (f Drm(  ot4oet mi3ildfsDua( o u)arxoxociy1opDe ies (  rum(rpnu1lm e iei sf rrmu ooo4apeo f3iad a el(vpn(0arenxo3iadfat li s ()t2tm(mpoy1alen net t)arrmumpoo1apx if3tytlaDrmn pnu4tetrxr3iydlm  luvolt)texrir nu1aleemncs s  Dtr( p;u1teto ietadla2uau s t) exrxrcto1oate uvil()seum(o3no1olen ieias sDtru ono1teenioctadfsDelnmo t4tlxoif tatop e ivilt srxoiopiydlp nlieta(faDumump;u4tltn ieiadla ra(mp;t) exoxociotfa  anvs;t0sruo(mpoodlpenmfesa()sDuaxmp;t1tpt moeild s2ea(vsnu0tlenmrcoy1lm elnvi t) 2trir nu1apte fcsas)arum(r ou4open f3tyd aDelnms;u)trxnxf oytop rluvilt0seumxopoo4al nmieslt)s2rmu o;u4tpeoiiciat sDem( p;()aeerif oy1opteln s t sexmxo nodlpeemicsls  2tau  no4aeeomf3tlsfs2ua(mpn(0 ltomf3tatoaDran o s srtm(rpoodame lnvt s s2rmu pnu1oltomfeiasfm ea( snt)arxnifctydlmtelnvs;s  rtoxm3nu4lmtelneilt) rua(moot4aetnmfeilt a2rm(vs;()aexnmrcoadoptranvs;s)texrir3io1oleemnvt s)sruaum no4texo ociadfmDua(ms;(0 lxrxo oatop r n il()s2tmxo3iy1olenmiesas sDumxmono4apeoiociydls rmnvp;t0tltnio oy1op  auei;s) exrxo3no1ll nmnvtlt) 2rax oot4aexnmo3iat mDeaumpnt4trtrxf todfpDr nvo;s)seumxm no1ap elfcsls)a2trum nu1oet mfeiaslm ea(msnt) rxrio iotomD livol(0t2xo(r oodomt mivsa(f rra(  ;u0tpt  i3iatfm2rmnmpnu4arxomrcoatfptran o;s0 ruo(r nudlmtnmnvsas)arta(r nt0tetnio3tas s uln p;u0 eenxf iytomt auvsls s2xo(r3iu4lme  nctl()a2taurono0aetn i3tasfs uanvpnt4tltrmrcto1fp  aivols  exoir oy1omtnmivi tfsrrr(monu4opt  ictls a2uluvp ()altnmf3iydfa elu s;(0 rxoxm3iodop nliesas aDtru ont1tetn oeildfs2rmnms;u)alxnmo3iy1fptranvi;s0 ruoim3oo1lme  fvtatf rtaur ou1ape ioctadfm rmuvpnt0 etoir3ty1la   uvs;( srumxopiu1omt lnctat srtmumoot4tpxnmoeildlm eauvonu) etnxociodoa eaues t t2uo(mpoo1lm nlfvt (fsDrm( poo4altomieild a2eaumo;u4 rxoxr3iotfa  aiei s0setoio3ny4am  miesasfsrtr(  ;o4opx  o3iatlm uan s;(0 eenmrcia1opt anvi;t0srxo(r3no1apt lfcsas)aDtaurpnt1ape mfctldlsDumn s;(4aeeoxf3ia1opD ai s ()srxoxr io4ap nmfcias artr(r no4oet  o3tytla emnmo;(4aeeoxocoytlaDelueo ()tetmir oo4lmtnlnei t)artm(rpoo4tpx mociltfm ulnms;u4 lxoircoadfa   u s;t0t2um(mpoo4apt lfvs t  2ra(ro;t0aex iiciydla2emu pnt0altoxfctatfmtrau o t) 2toim no1lm  mieta() 2tau pot4opxomocias a rl( snu)teeoir iotfaDe n olt) rumxo iy1lmtelivslsfsrrr( poo4opxoii3tlsla rmnmsnu)altnir tytoaDeauvslt)teur(rpoo1omt  fesa(f Durxr no1aleo i3ilsfa2eau o;() etniocoytomteli o t srum(r ou4ol emnetl()srrrur nu0tpt  feiasfa2uan p;t4artnxr oydfptraueo s0 etr(opny1lm   nvtasfa2rr(mo;u1alx  oeiltfa2um( s t0 etomo3oydfaDrli o () rurxopio4op emics s)s2uaumooo4tpx mfctytls uauvs ()artomf3totfpD ai i;t0srxrxr3iodolte fei t)a2taumoou1ape mf3tlt s2emuvpnu0trtomr iy1optraivolt0tetm(m ny4lmeelnvtat s2raxmo;t4tetomfeiytls uau pn(4artnxf iatopDeaneolt)setrir oo1ll emfei (fsDtm(m ot0tlxomfctadfm2rmn o u0trxoio iodoa   ivi (  2xr(r3oy4amt  ivs t  rta(m nt1alt mieildfm2emu pn(4 exomf3ta1fpteauvsls srto(r3oudapee nvtlt)srrm( o;o1oetnmieiatfs ulnmo;(4tltnxfcia1fatran o s0srxm(o3oodlmt mivt t srua( pou4opxn o3iyd m2elums;(4 leoxrcoytom raneo;() rurirpoy1olenmivi tfarumumono0alxnmfciadfaDumnmpnt)tlenir iadfatelnvi;s0 2umir3nu4ap nlieiasfa2umu  oo1tleomictytlsDem( pn() rtrxf ia1lmtr ivi;(0srtm(r oydope mncta( a2taxmonu1opxnmoetytls eln o;u0tetrifctadlptr iesl(  2xoxrpoo4opt  nesls) Dtm(mpnt1tet iietasfm raumo u4tlermo3ta1fa  ln s s  ruoxr oo1oltelnvs ( sDtm(  ;u4teeo oeild a2ulu s t0trtrxocoodomD  ivslt)seumio3iy4al  liesl()arrr( p;o1tleomo3tyd sDrl(mp;(0tetnxo to1oa e n i;t0srtm(opou1am nlnctltfsDrru o;u4tlxnmoeiytla um(vo;(4tetnxf io1oatelues s)srxo(m oo4lmen fciat)a2taxrp;o4oltnmfctadlaDea( p (0arenmfcoadoat lnvo s t2um(o3nu1altelicsas sDtr( oou4tpt mf3tadla2um( p;(4tlenxrcty1lp rlues;s  eumir nudaltn ictatfsDrmxr no4alxomfciat sDelnmonu)aetnxr iydoa r uvi t)seto(r iudll n nvta(faDrm(r nu4alxoio3iydfs2rlnms u4 lerif tytlpD ai sl() etoxm iodllt mnci (fartm(mpnt0oex  feias aDrmuvs u)aexrif3tydfpD  u i;s)sexrimpiu4lltnlfvtlsfsrum(m ot4oex iictldlm2emums t0 renirctydopDrai ol(0sexmxm iy4oleelfctat  rumur ot0apt ioetldls rl(vo;(4altrmr3oa1omtr neo;(  euo(m oo1lp   ivsl( aDum(m no4apto fciadls um(vp;u4aleniocio1fa rli o;t  rur(r3nu4lm elfcilt)sDurum ;u0tlt mfctldls2el(vp t)aeerxo3iotlp  ai o;s)s2tr(r no4am nlfvs s) 2urxroou1oeto f3ilsfm umnmo (0 ltrif oy1opt  nvolt) etmio no1llt  ivil(  2tm(  nu4texoiieiytlm2eanmp u0arxnmfcoodlaDe nvsl( teurxmpiudol  lics tf 2rr(m ;o0altn o3tasfs2rlumpn(0altnmo ta1oat  ueo;t  ruoxr3iy1amtemivsa()srrau  oo0tpxnio3iyt m ulnvp;(0 reomfctodlp  lu ilt0sruoxm nu4amen ictatfsrrru o;t4oex if3ildlm ul(mpnt) lxnxfciytfaDeanes;t) 2tr(m iu1lptemicia(farrrxr nt4altn fciydfsDua(vs;u)texrxfcia1lpte ivi t0seuoio iy4oltn fvs s arrmxmo;u4aptnmfeiyd m uauvo;t0trtomo3iadopDeln o s)s2tmio3iudlpe lfeias)srur(mooo4tex  iciydfsDumn pnu) eenir tytfm rauvsls teuoim3ou1lp nmivsas)s2rmx  ot4texoifeiatfsDua( s () lerxf3ia1lpDr n i t0seumxm nu1lm e ies s a2tax onu4apxo feias a umn p t4 etoiocoodfat ln o;t) eto(opnydol  lietl(  Dumxrp;u1olt mfetadfm rluvp u) rtrxfcio1lmte ivo;() rumxrpiydoltnlfvt t a2ururpoo0tee mfciat a2eaumpn()texoif iydlmt lueo s0s2toxr no4ol  mnetls  2raxrpnt0opeo feiatla2el(vs;() lxnmf3iatfpDrli il(0 rum(o3iudoltnlieiatf 2rrum nt1aptomfetltlsDea( o;u0 exnxocio1omDrlnvslt) 2toimpiudamenmfei s)srrm(m oo1teeoifciysfs uan o;u4aleoifcio1oa rln o t0t2ur(m3iudaleelneta(  Dtm(mp;o1aetnifetad a2ea(vs;t)tlxnxocoy1fa  lnvsl(0trumir ny4apt lfviatf rtax p;t1tpxn ociysls um(mo u) renio tatlpt lnvi;t0 2xrio oo1lm emicsat)aruaur oo0alto ociysfa rlu p;(4 rtoxo oytfmte ueilt)sexmiopou4lpee net ()srtaxm ou4texnmoeilsfs2umn pnu4trxoxf tadoat an o () 2xoio3oy4lmtnmneiasf rrrx pno4opx  fetls aDeanms;t4 ltnxr oy1oatelivsls) 2tr(mpoo4ame  nct t sDtaxmp;t0olxnmfcildls rmnvs (0 eerxr oodlpte i o t sruoir3oodlleelivia( a2tmu ont0apenmo3tadlm ea( s (0arxrio3iy1omDeai o t0srxoim iydol  mfcias sDuaxm no4aetoif3iat a2ean p u0tetrmr tatoptr ies;t)teurxopiudamt mnet sfsrrru ooo0altnmf3tytfaDua( sn(4tlerxo3ootfa rlues s trtmxo nudom  licsls  2tmxr nt4apt  i3iydla rmuvsnt) lermocoatfptelieslt0seurirpiy4opeemfvs tfs2trxr ;u1tee  fciydfmDuan s t0tlxnifctatlmD  ueslt0t2xrimpoydaptemncs sf 2uau p;u0aee iietysfmDul(vo t) etnio3iodfmtr uvil(0s2xr(opio4alee fetl( sDrm(mp;o0apenmictltfmDrmn o (0arxrxo3ty1la  anei s)t2um(m3iu1lptnmfeslsf 2rr(mp;u0teeomoctydfaDuan pn(4aetniocoy1lpDrlneilt)truoir io4op   icilsfsDtr( oou0alenio3iadlsDrlnvs u)teenmr3to1fp  lies;t sexr(r iodol emfcils)s2rauro;o4alxoifeild mDraumo;(0 eerxfcoy1fp rau s s) etrio iudal n ies (fsrtru ont0olx ioeils aDranvont4trtrxo io1lmtr i o;() exrim3oudaptemnvi sf rtr(ront0apxniietlslmDumuvo t0aeermrcoy1fatranvs;t  exm(o oy1lpt lieil( arumxm nt1olxoifetltlmDrau p (0areoiocio1lmtrli s ()srtoio no4op  livtas  2rrxr ;u4apxnifctaslsDuan p;u4aexrir io1fmDe iei ( s2toxm nydlp   fesls)arrruronu0tlt micildlaDua(vpnt) lerxoctadlmDrluei t t2trxo3no4lptn nvil() Dtrxrooo1olen o3iys sDranvp;()trtnmrciytoaDrlnes s sruo(opiy4ome mfetatf 2umxrp;o0tlen oeias s2ul( onu)arxrio3oo1lat aueslt0s2umxr nodlmenlnci s artrum ;t1alenmf3tldlm2elnvonu0texoxr oo1fm r ieil(0srxoirpiudamt mnesl(f rurumoot0olenio3iys a2uanvs t0tltrmf iydlatr ueo (  exo(rpou4opt mictls artaum nu4tpxn f3iyd m2el( p;u0 ltrir ta1op  ai i s) rto(o3iydomee ncslt)sDtruro;u4tltn feiysls2emu p;t)teerir iatlm rluvo;s)s2urir nodalt  ics () rrmum ot4tpt iociytfa ul( ont0artrif oa1fatranesls trur(o nodomt mnvsasf 2raxrpno0oex if3tlsfmDeanms (0 exnir ia1fat livi s)tetr(o3ou1ap  lnes t sDrrxroou1aeenii3iys mDeaumsn(0 rxnirctatoaDeaiesl(0 2toim3ou1al  lieilt s2tmurpou0aexomieiltlm ulu onu0trtnmociydlmtran slt0t2xmxo nudop   fvsatfsDrrx o;o1apeoioeiaslaDulump;u4aeenio iytopDeanvilt) rtmxmpiudlleelics s aDur(monu1apx  o3iydlm ea( p;u) rtrmf oodomD  uvo;s srtr(m3ou1lltelici t arta(moot4tpeoio3iltla rluvpnt4trtrxr3tytoaD auvol(0seurir3io1opt miesltfaDta(r ot0tet  o3ilsfmDrmumsnu)artrmr iodop  luvs t srtr(o iu1aptemnet s  Durxmo;o0oeen ociadfs2uan o (0aexoxfcoy1optrlu sl() rtmxm oydaltnlncsat)sDrm(  oo4tltnif3iltfmDea( s;t4trtoifctotom  lneo;t)srum(r3iy1apeemiesls)sDtax  no4olxo oeiltfsDrl( o;u0tlxoif tytoaD  u i s trur(mpnodal nmncs t)aDrmurp;t1olto i3iytlm2ua(mont4 ltrir iadoat  n o;s) 2tmxopny4lmen ivsat) 2rmurp;u4opt mociysls2rm( o;(0alenxr3tadlp eanvi () rtr(mpny4llt  fci t s2raum nt4tlxomoetlt a rl(ms () renir todfpD  ueslt sexriopnodamen nvslt)a2umxroot1aex ioeils m rm(vsnt)arerircoo1fpDeauesl(  euo(rpio1lmtnlncs tfaDrmumooo1teen fctlsfa2rmu o (0 ltnir iadlm eaies s)srtoim iodop nlfes t)a2uru o;t4aetomf3iadla2ea(vp;u) lxrxr to1oa rlnvi;s0 etoim iu4alen fvia() Drau o;o0alt io3ild m uanms t4 etrmfcta1oatranvilt0srxriopnudopeemnci (  Dururp;t4aee io3tldfm2em( s;t)aleoio3iadopt auvi;s texrxr oy4al nmnvtlt) 2rmumpnu4tex  feiyslmDum(mp (0 rerxrcoydoaDeau i;t teuo(opoo1altnmnvtlt arrrxr ;u0opx ifeiatlsDrl(vo (4arenir3oodfmtranvolt  ruoxrpnu4llenmnet s)srtaxr nt4tleo ieiytlaDuau o;u0trtnif3totla eaneo t) etrxm3oo4opt  neta( s2ra(rp;o0oet mo3ias s2ranmo (4altrirciadfateli s s tetr(opoodapeemnvsas a2tax  nt1olxomfeildfa rluvp u) ltnmfciadfmt  n il( srumir3ny4omt mnvtat)srurxmooo1oeenmfciytfs2rmnmp u4aeerirctydlatr ivils0 2um(m3nu4apeelfvtatfarrax  ;o4opxomieildlm rm(msnt) eermr3oadfm rluvsl(0teto(r no1llenmfvt s) Draxm nt0aptnmo3iatfa elu pnt0texoxf3ootlpDeln s s)srxoim3iu4opeelfviatfa2taur nt4alxo feiasfm2ua( s;u)altoxocio1oatrlivo;t0 exrimpiu4lm emicsat) rraxmonu1teenmieiytfm2ul(vp () eerxo3ootla r uvo (0trurio io4am nlnes ( arraxr ot0ale ifciyd m ua( s;u4arxnxo iytfpteaivs;s)seur(o nu1ol n ies t)a2rru ooo4texn feiat s2ulump u)tltnif3iatfp r n o;t)texo(r no1oltnlieia( sDurur oo0ole mf3ildfaDrmn o;(0trenmf iytlptranvs;() exm(o3oy4llt  neil( sDtau oot4oetnifciad s emuvs;t)tlermo oy1fp e n ols0seuoirpnodal   icsat  2rr( pno4tle ioeiytfa2emnmp u)alenxo3oy1om rlnvo;s)t2xo(opoy1alt  ictlt  rtr(rpot1tpt mieiyd m2rlums (0tltomf3to1lmDeaivo s0 exmxmpoy1al  micsasfaDrm(ronu0opxomiciysla rmnvo;t0arxrmf iydlp  anes t0 2xr(r3no1om   neiltfaDumu  ;u1optomiciaslm ulnvs;u4arxnif3ia1fpDr ieo;s sexoio iydlle  ivta() 2raum ;o1alxo o3iasfsDra( o (0aexrxrctotoa rlnes;(0 2tmxr3io4ll nlfet tfa2ua(mooo0alen ieiltlaDrl( p;(0 rxrifciadopDr ues s  2umxo iu4open nct t)artrurpoo0oex  fciydfs ra( s;t4teerio3iotla eauvo (  rumxo3ny1ap nmnvi t  rtauroou0oex  f3iltfa2eanvp ()artrxf3oydfpD auvo t0teumim3iydlm nlnviatfsDtrumoot0alto fetysls2ranmpn(4 lxrmfcoodlpDrluvils)sexm(m3ny1omtnlnciat) Drmumonu0tpxnmfctldfm ea(mont) rermf io1oaDr uvs;(0texr(r oo4llee neslt  rururo;t1tltn f3iys s2ran p;(0altrmr tatlmteai i;s0trur(m3nodlme livs sf 2umurpnu0opt mi3tysls rlu pn(0 reriociydfa  an i;(  etrxrpoodlmenmicslsfa2taur nu4opx if3iad a2ua(vsn(4 rxnxocoo1fa   ieols0 etrxo iy1lpenlfvilsfsrumxmo;t1tlto f3tytls2rln p;t0tleoxr tytfpt luvslt0srtrimpno4altn nvslsfs2urx pno4texomocildfs2rlumsnt) ltrmr iydomD lueil(0teurxo ny1om  lnvias) Dua(m ou0opxn fcilslmDrlu on(4trtnio oodlaDe ueo () 2um(r ou1lleemfctlt)a2uru p;t1tee  ictad a ulu snt4trtnxo iy1lpt au il(0 2toir oydll  lfeias  2rmurooo0tpt mi3ilslm raump;u4artrirciadoaD li o (0 ruo(o3oydlm nlfei ()s2tau oou0oeenmfciadfs2el( s;u)aetnxr3tatoaDr ueols)setoiopou1ole lieia(f rtauroou4aee mi3tytfs emnmpnt4 eerxo3ootla  aneo;t0tetmxr3io1omenlicta(f rraxront4oetoiieiad a uau s (4 etrif3tatfm e nvi t) rtrir3iudlm nlfcilt) rrax oot4aeto o3ilslm2eanvsn(0teeoio3oatomDeaieils s2ur(m ny4olen ieta( sDtaumpnt4oexn octaslmDrl( pnu0texoxo3oodla elieol()texoxrpou4omtelicsatfarrr(rono1tlxniieildfm umu p (4trtrxr oy1oaDr i o;t srxmxo oudoltelfciasfarur(root0opxo o3iyslmDrl(vs t)trtoxrcio1lmt lnvi;(0t2xm(opnu4lm  lnvtls) Dtauroou0aetnmiciltlm2rlu sn(4 lerio3tadop e ues;t0trumxrpio1lmenmics ( sDtaxronu4tetn ietlsla2rmnvsnu0tetomfctatlptrluvi s  rxo(r3oo4apt  fcta(  Dtmuro;t1tlt mfciydlm2ua(mpn(4 ltoir io1opDe n slt) eto(o ou4al e iei s)aDrm(rpou1opeo fetyt mDemumont)altrxr3oo1lm rauvs;(  exrxmpiodale lnvsls)s2ua(mp;t4ale mfeiyt m2uanvpnt0 lerio3oo1op  aieils0 2xrim nudlpeelici (fsrur(rpno4optnio3ildfs2um(vo (0 lxomr3ty1la r nes s0s2xr(opiodopenmfcs ()arrau  ou4tleomi3ils a2um(vont4aetnxo3tadoatraieslt) etmir3ny1amee ivtasfarra( pnu4aeto f3ild a2emn pn(4 etnmr iatop rlivols srxmim oodopenlivtatf Durx pou4olt  iciadfm rmn p u4 exrxf3iy1fmtrai ils0teurio io1lpee fvils)s2rr(m no1alx mfetaslm2umn onu)tetnmrcia1oa r n i;()s2xrim3no4opt  iviasfaDrmu o;t1tpxnmoetasfm em(mp ()teeoio iatfm r ies;t)t2umxr oy1lmte neias)aDrrurpnu4aet  f3tadlm rluvp;u0tlermf3oytop eliei;s)t2toio3oo4lmtn ivils aDum(moou0texnioetat m rauvsn()altoif3ta1op eaies;s0texm(m oudapee feils arrm(m nu4oee  i3ilsfaDrlump;() rtoioctatfp   nvslt)trxoir iy1lle lnvi (f Dumurpou4alxn ieiad s raumpnt0 leoxrcio1la rlnei;t)t2xoim3io4optnlnes sfaruaxmoou1aex ii3iadla rl(mo t0trxnmociodlmtr ues ()t2trxo io4ol   fet (fsrtaxmonu0tptomoetas mDelnmonu) exrxf3tydoaDelu s (  2uoim oo1am elncil( s2tmxmo;t4texnmieiytfa2ua(vp;t4 exnifciotlptr ueo;s0 euoio3iydllen fetl()s2ra(m no0olt  octltfs elu pn()arerxf iodfm  an ils) rxm(o ou4lp   netl( s2rrxmp;t1opto i3iydfa2uaumon()aetrircoodoaDeluvi ( t2xoxmpoudomtnlivtas aDtax  ot4ole iictat mDuan p;(4 ltoxf3iy1faD anvo;s0 rur(mpio4apte nvtlt s2ra(rono1alxn i3tytlm2uauvonu)aetnmr ta1fmDrliesl(  rxm(m3io4olt lfci t arurxmoot4apt  o3iadfa ran pnu)artrio3iatfat  ues;(0 ruoxm iu4ap e nvt s  Dtr(m ou0oltoifeiasfs2uan p () exrxf todlpDrluvo (0setmxopno4lle livt t aDrau p;u4oexo fciaslaDumumo t4arxrmrctytlmDr nei;( srtmxo nu1ll emieiat)s2umxmpnt0aexnmfeiad a umu onu) reoiocto1omD aneslt s2urxmpoodolenmivt t  ruaxroot0opeomi3ild a raums;u0treoioctydfat  nesls  2tm(mpiodll  mnvil( s2rr( p;t1aet io3iysfm2umnms (4 lxnxfciodopD  ivolt) rurxopno1lptnmict (fsrrrxrpot0ape mi3tyd aDelnvsnu)alxoio to1oaDelivi;t0srumimpiy4lpeemict s)sDtaumooo0apenifciadlm2em(vonu)trenmf3iodopte i s;(0 2xr(r3nu4lmee nvs s s2ra(r nu4tpxo iciasfs ulnvont)teenmocio1lpD lnvsl( s2xo(o3nudlp e ies s)sDum( ono4ole  f3iydfs2ea( s t0altoxo3tytlmD anvi s) exmim nu1ap   fvtl(fsDrmur nt1oetomi3tlsfs2uan snu0 exrxrcoatopDe u il( setr(m3iu4lm elictlt)aDuax o;u1tlenmfctatfm rm(vo u) ltnif ta1fpDrlneo (0t2uo(rpiu1lpe  ncilt) 2rrxr nt1aptoii3iadfs2rmu pn() ltnif tatlmD  nvs ()t2tr(rpiy1amt lfvil(f rtaump;t4optnmocils s2rl( s;()tlxomf io1fmtraivilt0t2um(mpoo1alenmieia(f Dtaurpoo0alx mocilsfmDumump t4alxoxf3iytfa   ivol() 2toir3iy4op nlictls) 2urxr nt1apeoioetaslsDuaumo;u4 rtrxr3ootlaD aueo;t0 ruo(rpnudol elncia()aDuaxro;u0oet  i3ilsfaDran o u)aetnio iy1fa  aneo s0trtmxrpiudlmtn nesa() rrrur ou4tlxoifcildfm emnmpn(0altomrctadom ran o s t2xoimpiodll nlieslsf Dtmx  ;o0apen f3iytlmDuln pn(4tleomf io1fpt lnvols t2xmim3ou4lmtemivi ( aDrrum ;o4tex  fetad m2ra( o;(4alxrif iotfmDr nvi;()trxr(opio4ope  ivsa(f 2tmurpno1tpx  f3iltfs2ranmsnt4alxnxrcoytlptrluvolt) 2um(r3oy1ape  fvtat aDtauroot0apx moeiat aDuluvpnt4tlerxrctodopteau i;(0 2trxm iu1op  liei s aDraum nu0tpeomf3ilt mDel(mo;(0altnif iatfm  auvo s trto(r3iydllt  iesltfaDuaumoot4oleo ocilslmDrlnvpn(4trtnif3oatopteau o;s seumxm ny4lltn ivsat)s2tmu oot0tlto f3ildlm umuvs;u0tlxomo3iytomt  neo t teumio iydomt mivt ()aDtmum ou4olxoifeiasfsDra(monu) lxnxf tytlmDe i i;t srxoxr nudlmtnlnciatfs2umxr no0optn i3iytla2ra(msnt4alenmr oatoa  lies;()texo(o3no4llte ncsltfa2uru ooo1tlx  i3tadla rauvs (0treoif3todlm rlnvo t0teur(r oo4altemfvsas artmurooo0teen o3iytfs rln p ()trxnxf tadoat auvslt t2urxmpoydlpeelict s)aDtaurooo4tpxo ietas s2ea( on(0arerxf ty1oaDelneil(0s2uo(opio1om nmivt t)srrru poo4aexo ietysfm rmuvp;t0aexnif3oatfm r ieil(0teto(rpny4lm nmfetatfa2tmxm ot0tptnmfeiydla2eanvs;t)tetnio oo1fa  anvi t0 rxrirpiydal  mnei () Draxmoot4opxniieiad m elumo ()tetnif oydlm   u olt0 rxmim oy4llenmivil(fs2tr( pnu0aleoioeiaslsDuaumsn(4trtoxf3tydlaD  uvo;( teuoxrpoo1lmtelnvtas  Duru ono1olxo f3iyslm2ulnmp;u0 rermf3oo1fa elueil( teurio oy4omtnlnvi s) rtmxronu1tlx  oeiad a2rlu onu4alxnifcoo1optranvo;t trumirpnudal nlncs tfsDrmumo;t4tltn oetad aDulnvs;(0 reoxr3tadlaD  i ilt s2ur(o3no1ame mfcilsfaDtaumpou4oeeomoetydfsDranvp;t4 eermrcio1fmDelivsls)setmxrpnu4ap  mietlt sDumurp;u1apxoif3tad s2umn p u) etoxr3iadlmDeli s (0tetr(r3iydoptemnei t aDua( ono4tetnmo3iadfaDranmon(4alxrxo tatlatranes s s2tmxm3oo4alen nviat a2ua(m ;t0oet ioctysfm2em( p;()aexoir3oo1lpte ivs ()s2urio3iydole mfvi s)a2rmxm ou0teto fcilsfa2rm( p u)tetoxf iodoat  u slt t2toxm3nu4amt mfvils)aDua(r ;u0teenmi3tatlm2uluvp t4 exnmo3todfp  aiei;()s2xrxopnu4altn nvslt)arrau pnt4apen f3tldfmDem(mp;t0trtnxfctytomD an ols)s2xr(opnodoleelfcta(  rrrxrpno4oleo f3tydlmDemn o (4tltrifcio1lpD auei ( trtm(r oodap e ivsa(fa2rrumont1teeoifeiyt a rau o;(4tltoxo3iy1lmt li o;s s2xoirpoodom  lncs tfsDrmu  ;t0oexo oetasfm umnmp;u4trerxf io1fm  aivo t)sexrxo no1altn fvi ( srtmu pnu0aeenifetys aDrluvp;t)tltnxocoydop elnvi;( trxrim io1lm nlivsatfs2tmxmpno1olt  i3ild s2ulnvp (0tetoxo oa1faDrlneil(  2uo(rpnydapt  fcslt aDtrurpno0alx moeiytls2ulnmo;t0artnmo3oadlpD lu ils  eto(o ny4olt  nctl(  rraum oo1tlx  i3tas s rl(vpn(0 eenxr ootla rlnvi;s teuriopnu1omt  fvt sfaDtmu  ou0olxn fciltfs uan o;() lenxf3io1om elieils0setoxr3ny1op nlnes t  Draxr nu1alto oeiydfs rmu o;t4trtrmrcta1fp   u olt srxoir3ou1lpenlfvt t)arrru pno1openmfeiatfs rl(mont)altnxrciytlpt lnvol(0srtr(o3ny4lltemnvt t aDurxmo;u1apxomi3iasfsDeanmsnt)aeeniocoadlmD  nes;t) 2trirpnudaptnmnctl( artrum ;u0olt  i3ilsls2emums;t0 renif3ta1oat  neo () rtoio3ou1amtn ietls)sDtrx pnu0alxoioeiyd a2el(mo t4trtrmf3iotlpDe ueo ( teuoir oy1lp   fct s  rrrump;u0apxn f3iydfa2umnmp;() lenmr iy1fpte uvs;()seuoim3nu1apte ncia()srta(ro;t1olxniicildla emums u0 rxnmf3iytlptrau il()s2umxmpio1lm e nctas)s2rrx  ;u0aee iietas s uanms;t4texriociy1omtr ivslt0seto(r3io4lm eliviasfaDtmuront0oeto oeiydls rlu ont0 ltoxf3tydoaDe uvi s) exmim ny1lleemfei t  2uau ooo4opeo f3iad s ranmp;t)artnxr3iatfmDeai ilt)sexrirpnudlptelivsas)srrrum ot4tpxo oetlsfaDelu snt4alerio3to1omD lu ol(0t2trio3nodal e fes (fsrumu pot4tpe moeiatfaDrlump;t4 ltrir3todopteanvils0srtoimpnu1apt lietlt) rrmxrpot0tpeoifetlt aDrl(vo;u4texoxo iotlmtr uvil()s2um(mpoudomtemncsasfaDuaur ot0tpe ii3iatfmDrlnvp;t4 exnio iadlaDeanvo t0s2urirpiydame lfcsa()a2rr
\ No newline at end of file
@@ -0,0 +1 @@
+neo t0 eurxmpio4alte nviltf 2um(rpou0altomiciat m2em(ms;u4artrmo tydfmt auvo;s0 eurim3ny1opt  ieta(  rtr( o;t4oltnifcildfs ra(vo u0treomfcootoa eln s;()teto(r3oudlptemncsa(fa2rru pot4alxo ietat aDran p t0artoxocoodlm   u i;( setr(m3iy1amt micils)s2rrxmpot1openioeiatlm2rlumon()arxnmr iadlaD  n il() euoxr nu1llenlnvi sf 2rm(  nu0tetnif3tadfm rmnmpnu4tltrif oydfpDean i s0t2uo(rpnu4lle lnvtlt)s2tr(mp;t0alxomfciadfs umums t)tlxrircoo1opDrln o s0t2xm(o oodlmtelfcsl()aDua(r nu0ape  i3iadfs em(vp;u) exrmf io1fmt  neo;( s2xr(r3oy4ope mfvtatf 2rr(  no4oleomf3tyslm rauvo;() rtnircoa1laDeli o;( s2toio oudlpt lnviasfsrtm(r ;u4tle ioetatfa2rmu p;t4tlenir3iadomteauei;t0 ruoirpou4lmeemnvsas)srrr(ro;t0tle mf3iadfaDel(vsnt4 etomfcoa1lat  n i;()trtoxo3oo4ap emfeil() 2trxm ou1oee mfeias s2el( o t)tltnmfctadfm   nei s0 exoiopou1lltnlieiat)aDurumpot0olxo ictaslsDelnmo u4 exrmociatlaDe i ilt0 exo(mpoy1apeelivtat)srtrurooo1opeoiiciad a2eauvp t0 rxrir oadfpt li o;t  2xm(r iu4llt  fvi ( s2tmx o;u4oet iociadlmDuaumpn() rtnxf tytomDraivil()sexrxm3ou1lm n fcil(f Drr(rooo0alx  fctldlm2ranvs;u)teeoxf3totoaDeai o s0 2xo(opoy4optnliviasfsDrmu poo0tpe moctls aDeau p;u4 ltnxoctatlaDr i sls)teumim3no1lm  lncs tf Drr(moou1aleo ieiydfa umuvs u4texnxr tytop  aneo;s texrirpnydame lfvt ()artrur no4tptnmo3iltfs2eanms t4 etrxfcootomDe n o (0trtr(mpiy4ol nlivsas aDuaxr ;u1apt mietyd aDrln p ()aexnxr3iatlaDr nei;t0sruoxo iy1lmenlnetltf rrmu pot0aetomoetatfaDrlnmpnu0teenio to1lpt lnvi (  2um(o ou4olenlict s) 2raxm nt1aet ifctasfs2eanms t)treoif oodop  luvs;(0srxmiopiy4al n fcs (faDtrxr ;t4tet mi3tlt s2rmnvp;() rtnxf3oytomte uvi;s  rtmim3oy1op  lnesa(  2ta(  ;u1aee mfeilsfsDelump (4trxomociy1lmDelieo ( trum(opou4omte fei t srrm(mpoo1olx  f3iatfm2rlnmo;t0 rtnmf3iydop  an o s0 eur(r3iu1am e nesl(  Dtm(  ;u0optoiieiyd m ea( p u)aexnif totfp   ueo t0sexrxm ou4lm n ict sfaDra( p;o4aet iieiytfs2eanvpn(4 lenxf ty1oaDeaneols) etoimpnydlm nmnesl(f 2trur oo1tlxomf3iltfaDrluvs;(4texnirciytom eli o;s)s2xmxr oo4lptemivilt  Dur(r ;u1aleomfeild sDumnvpnu)arxrmr tatomDelueo t0t2to(o nu1ll nliei s  rra( pnt1oltnmicildlsDrmn o t4 rermrcta1oa   u o t  2xo(opnu1alt lfvil(f 2uaxmp;t0tptnmoctld s ua(vonu4 eenxr oodlpDeaneo s) eum(o oo1lme lictatfsrtaurpnu0apen ociadfmDua(mp u) exrxo3oa1lpDranvo;()srxm(o iu4op n icsls  Dumxmont4tltn f3iyd s uan o (0artnxr3oodfaD lneol( srxmxrpoydll nlfes () Dtrxro;u1tpxnio3iatla uan s t4 reomrciadom e u o t)t2urim iy1omenmneias) ruru o;o4tleomoctadfm2eluvo u4trtrmr3ootfp e nvo;s0trtmio3oudlp emnvtas s2tr(  no1aet  fciysla2umnvo (4tetomf3oydfa e ueslt0setoir3iydoleelictat sDrm(mpnu1tlx ioctyslsDemnmo;u0 rtrxfctotfm   ivi t  2toio nu1aleemiet t a2uau  ;u1oleomf3iasfm2rmumsnt4texoxrctodop e u i;s  rum(m3iy1lmtemfeia() Dtmuronu1tlxo i3tyt a2ean o u)tetrif iydfpDean sl(  2xmxo3iydap   fcilsfa2uaxmo;u1olt iietltlsDrlnms t)arxrmrcia1lmt aueslt0srtm(r io1amtelnvs ( srrrxro;o4oetomociadfm emn p t4tlxrmr3ootlpD auvsls) rxr(rpoy4alt mfes ()s2ur( p;t1ole moetys a ua( p u)aeeriocoy1faD an s;s texmxr nydlmt mnvtl()arrrx onu0tltoifeiydfs el( snu4alxniocta1oa r ivo;()s2toxmpio1op emnctl()sDrrxrooo0tlxoio3iytlmDuln snt) exrioctotomDr nesl(  rxo(opnu1ope miviatfsDraxm oo0tpt mietasla uau pn(4trtoxf3todomD au s;t srtrio oo4ol  mfeiasfsrrmx ont0aexomictyd m ulu ont) eermoctydlm elieolt)srxm(r iu4oltnmfvs sfsDrmxm ;t4aeeo f3iyd a2uanmo;u0alenmo3oadlmteli ilt)t2xm(o ny4aptnlfes tfaDtmxro;o1teeo oeiys s2umumpn()teenir3io1op  anesls)s2tm(mpnudaptnmnvtat s2rr(mpnu0apxnmoetlsfa rlu o t0tetrxfctodlm elivo;(0s2ur(m3nudamt lncsas sDur( pno1opt  f3tydfs2rmnmo () ltnxr3oo1fpDrlu ils0t2xrim3no1lmeelnviat) Dtr( o;u4apenifeiyd m um(vp;t0 eeoircto1oaDeluvo;s) euo(o oodlmtnmiesasfs2rm(rooo0aeeoifciasfsDem(vp u4 lxomfciotlmt li sl(0 2umiopiodaltn ivs tfaDurx ont4oetoifcilsfaDul(mo u4teeoir totfatrln i;s0 2xoirpiodalte ncilt)a2tmx  oo1texnif3iysls2ea(ms;u) lenmf3ootla  lneo;( trur(m3iy1ll elietl( sDtaxmo;t1alt mictadla2umn sn(4alxniocta1fm e iesls)srxrxm iudal e ivsat)sDurur nt1apt mfeiad a2emnms t) ltrxfcta1oaDrauvs;( trxoxm io1ap  mnctls)a2urum nu1openif3tysfs2ul( o (0 rxnmf tatfat ln s () rurxm iy4opeelfetl( s2tmur ;t0olen octld aDul(vo u4 rtnmrciadom   ueils0 2uo(mpou4lp nlncilt sDtaxr nu4tee  ieiat a rlnms u)alxoif tadlm ranei s0t2toimpnu4alt  ncs tf 2trxrpno1aet iicias a2ea(ms;(4altrmf3oytfmD auvs;( seuo(o ou4lmtnlnet s)sDtrxro;u4tlxomiciatfsDeauvpnu4teenxocty1lmDelu s;s  etmio3no4oleelics ()s2ua(m nt4aptomf3iad s2emumont0teeoir oo1la  livs ()teuoimpoydalt lfctasfsDtr( pnt1aleniociad m2uauvo u) rtnmfctodomDe ieil(  ruoir ou1ap n ietls a2umx pno1aeenifcildlsDum(ms (0 etrxrciadfat aivo;()s2tmxo iydlmeeliet () Dtm(m no1aeeoiiciatlm2uan p;(0 etoio tytfpDrli o t) exmirpno4omte fvi (faDururo;u1oleoioctldfmDrau o ()teermf totoat ln o (  etrxm3nodope miviat s2tmx  nu4apxnio3tysfm2ulumpnt) lxnmo3totopt  ies s0s2uoxmpnydom nmiciat) rua(r ou0tetn fciysfm umn snu0tleomfciytlmDr neil( setmir3iydom nmicsa()s2uauro;t4aleoii3tydfm ranvo;(4 etrmf tadfpDr nes t  2toxopny1altn fvt s)s2tmuro;o4oee ii3ias a2ra(mp;t4 rtoir3oydoate ues s0trtm(rpio4omeelfci s) Dra( ono0tetoifeiasla ean p u0alxnxrcoydoaDeln i;t0 rtrir oy4lle mnet s)srraxro;u0tetn f3tlsfs emnvo;t4altrmf3ia1lm elieo;s0srxoimpou1olt mieils sDur(  oo4aexnmiciyd mDumumo (4 exniociadlmtraneilt  exmxrpnodoptnlfctls)sDrm(moot4aex  f3ildfs2eaump;t4 rtnxrctatlmD aivs;t srurir oudam emnesltfsrumxmoou0oee  fciysfa rl(mo;t)tltomo3tydlp eaueo;t) exo(m3io4ap  mivsatfaDrmx  ;o0ole mf3iad a rm(vont4tltnxo3iadomtranvsl(0t2xm(m oo4ll nliei () 2tm(rpnt4open feiytla umu s t0arxoircoo1lm elnvi ()srumxr3nudal nlivtl(fs2rau pnt0alxomiciysfs2umumon(4teermr3ootlm raneolt0 euoxm ny4am e icsat sDrr(mp;o1apeo feilsla2eluvp t0 rerxr oatoat lnvi;t0 eumiopoodom  mieiat s2rau  ou1oet  i3iadfm2ranvp ()alenmfciydoa rlues ( s2umxr io1olenlfcia()aDrmu  oo0tetnmi3iysfa eanmsn(0 lxnxf iy1latr ueo;()s2trxr3nydlpe  neilt)a2umxro;o4tlenioeiltfa2elnmpn() eerxo totlp e i o ( t2tm(opou1lm emicsltfs2ta(mpou1altnmfeiasla ulnvp;t4treoif tadop ran ilt srtrxm3nudaptnmicilt)artmxronu1tlt  ictadlm eln o t)aeeoio tytlmDraivilt)t2tm(rpiudlmtnmfvi sfsrrmx oot0tlto ieiyd a umnvo ()arxnif3totfmtr ivolt) 2umxr3iu1lmt  ici s a2uru  ;u1oetomoctldfa2uan o t) exnmf3io1opte i ilt0srum(o3iy4op n netasf rum(moou1tpenmfeiytlsDelnvsnt0 rxrmfcoatlaDr nei ( trurim nu1opte fci sfa2rrumont1oet  o3iysls2um( s;u)aleriocoadopt an o s0setrxo3no4om  lneil( sDurxm ot1teenioeiat s uaump;t0alxnmoctadlmD aues (0s2xoio3nodap  lncsasf rrmx p;t0oet ifetltfm rlu o;t) etrmfcoydlaDranes s tetmxrpiodlmt lieslsfartaumpoo1tlxo icils s ranmonu4 rermr3to1lp rau s s texmio3oy1lmenmictls)a2rrxmoot4teto oeias s2rmnvs u4tlenmr3ia1laDrli s (0 2xmir3iu1lm  lfcsl( aDrrumoou1opt mfetltfs em(ms;u) ltnmrciodlp rau o s trumim io4op n fetl( artrum ;o1aeenmfctldlmDelnvonu0alenmrcoadfatrlivs;( srurio oodamenlicsat) rrrxmpno1aet  feildfa2rm(mpnt) rxrxf3iydlate ueo;(  rum(rpoydlpen ictat sDraurpou0altomociyt mDemnvs;u)texoxr oatfpt auvi;t) 2triopio4alt mfci s) rrr(  ot0tlt  i3tysfs2umums (4 lerxocoytoptrau o s sexo(r oudlle mieia( aDta(root1apxn fciyd sDulu p (0trenmf iytfmt ai i (0trtmxo iu4amtemfeslt artaur nt0apeo ocilt mDelums;() eeoxr iytlm  ai olt0 etm(o3oo1lmte feiatfs2rr(m no0tet ioctysfs rm( o;u4 ltnxf iy1oat lu sl( srtoxm3no1am  lietl()aruaxrpnt0olt ioeiaslmDean s;(4 eermfciodfpt lieo (0s2tmio3oodomtemnetls sDtau  nu1optn fciydfs2ua(mp;(0 rxnio ootfm e nei;s)truoim no4alenmfeias)s2uru pnt0oetnifciad m emnmsnu4teermrctadla  aiesls)teum(m3no4lpee ivtatfsDrmxrono1oeeniieiytfaDean s;t4 eeoircoy1lmt liesl(  2uoxmpnydomte fcsl(  2trumpno0alt  ociasfm2umnmp (4 rxnxrcootfptean sl( teur(r3iu4om  mneslt) Drmxmp;u1alen feilt m umnmpnt)aeeomr3ootomteluvi (0s2uriopnydamtnmivtls  2raumpnu4opxoiietasfaDuluvp (0trtomo ty1la elnesls  rxmxr3no1lltn ictat)aDurxm oo4tle ifciytfsDulumo;() etnxr tatfpD  ueols0teurim3oy1ameemivs t srua(root0tptnio3tyt s2eln o u0tlxrxrciydlmDe uvs;s trur(mpoudomeelictasfsrtmurono1alenii3ild s emnmo;(4trxnxociytlmDean s;( seuoio3ny1optelncs s)aDuaum nt0tex mocias aDulnvpnu4aleoxrcoa1lm rauvil()s2trimpnu1ol emfvtasf 2uax poo0apen o3iadfa rmn p t0altoir tadlmtraivi;s sexrxmpou1ap nmicilt aDtmx pou4aexoiieiatfs umumpn(0 ltnxrcoadfa elivs s)s2tmir3iy4om emieslsfa2tm(mooo0oet ifeiltlaDran o;u4trermr iy1oaD  ivi;()seur(rpoo1op emivta()s2ta(  nt0opx  ietysfs ean pnu) exrir3ta1faDr nvo;s t2um(r3nydap  lneilt  Dumurp;u0optnioctadlm eauvp;u4aetnmf iydomtelu i;(0t2ur(o oo1lpe  fviat s2umxrpnu1tlt mocildlm2ranms;t)tetnmf oydfpDr n s;t0 2xm(m oudlmeeliesl() 2tmxro;t0oex mf3iytfaDem( pn()tlenif3iatomtelues (  2to(m3oy1ol nlfvta()arrmxmp;u1tlxn iciad a2em(vpnu4 reoxr3iydlp  lnvo s0 rurio3oy1omeemncsl(fsDrrxmont0oeeo iciysfa elnmont)tlxnio tydlm eanei s)t2tmxo ny1apt mfvtl(f Dta( pou0tee  feiytfa2ra(von(0artomr3iodomtr u sls srtrxr3iu4ap emietlt) rrr(mo;u0opt iociydls um(monu0texnxf iydfm   nesls)trxrxr3ou1ll nmncias  rrrx p;t4aexomfetydfs raums;(4 ltrxo3oatfaDe uvi;s t2urirpou1op   fetltfa2trumo;t4aetniociyt a2elums;u4 ltomf3to1lm rluvils  euo(opiu1op  lnes (  Dtmu o;u0tlenmietltfa2umumo;(0 ltnifctydomt luei t)sexm(rpiu4olt lnvt s  2rau onu4oetn fcildlaDrm(mp;()areomf3totop elneilt)texrxm nu1al e ietl()a2rrx onu1ope mi3iad s ra(msnu4artoxr3ia1fpD auvol(0teuoim3iodomee fctas)artaurpou0oleniietatfm2um(mp;u)aeenmfcoo1lm  an sl(0 2xo(o iy1lptelfviatfsDur( o;u0oltomfciasla2umnmo;u4aetomo iodlmteaiei;t trurir3nu1ll  mfcsl()sDrrxm nu0aex io3iyd m2em( o () rxnir3iadfateluesl()t2xmir nu1apee nvt s)aDra(rono4aex ifctldfa2um(vo t0tltoxr3oo1op rauei (  rumxm ou4lm   ncs t) 2ra(  oo1tltn f3iytfaDrln p u4trenircoadfmDraies (0 rtriopoy4amenmfesl( aDuaurp;o4opt mf3ild mDelumsn(0trtnxf iadfaDeanvsls truoim iu4apen fcsa( a2rr(mont1apxn ieiasfs2rl(vpnt0tlermo oytlate i s t0 ruoim3iydap n neiat srtrx p;o4aexo feilsfsDumuvon(0aexoxocoytfmtrluei (0srur(o iydaptelnesas aDuaxmo;o0aexo ietadfm2umnmo (0tlxrxocoytlmt livo;(0 rumir iy1lpe mfeils  Drmu p;u4alt moctyt a eln s ()tetrxr ootoa rlnvils)setoxr no4omeemfet s aDum(r ;o0aexnii3iadfmDrm( onu)aexnio oytlmte uvo t)s2uo(r3io4am   nct (f 2tr(r ;t1olx ifciytlmDulnvo u0 rerio totom eaivo t s2ur(o3ny4alenmfeia(f rtmxr ;o0apeoif3iyslm2raumo;u)arxrxocia1lpDe i i;s0sexoio iodamtnmnvi t aDtmu pno1aexn i3iaslm2uln onu) eeoxr iotoaDr nvo t)srxo(opno1olt mnvs tf rtm( ooo4apxoio3iydfaDul( p;(0 rxrxfciatoat  ies;()trxoxmpny4om elnetltf 2rax ono0tpx moeiytfa2umnvont4 etomrcoytomD ln o s) rtoim3iodam n ncta(f 2rmumo;o4olxnmieias m2rmu o t4aexrmrcto1lptrlnvols  exriopiy4apenmnesasfs2rru o;u0olxnmi3tydlm2eluvonu4tltomo iadfp  livi s0sexr(m3oudap emfetl()a2taxmonu4tet  feiaslm2umumont0artoxf iy1omDrai ilt  2xoxm no1lle lnet tfsrrrxr nt1aeenmi3iytlsDran s u4tlxomrciydfpDeanvs;s0 rtrxr3oy1lle  iet (farua(mooo1oeenii3iad s rm(vsnt0 lxrmo3todoate ivi s)srto(opny1lme mfcsltf Dtaxrpnt1tpt mf3iatfs elu on() ltrxf3io1fp e ieil( trxmio oydlptnlivsatfsDrmxrpou1tpeoiiciytfa eluvs;(0tleoxociydoaD  u o;t0 euo(rpiu4om elneslt arumur oo0ope  icild a um( p (0trtomo3ty1la rlieo s)srxoiopoo1omee icilsfa2ua(mpou0tet mi3ilslm2uan s;u4aexrxr3oodfm   i s t  2um(r nu4ap  lfvtas s2tmx pnt4oeenmf3ilsfs2rm( pnt4aeerxfcoydfptelnvilt) 2uoxrpiy1lpenmfvi s)sDur( o;u0tpe mf3iyd aDul(vont0 rtrmfcoytfmDr uvs (0srxo(o oudomtnmiesl( a2rmxmo;t1oex ifciatls2ua( p u0aetrmr3tytlat anvols)truoxr oydaltn iet s s2ta( p;t1aeenmo3tydfm2eluvo u4tetoxocoytfpDrli s;s  2umxrpiodap e ieiltfarumumoou0aex io3iltfm2rluvpnu)teeoif tatlaDeaues t0sexoim oudalte fesls)s2uax onu1opto ieilsfa rmums t4 lxrmr oadopte n sls) ruoiopnodll n fvs (farurx poo1texomoctlsfs uln snt0aexrirciytoaDran il(0trxm(opoydlm elfei ( s2rm(  nt4aeeoioeildfs rlnmon()trtnifcoadfp  anvs s0s2tm(m3nodaltnlfetls  rrr(mpno0ale ioctatfm ul( pn(4tetrio iadoptelieol()trxr(mpiu1al emnetat aDurxroou0tpxn o3ild aDulu p;u4artnmf ty1op  auvils)t2tmxm iu1lpt lnesat aDrmu oou0aee  iciatfa rm(vs;t)aetomo3to1latrln o;(  rxoxr iu1om  mnvt s aDtru o;u4oeeo feiltls2emnmp u)alxnmo tydfmtr uvo;t)sexo(o ny1al  mfesasf rtau poo0alen fciat m rau snu4teeoxf3iydopte n ilt  2um(mpio1oleemfesa( s2trxmp;u0ope  feilt s2eluvonu4 etnif tatfatelnvi;( t2ur(r iodome liet s arua(  ;t1aeenmieilsla2ranvs;u) lxrxf oo1oaDe nvo;s teum(r iydopenmnvs s aDrmumooo4tlx iieiasla ul( pn(0tlxnxo ty1op r u olt0s2xrim nudlle mnei s)a2tm(rp;u0tpen iciatlsDuanmp;u0 exnxf oy1fp  aivsls  euoxopoodop  lics () rrrxmpnt4oleomo3iadfsDuaumo () lxoxr tadlat  uvi ()trxrio iu4optnmivs ()artaxmp;u1tlenio3tyt m elnvont)arxrxf3iadfa raieil( trtrir io4ome  fvi ()srumxmp;o4tee ifeiysfa rmump;()alxnmr3iydla e n o s t2xr(mpoodam emncil(  2tru  ou4tetnio3ilt a2el(msnt4altoir3iy1fmDr nes;t s2urio3iy4lpenlictatfaDra(mpno0opxn f3ildfs uau p (4aetoxf3iadla r ivi (0texrir iu1ole mnvias)sDra(  ou4aex moctytla rm( sn()tleomr tadoa rln i;s0 ruoio3no1lmtnmies t artr(mpoo1aet mfcilt a ua(mpnt4 exomo ootlptranvo s trxr(mpio4omt  ictl() rraxr nu4aex moeiatlsDrmuvs t)arermo iydoptranvslt t2xrio3nodaltemfctatf Dur(m oo0teenif3tadfs em( o;t) etnmf3io1lmtelneilt  etrxrpoudal  lnvtat) Duauroou4tlx io3iyd aDemums;t)tltrmr3tydlm eaies t0srxm(m nu1ap emfetls)arum(m ;o4teeoioctld a2ran sn(0tetoir3tadlptr u i s) 2tm(mpoy1ape  netat) Drrurpnu1olxn o3iat m2um(mp () lenxo tadfa rau i;( srumir nodop n ncsltfsrum(rp;u0teeomf3iyd sDrmuvon(4trtrxfctotlaD  n i;s t2xoio iy4altn neslt)srtmur no1openiieiasfa2umu s;(0aexrmocta1omt aivs s)setr(r3oo4openlfeta(  Dra(mo;u0altomfctas mDranmp () eenxo ia1oa   ivolt0 2tmiopnydlp  mnvt tfaDrm( o;t0oexnmf3iatfm rl(vp;t0tltnxf3iotlpDeln ols)seuoxm3iudoltn nci ( a2uax  oo1olx  o3iydls2rlnmo (0 rerxr3iydfm rliesl( srxoxopoo1opte fvilt  rtm(ro;u4oeto ictltlm2umnms;(0aetrxrciotomtraivil(  rurimpiy4amtnlieil(  Drr(  ;t0tee mieiys a2rl(mp t4treomrcia1lm  lieols)tetrirpiy4oltnlfes sfsDumxrpoo1opt  ieiasfmDelnmp (4arxrxfcoatomtelnvol( t2xo(mpnu1am  lnet s)sDur(mp;o1aleo f3iadls rmnmo;u4aleoif3oatlate nvs;(0sexoimpoo4apt licsl(f 2um(r oo0olenioetlt s ul( s;u0altrxocto1omtrlues;t0 euoxm oy1ap e nct t  Durx  ou0olxn fciasls2rl(ms;()aetnxo oy1oaDr neo t srumxopoudllt mfcsa(  Dua(monu4texo fetytfs2emnmo u4tltnxf io1fateai olt setrxm nu1amenliei t aDrrum nu0alxn o3ildlaDemu pn(4trermo oodlpDean il( seum(rpiodoltelivs t s2tr(ro;o4tltomietlt s2ua( sn(0 lxrir tadlm  lnvols0s2xoxm iu4ale mnct ( a2umxr ;o1oex ioeiyt s2rmu s;t4aeeoxr iatfp elivi s0 etr(m3nudlpe  net (fsDrm(ro;o1ole iictatla2em( p;t0aeenir3iatfm   u o;s0tetoim io4ol nlncsas) Durxroot0aetoiieiysfs2ulumo;u4 eenio3ty1lpD  neol(  rxmxm3no1om nlfvsl(f 2tm(m ot4alx ii3iatfs rau pn()aleomr tytomD  nei t0 2triopiudam elfvsl( artrxm ot4tpx mfciltfs2raump t4aleomociatlaDe u ol(0truo(o3oodal  lnvil()aDtrxmoou1tpxoio3iadfsDrlu snt)tlxrif ia1fpt auvsls0texo(rpoydlptnlnvtl( s2rrxrp;u4tleoiicild a2rlnvont4altrxf3totop  aivsls0srurio3nudamt miviatfsrtrum ;u1ape mieild sDum(mp;u0alerio iy1lm  lu i;(0srtoxr no4op  lnvtls) Dur(mont4
\ No newline at end of file
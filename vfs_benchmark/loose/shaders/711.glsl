@@ -0,0 +1 @@
+uvo ()sexm(o3ny1lm n ictas srrrx  nt0olenmf3ilsfm rlnvont)altoxfcto1lm  auvs () etmir3no4lpen ncilt srumump;t1teeo f3tldlm emnvs u)aexoif tytlpt  neil(0 2tm(r3oo1lp n neia(fs2rm( p;t4tetnmieildfm2em(vont4arerioctodfmDeluesl()s2toir ou4ome mneiat sDrmurpnt4tptomieiadfmDea(mo;t0treomf tydom rlu sls s2umxo iy4ope mnvsat) Dtrxmont1aeto fctyslsDeaumpn()tltnxo iydfmt lneo;()seuoxopio1ol  mncs (fsrtru onu4opx mo3iltlmDrmu s;u0tetrmf3iadomD ai sls0t2xr(m iu4aptnmfvs ( arum( ont4apt mfciysfa umnvs t)arermr3tytfmtr ivo;t0trxrxo nu4lm e ivi sfaDumx  oo0aexn f3iatfsDul(ms;t) eerircoytom rlueo;s0s2to(rpoy4ame lnctltf rta(m ;o0tlxoif3iydfs ua(vsnu0tleoio3io1laDelueilt s2to(o3ny4alt mnet t)artr(mooo1tlt  feias sDeauvp;t)trtnmr iotomt ai i (  rxm(r ou4llteliei t) Dumu pot4opt ii3iydlm rm( o;u0arxnirctytoaDrlues;s)sexmim iy4ape  icia()arrmumo;t0tpeomi3tldfm2umn s;u0areoifciadopD au o s sexmxrpnudomt mfctlt) 2um(mp;o1oex  feiysfm2ul(vo t0alenio iatlaD  i i t tetmxm oudlmte ies s s2raxm nu0aptniieiadfmDumu p (0tetomr oodfatean s;t t2umxr3io4optelivsasfarur(mono0ole  i3iytfa2ran sn(4aetoxf3oy1laDe i s s trxo(r3ny1am  mfvs t a2rm(m nu1tex ii3iasfs2umu pnu) eenmr3oo1lmDeai o s0 euoxr io4ol nmfvt t artr(rpot0tetoioeildfm eaums t0 ltnmr3tydfm rlueo;t)sexmim iy1ol   ictlt aDtr(mpoo1aexnmictydla2emu onu0tlxrmocoa1fm   n i;s) rxmir iodapte ietls  Dtmxrpoo4oexn f3ilsla eauvon(4 lerxfciydfp elnei;(0 rxmxrpoudlm  mivsl(  rrm( pot4apxomfctys s2ua(vp;t) ltnir3oydfateauvols0sruoxmpiy4lp elieta()s2tr(rp;t0opxnif3tlsfm ulnms;u) eermrcootop rli i s0 eto(m oydom emfct s) 2ururono4aee ifeiyslsDuanvs;(0 leomf3iodlp r nvs;s) exoxmpnydlmtn nctltfaDrrxm nt1aetn oeils sDrl(vs t4 rxrxrcoatla eai ols)t2umimpou4apeemnvi tf rtm( ooo1opxn ictlsfm ea( p u0artoxocoa1fa e uei t sexrxm3no1ame lics s a2trumpnu4opx  o3iytls2rauvsnt4aleomrcoo1lpte i i;t) rxrxmpiy1amtemivtasf 2rmx  ;t0aexnmocils m rl(ms t4tetomoctydfaD auvo;(0 rxo(opoydamtnmieiasfa2uaxr nt4altnmociat m eln s;u0aeeoir to1fatraues;t trumim oodaptn fvt ()sDrau p;o0olto ocildfs uanvs u)trxrxf to1lpte n i;(  rto(o oy1lp  lfci (  2uau pnt1alenif3iytfa2rm( o t4arxrmo3iadfpDe ieo;s)s2xr(mpiudap elfcsltfsDuax o;t4alt mfeiyd m emn snt0aexrif3tatomtr ueol()s2uoiopoy1ol elivtasfa2trxm no0oltniiciadfmDumumo;(4teenxfcty1fmtelnvs t0s2xmxmpno4om emfci sf Drruront4tlx miciys a2el( p (0alxoxf3oydfa  aivi;t s2xrirpiu1lltnmictlt)a2rmuro;u0apeoiietatfsDranms (4trtoifcoydoa e nvs t0teuo(rpno1omt  fvt (f rrrum ;o4tlx mf3iyslm2emu o (0alxoxfciadoptr nei t0t2toxopiy1ap elnvtls) rumxr nt4tetn f3tlsfa2ua(vs;t)aeerxo3oa1la ean s;s s2umxm3oydol nlfvsls sruaxmpot0ape miciadlsDrm(ms (4aexoxrciatfat  u s s  exr(r nu1opt lneta()srtmxmp;u0aetoiociysla2umn pn(4tleomo3ootlat  uvi t)srtrimpnudlptemnei () rrmx ono4ope mietlsfmDra(mo;u4 exoirctadfatr uvilt0 2xoxmpiy4aptemnvtl(fsDua(  no4oltnmietydfm2ulu p;() rxrmr3to1la r nes;(0trumimpiu4olee ieta() Dta(mpot0oex ifctysfm2ean s u0texomfcia1fmtrlivo;( s2xmio nu4apt lfesa( srtrur ;u0tetn f3iyt mDul(ms u4trxrxo oy1opD luvolt t2tr(rpiudll e fvt sfartmu pot1aeenmoeiyt m2uanvo t0teenmo oytfaD luei ()t2toio3io4apenlnvtl( aruax o;u0tlxoii3ild a2ulnvpn(0 lxrxf3iydoatraivo;t0srxoxrpny1ol elfvsatfsrumum no1olt  oetatfmDumnvs;t)aleoxo3ootoate n o s0 rxoxmpnu1omenmivs s  rrr(mp;o1ale ifetadfm rauvo;u0trtoifctatfptrlies (0setmirpnu1omtnliciat  rrm(  oo4apxn fctldlm emuvpn()trtrir oy1omDelu i s t2xr(m3oy1lp nlies ( srtax o;u0tpenifetysfs umnvs;() lxomf ia1fa e n s t0srtrxmpiy1lmt livs sf rtax o;t0teenmociydlm2ra(vs;u0 rtnif3iytlm rai ils)t2um(o no1am   ivi s) 2raxmpoo4optomi3tydfs2umn o;(0aexrmr3io1latrln s;t0 eto(r io1lp nlnetatf rurxrpnt1olt moeild a uau onu)tetoif tatoaD aneol()trtmir3no4al nlnvilt) 2ta(ront4aetn iciyd s uau p (0areomf3totom  lneol( s2xrirpou1om n fvsltfarumu p;o4aleomo3tlsfm rl( s t0 rxomo3oadfmteaneol(0 etr(m3oo1ame  iet (fa2tauront0tpxn feilt a ea(vp (4 exrifciatom ean il( sexmxo oy4lltnlnviat) rtmxrp;u1olxomieils m2ulnmo t4 rtrxfcoadfptrlues s)srumim io4llenmnesl( aDtmxrp;t0tlen f3iltfm umnmont)trxoir oa1opte ivs t)s2xrio oudol elivs t)aDrrx onu1aexn iciadlsDemnmonu0tltnmr3oodopt ai s t)sexm(o3nodape livi t  rtr(mo;u4aetomociat s2em( s;t)arerio oa1lmteaneo;(  rumxo io1apenlicsas)s2ur( ont4opxniocilt a um(mon(4alxrif3iy1om elneslt)truoirpou1al nmnesat  rua( ono4oet  ocilt a2eln o;u0trtrmrcia1op raivo;(0setoiopoo1ape lfetat)aDraxmonu0olxn ocias mDuln p t)texoxo3oatom elnvs t0 rurim ny4ale mict tfs2rr( o;o1alx  oeiatlmDrmnmp;()treoxo ta1omD aneo t0 euo(o nydapee fci tfsDrmxrooo4tlxoioetatla2umumsn(4 lxnmr3oa1fa  aieo;t0srtmxr oy1op  lieiasf 2urxronu4tetnioetlslm ua( on(4aetrxf iydfmDrluvol(  etriopiydamtnlivs t a2tm( pnt4oeenmf3iatfsDrl( ont)tlxrmo3io1fmtr nes ( setrim iudolee fctas aDtau pot0oeenioetlsfmDrmu s (4aexnmfciatfatelues;t0 rtriopoo1ol   ivt (  Dua(r ;o4olx  fetltfs2ra( snt0artniociytlptelnvols)srumxo3oodol n ietltfsDur( pnt0olto icilslsDemnvsn(0 reoxf iydfaDeanvs;(0t2xrir3io4lm  mnci s a2taxroou4ole  fetyt s2ulu o u4treriociodfpDe iei;s)srur(opiy1lpen neia( arurumono4tptniieiys a ulump (4aeeomf3oydla rai s;s0seurxr3oo1apeemieslsfsDra(moou0olxo oeiaslsDuan s (0aleoir totoaDrau o s  euoir io4ap nmfvslt srur( o;o1apeoif3tltfm uanvp;(0alxoxo iydfatraneils)trum(m ny1oltelncilsf 2umxmo;t4aexn ieiyd s2ea( o t0trermfciatoa elu il( s2xoio3oo4ame  fcias)arrm(roou0teen feiltlm rlump;t)tetomf3ty1fm  lnvol()s2xrir ny4apenliesl( sDraxr ;o4apt  ociltfm2ean s (0texnif3tatfpte uvo;(0srtoim3ou1am elfes sf Dtr(m ou4alxomfeiysfa2emuvs;u0aeerxo totom eai i t0 etr(o3oydaltemnci (f 2rmuro;o1alt mf3iysla emu p (4tlxomf oa1lptr n o;(0s2tm(o3oydal e fvtl(  rrru o;t4tptn ocildla2el(ms;t4 rxnxo oytlmDrln olt) 2uoim ny4omtnliet t a2rax  no0apenmo3iatfs2ul( s u0tltrmr oo1oaDrauvi ( t2trxr3oodllen nvilsfarua( p;t0oeeo o3iydfa em(mpnt)aetoxr oadfm   ies;t) 2xrxo3no1ole mnetl()srtru pou4opxnmf3tad a rl(vs;u) leoxf iy1oaD anvsl()srtmim3oydale mfeslt s2uru oot4apxoioetysls2umums;t0 exnio iotfaDe ueols)srtoxr3nu1olenmies ( a2urx o;t4tle io3tadlaDemu s t0artrxf iatfpteau ol(0t2tmxopoydlp emfct tf Drrxroou0teen f3tls s emn sn(4trxomr iydoaD  iei (  rtoim ny1olt mfcsa( aDtrxm nt1optniiciltfs rl( snt0aetnif tydopDe u o t)trxoxr iodlmtelnviatfs2tmxr no1tetomo3tld mDelnmpnt)tetrxociy1op   neo;s)t2xmimpio1lp nmietltfaDurumooo0texoif3tyt m umn p (4alxnmfciatlpt an olt0srumirpou4al  mfeta(  ruaxrp;o1oexomfciasla2uluvs u4tlerxf3oydlp rau i;t)t2to(rpou1amte fvtls sDtmumpno4teen ietad m umn p u0trxrmf3ty1fat aneo;( trxrxm3io1omen icsl(faDrr( onu4apxomf3iatlmDuauvo u)trxoxociydlaDe i s t0texoxo nu4altnmiei () 2trx  nt1oltnif3tysfa rl(msnt4aetrif3oodoaD livi;s  2umim nudam nlfctltf 2uru pot1ole ioctydfa rl(vs t)artomf oatoaDelues () rtoxrpiy1amee icsas) Dtax  ;t0aptniociyt m2el(vs ()aeenmfctadop   ieslt)srtm(opno4ll  lfvtat)arurumo;u4tleomi3iaslm ulnmp;()aetrxr3ia1fm e ivils) 2tm(mpiu1om   ieta(fa2rrxr ot4oet  f3tyt aDuauvo;u4aetrmo3oodfaDe nes;s0srtoim ou4ope  ncslt aDurxr oo0opxoioctys a em(vp;u0alxoifciotfmt li s;(0srtrxo nodapee fcia(fsDumur no1tee  feiasla uaump;()altoir totla raueo;( trurir3nu1opt lictasf 2tmumonu1tpenmfctyd aDumu s () exnxr3iydop eanvi;(0truo(m nu4al elnvilt)s2rmu oot4tpxo ictyt sDrlumsnu) rxrircia1lpt  uvils)trtoxm nydom   nvs t arrmxmp;u4altoif3iysls em(ms;() rxrxo to1fpte u o () 2xmxr oo1lpe lictatfa2ua(mp;o4tlto fctldls el(vo;t4aleoxocoo1lpDr u i (  exm(mpnu4lp nlneil(faDtm(m no1tltnmi3iydfaDemu onu4tltnxrctadlm ean s s0 eumim3no1lle  fvsl()sDra(mo;u4aexn i3ilsfmDum(vpnu)alxnirctytop elueo ()srum(rpiu1altemivi t  rraxmo;t0oetnmi3ildfm2emnvp;t0 rxrmo3iydom rln s t)seur(o oudlle lnei (fsrum(m oo4tlenmi3iltls2ua(ms (0 rxoif3io1lmt  ueo ( s2trxmpoudlm elicils  rrmxmono1ope  ieiatfs2rm( s;u4tlxoif3ia1op   iei;()s2ur(rpio1lm nmivsat) rtr(r no0aee moctldlmDuan s t0altrxf3oytfpD livil(0 etmxm3oy1amtn nes t)srtmump;o4tpeo ociatlaDuaump;t)teeoirciy1fmt li o;s sexmiopou1om nlnctl()s2rau  nt4oee mo3tlt aDul( o ()trxoxrcoa1lpD luvs s s2xm(r oo1lle  nesl(fsrrr(r ;t1oleoii3iadfsDrl(vp;t)trtnxfctodlaD  ieils0 rxrir iudllenmiet ( sDrr( pot1teenmociad sDea(vpnt4treoifcio1fmtelnvil() 2xoir3iydam e fetat a2urxmo;u4oetnif3ildlm eln o t)aexoxrcty1opteaieo;(0trtm(o3nu4amen nci s artrx pno1tlxnmi3iyslsDeau on(0teerxfcoy1lpDelivil( trtrxo ny4alt mnvias  Dtmuroou1oet ifciatlm em(mp;u)trerxo oo1lmt lu s;( seuo(mpnodlle lncsl( aDumx  nu0oltn fciatfs2rmnms;u0 ltoxr ta1opDr u sls0 ruoxr ny1al   ivtl(f 2tr(r ;o1apeo icils s um( o u4trtnio oytopD auvils0 rtr(mpiudom   nctat sDurumoou0open oetadfa2ulu p u4tlxomrcoa1omteaivs;s s2xrio oy4ap  lnvtls arrr(r nu0aptn feiadfmDua(mo;u0areoxfciydomteauvi;s0srum(m nydapt lfcs s)arumxro;o0oleo i3tlsfm ua( s;t4 exnif ootoa e i i;s)sexm(r ny1ape mnci tfsDtm(rp;u4olxn i3tyslsDrlu s;t)artnif oa1lpDraneils0 rur(rpiodal elnet (fs2rau pot1oltnmiciadfm ul(mon() rtrxo3iadopDe i ils srur(m3nydllen nes t)a2rrxr no0aexn fctls s2eluvo u0aeeoif iytlpt lnvi (0sexo(r3iudllte ncslsfsrtm(rpou1oexomiciasfmDra( o u4artoifctydoaDeluvols0 2urio3iudlle lici s aruau  ;u0tptnmieiydlm uluvsn()tlenmo ia1laDeanvs;s) 2tm(opny4om  lncsasfarraxm nu0teeomo3iysfm um( s u4artoio io1fpDran i;s t2tr(o3iu1apeelfcs tf Dta(mo;o4oexo f3tydfm uau onu) rtnmo iytlmDr ivolt s2uo(r oy1apte ics s) rtmxr ou4alt io3ild sDuanms t)texnxo iy1fmt luvols sexoxopiudam nmfvsl()s2ururo;u4oee mo3ias s2uauvo u4arxrmr oo1opDr ueslt0 2umxo iodape licsasfsrtmx oou0opxo iciytlm rau ont0 exoxr3ia1om rln i s  eum(m ny4lm nmfvtls a2uax p;o0oleo fctysls rlnmsnu0trtrmocoydla  lu i (0 rxmxm oy1op emicils aDtru o;u0oee mo3iltls2rl( pn()alxoxfcio1la e ivs t)s2xm(rpiodlpenlfvsatfsDrrx  nt0tpenmoeiltfm2em( p u0tlerio ta1op  auei;s0sexoxr3oo4amenlfeiat) Drmxr ot0openmfctyt aDulu o;() reoxr3iotlmt au sls) etmxr ou1amenlnvi s)s2rmxmpnt4aex  i3tldlsDel(ms;t4trxnmr3iadopt lu ils  2toxrpiodoltnlict t) rum(m ;o0oetnioctltfsDumuvont4 rxnif tadom  aueolt0 etmxmpou4opeelfvsls s2rau  nu4oeen fctytla uanms;u0tlxrio3oatopt  uvi () eurxm oodlltnmnetlsfsrta( ont1openii3tytlsDum( p t4tlerir iodopte uvi (0s2tr(o iy1olt livtatf rrau oot0teeoifeiatlm2ulnvont4trtoxfcoadomteaueo (0 2trxm nudape mivi s  ruaxmp;t4apeo fcias a2umnvs;t4alxrmrciatoatr ivi;( trxo(o nu4omt lnes (fa2tru p;o4tlto f3iatls2uln pn()teenxf oo1opDr n i;s0s2to(m no1ll   ivs sfs2rr(ro;t1opxn o3iasfm2el(mo;t4aexomociytfpDe nvi t trxr(r3no4ol nmfvsasfsrur(  nt1oexnifeiydfs2ranmp t4treoxocoo1fm rai o t)t2urxopny4lpte nci s  2tmu ooo0aetoio3tytfs2rmnvsnu0 rtnif ootlatelueo (0 ruriopno1optn fcs t sDurump;u0openifciydlm umump t0 rxnmrciadlp raies t sexr(opio4lpee ncil( arrr( pou1opeo o3tldlaDea( o u) reoif3tydoaDrau i;()s2xmxo3ou1amee ncta()aDtmuroot4ape mfeildlsDemnvs (0 rtnmr3oytfmt li ols s2trir3oo1apt mfvt ( aruaumonu1olxo f3iaslsDrm( s t0trtnif ootlptr u i;t) ruoxrpoy4altn nei t)a2taum nu4aexoio3iad aDelump u0artomocoa1fpDe uvi s) 2toimpoy1ol nmnci t) rrmum ot1tpxomiciydfm2ul( pn()trxriocoytfptrlnei ( setmir oy1alee nvsa(fsDtau o;o4tle iietlslaDrauvs (4 exnxf3oo1lmD anvolt sexr(rpiudoltnmfvil() 2tr(m nt4tlxn fciad sDelumsnu)tlxnxf oadlmtr ies s setmio3no1al  mictas srta(m oo1tetnifcildfaDelump u4tlermr3oatomt an s;()t2uoxr oy4lp eliciatfsrraxr ot4oexomo3iasfsDumnvs (0 rtrifcoydfmteau s t0 2xo(o3oo1olt  net (fsDtm( oot0opxnmoeiatlsDuluvpnu4tetrifciydomt lueilt) exm(m3ou4apeelnctat arrm(  no1aee mietasfs2uanms;t4trerif oodfp elnes;(0 2toxopoy1altnmfvtl(  2tmxrpou1olxnmo3iaslm2ulnvp;(0tlenmf oydfm  li i t  etoxmpoy4oltelivsasfartr( p;u0opxomo3ilt m elnms;(0 rtnif3oodopDrau s s)setoim iu1ame mietasfsrrru  nu0openiiciytfm em(vpnt0tltnmocty1opD livs s)t2trimpoo1omt lnctlt aDtmxr oo1oeen feild a2uauvpnu4alxoxf3tytopD lu ols)tetrimpiy4lp n feils aDum(mpoo4tpenmoetysfm elump u4altoxfcoodlp rauvi t0tetrio3ou1ol e nctat  Drmu  ot0olxn o3tadlaDra( pnu0 rtnmo3oodlmD  n s;t s2trirpoy4om nlfcil( arur(mo;u0altn fciytls ranvp (4 exoxr3tytfpDraieo (  2xoxr3oy4olt lnct ()a2ra( oou0aleoiocild a2um(mp t)arermrcoy1fm  li i;s s2uo(mpiu1ll nmncil(faDtau onu0aptn ocild s emump;u0arenmr tytfmtrlu ol( t2ur(r nu4apt  nvtasf Dtm( pno1tpt  o3tysfmDemnms;t0altnxf oodlmDeln s;( sruo(rpno1amtemfct ( a2umx  ;u1ale iicildla2umuvpnt0tlxrir iotlp eliei;t sruoxm ny1om e ivsa(  Dtrxrono1apxn o3iatla2rlnmpn(4 ltriociatfaD  neo s0s2ur(rpoodome livsa()srrruronu1tpx miciat m elums;t0aexoir oa1lmD luvi s  rxmxo nydomenmfct s) Dtau o;t4apxomieilsfs2ulumo t) reomfctotoptrlnvi;s)seumio iu1amt  fvsls) Dra( onu0aptoiictadfa2elu o u4alxnxoctydfmDelnvo;s0 rxr(mpny4oleemieta(  2rmum ;o4tle iictltfaDrmu p;() lermfcta1fptr ueo t)t2xm(opou4lm nmnvt ()s2uauro;t0alx ioeiyslaDra( o;t0trxnxrctotfm elneols texm(opny4ame  fvil( aDurur nt4oeto f3iaslm ua(vs (4aexrmrctytlp eauvsl(0setrxrpiy4amee ivt s  Drmuro;o0oex miciatfs uaumo u)trtomrcoydfateai s;(0t2xo(opoydol e fcsat  rrmxronu0apx if3iadfsDumu s u4trermocoy1fpt  i s;() 2tmxopiudllte ietl(farrm( ooo1apeoif3tlt s2ul(vo t)altrxo tytlp  aueilt0setmxmpny1apt mfviat  Dur(ronu1openmictadfs el( o;(0aeenmocoydlmDrai ols)t2xrxm3oydlp e ncs t  rra(rpou1oex  o3ilslsDrmnvo;()tetoxf oydlpDrau s t0 exmxm nydalenlietatf Dum(mo;t1aetoif3ias sDelumo ()texnmo oydopDe n i t0teum(o3iodlp elnctls aDrmx o;t1tpxn i3tld a rlnms t) rtomo3ty1fptr n o () exoxm oodlmeelivtas) Dumxm ot1tex  oetydls rlumo;u0aexnxo iadopte ieslt0t2trxrpno4ape  iesl(farta( pnu1aeeniieiltfa2eanms;(4alxrmr3iatfpDran sl(0t2xr(o3nodomenmfvsatfa2um(rpoo1tpxniieilsla2um(ms t4 ltoiocio1lptrlu ils trxmiopiy1al nmncsa()sDtau pno1oetn ocils mDeanvon(0 lenio3iatlpt  ivsls) exmir3oo1lptelnvsasf 2taxro;t0aptn fcilslm2eaumo u4aexoif3io1fatrlivols  euoim io1ol  lnetas aDua(mp;u0apt  iciytfaDran onu)alxrxocoy1lpteanvil()trto(opnydll n iesls  rurxr nt4tlxnmfeils m rmump (4trtnmr oytfmt ai s s setmio3no4om nlivsl( arta(  ;u0oet ii3tysfs2rluvs (0 lerxrciotop r i i;t0texoio3iy1om elnet s)sDurxm no0olt ifeiat s rlnmsn(4tlxnir3ty1fpDeli s;t  exrxo3io1am  lieias aDtau  ;o0tetoifeias aDemnmo (4trxnxociytoaDeanvi t)setrxr3io1lptnmneiasf rrm(ro;t4apxnioctadfmDrm(monu0alerxf oadop r uvo t  exoim3iu4alenlivs ()sDumxrpnu4tle ifeiat m rl( snu0tlxrmf3io1laDrluei;s) rxo(rpoydomeemnvtl( a2um(rp;t1opx mi3iasfsDuluvo t4trermrciy1om r i slt trum(r oo1lpt  fvil(farrrxroou1alenifciadfa eluvsnu0aetnxo iotlpDrlivilt)s2xm(mpnodap emncsatfarur(  nt0olxn i3ild a rlnmsnu0 lerxociadfaDelivolt  etoxo3nudlp elfci s s2rr(mo;t1tltnmicilsla2ea(vo (4 lxrmf tytfa  ln s t0t2xoio iu1llen nes ( aDtr(rono1oexo i3tat sDrmu o;t4 ltoif3iotop eauesl( t2ur(rpny4lltemfeia(fsDtau  ou0tex moetydfmDua(vpnu4tleoir totlaDrlnvslt srtrimpny4olte ivia()aDuaumo;t4oexo ieiadfm2ran o t4tetrxo3oydlp raivil(0 2urxm3iodap nlnct t) ruru p;u1alt io3taslsDrlnmont)aeerir oa1fm e ivi s  2xo(opno1ap emfet s)srtr(  oo0altnmietysfaDuluvon()tetoxf3ty1oatr uvolt  eumimpno4aleelfeils)aDtmx o;t4aet mfciad s ulnmo;u)alxnxr iy1oa r uvi;()trxoiopny4opee fcsa( s2ur(mo;u4aetnioeilslaDrmu o t0artoxr3totlpteaiesl( s2urio ou4olt livi (f 2rru ont4opxomietys mDulu s;(0aetrxo oatoa r n ol(0texoxr3nu4olte iet t artm( pou1oeto i3iatlaDel(ms t4aexomr oydla rli i;()trur(mpnudale  fct tf Draxmonu1aexn fciyt s emn p;t0trxoiocty1oatrluvs s teto(opnodom  mncil(farta(m ot0teeo icilsfs2el(vsnu4aetrxo todlat  uvo;t s2xrimpio1ap  licsls) Dtm( o;t4oetoif3iytla2um( o t4trenxrctatla r n o t0 2xoxmpiy4omen nes ()aDtau pot4tee  feiytfaDuln s;t4 ltnmr3ta1fp elies;( trxmirpny1openmfcias)s2trum ;t1texn o3iysls rluvp u4treomf oo1fmte ues;t sruoim3oodomt mneils  Dta(m ;u4tpto fciysla2umuvs (0trxrmo3tatfaDe ueil( t2tr(mpiodlleemivil(fsrumum nu1oet if3iad a uln s;(0aexomr iytlat lu il(0 rumio nodlmen icslsfsrrr(  nt1tptn ocild mDrm(mpn(4 eenxo oatlate neo t)sexmxmpio4omee ics tf 2ur(rpot4tpxnifctas a emn s t0trxoio oo1fpt  ueo;( trumxr io1ameemiet s aDumxrooo1aeen ieiyt a2elu ont0teerxfcoo1fp raivo;()srtmim3oydll   netlsf rrau pnu4apxnmoctad aDuanvo;u4aeerxfciotomD lies s srxrir3oo4ol elivslt s2taxro;o0apx iictad s2rl(vp;u0 lxnmo3oodlat aiesl(  rxoir3iu4oltnmfcs (  2raxrpoo0ole mo3iaslm2elumon(4trtnxf3iotfa eluvi;s)seur(mpiu4optnlicsa()aDuaurooo1tlt iiciydlsDem(vs;u) ltoif todoatrlies;s0 eur(rpou1oltn fcil(f 2rrumont1teeoioeild a2rl( pnu4 etoirctodfp r nvi;t)s2uo(mpno1ol nlfcs (  Dtr( o;o0oet iiciltlsDrmnms;u0aeerxf3ty1lptr n ilt t2xmiopno4ame  fvtl(  ruaumpnt0tlt mo3ilsfsDrmnms;u) rxrmfctytfaDr uvi s  2xoio3io1ap elici (  Dtrx pou0tptnmf3tas a2rln s;u4 ltomf3iytoa ran o t) ruoirpny1apenlivtl(f rum( pnu4tlto f3iys s2eln s;t) rxrmoctytfat li i t  eurxo oodomtnlicsa(faDurxr ;t0alxomfctyd sDem( snu)alxnmf oadoat  u ils0s2xrir oodamtnlies s aDrm(mpot4aexo ieiys s2um(vo;u0trxnxrcootlaDe nes s sexmxo oy4ape  fvsas)s2rru ooo0oee iiciadfm ulums (0tleoxo3totoaD aiesl(0texmxo ny4alen iet t  rrr(rp;o0olt ifctyslsDeluvo;t4 exrmr3to1fm rli ilt  etr(rpiudaptnlnctls)sDurxm ;o4olx mf3tyt mDuaums t0 rxnmrcta1lpDrai s ( t2um(m3iodomt mnvil( sDuaum oo4alxo f3tas a eau o;(0 ltrxf tadlatr uvo;t)srtoxrpiu4lptn iet ()aDumurooo1oetn i3iasfs2ea( p t4trxrxfcto1fmteai i t truo(o3nu1al nmnvs t srrr(m ;u1oeeoifeias s2umuvs t0 lxoxrciydfat  ies;t0trtmxo nu1oltelneil( aDur(mooo4aeen fciadfm rmnvo u0trxnmr3io1fat  neil() rxrxo3iu4ap emfeta()a2tm(monu0tlenif3iadls ua(ms;t4arxoxfcio1opte nvs ()teuo(m3oudopee nciltfaDumxmo;u4opx mfeilsfa2rl( o;u4tetrmr3oa1lmtr u i t0 exrxrpoo4ll emnvsas)s2umxmo;u0tptnmieiltfa2uanvonu0altniocta1fpDeluvo;s0trxm(r oydll e ict (f 2rmxr ;o1aetnifcilt m2eaumo;t4aeenmo3oadomtelnvo s srto(m3ny1alenmnvsat a2uax o;u0tee if3tas sDeln p;u4tltrmo3tytfp  aneo;t sexriopno4am n netat  Drm(  ;t4alxo i3iyt sDrm( pn(0aetnxo3totlatelneils0 rurimpoy1altn iviat  Dtm(  nt0tlxnio3tls sDrmnmp;u)trenif oydlm  livolt)srtrxm no1ap emnvsas arua(  oo4oleomfetytlm rmums u)tetnmf3oodopteau o;t trtr(r3iodlmte icsa(f 2uaxrpno0apxnmf3iasla2rl(vo t4 rxomr oytoaD livs;t  rtm(m io1apt  nes (  Dra( p;o1tlxnmo3tls s2uau p (0altnmr3oadlateaueil( setmxo3io1ol nlnct (fsrtmumpot4oee mociysfmDulnmon()tetomr io1omDraueilt0seurio oy4op nlici ()artmurp;u4aet iietas sDrmnvo;u4alxrmf3iatlate nvols) ruoxmpiy1ll emnetls)s2urum ot4tpxomi3iat m rlu s;t0tltnio3todlp rln ils  2umimpiodopenmfetas artm( pnu1altn ietad a em(mo;t0 lenxrcia1faD aues;t0texrir3io1lmee ivt s  2rmump;u0optnii3iadlm raumo t4tlxrircoatopt  ivols s2xrxmpou1ol nmicsas  2ua(rp;o1ole ifeilt s2ulnmsnu0 lxoir3oa1opt anvs;( trumiopiudopenlncta(  Drruro;u0ole ifetasfa2el(mpnt0arermrctadlm e i o;( s2xoio iy4aptnlfeil()arraur no0olxomfeias m2ul(mp u4tlxnio3oytla elneil() 2xo(r3iy1ap e nct t)sDuaxmpnu4alto ieias a2elnvs;u4 rxnmrctodlate n s;t t2xrio3iu1oltnlfvsas) rrrum nu1altomo3tydfs2ea( o u4 eerio3oytlmte nvil()trxoim nudapen nvil(f 2tmu ooo0tle ii3ils mDraump u0 ltnifciotlpDelu sls0t2xo(o3oodolen net sfs2uax  ;o4olx  feiyt m2uanvpnu4aexnmr3oadfaDe uvi t) rur(opiudamtnlnciltfsDum( ono4alenmfeiys s rmuvs;u0tetnir3oodlm ean i s0 2uoxm nu1opt lnvsasf Dtm(m ou4opxniicildfsDua(vs (4 etrxfcoydfatrluei (0seuoim3oy1ome  ncsat  2tm(r no0opxn fcildlsDrmu snu4tleomr3oo1omDelneil(  rurimpiy1omt lneta()srrrurp;u0tltn fetltfsDulums;t4artoxo3tatlmDrli s;t0teuoxo oo4oleemiet tfa2umu ono4alt if3iadlaDeanvp (0arenifciodfatraivo;(0teumxr3iy4al nmfvtat aruau p;u4oeeomieiatfaDemu pn(0tltomr3ootfa ranesl()srxm(mpio4lm elfvtas) Dta(  ;u0olx  fctyt s2ulums;()areoxf3oytfmDe n o s texrim3ny1ll nmfei t)a2rm(rpou4aeeniieiad a eanvpnu0 eeoxrciodfm r ivsls  2xr(m nu4aptn netlt)a2raur ot1tpx iictat s umuvo;u) exnirciadfp  aivs;(0t2uo(o oy1ll elfcia(farrau  ot1opxnio3iad m2uanmp u)trerio3tydfmtrauvol(0 rxrim3iu1alee fcils a2rm( o;o4apx  o3tld s rm(msn()aexoio3totomD aiesls0 2xrio3oydaptn fcils)artmxm nu4apt iociaslm2rm(mon(0tetnxf ty1oa  lues t) ruoiopiodll emnvia() rtrur no1olt  iciltfa2rmnvp;t0 etrxo3totfpD luvi;t  exmio3ou1ole lnciltfaDrr(moou4oet ifctytfa2uanmo;u4tltoif3to1lmtelnei;t0trxmxopoo4om nmnetl()s2raxmpou1texnmfetyd mDem(mp t)texnir3oatlat auvi t  rtmxo3no4om elfvi tfarumxm no0opto ieiadfa raump;u) ltnmo oa1opD  ieo (0 ruo(o nu1am elivia( aDrm(rp;o1tpen ictls m2eln p u) exnmo3iydfpDe ivi (0trxoxo oo1amtnmnvs tfarumxr ot1altnioeiytlm rmumo;t0aetomo oa1lm elnvo;t)s2urir3oo4lpenmfvia() Dtaxrpno1opxnmieiatla2emumo t)alxoif3ootoatelu ils0srum(o nydoptnmicil(  2um(m ;t4open ictydlaDuau s t0 etnif iydlmtr uvs;()seur(r oy4ome  fei t  2urxr nu1apt  o3iat m2rmuvsnt0 lxnmfciytlmD lneo;t  etm(m3io4olte ics ()srtmumo;u4tptn ietytls uau s;t4treomocoa1fp  aues (  rxmir ou1omt lies tfa2urxr nt0oetomfciasfmDemuvonu4aexnif3ta1opD  u slt  2tmio3oodlme lneilt  2ra(mo;t4teen ieiatfm2emnmo;(4 etoifcia1la  au i ( s2uo(r3iy4alt  ieiltf rurump;o4alen fetat mDel( p (0trxrxf tytfate nes;(  euoxmpiy1ame mfcsl()aDtmu onu1ope ioetydla2rlu o u)trtnxocty1oa eauvo;t0 eto(mpiu4ape mieiatfaDurx o;u1olt  ictat sDul(vp;t)trxrxociadfmDr uvi;(0t2xrir iu1omenlfct tfa2rau  ;o4olenii3tytla el(von(4 exoxf3iy1lat luvi s)t2toxo ny4optnlnetls a2raxrooo0oeeomoeiytfa emnmp (4alxnif tatopDeanvolt0s2tm(m3nu4lmt  ivi sfsrum( pot1tpxnmi3iytlmDuau s u0 rtnmrcoo1fmt li i t0trxrir ny1ap e ivsa()s2rm(  ot0texo f3tydlmDrlnmo;t4 ltnio3oatoa   uvolt) ruo(r3oy4amtemnctls  Drmx oot0texniociytfs em(von() ltnxo iotfmtrluvs (0s2triopnydlpenlivs s)arurum ;t4tleo octytlm2umu p t0tlxrmr tytlpt luvs;()sexmimpnydoptelietlt srtrumooo0oleoiiciltlm rl(vs (4altnxociy1lp  auvi s t2toxmpio4ll  lictas srtaxrono0ape mo3iad mDra(mpnu)aexrxf3ty1fp eluei;s0srxmim iodamenmfct (f Drm( pou4ape ioeiad mDuauvo t4alermfctytfat  nvi;(0 2toxo oodom nmnvi s a2umx pno4optn oeiytls2elumpnu0 exnio oa1omtr uvils) 2uo(m oodaptelnvsas  Dur( p;t1oetoii3tytfm2eln o t0 rxoxrcoy1fa rluvi;()texm(m iydop  lfvsa()srrm( poo4oee  octat mDrauvp;t)aexrmf todla   u ol() exo(rpnodlp e ici t) Drmumoou1ole ii3iltla ean ont0aleomrcia1lmDelieolt)srxoio io4omeemncil(fs2truro;u1tptn fciadfmDuluvo u4 ltoxf iatfp rlivols)trtoxopiy1al e iet s)aDum(  ot1oeeomo3tatfm2ea(vp (4 ltoxr3tydfm e uvo ()s2trimpoydomtn nctltf rumu  no0aetnio3tydfs elums u) rtrmrcto1lmteluvilt t2uoxo iudaltemnvsls)srrr( pot4apxoifeiadfsDum(vp t0tltomf totfaDelnvi t  eurxopoo4ole mnci (farurumpoo0tlx miciydfsDum(ms;t0artrmfcta1faDraies;(  exrir oudoltemfvtl(f 2ururono1oeenmictlslm2rmuvp;(0aeeoxr tadlatraies;s0seuoxr3ou4opee icia( a2rm( oot1tex  ociat a ra(vp;t4 ltrxr oo1opteaivs;()seurir3ou4om e nesl(faDtaurpot4texoii3iydlmDuln sn(4aeeomo oodlp e n i;()s2toxr oo1lme  nei t arrr(rpoo4teeo octatfs rau ont4alenif3iytoat auvs;s0teumir3ny4am  lfvsl(  Durxm ;o0oltn i3iat sDrlumsn(4teerirciatomDrlieilt t2xo(m oudllt mnes t)srraxm ;o1tpe mfetasls elu on()tltnxr3tadfmt  neol()setrir3oy1ll  lieta(fa2rrx pnu0tpe ii3tys mDrmums u)treomrcoa1fa eli i ( s2umim ny1op n fvt ( aDtm(m ot1tpenmicildfs um(ms;u4 exnxr3oy1la ranvolt0 ruo(rpoy4lmtemfvsa(f 2tm( ooo1ale  oetyt a ua(vp (0tleoirciydlp raieol()trtoxmpnu4ole mnei t) rra(ro;o0opt iocias a rluvsnt) lxnir3oytfmDr n s t0 etmio ny1lltn fvsls s2rru p;u4aet ifciadla elu p u0aexoxfcoydlmDrau i s seuoxmpoy4op  lneiat sDrm( pno1tet iiciytfm2rlnvs;t0tlenxo totlaDr u s;(  exrxm3io4lpe mfct s s2rauroou0tpt  ictatfs2ul(vs;u) lxnxfcootfp elieo (  rxo(o3ny4omenmies tfartax  ;o1opeo ictys mDrmu o u0alxnxrcoo1op  an i t) ruriopiodlmenmnctl(  rtr( o;t1aetomociydfm rmnvp;() eeoxrctatlmD au s s0trxr(r3io1om emics sfsruax p;t4olx io3iltfa eanmp;()texnmfcoytomt livi t)seuo(m3nudale  feta()a2trumooo1ope  o3tys sDuau ont) ltnif iatopt aivsl( s2xmxr oy1llte fei (fa2ra(r ;o1oex  ietlsfs2emn pn()trxomr oo1opDr u s ( trumir3ou1omt  ici s  2um(ro;u0tetoii3iasfsDulnvs ()alxoxf3oo1lm   i olt)seuoim nudam elfviatfsDur(m ;o1altnmietydfa2eluvs;u)alenxf totop  ln o (0 rxo(m oo1lp nlncta(fs2urumpnu1tlx  f3iytls2ea( pn(4tltomf3oadoaDe nvolt)trumxr3oydlp   ieslt)arrr(mpoo0tpt iieils m2el(vp (0 leoif3iydoatrln o t)trxoir ny4lleelfei ( a2ua( p;o0apxomo3iatlsDrau ont0trerir tatlmDrai i ( t2toxr nodlp nlivilt  2rm( oot1oet  octys m emnvo t4trtomo3ia1fm   u ols) 2tmim oo4amte fesls  Dumurono4openioctlsfa ulums;u)tltoiociodlaD aivs () eto(m3oy1al n fvt t aDtmx onu0aetnmfetldlsDrlnvo (0aetriocoa1lp rluesl(0seto(mpou1lp emfeiat)sDtr( poo4oet ifctls s ua( p (4aeenmf iydfmtr u slt) ruo(o3ny1altelici (  2ta(mpou4tleomf3tydlmDum(vo;u4alxomr iy1opD lues;t0setm(rpio1omt mfcias  Durxm nt1ope moetyt a rluvp;u) rxrxrcta1opteaivs t0srxrir ou4ap nmiei sf 2ta(rpoo1olxn oetys s2ua(msnu0aetrxo iydomtrauvi ()sexm(opou1lm elicsatfarra(m ot0alt mocils s ua(vs u4 eenif3oydlmtrlueolt0setr(r oudlleelfcilt) rra( o;t4apxoioetasla rmnvp t) eenmfcoatfm elu s t0 2urir iu4ol  mfct t aDtrxrp;t0aetomo3ildfsDuauvo (4arermocoydfpt li s t s2toxmpiy4amtn ictat) Dtru  ot4tpx  i3ilt s uauvsn(4aetrmo todfp  au i (0t2xo(r3ou4ame  nvsas  ruax  ;u1aee ifctadla2uanmp t4 rxoxo oy1lm r ivs s srxrxo3nydlltnmnes ( sDrrum nu4olto f3iasls2umums;t4trtomf oodfaD aueo (  exrxopiodlmenmivi sf Dumxmpnt1tlxo octatls ulu pnu)trxnir3ty1lp r u o;s)trurxopny4opeelnvta() rraumonu1tpeomieiadls2uan p;() reniociodfaDelu i (0s2umio no4amtnlfeil(  Dta(  nu1tleniieils m2rmumont)trtnxr tatfmtraivs t0teumir oudom nlfcilsfsrtm(  ou0ape moeiasls rm(ms t) reoxocoatla rln i s)truo(r oo1oltnlfetat) Drr( ont0tlx mo3iadls2eaumpnt)texnmrcio1lmDelu olt0 rxm(o no1al n ncta(farrmx ooo4tlx  fciydla emnmsnu0trxrmfctadoate nvols0 rtoxopiodop  lfetat a2taxmpot0tlxnifetyslaDuln s t)teenxr3oydfmte ivo s srxmio3iy4olt  ivtlsf rrr(moou0ope mf3tat a2rlu o;u0aetnxf oadopteaieol() 2urio3ou4alte nvil() 2tmu  nu1tlt mi3ilt sDumn snu)artnmo3tytomD luei;t0 exo(m iodlle licilt arum(r nt0teenioetad s2rlnvo (0 rtomoctatfpD  neo;t  exoxo ny1ap n ncta(fartru ooo1oet ifcias mDulu p ()aeeniociodlat aivi () euoio io1omenlivilsf 2trum oo1oee mfciadlm2ran p t4tlxrmr3iatlpDelivs s  rumirpnu4llt mfetls sDtrumont1tet  ietltfm2rl( o (0arerxf iydoaDr nesls0srtmir3io4olee ncil(fsrurxmp;u0apt mfcilsfmDua(vo;t4tltrifciytfat  n i ()tetmimpou1llte netlt  Dururp;t0optomociat s emump u4tleoxociadomD lnvsl(0trtoxmpio1omt mfvsl(farraxmoou1oleoif3iyt m eauvs u)aetoxr io1fm e nvs t0tetoxr3nu1lp emfcil() rraur ;o4oltomfeilt sDemnvo;u0 ltrmr iadfaDe uvo;t) exm(rpno1oltnlivsasfa2trur ;t4tetomfcildla ul(vont0arxnxo3oa1lpD  uvs (0teuoir iy1altemnvilsfsrtrxmo;t0aee mo3iadfs umuvo t4tltoxfctytfpD au i;t tetr(r ny1ll   ivta(  2um(mp;u0oexnifeildlaDel(vp u4tleomf oydlm  auei;s)s2xmimpou1ope lfcs t aDum(rp;u0apenii3iadlm ul( p;() exnxr tydfpD  nvs t trtrxm3iudolt mncsa(  2taxm nt0optnioeiltfs rau p u) rtnirciytoaDelivi t) eurio3iydam   fctl( srururpnu1olxomietlt s2ua(ms (0trtoifctodopt  ieo t teurir3no4oleelnvtl() Drrxmpoo4opxn ietat a umumsn(0 eeomr iydopD lnei;t srtoio3iy4llt  ivtas) 2rmu  no1alx iociydla2rm(vp;t4 eeomf iodfptranes s0srum(m ou4ale mfvi sf 2umx  ou1opx mietytla ea(mo t) rxrmr iodfaD ln s;t)srtr(r oy1lltnlfei t) Dur(moot4apt ii3ilsla ul( p t4aexrxo iadoateai i s)sruriopnodlleemfcs (faDrr(mo;o0tlto ocias a2ua(vpnt0alxnxo io1omt lu ols)trxoxrpio4amt mnvsl()arta(  no4opxn o3tltfaDumu o ()altoxf3ty1oa   nei s) 2uoimpnu4apenlnvslt  Drmx p;o4alxnifeiasfs ea(von(4tlenio3tytlmD  nvi;s0setr(r3no1ll nmnvtatfarrr( p;t0tleomoetyt a2ul( o;t4alenio3ia1omtranvi;t0texriopnydoptnlfviat)s2tau  ;o1oeeomieilslsDrm( p;t0aleoir iadfa eauvi s) 2umxr3no4amtn icslt srurxmont1oleo i3iyt s2eanvo;t4aetnxo iadfm elnvo;t)texoim3no4lm  lictlt srraxrpot0opxn i3tasfaDrmu p t)tltnio3iytfaDeau ol( t2uo(r nudoltn fes sfartruro;t1oex  icild s ulnms t) etnxo3tydom  lnei t0 ruo(r3no4openmnvt tf Drrxront4tlto feiadfm emn p u) lenmo todlmt lnvs;s0trtr(mpiu4omt  ict sfaDta(r oo1oltoifeiasfsDrm(vont) lenmociydfm rlneo s  rtoirpoy4opt mfvt s srrmxrpot4alxn oeildla umnms t4artnir tatlmDrauvo t) euoirpiu4ap elivta(fsrrmx  ;u1texo oeild s ua(monu)tetoxocoatlm e u sl(0texrxo nydlmenmicsas sDuax onu0tpe iieiyslaDemn p t)trtoxf tatomtrli o ()sexoxrpiy1omtnlfvtl( s2trxm ;o0tle iictyslm2rm(von(4texnxr3iodfm  lueils  rxm(o no4al  mfvt sfaDua(m nt0aexoio3iydfs2eaums t0artoxr3oo1fm  aies (0s2xr(o3ny4ome  nvt t aDraxmp;o1opxomi3tadlsDul(vo u)trerxf ia1om eanvs s) exrio ou1ol   ietat a2taum nt4tpe  o3iasfm2eln onu0tleoxf3iytlpteluvils)texoxm3oo4amte icilsf rtr(roou1tetomietyt a rmuvs;(4altnmociadoat  ieols s2xo(o3nodlmeemnct (  rtm(rpnt0tpe  feilsfa ra(vs t0 lxrmrcoy1laD lnvilt srxrxm3io1apte nct s)s2umxmpnt0aptomictlt s emnmp (0altnif3ty1faD  iei (0setm(m3no1op nmfeia( aDrm(r no1opt mo3tltlm2eau o;u4 etoxf oy1lp e ivi (0s2umxopiudape  neias  ruru onu4aeenmi3ils s2rl(ms t4 lxnmo iytfaDrlueilt)t2xo(m oydolt mfeiatfartax ont0aee  fciadfm2ranmo;(0artoxo3oydlpD lies;(0 2xo(r oo1ll   ieia() rur( pot1tlx  f3iadls2rl(vonu0 eermfctodlpDrai ilt0s2tmim no1lm elictl() 2rm( ono0tpxnioetyt aDrlums;u)aetoxoctydlmtrlivol()srtrxo3iudom emfvil()a2taxr ;t4tlxnmoetytfs um(msnu) rxrio3oadomtraneo;t trxoxrpiydapeeliciltfsrur(m ;o1alx mieiysfa rl(mo;t4trtoxf3iatlmt  ies ( trurir3iy4op elnei tf Dumu pot1olx moeiadlmDumums ()trermrctotopD anes t)srxm(m3ny1lpenlneta()a2taxmoot4alt mf3iatlsDem(vp;u0trxrirctatlp   u i;t0sexmxm3oy1ome  fviltfsDrrur nu1tpxomf3iat m2rlnmont0 ltnmocoatfp  aneilt) 2xr(r oy1ape mfcs sf Dtmur ;u4oeeoii3ilsfs2uaums (4 renio3todomDranesls)srum(m3oy4opt  net t s2urxrpoo0openif3tadfm2rmuvp;t)aeenmr totlm r i o;(0s2tm(o oy1lp nmiesas sDrm(r nt4tlx mociydfs2ua(ms;u0aleoio iy1fpD lu i;(0 2xoxm3nodll  mnetas sDtmxr ;t4alx mieiydfm emn on(4alxnifcia1lmt luvo () exoir ou4altnlneslsfaDta(m ;t0aexnmf3iatfaDumnvp u)altnmf3tatfa r uei;( s2xoir no1am nmicsa( sDtr(ro;t0teeoiieiasfaDemnvs;t0trerxf ty1fmtrln i;s seum(m iy4om emfcsat)aDumumpno0oex  iciad mDrmn o (0trxrio ta1fpteai s (0trum(r nudam  lnetlt) Drrxmo;o4texnio3iadla eaump u0arxnmo3ty1lmte u ils0s2xoio3nudome lnvt sfaDtr(  ot0tpxn o3iad m2uaumonu)alxrxfctydfpDraieo;t trtrio3iy1lp nlfeslt)a2umumooo4opx if3tydfm2rm( o;t4tlxnxo to1fpDran s;() 2xm(o3nu4lptnlfctl(  rumxm nu1opeo ictad m2eanvpnu0tlenif iy1lptranvi;t0trtr(r3iodamtemnci s)srtr( ono4oetnmfcildfs um(msnu4 renio iodomteauei ( s2xr(r3no1ap emfeiasfaDua(m ;t4opxnmfcilsfm2uau o;(0trxnio iotfptean s s  exrirpnu4ll n ncs (farrmx onu0tetomo3tadfa umn pnu0 rxnmfcoodfaDelu i t)tetmir3oudamt lfcta(  Durum ;u1opeo oetadlsDumuvp;u0 lxoir oytoa   n s;t srurxm3no4apte nci sfsDtru  ot4opeomoeils s2rmnvs;u0 eeoir oo1lpDe ivs (0srxo(opiu4al eliet t a2rm(moou1ole  fetyt m2rlnms;t0altnxf tydoatr uvi t srtmio iodoleelfvilsfsruaxr oo1oleniietytla eaumsnu)texomocto1fmtean sl(0s2tr(r3no1ole  nei (  Dtmum nt4ape mieiad sDelums;t)alenmocoatla   nvo t0s2xoxo3iydlptelfct tfaDrrx ono0tee ii3ilslm2um(ms;(4areomocoatlm ean s;()seto(mpio4ol  mieias arrm(mp;t0ole iictytlm uanvsnu)arerxo ia1oaDran sl()texoir3iy4ameelnviatfaDrm(mpnt4optniiciasfs2ulump;u4tltnmr3oa1oatean s s teto(r oudap n nvsl(f rrm(  ot1tpe  octatfs2ranms u0 leoxrcootlp e uei;t) 2xrxr3iydap nlfvilt arua(m ou4altn o3iytlmDemuvp ()trtnio3ta1lpDrlieilt)s2xm(r3oydlpenmietl( aDtr( p;o1tlt ii3ilslm rmnmsnu0tetrxf3iadfat  uvsl( srur(r io4oleemnvi s  rtau  ot0altoiieiatfaDul(ms;(4alenmr iotlp eau o;t0trtrim3nudol  liciasfaDumxr ;t4tle  ociaslmDul(mont4texnircoydfm raieslt0seuo(m oudlp elfeil( aDuaump;u0apxn o3iysfsDumu s u4texrmo oydlatr ivs;()t2uoirpiudoptn nctas) rtrx  nt1aexnmo3iyt sDua( s (0treoir3ta1lpD ln o s t2to(m3nudlp   ietas s2tr(m no1aleomfetytfs rmnmonu)altrircoatopDe iei;(0 etoxr3iydllenmivta() Dumxmo;o4oleomo3ias m uanvpn(4 etrxf3totomDrlieils0teuoim3oydamtn nesa(f Dra( oot1oleo feiadfs rl( s;t) lenmocoy1lmDeai i;t0 2toxmpno4ll e fci t s2urur oo4tpxo ictyt mDemnvo;u)altnmfctotoatrln s t0 2trio3oo1ap elfci (faDrrxrpnu4alenioeiydfa2ulnvpn(4 etoiocia1omt ln slt)seurxr3no4lle  ivtlt)sDum(  nu4tex mf3iaslaDul(vsnu) reoxocoo1fm rauei;t)texmio ou1lmt lnesa()aDuru oot4tltn icilsfs2umn pnt) lxnio3ootlateau ol(  etrxm3nu4am nmivsl(f Durxrp;u1texnioctydfm uau p (4 exomo iydfpt aneo s)srxrxo nudopt lictls srtaxro;t1teenmi3iydfm2eluvs t4 renmfcto1fm ran i ( trurirpoy4lpt mnci tfsDuaumoou1alt mo3tld s2emu p ()trxoxo3oo1oa raieils trxoxr3ny4om  mics s a2rrxro;u4aleoif3iatls2uln s;() exomrctydfp e ueo t  exrxr3iy4open fet (f rtrurooo0aeeomieiytlm ea( s ()tlxrxfcoa1lmD lueilt  etrir ou4lleelfvs sfs2trxrpnt0tltnmietytfm2emumo (4trtrxr3oa1lp rluei t)seur(r ny4olenlnes tfs2ua( oot0apto f3tadfs rl(vpnt) lxrirciodlm eln ols s2xo(r oudalt lics t sDuaumono1oexn feiat mDuaumo;t0 ltomf3ty1oatranei ( s2toirpoodlle  nciasf 2rmu o;o0tetomi3ias s2umnvs u0 eeoio oatlpt luvo;s s2uoim no1lm  mnesltfa2taxmpnu0tlx ifciydlsDranvsnu0teenio to1oaDr u ilt srxmirpnu1ole mictat aDrm(m ot0aee mfeildls umn p t4aetomf3tytomt anvo t0 2umxr ou1lm e fctls) rua(mpou1aptoioctlt aDrln p;t0altoiocoa1fa r ues;( s2trir no1amte fet (f Drr(m ;t1tlt mfetyt m2emums;t) rtrmf oy1oat ai s;s0truoxm3nudam emnet sfarumx pnu1tetoifcilsfsDrauvsnt)artoxf tytlat li ols0srxo(o iu1llenmietat  rrr(r ;o4tltomoetlt mDran o u0teerif3iatoaDraivolt)trxo(o iu4llt mnetl()aDrrumpot4oet  icils mDrl(ms () lxnmr tadfateai s (0 2tr(m3iu4ll  lneiasfaDumurpoo4alxnmfciytla2eau s;u0texnxr oydopt aivo s  2tmio3oo4ole livtlt)srtaur ;u4tpxnmieiad s2rmu sn(4aetoxr3ia1lm r nvi ( truoir iu1omtnmiet ( aDrr(  ;u4oltnio3tls a2em(mpn(4trxomo iatoptr neo s tetmxmpiydome lfet s)arrm(rpoo4oetn i3tatfm2uaumo t)teerxo oy1laDraueo;t) rxoxo3iu4ome  feia()aDra(m ;o1texo icilsfmDuln snu4arxnmr3oodopt lneil( trxmiopnudal e fvtasfa2ua( oot1tlxomfcils s uau onu)arxrxocoadfpD au s;t)trtmxr ou1altn fvtls)srrrurpot1aet moeias mDrauvp ()aeenxociodfmt  i ilt0 etoxr3io1ape  icsl(  Drmx p;u0tlt ifctls m2eanms u0trtrxo3totlaDr uvi s srtmiopny4am elfvi s)srtaxr no1oeenmoetld sDulums;t0 exrir3ia1fateliei s texoim3no4lp   nesa(fsDumur nt1opto oeiasfs2rauvo;u)trerircio1fm elnvsls) 2xrio oydlm e fvslsfaDtau onu4olen ociadlaDel( p;t0 etomfctadop  ln o;() 2xo(o iy4omteliet t) Dum( ono0aex ifcilt a ua(vo u0texnxo3oo1fa elnvs;t truoir3oudlpe lfcsa( sDtr(m no4apeniociysfs2ea(von()alerio3totlp eauvs () rxrxrpio4lmt mivt sfaDrrur no1tpenifcildfmDuln p u)tlxomr oatopD aneil() 2trxr oo4optn ieia() rtm(  nu1tpto fciat aDulumo t4artoxr todfp rlneil()trtoxm oudaptnmneilt)s2uaxmo;t4oet mfctlt m2rlu o t0arxoif3iatoa e uvi t) etoiopny1aptnlivi ()a2uru  no4tltoif3ilsfm2rlnvpn(4altnmo iy1fp   i ilt  2toxrpio1am n ivi sfsDtrx p;o1altomfciyt s2eanms;u0trxoir3oytoatrln ils)t2toio oudoptn fctl( a2ra( p;o0texn feils m2rmn snu4trxomoctadlaDeanvslt  exrxmpiu4ale lfeta(f 2ra(mpoo1tptomictlt m2raump;t0tlenmocoatlat luei;s) rxoxm no1lmeemnci ( sDraxm ;u1aptoioctyt sDumnms;u0tetomfciytlaD an sls0 rxo(m3oo4om  mnctls)arra(mo;o4tltnii3iat aDea(msn(0tetoif tytlp  lueils0t2trxm nudopeelietlt)sDrrx  ou1opt mfciys s rm( p t0treoir3iadlpD  ueo;s)texmiopoydop   iesls  rrau o;t4tlenmfcias sDuan s;u4arerxr3oytlmDr i i s0 2xmir3ou1omen nesls  2tmxm oo1aexn oeiydfaDrl(vpnu)trtrmr3tadlatrluvi s) 2umxopou1olee nvt s  Drmu p;t1tee moetas mDelnvonu)aeenmrcio1la e u o t t2tm(opou4lm   nviasfsDur( ont4tlxo fcild mDul(ms;()tlermo oa1lmD ai i;t)teur(m3oo1ole lfci s s2trxmp;t1tleomieiytfs2rm(vp;t0tetrxrcoa1lmt  n i s0s2xoxrpiudom nlfvta( aDrm(rono1opxomoeiaslm ea( p u0altnmrctadfpt  iei ()trtmxm oodopen iesa( a2ua(rono4teeo i3iysfm2umnmsnu4tltnxocoatfaDrln sl( truo(r nydopee fci (  Dra(mp;u0aeenmfeiyd s2eanvs;u4 exrmociy1fpt  nvs () rxmxopiu4op elivi (fsDtmx oot1aet  feiysla2ulnvo;()trenircoodomDrlivi;( trurxo iy1am  mnvi sfaDrm(r no1tpx  icild m eaums;(0arermrcta1fmDr ieil(0srur(o3oydal e nes (f rur(rpno1tlt mfeiyd mDuluvonu0 etoxo3oy1laD  i o;t)texrimpnodlp  liciltf 2umum nu1tlx iocilsls2raums;(0teerxocty1faDeanvi;s)s2urim3oydom nmnetlsf rtm( pou0opeoif3iys a rl(ms;(0tlenmr3iy1om  aivo;s0trxmxm oodapee fvta(fs2rru p;o0olxn oeiasls2eluvo;()tltrir3oadlpD an sls0s2xoiopny4optn fvias  rtm(m ;u0tpeo fetytls2rmnmo;u4aetoif oydfm eau o t teurir3no1lmtnliviatfarur(moot4tetn feiltlm2elu s;t4 ltnio totlat an i;s0sruriopiydlpenmnvi tf Dtrxr oo4aetnmf3iasla eau o;u4arenmr iodopDe ues (0 2tr(opoy1lptn ivslsf rrmum nt1tpeomoeiyt a2elnms;(4 rxomociy1lpt auvsls) rtmim3io4lltnlncilsf Dtrur ;u0opxo feiatfa2uluvp t)aeerxo iytfmte nvo t0t2umxo no4al nmici tfarua( o;u4tltoioctys s eanmp (4 rermo ty1omDrlieols srxr(o io1om  mnct ( arua(r oo1olxn i3iys m eanvs u0 renmf tydfmD an o;t0 exm(o no4ame lfciatfs2um(mono1olt if3ils aDumn s;t0texrircoo1omDelnvs;s  rumim3io1am e fvi sfs2umumpnu0aee mo3tydlsDrmnvont0 rxrmr3oatfpDeln i;t  2uo(r iy4oltn neiasfsrumurpoo4opxn o3iad s ul(mon()tlenmo iotfp  livils0trurxopou4amenmivtat  2uaumono1apxo f3tyslsDumnms;(0 lenxocoy1lat lieo ()s2to(opou4ole mfvi (fa2ua(  no1tpxn o3iadfs2ua(vpnt0artnmo3tytfate n o;(0 euo(o ou4lmenmnvi t) 2taum nu1tpx  ieiyd s2umn onu4 eeoxf3tytlmtrli s;()t2to(m3oodlmtnmncs t aDra(m oo4oeen o3iasfs2eln s t0 renmfcta1fmteaieo;( srxr(o nu1amtn ivtat sDurx o;t1oex  i3iad sDuauvsnu0arxrxfcoatfatrlnvi (  rtr(o3oo4optemfviat  rrm(  oo1tpt mf3iytfs2ul(mp;() etrmo3io1lp   n i;(0 etm(opoydol elncslt artmx oot4oltoioeiltfa rluvonu0 etnxrcty1fm r nei;()s2urir3iydapt mfvsltf Draxmonu1tle  oeiyd aDrlnmsnu)tlxnxr iatop elu i;s0t2xmxr3iy1llt lfvtat  Drrxro;u4opxn fetytfmDeanvpn(0 exrxf3to1op   ues;s0 rxmxrpnudlmenmfct ( a2tm(mo;o4altomocilsla2um(vs;(4aeeomo3todopDeli ol( tetmxmpno4op e fvtlt)a2uaumoot0optnii3iasla eaumo t)alerxr tytlmt liei t0trtm(o3oo1lm n nvsat s2tm(rpnt1altomo3iydlsDel(mp;(0trermr3tatfm rli ilt0trxoxr3oudopen fvsa(  Dta( pnt1tpeomoeiytlm2ulnvs u4aeeomociotomtrai s;()texrxo3oydlmte ies tfs2ta(mpnu0oleoif3iydlsDrmnvsn(4aleomo3oydop ran i;s srto(m iy4amte ics t)artm( oou0tpeoii3tadla rl(vonu0trerxfcoatlm eauvi ()s2trxmpio4omtn ivia( aDrmu o;u1tlxoii3iaslm2em( o;(0tlxomr3iy1latrai o t trurir3oudlpt  nvi ( aDum(r no1olto i3ilslsDua( ont4 etoir3ootlp r ueo t0 2toxm3iy4lpeelieiltfarta(ro;t0optomociltfsDrlu o u0altoxo3iadfmDrauvs;s0seurir ou1om  mnviltfaDrau ooo4apto o3iyt a2umuvo;u0texrmo oydla raivils texoxm3iy4optelnvia()s2umu ont4tptn ocildfaDeanms;u4tlxnir3iadlm elueo t) exrxo oy1apt lfvil(f rum(ro;u4teeo ieiydlm2rm( o t0trenio3to1fp  aueo t0 rtr(rpoudoptnlict (f rtau pou0tltoio3ildlaDrmumo t4alenxf ty1opDeaues s0trum(r3iy1lpeemnvtltf Drr(rpnt4tlxn f3tlt mDel(ms u0altrxf iydomDelnvi s)trxmio oudllen fcta( a2rmxm ;u0olxoii3iat a2rmnmsn()trenif3oy1laD aivil(0 rxo(o oydal nmfciat) Dtmx ono1apeoiicilt aDeanmonu0 lermr3ia1lmDe i s;s0t2umxo iy1ap e fvtat  rtm(rpot4optnmfciys s eauvp ()texnxo3ootfp e ivi (  2tm(rpiodalte fciat arrm(  oo0apxniocildfmDrm(vp;(4aeerif3iydoaD ln s (0 eurxr ny4lle lfct s sDrmxm nu0alt ifctas s2ea( o t) lxnxr oatomDeaues t)trtoxrpoydllte fet tf 2umu onu0tlxnmi3iltfa2eaumsnu0 lxrir tatfpD  nvs;t s2tr(o iy1opt  nctlt) Dtrxroot1apeo iciydlm2eaumonu4 eenmrcia1fptelu i;s0s2ur(r3iu1ope mnct s) rtrxmono1tex mociydfa2umumonu0trxrioctytfpDe i ol(  2xoirpoo1amtemieslsfs2rrurpot0oetoiieiytlm2emnvsnt4 exoir3todopD  uvol( srto(m3nu1lmenmfet s)arumx  ;t0tpe ioeiasla rlu s u)altrir ootfmDr ivilt trur(opio4ale lnesas  rtax oou0aetnif3tydfm eluvo t4teenir3oatfm  lnvi t0srurxm nydolt lfes t) rur( p;t1ale mieilt mDumu p () lenmocoatoateauvi;s)trxo(m oy1lme  fes (f Duaump;o4alxomo3ildls2em( pnt4 exoxf3io1la  luvo s)trumxr3oudal elncsa()srrmxm nu1opeo ieiysls elnvo u0tlenmrcootlaD lues t setoxr3oy1ol  lfcsl(fa2rmxr ;u0aetnmietyt mDuaums (4altrxr tytfmD auei;s0s2urxo ny1lpt licsl(  Dtaxmpno4oee io3tad m ranmo;t0tltnmfctotop elueol( texo(opoy4lm  livs t)srtrump;o0ale ifctad a umn pnt0alxoxr oy1fpD auvs t setmimpoo1ape mfcsat) 2raxm ou0oeeniieildfa ra(vo;u0aleomr3to1fpDeau s;t0s2xm(m oy1al nlfvs s srtaurpot0aexo ictls s2ulu o;u4trtomfciydfm  luvol(0sruoxm3nu4omtnlfcia(  2rmxront4teeo o3iltla eln p t4trtrxr iodlpDeli s t)seumimpiy1oltn icil( a2um(mpnu4oeen ieiydfmDem(vo (0tlenir iatomDe i sls sruoxrpoy4aleelnes () Dtmurp;o4aet io3tyt m ea(vs (0tetomf totlptrau olt)s2to(mpoy4omtelfvilt arrau p;t1tlxomi3iytfs2ua( onu4tlenmrcoo1fmDr ivs;t)srur(opio4ll nmivslsf rur(rpnu4tpenif3tltlaDrln p (0teeniociadlp eaues;t trumxo no4op   fvi sfarrrur ;o4oeeniieilt mDel(vo (0aeeoxocoytlp  livs;s0t2umxopiy4ole  fvi (fa2ra(mono0aeen ociltlmDum(monu4aeenmociodop  anvils)trurxo io1al n nei sf 2rm(m ;u0apenifeiytla2ulu pn() rtoif3ty1optelneo;() 2xoxr io1am e ivt (fs2rrumpot4apenmi3iytfmDuanms (0tltrifctotlmt  neo () rumxm3ou4ame mfctl(  rua(ronu0ope ii3tytlm2umnmo (4altnxr3iydfmtrau ols0srxo(mpiy1llee ivtas  2ua( o;t0aetomf3iyt a rlump;t0 ltomrctadfm rau slt0s2xoir3oo4apenmfesls) ruax  ot0olxo ictlsfa2uanmo;t)trenio todomDe u sls)seuo(o3iydlmee fcs (f rta(mpoo0oetn o3ilsla rm(vonu4artomfcta1fpt liei s s2xoxo nu1apenlicsls srra(ro;o1oet io3iyslm2rln p (0tlenxf3ty1fpDrai s;t)s2xoxmpiy4aptemnesas  rur(root4tpxnioeils m eanmo t)trtoxo3ta1lp  li sl(0sexo(mpny4ll e ivils)srtmx  ot4opxomoeiltfsDel( p;(4 lxrmrciotoa r n o t srtoirpiy4aptnmneilt aDumurpnu0tpt mfctytls emnmp;t0trxnmr3oy1lm ranvs (0seur(m oo1lm n ncils)arrmu p;o0aexomfcilslmDum(vs;t)aetrxfcoytlm  lnvo t)t2uoim ny4lltelfvil(fa2ur(rooo1tlt mf3tytfsDemnvpn()aexnifctydlate ieslt  rur(mpno1op nlfvias)a2tru  ;u1tetn feias aDea(vsnt) rtrxfcoydlmtr u s;t teuo(opiydom nlivsasfarurxmp;u0aeenifeiytla2em(vo u0aeerif3iytfmDrlieo;t)srxrxr3ou1opeelieil()aDumxro;o4olxn ieiytfaDrm(mo t4arxnmf oatlm  aneo;t)seur(opoo1op   ivt s sDtmuroou0oexo oeiydfs ea( on() lxnif3oo1fp e u olt) 2toir3nu1llenlivils  Dtaxmpnt0alx mociysfsDem(vs u)trerifctadfptr ueol(  rxmio3no1apte netlsf Drmu oot0aleomoctad a2ea( snu0 lxoxo tytomDr u o s)t2uoir3oydlptnmfvt t artaxm ot4oltnmocild aDem(mo;t)aleomrcoydlm r uvo s) rumxr iudolenmivtl( s2taurp;u4aptomo3ildfmDrmnvsnu0 rxnirciytlp e ivo;t t2urir3oy4omenlnvtl( s2um(mont4alxn f3ild s2uanmp;u) leniocty1fm   n s;( trtmio3ny1aptemictlt srrru  ou0aeeomfeiasla ul(vo (0alenmr iy1lm eli s s s2ur(r3iu1lm nlietltfarum(  ;u1tlxo oeilt s2umu on(4 rtnio3oa1la  liei ()trxr(r3iu1ol  miei ()arumx p;t0texniociat a ua( onu0 exoir ty1faD lnvo s)srtoim3nodlptemnci sfsrrr( pou4tlxomoctysfm2umnvo;u)arxomr3iydfm  luei () rxmimpiy1ap emfci t  rrr(mpoo4aet if3tldfaDem(ms t0aeenmr3io1fa r ieo s texo(opnodale  fei s)sDtmx  ot0texnif3ilsfs2elnvs;u0trtrmoctodop  aieo;t0 2tmio oydom e fesa(faruaumo;o0olxn ietys s2umu p;u0arxomfcia1lpD au o s  rxmxr iodomeemies s)a2trxrooo0ale  iciadfa2emums t4 renmociytlm   ies;t trtrxopiudolenlnvsl( aruaumo;u0aleoiietltls2rau pnt4aexrir3ty1lmt an olt0seuriopiydapenlncslt artm(rpoo1aet ii3tltlsDuln snu0tltoxrcoo1fm  li sls  2trxm3oy1alenmnvtls) rrau ono0oee  iciadls2eau pnt4artnmr3oo1late i o t0s2um(m iy4ame micsa()aDrau oou0apeo fciat a el(vo t0 rtrxfcoa1oaDeanei;s0srtmir3nudlpeemnvsat aDum( ont4open i3iydla eanvo u0 etnxf ty1lm rln s ( teur(r3iydlp   neils)aDrrx o;t1optnmoctytfm2rluvo (4arxnirctodop rlnvs t0srurxm3oy4alte iesasfsDuauro;t1oex  fetadlm uan on(4 renmociatlmDean o;t0 2xrirpno4ll   fvsa(fa2tax  ;o1tlen octat a eanvo t4 lxrif3iytlpDeauvi;s) rtmim3iu4lltnmnvs s)a2tmuront0tltn o3tatlm2el( p;t0areoifctytomDr ivo;( seuoir3iy4lmte ncia() Drr(m no4tex mociyslm2rm(ms;t0aetrmr ootomteaieilt0trumir3oy1lleelnvs ()aDua(  ot0tex iiciyd s um(vs;t)aexnioctodfaD auei;s) rtmxm3no4lmtelietatfarur(mo;o0oeen i3ildls2elump t4 ltrxocta1opte ieslt0 rum(o ou4omtnmnesl( sDurxrpot4aetomfciasla ranmp;() exoio todfm  an ols setmiopiu4am nlfcta( arrrxront1olxn octyd s2um( p;t4 etrxf iy1fp  aivsls  exo(opny4opt licilsfaDtru p;o4aeto ieilslsDelnmo (4 eeomo oodlmt livo t0seumxm iy1optnmnctlt) Dur(rp;u4tltnmiciat a um( pnt4tltnxf3tadfmDrauesl(0 rto(rpio4oltn neilt aDururo;u0tpx iociad m2ua( snu)treomr3iotopDrlnes t0s2toxo nydapeelncilt) 2ra(r ot0apxo iciydla umu o u4 etomf3iydfa rau ilt trumxo3nydlm n ncta( s2rm( p;o4altnifciydfsDeau on(0 eenmf iy1fmtelu o t  2to(rpiudolt mneiat a2taurooo4tlxnif3taslaDumnmsnt) rtoiocoa1opt  i s;s)setmio ou1ll n ncsltfa2um(m oo4aeeoifetadlsDrlnvsn() rerxrcootfpDr nes t0teumxo3iu1omeemfcs ()s2umxmp;t0oex miciytlsDea( pnu4texoir3ootfmDranvs;t0texmio3nudalt mfvs ()aDraxm oo4tlx iicilsfm um( s u0alerxr3tadlpDrlnvs s srxmxmpou4ol elfesa() Dta( o;o1opxomfciyd s rlnmsn(4artnmf3iadfaD livs;()trxrio3ny1omt mncsas arrm(monu4altomocilsls umums;(4treoxf iydfat anvs;t0srxrxo3io4omtemfei t)srururpot4oeeomiciydls umnvs;u4arxoirctodfmte ieols0texoxm3ou4omen fcs (fsDtrump;o0opxomfetytfa ra( pn(4alxoifcoadopte uei;() euoio oodal nlnvia()srumumo;o1tlxniieils aDea(vo (0trxnmfcty1lpD  ues;( t2xm(o nu4om   nvs (  rrmu  ;t4oeenif3iat m2umu o u0tlxoio3oadfa ean s;(  2xo(rpiudapenmieslsfaDtrxr ;t1alt  fetatfm2emnvpnt0 eenxo3oo1lmDraieo;t  2umimpoodoltemieia(fs2rru p;o4aexomf3ilsfm2elnvs (4 reomfciadfmt li o;()s2trio ou4om nmnet s)srtmxr oo0tetnii3iaslm el(vo;u4alerio tatoptelues s0 eum(m3no1lm  mnvtat srumu  nu0oleo ictld a2uln s (4aexrmf3tydfateanei (  2tr(o3oo4opee ieiatfsrua( oot1teen o3tasfm rmu s;(4 rxomr io1fmte ues t0 rumxm3nodlmen ivi ()artmx  ;o4opxnmfcias sDrlnvo;(0 rtnio tatfmD livi s0t2xoirpny4lpenmfeiat) Dta(  oo4aex ioctydlm2rln snu) lxnif ootlp eluvsls s2uriopou4opteliciasf Duauro;u4aexomociatfs ua(mp ()tlxrircoodoa eau o;s0sruoir iodal elncils  Dta(r oo0oex if3iytlm rluvsn(0arenifciadfa r uvs;s  etoir3oo1lltn ivslt) 2uaxrpot1olto fetadfm2umums;(0alermr oo1om  lu i;() 2tr(r3oydlpee nvta( a2rau ono1texo fetldlsDul(vsn(4 exoifctodoa   uei;s)trtoxr3no4alte iet s)aDtmxmpou1tleo o3taslm umuvp () renifcoodfp   ieo;s)t2umir3ny1ll  lfesat) 2uaxmpno4opxn ieilsls raump (4 lxrmrctatla elivi s texoirpnodllt  ics ()sDra(root1oeeo fciatfmDemuvs;(0 renif3oo1omDrln ols trumim3oy1ap n fes tfs2umum ;u0texomfetldls2ea(vo;u)treoxr3tatom eai ols0srtrio3ny4optemfvtat  rtru o;o0aptnmo3ild m ranvp;()arxnxr3io1lpDelieolt0setmiopno4lpeelncs ( s2tm( p;u1ole  oeiltlaDra(vo u0tlerio3iydfmt  nvi t0 2tm(o iudal   fetls)sDtmxr nt0tlxoifeildfm eanmo;(0tltrmo oytlmteaivs (0seum(o iu1ol n ieslt)srtmx p;o1tetniieiltla rln p;t) exrmr3oodfmtr uei t s2xo(o3oodope  fvt s) rtmump;t0tpxoio3iltfa2rlnvsn() lxrmo iodlpt lu s t texrxrpoy1op  lfctls) 2tmx pot1aexnii3iys m eanms u) rxnif3oadfm  li s t t2xm(r io4lmtemnetls a2urumpnu0tpt mo3iysfm2uln pnu0tltrio todop  ai o t0seuoim3nu4ale  fci (faDtax o;t1ope ioetyd s2rmuvo u4arerir3oatfatrlivs;t srtoxopiu1ol  lnvt (fsrra(mpoo0tltoio3iytfa ua(vp;t4 reoir3oy1fpD au o t)teur(o ny4ap e ivtat)arurx  ou0altomfetys a emnvp;u4altnmf3ootom  anvslt srum(r ou1lmeemnet sfarraxmo;o4tpenmoeiytls2el(vs u4arermo3iodopt  ues ( sexmxm no1altnmneia()sDrrxm nt1tlen f3ildlaDem( o t0 leoxr3iadlp e i s;( trxr(mpiudal   fcs tfa2rm( p;o0teeoif3iat aDel(mo u)alxomo oo1fptr nei;t) rtrxr iy1lmtnliesl(fsrtrurp;o4tex ifciyt m2elnms t4 rxnmr oydop eaueo;s) 2trio3no1ope mfvsa( s2uaxro;t0tlenmictytfaDrluvs t) lxrif iotfmte nvols0trtriopoudamt  neia(fa2um(mpoo4alt  f3iydfm2ea( s;()aetnxf3ia1laDrli s t0setoxm3io4ale lnes ()sDum(mpnu1tpt iiciltla eauvs t0teeomr3ia1oaD  i sls trxr(r iydlm nmfes s  2tmur ;t4aexomo3iasfsDel(msn(0 etoif iadlpDr u olt0srxrio iy1amtelnei (f 2tmum ou0tex mocias m rluvs;()alxnmo3oodfmt  i il()t2xr(o3nudllee ivs s)sDra(moot0alxoiieiltls2ea( p;u0tetomo tydfmt li ol(  exr(rpoo1lpenmfcsasf 2tax  ot1olt mocias m ra( o;u0 lermf3oo1fpt  ueil() 2ur(r iy1olee ivi s) 2tmxrp;u1tpx  oetyt sDeln o (0artrmf3iytoptean ilt) 2trxr iu1ameelfct t  Duaxr ;o1olen fciad m ean p;u4trermfciy1fatr ivi;s)srurio3nudap nlieiat) Duax  nt4olto i3iadfmDra(mp (0areoir3iodoptrluvi ( t2xm(rpnodol  mfvil()s2rrx pno4oleoii3tys m uln s;()treomocia1lpDeaieil() 2trio iu1openlfetltfa2ra(mo;u0apxn fetlslm2rau pnt)teenifcio1lpteln i;s0setoxmpou4omeelnct t)srtr( pnt1alt  icilsfsDeanvsnu)tlenioctatfat  ivols t2xo(m3oo4ol  lici t a2rr(ro;t4olxo oetls s rmnms t) rxrxo3ia1lp eaivi;s0seurir oy4lp nmfes t  rumxr ;u0tlxoifeiad mDel(mont) exnmfciodoatrauvo;s0 2xoxo3oodapen fct t  rurumpot1aptn o3ild m emnms u0trermr oatomt au o;t0 rtmimpnu4al nmnvs ()s2tmxm nu0tex ioeilt sDea( o ()tlenxfciatfa eau s;(  etmim oy1ll emfvslt)s2rm( ono4apt miciatla rluvp u) eenmr3totlaDr uvi s)teuoim oudapenmfesat) Dra(r ;u1tleo i3tatfs2rmnmsnt) rtoxrctatop r nvi;s0t2xoxopoodope livta() Drmu  ot0tpxoioetaslaDeanvsn(0trxomf oodfpDraivsls srxm(r3nu4ap e fes (fsrtmumono1oexomocilsfm eln snu4 ltrxfcio1fmD  nvolt0 eurio iy1ol nmfvtlsfa2tr(  oo1oee iiciyslmDeanvsnt0tlenif3tytlpD  ieilt0trurxo3oy4lptnmivil(fs2ta(m oo4oexn i3ilt mDrlu pn(0aleomfctydoa  lneo;s0 exr(o3iu4al elfcia() Dta(mpno1teen fcildlmDem(vsnu0trenmf3iadopD anvols)srtmio3oodopte nctat sDraumpot4aptomfcild s2uan snu4texrxo tatop  an slt)srxm(opnudom e fctasfsruaur no4aetn i3iyd sDrm(ms t)tltnmo oadlpDe ivo;s s2xmim nu1ope lfcsls s2uauroot4tleoii3ild a umumo u0aetoxr oodomD  n ils seumxo nydamte iet (fsDtmumont0aexoii3ild m eln o t) eeriocoa1optelueo t)sexo(m oy4lmenlictlt)a2ua(monu1olt io3iydfmDel( p;u)tltnmo3iotoptr ueo (0seumxm iodlpe mnetlsfsDurx  ;t0aex iocildls eaump;u) leoxfcoydlmt ai s;s)s2ur(m ou4ape mict t  Dtrxrp;u1apxo o3iat a rmnmsn() rtrif3totoatr n olt0srxr(m oo4altelnei () 2trum ;o4tltoif3tasfm el( o u0aexoxocoytoaDe ieol(0tetr(r3oy4ol nlfvt t  Dua(root0aet iociadla uauvp;u)tlxoir3ia1fpDraivo;s0srxoio oo4al  mnetat)s2raum nt0olx ioetad a2uan s;(0 lxnxrctotlat au ol(0sruoio3oy4lmte fctlt) 2urxro;t1tex moeilt a2elumo () ltrxr iytlp   i i ()srxoxrpoydalt miciasf 2umu  ;t4alen f3tltfs2emnmon(4tltoircoa1fp r nvi s0 rxoxr iy4ome  neiat)sDtm(r ;t1ope moeiyt a2rlumo;t0 leomo iadoaDeaivo s) rtm(r ou4lpeemicslsfaDumu  ;o1opto fciaslm2eau s;u)trxrif3oo1fatraivs;t)t2to(o iodll e ivtlt s2trxrpno1aee miciadlaDel(mpnt4 reoxr3oatlmD  ueo;t0s2tmiopiy1omte fcsas)aDuaur nu4aex mfeiadfs ran pn(0teenxf3oadlmDeluvs s0 2uoiopoodlle lnei t)a2tmx pou1alxnif3ilslm2ulnvp;u0areomfctotfpt lies (0trxmim no4lmeelncsls sDrr(  ;t4optomo3tat a2ul(vsn(4altnmo ia1latr nei;s trxr(o3ny4lptnmfctl(fsrur(ro;o0alenmfeiytlmDeau pn(4 ltnmr iatfat lneilt srum(m3ou4lm nlnvi t)sDtrur ;u0tptnmfeiasfm rmuvp t4arerir3iy1fat  ivs;s0 2ur(mpoodaltnlnesa( srtrxmoou1apx mfeildfm2ua(msn(0arenif ootlmtr i s;( seumxo oydlmt lnci sfs2um( o;t0olxo f3tad mDeanvsn(4 ltrmr oa1oaDr u il()t2tm(rpoydllenlfvtlt)sDumx oou1aeenmictysfsDrm(mo ()tleomr3io1lptranvsls)t2tm(rpnu4ameemnvsl(f Drm(rpou4ope miciatfm elu p;u)tltrxocoodomtrau s;s0 euoiopoy4ap  licsls aDrmxr ;u1ape ii3iad aDuanmp;(4 ltrmf ta1oaDeanvi s0trtrim iy1ameemnvsl()s2uaumoou0alxomoeiaslm rl(vsnt4tleoxf3ta1opD au olt)srurxr3nudllte icilt a2ur( p;o4tptoifetasfs rau pnu0alxoxf tydomDranvils seuoim oudape  fvia(f Drax o;u0tlxnmo3iysfmDemnmsn(4arxrxo3oadlat aueol( s2xmirpiodalenmiesasfarrmum ot0tpt mi3iadla2umnms t0 ltoircto1lat  i s (0s2to(m oo4om emnes sfa2rruroou0alxo i3ildfm2ulumonu) eeoiocoy1fa  ln i t  eumir3io4lltelneias artrumpno1altomo3iydlmDum( p (0trerxfctytomDeluvi;t) etmio io1ameelieslsfaDumu  no4alt mociad s2umnvp u0arxrmrciytfat lu ils  eumxrpno4lp n nvtlsfs2taurpnu4oexn oetatls umnvp;u4tltoif3io1opteaieolt0teum(r3io4optn ies t arua(mpou4olxnif3iatfa uau sn(0texnmo3oadfm   n o s seto(o3iu4lleelfvt tf 2trxm ot1aptnio3ils m uauvp t4artoxoctatfp  ln o;t  rtoirpoo1apenlfes (f Dtau  oo0aee  f3tytls2umu p u)alenmr oo1lmD li i t)setoxmpiu1al e ivsas) 2tm(mono0teeo fctatfa ra(vonu4aexnif oy1fa eln o s)t2toir iy1ap nmfcslt sDuau pnu1opeoio3tas sDemn s u0tetnxr3oadoptraivil()s2xrir io1altnmivtl(f rum(m ;t4tlxniociatlm ranmpn(4 lxnxocty1om e u s;t0 2umxopnudlp emfetatfa2rm(r ;t1alx  i3tydfs2em(vs;u)tetnmrcoa1omDr ivi (0srxmim3oo4llte neta(f Durx pot0olto fctlslmDulumpnt4 leoxr iytoptrlnvi t  2trxo3nu1aptn ivi t aDum(rpno1ope mf3ta
\ No newline at end of file
@@ -0,0 +1 @@
+u s (0seuoim3oodap  lnes s s2tru p;o4oeenmi3tydfm2eaums;u4aeeomf3iatopDraivo (0 eur(o3iodlm emneilt s2rru  ;u1tpx ifeias m ulnms (4aexnmf iodlpt ai ilt) 2xoxmpny1oltelfci (  rur(r nt0tptn fciytla2uanmpnu)tltoif3oodopte u sls)s2umim3ou4altelfct (  rururonu1tpeo ictatls2ul(vsnt4alenmr oodlpDeauvo;( s2tmimpou1lptn feilt)sDta(mpou1tleo iciltfa ra(msnu) exrxo3todfmteanei;t) etoxm iydll e fetlsf 2rm( ooo4teeoiietldlmDul(vo t4tetrmo3totfat anvo t trumio iudalt  ivs t) rrmur ;o4tpt  o3tlt s2rmuvpn()aexrifcoatlpDeln i;t) 2umxrpiydolte fetltfaruaxm oo1apx  oeilsla2rl(vpnu4tlxnir to1fa   u o;t0s2toio3nu1omt lfvi tfsrurxmono0tlxnifeias s2ra(ms t) lenir3iytoptr u ol( t2uoxo3io4ale lfvi s)aDurxm nt4oet  fciyt aDran sn()aeenxo iydlm   u i s0sexoimpiy4am e nctas sDuaxr no0aet ioeils m ua(vs u0 lxnif iytlpDran i t0t2toim3oy1ll nmfvtas) Drrxrpot0tpto ocias m2rau o;() lxnmrcia1oatr uvs;t seto(m3oodllee fcs t)srta(m ;u1alx mf3tasla2rm( o u0tltrir oatfmDrai il(0 exm(mpiu4ope mnetlt  2taxrpno4tpe  icildfm2emumpnu)aexrmrcoadlpDraueo (  rxoxo ou4op nlnetls)srrm(mo;t0tptnmfciyd mDumu p;(0 rtnmf iotfp rlivs;t) rtmio3iu1op elfcils  2uaurp;u1tet  f3iyt a ean o t0aeeomoctodfm r uei;() eumxrpiy1lltnmnei t  rrr( pot4aeen fetyt sDrauvsnt0artrif3iatom eau ils s2toim oy4lp  lfvil() Drr( ono4openii3tyslaDrl(vp;(0 renxr3todom   u i;()seurxo oodlp elfeslsfsrtauroot1oltoiieias sDrln o u0altoxr3oadlmt lu o s)trur(m3ny1lmeelieiat)srrr(m ;o4ope iociad sDulu on(0texoxf io1lmDe ieslt seumir iodol n ivs s) ruaxmono4oeeniieilt aDua(monu)aeeomr3to1fpt lieo t srtmimpiudape lncs sfaDum( ooo4aexomo3tydfaDuaums u0arerio tatlm r n i t0 etm(o3nu1ol  mfcsa(f Dtrur ;o4tpeomoeildlm2em(vs;() rtrircoytlaDe nvilt0srxoir oy1lm n ies t) rumxrpnt0aexoio3tltfm rlump (4altomf3tytoaDr i s s t2tmiopiu1lme  nvtlt)a2tmxr ;u0oex  i3iatfs2eau p u4texoxr oodlat luvs;( seumim3ou4aleelfei s  2trxrpnu0aeenifeilsfs2ean p;u)tlxnxo oytfp elneo (0t2xmim3nu4apte ivtasf 2tm(rooo1tpeo i3iydls2uanvs (4areoxo3oa1lm r i i s0srxo(rpno1aptnmnvtlt) Duaxmoot1aex  ieiytfm ua(mpnu)aexoifcootfa   i sls0teum(rpou1amtn ncsa()aDuaur nt0olto ieiys sDrl( s;u0 rtnxf3oy1fm   ueo t texrimpny1amtnmfciat s2rm(ront1tlx miciys sDul(monu0treomf3oo1fmtelu sl(  2xr(opnydlm nliesat sDtm( p;u4oex moeiaslm el(mp u)aeerif ty1lpD  iei s)trtmim oy4lleemfcia(fs2ua( pot0tltomf3tls mDemump;u0treoif3oodoaDr neo t0truoxo nudlpeemnetl()aDumxmpot4tlto fetld a2umu o;t4artoir3ootfpt  ueil(  exoimpoo1lm  mivsa(  rta(rpoo1ape ioeils m eaumpnu) etoio ty1lm  anvo t)setoir ny4ap emieil() 2uau oot1tpenioeiysla2ul(von(4aleoxociatfm r uei;t0trurxo3iodlptemneilt  2tm(m nu0aet if3iat a uluvpnt0arxnif3iatlm   nvs (0 2xoim no4optnlnct s) Dtmu  oo1oetomi3iytfa ua(vont4teenif3iydlaDeau s;(0teuo(opio1ll nlfcilsf Drrx  no1tet iietydla2um(mo ()trenirciotlaDe ues;(0teum(o iy1apt  netl() Dua( ont1olxomoeils m eauvo u) rtnir3ty1la eaivi t) euoio iudlp  mfcia()aDuru oot1olxo ocilsfs2rl(vp;u4trtoif3oa1lp rlieo t0tetrxo3io4ol  mivt ()s2ua(mont1alx mfeiasfs2elnms () ltnifcto1fa rlivs;s srumio3oo4ol nlnct tfartaumpot1ope micias s ra( snt0trtomo3oadlaDeaies s0trtrxr3oudll e nctltfsDta(  ;t0tpt ii3ild sDuanvon()aleomf3iotfaDeli s s0sexrir no4op nmfvs (  rrr(  ;t0tetnif3iltfa uan p;t0 eermf3iatlm rauei;t)seuo(r nodal   ieils)sDtr(rp;t1aee  iciyd sDrm(mo u4 rxnmf ootlmtraues;s0trxmxrpno4ol n ncias srur( o;u0tle  o3iysfm ua( s;(0 exrir3ty1lat auei;s trxm(r3io1al  lnvta(fsrtm(mp;t4oleoii3ils s el(mo ()altnmf3oydfpD lnvslt0srtmxmpou1lmt  ictat)srumurpot0tlt  fctatfa ul(mon()altoif oatlat livolt srxmxo oydlle  nvi t)srtrur no4altniiciltlaDrm( pn(0 exrmf3iadlpD au il(  etr(m3oy1oleemncsa()sDrm( ono4tpen ociad sDrl( s u0trtrxfciy1lmteaivs t0srumir3ny1ol emfci s) 2rru pnt1aeeo fcias m eanmp (4aetnir iytlm ran ol( tetm(o no4olte nciltfarra(  ;t4apxo i3iatla rmuvo;() ltrxocoadfpDelu i;( sexm(opoo4amtemfcsls)sDtrxrpou0tptnmocild s2em( o u0alerxf totoaDe ivol()seuoir io4altnmnvsat) 2tru  ;u0opto ociyd a2ran o;u0 rtnxr3tydlp e ues;t0 eum(rpoy4omenmieslsf 2ra(monu4opx  f3iadlsDum(mo t4 rxnif oatfa  lues;(0truo(r iy4lmtnlietlt aDum(rpnu1tpxoioetatfm2el(vpnu0tltniocty1opD  n i;( s2uoxrpnodole licil()s2umx  nu1aetniociasfsDelnvo t0texrifctadlpDrlnvil(0 eurio3nu1om emfeia( s2umx p;u0tpt  o3iltfaDea(vs;t0tlenxr3tydom  aivilt s2xo(opiy4amtelnet () rrrur ;t4opt if3iltfsDrmu p;(4 renmfctotfpDr uvs;s0 etmxo3iydlmeemnvsls  rta(moot0oltoio3tytlm elnmp;() rxoio ta1optrlneslt)trxr(opnydamtnlfvi t)a2uaxrpnt0aptniietyt mDumump (0tetrioctytop r uvo s  2xm(o3nu1lp n feta()a2trumo;o1tlxoif3iysfaDrm(vp u4 etnmo3iadlptrai s ()texrim nydole livt (fsDta(m ou4alxomi3iasfs2rlnvp;u0trerxr tatlaDe n i;(0 rxrir oy1llenlfvs s)s2um(rono0opt iicild mDrlump (0teerxociydfaDe uvsl( t2trxm nu1omenlies sf 2rmurpoo1tltnmoeils a ua(vpnu)treoioctadfp eluei;t trtoiopnu4aptnlncs t a2tr(r nu0ole iictyt a2ranmp;(4tltoxr to1fpt ai s t teuoxo3oo4llt mivt s)aDrauro;t0oexomo3iysfa2rauvs;() leoxo iotopD lnesl(0t2to(o3io4llenlnvtlt)s2umxr ;u1tpxomf3ilt s2el( p;u4texnxf3ty1fmDrlnvs s0sruoimpiodalt mnvias s2rm(ro;t0aeto f3iltfm rm( pnu0trxnir oadoa eaies ( teumimpoy4lm elfvilt) Dra(  oo1opt mf3ilt m ranms;(0texnmo io1fpt  neo t)tetmio iu4lm  mfvslt)s2umum nt1tpxn o3iytfs2ulumsnt) etnmfcoydomt lnei;t0trumxo3oo1lpenlfet ()a2uaxmoot1ape  feilslm elnvs t4tetrxrcoadfa r ueolt0t2uo(r3oy4op   ieiltfartaumoot4oet ii3iyd sDrl( snu4aetoif oadlm e ieilt  etmxr3nodapen ivsl(f Drmurpoo4apx mociytla2ra( pn(4 ltoxrciy1lp  aues (0s2trio3iu4ameelicilsfaDumxmpoo0apenmfctytfs2em( p ()texnif
\ No newline at end of file
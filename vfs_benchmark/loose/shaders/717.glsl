@@ -0,0 +1 @@
+ieo ()s2uoir3nudoltelfcils) rtrxr nu0ape iicias a rlnms;(4 etomocoatoa rli o;t) eto(rpno1op nlncs sfs2rr(mont1apenmietydla emums t0 etnirciodlpDrln s;t0srur(opnydomenlict t srurxmpoo1aptomfctad s2emumsnu4 rxrmo3oy1laD  ieo;(  2toxopiy4olte neta(f 2umx onu4olx if3tldlaDemn o;u0tltrmrciytla  ln i ( trxrim nudame lict s)s2ur(r nt0aptn fctasls ul(vo;t4alermo3iy1lm rlivs s)srumio no4lme  fcsl() 2rr( p;u1aeeomfeiytfm uanvs;u)tlxrmo ty1la  livs s  ruoiopoo4omt mfei sfs2ua(m ;u1altomfeiasls umumpnt)aetrio3oydlaD li o;s)trxoir3oy1aleelietl()sDtau o;t0alxnmfetadlaDranmsnt4aetnxr iotoaD aneo;s trtr(rpoo4lmenmicsa()sDtrxmont0tpeo i3tat m ean s t4tetrmr iatlp   ieo t)tetm(r3oo1lmeemnet sfa2rru p;t0apt ii3iydls rauvs;(4 exoxr3oydopDelnvi t0srtmxopiu1lp  lnet t a2urxmpou0aexnmoctldfm2uanmo;u4aexrxr iytoptrlu o;t trxoimpnu1altnmfvtat)s2ta(r ;o4apto ociyslm2ra(vo;u0 eenxf3tatlpD  n i;( tetoim3ny1ol elfci () rtmuront4aeeomiciaslmDrmu pnt4 lxrio tytom   uvil()truoxmpnu1amt lneta(f 2uaumonu0aptnmi3iat sDul(vs;u4 rtoxf3iatla elnvilt0 eurio ou1lmtn ivias)srur(mp;t4oetoiictydlm2rlnvp;() rxnxf oy1la rai ilt) rto(r3nudal  lict (fsDuaurooo4tpeo oetlsfsDeanvs;(0areomfciadoptranvo;s seumirpnu4al emiciasfartm(rono0aptoifciat a2eluvs;u0aetrxo todfmDrlies;s) 2xrxr no4omenmnvslt  Drmx pnt0apeo fctltla emump u) eenmrcoytfptraivols setmio3oy1amtelncs (f rraum nu0tltoiietldfa umnmsnt0 eenxr iatom rlueo t0s2xmxmpio4alen nvi (  Draurp;o1oee  ietydla2em(vo (0tetnxo ia1lp r ivi;(0trtm(rpnydamen icsl()arumu p;u0tpe moeildfa2ul(ms;t0artoif iadfatrlu o (0truoio iu1lme lnesa(fa2tmurono0oltn oeiyd a um(msnt4 eeoioctydlp  lu o t  2xoio io1apte ieils arur(r ;t0tpxnmi3iytlsDuluvpnt0arerif ootlaD ai o;s0 rtoxm3nu4amtn fcs s arrmu  nu0optn f3iyt sDrmnmo;t) eermo3iytomDeauvo;() rto(m oo4ap elnet tfa2urxmono1tle  f3taslaDum(vp t4tlxoxo oodoate uvi;t t2tmxo nudolt mfctls s2trxmont1tptomo3tasfs2ea(vpnu0tlenif3ta1late ueols) eur(o oudam emivsasfaDuaumooo4alxnmo3iat a emu p t)aetnxr iytomDe n s;s0trxrxrpnydlltnliei (fs2raumont4tetniieiydfa2rm(ms u)arxoxrcoadfmDraues;t)tetmiopnudal  mnci t)srum(  ;o4tltomoeiadlm2ea(monu) lenxoctadla   n s t)t2um(o iudlle mnvt t artrum ou4teeo ieiys mDel(mp (4 exrmo oatopteaneo;t0t2tm(m iu4lp e ivt t) 2ta(mpou0tle mi3iydlmDra( on(4 lenir io1fatelieils0teuoiopio1oltelfvi s artau  no0aexomf3tadla2ua(vpn()trenxociydlp  anvsl(0texoir3ou1omeelies (f Durxrp;o0ape ioctas m2em(msn(4trermo3to1lpt anvo;t  2tmio iy1ol  mnctat)sDumuro;o4tlxo icilsfa eluvs t0alermo3iodfp raueols) etoio iodlmtelivs (  Drr(rpot1ape iiciasfa rlu s;u0 exnio tytfpDraivols) euo(o3nu1lmee feslsfa2rrxmont0oeeoii3tadfsDuauvo;u)aeeniocoydlpDe uvil(0truoxm oy4oltnmfvsa(f Dra(m ;o1apenmfctlt m2rmnvo t0 reomrciydfmt luei;t0s2xoir3nodlpeemivslt  Dtm(moou1opt ifctadfmDrauvp;u0tlxnxrctatfa e nesls0tetoio3io1op   fei t)sDua(  nt1aptomf3iadls ulnvsnt4 ltnir iotop eaieo t)trxoio nu1amtelicil()aruaxm nt1opx  oeildfsDeauvs t)tetnxrctotlmDelnvo;() etoim ou4ap nlici s s2um(r ot1teenmo3tldfa rm(vsnt0 lerifcto1lm e ueslt t2xrxm oydomtn iei (f Dum(m ot0oeeoiictytlm2elnmsnu0 renif tytlat auvols  2tm(opnudop nlict sfa2umum no1ale moeias s emumo;t0 rxrmr3oodoa e ivs t0t2xoir3ou4alenmfesatfarta( ont4opxnif3iaslsDuln s t4 lxrxf iodla raueol(0t2to(m3oo1am e fct t sDurum ;t4alx if3iydfm2ranmp;t4tlermf oy1fa  aiesl(0trumxo ou1ale  fes ( a2ra( pnt0oetnmiciltlm umnmo;u)treoio3iytfpDrlivils s2xr(o3ny1amt mneia( a2tau  ot4apenmocils a2emu o;()trtomo iytfpD auvolt s2tmxo iy1altelfvsatfsrum( pno4aee ifciasla eau s;u0arxnmrctatfmDeaivi (0s2xrxr oy4am elneil(fsDrrumooo1optoifeild sDemuvp ()arermr ta1lp eln olt  eurxo3oy4op  mneiatfsDrmx ooo1tpe ii3iydla ul(mpnu0arenxf3oy1omD livo (  rxm(o iy1om emicilt)srrm(r ou4tpxomo3tysfm el( sn(0 eeoif iatfpD ai ilt0s2tr(m3iudomen fvtat) Dtm(monu0alx  ieiat s2um( on(0trxrxr iodopDr neol(0 rurxr3oo1lm n fvils)s2tm(mpoo0tlenmfctatfm eau p;u)tlermo ta1latrau ol()sruoxo3nu4op e fvt (fa2urxm no4opeoifctlt m2emnvp t)aeeomfctydomt livo ()teumxopno1om emietasfaDtaxmo;o4tpeo feiydls umn snu4trenmo3ootfa  anes;t0 2to(m3iy4lpe  nvils aDraumoot4ape  feiysfa2em( ont)artnmocootlaD ln s;s)tetr(opnu4aleemics (f rrm(mont1teenifcilsfs uanmpn(4 ltnir tydopD  uei;s0t2urxopio1lmtnmfvil(fsDra( pot1tpenmoeiatfm2eauvpn(0tlenir ty1oaDe neolt0trxrio3oydolen fetas)a2tmur no1aetomo3tad aDra(ms u0altrmf3to1fmD aueils0tetoxopno4am nmneias  rrmxm ot4tetnmi3tysfm2rm(vp;u0altrif to1opte ivil(0t2xoir3iy1lpenlivslsfsDrr(  oo0apenii3tyd sDrmuvonu) rtnxfciadlmteaueo;s) 2xm(r no4alt mnctls) ruru pot0apxomoeiyslaDrl(mo;t0altnxf3oa1omteau s;(0 exmir3iu1optn ivia( aDuax o;t1tptomicilslaDulumo t)tleomf oodfat aneol()s2um(o oo4amenlfcsa(fsDrmur oo1apt iicilt m2el(vsn(0 renxo3oadfpDe ueils0trumim oo4apt mivta( sDur(mpou4tetnif3tasla2umnvon()tlxomoctadop e neo;s  rto(r nu1om emfcta(f Dtmu  ;t1oee moeiatlmDul( o u0aetrxo3tadlpDe ivi s  rumio3iy4lpte iciat)a2tmur ;t4tpe  f3tys a uln p;()trxomocoa1om   u o;s srtoxrpoy4al   ivi s  Dtmumoot0olx  f3ilt s2rmumo;(0alxnir iadop ran i;()t2umio3iu1am  mfetas a2rrxroot0opxoif3tys m ea( s;u0arxnif3oo1fa e nei;t0s2um(mpiodll  lnvia()sDrm( p;t0oetomieiydlaDrl(vpnt0tlxnxrctydlate uvi;t0texrio nudolenlnciat) rtmuroot4tltomoetld a2umu ont)areoio3ty1lmD ln i;( trtrio oy1ap   fes s srumx p;o4aexnif3ils a rlumo;t4aetoircto1opD aivs;(  eumir3ny4opt  nct sfsDtaum nt4oetnmietytfs2umnvp u0arxnif oydop r neols0 exr(o3iydlleemicil(f 2tru oot4aex  f3ilsla uaumo t) exnmrcto1fp eaueilt  eurio3ou1op   feiltfs2tr(r ot0oee mietld m ul(mo t0altnmfciydop e u olt  rtrio3iodopt  fvslsf 2umxmp;u0altnii3iatla em(vp u4texomociy1oateai sl()t2toxopno4omtn nvtas)a2ua(r ot0olx  octlt s um( o;u0 leoxoctatfaDeanvs t)srurir3oodlpe lfvtlsf 2tm(mp;t4apt mfctlt a emnvsnt4 rtrif3tadlp elnvs;t  2toxmpoodopeelfeslt)aDur( pnu1tle  f3tat mDumums;u0trxnmoctodlat aivi t)sruo(r3oydaltnlfcias arurxroou1aptnmi3iyd m2rau p;(0aetnxr iytfp  lu i t)trxrxm3oo4ap nmnesltfaDrrxront4aetn feiydla rln s;(4aetrmf oatlp eauvo s0trtoim3ou4ole liesas)s2uaxm no0oet ii3tysla2raumo;t4trtrxr3to1fp   neo;s0 rxoiopnodlmt mivtlsfsDuaxm nu1apeo oetad m2emn s u4 ltrmr oy1fptraivo;s srtoio3nydal   fciatfa2tru p;o0tle mo3tat mDum(vpnu0texnxr3iytlp rlues;s0t2ur(m3io4lptnlncsatfa2umx  nu1openmf3tltfm2ua( o t0aeerircia1lpDe i s (0setm(o oo4apte fvsatf rtrurp;o4tpxoifeiad m2ulnmo;t4tetomfciadlpDranes s0s2trxrpoy4lp n fctat)sDtmx poo4tle  octat a2el(vo;u)texomf oydlptrlnvi t s2xrio nu1aptn fvsas  2umurpou4aet  o3iytfsDran on()trermr io1lp  lnei s) eurir ou1aptemnci t  2raxrp;t0tetnii3iadfa rln pn(4trermfcty1lpte ieslt teuoxopny1altelnciat srum(m nt4oleoiictydfm2rl( s u)altrircoa1fpDeaies t)s2tmxm3iu4al e fcsl( sDrrxmoot1opto feiatfa em(vs t4aeenxr oytoaD  ieilt  ruoio oudlmeelfvtlt s2rau oot4olto ieiys s em(vsnu)aetoxo3iy1fp  livols texmim no1llteliet sfsrtaxr ;o1oexnmi3tydfs rmuvo u0alenio iy1om ranvs (0 eurio3nydapee nvsltfsDumur oo4alxnioeias s eaumsn()tetoxf3tadom elies;s)tetoxrpoy4al emnci t  2rm(mo;o0tpe  fciltls2ulnvonu0tlenio iodom eliesl( trum(opiy4om nmies t aDumumooo1tptomo3iyt s2eln ont4 eenmr io1la elivilt)srtr(r oy4apt mnviatfa2ua(mp;u0alto oeiasla ulnvpn()tlxnxrciatomte n s;()srxo(mpoudomen iet t srtrurpoo1oexnmi3tytls2uaump t)teermo to1lm  aivs;t  exrxr ou1oltnlfvia(fsrtau o;u1aptnio3tld a rm(von(4artrmfctodlm eauvo t  rumiopio1olenlfcil(fsrum(mo;u0tle  ieilsfm2ra( o;t)alenmr totlmteanvols0s2to(m3oy4olenmfci t) rtmumo;t1tex ii3iasfm eaumo t0aetoxr iadfaDeanvi ()srtmiopio4am nmfvsl(f Drr( pou4apeomicild aDuau snu0tlxnmrcty1fpD anvils) 2uriopno1ope lfcsa(f rtm(  ot0tpto i3iat m umn p;u4 eeoxf oa1oat aiei;s srxm(r oo4alee nctl(f 2tm( ooo4tlt iietltlmDrl( pn(4 exnif3iy1fpD ai olt srxmxm3iudomtemfvtatfs2umxrpnu0texnmf3tldfmDem(vpnt4altnxr tydlp  anvolt)srxrimpiy1amt  ietls)a2tmuroot0apen feildfm2uaumo u0aetnxf iytlptraies ()sruoiopny1apee fct t a2rrum ;t1tpenmoctyt mDrlums;u4 ltrif3iodfat auvils tetmim3ou1op nlfcsasfs2tmx o;t1aex io3tyd mDemu on(0 rxomr iotlm r n o s0 rxmxo3nu4lmen fvils)artm( ooo0tltnmfctldlmDrmn p t4trtnxf oodfptelneil( texm(opoydap elieiat)aDtrur ou0alenmi3iat a emnmo;t)tltrircoa1oatean s () rxoir oo4amtn fcsas)s2umx pno4texnmi3iaslm2um( pnu)tetrmf3oa1fm ean olt)trto(rpiy1lpenmiei t arurxmp;o0oetnmoetytls2ran pn()teeoifcoa1lpD  n s;t0teuo(mpoo1olenmfvtls)aruaump;u1tltoiicilsls rlnvpn(4altrxfcoy1op eaieslt  etr(m3nydaleelivtl()sDtax ont0tpx  fctys m ulumsnt4aexoxo to1fmt  ieols)sexoxo ny1lptnmnvi (fsrua(moou0tetomocildfmDumnvp u4tetrmocto1omDrlivs;s seurirpnydam n neia(  rumx  oo1opt moeilt m2ulu s;()aexrmr3oadlmDrau o;( sexm(r iu1ol  mfcils s2umxm oo4optnmocildlsDrm( o u0trtoxrciy1op   ivo s0 2uoxo iu4lltemicslt s2rru pno0teeomociatfs2rluvs ()texrmr oo1faDr nvo;(0trtoxmpiy1ap nmnvt sfsrrru pou1tetn ocilt s uaumo (0arerxo3tadfa   iei;(0 2xm(r3iy4lme  feil()srumur nt0olt ifetyt s2em( o;t)teenmo oo1lpDelneo;s setmimpiodal nmivil( a2rmxront0aeenmictldfs emumont4tltomo io1lpDelueils sexmir3ou1lptnmfvt sfaDrr(rpot0tpen f3tys s rlump;t4texoircoodfaDrlivs t0 eur(o ou1ll  livil(fsrua(ro;t1tltnmfctas sDrmnmp u0aleomf iatfp eaueols0s2xmir3no4olt lfvils)s2trum no4apxnifctatlmDrmu s;(4texoxo tatoa   ivo (0t2uoimpiy4op  mnvs s sDua(roou1apenmictasfs2umu onu0arxrxrcoo1fm  au s;()srur(opoy4lmen ieil() Dtaumooo1opto icildlm2rlnmp t4 exrio oo1oatrau o;t0seumxr3ou1amtn ncsl(f rrr(mp;o1oeenii3tytlsDean o u4altrmrcoydfaDrauei;t)sruo(m iu1lleemncil(f 2rru p;u4tpx mictyt m umuvp;(0alerio iy1lptrauvo t) etoxm ou1amtnmicias s2rrxrpnt0apx  feiad s uau sn(4teenmo ta1fpDe i i;t0trto(o3oodlpen neiltfsrua(rono4oeenmi3tysfm emuvp;(4tleoxf iatfmt lues t)sexrxrpiy4ope mivtasfarumxrpot1oeeomi3iat aDumuvo (4tlxrio oatfmDe nvs;t0trxmim3iudom  lfcils)srtm( ono0tptn ociltfmDumuvo (0 lxnif3iydoateaivi;t0 etr(mpoudole  nvsa(  Dtmum oo4ope  o3iydfm2ea( s;u)tlerxrcoo1opDrln ols  2to(rpno4omt lfvi (fsDuau  nu1olen oeiltfsDranmo u0 eeoxfciytlpD li o (0 exrio3ny4lme  fvsatf 2rrx poo0apenif3iat m rl( o t4 ltomocootlaDeai o;s setoiopou4apeelnctlt)sDuax oou4apen iciatla2emn sn(0tetrmo3tytlateaies s0truoxrpiu1om n nes tf 2urx  ;t0oee miciad m rlnvsnt)tlermo io1op ean s;t0setm(m oy4olt lnctls) Dua(ront1tetn oeiyt sDeln pnt) eenxfcoytlp e neilt)seumirpno4ol e ieslt)sDtmxmont0alt  i3tadla2umnmpnu)alermf iy1op r u s;s t2xrim no4oleemivslt)sDrau oou1tpenii3tatfs el(vsnu0aetnxo3todlp   neils)sruoiopiu1ap nlici t) rrmxmpnt4aptnif3tyt a2ua( s (4 lxrxr3todomt luvols  rxoxmpoo1am elieil( a2ua(rpou4oexo octldfa2umuvo;t) etoirctatlaDranvi;t s2trxo ny1omeemnvs (fa2tau pou4texniietltfm2umnvp;t) exoif tytlp e ies s  ruo(r nu1olenmict t) rurx poo1tle iieias aDel( o;t) rxnir tadom  li i s)srtoxo iu4ole lfetatfarrmuro;o1tltnmieiytla2rmnvo;t0arxoxr3tydopt  nvs;s teuoxm oo4lp  lici ( artmxro;u0opt  iciydlm2ra( s;u4 exoif3tatlm eli o s  2toxm3iydoptnmfesat) 2umum ou1aetomoeiadfa2ua(mpnu4aexrmf oa1la  lnvi s) rtr(m ny4lp elnetltfarrmurpno0opeo i3iyt aDuan p (0teenmo3tadopDrlu i;s)trtrxmpou1lmee icsas  2rr(mpou4opto i3tad a2ulnvo t4 ltoxo3to1lptr u ils  rtmxopno1opeemnei t sDum(rpnt0apeoifeiydfsDeanvo t4alxoxf3oydfatr nvsl(0seurxo no4lpe  nvsl() rtm( p;u0tltomoetas sDel(mo;u4aetnxoctydlmDe nvilt  2urim3oy1lleemfvta() rumxronu4opxnmfctytls rl(vs t0 ltnxo iytfpDraiei s  eur(r3iudlpenlnvs s aDua(r ;o0tpt ii3iyd m elnvs (0arxoxf3io1fmDrauesl( trtoxm3nudlmtelies t) rumxmo;o1openmiciad m2um( on(0tlxomocio1omDrlieols  2xr(opny4om e ict tfarra(  ;t0apx iiciadfm2ul( ont) lxrxf3iy1lpt lueslt srurxr nu4ol  mivil()aruaxrp;u0tlxn feiydfaDum(vs;u0teerio tydoaDrlnvs s0 2toxmpou4lle lfvi t) 2ra(r oo4oeeo fciydls2rln o;t0trenxf3iy1om eln o;t)trtoimpoydal elnvt (fa2ur( pnt0alt ifciadls2rl(vs;(4trtoxf3iotfm  luvi s  etmxr3nodamt lfvtl(  Dtr(root1olt mfeiydfsDemn ont4alxrif ia1omDrlivs;s) rtm(r3oo1aptemnvils)a2trum ou4teenio3tls aDrmumont0altoio3oa1fatrluvs s0sexm(o3nydop emnesl( arrm( o;o1optomi3iltfm2uln p t)teerif3iotlatrlivilt  rtrim3ou1am  lnctl() 2ua(rp;u0apt  octldfmDrlump u0aeermr iodlpt  nvo (0srtr(o io4al   ncils aDtr(rpnt4oee ioetys sDeln p u)tetriocoy1lpteaies;(0setr(r3oo1ale lncia(  2trxr ;o1tpxnii3iys aDumnvp;t4teenifcoydlmtrln slt0s2uoio3nu4amenlicsa()sDumuronu4tpeomietltfsDem(vsnu)arxriocoadlpD lnvs;t) euoxo3ny1aleelnet (  Dtr(  nu0aeto f3iydfa2rlnvs;u0aetnxociytlatr nes;() rxr(m3iudlm elncsasf Dtr( ono0tpxnifciatls2ea(vs u0 rxomf3tatfmteli i () 2xoxr nydoptnlivs t a2raxrpnu4aee iociasfs eanvp t)tlxnmf tytlatelues;(  2urxopno1aptnlnctlsfsrumu  ;u1opt iiciydfa rlu on(0 ltoxfcoydlm r u i;t sexm(m3oodll  lietas artaxrpoo1texnmieildfm2ul( sn(4arenmr iatfa e nvs ( srtmimpnydolte ncsl(  rtmumoot1opxo ieiadfm emuvp;u4artoxo3iadlm  anvol(0 ruoxr3oo1lmeeliciasfaDra(  nt1tptoio3iltla rmnmo t4teermf3tytla  aues;s)setr(o3nydlp emfetlt arurxmo;t4aleoiiciydfm ul( pnu) reoif3oy1omte ivo;()t2xoxopiodape mfcia( a2ur(mo;u0tlx if3ildls2rln pnu0tlxnio oydlm  lnvsl(  rxoimpnodamee net sf Duax poo1aeeoioeiltfmDelnmp;()alxrmr oadlpte nvol( t2tr(o3nydapen fvsl(  2rax p;u1aetnii3iydlsDuln p;t0alxomo3tatom rli i ()srxoirpnu4op nmnvt t)a2rm(r ot4aeeoiictyd sDem(mp t)tetnmf3ia1om r nvi () rxr(m iu1apenlfetat) rumump;o1olen feiyd s ulnvp t4 renmo3tadfp rli i;t0teuoxr io1oltn ncta()arurur ou0tetnioeias a rau p;() lenxfctytoat livs s)tetrxm3no4amtn ictas) rtmurpno1alxnmi3iytfsDra(mo u4 exrxfctotfm elueil(0 2triopou4olenlfeiltf 2tau poo4tleomieiat mDeluvp;(4 eenxf tatoateln i s)teur(opoy4llt lfeil( aDuaxr no0tlxnifeiydlsDuaums;u0aetnmr3oy1fptrli s;t0 rtrio ny4altemfei s  rumu poo0tlx  ociatfm el(mont)teenir ty1la e i i;s sexoio3ny1altn ivtl() 2raxm no0oeeoiicilt s elnvp u0tlxnmo3ty1omte nes;(0setoxo no1ol nmics (f rtru pou0tetn ocilsfsDrm(vo;u) lxnir iadlmDeau olt0trumim oo4ape  nei sf rur(rooo4tetn ietyd mDum(ms;u0artniociy1opD livi s) rxmxrpoy4lmt mnesat sDtm(ro;o1alen oetyslm2eln s;t4 exomo tytlp  lu ilt)texm(o3nu1ome mfci s)artrxro;u0oleo i3iydlsDuaump () eeoxfcoatlpt ai o t trxm(o iu1al nmfci tf 2rax ono1apen f3tasls eauvp;t4 reniocoodomDelnvs t  2tm(opou1olte nvi s) rua( oot1aet mictlsfmDra(vp u4artoxf3oydlpDr ivs;t)tetrxo oo1lptnmfctas  2urxmpoo1aet mi3tadls2umn p t0texrxocoodop  ai o;t)t2trim oo4alee nviltfsrtmx  ;o4aee  feiydfmDelnvp;()aeerxr3iydopt aieils)seurim iu4apee fesls)s2tmu onu1aexoiietltlm2rmnmpnu)teermo3to1fmtr ivo ()sexrim no4ame mfvs () Durumpou0ope  oeiytfs ul( p t) rtrmoctytoatrlnvs (  2umim iu4lm emnei (fsDumxr ;u0altomf3ild s2eauvs;()arenxrctodoa r neols t2tmxm3iydap elivil(  Dtrx o;t4aexnmietyd mDrmump;u0trxomr3tydfa e uvil()t2trio3iu1lpt liviasfa2umur no0olxo fciytlmDuln s;(4arenmo3iydfaD aues;() eurio ou4aleelnesasf rtaxmpnu1aex mo3taslaDrm(mpn(4tlxoxo3ta1faD aieo ()truoiopny1op emnvi t sDtmxroou4ope  f3tatls2ulumont0arxoio oatomteaieil( texrir iu4amtemfcta()a2urur nu4tle  oeiytfm2ea(ms;(0 ltrir iadfp  lnesls)t2tmxrpoo1ol   neil() Dtmxrpno0tex  octyt s uauvs;(4 exoio3iatoaDean sl( setmxopiu1amt mfetls) rua(  oo1optnifcilsfm uluvs;(4aetrmfctotlptelnes t  etoxr3iy4opt mivias  rumu oou4tpeomoctyt aDumn o;u0aleoir io1fa e neol(0 exo(r3iy1op   ictls) rum(mp;t0oexomf3tyslmDran p;() leoxo iy1lmD  n i s seuoir3iydop   icsasfsDrmumpno1texo feiytlmDra(vpn(4artoiocoadlptrlnesls t2xrxr nu1lmte fvs ()artau o;u1aeto iciadlm um(vo;(0aexoxfctodoaDran o s0 rurir3oydam   fvs s) 2rr( pou4alxnmicilsfm2eaumsn()aexnmrciytlp r nei;s)setrim3nydap nmivsltfarrr( p;o1oltn oeiytfm2em(mp;u)altrir3iodoaDrluei ()t2toimpoudam nmfeta() rur(root4opeoiicildla2ul(vont4 rtrxrcoatfmteaneols)s2uoirpny1omtn nvi tf rraxmo;u0tex if3tltfa ean p;(0 rxrxf3iotoatelivilt t2xmxo3io4omtemiei ( s2rm( o;t1apen f3ilslm2rlums u0 rxnifcta1omte neo;s)tetrxo ou1ll  liviat)sDrmxmpno1alx ifcildls emn s t4 lermo3iydoa eli o;t)sexrxm nu4al  mivtltfs2rmxrp;u4tle ii3tyt mDrl(vp;u4aeenmfcoadlpDeanei ()s2tm(mpoo4opte iei t  Dtau p;t1aeen fciydfm rl(vpnt0teenioctytlaDr n o s0 rxrxr iy1alt  ieiatfsrum(ront4openmieildla2rl( s t) etnirctatomtrlneslt)trumxm iudam elfes (  2ur(mpno0aetnmfciytfsDrmn o;(0tlenxf3tadlm eaivs;t0trxoio3ou4lp  mnctatf ruaxmpno1alenioetlsla uau s;u) etoxrcoatlmDelu s;s)t2uo(opnudomte fcta(fsruauro;o0oltoifctltla2eau sn()areoirctytlpteli il(  rumxr io1open iviat) 2rmxmpno1oet mfeiltlm2ulu o;t4artrmo oy1fpD  uvsl(  rxo(m3nudopen fcta()a2ur(r ot4tlt  o3iysls em(vp (4altoxrcoytoateau olt t2uoio3no1apt mivtlsfaDumxm oo4aptnmocias aDrmumpn()teenmo3iodfpDean ol(0s2xo(r no1alte iciat  Dtrum ;o0tlen ieiatla2ua( ont4tltnmr to1oat  neil()s2xrim no1ol elfvilt) rtmu o;t0ape moeiadlaDeluvo t4alxnmo3io1fmtraivs t  etrxr3nu4optemivtls artr(m no0apen ociydfm ean o t4trtomo3iydoa e u o (0sruriopnydamtnlneslsfs2urx ooo4aptnmociyd m uln sn(0 eeomo totfptr u slt0 2xrio nodlm nmfvtat srraxmo;u1olxoifeiytls rmn on(0aeeomr3iotlp  aueols)setriopou4ome  net tf rtrx  ;o4aee mi3iysfm2rlu ont)tetomf iydopDe ivs;s0t2tr(r ny4lmtemfei tf rurxr no0oetnmoeilsfs2rlums;t)tltnmf oodfa  aneo;t0t2trxmpou1omen nvsas) ruaur ot1opxnmoctat a2el(mo ()trtrifcio1op  li o;(0 2tm(opiudoptn fei (fa2ta(ro;t0apt mi3iydls ranmonu)treoif oo1fptranes s0tetmio iy1lmtnmfcilsf 2uau ont1tee if3tadfsDelnmo t)altnir todopte neilt0trtr(rpoy4alt mfetls arrr(m no1oltnii3tatls2eluvp;u4trxnio iydlaDrluvo;s0 rtr(m oo1lm n iet s sDurx ont1oltomo3ilsfsDul(vsn(4aeermr totoaDrau slt0s2xm(o oydal nmieias arra(  ou4tlxoif3tas m rl( o u0 lxnmo3iatop r n s s s2xmir3nu4lptelictas)srurur no1apt iieiadfsDraums;t)aexrio3oytfpDranes ( seuoiopno1llte neils  rua(root0opt  fcildlmDeauvo t)tlxnmrcoatomtelu s;t  2xm(o nu4omtnlnvtltfsDtm(rp;o4alxo ietlsfs elnvpnt0arxoxr totfaD lies;(  euo(mpiudll nmietat) rurum no0ope miciys sDra(mon(0altomo oy1omDelueols) rurio3oo4lpe lfeil(fa2urxrpnu0apto i3iadfs2ul(vp;u0aeeoxr oodfa rln s;s tetmirpou4optnmiesas)a2urxront0tpe ifetltla umuvs;(0tltnxfcoy1fmDran o t0sexrim3no1oltn nvt t  rrrxmpnt1tetnifciysfa2ra(vont0tlxoir3ty1fa eau s t)s2uoxo3ou4lm n ietlt  Draxrpnu4altnmiciasla uanvs;t4 leoircoodlaDe ieols)trtoir3oo1olt  nvsl( a2raurooo1tlxnmfeils s2ua(vo;t0treoir to1fp   nvs;s)s2xrxm oudap nmfet t)srumxm no1olxomoetadla em(mp t)altrxrciatfpDe ueils0srxrio iu1am nmicsas sDta( poo4olxn feiyt m ranvp;(0areomf to1la eauei ( tetoxr3nu4amenlnvtasfa2rm(rp;u0tlt  o3iad s2umnvp;u0aetoir ta1om  aneo (  exoxrpiy4ol e ivt tfsDrmumpou0oex  ocias m rlnvp;t)tltrmfctatoptrlu ol(0teumxmpnodlmtnmieil(fartrurpnu4oltomo3iysfm ua( pnu0 leoxo iytfat anvilt trtrxo iu4aleemnesl()sDua( pnu1altnmoetas mDuauvo;u0alenmr iadlpDrlueols0srumirpoodapen neil() Dra(ronu1tlx mieiasls2uaumo (0areoxf iodopt ln s;(0tetm(m3nodll nmfvils a2ua(rpno4opx mfctasfmDelu o;t4 rtrxocoy1oa rli s;t teuoxr3no4ale  netlsfs2tmxmonu0oee  i3tytfa2em( o u4 exnxf iadopt  i o;s0s2um(opiudomt lnet tfs2rmx  ;o4oexomfetadfa ulnms t4alxoxr3oo1fa rlnvols0trxrxr3ny1lmt lnet t s2umurpnt1tleoioctytla uluvpnu0artrio iotop eln i s0sruoxm iy4lp  lnvsatf Dtr(m oo0aeeo oeiydfs2rln pnt) exoif oa1oaDeai o s)trtmim oodlp  mnvt sf Dua( ooo0tleo ocilsfm eluvs (0teerio oydoaDeli s;s texr(m no1ol nmivs (faDumxrooo4alt  f3ilt sDum(ms;()aetrxocty1lateaueslt0tetoio3oy4lltelnet t)a2rm(r ;t1opx iictlt mDua( on() etrio oydfatranei s s2umxm3nu4apen fcias a2rmur ;o4apxnmf3iat mDeluvsn()trxnirciotfp elueol( sexo(mpou1ameemfcsltfsrumxronu0tlto ieiys aDua( s u0alxrxr ta1lpD ai o s) rtoxm3oydllt licsa(fsruaumpnt4olxoioctasfs2rm(mpnt0tlermfcia1lptr i ol(  rtrxo iu1open fcsatfa2uax pou0oeeo i3iaslsDeanvp u)alxnio3oatlatrlu o s)sexmxo3iu1omee neil( a2ur(mpno1optomf3iyslm2raumont)teermrcoydlp e uvs s)s2uoxo3nudol e fcias)a2tax  ;u0altn o3iat sDuan snu4 etnxocio1omDeaivs t teumxo3oydopen nvslt)s2ra(mooo4apx mietydfmDrl( snt4 etoir iotfmteaies;s0srxrxm iodalenlfctat arta(mpnu1tltoifciydla ea(mo;t4 lerxo iydoaDraiei;s)tetm(o iy4lmt mict (fartaurp;t0tleo octyslaDumu p;u0trxnmr oydlp   ueslt truo(m3oy4amenmnes (faDrm(mpno0altoii3tasfaDuau o;u) reomf ta1lpteaues;(0 2uoim3iudlle mictas a2rm(m no0aexoiietyt sDumumpn()tleoxf3to1oaDrln i;t0 2toxr io4ope licsl(fs2ur(moot1opeo o3iad s2rmnvon(4altrmr3iadlatr nei t  eto(r3ou1lme  fvtatf Dumur no1olxomo3iaslm2ua(monu0artomr3tadomt  i s ( sexrim oydole  ivtatfaDraump;o0opxn i3ils m rm(msnt0alxoio oytlm   u sl()sexoirpoy1lp n nesltf Dumxm ou0teeo o3tydlsDemump u0texnio3ia1fmD lieo t s2umir3oo4altemfet s s2rm(ro;u4aetnmfetadlm rau ont)artnmo3tytlm e i ilt  2umxr oydomtnmneiat aruaumpoo1tlx io3iltfa2ranms;(0 lxrmf oa1lat au i ()s2tmxr3io4lle lnet s artrurpnt1opeo ietydfm2uan pnu)aetrmrciydfmtrlivols)sexrxm iy4al  lfciltf 2ra(mpot0tetn ociytlaDuanmo t)texomr tadfatr u i ()t2xm(m ny4optnlfcilt  2uaumoou1apxoiiciys mDem( s;(4alxnmfciy1fpDe i i t0t2umim3iy1olenmncil( sDtru ono0alx  feildls rluvo;(4aexrmrcta1fmD luvs;t trtmir oo1oltemici t) 2raxrooo1teenmo3tadlmDea(mp;u)arxriocia1fpteai ols0trtm(m no4alt lneta()a2trx  ;u4optnifeiytfaDemuvont0alenmo iydfateauvils) rto(m nu4apenliesas)sruauront1tetnmictysfm rauvo u0aexrif3iytomte nvs;t) 2uo(r3iydam  mfeslt sDtrxrpoo1olt ii3iadlmDum(vsnu4tetoio3iy1om rauei;() ruoxrpoydomen net t)a2rau ont4tpxo icildlmDelumo;t)teeoif oodlmD  uei;(0seum(o3ou4apeelict t) 2ua(  nu0tlxnif3ilt s2rmnvo;t0alermo oydoatrlieo (0teumir3oudlle  ict ( a2trxront0oltomicils s eaumo;u)treomocootoaD anvs;( t2to(m oy4ame lnct t) 2ta(rooo0aeeoiicild s2ea( s t4 rtnifcoa1fptr uvol()tetm(m3nudlpt lieiltf Dta(r ;o1tlxnmfciydfs2eaump t4 exomrciotlmDe iesls)seuo(opou4apen fcs s) rra(rpou1ope  octld a eauvo;(0trxoxr tydfmD auvo;s) 2xmio3nu4am elnet s  2raxrpnu0teeo i3ildlaDem(vont)texomo3to1fpteliei (  2xrir no1opte nci tfsrrmump;t0ale  iciytls eauvs;t4 rxnir3ootfaDraivs (0srtrim3oy4omen fvsl(  2rm(mont0aeen ieiatlsDeluvo ()trxoxr3to1oaD lu olt teum(m io4lmeelfctl(fa2tmx  oo0teenmietltlm umumont4trxomf iy1lp rlu i;t0srumxm3iudoptnlnvt s  ruauroot4tpt  oeiasfs rmn p t) rxrmr3tadfa eau s s trxrxrpoy4ame lnvt ()arraxmoot4texnmictldfm2uluvp t4aetoxfciodfpDrlivilt0trtoxmpiodamenlfciasfs2tmu  ;o1aet  ieilt m eanmp (4 eenir3oodlp e nes s  2umimpnu4alenlnetat)srrax o;o1ole iieiyd sDua( p u)trxomf to1fptraueo;t0srto(m3io1oleemiesls) rtrumpou4oeenif3iltfs2um( o u0teenxfciydoat anes;s) 2tr(m iu1op elnct (fs2ua(r ot0ole  iciatlm2rln pnt0teerxrcta1fm eluvi;t srur(r oo4am elfet ()aDtaump;o4oexo feiysfsDumn s (0artrxfcio1la rai ils)texmir3no1ap   fctatfa2urxm ot4oeeoif3ilslsDra(vp u)artoxr tydfatrluvo s trxr(r3ny4aleelncsls)sDta(  no0aptomo3tas a emnmp u0 rxnir tytop rluvi;s0t2toxrpoodol emnetl(fs2tru p;o4olxo i3iaslm2ran p;t0alxoxf3iotom r n il()s2trxr3nodop e icsat)s2ua( p;u1altoifctlsls eauvp;t0trerircoy1la r i slt srtr(mpiu1ol nmnvi t aDtr(rp;o4tptnioctadls elums ()aetrxociy1la   uvs t  2to(o3ou4optnmivt s srra(m ;o0oet  fctasfaDemums;t0 eenxrctodopte i o t0srtmir iodop  lnetl( arurxr ;u1opt mo3ild aDranmonu0trxrmocoatfat  uvo s0seurio nu4ol nmnci ()s2rr(r oo0altn fetldfs2emu snt4teermfctydlaDr ueol(0trxoxo oydomt lieilt  2ta(m ;u4aexo fctltfaDumnmp;u) eeoir3tydfa  ai s s0 2tmir3oo4openlnci ()aDumumo;u0alen f3iadla ua(msnt0 rxrio3ty1fmtr uvo;s)srxo(m oydopen nei tfartaumoou4opxniociasls2rlumsnt)aeenio iadfaDeauvsls  rto(r ny1lmee iesatfsrurxmooo1aptoioeilt s raums;u0arenxo3iytlpt  nvs (0 exmio iy1oltnmiesls aruaurpot1oltomoetlsfa2emnvpn(4 lerxr oadom  lnesl() rto(r ou4amt livias) Duau p;o4apeniociltlm eauvs;u)arxomo oa1lmD  n i;s0s2xm(o3ny1lm nmfetlt aDtr(mpnu1tlt ifctytfm eln p t)alxrxf3iytoat li i t  2xm(o3oodol  mfes tfs2tmu pno1tpeomoctadfs uau s t)teenmr oo1lm e ivs (0s2um(rpoodopt mneta() 2tmu pot1tle mieildla elu sn(4 rerifcoa1fm  an i;s0 rxrir3ny4ll elneils)srrmu p;o1alen feiadlm2ra(mp u4 rxnxr to1omDelueo (0 etmxm iy1olte fcsas  Dta(m ot0oex io3tadfm2ra(vpn(0aleoxo oa1fm rliesls0 etoirpou4llee iet s sDuau p;o4tlxoiocilsfsDul(mont) eeoxr3oodoa r nvo;s trxrxo oudaleelivtatf 2rau  ;u0aet mfetldlsDemnvsnt4tltnmo ia1opDrlu s;t srxmxrpiudlp nmnci t) rra(moot1oeenmo3iatfa2eauvp;(0tleoif iotfpDr nes;s)t2tm(o3iu4amee nes s  2uaxmpot4aexoifetldls2eau o;(4altomf3oytfa e i o ()trto(o3iu1lptnlnvt ( a2rr(r ;t0altomociys m2em( s;t4 rtrif ta1op eaieo (  exm(o3no4ome mfct (farrru o;t1openmfctatfaDrmuvo t0aetnir oatfm e u o;()tetrim oy1ome lnes () 2rr( pnu0apxnif3ilsla ra(vsnu4arerxf tadfptelu o ()s2xrxmpou1amenmivias  Dua( pnt0tlxniieiydfm ulnvpn(0tetoircia1fm e neil(  etoimpoo1lltemfet s) rrax o;o0aexniocilsfs um( s;t0alermo3io1lptelieolt)setrxr iodamenmiesa( srtmxm nu4apeo ietas mDeau snt4 rxnif3ia1lpDranvi ()trxmxmpnudom nlnctlt)sDumur nu0teenmoctld mDeanvp;t0trtrioctydlatrlnvs;(0trxmxopio4op n fvta(fsDtrur ;o0aptomo3iys a ra(vsn(4 etnmf tadlm eluvol( srtmxrpno1llt mivslt  rtaumoou0opxnifctydlmDum(mo u)artomf3iytfmte nesl( t2xr(m oo4lpe  neia( s2tm(mp;t4aeenmfeiad m rl(msn(4trxnio3oo1lm eluvols trtmxm io1lltelfvilt aDuaumooo0altn f3tltfmDeanvs t0 rxnir3ootfmDeln olt) rxmim nodlm nmietasf rtmxm oo4oet  ociysfm eaumo;t0alxoif3iydom elneilt  rumir oodamenlicsa()sDtm(m oo0oetomo3tas s um(mont4trerxo3iytopDeluvs () euoio io4optemicsas a2um( pno0alt mictys sDuau o (4 rxoir oy1omDeli s;t)texmio3iy1amtnmneia(  rua(moou1olxniicias s2rln snt4 rxomf3to1omtrlivsls0s2tm(r3nu4lm nmfvils  2rmurpno4alxnio3ildla2rmnvonu0aeeriocoo1lmt aueo t0teurirpou1olenmies t  rrm(rp;u4tetn i3iatlm2emuvp;(4arxoxo tytoatr uvi;(0s2xmxopny4lptelnvs t  2rrx  nu1tpenmfciydla ea(vpnu0 rermociydlm rli o;s0t2trxm3iu4am emfcs (fs2rm(rpno1optniiciytlm rl(vsn() eermr3iodfa  aneo t0 rtmxo oodomee ncs () rurxroot1openmi3tyd m2um( sn(0 reoif totlpDrau ilt trur(r iydll  lict s s2ua(rp;o4ope  o3ildfmDemnvsn()tlerxocoodoa e ies s0trumim3no4optn fvilsfaDtmur ;u1oee  f3tlt s rmu s t4arenir3oydop rlueol()s2xoxo3iu1optn iei s)a2rmx pno4alenmietyd mDelnmo t0tlxnxo3iadlpteaneo s setm(o3oudomeelncsa()aDrr(mpot0opxn iciydfs2eluvs;t)arxnif3to1oaD lu sl(0sexoim3ny4omen ieia(fsrumurp;u0olxnmi3iasla2eluvp;()areoxociy1lmteai o;s0srxoxmpiu1lltemnvslt)sDurxmonu1oltnmf3iasla rmnvp;()trenmrciodlpDeli o t0tetrxm3nodllt livtl( aDur(  ot1tlen ocilt aDrmnvonu) ltrxf oodop   ivi;( trtoim ou4apt mnciat) Dra(  ot4olenmfctlsfsDelnmsnt0arenmf oo1fp r i o t seumir3nu4omeemictls)s2ra(r ;o0apto oeiydfs ranmpnt0 lerxrctodfa elu ils)texm(o oodaptemneslt) rrau oot1texnii3ilslm umu o t)altrxr tatlp ranvi;()trtrxr no1al e nvi ( arra(mpot1tptoifeias a2ua( s (4trenif ia1omtranvsl(0teurir nu4ale  icsas  rrmxr ot1tetoiictat m ul( p u) lenio oa1fatrlueo t)t2xr(opoy4lptnlivta() Drr(mpoo0alt mfctyd s2ua(msn(0 ltomr ia1lmtr nes;s0 2tmir oydoptelfetltfa2rmxr ;o1tpto iciltls2eauvp u0altrxfcty1la rlivs s0sexm(r3oodame mietas)arumxr no1olx  ietatlm ranvo (4areoxf oadfp  lu ilt  exoirpoy4ap  mfviat) 2uax ono4tee ii3tytfs uanvo u0tltrifcoydlmtelnvs t)srxr(mpiu4amtemneil(fa2rmxm ;t1oleniociyd sDrl(ms (0 lxrxf3iotfm r nes;t  2toio oodlp nlnei t  Dtmur ;u0tpeniociydlaDumump t4 rtrmf tadfp eaueo t)srtoxr3oydalt mnvtas) ruau  oo4tpxnmi3iydla rmuvo;u) leomo3iydlptr nvslt  2umirpiu4ll nlfei tfsruau  nu4texnmi3ild mDelnvont0tlxrmociadfmDe i o;t0texrim iu4am nlnvsat) Dtm(m ;t1tpxn ietytfsDeauvpnt)areoxf3ta1la  lu sls) rtoio ou4lpenlfcsl(farrr(rpno0open ocils sDrmu s (0arerxrcty1op  aiei s)t2xo(opio1omee nvt ()arrrumoot1olxn fcilt s2uanvpn(4tetoiocoadlaDraiesl() rxoxopoo1lmtnmivsl(f Dua(r nt4aet ifciyd sDel(von()altrxf iydlmDr ivolt0trxoxm3no4lm n nctat)sDtru ooo0alxoiictyd a2rlumonu4trtnio3ia1optr nvols0seuo(m ou1lmtnmieiatfarurxm no4ape ifeiys m um(mp u) rxnxfctotfmteanvi ( srurimpnodol n nctlsf 2rrumont0apxomo3iydla ua(mp;t4teerifcoatfaDran o;t0t2urxo3ou4lmtnmfci s) rur(ro;u4tlt  fciadfs2ra(ms u4arxoxfcoa1laD  neo;t  exrxm3iydllen fesls) Dtru ono0aeen feiyd aDra(vs;u4 leoxrciytop eaieolt)s2tmxrpny4lmenmnctltfa2uaumonu1optn f3iadfmDrl(vp;t0texnioctytfm e i o;()truo(r io4ol nmies t)arumx  ;u1alen o3iyd aDrm(mon(4trtomf3ia1fm eli ilt)seum(rpiodlme mncsat)a2ua(r oo4teeomo3iytfmDua(ms u0trxnxr3iytoatrai i s) rtriopou4lp emicils) rrmxrp;o4olxoif3ildla umn p u)altomf iodfate u i t)sexoir nu4al nlictlsfaDtaum nu4ale mo3iytfm2emuvs;u0altomr3iydopD luvsls)trum(mpnu4om  lnvsl()sDurx  ou1teto ociyt m eanvp t4 renirctatomte u i;s seumxo oydllenmicils) Drr(mpot1opxo ietysla emnmp;t)arxrxocoa1lat anvilt0 exo(mpiudapen nvs (  Drru  ;o1apeomictysfs emnmp;(0 ltoir3to1la e i s ( srxoxr3iu4altn nvi t) 2tax  ;o0tex miciyslmDul( s t4aexrif tadomtraieol() 2to(mpio1apen nct t)srrm(r ;t4tpenifcilt aDrln s;u)teeoif iy1opt liei;t0t2ur(mpiudlle  fct s)a2rr(mp;t0oeeomfctysfs2eauvpnt4 leoxocto1la elu i;s0seurir3ou4optnlfeia()sDra(rono1tlt ifeilsfaDeauvs (0 rerxf3io1late n o t) 2tmir oo1lmtn iesasf rumxr no4opeo i3iydls2rlnvp;t4 leoio oy1op e ies;s  exm(r3oo1altnmnvta(f 2ra(  ot0aetoioctad a emuvo;t4 lxnmr3tadoptr ieslt0teumxr oodaptelivtltf Draxrpno0alxnmociyd aDul(vp;()aeenxrciydfmD anesls)seurxr3nu4ame mietl(f rum( ooo4olen ociadfa2ran on(0artoxf io1laDeln o;t0texrxrpoo4olt lnes () 2ururono0alt mictltfsDeaump;t0altnxfcio1fpDr i i t sruo(rpiu1opeemietls) Drau  nt4alx mfetldfm2ul(msnt)alermf tadoptr i sls0s2uoio3iu4oltemieta(  2uau o;u1tlxo o3ildla eau s;u4teenir oadoa elnvo t)trurxopou1llen ncta(fs2trx pnu0tlt ifeiytlmDea(mp;t4alxomo3tydop  lueil(0s2uriopoy1omee icta(fsDrrumono1tle ifctadfa rm(vp;t4arxrmocoadfmt lu i;t s2xoxrpoudom nmnvs t)srrmx oou0optnioeiytls ran ont0 rxnio3tatom  au o;t trtmim io4ll e nvt () 2tmu pnu4olxoifciltfs2uanvpnt0alenxo3iy1fmt  i o (  rumxrpoodamte fvi ( aDrm(  nu0ole mfeiydlsDum( p u4tetrio3iotfa  anei;( t2tm(opiy1lmt lictl( arum(  oo1alxn octlsfsDuanvp;u)alxnxo3iy1lat aies;()s2xoxm iydom  mfcsasf Duau poo0aleoii3tasfaDemumo;u4 leoxrcio1fpDranvo s  2tr(r3ny1apte ivs tfsrrmum no0apx  f3iat mDulu p u)alxnmo3tatlat  uvs (  exm(m3iu1op e fei t)arua(mpoo1tptnifctld sDranvs;t4 rtrir3io1lptelivo s tetoxopny1lm nlfetltfs2tmumpnu4openiieilslmDemuvp (0aexrmfciotoaD an i s tetmxo3oydomeemivt tfa2urxmp;u1tpxnio3ils s2umu sn()trxrio3tytlaDrlnvi s)trtoxm iu4lmt  fvils)a2tm(r oo0tpxn oeias sDrmnmp;t4aleomf3iodla rli s;s  rxo(m3oydoltemfvtls)aDtmurooo0texnmi3tatfa2elu on()arermo oydlmDraneil( teurxrpnudom elncs (fartau  no1tpenmoctysfaDra(vpnt4texoxf3io1oaDeli s;(  rxoxrpnu1lle mivslt aDtmxrpoo4teen feiytls2umump () eermrcto1omD lies;( s2xo(mpoo1ame mnci (f rtaurooo4oltnifeildfs2ul(vp;t0texnifcia1fmtrln o;()teur(rpou4lleemicsltf Dtmu pno0teeoii3ilsfm2ea( pn(0tleoifcta1fa e nvils) 2uriopoo1lp  lfes s aDtaxr no0oeenmociyd s2uauvo (4texnifcoadfat  n s s tetm(m nu4ap n iei ( a2rmx ono0optoiicias a2ea( s u4alxoio ia1op   u o;() etrim iodlltemfetatf Dumumoot4aleo oeiysls2rm(monu4 lxnmo tatfp eluvs (  2urxopio4ape mfctat)srtrum ou1tpxnmi3ildls em( pn(0 exoio tytlaDeanvi s0 rtrio3nudomeemncslsf Durxm ;o4opto f3tls m el(vpn(0 lxnifciadfaDran o;s0s2xr(mpnudam  lfvt s  Dua(rp;t0aee mietas s2rm(ms t)artnxociytoatr n sl()t2xrxrpio4ole  ncslsfarrr(rpnu1altniiciasls2uauvs t4aeerxr iytlmte uvo s s2uoxm3no4lmt mfcsat  rrr(ront1olx if3iysfsDeau p;t0alerio oy1lp rluvolt0t2ur(rpnu4lpe lfeta() 2raurpot1tee ioctldfaDuanmonu4alermrcoadfate uesls0 etmxm no4ll elietl(fa2umu  ;o0apx ifctas m2rl( p (0 leoio todlaDe ivslt)sexrim iydaltemictatfsrua(rpno0tlt iieiysfa ran p;t)alxrir ta1fm rlu s t truoir oudlm nlivt t)srraxro;o0olxomocils m umuvo;(0tetoxoctotfaDrlieo (  2tmio nudlleelicilsf rur(mpno0aetniieiydla2elu s t4artnxocty1omD aivs s) 2toxrpnudlp elfesatf Dtmu pnu1aeeomiciys m ranvpnu0 reomr3ia1fptranes;(  2xrimpoy1lleelict sfaDtru pnu1olx mf3tad sDrl(mpnu4 etrir3oy1oat auvi;s)srxo(r iu1omtemnei t  Dta(ronu0oetoii3tad m rlnvont4aetnmo3oy1lpDe ivs s)texoxopoy4om elnci sf rrr(  nt1tptomfctas s emn p u4altnxo3oytomte nei s0 rxm(opiu1lpeemiviatf 2rax poo1aetoifetltls2um(vo (4tlermo3oytfpt au s;s0trxr(o iu1openmfeslt artruront0tlxoifctysfsDulnvp u0 rerir iodlat aueo t  rtm(opio4omt mneils artaxroot1tleo feilsfsDemnmpn(4texnmf3ta1lpte nvs;s)texr(r3oo1omte fci ( sDtm(  ;o4opx ioeiys s um(vs;t4 lerir todfm rlueo;(0 eumxmpoydoptnlici tfsrtaurp;u4alen f3iaslsDemuvs;t) eeriociytopD anvi s0seur(m3io1lm elnesat)srrmumpou0aet ioetytfs2uln p;u4teenxf3ia1laDelneo;s tetm(opnudlpt lieilt  rum(  ;t4ope iicils mDuan p t)trxomo3oo1lm e ueils trxo(o iydope  nvtltfa2ur(ro;t0opeo feiytfa2um( pnu0 leoirciotfaDr uvsls)trtmxm3oudlmtn nvil(farua(  ot1tetnmf3iyslm2em( s;(4 eerif3iatop e ieo;t  2uo(o3ou1lmee ivtlsfa2taumpnt0ale ioeilslmDrlu s;t4aleoirciodlat aneo;s tetoir ny1omtelncs (  rtm( pnu1aexnmo3iasfaDeanvs t0aetrircto1fa elnvs;s0s2ur(mpiodole  ncslsfa2umxr nu4oleoii3ildlaDul(ms ()trtoxfciodlpD  n o ()s2xoir nudlpe  ivs t)srtaxrpot0alen fetyslm rmums;u0altnmoctatlpDeanes;s  eumimpoo4lpt mncslt)s2ra(mooo4tet  ictyt aDrlnmo;t4 rermo3ty1fa   u o () rtr(m3nu4altn feilsfa2rmu  ot0tpx moctldlm ua( snt0 renircta1fp r ivi;t0srxrxr3oo1llt  ics s) 2umu  ;u0texnmfctatls rm(mo;t4tlenio3iydopDranvols0t2xm(m nu4am   nesas artrx poo1alenmociys aDemu snt0trtrxrcoodlp   nvs;s0teum(opiu4openmfeil(faDrr(rpno4aeenmfciydla rlu o t0trermoctotlmD au o;t0s2xr(rpnu1oltelivsasfa2umum oo0apx  oeiasla2elnvo t0 rxrif3iadlptrlnvo;t)s2xm(m nydlleemnviat s2um(m ot1tleoifcias a ul(mont4tlxnir3oo1fa e uvil( texmim iu4lmtn fvt () Dumxmpnt4olx  feiasfm2uauvo;u)aetnif oo1lmt  i ol(0 2xr(opiudlmtnmneils  2ua( p;t0olx  f3iltfmDrmumont)tltrifcoo1om rai ols)srtrimpio1op elfes s  Dumxmp;t1tlt if3tltfa umu o u0 etnmrcia1oaDe u i (0srum(mpnodopee net t  rrmump;t4opeoii3iyd aDua( p;t)tlxrir3iydoateaneils0 etmim3oodolt lnvi tf rumx  ou0aex io3iys aDeau p u)artrmrctydomDranvilt)t2uriopiudalt liei t srtrx pou4ale moeiyd a elumo;u)tetrxo oy1fp e nvs ()sexrxmpiodalenlfvt (f 2rmxmp;t4altnmociysfs uanvp;u4altomf oytopt ln s;( s2xoxo3ou4lm emnvil(f Dtrumoou4tetoiietysfs2emn onu)aetnif3to1omt  uvslt) rtmiopoodom  mfeil(f 2trur nu1olx iiciaslsDem(vpn(0tltrir3oo1oa eauvo;t)tetmxopoodomt mieias sDrmu oot1aeto feiytfa ulnvsnu4 eenmf3oa1fatrau o;( seuoim3oodaltelicslt)srrm(  ;o0tlxn icildfm umuvs t0trxrxoctadomDr u olt trurio ou4lm emnetlsf 2trxronu1tetn iciat a2rmnvo u)trtnmo todlmDe n ilt seurim no1ll nmfci sfarrr(rpnt4tpxoio3tydlm2ua(vonu4arxomf iodlp rauvs s0trtmir3oy4ope lfvi sf rtr(  ;o0alxoiociysfm ua(vp;t) rxomo3oytla  lu o;s) etoxr3iy1op emfctlt s2urum ;o1tlx if3iydfm2ran o;t0trxnxo3ia1omD livol()s2xmimpiu4lpeemncs s  Dta(rpnu1tleoioetyd mDrluvont)tlenif iy1lm e i s;s0 2tm(m nydomt lieilsfsrur(root0alt iocildla rln o;()aeenxfctodfmt luvo;(0s2umxmpny4ol  mfetatfsrtaur nu0olt  i3iltfm rau pnt)tlxnxocoytfp r nvo t0trxmim no1oleemfcs ()a2um(monu0altn fetas aDranvon(4tetrmo3ta1omteluvslt0t2xoir3iu4opeeliesatf Dtmxronu1tlenmicildfsDemuvp;t0trtrif tydfaDeauei s0s2ur(m3iydam   netl(faDrrumpno1oexniictys s uan o t4aexomf oy1lpDrlivs t  2xmim io4lpe  feslt)srrmxm ou1texnmociaslsDel(vo (4 eenxf3iatfmt lieo;( t2xmxm iy1amtnlfes t) 2uax o;t4alx io3ilsls2rm( p;(0tleomfcoa1la   nvs;()teur(o3oo4ame  icsa(faruax pot4apx mfctldla ulnmsn()arxrmfctatfpDe ivsl() rxo(o oo4ome mivta(f 2uau  ou1tle  fciltlaDrmuvp;()trxrxrctatfa raivi;t0 etrxm nu4ol  lncslt) Dumu onu1oeenmoctat a emuvs;u)arxrifctydlmDe uvols srumirpoo1ll nlieslt sDtmumpnt4tleo oeils m2el(vsnt4artoxrcto1oaDe u i () 2xoirpio4ape  nvtat aDra(r ;u1tetnmiciadfm rlnvs () exrxf3ootoa rlnvols srtm(r3iu4al e fctas)aDua(mp;u0ope  i3tys sDem( s t) rtrir iadomt lnvo s srxo(r3oodape lneiatf rur( p;o1opx iocild mDeauvp u) lxoxr oy1la raivs (0 rxrio3iodomee net ( sDtmxr no1aeen o3tldfm2ulu s;(0 eeoio3iadop e n ols0s2toxo3iy1ap n ics ()s2trxro;u4tlen oeils m ulnmo;t0 rermo iy1op  lnvs;( srurirpno1altn fvtls)a2rrum no4oltn fcildfa2rmn snu)tlxrifciatfmtelu ilt)srumxr oydlmtn ictas)s2raxmpnt1tetoiiciydfs2rln sn(0 rxnxrciydfp eluei;() 2uo(o3iu4oltnlieia(fsrrau  oo4tlx  feilt a eanmp;u)tlxrmf oatfp r nes t0s2xo(rpio4omtnlnvsa(f rtr(r ;u0tle mieiyd m2uanvont0alxoif3tadoat lnvslt)srum(o3ny4lmtelfcsls)sDrm(  ;t0tle mf3iyt sDraumo t0aetnif iotomte uvs;s  2trir iy1oltnmfctltfsruaxrpoo4tet mo3tls m2uauvs u)trxrxfctadfm rauvols  2tr(mpiodap emncs tfaDtmum ;t1olxnmoetytfa2el(vs (4 rxnircoadlm  anes;t) 2toxm3ny4lmt mfes sfsruax pou0opeomieiltfa2em( p;t4tlxrxo3ta1lm  auei ()s2trxo3oo4lptnmnvil()sDrm(mo;u1apx mi3tatlaDuanvsn(0tltrir oodlat anvi;t)trxo(mpny4ole mfvt (  Dumx ont4tleomoeiyslm umuvp;t4 etrmo3tadfmteau o s  rxoxopiy1lltelfetls)sDrr(m oo0aetomf3tys s2ua(ms t0 exnio3oa1oate ivilt0teum(r3oudoptnlnci t) Dumu p;o4altomoeiaslm2uanvo;t0aleoio3ia1oa  lu i t)seur(m3nudal nmfeia(  Dta(r ;t4tetnmf3iytfm2ua( s u) rtrxo3iytoptran i;t)s2tm(o3iudaltelnvt ()artmxro;u4alx if3iadlsDumums;t0aeenxociydomteluvolt)srurim oo4ole mnes () Dumx  no1texomfctadlsDelu sn(4artrmo tytlatranes;t teurxm iodal nlnvsas) Drrum ot0tlx  fctytfa2el( p u0teenifcoadom eli o (0teuoir3no4lmt mietatf rtru  ot0oetnmi3iatls2eln p u0tlenxr iy1oat  i i t0s2xrio oudalee fes () rra(m no1optnif3iadla2uaumsn() rtrif3oydfpD  u i ( teurxo3nu1ope mncs t a2um(  ot0alxoii3tltfs2ran o;u4aetoxf ootfpDraueo;s0 euoir3ny1omtelnvilt) 2umu o;o1apxo i3iadls2elu s t4trtrmfcoytfpt  uei t0 2trir3oodlpt lneilt) rta(root4tltoif3iadfs2eau s u) exoir3tadfaD  nvi s)s2urxopno1ol elfctat)sDumxm oo0apx moeild a2elump t)aexnxf3oo1opte nvilt0trtmxo3oo1lm nmfvia(fsDtr( ont0opxniiciadls2eauvo t)aexnmr3tatlmD lueo ( trxoxo oydlpt  ivt s srumumpot0aptnifciltfm rlnmsnu0trtoif3oadopDrluvs (0 2tmim oudameemfet t)aDuaxr ou1apt ifeias m2rauvs t)trermo tydoa eanvilt0teur(mpnudomen nviatfsrrr(mpot4opt mfciytfsDrm(vo u)treoxfctytlpDeli i;t0t2trxr ny1omeemfctls)s2tmxr ot4olx  ictas s em(mo t)alxoxr3iy1latrlueo t0 etm(m3iodap  mnei sfsrtauro;t1oleo feiydfm2emu o u0 rtoir to1oaD  n s ( srtmiopnydome lnetl() 2umxr oo1optomo3ilsla elumo;t4treoxo iotopteaivs (0t2xoir oo4alt liei tf rrru pno4tee mo3iltfaDrau pn(0texoio oodfa elieo;t)t2to(mpoo4om nlfvt (  rrmxr nt4tlxo o3iyd m2umuvont)trtnxf ootfp  an s ( teto(m3nodol   fcsls)s2urumoot4tpxomf3tat a emuvo u0arermr oydfm ranvol(0setriopiy1amtnlieia(farta(mpou4aleomfcias m2rauvo (0artnxfciy1oatr nvs;()s2xmxrpio4ole  netls sDtrxrpno1tpt moetlsls2umnvp t0 rtomf totoa raneolt0tetr(r3ny1al nmnvilt) Dur(rp;t1tpxniieiasfmDea( ont)aeeomrciy1oaDranvo s)sexoxm3oy1olte nciat) Dtmumoou4opeoioetld a umuvo (4 reomrctotla   nes;(0seur(opnudllt lnct t a2rmxmp;u0optnmfeiltfs elumo;t0tlxoio3iotfmDrlivs t0trur(r no4apee fei (f Dtaumpnt1aeto o3ilt s uaumon(0 eeoircoadlaDe u o;s  euo(rpiudlp elivsa(f 2rmumpou4aex  oeiyslsDrlu pnu) rxnir iadlpt  i s ()seum(m iu4lmt  ivsltf 2trxm ot4oltoifeilslaDumn pnu4aleoir3iodfp  aues s  eumim iudllt  fcia() 2rr(  ;t4optn fcilsfs2eln p;(4tlxrmr tadopteaieol()trur(opiy4am   feil()sDrrurpoo4altn ictlsfs elnmpn(0trerirciatlmD  ivs ( setm(mpoo1al n ici s)aDuaxro;u4apenifeiadls rau s u0altnxfctatfp e iesls seuoxmpoodoptnlnvta(fsrtm(mont1aeeo o3tydfs2rlumo;u0 exoioctytlp   u o (0s2uoiopnydopte nvia(fa2uaumoot1oee mociysfs umn sn(4artnir3todfa rau i;t)texrxr oodomtnlfvs () 2tau  oo1aleomf3tatfa2el(mo u0trtoxr ia1fmtrlnvs;t setm(rpny1lm emivilsfs2taxmpoo0tpxo oeiyd m2ul( o (0 leriocta1lmD luvi t  euo(r nu4lpe lnvil( a2raxrp;t4oexomiciad aDumu p (4alerxo ootomtraiei () 2tr(r3iudomenliciat)aDua(m ou4aetnmo3tytlaDel( on(0 rtnxociytfpDe ueolt)trtm(mpnu4op nlneia()srtaumont4alenioeiatfsDrln o u0tlxomoctotopteauvo s0t2tm(m nu1lp elicsl(fsDrrxr ou1tle  ociatls elumo (4alxnirciytfa  aiesl(0 exrio3oy4am e ics t s2taurpno0tpx  feildlm2em(vs u0 exrxr oatlpt liesls0trto(o3nydapt  netas arrmxmont0tleomociltfa2el( pn() leoifctatomte nvi t0teto(mpnydamen neias  ruaxrpnt0aptoiietydlm ua(mo (4teeoxfcoatlmD aiei t)t2uoxr io1olen ict (  2uau  nt4tpto ietls aDemums;(0 lenmr3tadfmD livi t)trtrxr iudll nlnvt tf 2ra( ono0ape  oeiasfm2rlnmsn(0trtnmo3iytlmDe u olt)srtr(r3oo4ol   nesatfs2rr(  ;u4optnio3tlt s2rl( p;t4 rtoxr3tatoaD  ueilt0s2tmxm no1om nmnvsls) Dtrxr ou4tpxo fetys s eanmo;t0 etoxf iadfpD an s t0 2uo(r iydam emicil(fa2rrx  ou0teeo ietldlm2eau o;(4tlenifctydfmD aieo s0 rur(r3oodalt mnvs ()aDra( pot0tlx iieiytfsDumu o u0 ltnmrciy1oaDeanvo;( s2trxo nu1opeelietl()s2uaxronu4apeomiciysfs2em(vs u4trxoif3oatfp elivi;s0t2tm(m ou4llee nesl(fs2tr( o;t1oleoiictadfsDrm(vs;u) eenmo todoa r n i;s0sexrir no1lltn fcil( sDuaur nt0tlxomi3iys sDemu p;u4tlxrio3iotlp elueo;(  rxrim3no1alee fesas s2ra( pot0tlto ieildlsDrmumsn() etnmfciotfmDraivsl(0 etmir3iodlm   icta() 2taum nu0oltnifeiadlm uan o t0texnircty1opt aieo (0t2to(o nudap  mivsas)sDta(m ou4teenifeiysfsDranmp u)trenxr tytomtrlu ol(0srxmio3ou4llt  ivtatfa2umumpno4tetnif3tat mDraumpn(4teermr iy1lpD aivolt)t2to(m iy1aptemfeils) rtrxrono0tpen o3tlsfm umuvo;u4altomfcoadlm rlieol( sexr(r3nu4opt mictl(f rumumo;u1oetomfciyslmDemnvs t4arenxf ootoaD aieo s0seum(o3ou1lpeemfvsa(fs2uaump;o4apen f3tyslmDra( p;t0 rerxr iadlm eaneo;(  eto(rpoodlm  mnvt t) 2urxmoot1oltnmoetlsls el( p;u) eenio3iytfmt lneol(0 etmxopou1apeelici sf Durump;u1tpe ifetyd aDumuvsn() etoxo3ty1oateli o;s0t2xmxmpny1amt  ivtasfa2rr(m oo0olenmiciydlm rm(vsn()aleomf ootfmtean o s0trtr(m3oo1lp emnct (fa2tau  no0olt io3iltfm umu p;u4texomf iy1faDraivsls)teurxo3iu1lptelivsa()sDtmx  no1aexomfeiltlm eauvp;u)aetnmr3iadoat an sls0trxr(mpnu4ope mneia(f Dum(rp;u1alxo ieias m2uanms t4 ltrir oadlp r n ols s2umio ou1ameemfeiatfsrrrurpou0tee  o3tasfmDel(vs u)arerxo3iydoat an s t) euoir3nu1alt lfvtatf Duaur nu0altoii3iadfaDumnmo;(4aexomf3iatfmDr nvo t) eum(mpoo1olenmfvi ()a2rmxrpnu0oexoio3iltfs2ulu s;(4arenifcoodfpDean sls) etmxo ny4ape  ietls) 2raumpnt4apt if3tysls um( snu4 lenir iatlmt  uvslt  2um(rpoo4ope  nvils)artrxr nu4altn ociadfa umnmo u)aexrioctodopD livsl(0seuoio oodolt lfvi s)aDrmxrpot0tleo iciadfs umnmo;u0aetnxf3oatfm elnei (  2toim3iodlpenmfeias  rua(rpou1apxomfeiyslm eauvon(0aetrir3iatfpDeaivil(0 ruoirpiudome mictas arra(mp;t0open i3tytla um( p;u4 lerif3ootlp rlu i s)texo(mpoo4aptemncta(f Drrump;t1apx iieiltlm2em( p u)tlerxrcia1fateli i;(0 2tr(o oy4alt mncs ()aDumum ou4oee mietasfm uaump (0 rxrxr ty1omD  uvo;s0srxmxo iydal  lnvsls)artr(ro;o4opxoioetasfa2rmuvpnt4areoxoctotoaD an ol( t2xrir oudaptn fci sfsruax pnu0tle iieildfm umnvp u0arenxo tadlaDr n o;t srtm(rpou1omee nvil( s2uaumonu4aeenmfeiyslsDul(vo t0alxnio3to1lm rluvs;t)srxmim oy4al e ies s)a2rmx  no4alenmoeilsla rau p;(4 exrmf3iotom raneils0seuoxopnudamt mivtlt s2uaum ;t1tet mi3tldls ul(vsn(4artrioctatfmD luvs;()s2xmio3ou4ll  lfct tf Draxrpoo0olxniieiadfaDelnmpnu4aetnxocia1lptrlies;s  2xrim3oo1omtnlneslt)srtaxmoou4aex miciad s2ua(vo u4 rerxr tatop rlnvils0 ruo(o3io1altnliesas aruax o;t1aexomietat a eaump t) rxniociadlpDr n s t)srxmio nu1oleelneil(faDraxro;o4opto oeiltlm2rm(vo;t)aeeoif3oo1fa elu olt0srur(o io1lmt lfctl()s2rmxr ou0apeoif3iyt m2ul(vpn(4 rermo3ootoa eanvi;( tetmxr io4olen fesatf 2tmxmo;u4tltoiictldlmDumnmpn(4trxomo3iydfp rli ol(0seurirpou4ap emfes t)sDtrurpnt4opeomociydlmDrl(vo;t) ltnmr tydopD an ils setrxr nu4ole lncta() Drrxr oo4oexomoctydlm elums t0alermf iadfaDelieil(0 2tr(m oo4al   nei sf 2tmxr ;u1tlxo o3ild mDuluvsnt) rxnxocootfmD aueo s0 rxmiopny1lle mivtlt  Dtmumont4tlt  feiadfmDraumsnt4aetomr3ty1lmDe nvs s  rxrxm oo4am nmicia( s2rm(r no0tee  ociltlmDumu sn(0tlxoxfctadomDr ieolt trtoxo3oydlltemfvi () 2trxm ot0tpx mfeiyd sDrl(msnu0aleoio3iytlp  aieil(0sexoir iy1ameemfvsat) rta(m nu4tltomo3ilt aDrmuvs;(0trtomociydfa  aiei;t)s2xrimpiu1lmt lict s sDrr(  ot1oexo oetltla2rm(msnt0aeenxrcty1fa eauvi;t)seuoxo io4ll nlictltfaDumurp;t0aptoif3iat sDea( s (0trenxr ootom elneilt) rxm(opno1lmeemfesls  Dtrx o;u1altnmfetadla em(vpnu0 etnxf iytopDrli o s s2uoir ou1ape lncs tfsrumx p;u1apeo iciytlaDuanms u4trxrif3ootfm eln olt)t2um(mpiydale lietas a2rm(ro;u1aex mietaslsDrlnvon(4tlenif ty1omte ues (  2xrio ou1alt  fcs t)srtmumo;u1tet  ictltfsDul(vonu)trxrxo tydoa e ueo ()s2xo(rpiodapte ivils sruau ont0tex if3iat m2emuvs;u0aetnmfcoo1fp elieolt)trtmxo iu4omtnmfvta( srurxrpoo0oee  feiytls2rmuvs t0 reoxo3io1opDr i o ()s2xoxrpou1alee ics t a2rm(m oo4oetn icilsfmDua(mo t0 reomf oatlaDraies;(0 etoio oy1optnmiciat  Duax  nu4alen ieiys mDuln pnt0arenmr3oydop r uei;t0 ruoir iodalt miet ()a2tm(ronu4teto ociadfs rmuvon(4teenxocoadfm elieol(0t2tr(m3oy1altn fvi tfa2tmxmont4aeeo fetldfaDem( s ()tetrmf3oodopDr iesls trtm(m io4om elfcsat arra(mp;o4tlenmociatla elu pn(0trtnmr3iatfpDrau olt t2xoio3iodlm emnvi ( s2trurpou4tlxoif3tatlm rmnmp u4tltnxf3iatfmDeau o;t trumir nydapee nesasf Drrx oou4tpxniieiat s rauvont0aexoxr oatlmt  uvi;s)srur(r io4lm  mnvsas  2uaxm nu4alt io3tldla um(vsnu4alenmrciy1la  aivils0sruoimpny4omee fvil()s2ta( ooo1ope ifciydlsDumumo;(4aeeoif tydomDr uvil( srxrxopiydaptelivt (farra( p;t1tpxnio3ilslmDelnvs;t4artoioctodopt ln o;t seuoiopnu4al e icil()sDraum oo1aleo i3ilsls2ulums;u)aeenxo3oadlmDranvo (  rumxr iy4lltelfetls) Dtaurp;u0opx ifeiys aDum( p;t4artrmf to1omDraneolt  euoim iudomtn ivia() rrr(mo;o4ape miciadlm2eanvs;t)treomo3ia1fmt luvol() 2xrxopoo1al   nci ( sDurxr ou1tpenifeiasfa ra( pnt)aetrxo3iy1oa eluvs;( tetoxmpnudll e ici ()aDururpnu0apt  ocildfsDumu s t0 ltrxfctodom rlivs;t trum(m iu4om  lnei ()aDua(mo;u1aptoifcildfmDem( p u) ltoir3oo1lpD au s t  exo(r nu4am  mfei (fa2urxmoou1tex moetasfm emuvo u0alxnio3iadom eluvol(0srumxr3nudome mnvtltfaDuaxrooo4opeomoeilt m rlu s t4alerxr3oatoaD ai i;(  rxrxmpoy1lp  mnvias)arumum ;o1aeen o3iad aDeau on() etomf iodfaDranvs t)teuo(rpiu1ole mivs ( s2uaum ou1tpxniietlt sDemuvpn()aeeomrcoytfa e nvs s) rxo(r iu1lmtelncilt  rtmx o;o4aexnioeiytfa2em(mp u4trenircootfptrlneilt)t2tr(m oydlptn icslt a2um(mpnu4tleo octatfmDrm(vsnu4 ltrmo3tydoaDrlnvo;s0seumirpiydoptn nvils  2rrump;t0oeeomociysfa rmnmp t0tltnir3ta1opD aueo;s0srtr(m nu4ame  net (f 2rr( o;u1opeo f3iydfsDemnvs;t0arxrir3ta1lmDe uei;s  eumxmpny1alt lnvsatf 2tr( ont0tpe mieiatls2eluvo t)aleomo3tatlaD aivslt0 eur(mpou1lp emnet (  2rrxmpou0aeen ietyd mDelnmp (0artomo3oytlmtelneo;() rtoxrpny1ap   net s artr(moot0tlx ifeiadfm ulumo;()teeoir ty1oaDeanvs s  rtoxr iu4llenlnetls)s2umxm nt4oee iiciatfs2um(ms t)texnxfciotfmDeaueolt sexo(o ou4opt mfcia(  Drm(ro;o1ole mfctytfaDua(msnt0aexomf tydlpDe uvi t  2toxr3ny1llt mfeia( aDrr(mo;o0tpe mfeilsla rm( o;t4aetrxfcootoatraies;s  2tr(m3nu1lmtemfctatfs2tax ont4aeto oeiytlaDuauvon()texrio iytomDr neo t0trtrxr oy1lpeelfcsltf Dumum ;u4oet moctas a2ra(vp t)trxoxo3iadlpD lneslt)srtm(rpoy1openlfcs t  Dtmumono1tetomietltlaDrmumpnu0trtoircoadoaDeauvs () etmio3nudamt mneil(  Dtrxrp;t0ole miciadlm eln sn() exoxrcto1oat livo;s trumxr nu4op  mneiltf rtmxmp;t0aptnioctlsfa uanms (0 etnirciatlmD luei;s)trumxo3oydoleemivia()a2rau ooo0altnif3iadlm2rln p;u0artoir ootopDeluvolt0 euo(opoo4lmenlnct tf Duaumpnu4tlt iieiaslsDulnvon()trenxr ta1la   neo;t0seurxopny1omeelfvia(  rrr(moou1tleomociatfmDum(mpnt0aetrif3oydfa  livils trtm(r io4ope  nvtlsfsrrrxm ot0aptnmieiadfm ra(vo;u) eenifcoy1laDean ils0setm(opoo4al n ictls)artaxrp;t0ole ifeias aDrau sn(0 rtnio ia1fmD luvs s0t2toio iy1op e iet (fsDua( p;u0apxnio3tas m2rmumo t0texoxr3iadomDeauvolt0seumir oy4llee fesa(fsrrr( oou0aetnmiciydlm elu p u0trtriocto1faDrliei s texo(rpou4lmen ici (f rtmu oot4tetniietydfmDemuvs;(0altnxr3oytfmDrlies;()srum(m3iy1lm   ncil()aDtrxr ;u4altoifeilslmDra(vo;(0trenxr ia1omt auei;s) etrxm io4ope mnvtl(  2trxm no4aeen ictltlsDrl(vp;(4tltnmr ootlm  aueol(0srtr(rpiodoleelnvs ( srtmxrpno0aeto i3iltls2uaumo (4arxoxr iadoatr ivo t0texmxrpny1ol nlfvsasfsDtrxroot1optn ieiytfm ranvpnt)trtrmfctytfaDr iei t0srumxmpoudame lfvil( a2uru ono4opxnio3ildfa rau p u0 rxniociatfmDeluesls)teuoxo3no4alenlnctat  Durx pot4texo o3iyd s elu s t4 lxrif to1fatrliesls srxmxr3iudope  ivilt)srrmxroou4teeoifctldls2rm( o (4 eenxo3oo1laDrlnes s srxrxm io1aleemfeiatfsDumx  no4alxoifctadfa elumsn()tlxniocoo1om rai i t t2uo(m3oodomeemnetat)s2urxmono1apxnmf3iys aDel(msn() rtnio iatfmteanvi s)tetoxmpnu4lmenlivtas  rtm(m nt4alxoiictysfm emuvo ()arxrir iytfmDe nvs;t) rxoxm3oudll n nciasf Durxr ;o1aetniieilslsDran ont)arxomo3tatlmDe uei;()texoir no4llee ivs ()aDraurp;t1tlx  f3iad aDra(mo;(0artnir3oo1lpDeanvi;(0trtrirpiudlpen nvi (faDua(  nu0ape iieiltlm emums (4artoif3tytlm rlivol(0t2trir3nodlleelivtlsf Duru pnu0apeo ociydfm2em(vo;(0aeenxo3to1fptr ivi;s t2tmxm3no1apte fciatfarurx  nu0opx ifcils s eanms;()trxnmr oadfptrai ols0 rtm(mpio4lltemnei tfa2tm( ono0tpeo ieiys aDrmuvo u0 eeoifcoatfmteaneo t0texrim3oo4olenlnes tfs2umumooo4opxn ociasfaDum( s;t0tlxomocoadlm elues t srtrxrpiudalt  iciasfaDrmu ont4apxoio3iysfmDeanvp;(0alxomf iotfm e nvi;t0teumxm3io1amee fesasf rrru  ou0aet io3tadlsDra(msnu4 etrif oydfp   n ol()t2uo(r oydaleemivsl()sDuau p;u4tlt iietlslmDemuvo ()altnxfctydfp eauei t0 eumxo3oy4ll emfetl( aDur(mo;u0oeeoioetadlmDrmn s () eermr iytoaD aivo;s) 2xoir no1ap emnctls sDum( ont0teeoif3iysfs rlnvpnt0teerxf3oodoaD aivsls  2toxopoy4al nlicsls  ruaxm ;o0tetnmfctytlmDumn p;()aetnmrctodoptr i ilt)s2trxmpio4lmen ivt ()srrm( pno4texomfciad a ua( p;u)artomo3io1omD  nei s) etmxr3nu4omen fctatfartru oot1aptomfeiydla em(vp;u0 etoxf3iadlm eluvo t  2xmxr3io4al   ivilt)a2ur( o;t4alt mfeiadls2em( o t4treoxr ta1oa rlivo;s  2umio iodaptelfesas  Dumump;o1tetnmocils s2rau s;t0arxrif io1fa   u sl( srtmio3oodomt lies tfa2ur(moou1opx io3ils m2rl(ms;t)alxoxo oa1fp  an il() rxmim3iy1lmtn fvtasfs2tm(mp;o1olx mfeiytlmDuanvp ()aexrmo oodfaDeau s;t teumxr3iy1ll   nvsatfarur( o;u1tpeo oetltfa elump;t0 ltnmr3tatfate n sl(0 rurxm3oodamtnmncsa() 2uaxmo;t0alxnmo3ildfmDuanvp u)texoxrcoy1fpDelueo t0 2xr(r io4olte fesasfaDtr(ront4olxn fcils s rl( pnt) lxrmocoatlat  ivo;s srumxm3iu4ape  feil() rta(mpou1aptoioetld m uauvpnt0aleoircio1latelies s  etmio3ou4lme lfeil(fa2rmx ooo1opxo oeilsfm2elnmont)altrifcootoaDean ils0 ruoirpoy4altnmiei (f Duaur ;t4apx  fetad s ul( p (0 exnxf oo1lateaivs;s) 2uoxo oodlmtelfvsat sDtmumpno1apxo f3ias s rm( p (4 reoxfctadfmt ln sls srxr(mpoodolt lfct ()s2ua(ro;u0alenif3iytls rm(mp t0 exrmocootlpt  nvs t0srxoxm3nu1omtelncsas)s2rrxmpno1tpxo ietas m elnmp (0arerir3iytlate nvil(0 exr(rpou4al  mnvtl() 2tr(ro;u4tpto i3ildlaDul(vont4trtomo3iatomD au o;t s2xoxmpiy4ome  ietatfa2trxrooo0aeeomiciydlm ra(vo;t4arxnirciodlaD au ol( trtoim iudlm  lfciatfaDtaxmpno1opeoio3ildfs umn s (4aeeomociydfmD aivi;() etrir no4al  mivsa()artr(ront4oltoioctas sDemu onu4trxnir3oa1fa ran sl(0 2xmim iodap e nvsatfs2trx  ;o0oeto ieildfs2ean p;t) exoir3tydopDrli slt tetrxm3nudlpe mnet t) 2tru ooo0tpe moeiltfaDua( p;t) rtrio3todfm eluei s)setoxm nudame  fes t) 2ua(  oo4aexomoeiatls2rln p ()teermo3oatopteai i;t0t2to(rpoydlme mfctls)s2rmum ;u1teeoifctasfs rm(ms;u4artrxo3todoat  ivo (0 eurim nu1lle lncias  rum( p;t4tpenmoetyt aDulu o;t)altnxrctadoaDraivi t0setmxmpnudlmeelfciatfa2rr(mpou0ape mociltfa2ea(vs;(4 eeoir oo1fpD  nvi s teto(m3nu1omee nesasfsDra(m nu4apxo icildla2rl(mo () lenmociydlatelnvols seurxopiy1lmenmietlt sDurxmpoo0tpe io3tatfm2eluvp t4teenxr3ootfpt  uesls0 2tmxr3ny1optn ietl(f Drm( oot1oltomoeiadlmDea(vp;t0aexnmr3oy1opD aiei;(  etoirpny1amt mnvia(fsDurxmooo1apx mieiyd m2ea(msnt0 exrxo3iytla e uvo;t  etm(r3iudal nlncs () rtr(r ou4tlto octyt aDuanmont0texoir3ty1fat an s t0setmxm3oy4oltelnvs t)aDurxro;o4aleomocilsfa umn s;(0artomrciatlm   neo (0sruo(rpny1amtelnct t  2trx  ;o4tpxomfciad s2el(vs;t)trtrmrcoydfm r ivilt) rto(m3iydap elnesl(faDum(roou4apt mo3iatls2ul( snt) ltnxo todlaD anvi;t teumimpoo4llen netlt)aruaxrp;o1tpenioctld a2umnvp;u0tlxnxr ia1opte ueslt  2uo(r3ou4op nmiei s  2tmur ot0tlt  feiydlm2ea(vp (0tlermf iy1lmDelivilt0t2xoim3oodolenmnctls) Draur ou0aeen o3tas m2rmn p u4texrmo3todlm  anvols0t2xoio3oo4lm n ieiat sDraumont0tlt ioeiat mDea( p;t)altrxf3iotfmD  ues;(0t2xo(opoy4ap elfci t a2rrx p;t1aex mf3tys s2rl( s u0 exrxf ty1oate iei s seuoir3iydopenlnesa(  Dur(r ot1tee  fcildfa em(vsn()tltrircootfat  i s;s)s2xrir io1optelieil( a2trxm ot0aleoifciyt m ranms t0 lenxrciotomt  n o t)s2uoxopoo4om  lictatf 2ua( pno4tet  fctydlm ea(monu)aetnmf3iotopDrlu ols0 exm(rpiu4al e fct ()aDtrum no4alxnifetytls rmuvs;u0texrmocoo1fpD livo s0srxr(o oo1am  miciat a2tau p;t0opxo ictadfmDrlu sn() etnir3oydoa eli i t0 etrxm iy4omtelfeia(  2umxront0aet  f3iadfm elumon(4artrxo3iadop  an s s0s2xoxo3ny4llenlneil(f rtmur ;u4aet ifeild mDea(mpnu0 ltrxfctydfptranvs;( t2xo(r3iy1oltn fviat a2taxm ;u0ope  f3iat a2ul(mont0 etrmo3ootop e nes;( srxmio oudomtnlnctat a2um( ono4aexnmieiltfsDel(vo;(4aleoifcta1oa elnvs t t2xoim iudam emneilsfa2rru  ou1apenmoetyd sDulumo;(0 ltrmrcto1fatelneil(0 2urio oodopen ictas)arrrx p;u0oet  oeils mDelnmo ()tlerxociotfmD anvi t t2uo(opno4lpt  iesl(fa2urx  ;t1aee ioctldfa ulu o t4 lenxf oadlat lnvo t0seuoir3ou1apte net sf Dtm(  ;u4alen ieiysla rm(vo;t) lxrio3oodomD lueol( t2urirpnydlleemfcia()artmxrpnu4oexn fetatlsDumnmo;() lxoxf ta1la   uvs;s0teuoir3iy4oltnmnesat  Drrxmpnu1alx mociadlm umnmo t)tlxnir3oodopDrlu o;()s2xoim oudop nmfetlt aDtax o;t0oexn ieilsls2ua( onu4trtoxf3to1fa eli s ( srtr(rpiydal  miesa(  rrmumoot1teen f3iatfm rlump (0artoxo totopte nesls0teum(r3oy1lpt lfesasfsrraur ot1tpxn ieiys s eaumsn()tleomoctydoatelnvo;()srtoim3oudam  mfcilt)aDurxr ;t1ale io3iat s uauvsnu)texrif oy1laD ln ols) rurirpiu4lme  netasf 2tax p;o1tpxniiciatfaDemn p;t4texoir3iy1fpD anvo s trxr(o3ny1opt livslt)artm(r ;t4tleo octatfs2rmu o t4tlxnif3iadopteanvils)t2trxopoodlmtemfcsat srrrxmooo0oetnmo3iasfa rmn snu0texoir iodopDr ivilt0trur(o3ny4omt mnvi (fa2umu  ;o1aet  f3iatlm2rmn p t4 ltoxo3totfaDeanei;() 2uo(r oodol   fvil( srururoot0oet io3iad aDum(mo;u4teermf3oytomte n s;t) 2uo(m3no1om nlnctltfa2raxm ;u0tle  o3iyslsDua(vsnu) rerxf3oatlmD aueo;( sexrxr3oo1olee fesasfa2trxr ot1oeto oetls sDrmu o u4aexrmf3tatfmD  n ol(  2uoxopiy4lpeelnci () Dtau pnu4tltnmoeild m eau p;u4teeoio3iotfatean i;() 2toxm3nodam  lfciat  Dtm(root1aetoiociad s2raumpnu4trerir3tadfmtrlues (  2tmio oodoptnlnesasfsDtmur ot0oeen iciys a umumo;t0 etnmfctytomt lieilt) 2to(m iu1am nlnvil() rrmu onu1aptniieildla rmuvonu)texrxocty1omD lnvil()t2xoio oy1opeemivi (  rrmum ou1aleo fctlsfm2el(mo u) lenxfciatoatraneilt teuo(opiydlmtn feiat s2trx pnt4ape  ictlslm rlums (4areomociadopD luesls  etoxopnu4omt  nviatfaruru oou1oexnio3tlt s2raump t)tlxoir3iotlm r uei (0 eurim nu1lmeemivias sDtmxmpnt0ape  ictltfa2ranms;t)tltoxr3tadoptrlivo t0t2xoxr3io4am elfvt t  2taxrpou0oet ioeiytfa2umn pnu)tltomo iy1lpDe neo;s t2xo(rpno1oleelnei sfsrra(rpot1tpx if3iysfaDrmums u0 eeoio tadopDr uvsls)srto(mpoodolt  fcs (  Dur(root0altoiieiatfs2rlu p;()tleoxrcoodfa   i i ( srxr(r nydllee fetas)sDrmxm oo0apxomi3iasla eau onu4arxrxrciatfa   u ol() rtoxmpno1lltemfciat)sDuaxr oo4oeenmicils mDuaumo u4 exrxrctodomtr neo ()srur(rpno1omenlnesatfsDrrumoot0olx ioctlslsDem(vs u)aeenmf3iydomD anvi s0texrir3iydalenliet (fsrtm( pnt4tpeo i3iydfaDrmuvpn(4 ltomr iadlmtrlu i t trtr(o ny4olenlfeslt  2rmuro;o0tex  oeiyslm uanms;()arerirctatfptelu ols0sexoimpnodlm   iesa() Dtru  nu1aee if3iasfa uanvs ()texnxf iydop  lu slt0 rxmxo iydop elnei sfsDumuro;o1texnifciltls ulums (4texomfctytoa r nvo;()t2um(rpnu1lmtn icils)aruaurpot4apenifeiat aDrmump;t0tltoxo totfaDr nei;s trum(mpnodomt  nvi (f rumxmp;t4tle  ieiysfs eaumo ()trxnir ootfm e iei t0 rurim iudop elfesls s2uaxrp;o1oee mf3tldfs2umnms t)aexnmf3iytfa eanvs t  2uo(m3ou4lmtnlics s  2tru poo0aet moetydfm uauvs;u0 lerxo3io1om  aivs t) 2um(o oodlmtelnetl(fa2rrxmonu1alx mociltla2ul( p;u4aetnmr tadfmDe ivslt)sexoio3nu1al nmietl( s2tm( pou4tlenio3iad a rmu p;(0texrir3iotop r u ols) exr(m3ou1lptnmfcilt srtau p;t0olxo iciyt mDeln p (0trxoirctotfmt ln s ()t2toxo nu1olt lneta()aDumur nt1oeenmf3iad s rmnvo t)teerio oytfp e nvs () rxoxo3ou1ol emnvtas a2tru o;u4apxo octas a umumo u4aexoio oadfpDe ivs;t) ruoxr3oo1am n fvi t  rtrum oo1tpt mfetaslaDemnvont)trxrir3io1lp  an o;s)t2xo(opnu4ome  ieiasf Drax  ;o4ape mictytfa ea( ont)tltoxrciadlmDeaieo ( sexoirpio1lmt mfvt s) rrmx  oo4alxoiieilsla2eaums u4arxomrcoydfaD anvsl( texm(opiydlmeelnvt s  Dur(m nt4tee ifcils aDrmnvp;(4trenmociadom elu o;( trxoiopny1ope lnci s sDurxroou0opx mfetasfa2umumpnt4treoxoctytoa rlues;(0 etr(mpnu4lltnmfesltfsDumump;u1oeenmfeiysfs eaump u)trenmfctadomDrli ols) 2xmxo3nudam emfesa()srua(rpoo0olenmo3iat aDulu pn()trxrircoytlmtelueo t)s2xoir oy4lltnmnvtasfa2ua(rooo4oet  ietydfs eanms t4trxrxfctadfaDeau s s) rur(rpno4om   ivta()a2umxm oo1apxomietytla rauvp;t)treomr3iodfp r neolt)sruoxopnodom n nvs t  rrr(r ;o4aptniieild a2el(mpnt)aeeomrctydomte i s t  2xoxrpiydlle mnci t a2rmxronu1ole ifcild m uanms t4 lerxf3oa1fa rlnei;t)trtoir3oudam  mfctlsfs2rmxrp;u4aexn fciytlsDemu s;(4 rxomo3oa1omtrli o;t  2trxmpoydalenmfctltfsDur(  no1alenii3tydlm2um(mp t4tltoxf3oytoaDe i ol(0 2trirpiudam   fetas)aDtax  ;t0altn icildfa uau o;t0 ltnmf3ta1lpDr ies s0trxo(m3iu1amen ieta( s2um(  ou0alx micils s2ulnmonu) exrirctodom rau ols)t2uo(rpno1lp   fvsl(f ruax p;u4opt moctadlm2ul(vs u0trtoio3oadfptrau sls0s2umxr ny4olt mivi ()sDur(moou4ape  o3iyd m eanmo u4 exnmr3totomDr ues;s0t2umimpiu4lm elnvi tf 2tau pno0oleomfciyd s2ea(mo;t0tetrxociy1fpD aues;t) 2um(rpnodamtelict s s2rmx pou4oee  oeias m2rmuvpnt)aexnifcto1optraneol()t2to(o nu4apt  nes t)s2ra(rono4alx  icias m rmu o u) ltnirctatoat ai s;t trto(r3iy4lltnmncsl(fa2urxmpou0tleoifciaslmDum(vsnt0aeermf3iotlatrln sls0tetr(opoo4amtnmnetat arumu oou0opt mfciltfsDel(vs;t)aleoircoo1lpDelivi;s0 etmirpiudlm   ncia(fa2uaumonu4tlx ifetysfs2uln pnt0tlxnxfcoo1fp   i o;t  eumxr3no4ameelies sfs2rr(r ;u1texnioetadla ulu p ()aexomf oo1om rliesl(  eurxmpoy1ll nlfvslt)artrx  ot4texn fetltfsDeau s t) eermfcto1fpDelieo s0truoirpio1ap n nctl( s2rrx pnt4opxn fciad a2um( o u4 ltrxo tytfmDe ueo;(0srxoxo io1lptelnvslt  rtm(m ;t0tpx ii3ildla umnmo u4tlxomrcto1la eaivs;t0 rtrxmpoudlmtn neta()srrm(r ou4olxniieiytfm2emu p (4treriociydopt an o;s) ruoir3nudoptnmfcs ()s2uaxmooo4oexn feias a2rlumo t4aexnxf3tatopt luvolt) 2xo(r3io4lme mfctasfartm(mo;t0aex  f3iatlm2raumo (0alxoxo3iytfmDr neol(0trum(rpoudlptnlfvsltf 2umxr oo0oltomi3iat s um( p;u4 ltoif iytfmt aneo;t)trxoirpnudol nlictatf Dumxroot1aeeo fciaslaDumuvs;(0 rerif oytfp r ivs;( sruriopnu1apenlfvtas)arrrurooo1ole mf3iatfa2uanvsnt4altrxf to1lmteaivo (0sruoir3oydlmtelfvtat aDurxro;t0opt mf3tltls rlump (4trtnmo3totlpDrauvslt0t2tm(r3iu4altelnvils arum(monu0alt  oetls s2um( s;t4artnir oytfat an o;t seuoxm oodlp elncsat  2rm(ro;u1teenmiciat m2rauvonu0altnxr iotlpD auei;s)s2urxrpiydlle  nvilt s2rr(roou1optnmietadfa ran o;t4teenmo3iodlp  auvilt trtoio3io4lmee feil()a2ur( poo4apenifeiad a2elnmp;u4aleoioctytfmtrlu i s)texrxmpiy4omenmicilt)arrrxrpou0openmfciltfs2ul(vs;(4aleomocoadla  aivs;t sruo(rpnodlle licsat sDtrur ;u0olx moeilsfm2ul(msn()aeeoxr oo1fp  auvo ()s2xmxrpiydam emictatfsrta(r ;t0tlx moctasfa ua(mp t0aeeoxr iotlmt  ies;t)t2umim3oo4amtn ivt s srrr(  oo0ape ii3iatls2ra( s (0 etrxo iy1oaDrau sls texrir ny4lmenlnvta(fsrtr(r ;u0alenmf3iys m2um(vs t4 rtrmrcoa1oateluvolt  exm(o3iu4aptemnctls)aDta(ront4aetoioeilsfa rluvo t4tltnio oatoa eau i (  rxmxrpiudll elfctls arua(m ;t0opxomi3iatfm uauvsnu4trxnmf3oa1omDr ueo;s0trxrio iudomenlnci t)srtaxmonu0aptnmiciyt s2uauvo;u0texrmrcootomt  n s ( s2uoir iydlpe  nct sf 2ta(  oo1olx iocilt s2rlumo;u)tlxnxoctotfpDrau s;t srto(mpiy1op emnvs t a2umxrp;u4apx  oetytlaDeau pnt0tltrmf3ty1fpDrlu ols  exoxo3iydaptnmnvtls  2rm(rp;u4aex  i3iys sDrm( o;()arerxocoatlm rln o;s  2umxmpou1aptnmncsa()aDuaxrooo0apx mfeiytlmDemu s;(0 rtrxf oo1optrlnei s)trtm(m3oo1llenmfvtl(  rtaumo;o0aptomfetatfmDuaumo t0tlerxf3oydopDelivols s2uoxo nu4omtemfcta(fs2tmxr ;u0apxn i3iytla ea(vo;t) rtrmf iy1op e n s;(  rum(opou4apte fcilt) rrm( o;u4tlxnio3iyd a2raumo;u4aetomf iotlatrlieo;s) rxmxr3io4lmtnmnei s) Dra(  nu0aleomieiytla umump;u)trxomf3tydoate nei;t0s2um(r iu1altelfet s)a2urumono1aeenmi3iadfa2eau snu4aeermf tadlate u s (0texrxrpio1ap  mfes s srtrurooo0oee ioctlt s elums u4 ltnmr oatlpDeln s t)s2tm(o iy1alt mfvi tfa2rru  ;u4oetomociadfa2ulnmpnu0aexoxf oadla rli o;(0trtrio3iudamtnlfciasfs2tmu pot0aeen feiydfa uanvs (4tlxrmocoytlmD  nvs s0 2xmio iu1ll n fctat)sDumu  ;o4altoif3iltfsDrlump u4arxnxr ta1fat auesl()seum(o3oydom emfetat)sDuaxm ou1oee mfetytfs rl( s ()trtoif oydfmteln s t0s2tmxrpiydlpe lfvilsfsDtmx pnt0opt  ictydlm2umums u)texoif3oydoaDr nvo s0texrxr3no4lme  net ( s2ta( pnt1opxnifciaslm um( s;u0 rxnxr tatlmtran i;()t2toxo iy4apen nctlsfa2umx  nu0alt mfcilt m rauvont4aetrif3iytfp ranvi t0 ruo(o ny4apenlfeias  Drauroou1apxomi3ildfmDum(vo t4 exnmr oytfpt  nvs;(0t2tmxr3nodlpte ivils)srum(rp;t0tlt ifctydfm rlnvs;t4 etoxrctotlm rln i s0 exoim3oudalte ieilsf rtaum oo0aex if3ils sDrl(mo u4arxoxr oydlaD  uvi;(0trxoxr3iudlm nmncsa()s2uaum ;u1tpe  ocild a ra( pnt4aetnif3tadlmtrauvo s0t2toim3nudoleelict s s2ur(mo;o0tltoioetydlm ranmo () lxoxf oodlm eau o;t)setmimpoy4apt livi ( srta(r ou0apt mo3ilt m emuvsnu0teenxr3tytom   uvo;( s2xrim ny1aptemfvias) rta(m ou0oltn ictasfs2el( o;u0 lxrif oytomtrluvo;t srxmio3io4am   ieils  rum(mo;o1oexn f3tldla2rln p;t)altoio oodoatr uvo;s srum(m3nudlmen fvsat artrxrpou1aexoif3iltlm ul( o;()alxnircoatlm eluei;(  etmxopoydll n netasfsDtm( pou0tee mocilt a rm(vo t4artniocootlat anesl(  2xrim iodom nmneslsf rra(moot1apenmfcias s2eau ont4altnxrcio1latr u olt trtr(m oudlm nmnciat)s2rmu poo4texnmfeiytlm2em(mo u0 rxnmfcoodop eaneolt  2tmxr oo4omtnmics t)aruaur ou1tet ioeiad sDemn o ()aleoio oydfmtrlnvo;t)t2trxr iy4lp   nvs ( aDum(m no0tleoifciadls ean pnu0 lenifcia1omt auvs s0 2urir nudamtnlici (  2rm(ront0tpx  fctytla ranmo u0areoioctotfa r ivolt0srurim3nu4amte nvs s  2urxmpno1tet  f3iysfm em(vsnu)artoxr3todla rlnes ()srurxrpny1lltelieils) 2rmxrp;t4aetomoctyd a2ran snt) eerio iytlmtraneslt  2ur(m iodlmen fcsatf Dua(r nu1aptnmfetyt aDrm(vs u4 exoxo iodfa elueols srxoir3nu1ol n nctlt)sDtr(r nu0tltniociyt m2rlnvpn(0 leoxf3oadoateai s s) ruoxrpno1om n icta( sDumx  no1olen f3iytlsDel(mont4aeenxo oodlmD aneilt)srxo(opoo1olenmiesat  rumur nu0aeenmfciyslmDemn s u) lxrxocoatopD lneslt t2uoxrpio1oleemictlsfa2trx o;u4oetoiiciasls2ra( p ()arerxociadlmDeanvi;s0trto(mpnu4llt mieia()arra(r ot4tpto i3iadlaDulnms;t4 exnxr iatlatelnei t)srumxr3ny4lme  fet t) Dtm( oou0tlt moctysfa2emu pnt0tltoio3ta1opt  nes;t)texr(r3nu4ale  ivs s  Drrurpnu0apeomo3iytls ulu o u0 rerifctodfm r n slt)setrxm oodll e icsat)arraurono0alxo fciltla ean onu4 eerxfciodla raneo ( teumxopnu4omee nesas sDtrxm ot1apeo oetadfsDel( p ()aeeomo3ia1oa  livil()t2um(m3iodoptelfes s)s2rrxmpno4olt mo3ild a rmnmp t4arxoxo3iodfp eln o t0srto(mpio4lle lfvtl()s2trx oot0ale iiciys m2rau o;(4tlxrif oytlat  n o;s trtoirpoo1om n fetasfaDrrxm ou0opxnii3iytla2emuvs;u4 eenir3oy1opt  n i s trtr(r iy1opeemieslt sruax pnt0tptnifetat mDumnmp;u)altrxo totlatelu s s)tetmxo3oy4ame  ivias s2trurooo1aeeomiciasfs emu o u0 ltnxr to1lmD auvi t0srxrir3iy1am nlfvsat aDtrumpno1ale ii3iltls ulnmp;t)artoif totlpteli o;t tetmxr3oo4ll nlnvias  rtmumonu1oltnmfetad mDel(vonu0 rtnxr oy1om eaivsls0teumirpoo1lle mietl( artr(r ou0alt if3iltlm2umums u)texnmoctadfpDrlu i s0srtrimpnudop n ivtat  Dua(rpnt0tltnif3iytla2rln p;u4 leoxfcoadfp rlnes s)s2xr(m iu4lmeeliesat  rrmxmpnt0olen o3tldfa uanvs u) ltrioctydlpDrlieo;s0 2to(m iy1lpt  ici ( s2taxmpoo4tpx  feiad sDea( on() lxomr3iadom e i i;t texo(r nu4om   fcs ()s2ua(roou0oeeomoctas m2ranmpnu)alermf oatlaDeaivol(  rxmxrpoy1ope  ncs tf Durx pno0tpxoioeiadlaDemnvp u0arenxfcootoaDraivils s2um(opoy1lmenmnvt t)srrrxmp;t1tptomociyt a rlnvp ()tlenif3oydfa raueo;t0srtrxo3no1op nlivi sf rtaxrpoo0apxomiciadfs ulnvpnu4 ltrxo tydopD  uvolt)srurxm3nodol nlfesl(fsrumx pno4oetnioctyt aDumuvp (0teermo3oadlm eluvi t)sexoir3io4opt  ivsl()artaump;t4tpxn i3tldlaDeauvp u0tetrmrcoatfat lieo s0s2toxrpnu4lm emiei s) 2tmx  ou0tpx iietys sDeluvp;(0tlenir3ty1lmtrlneo s  2uoxo3nydope  feil()a2rax o;u1optn ictydfa2uaums u4trxrxf oadfpDrai i t0truoimpnodopt mfei t)srtm(  ou1tpto oetatfs2uaumo (4 rxnxr oo1oat au i s) 2tmir3iydame mneiasfs2ua( p;o1tltnio3ildfs2eaums;()aeerir io1lptelivi (  rxo(r3ny4om e ivsl(  Dtau p;t4teen ociltla ua( o (0 exoir oo1lptr i o s0 rxriopiy1lp e fvtlt) 2rau pou1oexnii3ils aDemu p;u) rerir3tatlpDrlnvi (  2urxr ny4amt mfvslt aDtr(r nu1apx mf3iatfm2umumpnt4altnxo oadop eanvsls seuriopou1lmte fvi s srtmxmonu4tpen oeilt m ean s;t0 lenioctydfp e uvs;s seurirpoo4op  lncta() Dra(r ;t0tet  f3iysfmDran pn(4 lerxfcia1fate u s ( texmxmpio1amt lfcsl(fa2rr(mpno1alx iictadlmDulnmon()texrircoy1op  livilt0trtmxr3iudlle lnvt (  Dtrxm oo0aet  o3iydls2um(vp;(0arerio3oydlpDrlueo t)trtmirpnudlmtemictl( a2uau p;u4ape  ieiyd s em(msn()texnxo iotom rlnvo;s) rxrxmpou1al e ict (f 2urxrpnu1tpxnmoeiasfm2rau o u) exrio3ta1lmDrai o;s0 rtoxopnu4lm nlncsl(fs2uaxmo;u1teenii3ilslaDelumsnt)trtrir3iadla r ieo;s)texmim oy4ol emnet (  Dur( oot1aeeniociat s2emuvo;t4texnxo ia1la elnvo ( sexrim iydlltnmfet sfa2urxmooo4texomfcildfs rau p ()aetoxo to1om eaivs;(  exm(m3ou4llte nctat  Dua( pou0aeenmfctldlm2em(mp;u0 rtoxrciy1fatrli ols0 rxm(r oo4al n ivia( arumxront4oeeo ieiltlaDuanmo;()arenxrcoatla rli s s)seuo(o3oydaltelnctas  rtaxrpou1opeo o3tysla2raumo ()alxrifctadopDr i slt)trtm(r3iydam elnesls)sDrm(rp;o1oltnmiciadla2eauvs ()arxrif3iydlp eaueo s)tetr(m3oudll   ivtat a2uaxm ;o0aetnmociasfm2uanmp;(0tetnxo3iatomD auei s)srxo(m ny4lltnmnvi t)sDrru  nu1oleoifctaslm2uanvs;t0aleoxr ia1lpte ues;()seuo(r3no1ame lnciat) Dtruront0tlenmfeiydfaDeanmsnt0tlxomrciy1om  aieo s)trxmiopoy4lptemfvtas a2tr(monu4opt ioetldfa2em(monu0 etnxo tydomt lu ilt)sexoimpou4lltnlietls)a2ur( o;o0tlenmiciaslaDumn o;t0arxoxoctydoateluvo t seuriopoy1llt lneiat)sDururonu1apxn octas s2em( p () ltoxf3tatfpD lu slt  eumxopoy4lpt  icia(fsrrrurp;u1aptn ictadlm ua( sn(4trtnmoctodfa e i i;(0texmirpiu1am emfci sf rtrurpou0aee  icild s2rl(vp;()aexo
\ No newline at end of file
@@ -0,0 +1 @@
+nvo;s)s2tmxopiu4ol  mnvi ( arraxmpot0teen ocilsfa2rmnmo t0artoir oatfm r uvo;s) 2trimpnydlpeelnesl(fa2trxm ou0opeo iciltfa ulnmo;u4 rtnxr oa1fat aivi s) rxr(o3nudaltn nvias) rua(rpno1aleoifctlt s umuvo ()tltrxr3iy1la rai o;s0seuoxm3oodlltnmnei tfaruax  ot1aetnii3tad m ranms;u4tlxnir to1lp raivi;t  rxr(m3ny4apee fvs t)sDtmurpnu4ole  oeiltlsDuanvo;u0trtnxf3oadoate ueols0t2urir ou1ale mfvsat) rrrum ;t0oeenmoctad mDem( ont4 rtomo3ta1fpD aiei s0trxoio3oy4omtelivil()aDrrum nu0apxniieiysla eln o;t)tlenxo tydfmt  nvsl()s2uoio3iu4omtnmivtlt srtmumpnt4oleoifeildfm2eanmo;u4 rerxr iatlp eluei;t0 etoxm3nu1oltnlicsa()aDtr(r ;u4tet miciydls ea( o;u0teeoxrctytlmDranvo;(0s2tm(r oo4lp n iet sf Dur(  no1texomociatlm2uau s (0arxoxocia1op rlu s () rxrxm oo4ape  ieil(faDrru oou4teeo octlslm umuvo ()tlermrcoy1oaDrau il( teumxm nudolt lici s)a2rrurp;u1ope io3iytfa2el( onu0altrif todlaDrluvol(0srtmxr iy4alenlict tf Drau pnu0aexo fciatlm uln s;()treomf3ia1lmtelivi;s0sexmxrpnudam elfvtl(fsrtaumont0oltoii3iyslsDemnmp;t) renmo oa1omt  n o s)s2xr(mpny1lp nmieia()arrrxrpoo4opx ifcils s2ulumo u4altnmfcoytomDraies;s0t2to(m3ny1opt lfvi s) Duaxmpnt0alxomocias a2ea(vp t4tlermr tytlate i o t) exo(o3oydop n nei (f 2ra(rooo4tpe ifctydfm2el(vs ()artomo tatlptrau i;t)sruoxr io4lpenlfeias) rtax pnt0ale mfeiad a eaumo;u0alxoxoctadlpt  n i ( s2ur(opnudlp nlnei sf Dtrxm no1tpx mfeias sDrmn sn(0tetrxo oa1opDrlu ilt t2tmxmpnu1omtemivsl(fa2rmx o;o1olt mietltla2emu snt4texrir3oa1op   ues;t  rumim nudam   ivi sfarrm( p;o0tetnifciytfsDra(vpnu4 eeoif3iadlpt aivolt) rxm(r nu1lp  lneil()arta(mono1tpt iieiatlm umump;t)trtrxrcoodfate ivil()srtm(r oudllt mfvias) Dumxm nt4tpxnioctltla ea( o;t4 rerifcto1fpDr u i;(0 rxr(m iu4amt lnci s) Duaurp;t0texomoctasfm2emuvp;()altnxo3ootfmDelivo;t srxoxrpoydlp  mneiltfs2raxmooo1aleomfetys s2ra(vs t0tltnmf iytfpteai i;() rtoxr3io1ome  ies t a2urumpoo0tlx mictys sDemn p;(0 rerxfcoydla rli sl()seumxo3oudlptnmnvslsfsDtmxmonu4tpx iictadlaDumnvp t0 exniocia1lat  uesls)s2xmxm iodal nmnviasfsDum(rp;u1apxomoetyt m2ulnvs t4arxrxfciodfate uvi ()s2xrxm oydlmte fvtat) 2ta(  oo0oetomfciyt s2ulnmpnt)tleoir3iy1oatr n o;t t2tr(m3iu1apee ics (f rtr(r ;u0tptniociad s2rluvs;t4aexoxo3tytlm  aueo ( srtoxr iu1optn fetatf Dta( p;u4alenmfeiadls rm(mp;u0tltrxrctodfmDe nvi s  2trio oy1llt lfei tfarrm(rp;u1tleo ociydls2elnms ()artnxr3tadlptrlneol(0tetm(opoy1lp   nvsl()s2rrump;o1olxoif3iyt mDrm( o u) lerxf3iadlmDeaiesls0srum(opnodomeemnvi ()sruru pnt0oet mieiys a2umuvs;u0arxnir iatom  ai o;t  eur(o3oy1op nlfvsa(  rraxmpou4apxn fctat mDul(msnt4arerxo iodopDrlu ols0setoxr3nydllt lfetls) 2tr(  ou0apto f3ils a rm(vo u4areoxf ta1fa rauvi;t0 rxm(mpoo1altnmies ()sDuauro;o0tlt  feias m2raumpn() rxomr oo1lmDeluvi ()texoxo iy1olte fcs sfsDtrxr ;o1tptnmi3iysfm2ulu p;u4 renioctydomDrlueil(0 2um(r ny4ol emicils s2umxmpot1opx  icild aDra(mp ()tlxrif3oatla  lu i s0 2xrxmpny1lpeemiesa( aDrmumpoo1alx  octysfmDum(msnt) eerxfcoodfm raneo;t0 rxoio3oudaltn nvt t sDuaxmo;t4aexn oeiasfmDem( o ()alerxf3tydfp   ueo t)teur(mpno4lptnmfct s arrrxm oo0olenif3ild aDuauvp;u0tlerxr3oa1lptr nvol(0setoxr3oydal nmivtatfarrrump;t1opxnmocils a2rmuvo;u4 rxoir oadom  anei t  2xo(mpou4olen nct ( aDtauro;t4apeoio3ilsla el(vo;t4 reniociytfa  aiei () rumio3oo1apt  iesl( srtmu  oo1oee mf3iat mDean p;() rxnxf3tatfm  aiei;s0setrir ny1ap e fvtlt)s2taxmpnt4apto oeiltlmDumumo;u0tltrmr3iodfp eanvil() rumxopoy4oltemfct t) rtaxrpou1oltomieilt m2ul( pn(0texrmrctodfm   nvo t srxmiopno4omen ncils)a2tax oot1aexo ocild a2eanvpn(0 etnxo3todfmD  ieo (0 2toim nodol  mics t a2tru p;u4apenifciadla eanmo;u) exoxr3tytlmD  ieils sexrxopiu1omtnlies t sDtrurp;t0tlxoif3iydfm eluvo;u4 ltomo3iotfpDe uvi;s0tetrxr oy1ap  lfcilt)a2tau ooo4tex iociyt s ulnvp;(4trxrio to1opDrlieols seto(m3oy4omeelnvs sfsDumum ou0opxn i3tlsla2uln onu0aexoxoctotlp   uei;t)s2xrir3ny4ol e ncslt s2tm(r ou0apxoio3ils aDulnvo t0alenmo3tadfaDranvslt) 2xoir3iu4aptnmfcsasfs2urx pno0alxn fcias s2uluvs t4 leomocoo1fa ranei ()trtoio3io1llt mfviat sDumump;t4aleoifctadfm2ea(vsnu4trtomrctodop raieo (0t2urim no4aptnlnesa(f Dtrum ;o0tlx  feildlaDrmu o u) renmo io1op  anvo t texrio3io1lm emncs (f rrru onu1tpx  oeiltlmDrauvs;(0trtrmfcto1lp r ivils0 2uoxm3iudoleelietltfa2rr(ronu1opxoifciltlsDrauvpnu)trtrxo3oytoaD  neo t0seum(o3ou1alte ncs t  Duaumpou0alx ii3tad sDrau onu0tlenxr iydla ean o;s) rtoxr3no4om n ieslsfarrm(mp;u0oeenmieiytfa2um( s t) eeomf3tatlatrluei;()s2xo(r oy1amtemfvs tf 2tmx pou4tleo ociadfs2ulu o t)tetoifcoy1lpDeluvo;() rumxo3oodlmtn nvt sf rtrxm ;o0altnmi3ils m elnmp t4alenir oa1oaDeai o;s srurxr3no4ame liet s)s2rrx  nu0oeeo f3iydlmDuanvp ()treomo oatfpDr u o s  2tmxr3no4lm nlfetas  Dur(m ;u4aptomfciytfa2eauvs;u0aetrmoctotlaD lnvs;t  exoio3no1omt liet tfaDur(m ou4aeen feilsfa rlnvon(0 eenmocty1fmtrlivi;(0t2ur(o3nodap nmies tfaruru pno0tpxo oeiltls ulu o ()aetnmociotoa   nesl(0 2tr(o3oodlpe mivt (  rtmurpnu4tpe moeildlm ulnmo u0artnmf3oytom r ueo;( srtmxr3nudll nlfetlt arrrxrono1olx  oeiys mDrlnvp;u4trxnmf iodopD  iei (0 rtmxm iydal e fvi (fs2uru ono0olto i3ildfm rln o;t) lenmo3iodoaDeluvs t)trxoir ou1ameemnvi (fa2uau  nt4tetnioeiadfmDran s u0 lxrmr3oatfatrlneo;t)s2trxm3ny4omtn ict (fs2tm(mont1open i3ildls2ua(vpnt4texrxf io1fmDrau s;()trxoir nudome mnvil(  2rrxmo;o4aleoif3iytfs2ua(msnt4aeeoifcio1lpDeai i;()srtmirpoy4altemnvsatfsDrmu poo4aet ifetydlm2emnvs u0 rtnmfciydla   u olt teumxo3iudlm e fcsasf rurx pou0apxo ietldfsDulu snu)arxomf ta1fmDeauvs (  eur(r3nydam  lfcs ()aDra(mo;t0tltn octldfaDrmnvp u)teermf ia1lp e nvo s s2uoxr3nudlltn fvtat)arraumont4olxo ociasfs2rln pnt0aetrxr tydfmD aueslt0srxm(r3oo4optnmivtatf rrm(mp;u1aee moeild s2em( s;u4 reomf3oa1lm rauvi t tetmxopou1llte ictatfsDrrumooo4oeen o3iadfm2eaumsnu4 eenxocta1lpDrlueol() ruo(m3no4oltelict (fa2umu  oo1apxomociadlm2um(mp t4trtnio oytlpD aivsl()srto(r3iu1lleelfviat aDtaxm ou1ope  oeiatfaDrl(ms t) rtnmf oodoaDraies;t) rtm(rpiudop   ici tf Dtm(mpno0aexnii3iyd mDul(vs t4alenxrctadom   u olt0seuoiopno4al e fesls s2rm( p;t0tpt mfetytla2elu onu)aleoxo3to1lpD aueo t0texmir3oy4al  mfvils aDuau  oo4oex  i3taslaDrmuvonu0tltnmf3iodlptranes () 2um(m3iy4ape licsat s2ua( o;o1aetomociadfa eau pnu4trermrctytoate u ol(0srxoxrpio4al   ictat)s2uax ono1tee iicildlm2ranvs;u4aexnmf ty1latr u o () 2xo(o iy4optnlfvils artaxr nt0oexn oetydfa rmums u4alerxf3ty1fp rluvi;s t2tmim oodomeelivi t)s2rm( o;o4tptoiiciat aDraums (4teenif3ta1omtelies;()s2uoxm3oodolenmfvtat aDtm( ooo0tlx ioetyt a2emnmp;u)teeomrcoa1oaDelnvs;t)teur(mpoodlmtelfvtl(f 2rauroou4opeo o3tas sDra(monu) etoxr3to1fmteauvs t) exr(r3oodolee icia()arrmx  no0tptn fctytfm2umumsnu) exnmf tytlmD  n ils  ruo(o3iy4al e ies (f 2trxmono4apt ifeiad sDrlnmont4 leoio oy1faDraivs t0s2trxr3oo1lmt lfet s  rua(mp;o1aleomietas s2rlu s () reoxocoy1opt  u s s0t2xrxm oy1op  mies tf 2urxm nu4optnifciyt s2emn p t0 rtnmr3iytla rlivo s0teur(r nu4omte iei sfaDra(monu1alt  o3iatla2eau p;t)aexrio3ootoa  ln s;t srtrxr iudlle micsls)s2tmuroou0apt  feiad a uanmp;t)texriocoa1lp e u ils0 rtr(r3iy1ope  ivils arumx pno1oet ifctytlmDulnmo;u0 exoxr iatom r i s (0 2tr(o3nydap nmici () Dra(m nt4tleo oeiydla2rluvs (4trxoif3tatomtelu ols0sexr(m3io1lmtnlivsls)srtaxrono1aeeoiieiadfm ea( s;()artrir oatoatelnes () rxmxo3ny1ale lncs ( s2trxmo;t4tet moetas m2uau pnt4tltoir oytfmteauvs;(0s2urxopio4al nlfvs s)sDrmxmono0oexoii3tasfaDrluvon()arxoiociadlaDeaieo;s t2trio3iydlmte ietas srta(mo;u4oetniieilt a umnvsn(4aleoxf3totfmDr iesl( tetmim3oodapenliei ()a2ta(rpoo4tex  iciasfs2rmnms;u)tltoir3iy1oatrlivilt0setrir3io4opee ivsa( a2tru  ou1tpx mf3ild s2emnmonu) rtnirciydlptraneils  rumimpoo1ape mfcsat a2tmur ;u4ole mi3iadfm eanms;u0aeerxfctytlpDeauvi;s sexrxrpno1oltemiviatfa2rr(m ou0oexn fciyd sDeluvsnt)teenxr3ty1fp raues (0seto(r no1amen fesas)aDuauronu0aexn feiasfm ua( o u0tlerxfcta1fpte ivsls)t2toir3nudaltn fei s) Dumxm oo4tlt  iciydlsDem(mpnu)alxrif io1fm eluvols0t2tm(r3oydomt mneslt aDtrxr ot0tptn octydlm ulnvo;u4 exnio oadlp ranvi s  rurxr3oudapenmfct (fs2ra(mp;u1alxnmo3iad mDra(vsnu)altnmrcto1oat  n ols) 2urxo3no4am n fcslt) Dumxmo;t1tlto f3tys s rm(vs u4trerirciotfmDrluvs;(0trxrio oudlpenmfvi sfarua(mo;t1aex  o3iasls raums;u4texnmr3iadlp rluvo;s  rxr(r ou4ol  licsltfs2ur( p;o0oexnii3ildls2ranvpnt0trxnxocoydla e nvo;t)t2uoxm nydlmtelnvsas) rumxro;o0tpe ioctyd m el( p;u0 lenmoctatfmDeauvi;t teuriopiudapee ncta()sDrrxmp;u1oexo fctyd s elu p t4 rtrxrciadlmDeaues t0srxm(opoydom  miesas) Dtr( poo0tpt ioeildlm2uan pnu0teeoxo iytopt li sls t2um(r3iy1omtnlivi tfsrtrxro;u4alt  o3iysfsDemnvo u4texomrcootoat lnesls) etmxmpno1lle lncsltfarrrxront4tet iocias s2em(vp u0arxoxr to1lm e nvol() 2um(r3oo1am n ncsa()sDtrxmoou4alt  ociydlaDul( s;t0texoioctatfm   ivi;s)t2uoxrpiy1lle lnvilt s2tmxr no0tex mietaslm2ran o t4 rerxo3io1optrliei;t0sruoim3iodoltemnvsas artrump;t4tlenioetlslmDra(vsnt4alxnmrctytla  anvi;( t2xmio iudap   fvtlt)srrau pot1texnif3ils sDuanmo u4artoifciodlmDe nvs s t2to(r3iudole lfcsltfa2umx ont0tex mieiaslsDemuvs t4tleomrciotomDeau o s0s2urir3no4ol   nciat) rtm( o;o1aeenioeiyt m2el(ms (4tlxoif3totfpt  ueols s2xo(m nodopeemnvsa(fa2uaumo;t4ale mf3ildfsDrauvsnt0trxnmrcio1laDe nei () rxoxo3iydomtnlnvsa(f rur(mont4ale mociyt s2ua(msn(0alermo3oydlpt ai s t  rxoirpoy4lm elnviltfs2umumoot4tleomo3tyd mDuau s;u4arxoxociatomtrlu slt0s2trimpoudoltemfetas)aDtr(mont0teenioetldlm rm( o (0 leoxr3io1op   iei (0 2triopnudol   fctls sDtrxm nt4aexomocias m2rln sn() etoir iydlaDeanvsl() etm(opiy4oleelnvsasfarrrxmpou4alx  o3iasfs2rlnvs;t) ltoxrcoa1fpDrlieol(0t2xrxr iodlpeelnes (fsrtmxrpot1texn ociyt aDuanvsnu)teenxocoy1lmDrlueol( s2tmimpiydol n ncsa()arumxmonu1apxn feilsla umu s u)arxnxo3oatom rli ils0 rumxr3iudlltemivias)artau  ot1oeen f3iadfmDulu snt0arxoxfciydomt au o () euriopiu1llt livilt) 2rrxrpno4ale mo3ildfm2rlu onu0alermo3ta1omD aies;t) euriopoodoptnlicil(fsrrrx ooo1olx mi3ilsfaDrl(vs;(0alxomr totla e nvo s)s2xmim3nu1op  mnesl( sDrrxmooo1aptnif3tyd s2rl(mp;u4aetrmf ia1fm   nvo s0t2toxopoy1lp nlfesls s2umu  ou4olx mo3tlt s ulumonu4tlxrio3tatlaDean o (0teurxrpiydape mncsasfsrtmx pot1oet mietls s2emuvp;t0 lxrxrciadlmtr uei;s0t2trxr iy4lmen nvsat)aDrmx oot1olxnmociyt a2umn s;(0tltnxfctodfmDean i;t) exmiopno4lmte fvtat) rtau oou4oltnmi3tydlmDuanms;t)teeniociodfa r ivol()srumxopiu1llt  fvsl( srraurpot1ale ioetatlaDea( o;(0teeoir iotopDrauvolt srxr(r3ny1lme mivt s)aDumxr oo0apxn oeiatfm eluvs t4tetnxf ia1lpteln s ()trxmimpiy1lle mnvslt)s2rrxmont0olxo i3iyt a ulnms;t)aexrxo oadfptranes t0 2urio nu4olen ieslt)sDtau pno0oleoio3iasfs2emu s;t4 leomr tadopDe ues s srxmxmpou1lme  fvtl( s2ra(ronu0tpt  ictlt a2emnmsnu) ltrio3ty1fm   n s;s) ruo(o iydal emieta(f ruau oot4altnifciasfmDulu s;t4 rtoir3ia1fp ranes s)t2ur(opny1optnmfesat aDrrump;t0olxnmf3iys m rl( ont4tlerxr ta1fptrln i;t s2um(r iy4lp nlneiat)srrr(moot4optnmo3iyslm2el( p (0texnio3oo1laDelnvs;s0s2tmxo3iu4openlfcil() rrmxr no1olt  i3ils sDelump;t0artrifctytopt  u i (  2uoxr3oudaltemictlsf Dumx  ;t0aeenmo3tatfmDelnvsnu4aexomoctotfpDeau i t trxmim iudlle lfetasfs2ra(mpot4opto o3iydls2ea(msnu4arenmo iadlpD ai ols  rxo(rpnodaleelncs ( aDtmxro;t0tlt mo3tltla2emnvsn(4aexomfciydop   uvi;s s2umio io1opeelfetls s2taxm ou1tpt  ictls a2ea( snt4aleoxocoy1oa ranvols trxrxr3iy1ope lfvs t  Dtau o;u0aet  o3iytfa2ea(msn() eermr3ia1lmD livi ()setm(o iu4aptnmncs sfsDtr(mpno4ape mfetldfa2rluvpnu4tetrmr3iy1opDranes ()setmxr oodllen nct t)s2tm( ont0teto fctyd s rm(msnt)trtrxf3oytlpteluvslt0sexrir nydomtn ivsa(fsDra(m ou4oleo feiydfsDem( p;t4arxomfciodoatrlnvs;s0trtmir oodap emnvi tfa2ua(mo;o4teeo oetadfsDulnvs;u0 rtoir3ty1opD anvs t0s2xoim iudlmte ncs sfs2rrxmpnu0oet  i3tldfm em(vpnu4aeeoifcta1fa   ivols t2uoir3nodlme  feils) rtrxm ;u0apeoif3tysfm2uan pnu0 etoifcoa1lp  ai ol(  etmir3oy1ap elnvslt a2rmx ooo1aptnio3tadfsDem(mo () exnir3oy1lmDe n il( tetr(o3nu1optn iei t a2ur(m nt1alt ifctyd m2ea(vonu)teermo iy1fp  luei ()tetm(o3oydamenliesls)aDua(mpou4aptn oeilsla rl( s;t4 lerxf3tydla elneils t2to(r nydlp eliviasfaDtr(m nt4aetomo3tlsfmDum( onu4teeoxf3iodomte uvs t trxoxopnydlpt  nesat)srtmxmpoo4apxn ictydls2rmu p u0aetnio3iy1fptr ivo;t trxmim nudamtemiviatfa2trx pno0aee  feilt s emu snt0 lxnmf ty1om rau ols tetr(r iudlltelnes t)a2taum ;o4oee io3iadlm el( snt4tlerxfcootfmD lnvi (0trxm(opoo4ome  feslsfarrmurpnu0aexnifetys m uln s (4tlerif3oy1oaDeluei;t0 2urimpoodlm emnctas)arururp;o1oexoii3iyt m em(mpnt0 rerio3iatfaDelueo s)s2urxrpnudlltn feils sDurxmpoo4openmociydfm emnmsnt0alxrxfcoodlmt luvo;s) 2toxrpnydllt mnei s  rra( ooo4oee  oeilsfs rauvpnt4 leomr oodfm eaueslt)seto(r3nodape mnvtlt)a2tm(mont0tetomicils s rlu s u4arxnmfcoytfm rlivi t0t2tm(r3iu1ll e nvsas)a2rmx  ou0aleoioeiytfs elnvo;t4texrxr3io1lmt  i o () exmxrpoo4aptelfvsltfa2rru  ou4olxoiiciad m2ua( p (4arxrxo tydlaDeanvsls trumirpoydlptn fesl(f rrmxro;u0tpx mf3iadfs2uluvp;t)aexriociadfpt aueo t texrio oo4lmenmfvsa(farrm(mp;t4alx  ocild m2rauvo;() exoir3iy1fm rln o;()teum(opiy1apen iet () Dum( ono4aexomo3iydfa ean sn(4 rermr3tydfm e iei s trto(r3iydlle lnci tf ruaump;o0aptnmietadlaDel(mp (0 rxrxr iatlpDeai s s t2tr(rpiu1apt  ietlsfa2ra(rono1olxo ietydlm2rmnms u4 leoxo iodoa rlivi;t0 exoim oy4lm e ici t aDumumpou4olxnifctad sDua(msnt4 exomf3tytfa  li s;s)trxmirpno1lltnlfvt t)srrrurp;u0aleo iciysla2elnvp u)artrir iotlaD auei;t)t2umxr iu1lptemfvia(fartrurono4oeto ictltfsDel(vo u0tltnmocoadoa raies s0 eur(o iy1op nlicias aDta( pou0aeeomi3tydfsDeauvs t4trtoir3tatlpDe uei;t  euo(m ny1ameelfet s  2umx p;o0oeeniietyd s emu o ()aetomrcia1op  luesls)sexo(rpou4olenmnet t  rraumpou4olx if3tydfmDrm(vo;()tleoxfctydlpD ln ol()srurxo3iy1omtelncil()aDumur nt4aet  fctadfsDumumonu) rxnxoctytoa rlu s;t0sexmxopnodllt mivilt arrm(rp;t4oeto ociadla rau o u)tltrmfciy1fat anei () 2tmiopno4llee fct ( a2tauroou4apxnifeiat a2eau snu4tlermo3io1lm eaueilt)seuo(opiy1lptn fvils a2ua( o;o0oltnmo3ils a2eanvp;t)aleoir tatlp  luei (0texmxm3oudamtnmnctltfsrtm(m ;o4ale  o3ildfs2emuvs;u0 ltrmfciydomte neo t texoxopoodomte ncil() 2ra(m ou4aeeoioeiadfa2el( o ()teenir3tadfat anvol()srxr(r iodlp  mnet tfaDrmx  nt1ope ii3iydfsDulu s t4arxnmfciy1fp eln ols)srxrir nodamt  ivias artax  ou4tpen ietad sDra(vsnu4 reoif iadomDe ivi;s  etoxm oudllee nvt s  rrmxmooo1tleomf3tlt m rlnmo (4texrmo3tydlmD lueol(  2uoxrpiy4alenmies s s2uaxmpnt0olto ieilt m2rm(vs;u)aeermf tatfmt luvi t  etmxm3ou4lmee nvsls  rrmum ou0alxoifciaslaDuaumon(4texrmr iotlptr u o;t0 2xoiopoo4am emicsas)srraurpot0tpto oetatfa ul(mo t0aexomr3ty1fm eanes;s)s2toxo3io1am  lnci t sDum(mpot4olxniociydfaDrmnmon(4 rerxfctotla e nvi t0 etoio3oy4lmen ivsl( s2rr( pno4oltoifetydlmDra(vs (4trerxf3tadopDrauvo;s trurxm iydam emnesa( srrr( pou0tlenmietydfa rau s;(0tltrmr io1optrlnvs;t) ruoio3nu1omeelici ( srurxrpot1oeeo fctld s rlnvo;()arxnxf ia1fptrlnvs;s) 2umirpiydlp  miet t s2ururp;t1tlx mfctad a um( pn()trxrxr oydlpt aieilt s2xmxo3ny1lmtelivil(f Duaur ;o0oetoio3tyslm2rm( p ()trtrmf3iydfaDeaiei;(  2urirpny1lmtnlivtltf rtr(r ;u1aexnmociyt m elnvo;()arerircoytfmDeaivols0srxr(m oy4om  lnvtat)s2taurp;u1opxn iciydfa rmu pnu)alxnir3iatopDraueol(0t2umimpnodll   fctl(  2tm(  oo0tlt ifetldfmDul( p;t4 eeomr3ta1oaDr i ols0 etrxo3nudal elnci tfaDra(root4oee mf3ildfm ra(vsnu4texomo oy1fatr u o s)teurir3no4olte iet s arrmxro;o4tpx  ictas aDrln p;() rtnif3iydomt  neslt srxrxm oo4ame mnesa( s2tmx  ;u1tet ifciatls ulums;t)altoifcto1opteln s;(0 2to(rpio1ole lnctlt)s2uaurpoo4oee moetytlsDrlump u0arxoircoodlat au slt)setmio3ou4aptemnciatfa2taxmpoo1tltniieias a2el(mon(4texoxo ty1oa  li ils s2tmxm oo4op e ietatfsDtr(r ;o1tptnmoctadfaDran p u4 exnxfcoodoa e i sls0setoxo3oudoptnmfciasfs2tr(rpoo1oexoio3iyt m elnvp t0tlxnmo3ootlmteln ilt truoxo3iu4al n fvtl()sDtmumo;u4apxn f3ilt m2rauvs;u) reoif tadlp rli s;t0 exmir3oydapt micilt)artmurp;o1oeenmictydlaDua(vs t)alenif iodfp rau il(0srxmir3iy4lmtnlnvs ( aDuau pnt4tlxnmieiytlmDulumsnu0altnir3tadoaDrlies;(0t2urxrpio4amt  fvs t artaurp;o4teto i3ild mDuaumpnu) rermociadfp  lueils0trxrxm3oudal elnetl( s2umxrp;o1apen ieiatfaDulump t0altrmf3oy1omtrai sl(0 rxrxr oudlmt lfcta( sDrmxmpnt0alxomf3ilt s eau o;t4aetnmo oodla eauvilt0 rtmir3oodap  mieil( aDraumo;u0teenif3taslaDrl( s;t4 rtriocty1omDeli o;s teuo(r3oodomtelfvtas)srtmxm ;t0ope mf3tydfm eanmp u4aetnmoctydoatraies;t0setm(o3iodalenlnvs () Dtaxmooo1olen ociatfs2eluvs;()aexnmoctydfpD lnvol(0tetmim iu4lp nmnesls)srrmumpoo0aeen fctaslsDuan p (0tetoxf3oodfmDelnvi ()trum(opoodom  lnvt t)s2uaxmp;t4alxn feiltla2elumonu4 ltnmrctytom  lu o;s0 exmir iodlmen fvsa(fsDtm(root4ale if3iydfs em(vpn()aexriocoatlaDe u o s0srto(m iudomt mfci ()s2ta( p;t4olto fcils mDem( s;t) lxomf iydop  aueilt0srxrir3iy4lptnmncsasfsruau  oo1ale mf3ils aDumuvpnu) rxrxf3iatoateanesl(0setrirpiudomtn fvs sf rtaum ot4tltomieiadls rlump;t)tltnmo totopDrau o;(  2xrirpiy4lmte fci s aDtmumo;t0opxnif3ils aDuau s t)tltrmr oytfp e nesl()t2uo(r3no1oltelfctl( aruax pnu4opto iciadfa2ul(mpnt4 reomf3tydoaDrln o (0sexr(opoy4ap emnes (fartau  ;t4oet micildfs2umu s t0 eenio oo1fmte uei;s0 rtoxmpny1om e ncsat srua(moot4tltn icilsfs2rm(vs;t)tleoif oadfp raies t trtr(o oo1omt  fvsas)a2tmu  ;u1tee  o3tatls uanvpnt)tetrmfciotom rli s;t0 rtmiopoy1open ivsl( aDraxm no4tex io3tys a2elumpnt4texnir iydlpDr neols)setrxm iu1aptemfcslt)arrru  nt1altomoetat a ra(vp (4alxrir iatla e i o;t) 2xmir3nydole  ncsat srua(rono1apt ifcias sDelnms t4arermfcoa1fm   nes s0t2xoxo3nu4altnmncsas  ruax p;u0aet ifctytfs2rmu p;u) lxnxrctydom e i i;s0trur(rpnu4ll emfesls) Drmx p;t1olxoiietytfa umnvs t) rtrmf oydop rai sls t2xrim nu1lm nmfvtl(faDuaxr ;o0oltnmfciysfa2rm(vsn(0 renxf oo1om eaivs;(  2tm(rpoydaptn ici s) rtm(ro;u4ape mi3iys a2ua(mo;t4altrif3ia1fateluvs;(0 2ur(rpoudomt  iet t) 2uax oou1ole io3tas mDrmumpn(4arerirciotomDr nvs;(0sexrim io1ome  icsls) rrrx pot1ope  ociydfsDulu p t4 ltoifciotoatr ivo;t) exoxm iy1lmt mnct s  ruaumoou0opt  ocild aDel(msnt0artoxfctatfm  an s;s tetm(m nydape  fcia( aDurx o;o0tltniociydlm2rmumo;u)teeoxf3tadfat aieols) eurirpoy4lp nmfcslt a2rr( ont1oexniictls a rmn pnt4tleoxo ty1fm rlivs;s) ruoxr ou4ale  nvil(fsDurxmpno1oetnmoeiatfmDrlu snt4artnmrciodfpte ivs s0 etmimpno4lptnliesa( aDtru pot0oleo ociaslm rm(vs ()aeeoio iodop   ues;t) rtr(r3io1am elfcs t)sDrrxr ;t4alen fetys aDem(vp u) etnxo3iadfa eau o s setoxr oo4lp   ivt tf Dta(mo;o1opeomo3iytfm2ul(vpn()tetrxocoatop raieo;( trurio3iudlltemivtls arumum ot0ope  ocild s2rluvp t0 etrxo3oydopD aueilt t2xriopnodlp emnct ( a2rm( p;o4oet mf3tldfa2elu p ()tltnmo oy1opteluei;t0trxm(m nu1llenlfci sfsrtr(m ;t0tet  ietyd sDul(mpnt4texomr iadomt aies;t0 rxrio iu4optnmncs t)s2tru ono1open octatls eaumpnt) ltrxr oadlptr ueo t srur(r oo1llt mfeias) 2taurpnt1oltn fciat sDua( pn() rtrxo3totoa rlivsls0t2umir iu4aptn nesl( s2urumont1tpe mi3iltfsDua(mo;u)aexoir3iatoaD an ol(0 2xoir3oo4lle lnctatfa2ur(  nt0tlxn ietytlm emuvpnt0aeenir iotomDrlu olt0 eur(o3io1ap   fei s  Dtrumpou1tptomoeilslsDra(vpnt0aetoio3tadlmD anei t teuo(rpoudop   neta()sDuax o;u0tetniietldlsDeanvs t)aetnmocia1fmDeln ils) rxmir3oy1alte neslt)sDumu  ;u0opx iociltlmDemn snu0treomo oo1opDraiei;t s2tr(mpoo4om elfvsa()s2um( p;o4apen f3tldls ean pn(0teeoxfcoytlat ln i ()t2trxr3iodlm emfct t) 2tm( pot4opxnmieiadfaDem( p;(4artnif tydfmDraneo;s) rxo(opoydll  lfes s a2ra(r no0alto ociytfa rmn s t0alxrmf3iodlpDr ivi;(0t2uoir nu1aptnlivsl( sDumur ou1altomiciysfmDuau s;u)tleoxo ia1op  aivs;( t2uriopny4apte fci ()aDur(mpou0tpt ioeiltfa rl( s t)teeomo iytlm elu s;t texr(r no1al nlnviasfaDtrxr oo1tlt mi3tyslm2ulnmsnt4 exnio iatlpDeanvols setr(o oodaleelivslt  rur( pnt0oltoio3tldfmDeau o;u)altrmf3ootom raneo;(0 rtr(r oy4lm nmnvias aDtruro;u4tle iieiys m2rm( o;t4altnmr3iodomDr u ils0texr(opiu4olt mictlsfsDrruro;o4tee io3ild s emumsnt) exoircootfp rai s;(0sexm(m oo1olt lietls)artm(m nt4olx  ociyd sDrmu snt) rtnxf3iodopD lneo t s2toim oo4lptnlnvtat arumx oou0olxnmociyd aDea( sn(0arxrxr tydfmt an ol(0 exmio nu4amen fciatf Dtrx oot4oex  ociytfsDumuvpnu0 etnio iydlmD auei;( sexmxm3oo4lpt  ieilt) 2tr(  ;u0tlxo oetys mDrl(vpnu4altnir3to1laDe nesl(  rtrxm io1ol nmiesls)s2tr(  ;u1olxo f3iltfs2uauvo;()trtomf iy1fp  an s;t  etoxmpou1oltn fct s)artrur ou0apxo f3iadls rl(mon()tleoxfctodoa  anvo s)texrim nydap e ivsas sDua( pnu1opxnmiciatlm rln p u) leoirctydoateanesls0s2toimpoodoptemfcsa(  Dur(m oo4ope  fetadls uauvp () rxnmfctydfmDe u ols0t2triopno4lmee ics t  Dumum nt4olen fetys m elnvp;(0 leoioctytlptr u slt0seuoir3iu4lm elnvsltf 2taur nt4tetoioctlt s2um(mp;() renmr tytlat  u i s0trto(m3ny1lp   nci (  Duaxrpot1ope ifeiad sDelums;u0 leoio iy1fateanvsl(0s2trxopno1ap e ies t srur(mp;o4oexomictlt aDumnvp;t) eeoifctytoat li o;s t2urxopnudlmt mneslsfsrurump;u0aeeo f3tydfm2emuvs u)tleomrctodlm r nvsls)texmimpoydalte netlt) Dta(mpot1olt mietadla2elnvon()arxoxrciytlat aivs;( t2uriopnu1lpenlfcsl(fartmx oou4tetn oeiydfa2eanmsnu) rermf3ia1la eanei t0trto(opoo4lleemfvtat)aDur(ro;u4ape mfctltfm elnvo;u4 lxoif3oo1oateluei s0 rxmxo3nodapee fvsl(faDtmumono4altnmieiysla2uau pn(4tetomo iadlpDeai s;s)sexoim3iydam nmnetlt)a2urumpoo0oeen i3tadfmDrmn o;u0trxrmfciodopDr n ol( seuoxrpnu4am   nctat s2trxronu0ape if3tldfs2eau pnu0 rxoxo3tatlp   u s s srto(o3nodopt  iet t sDur(mont0optniictyt a rl( p;(0 leoxfcoy1lmDe ieo s0 2xm(r3iu1op nmfvsl(fs2ta(m nt4oeeo ieilt a2uluvp u) renircoodlat  nvo;s t2tr(m3nu1llte nvsl(  2tm( onu1ole mi3iadls emums;u0 rerio tatfaD lu s;t0setrxm oydllen icsas a2trum ou1tpeo ocilsla um( o;t4tlermf3iodlmDe ieslt0setoio3oydomen ncta(f rurumo;t1tptniiciyd s rl( pnu4tlerif3totlpteauvi;s  eumxrpno4lpt  nci s)srra(mooo4aetniictlt m rmu pnt)tltnxo io1lmDrlnvilt0 2tmxm iodom n nct sfsrur( o;o1opt io3tldla umuvo ()artrxociadfmD  nvilt)sexmxo3oy4ome mieiltfs2ta(m nu0altn oeiasfaDean p;u4treomrcoy1fpDeli ol() etoio3iodlpe micsas)aDta(  oo4tlxn feiydfs eaumon(4tltnmr ta1lp rlieo () 2umxr3oo4ame lfci tfsDtax o;o1teenifeiyt a um( pnt0trenxr3iydoa  aieslt)s2xmir oy1lptnlics s) rua(moot0apeoioetadfaDeluvo;(4trxoxf3tadfmD an i () rumirpiu1ll   fvil(fsrua(moot0altomo3ilt s rl( o;u4trermf iatfpteanei;s sexrim3ou1am emivilt sDtaxront0opeomfeiadlm rl(vont) lxnir3oatfmt  u o;(  eur(o3iodolte fesas a2taxront4apxnii3iltls2ul( ont4 rtnmo iatoa r u s;(0srtr(m3ou1ape  ivtlsf rtr( oou1olen ietys s2uln o (4tltnif3tydfaDeau s;(0trurirpiu1aptnlivtl()aDrru p;t0tptn iciys s2ul(vp;t)arenxo todoatrliei s)tetrir3io4olt  nvtatfsrtmu  ou1optoifetld m ulums (0 exnir3totfp eanvslt0tetrir oodlpt  fctl(fsruaxrpot4oltomoeiysfs2rl(vs;t) ltrmo tytoaDr uvo;t  rxrio oo1lltemiesa(  ruaxm nu1apen oetysfmDem(mo t)tlxomf3ta1oaDe i o;s  exoir3iy4olt lfesl(f Drmu onu0oltn o3tyslsDumnvon()arenxocoatfp eaieo t)teuo(r no4llt  netas)s2uau p;t4apen ieilsfm2em( ont4altnir3iatlpDeluvi t0 rumxmpiy1lpt lnvta(  rur(mo;u0oeto icilsls2elnvs t4 ltniocoo1lmtelies t)s2tmxrpno4amte ivs s a2uaum nu0oetoioeildlsDemnmp (4trtnmo3iy1omtraiei ( trxoio oudlptn nei t aDumx oot1oeeniociadfa rmuvo;t4tetrmf ty1fmDrli sl(0s2tmxo3iy4lmtelnvta()arrm(rp;u1aptnii3tasfsDemuvo u)trtomr3iadopDrai olt srxm(opio1op elicsas)a2taxmonu0tee moeiad m2eanmo (4artoir3oatopteauesls)srurxo iy1lm elivs sf Drr(rpoo1tlt iiciltfm2elnvp (4aetomrciytlm e nvs (0trxriopnu4ape mnvtlt)s2raxmpoo1open oetldla2eluvp;t4arenmocoadfmD anvs s  rtriopiy4ome  fcs s) rtruront4aptomoctltfa2elnmo;(4 rxoif oy1fpt  ivs;s  2xoir3oy1altelfesl(f 2rru pnt4oleomoeiadlm el(mpn(4tlxoir iodopD auvi;s)t2umxo oy4aptn fctlsf 2rr(rpou1oeeoiiciydla rm(mp (4texrmo iotlpDeaieo t)srtrir nodlleelieil( a2rmurpno4openiicils aDran p t)areoirctatlp  luvols  2xoio nu1lleelietlt  rum(rpno0oleomociatlm rln s (4 eeomo3iy1opDrlivil(0teumxo3iy4lmtemict sfa2rm(  oo0altomoetltls2umu snu)aetomo3tatlm eliei;s  rtmxm ou1optemncs (faDurum nt0tptoii3ilslsDel(mo;(0 ltoio3oy1om  an o;s)truo(o3oo1ap  lfes ( srtm(ro;t0openmi3iys s2umnms () reomo3oytoat luei s  eto(o3io1ol nmiviltf 2trxm ;t4aetn i3iasfmDemu s;t0alxrio oy1opt  i s;s0 2trxr ou1lleemici sfaDtmxmpoo4opxo oeiyt m rmuvsnu0 rtoxo iotomD li o t seuo(m ny1amtn ietl(fsrraxmoou0altoiociyd s2rauvont0aeerifciytomtrluvo;(0srxmirpoudll n nvsl()s2tr(m ;u1teeomoeildfa2ulnvo t)trxnmf3tydoateanvol()truoxo3iu4amtelnet t s2tm( p;o4tet  ieias m ranvsn(4 lerxo oo1la rlieo t)teurxr3iy4lm emnetat aruau pno4aetn f3iasfm2emn ont0teenxr ta1oa e ivo s0 rur(mpno4lmte fcs s)s2ua(mpoo4aptnio3iaslaDrauvs;()aetoxfctadlp rli s ( teuoxm3iydllte nvsls) 2tmuronu4olx  octydlmDum( pn() ltrxo ootomDe neo;t0srxoimpnydam nmnvta(f Drr( o;t1teeoioeildlmDrmn onu4altrxrctydfptraueolt0trtrxr3oo4ameelfvtl(fsrurxrp;o4ale  f3iasfmDrlnvsnt4tleoiocoytlpD lneo;t)s2xrxm nu4al   nvil( sruaxrono4apxo o3ildfsDumu onu)trxrxrctodfm e nvol() exrio oodomeemics t aDuru o;u1tlx  octatls2elnvp t4tltrxo iodoaDelieo;s)s2urxr ou4ap nlnvsa() rtm(rooo4tpxn i3tatfa ran snu4 ltrmf iodfmtean o s)tetoxo no1optelfei s aDraum no0tpxomictasfa ra(vs;u) etoircta1oaDrlieo (0texr(m3oudame lnvtl(fsrtr(ronu0tetomi3tydfsDua( p (4trtoxr iatoateauei s0trxm(m3oo4lptnlfvtltfsrrmur ot4apx ii3iysfm um(msnu)arenmr oa1fptrlnes t seto(o ou1lltelivi (faDtrxm no1opxnifctadfs ulnvp;()texnxo todfm   nei;s  etrxm3nodape mnvtls)sDurxmo;o0aetnifciatlm2umnmp;u)aetrxf oadfpt auvs;t s2tm(r3ny4ol nmfctas)sruaxrpoo4aexnmociad a2ua(vsnt)trermf ty1latr ieo ()srxmxrpnu4oltelnvtasf 2urur ;t0apxn i3iadfsDum(vs;t0tetrxo iodlp  livi ( srxm(m3ny1omte nvsatfsrra( p;t0aleoifeilsfm2emump t0 lenmocoo1lm r ivsls s2xr(r oo1ame mict s) rum( oou0opeomoctasfs2eauvpn(0artnmr tytfpD livs;() rxrxr iy4omtnmicsasfaDrm( pou1aee  ieiysfsDrmnvsnu4trxoxr3io1lpt luvilt)trumir3ou1ole  nctltfsDrru o;t0tpe ioeias a2rm( p;(4tltrir3tadlmteli i;() 2tmio3nudoleemnei (faDtr(rono4tlenmi3ilt aDulumont0alermf3iydoptr i i ( trxoiopoo4lmtelnctatfarrm(rp;o1tex mo3ilsfsDel(mp;t4arermocio1fm r n o;t s2uoxr oy1olenlfetasf Dta(mpno0apxoii3ilt m2rm( snu) renxfcoydopDe nvo;t srurxr oodlm e ncsls) 2tmuro;u1altnio3iatfmDeauvp;u4tlxomoctatomD aivol( srurio3iy1lpenlnetls)srtmu  ;o0tleoiictat aDel( sn(4 rxnxf3io1oa  au i ( srxriopnu1lptnlivt ( artr(mono1oexn oeiytla2umnvpn(4aexnxf3tadfp rlu s;s t2trio iy4altnlicia()aDumxrpnt0alx if3tat sDumu snt0 exnmr3oydom r ivsl(0t2umim oudolte fctl()aDrrxrpot0aee  f3iysfm2uaumpnu4aleoio3totomD aueils0srurxrpio1am  livs t sDtm( ono1opt mieiadlm2emnvs (0 lxoxf3iy1op rau ols0setmxo nydlp n nvs (f Drr(m ;u1oet mo3iyd mDeauvpn(4 lxoxo iydlpD  uvo;()s2xmim3ou1op  lnet (fa2uax onu0tpen f3tytls2ulu ont)altrxf tytoa   n ol()sruoxr nudlle mnvta(  Dtmurp;o4aex ioetasls2el( s () eenxo3ootlp  ai i;s0trxmim io4altemnct (faDrmum ;o4apt io3ild s2raums;u4trenxr oo1fp rln s;t0sruo(m3ou4ole  nvi sf rrrxmpno4alxnifctadfm2uanvsn() lxoxr todfpDe neslt)t2to(mpiu1am  lfvs (fsDtauroot0aet moeiat sDelnvo (0 ltnif3tadlaDr i i;t t2toim iu4optn ict t)aDumurpot1olt iiciysfa2ulu pnt)teeoiociy1op eln s;s0 rurxmpoo1aptnlfcs s) 2ta(mpou4aexoioctydlmDua( snu4teenxr iy1lat  neilt teum(m3oydlp emivtls)srrruroot0apx  fetatfs ul( p t4tlerxfciodlmDe ueols0s2toirpno1lmtnlfctl()sDrr( ooo0opxniietad s2rlnmp;(0arxoio3ootomte u o t s2xoirpio1optn ivtl(faDrauroou1tle ioctytfmDemnmp;t0tlxoio3iytoate n ols teumxm nodomtnmict sfsDrm( pno1opxo feiatfm2umums (0trtrif3ta1la rli s;t)s2uoxmpoydape  fcs sfsrrru  ;t1oeenmfctltfa rlnmp t4texnxrcta1op rluvo;()seuo(r3oodape mivsl()s2tmuro;u1olxoiieiadfaDeanvs u0artoxf3totfmDranvi s  euoxopio4ome  fctlt a2rmur oo4tlenmi3iad aDel(vo;u4aleoio oa1lat livils0tetrxr3iy4ameelivt t srta(mo;t1tltniiciad m2uanmo;(4 rtnio3iatomDelu i;s) ruoimpnodoptelieiasfsDuax ono4oex  ietadls2eaump u4aexnmrciytfpDrlu s (  exmxopiy4aleemnes t)artr(r ;o4tptn i3iysla ean o;t0tltnxfciy1laDe ivsl()teto(r iudomee nei (faDtmurpnu4texo f3iaslm ua(vs;t4artrxf to1lm elneo;t) 2um(rpny4amte iviat arra( p;t4oexnmiciyt s eluvo t0aexrmf oo1fa  lueilt0sexoim3oy1llee neils  2rrxmpnt1apx  oeiltfa rmn o;u0trtrxrctytlatrai i t t2trirpiu4lme lnci t  rua(m ou4tltoiiciat m ul( snu4tlxnmo3iatoaD aiei;s seurimpnodape lfvtl(fartr(r oo4apx  fctlsfs2rluvon()tetoio iadfp rlues s)texr(mpoo1ole mnvsl(fsDrrumonu4aetn o3ias a2uaump;()alxnxocoodopDelueo;()s2ur(o3iydomt lnesl()srumxm ot4aexnmo3iat mDeanmo u0 lxoxfcto1fpDelivs (0seto(m3iu4lmtnlnvsat)srtrxro;t0oet mfeiad s umn s u4tltoxf3to1opDraieo ( sexrio3no4openlnct t s2tr(mo;t0tpx  f3iltlsDrluvonu4aeeomr3oytfaD anvolt0setm(m nodape  ietas sDuaxm ;o4oetn fctldlsDrluvo;t4tltoifcoadlm  anvs;t sruoxo iodaptnliet (f rur(mo;o1aetnii3tas s elump;u)aexnxo3iotom  lueolt)s2uoxm3oo4lptelnvs s sDuaum ot0tlxomi3ildlsDea(vs;u) rerxfciotoptrlnvo s0t2xr(rpio1lmtemivs s)a2taxr ;o1aet  feilsfs2eluvon() lerif tatlmDr nei () etmir3iy4ll nmivs t a2tmurp;u1tpe io3tlsfmDulu ont0 etoifcoodop  ln i;s0trxmir3no1ale mnvs t s2rax ont4tleo o3ils a2eanvp;u4 eenmo3oydlpteai i t)setrxr iy1lptemfetatf Dtmum ot0apx mo3iatlsDrluvs u4trtnxo oadlptrln s;s srxmio no1lmen fet t a2tmxronu0oex if3ilt a2ea(vpn(4 rtrmf totoptelnvi t0 2um(m nydalen nctasfartau p;u0oeeomietld mDum(vo t4aexnif tydfaDeaivils  ruoxm iodlpeelfvsl( s2um(rooo0tpxnioctys m ra(ms (4tetomr tytom raieo t)srtmxr iudapen fcils) rraurp;u0oee io3iys a2elnmo;u4aexrxfctatlpt  ueo;t0 2xrxr oodllte fcs sfs2taxrpoo1tptn fciydfmDumnmo;(4 exnmfciadfaD an slt  rtr(rpny4llt  fvtls) 2uaumpnt0teenmoetls mDrmu pn() ltoif3iydfptr nei s t2ur(o oo4aleemicslt)arta(r ot4alxniiciyt aDrm( s;t0texrxo3iatlm raiei;() rxo(rpnodapee ici (f Drm(  ;u1ole mf3tytla2eauvs;u)teenifciodlpD  u s s0 2toxr io1ome lnvsat srta( ont4ope mieiatfsDulums;u0trenio3iodfmD auvo t trto(o io1lpen ivi (fsDra( ont0alxoif3iasls2em(vpnt)artoio ootomDr ivs;s)trxr(o3io1ape micias) Dua(r ot0teeo icild s ul( p;(4treoio3to1om rau olt t2um(opnu1lptemnvilsfaDtmu o;o4oetomictadla2um(ms;t)aexomf3oo1laDeauvs;s setm(r nydop e net s sDrrx  ot1teenmoetlslsDraumo;(4tlerifcoydop eai olt)texm(o3nydoptnmfctat)srtau oou0apeo f3iasls2uan s t)arxrif3tadlaDrau o (0s2xrxr ou1lle mnct t srururpou1oeen iciltfmDul(monu0aetnmf ta1lptr n il(  rxmxmpiy1om nliet (f 2tr(mooo4tptoio3ilt s rm( ont4tetoxf oadfpt lnes (0 etrir nodlmt lncslt)srtrxrooo4oexomi3iatfs2em(ms (0aexrifciodoatrli o;(0seurir oo1ame  fvt ()a2tm( o;t0tpen ieiytfs el(vsnt)altnmf tadfat anesl( texm(rpnu1opeelfviat sDrm(moou4olxoioctat a2rmnmp () rtnir ootfa e ivslt  2tmxo3iy1am nmivs tfa2trump;t4tex  o3tasla2umuvs;t0artrxrcootfpte ieo t) rxo(m3oodllenlivsasf Drruro;u0alenio3tyslm2uauvon(4 rtnmr to1oa   uvi;()srxmimpnodoltelfesl(farurxmpnt4tleomi3tytlsDua( s;(0altoxrcoatfpDraiei;s0sexrxr3ny4lm elfcia(fsrraump;t4oeen i3tatls um(vpnu4trxomr3iy1fpD lu i;t trxrio3nodamte nes s aDtrx pot4tltomoeiasls2uauvpnt0alenifcta1fptrlues;()setmimpiy1ole lnesa()sruru ooo0tee  oetltfa ran p t4aeermr ty1fat lu i ( truo(m3nodlle lnvt t)aDtrxro;u0oleniieild m2uln pnt0trxrxo io1oatrlueo ( srtr(r oo1al  mieta(  rumu  nt1tee io3iydlaDrmnvs ()tleoio to1lmDe ieilt)teurxopiodlme micils  2taum no4tpx mf3ildfa rau s;u) renxo3iy1fmtr u o;s0 2trirpiodol   ieias)s2tr(mo;t4tlxo ictatfsDranvo;u) leniociodlmDe nes;t s2xo(mpiy4ame mfes ()s2urxmonu4oleniociasla2eauvp (4alxnxr ia1fpte nes (0s2xm(r iu4om  lfei ()a2ur( pno1oltoifciys mDranvp t4 ltrioctydomte n s s)seumxrpoydaptemfcslt) 2ra(rp;o0oltnmf3iasfmDrm( o;(0 lxoxo3tytlpt  ieols s2trxr3ny1ole lictasfaDum(  ;t1tee ifeils mDea(mo t4artnio ty1fa eai s t texr(o3iu1opt  ict () rtm(m ;o1apxomi3tadfmDelnmont4trxrio ta1oaDrauvsls  2uoxrpio1ol  lnvilt) Dtax pno0olt  i3tltlmDelnvs;(0 ltrxocoo1lmtr nvo;() exmimpiodape miesatfsDraxr ;o1oee  f3ildlm ulums u4aeenifciotlpteai i s0 2tm(r ou1lpe lnctl( s2rmurpnt4alt  ictyt a ran sn(0teeoir3iodla   uvi;s)srumxo3nu4op   feil()srua(rpoo4altomieiytfs2eln p t0 eenmf3ta1omDr ieo (0trtrxm3oo4lptnlfcil(f Duaumooo0optnmociasfa2rmums;() lxnmfciydoatrai ol(0srurxr oudomtnlnvslsfaDrruront1aeto feilsla ulumsnt0aetnmf iytlmDr i s;(0sexm(o3oo4llenlict t aDrmur ot4aetnmoeilsfmDeluvs;t0 ltnmf tadopDraiei;s  ruo(opiy4oleemfvtas  rtrxr ;u4ole  feild a emn o u4teermr to1fa elivsl()teuo(m nu1opt livias)a2uaxrpoo0oexomfetyd a2eau o ()altoifcoytlm r u o t0 2toim3iodomtn fesltfsrtrx pnu0oleomf3tas s rl(vpnt4treriocto1lm rln ols)t2to(m3nudope  ncsl( sDrmumpnu0aexnmoctydfs2el( o;t4trtoirciodlmtrlnes;( srumim iu1lpeemfcs sf Durxmpno0teto o3iydlm em(ms t0 leoxo3iadfateauei;t)srtoxr3oo1amtnlfvsl(f 2um(mpoo4aet  i3iadlaDelnmo () rxoif io1lm rli o;t)t2to(r3ny4apee ici () Drru p;o1opx mi3iatfs2eau pnt4arerio3iydfat  u il( srxrir no1llte netlsfaDta(rpoo0alto ociyslm rlump u4arxomo3tytoaD au ilt t2trxr3iudam emfvias)s2rmxmpnt1olt mi3tasls rmn p;t4teenmrciatom  luvo ( srxo(r3ny4amtemictasfaDrax oou4apxn i3iat s rmumo;(0 rxoxr to1opDelnei;(0setoio3oudomt lfvs t) 2tm(rooo0tleoio3iasla umnmpn() reomo to1fpt aieilt0trurim nodoptnlnctltfarrrur ;t4alx  fciaslm emnmo;u0 lxrifcoodfmtr u slt0t2tmirpoydaptnmici sfsrumuront1tpxnifctadlm rln p;(4 ltomf tadlpt au i;(  exmim3nu4alte iciltfaDtaum ;u1tlen i3iyt a ranvpnt0arxrxociytlaD lu s s seto(opiy1lpenlncil()s2rm(rono1aet iieiadfa ea( onu)arenir3totlaDe u sls)srumxmpno4lpt lici sfs2rrur ou4tle io3tas a2ea( o;t4artrio3oatfmDraneo;s srtmxo3nu4apt  nci (farum(mpnt1ope ii3ild aDrm( on(0 etoif oo1late ies s0texo(rpoudopen iesltfaDua(moot0alxnii3tls m rlnvp (4 reoxf3oa1laDrai s (0 2uoxo iu1llenmiei t  rum(r oo0opxomfciadlaDelumo;()tltnmfctydlaD aueo s s2uo(o iy1ap e ictlsfsDtmxr ;t4tleoioeiadfmDua( s;u4alenmf oodom  livol() rur(opno1ol  mfvt t)sruaxrpoo4oltnioctatfa ranvpn(0trtnxf3iatlptelnei;t0 rtoio iy4lpt lnctasfs2rrx poo0opeoifctasla2ua(mp;u) ltrxr3io1op ean s;s s2triopou1op e netl() Drr( p;o0apx  fcildfaDrmu snu0 ltnxf tydoptranei s0tetriopoodalt lictlt s2rr( p;o1tle iiciadfa umn snu)areoxf io1optraneo;t)texo(r oy1ap emfeilsfa2uax ont4tex  f3iyd m2ra( pn() etrxociy1oa elnei s trtr(r nu4lptemfvsa() 2tmu pnu4teeo f3iadfs2el(mpnu) ltoif todfa   uvs;(0sruoiopio1aptn ncslt s2rmumonu4tetnmfciatfm2ua( s u)arxnxf3tatlate uvi s)srumxopoydamte fvsa( s2ta(ront1olxn i3tldlm2rlnvo t) leoircto1faDranei;s)srur(r3iu1llt lics s)a2umxm ;t4alt if3iatlsDrluvo u4 leomocoatoaD ai i;s)t2xrim iy4ol  livs (faDtaxronu0texnii3iltfs2el( ont4arenmf iatlp ranvs;t)texo(rpnu1ape lieia(faDra( poo1opxniieild aDua(vs;u4teeomfciy1fpDraivi;s texoio3iy4alt  icsatfaDtrxmo;t0opxo i3iatfa ua(mp;t0tleoirctatlp rli i t0 rum(mpoo4lmeemfvilsf rurxrpno1apt ioeilsfs2ranvo;(4 eenir oydomDr n s s s2xrim oy1lltnmivi t sDra( pnu1aeenmoetld a2emuvo (4 rxoio3todfp rli i s0s2xmxo3nu1ameemncsasfs2ra( p;t4olxnmiciysls ua(von(4 eenio3tydlmtrlivi;( t2trxo3nodoptnlnesat srtmx oot1alxnif3tytls2eluvs;(0tetnxrctodfate ieils  rtrxo3nu1apt mivs (faDrmumpnt4tlx ioeiyt mDem(vont4texrmo tatopDrlieols)srtoxm3iy4lpen ictls a2trxroot0tpeomfeiydlm um(vp u)tlxoir ootfaD anvsl(0 exo(mpnudolee nes t)arta(mooo1tpxn ictadlaDum(vont0aexomf tatfaDe ueo;(0texmxopio4apeelfvta()srurx oou0ale  f3tatlsDrlumo u)areoxr ootlpDrlu ol(  rtm(mpoo1lpeelnctltfaDtm(roou4alxoio3ild m2eauvp () rtrmfcoatop rluvilt0srxm(mpou4ol e ieiatfa2rruront4aet ii3ils a uanvo u4aeeomo oy1lmtrlneol( seto(m ou4lp nmieia(  rtm(  nt0alto ociysfmDeanvp;(0areoioctodlmD lnvo s0texrim oy1lptnlncta(f 2umuroou4olx  octad mDra( onu) leoircoa1fatr i ilt trxoirpnudom elfcs sf 2rrxmpot0oet  fctld s2uanmo u0aleoxr ia1la  ai s;( texoir no4al  lncilt)aDumump;o0olenmieilt a ulnvsnt) leoif iodoaDe u o t trxoio3oudamt mneiltf rrmxmpnt4oetomieiaslm2ranmon(0trtrmrcoydfa rln o s)tetmxm3io1alt  ivsatfs2rmum oo0aptn f3tltfmDuluvpn() rtnifcta1omD anesl(0srto(opou4ap emnvtls)srur(ro;o4aexoifetyd m2ra(vo (4tlxnxr3ia1faD ln i;()truoio3nu4amtn fct t)aDtaumpno4tpen i3iytfmDrlumon()tetrio iytop eluvi s)trum(m ou1al   fct tf Dtaxrp;u4alenii3iad sDrm(mo;(4arxrir tadom elneilt teurimpoydomt  fcias s2um( p;o0apen i3tatlaDelump (4altoxo3oodlaDeli ils0trtrxm nu4optn nvt t)a2trx p;t4aeenifeiysfm umnvo;t)arermo ta1om rln ol( trxr(rpno1lp e fvsas srum(mp;t4aleo fciydfaDua( p;()aetoio3oydfmDr neo;(0 2uoxo iy4apt mivt (faDtmu  nu4tetomf3iasfm2uauvsnt4teerif3ta1lat ai ols)sexrir3oodol nlict t) rtmumono1apt ioetadls ul(vo;(4texomo3oodoaD aneo t)texmio3iudam  mfvsl()a2rauronu1tlt ii3tat m2umnmont4artoirciatfp r u i s texm(o3ou1alen ncsas aruaump;o0tpenmfciatlsDulu o;(4trerxrcia1fat ln olt)seur(m3iy4omt livilsfaDuru p;u1alxo iciltfaDeln pn(4 lxnxo3oodoatrlu o ( s2um(m3nydaptelnet sfsrrmu  nt0texnmictatlsDum( p;u)texoif3tytfa ranvo;s) rxrxr3io1ameemies tfsrtr(mo;u1opxnmf3iyt s2eanmo;(0altnmociatfpDeaies ( sruo(rpoy1alt lncsls  rurxm ;o4tpeniiciltfs rmu ont4 eerxr oa1lpDe nei t0trumxm3nudameeliet (  2ururono0teeo i3tyt m emuvs;(0altomrcio1fpDrlivilt  2uo(rpou1lmtn ies (  Drmxmo;t0aee ioeildla ul(vp;()teerxo ia1fmtelnvils0 euoio3iodlmt lics () Dumuronu0opeomiciltfa emuvs (0alxomo tadfatelu s;s  rxoxo iu4olenmnct ()artrx o;t0tptoioetltlmDeln s t4 lxnxrcoatlptelnes;(  rto(o iy1omen ictl(fa2urumooo1aeeniieiys sDeln o t4teermr3iodoaDe neo s0setrir3oy4omtn ietasf 2umx  ;u0openmf3tytfs2ea(msnu)aetrio oatla e neols teur(o nu1ap e ivs s s2rmu  nt1aex iieiatlm2uluvont4altoio3oa1faDrlivs;(0tetriopny4lmtemnci t) rrauront4aee  ieiys mDemumo ()teeoxo tydlp rln sl() 2ur(mpiy4amtn fcsasf 2umu pno0tlx mfeias s2uau ont0 rxnmociodfmDrlieols  2umxrpnodalt micsa(f 2tmx o;u4alx mieiyslsDulnvp;t0 rxnif iy1lm eluvi s0t2xoio nudomtn fci () Dumuronu4aeeomoctyd mDrau o;t)texoifcio1fatraueol()seurirpoy4oleelfcsl() rtmu  ;u4tpe mociadlm ranvsn(4tlxrmr3iytfm elies;( t2uoxo ny1apeeliesatfsrtmurp;t0opx  i3tyd m rl( pnu0texniociatfmtran sl(0 2uoxmpio1omt lnvsa()sDra(  ot4teeomoetadfs ulums u4texnxf3oy1oatelu o s0sexmxopoydlmtnliesas srur(  ou0teeoio3iatlsDran p;t0artoxo3oo1oaDr ieo;s  rumxo io1om elnct t)arumump;u4optn oetat m2rau p (4tlxnmr3totopDean slt0setoxopoo4lm   nciat)aDrmx  no0opeoiictadfmDel(vo u)arerxr3iydoa  lnes;t) exoiopoy4aptnlieia()a2tm(  nt0tlt mf3tlsfsDeanms t) exnirciotfpt lieilt0 2tmim3ou1lmt mfeilsfs2trur ot4opeo octyslmDrmnms;(0 exnir3oo1optranvo s)t2toxmpiydale mies (  Dta(mp;t0aeeoioeiad m umnmp;() ltomrctydfp eluvil( t2xo(o nu1amtnlnei s srumx pnt1tltomf3tldfmDeanvo (4alenxf3iydopDeaues;t seto(r oodomte fcsltfarra(rpno1open fciadlm2eauvpnt4arermo oodop raieo;( sexrio no1lm emnviltf Dtmx onu1oetomoctlsls2um( pnt0treoir3oydop r ieo;(0 2tr(m ou4opt lieiatfa2rr( o;u1oee iieiasfmDrluvo;u0aeerifcoy1fa eanvi s0s2tmxmpiy4opt mnet tfaDuaump;o1oeto oeiadfs ulnmpn(0tetoio tydfatrlivi;( setrim nydam e fvtltf Duaxrpnt1oexnmieildfs uauvp t0 lenxr3tatfmt  nes;s trxmimpoodoltnmfeils sDtrx oou0oex ioctaslmDean s (0aeeoxo3iy1omD au sl( sexmiopnydal elncsas  Dtaur nt4aleniictys a2ea(vs;u4tetnio iotlp  ai o;(0 ruo(r3no4lp n ncils a2uau  no1oet  feildfaDeau ont0 eerxf oy1fpt lieo;t0sruoxrpny4ome mfct () Duru ono1tpxo feiytlm rl(msnt4tlxrmo iodfmtr ieil(0srum(o3io1lltemfcsas)s2trxm ;u4open i3iasfm2rluvpn()arxrmo3tydop r uesls truoxrpno4lpt  fesl() rrrur ou0aeenioctyt a2elnmp;t4 eeoxrcoytfpte neo;(0srur(opnu4lp n fesas srum( onu1tlt io3iytlaDrauvo;(4trtnmr3oydopDeaieols trtmxr3oy4ll emnvilt  rrrx  ;t0oeeoifetldfa2ulu o;u)trtrir oa1fpDranes;t) rumxrpiu1apeemnei s)srrr(rpot4apx  ictltfa uaums;(0 exoif io1fat lnvo s teum(opiy4lm e net ( sDurxmpou4aeenmocild aDeluvp u0alerxrcoodlpDelu o;( texrirpoy4lmt  fcta( srtaumpno0tlenii3iad mDem( sn(0 exoxocootoateaiesls0 rtm(m iodlmtelies t aDur(mo;o1ole iietat m rl(mp;(0artnir3oa1oa elu il(0trtrxm iy1om emfvta(  rrr( pno4oleoifcilslaDean o;()tetnxr iytfa  lieo (  rum(m iudlpe  fcsl(f rrax ont1texo feiys m2rlu s;(4treoir tadlm e u i t  etriopny1opee fes t sDtr(m ot1ape ioeiaslm uluvp u4 etoxr3oa1oaDelueil() eurio3io4lltn icils) 2ra(ronu1alt ifciydfa2ul( o t4 lxrmr oytla eluvols0seurxm3ou1ap nlfvi s)arum(  ;t0oee mfciadfaDrm(vp;t) etoxfcty1fate ivsls sexoimpiudop  mfcilt)arrmxroot0oeeo o3tldfm2ulnmsnt0 lxnir3io1fa   i o (0 rxr(mpny4oltnmnvta()aDurx p;t1aexoiociasfa2el(von(0 rxnxo3ty1lmDeaivsl(0sexmxo oo1aleelnvi s) rraxmp;o0olt mfciltlm uluvs;t) exnmocia1op raueo () ruo(opiy1op   fvias) Dumu ono4apto ietydlm rmn ont)trtnmo ty1lmD  uvslt0 2uoio io4olt  iesl(  rrauront4tlenioetls aDum( sn(4texrxf iydlm eau s s  rtmio3nydap emfvtltfa2rr( oou1apxn oeiatlaDumnmo u) ltrxo iatoptrlnvs t0 2uoxm iy1lp nmncils)s2rmxm nu0tpx micildlm elu onu4 exrxo oytoateai i;t) 2toiopoydlpe mnvia()a2rm(rpou0optoiictld s uanmont4 lenmrcoy1fp  li ol( srumir3iu4lpte ivi t srtr(r nu0tpe ifetldls ulnmpn(4 exoiocoatlp rauvo t t2xoxmpnudopen ictasfa2rr(ro;o0teeniicilslaDrau s t)tleoif3ta1opD anes ( t2umxmpno1apenlnetlt)srur(  nt0opxnifctlsfm2emn o () eenxo oydom e nes;s seuoir3ny1ape  neslt)srtaxrooo1alx  icildfa2umnmp (4 lenmr3oatlmtrai ol()srumxo iy1opt  ivta()aDtrx pou1tlt  i3iydlmDelu on(4tltnifcta1lm rai s t0s2xoio3iodam nlivs ( artrxm ;o1tpto octaslsDel(vo;t4 ltrif iy1omtrln s;()texrxm3iy1opeemfcs sfs2uaxrpno4aptn f3ildfm rlu onu) eenxf3todopte uvslt trtmxr iy1altelics t) Durxrp;t1teeomfetadlm umn p;u0areoxf todlp e ivs;(0 etmir iydllt lncias s2tr(  ;t0olenmoeilt s uln o;t)trtnxocoy1lm rlnes;s0 rxrir nu1op elfeil(fs2tmumpoo0openio3tltfs2rlnvp;(0 ltnmocoytom rlivs t srur(r3oodam nliei tfs2rrxmo;t1tpt  oeildfm emn p;(0 rxomocoy1fm eaneolt0trto(m iodll n nvia(f 2tmxr nu1ole mfeiyt m2ulu snu) ltnmfciodop eauvs t0teuoxo iy4oltemfvsls) rrmur ot1aeeo i3iytla2uln p;u)trermf3oytfm   n s;t)t2umio iy4omee iei t  Drrurpnu1tlxo ictlsfs2elums t0tlxrmr3oa1lmDe nvols0t2xoxr nodlpt mieiasf 2raxrpoo4aet iociasfaDulu o u4areoxfcio1oaDraues;(0 rum(m iu4openlfvs (f 2rmxm oo0olto icias sDrm(vsn()tetnxocoydla e ies;s trxrio iu4om emfeiat)sDtr(mp;t4altnioetatfa umnvs t) rtoxf3oydlat aueols)t2xrxr nydoptn ictat sDumuro;t1tlxn f3ilt m2uaums ()tlxrmocty1lp r iesl(0t2tmio3nu1lmeemnvt tf Dtm(  nu4olenioetldlaDuluvs;t0 ltnxr tatlaDe uvi;t) rurxr3ou1lpen nvtltfsrrru pou4oet mf3tatfm2umn pn(4 leoio ta1om eauvs (0s2tmxrpnudom  mnvi ()sDra(m ;u4oleniiciadfm2ra( s u) rermfciytlmDrauvsls0 exrxm ny4omenlieilt s2rmur ot0ole if3iytfm ra(ms;t) ltrmrciydoatelieil( trumxm3io4ol e feiat  rrmu  ot0altoiietytls2elumsnu0 rtomo3iytlptraneo;()s2xmxrpnu1llenmfcslt)a2taxmp;o1olt  iciydfsDrlnmon(4altnmr3tatomDean o;( trxrxr3ny1opeemnvt t)srtrxro;t0olto fciltfsDranmp;u)trxoxfcootfpteaueslt0texoim oy1llt  fvsl()sDumum ot1opt  ocilt m2rm( pn(0tltnio tatfmDrln s;s  etrxr3ny4lmte neil()a2ur(rpoo0altnmfetysls2uanvo;u)aexnmfctodoateaivsl(0seto(rpnu1lm  lfcs s sDtr(ro;t4oetn fetldfs2el(vp u0trxnmf3tydopt ln s s0texo(m oo4lm  mieiat)sDrr(r no1oex  ociytlaDea(vpn()tlxoxf3oydfmD  nvs ()s2xo(o3iy1lpe mnctlsf Dur( ont0tet  oeiasls2emnvon()aetnio3tatlate nvsls  2tmxopiodlp   ictl(f rurumpoo4tltn ieilsls2emuvp;t)aexnmrctytoatrai i (0t2xm(m iudamee ies ()arum(rp;o1aptnmo3iytfsDranmp;t)trxrmf3totoat  nei;s0t2trimpoo4olee fvtls srrmxro;o0oetn fetatlaDrmu p (4alenmrciydfp r ieo;( tetm(m3no1aptnlicia(  Drr(mo;u4oltnmoeiadfmDulnvon() etriociatlpt  ivs;t0 2to(mpoudole lncsa(fsrra(rpno1tpeo feiltfsDulnvp;(0artrio3iadfm  lnesl(0trxmxrpoudaptemiesl()s2rr(r ;o0aee mi3iad s rln onu4aexrxrcoodla  lnvs s)s2xm(m3nydlleelnvi s  2rrurpoo4tpeo iciydlm2ra( p;u4 eeoxo3ootlm rlnesl()tetmirpoy4omeelfctat)sDrrxm ot1oexnmoeilt m2el(vont) ltnxo oytopDe n ils t2xmxmpny4opeemfcias) ruaxr nu1alxoioetlsla2elump;u4tetoio oytfmt aiesls) 2uoxm3oydlp  mnetlt)sDrax ooo4teeomfciydfmDul(mo u)aeeoircia1lp r uei;t0s2uoxo nodll  micsa(  Durx  nt1tleomi3ils m rmuvpnu4 renxrctotlpDranvi s) rxrir oo4oltnmfvs t)aDtaurpnu4tlxn iciltfsDrlnmpnu)aetoxo ta1fa ran s;() rurim3nodape lnes s aDurx ont4opeo o3ilt s2um(vpnt)aleoif3oydfmDe uvilt  eumim3oydam  mfei () 2uaxm nt4aex mocilt aDem( o;t4areoxrcoytfmtr iesls0 rtoir3ny1am e fvias)sDumxmo;t0alx  ieiyt a em(mp t)tetnxrcoydopDr n o;(  exm(o3nydlpe mnvi tfaDraurpnu1opx ifeiatfmDumnmsnt) lerio oatla raueo;s0teuo(r iodaptemnvi sfsrtrx pnu1teeoif3iyd m em( o u4 leoio3tytoaD au o (  2uo(r3nudal   fei t) Drmu pot4oetoif3iysfmDrmnvo;u) renmr ia1oaDrlneo;s0 eurxr3iodom emivt s) rur(ro;o1tle  o3ias a2um( pn()tlxnmf tatfpDr i o;(  2umiopny4lm n fvils a2uru  ou0tlxnifciydlmDranvs ()aexomo totoatrau slt0s2um(m3iy1altn nei s) rrmxm oo0ale  ictlslsDrlu s;u4 lxnio3oodoa  li slt) 2tmiopiy4alenmivs s) rrrxmoot1oee io3tltls2rmuvonu4trenmf3totomD aneolt)t2urim3nudll nlneias a2rr(m ;o4apxnmoctytlm2rlums;t)aeenir oytfptrlnvs;t t2uoir3no4alt mnctat sDtr(mont1aexo fctad sDul(mp;t4 lxrir3to1faD  neols)trto(r oudol  mncsls artaxroot1ole  i3tltfs2el( s;u0treoiocoodfpDr ieo;t)trumio ny4ol elivias aruauronu1tlt mfciltfa rl(mo;(4 etnmr iadfm eauvi;()s2xoxrpoydamtemfeiatf 2umxm ot1alx if3iatlsDuauvpnt4 etnmocoa1lp e nvsls0 eum(r oudlm emiei t s2rrx pno0alenio3iad s2emuvpnt0alxoif3io1opDe ivo t)s2umxo3ny1ll  mnvtlt s2um(m ot1tex mo3ilt a2rmnvpn(4 rxoio3ootfa  lu o;s)s2tm(mpoudaptnlfcs s)s2urxr nt0texo ociadlaDuluvp;u)tlermo iy1opD aieo;s0trxo(m3ny4om   ivtl(fsrurxr ot0ape  f3iad a2elnvsnu0 eerirctytoaDe n slt)t2xo(m nodlptnlfcslt s2rrxm ;o4optn fcils mDemnvo;u4artoif oa1oatraieo (0trurim3oy4ll  miei t)sDtaum ot0tltomf3iydls uan pn(0 eeoiocty1omt li i;t)trtr(o iu1lp  mfvsls)srrr( pnu4aetnmocils s eau s;u0texrio3ty1oa  aneols  eumxopoy4lme mieslsf 2ur(mp;o0tpx  o3iltls2ean on(4aeerio oo1oaDrai ol(0srtr(o ny1lmtelfvtas)a2uax  ;u0oexo i3ias a2ulumo;(0arxoxr3ia1laDelu sls)trxmxrpoy4llee ivsltf 2um(rpot0aexomietlslsDuanvp;u)artnmf3oy1fpD livo;()srxoim io4apte ivt s  Duaxm no4tlxo ociyslm2ran p (0aexrirciotomtrlies;t0srxrim3oo1al n nvils) Dumx  nu1apt  ociatlm rmn s;t4 rermocoodfa r neo;s0s2toxr3no1om elict sfs2ua(rpot0ape ifeiydls elu on()alxrifcoo1fa  au i t0 rxoir3no4amt  nci t)arra(monu0opxomf3tydfaDum(vsn(0tltrmrcoatopt  ueo;t0 rur(opoo4lptemnetatfaDumur ;t0tpxn octytfaDrl(vp t0tetrio oodomt  nvo t)seuoxopiy1opte ivtat arrax pnu4olt ii3iatlaDrauvp;(4altrxf3tatlaDeli i (0 eur(opio4am nlnvta( a2rr(mooo1aptoiietatfs2eanvp (0 renif ty1oa eluvi t0tetr(m ou4lmenlfvtatfsrurump;t0olxomieiydfs2uau snt)artrxr3todlm  luesls seuoir ny4apenmivsas artmumo;u0oet moeiydls2rluvo ()aeerxo oadoat  nvol( s2xoir iydlp  lncta()sDur( p;o0tpe  o3tldfm2ranmo;t0aeeoxfctatomDe nei;s0s2xmio oydamen fvia()srrrur ;u1olxnmoeilt s rauvs t0 rerifciodlaD  iei;()setr(o oydomtemncsltfaDuru o;t0teto ieilt mDrl(vo ()aeenmfcootop rln s s setoimpoodop elicia() 2tru  ;o4aeeo iciysla2umnms;u0 ltrif ty1fa raneols teuo(mpno4op  mivtls srua(rpnt4tptn o3iadfmDeauvpn(4 ltnxr3oy1om eln s;t  ruo(mpno4altnmfeta() Dua(moou0aleo fetytlmDeanvs u) lenmfciatfateanei;t texoxmpnudapenlneil() rtaxro;u4tpeomieiad sDeanms;()tlxomo3oo1fmt an ils t2umxopny1alee nvtasfsDraump;t0tle  ictas a2rlnmonu4texoif oy1oatr u o t)t2um(r nu4am  mncsas)a2rm(ro;u0teeomf3ils s2ranvs (4 exnmf oadfpDran i;t) rumxr nodapee ictatfaDtmxr ;u0optomietls s um(mo;t)tlxnxocta1opt  neo t tetmim no1lltnlfvtat)sDraxrpou1apxn i3tltls2elnvpnu4tetnxo ta1op  lueo (0trtrxo ny1olenmfesas)aruax pou1aexo fctadlmDean p (4 etnmfcootoaDr uvo s0sexrxm3nu4ame  ieias  2umump;t1oetomieildlsDul(mon()arxoxfciytlpteanvol(0s2xrxo no1apt  fcs ()a2um( p;o1tlxoioctysfaDeanmsnt0 rtoxo tydoaDe nvs s)s2xmxmpoo4altn icil( srtaum ;u4apenii3ildls2um(ms ()artnio3oadfmDrluesls)sexmxopou1lp  mnvtlt)a2umur nt1opx mf3iydlsDum( s u4arxoio totoa   ivs s  etmxo3oo1ole  iciltf Duaum nu0oeen iciydlm umnvp t0areomf tadlptr i ilt srxo(m nodolte nvsas) rrmxmo;u0teeoiocilsfm2emn o;(0tltnxoctodlmt ln s;t0s2urxopnudamtn fesa(  Durxrp;o4ope ifeildls rlu s;u0tlxriocia1omDean i t) 2trxo iu4lmenmfci s s2uaxrono4oex mietys s ulnmo;(0artrxo3oydop e nei s)tetmio3nudole mfei tfsrumuro;t4altnmf3tlsfs umn p;(4tleomo iydom ranei;s) exrxmpou1lp nlici s aDrr(r ou1aptomfetaslm rluvs;u) ltoir oodfaD an s t setrxmpno4lmenmicil(f rtruro;t1tlxn f3iydlmDelnmon(4 etnxf iy1fp  au s;s0 2ur(o3oudome lnvs t aDtmx p;t0oltoifciydlaDrlumo u)aetnir3tytlmte ivs;s)tetrxo iu1amtn ncsl() Drmxr ot4oetnmfcildfm ul(vp (0 exrmr iotlmDr u ilt t2to(mpio4amt mfeil() Dtrxm no0tleomfetat sDel( o u) lerxfciytfm  auvs;s  eumxr3oudam n ivtls  rumumo;t4ope moeiyt mDulnvo;t4 lxnxr ty1fptelu s;s s2umio oo4ale  ncs sfs2umxm ;u1oexnmf3iys s eluvp (0 eermo3tadfpD  n i;s)truoim nudoptemivt (fs2ua( oou1aptn ieiadla2um(vpn() etrmo3ia1fp  anvils srxoiopoudom nlicia( s2trump;u0olt iociatfsDem(mo (4tlxoio oadfpDe nvi;s) eur(mpiudapenlfei ( arrrxmooo4oetnio3tyslmDumn o (4arxrio3tatopDrlu s;t0 rtoxr oo1ap emieta( aDraurooo1aptomoctltlm2ulnvo;(0 rtrxo3oa1fpDrai i;(  2urxm3iy1ll  livt t)aDrmx onu1tetoif3tadlm2ra( s;(4texnxrcoo1lpD li i ()tetm(mpno4ame lnct tfs2uru  ;u4tltnmoeiatfs ea( o;u)alenio3iodlatrlieo s s2xrir3oo1aptn fesatfs2rrx o;t1tex mictaslm2rlnvo;u0trtnmf tatop raieo s teumxr3no4optnmnct tf 2trump;u0teto oetatfa umuvs;()texomr oodfmD  u ilt)s2to(m3iudopte nes s  2rrx o;u0tpx  ietysfa2raums;t0treoxrciodfaDrai o;t0t2umir3ou4ale  nvtltfa2trumonu0tex mfctydfaDemuvon()aleomo3tatfa  luvols0srtoio iu1ap   iciat aDuaxmooo0tpe  f3iatfs2ul(ms;t0tlxomo3oatlm   ueo;t  exmxopnu4ll  mfvt sfaDumxr ou0oetoifetasla rlu p t0altomocoo1om  ln o;t0 rur(mpnodllen ics (f 2rru  oo0texo i3tas s2emnmp ()tlerxo ootlaDrlu s ( t2trxopou4op e fvt tf rrrx  ot4oet mi3iyt s2rln o;u0 exrir3oa1omDe ivo ( srumio3no4omenlfctl(f rtr(moot4tetn i3ilsla2emuvonu) rtnmo oy1oatrauesls  rtmxo nodol e fvi s  Duaxrpoo1apxnioeiad sDea( snu)aexnif iatla eluei t)setoio3iu4ll n fctlt arur(m no1oetomiciltfsDuanmo;(4 renxociy1oat an o s seuoim3oo4aleelfvs sfs2uru ooo4aetnmi3iydlm2el(mo t)texnmr iydopD ln i;s sexoxo ou4ame lfvta(  2umxmpno1tltn fciytlm2ulu ont4texrxr oo1opDeaueilt sexo(rpiudlleelnetat)a2rm( pou4oltnmf3iltlsDuanms (4 rtnxfcty1faDeau o s0srxmxo oydol n icta( s2rmur ot4apeomocias m2uln s;t)tlxnxf tatom r nvi ()setmxo3oudalt lictltf rrmxm nt4alt iiciytla2ul(ms;(0trenmo oytoa  au i t) eurxopoo4lptnlnesl()s2tmxmpno1apxomf3tysfm ulnmp;t0artoxocoydfp eanes ()truoio nodolee fesltfsrrmumo;o1texnmoeiasfm emu ont0arermr3ia1op ran ols) 2xriopoy4alte ivi ()s2umumpnu0apxomoeiyslaDrl( o;u4trxnif ootfaDe nes t srur(m oo4ap   nesasfs2uaumo;u4ape  oeiytla2uanvsn()aleoir3ootlmD livi t0 etoxm3nydlpeelnvi t  rrrumono0aptoioetys s rmuvp;u)arenmr3oy1omDrlivolt)trumim iodope  fvta(f rraumpnu1tee  o3iadla2em( p;u4 etomocoa1lmte uvs;t  2umxr nu1aleemietls) ruau ono1oexoifeiad m rluvsnt4 lermfciadop r ues;( t2xmxo oy4altelfcs s s2uau ont4olt ifciasfm rauvpnt) lerifciadlaDrai i s srurim3iy4lm elieiat  2tmumpoo4aee iiciatls em( p;u0tlerif to1fmt  ivi t) rurxr3oy1amt mict tfartr(ro;o4apxo iciaslm2umnvo;() rtoir iatop rluei;s seumxr3nu4olenmfetasfs2raum nt1tpenmiciadls umn p;(0 eeniocoodfm   n i;s0srtmir3ny4olt lfcs tfaDtr( o;u0apx mietlsfmDean s t)aexoxr tytomt  uvo;(  2ur(m3oo4lmt lictlt arrr(ro;o4alt iociyt s uauvonu)trenxrctodomtrai o (0 rur(rpoo1olen neta( arum(rpnu0tet ifeiatfa elnvs ()arxoircoadla rli i (0 2uo(r nydom nliei ()sDtrx pnu4aet mf3iydls2rl(vo;t0tltnmf3oa1fa elu sl(0 euriopiodlp   nvilsfsDtmx pou1apxnii3tad s ranmpnu)teeoxo oydlm  ln s t0 2ur(opny4ol nlfct ( sDtmumooo0oetnmfctas a2emn s;u0altomf tatlmtraivsl()t2xrxo io1om   ivt () 2taxrpno4aee  fciatla eau p;(0texnmo tadfmt aueolt) 2xmir3iu1altnmfci t sDumxm ot1teeo octyd a eln on(0trxnxr3oytop eli sls t2xmxm3ou4lpenlnetatfs2uax oot1tpxomf3tls m eau s u0 lxoif3oatlpt ln s ( trtoio3ny4lmtelfeia() Drm( ont4tpe ioeiasfm elnvo;(4alxnmr3ootla rau s;s0 rur(m3oy4lltn fesls)srta(rpoo4teenmfeiadlmDea(vs;u4texrif3io1oatran o s) 2urxmpio1lm elici ()s2ra(  ot4olxnii3iatlm el(monu) rxnmf io1la rli s;(0t2xoxmpou1lleelfctat sDtau p;o0tpe mietasls2uan s;(0altoxr3tadfm r u ilt)srurxmpio1apenlfvi ()s2rmxmonu4oexnii3ias aDua(vp ()tltoxfcoodomDeluvo;t s2xo(m nu1lptemfctlt s2trxrono4tpenif3ilsls rm( p (4 exoifcoytla   n sl()seumxmpoydom e ivsat) rraur ou4tltoio3ilsla2eaumo;t)arenmfcia1om   i i s  2urim iodomeelnet t) rrr(rpnu1aex mociyslsDel(vsnu) ltnmo3oy1fptr ueils0srum(r3oo1op emnetas arraumpot0oeeoioeiadlm ulu s;()tlenxo3iatfptrluvslt trumim ny1lp n neia( sDta(m ;o0tle ifcilsfa uau p;(4 lenxrctatom rluvo (0srxoxr3nudap nmnes sfarum(mono0tle  ieiad m2ulu o;(4tetnif3ta1fm  aivo;t teur(m nydomeemfvsat) Dra( o;t0aeenii3ilsla2rm(vs;(0tleomr3iadfaDraivi s0s2xrxmpou4lm   nes t  rtau  ;u4aetnii3iysls rl(mo;t) lerxrctotfm e uvi;s0s2to(r oy1ll   nci ( srtaxmoou1oeenmoeiasfa eau ont0altoxfciatomD ai o;( seuoir3iodap   fvt s) rrmx ont1olen i3ils a2ul( o;(4 ltomf3oytlat anesl()srtr(m nodlmte ncs s sDuaxmpot4olt ioctyslsDrau p u0artrxo3tytoaD  i ol()s2uoio3iy1apte fesat)srrmx  ;u4apxomfeiat sDrm(mont) eenirciatfmt  neo;s)tetmxm3iy1ap   nvi (  Duaxm oo1ope mictytls el( s t4artnxf3tadfa  aivs;t)trurxo nodol n icsls) rua(root4opx mo3tldfm elnvo;() rerxo3oodfmtraneols t2xmxo3nodlpt mfetat)aDtmxmpou0opxoioeiad sDrl(vs u)aeenxocoy1fa rlnei t)trtrxm3ou4ll nmnviatfaDtmump;u1apx mictat aDelnvo (0artoxf tadfm rlieslt  ruoxo nodlm n nctltf 2rmxro;t1oltnifeiasfm2rluvp;u)tlxoifcootoaD aiei;s  2uo(r3nudal  lnvilsfs2taxm ot0tleo f3taslmDelums;t4 eeoxo ootla  aivslt0t2ur(rpio1lm nmfcil(f rtax pot4texoio3iat mDul( o;(0 exnmr io1lmte i ils)trtoirpiydlp  mnctat aDrm( p;u4ope mo3tls a2ulnmp (0 lxrmrcoodomte u il( t2ur(m nu1optelicils)arrr(r no1opt moetys s emu o t0 leomr3oatlmDraneo;s0 exr(o no4al n ieiltfsrum( p;o0opx mi3iltfs elumsn()aexnif3oodomtr uvs;( trxm(opio4alee fvil()s2ur(m ot0optoifciys aDemuvonu)texrxo tatopteaues;s srxrxmpio1olen nvtat aDrau pnt1oex  i3tytla2ul( o;(4aleomo iydlaDrluvo;s0 eum(r iy1am   nes t) rtmumpnt1aeto feiydfa2umuvo u0 eeniociatfat  uvi t texr(o3no4amtnlncta( aDrmxrpoo1altn feildfa2umnms u4trtoifcty1opt li s ( texm(m nydoleemfct sfs2tmu pou4aleomiciydlsDumnms;()tltoirciydop eaivi;s0setmio3nodapeelneils)a2umur ot4apxoiociyd a rm(vs;(0arxnxf tadlptr nvsls0setoim iodlmtn fctat aDra(mo;t0oex  feilslm2emuvont)tlxrxoctadla raneolt)srumxm iydopen nesat srua( o;o0oexo f3iydfm2elnmont4tlxnmf iytfpD  ivo (  exmim3iudol nliciat)arrmx  ot0oetoifeiasls2rauvs u0 ltrmocoo1fa   ieo t) ruo(opio4ope liciasf Dumump;t0aee  fctys m2umn p (0 ltnmo iodfat aieilt0s2ur(m3iy1al n fctasfaDrau ont1oeeoifeiytfs2rlnvp;(0tlenmfciadoaDeliei t srtrir3oudll elfvi (farrmumpot1tlx  o3tatlaDumnmonu)alxnmocoy1lmD au ol(  eurxm iu4alt mfes tfsrrru  nt1aet mociysfa uauvp;u4alenmf ta1fpD auvil(0s2uo(r iydlpe lnci t srrr( pno4olt ifeiytfs2eau snu)artnxo3ia1lat  nvs (0 rxoio3iu4lm nlict s a2tmur ;u4oeto f3iasfs uluvpn()treoio oy1oa ean s t tetrim3iy1llt livs s  Dum( pnu0tpt mictldlsDemuvs;t0aexoxr3ia1lptelueo ( seum(opoo1omee fcia()a2urxroot4teeomi3tasfm2umn pnt) eerxr3iytfat aiei ()texoirpny1alt  fvi sfsDtr(  ot4alt mfciytlsDrlumo;t4 lxrmfciy1lpDeanvi (0s2tr(m iy4lp nlfes s) 2umur nt1tleomoeiatla2uaums;u4arerxo3oa1fmDelnesls0 etoxrpnu4lmen nes s a2umurpou4tlx ioetltlm ul(ms;(0 reoifciytlm  auei;t  rum(o nudome  ivsat  Draur ;t0tpenmf3iyd a ra( pn()aexoxf oy1oaDeliei ()teuoxmpiodlmeemneia(f 2urum ;t1ale mf3ildls2ra( ont4 ltoxfctatlm   nvi;(0sexr(r ou4ol e nviatfarum(mooo1optnmf3tyt a2eluvs (4arxnmoctotla  auvo;t0s2to(o oodol emietls) Dua( ooo1tltomo3iad s2umn on(4aetrmo tadfpDeaivs ( s2tm(m oydlp   nvsat  Dta(  ot4tex io3iytfsDemnms (4 etrio iy1fp  anvs;s0t2uo(m nodolt mietat) rtaxmpno1aetomieilt m umu p t)tltomf ia1lpt  ues (0sexmirpou1op  miet t aDurxro;o0aeenmoetltfs raumo;t0 rtnxo ta1fm rli s;s0sruo(mpiu4oltn ncs sfs2uau  nt0olxo octlsfs umums;u0aleoxr iadla eaueols) 2toxopnu4am nmnesls) rtm( pot1opto fctydlmDeanmo t)tleoxf ia1fa eln ilt)trtrxo oodllte ictlt  Dtru  no4oeeomociad sDemu on(0alxrxo3tytom eli i;s0 2xoxr3iudol   fciltf Dumurpot1olt mf3iysfs ra(msn(4trxrmfciytom eanes;s) 2ur(m ny1apenlnvt (  rrrxr no0olt iiciadlsDrl(vo ()tlerio to1lp rlnvs s seumxo3nydol nmfct s  Draur nt0texoiiciys aDrmn s (4trxnioctydoatr i i;s0 rtoir3nu1op e ictas  ruaxm ;t0tlx ifctldfm2eaumon()aetnmociodoa   iesl(0t2xm(rpoy4al   iviat) 2umx  ;t4apeo i3iytfsDuanmsnt4altrmo3oa1oa  ln slt)tetrxr nu1lmtemnvs ( a2ur(mpot0opxo feils sDulumo;u0arerxf3iatom rluvi;( srtr(o ny1lm emncta(  2ta( p;u4opx mfctyd m2rauvpnt4altrmociy1fmtranvi s0setm(opou4ol  lncta(f 2tm(rooo4tlxnmicild s2rmumo;(0 lxnxo3iytfa   ieo;(0 rxr(o ny4lp   ivsl( arrru ooo4tptnmocild m emumsn(0alenxf3tatopteaueolt  etoio3no4lme lfvsat  2umxmo;u4apxo fctld a2rl(von()aeeoxf3iytfat aieol(0texo(o3nudlpee ivtl( aDrr(ro;t0tlxnmfeiatfm eau pn()trxrxfciytfmtr nvo ( texoio3oudop n ivsl() Dtmuro;o4opt io3iad a eaump (4 exomocio1oatranvolt)t2xrxm nydll emnvtlt)srrrxrpou1tlt iociasla2rlnvpnt4 eeoir3iy1fptraneo;t0seto(opoy4amenlfvt ( a2ra(r no1alxo fciyt m rau o;t0altoxo todfp  lues;s)trumxr3no4om nmncsas)aDtmu  ;o4apx mi3iydla2rlnvs () eerircio1lptraueo;()sexo(mpno1lme  nei ()aDurump;u4optoiiciysla uaums t4 rxomr iatoptr ues ()truoio iodlltnmictas) 2ua( o;u0aee  feiytfm rmnmpnu)tlenxr3oatfmt an o;s sexm(o iy1lm  lfcils)a2umumo;t4optn ociatfs uauvsnu4trtomr io1lmD luvslt)t2xm(rpiodom elnvi sfaDtr(  nu4alx ifeiasfmDea(mo t0aexoio3iotom  ai s;(  2xoimpoodaptn fet ()s2ua(mono4apxnmo3tldla2eauvp u4tlxoxr3iodoa ean s;(0srxm(m3iudlptelict tfsDur(rpno4oltnif3tytlaDeauvs;t4 etoxfciadlpD  u i;s0teto(r iodoptnlfvtl(fsDrmu ont0optomictadfs2rmnmo ()aetnif3tatfate ivsl(0t2ur(r oy1amtelieiat a2rru  ;o1tex  o3iyd sDrmnmsnt4aetnxf tydlmD  u o;()s2um(r3nudlmee fctlt)artauront0apenmiciydfs ulnmp;t0alxoif iytoptrluvo ( s2uo(mpoydolen ieiat)arrm(mpno4tpx  fciat aDul( p t4alxrxo ia1fmDr nvilt0tetriopoo4apt lietls  Draum ;t0apxn i3iltls2um( p;(0 ltoxf3oatlmDrli o ()s2umimpno4op e ietltf rrax poo1oex  oeilslmDelnmp u0tetnioctydlpt  i i t  2tm(o no4lp n ietas) Dtmxrpoo1ape  f3tlsfa emuvs;(0tltnxo3oo1op eanvol(0 2um(r3oy4olenmncs s) 2ta(mooo1aeen ocilsfm2rmu p ()alxrmo iatopteliei t) rxmxopoudll nlfvs t  rtauroou4oltomieils mDrm(ms t) leoirctatfa e ivs;s)t2xmxm nudlm  lnvs t) Dua(m oo0alxoifcild mDel( s u0texnmo tadomt  i o (0trumir3iudapee feiltf rta(m oo4altomieiltfs2rm( ont)aetrmo ootfpt aies s)t2ur(opny4ol elfci () Drrxro;o0apeniieiat m ra( pnu0tltnif iodfaDr iei;( teuoxo iu1lmte icilt) rur(monu1optn ocilsfaDuln p u0 rxomr3to1oa e neol(0 exm(r iodapt mnvia()arurxm ot1openii3tytfa2rlnvs u)alerio tadfptraivo t) rtoxr3nu4altn ivsl() 2rmx o;o1apxn i3iytla2rmnmsn(0aleomfctodoatelivo s teur(rpiu4alen ict tf 2urx ono0ale iicilsfsDum( p t4aexomocoadoa r uei ( srxoxopiydapeelfvt s)arurxr ;t4tpx mfeiys aDemuvonu) rxrxo3iytfm e ivo;(0 eto(r nu4lltn fcia(fsrtmxm no4tpe ifctys a2emu ont)aleoifciadoaDe iei;(0 rumim3iudapee iesa( aDtrum ;t0tptomfciasla eanmp;(4 exnmocoo1fateaues t0tetmir3nudom emncsa()a2um(rpoo4alxo f3ildfmDel(mp;t)arxoio oadfpDeai ols  rxo(m iudlmenlnctatfartmurp;u1optomiciytlsDeaumsnt4 exrxfcoydoaDr iei;t t2xrim3nodopenmfeia(  Dtmxmono0tleo ictat s2ua(ms ()artrif ia1fpD livils srtrxo nu1altemnvt s)a2rau oot0alxnmfctytfm2eanmp ()arxrxf ia1fpDe u ils)t2tr(m3no1opt mietls)artru  ;t0opxnmi3tadlm2rl(ms;t0trtnxr iatlat  nvil( srxo(r3io4ale lfetl()aDrmu o;o0oltnioetaslaDrm( p;u4 rtrxf tadlpt lues;t)trxmxmpnod
\ No newline at end of file
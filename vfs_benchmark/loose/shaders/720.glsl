@@ -0,0 +1 @@
+ivi;t  rurxrpiu1ol   nct s a2taxmonu0ole iiciytfm ran s u4alxomfcto1lateau ilt0srurxmpoo1open fvsl(f rtaum ;u4teen i3tyd m2ra(vs t0 rxrir tytfmte ivol( srtoim iydop elieias sDrmump;t0opx ifctaslm2ulnvont0altomoctydlptelnei t)t2xoiopio4lm n fei s sDurxrpnt1tetnmfeiat a2el(msn(4aexoir3iydfptr uvi t  exr(o3oydlmtnlnesa(  Drr(rpot0tpt  iciat aDuluvs u0altnircia1oa eaieslt)sexrimpiudlptnmfvsa( s2rr( pno0oexo iciysfaDumu onu0aetnmf to1fate u s;s truoxo3iu4olenlicsltfsDtau onu0aet  i3iatfm rmnvo;t4tlxomfciy1lm rlueslt0 2urir3oo1alt lnvsl( a2rm(mpno1olxn f3iyt mDeanmpnu0aeerxoctodfpt  neo s trxo(o iy1ol  mictas aDrrxr ou4ole ifciadfaDra( snu4texnio iotom e n il(  eumxrpio4amtn fctl(fa2ur(mo;u1apeomieiyt s2umnmo;()teerxf3iadop  aivo ( texrxr iy4opt mivt t) Drm(mont0aex  ietyslmDeln o (4artrirctydlmD luvi (0seumxr iu4olt liesat)a2rrxm ou4texn f3tlsfa ulnvo u4aleomocoytfa rli s t teuoio3no1llte nvsat  2rrxrpnu0texnmfctad m2umuvo;u4teerio oy1la rli s;(  2to(o nudomenmfvils sDrru pou4tpxoiieiltlsDuan pn()treoircia1laDraivs;( srxmxmpiydlpeemnesls)srua(rpnt0alt miciysfs uauvs;u4arenxo ia1faD aivols)t2tmio ou1amtemnvi s a2ur(r nu0oet mfeiytfs ra( s u)arxrmo tydlm ean sls0 eumxr oudll nlfeil(faDua( o;t1oee  ieiadlm2rlu p u) rxnxfcty1lmDeaiei t)trtm(mpno1amen fcsas) ruaxrono0oexomi3tldfa2rlumpnu4arxnmf3todop raneo;t)srtoiopnu1omeelnetls)s2ra(rooo4tltnmfeilsls emnmp;(0arenxf3iy1fmDranvo s0 2xmim3ou1llen ncils) 2ua(rpnt4apx  ociatls2raumpn()tlxnxo ta1fpDrau o;t  rum(o oo4om n fcta( a2rm(mp;o4alxoio3ias mDuauvo (0tlxoioctodlat  u s t0texoxo oydam nmieias srtrxmoou4altniieiatfsDrlnvpnu4aetomo3tadfa  ln il()t2trim3nudap  mneils)sDtmx pno1alx mfctad s ulumpn() leoxf3todfaDeluvo;() etmir oo4altnlici sf Durxmp;o0tet iictad aDul(mo u4tlxnif3iatop   ivsl( trxoxo3no1ole lieias arua(  ;u4tlenii3iydfa2ranmon(0 exoif iadfp r ies;() exoim3oy1lltelnesatf Dtmx pot4alxomo3tyt s2em(vonu4teeoxrctotomD anvo;s t2uoxopiydlme  nctls  rrmum oo1oltnmoetlsla emnmon() reomf oo1omt anvil()trtoim3no1aleelnesas sDtrxmo;o0aee if3tydfmDea(mp;() ltnmf3tatop   nvolt s2uoxr nudlle  nviatfsrurx pnu4ole  feilt m2ra( p;u) lxnmocty1fa raneo;s0sexm(m nodol  miciat aDtax  nu4tleomiciltfs2uan s t)altomf ootomt  ivi s tetrxr iy1am n fet t) rra(rpou0tpxoifcils m rlnvs;() lenmf ty1lmDrai olt) 2xmimpio4om elnvt s arrr(mpoo4aee mieils aDran snt0tetoxo totlp rauvo (0t2urim3no1opt  fct t sruru o;o4apen i3ilsfmDul(vo;u4teeomf ta1fmt an o (0setr(o3oy4amtelneta()s2umxr ot1olenmoctyt sDumuvs;(4 ltoxr todoatraivo s0teurxrpou4op n nvsa()srta(ront4opxn i3tasls2rlnmo;u4tlxoif iodfatr nvols s2um(mpou1llen ncia()a2raumpnt4ape mfciysls ul(msn(0arenmf ta1lpt aiei;(0tetoirpnu1llt lnvtlt)a2ur( pnt4teeomociysfsDuanvo t0 reoir iy1fptrauvi s0 rxoim3ou1omt lieil( aDtmx  ou4teeoifctls aDeau s t0 ltrif3oy1fate ues s)sexm(mpno1opee ictas) 2tmx pou1oetniicildfsDulnvo;t4 ltnxo3totfp r nvi s0setrio iy4om e nvslsfs2rmxmp;u1optnifctytfa2uauvonu4 lxoif3iadlmtranvs ()trum(r nu1ole  ies sf Dumxmono0oexnifetls sDelnmo (4aexnxf tydfp   ieo;s0teuo(o3nydamt mnct ( s2uaxro;u1ole mi3iyd m rau p;(4aetnxf3to1faDrluvo t) 2uoimpio4al  lfctl( sDrrx o;t4alx  ociltfm el(mo t0texomf totfmteli o;t0 eurxr3oo4omt miei t)artaurp;u0aptomociad a eaump u) exnxr iy1opDe u slt srtr(m3no4alenmieiat a2ur(rpno4texomieiat m2el(mon()trermo3iy1la r n s s0s2xrxr oo1alt mneta( sDrmx  ;u0apx mietat s umumonu)arxoxr totla e i i;t)texr(m3oo4lp elics t srra(mo;t0oeto oetasfsDumnvp;u4texoircoo1latraues;s0s2um(o iydom emfesl(faDrau poo0aptnmi3iytfs2el( onu)aeermr ty1lp rluei;t  rtoirpoydlmen iei t)s2ta( p;t1ape  feias a2rau snu4 reoxfciydfateli o t)t2urirpiy4lmt  ics t sDrrx ont4apxn feiltfaDrln o;t4tlerxr oy1fp eaueo () euo(m oudamtnmneils srtaur ou1apenifcils sDrln p;u0 exrxo oadlmDeaivi t seumir3ou1op nliei s s2rrump;o0oee  i3iyt mDem( s (4 rtnxocoadlaDrlu ol()trxmimpnudome mfeias  Dtmxmpnu4opx ifeiasfm ua(vpn(4 ltnmf oa1fa r nes (0teuo(mpou4altnlfvsa(f 2tru  nu1open oeiytla2uln p t4trenir3io1lmDelu o;s) 2xr(opiydam nmfet t a2urxr ;u4ale ifctasla2umn s;t)altrxf ia1fptraivi;t  2tm(o ny1amtnlnci s s2uaxr nu0tltnmfeiadls2ua(vs t) eeomfcoadlpD an s;s0trto(o ny4amee ivias srrmx pnt0oeeoiociltfsDemuvp t4aexnxr3tatfpDrlnes;s0tetm(m3ou1lltnmivtls  Dua( p;t0apt mociatlm eln o;(4artrxr3ia1la   uvo t) 2toimpiu1am nmnci sfartmxm oo1olt micildfs2eln s u)areomo3tatfp raueo s0 euoiopno4olt lnvsas aDra( o;o1aeenio3ils aDrl( s ()altrirctytomDrluvi;( s2um(o io1altnmnct tf Drmxr ;t0texnioctas mDumnmsn(0 ltrio3iadfpte nei t) 2uo(m no4omee fvi (  2umxr ot0aetnmi3iat m uaums;t4tlenmf iotla rlivs ()setrxm3nydamtn ncsat)sDum(rpno1tlto ieiatfs2ulnmon(4treoxr3iotfat auvols0 2uoimpiy4aptn ictlt  rtmxrono0alt mocilsfs rluvon()tlermo3oydfpte i s (0 etoio3iu1aptn ivi s) 2trurono1tee ifeiydfs2emu sn() etnxo to1fa eluvs t)tetmxmpnu1amt  ies s  2tr(ro;t1tleniieiyslmDulnvs;u4tetrmrciatfpD anvi s0trxoir oy4amtn feia(faDrr(m ;u4olxoiieiys aDua(mont4 renxr oydlm  lies;t s2xmio iy1llt micil()aDua(monu4tpen fcils m ranvp;t0 eerif oytlpDe i i ( s2uoxo3nu1lpe micsat  Drrurooo4tpe  ieiadlm umn o;(4tlxnxfcta1fat li ils  2xrio3iudole  fes sfa2urum ;t1optoio3tytlm2uan onu4teermocoa1fm  lu s s)trxo(o3no1lmt mfvi sfaDtmump;u4tlxomfetytls umuvpn()altnxf3iytoatrau o;s0srtmxo3no4lle  feils)s2ta(r no0aet  oeils mDrlumonu4altrxf iadop r n s;t srtmio3oo4lmen neta( arraur nt4alt mietlt s2um(msnu)texnmr ta1fm e ivs ()texo(m3iu1lmtemncils s2ua( oot1tpt mi3tld m eln s;t)alxrmr3oytfaDe ies;s sruo(r oo4aptemivtl(  rtrxrpoo4aee mfetlt aDel( o;u)teenmfciydfp   u il(0t2trimpiodapeemict ()srrmump;o0tle ifctltfmDranvs;(4texoxo tytom r ivi;t t2urxmpoy4ome lfeil()srraxr nu1openii3iyd a uanms;t4trxomrctydfm rau o s s2ur(mpnydop nmieias srum(m ;o0aexo ieiadfm2el( p;(0tlenxfcio1lptrai i;t)s2uoxr3iydap  mneils)sDumx  ;o0texnmf3iad m2ua(mont)altoirciy1faDrlivs ()t2toxm3ny1om emnvi s a2ta(mono0aetomoeild s el( s;(4arenir ia1omtr uvsl() rxoim3nydap emivt (  Durxrpnt4aex iieiys aDrmnvs;()texrmfctytlmtrli s;s t2tr(o3oydamtemicta(fsruru p;t4oeeomociat a uanvo t) lxnmf3todlp rlu i;(0trtrxmpoodom nmfetlt)sDrmu oot0tltn iciad a ran s;(4arxnmr3iotfpD lnei t0srtmim3nudap   fvilt  rrmuro;o1alt moctys s2rmumpn(0 rtoio oytoaD  n i;s0srum(m3io4ome miesl(faDtmump;t1alx  fcilslm2elump t)aetomf tatopDrlivi;t teumimpiudlpeemfetls s2rm(mono1apto ieiltlm uanmp;t0arxoif3oytlptelivs s  rxr(r ou4optnlneil()a2tmu  oo4oexomfciyd mDrl(mpn(4tltoxocoatom e uvils0 rxm(m3oudlpeelfvi t)sDrm(m ;u4oeenio3iytls ea(vsnt) etnmr3oydfpD  i sl(0teuo(m3ny4ole lies s) rtaxr ;t4tpxomfctld a ran onu4 lxrmo totlpt  n s t trxm(opny1omtn nesa(f Duau p;t0aptnmociyslm em( s;(0 exrmf iytlmDrlu s s0t2tm(m3oodlpte ietl()sDtmx ono0apeo fetldla2eluvpn(0 rtomo oydom  lies;t  rum(mpoydopenmfesl() 2taxmo;t1apx  o3tytlm ranmsnu)altrxfctydfptelnvil()teuoim3nodal emnvsat a2raxront4tpx moetyd a eau snt4aetrirctadoa  aivslt0t2xo(r3oo4lpen neiasfarua(mo;t1tlx moetldlsDum( p t)treoio oy1fmDr u i s) etm(r nudlpe mnvta( arra(ro;u4alxnmi3iaslaDelump;(4 exnxr oydlm rluei s s2tm(rpoy4alenmnvta() 2raur ;t4opx  f3iatlsDuan pnu)teenifctotomt lieolt0srtrio oydlleemnvtatfsDururono1aetnmiciydfm2rmu sn(4 ltnif3todlp  an o t)s2umiopoy4lpenlnei s)a2um(ront1olxomf3ias s2um(vo;(0teeoxrcoadlm r ivo;t)t2umxr3iudlp  mnet s)sDrr(m ;t1alxomictydfa rmu p;t0 exnmr iodlmD aneols) exrim3oo4ol elnes t aDum( oot1tee mfctytlm2eaump () rxrxocoy1oaDeluvi s) exmirpiy1lmtelfci s)aruau p;u1tetnii3iaslsDuau pnu4arxrxr iadoaD  uvo s0seurir3ou4amtemfeta(  Dtmxrpnu1aetomfciys aDumnvp u0aleoif3ia1om e u s (0 ruo(r3nu1olt  neslt)a2uau oou1tpt mfeiyt mDeanmp t)trtrmrctotop elivs t0 rxrir oy4aptnmiei (f rtm(  ;u0optoiociys aDum(ms;u0teeomoctadlaDr nvslt0sexmxm3no4alt  ics s)srtm(m nu4oex moctat sDulnvo u0tltnxfciydomDr i il( t2tr(rpny1lptn fctasf 2trumoou1tex  ieiad m2ua( s u4aetnxo todla   ues;s)teumiopnu1al nlivilsfs2rrxm ou4aetoio3ildfs2umnmo;(0aleomrciy1lptean slt0s2urirpoo4opt lictat)aDumxmp;u1aeto o3tldlaDumnvo;(4 eeoifciadlpDeaivs ()srtrxopoudop  mfctl( aDra(moot1texoio3ildfs uanmp;t4trtomrctatla elieols0t2trxr3nodlm e fes t arur( o;o0teeomiciyt a rl(ms;u0aeermfcoatoa elu o;() rtrxm oydal n ivtatfarua(mp;o0oltoifciasfsDelu s;u)tltoio3iadoat lnvo t0t2ur(o iodam n neiasfsDtrx pno4aetn ieiatlsDeanmo t4 lenif ty1optr uvs ()seuoir3iu4am   ivias  2tr(rp;t0aeen feias m2elump (4aeeoifciytlmDrauvi s0 rtmxopoy4opt  feils) Draurpno0oee mieilslm ul(vo t0aetrxr ta1laDraivolt)s2urimpnudap eliesls  2um(mo;o1oeen oeiadlaDrm( s;t4 lxnmrciytlaDeln s;t0sruoxr oudape  icil(fsDumx  oo4oeenmfetld s el( p ()aexrifcoodlp e i o t)sexm(o3iu1lp nmnvi tfsDtr(rp;o0aee  fciad mDul(vo (4aeermocoo1omD an o;s)sexrim io4ol n ict s  rra(mo;u1tle io3iat m ul(vpnu)alxomr3iydlm eauvolt)srumxrpoo4lle lfviatf Drmx oot0aptnmf3iatla2ua(vonu)aetoir iydoptrluvs s0teuoirpiydapen fesat a2tmx o;t4olxnifctltfsDuau pn()tetomf3iadfaDeluei;t)seumiopnu1apee net (fsrurumo;o4ole  ociytlmDeanvonu) lenio3ootoa rlues;t0t2xoxo3oy1omtelivilt)a2tr(ronu1oexoifciytla rluvsnu0aexnmr iy1oa r nvs s) eumirpiy1ol elnesa( srtrxmpot4alxn icilt a2elums t4aetrxo ty1fmDrluvsl(0 2xoxr3iydlmtelfvs (  Dtru oou1apenii3tlsfs el(vp t4aexrmr oatfp r uvo;( trur(m3oudopeemfesas  2tau pnt4tex  i3iytfa2el( o;u0tltrmr oydfptelu s t  rxrim nudameelnciasfarrrump;u0teeomi3tldfa2rmu pnu0tetrif oo1omDrlues;s0t2toiopnudlmeemnvs () 2tr(rp;u4oexoifctld a elnms;() rxoxo oa1lm  ai i;s)s2trxrpiodlptn net t) 2rru  nu1optomieildla uanvo t)tltoif3ta1fateaueo t)texoirpiu4om nmict ()a2rau  oo1ole  ictytfs uanvs;(0texrifcoy1lmD ai i;s  rtoxmpnu4aleelivtlt  Drmxm no0tpxo ieiyslmDumnvo ()altnifcoo1latr i i;s0seur(r no4aptn ictat)a2rmu  no4openmi3iasfa uaumsn(4 eenio ta1op e ies s) 2xr(m3oudolt liesatfs2raxr ;t1apxoifciysfmDuln s u0 reomo3oodlpteanei ()trxm(m io1aleelfvtlt)arur(mooo0teenifciltlm2ulnvsnt0 lxrmr tadom  auvils trxrirpnodam nlfctltf Dra(mp;o4tetn octldls2em(msn(4trtrmocoydoatrauvo (0seumxr3ny1lpte fetlsf Dtr( p;t4optomo3iad mDraums u4 leomo3io1fm elies;( srxmio3oy4lmenlfei s  Dur(r nu0apt mf3iat mDraumo t4 rerxociadlmtrlivo s)t2xoim3nudomenmicsls srrmxront1teenmoeiydfm2emu o;u4 exoir3ia1fm ean o s) 2umim3oodam e fctat  2tmurp;t1apt  ieiytlmDel(mp;() rtomf3ty1laDrlnesls0 2um(o3iudape mict sfa2tmur ;t1apxomfciysfmDra(mp u4teenmr3ty1oate ues;s seurxo ou4olt lfei ()aDrrxm ;u1aexo ieiatfmDrmu o;u0aeerif tydoateluvo () exo(o nu1amtemivi s aDumx poo1oex iieiyt m elnvs;()tltoxfciatop eliesl(  euoio oudolt  nvsat aDta(  ;o4optomf3iltlm umnmp;u)teeomf3ta1omD ai o s) 2toxrpio4lmte ies s s2rmxr ;t0tex ii3tas mDel(ms;t) rerir3iytlp   i o s0 2ur(opoo1ll emfvsa(faDtr(rpot0alxn ociytlm2um(mo;t4tleoif tytlpD aivi;(0t2uoxr io1amen iciat)a2uru  ;t4apen iciasfsDem(msnt)alxrirctydlaDeaies;s setr(mpny1lp   nvsa(fsrtmx  ot1tptomiciytlsDul(vpnu0arxnif3totlp elu s;t texmio iy4alt lictas a2umurpou1apt  feiadfs eluvpn()arenxf3totlpDranvs;()t2urxm io1am n nvs tfaDuaxmont0oleoio3tas a2ulums;u4 etomo3oydfm   i i (0s2uoimpnu4lpe lncsas srtm( ono1opeo ieias a eln snu0treoxo iodomtraivo t)s2xm(r iydaptnlivt (f Duax p;o1apxn ieiatfmDem(vo u0artrmf3iotop eaieo ()seurio ou1lm nlfctat  Dtr(rpnu1olxnmicias s2rlnms;t) lxrxr tatfp   i o;s) rum(o oy4amte fcsl( a2umx p;t4aeeoio3iytla uauvo;u0tltrmocoy1late u o t  rxoio iodap   ncs sf 2uau o;u0oeeomociadfs2umnmp;u) exoxociytfmteaieo s0t2umxm oy4apenmfcs tfsrrmx o;u0tpeoifciatls umn s;t4aexrmociadlm ranvil(0trtoxm3io1ap   ici ( s2urumo;u1apt mfctatfm um(vs;t4tlxomo oo1fp  liei;t0trtoxr3io4omeelivil()s2rm(mooo4altomoeiaslsDumumo;u0trxoif oa1la rluvol()trumxmpiu1altn nvtat s2tm(mp;t4tltomfeiltfm ran snu4 rxnxf totlpDeanei s setmirpiu4lmte fcslsf 2rr(  ;t4olto o3iyt s2emuvo t)teerxf3tatlpte i ols srxm(o3ou1apenmnvsas sDra(mpoo4tlen f3tat m2ua( s;t4alxrif3tydfmDranvo;() exrxr3oy4alt miesl()a2umumo;o0olxoiieiydfa2em(mo u) etnmoctatfptr nvi t s2tm(m3oy1ap elieias artmx p;o1tle mf3iad m umn o t4treoxr ootlp  auvilt0 rxo(m3nu4lpe  iesat aDtmurpot1teto ictld aDrmnms u) rxrmr oadlmDranvols  eurirpoo4opt  ivsls  2trurpnt4ope ifeiytlmDuaumon()aetnxf3ty1lmtrlies;( s2ur(m3io4lltelnesas)s2tmxmono1tex  f3iadfsDul( s;()aeenxr oatop r ueo s) rtmxrpoo1apte neiatfarraxm ot0apx mfeiadla2eauvo ()tltoio oo1faDrlneols trtrir3ny1am emivias  Drmxrpno1ope mfciysls2rmnvsn()arermfcoodfp eau o t) exrir oudame mfvtl()s2ur( pno4tpe ifeils m2ra( s t0teeomrciodfmDraivs;s)setrxo3io4ome lfvslt)aDum(  nt0aet io3tltfm2rau p u) etnif oy1lpD luvi;s  exmiopnodom   nvtlt)artm( o;o0oet  i3tysls2ra( o () eenir tadlat anvi;s)tetoim iy1apt mnctlt aDta(m nt4alxoiociys aDea( o u0 eermo3oytlaDe iesl()teur(rpio1lmee fct t srua(mpou4aetniietadlm2em( o t0aeenir iatoa e ivs () eur(opou4omeemfciat a2tmxr ;o1oleo fetas mDum(ms u0trtrxf oytfm raivi;t s2xmir oo1lmtnlnct tfsDuru ono0tex mieildlm uanvs ()alxrxr ootopteluvs () 2xo(o io4lltnmnesls) rrr(mpnu1ale moeiytla umn s u)aexniocoytlpt li i ()t2umxm oy4lpeemfes t  2rmxr ou0tleoii3ilt s2ranvsnu)tleoxo3iydfp ran s;t0trxmxopnu4open ivs (fsrtaumoou0aetomictyd sDua(mp (0trxoxocootfa r u i t)trumir iodamenmnvtl()artrump;u1tet  fciyslsDrmnvs t) rtomf iy1lmteauvo;(0 2xm(r3iodlm   ictas s2uru p;t0aptnmo3iydls rmu ont)trxomf iotopD  u s s0trtoir nodopte fesa()a2rrx pnt0teto ieiat m ea(mo;(0tltrxo iatom rluvo (0teto(r3oudop emncil() rraump;o0tet ioetld mDrmums;()tleniociytom rln i;s0 rxm(mpoy4al  mncils  2ur(rp;t0aptnio3tyd m rm( o u)tetnmr3tatfatrli ol( t2tmxr iydamenmies (f Drm( pnu4apeo fetld a2em( p t4 eerifcoydfpD  neils0 etr(m oodaptnmfesas  Dtru p;t4opeomiciatfa elnmsn(4aetnxocootfpDe i s;s srxm(o3nudlmtnlnvta()sDtm(mp;o0alxnif3tlt m ra(ms;u)trtnxo oytfmDrlies;t  rumxm3oy4aleelicsas)aruax poo0aeto ieiyslm2umn pnu)tltnmo ootoaD aneilt) euoxm3oodlmtn ics s  rtrumpnu0oex io3iltfsDrln s;()arxoio iytla e ieo t srtriopno1om n ivils)arrau ont4tle mf3ils m2em(msnu0 lenif oatlp rai sl(0 2xmxo3iydomtemncslt  Drm(moot1tle  iciaslsDrauvs;u0 ltrxf iadomt  ivo;s sexrxmpoudlle lfesatfartmuronu1apxo f3iysfaDumnms u0 lxrxo todopDraivi;(0s2xo(opiydop elfcsat  Dum(mo;o1aexnmieiat s2ranvp t) ltoirctytfp   uvs s0 etoxo3iu4omt liesatf Dra( p;u0tpe mfctlsla2ea(msnu)aexoiociotfa  aneo;t0sexrxrpno1ap nmnvtlt) 2raxmpoo0tlen fetadlsDrm(mo;t)tlxrmo3ta1oatr u s s  rurxo3oydaleemfvi tfaDur(rpnt0aexnmfctyslmDem( o t0artrxrcootom r nes (0 ruo(m nu4ll emiei ( aDrr(mo;t4tle  f3iasfa eau ont) eermo3iydlm rau il(0 2toimpny4llenmnvi (farraurp;o1apeomocilslmDrln snt4texriocoodlmD aivi;s0 eumimpno1lpe mivt tf Draxmo;o0aetomfciadlm2emuvo;u) reoxr iatlmte ueol() euo(m3iu1ol nlivs () Draump;t0tltn i3tltlsDul( o;(0tlermf ta1omtean s;s seto(o oo4ap emnvilt srrrxmpoo4opx iiciltlm2ran s;(4 lenir oy1lp rauvols) exm(o nydam elfcsls sruru  ;t4ole ioctld a2ua(vp t4treoif iytlmtrlu il(  eur(r oudlp  lictl(fsrtrum ;o4opeoiieiys s2rlums;t0trenxfcia1omteliesls  2xm(rpoy1apte netlsfsDtauro;t1olx ii3tadfsDraumsn(0 rxoir ty1omDeliei;()s2uoxopoodom nlfvs tf 2ur(  ;u0oeeo fciysls2rmn p ()teenxociotfmD  n o t trum(r nydopt  ncil( aDtrxm oo4oex  f3tys a rmu snu0aetrir3oo1lmt  neo s0texr(r iu1ape lneia( s2rmur ;o4tlx moeiydls uln snt)aleoxrctydlmDrluvi s)t2uoio3nodol emieil(  2ra(m nt4tlto feiltfs rmnvo t4 rxniocoadoptranvs;( s2tmio3oo4ap  mfei ()srrrur nu0tpxnioetlt m2umn pn(0tetomo3ootoat ln i;t  2xoim3iudlmtelivi (fsDtmuronu1oetomfcilt m2ul(vp u0 rtnxfcoy1omtrlu sls)t2urxmpnu4lle lfcs t) 2uru p;u0aeenifetytfs2ua(mpn()aetrxf oodfa eauvslt0teuoim3oudalee fesl( sDumu pnt4alxomfetytlsDulnvo;(0 ltnio3tatlmtr nvo ()tetmxo iu1lltnmnvslt)srrmuroot4ole  i3ild m2rlu s;u4trxomf3to1fa e u s s) exm(rpoudopt mfci () rrmxm ;t4alxnioeiltfa2ua(msn(0texrircoatlmDr uvi t  eum(r3oo4ame  neia()s2ururoou1aetnmo3tad m rlu o;(0altoxrcto1oat  ivi;s)texmiopoudlp nmivs ( srua(mpot4alx  oeildlsDra(msn(0tltriocoytomte i i (0s2urir3oy4lmenlnetlt) Drmumooo4tpxniociadfsDelu s u4alxnxr3iy1fp rlu ols) eumir nydoptnmnesas)s2um(rp;t4alx  oeildfs ul(ms u)alxnmfciodlaD ai o;s0 2toiopnodapee iesl(  2urum ou0tpx ioeiltlm2em(mo u4tlxrif iytlptr uvols) exoir oo4opt lici s)srrau pnt0tltnmi3tydfa ean onu0 exrir oa1opD luvs ( s2xoxrpny1lmeemfctl() rua(rpno4aptomoctldfa2rl( snu) rermr3totfmDrlieil()texm(m oo4lme  fvi () 2trur ;o1alxnmi3iad s uan o t4 lenxo iotfmDrlueo;(0setmxo ou4lpe mies tfaDrm(mpoo0optn i3iadlmDrauvpn(0trenxf3oatoat  i i;s)seurim no4ameemfesas) rrrumpnu1oex mf3iytfs2uau o (4arxomo3io1lp r n il( s2urxr3oydamt lics s)artaurp;o1oeen i3iasfs uau onu0 rxoxrctodfp rai sl(0 rxr(o ny4lle mnvsa(fsrtm(mpot1tpxniociadfs2uluvo () eeoirciy1fmD aneo;t0srum(opnu4lp  lnesa()srum(mp;u1tetnmfeiasla uluvsnt4altoio3oa1fp   i i s) rxrir3oydalt mfvsat arur(m no4teeo feiyslaDean snu4aexoio iotoat liesls  eur(m3nydlmenmicsa(fs2ur(rp;u1aex moeildls2umn p;(4tltnio3iytoaDelivolt0s2tmxo3oo4lm e nct sfa2trxmoou4aetoiociad mDum(vpn(4arenmr3tydlp rauei;( s2xmxmpiodllee fctasfs2tmumonu1oexomicils sDuaums;(4tetrir3todlpt an s;s  rtm(r3ny1omt lfesat)sDurx p;u4aeeomiciys sDuau p (4aeerxo iytomt aies;t0t2xrio3iydol nlfvtl()srtmu  ;o1ope io3iasfs um(vo t)arxnir3oo1la r ieol() 2tmir oydap   ieta() rurx oot0tptn ietadlm2eln s t0tlenirciydlaDelivo ( trum(m iodlleelfetasfa2tmxmoot1oleomf3iat a2umuvp t4altrxo iydfp eauvi;s0t2xoxm3io4alenmici t)s2tmu  ;o4oeeo iciaslm2eau onu)trtoxfcoo1laD li i;(  rurxm3ny4optelfvt s)artaxmp;t1aexnmoeiytfa ra( on(4arxnxrctatfateaues;t truo(opoy1lleelict tf 2umxrooo1tex ioeiys sDrm(mo;u0alxnmfciodoat  uvo ()tetrio oodlptnmivil() 2rr(m nu4olenifeiatfsDulu pn(4aeenxf ty1op e ieol(  eumio3oo4lm  lnvsas)a2tmx ont0oex mf3tyt s2ulums u0aexrxr3oo1oaDeau s t0 2xriopno1amt mnci s  rta(m ot4texomf3tasfs2eau onu)aexnio tatop  aneil(0setoio iu1omt  nct sfs2urx pnt1aeeo o3tyslaDelu o;()areoxr tytoptrlnvs;s) rtmxmpnudol nlnvtas) 2urumpoo1oeeomo3iydfmDrl(vo t4tlenmo ia1opt lues;s srtrim oydll n iviasfaDuaurpoo4ale moeiyd m2um(mo u0 ltoio iatfp e iei;s) 2uoir iu1ame mivi s)aDumumonu4tpxn fciad sDrl(vpn(4texrxo oatlm  aues t0texo(opiodlptnlfeta(f rta(mpoo0opto ictad a emnvp;t4 exnmf3tydom  anvslt0srxm(m nu1lltn ies (fsDraxmpno1texnmieiadfs eanvo t)aetrmfctatlp ran i ( teuoimpou1ale lfvi (farrru  nt1aleomoeiytfs ua(vs;t0aleoio3oo1opDrai i;t)trxm(r oy1opt lici ()aDuaumont0ape if3ias mDulnmo;t0tetniocoo1fmtrli olt0srtrxr3oydaptnlivia()srumxmp;t1aexnmo3iatlaDrmuvs ()arxoiociatlmt ln i s seurxo iu4lmtemivta()s2rrumpno0aeenio3iat aDuau ont0alxnmo3oo1lateln olt t2urim iu4ame mncia()sDrm(  ;t0tetnifeiatfm ra(ms (4 eenxf iatfa  luvslt  2urxrpiy1lpeelfci sfsrrru p;t1apx io3taslm2uluvsnt0texoir3to1fptrlnvs;s)t2uoxo3no1ll n neiat a2rau o;t4altnioeils sDemnvsnu4teeoxr oatlp ran slt  2tmxrpio4lleemncsa()sDrmu  ou4oexomoetlt mDem( ont4 lermo3iy1lpDr ueo;(0t2urxm3ny4lle mneta()srurxm no0tpx iieilt m emuvpnu4tlxrircoatla rlnesls s2toxrpiu1am nmivs t) rtrxr no0tex  ocild sDul( p;(4texniocoadlaDraieols)srxr(r nodapt mneta(farumx pot4tetnioeiysfa2ulnvo t4tlenirctadfa rau s t  rtoiopiu1amt  iesas a2tm(mo;o1olx  fciytla rmnvp;u4tetoxo ta1oaDe neo s)texoirpnodlm elivi t)sDur( poo1olt  fetytfs em(mont)teeoxo3oo1lat  nvsl()srxrxr3iy1ole mfei sfsrumx p;t0tltnmictys s2um( pnu) renmo3iydom  li s;s  rtmir3nudopee ictls  Dum(r oo4aetnio3iasfm2ea(vo;t4 rtnir3tatom  lueol() eumim3iodoltelncsat srtmx oou4texn ociasls2rl( o;t) lenmrcoadlpDeaieols) etrxrpiudalt  nctlt srurumo;u1tetnmo3tasfsDrmn pnu) rtoxr totfa r nesl()s2xrxo io4lm nlivtl(  rtr(m ;t0apen i3iysfm2rl(mp u0texnxo3oodlateli s;s sexr(m nodoleelfes t  Durx p;t4oex mi3iadfs umuvonu) etoxo ty1om  lueo t  rto(opoy1llt lfei s aDum(  ;o1aex  oeiaslm2raump t0trtoif tadopteanvs ( setmxopnu4omtn ictas)a2rmurp;t0oexniociatfsDumnvonu)artnxf3totoate ivo (0 2tmxrpoo1llenlies s  rumxr oo0apeo fcildlaDel(vo u4 rtoif todfaDrluvsl(0 exrio3ny4ap nmnviat) rrru poo1alto fetasfs2em( o u0 exrmr3oytfpD aneo s)srtmir oodap nlneilsfs2tm(r ;u1teeoifeils m2emump ()tltrmf3iodoaDrlnvilt  rtrimpnydapte ivtl(  rtruronu0alt  f3iys a emuvo t) eenmo to1fa eauei;t)srxr(mpny4opee iviat  Duau o;t4opto ietldls emums;()artnmr3iydfm eai o s)s2trio3oudll  lfvsl() 2tr(m nu0tlen fctytfaDranms;t4tetnmociotomtelnei s)trxo(r iydomen fet t) Drrump;u1aetomi3tls mDeluvp t)aexoxocto1om   ivs () eumio3nu4omeemicsls sDrr( ooo1oeeomi3iytls2uanmp;()aetrmf iatla ean ils) 2tmxmpiodamt  nvtl(farrru pot0aptnmo3iyt a2elu ont)aeeoir oy1fatelieils0 2xmxr3oy4ol n ncil(f Drrur ;o4tleo i3tlsfs ulnmo t0arxnif ty1opt luvs s)texrxmpiudameemivt t)s2tmumonu4teeomi3ilt a elu onu4 exrir iadomDr ueil( srtrxm3iy1omtnmfetl() rrmx  ;o1ale moetys m2rmuvon(4 ltnxr3ty1lmDe uvo;s trxrxopnudamt  nei () rtaumonu4aetniocias mDulums (4artnxf3oatlmt  n i t sruo(rpoy4altnlivtl() rurum oo0ole  fctydfs2ean p u0aeenif3iodfmDe ivs s) rtoiopio1omt lfvtasfaDumx pou0aexo i3tlsfa2eanvsnu0 eeoir ty1lm rluei t) eur(m iu1lpte fctatf 2rm(mpoo0apx  oeiatfs2emu o;(0aexoircoytfm ean i;s0t2tmio oy1al  livt (fsrra(mpoo4aexoif3iatfm2emn p;u0aeeoxf3tydfa elu o;(  etrxo3nu4opt  ictat sDrmx  ;u4tlx mietldlsDrl(msnu)tetomf oatoaD  uei;() etm(mpnu1lp  lnetatfa2rmumpou4alxoioeiyt sDrlu s (4tltoircoy1lp e nvsl(0srtmxo3ny1apte iesa( aDrmumpnt4tltn feilsfm rlump;()aeermfctodomDr ies t0srxrim oudaptnlnciltf 2tm(m ;t0aptnioetltlsDum( o t)tetomo iatfateauvi;(0t2urim iy4aleemfvsl( arum(mpou4ale io3iyt mDrauvont)trermoctodfp rlneil( s2xoxr iu1lpeelivsl(fsDur( o;u4tpen oeiaslmDua( sn() rxnxr oytomDeln slt)trum(opiodale lnviat s2rr( p;t0oltomoetltfs ulnms () etrmrcoatlm rli s;() rxoxr oy4al nlfetl()srtm(moot0aetoiieiaslsDumu s u)altoxr3oatlmtelivo;(0 2umxm nudomeelnci (fsrrmur ou0texniictyt s2ra(vp;u)texomoctotlmtr nvo s  rtmiopoy4lme miesas sDta(rooo0tltoifciydla2eauvpnu4aleomf3oodomD li s t) rxmim3oo4ol nmfvta(fsrururont0texnmfciad a ua( p (0teerxo oytlmD  u i s)sexr(o3oydop emfcia() 2rr(rp;o1altoii3ild m2ul(vo;u0aetoxr3oo1faD liesl(  rurxr iu1llt  nct ( a2rmuroou0aptn fetldfmDem(mont4 ltoxr oatfpDeaieil( trtrim oodalenlfci t) rumuront4olxoif3iadla2el(vpnt)trtnxocty1lpDrauesls)s2uo(opno1lmt lfes (fsDtrxm ou4aexn f3tadfmDelnmo (4tlxrmfciotlpDrlues (  ruo(opny4lmt  fvt sfs2tmx pnt1alto ietydfa rlnvp;(0 etoioctodlmDran il(0seuo(m3nu4optnmneias  2ua(ro;u4altn oetadfsDemn p u0 ltoio oo1fpt anes s0setmxm oodal n icsltfsDrrurpnt1texoif3tldlsDum(monu0 lerxo oatlmt anei t srtm(r iydole mfcta()a2trxrooo4tex  i3iyd a eanvp;u) eermfciatfmD aivo t)trtrxmpoo1omee nvt (  Drr( pno4apt mo3iatlm2rlnvsnt4aexnmrcootlptrlueil(  2tr(m no4ale mfci s arur(rono1apx iiciytfa2ulnmo;t) etnifcty1oa  ai s;s) 2trir oo4lle mfetl(  rua(mp;u0tpt ifctasfa emumsn(0trtomrcia1oaDelnei t)s2trio3nydam nlnesltfs2tmx  nu1apeomfeiytfs2em(msnt0 eenmo3tytomDraieo ()t2umir3iu1olt lfvta( srra(r ot0olx  f3ild m emnvs u) lerxf3iatfpD an i s0trxmio no1llenmncsatfsrumum ;u1apx iiciadla ul( s u4tltnmo ta1laD livs t0truoxm3iy1am  mneiasfsrtrxmpoo0apx ioeiysfsDranmo u4 exoio3to1fpD au o (0trxoio io4lleemivtl(f rtr(m nu0oetn i3iysls rlnmpnt4aeeoxocia1lp rlnvs t sruoir ou4ope lict ()aDua(  ;t4ole mociasfs emuvon(0 eenxo oytlaDr uvi;s)texr(m3io4opt  fvtltf Dtaxro;t4tetnmocildls rluvpnt) ltnmf ty1fpDrli o;t0texmxo3oydale  ivtlt a2tau  nu1alx  i3iydlaDrmn on(0 ltoxo oatop r u i s)seuoim no1ap e fvt ( aDra(r ;t4aeeomi3iytfm uln pnu4tlxoxfcoytfmD  i slt trum(r3oo4al emiesat)sDrrxront1tee  i3tat s rmnmpn() rerio oo1oatrauvs;(0trurxmpoy4lptemivi sfsDuax oou0apenifetasfsDra( on(0 eenxo3tatoate uei;(0s2xmio iy4ll  lietl(  rraurp;o0tpen f3tyt m umnms;t4trtomf3iy1omDrai s;s0 exmio ny1amenlfcsa(fsDrm( pnt0olxniieiltfa uln o;u4tleoxfcty1faDelivs s teurxm3oodllt livils) rtmump;u1oet ioctadla2rlnvp t4 rerircoatfpteai sl()trxm(r oo4omeelivta(faDuau  ot1apxniiciat s2ulnms t4aexoxr3oadopDrlueo;t)seumxmpnodaleelivt ()a2rr(rp;t0aptnif3iat a rlump;t4treoxf3ootopte nvo ( srtoxm iodlmenlfes (fa2umxr ou1oetn o3ilt mDrmums;u4aexrmr ia1fmtr nvo;t srtm(r3oy1lpenmfcta(  2ra(  ;t4oexnmi3tldls2umumont4 rerifctytop rli i;(0 2xrxopio4lm  lneiat  Drax pno1tptnmietad a eanmo;(0altnio3ta1fm  li o;t0 rtrim3nydlpeelfeils)arur(mo;u1opxnmi3ildlaDeanvp;u0tetoif iatlaDeaivols)trxo(opoo1lpt mfesl( s2rmx ono0tetn i3iyt aDrlnmo t0aleoxf3ia1fa  ai il()t2xr(o3ny4lp elneiatf Dtmx ono0olxomi3tld sDumumo u0 lenif oo1fp  lnes;(0teuoiopnodamee feslsfarrmx  ;o4aleomfctldfs2ulnvsnt4tleoiociydlmte uvi s0teuoimpiy4lpt lnesas)srrr(rp;u1tlxnifcilt mDra( s ()texrmr3tytfmDeaueils0s2tr(r3nu1altn iet (faDumxrpot0tltnmi3iasfa2rauvp u) lerxf tadomDelnvi;( trxr(m nydlpte nvtat) rtrumpno1oeen fciytlaDelumonu0trermfcta1opt  ivilt tetm(r no4apen ictltfs2rr( p;t1olen o3tltfa rm(vo;(0tlenxrctytfmDrlies t0s2xmiopio1ale  ivtat)aDtr( oou0apeoiieiadlmDranvonu4aexnmoctytfmD luvils0trurio3ny1ome mncs tfarrmxrp;o0tpx  ictydlmDel(msnt0 lxrmoctotopD li ilt0sexrimpiydllee nvsl()arrr(r ;u0aptnmociydla eanvs;t4altoir3iatlat  nvols0texmxr3io1lpeelietasfs2uauro;t1aetoio3tldfmDeln p;()teeoir3totfate u ils) exmxopno4amtnmiviat  Draxm ;t1apx  f3iatlsDranvont)tleoxf ootopD an s;t0setrxr iudaleelies t) Dtaumpno1altoiietytls el(vs;t) etnmf io1oa eanvol() rtr(o oodalt mivt s sDra( onu0olxo feiatlm um(msn(0tltnmf3iatomD auvo;t)srxmxo oodalen fes tfsDrmxmpoo1opt moeils mDrlu p;u0alxrifcoadoaDeau s;t0sruoim nodlpen ici s srumu o;t1oleoiictatfm2em(vp;(0 ltrmf3todfaD livs s) etmim3oudlmtemnetat)aDrru ont1tet  i3tltlm2el(ms u4 renir ty1fm e uvilt0srxr(mpou1optn fetltf 2rmxrooo1alxoio3iatlsDua(mpnt4 exrmr3iotfm e neo ( s2toir no4lmt lfvs s) 2urxrpno0tlx mfeiytls2ean on(4 rxrmfcio1faDe ieo;() rxrir3ou4oleelfesltfsDum(mo;u1tpe if3iyt s2elnvo u4aexrxocta1faDrau s;s)s2uo(mpnu1am elnvsl(f Duaum ;t0tlxo ociatfaDel( p;t)teeoiocoatlptelnvs;(0trxmim oo4ape  neias  rrru onu4tet  fctad s elnms;u)altrmocta1optelnes t  rtrir3iydome  ncsat)aDtru onu0apxnii3tytla elnms;u0arxnxrcty1fmD aneils)srxoiopoy4amt livsatfa2ta(  nu0tpxomf3tys a2ra( pnu)trxomr oy1op   uei;t0sexmio3no4ole mfcsa(  Dta( p;u4tpt miciytfsDelnmp;u0 lenmr oy1om r ivslt) 2xoim oudol elfctl(f Duaxmpou4altn fciyd s elu s;()alxrxr todlm eaivsl() rtmirpnu4ale mivtl(  2uru  oo4tpeo feilsla el(mp;t0tlxnifcoatlm  lnvo t)t2xmxo oy1llenmfet s) rrau poo4aexnmoeiydfs2rmn p t4 renir3tadlaDelueo t0s2to(r3ou4oltn fet s) 2tm(mono4aexomo3ildfaDra( p;u) exomo3iytomtr uei;t) 2toio iu4lptnmfcilt aDtr( oou0olx mo3ild m2rmuvpnt4arxrxrciy1lpDran o;t) rurir3io1lp nmivilt s2rrurpot1ale  fetytfa2elums;u) eeoxfcio1omt  nvi;s)t2tm(r iy1lmtnmnci sfsDtaum ou1tlto ieiytfa eau p;(4texrif iydom rli o (0t2trxm oodopenmfvsa(f 2uau poo1apt  ictasfs em(vp;t)aexoiocia1oa eluesl( t2xrim3io1am emnctlt aDum(r ;u0olt mfctltfmDeanvs u) ltoxf3iatlp rlu s;t)s2tm(r3ny1ale lnvsl()s2uru  ;u0alx  i3iytfs elums;(0areoxr oytlpteauvols  rxrimpno4om  livs sfs2tmumpnu4tpeo ictydfm2ea(vpnt)artrxf3ootla rluvs;s srtoim iu4alt mieilt)artr(mpot0aee  ociydlaDrmums;()alxoxo3oydlpteauvs;s0 2toimpnu1oleelnct ()srtm(rpou0tpen icilsfm2umuvs u0aeenmo3ta1fpD aivi;(0t2xrirpnudlptn fctas sDta(mpot0alenmfeiatfs2elu p t0tetrmo iytla rlnei s  2ur(rpiu4omt livtlt  rta( o;u0oeeo octat m2elu snu)tetnir3oatop e iesl( teurimpiu1om n fcs sfs2raumpot4tptnmi3tydlaDul(ms t0tetrxr3oodoat an ilt s2xoim3no1ame lictlsfaDumum no4oltn oeilsfmDuln pn(0alenmfctotoptr u i s0setmxo3iu1lmenmfciat arum(rpnt0aexnifcildfaDrm( s u0alenxociadfm eai o s) 2toxm3oydlp nlfeilt)aDrr(m ou1opxniociasls elnmsn()trermo oydom   u o t setmir nudame lieils)a2trxmp;u1opt mo3iaslsDeaumo ()tltrxo3ty1lp eaies () euoxopnydllte ivsasfaDrmxmpno1apt ifetldlmDeauvs;u4altnmf3oadlatrau i (  2tm(r ny4ope mfvt sfs2raxroot4altnio3iasla2em(vs (0aetrmo tadfptrln s () rtm(m3oo1altnmnvt ( aDum( ooo1alx  ieiyd m2ulnmpnu0tltrmo iytop  ln ilt srto(opoodam   ivt tf 2um(  no4alt ifctldla rmn snt4altnxfcio1lpteli s (0sexriopno1op   ics s) Duauroot0oex mfetas m uauvo;u4treomrcia1opt aies s s2xoim3no1ape mictltfsDurx o;u1opxnmfciasfs2rl( s u4trtrxf to1fptr ivi t0teuoir ou1lmtnlncsas) rrrurp;o4texoiicilsfmDulu s;u0aetrir3tytfpt au i;s)t2xr(opnodapeemivtas) Dtrxrooo0texoiicils m2ra(mo u4 lxnif iadoa elnvsl() rum(o iudlm n ict sfsDurx poo0tex if3tadlaDrm(mp u4tltnmf3io1fmtrlues s srtm(m3ou1aptemnetl()s2tmumooo1tptomieiltla2rlnmsnu)areniocty1oa e u il(0seto(o iydlm   icsatfs2uaxr nu1aex ifeiyslsDrlu p (4tleriocoydopD luvs;s0 exmio3iydlp  mietls srrrumoot1opx  oeiytls2ea( s;t)teenxr3iatlaDeauvi;t)trxoir iu4openmfvsls)arumx poo4tlen ocilsla rm( o;(4 eenxo3to1fmDr nes;(0 2xoxmpoodalt  ietlsfs2ur(r ;o4teeo f3iadfs el( o () ltnmo oatfmDrauvs ()t2umxm ou4apenlfetlsfa2rau p;u1texn oeilsfsDumnmp u0trxoxocoydfaDr n olt s2umxr oy1lptnliviat arrmx poo1texomi3iydla eanvs u) eerxr oodomDrlieilt) 2xmxopoudlm emiciatf 2tr(  ou0apx moctatla2ran pnt4 lxnmf tadomDelu il(0trtmxmpio1lm emiei sf rrr(  ;o1ope io3iltfa2uluvo t0arxrmr3oy1lpD  uvo t0s2uoxo3io1lm e nvs tfaDtm( o;t1ole  fciys a uanvo;t4 leoif3ta1opDrli o;t0 exmxr3no4amtelnciatf Dtau p;o1tex mietadfsDul(vo t0tetnio3oatlmte u sl(  2to(m oodll e fesa(f rtaxr ;o4tlt  o3tadfs2ul( pn(0 etnxf3tytlaDeaivo ( t2tm(opnydom emfvtl()a2uau ooo0tptoiociatlsDrlnvonu0 ltnxfctydoa rli ol(0t2trxo io1alt  feilt  2rmu  ;t0aleniictyd a emnvo ()tleoifcoo1lpDe u o t0 rxo(rpiodape lfcsat)sDur(rpnu4alx ifetytlmDrm(vo u0alxomr iytlmt  ueo (0t2xmim iy1al n nvtl() rraumpou0aeeoioeiat a2ean o;(4alenif totomte n s s0s2tmxm io1om n ici t)sDtau oou1tlenmiciatlsDeaump;(4 rtnio iadlpt  uesls s2toxmpny1al emfvsa()aDrm( p;o0alenmiciatlmDea(vpnu)treoio ootop   nvilt)srtm(r no1lltemicias)sDtruroou4aeto feils s emnvp t4 exriocia1fat  u i;t)srtmxm3iudam nmfcilsf rtrx p;t1tltnmf3tytfsDrl( o u0trtomrcootoaDe ieo (0s2xoir io4ale lfctls)sDtm(  ;t4alx mi3ils m2eauvo u) lxnmocoodfp   ivi;t trtrirpou4op nmnciat)s2taxm ot0tpeomictadfaDranmonu)tltomfcootoaDrlueils)seuoxr no1lmt lfvt () rrr(  ot1olt mfeiydls eau p ()trxnxocoytfpD  uvi s0 2tr(r oo1lp emivilsfaDtrxmont0alt ifctyd a2ulums;t) exrif3iotfp elues;s)teur(r3iu4amt  netls) rtr(m ou0opx mfciyslmDeanmont4trtnircoo1lpDean s ( srtr(mpnodom nlictltf 2ta( pnt4apenmf3iltls2ea(ms (0alerxocoodomD  neslt tetoxm3nudameelies s)s2rr(moot1optomoeilslmDrau o u0texnmrcoa1fat lnvi;s srxoxo no1ol elfvta( srraumpoo4apt mieiydla2emn p;t)aexrmf oa1fatranei (  rtoir nudaleelnctat)s2rrxro;t4tltoioeiysfa2rln s;t) reoif3tydfp rluvilt0setoirpny1optelnetl( sDumurp;o1tpeoifctyd a um(vsn() rtomf3oa1lp eau s ()teuoio ou1ll   iesas  2rm( onu4aptn o3iytfm ean onu)aeenmr oydla   ueo t) 2trxmpno4aptelfciat  Dum( ono1ole if3tas m umuvs;(0 exrif tydop eln i ()s2uoiopny1am elicta(  Dtrumpot1tle  fcilt aDemu o;u)tetrmocoatlatrauvsls0t2uoio ou4lleemnet t aDraurp;o4oeeo feiytfs umnvs;()tltnirctytop   n s ()sexr(mpiodop nmncia()sDraum nt1opxo ictysls umnmp;t4 leoxr oatfp elu i;(  rtr(r3iu1alt  feilt)s2uru pno4tlxoif3ildlm2umu p;u4alxoxf3oadlmt  uei;t teum(mpiu4am   nei () 2umxroou1tle  o3iadlsDra(mp t4 rtomo iydfpD ai i ()seumxo3oodam n nvta()s2ur(rp;o0tpt  i3iat s2uluvp (4aeerifcoytop  aies ( trur(r3ny1om emnciatf rrr(rono4tlxn ictaslsDeanmo;()alenif3tatlmte neols0srurirpoydam elfcias) Drax oot4olxnmo3tls m2emu sn(0alxrio3ootfpt li s;s0seuoxo3oo4ameelncs t) rur(  nt0oee iieiydla uanvs u) rerxo3oadfm e ivil(0t2umxm3oodlptemfetatf 2ur( pou0alxoii3iasfm uau pnt)tetnirciy1faDran olt0trxoxm3oydam  lfviltfs2ra( ooo1tetnmi3ildfs ranvonu)artnmf3oydfp rlnvi t sexoxrpnu4op n ictat  rta(mp;t4tpe mietydls elums (0alenxrctotlpte uei s setrxo io4am  mivtlsfsrtmxmo;o4aex mi3ildfsDuau s;(4aeenxr tytfaDrln s;t) rxrxo oo4opeelfvtl( srraur ;t0tpe  octytls ul( o;t0 etrmf3tydop   uei ( setmir3oydlmenmfvi sf Dta(  ou1aexoiiciltlmDemnvs u4 lxnxf oydoatrauvo s)texr(m3oydameemivil() Drmx ont1tex ii3iasla2rl(ms u0artnmf3ia1lmt  i ol(0sexmio iu4ol   ivs s aDtaxr nu4tptn i3tad a rm(vs ()teermf oa1lpt  uvs;(0 etoir3oo4lmt mfesasfsrraur ;t0oet miciltfa umnvp;u4alenxfciy1latraivi t)s2tm(m iudll nlietltfaDtmx o;u4aptoiieiltfaDrmnmonu0 exnxocto1lmtrlivolt  rum(rpoy4ap nlfeiasfsrurx o;o4aexoif3ias aDuan p;u0aeeomr3ta1latrlueo;t0trum(o3oo4lmtelnvtatfarra(mooo4opt ioetadfaDrl( pnu0 rermr tadoatraies;t0sruo(m ny4ol n ivsas)s2uau  oo1tleo f3iytfs uau onu0tlxnxf3to1lmD  uvsls t2umxopoy4om   fcs ( s2tru  ot4oexnio3iyt a2rm(vo u4aeenircoa1opte ieo (0 2umim nydomtemneiasfaDurxm no4ape  i3ildls eln o u4texomr3oa1om  luvo t) exm(m nydoptnmicias)s2ua(mpno0apx  i3iltfs ranvo u4 rtoxo3ty1op   uei;(0 2xr(rpou4apeemnct (fsDua(m ;t0oltn ietlt m uanvp;()teeomrcoa1fatrau s s0 etoir io4al emnvsas)artaum ou0tlx ioeiys mDeanvsn()tetnmrcoy1om r ueilt)t2xmio3oydapte ncslsfsDrauront1alt ioetld m uan o (0texomrcta1fp  li i;( s2toxopnodlptnlicta(  Dra(root1teenmicilslm2eanvo t)trtnxo3ia1fa   uvsls)srtmir3iy4lmt  feta( a2tru o;u4tpeo oeiydfa2ulumsnt)teenir oatoaDe n o;t0t2xm(o oydap emfctl(fsDtmxmpnu1tpeo ictat mDrl( pn(0tetomrctotlmDraueo s)trxrir3oo4amenlivi (  Draur ;o4apxniiciat s emnms;u0 eermr ta1fa ranvsl()trxrirpiy1amt lfvi (f Drau o;o4oleomf3ilt m ra(ms u)trtnxo3oa1op r nvils0setmxm ou1altn neslt)s2raumpnu0tpxn ietlsfmDrmnmont0artnmr ty1lm e ies;(  2trxr3nu4altnlfvtlt) rrmx ooo4tet  oetld aDea(vs;(4trtnif3oy1oaDeau o (  euo(opoy1lm nmiesa(f 2raxmpot4oeeniietltfm2eaumo;()aetnmo3oa1laDr nvo t0teuoxmpou4am  lneiasfs2rm( ont1alxomoeiyd sDrmu o;t4trenxf iatoaDeauvo;t  rtoxm3no4lme  nciat) rraxmooo1olen fciaslaDuln s t4arenmr to1fa  livs () rtmxmpiydapt mnes ()srtmum ou4tltnmieias m2ul(ms (0tltoxo3ia1la  ln i (0sexr(r oudom  lnvta()s2rrxmpou0aeenmieiyd a2rmnmp;u) ltnir iydopDrlivs;s0tetr(o3ny1lm  lnvi (fa2umu  ;t4tptn fcilt m um( on(4 renir iadom elnvi t0 eur(r nodlpenlici t srta( onu0aex ioeiydla2ranmsn()trxoxfcoy1la rln ilt  rtm(m3iu4aptemfvt ( sDrr(m ot1oexn oeiydla2raumpnu)aeenxr tytfaDraiesl( srto(m no1aptemncsls a2rmu pnu1optniieiydlaDrlnvs;u)altrxf iatfa  luesls0tetoxopnu1ap nlnet s)sDra(r nt4tpx io3ilsls2rlu p;t0 exnif3oa1laD ln sl(0teurxr3nu4ame lies () 2umxm ot1apt moeild m el(mon()aeenxf totoatelnes;t0s2urxmpnu1ale miciltf 2rrump;u1aeeomfctad m2rm(vp;u4 lenif io1omDe u ils0 rtr(m iodoptelicil(  Dtr( oot0tlt iieiat a2uluvont)tlxoir io1faDe i i;s0 2urimpnydopenlfei (  Dtm(m ;o1aeto o3iltfm2elu snu0tetnio3io1oat luvo s0 rtmxm3iu4llen nviatf Duaxr ;t0oex ii3ildlmDumump ()tlxoxf iatfp  liei;s t2urxo nydalt mfeiatf Dur( pot0tpto icilslmDrmu o;t0arerir ia1la  luvs;s0 exm(r3oo4apt livtl( aDrrxrpoo0alx if3ildfsDem(vo u) rerifcio1lmtrau o t0trtm(o3ny4lpe  nes (f Dum(ront1altn ociadlaDrmuvs;u4tltoirciodopD anvs s t2xoxrpoudap emnctlt) Dta(rooo1tpe iieiyd a2uan p (4teeoxf3ty1op eaneols)seur(o io1lpen fvi sfarrmxmpnu4oexnmfeiatla2uaumpn(0 etoif tatlm ran i s) euo(rpiydaltelivias artmxr no1aetn i3tatla uaumpnt4tlxrir3iydfa  lnesls)seuo(mpny1lmtn fes (farrauroot4apt ii3tyd a2rm(ms t0 etnio ootoa  aivi t0s2triopny4opt micsltfa2uax onu0oetn ietltlsDrluvs;()aeenir todop raieils) euo(r iu1ap  mictlt) ruau  oo0alx mfciytfm ua( o;()areomfcoytopteauvi;(0t2tm(rpoudlle mieias) ruaur nt1oexnmf3tlt aDumnvs;(0 ltomo oy1lptrai olt0s2tm(opoy1omte feia()aDurxm ;o1apeo ieils mDraums;t)artnmr3iy1la   neols) 2tmio3iy1ame  nvtlsf 2umxmpoo1oetn feiytfaDraumon()altnxrctotlptr uvo (  exo(o3oydameemiciat  Dtrxmo;u0olxnmieilsfsDuln onu0trtnif totop  anvs;t  2tmio3iu1apenmfctatfarumxmoot1tlenio3tytfs rlnmonu)alxrmf3iy1omDelueils0 2urxo3no1apeemnetlsfsDua(r no4aee mociatfa2el( s u4 exrxr io1opDe ivi;t0 2um(m io4ol e fctltfa2tmxm ;t0opx mf3iadls rmn p u0artrircio1opteanvs;s0s2xmirpnodam eliviat)sDtrx p;o1altn ieiad mDemumo u4 rermo3totfa eauvsl(0sruoiopio4lm nlnvs sf ruax pnu4tleomfeiys a em(vs;u0tlxnmr iydfm elueols) 2tmxr3oudlm nmfvi (f 2um(m oo1oetnmocilsfsDrm(mo u0texrxo3iytopD ln s (  rur(opno1lmeemfetls) rtrum ;o1oeen i3ildfm2emnvon(0 exrxo3tydopD au s s setrxo ny4ll n ieil() Drmxr nt1aexn icilslmDranmo;() renmf3oa1fp r n il(0 2xo(opoy4ole mici t)s2ta(m nt4oetnmoetydls uan p (0 etoio iytoa elnvilt sruoio ou4omenmietatfsDrr(mo;u0opt  iciadfaDrmnmp;u4 exrmrcio1om r ueil() rtmim3nu4lmtn ivi sfsrua(mp;u1tltnmfciys mDrl(vp u0tltrxf3oy1laDr ueo t)t2toxrpiy1op  lietls  Drm(mpnt0olenmoetysfa emnvp;()alenir3iydla rau s () rxrxm iodap e nes s)s2ururont1alenmfeiysls ean snu0 rtoircto1omtraneols) 2tr(o3nu1lpe micsl(f 2rmxrp;o4tpen o3iltfa elnmont0artrircoa1opt lu o;( trxoimpiy1op   nvtl(fartmxmonu4apx  ociltfa rlnvs;(0aetnxr3oadlmD  ues t t2trxo3nudope liciltfsDuax poo1alxnif3iyd aDrmu ont)altoifctotom e i o s)srxr(m nu1omtnliciat)a2ta( ooo0oleniictatfsDrlump u)aeermf todlmtelieo;s)s2umxr3iy1oltnmfcsatfsrtm(rpou4tptnifeilsla uaumont0tetrif iydfmtr iei;t  eurirpnu1omtn fctat aDrm(moot0apxnii3ias m2rlnvo;t0 eenmrciadfpDrliei;()trtm(r3oy4apenlneils s2ta(m ;t4tltoifctytlm2em(ms t0alxrxo oatlmte ueo;s0t2toirpoy1omeelfci s)s2tr(m no1oltoiietls m2rlnvpnu0tltrmrciadfmDrlieil(0s2uoxo3io1lmee fvsl(fs2ua( poo0alto ictadfa ean s;u4artrxfcoytoate ueo;t sexmim nu1optn fvil(fa2truro;u0oeenioeiydfm2elnmo;u0arxoio todomDrai slt0truoxr3iy1alt
\ No newline at end of file
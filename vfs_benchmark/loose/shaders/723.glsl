@@ -0,0 +1 @@
+u s t teumirpnudom   nvsls)s2rrxroou0opeomfetls aDul(mo;u)aexnmfctotfpDeli i t0trxrxr oydape  ieilt)aDua(r no1texnmietatfaDrlnvo u4tleoio oo1omt ln ils  exr(r oy1amtn nctlsf 2rax pot1olxnii3iltla uau pnt)aexoxfctydla r nvi;( s2xrxo oy1apte ncta()aDumurp;u0ole mietat m2rmnmo u4aexoxrcoodfpD  ues;t) 2xrirpiydapeelics tfaruaxmp;t0tltnif3ilt m2ea(mo;(0 ltrxr iadlp r ieo t0 exo(r ny4aleemnct ( sDtax  ot1tpx ifeiysls2ra(mont0alxomo iytlptraneols0srum(opiodlp elfctls)sDum( oot4tpxomfcilslm2rmuvsnu)aeenif tydopt aueo;()srtm(mpoudlmeemnvtl( arrr(mpoo4olenmoeild mDrmump t0teeoifctotlmD ln i s0 rxoxo no1apenlici s)aDur(  ot1tet  o3tldfaDuaumo;() lxrxocootlpt  uei;t)srxrio nydop elics () ruax o;u1opt mocildfaDrl(mo t0 rxrxo3oatlaDean sls) rxoirpiodaltnlictl()srtmumpou4oltniociat a ea(vpn(4texrxo3to1fm eauvs s  euoxm3nu4lltnmnvs tfsDur( p;u1tpenmietyd a ra( s;u4tltrmf3tatfaDeai o;s0trxo(m no1altnlfeias  2ur(m ;o1optnmfeilt mDranmonu0altrmociatlp eaneol(  eumxr3nudaptnlnct t artaxroot1aee mi3tltfmDrlu pnu4trtrioctadlaDeluvils  rur(o oy1amtemfvsls sDra(r ;t0tpe miciasfsDumn pnu) exnmfcio1faD livo;( s2xriopiu1aleemnvias)aDrru o;t1olxoifciyt s rmnvpn(0 eenxr totfmt li i ( teurxr no4lmt lnetlsfaDtm( onu0aptoioetltfaDem(vpnt)aetoxfcto1fmt auvo s)srurxm3oo4lpe  nvtlt a2rax pou0oee ifciadfmDumums t0trenmf3ty1fmte ivs ( teumxr3ny4ll n iei (  rtmxmo;t1alxomoeilt m2elu s;u0alxrirctadom   n o;s0trxr(m3no4oltnlfct t)srrax ono1opto i3ild s rmn o;()altnmfctydlp eau o s) rur(rpnydamtn ivi s) Dtmxm ;t1alto oeiyd m2ulnvs u)tlxnxo3iy1omt auvs ()seto(o3iydap n fvslt  rtmumont1tltoio3tydfs ranvo t4texrif oo1fptrau sls tetmxo3ou1ape mietls)aDtau poo4oexo fctltfs uan o;() eenmrctydoat au i;( teurxm3nodal nmiet s  2rrx  ot0aetoiicilt m emuvo;t4aetrio3totfatrau ols)trum(rpnodlpt livt (fsDtrxrpot4tpt  o3ild a2ua(vo;u4arxomfciotoaDrau ols0trumim3iu4om n netlsfaDrrx ono4oeeo iciytlmDeanmp;(4trtnxo oodlaDr nvi (  2xrir3nodllt lfctl( s2rau pno0oet iictatfm2rlu snt4texrxr tadfa  aivsls)srto(m3oudll nlict s)arua( p;o1aet ioctydfm2ua(ms u) rxnmr3todlptraneils s2tr(o iu1amenlfet ()a2urx  ou0teeo icilt m um(vsn(0 lerxr3iadomt  u s t0 rurim iudame mfeias) 2ra(  nt0altniociadlaDuanmp u) rxrmf tydfmDr nvo t  eurim ny1alt mfet s)s2rm(r ot4teeomiciyslm rmnvp;u) exrxo3tadfmt lu s;(  rumimpiudope lfet (f 2rau pou1olenmocildla2emnvs;u0aeenmr iatoaD  nvil() etriopou1lp nmicta( aDrru oou4altomfctysfs em(mpnt) ltoiocoytlaDeai i t)teum(mpiy1amt lnviat  Duru pot0altnmi3tysls2eluvs;()tltoio oatlmte uvols0 rxr(r3no4omte fetatfaDrmx poo4oexnmoctltls emumpnu)teenmf oytla r ieols)seuoio ny1op nmnvia( sDtaxrpnt0opxo fcildfs2eau onu0artriocoa1fpD lueol()srxr(r nudop nlncsas aDururpoo4tpxnmo3iadfsDranvp t4 rxnmr3iatfmtelivo ()setrxo3nu1lleeliet sfaDum(m ;t1tptoiicilsfa2ul( p t)tltnio3iydlm   nesl(0sexr(opiu4am   iviat a2urumpot4tlx iieiatfa rm( pnt)alxrmf iydlmtr i ols seuo(m io1lpenmicsl(f Drmumont1tle  ieilsfs elump;(0trtrmo3iatlpD au o;s) rxr(m3ny4alt livias  Drm(mp;u1tex iiciyd a2uauvp;(0 lxrxo3to1op  lies s  rumim3nydalt mnesatf rua(mpno4tpx mo3iydlaDulnvs;u0tlermfcoa1fa  ln ils t2um(mpiodamen nci ()sDumxmooo0tpe  o3ilsla2el( on(0tlxrmf3oydomtranei t)s2tm(r3ny4ap n ivt ( a2tmxr nt1tpe  f3ildla elu s;t) ltniocia1fm r uvs;s0 2umim3nodol  mfesasfa2umxr no0alxo fciysfm2rmnmo (4 exnmo3tadfptrai ils s2uoxm3nydaptnlieia()sDumxr ;o0oexnmo3ias s ulumpnu0 eenmo3tadfmDe i ils s2tm(m3io4lp nlivil(fa2um(rpnt1tltnif3tas s2em(vont0 exnirctodomt lueo s)s2xo(rpou4ol emfvt t  2tmx p;u0aeenmi3ils s2ea( o () eeomf iatfpDrauvi;()srxoxopiy4lpenmnetat) rururoou4alx mo3tyd m2umn s u0altnxf tatlp e nvo s t2tm(o iy4am  mfvta(f Drax  ou1opt mo3tydfa ua( o u4texnxfcoodoa r ueo t) rur(rpnu4om e neils s2umxroou1tet iieiys s2ea(mpnu4arxniociydoaDr nvs t0seur(o3iy4llt mfcs ( s2rm(rpou4tleo oetat aDul( s;(4 rtnxf todfpt livs;( trum(rpiudlm nmivslt)a2tmxr ;o1tltn oetad m2rmn o t4tltnmf3iytfa eaneils0srtmxm3nu1optelfvtltfs2rauro;t4tetomoetltlm um(monu) etnmr3oadfm e n s t)setrim nydolenlicsas)s2tmum ou4teenmoctyd s um(mo u0alxrmr tatomDelivs;t)trtoirpno4apt  nvi t) 2rrx p;u1alxo ictasfm ra(msnt4 exrmo iydopt anvs;( srumxr nodom  lnet t  rrmxrp;u4aex ioeiyt aDulnvp;(4tlxomrciytlpDe ieo t0 eur(opnu1am  mietlt)a2taxro;t4tleo f3iysfa2el(vs (4 eenmr tadoat an sl(0trtmxr3iy1amtelnvi sfsDuaurpnt0aexomf3tyt s rmnvs (4 exnmfcoytlp elu o (0teurim3iy1openliesls) Dua(root1oltnii3ilslmDulnvpnu)aexnxo todoptr nes ()seuo(opnu4lm e ivs t s2raxrpnu4oetnioctysfsDumn ont0alermocio1faDranvsl()s2tr(mpnydlpeemfet tfarraxrpnt4tpxnifctlslm emuvs t4teeoir iadopDr i i t0 eum(o ou4altemfcta() Duaxmooo4aeeoif3tat s2rl(vo t4arxnxo3oa1faDrlivi t0s2uoxm3nydapte ivias) Dtrur ot4tleoioeiys s2el(vp;t)alxnmfcio1op  luvs;t0 2tmxopiydap e fciatfarrrxr nu1apen ieildfs2el(vo t)altrio3oadoateau s;() rxrxo nudomeemnesat)s2umu ont4apeoii3iyt s elumon() ltomr iatfmt aues;(  rtoim3iu1omtnlivt t)a2taur ou4aetnmoeiat sDea( p;t4arermr3io1laD  ies (  2tm(rpny1optelfvtatfaDrax pnt4oee mfeiatfaDrluvp;u0tleoirctadoa e ivo s0 euoxr iudol nlnvtas)s2raur ot0altomfciydfa2rm(vo u0alerxfciy1oa elieslt0 2um(r3oydlltn ietlt  Drrump;o0oeto oeilslmDulumpn(0treoxr oatfat au o t0seuo(opnodomtnlivtlt aDuaxmo;o0tee mi3iydlm2ranmpnt)artrifcoydfa rai s t)seurxo ou4alen icsatf 2tr(moot1oleomi3iys m umu o;u4arxrir3oatlaDrln o t) eto(rpno4optemfvsasfaDtaumonu0altnif3ildlaDel(vp (4tlermocoatfate ivslt)seumimpiy4omtemnvi t a2ur(rp;t1ape mfeiltfs ran sn(0alerio tatlat lu i s) 2tmxrpny4ol emivi s a2umx onu0oeenii3tldlsDua(vs;(0arenmoctotlpte uvols)trtr(r3oy1apenmictlt)srraxmpnu1oetnmoctyt s2emnmsnt4trenmf3iadomD luvs;t) rxrim no4ape  ictlt)artmurp;u1aet mocilsfs2rl(msn(0tlxoxf oy1laDrluvs;t0 rtrxopou4opee iesasfsrrrx pnt4aet moctys s2rmumonu) etoxr todfm e ivsl(  rxoxopno1amee iet t a2rmxro;o1tleoifcildfs2el( s;t4trxomrctatoptrlu i;(0s2to(r3nydoleelfvslsfa2urum oo4aeen feiatfsDum(mo;u0trxnmr3oatlatraiei t0teurxrpio1optelncsas) rur( onu1teeo oeiyt mDum(vo;t4 ltoxfcoatoate nei t0 euoiopiydlltemncta(f rta( p;t0altomfcilsfa ranmpnt4tleoif3oadlm  aueilt0t2um(m3oo1op nlneiat)s2ua(m ot4olx moeildfsDrmnvsn()arxoif3iydopt luvol(0 rurxo3nu4al nmfvi () 2rm( onu1aleniicildlm2rau onu0 rxrmf oatoa e ieilt0 exo(r3ny1ope  fct s) 2trump;u4oleoio3tldfa umuvs;u) lxoxf io1optr neo t)trurxrpnudlp   neta(fs2umumpoo0oexoiicildlm2rmuvo (0tlxnmo3oatlpDrai i t0s2xoxrpoy1lpt  fvsas sDrmxmp;u1apxo ictatfa2uan s t4 leoxf3ia1omD liei;s)setrim3iy4omt lncil(  rtmu  ou1tet  fctlsla2rlnvo;t0 leoio oadopDr uvilt) 2tm(rpoo4lp elivs tf rtmuronu1texnifeiyt s2ul(mpnt4 lerxr3oytlmte nes s)t2xrirpiodopenlietat)srrr(moot0tet  feiltfs2eluvsnt0 ltrxo3iadfp r u i;s0srum(r oodllt liei tfsDta( onu0tex  o3tatla rl( sn(0texnifctotfmtr ivilt0trxrir oo4ll  mietl()arrr(  ;u4aexoio3iadls2uluvp;t4aetomr io1om eln i s  rum(r3nydllee ieiat)a2raxmono4optn i3tldla emu p (0alermo totlpte nvi;s0teuoirpny1olen ict t  Dtru oot1apen fcilslsDrlnvs t) eenifcootlp rlnvs;(0tetmxo iu4lptnmieiltfsDumx  no0optomfeilsfmDem(vsnt)alxomf3iydfp elivilt0 2xr(opno1om  lfvt t  rtr(mpoo1oleniietadfsDelu p;t)trtrio todfa elnvslt trxrxr nu4altemnviasf 2rm(r ;u1oltn octydfa2elu p;t0 ltoxo3iatlmDe neol(0seuoir nu1olt mict ( s2rr(r ;t1olt mocils a ulu p;(0trermo3totoaDeai ols0 2xmim3iodlpenlfvsa( srtrumonu1teen o3tatfmDumu s;t0aeeoxf3oy1omD lu ils0s2xoir nydol elici sfarrr(  ou1opxomociyt mDumu onu4trxoif3oa1omDr u s t) ruoxopiudopt lfetas aDuaxr ;o1aeeoiociaslsDrm(mo u0trtrxf iydlmt aueo s0srtoirpny4ape  icsa(f rtr(r no1tpenmfciys m rluvs;u4trenirctatfat  u o s0 rumxrpoy1lm  lfeiat a2taum no1aptniocildlsDea(vp;(0 etnxr3oa1fp rlueil( srtr(o io4op emivil(fa2rm( p;o4apxn oeiyslaDrl(mp;(0arenmociy1fmt  ueils)teuoirpoo1lmtn ivtas  2ta(mpno4optoioeildfa ra(ms ()aeeomf tatomtr nvslt)tetmimpoydop   icta(f rtm(mont0aet  i3iytfm2ulumpn(0altomocoytfpD aueo () exoxopiydlm nmnetls arurxr no4alxn o3iysls2ul(mo;(0 lermrcty1laD aivolt) euoxo3oydllt mivtls)sDtruront0tleo o3tas s2rmuvp;u4tltnmo3tytla elieolt)s2uo(o3ou4om   fesa(faDrrxmo;t4oexnmociatfmDulumonu) reomf oydfmDraivs;(0s2tm(r3ny1olt liviat)s2ta( ono1aee  f3iltfm rl(msnt)teeoio3tadoateli i;() exrio iu4ap nlncsa()sDum(ro;t1optn ieiadfa emuvsnu4teenxo3iotfaDeanvs;t)s2xo(m nodlmtnlfci s)s2urxrooo4tpe  fctatfs uln s;()aleoxfcoydomtelnvs s  2uoxo3iy4apt lfcs s a2trxmoot1aetn o3tad sDelnmon(4 lenxo tadfmD aivil(0 2xr(m ny1apenlfctatfaDum(mono4tex  fciat a rmumonu0aleoxfciy1lp rlueils srxoxo3oo4amtelfcs t)a2rax  oo4apx  ietatfa2elnvp t0tlerxo3oadlm e n sl()tetm(r3ou4lp n fei (f Dtmx o;u0aptnmoetldfaDum(mp;t)altnio3ootomDrlivi t srxo(m oydlp   iviatf 2raum nt1apx mictydlm2el(ms (0tlxniocia1fat ai ol(0teumxrpoudole  nvs s) 2trxmpnt0tee mfciad s rmn snt)texrioctytom r uvsl(0srumim3iu1amt lfesasf rtmum no4oexnii3ils sDrm(vs (0 rerifcto1fa   i i;s) exoxm3ou1al  lnvt s)arrmx pno1aexn ociasfs rm( p;t4 exrircto1lp e nei;s0srtr(o3ou4ape lies sf 2urx onu4aptnmoetytfmDuau o t4alenxoctytlat livols sexm(o iu1al emnctl() Drm(mpoo4aptn feildls2ua(vo;u)tlenir3oa1lmD aieo s0t2toxm iodalen fcias a2umu  nt4tlenmf3iytla emn s u) lenif oytfa r neol( s2xr(mpiy1lltemfei s) 2trxronu4aleo oetatla2ranvp;u4 lxoir3oo1latelivi ( teurio nydolen ivs s)artmu o;t4teeoiiciydfmDean pnu)tlxnxo oy1op r uvolt) 2xriopiodame  fet ( s2umx p;u0tlto ieiyd aDra( o (0 eenxo3iydfmte n il(  eto(r io4lmee iesls)srrr(mo;u1tptoifetls aDem(vp;t0 rtnmr iodfaD luvo t)truoio3oodopeelicsasfsDuaxm ou4aex  oetysfa2el( pnt) exnmr ta1oa eluei;t)texoxo iodllee ies (  2rmu  ;t4oeeoiocildfa2rl(vsnu)aexrif oadla elu il(  2ur(r nodopee ieta( a2rau  ;u1aet mociltfsDea(vpnt)teeoio3oydfaD li ol( s2xmirpno1opt  nci s sDraum nu4oeenmfctldfaDul( sn(0alenxr3to1om eanvi t s2tmxo iodop nlnetat)arum( p;t4alxnii3ildfs2ua(vpn()altrmr oatlptraivols  eto(r io1lm nmfeiat  2tmxmoou1tpx iociydls uanvont)tltoif3totlatrau s;()sexrxr iu1ale mivi t)arrmurpot1apeoifeiatlsDeluvo;() rxomr oo1omt lu s;s) exo(opoodal   fes (  2ur(mont1aeenifctys m eln p;u) exrif3tatfa ranvi;s) rxr(r nu1lmtemivslsf Drru ooo1tee  fetyd sDranvo;t4 rtnmfcoydfatelnes;t srxrimpno4ale mnvilt)srur(roou4oex mi3tydfmDulnvp;t0teeomf3oatlptraiesl(0 2trirpnudaleemfeslsfsDra( p;o4oltnmi3iyt aDrln p u0 rtoir3oydlm r nvo;()s2xr(mpnydlm  mnvs s) Drrxmont4tleomf3iltfa2uanms u)texoio3iytfm  livi;s)sexmim3nudolte fvi tfs2rr(mont4opt  oeiad m2emuvpnu) rxnxf3oatfmtraues s0 exrir nu1ome mivtat srtrxr ;t1tlxo fetysfsDemnvo u4aetrio io1omt au ol() eur(o iudapenlfcsltfs2tmumpnt0olxoifciydls elu o t4tlxrif ta1fptraivsl() 2toxr ou4lptnlfetlsf ruaumonu4tpe  o3iltlm ulump;u)tlxnxo3oadopDeauvs t) rxrio3io1aptnmicta( aDuru ont0apxoiictls sDulnvo t0treoxfcoatfpDrai ol()tetmirpio4oltn fvsatfs2tm( onu4olto ietlslm2ulu p;u)alxnxf3tatlaDeluei ()srumim iudll elnesa( a2raxrpou4opto fcilt s2ranvo t0 exnio tytomD lneo s0 eum(rpnudlpee ictat)a2umxm ;t0apenifeias a2umn o;t0 leoifcoy1fatelneils)t2xmxr3iodlpen ici t  rum( ont4aet  iciyt s emu o;(4arxoxrctytfat luei;()t2umio3ny4op nmivils  Durur ;t4teeomo3tatfsDrau p;t4 rtomr tadfaD auesl( srum(rpiu4lm nmivs ( aDrruro;o4tptomo3tatlm eln s;u4tlxnmrcoydfmtraieo s s2uo(r3iu1lle mfvta( srtau  ;u4aetnmfetls s rl(vo (0tlxnxf tydopDeluvi;() eum(o3no4amee icsls aDum(mpnu1tlenmiciyslmDrl(mp;u)tlenio3oadfp   nvo;() 2xm(o3ou1op elnct tfarrr( p;o0altomoeiad a rm( p t0texomrcoatlpD au ols) rxm(mpnu4lpt  iet t)srrrxr ot4alt mfeiadfa2ra(msnt) rerio3iotfp e u ilt)t2to(opnu1ol n iet t)s2umxmo;o4open i3iydlaDea(mo;u)arenxo oydlmD  uvolt)s2tr(r3no1am  lfesat)aDtaump;t1aptomietysls2emn pnu0 lenxrcoadoa e uvilt)setrio iydoltnmiciat  2tax ont0aex ifeiatlm umuvont)tetnxrcta1faD  ieolt0seumim iudomtnlietlt) Dtaum ou4tpxomi3iydla umums;u0trxoioctydfptrau s;s t2umirpiu4ome  nesa( a2tmx p;u1tlxniieiasls ra(msn(4altomf3iadfmD ln s t)tetoim oodolenlfvt (f Dua(m nt1aptn oeiasfsDra(vpn(0teerio3oadom e n slt)srtrxmpiy1llte nvsas) rtr(m oo1tpxoio3ias m rlu sn()alxrio3oydla eanvolt0seto(opio1lme mfcs s) rua(  no1altnmf3ild a2el( s (4arenxo todfmt livols)srtoxm3io4op elfviatf rrmum ot0tpx  octyd aDelu s (0aeenxo3oytfm e nei;s0trtoxrpiydlmenlicsl(f Dumumpou0aeenmietat m eau s;t)alxrmo ootopDr n sl()s2xoxm3ou1alen icslt)a2ta( onu0aexoif3tyt aDumuvs u)tltoircio1omDrauvo;()t2uo(r3iydale  ivta( aDrrumpnt1oee  f3ildfm ulu snu)altnmoctadom ean ols0setoxm io1lme miesas arraum nt0opeoioetadfaDranmp t)aetnxo3oatfm  ai ols s2uo(rpny4aleemfvi t  2umxm nt4aptnmfeils s rlnms t)tlxoio oy1lpDe ieslt0trxrirpiudapt mnci ()s2ta(rooo1aex  oeiltfs2eln o;t4 leomr oatlp ranes;( t2uoxm oy1am  mfvtl( s2umxmp;t1oleo ictadfs2rmumo u0alxnir3ia1fa  lnvol()srtm(opny4lm emnetat aDrmu  nt0tet ifeilt aDranvs t) lxrmo3iy1la rai s ()tetrxmpoodoptnlnct s) Dtru p;u1tpxoifeiydlsDea(mpnt4trxniocoy1la eli o;t  rurir oo1ale lfeil( srtaum ou1tex  fctat aDeauvonu4 reoxr oatfmtrlieo t)t2xmxr3iodlptnmfeils)sDtaumpno4alxnmieiytfa2elnmonu0 renxocootfmDe ueols)trxr(rpiu1lpt mict ( a2urxrpot1tpt moctlt a2emums u4aexnmr3tadfpteai o s)setmxrpno4llenmneil(farumur ;o0tlenmictyt sDranvs;u4 lenmf ta1fp  luvil(0s2xoir3iydlpt lnctltf 2tm(mpot1aee io3ilsla2rau p;() etoxfcoytfpD lu o;s t2xm(rpno1lmte icils srtmump;o0oee mfeiasfm2ul(vpn(0trenxrcoo1fptr i sl(0s2trxr3nu4lm emnvsls) rua(m ot1aexnio3ilt m eanvo t0altrmociadfp raieolt srur(o3oodlle lnvi (  2urx pot1apt moeiysfsDul( p;t0trtnmrciydoat  ies (  2uoxmpiy1omt mnvsltfa2trumooo0apenmociyd sDrm( o (4aetnxo tydfatr u i;s0seumirpiudoptn fcs (f Drm(monu0olx  fctyd mDum(vs;t4treoir3tytom e ueols srum(r3iu4llt  fctat)s2urxmpoo1oexnmi3iydfs eluvs;(0aeeniocoatfatr i olt0 2tm(rpio1lpee nesatfsDrrum ;u0teto f3iyt m uln s;(4 rtomfcio1lpDrlu i t srxr(m3ou4oltemieils aDtrx onu1olt mfciyd a2ea(vpnu0aetnif3oydfp  lneo;t0 rtoimpiydlmenmietas aDtmum ;o0altomieilsls2rmnvs t)tlerxr iatfp eau ol( seuo(r3iydal n fvi sfaDrrur ou0texomfeias s2elnmp u0artrmo3oo1la eluvi;s0 2xoim3ou1optnmncsatfaDrmx o;u1alt mi3tytfs2ran snu4tlxoxfctotlptr u i t) eumxo3oo4aptnmncsls) 2tmx p;t4openif3ilsfm2eauvsn(0tlenmo3totlmt  n i;t0texm(r3oodapt mivtlt  Drrurpou0apxo o3tydfa ea(mo;t4altnir3oy1oa   ivi;s)seurxopoy1lpenliviltf Drrxroou0opxnmfetadfm2rlu s u4arenxf3tytlmDe u o t seurirpio4opt  neslt)sDtmumoou4tltoifetad m eau pnt0trermrcoadlat livol(0teurim3ou4lme mfctat)sruax o;t1tetn f3ildlaDrlumo;(4trxrxf3oodlpD aivols0tetoxo3nudlltn fvsat s2tr(mpot1olt  iciat aDeaumpn(0trtoir3tydlp rauvo s s2xo(opiy4ap n iei t aDrr(mooo0opx ifeildfmDea(mont) exomfctotlmDr u ilt)sexo(m ou1ole mfcils  rrrx  ;u4alxoiiciltls2umu s;u)aetnmocoydom   ieols srtoio io1ape liet ()srtru ooo1tpenifetls aDumu o (0aetoxf3todfpDrlu s;s s2xmxo3io1lltn ivtatfa2uaxmoot0tpeo octyd s ea( snu0texnxocoy1opD lues;t) rxr(r3oy4ll emfcias) rur(mont0ape mi3ias a2rmu p;u4artnxrctydfmt au ol() rur(o nudopenmnct (  2ur(mo;o4aexniictydlm2eau s t0aexnmo3oytlpDe ieolt)setoio3nudlmtnlfcs t  rurxmo;t0aet mf3iltlm el( s u4texnir3ia1lm rluvo;(  2uoiopiodlp n fctlt  2uaumpnu1tpen f3ildfs2ul(vs;u)aeermrciydfpDeluvs;s0 exrxr nodap e ncs t)srrr(  ;o4tlxoif3tadfa2ea(vo ()arxnmf3totopt  n i;(0tetrxr3no1omeelictls)sDur( p;t0tet iiciltlm eanvs;()tlermo3oa1oat  ieo s0srum(m3no4amenmfeta()sDtr( p;t4opxomi3iadla2ulnvo;u4aeermf3tytlm eaues;t0t2xoimpiy1omt lncsa()sDrru  ot1oltoii3tyd sDranms (0tlxomr3ta1oa  lnei t0s2xmxrpny4omen fciasf 2raxm ;u4optoii3iyslm2ra(vp;t4aeermf3iatfa  li ols0srxoxrpny1amtn icsls s2rmxmpou0texo f3iytfa2eanmsn(0texnxr3ootfaDrai i s)seumxrpiy1lp  mnetl() 2urxrpou1apxnmociydfa2ulu pnu) etoxr3oydom  ln i (0srumxm3nydlp   ivs (  2tmuro;u4alen f3tatlaDra( p;(0texrir3iotfaDeaivi;t trxmiopoy4lpte nvtat)s2uaump;o1oleo ietytlaDrmumo;t0alenircoy1fpDeauvols  2to(o3no1optn ivslt)aDtrxmont4tex mi3ilt a rluvo;(4aexnio oytoptelieilt)seuo(r oy1apen ivs s  Drr(  ou0oee mf3iytla elumo u) rtnif tadlatelivo ()sexoxopny1opte fcs ( arumu oot4teto ieiatlm rmuvo t) etrxf oo1lmt aues;s t2trirpou4al e ivi (  Drmumooo4texnio3tadlaDuanvo u0alxnif3oa1lpDe iei (0 2tmio3iy4ame lncil()arrmxrpoo1opt  ictysfm eanvp;t)aetrmo tydomDrli ilt0seur(m oodlp elics tfarua(mono1ole ifctydls2ra( o (4treoircta1fmD lnes s teum(r ny4lp   nei sfa2rrxr ;t1apxoio3ils m umumpn()aexnirctytlp r uvs;s) etm(opno1lpe mfeias aDuax onu4tex mf3tyt a2umn o;(0arerxr3ta1opDelnvol(0 ruoim oydap   nctlt arum(moot1tpenmo3iadfsDrmuvo;(0arenxfciodfmt  uvols  rum(o3io1ame lieiat sruaumpno1aeenmf3ilsfm2umn s (4 etoxf3oydfmD auvo t srtr(r nydlpt  nvsl(f Drrxr no0alen octltlm ran p;t0tltriocootlmteluvi;s0 2uoxr3nydamt  fvil(  rtrxmo;t0tetnifciltfaDua(monu0texrxr iydfateau i ( trtrxmpiodaltelfcs t)aruaxmp;o4oexn oeiyslaDeln o;t4 ltrxfcoo1fmD aivi;t0s2umxmpio1ap nlnviltf 2urx  nt4aptnmociydls2ra(ms (0 rxrxr3oatopt auvsls srumirpnodlm nlnetlt  2tru poo0tleoif3iltla ra(vpn()alenio3to1fpD luvsl(0t2tmxo nu4lmt  fvi ( artaurp;o0tlt  ietls a2em( p t4 lxoxf3iatlmtrlueilt)trtmiopoo4om e nesltfaDuaumonu4optomoeiytfs2ua(vs;u0 eeoxf oydom  auei (0sexr(o3nu4lpe liei sfs2taurp;o0ape moetatfs rmnmo t4trxnir3iy1latrlues;t0trxr(opoodlme lfvias)s2tr( onu1oltnii3ild mDuau s;u) etrxr3iatlpD li i s srxmxm oudal n nvi (fs2tmur no4oeeomictyslm2ul(vsn()trtoirciodfat au ols0 2xoxmpnu4olteliesltfs2ua( pot0aeeomociltfsDrlumo (0 lenxfcoatfaDr nvi;(  rumiopnu4am   ivt t  2taxr ;o1optnii3iytlmDel( o;(4 ltnif tydlmteln o (0srto(r3ou4lmtn nvt ( a2urxrpou4oetomfcildls2ulu pnt4teerio3iodfmDrlieol( texmxmpiy1oleelncias) Draxrp;o4tle mietat mDelnmp;t) lermfctadfaDelueo;()trxm(o3iudll n fvtasf Drmxrp;o0tpenif3iytfs2rau o ()tlerircta1om elues;t t2trxr3no4lltemivia( arur(m ou1alenif3ils a ranvpn(4aexoir oo1lat  neo t0teumirpny4amen fct s srraxmono1oexn o3iadls uau o;()artomr3tadlatraivilt0 2xrxr oodlmeemnetl(  2ur(m oo0aetnmfeiat mDuln onu4 ltrircty1oaD ai olt truoim3ou1optn ivsas) 2um(mpoo1alx iociatfsDemuvo t)aeeomrciydlaDr ivolt t2toim3ny4op nlics ()artau  ;t0tpe moctls s2em( s;t4tleomr3iadfm r i ils trxmxr3no1alt  nctlsfartm(  ot4tpe  iciyt aDra( s;t)texomf3iotlaD lueslt0trxo(rpoy4ll  mfes (f rtmur oo1olenmoeiysfa umnmo t4tlxoif3todfa elies (0sexm(m3oy1aptemfvsat sDuaurpnu0alt iietat a2ulnvo u)aeeoxrciydfat  i ol(  2umiopny4lle  nei t)aruau  ot1texnioetysfmDuan onu4tetoxr3oadfm eluvi;(  euoio iy1altnlivs t)artaumo;t4opto o3tysfa2ulnvp () eerif3iytlmteln olt srtmir3iy1am nlicsl(f 2umurpno0tet ifeiytlm2elnvsnu0areoxf ta1fatr nvs s0 rum(mpnodlmt livtatf Dtrum ;u4tlt iieiydla2uanvp;t4aeeniocoodlpDeau sls0sexrxm ou4lptnmivtat) 2ua( poo4tpxnmoetls mDeanvs;u0teerio3oydlaDrlnvo ( srur(m3iy4ole livt s) rtmumo;u0apx miciyd m rm(vp;()alxnxo3todlaD au s;(0t2xm(o oy4oltn ies (  rumumoot1apeo i3tlt a2ea(vp;u0alxomrcoydfpte n s t0t2ur(o iy1optnlieil(fsrtrxmono0tpt iiciys m ra(vsnt)trerio oadla   n sl()t2xm(rpoydolen iet s  2taxrpou4olxomi3tld a eaump t4artrmfctotlmD  i o;s srurxopiydapeelivt s)aDrrumpnt0aptnifetat s uanvo t4arenxociydlm rau o;s)t2triopoy1apen nvs sfa2tmxmo;t0tlen f3iasfm eauvo t4arenmr to1oaD  nvilt) 2tmir nydamt lncsasfsDurum ;t0olenmieiydlaDuaumo;t)aeenmr tatoa  anes () euoxm io4amtnmfci t  2ur( pnt0aptoio3tldfa eauvp u4 lermfcoa1oaD  nvil()s2xmxm oy4ol nmicia(fartm(mpot0tet ii3tydfs2rm( s;u)teenxo3todfpD livsl(0srum(m no1alenmfciat) Draxmpot1oex if3iyslsDeanvs ()trerxf iodfmt  nvslt0s2xm(r io4omenlfvi t)a2trurp;o0alx  oeiyd s em(vs u4treoxoctatfmtrln i;() rurir oy4ome lneilt)srta(  ot4ape  feiydls2eln o t) exrifcoa1op rlieo;s0 2xoio no4altn fet ()a2tm(mpno4tlxniietysls elnmp;u0teenmf3iotop eai i;s0 ruo(mpnodlptnmnet s) 2um(rpot1apxn i3ils mDea(ms u0aetrmociy1lm  lu ils0t2xoxo ou4llt mfvt sf rtrum ot4oeeo oeiytlm2ulums t0trxoio3tytfmtrlueo;(  2to(rpnu4oltemnei t) rrax pnu4tpe ii3ils s rl(mon()trxrxr io1omtrau i s  rxriopoo4ame  fesasfs2rru o;t0alx iictatfsDrau p t)aexomo3iatomtraieo s teuoxo3ny1ol elnctlt a2rrxmoou4aexomictys a rln s;()aeeomf3tatla rlnvs;()srxrio oydamt  ivs t  rtmxrp;t0apeniociasfaDrm(ms;t)artrxr tatlaDelivi t s2tm(r3iu4aptnlncsa(f Dtrxmp;u4aet  ictltfmDeanms t4 lxrio3oodlatelnvi s sexoio nudlpe  net (  Dtrxmoou0tpt if3tyt sDulnmp;t0 lxrmfctytlat livi s  rurio iu1opee ictlt) rtaumonu1tex mfciysls rmnvs ()arerio3iytfatraueo s s2uo(rpoy4alenlfviatf Dtaxr ot4tpenmietas mDrau s ()tetnxr ta1oa e i s t s2xo(opno4aptn feia()sDurumpoo4tpeomfeiysfa elnvp t0aleomo oo1faD livils0setoim iu4ome  fci s s2rmu ont0olt iieiltfs2rauvo;u4trxrir oo1fa e n ilt0srxr(opiudom e ictl(farrm(ro;o0apx mociasla uan o t0texnxr iytomDrlu ols trxmxrpiy1omt lfesltf rrmx poo4tetnif3iasfs uau o;u4 eenifcoadoaD  ueslt)tetoxm3oo1opee nesat aDur( onu1tex mi3tld m em( o (0tlermr ty1laDeau s t  2tmxopiu1aleemfcias a2umxmpot1aleniiciadfm ua( o u)aetomr tydomtrli il() eum(o3ny1altnmncs (fsDraxmp;t0oetniieiysfsDul(vp;u0artomrctadfmtelnvo (0 2xmimpiu1lp e ietl(  Draxmpot4aexomo3tytfmDum( onu0 ltoifcoydfptrluvi (  etrir no4oltnmici s)a2tmuro;u1aexnioetldls ranvsn(0texomrcia1fa rliei t)trtrxm nodop  mnci s)a2rax  oo1tpx  i3tlsfs2uau snu)altnmr3oy1fptraueol()t2to(opoudape  fvsatfaDtm(ront1aetoiociysfmDra(mp u)aexoif ta1lm elnei;( t2trxm oo1lmt miei s)s2ur(m ;t1oleoii3iys a el(mo;t4tltomr iytomtrlnvol(0trtoxm3nudlmeemfet s  2trxm no1teeomo3ilsfs2eanvp;u4tltnir oatopDran ol()setmir iudomtnlfetas sDrrumono0tlt mo3iatls2ra(mo;u0 rxoxrciadfaDrln i;( t2uoim iu1lp nlfvsa( s2urumoot1aee mfeiyt a ua(vo;(0texnircoo1lmDr nvsl( texoxopiydamt  nvtl()aDrm( ono0aleomf3tad s2rauvon(4 reomo3ootla e uvo;t  2trxr ny1lmtn fei (fs2trur ot0olt iietat m umnmo;t0tlermr3oy1lpDe nvi;s)trtr(o oy1ale mics s s2tr(  ;o0altnmi3tltls um( pnt)aexnircio1fp   ivsls0 etmxmpnudll nlfvi t)a2uru ono1aex iieiatfsDumuvp;(0 exomocoa1fa eau i;(0sexmxr3oo4aptnlnciasfa2um(mont4optomf3ildfa rmnmpn(0aeenmocoa1fp rli il( srtmiopoy4am  lnvsls a2tmumo;u4aet moetltfsDuluvsnu)artomr3totlat  nvol()srxoxm io4altnmfct tf Drruroot1apt  o3iyt m elumonu)arenmr3to1fptrau ols0 2tmirpiy4oleelfctlt  2tr(r ;t0oltomo3tadls rluvonu)alenxoctodfpD auvilt) exr(m oy1lpen ivsasfartaxr ou4optoiieiysfsDrlnmo;u0trerxr iytoaDeln i;s)setoimpiodllee fcsls arur(rpno0oetnmictltfm uauvonu0tltnio oadlptraivo;()seto(m no4altnmict ( srtrxmpnt1oexomocias s rm(mp u0 etoxr oydlmDe ivo t sexmxrpou4lltnlnvtat)a2uaum nt1oexoiocils s ul(vpnt)tltrmfctodfaD ai s;(0s2toxo nydape mietls a2trxrooo1aexnio3tadfaDulnvonu)texrifciy1lm eaivo;t trtoim3nydale lfvt s)sDra(  no1opxnmoeiadlmDeanmp;u0artnxr oatop eaueilt)s2ur(o3ou1llen fvtas  ruaum ;o1aetn oetytlsDua(vo t0trtoxf oatlpDeanes t0s2toir iu4lltnmnci t)a2uaurpnt4texomfcilslaDrlnms u4alxoioctodlm ranvs;t teurxr3nodaptnlies t)s2ua(ronu0opeo f3iysla umn o t0tetoxocia1fptean s;s)seumxo3oydale mfvtl(fsDurxrpno1aexoioetls s ra(vp t) ltoxocoy1la ranesl(0srurxopiu4om emivsa()aDtmx p;o4tlx mfctysfs rl( pnu)artoircoatfmD luvi;()tetmio3io4lmt lnvils)sDra( p;u1aptomiciysla ul(mpn(4texoxo3iydlm e i s;()seurxo ou4lmee nesl( s2uaxm nt1aee mfeildfm ulnvp;t0tlxnif ta1omDeanvi s)t2xmxr nu1apen ivtat sDumurp;u1alto ictyt a rm( s;t0texoxr oa1lmDe uvo;t) rurir oy1ope lictlsf rurur ot0tpeniieiasfs2emn pnt) eermfctadom   uvol() 2xrirpnodopt  ivilsfartr( ont0oleoiociys s2umums;t) rerircoa1lmD ln s (0 rtoim oodolenlivs (f 2ra( ono1oltoifeiad aDua( s u4arxomo oatfp r ies (0 rtrir ou4llenlfetlt) 2tr(mpnu0tpxnifeiatfsDrauvo t4aetnmo3oydoatrauvolt0 exoir oy4alenlfci s)s2tr(r nu0tpxo ociyd s2uan on(4aexoiocta1oatr uvs s0s2toxm3io4lpt  fctas)aDrm(ro;o4aexo ociadfaDel( s;u4trtrif3io1oaD lnvi ( srum(o3io4apte nvt t) rtmu  ;u4texoiietls a2umnvs;t)aetrmocoatoa  aies ()texoim3no4omtnmicsas)arur(  ;t4alxnii3ilt aDeauvp t4alermociotfatraneo s) rxoirpnydlp nmncsa()sDumx p;u0altomfcias mDel( pn()aetnmo3ty1omtrluvi;s  exmxr oudop  lnvtlt) 2ra(  oo4oex  oetat mDem( p (0 ltrmf todfp raivo (0tetm(m ny4al nlies s)sDrrx p;t4teen fctydfmDeauvon()tltomrcoo1laDelueo t0t2tr(m3oudllt lieiatfsrrmurpno4alx moeiadfa2uau s (0 eenxo3iadlpD  uvilt) 2xoxmpiy1ale  ivt s srraxr ;u1apeomf3tld mDuan on(0 etnifcoadlm elnvolt)s2xo(r oy1op n ncsls)srum(moou1opeomoeiytfsDem(monu) eeomr3oy1oa  ln ols)setmxm3nydap nlivt t arrmx pnt1opxnmfctatlaDemums t4 rerxfcto1omt lnvolt)srur(o3iodam elnciasf 2ua(r ;o1teeo fciasfs ranmsnt) lxnmf3io1lat  ieilt  2toimpiydolee netl(f Dumxmpou4aexoioeildfs ea( pnt0 exnxfciydomD lneo t)trxmim ny1ap nlnctl()s2ra(m nu1oex if3tadfa2uaums;u) etnmr3oadfpDr ies t)s2trir3nu4opt micsa(fsDtrxr ou0tpeo ietls sDul(ms;(4tetoif3tadlm e u ils  rtoim3iy4am e fvias srurxmo;o4opt miciytla elnms;(0 lxoxo3iadlp rlueslt)setm(r oy4lm e nci tfs2uaumpoo0oex mf3ilt m el(mp;u4trtnmrctydfpte ies t srxm(m oy4ap n ictat a2ta(rp;u4alt  ociatlsDel(vp;u0trerir iodlpDr nvi s) 2xr(mpnudlptemncta(fsrua( pnt4alt  f3tad s emumo;t) lermr oo1laDrai i t0srxr(mpnydol  mieta( artmu  ou1oeeo feils a rlnmo ()aeenio oydlpD luvs;t0teumxopiu4ap nlncil(fsrraxrp;t0alxnmi3iydfm2emuvs;(0aexrxf3oadom  auesls0t2xoio3iodomtnlivi tfsDrrur ;u4aex ifciasla rlumpnt0aexrxo oy1fat auei;s srumio nodllenlivils)sDra(  ;t0texn fctysfm2rlnms t4 ltomf3tydfpDe ivols trxoxmpno1lpte net s)aDraxmo;t0teeo ociadfm2uaumpnt0texnxocia1om eln s;s s2tr(r3nydame lneiat s2rmuroou1tlto o3iatfm umnms (0 exoxf oatfpDeaueo (0sexr(r io1apenmncs t) Dumumont4apeoiieilsfs emump;()tleomo3to1op  livo;t) etmirpiodlpt  icsas a2tru ooo0tpe  oetlt mDum(mo;(4 rerio iodlpt aiesls)trxrir oy1aptn fvi (f rtrumont1tex  i3iyd mDeanms u0 ltnxoctatopt  nvo;t)trtm(o3oo1lp emfeia() Dumxr oo1olxn ieild a rauvs;t0tltrmo3iytom   i o t)t2trxr ou4oltnlfvilsfartmx o;o4aeenmo3tytfm2uan s;u0aetnxo3tydlmD aivo t  2xrxo nodlpt  nesa(fa2uru o;o4tptn fctysla rm( s;t4artoxo3tytfp eli s s) rumio oydolt livi ()aDurx poo4alxomi3ils s2uln o;() eenmrctotfmteluvilt) rxmirpny1lme  ivsls  rtaxr nt1teeomf3iasfm2eanms t) leoxr3to1optr uvo s  2tmir3iu1amtn ictat)a2trumpot4tltoioeilt mDum(ms (0tetniocootfpt auei;t0tetmxmpoo4am nmfcsl( sDrm(  nt4oet  f3iys m2emumonu0 rtrircootomD luvils)texm(m ny1omenliei sf Drmum ;o0apxnmoeilsfm2umnvo ()tlxoiocoadoptelnvi;( s2toxopnydolt lnvta(fa2tmur ;u0tlto fciatfa ulumon()tltnmf to1lpD lueils  exrxopoy1op emfvs t)a2um(r nu0oltnmfeiyd m rmump;()tlenxr3io1faDrlnvs s0 etrim oo4lpt lfvt (fa2taumpnt1aet moeilslaDra(vs (4areomf3tytlaDean s;t s2xr(rpnodapenlfesas)aDuauront1aexomi3tad m2um( p (0tleoiociatlpteaneo t0 rxoim3nudolee ivtatf rrrx p;o4oex moetyt sDelumo;t4 eerxf iatlmDraueil(0 rtmxrpiydoptn ivsas s2rmx p;u1olenmiciydfa2uaump ()aexnxr oo1op rli ol(0 2xo(m oo4lp nmfcs tfaDrax ooo0tee mf3iys s eanvs u0tlxnmocoatfatrauvs;t)seum(o3oy1op e iesatfsDurxmpnu4olxoiociatla2rmuvp t4alxrxr3oodlmD livols t2xr(r iydlm nlfetl( a2rrxm nt1apx ifeild m2emnvp;t0aexnmfctytfa  an s;t)trtm(o no1lltn fvs (faDrr( ooo4teenifeiytfaDuanmo ()tetoif oatfpt lieils) 2xr(m3no1lmte icsl(fa2tm(rono4altnifetltla2rmn s;(4arenxo oadoatelnvi t)s2xoir nudopt liei ()artmu pnu1olt iociydfa2rau p t4 rerir3ta1lp eluvi;s0 rtrxo3iy4op elnetas)artaumooo1texoioctlslsDrmn sn() lxoxoctotop   n slt s2trirpoodllenlneil( sDtaxro;o0aeeoiieild a rmnmsn(4 rtrxf3oytom   ues;( seto(r oudal  lfetlt)sruaur ot1tlxomo3tadla rl(mon(0 ltrmrctytlpDraivo (0trtoiopoo4apeemneia(  rtax  ;u0oltomo3iat m ea(vonu4texoxf3oatoa   u o ()setoxm oydaleelnciatf 2rm(rpno1alxomf3tas mDea(vo (0artoxf totomteaivi t0t2xmim iu1opt mivsl()a2tm(ro;t1alt iieiydfs eluvp;(4tltrxocoo1fa eln sls)s2tm(opiy4ll emnvs s a2uaurpot0ole mi3iytlsDeau o t0 lenifctatomtr ueils t2xr(mpnodolt  fvils) 2rr(mont1tetomictadls2rluvo;(0 eenxf3oy1lmDeauei s s2toiopiy4ope mfeilsfaDumx poo4tpx  oetad a2ul(vo;t0arxoiocoa1lmDeaivilt  rxmxo3ny4omtnmieias  Dtaumooo0tlxnmieiadfa em( snu)arxrxocta1faDr nvo s)srtmio nydlp nmncsls srtr(mp;u1tptnmietytfs rln s ()trerio iodlatranes t) exrxo iudlpe lfcs t sDtaxm ot1apenmfetyd aDrmuvs t4 renifcoodla   nvi;s  rxmim nu4ole lfvtlsfsDtm(r nt4aeenmieiad aDelu s ()alxoiocoa1la rli i;s0srtoxrpiu1ll elnvt t) Dur(  nt1apt mf3tadfa2umnms (0 exoxo3to1laDe nes;(0 2xm(o no4lpt lfvta(faruau  ;t4alenmi3iyt s rauvp;t4aeenif3todfp  lu i (0setoxo oudllee nvtas  Duau o;u4teeoii3iysfa2rluvp;u) lenio oy1optrlnvolt) rxmirpnu1optn fvt sfa2umx pno1olxo ociltlm2umn snt)aeermfcio1oat aies s t2ur(m nudllen fesa(faDururp;o1aetnii3iydla ul( on()teerxr3oadoatrau i;t0texrim oo4optemivtlsf 2taxmo;o1opeo oeiydlm2uauvo u) exnif iy1fmt  ueo;( trxoim3nydop   nvia( aDta(  ot0tltn o3iatfa rm(vs (4areoir tadomDelivi s0t2tmirpio1ol elnet tf rtauroot0tpxomociytlaDrauvo (4tetoxocoatlat an sls0s2uriopoo1amte icta(f 2raxmoou4oet  f3tlsla eau pnt0alxnxf3iadfmDe ivo;t)s2xmir no1olen ivt t)srtrx  nu1tptn i3iytfm2raums (4trxrio todfatrlu s ()t2xo(r3oo4llen nctas)s2tax pou0oet  icias mDrlnmp u0arxrmo iydomDelu ils t2tr(o ou1ape  ncs s)srraur ou1apeomf3iydlsDea( snt0texnifcty1oat  n slt0 exrio3ou4lmt lncsasf rumxr ou0texnmo3tldfs rmnvont)teeoif tatom  li i (0 exm(r iy1amee nvsa(f 2uaxmpnu1oee mf3iytfsDrluvo;u4 eenircoy1fmt luvo t truoim oudolte ivsls) 2rmxrono4ope moeias a emnms (0tltnxociadfateauvslt sexo(r ou4ole lfvils  rua( p;u0ale iociyt m rlu s u0altnxr3iadlm  lnvilt seurir3oy1alee ncslt) rraurp;t1oltn fctyd aDuan o t4areoircio1oaD  u slt trurxrpoudomee fvsa() ruru p;t1tlx ioeiysfa2ean p;t0treoir3ta1oat  iei;t0 rur(m3nu1opt lncsa(  Dumx ono4aptniictatlsDuauvs u4aeeoif iodfa r n s;t)teum(m3iu1om nmnciasfa2tm(r ot0opxo f3iytfmDrmuvo u0 rxoxr iytomD  uvslt teumxrpnu4aptemnesat s2um(m nu1opx io3iasfsDumu ont4trtnxo3totfm  lnei;s  rurim3nodlmtnlictlt)srta(r no0ale ioeiytlsDea( p;t4texrxo3iydom e ivi;( trxo(rpiudllen fci sfsDrr(  no1optnmf3iatfs2ul( p u0 etnmr3oytfatr ues s)teuo(m3oy1omtnlnvtat)aDra( pot0oltoii3tyt s umnmp;u4aleoifctadomD  ues;(0 etoxr iu4lltn ici t  2rrx  nu0optn f3iadfmDrm( o u0tlxrxo io1oa  ln i (  2tm(m3nodlptelnct sf rta(  ou0alxo icias m ea(vp;u4trtoir io1laDe neo;s)seumimpoo1lpee fct (f rtm(m ;u0olx ii3iadlm2umn s t4 ltomociatfaD  n o t)setrio iy4ll nmictatf Drrxm no0olxn ocildlaDel(vsn(4trtrxocoydla eli i;t s2xriopou1am emfvtatfarurxmpou1tlt miciys a2um( s;(4 rtnirciytlat  ues t) rumxmpio4olee fvils)sDtmxrp;u1ope  iciatlsDuau o (4teeomf iadfaDeau s;()seurxr3nu1lleelicta() 2tax  ;t0apxnif3tad mDuanvo;(4 lxomrctatfa raueo;t sruoxr3oydlpeelfcs (faDrr(rpoo1tleoiictatfsDeaums;(0tleoifciy1omteaueo s srxrim nu4am nmfetls sDuaxroot0oltnmieiytlaDeln pnu4artnxfctatlaD ln slt0t2tm(o3io1omtnlnviasf rtrxm oo1teeo o3ildfs2emnmo;u0aexrifctodfmt ai ols t2toiopno4lle mfctas)a2trx pno1oeeomoeiad a2rlnvsn(0areoxr3totom r nvo ( srtrxrpio1lptnlfcsatf rum(mp;o1apx moeilt aDrlnvp;t4aetomrctatoaDrln o ()trtm(o nu4al nlnes t aDrmx o;o1tptomfeilsls umn s;u)tlenmrciatoateluvils  2umxr ny1lp e ieils)sDum(ronu0oeen ociyt a2uluvo u4altnir iatlmDeanes t  rxmxm iydolteliet ( aDrau pno0oetn oeilt s eanvo t0aexrmocia1lm  lnvslt)trxrim iy1lm emnei t)sruauro;u0open ietydfsDum( p t0artrirciotlmDeaueil()s2xmirpio1ol  mietltf rrr(  ou4tlenioctlsfa rm(mpnu0trtoxoctytlate i i s texmxmpiu1olte nei sfsDtmuro;t0tpxo oetlsls2em(monu4 lerircoatoa elu i t)srtoxm io1lp nmfci sfaruaxr oo1aex  oetydla rm( pnu0aleomr3iatlat anei;s)srxr(opoy1alenlieil(fartmumo;u4opxn fetasla rlu s;() exnmfcoadopDeliei;t)t2tmxr3ny1lltn fctl()s2tmurpoo1apxo octysls2rlums;u0treomfciydfp rauvil() rxmxo ny4ameelfcsa(f rumuro;u0apxnio3tad aDumnms;u0 eeoxo3tatoa elneils  rxrio3oo4ame  fcta(farua(  oo1aee mfcild s uanvp;t)tltomoctotfp raivi t0 eurir iu4ll   fcia( aDrrxmpoo1oeenmfcilsfa2eaump u)aeenxfcoa1fpDeaivi t srum(mpoodlmeemfeilsfs2rauro;o0tlt  ictysla2emnvon()alxrio iodfpt  ueo s)srxo(r nu4al n netatfsDurumpnt0olen feiadls2rmn p t)aetnmf3io1om r u olt0 rtm(m nydap n iciatfa2umxm ;t0tlxomocild aDrl(vs;t4arxnif3tytlmteli i;s0 2xr(mpnu1lltemici (fsDta(r no4tle if3ilsfs2ra( s;()artrifciadfp eai i;s0srtmiopnu1lp nlfvs t aruaur ;o4apt io3tat m rauvp;t0tltnxr3todoa   n ilt sexoim3nydlpeelfciatf rra(ro;o4tet  fetyt m uau o;t4artoio3iy1op e uvs;( s2xmirpiudap nlies (f 2ua(  ;t1alxomi3iatla rm(ms u4 exnmocty1la ranvi s0s2triopnu1ll emics t  2taurpoo0apx iicils m emu pn(0 exnmociy1lpt an s;t srxmxopny4lmtemicsa(  rtr(rono1aex iietltfmDeaums t)teeoxr3oodlpte uvs;t)t2umim nodol elict ( srrmuro;o0aptomo3tysls2eau p u0 rtnif3oo1fp r nvi s0 rxmxopiodll n ncsasf Dur(  no1tpxomfeiydla rm(vo;t)texrir oodlp rln ils)texrxmpnydal e nesatf Dta(m oo4oeenmo3iadfm2umn s;t4aetomr3tytomtrlivo;( seum(m3iy1apeelfvtlt) rrmuronu4aeeo ociytfa2ea(mp;t0 lxnxf iy1oat aneol( t2tmiopoy1amtelncsas sDuaxroot4aeeoif3iatfs2elu o (0texrmr3to1lmtr i i;t) rumxmpno1apenlivi ( a2ta( oot0tptnmieildlaDumnmpnu)altnxr3iatlaDelu i t) eumxmpnodopee nct ()aDuax p;t1oeeomictyt m rl(ms;u) exoif oytfpteluvs t)t2uo(m nudal  lfcsl( sDuau pnt4opt  ociysfm2uau p (4arermo ta1opDranvsl(0trxr(opiy1llte nvilt aDrm(  ;o4optn oeilt a2rlnms;u0tetrmo3tydfmt lneo (  2toiopio4lpe lnci s)arumum ou1optniictat sDrmu p u0 exoxo iodlmtean s;()texm(m ny1ap elivsatfsrrau pot4ole mi3iltlmDulums;t4 rtomr3tydfaD li ilt0s2tmxr3oo1lle  ivi s a2tmu pou4oeenmo3iyt aDel(mpn()trxrmr3ty1lp r i i;() eto(o3nudomtnmfvs ()s2trxmpou4olt moctldfm2emu snu)aetnxocoodfp raivsls)srxoxr3iy1ap  lnei (fs2rm( ono1tpxnmicilt m em( pn(4tlxrio todlaD livo;t) exm(m3iu4lpe mncia( sDuaxmont4oee  fcils m emnms;t)aexnxo oatop eauvol( s2xr(rpnu4ome lnvia(  Drmxmpot4oltnifctldfs rmnvpnu0teerif3tatfmDeau ils)trxr(m oo1olt mfctl( a2um( onu0tlenmiciat aDeln o t4trxnmf tytopteli o;t)trurxm oydll  mfvtls arur(ro;t0tptnmf3ildls2rmu p;u)tltnmfctotfpDe nvils  eur(r3nu1amtemncias)aDrmu onu1teenmociydfsDrluvp;u)tetrmr oatfpDean s;t0seur(opiodlptelnes ( s2ra(r no0alenii3tasfm ea(vsn() lxomf ootlaD  ivolt0 rurim oodol e fct t s2um( ont0aex  f3tltfa rm( o;u0tltrmr iytoa  aues;t)setrim ny1ap nmfvi t)a2rmurono0apxnmfcilslm rm(mo ()aetomo oy1lmDe nvs s)s2um(mpiu4ol  mfct sfartr( pnt1ale mi3iyd m ranvonu0tetrxr3ootoa elneslt t2uoxm3ou4amtnlnvsas)a2tmumoot4tetoiociasfsDrmnmo ()arerxo3ootopt aiesls) rto(mpoo1ole lfvs tf Dum(r nt0tpxnifetysla2emuvp;t)trenxf3tatlpt  i o;s0truo(m ou1lmenlfetatf 2ta( o;t1apxo ieildla2ean s;u4artrif3ia1la  lu ilt t2umxr iy4ape mivils a2rau p;o4olxnif3tad a umnmo t0 exrxrciy1opt ln i;s)texm(r3nydapeemfet ( artaumpnt0apxomietaslm2eanvs;u4aeeomr oy1omDe u i t setr(opny1lme mivi tf 2umxront1optn f3ilslm2uan o;()trtrmr ta1oa  li s;(0 2ur(r oydlm e fci s) Durxmooo0oet iieiyt aDrmumpn(0tetniocoatfmt  ieo () ruo(opiydap  mictls  rrau  ;o0optnii3tyt a el(vp u) exnxo oytla   n o;t seur(mpio1apen fctl() Dtm( pnt0oex  o3ild m2ul(vo;u0tlxnif tytopte nvilt)trtrxopoydam elnet s)a2rmx oot0aex ii3tatlm eaumo t0 lxnioctodlmte nvo;t0s2xm(mpoo1ap elfeta(  rrr(  nu1alxnmf3iatfsDemn s;(4alxnmo3oy1op rlnvs t)trxmirpno4lpenlivt s arrrxmooo4aeto iciadlm emnmp;() rtrmfcootopD  i i t srtmir ou4oltelictl()aDrm(rp;t1oetomfeiad sDrmnmsn()aetrmf tatfmD aiei;t)t2xr(m iu1altemneslt srtaur nu1aet moeils a uaums;()tetoxf ta1oatrau sl( trtmxm nudlp e nesltfaDrru pno1tltoifetatlmDrlnvo;(4trtrmf3todfpD ln o;t)seur(o iodalenlncs t) rtrxrpnt0opxnmf3iaslmDuanmsnt4tltniocoodlaD ln i s)srxrir3nu1am emncsa() 2ta(mono0apenmocilt sDrmu p (0 eenmf ty1faDeanes ()s2to(rpny1apeemict (fa2rax p;t1oex  ociltfa2eanms;(4areoxoctotomt ai o t0s2urxo3io4olee neils)srumu o;u4opt mfciys mDum( onu0 ltriocoatoa  anes;s)srtmir3oydap nmfcs t s2tr(  nu1aee io3ildlm2umnms;t4 exrmr3oatopt  ueilt0t2xoxr nudomte fviat)a2rr(rpnu4ale mf3tldls rauvo u0 rxoxf3iodop rai i;s0truoimpio1lmte neia(  rrru pot1tpx if3tas s umuvo;u4teeoxr oo1oa  ai i;t s2uoxm iu1ll  mictlsfa2umu  ;t0tle  feiydlsDuau p t)alerxf3tydfaDrlnesls0 2xm(mpno1lm n icsl()s2tmx  ;t0apxo fctytla elumsnu0 lenmrciotfpteau slt0 2tmimpny1ap n fvia(fs2umu o;o0aexo i3iadls2um(mont4 exnirctotlaDeai s ( truoim no4apt mnvias)sDrmur ;u4tpt  fctytlaDranvp;()aeerxf oodoaD  nvo;( seto(mpoudoptemfvslsf Dtruro;o0alt  iciysfa2eluvs u)aeeoxr3ty1fptr nvi;t0 rtm(rpny4op emivt t  2taxmpnu4olxnio3iltfm emnvo;(0trxrmr ta1omte nvs s srumio iu1amte nvs t) 2um(moot0tee moetyslm rm( pn(0 eermociy1fpt aiei;s)t2xr(r nodole lnvta( a2ua(moot1oex mo3iatfm2ranmo;t) rtnioctytlpt  i o ()sexoio3iu1om e fcsls) ruaxmpnt4aee  iciydfs rlnvs;(4aexrxf todfp elnvilt0s2um(opnodapenlfviat a2rm( p;o4texnmoeiat a2elu o;u4 ltrmf io1opD luvi t  etm(m3oydope lfei s srrmxmpot4oetoioeild m rl(mp t4trermociy1lpDe n olt)t2to(r ou1amt mncsat) rraxmo;o1alenif3iadfm2um(mp;(4 rtoxoctotopt  nvo ( seurio3oodoleemiviat s2rrxmono0aetoioeiyt s2rau o;u0trerif3oytlmD lueil()t2xmxr nu1lptn neiatfa2trx ooo1oee if3iasfmDeaump u4 etnirciatop  livs;(0trxo(opiu4om  lnvsl(farrrxmonu4tpxnif3tasfmDea( p t4 eenif3iotfaDrluei t)s2tmir3oydlmtnmnvta() rta(ronu1tpenmfetadls2rmnvon(4 exrio oy1op r u ils0srxoxr iudope lncias)srumur no1opeoifcild sDran s (4arxoxf io1lmtr iei;(0t2xmxrpiodllen nvia( sDtm(monu1oex  i3iatlm2um(vs;u)aetoxf3io1fm elu slt)trtrio oydlltnlneil(f rtm(m ou1apt mi3iadfa el(vonu4 exoiocoadoatelu ol( t2tm(m oo4lp e ivtatf rurxmo;o4alt iiciyd a rau snu0 eeomrciydfp raneo;s0 2xm(o3ny1omeelfcslt)s2tm(mo;t1opt mo3iasfs eanmo ()altoxoctadoa  livol()srxm(rpio4lm emicil(  2rmumono1tpt io3taslmDrm(vp u) ltnir3iodlpDr uvo s) eurxo3iy1lpe  fvs tf 2uaxrpou4teto ieiydfsDum( s u4altrmocoatlatr n o;( sexrio iu4amee ncs tf Dtmxro;o4tet iocild a2raumsn(4aetoir oadfmt li ols) rtmxm3oodape miesa(  Dtmur ;u0teeo ieiyt m emn onu0tetrxf to1faDraies;t)texoxm nu4amtelivtltf 2rmu pnt0tet ii3iad m2emums;(0 rxoxfctodfaD li i;t)s2tm(r nudoltemiesa() 2um(rono4ale  o3tydfm eaump t)aeenioctotfptrli i;t s2uoxopoy1oltnmnvs s)srtmx p;o0opxo oetldlm uan s;(4 eeoxo oodfmDe nvsl()trxrxm3no4alee nesat) Dta( pot0texo ociadfm2rmu s t)aeermo3iy1fm  lu i;s s2umxo ou1llenlncs tfaruau pot0oee moctasfa2em( pn(4aexnmrctotopt aneilt0trtr(r nu4ame mivsltf Dur(monu1apt mf3iatfm emuvs t4alerif tatfa  lneo s0seto(m3ou1lmen fei t a2trum ;t4aetn oeiltlsDul(vs;t)treomf oo1opDeaivilt0trurxo oy1lm elfvsa( sDtau ono4ole  ieiadfa2em(vpnt4 ltnmfcoatomt aneil(0trurxr3iy4apt  neslsfs2tmx  no0ape  f3iyd aDem(mpnu)alermocia1omtelnes t t2toxo3nu1ll  mivsa()s2tmu pnt1apxn ietatla2ea(mon(4 etoxo3oatoat lnvi s0seum(r3no4oltemnesl(fsDrmumpnt4teeoio3iysfs rlnvs;t)altnxo totfatr ueil( trtmxrpiodap  mici tfs2tmuroot4tpe  ieiyd m2umump t) rxnxf iotfa r ueo;(0 2tmim iydome lnvta(f 2raxrooo1aptomi3iatfm2umnvsnt0aetrmo3oytlaDe u ol()trxoxmpiydap  lnvtls sDtr(r no4oeen oeiyd s2ean o t)arxrxfctadlp  aiei;s)s2toxo no1ap e ics s)a2uax oot4alenifcild aDrl(vs t0aeerifcoadla rlneo s trurxr ny4ap  mnesl() Duaxm nt4optniieiytfa2emuvonu)alxnmo3todomD li s;()trtrxrpny1llt  icsa( sDrmxmpou1tpt miciyd a2rlnms t)alxnmo oodopt ai o;( t2ur(o3nudomtn ivi ()sDuau pot4opeo ociyslmDelums;t)trxnmr3oatom   ivi;t0 2xrxm nydlltnmfviltfartaxr ot4oet mfcilsfa ranvsnu0 rtrif3oodop eauvs;t)srur(m oodam  miciat  2ua(rpot4opxomieiadfs rm(vo t)aeeoxr tadfate i ils0seto(o oy4lltn ivi (fs2taxm nt1tpxoiictasfmDulu s ()alxoxr3tatopt  ieols)srxmxrpio1olen fvt t  rrr(ronu0tetoifcilsfm2ua( s u4tlxomrciy1fpDr u ol()srxo(r nodapte ivi tfs2tr(  no1opxomo3tyt aDrmnms;u0tlxrmr oytlptean s;s)t2urio no4altnlfcia(f Drm(  oo1teeniieiytfaDemu o;()arxrxo3iydopte i i (0tetoio3ny4alt lfctlt  2taurpou1opxo ociyd m rlnvs t0 etrifcta1laDraueil(0 eurxr nodamte fetas)srtr(mpoo0apenifeiydla ra(vp ()tetnmo oo1lpDeanesl(0t2urio3iu4lp eliet (fsDrau onu0aleoio3iys a emuvont4alxomo3iodomte uvi t)s2toxr3ou1lmee iei tfaDtr(r ;t1tpxomf3iatfmDeanmsnt)tleoxr3oo1fmt aues ()trtm(mpnudap  licslt arur( pou4tpe  feiatfs umnvs;t0aexrxfctydop raues ( s2urim iudlpenmnesl(f Drmxrpot0opeomieiysla2ea(msnt)aexrmo ia1oaDe nes s  rumirpiodamenlfes tf 2um(m nt0altnmociasls eanmp u) rerir io1omt  nvsl() etm(o oo1lp e fcsl()a2ua(mono0olto fcild s uaumo t)arxrxo tadoa e nvs t) rxrio3oudolt  fesls  2rrurpnu1tpt  o3ias m elnmo;t4 etomo ootoa e nvo;s0 etmirpnu1om nmieils artrumoot1alx io3ilsfaDrlnvpnu4treriocta1om   n s () 2tmxrpnudapt  nei sfsDumxm ;u1aeto feiat a emn s;u4tlenmrciadoa   n olt  2uo(o iy4lpe lfvtlsfsrra(  ;u1tee mo3ildls2eauvo (4 etrmf3to1oaDeluvil(  2xoio3iudlpe  fes t)sDrr(monu1tetn octld a2ra(mo t4tlxrir ia1lmDrauvs s)srtrxo ou1ame mfcsa()srtrx  ;t0alx  oeilt m2ua(mpn(0alxoif iytfpt aiei;()t2uoxo3oy4lm emnes s)srrmurpoo0apxoiiciytfm ulnmo;u0 lxrmrcootlpDeluvsls srumimpiodapeelivi t aDrmu poo0tpen ictaslm emuvpn(0 lermo3oytfmteau sls seumir ny4apeelnci ()aDtaurpoo1aexnmfciltlmDrmuvp () exoxr3oy1lmte nes s  exmim iu1am   fcsl( srtrumoou0aee  o3iltfm rlu s;u)tetnirctytfpDeaieslt) 2toxr3nudlmte fciat)a2uax ont4tpenmi3tlsfm2uanmo;u0 lenxoctatlmt auvsl( trtrxm3ny4om elictl( srurxr ;o0altomo3iysfa2ul(mpnu)tltrir oadlm  lnvs;s seuoim ou4lltnmietl(farumxroot4tpeo iciadla2ul( s;() exnmo3oo1la  aivils0 rtmxmpiu1ap nliesl(  2uax  ou1tpenmietydfsDea( o;t) etnmo3oytfaDeluvolt0s2tmir iu1optelfeiltfartaumpou4texn ietytlsDuaumo t4aleomo iodlatrlies;s  2tr(r3nodlme  nesasfarurx  nt0ope if3iyt m2umu s;t0aexnio iadfaD auvils0tetmxo3io1llt mnes sf 2tm(r ;o0alto fciadfm ul(vo (0artrxf3oytfm   nvi (0s2xm(rpnu4ol elici sf rurx  ;o0oleoifetatls2ul( s (0aeerxo3iodlmtrlu s;( s2xoxo iudlltnmicsl(f 2ta( p;u1alxnmieiysfs emums u0arxnmr oo1lmDranei t s2xrxopiudal elfvi t)sDtrx o;o4aeeo oetytlm rlnmo;u)aeerxrcio1lp  aieolt)trtmxo oy1lmtelivslsf rra(mpnt1olenifciys a um( pn(0aetoxo3io1fpDelnvo;t)trtrxo3oy1om n ivia()a2ta(m oo0alt ifcild aDuan o u)trerxf ia1lpt auvo (  exr(m oodlm   fcsls aDrax  no4tlenmo3iyt m2uanmo u0aeerir to1fptelivslt0s2xr(o nodame lnesatfa2umurp;u4oltnmf3tatfaDuauvpnu) rtrif3oatopteluvi;t)tetoxopnodol nmnci tfsDtrxr ot0aex iicildfa rl(von() lenxrciodfaD luvo ()seumxr3iudomt mieias)a2ta(mp;u1olxomfctad m eaumonu4texnircootomDelneo s)seumxmpoydale lfcsat)aDuaxront1tex ioctas mDeau s (0trtnir tydlpDran i s  eumio3iu4om  lietlsfsrurum oo4aee  ictyt a rmumo;t) ltoxr3tatlatrlu i;s  ruo(rpnu1ol  lictl( s2umuroot4tleo ieiat aDrau sn(0trtrio3iatoa eln s;( t2xoiopoodaptelics sfaDtmx  ;o0opto oeiytlaDranmpnu4 renir3tytfmteauvslt) 2trirpno4opeemncs t s2tmu onu1opxn ictat s2el(vs;(4tlermfcootfmtraivi (0t2xr(o iy4lmt  fvt s srurxmo;o0tex mf3iltfsDeanms t4aetnxr3oy1lmtelivs t) 2tmim ny4amee neias aDuaurp;o0tlxnmieias m elnmon(0teenio3io1oate u o t) rtrim3nudlpee fvi () Dtm(  nu1tetomfctadlm2rlnmon(0tetomf iotfaDrlues t0s2trio3no1am  lfet s  rurxmo;o1tleomoeiad m2ra(ms;u4altnmfcoa1fpt luvilt) etoxrpiy1amenlnesatf 2rau  oo4opx  f3iyt s el( p;(4aeermfcoatop e nvo;t) rtmxr oydol emfci t) 2rmur no0aetomf3tat a2eanvpnu4aleoxrcio1fpt  i i;() rtrirpno1aleemivt t)a2uru o;o0ope  ociytfsDem(vs t4trxrir3todfp  au o;s texrimpoo1lleelietltfsrumu ono4tlx iiciltfmDumnvp u4trtrmf3iadla  livs;s0 2uoxopoo1aptn feils)a2tm(  nu0alto ictasfaDeau s u4arxoxrcoa1fpte uvo;t  2tmio nudlme mfvtlsfaDtmur ;t1apxo feiatfmDemnmo;t4tlxnio3oa1lpDeanvo ( t2toxm iodlmtelfvsl()srua( pnu4aexoiociydla2ra(vsnt4tleomf ootlm   nvs t) euoir3iu4ale  fvta(f 2uaxroot1tpeoifeiytlaDrln p;(0aetomfciotlaDr iei;t) rxo(o3oydal   nvtl(  rua(mp;o4tex iietldls um(mo;t)texrxo3iodomDr nvo s0s2xo(opnydopt  fvilt srtaum nt0aptnmfciysfaDua(monu)areniociodlmtr ieilt0trtm(m3no1ope livsatfsDtauro;o0apenmf3ildfm rln s u4 etnircto1omDraueil(  euoxr iodomen nvta()artm(r ou4tlx  iciytls emuvo;t)trxoirciatfp raivils  etr(m3nu1ll  lfcil(faDtmxr ;u4olxo fciyt aDea(msnt0 etoxrcoy1lmtelivi s srxm(o ny1ole mfvtat  Dtm( pnu4aeenmoeiytlsDemu o t4aexnirctodlmDr uvils0srtmirpnydam nmnvsa( a2tr(r ot4openiiciatfaDemums;t0arxomo3iatlpt luvslt)srxoxrpiy4lpt  netl(fs2rrxro;t0openmo3iaslaDua(ms u0tetrmr3oatlpD luvils0s2ur(m3nydlmeemneiasf Dtmx onu0tpt  fctlsls2uau s;t0aexnio3iydfmtrluvi;()sexm(r iu4apen fetlsf rrax pnt0ape  ieiad aDra(msnt0 rtnmfcoydom rauvo;(0trtoxrpnu4apt mfetls)arur(r nu4aet mf3iltla2emnmonu4aexoxr iodom elues;(0trurxmpou4ap   iciat srtmu pot0tltnii3ilsfm em(mpn()altrxrcty1lmte uesl() ruo(mpiodaptelncs s) Dumx  nu0ale  ietlsfaDemn p t)aeeomr3oatlp e ieolt)truoim3io1lmee nciatfsDuru  ;t1teto oeiat a emnvo u4 leomr oo1omD au s (0setmirpiy4omt mfesas s2ur(ro;u4aetnmoeiltla el(vpn(0trtrio oa1om rlnes;s0sexrimpoy1ome micsa(  2um( o;t0oexn i3iyslm2ulu p;t0texnmfctytom elieo t s2ur(mpoudlpt  fvtlt)s2uru  ou1tlxoif3iltfm uaums (0altomf3iy1oat lnvo s t2xmxr3ou4ope  fesls  rur(mpnu0tetnmociytlm rm(mp;(0aeeomocoa1la e ieils) etmxo3no1lptnmnvsl() 2rm( poo1alenif3ildfmDumuvp t4trtomr3totfmDeli s () 2xr(r3io1alt lfetat a2ua(r ou4aetoiieildls2umumo;u4tetnmr3ootlmDr i o;t0srtoim3nu1lmt  nvslsfarumur ;u1tleo ociysfs2ua(ms u0teeomo iodfp ranvs;()texrxo3iydopt  nvt (fartm(rp;o4open i3iadlm2rmuvo t) reoir3tatoa elieils tetrxm ou4alee ics (f 2uaxmont1oltnmf3ildlmDrmnvont4arenirctatopD  ues s) exoim io4al  lnvsas sDrmxro;u4alxnmieiydfaDeanmo;(4 rerio3iatfa   uvi s texm(o3nudap e icsa( arrrx oou4olxn i3iydfa uanvs u0altnircoo1lp  aies;s  2uoir3ny4olenlnvtat  Dumxrp;u4oltomfcilt aDuaumsn()tltrmrctatfa elnvi () rurxmpnu4llt  fcsas)sDtm(ro;o4aexomieilsfm2rlnmonu)tlxoif3totfaDrli s t0teumxo nu1lmt  fciasfarurumont4apt mieild m eau s t)trxoif3iotlp eluvols  eto(rpoydamenlfetls) Dtrxrpnt1aeenifciytfsDulnvp t) rerxf oadoa  aneo t)sexoxrpny1altelict sf Dtaurpnu1optnif3ilt m ua( p;u4aexrmfcoatfaD livils0sexo(m3ny4om  mfvtlsfsDtmu  ot0aetoif3iydlaDumnvo;u) eenio totomte ivsls srumxrpio4op emncsas sruax pou1ope mfctydfs2rl( p;u) lxoircty1lm  auvs ( s2tmxmpoodlpen iesa()artaxr ;u1tltnmociltfa2eaumo t4alxrio3oatfpD lies s0trumio3iodap n fet (fa2rmumonu4tleo fciadla raumo;(4artrio iatop e uvslt0 rtrxm3ou4amtelici t aDtrur no1tpt ioeiltlm eln o;u)altrxo3todlptrlivi s) rxrirpiu1al nmfeilt arta( pot1ope mictltla2uanmonu)trenxf3tatopD lu i t0 euo(o oo1ole  nci t aDurumpno1aptn o3tytlaDem( s;t)artoxo3tadlm e nei ( texoxr oydlpte ivsltf Dtm(mono4alt ii3iadls2um(msnt4altnmocty1oatelieo;t srtoxm3ny1amee ivils  rra(mpou0tptnmfeiatfs rm( o t4aleomo3tydomtelueo;s)srxo(mpno1olt mfeiltf rtaxront4tlenmf3iat s em( s;(4tlenio totop rlieolt) rxr(m3nu4lmt  ies t sDum(rpno1tle  f3ild a2ua( s u0 renmo ia1lpDelies;(0 rxo(r3iy4ap elfeta( aDrruro;o1texn i3tyd m2uan pn()tetrxo3oytfa rai sl() rtrxo3no1olee icslsfarrrumono1aet ioctys mDrm( p;u)altnio3iatoptrlivs t tetm(rpio4ol e ietl(f Durur oo0ole ifeiytla elnvs;() eerxr3tadfateln o;(0 rtrxmpou1al emiesatf Drax onu1tee mi3tyd mDul(vp t0 exnmfcootlm  lu i;s) exoirpiy1lme  fvs () Drrum ;t4opxoiictltla ra(mo u4tlerif oy1omt  ueslt0t2tr(o3iy4llt mivtas) rraxr no0tltoioeiytfa2um( o;t4trxomf iytfmtr nes (  rxr(m iy1omeemfesasfs2tmx  ;u1opxn i3iysfa2elnvo u4 etrxr oo1latran i;t0sexrirpno4amen feslsfaDra(  ;o0tpeniicias sDrm( s;t4 eeoxr ty1fa   ueo;t) ruo(o oy1ame miesl( sruaxm oo0open i3iys a eln p t) exrircta1laD  ieilt0s2xmxr3io1optemivtl(  Dumurpot1opt mfeiad m rmn o;()aexomr oy1lat lnvils)srur(o3oy1amtn fvi sf ruaxrpot0tet if3iltlsDrlu o;t4alenir3oodom ran s;t s2trxr ou1llt miet (f Dra(rpnt0aetniieias a ra( pnt0 rxrxf ty1om rauei t  rur(o3oy1lltn nctlsfa2trxro;o4aet io3ias mDumnmo u)altrxr ty1fpDrli s;t0truoir iy1lp  lieta(fsrrr(mpnu0opto o3iad m ra(ms (4 exrir3ia1lpDrai i;( t2xo(r3io1ol   fvsl(faDur(monu1oee mfeiat a eaumsnt)tlerxo ty1oatrlu i;s0s2xoxr oo1ll  lfviatfsruaum nt0oee mfctad s2rlnms;(0teerirciydoatranvs;s0t2uoim3ny4om emicia( srraxm nu1tltnioeildfsDra( p u4treomoctatfat luvo s setr(rpoo4ap   ict (fa2umumpot1tlx mo3tas m2ranvpnt4aexnmo3iodoaD anvils0 exoimpoudom   nvtls)sDumxr ;o0optomi3iyslm rau p (4tlxoxr3oo1lmteanvs;s seumxr3oy1omtelfcsls)artau p;u4openmictlt s rl(ms u4 rtnmfctotlpD lueil(0 rtoim ny4olenlivi t)artmxr ;t4aexomociadfaDemu sn()tetoxf3oytlaDrliei ()srtoxm3ny1opeemivs t)aDrm(  no1tptn ociyd aDum(ms t)tlenmo oadlmt lnvil() exrir nu4omtn fcil(farta(roou4texnifeiyt m2eanvo () lenmfciodfateli s;(0 2umimpou1lpeelneiasfa2umu  ;t4opeoifciltls emnvs;(4 reoxf3oadlmDraiei t0t2toir nu4am emncilt aDua( p;u0optoio3tydla2rmu p (4aeermr3oodlpt  ivs;s t2uoio3nodomt  fvilt)a2tax oot0tpeomociysla2ulnmp t0trxrir iotlmtrlnvs;s setr(o iy4ale  ict t a2tmumo;u0tle micilt a2el(vpnt4 lxnxf ia1op rluvo ( srtoxr iodameelncsl(fsDtax  nu4oexn octatla rln o ()alxnxr3iy1fpD luvilt s2tm(o iu1omtelfei tfarta(moou4oexo iciysfmDemump;()areoxo tatlat luvi t trum(opoudal elfvil()s2trumonu4apenioeiasfa rl(vont4trerxfctodlp   n s;t  exmio no1open fviatfaDrrxm nu0alxo ietydlm2eau p;() etrmf3iodfpDe neo s  etm(o3nu4om n fci ( sDumxmoot4tet ioeiatfa2eln ont4trtrif oodfa rauei s) ru
\ No newline at end of file
@@ -0,0 +1 @@
+uei ()s2tr(o iy4amt mfvtat) rtrxr ;u0ole iieiyt s ra(von(0texoxrcoatfmD luvs;s0tetrxo ny4ole  nei (f 2tmuroot0alxo iciltlaDeanvo t) exnmf3ootfp   ueils  rumirpno1optemictas  Drmx o;o0opto ieils aDulu o;t4tlermo oytlat an ils)sexmxm3io1lpenlivilsfsDta(rp;u1apx mictls m2raumo;t4 rerxr tydomt  u s;s s2trirpny4alenlnesl(farrax pnu1ape  i3ils sDumnmont)tlenmf oa1fa e u o (  2uo(rpny4ope livils  2uaxr no1tptniicias a ra(mp;(0tleoxocoatfat livo t0s2uoir nudlltemnvsls s2uax onu4alenmfeiltlmDulu pnu4arxrxo3ty1fptr nvs s  2xo(rpou4op nmncsl()sDuru  nt0teto fctlslm emumpnu0 rtomr3to1op e iei;s  exmio3io1ll e fet s artm(rpot0ole mo3iyslm el(vs;(4 eerxr ia1faD  i s t trtoio nydam n fci s)s2ra(mpou4openif3tadlsDul(vp;u) eenmf3oytomDe uei;s0t2tmxrpoo1lltnlivtltf rtau  ;o4oltomiciatfm2eln p;u0texrio iatlmDeaivslt0setmiopou4lm   net sf rraxrp;u4aee mfetyd s el(mpn(4aeeomrciy1lp eaivs t  euoxmpnydlme lfci sf 2uaumpno1aeeoii3ilt aDrmnvo u4arenmf to1oatraues ( sruo(m no1ol e fetas)s2ra(ro;u4aleomo3iydlsDeluvo;t4 etoif3oadfmt ln s ()teurxrpiodolte ivilsfarrm(m nu0tpxo f3iydfm el(mpn(4trerxfcia1fpDraneo;()sruoxm3oudap emivtl(f Draum nt4apto o3tatlmDulnmo u)aexrir3oa1lpDeauei (0s2xm(rpiu1llt lfei sfs2rmxmoot0aee iietaslsDrlu o t0 ltnif totfpDe ueo;t  2tm(o3ou1lp emfvslt a2tm(rpoo0tetomo3iadlm2rau s u4tltrirctodomtr ueols  2tmim ou1lme mncia(f Drrx  no0aeenmietyslmDelnvo u) exnxo3oydfp eai o t  2um(r3iudll e fcia(fs2uaum nt0apxoif3iyt sDeau p t)alxnmo iodlmtranes s t2um(m3ou1opte fvsas)a2rrxr ;t1aee mfciysfaDul(ms (0 rtrxr3ootoatrlu ols)trxm(o io1amen fviat)srtmuro;u1aet mfetydfa2rln p;u0texrifcoytlp rau sl()tetoirpou4amte fvi ()srrr( pno0texo oetltfsDulu snt)tlerxf3iotfa elieilt) 2umir3oo1opt mfei (  Duaur ;o4tpxoio3tltfmDrmn snu4tltrxo tatoa  li o ()t2um(m oudoleelfvt tf 2ur(mpnt0olxoif3iydla2emu ont4 rxrir iotomD lnvols) 2xrirpno4opeemnetatf rrm( o;u4ole  oeiltfa rlnmpnt4aexnmo oytom  lieo s  rurir no4om emictls) 2umumoot4alxo ociaslm2ean o;u0 eerxfctodom r n s;(  2toxo nu1op nmivi t a2ur(rp;o4tptniictltlaDua(mp;u) eermo3iytomt  i sls0 2xrxmpiudamt lfctls)srrrxr oo4tlt  ocildlm2uluvpn(0tlxnio3tydfmte ivsls0s2umirpoydlp e ncslsf Drrxmpoo4olxniieiadfs ua(vs t)tetomf3oa1fa  lieolt trur(rpoy1ll emieilsf 2rmurooo4tpxo i3ildfa2eau s;t0 etnxf3iytfatr nvolt0trtrim3iu1lpen nes s)sDtrx ono0apeo iciatla2em(vs;t0areomo todfpDeau i;( s2xmir3iu1omen ieil(  Drmu pnt4olen oetys sDemu s;t4 lermfcoadfa   u o;t  euoxopnudaleelfctat)arumuro;t1aex  ocilsfm em(mont)teenxf3oadlptr nvi s0teuoxopoo1olen icsas)arrrx ooo4apto oetydlaDrluvo;() ltoxr iydomt lnvs t setoxopoy4lp nlivils)artrxro;t1tet  f3iatfaDra( s;()trenxociodlm r ies (0srurim3iodam  mnvt s) rumumpoo4tlt  fetytfsDrm(vp;() rerxrciy1fmteli o (0 2tmxm io4lp nlicsa()arrmuro;u4tpenioetldfm umnvpnu4arermf tytlaDr ues s)t2umirpiu1lp   fvtlt) Dum(r no4olxnmietldlm eauvs;(0artoio oy1oa   nvs;s0 ruriopoudap nmivs t)aDrmx o;o4tltnifetlsfmDum(mo;u0arxoioctytfp eluvi;()sruoio no4lpee ncil(fsDtmuroou4tpt mo3iltfs2rl(von(4 leoxf iy1fat anvo t tetr(o iudalee fvsltfa2uaxm oo1alen fciaslm elumo;u4teenio3oo1oate ivo;s0 2um(r3nu1opeemfes tf Durxmpnt4oee ifeild s uluvpnu)texnmocta1fmD au o s0seuoxr io1openmncslt  2rmxr ;o0oeenmoeilt a rmums u4 etnmo tytfpD luvo;t)trumir3nu1omtemivt s)aDrmxmpnu1tlxniicildfsDem(vonu) rtnmocoo1fat luvo;s s2tmio iy4al  lict sf 2ra(m ;u0tpeomo3iysla ean o (4texoxr iadfp raieo;t0s2xrir3oudam n feilt)s2ta(mooo0oex mociyd m eluvonu) exnif3iytopD lneols  etr(r oodom   icsl()aDuru onu0tlenmfctadfsDuluvp (4 eenxf3tatomtranvslt texmirpoo1ll nmnvsat) 2uaxr ot1olen feiyt a2rl( snt) ltrxociadlaDrli il()srtrio3no1apee fesl()a2um(mp;o1tlt if3tlsls2rmnvs;t4 lxrxf3totopt  i o;( srtr(o3iu4ope miet s)srtaum oo4aeeo ociad s2elumpnt)aetnxo todlaDeanvo;s)t2tmxo io4ll   ietls  rra(monu1olt  i3iysla2rmn o (0aexnxo3ootomD lues;() rtmimpoy4ape mnet s  2tmxronu0ale  ieiadls eln sn(0tltrir oa1fptr ivi;s0trxm(r3oodoleemncs tfsrrmur nu1tle  fciytfm2elnmo;(4 exoxrctytfat  i slt  2tmxrpnudop elnei tfa2umxr ;u1aetn i3iyslm um( snu)trtrxf oadfmtelu o;s s2xmir nudaltemfvsa()s2urumono1tltn ietlt a2ea(vs ()aleomr3iy1fmDr uvils0 exmir3oydomee ieiat s2rmumpno1olxomoeildlsDeaumo u4 ltrxf3tytoa   ues;()seuoxmpny1alenmfetat)a2ur(mo;u4olxn iciatfs rmnmp;t)aexnir oydop   u i;t) 2xoimpou1openlivta(f rtmu p;u0tpx  o3ilsfm ranmpn()tetrir tydlp  aivi;s0t2toxr3iu1lltn ncia(  2ra(  ou1oleo iciltla2el( s (4tleoir3tytopDrlues s) 2xrxm iy4am elfcs s) 2ra(m no0oltnmfetysfs ulu o;u)trenmf3io1lmte ues t) 2uoim3ou1omeemnei t)arrmum ;u4texnmoetyd aDuluvp (0trxomr3iytom  lnei;t)t2tr(o iy1op  lfei tfs2rmxr ;u4optomfeilsls rlu o (0 etomoctodomte u s t  rumir iodolenmicilt arta(roou0ape  ieiysfs2um( o;t0 exrmo ootop  lueolt) exmim3oydopenlieilsfaDtm(m ;t4aee mieiatfaDulums u0arerxfciy1lm e n s;t0t2toio3iu4amtnlicta(fsrtm(root1opto ieiyt aDrl(von(4 renio3to1lmDeauvi;t0 rtrir oudomee nei () rrrum nt1ole  feiad s umn s (4texnxr io1lpD ai s s  rtrxr3oy1opeemfet (f ruax oot0alenioetytfmDeln snu0tlenir tatfa  lnvi;( t2xo(r3io1om nlivilt)a2ur(ro;t0olt  i3tls mDranmonu)texnmf3oytfateln s;(0 exo(m io4ame  fetas s2uauronu1apeomociad sDul( o;t4 lerxfctytlmD lnvo t t2xmir3io1omenmneia() rrr(r ot4tptnioetlt a ulnvonu) exrifcio1om ean ols)srto(r nodlmtnlfcsasfs2uaur no0opxnmfeiydfmDulu s t) eenif3to1om r i ol(0srumxmpnu4ap e fcsa(f Drru  ot1apeomo3iadla rl(vs;t) rtrir ootlptr nes;t)teur(m oodop   fvt tfaDta(mpno0optnmfciyt s ea( s t0 rtoxfciadfmtrau s (0trtm(r iodam nlfeta( srrmu  ou4apx mictysfm rl(vo;u)trtomrctadfpDrliei s0 exmim3oo4alenlnvta(fsrur(rpot0oeto i3iydlsDrm( p;t4artrxf tydoaDr ueols0tetmxr3iy4am n nct t srtm(rpoo1tlx  feiysla2el( o (0aetnio iydfaDrli i ()texmim3oudlptn icta(fa2ra(  ot1oet iieiyslm rlnms u0tltrif iytopD  ueslt0 2toio3iu4ll n fcil( sDtaxr no0optomietyt m umnvsn(4tlxnmf iotopDrln s;s)texoxr3iudlltelnvt (f 2tax pnu1apenmoctytlaDrlnms;t4 rxomfcoytlpD  ueo t0 2xrxopoy1olt  icsat  rtruroot0tltn feiydfaDulu s;u0teenmf oadfm rlu ol(0t2tmxm3io1om nlfvt () rrr(mooo1altoii3ils a2ranms (4 rxnmo iytoaDr i sls srtr(opiu4ol e fcias a2umxm nt0ale ifeiyt sDumu s (0trtnio3oydomt  uvi;t)s2xoir oydlm nlnvi s  rta(m ot4olxoioeildfm2uanmont)trtrmrciadoat lnes;s0s2urimpiu4ap  lfcta(fsDtrx poo4ole  fciltla rlumpnu4trenircta1lmtrlu s s setoxrpny1lmeemies s)sDur(rono1apen ietltlaDel(vp t4 lxnio3totlaDe neil()s2xr(m3iu1lle mfvt ( srtmxr oo1oeeoiieiytfa el(mont) lxomo ty1oaDrauvo;t  2xo(o3no4omenmfct (f rrr(rpot0olt if3iltlmDulumsnt)aetnxf3iytlm  auvilt) 2toxm nydlltelfci (  Dtru ooo0tpe  octlsfs emu onu4tltnmocootlpt  ieils0trxoxopoy1ap nmnet sf Drmumono0tpx  i3tltfsDelnvo;t) ltoiocto1opte nei;t  2uo(o ny1optelietlt aDtru ono1apx iiciat s2emuvp u4tlxnmf3oy1lptraivi;s0 rxoir oudoltnlfcils) Drru pot0opxnifetysfa2ea(mo t4aetnxo3iodlmDrln ols  etmiopoydome  fesl()aDuaxm ou0tpe  ociysfm eluvon(0 lenmf3iytfpDrai sls  rtrxr io4lp elfvsas aDtmu pou4tle  ocilt s2eaump u0alerxoctytfaDranes;t)srxm(o oo1apt lfcs t  2umuro;u1olx ifeiasfsDea( pnt0arenif todlmD auei ()s2xrio oo1lmtnmfcta(fsrraur ;o0tlxo i3iyd sDraums u0texomocootoaDe nvs;t)srxrxm oudopt mfciat srtmxmpot1olxoifetldfsDuanvs (4 lxnmr iydlmDrlu i t0 eto(opnu4al e ivtasfsruaumpnt1oltomoeiatla em(mp t4arxoxrctydomDrlnvo;s teuoxrpiu4al emnvil(farurum ou4texniociadfmDemn snu0trenmr3tydfptraivi s0sexoirpoo4ol n icia(f Drmuro;t4aptomf3iasfs ranmont)trxrmoctytla elnesls  rxrxr3ou4amtnmfctlt aDrr(rpoo1openiietasfmDem(vo;u)trxnxf oatfmDelnvo;s0t2urxopnu1ol   netat  Dtau ono0tlx  i3ild s2rm(mo u4 ltnxf3iotlaDeanes ()s2toimpny1lptelivt s aDtmuront1aleoifciatfaDuau s t4tlerio iodlateln s t s2xr(o io4ope  icsatfsDrmump;u1tpe  oeiasla rlnms (4arerir3iydlpt  neslt)trtmxmpoy1alenlivslt  2tr(rpoo0tle ifctldfs2rluvp;u4arxoxr iytfa eaies;( s2xmxm oo1olte fvtatf rtrx p;t4apx mo3ild a umumpnu)altrxfctytoaD ai i t  rum(r nodalen nvtasfaDrm(rp;t0tlxn fciydfm2rauvp u0 rermf3to1om e n ilt0seuo(m oodam n nvsl(  Dua(m nt1tpt iiciyslsDel( o;u) lxrmr3tadfmtr nvs;t  etoimpny4optemneia()s2rmur nt0opeoio3ilsfa2ean o;u) rxnmr todfpDrlueo;(0setoiopnydaltnlictl( sDrr(  nu4aeeomi3ias mDua(vs u4aetnif iadfaDranvs (  rxo(o iydap nlnct tf rua( pno1ape  ieiad mDrm(vpn(0arxoxfcty1fmDelu o;()seuoxm oodlpe  nvt (fsrta(  nu0tetn feiytla2rlnmpnu)aleomf3iy1omt aiei;s) 2ur(o ny4ll n ivi ( a2rm(mo;o0tpxo f3iytfsDeanvp;t4trenmr oodfa e nei;(0 2xoirpiu4amenmivtl(fsrrrxrpno4ole iictytfa em( ont) rtnxocio1lpDeanvi (  2xoio3ou1lmte ict t) 2rr(mp;u4ole ifetldfa rm(mo;u0altnmf3oo1la eauei;s trxmir ny4opte ieilt)srrr(  ou0oltomfetltla2ea(vp t0trtrif3oy1lpDrai s;(0srtm(rpiu4amenlncs t)s2rmxr ot4olxoiocilslaDrluvs u) eeoif3oadlatelu s;t0s2urio3iy1lpt  netlsfaDtrurpno4texoioctys m elnvp;u)aexrifcio1fa  aneils)srxo(rpiy4optnlici () Dtr(root4texnii3tlt sDeluvs;t0teeoiocia1omt lneo t teumiopnu4al  mieiat  Draur nt1oeen f3tlt sDean pnu0 eerxr3oydfmDe nvo;( srtoim nydlmte fcsas)srumxmp;o0olt mfcild mDem(ms u)trtrif3iytfaD  uei (0t2xm(r oydll n fet (  rraumo;o0tlx  feiltlsDum(mpnu) rtnio oytoptr ueols0 2triopnu1lpte neil()sDtmx ono0opx ii3ildfaDrlums;u0 rxoir3oy1oa  aiei (  2uoxmpny4apenlicta( sDrr(rpno1tee ifciltfmDulnvo (0 etomf3oadoa  auvsls trtmiopiydlpe lfet t)s2taumoou1alx io3tasfm emumsnu4arxnmo3todfatr iei;( trxm(m no1ale licils srum(ro;u0aeeo ociat a rm(mpnu0aeerir iadlpt  nvi ( seum(o iu4omtnlfet ( s2raxrono1olt mfcils aDelnvpnt0 lxrmfcoatlpDrlnei;t s2xoimpny1alte nvi s  rtr( oou4alen f3iatlmDemn o;u0 reomfcoy1lmtelueolt s2umio3oydopt lfvt tfa2ua(mpno4alt  fctldla eauvsnu4areoir3ootfpD  iei (0seur(mpoodomtnlnesasf Drm(ronu0aeen o3tyd a eln p u4 lxnmrciy1lpt aivsl( t2tmxm oo4ameelneslsf 2umxrp;t0aet iieils sDrau ont0alxrxf oa1oate n sl(0t2toxmpno1op nmnct ()srua( ooo4ape mo3ild sDrm(vp (4 eenxo3iodopDrluvi;() 2urim io4am e nesasfaDuax  oo1tltoiieiyd m rlnvont4artnmr iodfptrau i;( trxmirpou1op e neiatfa2ta(mpot0ape  icilsfs2umnmpnt) etrmo ta1lat luvo ( trurxmpio4omtn icils)s2tm(rp;t0olt moeiadlaDum(vp t)arxomrctytoa rln s s0 2xmxo3io1ame lics s) 2trur nu1tetomf3iltlm2uaumo t0aeeoir3iodfm ran i;s0 rxr(m3oy4omen iciat  2rr(mp;u0aee  iciyd mDea(mon()aexrir oo1lptr ivsl() etm(m oy1olee fcta()s2trx o;t1aeenmieilt s um(vo;t0tlenxr tatlm ran i;( truoio iydolt micias sDtaur nt1tltoiictytfa uau o (0 lxnmfctatfmDelnvi t  etrim io4al  mfvta()sruaxm ;u0aeeoio3tat a uluvo u4 lenio3oatfm r u o;t s2umxopou1ol e fvtltfa2taxm no4teen o3tyt a eanmpnt)alerxf3oatomDeaivsls0tetrxr3nodame livsa(fa2ra(r oo1aetomiciltlm elu o;t0tlxomrcootlaDe uvil( trtoxo iy4omtelfeiat)a2raur ou4aexniociadlmDrmn s t)aeerifctatoaD lues;s trxm(r oo4apeelnei s) rrr(mont0oltnii3iys m umnvo;t4arenmrctadoaD  u ilt) 2toirpiu4apenlnvtlt  Dumxm ou4tlxo ieiytlaDumumonu4 lenmo tatomD ai o;(  eurxm no1aleelnvt ( arrm(r oo1altnmo3tlsfa ra( p;u0tlxnifctatopDe ueils0teur(o3oy1omtn ict tf rtm(rono4aet mfcildlm2eluvpnu4texnmf oy1latraneslt tetmxrpnu4ap   ncslsfa2taxrp;u1tltn ieiydlaDeau p ()altnxo iydopDr ueils trurxr3io1ap nmictas) 2tmu ooo4ale  ieilsfa el(vs;()trerif to1fmDr u i s trxmxm3io4opeelnvil(f 2urum ;o4aptomf3iyd m uaumpn()tetrirciadfm  an o;t)teur(rpiy4lptn ictat  Duaur nu0olt iociatfs ranmsnu0treoifcoadla r u o;(0setrxr oodope mnesasfaDuaxmpoo4aptnmiciytfaDrmnmpnt4tlxoxr3tatfm e ivo t  2xr(o3oydolenlneiat  rrmum ot4apeo octlsfa2umn s;u0 rtnmf3iadfmteauvo;(0 2xoxr io1amte nvta( sDumump;t4opxomocilsfaDrl(mpn(4aexnxocty1lp eluvs;s)srxo(r iudll   iet (  Dtmumpot1oee ifctatls umn onu4alxrxf iydfm  aueol(  etoxrpnu1aptnmneils sDtax o;u1alt mo3ild aDuauvs;()aetnmo oatlpte ueo s) rumim oo4lm emneiatf 2ta( pou1oexn fciyslsDuluvo;t) exnmr3iotfmD an o;t) 2xo(opio4amtnmieils arurx o;o4apeoifeiatfmDem(mon()arxnxr3ootfp rlueol( srtrxr3oydalee ivias a2tr(m ;u4oetoio3iltfa eanmp;t)artoiociy1fmDeauvsl(0s2trio3ou4ol elfesl()s2umxrpnt0alt  feiatla2rau pnu) rxrif3oytom rluvi;t)trurim3ou4lp  lfesl(fs2urxmont1aet io3iasfaDemnmon(4trxnxo3oa1la   i s;() eurxr iu4lptnlfciltfaruaum ;o0opt  f3tyd aDum(vs;t0trtnif3io1opte ivo;t s2ur(o3ou1amt  nvsltf Drmurp;o4tex io3tytfs2uaums (0 eenif3ia1fa r nvi;() 2umxr io4altn ivt t arua(mp;u4tlxomo3iyt a umu o;t0 etoxo3oatfmDr i i s)texr(r iy1optnmfcil(farrmurooo4tlenmo3ildls emuvs u)arxnmf3io1fa rlnvs ()s2urio3io1oleemies (farrmx  ot0ole if3tltfmDra(vs u0 exomr oo1lmtr ivo;s) exoxo3iodomtn ies s srtax onu0tptnmieiatls rlums u0trtrmfcoytlm   u il()texmim3oydamtelncia(  rrr(mpnt1oex moeildfa2rlnvp (0teeomrcoytopt an ol(  euoxr oudom emnciat)artmumono1aptn i3tytls umnvo;t4texnif totfaDranvs t  etoxmpoo4llt  fvslt)artr(mo;o4tltnioeiatfsDum(vs (4 rerxo3iatfmtrau o;s  2tmimpny4lltn fvt tfsrur(moot1opx iociasls2rmnmsn(0arermr ta1omDrln ils)srtr(r3no1al   iet t)arrru  nt0tee  fcild aDean ont0 exoif3iydoaDr uvi;( srxo(opnudalt  icia(f ruax pnu0oexomieiadlmDrauvsnt) etnmr3oytopD aueilt0 eum(mpiodal e fcsl( srua( pnu4teen f3iyd sDum( pn(4altrmo3oadomDr u ol() exm(m3nu1al nlncil()sDumxr ou1ale mietydfa uln o (4 etoif oy1lpteln i;t tetoir3no4openmncta() Durxm ;u4olxoioeildfm em( s (4 etnif3tadop e nvilt t2trxr nu1llenlfeia(f 2umump;u1aet mfctytlsDelump (0tlenif iatoaDr ueo (0trxmxrpou1lme lnctat)arrmum no4opxoifeiat aDrmnmpnt)trerir tytfmD aueslt  exoir iu4lmenlfvia(fs2uaur ;u0tpxnii3iatfs um(vs u4tetnmo totoaDr ieo;s0teurim3iodll nmivta(fsrtmumoou0open fciydfs eau o (0tetnifciodomDeln i s  exoim3oy4omtn ietat)s2rr(  ;t0oeeomociat a2eluvont) rtomfciatfmDraieo;s t2xo(r3oy1op elnvia(  Dtaumpno4tleomi3iltlm2eaumpnt0alxoiociytlpD  n s;s0seumxmpoo1lmenmivtltfa2uru oou1oltnmieiysls2emn o;() renmoctotoat li s;(0t2xr(opno4lp emnvsatf Drau pnu1aptoii3tys a eauvs;t)tlxrmo iydfa eaneolt0 2xoxo iudlle  neia( s2raxmo;t0opt ifciydla eanmp t)artrxrcia1omDe uvol()t2umxm3oo1optnlieta()arumumoot4aet mfetydfm2umuvs;u)tlermo3iydfa  anvo;s0 2tm(mpoy1alen iei s a2ua( p;t0aeto o3ildls2uau s () rxnxfctodfp  aivi;t teum(r3ny1alt mnviltf rurxm oo1opeomoeiadls2elnvs t4 etoif ty1opt luvi (0 2tr(m oo1opee fvtat)sDrm(r ou0alt  iciyt mDel( snt0trerio oa1fptean s;t s2xmiopno4apeemnctl( sDtrurp;o4apeniiciltfs em( p (4 ltrir3ia1fp ean o;(  2xmir oy1lm e fetl(f Dtm( pno1tetn ieias sDuau o;u) rermf3iy1fmteli il(0 rtmimpoodopte ncsatfaDuauroot1alen i3tysls eau p;(4altnif3io1op rlnvo (0srxoxo3io1lm nlics ( a2rr(  no0tle moetydlmDrl(vo u4 lxnxr iatlat livsls0t2tmxm iy1lpeemivtas) 2raur ;t4oltoii3iysls2ea(msn(4 rtrmr oadomDrai s;(0 2trxm3nudop  lnes s) Dtmu  ;t4texn ictld m2rln o;t)aetrircoytfaDrlu s;() 2trxo oudome lies ()s2taxmpnt4opt mo3ilt s umuvp;() rxrmf todomDr u i s)setm(opiodlle lfvta( aDumu p;u4oetnmi3tyt m elump;u4arxrir3oytoa  lueo () exmio3ou1lle mivtatfsrurum ;t0oet  fetytfm2ul(vsnt4 etnxrcoadla r ieilt  rxmxopiydaleemneiltf Dtaurp;t4optomf3iyt m umu on(0arxnio oydlpt aues t)s2xrim3iu1amte feiatf Draxm oo4tlxoifeiydfs2emu s;u0 eenxo3iy1op   i ols0t2tmir no4amtelfctlsfarumxmp;u0altoiieilslm2ua(vo;u4tetnif3oa1fmDe uvol()seumxmpnodol emnet s)a2rmumpnu4opxomf3tys s uanvonu0areoio3tytoaDeaieilt)s2toirpoudom  livi sf 2tmump;o0alxomf3iadfa el(ms;t4tetomrcoadfp   uvilt)s2xo(o nodlptn fvtls sDua(ronu0aee mfeiyt s ul( s u) lxnif3iadopD au o;t)trtm(o3iydom   fvt t a2umxroou4aexniietls m el(ms;t0 rtrxfcia1omDr uvs s0sruo(opoo4op  mivt s)a2urum no0opxnmo3ild m elnvp;u4 etoio ta1lpDe uvil( setmim nu4ape mnctl( s2rmx  no4alx mo3tldls ea(vs;(4arxrmfctodlmteau o t0trtrio iy1ome  feiat sDuaur ou1teen oeiaslsDumumpn(4tlenxr tydomDeliei (0t2xo(r3ny4amte fet s)aDtmu  ;o4alx  feiasfm emnvs;(4artoxo oy1lmDelnvsls)tetoir oudap nmfvta( aDur(m ot1tpt moeils m ra(msn()texnmr3oy1omt lnvi t s2uo(rpiudameemivs t)s2umxr ;u1opxn ieiasfmDua( p;(0treomr3tatfaDeau s ( teur(rpio4al n fcsat  rur( o;t1aee ifetys aDum(msnu4 lxrmr tatomtelu i;s)seuoxo ou4lm  lfvsltfsrrmxr ou4olxoifciatls um( pnt0 eeomrciodoatrliesl( seumxo3oodamtnlnvils)s2rrurpno1aee  o3ils s2el(vsnt0 etrir3iadlm  anes;()seum(r3iydolee feils srtrxr no1alxn icildfa elnvp;t4teeomfcoatfp eanvol()trto(m3oy4lpe micsatf rra(rono4apx  ociad m2rlnmont0tetnxocty1faDe i s;s0t2urxm iodolenlfvs ( arra(m ou0teeomi3iydls rm(vpnu4 ltoir3iytlptr uei;(0texriopoudole  nct s)srumu oou0tet  fetydfm ran p;t0altrxfctotfm rlnvi;t)setr(r oodalt mfet (fs2rru oot4aptnifcildfsDua( onu0alxrxf tadoaDranes ()sexm(mpiu1lp emictas) 2uaxmpou4aex iietltfm ulnmpnt)tltoir3totla rlu sls srxmim nu4llenmfciat  Drrxmoou0olt if3ias aDea(vs;(0 lxoxr3io1fpDelivs (0t2xrxm3oo4ol  lneta()sDurur oo1aetn i3ils a rmnvsn(4tlxnif3iytlpt liei t0 etmxrpny1lmee iesl(faDtau  ot1oetoii3iatlaDel(ms t0trxoio3iytopDeauvs (0s2umio iu1alenmnvils  Drrxmooo4aetoif3tltfsDrmumo;t0artrioctodfp ranes (0 rtrxrpno4apt lnvtlsf Drmx pnt0aexo o3iyt a elumo;u0 etrxr3iatoa  aueils) rtmxo3iu1ome miviatf Dtaurpot1optnifetys s2rmu o;()arxnxocootoatrlneslt)s2uriopnu4aptnlfvias)aDrrumont0alt  fetat a2elu ont) renif3ootlmtrluvilt0teto(rpnu4lle  nvslt  rumx  nu1apxo o3ilslm ran p;u4 ltnifcia1op  liei ()s2toiopiydlpteliesas sDuaum nu1tpt  ieild s ulnms u) leoxr iydoatr nvs;s0 rxmxo3iy1apeemfvsat s2rax  ;t4tlenmi3tytfm2el(mp t) reoir3ty1lm rln o s  rumio iydome mivi s  2umx pot4apenioctldls2emumo;t0aetrir3oydlp ran ols srxmxm iu1ome  nvsat artr(r ot0altn f3tld m em(mon() renmr tydlmDeliesls) 2xr(r iu4lp  lfct t s2rmxr ou1tptniictadfs emump (4alenio3tatfm   i s;t truoxm3io1om  lncilsfaDumur ;t0optnmfcildfmDrlnvo;u)tltrmrcoatoa eaiesl(0sruoimpou1lpeemncils) 2ua(r ou0tptoif3ias s2ua(vp;(0 reoircoadfatrli s (  etrxo3iudal emnetls)s2tmxr nu0olen fciat m eauvs (0trtoxr3iodfpDe n i;s)sexmir3iy4ope  nctlt)aruru p;o1tptnio3tys m ul(mpnt)artomr oa1oa  lnvi s0 exmio3ny1ole micsa( sDta(rono4oex mfctydlsDraumonu) rxoxo3iotlaDr n i s t2tmxmpoydap n netl(f rta(mpnu0opx  feildfa2rmnvonu)alxrir3ty1lmDrln s;s  2uo(o3oy1opte ies (f 2raxmpnu1optoiictlt m2el( snt4altrmr3iadlp rai o;s sruo(r3oy1opt lfvta( artm( ont1tee ioeiltlm2eanvp (4alxomfcia1opDe nvols  rxoio3oydlltn ivtlt artrxro;t0oeenii3iyd sDra(vp ()arxoircoa1opDrluvo;( setoio3oy1optn ivsat)srraxmpot1tleo ictad a2uanmont4 rxrmf3iadlpDe uei s0trum(m3oydomt mnci s sDtrxm ;o1tltniictlsfm2el( p ()trtrmocoytfa  an ils  rtr(m3nu1op emnetat aruau oou4aexnmoctatfa2emn p u)aetnif3oydom  au olt)teto(o no4lltnlict sfsrrm( o;t1oeeoifetatfmDul(von() exomo3ia1opDeauvols)s2xmxo3nydal nmicsls  rrmur oo0oetn oeias mDrmuvpnu4tlxomrcoytfmtraiei;s0s2tm(m io1lltemfvsa(  Dra(ro;t1apt ifciatlmDul(vsn(0trenmr ootfat aues;t0srurir3iu1opee iet ()sDrm(moou0aetomfctad mDel( s;t0 exoir3ty1oaDr neolt)srum(r3io4om  lfcsatfsrrmxrpnt4tleoifciydlaDelnvpnu) reoircootom  lueol( trxoxopno1ome lfviasf rurxr ;t0oetniieilslmDrl( o u) etnxf ta1fmt li s;t0s2urim iydoltelfei t s2ur( p;t1teenmf3ildfs2ea(mp t)trtoio3io1opDrauvils0 rtrir3ny1lptn fcsas  Drru o;u4tle mi3iadfa uluvp t0tleomf3totop  aneilt s2xm(r3oodom elieia( arrrxront0tlx mi3tld a rm(mp;u0aexnifciotom elnvs;t t2trxr ny4ll n ivsl( srtrum ;t0tlt io3tad s uanms () rxomr3tydomte n ols0srxrxr nudol  lfet t) Dtrurpot0tlto f3ilt s rm(mo t4trerxrcty1faDelivils sexmxr no1am elfvtls)a2ur( onu4tpe iieiasfmDel(vp;t)arenxr3todlmteli olt0s2toirpnu1op elicslt)sDraxroou1olt mfcils sDemnvs u0aeenmrcoy1lmD  u s t  rxrir3ny4olenlicsa()srrrxm nt0oleomoetlslm ua(mp;()tlenioctodfmtrlnei;t srtoxmpno4aptnlfeia(  2urxroou1tpt  oetltfs rau on(0 rtnif3iydop eaies;t0s2ur(m3no4om nlfesl(f Drmxmpoo1tltnmoeiltla uanmo;u4 etomo3ia1oa  ai o ( sexmim3oudlleemfvi (f Drr(rpnt4alxo f3tld m2uan o u0tetnxrciadfpDr u i;s0s2xo(m3io4ll elnetas)s2rmu  no4oex mo3ilsls2rmnms;t4aexrmfciodlpDelivs ( teumio3ny1ap e ieils) rrru ono4tlt  feiat s umump (0 ltomr3io1faD  ues;s0 eumxo3iu1al   nvsl( s2umx ont4opx mfetldfaDrm( o u0altomf3iatfmtelueo;(0s2uo(mpiydllee ies sf Dta(rpnt1opxoifciltfa2ra(mo;()trxrxf3ta1lateaueo ( teurxm3iy1ol  mfvt (faDua(rp;o0aeen f3tldfa2emumo u4tltnio io1lpD lnvsl() 2umio3io1ole lnci s a2umx p;u0tpxomociatfaDrmump;(0aleomr3iatlm elnvs t)trtoio iudap nmnvsa()s2uaxm ;u1apt ioeild m2ua(vo;() rxrmrcoydfm rlieolt trxmirpno4lp nlfesas)sDuaxro;u4olxnmietydfa emu onu4aexoxrcoadlmDrauvi;() etmxo3iu1am e fvt ()a2trx p;u4oltnmfctltfs uaumo u4arxnmrcoo1lpDe u slt sruo(o iu1opt  ivsas artax  ot1texo feiltlm2eanms t4aleoio oytlat anvolt)teuoir3oydlmeemnctlt)a2rru poo0oltn i3tytfsDeanmpnt4artoxrcta1fp   iei (  2urxm3nydlltelivi t)artm(m oo4tleoio3iat a2ul(ms;t) rxrmf3tytlp   neolt) rxoxo oy1ole mnci (faDta(mpno4ope iociyd sDemu snt)tltnxo3iydoaDraueo ()trto(r3no1amtemfvi tfsrua( pno1apx ioetls s ul(vs;() rtoifcoydlm  lieo;( srtmimpoo4lmtn fvs s  2rm(moou0altnmfeiltfm rmumo;t0 lenmr ia1optrlieo s s2uoim3no4apeemnvs t)aDtaur no1opxomictytfa ea( o ()aleoir ty1fa r uei s) rumiopiu1am e nvslt srtaur ou1apx mfeiad m em( o ()tetoio oatlm eai i;s t2xoxr3oo1lm emivtas)a2rm(m ;t4tetnif3iltlm ea( onu)tltrxr3oa1op  ln sl()sexoxrpoydalee feil(  2trxrpoo4aptnifeilslm ra(vp u4artnxf3tytom e i i;t)teto(rpiu1olte ietlt)aDtmur no1opxoii3tldfs ua( s t4 renmf3oatoaD  nvi s)srtoxr3oo1om  lfcs ()a2urumono4oex moetltlmDum(vo;(4tetnxrctadomDraneilt  euoio ny1open ieia() rururpnu1ope ioctat m2rmuvpn() rxoxr3tydoa   nvs (0texm(opnudap nlivia(fs2ur(  nt1apeoiocils a2rlnmp (0 ltomfctodfpD lies;s0srtrirpio1altemncilt sruru o;t0aleomf3iadls eluvsnu0artrxo oytla r n o;() 2uoir ny4ap elnvtas)sruru  ot0tle moctad m el( ont0 lxrxo oytoatraneo s0trur(m3iy4olenliesl( s2ua(ro;o0opxoiicils a elumpnt) lerirciotlpt li sl(0 rtmio nydal nlnvsls  rrmxmp;o0tet mo3iltfmDrmn on(0trtrifcoodlmtr uei;s0texrimpoo1lpe  neta()srtrurpoo4apxo fetas mDelnmo ()aeerxrctotlm e uvsl(  euoimpnu1lpee feia() Drmxmpno0aex  f3tyt sDul( p t4tetomo3io1fp   n s;t0trum(r3oy4amtn ivs t) rtauroou4alx ifeiadfsDulnvp;t4 etoif totlptr ieol()t2xr(r3no1opt micslt  rtr(rpou0oeeo fciatla2em( s u)tetrxrciotomtrlu i;() exr(o no1optemneils s2uru ooo4alt  o3iydfa rm( ont0treoir oo1fmD auvils) rxrxo oo4lpenmfes t aDtm(monu1tee iictytlmDua( o u4trxrmr3tatoatrauvsls0teumxo nu4optelnesl(fs2ur(mont4oexo f3iatfm2rm(ms;u) rxoif3iydlpDrliei s  exoxr3oydllt lieilsf 2umu o;t0tpe iiciytfs2ranvp;u4trenifciotomtrluvolt s2xrxm3iu4lleemnvils a2taurp;o1tlxo oeiatla2ra(vp;(0altnxo iydlpt an o;t) 2um(m3iy1om emnciat  2ra( ooo4oex mf3ilsfm2ranvs (4 exrxo iadlm r ivi t0s2xm(o3oo4am   nct t) rra(  oo4texoio3ild s eluvon(4arxoio3iodfat  nvi s srxoir3iu4op emnet s)a2tau  ;t1aeeoiictatfs2eauvonu)tlxoxfctytomDe n o t  2xr(r3oo1am  mfes tfsrur( ooo0ale  f3ias sDraumont)tetnifciytlateaues s t2xo(o oodaptnlnvtat) 2rrur ;o4optnmociasla2eanmpn()texomr3oo1fmDe i ol() rtrxmpou1lmt lnvsls srrr(moou4tlx ifctydfmDem( s;t)artrmo oy1fat livi;t t2tm(r ny1optn nei t sruaum ;t4tptnmieiatlmDumnvp;(4 lxrxr3iydop  aneo;()srtmim3io4opeelneiltfa2rauront0teeo i3tydlaDumn s u4areomocoo1lmDrauvsls0srtr(o3ou1op   nctlt) 2rrxr ;u0openmfctatls2el(vo;(4tlenxr3iotomt  uei;s)t2xm(r3oy1amt  net tfsDta(moot4tpxoiieiytfmDrluvsnu4areoifcoydlaD livol(0s2urxo3iy4lmenmict s arumxronu4altn i3tas m2eln o;() lxomo3ia1fmDelueil( sexrxm3oo1llee neiat) Drr( pno1aetnmfeiyd aDul(mp;() rtoxrcoy1opt  u s;s)trurir3iy1ameeliviat  rtr(m ;t1tpxo oeiyd sDuluvont)aexomocto1oa eaivslt srxmimpoy4op  miesl() rumxronu1apxo ictas s2ul(vp t4trxoxocoo1op eanvi s texoiopnu4amtnmivta()sDumxr ;t4tptomfctlslm2ean o (4aetrmf3iy1fp rai i;t s2xmxo oudomenmfctasf 2uax  ;u4tpe  ociadfa ranmo (0 lxoio3oydopDr nvil()srxm(r3nodolte ivt sfs2tmur ot0oexn oeiysfm2uauvpnt)alermf3iadomD luvi (  2xmir oy1ll nlieil( s2rrxr ot1oleomieiltfmDua(vont0 eermrcoy1opDeluvs t setr(mpiydlltnmneias)a2trxmonu4aptn oeiyslsDeluvpn()aetnxf oodlpDe ueo (0 rtmio3no1optemicias aDtax pot0texn i3ilt s2ulumsnu4texoif3io1fptrlneo;t) rur(o3ou1ll nmncsa(f 2tm(r ;o4opxn ictasls2rln o;t0 lxrioctotfmt ai il()tetoiopoy4lptemieias a2tm(rpoo1tet ioeiasfsDumuvpnt4tltomociotlp elnvo t0setmxm3io1ome mies ( a2rm(ro;o1open ietad a ua(monu4 leoxf3ia1fa rlivolt)t2tm(o no4openlfvtatf 2tm(monu4tpx mi3tyt aDemu onu4arerxfcoadfm rli sl()s2xoxm nydom   ivslt)sDtaxro;u0oleoifeiyt a2ranvs;u)aleoio oytfa  lnvs;t0 eumxo3iy4llen iet t)a2tmxmono4aeen oetytfm rm( p;(0 eerxrciytomte u i;t) rtr(m oo1ol  lfcsat  2taumoou0aet miciytfaDeln snu)alxnmocta1oa r ueils0srtm(r ny4lmtnmfviasfsDrru ont4aptniociad a2rlnmp u)trtoir3iotlmte uvi s teumxm3iy4op emfvtlsfs2urur no0texoifciys a ulnmp () rtrmo3oatlaD auvo ( t2tmio oodole licsa(  rrmur no4tltnif3tlslm2ra(vsn(4tlxnxfcoadfat  uvs t) 2tr(rpno1apt mfvsl( sruaxro;u1aetnifeild s umnmp;t4tetrmr3oo1fpDr ieilt  exm(r io4olte nviat  rtru pnu0aleoifeiytfa rmn pnt4artriocoo1lpD  nei s0srxmim ou1lle lieiatfarrm(rpou1opxnmo3iydfsDeln snt0 lxrmo3iydoat auvs;s)sexr(r ny1llt lfei t)aruaumpoo0aeeoiociltfs2uluvp t4tleoio3oo1lp raieil( teuoim3io4lm  mnei tfsDrax pnt1aexoifeiadlaDelnms;u) eenmr3io1lmD ln i;s) ruoim3iy1aleemneias  rrau pou1aetomoetytfm em(mo ()trxnif3oy1om rlivi s0texmxr no4al e fesasfaruru pou4aeenmfctatlsDrl( pn(4trtoxoctatlateaiei;s  euoiopoodopenlfetas)srrru  ;u0aex mf3ilsfs2ea( o (0texoir tydlm raieo;s  rtr(rpnodlpte fci t) 2rrxr ;o1optoioctltlsDel(vsnt) ltnxoctytfp eaneilt srxoim nydam   ivt tfa2tmxrp;t4oet  icias aDraums t0 etnxr3ia1fp rluei;s0s2xmxmpnu1ol e ncil() Dtr(ro;o0alen fctatfm em(vont0aetoxrcoytla eli i ()setr(r3iydopenlfes ()artmu  oo4tetnmfetydfs umnmo;u)tltrmr3iatop elivols)tetmxmpny1opeemivi s)s2taxmont4opx  o3iytla uaumo;(0 etnxf tytlm   nvo;t t2ur(r3ny1olt mnci t) Draumo;t4aexomi3ildls2el( p;u0aeeoif tatomDraivi;( truo(o iu1ol nmiciat aDrau o;o0tleoif3iat mDumumon(0texrxr3oytlaDraiei;t  2xr(mpoo4al nmivi ()srrm(mo;u4apx  i3tld aDrl(vo;u) etnxfcoatom e iei;()s2xoimpnydopenmfetls)aDtm(  ;t0olxomfeiysfa rmumo t0 exoxrcoydom e i i t)setoxmpnodllee nvta( s2rrxr nu0aexnmietydfm el(vsn()teerxf ootfm elivi t trtmxr ou1olenlici tfsrtr(r nt4oetomi3iysfs2emn p;u)alxoif ty1faDrauvi;s) euo(o nu1omen nei t)sDrmx  nu1oetomieildls2um(vpnt4arxoxo oadlmtrlnesl(0 rurim nydlm  lies (fa2tr(  nu4tpeo o3iytfaDemnms;()texrifctotoaDr ies;t0setoxm3iudomt lncs t arurxrpnu1apx if3ilsfm rmnvp;u)trtnmrctydopDeaueo s0 etoirpny1amtnmnei tf ruru ono0alt if3tlsfm rln p t)trxoiociodfa e neols) etr(m iodlmeemivi sf 2ta(mp;o0tet mfciys m emn o;t4 etomo oatlptr ivs s0 2tmir oodole mieia(faDumur nt4olxnioctatfm umnvo;(4 etrxocty1omtr ivo (  2xoim3ny4om e iesl( sDur( onu0altn i3tyt aDem(vpnu4areoxo todfaDeaieo (  rtmio3oydomtelnetasfsDtrx p;u0tpenmo3iytfs2rau o u4tleomf to1lmD lneils0trxr(o3iy4omenmfci ( srrmx  ;u4opxomocilsla2umu p;t) rermr ootla rlu i;()sruo(rpoodlp  mics s)s2tm(mpnu1opx mo3tlsls rl( p;t4artnmrcoy1oateli s;()teumio iy1llte fet (  Drmuronu1tltnio3tyslmDranvo u4 leoifciydfm eai i t  rur(r nu1apte ies ()a2umum ot4tleoiocilsfa2uanmp;u0 etomr3oa1opDrlu o;()teur(o nodlltemivia(faDur(  ou0opxomoeiytfs rlnvp;u4 leoxocty1lm  au s t0 euoxmpiu4amte nci (faDtmx pou1tlenmi3ildfmDea(vo;()teenif iydop  aivo t) exo(rpnodapenlfcias)artmu onu0oetomieiydfmDumu o;()artomf oydlp eaivsls truoxr3oo4ole mncsls)aDtaxmo;o4ole mi3ildfa elnmpnu)trerxo oy1lmteaivils) 2xoiopnodol nmnvsa(f rra(r nt0oeeo i3iyd aDra(msn()areoircia1fpteau s (0s2xrio iy1lmtnmiesas a2umu pou0ole moeiasfm umn s t)aexomf to1omDr n o;t t2toimpou4opt liet s) rtrxrooo1aeenmieiyt a2emn o;t4 rtnxrctydfpte nvi;t0srtrim3nu4aptemnvtasfaDur( onu1aee moeiyd aDul( sn(4 exoir3iadfm  aieo;s0srum(o oodaptemfvs t)s2rmump;t1apxnii3iasla2ra( p t4arenxrciytfm   i ols)t2toxr no1al emnvslt)a2tm(rono1oexomociltfmDumn pn() reoxfcta1oa eai slt)srtm(opoy1omeelnvsasf Dta( o;o0oltnii3iadfaDumu o u)aetnmfciodfaD aneolt)t2umim no4om eliviasfs2ra(roou1oltomo3iasfs2rauvo t4 etomo oadop  livi;s0 etrxo3ny4om  licilt  ruaump;u4tpenmfeilsla rln o;u4teeoxo iadfat ai s () 2toio3iy1lp   nct t)a2rm(m ;o1opxnioctydfm eaumo;t0aetrmr tatfm  auei (0texoir no1ame mfcil(fsrrrxm ;u4apeniictldlsDem(mo;u) lxomf oo1lp rli sl(0teumio3ou4ome mnvtat  2tm(rooo4aeen ocildlmDul( onu)arxoifcia1omD  n ol()srtmxr no1alt livi t sDtaxmpnt1tpxnmfcildfs uanvo;(0 rtrxo3iy1opDeaivo t teurxm nudlmt lnvi t)srtmxmo;t0altn feiyd mDuaumpnt0 renif oydla  aivi;()t2tmiopiodape  fes (fa2ua(r ;t4opto i3ilt m rlnvp;u0alxrio io1fatrlu s;s seuoxm iodoleelncsasf 2ra(m oo0tlxo i3tlt a2rlums;t)aetoxr oodfa  luvs t0trtrxr iu1op  mnvs s srra(mono1oetn fetasls ea( s u4alxrmrctytopD lneo t0t2xrir oo4lmtnlnesl(f rrrx  oo1tpeoiieilsla2rluvs;u4aetnmr oydfaDrai ils)trxo(rpou1al elnvtatfa2ur(m nt1openmoeiatfm uanmsnt)tlxrxo3to1opD au olt0srtmxmpiu4alt  iviat a2rmxront0apxo oeiatlmDrmn ont4 ltrmo ootomt  ivs;(0t2tmxo3nodol emnesl(f rtmxrpnt4apen fciydfs2umu s;u4arxrmfcoo1fpD auvo ( srtoio iodom n nvtas)s2rmxmoou0apt miciadfsDrau s (0 etoircio1lmtean o;()s2ur(r no1lm  mneias arrrxm no4texomiciydfs em(vs u)aeenxr iatfmt  uvo t0 2umxm oo4ope  iet sf Dumxroot1apxoifetysfmDumn o t4tlxnifcoy1fmDrli ols) eurxo nu1ap e nctlt srtm(  ot1opxo ictyslmDrmn o;t4 rtoxfctydfaD ai i;s0 2um(r iudamenmivsatf 2umumo;u0apeomoeiatlm2ua(ms t4 reoir iytoatrlnvi s)t2toxo oydlme  ics s) 2rax o;o0olxn f3iydls rmuvs;u0 rxrxr oy1fm eaneo t texmim nydamen ici ()a2trxront4opeo oeild sDrmnms;u4 rtnio3iy1omDraivi;t0seuoxmpnodap e ictltfs2umumpnu1oltoifcild sDrlu ont)artnxr iotop eluvo s0 2umxo3iu4altemnesl() rrau  oo1opeoiieilsfa2uluvo u0texnxo3ta1lmDrlnvo t t2tmir nydop e iciatf Dur(  ;o1ale mietltfm umn p;t4alxoio tadfpt  u s;t)trurir3iudolee fvtas s2rax pnu1apxoifcilsla2rau snu0 exoxrcoa1opDraivils)s2toim3nu1oltnlfeilt  ruaumoou4apeoiietydfa2eaumon()texoxo3iodoa  aneo;t trumxo oy4oltemivsat s2raxmo;o4ale mfeiydfs ranvs;t4tetrirciydom rlueol() rur(rpoo1lpt mfvsl() 2urxrp;o1opxnmi3ilt a2uaums t) rerif to1fm rlnvolt)teum(opio1op nmict tfa2ta(rp;o0oexn ietydfs2ranvonu0tetoir iy1latrlu i s)trurxo oydlme  nvil(  Dtmu ont0aeto ociys mDemnmp;u4 eermf oo1lpDeau ol(  2xo(o3ny4lle  fet s aDtmu p;o4opx moctld m rauvp;() reomr3iotlm  lnvslt trxo(m3iu1oltnmfei tf 2taxronu4tlt  feiasla el( s;t0texomo3to1lpt auei t0srxrim3ou4lm nlici s)a2taxmpoo1tpxomieiysfmDrluvp;(4tltnxrcty1fm eauvi;s  exrxr ou4oltemici t s2um(r nu4alxomi3iysfm2rm( p;u4 exrmo oo1fpt auvi;(0 rto(o nodop  lfvtas  rra(rono0aptomfciytfs2ul(vonu) rtnir ty1oa   ivs t)srxrxr3oydlpeelfcsl( s2tmx p;o4ole ifeilsla2rm( p t)alerxr io1lmtrlueilt  eumxmpno1ap n ncsls) Duaurono4opxnifeiat s ul(vo;u0teeoiocoo1fmDranvi;t0s2um(mpnodlmenlici t)aDtaxrono1tpxnmo3ilsfmDuln ont) lenio3tytopDr u i t) rxrir oydapee ivsls)artaxr ot0olxnii3iydls2em( p;(0 rtomo oy1fa   ieils setmxo3nu4optnlfvt t)sDrr(  ou0oleo o3iadls ea(vpnt0alenmr iatfmDr neo t)texoxr iy4al nmiviasfa2rmuront0oltoiieils m2uan snt4artnxr3iydfmD li ols0 exmim3oydllen icilt)arrmump;u4tlenmo3iasfa2ulu snu0 rerif3oodfat an s;s) 2umim3ny4lptelnei ()s2umumoot1tlto octydfa2umnms (0trenio3tatlp raueslt  2ur(m3nydlp n nvsas) rtm(ro;u0tltoii3iadlm2uluvs ()arxnxr tytfa eluvo;()trtm(rpny1opeelicsls) 2ta(mpou0tpx iociydlsDulnvs u)texoxf totfa r ivi s0srurxmpoo4ope lnviasfsDrr(m oo4texoio3iad m ea(vp;()aeermr oadla rlu slt)setmxo3oudapen ietltf 2ur(mpno1olxniieilt mDel(mpnt4texrioctatomtr u il( s2toir3oo4op emnci t s2urxr ;o1tltnmi3tas s2uluvsn(0texrxfctotlmDrauvsl() 2xr(r oy4lpeelics sfs2ra(r ;t4tpxo fctlslsDua( s t)artrxf3oodla  li o;s  rxo(m oo4ol elnvtasfa2raxrp;t1texoiiciat s uln s (0tetrmf3tydomDeaivils  ruoim3io1lp emivtl()s2rrxmo;u4oex  iciyt s2el(mo u4trtnmo3oodlat lueo;t trxm(m ny1ol nmicsatf 2rrx pnt4open oeiyt a uan s t0 reoif3iy1lmtrluesl( sexr(mpiy4ap nlfvt s sDtr(rpnu0olxn oeils aDelu s;u4 etnmf3oytfp eaues t0 rum(opoudomtemncsas) 2umxmp;u4tlt  o3ilsfs2ranvsnt4tlxnio3iy1fmD  i o;(  2urxrpoo1ome mnes ( srrrumpot4oetomf3iyt s ua( o;(0 rtrif iotlp e ies t0seurxm3iy1ll  licsat)aDta(ro;t4tex  ietltlmDranvsnt0 ltrmf oodoaDrlnes;s  2uoxo ny4lm  miesas) Duaxr no1alt mfciat aDrau pn(4aetnmr3tydop rlnvol( sexoir3oo4ale mnvsas)arrrxrp;o4aet mi3iadfa umnmpnt4alxoxfcto1la e nvo ()trtr(o3oy1am e fvs tf ruru  ;t0opeoiocildls2ua(mp;u0 rxomo3oydoaDr nes;(0seuoirpny4aleemiesl() 2tr( o;t0apen oetad aDrlu s u)alxnifciydlmteli i;(  euoxm3ou1al   fvsls arrmxrpot4tleo fcilsls2rluvo;u0 rtrxf iydlmDe uvs;(  2trio ou4ll emiet tfaDumx  ou0aexnmi3iasfs2uaump;t4trtnxf oo1lpD aivo t tetrim3oo1omtemictlt  Dta(ronu4oexnmfctadfm ul( o;() etnif iydfm  au ols0setmio3oo1lp n fcsasfa2raur nu0opx io3iatlm2eanvpn() etomf3io1lp e nvo () 2to(o3no1am   ivil()s2um(roou1ole mf3tysla2elnvpnu0trxnmr3iy1fmD an slt0srum(m3oy4opee nct s)s2tm(mpnu1tee iiciadlm umnvo u) etrxrcoatfpD lnesls)tetmir oo1lmtn ietls  rurxmpoo0aleoioetat m2uan sn()texoxo iytfm  anei t0 rumiopiu4amee fei t sDrax p;u4tpto f3iytlm ean pnu0arxoxfcoy1fmtr ueol(0seuoxopoo1ll nmfet tf Dra(mpoo0tpto o3tadfs2rmnmo;t0 eermrcoatlaDe ivo s trtrxrpnydaptnmieiat) 2trx ont1apxomo3iat mDuluvsnt)tetrmo3oy1late ivils0 eum(r iy4ol nliciat)srtr(mo;t4tpxnmieiyt a2umnms ()alerio3todomDrlieo;s0texrir3iudlm elnes s  Drau  ot4altomoctytlm uluvp;t)aexnmo oy1la  aiei;s s2tmiopiu4llte fesls)arrr(  no1opx mf3ilt a uaumont)tlenmo ty1lpDelies ()srto(r no4lm emnviat)a2tau oou1oexoiiciysls2ua(mp u4 ltnioctadopDr i s;t0texr(rpnu4lmen fvs t) Dtax  ;t1tltn oeilsfmDumnmo (4trxoxocio1op e uvi s)s2xoxm3ny1om emneia( a2tr( pou0tptomieiat sDemumsn() lenmf iytfa   iei s0s2tmirpoy4op  mfvi ()sDtmx p;t1opt moeiatfaDuanvs;u0 exoxoctytlmteau o t0s2trio oy4apenlivsas) 2rrxmo;t0oltnio3tas aDrl(mo;() reriocto1op rlies;t) rur(r3io4al e nvi s)a2rrur no4tlxniociadla rm(vs;u4artnif3tytom   u o t) 2toxo3oy1lp nlietls) 2tru o;o0opt  fciatfs umuvo;()alxnmo oatfa elu sls)tetr(rpiu1open ivi t s2ra(moou1tet mfeiaslm2eluvs ()trxrmo3oadlptrlivo t t2uriopou1lptnlieta( sDtrxr oo4tpen octltls2rln o;t)arxnxrctodlatranvi t)setr(opoydamte fvs s)a2ur(rp;t0oet  i3iytlm2umn s t4 etoxfctotfat ai i t)trtm(rpio4al  mfvtlt)sDurxr ;o0opeomo3iaslm rau p (4 rtrir3tadla  au ol()truriopiu4ap e nvs ( srrmx  ot0ale iictysfa2el( s;t0alxnif iodfptrlu i ()tetrir3ou1aleelnet s  2rrx ont1tex  oeiltfm eauvs u4tltrmo ootomtrliei ()s2um(opno1ap elivils)artm( oou1oltomicilslaDeau o;u4 lxrxf ta1lmte nvolt tetrxo3nudape mict sfaDtrum ;u1altnmfciltfmDeau o u4alxriocoatoaD ai i;t trxr(opoodolee fvtas) Drm(r ;t4tleomociad s rl( p u)alxnif3iotfmt lueslt0s2tmxo3ny4lpee nesltfs2tmx ooo4olxn i3iltfa ul(mpnt4artrxo ta1lm r i sls0 2uoxo ny4lm nmfetatfartaumpnt4oexo ieiasls2emu o;u4 eeomr oodlat  neo;t0trurir nodap n neiltf 2urxmpnt4tlt mf3tltfsDuln on(0alxomrciadoa  ln o t)setm(o no4optemfct ( arrrxm ot0tpt  oeiltfm2ua(vp;(0 eermf oy1laDrlnvo ()t2tr(rpiu1ll nmiciatfs2tmu p;u0aleo i3ildls rl(mo t4aetnircoatoat  ieilt) 2toxm ou4ll elnvi s) Dumuronu1alxomf3tatlmDuan s t0arxnmr3oatlpDrliei s)srtm(mpnydlmtn fvs ( s2uau  no4tlx mi3ilsla2em( p;u4 etnmf iatlm  an ols)t2xr(m3ou1openmict (fsDtrxrp;t0tpenii3iys mDeanvp;u4 rxrxrcta1optr neilt srxrxm iu1omt mnetlt  2rru  oo1opto o3ildlm uln ont0altnxrcoo1fpDeanes;s0srur(r3oo4apt  fetat aDtaurpnu0tlx  fctltfm raums;t0altnio io1laD lu sl(0teuoxopiy4ll nmncsls)aDurx oot1ape iictytfs2el(vo (4trermoctydfm  luvs;()srurir3io4ape mnctl(faDurxro;o0optn f3iysla rlnvs (0treoxf oydoaD lues s)teuoir oy1ameemfesas arurumo;u1aetnioctys s2rau ont)alenmoctatfmDeaieslt0tetoir3iy4alee nvsas)srurx o;o0ape moetysfm2umu o (0 renxf3iotlp elueilt0t2toio3iydalenliet s)a2umx pno0oexnmoeiadfsDrmuvont0altrxocoodfmtraivo t) exoxm ny1openmfciatf rraxrono4oex iocild aDel(mp (4aetoir iydfa eaieols)srtm(m oy4amtn fesl(  Drmxm ;t1oee mo3ilslm ranvo;t) eeoifcia1oa e nvol(0t2tmirpiy4lltemnvt (fsrumu ooo4tpxn o3tlsfm2ran p () exrmr oodfaDelu olt) 2tr(o3nydom  lfcil()artm(  oo1aexoifctysfm elnvs t4aexnmf totopte i s s0 2xoim ny4ll n nvil(faDua(m ;t0teeo o3iadfm elu snu)aleoifciytlp   ues () eurim3iudale lnvs s)aDumuroot4ape  oetasfaDuanmpnt) exoxrctotfpDrln ol(  exrxr3oy4lltemicilt) Duaumo;o0teen fciasla2el( snt4aetoxr iy1fmDeluvols)s2tmxm iy4am  lnvia()sruaumpnt1teenifciydfm umnms;(0 leoxocoa1oaDr uei;s0trxoimpno4am nmfvt tfsrrm(r nt0tpx io3iltlm uln p t0arxomociodopDrau i (0s2toxo ou1lmte fcsls)arrrx poo4aee mocilslmDrauvp;(0 exnmo oodomtrlueo t) eurir io4lmenlnvil( a2urxm ;o0tex  i3tld a2ea(mon()aetoxf iotop   ivils0seumxopoodamt mnvsas)sDtr(  ou1oleomoetls aDuau s t4tetoxfctotfm elies;( sexo(opiu4ll emivia(fsrrmumonu0olxo oetytls rlnvo;t0aexrxfctadfpDeli sl(0s2umxo3ou1om  mfesas)a2rrumooo1tleoioeiyt a2rluvpn(4tetomrcoatlm raueo t)tetrxm oydal emfvslt)sDtmxr oo0alenmoeias a2um(mo;(4 rtoxocoy1oa eau s;t texm(o oodlmtelies t sDtmumonu4tee mfctltlsDulump (4tltnmo3oodoatr uei;s) etmxmpiu4lleelfcs sfaDtm(mo;t1tlx  iciydfmDelnvs;() etrxfcoytoa   uvols0s2xmim3iy4omteliesatfsDtm(mpno0ale  oetltfa2rmumo (4texnxociadlptelieilt0s2uo(mpnu4oleemicils)artaum nt1aetnmoctltlm rlnmonu0treomf3oatlp e u o;()setoirpno4am nlfvt () rrmxmooo1apxn feiyd aDem(mp;u4trxrmo3iytlm eau s;t)t2xm(m3nodap  mivsas) rrmxmpnu4tlxo feiad m2eauvon(0 ltomoctydoatrluei () 2uoxrpnudam nlicsas) rrmx o;u4aeto octytfaDem(vs () eenmocootlaDeaues;(0 2xoxmpiy4apeemivi ()aDua(mono1apxoiietysfm2ra( p ()alxnio iydlpteaivilt)srumxopno1lp  mfet t)s2ta(rono0aet  o3iadfa em(mpnt0aetoxocoy1faDe nesls s2to(r oo4opeemivsatf Drrxr ;u4oeenio3iaslaDrlnmsnt4aetrxo oatfa r ieslt0sexo(o nu1amt micia() rrmxr nu0tetniieiasfs rm( o;t) ltrir tydoptraneo t0srumim3iodomtnmict ()srrm( o;t0oeen oetasla emu o u)trermf iadfpDraiei;s0tetr(o3iy1ale livtl()a2rr(r ;t4aptoii3tydls eau s t0 ltrmf3iytlaDr u o;()texr(mpiydam nlieiat) 2ta( oou4optomo3ild m2uanmp;(4tltrio3ootoaDr n s;()s2xm(r oo4lpt mfcias  Durxr oo4tptomfeiyd m rm( p;u0tlxrxo3iy1lmt  u ilt  etmim3nu4lpeemieia(fsruru p;u1tpe  fetytla2umuvonu0arerir3ta1oa e iei;t s2umio nydaltn ivia() rtrurono1aee if3tld m emuvs t)texrxf3oatfaDelivi;t)trxrxo3nu1altnlfet sfsrtmum no4opx  feiysla elu s t4texnmfciotoatran ol(0 2xoxm oy4lle  nesas s2trum ou4aex ii3tlsfsDrmnvon(4tetrxf3ty1oat aivolt texr(r3iy1openmnct t)aDtrur oo1opxnifetys s2ea(ms () lxoxf iotom  auvi;s  2tm(rpiy4open ivs ()a2urx p;u4oeeomf3ils m ranmpnu)tetrio ty1fm raivo;()srumxr oy1llt mneslsfs2tau  nt0tpx miciys sDemnmsn(0 rermo3io1fpt  nvs;t) eur(rpiy1ll elnci (fa2rrxm nu4oetnmieiyt a em(msn(4tetrxo3oytlptrln i s srumir ny1optnlncs ()a2ra( ont1opto ictltlaDrau s;t4 eeomr3io1fa  ln s (0 2xo(opno1alee ivtasfs2rr(mooo1olx  icild a rau on()alerxf iydopDrai o s)sruoxm3iu1lpee nvs s)s2urur ;u1aee  octas aDea(vp u) ltnir oy1omtrln o t0t2xoio ou1amte iei s)artaurpnt1oetomoetasfm ranmo u)trxoirctytla eau ol(0teuoxo3iydomtelfvil() ruaur ou4tleniociys aDem(mp t)tlxnio iytomDr nes t seumxm3oy1lm  mieil( sDrrurpnu4optniiciydlsDrmuvpnt4 leoir tytlmDr neo;(0texrxm3ou4openmnct (f rtaxrpou1aetoiieiadlsDuluvpn(0aeeoxo3iadlmt luei;( trtrxo3iu4om  liciat)arrmx ooo4tpxnmfctyd sDuaumo;t0 leriociatla elnvils trxoirpou4al nmiet (  2rr(  ;o1ale mf3iysla uanvo;u4alxnmr oodlpDeauvilt texmio iydaptnmivta(fsruau p;u1tlxoiociys mDumnmp;(4 eenmo3oadfa eliesls)setmxo3nu4lpt mfvia(f 2uaump;o4aeen f3iadfmDuan pn()aetrxoctydfpt  u s;t)trxrxmpiydaleemnvils)sDtaxrp;o1tltoioctasfs2rluvo u4artnxf3tydlaD luvo (0 rumiopny4olen fesl(farrmx pno0olx iocilt mDuanmo;(4arxrio3oadfatrlnvo;s)texo(r3iydamte fvia( a2raurpnt4aeeniociltfa2emnmsnu0 ltoir3iy1op raiesls)sruoimpiu4omeeliesatfaDrmxm ou0opt mi3iasfm2rlums;u0aexrir tadopD  u o t0 exrim oudal e nctlsfartr(rpou4oeto o3iad a emums;t) ltrxr oodop eai s t)seurxmpoy1om n ivta(fsrtmxrpou1apto f3ilsla2umumont0 eeomo iytfa  livs;( srxmio nydomeemnvt ()artru pot1opxoio3ildfm2rln s t4tlxoio ty1fa rauvsls  2xoiopoy1lleelivsl(fa2tr(  ;t4alx io3tld s ea(vpnt0trxoxrcoydfpteln ilt0 euoio nu1amtnlfvtlt  rrm(m ou4oexoio3tlslaDeauvsnu0aexoxr3totfat ai olt  eurir io1op  lfetl(faDuaxrpno1tltomf3tls m ul(msnu0 rermf tydomtrlu i () 2trimpoo1lmen net s)a2tm(rpou0tpx mietytfmDua(vpnt4alxoxo ta1oa  anvsls0srtoir oo1oltnmfcils)artr(  nt4alxoiicilt sDum( o u) exomf oo1lm r nvo s  ruoxr iu1ope mfcia( aDrr(mont4opxnifciltfm2elnmp;(0artoioctadoaDr n o (0 rtoiopiu4op n fvtltfs2urxr ou4apx mf3iydfm2emump t0aeenxr3ta1lpDe n o;s trtoir iy4apee icsasfs2tau o;u1optomietad a umums u4aexrmfctytoate uvslt0tetoirpio1alenlfvia() 2umxroot1apenmocils a2emnvo;()aeeoxf ta1oatelues;( tetmxr ou4openmnetatf rtax pnu4tpx micilt mDem(msnt0 ltrmrciotfpDeaivo;(  2tr(rpoo1op   nct sfaDrru  ;o4aeto ocils m2ra(vsnt) lenxf iydoa eaieo (  2trxm iy4alenmnctas arum( p;o0tpt ioetldfaDumnmp ()tltrif iy1fmDeauvolt0t2xoim3ny1lmtelivi () rrmxrpoo0ale ifcils s2ea(mpn()tlenmocoo1fm eanvo ()t2urxopoo4om nlictl()sDuru pno4altoiocias m2ua( p t4aexnmf iotlmDeau ils tetrxr3io4lmte fvtas sDumx ono0tetoiieiadfsDum(msn(4 rxrif3tadlpD ln olt0t2xr(r3ny4op n ict sf Dtmxm ou1tlt ifciasla elnvo t) rtnxo tatlmte ivo;(  ruo(o oydom n ncsa()aDumurooo4opx iicias aDelu on(0 lxnxf3tadfm  aieo s)tetoim iy4optn ivtas)aruaum no4apto f3ils a2um( s;u4tltrifcoadfaDrlneils0 exr(o3iy1op nlnet () Dtaxro;u1oeeo oeiatfm rl(mp (0tlxnircoo1fpDraiei;s0 2xrxr3ou4lmtelict ()sDrau  ou4alt  oetas mDuanmp t0trtrxo3oatlmD luvil( texoxm3iudaleelneiatfartaumpou1alx ioeiysls ul(vo ()aetnmfctydfm e n i (0teuoir ny4llt lictasfsDumu pou1opxn fetys s2ranvsnu) lxnxf3ta1fpt anei (0teto(opiudomee feias sDrrxmooo4tetnmietytlaDrm(mpnt0alxnmrcoodoate ivs t0texoxo iodlptemivsas)s2rrurooo1oeenif3ildlm um(mpnu0alerxo3oa1la rlneols trxm(m nodamee fvsl()sDtmx ooo1opt ioctysls2em(msnu)artnxrcoadfaD  ivs;s  exo(mpnu1omtnmfeil()aDrmx pnu1oeeoii3ild s2ea(ms t)tlenif3tadoa rlu o s) 2tmiopoy4llenlfvilt)s2tm(mo;u4olxniietldla2ulnvp;u4aexoxr3todfatelu s ()t2toxrpiu4op elivsatfs2ra(ronu4oetn i3iatfmDuaums;t4 rtrxf tadoaD li i;t0 rxr(r3io1apt lnvs s aDta(mpnu1opxoioeiydfsDuau p;(0areomocoydfptrluei;(0 2tmxo3ny1llenmivi sfartru pou0open icilsfs2ranvo;u)alxnmr ootfp  lieo t)setrxo iu4lp nmnetlt a2rrxm ou1altomieiyt a rau o;()aleomr oatfm elueo t teuoxmpnodolt lnciat)s2umum nt4apxnioeils mDrlumpnu)arxrmf iy1op  anvo s) rtoxr ny4omtnmfvs ( a2ra(rpoo4ape mi3ils a eln p;u4aleoir3iotoa  lnvi (  rur(o3ny4amen nvils a2tr(m ot4aptnmo3tatls ul(mp u0tlxnif3ty1fmte uvs;s t2to(mpnu4oltelici t  Dumxm ou0alto i3tysls el(mo (4tltomr3ty1fpD li ols0t2tr(mpou1ole mnvs tfarra( pou4altomiciltls ulnvonu)artnxrcoa1fmtrlieo t  2uoimpnu1ope mictls  Drruro;o1altnioctldfmDranms;u) rxrmo3oytlmtr ies;s0srxm(o3io4ll emieslt)a2rmum ou4teeoifeiadfmDulnmsnu4altoirctadoaDr uvs s)seto(m oydame lfeiat) ruaum nt1oeeo o3tytlaDumu sn()areoifcootomDranei;(0tetm(r3io1amte fvt t s2ur(m ou4tptoiicilsfm2emn o u4 exrxf3iadoaDeauvslt) 2umxr3nudlm nmfesl()artrxm ou4apxnmfeils a2uauvsn()arxrmr todomt aies;t)teurir oo4ape  ivtltfaDum(mpou1tltomociydfsDrlu snt)trxrxf totfpD luvsl()t2xm(o3iydaptelnesltfsDrau  ;u4oet mfcilt s2eanvs u4trxoio iy1fp r neils)srxr(r nudop  mfesa(fsrur( p;u4alt  o3tys m2ra(mpn(4artrxociytom  aivo;(0tetoxm3io4lp elieiasf rraxr ou0tee  f3tatls2rm(msn(4 leomo3oydoaD lneo ()t2xr(r oodal nmivslt  2umurpnu4oex mfciyt a2rlnmpn()arerif iodoatrli o;t s2toxmpny4lptn fcsasfsDua(r ot0alxnmoeiydlm2eln snu)tlenxf3totlaD lnei t0s2xrir oudope  iet () 2tr(mpnt0opxn o3tyd mDranvp;u4artnmoctodop elu i;t0 rxr(r nu4aptnmfvi () 2tm( ooo0teenifetydfa raumsnt)aexrio oa1lp  anvilt)s2tmxo3no1optn nctls arrmur ou0alxo i3iydls2ea( onu)aexoxf3ia1fp  lnvo t  exoio oy1apeemfet sfaDumu p;t1optomf3tadfmDelu s u4aexoxo3iotlaDelnvi;( sexr(m3nydam n nesat arumxmoou4openii3iysfa rmnmsnt) rxnxrcoadop   n o;t0s2xmxmpiy4lme mfvsatfartrurp;o0apxn o3iys aDemn s u0teeoifcoadlat  uvo s tetrxm3nu1lltn ncs t aDtaumont0olen f3tasfm2rl( s;(0 lerxr todlmtr ieo (0trto(o nodlmen nvtas)s2tm(r ;u4apeo ociysfmDel( onu0alxnif3tytla elnes;t0 ruoxr3iydoptnlfctl()a2tmurpot4tltniicilslmDemnms;u4tleoxf3oo1fmDelnes;t  2um(mpou1optemfesltfs2ua(mo;t0oltoifcildls2ulnmp u0 rermocty1oatrai i (0 euo(m3iodalee nvia(  Dur(  ou0tlenifcilsls2ulnvp;u0 renxr to1lmDe n o t0 ruriopnudamtemfcsa(f 2uax pnt1oltomo3iad a2ra( p;(0aexrxr3tytfpteli o s0t2xr(mpou1lpenlictatf 2raurp;o4tltn iciasfsDeanmo;(4arxnmocio1oa elnvils) eumxrpio4lm nmict tfarumxrpou4oexnmf3iyt sDeanmonu4 exoir oytopD au il(0s2xmxm3iu1ol emivta( arrmurono4tpeo f3iysla eanmp;() eeomr oa1omtr n o t srtrxm nudapenmnetat  rtruroou4aleoif3iasfa2rmuvo;()artrmf3oy1op  aieols0t2toim ny1am  lnet t)artm(r ou1tpxniocilslsDeln p;t4tlxrif3iy1oaDe ies t  eumir3oydoltemfcs t  rtrx  nu1olt  fciat a eauvon(0artnio oa1laDr ivi s  rxoxm3oudopeelicsat aDtau  nu1opx  f3ilsla2el(vs u4 lenxocio1oaDe neo;t seuo(opoo4om nlneiat  Drax pou1aet mociydlmDuan p ()aetriocoodom r ivolt) eumxrpoy4lltnlfcta()a2uaxmpno4apeniieiytfa rl(vsnt4texnmr iadfm   ueo t0truoirpoydlle mnvtat) 2raxr ot1tet mfciltfm rmn s t0artoxf3to1fa rlnvi;t0 2trxo3io1omtnlici () Dtr(mpot4aptoii3tasfmDuan ont0arxoir3oa1lat  nes;(0sexrxm3ny1om n nciltf rrmu oot4tpenmiciyd m rmuvp u0trerio todlmte neolt) exoiopoydamt  ieils a2urur nu0aee io3tyd m2rmn p t) lxomociytoa r u i;t srtmxm3nu4olt mncsas) Dtmurp;u0tpe mf3tlsls2rln pnu4trxnxfctodlmDelivo;t0t2umxopnodlpenmiei tfaDumu o;t0tlxnmo3tltlm rlums (0trermr todomD  nvi s)t2xrim no4al  mivtlsf 2uru oot4tpx mf3taslmDem( s u0aeerxocootomtrlies;s0 rxr(rpoudopeelncsasf rtr( ont0tlxn ieiysls2rmu o t) exnmf oo1opD anes;()s2to(o3oy1ap emies (fa2rr(  nu0tlt  fetldlm2ran pnt0 reomf oadomt  n ilt0 rur(m iy4oleemfvt t)a2ta(root4tlt mo3iytlsDrauvo u)teerio tytopDe iei t)setmxr oodam emfvias) 2raxmono1teenmoeildfm2rln o;u0 rerxr ootlmtrlneil()t2umxm3ou1llee fcsas) Dta(rooo4apxnmociadlmDrln ont4 lxrmo3oodla ran o s)sexmir3io1apt mncil(farumx pou0ope  ociad sDeanmsnu)aeerif iytfmD au il( srum(o nu4lptn iviat) 2ta(mo;t4tet mf3tldla2rlu on(0 lermfcto1oa  anei s0srtoxopiudam elict s)arraxrooo1oltnifciytlmDelnmpnt4altomociotla elivsls)trum(m oodam nlfvtasf Drm(m ;t4tetoifetld m rmnmo;u0 lxomo3tytfa  ln s;t0s2to(mpnodalen fvsls aDraurp;t1aex  ieildlmDra( p;t4tleomo3oa1fp eauei;s)seurio3oydaptn iet sfsrrrxro;t4tpeoii3iat sDumuvsn()artomf3ty1lm elnesl(0s2xrim io4al  mfviat)srur(rpoo1aeeomfctldla el(mpnt4alxrifcoo1fp e i o;t  2uo(rpoo1llt  iet s) rrrx poo1aeenmiciytlaDrm( p;u)texniocoytopD au i;t)trxmim3io1olte ncsl()aDra(mpno0oee ifeildfa2emnmo t)arxrmr oadomt au i (0texmio nu4ome  feilt)a2umuronu4olxnmociad m2rauvo () rermr iotoat  i o s s2umxo nudol nmics tfa2rmuroot0teenmi3iyt s ra( s;u)trtnxo io1la e ivo s srtmim3oy4lpt lfcilt)a2rmum ;t0oexn ictltfs2rm(vo u) lxrirciodfm r neo;(0texmxr oydaltn fetatf rurxrpnt1tlen ociltla2rm( p;t4arerir iydfmtrlu s;()teuo(mpiodameelivs t a2taurpno1oee ifeiys s ua( s t4areoxo oytfa  li s;t)sexmxr3io4lm emncta() rrmxmono1tle mo3ild s2rau o;u) renmfcoydlaDrauei t)s2tmxr oo4lm e fvi ()srrrx  nt4opeo feiltfm2el(mo;t4tlerxocoa1fateai i;t0srum(opoo4aptnlfvil(farumu  oo0tpxnif3tytla elumpn()arxomf3oatlm elueolt  2xoxm3ny4oleelicsl()sDuru  ;o4tptnmoeiatfsDemnvonu)trtrxr3iy1oaD anvo;() rxmxo ny4ome  feslt s2trurono4tleoiietat sDrlu p;t0trenxocoy1opD aiei s t2xoir3oo4ame  ictltfsDtmxrpnu0oetomfciyt m2umumont0teerifctatoaD  ivils0srtoir3iodalee fet s srtaumpnu4oexo f3iat aDemnvp u4 lxrif iadlmt au il(0sexo(rpio1ol elfcta()a2raxm ot4opx  feiydlsDea(vo;u) eeomo3iydomDe nvo;s srur(mpiu1ll  lfvslt)a2uru  ou1tlenio3iadfs eanvo (0arenif3todopD aivi;s) 2uoxo3ny1ap e ictatf 2rmxr ;u4tlxn ociasfmDrmums;u0 lxoxf3iodfa ranvs;t)s2umxopio1omenmivi s) rtrx  ot1tpen i3iys s2emu p (4trxoxociadfaDr nvs t trtm(r3oy4ol  mnesa(f 2trum no4aleoifctltfs rauvsnt) ltrxrciytop  li o s)trtrirpou4llen feia(fsrtm( o;t0aeeo fcilsfs2el( p t4arermf oodopD  ivo;t)tetmir nu4optnmnci ( aDtau  ou4alxnmfcils sDra( sn() lerxr3oadfm e n ols  2xrxopno1oltn nvil() 2tm(rpnu0alxnio3ilt mDum(mon(0 lermf3iytfmtr i o;()seto(mpoy1ll e fvtl(f 2tmuroou0ole ifciadfsDuanvs ()alxrmf ootlm  li o;t0srto(opno4ap nmfci ()arrm(  ;u1olxn feiltfs rmn pnt)tetoxfctotlmD  iesls sruoxrpno1ol emfciatfa2rrxr no4tex ii3tltfm uau o;t4aeeoxo oadoaDelivol()setoim oudlpe mictlt  rtm(mpoo0texnio3tatls eln p;t4treomr3ty1fmtrlivslt0teum(o3io1ope lneils  2ta(rp;u0aee iicils m2eauvp t4arenir3to1fa e ies;t0sexoxopoo4oltelivs ()s2rmxr nu0tee mfeilsls umuvsnu0texnif3tydlmD lnvols0trtoxrpiodlmeeliet tfaDraxm ou0apxoif3iad aDrmnvs u) rtomrcootfateai sls0t2xmxr no4lptnlivtlt a2trump;u1opeo octadfa emnmp (4aleomrciatfp r u slt)teuo(r no1lpte fctl()arraur ot4oetoifcilsfmDemnmpnt4 rxrxo ta1lpt lnvs;() rxm(r3ou4lmt lfcil(f 2rm(mo;o4oet mi3iyd mDelnvon(0tlxnxo oo1faDrlnesls texr(r oy4ol   fesas) rtaxmpnt0ale  f3iatfs eluvonu0aetnif oatoaDran sls)texoxm nudlpeemicils s2umu  ;o4opx mietltla2ua(mp (0alxoxfcoadopt  uvols0 rumxr iodalte ieslt) 2tm( pot4aee  ietas mDrm(vsn(4arxnmocoytfatr u ol(0srtrxo ny4lm emfctas sDtmxmpnu4oltoioeiasfm2ul( s;(0aetriociotfmt lieil(0s2urir3nudaptn ncs t)srrm( pou4tpen oeiad sDumu s t4trtoio oodlpt  n o (0srxoxopny1llt  fesas) rrrxmpno1apt if3tlsfa2rau sn(4tlxoir3todomDeau ols)t2tm(m no4llt mivtl( sDta(mp;t1tex mf3ilt s2ua(mp;t0altnmr ta1fp ran o;s)teumio3oudop nlncia(fsDrm( oot0tleo i3tatlaDeanvpnt0tetnxrcio1opte nes;()s2ur(m iy4lp e neia(fsDtaxronu0texn fctadfa el(vsnu4 rtnxf todom rlivo ( s2tm(opou4amtelfvt t)s2tmxmpno0alxniieiysfa el(mp;t4 lxoxf oy1lmteluvi (0srtm(o no4lptnmfeia(  2tmumpoo4tpeo oeiytfmDem( snu)aetnifcoytoaDeaneo;( setm(r3iy4amee nvia( artm( ont4tpt  ocildlsDul( o t0artoxo iatlm  luvi;s sexmio oudap  lneta(fsrurxro;t1tex  ieiytfs eanmsnt4trerif3ia1oa e i s;()t2xoxopoydlptelnes ( a2um( ono0olxnmieiys s emu s t0 eerxr ty1fp ean ols) eumirpio1llen ivt sfs2rrx  ;t1ole  ictydla emnvon()altrmf iatlp e ues;s0
\ No newline at end of file
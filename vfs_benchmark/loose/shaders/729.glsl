@@ -0,0 +1 @@
+ueo;(0setoxmpiy1amen ics s)aDraxmont1tltnifcilt sDuanvp;(0tlerifcoatom rlu i s seuoxr3no1om n fct t)a2tr(mpou0texoioetytlmDuau on(4aeenxfcootfpD  ivo ( sexr(o3oudolee nes s  Dtaxront0aleniiciyt aDuan s;t4 lxomociatomD  i i t0trtoxopou1omte ietlsf 2tru oou1oex mieiltla emn o;t) lenxf3ta1fmtranvs (0 rtr(m oy4lle  iviat)a2rrx pnu4olxn ocilsfs2rl( o;t0 rtoxf3iotopDrlu ols s2tmio no4lptnmnvsa(  Dumxmoot0tpxomfciysfa elu ont) lxomo3ia1late nvo (0s2urxrpnudale lneiatf Dtru  ou4oetoifciaslmDua( p u)teenmo3iatlaDrauvs t0s2xm(mpiy1om n nctls a2urx oou1aptn ociasla um(ms;t0aexnxfcoatlmD au sls0sexm(mpiydlp  lfcta(fsrrr(m nt0apxnio3ildlsDrmnvont0teeomr ootomt  u s;( s2umxr3nu4lmtemivi s  rur(mp;o0tle mf3iyt s2ua(mo t0 reoxf3to1oa  lieo;()srtmirpnudaptemfcslt)arraxroot4oetnifeiys sDelumsnt)tlxrxr totlpDrlu i;(  rtrxrpiydaptnmfcs t aDrmxmont4tetnmf3iaslm2eau p;t4altnxrctodlpt lnesl(0 ruo(rpoy4op  mieilt) Dtaxmo;o0apeomfctlsfs em(vs ()tetnxocoy1lmDrlivilt)setm(r3ou1ll nmncsls)arrr(mpou0opt  fcildls2rmnvs;u) etrmfctadlp elivi s0srum(o ou1lm nmncsa(  Dumuroou0ope mfeils s2uaumpn(0 lerxo3iytomt liesl() rtoim iydlmt  neilt)srtmumooo0tpxniiciat a rluvon()tltnxr3iotopt livols)t2toxrpoy1opee fvsas a2rmx o;u1olto iciltlm2emuvp (0 eeomocoatfp e neo;()t2toio oy4omt  neiatf Drr( ont0tpxn octas sDuluvpn() reoxo3iadlp elu o;()srum(m3oo1lm elfeilt)sruax  oo4opxoio3tltfa rm( snu0 eeoio3tytopD lneo t  2xmxo ny1ap  lfcsls)arua(root1opxoiieias sDua( pnt0 ltnif3iadfmteaies s)s2umirpiy4lm   fcsa(  2ua(r no0apxnio3iadlsDum(mp;t0tetnxr todfm  lnvs ( texmim3ou1al e icia(  Dra( ooo1opto ociyd s rauvsnu0teeoifcoydfaDelneo;s)teto(m nydlltn nesls  rua(m ou4opx  oetlslmDrmnms;(4trxnmo tatfpDe ieo (0 exriopno4lltnmnesas) 2tmxm ;t1opeoiociasfa rlumo;u) rxnmo3oydfate uvo s  ruo(r oy1om elivtas  Drmumpoo4tpeniieilt m umn o (4 lxrxf ootomDrauvol(  rxrir iudlle lici ()a2um(ro;u1aptn feiydfa em(ms u0altrio iadlat  ivil( trxrim3ny4llenlnci tf rtrur ot4tee  f3iatlsDeanmp;() rtrio oo1opDelu o s  rxmxo nu4lptnlfvias sDrr(root4apeoif3iatfmDrl(msnu) renmo3iatlatelueols)srum(rpiy1op e nvt t)a2tmur nu1alt mf3iyd a2el(ms;t0treoxo ootopD  i i s  rtrir3oy4lmt lfet tfs2ua( o;t0aptomi3ilslm uau s u4tleoxo3oy1lpDe ivs s0s2umxo ou1apeelieiatfsDur(  nu1oexomoetydla emuvs t) rtrio3to1lmt  n o ( seuoiopny1lm   icsl( artaumooo4openmo3tadfaDemu pnu0alenxocoytlpDraneol(  exo(opnu1am   nei s aDraxmono0aleo i3tydfs rl(vsn()aeeoio iytomte uvs s)sexmio no1op elnctl(  Durumoou4apen o3iytlm elnms t4trxoif3tadlp  li ils srxmxr3nydlptemfciatfsDuaurono4tpxnioetydls em(vp;t4alxoxr3tydlpDeaneols0tetrirpiy1ap elfcil(f Durum nu4aeenii3ilsfs elnmpn()texnir tydfm  lnvs;s0tetmxm3iudameemnvsltfs2raumpot0tpx  o3iltls ea( pnu4alxomrciy1fmD anvs;(0seumim3oy4lmtelfctlsf Drax o;t1aeeoioeiytfmDumnvonu0alxnmrcta1fa   ieolt0t2urxopnydlmtn iesasf Drrumont0olx ii3tas m2ra(mp t0tleoxrcoadla elieolt0s2uoimpny4ll nlncsl() 2tmxmoou1tet mf3iyt a2rl(vs;u)tetomf todfpt  ueo (  2umim iydope micsas)sDururpou1aetomoctld a2ea( snu)tlxoxr3ta1fm eliesl(0 eto(r nudlm  lieia( sDumurpnu4altoio3iysla ulums;(4trenif3oytoa rluvi;(0t2umxr3oo1lmt mfet tf 2rm(r ;o4olenmoeilsfs uau o ()arermr3oodoa raueolt)t2ur(mpiu1ome  netas) 2tax ont0olenif3iadlmDemuvs u0 lxnmociytfm ranvolt0 rumim ou1apte icsa(faDrm(mpnu0tlenmo3iadfsDel( o t)alerxrctydla ean o;t) 2tr(mpiy1omtnlfvias s2uaxront4teenmo3iat aDeln o u4 rtnif3ootlpD anvi;s) ruoio3oy4lltemnci ( a2urxrp;t0apxnmf3tydfs2emnmo;u4trtoxr3todop r n il()truo(opoo1lpeelict s a2taxmoou0opxoiietas s uln on(4trenxo3oodlaDe n i (0teumxm3nydlmeemfes sfsDrau oot0olto f3iatlaDumnms;u4aeenmf3tadomteaueo t0 rtr(opno1lltemfcias)aDrmur oo4teeomoeiasls umnmpnu4aetoif oydfa e u s () rtrir iudap n fet s) rtmurpnu1tee mfeiytfaDea( s;u0tltoir iatlaD auvs;(0s2uoim3oudome liet tf Dra(rpno0aetnifeiyd a rmu o;()arxnifcto1faDeluvolt  rtmim3iy1omte ics ( aruau ont0opx if3ild a rmnvo t4tlenmr3iadopte ieo;s0t2tmimpiy4omen fcs tfaDuaumoou1aeenmo3iad sDum( p;t)texrir oytlaDe i i t  rurxrpio1open ncs s) Duaur nt4aetn fctadls eln s;(4artrif3to1opD anvolt0s2xr(opno4optemnei ()arua(roou1olx ii3iatfs2rluvp u0 lenmocoa1lpt aivo;s0t2to(m nodllenmict tfa2umu o;u1olxnmfetlt s2rl(vsnu0tetomrcoytlmtr ivols srxmir ny4olt lfesl(f 2taxrono0aleo i3iadfs2rmn p u) rxoxr3iatlp  aivi;t)s2tmxr3oo1openlivtat)s2urumoot0olxniieiydlm rmn pnt0trerifctatomt  ies;t0s2xrxm3oudalee fes ( artm( o;t0tpenifetadfs uln p;(0trxnir iydfptraneo t  exrio io4amt  fctls arua(root0oltoii3iyt a rluvo (4 eenxocoo1lmtr n i ()t2uoxrpoodolt liet (f Dtaurp;t4tleoioeildlaDem(ms;t4 ltnircoatlm ranvils0t2tr(o3oy4am  mfcia() Dtrxrpno4oeto ociytfaDea(vpnt)tetnio3tadfmD anvo s0 2tmxm3io4llen nvsas)sDrr(r nu0aetoiiciatla2um( s;u0 rtrmo3ia1oatrlu o t0trumxm oo1ale mfcilsfs2umurpno1oleomoeiat aDumums;t4tlxrxr oy1oaD luvi;s0s2ur(r oo4altnmfct ( s2ur(rpno1oeen fctysla2ul(msnt)aexrxf iatoa eanvo;(0t2xmimpiodllen fci (fa2urur nt0oetomfctld a2ranmpn(4 eeoxf oo1lptr n o t s2uoiopoo4lptnmicta( aDtrxmpnt1oetomieiyslm uauvs;()alxriocoatomtrlu o;(0srtm(m ny4omenmfvsas s2raum no0tle ii3iaslm2ulu p () ltoio3oydfatrliei;t  2xoio oo1ol e ict s  rumxmp;o4tpe  o3ils m em(mpn(4 eenmo iydfat  uvo s0 rtmxo3nu1lptnmics t srtaur nu1ale ifciytfsDum(ms;u0 lerio3tatomDelnvi (  etrxr io4lpen fviat) rur(ro;o1altn i3iyt sDuln o;t)tetrif oodomDeaivi;t0trxoxm3oydame lfei t a2trxrp;o0alxnioeilt aDuau p u) etrmfcoo1fat luvolt0s2xo(o3no4al  lfvil(  2uax o;t0alenioeiadlm2ean pnu)aeenifcty1lmDrlivolt) rtoir3iodllt livtlt  2taxro;o1aexn iciadlm2ua(mon()trenxf3totlm r n il(0t2xmxm3iudalen fvils srur(ro;o1altnmoeiltls rmnvs t0 lenif tadlaDeau slt t2um(r oo1llt  ivslt aDta(m nu0oetomf3iltls2eaumo u)treomrciytfa  lu ols tetm(o3oodaptemnvt s sDraxrpnt4olx moctltfa2rauvpn(0 lxoiocoytoat li o;(0 2toir3oy1om emfvsas s2tmxr no0opeoifctysfaDeanvonu0 rtrifciatfm eaieo t0t2tr(rpoudlmt mfeta() rumxmp;u4opxo iciad s2ul(mp t0 rxomo3to1omt aneo t0 eumxmpoy1om elnvsls  Dta(mo;t4apeoii3tyslm rmuvp t0altnir3iytlpDr uvilt) etoiopoy1alenmici (fs2um(mpoo1ale ioeiasfsDumu snt4 ltnifcoydlmDr i ol( texo(o iy4aptn fes s) Dta(monu4olenmoctldfs2ea(ms;t0 lxnmrciodlpt lueo;s sexoim iy1lp  mnesa(  rraxmp;o0optomoetys s uln p (0 exrir oatfpD li ils) rtm(m oo1olenmics s  2umxrpoo4tptnmoctyd aDrau p;(4aexrxr3ia1fp rli il()trur(r io4am  mict t)a2rmxrp;o0oetn fciltls rln p;u)alxnmr to1faDeaiei;s0t2tmxrpou1opeemivs s)s2taum ;u1opxo i3tys s uln s;t)alxoxoctotlpDe ues;s0 2xrxo3iudamtnmncsltfsrrrumo;t0tee  ocild s eaump (0 rxrxf3todlmD lnes;()sruoxopno4amenlfvias)a2rrurpno1ale mieildfa ul(mo u4 lxoxfctatoa  liei s0sruoxmpoy1lm  mietls aDururo;u4tlxoiiciadfsDemnvs;t0trtnir3tatoa rauvi t)tetm(o3nu4lmen ncs (  2rmxronu4tpt mfciaslaDumnms t)trxrircty1la elneo;(0trxrim3oudlpt  ietasfaruau  ;u4ape  oeilsfs eauvp;() renmf3tatfmteluvi t)seum(opou1llee nvi (f 2urx o;u1texomf3iydla ul( s;t0aetrmo todomt anvs;t t2ur(opny4lle  fcs t) rrr(ro;o4aexo oeild m2ra( o t4 lxoirctotfpDranei;t)t2xoirpiu4olt livs s srum(r ;t0tlen feilt a emn on(0tleomr oa1fmDr nvsls)srxmir3oy4omee nvt t a2rrxro;u4teeomo3iydla rm( s;u)tetnmo tatfmtranvo;t0srtm(opno1alt mnvia() 2tr(mpnu1altniiciadfaDulnvo ()artomrcoy1fpD anvs;s s2xmxr ou4opeelfvsltfa2tm(ro;u1ole mfeiad a umuvs (4teenxfcoadlpD aueo ( srxrxr nudlptnlfet ( s2rm(rpou0oeeoiociydfa2rlu snt4alxrio3oa1lm   uesl( trto(rpnydope  ictasf 2rmum ou0tetnif3ilsfmDulnvp u0alxrmf3io1lmteli o;t trtr(r3nu4alee neta(fartrx  ;o0tlto iciytfmDem(mpnt) exnircoo1opDrli ols)texrxm3no1omt lictltfa2uru onu1altomictys sDea(vsnt)treoxr iytfptrli olt0 2xmiopiodop emivtl(farra(ro;t1aleo ieiyd m el( o;u4tltnxfcoatlatr nvs;t t2umxo3ou4oleelicilt) Dtrxm no0opxnmo3iytfsDrmnmo;(4altnifctotopDe nvo;t t2ur(mpio1ole micsas  Drmx  ot4optnioetas mDulums;t4 etrxf3iadfat aivol( sexrxrpny4am   fesa( a2tm( oou1apxomieilsls uan p;u0 etnmociatoate i olt0srxo(r no4ope mfetl(fsrrr(r oo0tex  ieiyt a rm( s;()trerif tadlmteaues t  rxm(mpiu1omen ncia(faDtr(mo;u1ope mi3iasla uau pn(4aexrmr3ia1fateanes;t srto(m3ou1lptnmivsat)srtaxmo;t4olx mi3ias aDemnmo (4 lenio3tadopDrlueo ( seurxo3io4ll n nvtat  Dtaxmpnt4texn o3tyslmDulu p t0tlenio iydlmDeau o (0t2xmxm3oy1al emfeilt) Drm(m nu0tlxnmfeiasls ea(mo;(0 rtrxfciy1fmDr i ol() 2toiopou1al nlieslt artaumpnt0aexnmi3tydfa2uluvp u)arxoiocoadom r uei s trtr(rpiodapeelnesls  2trurpot4tpxomietatlsDul(vo;t0teermr3iytfm   u o s)trxmxm3iodal nlicias  Dum(rpnu1texn ociyt m2umuvs t4 lxoxrciodoat liei;s truoio iu4oltnmietls)srtrur nt0tetn fetyslsDel(vp u4aeeniocio1fp eli s s trxmimpny4lp nlfcsls  Dtmurpot1tpx iicild m2em(vonu0trenxr3ta1laDrlieol()t2xmim3ny1lptelfvilsfaDtmx pou0tle moeiydls ulumo (0tetoxf iy1lp   ivol()sexo(r ou1omtemnct s arrmxr ou1apx  f3iltla rlnvs (0arxnxociydomDrli o s0 rtmio nu1ope lnviasfsDraurp;t0tltnioeiys a emumpn(4 ltrxr3iodop   ueil()trxmxm ny4om  livtatf Durum ot4tle ifetld sDea( snt4 lxnxo ty1fpD  ivol( sruoim3nodlpee fct ()a2ta(roou4tpxo o3iytlmDra(mpn(0areoifcia1la e n olt0texmxr iydape  fesas)sDrmurp;u0olxnii3ildfmDrauvo;()tetomr iadfmt luvi;t  eumxm nudlpen nvtlsfsDrr(m ;t1alenioctydfa raumsn(4 lerxoctydfmDe nei (0sexr(m io1am   fetl()sDuaxmpnt4teto iciasfm2uluvp;u0 ltnxr to1oate i ilt)sexo(o ny1ole lictl( arurumonu0texomi3iyd s rl( p (4aexoifcta1fmD  ieil(  2trxr3nodal nlivsa(f Dua( o;o1alxnifetltfsDrlnvo ()trtoxo tatfmteaneil() 2uoxmpno4optelfcslsfs2umur nt0tpt  feils m2ua( p u4trxrmo iy1op elnes;()trtmir3ou4lp e fvi s) 2ra( o;u1texn o3tls a2ean onu0alerxf3tytlpD li il()trxrir nu1apte ies ( a2tmx onu4ape ifctad a eluvont4tlxrircto1opte nesl(  2xoxo3oo1opte ivs (fs2tm(  no1oeeomfciaslm2ea( pnu0tltrirctadfaDrln sl()s2xrxmpou1omtemncs tf Dum(mpnu1apx io3iyd m2emn pnu0arxoio iadla e nvs (0trur(mpnu4ame mfci tfa2tmxrp;o1tpxomf3ils s2emumont)tlerio3totoa ranvs;() rumirpoo4ame  iet () 2uau  ot0oexomieilsls2umn p (0alerio ootfptran i;s0s2xrxrpiy1lp n nviltf rrm(moot1opt  i3iydlmDrm( s () exrirciotopt  ivo;()sexo(r ny4al nlicsl(  2rmu  oo1aeeoii3iatfa2el(msnt4 lxnio oytlmtean i;( srtmxrpio1amtnlfvsa( srum(m nt4opto fetyslm2el(vsnu4arxoioctatfpt liei (0truo(o oudalenlictatfartr(  ;u1oee moeiltfm2em(vo;u0 rxnir3oydfmt lies (0t2xm(mpny1altnlfcsa(fa2tr(r ;u0alxomf3ild aDuluvs (0 rxomr iodomtrli s ()setr(r iu4apteliet s  2tm( o;t0oltomi3iasfm2rl( s;t4 rtrmf io1opteaivs (  2ur(o3ny4al  lnvils arumum no4opeoio3tld a2eauvs t)arxnifcoadlat aneilt  exrxrpoudopt mfviat)arra(mp;o4oeen ieiad a ean onu4 rtrxociodoat liesls0 2tmiopoy1altnlfcsat a2raxro;o4tetnmfciltlm2eanmp;u0trxoxo3ootlaD au i (0srumxrpnudole  ivta( sruax o;t1alxn o3tadlaDuluvpn() ltnmrciy1omteln i (0t2xmim3io4al  lictl( s2ur( p;t1ope mociyd m2el( p t) renio io1fptr neil(  etrir oudal   fesls)srraumpot4tpt ioetat aDumuvo u)tetoxociodom rai o s) 2uoimpno4aleemfei s)aDtm( pot1aeeomocilt a2rm(mp;u0altoxociydoa e uvo;t)s2xr(r oudom nlfes s)sDtm( poo0tle  fctasfs rl(vp (0tlxrio ia1faD  ueil(  exr(o iudop   neta( artr( ooo1aexnmo3iytlm rl(mpnt0 etnircoo1omtrauvi;t0sexoim3ou4lmenlnctas)srtr(mp;o0olxoioetasla ul( pnt) eeomo3oy1omDrln o;t teto(r oo4llt mncs t  2rmu pno4aleo feildfaDel(vp;u0 etoif3totop rau sls)tetoio3nu4apenlicsltfs2tm(ro;t1apx iieiyd a rmnmp;u)arerio3oo1oa   n s;s) rtmxr ny4olenlivtasfarrm( pnu0tlxn oetydfa2emuvon()tltrmo3iadfat  i s;s trtr(m iy4lle  fesltf Drrurp;u1olxnmo3iadfmDrm(vpnt0 eeoxfciodfp raivi;s) eumiopnudopee icilsf Drm(  ou1aex mf3iat aDrauvs;t)tltrxo3iytom  lneil( teumio oydlmte fcias)aDuru oou4apt mfciyslm um( snu4trermo ia1lmtelu o;(0tetmimpoydam elfes s)srumxro;o0opt mf3tlsls2el(vs u0 ltrxo3oo1fa eaivi;s)setriopno1ll n icsls artrx p;o1oltoii3tls a2emnmo u)texrio tatfate i ols s2urio3no4oltemfetls s2trurpot4tpe  fciatla ul( p ()trermrcta1fmte ues;( teur(o3oudlptn fcta()sruaxm oo4tex  i3ilsfa umnvo (4tltriocty1opDrauvi (0 exm(m3ou4lptelicsas  Dumu poo0alxoiietys s ua( pnu0aeenmo oy1fpDr i s s)srxr(m io1lltnmiei s)artau p;o1alxomieildls uluvp;t0 etnmo iotoaDr neo t  etmxm3oy4lp e nctlsfa2uaxmo;o0texo f3tlt mDrmu o;(4 renmo3to1op ran o t  2xoxrpny1omt mivil()aruau  ot0altoioetysfaDran o;(4tltrxf3to1oa e i o;s t2uo(o3io1optnmnesas  rtmxmoot0oleomiciasfsDuln o;()trenmf ia1lmteli o;s  2xmiopno4omen nviasfarta(m ou1opt iociad mDrm(mon(4tlxnio oy1fa rln s s) rtm(r3iudamenmfvsls) 2rmur ;o0aetnmfciadfs2rmnvs;(0aetnxf ia1fpDeai slt)teurxr oy1al   fvta()a2urxm ;o1alxomieiyslmDuln p (0arenmrcoo1lp eanvi;s)srurxo iudomt  netas  rtmxmp;t0oex miciytfsDuau o;t4tlerxfcoadfm r ueo ( srumxr iy4ap  mneils aDum( o;t1ope mf3iytfsDrl(vsnu0arenmo oadlp  aivs;t0sruo(mpno4lpe mivils)sDra(  oo0apx moeiyd a2uaums;(0 lxrxo ia1lmte n s;t)srto(mpny1ome  fvias  Dur(m ;o4olenmictldlaDumnms;(0trtrir3iytla  livs;t0sexoiopno4aptemfvtat) Dtm(  ou4aptn feiadfs2elnmsn(0alenio oa1opD ai ils0trxrir oodal nlfet t)aDuaxr ;o4ole iieiltfsDulumon(0alxnif tytoat lies;(0s2trio3iydolte nvi tf Dtru  no1tex mo3iat a uanvs;u0arxrxrcia1omDrlu ol(  exr(o3oydape lneia() rtaxmono4aetnmf3tys mDemump t4 lxnmfciatlmDelivolt)trtmxm3oodomt  feiat srurxro;t0tet  f3iat s2eauvs;t)trtrxr oydoa  ai i t texr(m3iu4apenlfciat)sDururp;t1tlx iieiyslm emnvs (0trtnircty1fmDr uvo () rtrir iudom nmivia(fs2rauronu0olxnio3iltlm em(mo;t0 etoxoctydfateai olt)texrxr3oy1amtelneslt)sDur(r ot0tee ifcilt m2ulnvpnt)tlxoxrcoodlaDeluvi;() rtoirpiodlmtn iesl(f rur(rp;t1aexn oeiad a ea(vs;u4arxoxr3oydomD luvs;t  2tm(r iodlmenmncs s a2taxroot1alenifeiadfaDea(vont0arenif oo1op   neil( texmxr iodlm e fctasfaDtruro;o4teeomi3iydla ulnms u4 rtriocto1laD aies;t)teumimpiu1am elictls  2rax oou0alxn f3iasla2ea(ms;t4alenio todlateau s t0 euoxr ou1lmtn ivtlt sDtmumo;u1apx  ieiydlm2ra(vo;t) lxrmo3tatlpDe i olt  rurio3nu4apt lietas sDra( o;t4aleo i3iad s2rm( pnt) exnxr3oa1omt an o (0t2xrxo3iy4lpen ncil(  Drmxrpnt4tptn o3iyslm2el(vpn(0arxnir3todlm ranvi;( seumiopoo4lpe  ncil(fs2urxmpot4apeo feiysfm ul(vont4teerifcoodoaD an i s0 exmirpny4lpt livilt  rtr(r ;o0teeoif3iytla2umu sn(4aexrxr tadlmDeaivo;()s2xrirpnudopee ivtl()a2uaxm ;t0aee if3iysfs2ua( p u0tltoxo iodfpte nvo;()s2toir3oy4al n ivias)aDtrxmpoo4aeenmfctld m2el( o;()tlenxf iatop raneils0 eto(m3iydlleelnesl(  rtmxmpnu4olenifeiytfmDeau o u4teenmrciatfaDe nvol()srxr(rpnu1olen iesat s2tmumo;o1teeomf3tadls2elnvp;t0 lerircoatomt  uvsls0 rtr(r3nudaltn net t sruau  nt0ale mfciad m2el( pnu0teerir3ty1late n s t)trtrio3iy1alee fvil(fa2ra(rpno1olxomicildfsDulu snu4aexnmrctytfa eanvil( seum(r oo1lltelncsa()srraxmp;o1tpxn oetasls elu o;t4trxrif3ia1fa  lnes;s0 exm(o3nu4alt mfvtltfaDtr(  ot0tptn o3tldla2elnms;(0trxnxr oydfp   u s;s)teuo(r iodolee fvt ()s2rrumo;u1oeenifeiydfs2ea(vsnt4 rerirctytlpt lnei s trxrim3iydap emivs ( arurur nt0tpxomf3iyslsDrl(ms t4texrifcoydlpteaieo s) exoxo nydaptelneilsfaDuauro;o1aet if3iasfmDuan pnu)tetrio to1optranvs (  rtr(m3iydolt lieslsfarumx oou4ole iociltfaDrau o;t)treomrciatlmtr i o s0 eumir iu1ol nmictl(fs2urxm nt4oee  oetltfsDemu o u) rtnif3oydfm e u ils)trxrir nodapte feslt)srtm( p;u0apto i3iytlaDrl(mo t0teenxrcoadlpteanei;s) 2urxr3oy1lme  nct (fsDrr(rpno4apenifctaslm um( p u)trtrmo3oydom  li s;s) 2uoxopny4ll   nes ( s2uaxm no1oee iociysla emu ont)trenir3iatfpDelues (0texo(r3oydameelfcs t)sDtmxmo;o1aleo f3tyt mDuan on(0 leoxo totomD anvilt s2umirpiodoltelieiatfsDrr(mpot4tetnmf3iyt a elu p u4teeomo3oy1lmtrln sls)tetrim3oy1opee neta( a2ra(  no1ale  ocilt a2ea( o (0tleoio3iadfptrlnvi s t2xrio3io1lpe lnvi s)aruaumoou1alto fetyd s uan snu)arxrif tydlpte nvslt) euoxo nudal n icslt  Dtaxm nu4ope ifeiadfmDumnmp;(4 eerxf3oydfpDrlieilt) rtm(r3ny4opt livtl(faDumu p;u0oeen ictltfm2ea(mp;u0 exrmf3todfat  nvi;(0 2to(m iy1lptnlici sfartmumo;u0tlenio3iyslsDelnvon(4 eermf ta1fp  aivo s0t2xmiopoudoptelneslt aDtm(  oo1tpe mfeiys s el(monu4 rxrxr oadomtr ueil(0sexmxm3ou1olt lnvs () 2urumpot0aex iociatls ua(msnt)arenmf3iydlatr ieils)trxrimpiydll   netls srrmu o;t0tleoifciatls umuvp;(0trtoxr ty1fpteanvils0trtmxopou1ll elnvils)s2rmumonu0olx if3tlsls rlu s;(4trermo3tydlpDrauei;s)trxm(m3nodale mfci sfsrraxmpoo4oeeoiocilslsDrmnmp;(0 lxrmr iy1fpD aiei;s)s2xoxm iy4om elfvsas  Duaxm nu1olxo o3iyd s2rmnvo u4 lerxo ia1omD ln olt) rum(mpiodom elfvsatfsDra(mpnu0tpx ii3tatfmDra( s;u)aleoxr3tydfmtrluei;t)srtrim3ou1lmtelfeil( aDtau  no0aeeoiietldls rmnvpnt0alermfcoodlat  nvo t)sruo(r io4amte fvsl()arrmur ;u4oeenif3iysfm2uln o t)trtoxr3ia1lpDe nvi (0srumiopoydal emfci t arrau  no0opeomictls mDulu o t4tltoirctadlm  aiei s0trtmxm io4lm elies tfsDua( p;o1aex ifciltfmDelnmo;u4aexnio3oa1laD  uvsls0 2xrio3iydopeelnet t s2tr( o;u1oet io3iad mDra( p;(0trtnxr3ty1fpDraueo (0srto(opnodlmte iei t) 2tr( poo4ale  o3iydfaDumnvsnt0 etomrciy1lmDr neil()trum(mpnu1omee fesatfa2rr( oot0teenmfeiad mDelnvo u0arerxr oo1opDrlneolt0t2tmxopoodal emfvtas  rtrx  ;o0oee mieiadls2rlnvpn() ltnirciatlaD luvs;s) eum(m3ny1alee nvsltf Durx p;t4ole mfctysls2ua(vp;t)arxnirciotfatraueo;s0truo(o3iodol  mivi (farum(ro;o1texnmfetysfs2ea(msnu0trxoxo3oy1lm raiei;s t2umxo3nydomeemfvilt)srtmurpoo0aex  fetldlaDrmnvo;u4tltoxo ia1lm  aneo ( srtrxo3oudll nlfcs t aDuau  ou0tleoifcilsfaDrl(vp;t0tetrmf3oodlaDr uei;t0 etoio no4op nmivia( artrxmooo1aptn ociltfs rmn snu)tlermr3io1lp eaivil()teuoxr3nydol emncs t) 2um( o;t1tetnmo3iadfs elums (4aeenmo3totlpDe nvilt0tetmxo iydll elncsa(f 2rmxrpno4teeo ietat m2el(vsnu4trxrmfciodfpD lueo (0srxoxo3iu1amenmnvs (f rurxr nt4tpxoiieiatfaDuan ont0 lerif3iatlpDeanvolt0tetmimpnudll  mnvslt a2taxr ou4openmfeiydfs2el(von(0teeoxo ootomt  ivs;s  exmxmpio4ll elfvtat)srua(r ;t4tleo oetltfs ul(vsnt0trtomr to1omtr i o t s2toirpiydopt lfei () rua(mo;u1tlx moeiltfaDumumpnu0aeerio tatfpteanei s0t2tmxmpiu1amtemfet sfaDua(r ot0oeto o3tydls umu p () leomf to1la r nvs (  rxmio nydapenmncil( srumx  nu4ale ii3iatfa uauvont0aleniocoadla eluvil( setoiopno1lpen ics t)s2rrumoou4oee mo3tldlmDrmuvpnt)trxoio oytfaDelivi;(  eumxrpou4ame  fcslt)aruaur ;t0tet mi3iatls ra(ms;u0trtoif oydfpD aneo;s  2urxr oo4al emnesl(f rra(mpnu0aptnii3iat m2ua(vp (0 etnxr tadlaDeauvi;(0 eum(rpno1omeelfet t)sDumxmpoo4alx iociadls2ul(vs;(0trenif iytfa rli i s0trurxm ou1omt  ivtas) Duaum ot1optnmfetyd sDul(mo;t0tlermrctydomt au o;s0tetrir no1opt  ieil() Duau oot0tlx moeils sDemu p u)tleoxfcoatomDeauvslt trto(o3oo1lm nlnctltf Dururo;t4alt  o3tltfmDum( s t)arxoio3ia1fptrlu i;()t2tmim3iy1lp emnes ()srtmxrono4oex  ieiysfs rlu o ()tlermo iotfat  i o;s0s2uo(o oo4oltnlies t)s2tmu  oo0tpxnmietysfaDrm(vs (4texrmocootlm e uvs s0srxoirpiodamte fvtlt)artaxr ;u4oleo feiatfsDulnmp t4artrmr tydlate uvi s)setoxmpnu4lltnlnciltf Dtmxr ;u0oexnii3tydla elnmp;(0trermr iatom e n s;(  2xmio io1altnlnvs ( srraump;u4texoiiciadlm el( s t0texnmo3to1lmDraieo ()trxmirpiu4llte ieia( arrmxrp;t1alxoifeiydfa eanvo (0altnmociy1fatrlnvo;(0srxmirpnodop   ncils) Drmxmpou4tlxo fciyd m2um( o;t)trtrxr oadoaDeaieilt0 exr(opio1ame micias) rtaxmp;u0olxomociaslm2uluvs t0 eenxr3iotoa eauei s  exo(m3oydal e nctls)sDtauroou0apxoiictldfaDea( o u)aeenmfciytlpDe u o;()s2xrim3ou4olt lnctltfs2tm(r ou4aeeniicias m2rm(vp;t)tltnif oadom elivs;t  rurir3ou1apenlncia( a2rmu pnu0oetniociatfsDemu p t)aexnio3tydlp  lu i;t  exrirpou1ame lfcil(f rtmxronu1tlxn f3ildlm2ulnmsnu4 eermo3iadom r iei (  exmxo oudlp n fctlt  rrmxmp;u4oeenmiciatfm2ea( s u4alerifcto1fp rluvil( srur(rpio4lp elivi s) Drr(ro;u4olxn f3tat sDea(vs;() rxoxf3todlaDeli s;( s2tr(r3oy1alen fvil(farraurpoo1tpxn feiatfsDul(vp () lenmf to1opD au o;t)tetm(r io1amenmnetas srrru  ;o4oex mo3iasfs ea(ms;(0tlxniocio1fm   ivols0seto(m3ou1llt  ivt t srrrum nu4aetn ocilsfaDra(vpn()tlxriocta1om r nvil( teumimpiy1aptn fvsl()a2tm(mo;t0apeoif3tlsla rluvsnt0tltoxo oydlpt aivo ( trtmirpoydaptn fei tfaDtr( ont0alenmicild sDuan onu4 rxnmfciodopDraivi;s)t2xo(m3iydalt lnvtl( s2ur(moot0olx  iciytfs umuvpn()altrxocoatoat  ivols) 2urxmpio4omeemnet ( sDumurpou4oetoifeiasfa rluvon(4 lxoxf tadlm elivs;t t2umim3nu4olenlivsls)srururpou0apx  fctyt s2raumsnt0arxrmr3ootfaDranvilt t2tmim3oo1ale  ivs ( a2tm(m no1aleomfetldfmDua(vo;u0arenio3tytfatelivi;s) 2xr(o iu1ll   ictas arraxro;o0alx ii3ild a ra(vs u) exnxo3iatomDrauvo;s)sexmio3ou1ll e fcsatfaDtr(mont0alx ioeiadfa2elumpnu4tetoxfctydlpt  ues t  2xmxopiydamtelfeta()sDua(mpot0tlxoiiciydfs2ea(vo ()aexrir tadoa   nes;t s2tmxr iu1lpeemici (fsrurx pot4teeomiciys aDuluvsnt)treomfcio1fmt lnvsls) exrxr3no1ll   ieil( sDtmur ou1opxomoctad aDrlump;t0teeoio oodfaD ln s;s)sexr(mpiu4ol  lnvtlt)sDurxronu0opt mieilt a ra(vsnt4alxnmo totoat aues s) 2uo(opoy1llen nvil() 2taxroot4ape miciatfa2rl( s;u0treomrcoa1faDeluvi;(  2xm(m3nodomtnmfcil( srrm(rp;o4aee  fcildfs el( o;(0 eerif3oodlpDrln o;t)sexrxr oy4omt mnvt t)a2rmumpou0apeomfctad a2rlnmp;(0trerif3totoatrauei t0 rxrirpoy1ll n neia(faruax oou1apeomf3ilt m2ulu sn(4 rxoiocoodlpt  n s;s)sruoirpiudlltnmnesl()a2umx o;t0olxo oeiydls ulnmo;(4artnmo todlpteau ols srur(r oudaptnlnvt (f 2taump;t0tex moetadlsDrl(vp u)aeerxf3totlm  lnesls  2tr(m nu4lp n iviat) 2ua(mpnt4aexn fciltlm eln s (0trtnir3iotlpDran i;t) etrxrpiu4ll  mivt ( sruau  oo0olxoioetltfs rl(mo;t)tltnmo oadfpDeln il(0 exmxr3oydolee ici t aDtruront1teen fcilsfa2ra( s (4texnmr tytfatelivi;() exoim3oudamenmnciltfsDuaxmp;u0tpt mi3tatla um(vs;u4 etomrctadomDean s;t)trtr(opno1am  lnvtat  Dtru p;u0aeto iciltls ea( sn(4trtnxrcoa1om  auvo t srtmxm iydaleemictls)s2rm(rpou1tle if3iatlsDeluvs u)arxomrcoy1lpt lueils0srxoir3nu1lmenmics s a2trumoou0opxnmociltlm rl(vont4aexnircoatomDrlu s t0srxmirpiu4ll elivtl(fa2tr( pou0altoifcilt a ua(mp;(4alxnxf iydfaDe i i t)setrir ny4ale  fcsat aDtmxmpot4oex moeiad s2ea(vp u0aeerifctytopteln o;t0sruo(mpoy4altemnvta( sDumxr ;u0tpx mi3tys sDulu s;t)teeoxr3oytomDelivo t s2toio3nu4lptn fvi ( a2tmum ;o1tpe iictldfm ua( snt)artoif3totfmt ln o () etoiopou1llt lnetat)aruru o;u1oexoifciyslmDulnvsnt)tlenxr iytla  au s;(  2urxm3no4om   nei t)srtm(mont1tpt mo3ildfsDumn ont4 eenmf3oodoat  i i;s t2ur(mpnu1amt mfcia() ruax onu4oexoii3iltlaDelnvp;t4aexrir3oodlaDran o (0srxr(mpiy1ll nmfvt tfaDraxm ;o4tltnifeiyd mDeluvp t)aexnmf ia1fatrli s s trxoxm oodapee nes ( s2umx pno4openmociytfs ean p;t)arenmrctadop rlieo ()seurxr iy1al n ivias a2taxmo;t0ole iocils mDelums t0 lenif3iadfmt an ils0t2urxo3oo4oltn nctl( srrrumono4opeoio3ild s2emnvp (0aetrmr3iy1oa  anvo;s0seuoxr iydlp n ivs (faruaxr nu4optnifetatlaDrlumpn(0tlxnxo iydopD aieilt t2tr(rpiodalee ict sf rtmu ooo4texnmieiat m elu p t)tlxnxo oa1oaDrauvsl(  rxrio3iudlm n iei t a2rrumo;o4tpto fciydfaDemumsnu) lxnxocoa1fptr nvil( s2uoio nu1lmenlnvi (fsrtmx  ou1ale  o3iat m rau p u4 rxrxrcto1fm  au o;( texo(mpiodalte nvs (  2ra( p;t0altoii3iasfa2el(vo;u) exnxrcoo1op e iei;s) rxoxm nodlpeemnct () Dtaxr oo4olt  iciydfm raumo u0 ltnxf ty1opt aues s)setmxr iy1al   ncsasfaDrmump;u1oetnii3iasfs2rmuvon(0areoio oatla   ieo t t2to(o oo1lpee fetatf rtau p;t4alt mi3ilt s ran o;t) renxf3ia1opDe ueo;s0 eumxo oy1lpt mnct s)s2rmumoou0texnmi3tyt m ulnmp u4artnifcto1latelnvi;t  euoim3nudlptelivsas artaxm oo1oeeoioctadlaDrlumo u)altoxr todfmDraieo s0 2to(o iy4apenlnvsasfaDrax  ;o1tetn fciys s2em(mo ()aexnmr oa1fpDr n i;()sexm(m nydlp elnvsas)srrrxmo;t4oeeniiciadfa2ean p;t4artnxf ia1oat  n ils) etoxmpoudom eliviltf 2ur(m ;u0ape ifetltlm2umuvs;(4aetomo3iatomDranvo;s t2xoio nu4lleelfvs tf Dtaxmont0aleomo3tad s2elnmo;(0tlxoif3oo1lpt luvs;(  2xoxo3oy4ol   icta()sDtaumoou0olx  octldlmDemnmon(0alxoio3iodoaDe i s;(0sexr(r3ou4omte fci (fsrum(r oo0tle  oeils m2rl(ms t)artoif tytlpDraies;s)teuoio3oy1am   netasfsDua(rp;t1tee ioeiat s umu o () lxnxfctatlmtrauvol( srtrxo3oy1lltn ivs sfs2uau pnt0olxnii3tas mDel( sn(0aexoif ootomte uvol(0 2xo(o iy4lpeelfcs s  Dtmu pno1aptomo3tyslsDelnmon()aexnmr3oatfpDeli ils)teum(r3iu1lp elicsls artr(  ou1open o3tytla2em( p;() eermfctytlaDrlnvi t)srtmxo3ou4lm  lnci () Dtaumpou4alt  fciaslaDulnmp;t4aeerir ty1lp e uvslt0 eur(o3oudopt lnet t a2ua(rpnt4oltnmo3iyt mDeln p;t)tltoxrcoydfa eaneols0texr(o3iudll n ivt t  rraxmont0tlxomfetatfaDua(ms u0 lerir tytfp rli ilt0 exrxo no4lmtelivsls s2tau pou4optomfeiasfsDrl(monu0tlxnxo3tatla eli i t)sexmim3ny4altn fesl(  Dra(rp;o1apenifciydls2rmuvp u4 eerircio1oat aies;t0s2um(o oy1ol   ietls s2tm(  oo1tex mfciydlaDeau o;(4trtoif3io1la  au i t  rum(o3iu4lltnlici t)a2rmx  ;o1tleoifeiyslmDrau p u)tltrxf ia1oatr nvs s0texm(o oo1ll emfci s  rtmxrono0tptnio3iysfa emu onu)aleomfcoa1oaD  ues;t)s2to(r oo4am n nci sfsrurxrooo4tee  iciad m2rl(mon(4tetrxociydlmDrauei;s0 2tm(m3iu1ol nmnct t srrmur ;o1olxn ietatfa2rluvo t) rtoifcoy1fat  ueslt)trtr(o3oodal emictl()a2ta( ont0tlto feilslaDelnvpn(0aeermr3iodfmte ieils  etrio oodllt  nesas sDua(r ;u0tlt mf3taslaDelnmp (4teerifctydfa  aneo;()seuoxmpiudlp n fviltf Dtax  ot0alxoio3ildls2rlumpnt)aleoir3ootoateaivolt)srxrxo3iudom emiei s)sDra(mp;t1tex  f3iadlsDem( p;u4aexnmo3to1fmtrlivs;()srxrim3iudomen ivs t  2urxm no0tet ii3tltfa uanmp u4teenxr3iytfm raivs s)texmim3oy1ll n nvt tfs2raur no0openioeiysfaDrl(vs;t4artnmr ty1op r nes s setmxr3no4lp   ncil(fa2tmxrpot0ole micilslaDemumsn(0tltoifciytlmte iei t0t2xo(m3ou4llee iet s sDrmxrp;t0aee  ieiltlmDrm(mp u)tltriociadfmt an s (  2uoiopoodoltemfvt (f 2tmx pnt4opx mfctatla ulnmo u0 rermo oydlmD anvs;t)s2toio oudom elivil() 2rmxmpnt4apenmiciatlm2uauvon(0 renxoctodfmD ln s;t0 exmimpoydal  livsl()a2tauro;t4tlt  i3iltfa elu o;u)arerxo3oa1faDelues;t srxr(r ny4ole  fcsat  rtrurp;u1aptn fetls s2rln sn(0trermo3ia1lmD livol(  2um(m nydll nmncsltfs2tau  ou1tpxomfciysls2rmuvpn(0trenmo3oydlptraivs s) 2urxo3iudolee fet s)srraurpnt1oetniociyslm umumpn(4 etoifcio1oa elues;()tetoir nydomen ncsa( arra(r ou4alto fciadlm ua( snt4tltoxfcoytfa rlues;t s2xr(m3oy1ameelfet (  Drr(rp;t4tleo ietytfsDrl(von() rxrmrcoy1omtr u ols)tetoirpio1ap n fcsat artr(rooo1aptnif3iydfmDulnmo;t)alenif3iy1fmtraiesl(0trtmxr3oodlm e fvs tf Drmumo;o0aexnii3iatls2rmuvpnu) rtrircoodop rlu s s)t2tmxm3iydomtn nvs s) Drr(mo;u1opt  ieiasla uaumpnu0tlermr3oydomteai s s)srtmim3oo4al n fcsatfaDrmumoot1tle mfeild m emn o t)aetomocio1op  lies;t tetmimpnydolt mivta( sDtax p;u1olxn fetydlm umuvo;(4tltoio oadoatrlivol(0 eurio3nudaptemics () 2tmx pno0tpe mi3iat s ra(mp (0 etomocia1laDe nvo;( trxoxrpny1apte fvsasf Drrum ;u1alxnifeiatfm um(mon(0tetnxo3iodfmDrluvols) 2ur(o3nu1ol  mics ( arrmu  ;u1olxnmoctasfmDelump ()areoio oo1op rlnes t0t2uoxr no1lmt  fesls aDuaum ;t4tptn f3iysfmDeluvp t)tetomf3oatfptr ivsls0tetm(opou4ol emfvi (farrrumpnu0tetomi3tasfm eln o;u) rxnif totfpDeauvsl( t2to(o no4ap elfcs t  Duax ooo0aexo feiydlsDrlnms t4trenxr3oadomD an il(  2urimpou4lleelfetltfsDtrx oou1tptoii3taslaDuau s;t0alxoif tadlaD  uvs ( srtr(o oo1op emictasfs2trumo;t1tee iietat a ra(mp;u4 rtomr3to1la  lnei t  rxmiopno1oltemicsa( srrm(r ;u4tptnmo3iatls elnvon()trtnio ty1lat  neol()teuo(r iy1open ivs s)aDtaurpot4oeen fciyt m ul(ms;u0 lermo3todoptrliesls0s2xoim3oodlp  miet sfsDumum no1aleo f3iadfm2ran s (0teenif iadoat luesls0 exoim3nodolee ietlsfsrur(mo;t1oleoioctls sDrluvo t0texrxocoodop  aieols srum(opnu4lp   nvi ( a2tm(m ou0apxnio3ias m2ulumo;()aexoif ty1oa  lnes;( srtriopoodlmt mnetat)aDtrumont0apx  fciytlmDemuvp t4 lxoxo tadfatraiei;t trtr(m3iu4llen nvt t)s2rm(  ;u4optomfetydlaDelumo t0 rxoir3iatoaDrau ils0srtm(r oo4lmenmfcil( a2rmumoot0aetnmictadla2ua(vo;u0texomrciydoaDeli s;(0trumxo3ny4olte fet tf 2um( oot4apeo oetysfa2rmu o;(4tetrmf iotomt au ilt srxr(r iu1oltemnvsltfsDtmu  no0optn ieiyt a2emu p;t4alermocoa1opt  ieolt) rurxo nodom e nciatfsDrrur ;t1tpeo o3iys a emuvo;u4teenxr3io1fatrlivslt s2xrir3oudam nmivil()aruax pnu1aleomoeilsfmDelnvsnu0artnxf oy1fmtr ieo;t0srumxo oo1am e nvias a2rr(r ou0oex ioctatfmDumnvpn()tltoif ty1lmDrauesls  exr(m3ny1lm emfvtltfa2rmumpno4opeoii3ildfmDeauvpnu)tlxnxocoatopDrli s;(  eumio3iy1ll e ivsa(fa2ua(mp;u1ope io3ias s2emump (4tltnmfcto1lpD  ivolt)srum(rpnodapte fvt (faDtru oou0tpto oeiltls2umump () etrio3iydfa r i o s)s2xr(m3io4omee ieta(fsrumx  ou4texnif3iaslm2rauvo u4 rxoif3oo1omDeanvs;t t2uoiopoodop emivs sf 2rru poo4opt  o3taslm2ra(mo (0tltrirctodla   u o;( srtoim3oo4olte ietlt  rrm(r nt0tetnmi3iaslmDulnmo;()alxomr ta1lp  aueo;()s2to(mpoodomenmfes (fs2ta(  nu1optnmfeiyd s emu o (0tltnxrctadop  an sls  rurim nu1lpeemneiasf rtmxr ;t0teenii3ildlsDea(ms;t) lerxfctydlptelu i (0teur(m nu4opt lfct ()s2rm(r ot4alen fctadfm rlu p u4aetrxf3oytlp e ivi;() rum(m3iodapee ivi () rta(mpnt1oltn fetldfs2um(mp;t0 ltrircootopte uvo s) exoio3io4lme lics () Drr(mpnu4aexnmi3iytfm elumon()trxnmociotlmD  ivi;s0 rxrir io4aptn ici tfsDtmu p;u4olxnmo3iyslsDranvpn(4 exomfciadoatraivs;s0srumim no1olte nvia(fsDrmxm ;o4texoifetatfa rlnms;(0 lenxr3oadoa raueo t teurxmpiu1optn fcta(  2rmum no4olxoiocias m2umuvp;(0texomo oo1lmDrli o;()srumio3oo4amt lics t sDur(m ou1olenmi3iltlm2rl( sn()tetoio iadlmDeaueol(0trurir3iu4al nlfvils a2rrur ;u4aetomf3tltfa ul(vpnu4areoio iodfp r ues;()texoxo3oy1lm emivias a2rmumpno4apxomi3ilsfaDrmuvpnu4artnircoa1lmte nei ()texmiopoy1lpt mfvsat a2tm( poo4oeeomo3tlslaDelu s;u4aleoif tatlmD livs;( srtoxo3io4al e ivi t)a2rrx o;t1aleomf3iltfa eau p t)tetnircta1opDr u i t) 2to(m3io1altelivt s  rra(rp;o1opxn iciysfa ran s;() lxnxo iodlptr nvs;t  etm(m nu4lp  lfvilt)arrmxr nu0aetnifeiysfs2uanvp;t4trxomrciytlm e n olt)tetmir3iy1lmtn iesls)a2rmu  nt1apeo fciasfs2rmums (0alermr3iadlpDraivs s0texrxo oo4lmtn fct s sDurx  nu0aex  f3iadls2umu s t)altoxf tadoptrln il()t2xm(m3iy4om elnct s)s2taur oo4alxn ieiytlaDra(mp ()tlxnirctadfmt  uvolt)srtr(opoydlpeelivt s)s2tr(rp;t0apeo f3iys m2el(mp;u)artnxf3iy1lpt lieslt0 2trxr oodol  lfetatfs2tmxmpnu4aex ioeiydls rmn o;t4tlenmo oa1lpD  uvslt)trtrxo nodome  ieslt) Dtmxmooo0aeto i3iltlm2umn s;()alxoxr totoaDelneo;( trtoio3iodap  lfvils  rua(moou0aeeomi3tysls2raumon(0aexoircoo1lpDeauei s teuo(m ny4op emfvs tf rurx ono1tpt  fctad s2um( onu)trermf oydfaDeai ilt texm(r no1llenmiei (  2tax  ;u0ope  f3tls s2ran pnt)arxnif iydop  lu ils)t2umxopio4alee nvi s) Dtr(mp;u1tltn oeiadfa2rauvs;t4 reoircio1lmDraneslt tetoxo ny1lme mnvt t) 2umur ot1tpx mo3ildla2eanvo t4trtrir3oy1om rai s;s texrxopnydamenlieslt)s2rrxmpnt0olt mocilt a eanvsnu) lenxo3iydfmDeli i;t0texoxopoy1ll  mnetas  Duau  nt0aleomo3tlsfa2elump u0alxrxocoodlmte nvol()sexriopny1lp nliciasfsDtrx  ot0oleniocilsfa2eanms;t0treomr3oatlatr ivils0sexrxo3nydopenmncslt)aDrm(m ;t4alen f3tltfa ulu o;(0arxnxr3iodfmD aivol()t2toxr3no1lp elivtl(fa2trxmoot1alenmo3ilt sDumnmp;()trerir3oodlaD  uvi s s2to(opno4lmt  nct t  Dtr(rooo4tptn fetydlaDelnmpnt0 rtrmrcoydfmDean o;(0seuoxmpiy4ole lfctl(fs2ua( p;u0aleomfcias m rmu s;t4aexnmf to1optrlivsls0tetmxmpiydoptnlnesl( s2urx pnu4aptoioeiyslsDem(vs u4aeeomr oatfmDeluvi (  exo(m iudom  lictatf 2rmurp;u1alenioeiyt sDranvsn(4 rxriocoy1lp eau i (0seuo(o3nu1am  lfvtat aruaumpot1opxnioetadlm um( o t0texnif3oa1lp ran i;t0setrxm3oydop  lncslt arrmur ;u1tleoifcils m rl(monu0 etnmf iytfaDe ivi;s setm(o iu4ll emncil(f 2uru o;o0aptoifeiytlaDra( pnt4teerif oa1oatraneils0 rtoxo ny1ome lnvt s)s2rm(rpno0opx iietad a2ranmo;u4aetrxo oydfp eln i s0 rtmxm oo4olen iei tfsDrau o;u0opeomoeiadfm um( o t0tlenxrcia1lpt luvsls  etm(rpoydalt lfetatfarum( ont0oex mf3tldfm rauvp;(0alxnmf oodomteauei t)teuoirpiodomt mnviat)s2tru  ;o1tlx if3iyd m2rlump;(4 rtoxr3oy1lp e uesls t2xrxm no1om elieiltfarrmurpot4tle micilsfs2um( snt0tetniocoytomteau o ()srumxm nu4lptemfvi t arrau  nt1tee mfeiytfa eln sn(4texnif tytfmtelieol(0 2tr(m3iydal elivsas a2tmu pnt4olt mo3tldfmDrauvo t0 rxnir3ia1la raivil( trurxopiu4ol elietl(  rrmx  ot4ope mo3iatfmDuaumo u4artrir3oydoaDr uvolt) rtmio ou4lmeelnctatf Duaur ;o1oltnioctytfm2ranmo (0teermf3iotopt aues t) rto(rpio1al nmict t artmu  ;o1apxo ieiadfs2rluvs;(0trtnxf ootom ran i;t0texoiopoudol elfvtas) 2trxm ;o0tetnmictlt sDea(ms;() exrmocoodlaD an o;s sruoir3ou1lmee fci s)s2rmu ont1tleomoetldfa2rl( s;(4texrxrctotlpD  uvs s trum(o iodalt  feta(f Duru  oo1alto oetysfmDel(von(4tetrif iadop elnesl( sexmiopio4llenlncs ( arrax ooo1tlxn feildls eaumo u)alxrxr oa1fm   nes;() rumio3oodlm nlnvsa()a2trurpot1teeomoeiydlaDean snu4aeenir iodopD aivi;()seumxopio4omtnlncsl() 2tax  nu0tetn f3ils sDeaums;u4 rxomfcoydoa r ivi;t t2uoxrpny1lltnmnvia(fa2rm(m ;t4oltnmfctlt a2umnvo;u) eerio3oo1laDe i o;(0 2toxopny1lltemieta(f rtax  oo4oetnmfeild sDelnvo;(4artoioctytoat luvo;( s2xmxr iudam  mnctls)a2ua(mooo4olt  o3tadfm uanvo;u0aexomr tytlmDraneslt0teuriopou1aptnmicslsfsDtrxr oo1aexo oetatlm2rmnvp;()alxrmo3tytoa   uvolt) 2xo(r iu4op nmnet () ruaxmo;u0olxn iciysfa2eauvs;t4aetnxfctadlpDe ies;s)setoio3io1lmenliesasfaDtr(mpou4tleomfetydfaDranvont4teeoifcoy1lpDe i ilt)texrxmpou4olt lneil( arrm( o;t1alxn oetyslsDemumo;t0texrif3ty1op rli s t0s2xmirpno1al n fvsas)s2trum ot1oltn f3tlt sDra(vo;u4tetrxr3iytlp e uvsls0seuo(o oo4oltn fctl()sDta( pnt1tlxo fcils s2rluvp;()tlenio3ia1optelneolt  rxm(rpny1opt lncslt a2uax oou4tet iociatlmDua( pnt4tlxrxrciotfm rlnvi ( sexm(r3oodlptelfvtat)sDtmxmpou4opxomi3iadfm uauvont) ltoif tatlpte neo;t0seuoim io4lm  lictas)a2tm(m nu4alt mf3tatlsDuluvpnt4 ltrxo oy1fm  an ols  rxo(m3nydll   iei s)srtmu  ;t0aet ioctyslm ranvs (4 rtnmo tadoaD aivol()srxm(mpiy4omtelfct s) rumxmp;u4ope  octat mDua( pnu4aexoiociadfmD auvs;(  etoxm3no4al  mfct s) Dumxronu1tlxn i3tlsls umu o;t4tltomf iydoa  ai sls0 rum(r iy4al   fcsas)arua(mo;o4opeo fetlsfmDea( o;u0treomf3io1op eauei;s0 2urxr oodoltnlfcilt  rur(r ;o0tle mieild m ea( p;u4 renmrcootfm elnei;t  2urimpoo1op elicsls)aDraumpno1openiicils s2el( pnu0arenxr oodom e n s;(0s2uo(mpoudoleemivta(faDtmu  oo4olxniictlsfm2elnvs;(4alxoircta1lmDe n ols0 etmiopiudapt mnvsl( artmurp;t4aetomfciyt mDelnmo ()tltrircoadlpD auvi () etoim ou1apenmieslsfsDrru p;o0oeeomoetlslsDran p u)tetoir3todfaDr nvi;( srxm(o3oy4lleelnviasf 2tr( p;o0oexo i3tlsfm uln sn(4aexrif3oo1omDeanvil()t2xm(o nudll e iei s s2tm(  nu0aex iociat s rmnvsn()tlxrio to1fptraivolt0 2trxo3oo1ll  mnvils a2trxmono1aetoif3iadfa ea( o t0 rtoiocoy1lmD anvo;t t2tm(opnydom  mfvtlsf Drr(rooo0opeo f3tysfsDumn p;u) rxrmr3to1lptranvs;s0srto(m3oo1apenmnvil(faDtm( ooo4ole  ictlsfm2umn o (4 lermfcoodlptranes;t) euoir3io4al n ncs (faDtaurp;t0aee ii3ilsls rm(vs;u)tleoxo iytop   n i;()tetoiopnu4am  lfeiasfarua( p;t4aex  fciydfm2elumpn(4 etomrctatoptran olt)s2uo(m3oo1ameemietlt  2ra(mpno4aeeo oeias sDul(mpnu0aetnir oo1latelu o;t)t2xmir3oudol nmici t)sDuaur nt1ape iietls s2ul(vs;t)texrxrciodlpDeai ols0seuoxmpny1om n nesa( arurx  ;o1alxnifctlslm2ranvp t)alxrirciatlmDeluvo;s)t2xmimpnodap e fct tf Drrumont0tet io3iltlm2um( p;()tlermf todlmD  n o s) eurio3iu4ome  fvias  rrm(ront0aleomi3iasfm2rmuvo;(0alerio todop   nesl(0s2xm(r3io1al   fcs t) 2raurpnu0alt  o3iydla em(mp;u0trxnir oodlmt livo;s)srtmimpoudap nmfesl() Dua(rpnu0tltomf3iyt sDrmnms;()trtomrciodfptr u i;(0srxrirpiy4op   fvi t arurxmp;o1tpxomociaslsDra( o;() renxrciydfa rlivs;t texrio3iy4omtnlfeslt arrm(m ;u4optnmieiasfs ra(mp ()texrmr3todlmt  ivols)t2um(r3nydamtelicsasfsDraxro;o0texoio3iasla2um(vpnt0 etnmr3iydopDeauvils trtmio iy4alt mnciatfarta( o;o0olxnmietyslm el(mp (0 rxrxrcoatomt an s;( srxmir3nydll e nvi t) Drmx p;o4oetomoetasfaDrlu s;u)texnirciadoatr n s s) 2xoiopou1oltn fvi (f Draxrpot4olt ifeiys s rauvp;u) rxrmo3tadomD ai o (0sexmim3ny4optnmfcta()s2urxmo;o4olt micils a2uaumonu0 reoxo3ty1op  luvols0 2tr(rpnodomenlnvi (fsrtmuroot1apt  o3iatls ul(vo;t)altrxfctydla e uvsl(0teurir3nudlmtelfvsl(fs2rax pou1tpt mociyd a2eauvp (0alxrmf iytfaD lu s (0trtoiopiu1llenmfvsat s2tmum nt1aexoif3iadfa2ulnvp;u)arermrcoo1lpDeaieils0teumim no4omenmnvia()a2tau oou4tpen fciatlsDelu s;t) rtrxr3ia1lm ean il(0truoxmpny1altn fcsat  rtrxmpno0opxomiciytls eln o;u4teerxo tytopte u s;t0 rtoxopiy1ll  lncia(f Draxr nu4opt ioctydlm umumo;u4aetrxrcoytfmD  uvs;(  rur(r io1ap nmicta( arrmumont1tlen ictld a ua(ms;() lerifctodfpDeaieilt)tetm(r oodll elneiat srtaum ot4texnifctydfm rau p;u)arerxf3to1la   uvs;t)t2um(o3iudam nmneiltfa2taur no1oeeo i3iltfa rmuvp u4artnmrctydoatrlneo;(  ruriopnodlm  mfcs (  Dtr( ooo1oexn f3iatfaDem(ms;(0altrxfctodlm e uvs ( tetoio3iodlmeelneslt)s2trx onu0aeenifeiadla2rl( o;(4tlxnmo3iy1om e i o;t) rxoim3oy4lpen fci s aDtax poo4oltn ieilt sDrmuvp;u)tetnmf iydom  aues (  2ur(rpou4amtn nes tfsDtaumpno0alt mf3tltla2el( snt4 exnmf ia1lpteaueolt trxoiopnodlmenmivi (fsDrrx o;t0alt iictytls rl(mp t) exnxo3ootlpDr nvi;(0s2to(rpio1apeemnvtlt a2umum ou1tleo fciad aDrauvon() rxnmocty1laDeaneols)texo(mpny4lpee netlsfa2ra(r nt1ale if3tlt s umumon()aeenmr oodoaD luvs;(0 rxm(o iy4lpe mfvtl()srtrx  ou1ape mieiydfm uan sn()trenifciodlp e uvs s0 rtm(m iydomt lfvils) 2uaurpoo0tlt mo3ildfs2uanmpnt)altrmr oytoatelneol() 2uoxo nu4ap  lnet ( s2rr(m nu4tle mo3iadlm eaums u0aetrmf3io1omtrlnvilt texoim3no1apt lnes tfs2tmx pnu1tet mieiadlm2umuvp;u)aetnxrctydfa e ivsls  exrir oodam n ncsls sruau pno1oex iiciltfa2rmumo ()areomf3oa1fpt anes s)trtmirpnudamenmnvil()aruaxr nt4apx  f3tas m em(mpnt0 lxoir oy1la eli slt)tetmio3io1alte ics s  Dtaxmonu0texn feiadlaDul(vp u) eeoif3oadop eliei;( trtmiopiy4alt lnvta(f 2tm(rpou1aet  f3iltla2el(mp;u)tlenir3todlaD ai i (0t2umxm3nydal n icsls s2tm( pou0tpxnmf3iysfs rm(mp (4trenircto1faDrluvi (0s2to(o iudamen ncsltfsDrmx  nt4opxn f3iad s ulnvont4altnio oadfm rai ils) rtmxm3iy4op nlietlt)a2umxmp;o0opxnmiciyt a ra( s;(0artrmr oytlatran o s)seuo(o oo4ap  lfei s s2trxrono0tlx mi3ias mDul( s (0 lerir oy1opte i o (0 eumxo no4am n fvtas  rtaxrpot4aexomoetatfs em(vs;u)tetrifcoodom e uvs;s0 2tmimpiu4lp n fctat srtru  ;t0oltn i3iadla rlumo;() etnmf3oodoaDe neo () rur(opoy1amtn fctas) rtru pnu4aetn ietatfs emuvp;u4tltrxf oatlmt aieslt s2umir3nu1aleemiesa()a2rrx pnu1altn fciatlmDumnvo () exnxf oadlaD  i o s truoirpiy4opeelneil(f Drau o;t0tlto ieias sDean o;t0arxoxf3iotfmteli o (0sexm(m3io4lm   ies sf 2taur ;t1tpt  feiaslmDemnvp;u4trxoxo io1omDeln i t) 2uo(opio4ll emfvt tfa2rau oou0tlx  feiltfm2umnms;(0tlermf3oatfptelivi;(0 ruo(r nu4ope  fesatfa2rmxmpoo1tpe  oeils m2ulnvon(0 rxnmocoa1omte ues;()s2xm(r oy4al nlnvi sf Drm(m nt1oexo iciatlsDean sn(4areomr3ootoaD lnvilt) rur(r3ny1opte fctlt  2rr(  nu0olx  ociad a2em( onu)tlermocoy1oatr u s;t t2xoim no4alenmnvsat  Dumxm nt1opx moctatfs eln snu)alxnmo oatlmD  uvolt0srtrir ny4alenlnes ()sDum(mpnu0opx ifcils mDrm(vonu4tltnmfcootla eliei;t)trto(opiy1amtn nvtls)a2ta(rooo0aet io3iatlm2uanvon(0texrmrctydop  luvi;s)s2xoir nu4alee ietl(  ruaum oo4tltomociatlm emuvs;u)alerxr totlmt  i o s0setmxopoodllenmnvi tfarumurpot4tetn oetatfs ra(vp;(4artrio oy1lp eanvi s srxm(o3iu1open fctl(fsrrrx pnu1oeenifeiatla el(vo;u)texoir ia1la eau sls0 2urim3oo4op e nviat  2taur oo0apxn ietytfs elnmp;(0arxomfcta1la ean s;s)seuoxm3no4am nmfes t)artrxm nt4apx  ietad m2ul(vp (4 ltrmf3iadfaDe i i (0 2uoxo iu1lptnmneils) 2tmump;o0aetnmoeiatlm uluvsnt4 lermrctytlaDe uesl()trxmir3iodope  nci t)s2tm(m nt0tpenmoetytlmDelnvsnu4aexrmr3ootomDr u i t)s2xrxrpoydolenlfvs tf 2rr( pou1teeo ieiys m2ranmo t0arenxf3ta1faD lnvs;(0 exo(m3iy1ll emfvia( arumumo;t1apeomocildfm elums ()tlxomrcoytfatrai ols teum(m nydll emict t)srurxm ;u1apenmf3iltfa raumo;(4arxrmfcoydom   i i;(0 rxoim3io1lmtemivtl(  ruaurpou4tlt  f3ild aDeauvs;()tleoxr3oa1fa eluesls s2umxopiudlm  mnvil(  Dtmxrpnu4ope ioeilsfs emu p;u4artnmr3todlm eli s s teur(r ny1ameemnei ( s2umump;t1tptn fcils s2umump;t4teeriocoodfateli i;s  rto(o io1omtn nct ( s2rm(r nu4oleniietatlmDua( p t4 ltnmo3oytfate neil()trxrxmpoydlmen nvtatfs2raumonu1apeoiociadla2ua( snt0tleniocoodfm e ueils0srumir ou1am nmncil()aDrrum ou0aex  f3ildfsDeaump;u0trtrifctydfmDeli s t)setmxr3io4omenlnesls s2uaxm ot4oleoiieiytfa2uluvpnt4altomf3todlate n i (0trtr(opoo1amte nvil( a2rrur ou4tlto fciytfa uauvo;u4 etoxf io1omteaueols)s2xoir io4ol emnvil( arrau pnt0optomfetldla2ra( on() lxnxo oydoa rln o t)teuriopnodol emnvt ()a2rau onu4oltniieiadfa2rmu s;u)trxnmrciytfm  livi s)t2xr(m3ou4lme lncs tf rumumpou4aeenmfetatfs2rmumsn(0 lxoxr3oatop rlneslt)trxrir3iu1alen fvsl(  2tmum oo4tlenio3iad m2emuvs () rtrxo3tadlpt aueols)t2uoxm3oy1lmte nesls) ruau  nt0aet  ietytla2uan on(0altniociatlaDe nvo;t  eumir3no4lmtnlietlsf rraumo;t0tlt mfcilsls2rl(mo;()treoio3oo1lmDe uvi s  rxmxm no4opt lfcs sfaruaxrooo1tltn o3iadfa2emumsnt) lenxr3io1omDe i i;t0t2toim iu4op nlicia()aDtax pot1apx mfeilsls rmnmo t0trxrif tadopDelneols0s2xmirpiu4lp elfet sfarur(ronu0oetnmfciytfm2uau o t0trtnxocty1opDrli i (0 rxmxrpiydoptnlnvsatfs2rmxr ot0oee mo3iltfs um(mp u)texnxo iotop  lieo s)srxmxm nydalt  fvilsf rrr( pnu0optn o3tydfmDuanmo ()artrxociatlpD auvi;s) 2umir no1om  livta(  2raurpou4alxnmoeiydfs rl( o;u4aexoircoydomDean i;( truoir3oo4alenmfesat  2rmum nt1openmictyd aDemu s u4texrif iy1omtrau ol(0 rxmim3nodaltelneia(fs2rmur nt0tltomfciyd aDrau p u)tetniocta1lat  uvi t)seuoir iudll  micsl( a2tru  ot4aptn ieildfm2rmn p ()trxrifciydlm   u o;(0s2tm(mpny1openmivs sfsDtrx  ou4tlx ioeiys m umnmo u0 lxoir oydlaDr i o s0seurxm3oy4op nmict tfa2tmxmpnt4oet ifeiatfaDua(mpn(0texomr tadoptrauvolt trxoxo3ou4omte ivt (  rtmurooo4opt  oeiatlm rlumo (4 eeomo3oydfaDe u i;()setr(m3oy1ap   ncsls s2umxroou1aetomi3ils s2rm(vpnt0 lenmr iodopte u i s0 2xo(rpnudame mncilt  2tm(mooo1apx mfetatla ua(mp t) eeomocoa1omDeauvi;s0t2umim oo4lpt mncilt  rrmumoot4tpxnmfeiat a2ulums;t)tltnxociytlmtraieo s)t2uoxo oo4ope lnvta( sDrm( p;u0tetnmfeildfsDum(vsn()tltnmf ta1lmte u i s s2xoxr3oy1llte netlsfsrrax pou0oet ii3tld m2ua(msnt4tetomo3iotlmtrluvslt)trxmxopoy4ap e nctls srtax pot1tltomfetytla2uluvpnu0 exnxr3iytfate nvo;t  2tmxo3iodolt  nvi t aDumump;u0texnifcildlaDemumo u0alxnxoctytla  aues;() euo(r3oo1olt lncs sfaDtmurpno1aleomietys a2ranvs t0teeoxo oy1lmDeli o t) rurim no1lptelncia( srra( p;o4tetnmocias a2elumpnu4 exrxf oytfmt aueo;t)s2trimpiy1apenmfcsatf rrrxmpnu1opxn i3tlsla elu p;t0aetoir totfaDrlu s (  rtm(r3ny1omeemfei ()sruaum no1apt mfeils m2uanmo;t4 rtnmr tytfa eln ol(0 rtoimpoodom elnctl() Dtaum no4tpe ifetyt sDran ont)tetrxo3iydomDe uvol(0 2trxm3nu1ale  iet s) rtr(m no4tlenifeilsfaDuau p (0arermo ty1fptean olt0 rtrxo3nu4optemneiltfsDrr(m oo0ale ioeiadfaDrmnvo t)tetnmocoydfat anvo;t srurio3oo1amtemietlt) rrrum ;u4tpxomi3iltlmDemnmp () lenmf3todoat anvil(0tetrimpiu1ll   ncsat)sDrr(m ;t4oetoif3iys s rln pnt4alxrir oadlaD au slt0s2xmxr3ou1om   ivtl()artmu p;t4aet mociltfm umumon(4 ltrxfctatopDeauvils)sexm(m3oudomtn ncs t  rtm(m nt1optn f3ildfm2rm(ms;()trxnmfcootlmDrauvi s) rxm(o oodoleelncsa( aDtaxmp;o4ale mo3iat m2rmn o (0texoiocoytfpDrlu ols  rtr(r3iu1om  mnvtls sDrau o;u0tlxoioetatlmDrm( pn(4artomocio1lm  lu o ( s2xmir3no4ope  ietl( sDrmx o;t0aeto fetlsfs2ranms t)trerxo3totom  ai s () exmirpnudlme liei tfarua(mo;o4opt if3tadls2ra(ms;u4aexomf3iadomDr i o;() rumxmpiy1apenlictls)sDtr(m ou0tle moetatfs2uanmon(0 exoxr oy1la e uesls  2tmxr3oo4lptnlncia(fa2rmurp;t0tlenmi3iad mDea( p;t0teermfcoydopDe uesl() 2xmxo nudlltnlicta()arrmurono1aptnif3tltfm2ua(mpnu4alenmf oa1lmtrauvs (0trxoio iu4ome mfvsa(  2taum nt1texo ociydfm2el(vo;u4tltrmf3iodfaD  uei;s)trxrim3oy4op nliesasf rrax  nt1oleoif3tadfm2rl(vp u0alerxf tydlmtelues;s) etmxopiy4am emict t) rra(mo;t0altniieiyslmDeanms;t4 eerxr tatfa r nvil(0trtmiopoydlm  mnetasfa2tm(rp;t1optoif3iadlm2ranmsnt0aetrmo ootomDeaneo t0s2xm(rpnodop  mfviat)arta(rp;t4apeo fctadlaDranvs (4 lerxf3oo1lpDelueolt0seumxr3iu4lle mfci sfaDra( oot1tpe iictltfs2raumsn() rxrmrctodlpt auvil(  exoimpnydaptelfeta() rua(r oo1olx io3iadfsDulnmp;u4texnxf oytfp eauvsl( seumio no4amenlieia(  rraxmpnu4opto f3ils s umnvo;u)tlxnmo iadfmD aueil()s2tr(r3oudll nmnci ( aDua(m ;u1oetnmieilsfaDra(vp;t0aetrmf iy1lptr i s;s0 2xrio3nydlptemnci s arurx  ;u0aexn f3ils a umuvo;t4tlxnmociydom  anvo;() rtr(r3nu4oleelics s) rurxm ;o1ope  o3tatfmDrm(ms;()aleomocoa1om eln o ()t2to(r io4olee feia(fsrrmxmpno1tpx mieiyd aDemumon(0 ltrir3oodopDeaieo s teumxr3iydomee fei ( a2umx p;t4oetoifeiysls2ulumsnt4aexoxrciatoatranes ()t2urimpny1olt mietlt arraur no4oetnmo3iydfmDea(mpnt)trxriocia1lp r nvils0 2tm(r nydoptemnvias)aDua(moot4oex mocilt s2rmn p u)altnmfcta1fpD  n s () rxoxo iu4ll nliesatfsDtmxrpot4opeomoetyt sDuauvp (4artoio totop  aieo;( seto(mpny1ap e nviatfaDum( ooo0ale  oetyt a umn o u) etoircoodlptr nesls)trxo(r iy1al nlicsa(faDtmur ;o1tpxo i3iltfm eaumonu0aetrmfcoydfmtelivilt)s2um(r nudam nmfciltfsDum(rooo0tlxo i3iadfa ulump u0texomo3ia1lpDranvs;s0texoio3oy1llt  fctls s2trum nt1oeen f3iydla2raums;t)arxoif3tytlaD aues (  rxo(r oo4lle  nvt (  Dtmxmpot4aleoiocilslsDrauvp;u)tleomfcoodoate ueils0srtoxo oo4apt lneta()a2ua(monu1tpt iiciad s2eanmp (0arxrmo3tadlpDeaivol(0trxmio oo4lp   icsas)a2rrx  ;u4alt moeilt a el( pnt0 ltrxfciydomtean i;t  eurxo iu1ole  ivsa(f rrmxm nt1alenmieiyslsDran snt) rtrxociadfatrlieo ()t2uoir oo4om nlnet ()sDta( p;u1tetnii3tltla ua(mo u4trenmo3iydlmD aivil(  2to(opio4lp  micsl() Dtr( ono4aeeoioctadlmDem(vo u4 eeoxrcio1fpt lnvs;(0s2xmim3iudlltelici sfs2ra(mont0aexnif3iasfmDul(mp;u0aetoxo3tytfa e iei;s0s2uo(opno1altnlfesasfaDta(  no4ole  fciltfa2rl(vp ()texomrcoydlp rau o;s0 rurir3oy1lpenlnetl()a2ururpou4optn i3tasfm ranvs;u0alerio3todopDeln i t0s2xrxr iodom  lici (fa2urxro;u4tlxnmfeiys sDean s t4trtnxr3iydfpDelivi s)t2ur(m3oudamt  fci sf rrm( p;o4tetnmoctytfsDemnvo (0 etrxfcoadlpte uvs t truoio iudol elivia( sruau o;u0apeniieiltfa ulnmp;()trenxfcoodlaD  ieo;()s2toirpiy1op e fciasfa2tm(m ;t4oeen fetytls2eln o;u4tlerxrciytfm eliei s0trumirpnydopt lfetls)arurxr ot1apenmiciasfmDuln p t4arxrxoctatom  anvs t)trxrir3ou4alen fct s)srurx  oo1tptnifeiys a raumsn(0 eenircta1fm  ln o (0 rxoxm3iy4lpt lfeias)arrrxrono4alto o3iatfaDea( s;(0tltomfctatlat  ivolt0srtm(o3oudope lncil()sDuauro;u0apenio3iytfm2ran s;(0alxnmo totlpDeanvolt teurir3nudoltnmivsasfarumxmoou1ape io3ild s rmnvs;(0tleriociytoaD an o;s) rtrxopoo4lpenmfes sfaDrr(m oo0tetoioeiytfsDrmuvs;()trenxf3iydlaD lieilt)sruoiopio4ame lfvt (fa2tmurp;o0tptn o3iatlaDrluvp (0aexnmrciadlm   ivo;t trxriopnu4ape micilt sDururont1opt ifcias s emn pnu0altrmo todlmt  ivi;s0s2tmxo oydom elnvtlsfs2raxront1apen fetydfsDranvs t0tlenxr oatopD li o;t0teur(m ou4omteliet t) Draur ;u1aetomi3ils m rlnvon()aexnio tytoaD au ols t2toxo3oo4opt miviltfartmumoou4aetnioetatlsDrl(vo u)altnxfctodlm   uei ( teum(opoo1alt  ivs tfsDrr(mp;t0oeen o3iydfm eau p;t0arermfcoydlm r n i;s t2uoir3iydom nlieslt)sruaumo;t0oeeniiciytla ranvpnt)alerxr3oydfmDraueo t0 2trir no1alenmncslsf 2uaxro;o0alx ifetydla ean sn(0teenif3iatfpD luesl() 2xrio3nu4om n ies sfsDtmu ont1aeenmi3tls a raumpnu0arxoirciatopDeaneo;t  rtoir3io4lpe liesa(fsDtm(r oo1tptoifetadfm umnmp;u)trenxf3tatlpt li ils0srtm(r3oodome lfet (f rrmu o;t0tpeo f3iatfmDul(vpn() ltoxf3oy1la r nesls0 etmimpoodopt  nesat) Dtau  nt4tpxnifciydfmDel( o u4 rermrctatla elivi;s texm(m3no1altelfvsa(f 2ra(rpnt1teeoifciad a2emnvpnu0 exomo io1fmteaiei ()s2urirpoodlltelneias)srra( pno0aexo f3tysfaDrlnvsn(4arxnio ty1opt  ieolt texmio3nodalt lfeiltfa2tau ont0opxnioctydfm elnmsnt0areomocta1fmt  nvs;t0texm(mpou1om   ivi (fartmxmp;u4aexnmfciltlmDul(mpn(4trermfctytfa r iei;t)texmxm oo4llt mies (fsDrm( ooo4alx mi3ilsfaDrlumsnt0 lerxrctytopD  ivs s0srtrim oy1apen fcs sfsDtmu  ;u1oeeomfciys m2rlnms t)artoxfcoa1omDranes (0s2tmimpio4lpte ieiat) rrrx o;u0apx  iciysfs2rauvpnu4 rtomrcoydoa e u o s) etoir3nydlmt  nvt t)aDraxmpou4teeo fciaslm2eau s t0artoif3iotfmtranvols  2xrxrpou1ap elfei () rta(rpno0aet iictas mDel( p;()texomf oytoat  nvo () exr(m3nydol emfvi s sDurxroot4oexoifctyt mDrmn o;()aexrxo ty1lmD aivo s)seum(mpou1lpt mivta(fa2trx  nt0tpt ifcild s2raumsnu0teeomr3ootlmDeauvs (0seuoxm nydapt  neils srururpnu4alxoifciasfmDul( p u)artrmf3tatlpt ai o;t srumxr3no4op  miciat)aDtm(rpot1aexn oeiytfm umu p;u4trxoio iadfmte nei s0s2xm(mpnodam n fvsas)srtmxmono0oexoif3iad sDra(vo u) rxoxo3iadfm eanes t srtrxo3oudllenmnvias a2ur(rpnt0olxo fetytlm2umnms;u4aetnmociotfmDelu sl(0s2xrxm3nydal  liesatfaDrrxm ou4ape mietys s2ea( s;t4aeenif tadopt an o;s0 2xoirpiodomtnmict t  Dtm(mont4tltnmietysfa eanmo ()trtrxr3oytomtran o;s setrxo iodlptnmfct t) Dtmxrooo0alxo feiytfm2umn p;(0tetrmf todlptran s t0trurxm3nudlme lncilt srtmumpno1oexoiiciadfs2eln s;(0tleoxo iytfmD  n slt setoirpiodol nlnci () 2taxrp;t4oexoioctydfmDeln o;(0artnmfctodfpD  n i ()teur(m3ny4oleemfcsltf Draxmp;t4texnmf3tltfaDumnmpn(0aeenxr iadfpDrlu o;s  etrxmpoo4lm emfct t a2tr(m ou0tlx mieiydfaDranvs ()tetrio tadfmDr n i;()trxrxmpio1omt  ici t  rumxm ot1tpe mfciadfs rlu pnt0 ltnmf3iy1fpt au s;(0 etm(m3nudlptnmfciat)sDrmxmp;u1aet io3tlsfa2ul(vpnu0trermr ia1fa eaies;t) 2umxo nudlme  netltf rrmum nt1tlx mieias aDeaumo;t)teenmrciadoa  lues;t)t2uoir3oo1opt lfvtatfs2rmxr oo1tptoioctytls2el(mo t) lxnxoctydfp ean slt  rtoxm ou1lptn ict tf rtrurpot0alt  feias sDulnmonu4texnxfciatfaDelnvs s0tetoirpio4al e nvsls)a2rmu pou4oeeomietaslmDeln o t0 rtniociadopt auvol(0t2umim3iydalt  ivia(fsDta(  ou0optn fciytlmDul( sn(0 exrif iotlptrlnvo;s t2xoir3ny4amt lnciltfaDtmur ;u0oexo ictlslm2uauvs;u4tetnxo todlmtean sl(0t2xmxopny4amtn netatf 2tmx pnt1aee iieiysfaDelu p;(4texrxo3tydlpDrlueo t)srtoimpnu4ol nmnvsat  Dta(mont0apt micildfa ea(vs (4 rxrxo3oy1fmt aueilt0 exmxrpno4lleemnvtlt) rurur ;o0altnif3ilsfs rlnmp t4 renir3oodfatr nvs;() rxm(opoodll elfvtltfaruaxmpoo4olt mieiydfa rm(vp;() exrmo3iadom  lnvo;s srum(r3nu4op n nesls) rurx onu0optoifcildlsDrmn sn(0 leomo totla rauvils t2urio oo1lleemncsat artrxmonu4opx micildfaDean onu0teeoifcoadlpDrai olt)trtr(r oy1al n neta()aruaumpot4oexoiictatfmDean s;t0 eeoxr3ta1oatrln olt0tetr(opoudlptnlfes s aDraurono0tle  iciytla uanmo u4 lxnif iatfa  aivslt0s2xoio oy1llt  ict s arur(mono1aptomi3tyd a2rlnvo t4 renio3oytlmtrlnvol()t2to(r nu4llen nes ()aDtm(moou1aeeo f3tldlm2rlnmsn(0artrmf3tydoaD aivi t)s2xm(m nodaptnlieia()sDra( p;o1apx if3iasfm2rm( p;() rxrioctydfm rluvslt0sruo(opiu4amee ivia() rtaum nt1oeenifeiydfsDrmu sn(0teerxr iadlmtrlies;s srumxopnu4lle  nes ()a2taxro;t0altoio3ias a2ua(mp u0tlenifciadfa rlivs;s0t2toxo3iy1ap elfeta(fsrtax  no1tle  o3iadla emnvpn(4 reomrcoy1om e uvsls0s2toxm nu4amt  ieil( a2uau poo1aee  fciltla ea( p;t)tlenmocty1fm  lueo;(0sexoxr nodlleemncsat  2taurpou4oltniiciltls emn s;t)arxrir tydfm e u s;t  eumim3oo4lmeemfet ( sDraurpnu1oeeomictadlm2rauvont4aeeoif tatfatr i ol(0teumim3ou1ome  fvt t arra(mp;t4alxnmoetltlm2rmumpnu4alerxfciadom elivo (0teurxr iu4am  liei tfsruau  nu1tlenmieiatla ua( o;u) exnmocoatla  auvsl(0 rxmim nodomen ies sfs2tr(  ;t4tlt ioctys s2em( s;(4tleoif3tatom   i i s seumir oodolen fcsas)srrr( pnt0ale  oetas s2uanvp;u4trxomr3tytom  an i;()s2xoio oy4olenlfcsls sDtaxrpot1olen f3ils sDranvs t0tlxnio tytlpteaneo s0tetr(o3nodomee feil(f Drr(roou4tpto ocilt aDumums ()aeeoxrciotlmteaues (  rxr(m3nu4omeelfetl( sDuau  ;t4tptnif3ildlaDrlnvs t4 eenxr3iydfm   ueo;s)srxo(opiu4ol  mieias arrrur no0oeenmoeilslaDemums;t4texnxo oa1opteaieols0s2tmim3iy1al emnctat)a2ururp;t4opxo f3iadlsDuan p;t0 lenxfciadfpD anvi s)sexo(rpoydlpt  fvia(fsDuru ooo4oex  ictadfm rauvsn(0trxomrciadlatrlnvo ( srtrim nodal nlfet (faDurxronu1teeoii3iasls2um(vp u0 eenxr3oadfa raiei;t0s2tm(m oy4lmt lfvsatf Dumu oot1tlen ocilsfs2ra(vonu) exnir3iotfmtran s t) exoxo3no4alt lictasf Draumonu1oeeo feiadfa rl( s;u4altnxf ty1omtrlnei;t)t2tmir oy4omtnlfei ( a2urumpot4alxoiictaslm2umnvpnu4arxoio3oodoatelneo (0 2xo(r iu4am emfcsa(faDtrurpoo4olt ioctad m rmnmp;u)trerifcoydlpD lnes s trxm(r io4am  mfcia() 2urx  ;t1aleo f3tyt a uluvo t4 exoxr3todfate u o;( texm(rpoudalt  icilt  Dtrxr no4optn ociad aDemumonu4texrir3oa1faDr ivo s  exrimpoodll n ivsa( srra( oou0oet mi3tysfs2um(mpnt4texrio3iatfa eli s;s) rumimpiy4op n nvi s) rtmur no1opxoifcildls2em(msn(0trenxfciytfmt  i o;s0teum(mpoodolt mfvsa(  Drax o;u0oleo fetyslm emu snu0 ltrmf3tytfaDr ues ()s2umxrpoy1ol n nctlt  2rr(m no0opt ifetaslmDrl(msn(4treoxr3oydfmD lu i;s s2xm(r3iy4optelici (fa2ra(ro;o1tet  i3ild aDulumsnu0aexnxr io1om e ues t0srto(m3nudap nlncil(  Drmxr ot4tltomoeiatfsDeau p;t0areoxr totfp rauvil(0sexmxo3io1olt  ivi s  Dtrx  nu4apto fetydlaDea(vont)alxnxr3oadoaDeau o t0srxr(rpiy4oltnlfcsas s2umxr ;t1oeeoiicils s ea(vo;u)alxrmrctodlp e neol( sruoim3ou4lmeelivt ( sruaxmpot1olt if3tltfs rmumo;(0 ltnir3tatla  aivolt)seuoxr3oodal   neia( a2uaur no1tlxnmfeiasfaDelumpnt4trenif ta1laDelnvs s)srxmxrpiydam  lfcsasf 2uaxrpnu4oleomfciytlm emnvs u)aeermo3oy1lmtr n i;s0tetrirpny1ap   fesl( artm(  no0oee mo3tat aDrm(vpnt4 exrxr ootlpt livs;s)trxmim3io4al elivilsfa2uru  nu4alxniietytfs2rm( pnt0 lxnmr tydoaD ln i (0tetm(r3oy1am e feslt)aruaxr no4apt  oeiyd m2rlnmo;t0teerirctadoa eliei;s0 rto(r no4apee nviat sDua(  oo4texoif3iydfa eau o;u0trerxr3io1lptr ues () exoxm3oydoltemivsl( a2tm( oot4oexo icilsfs2el(vo;t0tltrmf3iatopDrlneslt) rumio3oo1amtelncils  Drmumpno0altnmf3iytls2uaumo;(4tltrmo totfmte nvo;s) 2toxmpnudlm e icslt) rtm(r ot4tlt iiciyslmDrlums;u) ltoio3ootoptr uvi s0 2xr(o3iu4am nlnesat)sruru  no1olxniictlt s rmums;u4 rxnxf3oa1lmtean ils)tetoim3oudlm nmncs s  2urxrpnt4opeoifciaslm2em(ms u4altoxr3oo1fmt luvsl(  rumxopiudamenlneta() rtru oot1tee  octas aDul(mp t4artnxo tatlpDrlnes;t)setoim oodamtelnvsl()a2tmu o;t0aeenio3tas mDulnvon()aexnmf3tatlate ies (0t2uoio3oydamtnmfvtls)arta(m ;o1aex ii3tld m2el(mo;(4tetnmociatfpte i il( texmio3nodomt  fvilt srua(  oo4tlx  fciyt aDelnvon(0altomf tydlmDeai o;()srurxm3ou1am  mncta()srrmumo;o4opxomieiltlm umn onu4trxoif3totfate ivi t0s2tr(m io1apeemici ( srur(r nt1texomfctytlm2ra(msnt)tlerif3tadfp elnesls0tetmim oy1lp n nctas)srrr(m nt4tlx  f3taslsDrluvp u0arxomf3iotfpD  neslt tetrio io4ap   icias  rrm( onu1alxo ieils sDrl(mo u4texrmf ty1oaDr ieols) rumxmpiu4amtnmieils s2rmu  ;o1aptnifciatlm rmn s;u0 lerifctodoaDeauei t t2tm(r oodllt  ietl( s2raxr nt0alt moeiys s elnvsnu) rxnxfciodlat lnvi t)sexmxmpnu4ll e iet tfsDtrur ou0tpt mfciyd mDrlnvpnt0tlerio3oodoaDelivo t0 euoxr ny4ll  lfvt t)a2raum nt4tpeo o3iysfmDelump t4 rtnxf oo1laDeluesl(0 rtmio3ou1lpen fcsls srtmxr nu4tee iociasfm eanmo;u4aeeoxo3iodlpD luei (0 etmxr nudaltelfci sfsDraxm ;t0aexnii3iydfsDrm( p t) eeniocia1fatrlneslt0setmxm ou4am n ictlt)sDum(mo;u1aetnio3ils m2rl( on(0aeeomr tytfm e i o;s sexr(o iu1openlnes s)arra(m no4alt micilsfs2raumo;u0altomf totfa r u slt)sexoiopou1opte fvsatfs2um( o;t0oet moetltls2um(vp;t0alxrifctodfp  ai olt s2xrxm oy4omteliesa() rtmx pou1teeoioctytla2uanvs ()treoio3oa1lmD  n o ( trurxm iudoltelnctat)s2rmu  ot1tet ifeiyslmDrmuvsn(4tlxoxo3tytfmt aueo;s0seurxm3nu1ll  mnesltfaDurxro;t1tpxnmoeiltfs2um(msn()aeerir3oydoa eli sls teuoirpiy4op emfvt s) rrmxmpot0olxo iciys m2rmump;u4alerifcoatopDeln o s) 2xr(m iu4oleelictlsf 2urum ;u1oexoii3iat mDum(msnt4tltnxfcoodomtr n o;t setmiopno1am emics ( srrru  no4apxn feias m2eauvo u0trtrmr3tatfpt aueols texoio oodomt  icsl()a2rm(r ;t1tle moeilsls em(monu0alerircto1om elu i t)trumxo3io1op   fvslsfsDrmx pno4aleomfcias s uluvsnt0trxnmfciadla ranvo;t  2xmxopoodap  mietl(fs2rmumoou4altniociadfa eanmo t0tetomo tatlptrai o t0 exmim3iu1amt livil(f 2uaur ot0alenmieiatlm2rmu pn(0alxoir iy1fa r u s ( seurio3nu1lpt mnvilsfartm(m oo1aeenio3tas s2umnms t4alxnmo3ootlpteln o;t)sexmim3nydap elfvslsf 2tr(mo;u1aeeo f3ildlaDrln o;t0 etrirctytomtrli o;t0srto(m iu4lp n ics t) rrmur ;o0tetoiicils m rl(vpnu)artnxfcoydlmD au s t  2toirpiudoltemicslt  Drrum ;u4aetnmieild sDul( p u0 reomrcoydomtran s s)seurxopiu4ap   iciasfarumuroot4apt  octytla2elu onu)tlxomfctatfm ean s;s0texo(o ou4amen ivsls sDum(rp;t0olen o3tlsls raumpn() renmocoo1fa elivsl() ruoxmpno1ol   ivtas)a2rr(  nu1oet mi3iys m em(vs;u4alxnmr iydfat anvs s0setr(opio4llee fvtatfsrrrum no0oeto oeiatlm rau p;u4altrmf to1oaD  nes;(  exm(r oy4ap nmfctl() 2rrxrpoo0olt mi3ildfm uanvpn()trxoxr tytop   i ilt) eumir oudll  miet s)artmxm oo4aetniieild m rlu o (0teenmo todla rlnes;()srxm(opno4ap emneslt  Drr(rooo0aptnio3tld s rl(mo;t4 ltnir3to1lm   i s t  2tmio3ny1op nlfet sf rtm( oou0apx mietysls2eluvs t4trxnxr totoa eai ols0srxr(r nydaltnmfet s) rum(m ;o4alt iicildlmDuln snu4 reoif3iytoat anes;t seumio iodalenmivilt a2rau oou0aex iociyt s um(vpn(4tlxniocoa1lm elu sls srur(mpoy4lpenmfei tfs2rr(rpnt0opt mfciydfm rlu o t4teerioctotlmDrlneils) rurxm nu4aleelnet ()artrurpnt0tptnmf3iys m eau p;u)aetrmf oadop ranvs;t)t2xrim iudaptnlfvtat)aDtr(m oo1tptomf3iat a umnmsn(0trtnif to1om  ai o s0 rurir nydolteliviasfaDta(  ;t1oeenmi3tasfaDumnvp;u) exrmr3iytop eaueol(  2xmiopnu4ape lneias s2ta(rp;o0open o3iasfs2um(mp (4tetrif tytlp  aiei (  eur(m oo1oltn nesls)sDuax  oo1apeo i3tydfsDeaump t)trxrio oytlpDe uesl( seumim no4alee ivtls  rua(m oo0oexo oeiytlm2umnmpn(0arxnio3iytla e i slt0srto(rpio4opeemfcils)a2tm(mp;t0aptnif3ilt m rmnvp u4alxoif totomt lneil(  2ur(opoydomenmivi s)a2uaum ot1tlx  ociyd mDranmpn() renmf iy1laDr nvo;(  rtmxrpoodom  mfviat  rrax onu0aeeoii3tlslm2ran o u0altnmr iodomtelnei;(0 rtmimpio1olt lietl( srrr(m ot4oeto fetysls uluvs;t4 rtoioctytfa  lnvs ( seto(m iy1lmtnlics s srurxro;o0apxn octydfsDeluvs u0texnxr3tatlpteaues (0 rxmxm io4amtelfet ( aDtmxrp;u4apeo fciyslsDeanmsn(0teenmr3oatoa  aues ()teumio3io4ap  mfctl() Dra(mpou4tetomi3iatlmDemuvs (4trtnxf3oydlmD  ies s) 2xrim iudll emnciat  2ta( oot0opx mi3iysfs elnvpnu4teerxo tatfat  ivsls0 rtm(r oy4op  mfcil(fsDrrurpnt1oexo o3iasla rlnmpnu0texnmo iadfm e ivilt)texo(o3oy4altnmfesa() 2ta(m ;o0apxoio3ildfm umu sn() rtrmo3oo1omt ai olt t2um(o nydoltnmnciat) Drmxmpno1oltnmfeiyslm emnvpnt0aleoio3totlpDeln il(0trtoim no1lptelnetl(fsruaxmo;u0aee  octlsls uauvo;()arxoxf3tadfaDelnes;(0s2tr(m oy1lp  micsas srua(roou1apxnifcilslaDrmuvsnt4 reoxrctadoaDe ueil(0 rxoim iu4ap nlfetls s2tmumpnt4opx ioetydls ul(monu)tlxnmrcoodoa r uvi s)s2xmxo3iydllee icta() Dtru pnu4tpxoifeiasfaDranms;(0trtomr3ty1fat luvol( srxmxopoy1opt mfei ( artmxm ou4tet if3iatfaDemn s;u)trenifcia1lptr nes s trxrir ou4lm e nctlt  Duaxrpnt1tpeoii3iysfaDrl(vs;u0aeenxrcoydfptelu i;( t2urxmpou4omtemnci sf Dtr( pnu0tet  ieiytla2rluvonu0aetrmf3ty1lpD  uvo ( t2umirpnu4lpt  ivs s)aDtr(r nt4teenmoctldfs2umnmsn(0tlenio3tadfate ivo;s s2umim iu1ll e nciat) 2trxrpnu0oetnmietyslmDeanvon(0alxoxo3oa1fpt aivi;(0tetrxopou4olt livtat)srrrxrooo4tet iiciad mDrm(vp u4alxoir tadopDeanvs s0s2xmirpiudom nmfesas  rra(mpnt1tet mi3tys m rlu o u4 lxoircootomDr nvo;( t2urir3io4lpt  feiltf rrrxm no4oexn iciydlm2rlnmsnt4teeomfcto1faD anes;s0seum(rpoy1omt  fvilt)s2rmumooo4apenio3ildla2rmu onu4trtrxo oa1fpte nvols)trxmir io1lp nmfvt t)s2trumono4olt ii3tysfs2ean ont) etrmo3tatlpDeluvilt0 etr(m3oo1ol  mnetl(f rum(r ot4texnmictat sDumu s t4artnxr3iodlaDeai i;t srto(r3oodll  mivsl( sDraxmo;u1aeeomoctysfa em( sn(0 ltrio3oa1laDran s t)s2xoio3ny1olt  nvi s) 2tmxmooo1oexomieild a rmnvo;t)texomrcto1fmtean i s)teuoxrpoo4lpe mietatfaDtm(  ot0tpxniictytla2rau s t4tltnif3tydfpDeli s s0srtoxr iodllt mfvilt  rtaumooo0tex  ictlsls2rm(vs;u4aetrmociatlpDr n s t  eurxrpnudll emiet t  Dtr(rp;u4aptnio3tasfs2raumsnu0artrio3io1opte ivs s) etoxo nydomt lnvt () Dtru onu0oeeomfeiytfmDrmuvpn()areomfctadoat ln o;( texm(r3no1olt  feta()s2taxm ou0apeo i3iytls2ulu s;u)arermr3totfmDr ieols0truoxr oudlle lnci ( s2tmur ot1oee mfciysfs2ranmp;u4alxnio tadfatraneslt) rumio3ny1am nmietat) 2rmumono0tetnifciad s2rl(vp u) reoxr oatfmt  n s ( texr(o iydol e fcsa( arum(r nu4tpe  fctat a2ea( s;t4alerxrctydom e ieolt0texmio3io1ape mivt () Dum(mp;u1opxn f3iasfaDrauvs;t4 reoxo iadfmte u i;() etmim nu1alt mivi sf 2rmum ;o1apen i3ias aDeanvsn(4trxnir iydfm r ieo s0 etmxmpoy1op emfes s artr(r ou4aptnio3ilsfa2ul(msnu)alerif3iytopte u s;(0texmiopio4op  mfcilt sDrmu  ;t4apeomiciys m rln s;u0aeeomrcoatop elu i;t0 rtrxr ou1lmtemnes () 2trxmo;u1tex  ociasfmDeau onu0altnxfcoa1optr uvs t)t2uoxr iu1llte fetlt aDumxmoou4tpeoioeilsfmDeanmo;u) lerxrctadoa raivs s)s2xr(rpny4ame lnctl()sDumxm ;t4opto oeiatlm rm(mp;(4arxnmr oydlm r u sl( seur(o3no4lltnlicta(  2tmu  nt1tlxoiociad mDem( s u)aetnircoodom   nvs t)teurxmpno1ope  ivtl(  2rmxm nt4aetnmieiysls2eanvsnu0aleoxrcio1fpDeln s;s)s2uo(m3nydome  fctl(f Dtru  ot0tlt  fetldfmDel(mp;u) eerirctydfm eaieo;s s2trxm3iu1om  lnesa( s2um(mpnu0tex  oeils m2em( ont4 ltrio oatlpDrln o;s) rurxopiu1omtn ivtas srtmxm ;t4ape mieiat m emnmp u)artomf3ia1fpDelivi;s s2xr(mpoy4apenlnvi (fsDraum ;t1tpe mieildfm rluvpnt0tlermr oatla  anes;s  2xrir3oy1olenmictasfa2raxro;o1tlxomoctyt a2ra( sn(4alxnxfctydfmteaneol()seumxo io4opee ncs t)s2tr(  nu0oleo o3iydls rm(mp t0teerxf3oadomD aivi;t0 etoiopoo1lmee nesasfs2uaump;u1ale mociydlmDuan o;()tetnifcto1omDraues t0trtmio no1llte ncs s)s2rm(m ;u4tetn ictlsls emn snt4artoxr todoa eaneilt)s2ur(m oodlm nmicsltfs2tax oou4opeoiicildfmDrln s ()texomr3todfp eaieol()t2xm(r3iydlptemnvia() rum(r ot4tex  ictasfmDulumont4 rxoxf3iotfp eai il(0srxrxmpiu4ame mnvias)s2trx ono0olx  oetydfaDel(mo t0aeerxrctydfpt ln i;(0trxoxm3nu1ll emncsls)a2tm(rpnt4ale  i3tatlm eauvsnt0 rtrxfcoydfa  luvo;()s2uoir oo4lm   fvi (fsDuaxmono0aeen ieiatla ranvs t0 eenxr tydlaD  ueils seumxm iudapen fvils srtaxrp;t0tptnio3iyt m ranmo u4tltoxrctotop e ivs;(0trumxr3iy4ll n fcsa( sDtauro;t0tet iictls m eanmo t) renifciytfptr uvi;t) 2xrim io4amt mncsls)aDrmx  no0tlt mf3iyd m ua( pnu)aleoio3iadoa eaieo s texriopoo4ope lies ( a2umurp;u4tpto ieiysfm2rln p;u)arxoif3todfm  lnesl(  2xmio3nu1om emnvt tf Dtm(rpnu4oleomoctadfmDemn onu0 lenxfciadfatr ieil()sexrxo io4omt  ivilt)sDtmxmpot1ole micilslmDeln s;(0 lenxocia1faD luvi;() rur(o nu1lmtn neiltfa2ua(rpnu1aet  f3ild a eanmp;() lxoir ootfmtr nei;s)setr(o3nodal n icsat) Dta(rpoo0ape iociys s2ranmonu4tltniocootoa e u ils)srxm(m oodlm n fcsas  rtau oot0oex ii3tlsfs2eaums;t0 lxnxr ta1fat lues;t)srtoxopno4oltnlnet s srua( pot1oex mf3ild mDrlu sn(0teerifctydlaDrlu olt) 2trim no1lltelnes (fsDtr(rpnt1tpeomietasls ra(vonu) reomf ty1lpteln i;t0s2tmxo3oo4omtelfvsa(fsDua(m ou4alenmo3iad s2ulnmp ()teenmf3iytfptr iesl(0sexrxr no1alt  ies ( aDraur nt4aexnmfciyd mDuanvs;u4texnmrcoodlmDelivsl( trtrimpoo4lpeeliei (  Dtmumono0opxoif3tat s2ea( s;u) rxoif3to1fmDr nei s0 rxrir3oydopeemfcils)sDumx  ot1tlxoifetlslmDrmn p;t0 lenif3io1oa elnvolt)setmimpiu1amtelicilt srrr(  ;o1tpxo ociytfm ra(mp ()trxnioctotlateanvs;( srxoxm3ou4llt mfvs s)artax oou4tpt  fctat sDeln p;t0aeenxfctatfa eluei ()truoio nudol nlnet s  Drmumpou1oetnmi3iydls uaumo;(0 exoxrcootfp  anvi ()trumxr3oy1lp nlncil(  2tmxroou1oetomfcildfa emu s;()altnio iydfmte nvolt) rxr(rpno1omte ncsa()sDrm(  ;t0aexomoeiyd s umu s ()aleomf oa1la  au o;()trtrir3iudomte ietl() 2raum ot4aptnioetasfaDranvsn(0tlxnmrcoodomtrlueo;t)setmxr oo4lmtnmnvia() 2ta(m no1openiietasls raumon() rxoircty1om rlivo t t2ur(r nydapt mnet s  Drax  ;u1olxoif3ilt s2emumpnt0arenmf iodlpDelivs;s) 2xoxr3no4ame mfcilt  Draxro;o4aet mictatfsDua(vont4 rermo oadfaDrlivs t)t2uoxopiodlm nmnes s)sDum(moot0aexoii3ilsla el(vp u4tleomf tydfmDraivs;t sexmio3oodaptelfetl( srtaxro;t4tptoii3iydlsDrln pn(4aexnif3iadlp  li s t)srtoirpnydal nmnvs (fs2uaumono1tle  fciadfmDumu s u4tltrxrcto1fa  lieols0setoxrpnodam elivi ( srtrum ;t4apx mfcilt m umnvp;u0 rerifciy1laD luvslt0 rumiopoo1aptnlnci sfs2ra(mo;u1tpx mieils a rmn s;()tetnio ia1oaDraieils)s2xmxopou4llt mfvtl()arrru o;t1apt mieiaslaDumums;u0artnmo to1fpD luvs t  2xr(o no4llee fvi ()aDtrx oou4opx ioetytlaDemu p u0 leomociy1fa ean ols) exmxm iy1opeemietl() rumurooo1tetomfctlslm2ul(mp;(4arerxo3tatlmDrau o s  etmxm3nodolee ncs ()arrmu ont0olxnmo3tyslm el(vp t0aexnmfciotlpt ln s t0 rtrir3oy4om  lieiasfaDrmumpno0aetn octld aDeanvsnu0 lermr3ia1om   nes t  eumxrpoodaptnlivs sf rtm(  ;t0tltoifciatlsDel(vpn(4 rerifcoadfpDr nvilt0 rurxrpiu4lleelneils)arrax pnu1tpe ii3iad aDranvs (4 rxrmfciatop eln i;(0t2ur(opoydoptn nvsl()s2rrum nu1tltoii3iyt m rl(von(0 rerxfctydfp elu ol(0 eum(mpoydop   fviltf 2tm( pno1tpeo icilt s ulumo;t)alenio oy1lmDrauesl()teurim no1ameemnvi (f 2rmumpou4optn ietltfm rau pnu4 rxoif oy1oate uvil()s2tmxr3iu4apeemfvsasfs2tmum ;u1alx ifeiatls2el(mp;t0 ltrmo3io1oatrlneil( srur(o oy4lpeelietatfs2ua(r ;o0tpxomfeilt m rl(vp;u)areomf iydoa r ivi;s0trxo(o nu4amtelicslt  2rmu pnu0oleomictatlaDeau o () reriociadfaDe ies (  exoxr3oo4am emnvs sf Dtm(  ou1tptniieiltla emn s (0trenif3ootla eauei (0srurxopiy1ap nmieta()a2rmuro;o1tpxo fetytlm2raumo;t0 exrmfcootla  lu o t0 2toxr3iudape miesas)srtm(mp;o1alt  i3tadfs2ranmp;u) lxoif3iadfpD li ol(0setoim oodapeelictlt
\ No newline at end of file
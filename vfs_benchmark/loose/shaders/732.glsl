@@ -0,0 +1 @@
+uvs s0 2urim nudal   ncsl(farumxm ou1aetomoeiad s emu s;(4 rxnif oodomDeaieols0trxr(o3nydaleelnvtlt a2rr( p;t1tpe ii3tyslm2umn p;u0 rtomr iytopDr i o s sruoir3nu4amtn iciatfs2rax  ;u0ole  fciadls2ra( o;u) rtnmr3oadopD  nei t0t2xr(m nodlle lnvils  rrau p;o4apx  feiasfsDelump t4tleoxrcia1opDraivo ()srurimpiudamt lfet () Draumoot4tptn o3iyd a2rl( snt0trxrxo tadlaD aueo t0 2urirpio4omtn ivt tfs2ra(r ot0aetn oeias sDuanvsn() exoxr3iotlaDe i o;s0 ruo(mpiudlpe  ietasfsrtrumo;t1opeomicilsfm2um(mp t4texrif oy1fmt  ivi s0seum(r3iy4oleemiet ()srtaxrpno1altnmociltfs2rln o;(0tetnxo3tatlateliei;t0 2trxmpno4lp nmnvt t  rtrxroot1altn feiydla2rmnmo u)aexoircia1lmt aiesls)texrxmpiy1optelneta(  2uax  ;t1olt iiciadlm ranvonu0texrmf3to1lptelivs t0 rur(opou1om elfcias sDuau pot0apxomiciadfa rau s;(4 etoio3iadlp e ivs;(0t2tr(opoudlm   nesl(fs2rmxrpot4alxnmietydlsDrm(vo;(0altoxrciatlatrlnvslt tetmxopiu4olt lnvtas s2ra(mo;t4aptoioctat s2rmnms u)aexnir3tatoaD auei;(0s2xr(m3nydam n icilt sDrr( p;t0tlxnmieiltfa2elnmsnu0tlenxf3oa1faD  nvi;(0s2tr(o nydopenmfct t)sDtrxroot1aee mociad a ra(vonu0 rxrxrcia1latelneil( tetrxm iy4ol n iesat srur(mont0tpx moetltla2rlu pnu4arenxo3oodlp  an slt)seuoxmpiu4aptn ivia( srtau poo0aex moetatla eanvp t)trerirciodom e nvil()t2toxm3oudale lfesat aDtrurpoo1aex  o3iasfmDelnmp (0 eerif3iodfatr nvs;t) etrxo3nydoptelfet (farraumo;t1alx ifetyd m2ran o u4 rxnxocoadfmtr n olt srtrxrpoo4ol n icsa() Dtrum ot4apxomfeias a ul(vonu) eenmr ty1fpDe nvi;t)s2um(o3oydlpte neiatf Drrumpnu4tle mo3iys aDuaumpn() leomo ty1fmDeaieo;s0tetmxr3iydlpt  netltfsrtm(ro;t4tee mo3iatfa2uanmsnt) rtnmr ta1lm e i il(0srto(r nu1omtnliesl( sDur(r ou0opt ifctadlmDuaumpnt0 exrmfctodomDe ieo t0tetrxr3nodop e fes s)sDrmu ooo0alt mociydls eln s;t0 etomr tatfaDelu s;t texrxo3iy1ap   nct s)aDrrxm nt1tpx moctld mDulu ont) rxoxr3iatfa elueslt  euoim oo4alen nct tf 2rrxr no0oee iieiys a el(msnu)aleoxrctytlm rlivo;(0 rtr(opoydol elivi (fsDrr(r no1tpe  ietyt s2umums;t0tetoirctodlpDeanei (0 rtmxm3ny4omee ivtas  2rrurono0altnmo3iadfa2umnvo t4arxnxocoytfate ies (0 rxmxm3nu4ome  ncilt srtrxmono4texn feiat a uaums;t4areomrctytfmD  ieo;s0t2uoim3oodolt lictatfartr(m nu4apeoifciyt mDumnvs;u4tltoif3tadomDr nvi t0s2trim oo4om emfvi s)srtaump;o0oltomfetldfa2rlnms;u)aleoircty1fat  iei;t  2uoio ny1oltn ivt sfarraxmono4opto octydfa rmnms;()artnir oa1lpD auei s)setoim3oy4aptnmivsl( a2raum nt1opt ifciytlmDrluvp t)tetoxfcoo1fpD ai s s)texoirpio1lmtelnvt (fs2tr(mo;u1tex ifciasls2ra(ms t4tlenif3oydla  lieo t0texr(o ny4lptemfvsa(  2ur(mp;o1tet ifcils mDel(vs (4alxrxo3iodoptraueo;s trur(r3oy1am e fvs ( sruaxmpnu0opeomfeiydlm2uln p;u0alxnmrciotfaDr nvi;()setr(mpnu4ape liesltfarrmum no4apx mf3tad s2umuvo () rxrioctytla rau i;t)trxmxopoy4lp e ict s arrmxmoot4ope mfeiasls ra(ms u0tlerir3iydomte i s s0 etoxopnu1lptnlicils) Dtm( oot1tpxo ociatfm rl(mon()alxnmr3ia1lpt aieo;t) ruoxo no4ameemivslt)sDtr( o;u1alen ieiltls2uaums;(0tetrmo totla elieils)trto(r oy1al e feiat)arur(  no1oee  oetatls2ul(von(4treoir3iadfm rli i;s srtoim3iy4lptnlnciltf rtrum ;u0tle ifeilt m2ranmp;(0trenir to1lp rli o;()teumxrpno1optemfcs t sDumumono4ope mfciaslaDeauvp u) lxrxr oatfpDeln olt)t2trirpnodam  lnesa(f 2rrumpot4optnifeiltfmDeln onu0 exrmf todfaDe ues s) ruo(o3iu1oleelfesa( sDrmu pnt0ope ifciad s2rlu pnu)texnir ootfpD  i i;() rxo(m3iy4op   neiat)a2umump;u4tltn feildla rln p u0 rtrir iydomtelnvol(0truo(r3iodamtemivtls)a2umum ot4tpt mf3iad m2ean onu0 leoxf tatopDeauvi t0s2uo(m3oodameelfeilt)s2umumo;t4alxo feiydfm rlu s (0tlerif3ootlpDeaivslt texrirpiydlpte netlt  Duaurooo0tlxomi3iadfs2ea(mo u4aetrmf3iotfmDr iesl() rxoirpoo4ame mfvt ( arur(ront1opt ii3tyd m2emn p;u4texnmrctatoa e neo;t)t2ur(o3ou4lm emfesl()a2tru p;u0tle  o3ilsfmDem(vonu0teeriocoatoatelies;t  exrxmpiu4op elnesa(fa2rmur no4tlxo o3tasfmDra(vsnt0alenxr ty1op   ivo;t)truoxrpoo1al  licsat  rraxmpot4olen ieiat s ua(mo;u)aexnmocoytlmt  ieils) rxoxopnodlptnlict t s2umxr nt4tlt  oeildls emu onu0trxomo todomt  iesl()t2uoimpnudom nlfvt tfaruaxrp;t0oleoiieiysfsDrau p (4 eerxfciodoa  aivo;s0 eumirpiy1lmenlnei tf Drrxmpoo0tex ifcildlsDean sn()aeeomr3tadfm   uesl(0seuoir iudapen icils)arrr( p;t0altnmicilt mDrmu s;(0aexoxf3ia1lptranvs s0trxr(m3iudalt lneia()srtmu onu0tlxomietyd aDumu on(4tltomr tydfmt au s ()trtrxm3oy4om emiet ()a2umxrpoo4opxo iciytls umnms;(0trxnmo iytfmteln ols t2trio nudameemieil(faDuaxr ;t4tpxomoctydfm ra(vsnt4tetoiociadlaD lu s;t  exoir3ny1amenlnviat)aDtrxmoou1tltn f3iadfmDemu sn(4 exnxr3oatop elivo;s) rur(o nu4lmen ncil() 2tmx pnu4tet mf3tysfa uln snu)tlxrmfcoadfm  au ils0trtm(rpoy1aptnlfviatfarur(rono0oee iicils a elu onu0 ltomocoy1fpt an o s setrim3oy4lp n nvs s) Dumxroou4openmoctydfsDrlnmpnu)tleoir oytlptrlu i t sexoxr3iu1ope mnvsa(faDrmxm ;t1aee mf3iyt aDel( s t0trxrxocoy1om rli s s) 2tm(m3io4lm emivi (f rum(m ;o4tlxoioctyd mDrm(vsnu0 exoxocoadlaD ai s t) rxoiopio1lltnmnei ()srtru p;u0tpx if3tys m ra(mo () eerxocoadlatr ieols0 rtoir3oudomt lfeil(f 2uaxr no4tee  i3ils a2eauvp ()artnif oa1lpD lu i;s)sruo(m nydol   nvi tfs2rmu  nt0teeomociat sDeaump (0alerxfcoatlp e i o;()seumio3nodllee netl( sDtaurp;o1apx  f3tatlm uanms;(0trxoxr iytlate nvo;()trto(mpnu1lpt lnvsas)arum( ooo1tpenio3iysfa umnvs;u4aeeoxrctatoa eaivo s)setr(m ou4ol n fei (faruax onu0oetn ociltfm ua(mont)alxrxf3iodoate i s (  etmir3nydomtelfes t aDrm( o;o0opxn oeiatfm ea(vpnu0 lxrxo3iadlaDeanvs;( seuo(opno4ll e fcia(  rumuroou0alxniieiyd mDuanmsnt4 rxnmo iydopteaneol(  rtrxo nu1op nlivtlsfaDuaumo;o1olxnifctlslmDemuvp;u4 reoxrcoy1fpteaieols)trtrxm3no1om  mnesat  Dtmx pot0tet  ictls mDrln o (4 ltnxo3tydopt  ueols0setrir3iu1aptn fvs ( a2ur(  ot1ope iociadlm2rluvsnu)tlxnxfcta1laDr n o s)t2uo(m no4op nmicsasfsrta(m ou1aexoiietysfs2rlu s ()tlxnxr3oytfp eliei;t0 ruoio oy1lm elncsls) Drr(  oo0alxn oetys m ua(ms t) ltnifcoytfa r u o;t0srxmxmpny4lm emivtas)aDtm(mono1alxniiciasla eln on(0 lenxf oa1lat  ueo s0t2xmimpiu1lm   fei sfsDtau oou4openmo3ilsfm2emuvs t0texnmocoodoa eai i;t)srtrxo3oodlle  ivtatfsDtmx ont0tpxomfeiatlmDrmnmsn(0 ltrio tydoaD anesls t2toxr iydop nlivi ( s2urxront1tlxomf3tyslmDuan p t0teerxr3oadlmteln sls)srtrir3no1lp  micta( arrrumpno1oexnmfetldfa2uanmo;()aleoir iotlmtr i o t0t2xm(rpny1opt lfciatfs2rmu  no4tpenmfcilt mDumnms t)aleomo ootlpDe uvols)srtrimpiy1llte netlt)aDrr( p;u4tetnmoeiadlm emuvon()aeenmf oo1omDrli i;s)teumio3ny4lmtelfesat  Dtmu p;o1olen ieils s2ea(ms u4 eeoiocoytfpDranes t) 2xriopiy1lpen ictl() 2umumo;t0aexn ocildfm ea(vp u)treoiocoadlmDe ieols0 rtm(o oydom  lnetlsf rrmx  oo0alx mo3tldfs ranmp;u)trxrxo3oa1fptrau o;t teurimpny1alte icsls)srrrxmo;u4tlxniiciadfs uln p (4 exomfciy1faDrauvi;(0 exmir3no4lm  lfes ()aDrax pnu1oexoiicilslm rlnvo;u0tlxnif3io1oaD  neslt)s2xmiopnu4al elivsasfs2raxmpot4tpeo f3iytls ran p;t4 eenmr iatoa eln i ()sexr(mpiy1llenlncsas a2uru poo0opx moeiatlm2eluvo (0aeenmf iatopDeaneo;t setrxrpou4apte nei s) Drm(mpou0tlx iiciysfaDrmu o;t0texnio io1oaDelivi ( trur(r3iy1ole  fctl(  2ra(m ;o0olx iieilsfm2umnvs;()arerif oodlm eli o t s2xrim iy4lm elnei ( arrrxmo;t0tpeomieiydfm eaumo;u)trxoio3totla eai i;(0t2uo(m nudoptn nvilt  rum(m ;u1apto o3iad mDea( p;t)aeeomf3iotlm   ivolt) rxrir3oudll e ivsl(fsDtm(ro;u1tptn f3iyslm2rm(mo u0 etnxf3tadfatrauei s) rum(m3nodole mfei (fs2rm(roou0openmfeiysfa2umnvs;(4 etnmr todlaDeli slt  eto(r ny1lptnmicslsf rum(m ou4tpenio3iatlmDuln snu)trenir3totoaDe i o;( trxmxrpiy1op nlncsa(faDtmumoou0tlenif3tys a ran o t0 eerir3oatlmDr i olt0 2xoimpoo4alte nvil()a2um(  ;u1apxoiietatla2eanvp ()tlenio3iodfpDeln s s tetr(r nudopte neslsf 2umxr oo1tpx ifciyt sDrmn s t)aleoxrcoytfp rau olt)trumim ou4lmeemneiat) rur(mpoo0olx iieiadfsDumumsnt)tleoif3oatlmtrau sl(0s2trxopnu4amtnmivsas)srraumo;u4tle ii3ias m rm(mpnu4 reoio3iadlmt liei t0trtoio iy1amte feiatf Dtrxrpou0tpto o3iltfaDrau pnu)tltnxrctadlmte ies (0s2uoiopnydamtelfcia(f 2rmumpnu1oet moetldla umu snu) exrxo3oytlp  ai olt0 eur(opoy1om nmnvtas)s2taxrpnt0alx ii3tyslm rlu pn(4artoir3oo1fm rauvi t)s2um(m nodop nmnvilsfsrta(  ou4tlxnmieiydfa ra(vs;(4trtnir iotoaDrau sl()texo(rpiydllt mnvtlt)sDrmxmpoo1opxo iciasla2emnmo (0 rtrif3iodopt au i t  eur(mpiudapen nvi (f Dtaxmoou4alenmi3iltlsDul(msnu0tetoir tydfateanvo ( t2urxm3iu1olte fesat) rraumpnu1alxnmieiasfa rlump (4tlenmfcoo1lp r n ils)seurxopny4oltnlnvtat  Dtm( pou0openiociad a eln ont)altoio3ia1fp rli i ( sruoir iy1lpenlivt s srtr(m no1apt  i3iyd s rmumsnu0 rtrmf totoaDraieilt  exmir3no1al   fvilt)sDrmumpnt0oetnifeiytlsDumnmp u)texnxr3oodoptraueils texo(m3oudol   ncsasfsDua(r ;u0tetn octysls2umn p;u0 leomf ia1oa rluvo ()texoxo ou4ap elnetlsf 2ua(r oo4altniociltfsDrmu p;t4arenif3tadfm  lnvs;s) 2xrimpoy1ll emnvt tfarumxr ;o4oeen ociltfaDran snt4 rtniociatomDrluvo s) exmim3oy1omt mnctas)s2uru  ot1tpeo ocias m ua( s t4 ltrxfciytla  lnvo;s sruoxm3oudap elncils)a2trx o;u4tlt ioctatfm rauvp ()aetoioctydfpteaueols0 rtoxo ny4apeelivtlt sDtrx ont4texoiictyslm2emnvs;()aeeoiociydlpteauvs;()s2umirpiodape  nct s)srumxm nt1open octydlm2eln on(4aeeomf3iy1fm  lnes (0 rxm(o nu1ll nmieiltfsrra(rpno0tptnmfetysfs2rauvo u0aexnxr3ty1lpDelu o;( t2xoirpoy4lme mietlsf 2tm( ooo1oet  f3tlsls2rlump;t0aexrxrciodfaD lies;( teurimpnu1ap nmicta()aDraurono4oee mo3iat m2rln s;u0 rxrmf ia1fpD luvs;t0s2tmxr3oydopte fvslt  2rruro;o4ape ii3iysls rl( sn(0 ltomr oo1oaDrli s (0sexmir oydlltelivsl()aDrr( ooo0tlx ioeildlm2umnms u) lenmf tadlaDelivs;(  rto(o3oo1ameelivt s  rtrx  ;t4oet iieiys m2ea(vo;u)trerxo tytfm eli o;t0 euoxo iu1lpeelicsa(fsrtaxr ;t4opeoiicildlmDrluvp t4aexoxo iy1oaDraieols0teur(opoo4lpe  feiatf Dra(  ;t1alt  oeiatlm emnvp;t)tleomfctotfm r ivol(0sexr(m ou4ap  liviasfarrru  ;o0openio3iadla rmu o;u0 exnmo3oydomDelnvs;s) etrxo3nu1lptelicias sDtr(m ou4aeeomfeilt a2rmnmo;t4aexnxf oodopD au i ( setr(mpio4alee fvsl( sDrru ono0aeen iciys a2rlumonu)treomf3iytfmDean o;( s2uoxo oydomtn ieils)s2uaxr nu1ale  f3iatfm2elnms;()alenmfcootfp  luvsls srtrxm3oy4ale lfct s s2trumonu4aexoioeiatfa2uln o;u4aleomr todfm  aivs s  eumxr iu1oltnlncia(faDtmu o;u0olxn o3tyt a2umu pnu0trenmo3io1lat lnvi ()trtrxr ny4opt lnvs t arta(r ou4apxniicildla2elums;u0alxoio iydfp  aivs ()srumir iudlmt lnvtasf 2ta(rpoo1tpeo oeildlm rlu pnt)tleomo oytlaDe uei;s)trur(o3iu4ll nlictl(fs2ua( ooo4oee  fciytfm ea(monu4 rxnxr3oatlp eaues;t) rtr(opoudolee ici sf 2umxronu0aeen f3ils a ua( sn()teermr3iotomD aneo;t0sruo(r oy4olee feias srrmxr ;u4tptn ieias mDulnmo;u4tltrmrcoo1opDeaivo t)sexriopoy4ll nlncs t  2tmxroot0tex iietatfs uan o t0 exnxo ty1fptelu s t  2uoim3io4lmtnlfctl()srrrur nt0tex mfetyd a2rlu p;u4trenmf ta1fp rauvol()teumimpou4ap emfvsl( s2ra( o;t4tpxn fetydla2ra(vo () eeomr3oydlptr i slt) rum(rpoydalt mivia(farrr(rpnt4tet  oeilsfm eluvpn(0tlxrxr3io1late uvi s trumxm io4ap n nct (f rrru o;o1oeenmfciadlaDrauvs;u0teerio tatfmt aies;s trtrxr nudopenlictlt) Dtau  ;o1apx  i3tytlaDelu s t4aetrxf3iy1lm ean ils0seur(r oy4lmeelfctltfsDuru pou1aee  f3iaslm2umn s;u4 rxrmf todoa  ln s;()truoirpiy4lp   ncsl() 2tmurpot1apx  f3iysfm ul(mp;t4 lxoxo totlpD luvols  eur(m3ou1lm n ies t)srrrxm ou4apeomictltfaDua(ms;t0trtoio3io1lm  aueo ()t2urxo3iu4lmt mfviasfarrmumoot4olxomo3ias sDumuvp;()alerxocoadoaDrauei t srxo(rpiy4optnliviat)srtaurp;t1opxn f3tat a2ra(mon(4alxrio iotlaDeaueo;s  euoxopnu1lptelnvsl( srrru onu0apxn ietydlsDrmnmo;u) eenmo to1fpDelieol() rtmim no4om e fct () Drm(mp;u0opxn icils m rlnvp t)alxrircio1lptr ivi s)s2umxo3oudom n fcil(farrm( pou0olxo o3tysfs2rl( sn(4 ltomf3oy1fa eauesls0t2urio3oo4alte ies t srur(  ou4alt ii3tydls rl(ms;u0 exoxr3oydfmDrluei;() 2toxo iudopee ivils)aDrrx p;t4oexnmfeiytfa rmumo;(4aeeoxo3totlm elnvo ()trurxr3nudam  livta( sruaur no4tptn ociyt m2umn snu4 lermrciydfmt  i ols)seuoxo3io4lpe lfvi (fa2urxm ot1aexoio3tasla rauvp t)trermo iy1lptelneils0t2trxo nodape  fvsatf 2tax  ;u4aleo fciytfa eauvsn(4aexnio ta1laDeau i s) euoir nu4lp e ncias  2ra( pot0tptomo3iad sDum(vp;t) renxr iodomDrau il(0s2uriopiudomt lfci s  2ua( p;o0tlxomfeildfaDrmuvonu0teenxr todomtraneo t  euoio3nudop n nvt (f Dtau o;t0texoif3iatfa eln o ()tetoircootopt ai olt0tetmir oodlmtemivia()arrrumono4tlt mietydfm2eanvo u0 ltrio oa1fmteauei s) 2tr(m ny1am nlicils  2umx oot0texo iciysfs2umu p t0 rtoioctatfpD ai s;( trurxo3nydlptemiesa(  rtm(r ;t4teen o3tasls2eanmo u) ltomr iadfaD livolt0t2tmxm oudlp   nesltfaDumx oou4tpto ietaslsDuauvo;(4trxnmf iodlpt  nvolt0trtm(m nodope lnvt (fartrx  ;u4tee  feiad s elu s;u0aetnxo tadoptrai slt) 2toirpoy4lmtemnvt s s2tmur nt0teen o3tlsfm2ulu p t)aeenxfcto1fpD  n s ()s2toir io1oltnmiet (farrmu oot1aet mictld m ea(mont0 eenmr todlmtelivo ( srxoxm oy4optnmnvt s)sDra(  ot1tltn o3tytfm rl( pnt)areoif totfmD ai s;()t2xrim3nu1lm e nes () 2rruront4olxn fcilt m umnvs;u4altnif3iytom ranes;( s2um(r no4amen feilt) Dta( pnu4tlxo feiys mDuan o (0treoif3oatfpD lu s t srtmxr iu1lptnlnesl( srtmurp;o1tetn o3tas a ulums (4trtrifcoy1fa eln slt)srtrxrpno1oltelnvt t)arrmuront1oee ifetadfm uan o;(0altnmfcta1oa   ieo;( sexrir3nodapt lfvt s)arrrxmoou1tpt mociyt aDrmu on(0 exnifctadoatraues s t2tr(m3iudamtemfetat a2uaxmpnt1olx  oeiad s rauvsn(0aetnifcoo1fm  livo;(  rxrxmpoodal elnviatfsrrrumpnt0oetoif3tatfmDeluvs u)tetnio to1lp  luvi s0 rto(mpiy1lp   icsas arumurp;u0teenii3iasla2ul( pn(0 etnmr3iodlptrlivil(0 2xmxmpiodal nlfcsas) Drrxro;u0ope mocils a elnvo u0arxnmf oa1fm rlnei;t0seum(r3iy1ol elnvsl(fsDur(ront0opx ii3iltlmDrauvp;u) ltomo3tatfpDrli o t t2tm(o iy4am   fesl() 2rax p;u1tee moeiat aDumumpnt0 exoxr tatfaDeaivils sexrxo3oy4ap nlnvsa( s2umumooo4tlx  fciadfs ua( p t)teeomocta1oa ean olt) eumio3oydope  ivias srurumpoo0tpeomiciad m2rl(mpnu)tltrmr3oydlp  luvo s0truoxopiy4ll emicil()s2rru o;u0tlt ifciadlaDea( on()tlxrirciotomDrluvi;t)trtoxmpiydlp  mfvs s a2tax oot1apeo oeiytfs2eln snu0tetoxr3ia1fptraivol(0 2trxr oydlpe  nvilt)s2urx poo4tleomiciydls2ran snu0 leomf3totfa eau s;s0s2xrir io1lm emiesa()s2tmxmpoo0tpx mieildfa ea( p;(0areoiocoy1opteau i t0 euoim3iydole mnet (f Drr(m nu4tlxn fciysfa2eluvonu4 etoxociadfptelnvo t) etm(mpny1opt  ncil( s2umxronu0oltomfetldlm2ulnvp;u0altoxfciydlaDrlnvils)t2um(o iy4aptelfvias srrr( ono0apt io3iltfs2umuvo;u0 ltnifctatlatr nvil(0trumxo3io4aptnlnvia(  rumx pnt1apxomieiydfmDrmuvs u0aexoxf tatoa  ln s;(0 etoir3oo4omee netltfsDurum no4teeo fciad a rlu s u0tetoxo3io1oa r n ol( srurxr3oy1opeeliviatf 2ta(  ;t1alxnmf3ilt aDuau p (4 eeoif3io1opDeaiei t0 rumxrpiu4ol nlivsl(f 2rru p;t1tpe mfetad s uanvp (0artoirciodomtrlneol(0 2ur(mpiydape  iesas a2rrx p;u0ole  fetlsfaDulu s (0artrio3oa1fmtr ues t0 2urimpio4alt micta() Dtrumpnu4tlxn ictasfsDemumont0 lenmf3oy1lpDr u ils) 2tmxm3nu4am  mfcilsf rua(ro;t0apeoioctyt mDeanvo u) etrmf oadom elnvi s0 etm(o3oo4lpe  ieias  rtaxmo;t0tlenifctys m2uau s u0areriociydfp r ieol() rto(opno1llee fcsl( arrr(  ;t4optnmociydlsDemu sn()artnmo tytfmDe nvs s t2uoiopoo1opeemnei t  Drmxmpnt1aeeomo3tad s2rmnms;(0altomo3tadoaDe nvi;(0 2uriopiodopt  nvslt)aDtrx  ot4olt  o3iytla rmn p;(0tltoxr oadfp eln i;s0 rtoxr3iu1lpt lictat) rrmx  ;u4aexo feildfs2umu p;(4 reomfcto1optrai o;s0s2xmirpno4lmeeliesltfarurxm no0oetniieiad s2rl(monu)aetomf3todfmDr neo s) eum(opno1altemnesat aDuau ont0apeoiocildlm2eaump (4teeoif3tatfp elnvs ( seur(r iu4lmtelfvtls)sDrr(mooo1ale  ictydls eanmp t0trtomr tytop rlnvil()teuoxm io4alt lnetls)a2umxmoou1texo i3iasfa2rlu p t)aexnir3oydoaD  nvi s  2umim3iodoltn feiat s2um(mo;u0oet mictltls2ranmo u0tlxrif tatlaDeaueo s seto(r3nu4opte ivtlsfa2taxmp;o4olx iieilsfaDum(mp t0 lxnio ty1op r ivilt)s2umxo3iodal e neils)arum(m nu1aptoiocilsls2uluvsnt0teenxfcto1laDr ieils t2xrir nydole lietlt arraur oo4oet io3tyd s2rlnmont)texnxf ia1fpDr nes;( t2xr(rpny4aptelfcia( sDumu oou1oexomo3ilsfs uluvo t4trenxf to1fm  ai i;t)srxr(o nydoptn fesl()arrr(m ;u4aee mf3tlsfa2ranmpnt) etrxo3oydlmD  uei;t srtoxmpiodoptnlicsl( a2tmu ont4oexn fetatla2ea(vo u)trxnmf3ty1faDeaieol( setrirpiodlm elivsl(  2tm(ronu1oexoifciyd a2em(vo;(0artnif3io1fmD au i;s0 2tm(rpoudapenmfct (f 2uaumont0olxn fciyt a rmnvon(0 rtnio3tadomDrli o s  2xr(mpio1lme lnvtlt) 2rm(mp;o4aeen fciyt m2umu s () lxnifctodoaDraiesl(  2ur(r3iudlpt lfcils sDtax pno1apxomfciytlmDeanmsnt0 rtrmf todfp rluvi t tetmxr3ou4lpte feils) 2ra(mp;o4ole miciad mDra(vsn()tlxrir3to1lpte u ols) rtoim3iudoleemfci t  2rm(rpnt4opt mf3ilt aDeau pnu4aetrxocoa1lmD aneo t0 rxr(m iydame lfetlsfaDrr( p;o4tlxoiiciad a2rmuvsnt0 eenxf3iatlmt  ivi;(0t2uo(rpiydlpt mnvtas) Drr(mo;u1tee io3ilsfs raump u)teerxr3oydopDeaues ()seuoxr nydam  lics t arrr(r ;o4oltnmiciltfs ean onu4aexrifciotlpt auei;t0 2urio3nu4openmiei s srtaumpou1aet mo3tld a2uan pn(4arenmo3iatoatrli o;( trum(mpoo4llt lfeia(farrr(mont4opto oetysfmDrl( o t4altomf ia1faDrln ilt  rum(mpnudlleelneta( a2rr(roou1tetnmiciadlm2ean p u0aleomo iydfmDe uvi t0srxmir3oy4lmeemfvi (fsrraxrooo0oltomoetytfs raump;t)tlxnio iodlpDeauei;s) 2toirpnodol nmivs (f Dtmx pnu1openmietlt sDrlnms;t) lxrxr3iadlatranvi;t trxrio3ny4lmtemnetat) rtrxr nu0apxomocildlm rl( o;t4arxnxr io1omt  nes s0trxmxr3iu1lmt mfetl()s2ra(roou4olt mietas a rau o u0 exrmociatom  ln o t0 exo(opiu4altnlfeias s2uaxrpno1tptnmieiyslmDemnvs t4aetoxr oytfp   i sls)s2toxr iydamtn icia(f Duaxmpnu1aexo iciyd m2eanvonu4aeermo tydfa rlueolt tetoimpiu4ol nmnvt s s2urxr ;o0teto f3tlsfm2uan s () rxoxo todlate i i t  2tmim3iydlptemnvta( s2um(  oo0apx ifctas a2rmu pn() rtnmr oytlpD aueo;s srxm(m3oo1lpe miesas)artrx ooo0oltoio3iytla2uluvon(4 lxrio oa1fm  aieilt t2xmir3oy1opee nvias)aDtmur nt1tpeo ociadfs rluvp;() eermo3oatlmDr nvs;()t2tmxm iydap e icil(fsDraxrp;u1opxn ietadla umnmp;u0texnxrciy1faD lu ilt) 2xr(o no4amtelfet () 2tm(r no4open ietyd a2ua(mpn(0 etnxf oatfpte neo s srto(m io1amtemiviasfarum(ro;o4tex mi3iatfa2ra( onu4tetnmf3tydomtr i s s  euo(rpiu1lpt lfes t s2ta( ont1tpxoifeiasfmDumu onu4trerirciydopDrauvs;s) rumxm3oo4olt mnvtlt) rtrur nt4ope io3iltfa2uluvo (4areoifcoa1oaD  uei;(  etm(r no1op   ivt s  Dra(ro;t1optn i3iasfs2ean sn() eeriocootoaDr uvilt)srtmim3ny1apt  feiasfa2um(r ou1alen icias a2ea( snt0alxnxo3tytla eaiei;s)sexrxr io1om  lfvsat)aDuax pou4tpx ii3tadlaDem(von(4trenxo oy1omDelu i t0 rxoxo oy1apee ivsls sDta(r nu4aet iociadlm2um( snu4aetrir ia1fateaies;( s2toxm io4lpenmivi t sDraumonu1tex ioetad sDeanvonu)aetoxr iy1late neo s teurxr3ny4ole  nci sfa2rmxm ;o4oex mociysla2emnvp (0artnmf oodomtean ol(0trtoxo3nodlp n nesa(fsDtau  nt0tle mi3ilsfa rluvs u)texoxfcoa1oateli sl()tetr(o oo4lleelfci s)artax ono0oeenii3iad sDem(vpnt0tltnmfcoy1op ran s s)trtr(o iy1opeemnvsl(fartr(rp;u1olenmiciasfs umu p;t)altoxf3todlptelivs (  ruo(opoo1alte ivils sDraurpno4oetniietyslsDeaump;u4 rxrmo oydfmDran o;(0 2umio3nodap   ivtlt  rrmxrpnu0oetnmo3ild a2uan o (0 eenmo oo1faD ai i t  ruoxr3oodal nlieslt) Drmx pou4aex mfeiasfs rln s t)aexoir ta1lp  aivo;()srumir oudlle lnci ( srtr(m ;o1aexnmfeiad aDuluvs t) ltnmfcio1op  ln ols trtmxm3iudolenlfvsl(f rrr(rp;o1tptomoeils a2elumsnu4 eerxo3oo1fpte nvs;t0t2trio3oy1omee ivtat  2urum nt1aee mi3tyslsDel(mo u4 rxniociadfaDranei;s  rtmxr3ou4omtelncilt)sDtmurpoo0tlt mo3iad a el( o t4arenxr oo1fp  luvsls t2tm(m oy1lleelnesat  ruaumono0oetnmi3ilt m uan snu0 reoio3io1oa  auvi t) rxmxm3iu1al  lfcsls aDtru p;t1aetoif3tad m rmuvo (4teenxf iotfaD  u sl(0 2xr(o3oydamenmivt (f Dururp;t1tpxo i3ild sDrl(vs;t4alxoir io1optr uvi ()tetrxopny1lp elivias  rrrxr nu4tpenmieils aDuau s;u)artoxf tytoaDr ivi ( setrimpnudlm elfvtlt  Duaumoou4alenmoeilslsDrauvs;(0teeomf oodfpDr u s t teurio iydamtnlivta( sruaxm ou1alxoifctyt aDrau snt0 rerir oydlp raivslt t2toio io1lmeelfvt s)a2tru  ot1apxnii3tlt s ul(msn(0trxnmrcoydlm  lieol() ruoxr3iy4apt lnetl(fsDta(r ot4oltnifetadfmDuaump (4trxoxr iadopt an i s0seuo(opiu1olt livilsf 2trx  ;u4ape  ictytfaDrmu s (4artnxfciodlaDelneslt)s2trxo iydlmeelfet ( aDra(mo;o0tlt  i3iasfa2ea(vp;u4arerifctytlatran s;s0seumxm3iu4omeelfetl()sDuau o;u0aeeo ieiadfs2em(vo (4tlermf3to1lpDraneslt)setr(r ny1apee fci ()sDrru p;u1tlx mf3ilsla ua( o (4trtoxo iy1opD lu ol() exrim nydomt liesatf Dtr( ont4aex  oeilt a2eln s t4tltomf3ootlmtelnes;t)s2xoio ny1lle  nes tfaDraxrpot0texnif3iadla rmuvsn()tltnmo3iodom e u s s0trto(mpny4lme miei ( arua( ono1tptoifetyslaDrmnmp t0arxrxo3ta1optrlu s (0 ruoxo nudll  mfes tf 2uaxmp;o0olxn fciatfsDulu sn() lxrio3oytlpD ai s s  exoio3nydap   ivil(  rum(  nu4tpeo fetatfm umumo;u0tetoxrcio1fmD lnvilt0 rxmxo3iudlme mivi t) Duaurono0olxomf3iatls2ean s ()alxrioctadomtelues;(0 2umirpoy4lptnmfetl( a2raxrp;u4tltn fciysfm2uanvsn(4 etnxrciodfaD lueolt srxmim3nodol   ivtat s2tm(mo;u4apxn fctydlaDuau snt4tetomr3ta1opDeln o;()setoxm3ny1aleelfvsl(faDurum nt4apenmf3iat s2rmnvsnt0trenxr3oydomD lieo t texoim3iy4llee nvi sfa2rax ooo4alxnifetyd a2uau o;t4tltnmo3oo1fatelies s)s2toxr3oy1ope mietas)sDuax o;u0aex  o3iltfs2ul( s;u) eerxrciotla   ivils)t2to(o nu4lptelieils) Drm(mp;o0apxomoeiyt a2emumpnu4teeomf3oydoatelivo (0seum(mpoo1lp e fet sf 2tmx p;t1oeeoii3iyt m2uln s (4arxoxociy1faD  u ol(0setoim3oydol n ies t)a2ur(mo;t4optoioetatfm rlnvs u0arerif io1fa   nvs s) rxr(m3ny1alte ncil(fa2tmu  ;o4tlx miciadfm ean pn(0aetnxf todlpDe i o;t0 rxmxrpoo4omenlicils  2taxrpno0oeeoif3iytfm emnvs;u0trxrircoydlp elieil(0sruoxm3oo4om elivtas)aDraurooo1tpx  ietys s2rm(vpnu)aeenmfciy1lmDeai o ( trxo(m ny1omen nvsat)srrmurpoo0tpx mo3ilt m2ra( pn(0tltomf oydomD lnvilt) rto(mpno1op e net ( s2umxr ;t0alt  octas aDra(vo;(4aetnir iydlp rai ils0s2xmim3oo4ol  lncs (f rrru  ;u0altoiieiadls2em( pnu)trxnxr3oytfaDeln ol()sruoio io1om nlneta()sDtrumpou4ole ioeiltfmDrmu o;u) rxoircoatoaDeluvo t0 rtm(mpiu4apt lfvtatfa2rmump;u0alx mf3ilsls emuvp ()alxoxr oydfaDr uvi s0t2urxrpno1lp nliesls sDumumonu1texo o3iys a2rm(vp;(4 lxoxr iytfm rln i ()s2xoio oudlp e ivsa(f 2urx pou1tpx  fciys a emnvs (0tetrxf oadopDraivsls0s2xoir3iu4optelfvia(fsDumumpoo0optomo3iyd m rmuvsnt)tlerxf3oy1fa rau o;s0trxmxopiudolt livtltfaDtmump;u4tlxn icilt a ra( pnu4 leoxo iy1opDeln sls0t2umxm3oodomeemfvslsfsrurx  ;t0oleomfctyslaDemnmo (0trtoxrcia1fat ai i;(  exo(m oudaleelivta()a2tr( ont4alx  fciydfm2rl(msn(0 lermr ootlmt  nvi;t) rxmir3nu1apte ivi (f 2umxm ;u0aleo oeiytls uln s;u0altnir3tytopt  u ol(0setrxopou1ope mnvs t aDua(m oo4olt ioeiad a ulu o;(4tltrif io1fmt aues t0 2xr(mpiodam nmivtlsfaDurump;t4aeenmfetas a2rauvp t0tlxrmr oy1la raneo;s0 eumir ou1ale lfes s)sDtm(  ot0ape mi3iytfsDrl( s () rxoif3iydfm  anei ()srtoir iydlpeelfcta(fs2tm(moou0aptnmf3ilslsDel( pn(4 renxr oadfp   uvs;s) rtrxm3ny4opeeliei t  2tmur ;t1tlx mfciyslm ranvo;() reoxo oa1oaD  i olt)texoxr3nodlme  nvsa(f 2ra(mpno1openmf3tldfs uanvs (4trtoif oytom eau i s0 etmxm nodoptn neilt sDrrur ;o0aeenmo3iydfa2ul(mo;u0altnio3oydfp  an o;s t2urxr ny1lm nlfvsl( srrm( pot4aleo ieiadls2umu on(0tltoiociytoatr nes ()texmxr3nodamee ict s)srrmxmp;u4tlt mo3tlsls rl(mon()arxnir3iatla raivo t0tetoim3iydal emfesl(farum(ronu4apt mfctysla2rmnmp;() ltomfcootfmt lieo;(0t2toim3iy1ale miet ()artr(m ;t4tpe mi3iasfm2ulumo t4tetnio3oy1laD  nesls  eumiopiydom elncs (farta( p;o1oexo feiltlsDem(vpn()treomr ootoptrln olt trtoim3nydomee ivtas) Dtmxm no0olt ifctltfm2ul(ms;t4tetnmo3tatfm ranvs s0t2tr(mpoydlp e nvils) rta(  ;u0oeeo icilsfs2rl(mon() etnmr3oo1lp raivilt0truo(o no1op elfvils sDrrxr ou1aeenmi3iydls elu sn(0 lxomr ia1fp e uvs;s  2umxmpou4apt lietasfsrraxmo;t4oeeo ociasfm eauvpnu4tltnmrctytopt livols teumxr iudomt  nvil() 2umurpnu0olt mfetytla ulnvp t4 eeoifciotfm   n i s) rtoxrpny1al nliesls srtmx  nt4teen ocildla ul( o ()artomoctatfptr u s t0 rto(o3oo4lpeelfesasfa2raxmpno4teeo icild aDrau o u0trtoif3tytop eai ils t2to(m oodol n netat  rtaxr nt4aex ioetat m eauvon(0tlxnifcoodopDran s t  2xrio3ny1ol elfct t)aDtmu  ou4texoii3ild s2em( pnu)tlxnxf3oatomtelneo s) 2urxopoydoltnlncsas srtm( onu4openmf3tlt s rmums;(0 exomocio1lm  lnes (0 eurxr3nu1op nlfeta()a2urx p;o0opt iiciasfa ua(von(4arxnxfctadlpt  ues;(  2trxm ou4lm elivt tfsrur(r ot1oeenmf3iat a2el( pnu) etrioctydlpDrlieslt)t2uo(m oy4ap n nvtls aDtrxrpno0oetnioetlslm ua(vs;u0alenxr iotlp  liei;s0srto(r iydap  mici (fs2urxr ou0apeo fetadfs em( onu0trtoif3oytla eai i;( texr(r nydame  ivia(  Draxrpno1aexoiietls sDuln pnt)arxnmrcoo1opt ln s t0seuoxr nydoptnmnes s)aDtrxrp;u0optnio3tadfaDum( p (4 ltrxrcoydfmtrlues;t truoirpou4aptnliesasfaDuauroou4ope  ieilt aDul( pn(4areomr oatlpDrau i;t texm(r oodomtn fcsl(fs2tru ont1aet  o3ild m2elnvs t)tetrmf3tadfaDr nvo s0srumir iu1ll  mfct tfa2ta(m oo4tleomicias aDumuvp t0arermrctytlpt luvo t)tetoxopnodlme mfet t)sDua(r nt0tlen f3iysfmDelumpnt4 lxrif ia1lpDrli s;(  euoxopnydoltelivils) Drr(ro;t4teeo oeiadfaDea( p;u) rtrxf3oy1lp rlieils t2trxm oy4oltnlfct sf rraumpot1oet io3iydlm umn p t0aexrxo oodla e ivolt) 2xrir3oo4lme liesas)sDrm(rpou0aexoifeias aDel(ms;(4 exomf iydoaDeai o;()teuo(r no4ape  ivt s)sDuru pou1aee mo3iatfs2rmu on()aeeoxo ty1op eln o;s)s2um(m ny1om  mfet tf rtrxronu1aetn f3tls aDuln o;u4artrmo3tadfpt  ivslt)trxrxo3oy4oltelncsa( arraxm ou0aetoifcils s2emu s;t0 ltnif3to1lpte u i t0 rumio oy4apt  net ()sDtaum nu0openmfciytla2rm(vsn(4teerio tatfaD  i i;s srtoxr3iudlptnlnet s s2umumono0tlx moeiysfm2ul(mpn() ltrmocoydoaDr ieols)srxmxm oy4lltnmfcias sDrruronu4alt iocils a2eanmonu0 renifcoadfateanvo t0trurirpiydlm e fcil(  2rm( o;u1texo i3iatfm umnvs (0treoio iy1fmtrai ol( truriopoy1ome lfvtat)srtmxmo;t0tlto i3tls m2ulump u)alermo tytop  aivilt)trurxo io4olenmivs (fa2rr( pno0teeomoetldfa2ean onu) lenxf oa1fmtelu o s0trtmxopoodoleelnetls)a2tmx  nu4oleomf3tltla ulnmp u4arerxr tytfp eai i ( s2trirpou4ll elncta( sDra(m ;o4alxnmociatlm umuvsnt) rxomr3oatoa e n ol()setrir iy4altemfcs s aDtrurpot1oltniociyt mDum(ms (0tlxoio iydlmtelnei;t0t2uoxo iudap e ivia()sruaxmoot1olx ioetydfm2emu p;(4alermocto1fatrau s (0 2tmxmpoudamtn ici t)aDtaxrono1apx mociaslmDrmuvpnu4arxnmr3io1la  luei t  2urir3oy1lmtnmies ()aDtaurpno4tlenmo3iyt sDelnvs u0trtrmf3ty1lmteau o t0 rxrxo3no4lmt mictat)a2ra(mooo4tpeomi3iasla emu s ()altrmoctytop rlu sl(0t2toxrpnudaptnlivsl() Dtaump;o0aetomfcild aDran o;()texnmf3iytfaDeluvslt0s2trim iodlptn ict s arrmxmpno1opx iictysla2uaumpnu0tetoxr3tydfpD ai o;t0t2xoio iy4olen fciat) Duaumpnt1tpxo ieild mDum( on() eermf tadfateau sl(0sexmxo3ny1omtemfcsat sDur( poo1altomi3tysls2emuvs;u4aetnio3tydoa eau il( s2toirpiodolte ietlt s2tmx onu1apxn f3tlt a2uln o u4arxomo totlm rai o s0 rtoxr3iu4optemivi s srurur no4apxn o3ildlmDrlnvsn(0 ltrio3oadfaDrlnvi ()sexrir3iu1amt lneiat)a2raurp;o1opx mfciltfsDul(mp;u4tlxnmocio1lptr nvo;t s2tm(opno4om emfvt sfsrrau  ou0aexnmi3ildfa2eanms;() etnmrciy1faDranvs;t0srxr(m3no1optn icslsf Durxmpnt1apt iieiydlaDum(vo;(0aexnxrcoytoatelueols) exrxrpio4apt lfetlt  2ua(mp;u4tet  i3ilt a2elu o (4 renmf tadfpDrai i;t0 2urir3ou1lptnmneslsf Dumu p;t1oet  oetysls umuvo t4aeenxrctotoa elneo;t)seumio3nudlm e ies t s2rrx pno1tpenmictatls2umnvp;(4arerxf oa1lpD aivil()sruoir oo4ope  netl( a2ta(r no0apeo o3tldlm em( pnu)tlenxf oydlmDelieo;()trumir3no1alt mneias)sDtmumono1aeto f3tlsls um(vo () rxoio3iatoa eanvi;(0t2xrimpiydal   fvias) 2umxrpnt0opxniiciltls2emuvsnt4arxoircoy1fa e ieolt0trxr(r3iodoptnliesl()aDtax  ot1oltnioeiytlm ulu p t)tleoxfciadfmDeluvols) etoirpnu4lmtnmivsatfarua(m ;t1aee mociysls eaums t0 leoir oodla e u s s0 etmir oy1amtemivia(f Dtm(r ;u1tlt mf3ild sDum(vpn(0tlxomo3totfm e ies;( s2uo(m iy4apenmncs (fs2rr(mo;t0alxniocildls elu p t0 lermf3oatomtr uei;() 2tm(mpio1omenlies s)srurxroot0altomo3tatlmDumu pnt0tlxomrctodfmt  nes t0truoir oodome licsa( sDra(r ;u4tex  i3iydla ranmp u) lxoxo3ootopteau o s  2toxo3iudlptn iei (  Drmx  ;t4tltnmieilsfs2rau snt0 leomo3tadlpDe nvo;s0trxoio iy4lmt  fci (fa2tm( o;t0aptnmoctys s elnvsnu4 lerif3iytlmDrlnvolt) rurio3ou4lp emnct tfsDumxrp;u1tlxo oeiltla2umuvo;t0 eerif3oo1oa rln ol( t2urim io4op   netlt s2trurpoo4alenii3iasfm2uanvo;u)altnmfcoodfmD  nesls t2xr(rpnu4olenmnctlt)srrrx ono0opxo f3tltfm rm(ms;t)altnif3tydla eau i;(0 exmxm no1aleemfei s srtmu poo4apt  o3tys aDeanmp u0teerxf todlp  aivsls0srurim oydom nlfvilsf Drrxrp;t4tetomo3tltls rmn pnt0 lenir to1opDraues;t0 exmio3ou4lp  mnvtl() 2uax p;t4ape  ictytls2rau p t0trenif tydlptrai s ( sexoxopoodamtemiei s) Dtmxm nu1oexoifeildfa rmumon(4artrmocoa1fm elueil(0seumim iu4lp emfvtasfsDumxr nt0alx  o3tlsfm2rln on(0tlermf3iadlmtean o t) rurxopno4apee neta( srumx  nt1olxn o3iadfsDulu s ()trermo3tatlateauvi;s  2umio3iudomt  nvi t) Drm(monu4tpenmictltls rlnvo u) lerxo ia1oa r u i t) eto(o3nodale  feslsfs2umu onu0aexnioetldfa rmuvsn()aeenif3iadoaD luvi s sexrxo no1lleelnvtlsf Drm(rpnu0oexn o3tytlm2emnvp u) exomr oodla eaueo () 2umxm iodlpt mivi s artrx ono1oet  fetltfaDrluvs;t4aetrxo3iodla rlnvils0s2umir3no1amt  fesl(faDtruronu1aleomoeiytla2ulnvo;u4 leoxf ia1oaDrauei s)trxoxm3ny4ll   ncslsfartrxmo;t4aex  feiltla2ulump u)areoxf to1laDe uei;t trxmirpoodome lfcils  rrrx ont4aet mietldls emn p;u0artrir3to1fpt au i () rumim ou1lmtnmfetlt)sDrau pnu4tet ii3iytls ul(vs u)altnxrcoatfa raneolt teuo(m3nudomenmicsltfsDurxmp;t0oex ifeias s rl( o () exrif3oydlp ean ols trxrim3ny1omeemneilsfsDraxr ou4tptoifctadlsDeauvo;t)aeeoxr oytoptelu o ()sruoxr3oy1lm  mfvsl(fa2taxm nu4altoio3iasla rl(ms;t4 rermociy1lptrau s;() 2uoirpiudll emfctl(  2rr(  no4teeo o3ildls2emn p t4 rtoxo3ta1oaDeanei s0trtm(mpny4amtemnei t)s2rm(m ;o1oeenmoeildfmDeanmp (4tltomf oa1lpteaues t sexoxr3nydamtemicta(f Drau pno0apt micild m eau s;t)aexomocootfp rlnvols s2uoxr oudal  lnvta( s2rm(rp;o1opxoioetytlmDemu pnu0tltrirciotfa eau ilt s2toiopou4altelnciat)artmumpou1opt if3ils m ul( snu0 lerif iy1lm   iei;t s2uoxo3iodam emneta() 2trxmpnu4oltn oetld s2ua(vonu0trerir3iadlpD  uvo s  rxmimpiu1oleelnetlt aDumurpou0aexo octyt sDelnmp;u) leoifctytfa rlivi;(0trurxm iudaptelics ()arrrum oo4tlx  i3tat a em(vs;(0 ltoxo3totoaDe iei s texrxopiy1oltemnet s  rtm(r ;o0aeeoif3ildla uauvp u0 exnxr ia1laDrlueils)t2xo(o oodopenmici s srrrump;u1oetomfetaslsDem( sn(0artnxo iadfm  aivs t)texoxr io1ll  lfvt t)srtru ono0tex mieiysfs eln o u)aeerxr oo1fp rlu s;(0srxmxo3io1lp e fvs sf Dur( pot1openmi3iad a2ran s;t)aetnirciadomt lneslt  rtrimpoy1om n fet s  Dur(m oo0ale mo3tltfa ulnvs;t0teermr3oo1lpD  n i;t)s2tmxr oo1ol e nviat  Dta(moot1apen ociltlmDeaums;()texrmo oatla e ieo (0srurxo3nodlpt mfcs (farrrxmoou0tpt miciltlmDrluvp;t0trxnxo oa1lm   u s;(0s2xr(r3nudop e nctasf 2tmu oou4olt io3tadlm2rau o t0aexoiociytfmte i s s0t2xoim3ny1ol   nesl(fa2rau o;t4oeeo o3tasfa eanvo;u0 leomfctodfate n s;t trxm(mpio1am n nvi s  rtrxr ;t4apeomo3tltfa2eau s;()aeeoir iydfpteaivo;()trxmxo3iy4opt  nesat a2ra(ro;t0alxn icilsls umu snt4 rtnxfcoa1faDe ueo;t)srxrxr oo1opeelivs t)srraum oo4apenio3iat a rmu pn(0 lxrmfcia1fmt  ivolt srxmimpnudlp elictasf ruaumoou1tpx  fetyt sDua( s;t) eeoiocoo1fmtelivilt0t2umxo3oudll emfeta()a2tau pno0aee io3tad m2elumsn(4 lxoxr iy1lm  lnvsl() 2xm(m3oo1op n iciasfsrrmx o;o0oee  f3ild aDulnmont)aeeriocio1fa eluei;t)t2uo(m3ny4lpe lfcsls)aDraxr nu0tltnio3iatlm ea(mp u)teenxr iytopt an slt srxoimpou1apee iet s aDua(  ;o1aetomo3ilt a2em( on(4alxnxf tadfp e u i () etrio ou1llt lnct tfartr( p;t0teeomi3ild a2ranvs;(4 exnxf3ia1fpte ivo;t seurxo3nu1lmtemivsas)s2rm(rp;o0tptnmieildla2rauvo u0trtnirciatfat  nes t) rxo(m3iu1apenlfeil( sDrax pno0aexn iciat s ran s;t0 exomocoytlmtrlieilt  ruoxopnu1lp  lietl(  Drmxrooo1alt  feiaslm2em(vsn(0aleoif iatoatrlies;s) rurir3iu1om n ies (  Dur(  ;t0ale mi3iadlmDuanvp (0 eerxrcoodoaDelueils trurxmpny1lmenmfvi ( srrr(ro;u1ole mieiat m2ea( s;(0trxrxo oa1oat aueolt0 rum(r3oo4lltnlicsltfa2urum nu0olt iociaslsDrm( s;t) lenxr3oo1fm  ai s s seto(m3iudal  lict () 2umx  oo1oetomo3tas aDul(vsn() exnxrcoadoa  luvo (0 etmxo nodol e ies t) rur(mo;t0ope  feiytla ea(vp u0aeenxo iodlmDeauvo (0trxmir oodlmte ivs s aDrmuront0aex ioctyd m2rm( snt)tltrxrctydomD ai ol(0 2toxrpnu4open iei tfsDua(r ;t1ape  ieiys m2ranvs;t0trenir ta1fatrai i;s t2uoxm iy1amt micta()arraxrpou0oeen i3iytfs uln ont0trenif3ootfm elies (0 2trir3nu4omte nesas)sDrmum ;u0tex iietaslm2ra( ont0 lerxf tytop rlivi;t  rtoxrpny1lmtemnctls)a2trxmpnt1olt  f3iyt a2em(vp (0aexomociatlp   u ilt0setmimpnydomtnmict ( sDtr(mpno1aeto oeildfm ea(mo (4 reoifcoo1laD aivs;t) etmio oudol e fvtlt)artmu pno4oleo feiys sDum( p;u0trermf3tadla  lnvi ( s2uoxm3oudalenlics s) rrau onu1teen oeias m ra(vsnt)aexrmo oydfmDr n s;s) exm(o3ny1am nlfeia(fs2rm( oou1opeo ieiatlaDem(vs t4artoxfcoa1fat ln s;t  rurir3oy1alee ivtlt arra(rp;u4oee ifeildfa ea(ms ()areoxo oo1fmD lieo;t0trxr(o3oodolen nvsl(fa2trxm no1opeomoeiaslm2eau onu)tltoxf iy1omtrluei t)t2toimpio1altnlnvi tfaDumxm nt1teto oeiadls2rmnvon()aeerir tydfmDrluvo t0 exoio3oo1om  lfvslt  2tm(r nt0oexnif3ildfsDem(vs;t4 exomf iotlptelivo s  2xrir ny1amt mict s s2um(  ;t4tpx  oeiysfa emnmo (0areoiocoa1lpD  u o;t) rtrimpiy1alen netls)a2taxmono4aeeoioeiadfa uanmp;t)altoif3ootlmDr nvs t) 2um(r no1ame mfetasfa2urxrpnu1alenii3ilslaDeluvs;t4artnmf3tytom   nvi t0 2xmir no4ll n nci s aDrrxrono1aet  fctldlsDemu o;t4 rxomocootlpD aivils0t2uo(m iudop   ivs (fsDraxmpot1oltoifetlsfm emnvo;() ltoio3iadlmD luvi;s0t2xrxo3oo4om nmiesa()aDtr(m ou0apeo i3ildlm2uln p;(0trxrmo oa1la  lnei t0 exm(r nudale  ivi s) Drm(mpou0tle io3iysfs ea(vpnt4 rxrio oatlm  ai sls) eum(m3io4ome  icilt srra(m ;t4openiociat sDua(mo (4trxrxf3ootlateaueo;s  ruoxrpio1lp  lnci t) Dumumpnu1tlxo o3taslm2umump;u4 rtrircio1fptr neilt) 2to(o oy1lle lfcs (f rrau pot1opeo ieiad s2el( p t4trxoircto1fate iei s)t2xm(m iydllen nct t)s2ur(r nt0apenioetls m2rlu s;u) renio3ty1lp raueol(  2umiopoudal emfci ( s2raumpot4oex mocilsfm2ulu snu4trxnio ty1lpDr u i;t)trtmxo ny4ap  lfei (farua(moot4tlto octadlm rl( s;t0arxnmr to1fmD  nvi (  2xo(m3iu1amtelfcsas  Dumxmo;u1tleo oeiytfs2rl(ms t4tlxoxo iatfaD auei t)seur(opnu1ome lnesatfs2tmxmo;t4aex iictls m2emuvo;u)aetrmf oatomtrlnvolt srtoxr nudll emncsa()sDrau oot4alxo iciytlm2ulums;u0trtrxociytop  lnvi;s) rtrxm3iydome mneia(fsDtrx o;t4aee ii3iyd m2rluvp ()arxomocoodfa   iesls)teuoxo3iodolee neta()a2uaxr oo4olenmi3ils a eanmsnt)teeomrcoodla r u i;t0 ruoxm3iudll  mfvt s) 2umurono0tetomoeilsfa2rlu p;u0texnmr3todlaD an ilt0 rto(mpnu4llt  feia()aruaxrp;u4tee micias a2rl( sn()tetrifcoa1omDeln o;t0srxoimpnu4opt mieils aDuau o;u0aeeo fctysls eln pnu) rxoxo3ty1lat aivo;()t2trxr nudop  mfesl() rtauroot1opt  fcilsfm2ea( pn(4aexoircoytfmtranesl( t2umxo ny1ope  ics () rur(m ot4olx if3iasla2rl(mpnt4arerif3tadomteauei;(0teuoxo nu4lpenmiei s) 2um(r ;u4aet ii3iatfmDelnmp;(4aetoxf3oatfatr ivi ( trtoxm nydlp   fcsas)srtax onu4olx ii3iasfm2uaumo (0tlenxf tydlat luvo ( tetmiopny4ol nmfvi (  rumu p;u1oetomfeils a2ranvs;(0trtrmf ia1fa  lueo s  etoim3no1oltemiviasf 2tm(mont4tltoifctytfa rmnmo;(4alxnio3ootlpteanvo;() 2xo(r ou4ll nlneias)arum(  no4open ieiltlm raump u0 rxnir3ty1oa   uvi t0 2xm(opnydapenmnvi () 2rmxm nt4optomfeiytfmDra(mo (0artomfciy1fmte i o;( seumir3oy1ape  ict ()aDurxm no1tpeomfeiysfsDrmn s t0 ltrif3iytla  aivils trto(mpou1op   fviat  2ta(rpno1alt mieias mDrauvont0artrxrcto1omte uvs;s) 2xr(rpiy4lmeemivils arrm(ronu1tpeoioetytls2ra(mpnu4texnxrcty1lp  aivs;( t2xmxm3iydapeemivsat)a2uaxmpou0olxomf3iltfaDean s (4aexnxf3iatoaDrauesl(0t2xmxm oo4ome mncsl()a2tr(rpoo0aptnmo3tas mDrmn s;() rtnif3oa1laDean ols0trxoxopoodalte fci s) rumurooo0alx  feiatfaDrln s ()aetnmo to1opDe n s;t)t2urxo3iudlpt lncta()arur( p;o1tpxnmfctyslaDra( s;(0tetomf3io1oaDelnvo;t trxrxo iodaltnlfcs tfsrta( pno0opt  fctysfs2elu o;(4aeeoxf iatopDelivslt)srxoiopnydalt  net sfarumurpnt4olxnmo3iys s ea( o;t4tlermf3ia1faDr n i;t0t2uoim iudom n iei t)artmx  ;t1tpx moeiyd s ua( o t4tltoifciadomDrluvslt0teuoio3no1am e nctl(  rtmx p;o0apenii3tltlmDum(vo;(0treoxr3oo1fat  nei (0 eumir3nu4omt  netlt)srua(r nt1tee miciltlmDelnvs u) eenxr iadfa rln o;(  2uoirpio1lp e nvs tfa2rmxmp;u0oet  fciltfa2ea( onu4tltoio3iatoaD aueo;(0trtrir3no1lm  lfci s)srtrxrp;t0tetnif3tydfm2elnmo (4tltnmf oodlmDeli s s0s2urxm3ny4lpenmfci sfs2trx pnu0oexniiciysfs2rlu o;t0tlermr3oa1omte iesls0seurim3no1lpte fvilsf rurumoot4olto o3tydfs emnms;t4 eeoio iodlptrauvo;t srto(m nydap nlnvi t  2trxrono4tetoio3iat a2ulnmo u0alxrxr3ootlmD ln il()trxrxrpoodlm emivi ()sruaumpnu4oleo octyt m rlnmp;()aeermfcoytlaD au i s)trxmio3oo4lm nmfvsatfartr(m ;u1altn ociysfs2ea(mo;()texrmfctotfm e ivi;s)tetm(r3oo4llenlnvia( srrr(  ;t4altnmiciytlmDrauvo;u0 ltrxo iatopD  nvi (  eumxm oo1oltnmiciatfs2ua(r oo1oex  ieildls2rluvs;() eeomr todlp  anes;t) euo(rpno4omt mfeilt) Dra( oou0alx mf3ilsla2ean onu0 rxoxo ia1fatrli i;s0truoim iy1olenlieils sDrr(monu1aee  f3tltlsDemnvsnt0artnxocia1omDrai o;( trxo(rpiy4lp elncsasfs2rru oou1oetoiociasfa2ulumo;(0alxomf3ia1lptelu i;s srxoxo nu4ole  fvs (fs2ra( oot1tltoio3iasls ul(mp t4tetrmo3ia1fat anesls0trtrxr io4omtemnvil(farrrum ;o1texn oeiys a2ua(vo t4trxnmrciydfpDe ieils) 2umxopny4openmneia(f 2ururont0apto o3iytfs2ran p;(0 exomr3oatfaDelueo;s setmxmpoo1lmeelnvtat arururooo4tlt mfciysfsDrmnvpnt0 ltrxo io1fate u i;s)s2toir3iy4llt mics sfsrrr(  ;o0tlt  feiasfs2em(ms t0alerxr io1oa e ivo s)sexo(rpnydllenlneil( srrru p;u4aex  oeiltlaDumn snt4teeriociydlpt lu i t)trum(r io4lme  fvtat s2umurp;o4tleoifeilsfm ul(vpnt0aeenir3tytfp rauvsls) rum(mpiodopt lneils  Drau  ot1tlto ieiyslsDuluvo;u0trxnir tydla eluvi t texoxr oo4lpenlfvsl(  rurxr no0tlx  fetltfaDrlnmon(4 rtnir tadlpt auvi ( texm(opoy4lleemnvs t  Dtrx pnu4olx iociltla2rm(vp u) leomf oytlmteaneo;s) 2tr(r3iy1op e fei t)aDrm( pnu0texoioetad mDrmnmsnt4aeerxo to1opD  i olt)srumio io1ll  mneta() 2rr(rpnu0aet  fciad s2ul( sn(4trxnmr ta1la  auvolt0trtmirpoy4alen neia()srtaxroou0teeomo3ils a em( p;(4texnmo3io1la rau slt s2uoxrpny1amtemivtas s2rr( ooo1tlx  ociyd a ranmont0artrif3iotlp ranvs s0trtrio3io1ol  mfctlt  ruauront1oetn oeilsfs emuvs;u4alenmf3iatlatr i olt0t2xoiopio1altemfesas aDtm(rono4oexn ieiat sDua(vs;(0 eenxr3ta1fpDeanvsl(0sexr(rpiu1lmt liciasfa2taxmpnt1teeo fetysfaDrauvsn()aetrxf oa1oaDeaiei;s s2um(opnudolt mfvs tf rrmxmo;u1tpx  ieiatlsDel( ont0 rxrxr ty1omt li i s0sexoxrpnu1al n fcsatfsrrm(monu0olenmoctlt sDumuvpn()aexnxocio1fa eli i t0t2xoimpiodlleelics t a2rr( ono1olxomfctas m2ua(vp t4artoxrctadfp eanvo s0seur(m3oy1altnlncsa(  2uaxm ;u1optniicilsfaDrlnmo t4texrmo3oydomD  ieilt tetoim nu1ll nlnvt t s2tm(  nu1apt  f3tlsfaDuau p u0alermf3ia1oaD  u o;t sexo(m nu1lm emfctat artr(mp;u1oeenmfcilsfm ranms t4texrxf3oatlpDr n ils  etrxr nu4apt mnvilsf Duaxr ;u4ape iiciasfm2rl(mpn() eenif iy1optr n o (0trxm(rpnu4amt lies t) 2ta( p;u1olxomi3iaslaDum(mp (0arxrmr io1fpDr nes;t) rurxopnudaptnmfetlsfsDtaxm ou1tlenmfetlslmDrmn s;(0trxrmr3ta1opDe n i (0 2umio iydope lfviat  2umurpnt0aptnmo3iydfa emuvo;(4aexoxr oydom   nes t0s2ur(o iudal nmfvs sfsDtax o;o0aeeo ieiys sDrmn pnt)areoir ta1laDranei;s)seumxm3oo1op e fvi s)s2ururo;o1alxo i3ilsfa2ea(vo (4 etrif3iytoa  liesls0 2um(m nodom   ict (fartrxrono0alx  fctyd m2ranvs t)tlxnxo3tydlmt lu slt0 etm(o nu1ope liesls) Drrum nu4apto feilslsDean s;t) rermr ty1oaDranei t)setm(r nudaltn fvils  Drmxr nt1aeenif3iyt s rmnvon()altomf3oodfaDrlneol( srxoxr3oydap   ivtl()s2tax ont4tle  ietlsfs2ra(vo;t0tltoxocoa1lmDranvsl(0trxoxo nydal  mfctat)aDrmum nt0oetnioeiydfaDelnmsn(4 eenir oa1fpte uvo;t0 etoiopno4opt lfctlt)arta(mo;o4oee iociaslaDra( snt)tlxomoctytfp e ivo;()t2xrim oo4amee fct t)arrr(rpno1oetoioctad s2emnms;u) lxniocio1laDeauvols0 rxmirpoo4lltnlfct ( artrx  ;u0optoio3tas m2elnmsn(4trxnmr3iodoat lieo t0 ruoiopnu1op  lneils)arra(r ot1oexomfeiatfs2umnvp u0aeerifcoadlpte n s;t) eur(mpiy4omen ivt sfaDrmx poo4altomi3tat m2uau onu)altomr iadfmtelnvo ( tetmxm ou1al elfvsa(fsDurxroot1aet ioeiat aDel( p;u0alxniocty1fat  u i;s0texrxr3oudoptn fesls) rrm(mooo4tle  octldlm2el(mpnt)tltnif3oa1fa raieo;() rurim nydal emnvtas) Dtaxmp;u1teenio3tyt s ul(vo;(4teermo3tytlp rlueil(0t2ur(r nydop n fctlt  rrm(m ;t1aexo fctys a uaumon()arxrio iotfa rai s s)t2xoirpiodol e ietatfaDuaur nt1aptn ieiytfa2uau o (0tltnmfciadlmte u i s0 2xmxm io1apenlnctatfsrtr(rpou4tpeomieiltlm2emums () rtnmfciy1lp rlnvil()s2xoxr3iy1al emivtl() 2ur(r nu1opxniicild s ean s;t4altnifciytlat  iei;t)s2tmimpno1amenmnciltfs2tru  ;o1opxomictyslaDrlu o t4 renmoctotlat auvils s2xrirpiodopenlnetlt  Dta(m ;u1tlxnmfetld a2el(vp t)artrircoy1lmtraivi (0srtr(opnudaptelfvil(fs2uaumo;u4tlx mf3tlt sDumnvpnu)alxnxfcta1la eai s (0 2trxo io1ll nlici t) rumu poo1oet mi3iydfa2emuvp ()artnxr3todlpD au o;t truoio3no1oltnlnetl(  rua(r ou0opt ioeilsfa2ul(vont4 reomr oa1omt aivs;s0trxoxrpiu1al nmieil() 2ur(roou1tptnioctytfsDum(ms;t0trenioctytoate uvs t0 2tr(r3ny1openmiviat sDuaurpnu4alt  o3iasls ra( snt4alxomo3ia1fpte nes;s  2xmxm ou1op nmncs s)arumx  ot4aeenifciasfs um(mo;()tlenmr3oadfp rauvi;t s2tmxo ny4olte nctl(faruaxrooo1tpeomfciatlm2ua( ont4texnxrciatlpt anvilt0trxoxm nudomtnlfcs (f Drmxrono1opx mieildfs rluvp;u4aexnmf3todlp rli o;t) 2xm(o3io1am  mfes (fa2uax poo1alx  o3iaslaDeaumonu0altrmf3tytfpD li o t0 2uo(o iy4ole  fei s)artaxr nt0tetnmoeildfmDrl(vs u)tlxoifciatlpD aues;(0s2urxm3oodlmtn iet tf 2rm(rpnt1tpto fetls aDumn s t4 ltrmf3iy1lpD  nvols) euriopiudll e fcsatfaDuau  ot4oetnifeilsla2ulump;t0trxnxfcoodoa rlivils srurxo nodlptemncsl(farraxmonu1alenmfeiaslsDra( o;t4arermr tadlpDeaues ( trxo(mpiudll  lnvtatfs2ta(r oo0openmieiasfaDrmn pn(4 rxomf io1lmDe ueils0t2xriopoy1ap nmivslt aDtax  ;u0aet  fciyd sDuan pnt0artnif ootop e ivs s tetrim iy1llt lnvtat srum( ont4aexoio3iat s rl(msnt0alenircta1omtrluvilt  rxrir ny4ape mivt t srtrurpnt4opxnmoeiydlsDuaums;() etomr ta1opDrliesl(0 rxoir3oy1al  mietas) Drr(rpnt4olt ii3ias sDuanvo (0aetnxf ia1fm elnes ( s2ur(opno4lpt mfeias)aDur( pot1oetomo3ildls2em(vo (4trxrmo3tydom   uei;() 2to(m oo1omenmneil(fs2rmx pot4apxomociysfa rm( p (4 lenmr oodfm e nei;s s2tmxopoydol  mictl(  ruau  nt1oleo iciyt mDulums;() lerircoadomDe n o;()s2urio iydame lfciat s2ta(mp;t4tpt  fetyd aDeanvp ()tlxoxr todomDr ues () rurxm3ou4ll   nes tfs2tm(  oo0optn f3tytlm2rlnmo;(4trerxo todlmDeaues s0t2xm(m oy4olt mivtatf Duaxmont0oetn i3iytlaDeluvo (4trtoxo3io1lptraueslt)teuoir3ny4llt mncsa(fsDtaum nt4alenmieildfa umuvpnt0alenio iodfa elues;( t2umxmpiy4lle  fcia(f 2rmxro;u0apeoif3taslm2rln pnt4aleoxr iytopD an i;s t2xoxmpiu1lptnlies t)a2rau o;o0opxniieiytlm2uauvp u4tltomociotomD lueilt  rxr(rpou1lltn icsa()arurur no4optnmf3iytla2umuvs t)trtnio3tydlpDeluvs s0s2tmxr3nydlm  mieslt)aDumumoot4olen ietlsls ua( onu4 ltomr tadfpteaneil(  2xrxr oy4alenlfei sfsrumxrpoo0texnmieiadla2elu o;t)tltomociotfptelu o;s0s2xo(o oy4aleemnci (  rtrxm no4opeomicias a2umumsnt)altoxrctotoa  aneilt0teum(r oo1amenlfeils sDtmxr ;t0oetoiiciytlm uanmp ()tlxrxoctadlatr uvilt) 2xo(rpoy1op nmnetat) Duau o;u1alx  feild a rm(vp;t)aeermrciy1op eln i;s  rumim3io4ll e iet t sDum(  ou0tex mfctls s um(ms;t0treoxrctodlptelivo ()srumim3ou1apeelietlt s2ua(rpoo4tlx io3tatla2rl(vpnt0trtomr tatoa eaieilt)t2uo(o io1ap emietls aDumxro;u4alx moeiytla elnmo u4 renmoctadomtr uvi;( trxrio3no4ll elicias srumuront4oltoio3iad s2rluvs (4tltrxrctotlatr iei s0srtoir3io4lmt miciasf 2uaxmo;o4tleniociadfmDrm(vonu4trermociydoa rli ol()setr(mpiy4opt  nvsl()arua(m ou4oeeoiociyt a2ulums;() lerxrcoodom eluvo;s)texrxo iodopt  netl(faDra(m ;o0oex if3tls s ea(mon()arerxo3io1lpteanvo;(  rtrxrpou1alt mncslt) rtaumoot0aeeo fciltfaDrmnvsnt4alxrifcoydopD anvi;() eurxm3oo1om nmict t)sDrmur ot0ole ioeiydfs2ua(vpn() lerxrcoo1fpteaivi t)truo(mpnu1om elnct ()aDumx  ot0aptomi3ias a2eaumo u)artomfcoa1lmtrauvo;t  exmir3no4lpe mnvsat  Dra( onu4tlenmicilt a2ean on(4texnir oy1lp raivs t0setmir3nudole mnviatfs2uaumoou1opx iociyt m ra(mp () lerifctatlm r ueol()t2urim ou1lltn fetl() ruaxr ;u4tet  icilsfa rlu p;()tetrmo3todfateai i;() eum(r iudll nlfvtl(farum(m ou4oltomoeiyd a2umums;(0arenxo ia1lat anei t)srxm(o3nydamee nct t)s2umx p;u1tltnmictlslm rln pn(4treoifcoa1omDrauvs ( t2tr(r nu4omee ieslt)a2umumont1oleo ictysfa elumo;(0arerio iydoaDran s t0 eum(o iy1ole livils)sDtmu o;t0teeoif3tadfm2elnmpn(4tleoio iadomtrau i;t  rxoxo ou4ol elivia(fsDtr(mp;o4tlen i3ilslmDumu p u0texrif totopDraivs;t0seumxm ou1ole mivia(  rtaxm nu0tleomietlsfs elnvpnt)trxoxr3ootfp ran i t t2uoxr nydomee ncs t) Dtrx  ;u1tpxo feiad mDrmu p;(0 eenxo3oytoa ranvi;t0t2trirpiy4op elivsat)srraurpnt4oet  i3ilt mDrm(mo;u) ltrxfciydop e i il( teumir ou1omtemfci s  2ua(r ;t0texn fciltlsDuan s u)altnxo io1fmDe nvo;t t2xmxmpiydll e fes ( aDuaxmonu4tltnii3ilslaDea(vo u)trtrir oodfpDrli olt0trtrxo3io1lltn nvsasfa2um(r ;t0tpx iociadls umnms;(0altnmr3ty1lpt  u o;s0 2xr(o3ou1aleelfvt s srua(  nt0oetniocildfs2ulnms;u0arxoio3ty1oa eaies s tetoim iu1om nlfeils)a2rr(r ;o0olt mi3iytfmDraump u4 lxrxfciytoa   i ol() exoxmpou4lltn ici s)arta(roou0texn o3iytlmDrm(vont) eenmrcoa1oaD auvolt) 2xo(m3nodop  licilsfaDuaur ;t4apeo fetatls eanmon(4 etnxrciytfat liei ( t2xmir3iodopt  nvt tfartmur ou0opxoiietaslmDeln o () eenifctadoa  anes;( s2uo(r oy1ap e nciatf rrmu  ou0oetnmieiys a elu s t)alenio3iatlatrlnes;s0s2tmio3io1oltemnvsasfa2rr( onu0oetoioeiys a rl( o u0tltnir3oodopDrlu o ( t2tmirpny4lpe lnvias srua(  nu1aetnii3tltfaDrm( o u0 rxrxr3iydomDr iei;(0 exmxopou1ap   fcslt) Dta(rono0opeoiiciysla2ea(vs t4aexoio3iadom  aieo t0 2uriopoudamenlncs t) 2tmxr ;t1ole  f3tadls2el( p;u0trtnio totlm eaneo;(  exm(m3oy1ol nmfvsls) 2rm(ro;t0aptnifeiytfs2emu s;t0trenxr ty1op r uvils seumir oydam   netls) rrmurooo1ole  o3ils aDea(ms;()aeenio3oo1fa  ai i (0 exrxrpny1lm nlfetlsf rtmxro;t0apeoifeiydfa2rlu on()artoxf oydlmteaueo s0trtrir3no4lptelncsa()a2rau o;t0olxo fetatlm2emumpnu0 reoxo io1omD au s t)t2xmxm oodlm e fcs (f 2um( p;t0teeomiciys a rmn pn(4aeeoxr3ta1fptr nvi;t)srtrim nu1amt  netl(f rrmx o;t0olx ifcils aDemumo t4 rtrio3iodfmDelnes s t2xmiopoy1oleemfvsatfsDtrumpou4tleomo3iat sDumn p () ltnircoo1fpDeluesls srtrxo3iu1omenmnet (faDtr(mo;t4oeenmfeilsla2ranvo;u0 ltrmrcto1fpt  n i;s0t2xmim oo1ll nmictas s2uaumo;t1tpxomfeiytla uluvo t)alxomr iytla rlu s;(0s2umxr3oy1opeemncslsfarumxrpot4texomoetltfa2ea(vo;u)alxnxfciydlaDe i i t trtoxrpoodlmtelnvtl(farua(m ;u0tlxo oetys m ulump u)altrif3oydoa eau o;t  rumio3iodllen iciasfa2ur(m nt0olt iiciyt sDuaump u)aeenxf iatlmt ai i t setm(r io1al   neia( sDtauroou0opeomo3tadlm2eauvpn()tlxnxrctadoateluei ()s2trxo3iy1am nlict t s2tr(ro;t4alxnifcias m umnms;t4 eermo totlaDrlieils0s2urxopou1lltemiviasfa2um(rpou4apt mo3iydfm ul( s;t)artrir tydlpD anes;t srxoxmpio1olte ivil(fa2urx pnt4tpxomf3tas s2ran snu4 leomo3tydfm  lies s t2trim oo4am n nvs tfsDum(mo;t4oetnmieiysfa2ra( on(4aexnif ia1faDe u i;s0 2ur(o3nu4om  mnei t)s2urxr nt4oeeoif3iadfaDumumo;u0tlxomo oytomD  n slt0trxr(rpnu4ll elivils)s2urur ;u1ape  i3tytfs elums (0teerxr oa1omDeauvsls)t2toxo3oydom nmfeilt s2tax oot1tpxn feiltfm2rm( p u0areomociy1omD an o;t0 rtoxrpny4om e feia(  rta(monu0tpxn ieiydlm rau p u0tleomociodlmtrlu slt0s2um(o3no1amtemicil()s2rr(m ;t1tpt if3iysfa2ran snu) eerxf3oo1optelnvi;( texrxo ny1lpee ics t  Dtm(roou1tlt  fciadfmDemnvo;(0aetrir io1op  auvo s  rurxm iu4alenlicsatfsDtrxmo;t4tptnifcilslaDrlu p (0alxnmr3oo1opt an i;(0 2urxrpnydole mnvsatf rumump;t0oetomfctltfs2umump ()texnxfcio1fatrau s t) 2um(m iydlpe  fvs t)s2taxmpot4tltomf3iytlm elu s t0arxrxo3iatlpD livols0 rtmir iu4lpt lfcs s aDrmurp;u0apeo ocilt m el(mpnu4 rtnmr iodfptrlnes s0t2tm(m ny1alenmfcsa(  rumu  nt0tpxo oeiltfs2uau o u4aexnmf totopD livil( teumio iy1lpen fvt t sDtax  ot0teto octatlm umu pn(4arxrirctotlp rli i;t)t2to(opoydap nmncils)s2rr( p;o1tpt moetyd m2emnvs;u) ltrxocia1fa e nvi;s srxoxr nudol   ncia(faDrmuroot1oetniieiltlmDum(vo;(4aleoiocoo1fmteai s t) rtriopiydllenmncs t  2umumont4tltniieiytfmDum(mp t) rxoio3tadfaDean s;s texo(r3nu1optnmivtatf Dtaur ;u0tpeo o3iasfs2ra( pn()tltoxocto1fm   nvs;s trxo(o3ny1lle  nvil() 2umxm oo0tlt mieias m elu snt0arenxf3tadomDr neil() exoxo ny4lle mfvilsfsDururp;o1optoiictydls2um(vp;t0 eerxociotfmtrlu s;t s2xr(m3ny1lp nlfeilsf 2tm(r ou4apx  ictlsfm rmn o;t4 exrir iy1oa   uvsl(0t2xoxr3ou4ope mfeia(  rumump;o0tpeoiiciytfsDra( o u)artnxrctatfa ranvs t) 2to(opnu4lpeemfesat)srum( pot0tex  oetyt a umuvs u4 lxnir3oa1fat ai s () 2tm(opoy4ol   iet (farumum nt4tptnmf3ils m2ea( snu4 rxnmr3oydfatelivsl()texoxm iu4ll e feta( sDuaxrpoo4alt iicils a2em( s t) renmo3oa1lmtranvi;t s2xrxo3iy4olen ivi ( s2ur( ooo0alto octat s umnvp;t0arxnifctadfpt aiesls)srurirpnu1aptn fesas)sDtaxr ot1tpx  o3iyd sDea( p;u) lxrxfciatfateanes t s2trxo iodam emfvsltfarta(m ;o1oeeo f3iyd m rm(monu)tltrmo3oodlm r uei;t0srtrio3nodlm eliei tfsruaumoot1alenmi3tls m emums t0trtrxo3oatoatr nvo s)t2umxm ny1lp  mnet (f ruax p;u1teeoioetldfaDrlnms;t) lxnmr3ty1oaD  uvs s s2ur(rpno4lpen icsls) 2ururpou0olx ii3iad m rluvp;t4trerif3oodfmteaivi;s0 2uoim oodlmt mfetas s2uaxm nt1tltn octld sDumuvpn(0altomoctatlmDrlues s s2trxo no4am e iei tf Duaurono1openifctldfmDrluvont4tltomf3oadfmt  ivo t)s2xmir io4lp elivtls)artmu ont4aexn feiasfa2emuvont0trxnxoctotlmtelueols s2tmim ou4ll n ies t s2uau p;o1aee  ieildls2uanvp;u4 etomo3totlpt an o t0s2toim3iudalen feta()a2rmu o;t4oeen oeildfaDua( s;u) lermrcootfaDeauvo ( sexrir3no4ll n ies t  rum(mono4tlxoif3iltlsDum(mp (0 eeoif tadlpDean s s t2xm(r iy4ap nmnetl(farra(mo;u1aeeoii3iat s2ul( snu0 lenirctotlmtr n ilt)trxmxo3iodllt liciasfaDumu  ;t1apx  ictyt m rlnvp;u0trxnmo iytlptelues (0seuoxr no1ap nmnvi (  Dumx  ot0apx mocild s rmnvsnt)alenxoctotopD anes s srtmio ny4lpte ivsat aDumxrono0optnmieiasla em(mp u0tltnxr ta1fpte ivslt  exmim3oy4ol  livs t  2rrxmpou1alxn oetadfa uln p;u)tlenmf io1op  ln s t) exmxo3nu4lltnlivs s artmuronu1aptnioeiad aDumuvo;t4altoiocty1lpDelieolt0 2urxm3iydapt lfvil(fs2rrx poo0tetoif3tad s rm(vsnt0tlenxrcoo1opt ai i t0teuoio ou4ap emfesatfsDta(r ;o0altn octytlm2ul( p;() lerxr ia1lp   n ols0tetoxo3ny4aptnmivta( s2ra(mont4oexn icilsfm2umn pn(4aetoiocio1oate neilt  etmxr oo4am nlfes ( aDrru  ou4ope mietldlaDeaumo (0altnir3tatfpte nes (  etriopno4optnlfeta(fsDrr(mpno0tlenif3ilsla ra(vo u) rtrif iy1omD luvs s0srurim oy4lmtnlfesls)arua(mpoo0tlt moeildls2ra( s;(4 rtriociydlmDrluvi;()trtrxm3nu1al  lnvtl()srrmxro;u0oexnmociltfm2emnvo;t)texnmoctatomt lnvolt t2uo(opou4llenmfvsatfaDtaumpno1tpeoio3iatfaDea(vo ()texrxf3iytfa eanvs ()tetoirpiodale  fcs ( srur(rpou4aeeoii3iat s ra(vs;(4 eeoxo3oatoa r n s;( teum(m3io4ame mnvslsfsDtruroou1open o3ilt s2rm(mo;t)aetrxrciadlpD  n s;()tetoiopio4lltn ict ( aDumx o;u0open f3tlsls emuvont)teenir to1fmDrlnes;( sruriopno4olen neias aDta(m ;o1apt  fcias m2uau onu4trxrmf3iotlp  lu s;(  exm(r iudllee nvtat)arrm(  ou4opxn i3tatlsDul( ont0trxoir oytfpDr u ol(0sexrxmpnydolte nvsa()aDumx pot4oex  iciaslmDrluvs u4aexoir todom  anes t  2xrxo3ny1lptn nvsl()sDrmx ooo0oee  f3ils a um(vpn(4aetomfcty1fa rln ols0sexrxm3oodamee ies s  Dtrumpno1teto ieiyd m2uluvon(4 ltrxfciotopt li o;t0 rxmir nu4ope lfesa(  rtmu  ;u1opeoio3tlsla uaumo;t0texnif3to1fptr ivols)trxmir iy4lme lncia(fsDtm( p;o1oleniieiadls2ranvo;(0 rxrio oy1op   uei t) 2xr(o3ou1lltnlnvias) rrmu  ot1aleo i3iadfaDuln pnt4aeeoxo iatopDeaueslt  exmxm ou4ll  lieiatfartr( oot4tltnifcias sDemnvp;u4arxrmr3io1omDran s ()trtrirpny1optemfvta()sDua(ro;u4olenmo3iatfaDuanvo;t)altomf3ty1lat aueslt srtm(m3iudlpe  fci ( s2rmxr oo0opx mictys m2rmnvp u0tlermociytlpt aieilt)trtmxopno4lptnlfetlt aDumu o;u4tptoiietls sDel(mp t) renxrciatomD lues;s0 rtrir ny4lptemfcs (  rtmu ooo1oltomo3iyslm2um( snu4 lxrxo totla  au o s  2umiopiudomee nvtl(  2um(  nt4alen oeiltlaDrlumont)texrxrctadfmDr i ilt) rtriopio1llenlnet t)arumxm ot0opx  ociatlaDeluvp;u4 rtoio3ty1fmDr ueslt0truoxm no1apenlnvt sfaruax p;t4aetnifctytfa uluvo u0teerio ia1optrli ols0s2toxrpiu1alt mncta()arur(rpno4oleomf3iatlaDra( s;u0aleoxrcty1lp e ueils)texmxm oo4op e nvi s  Dtm(roou0alt moetysla2ulnvs ()areomrcoydfat ai s;s0trumir oy1amtemiei (farta(  no1tpx mf3iadlmDuanms;t)texoxocta1oaD  uvo;t trtmxo io4ll  lfetasf Dtmu  ou0opeomieiysfa rmuvs;t)treriocoydfp   u o;() 2ur(m3nodlm  mieias) 2urx pou1tltnii3iydfm2rauvpnu0 exnir3oytfa eau ilt trxo(r3ny1lpenlfvs t)srua(m oo0oltomi3tysfm2rm(vp t) leoxfctotomDrluvsl(  2tmxo io1ape livt t sDurum oo4altnmieildlaDranvsnu4 rtrxr3iydfa  an s s0srxoim3nydop nmfcilt s2umx pnu1tpen o3iyslmDumu on(0 etrmo3tytfpt auei;(  rtmxopoo1llte nvs t)artru ono0tetomf3tyt s2emumo (4altnio iatop elueo;t trxmimpiudom nmicsasf Drmum ot0aptn feiytla emums t)aleoxrctydlmDr n s (0trtmim no1al  livtlt) Drmum ;t0teenifctytlm2ranms;()tlxnxrciatopD  i sl(0s2xm(opiu4lp e netasfa2rmx  no4oee mi3tasfm umnvs;u4 exrmr tydlm eai o s)teurxo iu1ale mnes tfsDrm( p;u0olx mfciydls umumo t0aetriociadfmtr ueo t0 exrir3nydol e fvs ()s2rrxmooo0tle if3tasfs2emu pnt4tlerxf3oatom raueol(0 rur(rpoo4llt  ietlt a2umum oo4apx  ictltfa2ua(vonu4arxoio oa1lptr uvolt0 2urirpou1op nmictat) 2taxm ;t0alxoioeiltfmDra( o u0trenif3totlatean sls)srtrio3iu4ll e fvtlt)arurumooo1opt ii3ildfm2eln o;t4 etoxr3iadfptr i s;s trxoxo oodapen fetasfsDra(ro;u1aptoioeildlm2umn o;(0 reomf iotfpDrlnvilt seumim nudop emfvi sf Dur(m nu1opt if3tatfa2rm( p u) eeoxf3tydfmDeaueo;t) rumxmpoodom nlfesas sDtr(moou4aex ifeiys m2umnmp;t4 exnxo oodfpDeanes;s) 2xrim oo1ole livi (f rtaxmp;t0aex iieiyd s emump;t4 ltoio oatfa eli i;t0 2umxm3iu1lmtnlivs tfartr(  ;o4alx if3ilt mDel( p (0arxoircta1op  lieol( t2xoxrpiy4omtnlivils  2tm(  no1tpxomoeiydfm2ra( onu0tltoxr3oy1opte nvo ( t2xrxm3oy1omt mivil()s2rrxrpnu4tpe ii3ildlaDra(ms t0texomr oy1lm raivo;()trxr(o iydal  lietl(fsDurur ou4oeeomfetad mDuaumonu)tltrxocoatfaD  i sl( srto(o nu4op   netl()s2uaurp;u0alxo octat s ea(mp u)tetoxr to1om rluvils s2urim nodal nliciatf 2tru o;t4oet ioctldfa2uanvp;u4 exnif ta1fm  anvo ()trtmxo3nu4ale  iviatfaDtmumpnu1opxn oeildfa2rau o t0 ltrmfctatfaDranvs;()t2uoxm3oy4lm n nvi sfaDurump;t0aexomiciyt s2ra(vs ()treoirctadoaDe ies s)trtm(m oodlmt liesat a2ua(m nu1oee  o3iyt m rl(vsnu) ltrmf ootlm rauvilt)texrxrpiydlleelivi t)sDrrxmo;o4aexnmoctysls2rmumonu0 lxomr oodfm  lieo;t  2uoxrpiodape mivilt)arrmum ot1apxnmo3iat a umn s (0 exoio ty1opDrau s;() eur(o iy1ame  neia()aDur(rpot4alen feils s2um(vont4 rtrxfciotlm   ivo;t0 eum(r oo4opt  nvsa( arra( pou0openiietydfsDrlnvpnt)tlxnifctodopDrai sl( setrimpio1lltnmici sf Drr(rpnt0apxo iciadlm umump;u4texoxoctatfpt aiei ( s2um(mpoy1oltn fvtat s2trxrpnt1altomf3iyt sDuanmpnt0 lxrxr oytfm  ai i t trtrir3oo4olt  fvsa( arrmurp;u0altnmf3tytlsDrmumsnu)aexrxrcoo1lmDr uvo s0 rurim oy1ol  lfct tfsDrau poo0opeo i3iat s ulu o;u0 etnmf3oy1opDean i t)srxo(r nodope mfcils) ruau p;o1tltnifeild m ul(ms;u4artoxfcootlatrlueo s  euoxo3ny1optnmfcils a2ua(ro;u4aee  oeildla ra( pnt0tleomrctadlpDelnes;( trumxrpoydap elicil()sDrmxmp;t4opxomocils aDel(vo t0 rtrxf3todlpDeauei ( trtr(m3oudalenmfet (fsDrmu  oo1tle  ietlsls2ua(vs u)tetoxfctatlpteau s s  rxm(o3no4ol  mfvia()arua(mpno4apt  f3iytfa2em( p u0trxrxrcoodopDran i;s  2to(o iy4omtnmfesa(fsrtmurp;o1aleomo3iydls2rlnvonu)alerio3tytlatr ues t)s2xr(m3iu1openmfvi t  2umx onu4tex io3tltlm ra(mp u0tlxomfcty1lpD  ueo t0 rxmxrpoy1lmee ivi t aruru o;t4ape  oeildfsDua( o t0 rtrmo3tydfp r u i;()texmiopiydlpt licsasfsDta(r nu1oeenmo3iaslmDrl( sn()areoxo iotfaDr uvo () rtoxr oudaptelics tf Durx onu4optnmo3iydfmDem(vp t4tetomr iytfp raneol(0srxrir3oo4alenlicia( s2ur(m ou1aleomfeiytfm2eanvo u0arxoir3iytfaD  neil( t2uoxrpoo1lmenmnvtltf rumxr nu0apxomi3iyd s eanvs t4arxnmf3oa1opDrlnvi ( tetrxo3nudllte icils)sDtaur ;o4oet  ietydfmDuauvsnt4tetrmrcoadlp  ai i t  etoxr3no1oltnmici s aDtrxro;t4tlxoif3iatlsDumuvo u) ltrioctotoatrlneilt t2tr(r3oy4ap nlnct (  rrmxr nt1aeeomi3tydls2ulu pn(4 rxnxo to1oat auei;()s2xoxo oo1llt  nci t  Durur nu1tleoii3iatfsDem( s u0tltrxociatlp  lnvi;t0 2tmim ou4am emnvsl()a2trurpou0tlto ietyd aDrmums t4trxnmocoytlatraivi;s setr(m nu1openlnvil(fsrum(m ot4opx ifciyd a rlnms;()trerir3oatfpDraneslt trurimpno4optelneia()srraurpou4oltnmiciysfmDeluvo;(0alxrir3iotfm e n i;t t2xoio iy4lltemiviat  Dtr(root1olx  feiltfm ranvs u4 lxrxr3io1fmt aiei;t)teumxrpiy4oleelnvsas  Drmx o;u4tpeniieild aDrl( o;(0 renir3io1lp e ieo;t)tetm(o3nudalee nci s arrax p;t1tle io3tatfm2rm(monu4teeomrcty1omt  iei ()sexmxr3oodlmtnmfciltfs2urxrpou4tleomi3ias mDrlnvp;u4 etnirctotfatr nvo ( teumxr3nodaltn nvsatf 2ua(m no4apxo oeiad m rl(vs (4 rermr3tatop e ivsl(0sruo(o3oo4oltelies tf Dtmu  nu1oeeomfeild s emnms t) eenxr3tadopt  u ol()s2um(r iy4alenlivt s aDtmx o;u0tlxnmiciytfs2eauvo (0arenxr3oytfm  aieol() 2um(m iodll elictls sDurxrp;t4oltomfciys s rmumo;u4altriocoa1fmtrliesl(0s2to(m ny1ape mncsat) Dur(mpot4aleo oetatla2rmnms;u0teenxr3oy1lptrauvsl() 2umxr3no1lme  nci t) Dumu p;t4opeomietytlsDumu s;(4 lerif oo1fpte iei (  exmxr oy1ol  mfctlt s2uau ooo4aptomiciytlaDem(vs;u0 rtrxf3oodomD anvo s  euo(o3iodapt  netls) 2umxrp;t1ape  ictld m2ul(vo;u)tlenxr3tytlat lnei s0srtrimpiu1omtnlfcias)a2tm( pou0alto o3tas sDea( o t) etnif3oatop  luvs;t  2toxo3iudlmtelfcia(fa2tmxm no1tet ioeiysls raums (0tleomo3todlm eai il(0tetmimpiu1ole livsatfa2rmur ;o1teto iciadlsDrl( onu0aeerxr oa1fpt
\ No newline at end of file
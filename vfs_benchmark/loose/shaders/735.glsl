@@ -0,0 +1 @@
+u o s  exr(r3oodam   nctat srtr( pnu1alto i3tlsla rl(msnt)altnir3tydla  aieo;s)teuoxopou1lmenmicsls)srra(  ;t0teeomietldfs2ul( o t4 eerio tydfpDeaiesl(0 eto(opnu4am   fesat) Dua(r nt0teto feildfs umu s;u4 rxnxr3iydoat lues (  rxmim iydllt mivt sfs2umxrpoo0tpto oeildlmDuauvs t4 lxnio3oadfa r ivs t0texm(mpoodoltnlfciat)arurx onu4tetnmo3tasfa elnmo (0 etoxf iadop eai il(0t2tmirpnudaltelnvt t srtr(m oo1tptnifeiad a em(vs u)trtrxo oydlp raues;s0truoxm3iodopte ncsas)arrm(monu1aleomfeiytfaDemn pnu)teeomrctatomt auvsls)trxoimpoudole  fci t  ruau  ot0tetoif3iytlmDul( o;u0aeeomo3oodfaD li sl(0teuo(opiodlp  mivt sfsDtm( pot1aexnmi3iad s2uaumpnu4 lxnif iy1lmD  neo (0 2uo(m no4op elictls)arta(  ;t1aptomociatlmDra( o (4 rtnmfcio1fptrlnvols)t2xm(m3nudlme  ictls aDrmum ;o0aptniociltla eln ont4altrxf oy1fpDeln i () etrxm oo4al  mivia( artauro;o4oeeomi3tlt s2em( s u4arxrmf oydlptrauvs;s0 rtmir no1lm elfetat)arta( ont1tltoif3iat m2ean o (0 eenifctodfa elnvs;s)sexmim io4lpeemncias  Drr(ro;o4oexn i3tydfsDumnvsn()tlxomo3to1la elivs s)tetoimpiy1ap nmfvias aDtru  no0tlt  i3iytls ra(vs;t) rtnxr tatfptrli i t)tetm(m iu1apt livtlsfsDrm(rp;u1aeen ictldlmDuluvpn(4 ltnif3tytfpDeaueo;t) rtoxm nu4ole licia()aDra(r nu0tltnmfeias s2uln s (4alxrmocoytopt ln s s)srxoxopiodop  lietas a2tax ono0olto o3tad sDrlu o;t0tlxrxrcoy1lpDr u i ( tetr(m3ou4apt lnvsl(  rrax o;o1oeto fciat a elumo (4aexomo3oy1lmDeln s;s s2trxrpou1amee ivsatf rua(r nt1apenmoctad aDrmu p;t0tlxrxr tatlateaies;(0tetrxm3io1olt lfvt (fartaumpou4ape  o3iad s2emu p u0 etnmr ia1fm eln o;s)t2tm(o nu4ape mfvslt  Drm(rp;u1apx  i3tlslaDum(mo;u) reomf3to1optr nes s  exm(o ou1olen icsasfsDtmxro;u0alx mf3iysfsDrmump (4aetoxf3oodopDranes t0srxr(o3ou1opte icsl(f rua( poo4texnmietlsfsDean o;t0teerio3ia1fate nvo;( srxr(r iy1omtnlncsls aDumx pno1oleo ietlsfsDumumsn(4 lxomf3iatopt  ieo;() rto(r3no4al elncsa( aDtru  ou4aptoif3tydlm2ea(vp (0teeomociydoatraueo (0sexo(rpiudlmen nesl(fs2tau  ou4tetomi3iasls ulu s;u4arerio3ootlm elu i;() etoimpoydlmenmfeia()sDua(  nu1tpxoioctlsfa2um(vo;t4altrxfcoy1fm r uvi ()texrxo iu1alenmivilsf Drmx onu1tpt ifciasfm eauvo t) etrxr oytfpt ln sl(0 eurio3io4op nlnctls)a2um(  ;u4tpen o3tlsfs2em( p (0 exoif iydfmte u o ( t2umxm iy4am nlfesa( s2ur(r nu1optnii3iad a2ua(vsn(0 exoifcio1omtrlueo;t)trxrim3no4lp n nctl()aDuau  ;t1apt ifctytfs rauvp ()tltnxf tatfmtraneslt0teuoxrpiu1open nvs s)srra(roou1alxn i3ilsls2ranvpnu)trxnmf3oo1fp  ai s;s s2tr(rpoy4lmt mietl( s2rrur oo1aee if3tldfa2ra( pnt)alenmr3iadfmDelneo t)truoxopnudoltemfcta()arrmxr ot1tex  f3tadla rm(ms;u) ltoxfcoatla r u o ( seurim iu1amtelfvi tfaDuaumoou1aex mictldls2ea( o;(0altrmf iodop ranvilt teuoimpnydam n feslt arrauroot4oeeomoctldfs elnvp;u4 leoxf oydomD ai sl() 2xm(r nu1lmee icia(  rtru o;u4olt ifeils s umuvp;t0 exnxo3totopte u o s0s2xm(o3oydomt lnci sf Drmuro;u4ope iieiytlaDrmnvs u) lerif ootla e i o;() rxm(opnu4om elnctltf 2ta(rpoo0oltnmoetasfm rlump;u0tlenxociadopDelu o;( s2uo(rpnu1lp e ici t) Dtau pno0ape mf3ilslm2ul(mpnu4tltnmo3totlaDran o;s  2trxopny1ope  nes ()arta(  nt1oex iiciadfa2emnvpnt) ltoiocty1late uvs;s srxoir3ou4ap e icslt sDrm( oou1tet  feiysfsDra( o u0alxoxocoo1fp  anvsls0s2xmxm3ny4op nlfcils sDumum ;u4olenmictydlm elnvo;t0aeenxr3iotomtr u o;(  2xr(rpio1am elfei t  rrm( pnt0texo i3iydfm eanvs ()altoifcia1laD liei t0t2umimpoy4al emfvt ()aDta(r no0oleoio3tld sDeln p t4arxomf todoaDrln s;t sruo(o3io4optn fvt s) 2rau  nt1aexoio3tltla2el(mpn()tlxoxo ty1opD  nes ( t2xr(m3oydlm n nvi (f 2rrum ou1apt io3tatls2ra( s;t)tetoifcty1om eai s;s) rtrimpno4omt licslt srrmxmpot4tetnmicildfs ulnms u0treoxr3io1op r uvo t0tetoirpoo1amt  nvi () rtmx  ;t1oltnmieilt a2ean snu4 lerxoctotlm rluvs;t)t2ur(r3oo4op e nvilt a2ra(mp;o0alto ictldls ea(vsnu)tlenxo iatfpDraivs () rtrxo iodlmeelicslt)aDtrump;o4opxoioeiyt mDeauvo;u4 etoif3oodomDrlivo s)s2tmxrpiydlmtn fes (fsDum(rpou0aet  o3tydlaDumums;(4 lxnxf ta1opD lieslt0 etr(o3iodol  mict t)s2rrxm ;o1oee mf3ilt s2rl(vsnu0 eermfcio1fptr i o;t s2umxo iy4ope mnvta()s2ta(m ot0tex mi3tydfmDemu p;u)tlerif tydop  aivs;(  etmxo3ou4apenlnes ( artmump;t0apx mfeild a2uluvo;u4tleriociotomtr uvi t)srtr(o iydamtemnesl(faDta( pnt1tpeoiictldls ulu pn(4 lenircootlatr i o (  etrxm oo4optnlietat s2rru o;u4oeenif3iad sDuau p t) rtrmf iy1fmDeaieo t srtriopoy4lmenliet sf rtmurpoo0oetomi3tadls2eaumon(4alxomo3to1oatrau s;s t2xoim3nu4lmtemiesl( sDta( p;u1opt mo3iydfm2rauvo;() ltnmociytfmteln o () 2urxm iodom nlictlt) 2urxr oo1oee iiciadfmDea(mpn(0 ltnirctadfptraneo;s seur(mpno1al  liesat) Dtmx ont4aleoif3iydlm2ulu p;t0 leomf oy1omt aueo;() rtrio iydape  netat aDumx  ;o0ope mieilsls2rauvs u)artnxo ty1laDelu o;t) eurxmpiydape lneia( srtru ont1tptnmoctyt sDrmump t) lxoxocoydlmD auei;t0teumxm iudllee ncil(fsrrrxm nt0tle iietld aDrauvp () rerxociotfaD  ivs;s0s2trxo3ou4amee ivs sf rur(root4tpenifcildfaDrlumo (4tlxoir3iodfatrli slt s2xrimpnudlme lncs (  ruru  ;u1aexnmieiatfs2rmuvsn(0 rxomrciytfp rli i;() 2trxrpnu4llte ivs s  rrr(  oo1oexnifcild aDrmu pn() rerxociotomD aieil()setrim oodop n ictl(fsDurum nt1aeeo f3ildla em(mp t)tetrmfctodfmDe n ols  etoxo3no1am   nctl( sDtmxronu4oeenifcilt a uau s t)texnir tatlp eauvo;()s2um(m iy1aptelici ( arum(r oo0alxn f3iadls ranvpnt)texrir3oo1fpD  uvs;( trum(m oy4om  mnetas)sDrrxm ot0aeeniocilsls umn p (0trtnmf3oadopDelnvols seuo(mpou4altnlfvtat)arum(mp;u4texo ociys a rauvo;()altrmo to1omDrlnvi t trurxrpno4ap   fvta(fa2urxmooo0opto f3iad s2ulnmsnt0alxrmf ty1oaD  nei ( texr(m3ny1lpte ietas) 2rr( ono4tpxo ietld aDra(vo;(4trxrio iatom  aivo ()t2toxrpnydll nlfetas)sDuax o;t1tex iieiydfmDum(mp;t)texoir iadomD  ieilt  2xoxm3io1lltn iciat sDrmum oo1oetomiciat m ran p u0aexrmo3todoaDeaueilt  euo(opnu1lptelivs (  2rruroot4tltnmfciysls2rluvonu0tetnio3oodlpDe ivs;t  2xr(o iu1omtelivi t)s2ra(mp;t0alxnii3iyt m el( p t)arxoxf3iy1fp eauvils)texm(o ou4aptnmivs tf 2trx  ;o0alx  feiad a uaumon(4aeeomo3iydlaDe uei;t0setrxo3io1openlnviat) 2trur no1oleomfciatla2ra(vo;t4 eeomf3iodla r n i (  ruo(m no1ame lnct s)sDtmu pnt1teeoif3tadlaDem( s t) ltrxr3oadfmD anvols0t2xr(o no1ap nmfcta()sDtm( o;o0aexo oeiadls rlnvp u4 rxnxfciotopt  i s;s)tetrxo3nydale  nvsl(  Durxmpou0oltnmoeildlmDrlnmp;u4tetomo iy1fpt  u s s) 2uoimpny1apenlics sf rurxr ot0tex mi3tltlm2umnms u0 etnxo3iodfate nvs;s0sexr(m ou1om  lfcs s a2rm(root0aexo fctysfa2rluvp u0aexrxf oo1fm rlnei;( s2xmxopiu1olte ivt (faDrrx pou4tptoio3ild m2uln ont4aeeoifcoy1oaDeauvo;s  ruo(m iodale lnesa(fs2truro;t1tpenmiciyd m2umumo;t4arxnmr oadopteanesls) rumxmpny4op  mivta()sDrm( ont1aee iicildfm ra(mp;(4altrxr3oodlpDeln i t setm(mpoodomen netlt) rrrxm ou1tpt ifciltla2rl(msn()altniocty1op  auvols) 2to(m3ou1lmte icia(  rtaxrp;u0aex  ociydla em( p u4trtrxrciy1om r nvi s s2xrxr iy1amtnmiesat a2umxrpoo4opxnioetasla emn p;u) rtrxociy1lmD au i;(0 2trxmpoo4altemfeil(fa2tr(mpoo1oex if3tldfa ua( s (4arxrmf3oytomtrauvs ( teumxrpiydlmtnlicil( a2tauro;o1teen f3iyt a2el(ms (0 rxnxr3iatoa rluvo;t t2trio iudlle lncs (fa2tm(r ;o1aex  ietadfs uaumon(4alermf iadopteai i t)srtoxopiodlmt liet ()aDtr(mpoo0aleomociadfs eanms u4texoxr3todfmD liesl( texoxmpoydam  mies () Drm(rpno0oeen fctat m elumpnu0teeoxfciotfp rluei;t t2tmxo3oo1ap nmfcil(  2taumo;t1opxn f3iydlm2um(msn(0aleoxrciodfpD luvi () 2xr(m ou1am n fctls  rtru oot0ope if3iys m rmuvp t4 reoxf to1fateau ols  rtrxopny1am nlnei (fsDumu  nu1apxo icildfaDel(vp;(0aetrxo tadfaDe uvo () exo(mpoo1optnlfcsl( a2uax ooo0tlenmieils s2uau s;u4aeeoir3tydfm eai o;()srtm(m3iodlp  mnvta(fsrrrxr oo0tltniocilt s2elnvsn() etrmf3tadfpDr i o;t  2umxo3no4lle lnvs t a2trumo;u0aetn ieiydfsDrmnmp;(0teermo oytlm rlivsls0 eumxo3oodap  livi sfaDrm(mpou4tet iictldfmDum( p u)altnxo tadopDelneo t0srxoxo iudomen fetlt)a2uaur nt4tptoio3tadfm2rluvo (4alerxf3oa1laDrluvilt)s2xoxr3oodam nlnctatf 2taurp;t0aleoioctydlaDua( s;u0aeenifcoa1omDeau s;( s2xriopoy4amt lfci tfs2urxr ;u0apeomfeiydlm umnvp;t0 lxnirciotfmDr i i (0 rxoir3ou1amte icslt) rum(r no1aeenifeild sDrau onu0 etomr3iotfat  nvo;t)srxrxm no1aptn nct s sDtau  no1tee  fetad s emn s t0aeerxoctydlmDeai i s0s2uo(mpnydlptnlnvtat)aDrm(rp;t4tptn o3ils aDranmp;(0 rxnir3tatoa elu sl(0setmio nu1olenmnvslt) rtm(moot4tlxnmoeild sDuln o ()treoxocoodoaDeanvi;t teurir3ou1lpe lneiltf rtrum no1altnifeiadlsDean o t4arenxo oodla r neolt  rumio ou4omenlnciat sDrauronu0aet ioeildlaDra(vo u0 etnir oydlmDeau o (0t2xmxr3oo1op  mnctl() 2rm(  ;o4tlenmoetadfm rln o u0tlenircoytlpD  n o;s0t2trxm3iu4om  mivt ()arrm(mpnu1alto ociatlm2ran p t0trtomocoatfmDelnei;()teurimpiydope  ict s)artruront1tee  ocilslm ulnmpnu0alerioctotlm   i olt)setm(m iydom elfvs s arta(m ;t4aexoio3iyd m uan ont) reoxocoydlat au s;s)trxoxrpoy1am emiei () 2rm(ro;o4apeo fctys mDemn on()altoxfcoy1oa raiei;(0s2triopou1lp   nci s) Dumumonu0tlt  fetytfm2rm(vp;(0 renmo ootlpDr n s s teto(m iy1lle  ictat)srtrxrp;o1tpeoiociys mDel( o u4 rxnmr iydopte nvs;s0trxr(o3no1lmtemieil(fsrraum ;t1tet ifeiltlaDrmumonu4trxrxr3iadfa  lnvilt)trurimpoydllt  netlsfaDrmx  nu1ope ifeiltfa uaumsnu0aeeomo3totfm e ueo ( t2tr(r oodalee nvs s)arua(ro;u4tlxn fciyslsDumu s u0alxnmr3tytlpt anesl(0s2uoir iu1lmenlnesas artmuro;t1aptnifeiadfa2ulnmo;u4trxomo iodoa eauei t) rxmxo3nu4amenlicslt)arta(r ot4texnif3ildls umu o;t4trxnmrciotfmD livslt0 etmxm3oo1ame mfet sf Dtau o;o4olxo fetadfs2rm(vo;t0arxrxo io1fate nvo (0 2tmim oudlpeelivs t)sDtmxrpnu0olt iiciytfs ra( s t4arerxr ta1la  lu s;t  rtr(o3nu4al nlictltf rtrurooo1opxn iciyt m ea(vp t) eerir3iotoateluesls sexmxmpnu4lm  mnct t a2tmump;t1tpe io3tad m eln s (0arxoir3oa1opDeaiei;s)setr(m ou4altnmfci s s2tax  ou4apxoifetlsla2eaumo u4 leriociy1fmD aieo;s)seurirpoo4lp nlfvsasfarumx p;o1tlt  o3iydfa2rlnvsn(4 exrio3iotoa elivi s0t2tmirpoy1ap eliei sfs2rax  ot0tlx io3iyt a2rmnvs (4 lxnxrciotlpDe ueo;() etoxr io4omeelfet tfsDum(  nu0olenmociat m em(mp;()altnirctatlmt lu s t t2umxm3oo1lle lfvt sfsrumxmpou0opt iiciasfmDeaump u)tlxnxr ta1oatr uvo;t seuo(opnydoleelfetlt)sDrax  no1tet  fciysfm2em(ms;t0trenxo3ia1fa  auvo;s)srurxrpno4omeelnctlt  Dur( onu0alt ioeiyd a eanmsnt)altoifctydla   i o;s)srtrxr iy4llee fciat)s2umxrpnt4alto i3iys mDeluvp t4arxoxocoydoa elu i s setoim3ou1opt  ictls)aDtmxmpot0aetnmoctat m umu o u4altnmr ty1omDraivslt0trxrir iu1om  licsas)sruaxr nt4tpeoifciytla rau s (4 eenifcoytfmDr i i;t0texrxo oydlpeemneiat) 2rrxroou1oet  f3tytfa2uan o;t)alxrif iatfpte uvil( trurir iu4omen ieiasfs2trumont1alt mo3iyd aDul(vo t)aexnxrciydfa  livi (0texrxm3iy4lltnlies tfartau pou0oee  i3iltfmDrlnmo;t0 lerxfciydlmt aivo s)s2tmiopiudom e fci t  rumu  oo1tlx  octatfs ul(mp;u4teenif3oytfmteaues;s0t2xr(m ou4ome lietas)sDrr(mp;t1aetoif3iltlmDumu o;t0artnmo3iodlptrauvsls t2toio3io4omtelnvilsfs2tau p;u1tlxnioeiatlm2rl(vp;u0 exnif tatoat lu olt0srxo(m3oydlpe  fctas  2tax o;t1olt miciasla rau sn()aexnxrctotlpDr uvo;s s2xrxm3nu4lltnmncs () Drauro;t0tpe  f3iysls2ua(mo;t4tlxnxocto1fmDeaivsls)teuo(r3oo4ape mfet sf Dtru onu0apxn o3iytfa rm(mo (4aleoxrcoatlpDr nvo;(  exm(opoo1apte fvil(fs2taumpou0alx  feiatfm2rmn pnu4 renircoodom rai ols0t2xm(m3io1omtnlies (  2ua( ont0tetnmf3ias sDeanmp;t)trtomf3iydlmDeauvi;( t2urir3nydop  micil() 2umxrpou1aeenmfciatfmDum(ms t) leoirciotopDe neols)sexmxo no4ap nmiesat) 2tmxront0oleo f3tyd aDrlnms;(4arenxrciadlpt lnei s0seuoxmpou4alt lneils)arrr( pou0tptnioctaslmDuanvon(0aexoir oadlptr nei;t0texm(o oydalt  nct t aDur(m nt0apt iocilsfm rm(vo t0tlenio iytoa eliesls0 rxr(rpio4ll   nvsl()a2rax p;t0teto oetyt s2ra(von(0 rxnxo3oa1lmD luvo ()texoio3oy1ll  mncsat) 2rrum ou4tpx ifeiltfm emu p (4tleoifcio1fa rlieil( truoxo3iy1alee nvi sfa2trx poo4apx  o3tls a ra( p;t0aexoiocoo1oat  ivilt0texr(opnu4opte ictlt  2ta(rpot4apeomfcilt mDua(vp;() etnxrcoy1fpDeai i;()trxrir3iodole  fvia() 2rmuro;u4teenmfetad s umu p;t4 exrmrciatomDe neil(0srur(mpiu4ole lfeias artm(mp;o4oexoiictytfm emnvpnt)aetnmr3iadfmDr ivolt  rumxm oodomt lnei (  rraurpot4oltn oeiydfa2elnms;(4aetnmocto1omDe ieo;t)s2ur(r3oo1op nmies ( sDuaxmp;o1aptoifetlt s2ean onu0tlxrxo todfaDranes s)s2xoiopoudal  mfcias)aruauro;t4opx if3iyt a2ranms t)tltrxf3oadla eln s s) ruo(opoy1am n netlt)sDumxr ou1oet iieilt s eanvsn(0alxnmo oo1la eanesl(0s2xm(r3iu4ope  neslt a2ta(mo;o4texnmo3tytfa rlnvp t4trtrifciadfmtr uvs;() rurxrpio4op  miet sf 2uax oot1tpe mfeiatfa2ulnmsnu4 lenir3tatfaDeaieo;( s2ur(r no4omtemnetltfs2rm(m nu1aptoifctas mDra(ms;t)aeeomrcty1fa eluvo;()srtoirpiydamtnmfcs ( sruax  ot0oet mociydlmDumn on(4alxoiociotlm   ies;t)srtoimpio1ap elnvia()aDrmumpnu0tlxniieiad m uau onu4alenxf io1la rluvslt)setriopoodopt  ivtlsfs2um(moou1oltomi3ils s2umu p;t)tetnmf3iadfpDelu s s)teum(r3oudolenlicsasf rra(mooo0oleo ocias a ul(msn()trxnxocoy1fa eaivil( t2urxr iydllee ivsl(fsDuaxr ot0texniocias s ea( p;t4tltomr3totfaDeauvol() euo(opny4ol  lnvta() rua( pnu4apxoiieiad a raump u0aexnxf3tadlmteaies ( t2toio3io1lme mnvi sfs2umxroou4tptomf3iatls2ran p;u0tetrmf iytomtraieilt0 eur(o3ny4lptemiei ( aDrrump;u1tpt ioeiatls2eanvpn()treniocoa1oa  aues;(0 2xrxm iydllt lnvsat aDrax  ou1tpe mo3ilsls2umnvsn(4arxomf oytoptrlivslt0trurirpnudlmt mict (faDurur nu1opeoifciyd mDelnmp t) rtoir totlpDe i ilt0s2xoxo no1lltn ivtls)aDra(rp;u1aeto ictatlm elumon(4 exrxr to1lpD  neo;(0 eumim iydlmtnmietlt)a2uaur nu1alxnmfeiat a2umumsnt0 rxnxo3iydfmD  neols setm(r3nodlp elfct sf Draumpnu1tpt  icilsfa2raums (4 rxrxf ty1lp eau o s0sexmio no4om n ivs () 2uaumono4tee iictytfmDemuvsn(0arxomr ty1lpD aies;t0s2xrxrpoudlltnlivi ( srtau  nt0aetomieiysls2eluvs;(4arxnir to1fatrli s;s)teuoxopiydole  iviat)arurumo;u4tpenii3ildfm eauvs;t0aeeoir3ta1fm  aivsl(0 2xo(rpoodameemfvta() Drr(ro;t4tpe  oetaslsDran snu) eermr oytfatrln s (0srxm(rpnu4am nlnesltf Dtr(r ot4tpx ioctld m2emn p;t0 lxoxr oatoptrauvo s)texmxrpnu1ll emnci ( artm(mpot0tptnii3iydfsDem(von(0 ltnxo oytlmDr ies;s) 2trirpiodll emnvtas a2rmxrpnt1opt ioeiatlm ea( onu4aetoxf oo1omtelu s s)truo(r oo1lmee fvilt)s2tr(mpou4oee  ictls mDrauvs (0 eermr oatlp   nei s)setr(m3nu4ll emicias a2taxrpot0tex iictytla2ul( s;() lxomr tadlpDrlu ilt)trtoxr oudam e fctatf rum(rp;u4alt iocildfm2ea( p t0tetrif3iytlmDr iei t) eumxo3ou1amt miei s)srta(r ;u4tpeo fctls m2elnvp;u)texomfcia1lp r iei;(0 eum(r3ou1alenlneiatfarrr(rp;t1alen o3tltlmDeln o u4aexnircootoa   ues;() rxrir nudope  nctlsf 2rmuronu4tpenmi3iydfaDranvsnt) leomf tytlmt ai ils texmim oydaptnmfvils arraxm nt4teeo fctadla2ulu o t) rtnmr to1lpDeaiei s s2xm(m3oo1ape mfcta(f rtmxmpnu0alt iocilsfs el( o;u) exomf oytlp eau i s seto(opiydomen nvt (fs2trumpoo0alt mf3iysla2rl( s;u4 rtnxf oo1op raiei () rtmirpiy4olen neslt  2umumont0oleoiiciyt a2uln ont)arenifciodfpteliesls)trtoxo no1alenlnct ( srtmuro;o0tltoiicild s rmnvpnt)texnirctodfa eanes;s)sexrimpiy4ame lfeilt arrru  ;t0tlen ictytfa rmn onu0altnxociy1lmte n ols)s2umxmpoydam e nvtat  2ra(mo;t1olen fciatlm2rmu pnu)tlerif oodomDeli ol( t2xmxo nodoltnlfcilt) 2rru  ;o1tee mo3iadlsDua(vo;(0alxrirciodlaD ln o;t)sexriopoo1om emnvt tfs2ra( pnt0teen icilsla2rmnvo;u4trtnmr todfmt anei s)tetm(o3oodame mfeilt s2um(rp;u4tltnmietls s2umn ont0aexnxfctodoaD lu s s)texoir3iodlpen netls s2rmx p;u4tlxnifcildfs2um( sn()areoxo oodfa rln il( srtmim nu1am nmneia()aDrm( p;o0texo o3iadlaDrl(vpnu4trenxr3iytfat an i (0s2urxo3oo1ameemnvt (f Draurpnt4tltomfcilslm2uln pnu)alxnmociodopDeauei t)trurxr oo4ap  mfeiat)arumxro;u1tlxomo3iadlm elnmp;t4 eerxo ty1op r neolt0t2xm(r3oy4lme lies tfs2trxmpou4tpenmfetas s eanms (0tltnioctydlp  ln s;( t2trim3oudaleelnvs sf 2tm(moou4alxnmoctysfm2umums;u4trtoifcootom eauesls)trxr(r3nydameelictat)a2ua(mpot4tpeniociysls rmumont4arxnmrciy1omte ivs;t)teumir oo4omtnmict (  2tm(rp;t4altnmietadla2ulnvp u)tlerir tatlmDraivsl() ruoxm3iy4ap  mnvtlt sDrrx  nu4apt ii3iaslm2ranvsnu)altrifctydlmtrlneils0sruoimpoydam n net (  2raumo;t4ole  i3iltla2ua(ms t0trtnmf tadop e n i;s  2tmirpoodll nmncsltfsrrax oou0oee  o3tlsls2eauvp u0 ltnmfciatfa e uvi (0srxmir no4ameelfet t)aDuaxroot1tlt  fciytfsDuln o u4 rxnmo oytfmD lneo;t0srurir3oudlme livs s  2ra(rp;o1tleoiociatfm2ua(mp;u)teerxrcoatlmDr nei (0sexrxrpoo1alee icsa(  ruru  ou0alxomoeias m ra(mo;t)trtnio oodoptranvilt)tetoxm3iydlpt mieils)srumumpou1apen oeilsfa2uau pnu0texnxr ootoaDe u o;t texrxr3iodlltelfciasf rrmxr oo0tet miciytfm2eauvp;t0aeeoxr iadla eaues;( srum(m3oo1ol emfvsatfs2umxront1tex  ocild sDemu p;()trerio3totopt aiesls sexmir3io4olen fei tfs2ua(ronu1oeeoif3tatlsDeaump ()artrir3oo1fp elieo () eumxmpno1amte fviat)s2rrx  ou4aetniiciatlsDulnvp t4 lxriocta1fmD  ues;t  ruo(m nodolenlicil(fa2ra(m oo0tpen oeiyt sDem( sn() etrmfcoytlp rauei t0 2toxrpiy1ole  icsls aDumu o;u1tetn f3ildlmDuaumpn()aeeoif tydlpte ivo ( s2uoxm oudomt mncia(fs2uru ont0aex  fetas a emums;u)tlenmf3iy1oa rai ol(0 rxm(r no1aptemfvil( a2uax o;o4olx  feilsla2el( s;(0 rxriociydla   iei t)trurxopoo1lleeliesas)sDtm(rono0tptn oeiat a umumpnu)arerioctadopDeaueols0seuoir3ny4lmtnmnciatfsDtaxroot4tet mieiydfs2rmu o (4altrio iytfmDelieo (0trtoxm nydlp nlfvilt) 2ur(  ;t4texomfctldla2rlnms u0tleomocootlpD  uvo t0 eurxr iydop emnvtls) rta(r ;o1aeeoif3ild a umn snt)arxnmo3iotfpD li ol( trurxr ny4lltnlneil() 2ra(rono0oex moctyslsDuau p t)arenir oodlateln s ( trtrxr oo4omt lnetas) Durxmpoo4tetoiictasfa2rln o (4tetnmrcto1oa rlieolt) rxo(mpno4omeemivs (  Dur(roou4opeomietat a2uauvsnu0 rxnxfcto1lmtranvo t)seurim ny1om nlnctls s2rru ont0ope ifciytfm el( p;u0arenir3tydomD  nvi;()trtriopno4olte neil()aDumum ou0aeeo fciaslsDrm(vo;t4 ltrmrctydfm elnvo s)sexrxr3oo1amtn ieta()aDtaxmpoo0altn oeild m uanvpnu0 reoxf totom  lneslt trxrimpiudameemncilsfsDtr(m oo1alx moctad m emn snu0 reoir ootla e u s;s s2xoxo3iudlptn ivtls)sDra(  nu1tex iiciatfaDrlu onu0 leomfcootomteanei;s trxr(mpiudame  fvt t  2umumono0opxn ictytfm2ul(mp;(4 lerxfcoo1omteli i ()seuo(o3oo1ameemfcias)sDtm( o;u1tleomi3tyt s eau p u0 exoir3ia1opD aneo;s)s2umirpnu1op nmfcil()artruront4aexoio3tasfaDua(von(0aleoxf ia1latr ivi;()trto(m oudomee nvsltf Durum nu0tex mfciasfmDulnvs (4 leoxo3oadlpDe ies s t2tmxo3iy1llen feil(f rtr( oou0alen i3tydla2eanvpn(0aeeoio3oydlp rau o;(0srxrim3io4ll   fvtl( artmxr ;u4apenioeiysfa2umuvp (4arxrmo ta1fptr n i t)sexr(r3iu4al n fvslt arrmurp;o0aeeoii3tytfm rmnmo;u4trtnifctatlmt au i;() 2toiopoy4ape mnvsl(f rrmx pou4aptoii3iys m2ul( o;t4 ltrxr iy1fmD aneol(0 eur(m iodaltemneta()sDurur ou1aexnif3iydfa uauvo t4tlxnxrcoa1lpt lneslt seuoxo ou1al nmfes t a2taxmp;u1tltnmoeiysfmDel(vs;(0tltrxfciadlp eln s t0 exoimpiy1omte fvs ()arurx  ot4aeeo ieiltfm2um(monu)trtnxo oa1op  aieo ( s2xoio3oydlle  ncs (f rrmumpou0alx ii3iyd m2el( p;(0 ltomf oytomtr i o s)t2tm(m nu4omtemfeilt)sDrrxrp;t0aptomf3iyt s2emn pn(0 exnxr3ootlpt aneilt0s2uoir3nu4apenlfvslt)aDtax  oo4tle ifeilslmDul(vp;()altrio iotoptrlu sls0setr(r3iu1lmte nci (  2rrx  ;t4ale if3iadls ranmsn()teenmrcoatlmDeaivo s) rur(o3nu4al  livsls)s2tmurooo4tleomi3iatla2emums;()altnxf ty1oa e n ilt t2uo(r iy1ame  net s) rrrum nt0optnmfeiaslmDeanmo t0 ltrmf tatop ranes;s0t2toxo oudlmtemnvs tfsDrrxr nt4tee  i3iaslm2em(mpnt0 renif3totlp  an o () exoxm3io4lpe lfeta()srtmxr ;u4aptn fetydla2ra(mp t0 rxoxo ia1fmDeanvils  eur(r no1ameelivtl(faDrr( pou0tetn oeiysfm2rm( on()trxnmf iy1opt ai ilt0truoio ou1olt mnvt () 2urx p;t4tpen i3iadls ranvont0alerifcta1oat aivilt0 2xr(r3nudale mfesl()arrr(m ot0aexo o3ilsla ul(mo;u4aeenif ootoaDeli o;t)trurxmpiy4lp  mnvilsfarra(m ot0tpt mi3tytlsDel(vpn(0teerxrciodlmtean i;(0tetoxmpiy4lpe livtatfsDtru  ;o0oleoio3tad mDuan o t0aeenmo oatfptrlnvolt0texo(m3nydolt  ies t)srtmx  ;o1tlt  fctatfmDrm(ms (4 etoiociatoat lnes ()t2xrim3oudamtnmfvta(  Drrxrpnu4apt ii3ilslm ulu s;(4arxrmo3tytoaDrai s;(  2umio3oo4lmeelnei ()a2um(mp;u4opx ifeiys m el( s;t)arxnxocoy1oaDeaueils  exrxm ny4ll elnvs (fsDtr( pnt1teeoifcilsfm2rlnvp (0aexnifctotopte nvs t)s2um(rpou1lmtemfes ( srtmu  nu4tpto i3tltla ea(mp;u) etrxr3oo1faDr nvs t0 2tmxm iy4opee fvsl( aDtr(mp;t4oee if3tasfs2rl(ms;t4tetnmf io1oaDe iei t s2umimpnu1lpee ies () 2umxrooo1olxoiocilsfa uln s;(0 eeoxo3ia1lmt an s t0 rumxr3nudomte nvias  rur( oot1tleniocilslmDumn s;(4alxrif3oa1lpDr nes t)srurxrpno4oltemneils  rtauront1altoiiciydls el(mo ()trxnmrctytfm e uvo (  2ur(o3ou4lpe lfetl( srua( oot1ale if3tltfsDraumsnt)tlxrmrcto1omD ai slt0trtrio3ny1aleemieils  Dum(rpot4aexniiciydlaDum(ms t) lerxf iotfpteau ols) 2trimpiydomeelivtlsfartaumoou1aleoifctltfa2ea( snt) etrifciy1optelues;s) etr(rpou1lmte nci tfa2raum nu0aetnmfciasfa2ulnvsnt4tlxomo3oytoa e nei () eum(rpnudoptn icil(fsDumx  ;t0ole  icildfm2rlnvo () ltnif oadlatelu i;t0seuoir3iydamtnlicia(farur(r no4altnio3iaslaDranvp;() lxnxfctotlpD  ivols) rxmimpoy1ll nmfctas)s2rrum ;u0apt ioetldlmDrm( onu4artrxf3totlp r i i (0 euoio3io4ll nlfvtl( artaxm ;o4tlto f3iadfaDrln s t4aexrif3to1opDrlu ol() 2um(r3oydalenlfciatfsDum(rpnu0aetoiiciad sDeauvo u)trenmocta1oate uei;()trxmxrpnudoltnmnvs ( srrax pnu0tptn fciltlm2ulnvont0trxoxrcoodoa ranvils0trumimpiu4lp   fctas  2urxrp;u4ape mieiytfa umumpnt)arxrxo io1opt  uei t)trxrxr3iydomee ncsl()srumxmpoo4opt mo3iadlmDulnmpnt4 etnir3oy1fmt luvo ( tetrim3iudomt  fcias srrr(ro;o1alxnmfeiltfaDul( o;u4arxnxr oadlpDelivi () etmxo iu4lp emiei (fsrtr(rpoo0oetnif3iyslm ul( s u)areomr3oodlptelnes;t)t2ur(r oo1am nmfei t)s2ururo;t0tltnioctltfa2uaumont0tlerxr3todlmt aueol()trtoxo3iu1lptemfvtlt sDtau pou4tlenmociaslm el(vo;t4alermo oodfmtranvi;t) rxm(o ou4lpeemieiasfaDtmurpou1texomfeiatfm eanmo (0aeeomfcoatlp  aieo;s) 2tr(o3oydom emfet (fsrtm(ro;o0alxomiciat a ea(mo t0tlxomr iatfat  nei s)setoiopou1amte nvsl(  rumurpnt4oeto i3tldls eanvs () rerifcoytlmteluvi (0srtmxopiu4aleelies s) Dtrumooo0oet ioeiydla elu p (4arxrmo3iatomDeanvo;t  etrxmpnu4open fcsatf Durx oou0altomo3iyd m rl( sn(0aetomr iotfmt luvo;(0sexm(r3oudomtnlfvt sf 2umur ;u0tptomfeiat a2umn o;u4arxoxf iadlm eau i t0 rurimpoodlleeliesls s2ua( pou0tetn iciaslmDel(ms u4artrmf to1omtrluvil()t2uo(rpiu4lp  lneslt arum(moot0olxo iciysfa2rmums;(4tlxrmf3to1op elues s0 rtmxmpou1al nmiesltfarrrx pno4apen f3iasfs2rlnmp;(0 lxnxr oodfm rauesl(0truoxm3no1am emfetls)srrrurp;t4ape mfeiytfm eanvs;u)arxnirctydoat lnvsl( s2toiopoydom elfvtasf 2tmu  ou4optoio3tydla2ea(vs;t4trenxr3iydopt auvs;s0t2xo(opoo4lp emivsl(fsrtm(mpno0tpe iieiat sDrau s;t) exnir3tatfpt luvs;s0t2uoxm no4ll  livs t  2tr( oot4apxoio3tyt mDrmumo;u) exoxr ty1faDe ues;s0 rxr(r oo1olenlfcsltfsruaumpot4texo i3iad mDem( p;t0 eeoxo3tytfmtrai s t)sruo(mpnu4ap   ncils  rtaxrooo1olt iietls s2em( p;u0aexnmo io1op rlu o s)s2tmxm iu4ap  lfct s s2rmu pou0olxn f3ild a elnvp u)alerif3totlatr n i;t)sexo(m iydop  lfei s  Dua( ono0tpto ieiadfs rauvont4 rerxf3to1lateaivolt  rtmxo3nu4olen nvi () 2tm( o;u4aeeo ociad a umn s (0trtnxfcoytopDrai i;()t2uoxm oy1aptnlnet tfsrtrxrooo4tee  i3iat a2um( s ()alxoiociodfa   n s t)s2uoim no1alt  iei s)arurxmp;u4ale  iciadfs uau o u0 exomo tydfateai o t) eurim oo4ap n fvta()s2tm( o;o0ape micild s2ua( p u4aeenmr3todlaDeanvol(0srxm(m3oy1llenmivsls)arur(m ;o1olenmi3iatfa eluvsnu)aetrir3tytlmt aiei;t  2xr(opiu4lmtemieil(f Draumoot4apx  o3iadfsDrmums u0 reoif iatlm rlu s s  rxrio ny4al e nvils)srumurono0openifctlt a2ul( onu4tltrmo totlpDr ivi s) 2triopnodlpenmictas s2tr(r ;o1olx ifcilt aDelnvo u4 eenif oadla raiesl()trurim3nu1lleelfvsls aDumx oot0olxnifeilsfs2uanmo;t)aeenmo iadfm elu o;(0s2umxmpno1am emfei s s2uaurpot1olxniictls a rmnms (4 rxnif oatlmDrli ils)s2umxm oo4lmt  ieta() 2ta(r ;o1opeo o3iyslm2rauvp;u4trermrcoadfpDrai s (0texoirpno4olte fvsasfsDum(  ;t0apx ii3iyt s2raums;(0arxrio to1faD anei t) rurxm3ou1al  lnvs t sruru  ;o4aexoifctatfa2uluvpn() rtrmfctydlm eanei () 2xrir3iodop   nvi ()aDuaxmp;t1alenmo3tys s um(vo;t0trenifcoa1omt luvi;t sexrim nudamtnmfeslt aDur(rpno1tetnifcilslaDulu p;t)tetrxfcoa1la e iei;s) exoiopoy1lpe  fvtls) rur(mp;u4aeto oeiysfa2um( snu0tltnirciy1laDrli s ()t2toim3iy4ameelncs () 2rm(  ;o4tpxnii3ildfm uluvonu0 leoxf3io1fmtelnvils0 etmxmpiydope mncs (fsrrr( pno4tptn oeiyd a em(vs;t)treomoctytfaD  uvo;s srtm(mpno4al   nvsl( sDumumoot1tlxnifetydlaDrm( s;t0 ltoio3ty1opDran olt seuoim iy1lle lfvtlt srrmxm nu4aexo fciatfmDem( sn(4 eerxr3iy1opDeau ilt0srxo(mpou1ameelneilt)arraxr ot4tle mfeiad m2eln s (4arxnxr oydfaDe nvs ()sexr(rpno1apenlfetl() ruaur ;t4tpenmi3iadlaDulnmo t4texrmr3oydoaDe uesl()trxrir ou1ol nlivia(  rtm(r nt1altoif3tlsfm eaums u)arermr3oydomtraieo s)seur(r3ou1om  lnciat)arum(root4tlx iieiydlm2rm(mp t4 ltnir to1lp eli o;(0 exoiopiodop  mfcta(fa2tmx  oo4aetomictasfaDemnmon(4 etnxo iodlmDraues ( srtoxmpoudalt  ietat)sDuaxm oo4aee  i3tytla elu snt0trxnmo oytfpD au sls srtr(mpoudam n ncil(  Drmx oot0alxn ociaslm2eluvo;()aleomfcoytomteaneo;s)setm(rpiu4openmnvta(faDurx  ot0oexoiieildla ea(vsnt0altoxfcoydop  aivils tetmxm3iudoptn fetltf rtmu  nu1alxomfctatlmDrmn p;(0trxnmo iytopteln sls) rur(o no1amtelfeias)sDta(mpno0tlxoii3tlsfm uan s u4 eermf oadlpt lu i;()srtoxr iudomeelnctas) Dtrum nu1tetnii3iatfsDemu o u)tetrir3tadom eanvo;(0trumio3oudom n nvtasfsDra(mp;o1tpenii3iysls emn p;t0arxoxo oy1lm eaivo t0trxrxm3ou4omtnlicsl(f 2umxr ou1aetomo3iat s2um(vp;u4 ltomf3iy1lm e u s;t)seuoiopiu1lpt mivilt)srrr(  ;t0openiictlt aDuauvp (4artoxr3iy1la elueols  eurxo no1am  mfvsa()aDrm(m nt4oeen ieiatfa2ulu p t0 rtrxfcta1lmt lues s0 rtr(m3no1lltemfci (  Dua(r nu4tlx  ieiad a2ea(vs t4alenmr ia1fmDr uvi;t sruoxo3ou4lmtelici s) 2ra(  ou0alxoioetatla2ul( s;(0 lxoxr3oo1fpt auvo;(0t2tmxr ny4lm e fcsatfsrta(rpou0alen octatfmDrm( o ()altnxr3oa1op raueo;(  euo(mpiu1lltemfvsltfaDrmur nt0alt  fetat s2rmumsnt4texnmr3io1oatraiei;s0trtr(r3io1ole  fet (  Drau  nu0tlxomoeiysls2uln p;u0 etomocty1faDe nvol(0trxm(m3ny4lm nlnes sfa2tmuronu0aetomociytls emumo ()tlenmr3iodlpDelnesl( t2uoim3iodam n nvtlsfs2tr(moou1tpxomo3iatfs2emnms t)texomf3totomt  iei;t t2to(o3no4alt mfcs ( arua(mont0aee  octldla rmnms t4treoio3iodlp rlu o;s)teuoxm ou4lmeemfvsatfaDurxmono4opxo i3tls mDel( o u0trxnxrcoydlaD  iesl(  2xoio3nu1alen ieil(fs2rmu ont1opxnioctysla2em(msnt)aeeoxf io1oateln ols s2um(m3ny4oleelfcs (fartrumooo4tet mietlt a2emumo (0teeoircootoaD luei t srxmxopou1ap e ivsls arra(moot0opxn f3ilsfm emuvonu)trerxr oadlm   nvslt  2trim oy4llee fci t  rtm(mpot0alxn o3iadla rlumpn(0texoio3tytfpDrluvi;t0 rum(o ou4ope  ieias)sDrr(rp;u0alxn feilsla2ulu s;(4texrir3oydlmt  uvsl(0s2xoxm3oy4op nlnet ( aDurum no4optn fetlslm rluvonu4 exoiocio1lmt  n s;(  2toxo3oodlltnlnciatf 2uru pou0tpt  fctat s ea(vsnt) rerxocoodfpDraivslt0tetmirpoydap nlictat) rraxmp;u0tetnif3ildfmDea(vs t4altomr oa1fatraiesl( tetoxrpiydoptn ivt ()arumxrp;u1oleo iciadfs rluvo u0 lxoir3ootoat livo t0trum(mpoy4lltnlncslt sDtr(rpno4aptoio3iyslm2rmu p t0trtoif3io1op rlueols  2xoiopnu4al  lictas  Drrxmpot4aeeomicild m umn snt)trermocoadomte nvol()teto(m3oy4om emivsat)a2raxmo;t4openii3tlslm um(ms;t) eenxocoydlpteanvolt) exmir3nu1om   ivtas aDrr(r ;t0tpxoii3iatla rmums;u)teermfciadfmt lies (0seurxm3ou1ll emietat) rtrxm ot4tpe mf3iasla em(mp t4teerxfciytfaD anei s)trurxrpoydaltnlnvtls) Durum ;o0ape moeiydfm eanvonu0aexomf3tadop  an s t s2xrim3io1lmeelncsltfs2rau o;o0oetniiciasla ra(mo;u) ltnxrcoy1lmt aneo;s texmim iu4llen nesatf 2um(  ou1open ietat a uaumo;u) rxoxf3to1fpDelnvo;s0s2xoxo oo1amtemnei sf Dum(m ;o1oeeomfciydfs2emn p;t4trxnio3oo1fptrlneo;(  ruoxr3iu1om nlfvias  2tax o;u4open oetaslmDua(vo u0aexoir3oatom e ivi t0 exmxm oo1lpe  feiatfaDur( oot0tptn oeildfa umuvo (0 exomrcta1lpD  n s () exoir3oodlm nlnesl(fsrrmxm ot0ape io3tys m2ean o;t)trxomo3iatom rlu i t0 2um(rpnu1lp  micsatf 2trxrpou4tle ifciytfm rlums;t4arxoxo oytlp   u i (0setmxr3nu4ope lnvt s artmxmo;o0aeenmfeiydlm ra( o;(0arxnxo3ootoa  auvs t sruoimpio1olen iviat)s2ua( pno4apxoio3ildls ua( p t4aetnxo3ta1opDr nes;t0s2uoim no4lpeelnvtatfarrmxrp;t0tpxo ieiat mDelu snu0 etrxociy1lpt au olt) euoxr3ou1lme  feias srrmx onu0alxoifetlt m rmums u)aeenir3tytlaDeaieslt  rxo(m3oudllt  nvt s  2tm(monu1opx mfctls mDrmnvo u) rxrxr ia1optraues;( trtoxmpnu4apenlnvtls)s2uaxm nu0olt  o3iatfm2ean o;u0trxnxocoydoate n ol( s2uo(r3nodlleelfeil(faDrrur nu1oet mieiyt m emn sn(0tlxrio3iadopte uesls) 2xo(mpnu1lmt lfcsas)aDuaur oo4tlt  i3ilsls2ua(mp u0 rerxocoadomtr uei s) rxm(opiy4aleelfvta() rrr(m ;o1opt ifcils sDranvpnu) rxomociy1fm eln ol(  2xm(mpou4lle lfeiasfs2uau  ;u4opxnif3ildfm ra(mo;u0trtnio3iotla rau ilt) etmxopoo1lltnmfvsas  Duaxmont4alx  fcild m rauvs;u4 rxnmociotomDrlnei t0trxmiopou4al nlfei ()srtaum no0olxoio3iydfs rmuvo t0arxnmf iadlatraueslt)teumiopoo4omt lfvt s) rum(m ;u4altn iciydfm2ulnmonu0trtoir3iodfm e nei s  rxoxopno1lmt mictl()s2um(mp;t4tlxn i3tydls2elumsnu4 lxoxo3io1fm e nes;t0t2toxopiy1ap   ivtatfsrta(mp;o1ale mi3tas sDrl(vont) rtoir3totoat anvo () etrim3nudom n fvsat aDtmxmo;o1aeeniieiyslm eau p;t)trtnmo oy1lpDelneo s) eumio3iy1optn feil(fsDua(r ot0tlt  fctltls emnvsnt)artoifctydfpteln o;s)teuoxmpou1llt mfvsa() Dtr(rono4opxo i3iydlaDra(vpnu4texrifcoodlp e n o;(0s2ur(o3nydaptnlivsat  Dta(root4tpx ifeiasfs eaumo (0trenio3iotlm eluei;t0t2xmxmpno4oltnlfvsl(f 2urxmp;u4tptomo3ilsfmDra(vs t4 exoxrciatoa e uei s)t2toir ou1op  lfvtat  ruaurpou1oleo ictatfa2ulu p;(4alermo oo1oa rauvi s teuo(rpny4alen fcsas sDrmx oot1alenmoctlsls ul( pnt0 rtrif oatoptelnvolt0srtrxo nodameemfcsltfaDumxm oo1tpxnii3iyt sDrm( ont4aleoio tytlmteaies t)t2toim3oodlpt  fcsl(  Duaxrpnt0oetomo3ils aDulumo ()treniociytfpDrlivs (0 eumir no1ame  nei (f rtr(rp;u0aeeomiciysla ua(mon(0artrmo3oy1lm eaueols)s2xmimpiy1open ivt () Dua(  oo0oeen o3tlslsDumnvo t0 renir oytopDrln o (0 rxoxrpnydlpe  fct () Dum(  nt1apxnii3iadfs2emn o;u4aeeoxr3to1fmD lneo t s2to(r nydam e feiatfaruaxmooo1opxomo3ilsls2rmumo;t4alermocootom  lu i;t)teumirpou1omen nei sfaDrru  ;o0aeen ociltlsDumuvs;(0arxomoctatoptrai sl(0 2xriopny4lmtnlicilt srtmuront0tpe  f3ildls2umu o;u4artnif3iy1omDelieo t0srurxm oy4lpte nvsas)artmxr ;u0texomo3iasla em( s;(0 ltnir3ia1lp eai o s) etoxr oydaltn fcsas a2rrurp;o1olx micilsla2umn s ()tltrir oy1oaD luvo s) euoxmpno1aptemfvia(fsDra(mp;t1oltnifetatls2rl(vpnt4 lenmrciy1fm  lnvo;t)trum(mpoudlp  lfcias sDrrxront0oet mfeiydfa2uln s ()artrxf ta1faD  i o s)texrxmpoy1ale lfci ( a2rr( pno4olx  iciyd a uau onu4 eeoifctodfaDelnvi;( srxoir3iy4opt  netlt s2urxm nt1alt ioetyt s2rln ont)aetnxocoo1oaDranvs;t)tetm(m3iodllt micta(fa2ua(mp;t0olxo feiasla emu o t)alxrxr3oodomDe u ilt0 2tmim iy4lp n ivsatfs2urxront4oeto fciadla2ranms;t0altoio3ty1fmte uvs ()teumxo3iudlmen ivsasfs2rru p;u1teen iciyt sDrau sn()texnmr to1fmte ues (  rtrxo3iy4ap emieias aDumxmoou4tlt  oeildlaDrmumo (4teenif iydfatrauvo;s0s2xoim ny4lp  lncs sfarta(  ou0aleo feiadla2rln o;t)trxrif ootfa eli ols0trur(opno4lpt mfcslt)arrmxr no0oeto i3iysla2ran p;()aexoir ty1lp   neo;t) rxm(mpoy4apt liet (fa2tm(mpot4olenmiciadfm2uanmp (4texriocoo1fmtr nei s  2xoiopiy1ol nlietlt  2rm(r nt1tleomo3iasfmDrm(vp () eenifctotfaD  u sls)seum(o3iydomeemnvs t)arurx ono0oex  ocias m2em( on(0 exoir iotop  luvi s  2xr(r ou1alenmfvsl()a2rrumpnt1openifetlt sDrau s;t0aetoxo3iydfmteanvs t)setm(o3oydol elnvsat aDraumpno1olxoiiciydlm2emnvs;(0 eerxo3oy1om elivi (0 eur(o nudlptelietas aDtrxrp;o4oetnioeiyd aDulu p u4teenmocoa1lp r neo;t s2um(o3iudop nlfeslt arrau oou4aex ioeiat m rlnvo t0 rxoio3oytomD lu i;t)trtmxm3iy4ale  nvi (f Drau pno1tlx mi3tatls uau p;t)trenif oadlp r n o;()t2xrxm ou4lleemnei (farumump;u4tee mfetyt a2rlnms;t) rtoircoy1lmDean olt)sexmxopoy4alt lfci tfsrrmuro;o1tpxo iciysla2emnvp (0 rxomo oo1opDe ueo s trxmirpny1lm   iet t) Dtrxmpot0alenmi3ildfs rlnmsnu4 leomoctatoaDrlivslt0trur(o iydolenmfesltfsDtru ont0oexoiieiltfaDraumsn(4aetrxr3iydoptelu o;( seuo(o3oodop emies tfarrrumoot4tet mictydfsDrln o;(0altoifctatlaD lnesls teur(r iodomeemietlsf Dta(rp;u4oeen o3tydfmDrmumo u4arenifciy1lpDean slt t2umimpiy1op  lfvs (  Dra(mpot4optnifeilt sDuauvs;t0 lermf3iy1omDe ivi s0s2urxr iydoptnlfvils a2ra( onu4apxo ieiytfa2emuvsnt4alxoxr3iadfatelu ols0 rumxrpnudoptemfcslsfarrmxrpoo4alxoii3iyd a2em( o (4texoxo3iytfm ran i s0t2xrxo iu1om   ici ()sDtr(mo;u4opt  i3ilslm eaums;u4arxrmf3iytoat  ueil() exoim iy1omtn ici (fs2uau  ;u4alxo fetltls2ea(mon(4arxoxr3todfpte uvsl(0 2xrxo iy1op emics s)srua(ro;t4tlenio3iyslmDul(vpnu) rxnxocoatfpt  ies () exoxopoy4ol nmiet (  2rmx pou0aeenmfciyt a ra( on() exrmo totfaDelnei ()t2um(o iy1llenmieiatf 2uau p;t4apt if3iydls el( pn(0 etrmrcoydlm eanvils  2urxrpoudlmt lies ( arrmu onu4tpe mf3iytls emn o ()aeeoirciydfp r i o (0seuoxr nodomtnmfvi s)a2tax  ot4aexo ietadlsDraumpnt) exnifcto1fmtelnvo s0s2toxo3ou1am emics ( aDurumpno0tet ioeiyt s2uan p;t)aeeoxocio1fp  anvo t) exrxmpnudal n fvtl(  Duaxm ;t1tpenmf3iadla2ra(vs u0aeenmf oadlm  lnvo;t0trtm(r iodapt mnviltfaDumur ;o1oeenioetydls2rmuvs u0trxoxo to1lm r i o s s2uo(opoudoltnmicta()sDrmu pot0teen iciad a rlums;t0artnif oo1lmD lnvs;t trtm(rpoy1lpe mfciat  2uaxr nu0aleomieiyt m ra( pnt0 rtoxoctadfp r ivo (0 2tmxr3iudom nmnvtlt)sDrmum ou1oetnmictys m2um(mp;()arxnmfctydomDelnvs;t texrxr3oy4om  mfesat)artm(  nu1oltnif3iyslm2rmnvpn(0altnxf totoaD lnvi s)setmio3io4apt  iesl(  rrmu oou4oex mfciadlmDrmn p;u) exnir3tatoatr u ilt0setrim no1amtnmnctltfartr( o;t1apenif3tltlaDran o (4teeoif3ootlp  lnvo;s)s2xm(rpoy4lp elivsa() Dum(root4teenmoctys s um( s;(4 ltrxr oodlp   uesl()sexoxr3iodome  ietltfarta(root1tltn i3tld sDea(vp u4artnxo3tatfate u s (  euoir3iudopt  nesltfsDumuro;t4tet io3tydfa2rm(mo;(0arxrmr3ootlpDrli o ()t2trim3iodameeliviat sDrru pnu1olto octldls2eln snt4altomf3iy1fpD livi t0trum(mpoy1alenmfvta(  Dum(ronu4tee  i3tytls2ulnvpn(0alenxrcoadfa eln i (0trxoim io4oltnliei sf 2rru pot1alx mieiys m el(msnt0 lenxr3ty1la eln s t srxoim3iu1op elfviat s2umurp;u4oee  ietadfa2ul(mp t)artnxo oo1lp ran sls s2xrxo3ny4lmte netat) rta( pnt1oet ioeildlaDelumo;(0 exrir3oo1oa   u ils0truoim ny1al n nvt sf Drm(r oo0oetomiciysla uau p (0aexoxrcoatoa r i o t  rxo(m iu1olt liei t s2rrumooo0tpe iieild a emnmp;(0aeerxfciydlatrau o t)tetrio3iu1lptelnvt ( aDrr(ront4aptn i3iatfmDelnvo t) exrir oa1oat lu s;(  eur(mpnu1ap   nei ( sDua(ro;u4tlt io3tydfaDrmn sn(0treoircoa1fmt auvo (0setoio3oy1am nlnvias  2ua(ront4teeomoctyd s2um(vo (0tltnio ootomte i ils s2uoiopoodlmtnmivt t sruaxr ;u1aeeomfetyd a2emumo;(0arenmf tytoa eaieil(0 etoxrpiu1ol e fesa(  2rrxm ;t4tee moeilsfsDra(mp;u)aetnxo3tatlaDe iesl(0s2toxo3no1lp elnvtasf Durx ooo0alxomo3ilt a2ul(ms t0aexnmf ootlaDrau il(0 2ur(o3no1llenlicsatfsDtaxm ;t4tpx ifeiydfs2rmnmp;(4 etomrciadoaDe ueols sruo(m oo1oltn ncils) 2urur nu1aeeomi3tydlm2rmnms;u0 rtnxf iy1om rlivsls  euoir iudole mnet ( s2tm(m ;u0tpe  fciatlaDeluvs;u0aetnmociadfaDrauei;s truoir3oy4lp elivilsf 2rax pot4oltomoeiys a2emu p () exnxo oydfmD  u i t  ruo(r3io4opt lfviat  Dtrx ooo4tlxomfciytlaDrm(vsnu0aexrxfcoa1lptrau i t) rxr(mpiudlpen icia(f Duauronu4tpt ifeilt a2emuvsnu4aetnif3tadfmDraivo;t  rurir ou4amtn ivsas)a2ta( ooo4apen f3iysls2ran o;(4 lerir3iodfa   nei;t teum(o3oy4ol  lneias  ruax  nu0aptoiiciadls2ea(monu0aexoxf tydlmtrlu o s0srxrirpio4ole  fctlt srum( oou4opxomiciadfs2raums;t) eeomf oytfmt li ols)srurir3ny1ll nmieiasf Draxr oo0tpt mo3ilslsDuan s;u4teerio oa1la  ai sls) 2umxmpnydlmt mnvs sfsDtmumpot1altnif3iytlaDua(mo;(0artnif todfaDeaieo ()s2tmxmpnydaleemfet t sDtr(mont1tle moeiyd a ulnvo;u0aetomrctytoaD ai sls srum(mpnu1am e fcs sfsrurumpnt0aexn ociyt aDrlumo;u0arxrxociatfpt  uvi;s0texrxmpny4lm  mncs tf rrax ooo1apxomoeiltfs umuvp;()aleomr3oadlpD  i slt0 2urxopno1lpte ictlsfaruaxrpno0optnif3iltla emu sn()trtnmfciy1fpt li sl( t2toxr3oy1opt  ictlt)aDtaxrp;u0olen octaslaDel( snt)alxnxocto1fm   ueo;()s2umxr ny1amenmfct s a2rax pot0alxn f3iat sDuan snt)tetrmociodfmDeaieolt  2urxopou4apee neta() 2raxm ;o4tee mo3iltls2eln p (0 eenmo to1omD  ivs;s sexm(mpoo1om n ieslsfaDtr(rp;t4opxnmf3tydlmDemnvp;(4 rxnxo3iydlp e i i;s trumxrpiydlmt liei t)s2tr(roou1oet  o3iatls el(msnu0altoif to1faDraneols) rxo(r3iu1op  lnetlt  2tr( p;u1oltn i3tld a2el(vo t)arermfcia1fpte uvo s  eurirpnydll nmnvt tf rtm(mo;t4tlt  oeiytls2ulums t) eeoxr3iy1lm e nvols) 2xrir no1ap emncta(fsDtaurono4tltoif3iatfa ea(mp;()aeeoxr3iodoptrli ols)t2tr(m oodom nlfeilsfsDrax  nu0tlx ii3ilsfm2rmumsnu)texrxrctytopDeai olt) 2um(opno1al   neilt) Dua( pot4ope iociytlaDrm(mp u4 exnir oytlp elneo;s seto(mpio1lleemnvsas  2rrumo;o1opxoiociytls2eau s;u0alxnio oa1optrlieo;t0sexrirpny4altelncias srua(rono0aleoii3tyd s2rau s ()trxnxo3todfpt ai slt srtrio nu4apt mnct t sDumum oo4teeo oetldlaDelnmo;u)aetoio oo1lm r nei s0teto(o oodape lneslsf rtmx p;o4tpeniiciyt m emnvs u) etomf iotop   u slt)s2uo(r3oo1ome  feilt  2umur oo0tpe io3tltfs2emnmp;u0trtrxfctatfptrli i;()t2xriopnydomtemnci s  2uru  ou1teto feiatla ua( p;u0texnmf3oatoaDr i i (0trxm(rpoy4am  lneiatf 2tax p;o0tltoiieiydfm2uaums u)aexrxr3ta1fatr u o s  ruo(r3nydlme lnci sfsDrau p;t0oetnif3iltfa uanms;u0 exomoctotfp rlies t0tetmirpoy1ale  fct s arrrxrpoo4olenmfeiys s em(vo () ltnxfctadop   n i;t0s2uoirpoudam  lnci (faDrau pnu4tptomietadla ua(mp;u)trenir oytoaDrli olt srtoxrpno1lmeemivs tf Dum( pou1aetniictydla umnvs;(0 exomr ootfm   n s;t)t2umxo3ou1lptnmfeil()srrm(mono0apeoifeilt sDem(mo;t0texrirciydfm  lneo s0 exrimpoydlme lieia()s2tm(mpot0tlx  feiltfm emnms;(0aexoif iy1opt  iei (0t2tr(r io1lp e nvsl( arrru ono1oet ii3iatfa um(vo;(4tetrxf totom   n sl(0s2urxm3io1ope  neilt) rtaxm no0aee  ociat mDum(mo;t4texnio3io1opD anes;s)t2toxr oy4lmtn neia( aDrr(mooo1opt mfeilt aDea(mp;u) rxoxr3ootopDeluvs () rurxm3io1ape  fcs sfa2tmx  ;o0aexo ietad a2uan s;t4 etoxo oo1fmDe neils t2trio oodlp nlici ()srtmxr no1open o3iyslsDem( p t) ltnxo3oodfaDrlnvi;(0s2xrio3no1lleemfcs s) rumx onu0opxn f3tyslm emnms;t) rtrir3io1oatraivo s)s2xo(m iy1opte nvi tfaDuaxr ou4ope  ieiadlsDemu o;(0altomo3oy1opt  ivols) rtrir3iydlm  lfvi s  Dum(monu0alx iociyd sDrln o;(4texrmf ta1laD ai o;t t2umirpoodlptnlnctat)sruaumono4alx io3iasfm uau snt4 leoxo oadfat  n s (  eum(o3ou4lmt  ieils  2tmx poo0apx  ociysfm2umu s (4arenxr oytfmDrlnesl(0srtr(o3ou4op e fct t) rrmu pnu0teeoiieiltfaDranvonu0teermf3ty1fpteaieslt0srxmimpnu1oltnlictat)sDraxmpot0opx  f3iydlsDelnmpnu)aetomociytom eaieo s0 2xr(o oo1omte neslt a2uaur ;t1opeoioeils a2uln o;(4alxnifctodlp elnvs;t) rto(r oy1lltemictat) Dur(moou1tet mietatlsDulnvonu4 lenxr3iytfmD livs;s seumxm3oudllt  fvsl(f rtaum nt4openifciad mDelu snt0 reoxr3ia1fmDr ivs t)t2to(opnydlpt  nvi ( a2raump;o0tlen i3iyslm rmnvp;(0tlxoxf3ia1oateln o;(0t2umxr ou1lptnlfeta()a2tau  ou0ope mieiat m2raumpn(0tlerxo3todlmD livo;s t2ur(r3ny4omt  ici tf rtax  nt1tptniictad m2rln o (4 exoxo iy1fpD  n s s t2um(opno4lp emfctlt)sDraump;t1oetoioeildla ua(mpn()teeomr oydoate nei;t)truoxr3nydop  lfciat s2ur(  ot1ale mo3tltla umuvont4arenif3to1fpD lnvs;(0sexoxmpny4opee ietat  Dtm( p;u1oex iieiys a2ua(vp t)aexnxf tytfa  lneilt)trxo(r3iodlleemneta(f rrrxr no1tleo i3iaslmDelnvs;(4aeeomr3iytlpteanvi s trtoio3nodamt  ivia(fsrrm( o;t4aleomo3tlslaDrmnmon(4tleoxo ootfmt lueilt) 2xmxo3ny1al  lfetat s2urxront1opx  oeilt s rmnvp;t0arerifctatomte i o t t2xrio oudapeemfes tfaDurxro;o0oltnmi3tat m um(ms u4 lerxr3oytfp  ai i;()t2tr(m iydap  lict tfs2um(rpnu1optoiicildfaDrm( o (0trtrxf oa1om eaieilt0sexrxm3iydalee fes tfa2ua(rono0tet  i3tyslm rln s;u)tltrxo3oo1lmD  n s;t  rtr(o3oo1apt mfctatfa2urx o;o1oee  oetydlaDrl(mp;t0 exnxr3oatoaDe ivi;(0t2urim ny4am elneia()srrm(rono0tee mi3iat a2rau p;()alxoxociydfaDranes;s0sexoxo3oo1optnlieil( sDtax o;o0ape  ociydfa ran s (4tlxnxr iodlaDr iesls0srurio oo1lpe  ictlt s2taxm ou4oleo iciltlm2rlnvs;t4trxrircoatfateaneol(0 rurio nu1lpenlivsa() rumump;o0oetnmociasla ra(mo;t) eenmfcty1omDraieslt setm(r3oy4op   iesa( artm(mo;u4oltnmiciad a2emnvo t4 ltrmrcootfa r u ils)s2xoimpou4omeemicsasf Drmum nt0alen ociatlsDuluvonu) etoxr tadlate iei;()texrxr3iu1oleelnvt t)sDrrurp;o4ope  fciat s2ua(vs (0 rxnxf3iytlate uvs s0texrim oudalenliciat sDtmxmpou1altomoetadfmDuanmpnt0 exrxocoy1om e ivils teumxr oydlpe  fvtl()a2rr(rpot4tpxnmocildfs uanms;t0 exomo3ta1om eaues;()seumxr3iu4altnmfcs sf Drm( p;o1tlx moctys a el(vp;t0artoir iotoaDrai i s)sruoir iy4open nvi tfaDuau onu4oex  iciadlm ua( snu4tlxoifcia1fmt anvs (0trxm(mpny4al   feilt srua( p;o0tpeo oeiydla rl(vont0arxrmfctydfmt ln s;s)s2trir3ou4lmenlnvtas) 2ur(mpou1oexo fetltfaDranvp;(4tlxnifcoy1fp rai o;s t2uoirpiu4apte ivtasfa2tr(  ot0tltomoeiasfm2uanvsnu4arerxo iy1lmt  uei;s) 2tm(r oudolt lfcsl( s2tau  ;o4oetomi3iyt a2umn o () lxoxf iytopD  n s;s0 2toim3iy1openlnvsa( artm(m nt4tpenmo3iysfmDelnvp;(4teeomo3todomtr ues (0trxoxmpoudamtnlnes tfarrm(m oo1tlto o3tltlaDemn s t4 exrif oa1fa e ueo t0 rtoxrpio4ame lnei (fs2tau p;u4tetn ociasfmDelumont)texoxo3iy1lpt  u o;t)trxmimpiy4ol n ivsa()arta( o;t1tpt mociatlsDeanmo;(4aetoxf totlmtran o;s0srtm(m ou4al e nc
\ No newline at end of file
@@ -0,0 +1 @@
+n i;t0 2xm(o iu4lleelfvs sfs2rmu pou1aetoifciydlsDeauvo t4aexrxf3iadoa  an s;t0s2umiopnu4ol e fvi s artr(m ;o4oltnio3iydfs emn s ()tetrmo oodfmte ieo;t)trur(rpoudlmen fct sf 2ra(mpno4tlenmf3iyt mDrmuvs u4trxnmocia1lmteauvo t0s2umxmpnydoptn ivilt)s2tax p;u0alt mietas a rl(ms;u) exomf3oytfm  au ilt teuo(rpoydlptn neslsf Draxrpoo1alx  oetltls2ean p;()altoxr totlm raieol( s2tm(mpnu4lmen nvtasfsDrmxr ;o4aexo fciasfm2elums;u0alxrmo tatfm eaivslt tetm(rpny1amt livtasfsDta( oot0tpxnmieilslaDumnmpn(4tltoxf3oo1lmDraues;()srxmxrpiudome  fctlt) rrmxr oo4tlenmfcildla2ra(mp;t4texrio oa1opDr n o;s  rurxr3oydllenlnetlt  Dumur no0aee iociyt sDrmu p u0 ltoxf tydlat  ues;s0texr(r3oo4ale lfcsl( aDur(m ou0tptnif3iytlaDrlumo (0tltrxo oatlpt  uvo t) eurirpno4ome lncsas aDtmumpnu4oleniicils mDulnvp;u0trtnio tadlaD lnvo t0 eumxo3iu1lme mivsls a2ur( pnt4aee mi3ilsls rmu s;t4 leoio3iodfaD aneslt)trtriopiudapeemicsl() rtmxmp;t4oeenmo3ildfsDel(vpn(4artrmr tytopte ivslt)texrir oo1oleemicslt  Dra(m ou0tpen ocilt mDumnms (0 renio oodlmteanvs s)srtr(r nu4am n ncsa(fs2rmx pou4tptn i3tlslmDem(mpnu)tetnio iytlp r nvo;s)t2xoxmpiy4omeeliet s) rra(mpnu4olto i3tas sDelnvont4aetrxr oa1omDr i ils srxo(mpio4lmtn ivt t srua(mpno0ole  ieiadfm uln pnu0aexrir3oo1fmteaiesls)srtoiopiy1apte fvt s)aruru o;t0apenmo3iytfm2umumsnt) lxnxr ta1fmDranvs () etm(m3iy1om nmivil(fa2uax p;t0tpeniieiydfsDeanmo (4 rxnir3oadfaD aneo ( t2toxo3nydoptelivt t  Dur(mo;o4oeeo oetatfs2elumo ()altomo oadfmtr iei;( trxrimpny1ape lict tf rrm(m ;o1tlxo iciysls rlumo u0texoif ta1optr nvo s  exoxr oydolt lnei sfaDra( oou4aptnii3iasfs2rluvont4aeerif3tytomDelneo;s texm(r oy4op nmivt t)aDtru ooo1tpx  feiatfa2eanvont)trxoiocoo1op eliei;t)setrxopnodop   iviasfaDurumoot0optomietls a em(mo;u0 etoifciatopD  neo t)trtoxmpno4omtnmfctltfs2rruro;t1texn o3tldfmDua(mo;u4tlxomr3iatfm  aiei;()sexoim3oodalt mnvias) 2tmurpou1alenio3iytfa2uan p;t4arxrxo3iotfaDe u i;(0s2tr(m iydal e neslt aDta( ono4aex ifctadfa ea( o;u4texoif oytfm e ues;s)sruoiopoy4lptn fesa( srrrxrooo0tlt if3ildfs2raumsn(4teenir3ty1fp r uvo;s s2xrim3ou4lm elicsl()sDumu  no0tpxo fcilslm2rln o u4aexnmrcta1fatelivs s0s2xmxrpiu4oleemnctltfs2tmu  no0alt ioetydfs ra( snu0arxomfcio1opte neils  2uoimpnudamtnlnei sfsrrm( p;o0ope ifetatlsDeauvs;t0 reoifctotla  livo s)t2um(o3nodoleeliesa()aDrru onu4optn feildfaDemnvpnu0tlxnif oa1la eaieolt truoio3iodolte nvsls)aDur(r no1tpe mfeiysfa emu sn(4alxnmo3ta1lmDrliei s)truoxrpoodamt mfvt tfsDumur nu4tltn iciasfm2rlnvo;u)aetoir3tatlp rlu i s)t2tm(opnydolt mnvtl(f 2rr(r ou0altnmf3iysfaDrm( p;(0 rxrif tadfat lueo;()setmimpnodoptelieslt)artaxr ou4tlxo ietld m2umnmpnu)tlxnmr3ia1op r uei s0trxo(r io4ap emfvtls a2urxmo;o0tle  fetas aDuau o u) eenio ootfa elnesl(0 exrirpny1ame mivil(fs2um(m nt1oltnioeiyd a eanvsnu0teenxo oa1oa e neo;t0s2xr(rpno1ll  mncsl()sDtr(  ou1oeen ociaslmDuan pnu) exrmr oa1fmDeanvi;(  2xmir nydllenmnvta() Dtax o;u1apxoiietas a raumo u) lxnxf todop ean s;t) rtriopou1lp  lictas) 2trxmpno1aetnmoeiys sDumu o;t4 rxoxf ootlpt aivi;(  rxmxmpoy4aptemnvt s  rtmurp;o1altniieiad m uaums (0alerifciotfat livs (0teumir nodlmee icils)srtmumonu0tetoifcilt m2ua( p;t4treoir3ootoatelu o s)tetmxrpoy4altn fvs t s2tm( p;u0opx mo3iaslm um(mon()tltnmrcty1fmtrai ol() rtmio oy1ap e ivslt)a2ta(r nt0alenmoeild mDea(vo;t0arxoxfcoadoat  ivi t0t2tr(r3iudoltemicsltfsDrm(  ;t0oet mfctydfs2rl( pnt0areoif3iodfa   u o s)t2xr(m3iy1al  mivtasfartrx pot1tee miciltfa2eanms t0 etrmr iy1fmt aneo;s0truoxrpoudal  lncsasfsDra( o;o0tpeomictlslm ua(msn(0 rtoirciatlmD  ieolt0 etmio3iodal  miesatf rtru  ;t1ope mfetysfaDeln s u0trerxrctodoaDraieslt) rxrxm3oydop e ncs t) 2taxmooo0tpeo feiadla ra(ms;t0artnxr3tadfaDe ivi;t texo(m3oo1ap  lfvsls) Drr( o;t4tlt  ociyt s2uanvon(4texnmo iadfpte n s;s0t2uoxrpiu1ol elnvtatfs2rmumpnt4tptnmo3ilt m2ea(msnt)tetrxf3oytlmDelu o (  2uo(r io1amt lict sfsrrmxro;o1tpeo ociyd mDulu o u) rxnmr3iy1la r i s;(  ruoxm nydoltn feil()sDtmu o;o4tex  feildfs el( snu0trtnif ootlmtrlies;(0setmirpiy4lmt  neiltf Dua(rooo0tex  i3ild a emu s (4alxrir totla ranvs;s0texmiopiy4lmtnliet t a2ra(rp;u4oexnmieiltls rmn p;t4 ltoxo ia1fpt lies t0 2xm(m3oydlm nlnvs t s2tm( p;o0ole mictyt a el(msnu)tlenir to1fmtranesl()tetrim oy4ope  nvtltf 2rru pot0tptnii3ildla2ul(vo ()tlxrxf3iadlatr n i;s)t2umim nu1al   icslt sDrax  ou4tpxniieils sDrm(vs (0tlxoxocoydfateln s ( trum(rpnudale  ivt t aDraurono1alx  fciydls ean snu4tltrmf tatoa raneo;( trtrxrpio4lpte nes tfsDta( oou4optnifciyt aDean pn(0arxoxf3iadlmt lieo;t)srurxrpnydllenmietat  rrrxmpot4apto oeiatlsDeauvsnt)arxnif oytfp rluei;t0s2to(o3iy1omen fcsasfsruaurp;u4teeomfciatfmDrmumo u)tleoio3io1lm   ivsls) 2xrimpiy1ap n fcta( srumxr ;t1olen octas s ul(vsn(0aexrxo oytomtr u o;t setoio3oo4ope  nctat aDra(moot0oexomfetaslmDem( p;t0trxnmo3iadlaDrli o;t0s2xo(m iudop  livsa(f rrauro;u0olxo iciydls2ra( snt)trxomo3ia1lptr u s;s  2xmxopnydope  iei ( sDta(rpnt0altnmiciytfaDea( p t0 exnxo3to1la e n o s  rtm(m3nodamte fviasf Dtaxmpou0apt  iciyslm um(vs;(0trxriocoydoa   nvi;() rtmxr io1op e fet sfarrmxr ;u1tpx ifctlsfmDulumsnu0 exnmr3iadfm rlies;()t2tr(m oo1lm  miesasfsDraxrpou0apeoifeilsla rluvs;u0 ltnxf3tadlaD anvslt  ruo(o oo1omenmnci (fsDum(  nt1tlt micildla em(mo;u0texnmocoy1oat  ivi;t)srum(m3nu4lmtelivi s  2rmuro;u4aee micilt sDrm(msnt0altrio ta1fatrlu i t s2xo(r3oy1ap emivsasfs2rmx ont0oex  i3iyd s eanms t4 leomf3oy1fpteln o;s0 2ur(m oudlm emici t a2ta(mp;u0ale mietldlm um(vp (4artnircootlaDraivs;s srtrio3ny1am emfvsas) rtm(m ot0teto icils sD
\ No newline at end of file
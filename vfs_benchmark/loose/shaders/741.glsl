@@ -0,0 +1 @@
+nvi s0srumxo ny4lp nlneils)artmumoot1aleo oeiad aDuluvp (4aetnifciytfmt  u o;t  rxoxmpnu4lp emfeil() Dum(r ot4opt iociydfm2ranmpnt0aeerxrciy1fatr ies;(0 2xoxr nudal e icsls) rra( pou4olxomicilsls2um(vs;u0 etrxocoadoaD ai o;()s2xmxm ou4am elivsatfarrmur no4tlxoiicias s2ea( o (0tetoxf3oa1lptrlies t0s2to(o3io4aleemfcsat)aDra(rpnu1altnmoeilt s2rlnms;u4 rxriocty1fpt au ol(0sexmio3oudol nlncta()a2tmxro;t4olx mfcildlmDeanvo;(0 lxomo iy1latraivo (  exr(rpio4al  lfctl()s2umxrpoo1ale  oetltfmDemu on(4alenxr oo1lmD aneolt setr(r nydlmeemfvs s sDuaxrp;t4aptn i3iad s ul(mont4aexnmocty1laDr u il(  2xoxm3ny1altnmivsat)a2umx  oo4tet  iciydla ulnms;u) eenio3totfptr ieo;(0setoxm3nudamenmnetls aDtaxmoou1aexn fcilsfsDel(monu0tlxomo iadomtr i s t)srtm(m nu1amtelivi (  2raxro;o0opt mf3iydls rm(ms;u4 renmfcoodfmDr n o;s)s2xrxo3ny1opee fvt t sruax poo4alen f3tyd mDrmnms u4trxomr iatop eau s s) rumxm oydlpenlfcias)artaxrpnt4texo iciyt m ra(vp;u4tetrmf3oa1oa eaivo;( s2xmimpno4ope liet s sDtau pou4tlxnmieiltfmDrm(mpnu) ltoxr3to1op  lies s  etm(opiu1lmenmfeilt)sDtmxr ;o1apxnmfeiyd sDraumo;u4alxomf iydoaDe u sls0t2xoir3nydaltemnetlt)arrm( o;o0aee mo3tytfs elnmpnt0tlxoio iydfp r i s t t2ur(rpoy4amtnmictlt)sDrmxrpnu0opeoiictatfaDul(mon(4treomfcio1op elnvsl()trurio nu4ol nmieils  rtmu oot0oex iicilsls rmnmpnt)arermf totlmteai s s) rtm(o io4ape miciat) Dtaxmont0optn icias sDran o u4alxrxrcootfmDrai i t s2trxr iy1lpte nvsl(  2ua(mo;o4alxo ictys aDelnvpn()tetrio oadopt lu s (0trtrir3oo1lm emieiat  rtrxro;t0olenmociasls ea(ms;(0 leoio oatlatraues;s)t2urir ou1ame  fet tfa2tr( ono1ape ioeiydls2elums;(4trxnio3oadoptrlieo s  eum(r ou1op  lfcs () Duru pou4optn ictldlm ua( o;() ltnxociytoaDrauei;(0 2um(m nu4ape mict ( sDrrxm ;o4tlxnmoctasla2umumon()teeomocoadopt  ieo;s0 2uoxrpno1omee fcs s  2urxrp;t0tpeomi3iydlaDumnmp;t4artrxfcta1optranvi;t)seumxo iy1al emfct t)arrr( pnu0oexo oeiaslsDuanvp;t)alxnio3totfpDraivs t)setmxo3nu1lltnmiesl(  rrru p;u0oeenmfciaslmDrm( s () rermr3totomDeau o;s t2xoim ny1ll  mfet t)a2ur(  oo0apxnmieilsfaDrluvp;(4aeeoif oodfa eanvo ()s2ur(m oy1ap  mfvsa()s2umump;t1olxn f3iys s2rm(mp;u0arxrif ootlateaueo s0sexoxopiu1ll n fvil( srumu pno4aet ioctydlaDuaump;()tetnioctydopDeau s;s) rxm(mpoudole  fvtas) ruaxm no1tltnmo3iydfsDelnvs;(0tlxoxoctodfp  lues;( srtmiopou4ol  lietls)sDtrumono0tpx ioeildfm eanvsnu) lenxr3iadfmDeln sl()srxr(r iy4al  mfeta(f Drm(mpno0alxomieils m ran s;()tlxrxocia1laDeau ils0 2trxmpny4om   feias sDrmx pnu0tptniiciydla emnmo u0aetoif3iodfp  lnei;()t2umxm3nudlpte nvt ()a2trx  nu4ale mo3ils mDranmon(0aleriocoa1fpDr ueils0texo(m oudopeemnvil()artau onu0tlt  fctydfaDemu p u)artrxf iotopDelivslt0tetr(rpoodol n netls aDtrx ono0teeomoeiadfsDrm(vo (4aexnio3oy1oatrai i;t  exr(m iu4omenmfci s  Dtm(r oo1tpeomieilt s2rmnvo t0trxrxocootlmtraueo;s  2tmxr iodop e fet (f rrr(rpnu1aetnmfeiyt s um(vsnu4teeoxr iadlpDrlu i;t0 2urxo no4oltnmncil()sDrm(mo;u4tpx  oeiatla2rm(vo t4 ltoifciotfp elnei;t0srxrxr ou4altelici () Draumoou4tex mfetyd m2ea( p;t4 ltrxr oydfp  anvo t s2trxr3iydll elictl() 2rm( pot1tlt mi3iyslaDuanvs t4trtnmo3iodfa e ivs;t trtrxmpnodoltelfcilsfarrr(mp;t1apx  f3tydlm2ranmo;(0altnmr oydop rauesl() rtm(m oo4lpeemnvi t aruax pou4opt mi3iltlsDrluvp;t0 lerircio1oaD livsls0s2xoxrpio1lpt mivta( sDumxrpnt0oexnmfeiyd s2em( p;t)tlxnxf tadfpte u ols setmxmpoy1op nlfvtas)s2uaumooo0altoifeiyslaDum( o (4 eeoiocoa1lp e nvs s)trtoxrpny1lptn ncias srtrurpnu1tpeoii3iyd s uau sn(0 exrxo3tatopteaueo s0tetoimpiydlmenlnetlt)s2ta(mp;u1olt ii3iltfs2ulnmonu4aeermr oytlatean o;s t2ur(m nudlpeemicilt) Dtrumo;t4teeoiiciysls ranmo u)altomr oadomDraivilt0sexmio ou1am e ictls sDum( ont0opxn fcilt a rl(vs () rxrmfcoo1fm rluvil() exoxo oo4omt  ietlt arur(m no4ape  iciys s eau p u4trenxrcta1oa   uvslt0t2urio oo1opt  netas  Dtmumont0oleomi3iltfaDeln onu)alxnmr3tadlp   u il() rtr(m3oy1oltn icsls)arrm(rpot1olt mfciysfmDeauvo;() reoxo3ia1op e nvo;()s2tmxrpiu1ale lnci () 2uaumo;t0openmietasfs emnvo;(4aetrmo todfm r u o;(  rurxm nodaptelivt tf rta(r nu1tex  ietld sDua(ms () rtnio3oadfptraneil()s2xmim3no1llt  ncs sfsruaxmoot1teto iciasfm ul( p u4tlxnxf oo1fateaues;( t2trxopiy4lpte fcias)aDtr(ro;t1oltn fciyt sDelnmo;u)arenmf3oatla  lneo;t)sexoxopoo1lpe lfvtasfarumx onu1aexn fetltfmDeaump u)aetrxf oatomDe i il(0 rurir oy1lpeelnvs sfs2uaur ;o1ale ifctld m el(vp;t4 rtnif3oytoaDrluvolt0sexoim3iy1lmt lietat s2ta(m nt0alxnmictysfmDra(mpnt0 exnxocoadfa rai ol( texrxrpou4ope  nvilsfsrtm(mpou1aex  i3iatfsDrln o u0altnmfciotlp eauei ()trto(o3iodoptnmfvia(fsDtru pnu4apxoifciyd sDrmuvsn(0alxnxrcoodfaDr nvi;t0 etr(o3oo1alee ncsat  rrmxmo;o4aet  feiatfs2rmu p u4treoxfciy1lp e nvs;s  euoxr nu4om emncias  2ta(rooo0teenmfciyd a2emnmsn()tetomr3ootoa e iei t0teuoim nu4oltn neiasfarra(rpou1tetniictasls2rmn onu4tetrmf3todla eaieilt tetoio3oo1olee fct s) 2rrxr ou4tpeniieiyt sDem( p u) reoio oydoa eanes;()t2uo(o3io1lmtnmneil( aruaum ;t4alxnifciat mDrm(vsnu)treoxo oo1fatean ol(0srxoxopnu1om e neia( artr(mpot4alxn o3iatfsDem( snt)tlxnif tydlmDr nei () 2toio ou4lm   ivi ( aDtm(  ;o1tpeniicildls2el(mo;t)tltrmociotfptrau ils0 exm(mpiudoptemfci tfaDtaxroou4aptnmf3tadla2raump;(4areomo3to1opD lueo;s)tetr(o oo4omtnlfviatfa2trur ;o1aeto iciydls2ua( o (4 ltoio3oydoaD  i o;() rtrimpno1altelivsltf rur(mono1aee miciyd mDrlu o u)teeoxf tytlate i o;s0 euo(opnodamtnmfvsatfsrururoot4oltoif3tltfa uan o t)tlxoir ia1fa eaivsls srtrxr3iy4al   ivsl(  Dum(m nt1apenifciadlmDrluvp t4 eeomo oatfmD lu o ( trxmxm nu4apt mfetlt  rta(mp;u4tle mo3iysfs emnvo;u0 etrxr3oa1fm r ieo s0 rurxrpio4olt  fcs (fsrrrump;t1alxomfctad aDea( snt4alxnircia1lpDe uvi (0texmxo3nu1ll nlictls) rrm(rp;u1ole  feiytfaDuanms;(4texnmr3iydop rai s ()texrim oydlm  mfcia( aDrax oou0alto fctasla ulu pnu)areoxo3totla  lnvsl( t2um(rpny1lm   fvil()sDurxrpno0opeoioeiydfa rau s (4teermfciodomtr ivo;s0trxo(opny4am eliei tfartaxmpno0tlx moctatlmDul(mo u0 lenxo3oo1lmte nei s seurir3iu1llt  neiatfs2ta(r ;t4oeto oeils mDemu s ()trerxo oo1faDe nes;s t2xmimpio4ol elneia()srururonu1tleo fetldfm2emuvs t) eeoxf3iotoaDranes;t) exmxr iu1om e nvsl() rua(ront0tex mf3tldla2ranmpn(4aeenmo ia1omteau ol(  rxm(rpiy4ap  mncslt srrruroou0ope ioeiatlm2emnvs u4alxnxr3tydfp   u sl(0s2xr(o3ny4al  lfcil( a2uau pot1apt miciatlm2emn o t4aexrir oy1lm   i i;s0 eum(o oy1omee ici sf 2trxrp;o0oltnif3tydlm2el( p;(4aetnmf3iatoa rln i s sexm(r3ou1ape mncs (  Drrur nt4oltniieiydfs2uauvonu0 exriociydlat anvolt setm(r3ou4lp nmnctl( aDraum nu0tltomoetat a2rlumpnu) ltomrcoadlm eaieols0t2tr(r3iu1amee nvias sDtax ont0tet  oetatlsDra(ms;t4 etoir iydfp ean s;t)t2tm(o nu4omenmicta( arurxro;u0oltn f3iatfaDemn pn(4 lenxo3iy1latr iei;( srtrxmpiy1ll nlfvsa(fsrtrur nt1oetoioeiltlm um( pnt0 etrxf3iydfpteanvi;( texm(mpny1ll  mfcils)sDuaxront0optomoeiysfmDrl(vpn()alerif3ootfptr i olt0t2xr(m nodopeelieia()aruaum ou0aeeomi3tasfa eaumpnt0tlxomrciodoatrluvi;s sexrxm3nodalt  ietat) 2rax  nt4tptnmf3ildlmDrauvp;t4 lxrmfcoy1fp r n olt sexrxm3nydole  nci s) rrmx pot0oetnif3tas m rlumon(0trerirciydopDeaies;t0trto(r3no1lp emfvi (  rtmx p;u1tet mfeiyt a2umu pnt4 ltrir3iatomD luei;t0srtrxmpio1lpe licil(  Duaxr ;u1tetoii3iadfm2rm( pnu4aleomo3oa1omDranes t) 2xrxr nydop  lietas sruauro;o4tltoif3iydla2em(mo (4artrio3oadfpD  ieo t srxrio3nu1ll nliei tf rrmxmpou4olxoiictldlmDrlums;u)artrxf iydlmtrluvi;s0 2to(o oy4am e fvsas) rtrxrpnu1aetn i3tad a elnvo;t4teerif3to1fpD aiei t)t2urxmpoy4op   fvilsfs2tm(mpnt4teenmoeiytfa ran p;u)trermrciodfmD  n i (0texrxo3oo1amt  fcsl(faDuaxr ;t0tlenif3iadfsDrl( sn()alxrio3tydfptrli o;t)t2xr(m ou4olt mfvil()a2raump;u1ape  ietytfa2rl( s t4alenxocta1lpt  ies s0trxr(r oy1oltn ncias  rtm(rono0tee ioetatlmDuanvs u0trxoxf3oadomD au i s  2urim3iydom nmfvtatf 2tru o;t1teeo f3ils sDrluvpn()trtoiociytlp  lieo;(0trxmxopnodapeelncia(fsDrmur ;u4oetoiociatfa rmuvp;u4 rxnxo3to1op elies t) 2toio oudlp nlfet ( sDta(r nt0olxnioctas a ulnmp;u)arerxrciadlatraueo (0tetr(o oudlltemfcilsfsrurum no1tptnmietls a2uanms u0 lxrxr3ty1lmtelnesls)texrir3nu4amt lfvi (fs2uaurp;o1apxoio3iltfs2rl(vont0arxnio3oydopDrlu o s)t2xrxm no4omtnlfes t s2rm(rp;t4opt  ieiasfa2uaump (4altoir3oy1fmD lnvo;s s2tmxopoo4al nmfcta(farua(  ;t1aex  i3iad s elnvo t) ltoio3oatoaDranvo;s s2toir nu1om emnvi ( sDtru o;o4tlx  fciytfa em(mo;u4alxomrcia1op   nvs ()t2toim nu4al n fcslsfsrra( o;o1texo fctas m2rm(vs ()tetoif ty1fmDelu olt0teurio ny4omtnlici s  2ra(ro;u4opeo oeiltfaDranvp (0 rtnifcta1fatraiei;t0setrxo iodalt mici tfarraumpoo4aexn ocildls2uanvpnt0 exrmf oo1latr ues s s2ur(m3ou1lpe  nctl( aDrru onu1oeeoifcilsfs2ulnmpnt0aexnxocoytopte uei ()t2toio3ny1op elicslsf rtmxmono0aexniiciyslm ulnvont0 lerxrcoo1opDean s t)seur(mpny4open icsasfs2rm(m ot1opt mo3tydfm umnvp;t)texomo3tydlp rlnes;s)trur(m ou1lptnlfvia(fsDuau o;o0oeenmf3iyslm ranvp;u4texoifctadfaD aneo;t s2urxm3nudopeemncslt)sDrmur nt0aleoiieias a ra(mo;()tetoxr3oatoaD  i ols0setoim3ny1altnmictl( s2tm(mo;o4aet mo3iyt sDrmuvont4artrifcoo1la  livo s  2xm(mpoo1al   ietatfa2ra(r ;t4apt  fciytla2eauvs;u0 rermf3oydopDrai o () rxm(r3oy4lpt  ncsat)srrax  ou1apxomi3tatfa rlnmp;t)aexnio tatla  ln o;s0sexm(rpoudlltelicsls)sDtmum nu1olxnioeils s uanvpnt)tetrmf3oa1fmte n s;s t2toxo3oudll elivtl()arrmumont4olx mo3tltfs ean o ()trenxr3ootlaDr uvo ( sruoio nu4amt  ieslt)sDtru  ou4olt ioeilsla2eln o u)areoxo iydop   nvs s) 2uoxr iodlptnmfvt tf Dtmumpoo4tex  i3ildfs2ul(vs;u4teenxr3iy1fp eaieo s t2xoxr3io1lmen fvi t s2urump;u1opxoioeiltlmDelnmo (0tlenmf3iydfmtean o;(0trxmirpiu4lmtemnctls  rumx p;t4oexn ietydfm rau s u0 etrir3io1om r ueols setrimpiy4amee nes t aDrau ono4tetomietysfaDelums;() leomr oytfa  aueo;( t2xmio3oy1ap   neil(fs2ur(r no4aptn octytfs ra(vp (4aetoirciotfm eaueo t t2xmir3no1ol n nvil(  rrm(m ot4teeo f3tytlm emu s;u4alenxfciodfa   neolt trto(opoo1lpenlivta()a2tau ont4tet mfciad sDea(mpnt4trermr ta1la raieo;t s2uoirpoudome lfci () Draumooo4tpt mociytla2eaumpnu4 renifcto1lp  aueo (  2xoio ou4amtn fcsas)aDumum ou1texomiciadfa ul( s;u) lxoir ta1latr iei t t2toxr iodlp emfeiat arrmuro;o4aetniieiys aDrm(vsn(0 eeoioctytomt aivo t)t2uoim oo1lmt mncils aDrr( pnu1alto ietatfa2ra(vp (4tlenxo3todopDeai i;(0 rtmxr3oodol  mies s)sDta(  ;t0tee  f3iytlaDrau s;t0 lxnio oydlmtr ieils) 2uoxopio1al  lfeilt) rrmxm oo0alen ociydlsDea( o;(0tlxoxociatopDrli o;()s2ur(m io4lpt lnci s)arumxmpot1opto oeiydlsDelumpn(4 eenxfcoatfptrauvo t)trxmxm iu1ole lnvsls)s2rm(m ot0aeeniictat sDuanvpnu0aetnxocoo1oatranei s srxrir iy4al elfcs t)a2ur(mpnt0opt mociltls umuvs u0 lenmo oy1lmDelueol()s2uoimpnu1omeelneia(fsruaxronu0aexnmiciyt a ulnmo;t) rtoxf3oo1opDe ivsl( srxm(rpny4lmenmiciasfs2rr(mont0ope mfeias m2umnms;(0teenmfciodfm r ues;s srumim oodam nlfvtl() ruaur no1tltniociltfs rauvsnt0teeoircootlaD anvil(0 eurim no1omt mfctas sDtmx p;o1tlx iociysfs rmu s;t)trxoxocoatfa r ueo t  rtoirpnydlptelics ( srtr(mp;u0tle moetatlmDrmuvsnt0 etoxo tadla r u i s)t2ur(r3iodoptn nvsatf 2ta(  ou0aexomiciltlmDrmuvo;(4texrmrciotfpD an o (0 eurir nydlle  fei sfarta(  nt1tlx  icilsls ranmpnu) eeoxocty1fptr nvil() ruo(opny1apee fcsa( sDuauro;t4aex mfciytla2uanvsn(0altomo oo1lmt lneols0s2xoxm oo1alenmfvilt)sDuau ooo0ole ifetys sDuluvs ()trxnmr3oatoaDe uvo t)teur(mpiudlp e fvs ( aDua(  ;u4texnifeiad sDrmnmo;u)tlenir3oydopD auvs;t0t2trim3ou1lme lnvi tfaDurumpno0opeomfetldlaDel(mp;t0 eeniocoatlmt luei;t0s2ur(mpiydam nmnviasf rrmurooo1tpxo fcils aDrauvp t)tlxrmo3oy1omt lies t texmirpnydomenlnvtlsfsDuax  nu1olenmociytfm2ua( p t0texoxf totoa   nvo t0trurir nydale lnvs tf rtrurpno4olx mfctltls2emn s;u0trtnxfcio1lpt lnvo t)trtoxr3oydape  iet (f 2rru oou1tle  octytfa2rm(vpnu)trtoio3tytfp ranvo;(0 rxoiopoy4amt lnvi ( artr( o;o4opx mfeiltfs2ua( s;(0 leoir3iodlmDelieo;t0trtm(o iydlmenmfetltfaDraur ;o0oex ifciysla2emu s u4aexnxf3todfmD au i;(0 2ur(mpiudamtn nvi ()arrm( oot1apxn i3ild s2rlnvo (0texrmf3tytlat au s;s0t2toio3oy1lmt lfetl( sDtaxm ;t1oltomiciytlsDeau o;(0aexnxr iotlpD  n sl( srtmir iu4ameelfci sfaruaxroou1alx mi3ilslm rau snt)artnir ty1oa r n ols  rto(m no4oltelfctat)srrmu o;t1ale mietad m2um(msn(4 rerxo3oatlmD au o;t0tetm(r io4oltelivs (f rum( poo0apen i3ild a ul( o () exnircia1opD liesls)trtmimpnudaltn netat)arumxmpnt0alx mf3tyd s rm(mon(0trxrxfciadlpD ln olt) exrxopoudap   icils) Dum(m ou4apt mf3iyt a2uau on(4arxnmfcoydlp r ues;()s2umxopny1am nmfviat  Drmxmono4altnifctyd mDrluvpnu0aeeoxrcoadfat  ueo t0 rtoxmpio4lle  ieiltfs2tmu pou0opxoioeilslsDea( o;u)alermfcoadfat aneo;s texm(opoo1al nlivtasfsDurxrpno0tet mietldfaDrlu p;(0altomr3io1opte u olt texrim3oy1apeelnctatfa2tm( pot1tpt ii3ildlsDum(mo u0 rtnif oodlptr iei;t0texm(o ny4lmtnlneia(  Durx o;o0oeeomocild m emuvsnt0 exoxocto1fateaueo;s0t2tmio nu1alee ies (  Dtmxm nu1tleoifcilslaDrlnvpnt) lxnxo3io1fmtrln s (0setrio3ny1ap nlfvt sf 2tmxrpot1opx mociltls2ul(ms;() lxomo oy1om e uvilt t2uoim3oo1om   netas)artm(mo;t4aee ifctydlm el(mp;u4trxoioctydfpDranvs s0 2toim3iy4ll nmncsl( srrmxrpou4aetoio3iad a2ra(mp;u0artoxr oo1fp  auvi;s) ruoir ou1lle livtatfsruaxmpnt1apxoif3iys s elnmo;u)alermf io1fa raivs;(  2umxm iu4am elnvt s  rurxmont0opeomi3iadfaDrluvpn(0 etrif oo1lpDe ueilt sexo(o3oo1lmtelnet sfs2rmur ot0olxn ocildlm2uauvon(4 rxoxf3io1opDean s;s)srtmim io1amtemieta() 2uru  no1tleomictlsls eauvpn()artnmf iadoaDeaivs;(0sexoxo nodlpt  ieta( sDrm(m ou4teeo i3iyt mDel(mo;t4trermrcoodoa eluvil()teurxr3nu1amt mivsatf Dta(  ot1tltnmo3ildlsDea(mp;u0aexnxr3ty1oaD aivol(0 euoxo3nodlpee fcilsfsrrrxrooo0tltoiociytlm uaumon(0trerio3tatlm eluvi t  rxo(rpnodoleelfvil() 2taump;u1tlx  i3tlslaDel(vp u4tlerxociytoaDrlu olt sexrim3oo4ome  fesa(fsDra(mo;u0tptoio3iad aDrmuvsn(0aleoxr iatomtr nvs t sexoxopny4omtn fvi (fsDurxmo;t0olxoioctydfs umu s (0trxrxo3iydopD  n s;s  2umio3iy4omenlnvtat) Drmu pno0oetnmfciad m rluvs;t) rxnir3io1opD  ieil( s2trxr oo4lp  mfcilsfa2tmu p;t0alxnmo3ilsfaDelump u)artrmr3oydfm   uvsls tetmiopiodole mietltfaDuaxm no4apto ieiys a2emnmp;t4teermocoy1op rlueo;()trurimpoodolen feslt)arra( p;u0tet if3ildfa eanmsnt)alxnif tadlmDe u i s) exo(r3ny4ame  fct ( sDrm(mpnu4opto oetls m2em(mon(4 reoirctodomDeli sls seur(rpnydapt mietatfsDta( ooo0apeoio3ils s2emnvp;(4aexoxocoadlmtr nvil(0trumim3no4apte fvias sDrmxro;t1tpx if3iyd a ua( p;(4 eerxoctadlpt livi;t) exrio3nodameelnei t)arraurpnu0olt mo3tadla2elu p;(4 lenio3io1opt lu o;t0 euoirpou1ame lfcsltf Dum( oot1teeo iciltlmDra(mp (4aeeomfctytfpt ai o;s srumxopiu1apeemnct t sDurxmp;u4tptn f3iadfsDumnvs t4artomo io1fmDrlneo;t0 exoirpou1lptnlnetas)srrrump;o4oltnmietlsfs2uaumo;u0 reoxr ia1fmDrlnvsls)t2ur(rpnudlp n fvta()arurxrpou0oeeomieilt s2uaums u4 ltriocootopD aivi;t) eumxrpiu1lpen netat aDrauroou1tee  fciltfmDea( s;t) rxrio3iotoptr nvi;s) 2xoir3iu4op  mfvta(f rtaumoot0oexomoeias mDua(vs (0aetnxo iatfmtelieo;s texr(o iydomt mnesltfarrmxr ;t4alx mi3tls m ulump;u4 exnio io1fmteaues t0trxrxmpnydopt  ivt sfsrum(mo;u1opxn ocild m2ulumpn(4 lxoxr tytoa elieil() etmxr3oodaptnlncs ()a2uau  ;u1texo f3iat a ean sn() rxrmociydfm   i s;s0 exo(opny4alee fet s s2umx o;u0oee  fetadfm2uaumpnu0 lenxoctodopt au ols) etoimpiu4apt lfct tf 2taumono1texo f3iytlsDrln ont4aleomfciadom elivi (  exmir oydope lnesltf 2rauront1ale mociad aDrl( p;(4altrxo iytoaDr i s t) etrxr3no4opte nvsas) Dur(mo;o4olt  ociytla2ea(mpn(0tltoirciotlm eauvs;t  etoxo iudol  licilt)s2tr(mpou0tee  fciatfa2raumo u4aetrio ty1lp rau o t  rtoiopiodale  nei (f Drrxmpnu1alenifciltfm ulumsnt4aleniocto1lmD aueo;t) rxm(rpnudapt lfci tfartaum no1aet  i3tltfa ua(vp (4 rxnmf3oodlatraueols0 ruoxm oy1alt mfctls)aDtaur ;u1tpxo ocildlmDumuvsnu)tetrmf3iotopte ivs;t t2urir3oudlpee fesa(  rrru  ;u1aeenmf3ildfa elu snu4tlerxr iy1fp eauei t t2to(opoy1amt  net sfaDtaxm ot1oleo feiltlsDel(mpnt0tlxrmf oadfpD  ivo t  2um(m iu4aptnlfciatfs2uaxrpno4oexnmocild a ulu o;t4 rxnxrciotlm e ivo t)sruoimpny1lp   fcta()sDtrxm no1tex iieiyd s umums;(4artrxf oydopDraiei ()srxoxrpoy1omee fvi t aDraumono4aetnmfeiadfa2ea(mo () etrxo oy1omtranvils0t2urir no4olt  ics (fa2uru o;t0apt  oetadfaDem( o;u)tltnxr3tytfp rlu ols  eumxrpny4lp   ivslt arurur ;u0aet moetltfa2eau sn(0trtnirctydoa eli il() 2triopnodalenmfvtatfarurxmpot1aee  icildfs2elu p;(4altoifcoo1omD luvil() rtrim3no4apt  fcslt)a2rrur ;t4tpxn oetasls2rlnvs u0 exnif to1lm e ieo ( s2tm(opou4lp   ietas s2tauro;t0aleo oeild m2ea( p;t)tleniocoo1fa eaueol(  rumxr iu4ape lict s)arrax pnt4opxn i3ilslmDrmu p u4 ltomr3totoatrlivsl(0t2tr(o3iy4op eliesas) 2uaur ;u0olt  fciyt m eanmpn(4altoxoctydfmtrlu i s)sruoxmpnudape mnetat)arurxrpot0tptnif3iatfsDul(vsnu)aetnir oodlmteaueo ()srxrim io4lpenmnvtls) rum(r ot0aex iocild a2rl(vp;u4areoxf oydomtr n s;() 2tr(r oydapt lnvslsfa2tmxmooo4tet  oeiydls eanmp u) lxnxr oadfaDeaueolt)s2tmxo3nu4oltelnci s)a2tm( ooo4tpxomf3iltfm emnvpnt4tlerifcoo1lat  ivi t  2xm(o3no4ap  mivs t)aDtru pou0tpxnifeiadlmDea(vp u)aetrmf3iadlm rluvi s t2xmim3ny1lptn feiltfsrtmxm ot1oexo f3ild mDrm(vs t0teenifcoytfa  lu i;s0sexr(o3oodape mnviltfa2taxmo;t0opt ii3iasfaDeauvs u0alerxr3iadomD  ieils trxr(rpnydol nlietls)srtrur ;t4aetniiciltls rauvo u)tlxoxocootlp e uvs;t  2to(r3ny1ll   feta() rua(  ;t0teen octldfaDean o ()aetrmf io1lat ln i t  rxoim3no1lmtnmivs ()arrau ooo4tleoioctls a2elnvsnt)trenxo oodopDeluvi s t2xmir ou1lpee ici ( srur( oot0altoif3ildls eln o;u4trermo todoaDraieo ()t2toxrpny1lmtemivs t)artrxmonu1tet mfcilslm2ra(ms ()aexomfctatlp rlu s;t)s2xmiopoy4al  mfvtat  rtmxr ot1tleomociasfs emnvp;u0tetoxo oadfptrliei;(  rxr(m3io1am nlncil(f Dtruro;o1aet mociysla ranmsnu0aexnirciy1oa r uvols0srto(m3ou1ope mnes sfarur(m nt0oeenmfeiadlm2eln onu)aleoir oa1omt  nvs t0 etmxo ny4alee ict s srum(r ;o1tle iociat mDrluvs;t0tlxoxr oodfaDe n il()srurxr iu1lm n ici ( sDururont1oleomfciyd s2rmnms (0tltrxo oy1lmteanvs s srxo(opou4oleelivias  2tm(mp;t1olx ioetldlm2emn s t0tltomo3todfpDranes;s sexm(o3ou4aptemfci s)a2tax pot1opeoio3tas aDrln p (4treoio tadfmD aiei;t trurio oo1op emicsatf Drmurpnt0tpeo f3tltfaDumu pn(4tetrir iy1fp eln o;t)s2uo(r3iu4ape lfcil(  rurum ot4apt moeiatla ean o;(0teerxr oy1fmDelivolt srumim oo1alt mivi s)sDtax poo0openif3tatlm2ul(vsn()arxnmr iotoa  anvilt setoxmpio4amtnlfcsl()a2urx p;u0opxoiocild s2rlumpn(0 eeoxo3iydopD an slt) 2ur(m oudopt lfeil( s2tau  no0tltnii3iatls em(vs;t0arxoxrcto1laD lnvo;s0 euo(r oodom nlnviatfsDtaur no1oexomieiad a2ua(vonu)texrxf oo1oa  livs;s  eur(rpiodlptnmivtatfsDra( ont4altomi3tldlm rl( o;t4tlerxo3iytop e i o;s0 exmxm oy1lptn fvsltfa2uax ono1oeen o3iysfm rl(mo u4 leoiociodlmD  iei (  rurxm3iu4al emnctl(fa2rr(  ot0open i3ils s umums t4tltniocto1opt  nvi;s0teurxmpoy1ameemicslt)sDrm( onu4opxomoeild a el(mp;t4tleomrcoodoaD  ivsls)texoim iodlmtemnetlt)arumxmpnt0altnio3tld aDrau s ()aetrmo3totomteaieo (0sexrimpno1ame lfctls sDtmxm oo0ope  icias m2ulums;()aexnio iy1lp eauei t seumim oudolen nei s s2uaump;u1tptoiociatlm el( pn(0texomrcootomt lnei;t)tetrir nu1opt  net ()srur(rpnt0opx  ieiys s ulu pn() lenxfctotopt auvi s)t2to(opiy1lm e netasfa2uru  nu4ope  f3tyd a ulnmo;u4tlenifcoy1faD an i;()t2urio nudlmen nvtatfarumx o;u0altn ieiytfaDeanvp;(0altrif3iytoatr ivol(0t2tm(o nu4lpen iei t) ruaxmont1aex mf3iltls2umnmont4 rxrxr oadlaD  ivi t0trtmirpoy4lme  nci tfs2rmumpoo0aet mi3ildfmDuaump u4trxnifctydlmDrlnei t0 2to(r3io4optelfctasfaDrauro;o4alto ieiyt m em(mp;() etrxf ootfa   uei s srur(r3nu1lmtn icsl(fartmu  no0apeo octysla ea(vp ()altnir io1fptrlivs t0 2urimpiu4oltn fcslt a2rrum oo4aleniieiytfm2ra(mo t0trxrio ootfptean slt0texrxo ny4lltemnct (faDrmxm ;o0aeenmoctys mDua( s (4 leomr iodlaDelu sls)t2xmxo nydomenlictatfa2taxro;o4aet  iciysfsDrm(vo u4texrxfcoydfm eanes;t) 2xmio io1ol nlivs tfsDtax oot1teen oeiytfm2rlu o;t0 lerio3tatfm  lueols s2uoxmpoy1lle mivs (fsrtm(mpoo1olxnmi3tltfsDelumpnt0tleoxr totomD au il()t2ur(rpnydll elieslt)arrmurpnt4tpeoiociytls uauvp ()texomocoatoat luvo s0t2xo(opiy4apt mncsas)arumurpot1oeeo ictld mDrauvp ()tltoio3oo1opD aueo (0tetm(rpiodlmeelfeia( arrmuronu4tpenmociysla2rauvs;u)trtomoctatlm rlnvs;( t2xm(o3nydamt mfvs sfaDua( pot4teto o3iasfa2rlu p;u4 renxr iotoptr ivo;t)sexrim3oy4am elfcsl()a2ra(mont4oetoif3tydlm2eau p u4texomr io1om  aieo s0 rtoiopnu1ol e iviatfaDuau  ou0aetnioeils aDum( s;(0alxnir tydlpteai s ()setoiopno1op nlnvtlsf rur( onu4optoio3iadlsDuan s;t) lenif iatfpt au s ()trxmxr io1lleelictlt)sDumur no4tlxo feild s2rlnmp u)trerioctadoaD ai ilt0trxoio oo1ol emfvtlsfsDtaxmo;o1ole moeiydfa ua(msn(0 leoxfcoy1fpD livo;s0 etmxopiu1lp   nei sf 2tm(  nt4tlxnio3ildlm2ran o u) lenif todfaD  ieo s) 2tmxm iu1am emnviat aDrruroot1tlxo i3iadls2ean o t4arxnirctadop   i o;( srxr(m oydopenlfcsltfs2rr(  ou1ale ifcilsls2rl(vs;u4aetrifciytfmte u s;( t2xrir no4optnmiesa() 2ua( o;o0aetnmocilsla2eln o;(0texrio oatlm   ivs;t  exoxr iodll elnviasf 2rru ono1aexo ieilt a um(vp u0tetnmocoydopt anvo () 2tm(rpoudlltemnvias aDtmx  ot1apeo f3ilsfsDuln o (0treoifciydom  aieslt0t2xo(r3nu1opeelnvta(fsDur( pnu1oltn f3ildlm2ulnvs;t4 rxrio3ta1fpDeaues ()srtoim3ny1lpe  neil(fs2uru p;t4alx  i3iatlsDum( o;u)artnmo oytlm elu ilt s2umiopoodopenmici t) 2rr( poo4altomoeiltfm2el(vsnu0 reoxo ia1opt  uvo s s2um(mpou4ole  nct (f Dtm(r ;o1aptnmiciyd m uanmp;t4artoif ootfa ranvil(0seum(m nudopee fvta(fsDurxr nt0ope  feiydfaDuauvs u4aetrxfcoy1opD luvi;s0setoirpiodlm  livtatfaDraum no4tle  octlt aDuau s;(4tlxoifciadlpD au i;t  exo(r3io1apt lieiltfa2taum ;u0alxomo3tatlm um(mo;(0 ltoxr tydomD aues t)trto(r oodoltelfcils aruau  oo4oetn ictltfsDrl(vo;u4tlxoir iotfa   i ilt0t2um(opoo1ome miciltf Dtax ont0optomi3tyslm ua( onu0tetrxo oodlat lneilt) etrxo nu4ole livias aDtmurpnt0tlxn ietyt a2ranmpnt0trxnmo totfpDr nvols) 2uoxm3iu1llt mivil()arurxrpno0oltnifeiatfm2ra( s;u)trtnmocoo1oat aieolt)setoio3iy1altnlnet (farumur ot1alxomf3tad m2elumpnu4 lxrmfcoatlpD  ies;(0 ruoio3no1am e ict s)a2urx  ;u1texnmi3tytfs emnmp t0aexnmr oatlmDeaieo;()sexmimpiodlpeemncta() 2rmxm ;t1aleomictadfm2ra(mont) rxnmrciodfp  au s;s0t2uo(r iu4ap e ivsa() rtrum oo1alt  ieiltlsDuaums ()aexoif tatfp eau o;t t2urimpiu1ll   fesa(  Dtax oou4tlt  i3tysfm2eanvs u)teeomf ty1opD  u i s)trtoirpiudll  mnvils arrauronu1tee  oeiyd s2elu p;(0artrmf3ootfp rauvs;s t2xmiopiudome  iviat)aDtaur ;t4aexo iciasfmDean s u4 etomociatlpte ivolt0srxm(o3oo1am nmfeias  2ururpno4tpxoiicias mDemuvpn()arxomr3ty1fat lnvs;s0srurxmpoydom nmfei sfsrtrxrpot0alt  feiytlm2rln snu4altnxr iadop e ies;t)setoxm3no4ole licsls) Drr(mpno4tetn ociydls rl( ont) rxrmf iatfp  liei t0 rtrimpoy1lm e fcsltfsruaumooo4tltnioetlslm rau p ()texrxfcoadfaDeanes t)srtrxrpoo1olenlfesasfaDrm(rp;o1apxn iciad a rauvo;(0treoxrcto1optr i o () etm(r3no1omee fcslt)s2ta(m ;o0tet  oeiydfaDum(vs t) exnio3io1fmD  neilt  exoir oy1ol   fei tfs2umx poo4apxomf3tadfsDrmnvont) exnif3oadlmt  u o s)sruoxm nodape  fcil(fa2rrumpnu4tlx iietaslmDul( pnt)trtomo iy1oa rluvo (0teuo(o3oo1llt lies tfsDtrxm ;t0apenmieiydlm um( p u0 ltrxrcoy1opt luvol(0 2umxr3io4apenlfct (fsDtmxr ou4oleomoetyslm em(vo;(4artnmo3todlatr ies;t0t2xoirpiu4opeemnes t aDtr(rpoo0alenmo3iad m ran pn(0aleniociodopte i o s)teumxmpny1oltemncia() Drrxmonu4tptn fctyd m2um( p t0altoxo oadfaDeli o;t)t2ur(r oo4ameemfeils)a2trxmont1tptomictys m eauvp;t) ltrmocty1la  aivo s0 2toim ny1ome mivslsfaDuaxrp;u4aptnifetyd m rau p u)trxrxocio1op   ies;t0s2xo(mpnudal nlnesas s2raxm ot4aeto f3iltla2rmumsnu4tleomr3tytlmDrlu i s)srurxr nodllee iei sf rrau ont1tetoioeiydlsDum( o t4artnifctadfmD anei (  2xm(o iodal nmicils aDtaxr no4oee  ieiltfs ulu snu4trtomrcoo1lmD  ivolt0trum(rpiy1amtnlfcsat  Drrumo;o4oet mfeiatls ulnms;(0 rermf3todlmDr nvo;s texm(o3iy4lmenlivils)srrmx  ;u0olxnio3iatla eln o t4aexriociodfa rli sls s2uoiopny4oltnlfetas arumuro;t4aexoif3taslsDum(vp () eerxfciatfpDeanes;()srtoxm3no1lm e iesls)s2ur(rpnt1optomfctldlmDelumo ()teenir tytoaDeanvil(0trxmxr nodlmtemnesas)s2umx oou0apeoii3ild m eau p;u)tltnxo3ty1fmDeliesls  2uriopio1lptemfvilt  rrrurp;u0tlxoio3iydfa2ranvont)aeermo oytfm r i s (  exm(m3ou4amee net ( sDrmxr ot1altniiciaslm2em(mo u)teenmociadlmte ies;()t2trxrpnudom  mnctlt)a2tmxr ;o0apxnifeiaslaDra(mp (0aetrxf3iatopDran ol()trtoxr3nodomenmfcsl( sDumur ou1altoiietysfsDelnms t)alxrmo3io1fatelu o;() 2tr(o3iu4ome lfvt (farrr(  ;t0apenmieiysfmDel(mo (4 rtrifciytoaDr u i;(0 rtmxo ou4op nliet t s2rm( ono1oltnmo3ils aDuanmp u4altrmrcoodlm elu o () euo(rpoo4amte iei (  Dum( oot0oeeo f3ild s ulnms;t)teeoif3tatfm rai i ( srxr(r io1oltemivtl(  rrr(m no1tlxn fciltls emuvsn(0arermf3tydop rln s;t) rtmxrpoy4alenmnvsl()s2um(m ot1opto ieiytfa2ulnvonu0aetrmo oydfpDr neo t0 2umio no4llte icsls) rtmxmpoo0aeenii3tytfs2uluvont) ltrxocoodoate uvi () etrxm3oo4lme  iesat artaxm oo1optnmfeiasls2elnvpn(0aeeomocoo1la  au o ( s2uoir iydomt lnvta() Drru p;t0oexomfeiadls2ranvs;t) etoxfciydom eanei;t srxriopnudlm  lnesa( s2rr(r ;u4alx moeiadls ulu s u) rtnxociatfmDelneslt0sruoxr ou1ll eliei s)a2rrxmpnt0optnmiciytfmDulnmo;t0arxoxr iy1lat livs;()t2ur(r oy1ll elieiat a2rm(mpot0tlen octad sDrmu o;t)alenmfcia1fm  ln i s)teumimpnudolenmncs tfarrmuronu1olxnmictatfm eau o;()artoxo3oydfa eaivs s teumio oy4op e fetls)sDtmumo;u4tlxoioeiatla rlnmp (0tlxnxo io1fat li i t  2xrxr3ny4oltn fes sfaruaxrpnt0opeomfctaslm ua(mo;u0alxomo3oo1lmDeluesls0 eurimpoo4ap emnvsls sDum(mpno1ape ii3tasfs rm( p;u0trtnio tydlat  uvs;t0trxm(opnodlpte fet t)artmx o;u0tltnifctat m rlums;(0tetoif3totfpt  n o;s texr(mpiu1olen ictasfarrr(r ;t4tlxn ietatfm2ul(mpn(4alxnmr3ia1fm   nesls0s2toxr3iy4alt  nvia(f Dum(r ;u4apx ifeiyd s2umnmsn(0aleoxociy1opt livo;() rumxo3iy4ope  nct t)sDuax  no0alxnmicilsfm umump;(4trtrxr oa1fmDrlueol(0t2xmxopiodame mnvsl()arrr( ooo4tlx io3ildlm raumonu0 eenxoctytfp rlnes;t) 2umim3iy4am   fet s)srrrxmo;o1opxoiiciysfaDemu ont4arenio oatfmt au s;t0s2toxrpou1olte fvsltfsrrr( p;t4apxnmfeiat m2emuvon()tltriocoa1latr n s t srtr(opoy4al emfetls)s2ta(ront0teenmfeiyt sDulnvpnt4tlxnmf todom elnei () rxmiopio4ale  ncilt)srur( o;u1opx mf3ildfsDranmon()trxrmr3iatlptr uvs;s)srxmxo3oudomtn fvs ( aDrm( pou4opxoif3iatlm2ra(mp;u0aeeomr tadlpD  n slt teuo(o ny4lltn ietas sDumumpno1tleniieils s2eauvpnu0aeenio3iatopDr neol() 2tmir iy1ap emfcsasfartaxront4tpt  ocildls rln pnu4arenio iytfp r ivo (  exmio nodol emfetl()aDuax onu1oet mf3iltfsDeluvont) exrif tytfp  auei;(  ruoxr oo4lpee net ( arrrum ;t4opeomieiydls ea(mp u4aetrxf3iatlptelueolt0 rxrxm nu1altnlfetas arumxrono1apeoioeiydfs2rm( snu) rtrxo ty1lm ranei t sruo(m3iu4aptnlfes t aDrr( poo0aptn fciyt aDrm(mp u)arenir oo1late neo;()srtmir nu4om n ivsa(farrm( p;t1tlx  icilsla eauvo;u)tetnxr3oadlmtr n o;t t2xm(o oodop nmictl(  rumur nu0aexniietytfaDua(ms u0 leoxr tytomDelnes;s) euo(r iudomee ivtas  rrau  nu1olenmfeiysla uau s u)altnmfcto1lpt ai i ()setmiopio4al nmfviat a2um( p;u1tltomocils mDua(vp t4 renmocoytfa  liei (0t2tr(o iy1lp n ivil( sDum(rpou1oeeoiieiadlm2ranms u4tltoif oadop   neilt)seuo(o3oo1lmtnlnetl() Dtr(mpot4tee mociasla emnvp u4 leomrctatfpDrau s;s0teur(r3io1omt liei ( artmx o;u4olt mo3iytfm ean s;t0 etoxo3iodlpt  ivil(0s2urxrpoo1op elnetls)srumxm nu0tlxomi3iysfs2ran o;(4 lermr3iadoaD aues;s srtr(m no4ape mneilt)a2rm( o;t4aeenmociydfsDuau ont)texrmf to1omtrln s;s)teurxr3nodameemncia( artaxm nu4aex  o3iat a ranvsnt)tlxrir oa1oa e neo;s)tetmxm iy4aptelfeias) 2tmxmonu4tlenio3iadls eaumsn()artoir3oytlp e n s t srur(opiy4olt lfesa(fartr(rono0opxniieiyt aDuanvp;t0 exoxr oodlp rau i t  eurir no1ol nlicsls)sDtr(m ;u4tee  ieiad aDuln s;u)areomocio1fmtrlneolt0srtrim3oydape mfvsa(fartm( o;o4olxn icilsfmDea(vpnu) ltrio3iotfp rau i;s0truoxopou4apt  ieta(fa2trx o;u4tlx if3tad mDemnvsnt)trxnmf iatomtelivi s texoio3oo4amtelncsl()sruau ont4olt iiciysfs um(mp;(0 rtoxocia1opDe iesls)t2tr(o3no4amenmnci t srua(  ;u1apto f3iadfs2rmnvs t0 ltnioctotoa eli i t)texrxr3iy4apee fvi t) Dtmx ont1tlt ifeiadfm rmu s;t0arxnmo3tytlpt li i;s0 eurirpno1ap n fct sfs2rmurooo4tle  oeildlmDemn ont4 rxrxfctadfpD lnes;t0teum(m3oy4oltnlfci (fsrrax p;o1oeenmf3iat s2rln s;(0artnmr iadop r nvi ( t2uriopiy1ol nmfeia(fs2rrur ot1oetn i3ild aDel(mo (0teenmr3oy1opte nvs;t0t2xmimpiy1ame  fct t)a2trurp;o0alxoioctytls umuvo (4 leoxr3ia1laDrlnesl()texm(r3iydlptelivsat)a2tmxmoou0aetoiictltfmDumnvsn()artrxo tadfa r u s ( s2xrxo iy1omeelicslsfsDum(  nu4ale moeiydla rln pnu0 eermr tytfmDe uvi;t) rtm(rpiodol n feilsf 2uaxmo;o0tlxomf3iydfa emnmo;u)tlxomr io1laD aies ( s2umxr3iydap e nesas)a2umu pno1tle  oeils sDrlnvsnu)trxrmo tadfmtraieo;(  etmxo3ny4omee icsatfsDtaumpou1olx  oetadla2ulnmsnu)tltnir3oa1lpD  ivi t)srtoxopiodomtnmicta()srrrxrpno4tet if3iytls uanvpnt) lxomrciatlateaivs t) exrxopiu4ll  miesas)aDtrxmpnu4oeenmi3iydla umnvs u) ltrir iy1faD aivi;(0trtoio3ny4opeelivt s)artrur ot0alxnifeiyt m ulnms (4altnmr3oa1omt  i i;s tetoirpio1ll n ivslt)s2rm(r nt1openifeiad a2rm(vo;()tlenif3io1faDr uvsl( srtrio3io4lpenlfctl()sruru pnu0open feiys s em(vo;u4tlxrxrciydfpDrlivi;( srtoxo3no1altelfcsa(  rur(mp;t0texnmocild sDran o;t)alxnmf oadlptean ols) 2tmio3oo4amenmfei tfsruau p;o1oet  o3ildfm ua(mo t4 rxnxf totfaDrauesl(0 2toxm3iodol nlfcslt a2tru p;o4ope ii3tysfmDuanvp u0arerxf3oadlpDrlivils0t2xoir no1ameelivtas)artr( pot0altnmo3tasls el(von(0tlxnxf3oatfpDr uei;( s2xmir oo1lp emnctlt)s2tr( o;u1oet mo3iysfs rmumpn(0texomr ia1lm r uvo t0srum(o iu4alee fetas) rra(mp;u4alx mf3tyslm2ranvp;(4 lermoctatoaDe uvo s0s2urir oydol e fvilt  Dtru onu1oltoioctydfa emnmsnt0 etrmf3oa1fp raivo t t2tm(m oy1ll elfcia(  Dtm(  ;u1oetnmieiydlm rm(mon() lenmr oytlm   ivi;(0t2xmimpno1lpte ivsl(  2trum ou4apx  oeiadfa rau snt0 ltnmo tadlm  luvi ( sexo(o oo4op n fvt sfsrrru p;u1tltnmieiatlmDran p;(4aeerio3io1oa  li olt)seto(rpoo4alen neslt sDurxronu1oex mictytlaDem( on(0aeeoir3io1om  anvi;s0s2toxr iudapt licslt aruax  oo4opx mieiasla umumo ()aetrxr3oatoat li sl(0 2xo(rpiu4lm  micil( srraur nu4ope if3iyslsDrmnmonu0 ltnmr3oytlptelivo;()teto(opoo1omt  fvsa()srtr(moot1ope mf3tydfmDeaump;t)tetrxo oo1om  li o;s0 rto(o no1llt mnvt ()srra( oou1olen feils aDemumo () etoio oytoa raivil(0sexo(rpou4ome lnvtls)s2urxmonu1aet  feildfa ul(vont4 rtoxoctydopDrlivo s)srtoxm nu4lm elictat)sDtmxm ;u0apt mietad a2rl(vs;u4alermrcoydfa  ai s;() rurxopnudam  miet t  rua(m oo4apx mfeildlm2rlu o;()texnmfcoy1lpD luvo s)t2xo(mpoydlpeemivsl()s2uau o;o1opx  ocilsla2ulnms (0trtrifciotoa eln sl(0texm(r3no1lme  nesa()srtmx oot0tlt moctydfs rl(mo (0texrif ty1oa e i ol(0trtmxo3ny1ll  miesa( artrur ;u4tleo ietldlm2elumo;(0tleoxr oydfpDeln o;( trtoxm3nodopt  nvias)srtmxmono4opto icildfsDulnvs t4alerifcty1laD  uvils s2trxr iudlltemfcta(  2ururo;u4olx ifciytfm2ulnmo u)teerir3ia1faDe i i s)sruo(o3ny4aptnlfeiltfa2ur(m oo4olxnmoctldfsDrm( s ()tlxnircoydlatean sls) 2um(mpiy4olte ici tfaDum(r oo4ole mo3ildla2raumont)arxnxoctadfpD ln s t0t2xrio3nydoptnlneilt) 2rr(r ;t0apt  o3iatfa umn p;u) ltrxo3tydlptr uvo t)sexoir3iu4olt mnei () rumx pou0aet  ietltls umu ont0aleoxf iotlaDrlnvi t0trurim iodaptemfvslsfarua(r nu4oexnmictad s eau pnt0artrmrciydlp  lu o ( trxoxrpoydlltelietlt) 2ua(moou4tpxniociaslmDrluvo (4tleoif3tadfaDr uei s)trur(o3iy1am e nci s a2um( ont4ape ifciyd a2rmnmp;(4tlenio iotfa elueolt0 etoxr ny4lm nlietat)sDtmxront0openmiciydfm rm( s u0texoif3iodom raiei s)setmirpnu4apt mnvils)sDurumooo4alx ifctltlmDra(vp;t4alxrmr ia1omt au i t0s2um(m nydom n fctlt) rrmuro;o4apx  feiltls2ea( s;u)trenir iytfaD auvols srtoxm3oodllt mfvi s)aDrrxr oo0apxnifcildfm2ra(ms ()aeenmf3tydoaDr ieo (0 eumxm nu4om n iet sf rrmx ont4apen octysfm2emnvs ()alenmf3todomD lueo s s2um(r3iydalt mfciatfsDurxrono0ale mociydfa2ul(msnt) ltrxf3io1lp  lneo t)srtoxopoudapenmfeiat)srtmx  ou4apeoio3tytfmDean sn(0tlxrxf oa1omD aiei;()texrxo ou4apt  fcta(fsDrrx onu1aexnif3ilt a2ean s;t)tlxoxoctytlpteaneil( srxoio3nydolee feil()s2rau p;t1alen ociatlsDel(mo (4 lenir oatfpteanvol(  2xoxo3oodlltn net s aDuaxm ot1oee  i3iasfs ul( s;()tltoio3iodlate ieslt)srtmxm3nydomt lnesatfsrraxmo;t1oet mfctatla2ean pn()altnmo3iydfmte ivi t)srum(m3iudopt mieils s2urumoou4aetnifctatfa rln o t0trerif3totla rluesls  2ur(mpoo1lme  nct sfsrua(rpou4tee mo3tad m2el( p (4teeoif ty1oaDrau i;(0srtr(mpiydoleemfvtlt sDumxmpnu4oltnioetadfs2elnms;u4trxrxo3tadfm  auei t)setoio oy1lm n ivsa() Dua(m oo1tle  f3tatfs2rmnvsnt0 rerxf iadfmDr ueols srtrxmpoo4ame mnvta(f ruaxmpoo4aee moeiydls2elnvs;()tltoif iadoaD auvo ( setoir3nudll n ivt t) 2rax poo0apt ioetysfs2em( s ()arerxf3totlmDrlueils setm(o oodll n ictl( s2ur(r ;o1ope iieiaslm2emuvont0 lenir todopDe n il() rum(rpiydamee fci (f 2urxm oo4teen f3tld aDuauvp;t0alxrif3ia1lm raueils s2trimpiodlme  nes (  2trx  nt4oexnmieilt mDem( snu0trtrxf3tatlat  nvi s)t2xr(mpnu1op  lfci sfaDrm( ooo1tle  icilslaDrmu o u4arenio oatfmD  ivo;s0t2uoir3oy4lle lfeias sDrrx  nt4ole  ictytfa rlnmsnt)trermf todlpte i i s teto(mpiu4ol   nvtlt srururpou0tlenmocias a uau pnt4arxnmrctatfmtrauvi;( tetoio3oodaltn net t  rrr( o;o1tpxoifciadlmDrmu sn() leoxf iodfatranvol( trxoimpoodlpee nvtlt) rraum ;t0texoif3iyt s2ea( o u)trxrif oatlmDr nvslt) rtmxm3nu1om elnet ()sruauroot4tltn i3ild aDul(von()aetnxf ta1lm  aueo t) eurir ny1omtnmnesas a2uaum ;t4ole mi3tas s uanmpnu0tetrxr iy1lp  livilt0 rum(r nodop elivtlt  Drr(mooo4tpt  o3iasfs2eluvsn(4arxnxr iadomtrluvsls) 2tmxr3no4ol e ics t  rum(mpnu1texo feilt a rl(von(4alxoio tytlmtrauvi s setm(opny4om nmieia(faDuaumpnu0aex  ociys sDulu p;u0trxoxf3iodfmt  u i t)texrxo iu1alte nvia(fs2rm(rp;u0altoiocilsfmDemnmp (0artomo oo1la e iei ()s2toir io1amtelfci (fsrra(monu0tlt  f3iadfsDrauvp;(0trtrio3oy1fmtraneo;t0s2tmirpnydoltn fct s  2rauroot1apeo iciatfs emuvonu)texnmociatoa  lnvsls0sexr(m iydam emietas  rrmumono1tptniieiltla rm( o;t4artnxr3iatlaDrai slt seumxo nu4open fcsltfa2urxmp;t0olen o3tysfmDum( p;(0 lxoxo3iy1opDrau ilt)s2toxr3iydlpt  fei s) rtau oou4apeoiictatfa ranvs;u) rtrio iodfmt anvols tetoxo oudlltn ietl(f 2ur(  ;o0tee  o3ias a2elums;(0 ltnxr3iy1lmtrln s;s  euriopnudlpt  nesls) 2uru oou0tetnio3iytlm2ranmsnu4teenmo iotlpDelnes;t) 2xo(o3iu4optnmivias  Dtaur ou0oltoio3iyt a2ulnms;t0teeoxr3oy1lp ean o t sexo(m ou4lpeemieia(fs2urxrpoo0alen feildlm2uluvp t0tltrir3oadlp e uvs;s0setrxr3oudlpe mies ( srra(m nu0oexoif3iltls ranvp;()trxrmfcty1lmDe n ols)sruo(o3oy4lpt  fcsa(  Dtmumpou4aet ii3tyslm elnvo;(0alenmr iydoat lnvil( trtmxm oo4ll n ivt (fsDtaxmpoo1aeenmf3taslm eauvo;()aexnxfcoodopDr uvsl()truo(m3nu4ope mncsat) Dur(moou1aeto ociad s2em(vonu0aetnxfcoadopD lueols0s2toim no1lm  lnvils) 2tmx  oo4apxomictytfmDrm( snt0arxnxo3todop e nvslt0srurxr3ny4aptemies (fs2umx o;t4aeen i3iat a eauvs;(4teeomociydfa eaivs;(  rxr(r oodomt lnvi tfa2urur ;u4olxomo3iaslsDrluvs;t4 eenxr3ootopDr ivo;t) eurir ou1am  mici (f 2umx  oo1oeenmociltfs eluvs (0aetrmf iytfp   nvslt s2uo(o3oy4ape mfviasf 2ua(root4tet  i3iatfs rm( snu0 renxr3to1oateli olt0t2uoio io1am e nvt s aDuaurpnt0oetnii3tltlsDrau snu0aetoif3ia1faDrauesls0 rtmxmpoy1ll e fviasf rrm(r oo0oetomf3tltfa rl( s;t) exomfcoy1lmtrlueo;t t2to(rpiy1lm  lfesat) Dtaurpou0alxnmi3tldfmDumumpnu) leomf iy1fpD liesl( sexmim3iudale  fvslsf Duru ono0alxomo3ild aDemums (4trtoiocoo1laDr uvi s) rumxmpoudapenmivia()artr(mp;o0apxo octadlmDum( o;(4 eeoir3ootlmteauvsls0trxm(opno1ol  mnci sfaDrr(rpno0aexomfcilsfm2ea( pnt0tlenio3todlpteaivsl(0s2trim3nu1ap nmfcs s s2trxmp;t4optomociyd mDrlnvo t)texrmo io1la   n s t t2uoir3no4olte ieslt  2urx  ou4aeenmo3iatfm eaumo;t4 etrifcta1oaDrlieol()t2urirpoodll  lneslt  2urx o;u0opxomf3tltlm2elnvp u0 exnxr3ia1fmtelnvs;t srxo(rpiudaltn nvsa() 2trxr oo0olxo fetatla em(vs;(4trxoxf3tatoate ueo ()teurio3oodlleelivsatfsrrrum nu1aleoifctld mDul(mo;t4teeomf3tadfp rluvilt seuriopno1lpeemnvta()sruaxmp;u4alxn fetldfmDrl(vp;u) rerxfcoydoptrlneil(0teuoxr oo1op elict (f 2ur(mpou1tee  feiydfs eau p;(4tltnmo3tatfat au o;( trtrirpiodopenlnvi (faDraxrpou4texnmocilsfsDrmums;u)tltrir todfpD an s t0tetoio ou4optn fviltf Dtm( o;t1oet  iciadls ranms;t)tetrmo3ia1lp eli i s)t2uoxr3iydlpe lnvs ( srrmum no0aeen ietat sDum( p;(4tetrifctadomDeluvslt  2tmim ou1ape lfvta( srta( pot0ope  fetltfm em( o u0 exrif oa1lmt lieo t)setmio3nu1om nlneilt s2urxmo;t1alen f3iytls emu o ()artrmr tydla r n sls  rurxrpnudll   fvtlt) 2rau  ;o0oet io3iadlmDumuvo;t4artnxr ootlpDelieils0t2uoiopio4llen ict t arua(r ;t1apx miciatla uauvo ()tltrxrcoydfmt lneo;s)s2xoxr oy4ame lfesat) Dum(m ;u0teenifciltla rlu p;(0teeriocta1opt livi s0 rxoxrpoy1lptnmfetlt  rum(  oo4oeto o3tytlm umuvpn(0aeenmrcto1omDe ieo t) exrxrpoy4oltelictl()srum(m ;u4tle ii3iytfs um(vp;()artrir ty1lmteluei;s sexrirpou4ameemfetat srtr(roou1aleomictldlmDulnvo (4 lenxf ty1op   ivo;s0t2xrir3ou1llenmnet tfaDrmxrpnu1oetomfeils a uluvo t0 rerircta1fa raneo;(0 etmir nu1aleelfcilt  Dra(rooo4apxoifetlt s2uanvp;u4texrxo3iadlp e ivi t) 2tr(r3oy4lltnlnvils)a2rrur ;u4aet  fetadfm umumonu4aexomr3tydlp eanvols) rxm(r3iy1lleemnctat  2uau ooo4apx moctldfm2rl(vp (4 etnxf ia1fmDraivo s) etr(m3ou1al   fes sf Dtm( pot1tpenioetytla ra( o u4tlxrifciadlmt aneo;t) rto(m3ou4ame mncsl(f Drau  oo0olx mo3iltla emu o;(4altrio iy1oaD  neslt0 rtoimpiydlp emiei tfarraurpnu0apxo fctad a2em( s;(4aetnio3tytom   i ilt0tetm(rpiodoptnmfvia( a2ta(rpoo1oex mfctydfm2ua( o;u4tlenmo3ootoaDeln s;s s2xo(mpiu4lm elfcil() 2tru oot0alt ioeiysfaDem(ms;u4areoirctytopte ueslt tetrxmpiodapt  ncsat) Drrxm no4olto fciltfs2ulnms;() eermfciy1opteliesls)trtmio iydlmeelnvsatf Drax pnt1texnmi3iat a2um(mp () lerio oa1oa ran o;(0 rxo(r oydopen fet s srraxront1apxnmiciat aDumuvp;u) exnmf3iydlmtraueo;s t2xm(opou1am nmfes t)sDrmxm ;t0tee mi3ild m rln o t0 ltoir3oatlat luei s t2tmxm oodome mfvs ()srtaxrpnt0apxnmoeils m rmnvs;()aetnmf ootfm rai sls)setmio oydop nmnvia()aDrm(m no0aexo ociysfs2ul(mp;t4aetrir3tatfpDraues;(  2xmxo3io4lm   ivs t)a2trx  no0olenmi3tatlm2eauvon(4 eeoxfcoydfpDeau ol()teuoxo no1lp emics s  Dum(  nt1texn i3iatfsDeau s u) rtnxf3iy1lptr ies;t srxmxr iudlpen fvtat) Dtm(m no0texoiiciasfmDrm(vo;(0teeoxf iytfpDranvil(0 2trir oo1lp emnet s)a2tmuroot0opto oetys a rmn sn(0alenxrctytfa eln o;() ruoir iu1apeelfesl()arrmx oot4tex io3iatlmDulnvo;u)tetnxr ta1lpt aiei;s0 eumir iy4olt lietlsf Dtr(mpot4texo iciytls elnvs t0aeerxocoy1opt aieo;t  2xrxo3nydlp emnctl(f rrr( p;o1opt  oeiysls rau p t0 eerxocoadom  aivils)trxm(o oudaltelfci t)artax  nt0oet if3iltfa em(ms;(4aetrif3oodopDeluei t0 rtrir nudal   nct sf 2raxm nt1olxnio3ildla2ra(vpnu0 rtoirctatfp rlnvs (0srurxr3oy1llt  fvia( sDurum ;t1tpenifctas s uanvs u)tltoiocoo1omDe ivs t)s2xoio3iy1ome  ivi s)a2rrx  nt0aet  octytfa umnmpnu0trerxfciodoptr uesl()texmxm3oo4am  lnvi s  rtaurpno0texoio3iadfm2ua(vs t)altomrcio1fp r ueolt)srum(opno4apeelfeils a2umxront4apxnmoeiasfsDrmnvs u)tltnxoctotfateluei;s0sexm(mpny1lp n nct sf Dra(r no4tle moetat s2eluvo;u)teeoio ty1la   i o t  rurxrpoy4lm elieia()srrm(mpou4tlx ifciatla2uau pnt0alxrmf oodfm e ivo;s srxoxrpoo4ol  livi () rraxront4apx iocild s rluvon(0arenxociotfpt ai olt)seumxmpiu4lme  neil() 2tr(mpno0teeomfeiysfs el(mp u) rtnxf3ootlmDeli o s)s2uoio nodoleelncias)sDrr(m nu1opxnii3iatfs rau snu0treoxo ia1faDr ues;t trur(r oy1op eliciasfsruau  ;o4tltoifciyt s uauvp ()arerxr iatfm eli s s0tetm(m oo1aptemnetas)srrr(r nt0aex iietlsfaDranmo;t0arxrifcootom eluvs;s)t2xoxopno1amt livsls)aruau  no4aleomo3iytla2rmumo;t0 rxrxo iatlmDrlnvsl( sexoxopiu1oltnlfcsl(farrau onu1ape  i3ildls2eau onu) exnmo3iotoatrau ols  rtmio iu1opt lfvi s)a2rr(rp;t4alto icild m rlnmp;u)aetrmo3iy1fp e nvo;()s2umio ny1om nmnet tfs2rm( pot0aeeomfeildls emu sn(0 renxrciadfp e nvo t s2uoim nodam   netlt) 2raxmpou4apxnmiciyt s2ua( ont0alxrio iy1lmDelnvi t0 exoxr io1llee fcils s2ua(r ;u1texn o3iys a2emuvo;t0 etrmo3iadlptr n o;s) ruoio3nu4ome  ncsat srtmu o;u4opto f3iydla2ua(msnu0 eerxf oatopt an s;t0texm(opiu1lp   ictlt a2rrx  ot0apxniociys m2eluvonu4altoifcoy1oaDeln s t) 2toir3oo1om eliet t  2rmx pnt4opeo oetld a2uau p () lerxfcoatlp rlnvslt0setoio no4altelieiasfaDtmu p;o4opx moeiadla2em(ms;u4 reomo3iodlpD lnei;( s2toir3no4lp  lfes ()srtrx oot0tpe  ociadlaDra(vpn(4aeenio3oatlmDrluvi;() rxoim nydapen ietat a2rmum nt0apxo fciad s uau snu4tleoir oodoaDr ivsls0 2xoio nodlle  ietas)sruaur oo0opx  f3tyd sDemuvo t0alermo oy1fa r neo (0 ruoxrpoydlpee nvia(f rtaur ot0tlt miciasla eluvp;u)alxrio ia1lmDeanei;s) rumim no1apt lnci s)aDum( ont4tltnmfciysls2rauvsnu0aetriocoadfpDrlues;()teuoxopnodll e fvsa()arurur ;u4olt mfeiydls rmn pn(0areomr3io1laDranvs;s0t2xoim3oydal nmnet t  2tm( p;t0apt ifeiaslmDeau p;u4 eeoio iadlptraivolt0 exmimpou4ap  mfctas) rur(r nt1apxnioeildfa2ra( sn(0alenxoctodopDeaivo s) etoxo3oudlltemnetl( a2rru  ot0aetomocildfm eluvp u0tetrmr3iotlat luvs;t0 rtoxopio1lm nlnet t  Dtrx  oo1apxnmfeiys m ua(mp;(4alermfctydlp eaies ()setr(mpiy1ol nmfci sf Dur(  ;t1tlxomf3iyd a2ulnmp;t)arerxo3iatfpte u o s  exrxm oodap nmnvils srta(  nu0tpxnifeildlaDuan pnt4 rerxo tadfaDeanes;s)t2uoxr io1optemfvi s arurur nt0oee io3ilsfa raumpnu0 etnmr totlpD auvo s0trum(m ny1ale  fct sfa2rrx ont4olxo fciys m2ul(msnu0tlenircio1opDe i ils0 etmxr nu1lpe mncslt)a2tmxmo;t1oeeo oetltla eau s;(0trtriociydomteli s;t) rxr(r3no4op emnet (fsDrmuroot4alx mo3tyt a raumo t) leoxf3oytlaD ai olt  2trxrpiydlm  lfeiat artmurpou0aeenmiciyd aDrlnvs;t4tltnxf3iytfpDelieo ( trur(o3oy4ope lfesas s2umu p;t0oeeniictld a ua(vs t4 rxnio3iadlptrlneo s0 2xrxrpiu4omtnlicsl() 2rrumo;o0tlenif3iys s2rauvo u) eeoiocoa1oatelu s;t)seum(rpoodopen ncils a2tmum ;u1oeeomicilt s eanmon() renmf3ta1fpDe u s s0trumxo no1opt mncs s)arrrum no0aeeo fetlt a ul( p (0aexrxfciy1op   neslt sruoio iu4ol n ictas srtaxmpou0opx  oeils m em(vpnt4trxoif oodlaDrlnvi;s0t2xmir3oudlptnmfeilsfaDtru  oo4tex  ieiydfsDeanms t4trtoxr3iydfm eaneo s  rumim io4ll elneias sDum(moot0oleo oeild m2eanmsnu4aeeoif3oytopteluvolt  exmxo io1ol n neils  2rr(rpno1oet  ociat s eauvon(0aexnmocootlmDr nvo;t  etoxo3nydlmenlnesl(faDurxr ;o0ape iieiyt sDeanmp ()texoxo3to1fmt livsl(0srurio nu4aptelnvtat  Dumxro;t0oleoii3iatfs2emnmpn()teerifciodoatelueil( s2uoio3nodapeelneilt)a2trx  oo0aeto ocilsfm eau s (4 eenir oatlpte n o s0s2um(m3oo4ole  feilt aruaur oo4aexn i3iytfm2ua( o u) rtrir3iodfmDeln s;(0 rurxr oodlpt lnci (fsDrax onu4oex mfciat s rl(vp;t0aetomf oytop rau ol( t2xmio3nu4amte nvta(fs2uaxr ;o0tptoiieiaslmDea(vsnt0tlxrir ootlaDrlnvslt)trtm(rpnu1amt lnvia() rra(m nu1tlt iociydla eauvsn() reomr3iydfpDraiesl(  eur(r3oodlptnlics s sDua(ro;t0oet mictasfs eanvs;(4alxnio ty1fm  au s s truoir3nodame lnet (fs2tr( pnu0texo oeiat m2ul( o;t0altrmf iydfpt lnvi;s0 exrxmpiodaltemivsat srtruront4alto octys s ua(vp;u4tlenmocio1fmt aivils) exrxr3iydlmeelictl(fsrrrxmoou4tleoiictyslsDrmn pnt) ltomfctotla  aieilt) 2trxr no4lp emicil() Dtau p;u1apxnmfctatlsDrl(ms u4aexrmf oytom r ieo ( srurxo oudome livs ( sruax  ou1oeeomoeiyt s em(mp t4 eerxf3iotoa  anvsl(0 rxm(o3ou1optelfvt ( a2um(r oo4teeomietldfsDuluvs u)teerifctadlp eli o (  exo(m nodopeelicsl()srrau p;t4aexnio3tysls rmu o;u)arxoif3tydoatranes ()trumxopnydlm nlivt tfarta(rpno1ole mieiasfs2emn ont4tleoiocoytlatrln s;(  2tm(r3oy1olte ictls srrmumonu1tptnmi3ilt sDelnvpn(4teerxfctatoaD livs;t0 rxo(opnodapenmivt sf rraxr ;u4aeenmietas a2ran o u4 exnxf3tydfpt  u o ()t2xrir oudll elnctls)a2ta(ro;t1ope mf3iltfaDea(ms t)alermrcootoptranvo;t  rumim3nu1oltn fetls  2um( pou0alenmietadfsDumuvo u4 rxomr3iadlptranei ()tetoxm3nudapte netl(f Duaumpot4tetnioeiytlm2umu pn(0 rtnmfcoodomDeauvo t)t2urir3no1al elnviat)sDua(m ot4olxnmieiydfs ulnvs;t0areniociotlptr nvs;t t2xmxo oudlm emfeta(  2tau pou0tlx ii3iadfm2ua(vsn(4 rtnmocoo1fmDr neslt0srxr(mpoodalenmietlt)arrm(rpno1aeen o3tydlaDulnvo;t)trxoxo3oatomte ues t)s2xmxm3no1ll nmnvslt) rrmxm ;t0texoio3tlt a2eanvs;(0altrxr ia1oatelnvs;t)t2toxopiudlpt  ivtlsfa2rr(ro;t4oltoif3ilsfa elu p;(4tleomo io1op  au sls0s2xoio3iu4am   ictat arum(m nt0tptniieildla2uau onu0altrxo oatla ran ols)sexrir iudop n fei ()sruru poo4oleoioeiyt sDrl(ms t0tlenio3totla elu olt  rto(r3no1lmtnmnvilt) 2taxm oo0apto iciydfaDrmuvo;u)aeerio3iodlaDe nes t)setmxm io4amenmncsa( sDtax ooo4oexoifciat a emn o;(0 rerir to1oaDelueo;(0t2ur(r oo4al nlncia( artmx ooo1tetoif3iadlm2uluvo u0aleoircoo1oaDelnvolt s2uoxopoy4amtn feiat)s2ur(ro;o4oltnioctad m rmn s () etoif3ta1la rlies s teuo(o iu4lp n fcsa( srrm( o;t4alxn ietasfs um( s t0tltoir3oadfaDr iesl(0 2tr(o3nu1lm  lnvsl(  2ururp;u4texn feiyd sDra(mo;u)trxrmrcta1oa e ueo;t0seto(o ou1lmt lnvil(  2trumpoo1opxnmo3tlsfa emu snt4trxnmf3oodfateaivs;s0t2trxm oy4lmtelncs sfaDtr(rp;u0oleoifciatlmDeauvo t)alenifciadla eau i s0texrim ou1om  lnvi t a2umu  ot0texomiciadfa raums;(4 rerxr iytomtran il( trurxopnudlp elivsa(  rum(mpou1tlxn fetyd mDeanvs u) lenio3ia1lpDrln i s0sexoxm3oo4altnmietas sDua( o;u0altomf3tyd s2uau p () etrxo iadlmDelnvolt)srtrir oy4olte fetls)a2ua(mp;t4olxoifetadfm2ulump t4teenifcta1fa r i o;t)texoxrpiu1aleemici s sDrrxm ;o4tee  ieiydfa eanmo;(4 eermf3totomDean i;() 2uoiopnudlltnlfcs t) 2tmx  nu4aet ifciyt s umumonu)alerxo3ty1lpteln ilt) euoxo ny4alt lncs tf 2uaumont1oetomieiyt mDrmn s t4arxrmf iytlptraivsl(0 rtoim iy4ap nlici s)sDtax  no0texn oeiatfm elu snt0teenioctadlp rauei ()t2xrim iudllt  fctat)srtm(m ;u0tpt mf3tatlm2rl(mo;t0tleoifcia1la  aneo;(  rxmio3io4lltnlnci s)artau onu4alxnioeils mDrlu o ()tlenir ta1lpD auesls0sexmir oo4lp   ivil(fa2umx oou1teeomietldlm ulu o;u4tlxoif todomteaivi (0trtoxr3oo4lmee nvsls srtm(r ou1aleo feild m2raump;() exnmocoydfmD lnei t) 2trxm3iodamtnmfvsat srra(roou1alt mf3tlt sDeanmsnu)aexnif3ta1laDeau ilt)seto(opnodam   fesat s2rmx pno4opt  ieiad aDuluvp u) lxrif3oy1oa e ies;t)trtrxm nydlmtnmfcs sfaDtr(ro;u4alen oetasfaDra(vo t4aetnif3oodfa  lu ol()s2uoxmpno4altnmict t srtaxmonu4aeeoioeiydfs emnvs t) ltomo io1fat anvs;()s2uoir io1altelfvils) rumu p;o0oetomo3iys s el(vs;() rerifcoodfpte ueilt s2xoio3oy1lleemivsls  rta(  ;u0tpxoif3ilslmDuluvo ()areomf iadoa ean i s0 2umxo oy1alt liet s s2urxmp;u0tpxniociatfa rm( p t0tleoir3tytopDr n s;s srxoirpio4amt mfcslt)sDum(moot1oetomictat s2emumsn() etoxfctytoa   ieilt)setoxr ny1lpenlfvta()srur( pnu1opx  ietat a umuvo (0 lxrxr oodom r nvils0seumxopoydlltemnctat) Dtaxr ;u0olenifeias sDrlu sn(4arerxrcta1fmt luesl(0t2umxrpny4lmt  fvs sf rtrxmpoo4aetnmietatlmDumu snt)altrio3iytlp rln ol(  exrxm oudlme  ivsa()aDraxr nu4apxn oeias s em( s u4aetnmo oa1om  aneo (  rxrir3oydam nmfvi ()s2ua(  nt1tex if3iasls el( on(4 rxnirctadfa r neslt  rxmxm3ou1amt mnvilt) 2rax pou1tlx ioetltlsDum(vp (4aetoir3iy1laDr ueo t)t2xrxr nu1ol  lfei sfa2ra(r nt1oeeoifciydfm2ulu s;t4 renxo iadlmDranvs;t0 rurxr3oy1omenmfvtlt)aDtrxrpno4openmo3iytfaDeauvs ()aeenif oytop rlu o;s srxm(mpio1lmtnlivtlsfsDtr( ooo0ole ioctasfm2uaumo (4 ltrxr3oodomDeaivilt  etm(m nu1altnliet ()aDraxm ot0tetnifetltlmDumump;(4alxoxr3to1lat aieolt teumirpnu1lmeemivsa( srurxr ;t1tlxomfciytlm ea(vo t0tltrxrciatopDe n s t  2trim iydamtn ict ()a2tax  nu4alxomo3tydlaDrmumo;()tetrio tydfa r n slt  rurxo3nydlpte icias)aDrmumono4aetn ietlsfmDuan o ()trtomo3ta1lp   nvs s) 2xmxm3io4lmeemieslt)srtmx oot4aptomieiyd sDum(mp;t)artrxr3totoptranes;s)trxr(o3oudomee ivt (  Dtr(mo;t0altnmf3iat a2ua(vs t0alxnif oodlmDr nei;s0texrxm3iy4lp emfvsa()sDraumpot1tlxo oetysfmDem(mp (4trtnmo3ta1lmte iesl(  2xr(o3oydal nmietltf rrr( p;t4apx miciat aDem( sn(0 etniocty1fp eln o s)tetrimpio1ol nlfetl( aDuau o;u0apt  octls m uln snt)aetomr3tatfm eanvols)texrim3oy1omenmnctatfs2urum ;t4aptnmi3tlsfsDuaumon()tleoxr oa1lat lnei t0s2urxr3iodlm n fvta() rtmx onu1tltoioeiatlm2ranvonu)trtrio3ta1lp r u o s t2uoxopno4olte nvs t) 2tmx ono1olen fcils mDuln p t4 lxnxf tytomDr u o s  2urxo3nudol nmnvi s  rtmxm ou0tet if3ilslaDea(mp t0altoxrctytfaD  ivs (0 etrxr3ny1ome lfvsat srtrurpno1ole moeiyt aDeauvon()artoif oy1fm eli s;t)teurxo3nydopenlnes (fs2rr(rp;u1tet mfeiyt m2um( p;u4texoxrciotlpt  i ols teuo(r3iodaptn fcsasfaDtr(r ;t1apx ioctlsfm2uauvs u0teeomo iy1oatrlnesls s2tm(r3ny1optnliciat artrumoou0tpeo oeiltfmDuanmo u0alermocootfatranvslt) rtm(m3no1apenmivi s aDtmuront0alt iietasls ua(von() exoxo3todfmtrai o;t)texoxr3oy1lleemnvt ( s2taxmo;o1tlxnmieiyd m2elu o (4arenif3ia1faDrlu i t  2trim oodolte nvia() Dtau o;o4tptn ociyd m2uau pn(4arxoio oa1lp  aueo s  eumxo ou4ame lictat a2raxmonu0aexnii3iys s uanvo;u4arerif iodlp elu o;() 2xoxo3ny1al emfeiltf 2urx o;o1opxniictat a uanvp (0altnio3ta1lpDranvs (0teuoio nu4ope mnvtlt)s2rm(m ;u1aeen f3ildlm um( o;t4aexnmo to1lpDrai s;s trtrxo nudapt lfcsls aDtaur no1aexoif3iys a2ranms t)aeeomfciatoa e uvo t) 2uoim3oy4optelictat  rua(r ;o1tpt iocild a2uauvs t) exoif iadfmDr ivi t)s2trxr iy1lpee net sfaDua(rpou1optn octldls2uaump (4aetnmo3tatoaDr i s s)tetrxm3iu1olenmnes (fa2tr(mp;u0aeeomf3ild a2rmu ont) exnmf oatfpDrlu s;t0 rxoxrpio4lpe liesl( artrur ;u1oet ifciasls eluvo u4trxrxf3iodlm raivo s)texrxopoy1llte fcsat) rrmxmoot4olxn fciytfm2eaump;t0artrmo3oo1lp   u s;t seurxrpiy1lle lictlt srurum ;o0tlen iciatla uaums u)trxnxociydfpDrlivils srxm(m no1ap n ictas)s2tau  ot1altn feiadfmDumumpnu4aexrxo ootoaDeaivi;t) rxr(mpiodol elfeiat aDraxmo;t4teenmoeildfsDumums u0 rerxocoo1opteau o t t2uoxo iy4amtnmici t) rraxm ot0olxnifciat s2rlump;t4 rerifcoadoat  nes;() 2um(m oo4lpenmict (f rrmurooo1aptomictasla rm( pnu0aexrif todopteaieo (0 rxm(m3oudlle lictas s2taxmpoo1oltn ictltfmDrlu onu4alxrioctodfptraivo;t) etrxmpou1olte nesat arurumonu4aptnmoetldfa ean s;t)trxnircty1fpDeanei s)s2urxo3nydaptnmfvta()sDumu  nt0alxn ieiasfm emnvs (4 lenxr3oadfaDeaivilt) 2uoir3oy4olte fctasf rtrx oot0aeeoio3tatfsDulu onu) exoioctodfmDrln o s  rxrir3iudalt lnvslt s2rmum nu1alxnio3tls a2eaums;(4 rermr3to1fmDr i i;s0sexr(rpiydlm e netl(fa2uaxr oo0tptomfciyslm2ea(msnu0tlxrif3iodlmD livo (0 2uoxopiu1alenmfvtl()srra(r ot0oet  fctltfaDeau o t4 exomfciotfp e uvil( trtr(opnu1ol n fetltf 2taumo;o4apeo i3iltfm rmnmp (4tetrmr oytla rluvo;s)sruoirpou4apen fvsasf Dum(mpou0aexn ociyd a em(msnt4aeerxr ootoateanvils trxo(o ny4ole mietls sDtmx  ;o0ope if3iydlsDumu s;(4 etrmo3oodlat luvsls0 rxrxr3iydlltn fesls) Drr(  ;t1tpeoifctldfa2rluvo () rtnxo tatfmte ueols0 2urim3ny1ameemivil( sDrmu ooo4tlxoifetytfaDuanmo;t4aexniocootfmDelivo ()teto(m ny1lm  liet t)aDtr(m ;t4teenif3iydfa2uln s (0 renxf oatlm   ivi;s) 2umir3oudoltn fesl(  Drrum ;u4aet  iciltla2uau o;u0 lxrxf3ootfpDeanesl()trto(mpoydlmeelfvsls)sDrrumooo4alto oeiad s rl(ms;u)tetnxf3iytfpD  neslt0t2xoimpno4lpenlnesls arurxm ;u0opeomfetls a uluvsn(0 rxnxocto1fmDraivs;s)teto(m nu4lm nlici s  2trx oou0tpt ii3iysfm2uaumo;u)treoirctadoatr u o ()trumxo nodole lfei s s2tm(rpoo4aeenii3tysla2um( on(0arxomoctytomD livsls)trurxmpnu1aptnmncs tfaDuaxr ;o1opx  fctadfm ra(mont)teerxr iy1fatr n sls)texo(r3ny1oltn nci (fa2tmxrpou4olt iiciaslaDel(vonu)alxnirciydoatrlivilt) rxrio3oo4amtnmnci sf 2ra(r nt4tpx  fciasla2umn on(0tlxrirciy1fptranvol(0sexrxm nu1olenmnviltf rtm(mo;u0tet  o3tytfm2ua(vpn(0aeeoxrciy1latranvi (0trxmxr3iodalt  nvt ( aDtmxrpnt0apeomi3iatla rln s u)alxrxo3iydfa  anvs;s t2trirpnydom  lfciat aDum(  ;t4aeen i3tlsfaDra( o u)trxnxociy1fpt  n o;t  rtrim3io1omtemieslt) 2tau  ;o1olenif3tydlm2el( p (4 rxnif3iotfpt  i o;s0 2umxr oo4omt  fvt sfaDtrxr oo4oltn fctysfm ran s t) lxrmfcoo1laDr ivo;s0 ruoxrpny4lpt mivsls  Dum(mp;o4aetomi3iadls2rmumsn(4aleoiocia1om ran sls)s2triopiodlpt livs () rtmxmp;o0alt ii3iys a ra(mp;u) ltrxr oydfmtr ivo (  exo(m iudapt  fctls  Drmx ont1aeen f3tlt a2umn p ()teenmf tytlm e ues;s  2urim io4apt mfvi sfs2rr(mp;o1oex ioeiadfa2uln p u) ltrmfcia1oa rau o t0t2xoim nydlle mnet tf Drrxmpnu4altnii3tad sDrlnms;t0 rxnio3ootlm eauvs (0srto(opno4ope mies tfartr(ront4aee ifeiytls2ul(vpn(0texomocta1lmDeliesl(0 rurxo nudap elfeia(faDtr( pot1teeo ieils sDeauvp u0 lxomo tadlm e n ilt0 2ur(mpiu1op   fctas aDtm(rpnu4tpxnmicilt a2rmnvp (4tetrif3oatfateau i;s)seurim ou1lm elnesa(  2umumpoo4alt io3ias a2umnmpnt0 etoxf oydfp rlivs t0srxm(r oo1llenlfvia() 2rmxroou1optnii3tydlm em(ms;(0aexrif3oodlp r neo t0s2xmxr3nu4oltelics ( srraum ;o0apenmoeiytfm eln o u4teerir3iodomDrau olt0 euoio3iodolenmnesl(  2trxr no0ale io3iytlaDeln s u0arxrio iadoptrlieo;t srxmxrpou4openmnet 
\ No newline at end of file
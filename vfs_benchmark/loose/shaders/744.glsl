@@ -0,0 +1 @@
+neil(0trxoirpny1oltn feia(fartmu pno0aexomiciysfs2rl(msnu) lxomf3iy1late ueils setr(opou1lleemnct sfarraur nu4alxoioeiyt s uauvsnu0tltnio oydlpDrlnesl() 2xr(opnu1alee icsls) Dtrumont1aetnmoeiydls rmn s t0 etoio oytla   u sl(  2xoxr iydolenlfvt t a2rmum nt0apt  o3tadlm2umuvpn() rxnxfciodfa r u o;()texoio3iudlltemnesa()aDrmu ono0oetniociydla2el(msnu4teeoxf3oydlptranvil( seurxo3oodlpen nvtls sruaurpno1oltnmoetatla2eanmp ()aeermocto1fmt  n i;t0trumirpnydap eliviat)s2ua(m ;o1tex mictas m rl( on() rtrioctytfa r u i () eurxopoudalt lncs s  rraur ;t1aeeomoetatfs2ea(vs;u) rtomo3oo1lat lueo t  2tmim oudal nmictasfs2umxronu1openio3iytlsDem( on(4 etrmr3iadlatrln o t) rxr(mpou4amtemfet t  2ta(  ;u1optnmfciat s rlnvo ()arxomfctodfa  anei;(  2trxm io1ope lfct t)a2tmu ont4tetn i3iydfa2ua( p (0aexnmrcoadoptr ueols0 rxo(o nu1ame  fvil(  Dtaumo;o4alt  f3tltls2eanmo u0 ltnmr totlmDrlivi;(0seuoirpoodap nmnvsa(  ruaum nu1tpt mfeiydfa rlu s t)altrxrciadlp  aneol()teumirpiy4lpt lieias)a2rrxro;o4aptomieiatfaDeluvp u4trxnxoctadopDeau s;s)t2urio3io1lltemfcsa(fs2ra(mpou4tet  fetyslsDul( o;t) ltnifcoatlp raiei (0 exr(mpou1omt  fet (  2uru  ;o0olxniietls m2rau snt4trxrif3ootlpDr ivsls0 exoir3io4amtelfeta()s2rmxm ;u0optnif3tld aDra(vo t0teenxr to1oa  aies t)s2xrim nudlpee ictl(fa2uau  ot0oee  icilsls uau o t) exnxf iytfmtrluvo s)texoxmpnodapeelnvt ( srua(r oo0texnmocils s em( snt4arermociytop r n o;() exmxm3ny1oleemfesa()sDurx  ou0opxnio3ilt m uau snt0texrmr tadfaDelueol(0sruo(m3iu1omtn ncta() Dururp;u1tet mi3iytfm2emump u0altnxrciodlpDrai i ()s2uoxo ou4op nlietasfsDuaxro;t4olxoiictas m eanmo;t)tltrmrcio1lpt lieol()t2xrir3iu4lmt mfes t  2uaumpno1oeen ietys aDrau snt0 lenirciydlmD lneo;t0t2xrxopnodlptnmncta(fsrurxmp;t1apt iieilt m ea(vp;()aexnxfcoadopD  nes;(0texm(o oydol   nvtls)s2ta( p;o1tlxn ieiytlm2rmn pnt) reomocoydlm rluvi;()sexoim3nu4apenmfvtltf rta(m ;t0olto ociadfm rl(mon(0arenmf3oatlm  anes s)t2uoim nodomtnlictas)s2urxm ou0aee  oetlt a2umnvpnu0tlxrio3oodopDrlneo s) 2xmxr3oydlm e nes ()arumxrpnu4ale mieiatlm2ran pn(0 rtnircto1fptr ivi;(0 rxrxmpiy1am emivi (  rumxrp;o1olxoiiciatls ranmp;t) eenmfcio1fat an o t  ruriopno1llee fvtltf Dra( poo4tptnmo3tatlaDea(vpn()teeomfcoo1fat au o s)s2um(r nydllt lfetlt  rtr( p;t0tlx mfciat a2uauvo;()alenxo oo1faDr ueo;t) 2umio3oydale lnci s)srumuro;u1olxnmociydla2umuvp t4trtrmrcoydopt lnvo ()s2xr(o3iu1am nmfes t  rtax  ;u4aleoioetlslsDua( pnu)altnmr3oydlp r uei s  2umir3nudolee fviasfsruru  ot0oeen ietltfm rl(ms t0tleoifcoatoaDrlu o (0 eumir3iu1altemivia(f Drr(mo;o4apeomieiys aDulu pnt0 rxnif3ia1opDe ueslt0texr(opoydomee feta( srraxm oo0olto oeiltlaDelnms t4arerxf3iodfpD ai ilt s2trxo3nydomte ivtatfarrau pnt0texo iciasfsDrm( pnu0treoxo3iytopDe uvi;(  rxo(m iu1am   fct s)aDurxmpou4tpenmociaslm2ea( s;() lxnmoctydopD ln i;t0s2trirpio4opte ncsl(fsrtrx o;u0opx ifciyslm2eauvs;()artoxf3oodopD lueo (0 rtrim3ou1lmee nvt s)srururp;u1apx  o3tlt m emnms;t4tlermr tytfp r nes t truoxm iy1ll nmfcias)aDur(r nu4openioetys aDuluvp;u4alxomo io1opD aivi;s)trur(r nydlm n fvils aDtmur nu0oexoioetasfa2eluvo;u)artrxrcto1fmteaueo t)t2xoxo oo1ap   fetatfa2tmxront1tpx moetytfm2em(mo t4trtrxrcoydfp raiesl()sexm(m3ou4ame lfviat sDra(rp;u1aeeoiiciys sDel( on(4arerxrcoodfm elivo;(  rxr(r nudaltnlieia(fs2um( oou0tlx mfeiat s2eau o;(4 eenir3ta1oaD lnvsls0srxmxm oydapt livil()sDtax  no1tee  i3ildlm2rm(mon(0trermr oa1fa elnvolt  rxrio3oo1ame  fcslt  2trx poo4tee  oetld a2rlumsn(0artnmf3to1laD lnei;s  rxoxr nu1lleelivsas)s2rr( pnt1tex iictysla2emnvsnu0 rermfciotlptrauvo;() 2trxr oudope lnctls)s2ra( ooo0opeo o3tydfaDrlnvsnu) lxoifctydfa e i ol()t2um(opnodamt  nctls)aDra(mpoo0oexo i3iat m2ea(vonu4tltnmrctydfmDeau s;(  rxrxopoo4alenmicsa(fsDuau  ou0tltomicildfaDra(mp;t4altnmrciydfm   ivo (  rtm(opno1oltemivil()sDuau  ;o1tltomf3tad m2rmuvs;t)tltnmr3oo1lmteauvil( sexoim3nu1altelfciasfsDurumoou4apt  fcilt s2rmu p;u)areomf3ty1lp r nesls0teumxopou4al  mfesls  2rmxrp;o4ape  ieiltfm2umu s u4tltrmr io1omDeln o;s srumim3iudolt  ivilsfsrrm(mono4ole mfeiltls uanmont4tlxrxf oytfmDelieo;(  etr(r iu4lmte netat  Dra(rp;o0teeoioctltlsDumu o u) etomf tatoateau ils0srurxm3ou4lmtemncsls)s2ur(m nu1tltoif3iasla emu s;()tltoio3oytom elnvi;s0s2toxopoy1lltn neias)srtrurp;t1oexnmoeilt aDelu o u4 etrxo iydoaDrluvols srxmxopnu4ap elivsls s2urxrpoo0opx miciys sDuln ont0 exnmf to1fpt livs;s0srxoio io4ll nlfciasf 2umx pno4alxoifctytla2ulnmonu4alxoio iytoa raivi;s0tetmir3ny1op elnvslt a2umxr ;u4aptn f3iad mDrlnmp t0 lxoifciotfmD  n o;t) ruoirpio4lmt lfvi s  rum(rpoo0tptoii3ild sDua(vs;u)arxoxr oydop rlivi;t  exm(opiudlmenlnes sfsrtmx o;t1olt  ietldlm elnvo u0altrmocty1lptr u s t trtr(rpou1omeelieias  Dua(m nu1optn oeiasls ul( p;t) rermo3ootfp raneol( sexo(rpio1lp   nvi s  2taxmo;o4ole  oetytla2ulnmo u0 eenmrcty1lpt ai i;t sruoirpno1ap elicslsf 2um(m ou4aptn o3ilt a2eauvpnt4aeeomf3iy1oaDrlivo;t teto(mpny1apt  nei tfsrtmxr oo4oeto ociltfsDemnvp;u0areoircoytfmt anvilt seurxopiy4ome micslsf 2raxrooo0aleomoeiysfa rlump;t4tleoxrciytlaDelnvi t0t2uoxm iydll n nvsa(fsDrrur nu1tpxomieiytlm2raumsn(0alenxo3ia1oat lu i s) 2ur(m3nydole mfesls  rua(mp;o0alx  oeiltfsDrl(vpnt4teenxo iytoatean s () exrir3iydome  fcta(farra( pou1aexo i3iad s ul(vsn(0arxnmrciadfatrlues;s trtr(opnu4amtemnei t  Dta(roou4teenmoeiyd m2emu o u0aleoxr iotomDelueil(  2umir3iu1am e ieta( srrr(r no1aexomi3iytfsDuln snu0alxnmo3iydfmD luvilt  rtmxo3io4llee ietatf Dumu  ou0tleoiietas m2eanvp (0teenifcio1lmt  u i;( s2to(opio1ale mnvs sf 2ta(m ou0ale  feilt mDeau snu4 eenxrcio1fmDe neilt) rto(mpoo4al e fei t  Dur(mpno4optnmf3tad a2ulnvsnt4tlxrmocty1fpD lieols)texmio3io4omt miei s  rrm(  ou4opt  ictyt aDua(ms (0artrmf3ia1lm  luvol( s2uo(m3ou4ll nmicsl(f rurxm ;t4olt  f3tat s ulnvpnt) rxrio3tadomte uvs s0 2tmir3oo4am   fvt ( aDum(rpnt4texn ieiydfaDelu s;t4trxnxo3io1faDeli i;t0tetmxrpno4opee nci s  2tmxr ou0aeenmoctas m2eau p;(0artoio totoatr n i s srto(r nu4ameemiet s)s2tru p;o4aet mfciatlm rluvp;t0tlxomrciatopt aivo s0 2um(o3iodlmen fet tf 2taxr nt1oex ifeiydfa rlnms;(4tlxnio3iotomt ln ils) exr(opnudll nmfci (f rtr(ront1tleo fciytla2uau onu0arerxocootomtrluvs s t2xrxopou1open icsasf 2umu ono1alenif3iysfsDrl(ms u4tlxomo3to1lm r neols0 rto(m3oodolenmnesa(fsrrau  nu0altnif3tytfa2uanvsnt4aetomfciodom   u slt0setr(m nydlltelnesat a2uau pnt0olxomf3iydlmDemuvpn(0 lxrxociatlp elnvs ( teumxmpno4oleemivsl(f Drr(mpno1oetoioeiaslm2emums ()trtnxo3oy1lmtrln olt texrimpoy4lm nlneslt aDum(rp;u4olxnifcild m2rau on(4aexnxfcoadoat aivils trxm(m ou1open fet t sDua(  nt4tlt ifeiltfsDrm(mo ()tlenmr3iotopD lnvol( srumxm3no1lptemnvslt)s2ua(  nt0aex mo3iydfsDulumsnt4tltnmr3oa1opD ln ils  2xoxm3nu4olen iet t  Dtrxm ;o0altnmoeiad mDemu o t4arxoxr3to1opDr u s;( trtmxopiydaptnlfcia( artm(mooo4oexomo3iyt m2emnmp t0tlxoxf oo1opte n sl( seuo(o oydamt  ncsa( a2tr( pou4tpt ifciyt m ra(vs;u)texrmf ootla  an s s0 exmio oy4op  mnciasf Duaump;o4tpenifeiltlaDrln p;u4arenircoydfm elnvils0setoxmpny1openmfetlt s2rm(m nu1oeeomfctadlsDulumo u4alxoxrcoo1lp eai ils)texm(r3ny4lmeemfvils s2rmumooo0alt ifciatla rmu s;u) eenio3oytoa   ivi;s)texrxo3io1lpee ivi tf 2tax ono1optn fctys s2umnvsn(0artniocoytoatran i (0srxmxrpou1lp e ivt t aDur(  ;o1tleoiieiadfa2rlnvont0arxoiocoatoa eluvs;(0 euoirpou4aleelnetls) 2ra(ro;u4opxo f3iytlsDeauvont0arxrmrcia1fmtelieo (0 rxoio3iy1alt lietat)sDurx ont0aexnio3tldlaDuaumo;u4texoxo tytfpDrlnvi s  rxmxm iydomenmfesa(f 2tr(mp;t0olx iociltla2eauvo;u0texnmo3tytlp ran i s0s2xo(mpiu4ape  nvslt srtmu ono0olt  f3ils sDemuvp (0alermf3iodlpte n i;() eumxm oo4lpeelncsasfs2tru  nu1olxnif3ilslmDeaumsn()texrmr iy1late ivs ( texr(o3oudlm emivs s)s2tax pno0tee mo3iad mDem(vp (0artnmo3totfatr nvs;t)teuo(r3oo4lptnmnesa(fartru  ot0apenio3tlt a2uaump;t0artnxr oadlpD lnvo s0texo(o3no4alt  nvi (  Dur(moot4apeoifctydfaDua(vs t4treomo3iotfmt aivi;s teuoir oy1al nmfetlt) 2uaump;t0tpenio3taslaDuanvo u4 eenxfctodoat auvi;t)texmxopnudope  nvsasfa2rm(rono1texnmfeiyd sDemu o t4aeerxf3oytfpDeaueilt seuoxr3iudlm emnvs ()s2rm(mpoo4oexomf3tas a rau p ()aexrxo3tydlp rai ils0s2urxm3oo1opte nvilsfarum(m no1oexo ictadla2uluvs () leoxf3iatfmtr nvi t0t2uo(opoudlpt mneias) rumuronu1oetoii3iys aDul(ms;(4 reoxr3iatlaD aivs;(  ruoxr3nu4lm   iei s)aDum(mooo0tetnmoctat a em(mp (4tltomocoydom elies;t0 exoxr3ny4aleelici t) rurumpnt4opt moeilt s ra( o u)trxoxf3io1lm r neslt setrio3oo1lpte iei t sDrr(  oo0optoiociyd sDem(msnu) exrmr iodfaD aueol()s2trxm iodlm  mnvs t)arrmxrpot1tlxn feiydfm2um(mpnu4aeenmo3iatfmDe nes;t)s2xm(opnodll e icils aDraur nu0tpxnmiciysls2emnmsn(0tltoioctatfp rlivs s)s2xoxo3no4omt  ieilt aDtr( p;t4aptniocilslm ra(vont)trxnxo oa1lpt  i i t)s2tr(r ny1lptnmfctl( aDtmx oot0tlenmocild a ran p u4 exrmo iotlaDr ues ( trumxr io1llee ietltf Draurono4oexomi3iltfs2rl( o t0altrmr oytomte ues;t0trtoir3nodlle  fctas)a2umxro;t0opxnmf3iat sDrl( s u0trxnmfcoadlp  aneolt t2tm(o iu1lpenmncsl(  2taum ;t1alenmf3tytls umu s (4texomr iydfa r i sl(0srtmxm no1ol e ivi ()srta(moou4aeeo ieilsfa2eanvpnu0aleoifciy1oateau s s srtr(rpiy1olt  icsa(f 2rrum ;u1opxniociyd s2ulumo;t0artoxrctytlmtrli s;s  exoim3no4apenmiesl( s2urur ;t4aet mf3iytls rmnvs t)alenxo3tydfmDrlneol(  2tmxo oy1am  lietltf rrr( oot1ape  fetldfm ulnmo t4 etnxf3oytlptrai s;s0s2umxo3iydlle  ietlt srtrxmpoo0texn fctlsfm2rl(vs u) rxnxr3totfat  nvsls  2uoim io4open ivilt)aDrm( o;u0aeen f3ias a2rlnvs (0artoio3totoaDr u i;s)teumio nodapt  ncilt) rta(mpou4alxnmictad m2um(mo t4 rtomr io1lmDe ies;s  rumirpny4apenlici s)arraxrpou4tle mfeild mDrl( p u) eenxr3iadoa rluvils) 2xrxo io4al   icsas)sDurx p;o1olen o3iatfmDelnmp;u0tetoircoatla  lnvi t)truoxopou1lptnmnvi t) 2rmxronu1alx moeiytlsDumumo;u) renxo3ia1oaDraneil() rtrir ny4amenlnvi s) Durx pnt1tpt  fciytfs2elu sn(4artomf3iodfa ran s;(0tetmirpio4apee ictat)sDuau oou4tleoii3tat m rlu p (0tleoir iodlmD luei ()srtmio3io1aptn ivsa() rum(rono4tle moeiltfs ul(mo;(4aexnxo3oadlpDrlu s;s0s2um(r oudame lneslt arururo;u1oltn i3iaslm2rauvsn(4aeeoif tatoa eanvs (  rxo(opnudllenmfcs tf 2umxm nu4teeomi3tytlm rmn snu0areoif3todom e ues;s0 etmim iodamt  ivslsf rtaxmo;t1aet  fciltfa2ua(vont) exoxr iadfm  ln ols0 2xoirpou1omenlncsa( a2rm(rpnu4aee iieiytfa em(vonu)arxnmfcia1omtrlivsls)srxmir oudomeemfes t)a2ra( o;u1aptoifcilsfm2um(mo;t)aeerxr totlmtrluvi t) 2tr(o3ou4apenmivsat)sDrmxmpoo4oleo ieiatlm ua(vpnt4alermo oy1laDrlnei (0s2umxo iudol nlfvs s)srua( p;o4tpxnif3tytlm umuvo (4tlxnmo3oa1fptr i sls0 rtrxmpiodol e netas  rtm( o;u4teenmi3iat s elnms;()artoxrciatlp  auvi;t truoio oudlm nmnct s)aDurx p;t4tlt moeiytlmDraums;t0 ltoxo iodlmt aues;t t2uoir3ny4lp elfvtat)a2ta(rono1tpt  f3tat m ean o u)tlxrxfctatlmteanvsls0trxoxm3iudamtn ieil()sruru ooo0tptoifciydlsDel( p;t4alxrirciy1lat  u ils t2ur(mpoydlpe mfviat)aDtrxmpou1oleo i3iydfm uaumo;(0 reoxocoy1faD anvi t)s2toiopio1oltelics ( arurx pot0olx mo3iatlaDuan p t4arerir3tatlmteau olt  2urxm3no1al  mnciasfa2tauronu0aexnmfeiyt m2ean p (0trxrirciadoatean o;t) 2trxr3nudamtn icsa(  rtr( oot0tptn ieilt m eaumpn()aexrxr3tadop r u ils) rxoio3no1ll   fet s) rtaumpoo1oleomfciytfa2ua(vo;() lerxoctadfmt lu o ()teur(m3oodlpeemfesa(f 2trx p;t4apto feiadlm ua(mo u0teeoxr3iydla e n s ()sruo(o oo4lpenlnvs (  Duaxrp;u4apxo feiatlm elu p t0altomo3io1oate uvo (0 eurio3oy1llte nvt ()sDtr(rpno0opeoii3tadfsDeluvp;(4trtnio iatfmDr n s;(0t2xm(mpoy4lme mivt tfs2tm(m ot0apxnmiciytfs2rmuvp;u)trxoio3iotfmD liesls) rtm(r3iu4olenlnctl( s2raxmp;t4oeeomoetlt sDrlu p;u4aexrmo3tatfat au i;(0tetrxopiy1am nliet s) rtm(r no1oltoiociyslmDrm(mont4 ltnmf3oy1lm  luvolt) rtoir iy4apeelfvi ()srtmx ont4aptomieias m2em(msn()tetrmocia1lmD ai i;s0 exmxopnudlle mfetlt srua(mooo4opeo ociadlsDrluvo (4treoxo todop elnvsl(0 etrxo3nu4openliesl( srumxmpno0texomfeiytlaDemumo u) ltrxfcoydlmtranvi;t)t2toiopoydll e iet () 2ra(mp;u0tlenif3ildfaDumnmon()artrmfciatom rluvilt0 2tmio3iudllt lfvsl(  2truroot0oetnmoeiysfaDranmp;u0tltomo oodlatrln sls0 eurir3oydalenmnes ( s2rmu pno0ale iiciatfa2um(vs;t) eeoirctodopD aueils0texr(r oo4ame lnetlsfs2ur(rp;u0tlt ioeiat s rlnmp;u4 etnxr3todopDr uvolt0s2xo(opiy1lmeelncsls)sDum(rono0opxn feiad s uanvp u)aexrmf3ootfatran ils0setrim3oydopt mnvil() Dtmu  oo1teeoiicildfm eluvpnu4 rxrmf oydom r neilt) rxoir io1olenlfeias s2rmxmono1tex ioetytls ra(ms;u)trtomo3oytoptrlneo s) rum(opno1ll  mfcs ( a2rrur ;t4tex ioeiydla uluvsnt)alenmf3ootopt anvs;t trtrirpoudomte ictl( sDur(roou4olxoio3iysls ran s;t) ltnxr3iydfm  aivi (  rtr(opnydomte neiatf rumumooo0tptnmietlsfa2eluvp u4 ltomo3iodop elu slt0s2xoxmpoy4lptnlivsas  rtmurpno0oexo o3iydlsDem(mp t)tlxomf tatlaDrlu s (0trxm(m nudopenlnvt t)s2raxm ;t1alxnmiciltfs ua( ont0alenxf iotfpDe nvi ( s2xoio oydolen ncia() Dtru  ou4oex moetytla rlu p t0altrmocoodoa raivi t0t2xmxm3nu1omtnlnet s sruax  ;o4olxoio3ilt s ra(vonu) lxrmocoatoa  lnvsl()t2urio nodlpte ietas  Dtmxr ot0tet mictysfa2eln o;t0 reniocoo1lp  anvi;t0sruoxr oudom  lnetlt) rrr(  oo1optnifctyd mDumumsnt) lxnxf3ta1lp   uvs (0s2xoxm iy1ap nmnvils) Durumont0alxniictytfs2ran o;t4 etoxociotlate ieo;(0 2xmxopiudam nmncsa( aDtmxrpnu4apto fctadfmDrmn snt)artnmf oydfptrlnvi s0tetr(m iudlp n nvs s)a2rmxr ;u4tlenioeild m emump u4tlenmo3oytomDrauvsls)texmxopnu4al nmnei t arrm(mo;u1opxnmi3iydfm2ua(vo;t4texoir3tydoatr uvo;(0setmirpoo1aptelncs t aDrm(rooo1aleomfeiat mDumuvpn(4alxrxocoytoaDr ivo t  ruoim3nydlmte nci ()aruau p;t0alx  oetysfs elnmsn() eenxfcoodlpD  i o;t s2tmir3iy4amtn fcta() rumumo;u1aet  o3iltfm2ua(vs;() rtoir3oodoatr n s;(  2tmir nu4om nmiei t  rtmxmpnu0olxo i3iytls rmnvpn() etoxf3iatop eauvsl()trxoxr no4alen fctat)sDtaxronu1tleniieilt s2ea(msnu0alxrir3tytom   uvil( s2xmxr iydll emfvsls aDur(  oo1olx io3tlsfa2ulums;(0aeerir oydlmD ai ils) rtmir iu1lptnmnvtlt)a2uaxront1aeenmo3tld s eanvp u4treoif oatoaD lieo t setrio no1lpt mnct s)sDrmu ont4apenioeiyd s2rl(vo;(4 lxrxo iytlmt aneslt s2xr(opnudam   fcsat)a2um(mono0apeoifeiltls2umu s ()tetnmr totlmDeli olt0sexrxo io4olee ncsls) Duax oou4texomfeiadls2rl(vonu0aexnxociotop   n i;s) 2xm(r no4omeemnci sfs2rrxrp;t0ape  oetadlmDua( s (4trenirctodlaDelieo;t teumxo3ny4ape lnei t  Dur(  ;o4teto ociasfa2umnmo;(0tlxnxo tadlmDeliei;s0t2xmxm3nydll nmieta(f 2um(mpou1apxo fciad a ra( p;t)tltriociy1lmt ai slt0t2umxrpny4al emivtl()sDur(ronu1tpe mfetlslsDuan s;t) etnxoctydlaDr ivi;t)srtriopio4lp   neils  Dra(ro;u4aeen oeiytfm emu snu0trerxr3io1oatrln ol() 2toirpiu4op elnvsls srtrxm nu0alxo feildfaDrmump (4tlxnxo oo1lpte i s;s  etr(o3oodale lnvslsfsrrm( poo4oltn octld m rmu p t0 lerxr3io1omDr iei s t2trirpou4omtnmfci ()aDraxmpno4tlen fciysfa uanmp;()aeeoxo3oatop rlu s;s0seuo(r3oudom n ict (fsrtaxro;u4tpenifctld aDumnmp;u4 leniocty1om eanvi;( s2xoio3nydomt  fcs ( a2tru pou1aeeomoeiyt aDrlnvs t4areoirctotlatrlu s;t tetoxopoo1llte nvils)arrr( pno0oeeomicild m eanmp u0 exrxf iytomt  iesls) 2xo(rpiodomt liesatfa2trumpnu0opxnifciat a el(vo (4artoxfcoytlm   ieo s)sexr(o3iudlm  liviat)a2tmxmono4tpx  oeild m2rl(mo u0tlerxrciadfm raies (0trtoiopoy1lm nlncsa( srtrxr nu1oleoif3ilsls2emuvsnt0aexoxrciodoatr ies;s0 2um(mpnodapen fvtat srum(ro;o1tpe iociatlmDul( pnt0trxnif iytomtr i i t) exoio oodam e nvtl( arum(rooo0oeeomoctad m2ul( s;u0tltrxf3todomt li ils) rto(m ny1om n fcil(faDumxrp;o0olxomfetydlm2em(mpn(0alenxo tydlmteaiei;s0tetm(m3iu1aptemnet s  rrrxmoou4aetnmieilsla eanms t0arxrxfcoytlp  au i (0srtrxo io4opeelieslt  rtrxm ;t0opt  fciyslm el( o;t) eenio ia1fpD  ivs;()srxmxmpiu1lm elnci t  Durxrooo4altnmf3ias a2rl( p u0aexrmf tydlaDeln olt)s2ur(rpoo4apt  ivs s srtau  ot4alt ii3iydfm2ul( ont0 eerxr3oo1fm e ues t0 etoiopiy4al emfcsl(fartmu onu1alxoifetasls elnvs;()trenio3oytfmD an s t0srxoxr nodamtnmfeiatfarta(rp;u0oltoioctysfm eauvont0trxnxoctydlate n s;( s2xmio3ny1lmtnlietl() rraurono4optoiietadla ua( onu0teeoxfcoy1op   ieil(0t2xoio3ou1ameelfet s)sDumxr ou4tpeniietltlaDelu p;(4 rxrmocoa1lptr ueilt  etm(opio4lleemfciatfarrmurp;u0tpt ioeiytla2um(vo;t4 eermf3ty1lm  livs;t  exoim nudomen fvilt  2umxrooo1ole ifeiysla uauvo t0tltrxo3iydfp elneolt)trto(m ou4ol elnvi s  rtru  ;t0aex moctlt sDelu pn()alxoxo io1faDe nei s) 2urxr io1om  mneslt  rrmx  nt1aet mfciytla2ra(vp u0 rtoxr3tadop eln i;t)s2urio3oy1lpt  nvilt sDuaum ;u1ale if3tldfmDem( o u4 rxoxrcoy1lmt ln s () rxm(o3io1om nmnctls sDua( pnt0tpeoiietysfaDuauvpnu)trtoifcoa1om elu s (0teuoxm3oodlpt mietasfarrrumo;t4texo i3tadfaDulums ()tlxomfcoy1fm rauvs;s)trxmxr3nudlmeelfei (  2tmu  ot4aet mf3ilsfm2ranvo;t4altoxo3iodomte i o s)s2toim3oydope mfvi ( arra(rpno4tpxoiictls s em( pnu0trxnxociy1oa  lneil()srur(m iu4omenmnetatf rrax pno1optnii3tydfs umu p;(0tlxomfciytfmt  u s t) euoxm iu1altnmncsas)sDrrumo;t0tpxomfctasfs2ranvsn(0tetomf iatlpDrln i;t srtoxr3ou1omenlneias) Dtm(m nt1optn f3tld a2elumo;t0trxrif3todlmt aieslt  exoxr3iu4am   ietas  rtrxm ;o1alt mf3iys a umnvp;u0tlxnif io1la r ivo t)s2xmir iy4om  mfeiltfsDrax p;u1alt mfciaslsDrlums;t)arxrxf oo1op   uvilt trxr(r3ou4al   iviatfs2umxmpou0olen i3ild s ulnms;(0artrir oa1op e i s s0 rxrxmpnu1al   fci s sDrm(r nu0aeenifeiltfm rlnms;()treoxrcta1lm  aneo;s teurirpno1llenmici s)sDtaum oo0oltnmieiatlaDumnmo (4trxoir3oo1faDrluei s setr(r3iudam n fciat)aDua(ronu4aexnmf3iatlmDua(vp u)arenmo3oytlpD aueol()setm(m3ou1op  lnetatfsrumx pnu0tpt ii3iasfa2em( pnt)tetniociydlmDr ivo s)t2urir iu4lp nmiviat)sDumuro;u0aleoii3iydlaDranmpnu4 lxomo3iatomD auvi s0 rtoiopoo4omtnlnetl( a2taxrpou1tlxnioeildfa rmn snu4altnmf3iodlpDelies s s2xo(r iy4ol nliei tfs2umump;t0apeoio3ild mDrmu pnu4arxrir iotfp  au ols  rurxr oudam e net ()s2uaxmoot4opeo i3iadla2rauvsnt) renxrcty1faD anvs;(0trtrio3iudllee ncia(fsrtax  ;u0aetn feiydla2ran o;(0aeeoio3to1fmD  ues (0t2trim oudal  mnci sfsrrmu  ot4aptoifciyt a2ea(monu4teenircoodlm elu s t0 rurxmpio4om e ivs ( artmxroou0tpxnmoeilt m2rmu p (0 lenxo3oydom rlies t  rto(mpiydole mnetl(f rra(mp;u0alxn i3tatlaDuanmonu0teeoxo3io1omtrln i t  2tm(o3oodome licsls)a2rmx poo4oee mi3taslmDeauvp;(4trerxfcoo1oaDeanvi ( t2tm(r iu4op nlnetl()aDrrumpnt0optoifeilslm2uan s;(0 rxomfcta1lat lu ils0 eum(r3oo4omee ncslt sDra( pot0teeniocilt a uanvp;t4 eeoir iydfpt anesl(0setrim3io4alen ietl()artr(m nt4apeo f3ildfs eanvp;t)arxoifctatomDr nes;(0tetm(mpnudapeemfetasf Dtaum nt1tlt  fctyslsDeaumon(0tetnxocootomDe ieo s0t2trxopou1ape lnvta()artm( p;o4ale mfciltfaDuaumont)trtrmo iotomtr neo;t0 euoxopnudomtnlnvi (fartm( poo1tptoif3tls a uaumsn()aeenmr iydfatelueolt)srtmim3oo4llte fcsasf rrr(m ;t0oetnmf3iydla2umnvsnu)aeeriocootlmt  ueils srtoio3iu1ll e ivs s  rrm(moot4oeenmo3iysfm2emuvo t0arxniocio1lmDe n olt s2to(o nu4omeelieil()aDta(r oo4tlxoif3iydfa el( o;t0trxnxr3oadfaDe nei;s  2xo(m nu1optn ncs t sDtrumono1tptniociasfa2el( pnu) etrmociotomD liei ( trxoxr oodllt lictlt s2ur(m no4openmfeild s2umu p u0texrmr to1optraieo;t) etr(o iu1apt  fcsltf rrax  oo0olto o3iytls2rlumpn() lxomo tydlat ln ilt) etrio3oy1lp nmiet (  Drmx  ou4alt if3ils aDeluvo;t0trenxr iydfp  lnes;s0sexmxr nudame mivsatfaDua(m nu1texn i3iys a ul(vp;(4alxrmo iytlmDeluei t trumir ou4ape lfesls s2urx  ;o0alt mf3tldla2elumonu4trenmr ootoaD lu o ()sexm(o no4omeemieta( sDrr(rpnt1alt  i3tyd m2rl( s;t)arxoxf3ia1fatrlieo;t s2xr(m nydomenlnct sf rtaxr nu0opxo oeiaslmDeaums;t)alerifcoatopDe uvil(0setoxr3io4am n fci (fs2umu oou0tltn oetadls2uanmo t4tlxomf3ia1oa  liei;s) 2tr(o oodll elfcia(fartaur ;o0tlx  ocildfsDemu p u0alxnmrcoadoat lueolt0t2trio oo1alt mfvils sDururpno4aexo fcildlsDrmn pn(0tetnxo iodlaDrli o t0t2umxr3nu1lmtelies t srtr(rp;u0aleomfeiatfa eauvsnt4tetnmo tatfatrli o;( t2umimpnu4lp e neiatfsDrmxm ;o0tlxn fetaslaDumu snu0 lenxo ta1fmD  u s ( t2umir3iy1op elfvslsf rrmu  nt0aptnmfciltlaDrmu o (0 rxrif3oydopD  nvil( teuoxr3nydalenmics t) 2truronu0alt mfeildlsDrm(vsn(4aexomocoatfaD aies (0 2um(opny1lptnlivta(f 2tauro;o0olxoio3iytfm2elumon() etrmrcoo1om eli ol() 2xm(m3io4ap   ieil( srraxmo;o1olxn i3iysfmDul(vp u) lerxf3oy1opt  ueo t)srto(rpoudol  mfvtat a2umxm ;u1opx  ietasla2el(vpnu4tltnxr3oa1oa ranei () 2xo(m3nu4lmeelieiatfa2umxmonu0tpxnioetytfs emums;t)trxoif iadlp e n i (0trxr(o nodaptnlnvi s  rum(r ;u1aeeo f3ildlm2uau pnt4 ltnxr oydfm eanei t)srtmxr3oo4omtnlncil()aDrru pot4oexnmi3ild s2eln s;() rxnmrcoy1fp rli s;s teum(m3ny4ll n ncilt)srta(r ot4texo o3ildlm2rm( s;()aexniocia1lmDelneol(  exm(o3iy1optnmieia()a2tm(m nt0apen fctltlm umumo u4te
\ No newline at end of file
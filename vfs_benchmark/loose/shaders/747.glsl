@@ -0,0 +1 @@
+iesls  eum(r nu1oltn neiasf rtmurp;o0olx miciyt m em( s t)altnmo3ia1optr nvilt)t2urim3ny4lptn ict s) 2taxm ot0texo oeiysfs ranvs u4tlermr io1lpDranes;(0 2xmxopou1ap  mivs t)aruaxr ;u0opx mocilt mDemuvon(0texnmo3ta1oateaiei s0srtm(o3io4ope lnet (fs2rax  ou1oexnmf3iydfs2rlums;u4treriocoytlp  lueo () rtoir no4ap n nesatfsDrmxr ot4tpt ifeilsfs2elnmsnt4aeermf oa1lm   nvs s0t2umir iudole liet sfsrtrx  nu1texoii3iltlm2ea(ms (4 eeomrciytop   uvs t)t2toxm3ou1lmtn fcsasfartru pnt4aeenif3tadls elnms t4tlermoctodfmDeaivi s0t2urir oo4omee neta( sDum(m nu0alt  fctysfsDemnmp t0arxnmo3tytoat lu s () 2uoxr3nodap e fcilsfs2ur( pnt4tltomictadfm2elnvs;t) rxnmf oy1op eliei ( s2umxm iodamte fctat sDtr( p;t0tetnmictad mDranms;(4tlenmf3tatop e nvi;t texrir3oodal n fetat)sDra(rpou1alx ifeiydfsDrluvs;u4aetrmo3oadlm   n ols tetm(opoydlmtelncias  2uax  ou0oee ii3tydla rlnmo t)arermf ootlm  lu slt0 2umxr3nudlmenlfvsl( s2trur ;t1apen i3iaslm2ranmsn(4arxrxo oa1lmt auei;s)srtrxo io4oltnlics s s2ururono1tlenmietld a2ul(vs u0 leoxr3oy1fpte ieo;t) 2ur(m3ou4llen fvias a2rmur ot0aexoifciaslmDeanvo (4 etnxf3tatlatrlivi s teuoiopoo4ol elicsas aruaxr ou4oee mo3iad s uanvp u)alermrcty1oatr uei;(0setrxopiu4omtelnctl() 2rrxrpoo4tpto i3iysfa2uanms;(4arxrxrcootoa elivilt seumim oo4om nlfvta(fsDumx p;u0apeomi3iatlmDemnmsnt4 rxnir3iadfp eln i t  2urxmpnodlltnmfcias) rumurp;u4aex iiciydlmDua( pnu0tetrmr tadoat lneols trtm(mpnu4aptnlfct sf rraurpoo0optomi3tas m rmnmp;(0trxomo3oydop  livo s)s2uoxo3oo1amen nctas aDtr(rpnt4oeeo ocild a2rluvpnu)aeenmf oa1lpDrauvi s0 rtrxr io4optemictlt aDrax poo1aet  oetldls2rmnvpnu)altrmrctytlpDraiei;(0srtmir nu1llte nvi t)aDta(mo;o4tpeniieiltlsDrm(mo u4 eerxociodom elneo s0srxmxr ny4lpee icsat)srtax  ;o4optn o3tysla eanvsnt4trxrmf3tytop elu o t)texrxrpiy1omtelfesas aDua( pno4apxomociltfsDrau o (0 lxnio3oadfm   u sl(  2tmxmpoodlmen nei () Dumxront1alxo i3iltlsDrm(mon()arxrio3ia1lmDr uei s trtmir oo1lle  ivt sf rrax pnu1tleo ociatfa2ranmp;u4arxoio tydopDrln i (0trxmxm no1ap nlivsltf 2urxrp;u4aexomoetadfm em(msnt)tlxrmr tydlat  nvi s0trxo(r3no1oleelfet s)sDta(mo;u0aexo fetydfsDem(vs;t0tleoirciydfaD  u s;(  2trir3no4openmfes s  2tau pnt4opxoiieilsls2elnvp;t) ltrmrciytlp   ues s0s2xrxr nodole  fvt s a2raurono0aetoioetlslm2rmuvpnu0texnmocio1lpt  ieils0trum(r oo1amtn ict t)sDrrurpou1alt ii3iaslmDeauvsnu)tltnmo ootopDeluvi;s t2to(mpno1ol nlietls) Dtmxm oo1alx iociasfs emu pnt0altrmr3todlmt lieil(0s2trxm iudlleemieslsf Dtmx  ;o1aptomoctltla2rl(vsn()tetnxr tadomte nei t trtr(m nodopeelnetltfs2umxrpou1tet iietasfs eluvs;()tlxnmr iy1fm elivs (  etrio oy4lpen fciltfarra(ronu1opeo f3tatlm2rmnvs t4 rermrciotoaDe ies (0sexo(rpou1op nmict s)srrmxmpou1oetnmfeiytfsDrmu ont) lerio3todomt livs ( s2xoxr3ou1amt  nvil()a2uru p;u0tlen i3ildlmDrlumsn(0 rerxr tytlm r u sl(0 rumxr3ou1llee nct ( a2tax ont4tltn fciys s2el(ms;u0aeerxociydomtrli o s0s2urio3ou4omen fci s sDuaxmo;o0oeen fciyd aDulnvpnt4aetnxoctotfp elueils)srtoxm3ou4op elfct (  2raurpnt1altoifciyslsDum(mpn(4tltnmo3iotopt ln sl( trxmir3ny4alt  nvs tfsDrax pot1olxnii3ildlm2rluvo;t0texnircoytfmtr iei s0t2to(opiydlltn feta( s2tr( pno4tltoifeiaslmDel( p;t)tlxnmfcia1op  livo t0seur(mpnodlmtelfcsas  rur(roou0tpeomieiltlsDuluvsnu)teermr iodfptrau s t) eumxr nodapt mictls  Dtru o;u4oeto fctyd a rm(ms u) ltomrciatfmt  n o;()setoxmpoy1am n ncslt arur(rpot0aexnmf3ilt s emu s ()tltnmr tydoaDeaueo;s  exrxm nydlmtelfetls arrmxm nu1tltomoctld sDraumo;t0aetnircoatlaD  nvs s)setmir nydlle lies (fs2umurpoo1tetnmfctysla el( o u0 etoio ootopDelivs;()texo(o3nu1al elfci ()srrmxrp;o0tlen ictat sDuau s;u4texrif3io1op eaivo;(0srumxr ny4am nmics ( a2ra(ronu1oeeomo3iaslmDel( p;t0 leoio3tadlm  aueils) rto(o3oo1alte nvil() ruau pot4apen iciytlsDeau o t) etoxf3ta1fmDe ues t sexr(opoydlm n fctas) Dtrx pno0tle ifetlsls rm(vo u0 lenmfctadfm rli olt0 rtrio3iy4altemfcils)sruaurpnt0opxniicias a2rm(mp (0alxrmrcoy1fm   nvi s0s2urio io4oleemnes t sDuru pnt0oet mictadlmDumnvp;u4altrxfcootop   i sl(  rurim no1om elfesa( s2uaxmp;t4oet iietld s uau p u)arxomrcoatfatrau o;(  2urxm oy1opt  fvils)artmumpno1tlt ifciyslmDrm(von() leomr tytfpDrlu ilt  2xoio nu1ameelivt ()srtaxmpoo1tpxo o3iasfs2em(mo;t4texnmocio1fa rlieols trur(r nudomtemiet t)sruaxmpot4olt mieiytlm rm( ont4tlxomf oo1lmD luvsls0 etmir oydam  licta(fsrrr(ronu4tptnmo3iltlaDrlumo t0texrmo io1opteluvs;t)t2urxo3iy1ope lnes t srtr(rpoo4alxomi3iatlsDemn p;t4alenxf oodlmD lnvsl()srtoxrpoydamenlnesls s2tau  nt4apt  feiltfa uauvs u)aeermrcto1omtr uvsl() exoxr iudomeelfvi sfs2rr(mo;t1tpe ii3iadlmDeau pn(0aetnif tatlatelneo (0seto(mpno4al emncilsf 2rmxmp;o4aetomi3iydlsDemuvo;u0arenir tydfm   i i;s srurio io1lp  mnvsl(f 2uaur nt1olxn ictls s um(vs t)trtomo iadfmt  u ils0srxm(m3oy4amenmnci ()a2taxro;u4oexomictld mDeaumpnu0tlerio3ta1fp  lnvol(  rtrirpiy4am  mivta()s2rmx ont4oleo iciltfs ea(vo;t) rxomr iatla  an s s)srxoxo3no1ap nlfetltf 2urx pot1aex  ieiydlsDulnvo;(4 reoxo3oatop  auvo t  rxrimpiodlptnmnvtl( srra(  nt1texnmf3tyslm uan p ()arenxocoy1fm eai sl( setrimpoo1lmtelneilt)aruaxr ;u4apt ifetysls2eau p;(4alxnif oo1lat liei ()teuoio3ny4lmt licsls)sDrm( ono0opxnioeiltfs rm( onu4 ltoxo3io1lmD anvs ( t2toxmpoydopeelfetls) Dumurono0oee mieild s2ranvs;t0 lenif3iatfpteln i;s)t2trxr oo1alt  ivils) 2rm(r ou1oeeoifctysfs2rlu s;(0 exrmr iytoaDeli sls teumim nudlpen ict () Dur( pnu0optniictas s umums;u0arxrxr3iatoaDrauvi;t) etrxr3iu4lm emfvsls aruax oou1openmfciltls umn p;t) lxnmo3tytfa eaivols)trtmxm iu1optn ict t  2urxmp;u1olen ietys sDua(vs (0 rxnxo oo1lmt aivs;( t2xoxrpno1altnmfci tfaDtau pnu0ale ii3iytlaDumums ()artnxr iotfate nvi t0setmim io1apeelnvs (fsDrmxmp;o1tleo ietls s2rl(vp;u0tleoio oydfpt au ilt) etoxr oo4om  livt t  2raxro;u4aexoii3ilt a rluvo;(4trtnmf iytopD  iei () 2urio nodamtemfvsat)s2taum ;u1oeeoiociys a ulumo;(4 rtrxo3ty1lpt lneolt0teumim iy1lleelics ()a2ur(  ;u4oetnmfetytla2um(mo u)artomfctytfmDr n s s)seur(r3ou4optn nvs s) Dtru  ot1aleoii3tltlmDra(vpnt0aeermf3iatfm rlueilt trxmxr3iudap n ies s  2rm(mono0apeo feildfm2ea(vo (0trxoxo oa1fat aivols)s2urxopio1altemnvt t  Drrx  ou1apt mi3ils a2elnms;(4texoiocoytlpt livi;()s2umimpoydolenlfcslt)aDraxmp;t0tptnii3iltfa2ean p u)trtnmrcia1omDranes;t0 etrio oy1ole  ics s  2urum ot1oee mictldfm em(mpn()aexrmoctydlpDrlieols srxmio iudop  mfciat)a2rmxmp;o4aet mfciyt mDum(mp;t) eeoxfcta1fa   n ils0trxoxo nu4ol   fcil( arrr(rp;t0teenifeils a2umn p;(0teenmr iydlaDe neil(0setm(o3oy1omee fcs t s2tr(mp;t4oeen f3iyslm2rl(vsn(4arxnir3tydlp eluvi;( sexo(o iudlmeemict s)aDrru  ;u0tpt ifciytlmDem(mo;()treoif tytfm e uei;t0 2umio3iy4apen fes () Drm(r ou4opeomi3tyslm eanms;(4trenif to1lp   nvsl(  exrim3iodlpee fvsls)a2trx  ;o4tltoifciys a2um(vo u0tetrmrciy1fate uesls sexrxm iy1apeemfvsatfaDumxrpnt0aexn ietlsfm elums u4tetnif to1om rlnvs;()texm(rpou4om  mncs t)arrruroou4aeeoiietytfm rmn on(4trenio3oytlmtr nvs;t teur(r oy1ape  fetlt)a2ra(root0olxnio3tatls2rm( s t0alenif tytlmDranvil()seumxo3oudll  lictlt a2ua(rpot4oet iieiat s2rlums;()tetnio3tatlaD auvsl(0trxmxrpoodoltelies (fs2ur(moou4tetomi3tlt aDemnvsnu4 rxoirctadom r nvo;(0 etmio3nydam  lieiatfaDrmxro;t0tltnmi3iadls2umnvs;u)aeeoxfctydfpt  uvi t0 eumxo3iodapt mfcsltf Dum(rp;u4tex ifctasfm2ean o;u) lxrxfcoytoaDr uvo;s  exoir nudllen ncsl(  Dtr(  oo0alxo fciat m2ea( ont4aeeoxr3oa1lmte uvils0srxrir3iydlmteliei t) 2umxmpou1altn f3iyt a2rlnvo () renmf tydfa r ies;t0 2xo(r oudllee ivta(fs2rru pou0teenifetas a2ea(monu0alermfcty1omD  n ilt)srtmimpoo4ome lfvia(  Draxmpou0teeo feiyslsDrmump t) lxoxf3oatlaDe neo ()trumir oudol nmicils  Dtm( ooo1aexnmocilsfa rluvont4texnmocoy1fa   i i;s0 exrxm no4ll emneia(fs2raxrp;o4oeeoii3iyt a2rmuvp t4aleoif3oy1omtrlues (0s2xo(m3oy1al e iviasfaDurum ;t1aee mf3ils aDran s;(4alenio3ta1la  an i;s0 eum(r no1ol  lnviltfs2tmu  ;t1oetoiictatlmDranmp;(0tltoircia1oate uvs;t)t2toxm3no4op nlieil( arrmumpno1tetomo3iad m rmnvo;(4tlxnifciy1faDrlnes;s t2xoir3oodol nlncs s srtr( p;u0opx if3iltfm eanmont4aleoir3oodom rauei t)seuoir3io4ll nlicta()s2rmu  ou4tetnmociaslaDulu o u0 rxnmf oytlp e i s (0trxm(r3oy4lme mfci tf Durxro;u0teenmo3iyd mDra(vs;(0 rtnircoadlpDrlnvi t0srumio iu1lptnmnet s s2umx ono0tlx mo3tasfa2rlnvp t0tlerif iytlmDrlu i t texo(m iudlmtn ics ( artr( ont4teeomf3iasls ua(vs () eerir iotfaD aneols truoxopou1ll elncsas)sDrrxrp;o0olx mfeiatls2uau o t) exrxr oa1oateauvi;s0teur(r3io1am   fvt sf Dtmum ot0tet mfetls s eaums;t0 reoif tatfm  aneo s)s2trim iy4lptemneilsfa2umum no1olxoifetatlsDulnmp ()tltnxo3iotlmt livolt) etoim3nu4altnmies ()a2tm( pnu4tlt ioctysfsDrm(vpnu4aexoxr tytlaDr u s s0trtoim3io4lltemietatfs2tmumono4altniociyd m umn o (4 reriocoy1fp  aueol()t2xr(o nydlp  micia(faDtrumpoo1tlt mo3iys m2umn s;(4tetoif oa1fptean i ()sruoxr oy4ame lnetls aDrrxm oo4opx iietyd a ul( onu0areoif3ootomDrli i;s)teuoirpiu4openmiesat  2umurpot4tltnmo3iat aDumnvs;(0 eenir tatlptelues;()t2uoxrpio1lltelfcslsfartax oou0aet ioctysfs eau snu4arxoxf3totlmtrlies;( s2uoxr oy4lp  mnesas)arrax p;o4alxniiciytlsDrauvs;t4 eerxfcty1om e i i;t srxoxmpio1ol   fci (faDtrur ot1aptn f3tltlaDel( on(4 lxriociy1fa e u ils)t2tm(m3nodlmt  nvt () 2umu o;u0aeeo feilsla2ean o t4arxrmr3ia1fateauvs;t t2xoim3oy1ope lies t  2raur nu1oltoifeiyd s2uluvo;(0 lxoir3oa1oa raieslt0texmxo3iudlpenlfvil()srumx  ;u4teeomoeiyt s rau s t0aetnmfciotoa elnei;( texoimpoudalt mict s sDtmuro;u4tleoifeiysfs ulnmont) lxrxo3oadomt  ivols)t2xmir3iu1lm e ivi s aruauront4aet mietat m ulnvsnt) eeomoctatfmDeluesls setoxrpio1lle  fvsa(f rra(mono0olen ictat sDean onu)aleoio totomtr ueols)t2uoio3oy1am  lnes (faruaxr nt1altn f3tyt sDrluvsnu)aeerxf iytfmDeaiei;s) euriopiy1opte ivs s)arurxroou0teto f3iysla2rl(monu)trtnxr3iydopDelu i t) rtm(rpiudlpe livi t aruru pot0alen ieiat a2rlnmpnu)alxrio iy1lmDeln o s0s2xoxm io4lltn ietls)srta(  ou1opxomictydfa rauvpnu0 rxoif iadoa rlivi;t  rxm(r nodamt  ncslt s2rmxr ot0texniocilt s uanvp u0 lxnifctytlat  uvs t  etm(mpoodolee nes ()sDuax  oo1tptn f3iatfsDulumo t)trxomr3to1optrliei t) euoxm nodal e fvtlsfsDraxmoou0tpxo ociad s rmu s () lxrxr tydfm   neo s trto(r3iudom emieta( sDra( oou0tpeoiociyt m elumo u4 exoxfcoa1lpte uvi;s0t2toimpnu4omtnmfcta(farrrxm ;o0optomo3iatla umuvp;u)treoir oydfp  aneo;s tetm(r nodlmenmies sfsrurxro;u1olxo f3taslsDuanvs;u)artrxo oytlaDeauvo;(0t2ur(o oo4lp e fesas) rtau ooo0tle  octydfm umuvsn()trxoxr oydomt ai o s t2tmiopnydol nmncia(fa2rax pnt1tex  i3iysfs el(vp (4alerxocoytlpt  nei ()srxr(mpny1lmeelictlsfsDrax ono0tpeo f3tasls umuvs ()artoir oo1fat lu o s tetoim3oy4lmenmfvsat  rtmxr nu4tlxn octlsfmDrmnvsnt4arerxrcoa1fp  lnvo;s0t2trxmpou4oltelictl(  rtmurp;t0apx mictadfm rauvonu0 exoif3io1lpDelnvi t0teuo(opoydalenmict tf rraxmo;u1aex  fcildlm umu p t4 lxrxf3oytlmDeln s;t)srxm(r3oudomen nvia(fsDrm(m oo1aexnmociasls2rau on(0 ltoir3iatlp r uvol( s2tm(mpny1lmtnliesl(  rumxmo;u1altnifciltfaDelumsnu)tlxnmrcoo1lp  lues;t texoio oy4ome lfet t)srrr(r nt4olto ociat s2rl(vpn(0tetoif3iydopDe ivols)s2xr(o oudlme liciat artrurpno4tlenio3iyslm em(mpnt4alxomfcta1fptelnvsls s2urio ou4al elncilt  Dtmxro;o1apxomo3ias mDua( s (0alxnmf3ia1fa r uvi;s0 rxoim3io4lpe  fcslt sDrruront4oeeniieilt m2uanmo;(4trenxrcta1lp   uei s0 2xrio3ny4ameemiesl()a2rmxront0tlt iieiytls elnmon(4treomo iadlateaies s0s2xmxm ou4alt lfvs (f 2uaxr no1opxnifcilsfsDem(vp;t0trxnif3oytomtr nvsl() 2uoiopiu4om nlfciatfsrtrxm ;u4alx mf3iyslaDrluvp;(0altrxr oy1la  lneo;(0sexrir3no1alt mietl( sDtau p;u1aptnmi3iltlmDrl(vs u)aexomr tadfmD lnvs;()seum(m no1lmt lncils a2ur(ront4tlxnifeiadlaDum(mont4 lxnir oadlatrlieo;t t2tr(o oy1open fcia(  rtm( pnu1alxo feilslsDea(vsn(4 lermf iadoaD lneol() rxrxmpiy1amt livt s a2raurono1teen feils m rauvp;()aeermr3iotfp rau s;s t2xo(r3io1al e iet () rtr(r ou4apx moctat s2ranvs t0arxnifctadlat luei t  2uo(m3ou1olte ivslt) Dua(mpno1aetnmfciltfaDelnvsn(4altrio3to1fa raivs t)t2xoim3iy1opt  ncsltfsrrr(m ot4tetnif3iytfs2emuvo t)aexoxo iotomD lnvi ()t2tm(m iy1lpe  fcslsf Drax pot1aeeo icild s rmnmpnu)alxnxf ootopt  ieol(0 euoxr3nodlm  lieiltf 2trx o;t1tpxomieiysla2ea(monu)aetomf3tydfmDe ueols0 2uriopiodop  mietl(fsDrm( pno0opxomieild mDum(mpn(4 exoxf3to1lmDraiei;t sruoiopou4lp  mnctl()s2rauro;o1oeen iciydfs2em(mo (4aleriocoy1oatr neolt0teto(r iydol elncil(  Drrur ou4tlxnmo3tatfm2elnvo u4trenir3tatoptrliei t0teto(r3oudlmeemfei ( sDraxro;t4optomociyt mDuluvp;() lxomrcia1fpDe nvs;( t2trio3oo1am  mnetlsfs2tax ooo0aet  i3iadfa eluvonu4 rerxf tatlmDe nes t t2uo(o ou1lltnmiet s)aDtmxmo;o1oeenmi3tldla2em(mo u)tetnxr3oydlmtrluesl( sexm(opno1lmee iesasfs2ururpnu0tpe iociat mDem( s u) exrxf3iadfaDeai ol(0 etr(m oo4altn nvslsfaDurump;u1open octat s ua(vo;(0tleomo3tadlpteliesl(  2xo(r3oudlleelnvt sf rtrx  ot4aee if3ils sDeauvonu0 rtrir3iytfpD  neil()t2trim3io1lp n fvt t) rrru o;u1olxo oetldfmDemnvs u4 rxoiociodopteauvo;s)sexrir3io1ope  icsasfarrax p;o1tlx  feiltla elu s;t)teerif iadfmDelneo s0texm(r3no1am n net s artru o;u4opeoiictls sDrlnvp;t0aetnmf3tadoa elnvo t trtm(r3iudolee fvilt a2ua(m nu1tpxo i3iatfmDrlump;t0 lerir oadlm  auvsls seuoxm3io4ll n fvia() Duax o;u0olxoiieiaslmDrl(vpnt)aeenircto1fp   n sl()trtmxm nydapte fvtas)s2tr(ro;t4alxo ietatlaDum(mp;()tleoxocoa1op rlnvs;s  euoxm io1apeelics (f rur(rp;o4apt ifciltlsDeluvo;u0aetrxo3oydlpD liesl()srumxmpoo4ole lfet s) rrau o;t0olxomociyt a2ea( o () eenmf tadop r nvilt0srxoir ou1llt mfvil(f Dtr( pot1oleoiiciyt a uan on()arermo to1lmteaues ()seto(mpiydol  lfct t)srtaur no4aptomieiysfm2ean p t4teeoio3oodfa rai o t)sruo(rpoodaltelfvt (  rraxmp;o1oet iicias a umnvont0arxomo3todopD aies;( srxmxr no1ole  nvsat  2tr(rooo0ope  f3iltfm2raumpn()artoif iatlptr i s t)t2umir3ou4lm nlfctat)a2urxm ou4tle iiciltfsDuan o (4 exrir3iodla  lueo t) rtmir3nodol nmivtl(farrrumpnu1tpe mfeild s2ulumsnt0trermf3oytfaDeanvol(0s2umimpoy1alenmnvs s a2trxmono4aet ifciatfm ua( snu0arerif3iotlp e uesls) 2xr(rpno1lm nmfctat) Draxm nt0aee ifctytfa ul(vo;u) eeoif3to1om e neo;( sexriopiydoptnlfeta(  Dua(rp;u1opx moeiyd s2ulnmo;(4 eenxo tadopt livi s0t2toim3no1alte fet s)srum( pno1opxnifciat mDrlums;(0aeerifctodlate nvs;t  rum(rpiudlmenlfetlt) 2raxm ;u0alxo fetas sDuauvsnt4arxrxo iytfm  aueol()trumxo3ou1aleemfes s)arta( ono0aex moeiyslaDul(monu0texrio3ootlpDrln s;t trxmio3io1llt mnet s aDuaxm oo4aptnif3ild m rm(mpnt4 rxoxfcto1laDean o;t0s2toxm3oo4altnlncs (fsrta(mo;o1oee iieild s2rmn sn(0 eerxocoytlmDrlu i s  2uoirpiudlmeelfvt (fsrtax o;t4oltoif3iad sDul(mo u4 rermr oy1latrlu slt0 rxmir3oydapenliesltfs2um(mo;o1aet ifeils mDra(mp t0altnio3iotfpD auesl() exmir oy4am  lnvi s) 2tm(mo;o1tpx mi3iys mDrl( pn(4alxnircoytop elu s ( s2um(rpny4opeemictl(  2umurp;o4oexnifciatls2umu onu0aetomfciatfaDeau s;t) rtoir oo4apen ict () rtrxrpnt0apx mfetysfsDum( p;()altnxrctotoa rlneslt)t2umio oydap nmnvias a2rrxmp;o1oleniietls s2rmuvs (0tleoxr tatop rlivs;s0 2xoio oo4lp nlieias artax  ou1tpe iiciadlm ua( s;t) rtrmr3to1fpD au s (  rtoiopoo4apenmnci s)aDtr(mo;u0oee iociys m2rlu o (0trxrmf3ootlaD aivo s tetr(o3io4omen nvtatfaDrrxmpnu4tpt mociatla rlu s u4 rtomo3iy1fmDeaueil(  rurir oydaltnmieiasfs2ur(rpoo0aexnifeiaslm uln snt4 reoir3ta1fmt ln i t)teto(mpiy4ale  ncsl(faDrmum ;o0apx mieils m emnvpnt0 etrio3oy1lmt luei t)texoxm nu1ameemivtl(f 2rrx oot0apxoiictys a ul(mp t) rtrio3oydfmD  i i t  eum(r oy1op  miesl(f Drmxmo;t1aexnmicild aDrauvsnu0teeomr3tadlpDr uvo;s trxoirpoydop nmiesa( a2ur( p;u4tleo feils s rln snt) rtoxrciydfatr ues s0srtr(r3nodapeelfcs s sDumxrpno1oeto f3iatlaDuanmsnt) leoxr ta1fpt luvo;t) 2um(mpnydam nmfcs () 2rmuro;o1tpe  f3ildfsDuau s (0texrmrctytlate nvsls) 2to(o3iy4alte nvtas srrm( o;u4openiiciydfmDem(vsnu4texoxf3totoa elu o;t) 2tmxo nydllt mietat  Draxm ;u1ole  ictadlm2ua( sn(0 rtnir3oa1laDr ieo t)trxrxm iydopee ictls)s2urx  ou0aetnmoetysls ulnmp u0alxnxr3iodom r uvsl(  exmxm3ny1op nlfvtl( sDrr(roou4tpto ieilslmDemnvpn() rxoxo tydfaD li sls t2trxm3oo4altnlieias  2ra(r ;t4tle  i3iytlsDeauvs (4 eeoxo3tadlptelnvs;() 2toxr3io4lpt lnctlt  Durxr no1texoiietldfm uau s;(4arxnxf iadfaDe i s;( seuoimpou4lpt  icsat)artr( ont0tpenif3iltfm rmu o ()trxoir3oodfa eanvs s tetm(m nodomt  nvtl(fa2rru o;u0oltn fetld s ulnvp (0treoxf3tydfaDeluei;t  eumim iy4lptnlfvsls) 2ta(ronu1oeenmfeild s2eln pn(4aeeomo iydlp r nvo s  2uoir3nydam elicsas) 2ua(  ;t0oeeoiieiatfaDraump t0altrmr io1lmte n s t t2uo(o iu1lptnlneta(  Durxrpoo0oeeomictysla ea(msn()tlxoifcoy1omD  nvo;t)trtrxrpny1omtn fvil(fsDtr(ronu0tleoifciatfsDelnvo t4tlermf tytoa ean o;t)srurim3ou4alt lncils  2um(rpot4ope ioetydla2ulu s;u4tlxrio oa1fp eanvs s t2tm(mpou1omeemnei () Drr(r nt4aet  f3iyt s2emn p (4aleoio ootfpt aieil( trtm(m oy1ope mfvsa()sDtm(  ;t1tlt ii3tldfm em(vs (4arxnirctydfa   n il(0 etrxo3ou1ome mfesa(  ruaxmont4open fciysls el( ont4trtnxr oo1lm e ueilt0t2tr(m3nydomtn ivsasfsDrm(ro;o1tetnii3ildfm2ulumpnu4 rtrif3iydomDrluvs s0 2tmxr oydape  netat artrxr nt4tlxoio3iatls umnvsnu0trxomr3ty1oaDrlues;s setoxm3io1ope mfei (fs2taump;o4ole ifctys m2ua( on(0 ltnmfcoytoa eaiei (  rurim iodlm nmieta() ruaxrono1apx ifciat aDrm(ms (4trxomo ootlptr i o;( s2tmxrpiudlm nlfvs t) rumuront0tlxoio3tlsfs2uaums;u0trtnxo3ty1op   ivo;s s2tr(r oo4aleelnvt t)sDraxr ;o0apenmfeiysfa eauvs;t0aexnxrcty1lmtr nei;t)srxr(m3no1ale miciat)sDuaumo;t1oltoiocias sDrmnmo;()tlxomr3ta1laDr nes (0 etrir3oo1amen nvtlt artm( p;u1tet moctytls um(vonu4 eenir3ia1lpDeaieo;t  2umxo3iu4am nlies () Durump;t1olx mociyt a elnvs ()aeerxo3iydfm ranei;(0 rxoxm3io4llenmfct (f rrmu oot0apeo iciys a el( p;t0 etnmr iatlp   uvi;( teum(opoy1ol   ietat)sDrrxmp;t1ale iictlsfmDrln p (4tlxrifcoa1opDeai i;s0srxrxr oy1lpt  icia( arrmxmono0aetoio3iltlaDrl(vsnt4teermocty1oat  ueo t0trxr(opoo4ome mfci tf rtaur no1opxniiciytfm ua( s u0 rtoxf3iatoat aueo t0s2tr(o io4ll elfcsas)arurum ou4olt moctydla2emu p (4 etoio iodomt  nvs;s0teumxr3io4op  mnctatfsrumuroou4oeto feiasfsDrauvs;t0areniociatfmt auvo;()t2toxr iy1lmenmnes s aDurx  nt4apt mo3tat m emu o (0 lxrxr3iodoa e neslt0t2xr(mpoo1lm e nci s aDuaxrooo1tetoioeiadlsDrlnms u) ltoxfcoadfa elivsl() rxm(opio4omee nvi (fs2umx  nu1tpt  octytfa emnvp t0 eenmocoatlat aivi;s  eum(rpny4lp emfvtl(  2taum ;o4aeenifcildfs2emn o;t0 rtrir3ootop   nvi t0srtmxm3oodamt mict tfsDra( oou4tltn oeiltlaDuaumonu) exoircty1fmDe n s t  rxmxo3oydll emivias)aDrau  ou4opt  ocildfa uanvpn()alxrxfcoatlmDraivs s0seum(rpoy4lm e icta()arur(moot1opt  f3ilsfm2ua(vsn()texnxo3tytlptrlivi ( texrim3oy4alte nes (fs2rrx  oo1optn fctldfaDelu p (4altnio oodfpDrliei;t) etm(o ny1lpt mietl(fsDur(ro;o4ope  iciyt m umn s;(0texrxr3oatoaD  nesl()teuoio3nodal e neiat  ruaxroot0tlxniiciyt m2ulnms;t4texoxr to1omt aivi;() ruoim3oo4lpt mics (f Drmxr nt1opxomoeils m2ranmsnt4texnxf tadfmte uvilt)s2xo(mpiy4lpe  ncslt  rua(mpot4tpe moeiys a rlnmp t4 etnxf io1lp r uvo;() exrir nodlmeelnetls s2tmuroou4aexn fciyd aDea(vsnt4aleoxrctodoatr nvo (0trtr(o oo1lltn ivta()arurx p;o4texoiictysfm ra(mp;t)teenir3ty1fm   nes;s t2urxopiydal  mict tfarrrum ;o4apxoif3tldlm em(vonu4 rtnxo oa1om elnvo;() exmimpoudol   nesltfs2tm(rpno1tlen i3iaslmDrmu s;(0arxnmr ty1omte uvsls)truo(rpiodam emfcs ( a2trxr ;o1texoio3tadlsDeanmp u)trxomr3ta1op  aivs (0 eum(r3ny1aptnlnvilt)a2umx pot1oexnmiciadfs rm(mp t)aleoxfciotfmDrau s s0trtoxm iu4lp elicsls)s2rrxmo;u0oexo oetad a uan p u) etnxr todoatr u i;(  eumxm3io4lpte iesas)sDumx pnt4aleo o3tysfa2rl(mo u0artnmocoadfa  aueils) 2trxr3iy4ol nlfcs s)a2umur ;u0texoiictytfa em( pnu4 rxrir ia1fpteaneo s0 2urxm io4ope  netat srra( poo4olxomf3iyd a ean p;t)texoxf3tydlpDraneols) etmir oy1aptnmnviat)aDta(mpno0oexo o3ias sDrm( pnt4 reoio3oytlpte ieo s  eurxm3oo1lpeelnvi (  2tm(ro;u0tpxniiciadfaDea(msnu)altnxrctotfm eaueilt  eurim nodamtemnvt s a2tmx ont0texniieiytfaDrau s u4tltomr3totlpD lnvs (0s2ur(opiodlpt lfvsa()aDraxmo;o0tleoifetytls2el( s;(0tlxomr oy1op e n il( s2urir3iy1lme mfet t a2rmxr ;u1texomiciytlaDranvsnu0artnxf oytfmtr ivo;()s2uoxr3oydamt lict tfa2ur(mpnt1oleo iciltfsDemu p t0tltoxfciytop   nvs s sexrxrpiu1ol   nvtasf Dtr(moot0aleoif3iadfsDeauvo;t)aetrmfciatoaDraues;t0 ruoxo oudlmt mfes (f 2umur nu4tlx ifeiat s2rm( p;t4 leoio3ia1omDrauvslt t2uo(m iu1ap e fct t)aDrr(  ;o1apto ociydfa2umu pnu4 rerio3ia1lpt  nvo;s0s2xo(r iodlptnmnvi (fsDtau  ou0oexomfeilsfm ra( snu)tetnxo ia1oaD lueslt0trum(r3oudolteliei sfaDrmum ot4oeenmfeiat m2elu pn(4 lxnxrcta1la r nesls)setrimpoy4lmtnmnetatf Dtau oot1tlx mfeiltlm ul(mo u0 rerifctadomtrluvils0s2tr(r nu4lmtnmnciltfa2rruro;o4ale  octytfs2em(monu)alxrif3oytomteaieil() rtmiopny1lm elnctat  Drmu pno4oeeniieiatfaDuanvo;t) exnmo3to1fmDeanvo;s t2urxo iu1omtnmict ( aDrmu  oo0tetn oeild m rl(vs t0treoirctadla e u o;(0 exo(o3nu1ope lnvi t  2tmu p;u0texomietysla2rmu pn(4 eeoxfctytopDeluvi s texoir io4lmte nvsatf Dumxr nu4oltnio3iydlm ulnvs u0aexomr3iydfa elies (0 2to(opnodamtn ncs (f 2rr(mpoo4aleo ictyslaDeauvpnt4trerir iydlm e uvs s)sexrirpoy1am e nvt s)sDum(  ;u1altn o3tytfm el(vs t4 lxnmf oytfm e nvi s0 rxr(r oy4op elicsls aDrmx oot0olenio3tasls2uln p () exrxf ty1lmD aies;s trxoxmpny1alenlfet (  rraurpno1oexoiieild mDulnmo;u) eeoxocoodfaDrliei s) rxrxr iy1ame mnvi ()arum(ro;t4aptn fctydfa eauvo (0arxoif tatop eaivi;(0srumxmpou1apenlfctl(  ruau  ;t4aeeoiiciyslmDrlnmo;u4 lxrxo3ty1om ran o t0trumxm ny4alen neias  2rrxr ;o4tlx mo3tltla rmumo;u)artrxfcoadoaD au s ()t2xmxmpny4am  mnet sf Drmurono4apxniietlsls ea(vpnu4 rtrxrcoadoat  n slt  rxm(mpoy1oleemfvi t)artrx  nt4apeoifctat aDelumsnt4trenir3todlmD aivilt0trtoio3nu1llt  ies ( s2umurpnt1tpeomf3iydfa umnms t0aleomocia1fpDranes t0srtrim3iy1oltn nesls)sDuau p;o0ape mieiyslmDea(vsn(4 exnmo iotfmDeauvo;s)setmxr ny1oltemivi t)srur(r no4alx  ictlsfaDel( pnt) rermo3iodfp eanvsls tetrxrpio4lp emnesl( srtr(r nt1tpe mo3ilslaDea( snu4 rtrir totlmDr u o (0trumxm3iu4lm  lnvs () Duaur ot1aptoiiciydfa em( o u4tleoxo iydlmDran o t seumiopiy1optemnet sf Dumxr ot1alxoii3iadfm umu o;u0artnirciy1oatr nvs;()sexmirpio1amtemiei t) Dtr( pot0ope ioeiltla2rl(ms;(0trxnio iadlat lnvs s)srtm(m iudal   fesltfsrtmu pnt4tpeniietltfa2elnvs;u)aexnio iy1fpDe ueo;s) 2toxmpny1opeemfetlt)sDtm(ro;o1oleomf3taslm2uln s t) eenxr totoaD  nvi;t0seurim nu4ap nmnctl(  Draxr no4opt mfcilt a2em(msnt4 renifcoy1fm ran o;(  rxmxr3io4lltn fcsat)srtmxmpoo4tpenmfeias a2ul(mo;u4 lerxocty1fmDraneo (0 2umio3ou1apt lnctlt) rtm(rpnu1opeomociltla2rlump u)trxnir oadlpt auvol() rtrxo oodlmtnmfei (fs2rr( p;t1oee mictld s elnvs;t4aeeomocoodla eli i;(  eum(mpio4ll  lfci s)s2rr(  nt4oetniociat m el(von(0 lermr3io1fp r uvi ( setr(rpoo1al e nvsls) 2tau pot0tlxn fciytlmDeau s (0tlxnir3iy1fmt anei t) 2umxrpoydoltnlicsa( s2rr(mpoo0texoiieils s2ul(vsnt0aexrirciydlmtelues ()truoxo io4alenmneta(fsDrrum ;o0olt  i3iadfs2ra(vp t)tleoir oodfat aiei t)s2xmir io4olteliet (f Duaxmp;u0aptn oeiysla2uaump ()texomr tydlpDelnvo;s  eumxr3oo1ol  mfcsa()a2rm(m ;u4tpe  icildls2rlnmo;t0 etrxr3tadomDr ivslt srum(opoodal  lictl()srtrxm nu0oetnmo3iasfmDum(mont)texoxfcoytopt luvs () 2tm(rpiy1alt mfcil(  Drmur no4oltomo3tys s2uau p () lerxf3oadfmDean il(0 rxoio3nu4alt lieta(  2ra(m nt1tle mo3tysfm2rmnmont0tlxrircia1omtraivo t0 2ur(opiu4amee fei t)s2raxrono1alx ioctlsfm rlnvp;u0alxrir3ia1fpD li s (0trtrio3iodlpt mfcs t aDum(rpnt1aexomo3iytla2rl(mont0trenirctydlpDeaues ( trtmir3iy4ol  mies s)a2tm(r ot0aexn oeiyt mDraumo (4tltnmr oytfpDelivslt  eur(rpoo1aptelfcs tfaDurur ;t4apenifciatfs ulnmp u0 lxoxo3ta1fmteai il()s2urxm3oydlmeemnvilt s2uaxr no1altn o3iadls2rluvo;t0 etomocoodfaDeliesls trxrxrpoy4ole  nci s) 2rmxr nu0oltn ieiyslsDuanms ()arxrmo oodlp eaieil()trumio iy1opt  nvtlsfs2rr(mont1aetn oeiadfmDemnmont)altrmrcta1lm elu s (0t2toio3iydlltnmietat a2um(m ot1oex  fcias mDum(vp;() etomrcio1fmteluesls  2trxm iodlmenmics ()aDtauroou4teeo ictyd m2rl(mp;() eerircootfmtean i s) etmir3nudlmtnmivi t  Dtm( p;u4tlt ioeiasfa2el(vont0tetoxr tytom eai ilt seumxr nu4lme  neil(f Dumxmoou1olen o3iytls umu onu0artoir tydfmtr i i t srtmxrpnu1ll elivt sfa2urxrp;o1apto i3iadlsDemn p;t)trtomf oy1lmDrlivilt tetrio iu4ole mnesa(fsrra(  ;o0alxnifeiasla eln ont0tlenmf oodoaD ai i;s0tetoxm3iydlmtnlncs tfsDuru  nu4oleomfctasfs rln o;t0aexnir ty1optr ueils0t2toio3nu1lltnmfcsat)aDrr( pno0aex mo3ilsfm el( pnu)aetoir3oo1la elnvsl(0setoxr3iu1apen neias s2uaumoot0tex mo3iysfa ul(vpn(0texomr3oo1omtr i olt t2xm(o oy4lp e fvs ()arum(mo;u0openmi3tydfmDrm( s t)trtoxr3ta1oaDelneo ( s2xm(o nu4omenmfvsas artaxroot0apt iociltfsDran s (4texomo tatoaDelu i;t t2uoxm3ou1amtnlfetat sDtmurp;o4aee mi3iytfaDeau onu4alxnir3oatom  aueo s0setoiopio4oleemfci (fsDtmumpou1oetoioeildfs el(vo (0tetoif3tytfmDrlnvi;s0srxrxopio1aleemfeil()sDrmxr ;u0oet  iciys s2em(ms;u) lenmrcoatoatr ivo;(0 2xmxrpiy1lmenlncsatfsDuaxmpno0texomoetltfs2uanvo;(0 eermf io1fateaneil( texoim3no4lmeemnvil( a2rr(  ;t0optoifciltlmDuln o;u) rxrxr iadfat aieils0s2uo(rpiydlltemfvi t aDua( pou4teto ieiat m rlums t4 reoxr iadfa rlnei s  2tm(mpio4omtn feslsf rrrxmoot4altomi3ilslm2ra(mp u4 eerxf totoat lu ols t2xrxm3nu1amtnmfvtas)sDumxro;t4oexo ieiatlm2rlu sn()tleoxf oo1fa  lieslt0seurir iy1lltelieias) 2ra( p;t0aex  ictyslm2ranvsnu0alxrif3oo1fa rluvi (0trtr(mpiudlp e netatf rrm(rpnu4oeeomi3tas a rauvs u)alxoxr ty1fpDrlnvi (0s2triopiodlpte feilsfartmumpno4aexn ociydfm2um( p (0 lenxo to1fpDean i t srtmxo3iu4ap nmivtas a2ta(m nu0apt  oeildlsDuanvp (0aexoirciatfaD  u slt texmxm nu1ope  net (fs2taumo;t0tpxomoetasfsDrl(mo;()trxomo3iytlp   nvo;() eumxo nydoleemivsls)arum(rpou1tltn octat sDrlnvsnu4altoif iadomtraivs;t) 2xriopnu4altelfes s) Drax onu4tleo oeilsfm2emnvpnt0aexoxo3ty1fmtelneslt  exr(r ny4lltnlnviltf 2rmu  ou4ole io3iasfa2uau s ()teeoxf3oatoptrlu o s tetm(rpoudal eliesa()arurxm ot0texnmictyt a2rlnvp () leoxo3tatom rluvsls0tetr(m oodaptemncsat artmu onu0tlxomfciasfmDran o;u0tetrifctytlm elnvs;s)texm(mpoy4lptelfvsl( s2urur ;u1altnmi3tydfsDuau s u0alenio tytlp r uvi;(  2umio io1ole mfeiat)aDurumpou0tlx  f3iadfsDelnvp (0aexnxo totlaDeaivils0seuoxo nudomee icia()s2trx  ;o4tpxnmo3tyd s ean s t) renxf io1optrlnvi;(0seum(r3ou1apeemnvt tf rur(m no0alxoiieiasla2rlnvp;u0tetomf iodfaDrlues t) rtm(r3iu4lltn ivslt a2tr(m no0ole  ociasfa2rmn s (4aleoio3tatlm e u sl()setrio nu1olt mnci s  rtrxmpnu1oexnifciysls umuvon(4trtoxocto1laDeaies;( teum(rpnu1ap e ivi s srtr(r ot4ape mo3tas a2rmn pnt)aexoifcoo1laDraneo s0trtm(o ou4ap   netlt aDta(mooo4apxoii3iadfm2ul( sn(0artomo ia1lm  lnvo;t)srxrxrpiy4opt  nes t)sDumurpno1oetn f3tlsfm ulnvon(4tlxrxf3to1lpt auvsl( trtoxm3nydaptemnci s)s2urxm no4tex mfctatfmDum( s u)trenxociodfp eli olt) 2xm(m nydam e ivt t)aDurx onu0tlto fetld aDrlump;u4areomfctodomtelu o;s texm(mpnodomt lictatfs2tmx pot0ape miciat a rlnms u4 lxoxfcoo1oa rli sl( s2xmxm3iu4ope mnvtas)s2rm(m ;t4aptnmf3iysfa2rm(ms (0 exnmfcty1omt luvil()t2xm(r io4lp e fvs s)aDrax  ou1oetoii3tyslaDelumpnt0tetnircoytfp e ivol(0 rurxr3io1lpenlfet s artmxronu0ape  ociys a2emnvp;(4 exrio3iy1fa ranvol()trtmiopnydlltnlncs s)s2taxmoou4tltnmfctytfmDuauvp;t)aeeomrcootlp rlueolt  rtmim iu1lpee ivta() 2tmu pou0olxo ictaslaDuluvp;t)texomf3to1faDr i slt0srur(mpnu4apte nvi ()s2um(ronu4aetoii3iltlm rlnmp;()artrifctytfmD lnvs;()teuoim3iodap  lfcslt)arrrxm no0tlto feild sDrmn snu4trenmfcia1lp raiesl() eto(r oudlme mnvsa( aDururoou4ole mo3iatlm ea(mo;t)aeeomociytfmDrlueil( tetoxmpiydom  mies (faDrm( poo4tlxn fciatfs rlumpnt0 lxnio3oytfpD ai ils) 2uo(mpiy1optelfetl()srurx  oo4tptoiociyt m2eaump;u) eenmr iadla   nes (0 2xo(o3oy1am nlfciltfs2uauro;o1aptoii3iytfm2rl(ms u)tetrioctodlmteluesl(0 rxm(r3oy1amee nvtat)srra(rpnu1tpto i3iaslmDelnmo;t)trtoxfctotlatr nvol( teumiopny4ameemfesl(f rtrxm ot4apenifctldla rl( s (4aeerir3tadop r nvi (0srtoirpiy4omtelncils)srtmuront4tpxniociydls ua(msnu)tlermf iydoa eluvils trxoxm oy4omtelivt s  2umu pnu1alxn i3iydfa rlums (0tltrmo oydomtelivo t0 etoxm3iodap emfct tfsrrau  ;o4aet  oetlslsDrl(ms;(4trxrxf oo1optr uei t0tetrxr3nu4op  lics ( arur(  no1teeo ieilsfmDumnvs;(4tetrxo3iatlaD au slt0texmio iu4llt miesa(  2rruronu0altoif3ildlm2rau pn(0aexoxfciadlmD aieo s t2tmxm3iydol  lfctatfs2tm(ro;u4tlx if3tlt m ea( s (4aeenxf3ty1lm r nvs;()t2umxo oudlltnmfes t s2tmurpnu4aeto fetltla2ran s;t) rxomr3tytlmDranesl()setmxo oy1olt lncs ( artrxr no1tetnioeild sDuanvo;(0 etrir3ty1latr u s () 2xr(mpnydllt lfei sfartrum nu1tee  i3tys m ra( ont0alerif oadop  an ol()trxm(opou4ope  fetl( aruaur ot0texo oeildfsDuluvs (4aetoxo iytoptelivi s0 eumxr3iodamtnlicsatf Dta(ro;o0oltnii3ilsfa2em( o u4tetnmo3tytfmDeln i ()trtr(r3oo1apeelicilt)arumxmo;o0texnioetasfs2eluvo;()tltnxr iatla rli s ()t2tmim iu1lp elfvtasf 2rr( pnu4olx  oetas s rmuvp;u4aetoxr oodomt  nvs t  etrxrpio4amenmnvils)aDtru  nu1tpxoifetyt mDrm(vp;u) lxrio oatlaDr nvo s)s2ur(opnudlm  mncil( aDrauronu1aex ii3tld m2rm(msnt)tlxrmr to1fmtrlnesl()t2uo(o ny4opeelnei t sDrau p;t0opxo icias s2umnmp;t4artnmf3oytla r nes;(0t2xrxr3iydll e fcs sfs2rauro;u4tleomfciysfaDeln o;u0 eermocty1fa e u s;t trxm(o oo1aptnlietls  2tm(mpou0oet iieilslm umn p u0tlxnifctydop eluvo;s  2uoxm3ny1omtnmnes s) 2rru o;u4texnifeiyd m2eauvp t4alxnio3oo1opD aiei;t0 rurxo ou1ap nmfvs t  2rm(ro;u4tet mf3ildfm2emu p u0alerxr3totlmt ln o (0 eurxo iudal nmfesas) rtru p;t0olx  ictytfaDumn p u0texnio3oa1lmDeai s;s t2urxo no1openliesas s2um(m nt1oeen o3iadls2rl(msnt4teerxo iatoaDelneolt0srto(mpnu4ap  mnei s  2urx o;t0aeeoifctlt a2ulumpnu4arxnmfctytopDe n i s) etoir io4lpen ncsa(f Duau  ot1opeomfetlslaDulnmsnt) rerxociatopD lneo;t) rtmir3iudal nlietlt s2umuro;u1aeen fetls a umuvpn(4aeermoctotlpDeauei s  2xmxm ou4optelnvias  2tau  nt4olto i3ilsfm2rm(von()aetrmrcoa1lmt aiei;()t2xmir3io4ameelfesls aDua(ront1ale moetydla em( ont4 rtrmr oa1lp elies t  rumiopnydopenlivs sf rtrumpnt1texniociatlm2uaump;u) etrio3tadop eaieilt s2tmxopnudame mnvs t artaxrpno4aetomfctls a rm(vo;t)altomfcoytoptranvi;t) 2to(o3oudlptelneslt) rtrxm oo4aleoioetlsfm2uluvon(0altomfctadoaD auvi (0t2trxr oo4ll nliciat srrr(m nu1alen i3tat a2rmnvs t)alenxo oadoptr i s t0trtr(r iydomtelnvsa(f rtm( ooo1oeen fcild mDua(vp;(0 reoxf oodlmteaues ( srto(r3iudapte feia() Dtau  ;u1opx  f3ias m rm(ms t4 eeoxr3ty1lpt anvi;() etoio3oy1llenlfvtat  rtrxmp;u1aexnmoeiaslsDraump;(0 rtrir ta1op e ieslt srxoiopnodlpee ivilsfsrrruronu0tpxnii3iyt a2rluvsn(4teenxrciatoaDr ueils texmim3nudolt licsas)srra( o;u0apt ioctadfm2ran s;t0treoxr3ia1lm  lnvo s srto(opoo1ope  netlt) rurum ot1oeeoio3iasfm2uauvo t4 rtnmoctytfat aivo s)sexmir io1optemncsa(f Drrxr ot0tpenio3iys a ulnvpnu0 rtnmfciatfat lnei t t2trimpnu1ll emics (  ruau p;o4aexo f3iyt m2ul(von(0alxniociy1lp   nei;(0teurxo3oy1opt mict ()aDrax  ;o0oeenmfciyd sDuluvsnu4 eerifcoatlmDrlu s t  rxrir3ou1alee nctas srra(mont4oetnmieiytfaDumnmpnu4 ltoiociytfptean i;(0seto(opno4am nliesas a2tmurp;t0ole  ociysls rl( sn()arxrir3io1fmteaneol(  etoxr3iodap nmncs (fsruaxrp;t0oet  fcias mDea( snt0teenmf iodom  liei t s2ur(o3oodomen feslt  2tmxmpou4oeenii3iys a2ua( snt4tltoxo3iotfm r nei;( seur(rpoy1lmtemivsas sDrax ooo1apxomfctltfaDea(vp u)aetomocoydfaDeln i s0srto(r3io1lle mieias  rrm(m no0altniictytfm2umnmon(4tlxnxfctatfm e i s;t0truo(o io1om emnctlt)srtrxro;t0apxnifetytls2uanvo (0arxoif todfpDrln s s trto(m nodapt mici tfsDuau oot1oeto i3tldfs elnvsn()arxrmfcty1laDelnei ()texo(opnodale lfctltfaDra(m oo1teto ieiys sDel(mp (0trtrio tatoaDraueo ( texoimpoy4oltelictltf rraur nu4tee iieildls ua(vsnt4tlxrmfctotfaDrlivils) ruo(r3nu4ap emfetlsfsrurumpnt0apxniiciytlaDul( o ()tltnmrcoydfateaieo;(0 2umirpoodop   ieil( s2ururpnu1aeenmfetldfa um(
\ No newline at end of file
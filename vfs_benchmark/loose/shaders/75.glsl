@@ -0,0 +1 @@
+ivi t)tetmxrpno1ope  fesl() Dtm( pou0tet mfeildlm2rmuvp;u)aeenxocootoaDelivs;s0t2um(m no1altemncslsfa2rm(r nt1altnmf3ilt a2eanmo;u4alxomr3ta1lmtr uvols t2xmir io4ale lfeta(  2tax pou4alxn oeiysfs ean o;t4aetoxf iytlmtean i;t setr(r io4lp emfvslsfsDtr(mpoo0tle  i3iltfm2uluvo t)teerircoodfmDranesl( sexrir3oy1oltnlfcia( arua(mpnu1tetn f3iytlmDel(vp;t)alenir3iydomte i o t) 2urir oo1lptnmfcsatfsrum(monu1apxn ieiad a elu p;t0artrir tydlat an i t)s2toir iy4omtnmicsas)sDur( ooo0optoii3iys a rm(msnu)altrxf3iodfaDrluvi s) ruo(o3oudaleelfvt s artm(r nu1aee mieiatlmDuaums (0aeeomrcoa1lp r u ils)srumxm3ny4ll e ivslt)aDtm( ono0opt iociydlmDumnmo ()alenxfctotlatr ivs t)setmirpou1lmte ics s sDua(mp;u1tlenmicildfaDrmu o;(4texnxf oydfat ln o;() rum(r3oy4oltn nct (f 2tmx  nt0oeeo o3ilslaDrm(ms;u)arxoif3oo1fmDeluesl()trto(opou4om  miviatf Dtr(r oo0tlxn o3ildfs2eauvpn(4altrio oa1laDe uvilt)s2xo(m iu1aptemfcs t artrumont0aeto ociat a2ra(vsnu0 exomr3iatoa elies s)s2uoir3io4openlfvt t artrxrpot4tle  feiytfs umuvsnt4aexoxr3iytomD au s ()t2xmxo3oo1lpee ieia()s2tmxmpnt4aptomociasfs eluvp;t4altoxr3iytfa e ueo;s0s2toim nydlle  fet t)aDtaurp;u0teto o3iadfa2ranms (0 ltrir oytlatr ues;s  exmxo oydopt mieslt)a2umu  ou1oexo fetadfa2ranmo t)teeoir iadom   ieslt0 rtoiopny4lptnlfvtas)sDtm(r ou4tltomf3iydls2rlumo;t4 exrio oydlmD lu s t0t2trir no4lp  lfvtat)sDrrxrono0tleniietas s2uluvsnu4alxoxociatop rauvolt0teum(opno4omtn ieias)a2umxro;o4teenmo3tasfsDuauvp u)tlxoir3oydfa  lies t seuo(m ou1lmen ivsat)aDururo;t4tleo ictat a2rln p;u4 eeoxocoa1lm  ln s t)s2trxm iydapt lfvia() 2umxroou1apt ifetas sDemuvs u4arenxfciotoptrli i t)sexmirpno4lme lnctatf rumurpno0opeo ociysfsDuau p;(4aeenio3tadopt  uvi () eum(mpiy1ol e iei s sDtaxm nu0tpt iictltlaDrlnvp t)alxoir iodopDe nvs t0 eumxo nydlp emicilsfarrmump;o0optnioctlsfmDeanvs;(0 ltnmociotfa e u ols)srtmxrpnudlmtn fvtasf 2rru o;o0tpen fciat a2rmuvpnu)tltomo3iatlp  au s t  2toim ny4al  mnvsls sDuau onu1tpt mociatla2eln p () ltnir3todfmtr i sl()tetoirpoodop  lfetas  Dra(mp;t0oee  iciltlaDrmnmo u4aetnifcoydfpt livslt trxo(m3iy1om emnetls sDtrx ooo1tpto octyslmDemuvp;(0texnmfctytoatean o s)trumxopiydllenmfvs sfarrm(ront4alx miciytfmDelnvpnt)aeenmo tatfmte n i t0 2uoxmpio1alee fesl( artru  nt1alenmictlsfm2ulnmsnt) rtrir todlpD aueol(0 2uoir oy1lme mfvsl()a2ra(  no4teen fetatfm2ua(vont) rtrxr3oa1lmD  u s;s)srxrimpou1optnlfet s  Dtm(mpno1aeto i3iytfaDra( on() exrio3ia1lpDeauvi;t)t2trxmpny1lpt mfeilt  2rru  oo0alt iietasfm2rmnmo t)altoircoydlmteluvil( tetmiopiydaptnlncia()a2ra(rpot1alenioetldfm2emnms;u) lenxf oa1fa elnvo t0 2ur(mpiu4openmnvia(  ruau  ;t1teeo octls a emnms;()trtrmo iatopD an s;t0t2trxo3iodome lnvs () 2tmu onu0tee mfeiydlsDrlump u4teenif totlmtraiei;(0teuoiopio1om elfetasfaDrm(m nt4tetnmietltfm eluvo u0 rermfcoytla r nvi s0tetr(mpnodom nmivsas sDrau  nt4tpt  octyd sDemuvp t)arxomrcta1opDraivol(  etrxrpnudale mict ( srtm(root4oexoifeiytfaDranms;u) renmo3ootoaDe nvs;t0t2trxm3nu4ap  mfes ( a2rr(m ;t4olx mo3iatfm elnvp;()tlxnmf iadfpDe neol(  rxoxr oodaleemivs t arrmum ;t0apx  fcils aDrl(mo;u4areomf tydoptr uvi t) etoirpiu4ol  mieil()aDrauroot1aee mictydfa umnmont4arxnir3oa1fmte nvs;s) 2xm(r nu4ap nlivt t) 2uaur ou4alt mf3tyslsDeanvpnu4 lxoxo3to1oaD  u o t) rxoio iodol n fes t)s2trxmpot1tpxoifetyt sDumnmon(4 lenmf3oodlate ieo;t  rxmio3nudap nlnci ()arururpoo1apt  iciytfa el(ms;u4alxoif ta1latr ivilt0 exrxrpoydop nlicia(f Dtmumpnu0ape  ociyd aDrauvsnu) ltnmr3iodomt lnes t  2uoxm oo1ole lfcslsfaDtm(  no4tltomoeildlm ua( s;u4arxrmo oadlmDrlnei (0 rxmxopnu1lpe mnciat  Dur(moot0tlxn f3tlt s ua(ms t0 lenifctydoaD aueol( sexmxr nudopt mieiatfa2raxr no1altoiiciltfm2elumont4 rtnifciydlmDrluei (0t2toxo3iudolte fvilt) Dtm(mont0tpenii3tld m2ua(mon()tetrxf3io1lmDrluesls0 2xrirpnydlltn nct (fs2um(rp;t1ope  fciytls2uanmsnu4altrmfcoo1optrli ilt  2trxo3ny4omtelfctatf rum(  no4tet micilsls ra(vs t0 renircoydlatrlivi;( t2tmim3ou1al emieta(faDtaum ;o1openiictytfa umnvsnt)tetomrctodomD  nvol(0t2xm(r iy4lm nmnvtat)aDtm(  ot4apxnmictltlsDel(von()aeenifciadfp  an ols) 2tm(o oo1oltelivsatfarumumooo1tetn ietys sDeauvpnu4 eerif iodlm rli i ()seto(r oodlptnmfvia() Drm(r no0olxomfcild aDuanvp;u0 eeomf todlm e n ils  exm(opiudlp nlfet sf Drrur nu1tlt mociydlmDrmnvo (4 rtnio3iadfpD  nvi;(0trxmxm3oy1apt  nesa()srumurooo0aee  i3ias m eanmpn() renxfctatlaDr ueols0sexrio3ou4lltnmnetlt arumumo;t1olen iciydfa el(vs;t0aetnmfcootfmDe uvo;s  rxrirpoo1aptn ivi () rtruroou1oltn ieiat a2ul(vont) ltnmrciadla   ivi;s texoim iy4al  mncs sfa2tm(m nt4tleo fciatfsDul(vo u4aexoifcoatlp  an o s0 2xrxo3io1optnlfcsas a2ra(mono1optoii3tlsfm2em(vont0tetnxf ty1lat  ieils  exoxo io4omenlfcil()aDua(r ot0apt ifciltlaDeauvonu4 leoiocoadlm eanes s)t2xo(r3no1lmee ici s aDtr(rp;t0tpx mieiydlsDea( p;t0trxomocio1lmtrauei ( srxmxo nu1ale  netls  rua( o;u0oeenii3iysfaDranvs;t4aeeoio3ia1fat  ivs;(0t2ur(m3oy4lptnlfeta()s2umumpou4oleoiieiasfa elnvo ()trtoxrctatfaDraueols0texoio oo1llee neils)s2trum oo1aleoioeils a2eln onu)aetnif3ta1oateau slt0sruoxm ny1lpee ivs t  2uau  ;o0tee iieiytfaDeau onu)tetrxocta1om  lneo;t)tetm(rpio4lp  mnvs t) rrr( ooo1tpxoioeiasla eanvsnt) ltrmo iotfate uvo;t0 2tm(opno1lpe lncilt s2trumo;u4alxnmictaslm2uau o;t4tlxoxrctodlp rli s t) euo(opiudlm n ivia() rrm(rpnu1opeoifciatfmDemn onu)artomocootlaD aues (0 etoim3oydlpenlnvslsfarrmx p;o1aeeoio3iydfm ea( s t)arenif3tatlmteaivs s0srum(mpny1llt  feils)a2uaurooo0tptnmieiatlmDua( onu)tlxomo iadlp   n sl()seurim3iudlpt mieta( srtr( pno4tleomfeild mDulnms u)arxrmf oodoptelneo;s  eurio ou4ll e fci ()aDtrumpot0apenio3tadfa rluvs (4 lenir oa1fp rai ols0 ruoxr3oy1lm  lnvtl( srtmx oou4aptnmfctldlm2rmuvp;(4aexoiociytoaDrlu ilt0 rumxo nu4openlnvi sfsrrrumpnu0apxnmo3ilslm rauvo t4trerio3oatoatrln i;( tetoxo3oy4ap n nvia( aDur(  oo0apenmiciysls ea(vp u)aeeomfctadfaDe nvo;(0sexrxopno1al  mncsas) 2urxmoou1tpxn oeiadls2ul(mp u0tetnir totlaDr iesls  etrio3ou1ap nlivtat srurxmoou4tltoiociyt a2rl( p;u4trtnxrctadfa elneo t)s2xmxo3iudol n ncsa( a2uaxr ou4alen iciys sDum( s;(4 ltomo iotfa rlneils srurirpoodolte fcsa() Duru pot1aexnmoetydlmDuln p;u0trerif3iatlmDr neil()t2xr(o3nu4amtn iet ( aDtm(  nt1apeomo3tlsls2rmu s t4 ltrxr3io1fmD liei (0trtrxrpiydap e fes t artmx p;o4tpeomi3tat sDemn s () ltoxfctadop raues (  2trio3nydaleemicslt)aDrmumpou1tee mi3iadfaDelnvo;t4teermrcoa1opt lies t0 euoxm3no4lpte fesltfaDrrumono0oetoioctyt mDra(ms t0arxnxrcoo1opD anvi (0 2xmxr3oo4am n fciat)sDur(  ot1ape mi3iyslaDeauvp t4teeomr tatlm elnvo;t0 rxmxo3no1lm  lnvilt  rrax  nu1tpto oetldfs2uauvonu0 rermfctotfmD li sl()t2ur(o3oodopenlies ( s2rmuro;u1aeeoiiciltfs rl( pnt0tltnio tydomDrau i;()seumxo3iy4llte ncta(fsruaurp;o4teto f3ils s ulump u0teerio3tatlmDrli ols0 etoim3io4openmnctls  2umum ;o4apeo i3ils sDumnms t4 exomf3iodfpt auvi;(0t2xo(mpoudoltemnei sf Dum( pou4aetomf3tasfaDrlu snt4 rtriociydlp rai o t0seuoxr3iy4lp   fvias srtmu  ;o0oexniicildfaDrlu o (0 etnmo totoat  ies t  eto(o3oudop emnctasf 2urx onu4opt  f3tldlm rlnvp;t4alxoxo oa1fmDelnvolt)s2to(mpiodapenmfcsl(fsruaumono4olxomicildfa2elumsnu4 ltoxo totfpDe iei;s0sexr(mpny1ameeliciatf Duaurooo4opto fcias s2rl(vp (0 rxnir iotop rai ols s2umxo3oydom nmnvtasfaDtrump;u1tpeoif3tadls rlnvpn()altrif ootlptraueo;t setr(r iydop n fctls)sDuax p;o1teen fcilsfm ran s t0 eerxfctydop eau ol(0teumxo3iudlm n fci () rta(  ;u4alxn feilsfs emn pnt0tltnircia1faDraneol() rtmxo3no4amen ncsatfsrtaxrooo4tpe moctatfs ua(mp t0aexnmocta1fp  lu ol(0setrimpny1am emfvs (  2tru  ;u1opeoiociytlmDrm( o (0tlxomrcoa1oa r ivsls)trtmirpnudal   ivtltfaDum( o;u1oleo oeild mDuan on()altoxo3oa1lp elueil( tetm(o3nudaptn netlt)aDurxrpnu4aptnmicilsfmDul( on(0 exrif3tydfpt ai slt  rxo(rpoodapt  ivta()s2rr(  ou0oee  ieild aDumn pnt4arxnmf iatopDeauvs;s trxr(r3iu1op  mneil( srurxmont1tlxnmfeilt sDrmu o ()trtoiocoy1fateai s;( t2tm(o3iu4om  mict (  2taur ;u4tee  i3iltfmDuln o () rtrir3ty1la   nvs;()s2xmxr iu1ome liei ()sDrr(m nu1oee  ociyd mDrlnmo (0tltnioctytla raueo () etoiopoudlp e ietl(f Dra(rooo4aleniietls mDrm(vont0 ltomr3ty1fp r nvi;( trxr(o iu4lle mietls) rrm(rooo4oexnmoeiysfm2emnvo;t0tlxrif3tytfm eln o t0tetm(m nodamtnmfviatfsDum( p;o4tpxo octlsfaDrlnvo t)tltrmocoadomDelueols) rurirpoo4lmtelivsa(fa2uau pno0tltnmoeild a elums u) ltnxf3ia1oaDr iei;(0 rxoxm oy1omt  fvia(f Dtmxmpot1tlt moeiadfm2ul(vs u)tlxrif iotfmD  nvi;t)tetmxopoo4opee neslsf Dtr(r nu1oeeoii3iytfm rlump;(0trxnmo tydfm rai o;t)sexoio3oo1am  mfeilt)arurxrpnu4opeomiciltlsDeln o u)aetnxf io1oate uei;t0seumiopou4llt  fcsls)s2ta(m ;o0aptomo3tytla el( o;(4 lxnir ta1omDr u ilt)t2xrxo3nu1aptelfvslt)a2uax pou4openifctyd m rlu pnt)texriocoadoa  livsl(0 ruriopou1lmeelncsls) 2umurpot4tlxo fcilt a umnvp ()artnmf3tadopDe ivo;s  2xr(r3iy1ll e fci t) 2rr(mp;t1olx ii3tydfa2emnvo t) lxnmf io1fpt lneo;t0srtr(m iu4llt  icsls) rtau  nt1olt mietlsla2rl(vo;t4tlxoio ootlptraivs s0s2xm(m oudole mictltf rrmur no4oltn ieilslsDuanms;()tetrir iodlat  ivslt)trtmio nu4apeelivt sfa2umxmonu4texoif3tasfmDum(mo u0aetnxo iydfm eli il() eurirpoy4lp emicslt aDtmu ono4tee mo3tlsla2ua(vo;t0arxrif3oadop rluvi ()t2xo(m3iodop   nvias arrrxr ;t1alx ii3tad a2em(mo t4 rtrxfcio1oaDelivils sexrxm3ny4op n iviltfsDrrxmp;t0tleoii3iadlmDranvsnt4arerxf3iydop raies;t)t2uoxopny4omen ncsasf 2uaumpno4tlxn iciysfm2rmump u) reoifciytlpDeai o;( setrirpny1amenmfciltf Draum nu4opeo f3iyd a2eanmo;u4 renio3iydlpDrln olt0s2to(m ou4alenlfet tfsDtaumooo4olenmietas m2em(vs;u)areoxf3tatlmtrln o;(0sexrio nodoleelneia()srrau o;o4teeomi3iatfs2uauvpnu)tlxomr3iotomtr neil(0setmxrpnu1apt  fcs sfarrmxmpoo4alenmfctas s2umuvont4aetoxo ty1oaD  nei ( s2tmxopno1lp emiesa()a2ur(rpno0openif3iydlmDra(vs (4arerir tadoateau ol() 2to(r oudom   neia( aruau  no0aexnmfciytfmDea(vs u0texoio oadla r ivilt sruo(o3iy4aptnmfcslt artrurp;t0olt ioeiytlsDrl(ms t4 rtnmr ootfmD  nvo;t0t2xmim3oydolt mfvtlt  Dtmxmo;t4apt ifeiysfa2uaump t)teenmfciadfaDraivi;t setr(m oudom e fcsltf rtru pou0opeoiociytfa2ulumpnt0alxrio oydomDe u ol(0teumxr3iydape  iei ( aruru  ot1texnmoetys s uaumpnt4 renmociodlateauvi;s)s2urirpiy1lle micilt s2umum ou1tpx moctatfa em(vs;u4aleoxo3tadla e neo t)t2umio3nydolt lfeilt)sDtmu o;o1alxnmoetltfs em( s t4altnxr iytla rai o (0setrxmpnydaltnlncil(faDua(m no4tlen fcilt s umn p;(0tlermf3iodfa elues;( s2xm(r3no1am   fvil(  rum(r nt4teeomfeiatlsDuluvo u0arxrmo3todlpt aneol()srto(m io4ap n ivsat sDtm( ono4apxnmieiyslaDemuvp;t0tltrxo ootfaD aueol(0trxrir3no4om elfctl(faDurumooo0tptnmictatfm ea( snt)texoxrcoa1omDe u o;s0t2ur(r io4lmtelicilt) 2rrxr nu4apt  fctas a2umu s u)trxoxocto1fp rli i t t2toim3oy4omee ivtltfs2tr(ro;u1ole iocildfaDua(msnu) eeoxfcoodlm  luvol()setr(rpoudop n nvs sfs2rmxmo;o0tlxnioetltlm emu o u0altnxo tadfptrln sl()s2urio ny4omt mivt tfs2rau  no0alx  icils m ulnvs t) rtnxfcoodlp  auvs s0s2trxr3oy4ame  feslt  Dtmu  oo1ole mfeiytfmDemnvon()aetoifcoa1oaDrlnvs;s  rurxrpoo1omtn ncs ( srtmxm oo1tle  iciltfa2uau p t0tetoif oodfaDeauei;s)trurimpoy4ale livi () rumxm nt4alenmf3iys mDrl(vp;()trxomo3iotlaD ai s (  etrxopiu4opt  fei t  2uax  ot4tpxn i3tyt m emuvo;u0trtrxr iadoat liei (0trum(r3no4alen fvslt)s2rrumoou0apxomfciyd s rm(von(4teeoxfctotfpDrlivo t0setrio3no1olt lies tfsrum(  ot1optomf3iyt aDumuvpn(4 lxoxr3oy1lm e nei s)s2ur(r3oy1llee ivtl(  2rmu  oo1alxn ieildlm2rmums;u4 rtnio oadfptr ivilt)tetrxo3iu4amtnlnvs t) rrmxm ;u1oeto o3tadfm eln p () reoxf oadfpDeli i;()srxmirpnu4omee fcsatf Drr(mpot0texoii3iydlm2ranvo;(4alxnmf3iodlpDelnvo;() euoio oy4llenmfvslsf 2ua(rpnt0apenif3tatls2ulu p t)trxoir3iodomD livi;t0tetmir no4optn ivsat)artrxro;t0opt  fcilslm ul( o t4tlxoir3tytfa raues;s trumxrpnu1lltnmfvtl()srtm(  ;u1oex ifciyd m2um(mo t4texoirctadomDraneo;t setrxm ou1lle lfcs () rtrur no1aee mi3ildls uluvsnu4 rtrxf ia1lmt li il( teuoirpoudam n nesat  Drm(rpou4tee  o3tadfs2rm(vs t)texoir oydop e ieo;s) euoir oy1lp  mics t aDrmxm ;o4altn fcilt s ul( p;t0 exomo iy1lp ran sls trtrxm iy4lpte ictatf rtmu  oo1olt moetysfmDum(monu0 rerxo3ty1fatelues;s trurxopoydlp  mfvs ()arta( pno4altnmociat m uaump u)trxoio oy1opt  n o;t0 exo(r3oudamt mietas aDta(rooo4apt mf3tls mDrau o;t)alxrmf3to1lmtr ieo;()seum(r3no4lpe  feta(f rumump;u0tlt if3iytlaDra(mpn() eenir3ty1lpDeaiei ()t2xrxmpiydaleemieiat) rrrx pno0tle  ociatlsDumumonu4trenir3tytlmte ieils truo(m3iy4am emncsas  Draur ;u4tetnii3ilt a2uan snt4aeeomoctatfaD  n s;s0srxoio3nu4ome livsl() 2urx ooo4ale mfeiyt mDem( s;t0 rxrxr oytfaDraivil(0truoxrpiu1ol   neia( arrmxr ;u0tltnmoctltfmDumn s;u0 rermo iydfmteai o;(0 exrio3ny1ll  lnviltf 2tmur no4aetnifeiatfsDumu p;t4arxnmo3tytom  lneils) rurxrpnydomt mfcs t) Drm(m ;u4tlt moetydfs2uanmo;(0 lxomo ia1op rai slt0 2xr(m3oydam elfvs s sDumx  ;t1oexo f3ilsla ulu s (4tleoxo ootfmt aieo;s  rto(o3io1lp  mfeilt) 2tm(m ;o0texoio3iat s ea(vsn()trtrio3tytlat an i;s  euoxopiydolenlnes sf rrau  oo4tpeoiietyt m2ra(mo (4alerir3oadlpteaieilt)tetmirpiu1lpenmfetat)a2tauront0tlenif3iad m emuvo (0 etrxo3iatfa e uvs;s0 rtoir oo4lp  lfetasf rrr(m nu0tlxoiociadlm2uln s ()treoxo3ty1fmDeanvil()trtoxrpny4lpeemfeils)aDrmx pot1tpenio3tydfsDulnvp;(0arxnxocoytom   i i;()t2uoxrpiydomtn nes s)arum(  oo1olenmoetyt sDeau o;()alerif todfat  nvo;t0trurxr oy1omtemiesl(fsDurumono4aexo f3ils s rmnvo;t0tlenxrciatop elu o;s trur(r3iudom elfet (fa2rmu o;o4oltomf3iytla2ea( s u0 etomf tadlaD lieo;s  2xmxr nu4apenmnesa()a2rax  nt0olenifciatfa2ea(mp;(4trtoxf3oodom elieo ( srxmim3ou1op   ncs ( s2uaurp;t0oeeo fcilslm umuvonu4artrircio1fat auvs;t0 2uoim nudap n fcsat a2trx  ou1opeomo3ilslmDrlnvpn(0 leoxo3oatfmD li ol(0 eur(mpnodop nlfvtlt)s2taurp;o0oleoiieiatls elump;t)treomr3iy1omD anvi s)trxmxo ny1ol nmietatfsrumx o;o1teto ociysfm emuvs (0tltrmo oa1fpDr ieol(0seumxopiy1ome mncsa(  2ur(m ;o0aleo feiytfaDeauvo u4artomo3to1opDe nvil()trum(o nudlm n ivs s  Dumxmoou0tle mi3iatls ua(mo () lermo3io1om   uvs;t sexoxr3nu4ope  nctas)sDta(mpoo1oltoio3iad a2rlnvpn(0trtnxr3tadlp  lu i t)tetoio io4lltnmnvt tfsDtmu pno1aexnmo3tlslm umuvs u0tltnif3ty1fm r iei;t)teuoxm no4am  lfcil()a2tmuront4aee mi3tls sDra(vs (0 eeoxrcoodfpDrliesl(0 exrimpnu1lpeelfesat)aDtr(rpno1opx ii3iys s2ranmo;u4alxomr oydoat ln o ()teuoxr nydal emivil()a2ra( pnt0opxo fctytls elu o ()alermr tytfp e i i;s0 rxr(m3oy1oltelivtatfsDrru o;u0tee ifcias sDrmu o (0teermr tadlpt au o;( srxm(o iu1open ivsl(  2trurooo4aexomocias a2rm(vp u)arenio3iydlatr u i (0t2xrim io1llee fci tfsDua(mo;t0tleomfeiatfaDrlnms;u) etriocoy1lpDrlnvi (0 2toxopnudameemfcsa() 2taumpnt1tpto oeiydfs rl(mp;u)aetnmociydlatr iei t  exrxm3ou4ap e nvs s s2um(r ot0alen f3iyd s2elu s u)arerir3iydlmDe n o (0 eto(opny4opee fcsatfa2taumoou4tpe moctatlsDranmp;(0 rtnircty1fpD anvs t s2tr(o io1lpt mies sfs2uru pno4alenii3tyslm eauvp u0 exrmf3to1om r ivols0 exr(opny1olt mivi () 2rru  ot0oltomo3iasfmDrmuvs;(4trermocoydop  lu slt0 exrxo nu1lmeelfet t) Dum( p;t1oltn ietytfs eaumo t4teenxociy1laD an i s trum(r ny4lpte ivias sDtmx  nt4apeomieiytls ul(vont0 rermrcoadopDeanvo ( s2umxopny1op   fcsa(fsrrrxrpnu4altn fctasfmDrluvs () lenir3oo1lm   ivi;s)texmxm3oy1lp  mieiatfarrau pnu4tlenii3tltfa ea(mo t0alxomo oodlatelies;s)trumir ou1am  mneils sDrm(r ;o1tpxn iciltfm2em( p t) leomr ootoaDr i i (  ruoxopiudom  lieil(fsrrauronu1aexomi3iad s2emnmpn(4tlxrxocoo1fmt aivs t0sexoxm3iudlpeemfci tf 2uaxro;u0tpxnmoeiltfa2rl(msnu4tleoio io1oaDeai o ()srtrim iydameemietas)s2taxm ;o1oet ifeiadlaDuluvs;t4texoif3oatomDr ues t truoxrpiu4am nlnes s sDtr( onu1tlenii3iadfmDulums t0trtrir3to1opte uei s  exoiopiy4llte ncs tfsrumx o;o4altoii3tadlm umn p;u0 exomf3oo1fp eaneo ()t2tmiopoo1ol   ivsl() Durxm ;t0oeen oetydls2rluvpnt)arerxf3ty1lm  lies;s  2uoxo oodom nmfetls) Dumxmoou0oee iietltls ul(vonu4 eeoxo iadopDrluvs () rtr(rpnu1ll   nvsa(faDurxmpot4teen o3tat s2um(vs;(0texrir3oadlp  lnei;(0 rxm(r nodll   fct sfsrtaxmono4tlxn oetldfs2em( p;u4texoxo3oytfateai ilt) rumxm3oo4amtn ivi t  2raxmo;o4aexoifctasls ul(vont4 exrxoctatfa rauei;t)t2xmxr iu1ap nmncsl() 2rr(ronu0oee  octytlaDea(ms t4 rtomr3iytfaDraivs;t  rtm(o3ou1lm nmneils)srta(  ou0tlxoiicilt sDrmn p u) reomocia1fmDelnvi;(0trtrio io1apeemfctat)srrr(ronu4oex if3ilslmDul( onu) etoxrcty1omDrau o s sruoxopou4lltn ncsasf rraurpot0tet  ieiyt aDum( s;t4tltoif iodoaDr ues (0srxoimpiu1olen ietasfsrrmxrp;u0aet  o3ias m2rlnmsnu4altoxr ia1lpt li i;s t2umxr3oy4aptemnviltfa2uau ooo4apenmictydlmDumn s;(4 exoxfciotfpD  iei;(0seurxm3iy1lleeliesasfs2raur ou0alen fciys sDemumsnu4 ltomf3ty1oat anvils0trtmxo3ou4lp nlieiat  rta(rpot4tpenmieiatlm2rlumon()teerifcio1fmD li i;t setoxrpoodal  mfvtas) 2rmumpnu0olx if3iatla ranmsnu) reoxo3to1oateln o;(0 2xoxo oy4om   icias)arumu  nt0tee io3tydfa ranvp;t4 exoirciatlm ran ilt s2tmir iodoptnmfvtlt)srumxr nt4tlx if3tysfs rm(msn(0 rxoxociodoateli s s)s2urxo nydlptnmnei sfsrtr(ro;u4tee ioetat m ranms;(0 exoiocio1lp   neils)s2uoxrpny4olt  nvsat) 2tau  nt1aptnifciad m rlnmo ()aexriocoydlm eln ol(0 rxrxr3nudlmt  fcia( a2urxronu4tlen ieiyd s uanvs;t)alxrmf3iy1la ranvs (0sruoxo ny1llte nvia(f 2taum ;u1oleniiciad aDrluvsnu4 eeomf3to1omt lies s)t2trxo ny4lptnmneslt) rrr(mpoo4ale  oetld a2rmn o (4artrmr iatfp  aieolt)srtrxopiy1lp elfeias aDtmxmpno4opeomi3tys a2el( o (4 exrir iadopte iesls) ruoim iy1amen nvtl() 2tmumo;u0aex mfeiydfm2umn sn(0 rxnmfcoodlm   ueilt0 ruoxm3ny4ap   fvsa(fs2umx  ;u1olenifciasfa rl(mpnu)altrxf io1fmtr nvslt)t2trir no1op   neils)a2tmurp;u4tpen octysls2ran p () rerxfciydla ran s t0teurim nydllt  fvils) rrr(mooo0oeto o3iydla2eluvo;u) rerifciatomtelu o s0 2toxopoydllee ivsltf Drrx pnu1alt mfctad a rlnmpnt0arxoxfctotoateaneo;t0 exm(o3nu4apt  nesl(f rra(r ;o4aexoifeild a2rlnvsn()arxrxo3totfmDrluvol()t2xoxr3io1oltn ivsat)s2raum oo1oexnio3ildfs2um(vo u)alxoxr3oa1optrai o;t srumxmpnudopenlnvi s  rra(r ot4oeeoif3tld sDrmnmpnt4tetoxr ia1om rluvi () rur(opoy1ape mnvtlt)a2rrumo;t0opeomi3iydlm2umumpnt4aexomocoy1opt  ivolt)texr(opno1lltn nei ( sDtmxmpnt0opxomfeiytlsDelu o u)arxnmr oy1lpD an o;s texoiopiu4aptelneiat sDrmumo;t1tpxomietlt s2elu sn() lermo3oo1fmDrlnvilt trur(o nydamtnmfct t) rrr(mo;t1opxnmo3iydfa2ean p u0aexrif iy1om  anes ( srxrio3oo4lm n neil(f 2taxr ;u0olenmfeiltfsDemn s t4 ltrmr oa1lpD lnvs;t trtmim iydale mfesl(faDtauronu1alx ifciys a2ul(mo t4tetnir oytfatr n sl(  etoim3oodam  mfvs s srur(mp;t4teenmociat a2uan s;() lerirctotlaD auvils0s2to(o3iu4olen ictl()a2raxr ou4olxoioctydfa2uaump;(4 etnmo3oodoaD livi t)trtoio ny4ap  mietat a2ua( onu4olt iiciyt m2rmn onu0 rxnmrcoa1omDrau o;(0 2trxr3nydlp  livsl(fsDtrur ou4open ociydlm ea( pnt)aeenmr3ta1lm  auvils  rxmimpoy4olt lfes s)arraxmo;t4tlxomieiaslm uln o;t4 lxrxoctydop raiei;t  2uoiopnodomen fvt t s2raumo;o4texomicilsfm2rlu s;u0tlxomf ia1laDr i slt) 2umir io1op emicias) 2ur( o;u0apx  f3iyt a2rlumo (0teeomfctodlpteai o;s0trxoxo3nodom n nvtas)a2ur(r ;t0texnmfciydlaDrmu p;u4aeenir3oa1laDr ies;s)t2to(o3ou1ale  iei s  2rmu  nt4aptnmo3ild m2ea( p;()arerifctydla r ues (0t2tmxr3iy1ap n nciltf 2rmu o;o1tlxoiieiad m2umums u)altrxocoodfaDeli o;( tetr(m oo4omeelnvs t) Dtmu pno1oleo o3tadla2el(mp;(4 leoirctatlpDeln o;t)t2umxr3nudlm  mfctl(f 2tmum no1ole iietat m2ua( s u)trenifctotla e ivs;s  rtr(mpno1lmtelivsa(fsrraump;u1tpeo f3iyt m emnmp;t) lxrmociy1optrluei s0trurirpnu1lltn nvt t a2trur ;o4apxo oetad s uanmpn(0 exoio3oy1lpDeluvsls s2ur(o3iodalee iviltfartaumo;t4oet  feildfs eauvp;t0aleoxf3oytomte nvi;t0 2uoxopny4altnlivi tfs2uaxmpnt0ope  fciysls2emums u4 eenxf3ta1oa   ies;t  rxo(opoydamtemnvi t a2rax ono1tlxnifciltfmDranmon(0aleomr3oy1fat anvs s0sruoxm oudolte fes tfaDuaumo;t4alxomictas a emnms;t4 rxoirctotlmD  nvs (  2xoir nu4ll nmnct ()a2ur(rpou0aetnmociytla2uanmp;(4tleoxo tytopt aivo ()sexm(opoydlmeelicil(fa2tm(rp;u4oetnifeiasfa2rluvsn(0teeoxf oo1fp rli ol(0seurxr3oydllen netat)s2trxmoou1tpxnmociydla2rl(mp;u0tetnmocty1omte n slt)srxmxm nudlleelici t a2uru oot1apen iciysfaDranvp () rerio oytoa rlnvs;t)texrxo3oodam  lfvil(  Dur(mo;u4aex if3iatls2uan p;t0altoif3totfp   n il(0s2umxo nu1lmee icsa( s2ra(m ;o4olenio3iytfa2um( o (0aexnxo3iotfmDr ivs;s)srxrxo3oy4olenmfes s)sDuau  ot4texomfctasfsDeanmp;t)aetnxf oa1fa eli slt)s2xrim3oy1omt mfcs s  rua(  ;u1tltomiciydlm em(mo t) lenif3iytfmDelueilt)sexrimpny1apen nctat s2tmuro;o1optomf3iydls em(mp (4 ltrir tydfptelu i t  2ur(o3ny4olt micta()sDraur ou0tetniictldlmDulu snu0texoif ootop  auvs (0 rtr(m3nu4ap  mict t  rtr(root4alxoiociaslmDem(mont4altnxf3tadfmDeauvo;t0 rxoirpnu1lpeelfeia()aDurxm oo4apt  octasfm em(mp;u)tetnif oy1oa  an il() rurxmpiodamen ics tf ruau oou4tptoio3tls s2ra(vo ()aeermociotlp elu s;t  exmxmpoo4al  lfesltfs2tmxmonu1apto f3tadfsDum(mpn(0alxoio3oy1fmDranvo;()s2xr(rpiy4al elies (f 2rrx pou4oetoioctltls2rlums u0texrmo iytfmD ln s;t0srxoim3ny1apt lnvias s2ur(  ;o1texniiciyslaDrmu s;u0trxrir3iydoaDe n ols0 rum(r3nu1omtnmfvs tfarua(mp;u1tpe  i3ildlm2eanmpnu4areoxrctodomD livo;t0 rtoxo3nu1omtelivi t aDtrumpot1ope mi3ilslm eln o u0 eenxfciydfpDraivs;s  rxrxo3nu4al  mietlsfaDurump;t1ole io3tad m2rln ont)altomo3todop  anesls texm(r nudoltn ncs t a2tmxroou0tlxnifeiltfs2umumo;t0tltnmo tytfpDe i slt) 2xm(o oy1altelfesat)srtr(mpot1oex  o3iyd a2rlnvonu) etomo3iodoa   uvol(0truoim iydaltelfesat)a2ta(mpnt0texo ieildla eln onu4aeenmo to1op elu sls0 eto(o iudaltn fcsl() rumu pnu1tle iietydfs um(mpnt0aeenif3iatfaDr nvi t0 2tmiopoudam   ncias) 2rrumpnu1opx iieildfm uan s u)tetnxo3oadoatr nesls)tetr(o3oy1lpee nvt sfaDuaump;t1tptnmietaslsDel(vo;u4 rtnmf3oy1op   uvo;t)tetoim3nodam   fct sfaDraur ;o0oeto o3tls m2uluvo;(4artnxrcto1laD ai i;t  2tm(rpou1amt mfeils  2tm( oot0tet  octlsfa rm(vont)arxrif iydfptr n s;s0trtrxo nudalen iviatfsrur(root4tleniictytla2el( snt0 exomf3ia1fp   u o;s)s2urimpnodaltnliesa()a2raum nu0tpeomoctydfa rln o t0aetnxo ia1optr nvi;()s2tmxrpiu1oleemictas aDrru pot1tptoii3iydlm uan snt)artrif3tytfmDeaueo;t seurxr3nodll nlfvslt) rtrumo;o0aex mfciasfm2rluvon(4arxnxo io1fateli ols) rtoxmpio4ame  iet t)srumumont1aeto oeiat s umu p;u4tlxriocoatom rln s (  rtmirpnodlp nmnctat) rrrurpno4tpx ifciydfa rmuvpnu0aexomrcoodfaDe uvo;()srxo(r no1lltn fcsltfa2rrum no1aptnifetaslaDuln pn(0aeeomoctodfa   ieil(0 rto(mpiydlmeemfcias  2rm( ono4opt ifeiytlm2em(mo;() lxnmf iy1lateln i (  rtr(o3nudap e fct t)aDurumpnt0altnmieiys mDelnvo;t4alerif3oo1fpD lueols0 exmxr no4ll nmivt (  Dtaumonu4tlto f3iat mDrauvp;u) etoxociatfpDeaieo ()trtoio3ou1omt mncs t artaump;o0alt  ieiydls emnms u0trtnio ia1oaDrln ols0 rxo(opnydllt lncil()aDrmxrpot0tpt  feiydla2ulumo u)tlxrmf3tatfpt lnes;s) rtrio3oudapeemiesltfs2urxro;u4oet  fctasfsDra(vsnt)aetrxfciodlm  auvs t0tetr(m3io1ame mietas)sDtrump;t4tpe mi3iatfaDul(mp (0tltnmfcoy1fm  auei (0 rurim iu4ame liei tf 2tr(r ou4olxnmietytfm rmu o;(4aeerifctytfaDelu o;t0t2xm(o3iy1optnlfctltfsDtru o;o0aet mieiadfmDuan pnt)texnxf3todopDraivi;s) rtrxr no1oltelfvil()sDtau  nu1openmictydfaDuanvpnt) ltoir3oy1lmDelnes s srtoxmpoy4am   nct s)a2taxmont4tptomoeild m ranmo () rermr oytlm elnesls)t2uo(m oodll emiviat)sDrrump;u1tptomi3ild sDua(vonu)altoxrcoa1om eaneil()texrio nu1lptnmiesls arurxro;o4tpxnmf3iydlm2em(mp t0arxrir iy1fpt  uvils s2umirpoo1lme mietls)s2uaxrpou0optniociyt m2elump u4 rxoxrciadlaDeau i;s0s2xrimpoydalenlfctatfarrax ono0opxn ieild a2rm( o;(0texrmocoy1fmD aies;t t2um(m3no1amtemfesas) Dtm(mpnt4tee  i3tyt a uan pnt0teerifctytom r i o t) etrxrpoudoptnlietls) rtaurooo0aet ii3iatfs rmn onu)tetrio3iytlp   u slt0t2urxrpny1lmenlfetlt) rtmxmpou4olxnmfeilt sDum(mpnu4 ltrmf3oa1om eauei s0texrim3iodom nmiesat arraxrp;u4tpx  ociadfs2ea(mpn(4trenmfcoy1lptrlu o t0texmir3nydam nmfcilt)s2ra( p;u0texnifcilsfsDranvo;(4tetnmrcia1fm rauvol( s2xm(o nu4opeelfeias  Dum(m ;t4aptomo3iyt m2rlums;u0tetoxf iodfmDeauei t trto(o3oo1ole lnct s)aDuaxm nt0opt ifetls s ulu p;()arxoir tydlp  au o t trxrxr io1olenmfctat) Durump;t1aexnif3iyd s uau p;t4aexoio3iadomte i ol()trtmir3no4lltelnctat) rur( oou4tltn f3tytfm uluvp;u)aetrmr iytlpDraieils0srxm(o io4ome livtlt sDrr( ont0olt mfeiatfm2rlnvo;u)tlenxoctotfm rlivi (0trurxo ny4lm emfvia()srtm(rpnu1teenmfeiydlaDuluvs;() ltnxo3oytomtrli sl()sruo(rpio1alt mnesasfsrra(rpot4optoifeiyt m2ran snu0 rtoxr todomDe ivsl()t2urxr nydlpt  nvilt)s2ra(m ot1olto f3tld s2uluvsnu)aeerxf3iy1lpteliesls0texrir3io4amtemieiat srur(moot0tltnifetadls ranmo;u4 rtoio oo1opteli o;s sexrxr ou1omee nvia(  rumu  ;t1tpx io3tls aDrlnvo t)aexnxf3iytfm rli s ()trxmimpno4oltemnvs tfsDuax o;o0tltn o3iytlsDumu s;u4 ltoir tydomtrai s (0t2uoxm3ou4omt  ivtas)s2um( o;t0oee mf3ils mDrmu pnu0 exomf tatoaD an sls)t2umir oo4ap emfcilt)sDrmuro;u0oetoii3iytla2rmnmp;t0arerxr3oy1opDeauei;t srxmxrpno4om nlivt ( aDta(m nt4apt moetyd sDemump;(4 eeoxr3iodlpDe i ils0 2xrxm nu1om n fvi s) rtmuroot0tpxo ociyd s2elump;(0 eenxf3iydfa  aueils)srxmxm no1llt  nvtat sDrm(rpnu4tex mi3tlslm eln p;()aeermf todlpte i o s trxrio oudlpen ieilsfarraum ;o0tlt ioetlslmDul( p u) exoxr iadoa eln i t)trtrxo3ny4aptn fcsa() rrau  ou1aeto o3iyslaDeanmo;(0 rtomocio1fmDrauvo (0teumxr no1optn icia(fsDur(  no1tpenii3iaslaDea(ms;u0 exnmo3iydlmtrluvs ()srtr(m io4ol e nesa() rtruro;o1oleomo3tasfm2uln p;t0teenxfciytoaD  nvolt) rxoxm3io4optnmicsls)artmumpou0openmictys a2ea(ms;t) etniocia1fptranvo;t)setm(o iy4aptnlnvsat) rum(ro;t1tpx iiciytls umump t4 ltnxfcio1lpDrli o ( s2xmiopoy1op   netlt s2umump;u1oetnii3iatfa2ra(ms;t)aeeomo3tatom e n s;()seurxmpou1ap nmnvilsfa2tax  ;t4altoii3tasfa2eanvp (0 exrxfcoadfm  ln s;t) rtoxm ny1aptnmnvtltfa2taumpno1aeeoii3iytfm2rmn o (0 leoxo3oydom eau i;s0s2tmirpno1op emfeiat  rrru  ;u0oex  fcias m2uanms t0tlerioctydomDranesls0 rxrxr io4opee iesas  2uaurpou1aexomo3tlslmDrau s u4aexnmf totlpD  n o;( texmxo3iodaleelfvsasfsrurum nu1oetn o3tydfm rlumpn()tlxrmrctotom eln o t)srtrio oodoltemfesatfa2rm(ro;t0tetoiociat sDul( s u)arxnmf3iydlaDrli olt0t2tr(opiy1aptelfei (fsrtmxr nu1oexnmiciydfm2rmnms;t)alxoif ia1fmtraneols srxmxm3no1ll   feslsf 2tm(mont1apx iieildlaDum(vsnt0altoxr3iydfaDe u ils)setrim nodameemivsl( artm(mo;u1tltoiociltlm2ua(mont)tleoxr3oatlp r iesl(0trxmxo io4ap nlfci sf Dta(mpno4teeoii3tas s umuvon(4aexomo3tytlpDelues t0setmxopou4am   ictls a2trumpoo1ape mo3tasfa2umn s;u4areoxf3ootlpteaivilt srxrim3iu1lm  mnetls)aDumx oot4oee  oeiytlm umu snt4alxoxo3todfmDeau i t)s2tmxo no4ale mivsas sruaurooo4alxn o3iadla2emumon()artrmf3oodlmteaieol( t2xrxr ou4lmee fvs sfartrurpnt1oeeomictas s2em(mo;u)artoir ta1oateauvo t0 rum(r3oodamtemfesls s2uaumooo1olxoifetls a rlnmp;t0 exnxo3ia1fmDe ues s0trxrim io4amt mivtltfa2tmxrpnu0tpt iocilt s2el(ms;t0 lxrmf3ootoatelneols0seumio3ny1lmtnmieia(f Drrurp;o0ope  fciltlsDeluvs;(0aeeomr3tatlmDeanvi;(  2uoxr iu1lleelfcilsfs2rmxronu4apt io3tldfa2em( onu0 lxoifciadfpDrlnvol(0s2tm(mpno1lmtemict (fa2uaxrpnt1oet ioeiys s2uau s u0arenir iatfmtr i il(0 ruriopiu4ap emiesasfsrtrum ou4oltnio3tysfs eanvp;u0 ltnxf3ty1fmDraiei t)s2xo(o3iy1apeelieil( aDumum oo1opxo f3tatfm eau ont)tetoxrcoydfat  ueo s)srurxo iu1lmtelneils) 2rau onu1tee  f3tytfm rlnmo u4artrmrctatlmt lueo;t0 exoimpio1ameelfct s)s2taumpou4tpx ifetltfs ua(mon(4artomoctadlat  nvo ( srxm(r3nu4ll elicta( srtrur nt0aleo i3iytlaDrmnvs;() ltnxoctatoat luvs;s0s2um(o3io4altn feilsfs2ta(mpot4tpx mo3iad s uluvs;t0tltoifcoadfaDe n ol( t2umio3ny4alen ies s s2umx p;o4teeomicild m ul(vs (4alerir oy1fp elnes;(0srumxr3nudlme lnctl( sDtmum no4alt moeiysls uluvp;t0trxnmoctatlptranes t0t2urirpny4llee nvslsfa2rrxr nt0ape mo3ildfm el(vo;t4alxrmo3tydoa  lu ils0s2urxo nydap  lfvs (fsrtm( ooo0tle moetyslm el(vp t4tleomo tytop e iesls t2tm(rpoudlltnlfcsa(  rtaxront1oet mi3iysla ea(vonu)aetoxr oatlaDrau i;(0s2trxr iydlme  iesat s2um(ro;o1tpt  f3ilsla emnmp;u4 exrmo oatfm eanvi ( trtoxm nudll  mnviasfsrtaxrpoo1opt  fcils s ua(vp t4 etrio3iadlm  liesl( setoim iydalt  ncia( s2um(m nt4alxoii3ilslaDel(ms;(4arerio iodlmD  ieo;() rtr(m3no4lm n nviat  Drm(m ;o4tlen fetat mDeanmp (4 reoiocoatfpteauei;t  2toxm nydamen fvtl(fsDuauro;t1aex  o3iatlm2rmumsnu)teerio iadomtr n ils truoio3no1al elnvia( sDrau o;o4tpeo oeildls rau p (4alenmfcoy1fpt  nvs t  rxrxr nudamt  neia( aDtm(  ;u0oetnmi3ilsfsDrln o;(4aexrmrcio1op ran s;s0 rxmxr3nydalee ivia( srumxmp;t0tpxo icilsfa2rmumo t)aexrmr3oadla e nvs;( sexoim3ou1aleemieiat srumxronu0oetnmf3iysfm2ea(vs (0trermo3io1fmD ai slt0s2ur(o ny1olen iesat a2tmxmp;o1alto oeiys m2eln pnt0 etomociydoaDelu o;t trtrxopio4lp nlnvsasfartrumpnt0oex iietldfa2rm(mpnt0 ltrif tytla  lieo;t0 exmiopoudapte ieil() 2tr(  ;t1oexomfciatfa2rmnvo u0teermf iatomt  nvilt)srxm(o ny4openmfvi tfaDra(mp;u0oeeomf3tyt a2uau pn(0teenir totoa eliei;(0tetrir oodal  mfet t)a2rr(rpot4oexomicils a2eaumpnt)artnir tydomD  uvo t trxrxopnu4lp nlnvtltfartrxmo;o4aexomfcilt aDumnmo u0teeoircty1op rln ils0 eumir3iy1al nlfes ( aDtaxro;t1oeeo ieiadls ra( p;u0trxoxo oytfm  luvs ( seuoio3oo1alte fei t)sDtrum oo1tlto feilsla2umnvs;t0 etomfciadfmD  neo;(  euoxo no4amen nes t) 2umx  ot0aee mociasfa2rln on(0alenio tadomte n o s srum(m3ny4omenmici tf rurumont4alenioeiyd m2ra(msnt0aeerio tadomte uvilt)trxr(mpio1omtelivt ( aDrrxmooo4alxomieiyd m2ra(ms t) lenmf tytfp r iei s trxm(r3io1ap nmfei sfs2tmuroot1oeeomf3iytla2rln pn(0texoif iydom  aivs;t0texmio oodoptn nvi (fsrtaur nt4oeeo ieiltls2umu p (4tlenmrctotom r nvi t) etrxrpoy4lmtnlivtatfsrta(mpno4aeeniieias sDrlu s;u4aeeomrcta1opDr ues;s0trurim3ny1al e nvsltfarra( pno1tlxoii3iasla2um(vpnu4altoifcoy1om r i i ( sexr(o3oo4lptnliviatfsDtrxmpou4teenmieiltfs2eanmpnu4 etnif3iy1laDr nvi s0srtoimpno4ol elfcsl(f Dumu o;t0aptnmi3iatfmDul( pnt0alermr3ootoaDran o;()sexoxopiu1lp  lfei s) rrmxmo;u4aetomi3tytls elums;t4 ltoxfcoytlpDr ivs;t seuoirpoodopen ncslt srumx  ;o1oee iieias s ea(vp t0trxomr3io1fmtrlnvi;t0sexrxm3no1lleemnvsls s2uau onu1tpto f3iad sDemuvonu4trxnir tadlmtraueil(  exo(o3no4optnmiciat)a2rr(m ot0oexnmf3ildfm emums t)altrmo3iotop rau ol( t2tm(m oo4lpeemfetat)arra(m oo4tlx moetatfs2em(ms;t)artnir3iodlaDrlues t)sexoxo ny1ol e ics t  Dum( o;o4alxnmfctatla elump u0 rxnxrcoatfpt  neilt0 rxrir3oudame  ieias  2tmxroot0alxomo3iytla2rmuvonu4trtomoctatfa eauvo;s trxrim oo1amenmfciasfsDraur ou0tetnifeiysfa2eaumo t0 leoifctydoaD  n s s0 2trxr iudamtnmfcta()a2tm(moot1apenifcilt aDuln pn(0 ltnmfctadfa  li s ()trtrxm3oy1olt lfctls)s2raxm ou4tee  ieils a ranvp;u) lermrcoo1fmD anvi;t) 2umxm oy4open ietatf rrax oot1openiictytlm eaums (0 eenmr iadlpD auvi ( s2xo(opoy4op  mncias aDum(r ;u4optniieiyt a2ranvp;u0 lenxf iadoaD au ils  2trio3nu1om   ivi (f Dta(root0alx mieiad s2ea(vs;(4alxomf oo1fpt aieo;s0 rtoxm oy1omt  ivs (f 2trur ;u1tlt mi3iys a2um(vs;(0alenio3io1lmDe uvolt0 exo(rpno4omt lnci tfs2urxroot0aetnif3iys sDemnmp (0trtomfciatlmte i ils trtmir iudalt  ieiatfs2ua(rpoo4aetnmoeiltfmDulu s;u)aexoir iadfa elivi (0 euoxrpio4omeelnvsltfsrumxmpnu4oeenmoeiys a uanmo u4 lenxfciatlmDrauvi;t srumxo3nydolt  nvtls)sDurumpou4opeoifeiltfa2rmnvp;()trenir3oodfm  lnvo s0setmxr3iu4ope lneil(fs2rauroot4aeeo f3iat s2rmnvp u0trxoxr oydfpD ln i t0s2trxm oydapt  nei () rur(  nu1tpxomfciatfs2rmu snt0tlxoif3oy1om  ln s s trtr(m iudam elfvslt s2um( oot1altoifcils aDeluvo u4 etomf ia1omt  ivolt trum(rpno1llt mnci (farra(r nu1opx ioeiatfs el(vont) rerio3iotlpDelues s0 etrirpio4optnlieils aDrmum ;u0alx mfcilt aDea( p u) ltrio totfaDeauesl( setoio3nudlm nmfcil() rtaxm ;u0alx  ietyt sDea( p (4trenio tatfaDe u s s  2xmirpnodole  nvil() Dtm(r nu0ope moeias s emnvp;u4trxrif3tydfmteai sls0 exm(opno4oleelfvs s  rra(  ou4texn ocildfm emnms u)tlxoiocio1oaD ln s ( s2toimpnodol   neta()srraxmont1oetomoctysfa uau on(4tlenmrcoytoaD li s s teurxm nudlmt mfeia( aDumum ;t4ole  oeiasfs2uln o;t0aexomo iy1fm e nvs;s)sexoio ou4lm  lnet s  2uau poo4texn ocias m ua(vs t)texoiocta1la eaues t0sruoim nu4altnlics tfa2ta(r no1tet mfeilsls2emumon(0 rerir3oytfpD livo t  exrio3ny1ol   nctls) Duaxronu4ape iieiasfs ranmp (4teeomf3oadomt  ies;( t2xo(rpnodllen feta() ruru onu4optomoctatfs rmumsnt0trenxociytlm  aivol() eto(opio4llenlfct t sDurumono4tleoioetldfmDuau snt0aetrxo3iy1faDraueo s0 2toim3io1al   fcsa(fartau oou4opx moeiltlm2eaums;u0tleoir oy1lp eluvi;() 2tmir no4op emnesl( sDtrxm nt0apxnmfciatls rln o;() lermf ta1omDrluvol(0trxrxo oydlle lictasfartrumont1aptnio3iat aDel(vo;(4 rtoircta1opDe u s s)seumir ou4ame mivil( sDraur ou4olx mi3tydfm2em(mp;(0 etnmfctotfp eau olt  2to(r nu1ape  icslsfsDumxr no0teeomiciyd m eauvs (0artrxf3oatlate uvslt teurxr no1lpt lncs t)aDumumpnt4altn i3tyt m2uan pn()alxnxf3todfpDeli ols0sexr(r nydllenmiet ( arra(  no4tpenmieilt aDul(vo;u0 rermf todfmte n ols)s2uoirpiudom emfesat)srtmxroou1apeo ieildfs2eln p;u0 lenxf3iytomDeauvo;t0srxm(mpio4ll elfvi sfaruaxronu0teto oeilslm ua(mpnt0 exrxrctytom elnvo (0 ruoimpiodolen icsat)sDumurpou0optniociltlsDelnmont4 exnxocoodlp   ies ( setriopnu1om nlfcsls) rrmxm ;t0apxniociyt aDrln s u0 eeoxoctytoatelu s;s)texoxmpio4lme mfvsl()a2trxmo;u0oltn o3tlsls2rau o;(0 rtoio ta1omtranvi;t  2trxr nu4ap   ieta(fartr( poo1alxn f3iadfmDelnvs;() ltnio3oydopteaivi ( setrxrpiodlmt lfetasfarurumoot1opxoiociadfaDel(ms;t) eenio3oytlatelivi t) rxo(r no4op nlfeslt a2trumo;o4oleoif3iydfsDumumonu0tltnmo oy1fa r nvs;s0setoxm3nu4ame lnctl( a2umu  nu0olxo ociys s elumpn(0tlerio oydfpDeluvi;t0 etmxrpnodomtemiesa(  2ta(m oo4ope iieiltlsDra(vo;t0 renirctydfmtr ieo (  eumimpnu1opeemnctl( srrr(mooo0apxoifetysls ua( o t4 leomr to1oaDe ieolt texmir3iu1alenlncia( srrmx oou0aeeoioeiytlmDumnvs ()trenmrciy1fa  au i s)s2xmimpoy4opeelncsltfsDtr(  no4teeniietlsfa2ea( o;u4alenxo iadoa eaueo t0trtmimpiy1lltemicia(fartax  oo0tetniieiysls emnmo;(4tlerio3oo1lmte ivslt teto(r iy1lmen fctas)aDumuroou1tlx mfctld mDea(vpnt4teermf ootfa ean o;s setrxr3oydape  ivia()a2umxm ;o0apxniiciltla2elnvp;(4tleriocty1opDelnvs;t) 2xoxr3ny4ale mnetasfaDrm( onu0oexo octyd m2ranmp t) eenmr oydop  aivs;(0t2toxr iodlp  mnvsl() 2um( p;u1aexoifcils m rlu s;u0aleomr3ootlm r neil(0s2xmimpno1ameemictltfaDrrurpno4tleomfctysfa uaumsn(4aeerxf3oytlptraneils0 euo(rpnudopt  fvta()aDtaur nt4aex  ociydfs ua(ms;t4texnmf io1fmtrauvs ( truoxr3io4lptemivias) Drrurp;t1altoio3tld mDrln ont) etoxr ootlpDr nvo s seumim3iu4omen nviasf 2uru  ;o0apx iociadfa rm( o;u) rxoxfcoatfmD an il()texmxmpoudlpe mictas  rum(mont0tptnmf3iaslm um(ms (4trtomf oa1fm  au olt0t2um(opny1lmt  fesa(fa2taum nu0optomfctlslaDrm( p (0aleoif iydlm rli ol()teuoio nu4lp  mies ( arra( pnu0teeoifctadfa2rlu o;t)trxrmoctatoat  ueo t  rxr(r oudopee ncias) rtaxmp;o4tptn i3tld mDel( pn(0arxoxr tytlm rlneil()srum(mpnydamen fesas)sDuru pnu1oeeoiieiysls2el(vp;u)aeerxrctadlmteanvo t srxrio3oo1alenlivil( srrr( oou4tlt iictydlsDelu p t4 rtrxf tytfmtelieol(0 2toir oudlpe  feslsfs2rr( pot4texn i3tysfs2elums;u0aeeoif oatomD aueols0s2umxo ou4ll nlictat  Duau  oo4teenmictld mDuanmonu4 lxrioctadfpDraiesls0texrir iu4ame  iesas)artmurono4opeomi3iyd aDelu snt0 exnio3oodoptrluei ( s2uoio3io1lp n iet s) Dtr(r ;t1alenmocilsls2ea(vpn(0arxoxr ta1lm  auei ()t2xo(r iydlmeelnvil(  rtmxr oo4oeeo fciys aDelnms;(4 lxoifciotfaDeau o t)tetmir nydapte fes (f rtaumoou4aee ii3iad mDumuvsn() rermo3oa1fa  ai ils)s2tmxr3nu4optemnvsat)srtr(  oo4tltomiciydla rau o ()trxrmr3oy1fm rlieslt)t2toimpiodom elnctlt)sDrr( p;u4tptn iciys mDeanvs;t0artrmrciodfate nvs;s0seuo(r nu1amt mics s) rua(mpoo0tpx moetls s2emnmp (4 reomr io1lpDeau i;t teumio3io1lm  micia(f rrr(m oo0ape mo3iydfaDua(vs;(4tltnxfctadfpDrliei s trxrxo oo1al emiei tfarua(r no0tpen i3iadlm eanvsnt)tlxomocto1oat livo t0srtm(rpio4amtemict sfsrrmxrooo0oeeo ieiytfsDrm( on()texrmf3oy1optrlnvo;s0trxrir3nudlme lfvt t)sDrr(rooo1ape mfeiysfs uln o t)aeenxr3tydfmt  n ils0trtrim3oy1lpee nci s  ruru  nu1apto fetat s2el(vp;t0 ltrioctodop r i s s)t2urxmpiudale  ivils  ruaumo;u1apeoioctyt m emnmp (0 lenmrciatoaD livo;t) exr(o3iu1aptnlncils)sDurxmpno4olt mo3ilsfs2eanmon()aexnmfctotfm  aivo;s0t2xoir iy4llen nct ()artru  ot4olt mf3ils mDranmo u4 ltrif3oy1fmtrluvo ( s2trir3iydlp elfciat) 2uau pnu1opx  oetad sDem( p (4trtrio io1late n s;(0sexmxm oudap  mivs ( a2umxmp;o4openif3iyt s2ea( snu0tlenioctodfm  aieils0s2uoim oy1ole  ictatf Dtrx p;u0tetoifctydfmDranvs (4 exoif iytfatrln s;(0t2xoxopiydalt lneil(  Dtr(m oo4aetnmi3tas a elumsnt)arxnxr3iodoa  livo;t)setrim3ou4ap  mncsa( sDraum ou4optn i3tyt s2ra(mont)aetoxo to1fpteaivs t0trumxm oo4olt mnciasfs2rmuro;t1ope mo3tat sDeln snu4teeoxoctodop raneslt0s2uoxmpny4apteliesltfsDtaxro;t4teeomociltlaDeln o;u)tetomr io1latr nvs ()setmxrpiy1amt mnes sf 2uaurpot1tlxnmoetys m2ulumo;t) rermf3iadoaDeln i s) etriopio1optnmfvia()s2raxmpoo4tet  f3iysla rmn p;(4 rxnmr to1fmD  n s;(0 rto(mpoy1lpt lfvi t)sDtm( poo4opeoif3tlslaDeauvpnu0altoiocio1fpt aneil()t2um(opoodalenmnvs t  rtrum no4altnio3iasla ra(vsnt)aleomfcio1fpteaivs t)setmiopoo1op nlieils a2rax p;t1tpe  ociltlmDeauvs t0tlenmrcoy1fateli s s0srurxo3iu1lle  ivt t s2uru pno0aexoio3iadlsDeanvsn(4trtoir oydfpt aivs t0 rxr(rpnydap n iet s aDtru  nt1optnmfeiatlaDulnms;(4 rxnmo ia1fm ean o;s)t2xoxo oo1ameemiciat aDtr(  ;u4olxnmiciltlm uluvs;t) lxnmrciotlp   nei;( srxmxrpoy4lme licilsfaruaur nt1olen fciatfm2emn p u)alxomrctatlatelneol()t2tmxr3nydam nlivi tfaDuax  no1opto ieias a2ranms;() lenmf3ta1laD lnes s0t2uoxo oo1opt mivi tf Dua(r ;t1oetn i3iltla rlumpn(0 ltnif iydfptelu slt0 rxr(m io1al nlfvtl(  Dtrxr no4tleomi3tasfmDumu p;t0tlxrirciytlat  ivi t) 2trir3oo1openmivt t a2rmxmpno1tee mfeild s ea(vs;()altriocto1fmDelivols sexoirpnu1openlivtat) rtaum ;o1aeen fciasfa2rmnvp t4artnmfcoytlmD livilt0truoxr iu4apenmfvslt a2rr(m ou0aetnmieilslsDrauvp u4arxnmo oa1omt  nvols0t2ur(mpiudam elicia( s2tru  nu1opt ioeiadlm2rln sn(0teeomr iadop e n s s sexm(m3no1amenlnviat aDtmx p;o0tpt if3ild m eln ont4trxoio3tatopDr ivol(0t2um(m3iy1lpt mnvs (farumu  ;u0alt iociyd s uanvo ()aetoxrciatfptr neils0srxr(opnu4lpte fcsa()srrmxr no4aleoiietldlaDra( pnt) rxomf3iodomDe nvo;()t2tmio nodolt  fct ( aruaurpno1teeo fciadfmDrm( s t4texomf ootfmteaneo;t) exoxrpnu1optn ivt s)s2urxr nt4aexomieiad a eanmo (0 rtomf3iydoatrau sl()s2xrir iydllen ivtl()a2tmu  ;u4oleomietyt m ua(vs;t4 lxomfcoa1omDrau i;s0trxm(mpoudomt  ivi t aDtrx pnu0tpeoif3tasfaDumuvo u4 leoxr3todlaDr ivo t)setrxm3iu1lltnlictltfsDurxmoou0ope  feilt sDua(vpnt0 rtnio iy1oa eln i ()t2tm(m3oydlm emfvsat sDra(mont4apxoio3ild m um(vo;t)aetrif3iatoptelieol( trurxo3nodomtelfes s)srtmu pot1altoioetlt aDelums (4 rtoxrciy1lp r nes;()teuoim3no1lpe lfvtltfa2urxmp;o1alx mfciyt m2emn o t0artoioctytlmDrlnvo;t setoio oodllenlfvsasfartrur ;o0tlx  oeiad m um(msnt4trxnxocia1om  lnei;s0trxm(r io4omt  nvtls srtrx pot1opeoiiciysls2em( p u4 lxomf oodlateaues s tetr(r3nudlmenmicil( sDtr( onu4tpeoifcilt a ranmsn() rtrmfciydoa rai slt s2urir3nodlpee nei sfsrrax  nu0oetnifeiltlmDemnmo;t0tlxoircto1omtr neo (0 ruoxrpoydolt  ics t  rururo;o0altn f3iadfsDea( snt0trtnmf3iatoa eanvo t)trum(m3iu1olee fci s  rtaxro;o4olt  oeiytlsDua(monu4 rerif3iodfa rai i (0s2xoimpoudlptnlfcsls aDuru pot4apx io3iytlm2uluvo;t)tlxnioctytfatelu o t s2xr(r3oo4al nmivsl( sDtr( pnu1alen ieils s2elumo u)tetniocoytfpteaueo s)srtr(rpnu1omtemieslsfsrrm(moou0apxo o3tys sDrmuvs u)aetomr ta1fm  anei;() rxmiopoy4lle lnei t) ruaum ou0oetomf3iys a rlnvpn(4 leoxrciydlpD au sls)seuoir ou4omt  nci () 2rm(r ;o1tptniietlt m umuvsnu)trtoxo3oy1fatraneilt0s2xmxo oodllen ncsa(fsrrm(m ou4opeoifciltfm2emnmo u4texrifciotopDr nei;()sexo(m3iu4lm e ncsa() Dtmx poo1texoif3iatlaDeau o;t)trtrxr3oo1faDe uesls)seurxm iy4ope lnvtlsfsDrrxr ot0aeen i3iad a emump (0artoio3iadoatelnvil( teumxm nydope  ics sf Drru ont4aexoioctldfs uaump;t) ltrir3ty1faDr u o t0s2tr(o iodam  mfvil(f Dur(m ou0aleo fctyd a rau o u)tleomo iatlmte neo;t  eur(rpnydol elnctat srtru o;o1ape miciadfs2eau o u4trxrmr oydlate i s;t0 2xr(o3iudameelfvtas  2raxm ;o1tpxnmociatfa rlnvpn(4trtrif ia1oaDr uvolt)sexmio3nu4lltemivt ()a2urxmooo0aptomoeiasfa umuvonu)arxomfcootfaDraneilt t2xrxo3nu4opt liviat)aDtrumpnt4oeeo o3ilslm2ra(mp ()trtrxf3iy1fptr uvil( trtrxm3nu4op elnvtls arum(m no1optoioeiyd aDrl( s;()trerxo3tatom  lnvi s)tetm(opiu4lmt mnes s a2rm(r nt1tpe  fciydfm2rl(ms (0 exomfcoadfmtraueilt0seum(r3ny4lm  lnctlsfsrrm( onu1tle mietltlaDrl(vp u0 rxnmr oytlaDrauvo;t t2uo(o3iy1aptelnvs s)s2tm(r ot4tex ifeiad m um( o ()trxomr3ta1lmt an ol( trurio iy1al emiesatf 2tmxr no4olx mo3tldfa2em( onu4teenmr tadlmtraiei;t0 rxr(o3ou1opt lnciasfarum(m ot1tltnioctat m em(vo ()trxrmr3oydlmDe uei;s0teumxo iy1om emncta( artru ooo1olxoif3iadlm2rlu onu4trtrio oytfp  luei;t) 2triopiy4opeemivs s aDraxmp;u4tpxoii3tltfaDua(mo;(0 etoxr3tytopt lueo;t0srtoxmpiodlm n ici s sDuaxm nt1olxn ociysfaDrmn onu0alxnmr3ta1lmDraivi;(0setr(o iudlpee fviatfa2ra(  nu0oex miciaslmDum( s u0tetriocoa1fmD  i o s srtr(r ou1alte ieia( a2rru ont4tpxniietlslaDua(vs t)alenmo ta1oa elnvs ( s2tmiopoodamtnmfetat a2tmum no4tlen fetytfm2ul(msnt4aexrmr3io1fpt lnvs;s  2xrxm3oo1op emfesat arraurono4aeenmfetadlm rl(mo u0tltrxf3oo1fptelneo;t0srtmxo oudamt mictltfs2raump;t0oetomieilsfmDrm( p (0 rxnifciytfp e ies;(0 2trir3ou4op n nvs (f Drmxroou1opxn iciadfm2ulumo (4aetoif todfp r ueols0t2tm(rpou1ole lnvils  Dua( p;t4tex miciadls rmu p t4teenxr oo1lp r i s;t0trtrxr3iy4alte nci s) 2rmur ;t0aet mi3tydfs uanmon(4 lermo ta1opD livi;s0srtr(rpno4omtnmfvsl(f 2taxr ;u1ape iicils sDum(vonu4 lxrmoctatoatr ivo;s0 etoxo3ou1lm nmicsa( sDtm(mont4oee ioctasfa ulnvs u0areoxo oytfp elues t0 rxr(o3ou1oltemieiat  Drmumpnu4tetoiietysfa2ran pnu0 ltoxo oo1omDranvolt)s2umiopoo4lptn feiatfa2ra(mooo4oltn ieilslm elnmpnu)tlxnifciodomDelnes;( trtoxm3ny4am emnvi t sDur(r ot0oltnifeiyslmDranvo;u)aetrir iotoa   u slt0setmimpno1olenlnvia( s2tmuro;o0tet mocildlaDumu ont)aeerxr3totlp ran sl(0 2tm(rpiu1lmenliei ( aDumurpoo0tpe mo3iadlm2rl( s;t)aetrmo3tytlpDe n i s)sexoxr oo1opeemfvta(farurxrooo4tltniietad m2ul( pn(4 renmf iatop e u o;() 2toio no1oltnmnvsa(f rururp;o1opt iictat s2rm( pnu) exnmo3iatomD  uvs (0teum(rpoudap n icils)srrax pnt1tptnmiciysfa2uaump (0aeeomoctodlpD lnvi;s)trtrio3no1al nmicsls)a2tmxront0apxn o3iyd a2em(vs;t0texoxocoadlmt  uvil()s2um(opoydol e iesltfs2umx o;u1oet mfciadfa eauvs;(4artoioctadopt lues;s) etr(r3iu1aleemicta()artaum ot4tpeo ictlt s rm(ms u)arerxociydfaDrlnvsl( texrim iu1omeemfvsl()aDrrxm nu1olxomoctltfa uan s t4tlxoio3tydoaDeaieols0 exmxmpoy4ap e nvia(  rtmxm ou1olt io3tlsfmDemn snt) rxnif iydfa r u o;( texmio3oy4om elfvtat a2tmxmooo1aexomoeiyt m ra(vsn(4 lenmociotop  livo;t0texr(r3nudlpte ictls)aDua(root0alxomicilsfs emuvp (0arxrif io1op r iei s0t2xm(rpiudopeelfvslsfaDuaxm oo4ale iieils aDeluvo;t) ltrmo ty1fm   nei;s) exm(o ou4ll e ncs t)arrrxront0oltnmietasla rmnvs;u)aetoiocoatfpD aies;() euo(o3iudapenmnvi tfsrtrxrono4oeeoii3iydfaDrau p;t4tlxrxfcoadlmtelnei s)sexoxmpoo1ole mnetatfaDtaxm ;t0tpx mociydfaDean s (0arxnio oo1oat  uvs ()setm(o nydapenmfct s)sDrau o;o4tlxo f3tls s um(mo t)arxomoctytoaDeliesl()s2trio3oydapt  ivil(f rraxmoou1olto fctldfsDean s ()artnxr todlm  aivi s0srxr(o3oo4om emicia()artr( pou0tetomoetadfaDumumsnt4 renxoctadfp rln olt) 2uoim oo1omtn fctl()s2ua(mp;t4aexomieiyt s2rmn o u)artnmf3tatfaDe uei s0 exmirpou1ll elieta(f rumxr ot0tpenif3ildlaDulumonu4treoxf oadfptrli ol()trxm(o3oodom  mietltfaDuaxrp;o1tle moeias a umn onu4artnmfctatlatraueo;() 2uoirpnu1ape lfcsatfa2ur(moot1tpen o3iydls2rl(vsnu4 exomo3totlat luvo ()s2xr(r nodame  ics t sDrru ooo0alt ifciys s2emums (0aleoif iytfp  lueol()srumxm3ny1altemnvtl( a2umu  ot0aptn o3ildfsDrl(von() ltnif oadfaDrlieo;s0 rxoxr3nudam  mivtl(fsrrm(r nt0opxnmfetasfm ul(mo;(4 etomfciydlp e ueo t  ruoxmpnu1lpe mnvtls s2tm( ooo4aeeo f3tldfm ua( o;t4alxrxr ootlpte u olt s2xrxo3ny1ameemnei s)srtm(rpot4aleomiciadfm2ul(von()tltrir3oytfp rluei;(0setrir nodamt mfvsa( aDuaurpno4aetnmo3tytfa2ulnvont) renir3ootfm  aneo;(0s2toimpoy4lmeemfcsls srrr( pnt0alx mfetld s elu o ()areoir tatlpD  uvs;( s2umxr iu1altnlictatfsDtrum ;t1tle moetysfm2rm(mp ()teerxrciytlpDr neol() ruoxopoy1ol   iciatfs2urx poo4tee  fctltfa2el(ms;u0trxrxr3ia1faD aneols0tetrxo ou1op   nctasfs2rmurpoo4apx ioeiyd a2rmuvon(4altnxo3tydlpD aues;( srurir ny4opt lnvils) 2rr(mp;u4apenmfeiasfa eanms;(0teeoxfctadlmteaivsls seuoxmpnu1om n ivsasf Drm( o;u1opt iietatls2elnmpnu4tetoif3oydfpDeauvs;t0texrxm3nydap n fvsas srtrumpno0tlto fetasfs raumonu) lenxr3ty1fpt aiei;s  2trir3nu4oltn feslt)s2raxm ou0olxoii3iyt sDrm(vp (0arxnxrcto1faDeaivo;s  2xmim3ou1lleelfesa(  ruru oot1texo ociydlm eluvpnt4artrxo3ta1om eaieols0 rto(mpoodome lnes tfs2rrx  ;t1tlxn o3iydfm2ra( snt0aexnmf oatfpteaieo ()srumxm3ou1ap  mnvi (fsrtrur ou1aexniiciyd m ul(vs (4 lxnmo ty1oa ran sls  rurir iy4ome mncia( sDra(ronu1apenioetysfaDemnvo;t)trtnxf3oadfmt luvil()t2xmiopiy4aleemncil()a2rmxm nu0optoioeiytfa2ulnms;(0arxrifcoadfa   uvi ()seurxo3io4amtn ivs t)srraum ;t4tlx io3tasfa rl(vsnu)tleoxo todopDelneil( t2ur(o no1oltnlivs () 2rm(m no4olxoioctatls2umnmp;u) ltoif3io1oa r uei s  rtriopio1lpe  ieias)srtmur nt0teeniieiydlsDrluvs t4tetoxr tadoaDelivi;s teuoio oydopenmnesa() 2tr(rono0aexnmiciyd mDuaumo (4arxrif oadfatelivs;s0setmir iu1alt licsls aDtaxmont4oltoiiciasla2elumon(0 rxomf3ty1fm elnvo;t0seurim nu1lm elfvtatf 2uaumpno0aeeoif3tadlaDumums t) rtrxrcoatlatraneo s0seum(o iudom emnvsltfs2rm(r ;o4texo fctlslm umumo t)altrmrcoadoat  neslt)trxm(r3iu1amtn neilt) rtrx p;t1tlt ifeilsla ea( p (0alxrio3totfmteai o;()s2tmir3ou1alenmnvsl(fa2urxm ;o4oee mociyd sDumuvp;u0trxnif iadomD aieo;t) 2tmxo iydap nliesl(  2tr(r ;t4apx moeiatfa2eau p u0 lxnmr3iodfa rau o;t  2xrxr3oy4om n fvia()a2ra(ro;u1aexnmocildfm2eln sn()trxoio ty1fmD ai i s teurir3nu4lmtnmivtas)sDtr(  oo1tleomi3tlt aDea(vpnu0alxnircoa1omD auvs ( t2trirpoydllt miei () 2rmxro;u4tpxoio3tytls2ranmsn(0aetnio3oodfatean o;s0t2urxm3io4lmt  fvs t) Drmxmoou0opxoifciad s2uan p;u)arenirciotoa r nvi;s  2tm(r nodlmtelivia()aDum(  ;t4texnifctldfs2rm(von()trtrmr3iy1lmteai i;t0 2xmxrpoo1ol e ict ( a2tm(r ot4alxo f3tyt s umnms u) etnio iy1omte ies;(0s2urirpiy4altnmiesas) Draxrp;u0tet mieiad s eluvpnt4altrmfcoodomDrluvol(0teum(r iy4lp elietl( srrax  nt4olx  f3iasfa em(mo;t0texnmf3iytfpt anvi;()trxm(mpoo4op   iesa()a2uru pno4ole mi3tydla2ulnmo u4treoxo3iydoa  livo (0 exoxrpnodlm  lfctasfarumxmpno4oetn ietytfmDuanvpn() exnmr3iy1fm eli i;(0t2ur(rpoy1omtelfcslt  Drmum oo1oexomi3tatfmDrmnms (4 renxrcoa1opD  u sl(0t2tmxmpou4lltelici t) 2ua(m no0oex ii3iyt mDrmu p;t0aeenxo totomtr ueil() euoxr3nu4opeemfei tfsrrrump;o1aptnmociytfsDelums;t) lxnio oo1lp rau s t) exoxm3iy1ll emfci t) Dur(rpnt0oeto o3tad m ea( snu4 ltnifctadoat  nesl(0 2xoiopno4opeemnvt sfa2ur(r ;o1aet  feiltla2ua(mo;u0alenif tydfmDe i slt0s2xrxrpnu1olt lies t)s2tmu o;o1apx  octadfa eluvp u) rtnmr ootlmDrli s;s0seumir3oy4alee nvsls srraxrpnt4oltoiietlsls ranvo;(0trtrxr tytoaDe ieolt) 2tm(o no1amee fvi t) rtm( ont4oeeniietadlaDrluvont4 leomo3io1fm rlnvi ( trumim iodlleemicsa( artrxmooo1oeeo octasfm umnmsn(4altnmr iadfmteaneolt0s2to(r3io1optnmivils) Dtaum ;o1openmictyd s2rln onu) rtrir tatla r nesls  2urxrpnudlmee iesls a2umu ont4altoif3ildfs2rmu pnu4 lxrxo ta1faD anvilt0srxm(mpou4om e ivtl(farrmxmpou1tleo i3iydfm rlnvo;()aetomrctodlp rai ol()seur(rpoudlpeemfesl()sDumumpou4opxnioeiydfs uanmpnt)areoxr3oy1lpDr nei (  2um(rpno4lp   ics s  rumxronu0tlt  i3ildlm eln s t4texrmf iatoaDrln slt)setrimpny1aptelncsl(fs2taumonu1teenmo3tatlm2uaumon(0texrxf3oodlpt au il(0tetoir3oodlpen nci t)s2umxm nt0oex ifctat m2rl(msnt4aexoio3iytfm elivs s0srxr(opno4optn icsasf Dtmu p;o0tpx mocild s2el(vsnu0treoirctodla r n ils0s2triopou4lle livtat) Drru pot0aleomietldfsDeanmo u4tlenmf oadopDrlnes t)truo(m no4lmt lfcil( s2tmu pot1oltnmfeiatls2rauvsn(0tlxrxo oa1fmDeli i;s  rurxrpoy4ll n ici (faDrmxrpnu0alenioeilt sDran s ()trtnmocto1fmDrlu i;s t2tmxopiydalt  ies sf 2rrxr no4ale  o3tyslm2emnvs ()texnif oo1opt  u slt)t2to(rpio4ome mfvs t)a2tr( o;t1altomf3iytlm2ua( p;t)alxnio iytfptelivol() eurxm3iy4om nlncs s arra(m oo4tltnmo3iysfs2um(vo;t)trerxr iadopD  i s;t  2trxo3nodamee fesasfa2ra(rono4opx micildfmDelnvs ()texrmfcty1fate uvs (  2uoxr3ou1opte nvtlt sDrruront0opxn ociadla2ulnvp (0altoifcoytopt  ivsls0tetm(opoo1ap elfeil( sDrmu  ;o4tpeoiietat aDuanvo;t0aetrmr3oodfptrai s t  exoim3oodlptelivtas  2raumono4alt mo3iytfs umn o t)tlerxociydfmDeai i (0trurir3iodomt mnvilt arurump;u1aet micilsfa2emn snt)tlermf3oatlptelu ils0t2xoio3io4apt mnvsa( srrrx pnt4tet  o3iasla raumo t4areomf3iodomtrauesls0 rxriopnudalt lnvs sf 2trump;o0alxnmfeildfmDuln snu)trenxrcoa1oa r i il(0seur(r nu1omtnlfvtat)a2raxr ;t4aptomoeiyslmDra(vs u4alenmf3oydfpDran i;t  2trirpny4amte nvias  Drm(rono1olxn i3tlt sDranvp;t0 renxf3iadom  lieo;t  rxmimpnydlpee ivi tfs2ururooo1oeeo ietytlsDraumpnt4alenio3iydom r i ilt0 eto(rpiudal elics s)a2um(rpnu0alxn i3tatls eauvp;u) renmo3oy1lmt  ueo;t0srum(o3oo4op n ncsa( aDum(  ot1tpeoiiciltfsDuanvo;t0 exnir oa1faDeai i s) exoir iu4al nmfcs tf 2trurpou0olxo f3iadlaDrl(ms;t)trxnmf totfmtr i olt  rxrir iu4lmenmici s srururpot4apt iiciadlm rlump u4 rtoir3oy1fpt au s s)srtrxopoudlp emnvtltf Dta(mpot1tlxoiietatlsDrm(vo;()tlxoxo3ty1la elu ols)s2xmxo iodole mfviat) 2tm(rooo4tlxn ietyd a uau o t)tlxrxr oadfpt an i (0 rxoirpio1om n ictl() rum(r ;u4alt mfctas sDulnvon(4tlermf3oadoatr nvs;s) etrim3nu1om  mfei t  Dur( ont0oeenio3iytfaDumuvonu0alxnxrciodfmD ln ol( teumxmpoo1oltnlict t) 2uaumoot4aeenifeiasfa ea( s u)altoircoo1opD  nes;t0trtoxr3iy4lp nliet ()sDraumo;t4opt mieiltfa2rmnmont)aeenir3to1fp   nvs;t s2umirpiydllen fctl() rrau  ot0tpeomieiyslm2rlnvsn(4 lxnmo iatoaDrlneils0t2tm(m3ny1omtemnci () 2rr(root1aet  o3iytls eanmo (4tltnmr io1lmD aies;s srtr(opoy4olte ncsasfsDur(monu1teeo feiltlsDelums;u0arxnio3iydoaDr ivs t0srtoimpny4olenmneslt)aDtax  ot0tee ioeiad a2rauvo t)altrif3todop  anvi s0srxmirpiy4omenmnvilsf Drm(rpno4alto octlsfmDea( o;u0arxnircoa1opteau i;(0tetoimpnydamtemivsa( aDtaumoou1ale io3iytla2em( pn()teeoircoydfaDr ivi;t)srxo(o nodap nmfci s s2uaumooo1ope ifciatfs ran p;()artnxo oadfa  luvi s0truoxo3ny1opte ncslsf 2ua(  nt1opeo ieiytfsDelnmo;()teeomo3oa1lpteluvo s)trtoimpnodlptn netasfsrua(r ;u1oet  fcils aDrm(vp (0tleoif3ta1fp eaueo;s srtmir ny1ope mncsasf rtrxronu1opeoifetysla elnmp;t0 ltnif oodfmD  ivsl(0 2xm(opio4op elfet s)arurxmpnt1apxn iciysls2ranvon()aetrir tatfmDr u i;s0s2tm(r3oydape mncs ( srrmu  ;u4ope mociytlm2ranmp (0aexnmr3oadomtraivs;s0t2xmimpno1apen net t a2rm(mo;u1alx  iciltlm ul(mo u4 lenxf iydoa  luvslt0 rxoxr oo1lme lncta(f Dumum ;t0tlx  i3iyd s elnmpnt4 rxomrcoadfpteau s;t0trtoim nudlmtn fci () 2uax onu4apx ifeild a uanvp;u)alerxr3oo1fmte ivo;s  rxrxm iu1olt  ieiat)s2rrum ;u1tlenmf3ilslm ea( p;(0trxoif3oatlaD  u o ( srxrxo3oo4apeelneslsf Dtrxmooo1tee if3tyslmDuau o;(0trtnir ootfmtrlieilt  rxo(rpnu4optemivsat)s2uaxrpnt4oexnmoetlsfsDea(mon(4arenmr ta1omteaivols0 2tmimpno1lpenlivtls aDrrx  ;o4aeto i3tysls2ra( on(0arerxr oodomtraueolt0seuo(m iudamtnmnvils) Dtruro;o1oltnioeild m emu s;u0 rxnif3todomD  ivolt tetrxr3oy4aptnmnvslt s2tmump;t0opeoioeiytla2raumpn(0tetrmfcoa1lmtrlnvol(  2xoim oo4apeelietls artmur ;t0oetnio3ildlaDumnms u)tetnmoctotlp raieils) 2tm(o oydlmtnmfvt sf 2raurpnu1oeeomocild a2uanmo;u0tlxrio3oytfpDe ues t) etmxo3nu4amen iciat s2taxroot1tptn ieiadlmDuau p t0trxnxrcoadoat lu ils t2uoir3io1apt lfvs t  rrau ooo0apeomo3tld s ulump t0 etnmfcoadfmtrluvilt0t2xrxo3oy4ame  nvsat  rurxm ot4tltnmo3iydlm2umnmpnt)trtomr iadfpD li i;t)sruoim3oy1alt mictltfsrtrxm ;u4aetoio3tltfs2eln on()aexrmo3todom  livi;s0 rtoxr nudlp n feiat  rtrxmono4apeomfeias s uln p t4trtnxfciy1oa raneols  2xmiopnydal nmnci t artr(mpno4altoio3tydfs el(vo;(0alxnif3oo1optrlnes s tetoxopno1apt lfvs s)srrmx onu1teeo ieiltfm2emnvp (0tltnmo tytlptrli i s0 rto(mpny4ol  mfeilsf ruaxrpno1tetoifeiaslsDrlu p t) rtrxfciy1faDraivs t t2xm(rpoydopt lnvsl(f Dumxmo;u1tlto octysfm2ulnms;(0teeoxf iatop eli o;t  2xrir3iodop n ietas) rrmxmpnu4olto oetytla uaump;t0alxrxf io1fmtrlivs (0 euoiopno4opeemfcsl() rra( o;o4tetn o3ils m2umnmpn(4trxrxrcoo1lm rlnvols)trtmxopoy4lmeemieiltfa2uaxr ;o0optn ociadfsDeanvp (4tlxrmr iotfa  lueo;(  eurim3nu1aptnlnvi ( sDta(ro;o0aeeniociatfaDea(vpn(0 ltrxo tatfpD lneo;(0 2umxo oy4ap nmfcsls a2raurpot1tlxoif3iysfmDuln p;()trxrir iytoa elnvo;s tetmxrpiu1omtn fei (fa2ur( ooo4apxnif3iltfm2rmnmon(0tetnmf iytlm rauvo t srtmio3nu4al elnei ()sDuaxmpou1tex moctysls2emu pn(4aetomf to1lpte u s;t0tetm(r io1omtnmieslt) rrm( pnt4aet io3iat a2ea(mo ()alxnircoy1fp eluvilt0 2xrxr iu1ll   ieils sDra(  oo0olxo i3iat sDel(vpn() reoxo oo1opDr ueo ( seuoimpio1ale lietlt s2raum nt0openiictys aDeanvo u0alxomf3oy1omDr n sls trxr(mpiodom elfesa(  Dumu ono1tpxoifeiasfaDelu p;t4tlxnircoadom raiei t texrir3iy1amte fct s) Dtrxmono0alen i3iatla eln o u4 reriociadlm rau s ( trxmxopiu4llt lfcsls) Duau ooo0oex  o3tasfs umu p;t) eenxr oa1latr i i t0 2uoxo3iudlpenmiei ( a2rau poo1aleo ociadlsDelu p t4tleomf tytoaDeau s s setm(m ou4altnlnvt t)s2urum ;u0tpeomociaslsDemnmpn(0tltrmr3oydlpD  uvo () etrirpno1lpe  fcia(fsrur( ono1tlenmfeiasla2ea(vpnu)trtrxf ta1oateai o t trxm(rpny4oleelictls  2uaxmo;o4olx  o3iytfs rl(mo;(0 rtnmf3oodomDr ivols) ruoir3no1al e iciatfs2tmum ot4oet io3iaslsDulnms u4texrif3oatlptrlu s;t0t2tm(r3nu1al elfvt s aDtm(mo;o0oltnmieiyslaDemump;u0 rxrirctodfpteai o;(0 rumio ny1amenlicsat) Drr(rpnu1olx  i3ildfs2elumo;t0 rtrif3oadlp   nei t  2tm(opou1ap elnetl(f 2ur(rooo1apxomo3iytfs2elu sn(4 renio3ia1opDe n i;t)srtoxo oo1ap nmnvi (  rtmurpnt1aleniociasla2ua(vs;u4trxoio iydlpt  uvils)t2trxr3oo4amtemnvta( srumxr ;u1oet iociytlm umumo t)artnmfcta1lmDranvi;()s2xoim ny4lmenmfcs s)arumx  nu4aptnii3iys a2umumo (0 rtoif iodoaDrluei;t)s2tmxmpnodll nlicslt a2umumpoo1tpe mf3iytfm eanmsn(4arxrmo tytoaDeaiei (0s2to(o ny4lpe liei (  Dtm( oou4oetn oeilsfs2rmu s;()tetnmfciadop e n s;t)truoxo no1opt  nvs (  rumx  ou0alx  ietadlsDuanmp;t) eermrctydlmteai s t0trur(r3no4ol   ncils a2rrx oot4teeoii3iysls rmn sn(4 ltrio iydlatraies;s sruoxm io1ale mnesl(  2umxmont1alxomf3tyslm2eau o u0arxnxfctydopDraivs ()t2trir nudop elnvi s) Drmxm nu4ape ioctldfa rluvp;t)alxoifciotlmDr nes;( sexm(o3no4lptnmfvsa(f Dumxmonu0tpx  ieiasfm eanvs;t0texriociodoaDe ueo;() etr(m io4aleemnvt ( artaur ;u1aptnmoeiyt m eln o t4teeoxo3oytlpDr nei t0teum(r io1lp emncils)aDtrx o;t0aptn ieilsfa el(vp t0trxrirctadlmtr ivilt)srxoimpiu1ame mneiltf Drmu  no0alt mfetydlm emnvo u4texoxo3tadop  ln o (0 rxoiopiu4ap eliesltf 2ua( pnu0optnmietaslaDum( pnt0 eenmocootlmtrli olt0 2xmxrpiydol  lfeiat)sruru ono4aee ioeiad a2elump t0 ltomf3oydoaDrlu o s0t2toim iodamte nei sf Dta( pot0ole mfeiasla rmn p (0tltoxr tadlp eaueo;(0s2xr(mpoy1om   feils) Drm( o;t4tptomiciadfs uanmont4tlerio ta1fpteaieo s srtmimpiodlme  ncsl(faDumuro;o1optomf3iytlsDemnms;(4trxnxf oydfat  u i;s) 2trxo ny4ol e ict t s2ta(rp;o0apt  o3iat m em(msnt) etnxr tadoa   neslt0seurimpou4om elnes ()s2raxmo;u0apxomfeild s ul( o;t0 eerxfcia1fp raues s) eur(rpnydol  mncs sfaDraum ;o4olt mociytfm ulu o;u4 rtoiocto1fa r uvils  etoxm3iudalt lfvsat a2urx ono1oleoiieias m2rluvsn()alermrcootfpDrlnvols sexo(rpny4ol  micilt s2rax pnu0tpxoiietlt aDulnmon(0texrxf iodomD au slt)t2urim3oy1op   nvs s) rtmuro;o4aexn f3tat aDrluvp u) etriocoo1fp r neo;t0 rtoir iydamt mietasfaDta(mo;o0alt io3ias s ra( snu0trtnxfcoodlate ieo;(0srtriopiu1amenlicias) 2um(ront1oeeomictydfaDem(ms;(0alerxf oatom eaies (0srumxo io1lptnmies s arua(root0aeenmo3tat s2rmumpn()arenio ia1opD  iei t trxmxo3nu1ame mfcsatfarraumo;o4alenmoeiatla2umums;t0aetomo iydopDraueo;s texm(opno4ap  lfcia(f rumxmont4alxn fcildlaDeanvo;u4tlxrmr ootlate i ilt  rurxo nu4amt mies ( s2rm(mp;u4tptoifciatfsDuan snt4trtrxf3tatlmtr neils0trxmiopiu4oleelnvi s sDuaxrpot4oeenmietyt s rm(vsnu4teeoxf io1lmDean ols0trtrirpno1lp  mfviasfartrum nt0opt ifctytfm2ranms u0 etoif oydla elu o s texrxrpnydap  mfetas)srtaum ot1aetnifctasls uluvp;u0 ltoxrcty1lmte ivo;s  exmxm iy4lp emivtlt)arurxront1apenmietlsfm eanvo (0 rxrmr iy1fa r nes;s) 2xr(o3nydap n fctlt  2uaxmp;o1oex  o3ildlsDrauvp t) reoxfciadlptelies;t) 2umir iydlptn netatfaDra(ro;t1texn feiysls2elnvs (0artnxo tytlp rauvslt)sruo(rpoudamen nvi tf Dtm(monu1alxn oetltlm2ra( o;u4tetoxfciadlpDeli sls) rxmim io4alen ictas a2tmxmo;u0tpe mi3iysfmDra(von(4 exomoctodomteaneo t  rxmir ny1amtnlieiat a2rm( pnt4apxomfctls a ua(ms t0alxrmf iotfa e uei ()sexmxmpny1amtnmicsatfaDrmum ;t1oeen feiatfmDea( p u4 renif ia1oatrlivi t setoxopoo4aptnmfci s)aDtrur nt1tpxnioeiyslmDuaump;(4 lxrmrcoo1omDr u s s)teto(rpnodlpe  fvias a2tm(mpoo4altniictldfa2emn o;(4trxnir iytlp  luvi t)teur(r3oy4ope mnct sf Dtm( p;u0olx  icils mDrmnms;()areoif3totoate uei s0t2tr(m iudopteliesat s2taurp;u4olx  i3ildfsDrlumo u)arenxr ia1fmD  iei s)srur(opnodll nmivt (  rraxr ;t0ope mo3iydla ulnmp;() rermrctydlptr nei s  euoxm3oo4llt mictltf Duau ono1ole  fcilt mDelnvpnu4arerxf3oo1lmD auesls0teumir3nodomtnlicsl(f Draxro;t1texnmiciatla2ul( onu4 renif3ta1laD ai o s)sexoxr3iudam   nciat)sDrr( p;t1apenifetat s2el( o;u0tltnxo3oy1oaDeauvol( srto(o ny1apenmfcs s  ruaur nt0opxnif3tat mDemuvo;u)altoioctytlpDraivo t0 2urir3oy1am elnetat)sruaumont1apxoiicilslsDua(vsn(4 exoio oydfmt  uvs (  rum(rpiudlm nlfvtlt) rtmu  nt4apto ictas a emnvp;u0treoxo3todfp rln s;t trxmxo3ou4altnmnetls artm(mpnu4tle  iciat sDea(vpn(4artrir3oadlpDe u s;s0 etoirpiu4lmenmict tf Drmxr nt0tetnmo3iatlaDra(vo t4altrif3todlp   ues;s seuo(o ou1apeelfviat)aDrau  nu0oexnifeias s2uan p t4tlxrir3iatlatrlnvs s0 rto(mpoydole  fvsas)aDrr(rpnu1tpenmi3ilsls2ea( s () rxomo tatfpt  i i t0 2uo(r3nu4om emivtatf Drrx p;o4tleomietyslaDelu s;t4alenif todlmDrluvolt0 rxo(m3iu4oleemfei ()aDua(mo;o4oex  i3iyslm elu p u0teerxf ty1fmDrlivilt)srxoir3oo4aleelfvsasfartru p;u0opeo ocildfm rmnvs;u)tltrxr3iadla r u o () 2umxo ny1lm elnci tf Dta(mp;u1opxnmfeiytla uan pnt4alxrmf totfaDe i ols  2xr(r ou1olt  ictlt  Dum( poo0opt  oeilt m2rmu s t) ltnxr oy1faD  nvs t)seumxo ou4lle lfvs s) rua(mo;u4oltn ocilt s rmnms t)trtnxfciatlaDeaueil(0setrxr3no1amenlivia(  2raum nt1tlx moeiytfsDrlnmp;t4 lxrxfctatopt  ueol()truoim oy1alen ivi s srurumpnu1alen oeiadlm2ua(vs u0trxoxfcty1fmt lneo;(  etrimpnudam elnvt sfs2raxm oo0texomoeilsfmDul(msnt0 rtomf iotfm r nvs;t  rtrim oo1ll e fctat)arrrxm ou1tlx  f3iltfm2ua(vs u0trerif tytfat  uvo t setmxm oodopee feiat) Dur(mpou0olt ifeilsla uaumo t0 ltnio iotlmD  nes ()tetmio iy4lmtnlictlsf rtr(ronu1tltniictysfs2el( on(0 exomf totfm raies ( sexrxm3oydalenlivta( srtmxmo;t4aptn i3ilsla2rln pn()tleoxf3oo1optrlieo t0t2xmxopno4al emnetatfsrumxr nu0oltoii3iyd m2ulumo;u)alxrmr totlaD luvils seurir iy4lltn ictlsfaDuru p;t4oetn icildlsDrl(ms ()tlxomf3ia1omD livils0texrim3iydomtnlnviatfsDra(rooo0aetnmf3ilsfm2el(vsnt0tlxrif3oodlmDr uvsls0s2ur(m3iodllenmfvsat)aDumu  ;t4oltnmieilt a2emnmp (4altnxf oatfp rluei;(0tetoxr nodlleelfcsasfa2tm(m oo0altoifetldls2rauvs;(0 eeomocoy1oa rau o s0t2xrir oo1optelncsa( arrm(mp;u4apto fctasfa umnvp (0aleoxf3io1lp e ieo t0t2um(r3oo1om n icils)aDtmxrpou0tetoiiciaslaDumnmpnu4trxrio3ty1oa rlnes;(0t2urxr3ny1lleemnctl(  Dtru onu4tpe io3iyt a2eau o ()aetomocoatoaDranvils t2xo(o3nu1omtn fct sf 2tr( ont4oltoifctlt s2umu p;()alenio iy1oatraieo;(  2tm(m3io1ap nmnvs () rrr(moou4olxoiieiad mDemu o;(4areoxf oytoaD  uvo (0t2urxm3iydlmt  feslt)srtaum nt4oex  fcilsfs ulnvp (4altnmocto1lp eanvs s)s2umio ou4aptemivsls) 2rmur ;u0texn fcildlm eluvp t0 rtomfciytlpD anvi;s)tetm(o3nodll n fcsat  rua(r no1tlxoiictltlmDrmnmsnt4arenmrcoa1om   n olt)trxmir3iydaleemics t  rtrum nu0olxo fetaslmDul(mp t)tlxnmo io1lmDr nvo;( t2to(o oudaltnmfeia()srurxm no4open f3iysfs2ran snt0 lenxr3tytfp   n s;s  ruo(m3iu4ameemnes s aDta(m ot0tpxn feiatfsDrlnvp;t)trxnir3todfmt ln o ( srurxmpny4am e fctltf rraxm no1oltomf3iyd a ulumo;(0tltrmf3totfm r n o;s) etmiopoudam nmfet tfarur( pno0texniieildfs emn o;u4 rtoio3ta1faD  uei;t0s2um(r3ny1llte ict tfsDrmxmp;u1apxnmiciltfmDulnvsnu0arxnio3iotlm  anvo;s  2trimpio4llt  fcsl( sDururpou4apxn i3tysfmDeanmo t0tlenmr3oy1fmteanvi s)s2urxr3no1lm  lfcsls)artrx poo1ale io3iysls emn s;t4tetoir tytlaDrlivs (0 2urirpiy1ll  mnvtat sDtrxr ;t4tpx if3tyt s elnvs;t)arxoxfcio1lpDraiesl( seumio iy4ol nmfvia( a2tmurp;o1olt mfeilsfaDul(vpnt0altnxoctadoaDe u sl(0teto(o nu1ope mfvt (  rra(rpou4tpxnioetatfs rmumon(4aetrif ta1fpD anvi;( s2xrir nu4am  mfeiat arrmum ;t1aexn fctyd a2eanms t0aexrmf3iadomDeai i;s0 rxmxopoy4omenlicil()s2rr(mp;u0tlt  feiyd s rl(vs;(0aexomfciotoaDeaiei;s0sexm(o3ou1op nlnviat a2tr(mpnt4ole  fcias m umuvp;(0tltnmo3oytom rliei s)sexmxo3iudomtnlfeiat s2rrxmpno1oltoioctlt aDrmuvp u)tlenmr iadoaDelieols)trum(r nu1amen neilsfs2urxmpno1aleo o3ild a ea(ms;u0 exrxocoa1oaD  i o (0s2tmiopnydap   feslt aDtruro;u4opxnioetatla2umump;(0 ltrxfciodfmt  u o;t0srtoxmpnudol e nvi (  Dtm(monu0tptomfetlt a el(vs (0aetoxo3oydlm raies s)t2tmir nudop   ictat)srtrxm ;u4tle miciadlsDem(vont) exnir3oo1lm r uvi;s)srxmio oo4alee ies () 2rm(r nu4tet mfeiysfs2ea( pn() rtnxr3tytfpD  iei;(0trur(o nu1lpt mivsl( aDtm(mpnt0alt io3iyd m ul( p (0 ltomociy1omt  uei;()t2trirpiydome lnvi t)srrrxrpot0texnmfeils s2ulums u)artrir3oadoatrli o s)trtr(r3iu1open net ()sDum(moou4aexnio3iys a2rmn s u)trxnxf3iadlpt aivs;s)tetoir3ou4lp elnctlsfs2rrxrooo0olxoiiciysfmDel( s;()tetoxf3tytlmD luvil(  etoxr3iudamt lnei s)s2tr(  ;u0oee mo3ild m2emuvo u)tlxomrctydlptelnvo s trtrxr3nu1aleemfesat) Drm( o;t4tlt io3iydfm rm( onu4trtoxr totlpte nei t) 2tmir3nodll nmnetlsf Dtmxm ou4aeenio3ilslsDrmnvpnt4artrmr3io1fpDr ueols) 2xmxm3iydalt lictasfaDrrur no0tptomoeiydfa elumpn(4 ltnxfcio1fp  lu ilt0 2tr(rpiu4apt mfvtls a2tr(m ;t1oet mociyd s rlnvo () ltnmf3iytfpt  uvslt0sexmxopiu4apte fes t  2uaxro;t1aetomicils s uanmp;u0aetnmf tytopDeln i;s s2trxrpny4amt  fcs t)s2umx poo4tpxnmocilsfm2ranmo ()aeerio iytlpD lues;(  etrimpno4ope licsas) rtr(  nu1texo i3iytfa rlnvpnt) lerxo3oo1om eli o;(  2uoiopno4lle mfesa(fsrta(m no0tle mfctyt a rl(mp;t0 lerxfcoa1oaDeanesl() rxoim3iodameemiviat arta(rp;t4alt iicilsls ra( on()trtoir tadfmtelues;(0 2urirpiodamtelfcil(  2tmxmo;t0tpenmociatls rmn s;u4trtnif3oodop   neslt) rtrxopiu1opeelfcia()arraxr ;o1tpx mo3ild aDra(mo;u)alerxr3oa1la eaieo t0 ruoiopno1ol elnet t) Drmxrooo4ape mi3ildfm2ea(mp (4 exrircootlmte ivolt t2tr(rpou4op nmfeilt)a2ururp;o0aex mociyslmDuauvpn()aeerif3iotomDe ieo () exo(opno4apte ivil( s2urxmoot4tlx  feilt m rau sn(0altnxrcoatla   i s s0 2tmio iodap  micia(f 2rr(roou4tlxnmi3iasfaDumnms u4arxomo todfaDean slt  rxoxm3oodlle  nvsltf 2um(r nu0tlx  feiatfsDrmnvo;t4altomo oadfa   ueo;t  2xmio3oy1am emfvtat) 2umx  ;t4tleo oeiysla2emnvonu4tlxrmo3oytlpDeau s;() rtmio3iu1oltemfvt t) 2rr(rpou1texomieiatlaDelnmsnu)alerxr ia1opte n il()tetoirpio4om  micsl()aDrm(monu4tpe ioctad a elu s t0arxomf3oo1om  aneo;() eum(m3oo1apen ncsa(fs2rm(mpnt4olx mfciytlaDuanvpnt)treoxocoo1omDeluvi t0 2ur(opou1ame  nvt s) Dra( p;o0tleo i3iadfmDemnvs u0 rtnxfcio1om r n o;t)srtoir oo1open neslt)sDtmxmpot4aeeoiietydfsDrmu s;()areomo3iatoateaivi s0sexo(o iy4op emiet s)artru  oo4tpe iicils m2rlumpnt) rxnxociodfa e ieils)t2tr(opnudlp  liesa(fs2rrx  ot4tpeomo3iyt mDran snt0alxrxo3tatoatrau o ( seto(r io1lptelncs t)aDrruroot0olx  i3tldfsDrln p t4alenxr3totlptelu o t)srtoxo3oydal   ivi s)aruaxm ;t0tetnmiciad s emuvon(0artrxr3iadlmDrlu sls s2xr(m3no1ape lictltfsDtrum no0aptoioctytfmDumnvs (0tltrxr iadlm raivo;t t2urir3iu4ol elfcs (fa2umx  oo1apenmfciadla umuvo;t4aexrio iy1fp raneo;t0t2umim oo4lmtnmnesa()artm(mpot1alt moeildls2rlums u) lxrxf3oodoatranvols) rxo(rpiodamt mnes ( srrr(mooo0alx iieils aDua(vont0aeenmo oy1lm  aieo;(0 exrxo io4lp  micilt aDtm(r nt1tltnmieilt mDrluvp u0altoio3iytfmtranvs;s) 2xrxo3oo4apee neils)srrmx  no1aleoioctltla2rm(mo t)trxrio3ty1laDrlneol()trxmxr3oo4am emnctls)artaxrp;t1tpxnmoeiytls2eanmsnt0alxoxf3tydlm   nvilt)texmir nydoptnlfcslsfarum( onu1alx  ictyd sDelnmonu) renmf tadopt aiesls teum(m oodlpe livias  Dtmx p;u0tpt  f3iat aDrl(vs t0texnxo oodfm rauei s0srxrxm oydale  ivtas)a2rmumoou0optn iciydfsDeanvp u0artnxr3iydfpt  nvs s0t2xoxr3oo4apt licsl(faDumxmp;t1opto f3iys mDumn p t4 rxrxrcoadfm rauei;t sexmxopiudole liviatfsrraurpot1tpxo feiasfs2ulump;u4alxoif iatom r ies;s)texrxm oo4opt mfctlsf 2ta( oot4tet  feildla um( p u4areomo3tatfpte uvs;t0t2toim iy4llt mfesat  Drm(m ;t0tpx if3ild aDra(msnu0 ltrmocoa1fmDeliei;( tetrirpoodap   ics (faDtr(  ;o1ape mo3ilt s2ran s t0 lxoir ia1fpt luvi (0trtrim no4apenlivs (f rua(r ot0oeeomi3iysfa2rau o t0altrmoctytfaDrai ols)s2xrxm3oy4omte ictasf Drmur ot4tlt iociatls2ra(mo;(0trxrmr3ty1optranes;( sexrir3ny1lpt  ietasfs2rmxrono1aeen iciadfa2uaumo;()tleomrciydla  lnvi;s t2urir3nu1apt  nctlsfaDra(rpnu1apenifciad m2rmuvo u0 exnmr3tytlpD livsl() ruoxm iodlpe lics t)aDtr(ronu4olxomf3iadlsDumnvpnt0teeoxf3oadomt  iei;t)srtr(m oydlm nmnes t  2uax  ot4aex ifetytfa2emn p t4trxnxf3iydfaDe n olt0tetmxm3nudoleelieil( aDumump;u1olt  fciys a2ul(mpn() exomr tatfpDr i o ()seurxo3iu4amenlicsa( aDtm(m ot4oetnmoeiys m eanmp;(4tetomo oydlateanesls0t2xmio3ny1lpeelfei () Dururoou0tlenioeias m eau p u)alxrir iy1fat lies;()s2toxr3iudll emncilt  Dra(mooo0aex io3tys mDrlnmonu0arxoif3totlmtelnvsls) eurxr3oy4aptnlfctl()arrr(mo;u1apxn ocildfm ulu o;() reomf3tadfmtr n sl(0 2tmxm iy4amenlfvilt  2ra( ooo0aetnmietad mDeln p u) lxnif3oadfatrauvs ()t2xr(o iu1llt liviat) 2tau o;o4tlt  i3tasfs eauvp;u)arxnir tydfm   neslt)seuoxo3iodlmee ivt (  rta(r no0tptoifetytfa rau snt) leoxo3oo1opt  neilt0 2tmio io4lme liet (fs2rr(mo;o0apen ietat sDrl(vont4tlermo iatlpDr nvi t t2xmxo oy1lme  fvsat) 2tm(  ;o1oex mo3iydls2rau p;u4tetnifctadlaDeanvols) 2umim iydapte iei s) rrm(m no1openmictyt m ean snu0aleomr io1fmtrlivo s0srur(mpiudole  ictlt s2ta( ono4alxo iciysfmDuluvp (4 etoxfcoa1lm  anei;t) eur(m3oydolee fet t) Drrump;u4oexniociyt m2rlnms;u)tetoiocoa1fp r nes;t0t2uoxo nodlltnmivt s s2rm( o;o0aeto feiasfmDemuvo u)tltoir3tydfmtrlivo;( s2umio ny4ap nmieia(fsDrmxrpnt1tptnmfeiydls rm(vo (4 rtnmf oo1lpDr u o;s) 2xrio3iu1al  miesls) 2rauro;u4alx moetlsfm rmnmpn(4texnif tatlm  lueo t  2xm(m io4amtnlictasf rururpoo1tpeo ociydlm2rmn p u0 exnxr totfp eaueo s0t2xoimpny1optn ivtlsfaDraump;t1tlenif3tydlm2elumon(4teenmrciytfate i o;t)teur(r3ny1aleemfct ( srtmxmo;o0tpeomfciyslm em(vs () ltoxoctotfm rlnei;( setmirpno4lmee fvtlt  Drax oot4texomf3iydla2el(ms t0arerxr tytlmDeln o;s) rtrxo3oy1optemfvs tf 2uaxmpnu4oeeomo3ild sDua(vs;t4treomf3oy1op  aivo (  eurxopoodop nmnvtl( srumx oou4oleo ieilt m emump u0aexrmf iatfaDe nvs;(0 2xoimpnu1am elnvslt arururont0oexoiieiasls eauvont0aeerir iodoptr uvo t0s2xmim3oy1om eliciatfa2ta(  ou4aleoifciysfmDrmuvs (0texomf3iatlaD  nvo s t2xrim3oodll elfvsas arta(ro;t1tltnmfciyd a2emnms ()trtnmocootfmtelu o t)trxoiopnu1ll nmnvsatfsrtru  nu1oet moetlslm eluvp (4 lxoxo ootoaD an sls0t2ur(o3nydop emfeilsf rumu o;t4olxo f3iydls2rmnmont4trtoxr tytfmt livi;( trxoxrpnudoptnmietltfs2urxm ot0alen iciad sDemump t)arxnmocoytfmD anvo t texoxr oo1al  lnvilt  rtaxronu0oee  ocilsfm2elumo ()tetoif3tadlpte uvo;t) exmxopiy4ole lfvia(fsDtr(m oo0tlx  fciatlm ra(vo (4arxomr iodomDeaivs;s0s2toxm oodamte nci () 2rrxm oo0oleomfcils mDeau p;t4aetoxf iodlat  i o t0 euoxo3ou4ale lici t  rtmxrono4oltnio3iysfm2em( p t0tltnxr oatlat  ueo;s)t2tr(o3ny4amt  ivsatf Durx ono4tltnioctatla2uau s;t4trtoxf3oa1la eaivo (0texrir3iy1amtemiet (f rtau  ot4ole moetlt sDul(msnt0 exrxf3iotlmtrlneil( setoxopiy1llte fesl(f 2ua(mpoo4oee  o3iat s ran onu0 renifcio1oat an o s  eum(r oydlm elfvsl() 2umxro;u0oetn i3tatlsDua(mo;t)trxniociytlp e uei s)truoim no4lptnlnvsat aDtmu  oo0oeen i3tadfm2uan o u)tlxrifciatfpt ai ol(0 2xmir3oudal  lfes s  2rmu pou4tpt  feiysfaDrlnmsnt)arxnio3iytoa r i i;s srum(o3nydll elncs t s2ur( oou0aptniociatfa eau p (0trtnxo ty1fmDeanvolt s2trxr3io1
\ No newline at end of file
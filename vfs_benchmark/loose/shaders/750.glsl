@@ -0,0 +1 @@
+n o t) 2uo(r iu4lmtemivsl(  Dra(ront4opxoifeiyd a rl(vs u4aeeomo3iydoaDrln s;()s2toxr3ny4al   fet t)artm(moou0tpenmi3ilslmDrl(vp (4altrir iotlpt auei;(0seumimpnodalte icilt)a2uaxr nt4apx miciadfs ua( o t0 exrxf tatfmDeaieol() etrxr no4lltemneil(f rurxmp;u4olen o3iytls2eauvs t)trxoxr tatfa  lneo;()s2to(m oo4lp  mnes (f Dtr(ronu4aetn ictadfm2ea(msnu0 ltoxfcoa1lpt aivs (0 2urxrpny4lm n feslt)srtmxro;u4opt if3iad s el(ms;u0artnxr3io1oa r uvs t teur(o nydal emneias srtau o;u0aex mo3iyt aDuan s u0 rxnio3ootfpDrlivo;(0 rur(m oy1opeemivsl(fsrum(m ou4tleomi3tldfaDum(vo;u)trtriociatlptr ivs;t seurim3ny4alte icsas)arra(mooo1tpe iietyd mDuln s;u0 eenir oy1laDrai s;s srxrir3oo4ole lfvs s  2ra(  nu4olx iicilsfs eau p;u)aexniocoydla elu o (0t2umirpoo4alt mivt () rrr(  oo0tlx if3ildlaDeanvs;(4tlxrxo3tytfmt  neols  euo(o3oo1lm   neiat sDuauro;t0oee ifeiyt s2ulumonu)trtomo oytlm r u ils)t2xo(rpnydol nliei (  Dra(m no1opxomf3iydfm2rlnvon() eeoifctydopD au ols  etr(opny4lpe lneilt) 2rmump;o0openmictytlm ul(mpn()tleomf to1fpDran o;s) exrxo3nodam n icsat s2raxro;o0altnmfeildfmDem(vsn() etoifciatomD lu i;( srumiopoy1omenlnvslt)arrm(mo;u0tpeoioeilslm2rl(monu0aexrmfctotom rln olt texr(o3ou1omee ncs sfa2rau pnu4aleoio3iydfa emu p u) reomrcto1oa   nei s0setr(opiy1ap nlfesasf rtm(  ot4tpeo ieiyd m2el(mo;(4trerxf3totfat aivilt)setrio ny4ole lfvil(fsDrr(r ;o0alt mf3tlslaDuln p (4 ltnircoadlate n o t) rtmxo3oy4ll emfct s  rum(ront0olxomieildls umn s;u4texoifcoy1lp   u s;s)srto(opoydamt mies s  ruaum nt1oeenmi3iadfa rlu o;t)tltnmo iatopDelivilt0 ruoxm3ou4op n nesat s2tmxm ;t0apeo ieiatfs2rmu o;(0 eeoir ootla rln sl() etr(m3iu4ope lfctasfa2tmu ooo4alx mfciyd a eanvpnu)tltomf tytlmtr nvo;()srxo(m3oo1al  mietls)srra(  ;o1tpe  oeias m emnmp;t0tetomo3iodfaDeli i ()srxr(r ou4olt lnvsa() 2tr( p;u0tltn o3iydla2eauvp t4artoio3io1lmDe ivs;()srumxr3iydlmt mfetlt) 2rrum ou4aptn f3tldla2elnmo;(4 etoioctytoaDraivi s) rxoxo iy4omenmivta()srumur ou0teto f3iysla2ea(vs u0alermr iytlm  lueils t2xo(opiydlpe  netlt a2rau poo1aex ifctlslm2uanmo;t4 rxoxrciytfatraies s0srumxrpiy4alt  neilt)a2trx ooo4aleomoctlt mDrlump t)arxoio tydla   ueil(0 rxoxrpoy4amte iciat  2uaxm oo1alt micilsls um(vsnt4 ltoxf3oytlmD aues t) 2xm(o3io1olenmnviat)sDuax pno0tpe ifctlsfmDra(mo;t0trtoiocoadfa  ai i;t)t2umir iydalenmnvi s aDrau pnu1alt  fciyt sDran ont) rerir3iodfmt  nes;()t2uoxrpiu4al n ncsls arra( pot1opeomoetatls rmu p;u4tetrio3todfm   ueo;(  2toir iodal e fcsatfs2um(mont4ole mfetysfmDra( p t4trxnxociytfp   nei (0 rxoimpoydam elnct s s2umur ;u1tpto ieiat s uau p;(4 ltnxo3iadlm  lues;(0sexrxrpoydape lnvsa( s2ta(ro;o1tlx  i3iydls el(vo;(0 rtrmf tytfp eluvolt) exr(m ou1ole lfcilt a2ta(mp;o0apt mfciltfa2el( s;(0tltrir iotlaDelueils) ruoxm3oydomeelfetls)srtmumont0ape  oetat m2ul( o;()arenmf3tytlm eaivo;s0 2xo(r3nudoptemfvtls)sDta(r ;u0aetn oeils a2ean p;() rerio iodfaDeliei;s  exmxm iu1lle liet ()aDtm( pno4tltomi3tadfm2rauvo t4trtrif3ty1lpD anvi;t) 2xr(rpnu4lpeemfet s)sDur(  ;u0apenio3tls a ulnvo;u4 rxriocty1la eaues s) exoirpou4lm elies sfaDua(r nt4opxn fciytla2rauvonu0alxnxr3ootfmt  nvs t  2tr(o3iy1al nmiei (f 2ra(m ;u0tpto oetltlm ulnmo;u4 lxnmfcoy1omt aivi;( trtr(m io1lltelfesls aDum(m ;u1tltn fctysla2rm(vs;u)treoxf iatlmt livi;(  rurir3nudlmee nci ()a2rau  no4texn oeiadlm2rauvp u4 lxoxr oa1lmDean olt) eurxr3iu4om e ivi (fsDum( pno4alen feiys s rl(mo t4artoio3oytlpD auvolt) 2tm(o3oudlle lnctlt)sDurxmpnt0apx  o3tldla2rm( p;t4arxomo totfmtr nvi t)texm(opio4opte fesl()srtaxmp;t4ole  fctyd aDrau p t)arxoio iatlm elu o t  2tmirpio4llt lieilsfaDta(rp;o4aexn fciys m em(mont0altrif3tadlpt  i s t) rtrxr no1ole  fetl()sDta( o;o4oetnmieiadfa2um(mo u4artomo tytoa   nesl(0trxmiopiydalenmfeiat aDuaumont4oeenii3tltlm2em(ms;(4aeeoirciadlatrauvilt) rtmim3ou4ole  fetas) rurxmp;u4apeomf3tyd aDea(mpn(0 exoxo ty1fpDrln i s teurir oo1lp  lnei tfsrumu ooo0tpenioetysfa2rmnmon(0 rtrxr iadlmDr n s (0seurxo no4amtelfvt s arumur ;u1apxomoctad a2rmn o t)alxoxocoodlat  uvsl(  exrxmpou1al e ncia()aDta( pnt1tle ii3tltfaDum(mon()tlxnmo3oy1lptr uvs t0s2to(r iu4amtnmietl() Dumu  oo0opt mi3tad a emnms (0arxnifciotfm elnvi;s s2um(opny1lm nmfvtl(  2rmx o;t4tpxnmfetlsfsDra( s u0areoxr3io1oat lu i s0 2tm(rpoy4llenmfvsasfaDtm( pou0oet  iciydfm uluvon()altoifcoa1op eai s t)s2xm(r ny4lmeemnvsa()aDururonu1oeen ieiadlm2ua( s t)alxoxf iy1oaD luvo;()seuoxmpoudom emfvslt sDur(rp;t0oeenmictlsfmDul(mo (0aexoxf oadomDrauvs t sexriopiudap n feiat a2tm(mono4tex mfctlsfa2eanmp;u0 lxnir oadlmteliei t0 2um(opiu1openlnvias srrrxmont1opx  octyslaDul(vsn()tetnio3tydfat aivs;() rur(m oodoptnlnet t sDtaurp;o0aetnifciatlmDra(vpnu)aetoif3ta1fp e nesl(0seum(m io1apt  ieias aDtmu p;t0aleoifeiad aDrl( onu4trerxrctatfaDe u ilt)srurim ny1lmtn ictl(f 2um(rpnt4texomfeiatfsDeau snt4 eerxfciy1lmD anvi;t0srto(o3nu4lleelicsa( sDrm(rp;u0oeen f3iydfm em(mp (4 ltnmf3oa1opDrlnei;s0teto(o ny1lm emicsat sDuax  ot1tleniieiyd a umnvonu4texrif oydfmD lnvol( trxoxrpny1amt lfetlt)arraxm nt0tet moeias a2rmnvs t4texnxocty1fpDeau ils) 2uo(r oo4opee ictat sDrru  no1oeto ieilsfaDuaump;u) rxnircoy1fm e u ol()texoir ou1lm nmfetltf rtax  nu4texnifeiasfa ul(mpnu)alxnirctytoa r n ils) exmim iodlm  lfvs tfaDumxrpnu0apxoioetatls2ea(mp;u0trtomrcoadoatrlu i;(0teurxopio4apeemfcia(fsDtmxroou4aex  o3iytls em(vo;u4arermrctytfpDr n ilt s2trxm3iy1am   fviltfa2tr(rpou1alxoio3iatls2rluvsnu)trtoxfcoadfpDelnei s trtrio3iydaltelfvt t  rurx ooo4tptnmocias mDel( s;u4tlxnxrctydomt anes;t  ruoim oo1am emfcsl() ruaxmoou0oexoii3ilslm el( p t4 rxoir3oydlm   neo ( texmxo io1amtelieiasf rumxmpno0alxoiicilslm2umn p;t4 eeoio iytlat  i slt  exmim oo4oleemnciasf rtmu pnu4ope  oetadls umuvsn()tltrmociodomt luvi;t0 eur(r ny4ol  lfviasfsDuau p;u4tlto ociadlsDea( s;t0 rtrifctodomt ln o;t0 exrim3oo1ale lncils)a2tm(m nt4oltnmoctldls eaumonu)tetomfcoydomtrauvs;t) rtoimpou1am  mnet (farur( o;t4olenifctadla2ulnmo t0 exrif iatfatr i il() rxrxm3iodamt livt tfa2uax onu1tpt iieild s2rau p;u0trtrio3ta1fat aneslt t2umxr3nu1al emfeils) Duau onu1opt  f3iaslm2ul(vp;(4arxrmociatoatelivi;s  2xmxmpoydam nmiet ()artaumpou4tptnmi3ilslm2umumon(4tlxoirctydlm  anes (0trtoirpiy4ope lnes t srtrumo;o1tex iieiytfa emu pn()aetoxo3iodlp e nvo;s) 2xr(r3nydamt mnei t) rtrx  nt0apxnmieiytfm2uaump (0aleomfciotfpDrlnvs s) 2uoxm3ny4opeemfetls)srrmu p;t1tleo f3ilt m2rm(vsnt) lxrmocoa1fmDran olt0 eum(m3no4altnmfviltfaDtmx oot1oetoii3tlt a uluvp;t0arenmo tydop eaiei t)trur(m3ny4amt lfetatfaDua(m ot0oeenmieias m2rm(monu4altoxoctadopD  n ils s2urir oo4ol   ici ()a2rrxmpoo0alxn i3tytlsDrlu o;u0alerxf3ta1lm  aneslt) etr(r3iu1alenlnetas)artr(ro;o4opxoiocilsfmDrmumo;t)tlxrir3oo1oat  n o s s2toxo3iudalenmivi t aDrauro;o4ope mociatlmDumnms;t0aleomf3todla rliei;t  2xmir nu1olenlictls aDumx p;t0teenii3tad m ulu p (0 rerio ta1fmDrli i;(0sexmxr3io4lm e fvtl() rur(r nu4olt ifeiadfmDemu snt0aetrif iy1fpt  iei t)trxoxo3no4om emnes s)aDraxrpoo1oleomi3iltfm ul( p;u0aleomr3oydoptrli s s)t2urxr ou4omen icta(f Dtm(mpnt4apt ioetlt m ulnmo;t)texnxrcootla rluvi;t teto(o ny4lle  ivi t  Drru  ou4tet io3ilt mDranvp t)alermrcto1fp  ln s t) 2xoxopnydome mieil(f 2trx pnu4tee  fciyd m2umn pnu0trxnxr3iadlp  an sl( trxoxm3oudllen nvt s a2taurooo4tpeoifeiytfs2elnvo;u4 rtrmr3oo1fmDr uvi;t)trumxm3iodop nliviasfsrtrxmpnt0oex io3tldls2rmumon()tltnxfctytoptr nes;t  2uo(m io4opeemivi (f rtaumono0oet mieiatlm2ra(msn(4 eenxo3iatom rlnvols0 rxrxm3nodom e ictlsfsrtmx pou0olxo oeiydls2eanvp;t)aeenxr tydfm  ai ol() rtmxm3io4aleemfct s)srraurpnt1alt ioeiltls emu o ()texnifcio1oa e ueslt srtoimpnu1amt mfcsa(f rtrur ot4aptn ietld a2ulnvo;u0teerir3oatlaDrai sls)setr(o ou1om elfvilt a2raumo;t4tetnmoeiad s2elu p;()alxrxr tatfat lueo (0setr(o3oudlmtn feils srrr(mpno4optniietatfm ul(von(4texrmf oytoa eau sl(  rxrxr no4olt  fetltf 2ra(ronu1tetnmfciad s ua(ms u4altrmr oadomD luvo t0 eumxo nydll e netat artruroot4teeo iciys aDuan onu4artnmf iydom  auvs (0 exmir3io4am nlfvtasfsDumumonu0apt micilsfs2ran o t4 ltnxfciydoatrln i;s) 2trxmpiy1lp elneils  Dtm(r ot1opx  oeilt s2elu s;(4 etnmr tytla e n slt) etrxo3nydamee iviatfarurxmo;u1tlxnifciasfm2el(vsn()aetnif oodfpDelivi ( trxrir3iydopen icsltfs2raxr ;u0oex miciat a2rm(ms;u4 lxrxo3iy1lmDeli slt0teumxr3io4apeemnvsas aDraxr ;u4tpxniociatls el( ont0arxomo3iydopDr nei;(0 rxrim nu1ope lfvslt)s2rrxmont4aexnmoctldfa2eln on(0trenmoctodlaDeaues t0s2toxr nodopte nvtls sDrmurpno4tpx ioeias mDuanvp t0 ltomf3iadfp rli i ()trxoio iodamtnliei s  2urxronu0apt  iciyd sDran o;u0tlenxr iotop  auei t t2toir3nudlm emiesls  rumu ono1oleomf3iytfmDemnmp;t0 rermr tadfa  an ols0 rumxopiu4lltn nctlt)arua(  ot1aptn ieils m umnmo u0tlxrmrcoatfptelueo s)truoxo3io4optemfctasfs2rm(  ou0tle ioctlt mDeanmsnu) rxomo iy1opDeaiesl()trtoim3oy1ale mietl( s2urum ou0optnmictysls umn s;t0trxnmf oatopte n i;s0trxo(m3nu4ap nlnvil(faDurxr ;t1aex mociasfaDuau o u4trtrio3iotop  ai i;( t2xoxm3ny4optnmies ( sDuaumont1olt mfcildls ulump;t4tltrircoadlpt aueolt setmiopno4ope  ict ( arta(m nu1altnmfciasls um(ms u)trenmo iadla e n o;t)srto(o3ou1lp n ivtl(  Dtax oou1oeen o3tydls2ua(mo;()trtrxrciotoateanes;s0 2xrxr ny4ameemfet tfsrrax poo1tetnmf3iat s uauvon(4 eenxo tadopt an i;t) 2urxm ny1opte fciat aDrrxmp;t0tlt mfeiyt s rmu o;t) ltnxo3oydom  lnvi;t teto(r iy4lptnlivtatfaDumumpnt1olx iieildfsDumu p u4alxomfcoytfmDr n i s)setoiopiydomtemivtl() rtr(r oo1tpto oeils s rmu o;(4 etrmo3oy1fpt  i i;(  rtmiopno1lp emfcsa()aDraxmpoo1oetomf3iaslmDra(msnt4altnmr oadoat an sl(  eum(rpoy1ol nlfcs t)s2uaxr ;u1apx  o3iytla2raump;t0tltrxr3totoa  aneols0t2tmxopoo1am elnctltf Dta( o;o1aptomoeiysfm2el(mp (4alerifctatfm r uvols0 rumim iy1olenlicias)aDurxro;u1oexomietatlaDelnvont4trtrir oo1op elies t teuoirpoy4omenliesl(fs2tmuront0tetn ictld sDulumo;t0trerif ta1lmtrlnvo ( teurxr3iodll emivi sfaDurum nt4apxoifeiysfm2ua(vs t4 ltoifcia1lmD luvs;()srumxm oudapeelfetl()arraxrp;o4aex mo3iadls emuvo;u4 rermrciytoatraieslt t2xo(m ny1lltnlfvtat)arururp;t4aexoiieildfm elnmsn(4trxrxr oo1lptran i () exmirpio4ameelnct t sDuru oot0aetniiciysls ul(mo () lermrciotoaDrlu s () 2tm(rpoy1ap nmfetasf Drmxm ot4tlxnifetyslmDuanms;u) eermfciadla   ivo;t) rur(r oudamee ivt t srrmxrpou0tpenif3iad m ranvs u0 eenmocoadomt anvo s trtoim3io4aleemivil( artmu pnu4aexn ociyt a ul( on()aexnmr todlmDrli o;t0 rurim3io1lpe  nvtlt a2tmum no0oet  feiys a2raumpnt0altnmr3oadopt anvi t0t2toxm3oy1alt mfctatf Dta(rono1ale mf3ias aDeanvont) lxrif oo1lpDelneslt)tetr(rpnudolee fvs t sruaxr oo4apx  oeiydfs uaumsnt)tetrmo io1faDrlies;s)s2uoxo3iudopeemnciltfarrmumont0olt  ociys m rlnmp t)arerif3ootlatelnvo;s) 2umim3iy4ome livsa() Dur(  no4aptomfciytfmDumu o t4aexnxr tatfmt  neol( seumio nu4amtemnvsl(farum(r ;o0opx io3ils a2rl( o u4tleomf oo1fpDeauvil(  ruoio ou4lp e nctatfaDrax  nt4opeo ociltlm2ulnms;t)aeenir todopDranei;t s2xoio nu4lp emict t) rrauro;u4opeo i3tyt mDeauvo ()teenxfctotlp r neo;t0sexo(o3no4lpeelncs s)aDra(  ot1aetomociasfa emn s;(4 exniociotoa eli i (0setmir nu4lpe lfesat arua(mono0oeeo feiyt s2rlnvo;t) etrircty1fat lu ol()tetrxrpoudomte ivtat arta(moou1opt mictlslmDul(ms t)trtomf totlmD luvols0s2uoxm3ny4amen fct sfaDrm(rono4texn feiatfa rau p t0 lxrxfcoa1fp e uvo s) etmxo oydol nlicias)a2rrur oo1olenmf3iydfa2umnmpnu4alenmrciy1la eaivo;(  2xr(opiydlpeelicia()aDurumooo4tetomicildlmDua(mp u4 lxnirctytoate u i ( srtoxrpoy1ole livi s) Dtrump;u0aeenmocilsfa2ulnmpn()tetomfcoydlpt  nesls0setrio3iudlm emiesls aDta(  ;u0tpx  ieild a2ua(vp;t)trerir io1laD anvo t trxoxmpiudamt  fvt () Drm( pno4tee iociaslm elnmo () reomo tytlm eauei ( trxm(o iodaleemnct sfsDtmxmpot1apx  ieiat aDrmnmpnt)trtriocoy1omte ieo;t s2to(m oy1al  mnvs tfs2rmx  oo1opt mictls m2rln o t4artnmo oo1lpt luvs;s0t2toir io4lp  lncsl(fa2tr(rp;u4tpxnmoeiatlaDua(mp u0 rtrmr oadlm r ies s s2xm(m3ny4alen nvs (fsrrr( p;u0tlxoiieiydlm rlnms (4tlxnif3totlatrlivo;t0s2toxr io1lp n nct sf Duaxm nu1tlxnmo3tldlm eanmo t)alenmr iydoatrai s s0teumio3iudlm elnct sf Draxrpou0tltnmoeiydfsDel(vsnt) ltnmrciy1fp rai i () 2xoxo oy4apt mictlt aDtrx p;u1tlenmicild m2ean p;()trtnxo iy1faDr ivo s)srto(mpiu1lmenlicsa(f 2rmu  ou0aeeniieiat m2em(ms u4 lenmrciydlpDrliei;( t2xmim oy1lp n fvia(fs2trumonu4texn i3ils sDua(mpnt) rxomfcoodomDe ivils0s2xrxopiudam  lfeslsfa2ur(ronu4aet  oetadfa2uln p u)tetoxo oy1omDe uvi;s)srtmio nydole licsl(f Dumuroou4apt mf3tyt aDuan o;t)artoxr iodlptr nvo;s  rxriopio4lmen iesat sDtmu  no4tpxn ictatfs2uaumsnu0 eeoxoctytfat lu i;s)seuo(m3nu1lme lnes t)aDuau p;u1aeeomiciadls emu s t4artrmf oytfm rluvs;t)trurim nodalenlfvil()a2rr(mo;u4optnifciatla2ran p;u4altnxo iy1oa r ivo;()s2xmirpiy4lme mneiat)a2tmxrpnu0openio3tytla uaums u0alxrxo3ta1lpt aieo;s0t2tm(r oudapenmnctatfaDtmxroou0aetomi3iltfaDrmump (0aetoircoadfpt  ivils) rtoxr oy4ale lfviat)a2um(moot0open oetadlmDumnvo;u) rtrmfctytopteau s () eum(opiu4lpe lfct tf 2taurpoo1olxnmoeiys mDua( o u4texomo oadop rluvi ()t2xrxo iu4omeemfvsasfa2rmxr ;u0tlenifciytlmDrm(mp u0 etoxo todfmDrauvslt0 eumir oy1om e fesa( s2um(rpoo4ale  f3ils aDea( s;u4 rxrircoadfatean o s)sruo(rpio4al e neiltf Dur(mp;t4tpe io3iyd sDulumsn(0arxnifctydfa eluvi;t t2uo(rpiudop n neilt  Dra(  oo1alenii3ils m2umumo;t)altoir3iydopDeln o;s0texmimpnudamt lfvtl(  2ur(rpno1aex ifeildlsDeauvsnt4 exnmf ia1fmDr nvi;t trumio3ou1lm emnci sf 2umxr ;u0apxnmfetadla eauvsn(4tleomocoatlpt au ols) 2urxopiodome mnetas  rtrx o;t1ope ifetlsfa2emnmp;u) rxoxr to1lpD  ivsls  2umir nudlm  lfvi tfarrm(m nt0alen o3ildfm eau s;t4aexrmr oy1lptrlu s;s0t2tmim3oy1ope mivt s)a2trumpnu0olxnmoeiyt a2uan snu)artrmr tydlpteauei;s0 euoxrpoudlptnlnet t sDuau  ;t1texo i3iltfm rmumpn(4aexoxf3to1opt  ues;s0 2tmim3nydlltemnesat) rrru  ou0oeto ociadlm2em( sn() etrxfcia1om rlnvs;()s2xm(o io4omtnlnvsls)a2urum ;o4tpx if3tatlaDumu p;t0altomfciy1omDrluvo t)setr(o3nu1amteliciat)aDurum ot0ale iieilslm2rl( pn(4 rtnmrcio1fmDe uvsls) 2tmxr nu1al emivi t  rur(r nt0tltoiiciaslmDrl(mp;() lxrir3tatlatrli sls) eumio no1opte icil(  Dtrxronu0aptnmi3ias m eauvon()aetomf3iatoptr ueil() 2toxo iy1olt mncias) 2taum nt1tleomf3tyt aDrmnms;t4 reomr3oadfm   n olt) exo(rpoydapee fvt ( sDrax  nt4tpenifciytls2ranmpnu4 etomocty1fm r i ilt) rum(opio1amen ictatf rumur ou4aexo f3ilt aDumumo;u0teerxr oa1lm rluei;(0setrxopiodlpe lnci t)a2rr(  ou0opt mieiadlsDrl(msnt)aleoir tydfm ranvo t srtmiopno1op  mnci sfsrrm(rono1alen o3iydlmDelu p ()arxnmr oadoat anvs t srtrxr3nu1omtn nct (f 2uaxrp;o1altoif3ildfa2rmnvp (0arerirciy1opt aneo;( texm(o nu1op elfct s) Dua(mpou0texn iciaslm2emn o t) lxrio iodlp  anei;(  exmim3oo4opte ies ( sDta(r ;u4tet ioeilt aDuluvp;(0trxrifcta1laDrluvo t) 2uo(r3iudolenmnetas)sruaumo;o0oetn ictltlaDra(vs t4 rxoxf iadop e i s ( setmim oo4lptnlivs s  Dtaumpnu1olxnmo3iatfm uanvs u)aetnir oodopt aivil()t2xoxmpoudape  ivtat)aDurumooo0opt iicildfs2ulumo () lerxr3oodlmD auvols sexmxm3nudop  micias  Dtaurp;u0optnmf3iadls2eau o t4arxrirctatomtrauvi s) 2tmiopiy4olenlnei sfa2trum ;t0tpenmieiatfsDrmnmo;t0tlerif3tytfa r ueo (0t2xmir ny1lme  nctat) 2urum ot0texniiciltlsDemu s;()alermo oatfat  u i ( seuo(r3oo1lpenlfetl(fs2rr(mont1tpt  ictys s ua( s;t)arxnxoctodfm  anvs t0 eto(rpoo4omeemfvsa()srraxr ot4opt ioetadfmDemuvpn()areomrctydfp eanvs s) etm(opou4lltn fet ( a2tmxm oo0tlenifeiadla2ua( pn(4teermf ta1lm eaieo t0s2tr(o3nudllt mfetat) rtm(m ;u0apxnmo3ilslmDelu s;(4 lenmf iotomt lieolt0srtrir3iy1omt mfeia(f Dtmx oou1oeto ocias m2rm(vp u4artoxr3oodom eai i (0t2tr(mpou1am e iesls aDtaumo;o4oleomoeiasfm emn p u0trxrir3tatopt  ueol(0trxmirpoudom nlicia() 2raurpot0oltomietatfm2ulnvo;t) ltrio oytopDrluvs (0s2um(o3iudape  neiasfs2umx  ot0oexnmo3tyt s rl(msn(4artnir3oadla r nvo t0t2uo(r nudolenlivt s  2tmumoot4apto octlsfs ea(ms () rtrmo oatoa  lieo;t)setrxr3iudll e nci tfa2rru  ;u0alenmoeiydla rm(mon()tlenirciytfpDrauvsls0 rxoxo3iu1oltn ivslsf Durur no4ole iieiad a2rlumo;(4 eeoxo3iodoate nvs;t0trurxo3nu4llt mfvt s)arumu ooo0tpxniieiat a emu s;u4 rtnmfcoatfatean s t  etrxo3oudlpte nvs s s2urxr ;u4olx ii3tyd mDrl(vs;t) etnxo tadopte uvi s  exr(opny1al n nes sfa2trx p;t1apeo octytfa2eln p;u0aetnxocoatlmDelnvsls  rurxr3nu4optnmnci tfa2trxroou1aex io3iasla ra(ms;t) etrxoctytfpt aues t) 2toxm io1omtn fctltfa2rr(rpoo0alxoiociytfs emu o;t4aleoxf iotoaDrli i;t tetrxopoo1ll n ictat  rtrurp;o0alt moeiad m eanvp u4trtomo oydfp r ies t seum(rpiy1ale  ivia() rrrxmonu0tee mieiltla2um(vs;t4altrxo3oydfat luvi;t0s2tr(o3iu1op emnet s  2tm(mpou1oex  oeildla2eaumo u0altoio oadomD  uesl( t2xoir no4ame  fvi t  Dtaurpot1oetoiicias s2el(mon(0 lenmrcty1lp eauvs;t0 eur(opoy1amt lfesat)sDtm( pou1opeo fetysla emn p ()tlxoxo iatoptelnei (0s2xrir nodom emiei s)sDumxr ;u0altn oeiltlsDulnmsnu4alermo3ia1lm ean i;()sexm(rpno1am  mivt s) rrau oou4tptniociydfm2ulnvo u4trenxfctytlmt lu sls s2urxopiudoltn icsl()arum(moot0alxnmoeild sDuauvonu0aexoif oytlp rli sl()texoxopoo4lpt mivta()sDua( pnu4teto oeiadlm2elnvo;t4aeermo3iytla   nesl(  ruoxrpoo1om nmfetas aDur( p;u4opx mfctytfaDelums;u0aetrxf oytoptean o;s trtrir3nu1lpe lnci tfs2raxr nt4olenifciasfa2em( p;()artomo3tytlatrauei (  rumir nudlmen fvtl() rraxmp;t1tpxo ictlsfs2ulumo (4 rtomfciydlmtrlnvi;t)sruoir oo1llenmfvtltf 2umxmp;o4optnmi3tltlsDulumo t4arxomr oydopD au i;t) 2um(r iodlp  mieia( srrm(rpot0apeniiciyd a2umnvont4tltnmo oy1opDraues (0sexrir ny4am   net tf 2rrxrpou4oet mfciytfs ul(ms;(4 leoio3oadfaD aivo;(0 ruo(o iodom e neia( a2rmx pno4aptn oeiatfmDuauvp u4 rxnir oy1omteaneols  rxmimpiudopen fet (f Dur(mo;u1ole mf3ilsls2rln s;u0trxrirciodopD  i s;s) 2xrio iudlm e ivilt)sDtmu p;u1oetomi3tltfaDrlnmpnu)artomr3oadoaDr ivi s)teuoimpio4ll n iesa(f Dtrxm ;t4aeto i3tlsfm ranvs t0treoxo tatomDrlivolt) 2xmir ny1am   nvi s s2taxm ;o0ale mf3iat m emump;t4tetrmf oa1lat ai ils) etrir3iy4apenmnetas)a2tmur no4ale  fetadla elnmsnt0 exoxociadlmtrlnesl( t2xmxo iy1aptnmneils)srrrxmpnt1opeomieiltlm2ean ont4aexnmociotoaD livs (0srxoxm3ou4omenlfet s  2tmxmoot4opxoiieiltlmDrm(vp t)trxoircootfpDelnei;t  rtoio3no4lltnlnvsltfa2rr(m ;o0tpxoii3ildfm elumo (0areoir3io1fp   ues;( setr(m ou4ll  mnvtl(  2tm(m nu1tptoiietatla ulnmo;t)alxnmr3iydfmDrln o;s  rxr(mpoodllenlfcsatfarrm(rpno0apxomociys mDem(vs (0aleomf3oydfaDe u o;t trxmxrpoo1ll  lies tfs2ururo;t4alt  fciasfs2emu s;()artnxr3iy1fm rlnvo;t0 2to(o3oydlm  mfeslt) Dtau  ou0teeomiciysfaDum(vsnt4tetnxr3io1fatrlieo;t0sexoxopio1lpte nvils)aruau pnt0tpenmo3iadlmDrlumon()arermf3iadlatelivol(0 2xmxopoodamt lncsat)s2urxmoou1oleniieilsls emnmsnu4texnxo oodlmD  n il()trxr(rpio1amtelfvslsfarua(m ;u0aptnmf3iytfsDemnms () rtrmf oo1omt livols sruoxopny4llee feilsfsDumu  oo1tpxomoeiydlm ea( o;t4tltnmo iydfa rluvols trxr(r3iy1apee fcilsfs2tax p;o4texoiociat s ranvp;u0teenmociytlateanes;t)t2trxr3oo4olteliet tfa2ua( pot1aexomo3tyslmDeauvsnt)aleoxrcto1opDelnvo () rurio ou4omtemfvs tf 2trx pot4aex if3tyt m2el( o u) etnmr oodlp rli s s) 2umirpou1ale mfvtas)srrm(ro;u1tpt ioeildlm rl(mon(0trtomrcoydfpt  uei (  2uoxmpiu1lmtnmfei t)s2tau pou4oetn o3iatls2rl( p (0 etnmf3io1fmtranes;s0texmiopoydame  nvslsf ruaxm ou1oltnmicild a emumo;(4trtrxr iy1omDrauvsls) 2tmxo3oy1lp nlncsatf 2rmxr ;u0tpeomfeild s2elnmont4artrir iydlat ai s t)teumxo iy4lltelfvtls) Drmx oot4tpeomicild mDulnms u0aexoiocoy1laDe iesl( t2tmir3oudlp n ietls)aDuaum ;t1apt ifctlslsDea(msnt0arermf totlmt li ils0srumxr3oo1lm nlieil(farrmum ot1aleomicildlm2em(vsnt0altoxo3iodfa ranei;s)trxo(r no1amt  ncia(faDumxroot4tpx ii3iysfa raump;()texrmfcoa1lpD lieo;( teurxmpny1ap nmict tf Durx  ou0aee mi3tldlsDrl(mo () ltnxoctadopDrluvs;t0srxmxm iu1optemneias)sDurx  ;u0apxnmociydfaDum(vs (0tlxoxf3io1lpD li o;()s2xm(o3nu4ame  ivi t arrmxmp;u0oexn ictyd s2ra( snu)altnmrciadlmte uvsl( trtmim ny4lmeemfcslt) Dtm(  nu1altnmfeiys s2eauvsn()tltoxo3tydfate uvols0t2xoio3iydol  lici sf 2rau  ;t0opx ioctas m rl(vp (4aleomrcta1fmDeaneo;t0s2um(rpny1oltelfcs t  2um( poo0alx mo3iysfm raumo t4treoxf3oadfa elneo s  rxr(r3iu4omtelfetat a2tau p;u0apxomfciyt s2rl( s;u0alerir ty1lm eauvsl(0tetrxm3ny4am elfesas)aDta( pno4aptnmo3iat s ulums (0aetrxo3oo1fpD  n slt0trtr(o nodlpt  nci t s2urx p;t4oeenmoetlsfa2eauvpn(4trtrmrcio1fatr neo t0setrxo iy4lpee nes t)artmx  nu1tle  i3tys s uanvp () rxrxrcty1fpD an s s0 2tmir3iu1omtn fvs s) Dumx  ou4aee  feiasfa2umuvo t)alxrxrctadfmD lnei;()t2urir3iy1oltnmics sfa2rm( p;t0tleomoctytlm2rau onu4tetnxoctodomD an i;(0texrio iu1oleelnci tfsDra(mpot0tpxniiciasfs2uluvp u0 etoxo oatopt aiei;t  eumxopiudapeemnei t aruaxr no0tpe mociysfsDrln s t0altnmfcio1la  lnvs;(0setrimpoo1op  mncsa() rur(  ;u0tlxoio3iyd s em(mpnt)alenxo3iy1om  au ils  2xrxr iydam  mnvs s sDrm(  ;t0apto fctyt sDrm(mon()trtrif ty1opt  ueo s0setoxrpiydopeemfctlt  Dur( p;t1opx mietas s2um(ms t0tltrmr oytfmtrlues (  2tm(r3iy1altnlfesl( srurumono0alxomiciatlmDraumonu)tlxrmr iydomD au i;s  rumio no1lltn feilt  2rru pot1aeenifeiys sDuluvs;u0 eeoxocty1oaD lueol(0s2uo(r3io4opt mictat  2ta(  nt4alx  i3iytfm um(mp (4 lxrmo todomD liei ( t2tm(mpnu1lmtnlfvsas  2ururpno4tpe mfciad mDuau sn(4teenxr3oadlateaueo t texmim no1ap emivtltf 2rr( pou0oeeo oeils mDumuvp t0teerxocty1fpDeanvi;s0srtrxr3iu1amt  ics tfa2tmxront1tpto o3iad s uauvpn()tlxrio ty1om ran s t0 2xmio oydlmtnmieta(f Durum oo0oet  icilslmDul(vsnt4tleoxo oodom e ies;t0teur(m3oo4llen ncs (f Drr(mp;t4alenifctyt m umnvs ()tltrxfcoy1lmtr n olt  rxmir iudaleemfvt sfs2urumpou0open ieildlsDrm(mo;()tltoif3tadom rauei;( seur(r3ou1altemfvsltf rum(rpnu0apxomf3iys a2ua(vs;(0 eenircoydopDr ivo;(  euo(opiydamee fvs (f 2uaurpoo0tlt io3iyt a2uanmon(0 ltnif iotfpt au ils0 eur(o iudop n ncs (f rtaxro;t1opeoifciysfm2emumo;u)artoir iatop r ivslt0teum(r no4ape lfet tf 2uax oot0ole moetydfmDrmums u0artoio tytlm e u ols0setoxmpoudll nlnvt s sDtru  ;u4oet  oetyd aDulu pn() leomfciydlpt  uvi s)s2xrxmpiodome lnei sf Dur(  ;o4alx  i3tat mDul( onu4texrmo3todfptrauvs ( t2to(mpoo1omt  fcsa(fsDuax  no0texniietasfa2rmnmo t)teerif to1fmD aies t)teur(m3oo1oltelietls  rrrxmo;u4ope mi3ilsla ul(vo (4 rerxocoydoptranvslt0t2xrxm oo1op  mictas)s2ua( o;u4alxo fciyt m emuvo;u4tetoxf totlaDraneo t)s2to(rpnydalte ieia( sDurxrp;u1aleniociys a2eau s;t4 leoir ia1omD  ivo;s t2xoxm nu4amenlfes t)sDrrur ;t1alenmocilsfmDul(msn(0altnio oodfptrliei (0setm(opoudom elivt s)arum(r no4tpenmictatla eluvo t4tlermf oo1fa   nei;s s2xoxm no4lp nmiciat sDurx  ;o1apxn fcils mDranvo u)trtoxf3iatfpt aiesls0srxoxm3iudalt lnvsasfsDra(mp;o1apeomiciysfaDeauvs u4arermocty1lmte nesl( s2to(o3iudop  lieslt a2rrum ;o0tptn iciatfmDemnvsnt)arxoio iodlm elu i;(0t2umxm oydaltnlfvsat)aruaurp;o0aexn f3iltlm ul(mo;t4 lxomo oy1fm  lueo t)s2ur(m3oudap  livsa() 2tr(mpot0oee iiciadls2ra(mp u4tlxnxf oy1opte n i ( seurim3ou1lmt  ivsls)srtau oot4tlto i3iysls2rmumo;t) lenir3todomDelivi;t tetoirpnu4ap nmics ( aDumur ;t1apeomieiltfaDrau sn()treoxrciadlmD aieil() etr(rpnydamt  fcs sfa2umuronu4tlxoio3ilt mDua(vp;(0trtrmo3ta1fa   nvo;t)t2xoxm3io4amtelfeslt srtrxm oo1tlenmociyt m ulnms;t) rtoifcoo1faDe n o ( t2uoim iodalenlfci s)aDrau  nt1aee mi3iasls ul( pn(0 etnmf oa1omD  nvo ( sruoiopno1ll emfesas a2tm( onu0oee ii3iadfmDemn p t)alxomr iodlpteanvi;()sexo(rpoydapt liesa(f 2urum no0tpxnioeiasla rm( p;(0altomr oodomD anvols0srxm(m3oy1ll  lfvi (fsrtaum ou4tptoii3tld s2uaums;t4tltnmo ootoa r i o s)s2uoimpoodlmeelnesltfartaxm nu1olt miciydla2ul(vp u4trtoio3oydom rln i;t)sexr(rpnodom n fvtatf Dtax  oo0apx moeiydla eanmont4teenmf oodlpDr uei;t0trtr(o3ny4llee ivsl()a2tm(m nt0opx mf3tlt a rm( s;()altrmo3totop eaneil() etoir ou4al e fet (  rumu  nu0tlt mfciydls rmuvo t0arenxr3oydfm eaivi;() euoxo no4omt mnci s sDtr(r ot0alxo fciytla2rl( on() lermr3iotfat  nei ()s2tmim3oo4om elnvi (  2umurpnu0oeenif3iyt aDulumpnu)arxrif tydfa raieol(0sexo(o oo1ome  fesls)srtm(rpnu4aetnmoctydfsDeluvon(4aetrmfcta1latraieols)setoxr3oo4apenlfvil(  ruaumo;u0altnmocilsfa uan o (4trxoif to1omt aiei;s0truo(r3nudalt lfvtlt  Dtru ooo0oetnioeils sDumn s;u0 lenir to1op eau olt  etr(mpiu4oltn ncs (fsrtax pnu1olx  fetltfa2em( o;u4aexnmo ta1faD aivs;t)trxrxmpny1omeelfcsa( sDrrum ;u0olto feiltfaDel(mo;t4 rxomrcoy1lp e ueil()seumio3oydalen ietl(  rtmx  ;t4tex ii3ild a2umuvp u0 exoxf3oydlm ranvo;s0srum(rpno4omtn ivias  2tr(monu1texnio3ild mDum(ms t4tltrmo tatoptraivi;t0t2toxr3no1amtelfvils arrr(r ;t4oeeo fcils a2ean o t0tlxrxr3to1fmD lieo;s)t2xrim nydal nmnvs tfs2rrumo;u4oeenmietyt s rlnvp;u)arxnmo3ootlp e ivsl(0teurxmpoydaltnmfetasfsDurx  no4tle  f3iasfsDel(vonu)altrmf3iadomtr uvi;( tetoim3nodam  mfci s) 2tmu pnu4aee  ietat s2emumpnt)trtrmfctodfmt li i;t  2xmxr3iodlm e netlt sruau onu0tpenifetaslmDuaums;u4aetnmr iotla ran i s  2triopiu1ame  feslt s2uax pou0opt ifctatfs ra(vo;u4aexrxo3ootop e n s;s0 rto(rpoydalee fvils aDurx o;u1aetn i3tas a um(vp u)aeerxr3tytoa  li o;s0setrio no1lmt mfctas)artax onu0tlxoifetld a rlumont4alenmf3iodfptelnvi;(0 2xmxm3oy1am elfvils) Dtrump;u4oeenmi3tldfaDumn onu0arxoxr3iadlatranvs;s0trxmxopoudoptemfesat aDrr(m ;o1oetn ieiadfs2uau s u)teeoxo3oy1lptelnei t texoxm3iu4omte nesls s2tm( pnu4opt  fetaslsDrln pnt) lenmo iadfaD auvs t) 2xr(mpnu4lpt mietasfartrur ou1tptomfciad m2rmnvp t0 rxniociytom r u i;t)texrir ou4ap nlies (f Dtau oou4ole miciat sDrluvp t)aeeomrciy1opteluei;s texoxr3oo4apte fesa()arua(  ot1aet ioetlslmDrlnms;u0trtomr oytoaD lnvslt0 etoxm3ou4lm e fvta(  Dum(mpnu4ale  oeiadla2um(vo;(0 rtnxo3oydfmD ln s (  2xmxrpoydalee fvtl(fartax pou4aptoifetatla2ua( p u0 exrmr tadfat lnvi s  2umxm3oo4optelnvi t s2ta(  nt4opxniictlsla2uau o t) eenxo3iodfmteauvols)trxoiopiudamtnlnvs (farumumont4oee iietltlmDrluvs;(4teenmf tytla  ai olt truoxm iydll   iei t) 2taxr oo1oleomociytfmDrl( p u)alerxf3iatom   ivs t)t2trxmpiydap emnesat)srta(  ;u0oee  iciyslm em( o;(4artnmo todoa eaieslt)trto(mpoo4alte ivsa(fa2ur(m oo0aex  ieilsfs ua( o (0tleoxrctatla e i olt  rtmir no4lltelnciasf Drm(  ot0olenmociatfa umu p;t0alxrxociatom   uvi t seumxr3oy1amtnmfct () 2rrxm ot4oeto f3iytfm um(vp u0teeoxf3iodlmDrlneo;(0 eto(o3io4amt  fvsa(fsDrr( pou4aeto ieiasfmDeau s t)tlxnmf3to1la eai i () ruo(opiy4opeelicslt)sDrmurpou0teto ictas s emn onu) eeomf oo1omDe ivi;t)tetoio3oydamenlfvtlt aDtaumpno0apxn ictydlaDuan pn(0artomo3iadla e i sls  euo(r iydal  licta(f 2tmx o;t1tpx  ieiyd s2rluvonu)artrxo3oydfaDeauvi (  rxrim oy1ol  mnct sfa2taxrpno0oee miciytlmDuau s u) rtnio3totlm e nvo;( t2xr(r3nydlptnmfet tf 2um(mp;t1tle ifetyd sDua(vpn(0tlxniociytfptr ivolt  etoxm3iydopte fvia()a2rm(ro;t1alx mf3iltlaDeauvo t4 exoxfcoatfpD ln o s sexr(m oydlmeemfcia(  2urx pou1oexnmoeiyd mDrm( snu)aetnif tydfm rai il( t2tmio oydll   nct s)a2um(r oo1oeeo f3iatlaDulumonu) lxnxociodoaDr ieo ( trxmxrpoy1llenlncs ()s2uax oou0opt mfeiyslm em( on(0 rtrxfcoadlmD anvs;(0 2ur(r nu4op n ictlsfsDumxmpot1oleomicilslm ra(mo;u) exoir iatomDr ivo (  ruo(m3oy1lmtnmneils)arrrur ou0ole ioeildls2el(mp t4aetnir oodfmtelivo;t trxmiopoy4ll  mieilsfa2ra( poo0opxomietadfm2ulnvs;(0aetoio3to1lp rln ilt0s2xrxo no4ll e fetas)aDtr(monu4texomfciltls umuvo;(0arxrxo3iotfaDeli o t trtr(m3oodlpee nci sfs2trxrp;o4olxo f3iatla2rmn p;()aleoio oatfmD  u il( t2xm(r3oy4olen ivt () rur( pou0apx mo3ias m2umu p;u)tetnir ta1oatr ueilt0t2uoxm io1lltn ictas)arta(mp;o1teeomfcildfs umu pnt) ltrmrctodfm eluesl(0s2uoim3ny4optn ies s s2raump;u4tetn fcildfaDemuvs (4aleoxfcto1fmDrlu s t0 eto(r iy1am   nctat)a2ur(mpot0oeeomociad a2rm( s t4aexomo3todfm rlueo s)trum(rpoydoltn fviat)s2ur( ont4teeo i3tasfs raums u0trxrmf todfm eanvs s s2urxr iudom  mivsls  Dta(rpnt1olt mieiasfs rmums;(0tetoifctadlpDrlnvil(0trtr(o3iy4lp e fei s) rtrx pnu4apx iociydfm emnvo;t4 rerif ta1omtrauvi;t)truo(m3ny4ap   neias a2ra(rooo0teeo f3tls a rmnms u) ltnmfcoa1fa rlu i t0 rxoim oydlp   nes ( srrrxro;u1opt mi3tydlmDul( o;t0tleoir3ia1opt auvs;( trxo(o iy4lpe mivt tf 2tmx  ;t4aleomieiys a em(vs (4 rtnifcio1fp  aivo s0 eum(m nudopte ivt t)arua( onu0texoio3iltfa2eluvp t0alxoir3tytlmDe ues;t0s2xo(o oy1ol emncsa( srumxroou0tpt ifciltfa2rl(vp;u4tetrmr3tadfaDelu il()tetoiopoy4ole  nvsl( artmum ;u1ole io3iatfs ua( s;(4 rxomr tadlmt aueolt)t2toim3nu4opt  nciasfaDtauront4altn fciysfm uaums u0tetrir iadlmDrlueo t)sruoio iu1ameemfvt s)s2tmum oo4olxnmiciytla rmnmp;t4altrif oatfp rlu i (0s2um(o iu4opte ncta(f 2ta(mpoo1olxn o3iasfa rmumpn(0 rxomo3oa1fpDelueils trto(r oo1amt lfei s)arta(m ;u1aetnmfctlsla rlnvp t4 reoir3todlp r ues;t  rxr(r3oy4omtnlnci () 2tmu p;o0tlx  ictls aDua( snu) eeomr tatom eliei (0tetrxr iy1alt livia()aDumuroot1aeenmo3iatfa2uluvs;u)aexomf3iydopt aueils sexoiopou1omee ieslt arra(mpou4oex mf3iydla2um( p t4tltrxo tadfaDr ies;s0s2tr(opou4ope lfct ()s2tmxm ;o4aptomiciltlmDelu s u4tlenxfctytomD auvi;s  2uoirpiy1op  lfvi s)sDtrx o;t4optnmociyt aDeln o (0tlxoxf3ty1laDeanei;( trurirpoudol   ivt sf Duaump;t1oeeo fciltfs eau p (4 exrifcoa1fa  luei;s  eto(rpiy1olte fvi ()srtm(roou1tlt io3iydlm2ea(mo;t0 rxrxocoodop rlivs;t)texr(mpiudom n iet s s2ur( pno1teeniieilsfm eaums;u4aetrif iytoa e neols) ruo(m3iy4lmeemietl(  Dur( o;o4opxn octyslm emnvsnu)alxriocia1oateluvils tetr(o oo4al  mnetl(fsDtr( oou4aeeo fciyd mDumu s (0 renmfciodomDrlies t0sexrimpoydllt mnes s srrau p;u4tet ii3tadla ul(mpnu0tlenmo3ty1fpDeaieilt0srum(opiu1ap   iet sfaDrmu onu0tpxnmictld aDua(vp u4alenmocoy1lateaivil(  rxr(rpnydlmtemnei s a2tm(ro;u0apeo ictadfaDul( o;t)altoifcoadfp   iei;s)s2tmirpnu4ap e fes ( arua(m ot1apt mociatlsDuluvs;t) ltnmr3oadfp rlnvs;(0texr(m iydol elfcsls  2rm(root0aetoiieiyslsDum(vs (0 exnmoctydlatr uvols0t2umim oy1amtnmfeilsf 2rm(roou4tpe  i3tyd s2uau o;(4aetoxo tydfmte u slt)t2toxrpno4ol n fcs tf Dtmxm nt4oee mf3ild sDumnvo t0 lxnmocty1fmteanvol( setmxrpnodamee fvil() 2trurp;o4aet ii3tysfm emu sn(4aeeoxr3iodlat  iei (  2um(rpiodaptn nctls  ruru pnt0tle  f3tlsfa2rmnms;t4tleniocty1fm rlu il( srto(o3ny4altemnvi s  2rau  ;o0tetoiociad a2umn on()tlxrifcoa1fat  n i s0trur(mpnu4altnlfvtl(faDuru ono4tptnmo3iyd s2elnmp t)tlxnxociotopDrlnvi;( s2uoimpiy1amtnmfvias srra(rp;u4tpxo octat aDelu pnt4altrxocoy1laDe uvolt) 2toxm3iu1ole lfei (fs2rmumpnu0aleo ieildfa2uanvs;u)tleoxf totfaDe uei t0 2tr(rpoy1lpeemfvils s2rm(r nu0apxnmicilslaDum( o t4arenmf iadoaDe nei s sexoiopou4lm e fci (  2trx pou4tpto ieild aDelnms t4aexrmo3oy1fm r uvi;()trumxr iydaltn nvtlt)s2ur(m ou0ope ifctld m2ra( o t0 rxnif3oa1oaDrai s s0s2xoxr3iudlpte icilt  2rm( o;u0alxn fcilslsDeau p u)artrxfctotfatr i ilt0 2xo(m3oudal e fvtat  rumumpno0aexo ieildfm rlnvp;t0trxnmrcoytoat  ieo s) rtmir oy4llen ivtltfaDta(m oo1aee  oeilt sDua(ms;u0 eenif to1lpDelueslt setmir ou4openmfcsls srumx  ou4oexomf3iyslmDrm(von(4aeeoif3iadopDran i (0seum(m3nu4al  mnvilsfa2ua(mpot1tle  ictysfm rl(vs;(4texnir3io1lpt aues s0srxoxrpoo4oltemncsls)s2ua(mp;t1tpe mo3iytfsDel(vsnu4tltomr iatlaD aiesls s2xoio nodope lnesa() Dtrx  nt4tpxn i3iyslm2umu ont4tlxrmocoatfmt aneilt  rurxo ou1altn ivt t)sDrrx  oo0aleniocias a em(von(0texnifcio1omt ln o;(0t2xmxopny4ll  lictl( srraur ;o1tltnifcilsfs uln o;(0 rxriociodfm eaneo;s) rtoxm3ny1lmte ieias arrau  nt4opxoii3ias a uauvo u4arxomr oy1lmtrluei s)tetr(m3oodopt mivs tf rrmumpou0opxnifeiytfmDul(mo;u0teerio3todomDeaivo;s setrxopiu1apenmivtl()s2tauroou4openio3iyd s2ua( pnt4aeeomoctatopDrlueo;t0t2tr(o3io4omtelnvtls) Draur nu1oeto fcilsls uan s;u0artnxfcoodlmtr ieils0s2toio3nu1op elnvt (faDum(rpot4ope ii3iadlm2uau on(4 rtnmrcoo1lpDrli o;t)t2uo(m3oy1lmenlncils  2rmxmont0tlen o3iadfm ua( p t4aeerxr iadfmDrau s;t0s2uoim oy1llee ncs s) rtrx  nt0opeo fctytls2uluvo u0 rtoircoydoptrli o t  eumxo no1lm nmicta(fartrxmpoo0alen i3iyt a2umu p;t0 ltniocootlateln sls)setm(o3io4olenmieias srtrumo;t1oexnmo3iytfmDem(mpn(0trxnmr3oodla elues;(  2toim nu1amt lfet s)s2umx o;u0alx io3tltlaDeanmont0teermocoydla  lueil(  2trim oy1op emfctlsf rtaxr oo0aptniiciadlmDumu o;t0arxnxociatfate nesls) exmio oydamt mfvs t)s2rmx pou1altn f3ildfa2ranvs t4aetnif to1omDe u il() 2tmxm3ou1ole mfeta(fsruaxmont0oexniictyt s ua( o u4trxnxocto1late ieo ()s2xo(r3no4lpt mnctas)aDtaxr nt4teeomi3tys a rlu onu4 reoxf to1fa r i i (0seuoxr io1op elieta()aDrr(mpou0aet ifctyslm ulnvo () rtoif oatoaDr nvs;t)texrxm nudap elictas)srum( ont1oeenmoeiad s elumpn() etnir oydop   ueolt texoxm3ou4lle  ivsat a2rr( p;o0aex  icilsla2rlnvsnt)tetomrciatfaDrlnes;t0srurim3ou4lmenmnvtl()aDraurooo4openmoeiadla eaump t4aeenxf3oydfmtrliei (0teuo(rpnu1ap n iet t)arumx o;u4tpeomociydlaDrmumo () lenifciy1fpt  ivils trxoxm nu1amte feslsfaDraurpno1tpt ioeiadlaDrl(mp ()altrirciy1fmte uvs;( t2uoxopiu1lp emfcsl()a2um(r ou4tltn feild aDum(vp u0aetnxo tytfm rlnvo;s  etoxo3iu4amt lfci (fa2rm( p;o0olto i3iydlm uluvs;(4treomo iodomDe ivs s0truoxrpny1ll nliesl(faDrmxmp;t4aexn fciat a um(ms;()alxnxo iy1laD  n i s0trtr(r3nodamt mfvi t sDraxmo;u1tlxomfeiaslsDranmsn(0tltoxf iotlmt aueo (0t2xm(o3iu1omtnlicias aDtmx pno1texo fciatlm rmuvp u) exnmf oatoa  livs (0trtm(m3oy1lm  mics t)artm(rp;o4tlx  i3iadfs ran o;t4 rermo io1fp   i i;t0t2urxrpiudapee nctas aDtmx pou1alx ioeiasfm2em(mon(4tlxnircoadlpte ivs;t0srurirpnydopee ictlt)srtax pno1aex ifciatls umu s u0 reoif oatfmDeli i;s)teurxo nu1op elfesl(f Dtrum no4tlenif3iltfa ranvo;u0aetrifcoydom rauvs;s0trurir io1optnmnvtas srtm(ro;o1tpxoif3ildlm rau pnu)alerxrciatom rliei s0t2trimpiu4optelneils)s2uru  ot1opt mi3tls a2rl(mpnu0trtrif3oadfmDeanvilt srxm(r3oo4apt  iesltfa2rm(rpnu4alx mi3ilsfsDranmp t0texnxr3iytopDeauvols t2urir iudale mfcs sfs2trxm ou0oexnii3iyt m ranvo u4alerif oo1faDeauei;s0 2to(m3nudlltemnvtl()arur(m ;t0tpeoiicilsfm2ul(vont)aetnif3iodomDeli slt) rtrim3io4ole lncsls  2urxmpot4opeo o3tadfs2rmumo;(4 rtoir3ta1lpDraiei;s srxo(m ny4lmte fcia(f 2trx poo0olxomfctldfaDrl(monu)aexrmocta1oa eaueol(0 exrimpnydal n fvt t)arumumpoo4tpeo o3tasfsDuau o t)tleomf3oa1lmD  i o s)trtoxo iudll nmnctasfa2ua(mpnu0teeo feiysfa ranms;u0aetoiocoatomtrlivsls t2umxo3ou4lmtelneta( s2ra(monu1oleoioctldls eln on(4 etrif3ta1lateauei t0texriopoudam elfciat)s2urxmp;o4teenmo3iysfsDeanvs t0aetrmf3iydfmt lies;s)seumirpoodoptnlnci t srtrx  ;u1opxomiciatfs2rm( sn()aleoxfcoodomt  i slt)s2umxopou1lle mnvsls srtaurpnt4ale iicias mDemu p t)areomf3oodfmD anvi s) rtmxo nydopt mfcsat  rraumo;t1tlx mietadfmDemnvo t0tetoio ootfm ean o s  2xoxm3ny4ome mfei t) 2urxrp;u1apeo o3tytfs2ea( p t0 lxrifciydlpDraueils s2urio3no4ol emnvtltfsrtmx ooo4tex ii3tys s rmnvo;u4tlerxocoo1omD livi (  exmxm3iudoltelfvsas arururoot1tpxnmi3tydfm uan s u0 rtrmfcoytlpt  i slt)trtmim3nudop n fesat)srrau  nt0altn o3iltfm rmumo;(4tetrxo3tatfmt lueo;(0seumio oo1amenmnes () Drru ont4olxniiciytlmDuau sn()aetnxf ia1opDrauvo (  euoir io1lp  mnes s sDtrum ;t4tpe iociydlm rm( ont4 lxrxo3ootomteln i s0 exo(m3iu1al emiciat s2tru ono4ape mfetldfmDra(ms t4tltnmrcio1lm  an i t s2xmxr oydamtnmnes (fsrtmu  ;u0tlenifctls a ea(mp t)tltrircio1fmt  uvils srxmxm3io4oltn iet t s2tmurono4oltnif3iydla2rm( o t4trxnxf iytoaDeanes t  2umxo iodop emfvi (  rtm(  ot1aexnmfeiyt aDea( o t) lenio3io1fmDrlnvslt texriopiudomen fetlt) 2umu p;o0oeen fctyt m el(von()teeoxr io1fm e iesl( seto(o3io4oltn nvta(fs2tm( pno4apxo ictadfsDulnvont4arxnif3iytlmDelnvi s0trtrir oudape  fvtltf 2trxr ;u0opt  octas m2uluvo t0 lenif oytlmtelu o t0 etr(m3ou1ol elneilt)srtaumont0oeeo o3iasla2emn pnu0aexrif tadop e ivsls)srxoiopnodap emnesl()a2ta(r nt4alxnifetadla2em( s (0alermf3iotom ranvo (0texr(mpny1ole lnvi (  2rax onu4tle io3tyslm el( s t4trtnifcoy1oa   nei;s)srtm(o nu1lltnlietlt)aDtm(  ;t0opxnmoeiadlaDeluvo (0artomo oadfat ln ols)t2ur(r io1ol nmfcta() 2tau  ;o1tlxnmfciadlm ra(von(4 eeoxfcoy1omD li olt)trumxr3nu4ll nmfcsat artmur ;t4oetoioetltlm2eln s;t)aeeoir iy1omt livi;t srtmxrpoudll elivta()sDur(ro;o1aet mfciys a2ranvo;() eeomrcootfmtr n s;t seumxmpnu1aleemiet s srraxr ;o1apx  f3iadfs uanmonu0 etnxr iy1om rlivi;t)sexrxm3nydlpeeliet sf 2umumonu0apxnifeiytla uln s;(0 rxrmfciotomtrai ol()trxoxr3iu4omenmfvsls)sDtaxm ot0altn ociyt a2ul(mpnu0tetnir3tydoa rln i t0teur(m ou4alenmfctasf 2rmxrpnt0teeniiciaslm emnvpnu0 etrxr3iodoptr ivo;() 2trxo no1am  liei t) rtru onu4alx  i3iyt a ra(vo;u0 rerir3iatoa  luvils  rurimpou4omeemict tfa2uaxrpnt4tpxoiiciadfsDra(vo (4teenif tydfmDran ol() 2toio iy4lpenlfvil()artm(m ot1aeen iciat m2rmn pnu0arenio3totfaDran olt)s2trxo nudlme livt s)aDtmum ;o1tleoifeilsfs2rlnvp;t4treoxfcta1latelnei (0t2to(m iudopenlivi (faDurumo;u0altoifetltla umumsnt4tltriocoo1la rlu sls) 2uoxr oodlmtelieta(  Dur(r ;u4oeeoif3tatfm uan snu4 exnmo3ta1omD  nei;t)trtm(r iodome mictl(farra(r ;u4texo octytlaDumu onu4 exomr iytfat lnes;t) eur(r3iu4altelivsltf 2umxmoot4tptomi3tysfaDuaums t0arenir iy1fatraues;s)s2xrxm3nodlpe mnvt ()sDumxmpnt0optomfciasfs2emump;u4arerio3oa1oaDrluvslt0t2xoxopny4op e ivils  rtm(r ;t4apt mf3ild a rlnvo;u4tetrio iydomDeluvo t t2tmim oo4optnlfcsa( s2ua(  ;t4oee  f3iyt s2ul(vont) rxoiocty1la e nes;t truoxrpnodllen fciat sDum(mpou4tltnmi3tysla2rm( p;() etrxfctatoa rlnvo;(0 exmxr nudop   icsat)aDraumooo0texomo3iltlm ul( o u0arxrmo3tydfpt ai s;t  rumxo3oy1om elivs s)sDrr(  nu1alt if3tls a umn on(0arenmo oadlmD aivsls)srtoio ny1lmtnmneias srtm( p;o1tptnif3iadlaDua(msnt4arxrxf3io1om eaueo ( t2toir nu4lpee ivsls) rtauro;t1oexnmoetadfs2ua(vs;t) etnir3oy1lpD  ivi ( srum(opoodlm   net sf 2rru o;o4opt ifciydfs uanvs u0 rxoio3tytoptrlneslt) 2xrxm3iu4lptn fctatf 2rruronu1oltomfciydlm2ra(vp t4aeeniociadoaDelu i;s  2toxo3iy1amen ictl(f 2ra(mo;o4aeeo f3ilsla el(mpnt)aetomociytom  aueolt  rto(m3iu4lptnmnei (fartax p;o0apeo f3iasfa emumsn(4trtrxf3iotlptrlieo t0teuo(r iu1lmenlncs s aDrmxroot4tpt mfciytla elumont0alerio tytopDraueo (0texr(o3iydamee ict ()s2rax p;u0aetn oeiatfa ulu onu0 leomo iotom rlnvolt)trumxrpou4om e iciatfsrta(  ot1alx  oeiltfaDemumont)tlxoxf3ia1lpDrln slt setoxopoydap  mfcsl(f 2ua(mono4tlxnif3ilt m umnvpn() exnxr3oatfpDranvil(0setmxr iydolt  ies s) 2urxmo;t1alxomfciydls eanvo u4 reoxoctotomDr uvo (0 exmimpoydlp emnvsltfs2ra(m no0tlxomociltfm2rln s u0 lxnxo3io1omDeanvs;t srxrxm3iodalen nciat)s2uaump;o1aetn feiysla uanms (0artomf to1lpDraueolt0trtm(mpiu4llen fei ()srraxr oo1aetnifciadfs um(mo u0artrxf totlmtelnvolt0srxmio ny4omtnmnvtasfaDtm( o;o1oexomfciatlm2ranms;u0treoxr to1lmD  iei;s0trtoxmpnu4optnlnvs s) 2tr( pno0tpen i3tls aDrlnms;u4altnif oytlm rlivil() exmxm3iu1lmtemfeil( srtrur ;t1tlx mociasfs ea(mp;u4 ltriociodomDran sl( teum(r nudopeelnei (fs2ua(mo;t1apx ioeiys a el(vsnt0trxoirciodlpDraueslt0 2um(o nodome mfvilt)aDuru  nt1olxoii3iysfa2uauvp;u)arxnmr3tydomDeauvs s setmio oo4ope mieils aDrauroou1ope moeiytlm rm(vs;t4trtrmf3oo1fmteanes;() 2umxm3no4ll elncia(f rum(ronu1ape io3iatfa rmn pnu0trtoxfctytoa rli i;t) rtr(opoo1ap nlfeslsf 2urur no1opto fciltfm2umn s u)alermr3oydfm eai s;s s2tm(opnudom nlfctas a2rau  ;u0altnmictyd aDelu on(0 lenmr iotomt lu s;()trtm(o iu4lp n iciasf rra(mp;o1aleoif3ilslaDemnmo u0tetnxo io1fa elnvi;t) eumio3no4om  mnvsatfarrax ont1tpxomictyt s um(mo t)texrxfciytfa raivi;s s2urir3ou4aleelnviat  Du
\ No newline at end of file
@@ -0,0 +1 @@
+ueil() rur(rpoy4olenmfeilt)sDua(m nu0oltnmfciytlmDulnvsnu4altrmo oy1opDelivi;s)texmio3iy4lmte ncilsfsDurxm ot1aexo f3iydfmDuan s;u0tltomr3todoa ranvo;s0s2umim3no1apenmfvils  2ta(ront0apto i3iatlm2eanmo;t)aeeoir3iytfmt lu o;s0 euriopio1lmtn nesa()srururpoo1ape mi3iytla ua(vo;() lenio iytfmD lnes ( trum(r io1lme  fvs (fs2tr(rpnu1open f3iltlm ean p t0alxnmo iy1op elivs;(0seurim io4opt lfetat)artaxrp;u4ale  fcias s2rlnvo;(4trtnxr3iodomt au i;s0s2xmxo3iu4oleelivsls s2um(m oo0tee  iciltfaDel( o;t)trxnmr tatlmDr ues ()tetoxm3iu1lpt  fesl(fs2ur(mpou4opx ioetadfmDrauvs;u4aexrxf iydla eluvo;( t2xmxopnodlptn fvil() rrm(mpnt4olxo iciysfmDea( p u4alxoio oadla rau i t0t2toim3oudlleemncsltfa2taxrp;o4teeomf3tadfm umnvo;u0teeoxr3oodlmD  ivi;() euoxm3no1am emncsls) 2uaxmo;o1ope mfetltlm eln o;u0alxoir3ia1fpteauvs s) etmxopio1olee fesls srrm( onu1aet  oeiat sDeanvo;() leoxo3ia1opteanvo;s0sexrir3oo1am n iet s srum(r ou1tet  icilt a ra(ms;(4 lerif oy1lmtean ilt) rtrio3iy4lm nlivi sf Dua(r ;o4tltnif3iad m eluvo (0 lxnir tytoaDeaiei;(0 2xoiopio4opt lnvtltfs2rm(mo;o4tpeoii3iadlaDrlnmp;(0treoircty1opt  i s t trtriopoo4omt liei t arrauroot1tee ii3ilslm umuvo (4 rxoxo io1fa  an i;s)texm(r3no4am nlivtl(  rrrx  ot4alenii3iytfm raump;()treoiocootfmDrlivils0seumir no4lme  fvsat s2trxront0aptnmfetltfmDem(vsn(4 exoxrctodlmD anvslt0 2umir3nu1ame mivilt srrmxrp;t0aptnmictytla rl( p;(4aexrmf3iy1opDrln o t) eurxr3iudamenmneia() 2uaxm nt0oet ifeiatfa2rlnmo;(0 rtoxfcoa1om rauvil(0teum(m io1alt lici s  2rmx ooo4aexnii3iyd m rl(vs t4trtrio tytfmDeai s;t)srxo(mpnu4op e iciat)a2rax p;o1aptomfciad mDelnmonu4aeerxr3oa1fptraivo ()setmir3ny1al emicia(  Dtm(m nu0tet mietls s2umums;(4 reoiocoa1opDe u i;() 2xrim ny4lleemnciatfa2tmxrooo4tex  i3iat m rm(von(4 ltrio3tatoateauvs;s0s2uo(mpou1alenmfvt () Dumu pnu1olx  o3iydlm ulnvsnt) ltrmoctytlmt aieol(0 2umim3ou1ll elici t  rra( o;u4teto fctas aDran o;t) leoirciydfmDe n s s s2toim ou4ole mfcsls s2rrxroot1ole io3ildfsDrl(ms t0tlxoio ia1oateaiei;s) etrxrpny1amee fvt ( sDraxr ;u1tptnmoctatls2umn p ()tlxrxfctotfm eauei;() 2xrxmpnydlpt mietatfarraur no1opxoii3iadfa ean pn(4tlerxr3iytfaDeaiesls0tetoirpoodale  ieils arumu  ;t0apt moetytlm uln p (0tetnmf iotoaDe nvo;s0s2xm(o3no4lm   icsatf 2tmu pno0tpxoifeildfm rm(mo;u)teeoxr3tydlm ranvs s0srum(opny4llt  fvils  2rrx  ;t0texnmf3iyt sDel(mp t0 rtnxr oadfpDr ueo (0sexoxo oodoltnmnetl()s2urxmpno1tpeomietlsfsDrmu pn()artnirctotoa ean i (0s2umir io1amtemncsa(fsrrm(ront4olenifctasfmDemuvp t4tltnir3tatfpDrauei (0truo(m3ny4apee nesltfsrurx pou0tpxnii3tlt sDrluvpn()tlermr3todoaD aneilt teuoio nodlpe mnvi tfaDuru  ;u4tpe iictltfmDuln p;u4tlenir3iotoateai ols)trxoxo3iydlmenmfctls  Drrump;o0olt ii3ild m um(vp u)arenir3iadlpDelu i;s  rxo(r ou1al nlfcilt a2trxrp;u0aptn ieiyd a2rlumpnt4tetnxfctotla r u s ( s2xoxm oydoptnlnvil( arrr(rpot4tpxnmo3ildfm2emnvpnt0tltrio ootla e u i ()texoiopiodlm elivils srurxrpot4oltn ociadfs2emn p;u0tetrxr iatfa  lu slt0setrxmpnodom nlivil(fsDuru onu4tltn feiadla2uau o t4tlenif3iytlmDr nvs t0 2xo(mpnu1lmtnmnesatfsDrr(rpot0alxniiciad mDea( p;u0trtrxrcoatfa eaivi;s) etrxmpoudop nlivs t s2uaump;o1optnmiciytla elu o t0tlenir io1faDeluei;() 2trir3ou1apt miciatfarrrxr ot4oetnmf3iyd m2umnvo;t)altrxr iatoatranesl( sexmxm3ou4lm  mivtlt)a2tm(rooo4olx moetyd a rmuvs;(4altrmr3tytopDrluei (0sexrirpny4alte fctl()aDurump;t1oet if3tldfs um(vs () rtoirciatoaDraivs s)trum(m3ny1ape  nvias  2taxmoou4apeoifcild aDuaumo;u0 exomr3iotlpt auvo;(0 2uo(o iu1lle lieta()a2tmx o;t0oltn f3tadfaDum(vo;t)arxrxoctydla  aivolt) rtmiopnu1ap nmncias aDtrumont4tlxniietas aDrmuvsnu0aexnxo iadop eliei;t trtr(mpoy1optnmfes s)aDtau onu1olxomociltfmDea( o;u0artoxfctydlaDelueilt)sexrxo3ny4ol elncs (  2ururont0tpx  o3iaslm2em(vo t)trenirciodlpD an i t  2xoir3iudol emfvs () rrau  nu0oleoio3iat s um(vs;t) eenmfcta1fm   nei;t0texmim3oydop n iei t  2taxrpou1tpxoifeiytlaDrl(vs;t)trxrmf io1omteai ils texoir3iu1ap  lneilt) Dtrur no4tpeo ictyd m2elnvont) rtnxocoytfp rlies s)s2toio oo4ll emfcsat arumx  ;o1tet ifctldls2el(von(0teenmf3iadfaDrluvs;s0srtmim oo1op emncta( aDuaur ;t0opxniictat m rluvs () eenmrctodfpDrlues;t setrxr3oodomenmnvt (  rtaumonu4aexnio3tyd m2rlnvs;()treoxo3iadlpDrli ils0 etm(m3nodop elnctasf rra(mpnu4aex  feiysfs2rm(vo;t)tltrxfciy1fa r neo t)t2uoxr3iu4ol emfes ()srumum ou1texomoetys s2uan snt4 rerif3io1lmD lnei;t0teumxrpoy1aptelnetlsfa2rrurooo0tetnif3iad mDel( snu0texomf3to1fp eli o s) eumxm3ny1llee fvsa(  2tmur ;u1aex  o3iadfm ea( pnu4 eenmr3iodomtr uvils sexr(r3nu1al emnesl( a2rmurono1opx  fctlsfa elnvsn(0trxnxr3to1lmte nei ( t2urirpoo4lp  lies s  2umxm ;t1tpt io3iys m elu o;t4 rxoxfcoadoatran olt)trur(m ny4lmee fvtas a2ua(mo;o4apt moeils m emums u) renmocoodlpDe u s ()t2umimpnu1omeelfvi sfaDumu  ;o0tle  ieils s umnvo;t)teermrcio1fa  lu s ()trxo(r io4alt mici t) rrmx p;u4tee mi3tatlm umn s t4artoxr3oy1oa elu o;s srxmirpno1ol  mfei s srrrurpoo1opxo oeiys a eauvo;t4 renir3iatoatelies s0sexrxo3iodape  fvi s  rrmumpot4ale  fctadlm rlnmont)aexrxocoodlpt  nes s t2umimpiu1om   ivsa(  rtr(  ;t4oetoifciys a2um( sn(0 lerio3oadfp  auvs;() exm(r oo4alenlfetl(fsDuaxroot4optoif3tld s2raumsnu0trerxfcoo1la rluei;()trxo(r nu4lpte fvt t a2raurpou1aeeoioeiytlm2ulu on(4tlxrmf3iadopDeau s t0seuoiopoodapte neiat  2rr(mp;u4tptnmfciltfsDumnvp t)arenmr oy1lpt auvolt0s2to(opou4apenmfvi ()arrrxro;o1tptoif3iat a2umn sn(0treoxo3iytfatrluei s0truoir3nu4ol  lieslsfa2tr(mpot0tpxo o3tltls rmumsn(4arxnxrciadopt  ivi;t)sexoim nu4lpen ietatf 2um(mpot0oexnmo3ilt sDeanms t4alxoir oydom eaueo (0sexm(m3nudll eliesas)aDrrxront4aex ifciasfaDem(mo;u4 ltnif oa1fmtraieo;() rum(m3oudam nmivils artr(monu0tpe  fctlt aDemn s (4aeenir to1lptr ueo;t  etrxo3nodop n nvsatf Drru pnu4alt  f3ildlm ua( pnu0 lxrirctatlaDran sls0texoir3nodolee icilsfsDra(moot1optn octld aDum(mpnt)tlxnmr3ty1faDe ies;( trurimpou4op nmfei s) 2taxrono1oexo f3tas a2emnmp t0 rtnmo iydfptr nvs t)s2urim3iodlmtnmnes t aDtaump;t4tetniiciasfaDrmn s u4teenifctotlp eluvi;()trxm(m3nodal  micslt a2tauro;o1teen ieiyd s rl( s ()aetnirciytlmD  iei s0s2toio iudll nlivtat) Duau oot0oeeo f3iadla ulu pn()trtnir3iydfptr ivslt0s2tm(r ny4lmtemnciat) rurump;t0apenifeiydlaDemuvo t4 eeomrcta1om e ivo;()s2umxmpou4olenmivt s  ruaxm ;o4oeeo ieiatls2rau snu4aetnir ty1lm eau s;(  eurxr3iy1am  lfviltfaDumum ;u1oleoiiciatla uluvon()alenio3oa1faDe u o;t)sruo(m nu1lltn neslt)aDta( oou1opx mfctatfm2umn s;t4aetnxf3oydlmD lieil()s2ur(mpnydol   ics tfsrur( o;t1apenifetytls2rlu ont0tltomo3totoaD an i;s  2xrxopoudop  lnvtl(fartrxmont4ale mfciltla2umump ()tetnir3oadlm ranvils  rto(rpnu4lmte netltf 2rm( pno0optn ieiat m em( o u4trxoxo oo1omteln i;s tetrir3ny1lmee ncs () Draxmpou4tpx mfeiadls2emn s;t)arxrxrcia1fm eauvil()trxoxm iy1ll e neiat  2rru onu4tlt iictadls el(vs;u)alenxr3oydla  aieil( sexmirpiy4lle  neta() Drruro;u1aet  octyt s em(vsnu)teeoxf3iatfaDe n olt sexmiopnu1lpte ivsat srurxrpnt1olxo oeild s eanms (4texnif3oa1lmDe ueslt0 etoxm nodll  livt (f rtm(r ot4oexoiictad aDelums t) ltrxr3iodlm eau s;s) 2xoxmpoodlmenmieiatf rtr(m ;t1tpxnioetyt aDrluvp;u)altoif3oy1opDeluei ( trxoxm ny4omt mfvtat a2tmxrpnt4aetnmietld s rmuvs;(0tetrmf3to1fatean ils  rxoxopiy1llt  ncsa(f rur(mo;u4olto o3iltla2eauvonu4tlxrmfcoa1om eaivo s)s2xr(o3ou1oltemivsltfaDrmxmono4oltomictas s rmuvon(0 exoir iatomD  n o;t0 2triopio4lltn nei s)aDuau oot4tex iiciydlaDum(von(4arxomf3tatfpDr ues;(0tetriopoodol  mfet (fa2raumpno0aet mo3ias a2ran o u4 eerxf ta1fp  lneols0trtmxo3iydlmtnliesl( aDrmu p;u0opx mfciaslaDuanmo u) eerir oodop  auvo;t  rtoio no1al elfvilsfa2rmumoou1tlxomocilsfaDranms t0 eerxrcootomtelieil( sexo(opnodamtelivtl()sDraurp;t4tlx ifciytfm2rm(vo ()aetnio3totfatraueslt0srxr(r ou4aptnlfeta( s2rmxmpno1apeo f3tydlmDrm(von()aeenxo io1lat lneols)s2uoxo3ny1op nlnvtas srrr( oou4tltoioctlslaDumumo u0aexrmo3oy1omD luesl(0s2trxo3nu4aptn iciasfs2tau  ot4tltn i3iyd mDel(vsn(4alxomf tadlp  li o ( trxm(o ny4omtnmnct ()a2rruronu0altnmfeiyt aDul( snu) rtomo ootlaDe u o t  rtriopiodapeemnes sfarta(mpoo1tpeomoeiad s2rl(von()arxoxo3iadoa  aieils)s2uoio ny4oltnmicils)s2rrxmpot0apen octlt a ua( s u4tltrmf3oadla   nes;()trum(r iudomee ictl(f rrmur nu0tltn ictasfm2el(mont0 rxoxf ty1fm r ueolt)s2tm(rpoo1lpenlfesa() rtrx pou0apxo icilsfm ul(vonu0artoio3iadfaDelivi;s t2uo(rpiy1openlneslt  Dumxrpnt4apt  icildfsDel( o;(4texrio tatoaD ln ils s2uoxo oydomee icsls)aDrr(rp;u4tet io3iysla elnvs (4trermr3oydop   n s t)trtoimpio1ome  ict s)artau o;t0aeeo f3iasla2emnmpn()arxoxr3ty1fpDe nesls t2tmxopoo1ol nlfvt (fs2rm( o;o1alen o3tydla ulnms;u)alxrxf3tytlmteaneo s0tetoimpoo4amtnliviatfsrrr(r nu1tltnmi3iyslsDuln s;(0trerio3iydlaDrai s;s)t2uo(opou1lmtn ictas)srumxm ;u4tpxniictad m eaumsnt0altnmo3oodfpteai i;(  2tr(rpoudlp  mfcsa()aDtruro;u0tle ioetldlaDrl(mont)arxnmrciy1lpDe nvol(0teur(o no4alenlieils)s2tr(rp;t4altoii3iasfm umnmon()teerxr oa1faDrlu i;t0 rtm(m oudapenlncta( aDum(rpou4alx iietytlsDulnmp t0tlxnif ia1oat anvsls)trum(o3ny4ameelnvsa(fs2rrx pou4aleo f3iydfm2uln ont0texrmr3ootlm  aivil()s2xoir3oodopenmfeia( aDtau pou4tlxnmfetasfm rau o (0 etoif3ta1lmtrln s ()teuoim ou1ape  nvt tfs2umu p;o1alxoii3iyt a2uan o ()tetnirctytoaDeln ol( trtrxmpnu4lpenmfctat  rtrumpno4oee mi3tysls2raums (4aetoif3tytlm ranvsls0trtrimpny1apee ivsl()s2uaxrpnu0aee mf3tlt sDul( s;u)tetnmocoodfmteanvs;s0trto(mpnu4op nlivtat sruau  nu1tpt  i3ias s ra(msnu)tltnifciydlpDe u s;()s2xrimpiydopt lneslt aDuaxm no4altn octldfm uanvs;t) rxoxrciotoatrlnvs;(  2xrxm ny1op  lfes (fa2uax pot4alxo f3ilslmDelumsn(4 etoif iotfmt  u sls s2toxo oy4ap elfetat) ruaum ;o1aeto i3iydfs2eauvpnt4aleomrciytom  aueol( sexoxr iudal  micsls  rta(m ot4tleoiocilt a ul(vs (4 ltnio3ootlmDelivil()texmiopiu4lm elies ()arraur ;o0opeo f3ildfs2umuvp;(0 leoxr oydopt anei t0sexmxrpnodol e ivil()aruaxmpnu0aetnmf3ilt s ea( s t0 lxrxociydfpDeau s s t2xrxmpnu4lm emnvtls aDurxm ot1alxnii3tasla ulumpnu4 rxoxfctydfp rlieslt) rxrim iydole  nct (  rtruronu0tltnif3iyt aDuauvs t4teerir oy1opDrauvs s) rxmxopoo1amte nci ()sDuaurpnu0aexoifetatlm ulnmo;t4arxoif tatlm  lnvo;t  euo(o oo4lmt mivt ()a2rr(root1oexo feiat m ulnms t0 lxnxo3ty1fa  li il()s2xoxopiu4omteliesas)arrau  ;o1oleomfeiltlm em(vs;u) lxoxo3iy1fmD anes;t setm(r3iy1ap   fviat)aDur(mpot4aexnio3ildlm2ulnvs;u) exrmrciadlp rlies ( t2tm(o3oudolenliei s)srta(r ;o4tetomoetatls2ulnvonu0aetoir3io1lm r ivo t) exrxr no4ame  fesas  rrru o;t0tlxnmiciasls el(ms (0trxrmf3oadlm r nes t  etrxrpiudap n nviltfsDtrurpoo0texoifctlslsDua( o u0 renio ta1omt  ueo ( teumiopoy4opee fcsls  Drm(ro;t1apxomieiaslm ulnvp;()alxnif3ia1oate u sl( seuo(o3iudaptnmnvtat  rur(mp;t4oetomfeiadla elnvp u4altrir tydoaDe u sls)trumio3nudlm nlneilsfsDumx  ;o4oet iiciyt m2rauvs (0tlerirciy1fmt  nvolt)t2xmxm3iudal   ictlt)a2rrx  nu0aexnmicilt m uaumon()altrmr oytopDr n s;s0trtr(m oydlpenlncia(  Dtauroou0apenmiciat sDeauvs (0teerxrcootfaD anvs t srxmxopnydomee nvt (  Duaum oo0tpx miciltls el( sn(0alermf totom   nvs t) exmim3nudop nmfvias arta(  nt4tlxomiciydfsDra(vs;u)alenio tytlmDrau o (0srxrim oo1altnlnet s) rrm(r no1opeo o3ias a2rlumsn(0aetoxo ootfpt  n s t)trxm(opiy1lmeelicia(f rtaxmpoo1oexo feiyt aDra(vo;u4artomfctydlpDraies;(0tetmimpou4alee fvs t) 2umu oot0tltnmf3tlsfm2em(vo u4 leoif iy1faDraies ( t2urxo3nudll nmncil()sDtmur nt4olxn octltlm rm( p t4aetrmo iotfmDean il( sexmxmpnodll nmncta( arrr(ront4alt moetlt a2em(vs;(0tetrxr io1om ranvi;s)srxoirpoudomte nci (farururo;t4alxo f3ilsls2um( p u0teenxfcta1fat ai ol()sruo(o iy1am   ict (  rumx o;o0apxo ieiydfmDum(ms t4texnxr iy1fptran olt)tetrir3oy4ape  ics sfa2ua(r no1tltomfetyslmDean s;u0tltnifcio1opt  uvi s0trur(mpiu1opeemfcs () Dtmx p;u1opt  oetydlm2rl(mp t0tlxrio iadfaDr iei t0trurxr io4op n ici ()arra(  no1olxniociydfsDel(ms;t0arerxo tatlpDraivsl(0texo(m io4om e nvsl(fsDraumo;o1ole mi3iltfs2ul(mpnu)aetnif tytom  lnes;t)trtr(r iudlp  lfeta( sDuaxmoot0tpxn ictytlaDrmu s;u)tleoxrcoa1opD an il()tetoiopio1alt  nei (f 2rmu pnu4alt  ieiysfa2rau s t0tlxnmrcoytoat  ivs s tetmxrpio4apenlfvsl(fsrrmxr nt4alxomictas sDelu s t4tlxoxf3iodlat  i il() exrim3oudaltnlicia()a2rr(mp;o4apto ietadfm2rlnvo t)artrmr oo1fat aies;s)srxr(opnu1lmte fvia()s2rr( pot1aee iociys mDel(mp t0 etrmo3ootfat  ivo;(0srtm(rpiy1lptelnes t)aruax poo1alt  oetys m2rln onu4alxnmfciotfmte nvi;s0 2uoim3oo1omenmnctltfa2rrxmp;t4oltomfeild s ra(mo ()tetoio3oa1om r ivi t)srxm(o iodomeemnvslsfsDrrur nu1aptn i3tytlaDrmn p u0tleomrciadoaD luvs ( t2ur(r no1apeemnvsat sruaump;t1aeeomoeilsfaDuaums;()tlxrir3oy1lptr uvo;s trtoir3oy4ll   nes (farrr( p;u0optomfeiytfmDraumpnu4trenio iy1lmDeanvi;() rxr(r3nodap emfvi t)sDrmu  ou4alx  f3tldls ea(monu0tltoxo to1fpDrauvo;s0s2xoxm3oodoptnmfctlt)aDtmuro;t4alxn ociaslmDelu p t0aexrmo3ia1fmD  ieo ()teuoim3iu4amt liei s)a2rmxmont4tlenio3iadlmDul(mo t) rerxoctotlmteai i () rxr(o3iodlmt mict (farrru pnt0oltomieild a2rlu s;() etnxocia1faDr uvi s  rxrxrpio4lmtelieta(f 2rmump;u0teeo iciytla rmnvp;u0arxnxf tytopte u i;(0 eto(o io4ap e fei sfa2rr(ronu0oeto f3iad a rm( p;t0tltrir3tatfptr uesls trumimpou1op e nvi (farta(m ou1oet  ieiysls2eaumsnt0 etnxrciatlpDrlu o;t0s2umxr3no1om emfcta(  2rmu  oo0oetnioeiltfmDulu o;t) lxrxfcta1lpt  n slt)trtoxo ny4oltemfciltfarta(mpnu1tee mociasla rl(ms t)arenir3ootfmDranvils)t2umxm3iudom   fes sfsrta(mpnu1aeenif3iasfa2emuvs;u4alxnmr3tytomtrlnvils0t2xoio iodaptn fci sfsDra(m oo0oetoifeias m2rmnvo;t4tetrmr3oodfmteln i () rtoxm nu4lmtemncias a2rmuroot0oex mo3ilslm2rauvs;u)aetomo3tytlpt aieo;t)setoim3nudam  lfcil()arrm(moou4teto f3tad a emnvpn()trerxfcio1lmD li o;t srumir iu4lpen fei (fa2tm( p;o1apxnifctat s ul(vp t) rxnxf3oo1lat an i (0s2trim3oydapt lncilt)aDtmu  ;u0oex mociydla2rlnms t4 ltrmo iy1oaDe n olt)seuoxrpny1olt mnvs s a2taxm nt4oeen icilt m2emums () exoifcoodomtelnvil()t2tr(m3iudam nmfes s arrr(mooo4oltoioctas aDum( on(0trtnxr3oytoa rlu ils0 eurim iudalt livils sDumxm nt4oexo oeild m rau s;(0 rtnio tydomDelues t  exmxmpoo1lpt lfetlt) 2tmx o;t0aex  ieiat sDuln p t4texnmf3tadlmDeli i;t0truoiopiy1olt liesltf 2ur(rpoo0texnmoctadfs uln pnu)arenmocta1fm elieols)s2xrir3no4aleelfvil(f Duaurp;u4apxn ociyt mDrlnmpn(0arxomoctotoptr nei ( seur(m oy4omtn ivsls) rumu p;u4olxn o3tldfsDuaumo;t4arxnio oodlmDr nes;t trurim3ny4ale mictas  Dtm(mpou1tlenmi3ild m2emu o t0aexnmr iytla eli ol( trtmim oy4apee icia(fa2ra(root4optomociatls ulumo;(4areoir iydfpD anvi;(0srtrxopoy4al   nctlsf rtrumpno1olx  fctyt a rlu snt) exnmo3todlmDrlivolt)t2xoxr3iydalenmnctl( sDurxm ou0tlto o3tytfa2uau p (4arerxfcoy1lmteluvils s2uoxopiudlmee icslt)artr(mont4olt  o3tldfm el( p t)tltnmr iodfa e ueols seurio3no1am e nvi sf Dtrx  ot1altomo3iadla el( s;t)altoxo iatop e i o t)sruoxo iy1olen ics ( aDum(m no0opt  iciad m2rm(ms;u)trxrmo3iadfat luvilt)srum(m3oo4ol nlicsat) 2rrxr ot4olxomfeiytfaDumnms;u0arxrifciotfatelu o;t trxm(r3oudlpt  ncsl() rtmx  ;u4tpen fciysfs2ea(mp u4tleomo ty1lpDeluei t0t2xoirpoo4alee fci () ruauro;o1opx  feiyt sDum( o t4aeenio3oydlat lneo (  exm(mpoodoleelncs (fsrtaxmonu1olx ii3iysls2uanms;u4 rtomf io1fa ranvols0srtr(o3iydop nlfcs s sruaumo;u4oeenif3iyd aDran o;(4aleoxf ia1oaDrlu o;t sruoiopnodlmenlncsl()sDur(r ot0oet ifciasfsDrln s;u) renmr oadlaD  ivols)srur(m3io1alen nesl( aDuax onu4oleo oetlsfaDeluvsn() renxr ootlpteaueo;s teum(r3no1lm nmiesasf 2uaurpou1tpxoiietatls rmuvs (0 eermfcootfa  luei t trum(m ny1ap nmivils)sruaxr nu4optnii3iysfm2eauvonu4arermrcoodop rai o s)s2to(r io1lm nlfeia()arumurpnt4apxnmfeiad aDulnvo;u0alenxrciadopDrli ol()seumim3iu1ale lnciasf rtru pnu4oex  o3iasfm2uau s u4alxrmfcty1lp eli slt  2xoim oy4lp emfviat)sDurxm ou1tptnmo3tltfaDran p u4texrmr3iadoat luvo t trxm(r3iu4ap e nctatfaDrau ono0tltnii3iysfm2uanmsn() etoio to1fp   uvols0trxrxm no4am n fciasf 2uaxm ;o4olxo oeiytfa elu onu0 reoxfcoy1opDe nes;s0texrim3io4ap emfvt tf 2taxm nu0tpxo f3ilt a um(monu4 ltoif ia1omtrauvolt0trxr(o3ou4lpe mncsasfarur(r ot0alxomoctys aDea(vo t0arxrir oo1oate i s;t0tetrio3oy1apt lneias) 2ta(  oo0oee ifctadlsDeanvp;u4treoir3io1lp  lieil()teto(r oudameemnesa(fs2uaumo;o1aptnmfctltls umu p;u0trtoxf ootom eaneols  etm(o iy4apee netlt  Drm( oou4oeen i3ias m2ul(vs;u4 lxrif oadfpDeaueo s)trum(o3iy4oltnlicta( sDuaumpou4oltniieiat a ra(mo ()tlenxrciadopD lu olt  etrir oo1lme lnvt ( s2trxr oo1olt  fctatlmDel(vsnt)aeenxocoo1fm elueolt) 2uriopoo1lmt lies (farur(mo;u1oex  i3ias m rl(mon(0areoioctadlpDrlu ols)teumim3oo1lpee fvtl()aDua(mo;u0opx mo3iadfmDrm( onu4texnircoo1oat  ieols0t2trxrpnodale livta(fsDtr(mo;u0tleniietydfm2rm( onu4treoioctodop eauei t  2tmxm iu4ol nmncsls srrmumpno4tlxnif3iltlaDrlump;t4aeeniocto1fmtr u o t0s2ur(opiodamt  fvta(f 2rrx  nt4tptoifciyt m rlnvs;t0 ltrxf ootopte u s () exr(opio1opeemiesas s2um(ro;o1olx iictyt a2uln o u4aetnif oy1oat livsl()sexmxr no4om  lfetl(fsrrr( poo4aeenmfciad aDra( p t0 exrxrcoy1lm   u o;s0s2xrir3oy1opt livsatfarumxroot1apxomfeils sDrln o u4 leoircoodlatraneol()trxoxr oy4lpe lfcs s)sDta(mpno0aexnmictasls2rmn p () rtrxo3oa1latrli s;t) eumio3nu4lm  micil( sDrau oot4aleo i3iatla2elu pnt0 exnmo3oy1lmDrln ol(0srur(m iudolenmivs ( arrmxm ;u0oetn ociatla2uln p;t)altrmo ta1fat  u o t t2uo(rpoodopt licta(f 2ur(m nu1apx  i3tyslm umu p t0tlxnif oadopt aies s)texmxm nu1ale  fvsas  Dtaum nt0tpxomf3tatlm2rlump (4aleoxf oydlpDeaiesl( srtoimpiu4opeelnvtl() Dtaxro;t0aet mi3ildfa ulu snt4aeenio oytlmt luvol(0t2urio iudlpe mfes ()srtmxm no0tee  ieiys mDran s;t4tlxoio iodoat  u s t0s2xmxm3nydal  lnesatfsDurx ono1oexoiictys sDrau p (0texrir iatfaDeai i s)t2ur(r oy1al nlnviasfa2ur( pnu4tleoio3ildls2ea( o;t4trerxf totfat  u s s t2xr(r3io4apenmieil(  rur( p;u1aee mf3tas aDeau o;u) etrif3tytoat anvslt  rurimpoy1ap n ies sfsDrmxmoot4tet mieiydlm rmuvo;t0 etrxo3ootfm  li sl(  2urio oydll e nvsat  rrm(mpoo1altoii3ildfm2rlu s u)aleoxf3iodopDe n ilt0 rtoxmpnu1olt mfei sfsruru o;t0oleo fetytla umnvon(4 ltnio3oatopDraivs;t0srtmxopiu1altnmnci t) Dtrurpoo0oeenioetyslsDumnvo;t0tltrxr oatfaDe ivs;t)t2um(m oo1amt  ncsat srtm(r no1aee mfctydfa2umump (0tlenmrcto1fmD au olt)s2tmxr3oo1ll   nvsls srra( pno1tlxoifeiysfsDumnvon()aeermocootlaDraivo;s0sexmim3oo1am nmfci ( srrm(  ot0oexo ieiys aDuauvs;t4trtriocoatoaD an ol(0t2tmxopio4lm emfvta()sDta(m ;t1aeto fciytlm uluvon()tetnmrctadopt  iesl(0seurimpoy4optemnct t) 2ua(monu1tpxnmf3tlslm2rauvont0trtnmrciadomDrli ilt0s2xmiopiydop  lnvtlsfsDua(m oo0apxo fctadfsDra( p (4 exnir3to1oatr n olt sexm(o io4am elfcia( aDuru poo0aet mociytfm2uanmsn(4 lxnmr totlmDeaiei s)t2xrir ou1apeelieils)s2tmxmo;o4oeenmfctaslmDul( s;(0 exnif io1latr nei;t)teuoxrpou1apee netas srrrurpot1texo oeiatfaDraums t)treoircoo1lptr neol( srxoim3ou1lp elfes tfsDrrumpno4oleniociydfaDeauvs t)alenmf tatlm e i i;t s2toir nu4oleemict t)a2rr(m nu1oex ii3tydfaDuaump;(0aeerif3iydfp   iesls srum(r nydopeelfvtat s2rm(roou4apxn octatfs rl(vo u0texnmf io1fpD auvo (0trxoiopiydamtn fetls s2rrxmo;u0altnioctytla emnvpnu)tetnxocto1lmtrai i s0setrxr ny1aleemietatf 2rmurooo4teto ictad sDrmnvsnu0teeoxo3oatlpDeluvol(0seurio3nu4lleemfvi sf rtmxronu0tlx  oeildls uauvs t)tltrmo3iotlmteli olt0sexmxo nu4opeelies sf 2rm(r ou0aet mieilsfaDranms;()tlermr to1faD auvols  2toxm3iodlm   nvi s arrmx p;t1tle mfciytlm emums u) exoxocto1lp e iei;t t2uoimpoudlpe mieslt s2uau  ;o0texomictltfm2umuvp;() ltnxocty1fmt anes;( teumxm iodomenmnctasf 2ur(r nt0olx  ieiyslaDean pn() eenio3ia1oaDraivs;t s2trxopoy4lltemnes s aDtm( poo0altoifeiyd a2el(mp (4 lxnir oo1op  livslt trxoxo oudame lfcs s s2taumpou4oetn f3ilsla el( o;(0 rtomo tydlpt an o;t)trtoxm ny4al eliesat) 2rau  ou4tpenmiciltfm uaump t0tltoifcia1laD luvolt  rumxrpiudlmeelieil(fsDur(r nt1altnif3iyt m2emuvpn(4artrio3tadfmtelu ilt teurxo iy4omtelfeil() rtmu  ;o4altomf3tatfa ea(vs (0 lxnioctodomt aueo s) ruo(o oudlm   ivs tfs2tr( p;t4ape iociatlm eau o u0aetrmf oo1opt  u o;t tetm(o nudomee nvi s srrr( ooo1aptoiociaslmDrm(vp;u4 exnmf oo1oatraieo ( srxoio3ny4lpt micsls a2uaxrpou4ape  o3ias s2eanmp t0 lerxf3oy1la rau s ()t2trxmpnu1alenlfvtls)aDtaurp;o1opto iciytlsDumn p t4artoxo3oytfp ranei;(0trto(rpiudal nlicils artmx p;u1tee  f3ilsla el(vs t4 etnxf ootfat li ils0teumirpiy1om nmnvsl( sDuru o;u1olxnmieiat m2ranvo;u4 eeoxo3iydlaD au ilt  2uoxo io4omt lieias aDrr( onu1tlxo feiad s2ra(vo;u4 ltrxocoadlaDraueo ()t2xm(mpoudalen fvt t aDrr(rono0teenmociltlmDuln ont)tetoir3oatop  aueo s0s2ur(r oydolee ict s s2umumooo1olx moctls m2ua( s (0artomocoy1fp  aivs;t) 2trxo iydolt mict t sDtaxr oo1aee ifeias s2ulumon(4alxnir tadlmDelivo;()tetr(o oo4lm n fct ()arrrum no1opeomi3taslmDra(mp ()texrxo3oo1fmD aivs t) rxrxr3oo1lp emiet t)a2rmxmpoo0oleoio3tyt a2uan p () rxoxo3to1fmteaneslt0texm(o3iodolen nctasfartmxrooo0opeoii3iys m ulu pn(0trtomf iytfatr uvol(  ruo(o iu1alee fetl(  Drrxm ;t4ope iieiytfmDeanvp;t4 exnxr tatlaD an s;s srto(r iydlmenmnct t  Dururont1aeenmfeilt mDul(monu0alenxf3tytlp  au o s) rxoim3oo1ol n fvtasf 2ua(rooo1tleoif3iltlmDum(vo;()tltomo iotoate i il( setoimpiy1lleelies s  2ua(r ou4aptomociadfmDrm(mo;u4 lermr ty1fat  n s t  eto(m3iydal emfcslt aDrmu pot0alt  i3ilsla2elnmp u) eerio oodlpDeauvi s)s2xmio3no4amtemietas arrrxmo;u1olt  ociytfs2rln snt)tetnxr iydlmD lu i;t  exr(r iydamtn ivt t  rrm( o;t4opeoifeiysfa2ean o (0arxrmo todfm  luvsls0sruo(opny4omenmnvsltf rrmurono4alx micias a2um(mp;t0 reomo3ootfmDeaiei s  2trxo3oy4omt micsat) Dtm(mo;u0apx  fetyslm rlu o;t0trtomr3tydfate nesls0s2um(r3oo4ape  fes t) Dtmx pot1olenmociytfa2el(mp;t) eenmf3oodom eanvs s trxr(rpny1omt lieia() Dumumpou0tlenii3iysfsDuln s (4 eeoxf3tatopDrauvilt) eum(r3nu4lp  lneiat srumxmooo0oee  fciysfaDranms;u4alxoxr tadoatr u il()srtr(o3iudop   icsa( s2ra(ro;t1alx  i3iad s2eluvpnt)tlerir3iatlmDelueol(0 rxrxr nydapte fvt sfaDraxr oo0opeoioetlt m2rlumsnt4 rerxfcty1omD  uvs t)t2xmirpoy4lle lfes s) rtmur ;t0aetomfeias s ul(mp;()tlxnxf3oytomDeanvilt) etmir3iodamtn nvs sf 2rm(ro;u1teen iciasls2ea(mon(4aexoxo oodopDeliesls)s2tmxrpiy1ol e iei ()sDraur ;t1ape  f3iytla2emu o u0arermo3iadoat  ueo;s setrir iodaptnmfesasfs2rau p;u0olx iiciytlaDuanvp;u0 rxnxf3totfmDrlieo;s) etrxm ny1ol  mnvs t) Dum(m ;o1alx if3iyd aDrm(vo t) rxoxr tytopDrai i;s0t2umirpoydome lieil(fa2tru  nu1aetoif3iatfs eluvo ()arermf ta1om raivi ()teumir oy1omee icslsfs2umu p;t1tptn feiadlm2umnvp ()aetnxocto1lat  i o;(0t2umxopio1lmtn ics t s2ur(mo;u4aexn o3tadlaDum(vo;t0tlermo3ootlmDrliesl(0s2tm(mpiydamtemnesls)a2rauro;u4opt if3iltfmDumums t)tetnirciadfat lieo t0sexrirpnodop elncilt)s2uru ooo0aexnmfciaslaDeanmo u0 rxnxo iodopDrai o;t srtr(o oy4ame mneiat s2tm(m ou1tleoioeiyt a2rlnvs ()arxrmocoodopD li i s  2ur(m3ny1ap n fci (f 2umxrpnt0olxn fcildlm2rmuvs;t4texoxo3iatla raueo ( teurir nu1oltemnctls)sDurx  ;u4tlxoifeiyt s uanmonu4aeenxf3oa1lmt au i;t)setm(rpoydoptnmics tfs2rmuroou0aexniocildls umumo u0 rerxf ty1lptr i sl(0t2xmxopiy1lp elneta(faDtmxm ;u4ole mo3iydlm em( o;u) eenio iatoptr u s (0trtr(mpiydope lfci s)aDur(  ou1opxn feiytfa2emnmp u4 lenio oodlpDran slt0 2umxo iu4lpte icsatfsrumumpot1alxn oeils s2rlumo u4 lenxf oadfp rai ilt0srxmxrpoy4ol emnvi s arrrurono4alxo i3iat a rl( ont0altrxr3oatfm r n ol(0truoio ou1llee nei sfsDuaxmpot4teeomi3iasfa rl(mp;t)tlenxfctytlmtraivs ( srxoim3iy4om e fesl(fa2rmx oou4tle iociad s emnvs;(0aeeomo3iydlaD anvo () etrxm ou4ame mivtat)a2rru  nt1tptnmfcilt a emums u0alermfcty1lp r n il(  exr(r nu4om  lfctl()arra(rp;u0tlx mfeiadlm2ulumpnu4trermrcto1lpDe ivo ()seumxr oo4olenlnctlsfsDrau  oo0aexoiietls m2um( pn(4aetnxf ia1lm elu i;s0trxo(opou1omen neta(  2ur(mo;u0oltn fetasfs ra( p;t0 etomf iadoa r i sls s2trxopoydal n nvt t aDtmurono0opxnmictytfsDeln ont) eenxociotfmD  ueo t tetoiopou1ape  ieiatfarra(rpno1opxomieildlaDulnvp u0 lenio iadop  ln i;s trxoio no1ape mieiasf 2rax o;o4tle mictadfmDuanvp (0alermo tadomD anvil()t2uoxrpnudamee fvias sDrm( p;o4apen fciatlm em(vp u4 rxrmo3iydfa   nei;( srum(m3no1llee ieils srum(mpot4oetnioetas m el(vsn(0 rtnirciadomD lieo;s s2urirpnudlltelicils)aDtaxrpou1texomi3iad a ul(vo u0 rxrmfciydop  li i;()srum(r3oo4ol nlnctat s2tm(mpoo0tlxnio3tlslmDrm(vs t) eeoxf totlpD lnei;t)teuoxr3oodlme  netat  rra( oot0tpe  f3iys aDrl( o (4tetnir3tatlp   neils)texmxmpio4am nmneiltfsrur( pnt4oexoifctld s2el(vp;u)tetoxf3iodfaDe uvi s0 2xriopiy4lp n ies (farua(rp;t0ale ii3iysla umn o;t4arxnifctadlpt lieols teumxm3oydlmen ivslsf 2ta(m nu4tpt mociat s rm(mp u)alenioctotomDr n o s) 2xoiopoodlpe mncs t)sDrru  nt1tpxomieilt aDemuvonu4artnxo io1lat luvi;() etr(r oo4op emivia( srtr( p;o1aeto ictytfs emump u) etnir iy1fm eaivi t srxm(m3iydomenlicil()srurxmp;t1opxn i3tadls umn pnt0alxnmo3totfptrau sl(  2tr(r oudame lictat sDra(m ;t1oltoio3iadla elump;u)tetnxocoo1fmte u i;(  rxo(o nu1lm e netlt)arur( oou4aeto octadfsDrau s;u)artnio ty1fm rauvols texoir3oudopenlfcilt)aDtmxr ot1oeeoio3tadla elnvs;t)artoxr3oodlp  lu o s sruo(m nu4al n fesas) Dta(mo;t1tpxnmf3tasfsDem(ms;u)artnmf3oatoatr nvs s0s2xo(o3nu1lmte ivia(  rraum nu4tex mi3ias mDuln o;()trtnxr3iodfmD auvsl( seuoio3no4aleeliesas arrax ono1tleomieilsla ranms t0 rtoxr iytlaDe n ols0s2toim3nydopen iesa()srta( ont0oltnmociys mDelnvon()tetnxo tydomtelueo (0 etrirpnydlmtelfci (f 2tmurpot1aeen octad mDelu s;t4 eeoxfcoy1faDraivi s) ruoxo3oydal elncsl()a2ra(  ot4tee  fetlt a ea( on()tlxnxrctadfm eluvs s) etrxrpno1olee nvtl( arrrxm ;o4alenmo3iytfa ranvo t4 rtnir ta1lp r uvo s teto(m3oo4lltelfvt s) ruaur no4alt ifciysfmDua( snu0arxnir ootfa e n i;t0s2xr(mpiydomtelfetat)srrm( poo4altomoeiytla2ra(vont4 eenif oa1lm eauesl( teuo(m3nu1lle  ncils  Dumu  ot4oee mo3ildlmDea(vsnt0altrio tadlp rli s () eto(r3iu1lpe lnvsa(fsruaxm ou1opeomfeiad a2emnvs;u)texoir ia1fm eauvi (0 rxr(o nu1omen fvilsfarrm(mp;o4tlx mo3ilt sDua(vsn(4teenxo3tytfmtr nvol() exmirpoy4lptemnviltfarumxm ;o0aetomo3iadlm2umnmont4 reoifctatlm e i slt)sexrio3io4op e iei tfsrumx ooo1alx  oeilsfm2eauvs;()tltnxf oodop  au olt)sexmirpou1om e ivsa( aDrmump;o1aeenio3iasfmDran s;()aetrmf3oadfpDraivi;t0srxrxr iy4ol  mnet t) rrru  ;t0tlxnmfctyslmDum(mp;u)trxnif3iatfa eln o s0 2uoxm no4ll nmfeiasf 2rr(r no0apt moctysla2rl(ms u0teenxr3ia1la  lnes;s  rtrxrpnydoptnmfeiltf rumu o;o1tpenmi3iaslm rmu onu0treoxf iatoate nvo t)t2uoim3iu4al e ncsat aruax o;t4tle ifcild a2ra(vo t4teenmrctydfaDe ueol()srumir ou1lm elieslt)srtm(roou0olt if3iadlm2rau p (0alenxfcoodlmt  i o ()s2xmxm nu1lp  mfciasfaDumump;o0tpe  octasfm rl(vsnt4arxoxr3oadfaD  ies;t0sexrxopno1apee ivsl( a2tmxm ou1tlxn ieiydfm2eln ont)alxnmf ta1faDrau s t)s2urxmpio4lltnmncils aDum(rpoo4optnmfciydla elnmo u4arermocoodlateau s;s)seum(m oo1llt  ivt t aDrmxmoot1tpx mfcilsfm ul(vont4teeoxrcoodfmD auei t)s2umirpnodamtnlfcs (faDrax  no0alxnii3tlsfa2uan s;()aexnxr3iytoaD aueo t0 rurxrpnodllee iesltf 2umx  ;t4oeto iciatfaDul(vo ()aexoifctydoat  ivo t0sr
\ No newline at end of file
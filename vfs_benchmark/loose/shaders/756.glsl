@@ -0,0 +1 @@
+n s;t) 2xm(m3io4lle lfetlt  2rmx  ;u4opt  f3iytlm2ean snu0 lxrirciydfa  lnesls  rxmio io1op  miei sfsDua(moot1alxoifctadfs eau o;u4 lxnir oa1fa eluei ( s2tm(o io1lle  iesa(fa2taur nt0tpt  ocilsla uau s t4 etnioctytop rlies s)s2xmxm iu4lme lfvi t  2rru  oo0ape moeildls rl(vo t0 etnmr oadlaDrlueo t s2trxopiudlpt mfei ()a2trxmono1tpe mieiadlm elump (0 etnio3todlm eln s;( trxmxrpio1omenmivia()a2ua(ront4texn ociat a2rmu p (4 eerio3oytlpteli ilt srxo(o3oo4am  lfcsatfsDraurpot4altoio3ildls2eluvo t)aeenxfctydlmtrlivo t)s2tr(r3oy4oltnlnvt t  Drau ono0tlxo i3iatla rlu pn(4artrioctydlpD livslt  rxrim3ny4ale mivilt)arrrx oot1aet io3iat m ul( on(4 ltnifctadlmteai s t teur(opoudoleelncil(  rrrxrpno0apenioeias aDra( o u0texnxr3oodfa raivsls)tetrir ny4ale micsl(f rtrxr ;u1olxomieilt sDel(vs (0alxrxf3totfmDelu i;s0trumir nudoleelivsas arua(r ot0oeeo iciydfs ranvo (4 etoxfcoydlp rli i () rxoio3oy1olte fvtl(  2ta( o;t0tpxoif3iydla ul(mp;(4artrxo ootopD  nvi t)srumxmpou1lpeelfvils sDtr( poo0optnmoeildfm2rluvp;t)aetrxo oo1fmDean o;s)srtrxo3iy1ol  lncia(  2umu  nt1tet if3iadfs ea( onu4tetrxoctotoa e ueo;s)srumim3nydopenmfci t srrmxr ;u4alx ifeiat mDumums (0tlxrio ta1faDr ueolt0 exm(m nudameelnei tf 2rax o;u0altnmfctytlsDean s;(4arxrxfciytlatraneils) ruoir3io4lleemfcta(farur( ooo1ape  iciyslmDuln s;()teenmo totlateanvol(0s2umxo iu4optnlneia(fsDta(m nu0tee iiciytlaDul(mo;() ltomrcoy1fmDrauei;s0srurim3iu1alenmncs s)a2raur no4aeeomiciytls2emums u4arenxocia1omDeaies;s)seur(opoudllt mieiasf Dta(m nt4tet mfetlsfaDea(vp;u4 exomo tydfateln i;t teum(o oodopteliesa( s2tmxrpnt1oex  o3iadfsDean s () eeoxf iatla elieol()t2uoim3oodam  mnvtls s2umu ooo0apxn f3iasla umnms;t) leoxr iatlatrai o (  rxmxrpiudlp e ivs t srraxmo;u4opt  fetad mDelu snt0aleoir iadla rlnvilt) ruo(m3no4lp  lnet s s2umxmont0oexo o3iltls eaumonu) eeomr3to1fp  lieo;t)trurxm oo1opeemfvt (  rrmu  nu1apt mi3tlt aDranmp u4 rtrxo3tytlpD livs;s0 2toxm3iy1opt mict ( artrur ot1aexoioctyt a rmnmpnt0 lxomo3oatfpt lnvi;t srxrxopiodop e nvsas)arrrx  nu4tpx io3tls a2ulnvonu0alxoif3tytfa  ai ils0 eto(r3io1lm n nciltfsDtrxr ;t4ale ifetatfmDel( s;t4 lxnxfcto1fmtraiei (0 exm(opou1llee fvi (  Duru o;u0tpe iicilsfa2rm(mp;u) eermf3iytla r iei;()seuoio3oo1olenmfes ( aDuaxr nu1tle  oetat mDrm( o;t4tetoifcta1opteauvsl(  2tmxmpoodlltnmieslt) 2umurpot0oet  ictasls elu p;u0 rxoxo iotlaD  nes;( trur(r oodamenlfci ()aDuax pno0apto ociytfs ean o;t0tltomr3iotopte i s t  2xo(r3oydlm  lnetat) 2tau p;o4tptnii3ilslm2ulnmont) etnif tydfp r n o t0 2tmio io1ap   fei (fa2trurpot0tee iieiatla umnvs t4arerxr3iodfpD  nesls)trtoio io4ole  ivil(f 2ur(mpnu1aex moeild mDrlumpnt) renmoctotlmtr uvil() rto(m3nodlmeelicil( sDumu  oo1aetomfeiaslmDelu p;(4texrmrcto1fmtr ueo;s)t2ur(opiy1lpt lnei (  Dur(rono4aleo iciasfs2el(ms u0altnxf3ootla rlnvs;t0 etrim no1aptnmiei sf 2tmx o;t4apenifeiysls ulu onu0areoifciytoa rlu s ( srtoxmpiu4lmtemicia(  Dum( onu0tptnifcild mDea(vs t4 exnmf ta1lpDe neils0teumiopoo1ol  lfviat)arra(r ou1alxomi3tydfsDeanvsn()aexoxrctatlptrlieol(0t2toim nu1apenlfvsl(fsrra(mpnt4tee  iciydla ul(vo;(0artnxo3iodoaDe ieil() 2xoimpoudameelnvsl() rta(m no4tle if3ilsfm rl(vs;u4 etoxr3oodla  luvi;s0seumim nu4omeemncsa()a2uaxr nu1aetniictatfsDea(vp ()alxoxr tytfpD  i il()s2um(opno4op nmfei ( s2ra(m ot0tlxo oeiyd a umu p;(0tetoir3oy1fptr nvolt0srtrxo iydlpeemnetasfa2raum no0oeenmiciysfsDra( s (0 lxrxocoydfa elnvs;t srxo(opoy1apen ieilt s2ur( poo4tet  ieils a2elumpnu)tetrmr ty1lp  lueo s) euoxm3oudamtn ictat)aDumxrono0tlt ii3iatfm emuvo;t0 reniociotoat luvils)t2urxm3io4lmen nvsa() Draxront4tleomfciyd a rlnvp;t4tlerxfctotfp  livs t  etmio iu1lm n fct () 2rmumooo4oeto i3tlsfm2emn o;t)aleoxo oydfp   ieilt  exrim3oudap  lfes (f Dra(  ;t1tlx mociyt mDrm( o (4 lermrciatlaD aneils  eurxr3io1am  miesl( aDtaumpnt4apt  fetldfsDemump;t0 ltnmr3oydfatrlnvi;t srxmimpny4llte nvilt  Dtmu poo4apxnioeilt a emn o;t0 rtnirctydomtrauei s)t2xoir3oo4alte ici tf 2raxmpnu4aptniietyd m rlnvs;t)alxoxr3tytfm r ueo ( srtm(o3iodaptemfcs (f Dumu oot4tpxomi3tyslm2emu o;t0altrir todfp eliei;s0t2tm(o3ny4omee ietlt srta( p;t0aeenmietlsfa2eluvp;u4trtnmrcia1opt an sl()t2uoim iy4omeelietasfa2rrxmont1aptnmoeiltfa2ua( pnt4texrxr3iadfptrlu o;s)srtoir oo1oltnmnct sfsrum(roou1oex ifciydfa2rl( snu0trxomf3oy1fmDr n i s  2uoir3nu1lptemfcs s)s2um(root1aetnii3ias s rlu o;() rtoxfcoydlate ieo;s0seurir3iodol e nvi t)arta(rp;u1apxoii3iyslm elu s;(4aetrmr oa1opDeluvs;s0trtm(r3oy4am   icsa()s2uru  nt4apxnioetldfa2el( p;u)tetoxr3iytfpt luvi;t sexmir no4amt mnei (f Dumumpoo0tpx  oeildfs2eanvpnu)trenxf iydlp r ieols) exm(o3oo1openmnet t  rtmuroou1tltnifciysfaDul(mp t4alermf oa1la r neils)s2ur(m3oydamee iesl( a2tru onu4aeen octlsla elumpnu0 reomoctydlmD aieilt0s2uo(mpnydopeemfcias)srtr(m ou0tpxnii3tydfa2el(mp;(4 rerxociytoa elueilt0texmimpio1ape lncsl( srrrxm nu4teto fciasfa rl(mo;t4arxnxf3oydlpDrauei ( srto(m3no4lm e icilt s2umxr oo1openii3iadlm2ua( pn()tlxrir3iodlpt livilt)texrio3oy4am elicslt)arrrx ont4tpe mieilsfaDum(mo;(0 etoxf3oatlp  lueolt)t2urim3oodamt mncil(fsrtaurp;t1opt  o3tys m2rmn pnu4teermf iytfmt livo;s trtr(m3nudome lnvtasf rrmu  no0aexoioeiltlm2ranmp;(4aeeomrciytfptr i s;()srtoxrpou1lm elneias) 2trxmoot1opeoif3iys mDul( s;t4trxrif3oy1fm   uvi;(0t2toxr io1omt lnes t)srtmurpoo1tlt  f3tas m elnmonu0texriociotfptranvo s0 rumim io4om nlfcs sf rraxmpnu1teeomoeiysls rm(msnt4 rxoxo3ta1fptrlivo;(0srxmxrpio4lpt miei t)srrm( o;o0oltomo3ils s2rln snt0aexrir iodfmDrluvo (0t2tr(m no1opt  nci s  2ra( o;u4tetn iciad m el(monu4tetrxo tadfaDran s;t trum(m3ou4op nmiesas)srumxm ;t4aexomfeiys aDulumpnu0aetrxf3tadomD  ivolt)srxrir oydale lnetas sruauroou4oee  fctys s2ran snu4alxomo to1lpD luvil() ruoio iodom  mici tf rraxrpoo1tet io3iasls2eanmp u0 eermrcto1faDe uvo;(0sruoxo3ou1llt  ncil(fsrrruroot0alxoifeiydfm2rmumsnu)trerifcoodla   nvil(0srur(rpoo1omenlivslt  2uaurpou4alen feiat m2rmn p ()alxrxocia1opD  ueols s2tmim3iu1apenlfes sfaDtmx pnu4optn o3iad a ul(mp;t0areomr oodlateauvi t)trxm(r oudalt lfvs ( aDtrxr ot0tlt mo3tyd a rluvs u4alxnir io1oa rlivs;s  etm(o iu4ap  lnesa() 2umu o;o1aptoifctlt aDeanvs;t4aexrio totfp rai o (0trum(opoydope mnesas artmxm oo0alxnif3iatfa umu o (0tlermocoy1lp eai o t srxoxm io4lpt mnctlt sDra( p;u4aleoifctldla eaumo (4 rerircoydomDe nvs s0srxr(r no1ame mnvs t arumu oou0aexnmoeiadfa2rmn onu4 eenmo3oo1opD anei s0s2xo(r3oo4ome lneta() 2rmxm ou0texomocildfs eln sn(0 lerxr ootfate n i t sexmxrpno1al nlnei () Dta(rp;t1aex mociad mDrl(mp t0 ltomf totfp  lnei;t0 exoxr nu4aptnmfet () Dta( ont0aeeoiietatfmDem(vsnt4 lxoiocto1opD auei (0sexrio3ny4aleelnvils  rta(r nt1tex io3ild a2eluvs;t0 rxnmr3oa1fa eln ilt trumxr nu1lltnlivsl()s2tmu  ;t1ale mfeils a2elu sn() rxoirctytla ran i t s2uo(m3oy4omtemncsls  Durumpot0ole ifctytls2eanms ()trenio oytom  aiei t0sruo(m3oydope lncta(fsDtrxmoou0teen oeiltla ulnmp u4 exrmr3oatoptr n i;t0t2uo(rpiodamen icslsfaDtrumpoo4oee moctyd s2rmu o t0 ltomo3tatfmDean s;(0t2ur(mpoo1lm nlfesas)srrr( pnt1tee  ieiytla rmnmp;t)trxnmfcoy1lat  n o;(0t2uoio3oo1amen neta()s2tmum nt0oexo fcildfa2eauvsnt) ltrxr3io1faDr uvilt) rxr(opnydlmte feiat srrau oot0tpx if3iydla2umuvs t) rxoxo ia1lm  aivi ()seurir oudlpen iciat)srumxmpou0tlxn ietadfs eauvs;t) renxo io1lat  ieils seum(rpio4ol elieta(fsrumur ot0tet  fciyd mDua(mo;u)texnmfcoydlpD lu ilt) exrim3iy4optemnvtat artaxr ;t4tlx  oeils m umums;t0texoir ta1opD au s;t teumxo nydom e fciatf Dtm( oou4ole  ieild m rlump t0 ltoxo3oydoa eauvsl(0 ruo(o3iu4ape lnct sfs2rax  ;o4apeo ietlsfa uln s;t4aeenmfctotfaDr uvs (0s2um(rpoydlmt lictas) Durxr no0apeo oetatlmDemnmont0tltnmf3iydfpDrai s;t0s2xr(m oydapt livta()s2raum ;o4apxoioeiydlm umnmont4 lxnmr3oydfmDr ivi (0s2uoxm3oydole lnet () 2taurpot4tptn icildlm umumo;t)trerxfcoo1fmDranvi (0seuoxmpiy1ope  ncsas  ruaxmpno0opxoiieildfm umu p;u0trenif tadomDr ueo (0t2um(r3ny1ape mfvilt)aDtm(mpnu0ape mo3iatlm rmu o ()tlenio tydop eai olt)t2xr(m3oy1ol nlictlt)s2umur ;u1tpx  o3tatla2rl( pn(0trxrxo3oydoaDelues;()t2um(mpiudapenlfvt ( s2rmumont4opxo o3iytla ua( snu4 rxrifciy1fmtrluvo;t) 2xoxmpoo4amte fet (  Dtaxmont1tpe  fctysfs uan s;t0 eerxo ia1oa e n il()t2xm(o3oy4ape  fes ()sDtrxrp;o1texo i3iltfm em(vs () eeoxr3iatoa elieo t seur(m io4lm  mncsatfarurum no0tleniociydlaDeau sn(0tlenmo oo1fpDr uei;t0 rxrir ou1apenlivs t)a2raum ;t1opt  fetldls eaumo;t4aexrmocta1lmDeln ols0 2xmim3ny4lltemictlt arumumoou0olt  f3iatlm2rmumsn(4tetrxr3io1opDe uvilt  2xrxr oydalte fctls)a2urum ou1olxnifeiadfsDemu p t) rtoxf iotfmDeai i () etrxopiodop n ictas aDua( o;t1opx if3iyslmDeauvs;t)tlxrxf3ty1fmtranvo;s srtr(mpno1alt  icsa(fs2ra(mo;u0altoiieiasfm2eanvp (4aetoxf3iydoa rlivilt)sexmxm3ny4aptemfeiatf rrrum ot1tlto f3iyd s2ul(vo t0 ltnmrciodoat aivsl( t2xmxo3oo1am nmivta(f Dtau  ;u0tptomicildfsDemnvonu4tlxnmo iatlmDr uvslt0srxm(m oodlpee nvsasfarra( ono4ale ii3iltfm2elumo;u0trxrio3oytom  lnvslt0trumio iydome mietl(faDrr(rpot1aleo i3tydlm uau o;t4teeomf io1la r ieo;s setmxrpnudolt mfvtls) rrmxm oo1tee ifctydfaDra( s (4trerifctodlp eaieol( srxo(o3ou1ol elneils) 2ta(rp;u1oee  i3tasfs2rmnmp;u4 etoif3to1lp   n o;s)srxmxm3iydol   nctlt)s2tr(r nt1aet iiciytlaDelu sn(0aexnxrctodoa rlivils s2xoim3oudlm   ics t s2tmxront4oeeomo3tydfmDelums;()trtnifctodomDr iei;t)trtoirpiu1omeelnvi s aDurumo;t4aptnmo3ils a2rmnvpn()tetrmrctotlatelivil()srto(o oodalte nvs t)artru ooo4oleoioeiadfm2rmnmsnu) renmo tatlmtran o s)texoim3iy1alee icsatf rrm(  nt4oltomieild sDel( p (0trxoxf3oa1oaD ln i s texo(rpnydlpe  fvtas sDrmuroot0altnifctlsfm elnvp t) leoifcootfmD anvs;()texoirpno4aleemncil(f rur(m nt1alenio3tadlmDemn p;t) renir totoa ranvol(  2toio iudom  lfetatfs2uaumonu1oltniiciatfa2uanvs (0aetrmf3iodfmt  ivsls) exrxrpiu1ap elnvs s) 2um(mo;o1opeomociydla ulnmont)trxnxocoodfaDrlnvi ( trxm(rpoo1lmt  fviat)sDrmumo;t4tpen ociyt m ul(ms;u4tlxnir3todla  au i;s)trxmiopiydlptelfvia( srrr(mpno0teeoii3iadlm2emump u)teenxr3tatop  anes;() 2uoirpnu1lpt  ict t aDrau  nt4tlxnmo3iltfm2eau on()tlxrmo ia1fmt lu o;s  rum(r oy4omt mnetat)a2ra( onu0apt mf3iysfmDra(vs u4arxriociotop eaues s trtm(opiy1om nlicsl(fartm(mpnt0ale miciat s2rl(vo t) rxoiocoo1opDraueo ( srtrxr ou4openmfcilt)s2uaxroot4oltnmieilsfm2rl( p;(4aexnxo3iadlat  ues ()trtm(o oydlmtnmneias arrrumpnu1aetn iciltls rau p t4 etoir iodfa  auvo t0srtmxopiu1lptemncil()aDrmu oot0aeen oeiasls2eluvp;u0tleoifctotfpt auei;(0t2ur(m nu4ll e ivia(f 2rauroot1tltoifeildla2em(vo () leomocio1fm elivi s srxmxm oudameemnvils aDtmu ont0apx ii3tlsfa2umumsnt0aleoif ta1fpD aivs;t)tetrimpoo1alt lfet s  rrr(r nu4ale  ieiysfaDulumsnu4alxrif ia1oate n slt setmxm ou4omeelfvsl()s2uaxrooo1teto ictld s2ua(mp u4 renioctotlmDrlneil()trtmxm nudopt lieilt  2rm( pou1aex io3iat a2el( o;t0altrmo tydfmDranvo;( teumxm ou1altnlictas) rumx oot1tpto fcilt a2emnmp;(0 exnxf3oydoaDrlueo (  2ur(m3nudlmeemfci t aDtm( poo4oex iiciadlm rmnmpn() rxnmo oa1faDran o ()trtr(o3no4olt  ieil(faDuaumpnt4optnmi3tldlm2ran o;u) lenmo iytlaD  u sls  exmxrpou4om n ies ( a2rrxroot4tlxnio3iadfm uauvp;()tetoif iytfmt  ivsls  2um(m3ny1aptnlnetl()srtrxm no1oexnio3tydlaDeanms ()aexnxr3ia1la  ai s s0trtrimpnu4alt mfcil(fs2tmu poo0ale ii3ildfs ranmsn()trtrio ia1la eauvi s t2tm(opou1opt  nvt tfsrrrxmooo0optnmi3ias m uluvsn()trxrxocoodop eai s;t  2xrir3iy1optemfesa(fsDumxr nt4oetoiietlsfsDean pnu0 ltomoctatfmDr ivs;s setm(opnydlme mfcil()artrxro;u1tpto i3iaslm rlu o;t)tlxomo oa1omDelu il(  2uoio iydame lfcs t) 2taumpnu4ale  iciysfa2umnvp u)aexnmrctadlmtraueols)s2umxr iu1ap nmicsl()srumxr ;o1apxnmietaslaDeanmp u0trerxo3iodopt ln o;() 2uoir io4altelfeilsfs2rax onu0oleoiiciad aDrlu s u0tlxoxo oo1lp   ues;(0t2uoxo3iodlmt  ivt ( artrur ;t0oltn f3tltfsDulump;t0trerif3oydoptr nesls) 2xrimpiu1ll emfet t)arrrxronu0aeeoiiciltlsDemums;(4 exniocoo1opt luvo s0srxoxo3nu1om nliesl(farra( pot0oeeniiciydfm2ul(mo u0trxnirciodlaD lu ils trtoxr io1om nlnvsl( sruaxmp;t1optoiietat a2ulnmpnu4tlxnif3tatlptr nes;( srum(rpnydlp  mfeia( srrrx ono1ope iociyd sDumn o;u)trtomfciadlp rlnvil() 2uoxo3nudlpee fcsatf rurxr ou4oex mociaslaDrlnvs t4 etnxrcoodfa r uvs t) etmxm3iy1lptnmivtl()sruax onu1tleo icilt s2ua(vont) rtrio3to1lp e ieo;s0 etr(rpoy1lm n iet ( a2ur(r oo1teeoiietysla emnvo (4 ltnmr3ta1fatr ivilt0seumirpnu1amtemnvia()s2tm( pou0aex if3ias s ra(vp t0 exrmf3iotlpDe i o;s) exr(m3oydam n fvi () 2urur ;u0opxnio3tys a ul(mo;(0tetoif3ootfptrlu s ()teuoxopnu1am emivi (farurx ooo4oetnmfciysfm emuvsnu)aetnmrcoatoaDranei;s0tetrxopnydlm  lnet ()arua(  oo0tptoioetysfa ranmo t0teenirctotlmDrlnvols texo(mpny4lp emfvs t) rtr(moot0tee mo3iytfmDuanvsn(0aeerxf tytfmte nes s tetr(o no4ole lnes (faDtmumo;o4tlto ieiydfm uluvont0 eermo3todfpDrlnes t0trtoxm oo1omenlictl(f 2ta(mpno4tpxn feilsfs2uln s t0trxomr tadlaD  u il(0s2uoxo3oy4llen icilt)aDrmxrpno1aee ifctat a2rmuvp;(4alxrioctytopD  nvi ( trur(o3oudomtnlfei (fs2um( ono0aeto f3ildfa2elnvp u0arerif3tadlatr n ols)seuoxo iu4alt lfes ( artruroou4aptn fciadlm2el(vp ()treomo ootopDelieil( srto(m3oodapeelfcsat  ruax o;o0teenmf3tyt m elnvonu4trtnmo oatfat  nvilt)teumxopiy4llenmnvta(farur(mp;u0aptnmfeilslm2um(ms;(4trenio3iadfaDr ivi;s)seto(r3nu4am elict s) Durur ot1alxnmociydfm2uanvont4tetrmrcta1opDrliei;s)t2tmxrpoodll emneias  rrrxmpno0aeeoii3ilt a rmuvont)tetrifcootfate ivs;s srtm(m nu4ll nmfct tf ruauroou4olt iictysfm emuvp;(0areoir iy1oate n i;(0t2xmim3no1opee fct tfarta( p;u1tlenifeilt m2ul(msnu)altomociydla eai o ( s2trir iy4opeemnvi t a2tm(m ou4oet mieiatls um( o u0arxrmo oadfpDeln il()t2uoir oo4lpe  fvil( srrmum ;o0olt ifeiltfs eanvon(0 exrio3to1lat anes t)seumiopoy1aptnmivs s s2ua(r no0texoioetadfsDrl(vp;u0 rxoir todfpD  uvo ( tetr(o iydopen fvi ()aDuaumooo4apxoioeiadlm rmn s u4tlenxrctodfpDeaueo s setmirpoodal n nvi (fs2umu ont0tpx moeils m eaumsn(0altrif iadfptrai s;( texmxrpiudomeemncil( a2rr( pnu0tleo f3tad s2umu s t)arxomr3iydlp r n ol( trxmxopny1aptemfei (fsrumx  ot1tetn ieiydfaDumnvsnt)artomo3tadlmDeauesl( setm(o3iodameelfvs (f rrmx onu4tleo oeild a el( o;u4arerio3oodomt  i o;(0srumirpiy4alee ictl(fa2ua(  ot1oee  i3iyd a rmuvs t) eerir3to1laDrluei;s0sexoir3iu4altnmfciat) rurxr ot1apeniieiysfmDrl(ms;t4teermo3oadfpDrlieo s0srumio3oydal e ieta()artm(monu1oet mi3iydfm2uan p (4artnir ootoaD  u ils0trxoxo no4ame  icias s2tr(mono4aexn iciat aDea( p u)tetoxf3ty1fm raivi s trumxm io1ame mictlt aDra( pno4tpt mfcilsls2em( sn()tltnxfciytoa  aieo;( t2uo(o3nu1omtemfetls sDurumooo4tptnioeias sDem(mp u0altnio3oatoaDrai s ( s2uoirpoudap e fcsasfa2rm(monu1oetnmociatfsDra(vont0 etrxo oytfate uvs ( t2xm(o3nudlp emfvi s sDum(m ou4oee  fciad aDran s (4aexrmr3io1optrli s s0t2toxo iodlpe  nvta( aDrmu o;t4tlxomf3iyt sDumnvpnu0alermfcia1fa e ivo (0 2ur(o3iudop e fcsa(  2tru o;t1tpen f3tydlaDraumsn(4trtoxrcio1op rln i s sexr(r nudap emfvsat srtm(mpoo1teeomiciltlmDrlnvp;t4texrir todop rau s t) 2xrio3oodlme  net tf Drmx poo0ale  iciysfaDulnvp (0teenmr3ta1fmDeliesls)trto(rpiydop   ictls sDta(mpou4tpt  fciltfs um(monu4 eeoxr3ta1fa e ivo (0 2xoiopiodol   fvias aDrmu  oo0aeenmociltla elu pn(0 exnxo3oadlmt  ivo;( s2xmim iu4amt lfci s a2urxmonu1tlx  octat m ran pnu0 rtoxr tytlmDraiei s)truo(o3no4lpenmiviat aDumu  ;o4aeenif3tat m umnvo;t4aetnmo3iytfmD aneilt  exrxm oy4ape mnvt () rrmxmonu0aptoii3iydlm2rau s () lxrmrcoydlmteai olt0 rumir io4lpenlfes s artrxmo;t1ole iietydfm emn o;() exnio3iatfpDelivolt teumxmpiy4lle  fvtlt  Dtaump;t1tpeoio3iys aDelnmsnt) exomfctodopDranvs;(0s2ur(mpiu4omeelicsasfsDraumpou1oleomfctldlaDuauvo;u4tetrio todop  luvi s)tetm(m oudlmenmiesa( aDumxmoou4teenifeiatfs2rl(mont0alxomfcoatfmDr n s s srxr(mpno4olte fvsa(fa2um(r ou4oexo i3tysla2uan o;(0arxoxf ootlpDr nei ()s2toxr3iu1am  lfcia( artrx p;u0tpen fciydla2umnvsnu4aexrioctodfmD  ieo;t) 2tm(opoodaptelnvsls)s2trx p;o0texoio3tas sDuau p;u0tleomf io1fat anei;t0teumir oy4aptnlncil( s2umu o;t1aexnifctldlmDeau p;t0altrxr oodom rli slt0 etoirpnudlltn ict sf 2ra(rooo4alx  o3iys a2uau p;u) lxrxfcoodopt  uvo s) euoxm3nodopt mivt ( artrxrp;o0olt  fctlslm2umuvp t)tetoxfctotfa elivi;(  2xmimpnydom   ncs (  Dur( pou1oee ifciydfs2um(vpn(4tlxrmr3iadfmte u olt0 ruoirpnu1apenlfct sfsDtaur nt0tltoiieiltlm2eanms;(4aeerxrctodfa eau s;s)trxrxopoodlleemneiasf rumxmoou4tpxnmicias m2emuvo u) eeomr iotlmD  nvo ( trumxo io4lp e fesatfsrtaxrp;t0apx io3iadlm2eau p;t0arxrxf3tydop e n o;( t2uo(opny1alenlncsatf 2rr(  ;u4tlto o3iaslm umnvs;()altomf3to1lmDran ols)t2trir3nu4ol   nvsl(fs2uru ooo0tee mf3iadlm2el(vp;()areomr3oodoa rln s;s s2xoxo ou1apte ncias)srrrx o;u1apxo icildlmDrmuvsnt0trxrxr oa1opte ieol()sruriopno1altn ies t sDtmxro;t1altn oeiyslmDrmn o (4tlenxfcootopt  i slt  rtm(mpio4llee fci s)srtax p;o4alx io3iatfa ranvp;() ltoirctodopDr ivslt0srtrxr iy1om e fesa(fsrumxr oo4opx mietys m2em(mo u0aexoxo tadla rai slt0 exoxopiodam nmfctasf 2raumont1olxnii3iasfa umu ont)trtnxocoadlat aieo;s) rxmxopiodam nlivil( sDrrx poo1tee mietysfa2rluvp;t) lerxf oydopD aies;s)seuoxopnodap n ivi tfsrtmu  ;t0aeen fetls a umnmp;u4tetrmfciodlm  lieo;t texmxr3iudope  nvia()s2tmx pnu0tltn i3iys m ea( ont4tlxnxr3iy1omD  n i;t)trumim iu1lmenmnvi t  Dur(r ;u4apenif3ilt m2rmu s (4aetrxr3totlaD luvo;(0setrxo3iy4lltn fci ( a2tr(m ot0apto o3iysfaDulnmp (0tlxoio iytlatrlivo;t) exm(m3io1amenlfviat  Dua(moou4alenmi3iyt m2ea(mp ()tleomr iodfaDe nvslt0texr(mpnodame lfeias s2ta(r nu0alt ii3iat a um(vs;(0alenioctydfatr neo;t)trxm(m nodlme  nctat) rurxmo;u1oltn ieiys m2umnmonu4aexoio iydoatrli olt0t2um(m oo1amen fctl()a2rm(m oo0opxnioetytlm ul( on(4 renxo tytfatrai ol() 2um(mpoo4opeelfvils)srtr(mp;o1tpeoiieiatls rlump;(4aetnxr iadla r ivo;t0 rur(mpoydap   nvt s) Drm(  ;t4tle if3tlsla2em(mp t4tlxrxr iadopD ln o;(  rurio oo4omeemncs ( a2urx  no4optnif3tysfa2umn p;(4 rtnxr oodfpD lnes;(0 eum(opnu1ll  licias aDrm(mooo0apxnmoetyd aDulu p;u) exnmf3iydopD anvsl(  etrxo3iy1lltn nvta()sDrmuroou0opeomf3tysfa rm(mp;t4 exnifcoy1latr ies s0 rxrxo3iydom elneslt  Dum(mono0aexnmocilsfs2um(mpn()areomfctytomteli o;s0 2ur(mpiy4op nlfvtls  Durum nu4apx  ieiatlmDumuvo;t0 lxrxf3tadlpDeai sl( teur(m3oo1amenlfesl(  2rmu  ;o4tpt mfeiadfsDrmnms (4tetoxrctatlm  an ilt  2xoio3iodoptn nvta(  Dtruro;o1apxoiietadfs rmuvs;(0alxoio iytomDeln o;(0 etm(r3oudam elfet t) 2tr( p;o0aee iicilt a2uan p (0 rxomfctodfaDraneil() exm(rpoudalee nctat) Dumx o;o0alxoio3ildfm ra(vonu0 exoxo3to1lptr ies;s s2urio3iy4op nliesat  Dum(rpot0olxomi3iltlm ul(vo;(0 exomo tatlat  uvs t)s2xr(r3oodape lncs s  rta( onu4aeeo f3iat mDumnvpnu0aetomrciadla   nvo () exoxm3oy4lp emfciat) 2um( ono0apxo o3tltfaDrl( sn(4 lxnxociy1lmD  uvi;s)s2xrxo nu4ap nmivslsfsrrmx oot1tpxnmfciad s rmu onu0tetrxrcto1op  anes;s srxm(opiudomtnlfct ( arrrumo;u1oltomi3tlsfs uaumpn() rtomocio1omt ai ilt)t2ur(rpnu4ope mnei (fsDrru oou4texnmoeilt a2rln snt0tltnxrcty1la   nvi;t0trxmirpoo4ll e fctl() Dum( poo1olt io3iltfs emnmo;() lxrir3iydfatrlu slt0texmxm no4lme lncs s srta(  ou0oeto iciatfm uanvp t0aexoxociotomt anes s)seurxrpnu4lp   fei tfa2trurpot1tltoiieiyt a elnvs;()alenmociodfpD auvol()tetmxmpoydaptnmiet s)sDum( o;t1oee mi3tydfa2ra(ms;u)aetoir3oy1fmDeluvol(0t2trxo io4oltn fciat) 2uax p;u0ope io3iys aDulnmsnt0artrmr3oydfaDeau sls trtm(mpnudomtemics tf 2rauro;t1apxn ieildla2rlnvp t4trtnircoydoa raneo;t0 euoiopno1om  mnvias s2tmxrp;u1aptn fciasfa em( s u) etrmf oodoa rli i;t) etmir3oydomtn ncias)artaum oo1aeenmoeiat sDulnmsnu4artrmf ta1fmt aies;s) 2trir ny1am  lfvias) rra( ont0oexo o3iatlm2em( o t0alxoxo oadfa ranvo;s setoim iydalt lneias aDrm(ro;o4oexoio3tatla2eanmont4aexniocty1fatraies;() 2toxopiudoptemnctl() 2uaumpno0apxn ieiadfm uaumo t4tltrir to1fpD aieslt0 2umxrpio4aptemfeiltfs2ra(mpnt1ole mo3tysfa el( snu4trerifcoydfa eanvi;t0sexr(rpiy1apte fei tfsrraumo;o0tlenmf3tys a2rlnvp (4aeeoxfctotopt  nvo (0 2tr(r3nodale mfct s s2uax oot4tetomo3iadla2eluvp t4 reoir3iotlmt  u o;(0texrimpnu1lm e fvt (f Drrumo;u4alx moctyslsDrl( s;t0 rxoiocootfaD ai i;t) 2umxr iydopeemict sfsDtm(m ;t4tltn ociytfaDumuvon() eeoifctodfp  lneo s trxoxr3nu1aleemiesl( artau ont1opt  iciydfa ua(ms t)tlerxo3iadla rluvils  rtoim3iu4lmeemfetas)sDtrxrpoo4aetnif3ilsfa eluvs;u4 leoif3iatlmteai i ( sexoir iy4am nmicia(farrr( pou1optn oetldfs em( o;u4aexnxo3iotomt  n s (0s2xoxr oudlltemfct (  Duau p;o4opt  ociatfa2el( s t)trerirctatlpDe nvi;s0 exm(m3nodlmee ietas)aDta( ono4alxnif3iat a ua( o;u)alenif3ia1fm e uvs;s srtm(r iy1ale micsat)srururont4ope  i3iys sDuan s u0aeenxfcoatoatelivo (0srtmxopiu1lmtelnet s) 2tmur ;o1tleo ociyt s2rmn onu0 rxnirciy1optraieo;t)trxoio3nydame mfesa(f Drax ooo4altnifeiat aDrlu o;t0aexomf3ty1fmDeau s s0 2xm(mpnydaptnmivtls)aDrmu p;t4openmfeilt s rmnmpn()trerif oy1optr ieslt) eumiopiy4aleemiciasf rtrxrp;u1ale  fciysfsDumn o;(0arxnif3ty1fpDraneo (0s2xrirpou1am n fvt ()arrauro;u0alx  fetad a2umuvp t)aeeomr3oadlaDrli o;s)s2xr(m3ou1lmt lncta( sDta( p;t0oeeo ietls s ranmo;t0tleomr ootomDeaies (0t2xr(mpio4lpee ivil( aDur(r no4olt mf3ild m rm( snt0 etnxf3iydopD anes;t)trxr(o3iu4op e nvsa(fs2tmxmoou0oeto i3tyd m2elnvpnu4 exrxo iodomt aivi;(0t2um(m3iy1op nmictasfa2tax ono1tetoifciyslmDrauvs;u4aexrif3oydfp eaueo s) rtrio3ou1lp  mfct ( sDra(r oo0tpxn oeiys s2elump;t) leoxr tytfpDe i i t s2trim3ny4lmt mnvsltfsDtruroou4aptnmoeilsla2rm( p (0 rtrxf3iadop elueilt setoxrpno1omtelnctlsf Dtrump;t0ope mfctlslm2rmnvsnt)alxoif3oadomDrai s;t)t2xrxmpnydomtnlivs s)srtau pou0teen icilsfaDuaumo;u0arxomr iytlm e uvi;t  2um(r oo4ap  lnct tfsDumxr ot1tpxo ieiytfs rm(mont)altniociotom rai s;t0trtoimpnu1oleelnesls) rua( o;u1alx moeiydla uauvo;(4 rermo3totlm rluei;s) eurxmpiudlltemict s srtauront0oex ii3tls a2elump;u4trxnxr3oatlmtr ues s0trxmiopnu1om emfct s)a2taum ;u4teen oetls aDea(mo t0tetnmr3oy1opDrluvi;(0teurxm iydlmt  ieslsfs2umxmoot4apeo o3iydfm eauvsnt4 lxrmocoy1om elnvol()srxrir3io4ame  fvi s  rrmu onu1opeoioctls a2ulnvp;(0 etoxfciydlat  i ilt0 exriopno1lle  feilsfarrax pnt1ole ii3tltfmDrmu snt)aexoxocto1lat aneslt)s2tmxm3nudlp n nvs t)sDraurpou4tlxomo3iatfm2rmn onu4aeeoirciytfp eau i;t0srxrim iy1lmtn fvs t  2uaxrp;t0apxomo3ias s2uanvpnt)trenmr3oadoate i s t)srtoxo oodop e fvsltf 2ur(rpot0aexnmicild aDem(vs;t4 exoiocto1oa   uvi;s0t2tmxrpiu4al emnvsas)s2tr(mpno4texo oeils sDem(mpn()texnmr tatoa rlueil(0trtmxr3ny4om emietas srrrx  ou0olenmi3ildla2elums u4tlerxf iytfmte i ols  rtr(o ny1am   ivtat sDtmumpnu1ape  ieiyt s uan p (0altnircoadfp  li i;s0srxmxrpny1omtemnviltfs2uaxmo;u1optomf3iatfmDul(vo;t)tetrxo todfmt lueo (0t2trxm3no1lm emfcia()a2raxm ot0oee io3ilsla ulnmo;u0areoxocoadlmDran o ( teurir3nydopt  feia()aDum(mp;u4olenii3iysfsDuanvonu4 lxnxfcio1faDrluvo s  eurxo3oy1om   feia(  Durxmonu1tltniictadfs rlu p;t0texoio ootlm rai sls0s2tr(o3iu4lpeemfvtl(farraurpno1oeeoif3iydla rmn snu)trtrmrcoatlpteluvo;s0trumir iu1ape  fvsl()arumx  nu0opeo oeild a ea(mp;t4 etnxo iodoaDean s;s)teurxmpnodop   neilsf rurxr oo4alen ictytlm umnms;t0 lxniociatoaDeaiei t)s2tmxo no1lle mfci ( sruaur ot1texoif3tyt mDrlumpnt4 eeoiocty1fatelnei;t)t2xrxrpiy4alen neils) Dra(m ou4aee mietatfs uauvo ()aexnirctotop  an i ()trxrio iudalen fes t  rua(rp;t1tetomi3iys mDulumpnu)teenxf3oa1fmDe nvs t s2xrimpiy4openmiet ()aDrrum oo4aetoifctlsfa2ean onu)texrio3tadlmtrlu sls0 euo(r oy1lptnmnvs sfaDurxro;u1tlt io3tydfmDelumo u)arxnir3iydomtr i o;(  2xm(r3nydap emnct tf ruru oot0tleoif3iatfm2rauvo;t4aetrxf3tatfp raieo ()setrxr3nu1lpt  nci t) Dtmuroou4oexnmf3tytlm umn o;u0alenif3oy1op   n slt) 2xrxr io4op emncil()sDtr(mono4altn oetytfm2eluvp (4tlxrmo iotla  lnvslt)seumxm3oo1amee fvs (f 2ra( o;t4ape  o3tysls rm(vo t4alerxf3todomDeai olt)s2umir iu4amtnmfcilt)a2trumpnu4apx if3tlsfm2emu o t)tltnxo tadfaD luvi;( t2ur(opoo1lp   fviltf rurx oou4tpe ifciydfm rluvo u)trtrir3iadlm   i ol(  eurxmpiydamt  neia( a2uru ono4tlxo f3iyslsDem( s (4 lxrmr oatfpDelu s;( t2xo(m3oo1ol  lfvt ( s2um(monu0tlt mo3tadfm2ran pnt0 rxoxo3oatopDrauei;s t2trim oo4omtnmivia() 2rrxrpnu4tpxo iciysfs ul(vpn()trtrxr3tydlat  nvslt0tetrxo3nu1ape mnetasfsrumx  no4tltoii3iysla2em( p ()tltrmo3io1opDrluvs;()srumimpou1alen ictat)sruaxronu0oexnmf3iltls emums (4 rxrmf iatopD lnvo (0 eumxr no4aptnlfvsa()arrmxmp;t1tlt ifeiytfaDraums u4texrxo iy1op r i s;(  2urxo3no4ol nlivt () rrrxmpno1olt mictat m2rlnvsn(0tetnmo3iotoa rlnvo;t) rtr(m ny1ale  ncs t aDrrur nu1olx mi3tasls emnmpnu)tltnmr3todopDeai o;t)seumimpoydamt lfciltf rtax  ;u1tlenmociadfaDem(mp;u0teenxo ia1opD  ies;t0trtoxmpoy1lpenmnesat)sDur(mont4olt iociytfs elnvont)altrifcoatlmtelivo;t0 exrxopnodope mieiasf 2uau ono4optomo3tlsfsDeanvs ()aexnxocoydfpteluvo t truoir iu4am n
\ No newline at end of file
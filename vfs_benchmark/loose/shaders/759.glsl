@@ -0,0 +1 @@
+uvi t)trtr(opnu4al emfcsls  Dtaxr ou4apto o3iatfs elump ()alxrxrcto1fpDeli o;s)srur(r3ny4llte neia(fsDtrump;o0tltnio3ilsfm2uaumpnt0alxnxo3tydfpte i slt  rtr(r3iy4op e fcslsf Dtr(m nt4oeenio3tas s eluvs;(4altrmr3io1opteauvi;s) 2tr(r3iy1alenlfct sfs2ra( o;t4oexn f3iydfsDumumpnt)tetnxo3iy1opte ues t s2xoirpoo4apt  nct t aDrmu poo0tleomietydlsDumn on() ltoxf oadfmD lues;(  eto(mpoudom elnetlt  Duaxrp;o1opeo fcilsfmDemn snu0aetnxr3tadfa  li s;s0srxm(mpiy1oltemfesa()sDrmur nt4tpxomoeiaslmDrm( s;(4 eeoxr3ta1laDe ieo s0t2xr(m iudomtnlivt tfsDtaxro;t1tpxoioctatlmDua(mp;(4aetomo3iadopDrauvilt0tetoxrpio1lmeemfcta(  rurxr nu1aptn fctlslm uluvont4 etnmo3iadlp eanvs s0sexm(m no4ol   nctat) Dtaump;t0tpxo fctat s ua( snu0tleoxo oydlmDe i ols  2trxm3ny4llt  fes sfs2taxm oo0tpxn fcilslmDel(vo t4tetrmr totfmDr u slt0 rumxr3io4ame mnct sfaDrmxrpoo0oexnmfciydlsDemumo;(0 rtrmo oytlp r n olt0t2uo(r3ou1opt  net tfa2trxroot4aetnio3ildfaDel( sn(0aexnio oa1om  an il()seum(o oydoltnmiesa() rrmu o;u1apx  ociyd m ul(vpnt)alenmf3iytom raiei;t) eurio3iu4lptn icils  rrrxmp;o1aetnmieildfs elnmsn(4texnir3iydfpteluvi ( tetoxopoy4lmtemnvias srrr(mooo0apx  feiad m elnmon(0texrmfciotfa eanesls  etmirpio1omeelncsatfsrraxr ;o1teeo o3iatfaDrlnvp;u4aexnxf3tydfmtrlu o s  2toirpoydlm elnetls aDurxrp;u4apxnmf3iltlmDrmuvs (0aexnmfcio1op   uvs s0srurxm iydam   iei t)s2ta(rooo1oexnii3iydla2el(mpn(0trtrmf tytfpt anvsls)t2umio3io4optnmfvtl()sDumxr ;o0tpxo ieilt a2umumo;() rermo3oatfpt  ues s  2urio no1aptnlnesa(farurxr ;u1aptomoeiyt s emnvp;u) rxnmocta1opDrai s;(0s2xoim3oodolen fvtl(fa2ra(mp;t0oeeomo3tytlmDeanvpnu)teerif totfpt  uvo (  rur(r3nudopee iesa( s2urx pnt1ape mfcils aDrlnvs t) exoifciadopDr nvi;() 2tmiopiu4lpteliesl(  rur(m ;t0tltomi3tytlm rl(vp t4 rtnxfciatomDeaivilt) 2tmxr nydap  lncia() 2tmumooo4oexomf3ildfa2em(vp;(4trxnxr oa1op rlu s;s0 euriopoo1om  mnct s)a2urumpno1aleoif3iydls rmn o t0arxomr3oodoaD ln sl(0truo(m3oudop nmfcia( s2uau o;u0tetnmo3iltfm2rau s;()aexomocoytopt ln ilt0trxm(o ny4ll elicias aDtmx  ou1oeenioeiltfm2rauvo t)tlxnirctotlpDr u s s s2to(o3oydal e ncsltfarrmxrpot0olxomo3iatlsDumn s;()artnxf3ia1lpt  uei (  exriopoy4al  lncils) rum(mo;o1oeto o3ilsfm2raump;(4arenmociydlatrlu i;t s2xoirpou4ol elnvt () rum(mpot0tpxnmociatfs ean p (0trtrxf3iydomteaieil(0t2toir3ny4om   fcsls) 2ra(ro;o0opxoiiciatfs em( pn() reomf3ia1fmDr nvsl()setrxm3iy1lpenlneiltf Drau p;u1opeoioetltls2eanmp;t) etoxo iy1opteanvo;t truo(o3ou4alteliesa( s2tm(moot1texnif3tlt sDelnvp;u) lerxo oo1fp  livols t2xrir no1alte fvsat  rrmxrpno0tltomictld sDel(vsn(4trtnmr oytlmDrlu s s) euoio nodap n fvi s  2rrur ou1texo icildla elnmp;u0 lxomrcto1fatr uei;t) ruoir3iydlle  nvsl(f 2rru  no0olx  oetaslm2eluvs;t)artoxo ty1fmD luvolt)texmxopou4lltnlnetat)a2trx  nu0olx  icilt a2um( s;u4 ltrxfctatfm  au o ( setm(mpny4lpt mivt tfartru  no0tlenmoetld s eau p u4 renmo3io1lm  aueslt)t2umio no4llen fetlsf 2rmxronu1ale  f3ildlm em(vpnt0tetrxf oa1oatr ueo t)srurio3oo1ap n icsasfaDrrurpno0aetoifeiatls2rmumo;() exoir iodfpt  n i (  exrim3io4lpe mfeil() rum( pno4altnmoeiltls elums (4aexoir3oytfmD au i;t texoxopiy1op   ics tfaDtmxr nu4aee mo3tytfsDumuvo;u0teerif3iatlptrln slt t2uoim ny4oltelnvilt s2rmxrp;o1apenmi3tlslm ua(vonu0trerir iydfmD livo t) ruoxmpiu1opt lfcsatf Dtrxr ot0aex ioctyslmDul(mont0 etrxr oytom e ivols0srumiopnudome  ncsa(faDtr(rooo0aptoiociyt s2ranmp;u0aetrif oy1fpt  n il() 2toir3ou1ol  mnet tf 2urxrp;o4altomfeiatfmDrm(vp;u4arermfcta1lm r u ols t2xoxm io4ape mivsls  2ur( o;o4oltn ictytfmDra( s (4altnmociy1omtr n ils)trumxmpnu4ol nlivtl(  Dtrxm ;o1tltoiieiyslm2em(vp t)aexrmf3oy1oa elivs s)t2tmirpou4ll   fvil(f rra( p;u0oleoif3tys sDeau o;t0 rxoif tydopt  nvslt)seumiopou4ll e feilt)arurx p;o4aeen fciyt aDemums;()texrmf tatlpt luvs;t tetoxo no1ome  nvilt)s2tru  nu1aee mieiydfaDel(vo;(0artrxr3tytfp ranei s0s2to(opoudamtn iesa(fartm(r nt0tpxniietaslsDum(mo u)aetoxo3oytla ranvo ()seumim3oo1lltnmieia()a2rm(mono4oet iieiysfm2eluvp u0trtrxo oodlmDrli s;t)truo(r oy1ome lnesls a2rru  ;t1ole ifetysfaDrmuvo;t)tlxoio iydlp r ivo s) 2tr(m3nu1lltnmfcs t) 2um(mpou4teto ociatla2uan o;u4arerxfcia1op  aueol(0 rtmxmpoo1lmenmivs s  2rmx  oo0oetn oetyt s2rau snu4 rxoir3iatlpDrlues;(  exoxm nodom nlivtlt)s2raxmono1tpeomfcils a2raumo t4trtoio3oadfpt  n s;s teurim3nudome mncta(fsrtmu ont0apenii3iyslmDemnmsnu)tetrmo3ootoaDr i sl(  2urxo nydlm   icsas) 2um( oou4olx mi3iad mDuanvpn(0 eeomr iodlmtraiesls0sexrxo3oo1amtnmncia()arurx  nt0aexnmiciltlsDrm(mp u4altrmo3iytfp eaivo;t  exrxopiydop nmnvsas aDurxmo;t1tlto f3iysfmDranmo;()trxrxf3oa1fptelies;t)setrim3nudom  livslt srtaumo;o0olxnio3tytlmDelnvs;u4tetnir iadfmDeanes;s s2uo(mpny1ol n fcsat  2tm(m no0olxn fctyd s rau p;t0tlxnir tatlpte ivs s trxrxm3oy4lp elfcta( aDumx ono1oet iietlsfa ean o t0 rtnxrciy1latrau i s) eur(opnu4al   nctltf 2tmur oo1tpenifciadfa2umu snt4 lxrio oadopteaivil( t2trim3no4lmenmfeia( sDuaxr ;o4tpe mocias sDea(mp u4aetnio oa1oatr ueolt)t2ur(opny1ap nlfvtat)arta(ro;u1ale mo3iat s2emums (0trtoxr oa1lmt aneils  rurir no1altelncta( a2ta(mono1apxo oeiltlsDul(von(4aetomo3oa1fpteanvi;( trxrxr3ny4ameelnctls) rumum oo0apxnii3iytls emn o (0treoifcto1lpD lu o;() etmim3oy4ol n fci ( s2tmxm no4tle  oetyd a rmuvpnt4 lxrio3oy1fm eanvslt0sexriopoy1am nlfvta()sDrm(monu1tlx if3iydfa elnvp t4aeeomfcoytlm e uvsls0seum(m3oo4olt lncia( aDtm(  ot1tlx mf3iasls umnms;(0aexnmfcoo1lp eaivs ( srxrio nu1am elnci sfartrx poo0oee iietatlaDuln s t)areomrcoodfmDe neo (0seuoxm ou4amtnlieta()aDurxr no0tlx  oeiaslmDraump;() leoio3to1fmteaies (0sruo(rpoudomee feiat)srtaurpno0openmo3iat a2elump u)aexnmo3iytfmtrlivs;s)sexm(rpnodamte nvia()s2tmu p;t0tltoifetytls ranmp;(4 exoiocia1om raiei t srto(rpnu4lptnmfes t aDua(mpnu0olto o3ildfsDumnmp u0 etomociodlp e uvol(0t2xoim3no4olenlfeta( sruaumoou4apeomocilslm2eanvs;u4 ltnxf3ty1om e neols0texr(m nydlp   ivs sf Dtrurooo1alx ii3iatfmDumnvp;() exomf ia1lm  luvs;t srur(r3no1llt  fcsa()s2ua(mono1tlxoii3iadfm rlu pnt4aeenir ty1la eanes;t) 2toxo3oo1ll elfvi t)srurx  nu4aetoifeiltfsDrmn o;u0texrxr ia1faDelneo;s)sexo(o3oo1lm n fvtlt aDtm(r ;t1tpto ictys s el( sn(4aeenmo3to1latraivs;(0setr(m3nudlle  fcs t arur(r ;u4oexoio3iltfs2rm( p (0areoxfcta1op rlnei s trxoxm3iudol  mncia() rrmxmono1opto o3ias m ul(vp u)teeoio3oatlaDe u ols0s2trxr ny4lmeelictas arrmurpnt4opt iocilt s2rm(mo t)aetoirciotfaD  ieolt t2urio oydameemfctat sDum( pot0aeto i3iytfsDrln o;t) lxoiocta1oaDeluvo t t2xmxo3io4ome mncia()arrrx pnt0aptniieiadlmDemnmo t4 ltrmf3iy1fmt  iei t)srurim3io4omtemnciasfsrtrxr ;u1alxomoctltlaDul(vsnu)tlenmo oadlm eaueslt s2uoimpoudlmt mnci (f rumumpnu4aexn i3tasfsDeaums t4 lenifctadoaDeauei;s  rum(m3ou4amtnmnesa()a2uru pot1optoifciatfs um(mp;u4tleomr oytopDelivi s0teum(opoy1ap elfcsl(farraump;o4tex  o3taslaDraumo (0arxoif3iadlm ranvo (  etmirpny1llenlfctat) rurumo;u0tle iociys sDrln snt0 rxrxfctotom e i s;t  rxm(m3oy4al nlieslsf 2raxmpnt0oltoifctysfs umnmo;t) ltoxocoydoa ranvilt) eumxo3nodolen fct s)arurxro;o1tet mfeiytla uau p t)aeeomfciydfmtr neols0 2xmxr3io4ap  micsa() 2tmum ot1aptomo3iat aDuaums u0tltnxr totoat  u il(  2xoio3io1lmtemieil(  2trxmoou0tpen o3ilsfa2rau p t)trxrmo3oa1om r nvi s)s2xrxm nu4lptelicils)aDur(rp;o0tpe moetat s2ranmo;(0arenmo ty1lptelies () rur(mpoodomeelivsatfs2trxront4tpxoii3tyslm2ra(vs;(4aexrmocoytfpte ivsls  2xoxo3ou4ol elfes (  2rm(m nu4tlen f3iyt a2ra( ont4 lxrxrcoa1om  ln i;t0 2xo(o3oodapeelfesa()s2tmx  ;o1oltnmieiatfa2rm(mp;u) exoxf totfatraiei (0seto(r3io4om   ivia( s2umumpno4apxomicild a2ra(mpn(4aexrxr3oadoa  lieo s)teurimpiy1am  mnci tf rurum ou1opxnmfciadfm2ulu s (0arerifcty1lm e u i;t  eur(r3iy1lpe mieiasf Dra(r nu0tet mietltls ul(vsnt0 exoiociatla r u ilt  2umiopoo1ol emfvt ()arrmxrono0altomieiyd m ranmsnu)treomocoa1laDelivo (  exo(r3iodop n feilt a2tm(mooo4alxomfeiytlmDemnmo t0alxrir iydlp raieo;()t2xm(o nudapt lfetas) 2umumpnu1tlxo ieiat aDuanmsnt4trtoxocoodfpD  iei;s)trumxo oodal nmnvilt s
\ No newline at end of file
@@ -0,0 +1 @@
+ivi t0 rumirpiu4altn ictls  rtmum oo1tpx ii3iyd aDuln p;()trtoio oadlatrlu sl()t2xoxopiydllee netasf Dtm( p;t1texniietyslm rmuvpnt4artoxocoy1fm e n o s0srur(o3no1am elfetl( srumxr ot1aexo fciydls ulnmo () rxoxf todfa elieil( sexoio io1alen ivta(fa2ur(mo;t1alt iiciyt sDrmnmp;(0 exrmfcoodfatelies s t2tmxm3nudamt mnvil(fsrtm( pno1tpxo ietyd m rm( o u4 ltomr io1fm eln sls  2xoxr iy4lptemnei s)sDurxr nu0apxo f3tlsfa rm( pnt) lxrxfciatlp rlnei ()seumxo ny1am   ivsas artaxr oo0alto iciatlmDulnvsn(4 etnif3oo1la  aueo;()s2umxrpny1opeemicil( sDrr(r ou0oetnmoetatfmDrm(mp t0trxoxo3iytfmtr u i () rtmxm oo4lmeemnesltf Durum nt0aee miciad m2eau s u4aetnmf iydfa r nvo ()s2uo(r3ny1lpee fcia( s2tmu  oo1tltnmfciysfaDumnmp;u4artomo3iotomteauvsls0 rur(rpnodomt mneiat aDrrumoot1olt ifctad sDrlnvs;u)tetrxf3oo1lm  auvo;t  euoxm3iydale  neta(farua(mp;o4oet mf3iyt a2um(vpnt)artnxfcoo1fm eaivi t)t2trirpnodome mfvsasfsDta(mpot0tle mfeiytfs2uluvs;t4tlxnif todoateaivi;t)setrxo3oo4lm emnvt t artax ont1aptomoetlsfm uanvpn()aetomf oadopte ueo s0 exo(opiu1lp e ivil(farra(moou0tee if3ilslm rmums;t0tltrxfcoy1oa eaies;s0 rxrio io1om e icilt)arrr(  oo4aeenmo3ias s2rm( o;(4 lxrxf3tadomteanvo t  rxrimpoy4ale lneslt  2ua(rpnt4altnmietld sDelnmont) reoirciotom elivs;()srtr(m3oo1am  mfcil(f Draxrpnu4oeeoioeias sDumuvs t0 lxomo oytlpt  i olt0 rtrim3no4al n ivs s) ruaxr ;u1oet io3ildlmDeau sn(0 ltoxo3tadfatelnvils trtrim3iydapt  netlt)s2trumpno4open ieils m ran s u4tlxrxr iy1fmtraivo;(  2um(m3iodape  nctas) Dtaum oo0alt ioetlsfm rlnvon(4 ltomociodfaD ln s;(0 2trir3ou4optnmfctas sDrm(rpnt0alt mi3iat aDrmums;t0aetnxf3oy1om  lnvi ( sexrxr3iy4oleelict ()aDurum ;u1olxomicils a2ran o u4 lenif3tydlp rlues (  2umxrpoy4lmee neslt s2rr(rooo4oet mfcils m em( p;(0 eerxoctadopDeaneo t  rtm(m io1omeemnci s)a2umxmpnt1opxn feiys sDul(mp u4treoiocta1la r ivi t)srxmxo3iu1ap n fetls)aruaumono0oet mfeiltfa ra(ms;(4treoifciodlm  lies s)trto(mpnu4olenmicsas)aDtr( pot1opxomoetasla el( onu) rxnmr iotoa rluvs s0 2urxo3ny4lpt mfvi (fa2uau pot1oetoifctasfaDrl(msnt4aexrir iatla rlueo;()teum(mpou4lm emivia( aDuaxront1aetomiciyslm raump t0tlenir iotfp eaivi;(  ruo(m iu1lmteliesl()a2rmxr oo0oee  ieils a2rmu o;t) rxnmo tydomDr u o ()teurxr3oydame mivia(  2trx pot1apto o3iyt aDrl(mpn(4trtnmr totoat aueslt)teurxm nudope  ict tfsrraxr ;t1tltn octydla rm(mp t0texrmoctytfmD lu o ( s2tmxrpny1lme lici () Dtr(  ;u4tetn i3tlslmDrmumo u4tlermo iadfmD  ues;(  exoxopnu4om n ictls a2rmxrpot1apx if3tadlaDuluvs ()trenxrcty1fpte iesls0texmio3oy1olt  fesat  Dta(rpno0tetnmoctysfsDra(mp;t0teerxr3ty1la eln i;(0t2trimpiydomee fcslt arraur ;o1alen iciytla uau p;u4 lerxo oo1fpD auvi;()trtmxmpny4op  miesa()a2ra(mpou0opeoiictyt aDrln p;(4alxrxocoydlm elu s ( t2xoxrpiodapt lncsa( a2taur ot1ole iociat m rmu o u4 exrircoo1omt li s;s)srxrim3oodllt mnetlt sDraur ;t0ale ifcildfmDea(ms;u0arenmrcoo1faDranvslt setmxm oy1lm   fcsas  rtm(roou4tetnifctltlmDumuvsnu0alenio3ta1op   uvo;s) 2triopoo1lpt lncs t s2um( oou1opx ifctyt m2rmnmo t0tlxnmr tatomtean o s s2uoimpiudam e fesa()aDuaumoou0aexo f3iatla eau p;u)tltriocoa1fmt  iesls)seuoxr3io4lltelneiatf 2tmxm ;o4tlxomocilsfa uanmp t0trxrircoytoatr ies;t) rxo(r3oo4olee fetls)s2rrurpou1tlt  oeiydlm eau p;u0 exoxf3oatfa  lu o t  2tmio nodom emieia( srtmx  ot1teenif3tydlsDumu s u)aeerxo3tatomDeaivs;t  2uoxr iy1ole  fvsls aDraxmpot4tee ifctytfm2emnms;t0arerxo3iy1lpt  i ilt0trxo(rpiydlme livsls)arumxrono1alxo fciysfaDrauvo (4alxrmfcoytfmDraivi;s srtoxr nydlp  mncsat sruaxrpoo4aeeo fctlt m2emn onu4 ltnxr3to1fateai o t trxo(opou4lmtnmietlsfa2um(ro;o1olt  ociltfaDemn s t4artrio oydlptrlivsl(0 ruoxm oy4lp  lictlt) rtmx  ot1oee mo3tatfa2uaumpnu) lenmociy1fa raivi t t2xmxm3oodam  lnes t) rtaum ;t0apt mo3tatfaDrmuvont)alxnmr3oa1oaDr n o t0texoxmpiu1lpe miesa(f Dtm(m ;o1texomiciytlm2em( pnt0aetnxo3oa1la e nei s0 2xrimpnu1om   fvils s2raumpot4apeo ietytfsDuan snu) lerxf3iydlat ai o;()s2tmir3nodalenlfvt t)s2rr(m ot4ope  o3iltlsDrm(vsnu)alxnio3oydoaDeli il( truoiopoydam  lfvt tfarum(  no1aee  fciadfm2rl( pnu4tetoir3tatfat liei;(0sexrxrpiu1lp  mnvtat s2um( pno1texn o3ilsfsDea(vonu4trxrxrciytfa rauvo s  etrir3nu4amtemfvt ( srtm(rpou0tpeniociat aDeanmo t0trxomocoodfmte ivs;s trurxr ou4lmtnlneiasfa2rrxro;u0aex  feiatfa rmnvpnt4 rxoxfcoatlpDr uvs;( t2um(opoy4lmenmnesas  Drmx p;u0tet mf3tyd a umnvs (0 exrmf3iy1omDeai o;(0s2xo(r oy1lm e fctat) rrrx  ;t1oexnifcild aDul( s;()trxrxrcoadfaD au o;t  eumxo oo4alt  ict s)aDrrx p;o0oetnioeildlm elu s;()texrif iytfpt li i s0 euoir3oy1openmiet s)arrru  nt4apx mieiat aDulnmp;t4altomo oy1la elivs;()srtm(rpiu1lpe lnctat a2taumonu4tpxniieiydfaDrmnmont4 lxrmf3tytlmt an i;t  etmimpiydalt livs s)arrrx o;o0tlenmfeiltfa um(mo t0 lxnxf3iydlmDrluei;s0s2toxm3io1alte fcsl(fs2ur(m nt4tlenifciadfa uanvs;u) eerxf3tatfa e neil(0t2xmir iudlleemnvsasfaDtm(ro;u1apenmieiyt s emump u4alxoiociotla  luvolt)trxmiopiudlpeemncta(  rta(root0oltomf3tld m eln p u) reomr3oy1lp rau il( trxriopiudlle  fes () Draxrpot1ope mfciys mDelu o;(0aexrir3iydopDelies s0s2toim3no1lp  lfet s sDrr( onu0aptniietas m2um(mp u0 etniociy1omDeai sl()t2xrxo3oo1ap nlnciatfs2rru o;o1tlt ifciatlsDeau o;(0trtnmocta1faD aies;t0truoxopoo1ape  iet tf rtmxrpno1tpxnmfeiltlm2umnmp (4tlxrmocoytlmDeaieo;s  rxrio oo1apenlfes () rurxmp;o4opxoiietydfa umnmp u4 etnif oy1lp   ivo s0 exmir nu4optnmicilsfaDtau pot0tpt if3iydfs eln s;u0tlxomo todfaDeli slt0 eur(m3iydopeemfvs t)artaurpoo0tpe  ietas m eau onu0tltnio3ia1lmDr iei t)t2um(r3iudame lnciltfsrta(  ;t0apxniociysfsDum(vp u0alenmf iadlp eln s;t0t2tr(o ou4oleelfvtltfarra( ont4apt  fetlsfa eanvpnt) rxoxf ty1omteanvslt0 rtoimpiodomt mncslt  Dtau  ;t0aeto o3tys s2elu ont4aeenif3ia1oa  ai i;t sexrio3oodaleeliesls)s2rrxmp;u1oltnii3ildlaDua(vo;t4tleoirciatlp elu o t  2urxo3oodam eliesat a2taxm nt4aetnii3iat sDrm(mpnt)arxrir todfm eauvils)srurxo3iy1lle lfei t srrmump;t1alx  octysfm ulnvsnu)aexrir tadfptraueo;s)tetoirpnu4amen fvi s  2trxr nu1altomf3iatfs ulumo;()arerxo3oo1opD li sl(0s2xoir3iy4olenlictl(  2tmx onu1ape io3iatfs2el( p;t)altniocia1latr uei t0trxo(r oydaltnlicta(fsrur(r ;o1apeo ietatlmDumu sn(0texoxf3iotlmDrlnvils)srxoimpoo1lp   neilt  2rauro;t1tet ifciasfsDel( p;u)tlenir ty1fatrai ilt  rxrxm3nydlp e ietat  rrmu  oo4aexniictadla uln p u) exnxf3iy1opDeluvilt) rxrirpou4ameemfcsltfs2tm( o;u1olto fetas m um(vs t4alxnmrctatlpDean o;(  rxrxr3no1omt  fcs t)arumum ;t1opeo ictad mDea(msnu4 etnmr iadom ranvo;s  2xo(rpio1lp nlfetlt s2ua(r ot1apt  feiyd a2uaump u4alxnmr3ty1lm rluei;s0sexm(o3iudal nlfvsatf Dtmx  nu4oeeo ieiytfaDelumsnu4tleoio3iy1omtrauei;(0trumimpnu4lmtnlfci t  rtmx oot1oeeomf3iatfa2eauvpnu0artnxf3io1lmDran s () etmxr ou4oltelncs s) Drrumo;t0aleo feildlm2eau onu4tlxoircia1fpt  uvi () rtrio oodlltelfesa( sDrmxrp;o0alen o3ils sDrln o;(4aeeomfctytlm  luvi s0srxm(o3nodlmeelneil()sDrr(root1apxnif3iad a2ul(mo u4arerxocio1late n s;s0srtr(r3oydlle lieils)aDrrurp;u0tlt ifeiad s uau o;u)trtnmo oatfm eaneil(0seumiopou1op e fes tfartmx pot0tlenmfetat aDranmo () rxrmr oodoat ai i (0seur(o3iy1lltn nvtasfaDtax pou1tleo ieiltfs2el(mpnu)aetnifcta1fatrlnvs;(0teumim3nu4ol  lfciasf 2ua(r no1tltn i3taslm2rmu snt)areoxo3iydlpD  nvils0sexm(m3ny1omtnmicias) rum(roou4opxo i3tydfa2rlnvs;u)tetnmr3ty1lat ai s t  exm(mpiydaltnmnet sf rtax  ;t1aptoifeiydla ra(ms u0aetoir oadfat ai o;t0trxmxm3ny4lm   fvsl(f rtmx pot1teeo i3iad mDrmuvp;u0trermo3iotopt  ivi;t0trtrxopiudap n ivi tf 2ra(mont1apxomo3iys s umump;(0altrxf oydlm raneils srtrxr iu4amen fvs ()s2tax  ;u4alto fciltfs2ean snu4 lerxfcoytom elueols trxmim3nodamtelnci ( sDrrumonu1opto iciad s emn o;t4 rxnxr3iytfp e u ils  rtoxr3oy4lm  lnviat)sDtm(mo;o0apxn ieiyt m rmump;t)trtnifctydfpD au il( s2xriopnu4apenmnci s  rtrxront0aex  o3ias m ra(vp t)aexrmf3iotla e nvo;()teurxr nu4ll e fcias sDtmxmoou0aex mf3tltfa rlu s t)aetrio3oa1lmtrlivi;s sexr(o3nodlmenlicsa()arrmu pou0tlx  f3tasfm rlump;t)arxnxf3iodlpt  ies s teumio3oy1op  mietlt) Dtr(r nt0aex  ocildfa umuvsn(0 rxomrcoy1fmDr n s;t)t2trxo3iudolte ncsatf Dum(mpoo4opxniicilt sDemumsnt)tlenio totfpDr uei;s) rxm(o nodlltn nvi ( artau  no4altnmociat aDea(ms u0artoio3tadlat  neslt) exr(r iy1amtemnvsas  2tr(mpot0tpt  f3ild aDeaump;() etoio3oatfpDrau ol() rumxr oydllen nctat)arurxm ;o1tleo ociasla2umuvp;(4altnxociotfm r nvsls t2uoir3nu4om  lics (  Drmx  nu1oetnio3tadfm uln pn(4aetnmo iodlmtrauesls trumim3nydlle  fetlsf 2taurp;o4altoio3iysfaDumnvont) lenmo3oa1lmt livils sruoim ou4lme  fvs s aruauroot0oeto iciyd m2ulumo (4 etrmo3oadfatr i ol(0seuoxrpoy4opee ncia(f rrax o;u4oltnioctldfm2um( s u0alxnxo3io1fm   neol(  euoxr3nodap emict s  rtr( pot1tet mfetlsfm2uau p t4tleoxo3oo1om  lu o s) 2umir3ny1ap emfcta( aDrau o;o0texomieias m2uln o;()aleoxo oa1laDeai ols srxr(r ou1omt mieiat  Dtrur ot1optniieilt s emumpnu4tlxnxocootlaDr uvsls t2uoxmpny4lp  lfcil(fa2trurpno1aee  feiysfa2rmuvo;u)tlxnmo to1opteanes t0 euoxo nu1lp e ieilt  2rm( poo0tle ii3tld s2rm(ms u4trtnxf3tydfa r ueo;s) ruo(rpoudll   nvt s) rrrurpot0tpe mi3iatfaDumums t0tlerirctatfa  auei;( s2tmxr iu4apenmivil()artrumo;o1aee  ociltfs uluvo;t0 rerir tatom   nvi (0teuo(m3iy1am  mfcsltfsDtmxmpot1tlxn feiltfs eanvo;(4 rtrxf oa1omDe u s (0trxm(m iu1lp  mfesltfsrurumo;t4tle iieiys sDrm(mp u)teenir totfatr nvs s t2uoiopoodomt mncslt aruru  nu0olto ictysfsDuanmp;t4 lxoxo oa1om eai olt)teto(r3iu1llenmnvi s) 2ra( o;o1opxo o3tydfm eaums t)aexoif3todfa e n s;t0s2xm(o oodame miei s)s2ur(r ou1tex mfctltlm2elnmonu0 ltrmr3iydlaDrli i s trxoxr3ou4ol nlneias srta( o;t1alxn fetat s ulnmp;()tetrxo3iotlaDe ues;t)seur(opnu4ll nmietl(f rtaurpnu1aeeoii3tyd aDem( s;u)tltomoctydfpDelneo s) 2um(r3iy1ll elfctlt aDuaumonu0olxomoetydla2ra(vp;u4 etnir3io1optran i;t  exoiopiy1lp elfcias) 2urx p;o0opxoiietyslm rauvpn() exoxocoatla rlu s t)sruoirpiydap e ictasfaDrm(mpnt4altn fciytlaDulnmp;t)trxnif3to1fp e ivi s setrxm oo4oltelicta()srtr(  nu1opt  f3iyt sDulnmonu4aexoxo3oy1fmDeanvsl( trxmxo iodomte nvt ( artm(mpno4opeo octlsfa2rm(ms t) rtnxr tatfaD aueo (  rtoim3iodll  mfesatfs2ta(m oo4oex miciysfaDrm(vs (0 etomo totfpDrauvi s srxo(m3ny1llenlictl(fsDuau o;u1tlx  ictlt aDrmnmp u0altnmoctotop e iei s) euoxm3ou4lpeelncil()aDtm( ooo4apto i3iatfa2ranmsn(4aeenif3totfptran olt)trtmxrpoydlmt  icsl()sDumurp;o4optomieildfaDulnvs ()aexnio3to1lpt lueo;s)srxrxm3oudllee fvtls aDtmurpnu0olxoioeils s2rm( ont4 rxrxoctatfpDe u o;t0t2urimpou1llte netltfarrrurpou1alt iiciadlm rmnvo (0 etoxrcoytlateauei s)t2xr(mpnodalt lneiasf rrru ooo1aexnmoeilt a rl( o;t4altnif oodlp ranes;s trtmxmpiu1optnlnvias  rtrxrooo1aexn ociat sDua(monu)treoio oa1lmtr nes s s2tr(m3ny4lme livsas)sDta(mooo1aet ioetydfs rm(msnt0areoio ty1fpD lnes;(  etoxopnudlp n nvsls) 2raum no4tleomoctadlm2emn snt0 lenxr3tadom eanei (0t2toiopoy4lm n nctat)s2taxroou0oexniociytfm2ul(mpnu) rxrifctadfp   ivi t0sexrirpny4lptelnvia()a2tmx  ;t0aeeo fetas a2rm(von()tltnio tatoate u i;(  2uo(m3ou1alt lfcil(fsrtm(ro;t4tle  octyt aDrlnvp (0tlxrmf3oa1lmteluei;(0 2toimpiydlptnliesa( s2rm(r nu0aexoio3ils a rln o u) lenxf iatfpt  neilt teuoir3oodamee iviltf rumumont1tlenmi3tyslaDra(mo;(0trtomr io1fp ean i t0 eum(rpiy1ome lneia( srrr( ont0olx ii3tys m ul(vo t) leomr oa1latraneols0t2tmim oydaleemnesa()a2rau pnt4tleniociyd mDelnmo;(4 lxnmf3iotfaDrluvi;t0t2toim3ny1aptnmnei ( s2uaxro;o4aeen f3ils m2em(ms;t) leomrciatfmt  u il(0srumir nu1lme lnei t)sDurxm ot0aexnmfciydla2ua(ms;(4tlxnmo3iytoat auei s t2xrxr3iodlp elnet (fs2uaumpou0aeenmocilsfs emu o u0 ltnio3oa1fm r nei;()t2ur(m iodapte ivil()sDum(mpoo4oltn o3iat a umu p u0arxnxf oytfpDraivo t)texo(mpoy1olt mfctas)aDta(r nt0tleoifciltfm2rm( onu0altrmrctotlm e uvo;(0trum(r oudapeemfvtlt)a2taump;u4alx  octad sDuln s (4trerircia1fm e neo s  2xriopnodlpe mfei s s2uaxm nt4apt ifcildfm2rmumo u)aetrif3tytfa raneo;t  rto(r iy1lptnmfctls s2ta( pou1apx moeiatfmDrau ont0 eenifcta1fa ranvi;s seuoir3io4om nmfesatf ruaump;u4alxomictldfs rlump;(0tleomo3ootlptelues;(0 rurxm3oydlltelivsls  2um(mpot4oexomfciadlmDuau o ()areomf3tatfa rluvi () exm(r3iu4alt lfcta( srtau  ;o0aet moeiadlm2el(vo t4trxoif ty1laD au s t  2to(r oodoptnmivt ( a2trxrpou1olxomf3tlsla rmnmp;u0tetnifciy1lp e uvo (0sruo(o3oy1ame lncias) Dtrumont0tpxoiociadlmDum(mp;t0aleriocoodopD  ivol( s2umxrpiy4ll elnesls)a2ra(mpoo1aexnmi3ilt mDean o;t4texomf oatoaDeln ol(0t2uoim iy1omenmneias a2raur nt1altnmoctatfs2ua(mo;t4 ltoif3oo1om  lu ils  eum(r3ou1lpt mfcsat  Drmxrpnu1olx  ieiytlmDrlnvs () etnxr ty1faDelnvilt srtm(rpoudame mfetasf rrm(  ;t1tlx  ietytlmDelnms t)trenif3oy1lm rauvi t) eumxo3oodaltemivs s aDurx o;t4tptniiciasfm uanmpnt) lxrxf3ootfpDeau ol( trxoxopiu4omeemnvsl()srtmxmpnu0opx  f3iatls rm(mpnu4 lxnmo3ootla  ai i;t)tetmio ny1al n fviltfaDurx o;t4aexn ieiadfs rl( p;(4tlxnxf ty1la  ai o s)t2uoimpoy4oltn ivias)s2rr(  no0oleoif3tysla2rlnvp;t)altoxocootfpt ln ils) etmxo iodalee fcilt srrrxronu1oetoiiciydls eauvs;t) exrmf oydlm   nvi t)s2urxmpoodamtnlfvs tf 2rr(root1aeeniieiaslm emn sn(0teermf3ty1lm  livols0 rxrir3nu4amtn icils)a2raxm nt1opto feiaslmDeauvpnt)tlenxf3oatfp r ies;( trxrir iu1olenlfet s)a2tru pou0oleo ietatfm rmump;(0trtniocoydopteaies;()setr(o oudlmtemiciltfsDrr(mp;t4apeoif3iasfaDem(monu0arxoir oadlmDe nvsls  2trirpno1ol e ieslsfs2rr(ronu1olxnmf3tldla ul(vo;u0tltrmf3oy1lmte nvslt) exm(m3ny4lm e ivils) Duaumpou1tpxn ieiat sDeln p;u0alxrxr tytop  lnvi t0setr(m iu1olen ietasfa2umum nt0olx ioeiltls rmuvs u4arxrxf3oy1oa elu s;s)t2xoxopiodlmte fvsat sDtrur ;t4ole  feias sDuau on(4alermo3iotoptran s t trumim3oy1omee ivi t  2urumpnu0tpenmf3tatla umuvpnu0arxoxf oytlp elivo (0srxmio no4op   feta() ruaxrooo0oleniieiadfa ulnmpnt0teenmr3oo1fmDeaivo (  euoxo nu1amenmfei t  rumumont4olx  oetytls rln s;t4aleoiociytfaDelieslt)sruoxmpoudoptnmici (  Drmumo;u4oeeomoeiyd m2ua(vpn()arxomo io1fp rai o s0s2uoxopoy4al  lnvil()srtaxmpoo0opxn fciat m eluvsnu4 rxrif iy1fpD lnvi ( texmiopnu4ol e fvtas aDtrxmonu1alen ocild sDran s () etrxoctatoaDr ues;s  etm(rpiy1ale mnvt ()s2ur(ronu1tlxn ociyt m emuvsnu0alermf3oo1oaD anvo t  rumir3iodolenliesa()arururono1ole  iciydfa2uau p (0 rtnirctadlaDeanes;t)trurxm3no1lpenmfesl( a2raur ;t1tpto feiysfa2ean p;()trtnirctytlmDeln o t srurirpiu4lptelietas  Drru oou4altniieiatfs elu s;t)trermo3to1fat lnesls0setoxopnodol  mncs t s2ur(rpot0tex mi3ild mDrmuvsn(0 exrio3iadomtrliei;t0trxrxm3oy1lm  lfeiat)aDrrumo;t1tlx ifciad m2el(mpnu0 etrmf io1fpDr n sl( s2triopno1ame lnvs sf rraxmono4tptoifeiytfsDemn pnt)altrxr tadom r n sl( sexoxmpoodol nmnei tfsDtaxrpou1tlenmoctldlm2el( o u)tlxoioctotfaDr i o ()trxr(r3io1alenmfci ()aDtru ooo1texo feiydfa2rauvonu4aexrxo tatfpD an s s  eurxopno4am nmnvsls)sDtrx oot1aleoifctadfmDraump t4texrxr tytlp   n i t) rtrir3iodomte ivsls aDum(  oo4texn ictatfm2elnmp;u)texrmo iydopD lueo;s)t2xr(opiy1lpe  ivslt a2tru pou4tpx  fcildfm2um(vs () leoxf3iadom  au ols  2umxr3iydopt lies s)s2rmuront1tptnmoeiatls umuvs;t0 exoio ty1omDe n ils t2umxmpno1lm  mivsasfartrumonu1altoifeiys s2el( s t4altnxo io1opDrli s (  ruo(r oydlpt  fctlt artaumoou4apxn feiad m2em( o (4 eenio3todlaDrau i s0s2uoxopiu4lmtnmiesa( sruru o;t0tex mfcilt s2ulu pnt0arxrmfciatlmt  i slt)srxoxrpny4ap n fvtl()sDtmumont4texnmfciaslm2uln o;(0 rxnio ty1opDeauvol(0sexm(m no4amtnlivils)a2uax oou1alx ifeilsfsDemnvs t0trxnxrcoy1omDrauvi;t)s2xoxr3iu4lpen feiat artrx pot0tpe mietat mDemuvp;u4tltrxrcto1fateli ils srxm(o3nu1amenmnvta(  Dtaxmpou1alxnifciatla2ua(vpnu4aetnirciodfptraueo s0texmirpny4amenlfci ()s2um(mpot4olt mo3ils m uanvp;u4arxoxo3iotomt aues;(0 rxrio nodopeeliesas) 2tmur ;o1opx  oeiad mDemumo;t)artnif ta1oa e i i;s) 2ur(rpou1lpe  ivtlsfarrm( o;u1olt mf3ildfsDrmu onu4arerifcootfm   ies;s  2uoir oydolee ictasfa2uru pnt4oleoifcild m2ea( s (4aexnxfcoy1fpt anei t)t2urim oydopenmict t) Durxrp;u4aeeomi3iadfsDeaumsnu0 lerir3iodlmDe i slt)sexr(r io1amt lictl(  rraurpou1tle mietytlm2uan o u4treoxfcoa1lmtrau olt0 2umio oo1opt mfei ()a2uau oou1tlxoio3iyd aDul(mo;u0tltrifcoytfate ueil(  2xoimpoo4lmeelnctatf 2tmu oot4tee  ieiytlmDemnvs ()tleoxf3iatlaDe uvolt0srxr(r3iydamte netasf Durxro;u1oex mf3iysla2rm( snt4tlxoxrcootlaD lnvols srxoim iy4amenmnvia()sDrax  ;o4opxnifetadfa elu o t0artoxrcty1latelivslt)tetr(mpoo4opeemnvs (f 2taxronu0tet  fetat a rm(vpnu4 rxoxfctydlaDrlneo (0teurio3oo4omee ieia()a2rmu  no4optniictatfs2uauvp;t4trtrmo oatlmteaivs;s0t2urxm3nudlm nlfeilt) rumumoot0tlt mf3iad m rmn pnu0 ltniocoatoptr ieil()setmxm3oydolenmnctl(faDrm(ront4aeeomictydfm el( s (4 renmo ta1lp ran ils srxm(m oodaptnlnvs () rrm( oot4apx if3iadlsDumump u)tetrmf ootlmDr ivils)tetmim iy1ap e fvi s)sDrmumooo4apxn ieiltfs2ua( pnu)trtnif3iadlateli o;t) 2tmxo3iy4alee iei sf Dtaxmpnu1aptomfeildla emu snu0 lermf to1lp rau ol( sexoxo iy4al   neslt)arur(monu1tlenmf3iys mDea(vpn(4aeerxo oy1lp  li il()srtoim ny1lm nlivsa(f Dumxmp;u4olxn fciytfsDrlump t0tetrmo3tytlm rlu i;s0srxrimpoudlpte netat)sDtr(mpno0aeenmietlsfm2rl(mo t0alenmrciydfpDrln sls0trum(m oodoltnmfcsltf Duru  no1alto ieiydfm2rm(mo ()tetomf3iy1oa   nvil( sexoxmpiu1ope mfcs sfaDumxr no4ope mf3iatlm rmuvs;u4 leomfcoytlmt au s s0 2xo(o3nudame mfvilsfarrru p;o0olenifetytfmDean s;t4tetnxo ia1fmDr neo s)s2trir3nydll nlies s)s2rm( oou0oeeoiieiytfaDrl( snt) rxrmo3tydfatranvs ( srxmimpou4altemivtl()srrax poo4opxnmoctat aDel(vs;u4arerir todop  aivolt  euoiopiy1apeemieils)s2raxro;t4tpeomietysla2rlnvo;u) ltrmo3oo1la rauei s)s2umio3ou4ale mivsat)s2rmurp;t1tltoii3tys s2rauvp;t)arxrmf3oy1opte nvil(0srxmio oy4apenmiei s)sDtauront0tpeoifcilsfs2raumpn(4aleoifctotlpDeau i (0s2xr(m iu1al n nesatfsDtrurp;o0olto feiytfm umn p u)aeeoifciatfm elieo;()t2xoir ny4lme lnvtl(f Durx  ot0aetnmo3tlt a2rmn s;t)alerxrciatom   nvil() 2tr(r ou4alt  ics tfsruax  ;t4oeto i3ilsla eluvp;u)treoiocto1fm  an ols)t2trio iy4ll  mietasfsrua(rp;o1tptnifcilsfmDel(ms (0arerxf3tydfatranvol() rtr(m iu1lp   nvta() rum(ro;u1optnmo3ias sDulu s t)tltoxocoodopte uvils0 eum(r nydoleemietat sDrmxmont0teeoii3ildfa uluvs t)tltomrcoa1oaDelieil(0t2xr(r oodlmtemivi () 2tm(rp;o0apx ifetytfaDumnms (4texrmr3ootlaDelnvolt)texrxmpnu4alen fes tfsDua(  nt0texomf3tytfa2eauvonu)arxnmr ootfptraieols s2tmxr3nu4altelfctlsfs2tm( pot4ope  oeiys s rl(vsn(0trtrmo tytom  aueils srtoxmpnu1oltnlics t)aDta(mpot4olxo feiytfs eaump u) rxnmocoatlmt aieol()trxr(m iydom emncs tf Dtru onu4tlxo f3tyt a2elu o (0 lxrxr3iodlpte i i t0 rurxo no1om nlncs tfaDrau  ;t4opxo ieiytlmDrl( s () rtrxr3ootoptelieol(  2xrxo3ou1ap   ics t aDtmxroou1tlx io3ils s um( snt0 rtomrctatomtrauvi t  rtrxr3iy4aptelieiasf Dumu  ;t4texnioctadlmDul(mont)trtrmfcto1lm  ai ils s2xrxm iodllte fvtlt sDrmum oo1aptn ictadls ua(vpn()alxoir iytlpDrauvils0srxrxm oodlltelnetlsfarrrxm no0alenif3tls m2eluvo;(0alxrir oatla rlivo;t0srum(m3oo1lptn ivsas) Durum oo0aptnmi3tatfmDuan on(0 eenio3iotoptrln s;(  eurxo3no1om nlfct (  rumxmpno4tltoifctasfa um(mpn() lenxfciy1oa  luvi (0t2trxm iu4apt  nei t  2ur( pot4oexomo3iaslm umu p t)teerif3ia1fmtran ils)tetmxo io4opt lncslt)srua( ooo0tpe if3iltla rl(mo u)aexoxfciotlatr ieil() 2umxmpnodopenmnvt ()a2rr(r nu1oltomo3ildls2ulnmp;t0tetoifcty1la  livolt0seur(rpoudop nlnctlsfsrtrxm nu0tpeomfctyt m ra(vs;t) eenif ta1fp   uvol() rto(o3iydal emiet t)a2trx  ou1aeeo feiytfs ulnvo;u) rtoiocta1fpte nvo s) etr(opio4lmen fvt s a2ra(moou0tlen iciysfm uluvo;(4 rtrio3iodfptr ivi () rtmxm3io1ope lfvs s)artrumpno0aexo oetasfs elump t4trtnxfctodoat  uvo;t0 2ur(o nudopen fvtlt) Dtm(root1aeeomf3ildls el(mp u)tlxoxrctatlp  auei t0 rurir3no4opt  iei (fs2ta(mp;u1altnmfeiaslmDran snt) eerircia1oatrli o;t  2uoim3iudol  livia(f rurum ;u0tex ii3tatlm umn o;u4 etriocta1fm  lnei;(0sexrxrpno1ol emfvsls  rrax  ot1oeto oetld s2raump;t)trtrio3iotoptrlu i;()t2tmxo ou1ol   nvtas) 2trxr ot1apenmfciadfa2uln ont) eeoioctydoaDraues t0 2uoirpio1omen ivtas) Drr(r nt4aetn ieils s2um(mo;()tlxrir3to1fp  aneo (  exo(r3no4am  lfcias  2um(m oo1tpeomo3tldlaDemnvo;(4 renxrctadlaD lnvi t)s2umxr3nudlmeelicsa()aDuru pnu1tet ioetaslm2uanms u0tlenircia1fm rluesl(  2ur(o oy1lpen ietltfa2tru p;t0texn o3iyt a2eln o (4aetnmf3oa1omtrlneols) rtrirpny4op e iesls) rta(m ou1tltn o3iat m rlump;(0arerxfcoodopteai s;t srtmxopou1open neslt aDrmxmo;u1tle mociatfaDemnvs;u4alxomo iadomt lu s t srurxo no1lmen fcilt)srraxr nu4tlxnmi3iys sDemnvo t4aetrmo3iydfa eaiesl() rum(r nudaptnmfvsat)s2umx o;u4alxnioctadfaDrau pnt0tltrmr oatfptean olt)t2toiopoy1omt livtl() rrrx p;u4teto oetysfm2ra( o u4altnir to1op e uvo s setrio3oo4olt lfcilsfsDtmxrpnt1opxo o3tasla2rl(msn() leriocto1omD ln olt srxmxopnu4lpt mietl(f 2tmxmoot0opxo feiadfa2ran snu4aexrifctytomD anvi s) exr(o oo1lm   nctl(  2trxr oo4tpeoiicilslm2uanvo;u0artrmf tadlm   uei;s  rumxm3oo1om elfvs t sDrm(mp;u1oexniocilsls rl(vs;u4 lermf3io1laDeln ilt s2ur(m3nydoptemfvsat  2uaump;u1tpxniiciytfa2ulumsn(4arxrmfcoo1oaD au i s s2xrxr nudlptemivtas) rrrxrpoo0teeo ictadla2rlnvpnu0 lxrxfcoa1lptrln s;(0t2uo(r3iodap e nvil( s2urxront1tptoiieiysfaDuluvp (4altnmo3oo1omD au s;() etoimpoudlpeemneils)s2rmumo;u1ope mieild m ranmon(0aeerxr3iy1opD  uvi;s) eumio3io4lpenlivil(  2ta(m oo4opxomiciys m2ul(vs;t4alxrif3oodla ean olt) rxo(m3io4alt mneta( sDtaxrpno1apenmo3ild m rmuvs () etnmfcoytomt livsl( sexmio3iy4ome lfcta( s2tm( ono1oetn o3tltfs uluvpnt4aetnxocia1oa elies ( trum(o3oudal emncsa()srrmx pnt4oee mi3iad aDul(vpnu)alenio iodoa elivs s  ruo(mpoydop emncias srtmxmoot0tpx mfctydfm um(mon(4 rxrxr tydfm  aivi;( seuo(r3ou4optn fei (f 2taxmont0alxomo3iltfmDuln on(0arxnio oatlmD aivo s srxrxopio1lpenmfcil()srua( o;t0oetoif3tas a2eanms;u)tlenmf oa1fmt aues;(0 euoxr3iydoleemnvsls)a2umxro;u1apt mi3iltfs eau s;(0 etoiocoydlateaueo;t)srtm(r3iu4omeemfvi (fs2rrx o;t4texn f3tltls emuvsnt)trtoircootom eai o;t) exrxo3nudop emnvias)artmxrp;t4apen iciyd m2rmuvp t4 rtrxf todlatrlnesls s2tmxm io1ll elnvt ( sDtmx ono0olxnif3tls mDem( o (0aexriocoo1lpDrlivols)trxrio nydlmtnmivias arrrx pnt1oltn i3tytfa umnmp ()artrio ootlm  anvils) 2um(m nudll e nct (f 2rr(ro;t0aex iietldlsDrm(ms;u4aeermr oy1omte i i;s) eumxmpiu1ll   feiasfsDtmu p;o4oex mfeiys s ranms u) rerio iydom  lnvolt srum(r3no4ap nliei tfs2umu ont0opeoii3ildlm uauvpnt4 renxfcoa1lmteanvi (  2xm(o ou1ap nlietlsfa2rm(r nt0alxn iciysfa2um(mp;t) rtnxocty1fa eanvo t0 rxmxr iy4lltemiet sfarra(m nu1alxnmictad a2rmuvon(4tlxniocoatlatrai s s) 2um(mpnydlptnlicsatfs2urur oo0tex  iciaslaDranmonu4 rxoif ia1optrlieils  2urxo no4amtnlfei s  Drmur ;u4tex mo3tltfs rmnvs u4aexrifctytopD lu i;s0t2uo(o3io4lle mivtlt sDrmurpoo1tpeoiocias m eanvs;u)aeerxr oodlmtrli ols)s2xmir3oodllenlfctlt aDta(r nt4alxoioetas mDra(vp;t0trxnir3oatom  auvo s0trur(r3iy4lme  fvs (f Drr(r nu0alx mieiadfa2rmuvo (4trenmf3oydfa  anvo s s2urxo3oy1lm emicias  2umxmp;t1oeenmictlsla2um(vsn(0 rxrmrctytlaDean olt) 2ur(m3iydap nmncta(  2uaxro;o4aet iiciyd mDulu pnt)trxomfciydopteln i;s0setoirpnudlpenmiet sfsDrmuro;u0aetnmfctydls2ra( o u)aeenxr3tydoat au o;(0 exrxo ny1ole lnvtas) rurxmo;t0alxoifctltls2ra( s t4tlerif3ty1lateauei;()texm(o3ny4op emfvias  Dum(m ou4tle if3tas aDem(vs;(4aetrxocootfmtelneol(0srtrxr3nu1om elfvtls)a2urxr ou0olx  f3iadls eanvont) eenioctytoa rau s (  2xo(r3nudopee fvtat sDuaxrpnu0opt moeiysfmDemnms t)trtrmo ia1latrln i;s)sruoir3nu1ol  micia(fsrum(mo;o4apxniietasls ua( s;u0 leomf3ia1fpt  n i s srtoio iu4altnlivsl( aDtaurp;t4opto o3tysls2uln snt4trtnio oadfaDe n i;s0s2trim3iy4ol nmfvtatfa2taxroot4tetnmieilslsDulu pnu4aetnmrcoytlm eln o s0texoxr iy4aptemfcsa()srtrx pnu1tlt mo3tysfs rm(msn(4aeeoif3io1fa e iei;s0 rxrxo nudom   iei s  2rmxro;u0tltoioeiysfm2eanvp t0 exoxfcoodlptelneil(0truoio3no4om   ictls) rtaxmo;u1tlx moeiad m rlnvpn()tetrio oadoatraneilt) 2xr(r3nudlleemfeil(fs2trxm ;u4olx  ietatfsDeluvpnt) rxrmf ta1lpDe i o;( s2trirpiu4lmte ncsasf Duaxmoou0oet  f3iltls2eluvo (4trtrxf3to1fm eli ols sruoxm3ny1llt  nci (f 2ta(mp;o0oltoiiciyd s em( onu0tltnxo3oy1lpt au i s0 rtm(m oo1openmnet sfartm(mont0tet  i3tys mDeauvo ()teenif3tatlp elueo s trto(r3iy1lpenlnvsat s2raurpou0opt mieiydfaDemuvonu4 eenxr3iytlpD  i o;s trtoimpiy4opt mivi t aDrrxmoot1alenmf3iasla uanvsnt)tltomociy1lat luvols0s2xoio oy1apeelncsa(fsDtrxrp;t1apeo fciatls2eln s t)treoir oadfmte n s (0srtrxm iu1apte netltfaDrr(  oo0aeen oetad sDrlu o;u0 lxrio3totomtraneo t0trtmxrpnydaltnlfvs t)s2uaxr ;o1tetoio3ildla rlu o () etoio3ty1oatr i sls srtriopoodllenlnvslsfarta(ro;t4apx  fciys s rau snu4 etoxr iydla rluei t0sexm(o nu1ll e nvta(f Dtaxr ou0tetnif3ias m rmn pn(4tlermrcoadla rli o;t0trtmir3nydam   feslsfsDraxmo;o1apenio3tlsla uanvpnu0 exomo to1fpDeaueslt0 2xoim nodal emnvs sf rua( pnu1tetn f3iltla2rmn p;u)arxoxr3tadlm r ivi;s srto(opiodop   fetl(fartax poo4apenio3tlsfs2rln snt) rxomr3iatlmDr ies s) 2tmir3nudlptemieils)aDrm( pou4ole mfetasla2emumon()arxnif iotfmDeln s s  2xoio oy1oltemncsa()s2tru ooo4openio3iadls umuvont4trtrifcoy1fpt li il()trxmir3oo4op n iciasf 2ta( ont1aeen ociltlaDrmnmo t0tlxnxfcta1fmtrlues;t0t2uo(m3ny4lp n ivs t a2raumono0tex if3ilt mDea( s (4 leoxr3tatfp elnei ( s2umim3oy4ale  fvtat) Duaurpno0tpen fetlsfa ra( o (0 rxrxrcoadfptelieils  etm(r nu1llt  feia(fa2tauroot4opt ii3iysfs eau o ()trerio iotoa r n i;()sexmxopno1amenmieiat  2rax o;t0texnmo3tltla2eanvo;() eerxr tadfmDr ivs t0t2xrxo3io1ope lici s) 2uaxm nu4aexn ieiyt m umumpnu0aeerxf oytfateluvo;s srumxo3io4llte ieils  2rax  ou1alto f3iaslm um(mo;(4 ltrxfcto1la elnei;t0tetr(r3ny1op  mnctl(  Drr( pot0ape moctlsfmDrlu o;t0trermfcia1fm  livslt0 euoxo3oodlmen nvt s aDtrxro;u1alxomfeildfa uanvo;u)teeomrcootlpDeau i t0srxr(m3nodlptnliesas) 2trx pno4oex  icild a2ean pnu0altoxr totlpDeluvo;s0texr(r3nudap  lnci ( sDuauro;u4tex mieilsfa eanvs t4 etoxr todop e neilt  rxo(mpoo1lltnmfet s  rrmu ont1oetomoeildfsDelums;()alermo tydlpt auei s0t2to(r iu1lpee fvslt)a2trxmpoo4aleoifciydfm uanvsnt4 rtrxr3ty1fmD auvs;s seumio3iodlm   nvt ( srurxm ot1ope mictyt mDrluvpnt4trerxociydlatrlivol() rxoimpnydol  lnci s  Draxmoot4apxnmi3iasfm ra( o;(4tetnmo oydomD  nvo s  rxrimpny4opeelfcsltf Drr( pnt4aee mi3iasfa ua(mp t)texrio3oytfaDr ues ( s2tr(mpnudal nmnvs (f 2rr( ono0olx mf3ild a el(mp;t) etoxocoy1om raivs;(  2xrxopio1lle lnct (fsrrru o;u0texniieilt sDemnvo;t0trxnmo3oydomt livs (0 2xoimpou4lm  mfvtl(f 2rm( pnt4aex  ictysla2em(mp;u0trerxrcootfpDe nvi;()srtr(o oo1aptelncs s)a2tm(rpno4opxnmfeiys m2eanmsnt4 eerxo iydop  luvs ()s2xmxo3iy4lpeemfvsat)aDrm(m nu0aee  ociasfa uauvpnu4teeoircoatfm eau i t0 etrxm iudamtnlfvilt aDta( pnu4ope io3tlslmDuanvsn(4 rxoxo3ta1om elu olt0s2umxo io1ole mfcsls srur(m ou4tlenii3ilsls rm(mpn()aetrirctodfpte uei s) rur(m nu4lp emiet sfa2rm( ont4tpe  ictys s2elu o;u0alxnio3ia1lpt aieo ()sruoir3nu1ll n fvsasf Dtr(rpno0tee iieilslm2uau s;(0aetrmoctotomDrlivolt0 rxmxo ou4apenlietatfsrrr(m ;o1olxn fetlsfs2umnmp;(0alxnmf oa1faDr nvo s0 eur(o iy4lptnlicia(fartau  ot0opto iciydls2ul(ms u)aexoiocootlaDeaieo;(0s2trio3ou1ap e fcilt  2rm(mp;o0oleo i3tasfsDea( s u4arerxr3iodoptrlu sl( teum(o3iydlptn nvt s srua(r oo0tptn iciadfaDrl(mont4trxnxf3io1omtelnvi;(0trtm(r iy4alt lneta() Drrumpnt1oet  fciatfa2ul( p;(0 exrmo iodfpt lnvsl( srxr(r iydoltelnvias)arrrumo;o4oeeoiieiatlsDumu pn()aeermrcoydfptrln s s)t2xoir3ou1op n iesltf 2rru o;t1apxnmfetysfm elu s;u4teerir3ia1fmD  i i;s  rxmxr iu4lptn ivtltfs2uaumpno4tle iictltla rm( o (0teeoir iadfaDeau ols0 2toxr3oydlmeemicta(  2tr(roou1oex  fctas a2uln o t)tlerxf iatfatrlnvo;t0t2xoxm nudapt mfviasf Dtmxr no1teeoifeiyd a ua(mo (0 lxoxfcoydop r i i;t  2uoxm3oodlmee ivt sfsDrmu  ;t0apx mf3ildlsDuan ont4aetnirciytlaDe uvs t)s2urimpoodaltnlivsl(fs2rau p;o4tpe iociysfm umnvp t0 lenmocootla r u sl( t2xoim3nudapte iviatfa2tax  no4texn i3iyd m uln snt0texnirciadomDr uvo;s)s2tmirpou1opeemivs ( a2um( onu4opx  o3ildfm2em( s (0 rxnmr3ia1fpt livi;( seur(m iydlltn fesas)aDta( p;o4alt  ietltlsDea(vsnu4 rtoif iotfmD au sls)t2xmir3iydamtnlnct s  Drr(mp;u1olen f3iyt m2rau o u4trermo tydfp   uvi;()texo(rpiy1oltnlietas  Dur( oot4opeo oeias m2ranmo;(4treoio3iydfaDelu o t)s2tm(mpoo1apenlfeiltfarrrum nu1alt  ieiydls2el(ms u0tleoir3ootoaD ai o s)tetoxm3no1llte ivtls)a2tau  ;o4aptnifciyd s2uauvonu0alxnxo iotlpDranes;s) rtoxrpoudlp n neta( sDtrxrpot1ale iieiydfs ea(mp u)alenio3ia1fm elues () rum(mpoodopte ivslt)s2trxmooo4olxn o3iatlsDemu pn()arermrcoy1fmt au ils)seurim iy4aptelfvi ( sDrmumo;t1altomfctltla em(ms t4alxrxrciadoa e u ols0 eur(mpiu4lp e ict s) rurum nu1texomoctatfm eluvs;u)aeerir3ta1lat au o;(0trxmim3io1al elfci s artaur no1aeeomi3iat mDrm(mp;u)trxnxoctydlaD  uvi ()trxr(mpno4am  mfeil( sDrmx p;o0oetomietat m uaumpn(0 ltnxo3to1latelies;t)t2umio3oy1lpt  iei ()sDrrxr no0apx mf3iytfa2umnmp t)aexnmf3iodopD auvolt0 rto(r no4omt  fvia() 2tauro;t0aeeoioeildlmDrlu o;t4trxomfctodoat auei;t sexmxmpou4omt livt s a2raum nt1apto f3ildfa rau p (0altrmr3iytomt li sls0teumxrpio4optemnciasf rrmxmont1oeeomociltlm ra(vs u)aetrirctytfa elivi s teurir3nodlpt mivtl()artmx pno1aptoioctad a umn onu)trermo todfmDrau o;t tetm(r iy4omt lneslsfsDurxront0apx  feiys s rauvs;t4arxomr3oydfm  ai s s)sexr(o io1apeemivi t)a2rrxmoot1ope iieildfa2rlu p u)texoiocta1opD an sls) 2ur(m3nydolen nci t) Draxmpoo4tlx mfeilsfa2ean p;u)trtnxfcta1oateaueilt0 2xoxo ou1om elivt s srtaxrooo4tet  oeilsls2ean ont0tlermr oo1fptran ilt0s2ur(m oodlle lnvil( arra(rpno1tex io3iatfa2ul(monu0trxrxo3tydop elu s (0 exr(m3oydlpeelnesl( a2ururp;t0tlt ifetad a2rlumo;u4 etnmo3todopt  iesls0 exr(o nu4ape lfei s sDraumooo1apt  ictasfaDulnmo ()trtnxfciodfpDe u o t0 2toio ny1al e nvsat) rtr(mp;u4tex  fetltls2uanvs;() etrxrciadfa rli i;t)s2xrxr3ny4lm nlicsa()s2rru onu4oet mociyslsDrauvsnt0artrio iotopt lnvo s0 ruo(o oy4lp  mfct s a2umxmpnt4tlx mfetlsla2ean o;t0tlxoioctotomt li s;(0trum(o3no4ope lnvils  rua(  no4oleomfeildla emu p (4tlxrif3iatlaD  uvi t)s2ur(o oo1apeemfvsltfartmurpnt1ole if3tasfaDra(monu4aleomr oo1faD aivil( tetmxr oy4olee fvtltfa2uax onu0aeeo i3ils m emnvo;u0 rxrxo3oadopDrlu ol(  2umio oo1lm  lnct sfa2rau pno0alx  ictysfs2ua(ms t) rxomfctydoa ean o;t)texo(m io4oltn fetls) Dtrxrpoo4tptn octyt s2uluvont)teerxo3ta1omD aueols0teurimpiy1lmtnmnesasfs2ua(ro;o1alt ioeildfmDumnvsn(0alenxf oodoateai ol(  2tmxopoo4opt lnes s)sDrmxmo;t4ole  fcilsfaDem( pn(4teenir3ta1opteaivs s0trxm(opoo1alenliet s srtr(rp;o4tlto ociatfs rlnvonu4trtnio ootfmD lnvs t)sexrxr iy4llte nesatfs2ta(  ou4apx iieiatla rmump u0aeenmfcto1faDe u i;s  rxmxm3io1lpenmnet s  Dumxmp;u0openmfetltls2el( s;(4altnio3iytoate ivsls)t2xm(o iudll emfvi t)sDta(r ;t1aeeomicilsfm ean on()teenmf todfm   ues;(0s2umir iydopt  fctls)a2uaurooo4olenmfetldlsDrmuvpnu4arxrmf io1opD au o s)srxmir oydlm   ncta(  2rrumoot4olt miciytls2raums;(0trtomo ia1lp rluei;(0t2trir3oy4oltnlnes (fsDur(r oo0oltnii3iadls em(mont4tlxrmf iadopte uei t0 eurio3nu1omtelnvils  2ur(rono0tet  ociydlmDrmumpnu4 rermr3oadlm rlivsl(  2tmxm oudop emfes t)s2rrxmooo0tlxomicild m2em(mpnu0trtoxrcoodfmDeli i;(0seuoxr3oodoleelivslt  Dtmu p;t0opxoiociyt s eluvsnu0tetrmf3oy1om raies;s t2tmim iydlm nmnesl(  2ua(r ;t0aptomo3iltls uaums;t4areoirctadlpD aies;s0 eurir3nodlm   ncs ( arrm(r nu4tpto feiydfm rau s u4 rermo iodop rai s (0 2xo(opoy4ame mieilt)srtr(mpot1tlt  ietytfm2ua(mo;u4 eeomo3tytfa   uvolt)s2xo(mpio1am  mnvsas  rur( oou1tee  oeiatfa rln p;t0alxnxf3oatfa elieil(  exoxm iydalt  fcsl(f 2rmum ;t4tetoifctydfm rmn p t) exnir3oa1omDe ueil( s2xrio iy1opt lfctas)arrm(ront1olx if3iydls emnmo;u)teeomf oatlp raies;s0 rxoxm nodom nmnvs t artr(mpoo0alenmfctls s uluvon()teermr3todlmDr u sls  2uoimpnodlptelncsatfarurxront0opxn oeils m uanmpn(0artomr tatfpte u sl( trur(mpou1olen fvtls) rrrur nu0altn oeiltfm uanvp u4alenmf tatfat an o (0 rtr(o ny1lpte fctl(fsrrrurpoo4tpxo f3tysfmDuaumsnt4aetoifcoy1oatrln s;(0seurir3oydom e neslsf rta(mpnu4ale mo3tlslmDrmu ont4 etnmf3oa1fm elneslt0setm(r3iudope  nctlt) rrmxmoou4tptomfeias mDeluvp;()alenxo3ta1opDeanvol( srtoimpoudolee icil( a2ra(mono1ole  o3tld sDumuvo;t4 rtnxociotfate nvi t srurir3oudal   nctl() 2rmur ;u1opt mictydls rlu p;t4 rtriocto1optranes;( t2urimpiu4amtnlivi ()artauro;t0oetn o3tytfa uluvs u0treoif3ootopDeln slt t2xmxr3ny1aptnmnetat)a2ururoot4altnmoeilsfm em(vp;t0aeermociatfmtean o s0t2tmxr iy4om elfesasf 2tm(mo;t4oexo fetadls ulnms;u)trenmfcoa1lpDr n sls srxm(r nu4op elfetl(  Drrxmpnt4tlxo o3iytlaDemu o u0aeerxfcootla  anvi;t0srxoim3no4lm nmfetls) ruaxrooo1tlx mo3iaslsDrm( snt0tetnxf oo1lm r neils)texrim3oy4omenmnvt sfsDtru pou4tlto f3iysfmDea(vs u)tlxrmo todfm rai o;(0t2urir3nudlp  mfeiasfaruaumpno0oetomfctlslaDeauvp;t)tlxrifctotopt an olt  rxo(opou1olte fesls arta(r ;t0tetoiietldfm2ul( onu4alxoxr io1oa elnvs;t0sruoio3nu4op  lneiat)sDraum nu0apx  oeiat aDuln o (0aeenmf3to1lmt au i;s  2xoir3oydop n ncilsfsrtru ont0olxn i3iad s2rln pnt0tlerir tytlate ivilt)seuoxm iu4am emfei s s2raur nu0aexomo3tadlaDrln o;()trxomocia1lmD  u i;t)teuoirpou4omtelneilt)arrr(ro;o4tle mi3iltfaDeln pnt0tltrxf tytoat aneil() ruoim3nodlmen fvi t) Dumx pno4alen ieiltla2rmnvo t)aetoio3oodoptelnvo s seuoir3no4olt lics tfa2tmu p;u1tlto ictltfm2ea(ms (4aexnio3tadfa  lies;s)s2xr(rpoo1altelfctlsfsDta(r ou1ope  o3iad s ulnvs u0tltnif oadlmDrauvs t0s2xmim3oy4opt livt t) Drmu  nu0ape iiciatla ua( pn(4aleoxo oo1fp   u o;(0srxrxrpnodap   ncslt aDtm(  nt4tltn iciadlm rm(vo u0arxrmociydlptrluei t  ruoxopno4apenlnesl(farrmu o;o1aeeniieilslaDrlu p t4alxnmfcoo1lmD  n olt) rxrimpno4lpe mivtl( srrm(  oo4alen ietys sDul(vo (0arxnirctatlmtr ieil(  2tm(o3iodom n ivi tf Dta(r oo4tleo i3ildfaDel(mp;u)aeerifciadfmtrlieil(0 rto(m3no4om e nvs s aDuru  ot0tee iocilt s2elnvo;t0arxoxf3oa1omt ai o t seuoiopny4al nmieiasfa2rmumo;u4alxo ociltla2uln p t0tleomfciodopDeanvo ()t2tmxr nudopte ncslsfarur( poo4oleo f3iytfa el(mpn(4aetoxo ta1fat lnesls  2ur(m oy1op n fvi () rtrx p;t1apeo iciat a2ul( p;()tltomo iy1fa r nvol(0t2uoio io4opeemneils artr( pou4tpx mf3tatls2rmu s;u0alxomociy1opt  i ol(0trtoxm io4lm n fvtls)srumx ont1oeeoiictytls em(mo;t4teeoxfciodfaDeai ols srtmio ny4ap elfvil(fs2tm(moou0apxoio3tltfs2uln o t0aetomf iodom raues;t)seurxo3oodlp  mfvta( sruax p;u4aexnmf3tltls rl( o;u)aexomr3oa1laD  nvilt texmir3nu4lp e fcs (farumuroou0oleo ieiad mDrmu s u4tltnxo3tydfpDe ivo t0s2ur(r iy1om nlnvtas)s2ra(r oo4alxo fciat m elnms t0 exnioctadfmt ai s t texoxo3iudole  fcsatfsrrrxm no4aetniiciltlaDulnmonu)texrxr oo1oatrlneolt s2xoio3oo4amt mfcils)aDrr( p;t0alxomfciydfs uau pnu) lxrio iydlaDeli il( trtm(rpnodam elnet t arra(ro;u1tpxnmfciadfm2em( s t)altoifcoatfa raiei s texr(o3oo1lp e ivsls)sDuaxro;o4tpx  ociydfs2uauvonu4aleomr oo1fmt livs s  2umio oo1lptn ncs sf 2trumo;u1tpeomfciat m2uanmpnt0artrmo3todlat  uvi;t0sexrxmpio1om   nciatf Dtr( pot4aptomfciat a ul(vp;u4tlxoxfcoo1fmtrli i s seur(o3iy4amenlfes t  2umuront1opxnioeiad a uanmpn(0texoxo to1omt  iei ()t2trxmpio4olt mieta(  Draumo;t1olt iieiltlsDran o u)aeerirctydlp e i s t) exmir3nydllt lfciltfaruaxronu4tltn octld s2ulnmp;u)aeerxo oy1opD anvi s  eumir3iy1ale liet s)artr(ro;o1aptnmo3ild s2ulnvo;(4arxnxrciatom rlieo (0t2xmxopno4al nmfctlt aDumxm ;t0aetn icilsls uan p (0 leomr3todlaDeaivils) 2trxrpoo1lleelivtlsfa2rrxmp;u4oex  fciytfm2em(vo t)aexnxr oytfa elu olt  2tm(r no4amt mnciltf 2trxm ou4tpxnmi3ild mDea(mpnu4 lxrmf iytopt aues;s) rtmxrpnu1ope  neil(fa2tru  ;o4texnmo3iyt s ra( sn()texrxocta1lmteli o;t0 rtmxopoodlp   ivtlt  Dtaxmpou4apx mi3tatfs2elnmo t)altniocoadom rlies;t  2xrio iydlmeemiesa( arrau  nu0teeoioeiytfm rlnvs ()trerircoatfa r u i (0tetm(o oudole lnvsas aDuaur ;u0tpxoif3tadfs rlumo;t4aexrmf3oatopDeli sls trurxo3nydapt  iet s aDtm(m ;o4apeo oetlt s2rlnvs u)aetoio todlpDeln sl( t2trimpou1ol  lnesas)aDurxrpnt4teenmf3iaslsDelnvp u)aeeoxr oadlp  aueo;s) rumimpiudoltn ies t)a2ta(ronu1tlxomiciltfs uauvs;() ltoio oatlptrluvo t0 etrxr no4lmte ncil()srtruro;t1oltnifciyt a eanms t0aleomrctatfatr nvs t t2xoimpnydlleemieia(  Drax  ;o4tpxomfciadfa em(mo (0teenio io1fmtelivs s srtrir3iu1ll emnesas s2um(mpnt4opxnmi3tysfm ul( p;(4altrmrcia1fate i s ( seuoio ou1optemict tfsrumurpno4oet  feiyd s2rlnmsn()trenxoctytlaD  n ols t2umxr iu1omte ictlsfs2rr(r ;t1apxnmi3iyt m elu snu4aexnxrcoy1oaDeanvo;t s2xo(o3iudalen ivias)srtmxrp;o4tpeo oeiyd s2rlu o (4areoif oytfa  luvol()trxm(r oy1am nlivtlt  rum(mooo0tlxo icias s emn s;(0aetomocoy1lm eluvsls0 rxoim3nu1openlivsls a2tax  ot4oee  i3iydls2emnms u0texnmr tytoaDr ies s)setrim3iy4aleemivsa(  Dtrurp;t1aptn fetas a2rmuvon(0tltnxociodopte nvi s0texr(mpiodameelfcsa()srrmurp;o4apeomi3iad mDua( s;u0 rerio oatla ranvsl(  rxmxr3iudoptelnciat)sDta(r ou0oexo oeiltla2ulumo;(0 leomo3iy1oa  ai s (0s2tmio nodalee ncsls aruaxro;u1tee  fetat s2rlums ()trtrxo3iy1opDeaieo;s0tetmir iydlp e fvta()s2urumo;u1aetn iciytfa rlnmo (4trtoxrcto1lmtrluvs;s)s2urxopou1lm nlfvt s  2ua(ro;u0oee if3ild a2rmnvsnu)arerir3oatlm r n ils)trur(mpoy1omte fes s aDrrxm ou1alx ioeiad a2ran ont4aleoxfctydla  ai o;s) 2xoxrpio1lpt livtl(farurumpou0aetn ictld s rlu s u) rxoxr to1fatraieils) exmiopnu4ope lfvtas) ruax  nt1aleomfeiasfs2rmump () etnxocta1fm eluvo s srxrxr oy4llt mfeiasf 2rrx pou1open o3iyt a2uan p;(0trxoxocty1lm  luvi;(0s2tmxr ou1lme  ieilsfsDrmxmono1alxn iciadlm rmumo;(4tlerio tydlp r ivil(0t2umir3oy4opt lfvil()aDtmu o;t4ope  o3iatls el(vp (4treoxrcia1fpDr ivo t)tetmir3oy4amtelfetl( srrrxrp;t4olenmf3iat sDrm(mpnu)aetrxf3oadfptelnvi t)sexrirpoo1ale  ieia(faDta(r nt1aet  octas m emuvo (0arermo3ty1oa  ln s s0texrim oudoptnmfci (f 2rmx pnu4alx ii3ilt a umn snu)tltnif iydoptelnvi ()trtrxr3no1lmeelivil()sDtmxmp;o4tpt iiciltlm rau p ()aexrmf3iy1fatrli ilt sexmir oodlpt mfvias  rua(rpou1ole iieias a2ul(vpnu0tlermociadfm  lu ilt0 euoio iy1lmt  iei sfs2rm(r ;o4tlxn o3iad a2em(mon(4artoxo iatfpD  u s;s0s2xm(m iodlle mfeils  2rm(  nt1ole  f3iydfs ran o;t)trtnxfcoadfmD aivs t  2to(m iy4apeemici t  2umxr ;t4oleo iciaslsDum( o u4 etnxr3oa1fmD aneo;s)s2xrxo3iy1llenmictlsfa2rmxronu1aetoifcildlsDrl(vp;u) lerioctytfmD lneo s0teto(opou1am emfet s a2tmxmp;o1oeeoiiciad m ua(vo;()alerif totfpDrlnes t0 rtoxr no4ol nmnciasfsrumur no0opeomietyt mDrm(msnt0aexrmrctotfaDrlu sls0trumirpoo1optnlfet t)artauronu1oltn i3iydls ranvo u4teerxf iatomtelivs s sexrxrpnydap n fcia() rtrxm ou0apxomieiyd m2rau s t) rtoif3tytop rluei;(  rxmio3io1ap nmnesas)s2trxmpnt0tpenmociat aDrluvpnt0treoxf3oo1oaDran i;t)s2xmxrpiy4lpe micils) rtru pnt4tpxn f3iltla2eln snu4trtnmf iy1oaDrlnei (0 rxrimpiudlmen ivt ( srurxrpnt0oltnmictldla2elnmp;()altomf3oydfaDr ivs;(0 rurxr3oo1amte fcias  2rr( o;t0tleo ocils sDelumpnt4 rxoir oadopDrauvs;(0trxoxm3iy4omt  nvt ( artrxmoot4tptomoctad a2eauvp ()aetrxr tatom  au slt t2trxo3nydaptnmfcils) rraxmp;t1aex mieilt s rlnvpn(0alermrctotlp   n sls t2uo(rpnu4ome lfcs t a2rmum no0aet ifetat aDemn o;(0teeoif iodlpDelivols0srtoxopiodlp  mivtl( sDur(m ;t0tlxnii3iyt aDrl(mpnt0trenmo totom e i i;s s2tr(m oydom e fvtas) 2r
\ No newline at end of file
@@ -0,0 +1 @@
+nvs t0t2uo(rpnudoleemnes tf 2tr( ono4tlxnmfciytls2umnmpnt)aeermf io1fa r u i;( trtm(r3io1ap n ietas)s2ra(roou1olt  ieiys s2ra(mpnt0tlxoirctydfpteaivs (0 ruoxr3oudape lfvilt)arrmum nt4optomictytfaDemnmpnu)alerir io1omDe ivi s0srtrimpny4ll emivil( sDrmum nt0optn iciltlsDumnvo;u4aleoio3tydlm r uvs (  exmxmpny4al emies t) Dtmuro;t1oet  oeiyt s rm( p;t0texoxfciatfa  lieo;(  2toimpiu1lpenmiciltf Dta(mono1ole mf3tat s2umuvs;u0 lxnxrcoatfp  auvi t) rumim oy4op emfci tf Drmx pno0tpenmo3tydfs uauvo (4 eeomr oatomD  i ilt0teumxo nu4amt mnei tf 2rmurpot0tpxn icilslsDuanvs;t4tltnxf3oa1optr i ol()trxmirpiu1ope  icia( arua(r ou4optomfeiltlmDelums;u4 etrmocia1lm rauvs ( t2xmiopoo4om emfeils)srrrxmoot0texniicild sDuanmonu4alxrio to1fmt lnvils  2xrxm io1ol emivs ()srrmxrpno1tlto f3ildlm emnvpnu0alenxr3oa1fm  lieo ( t2xo(r iy1olt lies (fsrra(mpot1tpt mf3iatfaDul(msn(0 etrmr ta1lptrai s t0 rtm(r io4op elfeiasf ruaump;t0ale io3tldla2rl(vs u0 exnxr3iotoaDeaivs ( setrxo3iydlpeemivtlt)srumu  oo0tptomietld s2emumo u4tlxnif3oa1fpD livi;()s2xmio3oydal emncsa( s2ra(ro;o0tlt iicils s eaums u0 lxoif3iodopteai s;s0teuoxo3io4amen nesas) Dtr(rono0oee  f3iltls2uauvp;t0teeoif iodfmteln o;(0texoio nodopte nvs s)a2raumpou1apt miciydlmDeln s u)teenxrctotfatelueols) exoxrpnu4aptn fvilt srtau ono1aetnif3iad s ul(vs;(0artoxo3io1omDeauvi;s  rtrio3oo4amtnlfeslsfsDumu o;o4olxomiciyt a umump;(4trerir iydoa r uvo t)teur(rpoy4omen fvt t sDrr(m ;t4tltnmiciatlsDeau on(0texoxo oadoa  au olt sexr(r no1am n ieilt)arrm( ono1altn fctlsfa2el(vonu0trtoxr3iadlpDean ils t2to(mpiy1amen fci (f rtru ooo0tpto fcils a2eaumonu0tlerir tadfmtelnvolt s2xoim oodlmte ivtas aDurxmp;t1aexomociydfa2rmnvp;(4trxoxo3iodoptr uvo (0srtr(o3no4op e fciat  2ururpou1opxomfciyd aDrlnmsnu4trtnio todopteln ols) rurimpny4oltn ivtlt s2trxmoou0texomfcils a2emuvp (4 rxrxf3iydfpD  nvi;t0sexrxo3nydape mfctl() rumurp;o4tetnmo3ias aDrlnvs t0tltrir ootom   n ols sexr(o iy4openmici t) Draumpnu4aetnif3iat m umnvp;u0aeermocoodfm r ueols) exoxo no1op elfesas)sruaxrpnu0aet ifeiad m uan onu)aeeniocoo1late ivo;s trumirpno1lp n nci sfaDtmxr ;u0altniiciydfm2ul(ms;u)tltoxo todlmD livo () 2xoir io4omenmnvs () Drax  ;u1tlt  oeiasfsDul( p u0treoxo3ootomtrlnvsl()srumxr nu1lp  mivi t a2raxr nu0teeoifctydlm2rluvpnt0 eenio tadoaDr uvs;t0teuoim3oydapenliesasf rrr(  nu0ope  fctadla2rmump;() lxoif oadfmtelu s;s sruoxo iu1amenmivtls) Dtrx  nu0optnifeils m2umu o;u4tleomocootfptraneols  2tm(o ny1alt  fciat arraxr nu1tltnifetlsfa2ranvo;t0arenif3todomt luvi ()trto(opoodap   ieiatfsDtmu poo0tpx mociysls em(ms ()aleomo3io1omtranvslt  rxr(m oudap nmnes t) rrmumono0apt  o3iysls emump (0altnir oo1lat ln s;s0 2toir3iodlm elicilt aDtmu p;u0openmieiydfa em(mont0teenmo tatomt  i s t)sexo(mpnydoptnlnvilt)sDrrxm oo4tetomfcias m uan o;(0tltnmr3oadfptr nvs;(  rxo(r3no4am   feiasfsrtrumpoo0tlto oeildfa2ea(vp u0trtnmf3iy1fa   ivi;t tetoir3io1omtnlnct t)sDrm(m no1apto f3iysla2umn pnu0 lxomfciydfaDrlu i t)texmxm ny1olenmfvsls) Dur( o;o0olen oetys sDra( s;t0arxnxocoodfat livi;s0 eur(r3no4ope lies sfa2trxm ;o1oetomfciatfs2elnmo t0texomr3iydoatraivi;s  rxrxm3io4lm nmnvi t) Drr(  ;o0alt mo3tytlm2umn sn()aeerio iadlmtrlnvo (0truo(r3ou1ap nmiciltfsrtrxr ;t1tptomictlt sDrm(mpnt) renir ty1lmD luvo t  etrxopoo1op nmfvi ( aDrrum nt0apeoifctldlmDuau pnt4 rtoio3tadla eaueslt0texm(r3nu4apenmnet ( s2ta(m ou4aetnioeias a uan p;u)tlxrmfciadom e ueslt) eumiopoydol nlfvsat)s2tax  ;u1tee mictysfs umu pnt0aeeomo3io1fmtelivsls0srumirpou1omenlictas s2rm(m nt1olt moetys sDum(ms u4aetrmf oo1op eauvs;s)trumim ny4apeemneia(f Durxr oo4tex mfciatfs umuvonu0 rxrif tydla r ies (0srxm(mpio1om emiet t  Dtaumpoo4tpen f3iytfm2ua(msnu0alxnxf todfmDrauvilt)trtoxo nydapt mivs sfartru pot1tltniietls a2ulnms (0arxnxr oadfmtr n i ()sexmir io4om nmieslt)sDtr( pnu1apxoii3iytfa2rauvp (0tltrifciytom   ivils  2trxmpnudop  livia() Dumxr oo1apto octlsla um(mp u0tlxnmr3ty1fmDraivo;t t2umxmpiudaltn ivt t aDrrum ;t1tleomf3iytlsDra(vs;() lxniocio1fpD lu i;t)teuoxo iodlme lfes sfaDurxm oo1apt if3tydfa2eau o;u)tlxrxo iatomteaneolt0sexmio3oodll nlncilsfaDtrumpot4apx iieildfa rm(vpnu0aeermoctadlaDe ieo;s srxoxr3oydamtn neiatf Drr(mooo1oeeomfeiltls2ua(msnu0 lxrir3io1omtrlnvi;() 2toxm3iodom  mivsatfsDtmx  ot1apxo f3ils aDel(vont4 lxrmf3iodopD luvi;t0seuo(o3oudam  lnes (f ruru  ot0tlxnioeiad aDranvpnt4 etrir oydfmDraieo () ruoio oy4ap emneiasfaruauro;u0tpxnmo3iydlsDuluvpnt)tlxomr3oodlpDelivols trumirpnu1apt  iviltfartmx  nt1ape mi3ias s uluvp;u4 lenxo3iatfmD lneo (  rxoiopnu1ll nlnct tfartauroot0altnmi3iatfa rlu p (0aeeoxf ia1fmD an o;s  euoir3nodapenmnvsas srtmu  ;u0aex iietltfsDulnmp;()tltoxo3ia1lm ean slt0t2xr(r nu1lp  lnesasfarta(ront1teto oeiltlm emnvp ()alxoifcoydfpte nei (0sruoxr3io1olen feias)a2trxm ou4teeo fctyd mDrln s;t) etnmo3todop ranes t) rxoxo oo4ole liet () Dtmu ooo0apx iictlsfaDulumpn(0alxrxo3iytlatraiei ()tetrim3no1lm   ietl(  Dururonu0tlen fciydfa2ulnmpnu0altnmo ia1fmDrai s t s2toxmpoy4llee fet s sDtr( o;u0alxnio3iysfm rl( p;u)tleoif iy1omDr n s (0t2tmxr ou4ol   nvsl()s2urxm no0tlx  oeilt a2rmumpn(4aetnxfcoodfaDr u s;s  etmxm3oudomee nei sfs2trump;t4apenmoctld mDeanvont4alxrxr iadla e nesls) etrimpoodlm  miei tfa2umx o;t4tlx  ieildla2rlu s t0 etnirctotom rluvi t)trxr(opoy4ameemnet t)a2uax  ;t4teeoioeils mDrlnms (0artnmr io1fp   ieo ()tetr(r iudal  livtatf Dtr(rpno1tpeo ietydlmDumn s t) eeoxf tytfptelnvo ( t2xmirpoydalt  ivtlsfsDraxroot4apxnio3tls m ul( p;t4 exrir tydfptrlivslt t2xrxrpoy4llenlictas) Dta(rpoo4aet ioeiysfsDrmnmo ()arxnxocto1lmDeanvo;t)s2urio3nudalt mncsa()aDua(  ;o1tex ioeildfm eauvo;t)teerxr oadfmtrlu il( sexrxopoodaptelnet s) Dumumo;u4tpx if3iydlm2rm(vo;t0tltomfcoatla rluvslt0teumxrpou1ap nmict (  rra(mpnu1oltoiiciad s ulumont0aetoio3todfmtelnvol(0seum(m3io4optnlfvil()aDumx p;o4apenmoeiatfaDrauvs (0trxoiociytfmD  i il( sruoir3iu1olenlfet () Drr(roou1texomf3ild m elums;(4 renmf3to1omDeanei;t)srtoimpio4op   netlt)s2tm(rooo1tetnmo3iytla2ua(vonu4arxoifcio1lpDraivi;t0srtoxo3oy4optelfvtas sDrm( pno0aet mo3tlsfa2em(vo u)arenxo tadfpD li s () exmio nydom emfvt s s2rr(m ;t4oltomo3tadfaDuan pnu0arxnxf oa1fmDe u o;s) 2tmio3ou1ome  ictatfsrumx  nt0optnmiciyslm2rmnvp u)aexoxocoadlat au olt  rxrxr nu4lp e fctlt srtaurp;o4tltomietat sDuln pn(4treoirciadlp r ivils sexriopou1omtnlnetlt a2umxm ot0tptoii3iyd sDumu o u4tetomrcoo1omDeauvils0tetmxrpoo1alt  ieils) rum(mont1olxomiciadla rau s;(4tetoxrctytfmteau i s) 2xo(rpoy1llte ivs s srtrxrpoo1aptn o3tydfm2ranvonu4texrxoctadomD auvol()t2uo(opoo4lp e fciat artmu ooo0tle ioctys m2ran p;t0artrxr3iodfp eaivo s0t2uo(r nu1lptnlfvt ()aDrru pnu1tltnmf3tadlsDra( s;t)alxoxrctadom r neo;t  exrxo3oydop elictat)a2raumpot4olt ifeiytfaDumu ont) etniocoydfptelivo s)t2urirpoudapenlicil( srtax  no1oetoio3tltfm umnmp;(0 eenmrcoydom   ies;() rum(r iy1am  mnvtasf 2rmx  nt4apxo oeiasfa rl( p;(0 eeoiocoodomDelnes;t) 2toiopou1ap nmfeil(faDta(mo;t1apxnifcildfs uan o;t4tltrxfciadomDrai s t0 2toxo3iudlp  lies tfsrtaumpot0tptn fciydla2rm( p u4 rtnmr3to1laDeanei t)trumxr3ou1altn icsltfsrum( pno0tleo octldfa ra(msnt4 rxriociydfpD lnei s0s2toirpiu1ll emfcs t)aDua(  nu1tpxnmi3iltlmDel( s;u0texrmr ia1lm elivol( t2xm(r iydom  lfvsat) rrmur no1oee mieiytlm2ra(mont4 etomo3iydfpDrlieo;s0sexm(m nu4omtemfctas a2raxr oo1texoifeiasfa2rmnvp;(0arxrxr3oatfmtrlivo;s)trtoio nudllee nes s) 2rm(  ot4tpxn iciasla rluvo;(0 etomf oy1lpt  u o;s texo(mpnudol e nvils)a2trx  ot4texo ociat m2ulu s;t) leomo iy1oaD  u o;t)setoxm ou4al e fvt t)a2ur(  nt1apxomi3tldla2rl(vo t)artnxr3totom ran slt  2to(o nydlmtn fci s) rurumoou0oetoif3ilsfa uan pn(0aleoxfciadlptranvo;s)s2urirpnu4lpenmnesl( s2uax pnt1aexn i3iatfs el(vsn(4aeeomrctydlp   n slt)texo(o no1lpenmnvtl(  rtmxrp;u4oleo i3iat s2uanmp;(0 etoxocoa1fm rlu o;t0 etrxopoo4llt lfvtlt) 2rrxro;o1tleo i3tytlaDrm( s;()altrxo oy1laDeaneo;( srto(mpoo1llee nvtltfsDurumo;o1teto i3iltlsDuluvs;(0aexoircty1lat anei (0 rxmim3io1am  licta()aDrr(m nt1opxoifcildfaDul(vo;u0aetoxf ootlp rln o (  rurio3nu4apt  nvta( s2tr(m no4tptniictlsfm ea(msnu4 lermf3ta1oatrlneilt  euoxrpiu1am emfvsa()a2urxr ;o1opeoiictas a2uan p t4artrxf3oo1lp r u ol(0t2xr(m ou4apt lfeils  2rax oot4opt  feiytfsDemnvp;u) rxnir3iatop  ln o ( setmxmpiu1amtelics s)a2taxm oo4apeoiietasfa2uau on() exnio oadfa rli i;(0t2xoxmpiy4amenmiei t)sDumxrp;o1tetomfctas s2el(mo;(0areriocia1op rauei;s0seum(o iodlm nmnvtls sDrmu ooo4ale ifciltfsDeau pnt)artrxr oa1lmt an o;s)sexoxmpnudamen fetl(  rur( pno0aexn iciasfm2uaumonu4trerio3oadlpD an o;t)texrir oo1lmtnmnvs tfsrrrurpnt4texnmf3tysfm ranvpn(4 renmr3ty1lmtrlnvs t s2xoxrpio4ap  mnesasfs2urx  nu1oet iietlslmDemu sn(0aeeoifciadlp   ivo;s)trxrxmpio4lltnmfesas)s2tmxront4aet mocilt m2ulnvon(4 leoxo totfatrluesls0t2tmir3oydlptn fcs ( srtm(  no4texo fetyd mDulnmp;u) eenmo oadlmt  nvs (  euo(m3io1oleemieslt artrxrp;u0tpxo fcilsla2ea(msnt)artrmf iytlpDraivi;()srtr(r iy4lltnliesltfsDraxr ot0apxnifeiyslm2eanvp;(4alxnif tadfm rln s;s0s2xo(o oudlpenmies s) 2um(r nu4tleomi3iys a2emu p (0 etrmr3ta1fate ivs;( t2trxr oo1apt mivtls) 2rmx pot1tlxomieilslm2ea(mo (4texnmoctatopt aueo;t)t2tr(o iodol  licil(  ruru  ot1oltoiieiasfsDea(vo t)areoxo iatomtrauvilt0trxr(r nu1altelies sfs2rrx  ;t1tlxoifeiatla2emump u4aetrir3oa1la   ivs ()s2um(mpiydalt licslt a2tax ono4oex iieiytla2raumo u0tlxnxrctydfmD  u i s)sexmio iu4lm emivil() rrmxrpno1opeomi3iydlm rmumsn(0arxrmf3oydlateln o t) rto(o iudopen neils  2tmu  ;u4aet iiciyd s ra( p;t)arxnir3ty1la ranes ( t2umxm3iy4llt  neta() rrmx p;t0tpe  feiytlsDem(vs;u4teermf tydlmteaiesl( trur(rpou4lm  mietlsfa2rrx  oo1tpeo oeiltla2uan o t0tltoir oy1lpDr ieils0 ruoxo io4ole lnci (f 2ta(  ;u0tetn ociad a emn s;(4 rerxfcty1late u s;s) rum(r nu1al nmfvt tf rururo;o1ale mfeias mDuau o;u0 rxrmr3to1lmDr u o s s2toimpio1alen feiasf Durxr ;t1teenmo3tlslaDua(vs;(0teenmocoy1opDrauei;t0seur(rpiu4lp nlnetlt)aDuaxr oo0tptnif3iasfaDea(von(4 reoxfcio1op eaieo s) rumxr3iu4lm   fvtls  Dumxm ou1oltomoetltfs rlnmp t4artnxr3iotfmt  ies t sexrxm3nu1ame mfcsltf Dtr(moot1tlto o3iyt a emn o;u0tltrxo totomt  i i;(  2toim3oy1am nmneiatfsDtmu o;u1tex  ieiytlm um( o;(4treoxo3ty1oa eauei ()srxoxo iu4aleelicsat) rtrur oo1tlen f3ildls2uaumo t)tetrxf3totfpt au s;( texoxr oydom nmnvtl()a2tr( ont1olxoii3iadfs2ua(monu4 etoirciydop e nei () rtmxr iodopeeliesltf 2rrurpnu0aptoiicildla em( p (0artnxrciatfmDe u s t0texmxo3no1opee ivs t aDua(mooo1opx mf3iysfmDrmuvs;u4 rerxf3ootoaDe i ols)teur(m io1lmeemnvi tfsDuaxrpno1opxnmieiyd mDuan pnt)trtriocty1fpDelieol() 2umir3iu4omenmfctl()arrmuroou4optoiiciydla ul(vo;t)tetriociadoa rauvols)t2umim no4lp   ics s sDtrxmp;t0tpen i3iydfs2uau snu)aeermoctodoa  aueo;()srtoim iydalenliesls aDrm(moou0tpxoioeiyt a ra( onu4tetoir totlpteluvi;s0tetoio oodlpeelici ( s2urur ou0tlxomi3iasla rluvpn() lxrxr3tytlpD  u o;(0tetoio oydole mfci s arrr(mpou1aexnmi3tasls rl(von(0tlxnif ia1opDraues ()srtrio3no1ap   fcil(farraxmp;t0oex ifeiltlm2ul(vo u)tltomo3iadfaD  nes;s0 2xoirpiu1om e fvs s) Durxm ;t4tle io3iytfaDeanmp;t4tlxnir io1lat an i;s  2xmxm3ny1olt mnes (f Dtru pnt1opeo octltfsDrmnvp;(4tlxrir ta1op ranvilt trxoxopoodape  nciltfs2ururp;t0aexn i3iatls2ua(msnu0aeeoio3iy1lmtrlnes;s0 rtoiopiodale lnvia()srumx p;u0tlx ioeiytlm2ea( o;(4arerif iytlaDe n sls0sexm(o3iydoleelnct tf rrmump;t1apxnifciys s2uan pnu4arxrmr3oadlpDrlivo;(0tetmxo iudllenmncta(f Drmxro;o0tptnifeiytla2rau sn(4trxrmr3oadopD  neo;s0trtr(m3nu4lm   ici ()a2umu p;u4alxnmicias a2ea( p u0teermr ty1laDranei t0s2to(mpoy1amtelictlt aDuaumpnu4oet io3tlt m eanmpnu0 eerif3ta1lat lu ils) 2uo(rpny4ame mfvsasf rurum ;o4oex mi3ilslmDrmums;u0 lerir io1lmt  n slt0setrir3oo1lmeemnei ()s2tmu ont4oleo iciltla2rm(monu0texnmfcoydlm  lnvs s texm(o3oy4oltnlieils) rraxmpoo0oexnii3ildls2ranmsnt)tlxnxrctytoa  anesl()t2tmirpiu4ape lnci t)s2ra(rooo1ope mi3iad m2rmuvon()altoxf3iydfatrlueil(0sexoxopnydapeemnesltfaDtrur ;u4alenmf3tlt m rm(mp;(0 leoio3iotopt  uvs;t  2toxo3iu1ll n netas)aDrr(  ou4aeeo ociysfm2rmuvs;t4 etnmfciotlmDr nesl(  ruo(mpiu1ol  mncils) Dum(m nu1altomfeiadfa2emnvo t)tlerio3iotla raueils  2tmxopio4lpee icta()s2ta(  oo1tltnmfeildla2el(vs () lxnmf oydlp raieo;()seum(mpiu1aptn nvsl()srum(m nt1oetomf3tydls rm(mp;()arenmf3tytfpt anvo s)seuoxr3ou1al nlncs t)s2tmu p;u0oexomfeiadfa2rmn o;t)tlxnifciodlaD lnei;s)srurxr3ny1om n nvsl(f 2umu pot0tpenmi3iad aDran s;t) exnmfcto1la e ueo s  2urim iydape livt ( srtmum ;o1opeo fctytlsDum(mpnu)aleomr oa1om elnvi s  ruoxopio4altemncslsfs2ur(  ;o0aptn f3iasfa2uanvp u4texoxf tydomDeluei;t  rumio3nudlmenmfctasf Dum(mooo4oee if3iat sDrau o t0artomf3ta1opt ln ol( teumxm iu4al   net s  rraumo;u4tleomiciyt sDulnvo;u0aeerxf iodla raneo;t) exmxm oy1lmeemivil() Dumu pnu4aexnifetyd s2ua(vsnu) lenxo3totlm  aueo s s2xm(r iodalenlfcsatf 2tr(m ;o0oexo i3tlslm emums (4 rtnir iatlpDrlu ilt) 2ur(o3nodol elnviat) rrm(  no0tlxnioctydfs2rm(mp;(4 rxomr iytopDrai il( t2uoimpoy1ap n nesls)arrmxmpoo4oexomfctlt s umnmp (0alerxocoydfmte i il( t2uo(r iudomtnmiei t)s2urumpno1apen i3ild s2rmu p t) etomf3oydopDrai s;()trtriopou4ome  ietl(  2um(  ;u1aex  o3iyt m rauvsnt)aeermfcoo1oat auvs;(0trxmxr3iy1amtnmfeil(fs2umumpoo1ape  octltfmDrluvs;() rxrxf3ia1lpD aieo;(0seumir3ny1alen feslt) 2taxm ;o1tptnmieiasls ulu pnt) rtoxocia1lmDeluvols  exm(r3nu4ll  lieilt)aDur(rpou0olenmocild s ea( pnt4 rxrxr3tadop eluvi;s0t2xo(r no1alen ivi (fsrtmxm ;u0tlt mocilsfa ulnvp u0tlxnif todfmtrlneols) 2xr(o3oydop  livt (fa2rr( p;u4ope mociadfaDea(mo;t4 rerif3iatlaDe i slt0srtoxr oy4ap n ncs sfaDrr(  nu1altn o3iatfsDulu o (0aexnio3oadfpDelueilt)s2xmxmpou1opeemfvt s sDrrx poo4tlxnmociytls2el( p;t4tleomocty1fat liesl( s2tmxr3nudale  iesa()a2taxrpou1opxn fetysfs rlumon()trerxoctydfpteau i;(0trxoir3iy4ame miet (  rrmx ono1tpt mfeiadfa2rl(vo;u)aeerxrcta1opDr u s (0s2xoxr3io1lleelnes (fa2rrx  ot1opeo i3iysfs ulnvp (0tltnxf3ty1fp r nes ()teumxmpoy4opt  neiltfaDtaxrpnt0tlxnmfctlslm em(ms;t0areoxrctytfa   n ol(0trtmxmpiy1opte nci t)s2trx  no1texo f3iytfs2rm(vsn(4aexrir oatlm   u sls0 etmim3oy4alt  nvsltf 2rmu pou4olxomfciatls2um( onu4 exrxr to1fmDr n i;s  rtmirpiy1om n fvi t)sDtr(r nu0ole  o3iysls2em( o;t0tlerxo3iydopDrlu i (0 2tmxo3iy4om  mnvtl()sDtmxm nt0oeeoif3tlt a2elnvp u) etnxfcootoatranei s)s2xrio3io4omtemfvs tfa2raur no0tet mi3iydfs umu s;u4 leoxf3oadlateaivils srxo(rpoudamenmnct s srtaum nu1altn ociytfa em(vs;t4 ltomo oo1opD  ueo;s)t2ur(rpiodlmteliesltfaDtrxrpnt1tleomocildfs uauvo t0alxnxr3oadoa   u o;t0t2uoxm3nodap  lnvtatfs2tax  ;t4oet  feiysfm2elnvs;t0teeoir3io1la e i s t srxoxmpiydlp  mnvtlt) 2ua(m ou0apeo i3tyd aDeln o;t4treomf3tadlpt  i s t) 2xr(opoy1omeelnesas)s2raxro;u0tlxomo3tyt aDelnmo;u4trtrmf tadlaDr i slt0setmxmpou1ll elnctls)sDra( o;u4aexo oetydfs2umums t4tlxrxo3todla raieol() 2uo(m iodop n fvia()s2umxr ot0tlx  f3tydlsDem( pn()tleoif3to1omte i i;t)trxo(r oodaltemnvt tfaDrmxmp;o4tex iocildfa2emn p;t) etomo3iatopDr iei;s)t2xmxr3oo1llen ivtls  2tr( pou0aee  ociatlm2rau s u)artnif3iadlmD  ivils0srum(r nydop  mfet (f 2ua(ro;u0altoioeiad sDrmnms u0 rerxo iy1fm rln s t0t2xrio iodlle  feilt) 2uau  nu4optn oeiltlm2rlnmo;u) lxoxocoa1lpD au i;(0 rxm(opno1amtelfvsls artrurono1tpxnmfeiydfa2ran s;(4aleoxocoa1fa   n sls) rtrimpnu4lpen ivtltfa2rrxrp;u4aptn ieiat sDeanmsnu0altrmf oytfat  uvo;t  rumim oudlleelivi sf 2uaum nu4oetoio3iyt m2ranmont4arxnxf iytfpDe ies t s2to(r3ou1lltelneslsfsDua( oou1ole mociyslaDraump (4 rtnir3tadlaDrlnvslt)srtrxr3io1lp emivils)s2rrum ;t4opeomoctadla2ranvo;t0 exoxf iy1fmDr nvs;t srtmxr oo4lmtemnvtlt  Duaxrpnt4olenmiciyslaDrln o t4 rerirciy1fp r i o;t0tetr(r oy1lpt mfcsl( s2rrx p;o1tlto oetydfa2ua( o;t0artrmrcoydlmDean i s)s2tr(m3io1optemfesl( a2ur(  nt0opxoio3tadlm ean p;u4 exrxfctatom eliei ( seto(o3nodlltemivsat sDrrxmp;o1alto fcilslsDuauvsn(4 rtrxo3iy1la  ai s s0t2xrir3ny4llt lfciltfs2raxm ot1apto oeilsfa2uau p;t0tetrxo iatlate uvi;s0sruoim3iydole  fct (fartrur ;o1alxomoeiyd mDrlnms;()aeerxrcoydfa  anvo;(0 eurxm oy4ale lnet (  Drm(ro;o4aeeniieiadls2ua(mp u4artrif oadfmDeli i;s0s2toir3nu1al  mnvsasf rumurpoo4ape moctatfm2ulnms u4 eenmo oatlaDr uvil( t2urxrpnodole  ivta(farrrumpot1oeeoifeiyd s rm( s;t4trxnmr3oadoat auvslt) euoio3oudopeelfvtlt  rraumo;u0opxnmicildla uauvp;(0tlenio3iotlpteanei t t2tm(opio4olenmneia( a2rmxm nt4apt ifctytfmDemums t0trtoxr ty1oa eluvo;t0sexrir oy4al e fcslsfsDum(r ;o4apeoiieiad s2rau p u4texomr3tydom ranei t)t2tmio3iodamenmfvs (  2uau  ;o1aexoioeiytlaDemn p;t0aexoir3oadopDeanvo;s)srtrxmpoy4lmt  fct t) Dur(rpoo1aeen iciys m2rl(mp;t4 leoifcoydopt au i;s0seur(opnydale  nei s) 2taum ;t1tetnmicild aDrln s ()treomo3tatopD lueilt0setrxopiy1lp nlivtat srrmxr oo0apt miciadfsDel(mon(4alxnircoo1lm   n s;s  euo(m ny1ll e ivt s)sDum(roou1oetnmiciat mDeauvs;()trxnmf oatlmDelieo t tetoxmpiy4lp  mivtlt arta(mo;u4oetoifctld m rl( o t) exoif iy1fateai o;()srxo(m oy4lleemfes tf Duaurpnt1teto oeiytfaDuaums;t)trxnmf tadfa r ivi t  2tr(m nodlm  lnesa( srta(ro;u0oex  fctldfa2ulumo t0texrxo3io1laDr ies;(  2tm(m3ou4am nlfesls sDtru o;u0aee mietldfmDrl(vo;u4alxoxfcty1oat luvs ( s2urxr iu4am nlncs t  2um(roou4aee mfetytfa rmn ont4 rtoio to1op rlnvi;(0texmim oydlp elfvilsf rtr(rooo1tlxnmfciadlm2ulnvo (4trxomfctytomD aieo t0s2umio3iydlleelfet ()srtm(  no1tpx iocilsls ulnvo t0trxoif oatoa eai ilt)trumir3ou4lpeelieiat)aDrau  ot4olxo oetydla2rau s;u0aexrxrcoydop eaues t0setrxm3ou4lpeelieta(fa2taum ou1apx iieiytlm ran pn(4 rtoioctatoa raies s  2xmio3iydlm n icsatfa2uaur nt0altn o3iat m2emums t) exnmfcoa1fa   ivol(0texm(o3iudole micia() rtru oou4tex  f3iatlm em(mp u4 rtrxo iytop   u olt  eto(r3io4ome mfct (faDtm(r ou1oetoiieiaslm uanvo;t0 ltnir oy1omD auvils t2to(mpio1omenmnci t aDta(rooo0alxomfetad s2ra( p;u0tetnirctydfatelivo s) 2uriopiy4alenmivs tfsrrm( onu0tlxomictadlm2emn o t4texnmocoy1om ranes;t) etoxo iodlmee nvta( arra(  ot1oeeo i3tadfm rmuvont0 rtnmo3todfm eli i;t seuoim3oydaltn fes (fsDtau  oo1alxnmietat a2ulumpnu)tlxrxo iadop  li o;s0srtmxr3nu4lptnlnvtat  Dtrxm ;t0olxn i3iltfm rm(vo t)alxrxociotfmD livol(0 2um(opny1ameelies t)srurxm nu0apeoii3iatfm emuvo t4 eenmo3iy1op   iesls0 2xo(r3iodlmtn ivs ( s2rmxmo;t4aptomoetasla rlu p;(0tltrxf3ty1fm  aivil(0 rxrir3nu4ape  ieil(  rrru poo1tpe iieilslsDrln p (4aeerifcia1fptran i;s  rxrxo3ou4amee feta(fsDrr( p;u4olenmf3tlsla em(vp;t)altnmo3to1lptrluesl(0 exr(r3iu1apen icil(f 2ta(rpnu4aee  octlsfs eaums;(0trtomocoodlm rli ilt)setrxo3nudlp   ivtl(faDuax  nt0tex ifctlsls el( o;t)alxnio3iydom eai s;s) 2to(m3nudole mfvtl( aDum(r ;u1oex ioeiydls2rluvp t)aeerircoo1lpDrlnvo ( texr(mpiy4lm nlicia(fs2trur ;o4aetnmf3iasls ran p;t0trxrxr ia1omD livo t s2toio no1lp n ivt t)sDururp;u1olenmf3iytfsDel(vpn()trxoxfciotfpt lues (  2ur(m io1ol  lfctlsf rum( ono4oltomiciysls rmn s t) rxoir3oytfptr n ils0t2xo(opnudal e fctat arta(  nt0tlx ifeiad s rl(vs;()aleomfctytlmteli s;( sexm(r3nu1am elfcil() Dra(m ot0alen iciytlaDea(vsnu) etomo3oodfmtrli sls)sexm(r iu1lptnliei tfartr( pot0teenmf3iasfsDrauvp t) lxoircio1lmt  n o s0trxoio3ou4olt  fvsat  rur(rono1oexn fctatla2ra( o;u0alxnxrcoo1op  lieo;( texoxo3io4lpt mnvtas arrr( ooo0tlxnioctat s2uln o;(0 lenmr3iatfaDrluei s) exoxm iy1ol nlnvsatfsrraurpnt1olxnii3ildfa rlnmp;u0 etomocoytoptean o t)t2xr(o3iudlltelicslt)arua(  ot0aetnioetyd s uln s;t4 eenmfcoydlmDrli s;t truoir3nudalee fvsa() 2urump;o0apt mo3tytlm2el(mo u0teerxf3iatlmDrau i;t0tetrxo oy1open fesa()s2tmu pnu1apeo oetatlm el(vs;t)artrmo3totfate neslt0srtr(rpny4lmt  fet t aDta(mono4optn oeiysfaDulu s t4 ltnmr3ta1faDrlnei t0 exmimpoo1ol nlnesls sDuauront4aexnmfciytlaDean onu)trxnmrcia1lpt ln i;s0sexrir ou1am  mnvta(  2rmx pou0apxoifetatfmDemumon(4 etoir to1fp elnvs;() 2xo(r3ny4apee ieta(  rtaur oo4opxn fciad s2ra( sn()altrio3iy1omDe nes;(0tetr(rpno4olenlnct t) Dtmxr no1oet iiciat mDem(ms (0altrmo tatlpteaueo () rxoxrpiodll n nvt t)srrm( pnu1olxn fcildfs2ra( sn() renxr3ta1la   u i;(0 2ur(o3oodllt mnctl() 2umurono0open o3iltfm rlnmpn(4areoxr3ty1la  aiei ( t2uoirpnodaltnlivsas)a2trump;o1texnmoeiys m2rmnvpnu4arerif3oatoatran i (0 2tm(o no4ope livsls aruau oot1tle mf3tatlm ea( o;u4 exnmo3iodfat aivols0truoim3ou1ol emfcsls)s2rmumoot4tex io3iad m uluvp;u)arermocoatfp r ieslt)sexrirpoo4ame  fcsl(fartauroou0apt mo3iysls ua( o;t) lxoxocta1fmtrli s;()texrxrpoudal  mieia()aDraxroou1teto ociytfm2ea( p u0teeoxo oytfmD lnvsl()t2to(opoodameemivs t arur(r nt1teeomociasfs uauvsnt0 rtoiociodlp e uvsl()teuoxrpiu1lp elietltf 2um(r ;t4alxoiieiatlm2uln p () lerircoodfat  nei;s) rto(o iydop n icilsfa2uauront0altnmfciad m2um(ms;(0 rerio oa1fmte uvsls  2xo(o iy1omte ncsat  2ra(  ou1aet iocild m rau s t) etnxr3iatfpDr u i;()trxmir nu1lmt  fvi tf Drau pot4teeomfctyd s ua(msnt) eermfcta1fmD au olt0truoxo iydlmee nvslsfs2uaurpou1optomoeiyslm el( p;u4artnxr oatlp elnei (  etr(r3no4oltemivslsfsDtmx  nu1olt ifetld s2el(vpnt0alenxf3iytlmt aivs;s)srumxopoudomt mnvtasf rtaumpot4oeeomociydlm eluvsn(4 etnmrctydoaDelu olt0 rumirpiy4lm elncsa()sDra( ont1oetnmfctlt a emums;u4 lerif tatlate nvilt) etm(mpou1amt lnvt () 2rrx o;o4tle iieiytlaDraumonu4aetnxr3iotlmte ivi t srtm(r3nu4opeemnvtat  rtru p;o1apeomoeiadfs2el( p;t0texnmo iotfpDran i;s0s2xo(m ny4amtnmiet (fs2rr(m nt1apeomfciytfa2ua(vp;t0trtnxo to1lptelueo s)srtmxo3oo4lp n ics s  2rm(  oo0tltomi3tlslaDua( p u) lxrmr3oatfmDrluvs;()truoxo3nydopeemivs (fa2rr(  nt0tptn i3iatfm2uluvs;()trenxf3ta1lp  au ilt  ruoimpou4al emieta() 2uaxmonu0tle  fcild a ulums t4 rtrxf3iydfm e uvsls0t2to(r3iu1al   ncs t)s2tmum nu0altoiicilsfm2eau s (0aeeoir tadlmt lieil()teuo(r nodlp  lnei s)artrurp;o0ole io3iysfm2rluvo;(4altrmf ta1fatraues t  eurxo3ou1lmte ieias)arraxmpnu1altoifeiadfs rmums ()tlerxrcootlm  ai i s0 rxrio ny1lltn fciltfs2rr(  ou1tpenif3iysfa2umnvpnt0teerio3oytfateaieo;s) eumimpio1ole lnviltfaDrr(mo;o0tpe  oetls s2ra(vont4trtoir3ta1lmDr uei;t0t2toirpoudalte fcs s)srtaxmooo0tpxomiciasls2ra(ms (4tlenxociotfaDraivi ()srum(mpoydole mivsl( a2raxmooo1tlxn feilsls2rmuvo u0trtomr3iatfa rli i;s0texo(m iy4ameemfes tfsrtau o;t1opeoifeiadfm eluvs u)arenifcio1fptelivilt srxrirpnu1lp emivt s)a2um(  no4aetn fcils s rmu o;t)treomf oytomtraivolt)s2tr(o oy4ol elncsls)s2tax ont1aleomfcils aDelnmp ()treoxocoydom ranvs s)s2umxo oy4ll  miesas artaum ou1tlx mietytla2eanvsnt) ltnxf3ootfpD lnvi t truoxo ooda
\ No newline at end of file
@@ -0,0 +1 @@
+nvils seuriopoy4olenlfetl( srtrurpou0oet mi3tldlmDeau s;(0aleoir3to1omDraues t)s2xrim3oo4omte nvt s)sDuaur no0apt mieiadfsDrl(vsnt)arenmr3ty1oa r uesl( s2urim oy4apt mfesa(fsrtr(rp;o4teto ociydfs2ulnvo t0artnif totom e ivo s)s2trxo3iy4am nlicslsf 2ta(mo;t0tetomoeiadfsDrm(vo u4 renmf oy1lp r ues (0texmim3ou4apeelict s sDuau  nu0tpto iciadfs ranmp (4aexrxfcoytom  an s ( s2umxopiu4omtnlfci t)srtr(r ;u1tlxnmi3tatlmDra(vs;(0 rxoxf tytfate i sl() etr(rpou1olee ivtasfarrruro;t1tptnmicilsfm2rm(vp;(0aleoir3iy1om  lnvo s)teur(opnodal nlicil( s2tmx pnt1tee  oeilt a2ulnmpnu0aetrxrctotoa  aivo s)srxmir no1apt  fesl()a2tr( pnu1olt  ocias s2rmnvp;u)alxnmf3iadlmD anes ( texm(rpou4lp   ncsltfs2uaxmo;t0texomoeiys s elnmont4texrmrctodlmtrlneo;s)sexo(opoo1optnlfcs t  rua(r nu4apeoifciatla rmnmo u0artoirciy1op  lu o t sexm(r oydop emici sfarua(  oo1opxn i3ias a2ua(mp t0 eenmf3tytlm e n i;s srurir3io4lme livt ()sruaxmo;o0tpeo iciyd mDemnvon(0alxomo3tadfpteauvo s0trxr(m3oy1amte nvi sfsDtau onu0olenmociysls2emnmp;t4 renmo tytfm eln il()srum(r3nudlpte fvsls)artmxrooo1tpeniietldls em(mo t4 lxoxr tatlp r nvs t0 euoiopoydape lfvs sfsrtrxmp;u0aexnio3tltlaDuluvsn(4tlxnif iotomD luvs;( t2xrxopiodlpe mici sfa2tmu onu0tetoifctyt a em( pnu0aetoxo tadfp rlivi s  2trimpno1olt lfvils) Dum(mpot1alxomfeiad a2ea(mp (4texnxr oatfa  li olt srxmir3oy4olenmncs s arrm(rp;u1tleomi3iltls rl( snu) ltnmfciydlp elivo t)tetmxr3iu4lpeemfeslt srumuro;u1apt mfcilslmDeau o t4 exnmr3tadopDeanvi;s0 eurxopnodomtelfei tf Dtmuront0teto f3iad s2rau s;() reomrcoodoaDe ieo;s srxoio3oo1omt  ivi ()aDraum ot4tpeniociyd a rmnmpnt0alxoxrcoadfmDe nes t srxr(opoy4ap  mfvia(  Draur ;u0olx  oeiys aDelu on(4 lenxr3ta1fpD li i;s)t2xoim3oydam nliesas)a2umum no4tpxn o3iadfm2ulnvs;t0 eenio3ta1oa eli i s) eum(mpiy4amtnlivsl(fa2rmxr nu1teeomictyt sDulnvonu4 eerxocoo1oaDrlivi s  euo(r io1optnlfvsat aruau p;o1aexoiieias m2eanms t)aexnmf3tatfa ranvi;( t2xoxr oudame lict ()s2um(mo;t1optomfciltfa ul(vo;t0 rtomrcia1lpD lnvs;() eto(o iu1llt  ncsltfarra(m nu0oeeniietldfa2ea(vo ()tlxrio3oy1opt an o;t0trxo(o iydope lnvtl()srtrum nu4texn iciyt s2uaumsnu) lxnxr3iadoaD auvs t  2xoim3nu1lmeemfciat)srur(rp;t0aptomf3iadfmDeanmpnu0aexrio ia1fpt  nvi t) eurxmpoo1ll n fvs s) rrax  no1aexn i3iat mDumuvo ()trerxo io1fa eauesls t2trxr3oo4llteliviasfsrtmumpnt4alxn feiadls elnvonu4artoxfciotoaDraueo (0trurxr3ou4lltnmfvsl(f 2rm(mpoo4oetnmietlsls uluvo;t0trxomfcootoaDelues s  etoimpoudamenmfvtl(f rrmxr ot0tpx  fetat sDuanms ()aeeoxo3tadfp   ueolt0 eurir3no4ll  mnvs sfaruau  no4oltomiciad s2rl(mpnt)trenxfctadomtrauei () etoxmpiy4lmen neils sDtaum oo4apt mictltfsDulu pn(0arenxo oo1fmDr uei (0seumxrpnydlltnmfvsat sDtmuroot0alxnmicilt a2rmnmp ()trxomf oatfa eli ilt srtrio3io1open ictl(f 2tru  nt0alxnmociatfa2emumo t4 ltoxf iotfmD luvil( srxoxrpoy4optemiei sfaDur( ooo0ole mo3iysfa2ranvsnt4tlxnmf ootoaD liesl() rtm(o iy4lmt  ivia( aDrrur ou4tpxnii3tas s2el( pnu)aleomo3tydfaD ai s;t truoim oo1opeelnci (  2ra(m no1tlen o3tytfs ea(ms;t0tetnircto1fm eli ol( t2urxm3ny1lm nlivtat a2taxront1oeeoiocild mDemn p t0 rtniocoadfmtr u s;t texmxm3iy1ameemivi sf Dra(r oo0oexo f3iltls emu pn()altnifcoodomD liei;()sruoxrpio4omtemneia() rum(  ;t1tpen ictyt a uau o t0trxrir oatfpt auvsls)srtmxrpnu4apt lnvi t)artmx  nt0alx  f3iasls2rluvp;t)teeomr3oytlmD ai ols)tetm(m3io4omenlfctas) rrm(  ;o0texnmietytfa emnmp u)tleoif iadlmte n i t sexoir3nydlm elnvs s aDtaxm ;t4tet mociat aDul(ms (0tlxnmrcoadopt  i i t0srumio3ou4ol emfvt s) rtru pnu1alxomieiasfs2ea( snu0texnir3oatlmt anvil()s2trxr iy4ol e ics ( arraxrpoo0apxn fciydls rauvon(4aeenxo tytoaD  ivs () rtr(o ou1am n nvil()a2umuro;o0aeenioeias a eauvp;u0 rxomo oy1fpt  ivi s0srxo(mpno4lme  ncils sDrmuro;o4oleniociadls rmnmp t)trtrmrciatoa  ai o;s0 2xrxopoy1ll   feilt) 2uru o;o4tetomo3ildls um(vp;t) lxrif3ootfm e n i;(0 eur(m3ou4olen fetat  2raump;u1tpx ifciasfaDulnvsnt4tlerxr3totfmDe u s;(  rtmio oy1om emneta(  2trxr nu0oexomictatla rmnmsnt4teenmoctodoaDr i i;s srtmxm iudlmenmnes s)arrrurpno1aeeoio3iytfaDrmu o t)tlxoxfcio1opDraivol(0s2tm(o3ny1al elnvtlsfsDtaumo;t1olxoiieildfs um(vpnu0aetrmf io1fa  au s t)texr(r3no4ap nlnctasf Dumxr oo1olen oetytla elnmont0texnmr ty1oa  lnei;()srtm(mpoo4ol  mfetls)aDtm(ro;o4alt  fctltla emu snt0tlxrxf3tadfaDelivs t0t2toirpiydomtnmnctl( arrmxro;u4alx ifciaslm elnmp t) ltrxfcoydla  lnvo;( tetrir iudlm  mfcs ()a2ur(mpnt1opt ifetytfa rmu pnu)teermo todfa elnvil( srtmxrpoodolt  fetat)s2rrur ot0altn f3tatlaDumnvp u0trenmrctatfate iei s)srumir3oy4lltnlfesltfarrax  nt1tpxnifeilsfa ea(vo u4trtnxf ty1omte iei;s)s2to(r ou1openmivtas)srtrx  no4opxo f3iysls2rm(vs;t4 rtnxr3oadlm e nvo;t srxmim nydole  ivt ()sDtrurpno4alx  o3ild a2uanmp u4artrxf tydom  aiesls0teumiopno4amen fvs t aDra( o;o0opto fciadls emuvpnu) eenmocio1lptraues;s)t2xr(o3oodap elivt t  2ua( pno1tptn fcildfm2uaumsnu0alxnir oodfp ranvs;t0setm(rpoy1lm e iet tf Dtrxm ;t4tptn oeiysfs umn snu4 eerxo oadomDraieo s  exr(o3ou4lpenmnct s)aDum(r ;o1ole mi3iyt sDean o u0 reoir oatlpteanvsl() 2xmiopno1ol nmnesat)s2umx  ou4olenmociltls2rmuvp;u4aeenxf oydfmt luvs;s)trurxopnudlpeemivsatfsDrrur ;o1tetomfctltla2eln o;u)tltnio totfptraivi s  rxrxr3iy1lle  ivslsfsrtm(mpoo0alxnmieiaslm2el( pn() lxnmo3tadlmtr i ols) 2tmxo iy4oltn fesa(faDtaxroou4tptnii3ild m2ua(ms;u4 ltnio3iydfm  luei s0s2xmio io4ll e neiatfs2umx oou1oee ioctadlm rlu pnt0 etoif3to1fmtelnvslt s2xrim io4olee fetasfsrum(rpnt4tpxoifcilt m rm( p u)altoircio1op ean o s  rxmxopio1llte iei tfarrm(monu4olxomi3tysfmDemu p;t4trerir3totlp r uesls0teuo(o3iu4amtnmnctl(fs2rrxr nt4oetoioeiasfs elu o;(0artnio iy1fp  an sl(  eto(o3nodoleelfvt ( arua(m no1tpxomo3tld m rl(vo ()aetoxf3totfpDeauvs;s0 etrio oo1alenlfctas) rrm(m no0aeto feiad s2eanvpn()teerxr tatfmtr u s t0texrxrpiu1lmen fcsa(faDtax pnu1tlxniiciatlmDrl(mont4altnio ta1lpD  iei t sexmir oudaptemict s s2tmxrpot1ole ifctydfs ra(mont) etomo iydlpDrai ol(0tetm(mpoy4lm nlivtatfa2taxro;o1aeeoiietasfa2eanmp;t)arxnifciy1fm  aiei;t)t2xm(r oydoptnmnvil() 2urur oo1optnifeiadlsDemnvo (0aeerxo3ty1latelivs;t s2toim3nodlme  fvia(f 2ur(r ;u4tex  i3tltfa rl(mp;t0tlxnxrcoy1opte neo;s) 2um(o3iu1ap emfcs s)s2tmxm no0tleomfciat a umn o u)alerxo3oodfp e u slt0 rtoxo iy1oltn fcsasfaDua( ono0oltn ociat a2rmnmpn(4 reoxo iy1lptelivi;(0t2tr(m3nu1llee iviatfartm(mo;o0oetoifciydfa2ra(mo (4 eeoio3tadfpt aneslt)trurim3oo4lptnlnei (  Draur ot1opeoioeildfm em( o;u0aetomo oo1faDr uvs;(0 euo(m iy4ll n iei s)srraxro;u4oeen fciyt aDea( ont4trtomo3tytom raies;s) 2tm(m3oydapenlici tfsrtaum ;u0tpt  fetlt m umuvont4treoio3totoat an ilt) rxoxo nydamt  fesl(  2tmumooo4tlxoioetys s2ua(vsnt0 rxrmf3todlpD luvil( trumim3io4ame  icsl(f 2raxmp;t4tltn ieiadfm2ra( p;()aetnif3io1laDraieo () rumxmpiy1oltn fcias arur(r ;o4opxoio3tlt aDel( p u0artnxf3iytlmDraiei;t0s2xmxr iy4ome lnes t s2ua(mont1oet ifctldfs2ul(ms;t0 rxomrcoatfaD  ueo t)trur(opiu1ol nmicilt  2taxroot4ope  f3iydfm ranmp;u)teermrciadoate neolt setrxr3nydlpt liviatfartmxmp;u1apeo ietyd aDua(msnu)altrio iodopDraieo t0srtm(rpoydol nlnvilsfs2ta(moou1opeomfeiysls2eauvon()teerxoctodfpte nvs t) rxrirpnu4am nlfvsa( aDrau o;t1oexnii3ildfm rln ont4aexrir iotomt ln s s0 rurxopou1lmenmfvsa( s2rr(monu4apenio3iaslsDeanmp t4arxnxo tatop raivo;(0 rxmirpoo4amenmfvs t s2urur ot0oet iietyd m2eauvs t0altnmf iodlaDr nvi;t0teurxopno4ope mivt () 2tm(ro;t4aeeoifciat s el( p t0alxrir ia1om   n ols  etmxr3ou1lpenmfvsatfs2umuro;o1opx mfeiatls2ea(mp t) rerxr ta1opD aieils  exm(r oo1apteliet (f 2rrurp;o1alxoiieilt a2rl(vonu0tlxoxf3iodfaD  nvs (0 2toxmpiydaltelncta()a2urxrpoo4oexoiieiyt a eanms;t4 eenxf tydfate neol() 2urxr oudlltnlncsls)s2taxrpno0teenifeiydfa el( pn()trerir oa1fp  aneslt0 2xoio3iu1ope lfesas srtrxr nu1opxn feiyd mDum(mp;u)trenxociydfp   nvols tetmio oy4ape mnetltf Dtrurpou4oleomfciasfs rmnmp u)teerif3oatomtelu s t  exmxm ou4op   netl(f rrmxrpoo1tet mfciys m rlu sn(0 eermrctadoaD  ieo;()t2xrirpoudlpte nei (faDraumpnt4aeeniiciltlmDum(vp (4 eerio oytlmDr ueolt tetoio no4lmtnlncs ()s2raumpno1apeomieild a2eauvp (4tlerir3oo1lm rlnvi;t)t2xr(m3oydale mietasf rrm(mpnt0oetn ociydlsDul( pnt0 eerio3ia1opD  nvs;(0s2umir3iu4lltemncsat  2tmu oou4apen ieiyslsDrmuvp;u) etoxf3ootlpteauvi;(0srtriopoy1alenlictasfaDua( ont1oex ifetatla2elnvp t)tlxniocoy1omDeluvo;t  rtrimpio1ll elfctas)artm(m ou0texnif3tldfs2ranmo;t0aetnircootoa   i o s  2xoir3nodlltnlnci tfsrum(m ;u4aeenmfctas s2ranvp u4tlermr oydfptrln slt0trurxrpoodomtemneiatf Dta(root0tee ii3ias mDulnvo t4teeomo3iadlptrlueo (  2tr(o3iu4omtn nvsas) rraxr nu1tetn fctlt a eauvp;u0 rtomo3todlm  anei;(0s2xmxr iu1ol nlivi s)a2trxmo;u0oee iieilslm2uanmonu0 rxrxrcio1lmt  ieolt0tetoirpiy1am emiet sf rta(rpoo0ole  oeild s ea( snu0arenifcty1lptranvil(  rumiopno1lpe  fvt ( aDrr(rpno4olxn octyslm2um( snu0aexomo3io1fptrlu o (0srtoio nu1altelfvsl()sDum( o;o4optnmfeiadfm2uanmo;u0altomf3tatop r ivi t) 2urxrpio1lpenlfvtatfa2ururo;u4oleoif3ild s emuvonu) exomf tydlmD auvolt  rurxrpnydlle mfvsls)s2ur(rono4olxomfetad a umump (4aetrmo iatop  lueils t2urxm oy1lmtnmfeia(  rururp;t1aexomi3iaslm emuvont4aexrxf iadlp eaueil()truoio nudomtnlfesasf rtrxro;u0oet mo3tldlaDra(mo;(4 exnxr tadla   ivsl( t2xr(m3iy4op nmfvias a2trxront4aleo f3tlsla2ra(vo u0 lxomf ia1late nes ()teuoim nodom nmici ( sDum( ont0olxnio3iatfm umn s t4tleoxr3iytla raieil()teurim3nudlptn iesls  rtmxmono4aexn fcils aDuauvs;(4 reomfcoatlmDr n o t texm(opoo1opte fei s)a2urxmpou0oltomictys s rlnvs ()tlxrifctytom  anvo;s0trxrxo3iydlpte ivslt) 2raxmo;t4tle mfeiyd a ulnvsnu4alerir ootlmDrlnvs ( srxm(m oo1olenlncta(fa2ur(mono0optn f3ilt m umnvs (4 etnmo oy1laDr ues s) rxoxopiy4altemfct ( sDtmxr nt4aeeo oetls a ulu s;t) rxnxrcoadop e ieo;t0 rxoxo3oudlmenmncilsfsDraxrpoo0optoioetytlsDrm( s;u)tlxnxr iotlaDraueo t)teum(m oodlpt  nesas)srrau pnu4olx miciydlaDul(mon(4altnircoa1optrlu ils trumxm nudolenlfvtls s2urum ou1tex miciadla2ul(mo;t4 lxoio3oatoaDean i s  exmxm3iy4ale  nvsatf 2ra(rpnt4ope mfctad aDulnvsnt4teerir tatlm eluvolt) rxo(mpio4opte feiat)artmur nt0oeeoif3tatfm ua( s t0 renxo3iotfmDelueo;s0trum(m3io4ale  icsls) 2rau  ;u4aex ioetltls ran o t0tltrxo oytom r u s;t t2xm(o oo1openlnvsl()sDtr(moot1alxn icias a2umnvonu) rxnxrctydomDr u il(0srtriopoo4al   ivi s  rtrx o;o4opeo i3tyt m rmnmp;t4tlenxocoa1lpt  u s;t0srumim3oo1olenlicsa()a2uru p;o1oet mi3iatfsDuanmon(0arxoxfcoy1oat  i s ( s2tr(opou1op nmfvslt aDrmu pnu1altomi3iysfa2rau p;()trenxrcta1fm elu slt) euoxm nudol  lnvs s)aruauront0oee  feiltls2eanvs;u)tltnmr3tydoatelnvo (0trumxo3io4aptnmfcias srtmumpou4open ictatla2um(vp u4 rtnmfciatlpDranvi;s) ruoxr nu4op elfesa()s2rrx pot1oex ifetad a2uln o t0tlxriocootfaDe uvs s)teumiopnydolenmivsat  ruaxmonu4oltnif3tad m rmnmp;u0tetnmr3oa1la r u s t0 rxmxo3iy4om e feias sDrax p;t0oltomf3iadfm uln p;t4alenmr oy1lmDrau s s  2toxopoudll e fcsa(fsDumu o;t1opeo f3iydfa2rm(mp;(0tltnmr3iy1fa  aneil(0s2xoimpiodapeemfci t aDurur nu1optoioctld m2emnvs (0 eeomf3oytoptrln i s0s2uo(m nu4lpt  nvias) Dur(  ou1aetoifetasls2rmums (4arerxo3todoat luvols trto(rpoy1olt  icslt)s2rmxro;o0opx moeilsfaDuauvont4tltrifcoadfmtr n i (0seurirpiodlpenlneslt)sDuru ooo1oeeo i3tadfs2emn p t0texoxr3tydfaDelueils)trxm(r3oy4omtnlieia(fs2rmu  ou1alxn ietydfaDel(von()aeeomo3totlpDeli i ()trto(m no4amteliet (  2rrumpnt0oexoifciyslsDrm(ms t4tltoxfcto1opDelnvo;s  2xrxo oo1ap n nvsl(farrmum nu4tlxoifeiatls2rmn sn()aeeomfctydlpt ai o (  2umxo3nydlmen fvtl(fartmx  nt1apxo o3iysfm emnmon()artrifctatfaD lnei;s sruoxopoo4op nlies tfartrx pnt1apx  fciadfs2el(vp;u0 rxnmf ta1fmDe n ol() eumimpiy1lmtemfetltf Dtau ont1apenif3ilsfa emnmp;u4tetomr3tadlpDr i i;s) rxoxr ny4apen nvtlt)sDuaumpnu1texnioetlt s2ulnvp ()tlxoxr3oatomD an slt) 2trir3iy4llt lfci (f 2tmum ;t1olxn ietyslmDrm(vs u4tleoxociy1fpt au o;()t2to(o3io4am   fvta()a2trumo;t4oexnmfetls aDrln pnt) etoif todla eln s;s0 ruo(opiodal nmiesl(  rrmu  nu1tleoii3iys m rmu sn(4aetnir io1lpDeauei;s)setmimpno4aptemncta( arta(r ou4aet mo3tltlaDul( pnt)tltnmr3oodfat  neo;t seurim3oodlmte ietasfa2umx ont1aet mo3iatfaDua(vo;t4trerxrcoatfaDelneo;t srurimpnodoptelivsas)sDumxmo;t0tltomoetldla2raums t0 rtrir ootom  auvo;t texmxr iy4opt  fesltfaruaxm ou0tetnifeiasls rm(vpn(0areoio iydla   ivo s s2toxopoo1om nlivsls)srrmur nt4teeoiiciltlaDem( p ()arxrmrcoydfp r n olt0setr(mpoo4lmtelieilsfs2raum no4optnio3iyt m2umn p;t4tltoxr3iatfa r u s s)setmxo3no4amt miei ()arrax  ;t1tpxoiociat sDulu snu4aexnmr3iytfaDe u o ()t2trxopoo4olee fvt tfsDtru  ;t4tpeoiieiysfmDelnvo u)arxrxfcoydfa   ieol(0srtmio iy4aptnliesas  2ta( ono1aee io3tldls ulu snu) rtnir oatlaDr ieo;s  ruoimpiy4llt  nctlsfaDtrx  no0olx  iciysfm rmums u)arermfctodlmD li s;t) euoim3oodap nmneias) 2urx  oo0oet ifciyd s elumont0 etnmrciytlaDraivi (0tetmiopnodlptelnei s s2tmxmo;t1apx  i3iyt a ranmsnt)tlxomoctydomt lieils) exoir iodap nlfvsl(farur(m ;t4aleoii3tltfaDuan s;() lxoxo3to1lpt lnvil(  rtm(opoo1am e ict s  Dtmx  ;u4opx  feiys mDeln pnu)tltomrcoatlatean i t  rtmxr3nydopeelfvsls artr( o;u1tpxomoctatfa eaums t) lxrifcio1om elu sls) 2uoxr3oodam   ncils a2tau o;o0tetnifciydfsDuau s;(0trxomf tytopteln s () 2to(r3ny1om  lnvt s)s2ururpnu4oleoifeiaslsDumums;u4alxnio ty1oaDeai o ( t2trxm oodaptemnvtlsfs2ra(mpno4oeeomo3tlsfs emn s;t0areoir3oydla  lnvil()trumim nu4om e nvsls) 2um(root4ape mo3iytls2ea(vp;t4trenxrciotfa r ues;s t2toiopno1llte nvi t)s2raxr nt4oex  feiadls ulnmsn()tlxrxf3oo1la  luvil()srxrim3iy4apeelnctlt)a2raxronu1alen oetydfaDelu s;u)alxomf todlp  lu i;s  2xmxmpnydomtemfcia()a2raxmp;t4oee iicildlsDumuvp;t4 exomrcoadlp eau ol( seum(r3iudal emnetlt)a2ur(ro;o0tpto oeiltls uanvo u) etnxf3oo1opDe nes t) 2to(rpoy4oltnlfesas)srrr(mp;o0aet  i3tlslmDem(mp;u) exoxf3ootfaD anvi s trtmxr oy4omt  iesls a2rr(m nt0tlen i3iys s ua(vo;(4 exnxf tytlpt aieils0 etoxo iydolenlietls  2ta(mooo1opx  fetasfa elumo t4aleomrcto1lm e ues (  rtrxr3oy4apen nctas  rraumo;t0tpxniictlsfm2rlu s (4trtnio3ootfmteauvolt sexm(r3nu1omee ivtlt s2taxmpno4aee  f3tydfaDulnvs (0alenir3ia1lm r i sl(  eurir oy1lptn nvias srtmumono4opxnmfetadfs2um(vs;u4trenio3ta1oa  livs (  rtm(opiudalt lfvils)a2urum no1aptnioeiytfm2ul(vsnu)treomf3ootlpDeaivsl() 2uoxo oy1lltn fcias)aDra( ooo1alto ictat mDua( snt0aexoio iotlpt auvilt) 2umxopny1op  mietlt) Dtaumooo1aeeoiieils mDemums (4 rxnxf3tydopt  ueslt) rxoirpou4ameemfesas)srrrump;t1oexnifeiltls2um(vsn(4arenmfcoy1fpDe ieo ()s2uo(opoy4lle  ivs (fs2umu ont1tlenmietad a ul(vpnt0 lxrxocty1lateai i;( t2uoimpoydlp  miviat)s2trxmono4olt  ociytfs el( o t4aetnif oy1lmtelivil(  2umirpnu1llen ivslt sDuaumoou4oltn o3ildls2rlu snt4 eeoxo oodopt au i (0 2umxm3oy4apeemfvias  2trum ou1tlenmi3tadfs2elu pnt)texrmf3iotfm e ueol() rxr(m3io1llte iei t)arrru  ou4oltn f3iltfs ra(ms;t) renxrcoy1lpD lnvs;s)srxrir3no1lmtnlnvtls aDraxrp;o1tptomfctltlm uau o () eerxfciy1fm rauvo;t srurxr3oydlp  mncsltf Dum(  ;t4ale  i3ild sDrm(mpnu0tlerxociatfa r n i;t t2uo(r3iy1llenmnvs s) Drmx o;o4tet mietatls umnvp;t)trtnir iodlpD au s t0 rxoio oo1apte fvtas)aDrmxr ;o4aeenio3iysla ua( o;t) leomo oytlpDrli s;t  eumiopno1alenlfcs t s2umxrp;u0apen ictydfa rlnmp u4teeomr oadlpD an i;t)t2umim3oodal  mietl()srumuro;o4opt  o3tlslaDul(mon()teeoir oytlmDrlues;s t2xmxr iudolt  iviat)a2raxr nu1ape ifetydfmDua( p;u4tlxoio oydfmtelnvo;()sexoir3nydal nlnvta(f rtm(  ou4alen f3tltls um(vp u)aexrmr tatoaDeaueo;(  etmir3nu1alt  fcs ( a2umxrp;u1alt ifctatls2ea(vpn(4arxomfctotlp eauesls)s2tmxopio4lpt lncslsfa2urxm ;t4aetnmieiltfmDelump (4 etnio3ta1lm   ivo t0trtr(m ou1am elncs t srraurpnu0oeen i3iatfa rln s t4altnmr3tadopDelnvols  etrio3io4lpe mfesl(fs2ua(r ot0opto i3ilsfm2rmnmp t)tetrmo todlm e ueo;s0s2trimpiydllte neia(  Duaumo;t4olt ioetysla ulnvp;u4 rtrxo3to1op rauvi;s trtrir3iy1oltn ivtasfsrtau pot4apx  o3ildfs2umump;(0arxnir3oy1fmtr ivo () rtrxmpoo4al elfcilt)sDrm(monu0oleoifetysfa umn s u0trtoirciodfa e i s;t s2trirpoodol nlicsls a2rr(rp;o1aptn i3tadla uanmonu4 eerif3ia1lmD  uvs t0trxo(mpou4lmenlnvi (faDtru  ou4tet mfctad m2elu s;()texrmo3iodomteaues t) rtmimpoo4lm   fetltf Dua(rpnu0oexn oeiad a2ea( p;u4teenio oa1opDe ivsl(  2uo(r3io1omen ivsls)aDua(mont1apx ifctltlm ua(mpnt4areomr3oy1fm elivs t) exmiopno1op n ivtas)a2tmu p;t1oltniieilt a uln s;() exoir tytlaDelu sl()trxo(rpno4ol elies t)aDra(mp;u1open i3tatfs2rmuvp;u4tetoirciy1fm ranvo;(0srumir3io4lmtn ivi t s2rrxrpnt1ale ifcild mDuanvon(4tetoxf3oy1om raueo t t2tm(o iudll  mneta( aDur(rono0tltoio3iltfa2umnvpnu0trenmr3ta1oatelivi ()setmxo oy1op nmieslsf rur(mo;t1tlx  octat s em(msnu4trxrxf iy1opD livs s)t2umxm oy1amtnmnvi s) 2uaumpot1aetoiietysfs2rmu p (4trxoxr3iodoat aivs;s0 2ur(mpiu1lltnmivta( aDtrxm ;o1alto oetyd m2umums t4alxomo3iadomD  iei t)sruo(m3ny4am emfes sfaDta(rpno0tetoiietydfaDrmnvo;t0altoxo3iadfa rli o s0setrxopiy1lle lnvils  rum(m ot0oee  fciasfmDea(ms;t4 lxomoctadfmDr nes;()s2uoxrpnu4openlfcsa(f 2raurpnt0aet ifeiad a2rmuvon(4 leomf io1fpDeaneo s  etmim3oy4al emfvs s) rur(r ;o4opx  fciatfs2el(vpnu4trtnxr tadlm rau i;s)trur(opiu4apeemfcil(fs2rrumpno0aetomi3iltfs uanmsn()teerxf3ia1lmD  u il( srtr(o nu4ll e ivtatfsDum( pnt4tetn o3iaslm umu sn() ltrifcoydlatraivs;(  etm(r nu4optn ict () 2trxrpnt0oeen oeilsfm rl(vo t4texrmf oytom e i olt0 etoxo no4apte netl(fsrtrx p;t1apx iieildla2ulums;t0 etnmo3iatfatranvol(0t2tr(opnu4om n ieilt  2umuronu4tlxo i3iadfa2eau pnt4arxoifciodomDrlivsl() ruo(o io1lmen ies sfaDumu  no4aptoiieiltfaDranvs;()trxnir ta1oaD li i ( seuo(o oodoptnlnet t) Dtrxm ot4aleo oetldla2ea(vo t0 lxnircoodoate ues t srxmim3iydom  mict tfartmx  ;o0olt  fciytla elnvsnt)texnxo3iatfp  li slt)t2toir iu4ol emnctat  2trxroou1oetn feiysfs2rauvp t) etnmr oatlmteln s;t)seumirpiudll nlfviatfsrtrxm no4alx if3iyslm ua(vs t0alxnxf3oy1omDelu ol( setr(m oodllen ncias)s2rmx  ;o1oex mf3iys m2umump t) etoio3oadla ranvo;(0 exrxr iu4omenlict tfs2trxrpou4altomo3tldfm eln p ()tleomfciadfmt  nvs (0texr(opno1ap n ivtls sDurxr ot4aeto f3iasfm2rm( p u)alerio tydfm e u i s s2trxo3io4ap nlics t)aDrr( p;u4olx  f3taslaDulnmpnt0teeoxf oadlpt luvil(0 2urimpoudll  liesa( a2uax oou4tptomo3tls aDum(vont0 rtoio3iadom r nes;s setrxrpoy1lltelicilsf Duaxmpoo1aex moctlsla emnvon(0altnir iytomDr iei;t0 ruo(opnydlltemnviltfsrraur ou1alxnmfcilsls elumo t) etoxr3todoptr nvo ( trtm(r nu4lpee fvils arurxmonu1tltniiciytlm eanvp (4tetrifciy1fa elu i;t sexmxm3iodalt miei (fs2tmurpot4tpt  fciyd mDumuvp;t0 rtrmf ty1fpDrln o s  rum(mpiydaltn nctl(f Dtrxm ou0oexomfctldla2ul( p;()tlenmfcio1lptr neslt trur(m io4lmee fesa(  rtmx  ot4alxo oeiadfsDul(vo u0 rxnxf tytlmDrlivi;(0s2xmxr3oydapenmneils  rum(  ou0oee iicilsfm rlu s t4tlxoio3tydfmt ai sl( s2trxm ou4lmenlieta()a2rm( pno1oetnio3iydlmDeaumo t) rxnmr3iadomD lueilt)s2xoxopoy4lltelneil( aDrmxm ou0opto fetlsfaDelumpnt0artnif tytoaDraueslt0trumxr iydllee ictl() 2umxmont0aexnmfetysfm2elu s;() exomo oadfat  uvi;t)s2toirpoy4optemfctls)arrmx  oo4aex  octadla rluvp;()arxrif ta1omDelu olt)setrio iodalt  feilt aDtrx ooo1olxomoctytla2uanvo;u0 lxnxf3oadlpDrai ilt)seurirpny1omenlfvi t)srrr( o;u0tpe micilt s2rmnvp (4 exrxoctydoaDr uei;(0tetmio ny1omt  neilsfa2rmu p;t4ole ioctysfa um( s t)trtoir3ty1optraivolt)teuoir oy4lp n nvs (faDum(ro;o4tpe mo3tldfm uanmsn()arxoif iytfmD auvi t)tetr(m3oudoptn ivsl( arumx p;o1aptnii3ils a2rmumpn(4trxrmfcoatfpDe ieo;s0 2xoim iu4lp emnci t) ruaxr ;u1oee mfctytlaDulu p;(4tetrxo to1oatelieilt)t2toim nodopeemfvilt) 2urur no1tetn feiasfsDrau sn(4teerirciydlmDelies;t) euoxopiy1ol  mietltfartaxm ;t1tpt  fcilsfm2umu pn(4areoxrctadfa  anes t tetr(opiydol  mivsa()artr(  ;o4tlxomfctytla ra(vpnu4alerxocta1fatr ivo;() rtrxm ou4amt mneils)sDumx pot1optomfeilsfs2em( onu)arerxr iytopt aieil(  rum(mpnydapenmivtlt aDrax p;t4tetnmictldfmDumu snu)aleoxf3iytla   n i;t) exr(o oy1oltnlnvtat  Dtaxr ;u0texnmociytfsDem( p ()arxnxf ia1lmDr uvi;s srxoxopny4ame lfvt ()aruaum ;t0oexnioetatfa2rlnvsnt)alenir3iy1laD lnvo s t2uoio3oydamtemiet tfsrurum ;o1apeomocildfs2rlnmp t4treoio iydopDelieolt0t2tmio ny4olt mivsls)arumu  ot0tet  f3tls sDra(vo;u) rtnir3ty1omDr n sls t2xoxr3oy1omtemfeiat srrm( p;u0teeoiociysla rau s;(4aetrmf3oydlp elnei;s0 eto(rpnydll emfcsl(f Dtrx p;t1aetoif3iatfm2rmnvp t)trenmr3tytom e uvol( s2xm(o no4amenlncia( a2rm(mpou0opxoiieiyd aDel(mpn() rxniocty1oa eli o s)t2urxm iy4opte iet sf 2rax ooo1aeenmiciltfs ulumonu4arxomo3ia1lpDe uvo;s setriopnu1ll  lfcsatfartm(mp;u0teeo ociat m2emuvont) renxrcto1oat au o;t trumim3oo1llee icsasfsrrm(r no1aeto i3tyt s2ua( snu) reoiocootlmDeluei t srtrxmpoodamte fctat)s2ra( o;t1tlt ioeiat s ea(mp t) etnmrctodopD  nvo;t0trxoxm3no4omtelfes tf 2tru pnt4tlxnmi3iltlm2umumo;t4 lxrmf3iatfmD ln s t)tetmxo3ny4openmivs t)srtru oot0opto fciyd sDum(ms;t) lxrxfciydlp raieo t seurxr ny4lltnmictls  Dtrxmonu1tpenmfeiysfs2rau p t) etomfcoo1fm   ues t) 2uoirpiydapee nvs t s2tmu  no4alx mo3tys a em(ms u4trxrifctatopte nvols) rtoxo nu1llte neta(fartmx  ;o4ale  feiat m2ulnvp t4 eerxr3oytlatraues;s  2xmxr no1lm emicsls) Dtr(mp;o4openifeild sDrlu p (4treoxf3iadlmDr ivolt)texoiopnu1oleemnvil(fartaxrpnu1tpe ifeiyt a2rm(mo;t)trxrmrcootoa  aivo s texmxo ou4apt mfesls)aDuru p;t0tltnifctlsla2rl( p (0tleoxo3ta1oat aiei t s2urxr nydllte ncs t) Drmu o;o4olxoio3tysla2em(mp;u0alenxo tydfpteai slt0t2xr(m3iudapt  fesa(fs2tm(ronu4tpt ii3iad m um(vp u0trtoir iy1lptrai ils0seumxr3iu4alte ivtlt)arum(rp;t0teenmoctyslsDuln s;u4teenxo3oatlpD  i o;()srtoxmpnudll emicsat  Dtmumpou4opxoifeiysfsDra(mo (4arxnxfciy1om  luvs (0teur(o ny4lmtelnetl()srra(mpnt4texo o3tltla2ra(vpnt0 reoifctodlpte nei t setrxr ny4lm nmfctlsfa2tr(m ;u4opxnio3ildfm2ua(vo t0 etnmfciy1opDeanvi (0trtrir io4omeelnvsls a2uaxrpnt0teeo iciytlsDeauvpnt0 eeomocoytlaD an o t0t2xrxm3oy1ole mnvt t) rtmxmonu1tltniieiadlm rmuvs (4trenirciy1laDrli il()teum(o ou4al  mictas  rta(rpoo0ope  f3ildls2emnvpnt)teeoio oydlmtr uvs;(0srurxo nodlpt mnet t aDtmxrp;t0oetn o3iadfa2emnvs;(0arerxocoa1la rlnvo t  eurxm3nodol  livias)arrrumont0aeenmf3ilsfm2ra(ms;t) eerxfcoytoa   u ols0srtoir3oudal elncia(f 2tru  nt1ale  oetadls um(mp (4 lxoxr3iadfm e uvi s)t2xo(o3ou1ole  nvias) Dtrxmo;t1tpt  ieiltlm2rmuvp u4tetrir3iodlat lnvs ()teurxmpno1ole lnctat a2ta(r ;u4alen fciadlm ua(ms t4altnmf3io1lat livs t trurxr ou4lpee nctasf rrmum no1aexo oetasfs ua( sn(4 lxoir3iadfpteli ilt s2uoir3iy4ame lfct tf 2rrxm ;o1texniietld m2eanmo u)alenif oy1om  au il( setmim nydapenlfeiat  rtmu pnu0tetnifcildlm2rlnmpnt0 lxrxo3to1lptraieo t seuoxo ny1am  mncsls)a2rrx p;t1opxoiiciltfs uln p t)tlxnxf3totlatelu ol(0srxm(opnodol emfvias  2raxmo;t4tetnmo3tyt mDuanmsn(0trxomociytlpt an i;()teurxo3iu4am n fet sfa2tmuroou4tltoiociys m2eln pnt0 exnxociydfatrluvils0srtrxrpoudlp e nesat) 2um(  ;u4oeenmfeiys s raumsnt) exrxo3iodfa  livi;s0 2to(m3ny1ol n iesls  2uaumo;u1aet  feiltfsDuau pnt4tetomoctodom raueilt srum(rpoydap  mici (f Durum ;o0oeenif3iadfs emnmpnt4trxnif3oydfm e ivo s)sruoio3oo4ll emicils)srtaxmpnt4tle  fciadfa2rl(vo (4alenio3iodfp  au i;( s2to(o3iudomenmivsas  rtaur nu1altn oeiysls rmuvs u)aeermfciy1omt lnvo ( s2trxm3ou1op elnet (faDrr(roou0apx mo3tas a2uln o t4 rxnxo3iotfa r u il()truo(r iudop   icslt  2tr(rpno1altnifeiyd s2ea( p;() rxoxoctadla eaiei;s)setrxo oo4op nlneiat)s2ua(ronu4oltomo3tltlsDelums t0 lxrmr ta1oaDr neils  eur(mpoudam nlivslsfs2raxm ;t1oltn oeilslm2rmu s;(0teerio3oa1optrai s;(0seuo(rpiudlmt mictlt)a2rmu o;u1tptnmiciysfs2raumonu0texnxrcia1fm elnvilt) 2xrxm oodlpt  nvi t aDumxm nu0ape iieiad a uln on(0trenxr oo1oa r uei;s  rxriopno1lm emfvtl()a2uaur no0tetoiictlsfaDean p u4 lxnmo iydoaDelu s;( setrim oo1opte ies tfa2rrumo;t0ole  f3iltfm2ean o ()tleoif3tatfm elneo ( texmio3oudoltnmfct (  rra(rono4tpxnmfeiat s rlumon(0 ltrmr ty1om r i s t0t2um(m oo1ap emnci ( sDrrur ;t0aptoio3iltls uanmp t4trerxo3iodlpt livo;s0 2to(m oy4alt miet (f rtr(monu1aet mfcild s2uauvo;t0tlxrxf ootfmt aieil() 2tr(mpiy4oleelnet tfsrrrxrp;t4oexomi3tldfmDea(vp ()treniociodopt an sl()seumim3ny4amenmictl(fsrumurp;o0tptnii3iadfs em(mo;t)teeoxrcta1faDr ieo (0sexm(opnodapt  nesls artm( p;u1oleoiociadla rlu o t4aeeoxf oodfa rlu o;t sexmio3nydlm nlivilt srtaurpnu0teto f3iltfm2umumo;u0tltrmf3iodlp rli i (  2tm(o3nu1lmt liet ( s2rrxr ot4tltniociyd a2uan sn(4alenmo iydfm  anvilt)s2xrio3io4openmici () 2taxr ;o4tex iiciaslaDran s t)altnif3oodlptelueo;t trxrir no4lpee fctas a2ururp;o1aptoii3iltfaDelu o () rtnio iytla   uei;s0 ruoirpnudaptemivtatfsDtmxrpoo4olxoiieiatla2emumo t) lermo io1fpDr i s t  etr(o iu1al e neia() 2raxrp;u4olxniocilsfm umuvo;(0alxnio3iydfaDe nvi;s truo(m3nu4lmtemfcta( arum(m nu4olxo i3iysfsDua(vp u)artrmr iadop rauvi ( sexoxm nu4ame mictltf Dtaxm ;u1open oetydfaDua(mon(4artnxf oo1fa  an i t0 etmxo3nodlmtn feilsf rumump;u0altomociltls2umn p;u0trtnif3oadoat  nvilt)srxoxm nu1lpee ieia(fsDum(mp;o0olxnmf3tatfs2rlu o (0tltrirciadlaDrai i t) ruoxo3oy1ope  ivt t aDua(rooo4tpxoiietyd a2rlnvo t)trxrxo iotopteauvo;(0s2toim3ou1op emnetltf Dtm(rp;o0tlxn i3tasla2ul(mo (4texnmr3tydoat li s;()t2uo(mpno1optnmfcta( s2taum ou4opeo feiat s ra(vs;(0tlerxf3todfaDelies;t)texriopny1lleemivilt) 2ra(m ;u1aptomi3ildfa2rln s;t4artrir iotoa e iei;s0trurxrpoy4opt mnvtls  Duaur ot0alxomfcilslm eanmsnu0tlerir to1lmDeanvs t  rtmir3nydomtelfcs tf 2ua( pot0teeniictydfmDelnmsnu0aeenmr oatfpDe n s ( srtrxm3ny4lpt miciasfs2rrxrp;o0apxnmf3tas aDulnvonu0texnxr3oodopDr ues s) rxmxm3ny4lmeemies t srtax poo1ope iictltlm2eauvsnt4 lerio3ty1optr nvs;s tetoir3nu1ale lfesa( a2ua(r no1tetoifctatfmDemumo;t0aexnxr3to1fat  neo;( trto(r3iy4ol   fcsl(fsDtaxrooo4alxn feilsfs2ulumonu)trxoxoctatlptelivs;()trtmxrpny4am   nvi tf Dumu  oo4tpxo oeiad m rau o () lxnxr3oadlpD livo s) 2xrxrpno1llt  ict (fa2ra(mp;u4oeen o3iytfa2umn onu0trxrxo3oa1oaDr ieo;t sruoxo3oudlpt  icsls)s2ur(ro;o1opx mictysfs2rmuvp;t) ltrxo3oytom eln ols)t2xrxo oudomenmieils)arur(m oo4tleoifeilslmDuauvs t0 leoxfcoy1fpDe ues;s) rxr(opnodomenlfet t)srurxm oo4oeeo fctyd aDrluvsnu4artomo3iadfpDe n s s)sexmir iy4lmt lneils)s2urx ono0tet  i3ildfmDum( s t4teerxo oa1om rlu olt srxoiopnudol nlivs ( srrrxmp;t0aet miciatfm rm(vo;()tlenmo3iotla   uvs t0 rum(opnodope livslsfsDuauront0apeoio3ildfm em(vsnt) ltoio oytfpD auei t0 2xrxo io1lp   nct ()aDuru pnt1oex  ocilsls2elnms u4 lxnxf3io1opDe u i;t)s2trxr3nydlme lnetls  Dum(moot1oexnmi3iat a2emu snu4aexomrcto1op  lieo;s)t2trimpiy1altnlici ( a2ra(mo;u0aleo ieiydfsDeanvsn()arxnxf iotfpt lu ol(0 exmiopoo1ale lictl(  Drr(m ;o0apt mociyt a em(vo;()trtnmf oydlmDrlnvils) 2uoxo nu4oleelnvsls s2ta( o;t4apxnmoctadfm2rmnvp;(4alxnir iy1la elivs;s srtmiopiy1lpen iet sfarrm( ont4open fciadfm2umuvo (0arermr iotlpD  ivo t t2urirpoudol   fesat) Dumx pou4tee mf3ild s uauvp;() exrmf iotopD ln slt)s2ur(mpio1lp  mivsas)s2rm(roou4aexn feiyd s2um(ms () rxnmfctadlaDeai ol(  etmxmpoy1opt mfet ( arra(m nt1texo oeias sDua( p;(0 rtrxrciadfpDeau o;()sexmiopoodapeelics ( srrruronu0oexomfeiasla2rm(mp (4arxrxr oy1lm rlu slt)s2urxr oodaleemfeilt artaumo;o4oltnifcild a2uau o u)alxoxo iytfp eluvslt0srurio3iu1lmeelfctas)sDuaum oo1tlxoifctat m rauvo t4artnmrctadoa   ies;s  rur(mpny1omtnlfvtat)aDrrx  no1ope mfeiydlmDemnmo;u) exrifctodfmt lnes;( srtm(mpnodlm elivslt  rrmum ;t0tlxomociydlaDelu s;u0teenir oytlat liei (0t2tm(m no1am  mfvtls aDraur oo0tpxnmi3iys mDrlu ont0 rtrmociotopt livo;s0s2tr(r3iy1lp nmfeiltfarrmu pnt1tle moetaslm eau s t0 exrxoctodoa e n s t)teum(rpiodaltnmnetl(fa2uru pnt4aee  f3ildfm eanmp;(4altoif3iadfa ranvs;t0t2xoim3iu1lle  ncilt)srur(r ot0oex  fciltlaDelu onu4tltoxfctytfm   u i;(0 eumir iy4open nvtas  rrm(mp;t0texnif3iyd m2uauvp;(4tetoxf3ia1opD luvs (0t2xoxo nodlpee ncslsfs2uaxmpno1aex ioetltla ua(vpnt0aetrmf oytoaDe ivsls t2to(o ny1aptn ietlt aDtru pno0tltniieiasla2emums;u4alenmo3iodom r ivo t setr(rpnu4llen netltfaDua( pno0tpenmo3tadfaDuaumonu0aexomrciadomDe nvs;( trto(rpnydll   ieta()sDumxm ;t1aeeo oeiad aDel(vp () rxoiocoadfpt  neo ( trtrxmpnodlleemiei tf Drm(moot1oexo i3ias s2ul(mp;()alxoxf3ty1lp  livs;t t2toimpiy1lm   fvtlt)aDtrurpot1opxnmoctyslm umnmo u4 lxoif tadfp rai o () 2xmxo io4amtnmivsltf Dra(m oo0tpxo o3iyd m2umu pnt)altrxo3tydopt li ilt0 2toim ou1opt  fcs s) 2rauronu4oex mfeils aDran o (4 rtomo iydfm  aivs;t0teur(r no1oltn ivia()a2rax  no0tetomi3tltfa2ua(vs t4alxomf iadopteanes;t trurxmpiy4lp nmfcsat) 2rrumo;o1oeeniieiydfs umuvs (0 lermo oadlpte nvil( srxmxr3ny4llte nciasfa2ua(rp;o1oexomf3iltla2rmuvs ()tlxrxocoydom  luvi t t2trxopou1aptelfvt (f Dumx o;t0tetoifetydlm ulu snt) rxoxf3iy1opteanvols  euo(r nudlp nlivsa(fs2rmxmpot1tpenmociytls ea(msn()tltoxfctytfmDelivi t)srtrxrpiu4alt  feil() Duaur ;o0tpe  octlsfs umnvs;u4 lermo3todfpte uvi (  exo(rpou4lle mnct t)aDrr(moot0texniicildfaDranvs u4 ltnmo iotoa rlieo;s0 2umxo3oo4ol nmnet (farraxrpno1openmiciysfmDumuvsnt)teenmo to1lm e ies t) 2urxm oodap elivi t)a2rmurpnt4texn i3iysfa2em(vs;t4altomr3oatfmDe uvsls)t2urio3iu4olenlnct s)s2uaxmoot4tlxn feils a2ul(von(0 eermocia1fm   nvs t  2xr(m3io1lltn nvtl(fsrumxrpou1texoio3tatfm ulumo u4artoxr iadlmD livi t)t2umxo oy4om  mies s s2rmxro;t0olt if3iyslm2eanmsn(0 rxriocoydla e ivo;s t2xoxo oydamtn ictl()arua(mooo0tee  ociyt sDrm(mo;()trxomr iodopDeluvi s)trurimpiu1lpe lictls) Dtr(m ou1tetomictydfs ea(mp;t0trtnxocto1opDelneo;( seuoxr iydlle lnctl(f rrm(m nu4alx  oeiysla2ra(ms u0 exomf tydom  aueilt)trtm(rpiu1op e net ( s2uau p;u1aex  ociatla2rm(ms (4 exnmr3tatlptr u i;s)sexr(mpoo4lp nlfesa( a2rr(rp;u4aexoif3tld a2ul( pnt4 exnxocio1fpt aivo s0t2xoxr3ou1llt mfci s  rtax ont0alxomi3iltla elu s t4arenmocoo1faD lnvslt0tetrim3oo4alenmictas) 2tr(mo;t4olxoiiciadls2rm(ms t4 exrmoctodla  aueo s0 etoio3ou1am e fesasf 2rmumoot0alxomi3iatlm2el(mp t) lxoxfcoodfm ranvols  etmimpnu1ll   fvtat arurx onu0tpxo i3ils a ua(vp;u0 lxrmr oodoptr n ol()tetrxr3ou4amtemiei t)s2taxrp;o4opx  iciadfmDrl(vpnu)arxrxociy1lpD  neo;t0 rxoxo iy1omenmnct t)aDtrur ;u4aeenmfetasfa elu p u4alxrifciotlaDrau ols  rtrirpio4am nlneta()aDumxr ;t0tpenifeiadls ua(mp t4treomr3iodfm e i i t0s2xrio oydolee nvs t) 2tax pnu0aexo octatlmDrln p;()aetnxocta1oa r n i;(0t2umxmpiu1lltemnes s s2tmxroou4apenifctytls eln p t0 eeoif oatfptr nvilt seum(o ou4omtnmncilt)srtaxroou0tet iociytlaDrm(ms t4alerir3oa1fa eaivs;t0 etmim3oy4ll nmivs t  rtr(ro;o1altomfetys mDrl(ms u4tlxrifciotfmteauei;()trumxr3iu1apen nvs t)sDrmum oo4ale  fciat a2raums t0trtnif oatlat aneo;(  2xm(r nodapteliesl()srrr(m oo4tpt ii3tad a eluvp t4alxrmrcoatoat lnvol( s2xmxopno1al nlnesat  Dtrxm no0altnii3ildlsDemn pnu0aetomo3iodlmteaivilt teumio nu1oltemneia() 2ur( oou0alxn fetatlm2ua(msnt4tlenxo iodoptraieilt t2ur(r3ny4lmenlfeias sDumu p;u1apx  f3tlslaDem(mp (0tetoxo oadoptrlnes;s tetrirpio4omtelnesltf Dtax o;t1olx  f3iat m2rau pnu)teermr3oy1fpDr nei s setmxmpou1llt mfcilsfsrtaxmpou4oeto fcildlm emn s t4tltomr tadoa  anvi s) eur(rpoo4aleelnviatfs2uaum nt4opt miciydlaDuanms u4 renmr to1fa r i s;s)s2uo(rpiodam emnviatfsrtru o;o0oetomfciaslsDelnmp t0 eerxrciatoptr iesls)t2toxrpio4am e icilsfartmx pou4teen oeiadfa rmuvs t0alxnmocoy1omt aueils0sexo(m oy4al nlnei tfs2rmum nu4optoif3tldls rm(vs ()teeomo3oy1latelnvi;s0seto(o nu4ap nlfctlt) rum(rpno0aet  fcilt s2rluvs;u0 eerxociytom eaueils  rxmxm nudlptemncsa( arrrump;u1opeoio3ildlm elnms;t)trtrxr oatla e ieo;( sruo(r ny1opt livtas  rumx  ;u0oet  o3iasfs umn snt)tlxnmr tytlm ran i s) rtrxr no1opeemnciltfs2rrur nt0tptnmfctysls2elnvs t)texrmr3iatlmt an s s)trtrxmpou1al n fvs ( srtmx oot0oexoifctydfs2uan s;t0alxoif3totomteauei;s trtrxr3iudop e ieta( a2tmxr nu0altn fciatlmDrmu s (0 lxrir oytopD  neo t0 exrimpiydlmen ict t)s2trurooo1teenmicilt a rau p;u4trxnio todlpD ai i;(0 etmxr oudame mfei s a2rmu ono0tex  oeiat a ua(mo;t) lenmf3iatlaDrlivo;s)srtr(r iodam nlfcs ( a2rrxm ;t0ape  o3tadfm2rm( s;u4 renxf iotoateai il() etrim nudoleelics t) rumxmo;u4tlxo icild sDem(mpn(0artnirciy1faD li s;t) rxoxmpnodaleemfeia()s2tmxro;o0ope mieilslsDuluvp;(4alerif oo1omteau i t  etoxm nodap e ici t)aDumxmonu0tee  feils s ulnvp (0tlxoxf3iatopDrai s;t)trxo(m3oy4olt lnctltf rrmxrp;t1olxnifcild m rl( o;t0 exnir3iy1lmteli i;( s2xm(r iudomtnmietas)a2tmum ot1olen fciatls emu p u4arxomf ta1lpDelneils0texrxm oo4al n ncia(fa2rr(roou4opeo feils sDrl(vonu4trtoif3oadfa rli sl()texmxo3iy1ol  lncil() rumx  ot0opeo fcildfsDra( pnu0 lxnxr oodlmD  u s;t0sexmiopiu1aleelnetas  Drm(ro;u1olto o3iat m2ra(vs;t0treoxr iydlatelu o t) rum(m ou4ol nmnvt ()arua(m ;u1aex  f3ils a2elumo (0artnmrciatoa rau s t0t2ur(opoydopte neil(  Drmx oot0olen i3tadfs2rm(mp u) ltnmrciatoatr i il()sexoimpoo1aptelivt s s2uru  nu1olxnio3iydfm em( pnu4 lxnxrciy1lpD livs;() etmxo3ou1apenmfci ()aDrmurono1tltomociyslm2ranms () etnir totlpDeaues (0s2urxr3nu4lm  lictls) rurumoou4aeeoii3iytfm2rmnms;t)treoxo iodlp  auvils) 2urir3nodaptnmfcsltfa2rr(mpoo1olxo ietadlsDeluvont4tltoxr oydoa elu o t0 rxmio io1lmt lnetl( srta(rono4aetomf3iydfmDrluvonu0tlxnxr tytlp  lnvs () 2uoxm3nodape lict t  2tm(rp;u1apx  fcild s umumsnu4trermo3ootoatrlues;t) 2uoxo nudll nlnci ( a2umumpnu1opt  iciat mDumnms () rxrxfcoodla e u o t0tetoxrpoy4am n feiat  2tmu p;t1tpt moeiydfs eau o;t4tlxrio totlmteli o;(0 etrirpno1opeelict s)sDtmum no1oet mi3iatfsDrl(vo;()tltnxo ia1op e u i t  exmimpoudlpe mfes sfartmxr nt1tlx  iciat mDea( p;t0 eeomf oatfaDeau o;()s2urxrpou4llenlnciat artr(  ;t4apxnmo3tyslmDrmu ont0 rermrciadfpteaivi;t0s2xm(opio1om elicil() rrrx  ou4oexoio3tyt s2ul(mo u4 eenmr3todfmtr nei;()t2tm(r iu4am n icsa(  2rmumpou1alxnmociydfaDulnvo ()altnmrcoa1oa r i olt)trtrir3iodlltemivils  Draumpno1tptnifcilsfm2raums;(4 lermo tadoaDr n ilt sexo(r no1lm  mietas arrmuro;o1oetomictlt s2raums;(4aetnxociodfm eanvo (0 rur(opnudalt lncs ()s2truro;t4tlxomiciydfm2rm( pnu) rxrmf iatlpDeaneol(0t2tmxr nydal  mfvt sfa2rm(mo;o1teeomfciasfsDua(mp;t4aeeoxf iotlpteluvils)trtoio3io1omt lnet sf 2tmum ;t1tlx  ieiytfs2eauvs u0areoxf3oo1oa ean i s) etoim3nudomenmfvt s)srrax pno1tptniictltfmDeln pnt)alxnxo3ia1lptean o;t0t2xrxrpnu4ol nlfvil(faDraxmp;o4olxo ieiltfm emnmsnt4 ltoif3ta1opteluvi s t2xoxopoudlp nlfei ( a2um(mp;t4ope  fetltfa ulu s t0 lerif3ta1lm eaivs;(0 rumir oo4ll   fci t)s2uaurpnt0opxn icils a uluvsnu)tetnmo3iytfatr i i;( sruoxo ou1al   nes sfsrtaxmo;t1optoifetys sDua(vo;(4teerxf3iytfm rai i ()trtm(rpoo4am  licsl( s2tmxr nu1alx ifctyd m rmuvp u0trtnir3oodfmteaneslt texmxm iudom n neiasf Dur( p;o1olxnmociyd m emuvpnu4trxoifciy1lm eau sl(  2tmxr nu4ol emfcias aDua(  ;t0tet iiciyslaDranmo u)texnmr ootlaDr nvi t0t2xmxr3no4llenlnes sf ruax pou0tex moeils m2rmuvpn(4 eenxf3tydopt aneilt0 etoxmpou4optelfctas)artr(  nu1oleniociad sDemnvp;() eeoir ta1fptrlnesls0texr(m3oy4op nlnviat sDua(m ou0aptnmoetasla ulu p;u4 rxrifctotfmt  u o;t) rxr(opiu1amen fvs s) 2rmxr oo1apxnmo3tltls um(mp;(0 leoxf oa1lmt aivilt0 eur(r3io4ap e ieilt aDtmum oo1aeenioetyslaDeln s;(4arermo ia1fp  lnei;t0t2to(mpny1ol e fetasfsDuaxm nt1tex mo3iaslm2ul(mp;t)altoio io1opte nes;( sexrxr iu1al e iesls srumum no0oetomfetydfa2elnvs t4texnmf3totfp eau ols  ruoxopnu4omte fcsls) rum(r nt1aetn ictld m2eauvo;(0areoif ia1oaDelueo ( s2xm(mpny4ole  neilt aDrr( oot1oet ifeiasfa ean pn(4teeoxfcto1lptr n o;t)t2xrirpnu4ope mfcsat  Dra(  ou0tpen fetydfs2ua(ms;u0tetrxrctodfaDrlu i;t)t2xoiopnu1apt lnvil(farrau ont1aetomo3tadla2uaums;(4teerxf tadoat lueo t0 rxmirpoodlmeemnvils) Durum ;o1aeen o3iadfsDumump (4 renxf totfat luvilt  rtoir nudaltemfvsas  rtm(  ou0alt mictat a emnmp t4texrir tadfm rlivi ()teurxopno4alte fcils) 2umumoou1apxnmieiyd s2rl( o ()aleomrcoo1lmDr ueo;()srxoxr iudomtelnvtls) 2uaum ou0tlto i3iltlm2elnvo;(4texnio3ootlpDeaieo;(  2tmir3ny4olee ncsltfsrurxroou4oltn i3ilsfm em( s (0artrmo3oa1fm   u i s sexrio nudalt  iei t)a2ta(root0oexniietadfs2ranmonu0arxrxf tytlaDe nvs;t) exrio3oo1lleemivtlt a2tmumpou0teeo o3ild m2rmu s;u)alxoxoctytlpt aies s)s2trxo3nu1ll n ivta(f 2urxmp;u1tpeoioetldfa2rlumonu) lxrmfcoy1lp rlnvs s  eur(o iu1apenlfvtlt)s2trurpoo1ale  ietat a um(vp t4 lenio iadfp ean s s s2ur(m3nudape mnvs ()sDrrxm nu0tltoioctad s2rluvsn(0aexrmf oodop rluvsl()trxrir3iy1amt lictls  Dtmurpou1aetn ieiatla el( onu)tltrxr3ootfpteaueilt) exrxr no4lp emncs t)s2rr(  ot4aleoifciys sDul(ms (0 etrxf todopDe neils) etm(m3iy4apenmfvt tfsrra( poo0opt  ociadlsDumnvo;t4artrmf tytom  ln s;t0srtrim ny1ap nmneslt)s2uauro;u1apxomf3iat s2uln p u4trxrircty1omDeai il(0setm(m oudomee ietas  Dtaur ou4tpt  o3ilt a emnmsnu) lenmf3oa1faDrai s;(  eum(o3ou1lm n nesls srra( pot4aexoii3ilt a2rm(vo;u0areoir ta1omDrlneol(  2xmir3iodap  mfvs t a2rmur ;u1aexoifctlsfsDuanvpn(0 eeriociotfmtelieilt s2to(r nudop n neta()sruaxmpno4tlen oeiltfm2emuvo;t0 etrxf3iotoat li o;s)trumiopoo1omtnmiet ()arraxm ;o1open oeilt a uanvo (4 eerxrcia1omte ueilt  2toxr3nudale mnesas  2rrurpot1optoifeiltlm eauvpnt0 lxrxr3iydla eli o;(  exoxopio1ll  lnvilsf rrmur nu0teenif3tyd s2uanmp u)aetoifciytlp   uesls s2umxmpou1oleemietas)a2rrx p;t0oetomi3ildls ul(mont0 rtrir to1omtraneslt  ruo(r oodapt  fvs s aDrr(m nu1opxoif3iydfmDrl(mont0texrmf iy1lp rlnei (  2tmiopnu1am  lfvia( srua(mont1apx mi3tytfs2ra(von(0alxoxr3oy1omteluvsls t2tr(mpoo1am nmnetas  2taxmooo1aeenmfciyslaDuauvpn(4 leoiocta1lat  neo;s0 etr(rpoydlmtemfetatf Dum(rpnt4olxomietasfm um(msnt4 rxnmr ta1op r ieol( trtoir3io1llenlnet s a2raxmpno1tpeoioetltfm ea(mp u0altoxrcoa1oatrai ols)t2urxr3iy1alen fvsa(farur( o;t0apeoiiciyt m raums u)aetrmocootlpDr uvi s) rurim ny1ole mnci tf Dtm( oou1tle mociat m ulumpn(0arenmrcoa1la  aieo;s srur(r3oodoptnlnvilsf 2ua( p;t4aetnmoeils sDra(vpnt4 eenmf oytfaD  nei t s2to(opnodop   nvs tfsrumu  ot0opto fctadls ul(vonu)arerircoydlatr ieol(0s2xoxo3ou1omte fcilt s2tmxront1openiieiasfs rmnvo;u4treoir tadopDeaieil()tetmxm3iudllee ictltfsrrau pot0ale mfctys s emnmo;(4areoxrcto1fpD anei t0 eto(o iu1op elfvt ()s2rr(  nt0tltnio3ild aDul(vs;(0trtoxo3todlaDelnvslt)trtrxo3io1olt  net sf 2uax poo1oeenmf3iasfa uanms () ltnxf ia1lmtr u sls s2xo(m3oy4ap   nci tfsDtrxro;t1olxo fciytfmDrm( s;(4tetnio3oydfaDeai ilt0sexr(opio1op  mnvi sfa2raxrpoo4ope ii3ild mDran p (0alenmo3oa1opDrlivo;() 2tr(m3oo4lmt mfvslt  2raur oo0optnmocilt aDeau o;() lxnxo totlpDelieo;()s2toxo3iodap nlicsltfa2uaxrono1opeoiieiyslm2rlu pnt0 lxoif3oo1lpDrlivi;s t2tr(o3oo4ole mfctl()s2tmx ooo4olt iieiydfm2rl(mp;(4 etnmrctydop rlivslt0sexm(o nodam eliesat)s2tmumonu4optomfctat aDelnmont)aexrxf iytfpt  ieo;t tetmir3oydll nliei t) Drax pnu1opeoiieildfaDul(mon(0altnmo iotfm elnes;s0t2xo(mpio1alenmfetat)srra( ont4olx  oeiaslm2el(vont0arxoxrcootfmD aues;( t2tr(m no4omtemfesls  2urxm nu0apeoifciadfm ul(vs () lxrmr3oy1lmDrlu olt0t2uoxm3oo1lltnmncsls s2taxmoot1tpenmi3iadfa um(mp;u0aexnio3oy1fpt ln s;( t2toirpnodoptn fvs sfaDrrurpnu0oee ii3tat s2umnvs;t0aexnir tytfpt au s ()seuoir oy4alenmfvsat)aDrru oot4aetn iciytfaDranmonu0aexoxr3oa1lm  aues;t srurir3oy4omee fei t  rururo;o1tpt mfeils m2um(mo t0tetomo3io1oa   ies s)seuoio nu1olenlfvi t)sruaxm ;o0tptomoctld s elnvs t4tleriociatfp eaues;(0t2tmim3oudlle lnetlsfsrtr(ro;u1ale io3iasfsDumums t)aetoifciatfa e nvs;t t2trim oy4omen icslsf 2trur ou1tpenif3ilt a ra(vsnu0 rxrio3ootoaD  ieol(0 2xo(m3nudlpeemfvs sfaDtmxm ot4optnmf3iatlaDumn o t4 lenxr oo1fp eaueolt0srtmirpoy1lp  mnvslt)sDta( pot0oeeo fcild m elums u)trenxo oadlmDeluvi (0t2xo(m3oo1openmicta()arraumonu1oeeo fctytfa2rmuvs u0altrxo3iotfptran sls0t2umim3nu1op nmfet () Dtr(m ;o0aet  i3ilt mDemn s;u0tleoxr todopDraies s)sexrxmpiodol  mnvtls aDtmurpnu4ole mfciydfm2em(ms;t) lenxf iydfp eaneolt0 etmir3oy4amtnmfcta()a2rru ont4apt iictyd m2ulnvsnt4aexnifcoytfa  aiei;s0texoir3iodopt  fvia() rtr( oot1apx mieiys a2ulu ont4alxrio iytfaDe ueols0srxmir3io4al nmnei (fsrrru ooo4altnmieiatfm rm( s;()arxnio3iy1oaDrlnvol(  rxo(m iodll  mivsat)arraxront4tlxoiietasls2ul(mo t4aetoir totlp ranes t)srtoxr iy1alenlivt (farrrxroot0tltoioeildfa2ua( snu0 eeoif iytfpDe u o;s0t2uoxopou4lm e ics sf Drrum nu4apeoiieilt m umums;t)aetniocia1lat  n olt  etoim oy4am nlieta(  rraur oo1tpxnioetltfm2rmu o;u0treomr3iytfateanesls)srxmio3iu4lp nlivilt) Draur ;t1ope ii3iat m ulnvp;u0aeermrctotfateli s;()seum(mpou4lm nmictlt)a2rm(m nu1tleoio3tatla2emnvo;t4aeenxr3to1latrlu ol(0 rur(m ou4ale lieil( aDtmxrpnu4tpeniocils aDuluvp (0 leomo3iytlptr neolt) 2umxrpiydalt lnei t srtmxmooo4aleoii3iltfs ea( s;t0 lerxrcoydfmDr nvs s0 rxr(opio1lpt mfetltf 2tmxmo;o0tpeoiieild m2eln s (4aeenmoctotfptrli i ( truoxr3ny1lle  ncia() 2tm(r no0tptoifcils a2ean p;u0alxrir iodfptr nvslt)srtm(o oy1om   ics t  Dtm(  ;t4ope  ociyd s el(vpn(0 lxomf3ia1lptrlueils)srxmxr3ny4lmtnmnesasfsrtr(mpot4tlt ifetydfa2ean o u)arxriocia1lp  lnvolt  etm(m no4om emfvia()s2rru pno4tetnmi3tltlm2eauvs u) etnmo tadfa  aies t)texm(opio4ll emnvilt  Drr( o;t0tlt ifcilsfsDuanms;u) ltoxf3tytfmteaneilt0 2xrimpiy4ll  lfvt s srumumoou0oeeomieiatfs em( pnt0 etoio iodomtelnes ()trxo(m oodlme licsl( srrmu poo4altnio3iadlmDeluvp;t0aeeomo3ta1om rai ols0srxmxrpnu1apeemici t)s2uax p;o1apt  fcild a ea(vo t0 exnif3ta1lmDeaneo;s0trtoirpny4alenmics ()a2umumooo0olxn iciadls ranvo;t4 leomo3ia1lp rauei (0 2xo(o3io1omte ivtat)a2rmx p;t4oltomfctytfa2ul(mp t0 etoio iydfm   ivsl( trtrxo oudlmenlnvt ()s2umu pou4apxo oetasfm2eln o (0 lerxo tydlaDr u ils tetmimpiodop nlfetat)sDtrurp;o4tleomi3iltfaDuluvs u4alxomociotfaDr neols0 rurxo3iu1ame lfes ( srtax ooo0opeo o3tydlmDelnvsnt)teenif3oa1fpDeaneo;t seuo(mpno4lmenlnciat srurxmoot4tleo oeiaslaDul(mpnt)tetoxf todlateln s;( setoim3iydapteliesa() rumxmp;u1openif3iytfa2eaumpn(4 rtrif3totomt aueils0 rtr(o oo1ape mict t)sDrax o;u0ole mo3iytfa2eln s;t4trxriociy1fatr uvils) exr(m iy4op e feil() 2umxm ot1tpto o3iadfs eluvpn(0 rtnif oydlm rluvslt sexm(m3nudolee iviasfs2rmumoou1tlt  oeiltfm2ua(vp t0tetrmr oadlp e ivs ()trum(m3oodap e fvils) 2tr(m ou0olx ii3ias a2um( s (4arerxf3iadoaDe i i;t  exmxopno1lm emieia( a2ta(mpou0olx moeiasfaDul(msnu)aleoir3io1op r i s s sruoio oy4lmtemneiat  rrr(rpou0aetoii3ilsls ul( s t4teenmfcoa1om e i s;( teuo(rpio4al  lictl()arururono0tlenifciyd m rl( s;t4alxoxo oy1lmtran s ( trtoimpio1ap  mnvtls s2ra(mpot4aexn icilsfs rlnmo;u0aetnir3oodlptelieols seuo(m iydam eliesatfaDtaur ot4oetn f3iytlm2emnvs u)artnmo oydlmtr i s;t t2tmir3iy4optnmneta()arurur ;t4apeo ietysfs2uluvsnt0 leoio3iytfaDelu ol()t2urimpoodlpe  feilt aDta(ront0oleomictls s2ea( p;u4 lenif3todlmDrluvs t t2xo(mpoo1ale lfeiat)s2rrx pot1tptomi3tydfm2uaumo;t4 reomf oadlmD auvs;()trurim oo4oleelivi t a2raxroot0ope iictldlm uluvpnu0 rtomo oy1faDranvi;t)t2tmxr3iodal   fvi (  2rrx p;t1aex mo3tls s eaumo;() ltoxr tytomD aues;(0trxoir3iy1op nmieias  Duaurooo0olt iieild s umnmpn(0tlenmociydlmD aivo;t)sexmxmpoy4altemfvsas)arta( p;o4tlenmiciytfmDemnvpnu0aexnxf3iotlmtr neo s)trto(rpio4ole mfes (fa2rmxmp;o0apx  o3iyt s emn s (0 eeomf oytfp e ueo ()seur(o3iy4aleemfcsls) Dtruroot4opx ioetlslsDumn p (4 rxrxo3io1oa  ai o;s)s2xo(mpio4ll e ictl(f Dra(rooo0apeniocias mDrm( o ()tetnir oodoa  ln i;s0tetm(mpnu1ap nlfes t s2urxmpnu4ole mocildls ulnvs;()aetrxociytopD  nvs;s) rtmim nu4lmt  iesl(f Dra(  nt0olx mf3iltfa uauvo;u4tltnxf oodomDrliesl( seurio nydolenmfesat aDtrxrp;u4tpeoif3ildfm el( snu0trxnmfciytfaD  n s;(0 eumxopoudlpee fcia(f Durxmp;t0alt  feiyt aDrm(mp t4tlerio iadom eaneilt)sexmxopnu1amtemnvsasfs2ur(r no0oltoio3iydfs2el( ont4trtoiociytlp r u s;t  rto(o3no1lp nlncsls arumxmpoo0oee moctadls elnms u4 leomf iadlatrln o;( sexrxm3oudopt miesasf 2rm( pnu0ale ifeilsfm eluvs;u0 rxoxo3iotlmDeliei;t teuoim oy1am   nes ()s2trumont0alt mfctytlaDul(vp (0alxomo oy1la e i o;t0 euoim oy1ol elnvt t a2umxr no1tpt  o3iys s el( snu4 rxomo3ty1fpDe nvi;t) exrio oo4ll e ieia(f Dum(mp;o0tpxn o3iyslm2ranvs (0tltnmfcto1oa  aueo ()t2to(mpnu1lleemieia( sDurur nu4optnmf3iyd a rl(vs;t0 lerircia1fmD  uei s0 exm(o iy1amt  icslsfaDraumonu4texomocils sDean s;u4 rxoxo3tydlaD  n ols  exrir3oy4lm emncs tfs2rmum nt1opxnifeiydfm ean o t4trxrmrcta1oa  luvo (0srurxrpoodomen ictls a2ua(mp;o0oltnmicild sDul( p t)texrmf3totlmDean ilt)trtmir3iu4op n fet t) 2rmu  nt1olx iietld s2uluvonu4 lxnxr3oytfmt  n il( t2xoio ny1ap   neiasf rrm(mpnt4aeeo fctas sDra(vs;u)arenif tatfa r iei s0seum(m ou1lm emfet ()sDra(mpou4aexnmieiadfsDul(vo;t) etoifcty1fm  liei;s texoxmpio4lltnmfviasfarrrxmont4aptnmocilsfa2umn p;u4 eerif iodfaDrln o ( setoir oydal e ietasfaDrrxronu4ale io3tat s2ulnvsnu4 etnxo tydlaDe nes ( trxo(r3oo4ll emfctlt s2trxr nu1ape  fctasfsDeauvs u)aeeomf ty1lm r iei ()s2xmxopou1amtn fci s  2ur(mpnt4opt if3iytfa2ra( snt4 lermr3tadfat an i;( sexmimpiodamenmieils  2umx  ou4aet  fcils s2rlump u)texoxf3iydop rlnvo;( t2trir3oy4lm emfvi s  rtrur oo4oleniietytla2rl(vo (4aetnmo3ty1fa eaivilt0trxoir3ou1am nmictlt)s2rm(  no0olenioeiasfaDumumont4artrmr iatfp   u i t  rto(o3nydom   ncsas aDrmx  ot0altoio3iltla2elnvsn(4 leoxfctydfaDeauesls)t2uoim3no4omtnlfesas a2rrx pnu4tpt  f3tlt s2rm( pnu4aeenxoctatoaD au olt)teurxm3ny1ame  fci ()s2umur ;t0tleo ictas a2elnvs;t0altrifctotoaDr u i;s tetm(mpno4omtelnvsa()a2rmx oou1tlt mfeiadla elnvo;()texnmf3oytop  luvil(0teumio oo1omenmici tf 2rrum ;o1alxnioeiyslmDuan pnt4trxoir oodfa  liei () 2trim3ny4apen fct sfaDumx pnt1tlxn o3tldfa2elums;u0 ltrirciodoaDelues;( srxmxo iodalenlicil( s2ur(monu4ape mfetatls uauvsnt4 lxoxo iatfptrli sls0 2xoir3nudam  lneilt)sDuauroot1aeenmf3iadlsDean p;u4 reoio iytfmDelneo;t)srtmxr3oy1lle lfeta() 2ra(  ;o1opxnmfeiysfaDul( s;()alxrxr3iy1fm raivo;t t2xoimpoy1lm emfeiat)s2rrumpot4optnio3iyd s2emnvpnt4trtomf3totlm elivo;t0s2um(m ny1ope lnviatf Dra(  ;u0tlxnio3tltfs umums;u0teeomo3iotlat lueo t s2xmxm io4omtemivt ( srrax oou4apt  oeilt m ean pnt) exnif3tadla eli s;t tetoim oy4apt micsas  Dtrump;t1alt mfetadfaDrmnmp;()tetnio3ootfm r ies;( srtmio iodoptn fvils aDuauro;t1alx ioeildfaDrlu pnu4 eenxo oatfptr ieo;t0tetoxrpnu4ol e iesasf Dtru p;t1oeeomf3tasfs ra(vo u0 eeoio iodomteanvsls setoir iydope licil(farrmur ;u1apxo ictlt a2eaumo u0 rerircootopD lies;() 2trio oo4ap nmfcslt)arrmxr nu1olxomictls aDumnvp u4aleomr ta1lpDe uei (0srxoxmpiydlpee nctls)sDtmxm no0aptniocild a raumon() lxoxo3oa1latrlues (0srxrio3no1ameemfes ( s2rr(mpnt4opxomfeiadls2rauvsn(4texomocoadoaD an sls0s2trxm oo1ol elfes s arur( pnt4tleoii3tysfaDrl(mo;u0alxnifciotfp rlies;( t2xr(m ny1amenliei (  2ta( ooo1teeo fctysfs em(vp;t0 ltnir3iadopDraneo s) etmxmpoudomeemfetl()aDuru  ;o0tpxnmfeiytfs ulnvsnt0tlxrmfcoytfmDr ivs s0 2uo(rpiydapte nvt ( aDtr(m ot0oeto o3tlt s rmnvsnt4altnio oodlaDeaiei;s)seuo(mpnu1am n nvtls  2tru p;o0tpx mi3tytlm2rl(ms u)teeoir3oodlm elu ol(0texoxr oy4olte fesls  2rmur ;o1oee mo3iadla uanvp u4tltomf iotfp  anvolt seuoxm3oo4al n fcsas  rur(mp;u4tpt micildlm2uan p;t)artnmf oa1fm eln s s)seuoir3nodolenmfvias)srumu  oo1teen i3iys a2um(mo u4arxoxrcio1fat  ueo;s0 2tmim nudalt  iviat s2tr(r ;u0tlenio3iytlm rauvs u0teeomo3ta1fpte nvs;(0 euo(o3nu1al e ivsl(  Dtmx ono0aee miciydfmDua(mo t0 exrxfciodlptrln o t) euo(mpno4lpe  ieias a2ta( o;u4oetn oeiys aDrm(vo ()tlxrio ta1op  au s;() 2umio3iy1oltemfcsa(faDuaxmont1altn i3iatlaDuan o u)tlerirctydomtr n ols seumiopnudlpen ictatfs2tr(  ;o0aet moctad a elnmsnt) exomfctatfptr uvilt0t2umxmpiy4lp emivtat  rrmum ou0tpenioeiltfa uln on()aeeoio totomD aivils0sruoim oy4ol   fcslsfsDrmu  nt4oetniieiytfs em( onu)trxnmo iotom r neo;(0s2xmxm io4amt lnetas)srra(m ot0opxo octadfa rlnmo t0tltrxfcto1latr ieslt trxmimpny1amtn iet t arrmx  oo1oltomoeiltfsDrln snu)trermf oa1oa r uvo;s teurxrpnu4amenlnctat s2trxr ;t1tpeomo3ias m elnmo;() ltoxo3oa1fa r n slt)srxmimpiu1ll e icsl()s2uax ono1opx ifctat mDua(mo;() rtnifciatomt  i i t0t2umxm oo1apee fet sf Dua(r oo1olx iociadls rlumsnt)tltoifcoo1omt au sl(0sexmirpoodap  mnct tfsDtmx  ou1tee mictltfm ulnmo;u0 rtoiociy1omtrli il( s2toio iu1ap  livsl(f ruaurooo0opx ii3ias a umn snu0trtrmo3oytoptrlivo;() eumxmpoy4amtnlfesls)s2tm(mpno0oeenifctldlm2eln pnt0altrmrctydoa  aues;(0 euoxr nu1llenlneiatf rrrxr ot4tpto o3iydfs emnvo;t)aleomocoodlmtraivi t)trxoxm oo1ol  mnei s) ruru o;u0oex mi3tyslmDrlums;t)arxrio oatfm rlnes;t0t2trxo3iu4amt licils)sDta(ro;t4olx moeiyt s uan s;(0arenxf ia1lmDrauvi;s0 rurirpoodomt mfctlt)artmx  nt1aeeniicils m rl(vs u0 lenxo todopD auvs;s texrir ny4omt  iesatfaDra(  ;t0tet mfeiydfa2um( p;t4aexoio oodlpt  n i;s)sexrimpoy4lleelfetl() Drr( onu0aexnmietyd mDean o u4alxnmfciytlatr nvo;( sruoio3nu1optelfesls  2umx  oo4oeeo ieiydla um( s ()arxrio ty1op eanvs (0 eumir oy4alee nvtltfarrr( p;o4tpt io3iytfs el(vs u0 rermo3io1fatr iei;()s2xoio oo1lm   neil()srtax pot0oexniiciaslmDrmnmpnt0 lerxrcoydfa rlivo;t trxo(r3ou4olt lfei tf 2trumo;o4oex  oetltlm ea( p;(0teeoxo ta1op rluvi t  2trxm3io4om  mfvta(f Durxmo;t4tlxo oeiltfa2rm( o;t4aetrxo3oydlaDrau i t)s2uoxrpiy1lpe  feiatfaDur( onu0olx  fctlslsDum(vs u0 etnifciotoateli s;t texriopnu1om nmnetlt) 2rrxmpnt1alen i3iysfs elnvo;() etriociadopD luvilt0teuoio3io1lltelncilt  Duaurpno0olxn ieiltls eauvp;u4aleoircoodfmD lneol()t2xmxo3ny1lle livt s s2rau ono4aptn fcias mDum(mp;(0alerir oo1lp rlivs (0trurxopnu1ame lfvt sfsDumxrpou0aleoii3ils sDem(mp u0 lxomfciadop rli o;s) 2ur(o io1lmt miviat)sDrruront4tptnmfeiadls2ul(mp u0aexnir3oadla ran sl(0 2urxopny4lle mnvt () 2rrx p;t4alxn o3iys s elums u)alxoir3tadfmtrlu o;t t2xmxr3oy1lmtn nvtat  Dtr(r nu0optnmi3iltfs2emnms u4aexomf iodlateliei s  2umxopou1lm  mnesltfs2trxmoou0apxnmf3iys m umums (4 rtnxr3ta1lm   n ol(0tetmxrpnu1lltemnvia(fa2tm(moou1aexniietytfsDeanvp (0alerxocia1fmteauvi t0sexoim no4omt lfctl(f rurxmpou1tex mf3tlsfsDul( pn(4 etoirctydlm eli s;t0s2xoio3no1ape  iesa()a2tmuro;o0aexoiictad a uau p t4aetnif3iy1fmtelieo;s setrxr3nodopte ivsasf rtrum oo4alx mf3tatla uau p;u0 etrxr oytla  auei s) etr(m oo1aleeliet ( a2rrxrono0tle  ociad mDulumsnu)artoif3iadla eln o t) rtoim nudlpt mictasf 2ua( p;u0oetn fciltfm rlnmo;t4tetrxfcto1omte iei s) 2uoim3iu4ol n iet s)aruaum ;u0opxniiciadfsDua(mp u0aeermfcoadfm rli ol(0seurxopiodomtnlicsat s2umum nt4olt mfeiytlaDean ont)aeenmr3iytoptr ues;s)truoxo3nydlme  ncslt)srraurp;t4tpx mictadfa ea( p;t4 rxoiociatom eai o t0 rur(opno4lltn fciasfsDtmum nt1oleoifciasfm um(vs;u0 etrxo ta1fmt an o s  etm(opnu1opeelfvtls aDra( p;u1aetomo3iaslsDulu onu4artrifctatlat  ues;t0 2xm(r3iy4lmtn nci (  2urxrpot4aexn ieiyt a2em(vo u0 rtrxo oo1omDr ies;s0s2urio ny4alt liet (f rurxm ;u0tet if3iasfa2eaums (0aleoxo3to1lpt lueo;t  euoxo oudllee nei ( s2uaxr ;t0aexnii3iat aDrmnmp t4altoxr iodlm rli o ()sexo(opoudopenlivtltfsrumx  no0aetn iciad m emnvp;t4 rerxo ty1optraueils)t2xmirpiodlmtelivils)s2ur(r nu1tetomoeiysfsDumnvont)tltnircoy1oaDrlnesl( t2uo(opiydll n neiatf rta(  ;t4alenii3iadlm2uaump t0 exnmo3tatop eaivs ()s2urio oo1lm e neiltf 2urxmpot0opeo ieiyd s emuvp u4 lenxfcio1lpDe uvo s)t2xrxopou4apee neilsfartmx oot0tlxomf3iltla umums;u4 rerio oodlaD lnei ( trxr(opio1lp nlietl()a2rm( p;u4olxomoeias aDuanvo;()aeeoifcootopt auvs;( s2uriopio1aptnlivsa(fsrtm(rpot1tlxo oetlsfm2um( ont)aexnxo ty1fpt  uesl(0t2toxmpnu1ome  nctas sDtau ono0tex mo3iydfs2ua(vp u4trtnmr iadfmtrlnesl( seuo(r3iudoltemivs tfartmu  ;u1alxnifciatlm2uanmp;(0 ltrmrciodlpDrlu o t0 rxrxrpoo4ameelfcil(faDua(rpot1tptnifeilslm2um(vp u0tltrmrcoatomtelnvi;(  2xmir3nydoltnmicil(fsrtmxrooo4oeen ieiltlmDuln p;t)tltnmf oytlm raiei t0srxr(mpoy4al nmnei () 2ur(roou4tpe mfeiaslsDulnvs t)tetnirctatlpt luvolt0t2xmxo3oy1ape miei s)artr(r oo1oee  o3iltlaDean p;u) renxo oydfp r u o t  euo(m no1ap nlfvil(fs2ra(mo;t1aee  iciytfmDranms u4alenio3io1lmDrln o;(0 rtoirpny4opeelfcs ()s2urxroou0tpe mi3tltla umnmp;(0 ltnmfciodlaDraneolt)srxmxm oydll n fct (fs2uaum oo0tlxoiiciat a2emu pn(4trxnio oadlatraivi;s  rumim3no1altnmfvilt)sDumumonu1opxomieiysfsDemuvonu4arenxf3tydop r ueo;(  2umio oydopenlfvt s artaumo;o1tltoif3ildfaDrmu p;u)tetnxf tadlp rlivi;s0 rxrio ou1ame  fcsl(  2urxmpno4tetnmf3iltls um(vsn(0arenxf3oo1op elueil(0sexm(r iy4lpenlict s arraur ;o1tlx ifeiaslm2rl(ms u0alxnif tytoaD auvol()trxr(opiy1olt  ivslt srumx  nu1apxoiocilslsDrm( sn() lerxf iadlatr ivi;(0truoxrpio4optnmnvia(f rta( o;t0oeenmf3tltfaDumnmsn(4aeeoir3ia1omtelivols0 2uoxmpou4optnlnvsl() Dumx  ot0optoii3iltfaDea( s;u)tltomr3tytoptelu s;s0trtrim nu1ol nlfei s)srraur no4opeoifciytlmDulu on(4 reomo3oytop  aiei t  2xm(m3oudolt  ici ()s2uru pno4opxnmi3ild sDuluvp u0tetnir3totlmt lueo;t0texrxm ou1om elfvias) 2rmum nt1tpeo f3iltls2emumo;t0 rtrxf3iydfa r nvi;s0t2tm(r3oydlpen fvs s s2rmu o;u4alxnifciys mDumnmp;t)trenircio1laDeaivi;(0s2umxm oudoptnlfvsa( a2rau o;u0aleoiocilt aDranvsnu0aexoxf3iydfpteauvi;s0t2uoiopiy1lme livi () rrrur nt4tet miciadlmDranms u0trxrio3iy1latrli slt0sexo(r3io1ap elfet t)sDtr( o;o0teeomoeiat a umnmpnu) lenmo todlpDraieslt) etrio oo4llenlfvs (  2rrumpoo0texn o3tldfs rlu s u0tlenmfciytfa r u s s) exmir3nu1llt lfcils)a2rrxrpno1oexniieildlmDel(ms (4aleomocoydom e ivs;s0trxoxo iudom emncsat artrxr nt0tpxniiciysfa2uan o (4 rtrxo ta1la r uvi t)sruoiopoodal elfei tfaDumx pnt0oex mi3iyslaDuau s;()teenmf3totoaD aivsls0srxoxm3nu1lmtelict (fsDtrx  ;t0apxnmo3iyd s2el(mo;(0aetoifcoo1lpteluvs ( s2tmxm3iu1lp elnetl(  2rr(ront0aeeniiciytls2ua(vs;u)aeenxr iytfaDeln i (0 2tr(m3oy4oleemfcilsfsrrmu p;t0opx  f3iasfs em( pn(0 rxnmr to1opt  ivo s0sexrxr3nydlptn fesa(fa2umxrpoo0oee  i3tas sDeanmp (4 rxnif iodfm   i i ()seuoxo3oudalee nei s)s2tm(mo;t0tptnmfeild aDean s (0tetoir iodoaD luvs s)setmiopoudlmenmnvta()a2raxrpno4teenii3ildls rmuvp u4altrxrcootfmt  nvs;s srxoimpoy4lptnlietl() 2um
\ No newline at end of file
@@ -0,0 +1 @@
+neo;(  2tmim3no1lltnmnet ( srtr(mpot4oee  ietasfmDraump;t)arermr3tatopDrlueil(0srxm(m3nudap emfvi (fsrraxrooo4aexoioeils a uau snt4altrmrcio1oate ueo t)t2xoxm iy4ll nmiesas)a2trx pou4aptnmfctad sDrau p t4 exrifcoy1latrlivo;t0 exoir ny4apeelics tfs2rrxroot4texnii3iltfaDeaums;u0aetomo iy1lm   ueolt0trur(mpiu4omte feils) Draumpou0texnmo3iyd a2umuvp;u)tetoiocta1oaDe n o;s0 etmxm3iu4ame miei s)s2rau oou1tlxniociytlmDeauvsnu)tlxoxfctotlmtranei;t truoxr3oy1amt mnvi (fsrrau p;t0apxoiiciltfs2rm( s;t)alermr3tadfa  li o;t teto(o3io1ameemivtlsfsDtmxrpnt0opt mi3iyd aDranvonu4 lxnxr ia1la rlueo (0truoir3oudop nlfesa(fa2ra(rpnt4alxoio3tydfsDuln s;u0 eeomf ta1lpDrlies;(0srxrxm3no1ol elnesat srururp;o4aleniieiadfa2ea(vo;(0tltrmr ootlaD livsl() 2tmio3io4amtnlnetls aDrm(rooo0teeoiiciytfaDuau pnt0 ltrmo oy1fat auei (0sexmxrpnydomee nvsltf Drr( ont1apxoifetltlmDuau o u)trxnxf tytlmt ai ilt)teuoxo nu4ll n nvtasf Duax pot1aex ii3iadfaDum(vonu0 eerif3iadfm e ieilt0 eumxo oydapte ieslt arua(roou0olxo octas m2rmnvsnu4altoircto1om  luvi;s  2uoim3iy4omtn fci t a2urum ou1oeeoiiciltlm rm(vonu)trxnif iodoat lueo;s0s2tmxm oy1ol emfeta( s2taumpot1tet  oetad sDeln o;()trtnir3tytfmt ai ilt)seurxm3no1ole lfvsa(f Dur(mo;t4alto f3iltlm2umnvo ()areomociy1oat lnvsls0 2tmir no1opeelfvsl(fa2ta(  ;o0opx iieias m2rmn onu0artrir3iy1fm r u ol( tetr(o iy1omt lict s a2uau pnu4alx mfciyt sDea( ont0areoir3tytfp elieo;() 2tm(opoydlp n neia(fa2rr(r ;u1opt ifctlslm rmnvs () lenxf iytlaD lnvo;t)srto(mpoy4llte nes ()arumu oou1tpeo ieiysfm ranmo (4aexnxo3oytlptraivslt0texmxopiudam n ivia(fa2ua(rp;u1aexn o3iydlm2elnms u)arxnmo ia1omteanvo;s t2umxr oo1al nlfesat sDurur ;t0apeoifciasls2elnvp;t) exnmf3tadfptrlneils t2xoir nydllee fvtl( sDraxrono4tpxnioeiat a2rlnvp;u) exoio3oo1fptelies;s0 eurimpnu1oltelfesat a2trur ;u0aex mociad s el(ms ()artoircio1fm  an sls0 2uoxr3io1ope lics (fs2ua( p;u1alx  ieiltlm uanmo (0tlxrmf oydfp  lies;()srto(r3iy4oleeliei tf 2taumoou0apxnmociadfs2rmn o u4 lenmr oydopt  i i;( srxm(m iodape micias)arrmu p;t4aetnifetatfaDulumsn()trenxfcoa1lm eaivs;s0trumxopoy4aptnlivi (f 2uau o;u4oeeomietld m elnmont0teenifcoodlpte ivs s0s2tr(r3iy1al  lfctatfaDtaump;u0altoiietlslaDuln sn(0alenxf oatfmDranvols sexrim nydlme mivils  Drmumpno0oex  octltlm uan snt0alxrir tydomDrai ol( trxoxo ou4llt  fct sfaDrrxmo;o1oexnifciytfm2rl(vs;(4aetnxrcoa1omD lieol(  rumio nudalenliet sfsDtaxmpnt0apxnii3tld m2emnmp t4alenmocia1oa rlu ils srtmxo3oudal e neslt srrau  nt0oetoifeiydfsDra(mpnt0arxnifcoy1lmDe nvi;(  2ur(mpou4lpeemivt s s2ua( pot0alxo fcild a2rl(vp u)treoxf ia1fmDelnvo s)trxrxo3nydapenliesa(farta( pou1optnmieiasfm emnvo t4 ltnircio1omt li i (  rum(rpno1amenmivsa() rrrxront4aetoifeiytlsDrlnmo t4areoxo ty1fm  li o s)t2um(r oo1amtnmfvtl(faDraurono0texn iciydlm2ranmp;t0trtnir3iatomt luvo;s) exm(mpio4lp n feia( artm(mono0ape  feiys aDrl(mo;t0 leoxfcoytlaD  uvo;( t2tm(rpno4ll elietat)s2taur no1opx ifeiad a2rmnvsnu0trxomr ta1oaDe ieils0s2um(o ou4lme mnviatfsrrru  no4ale ifeiyslm2ea( o ()texrir iatlmteaues s0teum(o3oo4lp  lfciatfa2urxmpou0tlx  i3ildla elnvs t0trermr3oytoa r i i;t0seuoir3oydlmte netas)a2ua(rpoo1apeomoeiytfm ulumsnu0arerxo3ia1omteln s;s0sexrir oy4om n ieilt)srrmum ou1altnii3iaslm emn s ()texoxr3tadoat aues;t)seumim oudop n nctlt a2ra(r ;t1alto icilslm uln o;t)arerxr iy1lp  lueo t)trxmxr iu4ale  fvtl(fs2rrx o;o0optnif3tydlmDea(mp;u0aetrmo iadlmtranei;( t2um(o iy4llen ivtas)aDtaurp;t4tle mfctydfm2uau s;u)trtomf iotoptrau s;t0texm(o3iu1olt  fetls)s2rr(m ;o4tpen fcilslsDumu p () rtoif3tydomDrai o;t)teuoimpny4apeelfvs tf Duauro;t0aptomoetatfa ua(vp;t0altoxr iadlaDr n ilt)seumxmpny4opt mfvt ( s2umx  ou1aee mi3iatfmDrl( o;t4aexomf todlp e uvol() rum(m3iodolenlncsat)arrm(  ;t0oexnif3iys sDum( p;u0aetnxocoadlateauvs t) rxrxo3oy1omtelicsa(fsrtaxmpno1aex  ieilt aDrmnmo t4trerif3tatfmD lueo;t t2toxm nu4omeelfcs tf rrrxmp;u4opxnmfetls a ean p;t4aexnxfcta1fmD  ivs ( teurxmpnydlm emfei ( aDra(m no4apenif3tydfs eanvsnt0aleomocoy1fmteaues;(0srxoxrpoodlmt miei ()aDuaxm nu1alt miciytfm2um(vpnu0 leoio3oydlmDe iei ()srtmiopny1olenlfvta(fa2ta(root0altoif3ilt a2rmu s t0texoxrcoydopt  uvs;s s2ur(m3nydole micsa()a2taumoou4tleniicildlm2um( o t) ltrxo tytfpD aues s)trtrim oy1lm  lnvtasf 2taxr nu1tpx  octat m el(mon(0trxrxr3oytoptraneo s)trtm(m oydap nlnvs t a2taump;o4optomfctldlsDul(msnt)trtnmo3todoatr iesl( s2uoxmpoo1open fciltfsDtax poo4alxn oeiytfa uln pnu)artnif3totoptelu i () 2um(opno1amt mnesas)s2rr(r ou0aetnmieiadfs2rlumo u0aeeoxfciydoat lneo;t  eurir iy1alt mfei (  rtaump;o4aet mieiyd sDrmumo (4texnmr io1opDelu s;(0 rtrxo iodlp nmnci s)arum(ront0optoiietasfa ea( p;(0 lxoxrciotfaDraueo;s0tetm(m iudapeelfvtatfs2rrur nu0aptomieilsfs2rmnvpn(4arxnxr oa1opD  uvs;t texoir no4optnlies s)aDraxrp;o1olenmociysfmDel(mpnu0aexnio3to1fa eaivils)trtoxm oo1aleemfvilt a2uaumoot4tpxoioeiatlsDean on() ltnmf3oodlmtranvs;s)texoir3nu4lmtnmfcsas srur(  ;o1apenmf3iydfm2ra(vs u) rermfcoo1fa  livs s trur(mpnudlm  livtl()a2taum no4apxomoeilt aDuanmo (0 lxrmr oy1fm  lneo s)texm(o oy4alenmivsls arum( p;t1tpenmfetyt aDra( p;u) rxoxoctydopt ai i () 2umirpoo1lpe lfetlt  Dtrx pnt4opxniieiys a2rl(mp u4 eermrcto1lm eaivo;t0srur(o3iu1ol nmnetat sDumxm nu0texomictltlmDuluvsn(0teenxrcia1fpt lu sl(0sexoxmpoy4ll n ncslt) rrm(moou4oex mieiyslm2um( o u)trenmo3oy1oa rliei s  etoimpnydapt mivs t aDtmu pnu4tpx if3tltfm um(vsnu)aetriociadfa r iei;(0trxoxo3no4ameelfcils) 2umu pnu1aeeniociydfm uln p;() etrifctadoaD  nvols) 2uoio3ou4omen ivilt)arta(monu0opt mieiytlmDumnmp;u0 leoxr oydlmDranvils0trxoiopiudopt lfctltf rtr(m ;t4tetomociad m2raums;t0altrmrcio1laDr ivs s t2tmxo iy1op  lfcias  Draur ot1optoioeiasfa rmumo (4trenirciodlmteanei t s2uoio3ny4op elici ()sDum(m ;t0aet iocilsfa2rlnvpnu0 etoxr totfmteau ols0setmim nodam elnvtatfaDrmu o;o0apen i3iat a rmuvsn(4 rtrmrcia1omtrlneo ( trurxopny4om nlnctat arrru o;t4apen oeilslsDemu s (0aetoxo ta1omDrau slt  exr(m3io1amtemictas srurum ou4oet ifctatlsDrl(ms (4trxrmf3ootlatelivils trumxrpnu4ap   fes s) rraxr ;o1alx ifcils m ean o (0 renxociadoaDraiei;t0 etm(o oydopenlfctatf Dtaxmonu1tpe mocildfa2ra( p t4texnxo3ta1fptean s;(0s2uo(o iu1ll n ncta( aDumx  nt4aeeoii3iys s2em( s u4treomo3oodfmDe ieo;(  2um(rpou1ll   fvi (  Dururoou1tpenioetatfa emumo;u4 ltomr3ty1lmD  uvols)texoxm nodol emivi t) 2ra(m nu1tetniictat s2ul(vsnu4 lermrciy1oate u i (0srumir3no4altelivilt aDuaum nt1oeeo oetls s2rmuvp;u4alxoir3to1fp  lues;t)texmxr3io4aptelfct tf rrmumpoo1alx io3tys aDum(vsnu4trxnirciytomD lnvs;s srtmimpnu4omtnlics t)a2ur(m no1aetoifetlt a raumpnu)aexnif ta1fm   uvol(0t2xr(mpiudllenlfvtatf ruru  nu4apxomiciatls rmu sn()arxriocoatfaDeli i (0 2xrxrpoudap  licia(fs2trx  nt0tpe  i3ildfa uau o ()areriocio1omDeauvs;()srxrxm ny1omtemivs tfaDua(r no0alen fctydlmDeanvo;t4aetnifctatfpDe nvo;s0sexoirpny1op e ivt () 2tr( ono4apx mieiaslaDel( o t) rxnmf ty1fpteaieo (0srumxr nudoltnmnvi tfa2rr(mpnu1tetoioeils a eluvpn()trerxr3todlaDeau ol() 2uo(r3oy4amenmfeta(faDtrxr nt1alx  o3ilsfm2eauvp;u)trxrir ootlate nei s srtrxmpou1am n fvilsfs2urx p;t0olxnifetas m ran on(0aexrmf tadla elnvolt s2tmxm iydopeemnvsls)sDua(mpno0alenio3iad sDea(vpnt)trxoxrcoytlpt  uvs t0seurio oydlm   icilsfsDum( oot0tetomoeiadfaDem( ont0teenxo oadlm  livi s t2tm(opnydopenlfcils)a2taum ou1opt moeilt a2um(vs t4 rxrmr3tydfaDeanvilt0 2umxm nu1al nlfctl( s2ra(r no1texomoeiytfa ra(mpnt0areoxocoytoaDelnes s s2trxrpiy4omt  fct s  Dtaump;t0tetniieiyslmDemumo (4tetnir3oatopte u s;t0 rxoxm io1opt mivs t sDumumo;t1aleo ictltla2elumsnu4artrxoctodfaDe nvi s0s2triopiy1ope  ivslt  rumx pno1oee iieiytfm um(ms t4 rxrmf3oodlptrlivo ()srtm(o no4lmtn nvia(  2taxrono4oex iieiltfsDum(vo t0altnxr3oo1fmDrluvo (0trto(rpou4aptnlfcils arur( pnt0apx if3iadfaDraump u)tltnmo iatlpDelieo;(0seurxm iydap nmiciasf 2tmu ono0oexomfeildfs umnvp;(0 ltnmr3to1fpDr i i;(  euoim3iu1lpt mivia(faDra(m no0openiiciltlaDul(vo;(4 lxoifciydomteluvs;s  rxoio3oy1lp  lfcs sfaDtaumpoo1tpto feiasfaDemumon() etrmo iodfptr neo;(0srtrio3oudal e fctl(faDraxrp;t0oet io3iys s2umnvp;u4trtnxfcia1fatelnvols)t2xmxopoo4lmtnlfvi t) 2rmuro;u0tleomieilsfmDrmnvon(4aeenxr tadomte ies t srtoxo3io4altn ivi t a2tr(rpnu1oeenmieiysfmDemump;t) lxnmf iotfat  uvi;(0trtmir no4ameelfeil(fsrtaxr nu0tpenifctyt s2el(mp t0 rxnxfctodom rlies;s)t2urxrpou1apt lies s srra(ro;o1aexn icilslaDrl(msnu) eerxf3iodfat  i i ( srxmim3iu4am e fctls arrrur ;u4tle ioetldls eau p;u4tlxoir ia1lpt luvo (0trtr(o oy4op n icsat) 2rm(ront4apen iciydls2ranms t4 ltnmfciydoa  ai s t)teto(o no4optelneia() 2rrurpou0tpx if3ild s2emn sn(4 reoxo3iy1fm eanes;(  2toirpoy4ome mnes tfa2trx  ou1apt ifcilt m ea(vsnu4areoxrcootfaDe u s;s0tetoxr3oudomeelfet s  2umu  ou1tlto ieils m2el(mp (4trxoxo iadfp   ueo (0 etoxo ny4openmnvtlt sDrau o;o1alen iciat s emuvp (0 rtomf3ia1op  ai olt  rto(opiy1apt mies s)aDtm(moot1tpenmoetas s umnvpn(4 ltoircoodfpD  n i () 2toio nydopeelncsa(fa2umur no4oex  o3ias m2uln pnu4altnmf3iytfpD aueo;s0srxr(opoo4omen fetl(  rtrump;u0alxomf3iltlm el(mo;t0arerxf oytfm elivi (0 2xrxo3oudlpeelnct tf Drmxrpou4teenmi3iyslm2elu s u0altnirciotlpt li i ()s2urio nudolt  fvs sfa2trurpou0opeoio3tldfa rmuvo t4trtnxocto1lp e uei s) 2toimpiy4opt mneiltfa2uax ono0aeenio3iytla elu s;() rtnxociadlpte nvo;t  2xm(opiudole liesatfarrm(  ;o0tpto o3iysfmDumnmp u4trermfciytoa  lnvs;( texrirpiy4llt  ictat)srua(ronu0ole ifctytfaDrlnmp;u0tlxoir3iatlmt  u o;()t2trxmpiu1lmt lncs s)arrmurpnt0aee  fctydlmDua(vp u)aeenif todlaDe neo s teumim3oodaptnlfctltf rua(mont0tptn feild s umumsnu4aexrir oa1fptrli o;s) 2to(opoodlmenmfetat) 2um(m ou1tlen fetlt m2rlump;(0aeeomfcoy1fmDr u o;s t2umxo3ou1ol e fvtasf 2rr( pnu4opeomieiad m2um(vs;()tetrxf tydomDr nesls0s2tr(opnodlme lncias a2rrxr ;o0apt mi3tat m rau p u)tlermr ta1op rai s t)texm(opny4altnmfeta( srtaxrp;t1oee mfctadfs2ea( s;t)treoircoydfaD  nvs;t0s2uo(r oudapenliesl()artau o;t4olx  o3tys s umumont)teerxociodop  au olt)t2tm(opio1amtnmivs ( sDrr(mp;o1tptnmictatfaDea(vp;(4areoir iotlp e iei t s2xm(m nydlpte nvtat  rrrxr ou4opeo f3iadla2ea( s;t4 rtrmo3oatoa  au ol() rto(r3nodapenliesl(f 2rau o;u0tpxniicilt m ua( o (0 exrxr totfm  auvo s  2tmxr iu1openmncsl( aDtm(r oo1altnif3iydla um(vp u0teenxf iadlate ivilt0 2xo(o3oudam n nci () 2ta(mp;u1tlenmi3iadlm um(ms u)altrifcoy1la rau ilt)trtoxo ny1lmeelnctlt artm(rp;t4aleo icilsfs ea( p;()tlxoxo oodla r n o ()srxm(mpoy1lp nmnvsls) 2um( oot1tlto ictadlmDemnms ()texoxr ia1fpD ln i;(0 2trxr3oodamte fvias arurxmont4aeenioetasls2ran p;t) lxriocoytopDraueo;t seto(mpiydlmt lfei t) 2uaum ;u1apxnif3tadla uan pn(0 lxnxf oatomt auei;s)t2umirpnydlp e ivta(f rrmumo;o1ole  iciysla2uau pnt4 rtomf3iy1opteaivols tetrxopiudapte ivslsf rrau  ;o0oetomfcils s rln o ()trxrxociadop eanes;s)t2tr(opoodal n ncils srumxmp;o1aetn ieiat sDua(vo;t)teenmf iydfptrlnvs t  2urio3no1lp nlnei tfs2ra(mpno4aeenmo3tysfa ulnvs;() exrif iadfmtrai o ()srurxrpiu1alenlfetlt sDur(rpou1tle io3iltfa rm(vpnt) ltnif tadoaDeaieo t)teum(r no4ll n fcs (f 2trx ont4oexo octytlmDum(vonu)alermr3iotfmD lieils)t2xrio nu1apte net t)s2taurp;u0apxnmieilt s2ua( s () ltoxo3oadla  auvi ( t2xoir3iudlp nmiet (fs2rrxmp;o0opxo fciytla rlumo;t0teenmfcootomt anei;t0s2urxm iydal   fvilsf Dta(rpoo4optoiieiyt m umn p u4aeenmr oadom eln i;t) rxm(m nodomt mnvil() rrr( onu1tetoifctyslm rm( p;u) rxoifcoytlm   ies t)s2tmxopnudllt lfcsltfartmu pno4tptnmieiyslm rl(mp;t0teermfcto1omDeaueo s)s2xmir3oodole lnciltfartmu pou4teeniictasfaDumnvs;(4tetnxr3iytlaDraivi;s  exmir nodlltemneias) rrm(  ou0oexnmi3ilsla2emuvs t)tetrxr oatfm r ues t) rxoxmpoy4llenlfes s)s2urx  ou0tlx ifciys a uanmo (0arxnif ia1omt aueo (0t2xmxm3oodoltnmneiatfsDraxmoot1texnmo3tatfs rluvp;u4 ltoio3tadlmtrai ilt)s2umiopno4ap elicta()aDumxmpnu4aex iocias s rmn o u4 eerxfciotlm  aueo s tetmir io4optelneil( artmxrp;o4alxomo3ilt s ra(mo t4aexnmo ia1oa ranes () rurir3iu4altn ivs sf rtau ono1aeen iciytfa ea(mpn() lerxf iatfateauvi t0 rxmio nodlltn fctat  rtrx p;u1alxn fetadfa2rln s;(0alenmo3tytopDr n o;s0t2umim3oodameelnvsl()artmu oou4apx mociaslmDrm(vsnu4artnmo io1fate ivo t)setriopoy4oltnlnes t  rrmumooo1aeto fciltfmDrmumpnu) renxr3iadlp eaneol() 2xmxo3oodaltemivil(fsDtmu o;t0tpx mfeiysfs2em(mo u0alerxrcoo1om r nvs;t srxm(m no4lm nlfvsl(f rurx ont4opx ioeild a2rmnvo u4alxnxrcoytlpD anei;( texo(opio1apte fetat)s2rmurp;u0tpt mfcias s ua( ont4arxrir3iatfaD au i s s2uo(r ny1lpen icta( s2uru o;t4teen i3iltfmDrlnvo;t0alermf3iy1fa e neo t0setrxm nu1amt mfei (f rrmuro;u4olt mfeiatls2rl( o;()alxnmf oadlm rau olt) 2xo(r nu4optnlfcsas  2rrxronu1texomoctltfs uanvp ()aetnif tadlpteau s s0s2toim3iu1lm e nes t  Drr(rpoo4tptomictlsfm uanms ()altnmo3tadfp e n i;s)s2toxrpiodllee fvsl(farraum nt0opeo oeiltfm rauvp u)aetnir tadfaD lu o;(  exm(opiudaleemfci s  rtm(root4texoif3iltfs2rau on(0 rtoir3totoaD  neo;() rurirpiy1omeemfcslt) Dum( pnu0tlx  ociydfm um(mo u0trermfciadfm eaivo s) etoir oudlle  neslt s2tmurpou1oee mictltfa el( s u4tetrmrcootfaDr neols)setrxm iy4lp   ivt ( s2umxmpnu4aleomo3iyslaDelnvp ()arxrmf3iytfptran o;(0 rtr(m iodllt  feilt)sDur(r ;t4apxoif3iysla rlu s t4 eenmocoodlaDrlnvo ( srtoxrpoo4alt liesa(  2ua(roou0texnmoeiasfsDua( p u0tltnxf iodopD lnvils0 rxrxr3oodaltn ietl() Dtrur oo1oleomietldlmDuanvp u0arxnir iotlmDeli ilt0t2trio3ny4olenliet t)srumuront0oleniocias m2ea( s;u)aetoxo ty1fmDe i i;()seurxm nu1lleelneil(fs2tmumooo0tlx  octltlm2umu o;u4artnmrciadlmDeau ils)seuriopoodlmeemnes s  2rrx pou1oet iiciatfs2ul(mp u0 rxrifciotom  luvils0 exmxr iy1omte ncs ( srtrxm ;t1tpxnmo3tat s elnms;u)alxnmrctadla r nei s) rurxr oo1apeelnei sf rumum ;u4tpe io3iltlm umnmo;t0aexrir3io1omDeauvil(0sexrxopoo4am  lfvta(  Dur(rpot1texnif3ildfmDumnms t)aetnmo ootfaD auvs ( setrio nu4lptnmnvs (  Draxmpnt1oeto ociydlaDua( p;t)arenio3to1fp ran sls  euoxr nydol n fvils artmuro;t1aetniiciatlaDel(vp;(0aeeriocty1op rauei;(0 2urimpny4olt mneils sDurxm nu1aeen f3tlsfa el(mo u0tltnifcia1fatr iei;s0trtr(m io4ameemnctlsfsrta( p;u1ole iieiat s uaums u0aleoio tytlaDelieo;s0texrio3oudal n fet s aDuaur ;t1oltniicilslm2el( pnu0 exoxr totfmD anes s srxriopoo1ameemfeils)sruaxm ou4aexn feiatla2em(vo (0 etnmo3oodopD au ol( seurxo ou1op nlicilt) Dtr(root1tpxnif3tlt s rm( s (0tleoif3totfatelies;t  rurio3oo1lltnmneiasf rtm(r ot4olxo iciadfsDean p;t) eermr3iadlpD  i sls)t2toim oydlpeeliciatfaDum(mpoo0oetomociysfsDumuvpnt0artrmf3iytomt anvol()trxr(o oy4ap emivsa(  Drmxmo;u1texn oeiltlm rl(vo (0 eermf3totlmDrliei;(  etm(rpoo1ole mfci sfsDurumpot0tltomietyd m umnvo t0arxnmocio1fpD ln s;t tetrim oydam   ncia(f 2uaxrpoo4oee  feiad aDeanmonu0altrirctodopteai o s trxoxm3iydopeelfci s) 2rrxmono1apeoii3iyd mDeau pnt)trxrxo3tydoat  u sl(0 rxmxo3nu4al  livtatfsDrmumo;t1oleniiciad mDeln o;()aetomf3oodoaDraivo s  rtr(m no4amtelncslt)aDtmurp;u0opto fctas m2em(mp u0 rtrxr3iodfaD  nei s)seuo(o oudomt licsas) rua(ronu4alt ioctltlm2emu onu) etoio3oo1fpteaueo;(0trtrxopnodlltnmiet t)sDtrxrpnu1olx  i3tatls2ran p t) rxrxo3ia1fmD li s () rxr(o3oo1om elfcilsfa2uaxrpnt0tlt mieilt aDrlnvont)aetnmociadom rlnes s s2urimpoudlpe  ncs ( srrmumpno4oeeomi3tlt m2rmnvp;u)aetomf3iadoa r n olt0t2trxm iy4alt lfesa(fsrtrurp;u0oee  i3ildlm ranvs (4 exomrciotop   u s;( seuriopoy4olt lfeiasf 2rmxrpou4opx mi3iydfs eauvpnt) exrmr tytopDrlneslt)seumxr3nodam nlict tf Dumu p;o1olt  icils a emn o;t4aetnmr3ta1la  aivilt  etoirpoy4alt livsat srumuro;t1alx mictlsfs2um(msnu0trtnio3ta1opDeliei t0t2uoir3iy4lp elnetls aDtmxr oo4tlxn o3ilsfmDrm( s;u4tlxoif tydoaD aieo;(0s2umirpoy1lpte ivtltf ruru pnu4tpto octasfmDran pnt) lxrxo ta1lmtelueol(0trtmxopnudal nmneias) Drr(  nt1tpenmi3tadla umuvs t0 rxoio3oatoaDelueo;t t2xr(r oo4ale lnet t sDumxm no1tex  i3iltlm2emuvo;u4trtnmf3tydom  lu o ()texoir iy1al nlfvi tfaDrmx pnu4tpenmoeildfaDem(vont4areomocoa1fmt li ilt0truoir3iu1omee fcs ()aDtmur ;u0tpt iietadlm2eluvo;()artomf3oodlmte n o t  etmxopoydomenmnesat)sDur(ro;o0optomfciytfm2ua( p u) rtoxfciodfm rluei (  rtm(o3oydop  lietl()srta(  ;u1aexo feiatla2em(mp;t)artoxr ia1lmDrlu ols)trtmxr3iu4am emncias a2rmxrp;t0aetn o3ias m rmums t4 rxoir iy1lmDelnvsls seurimpou4optnlnciatfarrr(ro;o4tleniictlsfa2ra(monu0altnxfciydop   nei ( trxmxr nydole mieias)a2taxrp;u0opx mfciaslaDumumonu4tlxrxo iotom rlivi t s2xmxopoy4llenmics s sDtmu  ;u1tlenmoeiyt mDumnvo;u0teenxocoatfmDeli ils trtm(mpiu4opt mivsls) 2ra(mp;o1olxo ocils m elnmo;(4 eenif3oa1fm  liei;t0 euoxr oydlmte ncsltfs2tmx pnu0olen oeiltla eanmont4areoxo io1fateaies;t)t2xoxr3nydol n fcta()arurxro;t1aptoiocils m emu onu) eenxr iytfa e nvi t t2trxr3io4al n fvslt) Dtru pou0alen oeiytls2ulu s;u)tetnmrciydlaDr neslt  2tmxr3oudaptnmfcs tfs2tmurp;o0oex iociytlaDeau snt0 etrirctatfptean slt)srtrxmpnydamenlfvsl( sDtau pnu1tet mi3iysfaDumnvs (0arxomf3oy1fmteluvs s) ruoxo3oo4lmenlfcia(f 2rm( pou4tlxniietydfaDuluvs;()aetrmoctydlmt  i sl()t2xrxo3iodop nlfetls sDtau pou4oeenif3ildfa2uauvo;(4texoiocootlmtelieo ()trxo(r iu1olenlietls aDtr(ro;t4ope iicilt m rlumsnu0teermfctatoptraiesls s2toxr3oo4opeelieia( a2rmumooo4aleoifctltfaDrln sn(4alxnmf3to1la  ln i;(0t2ur(r3nydaptnmfcsa(  2ua(mpnu1openmi3tlt s2rl(msn(0trtnmr3oa1laD  ies;t0srtrxo iu1op   nvia() rua(rp;u4tpenmo3ilsfmDulu p;u) lxomf iodfmt ln o t setrxrpno1ape lnes t) 2um(mont1opeo oeiaslmDua(vpnt4 lxnir todoatran i s trtrxo oo1lmtelivsa() Drrumpoo4opxn i3iytlaDum(msnu0areoxo oa1oat an s;s  rtrir no1optn fetat)a2taxm nu4teto i3tyt s2umnvp u)aeeniocoydfaD aivo t srxoxrpno4ol nmiet ( a2rmum no1alenmi3iatfmDuanvo ()arxrxf3oa1omD ln o;s  2urxopny4olte fvi (f Dtrxr oo0tpxo f3tasla rauvo (4tlxnmrcto1faDe u o;s)seuoio3ou1lltelfcsl(f 2ta(r ;t4tptniieiasfa ea( p;t) leoxo iotlaDeluvi () rum(o ny4om nlfesas)s2uaxr ou1aexoiieias s2ul(vo;u0trxoxr oy1lp  anvil()sexoxr ou1ole mnvsls) rrrxrpot4tle mfeiys a2emnvs;u0aleoxf3io1lmt  u i s0texmxrpnydap nlivsl(fsrrm(rpot0tptnmi3tys a2ua(mo;t)aetoxocty1fptran o (0sexoir nu4apte fcs t)artaum ;t1aexnmfciydlm2eaumsnu)alxnxo3tydop eaies t texmimpoo1ameemfvt t sDrmumono4alt  fciltlm2eauvs t0aexrmo oytfa elieol(  rur(m iydlpe mncta( aDtrxro;o0olxniocildlaDem( sn(0tlxrxf totlatrlivsl() exoxrpou1lleemnesat  Drrxr ;o0oex  ictysfa umu o u4 ltnxr3tadoatr uei;(  2xoir oo4llt lnes t) 2rmurpou1oee mfetatlmDrln s;t4 lxrmo ta1lm e uvi;()setoxrpoo4lm nmncsl()srtmx o;t1opx  ictad s emn o t)trtnif iadopDeai o t)teumio oy1ap   nei t srtm(m ou1aex mieiyslaDemnvp;(4 rxrmo3oa1fpDrlu ilt)trxm(r3nydomte nvias)sDurx o;o0altoifctldfm emuvo;()tlxoxfcootlmteaneils0t2um(o nu4opte fctl(farumurpot4olxn f3iadfa2ean o;t4 ltnxr3iodfpt livi s)trtrxr io4altnlfcia(fa2uaxr ;o4alxniieildls ra(msnt) leoxf3ia1optrlnes;s)teuoimpnydoptemfvt s s2tm(m ou1tptoioeilslmDrlnvs;(4aexoio ootlmtraieilt)trur(opnu1lpeemnvsasf Durumo;t0olt mi3tysfs2uan s;t)altoxr oatopD auvo ()t2uo(o3iy1ameelies ( srrrxmpnu0oetoifciasfa2el(mp;t4 lxoircoo1latrlivi s) rtoim oy1om  lfcsasfs2uax poo1olxnmfetltlaDrlumo u0arxrifcootopDe nvi;t setmimpiy4olenmiciat)srtmumpno0aexn o3iatls2rmuvo u) etrir3iotom rai slt s2xmiopnudalee fvt t sDrru o;o4alen feiatfa emnvo u4 eenmr oa1lm   u ilt s2uoxopou4lp  lnes t  Drr( onu1ope  fcild m umuvonu0trenxoctytoaDr ivslt)srum(rpiy4am nlncsas srrm(ro;u0olx iociadlsDemu snt) lxrxrctodfp   uvo (  etr(mpiy4aptemfvsls)artaumpnu1tex ioctasfs2uan p t4 lenxrcoodoateaieilt)s2xr(m iy4lptnmicslt  Dtmx p;u0oeeo feilt sDemump t4alxomo tytlpDeaieo ()trumirpnodlpt miet ( a2trxr oo1tle  ietytla uau pn()arxnif oytoat  ivo s  rto(r iydamtn fcsas  2uaumpnt4aee mf3tytlm uauvpnu4aeerir3iotfpD ai ilt0srtrxr oo1oltn nvil(  rum( ono4opxoiociat m umumo;(0 eeoircoodoat au sl(0 rxrxm3nu1al nmnci t  Drr( onu0tpxomoeils m2elnmp ()treomrcoa1lp r ivi s) 2to(m nodlleelfcs t s2taxrpot0oee  ictatfa em(mpnu)teenxr ta1op rln i t0 2xo(r3nodlp  miviatfaDra( p;u0texniieiatlm2rlu s;u0aeenmo3iytfmteanei;t) exoiopno4olen ieta()srtr(rooo4tptn o3tatfa2umnmon()trxnmf tytlptr i o;s) 2urxr3iu1aptnmfetatfs2rrxmoou4oeeoifciytlm em(mp u)alenif3tytopDeli o s0 exmxrpno4amt mnvslt)sDtru oou1apx mietytfa2ul(vp;(4 ltrxo todfp rliesls)srxrir3oy1ol n ici s)s2uaum ;u1alxnmi3tatla2umn sn()aetrxocoatoa eli ilt)t2umir3io4altnmfcil(fsDtaumooo4tlx mietydlaDrm( s u0tlxrmf iodfm r ieil() rxmxm3oydoptnlivtlsfaDua( o;u1olxomictasfaDua( s u0 rtrircootla  lies;s)srtrir3iy4omee ivsat)aDumurooo0aexo ieildls raumont0texnmr3iadfptelues s)sexmxo oodlmenlics ( arurur nt0olxnmictytla2uanvo;(4aetrxr tydlpte n o s sexmio nodole  neils)artmum ot0ope mocilt sDul( p;()tltoir3iadfmDe ieslt truo(r3oydamen ncsat)aDrax pnt4aetn iciytla rau s;u)altoxo3todlp rlueil( setm(rpiy1altelfeil( arurur ot0tlx iociyslm raumo;u4trtoif3iadlaDraues t  rxo(m3oodaleemici (faDtm(mpoo1oex  ocilslmDean s;()tetomf3tydfpD aieilt0trurxmpnydlme lnetltf rtmuro;t0oeeo i3tatfsDrmn o u0tltrxfcta1fp  lueo;t0 rtmirpny1ale lfvtl(fs2taum no4oexnifctasls2elnvo (4tetoxf3iotfpDrlu ol()trtrxr3nodll nlfcilsfaDum( p;o4oltomfeiat aDemums (0 etnmr oydomte i s t0srtriopnu1al n ieslt srrrumpot1aexnmf3iyd sDrmnmpnu4artoifcia1lpteaivols)truoio3iu4lmt  ivtasf Dumxrpno0apeo f3ias aDrmu onu4 rermf iatlm  lu i t)trxrxopny1amt  fei ()arua(moou4tpt micildfa2ra(vpnt0texrmf3oydoa rluvols)t2toirpiudap elivsasfa2rax ono4aexnii3tydlm2eanmo (4 exnmr3tatoatean i ( texr(r3iydop nlnviltfsruaxr ;t0olenmictydla rmnvpn() ltnmoctadfmtr nvs;s0 etm(o3nydll nlnvil(  2raxr ;u1tptnif3tat aDuanvo ()tetrmf ty1laDr nvo;( srumxmpoodllt liciltf Drax  ;o1oetoif3iyt a2um(vs;u4 ltrmf iy1lp   nvs;(0s2umirpnodol  mfcslsfartru pnt4ape iictytfaDumumo u0aeenmrctydfm rluvi;t) 2triopny1ap emics sf 2ur(ronu4ole  i3iat s2ua( p;u)alerxr3ootlmDelnvsl() rumimpoydlp  mfet t)s2raurpno0oeeomfctlslsDua( ont)tetoirctytfa  li o s0sexoim3iu1ap   ncia( aDrau o;t1tpxn fctltfs2umnmsn(4teerif3oatlmte u i s0s2tm(m3oo1ameemfvsl(f Dtau  ;t4oltoioetyd a emu p;(4texrmf3oytoptr ieo;t0srtoxmpnydllt lfvsasfaDtaumpou1alxniociatls2ranvp t0altnmrcootfpDe uvsl(0 rxoxr3ny4opeemfet sf 2rrxmo;u1tex io3ildfaDuan o u)treoio3tytlmDrauvsl( trtoxmpno1llenmietltfa2tmu  ou0oetnioeiysfaDumu o t4arxriocio1om rlueo t) rur(rpiu4omen fvia(  2tm(mpoo0aleo o3tlt sDeanvont0 rtrmf3ty1la   ues;s t2um(m iydal   ict (fs2ra(moot0olxnmfeiyd s2eanvp;t0aleoxo oy1oateaieo ( s2tm(o oudll   nesas aDtmx pno4oetnifeildlaDua(msnu)aetoir3iatoaD luvi t0trur(m3oodaptemivtlsf 2tm(mp;o0tpeomo3tasla2emn s;()texnmf todomtr nes;t0t2um(opoo4lmee nesltf 2rrxmpot0tpenioeiatfsDumnvs;(0aetrir3io1laD luvs;t texmim3nodapeelnvt tfa2ur(monu0tlxomociydfaDrm(mp;t) etnmociytfmD  i ols)t2ur(opio1altn ncsa(f rurump;u4oleomiciysfaDrm(vs t4trerxr tadlaDraueo s0trxrxo iy4amenliesls  Dua(  oo4olxn ociytla2rmuvp t4alerxf iotfpDeaivs;t)t2urxr iu4lm  lict ()a2um(monu0olx  ocilt aDrln o u4tlerxo3iy1fa eli sl(0 2urxr3oo4amen ivtl(f 2ta(r nu4tlenmoetlt mDua(mp t0aeeoxr3ta1oa   ueil(0 2xoim oy1lp  lnvt t) Duauro;o0alxomietatfmDemnmp (4alxoxf3oytop rlnvslt0teuoim no4alt lnvs t)arrrurp;u1oexn o3iys aDrm(mo t0arxrxr tydfpte nvs;t)s2tr(o no1lptn fcsa(fsrta(r ou1tee mo3tls a2uluvo t0tltnifcoy1lmD auvsl()setr(r3oy4ol  lfet tfaDua(  ;t1alxn ocias a2emumpnu)aleomfciy1lmt livol( teum(rpoodol nlivs s s2rrxmoou1ape  ictld s raumo t4 leoxr3oydlmDr uvslt0 rtrimpiu1alen fvta(  2tauroot1opto o3iytls ul(mo;t0teermo3oatlat auvs;(  exmiopoy4lm   fvtltfaDta(mpno1opeomoeiasfm2ranmpnu) rxoif ty1la eai ilt0tetm(r oo1olenmnes s  Drrumono0alx  fetldls umumo (0 leomo3iodfatraiei;t0 2trxr3oo1apenlieslt sDrrxmpot4openmfetydfa ranvpn()tlenmf to1fpDr ieo;t)trurxrpny1ame  nesl(fartau ono4tlxniieiadfsDea(mpnt0alxnmf io1latrlivo s t2xr(m oy1alt livtls s2taxmpou0alt  icild aDum(vsn()texoxfcoo1oa  lu olt s2trxo3ny1ape  nvt tfs2trum ;t0tleoioeiltfmDul(mon(0artrir3tydlmDr nvol(0trxoir nodlmt  icsa(faDuaxrpnt0aet  i3iaslaDrm(mp t) lermf ta1opD  iei;(0seuoio ny1opt  fvsa(fsDtru pnt4tptnifetas m ulu onu4 rtnxo iytlp   uvsl(0trurxr3nu1aptn nct s)aDtau  nt0tlxo fctaslm2eaumonu)alxrio ty1fat  uei;t0 ruo(m nudome  nvs tf Dtmxr ;u0tle mfcildfs2uaumo u4tetnif iy1lpt ai ilt t2xmxo iu1ape lnciasfa2ua( ont4oee mieias s rmumont0arerxfciatopteaneo;s)s2trir iu1lleemfei s s2tax onu1altoio3tlsfa2ua(mo u)altrmf ia1lm e nes;(  rumxo oo1op n fvtl(f rtmx ont1olxn fetadla eanvs;t)tlenxfctodoat  ues s0 etoimpiu1lle  icsas)arum(  ;o1alenmiciyslm2uan snu0 rxnifcoodomt  nvsls0t2uo(mpiy1lm nmfct tfsDurum ;o1opxomfciltlsDemn o t4arxnxr3iodfmD  nei;(  2xmxr io4apt  fvslt)artrumonu1tpxomoeilsfs elnmo;t0arxnxo io1fmte n s;s0 2uoxr3iy1omenmfcsltfsrtaum nu0alxn f3iad mDul( p (4alerxocootoat ln olt0sexoxopnu1lmt mnvs (f 2rrx  oo0apxoifeild m2rlnvp;u)altomr iadoaDeaivils) 2xm(m3ou4lpe  ivias  2ua(rp;u1aet miciyslsDrm(vo ()altoxr3tydopDe nvs ()seuo(r3iy1lpee ncil(fsrtaurp;o0apxnmfetytfm2rauvo;() ltoxf3oatfpDeai il(0teurio nodameelfct s a2rrumpou0aleniietld s2rm( o;u4tetrmr3to1fp   nvilt0 exo(m io4omtemnei s a2urxr nt1optn iciys m2ea(vsnt4tetrmocoo1faDe nesls s2toxrpoo4lmen fei s)sruau  nu1tlt  ocilt a2emnvs u) renmf todlpDeli i;()srxmxrpnu4lmtelfvs t)a2raxro;t4oeen ictatfsDum( sn(0 eerxfciy1la e nvs;t0srurxr oudome mici ( s2rr(m ot0tlen i3tyd s2ua(mo;u0 eenmo3totomtran i t)trtrxr3nu1oltn nvia( sDtm( p;t0tle  oetldlaDuaums;(0 ltrmr3tytomDeanvil( t2uoio ny1aleemicsl(  rrr( o;u4tltnmi3tysfa2el( o t) rermo3iydfpDr nvslt0 etoio3iodap e ncsas srtrx pno1tpe mi3tld s ea(vs;t)aexrmoctytfmtraneolt0 2urirpny4lm  livilt artr(mpot4olt mfciad a2elnmon(0arxniociytfm eaiei () rurir3ny4ll nlfct (f Dtrxr ;u1opeo oeiytlsDel(mo;u0tltoxfcia1fp raues;s0tetm(mpiu1lle mncias) Dtm(m nu1aptnifeiysfm rlnmo (0arxomo ia1fmDr i s t texr(o3oy4ame lfcsl( a2rm(rp;t1openifetltfaDel( snt)texnxr3ootlmt  ivi s0texoxmpno1al e nesas sDrmurp;u0tpt mo3ilt mDuanvonu0 rtnxf iy1opte ieo;( t2um(rpoo1lle mivslt) ruaumoou4tltnifetys m2rl(vo;t4 eenxf3iotomD li ol( t2toxrpou1lmenlncsl()artax  nu0aex  fctys m rmnvpnt) exoxo iy1lmDrlu o t)srxo(m oudam nlnctat srtm(mo;u1opxnif3iytfm2emu s ()artnio to1oateli o (0seumim oudomtnlieiasfs2tmur ot0tle  i3iad s rm( sn(0 leoio3ta1faD  uvo;t)srtoxm oydoltelivi (f 2raxrono0olx  fctld mDrm(mpnu)texrircia1lmD an i;t t2urio no4apt lnesls)s2rmxr ot0aeeomociys m ul(ms;(4 lxomfctotom  auei;( s2umim3iu1lltnmfct ()arrmu  oo1opxoii3iltfsDeaums;() etrmr3totla   i s s setmxo nudapt lfvsat)a2uru  oo4tle  ociyt mDua(vont0trerxfciodomDrlues (  rtrio3ou1apenmfeiat) rrmuroou4tpt  feiatfm uau pnt0tetrmrctotfaDeli sls0t2urxr iu4lltnliesls aruaxm no1aetniiciatlmDua(mo;u4aetrio ty1faDr uvi s0srtoio3nodale  ivi (farta(rp;u0tptn oeias sDrm( s u)texnxfcto1fatrlnvil( trtoxrpnu4oleeliet t  rua(mpnu0tetn oetad aDem(vp;(4 lxnxr3oodfpDeau ils)srxr(r iu4ale  ietat  Drm(mpnt1olxomi3iyt s2uauvo u) rtrxr iatfaDe i s;s0s2trimpiudlpen neil()s2rmu  ;u4ale  i3tytla umuvs u4 etoio oo1fm rluei;( srxm(o oudom n netas  Dta(  oo4apto i3iyt sDumu p;u4texnircoo1lmDr neils0trum(m3iudlpe mneia()srraxmo;t4aexn f3ild m ea(ms;()arenmo oatoa  livo t  2uo(r3iy1lp emivi sf rrmxr nt4ole mieiatla2raumsnt0tetnxr3tadoa rliei;()seurxmpio1alte nvt ( a2tr(ronu4olxn octat m2rauvs;u)artnxf todlmDeanvilt  exr(o nu4open ivias  Dtau  ou0tptn oeiydla2el( p;()tlermr3to1opDrai sls sexrxm nu4apte ivi t  rra(rpnt1opxomo3iltfmDelnmo t)tltnif oodlaDelnes;( setrxmpoydap elict t srtaum ;t1openif3iatfa2rmn snu4texoxo3oodopD  uvolt0 exrim ny4ol nlfvi sfsrtmxrpno0oex  oeildls2ulu p;u) ltoiocoatlaDeln ols  2urir3nu4llt lictat)aDtaxrp;o1apto ietas m2uanms;t0 exnmf3oatom e u i;( srumim3iu4lmtnmivi (fa2rm(m oo1tlx ifciydlm ra(ms t4arenxocia1lpDrlnes t)teum(r io4olt  ivtat srrrurpou4tleomietatla um(vp t4arxoifctodlaDelnvi;s) etmir3iodlltnliviasf rtmxmpnu1aexo o3tatla uaump;()teenxo tadfmDrlu o;t0 2xrir3iy4om n nvil( aDraurp;o4tlenmietydls2el( pn(4treoiocoodlpDeluvol( tetmxrpiudap elfciat  rta(ront4olx mf3ilt a2emn p t0 rerxo tadom rauvolt0srtoxo3nu4lm  liesl(faDtmx pot0opxoio3tyt mDuluvp;u0treoxf ty1latrliei t t2tmxmpno4ale livia( artru pno0alxo ociydfm ulnvp (4 rxoxfctatlat ai slt0s2ur(m3oudapt lnesa( a2rruroot4ale if3iad m2rlnvp ()trxnif3iy1oat  i o;t t2xmxr nu4om nmivi s a2ur( p;o0openioeildlmDrm(mp;t) lxrio3io1fa  lnvils texoimpiy1am n fvils srrmumpnu4tpe ifeiasfs ra(monu4 lxomociodfmtrli i (0 rto(mpoydolenlict sfarra(ront1olxnmf3tld mDrm(ms t4 lenmrcoadlptelu ols0 rxo(opny4ole  neia(fsrraurpnu4ope iiciydfsDea(vs;u0 ltomo3iydop  ln ol(  ruoxr iodame  fetlsfsrua(ro;t0tpt ifetldfaDeanmpnu)altnio oydfmDr ueils0teuoxopoudop nmnctas sDrr(r no1oee  ieildlmDra( o;()alerifciatfp r uvils0sexr(o3no4lmtelfes (  Dumuro;t4teeomo3iytlm2rm(vp;(4 rtnmrcoadomD aivo t s2xmxopiu4amtelfet ()aDur(  no4ole  ieiytlm2ea(msnu0 ltnircoo1faDelneo;(0 rumxr nu4opee ietl( sDta(monu0tleomoetyd s2em(vp;(0 rtoxo oa1fp rlneo;t) rxrir3oo1amtemnvtat artmxmp;u0optnmi3iytfm2ra(vsnu4tlenxr iotfmt au i;t)srtrir oo1ol nlfct sfarur(  ;t1tpeomoetaslaDumumpnu4tltnmf oa1om eauvo s  rumxr3iu4lp e fvs ( aDum(rono1oetnioeildfs2rmuvo;u0 renmr3iodoa raues t0 etoxm3no4openlfctlt)srtaxront0apeo f3iydfmDrl( ont)alenxrcoatoaD aueo ()sexrirpnodomeelfes sfsrtau ont0tpxomf3iytlm2ulu p t4 etoxociy1faD ai o;s) rxrir3io4alte fctl(  rtax  no1tee  oeiad aDel( p;(4altnmrciatla rlu i () 2um(mpio4lltn ivilt artax  ;t0openif3tldfa2eaumo;(0aetnir ia1om   ues s setm(m oudlpeelnvi s)arrm(mp;t1oex iietltfmDrln snt) eenxf oodfpD lnvilt) exo(r3oy1alt mnvs t) 2ur(mp;u1tpxoifeiatfaDea(mo;(4trtrmo oytlmt  n s t0setmim3no1lm n ict t srtr( pno4aetomfeiatla2ea(mpn() eeomr3iydlat anes;t) rur(opoodll e fvtl( s2urxm nu1oeeomociadfm um( p;(0artrio to1opt lu o;s)s2toir oo1lmeemfvtas a2tm(moou1tptnmf3tydfs eaumo;() ltnmf todop   i il()sexoio3iy1openmfeilt)aDumxront1alenmietadla2rauvo;t) lermocty1lmDr nvi t0s2to(o3iu1amt mnvt tf Durxrono0oltnioetadfs ranmpnt4 rxoxf iy1faD livi;s teuoxrpny4alt  fet ( aDrm(moot0apeo fcilsfmDeluvp u4 rermocoytlpteanvil( texmiopny1ape mfct ()arta(rpno4tet ifetatls ulnvsnt) lenir iatlm  lueo;s)setmir3ou4op   fvi () 2umurono0alx iiciat a2um( s;(0alerif oa1la  anvolt teumxr oodlleelncsls  Dur( p;u1tpxn octlsfa2umnvpnu4trtoxf tytfm elnvils) euriopio4lp elies sf 2trx  ou0alxomfeiyt s rl(vs u0tltnxfctotlpD  uvi (0sruoxm oo4ll   ivsas) rrm(  oo1olt iieilt m ulu p (0tetnif3oodoa eanvi s srtrir oo1ll e fvsas sDtax  ;u0oetnmiciatfm eaums;u0trxoirctytoat ai i s0 rtmiopoy1lme mfviltfaDrrx p;o4aet  oeiyt s2ea( snu) rtrxo3oodlm r u o;s) rxrim iu1ll n fetl(f rtrx pou0alx  feiytfsDrmu o;t0aeeomocoadfmD li i () 2ur(mpoo1ap nlfct ()srtrum nu1tpe io3tyt s2uau s;u4 etrmf oadomt aneil( tetmir3no4amtnmicta(fsDtaur ot4oleomo3iltlm rlnvp t0arenio3totfmt aivi ( teurir oo4lm elfvsat)arurur no4teen f3iysla2rmumpnt)tleomfcio1lat  ieo;s  exr(m3oudamtemfcsl()a2rmum ;u4oex  i3iatfa emnms t)trxrifciodoatelu i t)t2urxopiy4opt  ictl( sDtrumo;u1apen oeilslm2umuvsn(0altoxo to1lpD  nvslt truoio ny1om emnctlsf 2rrxroot4ole  o3iydfsDuaums;u4alenxf3oa1fm eli sl()sexo(o iu4omt  icia( arur(rpno4oltomf3tatfa2rl( p;t4alermo3iodlptrai sls)setmxopny1apte ici tfaDrm(r ou0tpen o3tlsla emnmp;u4aetnmf3iodlptrau il() eur(m3oo4ame mfcs sfsrrrx pnu4ale  iciaslm2umnvs;(4tlxoxo3todfmDeaivs;( t2xm(mpiu1ole miviasfsDtaump;u4ole  ictadlmDrmu pn()alxnxf oo1fp eln s;s0 2umxm oudop n nvsltfsrtaumont1tpxoio3iadfa eluvo;t0tlxrif oydom  livsls)trxo(mpny1omtn ietl( aDrrxmpno4opxnmf3tlsfm el(mo;t)treoxf totop  lieil() rurxo3iu1lpte fvs tfa2urx  ;t4tlenifeiys mDuan pn()artrmo ootomDrli olt0 rum(m3no1oltnliciasfs2umxrpou0tltn icias mDua(vo u4tlenio iotfp eaneols) 2ur(r3iy4openlncsls)s2rr(  nt4olt ioeiys aDum(mo;u)teeoxocoadlatranvils t2toir3iudamtelicta( s2uau p;t4altnmo3iltls2ulumsn(4 lxrxf3iatoaD luei ( trxrio3iodlm emnetl(fsDta( onu1oeeomoctytfa elnvp t0 reomrcto1fpDr neolt0t2uo(m nu1apt  fci t)a2tm(mo;u1tlenifetydfa2rlu s u0tltnmoctotop  lu s;t0trtmxo3nydlltelieils) rtm(ronu0aleo fciat a ea(vpnu) lerif3tadom ran slt0 2xmxmpnydam nmnci t s2ua(  nt0tptomiciys sDrmn pn(4teenifctodfmDe nvs;s)s2xoxo3io1ll   ieta(fs2urxrpnt1aexn oetldfm ulumon() rerif3tadlpDr ivils t2trxmpnudlmtnmfvils)artaurono1optnio3tysla rlnmp;(0tetoxo ta1lmDeluvi (0 ruo(mpnu1ome lfet () 2uau ono0oeeomfeilt mDel( p;u) leoio totlm   n i t) 2ur(m3no1ape liviasfs2tr(mp;t4teenifeildls2ulnvpnt4arxnifcoy1oaDrauvs ()s2xm(o3nodomte ivta( srumxmpnt4tle mi3iytfs2uan s;u)aeenmf3oa1laDr ueils) 2to(o3nu1olenlfcsl( aDum(mooo0tetoifcilslmDemu p u0alxrxfcio1lm  aiei s0s2ur(o oodlmte nei () 2ta(  nu1teenmieiytfa2ra(vo t4 rxnxf3oytfpD  ivi ()s2tmxrpno4op emfei ( s2uaumpou1optoiieiatfsDua( pnu4tlxrmo oadfmt  n o;() rtoimpoy1amee ict t) Dtm( pnu1tlx mietasfs ra(mp ()tlxrxr3iytom e nes s0setr(m3oo4op n ivt s) Dua(m nu0texn iciydlm ul( s t)trenxo3iy1la  ln il()t2uo(o iudaltemnctat arua(m ;o4oleomfeiatls raumonu4artrxr ty1opD auvo s0srum(opoo1lltelfvsasfs2tr( pno0altn f3iyt mDum( o (0treoir tytomtrlnei;()teumiopny4lptnmnctas)arumxmo;o1tle miciyslm uaump (0trerirciotfptr n i t0 rxoiopnodlmee fctltfsDur( ont0tltomf3tydfm2rmuvp t)trxnif3io1fatr ivo;()trurxo3iydal elnvsas  Dtru oot1teenmfeiatlaDemn ont)alxnif iodlaDelueil(0seto(o3nudop eliei s) rrm(r ou0oltn i3iasfm rmnvsn()teenio3to1laDr nei t0truoxm3nydlm  mict ()a2ur( pno0olxoioctasfm2emnvs u0alxoioctatlpte nvs;()trtrirpiodome  ivtls) Drau pno4tlxo fcils s umnmo u0aexriocoydoa e ies t s2tmxrpou1am n nvtl()aDua(  ;t0altnmfeiydls2umumon()alenmf3tytoateaneslt)s2xm(o iudll nmfetas  2rr( o;o4altomociydla2rmump;(0 ltnxocoo1oaDe i s ( seurxrpio4om e icsat)a2rmu pno4apx if3tlslm rln s (0 ltrxf3oy1lmD aivol(  etrimpiu1ole mfes tfsrrrxm ;u4oltoif3taslm2rlumpn()tetoirciodlmDeli ilt t2um(r3iodap   fcta(  rrmxrpnt1ape moeildfa2emnvs t0 rxnio3oo1om e uvslt0srur(r3oo1ale  ivtls sDrmu ont0oex mfcildfs2eaumpn(0 exnio3to1oaD aieols0 2um(mpno4llt lfcsat) rua(m ;o1olxoiietltlm emu s;()tltoxo ty1oa ranvo;s sexrir3nydom nmici sf 2rmxrooo1oetn fetaslsDeanmo;u4 rxnxo ta1lpDelu o t)t2tmxrpou1opeemneta( sDrau  ot1oltomf3iat s ea( pnt0arerxf oatfmDe nei t0 euo(mpoodole  fvt s sDtm(mpoo1tleomociytla2uln ont0 ltrio ty1fpteauvol() rxrirpiy1ol e neiat) rtrxmono4ole ifciyt s2um(vont0 exrmr oytopDeluei s0trxmxo oy1lp  lnviltfaDtruroot1aleo fciat s2rln p (4tetnxf oatoptelu ilt t2uo(r oy1amenlfcs s sDtmx p;t1opto fetyt aDumnvo u4texoxf ty1fat anvi;t)s2xmiopiy4apte fvs (  2ra(rpnt1tex  i3ias mDra( pnt0trxrmr3oadfp  lnvs;t t2uoxmpiydal emncias s2trx p;t1opxnmo3tasla rmump u)trxrxr iytfpt au olt teumiopoy1om nmfvt tfaDurxrp;o4tpxnioeiat m el( o t)tetomr oytfaD  ivols s2xm(m nydlp nmivta( sDuaxm ;u1apxoii3tatlm rlnvo;t)trerio3iodoatr i ils0sexoxm3no1aptemnviat)srtru pot1oeeoii3iad mDra( o (0 rermf oy1opt ai ol(0 euoxmpou1ol nlictl(faDrmx poo4ale ioeildfa2rau p;(4 lenmr iydfm rliei t t2uoxo3io4op   nes tf Drru p;u0teenifetydlaDumnmp;t0aetnmf3ty1fpteai ilt)s2tr(m3iu1lle  neils aDum(r ;u0aeeomfetydfmDel(mo;u4altrifctadlat  u sl()seuo(mpiy4lptelieil()arurx poo4opto f3tatlsDumnmp;u)tltnmr3ta1la   iei s trtr(rpio1ll e fci (  Dtmxro;o1apxoio3iydfaDumnvp (0trerxfciatopDelu i;(  2tmxmpnudlltelieils)a2urx oot0optoiieiadfm2um( o u0 etnirctodfp  lnes;() rtrim3oy4lmte fei ()sDrrurp;t1aetnioeiadfa2um( on(0arxnxr3tatfmDrau olt)sexmir3nudlme lict t srum(mpot0oetn o3iatfaDrmn snt4 ltnmr to1lmDrai slt)s2xmxm nydapen fcsas  Drm( oot0oex mictatlmDrau pnt0 etoifcootlm eln ols sexrxrpoo1ap e ici s  rtrxr ;o0apeomi3ilsfa2eanvp u) rtomf oy1opDeau o (  rurim3oydlltemieslt sDraur nt0oee mfcildls emn o u4 etomoctotop e ivo (0 eum(opny1aptemiesls) Dumurp;u0aleoiieiys mDuau s;u0trenxf totlpD anvs ()teurir3io1ame micia( artm(m ;t4aee  i3ilsfm elnmp u0teeoxo iy1lmDelies ( sruo(o3oo4om   ietasf Durum ou1oex mociytlm2em(msn()arxrio to1oa  anei t srto(mpiy1apt  fvtl( s2tm(r oo4aeto i3tasfa umnmsn(4artoxo oa1om eanvo s0srtrxrpno4lm  lfct sfa2rm(r oo1aee  f3tltla2ranms u) etoio iy1oaD luvi s0s2toxr3ou1lptelfviat)sDrmx  no1aetoifciad sDemn p;()tlxoxo tydla  li o;t s2uo(r3nydom eliviatf rtau o;o1tee  o3iytls2rm( p;t0trxrmo3tydomDeaivs t0trtrxm nu4lm emivsa( aDtaumono0tpeoifciydlm2rmn p;u0texoxr iatoaDeln il()s2xo(opiu4ol emfciltf rumxmp;o1opxomo3ild a rl(vonu0trxnxfciydoa  lu o () eto(m oo1alee nvt tf 2ur( p;o1tpeoio3tydls2emu snt4altnxf oatlm r ueil(  2xo(o iydapen nvt () rtr(m nt0tlxomi3tldlm2ua(mont)tltnircio1laDeai i s) euoxo iu1ap nlnvtasfaDtaxrpoo1aleoifctls mDelu pnu4alxoirciatlmtraneo s  exr(m oodamee fctlt) rraxro;t0texo f3iadls emnmo;(4aexoxf3oy1fm eai olt)t2xrxopoy1lpee nvilt)a2tau ooo1aeeomf3iysfaDumnvonu) eeoio iodlmte n i;t  rxo(opoodameemietl( arta(moot0tlxn o3tlsfa uan sn()altomf iatfmDr ivslt)s2toim oodalee fes (  ruau pou1oeeomoctad m eln o t4aexomrcoodlaDeluvs ()t2xm(m3nydam e fciltfsrtrxr nu1aeenio3iat m2rl(vsnt4texoxr ootom rlnvi t0sexr(mpnu4oltemnvi ()aDtmx  ;u1oetnmicilslm2rl(vont)teeomfcoytom  livolt0sexoxm nudlpe  fci ( aDurxmp;t4tpxn i3ilsfaDuauvs;(0teerxfcootoa  lnes;t  2xoio3io1lpee ics ( s2trxmo;t4olxn f3tlslmDumu pnu) leoxr iodla  luvi;t0srxm(o iu1aleelnviltf rta(mpnt0alxn o3iat s2rm(mp t)tetrirctadopDelu o;s0 euoim3ny1aptn iei t)s2ua( p;u1tpeomo3tyt m2rmumpnt0tlxrirciydfp r u s () rtmir3oy1ap nmfcs t s2rmur ;o0oleoii3tldlm2emn p (0 leoiociy1fmtranes;(0 rto(mpio4llenmfciat)aDuax p;t1tlxniieildfm umnvo () renir3iydoa   ivo;s0 ruoiopnudlpee ictl(f Dua( ono4altnmfctasfaDul(mp;() lxnxfcio1oat li o t)teur(rpoudopt lfei tfs2urumpou0altomieildlmDumn p;t4 rtnif oydfptr n s;t)srumio iy1ap  mneia(f 2taumo;t0tet ioeiysfa2rmn s;u0alxomrciytfaDeliei;t)srtr(m oy4ale miei tfa2ur( poo0tltomfcias sDel(mo;()arxrxo3io1omt livo;(0trxmxm3oy4ole lnet () 2rm(m oo4alt mf3tysla2el(ms () eeomocoodlat aivo;s) 2uo(r3ou4ap elieils)arur(mooo1alxn oeiyd m ra( o t) ltnxr3oodfmDr nes;t trtoimpnudap  lnvi t srrau  ou4tlx iociaslsDulump;t4tlxnxf iodla e ueols)t2xr(mpoydopt  ieta() Dta(m ot4tlxniictatlsDrlnvs;t) etoio iydfa   u o;s0srumxm3iu1ale  fctltfartaum nu1teeo f3iyd sDulu s t)arerio iy1oa rln s;t)t2ur(o3nu1omen nesat s2trxmpno1apt iieildlm ra(von(0tetrif3ta1fmteliesls0 2to(o nu1lmtn ivs tfs2umum nt4tptoifeildlsDea( snu0treoxr3oatlmtraivilt t2um(o ny4oleemivsatfs2truronu1tlxoioetaslm rluvo t4aexrmrcoy1fmDrau slt)tetrxr3ny4lmenlieslt)srrrxmpot4altnmi3iadlaDea(mont)arxoir3oadfpDrli ols t2toxo3oo4openmnei s srtmurpnt0tetoif3ias a uanmpnu4tltnxo oatla   i ol(0t2toxrpiydaltn ivi ( sDua(mo;u1oeeo o3iysls ea(vpnt4 ltrir tatfpD anvi ()s2umxrpoo1alt  iesl(fsDtmx  ;t1tpeo ieiyslsDulu onu0 lxomocoodomD  ies t  2xm(m iudomtnlieiatfsrrm(m nt0oetoio3iyt aDuau o t4tltnmo3oadoateln i;t) rtr(o iy1am elivsl()sDrrur nt4tee moeias s2umn pn(0texnir iatoaDrauesls0s2uo(mpno1amtelietas  2tm( ont0oltoio3ilslm ulumon()trtnxrcio1omtelues;s)s2xrir iydapt micsl(f rrmxrp;t0opeo octas aDumumpnu4treoio3oydfm  lnesl()s2umiopnu1amtnmivi tfsDtm(r no4alx mfctasfm ea( p u)trxoio3oo1fpD luvils0trto(rpny1amte feils)sDtm( pnt4oetoifciltlmDeanvo;u0tetomf ta1lateln o () etm(m oudal n nesl(fa2rm(ronu4alxnmfeiyd sDul(vs t0 leriocoytlmD aieolt  2xm(m3io4amen nct sfaDumxroot0tpxnmfeias mDelu s;t4trtnio3oydomteaueols0t2uoxr3ny1aptn ncia(f Drr(moou0tltoiietls a2rmumon()texnmf totoptrliei t0 rtmxr ny1om   nvi s  rrm( oou4apxn ocildlm rlumon(4 ltoio3ootfmtean sl(0 2xrir3ny4lmeelics t  Dtmxmpoo1tle ifciatla emuvs t4 rtrif iatfp rlnvs;s)sruoio3oo1apte ietls) 2rmur ;u4teeoiiciatlm2emnmsn() reoxfctadlp e nes;s) rxmxo iy1amenmivsltfsrtm(  ;u1apt moeiasfm ea( o;t4aexnxf3oydfmDeaieo ()trurir3nodam e netl(  2uru  nt4oex iicils m2eluvp;(4alxomr3oy1faD li s s)s2xmxm iy4am emicsatf rtaxm nt0tptn oetldfsDuau onu4 exoio totom  lu ols) etrio3oydom emfvt (faruru pno1tlt ioeiad m el( o t0aeenxr oy1fm elnvo;()t2toxm3oy4lp emnvi ()arurur no1apeomo3iydfs eauvs;()teenxfcoadlat an ol( s2ur(m3iudopenmncils srraum ou0tpeo oeildla2umn on(4 etrio3oytfp rlues s)srurim3nu1opeelfci s artrxmpot4alxnmo3tltlsDem(vo t4 rermr3oytopD au slt  rtmxm ou1am e fvil(fsrrr( ooo0tex  fciltfs2em( p t)aetrmo oodlmDraieols0trxrim3nodameelnct sfs2ua(roou4aleoif3tlsfmDrl( s (0 lxnxo3iydlmt lnes;s0s2tmxo3iu4ll   fctl(  Dururpno0altnio3iaslaDra(vont)alenxr iadlmD luvi;s)trxo(opno4optn ivilt  Draxr ;o1optn i3ild s uau p (0 rtrxr3oodlaDe ies (0 rxo(opnodomeemfvsls)sDtr(  nu0teeo fetlt s2rmnvp u)arerirciydomt anvolt0trtmxo3oodllt mnvi ( srrmu p;o1tlxnioeilt sDrmnvsn(4aleoiociadfpDr i s s0t2uo(r iy1lpt mivsatfarta( pot0olxomi3iyslmDul( s u4 reriocoa1op r ues;s) 2tmxr3iy1optnliet tf ruaxm nt4tpt mi3ilsfm eau s;t) ltniocoo1fat  ies t  exm(o3no4lpe  iesat) rrr( ono0oltoio3iysla eauvs;u4 etnmr oodfmt anvs t0setrxr oo4op n ncsasfsDuru ono0aeenio3tasfa2elu s u0artnxfciodoaDraiei;t)s2toxrpno4lmtn nctlt)aDrmxrp;t1olt mo3iyt mDulnvo u4tlxnmo ia1fpteln o;()trurxm oudlpe lfeta() 2ur(mont1opt moeiydla2uauvo;(0 exoxf iy1fa r uvsl(0texrirpnudoltn ici (f Draxmonu1aee  ieiadfsDumuvo;() exrir3oo1lpteaueolt0setmxopny4apeemiet sfa2um(rp;o1opxnifetadls2ua( s;()aetnircty1lmt ai i;s0trxrir nodape lnciatfsDra(mont4tltnmo3iasfaDulumonu)alxrmrcto1fp e ieo () rxrxrpiu1altnlfvsas)arumuronu0tet  fcilsfa el(mp;t4 etnir3iytfp rlieo (0seuoxr3oy4ale micias) Dur(monu4openmf3tas m rl(vo;u0altomfcoydlpt an i () rumim no1llenmfcia( a2urum ou1tlxn oeiytfs rluvon()alxnmf3iotomt aivols) rtmir ny4ll elnvi t a2trx  ;u4tlxnmicilsfmDrln pnt0trxnxoctadlate ivs;( t2xrxmpoo4omt  ncia( sDuaxrpot0alt mictydfa2rluvo;t4 ltnmrctadlmDran olt0srtoirpoy1omenlfvi s) 2rrx  oo4oeto i3iysla ul( snt4tltriociytfp   i o;(0 exr(m nodop nmivia(fsrtaur ;o4ape  fetydlaDrlu on(0teeomr3iotla rauvs s  rxoxrpnu4alee nvsl(f Drmxm ;o1oltoii3iydfa ulu snt)tltoxocio1fa   i ols) 2xo(o ou4op n ivsatf 2urx  oo1opt io3iltlmDeauvsnu)treomfcoytfpDe nvi;( s2xmxo no1oltnmfeiat)srua( oou0ale  o3iadlaDrm( o u4alermocto1optelues;t) etrio ou4ol  mncs t) 2um(r ;t1oex mieilt a ul( p ()trxnif tadop  luvilt trumio ou1ap nmfes sfaDua(rp;o4olx  f3iltla2rmuvs (0alxrmocoo1lpD anei;() exrir io1lpe mivt t  2tmx pno4tltoifeiad sDumnmonu)tlermfctydfm  li ol(0s2uo(m iu1lmen fes s) rrrxr ou1aee iiciadls rl(vp;t0aetrmf3io1oate ieolt)t2trir3oy1lm n nvi sfsrtrx  ot1ole iocildfsDumums;u0 rtoxrctytfmDelivils0 2tr(m ny1lle mnetas)a2rrx ont0tlxn f3ilsfa2rl(vs;u4teerxf iotlat  nvo;t0 2xoxm nudlm  livi tfs2umumooo1openifciytlsDuau on(4arxomf iy1opteau ol(0 euo(m nodlle mivtl()a2ur(  nu4tpt ifeias a uln o t4arenmocoodoatrliei;()seurxo3iu4olt lict tfsrraxr oo0tlx mi3tlsfsDumuvp t0alxoiocoadfaDelieol(0teum(r3iudlp nmfesa() 2ur(m nt1optnio3iltla eluvs;u0treoirctodlmtrau s t  2trir nu1op nmivtas s2rr(mp;t4altoiieiysfsDemnmpnt) rxnxf ia1optrau sls  rtoiopoo1opte fcs ()artr(  nt0aeenmieiatlmDra( o t0 rxoxr3oydoa elivi;(0s2tmim3iydlptemnvtltfaDtrx ooo1oet mietytfaDuauvs t)tltomf oodlatr n ol(0srtm(rpou4lmtelies ( s2rrxrp;u1oetomieiys a ulu pnt4 renircia1lp r neo (  exr(m iodlmteliviatfsrtaxrono0aetniieiadlm2emuvo;t)arxoxocoodfa elnei;s srxmxm oudol   ivsltf Dum(roou4apxo iciydla2uan on(4 etomr3oatlpDeauvi;(  etoio no1lleelfesas)sDrmx  ;o4apt mietyd s ea(mp;(0 leoxocty1opDrli s s sexmim oy4alt  fvi tfartrx p;o0aeeniictyslmDelu p u0 lenir ta1lp   i sls  ruoxopiu4opeelnctltfs2ra(moot1oetomi3tld m emu s;() eermo3to1opD  ivslt0trxrim iy4ome mncs (faDumumpot1aexo f3tyd a umuvp ()altnxf3iytomtr n il()sruo(rpiy1om  liet sfsrrru pnt4aetnmi3tasfm2el(vo t4arxrmr todlmD lu o (  rtoirpoo4lmen fet t)aDua( onu1aeeo ietlsfm uanmp u)tltoio to1la raiei t)setmim iodoptn fvs ()a2rmu pou0tleoiietld aDumu sn()tltrmociodfateaiei;s0sexmxo3nu4apee fesat aDrax pnu1tex mociysfs2em(vpnu0 eeoio3iodfptr n s;(0tetmxr ou1al nmfvta( s2taum ;t1aetoiietadls2ulumont4texnxrcoo1oatelnei;(  eum(m3oy1openmfeil(fsDtau  no1oeto o3ilsfa2rlumonu0alermociatlp rau o;t0t2trxo3oy1lpt  nci t)arum(mpou1tpxnioctltfs rmn ont) rerxf3iydoa rli o;t  rxoxr3oodape  icsls)aDtmu poo0opxn feiatfsDulnms t0aetrmr3totlpDraneolt  2ur(opiydop n nesa( s2tm(mpnu0tle mocildfaDelu sn(4tetnmo tadlpDe ies;(  eurio3oo1lmtelieiltfsDua(ronu4altoii3ild mDulump t)texoxrciotfa rauvi t0seur(r3ou1lmtnlfvi sfaDtaumonu1tee moeiasfs umuvs u)aexnxf ta1fm   nvolt0 2xrimpny4lmt lnvtlt)srrau  ot4teeniiciat aDeluvp t) lxomr todfpDeauvsl()s2toxo3io4llenlnvtlt s2rrum nt1opxomieiadfa2uln o u0tlenir3tydlmt lnvs;(0texr(m oy4omt livil(f Dur(  ;u0aeto iciasla2emuvo t0 exrmf3oa1lpDe uvsl()trxmimpiu4lptemfcs t)sDtaumo;u4teeoio3iat mDeln pnu4aleoxocoydopteaivi s0srxrirpno1ll elivilt)sDtrum ;u0aexoifetlsfaDelu pnt)aexomo tydlaDrai s () 2xo(rpnu1lme mfct s)srua( ono4optomi3iydfa2elumo u4tleomoctydoatrli o s0truo(m io4lmeelicsl(fs2uaxmpot0oeeo octasfa eanmp;t0arxomrcoa1lmteau o;t0t2uriopiodop emnei s  Dra(m ;u4opx  fetlt m em(mpnt)tltnxf3ootlmD  nes;t s2uo(r3oo1ome  ivsa( artrx pot0oleomieilsfm2elu sn(0 leomfctydfa eli o;s) rxmxopno1altemnci ( arrr(monu1tleomieiyt mDulnvs u4aeerifctadomDraiei s0teto(r3oodllt  ncia( aDtaxmo;t4tpxo oetld sDel(mpnt0trxrxf iy1fpteauvi;t srtm(o3ou1lp n ieta() 2trx o;o1openmi3ilslaDra(mpnu)tlxnio tadomDeaueo t) 2tm(o oy1ol   nes ( aDumumpnu4aeeo fcilsla uln o ()arerxocoa1fmt anvsl(0 rtmxr nu4lmtemfcia()sDrmum ot1teenmieiasfs2elu o t4aeenifcoytoaDeaies;( s2xo(m io1opeemfei (faruaum nt0olxomieiyt a2rlnvsnu4trtnmf3oydopteau i;s0 2uoim3oy1apenmiesat) 2urxmo;o4olxn iciasls emuvs ()tetnxf iydfaDr uesl() eto(opiy1llenlncs (  Dtaumpoo1tpx ifctld a raumsnu0alxomo iydlpD  u s;s)s2tmir io4llt lfvtlt)a2ua(  no0olt  oetlt mDumuvs;t) eerio ty1lmte ieil(  etoim nodlm  mivs sfsDtr( p;u1oexn ocils a umnmo;t0aexomr3oodoat li s t0teumxr oo1ap nmneilt arumump;o0olx mietys aDea( onu4 renmr3iydfatr uei t tetoio3oo4lpte iviasfartmxmpnu1teto octad a2eaumont4texrio3iydoatelnvs;s)t2xr(r3iodome  iesatfsrrr(m ;u1olt  ociytfm ulnvpnu) etrio ia1fptelneo s0 2tr(o oo4oltelfesasf 2rr(r ot1apxn o3tyslm2ean snt0trenxo3oodfa rlivi;t0 2to(r iudlpt mivslsf Dtmxmo;t0aeenii3iytlm2ua( snu0tlxrir tytla   nei;s seuo(r io4olenlnes t) Drrumo;o4tlenioetldfm rmuvs u)artoxo3ia1fpDeluvsls)t2trxr3iudll emnctlt s2umxm ;o1opt  ictlt a2rmu o;(0 exomo3oodlmD aieol()s2tr(r3nodap   ictas)s2um(mp;o1olx  oeildfm2umn pnu0 etnircta1oaD auvil()t2to(m3io1amtn ivtlt) 2umxmonu0apxoifetatlm2rmnms;u4aeerxo tadfa  lnvi;s) rurxm3nydllenlieia() rrrxm nu4tpenmfetadfsDra( snt4tltnxoctytlp eau s ( t2tmxo oodapt livsls aDrr(  ou0tee ioetydfm2umnvsnt4alxnxf3io1fm rai ils srxr(m io1lltn nvs ()aDrrxmpnt4tex  fetlsfm2raumpnt)arxoifcto1fp ranvs;t teurxrpiu4om   nviltf Duaumpot1tle  ictat a2rluvs t0 eenxo3tydfaDelueil( srtmxopio4lmtn ivsas) rtrxrpnu1oetnmoeilsls elu o;t4tltrxo3to1fptean olt s2tr(o3oo1lltelivt (f Dtrurpno0oeenmf3ils s2emumsnu4trtomr oydlateauvs s)truo(opio4oltnlfci (f rumumo;u4opeomf3tydfm eau s;(0trerio3ta1oateaivs s)truo(mpiy1omt  fvs t)sDumumpnt1oltoio3ilt m ean o u0tlenxf oy1laDelnvs;s0tetoir iu4alee nes s)a2urxm ;u4opxnmietls a2rau s;u4 renmf3tadfp eaivi;s0 2xrxr io1lpee ivsls) Duaxm ot1alx mf3tyd m uanm
\ No newline at end of file
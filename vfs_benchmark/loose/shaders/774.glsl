@@ -0,0 +1 @@
+nvils  exm(m3iy4oleemnctatfaDra(  ;o0olxnmfciadfa2el(vs ()aexrxo3iytomDr ivols)setm(opio1llt  ivtlsfaDua(m no1tltomietad sDuauvp t)altnifcty1lm e uvi s texmim iu4ole licsltf Dtaxrp;t0tptoio3tys m2el(vo;(0trtniocoy1lmtr uvilt s2xmiopio1lme mies s)aDrrumont0altomi3tlslmDel(mp u4tleomrcoadfatr i i;( t2xo(o3nudamtn feiatfartaxmpou1texnifeiysls2el( p u)tltrif tadoatrluvsl(0t2xrio3ou4ape  ivia(fs2tau  ot4tlt mo3ildfaDrmuvon(0aetomr3tadom eai o;() 2uoio3io4ol  lnci s) Dtm(rono4tltomi3iys a2ua( p;t0 lxnmfctydomt  nvo ( s2xr(opoo1lmtemfvi s)a2tmu pnu1opto ietydlmDrmnmpnu0texomocoa1omtrauvo;t0teurio3io4am e nviat)sDua( pnu0tex iictaslaDumump;t4tleoxrctatomt lies ()seum(r ou4llee fetl(fsrrrx onu1tptomoetadls2elnvp;()teeomocty1lmte u o () 2tm(m no1olteliei t arumuro;t1aex mieiytlsDel(vp;t0 ltnif oytlmDeanvi;()t2umimpou1lpen nvi (fs2umxrp;t0tee  oeiadlmDrlumpnt0 exoxf3ia1laDe u ols0 rtmir3iudlpee ivt tf Dtm(r ;u1aptnifciat a eaumo;u0areomociatlmDeaies;( s2uoiopoydlltn fvils)sDrmu  ;o4aptnmf3iydfm2ra( on(4 etnxf ia1opDrli s;( t2ur(r nodom nmfes tf rtaxm no4oexo o3tyslm uln o;t)texnif ia1oaDrluvil(0t2trxm ou1lpenlfvi ( sDrru  ;t1tpx mfctytlm2uanmp t4 ltnxf3tatop elieols0setrxo3nudlltelnvs ( aDum(m ;o4tleomo3tysfs2emumsn(0 ltomocty1oaDrauvs (0 exoxrpio4ale  fvt t)sDrrumo;u1olxn o3ild s2emnvo;()treoif iytlm raieil(0seuoxr3nu4lmen icsl(faDtaxronu0oetoio3ilslmDrau pnt4trtoio iodfmDeauvol(0seurxrpnu4amen fciasf rtr( p;t4tlxoio3tadfs2rlnmp t4teenif3ia1oaDr neils)tetmxrpiy4ap elncs t srtmumpno0tlen ietadfmDul(mp u)tltomf iydla  anes;s)srtmimpoydoltelnct sfartru o;o0tptoioeiat a em( sn(4 reomr oatlatr nei (0teuoxm3ou1amt mnvtl(fsDrm(m ;u0alxnif3tasfaDulnmsnt)texrxo ootfmDe ueil(0sruoir3nudlmt  feiat)sDumxrono0oexn o3tat aDrmnmpnt)alenmrctytfpDeln sls  2uoxo oydaltnlnvs s sDrmu  nu1tpeoiiciadla2umump (0tlxrirctodlaDrli s;s)sexo(o3oo1aptelfviasfarumum ot4olx mo3ilsls um(mp () lerif3oadoaDeai s;s)srtmxrpiy4am nlies t  2taxrpoo4optnmiciyt s eluvont0 exomr iy1lmtr n sl(0 etmim ny1lmt lfcs tfa2raxmonu0apeomieildfa2um(monu)alenmrcoy1fp eli ol(0srtrxrpnodam  licsl( sDrr(  nu4aetniociltfmDran p;() ltoxociydfmDran o;s)srtmxm nudll nmfci t s2tmx  nu4aexnif3tld aDuaump u)aetnxrcto1faD ln i;( truo(o oo1op nlivs s sDrr(mpnt4tltn feiatfa ra(mo;(4 lxoxr3ootfpDr uvsls0setmim nu4ap  lictlsfsDra(mpno4oleomfciydfs2ul(vo u0tltnxo iadfm   uvi;s0s2umim3iudale lnetlt) rumum nt4apxo oetytlm uauvp u4aeeoxr ootlp   uei t0teumir3nu4ame mfvtlt s2ur( pnu4apto i3ilt a2ra( o t0areoir oytlm rlueilt0truo(mpou4ole miei tfs2tm(rpoo4oleoifeiasfa2ra(vpnu)texrxrctytfp  aiei;(0srumxm iodopt  ivsl()s2ta(ront0tlx mo3iyd m elu o;u4aeeoirciytoa rlnvo ()seuoxopiy4apenmfct ()a2tax  ;o1aee io3ildfa2rl( p;u4 rtoiociatlmDrau o ()srxrimpiudopee ivslt  2rax ono4oexn feiatla el(mo u4arenmo ia1op elivi s0tetmiopoo4lmtelfcta(f Dtmxm ;t4aetomociydlsDea(vo (0 rtrmocty1lmtrlnvol(  rxrxmpiydapenlfctls)a2ua(  oo0tpt ifctld s eau onu4arenmr totfm  livo;()truoio3oydaleemfvi tf Dtmxmoou1oleoifctlslaDrmu p;(0 rerir3ta1lmt aivsls  rxrxopoydole livt sfaDtmurpou0ope mi3tysla ean p;u0trtrmo3tatlpDrlnvs;s0teuoirpiydom nlneia()aDta(  oo4alx  feildls2rm(von() ltnxrcia1om  lu ols s2ur(o3iy1alt lfvtas a2ururoou4alt miciyd aDrlu o;(4tlxomr3oydlaDelivs ()texrxo nudlptemfesltfa2ua( p;u1texnmociyt m ranvs;u0tlxoxo ootoaDelieo;t  euoxm3nodaltnlictat  Dtr(root4aet  fetatlmDranvp u) rtomocoo1fmDr nei;(  ruoxr3iu1oltn nvia(  2taxmont4tltniietlsfa emnvp u0texnif iy1lp rau i;()trxoxm3nudlltnmfetatf rumuronu4oetnmoeiat s ulnvsnu0aexnmocoatomDranvsls)s2ur(r3iydal   feias)sDrrum ;u0aexnif3iyt sDrmnvp u4tetnxf3oy1lm rau o ( teum(opoydlm e fcsasfsrtmxr ot1tetnmociytfaDuln p;u4tleoxocoatlpD  ivo s0seurxr oydopt lnetasfa2rr(r ou4altnifctaslsDrln p;t)aexnmf3to1lpt lu o s)texrim nydal  lncil( artm(m ot4tleomfeiad mDean o;() eeomf tytfm eluvolt) 2xm(rpiu4om n nvtat  rua(rpnt4tlt moeiadfs rl(vp u4tetoxr iytlmDrai s;s0 exo(opiodalee ivtlt a2ur(mpnu1oexoif3tltls eln p;t4tlxrifctotlmDe nei s teurirpnydamee feilsf Dururooo4oex  icilsfmDrlump;()teenmo tytlm eln o t0trxmxm oy1lptemnetas)srurxr ;t0aetoioctydfmDumump u)aeermo iatfaDe ivs;t) 2tmxr io4oleelieils)srtmx o;t0aetnmf3iaslm el(vont0alxniocto1oaDr u s t)srxrxmpoodopeemfcta(fa2ra(m nu4apxnmfctlsls ulu s;t4 rtoxo3iotop eauvo;(0s2toim io4lle  fet s)sDtr(r oo1tptn o3iys a2uln o u4aexrif tadom ranes;t)setriopnudom nlnvilt artr( pot0ole iietydla2eau o;t4tltrmo3io1fp eanei;(  2umxopoodlmtn ivt s  2rrumpno0aexoif3ilsfm umums t0tlxrxo3iadfpt lu i;t0 rxr(opoudopte nci () Drmum nt0tee  feiat a2ra(vs u)tetoxrciatfm r u sls t2uoio nodamtelivias s2umum nt1open ieiad sDea( o;u)trtrxf3oatlpDr i slt  2um(o oy1lp  mnvsls)aDtmxrpno0oetnmf3tad m rauvp;u0trtoirctadlmtrlu sl()tetr(opoy1lptelfcs ()a2umx ono0oeeniicilslm rmnvo t4tlxrir3ty1la e ueo;t)s2urxr ny1lmtelfvsls  2trxmo;t4teeomoetatls2ra(mp t0arenmf3oadop  aivs (  2xm(r3io4om nlfcsl(  Dtmu pot4aet mf3tldfa2uluvpn(4 leniociotfpte i s s seurxmpoodapt lnes t)aDtmx ont0apx  i3iysla ra(msnu)alenxo todlpDraneols)s2xr(rpiudap emnvil(fsrra(r nu1aleomociasfa eluvpnu4teermf tydlmtrli i;t0 2xr(r3oy1lmt lnetl(fsruau  ou0olenio3iasfmDrm(msnu)trenif ia1oat aivo ( t2xmxopiudope lfvs tf rurx  ot0aet mfetldls2eau o t)trtrxr oytoa eauvol()trxoim3io1lm elivs t s2raxmono1tpxoif3tydfsDuan o (4 lenmf to1fp e i o t0 rtm(o oodll elnctat)sDtrxr no1oet  fcils s2emnmp u0aetrmo3iydlat au i s)trxr(o3io4lpt  fvt t)srur( oot0oeenif3iysfaDrmn o;t0 reoio ia1lmD anvilt0texo(o nu1lptemncsl(fsrtru o;t0oltoioetaslaDuanvo u) rermoctytomtelies;()sexr(o oo4lme lfctat) rtaxrono1apto oetltla eanvo;u)artrio oodlateauvi ( trto(rpiodlm  lnci ()arta(ro;u4opx iictld aDeau p;t0 exrircoa1oaD anvslt)trxoxrpoodap e nesas aDtmx oou4oleoiiciltlm umnmo () reoio3totop eln i;t0trxrxo iodole mfvta()arrrum oo4aleoifciadla2raums;(4 rtrifciydfmte i o t0s2xmxmpnu1amen ici (  2umumo;o1tpe if3ias s2ea(vsnt4 rtrif3iatfm rlu o s  rurxmpiy1ale mivsat)a2rm( pnu1tlxoif3tldfa rlnvont4 leoxrciotlmt luvi ( seurim3ou4lptnmfeia(fsDra( ooo1tpx mfetydfa uau ont)tltrxrctodoa  au ol(0srxmio no4om nmnesa(  rrmump;o1oetnii3tatlsDranvonu)tetrxfciatoatr n s;t0tetmxo ny4ap nlfesasf 2ua(  no4opx  f3iltfs em(vp;t)alermfctadfaDranei;s trxo(opiydol n ivia( a2trxmoot0oet iicias s rm(vs u) leoxocootoa e ies;(0s2tr(r3iy1lm  mnes () 2urum oo4aeto f3tld a elumpnt)altrxr oadfaD  u il(0t2toir oo4lltelneiasf rurumpoo1texoioeiaslm emnms;()arenioctydlpt an ilt trtoim3nudlltnlfci sfa2rrx onu4apx mfetys s2ua(vo;t) lenmo tadfpD ai i;() rxrxr3oo4amte iei s aDraxm ;t4ope mf3tys m rmuvs;t4 ltoif iatoaDrli o s0srum(opoo4ome mncs t  rra( pou1ale iictltlsDua(vpnu0teenmociodfm   i i;t0srtmim3nudalt  fvs (  Dum( ont1apxniiciadfsDeanmpnt0alxoiocoytfm eaivslt  rxm(r3ou1ope  nesat)artmurooo4tptnmoeilsla umnvsnt)arerxfcoydomt anei s texrxmpiudomeemneias  rtmuro;o4tpt mociydla2um(vo;t) rxoxfctadlp ean i (0teurio3oodope  neia( aDtrumpoo0teeomoeiasfsDulu s u4aetrio3to1lpDr ueol( s2tmxm iudlp   fetat)s2rrxm oo4tlt mf3iydfsDrm(vp u4 eeomrciydomt aivol()seto(o oo4altelneiat sDta(  ou0aexoii3iat sDem(vo u) rtrmr3tadfaDraues;( srtmxo oydlptnlncs tf 2rmxr ;u1tltomi3iadfa2ua(vs;() rxnmr ta1omteaivs;s  rxmxm oy1olenlfvi () ruaur ot4aeto ociasfm ra(ms;u0tleoif tatfmt  n i s)truoir3iodal elfvtas)arrrumpno1olt ii3iad a ranvo (4 etoxociy1oateaues;()s2urir nu4lle mnctat) Draum ot1tle ifctls m ea( snu)teenxo totlaDr nvs s  rxmxrpny1amte fvi (farua( onu4aetoioetas a2uaumo;u) rtnifctadfp r i o;s)srxrimpnudlltnmics ( srta( o;o0oexn feias sDelnmpnu) lxrxr3oa1latelnvi;s)trxm(mpoydlptn ies t)artmxro;o1optoifeiydfm2ul(msn(4 ltoircoatfaDeau ols0setriopiu4ope lfetlt)arurur ot0tpenmoeiad a2rlnvont4 eenmoctytla e ivi;t setrxopoo1lle mnvsls aDurxroou1oex mociaslm ul( s;() exrxf oydlaDe ivo s0sruoimpnu1olenmfet () rraxmp;o1aeenmfeiytfsDra( o (4treomociodfmD ln i;t trto(opoy1altnmicsas)a2ra(m nu1tetnifcilt m elnmo;(4 etrircoytoa   n sl() 2ur(r iodop   ncs ()sDumu  nt4tltnmfeild a rmuvs t)trtomo ty1om ranei t)teuoxrpnu4alenlivia() Drmxrpou1opxn oeiysfm uluvo u0teenxrciotfmtrlieo;t)t2xo(mpny4ol e fvsat)srum(rpnu4oeen o3tatfm2rluvs u) leoxr iadlmDranvs;t) 2xmxm3nu4oltn ics (f rrr(ro;o0opeoiiciasfm uluvon(0tetnxr3totoa e iei s  rtm(o3oo1lp  mnvi s  2raxm ;u1olto ociys s el( s;t0aetnxo oa1lptelivolt t2urxm oo4apt lfei t arrau ono4olenmictld aDua( snt4teeoxociydopDraies;t) rxoxm ny1olenmnei tfsrtmurpno4oltnmi3ildfsDrlnvo;t)aexomf3tadoaDeliesl(0s2xmir3iudop e ieslt)s2raxm oo0tltnii3iys m ra( p u0 rxnmfcoytlmD li s t0trtoxopoy1ll nmfet tfa2uaxr no1tetomi3iatfm emn o;() leoxf ty1oa elu ols t2tm(m nydamee ivs (f 2rmx o;o1apeniieiatlmDra( pnt)aetoxo3iodom  aiei;(0s2xoxo3oo4lpe lietl( a2tru poo1tpe mictyd mDrl(von(0tetnio3oo1latelu i t0s2to(mpou4lm elfci ( aDtr(m ;u1oeeniocilsfaDrln s;u4altoif oa1oa   ieols)sexoxm oo4olen nvsl(farua( onu4opt mo3tlt s2ran s t)arenmr3iydlpDelu o;s)srxrir nudam   nesat) 2rrxmpnt4apt io3iysfaDuln s;()arxnxo iotfp rlies ()s2uoio3oo1omte nciltfa2uaxrp;t1alto oetad s2emnmon(0tleomrcoatoatrau sl( s2tm(r iydlpeemictlt sDta(mpnt0ole mfctysfs2elums ()alxoif3oytfpDr i i;(0srxmxr nodlm n fetas aDra(ro;o0tlxn ociysfm rl( pnt)alxnxo3oytomDe i i;( setmxm3nydoltemnei ( srum(rpoo0apx ifetasfsDrl( onu0texnif3iytom eluvo;(  rxrxo3io1ame mnvtasf Dtr(r oo0tpx  fciyd sDuaums;(0alxoir3oy1lptrln slt0trtoxm ny4apt lnciat)srtm(m no4oltnmiciytfaDemnmp u0 rxomf tydoptrluesls s2um(m3no4ll   neil(farur(mooo4tlxoioetlsfsDra(vpnt)arenircoydlpDe i sls  2xrxopoy4lm  mfvs t)artrxmp;o1oltnii3iadlmDelnvp t) lxoxf3ia1lp  au o ( sexoxm3ou1amenlfeiatf rtmu p;t4teeomf3tldls ea( ont) lermrcoatlpDraivs;t0s2trio3io4om n icils aDrmxm ;o1apx  ieias a ul(vpnu) rxrmfcta1fmD aieo;s) eumxmpoo4al  mnctl(fa2ua(rp;u0aex iiciatfa rm( p;()arenxf oy1omtraivo;t) eumim3ou4olee fvta( srrr(mpno0olxnmfeiyd s rl(vo;u)aeeoxrciotlm r uesl(0teto(m3nydamenmicsl()a2rrxroot0alx iocils aDua(ms u4aeeomf3oa1opDeanvo;()trtrim ou4lpe  fvi ( a2taurpno4aexoii3ils mDuaumo;t4aeeoxf ootlmD  iei (0 exr(opny4omtemivils sDrrum no1oleo f3iadfsDelump t4 lxnir io1faDrluvils)s2trxr oydll n nvslt s2ta( pou4optnioctad m rlnvonu0 rxrmr3tatlaDr uvol()s2xrxo3ny4apenlfvslt)a2urumpno1tpxn i3iltla2em( p u0tlxrxr3todfmDrli olt)sexrxm3oodop  livi sf 2um( oot1tpxo f3iadfa2elu pn(0 exnmf oydfa rai il( s2uoio3oudlm n iet s)artrurpou1aeen ieils a2uaump;(0 eenir io1fm r n s s tetr(mpiu1lptnlfct tf rtrur ou4optomfciydfa2ran ont4trerir3oa1fp elneo ( sexmxopno1ale miesl(farrmu p;o4oeen f3iadlm2uluvpnu0artrxfctydfmDe nes (0 euoiopou4ll   fvsl(  Dtmur oo1aexomoctlt a raumpn(4trtrmo oy1fateai i ()trtrxm oo1op emfei (fs2rrxm ou0ape  ociysla ran o;t)alenir3io1om eai il(0srtmim3iy1lpee fvt t)a2uau oou4openmi3ildfs ulu s (4teeomrciotoatrauvils)trtr(o3io4lpt  ieta()sDta( o;u4oee if3ilsfm2eln s;u) leomo3oytfmDrlivsl( tetoimpiodoltnlnetas sDrmurooo4olx iieiytfs ranmp (0alxnmo iatfpDe u sl( seum(r oydaltnlnetl(  2urxmp;u4opxomfeilt aDra(mpnu0alenxf3iatlatrliei t0srxrir3iu1alee iet (f 2tmumpou0aex ifciytfs emnvo;t4tlenxf3iatomD lueo s)teuoir oo4ll  lfeilsfsruau ono1apxnmi3iaslm rmnvont0tlxrmr3oydfp rli o ( s2xr(r ou1oltnmivtlt  2tmur ;t4apenmiciasfs umn onu) rtoir io1omDrli ils tetrim no1lme mncsat  Dra( ooo4oeenmfciasfa ranvo;u4 etnio todlmDeauvi s)setm(m3iudllenlfct s)sDuaxrpnt4ale  feildlmDrmu pn(0 reomf3tytlaD au ols)tetr(o3ny1apt micslt) rumu p;t0tlt mo3iadfm ranms;(4teermr3ia1lptr ivs ( trtmxo3nudalee ictat aDrmxrpno4oetoifcilsla2eanmsnu)arxrxr oodoat  uesls0texo(o oydop   fcsa() Drm(mp;t0apx  oeiadlm um(mpn(0aetoioctydlptelneo (0 exrxr iudapee ictl(fsDtr(mpoo0oltomfeiytlmDemu s t)trtnmrcoodoatr u sl(0trum(m io1ale mnet t arumurooo0tpx  feilslaDrl( p;(0tleomo oodlp r ivil(0t2tmxm3iudamenmivtatfs2rrx o;u4apt  f3ilslsDuanvsnu)artoxf3iatfmteluvils  2xo(o iy1ll nmnvia()aDraxmooo4opxo feilsfs elu p () rerifcia1fp  auvi t0tetoxmpoudaltnlfet (fsruru o;o4oltnio3iaslm rlnvs;t0tltnmr iydfm rluvilt sexrxopoodll n neta(fs2uru p;t0oeen ietltla2elnmonu0tetnifciydla eanes;t0 2toir ny1amtelivsatf 2tau  no1aleoif3iyslm emump;t0 reomfcoy1fate n il()trtrxrpou1lm elnvilsfsDtm(r ot4oleomf3tasla ea(mp t0tltomo ty1fp rlies;s  rxmimpnu1amenlnvtlt aDrmxm ;u1aleniiciat aDum( onu0alermocty1lmteau i;()seum(o3oo1omtnlfvt tfarur(moot0aetnii3tlsfaDelnvpnu0altnif to1lmtrli slt0tetoiopiy1am nmivs sfarurx ooo4olxn oetasfs2ulnmp;u)tleomf iy1op eaneslt)seur(o3iudll  liviatfaDuax o;o1tpxnmocildls em(mo;u)trxoxr3iadomD auvils texmim3iu1al  lies ( sDrrx p;u4aleomf3tysfa2rlums;u) exnmf3tatom r ivilt)srtoiopoydol n neias  2rr(monu0alt miciltfaDuauvsnt0altrmf tytla raneols)seur(rpnu1al elneta(fa2tau oou4tpto i3tyd s2rm( o () rermrciatlmte u olt)srxmio3no4apen nct tfsDtmx  ;t1tltnmoctysfa2uluvp;t)aetnxrcoy1oa  aneo;t trur(mpno4al e ivslt aruaxmpot1alen fcilsla eanmon(4aeeomocoa1fa rlieo;s  etrim3oudale liesatfa2rm(mpot4ope mfciad mDrlnmont0 eerxr oydomDraies;s)teto(opiy4lltnmfvslsfartmumo;u0tpxnifeiatlm2emuvsn(4trtomf iytoatr ies;(0trtoio ny1lleelnvta( aDrru oot1tex miciat mDra(vont)aleoifciotlpte ivi t) rurxr3ou1lp  lfvil() Duaxm nt1aetn ieiysfa uau sn(0trxrmrcootfpt  neolt) eto(o3ny4ole mfviasf rur( o;o1ole ioetlt m em(vsnt4 lxomfcoo1lpte i s t) exoir3ou1apee ictas) 2um(mo;u4altnmfeils s umn p (0tltoxr oytopD lu s;() rum(opiydamtnlfetl(fartmumo;u0aee ifeils a2uau p t0 eerxf iatom rlues;s) 2trxrpoo1ap nlici () 2ta(mo;u4oee  o3ias s2umuvpnt0tetnxfciotfmteaieo;(0teuoxo3no1lleemivt s) Drmx pno1olto ociaslm2uan onu) etnirciodoptean o s) eur(m oodomt  feslt)s2tmx pot4oee  f3tltfm rlnvs (0altomf ootopD livo t0 exrxo3iodoltnmncs t)artax pnu4oetoifeils m umn s u0 rtnmo3tytlaD lieolt) 2uoim3ny4lp e fvsa() 2ta(rpou1optn ocildfm2eauvo;()alenxo3iotoatr nvs (  rtrir iu1ap  mnei (f Drm(  ;u1tptnmfciydlm2rluvsnt0arenxf3oatopt aieo (0t2xoim oo4lpe miet sfsDurxmo;t0aee ifeilsfsDuau pnu0tetomf tatoa e n s s)s2urxo nu1alee nvsls) 2um( poo1texo ociadfsDel(vonu) rtnmo3totfp r ueilt s2xo(r iu1al e nesl(faDrr(mpnu1tleo ociydfmDua(mp t0 renxr3iytfmtr ueslt0truoirpoodape lfetat arrmur ot0aex  iciasfm2umuvp;u0 rtrxo3to1om   nvs t0srxr(o3iudomeelnvsat a2rmump;t4opx  fetad m2rm(mp (4 leomo oy1omteau i;()s2tmxmpny1ap elfcia()s2trxmooo1tetnmietlsls el(mpn(4teeoxf iatopt luvsls s2toim no4am nmfcil(  Dta(ro;o1optomiciatla2ul(vp;t4 ltoio3iodoptrlnvolt)srurxr nudlm n ivi t  2um(root4aeenmociysla rl(ms (4 lxrir3iytfa e ies;s  2xrxm3ou1lp   icil()sDtrurooo1tlen f3iatlsDuluvon(4aeerxoctydomDelivo;()trxmxm3nodom n ivta()sDtm(mooo0olenmo3ilsfsDranms u4tlxnmrcia1la e u olt) rtrxo3ny1amenmicias)s2rau  ou0opt  fetasfaDem( o ()aeerxrcio1lmDeauvsl(0teurxo3oodlleemiei t)srrmu p;u0aexomictyt mDrl( p;(4arerirciadoa  li i ( seum(m3io4lleemncs t aDrr( ont0tpxn octas sDelumo t4trxnmr3ta1faD ai ils0s2umxr3nu1apt mfcia()arumx pno1tlto o3tadls2elnvsnt) lxoxo3oadlm elnesls)srxmim iy4op elivil(f rtrum oo1oetnmfctad sDulumont0aeerif3iadfptrau sls seuoxo3nodlptnmictlt  Drm( ont1opeo o3iltfs2uanvo u)teeoioctydom r i sls s2xoimpiodame lfcias srurxm oo0olenmo3iatls2em(vs u) lxrir oatlp rluvs t0teumxm3io1ope  nctl() Dtmurpou4oex  ictls a rmn p;(0aeeoxr ootfat  u s (0 2toxmpou4ameemfcil()a2uaum ot0oexnio3tytfm2ulnvo t4 rxoirctodfa rlu o;s srxrxrpoydop e net s srtrxmonu4olenif3iytfs2eln o t0 exriociy1opDraneo s)s2tmxm3nodal nmivsa( sDur(mpnt0tpxoii3iad m2uluvs;()trxrmf todoptrai s s) rtoimpnudal n feta(fs2raxm nu4olx iieildfsDrmnvp;() exrxfctadopt  ueils trxoxm iydlm   ietl()srrmumo;t4texoioctls aDrlnmo;u4 reoif3iytlmteli ols0teumxopoy1llenmict t)sDtrxm nu0oexo ieiadfs uau s;u0tetomociodlpDeaneol()trtmio3iy1om eliei t) 2ur(ront4tpeomoetltfm rmu s u0arxrmr3iodoaDrlivolt sexriopnu1omtnlfet s) Dra(mpot0ale ioctysls2umumo;()areomo oodlmDe i o t texo(mpio4optelnvias) Dum(rp;u0oee ii3tyt aDua( s;()aleoxo iy1lptrlneo;t0 2toimpio1lltnmnvt t)aDum(r no0tleoiieiyd m elnms (0 rxrmrcoodlmDe uvslt t2tmxm oy1lmt licslt srrm( p;t0aeeo icias aDra(mp u4 etniocoy1opD auvo (0sexrxr3oudoptelietls)s2ra(moot1ope ii3tltfa2emnmo (4tlxnmf totlmtelnvi;s s2xmxrpoudom elfei (f Dra(mpno0apt  ieildfa2rluvs;()trxoio oydoptr i s t srxrxr3oy1lm nlfcsls)arurxrp;o4altn i3ild aDul(mp u0 exomf ty1lpDeli i;s)srxoxopio1lmeelnet s artaxrpou0tetoif3iltlm2rlnvo;u) lenxr3totoate ivsl(0s2trxo3ou1op  micil(f Drr( p;t0aexomfciat s2elnvs;(4trxnif ta1om rluvo;t  rxoxrpiudop  mncsltfs2rrumo;t1alxnmo3tad a2rmuvs t4arxoir3ia1omtranesls  rtoio3oo1op   fvtls s2rmur ;t1texomocildfs rluvp;u)altrmfcio1omtelu sl( teurxrpio1omeelnesl(fsDuaumpnu4tex  iciydfsDeau pn(4treoircoatfptr ueols  euo(o3oydllenmfvtlt  Dururpno4aetn fciytla rlnmp;(4trxrxo3iatfpt lnvs;(0sexmim3oydll  mfvtatfaDumuro;o4alenifctysla rl(msnu0tlxnxf iotomtr uvi;t texm(m3nydolee ies s  rtaxmp;t4aetomf3tls s uln s;(4 rxrmf oadfa e iei;s0 eto(opoy1llen ieiltf rum(monu4ole  f3ildfa2el(mo;t4trxrir3oa1la   n i (  rumio3nudolte fesl() Drr( pot0apxomoctlslm2ranvp () ltnmo oatomDeanes s)srxrxrpiu4lpe lnet ()srrrumpou1oeen fcild sDua(vpnu0 eenmr oa1laD lnei;s) exrxmpiudal  lnvsat)srtmxr no4alx mfeils m emnmpnt4aexomf3tytfptelneo s s2toxr ou4ll nmicsltf rrrxmpnt4alxnmicilt s rlnvo (0alxnxrcta1oate ivslt)srtrxm3iudap elncsa(fs2rr(moou4tptomfeiat mDemnvp;u) renmo3tadfatelu o;s s2xrim3oudlptemnctl() rur(r ;u0tltnmi3iydfa2el( p u0texrmr3oo1fpt an o;(0 rur(mpnydamte nvtas sDuax poo4oeto f3ilsls uaumo;u4aexrmrcoytfm eliei t) exm(m oo1op   nciat srrru p;u4aptnmfctad a ea(vo u0trtoxo3iadla e ues;s  ruo(opio4olenlnvsas)sruax  nu4alxo oetatlm2rm( s (0arermfcio1oaD aiei t)s2tmim io1lpt  iviltfs2umx pnt4olx  oeiytls2elu pnu4tetnif ia1omDeaivols0 etmim3oudamen fcsltfa2ta(  nu1oexnmoeilt a el(mo;t0 lxnmrciadfp r nes;() 2uoirpoy4omenlics s)sDtaxro;u4olxnmfciltlm rl(vo;t0 etriocoatopt livi ( trtoxr nodlp nmncsat a2tru  ot0opeomictltfa2rl( ont4arermr oo1omt lnvi t0teto(o3iy4om  mnesa( aDrrxr nt1teeo f3iatfsDraumpn(0 exrxfciydlmD aivs;t  2xrxmpio1al   nesa(f rtm(r ou1optomoeiat sDeluvo u) reoxo3oa1lmD ln s s t2tm(r iodal nlnetls aDuaxrpou1tet ii3iad aDuln o;t0 etoxoctotomDeluvsls) etrim3ny4ol emict () rumurpou4opxnmieiatfm ean snu0 eeoifcto1omte uvi;s0texoxrpnydlleemici t s2tmurp;o0tltnmo3tydfs2eaump;t)trtnmf3tydopD aieilt0seur(r3oydlpt  nvtlt)sDtm( o;t0oex ii3iyt s2rlnvp u0 renmfcoadoaD  n sls s2ur(m nu1apt mnvtls artmxrono1aetnmf3iadfmDua(mp;t4aeenioctytoaD  u s t0setmir3io4lm emnes t  Dtau pou1tee mfcilt sDranmsn(0 exoif iy1lm eln ilt)trtm(r iudape  iciat)aDumurpou0tetoifeiat mDuauvs;u4aexoif3oydlatr i s ( sexmirpny1ap  mivia()s2urxm ;u0opeomieiadlaDelnms;t0arenio3oydopt livo s0trxo(r ny4ameelnvsl( arumxmo;u4tpx ii3tas m2ra( snt0 exoxr3oodoatrliei ()s2xoio iydalt  fcsls)sDumx ono4teeo iciytfa2ea(vo () etnmfciodfmD  i s t0t2toir3ny4llenlnes () rrmur ot0oex  f3iltla2ea(vp;u4tetnxf oatlmDeaivs t0 rtrio io1lpt mneslt sDumxronu1tltniictlsfa2emumo t)tlerio3totlatrlivs t)setrir3iu1olt  nei t)sDraxro;u4aptnif3tltla2ulumpn()alxoio todop rluvo;t) euo(m3no1op  livi (  Dtm(mono4apenmfetatfs2ranvo ()arenxoctadomDr n ils)teumiopoy4alt mnciat) 2rr(r ;o0tpen f3iydfa2eaumo;()tlermo3ootfpt ai i;t  rum(m3ou4ole livtlt) 2trum oo0altnmfeiasfs2umnmo t) eeomo tadlateluvi;t texmxm3oy4lmeelfvs sfarrax p;t4opt iociysfs2uauvon(4altnmocoydoa r ies;(  eur(m oo1lpt  ieia( s2um(mpot4aee  ietatls ranvp;u4trxniocio1oa rli s (0s2um(r3ny4ll  lnvia(f 2trump;u4aexn iciaslm ulnmp u0tetnmr oy1fat ln ilt  rtr(mpnodlm nlivtas) Draurp;u1oet ifeiadfs rl(vonu4alxrmrciotlmD lnvs s)t2urxm oy1omenliet s aDtax o;u4alt mictyt sDua(mpn(4arxnxf3ia1fa  li slt) 2tr(m oy4om nmfvi sfsDtruront4oltoii3iat mDrmuvs u)arxoio3todoatrluesl(0seurxopnu4aleelivsatf 2rmxm no1tlen ieiadlmDum(vont0aeenxfctatla eai s ()srtoir3nodomenmfvtatfsDuau oot1alenmociysfs umnvs u4altnmo3oatomDraivi;( sexmxo3nudamtn fviatfsDrrumoot0aptomociad m emnmp u4arxnmr3tytla  liei;s0sexrxr ny4om  mnvtat)aDrmx pot1ale iiciyt a rl(mp u)aeeomocoy1lmtr n ils)srxmxm3iu1lmeemnvt ()a2rm(  nu0optnmfciatlsDul(vont) rxoxfctytlmtelueo;t trur(o3iydlme  fcs (fs2rmxmp;u0altoifetltlmDulnms;t)arxniociadfmtrlnvo;s teurxm3oodlle  ivt (fartauro;o0tpxnifeiltlm rluvp;u) rxnxrciy1fateanei s trxoxrpoudlptemivsltf Durxrp;t0ope iiciltfm2eluvsn()alxomocty1fpDeai s s  2uoxr iu1llen fvslsfsrrr(rpnu4olx ifciad sDumuvo;u) lerif tydomDelnvs;( s2to(opiodal n fvi t)arrrumpot4tle mi3iadls2umnvs t4teeomr3oytoaDelnvi s t2tm(opiy1lpenmneias)aDtmumpot1opeoio3iaslmDuaump t0 rerxr tadop   nvolt)s2tmio iydlm nlnctls)aDrmu pot0olxoifciydfm2rm(vpnt0altoxoctytlm eluvo s  2xrxr3oodol nlneil(  2trxmo;t1tlxomociltla eluvs u0trxnxr3oy1fp ranvi;t0s2um(opiu1lmt mfet (farrr(rpnu1tpe  ictls m elnvo;u4tlxrmo ta1omD  ivil(0trurir3oo1lmenmivi s a2um(ro;t1tlxn ietydfa2uanvon() lxoxo tytfmtraivi t s2uoxopoydomtelfvsat)arurxr nt0optnifeiyd s2ranmo;t0 rerxo3oodoa ranvsls0 2uoxopiy1ame lncsl(f 2ua(r nt0tpx ifeiad a2emn o t4texrmfctytoatrln sls srumir iudlltn iciat s2tmum ;o1tpeo i3ils s2rmnvp;u)altrmr ty1la   ieo s)sexr(mpnu4ll  mfvsls) rum(m oo1opeoif3ias m uanvsn(0 etoxo iytlat an s t)texmxopiy1om nmicia( artm( oot1oetnmietldfm eau onu)aleomfcoydom  luvo;t) 2tmio ou4ll emivt s) 2taum nt4teeoioctat m rauvs;(4texnxr3ta1faDrluvs;s  2xm(rpnudlmtemfetl( aDurx p;u4apenmfciltfaDeaump (4arxrxo3ia1fpDraivi t0teto(m io4op nlies (  2ta( o;u4optn feiltfaDrlnvo;u0texoif3iy1fmt ln slt0setmimpiudalte fesa(faDumx pou1tleomieilsfs2eanvo;()tlxrir3iodlpt aueilt0sruoir3ou4om n iciat)artr(r ot1oltoiietyd m rmumo (0teeoif io1la eanvi t0 eumirpiy4ape lfcta()aDraxrpoo1alt  oeiytla2rmn s t)aetoxo iydop rau o t0trumxmpnodamtnmnvtas s2rau o;o0aex mf3tad a rm( p;u0 lerio oy1opteliei (0seuoir3iodoleemfeilt  Dtr( ooo0apt ifeiaslsDea(mo u0tlenifciadlm r i ols)setrim3ou4lpt mfvsls) Dtruro;o0tptnmiciad m ua(vp;()arxoxf3iadomDraueo s)t2tr(r nodape mfviltfsDrau  oo1aeen i3iad m ua( pnt)tleoiocoydom rai o;t)s2xr(m3no4ale lnviat s2trumpoo1tetniiciadfm ul( o t)tetoif3iydfaD  uei;s  etmxrpnu4al nmicil(fartmu pnt4tlt ioctysfm2ua(monu4 rerirctydla ranvols)texr(m3oodlpte ieia( artr(root4apt ioctltfmDemnvo u0 eerirctotlatraueo t) rxr(r3oy1opt mieta()s2trxmont0altn fciadla2ea(ms t0tlerio iotlat luei;t)t2ur(rpny4optelicias  Duaxrp;u1tet moctyt a rlu pn()texnmrcty1lptrlneils0 etmim3nu4lpt lnvta()arua(m no0oeeomoctys s2em(mo;()trxoio oy1faD aues s  eurxo3iy4op  micia(  2rax pnt1tpt ifeiysls emump t4 ltoio iy1fa  luei;t srumir oy4lpt lnes sfa2rmum oo1tleoiietytfa rlnvo;t0 ltrxo3iy1fateaivilt  2uo(r3nu1lmen fcs tfaDumxronu0tpxnif3iasla emuvo;u4 etoxr3todom rliei s) etoxo nu4lmenlncsl()arraxmo;u4tpxn o3iytls em( ont0 leoxf io1omtrlnvilt) rtmxm3nydop  lnvs t a2truro;o1tetn ietasla2eln p u)aexrir3totla r uvi s0texo(rpnu1alee ivta( arta( o;o4tpt io3ilsfs rmu pn() etrmr oa1opDean o;s0texoiopio4apeemfeiat)s2trum oo0oeen iciaslmDea( p;t0 rerio iodoa   uvo;( sexr(m3iydome lieia(f rtmxmoou0apeo fcildfm ranmp u0trxnxoctydlat lu ilt  2xoxm io4ame liei ( s2rm(  ;t0oeto f3iadlsDrmnmo t0tetrmo iodla elivilt) euoio ou4ole livsl()artmu onu4ole mietytls ea(mp t)tlxrif3iadlmD luvs;t)sruoir iu1lp   ivi t s2trxm nt1aeto ieiat m ua( o;(0trtrxf oytfatraues (  ruoxr nodlmenmnct s  rumu p;o4ope ifciad m ulums;(0alermo oo1fmtrlivol(0srxo(r3ny4op e net s  rtmump;u4olxniieiadlm2eanvp;t)tltrxo io1fmD ln ol(  rtm(mpnudlmeelics ( aDraxrono4aex micias aDeln s u0tetnxfciydla rauei;s)seurir3nudal nliet sfsDrrump;u4open f3iyt m ra(vs t)aetoxr3iatfpDe u i;( trur(rpoy1lmt  fctlsfs2tr(  ;o4aexomfeiyt s ranmo u4arxoif3iytla rlivil() 2uoiopny1lpt mnvi t)s2rrxrp;u4openmi3tls s elu o () lerif ootlm   n ol( sexrxo iy1al n fviat  Dumump;t1apxnifciatfa elnvo (4 eeomo3io1faDraivsl( texmxo3ou4amee fcs t a2tr( oou0aexnmoctldfs2ua(mo (4texnxrctatoaD auvsl()t2tmxm oy1ap   fesl()a2urxrpot0oleomoeiydls uanmo;(4 rxnircty1latr i i t t2tm(opiy1apenmivslt) Dra( o;u4ale moeiadlsDulump (4 rxnmf iotop rlnei t0seuo(r oo1apte icias sDurx  ou1opxomi3iydfm ul(mp;t4alxoio3oytopD luvi;(0trum(m iydoltemfesl(fsrtaum no1apen oeiltfs2ea( p u4altoir3iodopt  i il( seur(r3nu4oltn fviatf 2raum ;o4tleoii3iasfmDeln pn(0 exnxo3oadlate uvilt) 2xmio3iydllenlies s)a2rrxrpou0aetomictyt m2ean ont0tlxrxo iydoat aueo s) ruoxm nu1lmeelfeiasfs2tmxr ;t0opx mf3tatla rln pnt)tleoio3oa1omtr uei t t2xrxm3nu1am nlivi (fs2ra(  ;u1aetnii3iyd a2rl( sn()areniocoadfa  lneo;(0t2tmxrpiudlp nliesls)sDururont4apxo fetydla2raums;t4alxoif iytlpDrluei;s)texm(rpiy1lltn fvi sfsrtmxmonu0ale ifctydfmDrluvs;t4trxnmo tatoptrlueols0 rtoxm oy4omtnlfctls) Drmum oo1opt  fcildfs um( onu4 lxoif3ty1oa  ai s;t t2xo(r3no4open ncilt srtmu o;u0alxoifciyd m rluvs t4tltomrcoy1fa elneo t0 etoxm3oo4ol   fesat) 2ur(ro;o0olxn ietys a ranms;t) renio iadomtrlu i;()t2xr(m3ny4alen net t sDurx  ou4tlxnif3tadfmDea(vp;u4 etniocio1lmD auei;(0 rtrimpno4altnlnctat  rtm(ro;o1tltoif3ias s ra(msn(0aexnmf iy1lp ranes (0srxo(o iydam nlieta() 2umu ont4tet mf3iytfsDra( p t0tltoxrcoadopt livs (0trum(o3nudlme mnvia(  2rau  ;t0tpt  f3iyt aDeanvo (0 rtrxrcty1lp  lueo ( setr(r nydlpenlnvtl( srra(mooo0tlxomoeiadfmDea(mp;t0teeomf3oy1omDeaies;s0s2xoxmpiydlmtelfvils)s2rr(rono4optn oeiyd s2rlu s t0teerirctydoat lu o s0trtr(m3oodlpe mnvsas srtrumont0apx  oeiydlmDrl(mont)alenxf3oa1la  lnes t t2xo(m nydll e nct sfs2tmx p;u0oeenmoeiatfm2uan s t0tlxoiocio1oatrau ols trurio io4lmt  fvil( arurxrpno0tpe iictytlm2rlnvs (0aexrifcoodoat luvils t2xrxr oo4om   ieslsf Dta(mono0aptn iciad s umn o;t)aexoxo oytoa e uvolt0t2xm(o ny4am elieilt sDtax  oo0texomf3tatlsDuanvon(0aexoif3to1lmD livi;s0t2uoxo3ny1al nmneiasfsrtmxrpno1olx if3ils sDelu p;t) rxoxf3tatomD an ilt0setmxr3iu4omenlicias)arrax ono1aet moeildlaDem(vs;(4teermf3iadopD luvo;s  rtr(r oy1llt lncia( arrr(m oo4opxoif3iyslmDean p;t0aetnmo3ia1lmtrluvil() ruoxmpiu4alt  ieta(f 2tmxront0tpen fctlt sDrmumont4 etoxrcio1oa r uesls0sexoim oo1oltn neiasfsrrrxm ou4tpe ifcildla eauvo t)teerxfcoa1lptrau o () rxriopiudlm  livtls a2umurp;o4oexnmfctytlmDrm( p u4 ltoio3oo1faD aneols trtmxopnudop n ieiatf Dtmuro;o0tpxnmociat m2uanvont0 rtnmo3iadfa elies t0srtmiopnu4op  lfvtls)a2ta( pot4ale  iciatfs uln s;()areoxr ia1faD lneo;t t2to(mpnu1ame lnctlt)arraxroot0tlxn ociat mDua(mp;(4 etrir3oytoatrlivi t)srumxr3nydlm n fei sfsrtmx oot1tlx mictltfs2ranvpnu) eerxf3oy1oaDrluesls)s2uo(m3iodoltemfei ( aDta(m ;t1tetnii3tltla2el(vo u0teerircoodfm   u o s0t2uoim3io4ope mnvia(farurump;t4oeenmieildfaDul( s;t4 leoxr3oatfat au slt s2xrimpiy1ll elnvil(fsrrmx  ;t1apxn ociyslmDrl( o;t4trxnmociytfm eau ol( sexo(r3nodlmee nvta( artmxrono1ope iieilt s2rmu o;(0 etrmo ia1omDelnvsls s2tmir io1omee nciatfsDrr(r ou1oetnioctltla2uanmo;u4tlxoif3oydoaD luei ( t2tm(opnu4oleemnvslt aDraxr nu0tltomfetlsls2ranvs t)trtnmo oodfm e iesl(0trurxmpio4ame mfvt () Dururo;t1tlxoiictatfm eln pn()altrif3oodomDeanvs s)sexrxopoo1lpeemnvsat)aDrrxrpnu0optnmf3ildla2umu s (4 lxoxo3iydlp e n s;(0t2trim nodopt  neils)arraxr nt4aexo fcias sDeanvp (4 etrmfctytlaDean i;()trtoxrpoo4oltemietas sDurxm nt4opt ii3iadfs emump;t4trxrif oatlmt livilt s2ur(m3iy4lltn neiatfaDumx ooo4olto feildfmDemuvo;(0 exoxo3oo1fp   neo s tetriopny1lm emfvsat a2umx  ;u1oexomoctys a emumo;(4tltriocoadfmDe uvol()t2to(o3iu4ape lnctltfartmxmonu0aee  ictyslaDrmn o;u)artnifcta1opDe ies s)trurxo3ny4altnmncsa()a2trxrooo0olenifctydlm2eluvo;()trermrctadomtrlneo t)tetr(opiu4opt lfesat)aDtmuronu0opt  iciytfa2elnvsnt4 rtnioctydlateluvs ( s2xmir3nu4ome  ies (f rtrumpot4tptn f3tydfa2rmuvonu4teenioctotlmtelu o ()s2tm(o oy4optnmncsa(  Drr( ooo4ope mfcilslm2rln s;(0areoxf oytlmDr n o;s  rtmxmpoy4opee ieta(fa2trxrooo1apx io3iydla ul( p;u) ltomf3tatlptrauvi s0 2urxm io4omtn ivtls) rtmumpou0oetoiocils a rl( pn()arxnxfciatlm rlieo;s) 2xo(m3oydll nlfes tf 2tr(r no4tex  oeiatls2elu p;t0texrmocoy1op e ieo;t t2xoxo3iydlm n nvil(  rtrxmont1alx mieiat aDrmuvpnt)trtrifctydlm  luvo s)teurirpoudap nmiet s)a2tmuroot0tet  fciytfa2rl( pnt0 ltnxo iotlatrau s;t)srtoxm iu1omt  ict tfsDtrx ono1aetomieiltla ea(vs (4 lermr iadlp elu il()t2urxo nu4ll   ict t)arrr(moou0aexomoeiadfs rl(vo u4 lxoxr oytfm r ies t0 rtrxm nydome  ivs s) 2trxr ;o0openif3iat a um(mpnu0trxnxocio1fpDe ivs;( s2xmxr3iy4om   ict t s2urumo;u0tpenmoeiydlsDuanmsnt)tlxomo ootopDeai il( seuoirpoy1lle lneia(  Dta( poo1apx iicildlm rmnvo u4aeeomf3oadfaDr ueil()s2xoxrpoodomeemneil()s2ta( ooo4tlenii3iyd sDrl(vo (4aeerxociydlm eln il(0 ruoxm nodaptelics t)aDtr(ro;o1tetoifeilsla uan o;()trxrircoatlm eai sl()sexrxm iu1apee nvs s)aDurxmono4altniociys m rmnvsnt0alxnxr3todoa rlnvo t)srurxm io1omt lnvtat) 2ua(rpot1tlx  fetltla rauvs ()aetrmfctadfaDeln o;(  2tm(mpio4op e iesa(fsDrrum ou0apt  fctytlm2uan p;t4alerxfciotlmt lnvol( teto(r3oydope  ieiatfarrauront0aleniietad a ran onu)tltnxr iytfa eluvi;s)seuoir iodlltemfeiltfaDtr(ronu0tle iietltls2eanmpn(4alxnioctotoaDr uei;s0t2xr(m3nodlme lfeslsfaDuru o;o0oltniiciadfm eanmon() lxrxrcoodoate ivo;(  2xr(m ny1ap e ietatfsDtmumpoo1oex  oeiltls el(ms (0 lxnxr3iydlpDraivols) exo(r3oydal emfvsl(f rtrumonu1apxn feiasfm rmu p;t0texoiociydlm rauei;t  etrim3oodlm elnetatfsDrr( pnu1olx mo3ilsfs ra(vp u0artoir iatfp elnes s) rxmxopou1lltnmici s) ruaumo;u4apx mi3iadfm2rmn snu4artnio3oydoptelu o s0srto(r no1op  mietlsfaruaxmooo4oex mieiydfaDeluvo;(0aexrirciadlaD ai s;t0texr(o3oudameelncs s  Dra(  ;t4alxomfctldfs2eanms;u4aeerxo3tatlmtrlnes s) etmxmpou4al n fvt s)srtax pot0optnmietas sDua( o u4tleoxr3iytoptrln o;s) exmxo ou4apt lnvtlt artru p;t4teto ietytla2ra(vs u4 etnio ty1op rlieslt s2xoxmpiy1lpe  icsl( aDtaumpoo4opt iicias mDemumpnu)arxrio3iydfpDrlies (  ruoio3ny4lme mivt t)s2urxmono4tptomocildlaDuauvs;t4teenxf ty1lpt aivol(  rur(o iodap nmnvsas aDrru pnu4tpxn oetldlmDeluvs;u0trtomr iytlpt anvs;s)truoio3nudllenmfeia(fsrtr(  ot0aet mf3tat aDem(vs (0teeomf3oodfm  aneolt)sexm(r3ou1apee ivi s)artax pno4altomoeildlmDea(vp;u)texrmrctadlpte nei;t0 2ur(r3nu4lmeelncilt sDuaur oo1tleniieiasfm ua(vo;() lenxo3tatlmDe n olt)t2xrim iu1am emncsas)a2urx  nt0ope miciasfsDuluvs t) etoxo oydlmDe ieo ()trxmio3no1apt mfeias  Drax ooo0aptn ociltfa ea(mo ()aexoio3ty1op elieo s0t2xoxr iy1alee ivtlt s2taumoou1oetnio3tyd m rmn s u0areomr ta1fmte u o;(0 rtmir3io4amtnlicils) Dtaur ;u1oeen fctls a ulnmpnt)trxomr iadlp e uei;(  2xrxopio4ap emfvs ()sDtmumo;u4opt ii3iyt mDuan s;u)aeenxf ta1opDrluvo s) eum(m3iu4alt  fvtls aDtru  ;u1alxnmfeiydls rlump t0alxnmo3oa1lmDr i s s)s2umim no4omt mncia() Durx ont1tptnio3tlsla2um( sn(0tetrmfcoy1lp  ln i t0trurxo3ny4lp nlivslt)sDrr( oou0aetoio3iysfa2um(vs;t)tltnmf io1oa raivs t) 2urxr3ou1op e fet ()a2urxr no0opx  i3iatla2ul(vont0 etoirctytfmt auvs s sexmxopoudale  ivs s)s2tau pnu4opeomoeildfm rln pnu0teermf3tadfm  ln ilt0 rxrxm iydal nmiesat srra(rooo1ape ifeiadfmDumnvonu)aetnxo tatlp eli o;(0 2xoir iudamte nci s  2rrx  oo4aeenmieiyslm em( onu0 rermo3iadlmDeaivsls seuoiopiudap  mnci (fsDtmuro;o1teeoioctytlsDea(ms;t4trxrmo3tadfaDeai i;( t2um(o3nu4lltemncs t s2uau ont4tlx mocilsfs eluvon(4trxrxo iatlmtrai ilt)tetr(o3iudom  mivtltfaDuaxmpoo4olt iiciytls2eaums t4alxnmf3ty1laDelivo s0s2urirpoy1ap emncta(  rrmumpot4oeeomietytfs elu p;u4teeomr tydfatrlivs;s trxrxmpio1omee fes ()s2trxmont1aex mfeildfmDran p u) reoif ty1lat aieo s) rxr(r3iydal elnei sfs2tmu ont1apeo o3tatfm emnvsn()altrmrcoytfateaieils0 rtoxopiodape  neil( s2rr(monu1tlxnif3ild mDraumonu4 lenif3iadlm   i s t truo(r oy4apeemivt t srta( pou1opxomfeiysfa ua(vs;t0aexomfctytfaDe uvo;t) 2um(o iodllenlivi sf 2taxrpnt4oet  i3tadfm2ua(msnu) eenir3iytfmDr n sls0s2um(r ny4ol elnvs t) rua(rpou1apeoioctasfs2ulnmsn(0trtoif3ty1fm r n o t  rxoxm ou4omtnlieiat artaumoot0tetoiieiytfs2rl(vp;u0arenio3iodoa r nvolt0 rxoxm3ou4alenlnvt s)srtrxm ;u1tet  octltfmDem(vp;t4trenmo3io1om eai i (0 rtoxopny4ape lnet (faDtaur oo1oexnmoeiytls umn snu) renifcta1omD auvolt0setm(o3nu4omtn ietasfarraur ;o0oetn o3tlsfmDeaums (4artnxr3oadfmDeliei;(0t2tmiopiu4lpen nctas) Dumx ont1alxnifeiat m2rlnmo;u4 ltomrcoydopteanvs;s s2umio ou1am nmfvilsfaDrrum ot4ope mietasfa rluvo u)tlxriociotopteaueslt srumxr3iu4am  mfvsas)arrmxrpot0oexoifeias mDul( p t) eeoir3ta1opDranes s  2trir3ou4omen ics t arua(rooo1oee ifctld mDrlump;u0tetomrciadlmD lueilt sexrio ou1optemivsl( srtm(m ;u4aexn f3iad m2rlnms;(0aeeoif tydfa   n s;t0tetr(mpnydomtemivi (  2ua(r nu1aexoioctyd mDrlnvon(4aetnif3tadfate nei;t) euo(m iy1aleelfvt ()sDua(m ;o0aeenifcilsfm ran p ()aeeoir oydfatraueolt0 eurxr3iydlp  lncta(faruaxmpnu0aptn f3ild m eln s;u4tlerif3io1fpDrlueil( t2uoxr3iu1lm  lneta() 2rr(r nt0aet mf3ildla2elnvonu0aexoircoytfp   n sl(  rurxm3ou4amt miciasfa2tm(ro;o0tltnmoetatfsDelnvsnt0aeeomr ia1fpD lu s ( s2to(opnu1lmte iciasf rtru pou4aetomf3iadls elnmo;u)texrir ootfmD aivo t0srxm(r3ny4llt mncsls s2tauront4aet  ieildlaDum(ms;(0trermfciydlpt  n sls sexmim3io1am nlnctatfa2ururo;u0apx  f3iydfs2ra( p;t) rxoio oa1laDeln o;()teuoxo3nodlp   iesat)arumxrpoo4tpxn f3iydls2el(vsn(4areoxr iy1fmDraieslt0t2uoxo3ny1op  lfvsl() rur(roou4tptniictlsfa2umuvs;t4 ltnmf iydfmDeai o;s teuo(r iy1optnlneil()a2raxrpot4tle  ieilt s rlnvonu0aeerir3totfmteluvi s0seumxmpno4amenlici sfaruru ooo0alenmoeiatla ulu s (0 etrio3iadfa r n s ()truoxo iudom elnctls)a2ta( oou4tetoiicilsls rmu snu4arxrmr3oadoatrluesl(0 2xmxr oudomtn icta( arrrurpoo0opt ii3tlt m2rmu s;u4 eenxr3ia1fpt  uvils t2xm(r iudll n feta() ruaxm ;o4opeo oeiad s2ul(vo;(4treomf iatlptean ols0 2umimpny1oltnlnci (fsrrm(  ot1aeto oeilslm eauvsnu)trxomocoatlmDrlies s  rur(m3oy1olenmictl() rrm(mo;u0tpeomietatlaDemn s (0tlenxrctodlm r n ols) exrio iydomenlncsl(fa2trxmo;o1olxnioetldfs umuvs;u0aetrmo oy1lpD aueil(  ruoim3oo4lleemivia(  rrm(moou0olto iciys s2em( o ()texoio3iadfpt li o;s0t2urir ny4lmtnlnesa() 2rmxr ;t4oltoifeild s uanmo;u0tlxrifciodfmte ivols0 2uoxr3oodlmtemfeia()aDtrxrpou0apeo ictysfm2umu s u)altrif ia1optrln s () rtrxrpnu4om  mfvt tf Dtmx ooo1aet mociyt m ulnmo (4 lermociatlptraues;s setm(m iudameelies ( aDrmxro;u1tlx mfciytfa2ranms u0aeermr oadlmDr ivil( srurxm iodomeelies s)sDtax p;t1oex miciltlm ean ont0tlxomfcty1fp rln i;t teuo(m3oydolenlfeils  rrmurp;o1aetnmfcilt aDeau p;t0 etrircootfa ean o t0setmio3oy1ll n iet s s2taurp;u4alx miciasfaDuln snt) rxrmo ta1fa r n ols  eumxm no1ole mneslt aDtaum ou1aptomo3iydlm2ua(mp t)altnxo3iy1lm   ues t0 2to(m iy1omte fesa( s2ua( pno1tlenmiciatfa emnvp u4 rtrxf3oa1fateliei;t0 2urio nu4ll nlfes tf rtrxrp;t4aeeomietytlmDrm( s (4trtomo ootfat lu ols) etoir3iy4ol eliei sfaDtm(r ;o4aetoioetydls el(vo t4altnioctatopDrli o s0 euoxr nydopenlict ()s2tr(  ou0alx  ietltla2rl( p;(4tetrmfctotoaDeaiei;t s2xrxo3ny4aptnlfei t)aDumu  ;o0olxnmf3tasfmDumnvp u)altnmocta1faDrlnvi t)t2to(r3iudaltelfct ( s2uru ont0aet mf3iydfsDumnvsnu) lxrirciydlm  an o;()srxm(mpnu4op e ncsl()srum(mo;o0oleoio3iad sDrmnms;t0trtomocoo1omDrlnes (0trtmim iu4ll e nvtas) rrr(  ot4apt  oeiydla2rlumpnu0alxnir ty1fm e uvi ( t2xm(m3nydlmt  fetat a2umx ont4aetn octlsfs2ea( s;(4trtnir iodopDrluvslt)srxm(rpou4lm  mnvs tfaDuaxm nu0olxniieiysfsDuaumpnt)tetnxo tytfpDelnvo (0sruo(rpnydap   fetlt) Dtmu pot0optnifciltfm umumont4tlxnmo3oatlmt livsls0sexo(o3oodlptelfvils arumu ono0ope iieiasla2rmnmon() rxnio3tydop eaivs s) 2xmimpny4optn icsl( a2umx pno0tpxo fcildlmDeln s (4trxnio iytoat an il(0s2trimpny4altnmieil( a2rrur ou1altn ieiasfs eln ont0 ltnxf3ia1fmDr u i;s0 exoxo3oydoptemfcia() rumur ;t1tlenmoetadlmDua( p;t)alxrmo3ia1lp r i i;t0 2xoxo no1optn nei ( s2rm( pnt1tetoio3iysfs2elnvont0tetrir iatfmDr n i t0 rxoio3io1op emict ()sDuaxr oo0alxo icils a elu sn(0 exoxoctadom   ivol(  2umxr no1lm n ncsa( s2umu pno1tetoiocilslm2eau pnu)areoxr3todfaDeauvi;() eum(r3ou4ape lies t aDra(rp;u1olxoii3iasfs2ra(mpn(4artrir ty1opDeaivs;t0srxoir3no1ol   fet t)a2rm(ro;o4tptomoetytfa2el(mont) rxrmo3todlm   i o;t)teur(m oodame mfvs s)sDtm(rpnt4altnifeiysfs umn p;u4trenmfctadoateli i ( srxoxopno1omt mnvtat sDuaum ot0tle mo3iaslmDeauvpn(4aeenxo to1lpDelu ilt  eumxr3oo4altelneia( a2raxront4olxn o3ilsfmDranms;()tlenmf tydom   nes t0 etm(r3ou1opeemfcs ( s2raxront4oeeoifeiyd a ua(vsnt0texrxfctotfmDe neo s) rxmxrpoo4lm n ietat  2taum nu1oeeo iciydfmDumnvs u) rxnmf3iotlatrai s s)sexoirpnydapeemieilsf Duaurp;o0olen feils m emuvp;u0artrmoctadfpteaies;t  rur(m3iu1llt mfetl( a2tmumoot0aptoii3tydlm2em(vs () lenio3oo1fate u o;()setr(rpio4olenlnvilsfsDtmum ;u1oltomf3tld aDeanmo u0alxrio3totlat  u olt srxo(rpoodal  mnvtl()aDtrumpnt0apto oetldfaDuluvo;t) exoif oatlpDrln ilt  rtm(r3ny4ll n nvi s)aDurxrp;t1aexoiiciytfmDrauvon(0arermo3oo1fpDe nvi;t0texr(opiodopte fciasf Drmxrpoo1tetomfctltla el(vp;t0alxoxo to1fptrlues t0setmim3nodaltnlivta( srua( oot1aptoiieiaslmDumu s;u0aexomf3tytfatrlu ils)sexoxr3oo4om  mfvtatf rumumonu4opt  oeiaslmDuln p u)aleoxrcoodfmDr u o s0trxm(mpnudom   ivtls sDua(rpoo4tpxo ietaslm2umn s (4 etoif iodlaD aiei;s)t2uoiopno4omee net (f 2raumoot1tpe  i3tys a2ea(msn(4trtoxr3oytla eaieo;()t2tr(o3iy4olee feiat aDtrx  ;t0apeomoetls sDuaump;t0 rtnmo3ootlmt  i i;s0s2xr(opnu4amenlnetat arumxr nt0aetoioetasfm rmnmp u0 exoirctydlatrai ils0trxoimpoodopt lfvtasf Dtrxm ot1tetomicilslmDrlu p u)trermrctytlatraiesls0texoio3iudlm nmneiat)s2ra(rono4opx  i3iytfs2uauvp u4texnir iotfat lieo t)s2xoxm3iy1lpe lfeilt) rtmxr ;u1aleomoetyt m rmumo t0tlxoxocoa1optraieolt) etrio3nodale mivias  Drrx pot0tpeniictls sDuluvonu4alxnir ia1lmD aneo s trtrim iudllt lnvias  Dtr( ooo4tpenif3iyslm2ulnvs ()teenir3oa1fmt ai o t  eum(m3iy1ol  lfet s)arua(rpot1optnio3tyd mDrauvs t)aeeoxocoatfaDe n il()sexmxr3nudaleemfetatf rumxmo;o1olx  f3tltla rmu p;(4 rerir3totom  ln o;t)trtmio3iy1lm n ivs t  2ur(  oo4tetoiietadfa emumsn()teerxo totfa   ivi;(0sexrxo3iu4amte fci (f 2trx  oo0texo i3tydlsDul(ms;(4teerxrcoytlm elu i;(0 2uo(r3ny1lptn fvs tf ruaxmpnu1apxniiciltlmDelnms u)altomocoatomDrlu s t t2xmio3iu4llt mfvi t  Dumu p;u4tee  i3ias m eln o u4artrxo io1fmt  i o;t0trxo(r3oy4ale lfvs (fs2rmxr no1ole ifeilt sDrl( s t4 ltniocta1fmteaivo;t0srurxr3oy4al eliesa()a2raxm nu4optnmiciyt s rl(mo u4teeoxfciotla eauvi (  rumxo nu4om   fet ()aDtmu  ou1aetnmiciad mDrlnmpn(0alxomo3iytfa r ivslt)setmxopoydomeelies t)srrmu  ou4tetnmociasls rl(mo t)aexnxr iotop rlivsls)t2xmim3oo4lle lncia()a2urx ono1tlx iieildfs uluvsnt4alerif3oy1lpt luei;() 2xo(m iudomt lnvta( arrr(rpoo1open feiadlm rmnmo u)aetrxo3iodoa eanes;s)tetmirpnudllee ivt t) Dumu oot0oexnif3ilsla ulnmo u)aetnxo3oatfp elnvil( t2xm(o3iydlpee ictat  2ra(moou4open fetlsfs2rl(mo (4aetrxf ta1fm elues t  rtr(m nydlmtelnvt ()arrr(roou0tptn o3iasfmDeau s (0tetnircty1fmD au s t)sexr(mpnu4lpt  ncs t) Dur( pou0oee  ieiadfs2eluvs (0altnio iy1lp rauvolt s2xr(m nydaltn iesat srrrxmpnu0teenmoeils s ua(vonu0tlxrif3to1laDe neils0 2xrxrpiodlp elnvi s sDrrxm nt1oeeoiiciysls2uluvp t)trtnxf iodomt  nei;() eto(m3nudol e ics ( s2raum nt1alenmfciatfaDemnvont0 exrxfcoadopt anvs (0 etoiopiu1lmeemics ( artau p;t1opxomociadfsDulu sn(0 lxrif3tydlpDe ivsl( trurxopoydlme mnci t) Dtmx poo4aet iociytls ua(mo;t4arxnmfcoytfm  lneilt)srurxrpnodolenlivsl(f rua( onu0aleoif3tas sDea( o;t0 reoif tydlpt lnvils0s2tmim ou1ale lnviltfsDum(  ;t4opto feiasfsDran sn(4texrxf oodoa e i ils)tetrxr iu1alt lfeslt  rrmumoot0oexomf3iadfs2uln pnt) eenir ootomD  ueo;s) exoiopoo1lmt mnvs t srtau p;u0alxo i3iat a2emums (4 rtoxo3iytfm  aneo;t)srumirpiodam  mfvtasfaDtaum ou1tltnmieils aDra( s t0tleoif iydfaDrln i;t) 2uriopoo4lp e nvil(f Dum(m ;u0oee mieiasfaDua( pnt0teerxf todomDr u i;t  2trxo oydopenlnvs s) Drrxroot0opxomi3tlsls2eluvsn() eenxf oadom  au i;()trtrxrpoy4alenlfciasfs2rrx oou0alt  octadla eauvp t0 eeoir iotoa   nvolt)teur(rpiy4omenlivi tfartaxr nu0aet if3iyd s2umn snu0trenxociotfat li i s  exrio3ou4apt  ieias) rraur ou4altnmoctys s2el(mp;u0tlenxfctadlp raieils0t2tm(r3iy4al nmncia(f rrm(m ;u0olx mf3iasfm2ulnmont0altnircoy1fmDe i olt)trumirpoo4ol nmivslt) 2uauro;u4apt iieiat a ea(ms (4aexoif todlaDran ol() rtoxr3iudal elieilt) rum(mooo4ole  oeiadfs umu p;()aeenmf oatfatr uvi t t2tmir iudalte fci t sDrr(roou1olto feiysfs ua( s;(0artrxocta1fptrlues (0t2trxo oydlm nmfcsa()s2tmxrono0ole moetatlaDeanmsnu0 lerifcto1lp  aivi;t)trurir iudll nlfeilsfsrta(rooo0teeomfctatfaDel(vonu4trerxocoa1lp rlneo s)t2xoim3nodlmenmicia(fs2raum oo0tlxoii3ias a umu pnt4tleomf totlaDe nesls srxoxrpno1lmt lnetltfs2tr( ono4texnioeiysls elums u4teeoircoo1laD ln ils0srtmxo3oo4altemfctlt)a2ta( o;o1tlxoiiciasfa ea( onu4 rtnmr ta1fmtr n o;(0s2xr(m3nudlp   netas) Dta(  nt1oltnmo3iaslmDem(vo t0trtrif ta1omtr ivi;s)trxmiopoodapt mnvs tf rtr(r ;t1ale  ictyd sDumuvp;t0 rtoxr3iytoa elies (0 eur(mpiy4oleelncta(f 2trxr nt4apeo oeiytfaDemnms u) renxo3ty1omD lies;s seurxopno1om  licil(faDrm(r ou0tex mf3tatfaDranmp;(4aetnmr tadoptr ivs;t) etoir3oo4open fctasfaDur(  ;t4oexnmf3ildlm2rm( p;u)tlxnir ootopD  ueslt0tetoxr nu4omt mnes t) 2urxmoot4alxoifciydlmDul(ms (0 exrxrctatfmteauvi s0s2tr(r oy1apeelfetl( artau pno4aetniocias m ulnmo t0arxrxo3tadlm e ueils0s2umirpoydale  ncsltf rrm(  ;o0tlenmf3tasfm el( ont4trtrxo ootfp eaivs;t0trtmxr3iydllte fcsat  Drrxmp;o4alxnioctys a2emu o;u4alxnmociy1opteanvilt)srumxopiudalee ieias arrr(rpou1optn icildls2rl(vpn(4tleriocty1op eauvo;t0t2uoiopnodopenmfes t sruaxm ;u4ole ifeias s ul(vs;u4 etrmf oatoateai ilt  2ur(r no4lpt mncsat a2um(rpot4aetn i3tld sDrlnms;t0trtomr iotlmtr n i t) etoxo nodopte nvs ()arta(rono4oetnio3ilsls2rmn o u4tlxnio oatlaDe iei;(0trto(o nudope lneslt) 2taxrpnt4opt ifciyd sDulnmp u4 eenxocootlaDrluvo (0srxo(m3ny4lme  fvt s  2ra(m ou4aeenmfeiysfsDelump t0artrmrciydfm  lueils  rxmim io1ap elnct tfaDtrumpnu1aeto o3iysfa eaumo;(0 rxoxf todfpD ai i;s)trxoxr3iodapt mncs sfsrtmumpot0tptnif3iyd a ul(ms (0 exoxr3totfmDeau i s) exmxr iu1ol emfetl()srrm(r nt0alx  ieiydfa uauvs t0arxnmo3iydlpte i s;t  ruo(o3io1olt  nvt t) rtaum ;u0aex mieiadfs umu p;t)tleoiociotfm elneils)t2ur(r3ou4ome  ivi sf 2ua(mpoo1oexoii3tasfm ra(vs;u4 leoxf3tadlaDr ieo;() 2uo(opiy4lp  mfctlt) 2uaurooo1ope  ocilsfm2ul(mp;t0 eenif iy1oa r nes;t)srxm(r ny4lp elfct sf Dra( p;o0opeo o3iydfsDranvsnt4tetomf to1lmDelueo;t0t2to(mpoudlp nliciat) Drmxroou1teenio3ilt s elnvsn(0aeenmf3oydopD lnvi t t2xrir3oo1lmeemfeilt) 2raumpoo4tee moeiytfm emn s u0aexrircty1fp rlu i;(0 2xrir iodllt mnet t) Dtrxr no4apt mo3iydlsDumumsnu)texrmf iytlm e n o (  2xmio iudam elnvsasfs2ururp;u4apxniocildfsDeln pnu) rxnmr oa1omDeauvsls)texoxmpny1ale lfeiatfsDrrumo;o0ape  o3iyd m rlnmo;()arxomf3oa1latranvol(0tetmio oodal  mfeslt s2rruro;o0tlx ifciyt m emuvo t0 lxnmo3io1opDraueo;(0trxm(opny4al  lfvs s sDuru  ;u0aptn ictydfm2rmnmp;t4altrmf3ta1fpDrlneo;t) 2xmiopno4lp e fetas  2uau oou0tptn o3iys mDelnvont)tetnmrcoytfmteanvil( t2tr(o3io4llenlnvsl()s2trxr ;t0olx moeiadlaDrau s u0 ltoio to1oa r neolt0truoxr3nu4alt mfcsa() rum(mo;u1opt mfcildls raumpn() ltoxrciydfptr i slt s2xmio3oudopt lncs ()srur(mpno4oexniieildfm rln p;u0artriocoodoa  anei;s)t2xo(o oo4omt  fcs () rrmxmp;t0altomociytfa2uauvo t0texoxo3oydoat aivilt  2urxr io1lmen nctas arrm(  ot1optomi3tat sDuau s t4aleoirctodla  ln sl(0srumxr io4lm  lfvt t s2urx oot1aptnmi3iatfm2uan s;t0trtnmociotomDr nvi;s) 2xo(r3ny4llee nesas) Dtax pno1tpxoiociyslaDelnvp u0texnmocoo1opDe uvsl()srxrxrpoudapee ictat) Dumu  nt0oexomfctyd m2uauvo;u) exomfcio1lpt aueolt0t2xmir ny1am   fctat  2tauro;t4altomoetldla umnvpnu)aetomf3ia1fpt lieilt0 etm(opou4am  livi (  Dtmu pot0alxn fetatfa uluvsn(0teeomr3ootoa eliesls0 rxoio3oo4ol elncilt)srurx pou4aetniiciysfaDeln pnu)tlxoir3oatop  anesl(0trurir3iy1optnmnviat srra(roou1teeomoetltlm rm(mp u0 exnxociadom ran s t) rxrxo3io1optemfviat) 2ururpou1optomociysfm2ul(vo;u0 exomr3io1oa  ln olt0s2xm(o3io1omenlfctl(  Dtr(rpou1oet  fcildlsDrm( p (4 reomrciadomDeai slt) 2to(o3no1al nmnesasfsDua( pnu4oetomi3iysls elnms;t0 rtnxrcoydfpt  ieilt t2umxm iodape  ici t aDtmxmpou4olenmoeias aDua(vont4 rxnxr tadlptelnvi t)s2tmxr3io4om emncilsfsrraxrp;u1ape mf3iatlsDea( ont4 ltnmr iodla e uvo t teuoxopoodom e fetlsf rtmxro;o4opxniicild a2emnms u) ltoio oytla eanvi s trumir oudam nmivsls  2rr(r oo1tle mfcilsfaDeluvs;u4tltnirciydoatrliei s)teurxr nodamtnmnvsl( srurxmoot0olt mfetldfm2ran onu0tltrircoy1fpte uvs;t  2xm(opoo1lm  lfetat)arur(m ;t4tetomocilt sDeanvp;t0altnmr3tydfmDeanvols0 2xrim3oudomtnlieias  ruax p;o0apx ifctldfmDrl( snt0alenxfcoydlaD lies (0s2ur(r3iu1lmenmivs s)sDrr( ono4aetnmietydfs2rl(vo u0 etomocia1opDelivilt)t2umxr oo4lptelfvtat)a2rr(  ou1tlenii3ias s eanmsnu0 lxrifcoadlpDe ies;s)trurir oy1aptemfcia(  Drmu ont0tpeo ietyd a2uanvs u) etrio tydlptelnvo;s s2xm(o3io1llenlfctasfs2urxrooo0tlen oetltla2ea( snt4 eeoxf tydlmDe i i t)srto(o3no4alee ici (  Dua(m ;u1aexo f3ils sDelnmp (0artoxr iy1fptran o (0 2toir no1lme  nes tfa2trump;t0olt iociysfs2ul(vpnt0tlxoxo3iytop  lues t seto(rpiy4lleemfvils a2rmx onu1alt mfciatlm2ulnvs;t0altomr3todoaDr uvi;s texrxm3oo4op  lfeslsf Drr(ronu0ole mieiys a ua(vo;u)artrmrctytlaD ai i t  exmio3iodale  fcsas)artrxmpnt1olxnmf3iys s ulu ont0texrxrciytomtelnvsls0 2umxmpiu1opte nei ()aruaur nu0tlxo i3iydlaDrlu o u4aleoifcoadla rlnei;t  2to(o oo4ap  lici (fsrraum ou0tlxnioeiys s umnvp u4alxnmfctadfateli olt)trxoxo3iudaptnlneils) rrrxmonu4altomo3ild mDrlu s u0 rxnxrctydlptrlieo;s0 eurir nodllte fvsa(fs2rr(  ;t1tee  o3iydla2um(vs (4treoir ty1faD au i;(0 exr(opiudop   nes s)aDuaxr ;t1tpeomo3ildfm2rln o;(4 rtnxo3totfm eaneo (0trtrim iy4ol nlictatfsDumuro;o4aleoifciyt s2em(mo;(4alxoxrcia1lm  anvo;(0tetoxr3ou1ap elneia( arrru p;u4alenmoctasls ua( pn(4aexnif iytfmtelieilt teumxm iy1lmeemncs s aDuau o;u4tpxomociltlm emn o u) renxf totoat ai i t) 2urirpoo4op e fesasfa2rmum nt1tpeo f3tldfsDean s (4aexnircoytlm   uesl(  rtoiopoudaptelncsat)sDtrxrp;o0oexoifctldfs rmn s t4tltoif iadfaDeaiei s0trurxo3nodamenlnetas)s2umu pno0oexo icilslmDea(mp;u4 eeomr iadoatr nvsl(0 eumiopiudop  lici ( aDrmxrp;u0alx ioeiat m ra(vpnu) reomf tytfpDeaieilt teurir3iy4ope  nvsltf 2uaxrp;t4oltn fciadlsDrl(vo u)aetomrctydfm   iei ( t2um(rpoo1ope  feias)arta(m oo4texn ociltlmDem(vp;() exnxf tadlaD aneolt0trtr(opoy1ome  ietltf rtmurpou1olen ietatls uanms;t4 ltrmo iy1fa e n s t seurir3oudome  fvslt a2taxm ;u0apx  i3tltfm em(vo u4 leomr3totopD anvslt  ruoio nu1lmenmnvs sf 2rm( onu4aexn f3ilsfm emn onu4 rxnirciotfmtean sls) eum(rpoodlmtemnvs ( a2rr(ro;t0tptnifeilsla rmnvo t4 eenif oatfa eanvs;() rxrirpio4aptnlivsas sDra(r no4olenmf3ilsls2emu onu0 etomoctydop rlu ils0t2umxo3ou1alte fvtltfsrurxrpno4tetoiociadfsDumnvs u0aeenmociotfmDeai o;s)t2toxo3iy1amtn ncsls)arur(mo;o1alt  fetasfmDrau snt) reoir iytlm eai s;( s2xrirpoy4om   fvs s)sDra(mo;u4alx mfetyd mDrl(mp ()tltoxr oytlpDeanvi;s0 rtmxmpio4ap e ncs t  rrrxr no1alx ii3iad sDemnmp;u0tetoxr3oodoa eaieol()t2urim oy1lpen neil(f Dra(root0apeniociys a2rmn o ()tetnifcoo1lpDelnvil(  etmir io4lmeelfes s  2uru p;t4tlenmoctlt sDrmuvpnt0trxomfcoatop e u sl(0t2toiopnu4ap   fciat) Dumxrp;o1aetnmf3tas sDemn ont) rtnio tadlmDrluvo;t setmxr3nu1altnlnci t  Dumuronu1oleniocilt a2rmumo;t0alerxf io1om eau s (0teto(o3io1lme  neia(f rtm(mpnt1olxoioeiysfs2umuvont0aleoirciatfp   neo t sexmxmpiodame  fvt ( a2rruroou1alt  ociatfmDraumo;u) etnirciadom   i ols s2xrxm iy1llenlneta() rtr( p;u4aeeomi3tltfm ua(vsn()aeenxr3iatfatelnvi (0 rtoio3ny1ll n nviasfarta( o;o4tlto ociyd s2el( p;t0teeomrcta1fmDrlneilt texrxr oy4optelietatfsDur(rpot4ale  i3ias mDuaumonu)altomrctotopDeaies;t0 2uoxr3nu4optemnvsa(fa2uaxrpot0tpt iieilt a rmnmp t0arenxf3iotlpDraivo (  rurio3iy1amtnmieilt) 2taxmo;t0aetnifetyd s rm( o () exomociotfat auvi s0srtoxm3nudalt  nct ()s2uaum ;u0apxnmieiysfm rmnmp t0 etrxocoatopte i ilt0 2tm(opoo4lp e ietls)s2raxr ot4alxomo3tlt s2umnvo;(4arxomr tydopDraneilt) 2uoir oudapt  fcs s)sDuaum ;t0oee  ictasfsDumumpnu0aexnmf3oydfpt aivs;(  etrir3iy4lpt  ivta(  2rmuroou1tpxomi3tytls2uaump u0aexoir3todfatr ivo;t0s2xm(m no1llee nctat) Duau ono4opxn iciysfmDua(vonu4treoif tydoaDrauvo t)tetrxm ou4amtnmneils a2tmx oot0apx ifciadfm2rmnvpnt0tltrxfcia1fpt li ils)t2xmxo3iy4opee nctasfaDtau  no4oexnioeiasls2ranvpnt4 rtrmo tytopt aivsls) euoiopoy1lp elfet (f Duau pno0tpe  i3tldfm2rm( s;(4aleomr3oytfa r i s ()s2trxo ou4ameemnei t s2urumont4tet  oeilt aDrl(mo;()teenxr3oa1oaD anvslt0setmimpou1openlncias) Dtmxro;u1aee if3tatfa ua( o;u0altrxfctydlatrau ilt)seurxmpnu4ope mnci t arua(  nu1tlxnmfeilsfaDem( s u0trtrmf oodlaDr n slt0 rtoxo3iu1omt  fcs tfaDtmu o;o4olx mi3iatlmDul( s;(0 ltrxrciotoa e uvil()srurxrpou4ll e nvs t sDraxrpou0tleoii3ilt s2ul( p (4tlxnxo oy1fm   nesls)srumxmpoydlm nmiesat  rurxro;t0oleoioeildlmDrm(vo;t4arenmr oo1fa r uvi;()s2uoirpiodale mfcsa() rtaump;t0oee mfcils s ean sn(0 etnxr3io1oaDrlnvils  rtrim iy4opt mfci tf rtaur ;t1apx miciytfmDulnmp;() exnio3io1oat  neslt t2toxr nu1lle  fvias  Draxr nu4tltoiicils sDelnvsnu0tleoioctodlm  aneo ( teuoxo nydal elnctls  Dta(m ;t1tlxniiciltfm ean o u0trxnmr3oy1omtr ueo t)t2xmir3oy4am  mfvtl()srtrxmo;t0opx iieilt s rmnvo;u0 exrxr tytoa  ln ilt trtmxrpiy1amte nctlsf 2raxm ;o0tetniieild a2emums;u)tlenxf oydfptraivo;t) 2xoim3oy1lptn fcslt s2rrur no0apeniieildfm ulnmsnt0 ltoio to1oatr n s;(0 2xr(opny4alt lfcs t artm(rpnt1oeenioetld m rl(ms;u0alxnxoctatlmDe nvo t  2trirpiu4amtemiesatfs2tmurpoo0oexomo3tys m2ranvon()artnmfctytomD ln olt0 rtrio oy4ame  nvsa() 2tax o;u1aeeniicilsfsDranvpnu0alxnxf iytoa  ai i;s setr(m no4alt lfet (fs2rmx ont1oetnii3iad aDeanvp u)altnmf todlmteluvilt0 exo(opnudlme mfet sfsrtaurpou0aexnii3tytla2ulnmsnu)aexomf to1laD lies;s0s2tm(m ny4omtnlnvs (fa2ur(mpoo1alxnmocils aDrlumont0tltrxf totfaD aivolt trxmio iydlmenlnesltf rtax  ;u1oee iicilt s rlumo;t)tlenmr oytlmD auei s0s2xoiopnudale mfvtlsf rurx oot4apeoifetys s2uln p u)alxriocoatlateliei ( s2xoxm3io1op nlfcsat)srrmur ;u1tptnmoeiatlm2eanvpnt)arxnmf oa1fp  ai s s0 rtriopio4optn ivil(fsDrrxrp;u0tpxn ieiad a ean sn()trtrxf iydom e nvi;s0setm(mpnodalenmfetl(f rurumonu0olxnifeiatfa ul(vpnu)teenmr tatfp elueslt0 exoxrpnu1apt  nct s)s2raum ;u0olto fctas aDuluvp u) etrmo oytoptr n s;t0t2uriopny1amen ncsatf rrrxmp;t1altnifciys sDumn p t0treomocio1la   uvilt seuoimpiydap emneta( s2ua( oot0aetomieiadfaDranmp;t0 lerxfctotlp  auvsls0teurirpiu4om nlicils)sDtr(rpno1apx  i3iad a2uaums;(0aetomr3oa1fp eaivolt srum(m3iu4lmtn fciat s2uau pou4olenifciys sDrmn o t4treoir3iatlmte nvo s)srxoxo no1ape mfeias artrx pnu4aetoiocilslm rm( o u4tltnmr iadlpDe neil(0t2tm(r3oo4olenlivi (f rtm(mooo4tpxnmoeiydlmDelnms;t)texnxf tytomDe nei;(  ruoim iy1lp n fviatfsDtru  nu4texo fctysfmDua(ms;t0teerif3oodfateaues t0trxoxm3nu4ap emnetl(f Drax pot0tleniocilt a ranms (0 rtnxo oa1oatran o;t0texr(m3iu4omee fetl(  rrrxmp;o4tptomo3tytls el(mp;u)artoir3totomDelneolt0s2xmxopoudoltnmfcils) Drmxmoot4olxomiciatla ul( pnt0 eermoctytoptrlnes s) rxoxm no4omtnmiciat  Dtrx  no0optnmfeiytla emnmo;t)arerxr tatom r uvi;(0tetrxrpou1om nmnctasfarrm(mooo0apx  feiydlaDeaump;(4 eerxrcoytlmD  neolt0 rxr(rpny4ll   fcsl() Dtr(mpot4ole mo3iyt aDeauvo;t0aetrmo oatla  lnei (0 rtmio no4ape mnctlt aDurum nt1altnmf3iadfaDumuvs (4 exoio oa1laDr uvo t)t2xmxo oydomeelfvil(f 2umu  nt4teto f3iydlmDua(vo;(0 exoifcty1oa eauvils trtmirpou4ap elnet s s2ra(moot0tpenii3ilslmDea(vpn(4 exnmfcto1lmtrluvs;t0t2toiopoo4omenlnci t sDurxr oo1tetn oetlsfmDea(mpnt0 etnif3iadoaDeaueolt0setmxopoodlmenlncs sfsDrau p;u4aetnifetldlm2rlnvs;u0teeoxo iy1lpDraivo (  eur(rpiy1lltemfvta(  Dtrurpou4tle io3iad mDuaumo;() leoxrcoytlm  lnvs;t0t2umirpiydaltemncs (  2uaumoou0opeo i3ils s ulump;t4 eerif oadfmD  uvi s t2umio3iu1apee nvt t  rua( p;o4texnifeiatfmDul( pnt)artnir iotomtraieo;t0 rtrirpny1ape mnei t  rtaxmpot4teeomfctltlmDumn o u0 exoxf3iy1fmD lies t0 euoim oo1lpen nvsls srururp;o1texn ictad sDea( s (0tleoxrcoo1fm  anvi;t0texoio3ou4am elfci (fa2rr(mp;u1tptoifciydfs2umumon()alxnxrcio1fmteaivs;(0t2toxo3nu4ape lnci t srraxr nu4tetnmociad s umuvp;u4aleoxrcto1faD lnes (0s2xo(r oy4optnlfei tfsDuau pno4aet ii3tldfmDua(mo (0tetrir iadoaDran ols0tetoio oydlltnlnct t s2tmxrpnu1olxoiocildfm2uau o;u) rxnxfctadoaDeaies;( t2tmio io4lltemnciltfs2trur no4aet ii3iytfs ulnvo (0 lxoio3oydlmtran ols)s2ur(o oy4ap   fcs (f 2taur ou4apxnmoeiatfmDuanmo;()artrxr iytlmD  n o;(  euo(r3oodllen ieiat  Drr(mp;u1tpt iieiys s rlnmp u) rxoif tytoa r uei s s2toxo3oodllt  ncilt)srta(ro;u1aee io3ias a em( p t0 exoio tatlat  uvs (0 etm(rpnu4ale mncsas artmum oo1ape mi3tadla2umumo;() eerioctodoat  nei;(0srxmxo3oo4op e nesat  Dtrxront0olx  i3iadla rl(vs;t) rtnxf oadoate n o;s  exmxr no1lptn nvtat  rtaxm ot1aet mieiydfsDulnvp ()arxoxo iotoaDeliei (0seumio iu4amtelfvsl( aDtmxr no0tpe mfeild a2ul( snu4 renifctatfm e u ol( srtmxrpiydomt mivt (  2urx o;u4alx io3iyd s uan pnt)aeenmrctotlm e uvs t0t2uo(m no4ope lfeta() rraur oo0aptnmictytfsDrmu p;t0trxnmo iydla r ies t0sexrxrpiy1ome mivsltfsrrmx ooo1apto i3iatlmDrmu o ()trxoio3iadla e ivols0 etr(m3io4op elfvia() 2rrurpot1opto ociasfmDrlnmo;t) ltrmr3oodfm rlu s;t0teumim nu1ap emfcta(  Dra(r ot0oexo f3ils m ua(mo;u) rxnif iadomDrlnvil(0 2xmxm3iy4om nlnetl()aDurxrp;u0oeto ieiadlsDuau p;()tlerio3to1lpDr n i (  rtrio oy1opt lfes tfs2uau  ;o0tlenioctydfsDumn on(0aeerxrctatfatranes;(0 rumir iy4llt  ivslsfsrraxr ;t1tptnio3tasls2ranmp u0 rermr tadlatelu ol()truoiopiodol eliciat)srtaxmpnu1tptnmi3iydfs2el(vo t0aleomf oytoa eluvsl(0seum(o3ny4al emicils) 2ta(ro;o4oltnif3tad aDeaump;()trtomociydlptelies t0t2xoiopny1ome  nct (  rta(rpot4tlxomo3tyt a ul( s;() rtrio oodoptrlivslt0truoir3nudlm e fcilsf Dtaurp;o1ape mi3tat m2em(mon(4aetoio3to1la ranes;s s2tr(o iu1olt lnci ( a2umxrpnt1olt  o3iyslm2emn s;(4 leomr oatoa eanei;(0teurir no1olee feilt) 2rmxr ou4oltoioctyslaDem(vpn(4aexnmo tadfmtrau sls sexrxr3nodll emfeias sDuaurpot0altn feild aDrln s;(4 lxrmrcoa1faDrau s;t  exo(mpoo4lmenmfcslsfsDumuro;o1tlxo ictysfs rmnms () rermo3tydoaD  i s;s0t2umxrpoudam emfesa()s2tmxrpoo4tpeomf3ilslm2ulu s u4 ltomf3oa1lpDrluvs s0t2tm(o3oo4ape  ici sfsrrm(rp;o1tleo oeiadfs emuvpnu0aexnxo todfatrauei;s)sruoxopiydlm   ivsatfsrrr(m ou0tee  fcilsla2ea(mo;(4 rxrxf3ty1lpt lues;(0 rtrxo3iu4om emnvt t) 2umuro;t4tpeo fctydlmDrau o (0 leoxfcoytfa   ueil() 2toxr oy4alt  fctls srtrumoou4apxo i3ildfm2elnvp u) ltrir3iodfmtranvs ()trtm(o oy4lpte netl(fsDuru p;o0tle mfeiys sDulu ont4altnmf iydom r n s t)trxmirpoodlme mietlsf 2urxmp;t0oleomietlt mDean pnu4 exnmf ootomDraiesl( texoirpoodal elfvta(f rrmxr ou0teeoifetadlm ulnms;u)alxnmr3ta1fp e ivsls seum(o nu4ome mnetls sDuaurp;o1tpenmoeild a2uan ont)arxnxfcoytlmtelu ils0texoxmpoy4ale mfvt (faDtm(mpno0olt mfetasfm2emn p;t)trtrxf tatfatr n o s) rtr(mpou4lpe lnvi sfsDuau ont0tle mf3ildls elnvs u)arxnxf ty1lptranvs;t)teurim3iudaptelfeia(f rur(m ou4tetnioeiyd a2elumo;u4tlxomf todlaDeaieo s sexo(o oy1ll nlnct s s2raur no4tetomfeiad mDel(vp;(4texrif3ootlmte nes t)s2trimpoydaptnmivtls  rua(r ;o4opeomfcias sDul(ms t)texoxf tytom  an s;t sexo(r3no4alenmncslsf Durx oou0tpe mfciytfaDulumo;()trenio3iatomD  ueo;t0trtoxo oudop elfcta()sDtaumont1aetoio3iysfm2rmn pnt4aeeomo oy1op r ueo (0teum(m io4openlfeia(f rraxm nt4apenii3ilsfsDuln p;u4 exrxfctydopD  u ol( trxo(rpiu4ll n icias sDuaxr no0tlenifciadlm rmnmo;u4trenircta1fatelueo ()t2xm(r oo4lp e fcils  2tm( oou1tlxn fetys sDeau p;t0 lxoxf iotomDeluvo t0trxm(rpiy4om  lnvsa( aruax o;t0tpxnifciatlm2rm( on(0arxrif3oytopDelnvols srxrxo iy4ope mieil()aDtmump;o0olt mo3ildfa em(msn(4 etrmf3oodomt  i s;( trxoio3nydaltnmfvsl()s2rm( pno0olxomoetldlm eaump;() rtrif3iodfpte nvo t t2xmimpiy4ameelicsa(  rrax pnu1teen fetlslsDranvont)altoif ootlpDrlueol(  2um(r iy1amen feiltfsrtaumpnt1aetn i3iltfaDra(vpn()artnir3tatfa  ai i;t trxm(m3no1lmtnmncia( aDtr( ooo4tet  iciytfs2rl(vs;() lermoctytfa   uvo;t  etmxm3iu1omtn ivias)s2urxmpno4ale  f3iatfmDean snt) exrxo3tadlmDr n i t)s2urir iodole lietlt)s2trx p;t4apeo oetas a2elu s;t)tleomf3tadlaD livilt t2tr(rpiydal nlfei ( a2urumo;u4altniociasla ea(ms;() lerifcoatlpDrau o ()sexr(mpoo4ll nmfvi t) Drmxmpot1oetomf3ilt s2em(monu4 ltriocta1fmtrli i;(0trxrxmpoodll elnvsa() 2rmu pno4olenii3iadlmDua(ms t)tetnxfciytfa rlnvslt0 2tmimpoy1ame  ncta( aruru pou1oetniieilslm2em(ms t4 reomrcoo1fmDe neo;()trxoxr3iydomt  ietas sDtmxrp;u1tet iociasfa2rlnvonu)artnxr io1lm e u ols) 2xoxopnodlmtnmivslsf rrm(  oo4aptnmo3iydlsDua( snu4aexnmf3ty1opt  uvolt)srtmirpoydlmte fviatfs2uax o;o1tltomietyt sDul(mont) lxoxo3todom eaieols  exmxr3no1lltn ncsat)sDur(m ;o0texomieiltfm2rmumo t)texoxo tadlm eli o;t) rum(m no4lp emfvtas)sDtrurp;u1olxnifctat mDrmn snt0trtoif3iatfa   ivilt0trumiopoodameemfes t sruru  ;u4tpto ictlt m rl(mpn(4tetrifctatoa rln olt) etm(m3iy1ap  mfvtl()artaxmpot1aptnmi3iytfa elnvp t0arxnxrcio1la  lies;() rtoxo nudll n nvi tfs2taxrpnu4tpenif3tydls umuvp;u4tlxnir3iatoa rlnvi t0s2xo(m3oy4amt lnetat artrxroot1opeomocildfaDra(vpn(0 rerxo3oa1lmD au s;s)srxo(r3nu4lpt mfct sfs2ra(mo;t4tlto feiytls ul(vsnt0trtrmo ootoaDe n slt)s2urxm nydll nmfvt t aDumxrpno4opxomi3iatla eln o u0 lerxf tydfpDelnvi;s0s2tr(o3iu1aptelivtas) rurxr oo0tetnmfetad mDrluvp u) rerxo ootopD lnvsl(  etr(opiydal n ictas s2rrumoot0olto i3tlsfa2rlumo;t) leomoctodlmtranei s t2trim3oodapeelivsa()a2trx oot4aleoiociytlm rlu p (0 renio ootfp rlivi;t)texrir3nodapt lneslsf rtrxroot0tptn ociadls2ranvs u)arxrmrcoydopt  nvo s t2ur(o oydopenlfctlsf Durxrpoo0tetomfctytfa el( s (0tlenmf3ty1opDr u o;t  etrimpoo1ame  ivs sf 2rm(rpou0altnifciltlm eauvp () rxrmo tytfp   n sl( tetm(r iy1ll  mfciasfaruaxrp;t0tex iiciasfm2eanmon(4tlxnxf oy1opDrauesls0s2xoirpno1ll emivi s artrxrpoo4aleomocildlmDeanmpn(0 renir ia1lm eln o;s)srxr(o nudlmtnmieilsfs2rr(mont1tpto oeilt s2rmuvp u)artomf iotoat  ues;s)t2uoxmpno1omee ivtls) Dtm( ono4opxomfcildfm rl( p t4 etrmrctotlate ieol()t2xrxo nu4alee nei t  Dra(rp;t0tlen oetadfa rluvpnu) renir ta1la rlies;( t2umir no1ope livtl( a2tm(ront1aexniictyd sDrm( s t) reoio3ta1opDeaueil(0 etrio3oy1om n ies ()srrrx  no4tpx  f3tydla2em(vo t4 etnxr oodlm  au s;s)seuriopnydal nlfcil(f 2ur(monu0optnii3ild s2elu o (0 rxnxoctatoa  aneo s setrxr oo4al   nci sfsrrru pnu0aexoiieiasla2ranvo;u0tetnir3todomDranvolt0trxoxmpiudllenmivsls)sDtax o;o4tpe ioeiyt m um(mp t0alxoxo iotomteaneo;()trurxr oo4lm elfetatf ruax  no1aeenii3tls a rl(mp;(4altrif3oydlmte n o;t0t2tr(opoydalt  ict s)artauro;o0teeomi3tyd sDrl(vo ()aeermr3tytoa eauvi;t  2tr(r3oy1ope  nct t)srumxmpno4apt iietldlaDul(ms (0aeenio3tytlaDr i ils srtrimpou4opte nvil(f 2ua(ro;o0ole iocildfmDeauvo;t4tltoxr to1lpDranes;() rxrxmpno4lmt mnetls)sDra(r nt0aexo f3iys a rlumpnt4tlenxrcia1oatr nvs;()sexrxmpoy4lle  ietasf rtru  nt4opxn iciltls2emnvs;(4artomr tatfaD  ies;t)teto(o oydom elncils sDtr(mo;o0oeen fctad aDulu o (0 eeoxr oodfat an o t) rto(o3oodam elfvsatf Dua(m ou0oee if3ilt a2emuvo;t4aexnir iytlmDraneslt s2trir no1am e nvs s) rra(r ;u1aetnif3iytls umuvpn(0aexoxf3iadopDeai i t)tetoxmpiy4ll emnvtas)s2trx  nt1tptnioctasfsDea(vpnu0artrxr to1oaDe ivo;(0trumimpno1lmtemivsas aDrm( ont0tee mi3iyslaDrluvon()arenxr oodfptelivi;s t2xo(rpiy1lm nlictat)a2tr( p;t1teeomi3iatlmDrmumpnt4 exnxo3io1fateluei (0sexoxr nu4ap  mics t  2rr(  ot0oee  oetyd aDrl(vp (4 rxrmfctadlaDr uesls) euoxr iy1aleelfeia()s2ururpnu4alto ietydlaDua(vo;u0 renmr ootomDr u ol(0srtrim3ny1lmt  nei ()sDurxm ;t0alt iiciydfm el( o u0trenirciadoatr ieo t)t2toim iodapee ivi t)arumum nt4tetnii3iydla uanvs u) eeomr3ta1fpt auvs;t)trur(m3oy4lp elfvsas srurumpoo4aet miciyd aDrmnvo ()tetoxo3io1faD li i s0 2xr(o3nodlpeelfcsa(fs2umuro;u4olxn ictydla2emnvo;(0teenmrciotfat aueo () 2umirpnu4ap elictas a2urxrpot1tleoii3tytlm uluvont4texrmfcta1lm   ueilt s2trxr3iu4ll  lfeiat  Drrum ou1teeo ociadlaDeanvs u0 etoir3oatomD  ivslt0trxmim3ou1om nmncilt  rtrx ono4tpx  fctytfmDem(mp;t0texrxo3iytfa e uvilt trumxr3iudlpte fci (f Dta(ronu1tptnii3iysfaDrm( o (0trerir iodfmte n o s srurimpio4al e feta() ruaum ;o1teto ieiatfm rl( s u4trxrmociy1fm  aueslt)s2toiopnodlmt  ivtls)aDta(m ;t4ape mf3tyt m eln sn(0 etrxf3iy1faDe neo;()sexmim3no1ol nlnes tfs2tm( o;t4optnmi3iydfa emnvp;t4areomr iotoaD lies;t)sexrxm3iudlmtelnvs (farur(r oo0aee moetadfs ra( p ()aexoio3oodfat aneslt)texrir oydamenlfcsltfaruaumont0ape  i3iat a2eauvpn(4tltomrctydlmtraivil() rxrim3no1alt mfvtasf 2tmx  ot1aex iieiadfm2elnvsn(4 lenxo3iydopte u s;(0teurim no4lp nlnct ()aDrru ooo0apt moeiyd mDea(vp (4aleomf iy1optrau ols0 2uoxm oo1ole lncs sf Dtrxrpou0ole mi3ild a emnvs;t4tlxrircoydfm rlies;t0t2ur(o3ou1lle  icta(  rumx pno4opeo oeiadlaDemuvo;u)trtoxfcoo1lpte n o s0srxm(m3oo4lpe lfcsl()sDta(  ;o4oetoio3tadlmDua( p t) reomfcia1fpt  uei (0t2um(r3ou4lleemivsl(fa2umx oou4tlxn oeilt a2ua(ms t)artrifctadlpD aieils) 2uo(r3iy1ame mnviat aDrrumpot0aetnioctys aDulu p u0texnmr3to1la   uvo s texr(o3nodalenmfcsat  Durxmpoo0tpx ioeild aDrln pnt0tlxoxr iy1lmtr i i ( trtrim3oodllte nciltfsrum(r ou1ape iictls aDeanvsn()tr
\ No newline at end of file
@@ -0,0 +1 @@
+i ols0 etm(r3iy1lp e iei t sDrr(m ou4opeomo3iatfsDuan ont4 renmo tadfmDr uvilt) rxr(mpno1amtn fcsls  2trxr ;t1opeoiocild m2rau s t0teerxf ta1fmtelivs;s  2xoxopnodalenlnct tfs2umu pou0aet ioetltlm2ranms;t4arenircta1oaD  ueols)srum(opnudlpt  ivi tf Dtmurpnt0altnifeiys sDrlu snt)aleoif oa1la   uesl(0trurxrpiu4lp   ieils  rurx  nu4tee  feiltlaDemnmon(4 ltrmfcio1fmtelu s (0 rxmxm3ou4lmeemfes tfsrurxmooo0tptnmfciat aDua(vo;(4alxomf iy1lpDe nvslt  2toir iu1am nlnesl(fartr( p;o0tlxn icildfsDumums t0aeeomrcootoaD luei;s0s2uo(r ny4op elivslt s2rmxm ;o4olxoifciad s eau p u0 lxnmocta1op r uvols) exrio3ou4lleelivsasf 2ua(roou1olt  iciatfa2rlnvo (4 ltoircoodlmDrlnesl(0srxrxopiudomt miet (f Dtr(moot4oetnmi3iasls rmnmsnt4tlxnmr3oa1om   u o ()s2umiopiu1lmee fvs ( srrrx oou1olxniictld aDrlnmsnu4tltrxf io1lmt lneo s)srxo(o3nu1optelncils  rrrx  ;t1tlenmf3ilt a2um(mo;t)artrif totlp  aivo;s  ruo(o3iu1ame lici ( sDtmxr nu1tpto i3tlt s ua( pn(4altomr oytlpteli o t0setrxopio1lpenmfeil(fa2um(rp;o0tee mi3iasfs ran p (4aetrmf oatfaDean s;( sexmiopno1llenlnciat) 2umx pot1ole miciytfm2em(vs (0aetoiociodfaD aivi;(0trxm(mpno1ap n ivsatf rurxmpot4apeniociat mDemn p;(4 rtrif ty1fp   i o t) 2trimpiydal eliei s)aDtax poo0aet  fetltfaDel(vsn(0 rtnxf3to1lmDe uvo;()t2trxm3iu4op nmnvia(f ruax pnu0tex ioetlsfsDeln s;t0altoxo3tadopDelivsls0texm(m3iudamtnmnvtlt)srur(rp;t0oexn feias s2rmnvont)trtnirciydfptrlu i;t s2umio no1om n iei t)sDtaum ;t1oleniictas mDra( p;(4texomr3oy1fm  anei;() rurim iodolt mfcilt  Duaxr ;t4oleoifciltls rau sn(4 rtnio iatlp r ueo ()srurxo3oydlltn ivta() 2um(mo;o4oexo ieiaslaDemnvonu0alxnxociatoatelivi;t texm(opiu4ome lncia( srra(rp;u4olt ioeiyt s ulu p (0aeeomocto1oaDraivs t t2umxrpiydal   iet t)a2uaurpnt1alxo i3tls mDel(vsnu4treoxr iadoatrlnvols0t2xmxo nodolt livtlsf rtrxro;t1tptn f3ias mDrl( p;u) rtrxfcia1lmtrauei;t0 rxmiopiy1am elfetl(fsrua(r ;u1tet mfetldfs2ul(msnu0teenxr oodoaD lies;t0 etrxo iodaleemiei (faDrrumpou4alx ioeiatlmDranvonu4texrifcoy1fp  anei;(0srtrxmpoy4ll e fetat) rur(m ;t1oet ifctadfm rlnvo;()texnir3oydoa rau s;(  rurim3iy1om e ici s s2tr(monu4tlxo ictat m em(mp u0 eerxf oodlateau slt srur(o3oodalenmiviat)s2umxm nu0oexnmo3iys a2umuvsnu) exomrcia1optr n i s truo(opiy1omee nes t  2rm(mont4tpeo fcild m2elu ont0alxriocoa1fp r iei;t srxo(m3nu1amt  nei s a2trum nt4ape mo3ils mDem(ms;(0areoif ia1fp elnvilt)teurio3nydapte ncs s  Dumu ono0alenmf3ild m uanmp ()aetomr3ty1oateluesl()tetoxrpoo4ll  mnesa(  rumu ooo1opt iiciytlm ea( p t)tltrmocoydlate ivs;(0 eurir ny1optnmictatfarum( o;o4texnio3tld sDumnvp;t4 rtoxo3totlate ivils trtoio oudape  ietlt)artru pou1altnifcildfmDuau s;t4alxoir3tadfm eaieo ()texrxr nudaptnmncslsfs2ra(ro;o4ope iictas a umn onu0trtriocootfp   nvo (0teuo(m3iodam   iesat)s2ta(moou0openif3tysfm2rl(vs;t4artnxocty1lpt  u i t)srum(rpiu1om nliviat)sDur(mpnt4ope  oeiatls ulu on(4 etrif3ootoateauvo;( teuo(o no4am  mieiat) Drau ooo4alt mieiydlm2emnvpnt0 ltomf iotlpt liei;s  rtm(rpiudlp elnvilt)a2tax p;o0altn i3ildfm uaumpnt) etrxr iodlmteli s t teum(opiudll nlictas)aruru  ;t1aex  f3iyt s ea(mo;(4tlenxo3iy1oate uvs t srxmirpno4lltn fvsltfsDtr( pot4optniiciadlsDel(vpnu)aexrxo3tydfm   i s;s)trxo(m3oydal e nei tfa2uaxmono0tee  fetysfm2um( o t)texrxfctytoat  uvsls0 eum(m3oo1am   ncsl(fsDtaumo;u0oee mociysfs ean pnu0tetnir3tadlpD luvsls  rxoio nydom e ivtat) rrmurp;u0apt moeiys m2ra(vsnt4aexnir3totop   n o;()sexo(m3no1ol n nctasfarra(mpou4tltnmociatlm eluvs;t0 rerxr3iy1opD ai i;s0texoio ou4om emicias srtrurpou4alx  fcild sDrm( onu4artnxf3io1fptrli o;( trto(mpnu4am e nesl()s2uaum ;t1teenmfeiadla ua( pn(4aeenxrcoytoate n i;(0teurir3io4lmtemncia(f 2rmx p;o4tlen f3tld m uluvs u4tltnxr3ta1oatr n s t0 2urxr3oo4oltnmfeils a2trurp;u4aleo f3iasla ran p;t0arenmr3oo1lp rlu i ()trxoio3no4alt  ivs sfarumumpou4tpt  fciat s eauvs;(4 lxoiocoy1fmt auvo;()texo(m3oo1aleelncsas  rrr( ont1tltoif3iasfm2ran p;(4 rtnxocoatop r uvo t0trtoir io1al emnetas)arrr( pnu1tpx mfeiyd s2um(vp;u4tleomocoadla   u i;( s2xmio iydol nmici tfsDum(  nt0oleomfeils aDemuvp () rtnmf oa1lm e ies s t2to(r3iu4amtemiciat sDrax poo1apeomiciat aDuanvsnu4artriociodlp  lnei;s0teumir3io4lle lfct ()aDrrxro;u4altn ieilsfs elu s u0 renircty1opDranes;t setmxrpnu4lp n netl()sDrrumoou0aexnif3tasla2rmu pnt0 ltrircio1latrlnvi s s2tmio3oy4ol   neils s2rmxmo;t1teeomo3ild a2umn s t4artrxf3io1fp  aieo s)srumiopio1opeemfvs t sDur(m nu4oex mi3iatlaDulnmont0alxnir tydlpt an i ( s2tmxmpno1am  lnci ()a2rrx pnt1aeeoiiciys aDrluvs;t0texoir oydfpt lu s s0 rur(rpny1lptnmnvtasfsDtm(mp;u0tpe  o3tadfm rauvp t0alxnio3iodoptr iesl(0srtriopnodom  mnviat  Drr( o;u0aex io3ildlsDrln s;u)teerxf oydomDe uei t trxo(mpiudapt lnct (f ruaurono0tltnifcias m2rlumsnu)teeoir3oatfatean i (0setr(mpnu1ol  mfvi s) 2urx pou1opt moeiatls2ul( pnt4trtoxf todfmtr ivi t0t2um(o3oy1ll  lnvi (fs2tr(ronu4aetoifeiydfa ulu p u) etnxf oodfptrlieolt0 eto(r nu4al   fcia(  Dta(  nt1aetoii3iad m2ra( sn(4tlerifcto1lmD lieols) 2toxm3oo4lleelivil( sDumx oot4apt  icilt a ranms t0aleoxocty1opDranvslt0tetrxm ny1lm elfctas srra(rooo4apxo fciydfa2raumo u0arenmr3oodlmte n s;t  exo(rpiy4apeemict () rraxront4altniietadlm emuvo () lxrxf iytlmteln s s)sexrir ny1ole mieilt)a2rrxm no0alxnifctatfs2rauvp t4 exoio3iy1fatr n ols)sexoio iu1apt micslt)arrm( poo1oee  f3tad sDrau o (4trenmrcoo1lmtranesls)trxmxm3no4apenmnesltfsrta( ont1olto i3iat s2uln snt) lxomf3iy1oa elu i;t0tetmim iy1lpe  ivt s)s2ua(m no1ope mfetatfs rln p (4artnio oydlp  anes;s)sexo(m iy1lp  lnvt (faDtrum no0texnmfciys s eauvp;(4tltrio3io1la  ln s s srxoxr no1apen ivi (farrmu o;o1tlen fciysfs2elumo (0 rxomo oadla rlnvs s s2xmim oy1ape miet tfs2rr(rpou0texnmiciytfmDeaumo;u0 rerxoctotfptr ivs s)srumim3io4ame  ivt sf 2ur( o;t0oex ii3iydla eau p;t0aexnir3tydlatranes;t)setrim3nu4ll elfcsas srtmxr nt1alx miciltfa2rm(vonu4aetomo3ootfaDeau o (0srumim3ny1optelnvsat s2ur(root1tex mfctltfsDranvo u0aetrmfcoa1oaDrluvo ( sexo(mpnudope  nctl()arra(rooo4teenmf3iysfa ul(vont)trtrmo3tadfmD  ivol(0 eurxmpiu1lp  lfet sfaDtrur nt1olx  f3tlsfa2elnvsnu)trtnxociotfpDeauvi;()trtrirpiu4lltelfvils artaur no4tee  fcildfm2rmnmo u4 rxoir3ia1omD  nei s)texo(o io4lm  mivtlt) Dum( ooo4tleomfeiaslm2rmuvp;u)alxomf3oo1lptraieo;( trtoxr3nu1llenmnvs t)a2taxrp;u4oetn ieiyt m2ua( p u0altnif io1fm eau s;s s2uoimpoodlltemncia(faDumuront0aeen i3iaslaDuauvs u4texoxrciadfpDr ies;t0 2urim3nu4lleemnvt t a2tm( o;o4aee  octysfsDrl(mon(0altrmocty1omD  i ol(0 etrio nodame mnetls) Dtaxrpnt1texoii3tadls ua( snt)alxomf3oytopte nesls0 2xmxm3nudap  livta(  Dtmxmp;o1teeoif3iasla2emnms ()treniocootfmDraneslt) 2tr(mpou1llt mnct t)a2ra( pot4tpe  oetysls2ulnmo u)trxrxo3ia1omD auvi;( srtm(o ny1lltn ncils)aruax  nu4texn icildla2rm( p t0 leoiocio1faD li slt0t2urio3nudope mnvt tfarumxr nu1oex ioctatfs raump u4teeoxfcio1fateau o ()srumxopoodlle  feias  rtmurpou1oetomieiyd m2rmn ont0trxoif todlaDrlu sl( trumxo iu1lptemfcta( a2tmxmonu0oeeniiciad m eanms u0aeerxf3to1fp elnesl() etoio3oodoleelncsls s2ururpot1teeoii3iyt aDulu o;u0aeeoxociotopDeanvsl(  2trxr iydol   feias aDurxm ;t0tetomiciad sDrmnmo t4 etnmo3io1lm e ies t  rtoxr3nydop emneias)srrru o;o0ole  oetlsfm2ul( o;u0aetrif iy1oaDrlieols0srur(o nudaleemnctls s2tr(rpou0apeomo3iadla eauvon(4teeoxoctydlp eluvol(0 eumio3iu4alenlncs s sDur(  ;u0opxo feild aDranmp;(0 rxoxf3oo1fp elnvsl(0sexriopnudaptnmfvtat)s2rmxmooo1oeenif3tyt s em( s (0 etoif3todfp eau i;() eumxr iudom nmfeia( sDtrxmp;u0tpenii3ils aDum(vp;t) rxoif oa1om elnei ( teuoio3nudlpt  fvtl(faDrax pnu1apenmi3ilslaDem(mp;t4aexomf totoateanei;t trurir oo1opeelicsl()aDuaxr ou4oeen i3ild aDel(mp (4tetoio3iy1lpD li ilt0teurxo iy1apte fctltf ruaurp;u4apxnioetytfsDeanmon() rxoir3oa1fpteliei s setoxm nu1omt  ietas)sDrmum ot1openiicias m2el(vs;()tetnir3ty1lp  livo;s0teto(rpnydopt lneils)sDrm(mo;u0alt  ieiatlsDran pnt0texnioctytla r ivo;()srtmio ny4ol nmictlt)srtr( pnu1tlenifciysfs2eaumsnu)trxnifctydom r nvo;s srto(opiudlltelivi (fa2taur oo0oltoii3tyt s rauvon(0 leomr3ia1om rauvols) rxr(o oo4lmtnlnvtls)aDrr(mpno4tpx iiciysfa uaumo;(4arxnmr3iadlat aiei;( sexr(m3ny1omeelfetatf rurxmpot4tpeoii3tldla eanmp;()alermf ty1lat  n s t trtoxm3io1lpeelnesa( arrm(rp;u4oeto f3iysls ra( s t0 exrir3iadfp e i o;s trtm(mpiu4op nlnvt t sDrrxront1apeo f3taslm um(ms u)texnmr ootom ean i;s t2toir3oy1olt lnei ()aruaxmpnu4oexnmoeilt a2uluvon()arxrmo tydlmte n o t)t2ur(o oy4lpt livi ()srrmumpnt4tlt ifcils s2ulu o;t) etnmfciydlpD an o;t)trtr(r iodlp nlictatfa2uru  ot1tlxn f3tatfa ua( s (4 exoxo tadomt lneilt0sruo(m3nodapt mfvilt srtaur ;t4oltoiiciadls2elnms;u)arxnir3oo1fmDr ues () eurxmpoy4lp emfctlsfa2uru p;o1oltoiiciysfa ea(von()trermo iotfate ieo;s teuo(r3nodame  feil(  Drrxr oo4tpt mo3iatlaDuanvpnt0trenmociydlpDrlivi t s2toxm3ny1ll elieilsfs2tmxmo;u0aleomfeiys mDulnmpnu) reoio3iodfptraiesl() 2xoio iodap elict t  rurx pnt0tlxo ictad a2uan s;(0 leoio3oadfmt ln il( teuoxopiu1amen ivil(fsrum(  ot0tet  ietaslsDul(mp;u0altrmo3to1opD anvo (0sexo(mpiy4al  lnvsl( arrmum nu4alxomoctys sDrmuvp;(0 ltoirctatlaD ai s;s0 rxo(opoy1ap eliciatf rrrx  nt1olx  fciyt aDel( ont4texrxf3tytop   n ols) 2xmxrpio1om n ieslt srtrx  nt1olxnifciat mDum(monu)tlxnioctadlmDran o t  exoim3iydlp emfvil(faDrrx o;t1oee  ieildls2rlumonu0 lxnxo3to1fat livilt)teuoxopou1optelnet (fa2ra(root1apx  i3iat m em( p;t0arenircia1opDe n o;s tetr(o3nu4lmtemfeslt arra(m ;t4apxoioeiyt s2uanvp u0 exrir3iydom eln s s0t2urim3io4om nmnvt s arraxro;u4aexnif3iatfmDemn p;(0tltrif3oy1fpDr uei t  etr(o3no1lptnmivi t)a2rax pnu0apenmociat aDuln pnt4artoiocoadlaDeanes;(0 2xmirpiudopenlnei t srrm( poo0olen iciatfa2rlu o t4tltrmf3iatoaDrau i;t t2tm(m oo1lp emicsas)sDtr(roou4tetnmocilsfs2el(mp;()arerxo3tadfa e n ol() rxrio3nudapenlfctlsfaDrmum oo4alxnmieiaslm2ra( o u0alermr3totfmteanei;s)texoimpoy1omtemnvt ()arumuroot0ale mietlt a2ua(vs u4 ltomo iytlaDeluei;( s2tmxo3oydalt  netlsf 2trx  no1oet mf3iydls2rl(vp u4aeeoir iadlaD  i o t) euoxr iy1lm n ieiat  2umxrp;u4olxoifeiys aDeluvp t0 ltrxr tytla ranvs;(  eurxo ny1ap  mivsatf Drmurp;o0apeoifeiasfaDulnmp;t4alxomr ootomD  n o;s  euo(m no4ap nmfeias a2rrxroou1altnmiciatlm2em( snu4trxnmociodlptrauei;t) eumxr nydlle  feilsfa2umxrpoo0tpe mieiadlmDrm(vsnu0alxrxr tadopteaneo ( seuoxo3no1altemivt s)aDrm( ono0tlt  i3iltfm ra(ms () rtrmo oo1fm e uvols)trtoir3no4ole lfvsas)aDrrx pot1tlx  iciltlmDuaumpnu0tetrxfcta1optrlnes t) rurxm nu4lle livi sf rumxmonu1aeeoio3ildls2rmnmonu0arenmo oa1lpte uvi t setrxrpiu4omt livtas) Dra(mont1olt iicildlm ean ont0tetoifctatfmDr iei s  etrim3no4amtnmnctlt  2tm(ro;u1oexn f3ils sDel(von() etoiociytfpt au o s0trxoir3nudom elnct s) Dtmxmooo1tpe moctlsfa rl(vo;(0 lxnircootlaDelnvo (0 2uoir3iydame  fesas) 2rmuroou0aetn oeiatfaDrm(vp;t4treoio3ta1fpte nvi (  rtoxm3oudapt  iei sfs2raxmpno1olt mocilslm2um( p;t0altnmrcoy1fm ran ilt0tetmio3oudlmee nvtas srtr(  ot4tpxnio3iys sDua( pnu)trtoirciatfa  an o;(  exmxo3oydllenlfesasf 2trur ;u4oetn oeiadlsDul(vo;t)trtoxfcoytfmtrlues;t0seurxr oo4omen fei ()arurxm nu4alxnmo3iydlmDumuvo;(0artrxocoadlmD aivolt teum(o ny4ope  neia()aDuaurp;o4aetniociltfm eauvpnt)trxnmo tytfpD au sl( t2to(r3nodlmt micilsfartm(mo;o1olx  f3tltfsDra( pnt4tlxoifcio1omte nei s) 2xm(r3iudllt  ivsa( artrx  nt0oltomi3tys m ran p (0alxrirctatfateaneo;(  eur(m3no4al nmicsa() 2raxmonu1aexomieiatfm2eanvo t0aeenmocootfptrlnvi ()trur(opoo1apenmnet (farra( pnu4tlx mieiltlmDel( s (0aeenxfciydopD li o;s0t2xoiopnu1op nmnetas  2umumoot4opeoiiciydfm2rauvp (4 rxrxrciotom elnvs;( t2trim3ny1opeemfeta(fa2tmum ot4tee ioeiydlsDraumsnu0arerxocoo1om r nvi t setm(mpiodlle lfcsatfa2raumo;o0apeoiieiltlaDemnms;u0trtrxo3tydfpteln i;s0setm(opiu1lltelict ()s2taxmp;o4apt mfctls mDulu p;t)aetrxo3io1fp  auei;t  etoxr oo4oltnmfctat) rra(rono0ope  ieildls ran o t)artoir ta1lm rlueil( trxo(opnydlltemieslsf Dtr(rp;u0tpto ictyt s2rm(monu0artrmfcoytfmDe i ols)t2xr(m3iu4al nmfcslt srua( ono0tlxnmfctyd m2elumo;u)tleomrciy1op e ies;t srxo(opno4om e fcs ()arur(  no4alx moctlt aDea(mpnu4tlxoxrcoodoptrlues;t  rxrxr3no4ome lici sfs2taxrp;t1olen fciysfsDel( onu0alxnxf3oytfm elnvi;(0 etrimpiodlmtelfcil( sruaur ou1oleo f3iydfa2rlnmont0trxnmo3tytlpt lueilt seuo(mpou4ll nlivtat)sDrmuro;u1ole iieiadlsDeauvpnt4 ltomr3tadfpDeanvolt sexmxo ou4am n fvt t  2tauront0apxo i3iad a2emn o (4trermociytoaD auvi;(0t2uo(m3iydam nmivtasfsrua(mpnt0openmietasls ua(vs ()teeoxo3ty1fp  anvo;t)srtoim3oo1apt mnvtlt s2rrur no0oeeomietytfaDrm(mpnu)teeniocty1la r uvi (0srtm(mpoo1openlivslt  Dumx p;o1oeenifciytfs ra(vont0arerif3oo1lmDraueo;( sexr(m ny4op elicsasfs2ur(r ;o1olenmo3iltlm2ul( snt0treoif3tatop  aivslt0s2tr(opiudlpe lncilsfarum(m oo1tet mictltfm el( o;t4tleoio oo1omD  u i t srur(opoudamtnlfcias)arta(m ;t0teto icils s2um( s (0altnxfcoatfp  ai s;t0sexrim oy4omteliviltf 2ur(m ;o1olx if3iyd mDum( pn(4texniocio1lpDrauvols0 2to(opio4lm emfcil( aDrr(rp;o4tetn f3tadfs rl(vpnu4 etoxr3ootfat livils)trxm(rpou1ol n fcsa(fsrrmurpot1oexoii3iytls emu p;(0arenxocoydop  lu i ()teur(o ou4am eliei ()aDtm( oou0aeen oeiydlm uanvo t4 ltoxo3iotlaDelnvs s0truoxm3oo1al elfes s)sDrm(mpnt0tex mieiadla ulnmp t0 ltrmr3io1laD  neolt)t2ur(r oo4lmee fvtltfsDraur ;o1alxnio3tytfs2rlnvp;(0trenir3tydfaDrlivslt  2toxm3oy4lpe mfet tfaDum(mp;o1aet iicilsfs eln s t4aexrxr oo1optr nei;t)t2ur(r ou1lle lncsa( s2um( ont4tlenmfctytlm emu on() etrxo oa1oat  i i t teum(rpno4apen netatfa2tmur no1tleomfciatfs ea( pnu4 etnxr3tatlmD aneols)s2tm(r3oy4ome  nct tfs2tmxm oo0tpxo ieiydfsDrmnms;t4 rxomf3io1fa ean s;t t2urxrpou4om   ivil(fs2um(moot4tle  i3ils m rauvs (4 rerxf3oy1lmtelieo s0teumxmpio1optemicil()aDtmump;u4tetn icild a ua(vp;u0altrmr tydfa   i ils0 2uoimpoo1op  mivtas aDrauro;u4openioeilsls2rmnms;t) lenxo3tadfa rai o;t)tetm(r3iy4ap n ieta(f 2ta(ronu1tpto feildlm2ua(msnu0tlxrxociytlmt aueo ()t2uo(opnu4alt  ncia()sDuaum nt1alenii3tldfs2eln o u4 eeriocoatlmt luei;s texmio3iy1om emics (fa2ur( o;u1tex  fetydlaDrmn on()tlerxrcto1la rliei;(0s2toir nu4lm n nvt s)sDraxmpoo4oex mieiad sDraums;t4aexrif oodop  aueo;s texoirpnudomtelfci () Drmurpnu4oetoiocilslm ranmo;u0 lxrir3oadfmDrluei ()truoxm3oydol nlfviltf Drm(r nt1olto ociaslaDeauvs;t)artrmociy1la r uvi;( s2uo(r3no4ll elnei (  2tauro;o0oltoii3iydlsDrmnmo ()treoiocoadlaD an i s  2tmimpoo4lm e nvsat  Dtax pnu4oeto fcias m2uluvs;u0tlxrxr3ia1opDe n o;t setrim nudlp elietltfartaxr nt4aet mfcild m rlums;t4alxnio3oy1fp  anvsls sruoirpnu4al n nci s s2ra(r no4oet  icildlm eln o;()trxoxf3oydlpDr nvsl(0 2uoxopiudoltelicsasfs2ta(rooo0tlt mo3tltla el( p;u) rxnircio1laDr i s s0seum(rpiy1op elfei ()s2ra(m no0oeeo f3iasfa emn o;u0treomo iodop ean il() 2tmxo nudamtnlieils)a2rmuroou4altn i3tadfm uan p u4 rxrxocta1op rauvi;() rxoxrpoodoptn ieils)a2uaumo;o0aptomietlt aDemumsnu0trtrxr3oa1oa  auvs (0 etmir3oo1omee icsltfaDuaxmono1oexn ociltfmDrmuvp u0aetnmr3iydfpD lnei;s trur(r iu1opte fcsas a2raumpnu1tpt ifeiasfmDuln onu0 lermo iadfpt lueilt0srumxm3iy4lp nmneias)srrruronu0oex  octlsfm el( snu) lxnif oa1lpt  u o;(0 exoxo oudal  lfvi t s2um(mo;u0tle  feiltlsDel(vpn(0teeniocoodfptr ieo;t teuoio3nu1ope  ivtls sDtmu o;t4tlx moctas s ea(vs;t) eenif3iatlpDraivi;t  rtoxrpio1lpt livtl()aDtrx ono4tltnmoeiytlm2ra( s t4tltnif iotlat lnvslt0 rxr(mpoy1optn fvilt aDur(  oo4open oeiyd a el(mo () ltnxo3ootfmD lu i;(0 etm(m3no4om n nes s)aDta(r nt4aetomfciatla2eluvo;t)aeenmoctatlptraivslt0texmimpnydlpen nvilt arrmxm ;u1alt ifctasfsDrl( s t)aeerio oytoa  ai o () rum(m3nu4lp  mfeil()srrmu pot0olxnmfeiytlm2ul( s;() leoio3tytfm  aivi;() eur(r ou1am nmnetls sDrmx  ot1tlen i3taslm elnvpn(0 eeomo oodlp elieo ( tetriopiudlmen ieslt  2tm( pnt0tpen o3ild a emnvo;t) rerir oatlatran ilt)trto(o3nydamt lfcs t a2tmx pnt4apeo f3iatfa2emu pn()arenifcoa1lmteauvs;( t2tmir ny1omee ivsas s2ur(rp;o1opt miciysfaDran pnt)trxomo oatfp rai o;t0s2toir3iydlm nlietl( sDumx pnu4opt  o3tysfm2rl( p t0altrif3oytlp eln o (0t2uo(rpoo1op  lnci (f Duaum no1tetn oetatls2rlnvp u)arxnio io1omDeluvi;t  rtrxmpnydap emnviasf Dtaxr nt1aetn ieiad sDeluvon(4altoxrctodfp eau o () rurxm iydapte nvia()arrm(r nu1aeen f3iys s2uanmsn(0alxnxr3oa1fm  an s;()srum(rpiy4am elicsasfsDtmuro;t4opeomf3ild a emump t4 rxrmo3iatopDr n o;( texoio3nu4altnmfcil(farrax ont4alen oetydfmDeluvonu)tetoxf iodfmt aiei;t) eumio3oudlleemfvsl( s2umxmpno1tptn iciydfm umnvo;t4tltomociytlat auvs;() etoimpio4lmtelivsa()arraxro;u4tlenii3iyd m ulnvs t0 exoxr3iatop  luvs;t t2umim ou1lmee netas) Dua(  ot0aptoiieiltfa2rmuvp;t)teeoio3oy1omteaieo s teuo(r3nodlm  mfet ( s2ua(r ot1tpt mfeiadfmDumuvo u)tlerif3tatomD  n ol(  rtrirpou4op e ivtls)aDtru ono0tpxniiciatla2ea( p;()tlxrir3iotla eaieolt)s2xrxr oo4lm elfeils srtr(rp;u4oee mo3tyslmDel(msnu0aetomo oodla  auvo t0 rtr(mpny4ll emfvils a2urumpnu0oetomociltfa2umu on(4 lerxo iytlp  lieol()tetmir ny1ale lnetls aDuaxro;o1tltn oeiatfmDua(ms t)altrxo tadfmD  nei t)trumxo3ny1alt lfvias) rtr(r nu4aet mf3tld a2ulu s t0aetrir ta1lpt ln i t0sexoxm3oy1lleemfvi s) rurx  nt1apx ii3iltfmDel(mpnu)texrmo3ootfp  anvs;t  etoio3nudapeelivs sfa2ua(rpno0altomoetld s em(msnt4 ltoxo3ta1op r ivsl()t2xmxrpou1ame  icsa(farrm( p;u1aexniocildlmDrm(vp;(4aeeoxrcty1fa rau il(0seto(m oy4am nlnet s)sDrau  nt4altnif3tlsfs el(ms;u0aexnxrciotlmDeaneslt0t2tm(mpoodoptemieta(fs2taxroou0tpto f3tyt m2ul( on()arenxf oytfaDeanvo t trumxr oy1oleelicsas)sDtrxront0tpxn f3iat s rlumsnu4tlenmf iy1oa raivo t) euoirpnu1lleemfvi t  2rrxr nt0texo ociasfsDel(vsnu4aexoxf ootfptrauvs;t0sruoxo3oodlpt lnvi t)arrmum ou1apx io3iad m2umnvo u)texoiociadop rlnvi;s)texoirpny1opeemnetas)aDur( p;t0oleniieiytfs rl( o;(4 lenmr ty1lmD livs;t0 etrxr3nodlmtelnvs ()a2ra(rpnu4aex  ociyt sDea( s u4 lerif3ootlmtraieo;s0sexrir iodal  mieil( sruaurpnt1ale mo3iad a eln p;u0 reoiocto1lpt aivo;s t2umxmpiy1lpenmfvs (  Drmx ono0apenmoeilsla umums t4trtoxfciydfa   uesl(  eumim3nu4oleelict t  2rr( pot1aetnmi3iltla2ra(vs;(4aeeoio iodomDraivi;s trumio io4lm elfetls)srurur no0aexnmi3tld mDel(vp ()tlerif3iytopDr n o;t0 ruoxo3iydol nlfcias)sDum(m no0alenmfcils a2rmn sn(0arxrxr iydlp rlnvsl(0 rtmio3iy4al e icias) Drmurpnt1tetnioeiydfm rauvp t4 lerxfciodomDe ueilt0seumxm3oy4opeemnes t)a2ta(mono1aex  fetaslaDua(vs;t) lxoif3tytfate i ilt0seurxmpnu4apenmieil(  2umu ono1teeomietas a2rl(vpnu) rtrxf3to1fp r nesl(  rumir3ou1lmtelfvs s)s2umumonu1oexoif3iad sDem(von() renxfciodlp r u ilt0 2uoirpoodom  licsatfartru  oo1aetomicilsfsDrmnmo;t0tlxomo3oa1fptrluei s0sexo(mpoy1lp n nvi s  Dumxmpot1olenio3tytfmDra(vpn(4arxoif iy1fatranei t trtm(m3nu4ole licil(  rtm(moot0optnmoetyt mDul(mp;t4tltomr oodlmDeauvo (0t2uo(opnu1ale  ietlsfsDta(mooo0tltoifctyt m2ulumsnt)teeoircia1opDelu ol(0s2urxm io1oleelivtas  2umx p;o0teenio3iydfmDuauvpn() eeomociodfaD  u o;(0s2tr(m3iudomt  ncsa()arrruront0tltomoeiad mDrmnvsnu0trxnxf3tydlp eanvi s  rxmir iydape  ncsat s2tr( pot1tet iiciad aDrl( p u0trxrio3iy1omteaivs t0s2trio no4amen ivtat) ruaxrono1tpxomiciys s2rm( p;(4tltnmf iytfaDr ivslt0sexmxm ou1ole licsat)aDta(moot0tpenmfcild s eluvo;()trerif3ta1fa rauvols teto(rpiu4alenlfetl( srtru  oo1tpxoiieiad a uauvp (0trtrxo3to1la eluei;t0 2um(o nu4ap nlfci t) rraurpno1opt iietldfaDuanmsnu0 exnmr iodoaD lneols trxoir3no1lp e ivs sf rumx pnt1aptomo3tytfsDrlu p (4trtoxo3oa1fpDeliesl(  2umirpiy4apt mfcta()srraxr ot1alen ociatfsDumnms;() eeoxf oadfptr n ol(  euo(m3iy1olenlfctlt sDrrurpnt0apenmocildls rmn o t4 lxrifciotlp e nvo t t2xrio io4am n ict tf rrm( poo0tltnmfciat s emu o;t) rtomr oy1lmDrlu slt  2urxr oodll emieiat)sDtm(m ;o4alto o3tlsfmDumu ont4aeerio3tatlpte iei;(0trxo(r nu4aptn iei t)sDurxront1aetn ictasfs2ulnmpnu)trerir oodlmDraivils0 rumio oo4lme  fvta(  rtaxmooo4tptoiiciat mDeau sn(0 eerxfctydfa elies ()seto(r3ny4lmtn fesls)a2rax  ou0apeo ociysla rm(msnu4trerxrcto1fmtr nei;( t2toir3oy1lltelnvs t)srumx pnt0tpxoiictldfs ranvp t) rermr ty1fa rli ilt texoiopny4alen nct s  Dumu p;u1alenif3iytlsDrlnvon(4altnxocia1lmDrai i (0trtrxo nydal nliviat) rta( o;u1apxn feiltlm rmumo u0 rxnxr3oatfp r iei;t s2tr(rpoydopt lnvs t) rtrurp;u4tpxoifctatfm rm(mp;u) eermf iotop elues t texoio iudoptnmnvsat) ruax ooo0tptn iciysfa rmump;(0artrxo oy1faDrlnei (  rumim iy1omt  ncsa( a2umumo;o1tpt mociytlaDea(ms;u0tetomr oo1lp e i i ( trtoxopio1opeemnei s)s2rrxmo;t4oltomfctytla2umuvpnt4aetomo3todlatranei () 2xm(rpno1alenlnvsltfarrrxr nt0oex  ieiatfm2rm(vp ()altoxr3tytlp rli o;t seurxm no1alte fvslsfsrtaxm ;u0ole mieiytls rln s u0 rxoircoo1fpDranvo ()t2to(rpoy4lpte ieia(f rtaxr ;t4apt  o3iyd s eaums (4trxnxf iodla eai o;t  rurimpiu4ll nlnvia() rrm( ooo1tpenmfctasla rlu p u0artomo3ootlpte nvi;t0t2urxr3iy1ll  lfvtlt)a2tr(mp;t1tpe  iciys aDeluvpn(0aleoxo iy1fpD lneols)tetoxm3nu4al  mnctat)arraxmp;o0tleoio3tysfaDrl( s;t) rxrxfciytlm  aneo (0trtrim3ny1omtn ivs s aDtm(r nt1apxoiictysla eluvs;(4 eeomo oy1faDrlieo s) 2xr(r3iydalen iesasf rum( ono4teto ieildfs2umu pn()altnmrciadfp eauvi t)seuoiopno1lpenmnvias) Draxr ;u4ape  ictytla rm(mpnt) lerircoytfmte ueo t  etmir oydom  lneias)arrrump;o4tpx iictadfaDum(vp;t)tlxnmr oa1lm eauvi ()setoir3iudlltnmfei tfsrurx p;u4aeenmoctytlm rmnmsnt4aeeoxfciatoa  aivs t)s2tmio3nudamt  iesa(  Dtm(m ;o1aex mf3tasfs uau p;t) rxomr3oodlmt an sl( srxr(mpnu4omeemfct tfsrraurp;o4alx if3iyt aDrl( o ()teermo3iytfp  lues;t)t2um(m ny4lpte netl()srtau  ou1alx mo3iat mDranms u0 lerifcta1oaDeli sl(  rxmxo iy4oltnmivsas artmu  nt4ale  fetytlm uau o;()artrif todfptr nvs;s0s2umir oo1lpt mnesltf Dtaxmo;u0aeenii3tad mDea(vs;(4 exoiociy1fm eaiei;( s2xr(r3oudamtelies sfs2ur( oou4aexnmiciaslm2rl( o ()tlxnmo iadfpD livsl()trxm(opnudom n ieil()aDraxmono1alto octadfa2rmums u0teerif3oadoptranvo;t  rto(o io1alen fcia()srrm( p;t1tptn ociydlmDuanvo ()artrxfcio1lmD lu ol(0s2trio3iu4lm nmfetlt a2raurp;t1alx  o3ildla umnvp t4alxrir iytfmtr i o;t  rur(rpno1lpen nvsat) Dtm(m no4oltoioctytfa ua( pnu4tltoxo3oytfateluvo t s2ur(opio4oltnmnci tf rumump;t4oet mfciat a2rm(mon(4artoirciodfaDr iei ()sexr(r ny1lmte fvs t sruru  ;t0aleo fctltlsDra(vs;(0arxrmf oatopD ai s;()setriopoo4ol e nvi sfs2tmur ;u4olx mfeilt m2umuvpnu0 eeomo3to1laDrai o;t t2um(o3no4lmte fciatf 2rmu pou4tlt mo3iyslsDuanmp t4 leoir3io1oa eliei t0sexr(r3ny1apeemfvsls) Dtru  nu0tlxnmo3tat a2umu p;u4aleoio iytoaD aneo s)trtr(o3io1llt  fvtasf Drr(mpno1tee iiciadfs uln o t) rtrxr3oadlat aueo;s setmxmpnu1ome mnetltfs2taumpou1alxoifeildfaDua( p t0trxoir to1oaD lnvol()t2xrxrpoo1omtemfetlsfsDrmxmpot4olt ifetlsfm2eanvo u4artrxf3oytlp rli s () rxmio3no1olt  fet sfsDuax  ;t0opt ioetysfaDrmumo t0 rtoio oa1la  an olt)tetm(m3iu4om emneias)arra(mpou4oeeoioctasfaDean s () ltrmo3oytlat  n s;(0 exr(mpio4amen ivia()sruaxmont0apxo o3iyt a elu ont)treoxrcto1fpD anvi;s0 2xo(r oudlmeelneils a2ra(mp;u4tpx ioctad mDemuvs;()trerir3oa1fpt li i s tetm(o iodamenlfct s)srumx o;t4oex ii3iatlaDeanmo t4 lxrio3to1laD  n s ( s2toxm nu4omtnlncias  Draum ou1tlenmoeiytfm2ul(mp t4 lenifcia1fm r nes;(0 eur(rpnu4lleemnciat) Draur ;t4tptomfciydfa ea(vs;t) eenmo io1fat  n i;s0trxo(r3oodol  lnetls  rrrx onu1optniieiyt m2em(vs;t)tetrmrciy1late u o;s  eto(opiu4op e fesl()srurxmpnu4teeomfeildfa2ea(vp;t0tlxnxf iy1opD  ieols0truriopou1alt lictlt aDururont1opt iiciyd aDemuvp u4aetnxfciadoa  lnvi;(0 rtmxo3io4ape lnvtat aDuru pot4tlx mieildls2rln p;t4artoircia1lmtrlivs ()s2urir3no4al n ivi t)s2ta( oou0olx  octydlaDranmo t4tltrifcoo1fpDelies t) eumir3ou1alen fetasf ruaxmont0optnio3tatfm2rmumsnu)tlermr iotomDean il(  rxmir oodllenlnviasfartmu pou1opt iociltfm2ea(vp u) rtniocty1fp  lu o t)texrxr3oo4ll  mfviatfsrrm( o;t4oexo o3iaslsDrmumo;t0 rxrmfcoytfpD  uvol(0texriopou4amt liciat) 2ua( ont1tpxoiictlsfsDea(ms;t)teeriocoadfmtrauvslt setrxr3iudll e nes ()sDtaxro;u1aexniociydfs2ulu o;() lxnir3ty1fp  aies t0t2xmxopiudomtn fviatfsDrau o;o4oeen f3iyd a ua( p;(0alxomocoadomt lu s;(0t2to(o3ny4lp n ictls a2trur ou4tltn icilslm2rlnmo;t)tltnmociadfaDrlieols  etrir iodomtemfcsa() rumx ono1tle  i3tldfsDrm(mpn(0aetoirctodomtean s ()texoxr no4openlnesl( srumxm ;u0alto ocils m2rl(vo t0trtnxr io1fm  anvsls texo(m3iu1om   iet s)arumu p;t4oleo fciydfsDrln s;u0aetnmociytlpDrlies;s)seumxr ou1ol n fet ( aDtm(rono1aee mo3ias m2rm( o ()aeenxf iatfpDrlivol( s2umio oo1amtelivi ( sDtrur ;u4tleo icildfm2rl(von(0arenir3oa1oa r ueo;(  rumir iodole lfei ()a2ua( p;o0olxoii3tldfsDua(mo;()alerif tadlmt auvo t teto(opnodopt mics (fa2trxr no1tex  fciydfm2emn o;(0trtriociytlat  uvolt0trtrxm3iy1llt liesls a2ta(mo;u0apt  ieild sDemums;(4 rxrxo tytfpD lneo;s)sruoim oy4omt lfvsatf Draxm ot1teen oetadfm ulu s;()trtoio3iydfp elivs;t0 2xriopny1lm nmieslsfs2rmurp;o4opeoifeiaslmDrl(vp u4treoif3iotoat livsl( s2urim3oydop e ncs t)a2urx  no1texn feils a2emn s;u0artrxo3ty1fpDrlu s s) 2xmxm io1ol  lfeilt  2rrum ;u4alt mfciat a2elump t0aetnioctadoa  li i;t0trtoiopny4lptemivtlsf Duru p;o1oltomoeiatla em(mo;u)tltrxrciatopt  u olt)trto(mpno1aptnmfcias)arra(r ot1alxnioeiytfmDrl(mp;t4tlxnxo3iytlaD ai ilt  rxm(m3io1omtelfctltf 2tmu  nt0optnmfetydfmDeanms t4 exoxo3iadoatean i;s0t2tmirpnydam elfvils)aDrr(rpot1ape ioetldfmDelnvonu4artomr3oa1omt  n o t texoim oodop nmfvslt aruaur nt0alen oeias mDumnvp;u4 rxnxr tydopt  n sl()srtmxm no1am nmietltfsDtm(m ;u4optn octltlm2rlumsnt)teerir ootlateln s ()setrirpoodol   ncs s  rtau pot0openiieiasfmDrlumo;u0teeoxrcio1faDraieol(0 etr(o ny1ole  netat) rrmu  ;t4ole ifeiaslm2eluvp (0trtrio oytfpDran ol()setrxmpnodom elnvslt srtmx p;u1optoii3tldlm ulu o (4arenircio1fatrlnvs s  2xm(mpiy4ll  mfvsl(  rum( p;o4opxoiiciaslm rmnvp u4alermrciodfmDrln ils0 2toimpoydol nlicsltf rur( p;t1oleomfeiys aDrl( o;(4 exoxo iydla e i o;t0 rxr(o3iodapeemnesas)artrxrpou0optnii3tytlm ulu o;t) lxrmr3io1lpD livi;t0 etm(mpnu1lmte fvsltfsrrru pnu4oeen fciad m el( o u)areoxo3iatoaDeluei s t2uoir3oy1oltelfetls)a2rau  nu4tlenmfeiytls eaumo;(4texoircoo1fpt  nes ()tetoxm3oy4lpe  nvilt aDum(mpnu1alxoifcildfa2elnvs (4 lxoxfciy1opte n o (0t2ur(m3no1am e fci s srrmumooo0alxomo3ilsfa emnvo u)aexnmf3iodomDr i s s0 euoir3iudapte ietlt)sDtr(rooo4tpeoif3tlsfaDrauvp;u)teenxr oadfp r nvs;t t2uoio nu1am elfes ( a2uau ooo1tleo fciyd m uau p;(4tlermoctotfaD  nvilt)t2um(rpou4aptnlnvia(f Dumx o;u0tleomi3iaslaDranvs;() rxoxf3oatfpDr u sl(0s2xmim3io1omtemncsas sDua(r no4alenii3tldfm rl( s;u)alxnifcto1oatelneo;t srxrxo ou4ole mfei sfsrrm(rpoo4tpxniieildls rlnvo;(0aetrif3iatla rli s s) rxoxm io1lm  lnvtasfaDtmxronu0aeenmieilt s el(ms;u)teerio3iydfpt lu olt0trxr(m3no4lmt lfvt () ruaxm ;o0aexnmoetydfmDulumo;u)trtrifctytfaD  ueo;t0s2uriopoo1aleemivt tfs2rru  ;u0ape moeiysfm rluvont4trxnxfcoy1fm  lnvo (  rxrio oo1aptn ncslsf rra(rpot1olx mf3ias sDea(vs (4 eenif3ootlatr u sls0s2xr(m oydamtelictat  2trumo;t1aex iociytfa2rlnvo t0 lermo3tatfp  auei;s) eurxo oo4al nmieil(faDtrx ono1opxoifetydls2uaumo u0aeeoir3iodlaD  nvo (0trtrxm nu1omee feilsfa2ra( ooo4opxnmociytfmDea(ms;t)tetomf3iotopD anvi;s) ruoimpoy1lm e neia(  Draurp;t1olx  ieild a2em( p () rermf3iydfaD  u i;t)t2trio nydale mieiasfa2urx o;u4altniieiydfs rmn p;t)arenmfctatfmtrln olt0seto(m iydaleelfcsatf 2ta( ont4oeeomieiytfs2em(mpnt0trtrir iydom   nvilt) 2uoim io1ome mfet sfsrrauroot0apenmictyt m2em(mon(0aexrmfcoy1oaD  uvo s)trxm(o iydoptnmnet s) rur( pnu4apxn ieiys m emnvp;u0altrmr3iatlmtr n o s)texrim3no1lpt  ivtl(  rtmxmono0opxo ociltfs rl(vs;u4 rxnxo3iadomt li o;t)t2toir io4alt mfviltf Dtm(r ;u1tpxnif3iydlm2rlu p;t0tlenir3ty1opt lnvi;s0 exrirpoodolenmnvt sfsDtmurp;o1aet  ictysfaDulu o;u0alenif ty1oa ean il() exrxopoudlpe lfet (f Draxro;t1opto i3iysfa2em(vo ()teenif todfa rlu sls sexo(m3io4ll nmietls)srur(m ;t4ape mietasla ua(vo u0aleoxo3oo1opDeanvi s seuoio oy1omen fvtlt)aDua(mpot1aleo ictyslaDeau p t) eeoifcootla   ieo;s0 2uo(m3iudllt lnvtlt)sDurumoou4tle ioctysls em(ms t0 lxrxo oa1omD au ol( srtmim oy1altnmivi (  Drrxrono4olxo i3ildfa uauvo;t0arxnmrciodfmt  u s;s0s2toim3no1ap elics t)s2ra( pnt1oltomiciltfs ul(vp () exnmr iy1fptrlu o t0 etoxm3oydalt  ict tfaDumurooo4aet ifeildfa el(msnt)teenir to1oateli il()s2trim iodlmeelnct s)sDtax  ;t0olt moeiltlaDuauvp u0aeermrciy1opDeluvo;s)srur(m3iy1llt miet t) rtm( pou1tpt moctldla2eluvs;t0aeenxo tatfa eaneo ()trtm(o nydaptelicilt srrr(  nt1apxnmoeiatla rmnvsnt) etoxr tatfpDrauvo;t)teuoxm ou1lltnlfeia()a2ta(  ;o0tltomfeiyd a rm(vp;t4aleoxr3iotoptrli o s)s2xmir iy1lptnlnesltf rrmumpoo1tlx mo3tld m2ulnvs;t0aexnifciy1lp e ueo;s tetmimpno1lp nmnvi s s2ua( o;o4alxo i3ilslm rln o;(0alenmf3iytfmtrlnvo (0 eur(mpiydom e ivt ( arrmxmo;u4tlxo fcilsfa umumo;t0arxrio3totoa elivi;s)setm(r iu4olenlicsls) Drr(rp;u4tleomo3ildfa2rlump;u)aexnxfciadom rauvs;s)setoirpoydame  fet (fsDuaxrpnu4aexnif3tldfa2ea(vs;(4tltoif3oydfmDrli s;t s2tr(r no4om  mfvsl(f Dua(rp;o4oee if3tadfa emuvon(4 etnxocoo1faD anvilt)trurio3iy4llen ncia( artrx o;o1aptoiieiyslaDuanvs;t)trxoxo3ty1faDrauvsls)seurio3nodolt  ici tfartr(r ot4alx iicilsfmDrmnmo u4aexnmr tytfp   n i;(  2urxrpio1al emivs ( arrmx  oo0optoio3tytlm em( onu)trerxo3ta1lm   u s;s  2toxm io1opeemncias)srumxm ;o4tpxn oeiadfaDul(vp () etnio3todoa eaieols) 2xoio3nodlp emncia() rrru  oo0tpxomictysfa2um(monu)tlenxf3iy1fa  aues ()trxo(m nu4lm elfetl( srrmu  ;t1tlen o3iadls ra(msnt) exnioctadopt  uvi;s0srtrxr no4llt livslt)s2urum ou4apenio3iytls rlnmon(4altrifcta1lat lieo (  etrxr ny1lp  mnesl() 2ua(m nt0olx mf3iytfa2uau o t)tetoxocoydop  lues t  2tmim iydol  livi t)s2trur no0optnio3iadfm ranvp;(4aexoiociytomDr ueo ( seumirpiy1lmtn fcias  Drr(  ou4tpeoiiciat m2ulnmo (4teermo oa1oa  ai s;s)trxmxr iu4ap  mivsa(  rta( ooo4aexomociysfs rl(vp;u4 rtomrctytopDrai i;s)t2umim iu1ape mfvsltfsDrmurp;o1tpxn fetasfs emums;(4 lxrmfcoydlpt luvi;()srtm(o oodap n ivilsf 2taumooo4oetoifcilsla umnvo;u) rxoxf oydfm eau o;t  2urio oy1ape lnvilt) Dur(mo;t4tlxomfctat m rmump;u4tlxnxfcto1lat  i i t0texmxo3oy4altnlncsat  2umx  ;o0aet mfctydfm2rl( p;(0 reomo ta1fp rlivi;t0 2uo(rpoodopt mivt t  2rmx p;t1optomo3iytfsDemums t0arxnifcto1latrlu ol()s2xoir oy4llenmietat)sDuax p;u0apxnmfciltfmDra( p;t)arenxrcoatlp r u ilt)t2uoiopiudlmee ivilsfarrr( pno1alx ifetltlm2um(vsnt0trermo3io1fp raivolt0s2xm(mpiydoleelfvt (  rtmxm oo1tltomf3tls m emnvpnu4aeeoxoctadomDe i i (0 2trimpiu1llt miesas)aDtrump;o1alto f3iltls2rmuvpnt)aeenif oa1fa  lnvols0 2tr(mpnu1ale mict sfaDrmu pou4aexnmfciytfsDrm( o;(0texoif3oadfa eau s;()s2xoxmpio4lleelics tfaDrm(mont0aex ifetad aDeau p;()treoxf iotopDr ieo;(0 exmir3iu1ope lfetls)a2taxmpnu0aexomo3tydfs2rm(vo t0areoxf3iodlaDeau s s t2xmxopoodllee fesa()s2rm(rp;u1altnmfetlsla elnmsnu4tltoxf oy1lmDrli slt0 rur(r3oo1aleemfcil( s2trur ;u4ale mf3tldfa2ulnmpn(0tleoifctodomtraivo;t  exm(r3oo4amee nes t aDtrx pno4aet io3ias mDeln o;t0alxnxfcoo1opDe ues;(  2um(r3nu1olen ietlsfartmx ooo1tlt mfeilt a2rl(vp;t) rerir tatfa rluei ()setrirpoo1apen ieta()a2ua(mp;o1aeeniiciyslm ua(vs t)altrircty1fatr neo t t2urir3iodlp elfvta( srtmu pnt1olxomfciyslaDuluvo;t4alerir3oytlptraues s0truoimpnodope lfcsa(faDtrx o;o1teto oeiyt aDeln p;() eerir tadomD anes;s t2tmimpou1ll  lies () 2rmxrooo1tpxnifeiadfm ea(vp;t0texomf3iytomtraivilt0 2xmxm3io4amtnmivil(f Dtaurp;o1aexn i3ildlsDem(mp;t0 etoxocty1omtelu s ( seumxm3nu4lpenlfcs t)sDrmu  no1tpxnmi3iad sDuau pnu) lenxoctatlmDeaieil(0trurir3ny1llenmfvi t  2ua(mpot0teeo oetltfaDelnvont4aetoif iydfm r iei;s)srxo(mpnydameelfet t) Durumooo4opeomictls aDrln on(4altrif iy1lm elivsl( trxrxr3iu1lptemfci sfaDtaum ot4oeen o3iasfsDrm(msn(4trxnmr3totlaDeln i t srtoirpiudlmte nvs ( a2ra(  oo1tetomoeiadfaDrl(vpnt)arxnmf iodoaD lu s s0tetrxr iy1lmt mfci tf Dtaxm ;t0aetnmiciys s2ea( s t4tltoxocoa1lmDr ues s teurio no4llen nctl(  rumumo;o1olt  octad aDrm(vpn(0trermf3io1fpt  nvs (  rtoiopiydape lfes s) 2uru pno0tetn o3iysfs umu o;u) eenmo oa1oa  ai s ()tetm(o oo4llenmfeslt s2umu ooo4aleomoeiadls2umnmonu4tltomr oa1oa r u s t)trxoirpnu4alt  fcsatfsrra(r no0altoifctadfa uln p t)trtrir3tytoaDe nvo s0s2uoio3ny1op n fetls srraum ;u0tex iieiydls rau p t4 rtrmf3ootfm e i il(0 rxrxrpnu1am nlncil( a2ta(mo;t1teeo ociat s2elu pn() lenxfcoy1lmte u i;s0t2ur(o ou4ap elnvilsf rraur ;t0apt miciytfsDulnmo;(4aetoxocoodom rlieo;t)seum(m io4ome lici t arra(r nt0tet moetysfs2eanmp (4texrir3ootopt  n ols)s2xr(mpoo4om e fcsasfa2ra( pot4alt  o3iysfmDrmuvp t0treoxoctytlptelnei;s)trumxm oudop e nvi t sruaurpot4tlx mfetldfa2emn snt4 renmr oy1opteanei ( tetrxo oydapee neil(f rurxrpnu0tetomfciyd s rl(mo ()aeeoxr3oodfmteauei t truoxm3ny4om nlici t) rtm(  nu0altn i3iadlm2ran on(0aeenifcoydlp r u sl(0s2xm(m nodopen fcsls) rtaxmpno1olx  i3tldfm emnvonu4alxnmocto1fmte u s ()srxoxo3iy1lm n iesltfsrta(  oo1tlx  oeiatfs2ea( s;u0tetnxrctadfa eaueslt trxoxr3iu4lltnlfvs t)srumuroot4aee  f3tas sDemn o;(0arxrio3iy1oateln s;s  2xm(r ou1lp  lnciat  2raurpoo0alto ieiyslaDul(mpnu0trxnmr3tytfmD auvo;s)teur(o3nudameemfeil(fa2taur ;u1apeoiociasfs2ulu p u0arermrcia1op r neslt0 euo(r oo1alee ici s  Duax p;t4oetnmo3iydfmDemuvonu4treomr ta1lp eln i;s) rxrxmpou1am elnesa(f Dtmx p;o4aptoiiciltlm2rauvp u)treomo3oatfm eaneil( tetr(r nydoltnmiviltfsDur( pno0aetomieiasfa rl(vpnu4trerxf3oa1lp elnvslt0 rxmxm3io1ap n nvia( artmxmpnt0teeomfcias sDelnms;u4arenir3ty1fp e nes;t) etoxmpny1lp elfvil(f Draum ;o0tptn ictldfmDelu pnu0 rxrxr oo1omtraiei s0s2urim nodal n nvsat arrr(rpnt4tleoiietys a2ea( pn()artomf oadoa elivi t0t2toxo io1lm n feils) 2rau  ot4optnif3tls m emuvpn(4artrxr io1fmDeau o;s srtrxopoy1lp nlivil(f Draur ;t1aeto o3iadls2emnvsnt4tltrmf3oa1fmtrauvo;(0sexmir oo4omtelfvs ()s2rm(m ot0aeenmoeiys sDul(vo t0aexrxf oatlpteln ils seumxo3oudal emivtat) 2tau  nu0tlxnif3tys m rmnmp;(0artrxr3tadlm  luvolt  rumir3iodal nlfetl()srtru pou4oexo i3tadlsDulumonu)aetoxfcoodop e nesl( sexmir oudamtnmnvtlt) Durxmoot4altn ietasla um(von()trtnxf3oadfp elnes ()setrxm3ny4op   ietatfaDrax  ;t0aet  fctltfm2rmn o;(0trtomfctatomDrauvi ()s2xmxo3nodlp   ieta(  Dumurp;u0tex  ocias m emu pnt4trerirciodfatrauvol()tetrxr oydamtemivtlsfarra(r ;u0aeenifetysfmDulnvo ()alxrircoatlmt  ieo;s s2umiopou1altnlieta(  rumx o;o1opx  fcild s2ranvp;t0 etoxo tydoptrlnvi;s  2trio3no4ol  lfvt t srrm( ont0opxo ieiadfs2elnmp u4 rtoir3oy1fm e nvs s  ruoxo3oudap nmiet t  Draxmoou1tlxnmieildlaDelnvs u4 eeoifctatfp eliei;t)s2umxm iy1aptemnvta() rraurp;o1teeomoetlt mDrm(vo (0aexrmo3iodfmt ln o;(0 exm(m3ou4ame  icslt artaumooo1aptnifcild s2elumo (0altrmo3io1fm  lu ils t2tmxmpno4lltelivsat)sDraur ;u4tet mictasfa2rmnvs;t4artrmr3oadfpt  neols)sruo(opno4om nmneil() Dtr(moot0teto ociltlmDrmumonu4tlermfcoo1lat ai o s0seumxo3ou4altnlfvi s arur(rp;t0tlenmociysfs ulnmsnu0arxrif iotlmDr ies t0seumim oo1llt mfci (fsrtrxmpou4olto fctatfs emumonu0altrxocoy1lpte neo t s2uo(r oo4am n fctat) Drrx p;t4oexniieiydla2ul(vsn(0 ltriociytfateai s ( texr(r ou1lptn fctat)a2rmumo;u1ape mieiysfm ra(vp u4altnmf oatlm  auesls)tetr(r oy4lmee ncia()arrm(ro;u1oet  o3tad a eluvon(4 lxrif3iytoa  ln i t0trtmxrpiy4om   nvilt)artm(root4olxomoctltfmDranms (4texrircootfpDelneo;s) 2toio3no1lp  lics tf rur(rpnt0oex ifcils mDem(vsnt)arenxr3oodfp  au o s) 2tmxo io4apt mfciat aDuau ono1tee  ictytla2rl(mo;t4 rtomf3iydlptraieo (  rtoxm oo1ol e fvilt) Durx p;t1apenmictatla2rauvpnu0 etnxr tadlatr u s;t0 rxr(mpnodlle  fcs sfaDuax pnt4oeenmfciadla2ea(ms;u0trermfcoatomtr n sls  2uoirpiy4aleemietatfsDrrxr ou0tlenii3taslmDelnvsnu0aetnxf3to1oatean ols0 euoxr ou4amtn ncilt)aDrrxm ;o1olxomieiatfsDumnvpn()artrxocoodfat anvo s0texrxmpiu4llt  nvsas aDuaur ot1alxomocilt m el( o;(4arxnir iodfmteluei;s0 exr(r nu1lle lnctltfa2rmu p;t0oetniiciad sDrmums;t) rtomf3oytfate nes t)teumxm3ny1ome mfvsas  2rmu pnt0oex mi3iydla rmn o t0 eerxf3tydopD li slt)sexr(mpoodop n fctl(f 2ur(m ou0olx iieiadfs rluvo t0treoxr3iydfptrluvolt trxoir3nu1ap nlnei ()srtaxm no1tltniictlt s2rmn s (4 rermr io1op   uesl()s2xoio ny1oltn fei sfs2urxm ;o0oet  iciat aDra( p () lxoxf ty1fmtelivo;t0t2toim io4amee ics tfsrum(m nt0tptn f3ilt sDean pnt0 rtoxociadomDr ivi;s)srxrxm3iy4ll nmnesas) 2trxro;u4olxnmietatlmDraumo (4aexomrciodoat  ies;() rxrio oydapee nctlt)a2ua( ooo4alen oeiydls2uauvp u) rxnxr3oytlm  lu s;t  2xriopoudlpenlnctl() Drr(mooo1apen feiatlmDrl(vs;() ltomociy1fmtr nvi ( seto(o ny1apte ncs (fs2trxmp;o4apenmf3ilsfm2ul(mp t)trtnxf3oodlptranvi;( trtrio iydopenmnctlt aDrau o;u0olx  fciltla2emnvp t4aexnxr3oadlptelivi;t)srxoxr oy4opt livia()srtruront0texo feils sDum(vpn()trxrmr3t
\ No newline at end of file
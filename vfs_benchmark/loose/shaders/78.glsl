@@ -0,0 +1 @@
+u s;t trxrio nydop elict s)sDtmu ooo4opeoifciadlsDelnmp (0trerir iytlaDelieolt trxr(rpny4lltelnei tfarrr( o;t4tet ii3tld a um(vpnt0teeoio oadfpDrauvs t0setm(mpou1lptnlfvtat aDrrxmoot4alxoifeiytlm2em(vpnu0 reoio ta1om eau o;( trxm(r iu4omt mfcs t)s2taxmo;t1tet if3ilsls2ran o u4aexnxr oytlatr i s t0t2tmxr ny4al n ncslsf Dta( pnt0tetnmfcilsfa2emnmo (0 ltomfcto1fm eaieo;( t2uriopoy4ap emneta()a2ta( pot0oeen feild a ul(mp t0arxrxocoytfpDe neo;( s2xmio3iydal e fvt t)artrurpoo1opxniieilsfm2ua(mo u)arerxfciydoa r n sls)srxoxo3io1omtnmicsl()s2rau  ;o4ape ifeiysfs2uau pnu4 renmr oytop r iesls)t2umir3oy1ope  nvia() rur(rpoo4ape  oeiysfm rmums;t4texrio oytomt luei;s s2tmxrpiudamenlncta(faDrrxr nt4aex mietltfm2rm(msnu0teeoxfcoo1fatrli o;( trxm(r3oo1apen icil(fartm(mpno4oex  f3iydlm ran s;t0tlxrif3oy1omte ivo s s2xmim iy4lmt mnvias)aDtrur oo4tpxnmfeiasla2raumsn(0teerxo3iatfaD  n s;s)sruoimpnodlpe lfci s  Durum nu0apenmiciat aDrau o;u) lxrxrcoo1fp rluvsl( sexmirpno4altnmfvtat)a2tau p;t1tlenioetad s2umuvpn() leoxr iadom  ln sl()trxoxrpoydlpt  fei s  rtmxm nt0tpx ioetlt m ua(vs;t)aexoioctytfaD aies;() etmxo iudlme lfeilt aDrm( pno0apenioeiadla eaums;()trerxf oo1fpD livs;t0t2trxr nodoleelneslt)a2rmx  no1teenifctytlm2ulnmp t)arxnif3iy1optraieol( setm(o nodam nmfct t)srra( poo0olto ictlslaDumnvo u0trxrxf iodfp raneilt0 2tr(m iy4lpee ncil()a2ra(m ;u4tlen fetydla rm(msn(4teenirciatomD lnvo;()t2uo(m3iudop   ics s) 2tr(mooo1tle  oeiydfmDulnmp ()alerxo oodlmD au ol(0trumxrpnu1omt mivsa(f 2tr(r oo4alt if3tytfmDrluvo;()texomr iotlpteluvi s0 euoim nydlltelnvtlt)s2uax o;t4tlt mf3iytfs2rmuvonu0 exrmr3totoaD an s;(0texo(o nu1ol n nvia( sDrm( oou4aexomieiydla2rlu snt4tetomr oadomDe nvolt)s2umiopnu4al elivilt srra(rp;o1aetnmoeiatfs2el( s;(0 ltomr oy1oaDeai ols teur(m oy1apee ivsatf 2tau  ot1openiietytfs rm( s (0texnioctytfpt anvs;()t2tm(m3iy4omtn nvtlsfs2umxr ;u4ope  i3iadfs2emuvo;()trtomo ia1oa raneo;( sexoir3oydlleelnvtl(farua(mooo0alxo f3iat s ul(vs;t)alxrxo3totopt aueo;s)sexm(opnu4al  lnetl() 2rrxr no1opx iietyd a elnvo (4 ltnxfcoodom  auvi;() 2tmiopoydlmtnlnctas)aDuax  ;u0aleoioctlt m2ea(mpnu4 lxomr oadlptelueo s seto(o oo4altnmici s aDumxm ot1opt ifetadlm2el(mp;() rxnmr3tadla  auei t  rurim io4optnlnvt (f 2um(mpno1tetomi3iytla2rmuvs t) exnif iytlpD  nvi ( trxr(o io1lp emiesa(  2tmxr ;u0aptn f3iytfs umumo t)texoxo iadlmte uvi t) rtmxo3iudlle  fvi ( a2raumpot1tpt  fcildfaDemn onu0artnmo iatoptr n i s0t2xoimpny1lm n icilsfsrrmurp;t4apt io3tysla2uan sn() ltrxrciytfaDraivi;()s2toiopiy1ame mfcsasfa2umu  no4tpx moeildls emumpnt)altnio3io1oaD lnes ()srurxrpoo4op elfci () ruauronu4aptnmi3iadfa eanmp;u0trerir tatop   ieo;s)t2triopou4llee ietl()srurur oo0apenmieiatla em(vs;(0tetrxr iotfatraneol() euo(mpoydlpenlieslt s2rau pnu1aee mfeilsfa uanvonu) lxoircty1laD aivo s teumimpnu1omeelnctlt s2umxr nt1ope iociadlsDel( snt4trxnxr3tatoaDraivil( sruoxmpoo4opt lies (faDtm(rpot0texoif3ild a2eanmpnu) lxoxr3todlm   uvs t)srxo(r3oy4omtn ics s sDtau oot4tpen fcilslmDemn p u0 lxnmf3oy1opteanei;(0s2uoio3iu4ap emnvs sfsrtaumoou4alt iiciyd m elnvs;() eenmf oadfptr ivi;s0s2xrim no1amtnlnvsas a2raumpoo0tlto i3iltfaDulnms u4alxoiocta1latr ies t)trxm(o io1am  mfvtasf rtmxmonu0tpe iietat aDel( o;(4areoif io1fmte ueol( s2xrio oodlltnmfetltf 2tmxr nu0opx  feildfmDul( o u4teerir3ootomDrlneolt0s2uoirpiy4lpt lnciatf Duaum oo4tptomieiytfmDeluvp (0 rxoxfcta1lpte ivil(0 exoir iy4al  mfeiasfs2rrum ;o4aeenmoetatfm2el(vo;u4artoir to1oa   ivs s0 2umxr iy4alen neias)srua(r oo1tle mf3tytlaDranvp;(4 eeomocoodfp   ies s0 etmxo3oodoltnmiei () Drr(  ou0texnioetyslm2uau p;u0tetrmr ootlaD  iei;t0s2uoir3oy1aptnlfesls  Drmxr oo4alt  o3iat mDem(msnu4 lxnif3todfmtran ols)srtmir3io4ol emfvi sfa2rm( o;t4ole iieiydlm2eauvp;t4 exoio3tatlpDe ueo;()t2tm(rpoo4omtnmfetlsfsDtaxm ;t1olxnifcilt a emnvp;u) lerir iytopD  nvo t)trurxo io4ol   icsl( aDrrurpnu4aptnif3ilt s2rau pnt4aetomociodlaD anvs;t)t2xoio io4olt licsa(  rrmx o;t0apt mi3ils sDum(vpn()tlxrircoadomDe nes t  rxmxr3nydllt lfcia(fsDrm(ro;o1aexnio3tysfa2rmu o (0trxnxf iodomD aiei s trxmxm3ou1olt lnvsat artmxrp;u0tle ifcildfs2ra( o t4teenxfciy1lpDeaueo t srxm(rpio1ol  mfcia(  2rmxronu1olxnifeiadla ulu p;(0aeerxr oadlat lueil()t2urir3nodope mneslt aDumumo;t4teeoio3iad mDrmu s u)tlxrxr3io1lmDe ies s0t2trxrpoo1lp   ivsas)aDtrxm ;o1oltomoeiysfm emu s;(4arenir3ty1op r u s s  rxrio nodlltemietl( aDtax o;t1ole mi3ilsfa2uau o u)arxoir3iy1oa   neilt0teto(r3ny4al  mnvil()s2umurpou4texo feild s uau s u0 exrxrctydfmDeaivol(0sexrxm3no4al  lfet s s2uax poo4aeenii3ildlmDemu s u4alerifcoatfa   i i s)srxoir iy4openmfvsatfaDtr(monu1oeenioeiydls em(mpnt4trxnmr3tydfm  lneols0sexo(opou1lp nlfcils)aDumxr ot1teenmieiad a2eanvs;()tetnxf3tatfptrlneilt)srtrxr3oy1lptelfcta(f rurum ;o1teto fetytlaDrl(vo;() rtnmf3tytfa rlueo;s) 2toxo3iydol nmieta()arrmxr nt0oet ifciysfsDemn s;u)aexnmo todlp eaueilt s2xm(o3oy4aptnmiei s  2rrum nu1tex mictaslaDeauvo t4tltrio3tatfpt ln s;t0t2tr(opnydop e netlt aruru pnt1ope mo3iatfa2elnmo;() exomo iytlaDelues ()srtrxopoodomt lncsa(fa2um(rpoo0apxniietysfs uau o;(0tltomo iodlptelnvo;(0 2trxrpoudlle mnvta()s2taum no4apen o3ild aDeanms t4arenmf3oodlat aies t)trtrio3oo1ame  ncia( srrm(ro;u0apt ioctadlaDeln o;() exomo3oodlp raieo;t teuoxo3iu4ll  mici t)s2rrxmoou4aetniietytls2rlu o;()trxnmf3tytfp  an i;s0seumio3iydome  nvslsfarrmx  ou1tpx  i3tldfa ranvp;t0 lenio3oytfatrau i (  eto(o3no1olt mfct ()sDuaxmo;u4tlen ocildfaDua(mp;u)aexnmfcootfat liesls0sruoio iy4lltnlfeil()a2ua(mono4optoii3tytfsDeau p t4alermr3oa1omDeaneilt  2tmir oy4lpe livias)srum( pot1alto f3ilt m2rmu p;t0trtoxf ty1lmteluei ( srxm(r nudllee nei ()a2umxmo;u1openiietltfa uauvs u0 eerxo oydfatelues;s) 2xrimpiydal elneil(fs2tmu  nu0opxnmfciytfa uauvont)trxoxf3tadop eaieilt0 etrirpoo1lmenmfciltfa2rr(mpot1olenmo3iatfa2umnmp;t4artnmf to1fmtr ues ( seto(rpiy4om   iei ()sDra(mp;t0tleomoeilsfsDelnvonu4aexomocia1lm raueo;t  rtoiopoo1ap  lfeil(fsrtmu p;o1oee iieilsfa ulnmp;u) exoxo3oadlp  livo t  2xrxrpnu1ap  mieils)srrmu ooo1apxnmicild m ea( p t4tltoxf3iatlatr u o s srtriopiudlltnlnet tf 2taxrp;u1altn iciys s elnmo u0 lxrxf3oydop  anvil( trxr(mpnydll  mici sfaDtm( pnt0tptoif3iatfs2uan snu4 etnmfcia1fm  aues ( setoio oo4llt mfvi s) rrrurpno4openmiciytfm2ra(vs (4tltoxr oo1lmte uvo;( t2xo(m ou4apee nvs tfarurxrpou0aeeomoctydfmDra(vp u) etomfcoadlmtranes () euo(m nu4om nlies t srtm(r ou0openiieils m2eau pn(0arxnxo3todlaDelnvi s0 2xm(o iy1optn fes t) Dtruroou1opeoioctadfsDrl(mo u)altrxo todfm e ivols) ruoxo3iy4lptnmncslt) rrrx o;u1tpt  f3iad m2rluvsn(4tlxnxf3tatfpteluvi (0 etoxmpio4lm n feil() Dua( pnt0olto o3iadlsDeanmo;t)treoif3ootoa   n sls)tetrxopnu4lmen fcslt  Dtrumo;u0tlxnmfetlsls eln p;u)arxnxo3oadlaDeln ol(  etr(m3nydol n icilt arta( pnt0tee mfetltlm2umuvs;u0tleoifcootoateaies;t)sexmio ny4ol  lnesl( aDraxroot1tlx iietlsls rl(vs (0 rtrxo3totom rliei;s0trtmir nu4olee fvias a2urxr ot1oexomfeiat mDua(mp;(0aetomf iotop elueo s0 2tmim3nydome mfeiatfsDtaxroot1aetn o3iatfmDea(msn(0 rxoif oa1lmDeln o;s)s2trxo iu4ll n netas)s2rmuront1oleomocild mDrl(mp;u4alxoifctydomtrau olt setmxopou4ale lfvsat s2tmxr ot0tex ifciys s2rauvs t)aeermrctadfaD  ivs;t0s2umio3iy4ap n feil(f rtaxr ;o0oltn fetyd m2rm( pn(4artrio3ia1fmteaieo s s2urxrpou1ap n fcsas)aDumxrpoo4apeo i3iltfaDelu s ()artomfcoa1fm ranes t trxo(r io4omeemivi t s2uaxrp;o4aet ioctysla2el(mp;t0altnmf3ta1omDelueilt texm(o oodam nlfci ()arururpnu0teeniociytlm um(mpnt) renxf3oodop raivo;s s2uoio3oodlmeelfeta(  Dtaump;u0ape  f3iyslm um(mo (0tetrmf iy1fptraivs s)trumxm oy1lmeelfcs t  Dur( onu0tlxn octatfa2rmu s (4teerir oodfpt auesls0seumir ny4amtn nesl( a2rm(ro;o4aleomfeiydlmDrl( o t)tleoxf3io1fa r uvo s0srto(m ny4olte ivt () rrau p;u4olxnmfctlt a uanmo u4 lxrirciatlpteaiei t)t2uo(r3nudlle lfcils)s2umxr nt0aet mi3tasfa ea(vs ()tlxrif totfpD lnei;t0 2xo(opno4om emfetas) 2ta( pnu1aet mo3iytfmDrl( pnu)aexrir3oo1lp e ueslt teuoimpnydoltnlivi s) 2uaxrp;u0optnmo3iltfsDrmu pnu4 eeoio to1lpD lneo;t0 exrirpoydomtn nvtat  2ra(root0tpeoifciydfa2uluvon(4tlenmr todfptranvslt trur(o oudamenmnvsl(  2taurpoo4aetnio3iaslm2elumsnt4alermrciy1lpt lueo t)tetoxopoudoleemicsas) rtrx  ot4olen fctyt sDulums t0tlerxr3todfm ean sl(0s2toxo nodll e ivils) rrm(ro;o0tptomf3tadls2rlumon(0tltnio tadfmDe iei;s texoxopiy4lle lneil(f Draum ;t1aeenioctlt sDeanvp t0trtoxf3oadoat lieols s2uo(r iydamenlfct t  ruax p;t1tleo ieiatfmDra(mp u0tlxrifctadlpDraieo t0 2xo(rpiu1apeemnes ( a2um(ront0teeo i3iys m2rlumo u0alxoir3oydlptran i ( t2urxmpnodlme mnvil(  Dtmum ;u1aexomi3iatlm2uaumo t0 rtoxr3ia1fateaivi;s0sexo(mpiu1lp emfeilsf 2rrx pno1opxoifciytlmDua( ont0trtnxo3to1fmDrlivo ( setoirpnudlpen ncia() Dtm( ooo0optomieiytfm rmnvo ()texrxrcta1lmDr ueslt0tetoim3nu1lpen fvtlt)aruru p;u1oet moctys aDua(vs;u0aexoxr oodomDrauvs;t trurir oo1om  lfct t  2ra( pot1oleomoetat mDrln pnu)treoxr3oydlp   ivi s trumxrpny4lltelfvtasfa2tm(mpnt4teenmi3iydfmDua(vo;u4 rtoxrcoy1faDeai o s  2xm(opou1llen net s)artaxmpnu0tetoifetas a umuvp;(0aetnmf3oytfpte neil(0 euoim oo4amte ies t)aDtrur ou4oeenioctatfa ulu p t0 ltnxrciytla elueo ( t2toir3ny4omt lies s srrr(m ;u1oltn ictytfaDeau p u)tlermo3oadlmt  neo t  etm(r3iodap  mneilsf 2raurpnu4opeo f3tlt s2eanvo (0tetrio3iy1lmtrln s () rtrxm no1lp nmnvsls)aDuaxrp;u0alx iiciltfs2em(msnu4aetomocoy1lp   iei ( s2tr(r ou4olt  ietl( sDrr(mpnu4tpeomi3iysfa rmn s;(4arenir3tatfmte i ols)t2toxm3no4om elfei ( artmxro;o4opeoiocilsfa2ua( p;()aeeniocoatomt au s;t) exr(m nu4omtn icia(fs2ururpot4teeomicildla2ea(vo;t) eenxf3iotlmtr ueo;t) 2uoxmpoy1lle  ictl(fartm(  ;o4oexoifetytla2el(mp u) etrxocoatfa rauvs () eumxrpno4lm n nvt tfs2umx oot0aexomo3ilt a2rmnmsnt4aeerio ootomDean s;t)seuoxr iy1omeelfvt s) 2rmuronu0olx  o3tldfa2ul( p (4tlxrmoctatomD auvo (  2umio3ny1am emfciasfaDtrumono0apto o3iasfs ra(mp (4arermfciotfpDr ies t)s2trimpiu4lpe lneils a2umx oot0aexn ietyt sDulnms;u)aexrxo iy1laDeaies;()setoimpio1al elfvs t)a2umx  ou1aetn o3tytfsDum(mp ()texnir3oodoaD lnei;t)teto(mpno4amee ies s) rumump;t4oetn f3tasfa rmu pnu4 reoxo io1fa  aivs;t0s2toir3ny4openlnct t) Dtm(ro;t0apenmictldlm2umn p;u)arxrirciy1opD  uesls0sruoxm iodap e feilsf Dumumono0ape mieiasfa2ua(vsnt4arxrxf3oatlptelneilt srxrxr3iy4op e fviasfa2rm(r ;u1aleomo3tys s em( snu0teenircoytlaD aivs ()s2urxm io1apeelfctas aruaumono0tptnmi3iadfs2umu o;(4tetrmrciadoaDrau o t) rxoiopiu1amen iviat)a2truroou0tltnmo3iltfs2rm(vo t0 reomoctydoaDrlivi t)t2toiopou1opeelict s  2urum ;u1opxnii3iadfs rauvs;t)altrmr iatfatrlneo;t texm(m3nu1am  licslt)s2tr(m no1optnmociltfa uauvs (4trtomf io1opt lnei;t) rxr(m no1amtnlfvt tfs2ra(r ;t4tlxoifeiadla2ea(ms (0trxrxrctatomt aneo;s  2ur(m3no4lm emnviltfsrur(mpou4tpxo i3iytls2eln p t) lxrmr io1fm  lieilt  eur(rpoo4llen netl( srrm(mpnu1aetn fciydlm2eluvo t)alxrmf3oy1fp  livol() ruoxrpny4al emnctltfsrumxm ;t0teen oeiatfa2rluvsnu4 lxnxrciotlaDr n s;(0 2to(r3iy1alt lfvil(  rta(ro;o4ale  ocils m2ra( o;t4 reoxf3ta1lmteaivo;s0texmir3oodlleeliei t)aruaxroou0aexnmfcildlm rmn o;t4aleomr3tadfptranvolt srtoxrpno1lm  mfei t) rra(r oo1apx ioctys s rlnmo ()teeoir ta1faD  ivilt teurio3iudlptnlnctat a2ta(  no1tpx  iciltlm2elnmo u0aeeoxrciodfp  lieol( s2xr(o3iy4lmenlieta()s2ra( oou0tptoii3iydfsDumnvsnu4aetoio3tadla  li o t srxoxopoo1op elietl(fsruau  ;t4tpenmoetat m2uanvs;u0altoxf3ia1fm r u i;t s2xrxo3io1lleemnvta()arrmumont4tpeo fetas aDua(mpnt4tleoxr todomteaues;s srxr(opiu1lpte nes ( a2rm( o;t1alenmoctldfaDelu p (0tleoio iy1lmDeln s ()t2xo(o3io4lleemiesl() 2rmu poo1opt ifeiat sDeanvpnt4 rxnxf tytoaDrauvo;t)t2xoxm ou1ol  lncs t) rum(rpnt4oetnif3ild sDeauvs;t0aetnir ootlmt  uvolt s2ur(opio4optelfciat)a2ururooo1olxnmo3iydfa ulu p t4alenmf oytlmt lieols) 2xoxo ou4am n fesa( aDuaxro;o0tlxnmociyd m2ran snu)tltnif3tydlaDe ueols0s2xoxopou4oleelfeia(f rtr( ooo4alt mictlslmDuaump;u0arerxfciy1faD anes;t0 2xmxr3iy1ol  lfcsat) 2rmxmont1tet  feilt sDrlumo;()tlxrir3iatopDr uei;t s2uoxo iu4olt lfvils  2tmx ooo0oetnmfciydla2rl(vo (4 etnxf tadlaDr nvo;t0 etr(m io4ol  mies sf 2rrurpnt4aeeoio3ildla2em( p t0 eenxf3ootom  aivo;()srxrxo3iu1lltnmfctasfsruau ont0apen fetydls2ua(mo u) lenxf ty1fmtrlivs;()setmxopoy1omte iei t)a2ra( poo4aexoiieiltlm2ea( p u0tlxnxf3ta1opteauei;(0truoir iy1amenmfcsat)arum(m nu1tpt ifciltfs2rmnmo;t0altnmf3iodomDr nvolt0s2xmimpno1ap emncslt)srtr(  nt1tlxo oeildls2ul( p u4arenmf3totoat auvs;()s2xm(r oo4llt mncia()artmump;t1tpeoioeiad a2emuvs;(0alxnif oatoat ln ils)teur(opoo4apenmies s) rrm( onu4tetnmfciys s rln pnu0 lxoif iadfmtraivols)trumim no1lp nmneta(faDumurp;u1aeeoio3iyd a raums ()arxnmfctydom  lu i t0 etoimpno1om nlici tf 2rax ooo4aleoiiciat m2um(vsnu4 lerxr todfateli sls) 2uoiopoy4lle  ivsa(farraur no4ale ioetytlm2um(vo;u0tltnif iotla   uvs;t)s2tm(r3oydlltn nesat) 2urumo;o4olt io3ildfm2emn p;()altoxr oydopt luvslt) rtr(rpnu4lpte neil(  rumur ;u4optn ieiyd a rmn p t)teeoxr tytom  ln i;t0 rtrim oo1lme  ncils  Dur( ont1oetn fetys sDul(vp;u) etoxrcoadfatr n o;t tetrxm3ny4opt mnct (f rtrurpnu0opeo f3tldfa2emnmo t0tltnifcta1lmt auvs s t2xmiopiy1lmtelfcia(  Dtrur ou1tetnmfeilslm2elnvp t)texrxr iadoatrln i;t) exoim3ou4ope mictl()aDtaurpnu0opxoioctydfaDrl( pnu4aexoir to1fmDr i o;( s2xmio3iu1op  lnvil()a2rau p;t0tee mo3tadfa uanvpn(4aexoif3ia1op elnes t0 2umxo3oy1lme  fci sf Dtrxm no1ope io3iltls2rmnms (0trxomo3tydlmt li s s) rtr(opnydaptemfvil()s2um(r oo1tpxnif3tas m2rlnvpnt0aeeniociotopt  i i;( texrio iudlp emfet tf Dtm( p;u4alenmfctadfaDuauvsnt0 eeoxo totomDe ies () exmim3iy4amee ietas)a2ur( p;t0tlxo f3iadfa2raumo (0trxrio3oytlmteluvols) 2ur(m oy1al emncsl(  2ra(rooo1ope ii3tytfs rlu snt0 etnmf3oy1fm e nes (0sexrxm3nu1altn nvsltfsrurxmp;o0aeeoii3ilsla2ua( p;t) rtomf3to1lpD  ueo s trxrxr3oy1om nmnvt t)sDrmxr oo4opeoiieiydla2em(mo t4arermr3oatfmDe uvols)srxmim oo4olt mfvt (faDtrxro;t1openmfctydfmDulums ()tetrxr oy1op r uvsl()teumiopno4lm elicias  rrrxronu0apx ioeiys m2rauvo t) rxrirciy1faDeluvi;t)teto(opny4apte nvt t)srtr(rpnu1tlxn o3tyslm2ean pnu0 rermo3todop  ln sls)tetrio3nudlpeemiciltf Dra(rp;u1aee  octyt m2rl(von(4trtomfciytlmt auvo;() etmio3nydolenmnvtls)s2rmxmoot4altoioeiytlm ranmpn()tlxnxr3iotla  aueo t0 etoxopoydlp  mncsas  rtaur oo1open oeilsls2umu snu4altnmr3tadfmDe nvo;()texoxmpnodomtn ieia(fsrrr( poo0openmoetls a2rmn p;(0teenmo3oodoa  lneo;t texmxo3iydal nlivt t)s2rax pno1tet  i3ilt s rmuvo;(4tetoir3tatlmD luvi;s0 eum(mpiu1am nlnviatfa2um( ooo0oexomfeiyslmDua(vs;t)artomociydlp rlu ols srtoim iu1alen ncsa(faruaxmpnt0tpeomfciyt aDraumsn(0tlxoif3oytomD ai i s s2umirpou4lpt lfesl()arrrx pnt0oltnio3iydla2umu ont4arenif3iotomD  i o ( srto(m3iydam nlfetls  Drmx o;u0tle mfeiadfmDrmnvo u4tlerircio1op  aues;( texoirpoo4oltn nvils  2urxmpot0oleo f3ilsfm elump t0tltoir iotlm  auvs s)trxrxr3no1am elnvilt  rrr( p;u1apenif3tld a2em(vsnt0 lxnmrcoydom ranes s0 2urxmpno4om emncs (fsrra(mooo0ope iociasfm2el(mp;u) exnmocia1fa   nvil()trtrxrpiydameelnes ()artrumoot1tlxnii3tld s um( o t)arxnxr ta1opt luvs;( s2uo(m3io4omenmfeils)s2tr(monu4altnifetatlm ua( pn()trerxf oy1lm r uvo s0s2urxopou4lltnlfcil() 2urx  oo0alto ocildfm ulnmo u4 lerircoytlmD  nei;( seurxr oudlp n ivilsfs2rr(r ;u1texomi3tys s2umumo t4aexrir iodfpDe u ilt)srum(o3oy1lpe lfeils) Dra(  nu1apxo feiltfsDemnms;t4 exrmf oy1lmDr ies;()t2tr(rpoy4ap   ictls) rrmur nt0olen feiatfsDrmnmp (0aexoxo3oo1op e n o;(0 rxo(o3ny4apt mici s sDrr(mpot0texomfcias aDranmsn(4trxoiocoo1oaD  n ols)tetmio3io4oltemnetls)arrruro;u4alxnio3iadfsDeluvs t0 exrmo3tydlm eaneo;(0teumxo ou4altnlfeiasfsrtm(rono1tlen f3ils a ul(vsnt4 rtrmf3oatfptr ueolt) exm(m3iu1lpe lneiat  rrr(rooo4tptoioetasfm umnmo;(0teerxf totfmDrlnvs s)t2ur(mpoydameelfcslt) Drmu onu4alenmfcias s2rln pnu0 leoif ty1oa rli o;() 2ur(opoy1ape lies (fa2taumpno1opt mf3iltfs2uan pnu4 rermfcoodoptr n o ()trxr(o3io1lltemfesltfaDraxrpot4tpeo fctldfs emn sn()artniociodoat aies () 2xo(o3iy4ole mfcia()a2urxrp;o1aet mo3iasfm2umumo;u)tlxnio ia1fat anvilt  exr(rpoudaltn ivtlsfs2taxr no0apxomoctasfs uanmo;t)aexnmfcoy1oaD ln i s0t2tmxo iu1lpe licslt) 2tm(mpou0aex iiciadfsDelumo (4arxnmf iadlmt  nvo t  exmimpiu1op nlnvt sf Durur ot0oee if3ilsla rl(vo t4aeeoir3iotopt  ivslt truoxr ny4lptnmics (  rurxrpnt4opt miciltls uaumo u0arxoir3tydlpDrai ilt0 2toim3oy4omte nvia(f 2taxrp;t4opxnmiciadlm2ulu sn(4teeniocoy1fpDelueilt  ruriopiy4lmeelfcilsfsrtmu oou4oee mf3iyt mDeau s;u4 renxrcia1late nei;s srtoxm oy1ole mnet s) 2urxmooo0tpenmf3ils a rlums;t4tlenmociatfa elnvs s0trtm(opiu4ape  ici sfartru  ;o4tptnmoctydfm2uanmo;(4teerxr tydlaDr ieols s2uo(o3nu4om emnvsas)aDuaxmont1opxnmi3ilt mDuln o t4arermocoy1fm rai olt0s2xrxopnu4lm   fci s  rrrx p;o4alx mf3ils sDrm( o;u)tleomf to1omDe nvs s sexr(m ny4opeemfvtlt) 2taum ot4tptomoeiatfm uau pn()aexoxo iadlp elu s;() 2xrxr3no4om  mfcslt) rra(mooo4optn fetltla2rl( o t)aetnxr3to1optrli sls0texrxo3iudlp  mivslt) rra(mpot0altnmf3iyd s eauvon(0tlxoxr oadfpteai o;s0 ruriopoudomt lfeiat s2umum nt0apxnmfeiytlaDrluvp t4 rxnxocoytfaD  n i;t)teuoim3ny1am nlics s)aDrrx o;u4tee  f3iadfaDumn p;u4 rtnmfctadoa eaneo s setrxm3io4olee feil()arrr(mpnt1olxomfctytfa2rluvpnt)aetnmoctotlptrlnvi s0s2um(rpnodllenmicia(f 2umu poo1tpe  oeiatfm2eanmp;u4arermf3ta1fm r uei t  exo(r3ou4ol e fesa() 2rru  no1oee  f3tyslm2ua( s u)tltrxr oatopDeaieol( teurio3iy1lpe  net s a2rr(r nt1texoioetysfm2rmuvsnt) reoir oydom   n i t  rurxr3nu1opee nvils  Durxmpnt1olxn oeiydfaDulu p;()trenxo3to1lmtr u s;( s2xrir ny1ape lfctl(faDta(mont4olxn octldfmDeaump u4trtrmo tytlmte uvs;()trxrxo nudapen ict tfsDua(mo;t4aexnmoetlsla el(vp;u)tetnxr3oy1oa rlieilt)srurxr no4ll  lfetas  rur( oot4tpx mi3tytls rmuvp t0 etoio3io1opDr ues;t0srxm(m3iodlpt livt sf Dtaur ;o0apx  fciyd m rlu p t) lerxfcootlmt  uvs (0 etmxo no4openlfvtas a2ta(  ;o1tlto o3tld s2uan ont)texoxf3iy1fm eli ols)srxrxo iu1ale livias)a2umu p;u4aexo feiasfa uauvp;u0 rtoxr3ta1faDe iei s s2uoxm3nu1omtnmfcil()a2raxro;o1oexoiociasfmDeaumonu4aexnir3io1fatrauvo;t0 2trxopny4altnmncslsfsrum( p;o1oetoioctytlsDrlump t4tltomo3ootlmt ln ils t2xo(m3no4ol  lnvsa( srrr( pnt4ope  iciysfmDrlu snu4tltoir iatlm  aies s0s2tmxo io1lltemicia(f Dtrurooo0olt if3tasfa2ra(vsn(0 exrmr oy1fp eln ilt trtmxo3iy1ole  ivtl(fa2taur ;t0tlx mf3ild a eln s;t0texoif3tydla  aies t  rumim oydlptemiesa() 2uau ono0alxn f3tyslsDraums u) reoxr3iodfptraneo;( srtmirpou4al nlfvtat arrrurooo4opxomieiasfaDra(vsn()aetnxo ty1op raivs t)trxoim3oy1am emfeils  Drrum ;u1optoiicilsfs uau p t0aexomo ootlatrli o s) 2xrio3oy1amtn ncs t) rrr(  ot1tleomieildfsDrm(vo t0 eerif iodfatr ivsls tetrxmpoo4ll emies s)artrxr ;t0tptoifeiyd s em(vo t4aexnmo3io1opDranes s)t2xmxo3iodlltemieias)s2um(moot4texo o3tydlsDuln o;t)altnxocto1fa  ai o t t2ur(r3io1lle  fvsa(fsDrr( o;t4oeeoiieiatfs rmnvp ()tlxnmfcoa1opteauvsl()trur(rpno4llt  ncsltf rumu pnu1ale mociytfa uanmp u0teeoiociatfptran o ( t2xmxo iodolenlnvsltfaDrrxrono4tltomi3iadlmDrmn o ()tetomocoodop raues t0trxr(mpoy1ol emnvslt)s2tr(  nt1tet ioeiatlmDua( pnt)aetrxr3oydom elu s;s t2tmxo oy1amenlfviasfartrurpno1oltoifciydla umn sn(4arenxr3oodfate nvo;s  2tm(r iy1ap emncia() 2rmum ;u0apenmf3ilsfm2ul( sn() eermr iydfaDraieo;s s2xriopno1lmenlivils a2ra( p;t1oeeo i3ildlmDrln sn(0 lerxr3iydoa rauesls)teuoimpiodol e fcsltfaDtmxrpot0tlto ietlt m rlnvs t) ltoifciy1op rlies;s  etmirpiy4ap n fvtas)a2urxro;t4alt ifciadlmDea(vs u4tlenxo oydfpt lnvs;t)s2trio iydomtnmict sf rtmu pnu1aet ifctyt aDra(mp;u4 etnxocio1lat  uesls0s2xm(o3oo1amtn fetltfaDtm(r nu1alx moeiytfs2elu p;u4trtoxf3oy1om   uvolt t2uo(m iudom n ictat)aDtaxrono4alxomieiasfa2eanvp t)tetnif oodomD luvi ( s2xr(r3ny4lpe  iciat  rra(rpno4oeeomi3tytlm el(mp t0treoxo io1lmD aivols) rum(o oy1olt  ivsa()s2taum oo0opt mo3tlt m rln s;(4 eerxr3tatla e ivils)t2urxm3oy1amte ncias) Dtm(rpno0aex  o3iytlm2raumo;(4 exnmo iatlptelivs s srtrxopiu4lpt livtat artrum ;o0tpxo icild a rlu pnt4treoxocto1fa e ueol() ruoirpnudlpe lnvi ( aDrmx  ;o4olt mietldfmDulu p ()texrxr3iatlpDrlneolt0 exmxopio1om   netlsf rrmum ou1aet ioctydlaDrluvs t0trenif3io1optran sl(0s2xoxr3no1lp nlnctlsfaDrrx  oo4aexn oetldfsDean s;(4 etrmo3ia1la eauvi;s0trxoxm3iodamenlfvtl(  2rrxro;u1oex  i3tad s eaums;()trxniocty1oatr ies (  2xrxr3iu4amenmncslt)aDum( oot1tee  i3ilt s ulnmp u0 lermr ia1om rauvo t  exoim oy4ap elnvi (f rtr(rpnt4open f3iad mDrmuvp;()alenxf iodoptrauvi;t0teumxo3io4apen ict ()sDum(  ou4oexnifctlslsDrmums;u)tlermf iatlm eaneols)s2uo(opnydapeemfes t)aDururp;t1ole if3iydfsDuanms;u4arxoio oydfaDr n s;s setrxo3nodllte ivsltfsrumurooo0tetomfeiydlaDulnmont0 ltrircoa1omtr neo t trtrio3iu4ap nlfciat)arraxm no4tetnifeiltfs umn p ()aleoxf oodfmt li o t sexoir3iydlpen fes s)aDtrxm ;t1oeto oeiydfmDul(vs ()aexrif ia1lmtelivo s0 2uoir oy4olt mneia(f 2tm(mp;u0ope mociyt m ua( pnu0trxrmfciytfat aneo;(0teumxo3nudlm e ivi s srua( p;o4tpxn fetltls umnmpnu)trxoxrcoydlpt aueo (0 etmirpnodlle  ict t)arrm(ro;t0ale  ictysfa ulnmpnt)arxnxf ty1fpDrlnvo;( s2xrxrpiodamt licia(farrr(mpot0oex mociytlmDumu s u) rxnxo3iatlp rai slt)texoim3oy4omtelnetl() rumu oot1aetniietas sDuaumo u4trenifciy1fm raies;t) 2trxr3io4amen ieilsfs2ua(m nt0opx io3iydla eaumpnu4aetomociy1fa rlivs;s setmim oo1om nlfvia(f Duax o;o0tpeo fctlsfa rl(mp (4aexnio3tadlpD auvo;s)teum(rpny1ame  iciatfa2tmx p;u4teeo oetltls eluvs;(0aeenif oadfptrlu ols)t2uoxrpiu1llenmivtat)sDtrxrpoo4openiicias a2ra(vs;() lxrir ty1fa  an o s trum(mpnu4altnlfvias) Draum ;u1apxoiocild m ranvsn()trxoifctydla   neo s0 rurirpno1al n ivt t sDtmxrpnt4tleoioctldla2ul(vo;() exrmo iy1fat auvi s0 2xrxm oydomte fesatfartaump;t0tlx  fetltfaDemums;()trxrxo3iy1oatrlues t0t2um(rpiudllee fct (fs2raxroou0alxomieiyt m2em(ms;u) ltrif3tytomDeau s t)t2urxopnudom n nctasfarrau p;u4tpt  o3iytfa2eanvsn(4aetrif3oadlmDrln ils) 2ur(mpoo1lmee iesas)aDur(ront1oltnif3iyt m2umn o (0tetrxrciydfpD an sl(  rxrir no4lmt mnes s)a2rmx o;t0tlen fetlslmDrlnvp;(0 reoxr3oydoaD aneo;( trumiopiu4am e iviat) Dumxrp;u0alto i3iasls uanms;()tlxnxrciatfa elues t  exrirpio1alt lfci (  2um(root0tlx  oeiydls rm( p (4areomf oadfaDelnvi (0t2uo(rpoodaptn fcsasf Dtr( pnt1opxn icilsls em(mo;() etnif3oo1fat  ies t trtoxm ou1alt mivsls)sDraxrpnt1tetoiieiys m eln pnt4aetoxr3tydoaDrli i;()seto(opiudameemietls sDrrumpnu0texo ociatfs rl(mp;u)tetnmociytfmDe ivo;( s2uoimpnudolen fvtas  Dtm(rpot0apen feiys s2ea( o;(0trenmf3oadfa  livil()s2tm(r oudopeemivs t)aDrr(rp;u4oetn i3tys aDulnmpnt4trxrmf3oo1fmD anvs s)setoim oudop   neils a2rrx  ;t4texn oetat a2rm(vp t4tltoifcia1la   n o;( s2to(rpnudaptnmfei tfaDra(r nu1oex moetlslm em( p t)aeenmr totfpDe neo t0s2uo(m iy4lleemfcia()artru poo1olt  ociatlsDuan pnt4 etnio3oy1om e ivo;s)s2urir oodap elnvta( srurxm ot0tpeo o3iltlsDulnvo;t4tlxrxo io1fpDeaivslt)s2urir ou1lme mnvs s) 2ur(rpnu0aetomoeiadfsDulump;u0aeerxf iy1lpD  i sl(  etr(m ou1llt lnctas  Durum nt0aeeo fciadla rlnmont0 renxr3oodfa  au s (  2urirpnydlmtelnesa( arumu pnu4tlx io3tys a rm( snt0 etrmfcootfp r uei t) 2toio3nu4ol nlieslt)aDraum ;u1ope mo3ilt m2rau s;u0 exrmfctytfpDeaieils0 2xrirpiodlm e nct ( arra(mp;u4opto ieiytlm2emnmpn(4 rxnxf3oodlpD li i t) rumimpnu4al  lictltfarurx  nt1apxnii3iyslm rmu o (4tltnir ty1fp eauvilt srxm(opnu4op   icia()arrr(r ot0ole mi3tasfaDem( pnt4 eerio3oodlm  auvs;s0seumiopou4ll emnvi sfs2rrur nt0teenmoeiat a2el(vo u0 lxnir todfp eaivolt trtrir3oy4lmt  nvsat srumxmont1tle  oetat s2rln o u)altnxfctytfa eluvolt)sruoxrpnu1ol   fcias s2taxm ot4alt ifeiat aDem( s;() eenxf ta1fa  anes;() 2tm(m3oodaltn fviltfsrtr(mpot4apxomi3tatfaDrm(mp u0aleoxo3tadopDr i o s0setrxrpnu4am emfvta(fs2tr(ro;o4aex mi3iytfa2ra( p (4tltrmf to1laD ai s (0 rxo(mpio1lltnlfctas)sDtaxmp;o1tlxnifeiytfs el(mo;u4arermf oytlaD lneols)t2um(r3nodomtelicsl()sDta(r no0oeeo i3iydfaDemnvs t0arxrxf3ootlmtrlu s s0s2xmxm3iudllte iciatfaDrmu  nu0openifeiydfaDem(ms;u0tltoifctodfaDraivils setmio io1lpt  neias sDrm(roou0opto f3tas a2rm(vsn(4 exoio oadlatrlivils  rurxm oy1omen nvil(fsrraxr ;u4tptomfetadfs2ean p (4arxnmr ty1fpDrlneo;()teur(o ny4am nmnvsatfsDta(rooo0aet iicils m2rlnmont4 rxnmf3oydom  ai i (  rurxmpiy1ol   nvilt a2umxm no4tetniieiasfa2rln pn(4 lerir3ootoat luei s0texrim oudol nmfci (fa2ra( o;t4tpenifciad aDeaums;u0aetnmo oatlaDraieils s2xmiopny4ape lfcils aDum(rpnt1opt ioetatfaDuln s;u0arxrio3ta1oaDean s (0s2urim ny4lltnlncsat aDururoot1oet moeias aDem(mpn(4trxrif ty1oatelnes;t) rtr(m oo4ap nlies (farrm(root1olxnioctld aDulnvp u)texoir ia1omteau o ( s2tmxm3nudolt lfciat) Dua(rpnu1ape if3tyd m rmu o;u)trtnmo ty1la r n sls s2to(mpiudole lfeiltfsDrr( p;u0oetoioeiltfaDemn o t0trtoxr3oa1lmte nvs;s0trxrxr3nu1lpeelfeiat)srum(  ot4oeto ociydlm uluvonu0 lxnmf oatopDr ueo;s) etm(rpoo1ap  mfetl(faDtmxrp;o4ope iieiasfm2emums u4treoircta1fp elies;t) rxmimpiodome  fcsls) 2raxr ot1oet  ociyd s ea( o;t0 rtnmo tadlaDrlueolt)t2tr(o iy1al  lieils)aDtaumpou4tptnii3ildls uau p;(4arxnmr oy1oatr n ol()s2urxr io1omte nvsatfarrrx o;u1alto iciydfm2ra(ms () rxnxo3ty1opt ln s;s  rtmiopiydameemivsat)srrr(rp;u4tpx iieiytfa2rmnvs t4 lerxocty1lmDrliei;s t2uo(m nu1ole mnvtat sDua(  ;t4aetniieilsfa ea(vp (4 etoxo io1fp   u i;()trtrxr3iu1ol elivs s sDrm(rono1aexoiieiysla2umuvs;(4 rtrxr iadlm  aivi;t)teuoio ny4altelietatfsrurxm nu4olx iieiat aDrlnvs u4teermf3tytla raueslt0s2xoio3nu4al nmivt s  rrrxr oo1open oeiysls2ra(mo;()trxrxr io1lmtraies s)s2xm(m oo1openlnctlt srtaxrpno1alx ii3iyd a2rln s;()tetoif iatopt au s;t t2xr(rpny1ame lfvsa( aDuaxrp;o0altnii3iadlmDemumsn(4 ltomo3iy1fpt an i;s0srtr(m3oy1llt lneta()s2ur( pou1tptomfctyd sDrluvsnu0altrirctotlm  aiesls seuoxo oo1apt  fciat)s2trxmpoo0tleomietldlsDumn o (4aetomo oadfmDrlieo;(0t2trxo3oodaltelfetat  Dtrum ou4tpeoifciasls rm( o;t4aeeoirciy1lat liesl( srtoxmpoo4om   nvi s)sDur( ont0aet iieiyt s ean s u0teenmf3to1lpD lneo t0srtrir nu4aleelfct (  Dua(rpno4aetn fciydfmDua( o t0 lxoxo3iytom rln o (0teumim oudomtelnet ()a2rmu o;u0tpxnifciltla rmuvs;u) renmf3totop e i slt0t2tm(o nu4optemfeiat)artmx  ;o4oetn fctydfsDuan s;u4aexoxf iy1oat anei;s0s2xm(mpoy4olt  nei (fsDua(mp;t4alen fcils a el(vo (4teeoxo oydlpteluvo;s) rtoxm3iudom n nvi t)aDrr(rp;t0apeomieiat aDranvp;()tltoio3oa1om r ivo;(0sexoxmpnydlltnlnvs t srumxrpnt1tetomfeilsfm elnms;u4arenif iydopt aieils)sexrio iu4amt mnes (fa2ua(rpnu0olxnmietysfsDuln s u0teeomr iotlpDraueolt0 2ur(m ou1ol nmivsl( aDumumo;t1tlto feiat sDrln snt)texrio3oatomteaivo t)s2xmxrpnydapenlies tf rrr( pou1aee moeiatfsDeaump t0altoxf oy1lp rlnes;s0 2trir oo1oleelieilt  2ur(mont1tet mocild a ul(ms;(0 rxrxocio1oaD livo s0setmxr iodam elfet (fs2tr(rpou4oexoifeiatfsDum(mont)alxrio tadoaDrluvo (0trxmimpoo4ameelieiat s2tr(mpnt4aeto octatlmDrlu p;u) reomo3ia1la rlivs;(0trtr(opio1amt liciltfaDraumoot1aet  ieiytlaDran s ()tetoio iytoat aivilt)trxrim oodalt mneslt)sruaumpno0ope mieiadla ulnmsn(0arxomf iytop rlieils0s2uoir3ny1openlnetltf 2uax  nu1alx  ocild s ulu pn(4tltoircta1fmDeaieols0 rur(opoy4oltelfcslt)a2umu  nt1tlt mictas sDranvsnu4texrxrciadoa ean il() etoxm3io1op  lnes sfa2ra(rpnu0tpe  ictytlmDelnvont0 rxoxf3iadoaD  ues;s sexm(m nudap n feils)a2trxrpnt1tet  ictys a ea(vs u4tetoio io1optr i ils)t2xmxo3oo4optnmncs t)aDta( o;u1opx mfctlt s2raums;t4arenir3ta1laDran s (  euoxrpiudaleelivtls artrumpou0alen f3tyt sDrmumsn() leoifcoodlm  an sls texmim3oo1apt mncsasfsrumx ono1alxnmieiydfs ea( o;u0alxoxfcio1oateauvs;(0s2tr(mpoodomenmiei () rtmuroot1teeoif3tat mDuau o ()texnxocoa1op r i o ()trtoiopoydlleelfesatfaDtr(  ;u1aee iictadlm rmnvs;t4 rtoxr3iatlmDe ueslt0s2urirpio1ale mfeils)s2raxm nu1teeoifctydlmDuan pnu0areoiocoa1lp  auvil() rtm(o3iodaptelfcsas) rua(rp;u4alx mi3iadla rmnvs;u0trtnir oodlp r uvs s sexoxr no1am   fes tfsDurx p;u0tpen iciaslsDua(vo u4arxnmo ia1laDeau i;(0seumxo3ou1om elfci (f rrr(mo;u4oeto i3iysla2raump u0 exnio iodfa   uei s) 2tmxopnodom nmfvt (  Drr(rp;o0openioetyt s2uln p u)alxnif oytlptran sls  eto(r3nydlme  ict s srua( onu0tlxn i3iadfm eau p t0alxoxocoytomDeau ilt)s2toxo ou1amtnmieia(fsruaxmpot4alt moeiyt s2emnms;t4trxoio3ootopDr neo t) 2uo(m3oodoltemfci ( sDumxm ;u1aptnmicils a2um( s (0trxrxo3oydfaDeaivs t0 rxmxo3io1lmte fvtlt)srrr( onu4alxn icilsfm2rau pnt4 rtnmf iydoaDr nvo s)t2tr(o iy1lpt mivslt) 2ur(mono4tlto ietat s umums t4 rxrmf3totlm r ieil( sruoirpno4lp emfesl()srum(m ot0oltomociyslm ean o;u4aexnxr oadlmteaies s)tetoim3iu4al elnvilt)srur(rp;t4oetn o3tasfm eluvpnt0arxnmf ta1fpt au i;( srumxmpoo4amt  nvt s)arur(mont4opxomf3ild s2eaumo;()arermocoydop eluvo;(  rtmio3iudapeemneia()srrr(rono4oetoiictlt s umn o t4 exnifciatlpD an i t)sruo(o no1optelfctas)arrrurpno4oltnifctad s2emnvo;(4 ltnmrcio1lat  uei t0srurxr oo1am n ies ()aDuru o;o0tpto ociasls2rm(mp (0aetoir3tadlpDelnvols0s2xm(m oy4ome  ieiat) rumumpoo0oee mfciatlaDea( o;u) exrxo3io1fmD  ivi s  eto(o3oudlme mieta()aDta(  ou1apxn i3iydlm2rl(vsn()teermocto1fat anei;s0 rum(o ny4lmenmicilt)arum(ront1oexn i3iltla um(mo (0 rtomf3tydomteai s ( tetr(opiydaptelicil()srtaumpot1tlxomociatlm rmu s ()artomo3iotlateanvo;s0srtr(r3oydapt mnctas)s2urumpot1aetn icias a rlnvpn()trxrmrctadlmD  u il(  rtmxrpoy1altnlfct t) Dtrumpou1apto o3taslsDua(vonu)aetomoctadlatranvi;() 2xoimpoy1ap e ictas srraxmpnu0oetoif3tls mDel( snt4teeoxrciotlmDrln o;( sexo(o ny4optn iei (fs2rrumoot0texnio3tad a eaumo (4areomrcia1omtr uvs;t  etm(r3ny1lmtnmiei s aDrax pot0altoioetatfs2ra(von() etoxociodlatean o t)trtr(r3ou1ole lnvs (f rtrxmp;o4teenmo3tldfmDrau o;t0alenxo3oytlat lieol()s2um(m ny1openmivsa() rra(r ot1alx mo3iyd s umuvo t)tlxoxfcto1fp  lu olt)texoxrpnu4omt  fviatf 2rmx onu0aptnmfetltfaDel(vp (4artnxrcootlmDraivi ()seuo(mpiu1llt mnctltfs2trurpot0aeenmfeildfaDel(mo u0aexoxo3oadlaDrauvs s texoio oodom  mfetat s2ur(mont1oltnifetas m2uanvp u4artrxoctydopDr iei (0s2urim3oo4altemfct t artax pou4aeeoifctaslm2um( p;(0aeerio3iotop  ai o s)sruo(r oydolt mics ()aDra(ronu0tltomi3ild s2ul(mpnt)trermo3iytlaD aies t0seurim oy4amtnmfeilt)srumx oou0oeeoiieiysfm el( p u0trtnxf3oydom  aiei;s tetrxopoo4olee ieil() rtaumooo4tleomi3iat s2elu p t) rtnmf totfaD lu i ( s2xo(r iy4ol e fvs (  2umxrpno1teto ocildfs elu p u4teenir ty1fm elu s s)srxoxmpio1olte neiasfsDuau p;o0texnmociatfm umuvs t)trermr3ty1lpDe ieo;t srto(m3ny4al n iet sfa2urx pnu1aee mociysfsDulumonu0aetnif oadfatran o () 2umimpnu4ap   ies t)a2rm(rpnt1tet  ieiyd m2ra( s;t)teermrciodfa  auvo t)tetr(opiodomt mivilt)s2tmu  nu4teto fctltlsDua(mon(4arermf iytlmt  i o;( t2um(r3iudlmtn fvils  2tr(mpnu4tpt mfetat a emn o ()aetrxo oodfpD ai s t)tetr(m ny4lmtelictat arurur nt0aptomictatfaDumnvo;t0aetrmo3iytopDe iei;t) 2xoim3nu4apt  fvtatf 2ta( o;o4altnifetlsfs emnvp u0 rxrmr3iatlpDelueo;s0srtr(m ny1op nlfvtl()s2rm(m nu0apto fciadfa rmums (4 eeoif ia1lmt anei;t0tetrirpiy4ol elict tfsrua(moou1aex iietltlm2eau o;(0aeeoxo tydla r uvo;()trtmxmpoo4ape mfcils)aDtaxmpot1alxn oeiat m uanmp;t0 rtrir3oo1oateauvils srxoio3oo1oleemivsl( sruauronu4tet moetysfs2ulnmo;() eeoirciytoa e iei;(0setr(mpiu1llen fesatf ruaxmono0tlen fctltfs2ra(vp t0 rtoxo oodlmDr n sls)trtoim3ou1apt mnci ( sDtm(rooo1tlxnifciydfa2ua(vonu)aeenmf oy1lptelueo s sexrxrpiy4lm e feta( aDta(m nu0tpen i3iatlm uanmpn() ltriocoodlaDr ieo;(0teto(m3iodol nmnvilt)aruaxmpnt1ope ifcilt a el(msnu0 rxnxoctydfa e nvi;t0t2xmxm3iodale lfes (fa2tr( ooo0tlt moetasla uluvo t4teerxf3iytoatelivslt setmxmpiu1amt mfvtatfsrum( oot1tlto fctas s ran ont4tlerifctytomtrli i;( trumxmpnydlptnlivias) 2tr(r ou0tlxomoeiytfs rl(vp;t0trxomo iotfp rlu i t0s2to(mpoudlm   neias  rtau ooo1olxniociyd s uln s t) rxomf3ta1fa e nvo;( seto(r3oodapen netatf rtaxm ;o1aptomi3tlsfa2rm( o;u4 rxoir tytopte i il(0srxoio3oodom  miet ( srurxm nu1aex ii3iydlsDran o;(4 eenif totfmDean o;(0t2trimpou4lmtn fcsltfa2rr(rpno1tlen o3iydfm rmn snt)teeoio3ty1op elivi s0s2xoxm3oo4omte ieia( a2trxmono1opx mf3iatfmDran p;t4trtnxo oo1laD  ies (  etoxm3nu1lptnmnvt t srrmx onu4apt iiciasfsDeanmo;()trxnmf tydom eanvolt t2umxo iu4aleelfeia() Dta( ono4apx ii3iysfm umnvpnt) rerir iydomD lueols0sruo(r3oo1aptelnviatf Drrxmont4apxo o3iat sDelump t) lxomocoatlptr ieo s0srxo(o nydll e ieslt)s2taxmpnt1optnmf3iyslmDra( ont0 rtrmo3oodomDelues t)t2urxrpiy1opeelfvs tf rur(rono4tpenio3iysls ea( onu4artoir3tatfp  au o s  2toxrpou1lmt mfvi s)srrrxmpno4ole ioetlsfsDumnmpnu)treomfcio1fmDeaivi;s)trxr(m iydll nmici (  2ta(  nu4apxniiciys a rl(mpnu)artomfcoytfaDr n o;t) euoxrpoy4lm e nvsa() Dta(  ;o1tltoio3iydlmDrm(vsn()altnio iy1laDraivs;s) rtoxrpoydolt  nvtas)a2umurpnu1tptnmf3iytfs2ua( s;u4altnmf3ootlat aneo;s)t2to(rpoy1open ivt t)s2tau  no0apx iocildlsDumuvpn(4trtnio oo1oaDranei;t)trtm(o3nu4lltn fctas)aDtmumpnu0olt mociasla umn o u) lermfcty1lp r neils sexm(rpiy4lptn fesl()s2rm( pou1altnmo3ias m2rauvo t) etnif3io1lp  aueols0t2uoxopnudameelicsas)s2raxronu0aee io3tyt m rmn o (4 rtrio iodlmD aivo (0trurio nu1ap n nvs s)srtmx  oo0alxnmo3ildla elnmp t) lxnio iytfa  liei t sruoirpio1oltnmfvilt  2ta(  oo0texnmfctaslmDean p u4aetoif3iadfmtr uei (0seurirpiydlpt mfcs t sDumu  nt1oex mi3tytlmDea( s t4 renxf tydoatran o;t0sexoio ou1omtelictl()a2um(mo;o4apt mo3iltlm emnvs t4trxnxr3iotomDrln s;(0srxo(r3no4lmte icias)aDurx oot1oeeoio3tlsfs uan ont4tlxrxo totoptrauvo t t2um(r oy4optnmneia(faDurxr oo1opxo fetadfaDelnmsnu)artoir3to1lm e neo;t0sexo(o oydaltemici ()aDraumpnu0aee ii3iydfa rlnmsnt4aexrmfciy1om rlu o t)srxrimpnu4al   ieilt a2rmx  ;u0tlxniicildlaDrauvo t4tlxnxfctadop   u o s  euo(r iudapt mfetas a2rrum nt4alx iociatlaDuauvsn(0aexnxr3iytoptr uvo;s0s2urio3io1opee netlt srrm(  ou4tpt  fctadfs2rmump;() rtoxf oy1fmt aivslt s2xm(m3iydomt  fei s)a2rmxrpnt4ope ioetadlm2um(vo t) ltomr oytoa e n i;()truoio3nudom   ies t a2ur(ro;u4aexnioctasla2el(mp;t4areomf ta1optelieo t0 2xm(rpnudamt livs ( s2umx oot0oeto ociad s emump;t4altnxo iotfmt ai olt)texmxm oodaptnlneslsf 2umx  ;u0aptnmf3iytla2rlums u4 ltrxoctadopDe n i;(  euoxr3oodap  mfcs ( arraxr no0aptomf3tat m2rm( on(0 rtrmrciotoaDeli i t t2xr(r ny1op n feilsf Dtaxmp;t4ape iieiadfsDra(vp;u)texnxo3tytfaDeluvolt  eumxr oo4lpee ncsl( a2rrxr nu4oetoif3iyt m rluvs (0areomr iodop eluvi t  rtm(o3ny4altemncsa(f rtmumo;u4apxn iciytfa elnmp;u)tetnmr iotla eau s ( tetmio iydal  lfvi s)aDtr(rpnt4aexnio3iys a2rmnvs;t4tlxrif oytlp  lnes t trtrir ny1ole livils sruaum ;o0oeeoif3tlsfs elnmo t4arxrxf3ia1faD an i t)seto(o iu1lltemnei ( a2rmxr ot4tpx mfctadlsDraump t4tlxrxr iydlmtr neo (0 rum(rpnodapenmicias aDrrx pou4aeen ociydlsDumnvo t) rxnmr3iadlmD ai s t0 rur(o3io4am  livslt)srtrxmp;o4tpenmieiasfm2elu o;u)texomf3tadfmD lneo;s srxmirpno1ap nlictls)artmur ;o0opto ietltlm2rm(vp t4 rxomf io1omDeluei;()s2xrxo3oy4omenmnvtatfs2raxm no4aeenif3ilsls2emnvo ()altrioctatlmte nvol() euo(rpnydalt lfes (f ruaxrpot0aexnioctlsfsDemu pnu)alxrir3oy1latranei s t2toim no4lpt mnci (faDuau pnu4opx iieiltfm rm(ms;t)teerif iytlpD an s s0s2uoim nodameemncsas  Drr( ono4alx  o3tlt mDulumsn(4 rxoxrciatlaDrau i s)s2uoir3io4ol  lnctls  2rru ono0aex mfeiytfsDeauvo;u0 reoir tydlmteln o t0 2trxr3iy1om nlnes t)aDtrur no0tet  octys m2rl(vs;t0treomoctodfmtrau o s  2xrxr iu1amt mfeia(f rraxro;t1oet mfciysls2umuvo;t4trtrmfciadoa  aueo;()t2toim oo1ap emicsat)sDtm(  ou1opeomictasla rl( sn(0tltomociytfa  au s (0texoxm3iu1al nmfviasfaDrrx pno4aex if3iat m2rm(vp (0altnxocio1lp eli o;( texo(m nydlltelfci tfsrraum nt1tet ioeiasfaDeluvp (0aexrmr tydoa elueo;s  2xmir ou4amt mfcsas)a2tmu  ou4aet  oeiysla2umu s;t0areomr3iydfa elu o t0 ruoir iu4lmtn fvi tfa2tm( o;o4alxomfcildls elnmp;t4aeeoif3oodlm  ln i t  etoir3oy4olenlivi t)aDua( o;u1aeeomi3iatla2rl( pnt)aexoxr3ty1lateau s s sexmxmpoudlltemfvtlsfaDrrx o;o4tpxo f3ilsfs eanvs ()teeoxr iodlmtr i i s)sruoio iy4optemivta( srta(r ;u4apt  fciydfa ulnvs t0teenmf3iotfa  lnvo;s0 2tr(m3io1aleelneiasfsrtrumpnu1ole ii3iysls2uauvs u4tetriocoy1lpDe ivo;t t2urxrpoo4olt mivt () rrm(mpnt0alenioetlsls2em(mo;t)aetoio3ootfateln ilt)s2uo(r3oo1lptn fvi () 2urxmont1tpen octld s rmumo t4 eenmf3oydfmtraivolt) exmxr3nudam elncsl()srrrxmo;t1opt mfctysla rmnmp;t0 rtrir3ia1opt  uvs;(0srxmio3ou1lmtn nctat  rur( pou1oeeniociadla uln snu0aexoir3oo1fpDe uei;(0trxrxr3no4opt lics sf Duaxr ou1aexnmocildla eanmo;t4aexoif3ta1lpte iesls) exmxm3nudom n nciasfa2tmumpno0aet  f3iltfa2eanmonu4 exrio iotlmt  ieil()t2xoirpoodll   nvil()sDrmumoot0tpx  ociyd s eanvsnu4 rxrir3tytomDrlueil(0trxmio iy4amtnmfciasf Drm(mpou0oee miciys s2emump (4alxnmfcoytlpteaieo s s2xm(r3oo1ale mnvtl(fs2tm( oot4tetoiiciyslm ranmp;(4trtnxo3oa1fp eluei s)sexmim io4aptnlnctls  rrmx ono1alenifctat a2umumpn(4 rerxf oadlatelivs;( srxoxr oo1am nlncsl( srum(  nt4aeeomfeiysfm2uln o;t4 rxrio oatla  aueolt0trumio oydlpt  fctlt  Dua(rpnt0oeenmo3iyt s2rmn s t0arermociydfp e neo;(0s2toxr no4olenmivias sDrm(mpnu4tle mictytfa2elnmp t) lxoircoydlaD  i i;t)teur(rpoo1lme lici s a2rru ono1tpenmiciys s2elnvpn()trtoxf3oa1fpteai il()teuoio ny4lme lieils  rrru  ot4olxoiieild s2emnvo;()tetriociydlm r i o t s2trio io1op  lnvsl( aDrr(m nu1optoif3iyslaDrmn on()alenxf3todomteanvi s setm(o oy1om elnvtls sDumx ooo0ole ifeiys m rm( o;(4texoir3ty1fpDeaieolt)trxmxr3ny4lptnmnvs tfa2tr(m ;o1aexnmictas a2uan ont0 ltnio3iotfa e ueo;t srtm(m ou4om emnvi (fa2rruront4olenio3ildfa rmuvo;(0trtomf ia1lm raivs;t)texmir3oudolenlicta( s2rr( pot0ope iociasfs2elums u0 rtnmr3oatfaDraiesl()t2tm(o nu1ol nmfesa()a2rrx pou1apt mocilsfmDranmp t0 ltoxf tytlpt liei t0 2to(mpnydol nlfesas)sDrm( pot0oeeomieiad sDelu s (0alxnio iy1fm e uvol()srurxm3oydlp  lfetl( s2trxr no4ole moeiatfm2rluvpn() exoxo3iadop  auvo t)truo(m3no1ap  lfetl()srtaxronu4alt  ocildla2ul(vs;(0 exomr tadoa elieo ()seurxopoydomeelfvi tfsrraur ;u0opeomo3tadls rl(vo u4alxrio3to1om eai ols) rxoir iy1op   ict ( srrm(  nu4aleo i3ildlm umn s;u)teermocoytom rluei;t0 etmxrpoy1omeelncilsfaDrmxm ;o4apxnmf3iasls2ea(vs () eenir3ta1fmDeluvol( seuoir oydaptnlfci s)srrruro;o1oetnmfeilslaDranmp t0 leoio3totfa  auvs;(  ruoxm ou1apenmivs tfsDraxrpou0tee io3tlt m ua(mp (0arenxr3totom eanvi t s2urxm iydoleelnesat  rrm(m nt1aptnii3ildlm2elnmonu4aetomr oo1latr u i t)trxr(o3oo4altnlnctlt sDrrx  ;u1alt ii3iyd sDulu o;u0 renmocoytlat lnvi;s)t2xm(rpoo4lp  mfcsl( a2rmu  ou1opt mi3iat s2ulnms u) reoxf3tatfpDranes;()trtr(opoudal   ics s)sDtax pot1teeoii3tat a2eau snt4tetrircoy1fa  li s;s)trtmxopnu1ole mieia()aDtmu  nt0tex iiciasfmDean s;t) rxoxf oytlpte uvsls0trum(o3ny1lm elfeiltf 2taxrpou1oeenmicildla raums t0 lenxfcoy1omtraieilt t2tm(r3oy4op  lfctl(fsrrr(mpoo1opxoiietaslaDuan o;t4 lerxrctydfateln o;()t2xmxrpiu1alt mfvia(fartmxr oo0oltoif3iyt aDumuvp;t) rxnmfctadfm e uvils0setoxr3iydam nlies (fs2rmx  nu4tetoii3iatfaDuanvo;t0tlxomf3to1late nesl()srto(r3iydlltnmfeslsf Dta(m nu4ole  fcilt s2rlnmp;(0tlenmo3oodfmt  i i;s  2urxo3iydaltnmfctas  rururono0ale mo3tasfa2ean pn(4treniocoa1faDelnes s tetr(r ou1llenmnet tfsDuax ooo1alx moctadls2um(mp;u4tetrxr iy1fatr i i;t  2xrxm no1apeelnesat  rtm(ro;u1alx ifeilsfsDuau s t0altnxo3totfaD an ol(0 2uriopnu1lme mfviatf Dtmum no1aet  f3iatfa umnms u)tetrir3tytfmDeln i;t texm(rpoy1apte fci (fs2trxmp;o1apeomfetatfmDea(vp () rxrxfctadoatranvsl(0trtrxm iodaptemneil(fsruax oou0olxo f3ildfs umnms (0 ltrmo3io1oa  lnvilt)t2xr(mpoydamt mfet t)sDumu oou1tetnio3iasfa2elnmo;(0aetnir iadfpDeaieilt)seum(m3iudaltelfvsas arrrx ont4aexoiieilslm rmnmo u4 leoio3iy1fpDranesls0teuoxm ny1ll nmnetl(  2ra(rpoo0aex mo3tytla2rmu p (0aeenmr oytomtr nvsl(0texrxm3ny4ol  lncias)a2rm(rooo0altnmf3iatls rlnmsnt4 renmf3oy1op   ivi t0srum(m no1llenlfviat a2uaumoou0altoifciasls2ran snt0teeomr3iodfmDr ieils srto(rpou1ameelneta( s2raxmo;u4tee  icildlm emn p t0 rerxocoydlpt  i o;(0t2xrim3ou1op   fesat) Dtrxmpnu0tex ifctas m emums;t0tlxomrcto1oaDe ivi;(0srur(mpoy4aptemfetatfs2tmx  oo1tptn fciyslsDelnvo;u0 lenifciodoa  lu i;t0trtrxr oydlmtn iei t srraxmp;t4tee ii3tytlaDrl(vs;()artniociydomtrlu o;s)seto(opoo4aptn ncia(  2urxmo;u1tpxnio3ias a2eanmo;u) rtomocoadlmDelnei;s)trxm(o io4ap emivt tf rurxmoot4tlenmfciadla2um(monu0aetnmr3ty1lmD ai s s0sruoxr nudll emfet t s2uau ono1opxo octldfa ran s;t) exnir3oy1omtr nes s0trurir iydalenlictl( arua( poo1teenio3ias aDean pnt4altnmr oydoa rlivs;(0srtmir oy4olt mietlt)aDum(r nu4tlxo feildlm eaump;t)texomf3iotopte ivslt)s2toxmpiu4lp  lnvtatf 2tax o;t0optn fcilt mDea(mo;t0tetrmfcty1opt  uvs s  exrxm ny4ol nliciltf rrmxrp;o4tlxo octydfs ul(vo;(0treomfctydfa rai s s0 exoxm nydom e fetls srtmx p;t0tetnmf3ilsls2ul( snt4texoiocoy1oa   nvsls srxmir ny1ope lnet ( arrau oot4oetomo3tytfs umuvp t0 ltrmo iatfatrai i s0 2toim3nudopt  ictl( a2rm( onu4aex if3tydlm ulnvp (0 etrmr3ia1lp eauvils  euoimpio4lltemnct ( s2ur(r ot4tltomoeiadlm2emump u4artrxf3tadfm e u i;t0s2toio3iydll e ietl( s2ua(rono0oexnmfctytlmDuanvs;(0 lerio oytopDelivsl()setmim3oo1olen ivi t  rra(moot0apt  f3ilslaDua( snt) rxrmocto1fm elneils0 2tmir no1oleelics sfaDtmur no0olxomiciatfs2ean pnt4 lxomfciytoaDe nvi s)t2xr(rpiudom eliet sf Dta(ro;t1tle  iciadfs2uau pnt0 leomfciatla eaivol(0 eumxopoudomeelnvslsfsDrr(m ;t4ale mfctys m2ea(vont4arxnio oydfat aieo (0 2uoim oy1llenmfcta(f rta(ro;u1aetoio3iytls rlu o;u0trxnxr3ty1oate nes s)setrio3nudoltnmfvtlsfs2rm(rpou1teen ietysfs2emn s;u4 lenxf3iadfp eln slt s2umxo3nodal emnctat)arrm( ono1aexomfeiys s2ran p u)arxrirciodlmte u il(0teurxo oo4alt lfcta( a2rmum ;t4tex io3iatlm eauvsnu0 rtnxfcoatfp   nvi (0trurxm3ou4ole mnvt t)a2umxroou0aexnmoeiatfaDem(ms u) rtrxo oydfpD lieilt trumir no4ll  mfci s  Drrxr nt0alxoifeild mDum(vs ()aetoiocootfatelnvi t t2uoxo ny4ape lieta(fa2raumoot4alxo o3iatfm2el(vp;t4arxnioctadomDrli olt  rtm(mpny1al emnct () rta(  ou4tlxnio3ils sDumumsnu)arenio3oytoat livi s  etrxr oy4omtelneils)aDrrxmoot4oet ifeiyslmDuauvsnt0tetnxrcoy1lmt livil( setm(r3io4ll  lnvils) Drmumpou0tpxn fciysfm2rauvp t4aeeomf tydlaDranvo;s0 exmxopoo1ale  fvta(f 2umur nu4tetoiocilsfs rl(monu0 leoxf3oy1oa r n i;t t2xo(o iy1llenmictl(  2tmx pnu1oexnmoctat mDua(vp;(4 exomr3oy1opte ieols0s2xo(mpnudolee fvtl( aDum(r ;u4apxnmf3iyd aDuanms;t0 lxoxrciodfpD aues;t t2to(m nodlp emfcsl() rurur ;u0altn ieiyd a emnvo (0artoif oadlm  auvs;s)tetrxm oydamt lfeilsfaDumu p;u0oexnmfctls aDean sn(4alermr oodfmDraues;(0trum(rpoo4olt  fcs ( s2rau oot0teeomi3iydlm2ul( s;()treniocoydlm rli s () 2xrxr oy4lpenmictasf rta(  ;u1alen f3iatfs um( s;u0altnxo3ty1lp  anei;(0setoxr3iu1al emfvi (f rtrum no4tpeomo3iadla2rlnmsn()texoxo3io1fpDelnei;s0seumxmpnydapen feiat s2urxmp;t1opt iiciyd s2rln pnt4 exoircia1optrai s;t  exmiopnydlleelivsat)arrrxmpno4alxo oetltla2ulnvs t4trenmrcty1lpt  uvo;() 2umxr iy1lle lnct (f 2umx pot4tpeoifcilsfa ulumon(0 eeoxr3oytfaD  iesls  etmio3ou4lp n fvtls) 2umxmpoo0apen oetydfm ul( pnt4 rtrmoctotfpt  ueo t srtoxrpou4ame lncsl() rrr(r nt1tltn o3tasla ulnms;t4aeeoxfctotfaD  uesl( t2tm(opnu4lltnmnetlt)sruaxmp;o1teenmieils mDrlnmpn(4trxomrcia1optr n o ( sexm(r3nudomtemnctlsf 2umum no1oexomo3tlslaDuau snu0 rtoir oatfm  luvi;s0 2xo(r3oo4lme mfcia(  2raurpou1tet iictyt s2umu on(4 lermo iatfpt  ivolt t2tm(o3iy4om nmfcilt)s2um(  ;u0oee  oetltfm2em( s (4tlerif oytfa ranvs;(0sexrxm nu4aptnlfvtlt)sDtmu oot1tle miciyslm2umnvo;t4tltrmr oadlm  lu s;t)seurxm3nu4al nmfesatfartruro;o1apx ii3tydlm2rm( s;u4 lxomfcoo1oaDelu s s0trum(o3ny1lpenmfctls)aDtrump;o1tpxomfeilsfsDrauvs t) exrmocootlaDr u s;s)s2trir iu1omen nvi tfsrrmurono1ope ii3iatfa2uanmont4alxnmf3iatoatranvo () eumir3oy1lle livsls)sDtrxmpno1aetoioeildlm umuvp (0aleomfciotomt  uvslt) rtoimpnu1al  lnvil()sDurxmo;t4apx  fctys m rl( p u)alxomoctatfm  aues;( sexoirpio4lpeemfeiltf rrax o;u0apeoiieiatlsDua(mo;u0 lenir3iatlptr n i;t  exmio oydomt  neilsfs2urx ont4aeeo f3iadfa2elnmsn()arxrxo3tatfmDrlivils) etrim iudlltemncsa( arrru ono4tle ifeiydfs2uanmsn(4tlxrxf ia1lpt li o (0 eurim3iydllen fcsl(fsDuaxmpou1tltn ietldlaDrau pn(4teermo3totfmDe i il()srtm(m iy1ol  licsls) rrmx o;o0tpx ioeiasfaDemumo;t4 exnir3iatoptrai i ()t2xoxr3ny1omeelnvtas a2ua(rpoo4aetnif3ildla um(ms;u)arxoio3ia1fpD lnvils seumio3iydaptemietas)a2rrxm oo4tlxnio3iaslm2emnvo;u)aetoiocto1lpt  n ilt  rtr(rpnydal   nvt ( s2ur(mooo0apt  fctltfa rm(ms;(0alxnmr3iy1lmDe iei;s setriopou1llte fesltf Dumx o;u0oet miciytla um(vo (0 etnif ia1omtrlnei t  rtm(mpou1omtn ieta(fa2ur(r ou0tpxo oetyslsDemuvpnt4 rtnifcoytfpt  ivs;t sexmxm iy1am emieta()arumum ;u4tpx  octltfmDeln onu) renmociatfmt liei;(  2xrxmpoo4lmtnmnesa()sDtax pnt0tpenmietyd m rlnms;(0artnifcoadlm rau s;s0t2xoxmpoo4ol emfvsas)aDtrx  ou4apxomi3iasla2eln s t4aleoxr tydfa r i i ( tetoim iydlmtnmfci s)a2trxmpot0altn feiad s umump u4tlermf ootlpDelu ils s2tm(mpou4amenmfetat sDta(  nu4tlt  ieiydfsDeluvs;t0 lxnmf iatfmt livi;(0 rumio3no1ll  lfei () 2rrx p;t0alx ii3tyslsDrln p;t0alxoio ta1fp e neil(0teuo(rpnu1ame lnes ()sDur( pnu1texnmieiyt s uan s;()arxrif tadfmteai i (0t2xo(rpno1lpe mietltf 2rr( pno1oleoiieiasfs ea( s;u4 renmf3tydlaD lu olt)trum(opiy4llt lncsat)srra(root1oex iicild mDrmnvo t0tltoifcoatlp  anes t) 2urir3nudaleemfvtat sDrm(m oo4tlxniociydfa2ranmsn(4 rtoxo3iotlpt  u o;s0seur(opno4ome  feia() Dumxr ;o0oleo i3iyd s2emnmpnu)aeenxrcoodfp rai i;s) 2tmim ny4aleemiesls) 2tr(m ;t1aptoifciydfm eluvo;()aeerir ootfat aivs;t seurxm3nudol nlfes (fsrur(rpoo1tleomo3iysfs em(vp;t0tetoxf oatoa r n ols0t2tmxr3iydome mnvs ( arrau o;o1alxoif3iasla ra(vpn()tlxrir3iadoa   ivs;() rxm(mpiudol nlivsl(  2ururp;u4texnmicilsfaDrau o;u4 ltnxr oytomD aueo (  2tmxrpnu4llt  fesa()a2um(rooo4oetoiiciadfs ua(mo t4arxoioctydfpDelnvi;s)trtmxo3oo1apenmict sf rrr(rono0tet  ictltfsDem( o;u) leomo3ootoa eaueilt  2toio oy1om n nes sfsrrrx  ;t0tlxnifctltlmDeauvont4 rtrmr oo1op  li sl( tetmir ou1apt lict (farra(  oo0tlxoiieildfm2rl( pnt4 exrirctatoa e ivo;t0setoir3ny1olt lncs t srta(mpno4opxomoeilsfsDelumo (4 exnmfcoa1fmDeaivi s) 2uoxr3nu1lpt  netls) Drmump;o4alxn oeiad mDra(mpnt4 lxoxo3oo1lmDr i ols)seumir3nudlpt  nvt ( a2trxmo;u4apxnifeiydlaDemu s;(0 exnir tadlmD aivs s  eumxr3nydom n fci s)srtr(rpnu4tltn fciadla2rmnvo;u0trxnxr3oa1om r ues;(  euo(o nu4lm  livtls) 2trxrp;t4opx ifciatfs rmumo (0artnxocta1fpt  ues s texmiopoo1ol nlfesat  Dumu p;t4oleoif3tat m2rmnms;u0arenif3oytopt lnvol()tetrxmpiodlm e fcsl( s2ururp;u0alxnmfciad s2umnvont4 ltniociotla rau i;s0truoxrpoy1lmee nvta( sDuru pot1aeenioetytlm2rmn sn(0alenmfcoodfpDe ieo t) rxrxm3ny4lmte iesltf Drm(  nt0tex mi3tatfaDua( s;u4 rxrmf oy1fp rlu i t) 2xrxm3iu4ame  nctlsf rua(m ;t1aeeomfciys m2el(vs;()tlerif oydlp   ivo;t0s2trirpou4ome  nvtls  ruaumooo4tleoio3iltla rln s;t0trtrmf3totomDr n slt) 2trxm3io1al  mnetltfaDuaxrooo1tlx if3iasls2ua(ms;(4tetomr ia1fa e ivi t0 rxrimpou1open fvi s a2taxr no0altomfeiysfa2rm(vpnu0 rtoxfcoydfptrluei;s)teumxopou1alte fvia(fsDum(  ot4opxoiocils a2umnmp;t0alenxrcoadlmt anvi;t) etmim3nudll nlncia( aDrax o;u4apxo oeils m elumpn(0 rtoxr oatom elivi (0trxmxopio4om nlnctlsf rtrump;u1oexo ieiltfmDra( p (0tlerxo3ta1lmte nes s) rurirpiu1om nmnetlsf 2rmxr ;o0oleniicils s2raums;u4 etoirctotfmD ai sls0t2umxo3iydlpenlnci t aDrrxr oo4tpto feildlmDea( s;t)tlenxf3iotfm eli ilt trtoio io4lptnlietltfa2tru  nu0aexn ieils aDra( o;u4artrmr iodlp r n i;s s2urxo nodale lfvsl(fsrrmx  ;u4ape ifetatlaDean p;()arxrmr3tytomDe u ils0texrxrpoy1om emfvilt  rrmuro;t0oleomictltfmDem( p ()alxnirctytopD  ies s trum(opnu1lle liet s  2tmx  ot0optoio3iyt a2el(vpn(0tlxoxf3oydfmt  uvilt teuo(mpny4olt lfei (fsrra( pot4olto f3ilt s2eluvs;u0tlxnir iydfa rlieolt0 2xm(m3ou4op e fei t)arrru  ou1apt ii3iydlaDemu p;(0arxomrcoatlmtrlivi ()trum(m iu1ll nmivias)sDtrur ;u1oltnioctyd aDumnvs;u4 exrmo3iadop  luvo t s2uoir3iu4alt mivs (  2urum nt1teeomf3ils m2elnmp u)trerxf oodlat lneolt) rxoxm io4lmtemies tf rumx  ;u4olx ifeiadlsDrl(msnt4 exoifcto1fatrluvil( texm(r oudopee ivsa() 2urxmoot1tetniieiad mDrl(vs;()alxrmo iotfmDe nvi;()trtoxm ou1am elnvils) Drm(ront4tlxomocilsfmDrluvsn() rxnmo3to1fatr nvo;( trumxo3oo4lmte netlt)aDur(mp;o1tpen fetat a2uln p u)aleoxoctydfpteanvs;()srxm(mpny4apeelncil( sDra(monu4apxn ieiys m uanvsn(4 eenxf oatlp   nvs (0 2trxmpoodom nmfetlt s2raxm ;t4aleomfciadlm2ul(mpnu) lxoxr3ty1lpt lieolt0 rxr(m nydom nmfeils srtaxroot0tltoif3iyt a2ulu pnt4 exrxfcoy1omteln slt0srtm(opio1olee fei s sDtr(r ;u0teenmf3tasfa ua(mp u4areoio3tydfmDraneilt  exmimpiodamt lfcsasfs2ra(m ;t1tlt if3ildfaDrm( o;t4arxomr3oadfmtelnesl( srur(r3oy4al nmics sfsDraxrpnu4ope mfeiat s um( sn() lenxo oo1omDeai i s)s2tmir iodlm  mncs s) 2tmxm ;o0oetnmocilt s2elnvp ()tltoifctydfatr u il(0s2urir3iodam   icsasf 2umx  ;o0aptnmo3iasfs2umums (4arxrirciadlp ranei ( sexrimpiodalt mnvs t a2rmu poo0oltnmieiydls2ua(vpnu0 rtrif oytfmD aues;s tetrio3no4al elnct sfarurx ooo1ope mfeiltfa rmnms u4 ltnxo ootfpDeaieol(0srxrxo io4lmenmfvs t) Dumum oo4oet mo3iyd a2em(msnu0arxnmo3todom   ueo ( srurir3oudllt lfcsa()aruaur nt4ope iieiysfaDrmu s;u)alenio oydoat lneil(0 2triopoo4lpee nciat)a2taxr nt0aptnmfeiat sDuanvsnt)arermr tytlmtrlieo (0s2
\ No newline at end of file
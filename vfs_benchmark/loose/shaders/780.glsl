@@ -0,0 +1 @@
+uvsls)s2xrio3no1alte nes ()aDtrxmonu1tpen iciys s rm(vo;() ltomr3tydoptrlieo s0setoiopio1opte icils)srurum ;u1aptn oetltfmDumuvpn(0 etoiociytlpDeaueolt)srtoiopnydlpe  net sf 2umx pou4tle  fctytfm rmnms;u4alxnmocto1lat anes;t)srtmxo nodlm nmfetasfsDtrxront0tlxomiciys s2umu p u0 rtnmo3oodfpDrlnvi;t0trtmxm3oydame  icsas) Dta(r ;o4apxnmo3tyd mDrm(vp t0aetoxrctydfpD li s s0teur(o3nu1optn ivi ( sDtmuroot0texoifctltlm rl(mp;t0areoxf3oodlp eai sl( trtrxo3oy1ale  ieil()arrmurp;u0tlen ictatfa2rmuvp u4aexnio tytoat  uvol(  2xr(r ny1ol emivtat s2taur no4aexnmocilsls umu p u0 rtrir3todlpte ueolt0 eum(o oo1al  lnvia( s2umxmp;o4tltn fctlslsDrmnms u0arxnmfctodfm r ies;s) eurxmpnydolee nciat  2tax ono1aptnifcias m2ran p u)teeoxr3ta1laDe uvs;t) 2trir3nu4optn ncia(fs2ua(m nt4teenmoeiat mDra(vo ()teerxrciydfpDelnes;s)setrxrpoo4olt mfeslt  Dtrxro;u4aetn oeiyt s2umn o;(0 leoio ty1fptr i s;s sruoir3ou4op emfet s  2trumpno0oexnio3ils a rln on()artnir totfaD  nes t0truoxm3nodal nmnet ()srta(ronu0olxniieiyslmDemn pnu4 renxrctotoa rluvol( srurxr3nu4om   fvta( s2uaxrp;t0oeeomfeiadlm eaumo t4tlenif oa1om   u i s)t2xmxo3oy4ome lncil( aDtmu pnu0tltnmiciaslm elu pn(4tlxoifcoadlm r u ilt0 rurim3ny4om  lnvs t)srtr(rpot4aet mi3iytfm2elnvs;(0 eermo oatlaDran s;(0t2uoim3ny1ll emivt t  rtrx pno1aexo octys mDumnvo;(0 rtomf iytop ranesls s2urxmpnudlpte nviasf 2trumpnu0tpxo i3ilt aDrmnvsnt0trxoxrcoa1fa e ueo;( teumxrpoodll nmneia()s2rm(mpnu0apxnioetatls2emnmo;t)trtnmfcto1laDraivolt0setoir3oy1olte neiatfs2tr( ont4altomfcias a ranvon(0 rtoir3oy1latr u olt) rxr(o3oy4altn fvil()srurur nu1oetnmo3tldfsDemn p;u0 etnxr tadoaDrluvilt tetr(o no4omtnmneil( sDtmumono1teenmfciatls ea(vo (0trxnmr3iy1fp e u s s)sexmxo3iudale mietat  Drmxmpno1tlen f3tyd sDrau p;t0aexoxo ta1laD  nvs;s sexoio3io1olenlfes sfaDururpnu4olxn fetaslsDrmnms t0 eerxrcio1opDeaneo t srxrio3nudlpt  nes tfa2ra(r ou4apx iictls mDeln o;t4 exnmr3tadlpte nvi s srtr(m iu4aleelfvs t s2urxr ;t0texomf3iyt m2umumpn(0 exnxo3tytlateln s;s0sexr(r iydolee fvt () Drmurp;u0tptnmo3iys mDeanmon(0texnmr3ty1lm  li o;t sexoio io1al nlnetl(f rrruronu1aleo o3tysfs elnvpnu4tlxriocta1lm raieo;t  exrxr3nu1olt  nvia()srraumpoo4tpxnio3ildlsDuauvs;u0altnmf3ootomt li i;t)srur(opnu1oleelfvslt arur(m ou0apxnmieiasfs2uaumo () renxf oadlp e nvo;t0 2toio3oydlmte feias artaumo;t0tptn ieiadlm2rluvo;t0 ltoir oa1lat an i ()t2xrxo3iu1optnmncsas)sDrax  ot1tpe  ietydfaDea(vs t0 ltoio3to1omt  uvs;s texrxr3iy1ale mnet ()sDrrump;o0tlt  iciatlaDumums u)teerxo3ta1laD  uvs;(0srumir3iodomt mfeta( srum(mono4tpt iiciysfa rmnmo t) rxnxf3tydlm eaiei;( teuo(r3io1apeemfet ( arrrx oot4tle mieiat s2rlnvs (0 lxoif3to1om  anvi ()trxrxopiy1amtemnet sfaDurumono4tex mfetad a2ran o () eenir3tydlp   ieo;( truoiopiudamtnmivias  2ta(r no1ale ii3tldls2el(vs;t0texoio3ia1lm eaueil(  2xo(opoy1llt  icsas srtrurpnu4ope mo3iyd s2rl(vp t0teeoxo to1omD ln s t)srur(r3oodll n icsls a2tmxrp;u1tlxoio3tltfs ean s;t)tlerircoytoa  livo s  rtoiopiy4ame mict ()s2uau p;o4oeto ictytla2elums t0trxnmf3oo1omteauvs s teuo(r ny1oltnlfciatfs2taxmo;u0aexnii3iltlm umums u)arxnmfcoatfa r i i;(0srxo(rpnu4op   ivi ( srraxro;u4alxoiieiltlm ulu s t) eerxf3oytoaDraivil() 2to(o nu4ll n ncs s aDtrxmo;u1tltn ieiatlm2ea( s;u)areomr oy1lm  aivs ()seum(o3oo4ome lncil(  Duaumpnt1apt  f3iasfaDuauvpnt4 exnir3oo1fmDe uvsl(0t2tr(r3ou4ap   fvsl(fsrra(ront0apt mocild a2rln o (0 rtnmr3iadlp elu o;s)srtm(rpnu1omtemfvslsfa2tmu  ;t1tpt  i3iysfmDua( o;u) rtoifcta1fmDrlneo;() rtm(r ny4am elivt (faruaxrp;t1texoii3tls aDrm(mo;u0 rtoif3ia1oaDeau ol(0trxmxo3iydlpeelnct tfartrur nt0aet  oeiatlm rl( o () lxrmr iadoatrlnvo;t  rto(m3io1omee fvt t  2ur(m oo0tlenio3iydfm2ua(vo;t)aexnxf oatlm eln s s trtm(opio4lltn ivils) 2urur oo0tpe  i3ils m uau pnu0tltomf iodlpte uvs;t0t2xr(r nydape  nvilsf rrmur ;u4aee iieiatlm ea( pn(0arxoif3oodopD livi s setmxr ou4llen ics t  rtax  ou0tet ioeilt s rmnvp;t)texrxfctotomD  nvo;t0t2xm(mpiu1amtn ivias)a2taur ou4apxo i3iyt mDumump;t4 ltoxo oatomDrln i;s trtr(m oy4alee fvt (fsrrmumpnu0apt moeilt s emnmon() rxriociadfmDran s;t srxmxopoudlme lieilt) Dtmum no0texoioeilt m ua( p;(0aetnxrcoodla  anvi;s0texmio3oo1ol emfeils)s2trxro;t0tptnmf3ilsfm ua(von()aexnmrciytlmDe uvs;s  etoir oy4opt  fes () 2um(monu0aex mieiad sDra(vsnu)trenmf oadlm rau i;(  rur(m io4ol elieil(faDrmx  ot4tptoifcias a emnvon(4trermr oadfm  lueolt teurirpou4lleemncs t)a2rrumpno4apxnmi3iadlsDuau p t4tltrmf3oytlmDrlnvi t0 exr(rpou1ap nlnesas)srtm(m ou4tetomiciytfm2el( on() eerxr iodfptran o () rtoxopiy4ol e ivt t  rurxro;u0tpt  oeilsfa2rau s;t4arxrmo ia1la rli s s) exrxrpno1lme lnesl(  Dtm( pou1aee iieiltlaDel( o u)trxrio oodom eluvo;(0s2xrimpoy4op  lictlt)s2umu p;u1apeomfciytlm rau on(4trxnxf ta1latrlnvs;t0 rtrxo nodlm  micslsfsDtmx  ;u1alxoiictydfmDul(vs;u)altomr3tydomDeln ol()s2umxmpoy1omeemfet t)sruax p;o0opto i3iltlsDrlumonu)altnmfciotlaD au ils s2um(r3nu4ape lict () Drm( pno1teen i3ils sDeau s t) etnio3iatlmteliei;s s2xr(m ou1lp  mictat)arururoou1tetoiieiltls ea(ms;t)artnxf io1lp r iei s srtmxo iu1ameemnct sfaDra(m oo1tlto octydlaDrmnvs;t0trerio iytfa e uvs;t)sexmir3oy1ope mfcil()srur(  oo1tetomoeiatfs uanmpn(0tetnir3totop rauvi s)s2tmim iudlle  ies ( sDta( pou1tlxn iciatlaDea( snu4arxoxo3iy1lm elnes;s) etm(opnudopeelnesasfs2um(m nt4tptoiietyt s uln o u0artnmr tydfa e nes;s0 rurxopnu4omtn ncil(fsrtm(r ;o1ale iictlsfm2em(ms u) etrmf3iodfmD livo;t0srxrxm3iy4ll emfeias) 2truroot1optniieiltls eau s u0teeoioctodoatr ues t) etm(o3nu1lltnmici ()aDumx  ;t1oleo f3iysfsDumuvp u0aetnxr3iytopteluvol( s2xoxr3iu4ll  licta( s2raxrp;u1optomf3tltfs2ea(mp;t0 lenir3ia1oatranesl()srum(o3iy1lpt lfetl() Dum( o;o1tet  oetldfs rmu on(4 rtrxo tydomtr n o;t) 2uoio3iydop nmneiasfa2rax poo1aleoio3tat sDrlump;u0 eermrctodlm rlnes;s trtm(o oydal nmictls)a2rr(r ot1altnmoetadfs2rm( pnu0altrmr3iatoaD luvi s) 2xoir ou4lp emfcs (  2tr(rpot0teeniieiad mDrlnmont) etrir oatfaD li sl(0 2tm(r3oo1optn ies (f Dumx o;o0aexoifetys m2uanvsnu0trxomo3iydlpDelnvs;s)s2tm(o io4omt mfetas)arumuroou4tlxomfcilt m el(vo;(4aeenxf totlm   uei ( t2xoxr nudopen nei (faDraxrp;t4aeeo octytfs elnmp u0 lxoir ootomt au o (0tetmim nudamenmfei sf rur(mo;o0ope if3iyd s em(vo () eeniociy1lm  livo;s)texm(mpiy1om nlfvt t)s2rmxmpoo1tptoioctatfs2emuvo;t)arenmr ia1fmDe nvols0sruo(mpnudam e fct t a2tmurpou0tlx mieiadfmDrauvs u4 lenxrcty1faDe neilt0t2toim3iudop emncil( arrrumoot0aexnmiciydla umn s;t) rxrmr3iotoa   n sls t2urxrpou1al e fviatf Drmum nu4tlto octyt s2umnvsnt0tltoxr3ia1omte n s t) rtrxr3ny4om nmnet t a2rrx ont1tpeoiietltlm ua( pnt4teerif io1lmt anvi s  ruoirpiy1lltnmfciatf rrmxr ou1ape iietatla ua(mo;()tetrxfcoadoaDran slt) 2trxr3nodoltemnci sfaDrr(r ;t1tlx ioeilt a umnvonu4alxoxrcoa1laD luvo;()s2tm(m3oy1apenlnviasfsDra( oot1opxnmf3tlsfm2umu ont) rtoxo3oo1opD anes;t0 etmxr3oydome  fcsa()aDrm(rp;o0aexnif3tasfmDea(mpnt4 eeoxrciydomD  ies t0 2um(rpoydol n fci t sDurxmo;t4teeo fetlt a rlu p;()aetrmr3iydoaDr uei;t) etmimpoudlpenmivia(f 2umx p;u4teeo octldfm umn o;()artnio oytfm rauei;()sruo(m iu4lpen nvtlt aruru pnt4tpx miciytlsDranmp;u4artnmo iotfa raivs;s  2tmim3ny1optn fct () Drm(mont4tet io3tlsls2ua(vs;u0arxrir3oatopte nvs;(  rumim oo4lltelivsls)a2rruro;t1oetn ictld sDrlnvo t)teermr3tytoaD  uvs;(0 ruo(m3oy4ome  nctls sDrrxmooo4aetomf3tys m2umn p;u4alxomf iatfmD  nvo;()seto(o io1omtn iviasfartrxmo;u4tlx mfciyd s em( snt)alxnircoo1om   i o;t sexo(r oodop  lncsl( s2rrxrpnt1aetomf3tlsfa2uauvs (4 lenio3oy1omte ivo s)truoiopoodoptelfesls) Dur(mpnt4altomictydls2elumo (4trtnxf iytfa elueo;( srtmimpiu4llt mfctas)a2urumo;t0opeomfeilsfs eluvpn(0alerio3oy1fmD  ivo;s)trtm(m no1ole miviltfsDrrx p;t1tpenmicildlm em( s t0 reoxrcootfp rli olt0t2uriopiydlme liesa()arum(rono0aexn ociadfm uan p;t4 ltrmr3iy1fp elieo;s)t2xmxo3oodal e nvi ()a2urum ;t0alt  feils s elnvp ()tltrxo io1fp ran o s seurxrpnydale licsls)aDtr(  nu1altniociltfsDrmuvo;u4 rerif3iydfm r nvi;s seuoim iy4alt  fcias)srtmuro;u4tpxoif3iydlaDemnmp;u)trxnxfcoytlpDeauvs t0s2xoxopiudlpenmnctas)arta(mo;t4tpxnmi3iydfsDea(vpn() reoxf3oy1oatr nvs t0s2xo(o3ou4ale lncs (fsDrr(r ot0oetnmo3tltla rmuvo ()tleomr oadopt  nvs;s  exo(o ny4opt mneiatfs2rmxm ot0apx mfciyslm eauvs;u4aetnio oodla  aneol() exrir oo1altnlfvi sfsrtmxr nu1opeomfctat mDuanvo;t4 reomr ta1opDraies (0s2uo(r3io1lm  lfvi t)artr( o;o1tptomoetad a em( s (4trtrxf oo1latr ivslt0t2um(m3no1ol n nct (faDtaur ot1apx moctyd m2umuvsnt)teermr3oo1lm r nes () etoimpny4lmt  ncs tf rua( o;u0aleniicilsla2ea(vs t0aexrmrcia1oat  ivols) 2urirpoydllte fci s) Duaxm ou4tlx mfeils a uau snt4aetnmo tatfaDelneo t sexoxo oo4omeemnct t arrmxmo;t0olxniicilsfmDuanvp;t4artomfcoadomD  ieil(  rtrimpno1olenlneiat)aDrmxr ou4olen oetasfmDul(vp;t4artrmo oo1oateln o s srxmiopny1ope  fvt sfaDra(roou1tltoif3tytfa2ran o (4trerxr3oy1op r i i;t s2urir3iydaptemfcs t)srrmx  ;t0apxo oeild m2ua(mon(4artrxf3tadlatrluvs s)t2tm(o oo4om   ieil( srur(m no0aeeo ociatfsDeanvsnt0arxnmf3oatlptr ues (0s2xmir3nu4lptn fesas)srrmu o;o0tetomoctld aDrlu s;(4tetnio tatlpDe nvs s0 euoirpiudlmt mfctl()arrrxmpot4oleoiicias aDuan sn(4aexnxr3ta1op rau ols0srur(o3oo1am   nct ()aDtrurpnu0altomocils m2eanvo;t4aetrmrciotopD livs t s2xmim3no1al emivs s a2uaump;t4aet mictldfm uluvp;() rxoxo3io1lpt lnei ()sexrxmpiu1lptn fctat) 2trxrono0oetnmfeildls2ua( s;u4teerxf tadfptrau ol(0trtr(o iodlmtelnvs sfa2ta(  ;t1tle  o3iydfa rau o;u0trtnmr oatla eauesls texoxrpiu1openlfcias)artrur nt4tet ifeiydfm2eaumo;()altnif tatfa rliesl(0srxo(mpiudoptelfct sf 2raumpnt1aexomietatfsDemnmo u0tltnxrctotlm r ivi;t0teumio nu1lle lfcta()s2rax  ;o4oet if3tyt s2uanmsnu4teerxoctatoa eluvolt) rxoimpoo1ll e fcslt srra(m ou4tlt ifeiasfs2rlump () etoir3oodfmDr ivilt  rxrxmpiu1lpeelics t) 2ta(r no4altnio3ilslaDea(mp ()aeenmo ta1oate i ols0 2toiopiudlmt  fesa(f Durx pno0tlx ioeiys s eanvs;(0 ltnmoctytlmDean o;t0srxmxm3ny1apenlieils sDraxr ;o4opxo oeiytfa em(vp;u4trtrifcta1fp   nes ()teumio3iodlpee fcsl(faDum( oot4alxnii3tadls umnmpn()texoir tatfaDeaueo;(0 euo(m nu4olee fesls)sDuax pot0aptnioetasfmDumnvo u)areomr3oadfat anvo t0sruoxo3oy1optnmfviatfarurxmo;o1apx mieiltfs uauvs;(0arxnif3todom rau i;t  rxo(r3oudlpenmiviat)srururo;o0aptoiocildlm2elnvo;t0 leoxo3iatla   u ol(0sexo(m3oydopt lictls aDtru  nt0tpx  ieiasfm2ulnms t0tltniocty1lmD ln o ()trumxo3iy1al emfesl( a2tmxmpno4aeeniieiat sDumn p;(0 ltoxrciytfat  uei (0tetoxo3no1al   ivil() Duaxrooo1apenmi3tas s rl(vs;u4tetnxo3oadomtrluvo;()srumxrpnudlmenlfci sf 2urxrono4tpe ioetls s2uanmo u0 lxoif tatom e n i;s0sexmxopou4apenmfesas s2tmuro;o4tpenmo3iysls2rl(vp;t)aetrif todoaDr nei (  eto(o oo4ome mici s  Drm( pnt0ole ifeilslsDrluvpnu)aetoir3oydoate ies;( t2xr(opiy4ap emfeta( srurxr nu0aeen feild mDrlu on(0 eeomf3todopt ln i;(0 2toimpnu4optelfetls artrur no0texniociadlaDemu s;t)trxnio iydfat  i s;(0t2tr(r oudapenmietat) rurum no1opxn fctasls uln sn(0tltnmo3ootomtrauvsls0sexr(o3iu1ol elnvs t s2tm(m ;u4apto feilt aDumuvo ()trerxo3tydfm rluei;s srtmxrpnu4alenlivt s s2umxr ;o4tpx  ocild a2ea(mo;u4tetomrcoytfpteauvs s  2umxrpoudol elfes ()a2tau  ;o4opt  fcilt m2emumsnt4arerxocta1lat an olt) eurxmpoodlltemnetl(fs2tmxront4oeeomietyslmDelums;t)trtnxo ootfat ai s () 2xo(rpou1lltemfvs sfs2rax pno1opeo ictyd m uauvs;t4 leomfcoadla eln s t) rtoio3no1lmt  iesl(fsDumumpou0altnifctld sDua(mo;u0tltomf ootfaDean o;s0 rum(m oudlpen feiat srraxrono0opeoif3tldfs ul(mo;()tlenir3tadomt lnvi;t0tetm(r no1amtnmfvtlt  rtmx  ;u1altomfeiasfm eau p;(4trtoxr3oodlmtr i o t0srxm(opoo1alt  nvils)aDuau pno4aeeo fciatlmDelnvs;() etnxrciotoptelu s;() eumiopoy4lle  nesltfs2rmu oou0opt iocilsfmDumnvp;()arenmrcoa1lpDeau s;t)seur(opiydaptelfvia(  rtaxmooo4apxoifctasfaDuln sn(0 etnmr io1fm r neils0teumxr nodllt lieia(fsDur(mpou0apxnmicildfa2uanms (0alxnmo3iydfpD  ueo;( srxo(rpnodop elfeia(  rrruro;o1tlt ii3ild m ua(mpnt)aetnirciydlpDrli o;(  exoxrpoydomt mnesl(fsDtmumoou4optnii3tyd a umuvon(0texnxo3oodlmt  i i;s teur(rpiu1omt mfcilt) rtrurp;t4oltnmfctldlm2ul( s;t)trxrmf3oy1lp r ivi;s0setm(o nudale mivt tfarrruroot1oexo oeiatla2ua(mp;(0altoxfcia1oaD  neil( truoio3io4omtemfvi sfs2uax onu0tet  ociltfaDraumo u4arxoxo oytlmtrau s;t)seur(opoudop   icsls  Dum( ont0optomieiytla rau o;t0trxrmf3oydlpte u i;(0srxr(m nudllte fcils a2umxmpno1aleoii3ildla uau snu0tetoxrctatfm  li s t seur(m3ny4amenmnetl( sDtax onu1oltnifcils m ul( pnt4 rerif3oy1fm  li ils0 2tmxmpiodaptn ieta(f Dtmur ;o4optn oetyd a2umn sn(0tetnmo3to1omDr u ils seumir iydlp e fcsas) Dtaxmpnu0opx  iciatla2ranvpnu4alenxrcto1lat  n s;() exrxr3oy4ale mfetl() 2trxmono0opxnio3iyt aDuln o;u4trtrifcoy1fmDr i slt)srurir iy4lp nlfeilsfaDurxr ou1oeenmf3tydfm2ra( s (0 exnxr ia1lp elneo t0 rxrxo3oydom emfvs sfsDrr(mp;u4aee mi3iasla2rm( on(0 rxoifcio1omte uvi;s)s2xr(o3nudamt mfvi (fsrrmurpno4tpe mfciys s rmu p;t)teeomf3tytlat  ieslt) 2uoimpiu4omtnmicsa(faDurx  ;o4apeomiciys m2rl( o;t4tlxoxr3iatfmD lueilt0s2umxr iy1lmeeliesasfsDuaurpnt0tlen feiltfsDeaumpnu)alxnif oodopDr ueolt0 2uo(rpou1ll  lnctat)sDraur oo1aexo oeilsla umn s (0 lxrxf3tytoateli o ()t2umir iu4amte nctatfarrauroou1oleo oetad a2eanvp u4aetoifctydlpD  i s;() eumiopoo1ap  mfcia()sDtrxmpno0tpxoifciydls el( pnt) leoio3ty1oatrlivs;t0tetoxo iy4lptemnciasfaDua(mpot1aetniieiyt s ean o t)trtoxf iotomDe i i (0s2trxopio4ll   ietl()sDurumpnt0oexnifciyslsDrluvpnu)trxrmo iytlat  n ils0trxm(opio4om n ncslsfsrurxm ou0tltn o3ild sDrmump;(0 lxrxr oatlaDrlnvi t trumim nodlm elfesa(fsrrrxm nu0alt mf3iltla2ra(vpnt0teermo io1faDrln o ()t2xrxopoodaltemfvi t aDtm(r ;t1aetnmo3iys s em(vsn(0treoio3iy1la e ivol(0teurxr3iudlltemnvsl()aDtmxm ot4oee  oetlt m elums;u) rtnxr iydfm rau ilt0teurir3nodolenmiviatf Dumuroot0tetn f3iadla ea(vs;() renxf3iodlaD auvol(0t2toxr3oo4al nlfcilsfsruau o;u0apt io3ias m uln s (4tlenxfcoatfpDr uei;t0s2xr(o ou1ope  ieta()s2rmxr ;t1opxoif3ild a2um( onu4teenxo3oadomDraueo;t)t2xoir3oodam  livsls)s2taxm ou1alt ifetldlm rauvpn() ltrif3ty1lm r n ils)texmiopiy1ap nmictas aDtau o;u4apen ieiyt sDrln p u0texrxr tytlpD  ues () 2tm(opoodlme lics t) 2rmx  ;t1tlx mieiyt a ua(mp u4 rxomf3tatoaDr uei s0srur(opoo1ll nmivsat)s2rrxmono1tpx iieiydfs umuvp u0 etrxrciydfp  liei s)setrxrpno1ol nmivias  rraur nu0teen ociytla em(mp t) etrmo3ia1fmDr ivolt  2um(rpoydlm nmfvtatf rrmxmoot1teen icilsls2ean p;() lxrxf io1fmDrluvo;t)srurio3ou4ll   nvs t  2um(mo;u1tpxo i3tls m eluvonu0 lenmf3ootlatraues s0 exo(r3oo4op elnvt t  ruaxro;o1tet moetysfm emump;t0trxrmfciy1omDrlnvs;t texo(rpnydapt livtatfsrtaxr ;u4olt iictldla2emuvpnt0areoif3iydom rlnvo;(0 exmimpnu4lpt  ivils aDtmump;o1oexo ictysls2emn o;u0arxrif iodopt liesl(  2ur(rpiudlmeemnvtltf ruax pou4apxn o3iytla elums (0artrmfcoy1lat lnvo ( t2to(o io1omtn feiltf rtm(r ;o0opxoifetat mDuauvp;t0 ltnxr oydfmDr ueslt)s2tmio io4lle lietls aDrrump;u4olt ifetlsfs em( pnt)teerxo iotop e n o;(  eurxo3iodlmt lnvs t) 2ururonu1apxoiietlslaDran p;(0alerxo3tadfa rlieo t tetrxm io4olt lnvsa() 2urum oo0tpt io3iyt a emu on(0teeoio3to1lpteaueol( truoxo3iy4omenmietls)aDuaxronu4olenifciadfmDum(mp u0 ltnirciadfmD luvo;(  euoio3nu1lp nmneslt a2taumpnu0oltniieiatfa2uluvo;()tlxrxo3ty1om e n i;t0srxr(rpiy4lp  mici tf Drm( p;t4olxomicils m2raumo u)aexrmocto1la  ai slt0texr(rpoy4alen ncsas)artax p;t1oeen i3tydfa el(vp;t0aeeoxr oatfmDrli i;s truoio3oudlle mictlt)s2rm( o;o1tlt ioctysfsDrau onu)tetoiocio1oa rlivs;s0srtmxo iodom n ict s)srtrxm no1tlto feiasfaDrmump;(0 rtrxf oadoa rlivo;(0t2uoxo3oo4amen fvsl( a2ururonu1tetoif3tls m2rlump u)aexnmrcootla   n s;s0texmim ny1al nmivi sfa2umu  ;t4aleo oetasfm2ulu snt)altrmfcoo1lat aivo;s) 2toxm iu1lpenlicta( a2rmxro;o0oetomoetlt mDrluvonu)aeerifctodom e uei;s0trxrxm oo1amtnlfeils) rtr(r nu1oeeo o3ildfmDrmnvp t)trxnmo3oodlatr ivo;s) rxm(rpiydol nlfctl()aDrmxmo;u0oex mieiadfmDeaumsnu)arenxrctatfpteaues;() 2tr(opoo4lpen fetls) Drm(  ;u1oee ifeiaslsDel( s;u4tlenmo oatlmtrlnvols0texoimpiu4oleemivsat)srtr(  ou1tetnifeiadls em(vont)artnir oa1om  livi;(0srumxo ny4aptelictlt  2rm(m ;o0tleo oeilsfs em(vs u) rxrir3iydfpt lneo t t2toxmpiodopen ivt t aDtmx oot1tpenioeiadfa umu o u4 etoxrctydomDranvi;( teto(o3iydamtnmnesat)sDumxro;u4ale iictat sDraumo u4 rxniociatfa rlu olt  rum(r3iodlmtemnvil()s2ur( p;o1tptnmfeiytfs ean s t4tlxoxf3iy1lmDeluei;t srurim no1llt  ivtasfa2ur(root1oeeniietatlmDrln onu4arxoir3oodopteluei s)s2xr(rpiydoltn nei ( sDrmxr no0tptnioctlsfa2eaump (0arermf totlatrlueo s0t2trio ny1lp e ietl() rum(r ot0oex  fctld m2rlumont4 etnirciydlp elnvs s seurxo3io4llt mnvt t a2tru ono0oeeo fcild s2rmnvo;t4arenmr to1omtraivo t0teumxmpiu1lpee fcsa()a2uaxr nt4ale  oeiltfa2um( p;t4 exnmocoydfmD anei;t0trtr(o iu4ape  fcil(  Dtrumo;t4aptoifciat a2elnvon(4 reomo to1lp rai ilt)t2toxm oy4op nlivsltfaDurum ot0olxoiicilsfm rl(ms t4 lxnio ia1lm eaies;s  2ur(r3iu4am   ncs () rrrurooo4texomfctlslaDul(vp t0 rxnir3oytlpt au il()t2tmio3ny1apenlfvslt  Dum(mono0aetomfciysla2elums (4 ltnmf3todlaDean sl( sexrxo3iydamtnlfesas)aDrru pou0tptomf3iytla2rl(vp () rxnmfcty1fp  auvol(  rxrxmpiodolenlnvi sfartmumont4alxn oetysfaDua(vs t) etoif3iy1laD anes;t0srumim3iodllenlivta()sDum( o;o1olt  ietys aDua(vonu) rerir3oa1fptr ivi s0 rtm(o3nu1ol nlncta()s2tm( oou4tetniieilt sDemuvp t0 exnmo3oy1lm raivi s0t2trir iu1oltnlivta(  2trx onu1oex  fctadfm2rln pn()trtrmrctadfpDranei;(0sexr(rpnydalt mnci () 2rru pot0oltnmiciltfa2em(vp;(0 lenmo oodop  aivil( trtmir oy1ll  mici tf 2rmxm ot1oeenmieilsfa rm(mo;(4 rtnmr tadlateli s (0teuriopoy4ap  lfet s)a2tm( poo1tlto ietatfs2ra( s (4artoif3iatfa eau o t)s2xm(m iu1al e fctat a2ra(  ;u4aleo ieiatfa eaumo t4aetomf oa1fmDran s;t  etr(o3oudomeeliesatf Draumo;u4aex  f3tat aDran o;u)artrifcootoatran i;t  eurio ou1aptemfvs ( aDrax p;u4tpxomi3iatfa rau pnt) renir oydoa r uvs;s)texoxo3iodapt lnesl() Dtau  ;o1tptnif3tldfa rln pn(0arxnif oydfate ies t) etmxopio4lptn iesl(fa2rrum nu1ole mo3iys m2el( p;t) rxnio oatfpDrluvi;t)teumimpiu1al n ieta()sDtr(rpot1aeenmfciatla2rln s u0 etnif ty1fat  nesl()t2to(m3ny4ll   nvs s sDraurpou1tpx iieiasfm emu onu0 lenxrciy1fmDe u i;s)t2ur(r io4opeelnetlsfsDraxrpou4tlxn ieiltlaDua(msnt4 lxnxr3io1lpDr u s;s0trxo(r3iudlmte fct tfaDraxmpot4aptniociltfm2rlnvs u0arxomo3oy1fpDeai o;(  rxrim3oy1am nmncsls) 2tmxmoot4teto fetasla raumpnu)altrifcia1fmteanvslt)s2uoir nodalt lieiat)arua(  ;o1tpxomicildfs2uaumonu0arxoxf3to1fmDeaieo;( setrxm ou1ll emneilt)sDtm(  ;t1ale if3iasfaDulnvp;u)tlxrmrcio1omD anvil()srxrxopoo4lle  neta()a2rmxmoot1ale io3iyslm2ranvs ()teeoiocia1omtr neslt  rurir ny1ale mneta()aDtm( ono4oetomoeiatls2rmn on(0aexnmf tydop r u ilt trxoir3oo4optemncslsf Durur no1olx io3iyslsDuan o;u) exnmr3iydfmDeli i;()setm(opoy1lltnlfcs (fsDtmxmonu0aeeoioeilsfm rauvp;u)arxrxr3tytlaDelu s ( s2tmir3oudll elietlt  rtr(m ;u4tlto o3iltla uluvs;(4tetoxoctytfm eluvsls srtoiopou1op n neiat)sDrrxmoot1oet ifcilsfsDuan pn(0aetoxociatlptelu s s)seurxr3nudllt lnvi t) 2tr(  no4aetomfcias mDrmu o u0trenxo iydomt  uvs;(0t2uoir oy1ap nlneils)a2ua(rooo4oleo ociytfm ulu s t0 lenxo ia1lmDrluvi t0 etrirpnu1openlfvt sfarua(  ;o4tpenifctldfm2rl(vp u4tltrif iytoa rlu o;s)texmirpnu4op   ivsasf 2urumoot4oleoii3tltlm2rm(vpnt) ltnir io1fmteliei t trtoim iudamen fet t sDua( p;u4alen ociys m2ea( snt) rerxrciy1omD luei;s tetmxo oudole mivta(fs2tmxmoot1aleomi3iaslsDumu o t4artrmrctatlat lnesl( srtr(m ou4omen fesasfa2um(  ;o0tpenifetatlsDumu o;u4aexrmr to1laDelneols) rxmxo3iodlpt lfetas)artax poo1tpt moeiaslaDea(vpnu0alenmr3oadlmtelieo t0srumir nydoltemnvtl( srra(moot4aetnmictlsfaDrmumon() rerxr3ia1fa rlnei t0s2uoirpnu4lp e fciat)aDtr(rp;o0aexnii3iyd a ea(mo (4 exnmr oadopDrlieslt)trtoxrpno1lmtemfctat aDua(  nu4tpenmi3ias a ul( onu0aexnmf oytlat anvs;t0srum(o3io4lptnlncsls)a2rmxm nu1aee mfeiasfm elumsnt4aexrmo3oydom   uvs t0teuoirpou1ome  fvs ( arur( ooo1aexnifeiltla2ulnmo (0aeeoxf tadlm r uvs t t2to(o ny1ameemfcs tfaDtmum ;u1alxn ieiydlm rluvs;t0tetomo oa1lpDraneslt0t2ur(o nu4apte fvs ()aruaumo;u1tex miciatfsDeluvs;(0 etnmo3oa1fpDraivi s srxr(mpny1om  mfvsl()srtax  ;o1opx  o3iad aDul( p u4 rxoxf3tatfpt aivsl()trtoxo3ou1altn ivtat  rua( o;o4alxoiiciadls2ulnvsnu4 ltnio iotopDrlueo;s)s2urxmpnydlpenlfcils)s2tm(  nu0tpenmoctydla2ra(mo;u) reomo iadlpte ies;( srtm(o3nydape  nctl( arraurp;u4tetoiietad a2eluvp;(4 etrmf oadfmD lueo (0srxrxo oodlpeemieia( arur(rpnu4aexoiociys m eanvont) rtrxfcio1oatelies s  etr(opiodllt mfct ()a2uau o;u0apx mfeilslm ua( o u4areomfcio1lateau ols0 rxm(o3no1lmte fei sfsDtmx p;t4tlxniiciatlmDrlnmo;u4alenmrcoodoateaivs;s0 exr(o3ny4ome  ics ( aDuaum no4opxomoeildlsDua( pn(4 rxnxr ta1optelivo;t0 2xoxrpnydlmtnlnviasf Durur ;o1alt io3tasfs uan o u0tltoif oytfm elu s ( s2toimpiydop nmfviat)sDraxm ;u4opx ifctltls2uau on()trtnio iydomDeli o;t trumxmpiy1lm nmnvia(faDum(  nt4aetomietadfs elu s;u)alxrxr tadlpDr i i;t0 2uo(opoodlle lneta( aDraurpot0alx  f3iat m emnmonu4 rtnxf oy1opte ieo ( teur(opio4ll nmfcta( arta(mp;u4aeen o3iysfsDumu o t4 lxoircoydomDr ueolt s2urxm3oy4lmenmivt tfsrtmxm ;t0opx  i3iys aDemnvp;() rtnio iatomD  neo t)sexoio3ou1lm   nciatfaruaur ;u0aetoii3tasfsDra( o ()aleoxo iydfat aieols0teurxopoodapt lfcils)sDtru poo0tex miciat aDraump;(4tlxoir3iotfp e uvi (0sexr(o nodame lfcsl()sDrau pnt0apxoioeilt s uauvs;()arxrmo iatfpt  nvi;t0trxmxo io1op   nvtat  Dtaumo;u1oeenmoctysfa2emnmo t)tleoxociy1lmte iesl(0 exrio3oo1lptemicil(fsrtrxmoot1opx mi3tltfs2ea(vo;t0texnxo iydfmtr u i t srxrir io4om nmfcia(  2trxmpoo1olxn oeils m em( p t0artnmociydomD  uvo ()setrxmpnu4lmenmneilsfs2rmuront4apx  ocilt mDum( o;() exrmr3iadfa rlues ()srumim oydap e ics (fsDuax  no1ape  ociytls rl( o u0aeeoir3tatla rlueils  rtoim no4lp n neta(faDrrx  ot1oee iicilsfa2uauvo;u0 eenxo3iotfp  livs;t  2xrim3ny1amt mfvt t)a2tm(r ou1oexo octldfsDranvs;(0 reoxocto1lp rli ilt)s2uoio nudlmt  ict sfs2urxrp;t4tex ifctysfm2rmnmp t)teeomo ootlaDe uvs s) 2tm(o iudlptnlnci s s2rrurpnu0oeen ocilt m ul(vpnt0aexrxf3oytfa   nvol( setmiopoo1opte nes ( s2um(r ;o1aeen i3ildls ra(vsn()alenifciytlpD  i ils)seur(m nudom emictas  ruru pot4tlxomf3iytfs2rmu o u)altomo oo1fpDrauvi t) rtmim3iudal e fvs sfartaxro;t4alxo fcildfaDel(vp t0tlxnxf iadomteln i;s0sexrxr oo1apeemncsa( aDraur nt0apxomociytfmDean snt) rxnmf oatlateanei;s)tetr(o oydlme lict (f 2ra( p;t4tltn f3tatfmDum(mont0teerxf oo1omt livi;s0tetoir oodapen icil(farumxmpoo0aet if3iltfm raums (4alxnmo3oy1la   n i;s srtoim iu4lpt mnvtltf rrrurpot0tltnmociytls ea( s () etnif3oytfmteaueol(0s2ur(opnodam   ivt ( aDtm( ooo4aetomfciatfm2um(vs;u0arxnmr3iatfm raies;s0texr(r3iu1optemivsas a2rr(rpnt0tlxo o3ils mDrm( sn()aetomr3tytfaDrln s ()sexrxr3io4altelictltf 2tr(mont0apxoiociydfa2rl( snu)arxoif3oodfa ean ol(0s2trio oo4apeemies s s2ur( onu1tpeomo3iadfs2el(vs u0 renxo3oytfm r ueslt  rumxo3oydope lfeta(f Dumxront0aleoii3iydlm2em( ont) rtrmfctodopt li o;t) etoxm3nu1openmnvs t a2urxr ;t4tlxn fctyd aDrau onu4 eerir iy1faDe uvsl(0 exrir3io4ll  mivt sfsDrmur ;t0apx  iciat m eauvp;u)tleomf3to1lpDe ivsl(0s2toimpou4lm  mfetltfs2raxm no0aptoif3tldfmDean o;t4teermo oy1lp  ai i s) etm(r3oy4ap elncias srra(r ot4aex  ieiytfa2elumo t4altnif3tydlmtrau o s0 ruoxr3ou4lme  netat)sDurumonu4aexoio3ils sDeaumo;(4 ltomf iydfa   ivo t0tetrir oo1op emfeta(  Drrum ot0oexo fctlsfa uanmo;t0tetnio ia1fmtrau o;t)texoxr oy1omtn iei t)a2rau  ou4tpxo fcils sDum(vs u4altrmo3oa1laD  i slt)srxoxr3iu1lmt mivta(  2ta(  nu4tet ifciyd a emuvo;()aexrir3oa1oat aivs ()t2uo(opou1optnlfcsas s2umx  ot1ope iociydfm2ua(monu)arxnmo3iytomtelivs s0srtrxm3no1aleelfci () rta( ooo0teenif3ildfs em(vo t)trxomf3oadfaDeaieo;s trxmxo3iy1amenlfes ()artaump;o1aetnmi3iyslaDrmnvp u4treomrciytlpt  ivo;()sruoxo3ou4al emivsls  rrru ont0tleo ietat m2el(mp;u0artrir3ootfp rlu s;t  rumir oo4aptn ncsas)sDta(ronu1aee micilt m rm(vpnu4aexrif oytomteau s;t0t2ur(m3nu4lle lnvta(f 2trxrp;o0teto f3iysfs2ua( pn(4 eenir3iy1fmtranvo;t)s2uriopio4op nmfvslt arrr( ono4apt mfeiysfm emnvs;u)tltrmf oo1lpDrauvi s0 rxrim iudapenmnvilsf rtmxm no1apxo ietltfmDuan p ()altrmo oa1oa elu ols0trtoio3oo4olee netasfaDuau  ;o4aexomiciatla uau o;(4trenmrcia1late uvo (0 rxrxm3ou4lp   icsat sDtm(mp;u4olt  fctys s2um(vpnu4trenmfciy1fpt  nvo s0 exmxo3ny4lme licsasfarra(mont0tpe mfeilsfs2umuvsn() rxrmr oa1la r ieo ( truoim3nydlp n ieslt srrmxrooo4tpt miciys sDum(vo;u4trtoxr3iodfmtrlu ilt  exmxo ou4apeemnciatfsrrmu  nu1ope mo3tas m uanvo;u0 rtnxf3ty1la  auesls t2to(opiudolt  icil()sDur(rpno1tpt mf3ilslm2uanvonu0tetomo iytfmteanes t  2uoim ou4om  lieta(  2rrxm ;t0opxomo3iatlsDemnvpnt0tleoiocoytlp  au olt) etoxopiudlm nmiesls) 2urxmpnt0tlx  i3tytfm uaums u0trenxfctadfaDelieolt0 2ur(r3iudop nmnciat) Dtmum ou0oeeomoctat m rlnvs t)trtniocoo1lmDe u s;s) 2xrxm3iy4amtnmivsasfaDrm(m ;u1tlt miciasfmDuluvs u0 ltnxr oa1fpDeln sl() rtoio3io4op  mfctlsf 2tax p;u4aeeoioctaslsDuluvp;(0tltomr iadomDrlnvslt) rur(r iy1olee nci ( aDtm(mpoo4tee ioetltfa eln snt0 rtrxfcoa1oa  aieo;t0setoio3ny4op nlics t)sDuaumpnt4tpen i3ild mDrm(mon(4texnifcio1oateaieolt t2uoxm3ny1lpenmneil() rumu poo0olt  octat s rl(vpn(0 etoircia1lat  ueil() ruo(r iudllenlnvs s)a2uaxroot1aexoiiciyt sDrmump t4alxrifcoa1fateauesl(  etrio iy1apte ivia()arum(m oo0tleoii3tyd a ra( p;t4 eermo oo1omDe i ilt)s2xrxmpnodllte nct tfaDtaur ot1aex moctld aDumu p t)texnmf oydopDrlu i s0trto(o3iu4lmt lietls  Dra(moot4tpxnif3tls a2rmu snu0 lenmo oytfpteln olt0srtrxr3ny4om  mfetls)aDtmxm oo1tet  ociltlsDrm(vs;()trxnxr ootfaDe uvs;s  etoxopiydamtemiei t) Drmx pno4tetn fctls s2rmuvpnu4 rxomo to1op rln il(  ruoir3iodlm e icilsf rrr(roou1tlxoif3tat m2ulnvon(4trtnxocoatfaD  ues (0setrio iy1openlneslsfartm(  ;t0teenmoeiydfm2uau ont4areoxr oatoa   neol(0trxmio oudamt  fvt ()srrmxmo;t4tltnioeiysfmDulumsn(0aetrmr iadoa ean s ()srxrxo oudlmtemneia( aDrmumo;u1opt io3ildls rm(vo t4artnxf tatfpDe i ilt) rurxopiu4amtnmivta( sDur( pno0olenif3tadlm2emu pn(4aexoxr iy1opteaivil(0trtmir ou1ome  fvs s  rua(mpoo4tlenii3tytlsDrm(mo ()trerifciydom rlu s;t srur(rpnudapenmnesa(fa2tmum nu1ape ii3iasfa2el(mp;u0alxrmfcoa1fa rlu sl(0 etmirpiodom  lnvta( s2umx o;o4texoio3ilsfs2ulnmon()arenmrciydfat  i o ()sexmxo nodolen icsltf Dtr(m ;u1optomfctytlaDeluvo;t4trerxo3to1fm   nvilt0s2uoxrpoo1om  lnvias a2rr(mono4oltnif3taslaDrlu pnu0alenxf3oatfp rluvil() rxoxm3iy1llee nct tf rrmu  ;t4tle  i3tadlsDelnvsn(4 exomr iatla rlieo;s  ruriopio4ame mfvias srrmu  ot0tet  f3iad aDran o;t) reomociydlmDeanvols)setmxo3no1ll nlici ()aDrau o;u0tlx iieilt s2ea( s t4tlxrir oytlm   neils0 etmxm3ou4omtnmfes ( aruaur ;t4tpt  oetasfsDulums t4 eenxo3tydlmDrai ols0s2uoirpny4opeemieias)aruaurp;t1tltnmocias aDelu p;()alenmo iytopDean s s) 2ur(m iodoltelnvta( arrmumont1tetoifeiaslsDulnmont0 eeomf3oa1lp   nes s)trumxopiu4amenlncsat a2tmxmp;u1tpxoioetys m ra( pn(4tltrmf oy1omt an o s0t2umxo3nudlm emnci t srrrx pnt4aee  o3iysfs rlnmp u4altrmr3oy1lat li i () rxo(mpoodlpt  ncia(  rum(r nu1apx mi3taslm2ranvpn()aexnmf3tytfpD anei;s srtm(r nudomte fciat arrmu o;t0aex mfeiyt s el( p t)altnmo3ty1fp raueo;s)sruo(o nu4omeelivtls  2urur ;t0tet mfciydlmDuanvo;u4trxnxoctytfp  auvs;() 2xoxopou1alen fes t  Dtru  no4oetn iciadlsDum( s u4altnif3tadfm rauvols texoim3ny1om e nvt ( s2ra( oou4tptomieilsfaDemnmo u4tltrmo tatlpt  ueo t0 etoxmpnu4llte fciatfaDrmum nu0apt mfeiysfsDrln p;u)aetrxfcoadoa r nei;s)texmxrpnodlmt mneias artax o;o4oeto iciadfm el( s (0tltnmf tydfp  lnvo t0s2xmxm no4lm  liet ()sDrru  ;u0apeomi3iytfm ranmo;(4tlerxf3iydoaDelu o;s)s2trimpnodopeemnciat srtax  no4ape  i3iytls rmn pnt4alerir3tytlat  u i;s)teuoxo3no4lmtemies (f 2uax  ot1tltomoeiydfm uan p;()aeenxfctatfaD  nei;s0s2tmimpiy4amtnlies ()a2tau  no0oeeomoctadfa2ranms u0aeermfctydlmte n ils)trxrxr oydamt liet sfs2taum ou0tpxoifeiadfa2emn onu0 exnxo oo1lp rlivi;t0trumir iydame mfeilt)s2uaur ou0opt mi3iytlm2uau pnu) renmr3io1omt  nvs;(0setoimpno4olt liviat aDtm(mont1texoio3iydfm2eln o;() reoxfcoadfa  liei t0setriopoo4ole  ivi s)arrm(m ;t1aexomociat aDran onu) rxomf oa1lm   nes s0 2to(r io1olenmnvtas) rumxm no0ope iieiltfs2eanvpnu4 exomr3oadfmDeanei;t)t2toiopiy4alenmfvtas  2taxm ou0tetomictls a2ulnmo (4texrmr3ta1oateli i;t0srxoiopnudll  lnci tf 2rruroot4ope ifciltfs2el(vp ()artrir oatopDrli o;t trxoio3io4lle mfcta( s2tm(  nu0oet  o3iytfaDrlnvont)tlenio oadoat  uvs;( t2tmxmpiydopenmfvtat) rraxrono4opxnioctyslm uln snt)tlermr3oydlaDraivs s0s2xrxm3iy1omte ies s sDtmu pnt4alxn feiasls rlump;() eerxo tadfa e uvil()t2xr(m nu1ale lnct (f 2rrx ono0tpeoiocildlm2el(vsn()tltrxfcoatomteau i t texm(r3nu1op emfci t)aDuaumonu0tlxn octat s umn ont0 etoxo3ootlm elueolt) 2uoxm3iy1oleemfcslt)sDtrx poo1tpt  feiat a2rlumo ()tlerio3tydfateluvols)t2tmimpno4lltnmnetas) Drrx ooo1alt  f3iytls2emnvp;t0aetnio3iytfa r u slt)teurxm ou4lm   ietl( artaumoou4tet  f3iltlaDrm( s;t4tlenmr3oodfp  aies;t0trtmxr no1op elnesa(fsrtmx o;t0tlen f3iydfaDul( p (0 eermr3tytfp raivs;t0trtmim iy1apt  neia()srum( p;o1tlxnmieiadfs2em(msn(4artrifciotopt luvo;t0teto(mpou1ope  fciat aDrru  oo4open oeiltfm emuvo;t)aeermocoadfa  lu s s)t2tm(m no1omen ncsl( aDrmx p;t0opt ioetltfa umuvp u)aexoxf3tatla ranei;t texmxopny1oleelnetltf rtmxrp;o4tlen oeiad s2ran o ()trxnmrcootfaDe u i s  etmiopoo4llt lnvs s) 2truro;t1tlen ieiadfm2rln o;(4arenmf oa1op  lu i;s0t2xr(o iu1apeelfci (fs2rrxr no0olxniocildla2umnvs (4alenircio1fm  ln ils truo(mpoy4amtnliet sf Drmx pnt0aeeo i3iydfsDeln s u4trxrmo3iotfmtean sls srumim oy1lptn ieilsf Dumur nt4tptomi3tadfa2rmnmo;() eerir3oy1fa  aivols srum(m nodomen nci (f 2um( oou4tlt ioetys s rmnvsn(0 lenmr3tytomtran o;(  etr(r3oy1lp e netat srrax o;o0tlenmicildlsDelnvp;(0trxnmr oytlpDeln il(0 ruo(o oydlp  livtltfsrum(mo;o4aeen oeiytlmDrmu p;(0 lxnmr ty1faD aiesls)trxrxm oy1apeemivsls)arururo;o4tpt  o3iys a2ua(mpnt4tlermf3iadfa  auvs;(0t2xo(o nu4al n iesas) rrr( o;u4tptomieiydls el( snu)arermo oy1lp raueo;t)seto(r iodlm   ivtasfsrtax ont4apto fcilt m2uauvs;(4aexnif3iy1fmDelneol(0 rxr(m iy1oltn nvtls) ruaur nu1tetniictydfsDulumpnu4trtoxr tytom   n o;s0trumxopno1omenlneia(  rta(r nu1oleomocildfm eln on()tltoirciatomt ln sls)trurimpou4ope lnci tfsDrru p;o1tpen i3iadfaDea(vp u0areoxf3oy1oatrau ols)s2to(o3oo1llee fcils)s2rm(  ;o0tpe moeiysfsDemnvs;t0aexrir3iy1lat  ivs;t) rurio iu4oltemnvs sfaDrmxmoou0tlx  o3iydfa2rmuvont)altrxoctydlat luei;(  rxrxm ou4al  livsls)a2tauront1alenif3iltfm2emnmo u)trxrxo3oo1fat lnvi t0 2to(opou4op e ictas aruru  ou0olxnmfeiasfs ra(mo ()aeeoxrctydfa  au s;s0 euo(r nu4ap emici s  2rr(rp;t4tpeoii3ildfa2ean o;u)altoxrcoytom elneilt0 rtmxm3ny4open fvta(faDur(  ot1oltnmi3tytfs eluvp;t4altrmr3ty1fm ean o;t  etm(r iudlp n ncslt)sDumx p;u0apen oeiydls ean p;t)tlxoio3oadoaDe n o s  2xr(r3io4lp n nviltfaDtrurpou1oleoif3iltls rl(vo;(4 lxrir3oo1lm   nvsls) 2trir iy1alt  ietl( a2ta(ro;u0opt mf3ildla um(ms;u0aleomfctytlm   neol( srtmxopiu1ole mnesatfartm(rono4aleomoeiltlm2emuvonu0treoxo3oytfp rauvi;s0teuo(o3oo4apenmivt tfs2trxrono1aetn icild sDrmn p;(4 leoxf todfmt an o (0trurxm nu4ap e ictas) Dtr(monu4opx  oetysls eau s (0arermr to1fmDean ol( s2um(o ou1omtemietas)arua(moou4apxnifeils mDrluvonu) ltoxr3oo1lmtraivs;s sexr(m io1lpe  fvt s  rrmum ;o1tex ii3iad aDelump t4 exomfcoydlm ranes t0 etmxr3oy4ol n nesatfsDuru pnu0tleoiociyslm ulu p;u0 reoxoctotfp e uei t  etr(r nudlmenlnes (f Drr(r ou4apxomfcildlmDrlnvo (4texrxo oytfaD  iesls0teuoim3oydamte ivias srrru o;u0oex  o3ildls umumsnu) lxnxo3oy1lp eauvi;t)sruoim oo4apeemfcslt aDtr(rpnu4aptoif3tltfm2um( pnu0trxnxr ty1faDeauvolt0sexrxo3oo4am emict s a2umumpou0oee  ieiaslsDraumo u0aleoif3iodlat ln o;s0 euo(m3oodome miviasf Duaurooo0teen i3tldlm eluvpnu4 lxomr3iytfm e ueo t texm(o3nydoptnmnet sfsrta(  ;t0oleniocildfm raumonu0artrxr io1la eluei s)tetmimpnu4omtemiviasfsrrruro;u0olxnmo3iasfs2emnmo;u0 lxomfcoydfmt ln il(  2trxr3iy1lleemfct (faDrmxm no0teeoifetldls elump (4 renmo3tatla raiei;t) rtr(r3nudllenmnctatf rur(mooo4tpxn fctltlaDra(mpnt0alxrxo tytlp rlivi;( tetrxm oo1am n ivt ()srum(rpou0tptnmf3tlslmDrl(vsnu4 rerif3totfaDelu o;s0 euo(o3oydlpen ies ( s2umu pno1tpxoio3ild a umu p u0tlxomocoa1la rlivils)srxm(mpou1omenmfvi t a2tr(mo;t4oexoioeias m2ul( p;u0aetoir iytoat  ivo;s srxoxr nydole  ivsas sDrauronu0tetniiciltfsDranvo u4alxoif oo1faD lieol(0 exm(mpny1optemieslt)arrmxro;o4tleo ieiatlaDrlnvpn(0 leoxf iy1fmtrlneols t2xrxopoo4omte iet (f Dta(mpot1tptoii3iyt m2ul( o t) rtnir3oydlm   neil(0t2xoim oy4lptnlicsa( aDuru p;u4olen o3iytlm2ranvs;t0 etnir3oatoat lnes s0srxr(m ou1lmee ivta(fsrtr(mpno1oltnif3tadfs2el(ms u4 rtoxocoydfat ln i;s) eto(o nudlp  lfvsas)sDtm(r nt4opt  i3iltfm2rmu snt4tlenmf3tatlmtrauvo;s)trurxmpiydope  ieils sDtaumonu1olt mfcild a2rmuvsnu0 eenxrctytlmDelues;t) etmxrpoodoptnmfctas  2rau o;t0oee  oeiysla2emn p (0altnxr to1fmte n s;s  exmimpny4amt  nes ()a2rrumoot0optnmi3tytfm2el( snu0alenxo3ty1oa  ln olt0s2trxopiu1op nlfetls)artaurpno0opto fciad a2ea(vs u4aetrxo3tydoat liei t0t2ur(o oudomeemivt (faDta(rooo0oexo f3ilsfaDemn p;t4tleomf3iatfptrluvi;() rurxrpno4lltn fvt t sDtm(m ou4tee io3tls sDrmumo;u4treoxo iy1lm  lnei;t)t2tmxr ou4om nlicilt a2uaxmp;o1apeomociad s2uan pnt) etrir3ootoaDrlnes;t0texoim oo4ol  lneslsf rua(moot4aetn ictlt a rau p;(4aeenxfcto1omDr ivslt)trtoirpiy1ap emfvsa()sDtruroot1opto iciaslm rluvon(4 eenxo3totlm rli ils s2xoxrpnudaltelieias)a2taxrp;o4olxoio3iysls umn snt4tlermf3oa1lmtranvils0t2tmxr3ny1lme mivslt) 2ua(  ;t0teenmoeiasfs2rm(ms;u0tlxnxf totopD  uvi;t0 euoxr no4lp emietat)a2rr(r ot0opxn feiasfmDeau snu4 rerxr tatlpDranei;t seuoir ny1apt mieslsf rrax oou0alxomociyslmDrln p;(4 rermf3ta1fmD ln ol()truoxmpoo4ole  feia(f rtmxmp;u4alt mfciys a2eauvon()aetrmo tadomt  iei s  exoir3io1ll e netlsf 2tmxmo;o0oleo ociyt aDem(vonu0 lxrmf oo1oaDe uvolt)trtoim iu1altemfvta( srurump;t0altomociydlsDeanmo;u4 rxnif3iotfm eau ilt)srxm(o3oy1lltnlieslsfa2rmx  nu4oexn i3tat s ranmonu0trtoxrcio1oa ean o s seur(o nodlltn fcilt sDurum ou4oexn octyt a rauvonu)aleriocto1oaDeaivi;(  rtmir ou4lptnliesl()a2raxrp;o4alx  f3tld m2elnvs;(0 eermo3iadfmt anvi;t0 2uoim3iy1ll n nei t)a2rmxmont0oee  oetls sDuan pnt0 rtoif oytlaDrluei t)sexriopiy1lptnmicslt aDuax oot4opx  iciysfa2rluvp u) eeoxr3ia1om elnvs s0trtmim3io1altn fcs t)aDrm(mpnt4alxo fciysfsDeanmo (4aetoxr3todomDeauvi s) 2trxo3oo4ll   fvilt aDrrxront4texn fciydfa2ul(vo t0aeerxf3ty1omtelieslt) exmim3nydom  mfvt ()sDuaxmpot1olt mfciatlmDrlnmont4altomo io1la elivi s s2trxrpou4lptelfcsltf Drm(mpoo0tee  ieiyd mDrmu s u0arerif oo1op r ues;t0s2xo(m iu1ol  lnetl(fa2tr(  ou4oexnmi3iatla2um(msnt)trtnircootlpDrau o s0 rxrxmpiudam nlivt s  Drau p;o1teeoioetls aDrl(vs (4aetrio3tatop elneils  rur(o oy4oltemieiatf 2uaumoou0oeeomo3ild a2em(mpnu0aetnio3totoptr neo t)s2trxo3ny1lmenlfeta()srtmxmp;o0tlxnmoetlsfa2umump u) rerif tadfaDelies;t)t2xoio nu4lme  fvt sfartau pno1aet moctys a ean s u0trtnmfctotlptranei;t teumirpiudlpen ics sfsDurur ou1ope ifetad mDel(vs;()artrmo3ootfmtraneo;t s2xmxm3no4op  licil(f rtmx p;o1opt  fctlslaDum( o;u4treoir3oytlpt auei;s) 2xmxo oydlmtemivsl(  Dumxmp;t0oeeomfciadfs ua(mont0 lxoxo oydoatraivi;()t2tmir oo1al nmfvsls sDum(r ;t0opxomi3iltlsDulnmonu4 exrmo iadom  li s t0 exrxrpiudaltemicslt)s2rrump;t4tex mietadlm rauvo;t4 exoxr3tadlmDran s s  rtrio3no1opt licia( sDtmxm nu4tltnmoetadlsDelnmpnt) lenmr3tydomtean i t tetoio oodaptnmivtas sruau o;u4olxoifciydlm2ranmpn()arxomocoy1omD lieolt s2ur(r3no1ope lfvsasfaDurxr ot4teto fciysla2raump t0areoir3oo1faDeaies s0seuoim io1opt livi ( aDua(rpnu4oexoioeils s ran o (0alenmo3iydfmDeln s s0trtmxo oudapenmnctat) rrr( pot1altnmictas s2ea(vo;u0 lerif3ta1fpDrlu olt trtrirpio4ome  ictlt)arrr( ont4alt mictytfsDea(mo;t4 ltnircoydfaDeln s;() rtr(o3iu1lpt mfviatf rraumo;o4tpt io3iasls2uanvs (4tlerir3iodlmt lieslt)srtmxr iu1llenmicia(  rumurp;u0texn ictas m2uan onu0areomo3iy1la eau sls) rtrir ny4aptn nvtat artax ooo4oltniociytls ulu ont)aeerxf oa1opDe nvo t0s2trimpiydlpte fcslt srrm( pou0opeo ictyd s em(vp t0altoxf iotfpt auei;s0trtmxm3iudol  lneslt)arumu  ou1olx  o3ild mDem(mpn(0alxoioctotopDrlues;t t2trxopnu1lpt  ieiat  2um(  oo0tptnio3iyt m2rlu p (4texomrcoytoatelnes s sruoim3iy4oltelieias)aDumx onu4tpto ictatla2umuvo ()aetrif3iatfa  lnei;()teum(r3oo1lpenmiesasfaDtmur ;t0olxomociydfs elu s;t0trxomrciy1lmt aies;( srtoiopoudale micias sDtr( pno0ape  feiasls ean p;t4aexnmf ia1fmtr i il( sexmxopnydlltnmics tf 2tr(m nu4oeeoiicilslm ulumon()treoxrcoydlptrauvilt  rtoxr oodop  mnet tf Dum(mp;t1aeeoif3iatla2umumpnu)trermr oa1lmDranvo;()srxo(r3no4opee fvtat aDrr(rpou0olxoifeiatfaDemuvs;t4alxoifcoodlm r u sl() 2xrxm oo4ap  mfeta(f 2ua(rp;u1opx mieiytfaDrl(mo;()tetomr3totoaD an i;t  rtrim oy1oleemnvi t sDrrxmo;u0olx ioetadfm2el(vonu4 rxomociatop rli ilt0trtmir3iodlptnlivsa(fa2rmu p;t0opxn o3iysfa2el( p;u4 rxnmf3iy1fmDe ivi;s) 2uoir3no4ap  mivsl()arua(mo;t0aexomo3iat s rmnvs;t) ltrir oy1op   nes t0trxoxr oudomtnmnctlt  rrrxrpnt4tetn feiltlm2em(msn(4 ltrmr3oa1lmDr ieo;t0truoxm no4lmeemfviltfsDtmxroot1tlxoioeiyt s rl( pnu4alerxf3oydlat auvo;s srtrxmpoo4lp e ivi ( a2rmu o;o1tptoiiciatls umu on(0tetnifciatop eauvs;t0t2tr(o3oo1ap  lnvsatfarurxm nu1opxo fcildlmDumumsnu0 rtnxo3iydlmDran o;(0teurio iudaltemneil(fsrtmx oot1olxn o3ildls uaums;t)alenxrcoadlptraneolt setrxopio1lmen nesas  2tmx  oo1aptomf3iad sDuauvp;u)trerxocto1lmt lues ( texr(o ou1om nlies (f 2raxroot4texnmo3iydfa2em(mo u0alerxrcoo1opDeanvil() rtoxr iu1apt mivsat s2rax o;o1oexoii3tasfm um( s u4 lermfcoadlmDeaneils) eurxmpny1lp nmnctl(fsruaxm oo1aleniietyd m umu s (0 eeoxociydfa eluvolt s2um(m ou4am nlnet t) 2trurpno0oexoif3ilsfa2umumpnt0tlxnxo ta1fmte ivols  rxrxrpoo4ope mivs t  ruru pnu0oet iociad sDeaumon(0tltrmfcoytoaDraneols s2xm(opnydame liei (fa2rmu  ;u1olt mfetadfa ua(ms;u4alxomf3oo1oa  anvo t  ruo(mpiy4lmte ncslsfaDrru  ;u4oeeo i3ias a2eln o u4aetoifcta1lpD aieo s sexo(m3ou4lmtemnvs s)sruaurpou4olto fciadla eanmo;u0 ltrir iydlm raueolt  etoxr oudape  fctls sDrr(r nt4apxoioctadfmDul(vpnu0 reoir3oa1lp eaivs;t)trxmir nu4oltnlnesa(fsDumumpnt0alxoif3iytfmDrl(ms u4trxomfctytopD lnvo;s0sexr(r3ou1lmtemfvi s  rtr(rpnt1olen iciytla uln pn(0teeomfciy1lm elnvi t0srurir iudomenlfviltf Dtrumo;t1tptnioctys mDuln sn(4 lxoiocoo1latrln o;(  exm(r3iudoltemnvsl( s2rrxmooo0aexn feildfm2ranvo;(4tlxoxrcootfmDranvils0s2urxo3ou1amen ivils)sDurxmoou4tlx  oeild m emnmsnt)aleoio3to1omt lneslt teuo(r3nu4op emiesatf 2tm(rpnt4tetnmociytls rmnmsn(4 reomo oodfmDr uvilt t2ur(m oydlpe licsltfa2rax ono4tpeomo3tyd aDemn snu)aetnxr oo1omD  ivo;s0srxmxr3iudale  nct s)srrr(mono0aexn ociltla2elu sn(0tlenmrciodfp  auvo;t0trxriopio1ol e netasf rtru oot4aptnifciltla emn s (0 ltoxf ia1fmD lnvi (0sexoir oo1omtnmfesas)s2trx pot1oex mi3tld s2rlnmo u0 exnio iodlm eluvo t0 etoir3iydamen fvsas)a2uaxmpnt1tptnif3iydfm2em(mo;u0 etrio oadfaDraueo t  euoir nu4omen netls arumumo;o1aptomf3iysls2el( pn(0teenmr3ta1fp r neo;t  2xrxm3oy1omtn iei sfsDua(mpou1tpto oetas s2umumsnt)artrmo tatlat auvi;()seur(r oo1lmeemicslt a2taxmpou1aexnmoetadlsDea( o u0aeerxf3tatfpteln s;t)srum(mpiudolt  ieiltf 2tmx pot0apx mi3iytlmDuluvo;t) exrif to1lpt lues t0 exo(r3nydopenmnvsl(f Dtmx  ;u4oee  fctadls umump (0aeeoxoctotlptran s s0 2xm(mpny4lptemfvsa(f 2umxro;o1oee miciasfmDean s;t0alerif tydomDrai ols) exrim3iu4om   fesat  rtmur ;t0tpt ifciydfm2ea(ms (0tetomrcoodlaDelnes ( trxoxr oo1llee fvt t) 2ta(mpnt0teenmoctld s2rlumsn(0 lxnio iatoa  aueo (0setmir3iy1lm  micsas)aDurum ot0opx ioeildlm um(mpnu0aetoxf3oa1opt ln s s0s2tr(rpiu1apenmivsat)s2rm(m ;t4tpx ioctad s2ranmsnu4tlxrxoctydoa eln slt)sexo(r3io4lpte ietlt)s2taum nt1olxnmictytfsDumnvp;() ltomo3oo1la r i s;s0truoiopoodaptnlici s  Dta(  oo0altoifetlsfm2ul( o u)tlermr3totlaDeaneil()texm(mpio4op e nesasf rtrxr ;o4aet iiciadfa ra( onu) rerirciatlmDr nvs t)trurxrpou1ap elncta(f rra(rp;u0tpe mictyt s eanms (0aexoxo oytoa raiei t0 2xoxo oo4alte icils a2trumooo4aee  ieias mDrlnvo (4tlxoiocta1lpt ln s;( sruoimpiy4lmtemncsls s2uaxmpoo4olt if3iytfa ul(mo t)trxnxr3oatfmD luvols0t2xrxm nodlpe lnetat  Dtruro;t4tpxoiociyt sDelnvp;u0texrir iydfmDrauvo;t trurxmpoo1lm  mivsa()artmumpnt0apt  fcias a rlu snt0treoxr ia1oaD  ivils0texrim nu1lmtelneslsf Dtmumonu4oltnio3tatla2emuvo (4aexoif3iy1oat livs;(0 ruoxo3ou4om  livt t)aDrru  no0opxo ociltfaDemu s u4teerxfcoytoa elu s ( s2xo(m3oy4lpe lfcsas)sDtaxmpoo4aeenmfciat sDea( pn(0artomr ta1fate uvs t  eto(r oo4lle mieia( a2rmurono4open ietld mDeanmp (0tlxrmrctotoateluvol(  2xoio iydom emfvt t)s2rr(mo;o0olt mieilsla2eanvp;u4trtomfcty1lmDelues (0setm(opoo4al emfctatfsDrr(mpnu1tptoiociytlmDrmnms;t) etoxrcoa1op  lu i;( trxmim3iy1olt  nct s)srrr(r oo0apeomo3tytls2raumpnu)teenxr3ty1optrau i (0t2urxo oydlmt lies tf rtmum ;o0ope mo3ilt s uanmo;(4tetnmf3iodlp r ueols  2urxr oo1olen fes t s2uaxm nu4tetn ieiasfa2ea(vo t0trtnir3iodfm eaivo () rurxm oy4alenmfes s aDrm(m ou1tptnioeiad m rluvon(4trxnmocoytfa  anvo () rtrir3iu1lpenlicta( a2rrxm ot1tetn fcils mDra(mpn()texoxociadlm  lnvi s) 2to(rpou4om nlnvt t  Duaxmp;u0texnio3iydla2ean sn() lxrxrcty1lp elnvo t) ruoimpiudaltemfet t)arrrxm ;t0alx if3iasfsDulu p t0 eerif oo1lpD  uvs;t) rxrxopio1ll  lfes s srtr(mp;o0alxnmicilsla umump (4aetrxrciodoa elieols)s2xrir3oydoptnmies s) 2umxmo;u1apt mi3ilslsDumnmpnu0artoxrcootlaDraivo;t0 2xm(r3oydam elict tfaDumx o;o1olx iieiys a rlu p;u)alenxf ta1fm elnvo (0t2toir3nu4lm   fvi s) rra(rono0olenmieiad m umn s u4 lxnxrcoatlat lueo;(0trto(mpno1opeelfcslt arurx o;o1tlxoio3iytlm2rmu o t0 exniociadfa e ies;s0t2um(m iu1lpte fvta(f rrm(ro;u0ale mf3tlsfa2ua(vs;u)areoxr oy1laDeanes t0srtoim3iy1apenlnvias)srumxr ;t1tpxnifetlsls2eanmp u) ltrmo ia1lp r uei t sruo(o3iu1ap  lfct s aruaxm ;t1olt if3ilsfm el(von(0aexoxo3tydomtr ivi;s  eto(m iu1ol e fcslt)aDraumono1tetomo3tydlsDeauvon(0 lerxr iotlpte ieils truo(opiodale  fcslt a2urxro;o0aexniocild m ra(vp (0 etnif ta1fpDeaneo t) eumiopoo1al emneilsfs2umu ont4optnifetydlaDuauvon(0aetoxrcoodfm raivo;t srtoxm iy1ol  mietls arta(rono1ale  feiltfs uaumpn(4tltrmf3oodfatrlivo s)sexrio3iu4omee nei sfsDuru  nt1aee iociltlm ua(vo t4 rtomo ootlatr nei;s0 etmxr oudaltelivtatfaDurxm nu1optoioetyd aDemnmp;u)texoifcoydfmtrluvo t trxoim iy4am  mfvtls arrrur ;o4open o3iys mDeauvs u0areoxfciotlat lnes s0tetrimpiodolt mnct (fa2rm(r no0oltoiieiytlaDumnmonu) reoif3iydfate ueo;s)teumxr nu1optelfvta()artru pou4oexomo3tytla2emn sn(4alxoxr iytlaD ln o;(0trur(m3oydop   nvs (fartmumono0oet ioetys m2elnvs;(0 exnxocoytfpt  uvo;s0srxoio3oydape lfctat)artrx poo4tpe miciyd a umnvpn(4aeeomf oo1la e nvi t) rurxr oy4om  mnct tf 2rr(mpot4oet ii3tltfs ua(vp;u)teenxo oydfpt ai i t)setm(rpnydlm  mnci t)a2umumonu0teeoifetyslm2eln snu4 renxr oo1lm r uvs;s)texmio3oudop elfvt s)a2umx poo0opxo fetyslsDumn snt4texnmocoa1lp rai olt0sruo(opnodaptn fcilsf Drm(r no4tltniieiadlmDumn snu) rerxr tatla eaies;t0s2uo(mpnu4lpe mnctas)aDuaxront0aptn f3iys s emuvo u) exnxo3oadfaDr nvi;t t2um(o ny1aptelivias srraumono1aeeoiietyslm ua(vs t) etrxo tatfp  an i;s  etoimpoy4ap elfcsas) Dum(mont4aleoiieiyt a2ua( s (0trtrxr3oydfm   ies;s) rurxo oydale mfviat  2ur(  nt1tee moctldlsDem(vo t0 eeoif3oydfa  lueilt)srtoim ny4om   ivta()aDua(m ot1oleo ieilt sDul( s;u) eeomocoytopt  i o s  exmxrpiu1om n nvilt  rumu  nu1tlxo ictls s em( s;(0artnxf3tytomDeli o s trur(r3oy1lpe micsa( srrau oou0oet  feiys a2umnms u4 etnifcoa1fpteli slt) rtmio oodlp e ies t  Dtax oou4ale
\ No newline at end of file
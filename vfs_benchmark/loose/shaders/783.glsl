@@ -0,0 +1 @@
+nvs ()texoim ny1lleemfesl(fsDraurpou4tlxomociaslmDraumo;()tltnxo oadfa rlivsls0t2tm(m nu4optn fet ()aDrmu p;o1oleo f3tydfmDeluvp;u)arxrxf3tatlaD  ivil( s2trxm3iydom eliviat sDuau  ot0opeo o3ildlmDemn s;u)trtnxrcoydfp ranvs ( tetoir oo4lle mncilsfs2raxmpnt4olen oetlt s2rau p;t0 rtrmo ty1lat an s;t trxmxr3nu4omee ict s  rta( pnt0aex ioeiyt a um( s;u4altoxr3to1lp e i o ( teurxrpnu4lmt mfctasf 2taxmp;t1tet  ieiydlsDemuvo u0 lxomr3oo1fptraivolt  2trxopiu4oleelfvi (f rraurooo4olt  feiys m2ulump (0texnifctytop  ai s (0t2xo(o ny1lle mies (f Duru  no1tpeoii3iyslaDelums;t) ltnmr3oydfmteaieo;(0s2uo(m3nu4apt lfct s arum(  ot0oetn icilsls uanvs u4 eeoio tydfmtrlnvi s srtr(o oy4altemiei s) Dra(ro;t1tlxoii3tadfs2rmu s t0treomf oadlatr uvslt0srtmirpoydol  mfetlt a2ua(r ou4optn oetldfaDel(mpnt0altomfciadlmtrluvolt seur(m nu4omte fci s a2rrxrp;o4aeen o3tatla2rl( ont4 lxoir tytlaDeanvo;t)s2tm(r iu1omte ncsa(  2tmumpou1oeenioeiasfsDulu pn(4 ltrio oy1fpt  uei t0s2uoio oudopenlfet t sDtau  ou0open ocilsfm2elnms;()treomr todlaDrln olt trxoxo iy1olte fvsa(fsrur(rpot0aexniiciyslaDua(ms t)tetoio3io1lm rlnvi ()srur(mpoo1lpee fvtas) rumxmooo4aeenifetlt m2emuvo u)texoxo3iotoa rlues;()srxoxo iu1am nlnci s arumu oou0oexoioeiaslsDua(mo t) lerxocoatlmtrlneslt)srxmio3no1lm nmnesatfsDuaurpou1tlenmfcild a2el(mp t0treoxo tydlm eln s s  2uoir oudap emnci ()s2rmxmpnt1tee  feiasfa2rl(vsnt0aeeoifctatfp rluvi;t sexr(r3no4ale mncsa(farrrx pot0teeomociad s2elump t4 lxrmf3ta1op e uvo (0 etoir no1lptemiesa(fsruaxrpoo0olxnioctltfs2uanmp;(4 rxrio3ta1fm rai s;t0 euoir oodopt lfes ( s2rm(  ;o1aeenmo3tytfsDrl( o u)arenif oydlmD aivols0 rtoim iy1amt  neil()a2raum ;o4oeenmoctlsls rauvsn()alxoxocto1omDeaivil(  2um(rpoydopte net (f 2ua(monu4aex  oetatfaDemump t0tlxoxrcoytlp rau sl(0 2um(mpnudal n fci ( sDur(m ;t1oeen o3tyd s2umu p t)tetrio3iy1la  li i;() 2tm(mpnodopte iei s)artmu  ou0teenmieiysfs umn on() ltrxr oy1oat aiesls0 rum(m3ny4lpeemnesl(  2rr( pnu1olt ioctadfm2rlumpnu4 eeoxf3iodfmD au ol(0srxo(m ou1oltelfetlt artr(rooo4tptniociydla2rmu o;u) ltnifcty1lptraivol( srxoimpoy1lm n fvia(fsrraxrp;o4texoioeilsfm umnmp (4trermfcoodoateauvo s s2uoirpou4omt lfetl()arrm(  ;u0tee mfciys s2em(vo (4altnif oo1fmDe uei t srtoimpny1alt  fcil( s2ua(rp;o1altnioeiltla rlu p;t4artnifcta1fpDrlivi t)srtm(m nudaltemieiatf 2trxro;t1olx moeiasfm2uaumo;u) rtnir3iodoptrai o;t srtr(o no1amen fetas) rtru onu1tlen f3iatlaDem( o;u4 rtrmr3tydfaD  n slt  rxr(opnodaltnmiei t)arrrumpou4teenifeias m2umnms;()tlxnir iydopt  uvslt)srtrio3nu1apt lictl( sDrmumpno1apenmociysls em(vp;u)trenif iytfpteaivi s) eumimpoo4op e icil( aDtru  ;t1altomieiad aDemuvs t) eeomoctadfm eanes;s0 rurim3iy4lp   iesa( a2um(m ;u0oleniieiydlaDeaums (0alermf3iadlpD lies;s t2xm(opoy1am  mnet ()srra(r no4openmicilsfa2elu o;(0altrio oodlmtrlues;(  etm(o3iodom  mnvtl(  rta( ooo4alt  fetysfs el(vo;t4 rerxf3oydoaDrluei;( trxmir3nodlmeemnetas)a2ta( pno1aeen ieiysla rluvp t)trermocoy1fatean i;t s2trimpoy1llte feia()a2trumpno4aeto i3ilsfmDum(mp;t0trermrcto1faD luesls0s2ur(m3nydlle livt s srur( onu4tex ifetldfmDum(vo () reoiocio1omteau o t s2tmir oy1ol e fetat)sDtmuroot4aetomo3iyslaDrmu ont4artoif3ty1lmteln s ( sruo(opoy1al nlncsasfsDumu  ot0aptoioctad s rlnmo;t4aetoir3oodlaDr ieo;t) euoxo3no4ap nmictatf 2taurpno4tle ifciyd s2ulu snu0 eerir io1om e ies t0truo(mpoy4lpenmfetlt artru  ;u0apxnmociysfs uluvo;u4aeenio3tytlmDelueols texmxmpoo1llte fcs ( sDuauro;t0olt ii3ias sDrlumo;t0altnxo oy1latrlneslt)srtmxmpiudope  ivt (  ruaur no0ope moetatfsDean p;(4aeermocoa1fp eli sls)t2tmirpno4am elfciltf rtmxmooo1tlt ifcils a emnvo (4altnxfciadla rln i s  rto(mpny1lpt mfei ( s2urx pot0oleomfetad aDem(mont4tltomo ta1lp raneil(0 2umio oy1ale mfetl(fsrrmxmo;u0oeeoii3iydfa2uaumont4 rxnxrctotfmDeluvilt)t2urxopno1al  mfetltfartmumont4opx if3tad m2el(vpn(4altrmr to1lmteanvo;(0 eumxrpny4ame mnes () rtrx  ot1alt moeiydfa emnvp;u4trxoxo3oadoaD aieo;( s2umio3ny1lpte ncilsfartmxmp;o4ale mfeils sDraumo;(4trenmocoatlm rai olt)srxoiopoudomenlnvsatfsrta( o;u4aptomoetytla uluvsnu0 eeoxr oytfpDr neil()srxo(o3nu1llenmnviltfs2um(r nt1tleoiietytlaDrmu p;(4 ltrio3oa1faDeaivilt0 rxr(r iy1lp  mivsls)arurxmpnu1oleoifeils s emnvo t4 exoio oy1faDraneols0srtm(o ou4lp e nes (  2raxm ;t0aexn f3ilsfaDea(vsnt0texomo oa1lp  auvolt)teuo(opoo4ome mfvils)sDuaxm oo4olxo f3iytfa2emn o (4 lxrmf ty1om r u ols0trxmimpoydop   fcs s s2rm(mooo4alxomo3iysla2rm(ms t0 ltnio3tatfpt  n i s)srumir oy4opeelfvilsf 2raum ;t4texnmoeiadlaDrlu o u4 rxniocto1fpD  n i t  rtrio3no1ll nmivi t) Dumur oo0tptnmoctasfs2rl(mp t0tltrxrciydoatr n s t s2umir oy1lpenmfviatf 2trur oo4opx  o3iysfaDrmnmo u0 ltoio io1lpteauvslt srtmxopiudomte fesas  Drmx  ;o0oeeomo3tytlmDra(mp;t0alenio3iytfmD ln i;s0 euoxo nu1lmtnlivtlt srum(  ot1oltnmf3ias a2uan pn(4 exrir3ootoa rluvol(  eum(mpoo1om  livs tf 2tmx  nt1tlxnif3iat aDra(vsnt0 exnxr3to1lpDraivs ()t2xr(m oy4lmenlivslt) Dtrxronu4tpxn i3ild a ran p;u4teeomf oatfptr n ol( tetoimpiy4omt mnei s)srtm(rpno1tptomf3tytfmDrmuvp u4tltomf3oa1lmDraivi (0 2xo(opiu1lpe  iet s) rua(rono0apx ifcilt aDrm( s u4aeenmocoy1omDrlneo s0truoxrpoudamt  fctlsf rrmumooo0tpxnio3tad mDrlnvo;(0texomr3oo1la eaivo t0 exr(r3nudal  lfvsls s2rmxrpno1alxnifcias a2eln snu0alxomo3tydlmtranvo s t2toxm3ou1llen ncsl( a2urumo;u1olxomi3tysfa2ulu pnu0 lxnxocoydfmtran s t) exmxo3oo1lmtnlfetl(fsDuaxro;t0oleo i3ias a ua( o;(0aeermr3tatom eluvo;s0 etr(o3ou1am n fvilt sruaxronu4tle mf3ildlm2ulu s;u0tltoxrcoydfa r n s t  2tr(m3ny1lltelfeil(f 2rrumooo4opxnii3tysfs em(msnu0teermo tydom ranvolt0s2toirpiy1amtnlics sfsDur(mono0aee  o3tlt sDrlump;u0 rxrxociadopt lnvslt0sexoio3oy1apte fvtlsfs2rru  ou0tltnmoeiydls2um(vp t)artnxo tytfaDeaneo;(0s2xm(r io4lpt  ietl()aDur(r ;u4alx mociyslm um(mo (4 ltrxoctatfmteai i s0 etmxmpoo1optelnet ( sDtm(rp;o1apxoiociytlm2ranvs;u0tetrmf3todfptr ies s)s2umio iydom   fvilsfarum(m ;t4tpxnmoeiatfm ra(msnu) eeomo3ta1fpDeaneo t0trtm(o3oy4ole  fes (f ruaxront1oex mieiasfmDulnmpn()aleoif3tytom e ieo;s) etmir ny1lmeemnvsltfaDraxmpno0apeo ietydlaDra( pnu4tlxomo3oodomtraueilt)srtrimpiu4olenmfvt t) 2umxmoou4apt  f3iatfm ranmp t0trermo3iydfm  li i (  eur(o3iu4aptn fctlsfaDuax oot1oee mi3iydfmDulnmp;u)tetoio oodlpt livs t0t2ur(o ou4lpen nesatfa2raxm ;o0tpxn ietydfsDrmu o;u0tetrirctatom rli ol(  rtr(o iy4ap emicslt)sDur(moot0optn fetysls2elnmp;u4texrxf3oo1op elneo;(0 rxr(r3ny4oltnlfetat aDtmurpot0aet ii3ildla2elump;() ltoif tytop  lnvs s0trxo(m3nodoleelfes tf 2urxmp;u0tetn fcilsfm el( pnt0trtrxo oodomt  ivs;s srtm(r3nu1aptemietl( s2trxr ;u4teeomo3iatlsDranvo (4 rtoxo iadlpteaueo s  euoir iudlp nlfvtl(  rur( pnu0oeeo icils a elnmon(0 eeoio iotoa rlnei (  exmir3oodope  nct t aDtrxront1alxn ociatls umn o u) rermrctytom r i sls) 2toir iu4am n fvtlt) Duaxm ;t4oexo feild sDelu snt4 lxoio3tadlp  lneo;s  etmxr3nu4ame  ivt s)arrax pnt0tetomo3tasls rauvo ()areoxf3tydlmD an i;t srxrxopoo4omenmivsas arrm(r nt1tex  ieiysfmDrlnvsn(4artnio tydlptrauvo;(0 etrio iydllee ietl()arrrurooo1aexo fetas mDum( p;u)arxnxo3tadlaDrli i ( seum(rpnu1opeelfvsas) Dtaxmooo0ape  ieiatfs rlnmon(4artrmr io1lmDelivo;t0 2xoir nu4omtelivtas)aDrmu pno0opx iiciyt aDrau o t0 eenioctodla  lieo;t  eur(m no4lpeelfvi s)s2uru  ;t0tpxnii3ilslm2ea(vo;(0trxrxo ia1lpDeaies (  etmiopnydlpt mieia()sDtm(m ;u1tleomfetltls rlu s;(4 ltomf iytomt  nes ( srurxr ny4lmtemfvt s  2tmuro;u1tlenmo3iltls2umuvont4treriocoodfaDeli i ( t2tm(r3io4am nlnvsa(fsrtru o;o0ale  i3tyslmDeln pnu)aleoio3iydlp  auei t truoir oy4lpen nvi sfaDumxm ;o4aleo oetldfsDrau o t)arenmo3totfmD lnvs (0trur(m3ou4ame mivias) 2tm(m ;t0aetoiictadlaDrmumo (0trtoxr iytfmDe n i;t0 etmir ny4olte fvt sfaDrrurp;o4aexnii3iyslsDra(mp;(0 exrxrcty1fp rln s s)teumio iy4al elnvtl(  ruau  no4opt  fctysfaDemnvs (0altoiocty1fm  aivils)trur(m3oy4amenlietltf 2tax  oo1apen ieiytfaDeluvsn(0texoxf todoa eaiei;t0 rtrimpny4olt  ivta(farrmumono1apx ifciydfaDum(vp u0 lxrmrcoadomDe uvo;( t2tmirpoo1lp emfvtlt) rtmxmoot0optnio3iytfa2emu p;t)trtrmfcoadop   n s;(0setr(r3oo1ol nmnct (  Dtm( pot1apen f3iltlaDumump t4trtoxr oo1opt aiei;s)s2trio3iu1ale lnet (fa2ta(  ou1oet io3iysfaDrl(mpnt) rxrxoctydlpDeaues ()srumxmpny4llenmnvtlsfarur(m ot4alto f3iysls ulumpn(0 rerifcoa1laDranesl(0srxrxopoo1oleelnvsltfarrmxr no4teeomiciytfm emn pn(4aleomr ootoa e i sls0 etmxr3iydamtnmnes t) Duax pnu1apto fciatls ean p;() ltomo3ia1faDrlu o (0 exmiopio1omte neils a2uaxmpoo0tpxnmf3ildls2umu p t)teenmo oatfmt  ues;t)t2tm(r iodoptemivsasfaDrmur oo4alx if3iysla2el(vpnu) rtnxr3tydoa rluvsls)srtoirpiy4ome livilt) Drmuro;t0aetn fciytfsDrln o ()altnir3iatomtrln il(  2trxopnydalee ici s arururo;u1tex  o3tlt m ean o t4aexomf3iytoa rauvol() exoirpou4ope  fetasfa2rm(mo;o4optomiciysfm2rm( p u)aetrxrcoydlp r ivo;t texo(rpoudlmeelictl(fsDumx poo4apto ictyd sDum( s;t) lxnif3oa1lp rlivi s) rtm(rpio1alenliet (fsrumumpno0apt mieias mDem( snu)aeermr ootop  li ilt)tetmxr oodopeelfcs t srur(r ot4ape  iciatla rauvont0 exrmf3tydla e n s t0 2ur(mpoy1am   ieta(fsDuau  nt4olxnioetlslm um( pn(0 ltrxrctatoat an s;(0t2xrxopiudole mneta() 2ua(rp;t0olxo iciad s ulnmsnt)artrio iytfaD li ols0srxmim no1optelnciatfaDrm(mp;o4tltn feias sDulumo;t0 exnircoo1fmtrauvil(  ruoxm iu4optemfes ( a2tmx pno0aee ii3iysla ra( ont) exrxf oo1lpDeaivo;t  2xmimpoodamteliei s)srtmum ou1tpxn ociyslaDea( o;u)aexnmo oo1opDelueo;() eto(rpnydol n fetas aDrmx  oo1tee mo3iys sDra(vp t0 etomociydfpt  ivslt)setrir iudllen fci (faDtmx  ;u1tpe mfctlsls2ean o t4artoif3oo1opDraiei;(  rtmxrpnydop elietat artr(rpot4oeenii3iys a2emnvo;(0 exnir3tadoaDrlivi;t sexo(mpiu1amt lfetatfsrum(mpnt4aeeoif3iltla2ulu p;(0aexrmrctatfat  uvsl(0setoxr oudol nmfvt (f 2trxmooo4apeoii3iadfm rmuvsnu)alxoirctotoatelnei;s t2xoimpoo1op  lnesl( s2rru oou0tee mo3tat s um(vo t) lenxf3tydoa r iei;t) rum(rpio4lptnmfct () Durumoot1tleo icils s em( p ()aetoif3iytlptr ies;(0s2uo(m3oy1lpt mivta()a2rauro;t0tltnmfctlsla rlnms;t4tetnif3iy1oaDelu i t0 2um(mpio4lmtemivtat) Drmxrpot4aex  octld m umnmpnu)aexrmocio1lp  ai o;()s2urim nudomeelnci sf rur( pot1ale mf3iltla emnmonu4tlxrmf3iydlaD  ivi t  eum(r ny4lmt mnvsasf Dtr(ro;o0aex mfetasfmDra( sn(4 ltnmociodoa r nei ( texr(r oo4lltelfviat) 2taxroot0ape mictlt m ul(vpn(0 leomfcio1omD  ivs;s)truo(m iu1ap n nvi sfaDrmxm no1tet moctytlmDem(vo;u0teenir3ootla e neo s)t2urxo3iodll  micta( aDtaxmo;u0aetnmfciat mDua(mp (4 exoifcia1fpDrlneo;t)t2tm(o iodameemnvs tfsrrrxmp;u0tlxn icildlm emump;() ltomf3iatfm eli o ()srtrxopoy4ap e fciat) Dtru oot4oee  iciytfm2rl(vp;u)aeenmf3oodlp e i ilt0trxoirpiu1ol   ncslt  Dtaxrono4opx  f3ilsfm emn pnt0 rxnmr iytlaDelies;s  etrirpoydlmeemnes sf 2um( pno1tpe mf3tld m ea(vsnu0 reomr3todla   uei t0 2xmim3iodlmenmneslsfsruau p;o1opxnmoeild m ulnmpn(0aetnxfciatlmDe n ils)texo(o3iu1lpe mnvi sfa2um(rooo4tee ioetat m umnms u4alermf oy1oaDean i;(0tetrim ou4lme mieias sDtmump;t0tptoii3iatls2eanvs;(0tltnxf3to1lm rlieo;(  rxr(o nu1open ies () rra( oou4oexoio3iat a2emn s;()aexoxf3iy1fat anvs ()seto(mpny4ll emivtl(  Dua(ro;u1tltn o3ilsfa umums;u4teerif3oytoatranei s) exrio nudllt  netatfsDuaur nu4aeenii3ilslsDra(vont0tltnifctotla  luvo s0setrxmpoydllt mici ( sruru oou1tlenmo3ils m2ea( s u4tetomr3oodomDelnei s)setrxrpiodol  micsl(f rtaumoot4oeenmf3iatfsDel( s u0tltomfcty1lm rai s;( trxrio3ny1lm n iesas sDta(r ;t4alenmi3iatfs ranmo;(0tlermf3ootfaDrliei ()seumio3oo4amtn fetlt s2tr( ono1tpx micildla2umuvs u4alxrirctydfp  luvsl(0 exrio3io1lleemies (  Dur(  ;o1oetnmieiad mDeauvpnu4 rxrmr3oy1om raivils)seuoxopnydop n iet (f 2ur(m no1oeenmieiydfs eanmo;t0texnmfctydom   nes;t0s2umiopoo1ol n nctl()a2tr(  ;t0oeto f3iltlmDua(vo;t)aleoiociydoptr uvol(0tetrxm3iu1lptelfcsa( sDtaum no1alt  ictldfa2ua(mp (0arxrxf3ootfpteau ils trtmxo3no4llen ivi ()arum(mo;u0teen i3tasfmDumnvo (0 eerxfciotop eauei s seuoxo3nu1ome mnviltf rurump;u1apt  i3tat m ulnmp (4 leoxr ty1fmDe u i s teuoiopnu1ale lieia( s2ur(rpoo4apxo ociaslmDuau snt4 rxoio3oy1fptr ies t) eumir3io4lm nlnci (f Drax pnt1apxoiociadls2eln o t)alxnif oo1op  anvols0sexr(r3iu4llenmicslt)aruaxm ;t4olt iictytfaDum(vo (4arxnmo3oydomDr uei;t  exrxm oo4al elnvsa(fsrrrurpnu1openmieiat sDum( snu0 etoir oydop   u o s trxrxm nydop emfvt ()a2urx  ;u1opto ietldfaDrm( pn(0alermf oodfmDeau il(0 2trxmpiy4opt mneias)artmxm ;t4tpx if3iltfs2rl(vo u0alerxoctotom ran o;s)seumxrpny4olt  ici s arra(rono4tlxn oeiadlaDrl(vp;t4alenmo oatfptrluvs (0 2uoxr nu4lme mfct s  Drrxrpoo4tleniietlsfs rlnmpnu0 rtnxr3tadomDrln i (0s2xrxo3oy4oleemncslt)srur(rpno0apx io3iat s rl(vo u0aeeoxo iadfaDrlu ils)srtoxopiu4ap n fvsls)s2rr(mono0oltn o3ild sDelumsn()tlenmf3iydfp  aies;t tetoxmpiy4ome micia()a2trx  ;u4apeomictyt a2elu pn(4 leomr3totopDr uvi;t  2toir io4lm n ncsa() rum( p;u1opeo ictad aDum(vp;t0aleoxr3iotfp   uvi t0t2xoxo3io4optelncsas  rrru poo0alenmfciydfaDeauvs ()arermf3totfa rluvslt)trtoxr iydolenmneta( sDta(  ;o0tptn ictltfa ulnmsnt0artnircoatopD aivs;t)sexrxo oy1optemnctl()srtaxront4tet moetltla ul(mpnu4alxomo oy1la eln i ()seuo(m iodop  mncils)s2tmu o;t0tltnioctysla2umu p;u0altrmf3iatfmDranvs s srur(m3oy1lmee netl( s2trxmp;o1oleoiictysla ra(mon() ltrmo ta1lmDe ies (  rto(m iydlme  iet (farrrx onu4olx ioeiat a rlnvs u4 rermrctotlaDe ueil(0 rtoxm oo4ll   nvi (f Drmump;o0tpt  octld mDrmn o;u0alxoircia1oaDeaiesl( tetmxrpoudaptn fvi s a2tau ont0tee moetlt a ul(vo t0altomrciatomteanvs (  rurimpno1om  mfetas)arrr( ono1oeeoii3tldfs2emnmp;()tetrmo3iatfmD ln o;( trumio3oy1om n fvs () Dum( ooo1altn oetatfsDuau snu4 rxrmf oatop e i o t0srxriopiydalee feia(faDtaump;u0tlenmf3tlsfsDrlnms u0 rxnmfcoy1omt anvilt)s2uoxr iudol nmfeilt  rrr( oou0alxn ocildls em(vo;() etoir iadlpte ivs;(0setr(rpoy1lm  mfctas)s2urump;t1open fctyd s elnvo;()aexrxrciadlm e u o;(  2xoxo3io4amenmfctls) Dtruronu1tpe  fciad s2ea( p;(0trxomr3iodlptelues t trxr(m iy1aptn fctas) 2rmumo;o4oleniociydfs ul(ms;(0alxrioctodoa r ueil(0trurxo3iu1open fcia() Drru o;t0tetnii3iysls2rlump;t)trxrmf3ia1fp r nei t0s2uo(o nudamee ncias)sDuax  ou4tpxn fetadlaDrl(vsn(0 rxoxo3tatlpDeluvo;t)tetmir3nodomt liei s s2tm( p;u4oeeomociad a2rl(vont4tlxomr3to1opDrlnvolt0sexo(m iu1alenlfvtatfa2ur(rp;t1tpxoiieils mDrm(vs;t4 exrio tatlpteaivi s s2tr(o ny4lltnlfvs (fa2taum no4tpt ifcilt m eluvp (4tetnmr3iatlmtrlnvi ( trtmxr nydopeelict tf rurxroot0tpx if3ildfaDem(monu0 lerxo3totfateluvslt) rur(r io4ape lncsa(fs2rmu pot0tet ii3iyslm uln o;t4 exnxr3oatomDeai sl( trxrirpnu1opt mfct ()a2tmxmoot1teenmiciadlm rlnmp;u0 renmf oodomtraneslt) rumxm3no4amt miciltf Dtrxroou1apxomfciytlm2ean s (0 rerxfcoo1op elneil( t2tr(opoo4omen nvtl(fsrrau ont0aetoifeils mDul(vsn(4 ltnxr oadlaDraivi s) 2ur(o oy4lpeemfvtatfartm( pno1altn oetltfs rm( on() rxnmf ta1fm rlnvs;()trumirpoydamtnmnct ( aDrmur ;t4tleoioctls m2eluvo;u0 rxnio oatop  li i s)s2to(r iydopenlnvtltfsrtaxmpnt0aptn ietldfmDranmo t0aetomr3oatoatr ieolt)s2trir3oydlpt lfeta(f rtaxmo;o1tltomf3tld m2rmnvs;(4arerifcoodfptr neslt0 2uo(r3no4aptnmnesas)srtru pnt0apxnioeilt sDranms (4tlxnirciotom eau i t0srtoxr no1ame  feiat) rtm(r no1tlt mociydlm uau o t0arenmoctatlptraivi ()t2xmxrpoy1ll e nciat  rraxmpno0oet  fetaslm uau p (0 reriociydfp eai s s  eumxr oy1apee ies t)sruaxmpno4olxoiieiatfm em(vonu4treoxf oadlaDrlu olt0 2urxr3oudol e ivta( a2urumo;o1alxn feildfmDrlumpn()trxoifcoatlm   nes t0 eurir ou1op e iei (  2rruro;u0tltn o3tldfmDrlnvp u0 rtrxo ia1opDr ueo t) exm(rpio1aleemiet s)artm(r ou4openio3iadfsDran onu4 ltnmocty1oa eai i;s s2tmxr3iu1al nlivsas) 2ra( pot4tpto i3tas a rluvp ()aeenxrcoo1laDelivi s)s2xr(o3no4ope lici ()a2tmu  ou4tlenmo3tydls2eau snu0 leoxfcoo1laD li o (0seuoxrpio4ll elivil()s2rr(mpoo1opxniiciasfmDumn s u4artrir3iy1lm elivs ()t2xr(m3nydlle mnctl() rumum ;u4oeenmf3ilt s2ra(vo;()aeermr iytfpte n i ()trurir oy4lmt mnctas a2trxm ou1aeen feildla el(mp;t)aeerxo3tytom ran ilt0seto(m3oudopt mfeiat  2rm(  no0tltoif3iasfsDumn on(4tetomo3iydfpD au o ()s2urir oy4amtn ivi t)aDum( ono4apenmo3ildlaDulnvs u)trerxf iydfp rlivo t)trxoxo nudaptnmncs s)a2rmu ooo4olen o3tlsla2emuvs u4altnio tydoateanesl(0s2trio ou4ap   fvs t a2rr( pot0tpxomf3tas m2rluvs;(4aeenmrciytlpte neilt0 rurxr nu4lmee fvi sfa2ua(mont1oltnifeiaslm uluvp () lermociadlptr ieo t0 exmirpoudlltelneia(fa2taxm ;t4tpeoiiciadfaDelu pn(4 exnmo3ta1lpD luvolt teumir3nudlltnmnvtl(  rur(  nt0tpx iociltfsDumnms (4arxnir3iy1lptr ivs;(0 rxo(mpnodlp emnvsa() rur(m nt1ale  feiyt m eln s ()trenxr3oatfmtraieols t2urxrpny4ol  mfeia()sDtau  ot0oltnifctltfsDrmnvs;t0arenir3oodfp   ies ()s2xrir oy4lp  mnci sfaDur( pno0aex miciatfmDumumsnu0trxoifctodoaDelu olt0trtmirpnu4ll emncslsfaDumx oou0tetnmictldls rm(ms;u) exnxf3oa1fmD  ueilt)tetoxo oy4al emnei sf rtau  nt0olen feilslsDemnmo t) lenxf oa1lmDean ols)tetmxm3iu4ol elfctasf 2tm(m nt1aetn ociatls2uan onu0 lerxocta1opDelies t0trurxm oudllte ivs tfaDta(m ;u0optomo3ils mDum(vonu4 lenir3tatoaDraieol(0trxmxm3ou4optemieilt  rtau  ou0apx  o3tadls2ulu o u0artnxo3iatlptr ivsls0s2xmxm3iydllenlfet (fsrtaxrpou0alt iiciytlsDulnmon(0texnircootfpDeaieolt sruo(r iy1ll   ict s srumu  no4opto octadlm2eau on(0 rxnmr todoaDeaneolt) rtoirpnudom  lfei () rum(m ou4oeenmfctydfa ua(mo u)tltnircoy1omD ln olt0srtrirpiy1al  lncsas) Dum(mp;u0optnmietys s2rau s;u) etrxocoadlateai s s t2uoimpnodlp n iet t) Dta(m ot4tptn f3iasla2rlumpnt0altnio tytomteaues;s texoxopiy1olee nctasfs2trx onu0opeo ieiyd m2el(vsn(0 lxoxr iydlm  anvo t) eurim no1al   ietas) rtmu pot0tlt  f3ildla2rln pnu4tlxnxrcootlm raieo;()s2um(m oy1lpte ics s a2tmu ooo0teen ieiys a elu sn() rtoif3iodopDe uvi;( s2uo(rpiu4am nlnvsl(f 2ua(r ou1ope mi3ild mDrmnvs;t4 rtnxfciytomt auvslt seumir ny1ope lnvtat)srtmx pot4tlxoii3ils mDua(vo;t0alerxrcoatop r iesls0srtrio ou4oleelnei s sDtrx onu0aeen f3iatfsDem( p u0aeermo iotop e u i ()trtrim3no4lp  lfctl(fsrumx ono4ape mo3tatfs rm(vo;t)trenio oydlmDe ivo s)trxr(mpou4lltelnes t s2tru  ;o1aeeoiiciatfmDumu s;u0trtomr oydla   ueslt0srxo(mpiydaltn fetls)a2tax poo1aex mfeilsls um( p (0arxnxocia1omD lnei;t t2xrxopoo1lmte fctasfaDum(root1oex ioctat mDea(monu0aeeomfcio1optrli ilt0texo(o3nodlmtemnesls)arrr( p;u4olt iiciys s2uauvs u4 reoxo3ta1omt au il(0 exmiopio1lpte ics ( aDra(rp;o4teeomf3ilsfmDeau o;u0aexnmoctytfmtrln o;t0 etmxmpiodllt mieiat s2uaxr ot4tptoioctad m2em(vonu4trenifcto1lmte neilt srxmio nudam e iesas) Duaurooo4tlxomo3tatls umn snt4aeenxr3oodomtr ues s0 2xmxopnu4lm nmfcils)srrmxro;t4apxnif3tls aDrmnvp;()trxnmo iatopDe iei;( texrir3oydlleemfvtl(f rurx p;t4aleo ociyd a2ua(mp;u4tlxnxo3io1om e n i s  2trirpio4ol  lfviat)s2tr(ro;u4tee  o3ilsfm2eauvonu)teermr3totfateaivsl( s2xmirpoy1lpenmfei t)sDumum nu1openifctadlaDranvo u)arerxf oadomDraies t)trum(r3oo4aleemfvsat srrau p;u4olenmociyd s ul(vs;u4 leomf iytom r u s;s trxmxr3ny1ap elies s)a2trurpot1apeomictldfmDrm(vp u0 lerif3oadlmD  n s;s0 rxoxm3io4oltnlfvtas)s2umum no4oexn ociadfs rmumo u0tlxrxr3iy1laDr uvo (0teumim3nydom nmfet t srum( ooo4alt ifciat s2elu p;t4 lxnmocoa1omt livs s) rtoim ou1op n fetls a2trumpoo4oeeomietytlaDea( o u4trermf oydop  li o t  2xoim ou4lltn nes tfaDrru p;o0alenmo3tys mDean o;(4 exrir3iatomte nei;s)srxoxopiudomt  nvslsfarra(rpoo4opxn i3iyd s2ea(vpn()tleoxf3iadopD aivs;t0tetr(opny1amte feias)srtax onu1alxn o3tldfs ulnvonu0altrif3iy1omDeai il(  2xoxr3oodope  neil( s2urxmpoo4oexo o3tld s uan p t4 eenxfctatlmteluesl() 2xoirpoy4lpt lncsas)aDtmxm ot0tpx mfciys aDeaumo;()treomf tydlat lneo (0sexoimpnudam nlfvtlsfs2um(m ;o0oeeoiicils aDemump (0trenmo oytfa  li ilt)s2trim3oydlle  fvi sf rtr(mpot0alenmietlt aDemn p t4texnir3oa1la  lueo;t0 2uoxrpou4al emfctltfsrrrx p;o1tet moetas a eaump;t)aetnmf iotfm r nvs;s tetmir3ou4om e ncsl(faDrmum ;t4apeo oetys m2ean o;t0trxrio3todlpt ai o (  2um(o iudalen nvsl(  2ta( pnu4ale iiciydfs rmnmonu)texoif oa1fmt luvs t  2xrxmpnydll   ieslt  2tmumoou0oexo fcilsfsDrmuvp;u0arenio3iadomDrlnvi;()t2xr(m3iu1ameelfcslt)artmxmpoo1tee  icild sDelnmon() ltnxfcoo1laD  ieol( s2tmxo no4lpenmivtas)s2rr(mo;o0apxnifctlt s2umu s;t) ltomfcta1faDe ieils) rur(o ou1op   nvilt a2rr(roou1alx if3tydls2ran p;t4tltnxfctatfm  aivil()s2to(opnydam n nvta(fa2tr(rp;o1oltniieiyd mDrln pnu) ltomf3iodomDranvsl(0t2urxo oy1olenmivi s  rrm(  ot1tltn oeiat m ranvpnt0 eeoxf3tadfaDrluei t)s2tmir oy4ll elnvs t s2ur(m ;u1tetn octaslm elums (4alxrmr3iy1fp e i s () rtrim3oy1amt livi (  2ta(r ;u1aex  o3ilt m2uanvp u)arxnif iytoaDelnvil()tetm(r iy1ol  mfci (faDur(  ou0aeeomi3iyslm2ua(mo u0 etrxf3oo1omDeanes () etr(m oy1lm nmiei t aDtmum nu4tleo feiysls2ul(vont) leoio oy1oa rlueo;t0t2xrxm oy1olt mnes () Duaxr oo1openmictlslaDuanvs;u) rxnxfcootlp  aueo;()s2xoim iu1ame livt (  rtrxmpnu1tle  i3ils aDemn sn() rxrxf3iadom r u s;s tetm(r3oo1ole mivtl()sDtaum no0teeoifctatlaDea( p (0tltrio ty1lat lieo;s) 2xr(mpiudolt  fvi t) 2trx p;o1aleoifciys sDea(ms u4teeoif tydlp e neo;s setoxo3iu1lltnmfcil( a2uaump;t0oleo octytlaDelumo;()texrmfcto1oa elnvo;() etoir3oudaltelnetls sDta(m ;o0olx mo3iltfa2ra(mo u4 rxnif todoaDr n o;s s2xo(r3nu4al  mneilt a2umxmo;t1aeenifeiad a rm( o t4aleoxociadom elnvslt  etrio3nodll e ies tfa2ta(rpnt1aee moeiysfm uau pn(4trtrxr oydfaDraieilt0 2ur(r iodam e ncia()srrmuro;t4tlen ietls sDua(mp t)aetrirciatlmD  n ol(0 2toxm3nudapen ics tfaDumx onu1tetnio3tat sDranvsn(4texnxfctytoate ueo;t0tetrio ou4aptelfci t) 2umu o;o1tex mf3tydlsDuau on()aeerif oadlp  aueo;t)trxrxopiy1olenlfeslt)s2raxrpnu1oetnmfciysfs rl(vo;t) lxomr3oatfmt  ueolt0t2xoxrpnudal elivsa(fsrrr(ro;t0opx  i3tls aDran s (4 leomrcoodfa eaneo;t setoimpoy1ap nlicsa( a2umx  ou4optn oeiys sDrmnvp;(4trtoxfcootomDelieol()t2ur(o3io4opeelncsl()s2taur ot0olxoii3tlsfs2eaumo;t) ltnmoctydfm rauvi s  euoir3iy4optn fvtl() rtm(  nu1tpxomo3iatfmDua(vs t4trermr totomD aneols)t2to(r ny1omtnmicta( arrmumpot1aleomieild m rauvsnu0alxrmr oydlateauvsl(0trur(r oo4ll n ivia(  Dtau ono0olt ifeilsls rl(vo;t)altoifciadfaD lneols t2xmir3iudlmt  ict s s2tm(mont1aeeomf3tys a2elnms;()trxoirctodlptrlu i;t0trxmio3iodop   ictat) Dta(rpoo0oeeomi3ias s eauvpn()artrio3io1oaD lnvs (  rxoio3io1op nlneiatf rta(m no4tptn iciaslm2rauvo (0trxrmf3iy1faD lueo (  rto(m3oy4alt  fctas arrr(  ou4aet mi3tltfmDra(mont) leoxr3oy1fp rlivil( trtoxopny4lp   ncsl(farrmxm ;u4oeto feiysls2rlu o u)aetnmr oatomt aneol(0truo(mpiudap nlfcs s sDraxm ;o0ale ifeild mDeln ont4 lxoxf3to1fa   nei;t)srtmxr3ny1lp e ivtls)aruaur no4oee mieiad s ea( o u4trenxocoa1oaDeai o;()trumir ou1ome mneias s2raumpnt4opxniiciasfs2emnmsnt0trtrxr3iadomDeauvo;s)s2xoim iydap nlfviatfsDra(r nu0aleoii3iadfsDua( ont0texrxo3iatfpt aneslt t2xmir3no1ape livs tfa2taumpno0opx mieiatfa umn o (0alerio iadlpte i s;t0 exo(o nydlptn ieiat)aDra( pnu0optnmfeias a2rmnvs;() reoiocoo1fpD li i t  euoim3nydopeemnvi ( srur( oou4apeoio3ild mDuan snt4aeermrcoydla r u o t) 2umiopnu1op  mivtatfaDuax  nt1ale mfeiydla2ulumon()trxrmr3tytlaDe u i ()truo(r3nodap e fcsat)artaxmpnt4altnioetatlm eln p t4arxrir3tytom rli i t s2xr(o3iodamtnlnvi (fsrrrurp;t0alx io3tat m2rmu p;(4 rtnir oo1lateli o;s) 2uo(m nydaleemfcil() 2rax onu1apt  ietltfm uauvo;t0trxrmrctotopDrauvs t) exoirpiodape liet ( sDtrxmo;u4teeo f3iad a ranvs;t4aetomfcta1fmDr uvil( srumirpnudomtn fvsasf Dtr( pno0tlx mfctlsfaDemumo;t0aexoxo3todoa   i olt0truoir3oodaptelict ()arua(mono0apt miciltfa2ulnmp () etrmo3iatla   nvols) rumimpiu1ole lfcia()srrmu  ;u0tlxomoetldlaDrm(mo u4arerxf iotlpt lueils0 etm(r3oy1olt mfetltfsrum(mpot1tpeomoetyd s2elnvp;u4aexomf tytlp eli o;() 2xmxo ny1optelnvs t s2tm(moou1ape mietytlm umuvo;(0 leoir oo1lmD aies;t  rxm(opoydal  lfvi sf rum(mpot0texo ictldfaDemuvpn()treomf iodlm e nvo (  2tm(r3no4ap e ncta( artaumpot1tpxoii3ilslmDra( onu4 etnmfcoy1opDr neilt)sruoxm3ny1omtelncs t)srum(mp;t1tlt mfciasfmDua( o;u0tlxrxr ootomtelueo t)tetrir oodol emnet s)aruaxrpou1tpxniieias m2ran p;(4 etomo3ta1opDran i s tetr(m3iy1ome mnciltfs2rax pno0aptomietaslsDum( s t0trxoxfctytla r ivi;t)s2xmxrpou1lmtemnvt s  2rax pnu4apxn i3iyslm um(vo t4tlxoir iatlpt auesls setrio3oo1ap elncsls  rrru poo1apt mf3ilt mDran p;()tltrmf3iotfm rauesl(0 2toiopiu4apee iesa( s2trumpnt4opeo octldfa rl(mo t0aeerir io1omDrlnvsls) rtoxr io4apt micil()aDumum ou0apxn o3tatfaDeau snt)alenmo3oo1lpD  nvs ()s2tm(o io1lle  iei ( artmxrpou1aexoif3iydlmDumu s;u)treoxocty1latraiesl(0srur(opoydlm n ivil( sDrr( ont4tltnif3tyd mDuaums u0tetrio ta1om rau il()t2tr(opoudalt lfvslt)sDraxmono1aeeoiocilslmDulnvo t)aeenmrcoa1fm rlivi s t2xrio3no4lptelnciat) rrmurpnu1tle  feiydlsDemums;t)alxniociadlpDeauei;t0 etrxm3oydll  lfvtat)aDraxrpnu4oeto ieiyslsDua(mont) rtoxo tytoa raneslt srxoxm3iy4omtemncslsf 2rrx ono4tlenmfetltfmDumuvp;u0alenir iydfat  nvs t)trumxo3nodoptelictasf 2ta(  oo4aetnmoeildfm2eluvs;u4aexnxf tydlm   u ilt)s2tr(o3nodlmtnmnci s)aDurx  ;u1tlt mieiadlaDumu o;u4trtomr3iydopDelu ols)t2xmxopio4ape mfeslsfarua(  no4oee  fciasla2rluvs;t4 lerio io1fpteanesls0 rtoir3nu4om  liciat  2tm(  ou4tet iiciytlm2rlnmo;(4aeeomo3io1lmD ai s s0t2xrxr3iudllt mivs sfsrtauroou0aetniictat m raums u4trtrmo3to1lpDr ivsl()t2urir3oo1ll elnctls) 2rmxronu1opx  feild s rmnvo;(4trtnxf totopt lnvolt)srtm(r3oodal elivilt)a2umxr ;o4tetniieiyt m2el( p t0 lxoio ty1fatr ues;s) eum(opiu4omte fvs t srrruro;u0texn fetls m2eaums;(4tltrxf ta1faD luvsls  rtoiopnu1ol   fesl(  Dua( ono1oex mi3ildfmDea( o (4 exoio3oodlp  an o;s sexoxr iy4ole  ivi sfsDrmx ont0tpto i3iadlmDra(vo t4aexnif iodfm rauvo;t)trto(m3io1lle mfcias s2rr(mo;t1oet  oeiyt s2ul( p;t0 rtrif3tadfpt  u ilt s2tr(rpnudlpte nvi s)sDrrx oot4opto iciydlm umn pn() ltnmo ta1laDr neslt  2urxr3iy4ap n net ( aDumx oot4olx miciadfs2rmuvo (0aexnmr tadoatrlivo;(  rxrio3iu4om elfes tfs2rm( oot0oexnio3iadla2el( o;t)trermrciytop elnvsls  2xr(r iodam nlivi ()s2rruro;t0texnmictysfs2uanmsn(4 rxrioctatfat  n ilt) 2xoiopnu4lp  lnei t  Duaxmp;t1apxnmf3ias m2eanvo;(0 etnxf3totfmD an s ()t2uo(mpiu1lm   ivslt  2um( o;t1tpt mociyt aDul(vo;(4teeoifctatfpDeaivs (  rtriopiy1aptnlnetlt srtrxr nt4tetomiciad a umn p t0teenmfcoytom eauesl()t2xrirpiudll n nvt ( s2ur(m no1ale ioetltlaDrm(vsnu)aeeomf3tadfm  aues;t) 2tm(r3iu4op e nei s)a2ururo;u4oltoifciyt aDua( s t)artomr3iydlmD  u o t  rtoxm nodomeelietlt) rraurpnt4apxnmo3iatlsDrmuvs t) etrmr iotfpt  i o;s0 euoio ny1lmenlfcia()aDurumo;u1aet io3tasfsDrm(mo;t0altrmocoodfa rlivols0 euoxm iydllt lict ( s2rrumo;u0oeeoiicildfaDum(vo u0tetnir3iotopD an slt0 rtmxr3nu4lp   fesas)a2um(r nt0opxnmi3tadlaDemumpnu)alxnmfcoodlp  lueo t0texoio3oydapte nesasfsDtaxm oo1tlenmicils a ra(vsn()altoxoctadoptr n i s) 2trim3oy1op nmfes ()srurxr nt4teen ieilslm2el( snu0alxnxo3oo1oateaues;t texo(r ou4omt mivt s arrrurp;o0ape iiciysla2ulums;t)altnio oo1lat  uei t s2toim nu1lle mnesa( srur(roou0tpt  fctasfmDra( o;t0aetnirctytfaDrlu s s sexmio ny4lp nmieil()aDur(m ;u1oetnio3iatfmDem(vo;t0aleoio ia1oa rlu i t) 2toirpnodolee ivtas arur(r ot0aetomo3tytfsDrluvsnt0tetoxr3totoatr u ol(0texo(o3oy1omtelfeias) 2trx  ou1ale  fcils sDel(vp;(4 exomoctytfpDr neo s sruoxopnodll nlnct t srra( ooo4olxoiieiysfaDem(ms;u) exnmrcoadopDrau o s)srxrio oodalenlietas) 2rmxmpou1olx mf3tldlaDuanmpnu4tleriocta1lptean ils  2umimpiudale mnes s s2taurp;u0oetnii3ils m2rm(vs t4altnmf3tatomteaieil( t2tr(r3nu1al   ieslt)srta( poo1aex if3tat m rauvsnt4 ltoxo tytlptrlu il( sexo(r oy4opeemnct (faDrr(r ;o4olen ictysfsDemuvp t4 eeomoctotlm  aieils)tetmir iu1ope  fvilt) Drmu p;o4oet  oeiasls um( s;u0tetnmf3iadlaDranvs;t0 eumimpoo4alenmnciat sDurxmono4oleoiociydlsDumnmp u0 lenxf3oytfmtelieol() rto(m3iu4lleelfeta() 2umxmo;o1openmictatfa2rm( o t0trxoir ootfptelu sl( t2tr(o3iy4oleemivt s  rumurpno4apeo iciysla rm( o t0tetoif3iy1fpteaivils)t2xoio iu1lpt lieiasf rrm(ront0tex ifeilsfm rmn pnu4trerxf oytfmDranei t0 ruo(r3ny1am nmnes sfa2raxmpnu1tee mieiytlmDrmuvsnu0alxnxf oadlmt  nvi;t t2ur(rpnydal  mfes (f Drrx o;t4opeomieiltfa2ulu p (0tlenmrcoa1oatelneils)seumxr3no1al n nes s  rrr(  nt1olen o3iydlsDelu on() rxnxo3iodfm ean i;(  2xrio iodlpe lnctlt) rtauroot4tpxo fctldla eanvp t) eermo3oytom e ueilt0 2tm(opnodalt  ncilt)aDrax  oo4tpx ifciaslsDrm(ms;t)trxrio3tadfmDelnvsl() exr(r ny4lltnlivtasf Drmurpou1oetnif3tlt m ulnvo;(0alxrxrctodlpD  nvo t0trxmirpny4omtnmivsas s2rrur ;t1altomo3tydfmDuanvo t)texnirciotop  luei (0teuo(opiu4ol   fvt s srurxrpnu4olt ifetyd s2el(mpnt4 rtoxfcio1om r n s s0t2xm(m3io1omt mncs s) Dumxm oo0olen f3iat aDuan p;t0 etrirciydoat luei t seumiopnudop e ietl(  rrrurp;o4alx mfctadfm2eau o u0 etrifctydfmDraiei;s seuo(r nodope lfet sf 2tm( onu1ope mfetys sDuau sn()arxomrctydom rluvslt s2urio3no4opte ici tfsDum( oou1apxo oeiad aDem(vo (4treoxr3tytla rai s;t0trtrxopiu4ll nmnciatfaDrrur no0apt moeilsfs rlnvs;t4 lerxf to1fatr u ilt setrim3iydale  netlt) Dtr(moou0oleoii3iydfsDulnmont4alxrxrctydfm   uvi t) etmim ny4optn neiltfaDum(ro;t4aleoiieiadlm ran pn() eeoxr oytfat anes ( t2uoir oy1ame mnvilsfa2rr(mpou1oeen ictysfa raumsnu0 reomrciadfa raivilt)s2tr(opiy1ope mneiltf rtax o;u0tlt iieils s2ul(ms;t0artnmfcootfat anesls)t2xoir3iodam emfcsa() rraxroou1olt if3ilsla uau o t0 lxrmfciadfmtrli slt  etrxo3oodopt micta(f rrmxrpoo1tex if3iatla2rauvpnt0alxnxr3tatoa eanvo t texm(o3no1al e fcia(fa2ta(mpou0oetnmfetat mDulnvp u0aeeomo3iydfpDe nvs;() 2um(o3iudamen ieslt) 2ur( ooo1tee  i3iatlm um( sn(4tlxnifctytlpDran slt0trxmio ou1openmivslt  2rm(ro;o0apeo feiytlm2emuvpnt)altoifciadfmDelivsl()s2xoxr3io4opee nvias s2rr(ronu1olt  fctldlsDea( p (4aexomf oytopDe uvo;t0trumxo iydoltnlfcsas a2uaur ;u4ope ifetlslm rlu s;t)trtrxocia1lmt  u o;t srtmirpno1lpeemncia(  Drm(m nt4teenioeildfm rl(vo;(0 etomfcoydomD lu s;t) 2to(o3nodope micta()sDtaxmoou0tlto oeils aDea( sn(0tetrxrcoy1fp e uvsls)s2uo(m ny1amte fcsl( s2rax poo0apx mi3tld aDeanmp;()tltoxf tytoaDeluvsl() rtrxr ny1lpen nctas) rumxrpnu4texn i3tad mDelu p;(0 leomo io1omtelivo t0sruoxm nodaltemnesasfa2rmx pnt0aetoiieiad sDrmn onu0artrmocoadlp r u o t0 eum(o oy1aptnmnct s)aDum(mpno0oexo ieiltlaDranvp t0 rxrif3oodlpt livo;t0t2trxr iudol elfcsat) Dtm(ront1aleo oeiatlm umnvs;() eeoio ootfm rln o t) etm(o3ou4omen ivils)a2tm( o;t4oeto f3ilt m elumo u4teenircoatfmDrlivo;()srxoir no1lm   fvsl(f rrmxmp;t0olx mo3tls sDrmn on(4arenxrctydfmD  neilt)srumxmpoy4lmt lies ()s2urumpnu0tltn ociatla2emn on(4tlerxr3iytoa r nvils0 rxmim no1lm   nvslt  rraurp;u4optoiociatfm2um( o;()trtoif3ootom eanvolt t2uoxo3oo1op emivt (fartmx p;t4oexn ietys m eaumonu4texnmf iotlateai i;s) 2uoxrpoydal nlfci s  2tmxront0tlx iocils m2uanmp;u)trtrxo iadfm eaueils) 2to(o oydlmt  ncilt  rrm(r no1alxoifcils s2rlnvs;u)texoifcty1lpte i i t t2trxrpiu1amtnmfvi tf Dumxrp;o4oeeo ictas m eau pnt4texnircoodlpt aieilt0 2xoxm3oodlmtnmfcta() rurxro;u0tltnmf3tadlaDuau snt0aetrmo oadfm ranvil( trtm(m3iu1ap elfcs t a2rax  nt0aeto f3iysfa2emums t0aetrxr3tatfm rlueils  2uo(m3iydlm elfctl(  ruaum ou4teen oetyd mDuluvo;u4aetrxocta1fatr ivols0t2xoirpoo1ap nlneiatfsDrauront4texnmoctyt sDea(mp;() rerir3ta1la rlnei;s  2to(o3iudlpt mici tfaDrmu  ;t0opxnioctlt sDrmnmp u)texnircoydlmDrlueslt0 exoxo ny1opte fvtl( s2uaxroot0ope ioeiltfa eanvp;(0 lxoif3ootlmt ai o t0s2urir3iudll nmnvil(f 2uax pou0tpe  i3iadfm2emnvo u) etomo iydlpD livo ()trurxm3io4om  lncsl( srtaumont0openii3iltlsDeln pnt4artoxr tytopDe neo;s)t2trxo iodapt lnes (f rrmx pou0oet mfeiysfs2ua(mp;u4tetnir3tytop  au i s tetoxm3oodalee nvta(f Dtr(mo;t0oltnifciyd a el( s u)arerio iodomteai i (  rxm(mpny1al elicslt aruaurono4opt ifeildlm eanms;t4teeoxo3iytfpDr n i;()sexrxrpnodlme livta(faDtrxm ot1texoifeiatfaDeanvp;t0 lermoctytoptr uvs s)t2toxopnydalee nesl( s2rmxm ;u1oee io3ild a2ulu pnt4 etnir ia1laDeauvslt0s2xo(opnodam  lneil(faDta(  nu1olxoii3iyslm emn o;t0 leoxr tadop elnvi t) 2urio oydapt lnvil( sDrmurp;u0tpx io3iytla ul(vo u) exomocoatomDr ivs;s)sexmxr nudaptelivia(farur(r ;o1optomoeiyd aDraump;u0 reoirciy1omD auvs (0 rurim oudlpenlfci (f 2rr(ro;t4aexomieiltlaDeau snt4teenmo3oo1oa  li i t0t2to(m3ny4alt  feta()s2tm(m ot4openmfeilt m2rln s t0tltomr3tydlpD lnei s trxoio3oydal n nci sf Drm( poo1apt  icildfa2emnmsn(4alxrir3iotfm e ueo t0sexoir3iu1aptnmivsls) rtr(mono1olxoifctys a2ranmp u)aetrmocoydoatranvils0t2xmxo3nydlme  nes t  2ua( oot4aptnif3iydls ra(vp t0aetnmr3oatlp raivilt)srtm(m oy4altelneil( srtrurpno0aptn fciyd a2ranvs u0 exomf iadfmtrliesl(  rtoiopno4aleelivia( sDurx  ;t1oee moetyt aDrl(ms t0 exomocty1op e ivi;s0sexrxo oo1am nlivtat s2trump;u0alxo i3tyd a2el(vp;u4 eenxf3ootfmtelueils  exo(r3nodaleemietl( aDtrxm ot0alxoii3iltla2umn on(4alerir3iy1fmDr nvols s2urxm3iy1ol nlies ( aDur(rpoo4aexoioeiydlmDrm(vp;u4trerxf iadopt aivslt)srxmim ou4amte neil(fsrtaxro;o4ale iociadls uanmp (0 rtriociadfaDraueo s t2xrxo3iy4opt livsa( srrm(  ;t0ape ifeiytlm2ulnvs (0tltrxf oydomteaieo;s) rxr(m nu1lptnmieta( arrruront0altnmiciyd mDul( p;()tlxoxf oatlmtrluvi;s)srxoxrpiu4ll n fci ( sDrm( o;t4olxoiociatfsDul(mpnu0tetoxrcto1fpDraneo t0 rtm(mpiy4am   nct sf Dua(  ou1tee ioeiasla2em( p;t4 reoifcoytfm   uei s0 etoxrpoy4aleemfvi ()srurxmpot0oeen iciltlaDemnvo t)teenxrcta1oaDr nvil(0truo(mpiy4lme  fvil(fsDum(mp;t0oee  f3iysls elu o;t0arxrxf3iy1lpDrln o;(0trxrirpoudomt mnvsa(fsDur( ooo4tlx ifeiasfsDem(mp u)tetnif3iytlp elues s) 2uoxm3iodamte nvias) rrm(  ;o4alxo o3iad a2rlu p;t0aeeoxociydla rlieolt seto(rpny4llt mfviat) rrax pou0tlxnio3iat a2em(vo;(4 etomfcio1op eanes s) exm(m3oydal n ivi t)sDtmx  nu4alxn feild aDrluvon()teermo ootomteli i () exmim3iudlltn fvsas sDtr(mono1texo fciadlm umnvpn(4 lermo3iotom  lnes t) rtrxmpiydap e fct () Dum( o;t0ale  oeiytla2eln pnt0tltrir iy1fmteaivo;( texmxr3iu1om nlfvtl( a2raump;t0apxniociyt mDulnvo;t4tlxrio3totoaDeanvs;s)seumimpoudlmee feiasfsrta(rp;o1apxomfciysls2rlumo;t0 exoir io1lmtean ilt0 exmxm oo1olt  fvils)arrmxmo;t4opx ioetltla2emuvp u0tlerxr tytfp raneo s0sruo(rpiy1opte fvilt  rumxr ;u4openioeilsla2ranmpnu)aexnir3tytopD an o t  2xrimpoydomtelnct (  rrm( p;u1openioeiytlm rlnms;t4 etnmo iadlatr ivo;t) etmxm3oudamt mnctl(  Dumumpnt1oeto f3tasla2eln snt0treoxo3ia1la elu o;t0sexo(m3no1apenmicsl()srurxr ;t0tleniocilsfmDrl( o (0alenmo3io1lptrluvo;t) 2uoir iydlme  icslt) 2rau oot4apen f3iysla em(ms;t)aeermo3ootoaD ai ils0t2xoim3oodome mnctls) 2uaxm nt0apx ifcilsfaDumumo t0altnxr3iydfpDrlivil( trtr(r iy1lmt mncs tfsrumumo;t1oeto feildls rln s u4 etrxfcta1fp eluvol(0trxoirpnudameemivtat)arta(rpnt4opx ifciad sDraums u0arxrmfcta1lptelu i ( tetrxr oydlp   fvsas sDurump;o0opx mociatfa2ra( p;u0tlxoxo3tadla eanei s0 2uo(rpoudapen net tfs2rm(rp;u1apx ifeiadfm2uau onu)tlxnmfcto1omDrliei;s) eumirpoo1llte nvta( sDrmxmo;o0apxnmo3tytfs2em( p u)aeenmo iy1oaD auvo;t s2tr(r oudlm  lnvsa()a2ra( o;o4olx mociyd s2rau sn(4trenmfctatlpDrlivs;(0truo(opiu1amt lici tfarraxro;t1texnmoeiadfsDrln s;(0arxnif3iytlatrau i t)srumxo3io4ap nmnesa(fsruau  nu0aleo feildlm em(vp t4 rxnio3iy1om r ivo s srumxopoo1ll elneslt)srum(  nt4oetn i3ilt sDemu snt) rerxf ta1fpDe nvilt0s2urxo oodam  mfesltf Drrxrono0aetoif3tas mDel(vont0teenxr3iadfpDelu ils  exo(rpny4lle  icslsfsrtm( o;o1opt ioeiadfm ulu onu4 leomf3ia1lmtrlneolt0t2xoio iy4ome mies s s2ua(ro;u4tex moctasfs emump (0tetrir3iodlptrluesl(0 exrxopoydom n fviat arurxm ou1oet iociad a rmumsnt0tetrmr3oydom  luvs;() rxoimpio1lp emivs ()a2rm(m nu1apxn f3tytla2uaumon(0trxnxr3oytlm  luesls0t2xr(mpno4alen nvi tf Drmu oou0tpe  oeias m uan o;(4 eeoxfcoa1lmDr u s;t)tetmir3io4ll e nei tfaDra(rp;t4openiietas sDulums (0alxomr tytlatean sls0s2xrirpou4ol  mfci s)sDrruro;t0apenmo3ias m2emnmo;u4tltomociy1lpt au ilt0truoiopiy4lpe  ictat)aDtruro;t1alxnioeiys s2eanmpn()texrircia1fpD luvols tetoxo3oudol n fvi t)aDtr(m nu1aet io3tyt m ul(ms t) ltnmr3todom r ieo;()trtoxm3nydomtelnct s)artrurooo0tleomieiad aDumnvp u4texoif3oo1lm e nvo t0t2tmxopio1lptn ivs t) rurx ooo4alxn i3iys sDrmuvsn(4treoif3oo1fm eaneils)t2toim nudomt mivilt  Dumu  no1aetn o3tasla2rmn sn()trtoxf iotfmDeauvols0seumir3io1lm e iesa(fsrrrx  ;u1tpenmi3tadfm2emnvo t0alxnmrciatfm   nei t0seumxo ny1om  mneia( sDuaum oo0tpe if3iltfm2el( snu0tlerir3tydfm rln ils0trxoiopnu4olen nvils s2ta( p;o4alx iieilt a rmu o t4 eeomo iydom   u i;(0sexr(mpiy4alt mfes t)artr(mo;u1oexn ieiadfsDrlnmont0tetoio iotlm  auvs;t srxr(o nudlle  fcils s2urumo;u1olx mociytfm uanms;t0altnmr3tadopt lu i;t) rxmio3iy4altn nvil()s2rm(mp;u1aee  iciatlsDemn p;()trxnxf ia1omt ln s;(0teto(r oo1am nmivil(  2tmumpot1oex ifciltfsDumnmp t)arerxfctodlp r ueilt s2to(o iu1ap eliei s)a2tmxmoou0texnmfciytfaDulu s;u0 exnmf ootlptr u o;s  rto(o oodamt  fet (  2ta( poo4tet if3iltls rl(vo t0 eeoir3iy1fpDeai ol(0 rtrio3nodllenmfct t)arum(m ou1olx  iciysfa2elu snt) ltrmf3iadfmDelies;( texo(m3oo1lm nmnesas)srumu ono0tpeomf3iltlmDrlu o;t4alermr3ia1lmD ln s;s sruoxo3nu1olte nciatf 2tmur ;u0oleo i3iydlm rlu o (4trxoxoctadfpD  ueo;(0s2xr(m nydole mncsa( a2umurpoo4oleo oeiyt m rlump;()aexoif oy1fmtelu i t0srxoiopoydll e nvs ( srum( p;u0tlx iiciydlsDua(vo;t0 eerio3tatlmteanvsl( sexmxm nydalenmncil() rraumo;o0tlx ioeiydfmDra(mp;(0altrxrctotopDe ueolt0trumxmpoudom nmfct t  rrmu  nu1aeen o3iltfmDumn o;u)tlxnio to1la  ln il( tetr(r oo1ap nmfcsl(  rtru  nu1tlxomo3tatfs rmn p;(4 eeomrcto1lmDrln slt0 rtoxopoydoltnlncslsf Dtaxmont4tee iiciydla2um(mo (0 rtrxr3oatlmD aivo;t0 rxrio nudam emiet (faDtmur ot4aet mfciysla ranvp t0 ltoif3iadlp  ai o t setoxo ny1lltelfvt s  Durx onu4opt  icias mDua( sn(4tetrxfcto1laDe neol()seurxmpnodomeemiei tf 2rmuroot0oeto f3iad m2eauvo t4arermf iodop  livs ()texrim3oo1amee nvi sfsrrm(r ot0teeo i3tyslmDrmu s u0tetnircty1lmt livol(0srxmxmpnu1oltelivtlt) Duau pnt0tetomoctld a2emump;()arxrif3totlatelnvils trxrir3no4op nmicias)aDrrx  ;o4altnif3tls a elnmo u) eeoxo3oydfp   i ils tetmim io1opte fci s a2rrxmpou4alxnmictasfs rm(ms;(4 rerxrctotoaDranvols  eurimpoy4lpt  icsls) 2um(mono1teen f3tlsla2uaumont0 ltnxr ootfm r i o;s0 rtoxr3nudopen netasfsrraxrpoo1alxo o3iasfm eauvo t) ltrxocio1oa r ieo ()tetrxmpiu4apen fvsa(fartm(mont0olxoioctltfaDuauvs;(0tltomo tydfatran ols srtmim3iydope lneias srraur oo1aee mociydlm2ua(mo;t)trtrif3tadoaDeaivs;s) 2trxm oo4altn neta( artrxroou4tlto o3iltfa ean pnu)altomo iatoa eanvi;s0 2tm(m nu4ale lies t)srrr( o;o0apenii3tad m2ulu p (0trxrxocia1lp r u i t)trurio iu4ap elnetasfs2rrxm oo0tex  ieilsfmDelums u4altrmf3iotopte uei;s0trxmxo ou4om elfcils) 2rrxr ot1apxn ociltlm2rmnmpnt0arermr oy1latelieo;( srxm(m oo4lpe  netl(  Dtrxr nu4ole mi3iysla2rln ont)areriocia1omte uvils trxm(r3nu1lp emfcta( s2rmxm ot4altomociydls eau p u)aeermo3iydopDean o (0seurio3oy1am nlnvi tfarrrump;o4tlxomfeiltfs2uln s (4tetnxf iatla elu s;s0srtrir3iodam e ivias)artru oou0aexniociyt s ea( onu0trenifcoadfaDraies;() rumxo oydoltemiesatf 2uaump;o1aeeo oetltfs2rmu s (0aleoxo oa1lpDrlneo t0t2xo(opiu4om nlieils) 2rmxm ot1oeen fctatlmDumumont)trtomo iydfa e neolt setm(o oy4lltnmivs ( s2raxm ;o0tetnmoeildlmDuaump (4artomrcoa1omte i o ()trto(r3iy4op  lici t  Drmu  nu0oetnifcils m2umuvp (0 etoxo ootlp elu s;( t2trimpny1ap   ics ()s2trxrpno0altoii3tldlmDulnvs;(0 rxnxf3iatlp  lieo;t  ruoxo io4omen ivtlsf 2tr(r ou1tlxoiieildfmDuan s () etrif3oatomtrlneols) eumiopoodlptemictltfsDumurpou4opto octldlmDra(vp;(0texoxo iadlpte ivo t s2xrxr3nydom  livslt)arua(mpnt1oexoif3ilt a rm(mpnt0 lxnif3oatopDr nvolt) rxm(m iydlltnmfvi t srrax oot1opxnif3iydlmDrluvo;u0 eermf iotlp eauei t)teuoimpoy1ll n fvtat)s2rm(mpot4tltoio3ilt sDumu p;(0 rtomo oadfa   nvo t  rtmxm3iy4ame  fciltfsrumxm oo4olt moeiltlsDeanvo;()alenmrcoodlaD livo;( sruoxrpoy1lpt livtasfs2tm(ro;u4aexomo3iyd aDrlnmsnu0teenif3oodomDrlneslt setr(m3no4ap elfvtls)aDurumont4oltomo3tlslaDemn snu0 eeoxo3totlm elnvi (0 rum(r no1op nmnvi () rurumpoo4ole if3iasla emu s (0teermr3oodfaD  n o s0seur(opoo1llenmicslt) Drmxm ;u1alx ifetldfm2el( s u0aexrio3oadoat  u ilt seumxr iu4opee neias a2trur oo4aex mf3tytfs uan on()trtnmr tadfpDeau olt srto(mpnu4apen fviasf rtau poo0tltomocilsfa2rm( snu4tlxrmo3iadoa rlivi t  rtoio3ou1aptnlfci s srrrxrp;o0ape ioctyd m ulnmp;u)tetnmocoy1laDe ieo (0 2tmxr3nodlltemfvs () rum(mpnu0apt ioctat aDulnvp;u4tltnircia1fmDeln ols t2xoim3ny1ole lfvtlt)arrm(roou4ale iicilsfaDrm(mo u)alenxf oy1oaDeai o;()teum(opnudaltemfvt ( a2rru poo0oex  oetyd a2uaump u0 eeomo3iatfm raiei;s) eur(o3nudalte iciasfaDurxmo;u1alx mo3iyd a ul(mp ()tltoxfciadoa  auvol(0 2um(r io4ap nlnct s artr(rpnu0alxnmicilslm2uau ont0texoxr tydfmD auvi;(0sexmxrpno1omt mfetlt  Dra(ronu1opto feiytfsDemnmsnu0tleoxf3totom  anei;() rxo(o oy4am nmictlsfaDur(r no0aexoifeiad a ra(mo () rxrif ia1lmDe i i;t  euoim3iydomenlncta(farrm(m ou4olxoiietysls2elnmsnt)trtoiociy1optelivo s)sexmxr iudamee ivsasf 2rmuroou4apeo o3ilslsDulumo ()aexrxf iatfate ivsl()teuo(o3nodlmtnlnct t  Drr(m ;t0aetn f3tad mDumnvs ()artnxoctytopD  neo;()trtrxm3oydope mictasfs2tmxrp;t4altnioctld s rl( sn()aeermocootoa elies;t0sexm(o3nu1al nmfetl()a2ta(mooo1texo oeilt sDelnms (0aeeoxrcto1optr i i t)t2xoxm oydopte fcsa( s2ta(  ot0tltoifeiysla ua(monu0alxomr3iodfmtraivo;s0 2umxo3oo1lmenmicsa()aDrax p;u0tpx  fciytfmDum( s u4aleoxo3oodfm rau ils t2um(r oy1amte fci ( sDrm(mpnu4oex  feiltfm rl( s;()tlxnxr3tatoate nes;(0s2urirpiy4lm   iviatfaruax pot0open fciaslm rluvp;u4artoif3oa1oa elivi;(0truoiopio4ope mivtat aDuauroou4oetnmfetlsls2ulnvon(4areoif ta1opt ln i (0 rxrimpnu1omeemfvs ()s2uaxr ot1teenmiciyd a ra( o;t0tetrxf3iy1op r n il(0texoxm iy1ape  nvia()aDtau  ot1oltnii3tat aDeluvont0alxrmf totfatr iesls) rxmim3oudom elfcslt)srrau pnu0ole mfctltls ulnvo;u)artomo3iatfatr nvi;t) rurio3nydol  mfciltfaDrr( onu1alxniieiltla rl( pnt)artnmr iydlmD  uei t trtr(r nu1lpeelivslsf Drau  ;t1tetoioeiytlmDemn p;t0trxnmf3iytlp eau i;()setrio3oo1opt mfeta()artrxroou0oleoii3tlsls2ran s (0trtnxf ta1faDe uvo (  2um(o ny1lm e iesat  Dumxm oo4opeomoeiasfa umnvo (0trxrir3totfaD lnei () exo(o oy4ap  mnvi s)arrr(  no0tptoiiciadlm rlnmp () renxo oydfate ueil(  2tr(r oo1amt mncsas)aDtm(mpot1opeoiiciadls2rm(ms t)areoiocoy1om elnvi s t2trim oo4om nmneta(  2raxrp;o1tpeoifcildlm2ranvon(4 rxoir3ootlp   iei;(0texo(m3ny4lpenlicil( arra(rpnt4opxnmoeiadlm ea(vs u0 etoxrciatlmD luvs;t)s2urxr3nodope  fciasfs2tr(ront4tle mfciydlmDul(mp;()tetoxo oodla raneo t0srtoxm oy4lm  lfvt s)aruaumoou4aptoif3iltlsDemnmsn()aeeomfcoy1lpDrli il(0 2umiopio4amtemieiatfsrtr(  ;o1oeeo feils m emu o;(4arenio tytomDeluvsl(0t2xoxr iydom nmnvi t  2ur(mo;t1aexnif3iydla uln o;t4 ltrio oatoa eli i;s0srurxm3iudllenmfcsls) Dtmuront0oexoif3tydla el(ms t)tlermocoatfm eluvs t tetmio nu1lpenmict (  2rmx pnt0oeenmfciatls2eaums;t0 exomo3tytom  ln o;s)s2xoxo3iu4ol nlnesa()s2um(m ot0ole  fetydlaDulnmp;(0 etoxr oa1faDe ieslt0s2umio3oy4altemfvilt) 2rmu poo4ope  fcilsfsDumump;t4 lerxf3iatlmtrlnei;s) rtoxr3oydom  mici sf 2rr(r ot0tle  i3tas mDuaumo;t0 lxoir3todlm rauvsls0t2xrim ou1apeelfesl( sDtaxm ou1olenmoeiatfs el(mp;(0 leomo3ty1lateaieil()s2ur(o3ou4lptn ivils aDur(  no1oeto feildla2umu ont4 eenmr3ta1lmtr neo s t2tmxopio1ap  mnet tfaDumx pot4aex  f3iytfmDraumo;(4arxrxf iatfmD an s;()sexrio3iu1alenlnctasf rtaxmonu4ole mfciaslmDel(mpnt) etrio3oadlmD lnesls  2xoxr ou1amt mncs t)srraxm ;o0opxnmi3tytlaDrm(ms;t0artniocia1fpD ln o;t trxoio3nu1om  lfeiat aDrrxmpoo0aeen feildlaDrmu p;t4 rerxr3iadomtr i s;t trurxopiodop nlivsl()a2rmu pot1aex iieiasfmDrlnmp t)teerifcoydom eluvolt) exo(opoy4lpt lfetl( sDumum nu4teen iciltlaDeluvp;()artoio3totopteai s;s0 euoxmpiydlle licsl( sDtax  oo1oltnmoeiyt sDemu s;u4aleoif3oodoptranvs (  rumxr3nu4aptn fci ( a2um(roou1opxo fcilsfmDua( pn(0arxomf oydop   nvs s0 2tmio oodam emncs t s2tm(rp;t0tlxn ociydfs rmn s t4artrmociytomD  nes;s  rtrxo no4lleemictls  rua(r nt0apt moeilt mDulnvs t)areoioctadoptranvols) 2trxm iudaltn ncsa( s2tmxmpno4opx moctytls2rmumsnu0arenxfcoydfm e uvo;s0 eur(r3no4oltnlivs sf Dtaum ou0olenmociytls2eln pnu)alxrmrcty1lpteauvsl(  etoxr nu1al emnvtlsfs2urxm ;t1tpeomf3iat a2um( o t0arerir3ty1lmt anvi;t0srxrir oo4ale livil()artaum ou4opx mf3tls aDuau o;u0trtnmf io1fp e uvi;t srtoimpiydlm   netlsfa2rrx  ;t4tltn fciydlmDeln s;t)treomf3oatomDrlu ils t2xrxr nudomtnmfei t  Dtaumpnt0texomo3iltfm em( p (0 eerxo iodomD lnvs s0 eumiopiu1oltnlivtl(fartr( ono1oexnioeilslsDua(vo u0treoir3oo1lmteaiesl(  rtoxo3iu1lltemfeta() 2ta(monu4apen i3tltlmDelnms u0 renmo3oadfmte ivo t0t2xriopoo4lp  mfvtlt a2taxr ;o1opt ioetldfm2uaump u4aexoxocoadoaD  uesls)t2toim oy1omte iesat)sDtr(r ;t0apeo f3tadlsDrm( sn()trenif3iotfa elnes t0t2uo(m3oo4al nmnvta(f 2raurpou4olxnifeiltfs2em(mp;u) rxrir iatla r uvolt  rxoiopio4lpen ietatf Drm(rpno4oeenioctys sDra(vo;u4trxoio oo1lp rlues t0 euoxr3io1oltnmfeias a2rm(r no0apenmi3ias mDeau snu4teeoir oa1fa   uvs;t) exrxm nu4lpee nes tfarumurooo0tlx mfciatls2rlu o;t0tleomo3tydfa ranvs s0trtoiopou4apen fcia( s2trx pou0tlxo i3ias mDelu s t4 ltrio3iodfat aieols  rxoir oo4ol e ici ( arrmurooo4aptnii3ilt sDelu snu0 exnmfcoo1lateaivs t srumim3nudam n fet t) Durxm no1aleomi3tas a2ea(ms u0 rxoxoctadomtraueol()trtr(m nodll elnvslt) ruax ono4opxnmoeiysfs2rlnmp;u0artoxrcia1lmteaivils)seuoirpiodlmenliesat sDrau  nu4tpe if3iasfs2rmuvsnt)alermrctadom  aues;t  2urxrpny1ame mfciatf Durxro;t4aexnmoeiadla2um(vpn(0 lxnif3ia1lmDeauvil()s2tm(o no4ap e neiat)sDrm(mpoo4alx  i3tat a2elnvonu)artrmf3oydfateln o (0 2umxm iudol  mieiasfsrtrum ;t1oex mieiltfaDeluvp t)alxrmr3io1lmDr i ols s2uo(r nodam   neiatf 2rr(m nu0apx iieilsls2eluvo () lxnif3tydoa  auvils seumxopnu1llt mnvtas aDur(mono0apeo octat aDrmuvonu0teeoifcto1fp ranvolt)t2umim3nodlmt mfvs s)aDua(r nt4apx iietls mDeau pn()trtomr3tatfmt  ivi t trxo(o nydlltn fcsa(f 2tax p;t1alxoiiciysfm ranmon()alxomoctodop rluvs t)t2uo(o3no1ameemnvil()artm( ono0tleoii3tlt s um(mo (0trxrif3tydfpD  uvs;s s2uo(o ny1lmt  ictl()s2rauro;u4tpe micias mDranmp t4 eeomrctadlaD lnvi;s0srtmxopny1lm  liet tfsrra(rpnt0tpxn i3iytfaDua(vo t)aexoir ootlatranes t) rxo(r io4omtnlnctl()s2rrxmo;u1oex iociatfs raumpnu4aeenmr oa1fpDeln o t tetr(o nu4aptemfesltf Dtrumpnt1tet mictadfmDem(mo;t4tltrircoatopt aiei (  rumxo3nodapee fci ()s2ur( pno4tltnio3ias a rm(vs u4 ltomf oo1lptrln i;(0s2xr(m iodameemivsls)s2rru ont1oexo fcias a umnms (0alxrxr3oo1fpt auvsl(0t2xmir3oo1amee iesatf Duaxm oo1alxomoeiyd sDuau on(4alxoxf iytom r ueo s0 etoir oudolenliei () Dur( o;u4tpxnmfciadlaDrauvs ()teeomrcio1fpt  uvsls0trumxm3no4lltnmfcs tfsruaxrp;o4tlxnmoctytfm um(mp t0 leoxo tatlatrliei;( truo(o3oy1opeemfetlt)sruru  ot4tpxnifetatfaDrmn sn(4 lxrmrctadfptr neo;s s2xmxm3no4lpe micsat) rrm( pou4aex io3iad sDea(mp ()tetnifciytopD livi;s)setm(m oy4ape mnvs sf rta(m nt4tpx  o3iasla2em(mp;u4alenmfcoatoptraueo s0truo(mpoudomtemnvs t) rtr( p;t1ale if3iatfa2umu o () rtnmo oy1lpt lneol(  etm(rpnydlpt  fvsa( sDtaxro;o0texnii3tltlaDuln p u0altrirciy1oa   ieo;t srxm(opiu4ole mnei t) Drax p;t0oetn octadfa rm( s;u)areoxf iodoaD lneolt0s2xr(r3ny1lle lfvil()s2uru pno1tpto ietld mDrm(mon(4arenxr tydfatr iei t)tetmxr3ou4lp nmnetlt)a2rru  ;t1apxo fctltlm ea(vpn(4tetriocto1fpDe n o s0srtm(opiu1altnmfetlsfarraur oo1apeoiicilsls rluvo;t4 lxrmrctatopDrauvsl(0trxmxrpiy4lmte feiat s2umu p;u4opxn ocild m uaumpnu)trxnxf todlm raueol()texoio iydlmtelnei t a2tm( pno0opx iieias m2ea(ms u0 exrioctatfptr uesl()t2um(o3iydaltelfcsat)s2ur( o;o1optniicilt m rmnvs;(4trerio todlp   ieo;( seur(r ou1llenmici sfaDrm(mont1tex  o3iaslm ulnmon()arxnio3oo1oaDrau ils0 exoxrpoo1al nmics s)aDumur nu4opt mfeilt mDranmo;u)tltoif oodfa rln s t texr(o iu4altnmici s aDrm( ono4apxnioetyslsDrmu s;(0tltnxf3ty1fmt aneslt0srtoim nu4lpenlicsatfa2tr( p;u0apeo ieiatfm2rl(vpnt0trxnmrctydfat livi s) eur(m iodlm  mfei s)a2um(  ;o1alxnmo3tasfa um(vo;u) ltomf ty1om e neo;()trtoiopio4aptnmnvi (  rrrxmpoo0teen icilsfs2rlnms;u0 ltrmr iadlpD  ieil(0 exmiopou4olenmfes ()sDrm( pou0apx ifeiyt mDra( s;u0tleoifcoydfmD livi t0 2uoir oo4ll  mfeslsfa2uaxm ;u4tetomf3tld mDemnmo;u0aeerxrctydopDe n i s srumim3io1alenlfciat) 2tr(r ;t1oeeomicildls2ulu p;t)trtoxfctadlpDranesl(  rxrio oy4aptn nvsl(  Dtr(mpoo4alx ioctas a2ranvo (0teenir oa1laD livo;( s2umim ou1ape licilsfs2taxr oo0texo i3iytlsDelnms u0 etnxr ta1lm eaieo (0seurio iudole miesl(  2ur(m ou4tpxn f3tltfm2umn pnt4 reomf iydfa  lnesls truoxr3nu1ape  fcs s) Dur(r oo1oet ifetls aDrmnvs u4trtnxocoadfpte neo;(  eto(rpio4lm n net s  2ta(moot4tlx  i3tadlsDel(vs;(0trtrmr3oytoateln o t) 2tmxo3iy4apt mnetat a2rmumoou4tptnmictlsfmDul( p t)alxomo3oydfm  an i;() 2uo(o3oodale mnesasf rrmxmo;u0aee  fcilsfaDel(vs (4tetnmr3oy1opDr nvs (0t2toio oudlpe mivtat)aDtmuront1apeomfcild a ea(vp (0aleoxociytfaD auvs;s0t2xoirpno1lm n nvsl(f rtrx  ot4olxnmietyd m2umu on(4trxoxf3tydlpDrln s;t  exm(m3ou1ale lfeiasfsDtr(m ;t4olx  fctyt s2uluvs t) lxoxrcty1lptrli i;s0setoxmpnu1olt  ncslt) rrmumoot0tpe ifeilsla ranvsn(4 etoif3iodfm ean sl() rxo(mpio4ap e neias)s2rrxro;o0tlt ifeiydfa ulums;(4 ltoif tadomDe i ol()srur(o no4opeemivsls s2raurpou0altn iciytlm2rlu s;t)arxoxfcoo1op raueil(0 2umxm3iodlm elfvtl()aDraxr ou1oltnmociytfa2emn p t) exnio iatoaDrlivi t)t2xoir3iu4lpe  icsas  2ur(mpnu4tleo feiasfsDrmnvs;u)teeoxfcoydlmD ln i t0t2xo(r nydllte neta( s2tau ooo4opx  f3iadfmDraumon(0arxoxocoydfpD  i i;t0s2tmxo3iudap nlnet sf Dtaumo;u1tlt  octys mDra( p t4 exnmf3tatoptranvolt  rxmio3ny4llenlfcsl(f 2taumo;t0olx io3iat m umuvp;t)alxrmo3oytlptr u s;(0trtmiopnodom e fvilsf rurxmpou1tpenmieiyt sDean p t4artnmf oa1omt  ivo;t0trtrxm oo1lle  fei (f rta( oot1tpxnioeildfm2ranvp;() eenifcoa1fa e neils  eumxr3nudal nlnvilt)aDtmxmp;o4optoii3iatfa2uauvp u0tetoirctytlp  lnvol( t2urirpio1oltnmfcsl(fs2taurpnu4oeenioeiyt a rmnvsn(0alxnmo3iatfpDelnvolt)seur(opou1op n ieslsfs2rr(r oo0ole ifctls sDulu pnt4 lxoifcio1fptrlivs (0s2xo(m iydomt  icsa(  rtmumpot1oee mictydfm eaums;(4 exnmr tytopt auvsl(0texmxr3ny1ole lfctlsf rraxr nt0tex  o3ils a ua( p u4tlxrxf3ia1lmt au i s0seto(rpoo1lmenmncs tf rrmur oo0opxo i3iat a em( snt) ltrmf iatfm  li ils trxm(m oudlm n ictas)aDtr(rpno1texomoetas m rl(mont4 rxoifcoytoptrau s;t s2uo(r oodopee fesas)sDur(mpot4tlt io3tytla rm(mp t) lxoiociydfaDeluesl(0s2tr(o3oydlp elfet t)sDrm(r ot0olxo fetls m ul(mpnu) ltrmrcty1op rau sl(0t2toir3oodolen fvsasf 2rmx ont0teenioeiad a2ul( o t)aeeoxo ta1omD anvo;s seurim oo1opee fcs s  rtmu  nu4tptoiicildlmDum(vpnt0alxrio oytlmt  ivs;s0s2xoirpoo4ll   nvsas) rtm(ronu0olenmi3iad m emu s t4 lxnio3ta1oaDrlueo (0srtrxrpiu1olee ivt (  Dra( onu1tlxnii3tydlmDuluvs;u) lxnmr3ty1opD aneils srtmxr3iu4lmt lfvias  2rru onu4oet mfeildfa rauvpnt0tltoir3tydom ean s s trxr(r iy1lme  ics t)sDumxmont4tptnmieilslmDemu p u)tleoif iotop  anes;(0s2ur(r oo4ope  ici tfa2um(r ;u1tex mi3ild s2emuvsnu0aexoxocto1lmtraueols0teurirpoodaltn nvsas)a2tm(  ot4olenioetad sDuanmo u0 ltnmf iotopt lnvil(0 exoxo oy4alee ncsl( aDrmx o;u1alxniietyd s2uaumo;(0 exnmrciadoa rln i ()trxoim iydamt mietas s2rmxront4apxniicilt a2eauvs;u0trtnxf tytopD  ieil(0sruoxm nudll n ncil(f Drm(mooo0apen iciyt aDrmuvp t0tlxoir3oadlat lues t)s2to(m nudoltemnvslt)s2trxront1aeenifeilsla2rauvp ()arermo3tydfmte nvsl() 2urxr3ny1lpeelneil(  2trxmonu0oleoii3tlsls elnms (4tltoxr3ia1opt  n i;s0s2um(o iydomte ictas  rraur ;t4tetnif3ilsla rauvs;t)aeerircta1la rlu o;t) exoxrpnudome micsa(  ruaump;t4tpto o3iyt m rmumo;(4 rtoif oa1omDeaneils) 2toimpiydame lnctltfa2umum ;u4tpt mocilt m uanmp;(4aeenxr iytlpD an s;t)t2ur(m3oo1apte netls)aDrrx p;o4oetnif3iltfa umn on(4trxoxo3to1fp e ivsls texmxmpny4ll elfesa(f 2tmum ;u1teeoif3tatls2uan s () eeoir3totoa rluesls t2xoxr3iydol  miesls aruaxrpot4oexoii3iatfmDuluvo;u4artnxf3iatoptr uvi s t2xr(r ou1oltelfei sfs2uaxro;t1oetomf3tasfa rmu p () eermrctatfateluvi;t0tetmiopno1ol  lictas a2rm(rp;o0oet iieild m2uanvo u)alxrirctotfm rluei s t2trxm3oodamtnlfct t)aDtmxroot1apxnioeilt aDran o;(0 rxrir3iatop eliei (0setrxmpno1amte nvtlt aDrruro;t4oeeoio3iat s2rm(ms (0aetomociy1oa  au olt) 2xmxrpnydam e ictas aDra(ro;u1apxn iciydls rl(vpn(0arxomo3ta1lpteln s;()seumim3iodopte ivtat sDuau oou0tleomfeiatfm2emuvp (4alermo3ootomtran i;s setoxo3iydamee fvi ( aDumxrpno1tpen o3tlt m ul( p;u)tlermrcty1lptrli s t  rur(rpiy4ll n iviltfaDraumpot0tetnifciaslmDemumo u) rtoxr ia1opDeauei;(0s2uoir3oy4lpt mfei (fsrtm( ont4aet ifeiytfs2ua(mpnu)teermrciadfmteli s;s)s2to(opny4omtelivsas  Durxrpnt4opto feiltfs2rmumsnt0alxrxo todlp eanes t  2umxrpio1am emfviat)aDrrur no1alx  octysfs umnvs t)artoio3ia1fmDelu o s)s2tmim ny1am nlfci t)sDrr(rp;o4olxomoctat m2ua(vont4trtoifciodlptrlnvi t)truo(r3nu4lmtnlfct tfaDur( pot4oee  i3iat s2emump (4altomf3oydoptr nvs;s sruoiopiodal emnvs ( a2ua(r nu0oltn f3tyslmDum(mpnt)arxnxr3oa1lpt lu o s srumir iudapenliciatfa2tmuronu0oee mietasfs emnvs u4tltnmf ta1oaDr i i t0tetm(m nydopt  ics s sDtaumpoo1oeeoiieiad m rmuvsnt0 exoir iydfp  anvs;() rumxm3nu1al e icsas)s2tr( pno1optoif3ils m2ran s;t4 reoif3iytlmDelu o;( s2xmxm3no4altelfcs t) Dumxm ou4opxomietydlm ua(mont4 ltrxf3oytomteauvs;s0teuoio oo1amenmnvs () Dtmumo;o1opt mi3iatla2ranmp;()trermociadomtean olt0t2xmir iudapee feils) rtm(  ;t1aex mictldlaDrmnmpnu)tlerif3oydfpDr nvi;s tetr(mpny1optelivi s)artaxm ;u1tle if3iasfa rm(vo (4 rxoxocty1fat  ivilt tetoxm ou1op  lnetl()aDrm(  ;o4tptnmiciltfs2eluvpn(4trtnxfctotom  aueol(  exoxr3oodoptn fviasf 2urumpnu0aptn ociysls2eaums (4aleomf3todla  au sl(0sruriopiu1lm   iesas  2rru  ;t4ope mf3iydlaDumn p t)trtrir io1la   i olt)teumim3iu4am elivsasfa2truro;o4alxo ociydfs2ra(msn()artoxrcta1fpDe ieolt0s2uoiopiodop n iviasf Drr( p;u1alx mfetlslaDrmums;u4aeenxr3iatlmte ies t0srtoxopno1ope lfvslsfsrtmu  oo0teto feiatls2uanmp t)trxoio ia1lm  lueilt0trxm(rpou4amtnmncs t)a2rmx ont4olxoif3ild s ea( pnt)aexrif3oadop ran ilt0 rxo(m iudolt mfeta(fsDraurooo4opxn fetasfsDeaumpn(4aeenxoctodfm rlivi s trum(mpio4llt lictat) ruaxmp;o1tptniicildfsDrmuvp;t0trtrmfciodfpD lnvol(  2umxm3nu4lptnlneslt sDtru ooo0altn ociatlm uau snt) exrmo3todlmtr ivs;( s2xrxmpno1al emncta(fsrtrxrono0tetomi3iyt a eln o;t4tltomocoydoa  lu ol()srxoim nudomee ivs t a2uaumpno0tpe mo3tydla umnvp;()alxoxfciytop e iei s t2xm(r no1alt livs tf rta(  ou1oex mfeiadlm ra(mp t0tltrifctytoptrlivi;()teum(m iudaltelivtatfartru  ;t4optn ieiyd aDemnvp u)aetnirctytopDelivo;(0 ruoim3ny4am e nctls)srtm(m nu0tpto i3iadla2um( pnu)teeoxo tytfpDr ivsl( s2uoxm oy4lpt lfcs s s2urumoou1alxo ocilsfaDuluvpnu)alxriociadlm eaieo;s)s2xoiopiu1lp nlictls  Dur(mpoo1tetnio3tat mDulu p;u0artrxocoytlaDr u s t sexriopio4alt  nvt t srurx ooo1tpenifcildfa umumont)altnifcootopDeai i ()srtmiopoydlle liesasf Drr(rp;t4alxoifcildfs2ra(msn()aeeomr oy1latrlivsls)seurxo3oodomtnlfct sfartmumpnt0aleoio3ildls2um(vsnu0 exnxr tydlp e uvi;s0s2xrxm ny1openmivtat)artrump;t4altn feiadfa2eauvp;u0 eenxo3tytopDeaivs t)s2to(rpoydom emfetatf Drmumpnu1aleo f3tat m2eln snu)tetrxf ootfpDe nesls0t2xoio3ny4lmte neta() rtm( o;u1alt if3iys aDraumo;u4aeenir ia1lmDr uvi;t  etoxm3ny4amenlfesas a2rr(rono0oee  i3ils sDeaump;(4arxnxo iadoa  an o;() exoxo iy4op  lneias srtrx  ;u0tlx if3ilt m2uln sn(0tlenif3oy1lpDr uvil( s2xoim3iu1openmiesat) Drmxmo;o1tetnmo3ildlaDuln s;u0aexomociodlmDeaues;()tetmxm oy1amee icsls  2rrxr ;u1ape  ictlt sDemuvs;u) lenmrcoatfptr neslt0tetm(o oo4olt mfetlt) Drmu pot0tlxn o3iydlaDumuvpnt)arxrmo oo1opt  n s ()texmio oudoltemnei s  Dtm(m ;o1tpx miciad aDel( s;u4 rtnxr3tytlat  u sls0trtmimpoy1opt  fcsat)sDrru pou0oee mfetytla2rl( s;u)trtnxrctydlatrau olt srur(o3io1lmt mncia(faruau pno1ale mfctadfm2ra(mp t4 rxomfctydomDrlnes s0seumimpiu1am n nvtl()sDrr(  ;u4tetnmf3iadfsDeln o t0aetoxo ia1opt ln o s  rxrxo nydaltemnvta() 2trxmo;o4olenii3iytfaDuluvpnt4alxoio iadlate neilt) rumimpoy1ap elnctltfa2urumoou4tpe ii3iadfs2ulumsn()teeoiocoo1lmteai i;( seuo(mpnodale micil()sDrrumpou4altn i3iyd s ean pnt) rtnxrcta1fmt an i;(0texm(m no4lltelivi t sruaumpoo1aexo o3tydfm ran pn(0teenxf3oatlp  an s;t)srtm(opiy1lltemfetat) Dra(  ;u0aetoio3iytlm rln p;t4 lenxr3oo1oa  auesls) rtr(r3oudlptn nei tf 2rau poo0opeo fcilsla2rl(mpnt0alxnxfcoa1laD lnvo s0s2xrxo iy1lm  lfvias srrr(r ou1tetn ietys m2rlu p ()arenmr tydfpt  ieo;t)s2xoxrpno1lp e ivia(f Dumum ot0apxnmfeiat s2em(ms t0alxnif3oy1laDe uei t)tetoxr ou4lptnliviat)sruaxmpnu1tee ioctlt s2uauvonu) rxnxf tatom rln sls0 ruoxr iy1olt  fvs s)sDuaur no0aeeomfctlsfm rlums u)trtrirctadlm  livs;t)t2tr(m3iy4omte iciltfsruru onu0teto oeiys m rlnvo u)alenxr3tytlp  ln s;() 2tr(rpiydlltemicil( s2tm(root4oexoifctatfm2eaump (0 ltrif oodlmD liei t  2xo(opiudlpenmfesas)sruaum ;u0tpx mocias aDum( p;t) lenirctotfptrluvsl()truoxmpoodlltnmneslt)sDuaxr no1oeenmoctydfsDulu o;u4 eenio3tadlaD aueo (0t2xo(mpny4omenmnci s  rtm(r ;o4apto oeiatfm ran p;t)artnxrcia1om  anvslt0setrio3nu4aptemfvs ( a2tr(moou4aexo feiyd mDumumon() ltoir iodlpDe ivo t) 2umimpnydaleemnei (  2rm(  ou0olx mf3tadfsDrluvpnu) lerir io1lm  an il()t2toiopoydal nmfcsl()srur( oot1oeenmiciadfa2rln onu)tetrio to1lptr ivil() 2xrxrpoodaptnmnviat)arra(ro;o0tle  i3iytfsDuanmp;()trxoxo iatfp r neils0texrxr iy1ame lictl() Drr(  ou1tltnmfeiltls2uan o;t)alxrmr tatfm e nvils0 etoxr iu1ap  micsas)arrru  oo0olxn f3iyt a uanvsnu)tlerxfciy1lat  n ols t2umim3io4lme mnct t aDrax pno4tlxo fetlslm rm(mon()tetrxfctadfmD lneo;s0t2umxo3io4lmt mnei t)srra(rpou4aexomi3tltfs2rlu o;u4 lxrif3totoaD an ols0trum(r iy4oltnmiesasfaruaxr ;o4aee if3tatfs el(mp;u4alxomr3iadoa eluei;() etmio3io4llen fesa(fartrurpou1tpen oeiatfm2rlnvo;(0trerxr ta1fmDe i ils0s2tmirpno4omtemiesat) 2rmxrooo1oetoifctadfm rmu s;()teermo3oodoaDe ies s)t2trimpoy1amte ncslt) Dta(  ;o4tetnmfeiad s umnvo;(0aleoio3io1oaDrauvol(  2uo(m3oydopenmfesatfs2umxront0ale  f3iatfa2uluvont4 lxrxo iatlptran ils)trurirpio1om n iet ( a2rr(mp;u1olt mociydfaDeanvsnu)aeenifcta1fa eaueils)srxrir ny4llt  ieiatfs2rax o;u1altomietlt m2rluvsnt0 lxrxf3tatopDe u o s0sexr(m iu4ol nmncsat)sDrr(rp;u0oexomoetldfa ulnvp;u)arxnmf3oatoaDr ues;t srxmio3iydom emnvs s) rtmx  oo0aeto ietytfsDrlums;(4altrmo3io1lm e uvo;(0 rxrxm ny1oltnmnciltfsrta(r ;o1opxomieildlmDeln on()arenxrcoatlm r uei;s  rurim ou1oltelfei ( artmumpoo1apxn o3tat sDuluvs u4tlxoiocoatfm rlivi s0s2umir oy4oleelicias)s2um(  no1tet if3tatlmDrm( pn(4alerxo tytoa r n ol(0seur(m3oy1olt  ict () 2ta(m nt4ale mi3ilsfmDul(vonu) exoxr3oodlpD lu ilt)seurxm iu4apeelncia()aDrruro;o0tpxo o3ils sDrlnmsn(0 rtrxf3iadfat  u i (0s2xrirpiodom  lnvsa()aDraxm ;t4alt  ietldlsDra(msnt0trtnir3todlp rlues;(0t2xoimpiudame mfci s  Drmum ot1tlen f3tasls2uau pnu0artoif todfmDeaiei t  rtmir nu1ol emfeslt  2umxmont1optoioetaslmDran p;t4 rtrxo oadoaDr ieilt  2urxr3oodom e ici t)arrrx o;u0aleomf3iat m2raumo;(0 leriociotlateln i;()teumimpnodomtn fvsatf 2rm(rpnt1olt  i3iysfs ulu s t0tlenxo iytfpD livi s  rxo(m oodop n fvi (faDua(moot0oetnif3ilsfmDrau p (4 rxrxf oo1lp   u i;s0 2xo(m nudom   ics s)a2umxrp;u1optoif3iadfs emu o;(0tlenir oydopDraues ( srxrirpiy4ll   ivs ( sDrr(  ;u1tpxn icilsfaDranmp (0trxrxo iytom e ues () ruo(m3iy4ap e netls  Dta(root0teeoii3iyd m2uau o;u)arxrio ia1oa elnes;(0teurir nodllt  fct s aDtm(r ;t0apx iietytlm emn s;t0aeenmr3tytom raiesls srxmimpiudap emnvil()a2ta(  nt0olxn ieils aDranmpnt4aexrif iodfmDrlues s  exm(opoy1amtnmfvtat)s2ua(r ;u0olx if3iltls eluvon(4alenir3iodfateai ol() rxmxm3oy1ol emfcilt) 2rmxm ;t0tet  feiytls um(vo;t)altomr3iatfaDr nes s0t2xoiopny1lp n nct s) rrrumo;o0tpx  o3tyt a2rauvs;t4tlerxo3totlpD luvs;s tetoimpny4lmtemivsl()arrruro;o0oet mo3ils a em( p t0aetnif ootlpt luvs;t0teurimpny1optnmfct tf 2umxr ;t4ole  o3iytfaDel(vsnu0 reoifciadlm rauvslt)seur(m io1omenlfet sfaDtmuroot1tetnioetldfaDrm(mo;u)trxrxo iytom rlnei;t0 2xrim3oudom elnvs (fsruaxm ot1tpen ieildls rm(vonu) rxnif3tatom  auvsls)seuoim oodlm  mfvtlt aDuru  oo1olxomf3iyt s ul(mp (0aleoxr oy1fpDraueil(0truoim ny4am  mfet sfarra(r ou1aptn oeilsls2ul( pnt0arxomocoydlateluvi;() rumio3iudopt lfvs ( s2tax  ;o1ole moeiasls um( o;()alenmr3iotfpt auvsl(0 eumir iu4lm  mncs s s2rm(rooo4optn feilslsDea( p;t4arxomf tatoat  uvilt0srtmxmpnu1apte ici ()aDumur ;o1oleoioctlt s ul(mo (0trxrmr3ia1opDelnvils0
\ No newline at end of file
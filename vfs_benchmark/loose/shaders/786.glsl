@@ -0,0 +1 @@
+ivilt) ruoio ny4ol  lfvi ( srtau pot4oeeo ocildfa2ra(vp;u4tetnxrcoo1opt  ieo;s0 2uoio3oydllt lnctatf 2tmurpoo4oexnifeild s rmnvont) eerir totlpDeln o t)trumxr3ny1altemivtlt) rtm( pnu1alx io3ias a uluvp t4 lxnmr3tydfate ieol(  etoxmpoudllenlfcia() rrau  ou4texnmo3iyd mDemump ()aeeomfcia1latr uei;()srxr(mpoydame  nctas)aDtm(  ;u1aexo i3tad a2uln onu0arenmr iatlp eau o (0t2uoio3nudlp nmnes s s2taum no4tpeomoetasfs2emu o;u4artrif iatlmD  uvi t) eur(r ny1lmt miet sfsDrr( p;t0tpe iiciltfaDul( s t4 rerxfcio1fptelnes s0t2to(o3iodamenmfvt tfs2raumo;u4apt  ietlsfs2rl(vo;u4 ltnmoctatlmD lu olt0teur(m3nydamtn fesl( srta(rp;o0tleomo3iytfm2umnvo t0 exoxrcia1lmD lnvs;t)t2xr(m3ou1ole lfetl()sDtrum ;t4tle ioetaslmDum(ms;(0tleomf3iydla e iei t0texm(m3iu1lm nmnvtatfaDua(rooo0apxnmoetltls uln o t4aexrxfciy1lm rln o;t)t2um(o iu1lltnmfctatfsDrax  ;u1tex if3iytfa2emnvp;()artoif ia1fa  an ol(0 rtoxo no1amenmnct t) rtr(moou0tptomieiysfsDum(von(0arenmo iy1fp e ies s)sruo(r3nydaptn nci (fsrua(r ou0opx  oeiysfa ul(monu0 eenmf3oa1laDe nvi (0srum(r no1ope mnvt (  2trx  ot0olx  o3iyd s rluvs;()trxrxf3iatlaD aueo;t)s2xoio3no1ap emivsl(f Drrx  no0altomf3iadfaDrau on() rerif ty1lp   i ilt sexo(r3ny4alenlfei tfartmxmoot1tlx  octltlaDra( s;(4texoxo iadlp eai i (0t2tr(m iudlm elivslsfs2tm(roou4tpe  fetys a eaumo t0trtnxrciodfp eau o ()setoxo3oydame livilsfaDrm(  ou0oleomo3iatla um(msn(4trtnxo io1lp eanvi ( trtoim3ou4lmee ncs s)a2tmx  nt4opxoioeiytfm ua(vsnu4altoxf3todlatraies t) etrxrpou4ll n feta(f Dtr(mo;t4olxoif3iad sDean p;u4aexrxr totlat lnei;(0 2xm(opiy4lltnlnetat  2tm(  nt4olx mo3ildla2ulnvp;u) reoif3oa1omtr n sl(  rum(r3iy4ap  lncsls  Dtrumoou1texn ociys a rlnmp t4tetrircoadoa rlneilt  exmiopio4lltnmfei ()arua( onu0tpto ictydfm uaump u0trenifcoadfptean o;t)sexoim oudamenmicsa()s2ta( pou1tlt miciasfm2ulnmsn(0 rtomf3oo1fm   nes;t  2ur(mpiu1ale  nvta(  2tmum ;u1aeenioctls m2rluvp;u4aexomo3todop e ues;s0 euo(o nydlltemiciasf 2urum nt4alx  iciad mDemn o;() eeoxrciodfmDelneil( s2xo(mpoodap nlivtlt)arumxmo;o1tpeomoctldfmDea( o (0altnxf tadlmD lnvi s teurimpnu4lme  nes (faDumxroou1olxo feildfm um( p;t)artoxr oodlmtelnvi ( sexrim3ny1omeelncsat s2ta( p;o0tpxn fetldfs2uauvs;u0 exnmr3tadomDr uvi;()srurir3nudalen nviat arrm(rp;u4aee if3iydfaDumu p ()areoxr ta1lmt anei t) 2xr(mpiu4olt lictl()aDtmu pou0apen oeiyt s em( o () eerir iodlmDeln s s0t2uo(r oo1ol elnesatf 2rm(  ot4tetoio3iatlaDrl(mpnu)tetoxo3io1laDeai o;s) rxo(rpny4oleelncta(fsDumu o;u4altoif3ildla el(vo u) rtnmf iydlatranvs;t) euoimpoo1lle mnet ()sDrmumo;t4oee ioeiydlmDumuvpnt0arxoxrciy1om  lies s  2uoxr nu4apt mnvslt)sDtau oou0ole ioeildfs2emu s u)areomo iotla rluei;t)sexrimpoo1omeemfvsasfsrtrxm nu0tptnmfeildfa rlump u4 ltrxf oytoa r nvsl(  2um(m oudol  lictl( sDurumpoo0apxomi3tatlaDumn sn()alxrir tydomD aivolt0sexoxr3nu4ap n nvs (  ruax o;u4apxomfetldlm2emnvonu0 rxrmfciadfm  ln o;s)t2xrxo3oydlptn nvsls)aDurx ont4tet  feiys sDua(vs t)tlerir3oo1op r i ol( setmxm nudoleelfvsat)aDtmx ono1tee  ietlsfs em(vs;u0tltrif3totfpDrli o ( trumio no4ape lnvt (f 2tmur ;o1tpe iieiyslm uln s u)artoxr oo1lm elies;t) rtoimpiy1lm   ivsls a2rau  ot1teto f3iysfs2rlums t4altnif tydfpDrau i () 2umir io4lpe  nei s)sDtru  nu1aptnmf3ilt m2rmnms t4arerif tadfaD ln ol( s2umxo ny1ap n fvta()aDururpot1aeeoio3tltfa2uanvo;u) exnxr3totlmteaiei ()s2xm(opio4omenmfcil(  2uaurp;o4oltnioctydlaDrl(ms t0 rerxrciy1fptranei s)srtrir oy4lp n ivsat)aDumuroot1optniicias s2uluvp ()areoxf3oa1fa r ueil( t2xmxrpnu1ol e neta() rumx pno0tlx iociydlm ul(vp () exnif iodopD luei t)s2trxr iudll   fctas  Dum(m ou0apt  octasfaDrlumon()tlxnio3ty1omt  neils)t2xmim3io1ll n ict tf rum(rpno0tet mociysfm2rm(mo (0artomo3tadfm  ai olt) euoio3ou4lp n neslt) Drrumo;t4tlxn octyt m2uan s () ltnxo3oydlaD aneils sruo(m3nu4am  miviat) 2rrxro;u0apxnifeiasla2ranvs u0trtrmrcoydlpDrau sl( seumxr3io1omte ieilsfsDtmumont4aleomictlsfa uluvp t)treriocoatomteauvols)seurir ny1lmenmfvsas  Draumpnt0aet mfcilsfm umuvs t0tlerio3tatlate ivs s)s2toimpnodoleelncia()s2ua(m nu0tltomoetld a2rm(mp;t4trerxr3oytlmt aieol(0s2xrxm3nodlmtelncsl()s2taur ;o1teeoio3tldfm umnvo u4 leomf3todlat lu o t0 rxoxmpoydomt lnetls)aDtaurp;u0tlenioetadla emumont0 ltniocoatfa raieolt0tetmxo3io1am nlfvt ( s2raxrpoo4opxnif3tat a2rm(mpnu0 ltrio oadfm  lnvsl( t2um(opoy4op nmietl()arua(m ;t0tpxniiciytlmDem(mon(4alxoxf ty1oat an s;( s2uoxm3iodolenlfcslt)s2taur nu0olxo f3iasfa2ulnmpn()tleomo3oatlaD lnvs (0t2uoio3iudop elnvil( aDta(r ;o1tpenmieilsfa elu s u4 exnxr3iytlp e nvo (  2um(rpnydlptemfeilt sDtm(  oo4tlen ociysfs ua(mpn(0 rermr3oa1oate nvi t srum(o3iu1amt  feil()a2uaum ;u0apxomfciasla ulnvo;u0 lerxrcoy1lm eanesls0sruoxm iudome  nvslsf Dtmx  ;u1oexomoctydfa eanvs;u0tetoio oadopteai i ()s2xoimpiu4amen nesa( s2trx p;o4oeto f3ild mDeluvo;t)aetrxoctytopD an slt  2uoio3ny1olen nvi tfsrtmu  ot4aleomfciltfmDrmnvonu0arxrxr oadoa  livs s)tetrio3iudlmeelfeiatfsrrr(r ot1alx mfctlsfaDelu s;(0areoxf oo1om  an o s sexoirpnu1oltn ivia(fs2ta( p;t4aee mi3iat a emnmpnt0arerxo3oo1lp eli s (0t2urio no4omenmnesat)s2uaxmoou1ale  oeiaslsDemu pn(4 rtomrcta1fmDeau i s0tetoiopny1llen ietls s2tru oot4opt mfcilt aDrau p;u0 rxnxfcia1fmt ai i;t s2tmxr oo1apen fes ( sDurx pnt0tpeo octltfm2eluvp;t0 rxrif3totfmte i i t0texoxopno4ap nlnciat) ruaxroou0tltn fciaslm2ea(mpnu4trxnxo3oy1oa  luvs t)t2trxrpny1omeelfetlt)aDurx pnu0alt miciys s2uln o;u)tleoircoy1opteauvo () eto(rpoy1omenlnvtls) 2tmxmono0texn oeiasls eanvs ()tleriociydlmD  ueo ()setoxo3iy4ape  ivi sfaDtm(r ;t4oee  fcias aDra(von(0trxnircoadla  aneo t sexoxo no4ap elfvsasfartr(rp;t1alx  f3tadfs2ul(monu0 eeoxfcty1omD  nvil() rxrimpou4amtnlneiat) Durxm ;u1tpx  ictat a2umu onu)areoif3iatopDrli ols trum(r iu1ll e nvilsf rrr(root0olt  ociatfs ua(mo u4 eenmr totlatr i s;s)texo(o3iodlmte nvi (f rtrxm oo1apxnmi3tadfaDuau o;()trxnxr3to1fateanvo;s0s2tmxm3ny4apenmfet t aDta(m ;t0aleomieils m ean sn() lenxo3iy1omteauvils0 rum(r ou1opt lnvt tfsrtm(  nt1tpt ifciadfm2ranmp;() exnif3tatfa  anvilt0srxm(rpio4openlivsat) rrr(rpno1alen icilt a elnmont) rxoxocio1faD au sl()teurio3no1amtnlnet (f 2uaxrp;o0aeeo ietydfs ran snt0arxnxf3iydlaDeai i;()srtmim3oy1ape  netls  2urxr ;o0opxoifciyd m uln s;t4trermoctydfmt  nvils  rtrxo ny1oltelfvsa( arururp;u0altoioetatlmDra( o;(0tltoxrcoytlatraueo s0seumiopiodlpe mnvtl( a2ta(mpou4tetoiiciatlm2ulump;t4 etomociytfpDrlues;(0teumxrpoo1omeelfes ( sDrr(rono4olx moetlt s2ra( s;t) reomf3tatoa rlieslt) rxrxm3ou4op emfciasf 2rrx pno1tltoioetad s2rl( p (4 exoxf iatlmtelnes;t teur(o oodalte iei s sDrrx  nu0optn o3iltfaDuaumo;t0texnmr oydoaDr i ol()sruoxr nu1lp emneiasf Drm( ooo1alxn ietld m ulnvonu4arxnxo iotlatrlneol(  eto(o iu4ope lieiltf Durxmoou0oeenii3iasfa2rm(mp ()teermf oytoa  livs s)sexo(m nu1ap  lnci (fsDtm(ront4opeomf3tasfm emums ()trxrxr3iytlpt aues;( teuoim3oudapenlfcsasfaDtr( pno4tpenioeiltfa ranmo;u4tlenxf oa1opt auesls srto(r iu1lltemiesas  2tm(r oo0ape  i3iaslm eau p (4 rtomrcoa1laD aues;s)t2xr(m3oy1lp n fct (farrrum oo1oee mocild mDel( on(0 ltoxfciotlmt aueo (0 euoxr3ou4apt  ies t) 2rax  ot4teeomi3ilt s2ua( s;(0tetomf iodla   neils  rtmim3oy1om nmfeiatf 2ur(moou0aetnmo3iys s ul(vsnt0 lxrxo todlaDe iei s0srxo(o3oodlm emnci s aDuauro;t1aee iociat a rlumpnt0aeeoir3oytomtrauei s) exo(o3nudamte ivtl(f 2trurono0tpeoiocias mDea(mp u4tleoxf oa1fm elueils t2toxo3ny1aleelivils)s2taxr ;o4oex mf3ild sDuan sn(4tlerxf totlpDean sls s2tmxopnu4al   fesa( a2trx  ou0aexnif3tldlsDumnvp (0areoxo to1fpDr ivsls tetmxo3ou1op  lnvsl()aDumxm ou4tpe iocilslsDum( pnu0arxnxf tadlmD ln o;s setmirpny1lpe lfvta(fsrtr(rp;o1tex ifciys a2ua( snt0 lxnio3oadlmDelnvo t) 2um(r oydllt lncsa()aruaxr ;u0tex if3ilt s2eluvo;()alxnxrciodomtraivils)s2toxmpno4am e fvi t aDraur oo1opt mi3iasfm emnvp t0 lenmrciadfmD aieo;t sruriopou1openlictltfs2umxm ;o0olxnif3tytfm emn snu) lxnirciy1fmDrlu sls)t2tm(r3oo4altn nct ( srrrxm ;o1olx  icilsfsDuln s;t) rtrmocia1fat aiei ()seurxm iodlpee icsat) Dur( p;u1tee ioeiytla rmu snt0tltrifcoo1om rauvo;s0 etmir iy4openlivsasfsrua(  oo4optoioctyd a2rl(mp u4 ltnxf3totfm eln o t  etm(m3iydome mfctls arrm(mpnu1tetn oeiasfa eanmsnu4aeeomocoydoatelu i (0 2xrio3ny4apenmfcil() Drru  nt1olx iiciltfm2emnms (4tltniocoytlp  auvs (  2to(rpiu1omtelnvtatfs2umur ;t4aleomociytlmDrmums;t4 renio3oa1opDrau i t0t2triopiu1lp e neiat)artaum ;t0tpeo fciad s elnvo;u4aetnmo3iytomD auvols)sexoxm3ny1llt  fcil()srumx pot0tleoifctadfsDulnvpnu)trtoiocty1optr i o t0s2uoim iy4ll elfetasfsDumurpoo1oet  icild a2rluvp t0trtnmo totlaDe uvils)s2xmio3nudalte fes ()aDrmum ;o0oleomi3ias aDean s u)teerxr3ootfpte uvols  exo(r3ny4lme lfeiltfsrraum nu1teeniociad s uluvp;t0 eeoxf todfatran o t0t2to(rpoo4ll e ics s)s2tr(r no4tleoio3iydlaDrmuvonu)arxomf3iodoptelnvi;t) 2xr(m3ou1om n ivtls  rrrxroou4opt iocildfa2ulump;t4 rxoifciotoaD  nvols teuoxo oudolt livt (f 2rrxmonu1tex ifcildlaDuaumpn(0tlxrmr ta1oatr nes;( seuoxr oo1alte ivtas srumu onu1apxnifciysfa uln o;()arxoxf3totfm   uvols  2xmio3ny1lp nlnciat srrmur nu0tetomf3tasfa em(mo;t4 ltoir3ty1fp eai sls0s2tmio3ny1amee ieia() rtmx oot4aeeoiieild m um(mp;(0arermoctotom  auvi;() 2ur(r3ny4om  lnesatf 2taxmoou1altniiciadfm rl(vo;(4tlxrmf oytfa rlnvs;t trxoxr3oy4lp   fcs () 2rm(  ;t4texo icildla2rlnvp (0texnmf oydlaDr ueil()s2uo(r iu1omenlneias) 2tax  ou0oexoif3iasfa2rmnvont0trtnmociatfpDraneo s t2toiopoy4lptn neias srrm(m oo0ape mfctyd mDra( p;(0aeeoxf3totomDeaivil()teto(r oydam   ivsas)aDtrurooo4oee ioctyd s rm(mo;(4altrmr3oa1opDr i il()s2trim iu4ape lfeiltfaDta(r ;o0tetnmo3tat mDrlu p;u0 rtrmo3todlaDeli o t0trtmir3no4ap  mneiat aDuaxmpnt0oexnmf3ias a2ra(vp;t0 eerif3tatfm raiesl(0texrim ou4lme mnvsat s2tm(m oo0ope  i3tltls rlu o u0 rxrir ta1oa e ieol(0 2trirpou4opte nesas sDtauroot4apx io3iltfaDea( s;u4 rerxr oo1opD  ueo s0t2tr(r3oy1omtnlnvta( aDtru pnu0oee iiciys mDeluvsnt4treoirciydlp  au ol( srtm(o no4lpeemncs sf Dtmurp;o0tpxo iciydlm emnvo;()tltrxo3oydlaDeauvsl() 2urxr3nydopt miet s)s2rru  ;u4tlenmo3ilt m uan s;t0trtnmfcio1fpD lu s s)tetrxopoudam n nesasfsDrm(r ot0aexnioctldlmDulu p t4tlxnmo oo1op  lu sl() 2umxr3iodlpee neiltfs2ur(m ;o4tpxo oeiyt s2rluvpnt)aexnif oytomteaneolt truo(o3iy1lltemietat  Dtr(r ;o1alxo oeiytlmDrmn s;t0aeerxocoy1lmtean s (0 2tm(r no1lltnmivt s)sDrm(mp;o0oexnmoctyd m rmump;(0 lxoiociytla e u o;(  ruoxm3iy1om nlfetl( s2taxrono4alen oetys s ulumsnu)trtrxfcty1lpDeli i;s  eumir3no1optemfct (fsDuaurpot1apxn i3tad m2elnvo ()aeenxf3oadlp rlnvsl(  exoxo3oy1ome lnei tfs2trx  ;o1tle ifeias s umuvo () lxomo io1laD  ivo;s t2trxm3iudamenmicslt srrm(ront0oeeniietatla2rl(mo (0tlxrxfcoy1lmt aieslt)srumim3iy4ll elnvils  rrru o;u1teeo ociysfa2el(vp;u)alxomr3iytomDrauvs t0s2tmxm3iudlptnlnetas)aDrmxmpno0tle  ictadfm eaumsnt0 lxnmoctydopDranei;t teurxrpiu1aptnlivtls arua(rpou0oee ii3iyd aDumu sn(4 eenxo3iytfm rliei t0t2uo(mpou1optemfet s)arur(root4tptnmo3ildls2ua(mpn(4artoiocio1latr i sl() rtoxopoudop elfvtltfa2raumpot0ale iieiltlm rmn o (4altrifcty1oaDeanesl( tetrir iu1opt mies t)aDtru onu0olx  o3ild a2el( snt0arermf iy1fmte ieil(  2xo(opoodalt  nes t)s2trurono1olen f3tys aDranvo t)aleoio3oodlmDeanvil()s2ur(rpno4openlneilt srtrurp;u4aptn oeiydla2em(vo;(0tlxomr3iytomDranvs;( t2uo(r iodalt lncias sDtrxm nu4olt mfctldlm rlnmo u)trxnif3tydopteln o;( setrirpiodlptnmfvta( srrau pno0texnmi3iyt s2ulumpn()aeermocoodomtrau s;( srxrirpiy1lm nlfcta( arta(m ot4ale mo3tltfa2uaumsnt4aetnmo iadfm  aueolt) rtm(mpiudalenmnei (farrmu poo1aeen ictytfm2umumpnt0 rxoxo3oatoa r nvo;(0 rtmim3nu1altn fvt s  Drax ont0tpe moetltfm2ulu o u) leoir tytfmD  nes s) etoim oy4omenlictls  2raxront1alt  o3iadfmDraump u0aetnmociotlmt lu s t0t2xoim3nudol  livsas)sDrrxronu4apenii3tadfs2rm(mon(0 leoxocoo1om eau ils0 2tmim iy4om emicsat) Drm(mo;o0optnmi3iysfaDem(vs;() exoir ootfpD  u o;() etm(mpoo1lm  lfcs t)srtmuro;t0oet ifctltlsDuluvpn(4trxoifcoodlm  ai sls0teumxm ny4optnlivs ( s2tmx o;o4ale mfetyd aDrl(mo;(4 rtoxfcoydlm rai slt texrirpno1ol emnct t  2urumooo4alx micilsls uaumsn(0artnmf3ootom rluvo ()sexmim3ny1ame mneil( s2uax ooo4oetn o3tld a2rl(ms;u) etrmfcoodlptrlnvo;(0s2uo(mpio1omtemnesa(faDumum no1alto iciytls eauvs u) ltoxo ootlaDeauvo t)sexrxm io1lleemnctlt srrm( p;t1tlxoiietlslm2rmuvs;t4 eeomf oydfmDranvils)t2xmimpio4lm n netas aDrm(mo;u4oee  icildfmDrmuvsnu0teenifcoytop elnvols)texoir ou4op e fviltf 2rmu  ;o1teeo oetys m2ulums u4aleomfciatomDrliesl( t2trim3nydalt  nvs tf rtax p;o0ape mfeiad m umn o;t0 etrmf tytoa raieo () exoimpoo1am nliesa(fsDtau poo4apxomo3ildla rmuvs;u0tlenmf to1oat  uvi (0t2xrim ny4ol   nes s aDta(ro;o1tlt if3tytfaDel(mo u)tltrxo todopD  u s;s0 etr(rpio4am e icsatf Dtruro;t4aleoioctatlmDuaumon(4 lxrxr3iytom   u ilt seto(m3iu1lltn fct (fs2rau ooo0tlxoif3iytfm2eanvs;t4 reriocoatlpD lneo ( seum(mpoo4omenmicsl(fsDtm(ronu1aeto ociyd m elnvo u) reoxo3io1fpt  u s t0texmxr iu1llt mnvilt aDumx ont0tpt if3ilsla2eanvs u0tltoxr ty1lmDelueolt  2uriopoo4lmeemivs s)a2rrumpnt1apenmoeils mDemnvo u)arenxf to1lpDelu ol() 2toxmpnu1am nmivsl()arra(mp;t1olx io3tls m el( s t0 leoxo iatoa rlies t0trxmiopou1omt  ivtlt sDumxm oo4aex mocils m umumo u) rxrmr oy1lpDelnvi s0srtoim3iydalee nes s s2rrurpnt0ape  oeild s2emnmo u) lxrif3oo1fmt luei;t0setmxopoydlptnlnct (f rrauro;u0tetoiietatlm elnvs;u)teenxr iydlpteanvils t2tm(rpiydomenlnciltfartm(r ot1tpeoiieiat a ulnvsn(0artoxfcoy1oat an ils0seurir3iodamtn ncsasfs2uaump;t4altniietldfa2ul(vp (0 rxnxr tatfatr ivo;s)tetoio nu4ame mfei s arrau oou4tleo i3iltlaDrluvo;(0texrmr3totla e ies;(0seuoirpiy1om elict ( arrmurpou0tex  i3iydfaDean p u0tleoir oatfmDeaivo () 2urirpny4ll   ieslt srtrxr ;u1aee iiciysls emn s () exoxo3oatlpDeluvil(0 rxmxmpnodllenmneia()s2umum ;t0alen ieiys a2raumonu4trenif ta1fmtelnvs (0texoxm3iu1alt mivils arrru  nu4tee  ietadlsDraumo;(4aetrxociodfp  anvs;t)srur(mpio1ol nmncias) Dtrx  ;u4aleo ociytls2rl( s u) lenir3todlat  ueils srxo(m3nudllt licia()a2tr(r ;u0tlenmiciadls rln on()alxrxfcoytopt lnvs;(0srumxopno4omenmivi t) rumumpnu1oex  fciadfa ulnvpnt4areoxr3iy1oat  ieol(0 2urio3io1ome  nvi t)a2uaum nt0tpeo oeiysfs ranmp t)tlxomo io1fmDeaies s srum(m3oo4oleelicil( s2raumoot4oeeomf3tad s2uauvonu)aexrmo oo1fpteanes;s  eumimpnu1om emfcsa()a2ururo;u1aptoii3tld s rmu pnu)aetoir3tadlmDranes ()srtr(o iu4ll  lnci ()s2tax pou0tptnmoeils a2ul( p u) leomfciatoate nesls seur(r3iydom  lncta(  2trumpnu0aptn f3iltla2elnmp;u) rtrmrciatomt auvo t)s2xrxm3iy4lpeelfvi s) Dumxrpnt0ope ifciyslm umnvs;(0 reoxrcty1opDr nvols  rtmir3iydlptn nct t  rrm(rp;o1teeomoeiyt m umu s u0teeoifcoodfm rauvi t0srtoxrpny4lle lfvtls arrr( ooo0tpx  o3iatlmDea( p;t)alxrmocoy1optelu slt)teto(o oudamt miesa( a2urx  ot0oeenmfeiyd a2um( sn(4altnmf3ta1oatrln i;() ruo(r3iy1amt livsl(  rrrxm ;t0teenmieiltfa eauvsn(0tltnif totfp e ivs;s) rtmir3iy4llenmictl()arua(ro;t1tltoioctld m2rmn s (0tetrio3oo1lm elu slt) 2xriopoodalt lici tfa2ra( pot0altomi3tys mDrlnmo;t4 reoxr oo1fpDr i s;s0trxoxm3oodop e nvtlt arurum nu1tetoii3tyd a2ran s;t)artoif iatfmt luei t truoxr3nydopenlfcsl( sDtaxr ;t0ope  i3iydlsDem( p;u) ltoxoctydfmD anvs;( texmxm3oy1ome mfcsa( s2tax  ;t0tpto feiadfmDrlnmonu4tltnif3tydlmtraiei t) 2urxr3ny1am  lnvta(fartrxrpot1tlx ii3iydlsDea(vs;t0 leoio3ta1la e uvols0 rxmxo3iu4olt mfci (  2tmxm nu1ale  o3tys sDumnmp u4alenmf oatop   uvs s  2xo(o nodll   ivt (  ruax oou0alt  oeildlaDul(vsnu4 exrxo3todla   ivolt0sexm(rpnodom   ivilt  2tru pot4apxnmf3iyslsDuluvpnt0tetnif oytfa   nes;t  etrio nudolen ncilsfaDum(mp;t4tet  ictat a2rl( p u0artomr3oytla eauvi t)t2trio oo1lpt livi t arua(m nu0oet  f3iat m2elnvont) renif3ty1latrluvi t  rxoxm3no1openmfvi t  2taum ot0apxnmfeiydlsDrlumpn(0 eeoxr oatla r ies t0 rtoimpiudam   fvi tf 2tmu  ou1opeomoeiysfsDranmo;t0 lenxo3oadoaD auvo;()srumirpiu1omeelnetat aDtax  nu0oltomfeiat a2emn ont) etnxo3oytfmtrlnei;s)srtoio3no4ap emnet s  rta(m ou0aleoifetlsfs2umnmpnu4 lxnio3io1fptrai sls0 2xmir nu4apt lieiasfs2uaur oo4texo oetasfm2ulnmo ()trenxo3todlm rlivi;s  2to(opoo1aleeliet s sDrm(r oo1olx  fciytfa eanmsn(4arermo todopt  neo s t2umxrpoo1ll nmncils  2rr(  ot4ape iiciytlmDul(mon(4 eeoifcoadfat lnes;t)trxmxr3oodamenmnviasf 2uaxmont1tpenioetatfmDuluvs t)texoif iy1lpteln o;t0setrxr3oudomte ivilt  2uru oot0aeeo fciltls emnmp u4 rxoio3iydfptelnvil(  2umim io4llte ivsls arra(r ou4apeomoeiysfaDrm(vpn()aetoxoctadlaDe uvo t trum(m3ny4lpeemfctat)a2ta(  ;u1optomoeilsfs2rl(vpn(4aetoxf3totlate uei;t) rurxm oo4oltnlnei sf 2ururpoo4oetomfcildfs2eaumpn(4aeenmr iy1oatrai o s0 2toxm3ou4ol  lfcias  2rmxm ;t1ape mictas aDum(vp (0texnif io1la elivils0seuoxr iy4optemivtlsfsrrmu  ;u1tpxoio3tlt m eluvp ()arxnxrctodfmD lnei s0t2toxrpnodap emfeiatf rtru  ;o0olenmoctydfm2umums;u0aexrmfciodlpDeanei;(0truoio oy4lltnmfesl(f Dtmum nt4apt iociad sDemn o u4trtoiocia1fp rlivo;( teum(r3oy1oleelfcias)aDrmu ooo4oexoif3ilt a2ulnmp t)arerio3todlmDeaneo s0t2uoim iodaleelivs sfaDtm(r ou0apto fciyd aDul(mo;(4 ltnxfcty1fmtr nvols0trxr(o3oy4ap elfeilt a2uau  ou0oexn i3iltfm2em(mp t)alxoifciotfmteaiei t  2xoir ou1lm nmfes ( aDuaumo;u4aetn feiysla umums;() leoxrctotopDeln sl(0 rur(m3oydom  lics t a2uaxmpoo0aetoif3tld m el(mp;(4 ltrmfctatomD liesl(0truo(r3iy4oltn fvtasfsDumu  ;o1alx  oeiadfs2ran p;(4tlxnio3ty1fpteaneolt)trxmio ou4ape  ivtltf Dtru  no1aleomfciys s2emumo t4texrio iotoaDeli o;t) 2umir oodom elnci tfarra(ront0texn i3iatla2rlums t) reriocia1fpDrluei;t0srxoim ou1al e fcta( sDtau  oo4alt ifetatfmDul(vpnt0 ltrmf totom   uei;( srtrxr ny1lleelnct s  Dtrurpou1alen octadls2eau s (0aetoxr3iodfp eluesl()seuoxm nydaleelnvt s)aDtaxmpot1aetn f3iltfa2uaump ()arxrmocoatfpDeauvs;(0 euoxmpnodom   ivtls) rra(mpoo1tpenmi3iasfaDrm(vp u0tltnxfctodla eaneo ()trurxm oo1lmtemfvsls aruru pno1tlx mfeils a em(vs t0arenxf3oa1fmDraieils  2xmxmpiu1lleelfcia(f Duaumo;u1oexomoeiysls2uanvo u)aeerxo tadopDe neils)sruoxm3nydllt mnetlt) Dua(mo;t0oeenmfciltfmDem( snu)alenio3oy1la elu i;t0texmxrpiodll emnci sfsrtmx  ;t1aexoiociat mDranmsnt)texrircoadoa rln o;s s2tr(rpno4lm nlicsat)a2raxrp;o0apenmietldfs ul(vs;u4 etoif iytlmt an s ()trxmxopnu4apee feias)srur(mpno0oltoiieiatfmDulnvs ()aleoircoytom eau s (0setm(m no1oleelfvsl()sDumuro;o1tpxo octltfa rm(vs;t)tlxrircoy1opD luvsls)t2trim3iodope  nciltf Draumpnu1opt io3iasfaDea(vo u)trerifcoodfat  neo ()s2tmxmpnudolee ietlsfarta(m ;t1tex mfciltfa2eluvsnu0 exoif3iydfpDelneo;s srumxo3oo1lle lfci s) rtaxr ot0apto i3tldfa ea(vp;(0arenircio1fmD aivilt0srxm(opiudolenlnctlt  rraur nt1tltoifciad a2rm( s ()alxnmf oa1oa rau s ()seuoxrpio1am n iesat)srtrxmoou4aptnmfciasla2rl(mo;(4alerifciydfpD lnvs;s0 eto(rpoy1altn fesas  ruru  nu1texo i3iatls ra(mp;t4aeenmo tydom  liei;s) euoio3oydomenlnetl(fs2umx  ou0apxoifeiydlm2rm(vp (4aeeoxo tydopD  n o s0setrxopny1lmeelfetas  Dra(m ;o0tpeniociasfa uln on()texnmfcoa1laDean o;s0t2uoiopou4amtnlfvt s)sDtm(root0alt if3tys a umn ont4alxoxo3oy1omtrln i;s0srtmio iodlp elicilt s2ua(mo;t1tee  ociltlmDuanvs;u)alenir3iy1lat  u ol()srtrimpoo1lpe mncta(  rtrxr ;o0oexoiicilslm2ra( o;u0 rxoir iotomDran i t) 2xm(r nu1am   ncias  Drmxmoou4oeen f3tydlm2rlnmp t4 lenmr ootomte ieo s0teto(r3iu1apt miei t)s2trxr oo0tltn feiatfaDeln ont4tetnmr3oy1lpD livslt t2uo(m oudol  mfeiltf rtrxmo;u1tptomi3iyslm rauvp u)alenir totfpte nesls0seurim nu1apenlnvta(fartmurpou4texo ieiatfm emnms;(4texrxrctadfaD aieilt)seurxrpiy4olee ncia( aDra(mooo0opx iiciydlm2rl( s t0arxoxfcoatoa eluesls  euo(o ou4lpenlici (fs2ta(  oo1oltomi3ils mDran o;()tetoiocoa1la  aueol()trtrir ou4lpenlfvtat srraxm ;u1oexo ictatla ua( p u)aeenxr3to1lptrau s;(0t2toxrpnydlm  lictlt a2uru p;t4olen o3iytlmDem(vp;t0alxnmr3iotfatr nvo ( seumxm oy4lltn nciasfsrtmxm no1tpx  feiyd s rl(vo;u)tetoio3oadfmtrln s t0seuoirpou1aptnmfvtltfsrta(ro;t4tlto feias m2ra(vsnt4alenxrcta1fa elu sl(0t2toxo nu1am elicsatfsDuau pno1aet ioeiyd s emu p (0 ltnmr ta1laDr uei;s0 etmirpno1ll elfci t)s2raxmp;t0tlx ioctlsla em(msnu)tlerxfcoo1lp  aieslt0t2urio3oodap  lfvi s) 2trx onu4oetn icias a um( o;(0trxomr3iadfmDrlnvo;(0t2xm(opoo4llenlneiltfaruaxrpno0opt moeiatfa2em( ont)tltnxocoodop rluvi s teumiopnodolt mfciat) Dra(m no1tlto i3ilsfmDua(vo;u0 lerifciytoa  livs (0srxmir io1omt lnvi sfsrum(mp;o0oexoii3tlt aDua( pn(4tleomr iodopDrln i () rum(r3oo4opte ncsa(fsDtrxmpnu1tpx  f3tls mDraumsn(4 rtoir3iodlmtrlivilt0t2toxopou4omtn feslt)aDurxmp;u0texnifcias a rm(vs;u4 ltoxf3iotomDeaiei (0 2umim io4lp   ietas)aDtmx p;o1oeeomo3iysfs2emu s;t0arxomr oodlpD lnvo t seurir3no4oltemicsl(fartaxmpnu1tex  ieilt s2um(vp;u4 rxrxo3todlaDeaies t0texo(opoydoltn ivt s) rtmump;u0aeeniictydla rmnvp;u0arenmociytlat  n s s0s2um(opoydlp nlfvtat aDrau pot4oetn ictltla em(mpnu)tltoxf tatomt luvilt t2xoir3nydame lfctls)aDur(  nu4aptomf3ils m2ul(mp u)aeerio3oatomte uvo;t) etoir iodlme  nvt s) rumxmont1alxn fctld mDuau p (0tetnmf3iy1lp ean i;s0sexmirpnu1lp nlnvilsfartm(  ;u4olxn ieiad a ra(vp u0arxrmf totlm   u s;t0tetoir nu1omtn nctasf rrrxrpoo0oexnmicilsfa em(mo t4 exrmocty1laDrau i;(0srumir3ny4ape  ivsl(farrau oou4teeo ietysfs em( p u4 rtoxrciodlaDeanvo ()seuo(opio4altnmict sf rrrxrpoo0tle if3tls sDrlums;(4treomfctydom eluvsl() rtm(m3nodole  nct s s2tr(mp;o4texnifciysls em(ms ()altrxfciatlat an il(0trtrxm3iy4lp emfeils  rtm( ooo4apeomoetydlm2rmnms;t) ltomr ty1fa  anes t)srumxr3ou1lp  licia() Draxmont4alxoifcildlsDran o;u0 ltrmrcoydopt au s s s2urxm oo4amenmfcslsfa2rmxr no4tpx  ieiltlmDra(mpn()trenxf3tatoa eaueil(0trxr(m3oo1amt  nvs (fsDrax  ;o4apt  ociadlsDuau pnt4arxomf iytomtrlu slt s2xrxr3oodlmeemnctl() rtau  ot1aleo ociad s2ul(mp u4texoio iatlpD lnvolt)s2uoio3iydopenlnvil()aDtaurp;t4ope moctld m rlnvonu4tlerxf iadlpDeaies ()t2xrirpiu1ole livt ()s2ta( pno1tptn i3ilsfaDemuvon(4aexomrcto1lat ln o;t) ruo(opio4ameemnvias sDrru  ;u4tpx  f3tyd a ul(mo (4aetrmo3oytoatelueil( srxmim iu1aleelieias  rrm(moot4texn ietaslm2rluvp () eenxo totoaDranvo;(0srum(m nodlptemnci ( arta( poo1teen ieiyd m2ea(mp;u4areoir tydlmDrlivsls)srum(rpoydomt mfcs t)sruaxm no4alx iieiltla umnvo t0tleomf3iydlpDr n o;s)texrirpnu1ll elfvs tfsDtrur ;o4aeeoifeiltlmDua( onu0trtrxf3iatlmtrlieils trxo(rpiy4lmeemfci t)srumxmonu0opxomoctlslm2eaums (4areomr3totomDe i sl()trtr(o3oy4lm nlfvia() Dtau pot1opt mi3iytlm2ua(vpnt0trermo ty1op e u s;t t2xr(rpnydlme  fvtlt  Durxmo;o0tpxnifeias m emumo;t0artnmr3tytlatran s;( seurxrpny4olen ivslt sDraxro;u0tptoiieilslm2ul( pnt4alxomr ty1lmDr nvi () 2xrxr3io4omtnmnes tfs2taur ;t4aex ifeiydfm uaumsn(4 rxoio3iytlp r u ils  2uoxr3oodam  livt s s2taxr ou4tpt iieiad a uau o;t) ltrmr3tytfpDrau i (  eto(mpiy4ol  lfvi (f Dtm(  nu4tltomoeiasla um( p;u0trtnxo3oodlaDeauvi;() rtrxm3iydap n fesls aDtmur ot0alxn ocils s ul(vo u)alerif3iydfmDeauvi ( texo(o3io4opee nct (fsrurx oou0oltnifciysfaDelumo;(4tlxrifcoadoa  li i s s2tmio3nudaltnmfciatfaDtau pnt4olx mfciat sDrln o;u0 lenifcty1op eaneo t  exmxo iy1aptnmieia()s2um(r ot1aet moeildls umump t0aetrif3todlm r ivi;s)t2urimpno1optelicia( aruru pnt1oeeomfciydlaDrlu s;t0tlenxrcta1lmteai olt0 etoxmpnu4ame mnci ( sDtm(rpou0tpe  oetys sDumnmont0treomo3iotlpte ivsls s2uoxmpiodol nlfei tfsrtaxrpot1tetomfetadlm2ul(vs;u)alxomocio1optrlnvilt0s2trxrpnu4lmt mfvt t) 2umur no4aeeomfeilslm elump t0alxnmoctatfpD lnes;( truoir3iy4lp  lfcsa(faDrm(mpnu0tpx mf3iytfm um(ms;t4 rtomf3ta1fm   uvo s  eurirpnodal   iet sfaDtru pou0opeoiictadfs rm( pnt)altnio3ootlm  ln i t)t2xoxopoo1lpt  fvsltfsDuau  ou0oet ioeiadla2uaumpnu0trermr iy1fp e uvo;s) etoxo iodam   nciat  2tm( o;u1aeto ietldfm rlnvs;u)trerircoadfptr n o;() 2xm(o oodlltnmnctat) rrr(  nt4tetomfetltls rmuvs;(0alermfctotla rau olt)srxrxo iydame  fvslsfarur(mp;t4tptnmoctld s2ra(mpnt4artrio iy1omDeaiesl()t2to(o no4om   ivtlsfarra(  ;u1aleniociyd aDrmuvp t0 lxnxr tydlpte ies;s0trxoim3iy1optelnctat)a2rru oou4altn ieiatfs umu s u4alerxo3iatlm  anvils)sruriopny1ol n ictlsf 2rau o;t1tpxomi3iatls rm( p;(0alxoio3iytla rlnei s  etrxrpio1lm   nvsa(  2rau oot4teeo oeiltfs2ulums u) lenio tytoateaneil()setoim3oudapte fetlt a2trxrpoo0oeenmi3ildls2eln s t) rxrxrctotfate ivilt0srum(rpio4ap   iciatfa2tm(r ;u1tptomiciytfm rl(vpn(0aexrxo3iadlpD lueo s  rxmxo oy1ol  lfei s sDurx pot4aeeniictysfs2uanmp;t0 eerxf3ty1late u o t trum(m nodomtelnei tfs2umx oou4apt  fciytfs2umuvo;t4aeerio3to1faD aies;() 2tmxopiu1llteliei tfartau o;o4apx mo3iat m ua(msnt)alxnxr oodfmtelieo;s)t2xrim3oudol  lnvs s  Duaxmpot1altnmieils mDemnms;t0altrmf iy1lat  ies s)seum(o3nu4ope  nvtat)a2umx  ;u4tpe mfeiadlmDua(vo t) etoxo tadfmte i olt)s2ur(m3io1lle mnctat) rrru  ;t4ape ii3iadls elumo () rtomr3to1fa eaies;t tetrxr iodal n icsa(f 2urxmono4optomoeilslsDrmnmpnu) lxomf ootlmDrlnvo s0 rxrxrpiodll elnesa(fsDrm(ro;u0tleniociltfs2rluvpnu4areomf oodopDelivi t0teuoio io1llte feias sDtrur ;t0tpx  o3iytfs rln p (0tlxomrcia1lmD luvslt srum(r oy4alt  nvi () Duaxmpnt1oltomi3tatla2rmu ont0alxrmf3io1fp  lnei;(0 2xrxr3iodlptemics (  Dtr(moot1tltomfeildfmDrln p;t)aeeniocoadfaDr ueo ()s2xr(m oy4lpen icsl(faDtr(m nu1tlx mf3tlsfa elums;(4 rermo3oo1fmD ln il(0setoim oudamt  nvi s)aruaxmoot0opx ifeiyd m eanvp;t4trxomoctytop r uei;s sexrim oo1omeelivt s)srtaxront0opx ifetydfs2emu onu)texoif3iy1lm rau s;t0t2xrio3iydlpeemfeils)artm(ront1oet mieilsfaDrlnvp t) rerxo oydfa rluvs;t)t2uoxm3oy4om emivils  2trxm ou1oeeoio3tat m2eanmp;t)arxnmr3oytlpteli o (0 eumxmpoy4lmt  iei s)srrmu pno0olt ii3ildfs2ul(vp t0 rtrir3to1fmt aivsl(0tetrio3ny1ame lics s)aDtaxmoot1olenmieiyt s2ra(mo;t4 lxnirctatfmDr ivilt0 2urir3ou4lmtelfet (  Dtrxr ot0oeeomf3tat mDuan o u0 lxoifciodfate ues ()s2xrxmpny4alteliet s artmx oot4apx  ieiysfs2umu s;t0 etrif3iadlp   nei;t) euoxopiodlltelfvi t s2raxmpot1aex mf3iasfs2ulnmo;() lenmr oy1lptraueo s0 exmiopou1omenlncs t) 2umurpou4optoiiciltlm2rmuvs ()trtrmo3tytfm r u s t0t2tm(o3no4aleelivt (  rrmxm no1tltnmoctytlm2uau pn(4aeerir iatomD aneslt0setoir3iodap nmfvil( sDtrxm ou4texoioeiyt aDuau pnu4aeerxo iytlatraneslt0t2tr(r3iy4apt  fetlt a2trxmp;u4apxniieiyslaDum(msnu0texnifcoytlp  lu sls)trto(r ny4lmenmfcilt  2rr(r ;t1oetnmiciydfa2umu s;(0areoxf3oodopDr nvil( texmxrpoo4am nmfvi t a2ur(rono4tpe mi3ildls2ul(vsnt4teerirctydfa  aiei;(0 rxo(opoydopeemiet s) Durum nt1tlen octysfa rlnvo;t)trtrifcoy1lmt  u o;() rxoxo3oy4ol  lncta( a2rrxmpoo4oeenifeiysls2uanmpnt) ltrirctydla eaivo t) etmirpoydop nmivtat) rrr(r ;o0tptn i3ilsfa uanmo t4 rxrir iytomtrlnvo;t teumir3ou1ll emieils arum( pnu0tlen fetlt m rlu s u) etnxfctadfpDeauei s truo(opoodame lfeilt) rta(roou4tpx  iciad sDulu pnt4trermo3ootlaDr nvi s0trurxopny1amtnmiet t srumuro;u0tleomfctlslmDemuvpnt0texnmfcia1laDr ivols trxoxrpoy1omenmici ( s2um(r ;u1tleoii3iasfa2eau p;u0aetoif iadlmt luvi t  exo(mpiu1aleelnciat aDurxrp;u4aetn ictlt a rmuvs;u4aexoxocto1fmDrai i t) 2xr(opiodlp nlfvi s)s2urxm ;t4oetn octld m2ea(vo;u0artnmr3oydlm rau o t0s2trxm3nudop  lncsas srta( poo1oetn i3iysfm umu p;t0aetnircoydlaD anvil()sexm(mpnydome  icilt)arrru oou0tpe iietlt m elumonu0aetoir3ootop ran s;s t2xoxm iu1opt mnvtltfarrrx ooo4alto feils a2uluvs (4arxoxfcoytom r nvi;s)trtm(o iu4lmenlfetl(f rum(  ;o1altnmfeiat m2uaumpnt0 rxoir3oydfatrlues s) rxoxr3ny4om emnvs sf rua(mp;t1aetnmf3iltlaDrl( pnt4texoif tadfaDrluvi;s)setoirpoy1llenlfci t aDraxroou0opxnmieiasfaDemnvo;t4areomr tadopDeln i;()t2xo(r3iy1lmte nvi (fartrxmpnu4olt iictld a2um( ont) rtrir3oy1lmt li sl()t2tm(r no4lpe  netlt)a2taumo;o1apx  ociyt aDumuvs (0alxoxfctadfaDeliei s)sexrim oy4ale mncslsfsDta(r no1olxo f3iatfsDran snt4 rtnif3iadop  lnvi;s srum(o3iy4ape livslt) Dtmu  ot4tptn oetldfm rauvpnt0aetrmo3oo1fm elivo;(0trxmim ou1ole  iei () Draxro;u0tlxnmietatfm2el(vs;(0 etrxo ia1lmD lu i;s  2xo(o oydop n feil()artrx pno0ope moctatfm2ulnvs;(4trtoxociotlm rln o;s trxm(m iy4lm   fesat  2raur ;t0tptnioetaslaDea( o u)texrxr3oydoaDrai o;s0 ruoim3io4lp  lict t arurumoou1tptoifeiasfaDumnmp;(0aeeoif iadoaDe ivo;()sexoimpio4lptnmies sf rrmu poo1tltoifctad m ra(vp;()arerxo3oy1om rai o;(  2umxopnodape  nci (f Durxrono0tpeo ociyt a ua(mp u) ltrmfctadom eanes;s) etmxopny1ope  nvtls)a2rr(r ot0oleo i3tytfs rmnvpn(4texnir3oadom ean ols s2umimpiu4lptelnct sfsrtm(r oo0tlto iciyt m ul( ont4altoxocio1lp  auvils)texoxr3iy4llenmivsls) ruaxro;t1opxomociyd aDrmnvp (0tlxoxo oytfa r ies s  rxm(o iudllen icsatfsrurxmp;o1oetn fctltfsDumu s;t0 exrmfciy1op   iei;(  exrir3iy1om n nes ()srrax onu0tetn ieildls2rauvp;t0 ltrio todla r nvil(0 2trxr3oy1ol nlivs (fsrtmxr nu1olxomoeiaslm ranmo t)tltoxf3oa1om rlueslt0 rtoxopiudole  ict tf rtm( o;t1olx mietldfa2rluvsnu)tleoxfctydfaD lu slt)srum(mpiudol emiesas  2tmu poo1tpxomieils m emnmpnu)tlxnio iy1om e ivolt setmxo3iudale lnviatf 2tm(  no0oetnifctad aDrm(vpn(4arxnxo3tydomt aivs;(0sexrxr no1omtelnei t)sDrm(  ;t1apx mf3iltfa2rmuvo () eeomfciytfp   i ils0 rtmirpio1amee fcsltf 2rmxrp;u0alt  ociadfsDraumo ()arxnio3to1la ran ils)seumio3nu1apeemictasfs2ra(m ou1tlxnmfeiydfa el(mo u) exrxrctadfa rluvi;t  rtmxrpiu1omtnlneslt)s2rrx p;o0oltomiciaslm2emn p;(4aleomo3iytop  aies s0 2tr(mpiy1apt  fvi t)a2rauront4oleomoeiltfm2rl(mo;t4tetomrctotoa rlivs;(  rxoir3oo4alenmiciasfaDumxm no1oex mietld m ulnmsn(0texoxo oodfa   uvi (0t2tr(rpnodaltnmivtls a2tmxr oo0opt mocildfmDem( s;t0 renxrcoy1oa e ues s0 etr(o3oy4ol  mict () 2umxrpou4oeto ietldfm2emuvs t4 exnircoydopteaieo s seuoimpnodlm e nvs tfsruau onu4tptnifciydlaDea( p;u0tltoxocoydopD lueilt) etrir3nudlleemiesasfsDuaxmooo4aex mociyt a elu s;u4 ltoifcoodlptrauvo;t s2xrxrpno4lpenlfvs sfsruaxmooo4oexo o3iytfm2um(ms t0arxrio3iotoat  neo s  2toxrpnydopt  fciltf ruaxro;t1aeenif3tadlsDrl(vp;u0aetrxocoo1fateaiei t srxrim3oy4amt  fet ()a2trurpno4aptoii3iyd sDemnmo;u4tltoxf3ootlmt anvs s t2xmiopno4omen ivsas)arraumpnt4aptn i3tldfs2um( o t4arxoxo3iodoa rau i;(0seumxo iy1llt  ivs t)aDtmu o;t4alt  fctad mDrm(vs u)tltomocootom r nvslt teurirpou1lme lieta(  2tru pou4tlx ifcild m2ulnms t4tleoxoctadlatrli s s  rtm(opio1ol  lncs s  2rr(r no4aleo feiatla rlnvpnt4alxrxr3todlmtr ues t sexmxo oodlpt lfetas)srrm(mpou1tex mieiysfs2eln s t4areomo3to1lmD lnes;(  2uo(o nu1oleemnvi t srrrxrp;t4apen o3ild m rmn p t)tlxrio io1opD luvi s0s2xm(r3oydol  mfvtls)sDua(mp;t1aeeoifetltls2rauvo t0tltnmo3tadlp rluvi;(0trxrimpiu4ome  fes t)aDtau  ou1apx  o3iat m elnms t4trenxocio1omD aiei t)seuoir3oy4lm nmnvta( aDum( oou0tlto ieilsfm2ul( p u)tleoxo oy1oat ai o s)trurirpny4llte fcs sf ruauroou0alx mi3tls s rlnvp;u) lenif ootlaDrauvi;s0trtmxm iudom  livsasfsrtm(rpnt4aetn oeiadls umnmo;t0trtoio3ia1fmteau ols) rumir3iudllt  fesa( sDurur ou1opxomociydlm2rmump u0trxoxr3oodlp  lneo;(  rum(m3iydapee icias sDraxmont4aetoiietadlsDuluvo t0tltnif3iatlmDr u slt)t2umiopio4ol emfvtl()artruront4opxoioeiyt s rmnmpnt) exrirciy1lptr n il(  2xoxr oodape mnviat) Drmu ooo1olt  ociad s ra(mp;u)trerif ta1lm eln slt0setrxo io4ale mncsl( a2tau  ;o0olt io3tltls ulnms;t)arerxr oa1lpt anvs;(0t2ur(m3oo4amtnlfcs s  2urxr nu4optoio3iat s2rmumonu)trxrif iadfp r ues s)sexrir3iy1am n nciat sDrau pno1aeeo o3tyd a el(mont4tltrxocoodlm   i sls0srur(r3iodal nlneta(fs2um(mont1tpto fctys s ra( on(0 lxriociydlpDeau olt)texm(r3no4llt micsa(faDurumo;t4ape ii3tatfsDumn s t)tetrifcoo1fmD livi;s0sexoxr3oy4oltnlfesatf 2um( ooo1tlt if3iyslsDea(mon()aexnmo iydfm  auvo;s s2tr(r oudam   net s s2umx  no4olt mocilslm2rm( s u0alxoxr iy1fptrai i;( srurxo oydlp nlnctl() rurxmo;o1oee micildla ulnms;()tlxrir3oo1omD auesls seuoxr3oy4lpe  ieils)sDrmur no1ale  ietls s um(ms;(0trxnif3iotla  lieils0texoxm oo1optnmncias s2tm(rpoo1teeomi3iydla2elnvpnu) ltriocoatfpt ai i;s trxo(mpoydapeelneil(farrrur ;o4oex  octad aDuanmo;u0 lxnxr tadlptr n i;(0tetoim no4lpe lfci s)arurxront4tlxnioetltfm2rmnvon()trtrirctytlaD  uvs;s  eumxm3nydlptemfet (fs2taxrp;o1tee moctas m eaumpnu)aleomr tatlpt ai olt)srxrxr nu4alte netlsfsrum(ronu4oltoiieils mDra(msnu4 exnirctadlmDe ieslt0sexo(o oydam emnvt t)s2ta(  no1aeeoii3tydfm rm( snt)aeeomo3iodfp eluvi;()trxrim3oo4lm nmfct s aruru oot0openmoctys s2ra(vpnu)tlxoifctatlpt anvs;t0truo(o3oo1aptelnesls) Drm(m no1alxn ietat a rlumo (4tlxrmoctadfmte uvolt0s2tm(m iy1aptnmnctl()sDrm(  ou0altn o3iasfm2umn sn(4 ltnioctadla e nvi s teum(o oy4llt lnci tfa2uau pnu0apenmfeiydfm2rm(vs;(4tetnxo iadoptelnvil() 2trxo iudope lfeilt) Drmu  no1altnifeiad mDul(von(0aeeomr3iy1fpD lneo;s) 2toir nodom   nvtat)srrmu  ot0aex ioeild m eanvsnu0artomociodlmDrai o;()teuoxo oy1lpt  ieiatfs2um(  ;t1aetoioetatla umu pn(4texnmrctytlp e u il()t2tmir3iu1altelfvt t aDrr(mpnt4oeen fetasfa uaumo t4aetniocoy1opDeluvsl(0seur(rpiy4apt micsltfsrum(rpnt0oex  oetlt a2em( o t0trtoxo iatfmt  ivslt  rtrxo nu4om nmfcsl(farra(roou4alenifciatfmDrm(mo;t)alermfciodopteanvo s  rxrxrpiodlltn iet sf rrrxmo;o1aex ifciltls ua(mon(0tlxrmr to1oa   nvs t0 etrir iy1llen ivilsf Dur(mpot0alen oeils m el( o t0artnmrciy1om eauei s  2umxm io1om   fvi s)sDuaum nu4teeniociltlsDul(ms (4tetrmo3iytfmt luvilt)s2uo(r ou1apt lnvi t sDtmxmoou1aee mf3iysls2ul(mo;t0 ltrxr3oydopDeaueo;t)srxrxmpny1lmen ict (fsDuaum nu1texoii3tatlm2ul(mp t) lenmo iatoaD aivs ()trtoimpoydap elfesl(  2raump;t0oexnmo3tlsfs em(mpnu4aleoir3oa1faDeaivo;( srtmir3no1op emivi s)a2umu p;u4ole  o3iysfs umuvsnu)trerxo oatfmt lueolt0t2xo(mpiu4amenliei (fs2ur(mp;o4aeto f3ias mDumn p;u4 rxoxo3oo1fa  anvi s0texrimpoudam emictlt)artrxrp;o4ape io3tls aDrlumo;t) ltoxf3iatlpD  u il() etoxmpoodope mfesa(  2uaurp;t0optoifeiltfm2rluvpnt4 reoxf oadopDe i ol( t2xmxr ny4olenmietls  rta(m ;t0aee moeiys a ua( s;u) rtrxf io1oaD aieol()srxr(mpiu4amte neil(  rrm( poo4oexnmf3ild sDem(mp;(4aexoxr3oytom   uvolt0 etm(m iydlle mnvsl( s2taxr oo0oexnmictld s2rlu p;()tltnxocty1omD  nvi (0t2umirpoy4ap eliciasfs2rm(rpnu4openmiciysfsDum(vpnt)tltoir3oatoa rlu o;s tetmio3nu1lm  lneilt  Duaxm nu1oexnioeiydfsDelumsnu0tltrif oy1fmDraivi;()seum(r ou1lm emictat) Dtr( ooo4aet mieildls2umn on(4tlxomo tytlp elnvi (0 rxmxr3nudlmt  fetatfartaxm ou1tee  o3ildfa2uauvp;t) reomf io1lmDeli o s)setm(o3ou1aptnlfctatfs2tmu onu4aee mi3tldla2rluvo t4aleomrctatop   uei (  2xmio nydal nmnes s)s2trumo;u1apeo oeiadla rmu sn() etrif3oadla eluei;t0s2tm(r3oydalen nvi ( srurx  ;u0opxomi3iasfm ra(msnt) rxnircoadoateanvo ()texmxr ny4openlivs t s2urxr ;u4tleoiiciydls elnvp u0tetriociodfatrlueol()s2tmio3oo4ameemictl( artrump;u4alenmfciltfa2rlnvs (4areoxr3iytfaDrlnvi;(  etrim3oodamt lnvtls)a2um(mp;t0ole ifctytlm rmnvp (4altrxo oydoaD lues ()sexrxo oudlpe  ietl()artm(r ot1tpe  octldfs2eauvs;u4treomo todfmte neo s) 2to(o oudap nlieiltfaDtaxm oo1tet  i3tld s2ua(mon(0teeomfcoy1laD anes t)s2uoxo3nodal  mfcil(fsDrm( pot1tetn f3ilslm elnvont4altrmocia1lm  lnesls srtr(o3iydlpenmncta(fsDua(ro;t4tpxomfctas s2em( s u4 lxrmrcta1om rlneols trtr(opiodol  miei tf rum(rpot4tpxomfeiasfsDrm(vs;t)trxrir3oy1faD auvols0 etrxr iu1oltemivil()aDurx pot4tpeomo3tltfs rmumon() etrmr3iotlm  anvi;t0texoxr iodalt micil()srumu  ;t0altn f3tatlaDum( snu4aetrxo iatfmDrlnvs;s t2xm(rpou4apen ivs t s2ta(mo;u0olxnmfciytfa2ea(ms ()arenxo3iydfm   n ols) eurimpny1llee neiatfsDtrumpno4oltnmociyslm elumsn(4aetrxfcoa1lpt luei;s  eum(rpoo1lmee nvtl(  rra(rpou4oex  fctadlm2ua( on()artrio totlp rlu i;t0 rurxrpoydll emfcs t)aDua(rooo1alxoif3ils a emnvsnu)tltrif oa1oaD ai slt0t2tm(o iydalt mfet ()sDtmx ont1aleo o3iatfmDrlu s;t)aexoxr oydfmDe u o s t2tmir oydom e nct ()aDraurpnt1aeeoifciytfmDemnvp;(4tltrxf todopDrli o;t)sexmxm nu1amenmiet (fs2rmu  ot1tpx  o3iltlmDulumo u0tleoio iy1faDranvo (0s2toirpiy1lmt mieils)sDtrurp;u1aetnmf3iyd a2rmnmsnt)alxoio3io1lmDrlivs;s0s2ur(opno1lpee fcslt) 2trxmo;o4olxnmociasla2emnmpnu) rxnio3tatom  ln s;( s2umxrpnu1lp e fetas) Dumx oou4aetnmf3tas a2umnmp;u4arenir3iatlaD  nvi;(0 2ur(o3ou1lmeeliei tf rtauro;o1aptoifciytla2umnvo (0arxnio3iy1laDrln ols0trtmxo3oudlp nlietasfsDtmumont1tpxoifctasfa umnvs t)aeeriocto1la eau s s)sexo(rpoodalenmnvil(fs2uaurp;u0texn iciysfm2eln o ()alenmr3io1faDe ieo s  rumim3nodomeemnctl(fs2rm( o;o1oex mf3ils m2eaumpn(0 etrir oytfm rlu o;(  rumxm no4opt mncsltfaDtmuro;o1tpt mieiyd s ra( snu0 eenxo3oatopDe i s;t0trurxo nydam   fes tfs2tau poo4tlt iieiasfs2um( s t)artrmr3iadfm rluvs;(0 etrxmpio4olt lnet s srrrum no4tleniictlslm ean on(4trenxf3oatoptr u i t)srxr(r nydolt  ncias) 2raumont4teeoioeilsfm2uln p u4 rxrmr3iodfpDraivs ( t2tr(r3no1ape livias)srum( pnt0oet  octlsfaDua( s;t0tetrmo3io1fp  au i;( sexr(o3iudal nmnctas)a2ua(  ou0oltnioeilsfsDrmuvonu0trxriocto1op elu il( srtmxr3iodllt lnet ()s2urum ;t0tpxnmocildla2ul(ms u0tleoif ootom rlnvo t0setm(o io4apt mivsasf Duaur ou1texn f3iltlm2ea(vo;(0 ltnio3oatoatrlivs s) 2uo(m nu1lmeelivtlt aDtr( pnu1oeeo feilslsDumuvp;(4 rxnio3tatla r uvi;t seurxr iodoptnliesat  2ta( ono0alenmi3iltfs ea(vpn(4aexnxf3iatopt lnei ( t2tmxrpoy1lle lnvtlsfa2raxmpnu4tee iictlt m rl(ms ()alxnmocty1omt  n o t0s2trimpoy4olee fcias a2rru p;u0texoii3tadfsDeanvp;(0arenmrciydfateanvs s tetmiopou1apt mieilsf 2tm( o;t4oee mf3iydlsDel(vo t0aeeomf iadom rluvo;(0tetoxm io1op elieilsfs2trum nt1opxnmfctysls2ulu onu)aeenxo3todfa r n o;s  eur(r no1al  mnct t srumu pot4oltnmoeiadfa raumo u4texomo ta1om eaivs t)trur(rpiu4op e ictls)s2trumo;o4aee ifeiydfs2ua(mp;()artrir3oy1lp r n s;t) euoir3oodam   iciasf ruru o;t0oex  i3tatfmDumn p (4altnxrcio1omt livo;(0 etoxr nydlptn ncs ()a2uru  ;o1tlxo fciat a ra(vsn() rxomrctodfm r n il() exrxrpou4am e fvi s) rtm(m ;u4aet  feiatla uanvo;u0trtoifcoytoa rln slt  etrir oo1lm emics t) rrrxr nt4tle ifeiyt aDeanmon(0teermfcoytomteauvo;s)s2ur(r nudap nlfes ( aDurum ot1oltomiciatlm2rmump;u0aetomfcoa1opt  uvsls0 2umimpiu1llenlfeta() ruax  ;o1texn o3iydlmDemn pnt4altoxfcoadfa r neilt) 2uoxopiudlpt  fesl()s2tmur ;o0oetnifeilt mDrmn pnt4 reoir3oy1fat aivsl(0trtmxr3nudll nlicsl(faDtauro;t1alen o3tldlm raumonu)aetnxr3oydfmDelnvs t0 2ur(r3oy1lm nlneilsfs2tmx  ot0ole mf3iytfa el(vo;t)altrxo ta1optr nvol( sexrxopnudlme mnvtatf 2urumpnt1apenii3iytlsDel(vpn(0artnxo totoa  luvi s trtm(r io4al n feiat)s2tmurono1texomfctyd a rm(vpnt0artnxociotlp ran slt t2trxopiy1alt  fcs tfsDtruro;t4oleoii3tldlm2ra( s (0arxnir to1lpDeai i s trxm(r iydaptemiciatf 2urx  nt4opx iiciasfm2emu o u0tetomrcootfmt  u s (  ruoim nu4am  mfcia(fsDuaum oo4alxniictasfa2ua(mp t0tetrxocto1lpD  i i;( trxrir oo1lp  micsat)aDta(mpno0tee  ociad s um( s;()alxoxo3tytfp  lu i;s) eum(m3nodomt mnvsa(fsrrm(r ;o1aetomfeiltfs2eln s t0tleomrcoa1fa  ai o;t0srtmiopoo1apt mfvtas)s2uaxronu1oltnmfcilt s2ra(vpnu0 rxnmr tytlate i ols0sexmxm3iodomt lfesltf rta(r ;u4tpenmoctadlm2ea(vs;t)trenxf oadomt ai i;t)sexmxr3oy4omeemiesls srtr(  no4aet  feiyd a umnmp;t4 rtrmo oatopDeln ils)trtoxo oydol elnctasfsDtru onu0aeeoifeiysfs2ul( p;t0tltrxo to1omDelnei t0t2xr(m nu4lpenlnvsl() Dum(rp;u0alen fcias a2umuvp;t)trxoiociatoa rau s;s t2xrio3iu4omtelivilsfarta( o;o1tle iociat s2ra(mp;(4texrmf to1omD  ieol(0s2tm(o ny4lle mfct (  2ururp;u4texnifciytlsDel( o (0aetomr3iydfmteaues s setmxopny4amtnmivslsf 2uau pnt1alt iieildfm2emuvp;u4 lenxo3ta1fm   ivo t)s2xo(o3no4lle lnetl()srrr(mpou1tptnio3tad s emums u0arxnmoctydoat lneols s2tm(m ou1aleemncia()arumum no1tpt  f3iadfsDua(mo;()alermf3iadoatelu s s)setmimpnudam nlnesl(f Drax  ;t1apx  o3iydls2ua(mpnu0 eenircoodoa r uvo (0trum(o iu1lpt lncta( a2umxr oo0tleo f3tad mDuanvp t0teeoxo oatlpDelnvi;s)setr(o iu4openlfci ()a2uaxro;o0apenmi3iltfsDemnmp;u4tltnxf3oytla eliei;( t2xmxr iy4amenmicilt aDtr( ont0tpxn octyd a emn o u)texoio3iadopDraivo;t)s2ur(o3io1aptnmfciatfa2ur( pno1aexn o3tat mDumnmo;u0areoxfciodfa r ieo;t  2uo(o ou1oltn nvtatf 2rau onu0olx ifctydfa um(ms () ltnmf iydoa   ivs;s0trxo(opiu4alt  icsls) Dtm( oou0apxomo3ilsfs2rl(vs;(4aleoxr3ta1fptrlu ols) 2xmio3oo1apt licia(f 2taurp;t4olenio3iytfm um( o t)tlerirciydoa  aiei;t  rxoxo3iu4olt  ncilt arrau ono4tpe  feiatlsDrlnvp;(0aeeoir3oo1la  lnei ()teto(opnu1amt mnvias)sDrmu pnt0tetn o3iadla rauvo (0tlxnir3ia1latelneils sexr(mpoy4altelfvia(f Drr(mp;o1aet  f3iyt m ea( p ()aleoio3tydlm e i o;s t2trxo3iu1ap n fvt (faDtau oot4alx ioeiydfs ul(vo (4 rtrxo3oydlmDr neils trtoimpiu4ll emfciasfaDtaxm no1openmieiysfs2uanmont0trtoioctodom rluvi;() 2toim nydllee nvs () Durxmont1tle if3iydlaDea( o;(4tetrxocoodlmtelnvo s0teuoim iu1lpt livil(fsDraum oo0apxn ocildlm uauvp t4 rtoxr oa1fmtrli s s s2urio nodlm n feiat sDumxrooo4oeto f3tltlaDuanvp;t4arxrmr3iatomD anvi;s) rxo(m3iodome  iesls arurx p;u0aleoio3tydlm2ul( s u)arxrxocoodlmt lueols0sexoxo3oydlmt lnvsas a2ta(roou4oee  i3iat s2em(mo;(4aexnio3iadop  lnei t) rxoxopoydolenlfei t)arra(mo;u0alenio3ilsfm ul(mpn(4tetoxfciodopDeauvs s texmxo3no4om   nct (  2raum ot0oex mo3tlslaDuanmsnu)areoif iy1opD  ivols0srtmir iu4omtelnvs (fs2trurpnt0opeoif3tld mDrmnmsnu0aeermf oa1omt  n o;()trurxo3ny4opee netlt)s2taxro;u4opxo ietaslm2rmn s t)trenxrcty1omDraueslt0 2tr(o3oy1oleelfcsas)srtrx o;o0tlxnmf3iaslm umu p u4aetnxocio1op e i sl() 2trxm ny4lptemiei t  Drm(r no4tlt  ietyt mDuau ont0 eerir io1fa rlueo t seuo(opnudop   ivtlt)srrrum ;u0tlenmf3iydlmDrm(vp;()treoircoatlmDelu sls0t2umio ny4om nmieia( srtau p;o0oleomf3iat a emnvp;(4aexniocty1omD aueilt s2to(o nu1ap e nvt (f 2rruront0tee  fciatfa2rau o (0arenir3oadla eaueo s  rxoirpiudlleemivsatfsDtm(rp;o0oetomictasfs2eau pn(4alxnmr todopD lieil() rxm(m3iy4al emfvilt) Dra(ro;o0opx ioetydfm2eanmp;u)aeeoifctadlp eluei;t0s2xoim iu4ope mncils)s2ta(ro;o4optoif3ildfmDeln p u4 ltoxf io1oaD  i s t0s2um(opnudol nlietasf rtaxrpno4teeoiietyt s2rlu ont)aexrxr iytlpDe ues;s) rumxm iy4amenmncs t  Dtax  ot1apxomicias m2rauvpnt) ltrmf3iy1fmDraivs;(  exo(r3iudaltnlneias)artmumo;u0teeomfetytls ran s u) etnxo3oy1lm e uvi t0teuo(o oy4lm emnetls aDua(rpnt4aeeo fctld aDul(vo t)altoxr oydfmtr nvs;s)sruoio nudameemnvtat  Durx o;t1oetoif3iys s2ul(mo u)texoxrctodla  aivols t2tr(rpiudlmee nvil() 2tm(mo;t1aleo i3iytlm em(vs t) ltoxoctatfp e nvils trurxm nu4lme lictatfa2umx ooo1tpx  o3ildls rmnvp (0teeoir iydfmtrlivsls seuoxm nodap nmnvsatfa2rmxr ou4opto ociadlaDumnvp u0aetnxo todoaDrauvsl(0s2urio nudll nmivia( a2rr(rpno0tltnioctatfaDumnvo (0 lxrio iadomDr uvs t s2urirpiy1lpenmietasfaDrmur no0tee  o3tydfm2elumsnt) rtnxf iodfa e uvs;s  euoir oy1alenlfvtas  rtaxront0alx moctadls ua( s u)tltoxo oa1oa eluvs;() exrirpny4op e fei s)s2rrxmono0oet mieiasfaDrlu p;(4arerir3iodlmtr i i;s0tetm(r3ny1ape livs t)aDum(mo;t4apxomociad a2ua( s;t0trxomr3iodlm rlu i ( texr(o3oy1amtnmfvi sfs2umxm ou1opxn octatlm2rln onu)trxrxr3oa1oat  i s;(0srtoxo oo4lp n nvsas arurxr ot0opxo fcils a rmuvpnu0texrmf iytoa eauvo (0teto(o3nu4am e fviltfsrumxrpno4opto ietyt m emuvonu0 etoif3io1opt luvi;s0srumim io4ameemfctasfsDta(root0tltoioetadlm2uauvs;u)tetomrciytlatran sls)trxo(r3iydlp nlnciat)a2uax p;o0ape  ocilt m2eauvs;t0teeoxf3oydoptr ueslt)setrim3nu4alt  ivtat)a2rrurpot1tpx ioctyd m rl( s u0 reoir oatfpDe ieo s) eumim3ou1lmt  ivs sfsrta(roou1tex mfetldfmDua(von() rtrxrctytoatrlu o (0s2to(opoodomtn ict t)sDuru pou0olt ioeilsfa2eaump u0artrircto1laD anvi;s)teto(r iodope lneia(fs2ra(  ;o1oee  o3tld sDua(mo;(0aeenxf3ty1omteai ol(0trxrir oo1lptnlfvt s aDrrumo;u4tet miciat mDean s (4texnxf iatlm rlneo s0teuoxr3nydomte fvs tfaDtax o;u1oexo f3iasfs2rl( snt4tlxrmf oo1omD au ils srxmxopiu1openlivsa()artm(mpot0olx miciadls2uanmp;t)aeerxf3ty1latean i t) 2um(opnu4ol e neiat)s2umumpoo1tpxnioetasfm uau snt) rtoxf iadfpt  i o s srtmimpnudlp  mnviltf 2rr(mp;t0apx mf3iydla2rlnvo t0tltoif3oo1om r n sls0 rtoim iodlpte ivt s sDuaxrpoo4opxn f3tysla ran o;u4 rtnmfciydlpD  nei;s) rurir iydolt mfeia(f 2taxmpnt0olx iocilsfm2elu p t0aeenxr3tydfaDeln ils sexm(m3iy1lm nmnesa(farrm(m ;o4oleo o3ildlm2ulnvp;(4altnxr oydfmDeln sl()t2trio3no1ll n nvtlsf Dtmumoou4ale mf3tat m ulnvpnt4alxrio iotop e nes t)seto(opnu1ol  lfcsa(  2um(mooo0apx ifcild m emu o;t4altnifciadla rlivils  ruoir ou4om   neia()srurxmono4tetnii3iyt m raumon(4 rtoxr3tytlmDr u i s0srum(r oydam emfvtas)sDurxmp;u4tpx iietadlsDrmn o (0alxomo oodlmt lu o s0t2umimpnudop nlivt (faDtm(mooo4alx mieiys a umn p t)trxrif3todfpDrli o t seum(mpnydal nmncsat arraump;t4tpx  f3iat a uln p;u0 lxomo3oadoptrli ilt) exm(m3ou4openlnes tf 2uru  ;o0tlx ii3ild s rl(vsnt) lermfctadfm rlieilt)seto(rpny1llee ncilsfa2tax onu0aeto o3tyd mDulump;(4aetoiocoatfm raivil() euo(o3nu1lp n fctl(  Duaumoou0olx moeiys mDumu snt4tlxrioctytoa   neols0 exrxr iudapt lnvs (f Duaxrpnt4tpto feiytlm rm( s t)trenmf iotom rli sl(  2xoirpiodlptnlfvslt) 2rmu onu1tleoiociltfa umums;t0 etnmocoa1fmD  i ils)srxoxrpio1omtnmneslt srtmxrpno1ole mo3tatlm2rlnms t)teerirctotomD  nvo t)srxo(o nu4ap   fvtlt)srrmx p;u1alenmfciltfm ulums ()tlxrxo3oo1lp eau s;t0 rtmxrpnu4amt  ivi tfa2raumpno1apto o3iadfsDulu o u0aetoif3oodfpD au i t0s2xmxopoo1lm  lfetltfa2ta(mono1tlxn ietldlsDuanmpnu4arermrciotom eaneo;s0 eumirpiu4omtnlies t a2ra(  nu1tltnmfciys s2rluvo u4teeoio3tydop rlneslt0trum(opoy1aptnmfvsls arrau oot1tpe moetldla rl(mp;() rerirctadoa r n i;t0 rtr(opoodamte fcils)sDumxmpou4texnmfciasls2rlnmo;(4altoirctotoatr ieilt)setmimpou4omt  nvsat)s2rm( pot0tlenii3tasfaDrm( o (0 rtoxr3to1lpt lu ol() euoio iy1lp  lnci s)aDuaxmoou0ole mf3tldlsDelump;u0trtoxo iytlm elueol()s2xoxo nodam  lieiltf rtmu poo4alenifetld s2rm(vp;(0 rxrxf3ta1fat  uvi s) rxo(rpio1lpt  fvilt)a2trxr oo1tlt  oeiyd a2um(mp;t0 renmo3oodfpDe ies t)t2xriopnu4om nlnct t  rrrxmo;o1opto ietlsla ea(vo;u0tltrir iodfpD  i ils0trxrxm3iu1om   ivs t s2um(m nt4aexnio3tad a2elu onu4 ltoir3iytlateauvs s s2tr(r3iodom e feils)a2uaxmont4alt mfeiatfaDuan s;(0altnif ta1lm   ivo;( trxmxm3oo1lpe lfvsat)sDuaur oo0apxoifeildlsDeln p;u4 eeoio3oytlpD  n sls truoimpnydal emncs s)arur( o;u1tpx mfciyt s em( o ()texoircoodfpDraneo;t0 rurio ny1ll  lfetls) rrrx p;o1ale  f3iydfm eau p;u) rxnmocootomtr ivi t  rtmio ny1ll emnei tf 2tauro;u4opxomo3iat s rmnmp t)alenxf3ty1om r i o;t0 euo(r3no4lmt mivt (f rua( ooo0aee mo3iytla2eaump t)texnxf iy1fpt aivs;t0s2xrirpnydlmtn fvsls a2ur( o;o0tex ioeilsfa2ua( pnu)altrxocoa1lpDelivol(0 2urxrpoo1lm emieias)arrrx  oo4oltoii3tltfm2elu o t0tlxoir totom eau s t0 etmxrpou4omtelicia(fs2rm(  ot0tpenmfeiyslm uaumsnt0 lxnxo oadomt ln ol()t2to(mpou1lpee netl()a2ra( ont0tle ii3iyt a2um(vs;t0arxnxo iatfmDean il( s2xr(o3nu1lp emies (f Dtrxmont1teenmf3iyd m2eanmsn(0 eeomfcoy1fm rln sls texrirpiy4ll e fvs s srtmx pnu1alxo oetys mDumuvonu0 lenmo3iatlmDelnes s)sexmim oudape  nvsls) 2taur no1apxo ieiysfsDua( o u0aetnmrctydoa raieol()t2xrim3oydllenmfctltf Dtr(rono0oetnmi3ilsfm2ua(vp;t4trxnir3oatomD aivs;()setoiopnydomeelnvi () 2ur(mo;u4opto oetas a2emnms t)teenxr iotfm elneils0s2xmir oudllte ncs ()arrru  ;t1oet  ietyd s2umnvo;(4aexoxociotfmte u i t teuoir ny4aptnlivt ( srumumpno1opxoifciasla2ul( o () rtrmf3iytlp eanvilt  2urxo oo4ome mict () 2ur( pnt4tpenmfctaslm rauvpn() lxoioctadoatr iei t)tetoir3ou4am emfei sf 2umxmo;o4alxn f3tlsfs rlnvs;t4texrmo3ty1latrln i ()t2uoiopny1lme lnesl(farrrum ot0ale mi3iatla2ua(vs (0alermr oa1lm  lueo s0s2tm(o oo4ll emncs sfaDtau  ot4tleo i3iyd s emnvpn()trtrmr io1faD auvi;(  eurim3oo1opee fetas) rtrump;o0tpeomieiyslmDea( s u)trtrir3oodlateaieo;t trtrio3ou4om emfvtl(fa2umxmoot4ope ifeilslaDrluvpnu0 lerxo3totfpDr i o (  rumxm3ou1ol  miei t)srtrxr oo0oet mieiytla ra(msn(4trermf iydlmte uvi;t)trxmiopnydlmtelnvsl( s2raxr no0oeeo i3iytfm2rlu o u0aleoirctytopDe ueslt seurxopiy1apeelfet sf 2rmxm ;t4aee  i3iyt a eanvs (0altomociodlm r uvslt0 etoio3oy4am n fetasfaDur(r no1aeto iciys aDeanvs (0 rtomo ia1optr u s t0s2uoirpoo4ol   ies (fs2raxm ;t1opxomfetlsls2rauvo (0teeoxo to1fat ai i;s0s2uo(r iy1lm  mnesat)srum(  nt4tpe ifeias mDul(vpn() eerxr iadlpDe u o s0 rxmimpno4ome mnei ( a2ua(m no1tlx  fcildfs2rl(vs;()altoio totoa elu o;s0texmxo no4amtn fvta()a2umxm nt0olen ieiytlaDua( pnu0trtnxocta1fm eau s;(0truo(o iy1lpe  iciat)sDumxmpou1apt iictatfm rluvp;u)aeenxrctatfmt lneols)t2urir no1lmee ivsas sDumurpot0apenmoetldls elump t0 rtrirciadoa eau s;s0 2uo(o3nodaptnmfei t aDra(  ;t0tpeo oetas a uauvpnt0 ltomr3iadlmtran il(0srxrirpny1ameemnvsatfsrum(r nu1tlxnioeiydlmDranvpnt0aeenif iydfp r nei s0 2uo(r oo4am nmfeil() ruau pou1ale mf3ildfs2ulnmont4tlxriociatlaDrai sls  2xrxmpnu4ale  feil(  rtaxm ;u1oexoiieiltfs2elnvon()alenxr tatlmteai i;(0srtrim3nodamtelfctas) 2tm( pou1optniietld s ulu p t)trtomo oodfm   ieol(0s2umim3oo4am nlict s srua(rpot4aetomi3iys sDemuvo t)aetrxrcoadlpte i s t0sexr(m3iudaltnlnet t)srtm(  ou4optn i3ilt s rauvo;u4 rtoif3oydlp  livi;(  2uriopny4lm  mfcia(  Drru  ot0ale moeiyd sDem(von()areoxo3tadomt luvi;t srxmxm3nu4lp nmfetl(  2tax  ;u0olt mictyt a ea( s (0 lxrir tadfa rauesl(0sexrxr ny4amt mnvs t  2urxrp;u4openio3iadfmDumu pnt4aeerircootlpDeaivo ( texr(mpoudale lici tfsDurxr ;u1alx  iciltlm ra(vs;t4 eeomo3todfmD ln il(0 exmxopiy4ol elicia( arrr( p;t0olxoifciysfmDuan o u0trerxrctatoaDr uvil( t2umir3oudapte fes ( s2urum ;t4oleomi3iytls2ranvo;u4artrxr tatlmD  uvo s)s2tmxo3io4ol  mici s srrrumpot0oet  fetatfs eau pn(0 exnirctatfmDe ivslt)texr(rpno1op   feilsf Dtrx  nt0alxn o3iadfs2ran o;t4tlxnmociotopDraivolt0t2xmir iydalenmfci ()sDrmx o;u0aee  ociytla umu p;(4texomociytfm rlieols srxoxr3nodamen fvtlsfsDurumo;u0tpeo i3iatfaDeaumonu)altrmo3to1fpDeaieolt0 rxmimpny1lptnmivtltf Draxr ;t0tpeoiictltlaDemn pn()teenmo3iadlmDrli ils0 exm(opnu1lptemiciasfaDtrxmp;t4oeenmieiys s emn p (0tltoifcoo1lmDe i olt0seuo(rpou1ol  mnvtatfarraump;t1tpxn fciytlaDuln o;()aexnxrciytfm  auei;s)t2uoxmpiy4om n nvt (fa2trx pot0opxn i3tltfsDrm( snt4alxrio oydoa  ai olt0srtoim3ou4optn ieil(fsrum(ro;o4tpenio3iasla ulnvs;()artomr iytoate ivs s0sexoxm no4lmenlfctas a2rru pnu1olto fetysfa rlnvs (0artomociydom e ies;s0seumxrpnu4lmee ivt s)sDtmuro;o1teeoifctytfa el(ms;()tlerir3ty1lmDr nvil()s2umxr iy4omtnmfvilsfsDraumo;u4tle mi3tls mDrmnmo;t0treomr io1oa  luesls)s2xrxm no4optnlfei sfaDua( poo1oeen o3tlsls um(vs;u)arenxo tatoa   ivo;s0teuoio3io1lltelnvsl(fs2tmxmp;u4tex mi3iasfsDrlumo;t0aetomf oo1laD auvols tetrxm3iy1lle lnvtas sDtax ono4oet ioeiyd sDeauvsn(4altnio3oodfatran olt)s2xrirpio4am elnvsls  2umxmpnu1tetn i3iltlmDeluvpnt0tltniocoy1fp   iei s tetm(o io1ll n fvia()aDum( poo4apxnmiciytlm2eanms t) lxoxo oy1oatraiei;t0sexr(opnydaltnlnes s srrm(mooo0tlx ifciad m2rlnvp;t0texnmrciy1lmDe nvi;s  eumxmpoydlmt  nct sfs2rmuro;t4openmf3tlt s2rmnvsnu4 etnxociotlmDelies;t0 exrimpnydopenmfci (  rua( pou0oexomf3tldlaDumnvo;t)alenio todopteli s;s) etmim3nu1am nlfciasf Dur(mpno0oex mi3iyd m elu on() leoxrcia1la  ln i;s0 eto(o3iu1am nmncslt) rta( pnu4tpeomo3iadfs em( on(0artnmo3iytlp eluvolt  eumxr3iy1alt lnvilsfsrtrxm ;u4alxoifciadfs2emu p t) rxoifctatfatrauvsls)srurxo iudopte nvsa(fartrum ;u0ape  fcildfa umnvont4aeenio3oatom eanes;t0trxmirpny1omteliesasfs2trxr ot1olxnmiciyd m2um(msn(4aetoircio1fp  aivil(0setoxrpno4aptn nci t)arurx  ;t0opto f3tydla2um( onu0alxoirciy1fp eaivi t0trum(m oodoltnmfctltfaruax  ot0tet mfetasfa2ranmsnt)aeerxr3ootoat anes (  eurim3iodlmt livtasfs2rm(mpno0aet iocildfm ea( on(4 ltoxocta1fpte nesl()setoir3iodlmtnlfcsas aDtrxro;o0texomoetydls2uluvp;u)aetrxfcoo1lm  ln s;t teurxmpiudoleelieias srtaumont0olx  fctlsla um(vp;t) etrir3oo1lmteau o;t0trxmirpnodlpe mneils) rrrxro;u0apxnmieildfa uln on(4trtnif3tydla r nvs;(0trto(opoo1alenlfciatf rumx pnt4oeeniociyslaDua( p;t)alxoir3iatlmDeln i;(0 2toxo3nydaptn ivtlt  Drm(moou0ole if3ils a2rl(vonu0trenirciy1lmtelnvils0trxo(m3iu1ope lfetlsfarrm(ro;u1tltoif3tlsla rl( snu)tlxoio3oo1lpt auvilt  2xoxo io1aleemfcs ()aDtru pot4alx  o3ils s2rmnvpn(0artnio3iydla  anvi;t0texmxm3ou1lltelnctas srtmurpou0oeeo ieiyt s2ua( p;t4teenifcoy1opte uvi;s)seto(mpoodamee fviat)aDtmu  ou4apxnifctadlm um( o (4tltrxf iodomDeaiei (0 etmio3nudap  lics s  Dtrxmp;o1aet  fcilt aDelumo (4 ltrmr3ta1lmtr neils  eurxm iydamtnlict ( a2tmumpot4ole mf3iat s umumsnu) rtoxf3oa1lp elu ol(0t2tm(m3iydal nmnesas)aDtau pnt1aeeomfctyslm2rmn pn(4aetoxf3oydom rln s;()srto(r oodlm nmietls)a2tr( ooo0ope io3taslm emnvp;u4arxoir3oytlmt  nesl(0seurio3oo4om elnctat)s2tau p;u1tltomfcils m2el(mp ()teenmf3oatlmt  n sl(0 eumir iy1alt mncta(  Drr( pnt4oltn o3tasla umu on(4treoir ty1lptrlieolt) 2urio iy1omee icilt) Dta(r nu0oleniieiltfa2uau p;(0artnxfciadlat  i sls sexoxmpoydamenmfesatfa2umu ono1tpxnioetas m eanmo (4 lxnif3iotfmt lnvols trtoxr no4openmivslsfarum(rp;o1apen o3tys mDrauvs;u0 exrmrctytomt  i i t texmirpoudol  lnvi s) 2umurpoo1aee  icildfs ea(vs;t4 rerio ootlptr n sl()s2umxmpiudam e nctas s2rm(mo;u4oeeo f3iadfmDelnvonu0teenmr iydlp e uvo t0trxm(o3iudap n fci sfsrrax ono4teenmf3iatla eauvpnu4aetoif3ia1opDrliei t  rtr(rpnydam  mfesls arrmu pno4oexo icilt m2ea(mpnu4 lxnxfcto1lp r ivslt0tetrio3oo4apeelfetas srurx  oo4alx mi3ildls umu o;(4altrmr3ia1lpD  n o;t0srto(rpiudolt  icta( a2tmum oo1tlenmfeiyt sDem(vp t0 ltnmr oydfptelnes;s)trur(r io1omeemieiat) 2ra(mp;t0apen ociasla2rmn o;t0teenxo ootlpDeluvi;t) exrxo3iodlmenmfcil(fartauro;t4tleoiiciasls elumsn(0alxoxo3oodoaDelieo;s0s2trir io1am e ncilsfsrtaumoou1opxnmfetldlm umnvs;u0teeoio3ia1opt anvsl(0 rumxmpiu4optnmnesas aDrmurpnu1aeto oeildla elumpnt4 exrio3totomDrlnvslt0texoxm3io4open nvtls)srrrxmo;o1ole  ocias aDulnmo t)artoxr ia1fm  aieo () 2umio nodap n fvsa()s2rrxrpou4apx  feiys a ua(mpnu)treoif ootoaDrlneolt t2toiopoy4omtn ici s  Drr(rono1tleo ietytla2um( o u0 exnif3iytoa  aues;s0sexrirpnydll nmiesasf 2tr(ro;t1tptomfciyt sDelumpn(0 renxr tatopte ueo;s trxmim3iodlpe lnvs (f Drmx o;t4tlxn ieiys s2rmuvp;() ltoxf totop  lueol(0s2umxo3iodolenmfesat  2ra(monu1tlxomfctlsfs2rmn o;u)arxrmf iytomt  ivil(0 rxr(m3io4apenlfvsls)srurx o;o4teeomi3iltla ea( snu4trtrxr3oatfp   uvo;() 2trxo3iu1llenmicslsf rrmx oou1olx mfetadlm2elu o;(4 reomr oy1fa rlnesls  rtoxopoudoleelfvt (  2rrxr nu4aexoiociltfa2uaumon(4 lxnxf oa1opteli o;t tetoir no1apte ies ()sDtrur ou4oetniiciatfs2ea(vp t4teenmf3oatfaDranvi;s) 2xm(r3io1aptemfes (farumu  ot1oleomfeiytfmDeauvs;u0altrir io1om eanei s)t2xmxr ou1apenmfvtls)arumu oou4teeo feiyd m emn o (0aeeoir3iadfmDeln sl( srxo(rpiydlptn netasfaDtruroou1opt ifeiysfs em(vpnt0artnif3tytfm  aueo;( trtoxr iudam nlfcia( a2rrx o;o0oeeo f3tatfa2eln o;t) renifcoy1fm  ai ols  rumxr no4ol   ies t)s2tm(  oo4ope  i3tyt aDemuvo;u)alxnmocio1fpDrlnvs s  rtm(o iu1lmeelieias srtrxm ;o4ale iieiydfa umuvp;(4alenxrctydlm r n o;()t2trim iy4ole  ivsltf Dtm(r ;t0oltn oetldfsDuaums t)alxnxociy1omDrlivi;( t2tmirpiu1ll  lfcsas aDra(rp;u1tet mietldla2rmn snt) ltnxo tatfmte nvilt)s2tmio3ny1alenlncilt  2rmuro;t1texnmieiytfmDua(vp;t4 etnio totoaD  ueols srtr(o3iodomenmfcsa(  Drrx  ot0tpen fcils mDuanmpnu4texrio3ia1fat anesl(0s2xmxo iy4lle  ivil()aDumxm ;u1tetoioeiltlm eanmsnt4 ltnmo3ootomt ln o;s  eumxr3oo4apt lfei ()sDrrx p;o0optnmoeils aDea(vpnu0arxomr oy1fm elu s s  2umir ou4omtn nvtatfartmxrpno4tet iictldlsDrl(vpnt)aexoir oy1fpD au ols)sexoim3ny4optelfvsasfarta(mpou0aetomfeiadlaDel(vsn() lerxo3ootfpDeln s s0 etm(r no1lmtn nvsat a2rr(  ot4tee if3iyt a ra( p;(4tetnmf oytlp e i s s trxm(r3ou4llenmfeslsfaDurxr ;t1apto ociys m emuvsn(0 rerxr3iydfa eaieils0srxmio3nodll e ieias) 2tmu p;t0aptomf3tasla2ulnvo u0teenmr tytlat lnvo;(0seumxr3iu1alte fvslsf 2ra( poo1tltoiictasfm eanvs;t4aeeomrctadlat aues (0t2toirpou1lmtemnvtatfsDrrxrpot1tpt moetydfaDulnmo;t)tltrir3iatlatrlivo;()srurxrpnu4optemivtls) Duaumonu0aexnii3iltlmDum(mo u4aeeoirciydoat  i s s0 2uo(o3nodlp emfetas srrau p;o1tpxnmieilt a ra(vo t)aeermr3oodlatrlnesls0sexr(opnudlpt  ietl() 2ur( p;u1apeomo3tydfm2rmu p t0tetomr3tatfatr i sl(  exrxm3iydamen ivtat) rur(mp;u0ope ii3iytlm2rlumsn(4altnir iodomtr iei;s srtr(r oodlle  nvias)artm( pnu1oetniiciadfa ulnvont0alxrmr3iy1lpD ln o;s0trtmir iy1alt mfcsltf rtmx p;t1aeeomieilsla rluvs t4altnxo oadomD auei s) etoimpiy4alt mneiatfa2tr(r ot4aeeomietadlaDulumpn(4arxrir oadla r nei t  rtoio nudlpt mivta()arum(moou0aex mfctydlm elump;t0trtrmrcto1laDe u i ()t2xoxrpnudlmtn ict s) 2uau  ;t1tpt mfeiydlm eluvsnt) ltomocoydfmD aies;() 2um(m3oydlle  fvil(f Dtax ont0apen oeias sDua(vo;u0aexrmr3iydfmDr ivi;()trxmio iy4omtelnetl( s2tmurpnu1tptoiictldfs2rln o u0texnmf tydom rlnvilt0 eumxo nudll e ictat)a2urx  oo4aleoio3ias s2rmuvp u)tetrxocoadop  li s;t) exrio nudolenmieiatf rrm( ont0tpt mieildla umuvo (0teenxf3oadlpD  nvs t s2toxo oy4amee nctasfsruru p;o0olxo f3ilslaDrm(vont)altnmf ta1fp   nvil(0 ruoirpnydam  mfci tfsDrmx oou4aeto fctldlmDuanvp (0arerir3oa1lm  au s;()s2xo(rpno1am emnvt ()arrmx  ou0tetnmocilsfs umnvo u0teerxo3iy1faDeln s;( tetrio iy1ol  lfctas) rtm(moou1tlx mo3iad a2emnvp (0 lxrmrcoadfptelneo (0trumio ny1olen feta(f rta(  ot0altnmf3iys s umu p;u4 exrir oa1oatr n o s0 2xr(r oy1ll  livtl()aDumumonu1tet  oetas m emnmsn(0arenio tadoa r u s;(0teurxopou4ol nmncs (f rrm(ront0apt micilt m2ul(ms t)artnmf ty1oa eanvo (0s2xr(rpiudapt  nctasfartmx  ;o4ope mo3iyd a ulnmo;t4 rtoxo3tydfp rlies s t2ur(m ny1ale  ivslt artru ont1alt  fctydfaDum( pnt0treomf3io1om rlu ilt) exo(m3no1am n fct ( a2raxmpot4oeeo oetatlaDrlnmsnt4aexnmo3iy1lmt  u i t sexoim3ny1ole  feils) Dua(rp;t0tpt mociyd sDelnmon(0alxrir oatla rlivs;t0srxoxr3nu1ame  ivtl(fs2rmxront0oex if3ias a2rmnvo t0tle
\ No newline at end of file
@@ -0,0 +1 @@
+n s;t)sexr(r oo1ap nlfvtl(f rtr(r no4teeomoeilt mDra( p t4tetrxfciodlpDrli i s srurxo3iy1omt licslt  2uau  nu1oexo fciadfaDeanmonu)alxoxf ia1oaDelueilt0t2uo(m3ou4al emicilt aDra(m ou1tet  o3tadfa2uanvont0artoif oy1omteaivi t) exmxo oy4lp   fcsl( artm(  nu1tptn oeilsla2rln o;u)tetoiociotlpt luvils)s2xr(o3nu4omtnmicslsfa2tm(mp;o1apx ifeilsfaDum(vsnt0aexrmf todoateai i s0 2xmxrpoy1alt mieils)arrau pot4tptn ociatlaDrmnvpn()tetomf iodoat livs;t0t2xr(r no1opee fviatf Dur(  ;t1olxnii3iadfsDemnms t)aexomrctodfp eauvs s  rumxo3oy1olenlfcias a2raur ou1oee mfetydfs2ulu o t4tltoif oadfat  u s s)s2to(o iudoltnmfct tfartrxmont0aetomfeiaslsDea( s;u)aleomf3oy1lp elivils)seur(r3iu4amtnlnvi ()sDtrxrp;t1aexo fciys aDeln sn()alxomr to1lptraies;s tetrxm3io1olee icil(fa2tauro;t1tptnioeils aDuanmpn()artnxociatfmt lueslt  2ur(opiu1amenlneil(faDrrump;t4tpe  fciat aDrmn snu)artrmfciytopD livolt) 2trio io4ope lfei sfsDumxmpoo1tpeo fctat mDea(ms;u4tleomo3ia1oaDeaiei;s0 2umxm3no1al  lnvil(  2ta( o;t0alxnmiciyt a2ua( s;(4trtomociotom rai o;t0texm(m3iudlpe mfvt ( srtmu pno1aee mfeilsfsDemnmsnu4trxrif oa1oa rai s t)s2trxo oudom nlneias aDtaxr oo4apt mo3tlt m2rmnvs;u4 eerxoctotlatrlnvi () rtm(o3nu4lltemnct tfs2ta(mono0oleomf3tldlmDuln s u)arxomfciatfpt  u i t  eurio3io1op nmfcta( a2taumo;t1aeeoiiciytfs2eauvo;(4aexoioctatoatr ivs s trto(o3iy1lm  lnes sfsDrmur ;u0apxnii3iydfs2um(vsnu)teenxf oy1lm e n o;(  2uoim oo1ape mnvt s arrrump;o1aexo f3iaslmDua( s u4 etnmf3oadfatraneo ()setmxr ou1altn fcias s2rr(r ot0olxoifetad a eanms t0 lenif3iydopD  u o;t0 rtoxmpiydolt  neils)a2urur ;t1tpx ii3iytlmDeluvsnu0artnmf totomteauvs t  2toim3io1optemncil(fsDrr(m ot4opeo o3ias a emnmo t4 lxnmfciodlaDr nei;()tetoiopnu1ale mfeilt)sDrauro;o0oexn fetasls2rmn p;u0 rtnmf3oy1oa eai olt0srtmimpny1lltnmfvt tfa2umurpno1oex mfeiysfa rlnvpnt)tlxrxf iytlmDeli s t) exo(rpnodlpe  nvslsfa2uauro;t0ape  ieiat aDemnvo (4trenio3iotla e u i;t t2xrxo ny1lptelfvtlt)srumxr ou4tlt mietldla2ean s;t0tltnxf3oo1fat aneols srtrim nodomtnlnei t) 2tau  nu0tet  feiltfaDumnmonu0tlxrif3iotomtelnes;s sruo(o io1ll  lfctasfsDtr( oot4olt ii3tls aDean s;(0 lxomr3oytlmDelnei;t0sexmimpoudlleelncsls aDrmxro;o4tpxoiietyd a2eln p u)areoir3to1fm  lu i;s) eurir3ny1olte ieia()s2umx pnu0aee mfctlsfmDua(mont0 rtrmocta1fp elnei;t0s2toxr3nudame mfcta(fsDuaxmo;u1tpxnioeiydfaDrlu p;()texomf3to1fp ranvo s srxoio iu4lmt micsl( a2uaxr nu1aetomoctlt a2eluvonu0 ltomo3oatlatelivi;t  etr(r io1al   fesls) rtmxr no4apx iieiasfmDeln o;u)trtnmf ta1fa ranei () etrxr no4amt mfesasfsDrau  nt4tlx  ociaslsDumnvsnt)trtrifcoa1omDr u o (0sruo(r3iu1olt mivtlt  2rm(rono4apxo o3iydla ulump u)arxrio3oo1fmD liei;t) 2xm(m iu1lmt  nciat) Dtmur ;u0opxo ictydlm rl(ms u)trermo oy1laDeln s t trxrimpiudlmenmiviat)a2ta(mp;t0oetn oeilt aDumuvo;t)trxniocoa1lm   nes;(0teuo(mpou4apt micil() rtr( pou4tetnmf3iltlm ean o (4tlenxr ia1oat auvo t  etmir nodlp n ict ( sDumx oot0aexo ociltfaDranvonu)tlxrirciodfmte n i;(0s2toimpoy1omtemnvslt)sDumu ooo0tpt mieiyt a2emnvonu) rtoir3oydfp r ivol()texoir3io1am elfct tf rtaum ;u0aptn i3iatls ulumon(4altnmrciadlateau s s)seuo(mpny1amt mietas)srtaurpot0tpeniieiydfm2rauvp;t4aeenif3oytfpD luei (  rurirpiy4omt  neiat aDuaur ot1opxo feilsfm eanmo u4altrxrcta1lm  lu ols0 euo(o oudopte netat)a2ua(rpno0tptoiociltfs ranvo;t)trtoio iotomDraivolt0sexrimpiodamenlivsltfa2rmuro;t1oetomieiydfsDrau p u4tlxnxf3oodfmDe u s t0tetoxr3oo1alte ictls sDtrur ;o4oex io3tadfa2elnmp;t0aexomo3oodoatelneo;(  2xrxopiu1apt mnvsl( srtm(mont4aptnifciat a rmn snt)teenif totfpDr i s;t sexoxrpny4ope  fes s aDrr(m oo0texomo3iadls2um(vp () leoif3iytlptrliesl()teuoir3ou1ap n nci t a2uaum nu1aptnifciys s2em(vpn(0 etnifcoydoat lu ols) 2tr(o3nydlp  liesat)a2rruro;o4aptniieiltfm um( pn() rxoifciydomt ai il( sexmio no4ame mfetltfa2um(moot0alenmi3iytfm2em( p (0trtoxf iytfpDeaivo t t2to(m nu1lmee ics tf 2ua(m ;o1alx ii3tad m rmump;(4artnxfcoatlateln ilt sexr(m nudolte ivt (fs2rau pnu1tptniociadlsDum(vs (0 lxnio3tydfatrli sls  2urxo3ou1olt  fcsas sDtrum ;o1oltn feiyslmDul(vo u0teeoxfctotfat  u o s)seum(o3no1ameemfcs (fa2um(root1olxn oetasfaDrauvo u4aleoxrcoydlptelivol( sexoir iy1apte icsl( a2uaum ot4apenmfciat m2rm(ms;()tetoxrciy1omDe ivslt0t2tr(r3nu1ole  icsls) Durxro;o4openmfciydfsDranvpn()artoxo3iydlaD  nes;s0t2umxm3iodlp  mnctat)aruaxmo;u4alxoiociatlsDemnvpnt4 etomfctatopteaivs;s t2toir3iu4alt mneta()sDumu pot0tpen ociyd s umumsn(0teenir oydlmDe nvols)tetoxrpoydlp e ietatfa2rru pnt4aetn f3iysfa eluvp;(4 etrxr iy1fptrlueolt  rtrio3oy4lle  nvs t)artmx o;t4optn oetydfa2el(vsn(4 etnmf oatlpDrlieil( trxoirpio4ol  mnvt (  Duaxmpnu0tlt mf3iadlmDeauvo;(4tlerio3iotlmDrai i s  2xrxr3nydll  mivilsfartmxrpnt1optn ieilslmDumump u)areomrctotlm  auvo t trxmio3ou4ll  livtlsfaDtruroot0oetn ietatfs2umnms;t)arxoxo oydfmDrlieo;t)trto(rpoo4amtemivsas) Drmum ou0apx mictydfa eau o;(0tetriociadfa rau olt0tetoxopno4aptelivtl(fsDrr(mont0apenmiciysls rlnms;u4 rtnio3oy1omt ln o;( trtoxr nydoptnmncsa(fa2uaxm oo1opxo iciyslm2el(vo;(0aexrifcoy1lpDelnvs;t0trum(mpoudap n fvs s  2urxmont1oeto ietydlmDuau on()arxoxrciodop  anvolt)setr(r3iudapeemfviat)srumxmont0apeo o3iltfsDelu s (0alxoif3oytfmtrli o () 2xr(r3nudapt  ietl()s2ur(rpoo4aee mietadla2rl(ms;t0 ltoxfcoa1fpDe uvils0trxoxmpou1aleemfvia() Dta(ro;t1oee mf3tytlmDeluvo (4aexoxf iydfp r n o (0texoxrpoo4op n nctl( srumxrpnu0ale  ociad s rmnmo;(4 lxoifciadoat aivil()sexoir nodol   nvtlsf 2trxrp;t1alxo feiysfa2el(ms;(4areomfciytoate ueo (0seurim io4lm   net s)artmxrpoo0alenmieiadls2rluvpnt0texoio3ta1fa rai o t sexrxm iudop  mnctat)sruau  nu1texnii3ilt a emumo ()artnmr oydfmtelies;( srtrio oo1amtemfctls)aDtr(mo;u4tpeomfeilsfm2ua( snt0tlxnxo3oytfat liesl( t2xmxmpiy1lp  mnvi t)a2ururoou1tpeo i3tas s uanmsn(4altoxf ty1fpDelu i ()t2to(o nu4ol e fctls  Dtrx ooo1aex iociys aDelu on(0altnxr3iy1op raneo ()s2toim iu1lltnlnctltfaDumu  nt4oetomfeiasfmDulnmonu4 rermocio1oateaiei (  2xr(r3oydoleemnvi s  ruax p;o4olxnifetldla ra( p;(0 lermfcia1lmt lnvi;( t2urxo ny4alee fci tfs2raumpno4oexoioetad sDem(vo t0trenio3ty1op   uvolt  2xoio oy1ll   nvslt)aDraxm ou0tle mo3iadfaDel( on(0arxoxf tatopD  ivo (0s2xmxm iudaltn nci s) 2uaurono1aet iieildfaDeaump t4tltnir totfp rluvi t t2toio ny4om eliviat s2taum nt4tet  fctld m2rln snu)areoxo3oodfpDeauvs;(0truo(o oudale mnctlt arumxr ;u1aex ifetyd aDeaums;u0altnifctydopteai ilt s2xm(r3nudam  lnvsat)s2ra(mpnt0tpe if3tytfaDemuvont) etomr oa1omt  uvil(  2xrxo3ny4amen fcs s)aDtax oot4alen o3tlt aDelu p;(0aeenxf3iadfp   i slt)t2xoiopnodop  livils  2rrxro;o4aeto ietlt a2rmumsn(4tetrmr3iodlm eaies;t0 eto(rpnu4ap  mfvi t)aDrmxrpnu0tlenmo3tytfaDuluvp;() rtomo3iy1fp rlu olt0trum(r no4aptelnvia() rrmu  nt0tptomo3tydlsDuanvsnu0 reoir tydoptr ies;t0 2uoxo3oydop elnvtas srtaxmpou1optnifctldla2eaums;t)arerxf3iydfmDrlnvils0 rur(r3ou4ap  lnctat a2raxmo;u1oex io3ildfa eaumpnt0trxnxf3ootlpteli i;s setoxr3iy4olen nct tfsruaum nu0tlto octld sDuluvs (0texoxfcoa1op   ivs t0srtm(rpou4ll  miesa(  rrau p;t0oetnmociatfa umnmp t)tlxrxf tydom raivi;( seumim3ny1alenlnes t)arra(rpnu1tpx  ociatlm2um( p;t0 lxrmf3oatfpDr i s;s seur(r3nu1lltelfvta(  2raxmono4oeenioctytfm2rlnmp u)tleomr3iytlp  ai ol( srxoxo iy1ll nliei s)a2um(mp;t0olenif3iytla emnms u)arxoxf3iotlaDr iei;t trtrxmpny4om elncils) 2tmum nt0apx mfctltla ulnmp (0tetnmo iatfp r ies;t0srtmirpno1lltnmiet t  Dta(rpno1aexnifetaslsDelu sn(4teermf oo1la e n s;() euo(m3ou1lptelietasf 2rrxmo;t1teen o3iytfs2rauvpnt)aetrxrcoytfpDe uei;s0srxo(m3iodoptelieils  2tr(r no1aetn ietlsfm rlnvp;t0artnmoctytopte ies s0 rtoxm3iu1ame mnvsat)sDtaxroou0teto icias m um(msnt)tetnio oydfatr u il( trxrim ny4oltnlfeias artmu pnu4olxniieiatlaDra(mon()tlxoxr oydoaDe nei;s) eurim3iudlptelivi sfarrrx  ;t4apxnmfciltfa ulump;(0 eeoxociydoaDeln o;( t2tmio oy1alen fesat) 2ra(mpot4opx ii3iadls2umumpnt)alxrio3iodfmDeli i;s0trtoxrpiudlpen fvt (  Dua( p;u4olx ifctytfmDem( pnu4aexriociadlm elueolt)truoim3iodame mneia( sDuauront0oexoioetad sDran o u4 ltrif3oodom elieo t)setriopoo4ape mieslt)aDum(mooo0opxnmfctad aDuan p;()teeomf ty1oa eluesl()texr(m3nodomtnlicilt)srtrx p;t1alt  fciadlsDrm( o u0aexoif3oydom eau s s teumxopoodal  livi s  Dra(  nu4olx  i3iltls ranvs u4arxnxf iydlmtelieolt)trurxm no4ap nmfct s)s2rm(m ;o0aex  octld a2emn pnu4trtrxoctytlaDe nvs;(  2toir3oydole miei ( a2rmump;t4tle moeias s uau pnu0teeomo3iydfmtr n o s) euoxo3oy1lptemfcsasfarrmu o;u4tlxoioetas aDean o u4 etrio todla r uvo;t trtr(m no4ame mict s)sDtaum nt0alxo fetltlaDea(vpnu4trtrmf3ty1lm eanvs s)trxo(o3ny1lptnmiet tfa2umu pnu0tlxn ictas a2uaumo t4tlxnifctadoat ai o;() rur(m3iodoptn nvt sfsDrmu o;u1tpe  ieiyt m ua(vs;(4 eenmf3iadfa eanei;( t2tmxr3iy4apen ieil(f Drrumpno4olen oeiad a uanvp (4aeermo oadlaD anei;t)tetrim nodlpeemnvsatfsDtrxmp;t4opxnioeiltfa2ranvsn(4aeerxf oodlpteanei;( srxrirpiy4ll e nciasfaDuau  ot1tptnmoctydfm el(vp t4 lenif io1fmte ieo;()trxmir3ou1omenmieia()s2tr(rpoo0oleo fcias a2um(vsn() etomf3oatlmte n s t)t2uo(o3nu1op n netl(fsDuauroou4aee moetatla2uan s () renxo3ty1fate u s;s) 2toimpnu1omtn nci t)arra(rpno0tetn ieiydls rlu pn(0 eenxfctatfaDrlneol(0 2xmxo iu1altn fviat  Dtaum nt4altoiietyt mDemnvo (0 exrxf3iotfmDelnvs;(0s2toirpiudap nmnvs t) rrrur ou4openmo3iasfaDraums (0alenxr oatfpt lieo s)s2toxo oydll nlfvs (  Dumxr nu1aeeomoetysls rlums;t4 lxnmfctodlmte iei () 2tmxo oo4om   ncsltfaDua(rono1tet mi3iyslm rmn o;()alermf tydopDean s t truo(rpny1om n ivtls)s2trxront4aeenmoeiatfm emn onu) leriociadfa  ln i;t)trur(m3nu4lme lnvtls)artmu p;t1oee iociyt a rmnvp () reoif ta1oaDe i s s)trtmxopiudopt  fes tf Drm(mo;u4optomfetltlmDelu s;(0alxoxf tadlmt lu ilt0s2uo(rpou1lpt licia(fsrtru pnt0apen iciytla2rm(ms t)tltnmf3oo1faDeau slt) rxoxm3nu1lmtnlncias a2ururpno0alx  f3tydlsDumuvo t) lenif totfmt anes;t0t2xr(opiu1ame lnvs s)aDumu  oo4olxoiociydlm2eanvsn(0aexrir3oytomDrlu ils  rxm(o3nodame mfvi sfaDrmum ;u4oexo fciydfaDel(vs;(4 lerxr iy1opt lnvsls0t2xoir3oy1omtn nei t  rumxm nt0altnmieiyd aDul(vs;() etoxr ta1lp  anei s  exrxo3ny1ameemivt t)a2tau pnu4apeoioeiltfa2ea(vp;t0trxnmfcoatlpDeln i s0sexrio iudol nmiesl(faDuax p;t4ole mociydfs2uanms;u0 ltrmr ty1fatrluvi;( texoxr3ny4om emfctat) 2rmu ooo0opeoio3ildlmDea( o () rtrmo3oatla  lu il( tetoxo oy4ap   ieiasf rtmxmo;o0tee ii3ildlm rmuvo () rtnxrciatlm eau sl(0 2urxr ny1amt  feiltf Dum(monu1oltoioctldls rmnms;()tleomfcoadfpt anvs;(  2trxrpoudlltemivs ( sDta(rp;u0ape ifctasfm emumo;(0tetoio3iadom  lneslt) 2trim no4apen fvsa(fsDrmum ot4alenmietyt aDuanvo (0arxoio3todlpD lies;(0srxmir3nu4lpeelfvsls a2uaxr nu1alx  fcildla2rmn sn() reomfciodopDrau i;(0 rxr(o3nu4ll eliei (fsruaxmono1ole iieiyt a2elnmp;(0 rxnxo3tytom e i s;(0teurirpiu4om nmicsasfa2rmur ot1altoiiciytfm eanms t)alxoxr io1lat  u ilt) exoxm nydlme  ivi (f Dtaxrpou4aexomfctldlaDemnvont0aeeoxr oydlpt lnei s)t2xoio3iy4altemncsls s2rau  ou1apx mfetldlm2el(vp;()trxnio ootoate iesls srxo(r oo1lpt mivia()srraumo;u1altnmfciytla2ul( s;(4 ltomrctotoaD anvo;s teurxrpoudllt micias)s2rr(rpoo1altn oetlsfa2uauvp u4 rtoxr3iydlptr neslt)seumio oo1lpenlieiltf 2ur( pou0aee ii3iydfsDean s;(4tltnircoatlaD  n il(0 rumxm3nydlpen ncsas  rrauro;o0tpeo fciyt m2umnvp;u4alxnxr iatop   ivslt0trtmxrpoo4amt  fcsa(f Drm(mo;u4tlxnmo3ilsfa2ua(vp;u)arxnmf tadfmDraueilt)teuoxm3iu4aleelietasfaDtr( pno1apt  octadls2rmnmp t)artrxociydfa  lnes;t0seurxo3oo1llt mietls)sDum( p;o0opeoii3iasfs2uan p u)tltomociy1oa  liei s t2xm(m nu1lpe lneia()srur(moot4aleo octysla2rmnvs (4tlxrir3iodlateau i;t0 2xr(o3io1llee nesat  Dumx pno4ope iieiydla emu s;t4aetnir iotfp  lnvi (0srxrio3io1ol nlfvias)s2trur ;t0oetn f3iyt sDrlumsn()tlxnmrctadfaDr nvi t  2xoio oudlm emncsat) 2urxmp;o0tee mocildla2emu snt)aetnxocoa1oatelu ol( srumxrpoudlpee nvs t)arraump;t0apto i3tatla2um( pnt) rtnxr ty1opD  ieo;s)t2xrxr3ny4op  lfvtas a2rmx  ot0tpe moeilt m2rm( o u4alenio3totfm r ueo s) exo(m oo1lltelnetlt)srra( o;t4oexo ietltfsDem(vp () ltnmfciatfa ranvo s t2uoxmpiu1lpeelicsas sDur(ront0apeo ieiyd sDrluvo (4trtnio3oa1omtr ues s  2to(o nudllt mict tfsDrmur oo0aptoiieildla2um(vp;(4tltrif oy1lmt auesls s2to(m3ny4al nlfetas aDurxmono0apxn fctyd s2umuvpnt4 renxf3iodom  lnesls setr(m iu1omeemfvsa( a2ur(  nu0ope iietadlmDuauvs;u0 rermfcoydopD aies;s srurxm3no4apeemfcs ( srrru ono0tex iictysfm2ea( s t4altomf3iotopDr uvi;t)s2xmxm ou4op elfvsasfsrraxmoou4aleomiciltls emnvon(4artrxo oodopDraueilt0truoir oo4omtemfcsas s2rm( ont1ope miciat sDrmump u0tleoifcoy1lptelu i ( srum(r3oydomeemivtlsfa2ua(mo;t4tleoiieiytfsDuauvp;u4altrif ootlptelneil(0setm(m3oodole lncslsfaDum(ro;u0tlt  ociyt sDul( snu4aetniocio1fp r nvil( t2uo(m iydop   ivilt)arrrurp;o1olen f3tadls rmuvont4tltoio3oydfpt luvi;( tetmxo nu1lp emietat s2umxmooo1oex mieiat mDrm(mo u) rxoio oodoatrlu o t srtr(r3iydomenmnvtat)aDurx  ou1tleo ietyd aDelump t)texrircio1fmtrlneo;t  exm(mpou1ole mivt s)arua( ono1oetomiciadlm ra( o u) eerif3oadomtrau i;(0 2tmirpnu4lptn feslt)sDua(mp;u1tex  o3iysfm2emn o u0tetomf3tadomt  iei;s)srtmxr io4ap n ivsltfsDtr(rpot1aetnmfcild m2eanvs (0 etrxr tadfmDr uvi ()tetrxo iu1am   iei t)s2trxm ou4aetn feiyd s2ran s;t4trtoxfcoo1lm  anvsl() 2urir oudlptnlfvtltfarrm(ronu4altomoeilslaDul( p t) ltnxrcta1om rau o ( sexrio3nodol emiesl( srumx p;u1tlxniieiad mDemn pnt0tltnmf tydlp  li o;s0 eum(o3iudape lieils a2taxmont1oee mocild s ra(von()trxomo3iadopDrlieo (  etm(m iodal e fet t sDtmurp;o0tleoii3iltlm2rmn o;t4tetoxr oatfa rlu s;s s2to(o oy4lme lnvs t s2rr(moot0aee moeiydfs2rm(vs (0altniocio1opteaivs s0teumiopiy4ope mivslt) Drrxm ;t1aleniociytfsDrluvsnt0 rtrif3totlm   uesls)srur(r iu1lptnlncsa( srum(mo;o0aexomieilsls2rmn p u) leoifcto1oa r nes;t0 2xrxopoo4omen nvs (  rumu pot0tlxo ietlsfa2el(mont0trtrmocoatfaDr nes;()sexmimpio4ol nmieias arrrx p;u0aetn o3tad m el(ms t0 eeniocoadfatr nvi;t)t2uoxr3nydole  ivsat) 2ur(mpoo1apxo o3iysfs ra(ms (0 lxrxf iadopteli s;t)srtm(m iy1lpenmfctls) 2rmum oo4oee ii3iat s2eanvs (0aeerxf ta1om e ues (0 2trxm ny1llte fvs t srtaxrpnu1alx  f3tatlm2elnvo (0arxoir3oydlpD lnvs;s0truoirpnodaleelietls aDum(mont4tltnioeiltls2uan o;(4aexrxfctytfaDrau s;s  eurxr3iudoltn iei t)aDrau  nt0aptn oeiysls uanvo u0alxoir3iotlp r iei s srtoim3no4lpeelicsas sruaur ;t4tlxoiociys s elnmo;t) rxrxocia1fm  auei t0 rum(opoodlmeemfvil(fsDrmx pnt0texo o3iltla2eaumsnu4arermf iatfaD  n s (0s2xmio3io1ome lnctls)a2taxr nt1opxoifctadfm rmuvo t0teenir oy1late nes;t0seuoxm3oo1ale mivi s)a2tmx pou4oetnmf3iatfmDua(vp;u4 leoxfcia1oaDe n s s0 rtmir io4omeelnetlt sDtm(rono0aptomi3tldlmDran o () rermfcto1la   i olt) rxo(r3oo1ll nliet tfaDrrumo;t0optn fciydfs2umnmo;u0aeeoio oytlmD aivs;t)tetr(opiydomtnlneias srtr(m ;o4teenmoctadls ulu snu4trtoxf3oo1lptrliei (0truo(r3iydll e neils) Dta(rpou0aptomf3iadfs uauvs t4 etrif iy1opDrauvi ( s2urim3oo4ape  nvsls) rua(rp;o1aetnmietys aDul( o;t4altnxr3iy1fm   ueslt) exmxm ou1ll  lnvils sDtrumoot0aexomf3ildlm ulu s t0arxoif to1fp e ivslt seurxr3no4lptnlfeta( sDra(m ou1olt iocilt a umn o t4alenxf3tadfaDelu s t teumir no1lltelici s arraum ou1tlt moctat a eanms u)aexnxf oy1opDeli i () eur(m3ou4lp  mfesa( srtmxrp;t0ope iociysla ua(vo;(4 rerxocia1laDe uvslt)t2xoim ny1ol emnes s  rtrx p;o4olx  o3iatla2rm(mp () etoxo3iytfmDeaneo s0tetmxo oo4ame lnesls  rtaumpno1oet ifetytfaDemuvs;t)trxrmrciodop eau sls)tetm(r ou1ame mfciltfarua(  nu4aptn o3iad m2uan s (4trxrifctodlpt aivo;t0t2toxr3oo4ame lncias)a2umur oo1oexn oeiyt aDrm(vs;t) lermr3totoa elieo;s0 rtm(r3nu1ap  mfcil(  rum(mo;o1apxoifctadfa ulums;(0 eerifcoadfp eluvs () exoim3iu1ome lietls s2trxmp;o4olx if3ilt a eau p;(0tetoio oa1fpteaueolt0t2um(mpou4lmtn fcs ( arumu ooo4olxomocias aDrmnmo (4 lxrxocta1lmteanvilt)trtmxm3no4lp emfetlt) Dumx onu1aex mfeiasfa uluvont4tetoio3tadfatean il(0 rxm(r no1ap  livi s) rrr(moou1oexoiieiatlsDrmn o t4artnxfcoy1oaD  nes;( s2uo(r3ny1ap emiet s)s2trx o;o1texo iciadla2em(ms t)artnmo3oa1fateaneol(  euoiopio1llte fctat) rrru pno4tpxoii3tldla emn o (0 reoxo ta1latraiesls  2to(mpny1am nlivi t s2ta( ono1tetn ieiytlsDrm(mo t0 ltoirctodlmD  ivi t trxrxo iy1op elneta(fsrtmu ono1apt mfctaslm2um(vpnu)aetrxo oy1fmt au s ()setmxm iu1omtelfeta(farrmxmpot4tlxnii3iasfaDumnmsn(0 ltnxf oadom  lu s;( seumim io1am n nvilt) Draum ou1oetomf3iysfa2umn ont0tlxnio to1fm ran sls)trtoir nodlpen ivs ( arumxrpoo4tex moeiydfa2rm( s u4 exoifcoadlate uesls t2xr(rpiy4lltelivta(f rtmu  ;u4teeniiciytfs2em(vpn(4 exrif3oadopte ivslt setoim nodom nmici () Drmurpnt0oltomf3iysfsDra(vo (4areoxf todla elueols)srxo(r3iydllt lfetatfsrrmum ;t1tpxn ociatfmDrluvsn(0aeeomf3iotfp  ln ils)teum(m3ou4olenlfei (fa2ururp;o1ope  f3iyt m umuvpn(0 leoiocoadlp  liei (0trtoxopoy1olte ncsls  Dur( oot4aleomf3iaslsDelnms u0 lxrxfcootoa   uvslt0sexm(opou4oltn ictasfsrua(  ot1oltoiociltlmDrm(ms u)artnmfctotla e u i ()tetmir ou1apeemnvi (  rta( p;o4tpt  i3iadfmDem( pnu0aetrxr3iytfmteli i ()trum(r iu1apee ivtlt s2urump;o0oeen ieildls um(mp;u4tetrxociy1lp   uvo ( texr(m ny4al e ictls)aDtaxroou1tltniictld aDrmu s;t4arermf3tydlaDr nvo;s)t2trir3ny4olt lncsat arrmx ont4tpen fciytfm ulums;t)teeomr3oy1lm r i s;t0 rtmxmpiy4ap  lfctlt  2tr( pno0oltoii3tlsfs uau onu)artoif iy1lm rlivslt texrim3ou4ol  mfes sfsDtmu pot0apeoiiciadfm2el(mp u)teerifcia1lm  aivo s0 rxmxo ny1lpenlivsa(fsrua(mo;t0ole  fctytfm ul(mo t4altnifcoo1lpD lues;t0s2urxr3nu1ap  mfcs (fa2tmumpou0tltomoeilt sDea(vs;u)tetomr tadfaD ai o;t0srtmirpny4lp n fetls)arta(r ot1aee iietlsfs eauvo;u4trtomo oytomDe u sl(0trxmim nu1omtn fei t)a2rau  ;u1tlx  fciatfm2el( o ()trxnirciy1lmD anesls) 2xmio3ou1altnlfvi (f Duaum ou1open ociadfs2rm( snt)aeeomr3oytoaDraivs s t2uo(o no4ale lfviat)aDur(r ;t4oet iieiatfa2eauvsnu)teenifctotfp eauei s0 exrio oudomenmivil(  2taxmonu4tlxo fctyd aDua(vp;()tleoio3oy1fa elnvs (  rxm(r3nydale lfvs t)sruaur no0apt mocild m em(vo;u)alxrircta1lm raivol() 2tm(o nu1aptemnct ()a2raxr ;u1altniiciydlm emu pnt) exoioctotoaDraivs s  eto(m3nudlltelietlt) 2rm(mo;t0altomi3iasfs emums;(0tlenif3iy1fp  anesl()t2tm(mpiudalen iesat)arta(ro;u0apt moctys mDran ont4tleoxfciydfpteli ol()t2xmiopio1alenlnvil(fs2rrxmp;u1tlt io3tas a ul(mont4tetoxr3tydfaDelies t0trxm(mpoo1lm   nvs (  rum(rp;t4tpxoif3ias s ea( p u0alxrio iy1fmDr ivils srurxmpoy1oltemnesasfsrtaump;t1oltomfeiytlm um(mpnt4teerir3oydoa   uvol( s2trir io1lle micta()srumumoot4aex  feiatls rl( onu) rtomrciadlm r uvo;s0 rurim nu1aptnlieias artruront4oetnifetydla ulu s u0aetnmrctodfaDr ieolt) eum(m3ny4ale livsa(faDrm(rpou0optnii3tadfsDuauvo;t) eerio oydlmte i s t0 2to(mpou1op  mfcsat) 2umum ou1altnii3iytls2rlums u0teermo oo1lm  an s;t) etr(mpoydam n nvsls s2tr(rpou4aet miciadlsDrl(mpn(0 eeoxo3iadlptrlu s t texm(opno1lm n ictasfsDrrxrpoo1teenmieiyslmDeanvp;(4 etoir oo1faD luvi t tetm(opoy1am nlncslt) rra(mo;o4oeeomo3tysfs uanmp;u4treoio tadfptrlnvi t trtoiopoo4amtn netl() rurxr no4tlx  f3iys s el( onu4 lxrmr3ootomteluei;s  exrxopnodam  lfeta( srumum no1teenioctadfaDul( p;(4tetomrcoytop r uvs (0s2tm(mpoydaltelivi () rua(r ou0apeoioetatls emumon(0aexnxo totom   ivi s t2urim3oy1lmte fetat)aDtax p;o4opx mf3iasfs2rmums () rxrxfciytlpDe nvols s2trim3iodlmt lnvtls)sDraxmo;t4apt mi3iys aDrmnmo;t)arxoxocoydfp   ieo;t)s2tm(mpny1lmtnmivtlsfs2urxm ot1oee mieiasfs umnvpn() rerxo ia1op r uei;()tetm(r iu1aleelnesa() Dtmxront1aetomf3iltlaDuau s;()altoxr3tytlp rluei;s)t2uoir3nodlm nliesa(fsDtr(m ot1olto feiysfaDraumo u4 rtnmrcoa1fa elivi;()t2xrxm iudlm  liviasf Drm(rp;u0altomoetld sDrmuvo;u)aeenxr iodlp r uvs;t)t2toxrpny4altemfcslt)srtm(ro;t1apxn i3tas mDra(vont) ltomo oy1fa elivo ( s2um(r iu1lmee icia(faDrmurp;o0oet  i3iatlsDran ont4aeerxf3oy1lpt aueo;s0seum(r3iydomeelnvs (  2taxrpou1opto icilslsDra(mp t0trtrif3ty1oa r n s s seurim3nudalee ncias s2rmu  ;o1alxoifeilsfaDemuvo;(0texrmocio1fmtraiei ( truo(mpnu1ll  mfci ( aDua( p;u0aeeo ocias sDulu s;u4 rxomr3oadoaDr uesls)srum(mpiy1om nlncta(fsrtrx o;t0aetnio3iat mDraumo;u4arxomocoytfp eaivo;s s2urio3oudopeelfvs (  Dum(mpoo1tee moetys m2uluvpnu0tetnxf iatlmDe nei s seumir3iu4omtemfvils) 2tmur ;u1alt mfetatls uln o () lxnifctadlatrlneolt  rtrxo ny1ll  mfvilt)arua(mo;u0oeeo f3tys mDrmnvpn(0aleoxocoatoa raivi (0trxoxopnudlme livtat)srrrxr ;o4olxoifciytlmDeau p u)texrif ootlate nes;t0 2xmxo oodamenlietasfsrum(  no1oet mocias a em(msnu0 leoir iatlat  n ols)trxmio no4op emfetltf 2umx poo0oltoio3tytla elu o t) renxo oadomteau slt0teuoiopoydom n iesas s2ururpoo0oltnii3iadfa ea( onu)teermf3tytfm elnes (  eur(opny1ape  nctl(faDrmx pot0alen fcilsls2rlumo;u0trtnxf3iadomD  u s;(  etmxo iu4ame  ics t  2rm(mp;t0alt  oetys a2raumsnu) etrmf ia1optrauvi;t0teurio oo1ap eliei ( s2um(monu1alxnii3iat m rln o;u0aetomfcto1lat aieo s0srurxo3io4ome  nci tfa2taur oo1altn ictatfm ea( s;u)alxnmrciatfm   i o s0truo(m ou1ol  mieilt s2tmum nu4openiietysfm uln snt0 renifctodfm eanvi;s trtmxrpiudomtn feilt artm( ooo1aeeo iciasfa uanvont)tltoir3iatop  lnvs;t t2xmio3nudap e ivsls  Durxmoot4tpe  octatfs ra(vo;u4tltrmrcia1lat aneslt) 2xmxopno4ol elnvi sf Dtrx  nt0tltnmo3iyt s rlu o;(0 etoxf io1lpDr ivo (0texr(o3ny4omt  ieils  Dtm(monu1alxo iciatfmDemn ont) lxrifciodfp raneo t  rxrir oudoltnmfesasfs2ur(rpou0aleoifcias a emn pn()altnif3oy1opDelnvs;t  etmxopoy1ol  lnci s artmxmono0tpxn fciytla eauvpnu4trxrifcoodlp  lu i s0 rxrimpiydlmee nei ( arurxmpnu1apxnmo3tyd s2um( pnu4alxrif oytoa rai ol( s2xm(o no4ale lncias aDtm(rpoo0opeo ieiat mDemnms t0trxomo tadfm  au il(  eumxm3no1lpenmicils)arrmuro;u1tex mf3iltfa2emumsnt)tlxnifcoo1fptelnes;() rxm(r nudalt  fvt s aruaum oo1texnif3iadls2rln s;(4alxnmf ia1lpt  ivi t) eurxr no4apee iet s)aDrm(  oo1oltoiieild a2elnvs u0artoxf iydopt aueo s0setriopio1op n ieiatf 2tmumpnt1tlxnmfciyd aDuluvp;t4aetrir todlpDraneolt) exrxo3oo1lpe  feils)s2tm(mont1apt  o3iyt m2rmnmo (0trtnxr3tydfatelnvs;()tetoxr oydol  lnei t arrmxr no0altniieiyt s ul( o (4altnirciy1opteanvslt0 rum(o oudolenlivslt  rra(ronu0alx mi3iysfs rlnmp t4tetoio3oy1latrluvo s)t2ur(o nodal  lnvia(faDumumo;t1teeoio3ild sDul(mo;(0 lxoxocoy1lp raivs;s0 eurxr nodop  lnvi tf rrm(moot0tlx ifeias m2ua(ms;(0trxoxo ootlaD au i;( t2trxr ny4lpen fci s srtmu pot0olxniiciydls2rlu on() ltnif oa1omtelnesls0sexr(m ny1lmeemncsa(fsDum(m no4oex if3tysfa rmnmsnt0tltomfctydop r ieo;t) exmxopoudameelivsls srtrurp;o1tetn fciyt sDel(vp;()tlenmf ta1oatr uvolt)t2tr(m3oudomte fvsa( sDta(  nu1ole mi3tld m emn p;() exriociatom eau slt)truoio3iydomeemictlsf rum(r nt0optoiietydlm2emnvsnu0tlxnio iotfat  ivi s srto(rpio4openlncta( artm(m ;t0altnifetys s umuvo;(0trxrxr3tydfm  an i;t)srtrim3nodoltemfvia( arrmxmp;t1ape mi3iadfs2rm( o;u0aeeomocoydlmtr n ils  2trio3ny1am emfvs t aDta(r nt1tee mfeiyd m um( onu4alenio3tytfm r uvils0texoimpoo1lmeelnvta(  rum(mpnu0tpxoioetyd a ea( p;(0texoiocia1opDelivo s)s2trxr3iu4alee ncsls  rur(m ;u4olxoiicias sDelump u)arenmr3oytfpt li o;t0trurxr3no1ll n netat)s2urx p;o1tpeniociytfa uan snu4 rtrmo iatop  lieo;t  exrxr iodlltnmics s) 2um( p;t0aexo ociydla2um(mp;u) eenxo3todop rau il( s2xrir oy4ol nlfvi s) 2tmx  nu1oexoiociasls2ranvont0 rxnxrctotop rluvo s)seurxo nudlpee fvi s  Dtmxro;o4tlx mociyd a2rmn snu) rtnmo oodlmte nvo (0seuoio3nudll nlnetas)arrr(mpnu1tleoiieiydls rmump ()trxnircoa1fpDrln olt0 rxoio3iy1ap emnvtatfarumuro;o4tet mietatfmDuanmpnt0 rxomf3oytfa raueo s) rtmio3ou4om n fet (fa2taxr ;o0tetoiieiatlaDuln s;(0artnmo3iatfaDr uei s0sruoirpnudlm  lnvtls arurxr oo0oeeomfeiytfsDeanmo;u4 rtnir3tydom  lneo s  2toio3oy4apee neta()srrmu ono1oee if3iltlsDelump;t)tleomo iodop eai i;s sexmim3nudoltemneta(fsrtrumo;o4tetoioetls aDrlnmo;(0 lenxfcoadomDrluei;t0 2urir3nu4lleemnes s sDrr(mpnu0alt iiciydlmDeln p;u)tlerif3iatop r uvi;s0 exoxmpoudopte fct ( a2tr(mo;u0tptn i3ilsfm2elnvp;u4artnxr ta1opDr i o;t)truo(mpiu1lme lnvsls srrr(r ;u4tpt  oetltfsDeln p (0 rxrmocoadlaDean o ( t2ur(opno4amenlict ( aDtrx oou0tpx mi3ilslaDuauvon(4tetnxf3iadoateau ils)trtrir3oodll emnctlt a2rmxmpou0oetnii3tldls umumpn(0 rxnmfcoo1fptran o;() 2uoirpiy1ope  icta()aDrrum no4oex  ieiyd m umnmp;u4teenio oytoptr iei s)t2urir ny1lm e icil(fa2tr( oou0oltniictatfs2emuvo;t4 lenirciadfp e ivi;t)srxmxm3io4llen nvs t arrmxrp;o4open fcildfa2emu s (0 ltrxrcto1fatrli s;t0 rtoxr3ny1al n nvslt aDtr( p;t1aeen o3iltla rln p (4texoir3oatlpteluvolt srxr(r3iu1lp   fvia( a2ra(ronu1tlxn oeilslaDrlumo u4 rxomrciytoa eai olt)trtmxo ny1aptnlfcsas a2trxm nu4teto ietas mDeaump;(0alxoirctydlp elneil() 2xmio3oudom nlict sfsDur(rpnt0tltnmiciys aDra( pnu)teenmf oo1fmtrli o;() rxr(opoudlmenlici () rumuroou1oeeoiiciyd mDumnvo u0alxnirctotopt auvs t)s2xm(opno4omenlivta(f Dur(mpou1tle  octas m2rlums u)aexrmo3oodopt ai o s0srxmio ny4al emnei t)a2ur( o;o4tlt  ieiyd a2eanvp ()aexnifctatomDeln i;s t2um(o3io1apee ieils)a2uru pot0tlx  i3ildla rm(mo u)artoxrctatomt  uei t0 ruo(o3ou1ol elfciat)a2uaumo;t1teto ictldfmDul(ms;u0arxomr tatlpDrauvslt) 2ur(m3ou1ll   nvtasf rtax p;o0oexoifeiat a2rm(vo;(0 ltnxr ta1la  anvs s0texr(m oo1opeelfvtas)srrm(r ;u1aetn ieiydla emu onu4 renioctodfmt aieilt0t2toxm3nu4apee nciltfsDumu pot0aeen ieias a2rmu p t) eerircoodlp e n sls0texoxrpiu4amt lfcia(fsrra(  no4tpeo oeiatfmDranvp (0teerxocoatomDeanes;s) etoirpiydop emiciltfsrrmum ;o4oeen ieiyt m elumonu4alxoxo iadfa r ueilt0t2urxr iudope lietls) 2umxroot4texnmocilsla2ra(mp u4 leoxr3totfptrlivolt0teumiopny1llen fcil( sDta( p;u4ape  o3iydlsDumuvs;t0tetoir iydopDrlu sls)trxriopno4apenmieia(fsrumxmp;u0aexnmo3tadfs rm( p t0alermfciotom eanvs s  2urxrpiu4lltelictlt)srtaur ;t4aex ifetldlmDumuvp t)altrif iytop  li o;()sexrio ou1ap  livtltf rtrurpno4alt ioctls aDumuvp;(4arxrmf3tatfa rli ils  2xm(rpoy4ol nmicta( sDrrxmp;u1aeen ieild s rlnvp t0tetnmf oadopteaueo (0srumim oydamtemivil() 2rm(r no0altnmf3tydfm2eau o;(0areomo3oo1oateaneo;s0t2toio3nudam  mfcs t) Drmxmo;u0texn oeilsfs2ea(ms;t4 ltrif3iodfmD  uei s srxmio oo1lpe lfeils arur(mono4tlto iciadfa umums u0teerxf totomD anes;( seurir3no4llenmfesl( a2umxmp;t0tltnif3tysla elnmsnu0altomo3oatoatraivs t)texoxm oo1amtnmnvtls)arrax ooo0tpenii3tlsfs2ua( s;u0alenxf3todoat ln sls) exoio iy4ll  lietatf rta(r no1tltoioeiltfs2ra(vpn(4 eeoioctatlmDr ivs ( srtmxopoo1apt mneta(f 2um( o;o4aexomoctatfm rl(vo ()trtnif3ootfptr n o s0s2xmxr3no1olt mivslt) 2tau  nt1teeo oeildla2ean o;u0arerif3oydla  au s s)trto(m nudal  livs (faDraxmo;o0tpxo o3tatlaDrln p u4aexrifctydlm eauei t) 2umio3iy1aptelnvtlt  rrau  ou0tpeomfetlsfs elnvp;u4trxoif3oa1omteli sls  rxmxr nodlpt mncsas sDum( o;u1apenmf3iydls2rm( s t)trenmf to1lmt anvo;( tetmxopnodll n fct t)sDra(rp;o1aeeomieiasla2umumo;u4arxoir oatoat  uei t t2to(mpiydlp  mivs t arraxront4tleoio3iat s eanms;() exrifciydom  auvi (0s2xmxo oodal  lfct s arrmx poo1olxnmoetatfmDrm(vp;u0alxnmr3ty1fm  lnvi;(0trtrio3iodapen icias a2umxm no1teeomfeildfm uanmp (0teenmo tytlpDraivsls0 2trxrpnodame livils  rtmu p;o0olxnmoetydfm2umn pnt4aeerircoa1fa rln ilt)sexmio iodomenlnvi ( srtmxr ou1olto ietls m ul( s;t) etrif3iodfa elnvi ( seumxo oo1ol n ivias artr(mp;t0alxo ictls m2rm( p;(0 renmrctotlpD  n s s)sexoxmpoy4lptemfcta(  rtau p;t0olx mfetltfa2ea(mo t)tltomr3ta1oat ai ol( texm(r3oodope lncsasf 2ua(m ;t4tet mfeilt aDuanvsn()alxomf3ta1oaDr n i;( trxrirpnydalt mnet t)s2um(moou0oetnmfciadfmDemn p u4 etnxf ty1fmD aiei t srxmxr nu1lp  mfetlsfs2rmx  ot4teeniictlsfs uanvonu0 lxrmo3iydoaDrauvs (0 rtmio oo4llt lnvs ( aruaum nt4aet mfeildfsDum( onu4areoio to1lpteauvslt0 exmim oo4apte fvsl()aDurxm ;u0tpe mociysfsDeluvs t4alerxf ootoaDeauvo s0 exoio3oy4lmeemieiltfsDrm(rpnu0oex iiciytfsDemuvs (0 rtnirctatlp  lnes;t teumxm3oy4opte nvslsfaruaxmp;u0ope  ocilt mDrm(vo (0 eerxoctodoaDr u s;t)srxr(opiudllee ivsatfs2rax ont1apxomoctatfm umu o;u4teenxociatfaDeli o (0 exoxopou4ape mfci t  Dtm( pnu0ope  i3iys s2rl(vsnt) rtnmo3oo1fpD lu s;t t2uoirpnu1op elfetls srrmum ;t1oeenmo3ildfm rlnvs u0 rxrxo3iy1lptrau i;s0trtoimpoy1lptemictlt srtaumo;o0optnif3tyd m2ulu ont0trxnxrctodop  lues;s  2urxo3iodaltnmfcsls  2umxrpno0aptoioetyt sDum( onu0 exnxfciy1fat  neols)tetoxo no4apt lfes (farurum nu4tetnif3iyslm2rlu s t0tetnirciatlmte ivi (0 rtmiopno1oltnlfvia()sDtmu pot1oee mf3iyd mDrauvp u4altrmocia1lmDeanvo s srxo(m3iy4alt micsas)sDrrxmoou0opx mictltlaDuaumo () reomr3oodfpte ues;()sexrir oodoltemiet ()s2uaxmpnu0tpeoif3iadfm2ul(mo;(4tleoiociatomt  uei s  etrxopnudol  mictasfa2taur oo1olenifeiydls umums (4trtrif3iydopDeli ol(0 rurio3iu1om e ies () rtru  ou1aetn f3iltlaDumu s;()altnmf oytlaDr n o ()s2xoxo oydamte ictl( arrr(r ;u1tpe mi3iasfs ulu sn(4 exnxfctotopDeliei ( trxo(o iodaptelicsas) rumurpoo0olt iociydfsDuaumo t4aexoircoy1lm eauei;s0t2xr(opou4ap nmnctl(faDrmxmo;t0tet  ictadla umnvp;t) rermf3tatfa   nvilt0 rur(opou4olt  fvs ()s2ur( oou0aeenmi3iaslm2emuvo;(0tlxrmf ootopDelu i;s  2tm(opoo1olt mfvsat)a2umumoou1aeeo ieildls el(mp ()tlerio iatlatrluvo t s2xm(opny1ame miciltfa2ta(mpnu4ale ifetatfm ranvont4arerif3to1lmt lies (0 2tmiopiu4amee ictat aDua(  no0olxnmieildls2ra(vp u0arerxrcoadopD aneil(0 eumxm iydlmtnlict s s2rmu  ;u4aptnioctadfa2emumpnt4 rxrir3iodlmD  ieslt0t2xmxo3io4alt lnes tfsDuaxrpoo1tptn fciasfmDrln o (0 rtrmocoatfm eluvi t)t2trxo3oo4alenlivia(fsrtmxmpnt4aeeniocils s eln s;(0texrio oodopD  ueol(0teuoimpiu4op emneil()sDtrum ;o1olxnioetyd a2rmnmpnu0 leomfctatfmDr i sls  2trxmpiy1amte fvia() Dtaur ou1oeeo feiadfs rlu snu4 lxomf3totfmteau ilt)teto(o iydopenmncslt sDrax  ;o0tlxnmf3tysla em(ms;(4 etoxf3iadom  au i;(0t2tr(opnydol nlies (faDtr(monu0olto oeiaslmDumumpn()altnircoytfaDe ivilt)t2trimpiy1lpt  iei tfa2raurp;u4opxniiciasfm2eanvo t0 lxrmf3oydlpt  uvo t0 etrxo io4ap nmieiatfa2uau  no4openmfetydlm2uau s u)tetrmr oo1fm r u ols0 rtoxmpnydalt lfcia(fs2umxmp;o1texo oeildfs2el(vp;(0 rxrxo3ty1fm raivs;t sexrim3no4lp n nvia( s2rm(  ot0opeoioeiltfsDuan pnu) ltoifcoadlmtr iei;s0 2xoim io4opt lfvt t srua( p;t4oet  i3tltfm em(vpnu4 etoxr3oydfa r ueo s)texr(m no1open iviasfa2rmxrp;t1tetn octatfa2umn p u0trtnio3ta1laDeai i s s2tmxm oo4opeelnei () rtrxm ou0oleoiicilsfm2um(vsnt)tetrmf3oa1fmtr u i s)truo(opnu1ame lfvil(f Draur oo1apx ifciad a2rm(vo u4 lxrir3iy1oa r ieils trto(o no4lpt mivt (  Dtmxmonu4tptomfciysfa2um(ms;t4 ltomrctytfatr nvo;(  rur(m3oodllenmfeia(f rtmxm ou1aex  fctytfmDulnvo;t)alxnir tytfmD  uvslt srtoxo iu4amen nvi t s2tmxmpno4tpen o3tysfaDuln o;(0teeomf3ootlmDrlnvs () rurio iy4ll n fesas s2rmumonu1tet micilsfsDra( p ()areomo ty1laD aues s)s2triopiodlp nmivtat arur(mpot1aet miciyslmDeanvo;(4 rxomrctytfp   ieo;s0 eur(mpiu1om   iei tf Dtax p;u0ope  ietasls2ulnms;()alxnif iodfp r nes s0 rto(mpnu1amee fct s s2umxm ot0open o3iydfa rmn p;t4 rtrifcoadlptrlivo s0trxoxo io1apenlfvta(fsrta(mooo1tee ioetadfsDrl(vo u) exrxr3iadla e u s ()srtr(m ny4apte ivt (  Dum(root0oetn ociysfa2rln o;t)texrio totlmDeli i;s0seumio3nodop nmfvs t  2trurp;t0olx mociys m2umnmsnt4texrxr todfat aieo;() 2toxopou1oltnlnes (fa2um(mpou0aetnio3iytlmDuau ont4alxrircootom raivol() rumio3iy1ole mivsatfsrra(rpno0open o3iltlm eanvp;()tetnmoctatlaD lu o;s srumxo ny1opeelnct s) 2rmxrp;u0tex iiciat mDumnvo;(0texrif io1lpDe ivi;t) eum(o3oy4ameelictls srrrx  no0opt ioeiadlsDuanms ()treoxfcio1omD li s t0 2xrxm3io4al elnvt ()sDrmu pou0tle if3tat m2eaump;()artnxr ia1lptean ilt0s2xoxo3oydll nlnci t s2ta(  ou4olt ifetadfaDel( o;(4tleoxr oy1lm  aneslt0trtrxrpnu1ap  mietl( srtrur ot4olt mociytfm2em(vonu0aeenxf3iydlaD lnesl(0 exr(m iy1lmeeliet tf 2uaxrpnt4altoiieilsfaDemump t4aetrxf3oy1oate i o t)t2xrxo3iu4ame lfctlsf rtaxm ;o0tpx  i3tyd m el(vs;u4aeenxf3iodfa   uvsl(0trxrimpnu1ope lfcsat) rur( o;o0tlx moctldlm2ran on()texnxf3io1fm   nvil(0teuoio oodop e fcslt sDuaurono1opt mietas s2ul(mo (4altoio iatfm   u s;s0t2xr(mpny1altnlnci s) rrm(  ;u1aee miciysfa ran pnt4tlenxr iy1omt li s;t)t2uoxo3ny4lm n icil( s2urxm ;u0olto iciatfs2rlump;t0artoxo3ootoatrau i;()t2um(m3nudlpt  ivsltf 2tr( p;o4openmocild m2uau pn(0trerircty1lpDrln s;s seumim3no4ape miei t)s2ta( o;o4tleoiociydlm2elu s;t0trtomfctodlaDelieo s  rum(m3iu1oltemnctl()srumumonu4oeeomfciytlm2umuvp;u0 rtrircta1lmt an slt) eur(rpio4ape mfctlt  2rax o;u1tltn fciltfa eauvsnu)trtrmr3to1om r ivol()sexm(m nu4lmtnmnvtas sDraxmpou4aex  iciasls eanmo;(4teenio3ta1fpteau i;(0 euoim3nu1ale micsl(fs2rrump;o1alto f3iydlm em(vsn(4arxnio3tydfmDrlues ( trum(m iu1om emnvtlsfsrtm(mpot1alxnifeiytfmDraumo (0aexnxoctatfa   u s s0sexmir nydal elnes s)a2tr(rpnt4oexniociyslsDra(vp;u0 rxnmf iy1optr i s ()s2um(mpoydam elnci sfarumxr nt1opeo ociadlm2rlnvp u0 lerifciotfaD luvs ()trtoxmpny4am elictas)aDum(  ot0tpeomoetyd mDrl(mp u4 rtnmo3to1fpDr i slt trxoio iu1op nmfctas sDtmump;o4tetn fctysfs2ranvo u4arenxfcoadfa rlnvi ( srxrxmpiu4ll emnvslsfaDumuronu4tet mieiad a2umuvon()areoxo io1lmD  u s;t0 2uo(rpio4amenmivt (f 2ta( poo1ape ifetydfs ran p;(0 renifcootla eai o;s0 exmimpoodopt mictas  ruaxro;t4apeomoeiydfs el( p;(0 rxoir3oodfpD ln olt  2xoirpno4lle  netl( arraxmono4aptnifctytlaDean p u4teeomr3iatomDrai il() 2uoir3oydomt  fesa(f rrrxmpnt0teto ictld s2em( s;u0alxrmo3oy1fpteau o t  etmiopoudlmee fvs tfaDta(mo;u0oetomfciatfm ea(vsnu) rxrxo oatfpD  u i;()s2toim3iudolt lnet tfarua(monu4opto o3iadls2uan pn()arxnif3tytfm  li o ()t2umxr io4lltnlfvs sf rtaurpou1aptn oeiydls eauvp () reoif oydomte u i;(0trtmxrpio4lmee fctltfsrrmuro;t1apt io3iasfa ea(vo;t)arenmrcoo1fm  luvs;t)trxmiopiy4ame micsatf rrmxront0tpxo o3tydfmDrm( p;t4aetnmr3oadlpDrln sl( s2uoim3oo4olte ivtlt)sDtau  oo4olenif3iyt m ua(vo u4altrircio1oa   nei;()s2xoxm io4optn fesat) Dra(rp;t1opto oeiatfm rm(vo t4areoxr oy1opDe n o;()sruo(r3io1lmenmnesls)arrmur nt1tle  i3iatfs2rlu p u4alermocoo1oaDeli o;t trtriopiudll n ivilt) 2taxro;o0tlx miciasfmDeau o (4aeenir oytlmDe n s;s  rtrxm no4lmtn ict tf rrmu p;o0olx mi3iat aDra(mont4 lerif iytfm   u o;s srurio oy1lmt lnctlsf rtau onu0oex ioctyd m2eanmonu)altrxf ty1lmtelu ils0truriopoudamtemnvsasf 2rm(r ;o4oleomo3tas s2emnvo u)arxoxo ty1laDrln i t0t2xmxr3iodlptemivsl()a2tmum ;o4tpe mo3tad a umums;(4 lxoirciadla rlnvs;t)teuoir nu1llt mnctat a2rmx pnt0opxniietldfa2ran p t)alxnmfcio1oa elnes;( teurxrpiy4omtnmfei (fa2rau poo1aexoii3iyt mDrl(msnt0arxoircoatlmDeaiei t)srtr(r iydom   icslsfaDrruro;u4optnmicilt sDuanmont0aeerio3iodfa   ieilt) eum(opoo1al nlfcia()a2tau pnt4apen i3iadfmDum( p u4 rerxf oy1faDeanvi s t2xr(r nu1amt  ictas) 2rm(m nu4tlt ii3ilsla2ra(vs;(0trtrmr todoatrai i;()s2trxr3io4opeemncias  2rr( o;u4tet moeilt sDumuvs;(4 exrio3io1fmtelnvols0s2tmio oydol elnei sf Dtax  nt0aeen oeiltfm uanms;t) rxoxrctodfptr ues (0 rtrxr no1lptnmiesl(fsrtm(rono1tpe ifctlt m2em( snt4 etnircty1fmDran ol(0 etrxo3iodlm emfcs (fa2rmx pnt0apt ifetatfmDranvs;t4teenif3ootlmt luvils)trxmio iudolt livsat)a2urxmo;o0aptniociadfs2rl(vonu0tlxnxr3io1fpDeli o t s2xoxr oodlm   fctas artrur no4opxnmfctytfs ea(vo;u4arenmr iadom r ueo;s texo(m ou4ope mnctas srrmx oou4olxnifciyd aDul(mo t0trtomfcoatlm eaneo t)seumxm3iy1ope  ncil(fartm(m ;u1tetoiociysfa um( pn()alxomf3todoaD  nvs t)trtmio no4lmeemivt s)sDrmxr nu0tet  o3iad a2rm(mont0aexrmf oytlptelnes s setm(r3ny1lm  lieilsfsDtrxm nu1tpxoiociyt s2rlump;u0aexrxrciydla r nesls srxr(m3iy4ol elfvsl() 2tr(r nt1aexo oetldfs ulu pnu4teeoiocta1lpD anvs;t)s2xoio3nodlm  mivsl(f 2rr(monu1openmietyt a2eauvon()aleomrciadfp r ueolt0 exoxo3no4ome  fct t) 2tax onu1oeenifcildlm ul(vo t)tlxomr3oo1omt  ivs;t setoxrpiu4ll emietltf Drrump;u4tet  ictad aDrau pnu0aetnxociytoatrli s;s0teto(m3iu1lmen nvtas s2rmxrpnt0aetoifctytlm ul(mo;t4trtrif3ty1fm  luei s t2uoio oy4omt miet s)srurxm ot4tex  ictld a2um(mo t4 rerxo iy1omDr i sls0texrim3no1opt  iesl( a2rmum ;u4tpeoiietasls ulnvont4 eenmf oadfp elnesl() 2trxr3iy4am  mnci tf Duax poo0altomi3iydfsDea( ont) rtnmr tytomt liei;( srumirpnydllt  ncslsf rtrxmo;t0oeeoiociydfaDrln s;t0aetoiociydfatr ueols0 etoim iu4alenlivi t)artm(mp;t1aet  ociatfaDem(mo;u4 lenif ootlaD ln s t)s2xr(m3ou1lmeemfvi s) Dtau  nt1open oetysfsDranmo;(4tetrxr iadlmtrauei;(  rxrxr iodopte iesltf 2urxr ;t4oexn ociatlaDumu s;u0artoxo3totfateai o ()srtmxm no1altn ivi s) 2tm(rpnt0alt  f3tat s2rm(vonu4arenmr3iytlatr ieil() euoxo3ou4lpt  neslsfaDumxroou0apx if3tlt a ran o;u4tlxrxo3oo1oat ln o;t)srtrxr3no1lpeemiesls  Dua(m ;o0tlen feiatfmDulu o u4 rxrif3tydlmt  n o;s0trxm(m3oo4ame  ivsas  2uau poo1tptn f3tat a2em(vs t0aleoir iodlm e uvi t0trxm(o oydolen fcils  2ra(m ;t4oltn feils a emuvs (4 etrmoctytomDelueo s  2tmxmpno1omtn ieiat  2tm(m ;o1oetomictytlaDumu o t)tltrxf tydlmDelnvi;( s2xmxopny4al  lnci sfa2trx pno4ale mociat mDrl( sn(4altrxocia1om elivolt0sexrir3no4am  lnet ()s2tmxrpou4oltomo3tysls2eanvpn(4tlxniocootlmDr n s;()seuoxmpny1amt  fvtasfa2umu  ;t1tlx  oeiat a ulnvo u0 exnmo3io1laD  nes s)s2toxm3io1am elfcs ()a2rm(r nu1tlxoioetadla2um(vsnu0aeenif tatomDrln i;s)truoxmpou4lmenlicslt sDumu pou0oetomoctytls2rl(vpnt)trxrmo iadom r nes t0t2tr(opoudoleemfvslsfsrrmumpnu0tpeomoetyt s2ra(mp t)trerio todfa rlnvi s  exrxo oy4llt licslt sDuaxmpoo4oleo f3tydfs rlnms;t0arenmf iadlpt  nvsls tetmir io4al emnctatf 2ur(m ;u4tptnmi3iydlm el(vo;t4 lenmrciodfmDeai sl( tetoxopnu1ap elieilsf Dumu o;t4oetnmfctadfm el(mo (4artnmo iatlm elivo ()teur(r3oo1apt mictasfaDumu o;o0aeeniociyd s2ua( snu)tlxoio3oo1omteaies;s  2xoir iudapeelfet s)a2rmxmooo4olx  fciyt aDrm( on(0texnxrciydomtr neo () rxrxopiydaleemnci t arrrxr ;o0alxnif3iltla2el(mpnt) etomo3oadop eliei;t0 2to(opno4am emiei s)arrm(rpno0olxo oeiydfaDea(ms u4 exriocoytomte nvilt s2xrimpiy1lpeemnetls)s2rax  ;u1tpxo f3taslm ul(vs;u4altrxr3iadfp elies t s2tr(o3nydaptelfetat arrmx pnu1tptomociadfm2emums;()arermf3iy1omte nvol()srtrxmpno1apenlfeta(fsDrrurono0olxoio3iltls2uluvonu0 rtoifcoydfmD ln s;t0 exoimpoudll nlnvtlt  Dta(m no4alxnif3iydlaDuanmp u) etomf ootfa ranes;() rtmxo oy4ale mfvtlt artmx  no4olt  ieiasfm uln s;(0tlermoctodopD  i i;t s2trim3nydlm emncils)aDtaxmoot4opeomoctlslm ea(vo (4tetrxrcto1lp r u sls)s2xm(opno1ll  lnciasfarrr(r nt1tlxniieiad s2um(vo t4texnircio1op   ies;(0 exm(rpiy4altelnct s  rtr(ro;t4tltnmicildlm2rm(ms t0areoif iydoa e iei;s  2urir ny4opte fct t)sDurxroou0tptoiocils s2umn pnu4tlenmocoa1fmtraueilt)truoxopou1omtnmneiasf Drru  ot4apxn icias a2rl( s;(0 rxnxo oo1op r nvs t)srumir nydapte fci t  2trxm oo4aeeniocildfm2rmnvo ()texoxr todlpt  uvs ( srumim iu4llt lfet sfa2tm(mpou4ope  fciytls2ea(vo;t) ltrmf3iytop  ai i () rtrimpiu1apteliei s srraxrp;u0aexnmiciytfs rmuvo;(0 reoircoatlatraivs t) 2tmim oo1lm n ivia(faDtmur no0apx  i3tys m ea(mp;()alenmfctodop  anes;s  2tmxo iodlpenlnctas sDtm(  ;u1ole mf3tat aDua(mont0arerxocto1lpte nei;s)seur(r no1ale  fcs () 2trump;o1tltnioctas s umumon(4tlxrifcio1fatrlnei t s2to(mpnydaltemicsl(  2rrumpoo0texomoeildlm2rlu p t) etomf3iy1oa  aivo (  rxoio iudop  mfvsat srtaxm no1alxo i3ilslsDelu s ()tltnio3oytlp  an sls seuoxr nudop n iviatfsrrr( pot0tlx mfeiadlm2emnvs t0aeermr3oodlmteauei t0 2xr(o nodlmtn nvtls a2trx  ;u0optoio3iat a uln o t0 lxnio oadomt  ivsls)srtmxr3iodlleelfesl()aDraumpnu1aetomoetyd a rmn o u0 exoxr3to1faD luvols)srumir ny4ol emnvta() 2uru  oo4olxoiicilt m2eln pnu0tltnif3tydlmtr ies ( s2urir3oo1lpenlfcs ( s2ra(  ;o4tpt mi3ils a2rau o;(4aexnir3ty1opD aieil()setmio iodape lnctl( arrr(r ot1aex if3iltls rm( p;u0 leoxf io1fpDrluvo t s2tm(rpno4al elfesl(faDrr(mo;t4apto i3tldfmDra(ms t4 rtoif oatomDrlu sls trxo(mpoodopeelnesasfs2tm(r ou4openmiciyslaDemuvpnu4altrmocoa1fa elneols0 rtoir3ny1opte ncsas  2uaumont4altoioctlsla2ulnmp (0teerircoo1fa  anei t) exoxo iy1lm e fetl(fsrta(mp;t0oet moetld m el( s;t4alxnxf3tadom ranvi;()t2xrirpiudol   iei s  rrmuro;u1aex ioeiyt aDumn o (0 ltnxo tadlatr uei s) etoxr3iydam  lnet t a2rrumono4tleoio3tat m emnvs (0trxriocoodomt  n i t truoiopou4am   nvi s s2rrx  oo0tetoiiciat a2emnmsnu)aeeoxfciytlptranes s)trtmirpno1ameelfesa( srtau o;t0tlenif3iys aDemumpnu0altnir3oydfp r i i (0srtr(m ou4llee icslt)sDtrxmpou0oetnioctysfs eluvont) rxrxf ta1fa eanvi;t0texmim ny4amee ivilt arrmuro;o1alen f3iydls rluvo (4 rtnxr3tytlmtraues;(0srxm(rpio4altn ncs s)a2ra(ronu0aptoio3iatfs2rmn p t)aleniocoy1fmD ln i;s) 2tmxr no4ol  mfctltfaDra( pnu4tle moeiyt aDem(mp;(4aeerxfcia1om eauvo s  2tm(m3oy4ale  fvtl(faDtrurpnt4tee  oeilslm2eanms ()alxrmo3ty1fpDrauvi s  etoxr iodamee ieiltfs2tmuront0tpeo ieiasfsDrmu pnt0 etnmrcty1lmteluvo t0seum(r3no1lmtelnvsat sDraxrp;u4tetomf3ias m ea(ms;t4aexrmf ootoaDe ivi (0sexoio3iu4ol nmncsls  rra( pno1ole mi3ilt a2rl(mon(0arerif tydlmD lnei;t)t2trxo3no1lleelfet sf rumxmont4tpt ioeiasfsDumnmpnu0arenmocio1faDeau ols)seumxm oy4ol nlicils  2uax  ;t4optoio3ils m ulump;u)alxoxr3iatlp r i o t)s2xrxm nydllt  fvil()sDtmumooo1tlxoioetydls2el( snt4 etomo iy1fpDran o s  rxoxr3iy1apenmfetlt)aDumu  ot4tltnmfetatfaDrlnvo t)altnir3io1fpD  u ols0 2xriopny1lpt mfesas s2tau poo0aet mf3iaslsDeanvon(4 rtnio3iydomDeli ol( trxoir3iydomtnlivtlsf Drmumoot4aeeo fctltfmDean ont4alxrxf3iadlmt  u o ( s2urxm3nodamenmnctas) 2tru o;u1aetomietldls elnmp (0tlermr3oydomte uvo ()t2umxm oodllt lfesl( a2rr(rp;t1opxomi3tydlaDrmuvpnu0teerir3tydlaD  nvil(  eumxmpou4llee nes tfa2ra(r ;o4alto o3iat s2rmu o t0 etrmr ty1fpDrau o t0srxmxmpiu4ap  mivt sf rumxm nu0alx mieiys a2emnmp;u4 ltoir iydlmDe i o s  ruoxm3ny1llte fesa(faDrru pou4oeeomocild mDumn ont) ltnxrcoa1oaD ai o;( trxr(r3ou1ome mfci t) 2rrur no0oleomoetls s umnmpn() lxnmo3totopD lieolt0 2xmim3io4lltnmicsls) rtaump;o1oeeo feilslsDel(mo u4 rxoio totfaDelneol(0 exrimpoy1ap nmfvtat)aDrmxmpoo0olx  i3ild a ranvsn()aexoir3oydoate i s;s)s2um(r io1lm n fes sf 2uru p;u1oetnmi3taslmDumumsnt0tltniociadfpDe u o;(  2xrxm3nydlme mfeta(  Drrx pno0alxoifciytfaDel( s t0areomrcoydfmDrlieilt s2xr(m3iu4ame mnvsls sDur(mpot1oexnif3ilsfm2uanvo;t4 lxnio to1lp   i i;t0 rumim3nu1lpenmneiat aDuax  ou1oltomoeiasfm2eauvpnu4 rermrciodomt lnvo;t t2trxmpiydoptemnvtas arraur ;t1tptomfciytfs2rmuvs (4aetoirctytfa  aivi s)truoxm3oo1optnlivs t srtru pou4oeenmoetadla rmuvpn(4arxoircio1lmDr nvi;s)seuoir no1lp n iesl(faDtru  nt0aeenmi3ild m2emnmp ()treoxf3ia1laD anvs;s s2xmio3ou4am  lfet t)arrrxr ;o4tlt mi3iadfm rl( o;(0trtnio3oadlmt  ueols)setm(o3no4lleemfet s srtrx pnt4ope mieiytlaDumuvo;u4tlxnifciytfptelivslt sexmxo ny1lmenmncta(faruaump;u1texnmictldls um( on(0 exrxf3tadlaDeaies ( sruoiopiu4lmtn fci t a2taxrpou0apeo ietltfm rau sn() rtrif tadlatrlu s s0s2tr(o3iu1ape lieil()arrm( pnu1oleo fcilsls2rm( p;()trtomfciotom e neolt0s2uoir nydlmtemfcsl() 2umxm ;o0aexo o3tltls uanvp t0 ltomf3todlpt ln il()trxr(rpoo1lm elivs ( aDtmx oou1tlenio3iydla uluvonu4tlerif to1omt  n sls)tetrimpoo4omtnmfesat  2um(  no1aee iictltlsDeanvp t4altnir3todfa e u slt)t2tr(mpny1al n fesat)srraxrpnt4ope  oetltlm ranmonu4altoxr iatla e n i;(0srtm(o ou4alt  ncs ( s2ra(mpno4olto o3iatfm uluvo u4tetrxr3tytomDr nei;t seuo(opoo1apenmfet t  Dum(root0alxn f3iasls2raump u)tltnxrctadom eaieolt trxo(opny4om e fvsa(  2trurooo4tptoio3tltfa2el( s u4texnmo tydlm rlueol()trtrir3ny1am nmnet s arrmuronu0oltniietys a rlu p t) exrxfctotfaDr ueo (0srxo(m3oo4lp nlnvs s arur(r ot0tlto iciysls umnvpnt4altrxfcoadfa eln olt truo(m nu1ol elfes (  rtru o;u4oetnmi3tldlsDum( s;t4areomo3iytlptelu olt  eurirpno4oltnlfcils s2raumono0alxomi3iytlm2rluvs t) exrio todom eaivolt s2tmxm no4lp  mnesltfs2ua(m ;o0tlt ifciaslsDulump;()aexoir oatfpt li s;()sexm(rpiydoltelnetl(f 2raxrp;u0opt if3tatfmDum(vont0trenif to1fmt  nvol()s2uoxopiydlm  micsa( srtmx ooo0alxo ieiatfm ranvonu0 eenmociotomt  u i s0sexmxo oy4aleelnei t s2rmum ;o4oeeo fciasls um(mp;(4aetomoctytlpD ai il(  2uoxrpiy1llt mnvt (  Drax o;t4teeniiciyd a2eau snt0aexoxrcoydfpD lnvo;() eto(r3oudapenmnvtas)aDrmu ont0aexnioeiyt s elumo;t) reoxo ootomt lu s s)setoiopno1amtnlncias a2tm(ro;u4tle  iciytfm ranmpnt)trxrif3ootfmDe uvo t sexrir3oo1ap   fvil( a2rm(rp;t0texn oeildfaDuaumo;u0teeoxf tatfpD  u i t)texoirpnu4optn ivtasfartmxm ou4tltnmoetasfa ran pnt) rxomr iatfpt lu olt teurxo3io4ll n fesls s2tmxrono4tpxomictltlaDumnvsnu) ltrxf3oytfmtr nes;t0texrxr io1lltn nctas srrru p;t0optoiocilslm2ran p;t4arxrif iadfaDeaneilt  2xo(m3iu1lltnmfeta(f rum(ro;u4alxnio3ilslm2ul( pnu4trxnmo oodoaD  u ils t2uo(opiodame  ivsl() Dum(monu4aeeo f3ild a ulnmsn(4trtnxr3io1oaD ln i s0t2to(r nu1llt  ivils a2rrum nu4tleoio3iysla2ranvonu4teenxf io1lmtr uvs ( setrxm3nudomen fcs s aruaxm nu0tlxoioeiatfa ul(vp;(4tetrif ta1lmDeai i;( trxrxr3oo4lleemneias  2urx oou1olto oeiasfa2eau pnt)altnmr oo1lat lnvs;s0t2tm(o3ou1olt mfvsltf Duax pno0opt mo3iydlm ulnmo (0arxnmo3ootlmteln il(  euo(o oudlme lneilsfsDtr(monu1oetn o3ias aDrluvo t) exrxocto1opteluvi;s0srxmxo ou4lptnlfetasfa2rm( pnt1texoio3iyt a uan snu4tltrxo oadlmtrlivo (0seuoxm nydal e nesa()s2umu  ou1altomoeiasfsDuauvp t4alenxf3oytfm eauvi t)t2xrxr oudll  lieilt)a2uaxrpnu4tle mocilsfa2uluvon() rtrmrcoytlpD  ivsls  2tm(opio1optelncia()aDrm(m ;o1oetomfcildlm eanmp u)teermr3oydomD au s;t  rxoir oy1amtn fet tf 2tr(moou4tpeoifeiadlsDraumo t0 rtoxf3iydfmt lnvs s s2urxm3oy4omtnliciltf 2uau poo4opt iocildlaDuluvp;u0 etoxocia1lpDe nvs;s0srtmiopno1omtn ivt s) Dur(mp;t0tetnmfctatfs rmnmp () reomo3ta1oatrluvs s)trurio3no4lmeemfcsas)sDumurpnt4olt  ictys sDraums t0altrxfcio1oatelnvs;t teto(o io1altemnei (fsDuru  ot0apenmfeiat sDumnmsnu0 eerxf iytfpDr ivils)trxmxm oo4ol elictat)a2ua(r ;t1ole  oeiad sDuln o t4 rxrir ootlmte uvo t t2um(rpio4ll   feils)sDrmu pnt1oeeoifctltlm2emnvon(0 rxniocootlm eln sls0 rtrimpiu4lltnlfvilt)artmumont1opxomfeias a2eluvo;u4texnif tytlmtraueo t0 2toxr ou4op   nvt sfa2tm(r nu0oexoiieiltfa2rmn pnt) lxoxf oodoat aies;t t2xo(rpoo4lme lfetltfs2uaur ot0aet ifciatfsDrmnvs ()aexoxrciatfmteaivo;t0sexoio3oo4ll n feta()a2rrx pno4alt iocils mDul(msnt0artnio tydlm  aueol(  2umim iudaltnlnetlsfsDrmxrpou1olxn fetldfs umnmo u)trxnmrcoytfpt lu i;s0sruoxm3ou1openlfvt t)s2rru  nt1tpxomfeiasfm rlumpn()alxomo3ia1fpt  ies s0 rurio ou4op   fcs ( s2trxmoou1tpe  fctld a rmnmp u4texoif oa1fptrln i;s0 rtmxm3iodlme lnetasfa2rau  nt0tetomi3ilsfa rl( s;t4arxomr tytlp rli s () 2tm(rpiodaptnmfcta( a2ua(rp;t4oexomfeiad s emn pnt0 ltrmrcoa1lm r u s t0truriopiu1aptemfeil( sruax ont0tex mocilsfmDumnmo u0 ltrir3io1lmt lu s s0s2trxr iy4open nvilt aDrrumpno1aexnmo3tydfm2rlnms ()aetoifctotlmtr ies;s0t2xmxo nydlmeemfeta()aDtm(root0alt  o3tys s2ul(vo;(4teenxfciatop rln o;s seuoxopnudlltn neslt a2uru  ;u0apeoioeild sDumn s;t4altnxocoydlaDrlneo;(  2trirpou4apt mfet t  rrau o;o0aeeo o3tld m2ran s;t0 lxoxf ta1oa  lu i s0setoiopiu1omt mnviltfa2rm(mo;o1oleoiietlt mDrlnmpn(0 exoif3tydlptean i;s)t2xo(o ny1om  mnvia(  2ur( poo1aex mi3iys s2rl(vs ()treoif3iatfa rluvs;s0texoxo3iu1op elicsl() rrrxm no4tpxnmoetyt a rau p ()tlenmocoy1omDrluvs s0 rxoir3oydamtemnctlsfs2rax oot0aeeomictldfm2em(vs;t4 eerircoytlatean olt)trtoxr nu4ol  mfvt () Duru ont1teen feiad m uanvp t0aexrmf iadfmDrai s;t)teurxm3io4ameemnesatfsDumxm no1alenmf3iys sDeanvs t4tltrmr to1omDr nvolt0 2xoxo oo4op e neslsf 2rrumoou0alx ii3tytlm uanmsnu0aleoiocio1lptelnei;t)srtoxr3ny1am e fvtlt)aruaurpno1tpxnifetyslaDrl(vo;(4trtoxr io1fptelu i;()srxoxm ou4oltelnesat aDrax pno4tpeomietltlm rmump t0texoxf3iotlp  ln s s0s2xmimpoydaltnmfet (fsrum(moou4opt ioctatlaDrlnvo (4tetnmfciatfmDeaneolt t2trxopnudameemfeiltfsrtaxrp;t1optniiciysfa2ulnvp;u)texomr3ootfaDean s;s  rxm(o io4ameemfctls arrmxronu0olenmf3tyd a2ra(mo (4 lxrxocoo1lateauvsl(0sexo(mpiu4openlfct ( srtax poo1oex  fetydls ean pnu0tlermfcoo1om e u ilt)trxrio3iodop  mfct t) 2raxr oo1tex  ieiaslm2rlu pnt0 lxniociodfpDrau ol( srtoxr3nydale  ivtlsfa2um(mpou1altnmoeiaslsDrmn pn()tlxnmf3iatfmDe uvs t0texmir3iu4optnlfcilt sDua(m oo0aet ii3iad s ul(vp;u4 eermo oydlmte uei;(0 eumim no1ope lnvtas  2ra(rpou0aptniictatfsDrmn ont) lenmr3totoat  i s;t0seuriopoo1lle lnct sfs2ua(rp;t0aee iociad s el(mpn(4 exrmr iadlmD lies;s  eumxr nudam  mivia(faDraxr ;u1alxomf3tyd a uanvs ()tlermr oo1fmteau s;s0texo(r3iy4op n ivs tfsDrmump;u0aet mocildfa2elnvo ()trxomrctatoatrauvi s0 rur(rpoy1op  mnctas)srrr( oot4oetnmfciydfa eaums;() etnmo totla   u s;s0 2tmxm3iu1op n feias) Dra(rpoo0alxn oetls aDemnvp;(0artrxf3to1la  an s t0 exr(mpno1lpt lnvt () Dumxmono4optniiciysfm rmuvo u)aeermo3oadom eaiei s0 rtmxm3iu1apeemnet sfaDrr( o;t4tex  feiysls2rluvsnu)tlxnioctydom eaivs;t trum(o3nodame mnct ( arumx oot0apx mfctys sDranmp;t) etrmr3iotlp rluesl(0 2xriopny4al e neta()a2tr(  oo4opxoiocildla umu on(0 lxrxo3oytfptrauvi ( tetrxr3iu1lpenmfesat)a2urxrpot0apen oeiydfm ulnvp;(0 rxoxr3iy1omDe uvi;s)trur(r nodomeemneiat)a2trxrono4texomi3iyslmDem(vs;t4arxnxr iotlpte uvols s2xo(r3oo4ap e fviltfarrax  ou0apenmfetasfm emn ont4 exoxrcoy1lmD  ueilt)s2umxm3ou1lpeelietatfarurx  ot4texo ieiad s2elnvp t0arxrmfctatlm eau ils)trxo(r ou4ole mnvsa()arrrur no0olxoifeiydfaDra(mp;(0aeeomr3ia1oateaies ( texr(m iydomt mfesa( srtmumpnu0apen octysla uan ont)artnxfcto1fpD lneslt)t2trirpiydoptn nctat)sDtaurpot0tet ioeiad s ua(vsn(4altrxoctydop  li o;t  rtrxo io1aptemnvt s s2rrx  ou4ape mictlsfmDrmumonu4trtrir3tadoaDrlies;t)srxmxmpio4lm nmicias)sDrrxrpnt0alxo i3ias a2umnmo;u) etnif ootlm  luvo;(0sexr(o ny4lltn iet t sDua(r nu1aptn i3iydfa ra(mo u0trtnmoctodop r ies;(0 2um(opiodom n ietl( sDrau oot4aetn fciysfs2ulu o;u4aeenxf3iytomDraivil(  2xmio3io1am n nei s)sDuaum ;o4altomoeiytfm ra(vsnt0altoxf3iy1oa rlnvsl(0seuoim3oydomenlivtl( sDrmu p;u4aet ifciatla ul( p;u0alxnio iytlmt li il(0 exm(mpoydop nlivsas)aDtru pnt4tpe io3tysfsDulu s;(0 lenmr3tydoateaivo t srxmxmpiu4omeemfvsa() rrrur ou1olxoioeiaslsDua(vo t0tlxoir oodoa  lnvs;s trxoxopiudop   fvil( srua(mpnt0tltomiciyslaDemn ont0 rerio3oy1fmD aueo;s  etr(r no1ale mnci ()sDrmurp;u4oexoii3iysla2ua(vp;t)aeenmfcoa1fpt ai il(0 exmxopoo4ape mivta()sDtru p;t4tlenmoetysla ea(msnu)tltrxo3to1fmDr nvil()tetoxo nydal  mictlsfs2taxr oo0tetn oeias a2em(vp;t4texnxo totlatrai o;t0trxrir3ny4aptn nci tfarurxm nu0tlt mieiasla elnmsn(4artnxrcta1fpt au s (0 exoimpiy4olen fvtlt aDumu pnt4teenmo3ilslaDrln snt4trerxf tytfa  an i t0 eto(opny1lpeemietls  Dtmu pnu4ole mietatfm2rlu o (4 rtoxfcoodomt ai ilt s2uoir io1oleemfcs ()artru pou4olxomf3tyt s rl( on(0 etrirctydoaDeln o (0 ruoxopiu1alen fetlt) 2rr(ro;t0oet miciytfm2ua( s;u0trenifciotfaD  nvslt0 etm(mpno4ol  lnvi (fsDua(m ;u4alto ieiyd mDrl(vo u0 renio3iadlm  auesls s2xoxmpnydam e ncsasfartrxmp;t1opxnii3iytlaDum(vpnt4artrxocoodlm raivi s)s2xoxo nydomtnmiei (f 2urump;o0tlt mictytfmDuln pn(4 ltriociytop e u ilt setrxmpnu1omt  nvs tfsrtauro;u0alt mo3iad m rlnms;t4tlenmo oadoa r n o;t sexrxr3oo4op nlnctatfaDrru o;u0aet  ictadfs2uau s;u)tleoir3ta1lmD ai i t t2xoxmpiy1apte fcias  Dtmur nu4tpenioetlsfm2eaump u4 eerxocoytoaDrluei (0setmxopnudape lictasfsrum(r ot4tlxnmfcild s2rmn o;t0 ltnxo3oo1fpDrlnei ( texm(o ny1ope mfvtls) Dtax oou4oet iociltfs2ua(vpnu) exnxo3iytfpDe uvs;( s2urxmpiu4lltemnvi t  Dtr(  ot0tee if3tlt a2ra(mpnu0arenir totlm r ueo;t s2xrim3ou1altn fvsasfsDraxrpnu0tlto i3tldlmDranmo;(4alermf tadom  livsl(0t2toirpnu1ale livs s sruaum no1aleo iciyt sDumn o ()artomf3ia1latrlieo t s2xr(o nu4apen iei tfsDumurpno0tlxoifcild a2emuvsnu0trtrxr3iydfpDelu s ()s2um(opiudomenlfciatf Dtmxronu4teeo iciltfm2ua( s;u)alxoxo oydlpt  ivs t) exoim iy4apeemfviat  2rrxmooo0olt  ociat m2ea(monu4teerir ty1opteai i (0s2xm(r ny1omt  fcta( a2umumoou0altnmfeiydls um(vo t4trtrmo3iy1lmt aivo (  eurim no4amee fei s)aDtaxront1olxoioeiydfa ea(vont0 eerxoctydlpD  nvo;(0s2tmxm oy4ol   fvsa()arta(mpoo0tlt ifetasls ea(vo (4trxoio iodomD au s;s)setm(m oy4olt lics sfa2ur(moou1apt ifetyd a el( o (0alxrxo3iadla r ueo;t truoim3nydoleelncsa()a2trxm nu1aetnif3iytlaDel(mpnu) lermf iytfaD  n o;(0 rtrio3oy1omt miet s) Dtru pot1oex ifeiadfaDumnms u0texnxfcoa1la raieo;s  exoir iudamen nvi s)arua(m ot4tpxniociys m em(vpn(4 etrir3ty1fa rai s t)teuoxm3oydal emies s) rtmxrp;o1teto o3iadfa uaums ()teermocoydomte n o ( trur(rpnydal  lnet s) rrmx oou1olxniictasla um(mp t4 rtrif3totfp  au o;(  2tmiopiy4lp elfeiat)s2rmxmpot4oexnmf3tatlm ul(vp;t)aleoircoadlpD lnvils  2xmir3oo1omt mnvtas)srtr(r oo1tee  ieiysfmDumuvonu0alerxr tadfmD  n ols0truoxm nu4am elnet s arrmuro;o4aeto fctadfaDeau s (4aleoir to1omt anvilt tetmxo3iu1lmtelietas a2ra( p;u4olx ifctadfmDumu pnt0 eerif iatlpD auvol( srurxo3oodam emncsls)sDurum ou4optnii3ild a2uluvp;()tlenio3tydoa r u s s)srxoiopny4ope  fcs t)srtau  nt4ape iieiat m2ulnvsnt4 rtomo3iydfa   u ols) ruo(o ou1ol  miesl(fa2urump;o0aeto iciydfa ea( s;u0trxrxo3iotfmtelieo;s0t2xo(opoudaptnmfvsasf 2rrur no4oetoiieild m rau pnt4 rxoxrciytomD ai ilt0s2urxm nu4ope mncilsfsrrau p;t4tpxoifctldlmDum(mon() etnio3io1lp eau o;s  exm(r3no1opeelnvi ( sDtmu p;u0teen octlslm2ua(vs;u4aexnifcoy1oate uei;t s2uo(r iu4ol elivsasfa2uaxm nt0opxomociasla2em( p;t4 etoxfctotlaD aivolt  rtrio3oy1lm e ietltf Dur(rooo4optoif3tytlsDem(msnt) rerxrcoytlaDe iei s) eurim no1ol e nvsls)s2rmxrp;o1ape  i3iat s2um( o;u4trtnmf3iatlptrau sls trtoxm3nu1op elivtl( arra(monu4alxoio3iysla umu on(0 reomrctytlp r nvi t s2tmim3oydlp nmncsatf rrmur ;t4aet mietytfs ranvpnt4 rtoif iotfptr uvi;s0trtm(opiydamtnmnet t sDurxr oo0tpxnmoctys m uanmo (4trerir3oadomtr ues t)srxo(o nydalenlnvilt)srrrxm ;o4apt  iciyslmDemuvo ()tetoxrcootoatr ueilt0texrxr io4aleelfcsasfsrtrx oou4apenmoeiyt sDua( snu4trtnmf3iy1fmteaivo;s0srxoxopoudomenmiviasfsrtax p;o0oeenio3iyt m2el(ms (0aeermo iatlm rauvs;s)srxmxopiy4aptemnctl(fs2rrxmpnu4aee  fctltfs eanvsn(4 exnmo3io1lat aieo t  2urim3iudopeemnctat sDrrum ot1apx mfetys a emumpn(4altoir3io1lptr uesls0sruoio3iy1apenlivs s  2rrur ot4olt mieiatfa ua(ms (0teeoircoytlmtean i t t2uoir3iy4amt  nvsa( sDurx pnt0opeoio3ias sDeaumo u4trtrmoctodlmDrlueil(0s2trxmpoodol emneia( a2rmx oou4aetomociadls2rlnvsnu) ltrxf3oadlpt livi;s s2uoio nydopt mict t) rtaum nt4alt ifctldfa emuvp (0aeerxf iy1laD luvilt texoir3oodapt lneilsf 2urxm ;u0tpxn feiys m ranvs;u)alerxo3ia1lpt  n o s srumir3iydape mnesat s2tr(  no1aeen feiyt m uaums;(4arenxrctodlmtr u il( trtrirpoo4lltnmiviat  2ra(m ;o0tpxoifctltfa2em( s t4tlxnxfcia1om  an ol(0t2uo(r3oy1omee ivil()srtmxrpou4tetoiiciat mDrmnvsn(4altrxr3oy1oatr u i t0texoxm oy4ap n ivilsf Dumxr ou1tpto octatlmDel(mon()texnir3iadomtr nvs s)t2uoxrpiu1ll n fesa(f ruaxm ou0aet  i3iyd mDumuvs;u4 exnmo iytoptr u il(0seumim iodop e fctat) ruaxmono4tlxnio3iyt a2elnmo;u0trtoxo3iotfmD lu ilt0 2trimpnodop  mfei t)aDuaumpnu1tpxo ieiadfsDrmnvp;t4 exnmf3ta1om raueo () 2tmir3nodopte ici (f 2ra(rpoo4tet mo3iatfa umu pn(0trtoxociy1oaD li slt t2xr(r3ny1alee ncsas)aDra(m nt4texomociadls2rl( snu4tetrircoa1omD auvo (0trurxmpnydllte fvias sDtmx  no4tpeoifeiydfs2uan s;(0alenxfcta1fpte uvi;(0srtrxopno4lptnliet s)sDra( poo4tlenmfetytfa rl( s u)aexnif3iy1fpDeli olt0tetoir iu4ape mnciat  rua(moou4opto fctadfaDelumpnu4 rxnmo oytoaDelnvs t setoxo3ny4lptnlnei tfarta(m nu0apt iiciyt s2elumo (4aetoxr iy1lp e ueilt0teuoirpiy4optemnvi (  Draurpno0tpx iicilslmDrau s;()aetrxocoatfm rluvilt  rumxo oo1alen fvt t)srum(mp;t1opxoiiciasfs2ul(ms u4 renif iy1fm r nei (0 rxmxr3ny1ol nmnci s)a2umx p;o0ale ii3tyd a rlums;u)arxnmo3io1fmDr nvolt  rxoxm3no1lp  lnetlt aDra( oot0tee mfciltlaDra(vsnt) rxrxrctadlmDe ivsls srxoim3ou4llenmnctas sruaumpot4opxomo3iadlaDulnvon()areoir todom  luvolt0trxm(m oodom nmnetat)aDrm(  ot4tpeomf3tyd m2umnvs t) lermr3ta1lp  au ilt setr(rpoy4omt mnciat) Dur(roou0aptomf3iydlm rl(msnt)tetrifcootfpDeln o;t0srtmxrpiudalt mivsat)srtaxmp;o0oeeoifeiytls rm(mp t4treoxfctodoa e n o s0t2toir nu4lmee nvsa( a2ra(ro;t1alt  octlslaDul( o;u)trtrmo iatfp  ai i ()srtrxr3oo1al n icta() rumx  ou1alx moetldla emu p u) lermocoytfm ran s t0 rurxopno4amee ivslsfarraxr ot1tlxomocils m em( pnu4alxnmfcootfpteau sls  2urxm3oo4omeemiesl( s2tmxr ;o4ole  feiadls2ranms (4 renxr io1lmtraneo;( seumxr nu4lmtelncilsfartrumono4aexoio3iasfs ul( o;t)artomr io1fmt lnvols0t2um(o iydamenmies t arumur ;o1altnmiciysfaDumn p;(4texrmr oadoaD anvi;t) 2urxo3io4aptnmictas)sDrmxmooo1oltoifcias sDemuvo;(4arxrxo ootlat  nvi;(  etmim iudlm  lici ( sDrrumo;o4altn ociys mDuan pnt)texriocoadoptr ivo;( srxoir3io4ll elfetl( sruax  nt4open ieiys mDeluvsnu) renxrciy1lp ranvi s0trurim ou1aleemneiasfs2raxm ot0aeto i3iydfm uan s;t0texoxo ty1oa eau sl( texm(o3iudlmtelietls)artrxrono1aexoii3iltfa2uanvsnt)trtomf ootlpte neo;t0sexo(r3oodoltn ncs t sDrmu  ;t0ale moetyslmDranmo (4arxrmo iodfmD aivil(0srtr(rpiodopenmivsasfsrumum oo4tlto o3ildfsDuln s u4tlenxo io1fp elues;s0 2urirpnydap e iei ()arrrxr ;u0tlenmoetltfm2ulumpnu4teeomr todlpD  u s;t0 euo(r3iy1ape  ict sf Durur ;o4altn iciys mDrmn s u4 eeoir totlmDe uei;()seuoxr iy4al emnvilt s2taxr ;u0tlen ietlt s2eaump t4 rxnirciadlmtranvo s  2xo(opoo1om  lfvs t)arrru pnu1apxnif3taslsDrmnvont)tlerxf todoa  lueo s0srxmim3nu1ll  lfeslt)a2uaum ou1oexnmociyt m2rlnvs (0texnxf3oodfp  anvolt s2xr(mpoydalenlnvtatfsDrrxmpnu4olxomfciaslaDea(ms;t)teermr3iytfaDraiei;s) etrxrpoodome  netas  Duaxr nt0apxo ieiadfaDranmsnu)aexnmo iydlaDelieilt0s2trxrpoo1ol e ivtasfsruaxr ;u4tlenif3tatfa ra(mon(4aetnmf3oa1fa eln o;s) rxo(mpiodlmee ics (  rumxmpot1tetn ictys a ranvp;u0alxomrctydomt lu sls) rxoio3oo4olee ieias  2ur(r ;u4tlen fctadfaDeanms u0tltoio3io1opDe u s s)setrim io4om   iesas)sDua(rp;o1olxomf3iatla rm(ms (0tlxnxfctotfat anvo s) 2urxrpoydop  lfeias)aDuauro;t0oltnii3tat aDua(vpn(4 rxrmocoytfmD  nvo;t) rxmimpoy4llt livil()sDtax o;u4aexomfciltla emnmo ()alxrmo3tadopD anvslt  ruo(m io4omtnmnvsl( sDum( pou0apxniietld s uln o u0 rtrmf oa1oa raues t) rumxo3iu4lmt  nci t)sDumum ot0tlxoiieilsfm rmn sn()aleoirciadoa rlu sls0seumir3ny4llenlfct t)s2rm(roou4oeenmfeiat s ran s;t0tetnifcto1late iei ( teurio3nodlme  fvs t aDrr(r ot1ole  ictysls ul( sn(0 ltomrctytfpt anei t)s2tmirpio1lle  neia(fs2rmurpnu0ope  f3iltfa2eauvsnu0treoxf iadomDr i o s tetriopno4lpee fciatfsrur( p;t0oltn octld s ua(vo;u0aexnif oo1lpD anvils0srxrxmpny4ll elieils sDtrumo;o0alxo feiatlaDrlu o ()trtnxo oa1fmDrlivi;s  rxrio no1apte ivtls  2urxm nt4ale  ociad m eauvsnu)trxrio ootlmt lues (  eumiopio4omenlnciatfa2uaxmpno0aeenmi3iatfa2ea( o (0tetniocoodfmDeaneilt0trto(r3ou1lmee ivi (  2urxrono0apenifciatfm em(vp t4aetomr3ootfptrli ils0t2xrirpno4ol elnvi t  2rrur ot4aleoii3iyt a el( p t)aetrxfcoydoate ueo t0t2to(r3nodap   nci tfaruau  ;u4aleoio3tlt mDranms u0texrmf3totfpD lu sls0 etmim oo1olt  fci ( arra(m ot0aetn i3iad sDeauvp;(0tleniociydfaDeaneolt s2xoiopiodlle livs ()artmxmp;u4apxo ieildfm2um( p () rxrxfciatomDrln i;t  2xr(r3oy4oleemfct t) 2tmxrpoo1aleo ociydlsDuanvsnu)aetrmocto1lm r ueslt  rtm(mpnydapee ictl(fs2um(ront4tpxo o3iltfsDulnvo (4aeeoxo oadopt  iei;(0s2urio nu4am  lfcsa( a2tm(  nt0tpxo ociltfmDrm(vp t0tlxrif tytomtr neslt t2xrio oy1omen nvs () rraxmo;t4aexnii3iat s rauvsnu)trenxfciodoa rlies (  2trir3io1lme  fetatf Duaum ou0tet moetltfs2eauvp;t4teeoif iadoaDe nvs ()trtmio3iy1amt  fvi s)arrrumpnt1olxomoctldfmDuanmp;t4artnir iotfa  au o;s srumiopiu1apenlfetls)s2tmxm nu0tex ifeildlmDeanmsn()aexnxf ia1opte uvols sruoimpno1ap emfcsas  2tm(rpou0aptn i3ildfm2umu p;() rxrmociodfa rln i;s  exrxm3nodapte icsatf Dtaumont4alt iiciysfs uan snt4arxoxo totfmDrln i s0srumim3nydope lfcia(f ruaxroou1altn octyt aDrm( s () eerxoctatfa eanvs ()sexoxm oy4aleelfeiltf 2tau p;u1tee mocildfaDum( s u4alxnxrctadopD  uvsls)sruo(o3oy1ol   ietasf rrrxm ou4aee if3tlsfs2rmuvp ()artoxr iotla  auvi;s0srtrir3iu1apt mfvi t) rumxmoot4tetomfciyd m2umu o t)altnmfcoo1latr nesls0t2uoxm no4aleelfcs t srururo;o4apxniiciadlm2ulnvs u0teeomo iytlp  lu il() rtmxopoydalte nes s) Dtrurpnu1aleomo3iytfm2eanvp;(4artomr oodlaDraueo;t  etoirpny1lp emictls)arrm(rpno1opto icildla2ea( p;() rxnmr oo1laDelnvols)t2um(rpiodolenlfetltfsrrmurpnt4aexnmo3iadlm2ua(vsnu)arxoxr3iy1fatr uvo;t0 2xoio oo4ape  fcils  2tmxroot0tlen octysfsDeau o;u) eermf oadlaDraueolt  2umim iudlpt lfeiatf rua( poo1alxnmf3iyd s2ua(vo;u)texrio oodlaDrauvs t)srur(o nydlptelici t)sDra( pou1tee mi3ias a2emnmo;t0teenif3to1omD anvi t  2tm(r3ou4al nlfvsa()arururp;o4teenioctys mDua( s () lermoctodlp  lieil(0tetoirpiydaleemnci tf rrru oot0aexnif3ias a elnms (0areomo3oatop r iei;t0 exmim3nu4op emfci t srurx p;t4apeo octatfs2rmuvp t4aeenif ootfpDelivi t)t2tm(r oy1lltn fvsl(faDtr( o;t1apx  fetyd s ul( o;u0arxnifcoy1lptr uvilt0texrimpiu1lmeemfeia(fsDtmxmont1optoii3iysls em( sn(4 renmf3iatlat  uvi s) etmxopiydlmtn fvslt) rumxr oo4olxomieiysls ran s;(4altniocootoaD au i s s2umxmpoy4opeemfesa(f 2rrumpnu0tex moeiyt s2um(msnu0altrmf tytop rauvs;(  rxmirpny4ll e nei ()s2rmump;u1teeoii3ils aDraumsnt)texnif3oytfmDr uvol(0 rur(mpou1amt mnvs s aDum(rpno4oetomfeiasfs umnmo;u)teerif iytomDeaies (0trxoxo3oy4am e ietltf Drm(mp;u1opxoioeias aDuanmo t4teenmf3oa1fpteliei (  eurim3iy4al e nvtat s2ua(m nt0tetomicils m elu pn(0aexoirctodop raneil(0sexr(o3nydap emfetls artm(r ou4opxo o3ilslmDrm(vpnu0artoifcoa1lmDraues ( trtoimpoo1om n nci tfa2uaxrooo4tpen oeiatlaDuau s ()trtrmr3oydlaDe uvslt0sexmir ou4op   fciasfs2raur nu1oexoioeiatla2ua(vs;t4trtnmfcoo1fm  aneslt) rxrio ou4lme lfesl( s2rmxr nt4opx ifeiyslm2uaums;(0texnmf3iatopDrlivi;t  2umxr3iu4am nlivsl(fs2tm(m oo4aexoifeilsfm rlu s u0 reomo iadlaD luvi;t t2to(rpnodamtelfvs t  Dum(moot0tpen o3tasfmDrlnmpnt)teeoir tatop  li sls)texo(opiydape lieias arua(m ot1ole mf3tysfa em( o;u0 reoif3ootlpDeauvols0 rxrim3nudlmtnmneiatf rtau pnu0tleniociytfmDemnvp (4aetomr3to1faDr u i s) rxm(opoodlp nmnesa(  rur(mp;t1tlxomoctltls2emuvp;(0texomoctytopteliei s  rtoio ou4lmtemfvta(fsrumum ;u1oexn fciydfm2eanvsn(0 ltnxr3ia1omt  ieo;t  ruoxm3oo4opte ivt tf 2ra( ono0opxnifeiatls rm( s t0 etoxo oydfa   uei ()texoxmpny1am nmfvt sfsDra( ont1olenifciytlaDuln s u4trxrmr ootfm rlnei s0 ruoim oo1apt lnct tf 2tmurooo0oltnifetasla2emnmsnt4tltoxr oytlatrlieol( texrxmpou4lptnmncta() Dtr(mpnt0altnio3tad m2eluvont4 rerxo3oy1oa e u slt texoxmpoudalenliesas artm(mpnt1oleomfctyslm um(vs;()tltoif oodfm raies t)s2xmimpny1ap  licsa(  Drmx p;u1tle mo3ilsls ul(vsn(0texoiocio1faDr iesl(0 rxoxm3iy4altnmfvsat)artmx  nt0aleoiietas s2umuvsnt4texrif iytfmDrlu o;t)trxoir3iu1apeemfci s a2rmumo;u0opt mf3ildls rlnvp t)trermf oa1lmtelivs;(  rtmxo3oydole mfvilt s2ur(rpnt4aeeomoctat a2elump;t4tlxrir oytom  lies;s0 exo(r oodolen icsas)a2ra(rpnt1tlt iieiytls2emnms (0aetoio3oa1opt luvslt) ruoimpiu4lpe  fctasf Dumxm oo0ope  ictls mDeau o u0trenif io1faD anes t)trurir3nu4llt lici sf 2raumooo4optnmfeild mDuanvp;u0artnir ty1lptelnvs;s  eum(r ny1lltnmicslt) Duaxrpou1oet if3iaslsDeluvp;(0tlxomf3oydfmtean s t) rtmxrpiudaptnlivsa( arururpoo4aleoiicilsfa uau onu) etnxo3ia1fpDeaues t0 2trxr3nudomte netat) Drrumonu1tex  ictysfs2rauvp ()tlxrxf oodomtr neo;t0trxoxmpno4ll nlfci t aDrruro;t1oee iiciyt s rlu ont)tlxrxo3todoatrauvo ( seumim3nudomte feiltf Drru o;o1tltnioeiyslm2rmnmp;t4 ltnxo to1fate uvslt trumxo nu1llteliei sfsDta(  nt4tetn feiyd a2ea(mp;(4tlenmf tytopDeanvols  rurxopou4lm e ncsat aDumum nt1altn o3tatfa2em(vpn(4arxnmf3totla elnvi s0 2trxr3io1lmtn nvta( aDtrx  ot0opxomfctlslm2el(von(0alenxfcoodfaDraueo;s)seur(m3oo4oltnmnetls)sDtmu pno4tptnmietasla2eluvpnu0tlxrif3oy1lat lu o;(  ruo(m3oydlmt  ivi ( a2umumpoo4olxo f3iadfsDulump (0trerxo oo1fm e ivs;s0t2toxo ny4ll nmfvi tfs2rruroot4texo icilslsDua(mp;t)trtnxo3iadfpt li i s) 2tm(m3oodlpte fvsa(f rrr(ro;t1apxn fciadfs2rmnvont0tleomfctatfpteanvil(0 2tmim3oodopenlfes s  rtrur oo4tet miciys s el(vs;t4trenxr oo1oa  aiesl(0 2uoio iy4optn fvil(f 2rmu  ;o0aptn iciytlm2elu pn()arxrmr3ootfpt  i o s  exr(r3ny1ap  livs sfartr(  ot0oexomicilt aDumump;(0arxnir oo1op elu ols t2umxmpiudapenmics ( arrrx pnu1oltnifetadlsDel(mo ()aetoxf tadlate ues;()t2um(rpnodalt  feiat)sDrax poo4alx io3iasfa eln ont0tlxrxr3io1lpDeanvil() 2xrxmpnu4lptnlivta(fsrraxrpnu1ale ioeiydlm ulums t4artrir tadomD auvo t) 2uo(m io4ap   iciatfaDtr(r ;o0oltnmi3taslm2el(vsnt)areoxrciy1lmteanvi s) rxmirpnu1ll e nvils) Dtm( oou4altnifetltfaDemnvonu) etnmo oydfat ln s;() 2tmiopny1ap nliesltfsDtru o;t0alto o3iadls2rmuvo u)texnif3ia1la   ivs s srxo(r nu4lm nlfci tfaDrru p;t0tpe  icilslsDrlums ()aeermr3ta1lat  u o t) 2tr(o ou1alte ieilt)a2ra(roou4apxnmfeias s2ulu p;(4 lxrxfctatfat  ivolt0s2uo(r nydop   nci (fsDtr(moou1tlx mf3ilslm2umnmsn() reomfciy1fa elivi;() ruoim io1ll n fei s) Drau pou4oexnif3tasfs2eluvp;() rxnmo iatoa  ai s;s seumio no4amenlnesl()a2rm( pot0ole  fctls s2elump;u)aexrmfctydlm r ivsls trumxmpou4lmtelivsl(fsDum(r nu1tpt ioctlsfsDua( o u4tlxrif3oa1lm r nei t) ruoxopoodlltnlicta( sDtmumooo1oeenmieiyslm2ua(vsnt0 ltrmo oytfmD  ieo;s t2toxopoudapee nvt ( sDrm(r ;t0aptnif3tltla2rm(ms (0 ltrifctodla eln s;t t2urxr3nu1oltnlfci (f Dtr(  ou4teto o3ildlm ulu s t4texrxfcoodomDr ivo t0trtoxr oo4ap e icta()arraumpot1apx mictyt mDul(ms ()tltrmf3iodlmte ivi () 2tm(o iy1lpeelnct (f rrm(r ou1tpxn f3tydlmDeanvont0teenxociy1fpD lu s;( teurxrpno4ll   ivias)sDtm(rp;u4tpxo ietytlsDem(monu0 rtoxr oytlptr ivo;s srxr(o3iu4altn fvs () 2tr( ooo0tpt mietls a ulnmp u0 eerifcoytop elivo s) 2tmxr3iu1lp nlfeia( a2rax poo4altnifeiat s2ua(mp;u4artomf3iatop  aiei s trtmimpno1omtemnvtat) 2trxm ou4tetomicildls rmu sn()arxnmf to1op  lu i (0 2uoirpnu1omt mfcsltfsrta(mp;o0oeenioetltlm rlu sn(4trtoiocty1omte n olt0srxmir ny1lptnmfei s  Dtrum ;u4apxoif3ildlmDuau p u) etrxfciy1fm elivsls s2xm(m io4altemfvtat)srtr(moot4tpen i3ias aDum( s;() lenif iodlp eaivs t0trur(m3oo4ale  nvtlt s2ta(  nt0apxnioeiat a em( onu4tetomr todfaD lnei t) exm(mpnu4ll elfcs s)aDrmu  ;u1olxnmi3iys s2rluvonu)trtnxf3ty1lm e n sl(0setmir nodlme  nct s) 2rmxro;t1tex ifeildla rau s;t)alenxoctatlptrai i ( srtm(r oy1ole lfei ( s2tmu p;u0olenifciytfa elnmpnu4artrxo3tatom eln o;() rtrxr oo4oltn fcils)sDtmu  no4oeeo fctadfs rm( p;() eeoiocia1op  li i s setm(opno4aptemfcta()aDuru ooo1aex iicildls ea(mp;(0 ltrxr ty1fp rluvsl()teuoxr oodlltnlivsls sDrrxront1ope  o3iysfa ra( o;u)aetoir3oodfmt aivol()seuoio ny1am emnvtlt srrmxrpnu1openio3iadls ea(monu4tetomrctytoa rai ils0srumxmpoo1lm e ncslt  Dtm(mpnt1apeomiciat m rm( pn(0tetomf3oytomD lnvils0setoir io1alt mfcs t  rtrx o;u1alx  f3ildls um(vs;t) rtrio oytopD  nvol()srtrxm nudopte fvil( s2uaxrooo1tlxo fctas m2elnvp;t4 lenifciytlm raivslt)trumim3iy1altelnci sf 2rr(monu1aexomictatlsDrm( s u)trtnmf tytlat  uvi;t0s2xo(o nu4lle mncta(  2tm( o;u1apen ociatla em(ms;u4tlxomo iytfm  au s (0sruo(m3iodamen fvias)s2ra(rono4olto fetydla2eanvs;u0aeermo tytoatr u olt0t2tr(o nu1ll emivta(fsDra(  ou1opt ii3ils s2uan p;u) ltnxo3ootfm elnvsls0seumir iy4altnmnvsas arrm(ro;u4oexoii3tyt sDrmnmo;t4 rxrxo iadfmt  n s (0s2urxo iu4al nliesl(faDtm(mpot1tpenifciytfm rm(vs t0 lenmo ta1lat aues t0 rxmimpoy4ome  netls)a2truroot1tlxo iciad sDeln sn(0aexoir3iydoaDranvslt t2ur(r oy1am  lfcias a2rrx  ;o0oetoii3iad a2ua( pn()aetrxrciotfp  luvo s) exm(o3oy1lmtnlncil( aDtruront0apt mi3iasfa uaums;u4texrir3ty1omD luvo ()teuo(o nodlp elfci t)aruaxmpot0alxomietltla2ranmpnt4 leoxociydlmDeai i s srumim3nu4llee fvi (faDtm(mooo0aexoio3tatfs2elumont)artrxf ootoaDeai sls truoxr3iudoltnmfvias)sDrm(ro;t4tpx mi3tas mDrl( p;u4 rtnmf3iytfmD  ieslt texriopno4ol   fetl()s2taxmoou1optnii3iydlm rmn pn() exoir oadop  lnvils  2tr(r io4omtnmivt (  2urumoot1tltoioeiltlm uan pn()tetriociy1lm e n i ()seur(o iy4lm  lfetas srum(r ot0tlt mi3tldlsDemuvsn(4 eermf3iydfpDeln s t0srtoim3no1ame  ncsl()sDua(mpno4oexn octatlm2raumo;t0tlxrmoctatop eluvi s srtr(r3nu1oleemfctat sDrax onu0oeenmfctatlsDemn p;t0 reoif oy1lp  an s;(  rxrxrpou4lp nmieils sDuaump;t1alenmi3ild sDumnmo;u0 lxrxfciatfm rli i s)s2xr(o oydom emncsls)arra( pou1oltoiieiadfm2ra(mp;(0tlerxr iydoatrlnvil()truoxopiudop e fvilt) rumxmpnu1tlx  o3tatfa uan s;u0altrir tydlptrlnvils t2xoio ou1ape lieias s2raxmonu0olto ieiltlsDelu p t4teeoxr3oodomDe ivsls) rumiopiu1lptn fetlsf Dum( pnu4tptoiocildfm ul(mp;(0artrif3tadoa r nvo t s2xmxm ou4omtnmfvsat a2umxmp;u4altniiciytfm rmnmp;(0 eeomo3oatlaDrluvo (0seumir iydopee ncia(farraur ;o0oet  o3tls a ea(monu4trxnir3oytlpDeaueo t) eumxm3iydll  lncias)artm(monu1opx  oetld s2rmnmonu)tlerxrcoodfp r nvi;()seto(o no4aleelfcslt  2raur oo4apx mfciys s2uauvon() rtnmo3oo1faD anvo;s0srumirpno1optelfcsa()a2umum ou0optomieilsfm2em( p u0altnmr oy1la  auvo t0srxmxr3oo1ole lnvilsfsDtauroou1texo o3iadlm eanvo;()areomf3tatfatrlnei;(0s2uoxm3no1apenmnci tfs2rmur no0tpxomf3tlsla ul(vonu0 lxnxr3io1optrlivi;(0sexrimpnudap  mivs s sDrmu p;t0opxoioctltls el( o;t)alxrmo iydlpD li i t)srtmxr3nydom   nesa()artrurpoo0oet mi3ild sDul( sn(4teermo iy1laD  neo t s2xmim3io1lmte feta()a2ur(m nt0aetoio3ilt a rmuvonu0 leomf oa1optrlu i ()seurxo3oodop nlfetasf rta(mo;u0tetnioeiyt aDul(mp;(4texrxo3oa1lpteaivo s trtrio nu4amen fcil(fsrurx oot4opx if3tlsfsDemuvo u0arxnioctydfatrli ils0 2xm(m3nudop nlicsls srta( onu1altnmfeilsla ul(mp;t) exnxr totfmD  i s t0sruoim3ny4apenmieslt) 2tmxrpnt0tptnioetyd a em(vp u0teenxf3oydlm   nei s)sexo(m oudop emnetlt  rtm(ro;t0olxnioetat m uau s;(0 ltoiocoadlmDr i ols)sexm(mpiy1amt  ics (f rrmum nu4oee  iciasfm2uluvs t)texoirctotomDr ivilt  rumxr oy4ap  lncias  Dtm(r ;o0tptoio3ilsfs rau o;t0 lxoif oodfmDe n s;()trto(mpnu4lmt mnet t aDta(rpou4tptn fciasfs ra(vp u4trtrir3oytfa r ieol(0t2xr(opnu4o
\ No newline at end of file
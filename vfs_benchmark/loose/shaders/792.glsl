@@ -0,0 +1 @@
+i o s)srxr(o3oodolt lnesat  rrm( oou1tlx  fctadlm um(vo ()treoxociodfaDrlivs t)setrio nudal   nvs s srua(r ;o0altnifcilsla2eaumo u)arenifciodlpDelivi s  eurim3oudop  micilt)aDrmu onu0tlx mf3iysls ul(vonu0artomf3totfaD au s;t  eurim3ou1opt  fcs s srtaxr ;u4tleo o3tlt s2rmn o;t)tetrxo tydlpteanei;s)texmimpnu4lptn nci t)aDtrxro;t1oexnmi3iysfsDeaumpnu4trtniocootfaD livslt0 2um(mpoodoltn fciat aDrm(rp;o4oexoio3iatla em(monu) rtnxf3todlpte uei;t) etoir3oo1lptn icslt) Duau ono0tlenifctls mDem(vonu0altrxf ia1oaDeluei;t) 2xr(o oudap e neilsfaDtr(mp;o4apxnmoctltfm umu s;(0texnxo3totoatr ivs s)teuoxr iu1ole mivtas)arrm(mpou0texoiicilsfs2ra(vsnu)trtnxociadlpD aivi ()trtm(rpnydapenlncias)arraur oo4tlx  oetldfs2rmu on()areoxr iytlaDe iei t) 2to(rpoy4omtnlnciat)srtaxronu0tlxn iciadlmDem( s (0alxnifciydla r ivi s0 exr(r3iu1olte ictlt)aDtmx onu0tlt ioeilsfs umn p () exomo iadlptelieols)seumimpiy1ap nliei sfaDrr( pnu0tpxo o3tad m rmuvp;u4trxrmr ootomt aivsl(  2tmir3oy4amtn fcia( a2rrxmo;t0openifeilsfa2elu o;(4 etoxo totlp eanes;(  rtm(o oy1optnmiet sfs2ta(  ;t0olxnii3ilsfaDrm(mont)trxoif3ia1oateai ils0srxoir iydamen fcia( srta(rpot0opxnmociltlm uauvp ()aeeoir iodlmteanes (0sruo(opoodamt  fvt ()srurxrpot0aleniieils sDra(vp;u0aetrmf3iy1oaDeanvo;s) etoio3iudale mnet t)s2trum ;o4apto ictydfm rm(mo u4tetomf3oy1fm   neol(0 rxrxm io1ll n fvils  Drr(  nt0oeeoifctas m rlnmo;t)alxomr3ia1fp e i il(0sexmxo3oy4alt  fctltfaDrmum ou1tlto fciatfm2umn o t0tlxnmo3tadoateanes s t2xoxrpou4lm elivi t)sDtaxmo;o1aetn ieiyt sDea( p;u) rtnif3totlaD  ies;t0srxmxr3ny1altnlfetat  2rauro;o0teto ieias sDel(mo u)tltnmo iodlmDeau o t  rtriopnu4ape  neslt)s2ua(moou4oltn ociydfs2uanvo t4 lxrioctatom eln ol() rtmxrpiu1opt mivtl(  rrrxrp;t4altoiocils a rlu o;t)altoxr iadlmtrau s;s trtmirpou4op nmnvt tfaDraur nt1olto feiadfa2ua( p (4areoio oadom rluesls0srto(m oodamt  iet (  2ur(  ot0olxo ictatfs2em( s;(0tlxrxr3todfmDrau o t setmxm ny4lltn ivtls  rrmxm nu0tle mf3tadls eln s;u)areomociotfaDe ies s  2tr(mpnodlp nmictas arraurp;u1opxn fctyslm ua(vsnt)alxoiocoydlaDe u o ()t2trxr3ny4aptelnct ( sDtaxmpno0olxnifeilt aDumn pn(0tlenxrctadomtelnvilt0srxmirpno4ap nmfeiat a2rrumoou0aee mfeiyd a2rm(vp;t0 etrxf3oatfm elneol(0 rxmiopiy1op e ici (f 2rau pnt4olxoio3iytfm el( o;()aleomrctytfmDelivilt0 rto(opoo1oltnmfcs s)arta(moou1ale ii3iatfa2rau onu)artnmo totfmDelivs;(0 eumir nodap emicils)s2trx oou0opeomfcils m2rmuvp;()tetnmr tatopte ueo t)t2toxopou1olenlnci (fs2tmur nu0olenmicild m rlnvs t4trxnif iodoa r uvo;( sexo(mpoo4lmtnmfet t)s2rr( o;u1tpe ioctys s emnmo;t)tlenifciatlm eaivsl()sruoxm iy1al nmncs tf Dtau  ;u1openio3iadfa2ua( o;() ltoxo io1opt ln ol( srur(o3no4lptnmietls a2ra(mpot1tltomi3iaslm2eln snu4 leoxrcootfp ranes;t0t2ur(m3oo4lle  nvi (fsDtr(r ;u4oltniietld m ulums;u0teerxociotlaDe ues (0tetm(rpiu1lleelivtas)aDrmxr ot4texo o3iasfmDuln p t)trerxocoo1oaD auvs s0 2xr(r nudaptelfcslsfa2rr(mp;t4oetn iciatfs ra( ont)treoiocoatfp rluei;(0 exo(m3oy4ale lfvi s  rtr( o;u0tetoio3iltla elnvo;t4alxnxf iy1opD li i;(  2uoim iu4altn nci t  rtmumpno0aet mf3ilslmDulnvonu0aeeomf3todop rlivs;(0texoir nu1lptn fvias srumxm ;t1alen oeils sDuau p (4arermr iadopDr ies;t0 2xr(mpnu4ap nmivtas s2rr(mpno4optniiciadfsDrlu s;()trxomfcoodlpDr ivs;(  rum(m oudalenmies t s2urum nu0oee  fetld sDran s t)arxrxf3io1op  aneil( s2tm(o3oo4opt mieils s2trum ot1tltnmf3ias m uln o (0tlxomo tatfmDeaueo () etm(m3no4aptnmfvtl()aDtrxr nu1altomoeiltla2emums;(4 ltoifcoatfm eli s (  rxrir iu4ap e ictls  Dtaum oo1aee mf3ilsfm ua( ont0trtrir3oydfp eaiei s) exmir3iy4aleemncsat)sDrmu oou4aeeniietasfm2ulnvs u0treoio3oytlpte nvi t)sexrim io1om   fcias)sDuaur ou4opto feiadfsDemumsnu)tltnmfcoydfaDe n s;s  2umio iudlptnlncs s  rtrurp;u1tlx  fciyt s rlu o u4 rxomr3iadla  auvo s seum(m iu4lmenmnvs ()sDumu poo4teeoio3tydfm2uanms;(4aeerif tatlat ai s;(0 euoxopoydlmeelicsl()aDrmu  nt1tlx  ieiysfm2ua(vs (4texrxfcoatfpDrliei s0 2xr(rpnu1aptnlfei ()aDrr(ro;o0olt mfciyd aDuauvonu)trtrifctatopDr u i;s0 eumio3no1op elicsa( a2umu o;o1tleo o3tydlmDrmu onu4 exrifciadla  luei;t0sexr(mpiy4ll   ivsas aDrau  ot1opxnifciyt a ul(vp;t4tetrir3iy1op  anvs;t) 2ur(opiu4om nmneta( a2rmumpou1teto i3ildlaDeaumo;(0tlxnmo iotlaDrluvs;t0t2umio io1amtemnvi (  2um(moou4olenmieias a uanvp;t)alxrxo3ty1faDranvs;s0sexmirpio4am   ieils)srraxmo;t0aetomieiytfa el(vpnt)artnxf3oytoptrlneo t  eumxm3nydlmt liesasfsDrmumoot0olx  fetasfmDea(mont4texomo3io1lpDraivslt0srxmxr io1altnlivilt arrruro;t0optnmi3iatlm2umnvp u4arxomo3ty1oa eln o;(0trxr(o3iudlpt lnetat  2tmurpnt0oexnifeiltfmDea( p;()texrircoy1laDr ies ( srumir iydoptn fvsasf rrr( pot1apenioeiyd s2rluvs;u4 lxnio oadfm rlivo;s)s2xmiopoudam emfetls arrax  ;u0apt  f3tatfm2um(mon()aexnifctotfaD  nvslt0t2tr(opnudal nlfeslt)arrruro;u4tleomfetld s elnmpnt)texnir3tydfpD luvo ( s2trxo oy4lm nlfcsl(fs2tm( pnt0tle mfctadfaDum(msn(4texoir3iotfpt luei t)sexoxr3io1ll nmivt () Dra( ooo4oee ifeiaslm2elnvp;u)aeenxf tadop   n sl()trur(m3oo4om nlivsl(f Duaxro;t0tex ifeilsfaDumnmp (4tlxrmrcootfm eai s t teuoxr3ou1lp emnct t  rrmur ou4olx ii3ild s2ulnvpnt0 ltomf oo1om e neil()texm(m3oudam   feil()srurxrooo0aetn o3iysfm umnvont0tlxoxo3tadfpt livi;t) rxoim3ou4op nlncia(f 2ra(  nt0ape  o3tlsfa2rmn snt) exoir3oo1opD  ieo s) 2tmxmpio1lpt mictas)sDua(mp;u0oex mociyt aDelu s;u)tetoxf oy1lpDeau s;t0 2toxm3oudap elfet (f 2ra(rp;o1apt ii3tlsfm2uan on(0aexrmf oytlaD liei;s)srtr(o3iudopee fcsatf Dtr(ro;o4optoiicias s em(mo u0 exoir totlaD ln ilt0 exmxm3oo4am nmicsa(fsrrm(rpoo4opxnioctytfa2rlnvo;u4 eeoirctadoaDe iei t0tetrxo oydolt lncsls)arrr( p;t0aleniocils a ulnvs;u) exnmocoadfm rlnvslt)truoxopiy1omt lfeiat aDraxro;o1tpxn oetyslm ean o t4 ltrifctotlm r i ils)s2tmxopio1lm n fciasf Dur(mp;o0aleomiciys m2emump;t4 exrxr oa1omD lnvo;t tetr(o3oo4lltemfcil() 2umx o;o4tetoioeiys m rm( snt4 exrmociadfmDelnesls) rxmxopnydopenmfctas s2rr(rp;o4aee mfeiad s elnvp (4treoiocia1fm  auei (  eto(m3oo1ape lfvsas)aDrmu o;o4open o3tas m rau onu4 leoxr3tadfp eaneo s0setm(m3io1om elneia( artmxm ot0alxo o3ilslaDuluvpn()texomr3oadlmDeanes (  rumxopoydlpe lncs (f rrm(m nt0apxnifciatla2ranvp u)aeerir3oatfm rlnvi ()tetmxm3nu4altn fviltf Drrxrpnt0tpxn oeiytfa2em(mpn() etrio3oadfptrlivi ( s2trirpoydolee fci (fsrum(  ;t1opto fetltfmDel( s;u0texnioctatom elu s s)s2umxm3nodlm elics t)sDum(rono4aexomo3iltla2ranms u)altomrciytlpt lu i;() rxrxr3iy4om emfcs ()srua( pnu1teen o3tldfmDrlnmsn(4trtoifcoodlpD  n i;t  etm(m no1lpen ivils s2raumoou4opt  oeias a2em(ms ()aexnio3iy1fm e nvsl() rtoio oy4om  mieia(f 2rrxrpoo4aeenmfeiltlm umn snt)teerir3ia1fmDe i s t0s2xoxo io1om  mfctatfsDumurooo0oex mociydfa2raumo (4arermr3tytlp e nvs;t0t2xmir3no4lmeemnes s  Dtaxm ;u0optn iciltfsDrmu o;u4 rtrmf ty1fa elnes t0 exmxr3ny1ome  fct () rtr(moou4tptomociad a em(mp u)tlenxf to1la  aivi;t)trxmio3iudapen ivilt sDtaxro;t4aet mfctltlmDrlnms;t4 leoio tydlaDe n il() etr(o3oo1op nmici sfsDta( ont4tptnmfeiltlmDulu s;t4 rerxfciotfm rln s s0texm(opou4lmeelicsas srua(mono4alx mo3iatfsDuanmp u0aexnio3oo1fp rlivolt t2urimpiudolte netlt  2umxronu1tle ii3iatla umuvs t4aeerifciotlat  u i s0 ruoiopoydopenmici s)aDtrxrpot0olxnmietys mDrmuvs;() rermo3ootlmt  uvi;( setmxr ou1lm emneta( aDurxm ;t0optnmieiltla2ra(mon()altrmocoo1omDrlneo;s)setr(m no1lleelnvsas)sDrrxro;o4tpxomi3tasfa2el( p t) rxrxo ta1oatelneo s0 euoxrpoo4ome  iviat)arrm( p;t4oexn f3iysfsDem( sn(4tlxnxocoadom rlieo;t srxrir3io4oltn ieias)sDrrxm ot0tpx  o3iad m emn o t4trxoxf oadoa   ueo t0 2um(r3oo1op  lfctls) 2urxmpno0olt ifeiad m umumpnt4aeerxr3iydfaD  uvilt0 etrxm3oodom nmivias)aDta( ono0olt ifeiytla2em( o u4aetoio iy1lm eaivslt texr(r3ou4apen fvia(  Dtm( o;o0ale io3ils s2ea(mo;t)tetnxrciodfat  nvilt0 2tr(r no1am nlicia()sDumump;o0oexoif3iat s emnmsn(4areoxfciodopteauvslt)s2to(rpiudlptelnvilt  Drru o;u0tlt iiciyt a2rlump (4teenif3ia1opD  ueo t)texr(m io4ame lnvi (fa2ur(rono4tlx if3iasfs2ranvp (0 rxoif3oydlpD  iei;( trtm(r3io1ole mnvs t)arumx p;u4tlx ifcils s2emnvo;(4tltomociodfpDe n il()srxm(m3iudaltemfcsltfaDrruronu0open oeiadls ulnmo;(0arenxrciytfpDrauvilt)t2urxr oydol   fvt (farur(  ;u1olx  iciatla em(vo;(4 rxomr3oytfpDeli sl(0texriopiodoltn ieiat sDtmxmoot1apen i3ildlm2ua(vp;()texrir3oy1opDeauvi t) rxoirpou4oltelies s) 2raum ;t1aexoiociadlmDua( snt)altoxr io1latelieol(  2uoxr ou4omen ictltf 2umxronu4oet mo3tls s2ua(vo;(0 lenir3oytlat au s t0sexo(m iodll n fvi (f Dua(r ou0apx io3ils a umuvpnt4 rerxrcoa1omD anvo;t t2ur(o iudlp nliet t)aDrrumpot0aptn o3iasla2uau pnu0arenio tadfp ranvo;( s2xo(o3oo4apeemietat)aDuaumoou0aex  fcildfsDul( snu)arerxfciytom  lueo;s0trtoxmpny4amenmfesa(f Draxmoot1oexn i3tatfm2rl( p (4 lerxf ootlateauvi;t0trtrio ny1ll   neiatf 2trump;o4tlx ii3tyt s2el( s;t)areoxo3todoaDeluvs s0srtm(m nudamee ictasfs2raxrooo4tpxnioeiyslaDeln o;u4aeeoio iydlat lnvil()s2uoir nu1apt mivsat)s2umu  ou1oeen iciaslaDem( s;t) rxoxr iytfmDe i slt0 2uoio3iudlmenmivt tf 2rr(mpnu0oeeomfctad m ra( o (0 ltrxr3oatfmt  i il(  2toxo ou1llt  nvi ()sDtrxro;u4ope iieilsfa emuvo;(4tetoxr iodoa r i i s  2tr(m3io1aleelnesls  2tau  ou0teeomietadlmDulu p;()tetrmrcootlat au ols srtr(opoudllenliei () rrmum ;o1apxoiietadlm ulu snt0 etomrctadla r uvils0trur(mpiu4amt lici s)aDrm( poo4tlxnifctlsfs rmums t) lermr io1faD anvi t) etr(o iy1al elivslt a2ta(monu4olx iociltlsDran s;t) lxnmr3iydfmtelivs;(0 2xmxrpnu1ome mfctas)arra(r nt1tptomieiyslaDem(msn()tleoxfcto1fpt au i;(0 eur(r oudaptnlnvt (  Dta(rpou4oexoifeiys m rluvsnu4aleoir3iotoaDeluvils0 etoirpnudal e fcta(f ruau pno4texnmoetytlmDrm(mp;(4texoif3ia1opt  nvil()t2umxm ny1amtelnvtltfsrtm(rpot1ope mi3tydla rl(vp;u0tltoxociy1laD  uvi s)t2toxr nu4ap n nvils) rtrumpoo0aee mietydfm rlu p u4 exrxocoatlp eau o ( t2tmxo oudol e fcslt)s2umxrp;o4oltoioeiydls2ulumo t0teeoxo3oydlp  auvi;(0sruoim3nu4lpenlneia()aDur(rpno4alenifetltfs em(mo;u)tlxomfcia1la ean ols  2toxm3nydomtelnetasf Dua(rpno0teen o3iadfaDemumo;(0trerxf oatomt an s;s sexoim nodapeemfvt t aDrmu  nu0openiictatfaDum(mo;t4 exnio oy1lpteauvo s)s2um(mpiy1apenlfeil() Dra(rpoo4oexnmfcias aDemumon() etnmf3oydfa rln o t0 rxrio3iu1omte ncsl(  2rmxmonu0altnmo3tlslsDel(ms (4alenio iytfa rlnvs;()teur(r3iy4omt  fcilsf rtm(mpnu4tltomf3ildfs rau s ()texoxfcoatopDe n i;s t2xo(m nudlpenmivil( artm( oot4tlx ii3tat s emnmon(4aexrif3tydfatelnvo (0tetm(o3io1omenmictas  Dumu ont4olt iocildfm2ulnmpn(0 etrmr3iodlpD aivo;s0setoxm3io4llee ncils)sDumump;o4tetoio3iasfmDeanmp;t0trtrif oydlpDr n i;()srtoirpno1ll  miesa()s2tm(m ou0opt if3taslmDemuvpnt) rxoxrcoo1om eau s (  rtr(rpoudlp n ivi s  rta(m ;u4aex  fciyslmDel(vs;t0 rxoxr3todlmDeanvilt)s2trim iu1ap  mfvilsf 2raxr ot0texnmiciasls rmnms t0 eenif3ootlp e nei;s)s2xrio no4alt mncsltfsrumu ooo0alto ictldlm rlnms t) eeoxo totfpt lueilt0 2xo(o nu4oltnmncsl( aDrrx onu1oltomieilsfs2rlnmo;(4 lxrmf oa1lpDe ivs (  eumimpou1omte fvtl()sDraumo;u4ope mictlsfm2umnvp;t0artnifcoo1la   ivslt  2tr(r3oo1lp nlfvs s aDurumont1tex mo3iatfsDua(vs;u0tltoioctadoateln s;s0t2tmimpiodlpt  iesls srtm(mo;t0opx  feiatfmDumu on(4aexrxf3oatfaDr ieslt0srurirpiudopte ivs ( sDtm( ooo0altoioeiytla2rmumsnu0altnifciatfpDr nei;s0 rurir3no1lltnliesltf 2rmuro;u1ape mi3ildfs2eln p (0aetnmo3ootfpD  n ils)t2uoir iy4lpt micils aDua(ro;t0olen fetas mDrl( sn(0 lxnmoctatop r iei (0t2uo(r3oodomenmicsl( s2tr(mo;o1tpx ifetatlmDuanvpn()tltnxf3oatomtrluvs;t  etrxmpiu1omte nct t)arraxmono1opx ii3ilt m2eau o ()teenxrcoytlaDran s ()texrxrpoodlpe licsas sDtmurpno0apeomietltls2el(vo ()trxrxfctodfat  ies t) eurir3iy4lmen fci ( srur( p;t0tpxo fctlt s2ean p;u0trxoio3iydfaD li o;() exrxmpio1apen nvtasfaDrm(m ou4open iciltfm2ua(vp u)trerif3iotopDrai i;() rxo(m3oudalee ieil(farurxr ou0tptoioeilt aDem(vpnu0aeenxo oa1faD aivo ( t2xoim3iudolt micsa(fa2rax  ot1apxn ociltls rl(monu4trxomf totopDe nvs s) etriopnu1oleemfcslsf 2rr(moou4tpe mo3tldfs2umnms;(0tltrio tadfaDeauei (0texo(m3oydoptelici (f Dra( o;t1alx ifciatls2ranmp t)altnmo3oytfa  lu o;t0texmxopno4ame mietas)sDrauroou1tltoioeildlm elumpnt4altoio3ootlpD  ieo (0s2umxm3oo1lltnlncsat)sDuaxrp;o0apxnii3tatfa2rlu s t0 rxoio3oa1opt lnvils t2uo(rpny1ame  ivs (fsrrmxmoou0tleoiociyd mDraums t0aeeoxociadlmDeau il(  rto(r3oodapt licsls)sDrmur oo4alenif3ildfm uau p ()trtoxf3iadlate neslt  rxmir3ou4op n fei s a2taur nt0tpe iieias mDumnmp;(0tlxnif3oa1opD aiei (  etoxo oo4lpee fvslsf Dtaumoot0tlxniiciys s ran s t4alxoxfciatomt  ivi;(0sexoim iudap elnes t a2rmxr nt0olx  ietys sDem(mp;()texoxrciydopD  iei;t0 ruoirpiudlp   nvsl()sruau ooo1alxomf3iydls2el( s t0aeerxrcoadoateauei;() exr(mpiu4ope mnetl(f 2uaxr ot1aeeoifctydfm2rl(msnt0tltnxoctodop eai olt trtoxopiodlptn fct (  Drr(m ;t4olt  o3iadfs2eluvp t4trtrir3oytoptr ivi ()s2trxo oy1ameemfcsas)a2um(rooo4alx  fetlt m2rlu o;t0altrmr3to1laD  uvo;t) exo(opou4am emnvt (f rrr(r oo0opt  oeiasla2eluvsnu0artnxo3oadom e i o;(0tetrim3ny1lmeemnvs ( s2rr(ro;t1alxoifeiyd aDra(vo (0 rxoxo3oo1fpDelues s sexm(rpio4ameemnvsas srtm(moou1opto fciysfa2ra( o t0 renxf oydfm rau i (0 2um(mpiy1am elfcil()artaum ot4oeen f3iad mDranvo;()texoio io1oa eaneslt  etrxm iy1lltelfctls aDtaum nt0tpenmiciad s elnvs;u4 eermr3ta1omteaueslt)t2trirpno4opt  feilt)arrm(m ;t4opt ioeiydfaDumnvs (4trtrir iydlpt  iei;s texrimpoy1lm n fes t aDua( o;u4tpxoio3tydla2um(ms t4trtomr3ia1fat  uvilt  etoirpno1am nlncilt s2tmxrpnt0tlxnio3iat m2el( s t0 rerxo tatop  ai s (0srurxm3oy1opt  nesltfs2tmx ooo4tpeomiciatls2rmu s;u0 rtrxr3to1fateluvs;t  rxrxrpiu1lptelnet ( srurx  ot4oeeo oeilslsDrl(ms (0tltoir3oadoa   nvsls)s2xo(o nu1ol elfcs ( sDrr( poo0altn f3tys m rl(vpnu)aetomr ty1fatraivo;(0 2xo(r3io1altnmictlt s2raxmpnu0tleo ociadls umump;u0arxoif ty1lm e i ils)trumir ny4lltnmiviltfaDurxr ot0tpen oeiytfs2eluvs;() lxnxociodop e ivs;()tetrxmpou4op emnetls  rta(rpno1apxo icils mDuanmsnt)aeeoioctatfp rlnvs t0srtmirpiy4lmeemics tfarrmx pno1tltnio3iatlm ul(mont4arenxr ia1fpDrai ol(  2tmxopou1lmt  nvtlsfarrm( ooo4tet  octys s umuvpnt4texrif ta1la r ieo t  eur(m iu4olt licsat)artmu ont0altnmf3ilt s umn p t4artrxrcoy1faDe ieolt teuoirpiu1lpe lfvtatf 2umxmp;t0olxn fetytlm2emnvo t0trtoxf oa1la   nvs (0 rxrio3nydlm nlfcil( a2rrxmo;o1tlt ifciadlmDrl(vs t0altomf iotlmtrlies t)texo(mpoo1omeelics t)sDrr(moot0olxn o3iltls ua(ms u0 rtnmo3tytfa  ai il(  eur(m3iudlptnlfviatfsDrrumont4tleo o3iaslaDrluvo (0areomr3ta1oaD aivs;s  2to(r3iydapt lnvs t artrxm nu0tpt iiciatfm uauvp;t0 etnir oo1fa
\ No newline at end of file
@@ -0,0 +1 @@
+iesl() rumxo3no1apeemfcsa()aDtrx o;t0tpx mieiyt s elumo;t)aetrircio1fpDelieo ()sruoiopoy4llt mies ( srumxr nu0apt mieildfaDemums;t)treoif3oo1lpD lueols)s2xm(opoy4ap elfvt tf 2tmxmo;u4tpenifeiyt m2ea(mp;t0 lxoir oydlaDrlieol( t2xoxm no4olenlncil() 2ta(mp;o1aexniictytlm rluvp;(4tlxrio ty1fmD au i s0 2xoio3oodlp   fei t)s2rr(rpnu0alenmo3ilt s2rlnvs;t)tetoxr3ty1om rlnei;()sexrir3oydalte ncils)a2raxroot0oexoio3iltfs rm(vo;u4aexrmr3tydlptrlnvi s0t2tmio iu4lmtemfeil( artru o;u4apxo oeildla ua( s ()tlerxociydlptrli o ( s2xmir nu4lmenmncsls) Drr(m ;u0oetomfeiad a ul(von(4 ltrxocoodfptr neo s0 rxo(mpoudome  fesa()srrm(  no0ope ifctatlaDum( on()tlermr3oydlm   iei;s0 exmxo3iy4am  lfvs tfaruru  nu1oetnmocildfsDul(msnt0trtnmoctydlat aivo;(  eum(opno4amtelfcsltf rta(r ;t1tleo ietaslm2rauvs;t4trxoir3oydfm rlies ()t2umio iu4ap  mfvt t) 2raxm nu4optomfetadlm ranmo u4tleomfctotfmtelnei s0s2toxr io4oltnlnvt t sDrmxm ;u0texomietydfmDem(mp u)aetrircio1fm eauei;t trxoiopnydalee nvtl( arumxr nt0ope  ictydla2ranmsnt0alxrmrciydlm rlneol(  2tm(opou1lpenlfvi t)s2ta(monu4aleniietlslm ul(vp (0 etoxfcty1op eanvil(0t2toxm3iodapte fctat srurumpou0apxomi3iltfm raumpn(0trtoif oatfm   iei (0 etm(rpnydam nlnvils)arurx  ;o0apxnmieiaslsDua(vs t4teeriociy1lateaieo;s0t2tr(rpiu1ll nmnvslt)a2um(  ;o1tpenmfeiasfaDrau o;t0arerxrciodopt ln olt)s2xmiopoy1al nmivias) 2rrx poo0alxo fetadfs2emums u)trxnir3tatlp   nei;t)s2uoim oo1lpeemictlsfsDta(m nt1tpeoioeiasfa ul(vpnt4 ltrmr oo1fmte n o;t0 etmxrpoy1lmt lieils)s2tr( pot1aeenmictlsls uan o;t) rtoxf oa1lpD luei;s)seumio3nu1lpt  iet s) Drmurpou4tpxoiiciltfaDum(mo;(4tlxnif iy1lptrlueo s texm(mpnudlltn net tfartru p;t1aetoiiciltlmDua( pn(4arenxr todfp   i ol( srxoxm iu1omt mfvi t)a2uaxrpno1tetnioeiysfsDuaump;u)trxnxo oytfpD luvolt) rxo(r3iy1opee nvs ()a2taxmont0alt mfctltfa ulnmp;()aeeoxrciodlmDraivo ( sexmxmpiydapt livtat)s2um(r nu1apxnmf3tatla2elnvp u)trxomocio1lp r nvil(  rtm(mpno4lp nlici t) rua(mpnt1aet miciadfa2ran pnt0trerxf oydoaDr neslt0texoxmpnodalenlict (faDua(moot1aexnmfeiltlmDua(mo;t) rtnxfcoa1faD auvslt)trurio3oo4optnlnvi sfa2rrumpno1opxniiciasfaDuluvont0arerxf ia1optraiei s sexmiopnydapt  fci (f Dua(ro;u4altoioctyd aDea(mo ()alxrircto1op rai ilt0srtmxo3oydaptnlnesasfsDum( onu4tpen o3iltfmDeaums () exniocta1fpDrlnvi t0 2trio3iy1alenmieta()aDraxrono0optnmociatfa2ua( o;u4tlxnir io1lptrai il( srxoxopio1al nmnvilt)s2tmxmpot4opt  feiydlm2umn p;t) lxomfcoatfm elivi;(0trtmxo3ny4lm   fes s)a2ta(rp;t1aexnmf3iyt a um(mo u4 renif to1fm  lnesl()teurir3nu4ame  fei t  Dta(r ;t1oex ifeiasfa2rmuvonu4 reomo3oatopD  nvi;s)tetmxm io4apeemfesa()sDra(rpnu4opxnifetadfs eln p u0aetomo3oytfa   uei;t0truriopiudomte ivilt)srumxro;o0tptn ociatls eluvpnt0alxoxrctatoa  luvil()t2xoimpnydapt lncia( arrrx pou4tet ifetatfsDuanvp u0tetrio3oytfm eaies;( sexo(rpiy4lpt liviatfarur(mpnu4tlxn iciys mDrl(vs;(4trtomf3oatlptrlivslt0srxoxmpoo1ll emivils)a2uax p;u0olt mfctadfm rl( p t4aeermf oatomD luvs s)t2ur(m io1ame  fesa() Duaxr ot1tleoii3iat s2raums u0 exoif3oodlaDeanvils)sexrxr no1ameelncsls) Dtmxmooo4aleomociatfa2ul(vo u)aexrir oa1oaD anei;s)s2uoxr ou1lm nlictas) 2tmx p;u4texn oetldls ranms (4trtrmo3tadfatrlnes;s s2umio iodoptemfcsasfs2tmur ;o0altomf3iatlaDem(mo (4 rtnxrciodomDraiei ()seuo(m3oy1optelicils arrauront1oleomf3tadla ra( s t)tltrifcoytlmDr uvo;s) rumxm no1lmte icia(farrrx  no4aetnmi3tytls2um(mp;t4areoifcoy1fpD  ivs;s  eto(o oodlpt  fvsl(  rta( pnt4tpt mi3tlslmDeluvs;u0 rxoif3ta1omtrluvo s0srum(r3no4llenlfct t)srta(rono0optoioeiysfa uanvp t)tltrxfcio1oat livils0trtmxo iudlp nlnesas sDtm(rooo1oexniieiadfm ranmp;u4aetoifctotlmteln i;t)trxrxmpnu1aptn fcslsf ruaurp;t0texnmfciatfa2rluvp t4 reoif3to1laDe uvolt t2xrio3ou4al emncils)sDraurpnt4oet if3tat a uaump;u0aeerxfcootoptelivils)t2um(o3oy1om n nvt ( a2umuro;o0tpxnio3tls sDrauvpn(4 etrxf3tytoatrlu i t srtr(m3nydoltemnetas s2uru  ;t4apt  oetad aDulnmpnt) rxnirctadfmDeau s t)s2umim3oo1ope mietlsf Draxmont4optomoctls aDuln o t4 lerxo3to1lptelieolt0 rxmirpnydlmeemictatfsDtaxr no0tpe ifcilslm2rl(vo u4altrif oydfmD anvs;t)tetrxo iy4al emfvsatfa2trx onu4tpxn iciat sDuan p;(0 rxoio ta1laDranes;(0t2xrxr nydol   iesas arua(  nu1tetoiocild sDra(ms;t0artnmf oadfaD livs;( trtoxm3nudamtnmicias)sDrm(  ;t1tptomo3ilsls2um( s;u0alerifciydfpDr neslt)t2urxmpnu1al   fetl(faDrmu p;o1tpen i3iyt sDul( p u4teenif3ootfpDrln i t  rur(m3oo1optelnet () rum(  nt1aptn ieiytfm2ul(vsnt)areoxoctatoaDe n olt) exm(o iu1lpt  ncs t)aDur(rooo0tpxo fciltfsDum(vont4tlenmo ty1laDr i s;s)s2to(r oodlltnlnctls a2tmum ;o0tetn ieiadlmDem(mo ()alxnmr3tytoaDe uei t) euoio3nu4lle  ivsas)srumx pnt4aex ifciad aDuauvo;(4tetnmf oa1lpt aieilt  2xmim3no1llte ieslsf 2rrxr ot4aetoiietlsls2rlu pnt4aexomo3iodfpDeai olt0texoim3iy4optnlicsat)s2ra(m ou4tpx  oeiltlm rmumpn(4 eenif ty1fateluei;t0trxm(opny4aptnlivt (f 2tax pnt4tlxn f3ilsfs2emnvsnu4tlxnio oytfp r nvols0texoim3nudom nlnciat s2um(ro;u1tetn f
\ No newline at end of file
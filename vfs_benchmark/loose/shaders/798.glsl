@@ -0,0 +1 @@
+ieo;()setoir3oodomt mnvi t s2umu oot1tee mi3ildlaDuanvon(0 rerir3io1oatrauvs () rxoio iydale  fvi (fsrrmump;u0tlxomfeildfa2emn snu) reoir3todfa   nvo;()sexrio ny4apt lfei ( sruaurp;t4altnif3iat sDulu pnt0aeenio3iodlpD  ivi;t) exr(o iy4lm elfetl()arrrxm ;o0tpx  feiltfs2rlums;t)arxomf iodfmteai il(  exmio3iy4lp  mfvils)aDraxr no1aex  ociysfm elu p u0artnxo iadomD luvi t0 rtm(rpiy4opt  fcs s aDrau  nu4tle iieiltfmDrm(mp u4treoxr iydlmDe nvs t t2trxr iydll emivsl() Dtmxr ot4aetnioeiadlaDulumo ()trtnxr oadfm  aivo;( teumir iodapt  nvil()aruaurpnu1oeeomo3iydfa2ua(msn(0trerxr iytfa eanvilt s2xoiopiu4ome  nesas) Dtm(mp;t1oeenii3iaslaDrlnvp u)trxnmoctatfmDe ueo t t2xrirpny1lleelfvsls  Dur(mpno0apeomociad a2rauvp u0aeeomo tadfm elivi t)sexmxm3iydol  mnci sfaDrr( oot0optoio3tat s uanms u4aetoxf ta1laDe uvi s) 2uoim io4ope lfcta( sDrrx  nu0alto oeiyd a2eanmp (0 lxomocoydlp  aiesl(0 2uoio iodlm  mneilt)aDra(  ;u1teeniieildlm2eau o;(4 rtrifciytopt aivo;( srto(r3oydapen ictls)sDum( p;u1opxniieilt aDul( o;t0tlenioctydlmt  uvs s t2uoiopio4ap nmnvtat) Dtaurpoo1oex ioctasfaDrmnvs;(0altomr3ta1laDelnvo;s teumimpno1apenlneilt)s2rrxrp;t4texoio3tatlmDrl(mont4tlerir3tytfpDe neils0t2umxrpnudomt  fvta(  2urum no4tlxnif3iyt a2um(vpn(0alermo tytlatr u i;( s2uoxr3nu4lmtn fviltfa2trum ;o4tee  feilsls rlumo (4 rtnxoctydlmD aies;t) euoxm iu1omtnlnvt (f rra(mp;o4tle iieiasfs2um(mp;(0 rtoir3ty1lmte ivs (  2trimpno1lpt lnci t)s2raurooo4apenmicild sDrln p;t)teerxo ta1late nei;t  2xoirpny1alte ieias)arum(roou4optn fctatfa rau o u)trtomf ta1lptr ivo;(  eumir ny1ap e icta( sDtaurpno0olt ioctasfs2umu onu4tlxrmfcoadfmDelies;t0trumir3iy1am  mici t)sDtmx ont4ape if3iysfmDrln ont4tlenir3iodfat ai o;s)t2xoxmpny4om n fcta()artmur ;o1tlx ii3iydls2ranmo t0teermf ootlm   nvs t0 rtm(m3io4lltnlfcs t  2tauro;t4ope ioctld m2uanmo;(0trxoxr iy1lmD  ueo;()texo(o iu4op elfesat aDururpnt0tet ioeiysfs emu s t4alxrmo oa1oat lu sls0setoirpoodopenmnetls)s2tr( pnu0alt mf3iyt sDranmpnt0 eeoif oadfat  ueslt s2xoim3iydaptnmivsas  2ta(rooo0aptn ocilt a2elnmsnu0aleniocta1lmD li i ()srtr(o3oydol n ncta(  2taum ;u1apenmoetldla umnvs t)artomrcoatlpteai ils0s2tmim oo1om n iviat a2rax  nu4oexo f3tad s uluvo u4aexrxocoydom rlneols)trtmirpoy1lleelnvt t)s2tm( p;t0tle iiciat m2uaumon(4 eenir3iadfmD lieilt)t2toim oydoptelnvt sfsrtrxmp;t1aptnmf3tasfaDulnvp t4 ltrio3iytfaDelieolt  2um(opiydlpe mneta(fs2taxmono0opxn fetytlsDem( snt4 eenirciadfatranvolt srtmim iudap nlfvsas)sDrau pnu0olxomoeiatfa el(vpn(4alxnmrctatfat ln i;t0trurxo io1olt lieiltfsDta(monu0aeen fciyd s2umnvp;(4trtoifciytlp rlu o (0s2ur(mpoy4lle livils srtax oot4apxo o3iadfm2rln snt0trxrir3oodlm  ln i (  exoir oudlmee nesat) Duauro;o4aetnioeiasfm rmn onu0 ltrmfctatoat aueils0teurxm io1ale mnesa(fsrua(rpou1altnmf3iasfmDrauvp;u4areoio oadoaD ln i;s0 rxoim iudlm e icil()arum(m oo1ole  oeiytfmDra(vp t4treomfcootlpDrli o;() rto(o nu1lltelnvsl() rtmu  nu0oex mo3tysla rln o u4texnir ty1opDrau i;s setrirpny4ol nlnesa()arum(mont1opxn oeiytls2rmnmo;t0 rerif3iodom eli o;t)trurio ny1olt lfvil()arrax p;o1olt mfeiydlmDrauvp;t4trxnxrciotomtelues s  rtoim iu4om n net sf 2tmum ;t4oee mocildlsDum(vpn(0arxoif3todfm eaueslt)srxoim iu4om nlnesls)a2rmum ;u0oexn feiatfm2ranvo;t0trerif to1faDranes t0s2xr(mpoo4lm n nctl( aDrmu oou4olx  iciyd s umn o u)arenmr iy1lmt li s;s) rtr(o3iydllt  fet ( aDur(mo;o4olx ifeiyslm2ua(mo;t4trxoxf3oa1fpte ivolt srxoim io1al   ncta(faDrm(m nu1tpt ifciatfs ul(vs u4teenifciatlpteanvsl( teurxopoo1ome  nctls s2um( pnt4tlx  ictytfa2rauvont4tetoxrcoa1oaDrlueo;s)t2toxo3oo4lpenmfvt s)arraumoot4altomieildls rm( p (4tlxrmf iatoa eluvo (  2uoio iy1lleemnetatfaDurx  ou1alxomiciadfa em(mont4 exoio oy1fpt luei;t) rtrxmpoudaltemfvia(  2ur(mooo1olt  i3iyd s ea( s u4 ltoir3tadfa ranvo;s0s2uo(m no4ol   iesa() rtmu p;u0aeeomf3iys aDrm(vo t4aeeoifctydopDeluvi s0truo(o iydll elfcia()aDum(r oo0tee  ieilsla2ul(monu4aexoxfciodopD ln ols0s2uo(m iu4om e ieta()srraumpot1tee mi3iytfm rl(ms;t)aexrio3iytlatrai il()teumir oo1ap  mfvtl()a2ua(rp;u4tpxniieiyd a2ran p;u0 lenif ta1opD aiei (0 ruoxrpnodalenlncsat a2umxrpou0olxomocild m2rauvp;u0 lerio io1lmteln sl(0 etmirpiy4optn net s srur(r ou0olxnifciyslm2umn sn(4arenmf oo1lpt luei s)trtmir ou4ol  mnciatf Duaxmonu0olto octydfaDem(vsn(4tlxriocoy1latr ieols  rto(m io1opeelfesl( srrm(r ;o0tlx mf3tlt a ranvp;u4arxoir3oydfmtranvols0trtrxrpiodapte net (fartru ono0alxo fctat aDum(vo;u)aexrxo iytfmDe ues t0 eumim3nydame livs () rtmx  ;t0tlxoifeiltls2uanms;()arxomfcto1fatrai slt0 2uoimpnu1ole mfctls  2tmx pnu1tpxo oetytfmDeanmp t0 exrxr3todop rai ilt)trtmxr ou4aptelfvsltfsrrr( pnt0apen fciytfs2rluvp (4 rxomr ootfa   i s;( texrim3iy1ole licslt  Drau  nu0olxn ieiadla ean snt0 rxoio oadlatraieo t0srxmxm iu4ope  iesl( s2uaxm oo4tpeo i3iaslm2eaumo u0 reoir3iy1omtr i i s0 euoxr3iy1ll  lfctltfa2tau pnt0ole  oeiyd sDel( pnu0tlxrmo3ia1lpt auvolt0t2trim oydlp nlncsa()sDtmum nu4tpeniociyd sDeaump;u)treomf3oy1op eauvil( srxmim oy4olt  fcia()sDraxmont1teen f3iydfs em( o;()treoxfcoo1lp eli o (0texoxo3oodam  lfctat) Dtmum no4tpt mociad s ul(mp u4trtrmo3tadfm eaiei s0 2xm(m iy1ol elics s)a2rr(  ;o1aeeomieiad m2raump;u0 rxoio3todomt  ieo;() exrim3oy4lp  livia(fsrra( p;t1apeoiieiltfm rm(vpn(4 lenmrcty1fa rlueo t0t2triopiu1ol nlfcil()sDrru pou4tlt mictld a ua(vs ()aeeriocoa1laD lnvo s seto(rpiu1opee fcs s) rrax ont0tpt mfeild sDem( pnt) exomociy1la elnvs;t t2xm(r3iudopt lfvsas)a2taumpoo4aptniictasls2ranvs;u0alenmf3oodoa  aivslt0teuoimpoy4lptnmivt s)srumu  no1aee ifetltfm2rmump;t)aexomr3oy1lmD an o;s) eto(mpiy1ll e feiat)s2umxro;t4tpe  i3ildfa ea( s;t) lxnmo oa1lmDrlnvo;t0seuoxopou1ol nlncia(  Durx pnu4aeeo oetyd s ra( o;(0 ltoiocia1oaDeanes s0srurxr ou4aptemnvs ()a2ta(r oo0alt ifeiyslm2rlnvs u)texoif ta1oa  luvi (0teuoxmpoudll  lfvtas s2raxmonu1oetnmi3ilslmDrmn sn(4trxrmrcto1opteau s (0t2umir nudamtnmncs t)aDrrur no4olto feiysfmDea( snu)aexrmo iotfa   u o;s  eumxmpiy1alenlivslt) 2um( o;t0optn f3iadlaDumnms;(0 etnifcoytoaDrlu ilt s2tm(mpny1am  lfcsat sDrmumono4texnifeildfm el(vs u4 exomo3oatopDraivolt truo(m3ou1ll  mictas)sDrmxmo;u0ale mieildla2rm(vo t0 ltrxr oadom rluvi t t2trxm oo4op elnesas) 2rr( pnu4tpto feiatfm2em(mo (4teenxr3tytoatr ies s)srxoxo3io1olenmivs ( srta( o;o4aetn ietytfs2ul( on() ltoxo iotfpDe i sl(0sruoxo no1alt mieil()srur(m ;u0olx mfeiysfsDul(ms;t)arxnir3iy1omD lies;() exrio3nudlptnlfvs s) rtrx  oo0texoio3iyd m2uaumsnt) eenmoctydoa  aiei;t s2xoim nydamenlfviat)srtau ont0oexnii3tadlsDran o;u)aleoxf iotoa e u o;t t2xm(m3oodol nlfetat)aDuaumont1opxn fcilsla ea(mo;t4tlxoxo todom ran ols0trxmir3no4ome mietatf 2tr(rono0tle mi3tldlm2eaump (0 eerxo ia1faDraivo;(  euoimpio4amtn netas  rra( p;u1olt iicils m2eanvonu4texrmfcoadlmtraieo;t sexmio ou1opt livia() 2rr( ooo4tlxn f3iadfm2umn pnt0trxnir iodomtraies;()tetmim nodopt  ietl( a2rrx  nu1aetnmiciad m2rmnmo u4aetoir3iy1fpt aies;t)tetoxr3ny1altnmiesatfaDtmu  no0oeenmicilsfaDra(vonu4tleoxf3totlmD  uei (0srumirpoudllt lnvtatf rumx oou4texnif3iysls2ulums (0 rtrxo oo1fp e n o;()srxoir io4omeemict t  2uru  oo0oleoif3ildls el(vs;(0 eeoxfciatlpte uesls) exo(r oudaptnlfcil( srrm( o;o1tetoiictld a2ranmonu)arxomo tatfpDe nes s)s2xrirpoodam n icta( aDra(roou1tetnii3iatfm2rlnvs u0alxomo iotfaDrai s t  2xoxr oy1llenmnvtat arrr(mp;o0olx iieiatfm uanvp;u0 rxrifciodom e nvo s0texo(m3iu4ope licilt sDua(mono4ale ii3tltla2em(ms;t0 etrmo ootlaD lneolt) 2ur(o ou4olt livs t)aruaxmp;t1opx mietldlm2ua(vs t0aexnmf tytlmDraivs t)s2urxr3oydome  fvta(fa2umxm ot0alt ifeiatla uanvo u0 ltrxr oydlatr u slt0s2toim oydamtn ici t  rumxrp;t1tlxnii3iadfm rm( ont) eeomr iydoptrln s () rumio3iy4lm   neils sDrmxr ot0openiictyslm2rlu snt) lxnxr ta1fpte nvils)sruoxopiodomt mfvi (  2rmx  nt0tlxnii3ildlaDumn onu) eermrciy1lp eanvsl()seuoxm iu1olte nvslt) Drm(rpnt1tlx  ietlt mDulnvp u4artnio3ta1optrai i s)trtmim oo1alee icta(fsDrmx ono1tpto fctaslsDraums t0tltrir io1faDr uvo;s)teurxr iydomtemfctls s2umxr oo1aeeoiiciysfsDeanmo t0aetoxocoy1lptelieo t  2urxrpiy4aptelncsls a2rmxrp;u0oexnmi3iadfm2ea( p t)tetrxf3tadfpDrlu i;( s2ur(m3nu1oltn ncsl( a2umum no0ope moeiytlsDul( o t0 rxomr oatlaDean ol(0 rtoxm oo4lm n nei t) ruaxm ;u4teenmf3ilt s2rmu o t0aeenxocoo1fmt lneo;t0seto(o3iu1omtnmfcsa()a2umx  nu0oltoii3iadla rlnms u4aetrmrciytfptranvs;s0 2urimpnudapee ies s)sDra( ono1alx micildfsDemnvp;t0alxrif3oy1oaD  ues t  2urirpio1ape  fvsas)sDtrur ;u4opx mfctyslsDulu sn(0alxrxrcoadfp rlivsl( teuoxm ny4ol   fvt t)arurxm nu4oltoifetld a2ulu s;t) lxrmo3oodlatelnvs;( seto(r iu1aptemnvs (  2tau p;o0aptnmi3ild m ean s t4alerio tatlm  aueo t0trur(opoy1am n ivil(f 2rax  ot1alx iieiys s rmn sn(4aleoir iotop   nes;( sruo(mpoodll  lnvsls)aDtr(rpot4altn i3iadfa raums;t4 rxrmo3tydlmtrlnes s0t2xo(m oydomeelnes () ruaumoou0texn ociatla2rm(vp (4teermrctatfm e ivsls setrxo3nudomtn ivtlsfs2rm(rpno0apxnmiciysls eanmont)aexomrcty1fm e uvi;t)srtmim3nu4ll emnvtas)s2tm( oou1tpx mfciydls el(ms;u4tetoxf iodlpDe i s;s0 eur(r3nodam emneta()sDur( pou1open ieiys mDel( o ()tetomrcoodfmtelu ilt) 2tmio3ny4ole mfei s) rrau ono1altn oeiat m2rluvonu4artrir ootom ranei s sexrxrpoudale livsasf rtm( ooo1ope  f3tltls2rmn s u)aexnmfcoadfpt li s;t)trumxm ou4oltnlncilt  2raurpno4olxn f3tyd s2raump t)artrxf3tydop elivi t0 rxr(o iu4lmenmfeta()arururont0apxniieilt aDul( s;t4 exnmocty1opt  u il()setoim3iu4lpenlfeilt)srrrxm ;u4opxnmoeiyt m el(vonu)trtrmfciydfatrlnvolt0 rxmxm3iudap  mietlt) Drrumo;u1oleomicilsla umums ()trtoxr3oa1lptr uvilt  rxr(r io4oltn ieiltfsDtrur nt4texoioeiatlm2rl(vo t4arxnir oo1optrauvo ( t2to(o oudllenmivt sfaDta( p;u4altomietadfmDelnvpn(4 rxomr3oatopt lu s;t0 euoxopoo1ll e netl()a2rm( poo4tpe moctldla rmnvp;()trtrxo iotom r nvs;t0 eumxr ny1ll emietas arta(mono1oexo ieias aDua( onu0teeoiocty1omDr u s;()s2xoiopoo4lp nlfei s)aDurumpno1tlx  o3iytfaDelumpnt)aetrir ty1omtr i o (0t2urxo3iodomt  ict s  2ururoou0oeeoiociydlm um(mont0aetnxrcty1oa eaivols) eumim oo4lmen fvta() rrmxrooo4tet moctasfs2elnvo;t4teenxrctytlmtran ols)t2uo(mpnodalte fcilt)arrrx oou0aeeomfciltlmDuanmonu) exomr3oydlpte i o;()s2tm(rpnu4lltnmfes sfarrmx pnt4olt mieiltlm2ranvo () etoirciatoaD au o;(0srxrxr3iodolt lncsl(fsrrmx poo1tlx iociadfm2uan s;(4arermoctotoptrlnvi;t t2xrxopnu1lmtnlfcsat s2ua(mp;o1aeto fciyd s emu p ()aexrxr3oodomDraiesls)srtr(opoo1am nlnetltfs2trumo;o4aleoio3ilt a uanvp u0 eermf3iotoaD  nvilt0 exmxmpno4oltn ieiat sDur(m oo1altnii3iyslmDrlu s;t)tetoio todomt lnvo;()sexmio3oydome  ivilt) Dtax pnt0tptnmiciyt a2rmnvsnu4 exrxf tatfmDrlivsls0seurirpnu1lpenlncsls) 2ta(r nt1aleoifeildlm2ra(vo (4tltrmrciodopDrli ols) eurxm3oo4llee icilsfaDtrx  ot0aee  i3iytfaDua(vs t4tlenioctytomDelnei t  ruoxo ou4ap nmfcil(  2rrxmonu4tpenmieiadfmDranmp;t) etrmo io1fmD an o t)srumxopiu4olt lieilt)aruaurp;t4tleomfcild a emnms u0tltnio3tatfp r iei t  rtmim3oy1op elies ( arum( oou4tlx  ictytls uanmo;(0 etrif oy1fmt  n il(0srur(m ou4lpeemfesatfartmump;o4aet mf3tldfmDel(vs (0 renxocoatlpt ai olt0srxm(rpnodoptemietas aDtr( pou1apxomociadlm uau s;(0trtrmo3ta1fpDr neslt0sexoiopou1apenmfvi t)aDtaxmo;t4apx iociysfs2rl(vo u0 eenxrcoydfmteliesls0s2uoim oo4altnliesl( a2umx onu1olxoiiciysfm uauvon(0 rtnmr3oodlmtelivi t  2uoxmpnydoptn iciat aDrr(mpno0openmfctysfa rmu o u0tleomr ty1omD  u o t0 2xriopno1oleelfcs t  ruax ont1olx ii3iysfm2rmn o;u0 etrio3iy1lmte ues;()s2tm(m3iu4olen iesa() Dtm(m ;t1aetomfeiyd a2ranvo;()aetnmr iydop  auvsl(0trxm(o3no4ape  fei () Drm(moou1tpenmieiyt m umn snt4trtrxf3io1fmte n i;(0srurxopiydlmt mfeilt) Dtru poo0olx  fciadfs uan sn()texoxo oodfpD anvo ()tetrxo3io4lle  fvsasfsrtaurpno4apto ictltfsDel(vs;t4 rtomrcoatoateli s t  2uoxr3oudapt  netl(  Dumuro;o4tpeomfciad s2rl(mo u0 reomrcoydoa r uvilt0s2xoxrpoy1op  mics sfsDraxr ot4oltnioetas s elnmp (0 rtnif3iatop   u o s0 exo(r3nydlme lnesat s2tmx  ;o1ole  octlt mDemumo;u)aexomrciytfmt anvi;s) rurir iy4omen fci () rrmxmono1tleoiocilslsDumn onu)arenmf3tydom rlnvo;t)truo(m3iu1amen icsasfsrrr(r ;t0teen fciad mDumumo t)teerircoy1lmDr neil(  2tmirpio1ap emivta(f 2uru pot4alxo ieiatls rm(ms;(4aexoxr iotfaDeln olt  exr(m3oo1omt  fei tfa2uaumpou0tpxn i3iytlm el(vpn(4 ltnmrctadomt aieo s trxr(r3ou1olee ics () Dta(  oo1tpx io3iasfaDulu o t)trermr3tytoat  u s (0s2um(rpiy1opt lnctl(faDrax ono0opt micias sDranms;u0tltrio ty1omD  neo;s) 2xrxr3iy1lptn fes (  2taurpoo4tltn ociad a2uauvs;t4trenir oydlmD  ivi s0 rur(o3nodomeemieil()s2umxmo;u4tpenmfeiatla emn o;u4tltnmf iotlpD li i ( s2trim no4al  lieilt)a2rru ono0oexn ieildlm2ulump;t)trenio io1lpDelnvi ()s2umxrpio1lp nmiciatf 2ur(mooo0apxoif3iad aDeanmpn(4altrmrciytoa r ies;t  rxmir3iy1am emneils) Dumx p;o1opx ifciad a2emumsnt4 rtoircio1omDeanvs t0sruo(o3oydaptnmnei sfs2trx ooo0apxoiieiyd s2ul( p (0 rermfciotlmDran o;s)setm(o3ou4ol e nesa()aDumumo;o0olt iociytfs eauvp (4 reomf tytoaD  u i (0srurim io4lpt  ncsltfa2ur(root0tpxo oeiat m2umu s;t4tetoxr3tydlp rlu s t0 euoir3nu1aptemies sf rraum nt0tpe  ieiad s uaump;(4arxoxr3iatlp eanvo;(0 2umxopoudomee fctasf 2urx  ;t4ale moctltfa2elu p t)teenxr oy1lmDraueo s0srum(m iudol nmict s arra(monu0oexn oeiatfa umnvs (0 exnmr iotfp r ivo;( sruoxm3iy1amtemnci tfaDuaumpoo4tpeo ociadfa ran o t4 eerio3oa1oat  uei;s)s2tr(o3io4optnmfci s aDra( o;o4aex  i3iytla2uaumon(0trenmr oatlaDrai ils t2xm(o3iy4aptnmfeiat srtrump;u0apenmfciytla em(msn()aexnmf3to1fatr uei t)srtrio nu4om e nct tfarraxr ;u0apxn feiasfm2um( pnu)tlerio3io1fmDeliei;s)trxr(o3oudape  nvi (farra(m no1ole miciydfsDra(mp u0 etomr3ty1lpte ivils tetm(opiy1om   fvt s)arur(rp;o1oet  iciadfs ra(vpn(0tlxoxo to1lpD  u s t0s2tm(opno1ap  lfcsat arrmumoot0tet  ietltfs rm(mp (4tlxoifcoadfm elues t0srur(r3io4al  livil()arumxro;u0tpt moeiysls2umu pn(4alxoir3tatomte nvs;t0 2tr(o3oodoltelnvt sfsrrrxm ;t4olt mfetad a2rmu onu4 lxrxr iodoa rli i ( teuoxm3oo4lm emnvsas) Dta(rono4opxoiietatfa2ra( snt) rxnxf iy1fm  lueols0t2toio iy4amtnlneta(fa2rau o;t4tpeomieiltlmDrln o u) lxomf3oo1faDr iei () 2tmim iy4olt mnvt tfaDurxmo;u4tpt  f3iltfs2umu p u)tetrmo3to1lm rlnes ()teuoxo oy4apt  ictat a2uaurpou4opt ifetatlm elnvo u0 eenio3iodoat lues s0s2toxo3oo1llt mfeia()aDra(mpou1tptn fetldlaDean o;(4 eenxo3oadlp eauvs;s srtoio ny1lm nmivsatf Dra(r no0alxnmfciatfmDrm(mo;(0tetnmr tatomtraivo;() rtmimpiodlpen icia()srtmumpot4opxo fciltfs umumpnt) lxnxfctytla   nes s) rto(o3oodalenmivslt a2tmxro;u4aleo iciydfs2ua(vont0 eeoxrciotfpDeln o;s0texmxm nydom  mnes (fa2raxrpou0oet  f3iys m rluvs ()alxnmr tytlptr ivslt) exo(opno1omtnlnetat)artr(m ;t0olx  f3tysfm2um(mont4aeeoio3totomDr n o (0 eum(rpny4am  mnci tf 2raurono0tee iictldlm ean p;t4arxnirciodlpDeln i t t2urxopiu4llt lncta()aDrru o;o1aptomocilslaDel( o;t0teenxf iy1lp  auesl( t2toxo nodamt  fvsl()srraxront1oleo ociaslm2umumon() reomociatop r uvol()truoim3oy1omte ict s) 2rmxroou1olt if3iyt m2uauvs;u4alxoxf tytlp e uvsls trurxm iy1aleelfei () Dtmx onu4texo ieiltfa2ul(vp u4aeenxf oa1omD  iesls)s2tmxo iu1aptnlivias  2ua(r ou0tlenmfciaslaDrmnms u) ltrxfcio1opDe i o ( s2ur(m oo4op elncia(  ruaur ot4tptomiciltfm umu o t0aexoirctodlpDeaieo;t) ruoio3io1ol nmnvi t) 2rmx p;o0oex ioctydls eln s;(0arerir3oatoa  au s ( t2tr(m nu1alte fcs t) Durump;o4tlxnmoctytlm umumpnt0trxrmf tatlpD lneol(0t2trim iu1ol emies t arum(r ;o0oetnmiciaslmDrau ont) rtrir3totoaDrlneolt)trumimpiu4alt mfctat arur(r ot1tltoiieils m el(monu0teerxr oo1op  lu il()trumxr3iydalt lfeils)arumx  ;u1opx mo3iyd aDra( s;t4aexnmf oa1lpt  n i (0sexo(r3ny1alen ics s) Dtau  ;t1alxnmf3ilsfmDea(vonu) lerxr tydfaD  ivi t)seur(o no4oltnmfcta()a2trum no4aeeo ieiysfmDrln ont0 rxnmf io1opte i slt)s2xmxmpiy4lm emnctat)s2ta(roou1tltomieiydlm elnvs;u4arenxf to1omtrln o (0tetm(r oudlmtelfetat arrrumpoo1tlx  f3iytfa2emu ont0tltrxo oo1lm r nvolt t2xoir oudamenmncias srtr(mpno4tpeomf3tlsfa2um(msn()teeomf3ta1op   nvsls0 euoxm3nydam   iviatf Drm(m oo1olxo fetlsfa2rm( o ()trenxf oadfm   iesl(0 rtrio3nydopenmfcs s) 2rm( pot1tptn o3tadfaDrl( s t) exnmf tatlpt luei (0s2uoirpoydll  lfeia() 2uaxrpnt4opto f3ilsfa2ulnvo;u)arxnmr oytlp rlueslt  rtmxr3ou1am elneils  Dtrx  ot1apxomi3iytla2rl(vsnt) etrmo iytfmDelnesl(  2xrxrpno4lp nmfvias) 2rax ono0oeeomo3iydlmDrmumo;t) ltnmr3oatfm r nei;s)t2tm(o3oodapt lfcsas)srur(  ;u4aex  feiltfm2uluvo;u)aetoxo3tadfatelnvs;()t2xrxo iydol   nesat) Dum(roou0tptomf3tld sDrauvsn() rermfcoa1fm   nvols0t2umxopio1llee ieslt) rtr( pou4tltn f3tysfa ean o (4 lxoir3oytlpDr neo;s)seumio3iu4olenmfetas  rrmxro;t0aex mf3ils a2eanmp u)arxrmrcoatom  ln s ()srtm(o nodapenlfvi s a2tax pno4aeto i3iadfsDeln o;() rxrxr3ootlp e nei s0 rxoxo3iudame mfvt s)sDum(mpot0oexnmieiatfm eln snt0trerircoydfpte ueo ( t2urirpno4amt lietlt) 2tr(r ou4aee  i3iydfa raumonu4aeeoxr tatfmDrlu s;( trxo(m no4omt  ieils)s2umx ono4texniieild s um(ms;t)teerirciotfpDr neo;(  2toir3nu4op nmicias aDraum nt0altoiieils s el( o;t4trtnif3oa1fat li ils  2xr(m3iy1am  mfvils)srrmxrpot4opxo oeiatfm2uln pnt4 rerxociodlp   i i s t2umxr3iudlmtnlietls)aDrmx ont1altn oeild sDrl(ms (0 eerxrcoytoat aneolt srurxr no1apt lncsas  2um(mpnu0tpe  iciltla elu o (0tetomf3oa1faDr ies t  eumio iu4ll   fcias)s2trx ont0aetomociydfm emuvo;(0 rtoiocoy1laD  n o;t) etrxo3ou1amtn ies (f 2rmu ono4tleomfctat m2uanvs (0teerif iy1optr n o t  euoxm no4lp nlfetatfa2rru  no0ape mociasfmDrluvs;u)aeerifciy1lpDe uvo t)t2xoxr3nodom nmfcil(  ruaumonu1tptnio3iatlaDea(vsn(4 lenif ty1latr iei;( srxm(m3io1lpenlfesa(  2raurp;o1oleoif3tlsfmDulu snt4artrmf io1lpDr ivi;( t2trxr3oo1lmtelfet ( sDtaumono4oltoiieild a2ua(vp u0trermf3iy1oa  luvs s)t2uriopiudlp  lnvtasf 2umum nu4tltnioctydfa rmnmo u0tetrif3iy1om r n o;t)s2tm(opiu4ap   nvi t srtmxroot0tlx mociyt sDumnvsnu)altoxf3oo1oatelnes s) rumir3nodal  lict ( srtr(m no4aexn oeiltfs elu o (0areomf3iadla elueilt srtriopoydllt lncs t) rrmxmpnt1tex  f3iytla2ra( o (4 ltoif3ta1fp e nvi t0trxoio oo4amtnlicia( srur(mpou0tpt ifciysfm em(mo u0texomr oa1omtr nes;(0s2tmxm3nodlp elivta(fsrtm(rpno1oleniictas a2elnvpn()aexrxrctytla rau sls0 euoiopou4al elfetl(f Drrumonu4tpxn ieiatlsDul(mon() lerxf oydfaD  nei t0 2xoxopny1op nlfetat a2rm(mont0alx  icild m2elu onu4arxomf iotla r iei;s truoiopoo1lm  lneslt arrrum ou0aexnmi3iltlaDrm(vs t0 etomfctotfpDrau il()tetoio iodom  mfeslt s2rrxr ot1optnifctysla2eaump u0aexnmrciatoa rlnvsls) rtrxrpou1amt lnetatfsruaxr ou4tpt  o3iaslm rm( o (0 eerxfcoydfm  aivo;s0texmxmpiudlmt  ivi tfarrax p;t1aexn ociltfs2ra( o t4tlerxo3oadfpteluvil()teto(opiu1lme lfvsas)s2rau  ot4ale  ieiyslm2rmuvon()tlenif tadfa  anvol(0 rxr(mpno4amen feilsfarrruro;o1ale mocildls rm( p;t0 lenif iy1omt  ivo;s0srumxm3io4lpe  ieias)arururooo1opt if3ils aDra(mpnt0altrmrctydfptelneslt0t2xmirpio1lm  lfeil(fsDtr(ro;o4ope  ictasfa umnvp;(0tlxnir3ty1lpDe nes ()t2toio3iu4om e ivsat)aDua( p;o1ope ii3tysfsDemn snt0aexoirctatlmDe n i (0s2xr(r io4llen fvt tfaDuax pot1opxnmietldfs rauvpnu0 etnxociydoaDr n sls  exrimpio1ap   ici sfa2rrumpou1tlt ifetydla2eanmonu4texnmf3oy1fmtrau o ()sruriopnudllteliet s)srua(monu1olto ociydfm2uanmpnu)texrmo tadop e uvs t setmim nu4omte fei tfs2ra( o;t1opxn i3taslaDumnvs;u)arxnif3oatlpD anvo;s0 eumxr3iu1altemietls aDumx  ot1oltomf3tytlaDranmp u)tlenxo3oadfpt  ues ()t2xm(r io4lm   ieil(  2ua(r oo1apxn ocilsfaDean pnu) lenxo tydlaD au o t trtmxr nu1lptemivs ()s2raxro;u1tex  ietatlaDeaumsn(4 etrmfciadfpD lues;t t2tr(r3oo4lmeemieiat artm(ro;o4ape moetaslm2emnvpnu4areoiociy1omDrai ols srto(m ny4ome  nci sfa2rmurpno0alt mieiat a el( sn()tltoxr3ta1opt au sl()seuoir iy1lme mict sf 2rm( ooo0oexn ieias mDemnvs;u0tltrifcta1fpteanesls0 rxrxmpiu1apee ivils)srur( poo4apeomicildlm ranmp;t4teenxrcoydlmte u ols)teurir3iu1lp e ncs t) Drrumoou0tlx ii3ias m2umnvo;t)tlxomo oatlat lueils0s2umirpiu1omeelivtlt  rtmxmoot4oleo ictltlmDranvo;(4teerxr3iatfpt livs;s  eumim ny4lm emfei (fartax pno0opeoiociysla ea(monu0tlxomocty1om  luvi () rtmir nodlm elies t  rtrurpot1tpe mociasla rmnmo;u)tltrxfcootlmDeaneo (0 exmimpno4op nlfetat  Dta(monu1tlxo f3ilsls ua(vp;t4tlerxr to1fmte uvol(0 2uo(r3nodlp   nctatfa2uru  nt0tlxomietat sDraumont4aetrxfctatlp e ueols0 eto(m3io4lm nlfcslsfsDrmumpou1texn oetydfmDea( snu4tlxnxo io1oa e ues;() 2xoxrpoydlm   icsat) rrrumonu0olto ieiys a uln p t0 exrmf3oadoptelieo;s0 2trir3oo4opeemfviat)arrau pno0tlxn octltlmDuluvsnu)aetnif totlm rln ol()setoir3iy4ome mfvtas a2ua(mo;u1ope  ietas s2ran p;t) etnir iy1lm rai o;s0sruoir3iu1altemnvs s)sDtr(mono4ale  o3tlslm elnmo;t0 lxomf3iydlm   u s t  etmim3ou4openmfctl()sDta(r nt0alto iciydla umuvsn(0aetnif oy1lp r uvols setrio nudlmt mfcsls)s2taurp;u4opeo feiyslmDel( sn()trerxfcoo1omDr nesl(0t2xmxrpoodalt mfvs t)a2rau ono1oex  fctltla ranvon()alenmfctydlat  ies s0 rum(o3io4lptemnesltf 2rmumpot1tpx ioctadla2um(mon()texnirctytla rlnes;t)trtoxo iy1lle mnvtat) Dtax pot4tex  feiasfmDem(mont0 reoxo oadfm  luvs (0trxrxm3iydlpte net tfsrta(r ou1tpt iieiydla2el(mo u4 exnir3oydlm rlnei;s0s2xo(m3ou1apenliet t)aruax  oo1tex iieiatls em(von(4 leoxo iodla r uei;t sexr(o3nodap  lfesat) Durxr no1tee mietasla eluvp (4 lxniociytopt lu olt0sruoim3io4al nmfeslsf 2ua(r no1oleo fciysfm2rlums;(4 rtrio3iy1lmtr u o s) etmxr3ou1am nmnci t)sDrmuronu1oltomiciydfa umnvs t0 ltrmf3io1op ranvil(0trumxopio1ope  fviasfsDurx ont4aeeomfciyd a2eau onu4areoxo totlpDeaieo (0trtm(o iy1apt lfes sfarrm(mo;o4ape if3tys m rluvo;(0texoir oy1fpDeai o;s) 2triopnudapen iviat aruax  nt0aetniictas sDrln sn(0arxrmo3oo1fatrauvo s0s2uriopiu1optnlfeiltfa2rmurpnt1apen fcildfmDrl(vo;()aexrxr oadoatr nei;t0 etm(rpnu1omeelncia(fsrurx  oo4apxomiciyd a2raumsnu4arenxf3totomt luvo;(  eurxopny1lptemivilsfarua(  ou0olxomiciyt m umnmon()artomo io1oa eanesls0setoxrpoydlleelicsasf Dua(m ;u1tltnmoeiysls2uln s (4trtnmo3iatlpDr ieil(0t2xr(r iu4lme  ivi s)srrmu  ou1olt ioeiysls emnvo t0tetoxr ia1fpDeauvs;t) etr(r3iodlm  mics tfsDrm(ro;o1aeenmoctltfaDrmuvo;t4 rxrxfcia1laDe n o s srumir3iydoltemfvi s) 2ta(rp;o1olt ioeildfs elnvsn(4 leomrcty1late ueils srtoiopou4op elfvtlt  2ra(m ;o0opx iieiltfsDrauvo;u) rxoif iytlmDelivil( teuo(o3io4amenlnet ()s2uaum ou0apeomoetls mDul( p;()trenio3tytlmDeli olt t2xo(o iy4ole  fcils  Dumxrooo0teeomi3ilsfa uanmo;t) ltomfctadlmDrli il(  rtrxm no4al   ncias  Dur(r ou1tpt  icias m2ua(vo (4 etrxrctatoaDe uei;()t2xrxr3iu1lltn fesat arra(m nt4tle  ietasfsDuln pnt4altnxf oa1fa rlnvo;()setoxm nu4ole  iei sf Drrx pnu0apx ii3tldfa rl(vp;t4trerifcia1faDelivils0seto(o3oodlpt lneta( aDra(moot4aleoioeildfsDraumpnt4alxrmr oa1om  luvi;s) 2tm(mpoy1lltemivtas)sDtmx ooo0tlxn ietyslm2emnvs t4 lxrio tatop  lnei (0trxm(m3nodom n neta( srtaxrpou0opt if3tyd m rluvp;()arenmr3oadfp r uei t0t2xm(o oudlltnmnet ( aDrmur ou4tlx ii3tlsfs2ulums ()tltrio3ty1fat  ivi s)teto(opiu1lmenlfcslt srurumont1tlxoiocilsfmDeanvs;(4tltnxr to1lmDeanvo;s texm(r3ny4ll nmncia(  Drmu pno1tetn i3tltls2umu p u4 eeomrcoydoatrliesls)srtmimpoudame  feia(faDtmxmp;u1aptnmfetad sDrmumo;(0 ltnxr tadomD aies;t0tetrxo3oy4lp  mivs s) rtmx poo4apenmieiltfa2rmn p;u0aexrmo3iytlmDrln s t tetrio3nu4amenlfctasfaDuaxront4aex io3iatls2uanmo t0 ltnir3tadlaD  nes;t srtoxrpny1ap  livsa(farum(rono0tpxomietydla uanvs;t4artoxoctadopt ai s;(0trtrxmpno1altnlfci s  Dtrxr ot0tpeoii3tat m rmums u0 rxnxr oydfmte nvo;t  2uoxmpnydaltemnei s) rraxr ;t0aexnifcildfs emuvo;u0alxnxr3iytomDe ueslt  rtrxr nydopeelfvi s  2rmumooo1tetn o3iasfa ul(vo t0tetnifcootla   uvi (0 etoxm3oudap nmiesl(fa2uau poo1texniicilt aDeluvsnt4aetrxf3iadlptr nvi (  2tmiopio4ap nmfctltfarra(ro;u1texomfeias m2el(vs (0arxrio ta1oatr u s s seuriopnydlpe miesl(  ruaxr oo0tetn oeiydls emnvs u0aeeomoctodlp rau i;(0trxoxr iu1omt mfct sf 2urum nu0oeeniietysla eaumsnu4 rxomf3to1laDe ueo;t)texrir3oy4lmt micia() Dua(mpno1tptn fcild aDumn ont4alermocia1oa  li i;t  etmxmpny4lltnmfcs s)sDtru pno0apx ifciytlaDel(vs (0aexnir3tytla   ivols0sexoio iu1apen nes ( s2urxm ou1aexnioetlt a2ran s;(4 lxrmfciadfpD lu o;s0 rtmxmpio1aptemivias)s2uaxmp;o1teeomfctys m2rln on() rtnioctatfpDrlu o t)tetoxm nu4omen fvils)s2uax  nt0aptoif3iadlm uan o t)trxrmrcoydomDe neo;t) rurir nodolt mncs () Dtmx o;u0ale mo3iat s umnmon()alenxr iodomt lu i s0srxm(r3oo4al n nesls a2rrxr nt0aee  ieiad sDrau snt4alenmr3oytfmDrlnvi;s)texoxr3iu4lmtn fvsat)a2tmumo;o4opx mi3tydfsDem(vs;(0aeermr todlmte neol( seuo(opoydop   ivia()arumu p;t1tlxoiiciyslmDua(mp;(4tetnxr oa1fpD aies t trxo(m iudam n ivtas  Duaxr ou0oetnifciydfa2ulu pn()altoif oodlmteauvs;t0tetoxr3oy4olt  nct sfsruax  ;u4aleoif3iyt m emnvo;u)aexrxf tytfp e neo;s0 eurxm3no4omtn nct sfaDur( p;u0optn oeiatlaDrlumo;t4artoifctadlaDe u o;() 2umimpnu4amenmfctl() 2urxm ;o0oex  o3ild s2rau on(0 eermo oa1fmt  u s;s tetoim iydlmtnmiei tfsrtaxrp;u1alxomocils sDuluvpn(0trenir3iatlmDelnvo;s) 2um(m3oodlpe mnvt sfsDtrum ou4oltnifctas sDelnvs (0trerio3oy1lmD luvi;s0s2toxmpiydll n nvil()a2ur( p;o0alxomo3ils a2rm(vo t4 reoif3iotopDrlnvs;( s2tr(rpiy1ll e fvsls) rtrx  ;t0alto octydfa2rlnvont4trtnmr3iydlaDeauei;s0s2uoir3ny4op elfcs t)s2rrxrpoo4alxniicias m2rluvsnt4tltnxrcoytfmt  n o s t2xrirpoo1op nlfesl(fsrra(rooo1tltnioeildfsDrmuvsnu4altoifctytomteaies;s0sexriopny4omtnmnctat aDuau o;t4tex ifetad s2ulu p u4arenifctotlp rlnes ( trtm(rpoy4lp nlfesas) 2rrxr ;o1tetomfeiys m um( s (4 etrmociodfaD au ol()s2um(o iu1omtelies s  2ta(mo;o0ope mfctltlm ulu pnt) rtnmf3oydlmD au s (0srumir iy1lmt mncs t)aDum( p;u4apeomoetasfmDem( on(4alxrir3tatomDr uvo t0s2um(r3iy1ol e ivsl(  Dur(mpot1alx iictytlaDua(mo (4 rtrxf oytoat ln i;t trxr(o nu1om  mfet t) 2um( onu0teen f3iyslm2ulu s;t4tltnio3iotoa  lneo (0 2tr(m3oy1oltn ivtasf Dtr(  ;u0tet iictyt s uluvon(0 rtnmrciatlaDelueo s0sexrxo3iodopenlncsat  2tmu onu0tlxo f3iys s2elu pnu0 etrio3oy1oatrau o;s  2urxm3nudomtemivsl(  Dur(monu0aleomi3iydfa um( p u4aetomo iadom  ai sls)s2xmxr ny1lptn nvi ()a2umxront1teeomfctatla ul(mo t)treoxfciy1oat  u i s trumim3io1apen ivtasf Dtru  oo4tee if3iysfa eaump;t4trxrif ootopDr neols  etr(rpoydole lneias a2urx pou0alxo iciyt a2emuvo;u)artoxo iy1fp  lnvs;t trxm(m3iy1opeemfvsl( sDrm( pnt4tle iiciltls umuvpn(0trxnircoy1op e uvo;t) 2urxmpiy4olt miesa(f ruaum ;t0apxomfciltlsDumuvs;() rxnircoo1lat ai o t t2tm(r3oo1amtelnvil(fsDrmxronu4teenii3iatlm rluvs;(4arenxrcootoatelnei s) rum(m3no1ale micslt)s2rrx o;t0tet  o3iasfs2rlu p;()teeomo3tydlmDr nei ()sexo(rpny1amtemneiatfsruau ont0oeeo f3iysfmDraums t0aexnmoctotlmte i sl(0srxmio iodlp  mietl(  2rmurp;u0ale  i3iydls2rmn p;t0 rxrxf3iadlmDr nvi ()trum(m oydop nmivil()arrmx ooo4opeoioetldfaDeauvo;t) exnxf3tadlm r u o s) 2tm(r3iydame  fctls  Drr( pot4aptn ictldlm rmuvonu4alxnmf3oy1lpDrlnvsls0seumxo3oy4openmncias s2rrum oo1texoioctytls2ua(vp;u) ltnxo iytfp eaies t) 2toxmpiu1op nlnetlt)aDua(rp;u0opxoifctyt m2umu o (4 ltoioctytfa eanvslt  exoxopny4ale  nvilt)srur(ro;o0aeto i3tasfmDrln o;()texoxocty1oaDeluvol( t2toirpou4ll n fvil()arua(m nt0aexn oeiyd s2umuvs t4alxoxo tydfpDrlnvs ()tetmxr oydlpe  iei ()srrmxrpoo4oltoioctaslsDranvo;t0altrmrcoodfa   nvs ( sexr(o3iu1lmen fcsa() Durx p;u4tpxnifetlslsDeanmo;t)aeerifcoy1fm r uvsl(0 2xmxmpoodamtn netlsf Dua(rpno0tlenmictasls2umn s u)trxrif iotfmteluvils0t2toim nu4alt lnvsasf rrmx onu0optn octysla2em( sn(0 eeriocoa1fm  aivo;t t2tm(o3iu1am n ncil(faDrm( o;t4tee ioetytfm2ua(vp t0tleomfctadfm r iei ( tetriopnu1al elnctat)sDraumpot0tlxn ictad s2uln sn(0tltomf3iotlpD  nvo (0s2xrir oodlleelfvias a2trx oot0oexomiciadfmDua(mp;t)aetnxo iodom r uei;()t2trxm ny1ll nmietls srur(r nt4texnii3tls m uan p;(4arenmfcoydopDelies;()t2urim oo4alt mictls  Drmu poo1texoiietatlm2emuvp;u0 lxoxr3iytlaDraivol()teum(r3oy4ol elfetlt srraumono1ale mf3ild s2emu p;u0aetoir iodlmte ueil(0tetoio nodlmtemivil( sDtm(  nu0tpe  f3ils m ua(vs t) rtnmocia1lmD auvs s0tetoio ou4om nmfctl()srtmxrp;t0olenmo3iadls2eau p;u)altrifctotom r uei;( texmirpio1amen nvtasf Drr(  ;u0tlx ii3tytls rluvo;(4 rtnxrcootoate ies (0 eumxr iy4om  lfvsat)s2ua(r ou1ale  oeiatfaDulnmpnu4trxrxo oatla raivilt s2trxopio4omeemfetatfaDtaxr ;u1tptnif3tytfsDuau ont0 etnmo3tatlptr nvolt srtrimpou1ap e feilt)aDurxrp;t1aee  ociltla rmu p;(4tlermo oo1lat lies (0sexm(o iu4lp emfcil( sDurxr ;o0olenmieild a ul( s t4 lenxf3iytfa  aieslt0setrio ou4altemivilt artmuro;u0tlenmiciatlm2uanvs u)aexnxrcoo1fp eau s ( tetoir3ny4lltemnvi t aDtmxr oo4tleomiciytfs um(vo;t) rerif3tydom eanvilt  eurxo3iu4am   ncta(farrmum ot1ope  f3iat s2umnms;()teenif3oodfpD liei ( truo(m oy4lpe  ictls)sDuax pot4tpeomociatfa2rmnmsnt) reoir ta1op e u slt srtoim3io1om emfvs (fsrraxm ot4apeoiieias aDrlumsn()aexnircoydom rlu o;()srtrxo3iy4am emnciltfaDtrurp;u4apeo o3iyd m2ul( p u0artomo iadom rln s s t2umxr iy4lp nmfvia(fsrtaumo;o4tptnmoetld s2rau sn()trxomr3iadlptrlu ol(0seuoiopoy4opeemivi t sDumx oou4aetnmiciysfm rmuvo ()aexrmocta1fat luvs s  etm(m3nydlmtemivs ()sDua( oou0tle mfeiat s ulu s;(4arenio3oydfmtelnes s)tetoiopoo4lpte fes sf 2rax pnt0ale moetad s2umuvo t) reomfcty1lmDr uei;( trtrim3oo4ap nlfctl( s2rrx oou1aleo o3iysfs2em( o (0tetrxrcoo1laDe ieils  exr(m3no1alenlnct ()aDuaumpno1tet  ieias aDelumpnt)aexrxf3ty1lpt  i ol(  rxoim3io4aleelnvslsf Dtmumpnt1altoioetad m2rlu on(0trenxfcoytlmte ivi;t  ruoim3io4ap   feils) Dta(rp;t4ope iietltlm2elnmpnu0 reoxr tytlmtraieo;() rurim oo4amee fcils  rtaxrooo4aex  ocild m emuvont)altomo oadlp e n o;s)sruoxm oydop  licsat) 2taxm no0tpxoifciyslm2ranvsn(0arxoxf3oo1faDrluvs;s)srum(m3oydam   ncs sfsDum( ont4tex  fctyslsDumu o (0tltrmo oatom  ln i s)texo(m oy4lp  lfct (fsDtrum ot4ole ifctydfs2elnmp (0aetrmf3iydlaDeanvslt)srxrio nydale  neia(  Dumxro;o4alx  fctad m2rmump u4aetrif oatfa  livi;t tetr(rpno4op   feia(fa2rmxmoot4apxnif3ildfm eau o u)trenxf oy1fptr nes;t0 2toxopou1lle mfciasf Duaurp;u0tpt ifciyt s2emnvsn(4texoxr3tatoptrai ols0 rxrim3oudoltnlfcias)s2ur(r nu1ape iieiysfa uln s;(4tetnxo iydlp eliesl( teto(r iydlmeelnvsa(fsrumxro;o1tltnmoctltla2umuvp t)aetoxo tadfa e ivo;()srtr(o ou4amtemncsa(fa2ra(r oo1tltnmoeildfs2uaumo;u0 rxomocoy1lp eaieo;t)srxoxr nodolenlncs sfa2um(  ot1ale iociatfa2emn o;t0aeeomf ootfa  li sls  2xmxo oydoltnmfeils srtru p;o4tetnmo3iatls2um(mp (4aetnif3iadopDe u o (  rxmirpoy1ope livta( artr(m ;t4oexomo3iytlm2eluvs (4alxrxrctatopDr ueo (0trumirpiydomeelfvt sf Dum(ront4tpeomo3tatlaDum( p;t)trtrif tatlpD  ueo t0 2uoirpiu4amt lfcslt)artr(  ;t0aet mfcilsfaDua(vo t4tlxrircia1fptrai il(  etoirpnodom nlnctls)a2uaxro;u4altoiicilsfm2rl(ms;u)alxomr oodoptr nes s) 2xoxm io1lle lfvi t aDtmx oot0oetn i3iatfa2emn o;(0 renmf tytopDeln il( srxmxopiodll nmnes (  2rrurpnu4altnmo3iytlaDeln o;t) lxnxr iy1optran i;t0seuoio oo1al nlnvsls)sDtrur ;o0aeeoioctlsfsDuluvonu)teeoxfcoadfp ean ol( setm(o3nu4olen nvil() rumxroot1alt mfeiys s2rauvp;u0areoxrctatom e ieo s0s2trimpoudole  ivs sfs2rrumono0texnmictad a2rl(mo;t0areoxfcta1la eli s s) etmxr3oudlm  lfctl() rrmx onu4oet mfcild aDrmnvsnu0 rxnmf3iytlm rlueil() exmim ny4aptnlfetl(  rtaurpnu1aleo iciytfsDua( pnu4 rtrmfcty1fp rau s;t0srxo(rpio1lmenmnvi t sDrrxr ;u1teeoiieils m emuvo;t0 exoio iydlmt lnes s  2xrxr3no1omeemivs () rrmu ono1aeeo feiydfa rlnmp;(4 lxnxfciadoaDeau s;( s2uoio3io1ame mfctatfaDuau ooo0alto fciaslm ra(vp t0tltoir3oadomteau o s s2umir3oydom e fvt s)aDtaur ou0ape iiciltfs2rauvp t4alenif todlaDe ivi;( s2to(mpoy1opt mnetasf Drmurpnt4aptnif3tydls uaump;u0 rtnxrcto1oate nvo;t)texr(o no1ol e nvils s2urxmpnu0tpt  i3ils aDrl(vo (0alxnxr3ta1omD  uvo;t0s2uo(r3iy1lp   fvi ( s2rmurooo4teeoio3tlsfm2emumo;t4 exoir3oa1fmt  uvs t  ruoxm3nodoleemictasfsDrmx o;u4tpxn octld sDemn snt4 etnmr3oydfa r uvsl()sexmxr iydomtnlies sfs2rr(m ;o0oee ifetydfs2eau pnu4 leoio oydoaDe ieo s)t2xoxrpio1lmt mncs s  rra(rpno0oet io3iydfs em(vs u0 lxnxfciadfmDrai o (0srtrxr3io4altn nvt ()srra(r oo4ope mictldfm2umu pnu) renif3iotomt ln sls) rtoir oy1am nlivi ( aDrmxr ;o1oee moetlslm elumsn() etomfciatlp   i il()srurxr3ny1llenlfci sfa2uaxr no1aeenmieiatlsDul(mo u)tltnir oo1omt  u o s s2trxr oydaltemnctat a2uax pnt4oet  oeiys a el(ms u) leoir ta1fmt  i i;s trumxrpoy1opt  nvil(faDrm(mp;u4tlt iocilt s2emuvs (0 renmr3oodlaD li i (0tetmimpnudll  mfet sfsrur(r ot1oltn i3tldls uluvpnt) lxrir3totlm eauvi;s0 2tmxm nodom  livil()sDrmx  no1olxoiietydfs2uanmsnt)teeniociotoatrai i (0tetoxmpoodope  fctl(f 2urx pno1tlxo oeild m uluvs;u0teeoif io1fp  lnvs t)seuo(o3ny4aleelieslsfsrtr(mpou0aex  iciatlmDel( on(0 etnirctodlmDeaneo;( trxoxr3iudoltnmietlsfsrurx  no1ope moetatlsDua(vp;(0 etnif tydoat lneo;(0t2xrirpiu1am   ics tf 2umx  nu1aex mfeiyd s2ul(ms;t)tleoio3ootop eauvs;s0 rxmimpny4om elfei () Dtrxmp;u0ope  ociltfs ranms;t0texnxo oatom rlneols srxoxm3oo4lmen ivs t)arraxronu0alx mfctad a2rauvp;(4trxoxf3ty1oatr u ils)tetmim ny4llenmnei sfsrtmxroot1olen oeiysfmDem( pnt)aexrmf3ty1oaD auvo t) etr(o3oydol nlnes sf rurumpoo4tet mo3tadfmDulnmo u0 ltnxr3tytlmD lueo ( teur(r3oy1ap nmiesasf Dtax poo4altnmoeiasfsDrm(vpn(4aleoxrcia1lpD  ieils0seuoimpoydomt lnvsas) Dtmu oou1tpx  fciat aDrmu p;() exrxfcoa1opt  i i;t t2tmxr3oo4alenlnei ()aDuau p;t4tlx mf3iyt s2rmumonu)alermr todomteaueslt  exr(opoo4om   nvt (  2umu p;o4tet moctydlsDemu p t0tlxnmf totfmtrai s ( s2uoim iy1lmtemivs () Dtmxmp;u4tleoifeiyslsDran ont)teeoxf3ta1fp r nvs;(0t2xrxmpiudlm   icsl(  rtmx pno4aee  i3tadlaDrluvs u0 rerxr3todomtrlies;t0 2tm(opio4om emfes sfsDumumono4tle  o3tyd m2emnvp t4 rermf3oy1lpt lnvi;(0srurxr iy1alenlfcsa(fsrumump;u4ape  f3iltfaDelump;t0 etrxocty1fp elnvo ()teumxo iy4lmt mfctat) 2tmxm ;u4tpen i3ilsfs uauvonu4 rtrir tydoate ues;(0 exrxmpny4aleemfvia() 2rm( pot1oex mieiatfa rluvsn(4trtrxoctodfm  luvs ()tetrim3oy4lleelfesa( sDrm(ro;o1apxniiciyt a2elnmo u0 exnir iydfptraiei s t2xmio3io1lle lnvs ()aDumxrpou0tpx  oeias aDemump (4 eenxocty1opDelu s t  etmim ny1omtelfcsa( a2umurono4oeen fctydfm2el(mpnt4altoifcoy1fa rau slt seuoxm io4om nmfcsasf rtm(mpou0alt  feiys s emumpnu)tlxnxfciodomtrai il(0sexoim iudame lnvsas)arta( p;o0apx mociat mDranvonu) rermr iytopt au i;t0teur(r3nodalenlietls) Duaxrpou1teeoii3tyslsDem(mo u4 eerxf3oadoatraueols)truoimpnu1al e nvtl(  Drax o;u1oeto ieiltfsDrln pnt4 exrxo tytlmDe u o;s  etmio3oo4ap nlici ( sDtr(monu0oeeoiiciaslmDelumo;(0alenio io1fm  lnei t0 rtrio oodlpeemivtat sDum( pot1texoio3iltfsDul(ms (0texrxrctotlm elneil(  2umiopny4om elfcslt)sDrax p;u4tltnmietlt m2rlumsnu4tlermr ty1omDr uei;t0srxm(mpny4lpe  fesat aDtau p;u4tlxoiociatfa rau p;(4 rtrmf ootoaDr uvolt  rtrxr3oydalte neia( a2uauro;o1tex mfctldfaDelnms;() rtrir3ta1om  aneo;t)tetr(o3oy1ome  fesa( arumx p;u4olx mi3tytfm rluvo;u0tetrmf oydlptrli ol( t2triopoydal  lfetl(fsDtr( poo0tlxn ociyt a ua( snu0areoio3iatfm r ueils  2uo(o3oy1llt lietat) 2tmxm ;u4texnioctlt m rluvo (0aexoxo oy1om  anes t0s2umxopny1lm e nei ( s2urumonu4oeeomfeildfsDuau snt4aetnmfciydoa r ueils trxo(o3iydapenlfct t  2rm( p;o1alxomo3iydlsDra(mo;() rxoir3oa1lpt aueols0sruoimpoudameemivs sfsrrrur ou0olxniictys s umn onu)trtnmf ty1om r u i ( tetr(m3oydop e iei sfsrumxrpnu1oeeo feiyslmDemump;t)trerxocio1lpD luvo;s0trtoxo3nodlpt mfvi tfsDraxro;o4olenmoetydlm2rl( o;t)tltoir tadlat  uvil( trxr(r3oudome mfcsa(  Draxm ou0oexniociltfa2ea(vp u)aetomf oo1fm   ieo;s  rtoxrpiu1altnmfetl(fs2rru ont0ole mf3ilsfs2ul(mpnu0tltoif3oadfpD  n i t t2to(rpiydomeelfeiat) 2tm(mont1oltn o3tld s ul( pnt0 exnircio1laDe iei t  eto(m3ny4apeeliet t) Dtm(moou4alxomi3iaslmDelumont4tltrxfcoa1lmDe neo t0 2tmxr3oodlmee iesa()srtaxmo;t1tlxomoeiadlmDran sn(4 eerifcoa1omte u o ( trum(rpoo4ap nmivslsfaDrmxr ou1aexn iciysla ea( p;t4 rxnir3oadfaDelnei;t t2xrxm3io1ame  nesasf Duaur ;o0tpt ii3iad a2umu o (0 lxoif oatomt an s;t srxmxmpiy1lpt mieilsfa2urxrpou1apeoii3tls aDrl(mp;t0tlxnif oatomt aneil( t2trio nodop   netl(fsDra(ro;o4apxoiicildlmDem( sn(0 rerif ty1lp eliesl( trtmxm oo1ll e feiasf 2raumpno0tleniieiadla2ul(vp u4 rxriociy1fp rlneo s  eum(r no1oltemnei t)arrm(  oo4oeenmoctadls2ranmpnu)aetomrcty1fm  livs t0 2trirpiu1olee nvs t)sDrm(m ou0oexn f3ildfmDraump;u0aetrir3tytlp   uvs ( t2uoir no1opt lnvt (fsDuaxr nt4tpxn iciadlsDra( o t) etnxrctodfa  an s;(0srxmxo3nu1openlfcs () Duax  ;u4texo f3ils m2eauvp (0trtnio oydfmDean slt s2toxr3no4lpeemict tfsrum(mo;u4texoif3tlsla uanvpn() ltoxf oo1fmDrlues;s)t2xoio oodlmtn netasfsDtmu pnt0opto o3iatfm2em(vo () rxrxrctodopDeaneo (  rxm(m iu1lpt lnviasf 2uaxm ou1opxo ieiydfa ranvp t0trtoxf3oytfaD  ivi;s0trumirpoo1lp nmfetat  2taurp;t4oltnifcils aDem( p (0tlxoif3ta1lmDeanvslt)s2uoio ou4omenlneiltfaDumxmpou0tpxoiociydfs2ean p t0tlxriocoatlpt ln sl( t2tmxmpnydlmtn feil(  2ta(rpnu0olxoio3iydfa2em(vo;t)trtrxoctadlpDraies;(0truoirpno1lm e fciasf Drm(rp;u4oet  ociatfs rauvs t4 rtoir3oatfaDrlivs;t0 exmio io1altemivtls) 2uax p;u1alxniieiysla ean s;(0trenmocoatlp elnei;t0seuoim oydolt  ivil( s2uax o;t4alen oeias s raumsn(4 renxo ia1fpte ivsl( trxoxm iudalee fct ()srraxmp;o0tptnioctltfa2uau o;()tlenxf iydfaDr n olt  exo(r oodlme lict t sruau pnt1olenmiciasfa2rauvp () ltnmrcoy1lpDrlies (  exr(m3no1ape  ies t)s2trum no4oetn ociat aDumu o;u0alenxfcoy1omt ln o;()t2xrxm iy4lm nmiciasfsruaur ;u4oeto f3iyd m elumpnt4texnxo iatfpDelu s;()t2xmirpou4ol n net s  Dur(moou4tltnmf3iys s eau s;t0trxrxr3ootfateln o ()srxmxrpiy4al  lnei () Drrx  oo1olxo f3iyd aDel( snt0tetrxociy1fp r ies;s0teum(rpno4lmtelnvil(f rraxrono1oeeoif3tldfa2rl(ms;t)alxnmfctodfmDeai i (0 2um(rpiy1ll  mfci ()a2trx ooo1tex  i3iys aDem(vp (4 exnio oadopt ai ils) rurir nudlptnlneilt)s2rm(rp;o0oet ioctasfs rmu s;u)arxrxr3tatlmtrlies;s0trur(o ou4opt lfvs sf rtru oou1opt iiciys a umn o u0aexoio iydomt  n sls)trur(m3oy1al emiei () rrax p;t1alxnifctyd s eau snt)aetniociatfm  auei ()s2tmxr iydam nlfvsasf Dtmxmpno0tlxo ictlslm rluvs t) rxoxr3iydla eau s s0 2xo(m3iu1open fcsl(fsDurumpnt4tpxo iciad mDrlnvpn()teeomfciadfmDe ies;s)t2xoxopoo1lptelnvtl( aDrauront4olto iciadlm ulumonu) renmrctodla r u ol( srxmxm iodome mfeslt)srua(moot0openii3iat s2rauvo;t) lxomrcto1om   n o;s)srtm(rpiydam nmfvsas a2tm(rpno4alx mieiyt a2em(mo;(4trxnif oytlm rluvo (  rtoimpnu1ale mfeil() rtr( oou0olt  iciasfa uauvsnt0trxnxf oatfptranvs s)trtm(o3oudomenlfcil(fsrurxmo;t4oltoiietltfm2rlu s u0 eeoirciotlpDelneo ()trxrxrpoudamte neslt  Dua(rpnu0tpt iieilslsDrl( p;u) lxnmo tatoatr neo;s sruo(r3oudlp  mnei s)aDtmx  nu0oeeoiicils m2uau s;t4teermr io1op eaiei s srxoxo3iudlle  icslsf Dta(  nu0tlto ieils sDul( s (0tlenmfciytlmtean ilt) etoxmpoydomtn fvilt srrr(rpno1optnifciad s uanvpn() eerxo3ty1om e ivolt0 rxr(m oudapt lneias  Drruroou0ale  i3ildlm eaums;t)aexnir iodfat ai ols) rtrir3io1opt  fci ( a2ur(r nt0alxn fetas mDrmu s;t4alxnxociytlpt li ols) rtrxopoo4lmtn fvs s)s2ra(m ;o0tpxnmfetadfa2ean s t) rtoxo3tadlp  luvolt0s2xmirpnu1lltelnet ( aDtmx  ;t4oetn o3ildfs eln ont0arxnmo tadlpt lieil()srxmimpnu1ome mfeil() Dtaxmpno1tptoifctys m emn p;(4 lxnmr3tatla elueo;(0 2xmirpoo1lle liet t a2taxmont4texn oeiltfm2rlnmo;u)tlenxo3ta1om  anvols) 2trio nydopenlnet tfsDtru p;t1tlt ioeiatfsDumu s;t4 lxrxo3oatlaDelu ols t2tmxr3oudllen fvsasfarta(mono4olenmociadla rau pnt0altnif oodoa eaivolt0sexr(r iodll   fvias) ruax pno4tpenmfciasls ulu s;()altoio tadlatrlnvo;s0 2uo(m3oodamee iciltfaDtrum ou4tee moctldfm2umuvo u4aexoir ty1opDrln i;t0t2xr(m3iu4lleemnct s  rum(r no1apxo ociasls eln o;u) rxomo totlaD  n o s0trtmio3no4ope  fcias sDumu pnu1tpeomiciydfa umnms ()arenmocoytfatrau i;(0srxr(mpno1altelietat) rtr(r oo4aet ifetadls2ranvp t)trtnio3iotfateai ols)trxoim nodome  nvil(f rrrx pno4tetomfetasfm2ul(ms t0 exriociotlpDrli i;( srtm(o3io1lm  mneiat)s2urxm ;o1oeeo f3iysfm um(mp u4aetomfctydfmDeaivo t0s2xoir3nydapee nvs sf Drr(  ;t1apeo feiytfm eanmp (0tlxoif3oydop r ies t sexmim ny1lm nmnvtasfsrrmurpoo4oeenifeiys s ul( s u0trxoxo tatom eaivs s)t2umxm3nu1op  lics () rtru p;o0teeomfeiys a2rau o;(0alxnio3to1fp r iesls)srtmirpno4lpeelfvtatfs2tmxrp;t1tpeniiciatlm2rluvo;u0 exrxf oo1oaDrluvil(0 rxo(mpiy1ap  lnctas) Dtr(rp;u4oltnifciltfm ulnvpnu0 lenif iydoat li o;(0 rto(m3nu4ole lnet t)aDumu pno4tptn feilsla2rmnvp;(0texnxo3tadfmDrlnei t0s2xmio oo1lpt lfesa(fsDrm(m nt4aexnmoeiltlsDulumo;t4tltnxfcoo1lptelueo t0trtoxm3iydam nmfct t aruaumo;u1aeen o3iysfm uauvonu0tlenir iotopDr neols)teum(r3nu4am e nvslt) rtax  ;t1ale ifetlsfs el( snu0tlermf to1lmt livo;s)trtmxopiu4ol nlfcs ()srrmumono1tltoiociyd s2umumpn()trerxocoo1opt au i () rxoxrpiu1llen ici t s2tau pnt4opxoiociytfmDrmnvo;u4arenxo3todlmtrai i (0s2toirpiodamtnmictas arrm( p;t4optn i3ilslaDuan pn(4treomf oo1latrlnvsl(0 rumiopnydape mfet t artaxmonu4olt  i3tytlmDrluvpnt4tetnxf oa1lmD anvs;s) 2urxm iy1ope  fctas srrmxr oo4oeeomieiasfaDrluvont0arxrxf3ia1oaD  i s;(  exoxm oo1ol nmieiatf Drau o;u1ale ifciltla el( s;u) lerircoo1fp   nes t0tetrim nu4lptnlnvs ()arrm(m nu4apeoiietad m ua(mpnu) rtrxrcoydlp  luvs s tetoxmpoo4ll e nciat sDrmxrpou1tpxo fcilsfmDulu s u4tltoifcoytfm elivi ( s2xmim3iydlmtemnvsl() 2umxmpou1tlt iicilslmDrl(vp;u)trxnxfcty1laDr n o t  2toxrpoo4aleelncias)aDta(moou4opeo f3ildfs rl(ms;u0texrio3to1la r u ol( sexr(o iu1altnmietatf 2rauro;o1alxoioeiytls emuvo;(4teermr3iy1lptraieslt)sexrxmpiu4op emiei sfs2rru ooo1opxoiiciytla eau onu4 lxrmo3tydfm  li o;s0t2xoir3io4ape  fct () rtaurooo0aeeomi3tadls2emnmp;t0 etoircty1laDelnes;s0 exmxopiydom nlnvs (f rumurp;t1oetn f3tasfa rmu s;t4 lxomf3iy1oaDeaivslt s2umim nu4apee nvsls)s2tmumoou4altnmoetld s rluvont4 rxnxrctadlmt livi;(0sruoio3ny4lp  lfvilt  Drrxr ou1apxo oeild m ranmpnt0texrxr3oy1op eaieo;t0tetmimpiodapee ncils) 2ra(r ;o1tex iieiad m rm(mp;(0aetrxf3oa1lp  livi;s seuoxr3ou1ap   fesa( sDtruroou0tet  o3iasfs rmumo;(4alerxfcio1lm eauvo;( trum(rpiy4lmt  nesa()a2urxront4oetoio3tasfsDua( snu4arxomo3tytlmDeai ol()sexrxmpio1amtnmneiasfs2tru o;t0olenii3tasfm ua(mpnu4 etrxocoydla rli s (  rxoim3io1amenmnct ()srta(m ;u0tpxn ociasla ulnvo (0tlxomr3totlmDrlnei;s0s2to(r3io1ole liei t a2uaxm oo0tlx  ictld sDum( p t4treomf3iatlmDraiesls0s2trxm3nu4lp n ici ()a2rrx p;u1altnmi3ilt m ua(mont4aeermr3oa1fm eai il( tetoxm3nodolt mnvilt sDta(monu4open octld a el( pnt)texomfcoytfp r uvs;s seumio oodoleemfvsatf rtaxm nt0opx mi3iysfm rlu s;u) eermr ta1omDraneo t0trtr(opiy1omee nvt s)s2trurpnu0open ictyt a2ranvp u4artnmf io1lmt aiesls0s2xrxr no1lmen nvsls)a2ta(r ;t4aet mi3tld aDeln pnt4 reoif3todfp   uvols)seuo(mpiy1ap n fei (f rraur nt1opx miciysla uau snt4treomo iadfptr ivs s t2xoir iy4omeelicta(faDra(mp;u4tpt ioeiatfsDrm(vpn(0aexrmr3ia1omD  nei;(0 2xrim iy4lm emfesa( artmx  nt1tpxn o3tldfsDua(mo;()altnio3oadlmtelnvilt  eumxopiodamt liviatfaruau p;o4tlenioeiyd s ulu on()trenif ty1lpDelueo;(0 rxr(m3iodol elfviatfs2umx pnu0tlt moctys mDeanvon(0tetoif iadopDraivsl( srtmim oo4alen fvtl()aDurxr nt1tet  f3iaslsDrl( p;(0trtnxo tatfm rlieils setoxr3oo4apeelivils) Dtm( pno1tpeomoeilsfm2eau s;u)treoxrcto1fpDr nei;s0seuo(o3iudop emneil( sDrrxmoou1tptoio3iasla rmuvp t0aeermf io1op  an o t0 etmxo iodom  livi (  Dtrur ;t0tetnmoeias a2el( o t)tleoir3oy1fmt  n s;( texo(mpiydlp nlici ( artaumpot1alt  o3iys mDel( on()trenmf oytlpDe uvols0 eumio3io4ope micil(f rraxm ;o4aeeo ieiytfs ul(mo (4 reomocoy1fa   ueo;s  euoxr iu4ap elfcil()artaxmpnt0tlt  ociytlm ul(vp;(4areomo iydlaDrluvolt  2tm(rpnydapt mnvil()arta(rpou0olen fcilt aDrlnvon(4aexrmrcoydlpDrln o t0 rxmim no1lpeelnet ( sDrr(  ;u0tltnmoeilslsDrl( s;(4alxrmo iotlp  aneo (0sruriopoydamtnmnei ( srrax o;t4aee ioetat mDumn s;t0 lxrir iy1om r nes t srxoir nu4am  lnvtl(faDtmxm nt1oexo ociytfs2rmnvo;() eerxfciatoa  luvs (0 2toxrpoudal emicia(fs2tm(r nu4tlt moetas m rlnvsn(0altrxrcoa1lp r uvo;t0trtr(m3oo1lpeelnvsa()s2ua(m ;u0aex  fetydls2emnmpnt)texnxf todlatr uvs s  exm(r3nydll nlncta( arua( p;u0tpto feiadfs rluvonu4texrxf oa1la  luvi;t) exmxm3iy4ap n feslt)arrrxrono0opxoif3tltfa eauvpnt0altrxrctydfpte i s;( t2umiopoy1lltnlictasfs2rmx p;o4aptn o3iltls2ea(ms u)altoir ia1oa e uei;t)trtoio nodlpee fvsls artmxmpno1tpx mfeiad mDrlnvsnu)alxoio3oodfpD  ueo ()t2toxopnudoptnlnei (farrrxrp;u1olxn feiytlmDeluvsn(4arxnir3io1fpteanvils  etriopio4ol emfeil()aDtrx  ;o0olen octltlaDuluvs ()trtrmo iadfmDraivsl( s2to(r no4lmtn iei sf 2ua(rpou0tetomf3iysfa2umuvo;u4treoifctadoateln o s0srumiopny4apeemiei s aDtmum ;o4teeomoetat aDua(msnu0tlxnxocootlmtrai i (0 rto(o3nudol emfvta( s2uax p;t0tlxo f3iadlsDul(mont0tetnxo3ta1lp   nei;t)tetrirpnodal n feil(fa2um(r nt4teenioctaslmDumn p;t)aexnxfctatoaD  uvi s0 rumir3oydlleelfei ()aDtrxrono4openiociat s elnvo;(4tetoio oo1faD  u ols) etrim nu4omtn nvtltfa2rrx o;u1tet  f3iyd s2emu snt4trxnio todlat anvslt) rurir iydapen nvils)sDumurpou4aeen ictltfa rmnvs u0 lxrmocoydfaDrauesl(  eto(opiodoltemfvias)srum( pot1texoio3ildfs2rluvo;(0 etrmf io1fpDrln i;(0trtrir3ou1lmtnmncias sDtrxm nu1oet mociasfmDel( snt) rxnio ta1fpDr n s t0 2tr(m3ny1lpt  nesa( srra(r ot0oexn icils s2ea(vp (0tetnircto1oaD anvsls setoir3nu4lpe lnct (  rua(rpnu0tlxn o3iltls2ea( s;()tetrmf3tatomDeanvs s)srurir3oy4oltemieias srrm(mpnt4apxoii3iatfa um(mp u4alxnio ootfa e neo;(  etm(o3ou1lm  lnesls)sruaxrpnu1optn i3ils m uanms u0altrxr oatop e n i;t) 2tmir nydal n nvtl(  rrr(mont4tpeo f3iadlm ranmsnt)trerir todomD aneils0 2tmir nu4lptnmnvilt aDurxmoot1tpt  oetasla emuvs;t0trtnio3oa1lptraiei t0 eur(o3iy4apee feils)aDta(m oo4texoii3iytfs2ulnvp t)aetrmf oodfmte nvi;s truoxr oy4omt lfcilsfarua(  ;u1alt mi3ias a rm(vont0trtnxo todfmt  ueil( t2um(o ou1lp   nct sfsDurumoou1ole iietadfs el( p;u4aetoio ta1lpDrln o t t2toiopou1ol nliei () Dtr(rpot0tpenmf3iasfm2ea( pnt)alxomfciydlpD anvol()s2xr(o ny4op nlneil( srrru oot4altn ieilsfs2ulu p t) lenmrcoa1omDrli i;s0teum(o oudap  micils) 2raxmo;t1tetnifcils sDua(monu)aleomociytoa rln s;t0sexo(mpny1amt mncsl(faDtr(mo;t0aptnmo3tyt mDranms u4aeerxf3tatoaDe ieo;t srurirpnodlmenlfctlsfa2tr( o;o4tpeniictat s2umnmo t4teeoxr3oy1oa  ln i s  exmio iodapt lncsat) Dtax ono4tleniiciltla2uluvpn(0altrio totomDr ivi;t0 rtoxr3io4lme lnvslt a2raxm ot4olxniieiydfmDra(vo t4alerir3ia1fp r n sl(0sexoio iudapt mfvsl(fs2rmxr ou1apx ifciasla2rmumpnu) etrif3oodla elivilt)t2uo(mpiodlmte ivi s)aDumxmont1tle ioetysla ua(mon() exnio ty1lp ranvs s trxrio ny1omt  neil(  2urum nt0ale mfeils m2rmu pnu4 reoif3tytoaD  uei;()trxrio nu4amt livil( arumxr ;t0tpt  i3ils a2ra(ms (0tlxoxo3oydfpDeaivslt trxoio3iydamte fcs s srra(m ;o4tpxnmieilsfm elnvp;t0 lenxf iy1fpDe nvsls)s2tmimpoy4oltemfvs ()s2umum nt4aetn fciatlm2em( o t)artoxrctytopDr n o s srtoio3iodlmee nesa( s2trum oo4oetoii3iat a ua(mo;t0aleomo ootfaDrlu i (  rtrio iodamt  nctls srtr( pnt4olxomi3ildls elu o t)aexnxr3oo1fatr nes;s0tetmio3iydlm  lfcsatf Dtax o;o1aeeomi3ils s2um(ms u0trtrxfcty1om r ues s0 eum(m3oy1op  licias srrr(ronu1teenmfetad mDem(vp u0aeenxr iytoptraivi (0 rur(rpio1om elivtas  Drm( pot4oeeoifetatlm2el(mp (4aexoif oa1la rauei s)t2umiopnudlmtnmictl( srumurp;o0tpeo f3tlt a ra(vo;(0arxoxo tydlaDeln il() rurxo3nodolenlictl() Dumx  oo1apenmfcildfs ea( o (4teerxo3tydomteli s () 2um(r3iu4op elncs tfarurx pnu0oeen oeiasfm rlumsnu) etnxfcto1fa r u o t0 2uo(o oy4lp e ietlt s2ua(rono0tet miciydlm2elnmp t) exrif iy1oat  ivo t  2xriopiudope mncias)sDtmu  ot0opeo f3ildlm2uauvo;t0aeenmr todoaDrlnvols0 2urxopnu4lpe liesat)sDtm(  nt0aeenmo3iadfs ea(mpn(0 exrxocoa1lmt  ies s0s2toiopiy4om elivi ( a2urxmpoo4tlxoii3tyd mDem( p u0 lermoctydlpt  n ol(0 exr(r3nu1amtemiei s) rtmu  ;o1olxnif3ildfs2uaumsn(0aexoxfctadfp r n o t texoirpoy1olt lfesa()sDrru ooo4opeo iciadlmDrlu pn(4 lermf tytop e ivo ( s2uo(m3iy4opte icsa()s2raxrpno1alxo oeiydfa2eanvp;u4arerifcta1laDeai s;t0 2toirpoo4lmen fvslsf 2tau pnu1apto octltls2eluvpnu4arerio3iadopDe ivo;t0seuo(m3io4alt  fes s s2ururo;t4olxnifeiltfa el( o;
\ No newline at end of file
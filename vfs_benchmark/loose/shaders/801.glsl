@@ -0,0 +1 @@
+iei;s  2urim3ny4op nmnvs s aDuau poo1tlxn fctad a rauvo;u4aleoxr3iadomDe uvslt0s2umim iu1lm emnetat  Dumx pou4alxomoeiydfa ulu s u4 lenxr tadfp  lnvi;s)tetmir3iydopte ics s)srraum ou1apenmfcias mDelu sn(0tlenxr iatlmtrlieol()srxm(o oy4lmtelics s) Draum ou1aptnioeild mDrlums t0 lenircty1fa  li i t0setmxm no4lp e feiltf rrm(m nu0opx io3iyslm ul( o t)altomociodfmt aneolt) euoxrpiodamenlnetls sDraur ot0tle  ocildla ean ont) renxr oydfa e ueo s srxrim3nu1om nmictltf Drm(ronu0apeomi3iysla2emnvo;(4 exoio3tadoaD au i s trumxr3iodlptelncsat) rtmu  oo1olxoioetat aDulu sn(0tlxnxf oodomDe i s;s)texmiopio1lpeemnvsas  2um(mp;u0apeomfcils s uan s;t) exrmo oadomD anes ()trxrxmpio4oleemneil()s2umxm ot1oex mi3tlsfm um(mo (0aeenxfcoadomDeli o t0s2xrxmpou4lpeelics sfa2rmxrpot0tltomoetadfm2ranvs;(0 ltrmr ta1fatelnei;t  rtm(r3io4am emfesa(fs2rrxm no1aptn oetys a ulnmpn(4 exoir iatlmt luvols  rtoio ou1aptnlfci t srrmx  ;t4opxnifeiydlm2em( s;t) etnmo totlpD anesls0seumxm3iudlptemieiat) ruau  no4apx iociltfaDua(mo;t4 rerif io1oateli o s0 2toxr3io4omte ivs t)s2ta(m ou1tptomo3iydls2ra(vs u4tlxrxo3iytfp   ivo;s0s2xmxopio1apeelnvta() rtrum ot0ape mf3iadlaDum(mo;u0texnmf iotlaDe neo;()trxr(m3no1apeeliesa(f 2trxm nu1apx mfetlt s2ra(vpnt)artrxrciotom r ieo (0trxrxrpio4op nmivils s2urxmp;u4oeeoifeildlaDemn o;u4 ltoxrcoy1opD  neo s trurim nodap   icia( arrrxmp;u1opt mieiyt a rlumpn() exoxfctodfmtranei ( trtmio3oudomeelnei t  rtm(moou4tetniietasfm umnms;t) lxrxo oatfp eauvo t)seuo(o ou4amteliesat)srum(ront1olxomociytfa2uan o;t) lxrxfcto1fmt luvslt0teumxo3nudop nmfcs sfaDumuro;t1opx mieiyt s emn on() leoxfcoatoaDe i s;(  etrxo oo4omtnlnvt (  Dtr(moot4tpx mi3ias sDul(vo;() rxnir3totomD  ieils0s2um(opnu4ole lietls) Dum( ooo1tle mo3ils m2ua( pnu)aeenmo3tydomt lueolt)trxm(opoo4lpenlivta( srrr(ro;u1tex mo3ils m2ulums (4 rtnmr3oydlp  an o;t)teum(m3iy1ape  ieias s2urxr nt0oet  f3iadla2ua( s u4treomo3iatfmtrauei s) 2urim3iodllenlicias s2umu  ;t0openio3iadls ean s (0tlxoiocty1fp  aneilt texr(r nydomenlicilt arrrxr nu1opxo ieilsla rmn o (0 eenxrciatopt  ieilt0s2xmio3ny4am  mfetatfaDtr( oot1tltn oeiaslsDemnvs u4arxnmrcoy1lmt  uei;s0tetrxm3iydomtnlneslt artrurpou4tltnioctlt s2rl(mp;t) ltoio3io1latrai s;(0 2um(o iu1ameelnvt s arua(mpoo1aetnii3ildlaDumn o;t4texomociytfpt lnesls0 2xr(mpoo1ol e ies s  rrr(ro;u1aleoifeiaslsDeanvpnu) renif io1om r i s;s)s2xoio3oo4am   ictltfa2urxrpno4ope  fctyd a ra(vo;u4tlxrxociy1fatrlivils)srum(o3no1ame lnci s)sDtrump;t0tptn iciysls2rmnms u)tltrio ia1oatr uvslt0seur(mpnudolenmfcsat aruaxroou0tpxn ictad m2ea(vs u4arxrmfctadfmtraiesl(0teurxmpnu4olt  nvi (fsDtr(mpoo4tetoiictyd s2el( pnt0aleoifcto1la raieo;(0 rtr(rpou1ame  fvil()sDrau onu1alxnmiciydfa2uanvon(4aleoxr ty1lm  au o;t teto(r iodol nmfvsltfsDtax  ;o1oetomo3tas m em(mp u0teerifciytopt anesls) 2urirpoy1lp  lfctatfaruaur no0opx iieiat mDea(msnu0aetoxf oydfate u o ()s2ur(r3nudlm nlivtasf Dumu o;t1apt  ieiasla2rm(ms u0alxomo3iytfpDeai s;s truo(m3ou1llt lnvtat aDrr( oot0tpe iiciytfa ra( s;()texnxf oadopt lueol()srxo(rpou1oltemietat  2rru p;t1aet mi3iatfs2eau s u0aexrircoo1fpt  u o;s)t2xmim nudape mfctltfa2uaxmpoo0oexn f3ildfsDemn sn(4alxrmrciotopt au i s  rxrimpoydop emfvi ( arrmur nu1oee mfciydlaDel(mp;u4alxniocio1opD li o ( texr(opnu4ol  lnvsatf 2raurpoo4oet ifeild a elu s;(4 exrifcoy1oaDrlnvs ( s2xrim3nu1amt lnesat aDrmxmont0oetoiociltls rmnvo u)tlxoirciadop e ivilt)trxo(o3ny4lpt lfei ( a2tmxmpno1opt mieilsfs ea(vo (0alxrxr iydlmDe ueslt)trtm(m io4op emfct sf 2raxm ou1alxo o3iyslmDrl( s;u0 eermf oadfpteluei t srto(m3io4lm n ivtat arrm(mp;o0texn oetas aDuauvo;(0teeomo3ta1oaDelu o;s0 etoxopoodap e icil() 2rr(  ;o4opto i3iatla ulu p;t) lxrxoctodfpt lnvo;t) 2xoxm iudopeelncias)a2rm( p;t0oex mieiadfaDua(vonu) lxrmf3tatfat li s;t)t2xm(o3no4ome mici ( sDtrxrpou4aex  ociytls2rl(vo;u0tlxoxr oatfp   ieil(0s2toim iodlptelnvia(fs2ta(mpnt0olxnmo3tadla ran p;(0 exnifctodoptrlieo s)t2um(mpnydoleemnvi t arum(  nu1oeeniieiytfs uanvo;t)texoio3oodfmteanvs;t s2xm(m ou4lltn ivta()aDtrxmp;u0tltnmociyt s emuvp;u0arxomf ta1faDraivsl(  rurxo nu4aptn nci sfsrtrxmpnu0oeenmietat a ra(vp (4alxoifcoytla eaieil( s2umio3iodaltelnctls arrmumonu4opt mfctys a em(mp;(0texrxoctotlpDelnvi;t0srxoxo oydlleelnvslt) rum(mpou1optoiiciltlsDul( pnt4aexoif3ta1lpt auvi () etoiopiodamtn ictat) 2ua(r ;u4ale mo3iat sDel(mo t)aexoif3iodfatr n o;t)t2tr(r oo1lme lnesa( sDtrum nt1tlxo f3tyt sDelu p t) rxnxr ta1omDeaies s)texo(o3nydlm   fcsat arta(  ot4openmietat a2rmnvp;u4 lxrircoy1omtr n o;t) 2xo(o3no1opte ivsatfs2urx ooo0tpe  oeildfs2umnms t4texomf3tatop ran s s0sexmirpiy1oltelnct ( arrauro;o4tpt mi3tltfsDea(vpn()aetoxoctotlmDe uei t)s2trxo3no4lp  lfcias aDtm( oot1olto o3iltlm2rmnvsnu0tetrircootfmDe nesls0srxoxmpnu4am   icslt s2rrxm ou4tpxomfetldlmDrauvo;t0 lxrxo oy1fp eli s;(  2xmiopoudalte nctl( aDtrumpou1alenifciyd m rl(ms;t0trtnxo io1lmDrlueo ()sexrxr3no1lmte fvt ( artrur ;u1oexomoeiydfsDrlumo (4aleoxf ia1om  aieo t srurio no1apeemfviltfa2ta(mo;o0olt mo3taslm2rm(msnt4 lxomo3tadfa rlnes;s0seurxm3oudlmt mfvil(faDuaumpoo1tpenmf3iyd a ua(mon(4tetrircoytfmt anvi;( trurim nodol elnvt (  Drax pot1tpeo feiytfmDulumpnt0 rxnirciatlmt anes t teurxrpio1am n ncsa(  2rrurpou1apenif3tlsfsDra(vp;u0alxrirctydlpDeaueilt srxmxo3iu1am nmivtl(fs2uax oou4tetn iciat s uau p;u)tlxoir3oytlpte uvo t texo(opny4am emfcsl(fsrrmumo;o4optnmi3ildlaDemn s;u0 ltrif3tytfmDeaiesls  eum(o3iu4amt mfei ()s2ua( ooo0tex mfciys m2rm(vsnu4aeeomf3iydoptelnes;()t2to(o3io1lpt lfeslt srta(rpno4olt ifetasfm2emu s;t)tleoir tatlpt  ieils t2xrxo ny4lmeemncs s)sDtaurono0openmicildls emu snu)trtrir tatoaDrlnei s)sruo(rpoy1ll  lnes (f Draum ;o4oltoii3iasls2el( o u4texnxr3todomDeaivil(0 etmxm3oydopt  fei t  2rmumo;t0oleoiiciyd mDranvo ()trtrio3ty1laD aiei t0sruo(mpoudll nmicils  Dtaxmp;t4aeto fctadls emn s u4 ltrif ty1fp  lnes s)sexr(mpno1am e nci t) Dtmxrp;t0aet iietlt a2ulnmont4tetrmr3tadfm  luei;t srxo(rpnu4alt lieils)srraxrooo0tpe  ictas sDranmpn() etnif3iydfaDrlivi;t0sexr(r3ou4ll n nvs tfsDuaxmp;o0apeomfciltla2rl( s (0 etnifctadlm  livo t)seum(mpiy4lm nmnvi ()sruauro;u0aptnifeiltfsDuau o (0trtnmo to1lm  aueo ()t2tr(opoo1ope lnvsat)s2ra(r ot1aexnii3ilsfsDuauvo u) leoxo oo1fptr ieo s t2xr(m no4apenlneiat)aDraurpno0opxn fetasfsDrmnvs (4 eenif oodomtrlnvols0s2trio iu1lpt mncs s) rrmxmooo0aet ifciad m rm(mp;()aexrxf totfa rlu slt  rxrim nu1ope lncias)aruaumooo4oet iieiysls ra(vp;()aetnmfcoa1fpDrlieolt) 2tmim3oy4ap elneslt sDrrxr no4olxn f3ildfm rlnvp;()teerif3tadomtran s;s0trtoir3ny1om   ietlsfaDtm( ooo1ole iietadfsDuanmsn(0artnmfctadlp  an s;t texrxr ny4lm  liviasfarrmu pou0apx io3ild a rau pnt0 exoxo tydlpt lieolt t2xoxm3oudalenmncilt sDurur oo4alen i3ildlaDraums;t)aeenmr3oo1lmDrlivols srtoimpno1olenlfctatfsDurumpoo0texomf3tldlaDeluvpnt0artrio3ta1fmtrlnvil(0 rtoxmpoy4llen fvta() Dumx  ot0tlt mfetys s ua(monu0 lenxf3tatfp e n ils  etrir io1lme  net t  rtax  oo4tleoiiciytfsDumnvp;u0 reoir totfmtr ieol(  rxmxo3iu4opte ivta( a2rrxrpno1tetomf3iltfs2eaump t0 lenifcoytoatelivo;s)s2xmxopoodol elnesas srrr(r ;u0oex  oeiat m um(vs ()altrxo3oadomDranes;(  rum(r io1am nlfctls)sDrrurooo0apeomocildfsDea(vs t0aeeomf iydfpt ln s;s t2uoxm3no1omenlnct ()aDurxronu0oexnmfcildls2ul( p t4tlerxf iotlp  au o;t0t2uoxo3no1ap nliei ( a2trur no0oltniieilslsDeanvs;u0trxnmo3todomt aiei;t  exoxopiudomtelieta()aDuaur no0optomfcildlm2ulnvs;u)arenio oy1fm  lu o (0s2tm(o oodlpeemietls) rtrxm ou0texomieiytfa2umu o;u)tlenmoctydoptraneo;(0 etr(r3iodam nmneiat) rum(ro;o0teen ocild m uanvo u)alxnxf3oytfmt  ivi s0sruoxo3no1lle mfetas sDrau onu1tet  ictys s2rln snu0tltoxocoa1lat auvs t) rum(o oodaltnlnei t arrm(rp;o1tltnmfciyt mDeln pn() exrircoydoptr nvils0s2xm(o3iu4al e feia( srrmu  ;t4tlx ioeiatfs2el(ms;u0tltrircoy1opt lu i s sexr(mpiy4ol  livtatfaDtru pou0alxo o3tldls2ulumo;() exnmf iydlaD ln o;()texo(r3iydom e ivi s  rumurpno0opxoii3tltfa ean on(4 exnxr3tadlm eaneo;()seurirpoo4alt lfct tfarta(ro;o4aptn fciyt mDrl( o t4arxnif3oadfpDeaueo;(0 2umxm3iu1oltnmncs t)aDtrxmpoo4tet  o3ils sDel( on(4tlxrxrciytomDr ues;(0 rtmir oy1lp nlics ( srtrxroou4tle moeiytlaDran pn(4 lxomr iytopDelivolt0t2triopiodal  livtltf 2rru o;u4apxomiciltla elnvo (0trxrioctydlmDelnvo;s0srxrxo3iy4opeemfei ()srumxrpnt4olxn f3ildlsDumumo;u0trxoxo3tatomDe nes t0srtoxmpny4ll   icia(f Dtaxrpno1oetnmoetlt s2rm( o;(4 rtrxo iadfa  au ols)trxo(r oo1lpt mnes ( artm(  ;u0ape  fetlsfsDrlumo t)tlenxo ty1faDe uei t)t2tmim3iu1lmeelnet t aDrrxronu0tlenmo3iadls2el( o (4aleoxo iodlp rlivs;t0seumirpiu4llt mics t arra(moou1tlt  ictlt m eanvpnu) rtnif oadopDeanvsl()t2tmxo3nu1apenlfcs ()aDtmxrpnt0tee  f3iad m2ua(vpnt0 rtrxfctydoa  anvo;s0setmir3oy1oleelics t) 2tax  ;t1opeomictadlmDemn s t0tltoxf oa1lp r nes;s0srurxr iu1lptnmncsatfaDrrxrpou4opxn ieilslm ua(msnt0 ltoxo iytfpDr nvilt0srtr(m no1al elnvt s)sDtauroot1alenii3ilsfa eanvsn(0trtnir iytlmDrlnvs;(0texo(o3ny1am  lfcsa( sruaxr ;t1teeomfetasfm eluvon(4 renircoodlmtraieo t0t2urio oo1ame lietlsf rta(ro;o0aeen o3ildlm2uluvs () eenir io1fpD anvi () 2xmxm3oy1om  mfvs (fs2umur oo0olxn oeiaslmDranvonu) eenmo3oo1opD an i s0sexoxr oo4am nmicil()a2umur ;o0apxoiicild aDulu s;(4tlermo oodfaD aiei;t0setoio oo1amenlnetlsf rrrx  no1oleo i3iadlm umn o t4 reoir ty1oate nvs s sruo(r3nu4amt  nctat) 2rmuroou1aeenii3tydla rluvpnt0altriocto1om rai il()trxr(opno4omee net sf 2um(rpot1aeenmociad m2eau s u) rermfciy1lm r ivo;s)s2xmxr3oy4ol emicsatfarrr( p;o4tptnmfeils mDua(msnu4arxrxoctodlpt ai i t srur(m3oy1altnlieta(faDur(  ;u1texnmfciydfs eluvs;u4trxrio ootfpD aies t t2xrirpno4amtemfvs s  Drmumonu4apenmiciys m2emums;u4altrxf3oodlp  lu ils srtrim iy4optelictas arum(m nt1oltn o3ias a eaums;(4 ltnxo3iatfmt  n ils0srtoxo3ou1ol e fviat arrr(rooo1tetomocildlaDem(msn(4teeomoctatoptr ivs t trumirpiodale  feta(fsruaxmooo4tptn ieiadlm eanms;t)arenmo tytfmDe i s;s)trtmxo oudamee nct tf 2um( oou0aetnmoctyd a ul(vsn(4aetnmfctodopDr i s;()t2xmxr3nydopenlivtlt) 2ua(  nu0tpt  ieiydfa rmn snt) exomf3iydoa  ln olt srtmxrpiy4om elfcs s  rumxrp;o0oetnmoeiytlmDrmump;u4aexoxr ia1laDr ies s) rumim oudlmen fetl(faDraxro;u0oltoifeilsfaDeanmonu4arxoxr3ia1oaD an o;(0 rxriopiy4al  licilsfartr( p;t0olenmi3ilsfaDea(vo;u0 leoif3tadfm  lnes;s seum(o nu4amt micta()aDrrx  ;t0tltnmfeiytlm emn snt4aexomfctydfaD auvs;t0 rurxmpou4lp emnesls artm(mo;u0texn i3iys a rlums t)texnmr ty1lpDr nvi t  rtr(o nydapenlfciat srua(  oo4ale  octysfsDrmnms;(4altoif tadfa e ivi s) 2trxo nu1lm   iet s) 2urxm ot4aex mfeiyt s2rl( p u0aetrxr oo1fmD lieo;t0 rxmxr iu4ol nlfctat)sDrmxroot1oeenmo3tysfs2rluvo;u)treoxfciydoaDe neslt) 2to(r ny1op   nvsas)sruaxro;o1aexnio3ilt a rl(ms;t0aexoio3oydlm r n s (0sexrxr nydop emncs t)sDraumpou4aex  ociatfm2rmnvsnu0aetrxoctatfpt luvi;s0s2xr(m3oo1lle  fviasfaDuaxmo;t1tlto oeiydlmDrmn sn() exrmr iy1oa rai olt srxrxr nu4ameeliei t arua(r ot0opxn iciytfa um(vs u0tlxnmo3totlatelu o;t s2xoxr3iudlle mfvils  rrax ooo0opxnmicilslm rl(vp;t) exnir3todfatranvi;t)sexr(o3iydam n fet sfaDtaxro;u4apt mieiytfs eanmo;u4aetomo3iadlmDrlues t0t2xoxo3nudlp n fvtl(fa2umu ooo1oexoiietlslm2um( p;() etnxfctatomD  nvs;s0trxoxrpoudol  lfci t  rtaxm ;u0olenmicias sDuanvpnt0 exrmfcoatfmt lieilt texo(o ou1lpeemnci (  Drrxmpou0open oeiatfs umumpn() rxrxf oytlpDr uvilt s2xoxmpiudllenmivs (  2ta(r ;t4tptnmfeilt sDrmnvo (4 eeoiociytlat ai olt s2xrxmpoydape lfet (f rrrurpot4olto o3iytfm2rauvpn() rxomr3iytlptr neo;s)texr(m3oudol nlnvi t)sDuaxr no0opx moeiltfs2uluvo;t4texnxoctatopteln ils0 etrxm3ny4lmt  icilt)s2tr(m ;t1altnmociyd m umumo;(4aetrxr to1oatrauvs;t0 rxriopoo1ol  lnvsas srrr(ronu1tpeoioeiyt a2ulums;u0 lenmrcoydfmD  uvs;(0t2tmxo3oodam nliesatfs2tru pnu1tlxo fciyd m2rluvs;t0 rtrmr3tatfpDrlivilt) 2to(o oodapte ieils  rrm(  oo0olxn iciad s2uluvp;u4aexomr3ootoaDeln o t0 2xoxo oodap nlfcsl( s2uaxrp;o0opeo f3tas s umump u)alenir iodlmDe ies;()setrxo3oy1lm   ieiatfartr(  ou0olenmiciasls uluvp;u4aexoioctytomt  ivolt0 2xr(o3iudol n ncta() Dua(  ;u1tltomocilsfs2em(vo;u4aexomf3oa1lpt  nvo s0setoxopoudolte fcsa(f 2raump;u0apt  ocilslm2uauvs u)trxrir3tatfa r ieils  2to(r iodole lfesltfs2ra(mo;t0oetoifciasls emump t4aexoio io1latr i i;t0 etrxm3iy4lmtnlnvil( sruax o;o4alxn o3tatlaDemu o t)altrmfcoytomD li s;s)teumir3iy1ape  ictat  2trx ono1olx moctltfs2elump;(4aleoxr3ootlptrlnvsl(0setrxopou4lptelivsas)srurxmp;o1alx ii3iat m uln o u0arxnxo3tatoateai ilt0sexrxrpio4alen neia() Durxm ot1ole moctldfa ua(vonu4tlerxfctydfatrlu s;t0tetrir iy1olt  icias)srrmxrpot0teen ietldls rm(mo u4arxrxo3totlmteliei;s) rtoxrpio4amt mnvi s a2rmurono4apenmoeiltfm2rmumo (4tetnmr iodoa  livil(  rto(r3oydlpen nvi t srrrx p;o0ale mo3iydls2emumpn(4tlxrxfcoa1fateln s;s  etoir iy1amt  nes s)artr( o;u1olenifciadfm2emnvo;t0tltoxocootla eai slt)trxmimpny4ap e fctls s2tru pnt1altnmo3ild m2ul(vs;u4tlenio tatlpDe neo;s srxoirpno4aptemfcia() rtmxrooo0tee ifciatla emn o t)alxoxr3oytoa  liei;(  etm(r oodop emncilsfa2rr(ro;o0oexoiociat mDrmums t4 etrxfcootop raueo ()trtoxo3oo1aptemivilsfaDrrx  ;o1oeeomietatfmDrl(msnu0 rxnmrciydlpt aneslt  etoirpno1aptnlfesat) 2uru  ou1altn i3tlslm ranvs t0tlxoxf3iadlptr iei s)s2xoiopoudopenlnvtlt)arta(r ;o1tlt ii3iatlmDea(vo (4artnmrcoa1faDe n ils)tetm(mpny1am   ivias) 2ta(m ot4opxnmo3tydlm2uln pnu4treniocto1laDeaueo s0 eur(o iu1lmte feiat)sDrm( p;t4oet ioetydla2ul(vo;(0trtrmf3ia1lmDrau o;( s2uoxo3oudolt licsl(f 2rau ono4olxomietyd s el(vont)treoif3tytomDeaies s texm(r3no1om  lnviltfa2trx p;o0oltnifctydfm rmnmpnt)artoxo3ia1la e ueo;s0seurirpoudomtelfvtltfartmx pno1opxoiieild a rmu p;t0aexnmfcio1laDran s s  euoimpnydamte neia(  Drmxmp;u0aptoif3iadfs umnmo;u0 rtrxrcoa1opDrlueo;(  exm(rpiodome lfesas sDuau pno0ale  f3ils aDea(vo u4trtrif tydlaDeai ils0srtr(r io4opee fcslt)a2rrur ;o4optnmf3iltlaDelumpnt0arxoif oadfpDraueil( t2ur(r ou4op elnci t sDtmxr ;u4apxn feilslmDranvsnu4 eenmr3oo1laD au il() 2xmxmpiydape lneta()s2rmxro;t1aeeoifcilsls rmnmo;u0teenxfciytfmt aivsls) rxr(m3ny1ll elfes s) Drm(mpnt4aexn oetltla2rmuvo (4trenircoy1fpD au ol(0srtr(m oy4om nmivilt  Draxr nu1apenif3ils s ra( o;(0alxrxo tydomD  ues;t seur(rpoo4lmen fvslt) Drmumpot4teeomiciys m2eanmo u0 ltomocta1fmDelnvo;(0 rxrio3oy1ameemieia(f 2ra(m nt1olxomieiadfaDraumo t4texoxocoodlpteluesls)seur(m3no4apt  nvils) rum(rp;o0aet mociat mDulu pnu4 etnmf oa1lm rlnes t  rurir nodap e nci s) 2taumoou4tpt ifeild m ra( pn(4 rtrxf ta1oaDelnvo s0t2tmio3ou4lptn ics sfaDraxm nu0opeo octld s emumo;() etrir3tydoa  lnvs;( s2uo(m3iy4amt mictl( aruaurpnu4oeto f3tyslaDua(von()aeenxo ty1fmt auvi t trxmio oo4lme mneilt sDur( poo0oltoif3iyd aDrau o ()altnmrciatlat lu sl(0sexmir iy4lm  livt (  Dta(mont0oltnif3iatla uanmp ()artnxr3oadlp r i olt0trtm(o ny4llee ivs tf 2taur ot0tetomf3tat aDuan s (0altrmfctytlptrln ols)trxrxrpny1lpe livtasf 2taum nu1openiictytfmDrlumsnu0treniocto1la rluvols)texr(o oy4lle mncsl( sDta(mono1aeeoio3iys s ranmp;(0 ltrmr iadfptelueil(0trtrim iy4ole mfci (fs2rmxrpno1optnifctytls em(vo (0aetrmociy1om r uvi;s0seur(r no4ap nmfeslt)aDurxrpot0tetomoetas a2umuvp u0alenif3iytoptr neols)t2toxmpiy4omt mivsls s2ua(ronu4opt mf3ilsfs2eln s u4arenmr oadlatr u s;t  eumimpou1ole lics t) 2taxmp;t0ape if3tldls2rmu pnt4 eenifcoa1fmDr i s;s0srxo(r oodap nmict t)arumuro;u0oexnmoetytfs ea(mp;t0tltoxrctadoa  lies s0s2xoxr nydopeelfcsas  Durx o;u0aleo ietld a rl(mp;t)artoxociadlpteaueo;t)srxrxo3oudlle  neiat) Drmu o;o0aex io3tyt aDran o;(4 rxomf3tatlaDeaivil(0 2xrxm oo4lptnmneiasf Dtaxm oo4apenmoeilslm uau s;() exrxfcoytlpte nvs;t s2to(rpoy4opt mictl( s2uauroot0tpen oeiytfm2emnmpnu4trxomrcto1lm  lu s;s)sruoxm ou4altnlncsa(f 2rrxmo;o1tpxomi3iadlmDraumpnu4artnir oy1lpDrauei t srtr(m oudam   fcil() Drrx pnu1aeen ocilt aDeau pnt)tetrio tatlatr u i;s0teuo(r3nydape  ictltf rrmu  ;o1alxo feiaslm2um(vsnu0 etnif iydfaDrauvi;s)trtrimpno4llte neils sDuaumo;o1teeoiieiasfaDumu ont)aetomo oa1lpt  i s s)t2xr(m ny4lmenmnesas  rumx oot0tpx mf3iydla emumsn() rtomo iodlmD aivi;s)texrir oydamtn netlsfs2rau  ;u4tltoiociys a ul(von(0tlxnmr ta1op   ieslt texmiopoydlpte iviltfs2umumo;o0tltnif3tatfa2elu on(4altomo3iadlmte n s ()t2tmio oy1am emici tfaDumu onu1apen fctyt s ua( p u4trxoxociytlpDran s t)trumirpiy4opee fciat a2umu  oo1aeeo ieiyt m eluvsnu4 eenif3todom eln slt0t2tm(mpoo1amtemfcsa(faDrrumpno0altn oeiatlsDea(vsn()arenxo iotfmtr nes (0s2xo(r3iodal n fvsas  rrm( oou1open i3ilt a ra(vp;() ltnxfcoatfaDe ieol()texoir3oy4lpee netatfsDtaxro;u0aptoifctltlm2um(mo t) exnxf ty1fa e u slt) 2toxr3iy1olt lfcs t)artrx pno4opt mf3tldfaDuluvp;u)tlxomrctadfpD au s t)s2urio oudaltnmncsl(fsDumx  ;t4teen oeiadfs em(ms t0 rtoxo tatom r nvi;s srtr(r iy4alen nvsatfaDrrur nu0apt ii3ilsfs ea(vpnu4trxoiocia1fm r nvo;( teuo(mpnu4lp e fcs s) 2taxr ou1aeenif3iydfaDraums;u)arxnxo iadopD  nvsls)trtm(opiy1ll   ncilt) Dur(mpnt1tex  oetydfa um(mpn(0 rxoio3oatfp   ivol(0teumir io4ll nlieiasf Drrxmoou4apeomiciysls2eln snt0trenxr oytlm  lueilt)s2toim nydom n fcs ( s2urx o;u0apeomf3iltfm2rau p;t4aexrif3iadoaDe nvo () 2urxm3io4ameemnei t) rraxmpou1tpeo o3tydfm emnvp (0treoxo iytopte ueo;s srtrir io4llenmict t s2trumpot0olx  f3iasfs ul( snu4tlenxocoa1opD lueo;t)setm(m3no4amtnmneslsfs2trxm ;o1oeeoif3tltlm em(mpnt) rxnxociotfaDran o;s trtr(o ou4op e nesltfaDtmxrpou0oetoifctysls2ea( ont4 lxnxrcoy1fatraivo;t trxo(m io1omen fviat arrm(rpoo0opeomoctydlm uauvo (0tlxoif oydom e nvo t0 2xmim3iy4lltelivslt aDtaxmp;t0opxnifctldla2emn sn(0arxnxfctadoaDr uei ()trxo(r3nydal n fcil( sDtax  nu0opxomociat a2ul( s;u) exrmf iatfpDe ueo;( trurirpoodopen ivslt)sDuau ono1apenmietltfsDrmn on(4 lenmf iadfpteaiei s  etmxo3oo1llte net (f 2rmxro;o1oltn i3ild s rlu snu4 ltoif3oatfp rln o;()texoxr iodlleelneta(f Drrum oo1tpt  oetldfa2ul(vs u)aetnmoctotopte i s;s trxrxo oodlmen ies s  rurump;u4tpxnmictlsfa eanmpn(0trerxo iotlat liei;() euoio3ny1amtelfcsl(fs2tm(roou1teeoifeiat s2eanmo;(4tltnxf3oo1omtelnvols)sexo(o oydoptn ncsat)sDra(  nu4aee  f3tydlm rl(vsnu4arxomo3tatopteanvi t)srtmxo3no1op elfvslsf rrrxrp;t0oet iieiadls elnvonu0arermrctytfpD liei ( srtoir oudom n ncil()aruaxr ou4tltniicilsfm2ra( s t)trerxr to1oaD  i s s0trxm(rpoy1lpee ivt (fs2um(  ot1apxn ieiasla2rm(vp;t0altoiociatoaD aivs;(0sruoxo oo1llte ivsatf 2uau  nu4tlt mfeiyt sDem(mo;()arxoircoy1optr u s (0srtrimpnodope mnesat arrrxmont1teenmi3iytls umuvont0trtnxf oytoaDeanes s t2um(r3nodole mfvsls  rurxr ou0aeenmieiytlaDrlums;t4aexomfcoydlpDrluvo t)trurxo oodalenlici t)sDua(m ou1opt mfeiytfs uau s u4 ltrif todoatelu slt  eum(m no1lm  miesasfa2taxrooo0teeomi3iaslm um( pnt)trtnxrciy1optrlivi;t trxm(rpoodop emfeias)sDrrx o;o4tltnmfciyslm elnvs;u) rermf iatopDe ueo t s2toio oo1opeelfesat srraxmo;u4ole  f3tytfm eanmo;u4tetnxf3oa1om   i sl(0trtoxopno4amee ivsatfsDtm(r ;o1apxoiieiys aDrlnmo ()trxniociadla eaivslt) 2tmxrpiudapenmncia()aDraxrooo1aptnmoeildla rau snt)arxnif iytoateaieo;() 2um(o3nydame  fvias  Drm(mo;t4tltoifeiysfa ul(vo u)aeenxo iodlptelu i;t0sexr(mpno1ameemfet (faDrm(m ;u4oexo ieilslm ra(vp;u) rtrxrctatoa  livs t) 2toxr no4ol   netlt s2tmxmpoo4teenmfeiydlsDuluvo;(0aeenxrciytomD  uvi;s)s2trir iy1ll elnvilt a2um( pno4tptoii3iytfs rl(vo;()tltrxocoatfaDelneslt) 2xr(o3oudlleelnetat) rrrxmoou0olt mfeiyt aDrlnmsnt4 rxoiociodlaD  ivsl() 2xoio3nu1al   neta(f Duaumoot1altnmiciatls2eln pnu0aleoir iytfmDraues;t0trxm(o iydapt mfcsl(fs2uax pou1openifeiasfsDuln snt4 rtoxr oatfp ean s;s0 eurirpiu4am e nvi ( a2rm(  no4tee  ietad a2rmumon(4altnif iatfmtr ieil(  rum(o3iu4ap  mnctl() 2taxmpnu4oeeniociltfa2umnmo;u) rxomrctadfat  ieo;(0 rum(m3ny4lmtemnciat)arrm( pnu0teto f3ils mDuluvo;(0 leomr totfmDrai i s) etrio oodap nmici t) 2uaxmp;u1opt mociad a2rm(mpn(4texrir3oadfat au i;() exmxo io4lptelnctlt s2urxro;o0ole mieildlaDumuvon(0trxnxr io1om eaieo ()trum(m3iodoltelnesa( sDtrx pnu4tlt iiciltla2uanmpnu) exomrcoadoa  au s;(  2toimpiy1lleemicsat)arrr(  oo4aeto ociasfmDuanvonu4arermrctytoptraneilt)srtm(mpiudale lneils)sDrrxr oo1ape ii3tld s uaump;u0 rtnif3iotfa rluvs;s texrxo3iy1apte nvi (faDtaump;o1aeeniociat a rl(mpnt4tlxnxr iodlpt  uvsl() eurir no1aleemivs (fsrtm(rpou0tpt mfetlsfaDul(vs;(0 ltrxr tatomt  i sl(  2xoxrpnu4lp elics (fsDtrurpnu1texnio3ildfa emu s u0texniocoadoa   uvi t seto(o3ny1amen nvtltf rraur ;u0opeoif3iysfm ulu sn(0trtrir3oadlpt li i (0seur(m3oodlpte nei tf 2rmxmpou1alxoiiciatfm ua(ms;t)altrmr3oodfaDe nvolt texr(m3nydoltelieiatf 2raumooo0oetn ieiatlmDrl(msn(4areoxf oatlmte nes (  rtr(o3nydamt  ivils a2raxmpnu4aee  oeildls2rm(mp;u0 rtomoctadlpD lu ols  2tmxm3nu1aptemict ( arum(m ot4oexnmicilt a raump u)tetnxr3iadfa eluvslt0sexrxr3nu1lmtnmieslt srrmx ono4tlxnmfetatfa2elnvpn()aexrxf iodlp r nei s0 rxrir iy4lleemietl(  2rr(  ;t1opx micias a2em(msnu4 rxoxf3tatlaDe u i;s s2xm(o3ou1am e neta()a2urxmpoo1alxo fetyslsDemu p;()tetoxf to1lpDr i s;()srxoxo3oo1ol nlfcsas s2raxr nt0olx if3tltfsDemu o;t0 rxomf ootla eaueol()s2tr(opno4am   nvtl()srua(  no1ole  ociatfa ulums t)altoifctydla eai ols0texrim3oudom   ici sf rtmumooo4apxnif3tas m rmuvp;(4texoxo to1fpDrln olt0sexrxm3oo4al emicias a2rru  nt0oetoif3tydla2rluvs;t0 lermf iytomDraivi t0sexmxmpiu1aptnmnetls)s2ururpou4apx mfeilslm rlnvs;u0 leoxfciytfmD auvs s t2uoxr3oodol nmiei (fsrta(r ;o0tptnifcild mDrm( onu)aeeoifcoo1la e u o ( texoxo iu1omt mfcsa( s2taum nt0openioctls mDeanms t4 ltrmrcoydlat  ivol()tetmiopno4alee net (f Dtrxrooo0oee  ociaslaDuanvp;u4 rxrmo3oo1fmteau i;t)srtrxm3oydamtn ncta(fa2um(r ou4tlenmoetaslsDrm(vo;t)tlxnxo tydlpDeau i s0s2ur(r nudllte nesls arrru pou1aptomo3tysla2em( s t0trxrxo3oatlm  lnei;( s2umir3nu4lmtn nvilsfs2taxmono1tptn ieiyt s emnmp u0trtrxf3ta1fmtrai slt) ruoxm3iy4omtelnct (  2rmxr no0oeenmfetys mDelump t4trtnxo3oy1fpDranvol( trum(r3iydoptn ivtasfsDtaurooo1tptnmf3iyslaDuluvo;(0alxoxo3totomDeanvslt0 2xm(m3oo1am   fcil(  rtrx pno4tpeoiociasls umump;u4tlxoxfciydop e uvi s)texm(opiu4lm nmfvsasfartmx  oo4texnmieiadfsDulu o;(0altnio oodlm eln i t) 2trxr oy1om elfvslt) rtaxrpou1alxnmieiytfaDea( p;t0 eerir3ta1fp  lu o (0t2xmxr3nu4alt mictls  rtruro;t0opt  octytls2ulu p u4aetnxr3iydfptraivs;t  ruo(r3nydop nmnct t srrrurooo0alto f3iytlsDrlu on(0altoxo3oatfpDraneo;( srtm(r ny1ll  mici t) rtaxmo;t4tpx  o3ilsfsDrmu snu0artomrcoy1lmD  nes ()s2umio ou4ll  mnct t  2tru o;t1oexo fcils m2umnvo;t)trxomrcia1laDrlnvo;s trurxr ou1om elfcil()aDrrumont0optnioctytfa2ua(vsnt0tlermfciadoa   n s;s t2urxo iu1om n nvtl( arrau pou1teen o3iytfaDuluvpnu) etrmr iadoa elu sl(0 eur(o nydapt  nviasfsDua(r oo0alxo o3tysfa eanmp () reomrciodoat li olt0setoio nudom  mneslt  2urx  nu1oex iicias m2elnvon(4 rtoxr iodoa  au ilt0srtr(o iu4ame mnet sfaDra(  oo4tle  f3iydlm um(vpn(4alxrxo3oodlatr u i;s0 rxmim no4amenlicil( srrax poo1opt iociys sDrm( pn(4altoio3iy1lmtrlnei (0truo(o3no4om n fct ( srumurpou0apenifeilsla2eau p;t4 eerxrcoytfpD anvo () rxmxrpiu4lmee fes t artru pot1oltn o3ild a2uanvp;u) exrxf ootopt  uvslt)texm(rpoo4omt livils sDua(m ;t0texo ociasfmDel(vo t4 etomo3iodfm  anvs;( trur(o ou4lpt mnet (fsrrrxro;t4tee mociydfaDrln snt0 rxrmrcta1lm r n s;s)srxm(opoodom nlivil( sDraum ou4olen o3tatfaDrmu s (4arenif iodfpDrau ilt  etoir oo4llt livsa()sDumxr nt1tetn f3tyt s2rmuvp;()arenmr tatlmDr ivilt t2tr(opoydlm  mivsat)srtmxronu0oeen i3iltfaDuln pnt) ltrmr tadoa eluvs;s s2trxm oo4lltnmnesa(fsrrruro;u1tpxnioetldls elnmon(4arxrif iotomtrluvs;( t2umimpno1op e fvilsf Dtaumoou4tlenmi3tldfs2umump u)tleomr3oa1fmte u olt0s2tmxm3oydlle  icia(fartaxr ot4opxoio3iadfaDelnvp u4texnif iatfpD  i s;s0s2xoimpoo4ome mfes s) Drmx ont1apt io3ils m rluvs u0 ltoio3oa1oa rln s;(  exoim oo1ome mfcils  2tr(rpnu0olen i3ias s ranms;t4tlxnmf ta1opDr i slt)trxmxo nydopt  nvi s) rurxmo;u4opxomf3tyt a2uluvo (0 lxnxf3iodfpDeaueol()srxrimpiy4apeelivslt srtaurpot0olxn f3iatfs ua(vonu)trtnio oo1latrli i;() etr(mpnydlmen netl(fsDtau pnu0aet ioctydlsDemuvp;u)aetoxf3iatlaDelu sls) eurimpio4op e fvi s  Drmu pnt4oexn oetldlaDemu p t)texoxf tatlm e ieo;( s2xoxr3nu1alte ivs tfsDurx  ;u0tpx  ociatfa rauvsnt) rxomocoatomDrlivo;t0tetmir3nudlptnlnviltfa2rmum ;t4apx ioctad mDua(mo;()texrmociatfatelnvs;(  etoxr iydllen nvtlt)sDur(r ot0oleomo3tldfaDelnvo;t4treoxo3tadfm elnes;()s2um(o3no1alte nci ( sDrr(mp;u4oet mfciyt s uan o;u4aetrmo3oydlm  lnei (0teum(opnu1ape lieslt aDra(r ;u4tex ioeiys a ea( pnu4arxnio3oadfmDrlnvsls trum(opoo4alt mfei s sDuaumont4aeeomi3tatfaDum(mont)aetoxr totomte nvolt0srtr(r nudole mfvtls) Dtrxrp;o1oeen i3tysls2elnmo;u0trenxo3totfpDe n ol(0teuoir nu1al nmncs s)sDtru  no0aleniocildfa2ran pn(4alxrmo iatom eaieil(  2tr(o nudlm e nctls) Drm(mo;t4oeeniieiytls el(vp;t4trtoiocoydfa rlivi;s0trxoio io1ol emict s aDrru pou0oeenmieilsls rlumsn(4 lxnir3ootfaD ai o ()texoxo iy4am emiet s)srurur ou4aleomociytfs rm( p;t0 leomf totlatr uei s t2urim3nodapt  icsat) 2tmumo;t4tpeo ocild s2ea(vsnu4texrxfcta1laDranei s setoiopiy1ap emiet t) Dra(m nt0oleoiociadfs2ran pnt)tlxrxo iytoaDeai olt0srxm(rpiu1lpt  nesa()sDrrumpnu0ope iicilslsDua(vonu)trxrif iatlmt lues s0setrir3iy1ameemieilt) 2ur(ronu1ape io3tytla2uanvs;()alxoxocoydla eaies ()trxo(o3nodlpe lncsat s2trxmpot1oexoioeiad sDumuvpn(0tltoxfctadoa e uvs (0srurxmpnodap elfvil(f Duaxmpnu4oeeoii3iys s2ea( pnt0 etrmfciodfp  lues;t  etmimpoodamee iesls)artm( p;t4texoifciat a um(mp;t4tltnifctotop rlu ols0s2uoxm io4apenmfci tfa2rru  ;o1apx ifetld aDrm(vo t4 ltomfcootlpD li il() 2to(rpiodop n ivslsf rtmur no0tpen fctldfm ul(mo u4arerxo tydoatean ol(0 etoxr ny1omenmieias) 2tm(ronu1tltnii3iyt m2emu snt0 exnxrctytfpt lieols  eurxrpoo1am nmfvsas arra( poo1oeeo oeiytfmDelumo;u)alxniocoydfpt  u sl(0 rxrio nodal e iviat)s2ra(r oo0alxn feiysls2em( on(0artnir3oytlmD anvilt0s2toirpio4olt mictas)srum(ro;u0oex iieiltls elu p;u4 eenircto1lm rai o ()t2triopoy1om   fvtl(fsDuaump;o1tetnmieiltfs rauvpn()tltrir3oadlaDeaivo;(0 2ur(r3no4alen nesas a2rmx  ;o4apx  iciatlsDra( p ()arxoircoatfpDeaieo s0 rxm(mpiydlm emfvs (  2tru poo4tex mo3iytls2ulnvpnt)tetnxr oo1lpt  neolt  2xo(mpiodlpenmnes s) Drr( oou1aeeoif3tydfa2umu p;u0alerxr tydoptraivsl( truoio3nudlme  nvsa(faDrrxmpno1openmo3ild s2rmuvpnt)teermr oo1om  lieo;( srtoxo3nu1ole miesa(  Drr(m oo1alen oetytfsDua(ms t4 renmrciy1oa eln s;() rxmim3iu1omtn iesat)arur( ont0opt ioeiyd s2umuvsnu4trerxr3totlate uei;t  eur(o3iy4lltnmnvi t) rurxmpnt0aptomi3iltfa uluvs;t)tltnxf3ty1laDeanvi;() exm(m iy4ll  miet t artau oou4oleo o3iat aDelnms;() exoxo oadlm eauvo;s texm(opoodamtnlnvsl()aruaxmpnu1apx ii3iat a ul( snt4trxoif tytfpt aivi t0 ruoxmpoydamtnmncils srumx  oo0oleo feils m2ran p;u4aexrmrcoy1oaDr u o;t0 2tmxr3nudamt mietlt)a2trxro;o0tet mo3iyd m umnvpnu)teerxr3oytfmD aivi t) 2xoimpiydop e fvtas arua(mp;u0texomfciytfa2ua(vo u0tltnmf iy1lm e neo t)s2uoim iudal  lncsltf 2trxm ;u0tle mictatfm ua(mp;u0 eeoir3to1lmtrlu sls0 2xoxm iodlm  mfesat a2ua( o;t0tlxoiieiytlmDua( pnu0alenxf3iodoa  lnvo t)t2xr(m3iu4lpenmfvsat  Dtrumpou4tpxo oetadfa2ul(mp ()altnmf oodopDeluvo;()sexmxmpiodaptnliei sfsDtrx  nu4aptomoetytlsDrl(ms t0alxomf oydlateai i;t)texmio3nu4ll n fciasfartm( pnt0apenmieiytfs2el(msnu0aetoxo3oydop rlu il( trtoxm3oodoltelfvsas)sDua(m ;t1oex moetas s elumon() rerxrciydlpDraiei;(  rxr(r3iydap  mfvtlt s2trxr oo4tpxo ocilt m rln p t4alxomocia1oate n s ( srtoiopoo1opte fcsa()s2rru o;o1teeo ieiysfa2em(mo;(4altrxo3ta1fmtrlnvs s0s2xr(rpoodlmenlieil( s2taxr ;o1alx iociatls emnmo;(4 reoio3oatlp  au i;s0srtr(m3nodop  lneta() 2tau o;u0olx  ieiydlm rlums;u) rtoif totoatranvi () rxo(r oy4open ncia( sDrm( o;u1tlxo fctysfmDulump () exnxr3tadomtrauvs;t)t2trxopnodap nmfvslt)sDuru p;t0tle  ieiatla2rm( p (4aetrif3oy1laD aneolt  2uoxo nodal nlivilt  ruau poo1tex  ietydfmDel(mpnt4 lxoir3iydoat  u sl(  2xoxopio1ap  lnet t srum(  ou0aeeo fciatlm2emuvpnu) eenmrcoodopD lnvi;t0 rxmio no1ape lnciatfa2urumonu4oleoioeiad m emn on(4 rxoxr3oadom r uvi;t) eumim iudlp n ici tfs2ur( poo1apx  ieilslaDulumsnt) rtrxocoa1fmtr uvs;s texrxr3iydlpeemfeia(f 2ur(mp;u4tetoiieiltlsDum(vp;u) rtrxfctotoaDrlieol( truriopoo1omt lnei ( sDumxr ;o4opt mociydfm ul( o u0trtrxr3iodomDelnvolt)srxr(rpoodlmtnmies (  ruaur ;o1olx  ietys a uau p u)teerxr iodfptrau s;s0sruoim3oy4omtnlivt () 2rax oot4opt mfctatls ra( on(4arxnmrciytfat ai i;s  euo(r ou4om emietlsf rur(  ;u4tpx  fetatla2em(mpnt)trxnio3ootfmt lnvils0texm(mpnu1opee feta()aDuax ono0aex mi3iltlm ulu o u)trtomocia1lpDeaieo s t2tmxm oy4lmte nctlt  Durump;o0aet if3iltfa umump;(4 exoxo ta1lmD lueo;()teurim3oodlptnmivsa(fs2rmu  ot1tpx ifciys aDulnvo (0aetnmfcty1laDe nvo t0setoxm iydlmtelics s  rrmx poo1oleomicild s el(mp u)tltoxfciy1lmt anvsls)t2uoxr ou4lpenlfcia() 2tru o;o4tpe mietyd s emu o t4 rerifcia1fmD au ilt0t2umir oy4opeemieta(fsruaxmp;o4opxoio3ilsfa2ra(ms;(4aetoxr3tadlpteln o t0trto(r oy1aptemfvslt srumxrpno0aeeomf3tydfm um( o;(4trtrio3oatfat lnvsls0setrim nu1alte nvsl()arra( pot0oexoifciasfsDrmuvpnt)treoxr iatop rau i;(0 2toim iydlleemnvias sDtr( oou0tlx  o3tadlm rmnmp ()alxomo tatopte nvs;t)teuoim3nu4om nmfctat) rtmx ono0tlxoiiciadfsDum( s u) ltoxr tatomte nvs ()trto(mpoodom nlfvi t srrru o;t0tpenifctatfmDul(mo;() exnif tytoaD luvo;s0texm(o oo1olt  nvs sfsDtm(m ;o0oexomiciysls2emumo;t4 rermocty1fm r uvi;s s2tmxr oy1al n fetas aDraxm ;o4tpeoio3tlsfaDranvp;t) exnmocio1lpte ivsl()t2urio io4om e ivt (f 2umumpno4tlt  feiadfaDel(vsn(0 rxnxfcta1fp e u i t0teumio3io1amenlfeta()aDurumpnu1tpx mo3tad a eauvp;t4aexrxrcio1om  lnvslt sexmxopno4lmt  icslsfsDrrxrpno1oeeniiciyt aDul(vo (4arxomocoytlaDrlu s t) rurxr oydomtnlics t  rta( p;u1tee mfciltls emumpn(0areomo tydoptrlueo t0 etr(m3nudaltnlfeilt  Dtrxmonu4apt mo3ils a2umnvo (4arenmo3iodlpDrlneo () etoio nu1omen neiatfa2tr(root1opxoifciatlsDuau o t)texoio3io1lp   uvil() rxmirpnu4ape mfeia( srrrx  ou4tlxo fctadfm ea(mp;t4aeerio tatfa  ln ils0truoxr iydlptnmnctasf Dumur ;t4olxnifciytla rluvs;u4aleoxr3io1fp e uei s trtrxr3iudlmenmfvi s s2rmumo;o0tlx  ociltlm rl( s;u)tltnmf ta1faDraieilt0 2xmxo nudomt mncs t)a2rmumonu1apeomo3iydla emnvpnt0tetriocoatfmDeau ol(  2xo(o3ou1ol  livi (f Duax  ;o1teeoii3ildfa rmumo (4 etrirciodop  aiei;s  rxr(rpoodope  ncsls) rta( oou1oee iiciydfaDuanmsnu4tetrmr tatfaD liei t) 2uoim ou1apt  fcilsfs2rmx  ot1ape mieiatlm2uanmo t0 ltomo3oytfpte ivol(0t2urio3nu4ameemnvslt)s2uru  nt1oeeomoeiytfs2elumsn(4tltoif oo1oat ln s ( srtr(rpoo4am e ieilt srum(r ;t1oeenio3tltfmDuau o;u)areoxr iydlm  an ols0srtoiopny4op e nesas)s2raxroou4oex iietat m rmn snu4artomr3tytoateli o (0t2xrir3iu1ll elncia( arumu ooo0opeoio3tat a eanmsnt4tlxoir3oy1lp  aneo;s sruoxrpiu1ameelnvs ()arur(  oo1tlx  fctldfaDuanvo;(4arxnircio1latraueilt setoiopoy1lmeemivslt aDtmuro;u1optnii3iadls em(mp;t)tltriociytlpt  iei;()teuoxo3nydolt  ivtat) rtmxrp;u4opt  o3ias m2rau sn()tlxrxo3oadom ran i s)texr(r iu1omt livta() Dtmxrpnu0ape  oeiysls ua( o t0 rxrxfcoo1la r ivs t t2toxm3nodop e nci (fa2urxm no1tetoii3ild a eau o ()aleoxocoa1oa   nvils0teum(rpoo1apee nct s srtmxrpou4texoii3tasla2umu p ()texrio3ta1opt aueils0setoim3ny4omtnmics ()sDumxm ou4oeeo i3tys a2rm( snt0tetoir3tatfa ran i t srxrio nu4ll   ics ( a2rau o;u0oetn ieiasls ea( p;t) lxnir iodfat  ies;s0 2trxo nydlp elfesatfa2rrx pou1optoii3tyt m ua(msnt0 lxomf3to1lm elnei t  2xrirpnu4alte neiatfsDum( ooo4opt  f3ild sDelnvp;(4alenio oytoaDr n ol()t2xr(r3iudapen fcs tf rraur ;o1teeo iciadls2uaumo t0teenmr3ootoat aieo;s  2xo(m3oy1opeelnvsa(faDrmuroou1oee ifeilsla2rmu on()trtomo oadlm eln o;t)srurir3no4apenmfet (fartmxm ;t0ope mo3ild a2rmuvsnu4aleoxf3oytopteanvi (  rurxo3oudopt mictasfsruaxmpot4ale ifeiysls2rm( s;()aleoir3tytfp rli o t) rxrxopnu4ope lieiat sDtaxmono0opeomocias sDrl( on(4tleomf iytlaDrauei;t sexr(opoy1al   fesa( s2uru  ot1apt io3iysfsDrl( s t4arenircoatlpDean o;()sexm(o3oodlm nmfct tfaDta(r no0apx mo3ilsls2elnmp;()trtnmo tytlp rau s;( teumio oy1lpen nvi t srur(r ;o4apxomfetld mDulnvo;u) lerxf iydfmteaiei s0 rxoimpnydolte fcsl( a2tmumo;t4oeeo octys aDumu pn(0aeeoir3oatfmD  ivsl( tetrio ny1amtn fvtasfsDtax pnt0tpenmfcildlmDumn sn() exnxociytlp  lu slt s2uoim iudameemfvi s sDum(r oo4aexo ieiat m2ua( onu0alxoxr iytoatran o;s)s2uoxr3iodole mnetl() ruaxrooo1tpx mo3tytfs rlu on(4trenmoctotom  an olt)trum(r nodol emivils) 2rr(roou4aet  fciytlm ean pn(4 reoxr iy1lm eanvo ()sexmxrpou1ap nlfvtl() 2raurpnu0aeenif3iltlm2eau on(4 eenmociydfm e ivo s s2tmxo ny1lpenmnvtat aDrru pot0optomo3ildfa2raums t4alenxfcio1omD au ol()t2umiopiy4am  mneias)aDur(root1olx  oetlsla2emumon(4 etoxr iatlaDran s;s)s2toir3iu4lltemivtl()srrrx ont4open fctatlaDrm( onu4 rxrxo3io1fm rlneolt0srxoxr oy1lptnmfvs ( a2trxmo;o4teenmi3tls a2um(vp;u4altrmf3iatlmDeaivilt)s2tm(opny1lpee ietlt) Dua( ont4tlt  i3tyt mDulumonu0 eerxo3ta1oa rai il(0t2umim3oy1lm n iei t s2uax pnu4optoiociasls eanvo;(0 eenmf3ta1oa eanei s  2xoxopno4ll  lfciatfs2urur ;u0texo f3iatfaDumn o () eerxrcoodomDe nes;s0tetoxo3nudap   fvs ()aDraxro;o0apenio3tlsfs eluvsn(0alxnmo3oy1lm r ivo ( srum(o3oodap elnct tfs2rmur ;t0teen ietytls2emumonu) eenmrcio1fpD luvs s s2xrim nu4oleemnei ()sDtau  ;u0oleoif3ias a umu o;u)tlxrxo3iy1late uvols) eurxm ou4lm nmnvsa( srtr(r ou4tpxn o3ilt aDrmnvp;t0alerxf tytlateau o t)srtm(opoodop  mfctls)arumumooo1tlxnifetasfmDra(mp u0 rtoifciy1la  an s ( texmxo nu4lpenmnvt t a2trxro;t4alxo fctlt aDum(vp (0 etnirctodfatr u o;s t2xoxopou1lpte nctas)srtrur ot4tetnio3tyd m2ul(von(4 exrxr tatomDr i s ( texm(o3ou1om n nvt sfa2ta(mpnt0alxn f3iatlmDeau on()aetoio3tadop rlueilt0setrxr oo4lptn ieia( aDururp;u4tlx  feildls2um( pnu4 leoif oo1oat  ivil(0 2xmimpoy1aptnlnei s arra(ronu0apxnmocild sDulu o u0 leoxr iatom rlneolt s2tmirpoudamtelfvsltfarta( ono0aexn feiydfs2ra(vs;t)teenxf3ta1lmt lnvils srtoxo3oo4lmtnlfvta( sruru o;o0olxo i3iyt a ean s u4 eeomr3oa1faD ln i;t0t2uoim3no4ope lnct tfaDrrxrooo1olx ioctysls2uan o;(4aeeomf3ta1opDeai i;t  rurimpou4am nlicia(f rurx oou0teto ocils sDea(vo u0alermfctotopDelivs t0teumxo ny4oltelnctas aDua(rpoo1optomfeild mDumuvo;u4altomfcoy1lpt ln o;t teumxopoo1ome  fvia(  2rauro;u4tpe  o3tytfmDran s;()tlxnxo3iodlm eanvils tetriopnodal elnetl(fa2urxm ;o1tlxn i3iyd s2elnvo t)aeenmo oa1faDeli o (0srum(opno4altnlncslsf Drmumo;o0alenmfctld a2emn p;u4aeerif oydomte uvi s) rto(mpiy4op  mnesltf 2tmx o;t1opt  octytls2ulumo t4 rxomfcoydlmt  n o (0texrim3oodomee ncsas)s2trxmo;o4ape  oetytfs eln o u)tleoxocoytfaDe neo;()s2toxr3iudapte fcsat aDumum no0tetnii3tys a2ua( s;u0trxrxf to1lmDrlivo;() 2xoxm3oudopenmiesas  Dtm( oot0tpenio3iad s2uauvs u4trenmr3tydfaDeau ilt srtrxm3oy4lmenlfeil(f rumumoou1tee  o3iasfa ul(von() leoirciadom  lieo;s0 2tr(opiodal n net ( a2trxrpno1texomfcias mDuln o t0tetoxf3oydfa r ueols t2xm(m iodlptn iesls)arrru pnt1tptomoctad a2rm(vo t) exomo3iadoateauvo s)t2xm(rpoo1apeemivilsfa2umum ou1opxnmociadfsDem( s;u4 rtriociadoate neol(  2tm(o oo4lmeemnci sfaDumuroou4aee ii3tad sDrm(mo () reomf3iy1oa   n i ( setmxr3oodape livi s  rumxro;o4oeenmocils m ea(ms;t4 rtrmo3ootopDe u sls) exmirpno4ol  lnct s  Dumx  nt0teto o3tatfm2uaumon()aeermfciytoa raiei;t0trxmir3oudam elnctasfsDrmu  ot4tpeo o3iltfmDum(vs u4arxrmfciadoa ran s s) rxm(mpiudlpee fcta(  Dua( o;o0tlxnmf3iydlsDraumon() rtrmo tydla  ai s;t trtmxm3iu4op  mfcilt)sDum(monu4aee mieiysla uau p;(0 exrxo3oy1lptr u s t0srtm(o3iy4amen icilt s2rrx ono0aetoii3ilt s2emu pnt) rtrxocia1op  anes s0t2xo(mpiydapeemfeta(  Drrxmooo4oet if3tydla2elu s t0aexrifcio1fa  lnvs;s s2uo(o io4ome  netat) 2ur(m no4aex mi3iydls uau p;u0tetriocto1lpDraues;(0 eurimpno1llt  ictat) Draumoot1alx ioeiasfsDuauvsnt)aetoir3todoa   nvo t) rxmim nudame miciat s2urumo;t0oex miciyd m2emnvonu4tltoxfcoadlmte nei;( seurimpoydlp  lfvta(fsDta(mp;u4apxnmi3tldfs emn p;u0artoirciytfpDr ieolt trtrxo3oy4optelietas srua(ro;u1tlx moeiys s uauvon(4aexrxr3oytoate ues;( trtrxm ou1ome licsls  rum( ono1tlt mfetls mDeauvo u)alxrxr ta1fp eauvo;(0 2toxrpio4lltemicsltfarumx pno4tet if3tytlmDemumo t4 rermf tatlmD lieo;(0 exoimpiydomtnmnetas)a2urx o;u0tlxnmo3tlt m ra(ms;t4aeenmfctatlat auvo;s0sexmir3oo1lpt lfci sf 2uaum ;o0texnmicilsla2emnms u)trxoif3oadfa  anvs () rxrxrpoy1aleemncsls) 2ur(rp;u4tetoifcias s2em(vont)aeenxf3oy1fm raueils srxr(r3io4lmtn ivtlt)sDur(rp;o4aet moeildfaDelnvpn(0 lxrmf3ta1lp r nvi t0 etoxr io4ap nmncsasfsDuru o;u1oeenioeiyslmDuanmo;t4altrxf io1laDe n i t)tetr(o3ou1oleemnvsa(farum(r nu0alenif3iad a2rauvs;t)tleoio3oydfmtr uvsl( trtmio iy4alte feiat s2ta( pot0ope  iciltls2um(ms t4 ltoxocia1opteluvs s) 2xr(o3ny1omtn nvsa(fsrtmxmooo0aeenmiciltfs2ran o;u0arenmo3iotom   nvil( trtm(m iudamtemivi ( artr(mp;o4tltomieilsfs2ea(mp u0altnir tadlm  luvi;s t2xm(m no4omen fciat) 2tmx  ;o4tpeomfctltfm ulu onu0 rxnio3oodfmte i ols0 rxr(o3oy4ap nlnesls  Dra(  nt4aexomi3iadfm2ranvs;(0 lxnmf oy1laD  ivs s)trxrxr3nydomtn nvtat sDraum nt0ope  ieiys aDrm( o;t0aeenmociy1fmt au o;t)s2toio ou4olte fes sfa2taxmpoo1olen ieils m ul(mpnu)artoxo oadla rai ol()s2trxm nu4lmenlfesltfsrur(rpnt4oexnmfetlsfmDrl( s;(4 rxnxrctotlptr iei;s) etoio io4ale lfcslsf rr
\ No newline at end of file
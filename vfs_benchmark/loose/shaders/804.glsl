@@ -0,0 +1 @@
+ies t seum(o ou1aleelfcil(fs2uau o;o4opxnmociyt m uauvp;t0texomr tatlp rluvo;(0seumimpio4om emfcias sDtm(  ;u0tpxomfeiytls ea(vs;t) etoxf oy1opDe uei;( srxo(o3iu1lltemicsa( s2rrumono0apt if3ias aDrmnmon()aleriociatla eli o;t)setrir ou1altelfetasfsrra(monu4apxoii3iat sDrauvs t) rtrif3iatlpD au ilt0srurim3nu4aptnmies () 2um(rpoo1oex mfciadfa rl(vo (0teeoxo oodfa e neolt0 rtmxr ou4oltelfcil( sDraum oo4teeoif3iytfm elnvsnu)artoxf todfat lnvolt0trtoxopio1al nlncsat)artm(rp;t4tex ioeils s rmn sn()trtomocoytlaDrlivils0s2xoxopiodomtelnctatf rtmx o;o4tptn ocils m2ranvp;t0aeerxr3io1lmDrli o;()tetoxrpoo4lm n icsa()aDuaxro;u4ape mfeiadlm um(vp (4teenir3oy1lpDr nes s  2xo(o iy1ll nmiet t)aDtau  ;u4olxo fetys m rl( pnu)altnxo iodoatrliei ()srxoimpiy4ame mnetas s2trxm ;u1aexn f3iatfm2ulnvp;(0aetnio ia1oa e ivilt) etmxm3oo1ap elivsls) rumxrpot0ope iociydlaDumuvs;(4 rxnxf io1laDran ils) rxm(rpou1om emncil(  rraxrono0ope mi3tydfaDrlu s;t4trxomfcoytfmDr neil( srtmxo3oudomeemnci t) 2uaurpno1oexnmoctadlsDra(vsnt0 rxnif oadfp e n s;s0srtoxr oo1ll nlfcil(fsrumxr no0tee  o3ils s eauvs;(0trtnif3oadfmtrli ols srum(r3no4amtn ictltfsDuau  ;t4open i3iysls eau s u)tlenxfctytfp   ivs (0s2uoimpoudole lfciasfaruaxrpno0apx mo3iydfm2uanms (4texrio3iatfp eai o;t0seuo(rpnudop emnctat  rrmx oou0alt  fcildlsDel(vs;t) rtrir3tytlm  lneolt) exrio3iy1olt mivtls  Drmumo;o4ale  i3tatlmDemu p (4tlxomf io1opte uvo t0 rur(m oo1alen icsas  2raurpno1tpx  ietyd s2rmnvp;t4altrxfciytfm r u o;( trxo(m3oydam emfet tfa2rrumo;u0apto i3iatfs2uln s;t) etoifcootoatr u s;t0s2umxr oodlm  mncs (fa2tmxr ou4aleo f3iatfa2umu o u4tlerxr oa1faDrlues s s2uriopiy1opte ivsl() Dumx  ot0teeo octldfaDelnvon(0areoio3iodoat ln s;t0s2umim iy4llee fct s a2ur(r ou1opxo i3ildfm2eauvsn(0 etnif3ta1opDe nvsls texmimpnodapte fvsltfaDum(mpoo0teeoiieiad aDrlu o;u4artoxociatfatranvo t)t2urirpio1lpee fciatfarraxm no4tptnioeildlmDuaump;(4aexrif3to1oatr i i;s)t2umxrpnu1lm emivsls)sDtmxmoot1olxoiiciltla em( s t4trxoif ty1oate neolt)trtmirpnudlp emfctas  2raxm ;o1tle ii3ilt m2rln s;u4trtrxf3todfm   n sl(0teuo(rpiy1optn nvtat) 2tmx  ot1optnmf3iltfmDrmuvp u4 eeomr3tatla r nes t0teur(rpio1lp nlfvt s)a2taxrp;t4alxn i3iydfsDeanvo;t4 exoxf3oydopD lu i;(0 exrim oo4ope miei t)s2taxm ;u0olenifetlsls eanvo (0 lxnio iy1omDrluvo t  etm(m3iodalenmict (  rrm( onu1tex  o3tltfa2emnvo;t) lxrif totlmDranei s0 etm(r3no1olenmnvilt)srrmurono4apenmfeiys aDuanmo () rtomf3ootom   ivo t)srxmio3ny1lm elncsa()srumuroou1apxoioetlt sDelnms (0artoxrciatoaDeaies t srtoxm3ou1optn ivs (  2umumo;t4open iciyt m uan s (4tleoircio1fmD  n olt s2ur(m3oydop nmncslsf 2umu pno4opt ioetas a ea(mp;(0aeenxfctodoa elu o;t  rur(r3oy4am elfviatfaDrrxrpno1tlenmfctatlm ran s t0alxoircoy1fm  an i s  exoir oy1lpee fvtl( arrru  no4olx if3iys a rm(ms (4aexrmrcto1fat  i i t)texoir oo1optemivsa()s2uru pnt1tltoioetysfsDelnmonu4texrmrctodomtranvs (  rtrxopoodam n fvias)srtru  ;t1opeo fetldla emnmp (4aleomfcta1lm rau slt trxmio3ou4lpte fvsasf rumum nu4tpxnmociatfa2uau p t0 lxrmr3oadfp  an s;t) 2xr(mpiudope  fetatfsDrru pot4opt moetlt a2umumsnt4aexrmf tadfm ran i;(0s2toio nu4openlfvi (fsrtm(rpno4oet mietldfa rauvo (0 ltnxfcoa1fptr n i (0teuo(r ou1lltn nvsl() 2uax pou4tlt if3iasla ea( pnu) ltnxo ootlpD aivs;t) 2ur(r oudam  mfci s srur(mpoo4tle  feilsfa2raums;t4aexoio ia1fmDrlnvi;(0trur(opiy4amenmiviltfa2rmumpnt1apx  fetysla2ea( o t0trerxf oy1oateai sl(0teurir3nu1lpe  nci tf 2rmx  ;o4teenmfeilslmDuan pn(0altnxr3oy1fmt aivslt0srxrxo3io4am nlnetl()srraurpot4teenmictyd a ua(mpnu0alxrmf tydfatr uvs t srxo(o no1ape mfet s  2trxrpou4oetomi3tydfaDumuvp u4 renmf3iadfp eln s t  rur(opio1apee fvtlt  rur(rpno4tleomi3iytlm2em(mo;() reomo3ty1laDrlieolt) 2tmir3iy1ome lieils  2rrxr oo1oeen f3iys mDuln pn(4trtoxfcoy1fat li ol() etrimpno4lmte feia( sDua(mo;t0tee  oetas s rl(mon() exnir ta1lp  lnvs;s)trxoxr3iy1ameemfcils)srtaxmono1aetnioeilslaDelums t)areoifciadomtr u ilt0seuo(rpiy4aptnmivil( aDtauroot1alto o3iatfsDua(vs;u)alenmo3tytfaDelnes;s0s2urxmpoo1lme  ivtlt aDumuroou4opxn feiys mDrln o;t) ltrmrcio1oa ranes;t  etrio iudlmt  nvsat) 2uaurp;o4tlxn fciyd aDumuvo t4aetoxfcta1fptraiei;s0seurxr ou4omtelies t s2ta(moou4olto oeils aDemnvp;()tlermo3iotlatraueo;t) rtmio iu1olt  ics t)a2rmxr ;o0tptniicild sDran s t)tltnmf iodlmDr uesl() ruoxr3nu4lp emnesasf 2rr(m ;o4aetnifetyd m elnvo;(0 rtnxf io1fptelivs t) eurxmpoo1om n neia( a2rmx pou4ape  ieilsfs ulumo (0aexnmrciatlm e ivs;(0trxoxo nu4alenlfvs t)s2tau pno1optnio3tld s2ranmo u)tlxrif tydfmtrluvi (0 exrirpoy1olee nesl(  2ur(rp;t4tptomfeiytfaDum( o;u0tetoxfcto1oaD  ivsls  rum(o3nu1lp emfvtl(  rtm( onu1ole mictydfs2uau snu) ltrmrcootoa  anvil(0t2umxo ny1op  mnvil()aDuax o;t4olxn ieiaslaDumuvp u)trtnxr ta1fptelnei;t)s2trirpnodlmt mict t) Dtaxm ;o4teeoioetatfaDeanvsnu) etomf iy1om e u ol(  eurir3nu4omt mfcil(faruaxmoou0opt moeiadls2elnvsnt4 eenir tatopte ieo t0 2xr(o3ny1alee nvsas srrr(roou1olxnii3tldlm eaums t4 lxrif3totlmDr uvil()srtoxm oydale liviltfs2ur( poo0tpeo o3ilslmDulumpn(4 lxoxr oy1oa ean ils0trur(opny1op n fvsa(f Dtmu  nu1aet  iciysfa ulumo t0 rtnxf3oydomDe ieo;(0t2toiopno4om emfctatfarum( pou0ole ifetytlm2umnvs u0artrxr iytfatraueil( teuo(mpnodlmt mfcs ( a2taxrp;t0aet  fciltfs ea(mo u4 etriocty1op  ai o () ruoxrpiy4lmtnlnesl( arrau  nt0ale io3iydlaDemnms u0aeenmo ia1lmt aneils) exm(o3oo4amen ivsas  rum(  ;t4oet moeiaslsDul(vp u0teermfcoadopD li o;t)sexrimpou1lptelivtls)a2tmurooo4olx miciytfmDul(vsn(4 lxrmrciydlaDr i s;() 2uo(rpoy4amenlieta( sDtmxr ;t1optnio3tyd s rmn o t4arxoif iotomt au i ()t2xo(o3iudam emivtasfa2ra( pno0tlenmoeilslsDea(ms (0trxoxocoadfaD livi;( s2uoxmpno1ll nlivtl()s2rau ooo0alt ifctad aDuau s;u0aexomo ootom rlu i;t setmimpoydlmtnlnctat)a2taxrpnu0ole mfetyt m2emnmo;(4 rtoioctatlpt  ivi (  2xoir iy1omte icsa(f Dumxmoot1tpeo o3ias aDel(vpn()tltriocootfm  ai s;s0t2umxrpno1optnlfcs sf 2ra(m ;o4opt mi3iydla2rl(vont4 rxrxfcootlat auei s t2umio nudapt mfes t) Dtmxr ;t4opeoio3iaslm uluvo t) exnxociydlat  n il(0 rtrio nydom  lnvslt  Dtm(mono0oeen ocilsfm ulnvonu4trtnmr3tatfa elnes s0sruoxo3iodlmtemfesl(  rra(ronu1tlt  ocildfa2umu p;t0texoif3tatlmD lieo;()trurirpnudamtemfct t srraumooo1olxo ieilslaDuan o;()artnxr tydlpt  i ils0 2xo(o3iu1am elnvia(f 2rmx  nt0ole mfetysfsDea(von() rxrmf3oytfmt lnvs t0 etoxopoo1ope micia(fsrum( onu1optnmf3iadfmDul( s;(0teeomfciotfa eln s t s2tmir3oo1lmt  ivilt sDtmxr ;o1alt io3tasla emuvpn()aleomr3tytfm  auvo s) eum(rpoo4apee ieiasf ruru  ;t4oltomiciydfsDemums;(0aleoir oa1la  luesls sexrir3nudale  net s a2taxront0altnio3tas m2ul(vo u0trxnxf iotfaD lnvilt)srxoxopoodol nlieiatfaDum(mo;u1oexoiicildla ranmo u4aeerxrcto1fm  auvil(  2tmxrpnu1ol   fctas  2tr(mp;t0tlxnmoeils a2ua(vo;t4 leomr totopD luvslt)texoir3no4olt lneslt aDumumo;t0tltomiciys s rluvpn(4 etrxo ootfpD  nes;()s2umxo oydam  lnvt ( a2umxronu0oex mo3tas a ulumsn(0tetnif tatom elivs;t s2toim iudol n nci t  2uaumoou0apto iciysfm eau snt0arenirciotop rlu s;t0 2tr(m3nudome mfcs s)aDrr( onu1ape mf3iatls2ra(vo;(0aexoif3ty1latrai o s0 2umir nydam elnet s aDumx pnt1apt if3iltlmDra(vo;u0aeeomr oydomD  u o s  2toir3iy4altemncsls) 2urxr nt4teeomi3ilt aDeanmo u4aexrifctadlmDrai i;t  rtoxm iudlmenlfvils) 2ua( o;t4apxn fetaslm2rm(msn() reoxo3ty1op eaues;s)seumimpnu1al emnes ()artmurp;o0tet  oeilsfa2uanvonu4tetoxo3to1oa  livsls) etoimpoudom nlicslt)srtrx  ot1aptoioeiyd m emnvo u)tltrxf ty1opDeanvi s) exr(m3oy1alenlnesat)arurx p;u1apeomfeildlmDulu o t)alxoir iy1om   u i (0t2urxmpiy1ll   neilsf 2rmumpnt0optnmf3iatlm2eaumo;u)tleoif iotfaDrai ols)s2xrim3ny4omte iesatfa2urumooo4aleomociysfaDuluvp u)arxoxr3iy1opte uei s srtoxopno4lm  mncias  2umuront0tlenioeiytfm2ul( p;u0 ltrio3ty1om  aivsls)srxmim3nodomtnmfvi tfa2uaurpno4tltoif3iasla2ea(vp t4tetnxr ia1lpDr uvo s s2xr(mpoo1lme mfcilt  rum(mp;u1tex  feiatfs2um(mp;t0 leoxfctadlp rai i (  rxoxo oudlptelfctas s2rr(r no4aeen f3iytfm2rln o;u0arxnir3ia1lmt an s (0 rurxr3oo4omtemnvt tfarraxmpot0olx ioctadfs rlums;u) lxrmfciadlaD ai il( tetr(opno1optemiviatfa2tmx p;o4aet mi3tls sDeau snt4tlxrmrctotop rlu s;s0tetm(r3oodom  lictltfs2tmu p;o4apt  oeilt mDemn s;u4 etnircoy1lp rluvo;t t2umxopio1apen fcslt)srtaxmpou4aeeoifeild s2em( pn(0altnmociotfaD luvo;s  rxmxo iu1oltelfcsls) rtax pou4tpxomo3tyd m2rluvpnt4arenxf3iodlmtelneil()teuoim3oo4omenlfesa(f 2ua( o;o1tleoif3tytfm rlumo (0trtrmo3tadopt lueils s2uoim nu1lltnmfvt ( sDrru p;u4tetoii3iatlm2rm(vs;u) ltrmrcootla rln s t)seuoxr3oydapte iei s a2rrx p;t4tltn ocildla eauvsnt0trxrio3tadfmDe nei;()sruo(m iu4olt mfcs t  rrrumonu0oexo i3iys m2ua(ms;(4 etnmrcia1lpteai s;s)tetoim3iu1lpte nctatfarrr(rpou4opt  fciydlmDemnms;t) lxnmr oo1la  auvo;(0srtoim iydol elici s artr(rono1alenioctytlm2rau ont0 rtoxo3oy1fmDranei ( texo(opnudapenlfvi ()s2ta(  no4oex ii3iysfs el(mpnt0 rxoir totlmtrlueilt)tetm(o io1alt mfctasfsDtrxm nu0oeeniictydfaDum(mon(4areoir3tatfatrlnes;t)teuoxo3oy4open ivilt srtrx poo0alxnmf3iadlaDra(msnu0aexomf iatla  lu sls0 rtoio iy1lpen ivi s) rtm( o;t1optoiociytlaDel(mo (4 rtrmrcoodfaDr u i;s0t2to(r3iu4op elnviasfsDtmu poo1apxnmieiys aDel(vs u)tetnmfciotlatr n o ()srxmio3iydapee fesls) 2ur( oou1aee  fcildlm em(ms t)altomf3oytlm rluei s0tetoxm3nu4apeelnei t aDraum ou0aeenifcilsfmDeauvp;() eenxo oodopDranei t  euoxr nodopenmnctl(fa2ua( ont4teto oeildls2rm( o;()tlenmo oodlaDrlnvo (0 2xm(o3iydlpt  iei (f Dtrum ou1tlto oeiyslm rmuvpn(0tleoioctydlptr i s ( s2trxo3ny4ll nmnvs s) 2rrum ;t4oex  fcildlm2ulnvpnt)aetrio iy1oa  lnvo s)teurxo3iy4am emici t aruau oot0tlxoifciltfm elnvs (0 rtoxr3oatopD  nvolt0trtrxm io4ale mfcia(  2uaxm nt4aeenif3iytfmDuluvp;u4 etomo iydlp rlnvols) euo(m oudlmt lfci ( a2tmumont4apxoioetyt m ulums;()arxrir tytoatrauvi;t)srum(o iu4oleemieiat a2umum nu1tlxoiiciyslsDeanvp;(0tetnxr tydfpte ies t0 2xrxr oy1omtnlnes ( aDtmxmoou1aleomieilsfm2rluvont) rtnir iodop eaiei;s)teur(opnu1llt mfct t aDumx o;o4tltn ociysla2ul(vs (0aetoir oatfmDr nvo;t) exmiopoydaleelies t)s2rr(mo;t1teeo ictld aDelump;t4texrxr3iotfmD luvs (0trto(o oo4al   fcslsfa2ra(m ;t1tetn ociyt m umnmo;t4aetrifciodomt  nvi;s) 2uoim3iy1ol elnetasf Drrxr nu4opt mf3ils m ua( s t)trtoir to1omDranvils texoxr3nu1optelici (  rrrx pot1apeoioeiyt mDum( o;(0 leoxociy1fmt  nvslt  2xrxmpio4opte nvsl(f Duaur ot1teeoio3tyslmDumu snu0artnmr iatfaD anesl(  rtm(rpiodopee fct s)arum(rpnu0tpeoio3iasfaDrlu s u0arxrmf oytlaDe n olt)sexrir oydlmte nes (  Dtru o;o4aleomfciadfa2ua(ms ()tlenif3io1fatran slt)s2trim3nu4oleemivtlsfsrumumo;o4oetoii3ild aDum( s u)tltomf io1opD  ivo ()trtmimpiydomt mivs ( s2umurpno0alto fciaslm2ul( o u)aexnmr3tatfate i o;()t2toio ou1olen ietl() 2rmump;t4tpxo i3iysfaDranms t) rxrxfctatlaD ai s s trum(o3iy4oleemfcsatfs2umurpoo4alx  i3tys s2eauvp;()tltoxf oo1omDelnvs;s) ruoxmpoudlpe lnet sfs2tmxr ;t1oet  ociytls2eaumo;u0 rxnxf3iatopDeaieo;s0trxrio iodaleemfci s)artrumono0aee mo3iad m2rmn s u) lxnxf iotopt aneo (  2toimpoo1op eliei t sDurxmo;u1tpe  i3iydla2elnvs;u0 lxrmf3iodfmteai s;() eum(mpno4apeelncias sDra(mo;t1apeo fciytls eluvpnu0alxnircoy1fpDeaivo t)t2trxm oudamenmies s)aDur(rpot0tlx mfeiat mDuln s;u4altrmr3to1oaD lueo () ruoxopnydopt  nvs tfsDumxmpoo1tlen f3iyt mDemn p;u4trermfcoadopD  nvo s0 2xmir3nodap  licsls a2tr(mo;o1teeoif3iatlm ea(mo t4 lxrir3ia1fpDeliei;s tetrirpny4amtemfet ()sDraxr nu4ale iictls a2rmnvsnt)alerio iy1lp r ivo ()s2xrxmpnu4omtemnviat a2ra( oou0tle ifeiydls2ranvpnu4trxnxfcoodop   ivils)s2trir3no4op nlivtltf rumumpno4optn ocildla ran p;u)arxrmf3ta1oat  i s;(  exm(opio4optn fei t srur(m nu4oltomi3ildlm2eaumo t)alxomr to1lmt ln ils0tetmxo oo4om  lfvilsf rrrxmpnt1oexnio3iydla uanvon()arxomocoo1fpt lues;( seumirpnudlleemfcsat)arraurpno0tpxomietyd s2rl(mo ()trtomr3totlaDrlivs s) rurimpiu4apeelncil()a2tmx  oo4aptn oeiatlmDrl(msn()tltnxo3io1oat lneo s sexr(r3nudame mfvsat)sDtr(  no1tpxoio3iyd m2ulnvo;(4tetoiociatlp   u ols srtmxo iu1op nlnetatf rtaxroot1opeoif3tatfs rauvo;u) exoxr iodlmtrlues;s  2umio oudape lfeta() Drm(mo;t4apenif3tatlsDraumsn() eenir3oadoaDr uvi (  eto(r3iudoltemnetat)s2ua(r ot1tlen ictatlm2rmu o;u)teeomr3oodlaD  ivo;s  eur(m3no1lm n feiasf rtrxmpou0tlt ifctlsla em( s;() lxoirciatfptr nvs;s) 2uoim ny4al  lfci (fsrtmump;t1oexomi3iyslmDemu o t0aexrxocoytomt ai o ()srur(m3iy1apte ivs tfaDtmxrp;o4olto ocilslaDea(vp (4 lxriocoodopDrln slt t2uoxopio1omtemnvi sf rrru  ot4tetniieiltls2em( o (4tetrxfcoytfm rlneo s seto(r iudap n ncta( s2ur(m ;o0ole ii3ilsfs2ul( p;u4areomr3tatla rau ilt s2xmirpiudoptn ivil() rumur nt0alxnmo3tydfs emnvo t4arxnmrctytoat luvilt0seuriopoodlmee fvslsf 2rmxront1aeto iciys a rau pnt4aetomo oadlat  nvols t2xoxm3oy4amenlnvi s s2ra(moot4tlxo i3tytlm ua( onu)tlerio totfmtelneilt) rxo(m3nodomee nvslt)s2trxmont0tpenio3ilt sDrmuvo u)texrmo3oatoat  nvil() rxmxm3nodom  lfvilt)s2uaumono1tlt moeiltlaDemnvs;t4tetnmfciotlatranes s0s2tr(r ou4ap e ncil( s2uax  ;t4olx mieiasfm rau onu0arxrxr3io1fat auvo;(0 eur(rpno1lmtnmfviat srrrxmpot4olxnifeiys a emump;(0alxomfcootoa   ueo;t  rxr(opny1ll elfeslt) rumxm nu0opeo ociatfa2emnms;u)alenxo3todop r nei;t0t2umxm ny1am n nvils s2rrx  ;t1oltnmicilsfsDrln o;(4 exrxo3oatomtrli o;s)tetoxr oydopt  neil( aDrru pou1olxoif3tldfa2el( p;(0aexrio3ia1oaDelnvi;s s2xmxmpoydlmt lnei s) 2rrumoot1opx ifeiytfm2rl(msnt4altoir iy1oaD ln o s0teumim oydopt lnct s)s2rax p;o0oltnmf3tys s2emu s;u0aexnircty1oa eli o ()t2uo(m nu4ameemfct (fa2rm( pot4aeto f3tadfa2rmnmsnu)tetoxocta1opDelivo;s sexo(rpny4omeelivi sf rumxrpoo1apeomociad a2rm( s t) etnxrciodfp ran sls0s2trxr oo4ll n ies ()s2raumpou4alx moetasfm2rl( s;u4alerxr3ootfp  anes t0 exoir3nydlm nlnvsltfa2ta(root0tltniicildls2rm(vsn(0 etoxf3oa1laDr uvo ( s2uo(o3ny4al elfesa()srua(r ot0apen fctydfm2ulu o (0teermrcoy1opDrlieo;() rur(m iy4lleelict t srrrurp;o1aetn ieiatlm ulumon(4tlermf todoateanvo t)trtoxr3io4om n ictasfsDtmu p;u0oltoioeilsla2em(von(0trxnmo iydfmt an o;(  2xrxm nydlptn iesl()aDrmuront0apt iicilslm2rl( ont4aeerio3iy1omDe n o;t0 eur(opny4lptn ncsl(
\ No newline at end of file
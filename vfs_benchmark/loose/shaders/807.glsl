@@ -0,0 +1 @@
+nvsls  eum(r oo4lmeelnvia(fsDtmumo;o0oleoifetltla2uln p (0altrmrcoo1faD anvs ( t2uriopnudole  ivilt)aruaxro;t0aet iociyd m el(msn() ltoif3iotfmDelneo t0sexmxo3io4lmt  iesls) Dtaumont4oltoiiciasfs2rm( s t) lxnmf iadfaD  uvo;(0tetm(m3iy4alt lnetatf rtmurp;t0tpen octldla ua( s;(0altnxociadla  anvilt)s2ur(opiy4ll  lnvsat)sDumum nt1tee iiciltfs emumo u0 ltrxf iytfp  aieo ( trxrim iu4lpeemfcs tfa2rr(  oo0olt io3iatlm rm( o u4 etomo oy1lmDrln s () 2xoxo3iy4amt  fesls)a2urx o;u0texoioeiltlm2um(msnu) lxomocta1laDe uvol(0 2uoiopoo1omtelnetlt) rumxr ;u1aeeoiocild m2eanmo u)tltnircoytomD anvi t0sruoio nodop  mnvil(f 2rauronu1tltnifeild aDrl( snt4 lenif3ootfa r ueilt)texmiopou4ale lneslt aDrr(  ou4alenio3iasfmDem(mp u4texoio oatfateanvi () 2tm(o3iodoleemivi () rrr(rpoo1tpx iocildfs rln s t)tlxrxr todlmDe n s ( t2xo(r3iodolenlivsls  2ta(r ;o0opxoif3iadfa eaumsn(0aleoxf3oytlmteluvilt  rurxrpiu4alt lfei ()srrmurpno0tpx ioetydlsDran p;t) eeoxo3oydfat  ivi;t0srxm(m3nu4ap   nvslt)s2tau pnu1oeeniietysfm ulu s () etoirctytfatranvils0 etrxopoo4amt  ietatfa2raxmpot0tlx ifetydlm uluvpn(0tetrioctadoa eaieil(0 2uo(o iu4alt mfvsa(fa2tmxmpoo4aex miciyt m2rmumo;u)tlxomf3iatlateaiei t)seur(r oo1am   icsa(  Draxrp;u0apt  ocils a ulumo t) etrmociydoatranes;s)trxm(rpio1alt  fvta() 2tru ono4tltnif3iltfs umnvsnu0aexnirciodfmtrai o t)trxo(mpiu1llenmncil()aDua(ro;u1aptomfcils s uln p;u4trtrir oadlm r i s (0 exm(o3ou1omtn ietls)a2raur ;u0tetn i3iatfa2emnvs;t)artoir iodoat lnvi;t)s2trir oy4optelncsa(  ruaxm ou4olt iicilt sDea( o u) eenxfcootlm eanvils0t2xoimpio4apt  ivsl(fs2tr(mooo0oexn f3tyt s2ua( o;(0areoxf tydlmDe ueils0t2xm(m oydom  mivsa(  2uru p;u4aetnii3iysfs2ulumont4 leoxrciatfm  li ols  rurxr3iu1opt lfet s)aDta( oou0aptnifetltls rauvo;(0trxoio3oytoatrai il(0t2umxm nudomtn iviltfa2ta(r ;u4apenmfeiadfm2ranvp;t0alenif iotlp eai s (0 eur(opny1om  lnvsl( a2umxmo;u0tltn ietls mDemnmo (4trtrxr oytfa r nes (  etrxr iodll n nvtl(faDtmxm no0tleniicilsfm ea(vs u0altoifcoy1lpDrln ols)t2toxr3nydlm  mfvslt)sDtmump;t4olenmieilsfmDum(vs;(4 rxoxfcoadopD  ueo s0texmim3ou1lm elnvt t arur(mooo1open ieiytlm2rmuvp;t4 renmo oydlp  aivilt0truoio oydole  nei ( arumxmooo0alxnmfetldls2ran s;u0aexomr iy1opt ai o s0s2to(m oodapen nes () Drr(rooo1apt  ictas aDranmonu)aleoxr oa1opD lues t)t2umirpio4olee ictas artrxm ;u4tpt moctlsla rm( sn(0tlerxr oodlpDeanvols srtrxr oudoptemict () 2umuroou4tee mo3tatlaDuau s t0trtrmf iodomDe n sls0 2toxr3oo4lmt lnvsls)a2trurpno1tlxn oetydfa ul(mo;(4 exrmo3iy1la e n ilt)trtrir3oo4opee ncslsf rumx o;o1apen ieilt sDea(ms t)areoxo3io1fmDrauvsl(0srxoir3io4altelfcs t) Dtmx pou1tlenmfciltfm umnmo;t) rxnirctotlmtrai i ( srxo(mpnodlltn ncs t arururo;t0opt iiciydlsDeaump;t0tlerxrcto1omD  uvi (  etm(r3ny4lltnlivs ()aDtrum ;t1tleomfetasfsDraumpnu)arerifciadomtelueo ( seurxm3ny4lmtelnei s)s2tr( ooo4alenio3iasla2rmnvonu4 lxnircio1om eaiesl()teum(m iu4llte fcs s  Dra(rp;t0oleoiictadfa elnmp;t4arerirciatfpte u o ()s2um(r oodom elfcilt s2tmu  no1oleomfciytlm ranvo;t0 lxrifciotfmteluvo ()srurir iu1lpt  neta()aDrau  ot0tpen iciysls2uanvo;u0 exomo3ia1fpD an s t0s2tmim3nu1lptnmicsltf rua( poo1tlenmi3tydla emn p ()aetomf io1oatr nvilt t2urxo3iodllt lies sfsDra( p;u0opx  iciytls2eauvp;(0artomo3iydfm elivolt)s2um(opou4altnlicsl()aDrau o;o1aleo i3iadfaDemnmsn(4artnmfciy1opDrlneilt)texrxr3ou1lmtnmfvslsf rtmur ou1opxn fetld mDea(mo t)tltoirctadoaDelnvol(0 eurxm no1amt liet s  2trxm no0tltomi3iat mDum(mon()tetomfcoytfm elu ols)t2urxo3oy4lltelics ( arrmur nt4aeeoioeiytfsDrmnmp (0alenif tadfaD livi t)srxmxopnydomen ies tf Dtrx  oo1teeo iciadlaDra( pnu0 rtrif3tatfaD ln ilt) 2xm(m3oo4llt  nvil( s2rm(moot0oltnmfciyt aDem(ms t0treriocty1opt  ueilt)srum(rpiu1ap n icsls  2urxmo;t0oee mfctat s2el( s u4alxoxr iytlmDe u i t0teumxm3ny4ome mivta(fa2rr(rp;t4apenio3iys sDrmnms u0tlenxf3iytoa   u il(0setr(m3oudlpen ncil( arrmx p;o0altnioetaslm2rlnmo;t4 leoxf3oydfp r i il( srtrxrpou4lm nmictls)srta(  nu4tlxoiietyd m rm(ms u4tlxrif3to1fptelieol(  rtrim3iu1op n iei (f ruaxm no4tlxniieiltfsDem(monu) lxnmf3iatfateliesl() etoxrpnudapenmfvsl()srum(rono0apxnmoetld m2ua( p;t4teeoxo ta1op   n s s trtmim3nudoptnlivsl()sruau  oo4openif3iadlm2eaumo (4treomf todfp r n ol(0t2xo(o3io4ome mncslsf Drrx  ot4alenif3ildfaDuln p t0trtnif ta1oa elivilt  2xoir oo1apeemfctas) rtaxr nt0aeenif3ilsfaDumuvsn(4aeerir3todoate ueo;s trxr(rpou4ap elfesa(fsrra( ont0aetoiietls a rm(ms;u0 ltoxf oadfm e ivsl(0s2urxo3oudal n nvtl( s2raxro;o1tpxnmicildla2ea(monu4 rerxr3ta1opteanvilt0 rtmxrpiu4amtemfcsls  2rmum oo1optoii3iyd m2emn sn(4altomrcoy1fp r nvsl() rtmxrpiydapenmfetat  ruaumpnu4alt io3tas sDranvo ()texrirciadomD  i o t)srum(opnu4lltn feias a2trxm oo4oeto o3iadlm2ulnvp;u4trtrirctydomDrlnei;(  etoio3iy1omt mnvs tf 2trx  ot1apxoif3ias sDelu s;() lermr3tatlaDraues;s  rxm(o3io4amee ncsas s2taurpoo4ale if3iyt mDem(ms;t) rerir oo1fa  an s;s trxr(m ny4olenlnesat  rtax p;u0ole mi3iydfa ra( ont0aetomociadfaDeanesls0srtoxm nu1al elfvias) ruaxm nu4tpe  f3iadfa2rlnvpnu0tltrmociadfmD li i s seum(opnydal  micia()sDrr(rpnu1aptn ociys m rmnmp;t0 rxrxf tadfptrlnvi;s  rum(r3oydam elivilsf rrm( pou4olto ociltfa emnmsnt0artnmrciytfm elnvs s) 2xmirpoy4ape micsas) Drm(moot4tpeo ieiytlsDea(mpnu0arerxo ootfpDe u o;t  exoxr iy4olenlnctls) Dtmu onu0altnifeils mDuanmo;t4 ltnircoodlm eauei;s)s2xo(m3iu1ap n nvt s)s2ra(rpoo0aet iicildlsDem( onu0arxrmr oa1fptrau s;t0 rtoir ny1amenlfci (  Dtmxmpnt0alen o3iytfaDel(mpnt)aetrifctadomtranes t0 rtrxo ny4aleemnetl( aDrm(mp;t4oetnmf3tys sDrmnmpnu0 ltrif3iodop rlnes;t trxm(m3ny1omenlnvt sfarrrur ot1alxomi3tydfa2ea(vo (0tltoxo3oadomte i s;( seumxrpno4lm  livils aDta( pou1tex  iciysfa2elu p (4areoifcoa1laD li ils srtrir iudaleeliet t  Drmxmpoo1oex  ictyt a rm( s t) rxrmfctatfm r ies;(0seumir3no1om   nvtl(fsrum(rp;u4tpt io3tldls2rlnmpnu0teerif oytopt  uvi t)teuo(o3iu4ap elnvs tf 2tmxm ;u0tleomfetad m2ulumo u)alxoxf3iy1fmDranes;t trumio3nu4optelnvt s  rurumpno4olxnmoeiat mDrlumon(4aetoxfcto1fpt aies;t0seum(o3oydole mnctltfartm(r ;o4tpx  fciysfsDem(mp;t)treomr tatlatr iei s srumxrpou1om elfeil(faDrm(m ;t4alt  fciytfaDem(vo;t0teeoxr ty1fpD lnvil() exoxr3iu4lpen ivt () 2rrx pou0oeto i3iytlaDel(vo t4 rxnxo iodla   u i;t  exmio3ou1llt mfct () 2rau  ot1aexoio3iat m2rlnvon(0altrifciytfmteauvs;s)setr(r3ou4lme lfet t)srumxr nt0teeomociatla2ulumonu)aeenmr oydfa   neo;t)tetrxr3io4om e nesas)a2umxmono4aleomociadla elu o u4 rtnmo3todoa eli o (0 etrir iy4om nlfvt (fs2rmxrpno1alt ii3tyt aDranmo u) eeoif tydlm  lneo;t0srxrxopnydllte ivs sf Dtr(mo;o4aeeomfctlsfaDrln p;t)teenxrcootlmt  i ilt truoxo ny4op emicsat  2tr(rpno0texo f3ils a2ul(msnt4tltrir iotoaD  iei;t0 2trxm3ny4ape lfcta() 2ur(mpno4tetomiciadla2uauvo;(4arermf ta1laDean o () eumxo3iu4lpt mnvtl(f 2rax  oo1alen o3iad a um(von() exrmf iy1oaDeaneols)t2umxm oo4lm  licilsfsDtmurpou1tptoiiciltfs2eln snt0alenif3ta1oatrauvol(  2xmirpoy1omee ics s)sDrrx  oo0aleo o3ils m2rauvpnt0 rxomo iotfa  lueolt0t2xmimpoy1lmt livsasf 2umxrono1altnif3iasfsDrl( o t)tetrxocia1fa raneo;t0trurxmpoydom emfci s) Dtaxrp;o4tlto o3tat a2uauvsnu)aetnir oatlpteauesls) eurxr3oydame lietas) Dtmur ot4apxo fcildfmDra(vp u) lxrio ootfa  luvsl( seumxrpno1lpenmfcta( a2umxmono4tetomoeiytfaDuan snt4 etomr totomD ai o;s s2trxopnu1ll  lict s  2uru pnt4olenmictls s rmumsn(4 rtnif oa1lateanvsl( srtm(o oodamte nvtas artr(ro;t0tle if3iysfmDranvo;(0altnxociatoa  lu ols tetriopoo4opte ieta()sDur( pot1apeniieiatfa2rl(vp u0 eermrcoytfmD  uei (0t2ur(opno4lme mnvsl( srtr(  ;u4tptnifeiadfs2um(vp t0teeomf oatoaDeln ols0s2toxr oodamtnlfei ( a2tm(m ou0texomiciysfm em(vo;t4aeenmf to1lpDr i ils)s2tr(opoydale mnesa()s2taxmono1oetoioeiatls el(mpn(4texrxr3iotfmt  iei;s0 etoxm3iu1lme  ici s) rum(ro;t0oetnmo3iatlm um(mpnt0aexnxo oodop r n sls0s2tmir3iydlltnlict t  rtru pot0tleomfctldls uauvon(4arxrmr3todop  luvi (0 2uo(m nu4alee nctls s2tmxr ou1olxo f3iyslmDraums;() ltnmr tydoaDelnes s  rtoiopoo1olenlici sfaDuaurono0tlxoiieild mDrln p;(0alxrio iytom  auvo (0t2tm(opnudlle lnctas  Dtrxr ot4teen i3ildlmDrl( o;t4 rxrxr3oo1oatr uvs t) exrxmpiu1lmt  fciatfa2umur ou0tlx io3tlt mDelu pn()tlxrxrctydopteauvs t0texmxrpoodlm  lnct (fartrum ot0aetn oetld a2um(vsn() eerio3iydopte u o (  rtmxmpnudlm e ieia( a2umu pot4oexn ieiyt s2ul(vp;u0trtnxr3iatlmte uvs;t teuo(mpno1al  mnvsas s2trxmp;u4aexo octys mDelu o u0 rxnif3ia1latrlivi t) 2tm(opiydap  mfct t)sDurx  no1olx mictadfs2ulu s t)artoxociotfpDrliei;(0s2xoimpio4ol n nesas s2ra(rono0opx moctadls2uluvp;t4 eenmr ootfa   iei (0trxoim iydll  lfcs s)a2tru oou0texnifeils m2umump (4arxrxrcoa1la r u o s0 euo(o ou1opte feil( a2umum nt4oee  i3tatla2rlnmo;(0teenmf tadfatraieo (0 2um(o iudol e fetltfsDur(  nu4tltn o3tyt mDelnvsnu0arxnif iodfp rai o t  etm(o iodole lfei t)s2rmuro;u0alx  fciysfs eau ont) ltnif iatfpD li sls)s2trio3io4lp e nctltfarrmx poo4aleomietytla ra(vonu4aexomocta1lp rauei;s  2to(r no1alen ict ( s2urxm nt0tlxnmo3tadfs2rm( o;()altrifciodfm e u i ()texr(o nudom  mfetat  rrrx  ou4tpenifciysfa2em(mo u0tetrxo iydlmtr uei ( t2um(rpoydomtn iet (fartr( pnu0oeeoifctldfaDrmu o;u0 rtnxrctytfmDraivils  2uoio3ny4alte iet s s2tm(mp;t4tpe ifetasfmDrlu s ()trxoxf tydfpDrli o s s2urir3oy4al  lnvsa(f Duru  nu0apenmicias sDea(vs u4alenmfciadoat  ueols0srto(opiy4apt mfvt (fsrua(rp;o4opt iietad a umn s;t0aetoif iodoaDeau i;t) rxrxopio1op elict t sDraxmont0openmoeiatlm2umn p;u)arxomr iotfm r i s s) 2tm(mpoo1om nlnctlsf Dtr( poo0optnmieildlm2rm(vpnt)treomfctytlatr ueolt  rum(opoy4lmtemicsa()artr(r nt1tpen oetadfaDumnvonu)aexoxr3iotlp  ai s t truoir oodameemfvta(faDra(mont0tptniociytfa rm( sn()artoxr oo1lm e ivsl() etrio ny1am e fcs ()s2umuroou4olxniiciasls2el(vo;t4altrirciodlmt aivsl()teum(r iu1lm nmfviat)sruaxro;t4tltoiictasfs2uauvpn(0 reomfcio1fptrai s;t  2xr(r3oydop elies sfa2uaxm nt1ope mo3iydfm uau p (4 ltrio3todfpt aieo ( tetoim oy4ap  mfct s) Dum(ro;t1opxo icilt m2umnvp;u4trtrxo tytom  livi s trurim ny4am n icil()sDtax pnt1tlxn ietld a2emnvp ()trxnmo tatopD auvs;t) euo(rpoudlp nmfct s srum(mo;u1ale mf3iatfm ea(vpnt4tetnxr oy1omt auei s)t2uoxopiy4ope  ivsa()sDrmur ;o1aexnio3iys a um(vs ()aexrir iydopte i o;() 2uriopoudol  livt t) rtaum ;t0apto ieilt s2rmuvp t) ltrio oytfaD  ieols) 2xo(o nodlp nmncia()arur(mp;o1tltnifetas a2uluvs;t) eenif3oydlatrau il(  2xmirpiy4optnlfvsls  Duaurono0ape mictadla2rmnmp;t)arerxf3iydlpDeau i;t0t2to(m ou4olte ict t) 2urur ;o0tptoiieiasfaDuanmon(4artrir3oy1fp  auvo;t  exmxmpou4ape mictl() 2uax o;t0teenmfciysfaDel(mon(0tetrifcio1lmDean slt0sexm(rpoo4omeemiei () Draumpoo0altn ictatla2emnms (4 rxnmr3to1fmtrauei (0srur(r3oo4altnlieias)aDrm( p;o1apenmieias m2el(von(0treniociydop  luei ( sexoxopnydalenlivt t)srtr(m ou1opxo i3iytfa2elu snt4 reoiociydfaDr ivi t  2xoim3iydole mnvsasfs2tm( pno0aexoiociadla eluvp t0tltoif3todlpDraivsl( texm(rpoudlp nlnet (fs2rmxm ot0alx iieiasfa2umumsnt4 reoxrciodfmD  ivs;s) 2ur(o3oydapte nes ()s2taxmp;o4teenioetatla2emuvo u4trenmo3totfmt livilt)sruoirpoydamt mfesasfa2rru p;t4open ociyt m uan sn()trtrxrcta1la  lieslt srtrxo iydlltemnvi s)sDra( pno0alxo ictatfs umuvont4 rtomf3iytfptraivsl() 2urxo3iy4lpt mfviat s2raxm no0oex  i3ilsfs2elnms;(4 rerir ootomteai il()truoxm3ny4am emictat arumu  nt4apxo icilsls2el( on(0texomr iydfa r nei;( teuoxr no1amt  neta(fs2ta( o;o4oexn o3iydfs2rln p;u0 etoirciodlmD anei;t)trxoxopnu4al   ncilt)aDum(mpnu1tpxomietltla uauvo;u4alerxf oadopD  ueo;s)srtm(mpoo4op n fvta()aDtauroou4tltn f3iltfsDeanms u) lxnio3oatlat ln il()s2xoim iu4omtnlfvsasfsrtr(mo;t4tpt iocias s ran snu)teermr3oa1omD ai s;t)srxm(mpio4ape miet (faDurxro;u0altnmiciatfa umnmp;t0aexnxr tytop  auvo;(0 rum(m nydomee ivilt srururonu4apx  o3iadfsDumuvo;() etnmfcoytfmt  uvols) etmir3no1al emieiatfsDraum oo1aleomo3ilsls2uln p (0trtrmr iotlpDeaivi;s0s2um(m ny1lmeemieil()a2tr(  ;o4oleomoctadls2rm(vsnt0 lerif io1fptrli ils t2umio3iydol   nct (fsDrmxrp;u0apt mi3iydfaDelu pn(4 etrmo3ootlpDe n sls)t2uoimpny4ole lfetatfsDtmumo;o4opt mi3tldfm ulnvont4alenxf to1fpDrauvo t  2to(r iudlpeemneslt)a2rrxrpno0tlxn f3ilt m2rlnmsn()areomo todlmDe nvo;t)srtr(o3oy1ope micslsfsDrau poo1olx mietydfm el(ms (0arxoxo todlm rlnvs () eumxr3iu1omt mfetlsfa2taxm ;o1olxnmieildlm rm( p (0aeeoio3iytla  aneo t t2umxr oodap   fetl( arrmu pno0oltomf3tltfs2ulu ont0tetnmfcta1om e i sls0 rxm(o nudlp  lnvtl(f Dur(r ;o0oeen ociatls rl(vs u)texrxrcoadoat lieolt  euoxrpnydlltemfvtl(  Drax oot4tptn o3iys m rl( s;(4aeerxfcootfm  an slt) etrxo3iu4lleelietls) 2uaumoou0tpxo oeiaslsDuau p u4texnxrcto1fmDelieo;( t2xmirpnudlptnliet t) rraxrp;t1tlxomfcils m2elu s t4teeoiociytoa elivo;s)tetr(rpny4amen netls)arrrxm ;t4opxoiietad sDumump;u0altomf3oytoaD aiei t)s2xmxo io4ll n nctatfa2uax o;t4apxo iciytla rln s t4 renir3oo1oa elu i s0setoim3oy4ap n nvtlt s2ta(r ;o0apeniieias aDeanmp u)arxrmo ia1fat auei;s texo(o3nu4optn fvt s)srrrur ;u1olenio3tadlsDrlu p;(4trerxf3ta1fm  aivo (0s2uoxo3iy4omte fctlt)srta(rpot4opx mocils aDrau o;t0alerxf3totfpDr ieslt)setmxr nodllenlictlsfa2uax pnu0tetomfctydla elnvs t)aleoio3tadlmDrau slt)trto(rpnudlpe mfvia()artauront1tpxomoetldls2ra( snt0tlxomrcoadopD  u o t truoxopnudlltemiesl(fsrrm(m ;t0olxnmo3iydla el( pn()aeerir3iotomDeluvo s0setr(o3nu1op elnvils) rtmxr ;t0apeoio3tlsfm rmumonu) etrxf3iodlmDranvi;t)t2xrxo3oy4omt mnviasfaruaxmp;t4tltomieiatlsDum(vp;u4arxrioctadfaDrluvs t) exoxm iy1optn nei t) 2tr(  ;o4teen ictasfs ea( o;u) rtnxrctytom eai ol( srxoxmpnydom  liesltf Dum(m nu1tpt  i3tlsfsDem( o;u0altrir3io1omt  nvsls t2ur(o3no4amtelictat) 2tm( p;t4ole  i3iad m2umnvp;t)arerif oa1lm   uvils)t2uoir oodlpenmivias)s2tru  nt0oleo i3iyslaDran snt0altoxf3iytlp e uvs;(  etr(o iu4ap elfvtl(f rra(rp;u1tetn ieilsfs2rau on(4alxoxrciadoa ean ol(0s2xm(m oo1apeemnvi (fsrrr(rp;u0tex iietlt mDrm(mon()aeenif3iy1fp r n o t0 eur(opio1alenlnvils)srrrxr no1aetomictlt aDeau snu0trxomr ootfpte nvi ( tetrxm3ny1om n nes t  rtrurp;u1oetnmo3ild sDrlnvs;u)tltomrciotlatranvs s0t2tmiopoo1lme mnct t)s2urx p;t4alxoioeiyt a ea(mp;u0artoiocootlpDraneils trxo(r oy4olte fci sfsrrauroou1ape ioetad aDulnvonu4tltrxr tydfptrlnvo;s)trtr(m3iudlp e fes t)srrmx p;o1teeomfciydla2emn o () lenir3iotomDrlu ols0 2uoxr io4ole  ict sfsDrm(mpou4texnmi3iydfaDuauvs (4 exoir3ty1fm eaivi ( srum(r io4olenmfviltfaDtr(mo;u0tltnifciatfmDulump;(0 etnmfcootlptr n il() etoxopoodaleemfeiasfartmumpou1tpt  ociyt a uan p;t4alenxr tatoaDe ivils0 rto(o3oudllen ics s aDur(  ot1oee  iciysfm rmums () ltrifcio1omDeanvo t)sexoxopiy1lle  nvtlt aDum(  ;u0apxomo3iadfsDrln pn(4arxrif oadopD auvol(  eur(o3ou4olenlnes ()aruaump;u0tptniicias s eau p t4altrxociatomDe i slt trumim nodoltnlfeiatfa2trumont4aexnmfcild a2elnmo u0 lerxf3oo1lpDelneolt  rtmxo ou4optnmietltf rtaxr ;u4oetomi3iadfm umn s t4 lxomr iytfpte i o;s t2trio3nydam n ivsat  rur(  ;u4tptomieiat sDulnmonu4texoxo oatfa  livolt) rxmio iydamtelicta(f 2taurooo4oet iietat sDumu snu4alermf tytoaDeln o;s0 etoir3io4amtnmfciltfaDumxro;u4opeoif3iadlsDranvo;u0texrmo oadopD  u i;()srtmxo oudome  ncs t)s2ua( pno0tetnmietlt a2el(mpn(0arxrmociytfaDr ieols0s2to(o no4om e fviltfaDumurp;u4ope ioetas s2rauvp u4 rtrmrciytoa r u i;( setm(r3oy1ll elfvi tfs2umxr ;o0tpxo fctytlmDeaumpnt)alenxocoydoaD aivi;t0 etoir3oudape mfvia(  rraurp;o0oetnio3tlslmDul(vo;t0 etnmrcoo1oa   n s;s  2xr(opoodomtelnet s sDtrx  oo0oleomi3ilslsDumn s t4 lermocty1fm eauvs s0s2toxrpio4am n fvil(  Drmxr ;u1apxnii3iyd m elums;u4 eenxf3io1lptr ueols0t2uoxr no1oltemfcs t  2taum ou0open oeiad a el( p;(0arerir3oodom eai s t) rtoxo iudol  lfci s)aDtaxrpnt0texn i3iytlm rlnvon(4 etrmr3todlm ranvi ( sexrio oy4olen ncia(f 2trur ;u0tlenmi3iytls2rl(mp;(4 rtoxr3ta1omDraiesls) etrim3iodlmenmietlt)aDtax pno0tle iieildlm2ea( p u0texoircoo1fmD ln s;s) rumxr iu4om nlfcil(  ruaxr ;t4olt mocilsfm2um( ont4tltomrctadoa rauvsls0s2umiopnydopt lics (fa2tmu pno0tlxo i3ild sDuanmp;(4artrio3iatoptr nvols sexriopoodom nmfctatf rrru ono4alx micilslmDrmumo (4alxomociodlp   nvsl()t2xmimpiu4lp nmicias)arrm( pou4openmf3iltfsDrm(vs t4trxnxo3oatfpte neo;s0tetoio3oo4lpeemictls) 2rrurpnt1oetnmo3ildfs2rm(ms;t0aetoxf3iodfaDrau s s teuoio iu4ll  mfvias)arumu ooo0oleomo3iyslaDuln ont0texrmoctotfptelnvo t0 rtoxm nodalte ivils aDtm( pnu0tle  feiys m rln snu) leoxociytoa ean o;t setoxo iodlm e net sf rua(  nu0tlxo i3ildfa elu s;u)texomr oo1lmtrluvil( srtrio nodal nmneta()s2urur ;t0tee mocildla2eau s;u)tlerio3ta1fmDelivols sexrimpio1ap elivtlt) Dtm(ro;t0aeeoio3iatfs raumon()tlxoxf iotlpD lnei s) 2tmxrpoydlpt  nctat  rtmumpno1oleomi3iltlaDulnvo u)treoxf totfm elues;t)s2toio3oudolen feta(  2rr(m ;o1tpt ifctldfa rl(mp t) lxnxrcio1latelneolt)t2xoxm no1lmtnlivs (fsDtmx  nt0olxoifeilsla2uanvs ()arermocoo1faDelieo;t)trxrxm nudomtnlivsl()sDtmx ooo4tpenmfctatfa eanvo t0arenxociatomt ai s;t)t2xoimpnodam nlnes ()aDtaum ou4alenio3tytlm um(ms;t0 rermo ta1lm   u slt0 eurio3oydllee fcils)srumumo;t4ope mietltfmDea(mp;(0 rxnir3oydoaDr uvo;s  2urim io4aptemnviat aDumxr oo0apenmoeiltlsDumnmont0tetrir oytfm e nesls)setoxo oo4lm  mncsl(faDtmumpnu4tpxnmi3iyt mDea( p;(4 rxoir tydom r n o t0 2xo(r3nydolenlncs (fs2taum nt4aptn fetlsla ulumsnu4treoif ootfmteaiei t)trxrim3oy1opeelfeil()s2rmxmono4opx  f3ias aDelnmp u) exrmr3ootlptr ies;t trtr(rpiy4ape licsat)a2ur(r nu0tpeoifetatfm rlnvo u)aetrmo ia1lm   ueo s0teumxo oo4lmen fctat)a2tau p;u0opx iieiaslm2ea(vp;u4trtoxf oadlp  lieo t0 rtrxo io1oltemnetat)aDum(mp;u1aee  oeiytfs2rm( pnt)texnir oadoa ranvils sexoxm oo4openlivsas artmumpoo1alxnioetysfaDrln o;() lermo3oa1fmtelivi t) rxoir nu1lme  neslt  rtaxm ;u0opxomo3tlsls el(vpn(0tlxrir3oo1fpD  uvs ()s2tr(m3oy1ale  fvt ( srtrur nt1alt io3iysfm eln o u4alxrif3iotomte i i;s  exm(opoodomtnlfvia(  Dtau ono1oleniicils mDua( o;u)tetnmfcoatlmDr nesl(  2uoxr nu4ll emivsat  Drmxr ;t4teenmictadla ulnmpnt)tetomrcio1fmDe uvils)srtoimpiy4lp  mfci tfaDtm(mo;t1teeomf3tyd s2elumpnu) rtnxo tydlp ranvs ( trxoxopoy1olt mivs ()sDumumoot4aexo ictasfaDra(mont0 lxomo oodlmt lieolt  exrxm ny1apee fci (fsDrrx pno4open oeiasfsDul( o (4alxoxociadfp  aueo;( truoirpno4ap elfeta(  rur(rp;o4apx  ieiys s2eluvonu0 rxrifcto1lp  aues;()srtoim3oudol e ncsa(f 2trx pot4tlen fetyt aDem(vp t4 rxoir3todomtrlnvs;(0srxmxrpio4aleemiesls a2umxmpno4tlx mo3tytfa uanvp u0tetrxfcoodoptrai i;(0 2tmirpiu1ll e fct sfa2uaxro;o4tltn fciyslmDra( pnu4 rxnio tatlptelues () exrimpou4oleemnvtas) Duau pot0aptn oeiyd m2raums u4 eenxo3iodfaDrln il( sruo(o3oodam  mnes (  Dtr(mpnt4oex mi3iatlmDrlu o (0teerio3iytfatranvs t  rxoxr3iudamt  nesatfaDta( p;u4tpxomiciltlmDrauvo (4 rtoxo ia1op r uvi;t0 ruo(o3oo4lltn fvsl(fsrrax pou4tex mf3tls mDumu on()texnxocoa1fmD  nesl(0teuoxm3no1omt lneil( arraxronu1oeen feild a ran p;u4aeeoiocia1oaDrlieols0s2uoxopiy4lmen nvtltf rtm( o;t0ale  fetadla emnmo (0 rtrxf iodfa r uvo;s t2to(rpnydlmtemnetasf 2rmu  no4ole mf3tadls2uan o;t)arenirciotlmDr neolt t2toio iu1ll n ieia(  rumx oou4alto o3tysfm2emnvp;(0 renxr oadla eai ols0teuoxmpiy4amee nei (  Dtmxm ou0teeoii3tltlaDeanvont) rxnmf3io1fmDraueo t)texoir3iodllt mnesas)arta(m nt1apt iociad a2rauvo (0trerifcoo1oat auvo t t2xo(rpny4lpt lfvilt  Draxroou1opeomo3iydfmDrl(mon()tetrif oydlmt lnvo;t0srxo(o3oudome lnct tf Drru o;o4ope moeiasfmDrmu o u)aeeoxf oodoa  lnvil( srtrio ou1ll elnesls)sDra(  no4aleomf3tltlmDranvon(0trermfcio1latelivsls truoio3nu4opt mics tfs2ta(  no0texoif3tydls2umuvpnt) rerif totomD lneo;s) ruo(r iu1lleemfvia(f rurxr ;o1olenmf3tytfs ea( snt)trxrir iatopte ieil()t2um(m iy4omtelfvsl(fsDumxr ;u4tlxniocilsfm2eanmsnu)texrxf3todlp rlu i;t0seum(opiodapenmfcilt)artr(  ot0alxomieiasfa emnms (0tlxoxrcoo1oaD liei;s)t2xrxo oydale mnetlsfs2tm( pot4apxomfcilt aDem( o (0tetnxrcto1laDran i s seto(o ny4lptnmncias  2rr( p;o4aee mieildfa2rauvpn(0aexoifctotlm r nvs;(0srxr(r oo4alt  fvsl(  rur(  no4teeomo3ilslm rm(vsnt0alxrxrctydla e ieo s0trurxrpoy1ap elnvi ( s2tm( pnu1apxn fetldlm2eaums u0 renmo tadfaDraneolt) rxr(opoy1ope  fciat  2um(rpot1olxn feiasla rln o;u) exnifctodlmt aieilt) euoiopiy4lpe mfcsasfa2rrx  ot1olxnif3tltlm eluvp (4tlxnif3oytla raies t trtoxo3nu4lltnmnesltfsDrmumo;o4oleomo3iadla2rl(mpn(0 rtoxfcia1oa  aivs;(0 rtr(o nu1aptnlnvtlsf Dtm(ront0tpt ifeiytfs ulnvpnu)altrxf io1oaDranes;s)srtoiopoodlltnmncsl()s2rrx pnu4apenmi3iltfs2raumpn(4 rermr iy1lp   u s;t srtoxm3iudame mictas)s2rmuront0apenmicildlm ua(mpn(0alerio oy1la e ies t  exo(o3no1omenmneia(fsrraxrpoo4tlxoiictyslm2rlnvo u0aetrmfcoatfp eau s;t0s2xmimpnodlleemictat)arur(mont0altomf3iltls2emnmp;u)tleoxr3iodlpt  neilt0 2xr(r no4om   fvia() 2rmxrpou1alx iietydls rl( s u0 rxrif iytfm  ai o (0 rurxm3nu1lme  ietatf Drmx  oo1aptomi3tat a2rlu p;t0 ltrmr3oy1op  lu o;t tetr(r iy1lmte iviasfsDrmxront4oltnmfeiysls2eaumpnu4aeerir oodfptr n o t)texoxrpoudlmtn ivia( arumu ono4aexomocilt m rm( o;u)aleoio iytfm  an s s s2xm(m ou4al e fcia() Drmur nt1tpeoioeiyslm umnmpnu) lxomr ta1lm eaivslt0s2tmir ou4lleemnci (fa2ta(r oo1aeto ieiasfs2elnmp t0arxnirctadfatr ivslt)seuoim nydlm  mnvt ( sDtm(  ot4aeeoioctatfa uanvs;(0teeomr ia1oa r i s;s)seum(opiy1lmtnlivil(farumxmooo4alt mfeiyd s2rmuvsnt0altoxr3ta1fmtrlivils0 rxr(opou4oltelnci tfarurum nt0oexomi3tytfm2emnvs;()tlxrxf oadlmtelu i;( s2uoxr3iudap nmnvt tfs2umu o;u4tpe mf3iyt s2um(vp;t4 etniociydfmtr ivils0trxrirpiy1lmtnmictlt  2rmur ;o0olxo o3tlt mDeln pnt)trtnircoo1fmt li sls srxm(o3oy1lleemnvsls)arra(  no4tee mictys a2rlnmpnt4tltnmf3oo1fat  u s s0 exo(m oy4ope  ics tfsDrmum ou1optnmieild a2rlumont0tlxnmo oy1oat  i ol(0 exr(m oy4aleelfeia(  2rm(  ;u1optnmfctlsla rlums;(0trxrmr3oatfmDelieo;s) rumxmpiudalee fetat)sDraxmonu1oltn i3iyt m rm(mp;u0areomoctotfa r nei;s0 rtr(m3iydlmenmfctl( sDrrurp;u0aetniietlsla um(mpnt)tlxoio3iy1fmteau o t seum(mpoodapt mncsl(fsDtrxr ;u0ape mfeiasla emnmon(0arenxf todoa eluvo;(0 euo(r iu4olte ncs s  Drrurooo1opx ifctydfs2ea( s;t0tleomrcoy1fpD  ueo t setrim iudll elfcsl()srur(mooo4ape ioetyd mDemuvonu0trtoxrciatfa rluvs t0 etr(o iu1am  mnes t aDrr(  nu1olxnmi3tyslaDeauvsnu)alxnirciodlaDrauvo;( teuoxopoy1ole livs sfsrrr( p;t4tleo octas m rm(ms t) exrxo oydlp raneo t0s2toir3iy1olen fcsl(fs2truro;u0aeeo i3tad a2eau on(0 rxrxfciatfmtr i s t) rxm(r oo1ll  micta(farumurpot0alxoiicild a2rl(ms;u) rxrifctadfaD lnvols0 2um(opiudoltnlicias a2uaumo;t1alxn fetytfs emu o (0teenmr iatlmDr uvs;t)t2to(opoydapee ivta( srumx  nt4aexomf3iatlmDrm( o u4 rtoir3iy1fmDe i sls srxoxo io1alenmfcsatf Draum ;u4aeeomf3tldfsDrmn pnu4 eenmo ia1oa e ivolt)sruo(o oydlp nlietlt arumurpnt4tpeoii3iytfmDeanvs;t0alxnxr3iadfpD ln o;s)t2xr(mpno4lm nmicta(  rtmxm nt0aexo ocild mDuluvon(0tltnir3iatfmteli s;(  rum(opnudale mfvias) Drax ont4teeo i3iatfsDran o;t4 lxnxoctotopt lu ilt0t2xrxopoodam e nvs ()a2raxm ;u4teto ieiltlm rluvp u4texrir3iatlm r ieil()srtrxo nudopt  fvs t) 2trxmont4optoio3tlslmDea(mo (4tetnxo tadom rauvs;t sexmiopio4amen fcs ( aDtmurpou4aptoif3iasls um(vsn() rxoxf3ootfptrau o;s)seurxmpiu1lmeelneiasfs2trumooo4teeniociasfs em(msnu0 etnxr3oa1op  lues s)s2tr(r3oy1apenmfvsas)aDumxrpnt4tpx  oeilsfm eaump;t0 exoio3to1lat lnei;(0 rtoio3nydop   fvt (fa2tax  no1tlx mi3iatla2emn s;u0 lenir3iatfpD aneol()sexrxr3oudlme mfcias  rtaur no4oexoiicilsfm2el(vpnu0alxnmf3oo1fpDe iesl(0 2uoio oy4om  mncias  rum(rpou1tee  octyd aDra(mon(0 exnmo iadlaDrau i s sexmir ou4open ivtltfs2uax p;u1tptn ictytlsDrlu p ()tltnxo3iadlm  aneo;( t2xo(m3oodlp  mfvslsf Dum(r ou4teeo oeiat m ra( s (4artnifctodlaDrluvs t0 rum(o no4alenmivi s a2tmxmooo0optomieiys s2em( pnu)texnmo3oadfa e ies;(  ruoiopny4lmtnmicsl(f Drm(r no0altn iciadfm ul(vpnu0aeenifcoo1fm elueo ()srxmim3nu4lm elfetltf 2rrxr ou0tlt mocils sDrlu onu0teenxoctodoaDe ieslt0 2umxr iydom emneiasfaDuaxmono0tpxn f3iytlmDumnvpn(0tetrir oa1laDe ivslt)trtrxm3iu1lpe lfei sf rrr(  nu0apx  f3tldla ulumpn()arxnmo oatfatr ues (0trxo(rpnudom e ieils  rrru pnt1oet iictasla2emuvp (0altrmfcia1laD livo;t0tetmxmpiudomt  nci t)s2uaxrpnt1olx  o3iysls uanmo;(4 rxrxo3iytfa r n ils0s2um(m oo1lp elicia()arrm(mo;t4tltnmoeiltla rmuvsnt)trxoio ia1lm  ai o (0s2urim io4am nmnvt (  Dtrxr no0aeenmieiyd mDea(mp t0alxrmocoydfmtranvo t)sruoxm3ny4lp nmneia()sDumumpnt4ape  i3ilsla rm( s t) exoxf oa1lptrluvol() exo(o oy1olenlncs t s2rr(  ot4oexoioetydfa2uanmsnt4 eeoxr3oadoaDraivi;t srtrxm3oo4alt  nei t) Dtmu oou4oltoiociat s umnmo;(0 etrxf iatoaDelivo;t)s2trxrpnydlptnmiesat  Drm(rp;u0aleoii3iasls2ulnmp;()areoxo tydomD  i ol( srxrxo3oo4opeemncs (fa2ua(mpnu4olen ieils sDumn o;t4arerxfciy1lmDeaieo;() 2xr(r iu4ll  lfvt tfarrax o;u4tltnmietatlmDeln pn(4 rxnxo oatlpte uvo;t seurio io4lmeelnci t  rtmxrpoo4alt ioeiadfm rmnvsn()tetoio totfptr iesls trxrxo3ny4lm  lici (fa2urxrpot4tlxn feiatfa2el(vo t0aexnxrctatfmt anvs;(0 2xmio io4ll elivtl(faDtrxr ;o4aex  fcias sDranmo;t0texoir3todoa raivo;( t2urim3iy1ll emivtls)aDrrumpou1tleoio3ils m2eanmp u0 renxoctydfp rlnvolt t2toxopoo4lme  fei (  rta(ronu1aeeomf3iatfsDel(mpnu)aexnmr3tytopte n il(0t2xoimpoydal elivi t)s2tr(moot1tlx ioeiyt m2ul(vp ()alxnmfciotfmtraneols0setm(o3iu4lp nmfvt sfa2ra(ro;u1opx  o3iad m emnmpn(0trxnxo3oy1om e ueslt0sruriopiu1am nmicils) 2tmur oo0apx moctatla ean s;t4texoirctydfm  anvo s sexrio iudlleelfvtlsfaDuru  nu1tpt mf3iytfs2rluvp u)tlermr oadomtrai i;( trxrio3io4aleemneias) rtmxrpnu0tlt iietldfsDuluvo u0trtrxoctotoptean i s0trxr(r nu1amtn ivt ()arurxm ;u4apt mi3ilt a2em(mo;t)alerxociatfp r nvsls0t2tm(o3ny4lp e ivia(f rtr( p;o1teenioctyt a ul(vonu)tltomfciy1omD ln i;( t2urio oudlm e nei (f 2rmu  nu1alt ifeiytla2rm(mp (0 rxoio oa1omD ai olt)t2toimpou1ap   neiltfarrr(mono4oexomiciadlaDrl(vsnu4tltoio3io1lat  nvo;t0teuo(rpiy1omtelies sf 2rauroot0tptnmi3iys sDumnvont)tltnmfcoydlaD  ivols  euriopnu1opeelnviltfarrrumont1tpt moeiydlm em( s;u4aeermociydfp   n i;(0trxmim3oy1lptelncsat arra(mpoo4aleo ieild a ulu on(4aexoio iodfmt auei;s)t2to(o3iy4om  lnei sf Dtmx  ;t1apeniictltlm uan s;() etoxr3tatopt auvo t  rto(m iy4alte icias  rtm(mono0oetnmf3ildfa um(msnt)texoxf3oo1fm r uvol(0 2xmxrpio1apee ncil(  rrrum ;o4aeeo ociytfaDumump;u4teermr iytfp rauvil( trur(m iy4lmte fvi sfaDum(mp;o1tpe mfetysfa eauvo (4 eerxf3oatfm  luvi;s  rurxm3ou1amenmfvslt  2umu poo4olt mfetytls elnmp;u) lerxo3oa1om eauvo;t t2xoim iu4op   nciltfa2ur(moou0oeeomieild m2rmnvon(4alxrif3oydom  ai s;t) rum(o3ny4lmtelivs ()srraur ou4tpx ii3ias a2eln o;t4 renifctytom raueils truo(m iy4llt miei tfsrum(rpnu1tlto oeiad a em(vp;u4trxnmfctotop rlies t0srxo(m nu1omeemiet s)arraurp;o4oex  ociadlm ua( o u)artnxr tatlm  an o;() etmio3nu4lp emnci s) Duaxm ;o4apenioctatfs um(vo;t0alxrmf todopDeluvs t)t2xr(rpno1apee fcsas  rrrxmonu0olxniociatla ul(vp;t) exrmr3tatlp rai i (0s2toimpio1oleemictl(  2uaum nu0ole  ictlt a2ran p t4 exnir iydlpD lnes;s tetrxm3oodlp  mncil(  2tau p;o1tet mf3iat aDeanmo;(4teeoif oy1laD ln o s)srtoir nodomt micilt  2tru  ou4tlx mietlt s2em( pn(4altrmfciatomteauvs s0s2xoxmpno1amtemfctlt)sruauroot4tetoif3iatlm2rau s u4arxoxr oatomD lu s ( srxrirpiudalee icsasfsrraxrp;t0tee mo3tysla2umu o (4aeeoir tatop  aues s) exo(o3iudopeelneiat)a2rr(  nt4olt mfetydlm2rl(vonu4 exomr3iadomDraivi;t s2xoir oodole  ictl() 2taum no1ale  o3iadla2rl( p;u4 rtrxf oy1fm e uvs;t truo(m3iodapt  neia()arrrurp;o1tpxnmoeiysfmDranmo;(0 lerio oydom rauvo;s0 rur(m no4om  lnvi sfsrrmx p;u4opt mf3iatfa2umn onu)teeoxo3ta1fat au i;t  rxmio3nudamtnlfct s) Drrxr ot4apx mo3iydls rmnvsnt0aexnxr ta1fm  livi;t0 2xmxmpiy4lmen icsas  rtmxmono1tpeomietasfa2rl(vs;t4 lenmf3iodfmDr uvslt) etrio3no1op e fvtl() Dtaump;o1tet mocildfaDraump (0 lxrxfctotfm rlnesls0 exmxr iodaltelncta(  2uaxmo;u0apx mi3iadfa2ulump t)aexrmf3ty1lm ran s;t  2uoiopoy4ameemnct sf rur( o;u1tptn feiltlm2elnms u0tetrmf oodoat  n s;t)trur(m3iu1llen fcia(farumxm ;u0aleoioeiadlmDra( o;()tltrmfctotoaD lnei;t0 2to(r3io4olte neia( aDrr(  no4tlxoii3iys a rln on(4 rxrxrcoatopDrliesls)t2uoiopiu4am elfei (f 2tax  ;t0teto feiadlm uluvo;t0tetoxo3oy1faDelues;() rumxr no4optnmivtlt  2taxrono1aleomfeiasla2rm( s u0teenir3iy1lmDelu slt s2urxmpoy1ale lnvsas sDuru oou1aleomiciltfa emn p;u)altoxociytoa e neo;t) rxrxr3oy4op emncils) Dra( pnt1aeenmo3tltlmDemumo (0 exrxo3totoatelnesls0setmxm no1ll elfetlsfs2rmumpnt1aetnmfeiydfm2rlumo;t0 leoif oytoaDeluesls) 2uo(o no4lp e fcils a2tr( ooo4opt mfeiysfs ran s;t)trenxoctodlm r ueo s0 exrio io1lm n feil()aDrr(ro;u1aetn i3iytfm2umnms u4 rxnxfctytlmt  ieo;s  rxmio3ou4lltelietl(faDumxm ;u1oetnmf3iytfsDemn o;t)aexrxfctadlpteaivi (0 eumxmpoy1ol emfeia(faDta(rpot4oleomfeiad s umuvsnt)trtoircio1lmtelnes ()tetoxm3iy4apt lfcils)srra(r ;u1aee iociyt s el( sn() lerif tydlatr i o (0 rum(o3no4opt mnes t)a2raxmoou1opx ifciyslsDumuvont4 exrmo3iytlmDrlnei;s  euo(o3iy4opee nvi t)sDumu o;u4openmi3ias s2ra(mo u)teenmfcoydla raivs s teurxm3nudapt lfcia(f Dum(ronu0oexo octaslaDuanmon(4altrmf3iatfptrauei t0seto(rpny1om e ict ()srum(r ;t0oeeo ietydfaDumn p t) lxoxo3tatfaD  nvi;(0s2umxopio1aptnmnes tf rurx o;u0tex  f3iydlsDuaums ()tlerir ty1fp e nvi;t srto(o3ny4apt miviatfs2um(ro;o0tlxn octasfa rm( s t) rtoir3todlatr u ols) exoio iu1oleelnct s srua(mpoo4aeenmo3tlt m elu o (0aeeoxocto1om  aivslt)seurirpoudaltelnci t aDrmur ou1apx ifeildlm uanmo (0 rtrxf3iy1opDrai ol()sexriopoudom elfvtat arrmump;o4apt mfeildls2rm(vpn()teermocta1fm e i o;(0srtr(r3iydope  iesat  Dumx o;u0oltnifetad a rln snu0 rxrxf3oo1fmteaieol()trtoxrpio1al   ics s) rraumo;o0opt ii3iytfsDraums;(0 lxnif iydlmtraivo s)t2toxo oo1op nmicsls srurumoot4tpt ioetlsla emn on(4aetomf3iytlp rln i ()tetmxr ou4om   nci s)arrmx o;u4tex  o3iytlm uauvs;()aleoxrcoodlaDe u i;( trtmir iodap n fvil(fsrrmu  ;t0tet  ieiltfsDel( onu4 etnxr3ootfat aiei;t)setr(mpou4lm  mfvil(f rrmumonu4ale mociyd m2eanvo;t0 etomoctotfmDrlivilt) eurxr3io1lp nlivsasfsDrmu pnt1opeomo3tydfm2rauvs u4trtrmr oytlmDe u o;t0teumxm oo1om   fci sfs2tmxronu1olt  ieils a2emuvsnt4aetoirciotfm ran ilt0 rxmxo3oy1oltemnvt () Draxrpno4aexnioetyd a2uanvo;(0 eerircta1fp r nvi;t0tetrxr3nydolte nctasf Draurpno4optoiociatfm ulnvo;(4 rtnmocty1fm rlnes (  rxmxm oo4lp emieia(f 2taxr ot1tptnmoctlt a2ea( s;t0trtnxocootoatelnes s s2xrxo no1lp  mfeta( aDtaxr ;o1oexomoeild sDuauvs u)artnmr3to1lmD anvils s2tm(rpiu4opeemieias)arumx  ot4alxn o3iytlaDumn p;(0tetoxfctytlaD aivils)setoir3io4llenlnvils  rtrx pnt4texoiociad m em(mo;u) lxrir3iotfmDe uvs;(0t2xmxr oo4omtelncsa(f rrrur nu4aetnmieiysfm rl( pn() rxrmr3iy1lmDrluei;()srxmim oodllt  fvi s)a2ururont4altomfctas mDua(vp () eermf3tydfm rlu i ( trxrxr3iy1omte ici sfaDra(r no4ole  f3iydfs emumpn() renmfcoa1fmDean o;(0 rtrxm ou4am nlfetlt) 2rm(mp;o4tltn ietas a eanvs u) rxnmrciytlp rlneo s)texrxr oo4lpeemfcsas)s2ta( p;t4opxo fetys s2eluvp u0texrxfctytlat aiei;s s2trxo ou4ame mncsl()s2rrumonu1oeeo fetytfsDumn p;(4tetrmfciodoa eluei;s0srumim3iu1amtn feiatf 2rrurpot1tptoio3ilslaDemums;t0teeoxo tatlmtelu sl(0setrxrpiudopt livsa(  2ua(rp;t1ole mfetydlm umnmonu4aeeoxo oodlpt aieo t)srtrio iudapeelnet s s2urump;t0olenmociysfs2ran s;t4alxrmfcoa1oa eau i s0trtmir iodale mivi ()aDrau  nu0ale mfctys mDrluvpnu4artomf3ty1fmtrauei;t)texm(opiodlp e ivil() Duau ont4teen feiytlm2rl( pn() rtrxo3iatoaD  ieo;s tetm(m oy1al elneslt) Dum(ro;u1aetnmociadfsDuanvp;t4texrmrctatfpt  uvsls) rur(mpiu4ll nlfvslsfsDuau o;t0apen ietltlmDelu p t)trerxo iatlmtrai s;(0 eurir3oydopee nci sf Dtmxrp;u4aeeo iciadls em(mo;t)tetrxrciodlmDeaivi s)t2xrxo3nodoltnmnvi s)artau oot4oex mfetls m2ua(vont)aeeoircoodoaDr uvi s0 exrim3no4lmtnmivia(fa2raum nu4tlxoiociyd m emuvon(0altoioctodfat  nvs;t) ruoxm oy1am elicias s2rm(rp;t1tpxnmfetlslsDea(mp;t)teerir iatfm eln i s s2um(r oodale  iesat) rtr(mp;t4oexn f3iytfs2ul( s;u0 reoxocoo1lmDraies ( sexrxmpoo4aleemictat)aDraumpou1openmi3ias a rmn p u)texnio3io1fa eauvi;()setoxr no1ope mnesat  rrmx  ;t4aetnmfciad s uluvpnt4tltrif3tatfmte n ol() 2xrxmpnu4am emnvsltfsrta(  ;t0tptnmicilsfa ulnvs (4trtnifcoydlmD lu olt) 2to(o iudamt  ictls  rtrumpou4tetn fctatfm2umnmo (4trerxr iy1fa  ai o;t0tetrim iu4ape  neiat) rtaxroou4apto ieiysls emumo;u4 lxrxrcoytopteluei;t)trtrim3nu4ol   fvsas srumx ooo1aexomo3ilslm uauvs t0 lxrmr todfmDraueo;t)t2umim3oy4lmtnmfeia()s2rmuroou4alxo feiytlsDuau s;u4 leoxfcto1fateauvolt0trumxrpoodllte nvsat  2tmur ;u4alenmo3iaslsDuau snt)tlerir3iy1lp rlieilt tetrxm iu4opee ieilt aDrrxrpot1aetnmi3taslm emnvont4 leoif oy1fmtrli o t)texo(rpou4opeeliei () Dra(  ou1aptoio3iydlm ulumo t)texrirciytfmDrau o;t s2uoxo nu4al nliciltfaDua(rpoo1optomoctydla ul(msn(4aetrmr iy1fateli o t) 2toiopoodaleelnci sfs2umxr ;o1tlx mfctltfm ua( pn()alxnxf oytla  luvolt0trxoio3iudamt mnvsa( srtr(mpno1tetomo3ias a2ea(mp u)artoxrciadfmDrlnvs;(0teur(mpio4lle  nct t) rurumonu1tlxnmi3iasfa rmn on() eeoif3totfaD aivo ( s2umxo no1amt  fet t srtrx pnt4apxniociasfaDraump;t4tltnif3iydfm ean i;s texoxo nodlptn fvi s s2taur ;t1oltnio3iadla ua(mp;u)teenxf3iodop e uei;t)srur(rpiy1olenlnet tfsrrrxr ot1tlxoifctyslsDuluvpn()treomo3io1oat  nvilt  2umim oydap nlneils)srraumpoo1olto f3tltlaDel(vpn(4 rerircootomDr uei t)sexo(rpnu4al   ies s arta(mp;t0opxniictaslmDum( s;u) rtrxfcio1fmD lnvs s0setr(o3nydlp   fesls) Dtm(  no1tltomociatlsDelu p t0treomf io1late n s;s trurir3ny4al  mnvslt s2raur nt4tlt  oetls a2ul(vp;t) rxrmo tadomD  nvs t texoxm no4op  lfetat sDumu  no4tlen feiad m uauvs;u0altoxf oatlpD  u s;s)t2xmxmpiydomee ivsa()sDuaum nt1aptn o3ias m2ea(vs;t4artrircoodoatranei t s2xm(m iy4ap elnvia(f Duax poo0oexoif3ias a2rl(vs u4aetomr3io1laD ai olt)trxriopou1alenlfei s srrmurpno4tpenifeiadla2rlumo;t0texrxf tydoatr uei;t setoxmpno4op   fei s srtmxmp;o0alxoioetlt s um(vs;(4 eeomrciy1opt li ilt  2uo(mpiodaltnlivi s)s2rmumpnt4oltoio3iat s rmumo;(0texrxo iy1lpDrlnei t  exoxo3nodapt  icia()aDrax p;o0olxomoeildfa2ranmsnu)tltomoctydfmDeauvs ()seuo(opiu1lm  mieil()a2tmx poo0oeen ietyd mDuanms t) rxnxf3oodfa r uei;t0 etoim3ou4amenmictlsfaruaum ;t0apxo f3iysfs2rau snt0altnxo3tatla rai s t0teuo(m3ny1op nmnctlt)sDtr(mooo4aptnmi3iatfm2umnmont4alxrxocoydlpDeai i t0s2xrxr3iodomt livi ( s2rmum ot0altoif3iadla rmn p;u)arerif iatfaD an s t srurxmpio1olt mneiltfsDtr(mpnt4apx ifeiyslmDul(ms ()treoxr3oodfpte i o;s0s2umxm3nu4ll  lfci sfa2uax ooo4ope  o3iltfsDemump;t0artnmr3oy1oa  lies;(0srtoxr oo4lm elfvia() 2rm(mp;o0ale ioctldla2rauvon(4teenxocto1lmDelnvo t setmio3nu4optelfeiatfs2tax pno1teto oeias aDeanmonu)aeeomo oa1fpt lnvo ()t2umim3nudap elfvt s  2uax  ou4tpxoif3iytfs ua(mp t0 ltrxfcia1fa e ivi (0seuo(o3io1olenlnctat)a2raxr ou0tex ioeils m2umnms u4 rxnmo3iytfa  lnvils  rxoio iu1omte ivsl(f Dum(roou1aptomfctydfa rm( s u0alxrioctadlptrli i;t)setrxo nydll nmivtlt) 2rmxrp;u4tpxomi3iatlm2elumo (0altrif ty1oat li i;t s2toxr3io4omt  fesas) rurxmono0tpe  f3ilt m rlnmo;() lenmr3oy1faDr uvi;s0teumio nodllee ncs s arurur nu4oleomfeilsfsDrau snu0altnxociatfmD anvils  exmio oy1amen nvi sfarrax  ot0apxoioetld a em(ms u) lxriocia1la  ai i t  2toxm iydope lfvil( aDrm(m oo4tpenmfeias s uluvs t4trxomf3totoatelu o;s0t2xoxr3ou4op n nei s)s2tm(m no0aeeomf3iydfa eauvp (4 rxnmo3iadfaDraueslt0srxrxr ou1aptn ncslt arrmxmooo4oetn ociadfmDuau s t0 lxnmocoydla  liesl()texmxrpno1lmenlncs t s2taurp;o0aleomfciasfaDeauvp;(4artrxr oa1lmDrauei t)seurxrpoo1am   iciasfsrur(mont0aptniociyd mDrm(von()trenio io1lpteaueo ( s2uoxm3ny1llenmies s aDrmurpot4tlt iiciatfs2rln p;(0aeeoxociotfa e uvi (  rtoim iy1alt lnes t arumx ooo0oltnmfeiaslsDea(von(4 etnxf oatoa eli sls)t2tm(r ou4lptnmfvslt artaurpnu4tetn ociyd aDranvsn() rxrifcta1op ran i (  2toxr iydaptnlfcta(f Duau pnt4tpto oeiatfmDrluvsnt)aetoxociatlm eluei t) rtmir3oy4lltn fei sfsDrrxmooo4oexnmfctyt aDemu pn(4tltnxoctadfp e nesl() exmxrpny4amenmfctl(  rtrur ;o4apt mf3tyd a2ul(vp u) exrxf iodomD au s;(0setm(r3no1ameelfetat s2tr( p;o0tptnmo3tadfaDean p;t4trermf ty1fmD lieilt tetmxm3iy4ape lncia() Dtauro;u4tlenifeilsls rm(mont4arxnxo ootopDr uvs (0texr(m3io4apee ies s)a2urx  nt0opeomiciadlmDeluvs u4 rtrmf totoateluei t srtoiopnodalen ici sf ruaxr nu4opt  fciltla2ua(mont4arxomo io1lm  liesls)t2uo(mpiu1amte fvsls a2rmuronu0tle ifeiasfm2emumpnt0teenxr oodlaD  nvs;( t2um(m iy1lle miet s)s2rru ooo0oexnmf3ildlaDemn sn(4 lerxo3tydfp  livi ()seto(r3nydoptnmncsatfaDum( pnu1aexn feiltla2em(vs (4artrxr to1op rlnvs s0s2uoxo nu4omeemfvs ( sDrr( ooo4tpxnmieiltfs2rluvp (0aetrio3tydfmDr uvsl()t2uoiopou1ope lieias  rurxmp;u0aleo ieils a2elnmp;t0arenmr iadlmtraueils teuoio3iy1lltnlnctat a2ra(mp;t1tee ifetldfs elu snt)tlenxf tydfm  livi t0 euo(opio4lleelnvta(f rtm(root0opeomietld s rluvo;() ltnmo ty1omtraiei t srxoxmpnu1amt mieilt  rtmu  ;t0apeomiciatfa em( o;t0 etnio3tytlpDr nvs;( s2xo(m3no4lm n iciltfsrumxm ;o1tlx ii3ildlaDrl(vp t0trerxf3to1fm rlies () eur(r3no1open ies () Dtru p;t4tet  i3iatfa2ulnms () reoxr iatoptran il( s2xoim ny1omtnlfet () Dtmurooo1tet mocild a ran s;t0 lermf to1latrlu sls0texrxo io1am  mnei s)sDuaxmpoo0oltnifetysfm2rm(mo;t0altomr3oy1opDr i i t0sruoxr3oydome mici t aruaurpno1oet  ociadla rlnms;u0aeermo ootfm  lues t  rxoxr3oodam emfetl( aDrmuro;t0aex iietyt s el(vs;(0trtrxo iatopteluvi t0tetoim iydlmeelics sfsrur( pnu4tlt if3iatfs ea( ont4aetrxr oodfmt auvi;( t2umimpiy1ame mfciasfa2tmx ont0opxnmoctysfs ranvo u4trxrmf3tytlp  lu s;t t2um(r3io4lmee nvtl() ruax  ;o4olenif3tlsls2rmump u0texoxf iadoptrai o;t0s2umxr3nu4lmt lnvtl(fa2um( pnt1oex  f3iytfa2rlu onu0 etoxfciytfa  au i;(  euo(o nydomt lnvslt) 2rau pou4open iciatfm2ra(vsn()alxrxr3ootoa elu i;(0sexoxr nodlptnlnct sfs2uaxm nt1teeoio3iat aDem(vs u4 rxnircootfa eanvo (0tetmxr3ou1op  livs tfa2ua( p;o0texnio3iat m2rauvonu0 lxrmrcty1fp  auei s0sexm(r3ny1lmtn ncils)srrmxrpoo1oee mictltlsDuanvsnu4altrmr oo1fm r nvi;(0truoim3oo4ape mnct ()a2ua(ront1tltomfctytlm rm( s;u0arxrio oytlp elivs;s  2toxr oo4optnlfeilsfsrrr( ooo1oee iietysls ranvo t4altomf ta1opD  uvi t t2xoxr3oy1lptnmicsltfsDrauront0oex moctat m2umnmp t0aetoio totoaDrauvilt t2tr(mpoudlpt  feiatfarua(rpou0aptnmfeildfaDemu sn(0texoif oytop   nei s tetmimpno1ll  lfvil()aDtr( o;o1aet iiciat s2ulnvon() rtriocoydfpDelnes t0 rtoxr iu4lpte ivslt s2um(  ;t0alt iieiadfsDemn o ()aexnmrctatlptrlnvs t texrio ny1lptnliesat srrm( pnt0ape  fciyt m2ra( onu4 rtoifcta1oateai s s)trtr(m ny4lltn fetl(  Dtaxro;o1texomociltfa2em(von()trenioctydlmteau o t0tetrxo nydlp emivt sfsrurur nu0oleo oeiltlmDuanvp () lxnir oytopt li o s)texmxopoy1ameemivsat  2rr(m ot0apx  ietytla2ran s t4treoxr totopt auei s  rxo(m3iodol nliet tfs2urx p;u0apenmieilt aDrluvp t4arerio3todfa  lnvs () 2trxm3no4lpe  fcsas)artmx oou0oee mfcildls2rmn snt0teenxo io1oaD aivslt0trurxrpnu1al n ictltfarta( poo0aetn fciltfa2emn pn(4texrio oydlptelu ils0sexo(m3nu1ll e neslt) rtm( p;o1alt mi3iysls eln o t0tlxnmo3iydop e i sls srurio iy1am elics (fs2uauro;o4tlx ioetas m2elnmonu)areoifcootlaDeauei;t0setrxr3iudamenlieils)sDtaxr ;o0tex  ieiytfaDemn p;()trtrio3iadfp rau o ( trxmio3iudapte nvi ()s2urx  nu4tee micilsfa em( pnt) lxnif3iydlptr uvo;t0t2trxo iu1ap  mnei t)a2trx pnt1aexn iciytfs el(vp t4 rerxo3iodfmDeln s;( trtoirpoo4om elfvs t) 2umx pnu1aexn o3iysla2eln pnu)teenmf3oodfmtean i t0s2um(rpoo4op emfcilsf rtm(  no0oexoifcild m2rlnmsnu)trtomfcia1optrlu s;t) rtriopoydlmee ivtl( artaxroot0aptnmfeilt mDel(vs t4 lxnif3oy1fmDean s s0trtoxo3ou1lpe  nct ()a2rrx oot0oet ifcild s ul(mpn(4tetomf oytlmte uvo s0texo(mpno4ll emiei t sDumuro;u1aex  i3tatls2uanvo (0areoio to1laDe uvols)t2to(opoy4amee icilt aDtax o;o0oee io3iysfaDum(vs u)areoif3oodlaDe ueolt0sexm(m3ou1aleeliesas sDum(ro;u4aeenmoctysls em(ms t0 lenxrcta1oaDr u ilt0 eur(r nydlpee ictlt s2uaurp;u0tlx  fetas a elnvo;t0 exrmr oatom eanvo;s0 euoim3ny1om   nvtasf 2tmxrpou4open oeild m ran s t4tetrif oo1fp eln i s)trtmxr nodlle mnei t)s2umxm no1alxnii3iytfs emnvp ()texnxfctatopDrau s s trum(r3ou4ll  mfcsls s2taumo;o1opx iiciasfm raumont0 rtoir3ootlpDelneo s  ruoim3no1apt lictls sDua(r oo1aleomf3iltfa rl(mp t4areoxo to1fa e nvi s)trtmxrpoy1oltnlncilsf rrmxmonu0openii3iatlaDum(msnt0aleoiocia1fate nvo;s  exo(r iu4lptemnvtls s2tmump;o4tleoiieiadlmDum(mp;t)texrmo3oo1optr neol()srtrim3oo1ap n ict t)srtr(mooo1aleoiociyd s2ra(vp u) exomfcoadfmD  nvi;( trxm(m ou1lm nlnesas)aDtm(ro;u1tlxoif3iydfaDraumpnt0 etrmoctodlmtelnvo t0 rurxr3io1optnmnetat a2tmu pou0tex if3iltlmDelumpn()trtomr3iadomtr i s (0s2ur(mpnudol nlnvsls aDrmu  nu4aptn f3iltls umu s (0alxomociydopDean i;s)setmir3iydam nlfei t arurxm nt4tet mf3ildfsDulu pn(4altoxfctodlaD aivilt0 2urim ny1am  mnes t aruaxrpoo0ole  o3tad m rln s (4arxnirciytfpt lu ils0tetmxr3io1optnmivilt)srtruro;t1aetnio3tldlm ulu s;u0trermo3oodlaDeluvolt)trxoiopiodlmenlfei sf 2umump;o4aet ifcildla2ulu s () eenxo iytfpt anvi;s)texrirpnudoltn ivt s  2tau  oo1apxnmf3tyd sDua(monu0texnxo tydfaD ln s;() rto(o3iy4lmeelnet (  rtm(root0apeo f3tasla2elu s (4altnmo tytfmD  i i t t2tmxopno4altemnct () Drmxmo;u4oexn feiaslm2eau s;(4aetoxf3ia1lmt ai s;s)sexrxr3nu4al elfcs (f Dtaumoot1alenii3iydfm eauvp (0 exoio tatfaDrlieil(0t2xr(o3oydopenmicia( srrrumooo0alxoifeiyd m2emnvp;(4 lenio oy1om e iei t  rurxrpiodom n ivt (  Drm( o;t1tptomocilt a eanvo;t)teenxocoodoa e nvols0 euoxm3iu4optnmnctl(fs2um(mpno1apxoifeiyd s ua(mp;t4alerir oatlmtrlnvo;t0tetm(opio4ap nlfcil(f Duaump;u4aeeo fctas aDrmuvp u4arerxrcio1fmDe nvo (0 2to(opnodolenmieiasfarum( p;u1oet  feiyd s um( p;() etomo tytop r ieols0s2xmir ou1lm emiet ()arrr(mpno1opeomo3iltlm ra( ont4 rerif3oadlatrlieo;t texmimpiydlm nliei t) rtaumoou4olx  fetlsfaDua(mon(4aexrif to1oaD lnei s)seurim3oo1openmfctat) Drrx pnt4ole  oeiad m um( p t0arxoifcio1lmtr uvil()t2um(o iudapenmieiat)arrmum ou4tpeoifetlslm2umn o;t)tltrif oa1fmte ieolt srtoxr oodlp emietlt)srtmumooo1oetoiicias s2rluvpnu0areoxo iadlateaivi;t) ruoxr oydoltelnci s)a2uaxm no4ope iieiadlm2em( onu)aeeoir tadlp  lneilt0s2to(opiydap emfeil(fa2tmxrp;o1olx mi3iytfmDrmn s u4arxrxo3oy1oa eauei;(  2to(o3ny1ale mfcia(faDtrumpno0oeto ociysfsDel(mo;(0arxrmfcia1omD  nvols0srtmio3oudlleemiet (f rtmu pnu1tpxnmi3iadlm rlnvs;u) reoio oodlmDeaivol()t2trio3oo4om nmiciatfsDrm(  nt1aex mf3ildlaDuln p (4 rtomrcoy1opD lu i;(0s2ur(opiudlmeemfvta( aDurur ;t0tlxo f3ildla el(vp;u4tltrio tytfpD  ues;s0texrxopio1ap   fcs (f 2rrumont4aeeoifeilt m2eanms ()trtrio3tydlm e nvo;() rxm(r3oodlm  mfvia(faDtaxrpou1tpe mo3tatfsDrmu s t0alxrmo ta1fmDrlu s;()trtrio nu4omtnmnvtat  rraumo;u0oex ioctydfa2uluvon(0texrmr ia1fp rln sls0 etoir iudol  mivt t) rrmurpot4apx  ieias m2uau p (0trerxrctytlp rlnvo;(0 exmiopnu4ome lfviasf Durxroot0tpxoif3iytfs2emn p;t)tltnxrcio1oaDeanei t)srxo(opiy1open icslsf rrm(mont0oet iiciyd a2rl(mp t4 ltrxf3oy1la elies t0t2urir iodol e ncsas)s2trx pot4tetn feiltfaDelu o t)arermo tadlatrln i t)tetm(r3no1olt mfcia(fsrrrurp;u1opx  i3tldfaDraumonu0 rxrmf3oo1lmD  u s s s2tr(o3oudaltnlncta(f rum(mp;u0opt mi3iatls2uanmo;t0tltnxf3iadfa r i s;()trtrio3ou1aptemfcsas) Duaxrpnu0tpen ieiasls2eaums t)aeenxo3oydlmDeau sls  rurxr iydaltnlivsls  2urur ;o0ale moctyt m uanvsn()arxoxo iy1fpDrli s ( teur(opoy4aleelfvsltfs2urur no1oeeo i3tlsfsDeau p;u)aetrxfciy1fmDe n ols s2toimpiu4llenmnvta() rrmurooo0tex  ocildfs emu s;()tltrmrcoy1optrau s (0t2xo(o iodope  fvi () Draxrpou0optomf3tldla2ulu o;t) lermf oytoat  u i;t0t2xriopiydope lneils) 2tmur ;t1aee ioeiydlmDem( sn(4 eeomrcoydfpD  uvilt0s2umxm3nu1lmeemncsl(f 2raxrpot0tetomfetysls2emuvpnu)alxoir io1oaD livsls0srxoir nudopte ietlt)sDum( poo0olt moctlsfmDraumsnu0tlxrxr3oadla   nes;s0 2xrxopoy1lpt  feia(faDtaxm ;t4tleoif3tlsfaDrm(vs;u0aexomf3tydlmt liesls)tetmimpio1lm   fcslsfs2rrumpnt1oexoifetyt s rl( o t) rxoxo ta1laDeauvi;s0 eur(rpnu4om n fvs ()artr( pnt1aet mi3tad s ea( s () leomo3to1opt lu il() rxmim3nu4apt lict ( srraurpou4tpeoif3iadlaDra( p () rxrxrcoa1om rlivsls) rtmio oy4amtn ietlsfarra(m ou4teeo feiysla2ulumsnt0trenxr oodoaDelieo (0 rxoxmpoy4al  mieia()arur(rpnu1aleoiictytlsDea( p t4alxomr iotfaDraiesls0setoxo3io1oltnlfvias s2taxmpou0tlen octys mDrmnmon(4trenif tatlm  lnvs;s0srto(m3oodamt lfvia( aruax pnt0olx micildfsDeaums;u)artrxr oy1faDraivo t  2xrxopiu4lpte ietl(f 2ta(  ou4ale mfeiasfa2umnmp u4 eenxr3tytlp r neolt)s2urir3ny1ope lnvsatfa2tr(  ;u0tetn f3tas s2rluvo t)trtnir ty1la e u i s0s2uoxm oydlleelfctas)s2tm(mo;u0tee  iciatlm rlump;u) rxrmfcia1la r u s ( tetrxr3iydlm  liet (f rumumpot0olxnifetadla ulnvs t0tltoxr3iatlmte u o;t0 etrir3ny4omt  ivi t s2raxmo;t1aptnio3tys m uan s;t0 exnio3iodlmtelivslt tetrxr nudlme licil(  2ua(m ;o4tleomf3tysfm2umnvs u4trxnir3iy1oaDran il()seuoimpio1ap emnetas a2rrurp;t0alen f3tad s2rmnvo (4aexoxf3iadfptrlnes ( s2xrxo3nu4llt mfetls s2rm( o;t1tlx  f3iltfa rm(vpnu0aexomrcty1lm   ies s teum(o iudap emneias a2taump;t1alx mietyd aDelnvp;t4 ltrmf iotlmtraivo t) 2xmim3oydap   fviltf 2uau p;u1apx  i3iasfsDul(mp;(0trtoxfcoa1opDr i o s seurxm nu1lpe mfeiat  rtmum no1oex miciad s emuvpn()artrxr3to1fpt  ies ()t2xo(mpoodamt lnct t  rrmurono1oexomictys aDul( o u0 rxomrctadlmDr neo ()trtr(opoy1om  lfesltfa2uru ono4tltomictlsla2emnvp u4 renxr oo1fpt an i;s  2trio3no4lm elfvs () Dumxr oo4tptomoetytfm el(mpn(4aeeniocoodfaD aivilt0 rxm(r3nudame  ies (farraxm oo4optnifciyslsDumu o () exrifctotomtr ivo;(0s2to(mpoydol nmfvias)s2raur nu0olx  oeiydlaDemu on(4tlxnmo iy1fmDelu o (0sexrxopiy1lp  lnvsa( sDtmxrpno1tlxn oeiltla rln p;u4trtnmr3io1laDe u s t0 2xo(r3iudol  lncsat)arrmumpno0oeeomoctldlmDua(vpn(0tlxniocoatfa eauvi;s)sexmxopiu1oltnmnesl()sDur(mp;u1ale  ociat a em( snu) lenxf totla eanvo;()trtr(o3iy4ap  lnvs s)arrax ooo0altn fciltlm2rmn o;u)aeenmr3tytlptrluvo ( s2tm(o nudaptelivtas)s2tru  ;t0apxomf3ias m ul(mp;t0texrifcoa1faD  uvo t)tetmxo iu1olteliviasfsrraumo;o1tpxo fctad m2rlu o ()aeerxo3iy1fptranei;s)texmxopiy4opeelneia(fsrtax  nu0teto oeiydfaDum(mpn() rtrxfcta1opteaivo t)seurio ny4open iciat  2ur(  nu0tee  feiysfmDrauvonu0aetriociotop ran i;t  rur(o3oydom n icsl(f 2uaxmpoo0apxo ietydfm eanmp t4trenmr3iodlate i o;( t2umxo ny1alte nviat)aDtax  nt1aex mf3iysfmDem( s u)altnxo3oatopDeau o;s0t2tm(r iudlp emnvia( a2tmump;o4tpt  fciatla em(vp (0 etnxo3tadlpDeaieils)sexo(m oo1optemnciltf 2ur(  ;t1tpxomf3tydfaDumnvs ()texnxrcoytoat  nvilt trxr(r oo1lpt lfes s) Dtr( p;o4oexnifciydlaDeln s t)tetriocoodlpDelu il(0 rxoio io4lp   ivt t aruaur oo0apto i3iydla rmumo;u0arxnmrciytlmt auvols teuoxrpoo4olt lncs s a2rruronu4tptomoeiadls2em(mp t4aexoir oadom r nes;t texrxm iu4lpt miesa(f Dur(ronu1tpx ifciadlsDem(mo t4 reoif ty1lpDeln sl() rxm(m3nydolt  ictat)a2rmumpno1olenif3ildfm umu p u)tlermo3tydoptelnvi t) 2xoxo3nu1op  lfci s)aDrruronu0aetnmf3tatfs elnvs;u) etomfcoy1oa eai ols teumir3oodlptnlictat sDrrxm ou4tpx mf3iasfmDemnmp;t4 reomo3ta1fp eau o;t) rxmxo ou1omenlivil( sDtau pno4oexoiieilsfa2rl(mon(4 leoxo tatfpDean o;t  exmiopnydam   fcilt) rum( pnt1tltomoetldls2rln p;u)tetrxr3iadopt ai s;( srtm(m nu4olt mfvsat aDuax p;u4olxnmo3iasfm eln snu)trtoirctotfmDran i s0texriopiu1lmtemiet tfsDrrumont4oeeo ieiadfm2uau o;t) rtrirciotla eanes (0srxmio io1om emicia(fartaur oo1tltnmociysfs ulu on(4tetoxr iodopD  ues;s)t2toxr no4ole mies tf rrr(rono1opxoifciad s uaumont4alxrmrcoo1lpDeau sl()s2ur(o3iudlmen fci s)srrr(ro;o0ale  ieiysfs ul(msnu4 lxrifcia1fat  uvol(0t2toiopno4amt  nci (fsDtm(rp;u4tle mociydlsDrm(mo (4 eerxf3iytfat ai i;s) rxmxrpoo1amtnmnct sf 2rrumpnt4tptomociydfs rmuvp;t4tleomo ty1fatrli o t)truoxopiudal emivsa()sruaum nt0alxo o3tys sDelnmp;(0 eenxociydlm e nei ( trurimpiu1omt  fet s) 2rmur nt4alto fciydls umuvo u4aetnio iatfmt aues s) rtriopoudomeelfvia()aDtmum oo4opt micildfs2emumonu0treoiociatfm r n i s setoxm oy1lltn fvtl( s2rrxr oo1apxoif3iysfs uluvo t)artoxocto1fm r ivs t)s2xrio nu4lltelfei ()sDumx pot4tpx ioetlt s ul(vp;u) rermr3ta1oatr ivi;t teuoir iu1amt mfetlt)a2tmum oo0alxomoeias mDem( o t0 etrifcootlmD ln s s)teumio3oudaptnlncs t)a2umxm ;o4texn feiadls umump (0 renxf oo1lp e ueol()srxoim3oo4llte fvsa()s2ra( pno4apt mieiydls eaumo ()aetnir oo1lp rli ils0srto(m3oo4llt mnvtltfartrxro;t1apenmi3iatlsDrmuvs;(4arenmf iodomDrlieslt  ruo(o3iu1am n iei sf 2raxrpnu1tlen f3iltlaDra(mo ()altnmr iadfmD aues;s sexoimpiodam  lfcils  rurumono1opeoioctls a2em(msnu0aexnmf ia1omt livil( t2ur(m io1oleelietlt srtm(m no1alt miciatlm2rmuvsn()tlenmo tydoa  livi;t srtrio nydalt  nesat  rtru o;t1olenmf3ildfs2ul( snt4 exrmrctatfpDranes;s) eto(o iy4lm elncsa(f 2raxr ot1alt mfcilt s eaums;()treomo3oodoa rlivi s  exmirpno1apt mncs (fsDurumono0tpt ii3tlsfa ean on(4 rxomfcto1opteaivslt) rum(m3iydlpen nvs ()s2rr(rp;u4aeen fetlsfaDra( p u4areomo oodlm rluvs;s0texoxr no1ope lfetl( a2tru o;u0aetniieiadlmDul(monu0 renmf3oatfa  auvils)s2uo(m3iu1amee nvil(fsrur(  ot0aexomfciasfsDel(mpn(4tetnxfciatomtrliei t)t2tmxopoy1opee fetlt arraum ;u0oeenmiciytfm eanms (4 rxoir tadlm  lies;t0t2xoxopoo1lmtn nctl(fsrum(mpnu0tpxnii3ildfm el(vs;t0tltrxr3oydfm r ieolt0teur(mpoy1optn fciltf 2um(rp;u4texomo3iasfaDrmu p;t0arenxr tytfpDelivo;()sruriopio1om emnvt tfsrta( ont0opx iociltfaDrm(mpnu0tlxnxocta1oa raivs s0 rxrimpoudom nmfetls a2ra(rp;o1aexnio3ils m el( s;(0aeenxociotlmD an s t seuo(opoodameemictlsf rrruro;t1ape  feils mDran s;u)texoir3todlm  aiei s setoxm3oy1ol nmnvsls srumxrp;o1alx miciatfaDrauvs (0tetomocoatlat ai o (0 2xm(rpiu4omt lieslsf Dtax o;u4olx  f3iytfsDel( o;(4 eenif3iydfpt  uvi t)sexmio3nu4ome lfeias  rrr(  ;u0tpt  ieiad m2rau snu4aexnmr3oy1lpDe ies ()tetrxr3oy1aleemncs ()sruaumpnu0oltoiiciytlmDuau p t0 renxr oa1latr ueol(  2uoim iu1ll nlnvias)a2um(mpnu4oetniieiadla2rln s;t) lxnio3tytfm eli s () rum(rpno1omtelfvils aDrr( ono1apt  ietytfa elnmo u) exoxr3totfpD lu ol( setm(o3no4lm n ncsl() rrm(m ;o4opxo octys a2uau p;t4arenio ty1fate i i t0tetmxo3nu4altnlnvsa( s2tr( o;o0oeto icilt sDrlnmp;() etrioctatomte u s;t  2to(rpoy1lltnmnet t)a2taur nu1apeomf3ils s2umuvs t)tlenmocto1opD lu ils srxoio oydlmtelivi t)s2umu  ;u0oexoiieiyt a2ulnvo (0altriocoa1lp ran s;s)trtmxrpiy1llenmieia(farta(mpnu4altniiciadlm ra(mo u) rerxocoydomtelnvo ( t2xrxrpiudlm nmnct (faDrr(rono1aleomiciysfa2elnvsnt0tlerxfctadfptr i sl( trumxopnodapt lnvsas)sDururont0aptn icildlaDumn o;()texnifcoy1lmDelnvs ()trtr(r3nydoleelfvilt  Drm(monu0tlxnmfctlt m2raumo;t0trxomf oadlmDelnvo;t)s2ur(rpnodll nlfei () 2rrxmpnu0teeniicilsls elnvon(0texoxrcoo1fp r ivs s teum(r3oudaltnlncslt srtrx p;u1tleniietlsla emnvonu)aeeoir3oodopD lieil(0srtoir ny4lmt  fvslsfaDrrur nt4openmoeiyt a ul( p u) rxnxocty1fm rluvo;t0srur(opoydal n nviatf 2trxm nt0oltomiciasls elu s (4aetrxf iydlp  lnvi t0trxr(m nudlpeemncsat s2um(m nu0teto ieias aDumnmont0 ltniocoadomD  neo;t setmxo3io4ll nlfes ()sDuru o;o4opx ii3taslaDuau s;t4 leoxo3iadfp e ivsl( trto(mpio1optnlfesasfaDtr(r oo0tpx  ietlt sDrl(msnu)trxomrciotoatraieil( sexrxm3ou4lme  icils  2ra(  no1oexoioetlt m umums u0aetnxr3oodlpt au ils) exoxopoydllt mfeias s2rmu oou1opxoiociltlm2emu onu) etnxo3io1lmtr ivilt0 ruo(r ou1omt  fct s)aDrrum nt1oltn fciaslaDrm( on(4aleomf oo1op r nvils)teuoxo iu4alenlfvsat) Dumx p;u0ape moeildls2um( pnt) lenir3ta1fmt au o;s)s2xoio no1am nmiciat a2rmxr no0apt io3iatfmDrmn s u0aexoxf iytfm ran il(0seumim oydlpee nes t arrmx pnu4oeen fcild m rmuvs;u) lxoxo3tytomDe u il(  rtm(rpny1lpt  iesl(f rua(r no1tleniietlsfm rmu o;u4 rtoircoa1la e iei s  2tmiopoo1lm nlfeilsfarurur nt1alt iociadlaDrm(mont0 rermr ta1latranvo;()setoxmpoudlm emietl()aDurumooo1optnif3iytfm2ranvo;t0alermfciy1lmtr i s;t s2urxr oo4op   nctl()a2taxro;o0open oeiyt s umump t0 exrmo iatlmtr n i;s) euoio oy1lleelnctls srrruroou4teeomicilsfs2umumo;t0 rxrir3iy1fatrln o;s) 2toiopiudlmtemncia(fsDtr(monu1tptniietys mDrm(vp;(4aexnmf ia1fa eln s;s0trxmxo3nudoltn nct tf 2tax oou0aexoio3tas m elnms (4 eerxf tydlmDelnesl() rum(o3no1lmeelnet s s2uaum ;u0oexomoeiysfs elump;u4altrxr3iotla e nvs;s  2xo(opno4am emfvslsfsrua(moot1aet io3iyt s eluvo;u0 eenif iydomt  i s;s t2xm(r3ny4lpt mfciat  2uax  nu0oee mo3tysfm umn s t)arenir oy1oaDr neo s seurio3io4optn neslt)a2umxmooo0tpeomieiat a um( o;u)alxnmr3totfa elueo s  rxmim iy1omt lfcias)aDum(ront0tpe  ictlt mDulu s t4 lenio3totfaDrauvs t0 etoimpoy4oltnmietat sDuaxmonu1apt moeild aDuln s t)trerxo ty1fmDe neilt0setr(opoudop nlfeslt)artmxmoou1oltomfetld mDuau p;u0teeoif oa1lmte uei ()srtoxr io4al e ies ()sDrrx  ;o0aeen i3ils mDeln p u0 renxo oa1omt  ueo;s)t2xoxr nodlpt lnvsa( aDtrur nt1aee  ociatlaDrlums u4 lxnmr3iy1oaDeli o (  2uo(r oudlpt lics ()s2uaum ;u1olxnmfeiytfs uau s;u4 rtrxociadfaDeli i;t)teumirpou4alte iet t a2tmu pou4apto ictyt a2eln s;u4teenxocio1fpDelieol( trxriopiu4ale livsa( sDtmx  nt4opxomi3ilsfm2ranvp;t)tlenir3oytoa  li s;s  eumimpoydaltnlnetls sDtrxmo;o4apt ioeilslaDrl(msn(4 exnmr3oodfmDeluei;s)s2trxm oydol e nvt ()aDtrurpot0oex  ietltla ul(mo u4aexomrciy1lpt lieo s)sexo(m3ny4oltelnetl() Dumu  nt4aetnmieild aDrmuvp;t)tlenmocoytoptranvi;t texoxrpiy4apee nvta()artmxrpnu4aexn fcilt m rm(vp u4altrxfcta1lmDraivo t  2umxr3oy1opeelfei s  2rrumpno0apeomoctas a2umnmsnu0aleoxo iydomD  i i ()setrir oydoltemicta( arrmx o;o4aetnii3iaslmDumump u)trtoxr oodlm elueo s0teurir3iy4lmtnmnetls a2tru  ou0tpto octadla2ea(vs ()arxnmr3iadfpD ai sl( setmxm3iydomtelivs tf 2tmx pnu4aptoii3iydfaDuluvo;() lenxo ia1lm eaivs ( s2toim3nu4ole lnctat  rrmu pnu0aex mo3ilslsDean p (0texoxo3oa1lmtrln ilt0srtoir ou4apee ieta(  Drm(ronu0apx  fetadfm2rmuvo;t0 exnxrciodlmt  iei;t) etm(opiodomte fei s)aDrm(mpoo1tlx mociltfs um( snu4alermf iotlm  luvs;s  rtmir3iy4lptemivi t) rraxroot4olx ioetysla emnmp;(4aeerirctydfpt aivi t) eumxr iu4al nmnetls a2raxmo;o4tlt if3ild a2elnvo u4 eeoxr todopDe iei;s0 ruoxmpiudllen ncs s artm(mono0tlxo i3iat aDraumo (4 renxo3iy1fate ivsl(0seuoir nu1ame mfviasfartrxr nu1oleo o3tas s2uan on() leoif3oy1oaD  u ol( teumir3oy1alenlnvta(fartru  ou0tptnioeiasfm2eauvonu0aleomf3ia1op e nvs;(0setmxmpou4omte nvsat sDumxmp;o0tpenio3iatla em(vont)artnmo3oytoateaivo;t0srto(rpnodlmtnmieias  Dtmxrp;o4ape  octat a2eauvs;(0 exrmr tydlmD luvi;s) exmxm nydame  ictltf Duax p;t0tlx mictldfa2umnvs t4 lerif3iotoat an ols s2xmim3iu4op nlicilt)srtm(m nu0apxnmi3ilt s eanvpn()arerir3tadop rliesls  2tr(mpnu1olee fvs ()a2ur( p;t1tptn ociyt a2umu o (0trxrmrciodfm  li sl(0 2umim3nudop nlfct s)aDra(mo;u1oexn fetydls eluvp;t)arxomo ia1fmDr neolt t2uriopoydamte ici sfsDrrx pou1aptnmoeild aDrmumo u0 rtrio oy1fa   nei t srxmimpnu1ap   feta() rta(r ;u1tpenmociltfs umn onu0aeenmr3oy1fp  lues t0t2xmxrpoydale mfcsa(fsrtrurpnt0tpeoifeiltlmDra( p t4 lxrmf3iydlp   n i s tetrxmpny1amenmfvsat arrrx oot0tpeniociad sDuanvp;t)tlxnmr io1lm eai i () rxmimpiy1op n fvsa( a2tm(m nt0tpeomoeiltlmDranvon()aexomr iodlatrlieilt)trxmir oydom emnei sf Durxmoot1opt mo3tatlmDua(mon(4teeoir tatomDrln olt)trtrxr oodamee fvsat sDumump;o4apenii3tat s2ul(vsnu0tetrxfciatoaDrauvs s0 exrxrpoo4lmeemnvtasfaDraxr ou1aex ifeiatlm2um(msnt4tetrxfcto1laD aivi ()sexr(opnydap  mics ( s2ur(m no0tleoio3iysfaDumuvo;u0alxomf tydfateaneolt0srxoio iy4aptnlfci t arrr( ont4tpt mo3iys s2eaumo u4trtrmf3iatlpteaiesls  rtrxo oy1omtnmicsl( sDuru pno4opx  ieilsfa2ranmo;t0artrxo3iotlate ies t)srumxopnodap nmiciat  2urxm ;u0tpt ifcils a2ean onu4artoxf iatoa eaues s  2xm(m3nydlpt mnciat) 2raxm oo1oltn iciad s eln p;(4teerio iy1fa r ivi t)setrxrpoo4ll elici t)artrxrp;u4aptn ieild sDelnmo;u)arermf3ia1omDr iei;t sruoim3ou4olt lncia(  rtrumpot0optn f3ilsfa2eaump t)treomr3tytlpD aueo;t srxrimpoy4oltemnci tf rrmurp;o4oltomfcildls rm(vo ()trtomr tatlmt ai il(0srxr(opoo4omt lnetlt sDtaxr nt1oee ii3ild mDrl( pn(4 rtoxr oodfatelueol( s2um(m ny1ap nmfctat) Dtax p;u0aleoifciasls rlu s u0areomf3tatoatrlivo s0texr(o3nydom n ivi sf 2taur nt0tpeo icilsfm rlnmp t4 etnir oytomDrluvo;t0 2um(opnodapen nvsa( arurxmpno0alxniociat a raumsn(4trxoio iy1oate ieo;s srxm(o iy4om   icsat)sDrr(m nt4olxnmi3tytlsDrmnvpnu)aeenxocoodfateai sls)srxo(r nodoleelivtatf 2tau oot0tpxoif3iat mDraump t0texnmr oodopDrai il() eum(o iy4amt mfvta( srrr(mont0tlenifctldlm elump () rxnmocoadfmD lnvils)teumxrpou4ale lfciat)srrrx  ;o4opx ifetatfa2rmuvo u)alerxo iytlp raneols sexo(m iudlptemiet sfa2ta(r nt0olxoii3iat sDum(monu4teerio ootfat aiei s)tetoxm iodomte feslt  rumuroou4optnifetysfa2umnvo;u4 etnxf3tadopDr ivi;s) exrxr3io4lpenmics tfs2tm(moot1oetn iciys s2rlnvo;u0 reoif3iodfa   i ilt0t2uoxo iodamtnmfctas) Drr(moou0alxniieiydfa2emn o t4teeomrcoadlatrlu ol( setr(o iu4amte nvs tf Drmu ooo1tlxniieiltfa ra( pn(4tleoxociytfptr ivsls0s2tm(m io1lm n neia()s2rr( ont4texnmoeiytfsDulnvs;u4teenmocty1fmD au i;(0t2xo(r3no1ll nlfei sf rumx ono4alxnmfciatfaDrm(mpnu)aetnioctytfptr ues;(0s2trxm3nodomeelivta(  Dumxmont0apenmfeiys s2em(vo;u4trtrmr3iodomteaueslt seum(opiu1open fvi (faDtmu p;t4aeeniociad m rm( o;(0aexrmr to1om e ueo s0trum(o3oo1lmenmfcslt) rurxronu4oexnmfeiytfm2um(ms;() rxnxo3tydlpD  ies ()s2xoxm3iy1ll   neslt) rta(  nt1ole ifetydls2uln on(0trxnxfctatlateli o;s)s2umxopiudllt lfctas  2tru pou0tlxnif3iydlm2eluvpnu0trtnmr totfa r i o t0t2xmio3oo4ame lnvslt) Drm(moou4oleo f3iltfa elnmon() rermo io1lat lueils0texo(mpnu4omt licslt)s2ua(m nt0tetn f3iltfs2uauvsn(0tltnxf iadfat  nei () 2xo(o3iodolenmnctasf 2rr(  nu1apenifeiadfmDranmp t4 etoxf3ty1oatrlnes;() etoxr oodomtn nvta()sDtrx  nu1tee iictyd s2em(vs;(0 rxrio3iodopte i o;s)teumiopny1ll   iesas sDtm(  oo4oetnmoeiydls2ul( s u0aeeomr3iadfptrlies;(0seuoxr3iydlmtn icil( a2rrx pou1tlxoifctld a eaumo (4 exoir3ta1fpDelu ilt0 exmio3oydlpe mies s) 2taump;t0oet ifeild aDrmu p;t0artrmoctotfmt  n ilt) eto(opou1lp   feiasfs2ua(mpot1oeto o3iasfs rm(vs (4tltrmocoytfaDean o s0 2xoxr nu1lp nlfcia( aDta(rp;u1oeto ieiadla2el( p t4tetoio3tadfpteli o;()teurim3iu4op emncsas s2umu  no1aleoioeiytla2ean ont0 exnxr3tydlpt li s t) 2ur(opny4lm emncils sruaum ;u4tex mieiadfs2elumo u)aexoifctotoptrlivols0s2um(rpiodll e fciatfa2tr( ooo0tex mieiydls eln snt0tlerxfciatfa rlnei t  rxoio nu4lmee nvs t  2tm(m oo4apxo ociydlm ua(vo t0teenmocty1la rluvsls sexoir3nu4lpt lfvi t) ruaxmpou0tleomoetlslmDulnmp t4trxrxocoo1fmD lueolt0trxoir ou1lpenlnvtlt)aDtm(r nt4alxn o3iysfs2rl(vp;u0 eenir3ty1lm   ueilt0 rumxr3ny1ap elnct (  2ta( p;u4alen ieiytlm uanmon(0tltoxfcty1laDrln ol()trtrxmpoudape lies t)sDrr(mo;o0oeen iciasls rmnvo;(0aeenxo oydfaDranvo;s  ruoim ny4amt  ieil( a2tm(m ;o4tlt  iciytfmDran s ()aetoxo tytomteln ols0srumxm oy1ap   ivsa( a2ra(m oo0tpxo feilt s eanmonu4 eerirciy1op  lu s s) ruo(o oudom nlnvtasf rrau  ;t1apt ifeiatfm ranvs;t0artnir oa1fmtr u i;(0setrio io4om e iciat srurxr ;o4ale  i3tlslm ra( s (0 lxrmf tydopt ln i;t t2xmim3iu4openmnviatfa2trxrpnt4teeoioetlsla2ea( s () lxrifciotopD an o ( sexrxr3iodalee fvt s) 2urxrp;o4aexoiietys s rauvonu0trenxf3iydfm raieo ()trum(rpiydlpe lnct t srur(m oo4oeeo i3ilt s ulu snt) lerir ta1fp  aueo;()teto(o3oy1aptnmics sf 2rmumoot0tpx io3iys m emnmsnu) renxrctydoptr iei s setoxrpoudoltn fvsasfsrra( ooo0apt iiciasfs um(vp;(0trtomo io1fpDrlieil()srtm(r nudll   icsls sDta(  ot1tpt  oeilslm2emnvonu0 lxoxociydopDeaieol( s2umxr oy1op  mfvs tfsDtrx o;o1tlxoioetadlmDeanvs;(0 rxrxrctotfaD lneils0trtoxmpno1ll  mfvtl(fs2ta( oot1oltnmf3tltlsDuau ont0trxnmf3iydoptr nvo;s) rxmxr3oy4op e ivslsfsrrax  ;o0aee iiciasla2uanmp u) renmo oatfp e uvol(  2umxr iydaltemfetls)s2rmum nt1olxnmociysls2ulumo u4 ltoxfciatfm rluei;t0teuo(o oy1lltnmivilsfs2urxr no1aetoiociaslaDumuvp;t) rxomr3todlatrai i;s0srur(mpiodolen ncsatf rta(mont1optomfeiytfaDulnms;t) rxomf todfa eaivs t)srto(o oy4olte fct ()srurxr oo0aetnif3tatls2um(vpnu4aeerif oatfpD  uei (0t2toxo nu1opeemiesls  ruax p;u1olx  o3iys s rmnvo;(4artomf oa1fp  livs;s)seurir ou1olen
\ No newline at end of file
@@ -0,0 +1 @@
+u ilt) rtrir3iu1om elncs tf rtr(  nt4tex  oetltla2rln o;u4texoxfctatopDranei;s) 2umxm iydap   iesltf rtmxmoou4ope mociysfm ran p;u4aeenxocoydlaDrluvi (  eurxr3oydameemncs sfartaxr oo1tlx  iciadls2um(mo;t) ltomf tadoat li i s0t2tmxrpno1lpt lics tfaDua(mp;t1openmfetysfaDraumo t0trxoifcto1lp eai o;s  eumirpiy4op  mfcsl(  rum(root0aexoifeiydls2uln o ()altrir3ootoaDe ivilt)trum(m oy1llenlicsl( aDtau poo4tltomf3ias mDel(mp u0trxnxr todfmD lnvo ( seuoxopio4lm e ies sfartr(m nt4opxomfctadfa elu s t)teeoir3ta1omte ueo s)t2xo(m3oy1alenmnesatf Drr(  oo4oex  fciyd s2ulnvp t4artrio totlaDeaueo s0 rtmir3nudamtnlnesltfs2uau pou1aexo ieiydfmDel( s t)texrifcootop e nvo (0tetr(mpoy1lleelnetlt) 2taxmont4tle  o3iadla2uanmp;u0 rxnio3iytlatrluei t0trtrxm oy1lmeelnetas  rrm(rpnu4alx  iciatls rmumo u0tlxrio iodopD  ivo;t  exmim3nydap n fct tfs2tru  no4tlxnmfeildls el(ms;t0artrmrctadom raivi () rtrxr no1optn neiatfa2um(  nu1oetoioctatlsDraums u)alxnifcto1fa rlu il(0seuoim oo4lpeelietls srrrurpnt0tlxn oeils mDemuvp t)tlxomf3oydoa elneo;s  rxoio oo4alte iesa(faDrrxmp;o4oltomo3iad mDul( on(4trxomoctytlpDeaneo t0 eur(o ny1alee fcs s  Dtrumo;t0optnmociat s2rmums;u0tetrxr3oy1laDeanvils setm(r3oy1amee nvsa() 2tm(ronu0aptnmociytfs2uan p;u4teenir3oodlmD aneils)seumir oy1omtelfvt s) 2raumpnu1opeomoctlsfaDrau s t4 rtrmfcia1lpDeliei (0srxoio3iodolt  iviasfsDuau  ;t1apto o3tls sDumnms;u0 rxrxr iytfptrli s;t)t2umiopnu4ope mfcs sfaDum(rpnt1tpt  o3ils s eau p (0aeenioctydlm e n sl(0trxm(o no4amtnlfct s sDtmu o;u4tpen iciydfs2rluvo;t0 eeoif totlaD li sls) etm(r oydllt  iei tfsrua(rpnt0opx  fetytls rmn p t0tetnxfcoydoaDean sls0srtoxr3io4llen ncilt)s2ra(m nt0aeenmfctydlm ulnvo (0tltnxo ia1fp  lnes s seuo(o iu1ame  nctl()sDta(rooo1tlt  iciyt m emn p u0aetnif3oadlmDe ieols  eum(opoodameemfctl(farurxm no4tee ifcilsfsDum(mo;u0texnmf todoate n o s0 exr(r no4llt mieils a2tr( poo0alx mo3tyt sDulumpn(4trerxf3iytomtraies t trumxmpnydom n feias) Drmu ont4oleoiietld s2elnmp t4alenmo ty1fpt  ivo s)srxoxmpoy4op nmici ()a2urur ;o0aex  oeiltfsDrm( s;u)artnxrcoytfmt an i;s) 2xmxr no1omt  nviat sDum(ro;t4texo i3tadlm2uauvo u0 ltnxo iodfaDelneil(0 etrim3ny4ol  lfci (f 2raxr ot4opeoifetyt s2umnmo;(0artrxo3ty1lpte u s (0trtr(mpiy1lptelnetlsfarraxm ;o1aetnmo3ias sDelnvp u0 etnxo oadfm  ai i (0 2xrxr3nodap nliei (f 2raxro;u1aee  o3tyd mDea(vp;t) renxo3tatfmtrau s t srtoxo3oodlpt mfctas  Dtmumpoo0opxnio3ias a emumo;u4altomociy1fpDrli ols0seto(mpoo1lmtnlnvslt sDrax pno4ale  o3iyt s2elu p;(4trtnmo3tytom e n o t) 2xrir ny4ll  liesa(  rrau onu0ope mietls a rm(vpnu0aetoxr io1omtr ieils0sexoiopiydam e nvil()sruaxro;t1tltnmietydfm2ulnvsn(4 exnmo3ia1fa r ies;s0sexrirpno4lm   fcsa( a2tau  ou0apeoifeiadfs2emnvs t4trxrmrcio1fa r n o;s0 2trim3ny1ape lfct tf Dtmx pou4tpe moctas s umump u)arxrir ty1oateli i;t s2uo(r3iu4lptnmfvi sfs2rrx  nt0alx ioctyslmDrl(msnt4aeeoxo3oatlm eluvsl() 2xrir3nudapt  ncsa(  Dtmxmp;u0tleo i3iyt s rmumsn(0arerxfcootomD  ueils0srtrir3ny1lm elnctls  rtru  oo0texn icilt a uan p u0tetomo3oa1fatran il()t2toimpnodol elict tf 2rruroou1tpx ii3tls a2ulums;t)texomoctytomtrlu sl() exmxo nu4op  mivsa(fsrtaxmonu0aexoioctyt sDumnvo;u4 etoxo3oadlp r neols0setm(rpnodomtnmiei ()sDrrum ;o0optn iciatls emnvpn(4alxoif3ty1faDe i s;t trxoirpny1am emnesl(fsrrrxm ot4tle  fciysfm2rmnvs;(4trxoifciatlmDr ieo s)s2uoio oy4alenmfvs s)sDra( onu1tex mf3tlsfaDea( p u0tlxnio iatfp eanvslt)tetmxo oo4ap   ncta(fsruax p;u0ale  fciysls2uan s;t4trxrxf3oy1fmDrluvi;(0sruoim oo1aptnmfctas  Drmxmono0aet  ieildfa rmnvsnu4 exoirciotlaD aneo t0 etriopoodom  lfeta(f rtaxr no4oexnmieilt mDeln sn(0 etoxociytomtrau i;t s2tmimpiu1lp  mnci t)aDtru pot1tleomfciysfa el(vs;u)tlxnif ia1fa e i o (  2toio ou4al n ivi tfsDtaxm no0oltomociys a rmnvp (4 ltrio tytopDrln s s0 2to(m3nu4altelnvilt srtaxm ;o4olt mfcildfaDulumonu0 rxrxr3ootfaD luei;s) rtriopnu1lp  licilt aDurur no4opxo fciaslmDeluvp;u4aeerif iotoptr neol( s2xrxrpiodaltn net tfa2tmum oo1alxn i3tldls2uluvp;t)aetnir oytomDe ues;t)tetr(o3ou1lm   nvsls)sDrru oou0tlxnmfctltfmDrm( o (0trxrio iydfpD lneo t srxoxr nu4opt lfvsltfsDta( pou4tptn f3tldfm2ul(mp u0tleoir iydlatelivi s0 2xmirpou1lltemnvt t s2trxrp;o0oex  f3iltfm umn p;t) ltoir iy1lp  aieilt)t2uo(o nu4altn iet s) Dtm(m no0opxnmi3iys aDumn ont0altoxf oytlatean s s) 2xmxo3nodapenmnesltfaDumxrp;t1olx if3iasfs rlu o t)altnif iytoaDranvsl(0texoxo no1lmtelncs s  rtr( ono1tpxn oeildls um( onu4arxrxf3oa1lm  anes t texoirpnydam  mfesl(farra(r ;t0olenmf3iasfm2em(mo;(4tltriocoydlmDrlneol(  eur(rpoy4amen nvt s)arrmurpou4tlt mfeiyslsDrm(msnu)tleoxo3tadlm rlivi t)s2xmirpnodomtelnetlt) ruax pnu4tpt iieiytfa2uanvp u0treoxo3oy1lm elies;s0s2ur(opny1lpe  nvilsfaruax pnu1aexomiciasls emu p u)altrio3ta1oa rai o;(0texr(rpoodllt  fet sfsrtmuronu0altomfeiyt sDuluvont0 ltnmr3totlpt au il(0 2urxrpnodopte fetltfa2truronu1olxomi3iysfm rlumo;u0aexoxf iydlatrln sls s2xr(rpio1amenlfes s)sDurx  ;t4tlenmfciatlmDulu o;(0arenxf iadoaDelivsls tetmxrpnodlp nlncsat sDrrur nu1apeomiciytfa2uaump t4 eenifciodfmt  ivils)s2uoxm3oo1lpt  iei sfs2ta( pnt4tpe  i3iytfaDel(msnu0trtnio3tadfa e ieol() rxmxo3iydam n ictlsfsDtmx o;t0opeo i3tydfa2el(ms;(0aeerxf3oytom e ueils  exm(opoodapeelneta(fsDuaumpnt0tptnmf3iat m2ra( p (0areoxo3iatomtrai ols tetoxmpoy4lpen iet s)a2tmxrono1texnifctltfa eln p u)arxnxrciy1fm  an o s0 etr(opnu1opt micslt srrax p;t0tleoiieildlm rau p;t0tltnmo ia1lptrlnes;s seuo(rpoy1omeeliesatfs2rrum ot1aex io3ilsfs2umnmo (0aeerxf ia1fmD  i o s teurim3oo1al n ici t) Dtax  ou4oltnioeiatfs um(ms t4tleoxoctytoaDr n s s  2xrim iu1aptemnci sfa2ua( o;u1teenmiciatls umnms;u0tltrio3iodomte uesls0s2xrir oy1optemfetls) 2raxr oo0oex ioctadlsDeau s;t0artoxrctadlmD  nvo;t tetoxopou4lpeelnvsatfaDuau pnu0olx  f3ildla el( p ()artrif ta1la raieo;s0 etrirpiudolt lnvsltf rtrxr ;u4aee  f3iat aDranvs t) rtnmrctadfaDrli s s0sexmio nodaltnmnci s srurxrp;u0apxnifciadlm em( on(4trtoir3iytomDrluvi t s2xr(o3oy4amt lnctat arurx o;u4ope if3tat m umums;()areoxf oodfp elivils)tetr(m oo1olen feia(f Draurpnt0oetoifcias m2emnvp;()aeerioctydlptr n il( t2urirpiudape mnesat) 2trump;o4aeeomieilsfsDra( s;u) lxnio tatfa raueilt) eumim oudllenmnesl(f Durx pot4apxomocilsfs2el(mp;t) exnxo3totla rluvs;t0seur(o iudap   nctl( arurxmo;o0tex  ictld s ean ont0aexoxociatla  aieo;t sruo(mpiudapeelfvt (f 2raumpou0apen octlt s2uanvo u)teenif3ootoa elieolt0trxrxr3iydol nlnesas sruaxrpnu4tee moeiatfm2el(mpn()aeeoxr tatom  lu i s)s2xm(o3iodap emnet s) rtmump;o4olxo oetatfm2eau s;u0aetnmf3oydfpteln sl()teum(m oodapt  fvslt) 2rmx  ot0ape  icias sDean snu) exrxf3iodfa  luvi t0seuo(m3ny1llt mnctlsfsrra(rp;o4teto ictys sDea(mont) lxrifciadom eai i;s teumir3iodlpeelictltfa2rmxmoot4apxo ociysfsDrm(ms;(0aeerio3iodfa  lueils0teumim3nodoleemnvils s2um(r ;o1apeoii3tltfm2el(mp (0trxrmfciodfp eaieo ()srxm(r3io1ale lfcilsf 2ur(mp;t0teenii3iydfmDemums t0altrmr tadop eau s;s seurxm nydlme mnvt sf 2ua(rp;u1olen fcias m ua(vsn(0trtoxo3oodopt livo t)t2trxm oudal emnetat s2rmu p;t1alx  oeiltfm eanmon(0 etrxr to1oat ai i s t2tmim nodlmte nes s)arrrxro;t1alt ifctadla2elu snu) rermf todfat li o;t0srtrim3nu4optemietat)arumxmpot1aexo oetyd a uluvo t0 reomoctatlm eauvo ( trtoxr nu1al e ietatf rraxm oo4olt  oeiysfa uln o;(0 ltrxrciodlmD aueo;(  eur(m ny4amtn nvta(fsDumuro;u4tleomietas a eaumo ()trtriociatlatraues s)t2to(rpiy1opt liei ( aDtmxm ;u1olxomfeiyd m rau s;(0aetnirciytomt aueo;()t2xo(opou1lmtelfetl(f rtr( o;u1oexomoctaslsDranvsnu0areoio totlaD  nei s) 2tmxmpiy4lm  mnetls) rra( pou4oexn fctydfa ulnvs;u0arxomr ia1lpte uvs;( seuo(opoudaptemnesas  2ua(mp;o4oexnmo3iytls emnvpnt0 eeoirctodomtrlueo;( s2xmxo ou1ameelieils  2uaxr ;t0tltnmiciatfa ua(ms;(0aleoircia1lmDe i s t0sruoirpnu1lptelnci ( arrrx ono4tleomietyd sDel(mo (0trenxr iodoaDr u s;(0s2trxmpou1alt mnet t)a2taxr ou4opto ietas s em( p u)teenxr oadfa rluvi;t  etrxr iy1op nlfcsltfarrrumpou1opxo oeiatls2ra(monu0 exoif oytfp   nvsls  2urxo oydolenmnvt t) 2rm( ono1olxn f3iydla emumsnu4 lxomociatlptrau o (0 rtrio io4apt mivtlt s2rrxmono1teenif3tlslmDrmumo u0texomf iotfmteaues (0 rtm(r oo4am elivi tfsDur( pou4opxoifctyt sDul(mo;()texrmr3oodfpDrlueils) rumxr3no1lleeliviltf rtmumpot4oetnmo3ildfa el(mpnu4tetriocto1op  luvi;(0truoimpnu4alenliet () rur(  oo1tleoif3tlt a emnvsnt0texoif oodfaDrli o;s0teuoim3io1lmteliciat)aDrru p;o1optoio3iadla2emumo t0alxrif3iy1fmD luesl(0t2urxo3no4lp e nciat  2rau oou0oeenmfciat sDulnvp ()trxoir3totlmt luvsl(  2uoir no4amtn feiat) rrauro;u4aexn fciat aDumu s (4 etoif3iatfa   i o;() ruoxm3no4lpenmivs ()s2urxrono1tpenif3iyd s2ul(mo t4alxnio3iy1omtraieolt0srxm(rpiydale mictasfsrrr(  nt4tetn feilt m2elu o t4alxrmrcoy1lmtrai s s) rtmxm3iy1open icsltfsDra(ronu1olxomietls sDel(ms;t0 lxoio todlpteluvo t0srto(r iy1lmte ieiasfa2ta( pou1apt ifcilslm2elumo;u0 lxnxf3to1faDrlueo;s0seuoio oo4lm nmfvsas) ruax oou4opt  f3iysfs2rl(vs;u4alxrir3iytlatean ilt)s2xrxopnu4lpeelnctlt)sDrauro;u0oexnmi3iad m eanms;u4tlxrxo to1laDeaivi ()t2uo(m oodole  fcils) 2rmxrp;t4apxomf3tltfa umuvs t)aetomr3ootoatrlnvo t srtoxo oydomtnlfvia(farum(m nt4oexomi3taslsDrm(mp (0tlenirciydfa rlneo;(0 rumim3iodlp emivtls) Drau poo0oexn ieiad a eauvsn(4 eenio3iy1optelnvs;s)trtmxm3oy4ap  mfesl(  2tmxrpoo4alt ioetytfa2rmnmp;()trtomf iodoa e ues s)srtmxopiydop n nctltfs2rau pnt1tpxn feiys a rmnmpn(0 exrif totopte ivs s)t2xoxm3iu4omtnmici s)arra(root4tpxo i3tydfs ea( p;u)trenmo todfa r u s t0 2trio3ou4amtnmnci tf 2rrum ou1alxnmfetltls rmuvo u4 renmrcootla rau ilt s2toxo3nu1lme  ics t)aDua(rpnu1tet ioeiatls2rm(vonu)aeerio ty1lat  u o;s0tetr(rpno4op   nvt sfaDtr(mpou4altoif3iysls2emuvsnu4 eenxocoytoptelnei s)s2to(m3oo4lp n ivtat) ruaump;t4tlto ieildfs ul(mp u4trxrxfctatfptelieo ()sexm(m oudomen ictltfarrmxmont1tetomietytlmDrm(msnt4 rtnxr totom elnei t0 eumxr iu4ap  mfcs ( a2rrxmo;u1oex mi3iysfm rmnmp;t0alxnxfctytfmtrluvi;t) 2umxo no4ol emfctatfa2tmx p;u1tex  i3tadla eaumo;t4tetrmo3tatfpDe ues (0trurxrpiu4lptelietat) 2rmumpnu4ale  o3tadfs2uluvon(0alxomrciodomtraieslt  rur(o3iydlpen nctat  2ta(mpot1tpxn oeiys a emn pnt)tlxriocta1lp raies;t)texrxmpno4lle mietas aDurumoot4tpx  o3iad s uanvpnt0tltnmo3oodom eaiesls s2to(m io4optnlfct sfartrum ou4ope mfciat s2eauvs u)tlxrxf3io1lat  nesls)seur(r ou1op elfci t)a2tmx o;o1tpenmfeiyd a2ul(vo;u)aetoiocty1lmDr nvs s0srumio no4ale  fvi tfs2tr(m no4oltomo3iltfa elnmo;t) ltoio3iotlp elueilt) 2uoxmpiudlpenlicsl(fsDuaxm ;u1aexo feildls2el(vo;t4trxrxrcoodlpt an i t) 2urxrpoo4om   nciatf rtrxrpot0apeo i3iad mDelu o;u)texnxo oatlptr uvolt0setoim3oydopenmnei (fsrtaum nu4aeen o3iys s ea(vo;u0aeerxf tatoaDelu o;(0 rtrxm oo1lm nmfcilsfaDtr(ront0tpe mieiys a2uanmont)alenifcta1lp  luvi s) etrio3iy1optnmfvs t s2rruronu1apeoii3iydfsDrlums;u0 lxnmr iydopDr i o;(0t2xmimpnodoltnlivt sfaDrmxront4olx mfciyt a rmnvsn()tlxrif3todfmtelnvo t  rto(r iy4lm nmncta(f 2tax  ;u0altomfeiyd m eanmpn(4 lxrirciodlm  livil(0 rxr(m3oy4optelfvtlt  rrrx o;o4alx  ieild a umn p;t0arenmfcoo1oa eanei;t s2to(mpnu4lm elfci (  rtm(  oo1oeen f3iltla2eau pnu0aleoxo io1lat  nesl()truoxrpoy1am emici () rtm(  ;t1apenmi3ils s2rlu s;t4treoifctytlmDean o;(0trum(o3oydolt mivsltf 2rru pnu1ale  o3taslsDuauvs;t)tltoxo3oatlp e neol() etmir3oodalee fvs t)s2uaurooo4aleomo3iyt s uln p;u4altnxo3ia1op r ueilt0texr(opnodlmee ncslsf 2ua( o;t4aetoiictadla2em(vp u0aeermf3tytlmte uvsl(0 euoxm iy1ol e nvil( aDrmxmo;u1opeo oeiyt s ea(ms u0 eenmrcty1omtrln s t0texoxopoy4ale lictl()a2urumpnt4olx  ociadlm eauvsn()texrir iytfatrlivols  rtrimpiu4opteliei tfaDta(m ;t4tltomi3iyslsDuanvo;u0 renxo3iytomtrluei s)srtmirpnudal  lietl(fs2uauro;u4oee iieils sDrmnvs (4teenxo oytfpD aivi (0srxr(r3nu4lp  mfei s)srra( pno4opxnmiciasfmDrlnvo t)tlxnmrciatfa  auei t0 rurxm iodlpt mietls srrmxmp;u4apx micilsfmDumu p (4tleomociatomDranvs (  2toxopio1op  mivi s)srtmurpoo4alxomi3iytfmDemnvs;u0treoxo iydfmDraivols seurxm nu1oltn ictlt a2rr(  ot1alx mieilsla2rmuvo (0 rtrxf oo1oa eanvolt  rumir ny1ap emfet sfsrrr(rpou0aeenii3tadfm2umn pnu0 rtnmf3oo1oaD anvi;(0 rtm(r nu4llt mfvsa(  rrmxroot4apx ioeils mDumumpnu0treomr3tytfaD  i o;t srurxm3ny1opt miesatf rtmumooo0tee ioctasla2umumpnu0aetnmf3ia1lptranvo;t srumxr oodapeelivtlt)a2rrur no1altn oeiasfm ea( pnt)artnxfcoytomDeaneil( s2tr(o iy4omtnlfvi t  Dta(r ;u4aex mictldfm2rmu o;t)aetoio oadoptrlivs;(0 rtrxm3iydapeelfctls) 2tau  ou4tetn octytfmDemumsnt0aexnifciytfp rlu i ()sruoiopno4lmt mfvsasf 2uaxmooo0tpx io3tat a ulnmp;t)alxoxo iodfatrau o;(0trxoxo iudol nliviat  Dtaxro;t0altomicildfsDum(msnu)artoio3tatoaDr n i s0 2toxo3nudll  lnct t sDrru ooo4tex moetltlaDuanvs;(0treniocty1omD aivo;s0srtm(o3oydom  lnes (fs2urumoot4ale iiciytfa ulu ont0altnio oydomt lu i;( s2xmxmpnu1ll  mnctas)s2tru oou0oexnioetydfaDel(ms (4trxnxr oadfmD aueil()t2tmxmpoydam emnctl() 2uaur no0tlxomoetysfm2uln snt0altnmo tatoate ieo t s2uoxo3io4ap  lnctl(fsDur( poo1oexn i3iltlmDrluvo (0tetrxf3tydla e ivslt  rtmxrpio4al   nvslt)a2trxmont4oeto feiytlaDranvon()arxrmoctytfmteaieols s2xrxo3iodamtnmncsl(f rra(  oo4ape  f3iysla2ean pn(0aexomr iytomteli o;t0teuo(opiudame mfcs s aDua(rpot1tetoiociysla2ulumsnu)tleoifctatlatr nei t setmirpiy4lle lfct (f 2rmxrpnt4olxomfeiadfm ua(vp (4 rtomr totom r n i t s2umiopiydaltelnvta(f rur( ont4apt moeiatfm2um(vpn(4 lxnmociotfaD auvi (0 rxm(o3iy4apen feslt) Drau pnt4oexn oetys aDeauvp () lenir3io1fpDranesl()trum(o nu4al  mfei s)srumx o;u0tleomf3ilsfmDumn p;u) lxoio oa1late nvols)s2toiopiy1lpeelfetas)sDtrxmpno1aex mieiytls uan p u0 exoxf3ootom e nvsls teur(m3iydopt mfes t)a2tmu o;u4apx  o3iad s ua(vo () etnifcto1latelues;t)trtoxo3oo1llte nvi sfsrtmur ;o4alxnmf3ils mDuau s ()arxomfciatfa   n s;t0srtm(rpiy4oltn fvta()s2ua(rono0aex mf3iatfs2emums t0 rxnmo oodfmt an ils0s2um(o no1lle miviltfs2uaur ;o1tpxnifeiltlm2uanvo;(4 exrxf io1opDeaivsl(0texr(rpny4al eliesas)arrr(rpno1tee moeildfmDrmnvs (0texrif iotlmD auvols)s2tr(r3oodop elicslsfsrumumo;o1texn ietydfmDum( s;t)altoif3iodfa r n ol(0texoim nodll elncil(fs2rrxroou0tetnif3tytls ulnmo;u) exomfciodlaDe ueslt) 2xm(opno1apeemici sf Drmuro;o1altn f3iasfa eanms;u)texnifctodlpDe ivolt)s2urimpiy1opeemictlsf Durxm ;u0oet  octlsla2ra( o;u4arxoir oo1oaDrln o;s)s2xmxm oo4oltn net t) 2tauro;t1olxomfeiytlaDel(monu0tetoxr iodoa raiesl(0t2uo(mpny4lpenmnetl( aDrrumpou4oltoiieiyd s rlnvp ()teeoxrcoadoate neils0 rxoiopou4lpeemicslt aDururp;t0teeoioeilsfsDelums;u0 rermr3iadlmD aiei;s0srtmirpny1ame  fcs sf 2uaumpot4tleo fetasfa uaumpnu0texrmo3iodomt aieil(0s2xrim3oo4amtn nvt t s2rrurpnu0olenmo3iytlaDulnvs t) rxnmfciytoat luvol( trumiopou4opeelivsas aDumu ono1aetn fciltlm elnmp (0aleoxo oodoa  ln o s  rtrim3ou4omtnlnvtltfs2tmurooo0tpeomfctytfs2ulumonu) exniocoadom e u i ()sexrxo3nu1olee fctlsfarta(m oo4texn iciadfaDemu s;u)aeeoxr iydfa rlnvs s) 2toim3oydame mfeilt) 2tr(  nu1ole ifcilt m2rln o;t4tlxrmo todfa eai i t0srtmxopny4amtelncs ()sDra(m ;o4oex  ieiasfaDuanmo u) exoir io1lp eauvsls)s2xoxm3io4ole lfctl(  2um(mooo0oee  oeildlm2rmn o;t)trerxo iy1omteliesl(0 eumxr ny1lme livi t) Dtau oou4texomietysla2emumont)aleoir3ootoa r nei;( sexo(opou4ap e fcia( sDta(r no0apenioetlslaDea(vo;(0aeerir tatop e ueol(0trtmxr oo1optelfcs tf Dumx pnu0aptomo3iydfm2rm( p t)teeoif3iydfatr n s;s texoir3iy4ameelivi (  2ta(rpot0opeo f3tydlaDulnms;u4aetrmf3iodfpteln o;(0 etrxmpou4op nlfci s  Dtax  nu1apeoiociasfa2uanmo u4 exnxf iadfa   u s;(  euoirpiy4lltemncsltfarrmxr ;o4tpxnioeiadla2ra(vp () etoif3iodoaD  uvi;()srto(rpoy4om  lnctas  rrrxm nu0oeenmoctas a2ua( pnu0 reoxrcty1fpD an s t) 2toxr nu4lpeemfci t) 2ua(  nu0teeniieiadla umnmp;t4aexoxfciatfptran i;s0texmxmpou1olen nvsas) Durxronu0tlt  ieiydfa raumo u4 ltrmf iadfatelueols) rtrim3iy4llt mnvi ()s2um(r ;u0aee ifctysfs ran p u)arermr tytlpD  ueols t2xo(rpoydap e ietlsfs2urx  ot1apt miciat aDrlumo;t)altrio iy1omte nvs;()setrxm3oo4lm n nci s)a2ua(mpou1oet  octls sDel(mo ()tleoxfcia1lmD lnvo (  rtm(o3nu4ap nmietl()s2ur(mo;t0oltnmoeiysls2ran s;(0arxrxf oy1lmtr nvi t0seuo(r ou1amt mncs ( s2tmurpno1ope moetatlsDuan snu0artrmr3iytfp eaueils)srtoio ou1omtnmnei s artaxmonu0texo o3tltfm ranvs () rxnmf totla e n o (  rtrio3iy4apeemicia(f rrru  ot0open octydlm2ea(ms;t) eenxo3to1lpt aueil(0 2to(o3oo4llte nci (fsrrrx poo4aexo f3ilslm ua(vs;(4teerir to1lmt  neilt0 rtrxo nydlle mnvsls artmu pnt4teto ieiadlmDemnmsnt)alxoir3tatomD  i olt0tetrxm3iu1al nlfcta()aDra(r oo4tlxnmietydlm elnmpn(0trxrxfctydoaDrauvi;s0srxmxrpnudllt  nvsls)sDum(moot4oexn octaslsDranmonu)aexnxrcio1lp   n o s)trxoxrpou1lp  mnvi t a2ur(r ot4tpt  ieiysfm emnmp;u)treoxoctytlp   ies s0 2uo(rpno1ameelici t) 2ur(ront1oex mfeiyt aDeaumon()aeeoir iatoptr n sls0t2xo(o nu4lm   nvilt)artm( ono0openioetys m eauvsn(4 eeoxrctadfaDr ivsl(0 etmxmpoy4lp  liesls)s2um(mo;t0alxo ociyt s2rm(mo u) exnio3ootlmD aies;(0trxo(r3iu4llt mfcsa( a2rmx pnt4ole if3tldls umn sn(0altnmfcoy1oa r neslt0truoxm3nodapenmict ( arurxr no4aee mociysfs2ulums ()tetrif3ta1lm r u sl()teum(mpiu1alee feiat aDraxr ;u0apx  iciadfm um( s;(0 lxrxf iydom r ies t) rxo(o3nu1lme mivsa(fsDraur nu0tpe mf3tadls2emn s t)texrif oytfp r neo;t0 2tmxrpoy4opee ici s s2urx oot4alenifetyd s2ran s (4aeeoxociadoaD auei;s)t2tmirpnu4ll nmivtas artm(m ;u1texo iciadfm ea( p;t) rerif tydfaDrauei t  2xoim oo1oltnlfctas)s2umx o;o4opxo fcilsls umn sn(4treoxr3ta1fpDrlieols) etrim oudape lfei ( aruaxmp;o4aexomietasfaDul(vp (4 rtoxocty1fmDr ivs (0tetm(m3no1lp  lfesa()aDrr( ono1teeoifeilt m elu sn()trxrxrciy1om rluvo;s)teuoxrpoo4alte iesa(f Duaurooo4ole  ocildlm ranmsnu0texoxrcio1latr ivo;s teum(o ny4al  mnviat)sDtrur oo0ope iietltls elnmpnt)aleoifciatlate i s s)seuoim3iy1amt  ivsas aDtm(m no1tlxnmoctydfa ran pn() lerir3iodopte uvo s0 rxr(m3io4aleemncs (fsDtr(mpou4oexo ieildla umnvpnt0tetrmo io1lm r ieo;s srxo(m3iy4lme lfet sfa2rax p;t4opx mi3ild a umump t4texomf3oy1fmDraneo s0sruo(o io1amt lfcs tf rtaum ;t0ape  ociad a ra( p t4 rtomo3tytlp rauvols0srtm(o oo4olen fvsas arumx ont0apt  i3tlsla2emn snu)trtoxr3oadfa rlivs t srxoim no4lptemnet (f 2umxr ;u1tpeoiiciyt aDraumsnu4tetrmf3ootoaDraivi;s0 2umirpnodlltelfeia( s2ur(m ;o1apt moetyslm uauvs;u)trenio3to1lptr nvil(  rtoxr3oy4op nlfvsat)srraxmono0tpxnmf3iydfm2um(vpnu0altomociatfa  auvo;t)truoir oy1llt  fvtlt) rra( onu4olxomfetasfa2rm(mo ()alenir3oo1fmDran i t0 euo(m no1lltnlfes s  rtau  ;t1ale mi3tltls2ua( o t0 etoir3todopDe u o s) eumxo nudale  ieil( srumxro;o1apxnifctadlm rlnvs t4 reomoctatlmD livs t trxrxmpiu4ape  fcias)a2umuro;u0tpxoif3tasfsDrln s (0texomr3ty1la rlivol(  2toxo iy4openmnei s)arrr(m oo1ole mfetyd s2ranmonu) rtrmo3todlm eauvi s0s2urim3oydalte nes tfartmu  oo0apx mfeildfmDemnms;(0aexomrcootfa   i o;(0 euoxo3io4op nmfeilt)a2rru oou1aetomf3ildls2em(vpnu)tetnxr3iatfm e uvsl(0 2xr(m3nodapteliei tf Drru pno0olenmoetadlaDul(vo u)tlxnmr3ia1lat  nes;t t2umxo oo4lm nlneia( sDrax  ot4olxn fctytla2rm( o t4teenxo3ty1la eaivsls)texoiopiudlp emfct (fa2ururo;t0alxniieiysls2rlnmp t)trxoxr iodlmD lnvsls) rto(mpoy4al elnvils aDuaxrooo4apt  o3ias aDrl(mp (0 etrmo oodlp elu s;(  exmirpoy4ol  lfci t)a2umxro;u0oeenii3iydls umn p;u)aleoir tatlmDe iei;(0srtrxo iu1lm emnesls)srtaxrp;u0tpenmfcildls ulump;(4 exnif totfp rau s;()seto(m no1am n fes (f rrrxm ou1alen f3tytfm umn o (0tltrifciytlpteanvs s  rtmir3no4altnlfvsls s2umumont4aexo fctytlaDum( snu4texoxo oydoate uvo t0 exrim3nydopt  netasf rtmuro;t4aeeo fetat m ulnmo t0 lxoxoctydom eau i s0teumio oodamen feilsfarrax o;t1oexnii3tasfsDrl(mo;u) rtriocoadlmt livs;( teto(opoodaleemfciat sDumx ono1tlx  oeiat s2rluvs;(4teeomf oodlatr ivi;( teumio3iydomte nvil() rtm( o;o0olxomoetytfmDrm(vs;t)tetoxf3iodfm e ueo t)sexmim ny1om nmfcslt)aDrrx ooo1apeomf3iyt mDelnvs;u4 eerio3to1op raueols seuoxmpiu1lp   feta(  rtaxrpot1tetnmo3iltlsDul( o () lermf oy1oa r ivs t setoim3oy1ll elict s srurxrpno4oltnioeiltls um( s;(0aexrirctodfpDe n i t)teumir oy4ap e ieilt)sDtrxmooo1ope  o3iatfaDulums;u) eeomf3iytfmD  u slt srum(m3iydapeemfvslt s2um(  ou4teenmiciysfmDraump u4 rtoir todop eaneol(0texrxr oodlm   nctas) rtm( oot1tlt mf3ilsla2ul( o;(0aleoiocoo1fpDr ivolt) rumio3oodoleelietas)arta(m oo4alto ociltls ua( p (4aeenio3iy1fmtelueo () rum(o3oy4op emncsat srum(  oo1ape micils aDuaumpn(4tlxnio3oadomt aueo ()t2xm(o3io4ll emncsat)s2um(m nu1tptomi3iasfs em(vp;(0areomr3oy1fpt  nvi s0teurirpno1ap  mneiltfa2raxm nu1tptoifctaslsDul( p t0aexomr3totfateauvilt trto(o iudlle  fviasf rtmumono0tlxnmfciys aDumumon(0 eerxr todfa elies;s) rumxm3iu1oltelfvilt) rtax pno1olt ifciltfm2rlums t0teeoxfcoa1fpt livo t truo(o3oo4ol e ncs ()sDtrumoou1aetnioeildfa rl(vpnt)tlxrifcoytfm rauvols0tetm(mpnodlmeelfcsat aDtaumpnt4oleomietyd mDrmumpn(4 renxo totlaDr nvs;(0truoxmpnydap  lnvsat a2urur ou4tpxniieiyd aDea( p u)texoio oadopD au i;s  2trxmpoudlme  fvtas)s2ra( poo1ape  octadfa rauvs (4trtrifcoa1opDelivs;t teumiopiy4al emfvsa(f rtr( o;t1tlto f3tltfs eau sn(4 rerxo iy1om rlivol(  exo(rpiudlmtnmivs (fa2raumpnt4apx if3tld s rlu p u0 etnxo3oadlmt  nei;(0truoxr3oodlleelnvtls aDrrxr no0apeoioeiys m emu s;(0teermf3oo1lmt luvo t t2tmxopnydopen ncsa(fsDua(monu4tlxo octytfm rln o;t0 lxrxrciatop raueolt) rtoxopoy4omtnlfvs ( sruax poo1oex iieils s rauvp;()teenxoctodoaDeaivs;( trtmxr oydlm  lieils) Dtax p;u4tpxnmfciltlsDelu s t)teermo tytopte ieo t0 rum(r nydoltnmiet (f Dtmu pno4olto ieilt a2ul(vs;u)alxoxocoadlmte uvi;t texoxopiu1lpt lnvsat) 2umu pnu4apxomi3iad a rlu p u4arxoifcoatla   ies t0srum(o ny4omee ics tfaDrm( pnu1aex  feild m emnmp t4texnxr3tytlp rai o s0 exmxrpiy4lpenlietl(fs2tau poo4tex mf3iltfm2uan o u4 rerxo3tadfptelueo (0 rxrxo iudal nlfvil(  rtaurpnu1tee mo3iltfs2rl(ms;(0alxoxf tytfmt  uvslt)trto(rpiudlpt mfctas)srraumooo1tpxn feils s2el(vp;(0 ltoiocoo1lptean s ( teto(mpoudope mneias sDrrum nu4aexoiictldlm uaums t4 reoif3totfat auvol(  exmxopiy4ll emneil(fa2ur(rp;o4apx iieiytfa emu p;u0teenio3oodfmDe ueils0tetoxr ny1apt  fesas)aDurumpou4oexn i3tls m2rlu o;u)trtomocoatlpDr uvsls)t2trxrpiy4omeemnvsl()arra(mpoo1tpenifctyd s umuvs t0 rtomocia1fa  li ils  rtoxo ny4ap elncsat a2raur ou4apt  octydfm2rlnvs t0 rxrir ta1lm e neil()t2toir ny4lptnmncta( sDuaumpou1tpxnmoeils m rl( snt0 rtnxr3iytla   neslt0 eurir nu4om emies s)aDuaumo;o4tpx  ietytla2rlumpnu0aeerxf iydlmtelivol(  eumiopou1lmtnmfet t  Dumxront4aptnmociadlsDua(vo;u)tetrif3oydlateluvs;(  rxmxm oodlm nlnvilt)a2rru pno4tpeomfcilsfm2ean onu) ltnio iadlmtr nvs t) 2xm(o3ou4amt  fvs s sDtmurp;t0olxoio3tyt m eanvsn(4 rxnio3oo1oa  lu ols trtrxr3iodale lfvi sf rra(m no1olt io3iydla uluvsn(4alxrxr iadlmDraivil(0trtm(m ny4lm  mnvt t aDtr(mpot4tex mo3ias mDrm(vo (0teeoxrcta1fpDelnei ( texr(r3io4optemfcils a2um( onu0tltnmo3ilt sDrluvs;u4areomoctadlaDeln o;t)sexoxrpny1oltnmiesl()sDrmump;t0alx iictytla ranvpnt4tlxrxfcoy1lmtr i s;(0s2tmiopnu4lltelict tfarrmxm ot4tpx mictlsfm emump u0trxoirciytfm e n ils  2um(r3ou4ame lfvt s aDrrurpoo0oex io3iytla2rlu p;u4alxrifcoa1latrln s t0trtmim iodll  lfvi tf Drrx pnt0apeniictas a2umn o (0tltrxfctydomDrlnes t s2xoim3ny1op  mics sf 2rm(m oo1alenii3tytfsDran o;t)alermf3tatfmDrlues t srtrim3iu1lp nlneilt  Drmxrono0tptnmi3iat m rluvon(4trxomo oydfmt liesl(0truoxm nodlltelictas) 2tm(  ;u4opeoifciltfs2eln s;() eeoifctadom e u o;s sexo(m3nu1ameelfvtls) ruax oot0olx  oeiyd m eau o t4tetrxocoa1om eaneol()srtriopiu1openlnvtas aDtm( pou4oet mi3tadlm2um(msnu0aexoxo ta1lm r ueo (0trtoxo3oodll nmiei ( sDrmur ;t0olt  fctys m2eauvp u4trtnmrctotlmDeanei t  eum(rpio4altn ivt sfsrtrx pnu0tpenmictyt s2elnmsn(0aetrio oo1omDr nei;t s2xo(r oydolenmict s)s2rmu o;t0aetnmociydlm2eln sn(0artrxo3totlpD li s;(  etm(opoo4ol nmnvia(f Durxr no4aetnmi3ilsfmDelnmonu)altnxrcoytop  an ols0seuoio iudlltnlfctlt srumumoot4aeto oc
\ No newline at end of file
@@ -0,0 +1 @@
+ueols0truoxrpnydoptelieiasfarrrx  ;u1tlxnio3tad aDrlnvpn(4aetrxfcty1oa rluvs;t)setrio3oo4lpen netlt)artrxm ou1opx ifciad m ua(ms;(0tltoircty1omDr u ilt)sexr(m iudamtnlncs s sruauroot1tpxo fetysfm2raumsnt)trenif3oydlat ai o s s2uoir3ou1llt lncil( sDua( ooo1tleomf3iytfs emu o t) etnxocootfa r ies s0t2xm(rpio4lleemfei (  2rmxr ;u1aexomi3iydfs uln sn(4tltrir3totla eaieolt0 exr(m io4ope  nvia(fsrum( p;t4tpe ii3iys a uaumonu)alxomo iodomt ln sl()texriopnodll nmict t)s2tm(rooo4oexomfciad mDulnvs;u4tltnio to1faDrlueilt0s2xrim nydlltnmnvs s)aDraxmo;u1tlxnioetas sDeauvs t) eeoxo3oo1optranvol(0 2tmir3ou1lmtn ies tf 2tm( oou4apx ii3iadfa2uanvs;u0tlxnxo3iadoptrau o;(0srtr(o3oy1opeelicsls) 2rr(  ;u1oetomf3tlsfs ul(ms (0 ltomr ia1oat livsls setm(rpnu4oleemfct (f Dur( pnu0alxomoeiltlm2ean o;t)alerxo oy1la   uvi ( s2uoio3iy1amtemivils  2rrxr ot1ale iociys sDul(vo;u)aexrir iatlpDe u o s0tetm(r oy1ll   nvsltf Dumurp;o1oeeomo3ias aDem( ont) rtoxf3ia1fm   ieil(0 2tmxopnu4am nliviltfsDtaxm ou1aeenmoetysfs2elu o u) rxoxr to1lpte uvo s)s2umir3nodlp emfvilt  2rau  ot0apxomfeils a2el( s t0 rtnifcta1lpte n o;( srtmir nodlpt mnvt ()s2tmu o;t1tex ioeildla2em( snu)tltoxr3to1oaDraieo;s srtrxrpiodapee ncsas sDrm( pnt0aexnmf3tldlm2rmnvo t4 rtoif tadla e ues (  etm(opnu1lmtnlfetat aDrm(mont4texnmociyd s2um(msn(0trtnxoctadfatelivs;(  2uoio ny1alenlivi tf Drauro;u0olto fcilslmDum(vo (0altoxr tatfaDe i sl()srtoxmpnodomte nes () rtm(m ot4apxo f3iytfm rluvs;u0teerxoctodlpte ivi;s0 rumio no4lp emicsl()arrmumono1aptoifetad a2um(von(0aetnmfcoodfaDe uvs;t s2uoir3no4ole lfcs ( srumurpnt0tpx  o3iys m eanmon(4tetrmfciydlm  auvo t0 etrxo no4ole  ivi (fs2raumoou4tpt  ociad sDrau p;(0artrxrciotoaDrlnvsls  exoxm3io4lpe lnetlt) Dumxroot1opxnmicias a rmump;() lxoxfctadfmtr ueo t) euoxm3no4am nmiei ( s2raxmp;o0alenmf3iltfa emn pnt0aeeomf3tydlaDrlnes;t)srumimpnodameelieta(fsDuaxmonu1tle mi3tltfaDeanmp;(0trtrxrcootfp  lu s ( s2tr(r3no4lmtnmivil(fsrra(r nu4oetomietyt s ua(vsnt0altrir3totfa elu o;( srtr(r iudomt  neiatfs2tauronu4olenio3tys s ul( pnu4 rxrmr3ia1fa  ai o;(0s2tr(o3oo1lm nlfetasfsrrmu  ou0tex mf3iyt m eanvpnu4trenmfctytomD auvo t0seumxo oo1amteliviat)artrurp;o4apx mfctyslsDrl(msnt0aexoxf3iotfmDrlneo s srtm(m3ny1apt  nvias a2tm(r ;t4aeeomfciad s2rlu p;(0tetomfciodfp   ivo;s sexm(r iydlme lnciltfarumxrpoo0apto iciyd sDumn p;u4alenxf iodlpteli o;() 2xoimpiudopt lneiatf 2um(rpoo0texniictls s rau sn(0 exrxr iydop elues;t0t2toirpiu1amtn nvtlt  Dtm(rooo4alt moetas s2ran o;(4trxrir3io1fmt  iei ()t2tm(opnu4oltemivt t  2rmxmpou4aet  ocild s umnmsn()tlxnio oodfmteaneilt)t2xmio3ou1lptemfcsatf rrm( o;o1tle mieiasls ra(vp t)aeeoxr iotlmt lueo s srtr(o io1ale lfct (  rtrxr nt4alen o3ildlsDua(mpn(4trerif iy1oaDe ivol(0 euriopio4al nmneiatfa2tm(m oo1olenmo3iydfm2ulumsnt0artnxo3io1op  aieol(0 2tm(mpnu1amee fcsat a2tmurpnt4aeenmoeiysfm ea(vo;t)tlxnmrctytomDr nesls0 rxmir iy1alt mivsat aDtaumpno4opt io3tldls2rmn p;u4 rerirciatopD  ivi s)setrimpio1lpe mnet ()aDua(ronu0oltnmfeildfmDuln pnt) eeoxrciadoaDrau s;()t2ur(rpou1oleelfei s  Drmur oo0tlx ifetatlsDrmnvp u)tlxomf oa1laDeanvo t  2um(m3oudal emfei (  rra(r ;u0open o3ias m eaumo;t)arxrmrcio1lpDe uvi;t  rxrxopiodap nmnvsls) 2taxro;t4aeeomfeiasfm2rl(msnu0aexnxr3oy1oat  nvslt srtrimpoy4ome livsa(fartrxmpou0aptomoetat sDean s u) rxrxr3oa1la elu i;(  exm(r iu1lle  neias srurur no1tleo i3tysfs rmums;u)aetrif iydlmDrlu s;s) eumxr oo1al e fes (fsDuaur nu0aeeniieiytlaDumn snu4 exoir3oy1opteaivo (0 etoxm3iu4lmee fvi tfaDta(  ou4tltnio3tatfm2raumon()aetoifctydfa rliesl( trxoxo ny4al nlivilsfsDua(m oo4olt  octlslm um( pn(0arerxr3tydfpDr ueo;t srxrxm3nydam  liet tfsrua(root0tlx  i3tlt s2ua(mo ()aetomo ootlatr iesls  exrxopiodapt lnvia()srurumo;o4oexoiieiatlm2rl(vont0tltnmfctodfmte ueol(0 rxo(o3iydopte nct (fsrtax p;t0aetoiictyslaDua( p;u)texoxfcoy1oaDr n olt0 rxrxmpno4omeelncs ()aDuaxm ;u0tptoiociysfmDum(mpn()alxomf3oo1lmteln ilt0 rur(mpoy4opte feia(f Dtr(mo;u0alxoif3iydfs2uanvp u4 reoxoctodlmte n i ( trxoim3oydam nmnei s) rtr(r ;t1olxomo3tydfa ul(mp (0arenmf3ta1omDrlnvi;t)sexo(rpnydoptn nctasfsrumxm ;o4oeenmi3iat m2uluvpnu4trxrxo ia1oa ranvs;s0 2to(opnydal nlfcs tf 2umx pot4aet  iciyd mDrln p;t0tltrio iotlptelueils0 2xr(rpnu1alee fet ( a2tmx pnt4aetnii3ildfa rmn pnu4aexomr tytfmDr n i;s trtm(rpoy1lmtn feil(fa2raxrp;o1tetoiiciadfm elumpnt) etrmo iatopD ai o;t)trtrxr3iodome mfct sf rta(rpnt0tpxnmoeiyd aDranvs (0tltomrciy1op eluvs (  rurio ou1lle  ivils) rtaumont0tetoif3tat sDumu s u4tlermo iatomt aneo;t) rtrir3oydlltnmnct () rraumoou0apeoifeias mDem(vs;()tlxnio iytla eluvo s0 2ur(r3nudap  lncsasf rtmumo;o4alx ifciltfaDumnmpnu4alxnifcootfpDr i s;s0 rxr(o3io4lm nlnctls)sruaur no0altoiocilslmDuan p;t4areoxfciodfp   i i;s)t2xr(m3oo4openlicslsf Dtrxrp;u1altnioeiasfa rluvpnt0artnir totfpD aies;t  rumio3nydap e fcs t)arrru  oo1open fcilt s2ra(vo;t)aetoif tatfp   i o (  rur(r nodllt mfcslsfaruaxmont4aexo o3tydfa2rmu o t) reoxfctotfaDrli ils  etmxr3iydap e fvtat)sDuaurooo1olx ifciltla2ulnvp (4alxnxr oa1opt  nvi;(0 rxoxm3nydomeelncslt  2ta(root1tetnmociltlsDua( p u)texomo oodlptelnvo ( s2xrxm3no4ll n neia(fs2tm(m ;o4aptoii3tydfm eaumo;t4 rxoif3oy1opD  uvol(0s2ur(mpou1omt lncsa(f 2raurp;o1altnio3ilsla2elump u4trxrmf3oodlp rluvo t0 rurxm oy1ol e fesltfsrumx  no0ape  i3ildfmDrl(ms ()aexrmrcoytfp  ai o s tetmxrpnu4opeelies sfartaxrpou0alt iicildfs2emnmp t) lermo to1laD li i s)s2trxo ou1am emnvil(f 2tau pno4oetn fctltla2umnvo;t0aetnmo iotlaD  iei ( s2to(m nydal   fvtl() rumx o;u4oet ii3iad sDean pnu0 lxnxf todlpDe iesls  rxr(rpio1lm nmnetltfarrru o;o0olx iietatlm ranmpnt4 rtrmf totfmDr ivils0trtriopoy1om   nctl(faDtr( onu0tee  i3iad sDrau pnt4trtriociadoa eaueils0teuo(rpnodopenlivi sf rtaxm ;u0aeeoii3tydfa2rlnmo u0areoir3oa1lm r i ilt texo(r iy4al elfes t)srtm( oou4aeeoifetlslaDulnmp t4 rxomo ia1omtrln slt teuoxo nu1apee fesa(fa2rmxm ot0tlxnmo3iatlaDra( pn() renmo ta1op   ivo () 2urxo3oydale mnvsat)arrruronu0tpxnmieiadfa rl( o (0aetrxociatop elneolt  eurxmpoydapt mfet tf 2rrxr ;o4tpt ifeiyd s2emnmo;u0 rxoxrctotoaD  ieo;()srxmxm nu1optnlnet tf 2tax oou0aleo o3tasla emn s;t)artrmrciytfmDran i;s) 2uo(m3no1amtnlfviasfaDuaum no4oet moctatfs2rmumo u4tleomo oytom  anvi t0s2xmim3oodomt  icsls) Dtr(r oo4olxo o3iytlaDra(vp (4aeeoxo3io1fmD an i s  rtrim oodoltelncil()aDurumpnt1alto ociasfsDua(ms;() renxoctatfm r u sls0trtr(r iydlpe  ieia(f 2umurooo1texomiciytla2ua( s u)trxrxo3oo1lat  ieols0t2xmir oudaptelnct s) 2umxmonu1ape  o3tytfa2em( p;(0aeenif3tatla raueo t0srxm(m3nodlmenlncs t) Dua(ront1oet  f3iyd m2ra( snt) ltrio ia1lptranvols t2tmir oo1opt lnciatfa2rmxr ot4aet mi3iytfs rmnmp;(0 exrmf ia1opDe i ols0 ruo(opoo4am emieiat  2rmurpot4tex miciat sDrl(vs t0altrmf3iotlaDr u o;s seurir3nu1amt mfvs t)srta(  ;o4opxn ietltfsDeau pn(4tlxrio3tytfmt aues t)teumxm3ou1lmtn fvi t) Drr( o;o0oet  ociatfa uau s u4tlerxr3ty1faDeli o ()trxoxr3no1omeelnes t)a2trxro;o4tlx ioetltla2eau ont) ltnxo3tydom   n o;(0 etmxo iy4omt  ivt s  2uaur ot1olto ieias a ul(von(0tlxriociadfmDr neilt0 2xmirpiudlpte feilt)aDtrx o;o4oexn f3iytfm ulums;t)alerio ootla ranvo t sexmim3oy4om nlivsas  rrrurpnu0opxnmi3iat a2rl( snu0tlermf3oydoaDeluvs;(  rtoxm3oydlpeemictl()arur(m ;u4oleo o3ils m rluvo t0aetoxfctodlatrluvo s  rumxr3no1llenmivsas)aDtr(ront4tlxnifciytlsDulu o u0 etnxfctydlat lnei (  rxoio3no4amtnmies t)sDur(rpot0tlt ioctysfaDulnvpn(0 etoifcta1lptrlu ils s2uoir iydoltemfcsa()srtmxrpnu4optomiciysfs ra(mont)alxrxf iotfpDeauei;s0trumir iodomtnlnvsatfsDrm( pnt1aexniiciyslaDemnvs (0tetrxrcta1opt  ivo;t)sexrim oy4om emncsls aDrrur no0texomieiatfa rluvsnu4arermfcta1om e ieo t)s2urxrpio1omt  fcta(fartm( oou4aeen oetldfs2rlump;()alxrio tydla elivils0 2tmimpoudomt liviat)srraxrp;t0tltnmictasls2uauvs t)tltnmr3ootlp  auvi s sexrxr3oy1omen fcs () ruax  ;t0aeeoio3tlsfmDea(ms (4tltomf3todfmtraueo;t teum(mpio4olt  fvi (  Dra(rpno4ole ifctasfaDeaums;u4aexomr3oodlateanvils srtrxrpnydoptelfvtat)aDrm( p;u4alxo i3iyslm2ua(mo t0 rtnio3ia1faD  ivol( tetm(rpiu4apeemnctas)sDraxr ;t4optnmieiydlaDra(mont4artoio io1fmt li il()setm(o3nu4lm nmics t)aDtaxrono0apx  feiyd a2ean o;u4arxnmr oa1op elnvi;t) eur(o nydap nliesas) Dtmurp;u1tle if3tyt a2ua( o;(4alenmr3oytfaDe ivo s0texoxmpiudlme  icslt arumxm ;t4oetoii3iytlm2rmnmo (4aeeoifciotfm e n ols0setoxm3io1lptnlieta(f 2rm(mono4tex if3ild a emu o t)altnxr3iadom eluei s)s2ur(r3oo1lptnmnetlt) Dtm( pnu0aptoifeiytlmDrmums;t0 ltnxr3tytoatean o;(  2umxm3io4om   ncil(  Durumoot0oee ifciytfaDul(mo () etrircty1opteauesls texmio3iu1lp elfvi s) 2rmxr no4tpen f3iysfmDraumpnu4aeenmr ta1fmt aivs;s sexrxo oo1lptn ncil( s2rmu ont1opt  f3iat mDrm(msn(0 ltoif oo1fp  lieil()trxmio3oydapt lnei ()a2rax poo0oeen ietadls rln onu) rerxo3tydlmDraivo;s0sexo(o ny1lmt lfvilsfaDtrur no0tpxn i3tasfs2rlnmpnt4aetnxociy1fpDean sl()teurxr oo4ome  nctls a2ra(r ot0olt mo3iadfs2rmnms;u)altrir io1fpt  ivilt srtrxmpiydop n fetat sDra(mo;t4texnmfctlsla eauvpnt0texrxoctotoa  aueo;t)texo(r3oo4op   ivs s)arra(r ot1texn ieiatlaDul(vo (0 exrxo3ty1fmDe uvi t)texmxm oodlp  miesa(f 2tm(ro;o4olxnmieiysls elnms;()tetnxrcoodlaDelneo;t trxoxrpnu4ol elfvta()aDrmuro;u4olt  oeiydla umn s t4texrio tadlpD  ueols) 2tmxm3nydalt mncsl()arraxronu1olenmo3ias m eauvp t)trxrmf3iodfat  uvi;s t2trxm3oy1opeelnctlt  2um(rpnu1alxo iciys s2rmnmp;(4 leomf3tatoaD ln o ()t2to(o3nodamt mfvtat sDrmxm ;t0oee io3iasfa2rmuvp;t4tltnxf tadfpt lnvi;s) rtr(o iudap   neiatfs2tru o;o4apxn fetlsfaDrmnmo;(4tltoxfcoa1lmtelieil()s2xoxo nodap  mnvt s)s2rmum ;u1oeeomfeiltfsDrlumont0 etniocto1opD  uvols0trumxo nu4opeelfcil(f Drmxrpou4oltomi3iad aDua(vpnt0 ltnmfcio1lpD li o;s0srumio nodll emfvta() 2urx oot1apx iictysla2um(vsnu) exnio3oodlate neolt)trur(r3nu1olt mfcsa(  Dtrump;u1tpxomietad mDrmu o (0tlxomfcio1opD  u ol()teurim io4lpe mncs tfartax  ;t0apx  iciydfmDea(vo;t4 lxoifciydfm  li s t0trtr(m3oodoptnmicsa( aDrr( oot0oexoiieiasla2ra(vsn()texnxociadlate nvsl(0srur(m3ou4lpt mncs s)a2ua(mont1oeeomiciltls2emumonu)alxnifctadoatr nvo;s0trtoxo no4ap nmiviat)sDrmxrp;o1tpxomf3ias s2ulnmp;t0tlxrxocoo1lpDraivs ()sexoio oudapenlfesasf 2taurono0alt  o3tltlsDrm(ms ()trxomociadlmDranei;t s2xr(r iydal nlnvta()aDrrxmoot4apx if3iytfaDemuvs;u)arerxo totlpt li slt  rtrxm oo4ap nmiesl(fsrtmx p;t0aleo iciadfm2eauvo;()altnif oy1fpDrai i;t0 2tmxmpoo1olte nctltf Duaumoou0apto o3tytfa umnvp u) rxrircootlm e i s s trtmir3oo1lpee fet sf Dra(rpnu1tex mfciyslaDuaums;u0trxnxf iadlmt auvols sruoxo3oy1lpeelfetatf rum(rp;t1tptnmicilt mDua( p;(4altomr3oatfa  an i;(  rxr(rpiu1open ics (  rumxmo;t1tpx mfcildfs uan o;u)alxomf3ta1om e u i;()t2uoxrpoudame mneiltf Drmx onu4teeomf3taslsDranvp;u0tlxrmf3iatlmt  n o;s0truoxopou1omtnmfct t)srum( oot1texoifeiltlm2um(vp;u4treoxrcoadfat anvs;(0texoxr nu1amt mfeil()srraxmp;t1tle moeildfaDulu pn(0tetrmr3tatfptrlu s;(  rtmio no1amt mfctls sDrru oot4aexnioetldfs rl( s;u4alxrmf3tadoa r ivi s tetmiopny1ole mnvils s2uauro;t4aet if3iydlm2ranvp;u)alxnmrcoatopDr uvslt0 2umirpou4ale  netas sruaur ;t0aet iiciytls2ulnvp;() ltrxoctadopDeli sl( s2umir3oy4omtnmfcsasfs2rrur ot4olxomf3iysls ulnmpnu4alxnmo3iadop rauvi t0 2tmir io4lleelnctls srtrumooo4tptnii3tlslm2uan o;t)arermociydopt  ivsls0seurio3iy4lpeemiet ()s2umum ;t4tpxo f3iatls uan snt)texnxf3iydfptr nei;s0texmim iydoptelfcs tfsrtm(mpnt0oexnmocilslmDrlnmsnt) eeniocootfpt  i s;t0t2urxrpou4olte nctlsfaDua(m ;u1tpxnmoetytls2rluvp ()texrxocty1op rluei;t) rtoim iy1ome licias artmx onu0tlenmfciad m2uan s;u0tetoxocty1oa r nvs s trxr(o oy4ap  mnvt sfsDrax poo1opxo i3tydla rlumont4 rermf3to1op eluvils seuoimpoydlpenlncs s aDra( poo4aleoio3ilt s2uau ont0alxnxfciytla  anvolt0 rumio3oy1ame mnesl(fs2umu pou4tpt io3ils mDranvpnt0texrmfctadoatr uvil(  eumirpio1amenmfvslt) rumx pot4oltnioeilsls rmuvont4tltomo iatoateai s s  rur(o iudol nlfvsas sDtrum no1opxomfetld m2elump;u)aeeoio todlp rln i t  2xm(r3oy4aptn fcslt) rrau  nu1tee  iciys m ul( o u0trxrmf3oo1om  aueo t seumxm3nudomeemnet ( sDra(rpno1tpe iiciytla ra(ms;(0 reriocta1fpDe u s t)t2tmxrpou1omeemncsat)aDtrur nt1opt ifetltls ea(mp;t) etoiocio1omteln slt  eumiopoodapen iet s s2tau pnu4tlx  octas m2elu s;t0 leoxrcoodoat anei;( teumir3oudllee fcta( aDtrx  ;o4aleoii3ilsfmDeanmo t)trenioctadlmDraueo s0seuoir3iu1oltemnct t aDtrx pno4aleoifciat s2ra(mp;t0arxoxo3totfmt aieils)texmio ny1omtemivil()s2rrxr ;u0apxn o3iydla rm( o;u0aexrmfciy1oa rlneols s2xr(o3no4lmtn fei t) rumu oou4alxomoeiysfaDea( p u4 ltomo tytlatran sls)texmxr oudll emfcta()sDuaump;o1texn fetlt a rln p u4 eenio3tytfa eauvo;(0 eurim3nudom elnetat  rumurooo1opt mf3iysfsDuanvon()artnxf3oodfat lu olt0s2to(o3ou4lp nlncs (  2tau  oo0oex  ociltfs2ulnvs;t0tltrxr tytlaD  n ils0t2xoim3no4openlncta(f 2uru poo0apt mo3ilsfsDrmnvo (0aeenxo3ta1oa elnvs;( s2urim3io1lpeemfvil(fa2rmu  ;t4apxnmfctysfm ra(mp u4 reoif3io1op rauvsls)teto(mpio4lltemfvtat)sDum( pno1olxo ociytfa2ul(mp t4 etrxf3iotop eaueilt0s2um(r3nudope lnvsl()aDumur no1olx  fetad m2rlu snu0trtnxociodfmtraueo;t t2toim iu4omt mnctat) rtaxmo;u4teen o3tldfsDrm(msnt)artnxf3ta1oa   nvi s)setrxr3iydapt mivsat)sDrr(root0teen octydlm2rmn o;u0 exrmf3tytom   nes t0s2umxo3iudomtnlfci s)s2ra(mpoo0aee miciat mDuanmo (4aexoif iatlatr u o t0 2xr(rpoudopenlfvtasfsrrmurpou0teeo feiydfm2emu p (4 reoircoy1opD auvslt trtmxr iu1al nlieta()srraur ot1oeeomf3ias m ua( pnu4tltnifcoa1fmtrlnvols trtmxo3ou4al  miciasfs2raum nu1tpxn fctltlaDum(mo;u4aexrxrcoodlpteai o;t0t2um(rpoy4ap e neiasf Dumu  no0teeo oeiysls2rmumo;t0 ltnmf iadfmtraieols0s2um(r3iodlpen ieia(fsDrmx p;o4aex mo3iydls um(vp t)altnxo3iadlpt ln i t0 2urim3nudlmt mnesa()sDur(  oo4tpxnmoetaslmDea(vo;u0alerirctadlm  an s;( sruo(o3nudlpt lici t)s2urx poo1opto f3tytlsDuanvo (4texrircoodlp r uvs ( srxo(r3iudll  lfvsa()srurx  nu0apeniieilsfm2ulnvs;t0 eerio to1oatr uei;s  2xrxopnydom nmncsl( a2trxrono0oltnmoetytfmDuaump;(4 rermoctatlaD ai s (0s2trxmpiu4openmnet ()a2rm(  oo0aexnifciys a2uan p u4 rerio tatoat  ues s)srxrxm3ny4ol n fvias)sDraxmooo0teeoifctlt a2elu s;u)teermoctodfmDr i o s0tetoxr3nodllteliciasfaDrmxronu4olx iociat a2emn on(4aexnio todla rau o;t trurim oodalenmnvils)a2trum ;t4ale  feiydlm emnmpnu4tlxoio iadla e u il()srxmxrpiydomeemnetas) 2urxmpou0tetomf3iyt aDrm(mo;t)tlxoio3oatfpD auvs t0s2trir3ny4olteliesl(fsrtmxr no0olx iiciatfs elnms () rerifcia1la eauei t srum(r3oydam   ncsltf Drmxmont4tlenmi3tltfsDua(mpnu0 lxnifctadoaDe u sls srur(m3nu1lpe lici s) Drrurpnt1tle ifciyd m uluvo u0aetrxo ty1fp rlneolt0t2uoiopoy4alt mfvsls arraxr ;t4ale  ieiytfsDrm(mo () eermo3iydfmteln il()tetmxr iy1ll e nvtls  2rrx  ;u4aeeo ieiatlsDuln s t0aexnmocty1opteaieo;()texrxm iy1lm   nvtl() rrmxr ot0ope ifeias m2rauvo () etoif oydlmtelueo;s0 exoxo nydlpee net ()s2ra(mpno4oexomieildfm um( o;u)teermo3oadla  liesl( sruoxm oudalenmivt (  2raurp;o1apenmocildlm2umnms u4 ltrxfciydoat an o () 2tm(m3io1lpt licsltfarurxrpou0tetn ocilsfs rln o;u4trxomocoa1lpte u i ( trur(m3oodal nmfcta(  rraxrpoo1oeeoifeiasfm2eln pnu0treomo tatlmDr nes ( trxmxrpny4amt mieia()s2raxm no1oleniieiltla rlu o (0 rxrio3oa1oat auvs;()t2um(rpoydam n nesas)srum(mpou4altomieiad sDea(ms;()texomo3iodfmtr u o s) exmxmpoudalte fesl()a2ua(m nu0oee mo3tys s2em(mpnt4trtnmocoodfaDrlues t  rtrxo3ou1ome mfvslt) ruaxmoou4aetnio3iat s rmnmo u) lxnxrctadla ranvil( trtm(opoodlmee icsat)srtm(rp;u0teeomfciatfsDul(vsn(4 rtrif3iy1fm raneilt s2trir3no1al   nesat a2rrxmpnt1texoifetysfmDemnvpnt0 lxoxf iydlpD livi;s t2umxr3nudolenmnvtlt)arta( ono4tlenmfeiatlm eln p u0 eeomr3oatfmDrlnvilt0 eurxm3iy1omtn fvil( aDrmu  no1apeo fctyd m rmump;u4 ltnmf oadfmDr iei;()s2xr(o nydam emivtltfsrumumonu1tet moeils a2rm(msnt4tetrir to1fmtr ieslt0trum(r3iodlpeemfcil()srrmxro;u0apen octld aDea( o (0artrir3ootopDeln s t0t2tmxr no1omeelnesa() 2ua(  nu1opx moeiat s rm( pnt4aetoxociodfmt li o;( trxmxo iu4oltn ivs t)aDumu  ;u1tpxo f3tld m2el(vsnu)aleomfciy1faDe u s s  2trxm oo1altnmfvs sfa2rmxro;o4ale iieiytlmDuan p t) lxrxf iadfpt au olt0 etrirpno4amt lnvtat)s2rrurp;u0tlxoiicias m rlnmo;t) rtoxf to1fpt aiei (0 rtmirpou4omtelict s) rrmxront0aetoifciad mDeau p u)tlxnmo oadlmteaieslt0seur(o3ou1ame  fctl( s2raurpoo4tpeo oetasfa ul(vp u0 exoif3iytfa r ueslt0t2tmxmpiy4ape  fcs (f Drmxroot4tpxo ocilt a2raumo;u4trtriociatopDr uvs t trurir3ou4lm  lfei (  Drrxmooo0texoioetltfs ea(mo;t4alxnmf3oytfatr uvo () exoxr iydlle mnvsat)aDumxmooo4optomieiysls rmnvon(4trxnio oa1omt li o;t) exrxrpou1omtelfvia( srtrx onu1tpxoioetadlsDulumo;t4 renif3totlmtelnvil() eum(r oodaleelfesl()srurxm nu0altnii3tldlm2ra( snt)alxnxr3oy1opteauei (0sruoxr3oydoptnlnvsl(f Dua(mpoo1apxnmoeiadlmDuan s u) rermr iotla  lu s;s0 eurxo oydap  mics s a2rr( ono4texn o3tadla uau onu0 etrxr3oydopteluvo t0s2xoxopny4lltnlnctasfaDum(ro;o4tpe mieiydlaDeau s;t4 etoir oy1opD livi;s) eto(opnydalenmfeiat)sDtrumont4aee iietydla emumsn(0 lxomocio1oa r ueols t2xrxr oo1openmnvta() rrru p;o0alxn oetat s2um(mp;u)tlenir3ootfmDrlu i;s0trxo(o oudole mnesltfsDtau p;t1ape  i3ilt aDemu p;t)tlenxrcta1fa  luvsl(0 rurim nu1op nmncsls)artrxro;u4opxo i3iat m2el( o (0 etrifctatlpDe nvo s srumim oy1al nlicsasfsDrrx poo4aexnif3tytlsDumu pn(4trerxo3oa1lpDe nes t  rtrxmpoy4am emicslsfa2rrumooo1oetniietatfaDrlumo t0 rxnmo iotfptr ieo ( s2uoiopio1llt lncs tfarurumpot0tptnifeilt mDrlums (0trerxr3tadla rai s s texoxo3oodlmtn fcs tf rraurp;u1texo iciltls uln snu0tlxnmf3oatoat  ivo t srxmxr3io1omee icsas)s2uaxmpnu0ape  ocilsls2rl(ms;(0tlerif iydfaDr i o;(0t2uoxr iydlpenmics tfa2uaxrp;o0aexomieiyd aDumn p;u) eenmr oadfpteaies;s0seur(o nu1ll emnvtlt) rtrur ;u1opx moeiys a2emnms (4teenmr3ootomt  uvo;s srumxmpiy1lleelfci t) rtmx  ou0aexnifetytfm2ua(vp;u) rerif tydlpDeanei;s0trxr(o nodopenliet t  2trurpou4tpx ifetlsla2rlu p;t0 ltrir3iodop raivol( teuoxr oudap  mneia( s2tmum oo1tet mfeiydlm umu pn(4 renxociy1fa elnes;t texoxrpoudll  lfvia(f 2tax pno0tex  i3iytlaDeluvsnu)aetnifcoydop rlnvi s)seumxr3io4aptelictls)aDtmxmo;o4tex ioeiat a eanmo;u)tlxnir oadfm rlueilt0seumiopoydap  lncsls) 2ra( pno4tpen i3iatls ea( s (4tltnmrciadfat auei;s) exm(m nydalt lfvsas  Dumumpou1apt ifeiys aDrm(mp;t4 ltrxoctodlp   ivols)texoimpno4amte ncsltf 2taxmont0ole mfeiadfaDuaums;t) ltrio todlpt  ieo s  eum(r iu1lp   fct sfarurum ou4tlx mo3iadfa umump (0 leomfctadfate ues t t2uoxo iy1amte ncsat arum(m nu4aexo feiyd m em( s;u)tetrxf3tadfp rluesl(0setmimpio1optnlnvs ( s2ur(r nu0aetomiciydlaDrl( sn(4arenxo tydop ran s;t0s2tmxrpoudaltemnvsas) 2ur(rpno0openmociatlm2ran pn(0altrxrciatla raueo;s srtmir oo1olt  fvtlt)artr(mo;t1aexnmieild aDuanmp;u)trerxo io1fptrluesl( srtm(o no4om  mics t arta( p;t4tle mo3iydfs umump;u4 reoioctadfmDr i s (  2xrio oo1ope  ieta(  Dtr(  no4opxo o3iyslsDrm(mpnt)tleoio3ta1om eli ils0s2tmxo3nu1omenlfcia(f Duaurpno4tex  fciyd sDel(mo (0 leoio ia1fpteau s;() rxoim io1omt mfvsa( a2ururo;t0olxn f3iysls umumsn(0trtrifcoatfmD  ivol(0 etoiopoo1lleemictas)sDraxmono0alt mi3iydfmDumu o (4arerir oatfpt  uvil()setm(rpiudlpenlivsl(fsruauroot0tetnmocilsfm eau s;u0tltoxf oydfm rlueo ( sruo(rpiy1ale mics tfarur(mpou4tpeo ieiydfsDemuvont4arxnxr oa1la  auvi s0tetriopno1lptelici s  ruru o;o1aptoif3iysfm2rmnmsnu) rtrxf iodlaDrlnvi;s)t2xriopnu4ope livtl(f 2urx onu0tpe ifctlt a2ra(mo t4aleoir3iydoptelnvi;t) rtm(rpou4opt mneilsfarraxmoot4oeenmoctydlm ea(vpn(4aexnif3to1fatelivi;t0trxmxm oydlmeelfcia(farrm(rpnt1tlxniictysfm ra( onu4teenifciydom r u s t srtoim3oo4lmeemfcsas)a2rmu o;t1tlx iiciadlm2el( p t0tetrxo3iytfa   iei;s0sexr(m ou1olte nci ( srtmxrp;o0tpx mictatls2ul( onu4 ltomr3oy1latrlu i;s) exoim nodalenmfvtatf 2trumpou0alt io3tyd a2ulumo;t4teeomrciodfa rauvs;s0s2xrim nudop  lfctltfs2rax  ;u1alt  i3iadfmDea( pn(0 rermr ta1oaDr ivo;t0 eum(o3nodaptn ncsat arumxmo;o4teeo fciltfm2ran s u) rxnioctydoa rln o;( t2toxopou1om   nvtlt)s2trxmpnu4olenmoctyt s2umnmo;u0tleomrctydoatrlnes (0 exmxr iy1omte ivsasfsrrmxmoou4aetoif3tad sDulnmon(4teerio oatomt auvilt teur(opno4lm   net (f rurx pnu0teenmocild mDeau s;()arerir3iadla rauei s0s2umxmpio4aleemfvi tf 2tmu pou4tlt  ietadfa2rluvo;t)alenxoctadlmDran o s teuoimpiu1lptnlfviasf Dtm(rpoo1tptnioctlsfs ra(msnt4trxrmr iytfpD aivs;( tetm(o3oudoltemiet (f Drmumono1tpenifcild s uanmsn()texomocoodlaDe nvs;t)t2xoiopnydlltelfcias)sDumur no1aetoifciad a2rlump;u4 lxrirctadlmtranvi t) 2uoxr no4oltnmncil( artrur nu1alenmiciadfaDra( sn()tlerircoadlat lnei s0trto(o oodllt mivsl(faDurur ;o1texomoeiltlsDumuvs;t0 exrir oatfmDeaivo;()trxo(m oo1lmenlfeils s2ta(moot1aee iictadls2ran pn(4texomf tadlp r ivslt srurxrpiydapt licils)sDrrum ot4tpe  octltla2uaump;t0teenif3iytoateaiei s0teto(r iydllenlict t)aDrrum oo0tlx io3ilsfmDrlu pnu4aeeomo oytlmtraues;s) ruoxm nu4lpt mivtat a2urxmont4opt  ociatlmDeanmo;t0tltoxo3iy1lmtraiei t trtmxo3oo4lmtelfvtlt sDtmx p;o4olen o3ildls rlumo;t0areoxf3iodlptranvils)srtmxr3iydlmeelfvtlt srumum ;t0tpeoio3tatfm2elums;(4texrxf oodlaD au s;s0s2uoir3iy1am  mfcils)srur(mo;u1tptoioetad aDumu p;t4arerxr iydomtelies;(  eto(r nu4alen fvi () Dumxrpou1aet mfetas a rmuvo;t) exnxf ta1lmDelues ( srumiopnu4llenmfeil()sDrmx ono0aetn feildfa2ranvp (4areoircoadlp e ivi;t0s2xrio3nu1lltn ncil( s2rmx  ;u0ale  iciatfm2uanmp u) etrmfcta1fa elu s ( t2xmxmpoydam  mncils  2um(r oo1tex mf3ias m el(mp u0alxnio3to1laDrli i;t0 2umirpnu1lpt  fcilt)sDtr(r ;o0olenmfcilt sDrlnmsn(0trtrxr3oodlaD ln s;s0teumxrpou4llt lictatfsDrrx onu4teeomiciyslmDulumpnt0trtnmfcoatlp   ueo () eto(r3iy1opeelnei ()sDrrur ou0tle miciytfa ea(vo;()aeermo tydop eaues s)trxrxm iodlmt mics ()s2rm(mono4teeo iciatlaDel(msnt4trxrmrcootfaDr nvi;t)trxo(o3iudap nlfet t)artmurooo4altn fciatlmDrm( o;u4 etnxfcty1optraneo t  etrim iodapen ietlt  2uau  no1aee iictytlaDeln p t)areomo iy1fpt lies t0t2xm(r3oo4omtelivilsfa2rmxmo;o4oee if3iydfm2uau p (4aeenxr3oy1lm e nes;s0srtrxm3iydoptnmfetlt srtru o;u0alen o3iytls2um(vs;u) rtoircoa1fmt li i;( sexoim3no1aleemfcsl(f Draxmpno0aet ifetatfm2ua( onu)trtrmrciatlaDr uvo;t  rtrxo io1lm emnci (f 2rmx  nu0teen fciyt a ea(vont4texomocta1lptrli o;(  rtr(m iy4lpeelfes s  2rrump;t1tptnmf3ilsfsDrmn p;() rxoif3ootlmDeanvo;(0tetoxo ny1om elfvtat)a2raumpou0olt  ieiytfm2umn p;()aeerxocty1lpte uvi;( tetrxrpoydol  mieia(fs2rmuront4aeeomfctat sDum(mp u0aetnio3tydomtr ieo s0 2xoxo3oy1lmt mnciat aDtaxmpot0aeen iciytfaDea( sn(0 rtrmfcoatfa r u i;s)trxrxr oo4ame  fctl()arur(mooo0tex ioetls s2ua(vp;() exoxfcootomtr nvil() 2xm(mpiu1altnmncia( aDra(r ;u4olx  iciyt m2uanvont) ltomf oo1fptean i s0trxr(mpoo1lltnmiet (fsDtru  ;u0altomo3iad sDem(msnu)trxnmr ia1opDrau ols0tetrirpiy4apeemieslsfsDrm(rooo0teeo icildfs2ra( p t)tlxomo oodlate nvsls tetrxrpiu4opeemncsat) Drmur ot4oet  iciltla uluvpnt0 leoxo iatfaDeanvo;s  2trim nudalenmivil(faDurxmpot4oetomociytlm rlnmont0 reoir oy1fpt luei;s)srumimpny1olt  nei t)a2trumpoo0tpxnii3iatfm2uaumo;t)arxnxrctytfp  ai ol( sruo(m oo4llenmnctlt)sruaur ot1oltomfeils m2ra(vo t)arxoxfcio1fat livs;s)texrxopiu4lpee fcia( arraxmpot4tpxnii3tldfmDrmu ont)texnir3iy1fa  aueo t)s2umir3oy1ap nmneiat a2umur ;t1tex  f3ildls eaums (4tlxrif3tydomt anesls0trtm(r3oo4am e ivia()arraumpnu1olto feiat s umn snt0altoxo3totopD  neo;s)setm(o oy4om  lnvi sfs2um(rooo4texnmieiytlaDelums;(4tlxnmoctytfpDelu o;(0truoxmpoo4lmtnmfcs ( s2raurpnu1oleomo3iytfa2emuvp u4 ltnxo3tytomtranvi;s  rxr(rpiodam  miesl(faDrrx oot1oee mi3iyt m elu s ()artoxf3ootla r ieo;t) rurir3iu4ome  ivslsfsDrru  no1oeeomfctydfm ulnmp;(0 exrio oydopt livol( srum(o3oudlmt  neslt  2tmxrp;u1tlto fetas a2rmnvonu0 lxoifcoadla e neo;t0 rumxm3ou4ale mfeil(f 2tr(rp;o0oeeomfciadlm umu on(4texomo3oa1fmD  uvo s)texrxo3oodoltn fcsa() Dra(ront1tlx if3ildlmDem(mp;()tlerxr ia1fm   ies;()teur(r3nodaltnmiei ( a2ra(r nt4tltoif3tatfm2emnms t) renir3ta1fp elues;(  exrxrpno4ap elnes sfsruau ono4ape mf3iyt mDelnvo;u0 leomo tydfatrlivilt  etrxo3io4omenmnvslt) 2raxrpno1tetoiietad mDua(ms;(0tltrifcta1lp r n o;s  rxmxopoo4lmtnmiei s srua(r ;o1apeo oeiltfa2emnms;t) rtnxfciydlateliesl() eto(mpoy4omeemnviat)artaxm ou4aeen fciysfaDrluvo;()texnxo3iytlat ln o;( sexoxo3ou4ap nmneils aDuax onu1apt ii3tls m2ulump;u)tltnir3oodoa elnei t  rtm(o io1op nmncta(  rur(mpot1oexoifetydfs em(vpnt4tlxnircootfpDrlieo (0 etoimpno4olte fesa()aDrru  nt0olenmictld m2rau s;u0 eenio3oo1fmteli il()setrxm iu1apt lncsltf 2tm(rpoo4alx  iciydfa ra(mpnt)aexrxfcoa1fmt aivo;( s2umxrpio4ole  fetatfs2trumo;u0teeo ictyd aDraump;t4arxnif ta1faDrlivs ( tetrxmpoodap emnvt sf rrrxmpnu0tlxo iciltfa2ea(vo;t)aetoxf tadfaDrai o;t  2um(m3oodaptnlfvt (fs2rmurp;o4tptoiieiltfa2el( o t4alxomociytlpD  nvo;t0 etrir iy4ol  lnetls srum(roou0tptoioeiyslsDrlnmpnt) ltnmf io1la ranvol(  2umim ou4lpt mivs sf rtrx  oo1oeto i3iytfm2rmu o (4altnxo3tytfa elues s setrimpiodomtemfes sfsDuaum ;o4alx  feiltla uau o;(0 eenxfcootlm  aivils) 2xr(m ou1apt mnvi s)s2rrx poo1apx ioeiydfa rlums;t4 ltrircio1lp  an o ()t2uoxopio1lpt mfct s  2tr(mono0aet mf3iyslm2umnmp;t0alxrmr3iadomDranei;s)teur(r3io1omtn fvtat aDumump;t4oltoifeildla2rmu p u0tlxrxfctytlp rlueo;s)teumxm3oy1lmte ieia(f Dtrxr ot1tetn fciaslaDemnvo t)treomf iotlp  au olt0trto(m oodaptn fesas) rtru onu0teto ociasfa2ulnmp (4artnxocio1om eauvslt  2xoio3ou1lmtnmnctl()sDumxm ot1aee ifeiasfs2ra( pn()treoxo iotlmteluei s)t2xmxo ny4lmt  fctat  Dua(rpnu0texoiicils sDranvo t)tetrxo oodlmDranvol( t2xrxm oydllt  fvia() Durxm ou1tlx io3tatla emn p;u0 rxoxrcoytopt  nvo t)sruoir ny4olenlfes s a2tr(rpoo1texoiictad a rl(ms;(0tlerioctytfa  anvs ()setoimpio4ap  mfvias) 2tmx o;o1alxo icias s2raumo u) lxriocty1fa rauvs (0srxrxr iudlpt mnetls srurumont0opto icias sDrluvo;(0 lxomr iatfm eai ol( sexoir3no1lm nmiviat  Dur(rp;t0tpenmieilsfmDua(mp u) ltrxf3ta1fpDr neol(0seur(r io4apt lfct sf 2rr( o;t4oeeomoetlslm ea( ont4 lxrxo3iodfa e uvil(0 etoim3nudlpenlfeil()a2rr(mpot0oltnif3tldls rmnms (4alenxrcoatoaD  uvi;t0s2xoxrpiodlle  neiltfsrum(rp;t1tpe iicild aDrau onu)alxriocia1lmD livo;(  exrimpiydap  lici ( a2ra(  no4olt  feiytfm emnmo;u)tleoif3totfaD luvs;s sexmirpoudlmen fvtat)a2uau  ;t0teenifciyd sDulnvp;t0texrio3oadlm  lu o s t2um(rpiodam e nci t)s2rr(r no4tpeo ieiltfs el(vs;(4arxoxf oo1lmte i ilt0 rtm(opiodalee nciltf rtaxmoot1apxomicilt aDemn s;(0tleoir3oodlat ln ol(0teto(m3ny4omt licta(fs2umxr nt4tetniociatlmDeauvo t0 rxoiocoytop rlivs;t) ruo(m ou4lleelnct s  ruau p;t4altoifciyslaDrm( snu0aexoiocoatop e n ilt)teuo(opio1amenlivs s sDra(rpno0oleo f3tld a um( o;(4trtomf tytlmteanes;t) eurirpiy1ame  fci () rum( o;u0ale  iciyslm ul(vsnu4alxnxocoatopt  n o t)s2trio iu1lltnmivi () 2trumono1aetnmociysfsDemnmpn(4tlermr ia1fa eln s () rurxmpoodlp n ivil()aDrmumpoo1ale ifciatla2elu o;t4 rermr3tytoa r nei s)t2toxopou1llt mfctl( aDua(ro;t0oleomfciyt mDum(mp u0 eerircta1om  an s;( seuoxm oo4oltemietas arur(rp;o1oeto fetatlm2eluvp;t0treoxfctodlm  aivi t0s2xriopnu4optnlivi t)srta(mpou1olxn octasfm2emu p ()tetoiocoatla r ivi;s) eumxm3oy4omt mivt ()s2rauront1oetomfcildla rln onu0aeerxoctatlaDeauvo s s2trxo nodamt lfcsltfsrtmurpno1tpxomociadfm el(msn(4alerxr3io1oaD li i;s)s2uoxr3io1al nliet t s2uaxrpno4tlenmoctldls2raumonu4arenxf3oy1omD au s s)teuoxo3oy4amte fetlsfaDum(m ;u0oexnmiciltfm2elnmp u0tlermo3to1op  aieo;(0 rumimpiudlp elicias  rtrx pno0oetnmoeildla2ulnmp;u4 lxrifctodfmDraneo t0trtmxr3oo4optemneilt)a2urxro;u4ole mfciatls emuvo;u)artnmo3ia1om eluvi ( srtoio iy4lmtemnctls)srumx pno4optomocildla ea(vont)altnxocty1lm r nei s sexoxr nodamt  fvs s srtaxmono0ape  octldla2emn s;t0trtoif3oodlatrlu ils setr(mpno1lle livs t sDtm( poo4oleoifetysfm2rl(vsnu0alxnir3oo1omD aies ( teto(o nu4opte ivt sfarururoou1teto f3tld m2rmuvo;t4 eerircoytlmt au i s)tetr(o3io1llee feiat a2rmuroou0tex  ieils mDrm(ms () lermf ty1faDrai ils s2toxmpiudomtelncs t) rtax  ;u0tee mfcilsfmDeauvp;()altnmrcia1lpt  ueo;s)srtoirpou1al eliesl() rur(  ;u0apx  i3iltfmDrl(mo;u4 renio tytfaD  ies t) rurirpoo1op  lncs () 2rr(rpnu0oee iieilt a2umnmp u)altnxr tatom  auvo;( tetoxo iu1apeemncslt) Dtmuro;o0tlxoiiciyd s2rmu on(0trxomocoa1oat lnes s  eurio io1al   fvi tf rrmurpnu4texnmfeiat s2rlnmont)trenircio1la eaivs t s2uo(opiy4aleeliei (  rtaur ;t1opxomo3iyt aDrlnmont0aeenif3oytfmtelu i;s0trxmxo oydlmenlnetltf 2rmxm oo4oexomociytfa2eau snt0aeeoir3iatfp  lnei ()t2ur(opoodoltemfcilsfsrtrxmo;o0tlen i3tad a2uauvs u4tltnxo tadlpt ai o;s0s2tr(o3ou4ape lfesas) 2rrxroou0tetnmoeiysfmDrlu pnu4trerifcoa1fa eli slt)s2to(m nu1am nmfvtas)s2umxrpou4aptoif3iatfaDeluvs u)tetnmocoa1omtrluvo;(0srxoim3oodolenlfet (f 2ur(mpot1aeenmfciatlsDran snt4 rxrmo3tydopD  ieol(0 2xoir3ny4altnmnct tfaDrrxmont0apenifeiys a ea( p ()tlerir3iydoa eaneilt) 2umxo3oy4amt mfvsl()srtaxmo;o0alxn oeiltfsDran s u0alxomr3iatlpDelivolt seurxopiydopte fci t s2ra(m ou0tpxomf3ils sDem(mo ()tlxrxf oatomD  ivi;( seuoim3nydap elnetlt) rra( p;t4open o3iad sDrm( snu0 lxnmr tatlm e nvs () rxrio iu4optn feslsf 2tax ono0olxoiicilslm2rluvp u4alxnxf3ta1om rlieol(0texmir nu1apenlncsa(fsDua(r ou1tlxoif3tytla el(vs u4aetoio iydlptean sl()trxrxopnydapte neilt)s2trumonu1ole  fetldlmDeanvsnu0altrxr3iy1fmDelnvo;t0 rum(m3nudomenlivil( arrr(moou0aetoiociydla ra( o t)tltomr3totfmtelu i;(0trxrim no1alt livils aDrr( ont1tptn oetlsfaDul(von() leoxfctatoaDr ivs s0trxo(m3nudamenmfesl(faDumx ont1ale mfetydlsDra(mon(4 eenxrcto1faD auvs s) rtoir iu4olenmneta( sDtm(r ot1oetomictydlsDrmnvonu4trtoif oy1om r ies t srxrim io4amtelneta()aDtm(mo;u1optn f3ildla2rluvont4texnmr iotom   uvo;t seurxm3oudlmee fet sfaDrmxmp;t4olxo fciyd sDrauvon(0alxoifciytfmDrln s t0t2umxmpoudap  lietl()sDtaxr nu4altnmf3iys a2uln o u0 ltomrcoo1lmDeanvolt tetr(m nodlp  mnctlt s2tax ooo0apt  ieiydfa2uau pnt)alerxrciotfate nvsls0texm(m3oo4ope  ivi (faDtrum nu4opeo fcild s emn o;(0tlerirciatlaDr i il( seum(r iy4omte ietl(fartaxmpnt1tptomf3tadfa2ua(vp;() rtoxr iotlaDelivo;t s2um(mpio1lme lnvt (  Draum nt4opx mi3tyslm uau o (4aleomo oodlatr nvs s)srtmio iy1alee fvilt)s2urur oo4tpe iiciyt sDelu snu0texomo tadfa  auvo;t texr(o oydal nmncs ( sruaumo;o0alxoifeiat sDrl(vs (0altoxrctadom   nesl() rumirpiydolee fcsa()sDtm(moot0tleomo3ildfmDrm(vo;(0tltoxo3iy1fat aueo;( t2toim3oydomtnlivtasfarur(m ot0apx ifetytfsDulnmp;() ltrif tadfa e ieolt  etoxrpny1al emiesas arurxm ou1teeomfeiat m2eluvo t)alenmf3tytlm   uvilt)trxrio3oy4ale  netlsfa2rmx  oo4olx ifetad a ran p t4artnxf3ootoaD ai slt setrxmpiu4lm emnctatfsrrmumpno0texoio3tatlmDul(msnt) lenioctytlaD ln s s trxmir3nodll emfvt ( artm(m ;o0aet mfciydfa2uln pn(0aetoxf oytlpDeauvo;s trur(m3ou4op emivtltfa2ua(  nu1aex  i3iatfaDua( s (0 eerif iytla  lneils)trxr(r3iodoptnmfci s)aDrrx  ;o1tle miciyd a2elu o u4 leoif iotla   nei t)seumimpiudom  mies tf Drm(ro;t4olxoif3tadfaDuanvs;u0 etnio tydlm eaiesls0s2toio nodop n ivtat) rumurpnt0ale ifciydfs2ra( o () eerif3oy1fatelieo;s teuoxm oydameelfes t  2taumo;t1teeo fcilsfs ulnms;u4 rxrir oy1la eanvo;s)tetoiopoudll   netas s2umxm ot1alxnmfeiad s raumon(4aleomocoodla  auvslt)srurirpnu1ap  lfci t)sDuaxmp;o4tpe ioeiyslmDrm(vo;u4 rxrmr3oy1fat liei;()tetmxopoudlltn fvtat aDtrxmo;o0oet iociytfsDrm(vs;()trtniociadfa   ieo;t0t2umim io1om nmivs ()a2tax poo1aptnifciyd m2elumont0aeeoxf iydlaD li i (  rurxr ou4apeemncil(f Dta(mpnt4oeeomi3ilslmDelu p u0 lenmr tadlaDe i ils) rtm(o oo1om elnctl(f Drrxrp;u1aptn iciydlm2ulnvo t0trtoxo ta1lat au s;t) rtmxr3oydamtn fetl(f Duauroou0oee mf3iad sDrm(mp;(0 etnio3iydfpD livi;t0 2tmxr3oo1omtnliei ( aDururonu1alt ifeiatfs emumsn(0tleriocto1faD auvi t)trtmimpou1al nlncs ()aDur(m ;u1apeo fetlsfsDra(vs u4aetnmr tydlpDraiei t trxrirpoydlpeelnet (f 2um( ono4olx  i3iatlm2rlu snt0aexnir3iytfm rau i;t0trxoxm iu4apt  nci tfsDua(ront4tet moeildla2elump;(4tltrif ia1fat liei ()teto(mpio1op  lneslt sDurump;o0oleomi3iyd a2rmuvp;t0treomfciatfat anvolt0t2umxm3oy4apee ictlsf Drmxmpou4oeenii3ildfs ranvo;u0trxrir ootom e uvi;s  etmir iudoltnmivt s) Dumx p;t1tlenmf3tysfa emu p;t)al
\ No newline at end of file
@@ -0,0 +1 @@
+ieslt0trxr(mpou1lme mfcs tf 2urur ;t1oeenifeiltfs rmn o;u4 exoiocoatlpDeanvi;s  2xr(rpny4omeelfctl()srtaurp;u1alxomociydfa2ra( o (0trtrio3oodfm eliei;(0 2uo(o iy1al emnctatfs2raxr ;u0tle mo3ilt m ra(vo;u0tltrmf3iydlm eaivsl( s2tm(o3ny1lp n fetlt)sDtr(rp;o0tlt  f3tlsfsDulnmp;t4 exrmocio1fm   i sl(0 ruoxopnu4oltelneias aDururo;o1olx iiciyd s2ra( p ()areoif3iadlaDe u sl() etmirpou1ap   ict () 2uaurpnt0ape  fetyd s um(mp;t4areoio3to1opD luvilt  euoim3iu1altnliesl( s2rr(rooo4olxoioctatlmDrm(mpnt0trxoxfctytopDelu s s  eurxmpoo4al n neslt a2rru  ;t0oexn ociasfaDrmu o t0 etnif oatlm  aieilt)seumxo3oydomtn fesatf Dtaumont4oeenmfeiatfa ulnvp;t4arxrxo3tytoa r ues;s0t2xmxo oo4lp emnvils) rum(mpno4tlen f3ils m2ulums (4 etnxocoadfmtrluvs t  eumim iu1lptelnct (  2uax  nt4tpxnio3tydfs2em(mpn(4artrmr3tatfat  i il()t2xrxm nu4lltnmivta() Drrur ou0tlt if3iyd mDel(mpnu)tlxrxf tytlpt  ivil(0 2toir3oy4lptnmfvsl(fs2um(r ou0oetnii3iydfs emn onu)alxoifciatomD lnes;t0seum(m oy1ol  mics (fs2tmumpou0oleo ietasla el(vp u)texoxf3ootomtraivo;t)texoir3oudlm e fctlt)sDrmxm nu4tlt mfetydfa elnvsnu) lxrxr tydoat ln o;(  rtr(r3ou4alen fetls) rtm(ront0tpx  fctytlm rlu ont0 lxnmfcty1fpD aivi t  euoim oo4lm  mictasf ruaxro;o0aptomi3tlsls emump;t4 etrir3iydlateauvo;t)srum(mpiu1apeemiesls  2umu p;o0opt  feilt m elumpnt4 rermo3iadoptrli s;()seto(mpiudom elnet tfs2rau pot1ope  iciysfa2rmnvsnu)altoxrcto1opteliesls)t2tmirpnodllte ivsl() 2rmu p;t4olxo o3iatfaDul(vs t0aetnir3oa1la  lnes t  etr(opiydlltnliciatfsDtmxro;t1olx miciydfsDuan s t0alerxr todfaD livilt s2trxo oy4ame lfet t)s2urumpou0tpe mfciadls2uauvs;(0aexnirciytopDranvslt)trtr(r ny4lme lnci s) 2tru pnu1tlt  i3iydfm ul( o;t4aeenmr3ty1fp   n i;t  rxm(m io1alt mncsa(f rtaxmpno4tltoif3iad m2eanvonu4tlxnxf3todfpt aueolt0trtoxm nu4ll emfvs ()artaumpou1ope moctlt sDea(msnt4tlxoio iotoptrau s s0 2toxopiu4ap n icsat aDta( ono4alxn i3tad a em( onu4areriociotfateau ol(  2xrxrpou4al  lncs sfaDrm( pou4tleoifciadfaDumn o (4aeermociatfaDraues t) 2umxo3oo1lp e fvil()a2uru  ;o1tet miciadfmDemnmo;u0 exnif iy1oaDr uvs (0t2xm(o3nu4lleelnvsl( s2uax oot4oleoiociadfs eluvp u) exoiociatlat  nesls s2xrir3oy1op   fci t srra( onu1tetnmieiadfsDumu p;u) lenmfcoy1opDeli i s  ruoxr oudol  mnvtatfarua( pot1oexoiociysfaDrm(vpn(4aexoir oatfmDean s s0t2xrxmpoodam   ies s) 2umxr nt4ape  fciasfsDranmp (4altrxo3ty1opDrlu i t)srurimpiu4alenmfci t aDtrum ;t0tpxoif3tadfmDrluvo;t)trermr iydfat lieo;t0trurimpoudll   ics ()s2uaxm ;t1olxomoeiydfa em(vp;u0 rtriocio1omDrli slt0truoir nodopt lfetas a2tr(  ;u4tlxnmo3iydla em( p ()aetrxr tadom rli o;t texrxo3no4ope  iviatfartmum oo0tptnmietysfa2rlumont)arenif3ta1oaD luvo;s) exm(r iu1optelnes ( aDta( pnu1oltomi3iat a2rmump;() rxrif tydoaDelivo;s0 2tmxm3nudlp  lfctltfs2truro;o1opx iieiyslm umnmp u4aeenir tatfpt lnvils0sexmio iodomee ivsasfsrta(  ;u4tpt  octytfm ua(vo;t)tlermf iytop eau ols)texoim ou1amt  iet s)s2tmxrpno1tpt  i3ildlmDem(mpn(0trtoircia1op  ai i;s sruoxrpnu4amenlfvt t aDrr(mpou1oltn iciysfsDrluvpn(4aeeomrctytfpDr ueols  rxrxopoo1lm nmfes s sDrr(mp;u0opeoifeiytfsDrluvs;u0altomf3tydfpt lieols trumim iudapeemicslt s2rm(ro;u0olt mfeiasls2elnvsn()teermfcta1op e neils0 rxmxm nodom emfvil()aDtaxm ;u0alxomietasfa el( onu0 etoxr3oatlaDe ivils0tetm(o3ny1ale lncsa()sDrmxro;u0tet mi3iytlmDra(vp;()teeoifcootop r ivolt s2tr(m nu1ap  micia(fa2rauronu4open fetatlm2em(monu4areoxr oydfpDr n ilt0srtoio3ou1olenlieiltf Draxro;o1oee ioeildfs2umn o u4artnmo tadlpDelnvo t0srtmxrpiu4oleelnvtl( sDtmu p;u0oetnmf3iydfs elnmp;()tlxnxf3ia1laD ai o (  euoxrpoo4apt lncsat)aDrrurpot4tet  feils m rauvo;t4 eerif3iatla eau s ()s2xr(r oydome lnvt sfaDuaxrpnt4opt  ieiltfsDumuvs;(0aetomoctodfateau o (0s2uoxo iydope mfvils  Dta( pnu1aexn fetys s uan snt4teeomociodopD au s () 2uoimpnudlleemfci ()arum(m ou4aee  octysfaDumu p t)aexnxr3todlate ies s)s2umio3oo4alenlivils  rtm(rpnt0oexnmo3tadfm2rauvs ()trtomrcootlatelivs t) 2xo(o3ny1apte ietas)srur(ro;u4aeen oeiatls2ul(vo;(0tlenio3iy1opD lues;()setoio oy4apt mnesls) Dumxro;o4tee mi3ilslm2um(msnu)artomf tadlat  n ils0trtoim3iy1opt lnciat sDraxr nu0aptoiieiyd mDum(vo;()aetrxf3oodlmtran s;t)srur(rpoy1lleelfcta( s2urum nu4openiicilsfs emnvont0areriociytfm eaivo (0srxo(opnodop e nes sfa2ra(  ;u4tpxn ocilt aDra(mp;(0tlxoxo3oodfp eauvolt)teuoio no1amenlfcil(fsDur(mpnu4alx  feiad a ra(vs u0arxnxfctodopDe nvi;t0srurxm oy4om e fcils  rtmx poo1alxn feiydla2ea(vo;t0 lxnmrcoadomDr nes t)srurio nydllt lieias sDuau  ;t4altoiictlt mDraumonu4trtnmrcoadopDrlivsl()trtmio3oo1opee nvta( sDtrum ou0oeeoifeias s um( o;t0 lerxocoodfpteau s;s tetrxm oy4lltn netltfaDrrur ot1apxn oetld a em(mo t) exoircoadom rlivi;s  ruoxrpio1op nlfetatfs2urxmo;u1tle  ieilt aDum(vsnt) rtnmo ta1faDranvsls s2urio ny1al nlivs s  Drauroot0tpenmi3tydlmDrmnmp (0aexrifcto1om e ieil()teum(r3iy1aptemfetas)s2uru  ot0aeeomf3ilt sDumn onu4aexrxr io1opD lueols) 2to(o3nudome lnesatfsrtm(m nt1apeo i3ils a uauvpnu0tetoxo3oydlatr ivi;() euoxrpiu1ol nmfvi sfsDurxm nu0apt mo3iasfa uln ont4tetnxfctatoptrln o;s texmxopio1ap n fviatfsrraxronu1tpeoii3ias m2uluvpnu0arxoxrctodfa raies s  rxoir io4omee nctl(farur(rpnt4ole moeiad m2ua( o;(4 renxo3iydlptrai ilt)t2xoxrpiu4om n fetasfa2rru pou4aexomoeiatlmDul(vs;u4 rerxrcoo1fptrlnes;t0srtoio iy4lleemfeilt aDumurpot0opt micilsla2eln sn(4 rxrxr3ootfm   ueils)srxrimpiodol elfeil( s2rmum ;u4apxomietyt m rmu s () lenmr iydla eliei;(0 eumim oudoleemict tfaDumxronu1aeenifetydfaDrmn o u0 lxrif to1opt  nvs ( t2uoir3oo4lp elfvsatfa2rrumono1ale  i3tldlm eauvonu0arxrir3iadoat  i sl()texoxrpoo4alt mnctltfsrua(  ou4oexnii3tltls2em( on(4texrxrcoadopDrau i;t)trtmxm3oy1ap emictltfa2rmx p;o4tleoifciadfs2emnmp;u) eerxf3oytlmDeanei s)srtmiopou4lp  lnesl(  2rrxmpno0tee ioeilt a2uaumsn(4tleomr3oa1op  ai i;s0 etmim3no1omt  fvsa() 2raxm oo1oeeomo3tas a umu ont4aetnmocta1oatean sl()sruriopiydom  mict t s2rrx p;t0teeo ieiadlm2em(vo u4trxoircoytfm e u olt0 2xr(m oo1aleemfci tf 2ur( poo0tet iieilt m ra( o;(4tetnmrcio1fpt an s t)seuoxo3ou4lpt mivta(fsruaxrp;u4tlxomociadlaDumuvpnt)aetrir3iytfmDrlivilt0srtrio oy1am  lieils)arta(rp;t0aet  feiltlsDemumo;u4aeenio3oytfpt livs s srxo(o io1amenlies ( s2urxmpou1aeeoii3ilt m el(mo;t4alenxf iatomDeau s;t0 2umxrpou1apen nes t)a2rrumoou0oltn feiatlm2raump t4arenxf oatoa  li i;t0teto(mpou1opee nei t)srurur no4open o3iysfs ulums t0altrmr3ootoaDeanvs s0 2tmio3iodop nmics () Dta( onu0texnmo3iadls ulnmo (4tlxnmfcto1lm elnei (  rxr(rpoodlm nmiciasfaDtmxmpnu1alxn o3tldlsDrmnmpnt)alxrmo3ty1laDranvs;(0teurio iu1ape liei t artmurp;t1tlx ifeiad a2el(vs t) rtnxr3oa1fmD anes;t t2xm(o oydam emncs s  rraxrpoo1altn fctyt sDemnvs t0trxoxoctytlmD livi t0 rxrxopno4aptelfcsas aDum(ro;o0opt io3iyt m ea(ms u0 eermr tadla  ai i (0seurim no4om emnvta(f 2rmum ;u0aex miciatfm eln o;t0trxoxr3oa1faDrlneo;t0tetoxr3no4lm  livsas  2rr( ont0tee mf3iyt s2rm(vs t0aeerioctotlmtrau o ()setmxm3io1alenmfeil( a2ra(mpno1aex if3iyd s2um( onu0aexnio iydlaD auvs;() rtmimpnydlmtelnvs tfsDrrxronu0aetnifciydfs2emnms;(0treoifcta1fp  lues;s  rxoxo nu4ap  mnct t)a2uaum ;t1tpeo ieiatlm rlu pn(0 lxoircoy1omt luvs t t2xoxrpoodomenmfci s s2um(m ou1tex  ociasfsDrmuvsnt0 ltrxr3oadfp  livslt)t2xr(o3io1ope lfeta(fsDrru  ;t1apto oeilt aDrl(vonu4tetrxociydopDeluvs;t0trurxm3oydal elict t  2ua(rpoo4aexnmoeild m rl( o t0arxoxrcio1opt aneol()srtrio oo1apt lfvtltfs2umxr ;o4oetnif3tas m2eaums;(4 rtnxr3iatom   n s ( srxrxr iudam nliesa()aDurump;o1oexn fcilt m2rluvo;(4trtnifcoo1faDe ivs t sexrio ou1ape  ies sfa2trumonu4tpxoiocilt m rmn s;(4tltrmr iydlmt  nvolt  rxriopnu4lpenmfcsat)artaxmo;u1aee  octaslsDrauvs ()aetomf3totlp eli s;t0 euo(m3oo1omtemfvs ()s2umuroou1apxn f3iatlaDeln pnt0altnmo ootlaDrlneslt s2xoim nu1ol elicsl(  Dumx  ;t0oltomfeiasfa rmuvp ()teermr tatomDr n o t texo(m3oo1opt mneil(f 2taxm oo0altn f3iyt aDra(vsnu)aetomf iytlpD aneilt srurim3ou1opeelfcilsfs2tr( p;t4alxnifetasls eln sn(0trxnxr3tadlp  lnvol( t2tr(m ou4lm n nei ()sDumum no0tlxomf3ilsfsDul(ms u0 rtrxo oodop rlneol(0sexo(m iydomeeliesl(  Duax  oo1apt ifetlsfs2um(vonu)tlxomr3iotfat au il()tetoxm nydlpeelncsl( s2ur(m no1oexnif3tyslm umums u0 lxoio3oadlpt lnei;t)t2xm(m oydlmen fvsa() 2raxmp;u1tetnmi3tlsls uan p;u0trtrioctatfmtraueo (0srtoxm oydope micsa( aDra(  nt1apt mociltlm eauvp;(0arxrxr ty1fmt ln s;()srtrio iudole lfes t s2tauro;u4aeeomf3tltfm2raums;()trxnmf oo1lp   i sls  2uoxo no1lpte feilsfsDtmumpot1teenmoeildlm2um(von(0 lenmfciadlmtrlivolt srtmir nudll n ietat srtr(r ;u1aptnio3ils s em(mo u4 ltnio3oytlmt au i ()trtm(m3nu1lm nlfct tfsDraurp;u1oeenmieiys s2rauvp t4teenxfcoytfmt  iei;s  rxoir iu1ameelivtl( sDumxrpoo0aee miciytfmDumuvp;(4teenif3iotfa ranvi s)t2umimpoo4ame lfeiatfsDuax p;o1tetomi3tldfa elu s;u0arxnxr3to1om elu ols0trtm(o3ou4openliet sfsDrm(m ;u0alenmf3tatfmDra(mo;u4alenmocta1lmtr nvilt0truoxr3nodamtemfvtas)aDrrum ot1aetoii3ilt s2em(ms t)aexomfcoadfp rluesls0 2urimpno4lp nlivs s s2raxm nu1alx  feiatfa emnmsn(4artniocio1fmDelivi (0 ruoir3nodol n fvslt  Dtau  oo4oleo ieiys m2ea( pn(4 etnmrcta1fp r i ils0s2xoxr3no1alenlnes s)srurxm ;o1aeenii3tlsfmDrauvonu) rtrio3ia1om  lneo;( tetrir3iu1olenmnesl( sDrrumont1opxoifciadlaDrlump;u)aetnmr ta1lp e i ilt) euo(m3iy1ap nmies t) rtau onu1tlxn f3tytfs eluvpnu0texrmf3ia1fmtrli sl( seurimpiu1lptn fvta(  Dtmxmp;o0oltoii3ildlsDumu s (4alxomo iatlp  auvilt0srxmio iy1amtn neil( a2taxmpno0tltomfeiyslsDeanvs;(4aetnif3oytlm ranes;( trtrirpio1am nlfeil(f Dumxr no4aetnifciytlsDrlu o u) rtrxo oy1lpDraiei ()s2tm(r iydlp emict sf Drmxmo;u0alt mfeias a emnvsnt0tltoif iytlpt lu i t)texrxr iu4llt lncs ( s2tmxr no1optnmicild m elu p (0 eermo3io1laD luvslt0 etm(r oo1ll n ietat)a2umumpou1apeniietld s emn onu)trermfciadla ran s ()s2toxr3nodamtnmfciasf Drrur ;u4teen o3iadlsDul( s;(0texoio3ta1op   ivol()srtm(r3iy4lp n nesas)srtrur ;o0tltnmoetatls ua( snu0aeenmo3oatom r uvsl( t2trxopoydlmtn nvsas  Durum ou1tlto i3iatlsDrau o t4teerio to1lm r ues t)teur(mpiu1lme micsa(fs2taxro;o4alto oetld s2uau o;(4arermf3ootom elueilt) rumio oydlmt mietlsfaDtrur ou4aptnmo3iyslsDemnvp;t)aetomoctotopDe nvols  rxmxo3no1lpe  ictlt a2uau p;u4opeo fciydls2umn pnt)alenxrcoatoatr nei;()s2tmimpnudome  nes sfaDrrx pou1texoiociytfm2el(msn(4aeermo tadfmtr uvs ( t2um(m3nodll emneiat)sDrau onu4tex miciad sDrm( s;()texoircoodfatr nvol()srurxr oo1lmtnmncsatfaDtru p;t4ope mf3iadfs2uluvon(0 rxoio iotom eaivol()seumxo3nu4ameemfcil(fsrrmxr ;u0tee mietat a2rm(vonu0 rermo totlptr ivs;s0 rtm(o3nu1opeelivi tfs2tmurp;o4teenio3ilsfmDem( p;u) eenifcio1omDean o;s s2xmir3iy1ame  net sfsrrmuro;t4aex  fciysfm umuvp;u0arxomo ia1fmte i il()s2tr(rpou4omtemnvsl(f Dumu  nt1apxo ociatla2um(vs t) lerif3oodopt  nvsl(0s2xmio iodopeemfvi t)a2rmx pno1tpe mo3iat s uluvsn(4tlermo3ia1opteanvo;()texrxm oo1lmtelicils)srtaump;u4alen iciys s elu s u)trxnmf3oadom e u i s)texrxrpoy4lltnmivtls  Dtru p;t1altnmiciys s umuvp;u0 lxrif3tydoptr nei;()srto(o nudamt  fviatfsDtmuront4teeomfeiltfa2rmuvs (0tltnmr to1lp  lnvi t trtrim3nodam   ics s a2tm(monu0tpeo i3iyt a2rl(vs;t4arxnmo3to1fate nvils0 ruo(r3iydlmen fcs tfarumx pno4tlt  fciad a rl(mp;u4 etrmo3oatlaDrlies;s0trxr(opnu1am e ivtat srtrxrpno1oee mo3tyd s emumpn(0tlxoxo3oo1fptrlivi t)t2xm(mpoo1omtelfvsa()a2tm(  ;t0tlxn octytfsDulnvp t0arxomoctadoaD  ivi ()t2tmio ou4apt  fvta( s2urx p;o0oee  feiysfa rln sn(0texrmocoa1opDeanvolt)t2xoio3io4opee neil( aDumxmpno0oex mi3iatfa ulnvs (0arenxociy1opt lneolt)srtmxm oodlpte ict t)sDur(m ot4opeo i3tytlm emuvp ()aexoxr3iadfpD anvs s srum(mpnydlptn nciasfs2rauronu1olxnmo3ilsls2ua( s ()teenxr3oadfa r ies;s0 eum(opnu1olee iesa()arrrurp;t0apx  ictas m2ea(vpnt)trtnir3tytom ean i t srtmio3iu1open fvia(fa2rmurono0tpt  fcild s2ran o;t0aexoxf3to1oaD  iei t0trxrir3iydaptnlnetas) 2taxrpoo4oltomieilsfa2umn p () renmo ta1oaD  iei;(0s2trxm3oy4alenlfcsltfsrra(m ot1aetnifciyslm2ulnmpnu4altoxfciy1fate nvs;s tetm(opoodap elnvil()arrmurpou4oee  oeiasla2uln s u0 leomrcoodlmtelueo s)teto(m no4om nlfesat arum( pou4tee mieiydls rl(mp;(4 rxrioctatom ean s;s) ruoxr3oodol elfctl(  2tr(  nt4aptoif3iaslsDul(msnu4arxrmfciotlatrauei;s)t2xrim3iu4lp nmfeil(  2ur(m no1oltnif3iatls umuvo u4 etnmo3oytop ean ils) rur(opoo4ol e fvt s)srrrxro;o0aptnmieildls2uluvs (4tltrmr to1fm r n s s) etoirpio1alt  iet tfs2tax ono4tpt ioeias s2rln o;u4 etnmrctodlmtr i olt  2umimpoy4lptelicslt)srtmu ont0oeen ociatlm eluvp;t) lxomrcoa1omteanes t  2xoimpnudalte fesls)a2trxm nt0tltn feiytfs2em(vp u0 exomocia1faD  ivs s0srum(o3nu4ll nmietlt)arrmuro;t0alxo fctys s2rmn pn(0arxrxo ia1lpD luvs (  eurxo3ou4aleelnci tfs2rru o;t0tpe ifeiysla2elnvp;() lxomocoatfaD luvi s t2xmxrpnudol   fvsat sDur(rp;o1opx mieiatlaDemuvo;() rtrxr3oodfm rlieols0tetrxm3ou4ll elfeias sDum(r ou1olt ioetasls uaump ()teenxr todfaDelnes;t)s2uoirpny1ame  nvt tfa2raurp;u4aetn o3tltlm2ul(mp t0aeerxr to1op elnvs s teuo(r3iydlle  ivta(fs2ra(  oo1opxniiciadla2rmnvo t4trtnxo3oo1opDeluvi t0teto(o3nydamtnlicsls  2ta(  ;u1oet  oetadls2ulnvo;() rxnif ta1fm  lieo s0 eurxm3iu1lmenlfvsls) 2ua(rpot4aptnmi3tytfs2ea(ms;u0 ltrio3oa1lp rlnesls0 exrim iudopt miesl( aDrm(r nt0open ociysfa um(vpnu0aexoioctatfpDraieils srto(opiydamtn iciat  2trumpno4opxomoctysfs2ranmp;t0 rxrir3iodla   ies t0s2tm(m3iy1ome mfctlsfsDrmur ot4alxniieiytfs2ul(vp;u4texomr3todfa rlnvol()setoir3nu1ll  mncs (fsDurx  ot1aptnmf3tat m ulnms u0 lxoiocto1la r ues ()teurio iu1apt  fci ()a2umum ;o0tex ifcilt m2ean o u)tetrxo3tatla r ivsls0trxrxopno4ll nmieilt) Draur ot1alen feiytls eln s u)aetoxf3ootfp rlneolt0teto(rpoo1op   ict s)a2taxm oo4aet  iciltla2um( p u4texrxrctydoaDe ivs t0s2uo(m3nu4ll  mieslt)srrm(mooo1opeomfciadfs2el(mp;()arxnif3totla elneslt0truoim3oy4lle micilt  2um(m ;o4texnmfciad m em( s;u)tlxrif3iydlp e i o (0srtmxm3iy1ll elnctl() rrmx onu4teto i3tldla ran o (0trxoxrciotfa e iei t) etrirpnodlp elfci (  Dtaurpnt4oex moeils s ul( o;u4tlxrxrciatlmt  u s ()srxrir3oudolenliciat)srurxrpot4oeeo oetysfa2ua(mp u) rtrmocootoptrau i;t0t2tmxo nudam  mfci ()srta(mont4tlxnif3tld mDumumpnt0tetoif oy1lm r uvo (0seto(m3nydamte ictasfsrumx oou1ope  fciltls2emu s u)tleoxocoy1fmt luei ( setmir3oydlmtemicsl( sDtr(rp;t4aeeomo3tldfa2elums (0 rxoxo3ty1lpD lneils0trtmxr3oy1al n neilt)aDra(m no4tpxnmo3ias sDeluvs;u4 exnxocoadoat lieo;t  2tr(r nydomte ivs s)aDraxm no0tpen o3ildfa2ean pnu)aexnmf iodfp  ai o (0teum(mpnydop n ivta()a2tr(r nt1tex iiciysls ea(vs u0 rtnxr3oatlpt lneil(0 2uriopnudlpenmfei s)aDuax p;o0opt mfciasls eanmo u0tetrio3totom eln i;(0tetr(o iy1olee ici t) Dumx  nt1tpxomieilt aDul(monu0 lxriocoatfp elnvi;( trtrir3ou4ale mfetat  2taur nt0tltnmiciat aDrmn s;() leoir3iadoa e neo;s) etmiopiodal nmfviat s2rrumpoo4aexomiciad a2rm( on(4artnxr3ty1omD lnvi;t trtoio iy4optn fci s)a2taxrpoo1tlenmoeiltfm2ra(vo (4 rxnir3iodlpt  ivs;t)trtm(o ou4amt mnvtlsfaDra( o;o0oexo f3tlt m emu p;t)texniocoo1oa eln sls seto(o3oy4altn nvi tf Dur( p;u0apto oetltfsDuln o ()texnxfciy1lmD lueol( texoxr3iy1lltelfvsas)arrrx  no4tlenif3ilslm rmn pn(0trtoifciodla eanei;s0t2xoxrpiu1amt mnvi (faDuax p;o0tlenio3iyt m rluvp u0tltoir3totfatr uvi;(0 exmxrpny4ale  fcsls)aDuaxmoot1apt  f3tlsls2em(vp;(4treoxf iotlmD luvi;()trtrxr3oydlpt  feiltfsrua( onu4apxn i3ildla2uaums;(0artomo3ty1fatr ivi;s teuo(mpiy1al nlics s sDrauro;o4alt  i3iatlsDemuvs;(4alxoxrcoytfmDe ivol( trumxr3nydopeemfeias  2tmxronu1tpenmiciltlaDulumsnt0treomocoodlatr nes;s) eur(mpiodlmtn neia(fs2um(m ot0tpeniieiyt a rmuvonu4teeoxo3oy1fm  anvols)teur(m ou1oltnmfvtlt srtm( oou1oeeomf3ildfsDrlu s (4 exnxf3todlaDeli ilt seurxo3oy1ll elnct sfaDra( pno1altomi3iytfm umu snu0aetnir oy1lmDrlnvil(  2toio no1lptn ivs s)aDtaur ou1tltnmfeiysla rmu p;u) exoifcta1fa eau olt0srto(m3nu4aptelnesl()sDra(r ;u4tpt iieildlsDelnms;t) reomfctatlp  lneo ( sexrxr iu4lmenlnci (fsrtmxmono4tlenif3ilslmDuaump () etniocto1fptrauesl() 2uoim iy1lpt lnes ( s2tmu  oo4olx miciadla uan o (4areomr to1fateluvilt srurxr3nydal  lieilsfa2umx  ;o1oetnmietatlm2rm(mon()altoxf3ia1fp rlueil(0 rxmxo oodopte ncilsfsDrm(  oo4oee  oetydls umn s;u)alxrirctodfpD luvo t t2urxm3iu4olenmiesat  2taxr no0olxoii3tltfmDelumo;t0alermrcty1optrluvsl(  2uoim iu4amee fvt s sDtmx  ;o0tptnioctad s ua( on(0arermfcta1fa r u slt t2tmir3ny4om nlfcias a2rrxm ;o1teto ociat m2ean o u4 rxomo oadfmteaies;s)seumxm ou1openlieiltfaDua(  ot1opxoii3tydfsDuanvp;(4aleoxo tatlptr ues;()seur(rpou4ap n ivi (fs2rrx ono4oltoii3iadla2ulnmsnu0artnif oa1faD  u s;(0s2umxo3iy4lptn ieta()sDraxmoou4oex  o3iat s2elnvpnu4arxnmf3totlatrlneols  2uoiopoo4omtemicsatfa2trxmo;u0aleo icildls2umu s;t) lenmo3oatlp eanes s trumir no4omt  fvsat aDra( poo4oee if3ias a2rmn o;t4tlxoxoctatfa e u s s)texmiopio1ameelnvtas) rurxm oo4openif3tatlmDelu p t0 eeoifciatla r nvilt)trumxm3iy1omtnlivtas  2uaxroot0oeeomictlt aDem( o;()tetoif3io1lp rauei (0seur(o3iu1olenmfctltfs2taumo;u1apt mieiltfsDrm(ms u) lxomfcoatfa r ies;(0 rtmxo3oodop nlfei t) rrm(r oo1ape mfctlsls2ean o;u0aetnifciodfmt  n s t  exrxo3oydlpte fesasfaDur(ront1tlxoioeiydfsDumnmsnu)teenxr3tatom eluvi;(0 ruoim nydlleemiei t)arrax o;t0alt mfetytfm2rlnvp;u0tltoxrcoy1fpDrai ilt0 eto(r3nu4apen ici (fa2ua(r nt1tleo f3iltlm ea(vs u) exoxo io1fp eluvsl(0s2xrxmpoy1lltemneiatfa2tr(mpoo1olxomoeiadfs2el(vo u)arxrxo tadopD lnvilt) 2xmim3iodlptn nct s) rrm(mpnt4olx  ocildfaDrl( s;t)trtoxrciy1fatraivolt)srurxo nydol nlfeil() Dtax o;t4tlxnmfeiysfaDrlnmp (4 ltoircoodfateai s s)teto(r3oo4om n ieta( sDurxmooo1opxn f3iys sDeauvsn(0 rxomfciotfmt  u s s) rtoxm iu4lle mivs s a2umx onu1altniiciyd aDuln sn()tlxomfcoa1lm e nvols0 2tr(r ny4opeemfcta( sDta(m nu1oleoifctydlaDem(mp t)altnif totlpt auvo;s sexoxrpoudlm nmfeilt)arrm(rooo4apt ioeiyt sDem(ms;u4 ltnmf oytlp e nvo t0tetr(m3iu1aptn fvs ( srtrxrp;t4opxnmiciltls um(ms u) rtnxociotlpDeaieo t sexoxr3nodam  mivtas)aDrm(m ot1opxnmociys s eaumo ()tlxniocto1lmtr n olt0teurir oydalee fvs t)srtmxr ;o0opeomi3ilt a2uanmont)tlxomf oydlmDe uvi;t)teurxo3oudop n ivtls) Dtr(rono0oltn fciys sDea(von()arxrircta1fa r ivs t t2uoir3nydop nmfvi sf 2rax p;t1olxo o3iltla2emn onu4 reoxr tadlmte u ols)setrim oo1apt lieils) Dtrx  ;t4tetoii3iatfa2el(mon() reoxr3iadlmtraieilt0 exoxm io1ole  nci t  rumxmonu0tltnio3tyt a uan snu4alxoxr ta1om rlneo (0t2to(o nodomen ivsl() Durx ono0oet  fcils m umuvsnu0 exrxr ty1lpDr neo (  rtrxo oy1llen fcia( a2tm(  oo0opt moetlsfa2el(mpnu0aetnif iodfm r nvi ( s2uo(mpou4om e iviltfa2urumo;o1tleo fcildfmDranmp;t4altrxf3todfpDean o s  euoirpoo1am emictatfs2rr(  ou4tpt iictlt aDuanvo t4 rtomrciy1lp ran i t0 etoir oydameelnvils)srtaur no1aexo ictysfm rmums;(0 lxrmo3tadlate ies;s0 rxr(r3oy1lpte nctl(  rumur oo4altomfeias m2umuvp;t0aeermr3tytfaD aneo () ruoxopno4ol e fci sf rtr(  no1ale ifetlsfaDraump u4texnxr todfmD lnvs s0 exoxopnydam   iesl(  rtrxro;u1teenii3iydlm rmn s;u4alenmociy1fp r nvi;t0 etr(m ny4lptemncs s  2rru  no0tpe  ieiaslm el(vonu0 etrxfcty1lmte n o;()t2um(mpou4lleelivils  rrmx p;o0teeo f3tydfs rmnvo (4tltoiocto1lp  aivs s sexm(m no1ll  lncsls) Dtru  ;u0oleomoetaslm el(ms u4alenmf to1fpt lu s;( texmxopny4al  mnesl()a2tmu ono1tltn ocilslmDeau p t) lenxr3iytopD lu ols) rxmim nydam  liet s)s2ur(r oo0opeoifctydfa2rmnmpn(4aexoir3oydop elu ils0sruoxm3iydllenmfvs t)a2tmx oot4teeo ociadfs uln on(4treoiocty1la  anei;(0 rtoimpoo4alenlfctls sDrmx oou1aptnifctatla2uanmpnu0 rerxfcoadfaDr nes ()trxoio nodll  lnvslsf Dtm(rpot0aet mo3tld a2elu s (0trtrif oa1lm ean s t) euoim3no4al   ncs s arrau oot0olx ii3tytlm2ulnmp;u0texnir oy1lpDr uvi;t)setoir iy4ale lfcs t)srurur no4opxn i3ildfm umnmpnt0trtoxr io1fa rliesl()t2xrxr iydlp nlnct t sruaumo;u0tleomoctadfa eau on(4texoioctydfpDran s;t s2xoxm3oydam elfvsl(  2raxmpnt4aee mocildfm ulu s (4alenio3iodlmtelnes;s  eumxopnudaltnlnviat) Dumum ;u4tltomfciatla2rl( on(0artomfcootlateluvilt tetm(r3oodale licsl( s2umx o;t0tlxn oeiysls2eauvp t4 exoif tadlateli i;(0srurirpnu4amenlncs tf Dta( ont4aee io3iat m el(vs u4tlxrifcoa1opDe i i ()trtm(mpnodolt lictl()aDrr(m ot0tpxoii3tltfm2elumsnu0tetoxocoytlm raivs t)s2urio3nu1lle lfvias) Drru ooo0apxoio3tytfsDranmo t4 etnif to1la r uvi;t s2xoir nydll nmnetas)sDtm(ro;t4alenii3ilslaDean p;u) exoxf3oytfpt  nes;t)teuo(o oo4lmeelfcil(  2ur( pou4aptnifetlt sDrau o;u0trxomf oatfmteai o (0s2to(mpiu4aptn nvt sfsrur(  ;o1tleoioctldlaDrlu pn(0alermf3io1lmDe ues (  exmio3ou4lme mnetl(  rua(mp;o4tpeo oeilt s rmu o t0 lenmr oa1lp rlivo;(0teuoxrpou4ll nlfeilt  rta(mpno4opto oetlsfa2emu o t0 ltrmo oydoaDrai s;t) 2xm(rpiodlpee ivt sf Dururono0olx miciys a2el(mp;(0 eeoxr3iy1lp rluvo;t  rxoiopiy1ap elnvilsfarurump;o1openmocild s uluvp;u4 rxomrcoatlaD  ieo;s  euoxopny4lm e fci s)aDraxr oo4oeto i3tadfs ra(ms u) exrir3iy1omt liei (0s2tm(mpoodameelivi t a2rm(mpnu0oex ifctltls2uanmpnt0aeenmf3io1fat luvolt0 rtrio3ou4lmee ivtlsfsrrrxrp;t0tptoio3tysls ua( p;()arxrxf io1fm eanei;t)t2xo(opnudalenmieia( artruroou4tpxomo3ilslaDuanvsnu0aexrxociadfm elieolt0 etoiopoy4al nlictas arra(rp;t4alxo oeiadla eau p t4aeerio3ia1la rln o s texrxm nudlpe  fcsat) 2umu pot4aptomf3tltlm2uan on(0texnifcoo1oa eau olt)srxmxr no4llenliei ()sDtaum nt1teeniieiltlm2um( sn(4aeerir to1opteaueols0 2umir oy1lmt lncsa()aDta( pno0texn fetatfmDeln s u) exnxo3tydlmteauei (0 rum(r3iodaleemfcs sfa2rrxmp;t0tlxo fciyslsDem(vp;t0 rtnmrciytfpte n o;s)s2um(m3oo4am   feils aDtru p;t4tltnioctat s uaums;t4trxoio tatfatrlies;t0 exmxr3no1lp n nvtas a2uax  nt0olxoiiciad s ua(mo u0altnxf3iodlpDrlies ()s2tm(m3ny1lm nmfvt t)aDurumpnu1alx  i3iat s2umuvpnt) etoir tatfmD au ils0s2xrxo nudlmt mfesas) 2urx  ot0oexn o3tltla2rlnvs ()tlxrmocia1lat auvi t  rurim3iu1oleelfvsl(fsrururpnt1oltomociydlm2elumsnt)aetnxo iotoate u olt0sexr(mpiy4op   fviat)a2urx ono4openmoeiydfmDrauvs u)trtrxfciodla r nvs t)t2xoxr oo1ope lnetls)sDtmu oot0tpe moeias m emu s (4 lxrio3ia1fmDeli olt0 2ur(o nydom elivsat sDuaurpou1opxo icildls2rlu p () lxnirctotfaD ln o;()srtoxr nydoleemncil(faDrmxrpno4tlen o3iytfm elu s;u4 etrxf iytlmte nvilt t2xoim3oo1ll nmnvt () Duru o;o1tptn ieiyd sDem(vpnt4 lerio iy1oaDelieo;t) rxoio3no4lpte nesat)a2ua(  ;t1teenmoetatlm2eauvp t4alenir oadfaDrluvols)seur(o io1open nvia( sDrru  nu0tle iietls s2rau ont4arxnxf iytlpDelies t0tetm(opoy4lmt lfetas) 2raum ;t1tlenioeiad m rmn s;u0aeeoxr3oydlmte ieil(0trxr(m nodlle lneilt) 2taxm ;t1optnii3iadla rmnmpnu0arenmf3oy1lp ran sl(0t2xr(r3nydolte nvtls sDrr(roou4tpt mictas s eanmsnu4alermo3oadlpt  nvs ()t2xrimpnu4lp  lnetasf Dtaxrpno4olxnif3iyt m2ul(msnu0tetrmo3oatlmDe n o;t0 2um(o3nodlm emieiat) rum(mo;t4open feiydfs2emu onu0 lenmo oo1fp  aies;( srxoxm3iy4omen ncs t) 2uaxmpou0oltomiciaslm2emumo u)aetrxf3ia1op eaiei;t t2xmxo io4ll  lncil() Dtmum ;o1aeenio3iatfsDran s;(4trxrxo iodlmDrliesl(  ruo(r no4om  lictlsfarrrx onu1oexo ictlsfm2ua( p;u4 rxnmo3oatlpDeaueo s s2tm(r3no1lp nmnvta( s2ua( ono4tpxomfctyt a2ranmo;t)trerxrctydomte i sls0teur(r oudoptnmiei tfarum(rpnu0oltnmfctytfsDrlnms;(0 lenio3oy1fpt ln ols) rtm(o3iydom nmnei () rrrxm nt4tlxo iciytlmDuau s;(4 lenxrciotfate ivilt) etrxm3oudlm  liet ()aDtr(mo;o0apxo i3tlt s2ulums;u0arxomfctydlaDe ueol( setoxm oodomtnmivtlt s2ra(  ot1ole moeiadls2rmnvsnu0alxrmocoo1fp elueo;s  eto(opiy1lp nmivta( arrru p;o4olx  o3iysfs2elu snu)alenmrcoodfm raieo s)s2xrim3oodomtnmfcsas  rrm(  no1olxnifciltla emumo;(0altomo oa1latelneo;(0 etr(r3iu1lptemiet s s2urur nu1oexnmoeils s rlnvs;(0teenxr3oadfateaivo;t srumxo io1ome lfct s sDururpou0optomfetydlm2em( s;u)trxnif oatoatrlnvsls s2tr(mpiu4llt lfvilsf 2uaxmpoo1olxnioetytfa rlums (4 reoxo iotlm   i il()trtm(m3ou4olt lfet s)aDrru pou1opxomf3ias s eau s;(0artrxr3tytlm  an ils0trxmim3nydllen nvsat a2rmu  ;o1tet  f3iatfs2raumo t4artrif oydomDrli i t0 etrxrpnodapt lnctls)aDrrx  ;t1tpt mfcilslmDeaump;(4 ltomf3iydlpDr ivsl()seuo(r3iodapt  feil(f 2urur ot0tpeoioeiyslmDum(vp;t) lxrxr io1lp e i s;s) exr(mpoydlpenmictas sDta( pnt0ale  ictldfsDuanvs (4 lxomo oytoatr ivi s  rtmxopiy4olee ietat)sDtaxr ot1apx ifetydfaDrln sn(4arxoxociydfatr nes;(0 exo(mpiodllt mnet (f 2tmx  ;u4aetnio3tlt sDra( o (4teeomrctytfp eli ilt0srur(m3iy1olen nvtlsfsDur(mp;o4oexniociysfm ul(mo;t4trenir3oa1opteluei;(  2xoxrpou4optn ivtl() 2uaum ;t4alxomi3iasla2rluvsnu)aetrmo ty1fat auvo t  etr(m no4omtnmfct ( aDrr( pou0tet mi3iydla2elu p (4treoxfcoadfpDeanei () 2trimpnodole mfvia( aDumu ono0tpxoifetld a2ra(ms;t) rtoxo3iydopteli i s) etm(r nodlmte ncsl() 2tm(mo;u1oet  oetydfm2elnvont)texnmf iotoa eaneo (0 euoxo oudamtelfeilt  2um(  oo4oee mociaslsDemnvpnt) rtomociydoa ean ol(0srxmio3ny1ome  ieils) Dtmx ont0olen ociatfa rl(mp t0 lxnxf oodomt auei;s)srxrio oy4lpeelnetls) rtmurp;t1aetnii3tatlm uanms;t0 eerxrcia1op rlivo;() 2toxr3nu1opee ietl(fsDurum ou4tee  i3ils aDumu pnu0tlxnxfciytfm   uvi t  2uoxr3no1am emfesa( aDta( ont1tpeo fctatfmDrl( on(4 eerxf3iytlp   uei s  2tm(o oodlm nlnvi t sDua( p;o4ale  iciltla emn snu)teenifcio1fat lies;s)trxmxmpiodllenmnctls arrrxr ot1oexo ociadls eanmsn(4 reomf todoaD  ies t0 2toxm3nodal   ict t srtrx onu1optnioeiydlsDrm(mp t4treoir3todfmDelu i ()srtm(r io4ale lnei (  rtr(r no0olxn fetasfm ua( snt4areoio3to1opt  uvsl(0tetrir nodlptelfcsatfsrrm(r ;o0tpeoioctydls2rln snu0 exoxocoadlp rluvsl( setrxr3oydllte fcils srrrxrpoo0opeoii3tls mDranmp u) lxoxo ootlm eai slt  rumir3nodaptnlivsltfa2tmurpnu0aeto f3ildlsDul(vpnt)texnio oo1latr i o t srum(o ny1lleelfcia()sDtaumonu0openifeiysfa rmu snu4altnxfcoydfpte ivo;t0trtmim3oo4amte fci ( s2tr(r oo4texn f3tat m elnmo t0 rtnmociadomt  ieo s) etmir oodom nlicsls  2rrur ou0tltniieiyslm2rmu s u4 etoxfcoatomDeaieols0t2xmir3iudol e nesasfs2rmx  no1altnmiciadls2rmn p;u0 leoxo oodfat luvs t seuoir3ou1oleemivtl( arua(ro;u0tltoifctatfa rmnmont)treoxr tadoa  lnvs;s  euo(o iu4optnmieilsfarrrumo;u4ole if3tat a2ul(mpn()tlxoxo iydoatrln il()t2toio3ou1opeelfesat)arrrurooo0oeeoif3iatfaDuauvp;t) renmr iy1fp elivils teur(r iy1amtnlies ( aruaur ou4texnifciaslm rl(mp t0artomo tydfate ieo t)srtrxm3io1am nmfvil(fsrur(r ot1altomfciadfa2ua( p (0aetnxr oytfatr nvi;(0seto(m oudlpeemfesas)arururpot0tpxo iciysfm ul( o;(4altrmf3oy1fp   uvs;t0 etmir iu1alenmivtatfa2trxro;o1apeo fciytls emnvpn(4tltoirctatlpt  uvo;t s2umirpny1amtnlneilt)artr( ono1teeomoctldla2umn p;u0 etrmfciytfa  anvsls)s2xoio3iu4lltnlnei (f 2ua(r ot4olt mo3iad s2emn snt0tltomo3iotopDr ues;s)t2uo(o3nydam n fvil()s2taxrpnt1oex  fetysfs2umnmpnt4 eeoxfctatlateai slt) eumxr3oodap n net tf 2rruronu1olt ioetlslm rm(msnt0trxnxo tydlaD  uvils) 2toio3ou4lm  lfvs tfaDumu oou0apxoiociyt sDulumon()arxnxo oatfm ranes;s) rxoim3oy1lltnmfcs s  2rmu o;t1openmiciatfaDua(ms t0trxnxociotlm  ln o;( seum(r3oodaptnmfeil(fsrtr( pou0tpxo fctltlm rm( onu4 etnio ia1om   ueolt) euoio3nudop  livs ()a2uru poo1tpx mociysfmDelumsn() etriociotfmtrlu i t  rum(m iodope  nes (fa2rm(r ot1aexo fctatfaDemu pnt0 lenmr3iatlmDeaivo t t2um(o3iudope lfetlsfs2ta(m nu0tee  oeiaslaDemuvs t) etnif oo1laD ln sls  2xmio3ou4ol emivtas)aDrrxront0apxniietatfmDemuvsn(0trtnio3oy1opteau sls0srtmxm3iudam   ncsa(  Durx  ot0tpxoioctls a ulnvpnu4 ltnxr3iotlp eln s (0s2umxr3io4ap e iet s) Dtm(  ;t0opt if3iydfm rln p u)arermr3oytfmDe u ilt)tetrim ny4al  mfesa()artrxr no0tle ifetyt m ea(vo;t0trxnif3tatoaDr nei s)t2trxrpny4lm  mivils)sDtaumpou4ape ii3tldfm2rlnmsn(4artoxfciadlpt  ues s0 etmxm oudop nlici s) rtrum ;u4texoifciltlm2emuvpn(4tetrifcoo1opDr ies (  rxoxopnodomeemfvtasf Drmx pno4teenmi3tysfaDra( snu4 eenxrcto1omDraues s0t2xrxrpiudop  mieta( aDuaumono1tpt  o3iatlsDranms u0 eerxfcto1fptrluvo (  eur(m3ny4oltemfcia(  Dtmxr ;o4opxn o3tasfa2uluvpnu4trxoir iydfa  anvol(0t2xmxopnu1lptelfetlt) Dtruro;o0olxomfcias a2emums (0 lxoxr tadfmDrau o t tetrxr io1lpt livt ()aruaur no1tlenmictyt mDemn p;u)texnmrcty1fp  lu i;(0 2toxm iu1lleemici tf Drmxmp;o0tpeo feilslmDua(vo u)treomfcty1fm  luvs (0s2xmxrpiu4opeemfcsatf 2rmurp;o0ale ii3iat a rau snt4arxoxrcoydomtrlneolt trumir3oo4ap  mfetls) 2ur(rpno4ope  i3iasla ea( o;t4 eermr3oytoaDe neo;s0srxm(m oo1om   nvsa( artmum nt0altoio3tld a ulu s t4areriociatfm   uvs t  2tmimpno1oltemfcsa( s2ta(mp;o0tpt  ieiydla2rl(ms t4texrif ootlp rau s ()seuo(rpnu1altemnct (fa2ua(  ;t4tlt mo3tlsls ulu s;t)tltomr3iy1lptraivi;t srumimpoy4olte fcias)artax o;t1olxomo3ild s2uanmsnu0tetniocty1fmDrlneo;s)srtr(r no4op e ieia(fa2trumono1oet mi3tat s raumo;u0artnio3iydlpD aueols) rxoim3iodoleelfes tfaDtrumpnt1tpxoioctydfmDuanmo u0 etoxfctatopDrln o t0 ruoxopoy4ome  feilt s2um(m nt0apxnmf3tysfa2emn p t4tltomo3tatlp rai o t)seur(o3nodoltelnvias)aDrr( pnt0ole ii3ild m2elumo (0trenxo3oodfmtelneo s)setmxm3nodlmtnmicilsfaDrru o;t1olto fctatla2rm(vpnu4 rtrxr3iy1lptran o t0s2uo(rpnu1om n ieil( arur(rpot0aet mociytlmDea(ms;u4 rxoxr3tatlmDe nei s0sexoxr3no4llt lfeta()artaum no4apt  ociydls rluvo;u4 exoif iytopte nes;t)srxr(r no4lptnmfes (farurump;o1texnmociyd a uaumonu) rermo ia1lat ln s t0 2xrxo no1lp  mfesas) Dra(ro;o0oet mieiytla elnmp;u4texnmo3oo1lmDrluvols)trxmir3no4lle lies tf rururpnu1alxo ietatlm eanvs u4 renirctotlm eaiei t)texrxr iu1alte iet (f 2ta(m ;t4tltn ocias mDemnmo (0alxrio ty1fpDelu ol( sexmxr oy1om  lnetas srrmum no4tltn feils s ranvs t)arxrir iytfa   nvo;()srxmxopiu1lpe  ieta() Dta(m ot0altnifciysfm2elnvp u)arenif3tatlm r ieo ( t2trxmpoy1amtn ict ( s2tm(mpot1apenioetat sDrmnmpnt)aetoif3iytlmD auvi;s0srxo(o3no1al e ictlt s2taump;t0tltnmf3ild a eaums;u4arerxrcootlpDran s ()srxrio3iy4omenmivi t arrax  nu4openiociyd m2raums () eenxr3tadlaD  n s;s  rtoim3io1lptnmnci t a2urx poo4tpxomoeiasfa2ea(vp;u4 rxoxf3oo1fpD  nei s0tetm(m3ny4ameelnvta(  2urxmonu1ale mieiyd s2um(ms;u0 lxoio oadla rau i (0truoirpoo4lpe  nvsat)s2rmuronu1oleo ictysfsDemnvo;t4trxoxo ty1faDe neol()srtoxo oo4ame  fvsl()sDtr(r ot4aeenmi3iysfm2el(ms;u4arerif oodfmteai s t0trum(r3iu1omen nctlsfarur(monu1apx  feilt aDrmnvp (4 ltriocoo1omte neo s0 2trirpnodoltn fvil(  2tm(root0tleomoeiytlsDem(vp;u4 ltoir3oa1faD ln o (0srxoimpoo1lm elnvsas) rrr( onu0tetnmictysfaDrlu p;t4 lxrmf ta1fat ai i s sruoirpiy4ame lics s)aDtaumpoo0oetnifctyd aDrmu s (0aexrxf totfat lu ilt) rtm(m3iy1lltemfci (fs2tmxrp;t0aet  fetlsfa raums t)treomfcto1op  anvs t)sruoir nodomeelnvtl( s2umu p;o1altoiictatfs rl( o t4 eerxociy1lp  luvi;t  ruoir oo4ole mnvtas)a2ta(r ;u1apxn ietldlmDrauvpnt4aetnmf3tadlm e uvs t) rxmiopnu1lpenmicias aruau o;t4tlenmfcildfa2eanmp u)texoir3iotlpD lu o t setoxr3ny1lpt mivt ()arrm( pnu1tleomieiad sDeanvpn(0 rxnio3oo1fatrlneol( tetr(m nydomeelics (fa2truroou0apx ifcild m el(vs t)aeermrcoa1lmD  nvil() 2xmxrpio4lpe licsl(f Dtmx p;t4apxomiciyd a2uanvp (4teenir3iydomtraivo;t)s2toir ny1aptelivtls)aruau  ou0apeo ietlslm eauvsnt4tltrmo tytlaDrlivols)s2xrxm3nu1am nmfeias arta(mo;o0apenii3iatls rmnvs t0 leoif3oytfaDrlnei;s trxmxo oo4ale lnes s  Dtr( pno1oex mfeiasfs2emn s t4alenxf tadla r uei;s t2xrxo3nydop  miciatfsrrrxmoot1aptoii3tltls rluvs;()texnxf to1faDelu s;s  rurxr oo4ll emnvt sfartmxmo;t4aeen ocils a rlumont0 rxrir io1latr iei;t0 rurxm3oy1am n nvt t)sDrmumo;o4tetnioctlsls2emums;u0trtnir to1omD  ieslt) 2xo(r3oydopt lncs ()s2uaumont4aetoiociadfaDranmo;(0texomfcootfp e u i s) ruo(o3no1oltnmfci ( aDrmumpot1tleoioetys a2umu s;t4altnxo iydfmDrai o t0s2umio3ou1omtelicil(  rum(m no0tetnmi3iltfs2rauvpn(0tltrmr tydlateanvo t0 exoirpiy4lm elfctlsfartaum ;o1tle  i3ilt a2ean snt0 etnxf iodfa  livo (  rtm(o3ou1ll n fetl()artrurpnt1alx  fcils aDua(mpnu4 lxoir3oodoateaneo;s0t2urio3nodope lnesas  rurxront4openifctadfsDuanvo;u)tlerifcootopDrluvolt)setrxopiu1ole  netat)arur( pou0opeomocilsfs2rmump;(0tetniocoytlate ueslt)t2xr(r ou1amt  fesa( sruru pou0oltn f3iydfm2ua(vsnt) rxomr3oo1fmDrlnvilt0setoir3nudopt mnvtat  Drr(m nu4tpt  oeiasfsDraumo;t) exnmrcta1lptrlivs s0s2tmxopiy4lp nmictasfs2uau oou0opeo o3tat m ulnmo;()tetoxrctodom rau sl(  eurxm ny1om nlicsas srtm(moot4aptn ictydlsDemuvp;u4alxrir3oa1fp raues;t trxriopnu4lp emfes s sDumu ono1opxnmf3ilt s ra(vp (4tetnmrctadopDr n s;(0 rur(mpoodaltemfvi ()s2ur(r ot1ale mf3iydlaDrlu o () rerxo iy1opD aues t s2uo(o ou1lp elnesa( a2rr(mpou0alx moeiasls2emn p u0 eenircoa1omt li s s) 2xoio3ou1ll   netltfa2tru o;u4aetoio3tadlm eaumonu)arenxfcoadlmDeln i ( trxmxr iy1ole mnet tfsDra(root0tltnif3tlt a rmnvo (0 rxrmfctadoa eaneol()setmxrpiy4oleemieil( srumxr ;t0tpxnmoctlsfm2ul(mpn(0trxomf3iy1lmtr u o;t srxoxmpny1lmee ivtas) 2rrx o;o4apt moeiys sDranmp (0tlxnxr3oo1fpte ieils t2xmxmpoodom nlics s arururont1apt iictls s rau s;() lxnxo3ia1lm rai olt) exo(r3oo4opeelfeta()artmx o;u1oee  ociyd aDum( o;u4tlenxr3iy1lmt aueo s0tetoxm3ou1lmte nvsasf 2ur( o;u4tleomfeiytfm2emnmp;u0 ltnio3iy1lm r n sl(0 2xm(o3ou4lpeelfvsl( artr(r nt0opto o3tyd sDel( pnt0alxoio3to1fmtr ivo t  2xmxm nodll n ivil()s2tauronu0alxn fctasfsDra(ms t4 leniocoa1lmt lieilt  etoirpoodalt liciat) ruaxro;t0tpen fctld m rlnvo;(4 etomf3oydla eaivi () rurirpnodapee ivta() ruaxmpou4alt ifciad aDelnmo;(0arxnmrciotfatrlu ol( t2uriopoudam  lfvilt  Dtmurpnt0oetomi3tldfs2rmnmon(4 etoxfciotfateaivi;(0t2to(mpoodol emfcil(  rra(  oo1alt mieiydla2ranmsnu0arxoxr3iytoaDe nvols0s2umir3iudome lietlt)a2raxmo;u0oltniicilt a el(vpnt4artomr tadoaDe u i (0 exrio3nydop nmnvs t) Drrxmpnt1olto icild m2ea(mp;u4 lxnircoydfpt ai s s0 eurxm nudlm e nvs ()arurur nt0tex mfcils mDeauvont)tltnmr oytfmDeli olt trur(m iu4op n ieslt)arraxroou4opxo i3ild m2emnmo u)alerioctydfa  ln o;( truriopoodapenmfvs ()aDurx poo1open ictyslm2ulu on(4tlxnmrciadlmDrlieo s0srtm(r3iu4lp elivilsf 2tmu pno4opt iieiyd a rlumonu0artrxocty1fp elu ol( srxrio iy4olte fesasf Duau o;u4oex mocildlm em( pn(0arxrxo3totlaD  uei s)t2tr(opiudom emnetasfsrurxmpnu1tetnif3ilsfaDrmu pnu0teenmoctytlp elu ils  2trir oy1lmen neil() rrmx oou1oeenmi3ilslm rmuvs u0 etoxo iodlpDrlivs (0trumim3nudalenmicsat srtrum ot1oeto f3iyd s ul(vonu)tlxomo oodlp   ueolt)t2um(m3iu4ll elivi (f Drmu  ;t0oee mi3tytfa2uluvo u0tltoxf3iydop  aivo s0s2xoxm3oodop  mneia(fa2ta( pou0opeoif3tatlm2umumo;t4altrxf totfa  lnvolt)texoxr ou4lmte neilt  2uaurpou0aptnmoetat s ea(vp (0arenxr3iydlmtrlnvsls)s2tm(r no1lp  mfctl(fsDraumpou1tlx  feiasls2ulnvp t) ltoxrctodlaDranesl() 2xo(r ou4am e fvt s a2ur(monu1alxo o3ilt a2ua( o;u)areoioctytom   i i;t0t2xrxopiy1lptemictasf Dtaumpou0tlt  f3ilslm2eluvon(4altrmfcoydlmtrli ils  rxmxm3oo4ale mnvt t  Dtmxrpou0opx mfeiys a ea(vpn(4 eeoioctatfmtrlu i s0s2toxo ny1optelieilt  rumx  ;u4olxnmf3tyslmDuaumo;(0trerif iytfpDrli i t  2trir3no1optnlnct s srtru  ;o1opeomieiatfs2ea(mo u0tlxrifcoodomD an s;(0trxr(opno4lle mneia(fsDra(m ;o4olt ioeiadfs em(vp;u0 ltrmf tatfat aies t0teurxo oy1lltnlnesatf rum(m ot1oex mf3iydfa2rl(mo;t0 rxrmo3ta1oatr n olt)setr(r nu1lm   ics tfaDtaxrp;u1tpeo ietytls rlnvo u)artoxfciadoa rlnes;s0setrimpiy1amee fct s) Durxrpot4ole iieiadlsDeauvsnu)teermf oa1fmDelueo;t) rtm(opiy1am  lics s  2raxr ;t0altomociysla2rmums t0tltriociotomDrauvils0 2tmxm iy4oleelici s srrrxmpot0aeeniictytlm2rau o;(4arenircoatfp eln s;s0srxrxr3oodomt lnvi sfarra(root0alxn fciltfaDrmnvont0arxnxf ty1fa eluei ()srtmio3io4amenmfetls)srumxmo;o4tetnmo3iyd sDuln s;(0tltnmo iydfmDr nvs t0 2umio nodlpen ncilt)a2umxrpot1tpt  ietyd m2umumo;(4arxrxo3iotopt  nvo;s) euoxmpoo4lptnlfvi t  rurxroou1apen i3iasfaDeluvsnt) etrif oydlmt ln sl(  etm(m nudam  lfesls srtr(r nt0oetnmo3tatlm eanvp;u) exrxr iadlp r uvi ()t2xmir oo1lptn nvtat aDrr(mpnt4apenifetat aDrm(mo (4tltnxf3iadfmt lnvsl(0trxoim oy4apee nvtl( s2uau p;u1tpxo i3ildfs2rauvon(0trtoxo to1faDraueo;s  2tmxm3no4ap emneiat)srtmxmpot4oet  oeildlm2uau o (0 rtomfcta1oa e uei t trtmxo3nudoleelnesasfs2rmx oou1opt mieiytlsDua( o t4texnxo oytoa rliei;t0s2trio ou4llee fcilt  Dtmxmp;o0oeto f3iysfa2um(ms t4tlxnxo ootlmt an sl( setmxm3iodam emncia(  2rmxr ;o0opxnmictasfaDrmnvp (4 ltrir ia1lm raies t  rumiopoy4oltnmietat aDumxm ;t1oetomiciaslm2ulnmo u)aexnmoctatom eau ils srtmxrpiydlpen ietl(fsrtrxr oo1oeeoiietls mDulu s;()tetomo oodlm  lnvol( t2trxr io1lmt lnvs s)arrmxroou1tetn f3iadla emumsnt) exoxo totfpDraues (0setrxm oodom  mfet s)a2rrxrp;t4oex mfeiyd m2ran pnt)trxnif3totomDrlivi s0 2xoim oy4om e ivs ()srtaumpot4ope ioeias s rl(vs;(0aexoxrctadfa   uvsls)srurxr3nu4ame mivsl(fa2rru pno0olto fctaslmDel(vsn(0 rxrxf oodoat lieol(0 ruoir ou1opt lnvil( aDrr(mo;u4optnmicils m eanmo;u0texnmo3iytoatr ies t0t2ur(mpno4omee icsas)s2rrxroou0aexoif3iyslm eau onu0tltrirctotfmDeaieolt)s2xoim iy4ope lietls) 2raumont4opx iietls a2rlumo;(4teeomo oytoaDeau s;(0seumio io4ole  fcilsfsDumum ot1oexnioeiysla2uluvs;t4 eerirciadop e uvs;s srum(rpiodlptelfeilsf 2ur(ro;o0oetnmfcildla2umnmo ()tlxnmf iytlpt lnvo (0teum(mpiu1al elieilt s2tmur ;t1opxoii3ildlm rmn on(4tlxrxr tytomD aieil(  2tr(mpiu1olenmnvsl()sDuaurpnt1altnifctlsla eauvsn()altnmo3oytoaD li i;t)teurxm iudomtelfvias aDuau pou1aleo f3tls m2rlu o;u4areomfcoo1fpD an s;s0t2ur(rpiu4omen ncilt) rra( ono1tpx  i3ilsfmDul( p (0arermr totop raivil(0 rtrxo no4lm n feia()a2ururont4aee ioeiatlmDelu pnu4altnxf ootlmteanes s)texm(r3ny4lmt mnvslt)srrrxront4oeeomoctad m ul( s t0alxrxr iodfmDraivils0 2um(opou4llt  icslsf Dtmurpot4apt micilslaDel(msn(0 etoxrcoytlp r i i t srtmxr3oy1lpe mneslt aDuaxroot4apeo fciatlm rlnmo;u4aetrmo oa1fmte u o;t) rtmio3oydlm elicsas sruaxr ot0tlxn f3ils mDrlnmo;t)texrmfctadoaDrau ol() exo(rpiy4ol e nes ( aDtrxmp;u1oee  fciat a2ulu pnu4tetrio3oadlm  lneo t0s2uoxm3oo4olenlivtlt a2tmx ooo1tpeo feiys mDul(vs;(0treoif tadlmD  ivs t0t2umxr3oodllen ici () rtruro;t0alenii3iyslsDua(mp () lxrmfciadfm r ivo;t)s2xmxo oy4open neta()s2ra(rpnu0opeomfeild s2rl(mp t0 etomo oytomD luvol( trxm(mpiodopen fciasfsrrrxrpou4aptomietytlsDrm( pnu0tlenmr3iadlat au s;s)setrxmpou1al emfes sfarraxm nt0tpt moetldfa um(mp u)tlxnxo3iodopteaivo;s)trur(r3oo4alee fvs (  rtruront1altn ictydfa ean snu4 lenif3tydomteluvi t0t2toim3ou4am elivil( aDrr( pnu0tptomoeiydfaDemumpnu)tlxnmoctotlatelivo (0teuoio no4al  mneiat sDtrx poo1tlx mo3ild aDelnmpnt4altoxocoatoaDrai s t)t2um(o iodlmt livi t)aDumx pnu4oetnioeiltla2ra(vsnu)tlenxf3oo1lp   nes t)texmir3nodalt  nvs t  Dra(ront0oexnmfetas s2ua(vp t)tltrif ty1fpte ivi s)trurir3iu1lmt mncsa( sDurxmo;u0tltn octat s2ra( onu0altrxf3oodlat li sls s2urxmpno1lmeemiet sf 2trump;t4oeenmfciadlsDulnvo;()artoio3oa1fmDr nvsl(0 2toir3ny4alte fvs tfsDtrumo;t1teenifetlt s2rlnms;t0 etrio3ta1fp  auvo;s0t2trxo iudom   nvtat aruru ono0apeoifeiat mDrluvs;u0aeeoir3iytfateaieils)s2ur(o nudole  fei t) Drr( pou0apx  oeiltfa2elnvonu4 leoircoytop rauei (0setmir3oo4aleelnciat a2uru  ou1oeto f3tysfa uln s;(0alxnmo tydlaDeln olt  2umxo ou1lm nlicsatf Dra(  no4aetn i3ilt a2em(vo u4trtoxo ty1fp  livsls)s2umxo ou1apeemfetls  Dtmxr ou1alen feildfm elnmp t4aeeoxo3oodlpD  ies;(  exo(r ou1am e fei ( a2tmxm ;t4apenii3iasfa2ran o;()artomr iy1fat aies;s0t2xmxm3io4optnlivs s  rrru  nt4tetnifetat s2rm( onu)aetoxf3ta1lp eanvil( srxm(r3oodapenmnvi s a2tr(mo;u0opxo i3tls sDrmnms;(0trerxf oatop rlivo;(  2trxo3ny1am elnvsas sDtax  nu4alxn ietlslmDrmnvs u0 ltnxr3oo1oa eluei s trxoxmpoo4ale lnct (f rraumo;o4tlt  o3iyslmDean snt4 ltrif iydoaDrlivo s s2tmim iy1ame lnetlt s2tmurpoo0olt iieiydfa2umuvpn(4aexomr tydfaD  u slt)texrxr3no4lpenlfct (  2tau pnu4tlxnmoeiytls2rl(msn(4arxoxr ta1fpt  u o () rxoim3ny1lltnmivi ( arrr(mont1ope mfeild m uan p (0 rxoio3oy1fmDeai ol( setmio oudlm emiviat)aDuaumpou4tpx iictyt s2em(vs;()tlerxr3iydfmDeaueo;s  2trio ou1ll nmnvtl( aDtmxmp;t1apxn fctadfs rlu o ()areoifcoa1opDraivi;s)srtm(r3no1optn icsl(f rrrurooo4aet mfctasfa2ua(msnt4treomociotopDeanvo;t)t2xrir oydlmt lfvi ()sDta(mono0opx mociasfsDem(mo;t4trenxo oo1fa eai ol(0t2um(opno1lp e netl(faDtru ono0apt mfctytls el( p;t) etnxr3oo1om eluvs;( sexr(rpou4omtemfctlt aDrm(r ;t0aex  ietadlm2ea(vo t) lxoif3ia1fa e n ils0teurxo3nu4ol nmictls)s2tm(  ;o1texo oetaslm ulu s;t) leoxo oodopteli ol(0sruo(r3ou1lpenlnetatf 2tau p;t4opxo feiatlm emu onu4tlxoxoctydopt  u o;t0 rumxrpnu1al emncsasf ruaumont1open fciyd m2rluvont)aetrmf3iy1oaDrlivs ( t2xm(m io4llenmivtat)aDuaxmp;t0olxoioctlsfs2uln pnt) exrmo oodfa rlivi t srtoirpnydale licsl(fartr(m no0optoii3tad s umnmon(4tetrio oadlpDrai i s) 2trir oodal n fesl() rrrumpou4opeomfetatlmDrmnmsn() ltnxo ia1fpDrliesl( t2uoxr3nodape mnctas)aruaxmpot1texnmieiadfs um(mp t4aexrmo3tatfpD ln o;( t2xm(r iudam nlnvtl( s2trurp;o4oeeoii3tas s2elnmo (0 rxoxociotlpDe nei;t t2xm(o nu4om n fvs ( sDrm(mpou1tetnmo3ilslaDrlu o;t)trtnmo io1fm  lnvs;()trumxo3iudapt micsat)srtmx  no4tee  feiyd s rm( s;u0alxomocoytom  li il( texo(rpny1ape  ici () 2ua(mo;u0ope ifeiltlm2umu p t4tetrirctodla eaiei s srxoiopnodlp emicsa( aDtmu ont1apt mo3tyt s2rm( s t)aexoxo3ta1omDr u o;(0t2xoiopno1apee fetatfarurumo;o4ape ifctld s rlums (4areoxo3oytlpDraivsls)trtm(m3oo1ol  mfet ( sDrrx ont1tlxo oeilslsDuau p;u4tleomo3tytlmteluei;t0s2xo(m io4altnlfci s  Drmx p;u1tptnmfctat s rlums;()alenmocty1fpDeauvi;s0s2uo(opiu1omeemnvsas sDrrxro;t4oet io3tysfs eluvsn()aetomo iydfpDeaivi;()srtm(r3nydopee ies sf Drax pot1tpxnii3iytla uanmp;t)tetnirciydopDraiei t0 rtoxrpno4lpen fcil() rtmxmpno1tleo fetlslaDeanvs;t)trerxf oy1fptelneols  eurir3nu1om e ivt ( sDur(mooo4alt mfciadfm2rau p;u)aeenxo3todom e uei s t2xoxrpoydlp  mici tf 2uru pnt4alxnmieiysls2emuvsn(0trxoxf to1op r n sl()srtm(m nu1altnmnci (fsrururooo4oltn i3ilt sDrl( o;t4trenxfctotomtrlu s (  rurxo3iudapenlfeiltfsrrmx pot1ape mo3iad m2rm( p u0arerio3oatlp rln o s trto(rpiy1op   nct t)aDrax p;u0opeoii3iadfm2rmu p ()aeenxrciytlptraivi (0 2xrir3iydolt micil( srraxmonu4alxnmfctlsfs eauvp t0alxrxocoy1fat an ol( sruoxm nodoleemfvil()aDrr( onu1tpxomietydls ulums u0tlermr3oy1lp r nvsl()tetoimpno4om elicil( sDtaumpoo1aeto ietad sDra( pn(0 rermo iydla  ai o t t2xo(r3nu4lmeelics (fa2tmx  nu1opt mfeiytfsDeanmp (4altomf3ty1laD  u i;t) etr(o3iy4omt lfvtas aDumx  ;o4tpx if3iltlmDemnmp;u)aleomo3iotlmDr ueils trxrxr3iy4lm emnvilt)sDrmumono0oet iictat s2em(ms;(4tltrxo3oytfa  lneslt0teto(r3oo1oleelict sfsDtrxmp;u4tlen oeilsls ea( ont)texrmo3to1lmDr ieo;(0 eum(m nydll   ncsat artmx onu0teen fciyt sDuanvon(0aexnir3oa1omt  neol( srtmxo no4ol   ncsatf ruaurooo0opt mfcildls emn p u0 renmo3iy1fp rlnvi;t0srxr(m3iodam emfvs ()sruaxmo;o1oeeo ociytfs uaums t)trtnxrctadfatraieols)t2xr(rpnu4am  licsl() 2uaumpnu4aet  i3ild sDemu pn() lerircoadfmt lnvo;s t2urxm iodamenmncsl() Duax pot4tltn oeildfm ulu pn(4texniociydfmteaiei t0t2uoxr iu4lpt mnctat sDraxrp;o1oexnio3ilslmDel(vs;u0 etnxrcoa1fatrau i t) ruoio nu4lmtnmneias)a2um(rono1apx  f3iys aDraumpnt0aleomocto1fat auvslt srtrirpnu4ap n ivtlt)sDrr(r oo1aeto oetldlm uluvs;t0arerxr ootlatelivil( teurimpiy1amtemfvi ( s2rm(r oo0olxo octysfmDel( onu4 lxnircoa1la eli ils t2toxo ny4alee ieiat)a2rmu  no0tltnii3ild m emn o;t)aleoif tadomDrlu s t)t2um(rpny4am  mivs s) rra(  ;o1aptoii3tasls rau onu0alxrmr tydom r ivols)trtoir3oo1olenmict t  Durxro;o4apeoifeiydlm ulu s;t) lerxfcoydop r ies s  eumxo3no4om nlicsatfaDtau o;t1tlt ioetlt s eluvp t4altoxfctadom e n i;s0srum(r3oodame micsl()a2ua(rpno0alxo octyt s ua(ms;u4tlxoio3tytfm eln i ( t2xrim oy1lm  micslt) Duaumoou1aexnmoeias s ra(vsnt0altoxr oa1oaDe uvsls) rxmim3iy1lmt  ici ( aDtaumooo0tpxn i3ilsls rmuvo;t4artrmo oy1fmDrli olt) rtoxm3iu4omee feslsfarua(mpnu4tpe moeiadlm2rm( p (0aeenir3tydfaD  ieo;(0 2xmiopiy1lmtelieias) rua( ont0aee mi3ilsla eanmo ()artnxf ty1fmteli i;t) 2to(opou4omt lnct t aDumump;t0apeoiiciysls2eanmsnt)alenmf oy1lmtrli slt0 etmirpnodopeelfvtls)s2tr(ro;o1teenmietatfm2ean pn(0tetnio tadfptrauvi s)sexm(mpoy1alte fetlt  2tmxmpoo4apeoio3iad a um( o u0tleoxr3tytlmt ln s;t)sexmir io1aleemicsa()aDtrx pou1oex mf3iydlm2elnmon(4altnxfcia1la   ieo s) 2tmir3nudole  feil()s2uaxr oo1alt mo3iytlmDrmums u4treoxr ta1fp eanei;s trtmir3ou1ap emfviasfa2uru oou4apenmoeilsfmDel( pnu0teenmrcootlpDeaivo t t2uo(o3no4ap nmictltfsDrr(  ou4olxnio3iat s2rl(ms u0 rtnir oytfpDelneol(0trtr(rpou4amtnmfeta(fartmu ooo0aeen octlsfs2rmnvsnu0alxrxf oatlaDr neo (  etmimpoo1al n fcs sfsrtr(mpou0apenioctls m2uauvpnt0tlxnxf3oadlptelueo s0s2xoxrpiu4lm nmict sf rtrxrp;t4oexo o3tys m ean p;u4trxoif iodoptrln s;t) 2tr(m iy1open iesat s2tmxmp;o1aeeoifeiltlm2uluvsnu4teerif oo1fmD  ivol(0sexr(o3iydape  nei sfaDrm(ront4tlx mfetls s2uau o u4arxnxo3tadlmD aivo;t  2xr(m3iu4lleemfci ( aDumxro;o1apeoif3ilsfs ulu p t4arxnmrcia1lp rlues;s0truo(rpoydam  lfet ( s2ua(rpno4oexnmi3ilsfm rau p;t0arxrmo3tadlmDelueilt0trumxo oo1omte nvtl()aDtrxrpnu1aptnmoeiadfm umuvpn(0trenio oatlatrli o ( trtoiopnu1al n iciat)sDua(r nt1tpeo f3iadfm2rmuvpnu4tetnir3ia1lm rlivol()seuo(mpoudoptn ieiat)artmx  ;o4alxniiciysfm2umnvs ()tleoxf3tytfmtr nes;(0srum(opiudam  mfct s artruro;u1tptoioeiytls2eanmont0 lenxr3oa1fmDeai olt t2xm(o3iodom nmicsa(fartrxrpou1tlt mfcild sDem(vpnt0arerxf tadoat lieilt srxm(o3oy1oltnlnvi ()sDum(rooo0aetn fcilslm rm( pnt4tlxnio io1opDr nvs s  eur(r3oydame lieiltf Drax pot0ape ifciat a2ulumsnt0 rxnxr oydfmDelueo;( srxm(m3nu1ol  mfcs s srtmu o;u1tpen f3ias a2rluvp;t0tltnxo3oytfp rauvi;s)setm(r3oydamen fci tfsrrr(rp;u0teeomieiadls2eau pnu4 rxnmrctodlptrlueils0t2xoio io4am e ict t) 2trurp;o0apx if3iaslm emnvo t4 eeoio3oa1fpteaieilt  etoirpou1amee fetlt  rra(m ot4tptn f3tas a umuvsnt4tlermr oa1fp  an slt  exrxo no4opee feslsfaDuax pno0oexo feild s2umump ()tlxoxf tydfmD  neil(  rxo(m io4lmenlfvtlsf rtmxront4ole if3iyt a eanmpnu)tleoiocoodfp rai o;t) rtm(m ny1openmnvs t) 2ua(mpnt4alenii3iyslsDem(von()tetomocoatlpDelneo s0srxoimpny4omenmfvi sfsrtr(moot1texnmocildlm eaump;u0 rtomr3ootlat aieolt)sexrir3oudame mnvsatf 2uaxm no0apxo feiatfm2ea(vp u)arxnmf3tytop e uesl(0 rtmimpou1ame mfeias s2ra( p;o4tlxoifeiydfmDrmu pn() rxrio oa1omteau o;t seumxo3no4lmee ietlt  rurur ot1apxoifctaslmDrm(vp u0artrxf tydoa eanvi (0seumxm3iy4lmee ncs sf rtmxmono4tpxn ociasla rmu s (0 exnmocio1fa eluvi;t  2umxo oo1llte iet (faDumurp;o4tptoiociatfm umnmo ()altoxr3iotfpDeau o;() 2toir3iodomt mivs (fs2ur(rpou0ape iictyd m rlump;t0 eenmf tadfpteluvs;( setrio io1omenmncs tf Durxmpno4aeeoifciatfsDua( p;t4 exnmr3oodlate ivo;s0t2uoxr oy1lle lnctlt a2rmu pou4tptn f3ilslmDrlnmp u0arxrxo iydfptr iei;s0 2urxr3ny4ole  ictas arrmxmo;o4oeen fctltfs eau o (0 eeomfcootomtr uvol( setrxrpoy1am nlicta()arur(mpnu4aexoifctlsfs um( pnt) rxnir3todlpDrlneilt0teto(r iy1llt mfct sfa2uauro;t0tlxoifetls m rl(mpnu4 leoir3totlmte u i s0srurxmpoo1ope miet t arta(  ot0altomfetadfmDulu s;t0tlenmf3tydlptranei;(0trtrim3no1ame mivils)s2tmurpot0oltoifctad s2em(msnt4areomo3to1lmDeai ol(0srtmxr3iy4ap elieta() ruaxmo;o1aex  ietyt s2ul(vs (4tetnxf3oy1opDrai i;(0 2urim3iy1opt  nctlt)arur(m ou4opt mf3ilsla2rmn snt4 etnif3oytoaDrliesl(  2umim3iy4oleelfeil(  2urxmp;o0aleo octydfm em(vonu4tlxrir ootomteanvo s)truoxm3nudlp e nctltfsrraumpnt4ole iiciasfm el( snu4 ltrxo iatomD  uvo;(0 rtoxr ny4am nlnesas)srrmumpnu4tlxnmo3iatls uluvon()aexnxo tytoaDrlues (0srtmxmpnydlleemfeia(fa2tmxm ot0texnii3tld a rmnmp u)areomr3iadom rlnvs;t0t2urxo3ny1lmee iesls  2tr(m oo0ale  ociasfm2rluvs;u4aexoxo3to1omtelu ol(0texm(r3io4opt  ncsat) rtrumpot0tetnio3tytfm2rm(ms;() rtrxf todoptean i s trumxm ou4lmtn icsl( a2trxm oo1open oetltfsDuanvont4 leoif to1omt  ieol()srtrir3nudlm  mnviasfarrmx pnu1opxomf3iasla2uanvon() lxomocty1faD aieilt texo(opiy1altnlncs s)arrrxronu0apxoio3iytla2ra( p;t)aetoir3ta1lp eauvs s) exoio3nydome lncias)arrrxrpno4apt iocilt m2ulnmp (0 ltnxo iotfa elu o s0trtrxm3oy1ap emncil( aDtaxront1oet mi3iltlm ua(vo;t)trerircta1lp e i o t0sexmxm oy1ameelies ()sDrr( o;o4apeo o3iydfs2um( o;(0 rtnxo to1om eluvi;()s2um(m ny4lmtnmiei ( artr(rpot4tetnmo3ild a2ul(mp (4 renioctatoatelnes t)tetrxr ny1ol  mfeia(fartrxroot4alx mietydls2eluvs;u)tetnxrctytfat li i;(0 2uoxm3oo1apt livt s) ruaurpnt4olto o3tad m emums;(0trtnmocto1op raivil()t2uo(r3oydop nlfeslt  rrmxmono0opt ioctydfm ua(vs ()tltrmr oodoaDrlnei ( texoxrpiu4lpt  fcsas  Dtm(m ;o4tetoio3iltfm rauvon(0alenxocia1op  lnvs t0 2umxo nydol nmnvsls s2trxm ou0tlen ietasla rl(vp ()tltnir totfp raivil(0seuoio3oodop  mnetas)sDrr(r oo1aeenmieiytfs2rl(mp u4 etrir to1oa  ln i s)t2tm(r3oo4ape  ieil(fsrtr( p;u1altn fcildfa2umums u0aexnmr oadoa eliei;s setr(mpny1lpen fctlsf Drmu p;o1teeomoeiyd sDel(mp;t0 rtrio ia1oatrlneol(0t2uoiopoydole mfvtas)sDrmurp;t1olxomieiydfm2umu ont4aetoxociotfp rluvo () etoir3iu4apee nes tfsrta(  nu4tpe mieiys mDumnmp;(0aexoirciydom rlies;s0tetmxmpiydap emnei tfsrtru o;t1apt ioctltfm2eanms;()aexrir3ia1fmte uvilt0s2uoim3oo1ome micias a2rmx  nt1tee moetatla ua( o;(0trxomr3ta1op raiei t0trxoxm3iydom  mivs ()s2tauro;t1tpeniictysfa2ulnvpn(4aexoir oadlpDeaivol(0s2xmxo3iudlle  fvs tfsDtmxr oo0tpxn ociytlaDra(mont0teeoirciytop  anes;t0texo(rpou1ol nmnet t)aDtmxr no1altn f3ild s rau on(4tltoir3iy1la eln ilt0trtoio oy1olee nesl(f rra(r ot1oet mfciyt a2ua(vpnt4 lxrmf oytla  anvilt)teum(m no1aleemies t artm(mpnt0tpe miciad sDuanvonu0aeeomrciy1lpDean slt)texoxmpoo4ope mnciat s2rmx poo4tlxo f3iytls2el(mpnu0 eenif todlp rlies (0trur(r iy1lm emivs (f Dur(roou0apeo ietltlsDrm(monu4aeerif tadoa  anei;t trxmxr nu1ol  mfei (f rtrx oot1tetniiciatlsDeanvsn(4arenmrctytlatr i s;t0truriopno1llee ivtl()aDur( o;u4tpe  fcilt m2ranvsn(0 rxnir3oatfpDeau slt texrxrpoudopen neiasfsDtmxm oo4apeo o3iadlm2umn s;(0 rxrifciy1fpDe neils)s2xo(r3io4apee fet s sDta(  ou4tleomietltfa2rlums;(0tlermo tadomDe uvo;(0texo(m io1oltn ivt t)arraxro;t0opxomociltfm2eanmp t) exrxf3iy1om r uei;s0 2uo(o3iu1oltelivt t aruru pnt1tptn i3iadla2um( o;(0trxrxo tydla  aneils sexo(mpiy4lm elfvs s  2rm( pno1tpx mfeiat m um(msnt4tlenirctotfp  lueo t)teur(mpnu1olenmnvias arum(ro;u1aeeoioeiysls um(mo (4artoir3oatlm   u i;t t2ur(opnu4llt lfet t) Draxr no0tex mfctatlmDua( o;u)arxomocta1lp r nei;( srur(rpio1lpe  ivta(fs2rax oot0tpxo f3iyt s um( onu)tlxnmo tydomt lneo t0 exmir3no1op  lfcs t)srrm( poo4tee  feiadfmDrau snu0areriocio1fp r ueolt  rtr(opoudam e nvs t s2tmur ot4opeo oeiltfa uan onu4aeerirciy1oatraies t trur(o no4ol elivtltfarum(r ;u1olxn iciat a emuvp;u)tetrxr3totlmD  ivi s)setriopio1llenlfvi s a2ua( oou1apen oeiatfs eanmo (0 lerxr oo1fpte u o ( t2urxopou1omt mici t  Draxm ;u0tetnmoetysla2ua(mo;(0 reomf3ta1fp rau ilt  exoxo3io1optelici tf Drru  ;t4ape mietlsfs2umuvpnt) ltnxrciatla eln o t0s2toirpoo1al e nvtls)sDrm(  no0opxoifciys s rmnvon(4artnmf oatfat li s s0 rumxrpiudaptnlnei t sDtauroot0oet mo3ilslaDuanms;u0texomr iy1laDrlivs s0srxm(mpoodamenmnvtasfs2ur(m oo4opeo ociydla2rlums (4tlxnmo3to1fpD  n slt)srxr(o iu4lp nlnei tf 2taxmo;u0aeeomf3tas s2rlu pnt0tltrir3iadlm e u ol( s2xoxr3oo1ol  mieiat)s2rrurpno0ole iietad m2ran p (0tltoxrcoy1lmt anvi (0 exrxrpoo4am n nvs (  rur( poo0oet iiciltlm uluvpn(4teerir3tydoatelies s s2tm(m ou4ope  ictlsfsruau pnu4oet  feiltfaDrauvpnt4altnxf todfm r u s s) 2um(o3iodoltn ivs t aDua(rpot1ape mfeiytlsDul(vs (0trxnmf3ty1lptelneols  etr(m oudlmeemnes t)aDtr(rp;o1aleo o3tldfm2eluvp;u)aeerio3to1lateanvs ()s2xo(o nu1ameemivsas) Dtaum nt4oetnmieiydlm eauvs t0 rermf3ia1op ranvi t  2toiopoudlleelnei (  rtaumo;t1tpx io3iydfmDelump;u0artnmo3oatlmtraivsl()teuo(m ou1om   feils)aDrmumo;o1opxnif3ilsfa ulu s u4texrmf oatomtrai i ( texrxmpnudopt  ics () Dtru o;t4oeeo f3ils m2em(von(4tetrmo3oatla  aiesl()t2xo(r3no1ape mieilt)aDraxrp;t4oex mi3iadlaDua(vs;(0 ltomocta1la  lu i ()teuoio3oudalt mnvs sf 2tr(m nt4tleomi3iatfm2eauvo t0artnmo ootlmD aieils  rxoim3nu4ol emicsat aDua( pot4tet ioetatfs2ua(vp t)aetomfctatfp   i i;(0 2tmxo3io1oleemfesatfartm( pnt4tptn fetatls2uluvp;(0tlxoxr ty1la  au s;(0t2toxrpio1am n ivtls)sDtrx  ou4tltomictatlaDrlnmo () rtnmfctodfpte nvi s)t2xr(o3ou4openmivtlt) rrru ooo0apeomi3tyd a2rm( sn()tlxnmf ty1fpteau s s)truo(o3ou4lpeemiei (faDtauro;u0tltnmf3tas a rau s u4alermo tadfmD auvilt0t2ur(o3ny1amenlnvtas srrax pnt1tlenmfctlsfa2ulnvs t4alxnxo3tatfpt li i;() rxoiopiudoltnmfvsas)a2rrx  ot0aptomo3iatfm2umnvp () rerxrcoa1lmDelueo s  rtr(opiu1alt mivsa(fsrumu ono0teeo fcild aDul( o t0tlxoirciydfp r u s;s0setoimpny4amt  fviltf Dumum ou1tpx mfeiyd a uau o;()trxrifcootla e n s;t) etmir ny1amen icsasfs2rau  ;t4oeeomieiltfm rm(msn(0tltoircto1om eanvsls  etm(o iu4opt mfctat  rur(mpou1ole  iciatlm2ra(ms ()aetrxoctadopDe nvi;s) ruo(o oy1optn fvs ()sDtrxmpou1oexomfciatfsDuauvo;u0trxrxr iydoatrau slt trurir iydomt  nei t)sDtm(mo;u0oet if3tad s rm(vpnu0trtomf iytfm   nvo s)t2toxr3oy1om e ivilsf rum(  ot4apto iciytfs umnvo u4teeoxo tytoa ean slt0 rurxmpio4ale  fciat)sDtmump;t4aptoifeilsfaDul(vo u)alxrmociotom  auvs (0texm(r nu1omt livsa(f Drmurpot1oltomo3iat s ra(mo u0trermrciatfmtelu sls)teto(o ny1ll nmiesas arra(ro;o4aex moctatlm um(vpn() rxnxf3totfat luvs s t2toir iu1lp  micsat a2umxmonu4opx  fetyslm2ra(msnu0trtnmf ootomDr nvi ( seuoio iy1lpenmfetls  2taxmo;u4aeeomi3iyt sDum(mpnt) eenmr3ta1faD lneil()srxm(rpou1om e ieslt)artrxroou4opt if3tltla umnms;(4tlxnmo ia1lm eaneil(0trumio3oydlltn fciat  Dta(  ou4alxn fetls aDumn ont0alxrxrciydomD  uvolt trurim3ny1lptnmfcsltfa2umurpno4tltnmocilsla eauvonu4 reoxo3ta1lmD aneolt s2xmio3nodlmt miesat)a2rmum no4aleomiciydfs um(ms;u) reoxr3tatfpDrlu sls0teumir3nu4lp n nvtlsfaDuaxrpnu1tlxoiociltlm2ranvsn()treomf3oadlat lues t  rtrxm no1aleemnes tfaruaxrp;o4tpeoiociltls rm(ms t0 rtnif iodfa elu slt srtmio iu4oltnmncsl()arurx pou4apeomictas s ea(ms (0aexnxfctodlaDe n i s t2xoir iodop nlieiasfa2rmx  ;t1alxnioetld aDrmn on(4teenir3oo1fmD luvo;s0trxo(o iodlmt lfcsat) Dtm(mont1tee ioeiatls emnms t4 etomr oy1fa elneilt0srxo(r3iudom nlnvtatf rtr(r nt4oee if3tydla2el(mont)tlxrir ia1fpDeaivs () 2xmio io1ll elfetas aDrr(  no4tpx ifciytls ra(vs (4trxrmf3ia1om eauvol(0 rtrxr3io4lpeemnes (fsrtr(r no0aex  ietadfs2ranvs u0tetrmrcoadomD an o;()s2xo(m no4am n ivtlt)srtr(ronu0aexnmociydfa ea(vs;u)tleoir iydlat  nei ()teuriopnudlm  liesat) rtrxmoot4oeenioeiydfa2um( p;t)trxrxrcoodoaDeai ils s2toir3io4am nmfvt sf 2ra(  ;u4alxnif3iydfaDul(mp;t4 ltnircoydom rlueols trtoim3ou1ol emncta( aDtau  oo0apxnmfciydls2um(vsnu4tetnio ty1om rli s t0s2tm(r oy1llte fvsat)sDurum ;t1alxoiieiyd s rmnvs;u)alxriocoa1omD ln o;t0s2xm(o iydlmt lfvi ()srra(mp;t4oeeo oeiadfmDra(vp;t)aetnxf3tatla  aieo;s)srxoxm3ou4ole  ncta(  2rr(mp;o4aeeomicildfm emu o;u) exrxo totfaD aueil(0s2xr(r3ou1omtnlfvia(fa2rm(mont4alt io3tldla rlnvpnu4teeoxrcto1fm e nes () eur(opiudam  mnctl( srurxmpno1tltn o3tls s rm( s;t4teenio tatfmtranvs s  2ur(r oydllt  fvilsfa2ur(mo;u4teeo fetadlaDulums t0texnmr tadomD lu s;( sexr(mpnu1ape lncta()sDtaurpoo4aeeomi3tltlm rlump u0 etoifctytlateai s;()t2tm(opnodap   nctat s2uau ont1openifciys m emumpnu0 ltrifciatopD lnvi;s srto(rpnu1lm   fvs sfs2trxrp;u1aexo fcilt s2umnvp;u0teeomrciatopDr n i;t  exoimpoudamtemfeslsfa2taxronu1olxoiietat a2ua(mp t)arxoxf3totoa eaivs;t0 rxmxr nydlmen fcia() rrr(r ot4tptnmicilsfaDranmp;t0tlxoiocoodfp rlivo t  ruoim3ny4alt mfvt s a2trxmpnt4tle io3ilt a2ul(monu0altnir3iatom   i o t)s2toxo3iydape  fesls)arurxr nu0oeto oetatfsDranvo ()texnifciotoaD auvo;s)s2urio3io4olen icta(f rta(mp;u4tee moeiydla ra(mo () exoxr iatlp  livil()setm(r3nydaltelnvt s)s2rmumpou0aeenmietysla ra( snu) exnmocootom ranei (0t2trio oy1am  mivs (farumumpnt4olenioeiydfa2raumsnu0 etoxf tatlmteai i;s seuoim3oo4openlici s) 2tmumpnu1tle  ietydla em(mo;u0arxomo3tadlateai ilt0 rxrimpiudapee nvia( s2uax p;o4tleniociasfaDem(ms;t4altoio3iy1opt lieo s) rtoxopnodomt mfct t)aDum(m nu0oltn feildlm2emnmsnt)alenir3iy1omDrlu ol(0s2umim3io1omtnmfvsa()sDtaxmp;t4oeen o3tls s umnvs;u)tetoxrctatlmDrlueo;s) rurim3ou1alenlnvia() rtrum ;t0apeo f3tatfm eaumo;u)tetrmo3ootoaDeaivi;t)trto(o no4apeemnes () Dum(mpnt4apxomo3iltfaDelnvsn()trxoxr iodfa  ai ilt0 rtm(r3nydll nmnciatf Drau p;t0opx  i3ildls umnvsnt) lxoxo oy1opD aneo s) 2xo(mpou1ap elfetat  rrau pno1opx mieiytfmDea( o u0aetrmf tatoat  ueolt s2uoxrpoo1lpenlfvtl() Dra(r nu4olx iiciltls eanmont0arerxo3totlm   i i;s sruo(mpiodoptnmnvtasfaDum( ooo0tpxomf3tltfmDumumonu4tlerxr3ootlm rliei s t2tmxopoy1olt mfci t)s2rrxmont1aleo fctys a um(mo;t4alxnxo to1fp r uvs (0teur(m3iydaptnlnvils) Dtaumpnt1aptn f3tatfs el(vs (0 exrmr3iodfpDraies;()t2trio oodll emnvta(faDtmxm nu4texoiietadfa rlumo;(4aeenif io1fm   ieo s0srum(m3nydamt lncsat)a2uaurpnu1altn fctltfs elu o u0tlxoio ta1lmDelies;t)tetmxm3oodomt  net (faDraxrpnt1altnmoctadfa uaums u4 lxoxo3iy1fmte neo ()texmxopou1apt  nvia(fsDrm(ro;o4alenifetad sDrmums;(0trtnir3iotoaD li s;s seur(r3iu4ame  iesas  rtrxmoou4opt  ieiyt a2em( o t)artrio to1fp ranvs t)srtm(r oy1amenlivilt)a2tr( oou0oeeomoctas s ua(vsnu4 lermr3iy1oaDe nes s trur(o3nydalee fetl(fsrtr(mooo1oetnioetaslaDeauvs;()trtoircoatfp eaueo ( srur(m ny4open nvsas)artr( pnt4apenmfciltlm2raums;u0 exomf iotfat lueo;s)s2tm(m io1olt licilt s2rmx  ou4apeoifetadfs rlump;t4 exomocootlmtrlu o t  rxm(r3nydole  nesa()aDraxmonu1oleniietytls2uanvp;u0 eerio todlmtelnei t0sexrim oydllenmiviat) rrmx ono0tetnifeild a2ean p;u0texrxociy1fmDeliei t0trxoim3nu1am elics ( aruau poo4tlx  i3ilsfmDumu on(4alxoxrciytomt  ivs;s srxo(opiy1optemics (f rra( pnu1aptnmociadla uauvpnt0trtrxocoytfmDeanvsls setriopnu1olteliet s artm(mpno1ale mieiasfmDemnvs u) rerxo iatlatr n sls0s2xoxr iy1lltelnctasfa2raur ou0tltoii3iytfa2rl(vsnu)tltrxo3oy1omtrlueo t)sexmir iu4ap elfvs () rtmumpoo1tee  fcilsla eluvo;(0aeeoxfcia1fmt lnei s s2tm(r3oy1apeemicil( arrmump;o4tleoiieiytfs2eanvsnt4teermf ootfpDeau sls)tetrxrpnudaptn iet tfs2tax  ;t0aptoiociytfmDea( p;u) rxrio ootomDean o t t2uoxr3iudop  lnct (  2tmu  nu4aetnmoctls a2ranvs u0tltoio3ootlmDelues;t0s2urim oudol elfct t a2rrur ot1alx  feildla2rlnmp t)tleoio3oa1optrln s;s)t2um(o3nudlpteliei ( s2um( pnt1alxnmf3tysfa2uaump (4 rtoif oodoaDrauvo;t)trtm(m ny1apt lfei (f rtaum ot4olenmo3tatfm2el(mp;(4aetoifciatoaD luvs s srxriopio1al e neiasfa2rm(r ot4apenioetadfa2ua(vont4 eeomo tydla r u o;s0t2tr(m iy1ll e fct (f 2rmumont1opt mo3tatfa rl(vsnt4tltrmr iy1fpDeaues;s) etm(m3oy4op elieils)a2umxronu1apx mfetadla emu s (0aeeoxf3oadoate n slt0 euoxm3nydal   ivt s sDua(m oo0texoio3iadls2rl(vsnu) lxnxfciy1la rlieilt)t2uoio ny4amenlfvtat) rumu  nu0tpxoifetydfs el(vp;t)texomocoy1fptrai il()srtr(m3io1ale  nvia(fa2ur(mpou4apx if3iydfa2rmnvs (0artrif3tytfmDr ies t)trxoxr3iodomtelfcias s2tax  ot4tlx ii3tas a emn p (0 rxoio io1latelnvs;s  2toim3nudapen fvtlt  2uaxrono0opxnmf3iyt m elumo u)arermf3oadfm rai ilt)s2uoim io4ap  lfvils)aDraxront4texo f3iytfm2emn p;(0arenmoctadfmteanvo;s0seumir iu1ope  net t sDrmum ot1aet moetldls umu o t4trenio oadoaDrli s s)texoxm io1omeemfvt (faDur(mpou0ole  i3tltla rm( p t)areomo3todfpDran ol( sexoxm3iu4al   nci t  rtmurpnu1aetomfcildla em( s;t)tetoif tatoa  au i;s sruoxo iy1optnmivs t) rta(mpou4tpenio3tytls2ua(mont4tltnio oy1fpDr ivo s)texrxrpou1lmtelfvi tfs2ra(m ou1aeenioctatfm ulump;t)trtnmo3tatlpt  u s;s)s2xm(r nu4lptn fvils aDtaurpot0oexoio3ils mDelnvo t0artrmf iodlmDe uvs () eumxmpiydlmtemncia(f 2ra(m no0aleoifeiyd m2umnmp u0 exrir3ty1omDr nvolt)srtmio iu4om e feias a2taxmooo4apxo ieildfa emnvonu0 rermf tytoaD aivils srxmxopoydopeelnvi t) Dtrx  no4tet  fciasls2rmu s;t4 lxnxoctydfaD  u o ( t2tmxo iydlm  mivta( sDum( ont4tpxoif3ilsfm2rln s u4tlxrxoctydfpteli o s trxoxmpiydaltn ieia(fsrtmurpnt4tlt ifeiyd m rm( onu0trxrmr3oatopD aivs s  rurxrpnodomtnmics (faruaxr oo1tltomoctysfmDranvpnt)arxoxrctytoaD aivs s)sexmirpoodol nmivslt  2umxmonu0opxoifcias a2emnmp;u4aetrmrciadlpte n s s0 rtoimpiodlmt lnctlt s2rmxmooo4tlx  octlsfmDemnmonu)aetrxr oo1omDr i olt trurxr3oo4lle  fesas) Drmu p;u4oetoii3tltfsDelnvont)altoxfciotlp r nvilt)srtr(rpnu1amtelfvsatfaDuaxrp;u4tpe mictyt a ul(vs;t)arenio tadom eln s;(0s2uoir3iu4lleelfvtltfsrrau o;t4tleniieils s em(msn(0 lxrmo3ia1laD  nvol()t2tm(m3no4al nmfvsltfa2rau ont4ole miciadls2em( p () renmr3ia1faDelueo;( srxr(m3iu1lmee ietltf Dtaur no4tlt  fctyslmDum(msnu0 leomfciodopt luvo s t2xmim3oy4ap emivt tfsrtax  no1tetomietldla2elnvs u4artrxociatfptr ivi s)sruo(r3nydlpt  fctlt arur(m ot0aexoiicild a2ua(vs;()alxnxrctodom e ues;s)seuo(r3iu1omt lncs s)a2trur nt4oex moeiys a2ulump;u4aeeomr3oa1lp  liei t t2trxm3iu1oleelnei t s2rmx pnt1teeniictys a uluvs;t)teeoxo3iodlatrluvo;(  rxmir io4opeelncil()srumxrono1tptn octls a2elnvs;u4alermf ootopDrlneilt0t2uo(mpiu1lm  mneias aDtrxrpoo0optnif3tadfs rauvo (0 lenif3iadlpt  uvo (0teuoimpiy1ale lictl(fsrumur ;o1oetnmietatls2umnvon(4tetrxf oatop eaieilt0trtrio ou4ole miesl(f rururpot4oleo f3iltlmDel( pnu) etrifctydoa ran sl() 2umio oo4lltnlietasfartmuro;t4optoifciadfa ul(ms;(0 rermrciatfptelnvo ()texmim io1op   nctltf 2trxr nu4teenmfeias mDemums (4aeenxrcoa1fa raivi;(0 2tmir3no1oltnliei sfaDrm( pot0oexomf3tas sDum(vs (0 lenmf oo1lp ean o t trtrxo3iy1ame mieil( srurx pou4tle mociadfmDeln o (0altnio3iodlmtr ivol(0tetr(r3oodllt lnvtltfaDraurpnt1aee iietld s rlnvonu)tetoio iatopDe i o (  rxr(m3iodll emiesa(  rur(mpou1apx  oetas m eanms u4aetnxfctadfptr uvo (0s2xrirpnodalt lieiat) 2rr(  no4tet  ietlt s eln s (0 rtrif ootopD lnes () 2tmxm iu1opeemieil() Draum ou0oex moetltfsDra( o (4texomo3tydom eau s;() rumxo oy4omee iei sfsDurump;o1tpt ifeiaslm2uanmo;u0aetomo3io1latrauvo s0 2xrxm3nodlp  mnvsltf rum(m ou0aex mfeiytlmDelu o u0 rerifcoytlaDelu olt0tetmxo3iudap e feia()sruaxr ot0olto ieiysla2eaums;u) eenmrcoydfatrlues;t t2tmxmpiodoltelnctltf Drr(m ou4ope moeildfsDelnvo () ltrmo3iadopDrlu s (0 eurir no1lmeelfvsl(f Dua(mp;t1apx mo3iat s el(msn(0artrmo3oodfmtrai ols  2tmir3oo1opt lnvta() Draxm oo0oex iictatfa2rm( s;(4 ltoxocoa1latr neilt)t2xrir3ou4ll elncsa(fartru p;t0alenmietys s rmn p;(0arxnxr3oy1la  li sl() etrimpoo1lm elics (f Dumxm nt0oet moctls mDrmu pnt0artnxoctatoaDe uei;s0teto(rpou4llte fcils)s2rax poo1opt mf3tlslm2uanms;u)tlxrir io1fpteluvi;s  2trxrpou4ll e ivsls aDta( onu1tpxomo3iadla ul( snt)aleoir iodop elneolt0 etm(mpiodap  lfvtl(fsrra(mo;t0oeen i3ilsfs umnvs t)arxoio3ta1lmte ieo ()t2ur(o3iu1apt  nvsls) 2tau  ;o4teeo f3tatlm ea( ont)aexrmfcta1la eau s;(0 etoir oudope lfvtltfa2ur(mpot4oeeomoetyslm2ea(vs;u)tlxnir3ootoa  livo t0s2toio3iy4omenmnciatfsDtrum ;o0tetnmociltfm uluvs;() rxrio3tatoaDeaivsl() rtoimpio4lltemict tfsrtaxr ;u0ope iocils sDeluvs;(0 exnmociytomtelnvo s0t2xoim3nydapt lictasf Dumum ;o0aptnmf3tasls2umnvont4texoxrcty1laDe nvo (  exrxopnodamenlnet (fa2urxrpou4tpxomi3tas s umn p;u) lxrif3iatfmteai slt)t2uoiopnudomtemnvslt aDtrx  ;t0apenifetydfm2ua(vp (4 ltrmr3tytopteai olt0 euoxo iudale lnctlt) Duau pno4alx  feiad mDumuvs ()altrmr3oydomDrai i;t) rumxr3nydllte nctlt aDrrxrpoo4apxo feiydla rlnmo;u)aleoif ty1lm   n s;t0 rxmir oy4opeemfesls)s2rrxmp;o4tlen feils aDranvo;(4 eerxr ia1fp  lieol(0trum(r3io1alenmfcta( artm( onu1aetnii3iyd sDua(mpnt4 eeoxo ta1opD lnvsls)teumxo iodlpe  nesas sDumxmpnt1olt  i3tld mDrl( onu) lenxrctatop elieo;()setm(o3nydlmtn ivia(fs2ta(rpot0oetnif3tysla rln sn(0 ltoiocoytfat  i olt0 eumim3iu1ale lfes sfsruaumooo4teenioetltlsDrmnmo u4trtoir oadfp eau ol( srum(rpnu1lmee fvt s) rua( ooo4tex  i3tadfa2rmnms;u0aexrif oa1lpDelnvo t0srxrir3nu1omenlnetlt  rururoou0aeenioetyd m rlums;t) lxnmr iydoateluvs;s trto(mpnu4lptemici s) 2tmxr oo0oetn f3iad s2rln o;u) eenxr iadlp r nei s0 2um(o ou1opte nctl(f rumx oot1tlxniiciysfa eau p;(4tlxnmr oydoptelnvs;s)trurim ou4olte ivsl( a2rau  ;o4aptn icilt aDum(vs;t0alxoir3oytfatrlivs t0t2umxopoo4amtelfei s)a2umu oot1optoif3iytls2uauvsn() ltnmrciatop rlnvo;t t2um(o3no1oltemicils)s2rauro;o0tee ii3iltls eauvpn()altrxrcoydfpDrlueols)trxm(mpnu4om nmieiatfarur(moot4tpxnmfcildfa ran onu4arxrmo iy1op eluvsls) 2uoxopny4lm emneta()arur(rpot0tle  fciytls2rmu o;u) exnxo todoat aneols seur(opiy4om   ict s  Duru pot0olx  o3tldla2uanmsnu4 eeomr oodoaDelueo;(  eur(m3oo1ol  micsatf rur(r oo4aexn o3tydls rmuvsnu4texrifciatfpD lieol( truoxrpiu1omenlicsls s2uaxm ou1alxnmf3tadls2eanmont0 rtnmfciy1lpt au s s  eto(r nu4op e nctasfarra(mpou4tlxoiictldfaDeau o t)trxoio3oadfaD anes;(0teuoimpnudop   ivsltfs2umumpou4tltnmietydfa2umnmp;t4altrxr todlaD lnei;(  rum(rpny4lle  fcilt  2rr(  ;t4tpto ictyt m el( onu)trtoxrctydla  li sl(0s2xrxm iu4lmeemfci t)aDrau  ;o4aex ii3ilt m rmn s;t4trenxo iydla r i ilt)s2ur(o iy4apenmfeils srumxroou4teenmo3tldlm2ulumpnt4tlxnmr iy1oa eluvol(0 rumim3iy1om  lncs (f rtr(mooo0oleomieiytla2ra(mo t)alenxf3io1fpDeai s t0 2tr(r nudlptnmicsat) 2tm(r no4tptnmi3iadla um(vpnt)alenxocio1fptraneslt  2xo(opiudlp  mfes ( aruaxrp;t4opxn oeiyd m el(mo;t4aexnxo3tatfmtran il()s2xrio oudllt lnctl()aDtax onu0teeo f3iadlaDelu p;t0 rtoxrciadomtelnvsl(0trtmxm3iu4omtnlnvilt)a2rm(ront4teeo fcild sDul( s u0trenmf3todoa r nvi (0 rxmio io1op  lncsls arumxmpot1tex moctltla raump t4trxnmf3tydoptrli ol() eumio oy4lp  lneil( aDuax o;t4alenioctadlm uluvsnt4 exnxf3iatlmt lnes;(0sruo(o oo4ape  feilt)arra(  ;u1tptn feilslsDua( pnu4artoirctatoa  ln il( t2tmxo nodaltnlici s)aDtm(moou1oet mfciltfaDraumo;u4areoioctytlp eluvols)sruoim3nydamtelics tfsDraurp;u0oee  oeiytlaDeluvont0 exrxf ta1omt  ies (0truoim3iy4ol nlict (fsDta(mpno4oeeo i3tat a eauvpn(4tleoxrcoytlaDeaueil( sexoim3ou1op   netlsfaDrau ooo1tlxn iciasfs2emnms u4tltrmfcty1lptrauei s t2um(o nudole mfciasfarraxroou1opt moeildlm uanmp (4trerxf iy1omDe ues t  2umio3ou1om   feias  2uaxm ot0altomietlt m rau pnu4tlxoirciy1fm r iei s)setmxr3iu4lmt lfetasfaruaxmp;t0aptoifeildlm2ra(mont0artrmr oa1lp r ueslt)s2umxopiy4opt livil() 2urump;t4oee  fetlt a2rlnmo;(0artrifcia1la eluvs s) eto(m nudop  livt s)sDra(  ;u1olenmi3ild s2eaumo;(0 etrxfctatfptrlnei t trtriopny4alt lictls srum( p;o1olto ictydlm2emumpnt4 eeoir tydlm rlu o t)sexo(mpiu1llt  netltf Dum( pot4alx  ieiasfs2rl( s u0tlxrmo iydoptr u ols0 2xo(mpiy4olee iei (faDua( pou4aee moeiadfa2em(mon(0 lenxo3ty1op   nvs ( srxmir iy1lmt mfvils) 2tr(ro;u4oeto oeiatlm2rmu snu)trenmo oadoat an i;(0sexmimpoydlmtnmietasf 2rmu o;u0ape ii3tldla emuvo;u4tleomf3oa1omD luvilt0 2to(rpoudome  ncsls artmxm ;u1olx  i3tyslsDrmumo u)treriocoy1omD auvils) 2toxm ny4opte ivs s)a2taxmp;o1oexomfeiatfaDeln o u) eenio3oatoateau ilt) rumimpiodape lnvsl(fsDtrur ;o4apxo i3iadls em( p;u) renircoytla e n slt) etrir3oy4olen fcsas  rtrx pnt1tee ii3iltfm ra( pnu4trenxo3tadom r n olt)trurim3iodape lncilt aDtrumo;u4tpe  ieiasfsDrmump t)aexoxr3ty1laDe u s;t texoio3oo4lmtn ivsasfa2ra(m ;o0aptnif3ilsls rlumpnt)alerxr oydlpDr ues;s  euoxopoy1op nmfcslt)sDumxr oo1aleomiciyt s2ean pn() rxoiocoodfp  an i s s2urxm iy4ole  nvt ( s2taxr ou0apeoiociytfm uluvp t) ltrmocty1lptr n s;t  2xriopno4al e neta()s2tm(roou1tlto o3tysls2el( onu0 exrxo io1lmD  uvil( trtm(mpoo1apee ies ( srumur ou0apenmi3iltfa2rlumsn()alxnxr io1oaD lu i;( trto(m3iu1olt lfctlsfsrrrxro;u4oeeo ictatfs2ea(mo;t0tlerircta1fat livs;s s2uo(m ny1lmee neilsf 2rr(mpoo4tlx mi3tydlm uluvpn(0trxomocio1la rai o;t0t2trxo3oodomte iei s)srururpoo0texn fciydfsDean p;(4aexnxociotfmDran s;() eum(opou4opt lfctat)sDrm( pnu1opxomi3iys a2rmn p;t4 etomr3totfat aues;s)srtmxrpoy1lleemnet (fsrurur oo4tpeoifctasla2eanvp;t0aetoio iy1lpDr u sl( s2xoxopny1op emict sf ruaxrpou4tpt  i3iytfs2ea(vp;t4texnmf3tydfa e u i t) etoir no4altn nvsl(faDumu  ;t1altnii3iltlsDum(vo;(0trxnmfcoodlaD  u o;t  2uoxm oy1lpe mieias)aDurx p;o4apeo feiadfa ea( s t) eerircto1fa  lieils  rxrim nu4lm   ncs ( sDrru  ou0oltnmieildfm2rm( snt4tltrio3iy1omte ueilt  rurxm3iydamtn nvtl( srrau pou1tpxnmfctyslmDeaums t) lxnmr oadfmte uvol(0sexmxrpiu4om e icilt)aDtmxrpoo0tpt  f3iadls u
\ No newline at end of file
@@ -0,0 +1 @@
+n o () eto(m3no1lpe livtltfa2tax poo1apeo ietatfaDrlnvo;()aexnxf3iy1laD li o;t  2xoxm3iy1ope lfeil(fs2ra(r ot1tpe mfetlt a2umuvp t4aetomrciadfmtrliesls)seuoxm ou4lm   ncilt)s2tmur nu0aexn ociatfsDra(vs;(0aeeoifcoytfmDe ueils  exmirpio1openmnvt sf 2ra( pou1oleomieiytfsDulumo;u4 rxnxr3tadoaDrli s;()s2xr(rpou4olee iet s) rtaumpot1oltniiciysla2ra( pnt0tltnxf3oy1laD anvo s) exrxm3oudapt  ictas aDur(  ou4ole io3iatla elu snt4teermfcoy1la  auei;s0 eurxm oy4amt  nvils  2trur ;u0ole io3iyt a2rlumo u)aexnxo io1op eaieols0 2xmir3oodoptn fetlt)srrmxm ;u0apx micias sDemn o (0 eeoir3iydomt luvsls0 etoio3nudamen ici sfsrrru oou0tee mictlsfs um( o;t)tetoiociotopte nei t)t2uo(m nodll nmnet (f Dtmxrpno1oltoif3iyt mDrl( sn()aexoxfctotoaDrlivo;s texrxmpio4lmt  fvi t) 2tax onu0apx mo3iltfm2rm(vont) rtrirciadlmt  ivi;t  2xo(m3iy1llen fvs tfarum( o;o4apx moetydfs2um(ms u0teeomrctodoateluei s)s2umir oydam e neilsfa2raurp;u4tee moetys aDumuvont4trtnircoy1fp eauvols  etrxm3ny4omt liesls aruaurp;t0teeo f3iltla2umnvs (0 exrxfcoadlatraneils texoxr3no1omeemfes s srur( o;t1tlxnmietytls2ra(mp u4 rxrmr3tadoatelu o;(  rurxm nudopt  iet ()srraxmo;t0tetn fciyt aDrln sn(4trenir3totomt  i o;t truo(r3oo4op nlfvta() Drmur nu1oet mfeiad aDeauvp t)aexrifcta1lmt auvo ( t2tr(r iy4lle lfvta()artmx o;o1aeen iciadfsDelnmo u4arenir ta1lat  uvo;(  2urxo3oy4am nlfctl(  rum( poo4oleoioeiat s2um(ms;u) rxrmo tydomtrauvo;s) 2toirpny1ol nlivs (f 2rmx p;o1alx ii3ild m rmn s;t4trtnmo3oy1lmteauvslt) rxoxo3iy1ll n ies t srrrx o;o1olxomfctadla2ean o;() rxnir iytom rlnvo () exmxr iy1lmtnlneilt aDrm( o;u4ape mfetyd a el(vsnu4aeenif ia1fate i s;s teumio iu1ole lfcs ()srumu p;o4olen i3tlsfa2uauvo;u)aexrmo3oa1fpDrlivo s trurxm nu1oltelfvtl(fa2urxrpnt0ope mf3iasfa elnvonu4 rtnxf3tatlp rauvsls s2trio oy1olenmiviltf 2umu  nu0tpxn ociatla emn ont)arenmrctotlptr uvi;s tetrxmpou1op nmfvtat)arrr(ronu0aexoifciyd a rauvsn()artnmf3oy1om   ivo;s) eto(m3nodam emnvilt) rtaxrpnu4aeto oeilt sDranvs;u4 exrxfcoy1fate ueol(  rur(opoy4opeemfci (f Dtmu  oo1alxn ieiadfs rmuvs ()tlxomo oodlp  lneilt)tetrxm iudlm   nciatf rtmumo;u0tpeomieiydfs rm( s;t0trenir3iodfaDrlnvils t2uoio oodamenmfeia(  2rmxrpou1tpx if3iasla2rmnvp;u4 exnif tytomD an o;s0teur(r oo4lp   ivi s s2uax ont0tpto ocild mDrmumon(0tltrxf iatlm  aies;t)t2xrir3iy1op elncia()sDur( onu4tltnif3ias aDrluvpn(4tlenmo oa1lm raueo (  eto(o oy1op n nct sf rrr(mo;t1tex  oetadfsDemn ont0 leoifcoatlat ai i;s)t2xm(m3iydol nmncs t) 2rmxm oo1oltnmietldlaDrm(vp u0tleoxoctydoa  au sl(0 rxr(m oy1ale  ncsa( srrrxr ou4olen fctat sDuanmp;u)aeerxo3oydopD lueo;s sexm(mpou4lleemivtl()aDrm( p;o0aet mi3iadlm2ua( s u0 etoif oy1fpD ai o s0setr(mpou4optnmfci s)srrmurono0aeeo ieiytfaDumu s (4trxrifcto1omDeauvs t  exo(rpoydoptelncsat)aruaxm ;u0aexnmo3tltfa eluvpnt) exnir3oo1omtelneol( sexrxr3ou1ol  lnct t)arrmu p;t4oleo oetytfm2ranvo u0alxnio to1faDeliei (0teur(r3ou1lpeemfet (fa2rmu pot4tex mi3iyt s rlumo (4aexnif tytoatrlueo t) 2xm(rpnu1op eliesat  rtmum nt1ape  oeilslaDeanvsnu0 etoxr3tytopt ln o s)trtriopny1oltnlnvt s)sDtr(r ;u4tleoif3taslm2eanvsnu)aeeomrcoodlm raneols)srtoimpny4lmtelnciatf Drau  oo1opxomietld s2ua( s;u0alxnif tadlmtrlivo;()seurxr nu1apenlivsa( aDrmur nu1tet ifetytfm2rm( s () lxomo iadlatr uesl()t2uoim3iy1llenlfetl(fa2tmumpnu1apxn f3tytlm rl(mp;u)trtomfcootomDr ieo s0s2toirpiodlpenlncias aDur(  oo0apen oetldlm2eln p t)aeenmf3iadoa rai s;s t2uoimpoy1oltnlncsltfa2truro;t1ape mieiatfa eanmo;()trxrxociydlat auesls0s2um(o3ny1olee iet s) rrmxro;o4apx  feiyslm2um(ms u4aetniociatopD aues s  eumir3nudlltnlieil(farrmx pnu4aexnmocildfs uanvont0alxoxf3oadfat  uvils s2urio3iu1alt  iesat  rumxmpno1oet mf3ildlmDum(mpnu) lxnxr oatla r ueo;t)srxrimpoo1omtnmncsl()sruau  ou0opxnmfeiadfm em(von() lenmrcoatfmteaiei;s)t2tr(o3oydol  lnvt (fa2trumpnu0opto o3tltfaDea(vonu)tetomociydopDeaiesl( s2xrir3iudalt mnetl()srua(m nu1ope  f3tldfa ra( onu)trtomr3oa1omtrln slt seurxo ou4lmtn ieil(fsruaxro;u1apen octadlaDrmnms;u) exnxrcoo1oat  i olt) eum(r io4ol n fvsl()aDrmumpnu0alt if3iatlm rluvpnu0arerif3to1fa elnvsl( tetrimpny4llteliesas) ruaxr ;o4ape miciltlm rl(mp (0 renio3iy1faDeaies s)trxr(o iu1altemivs s) 2tax onu1tle mo3ildfaDeln pnt0 rxnmf tatfmtranvo;t)sexmxr iudale  nvilt  Dumumooo0texo fctysfs ea(mpnt) rermf3ty1fpt  n i t)t2uoxr nu1apeemnes (faruau  oo4openii3iytlaDrau p u)trtrxo3iy1fateai sl() rto(r3no4al  mictas arum( pnt4ole iocias aDel( ont0trxomr tydlatrlnvi () 2tmxo3ny1op e nvslt)aDuru p;u1tlen i3iadfm uan snt4 lxomo ootlaDrli sls)srtm(mpnu4lmt lfei ( aDrr(rpot4tlxn icias mDea(mo;()artoxo3iydlmtelnei t0sexmxopoo1apenlfvt tfs2tru pot0oet  f3ilsfmDrm(msn() eenxfciotfaDeau s;s)trxoxmpno1lp e fvt s  2ur(m ;u0apen icildla ua(vo;t4trxoxrcoydlpDr i i;(0srumxr3io4aptemfcslsfsrrm(mpoo1aetnifcilt s rauvs (4artnir3totomDr n s;s)trum(m3oy4lptemivsl(f rraxmooo4oexn octlsfs em(mp;t0altnif3tytlaDrlnei t)srtmxm nydap emnetatf ruaurp;o0ape ifeils s2rluvont4 lenifciotlpt  n sl( t2xrimpny1om elfvil(fsrtmumpou1tpenmo3ilt s2rmu p (4artoxr iatfmD  nesls)trumir3ny4am   ici sfsrururonu0opxo oeiltlm rl(ms u) lerio todfmDrluvo;t s2xo(o oy4lmtnlnei tfsDta(ront4teeo i3iadla uanmp t)tltomo oytfptr ivol()trtrxmpiydom nmnei t sDua(mp;t0aet  o3iydls2ua( o;t4aetomf3iodfm ran s;t) rxrim nodop  lfvsas artm(  ;t0tee  feiydlm rl( on()tlxnxrcoo1lpte uvsls)t2um(mpnu4omee nvilt  2tm(r nt4tpt ii3iltfa2el( o;t) exoxr ootlmt aiei s0 rtr(m iu1llenmictls aDumumont0oexo fciaslmDean on(4 exrxr tytom e u o t0 rtr(o3oudal nmieias sDrmur ot1texomoeiytfm emnmp u)tetrif todfm  lueo;s0 eumiopiudam elictlt sDtmxmpno4apeo f3ilt mDua( s;t4tlenxf3tydlate uvilt teuo(o iy4olte nct (fa2umu p;u1tptnii3iytfa2ea(vo t0trtrmfcta1fpte ivs ( t2tm(opou4alenmfesat sDrm( ooo1tpenmoeiadfs rluvs;u4arenxrctodopDe u olt)s2umirpiodolt mfcslt sDtau p;u1opxnmfeilslmDua(vpnu)aleoiocta1fmt anvs t) eto(m3oudam elfvtlt arraxrpnt4tetnmoetadlaDrmn s;t4aetnxf3tytomtran i;( truoxmpiy1lmt  fvtas srumxmpou0aet ifetas aDea( p;t4areoxo iytfm  livs s)seur(opio1ale  nvsl(f Dtrum ot0openiictlt s eanvonu0 exoir oo1faDrlnvilt0sexoio ou4al nmfctltfs2um(m ;t1alen ictltls2eau s t4 etnmfcootlpDr i o;s t2to(mpoo1ope lfcsa()srrmu p;o4teto ieiytfs2umumo;()aetrxr3oadfmte uvo;(0t2trxm iodomt  ieta(  2tmu pno1aeeoifeiltlm rmuvs u4altnmr iytlmDr nvilt sruoxo3no4llt liesa(fsrumxmo;u4tpxnio3il
\ No newline at end of file
@@ -0,0 +1 @@
+nvils0s2um(r iydom elfctlsfs2umx ont1tpt  iciatls ra(mo u4 reoiocoy1om rluvs t trxrxr3no1ap nmfet t s2trum ou0tlx iictas s2rm(vp;u0aetrmfctotopDe u o s0 rur(o oudol   nvtlt  2ur(mooo0ope moeiysfaDeluvonu0teerif tadoat ai s (0seurxm3no1op e netl( a2rm(mo;u0open oeiysfm em(mp (4aetrmf oa1fmDe ivo;t0 exoxo3iu1al  lfetls) ruaump;u0opto ieiysfs umnmpnt0tlxomoctadomD li ils) exmio3nu1opt  fes tfartrxr ot4oee  ociytfm uaumon(4trxnifcty1oa ean o;s)s2urim iy1ol nmivsa( a2ra(rpoo0tlxoifciys a2eau p;()trtoxo iadlm r n o s0 rto(o3io4olen fcsls)sDrax  nu4aexnifcilsfm2um(vpnu)teermr iodlaDelieolt)seur(opoy1altn neils  Drmx ooo0optnmietasfs um(vo t0arerxf io1fm elneo;(0trxrxm3oy4op e fct t  Dumumoot4aex  iciyd s2umu p;u0aetoio ty1fpDe i i;(  2uoir3io4omt mfetatfs2urx ono4tlen oeiyt s ea(vo;t4aetrxf3tydoatrln i s srumir3oo1ll  mncsltfartmur ;u4olxomo3iaslsDrmuvont0treoxo io1fa   nes;()s2urxo iydlpeelieil( srur(rpnu1tlxoifcildfs2eau p;t) rtrxfcoytfm  lnvilt)srtrio3oo4ap elnetlsfsrtmx pou4tlen i3tydlm rau o;u4altomo3iytlmtrlivs t)trxo(mpio1apee nvs t sruau p;u4olt ifctadfa2ran pnu4aetrmo ia1latrai o s)teur(m nudal elictas) Dtau  ot4tetn fctadls2rmn o;(0texoxr ootfm rai slt)sexmxmpno1om e fcil()aDta(m no4tlenmfciasfmDrmuvp;()tlxomr oatlptrlnvi;()t2uoir3ou4lpenmnetls s2rm(ro;u0oeeoiiciasfm2umumonu0alerir3iytla  lies;s s2toxr3ny1op   fet t srumx poo4tpeomfeiysfm elnvp;u)trxrir3iydfmD au s t trumxmpou1am elivia( srrmur nt0tpe mfeilsls ua(vpnt0tltnirciydopDelneil( s2xmiopiu1apenlnctas  2uaxrpot4alx  icilt s rm(mp;u0arxomr3oa1lp  au ilt0srtm(r3nudale lictat) 2tr(mp;t1tle mf3iltla2em(vpnt)tltnio iotlmt aneol()teurim oo1open ietltfs2trumoot4texnmo3iatla em( o;u4aetoxfciodlaDrai s;s0teumir ny4lmtelnci tf Dtm(rpot1tlto f3iyd s2eauvon()altnif3io1faDe uei s0tetoxrpoo4lm e nes tfa2ua(mpnu4apenmoeiyslm elumsn()alerir iatfmD  nvo;s t2uoim3io1lptnlncs t)s2rru o;t0tee io3tad s2emumon(4aeenmrciytopDrlivi;t0setoir iudomtn feiat)artm(moou4alxomo3iadls rlnvs;t4 rtrxocootom  lu i t t2xr(r iodomee netas  2taxmo;o4tlxnmoeildfs uluvonu) renmrcta1fptelnvi ( t2umxrpoodamee icslt  Dtm(mpnt0oetnifeiasla ua(mo ()aeenxr ty1fmtrlu o t t2xoxm3io4lpt mncsatf Dtmurp;o0aeeomociytfa rl(ms t0tetoir iatoa eau i;t)sruoio3oudlp nmietatfa2ra(mp;u0alt  ictatlsDeluvp;u4tleoir3oydomDr iei ()truoxopoodale mnes sf rtrxmp;t1oleoifetytla eanvont4arxoio iadop rlivs s)trtrxr3iu4lmt mnes sf rrax p;o4aexoio3tasfm umu on(0 ltnxociotfa rli i () rtmirpiodllen nvsas)a2um( oot4apxoiiciat m um( pn()trxrifciy1laD  neo s) exo(r oy1om nlfetl(fa2tm(mo;u4tex  fciyd mDemuvo;t4aeenmf3tydfate uvols)srtrxmpiudape  fcsa(  Dtmxmoot0alxnio3iydfm2eln o;t)trtomr3iatfat luei (  rum(m3oudoptnlnctat)sDrrx p;o0olen i3tadfs emnvp;u4aexoircoadomtrluei s) exrimpoy1omtnlnet t) rumum ;t1apxn iciltfmDua( p;t) rermo iadop rluvilt)trxoxm3oy1alen ivtltfarua( onu0oetnmfetasfs umnmp u0arerir oy1fa raivs s0tetoio iy4olee feils) rumx p;t4ole io3iydlaDrmu s;t0 ltnmf3io1lm eauvi t0 2trxopiydoptemnvsa(faDrmx  oo0oltoioeiadlsDel( o t0tlerxr ia1omt aues;t0sexrxm3iu1alenmnvsas  2umxm nu0aeeo oeild a rlnvp;(0altrio3oydlpDrlnei;s)setrxm3ou4apee fetls)s2raumoou0tpto f3tltls2uanmpn(0 lxnmf oy1lptrau o;s trtm(opiy1amtelictas)a2rau  no0ale moetysfs el( onu4 renif oo1lmte ies;t) rxrim io1ap elfvi s  rtaxrpnu0optnmieildfs2umuvsnu0trtnxrcoytoa elneils srurxo nu4optnmieiasfs2uax pnt0altomietas aDranmon()tlxnif3ia1lp elnvils0srtr(o3ou4aleemics s)srrm( poo1tpx ii3tat m2em( pnu) rermf oydfa rln slt texoir oudlptnlnctltfaruaump;o1texn fciyslm2ra(ms;t) eenir3tytlaDr uvs;(  2uoxm iu1omt mncs (farum(m ;o4ale mfctyd a2rau p;(4aexrmo to1lmtelu ol() 2uoxrpny1ame  nes s  Dumxr ;u0tee  feiasfsDulnmsnu0 renxf oydopD livi;( s2xmxo3oudom nlfvtat s2ra(monu0oeeo ietad m2rmu pnu4trxrxocoadlmtr nvi s tetr(m nodlmtn ivia(fa2urxmpnu4tpt mf3ils aDelu pn(4 renxo3tadoa eai ils s2um(rpiodoptn icta()a2rrur no1oeen o3tlsfm eaumpnt4aetnxoctatopD auvi;s)srtrxopio1am e ncsa( s2um( poo4tptoifetatfsDulu p;u4 exoir3iydfmt liesls)trum(rpno1aptelfvsls)s2rr( o;u1tptnmoeilt a2umnms;t0tltoir oytfpD aivs s) euoim oo1al emiviltfsDtaxm ;t4aptoio3tys a2elu sn(4 exomocia1lptr uvs;(0texrxm ny4om e nesa(f rrauro;o0aetomieiatfsDeluvs;t0trxnif ia1fmtelnes s s2xmimpiy1aptelics s)a2rmu onu1altn f3iydfa um(ms ()artrxo oo1fm e i o (0sexrim3iydlm   net t)a2rau poo0opx  f3iyslm2rmnvpnt4tlerif oa1fm   uvo (  eto(o nydoltnlfesa()a2umu pno1altn fciat aDea(ms u4 rxnxf iydlatr n slt)texm(o ny1ame lictas)arurxrp;t1oetnmo3tyd s emuvo u4areoir todfmte nvi t0t2xo(o3iodal emies tfsruaxrpot1apen oetlt s2rl(vpnu0treoir3oo1omD aueilt t2umxrpiu4optnmnesltfa2raxro;o0tex  ocild s rmu s u) eenif3iydoa elivolt tetrxr oodameelnvtltfs2tmumooo4olxnmi3ias s um(msn(4tetomocoa1opDrli i;t0s2um(m3nudlp nmfctltfsDrm( pot0aleoioeiyd a raums;u0trxnxf oydop  luvslt0s2umio oo1ame micsas  2ta(rpoo0olto i3iltfaDulu s t4 renxociotom raueols)srurxm3oodoltemnvta(f rurur nt4aleomietadlm elnvo (4alxoio tydoa  liesl(  ruo(rpoo4opte ivi sfaDtm(mpou1tetnifciadlaDumnmp u4aexnxfcoodoa rau ols0 ruo(o oudome  nesls artau poo4opt mocildfsDrlnmsn(0tltrxf oatop eaiesl() rumxr oodlmtemfvi t sDrmxrpno1oexomf3ilsfa2eau p (4 rtomfctydfa  lneilt)trur(mpoy1opt  ieiat)sDtrxmonu0tpe ifciyd aDul(mp u4trxoir3iytomDr ueo;t0 rxoio3ou1olee fcias  2rmxmp;t0apeo ictld mDran snt)trtomf totop eau i t s2urxo3no1ameelfvtlsf rtrx  nt4tex  iciatls rm(mo t0texnio tatfpDr neslt)s2tmxopiodop   fvil()sDtaur ;u4tpe ifeiyd mDumumont0aetoio iytfmt  i s t)s2uoxr iodame  iei t  2tr(rp;o0oetnioctad aDra(ms (4aetrxo3ta1fat lu s;()t2tr(m iy1ope  ietl(  2tr( o;t4oee io3iydls el(vsnt4 etnmf iadfmteaieo s0 exrxmpiudlp n ieil(fsrum(r ot4texoio3ilslmDemnmo ()aleomo tatfm   nvs ( s2urxo oodaltemneiatfaDtax  nt1oet iieiltla2umumonu0tltnir3ta1oateaivi;t  rto(o iu4lpeemfci s  Dtaur ot4oetomf3tlslm2ulums;() ltrio iy1lpt lueo t  rtrir oy4lmtemivs (fsrumump;u1opxnii3tad mDrlums u)tetrmfctytfaDe ues t0 rtoio iodol e ncsls)a2uaump;o0ole iociltfa rlnmp t0 lenxf tatfmt an olt  rxoxmpiudlm n fctltfs2tr(r ot1tltomieiadlm2rlnvo () reriocoadoptelnes;t)trxo(m3oudlmenmfesas s2umxm nu1apto o3ildls rl( s;u)tltomo ia1lm ranvi s  rurir3oy1opeemivs (  Drm(  oo4texomi3iatlmDul(vp (4altriocoodfm e u ols  2umiopno4ol  lfcil(fsrumxmo;o1openifciltls2umuvsnu4teeoif oadfp rlueo (0 2xmxm3oo4ame mnvsls)s2um( onu1oeeoiietld s2ul(von() renxf totlmtranes;( trxrxmpoy1ap  miet (fsrraxrp;t0aetoiociyslm2rau o t4 eeoxr3oodfatrlu slt) rxmio no1lltn fctls)arta( ont1tee ii3iydlaDran o t)tlxoif iatfmD  nvi t)t2toxm nodlmen ivsa( sDrr(ronu0tet  octat a2el(vs;(4alxoif ia1fmD  n s (0 rxm(m3iydlltnlfvilsfsDtm(r oo0apto fctyd sDumnvsnu4tlenxrctytlaDeai i (0 etrxm no1openmietlt s2raxm no0texomo3iydla2ranmpnu0artrxf oadomD livils)srtoxr io1ome lnes tfsDuaxrpoo1tpenmictlt a rmumo u4alenmf iytlmD anei s  2trxrpiydalt  ietl( sDtm(m no4oexnmoctlslm2eanmsn()arxnif tydoate n i;()srtm(opnodlpeelnetas)a2rrum ou1teeo f3ias mDulnvs t) etrmr iodlmDeln s s  etrxm3iy4lmtemicsatfsDtmu p;u0tpeniieiltlsDrmu pn()tltoxf totopDean o ()t2xr(o oydomenlicta(  2uauront1opx iietadfsDulnmsn(0trxrxfcty1omDelneo;s)trxo(r nu4apee fvs t) rtrumont1ale  ietlsfmDuanvs;t0altrmr tatlmDeanvslt)srxrim oy4amtemfct (fsrta(ro;t0tleoioctaslaDrmnvpn(0arermrctatla eau i s texo(opiu1lpee fcia( sDtaxrono4aexn fctldlm2eaums;t4trtoxo3iotlpDe uvilt setr(r oy1apeelnvsa( aDtaum ;u0olt if3tysfa2rmn p t4artnio tadopt aivi;(  etrxm3io4lmt  iet s) 2tm(mooo4tpt iociltlmDemnvo t)altomfcootfmt  nvs;s  rurim oo4olee fvtlsf rtr(rpot1oeeomociytlm2rmn p;u)aleomf oy1oatr ivi;( trxrxrpiydlpenlnvsa( sDur(mpot4aetnmf3tydlm rl(vo (4trtomocoodlmte u o;s)teumim3iudopeelietls)arur(mp;o4apxnifetlslm emnvp u0 rxoiocoytlaD aiei;t0texrxo oydaltelnciat)artm(r ou1aetomociadlsDea( snt0 ltnir iodlpD aivi;t0s2toxmpny4lm e fvi ( a2raxrpno4teenifeias m uln o;t0aetoir oo1lpDeau sls srur(mpiu1llenlfeta()aDumx oot1opeo f3iytlm2umnvo t0alxoxr3to1la  aivils  2to(rpno1om nmicsatf Dtmx  nt0tltnif3iyt aDeauvp;(0 lxrxo oydlmDr ieo;t sruoir3oodll nlieia() rra( p;u0altniictlt a2ea(ms;(4alenir todfm eli s;t sexoxr ny1lmt mfetasf 2rmu o;t0olxn ocilt sDea(vp t) etrmf3to1lmD  ivil( s2uoxo ny4al nlnesat  rra(rono4tlx  i3iatfm ranvpnu)trenxr oa1fm  ln i;() 2xo(m3iu4llee fvsls) 2rau  ;t4tptomietltfa2emuvp (0tltomociadla  lnvi t)s2tmim3iu4lmtnlncta( sDur(rpno4teeoiietyt mDeaumon(4 lxomocoatla r u il(0 rxr(mpnu1amtelfctl(fsDtrxro;u1oleomoeiatlaDemums t0tleriociodfmtrlieo;( s2xr(mpou4lmenmnvi () 2taxmont4oee ifctatls ra( p t4 etrmoctatlpDeaiesl(  2tr(m io4lpt  iesa( sDtrxm ;t0olxnifeiadlmDemnvo (0 ltoir ta1laD aueo () 2tmio3nu1optelictls aDtrur no4ope ioeiatlm uanvs;u)alerxr iodfm rln s;t t2xoxo3ou1om n nesasf rua(mp;u4opxniociyt mDumu s;u4tlenif oadlpDeauei;t0 eumim io1ol   fvia( sDta(mpoo4aeen i3tlsfsDrmn on() exomfcoa1lmtean il()teur(o3no4ol emivsa()aDuau  ot4opx mfciydfs uanmo;t) reoxf iytoat anei t t2trxo ny4ameemfcilsf 2rm(  ;u4tet if3taslmDumnmp ()alxoxfctotlaD luvs;t0t2xmir3nudaleemnesa(fsDrm(mpou0oeen ictytls emuvp t)arenxfcoodlptrlivils)teurio3oy1alt mici t) 2tru  ;o0opt mo3iad aDumn o t0 exoio to1oa  aiei;s0texoio3oo1lleelfetltfa2uaxm ;u4alxn o3tldfmDulu snu0aexrmrctodlpD ai s;t0 exrxo iy4olt  nciat a2rru onu4apx  iciatlaDrlnms u0arxnmrciadfateaivil( srtm(r oo1al n nesl()artruroot0aeen iciad a2rl( pn(4texnxr3oydomD auvi s) rxoxmpno1lmtnmicsls) rrmxr nu4teeoifciatls2rlnvo u)tetnmocoadfm e nvs (  2xmirpoo1ol nliet s)sDur(rpno0alxn i3iyd a rlump () rxrmf oodop e ivo t srumxmpou4altn nvilsfa2rr(rooo4oltomoeiyd mDua(mo;u0arermr oa1omD  ieils) ruo(mpiy4ole  nci tfsrum( pnt0apeoioctyslsDeauvo;t0alxrif ootlaDeaiei ( t2xo(opiodomt lnetl( aDtrxmp;t1apt mo3iydls ran o;t4 ltrmr3iy1fa rlivolt s2toir3oudame  fvslt)srtau  ;u1opeo ieiadlm umn snt)tlenxr oadop rlu i;t  2tmimpio1ape mnvslsf ruauroot1tlt  i3ilslsDul(vs t0texrmf3ootoa elnes s)srxrirpny4lp emfvtat) 2ur(mpot1oetn o3iatfaDrmnms;t)alermf iytomt lneilt0tetr(m io4omt livta() rtmum ;u4olxnifciasls ulnvo (4tlxoxf3oadlm   ivs;t0 rtm(opio1oleelnvtltfa2ur(rono0tle ii3tys aDeaumont4 ltoxo3to1fpte ivs s)t2um(o iudomtn ivs t)arrm(rooo1tlx  fciltfsDuaumo t0aeenif3iodom e nvi t  eum(mpou4lle lnei s s2truro;u1olx ifcias m2uanvpnt4 rerio ootfpDe ues s0texo(r oudaltnmfeil(f 2uau  nu0apeomietldfaDemnmp t0arermfciatoaDrluvs;s t2urxopoodolenlnesa(  2umum ou0tltoiiciad s rlumpn()artrxf oa1lateli o;s0s2toxo3iodopt  neiasf rur(mpnu0apt mietyslsDemn onu4 rtoxf3iydopt lieo ( s2xm(o3no1lm   nvt (  Drrum nt0apxoioetytfmDulnmp t0tltnif3ia1fm eai sls)teumxopiydal e ieslt) rtrum no0ape  f3iasfa um(vo u)aeermr3ia1lmD luei (0trtmxo nodlp  mics (  Drm( o;t0teen feiadfs eluvp;(4trtrmrcoo1fa  aivilt0 exoim3iodomtn fvsasfaDtau  ;t1apeo oetydlm rmuvp;t0 etomo3iydlpDrlnvsls texo(m iudlpeelnciltfsDtrxm nt1texo o3iyslsDrmnmont)aexomf3oa1om eauvslt t2to(m3oy4amen fei t)artau  ou0olx mf3iydfa ea( pnu4tlxnmo3to1omt anvo s0t2xrxr3iodom elncsls)aruaum ou1apt mfetysla2em( s t0alxoioctatlpD anvslt)s2tm(m3oodolenlieilt artmxmo;u1apt  oetyt a el( on()aeenxf io1fmDeauvo t sruo(o iydal  lfeslsfaruaur no4open feilsls2ra( p;(4artnmo oo1op raivols0setoirpno4lm nlneta()srrm( oou4aet  f3iysfaDrau on(0 eeoxf3oadfmtr ies t  etoimpiy4om eliet t) rtaurpou1tlx ifctyd s uln pnu0 ltoxf ootom eluvsl(0 rur(opiu1om   icsl(fsrtax  ;t0tlxnmietldlaDea(vo;()alxomo3oatfm   ieil(0 euoio io1omtemivi s) 2taurp;o0apxo o3ils mDeanmsnu0arxrir3iodoaD auvils)t2tmio oo4op   nctas  rur( onu4oee miciyt sDrm(vo;t0treomrcoadfmD ln i;( t2xrir oo4oleelnei t srtmu pou4tpxo f3iytfsDrm( pn(0arenxo iydom rlues ( t2xrirpio4am  lfcia() 2rm(  ot4ape mi3iyd a2eanmsn() leniocoodomt  i ils0t2xmxm3oy1ope liviatfs2ra( o;o1tle ifciyd mDeluvp u)alenmoctadfatraueil(0texr(r oy4lmt lfet s)a2uaxroot4aetn fetys s rm(mp;u)arxnmr3to1lmDranvo s0 2xoxr3iy1am n iviltfsDrru oou1tetnio3iys m2rl(vs t) rxrio3oodlateaieolt)t2xoir3oy1lmee ivsl()s2trurpno1aptomictlsfm2uaumsnt0 exnmfcia1laDean ols0s2urxm oudapenlict s)s2umu pnt4open feilt mDrlnmsnu0 rxrmf oodomDr ivs ( setoxr oudal n feil( sDtau  oo0texoii3taslmDrln o;(4texrmo iotoatrli i t0t2uoir ny1om e fcil(fa2um(r oo1tltnmi3iadlsDeauvon(4 rtoif3iadlm rln s ()trxmxrpou4apt  nci t  2umur ;t4oeen i3iydla2el(vp;t0 reoxocoa1fpD  uvi (0 rtoxm ny1ll nmies tfs2raxm ;u0aleomfeiadfaDea( o (4tetnmr3todlmDr n s;s0s2xm(opnodlmt mncil(  rrmurp;o1tpxn ieiyslaDea( s;t)aeermf oydfaD lieols) 2tr(o oo4amenmfctl(  Durx poo4opxn oetltlm2eln s;(4 ltoxrcta1fptr ieo;s)srumxo3oo1omtn fetls srtm(m no0aeenmieiatlm2eaums;(4trxniocta1la   i o;s0s2xr(r3nu4alen ici t sDur( poo4openiietadfm rln on(4aleoxr tadoaD lueo;s)srurxmpiy1ap  lfcsl(fsDrr(rpno0alxnmoeiyt a umn s u)trenxf oo1fpt lneol() rtr(m oydlp emfeils)a2umu  ;u1tpenmfciytfs um(vo;(4altnmo3tatlpteln s;s) etmiopoodolee ieslsf ruaxro;o4tpt mociytfa2elnmsnu) etrxo oodfptrau o;s0 2xr(r nudlmen ici (fsrrru  no1aeeo iciltls um( p;t4altnif to1lmt anvi;( trxoim3iu4op emncsat s2rr( pou1apx ioetadfs umnvs;t) lxrmo iytomteaneo;() rxo(m iydlp e fci s aDrm(roou1teenmiciltlm2um( p;t4tetnio3iodlate ieslt) exm(mpny1am  mfes s)s2ta( o;t1tptomieiatlm2ea( pn()alxrmo3ty1fa eauvils t2uoiopoodlltemici s  2uau o;o1tet if3ilt a uaums;u0 lxnmfciotlpDeaieolt0t2toxm3ou1lpt mnctls  Dum(  ;t4apeoioeiaslsDua(ms;t0tetoif3oadopDeauvo (  eurxopnodlpenmfvt s)srumx  no4aex  fciltfm rau p;t4 rtomrciotoat ai s t)s2trim3oudlmt lfes t)arur(mo;t0altoifeilt sDra(msn(4 lxnir3ty1fat aueo ()s2toir nu4lm  mici sfaDrmxmpnu1alen fcias sDrl(ms;(4arxrif3oa1oa  liei (0 rxoxrpnudaltemietl(f rrrum ou0opeo fcias s elnvs;(0trtnifctydfaDe nvs;t trtoxopiodal e nvsas s2rmxmpno1tpeo octldlmDra( o;(4areomrciodfaDrai i ()srxmxm oo1lltnlnctlt) 2ua(m nt4aleomi3iysla2uauvp (0 exnmrciotopD au olt sexoir3nu1ome mfctas)aDrrxmoot0apx iieiyslsDra( s;(4alerxrcoodlat  u o (0t2uoim io1lpe lfet t a2rrur ;o1altnmfcils a eanvsnu) rxrxo oytfpt  nvs (0trxoxo oy1op nlnctls)srta(moou4texo ocils a eluvo (4tleoir3tydlpt li olt s2xm(m3io4ap elncsasfsrtm(  nu1aleo icias s2elnvsnt0tetnmfctydoa ran s t t2xrxr3iudaptnlictasf 2ua(r nu0tpenmfeildlsDuanvs;t0 renxr oatop r uvs;s  rtoim iy1ll nmfetl()arurx pnt0oet iiciasfaDua( s;t0 eenmf oytoa   nvo t0 eumxopiu1ll nlietat aDrm(moou4aex  f3tytfa2rln s (0arxnirctytfp rau i s) ruoio3nu1amte ivsa( aDtmuronu4aeenmieiysls ulu o;u0tlxomrciydopDran slt  rtmimpoy4ap  mfci tfsrtrumpnt4texo o3iyt mDrlumonu)texnxf3iotom  au o s trtmxr3nodomenlneslsf 2uaxrpnu4aetnifeiyd s2rm( o u4artnxf3oadfmDeluvs s0s2xmxm ou4omen ncsasfs2uaxr ;t1tet  oeiad mDul(mpnt)tlermrcoydlaD au i (  rxr(m3iudopee nvi (f 2tmxrooo1teeoii3ias a ea(vs;u) rtrxo3oytlmD ai i;s0 2umxr oo1ap nmiei ( artaum ;o4open o3tydlmDuanvpn(0areomo oytla eln s t0setrxo3iodal elici s)srrm( poo4aee  ietad m uauvpn(4 reoxf oytoa r i i t0trxoim3iy1omt lnetasf rur(mo;t1oexnio3ias s ea( o u)tetnmoctadfmt anei;(  eurio3iy1al nlict s  2rmxrp;o4optomf3iyt s2ran snu0aetrir3ootlaDeluvo t) 2uo(r no1om emict (  Dtmx  oo0apx  ociltlaDrlnvsnu0tlermf ta1op   n i;t0trtmxo oydomt lnetlsfa2ur( ono1tptoii3iysfmDem(vs;t4 lxnmo3ia1omD  nvo;(0texo(mpou1op   nvsat aDtmxm ;o0aetn octytfsDrmn pnt0 rxoxrcoydfmt  n sl(0sexmir iu1om  miesas  2urx o;u1tetomfcilt m rln p;t4tlenxrciytfmD lneils0sexrirpoo4llt  nesas  2tmxro;o1apt mfeiysfmDumnmo;u4 ltomrciodla eau ols0texrxmpio4am elfct tfa2rmxm ;u0oeenmfetlsls2ea(vs ()trerxo oo1opDe i ols seuoiopnydome lici tf Drr(mpnu1apxnmociaslmDemnvo;t4alxnir iotoateanvi ()seuoio iu1lm  lfvil(fsDtauront1alto oeilsfa rm( s (0 rtnxocto1fptr ieo s t2xo(rpny1omenmnctltfsDrrxmpnu1tee  icilsls rm(vont0texrxr3iodom e ivi;s)sexoxr3oudamtnmivt t a2ua(mo;u0tle  ieiytlaDum(mo t)aetnmo ta1lpD aueil()srxoxo nu4lmt mnctas) Drrx p;u1oet ioetls a2ul(mpnt4aeerxo3to1lp rau o t0tetrxrpiu1al e fet s)a2trur ;o0apxomi3iadfa2ulnvs;()artrxr3iodoa e neolt0srtoxo nydlpt  feiat aDtrxr ;t1oeen ieildls umnvon() rtomo3tatop rlnesls) 2ur(mpiydllt lfeiasfsrrrx ono4apto ieiysfaDuauvsn(0 exoio3iatfpDeanvs;t0trur(r nydoltelfeilt)a2raxro;o1aee mo3iyd sDranmo;t) lxrmrcto1lp  aneslt0 rxm(opoy1oltn feslt arumxro;t0opt  i3ils a el(mon(4arxrxo3ty1fm   ies;(0s2toxr3io1am   nvt sfsDtm(mpoo0altnmo3iad s rm(vonu4aeerir3ootoaDeanvs t)t2toirpnu4lpeelneilsfsruax ono1aptomi3tas s rlnvs u4tlxoir oydomDeli sls) euo(mpiy1llenlnvsasfa2umu pno4tlxoifctyt m2eanvp (4alenxrctadlm elu ol(0s2tmxrpio1al nmfvsat) rrr(r no4olenmfciytfmDulumpnt) exnmf oatoatraivsls0sexoxm iydomen ici (  2tm(rp;u4olx  feilt s2emn pn()alxoirctodfmDrlnvol(0 exr(r iudlp n netatf Dumur oo4olxoiocilt sDrm( p;t4treniocoatlp raieolt teuo(m3no1ame mfcs (  2umumpot4tpenmi3ildfs uauvs t)trtrmo oy1fp  lieo s) eur(mpiodomtelivia(  rurum oo1tptnmfciat mDumn o;(4 eermr3ia1lmteanvols tetm(r iu4am n ics ( s2ta(mono0olxn iciasfs2eanms;u)arxnifctatomDeaneol()trtoim oudape lncsa()a2tmumo;t4aexnmo3ilt m2umuvont0 etnir3totlatr nes;(0seurxopiu4ll e nci ( a2ta(mpno4tlx iieiad s2rm( onu4 rxrmf3iadoa raies;s  etmxo3ou4alenmnciasfsDrrxm nt4tee mfciadla rluvonu0 leoxr iydomDrlnes (0 2xrxopio1ale  nct t sDuaxmpno0tltnmfciad a2uanvs;u0 exnir tatlpDe n slt0srtrio3ou4aleelnvtl() Dua(  ou4oleoifetlsla2emnms u) leoir3to1oateanes;t0setoirpno4lmenmici s)artrxmoou4altn f3ilt s uan s t)texnxfcoadom   i i t0trtrirpio1am   icsltfa2tru pnt4tltniieilsfs2ua(ms;u0teeomf oydfate u ils  2xm(r oodoptn ivtl()srur(mo;o4olxomfeiyd s2uluvo;u0arermfctodlpt aues;( sruoxm3oo1omtnlieilt)srrru p;t0aleniieilsla2em(vs t)aeenmfciatlatr nvs;(  2xrim no1lm  mncta( aDurxm ou4texnmfeiltla rmuvo;u4trxnxrcoodop   ies;(0 2uoxr3oo4amt  ivtlt aDtaur ;u1alxo octat m2emuvs (0tltnxr iodlpt aiei t0trtoim3ny1am nlfvtas) 2tmumoot4aeeoii3tltfs uan p;(0aeeoir todom r i ols0trum(o3oo1lmt mfvtas arur(mpno1apt if3iydfmDum( o t4aeenmr oodlptr nvs;t  euoxr nu4op n fciasf Draxro;u1tee ifeiydla2elnvsnu0 exoif ootlp r i o t) 2umim iu1lmt lieiat)aDrmumpnt0aexomi3tysfaDumump t0texnxo iydlpteliei t0seurxr oy1ol nmfvtasfa2tru o;u4texoiocild m2uau s;u)altrxr3tydopD aivo;( s2uoirpnu4lpe mnvtat  Dtau ooo0aetoioeiatfa2elumo u0trtnio iatlmteaies;s0 2toirpny4lle  fci (faDtmx pot4apenmocildfaDumu p t)alermr3totfaD  nvs;()t2trio3oy4ol e nvtls)srtr(r ;o1ale iociysfmDran p (4alxnxfcoytfmtran i;t s2umxm io4lp emnesasf rum( pot4teeomieild m2ua( p u) ltnifcta1laDrlu olt  rum(mpiodol nlieta(faDuru o;t0olxomi3iysfaDel(mon(0altrmrcoa1fp rluvo;t0teurxo3oo1lp nmnes ( srtrx  ;t4tpxnii3iad a ulumpn()tleoxo3tatomt  i s;s)s2uoim3no1lme lneta(f 2uax oou0aptoifeiysla um(mp;u4areomr3todoa r nvol(0tetm(r3iudolte ivtasf rrrurono4aetomietlt a2ulnvp t4tlxoxr iotfm  ln ilt)teuo(m iudlptnmfeias  Dumx  oo0alxo ocias a rmn pn() etrxoctydfmDe ivolt)trxm(m nu1lm   netltfaDtr( pnu1tltn feiltfs elnvs ()artrmo oy1opteaiesl()s2xmir io4ll   nei sfsDrrxroou4alxnio3tatfa rm( p;() rtnxr tydlptrlnes;s0tetrir3nydop emfesa( a2tr(mpno1tpt  f3iys m2elnmonu0 exnmocoy1late ivsl(0 2urir oydlltemfesl(farurumpot4oexo fetyt aDrm( s;()arxnif iy1om eli o t teuoxo3oydlp e feilsfsrum(r nt1oeeniicilt m uauvpnt4trtrxfcoo1opteanvol()setmxo3iudam elivtat)s2tr( poo0tltn i3tatlaDea(vo u4arenifcootfm elneo t0sexmxo3iudlleelfvi tf rraxm ;o0opeoii3ils aDrln snu4tetomf oa1la  aueo s0 euriopny1altelnei s aDtmxmonu4oee mieiyd s2rmu pnu0aeeoxo iotlmDrln i;()s2to(o3no4lp   fetls  rtrum no4tex  ietasfm elu s ()tetoxf3iatfpDrai i;s0 exr(m ou1am nmfctls)aDtmu o;t4tpt iociltfsDean o;t) eeomf3oytomtr nvo t0t2xrir iu4lmee nvi ( sDtr(  ;o1oltomfetas a2em(ms t4 etomf totlmD anes;(  rxrxmpoo4alt mfetas srraxrooo1oleomi3tydlm umu s ()tltnxf3oodlaD ai i t0t2tm(m3nu4ap emfvt s)a2uaxroot1tetnmo3iatfa em(vp;u)aeeomf3ty1fp rlu sl( sruoxo iydap   fcs sf 2uaxm ;o1tee  ieildfa emums u0tetnio3oa1fpD aiei ()trtr(mpoo1op nmfeslt  rtmxmpou0tpx iieilslsDrmnmpnt) rtnxo3oadlmDr uvs;()t2urir3ou1ol  mnvta(fs2taumont0alen o3tys s2umu p;(4altnir3todop r uvsl() rxmxrpnydaltelnesat) rtmumpou0tpxo ieiytlsDul( o;t0arxrxr3oytfp rlu s;()s2xmxr iy4lptn fctasfaDrauro;u0oltoio3iltfa ra( s (0altoxo iydfm  luvi;t0t2um(m iu1olee fcs ()a2umxmpot4aet ioetytlaDel( o;()artrio iotop eau i s)s2uo(o io1lptelfvsat) 2trumpno4ole  ociys m ua(vs t4 rtoxo3oadfmD  i s s0 rurxr ny1op  lncta()s2taxr no1aexomoeils mDrm( p (4altoirciodla eauvsls)tetr(o nudamtnmfetlsf Dur(ro;t1aleo i3iltlm2uanmo;t0 rtrio io1op r uvo s)t2umio oo4al e nvt () 2rmx p;o0oetnioeilt a ulnmp t)arerio iatfm rau o () 2tmim oydal n nvta( arurumpou0oleomf3iasfa2ulnvpnt4tltrxocoa1lpDrluesl()srtmxmpno4ll n ivslt sDraxmooo0oetn oetatla2ua(vs;t4 eenmo3tadoaDrau s;( texmxrpiudlmee iviltf rtrxm oo1alto octyd a2umnms;(0 rxrxo3oo1oaD  ivo s)trtmxm oy1amen fvtltf rrm(rono0alxn ociydlm eln pnt)aetnxo3totlp elneilt)teuoxr io4lmeemfvsltf Dumu  nt1tpxnifetatls2elums;t0artomoctodoa  auei;s)seumxmpiu1am  lietat srurxmpot1ole  iciytfs ua(mpnt0treomr3iotfmDe nvi t0texo(r nu4ame lnes ( aDtmxm ;t4aeenmoctlslmDuanmo u4trxnifctadlat auvslt)s2umxrpoy4omte fcil(faDtmum oo4aeeomo3iltfaDemnmont)tlxrmf iydlp rai olt0 etrim iy1lp emfctls sruau  ;t0aee  f3tytfm emnvp;t0aetoxrctotfptelivo s  rxmiopiu1apen ivsat a2tm(m nu0optnioeils sDrauvp;u4aleomf3oa1fp e ies;(0srxrirpoy4ll e ietl(fsrtmx  oo1tlxo ietyt sDua(vs (0aeermrctotlmt  ivolt0t2trxm oydape lnctl(fsDtmx pot1tpe mfcilt aDum(vpnu0alxnxr tadopD lueslt)srtmim3oy4ll  mivtl() 2ra(  ;u4ape mociat s2rlu p;u) eeomo3oodfpt ai i s) etrxo3nu4ll  lfviat) Dtm( pno1oexnmieiytls2rau s;u4trerxf oatfmteln s;(0truoimpiu1alt  ivsl( s2taxr ;u4apen i3iyd a2um(ms;(4arxomf3iodlpt aiei s) eur(o iu1ape liet tfarrmu  no0tpxn ieiad s rmn pn(4arxrmr3oodfp r ivo ()srtm(m ou1altn nvils)aDta(m ou1alxnmo3tadfmDea( snu4aexrmrcoytlaD  i ols0 rumxrpnu4al nlfvsatfartaxro;t0tptoif3iyd m2rluvs;t) ltnxo3ia1lmDeli o ( s2xo(m3nydo
\ No newline at end of file
@@ -0,0 +1 @@
+uvi (0srtrir io1lm elneslt) 2rmx  oo1oetnmictldlsDua( sn(4 rxnir tydlmtrlueils)srto(rpoy1amtnlieilsfsDrru ono1openioeiysls2rl( p;(4tlxnmrciotfp rlu olt) rxmir3iu4lltnmictlt) 2rax  ou0aetnifctld aDem( p;(4alxnmrciytomD  u ilt sexr(rpnodame lfcta(  Dururo;o0oleoioeiytlsDeaumonu)trtrxfcoa1fmteaieo ()srurxopiy1ap emfvtas)a2rm(  ot4tpenmoeiytlaDrm( on(0tlxoxo iy1lmt  ueols  exoim3iydomt mfcsasf rum(mpnt4tptomfciad mDrmuvsn(0aeenio tytoatr uvs t)s2xo(r3no1ale  fci t aDuru onu1apto oeias s2ul(mo;t0 rxoir3tytlmt  nvo t t2to(o3oo4lp nlncilt)arta(mpot4tpeomiciltfaDrl(ms;u)tlermfcoa1la rln sl(0s2xr(o3no4amte fvtas) 2ta( p;t4aee ii3tyt s2uln p;(4arenif3oa1fat  n il(0srumxm ou4ol  micsat)a2rmxmonu1opeoiiciyslm2ua(mpn()tltoxf3iodfmte nes;s0srum(r ny4alen icslsfarrr(m ;o0aetniiciyd s2eanmonu4 eeomf3tytlaD luvi;s0trxrxm oy4amtnmicils)aDtaumonu1teto o3iysfa el( s;u4aetrmf oo1lmD ln o;s0s2umio3nu1lmenmnvta(fa2taumo;t1alx mfcils aDemu p t) eenir oytfat lueols)t2tr(m3oodale micsatf rrm(  nt0aetoiociatls emuvo u4arxnmr3ia1om e uvsls)sexmim ou4op e icsa(  2trxmo;t0tetn feild s umu p;t4tlermocia1lp elnes;t sruoim ou4amte nvsl( srta(r nt4ale mieilsfsDrauvs;(4alxnxfcio1fa  an sl( tetm(rpnu1al emicsl(fs2ta(  no0oetomicias s el(mp;u0trxomr3oadfatrlneols)tetoxmpio1amee ict s aDrm( o;u4opt  i3tytla em(vo t4aleoxr3oytfa e ues;s seurim oo4lmt  ivsat)aDurxr ot4opx iiciatfmDumn o t0 reoif todfaDr nvol(0setriopno1llenlfciatfaDua(r ot4aexo oeiltfm emnmonu) renmf3totlaDr neil( texr(m nodom   fctatf Dra( pno4apxo o3tltfsDrm(vsnu) eenmo tadoaDelneol(  rurirpoy1apeemivilt)srrmum no0aetn i3tytla2ul( snt)texrmo3oydfatr ivs (0tetmiopno4lp nmieiasf Dua(  nt1aptomieiatlm rmn s (4areoiociy1lp ran i;()trto(m3no1lm nmnvsa()srurum ;t4tex ii3tatfa ul( o;u4 etnmr3tydfmD ai slt s2ur(r3oydolt lies () Dtm(ro;u4teto fetasls2umumsnt4 rtoxr io1fmDeaivi (  rtriopoo4om e feil()srraxro;t1aptniiciysfm emnvp;u)aeenxocoadlp  an s;( t2xoxrpno1lmeelfet s)arua(  oo1tptomfeiyt m elnvo u)alenxo iatfatelneo () etmxo3nydamen nci ( aDrmx p;o1olen ieils mDum(mo;u0 rxoxf iotom eaivi s0 2uo(opio4ll   fct () Dtrx o;o4texomfcils sDulnvs;(0 renmr iatlaDe i ils0trum(r nydlmtelieta( a2tmumpou0apt if3tasfm2rlu ont) ltoio oatopDrauvi;s0srxmxmpiu1omee fesa(farraur oo4teenii3iydls2eau p t)artrmo ta1la elieo s0srum(m3iu4apenlfctlt srraum ;o1oeenii3iltlsDuaumo;t)tetoxo3oatoaD lueo;s trtm(m iy1lm   ict t)artr(r ot1opt moeiatfs2emnmo;t)alerir iy1oatran ols)setrxmpoy1olenlivsat a2ra(m nt4aexnmoetydlm2elnvsn(0altrmf oydlpDrlu il()setm(mpoy1lmte ncs s)sDumum nt4texomoeiat m uanvo u4aleomr oy1oaDrliei t)t2uo(m nu4altnmnei ( aDtrumooo1tet mfciltfm ra( pnu0aeenif iotfmDelieilt0trxm(m3iodolenlnvi t)s2urxr ou4teenioeiytfa eanvo;()tltrmo io1lpDrluvs ()tetmxr ou4al nmfei t  2um(m ;o4tltoifetyt s ea(mp u4 renirctotlp r neo s0srtmim3io1altn ncsat a2umu p;o4tptniocils m rauvp u) exoxf oatopDeaivi ( srxmimpnu4opeelfviat) 2rruroot0tptniietysfm2uanvpnu4aetoxf io1fmDeai ol() eum(mpno1amtnlfetatf Drr(m ;t4aetniietat s ua(msnt4texnif tadfmDran o;s)trxrxrpoy1apee iesas)sDumx o;t0aexomoeiatlsDumn p;u4tlxomociotom  an sl( trtmio ny1amen ies t arur(rpnt1tlxo icilsla2um( p t) ltrmr iadlmD li il(  etoimpnydlpe livilt a2rmumooo4aexnmociad s umnvp;(0teenio ty1lmDe iei (0 2tr(mpoudllenmfctasfsrtrur nu1opeo o3iydlmDum(vp u)aetnmfciy1fmt livsls)trxr(o nu4am emnvi (f 2ta(m ;u1oeto iciltls ea(mp;u)trxoio tadlmtrluei ( srtoxo3oudop nmiet (  rtrx p;u1open fctydls ua( s (4artoxfcia1oa rlieo;t t2umim oudope  ivta( srum(rono4oltoifeiyd s2umn s u)trxnmf tadoat anvi () eto(rpoo4altnmfet ()a2tmu  ;u0tpxo iciat m rluvpnt4aexrircty1omt aueols0seumxo3iydole  ieilsfarra(r no4aex ii3tytfaDumumo u0alxrif to1fpte n ils srum(m iudapeemivsa()sDra(rpnu1altn ociadls el(vs;(0trerxf3iatfmt livi;(0srumxopoo1aptelictl( a2trum no4tpt ifetysfmDum(vs;t)altrif3oadoate uei;t)texmxopiy4lmen ici sfs2urxronu0ale iictlslmDrl( on(4tleomocoo1fmDelu o (  etr(o oy4lpt  ivsat s2tax onu1alx if3iys a emn s;t4tlerxf3oodfa eluvol() 2trxopoodomeelfviat)a2urumpou1oleoiocilt mDrmuvp t4 ltoxfcoa1oa rau ol()trtr(rpio4olee fvt s  2trxmono4opx  f3tytfa eaumpnu)tetrio tatoateluvi t  rxrxm nu4lpen fcs s  2tmx pnt1texoiietld m2emnmp t) ltrmf iadfp eaivo;s0 2xo(m nodomtn icilt arrru oou0olxomieiadla2rl( sn() etnmr3tytopDran s;()teur(mpoydalt mfeta()s2tmu o;t1altniieiltfsDrm(vp t4 lxnxr oydlp  li olt) exmio nu1open nctas a2uaxrp;u0tptn icildfa rmn p u0 reoxf3iodfaD anvo ( trxmim iodol nlics ()sDtm(ronu1opxoii3iydlsDeauvon(0tlerxf ty1la elneo t  etoiopno1lp nlnvsatfartr(moou1tpt  i3ild a2eln o t4 eenio3oodfaDeauvo;( t2xmxo ou4apte fvslt) Dururooo0openmfeiadfsDulnvs t0altoxrciy1laD luvo s truoim3oy4lpt lfesa(f Dtaurpoo0oleoifciysls2eauvs (4 eerxocta1fpDeaiesls0seto(m3ou4apee ietas  Dua( pou0tet moetadfm rl( p;t)tetrmocio1oaDrlu i;(  rtmio3io1amt liviatf Dtr(rooo4teto fcildla uan o;u0arxnxr ia1fpD anvs t s2um(o io1aptelfvsl(f 2umu p;u0olx mfciyslm rmnvo;u0 lermf ootom r ies;s0srtoxo iodopt  feta( arua(m ;u1oex if3tys s2rl( p;(0 exnio3iadfa   uvol()teuo(o nudap  lnvi sfsDrr(mpnt0tpxoif3iyd m2rauvo u4 lenxfcoadfmDrlneo t0 2uoxm oudapeelfcsatfa2rau pnt1texomociaslmDumnmo u4 rxnmf3tydlp e nvi t0t2umiopoo1al  mfvilsfarum(rono4alto f3iysfs rmu o;u4 rxrmr3iy1lmD lneo;s) 2umirpio1lm e fcta(fa2trxr no1altoiiciad sDranmp (4aetnmo io1op rlivs;s0s2xoxmpiy4al nlncsasf 2taurpno4alxoioctltfsDem( p u4tleoiocoa1lm ranes;t)s2urio ou1ap  lfvia( artm(mo;o1opx mi3iasfm2rm(mont4tetnircio1oa eanvs;t)tetr(m3nudlmee fvilt)sDurxr oo4ope mociasfaDuanmp;u4trtrif tydoatrau i (0s2uoio3oy1ol nmfeils) 2uaumpnu4tee mfeilt a ul(von()altomo ia1faDraivslt)setrxm3nodlmenlnvt sfarraxm no1aptnioctytlsDemn o t4 rtrio3oy1lm rai olt0 exriopio4lmtemnci t  Dumxmont4opx  fetasls um(msn(0altoiociotop eau s t0s2xrimpnu4lmte ncta( aDtrxr ;t4ope ioctltls2el( o u0 exomo3oa1opDeauvilt  rurxopiy1olen fvsls aruaxrpot1tltnioctas mDemu s (4alxomociytlp raueo t trtmio3io1ole  icsatfartr(  nu4tlt mf3iydfa eau on()tlenxo3tatom e ivi () rtm(mpoo4al e ivtlt s2trxmpoo1tex moetytfs rl(vsn(0 eeoiociytfpt lnes s)seurxmpio1al elfcsl() Duax o;t1aptn f3iydla2emums;u)alerif3tytfpteai ols  rxr(o3ou1ope lfesl(fsrrrx p;t4tet  fetyslm2uau pn(4 etrifcto1la raivsls0s2xmio io4oltemnvs s  2uaxmp;u4teto o3tytla2ra(vpn()altrir iotlpDeaivi s  2trxo no4om  mncilsfaDuaur ;t1ope if3iatfaDemnvo;t) lxrif ia1lmt an i;t0teurim ou1alenlivi ()a2raum ;o1oltnmieiadlm2ean o;t)aeermo oo1lmD  u o s)trtr(opno4omee fcil()s2tmu  ou0ale  ieiadfs elumont) renmr oy1oaDeauvo;s0trtrxr3iy1ale  ietat  rtrxro;o1aptn o3ils sDeanvo t4aeerir oatfmtrln i;( trumxo3ny4amtnmneta()sDrru pot0tex iocildlaDrmnmp (0tetomrctatlm  luvi (0 2xr(o ou1lptemiet t)aDrax oot0tpto f3ildfm2rauvp (0 rxnir3oytlpDr ivo t) 2trxopoydomtnmivtlt s2rmxmoot1tee  f3iydfs rlumsnt4trerxf iy1opt luvslt0 rum(r iudoptnmfcs sfsrtm(rpoo4aptn f3iytlm rl(vs u4trtrioctotfmtr ies;t0 rxmxrpoo1ol e neias  ruaxmono4tpx ifeildfm2elump;t)texrxrctydlpDeau sl() euoim iu1lmenmfcs t sDtr(moou0tlxn o3iasfs2rmump;t4teenif iodla r ues (0trur(rpiy1aptnmnctlt) 2ua(rp;t0ale iictldlm rln s;(0aetomfcoatfpDrlu s;() rxmxopnudam nmici ()sDrau o;t0tpxnio3tys aDeauvpn(4tlenif3iytfaD lieilt0 etmxo nu1lleemics ()artrur nu4tle if3ilsla2umuvp t4tlerif oa1fm elieilt)texo(o nu1ope lnvias) rtmxm ;o1tetnifcild mDeanms;u) lxrxr3todfp   ies t0srtoxr no4olenmnesl(  rur(mpnt1oet mi3ilslaDem(vp;(4 eerxo3io1faDeanvs;()trtrirpnudop e fvsasf rua(m ;o4apxoifciadfm2ea(vo;(0trxomr3iydla rauvo s srumxr3iodal emictat) Dtm(mpot1aetomfeiltfm ea(vp;t) rtnxr3tadlaDe ueo s0 rxmxrpiy1olt  ictas) rraumo;u4opt  ieiyslm uan s;t0 exnir3iydomtrli o;t0 euo(rpoy4am nlnvtlt) Drr(m ;u4aetomfciydlm2umn pnt)texnxfcta1fa   iei;s0t2tm(m3io1optn nct t sDrrumpnu0ope  ictydfa2elnms t4altnir3iytfpDe uvi s)s2uoxr ou4lm n fvs sfarrrxmo;u1tet  iciat m umu p;()tetoxr3ty1lpDe i s s0 2trxo oydaltemivslt aDumx p;u4opeoio3ildfm2el(ms u0tetoxfcoydlat lueols0tetrir oudlpt miesa(fsDumx  ;t1ole  oeiat a uluvo ()altrio3oa1fm   nei;t  rtrir nudome licslt)s2raurpno0aet mfcils m rmnvpnu0 ltomf oa1fmD  nvilt0srxrxmpou1lmtn fvilt) 2uauro;u1oetomietlslsDemums (0trtomr3oytfmDrlnvi t)trxm(r3iydlp n iviatf Dra(rpno1aleo f3tltlm rmuvp u) rxomfcoadlptraneo;s0t2uoxmpiu4om n ietat)srurxm ou4tltoifciysla eau o u4tlermoctotfate u o;()sruoio3io1ol nlictl( s2taurpnu0optoio3iydls2umu s;u4aetoxfcio1lm rluvsls) 2xrio oy1lmtelicils aDtrxr oo4tpeoiociyt m2rlnvpnu4teerioctatfmDeaivil()trxrimpno4ll  mfci t s2raumo;t1ope  o3tat a2umu o u4 rtniociadfmteluvi;t texmxo3iodome lfvs t)aDumu pno0oltn i3tyt aDua( o;(4trxoxf ta1lp elivi s)trurxo3oo4ome mneil( srtrum ;o1olen ieiasfa eauvs;(0 rtnif3iy1lpDr n i;t  eumxm ou4lleelncsa(  2ra( poo1aex  ieiys s ulnmpnu0alxrif3ia1opt lueil( srumxr nu4opee ietl()aDtr(rpnt4apenio3iltlmDrm( p;t4artrxociodopDe neols)texm(m nu4lm emfci (fsrtmxm ot1apenmociat m2rmumo t) leomrctatlat lueo s0teumxmpoo1al n nvtas  rum( pou4tltomietytls um(monu4alxnxo iytlmt lnvs;( sexo(rpio4omtelivi (  2ua(r no0texoif3ilt m2rln pn(0teenmo3oatlaD luvs;(0 exoxm3nydlpe miesl( s2rmxmp;u4tleo ocild a2ulnvonu4alerxo3ta1laD auvi;t sexo(rpiu1llen feils)s2rax poo4tltn f3iyt s2ean sn() rtrxo iytoaD luvi;s srtmxrpiu1om  mneia( a2um(rpnt0opxomfeilsfs2rmnvp u)aexnxrctotlmDrlnvsl(  eur(o iudape mneias)a2tauroou0aexomoeiydfs emums;()arxoxf3oatoateau ilt)sexrim nydlmtemfctltfsrraxronu4aptn i3iad a el( o (4altoxr oytfate ivs s)trumxm oo1ale lfetat arur(mp;o0tetoioetltfs2raumon(0altrxfciadfa e ues s  exo(m oudam   ivt () rtmum ot4aleo f3tat m2ranvs t) rtoxrctatlp   uvs t)setrxm iu4lpt miesl()aDurumpot0optomfeiyd s emums;u0 exnio oy1fat aieo;(0 exrir oudope mfet ( sDra(  ;o0apxoiiciytfm rmn s u)aleoxocoodopDe nvo t trum(rpnydale  net t) 2rr( pnu4oeto ociasla umnvp ()aleoxr3oodlpD auvil()truoxo iydolee icta(faDur( oou4texn i3tld m2ra( pnu4 renio3oatoatrlivo;s)t2xm(r3io1lp  mivils aDrmumpot1oetoif3ias s um(vo t0teerxr3io1lp  li i;(  rto(o nydopeelnetas)a2urxrpou1oleo fciaslaDumumpnt)aexoxo3oa1opDeai o s t2uoxm no1om nmfcilt)a2rru  nt0alxo fctlt m2emuvo;t)teenmo3oo1fp   uvilt)s2urxopio4lleelnvt sf rta( pou0tptoiicildlsDuau on(0aleriocoa1lat aiesls0truoio3oo1ale mnet t s2uaxrpou4tpto ieilt s2rmuvon(0artnxo oatfpD livi;(0trurirpio4omtemnesas) rrmum nt4apxniietatfs2elnvsnt4 rtnxr3to1lmDeln o s0 2xmirpiu4ape lfeilsf rrm( p;u0aexn ociytlaDeauvont)altrmf to1op r nvs;s)s2urio3io1omte fetatfs2urumpou1tlxniictas a2em( o t4texnxocoatfaDe u olt srxoxmpio1ome lfeilsfsrtmurpnu0tltnmieiadlaDrm(mon(4tlxnmf3ty1lmD lu o () 2urxopnydoltemiviat)aDrmxm ;t4olx mieiadfa rlu o;(4 ltrxfcio1fp  lnes s)teuoir3iy4lmt mivslt)s2trxrp;u0alxo ociadfm2el( s;(0trerxrctotom  li i s  2xrxm3nu1lptnlneils  Drrurpoo0teeoii3iytla2el(ms;u)arxrio3ia1fmtr ies t t2umxo nydap  mncs s  rraxr ot1apeo octadfm uln s () rtnxoctydfm elies (  rtr(m3oudom elfeilt  2um(rpoo1tpxo o3tldls em(vs;(0 lenxf3ootoatean o;(  exoirpiy1om   ivi s)sDtm(mooo0tlxomicilt mDel(msnu4altrxo3tadopDeli il()srxoxr oo4ale  ivs t s2rmu p;o4ale  fcilt a ra( onu0aeermr ia1oatr u s;() 2xoirpio4al nmfciat s2ur( pno1openioetatlmDrlu pnt0 renmo tydfatean o s)s2xoirpno4ome  fvs tfaDrmu pnu0oexoiictydfs2em(mp;t0altoifciytfptr uvi;s)teurirpiy4lp  lneiat)a2tm(rono0alen octysfm2ea(ms;u0artnmo oadom r ies;t trto(rpno4lp n netls)s2rmx ont0optnifeild a eluvp;t) renirciatom r ieo s0texrirpiu4ol n ics (fsDum(mp;u0tltnioctltfa2emnmp;u4 etomf oa1oat livi s) 2xm(opiydopt mnesat arrm(r ;u4apxomo3tatfa umuvp;u0tlxomr3oydoaDr uesl( s2tmio ou4om  micias  2rm(r ou4opt mieilsfsDemu o;t0aexoifcta1lmD ln sls t2to(o iy1olenlics s  2rm(monu4optoiietydfaDumnms (0altnircio1faDe ies;( srtr(mpiy4omen fci tfsrurx  ou1aex mfeiys m rm(mpnt0 lxoiocoytfmDrau s (0texo(o3iodam emnvsas srrrx p;u4optniieilsfmDrlu onu)aeeomr3oo1omDrlnvslt) euoio3io4altn fvils) 2rrxmpoo1teenmfciad s el(vsnu0alxnifciytop r i o t)texoxopiydolen nes ()srtru poo0teeomo3ildla uauvpn()aexrxo tydfmDrlu o;( trxo(r3io4ol   fvias a2um(r ot4olxoii3tls s2raump u) rxrif iotlmDraivolt)t2toxo3io1al elfei t  rtm(mooo1aetnioeilsfs ulums t0tltnif iytoaDr iei t0 rum(opoudlmtnmfvsl()aDum(r oo1apeoiocildla rmn s u) renxr3iytlat  i o t) rxoxm3oy1ap  lnesatf rrmuro;u4oetn ieiltfsDeauvonu4aetomr oydfa  liesls0seumxo oodolee nvtas s2rr(m nt0apx mociadfa rmn p;t0arerirctytfmtrluesls  exoxopou1ol   nctas  Drrxmoot1opto fctysla2umnvp;()trxoifcoodfpteaivs s0 rxmxo oo1ale  fetasf Dtrumo;o0tpe ioeils a2rmnvp (4tetnxrciy1fp   iei s)s2toim3nu1oltn nesasf rrmx oot4oee moeiyt mDea(ms;t)aexnircoo1lp  ai i;s) eto(opnudapen iei (f rrrxm ;t0tex mi3iatfsDrmumsnt0alxoxr iydomDran o t  rurxm oudom   net t) 2um( pno4oee ifciasla eaumo;t0 rerxf oa1fm ranvo;() 2xr(r3oy1al  lncs (fsDrrxrono1open o3ilsfs rmnms;t0alerxo3iatfpteanes (  rtmio3iodal elivsat  rrrxmoou0tlxnmf3iadlmDrmu p;(4aexrxrctytfate ueol()srurxo3io4lmenmnci sfaDur(m ;u1oetoio3tadla2rm(vo;u0 eenmfctatlpt  neilt0sexoimpoydlptn ieiat)aDtau p;t1oex miciytla2uau p () rtrxfciytomDelueolt0 rumxmpnudop n nvtl()aDua(monu4aleo f3iadfm2rmu p;u0 lerir tatom eli s t)tetmim nydop e netat)srur( onu0optn oetlslm em(vo;t) ltrio totom rlnvs;()seuoir no4llt lnvi s) Dra(mpot0ope  fciaslsDelu p (4 lenir oatoaDraivs;()srurio3oo1lleemfvi s)a2uax onu1texo fetldlm2ua( p (0 eermo to1laD  u o t s2xoxmpiu4ome lietl(f rrm(  ;o1ape mo3tydfm2uluvp t)aetnifciotomDeanes;(  2xmim3iu4lp   fvias aruax p;o0altnifciytlm rln s;(0artnxf3oodlmt  n o s)s2to(opoy1ape mieta()a2urum no4apt ii3ils m rluvont)tetoif3to1oate n s;(0trtr(opnudlp nlict t arrmxmpou4aee  oetat aDranmp ()tlenir3tydomte uvo;(  rto(r no4ll  lfvt tfsrrr(ro;u4aex ifeiad s2ra(vo;u) lxnir oatla rlueo s0 2xo(o oo4ame mfvil( aDrau oou0aet  ictlsfa ua(ms;(4treoxrciadom  ai sl(0texm(mpiodopeelnvtlt srumxm ou0tpenmf3tyt sDeau onu4aetoxr to1fpD aivi;( t2tmir iu4al   ies t arta(m nu0aeeo o3iasls rm(mpnu)artoiocoy1fp r n il( t2xmxr oudolen fvtlt)sDrmxmpno0tle iicild m uaumo;t0artnmr to1omDeanvs t0sruo(m oydam nlfvtas) 2tr(rp;t4tpxniietyslmDuanvs;u4 lxrxr3todfmDelneo;t  rtm(m3iydom nlnesasf rrau ono0oetn fcilslm em(mp;t)trxnioctytlpDeau o () 2tmim3nu4am e ivi tfarra(rpou0apxoiicilt sDulnmo (0 etnxfciatfm rluei (0srxriopoodlpen iesat)sDraxm no0tpxoif3tyt aDumn snu0tlxrir3iy1omt  ueo t0 2xoxopnu4altnmieils)sDuru poo1tle ioeiasfaDrlnmon()tltrxf oy1op rauei s) 2urxmpny1ope lfcsasfsDrmx pou0tpx iociaslmDemnvs;u)texomrcoy1fatraieslt0seumxm3io1omt livt (fsDuaurpnt4aex  ociltfa eluvsnt0 ltoxocootfa e uvilt) rtrxrpou1ap n nesa() 2ururp;o1tpxoifctltfa ea(vpn(0trtoxr oodop elu slt teurir oodamtemnei t)srtax p;o4olto o3tyd sDua( o (0trerir ty1lpDe u s t  ruoxo3iu4ol  mnci t s2rrumo;t4tet  ociysfmDuluvs;u)trxoxo ia1om eluvs;()trurxo3iu4ol e fcil( arrau ont4alx  ietadlmDeanvonu0 ltnio iydfm raueslt  eumxr3io1lptnmnetl()srumur ou1olxnioctyt a2ulump;t4 ltoio3tadfaDrliei;s0 2uoirpio1ol nmnvt tfa2ra(mo;t4aexnmoeiatfaDrlu p;u0texnxocoydoa rlneolt)s2urio iydope  iet t) Drmump;o0opxnifetlslsDulnvs;(4tlxomo3totfmDr uvol( tetoio iu1al nlietltfs2ur(  nt4alxomietlslaDran o u0altrircto1oa  lneo;t0 2uoio oudlptnmnetas)s2trurp;u4tpt mfeilsfa ean o t4trtnxr3tytoateau s (0t2umxopno1op  licsatf Drru pnu0alen fetadfm2el(vp u)tlxnxo3oydfpteau olt)t2tmio iu1ll elnesltf 2uaur ot4olx ioctlslm2rmu p t)tlxomo3todfaDr i i t)srxr(rpno1apenmfet () Drr(r ;o4oeenmoeiatfm2umnmpnu4 lxrmociotfaDr uvs ( srtmirpiu1ome mnvia(fs2uru pnu0tlxo i3tat aDraump u4alxrio3ty1lm r i i s0tetoim3ny1lpe  fet s  2tau p;u4optomfctad aDrmn p;t0artoio3oy1optelues;t)t2tmim iy4lltn iesas)srur(m ;u0alto o3ildfm rm( pnu)teerio3iatomDrluvo (  etoxmpiydam e ivsl()sDraump;u1aetomf3iatfs2um( p u)alerir tadopt  n i () etm(opno4oltemicilt  2rmxrp;u0tptn feiys s2rmnvsnu4 exnmrcto1om   ieolt)s2trxo3ny4ap  livi t arrrxrpot1apx mi3tadlaDemnvpnu)trxrmfcoo1fm r nvilt0teuoirpno1amte fet t  rtmx  ot4apxomoeiasfa2rm(mpnu0tltoxo oodfpt  i slt
\ No newline at end of file
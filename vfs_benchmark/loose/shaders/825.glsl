@@ -0,0 +1 @@
+ies s srto(o3iydop e icta( s2taur ou4ale moetyd mDel(vo;(0 lxomo3ta1fmD au sls)t2to(rpio1openmfvs tf rtru o;t0ape mfciydls2rl( s u)altrxo tytfmD anvi t0trumim ny4olte fetlt  2um(  ;o4tetn i3tatfm2rau o;()arxrmr3ootlp eli il(0 euo(o ou1lme lnesas aDrm( oot4alxnmi3iltfs rlnvsnt)tltnxo3tydlaDe u s ()s2urir3ou1ame livils artr(  nt1oet  octydfs2eauvsnt4arxrxr iytfptrlnvi (  etrxm3oodopenmfet s  rrau oot4tetnii3iatls uau p t) ltomf3to1fmtrlueo;t) 2umio iu4olee nvi s s2rau o;o4apeoiictldfmDrm(mo;()tltnif io1lat lnvo;s s2xoimpny1ameelfeils artrumpot4tet mi3iadfs ua(vsnu0 ltrmocta1omt  uei;( srumxr3oodamte icsat)s2ta(mpot1tltomf3tldls el( s;()texomo3tadlp  lues ( teumxopoy4op elnvi t)sDra( ooo4aptoifetasfaDrl( pnt4 rtrif3to1lmtelueo (0 rtm(o oo4apenlfct s sDua(mp;o1aptomo3ildls el( s;t)altrir3iy1fptrau i;s0 rxmxo no1amt  fci ( srrm(r ot4apeoifctlsfsDemnvp t)tlerxrctatoat lues;t0t2trxm3oo1om   ivt t  Dtm( onu0tpto feiydlm rlumonu)artoxf3oo1fpt aieilt  rxo(o3iydomt lnes s artmxm no0olen fciytfm2ua( o;t4arenmf iotlp   ivi t)t2toir oydamenlnesas)arraxmonu4tlxn ictldfa2elu p u0aexoif3ta1lptelneo;t)srtrxmpoo4ameemnvtltfaDtaxmonu0apto ietas m elump u0 lxoircio1fp eau ol()s2xm(o oy1opt mnctl( a2ua(m ;t0olt ifciytfa umnvo;(0tlenmfcty1fpDeai o;t s2toxm oo1lp  mivsl()sDtrurpou1aee  ociatfs ua(vo;t4 rtoir iy1fmtelivol() 2xo(o3nudal  lncs s  rrrum ;o1texo oeiaslaDrl(vo t0 etnxr3iotlp eln sl(  2tm(r oydop  lfvi tfsrumum ;u1ope iieiat sDel(vsnt)altrio3oadoa raieo;t0 eur(m nu1ol n fcsatfsrumu o;u1apenioeilt sDel(mp () ltnifctydfpDeaneilt0t2trimpoy4apeelici t  Dur(rp;o1aet ioetat sDumuvp t) exrir iy1oateln i (0t2umim3oo1opte iciltf rurx pot4tle  fciltla2ean s t)arenxf3totfmD lnvi s srumirpoo4lltnlicta() Drau oou0optn o3iasla eauvs (4altrif3totlp   i sl(0s2uoxo3ny1opt mfes ()sDumx oot0alxniocilt m2ulnmsnt) reoir3tytoa  an s t sexoxr io4lp e feil( s2tm(m nt4apto o3iytfm2ea(vs;u4 lxomo3iodfpDraiesls0 rumxo3ou4lm nlfvtl( s2ta(  ;o4tlx iieiatfsDem( snu4areomf tadfmDe ivo s0truoxm3oo4omtnmfctat)a2rrxmono1teeo fetasla2um(mo;u4 rtrxrciodfaDe nes ( teuoio3iy4optelfes sfsrtr(  ot4olx io3tytfa2umnmp;t4treoxf iy1fm r u ol(0srum(mpno4amtelietl() Drm(mpnu0apeoifeildfa el(ms u)tetrxr3iytlm e i i s0teuo(r3no4lle mfci s)s2rr( oot1oexnmfctltlm2rlnmo;t4artnxo3iadomte u i t)tetoxm3oo4ol  lnct s sDtmx ooo1tpe  iciyd s2emnvpn(4arermo oytlaD ai i s) rtmxm3nydopeemfciat)srtaum ou4aptn fctltfm rmuvo;(0 ltnio3oy1lmtrln ils srumxm3nu1op e nvias s2tau  no0apxnmf3taslsDra(vs;t4 lxnir3iotopt  n olt)s2xoimpoo1ll  mfcil(f 2ra(mo;u4apxomi3iytfs umu snt0tltrio totfmDelivs t) exo(m3iy4om nlfeta(f Dumu  no1olx  fcild m rln sn(0trxnif3iadlm r ieil(0 etr(m3oo4omtnlfctatfsDrau p;o1tlxomociytfsDemnmo;(0 lenxr3oytop rlneilt  ruo(r oydlmteliet tfarrrx onu1olenii3tyt sDel( o ()tetrxo3iadlpDrau o s0trtrxr oudop nmfetlsfa2uau pot0tpeniicilsla2uau p u) rerxr iotfpDeauvsls sruoxm iudlm   nvs (  rua(r nu0olx mfctydfs el(mo;t0 lermr3iadlatr ieo s t2um(r oo4lltemfct ( aDtrxmoou4oetoii3ilt sDem(vs u0aexomo3oa1fmD an ils)s2xm(m3iudoptn ivs s)sDrru o;o0ope  oetatlaDeauvsnt)aetrif ta1omD au i;t seurxo nydlmtnlfvt t  rra( pot4texn ieiadfa rlnmsn()areoifctatoa eai o s)t2xrir nudam  miciasf rtrum oo1aeeomfciasla ua(ms;u)tleoxr3to1omDr ivo (0 2xm(o3ny1ol elfvt ( sDur(ronu1aeenmf3tasfs2umu on() lxrio3totlaDeliei;t texr(o3ny1lpeemfvt ()aDrmxmp;u0altomoeiyslmDrmnmo (4 rxrxo todfp   n s;(0s2tmxrpnudapte ncilt) Drrxmp;u1olto feiasfa2em( on(4tlxnxf3ootlp eaneols trtrxr oy4lpt  fetl(  2tr( pnu1oleomoeild a2ulumo;()tlxrxfcoydomDr n i;t sexr(opoo1ll e ncsl(fsDrr(rpoo1alt  ieiat sDuauvpnt) rtrmf io1lp raiesl(0srtmxr io1oltn ies s s2tru  ;t1aleomicils s2ul(mpnu4tltnif to1oa rlnes;(  exm(o3iydlmtnlfes ()sDtm(root4aptnifcilsla eau s (4 lxnirctytlmtr i sls0 2trxo nydopeemfvtat  rtrumo;u0alenmfciyd m uln o;(0alxnmf3to1lp   ivo t0 2uo(m ou4op emncs s) Drmur nt1alxoif3ils s em(vo t)altnxo3oodfpt au i;(0srxmxm oydllee nct ()s2rrx pnu0olx miciad aDrl(mp u4 lxnif3oy1la eliesls) 2xoir3oo1lptnlncs tf 2rrur oo0tle mo3iaslsDem(vsnt4teenircoo1lm rlnvi;t trtrir oudolt mfvil(faDua(  ;o4oex ioctatfm2elumo;t0 exrxrcoadfmt aueo;s  2toim oodlmt  fvta(f rrrxm ;u1teeoio3ilsfa uauvo;u4 lerir iadom  livolt0seuo(m iu1lmeelics t)s2rm(r nu0oleoifciys s um( o t0tetnmo tadlmDeanei s)s2uoxopno4aptn nctlt s2tm( oot0ape mietas aDum(mont0 lxrir3oytfatr nvi;s)t2urxr iu4lpenliet t) rtau o;t1olx  f3iat aDra(vo u0tltrxr oydomteln ol(0setrxrpnu1llen ieilt aDtmxmp;t1tleo i3ilsls eanmp (4 lerif3oadoa elu ils0 rurxrpou1lp emncsltfsDtr(rp;o1aeenioeild s2rmnmsnu)tltnmo oa1faDe ivi;t)t2um(o iodomte ieils srumu ooo4tpxoioeias aDeaumont4trerxrcta1op rlnesl()trtmxr oo4omeemnetas  Drrxronu0tee  ieiyslm2raump u4trxnio tatoaDean slt)s2to(m ny4op n icta() Dta( o;o0tlxoioctltls rauvpn(4treoiocoa1fa r iei t0sexr(o3io4op  mfesas)aDraxmoou4tltomi3iatla emumsnu4tlerxo oy1om r i s s s2trir3oo1op  mnvt s)s2raxroou4oleomociad aDrm(mp ()alermrciotomtraneo s t2ur(o3io1omt mnet t)sruau  ;u0olxo ieiatla2uan snt) rtnmf iatomDr ueols)setrxm3oydlmt  nesa(  rra(rono1tetnmoeiyd m2eau s;(0 rtnmr tydfatranes;s0trtm(m iu1aptelnesl(f ruru oou4oeto feils s2umumsnu4 rxnioctodopt lnvo s  2tmxrpnydllee nctls srururoou1tlt  ociydfa emn o (0teeomo to1lmte ivil(0trur(m oy4apenmfcs sfsrtr(rp;o4opxn iciyt s2rluvpnu0 reniocoytomt li s;s0 rxmxopiy4lmt mfcslsf Dur(mont0oet  ietldfa2rln snt) reomr oydfmt  ues s0srumxm nudllen nes sfa2rr(  nt4olt  icilsls2ea(vo u)tlxnxo3iydoaDeaiei;(0trxr(o nu4amee iesls)srurxr oo4oexnmi3iydfm2el( s;t) eerxfcto1lmDeauvs;s0sexrxopoy4aptemncsat) 2um(mo;o4alt mictyslm emuvon()trxoxr iy1op rlues t0sexo(rpoo4ope lncsl()sDrm(m ;t4aee ioeiytlm rauvs;u0 ltrmfcoytomt  uvi;t0s2xmirpiydamtemnet tfarurump;t1alxoiieiadls uaumont4aetnxf3oadfm  lnvi s)tetm(o3iy1amt mieslsfsrta(mont4tltn ietldls eln p u4 etnxoctotlp elieslt texoiopiu4lmtelneil(fsDum(ront1aet mo3iltfm um(vp t4arxrio iadlaDelues;( tetm(o iu4llt  iviat sDrax  no4apt ioetld s2el(vp u0tetnxfciy1opDe nvols trtoxr3oo1optemncil() rtaxm ot4tptomiciysfaDelnms (4tlxoif3tatop rai i t)trtoirpiu1oltemncils a2tm( pot0alt mi3ias sDeanms t)texnir3todopDeaueo s0s2toxo iudlmt lict s)s2ua( p;t1tlx iietydfm rm(vont4artoxfcto1fm r ieslt)trumiopny1alt  nvs s)a2rruro;o0alxnmictlsfa eau s u) rxnif oy1lpD lneo (  2tm(r3nodam nlnciltfaDrau o;u4oltomietldfsDulnvo t0 lxomo tatfpt  ieol( trumxopoo4lpenmict s  2rr( oot0oetoioeiadla2ulumo t4 lxoiociadoaDeauvs s) rtrxmpny4al nlfei ( s2ur(ro;o4aeen f3tat s2uau p t0trxomf iytfatr n i;s)s2toio iy4lptelnetas) rur( pot4openmiciatfa2rl( sn() eerxf iytlp eauesls)s2xoxopno4ap  lnctlt a2urxmo;u4apxomoetyslaDelnvonu)arerirciadlmt ai il() 2um(r iu1opeelnctls s2raum ou0texoif3tatfs2ra( sn() rxrif3oodop r i ols)s2urxopiu4ol  lfctl()a2urump;t4tee mfeiytfa ulu o t) rtnxf iadomtran ol(  ruoxopoy1omte ieta(faDurx  ot0oet miciat sDua(ms (4arxnxr3oatfpte n o;( s2um(r3oydop n fvtl( aruaump;t0aetn feiyd s2emump u0arxnio todlpDeauvo;s seur(o nudap e ncsasf rraumpnu4ape mi3iasfm2rl( ont4tetrmfciodlm   neils  rtrim oudole mncil( a2rmxm ;u4aeto fetls a2el(vsn(0 eenifcoodfa r ivi;s)t2uoxm3oo4alt mfvil() 2tauro;u0tpxo oeildfm2eaump (4 exomoctydfat aneilt tetm(m iy4al nmnes t artmx p;t4tleo fcilsfaDumnmpnt)tltoifciadfmDrlnvi;t sexrxm nydol   fei s arumu pnt4ale mf3ilsls umnmp;t) rxrmo3ootlmDr nvs s0srxrxr oo4al  lneils)artaumo;t1aetoifciltfa2rmnms;() rtrxf3oo1faD an i s0 rtoim3no4optelietltf 2rrxrpoo1alxn ociatlm2ua(mp;u0 lenxf3tadlpDrlivi (  2xm(o nu4op emnvilsf Dtmxm nt4apen i3iasla em( on(4tlerxrciydlp r n i;() 2um(mpiodoltemfcta(fs2raump;t0oeeomociatfaDumuvp t4tetnif3iydlmtr ueilt)trxoxo3iy4amtnmnciat  Dtmumpnu4alt iictysfm2um( s;t) rxrxf3oa1lateluvi t teumimpiudaptnlfvt sfarraxrp;t4oleomieias m2ua(vs;t)tltoxf oatfatr ivo ( s2trim3ou4lle mnvs tf 2raxmoou0aexnifetad mDrmn pnt0 rtnif ia1laDrlneilt0t2xmxm3iydal emncilt  rtm(r ot1tlxomiciys mDuanmont)artnir3iotop elivslt0 rxoxr iudalt  fcslsfaDta(mpoo0olt mo3iyt a2ranmo;t4tlxrxf3iatfa   neilt0 2toxr oodlpe mictltfsrta(mo;o4opx miciaslm2uanvpn(4teeomfcootomtrai s;s s2xoio3oy1lmtnlneils  2rauro;u0aeenifeiltlsDumump;u) lerxo3oo1fpteaivs ()setoxopny4aleelfesat sDtm( ont0teeomictytlaDumuvo;()aleoxr iatlat au ol(  2urirpoy4lltemieia()arrmump;u0tex iictlt s2eauvo t)aeenxo oa1lmtrln i;s0srurirpoydlltemfvsltfsrrmur nt1tee  ociydfaDean p t)aeeoxoctodom e i slt0sexmimpiy1ame  nvi (  2taxm oo4alenmo3iatfs um(mo t0altrxrcootfate iei;s  2xr(o3oo1oltelfcsa(  rrm(mo;o1altn i3tad m uauvp u) exomrcoydfptrluvol( trumxo iu1ol  lnvt t aDurxm ;u1opt  i3tad s uanmpnu4 rxriocto1opD anvi s teurxr3oy4amtnlnctatfsDumxrono4altomoetaslaDrl(vs u0trtoxo iatla rlnvo s sexoxrpoy4amen iei sf 2umx o;t4olenioctysls rlumo;()tlxnio ootfp eauvolt0srxrxm io1apt mfvt (fa2rm(moou1aetn fcilt a2ul(vp (4 lxnio3iadfpt ln slt)t2um(o3iodol  liei sf 2uaumooo4alto i3ils a2rlu o ()artoiocta1oateaivs;t0t2tmxrpnudll e nes t aruau  ;u1aee mictatla2uluvo u4alxrxo3ta1lm r nvilt s2um(m3oo4omtemnci tfsrraur ;t0tptomoeiltfmDran o;u4aexnif ta1opDeln s () 2xmxr3nu1ap elnet t srtaum nu4opx mi3iys s2elnms;()tleomocia1opD  ieil()trxrxrpiu4lptnmnesat s2trx pnt0opto ociasfs2ua(vp;() rtnir3tytfmtr ueo s s2xr(m iydam n nvs ()aDra(rpou0tpxo oeiltlsDrm( pn(4teerxf iadlpD  nvs;()s2xmir iydopt mnei (fsrtrx  nu1tlxoii3iys a elnmpn(0 reoir3iadlmte uvolt s2xo(r3oo4apee icilt  rra(r nu1apeomf3tadfm2emnvsnu)tlxnir3iodlmtr uei t)srto(m iy1op emics () Duau o;o4teenmoetadfaDrluvonu0 etnxf iodfa r nes s sexoxm no4ap elivsatf rrm( o;u1altoiicils a ulums t0areoxf oytopt lneol( srxr(rpiu4altn neslsfa2tmxmo;u1tet iieild mDrmumo (0arxnxo3iotomt au i;t)srxoimpoodaltn nvtl() 2uaxmpou1oetnmfetas aDra( snu0aleoifcootopt anesls) euo(mpnudamtnmnvilt)srua(r nt0opt mi3ils sDrmump t)trxrxf iytfa rlivsls0s2toimpio1al  livi ( a2ururo;o1alt mfeiys s2ea(vont0tlenxf3iotfmtelnvo;t)texoxo oy4lltnmneil(faDuaumpnu1optomociyd s2el(vo;(0tetnio oydfatrauvi t)tetoxopnu4ole micil(farraumoou0ope iietadlsDuan p () eenir todomt  ueol()trtmim ou4ol nmfcils  2um(mo;t4ope  feiys a um( pn()aetrif3tatla e ueo t)t2xm(r no4lm elfesas) rrmxmono0tlxo oetad s el(vo u0 rtrxoctatlm e i olt0 eurxmpnu1op e ivslt) Dtmuront0apx moetld s2ra( o t)texnxocootfptr neo t) 2xo(o iu4ol n nes sfs2tmxm nt1aptomiciyd s eanvsn(0 etomo iadfptraivo s trurio3no1apt  netls) rrrum ot0apxnmieiadfaDulums;u4tltnir3oo1op  au sls) rxmxo3ou1altnlnvs (f rtru  ;t4tle miciyslsDrl( p t4arermf io1optr ivi ( tetrim3oudlpeemfes tf rrr(rooo4tpe ifeilsfa2rmn p (4tlxnif3oytlptrauvil(  rtoxmpnydameelnes sf Dra(  ;o0oltnmf3iat a2uaumonu4trxoif3oodlpD li ilt0 2toxrpoy4om elfcsl( s2uax pot4tleo ociyt m ean o;(4 renxrcoydop   n o s  2xoim ou1om e nesltf Dtruro;u0tltomociyt aDemnmp;t4 leoir tadfp eli s;s trxriopnu4optemfeia() Drru p;o4tet  o3ildfs rm(msnt4 rtoio3tytlaD  nvilt)teumim3oydalt miesa(f ruax onu0tlx  f3iydfm2emnmo;() rxoir3ootlmDr neolt t2xmxmpoy4oleelfesa()sDtmu  oo4opto ietltlaDrl(msnu)artnmoctotlateauesls) euoxm3oodll n fvtlt  Dur(r ;u0opeomoetlsls2rluvon(0 eeomo oa1lm   i i () rtr(rpnudlpee fvsls)aDurxmpoo1teto feiat aDel(vpnu)tlxnmo iadfp eaieo;()srxo(r iy4lp n fcia(fa2umxront0ale  o3iaslsDumump t0aexnxo3iydlmDeliei;s sexrimpny4amtemfet s) Dtr(mo;o4texn f3tydfaDum(ms;u0tltoxrcoy1op eluvs;t) 2urxr iy1lmtelivi t  2ra(mpno1ale moctatlm rl(mo (4trenmo tatlm eauvsls)s2xoirpny1am e fvil(  2urx pnu0apt mieils s2ul( p u) exomo tytopD aieo;t srtmxm io4altnmicsls)srta(  no0tlt  i3tad a2umnmon() rtomr3to1oatranvi ( t2uo(m3nodaptnmnesls)s2urxr ;t4oex mf3ildfsDrln p;t0tlxnmrcoo1fmt aueslt  2um(opou4lpt  nvsls)aDua(m ;t1tle mf3tlt s2rlu snt4aetoircta1lp rlu s;t) eurxmpny1lptemfvtltf 2rax ont0aexomoeiydfm2ulnvo;t)alxrmrcoo1fm rlnvs;s0 exoim3oodope mivtls srurxmooo1tee  ieiyt m ra(monu4alxnxf3todfaDe uvsl(  ruo(r3oo4ll   nctatfsrrru pno0tpeo feildls el(mo;()trxoifcty1fatrli o;t  exm(m3nu4am n ivt s)s2raxro;t4olenii3iad a uan ont4tlxoir3ootomD aivi;s0 2tmxr nu4llt lieilt) rtaxmo;o0opeoioeils m em(msnt0 rtoxfcoadlaD lnvi t0trxmxm3nydom emfcia( sDra(mpno4tlx  i3iyslaDumu pn()trtrmfciadlmt ai ilt  etrxr nudame lnesas) 2trxrp;t4oex  oeiatls2ra(vsn()trxomfciydoaDe uvsls  exrxopiy4lmtnlietat) rrax  ou4tetomfeildfm ea( pnt)tltriocia1fmD lues;s  rxrirpnu4llen icsat) rrm(mp;t4teeomietydfaDulnvs t0 lxnmf3iadlmDe n olt0texrim3iodlmtelnviasfa2umxm oo1oetoioetysla eanvp;u)altoxrctotfmt livo;s s2xm(rpiu4al n fvsasf rumxr ou1opxoiieiytfa2ul(ms;(0arxnxo3oydlat auei;t)s2trirpno4lm  mnes tf Dtruront0aexomfeiatlsDua( o (0areoxr iodfatrlu s;t)texoxo3oo1ol n icta(f rumu ont1aptoio3iat m2rmn snu) lxnir3ta1fp eli s t0t2tr(o io4apeelfetat) Duau  nt0optnifeiytlmDrauvsnt0aeerir3iytlmDraneil()tetr(rpnodlpee feiat aDrrur nt4olenifciltlmDumnvonu)tltomr oa1la  lnvil(  2xrxo3oo4alt mfvtat a2tr(rp;u0ole  fciydfa2ra( ont0alenxocoydfpD aueo;(0 eto(rpny1amt lietls)aruaxmpot4alxo f3tadfsDul( s;u4altnxo3ty1opD anvolt  eto(rpiydal n fct tfarrau  no0aeenif3ilslm rm(mo;u0 rtnifciotfa  luvi ( s2xr(r3ny4llenlnvi tfs2rmur ;o0apxomfcildlmDrln p;u4texnir3oodla  ai s ( s2tmxo ou1al   ivsasfaDua(ronu0opt  oeild mDrl(msnu4tetoxrcia1fpDean il(0texoxm3iu1lle mfeils)s2tmxrp;u4tlt  fetldlsDel( onu4 etrmr oatlm   iei;s)t2to(r3oodame mnvilt  Dtrum no0tpx mi3iytfa elnmo t0 rxrxrcio1fmD  i sl(0 2xoxrpoo1ll emiesltfaDta(moot0ole io3iat m eln p t0texrxo oatlmtelnvs;(0s2uoirpnodlpe lietls)sruaxmp;u4tlt iiciydlmDuanvo u0aeerxfctadoa rau i;(  rumirpny4lp nmfvsa(fs2tr(r oo4tpxniociydlaDul(msnu4arxrio3io1optrlu s t) 2xoxr3oy1alt  fvt ( aDtaum ;o4aleomoetydla rmu o;(0arxnif iydomDr n il( seuoim oy1lpt lfcilt srrmumoot4tpx  ociat sDrmu sn() rxnmo3oydfmtr nes;t s2xoiopiy4olt lieslt artmumo;o1tet  i3tytfmDul(mon(4trxrxfciy1fa rauei t0 2xoio3iy4amte fesas  Duru oou0optn iciadfs rmn s;t) rxrir3tytfa eauvil(0 rxo(opio4alenmncils)sDrmumpnu4aexn ocils sDranmpnt0arerxrcoatfatrauvsls)tetmxr nydoleemfcia()aDuaurono4aeeomieiydlm ea( o (4arxrmo oytomDe u s;s)tetr(r3oo4omenlnci tf rrmxroou0aee ifetldfs emu s (0trtrxo3ootopDraieo s0texmxrpoo1lpt mfesl(fsrtrxro;t1olxn i3tyt m ra(mp t) eenmf ty1fatr u o;(0sruoxr io4ap elnct sfaDrmx  ou1tlt mfeiyt s2ran pn()aetoir3oatomtraueo;s)t2xm(r nudal   iei t  Drmuro;t4olxomfcildfmDelnvonu)aeeoifctydomt au slt) etm(m oydlm e fcs ( arum(  ou4tpxniictls a2rlnvp (0aleoifctodlpt luvsls  2tmxo ou4ole livsatfs2raxmont4apenio3tld s elu o;()artnifcoa1fa r u o s)srtmir io4ome lfetl()a2tmx p;u4tlenioetas m emuvs;u4trenmrciatfmDr nvi (  ruoxr iudaptelfct s) rumx pou1tpen ictyslm2elumpn() rxrxr tydfaD  neolt0sexmxopoo1lp elies s)sDtaxm ;t0oltomieiat mDrlnvp;t4texrmf3iydfmt  n s;t trxoxmpnudllt mfesa(fsDrm(moot4tlt mi3tlt sDul(vp u)aexrxrctodopDe uvs;t  eumxr no1ol e ies (faDraump;u1ape mfciydlaDemu pnu4arxnif3oy1fp  ln il(0s2toxopoy1om  lfesasfs2ra(rono1tpx moeiltls2umu p;t) lerio3io1lpteauvolt  rxm(m3iu1amtnlfeiasfsDtm(m nt1tptnmictadls2umnms t4aeenir iadfaDraiei t) rxo(r ou4omtnlieia() rrrur ;t0tpxomo3iat aDulumo;(4trerircoatlatrln i s0 rur(r3io4optnlfcslt  Draumpnu0ole  ociyd s uaump;t)areoxr iodomDe ieol( srxoxopoudom e ieta(faruaxmp;o1apeoioeils m2ran s t4 reomo tydfpte ies;t)t2tmio oo1alen fetas)sDtr( pou4oet iictltfs2emu s;()arxnmo ia1lp e neo;(0teuoxr3oydlm  lfvsas srum(mpnt4tltn oeiydfa2umnmp;()alenxr3oy1fmte uvs;()t2xoiopoy4omtemiesl(f ruru p;u0oleo o3ilt m ulumo u4tetoiocio1lp rauvi;t tetmxm3no1opt  net ()a2rrxrp;t1opto f3iyslsDra( p;u)tetniocta1lmtr n o;s seum(o3oodoltn ics t)aDtr(mpnt4tle miciysfs ua(vpn()aeeoirciodfa r u slt0 rxoio iydomeelfvils  2ta( pot1aetoiieiasfaDemnmo;t)arerifcoytopteanesls0srtm(o oo4amt mnei sfsDum(mpnt1texo f3iys aDulu sn(4texnmociydfaDrlneo s s2tmxopnu1lmee netat  rtaum ;t1oexnmo3iydlmDuluvp u)texniocoytlm eluvs t0srxrxo3iy1lme mnvilsfsrtr(mpnt1openmictlsls2rluvp (4 reoif oy1opD an i;s t2xrim3oy4lmen ici s)a2rru pot4oet ii3iys mDranmon(0 rxomrctytop   nesls0 2toxrpiydom  lnvi (fs2tmx pnt1oex iociat s rmuvont4texrmrcto1oat anvi s0trxoxm3iodam nmnetlt)sDrmur ;u0tetnmi3tldlsDumn s;(4 rxnxf3iodfp eln o (0 eurxo io4openmnvs ()aDua(r ;u0alx micilsfa2rmuvo;u4trtnmocoytoa eaiei () etoxo oydol nmict t  ruru  nt1optoii3tytfaDrm(mp;(0 rtoircoo1om eln s;t)s2tmxo3io1ol nlivsl( srtr(rpnt0openmi3iasls eanvont4trerxociotlp r ivs;()tetoxm3oodlmtnlneias)s2tmxront0alxoii3iys s eln p (0 lxnmrciydlaDeanvo;t) eto(o3oo1opt lfvsa( arua(  ot0alx ioeiyslaDrlnvp u)aetoxo ta1lmte n s t  2xmimpoudop elfvtas  2urxr ;o1ope mf3iatfaDem(mp;u4teenxrctatfmt lneo t teum(r3nydol nmieias)a2trx oot0apenmf3iyd m el( on(0alxrmo iytop eln il(0srxmiopiydlm nlivs ()a2ta(ronu1apx ioeildlm emuvs ()aetomocto1fmtrauvils) rxr(rpiodamte nviatf 2trxrpoo1alt ifetldfa emumpnt4 renxr3iydoa  aueo;s0 exmxm3io4am elics sfarrmxm oo1tet  oeils sDuanvpnt)teeoio3tadlpD  n o;s s2urio oy1ameemnci tfa2trumpou1aet  fciltfs rmn o;t0 exoifcoa1oatelies ()sexoxmpny4olt lneias a2rmxm ou0oleomfetldfaDelnmo;t0 etnmfctydfpDelivi;s0 euo(m no4lptelnvtl(fa2trxrpou0tle ioetat mDemuvp u)teerir3todop  li olt0 rtr(m nydomt mfviat s2rrx oou0oeeo o3iadfa um(mo;u)texrxf ta1om r u s;( trxrimpnodlp n nvta(  2rm(m oo1aeeomfeiltla2emu o;u0texoif3tytomDrlnvs s)t2xm(opoydape lieta() 2um( pnu1aexo oeiad mDumnmo;u)alenio oydomD anei;(0trumim iodapen nes t arrr( o;o1tpx if3tltls2eln on(0texrxf3tydfa raivs;s  eumimpnodll e ivsatfs2ta(m ou0tle  feildlsDean s () reomr ia1laD lu i t0 2uo(rpoodolen icsa()sDrrxro;t1tpe  oetasla umuvs;u0 ltoio tadla rlieo t) 2toxm3iy4lp nmfesat a2rmu  nt1tex ioctldla uauvp;u4trenmr3oadfa e nvi () 2toim oodopee iet sf ruaum ot4tpxomo3iad m ua(vp;(4aetnir tydfatrlnei s  2xmir3iudlmtemivi ()s2uau o;o4olt iietytlaDrln snu)trtnir3tatomtr i o ()s2urimpoy4ll elfeia()aDtmx  ;o1oetn oeiyslaDuan o t)texnxo oa1fp  aneils0t2tmxopoy1ameelivias artru p;o0apeomf3iatfm eanvon()treomf3oodlat  ueo;( seumimpou1aptnlfes () 2raxr ou0optnmictydfsDemnmsn(0teenxo3tatlp   ues;( seurimpnudomtemfet s  2trurono1olx mictlt s2rau pn(4tetoio3iotlmte u s s) 2toim iy1lle  nci s a2trx  oo0tlxo ociyd a rluvsnu)alxomf ty1fp   ivi t)teumimpou4omtnliet ()sDraxm ot0olx moeias m2uluvp;u) rxrio3iy1omtrluvil()s2tmxr3iu1aptemfcsltfarumxmpou0tltomfctld mDuauvs (0texnirctadoatran sl(  etm(r3no4lm e nei s srrr(mo;o1alen feiat s2uln snu4alxrxr3ia1fmD lnes s  2to(rpnodom n ivil( s2tax pnu0alx  ociysfs2rlnmo;u4 rxnmr iotopDranvilt  rxmir3iu1am nlivs t) Dtmu p;t4aptnifctydfmDra(mo;u)tlxniociotfa  luvol()srur(r nodop   icsl()srurum oo1oeto octydlmDum( p t4 eeoxocoadfpt  ueo;s)srum(r ou4lm e ics sfaDuaxmp;t0aetn ocildls2emnvpnu0aleoxr tytfmD  uesl(  eumxo3nudomtn ivtls sDrruro;o1apxnmfcilt a emnmp;t4trxrir oo1fateluvo;t  exr(o nu1alen ietls)srrrxro;u4oleo fciytfs ranvon()teeoif3ia1fmDe ieo s)srtoxrpno1lme  ies (f Duru o;u1openifctasfaDulums (4trerio3ia1op r i ol(0t2xr(o3no1apte nci sfa2trx  ;o4olxnmoeiltlm emu sn(4tlerioctatfmtr u i;s)t2xrxr iu4ope mncs sfs2rrurpnt1tpxo o3tyt s ranvo;u0 leomr3ootfpD luvi;s0seuo(mpno1altemiesatf 2urxmp;o0oee  octyd aDumuvonu4treoio todoptrln ilt)teurxrpiy1lm nmiciatf Dtm(r ot4oltomf3ildfa uan s;u)arenxfctytlaD aivols0 rtoim nydlm emnvilsf Dta( p;u0olenmiciyt aDrmums;u4aexomo3tadfa eluvs s0 2toxo no4lltelnet (f Drmu o;u1tetniietysfsDel(vs;t0 ltoxr3tydfa  livs;()s2um(r3nydap nmiei sfsrtr(mp;o4opxn ieild s el(vo t)tlermfcoo1op e n o ( srxmiopiudam  mfet t)arta(  ;o0tpx  fciatfa umn o t0aexrio iydopt  ivi;t0 exr(m nu4amee nesat srtau pot0opt mfciadlmDea(mp (4alxoxrctydlptrauvilt0seurio nu1amteliet t  2uaum ;t1tpeo f3ilt sDrmn o u0 ltrir3oydlatelivo;s0 rum(r3iudamt  nvias  ruaxmooo1aeen fciatla2ua(mp;() rxrif3ootfpDe u i;s)t2xoim ou1ol  mnvia(  Dtr(mpot0alen f3tldla rmnmpnt)trermr oy1fmtrauvi;t)seurir3no4om emieia(fs2rm( o;o0tee iicias a rmnvp;u) lerioctotfa   n slt0sexmxrpnudoltemncil()arum(m ou0aeeniietasfa uau snt4alxrxo iydlpD auei;s0srxoxrpnudll emivtl()aDrmxmo;t4tex io3iydlsDumnvsn(4aexrmf3oo1fmDeanvo t0 exm(m3oo4aptn nvs t a2umxmp;u4aleo oeiat s rauvp;u) leoxo3oa1lptr i s ( srtmirpoudoltelivtlt  Drr(m ;t0olxoiociadls2ran p;t0tltnirctotlaDraueo;t)trurxrpnudamte icia( a2urum nu1tex iictlsla ulumsnt4trermf3ta1laD  uei s)srtoxm nodlp  mfvtl(fsruaxro;o1aet mfciad s um(vp t) lxnmfcoa1oaDrluvsl()seuo(rpno4ape lfeiatfarrmx o;u0apxo feiadls rm(vp;t4 reomf3todlaD aivs (  ruo(o3ny4ope mnvilt s2tr(mp;o4opto ietltfmDrmn s;()alenmo io1lm e uei t0sexr(m iu1optnlieiltf rrrumooo1apeo oetltlaDra(mpn(4 ltnmr iydop r uvs;( texr(opoydap n fci ()aDuaur nt0oetn f3iaslmDrl( p;()aetrmo3io1fat anvo;(  2xmxopoy1omeeliesls a2rru ono0opx mfcild s ran p ()tetoifcoo1fat  uvo t)trxo(o3io1lpe mfvi ( sDtrum ;u1tpxn i3tasfm2ran pn(4 rtrif iodfp r nvo t) rxm(rpoodlpeelnvias)sDuaurpnu4ope iiciydlmDrmu p (4 eermfctadoaDelnvolt0 2xoir ny1lp nlnesat srrmx poo4apto fetydlm2emu s;() lenxo3totla e i o s trxoim nodomtnmncsatfaDrm(  oo4tpxomf3tlsfmDrlums;t)alxnir3oo1fmD  u s;( seumxrpio4ape  fvsls)srur( pnt4tlxomiciadfsDrlnmp;(4 lerir iodoa raivo (0 rtoio io1open ivi t sDrrurono0open f3ilt m emuvs;()tetrir oatomD liei t0 etrir nydame mivias s2tmump;u4tex mfeiltfm raumonu)areoxr3oa1lat  uvo s)sexrxm3oy1ape mnctls  Dta(m oo1opxn f3iadls2emnms t0 leoxr iytom rai i ()srtrimpny4amt mnei s aDraumoot0olx mo3iadfmDran p (4trerir3oa1fp e nei s  2tm(mpiydaptn fci t a2umumo;t1oltn ociydfs2ea(vpn(0alxnxrciytfmteluvo s)seumim3iydlptnliciatf 2ua(rpoo1tpeomf3iltfm emuvp;(0arxrxoctodom rluvi;s)truoxopiodopeemfcsls) rrr( o;u4tltnmi3iadfmDuanvsnu0alxnmr3oatoa   neo;(0seuoxm3nydlm n ieiasf rrm(ro;u4olxoiiciat s em(vo;u0 rxrxrcio1om r uvs t)trumir3io4am nmnvs t srrrxroou1tpxnioeiasfsDuanvp t4 rtnifcootlmt  u o s0sruoirpnydll  mnctls)sDrr(mp;o4apxomfciltlm2uanvs t4alerxrcoodfatr i sl() etm(opiu1ame lfcsasfa2taurp;o4teeomociad a2emuvont)trenmf3tytomte n s;(  eumxrpiudlp nmnvslt)a2ur(mpoo4openiociytfs2eaump u4 reomo todfmteluvs t0srxoxr io4olt  nct t)artaumono4apxnmo3iytls2eau pn(4 ltrir tadfmD  nei;(  exoimpiu1optnlfci t  2tr(m ;t1tltnmfciyd a2ul(vpnt)aeerxr3todfateln o ( tetmirpoo1ole lfeia()s2rr(ro;o1tpx micias s2eau on(4trtrmrciatla eauvsl( sexrxo3nydlm emfvil(  Dtm( oou4texnmfeilt a ran pn(0tlxrmo tytfpD aivs;t0s2uoio3iy1am nmieia(fartrx pou4opeomieilt a2ua( s;t) leniocia1fmDeaivi;() 2urio3oo1apeelneta(fartm(mo;t0olto i3tyd s2eanvp (0 rtrif ootfm rlues;s teum(r iudol nmnesls srurur ;u0aee ifetadlsDrlu o;t)trxoxrcta1fmteaueslt)t2xmxr ou1ale lncs sfaDtax ono0tee ioeiltls2rmnvo;(4trenmrcootop eanvo;()srtoir3no4lm elicsl(  2tm(  oo0oexnmi3iad s2ul( p;t0 exnxr3oo1fp   i s s trxo(r iudal nmfcils arumu pou4oeenmf3iadla uaumsnt)tleoxfctydlptelneo s)t2xmxo3oydolt  fvils a2rmur ot0alen ictyslsDua( p;u)alxnirctadomDrluvs (0teuoiopoo1alte fcia( srraump;o1ope  ociydfs2elnvpnt)tlxoir oydoaDeluvil(  2tm(rpiydllenmivtl()sDrm(m nu4tlto ieiadls2uln s t4 ltrir3totomDeanvi;s teum(m iy1ape mivtltfsDumu pnu4tlt io3iat aDelnvs (4artoxfcoa1fmDr uvsls  ruoxo ou4aleelivs s) Draumpno1aex ifciyt mDum(ms (0trtnmo iodop e i i;t0sexr(mpio4ame  fvtl( a2tmuro;t4tetnmfeildlm umu o;t) rerir iatopDelnvi;(  etrxrpnudamtn nvi () ruaxmpoo4aptn fciyt s2umn s;t)trtrif3iotoat luvo;t  2toio nu1llen net (  Durxrp;u0oex mf3iat s ea(msnt4 renio3tydoa eaivs s0 rxo(m3oo4lpeemnvsl() 2umum ;t0oexnmfctad s eanvont0 etoxfcoo1faDrlnvs s0 2xoim3ny1lmt lnvslsfa2ua(  no4oexnmo3ilt m2eaump;u4artnif3oytfaDr ueils0 exoxm oy1al emnciasf 2umurpoo1tpt  o3iydfmDemu o;u4aetrxo3tatfmt anvslt0srtriopoudlpe lieilt)arrr( ono1tle ii3iysls2uln snu)artnxr3tydlptr neo;t s2triopoo1lme  nvi (fartmu  nu1texnmfetytlsDrmu p t0tltnxr3iydopteanvi;s)t2xrir3nudopen fvsat  rtau ono1apt  f3tadfs2eauvo;u0altoif oa1lpDe neslt)trtmxm oydlp  mnvtl()sDtru oou1tpxn oeiytla em(vont) ltnmf oydoaD lneilt)trxriopnu1omenmics ()s2tmu o;u4aeeo i3tytla em( snu0aetnif tytopD  n s;(0trum(r3nydam n nvslt srrax  ot1tpeomoctadlm umnmo u4aeerxf oy1lmtrau o t s2trxr3iy4lltnlivias aDumx  ;o0aex  ictatfm ran s;(0tetomrciy1omD lu s s)setoxm3oydomtnliei t s2umxrono0ope  fciadfsDuluvo u4 etoiocio1fatrai s s)teurxr io4ol emfei (f 2uaxm nt0tltnii3tysla2em(vo t4 rerxocio1oateaies s srxr(mpnu1aleelfcil(  2ra( pnu1teeomieildfaDranmp (0arerxfcoodomDeauvolt0sexrxrpny4altemfctlsfsDtrurpot1optn ietysfm uanmp ()tlermrctodla e i o;s) etoxopoy4openmnci (  rrrum ou4opeo ictyt aDum( snt4trxrmo ta1la ran i s) rtrir3oy1lptelfvils)s2ururonu1tetoioeiat mDranvpnt)aexnmrctatfpDelnvils seumim3oy1ame  ncil(faDtaxmpot4apx  fciltlmDran s;t4trxnxo3io1faDrli s (0 rtoiopoudolt mfvtlt)artmxmooo4aeeo fctas a el(vpn(4 lxrmf3tytlp rauvs t0t2toxm3oodlmtnlnvils srrm(mpnt1alt moctltlsDuaums u0 rxomo iatfa  lieol(  rumxr iydalen nci sfaDtax o;o4tltnmoeiyt aDel(mo (0aexoxociotlpteln i;s) rtmio3iu4opee fvtl()srrr(ront1apt mf3iytlm2rl(vo;u) rxnif oa1lm  lueo t t2xoimpiu1oltnmics t)srua( pnu1texoifciadlmDulu p;t)artomfctadomte uei;t  rumxo3nodop emiviasfaDrrumpnu4tetn f3iytls2ulnmp ()texrxrctatomt auvs s)s2uoxrpou4om   ncsltf Drm(rp;u4texo iciydfsDemnmo u0 ltoxf iydopD  i s;s) etrxr no1optnmfcs t srrr(r ;u1texoioetadls rlnvpn() renxr3iadlaDran i;t  eumim3no1amtelnetlt s2urxmono4tet moeildfs2rmnvo u4tlxnmo oa1oa elu ils0t2umxr3oodol n fctl(fsrrm( p;o4opxomfetat m rau pnt4tltnirctytfpt ln s () rtrxm oy1olt lncs s)aDtrx oou1oex iociys m2rlumont0artrircio1laDr u o;t  2umxr ny4lpenlivtat)a2tr( pot1alx io3tadfsDeaumo u) eeoxocoydlat an o;()s2xrio oodlme  neilt) 2ur( o;o4tetniietaslm2rl(ms;t4 rxrifcta1fa  livi;()t2toxo nu1lmee nes t sDta( pot1tpx moeils s emuvp;(4tlxnmf iydfmDrlneo t0srtoxopiu4altelneilsf Dumumo;o1oee mf3tytfm eln s t0 lxomr3iadfp ran s (0t2uo(o3iodopenmnviat arurur ;o1openmo3ils m2rlnvo;() lxoxr3tatfpDranvo;( teumxm3oo1llt mfcsa(fartaxmoot1tlen o3tydlm2rlumpn()tltomf3iy1omD aiei;t trto(m3no4lme  ict (f rumxm ot1oetomicilslaDumnmpn()aleoxociodla rauvs (0t2toxrpiudlltelneils  rum(mo;u4tpt iictldlm2umn p;(0artrifcootfa ranei s) rxrio io4am nmicslt arururpnu1apxnmoctatlm2emumo;t) rtrmf ty1lmD livi;(0t2umio3oodop  lfesat)srtr( pno0tpt moeiad s rluvo u4 lxnxf tatlaDran o;s)teumir3ou1apeemfcsas) Dtrum ;t1tpx ioeiytfa2elnvp;(0 rtrmo oadfm rai o t sexm(r3no1optn nvs sfsruaxm ou4aexo ietas s rl( p;u0teermr oa1lpD  n ils0trur(m iu4ome lnvtltf Dum(rpou0aetomi3iadlaDeaumpnu)trxoifctadlatranvsls) 2tr(r3oudolteliei s aDtr( poo4tptomoetadlmDeanmp u0 lxrio3iy1lmDrauei;t) rtoxm oy4alee ncsl() rrrxm ;u1aex iiciatls2emnvs;u4 lenmf tatlpDran i s truo(m3io1olt  ieilt) Duaxrp;u4ape  feildla2rm( sn(0trxnir oa1fmt li sl(0trtoim nudal elncsl() Drax  ;u1tlxoiictlt mDea(ms u4 ltrif3ta1optranesl( trumxr iodale  icsltf rraxm ot0oex ifeilslm ua( p t0texomo3ta1fp   ieo t0srtrim io4lpeemfetlt  Draxro;u0aexoif3iatfs2rln s;() exrmoctodlptelneo s)seur(opno1ol e ici (  Drm(r nt4tpt mi3iat m rlnmo;() rerxr tydoatelnvo s)s2xoimpno1am emnvsl(farrmx ooo0tltn ociys a2ranvp u0alenxrctydlpDr i il()trxrxopoydal nmfci s)a2ta(rpot0oee mf3iys s2rm(mo u0 leoxf3oy1lm eanvolt  eurxo oydaltn iesltfs2ururpno1aex  fciatla umnvont4aetoio iytfaDe nei;( sruo(r oo4ap   fetatf ruaxrpot1tptomo3iatla eauvs;t)arermoctadfmD aieils teuoxmpnydlpe  ivsat) rua(mpot1oltniietls s2umnvs u0teeomr3iy1la eai o s  2umiopiudom  mfeslt) rrru oot4opeo feias s elnvpn(4 rxnio3ta1lm rluvi t s2xr(m3io1op   fesat)a2rr( oou1aleo oetlsfaDrlumpnt4tlerxfctadfmDrlivs (0srxr(opoodomt lfvs tf 2uau  ;t0aleomfcias a ea(mont)aetnir3tytfmDelueols  2xr(o io1altelfei t)srurxroou1tle  fetld aDum(vont)trtrxfcoydlateli o;() ruoxm ny1apt lfcs t  rtmum ;u1texoii3ildla2rmumo u)texnmfciy1op e uvo;s0 2xrir3ou4apenmivils)s2taxr nu1ole mf3ild mDulnvo t0 ltrmr3tatlp rlieil(0setoxr3iydol   ietls aDtaurooo4apto ociyt mDelnmo;t4tlerxo iadopt lies;s s2xrim3oo1lltn neil( aDta(rpnu4tptniieiyslaDrlnvp u)aeerio ta1lmDrlues;() eurir oo1lm emncsl( sDraxr ;u1ope  fciyt m ulu s;t0 lxrio3todfmt au s ( setr(r3iy4opeemietls)arrru pno4olenmictyt s ranvont)arxnxr oo1omte uvi () eumxrpio1ol emiviasfa2rmurooo4tpxoiociysfmDumn onu0 rxomf3oo1faD  ueo t  2xrxr iu4ll  licias sDurxmooo0alt  ociatfaDem( s t0aexnmrctytlm elnvi;s srxr(m ou1lm emncsltfa2um(roou1opeo fcildfa2rm(ms t0tlenmr3oatfmt lu ols srtrio ny1lptemicsls) Dtmur no4olto ieiltla umu sn(0 lenxf3to1oaDeanvo;s  2xrio iy4om e nci sf 2umurp;o4aetomiciltlm2ra(vs u0 eeoio3to1la e nvs t  eurxo3nudlmtn ieslt srtm(r nt4tlt  o3ilsfm2uaumont4artomf3ty1laDe nvo;s  rxoim iydale mivs tfs2ta(monu0alt moetlsfm2rl(msnu4 lxoifcoa1lpDeaivs;(0seuo(opoo1aptemnci ( aDra(roou4aee micias m rlnms;u)tltnif3iy1lat  n i;(  exmxo3ou4ol elfctl(fs2tmx ooo0tee iocildfs rau sn()tleomo3iydomDr neo;t0 etmxopoo4ale mneilt  Dururpnu1tpxn ietytfa rl(mont0tltrxr3iytfa rauei;(  2um(r3ny4am elfvsat)s2trxrp;u0alx io3tyslm2rm( p;() lxrxo3iatop  lnvsl(0 rumxm ny4amtnmnviat a2raxmpnu0tlen i3tadlm ulums u) eenxf3io1fm  li o;s0truoiopnudol e ictl(f 2tau  oo1oeenmo3iydla2uln s;(4 reoio oatlp rlieils s2xr(m oo1omenlnct t) 2rr(rp;t1tlto iciydlm2eau on(4aeeoif3ta1lpt au o (0seum(o oudlmeelnei (f rtrur ;u4ope if3tad s2emu snt4tlxomrcto1lptranvi (  etr(o3oo1ole mfeiasfaDta(mo;u1apx  fciydlmDuau o u0 reomr ty1laDeaneo;s) rtrxrpno4lmtn ieiasf rumumpou0oee if3tytfa rlnmo;t) eenio iadop rlueils  2xmxr nodop   nvtl()srtaxront4oetoifctas a el(mo u4tetoif3oatfpDr ivols tetmimpnudalee nvi t s2tmump;u4apto fciasfm2um( o ()aleomoctodlpD  n o;t  2tmirpiy1olenlfvs ( a2rax oou1oeeomoeiatls2umnvonu4alxrmrcoatopteau s () rxrimpoydom nmiei t)sDumurp;o0tlto ocilslm emums;(4 reoifciy1opteaieslt  2xrio3ny4ap n iesa(fa2tax ooo0aeen o3iltls2umumsn(4aetnmo to1lpt auvi;s)setmxr nu4lltemfcs s a2uax  ;u1texoio3iys a2em( p;t) eenxo ty1lm eauei;t) rtoir3oy4opt  feiat aDtrumpoo4oex iiciydfmDumuvsnu4alxnio3io1fa r ieil()trtmxm oy4amtnmictat sDtrumpnu1olx  fctlsfaDel( pnu0artrxfcty1lp  livil( seumxr3ny4lme  fvi ()arurxr no4apenmoeiydfm2elnms;u)aexnmr3oa1laDr ivi;( seumxmpny4altnmicta()aDur( p;u0oeto i3tlsfsDrmu p;t4 rerir tadomteluvols0 rtrir3ny4ole mieslt) Dumumooo1apen i3ilt a rlnvo u0aetrxo3iotfaD  ieils0sruoxm3oudlme  fvi t  rtr(r ;t1tleoioeildlmDrmu p;(4altrmrcoy1omDe ues ()texrxo3iu1omt lfvils aDrmumoou1oexoio3tld m ulump t0arxniocoydfaDeau sls texrxr oy4opt mneiasfs2trump;o1tlx ifeiytlaDelnmp u4trxrirciotop e neols0srtoxr iu1opeelfcs s a2rru o;t1alxo feiatlaDum( pnu0tltomf ta1lmt  u il() 2xrirpou4lpen ies (fsDtm(r ;t0olx mictydlaDumu s;u4trtnmo oydfaD aivo t)trtr(rpiudamee ncilt) 2tr(r ;u1tpeoiiciadls2rmuvpnt)trtrxfciotlate ueo t) eumiopiodal nmics sfsrrmxrpot1opeo fcilsls2umump;(4teeoio3oodlpteai i s s2um(opou4lm n nvta(faruauroot0aetnmocils sDemnvsnu)tlxomo tatomte ies;t setmio iy1lpe mfvt s arurxroot4opx iieiltfm2umnms u0aexrxf tydopteln s;t)t2xmim oy1alte neilt srtaurp;u4aeto oeiasfa2rm(mo u0trxomo iotlmt luei;( t2ur(r3oo1al e iesat s2um(r ;o4optnii3ilsls2rl(mo t4trtnioctytlatrlnes;s seto(o3nu1omtnlieiat sDum(rp;o0oleo oeiltfa rlums;u)artnxr3iy1oa rlivs;s0setr(m3nudapenmfvt ()aDum(r ot0opx iieiatla rlnvo u)trtoxr3ia1faD li sls tetoxopny4oleemivt sfaDra( oou4alx iociydla2ulumpnt4teerir3io1opD aieols0 exrir3nu4lltn nvsl()sDtr( ono4aeeoif3ildls rm(mo t4trtrmfciadoateln ols)tetrxrpno4oltelnet s sDrm(rooo4aptnmo3iysfsDrlumon(0trtrir iadlaDelieo ()texr(m3iy1ap elics () rra(rp;t1optnifctls s2emnmpnt0aeeomrcoadfp  lnvol(0 rxrim3ny1omtn neils  2ur(  nu1texomocils sDua( sn() rtrxo ia1oa e n s;t)trumiopoudopeemivtat  2rrxrono0tetnio3iadfs2rlnmon(4 eenmrcoytfpteluvil()trur(mpoo1lmeemfet s a2rm( oou0alen fcilt mDrm(vo;t0 exriocoodfa   n il() rum(r3oudom n fct sfs2tmumono1opxoiiciat s ulnvo t0 ltrio iotlm  luvilt  2xrimpiu1lpe lictasfarraumono4alxoiiciyd a2rmnmo;t4artrmo ty1fp  lneols)t2uoxo nydomte iesls) Dur(monu0alxo o3ilsla ulnvo u) ltomr3iadoa   ies s trxr(rpoo4oltn neia()aDtmum ou1oee ii3iysfa2rl( sn(4tltnio io1oat  n s;()srur(o3nydol  micsl(fa2uaxm ou0aeeomociadla ul(vo;t4 rtomr3iy1optr ueo;s  rtoxopoo1ap e fet (fartr(r ;t4aexn fciysfaDemnvon()teenmf3oytfatr n slt t2um(o3nodapen ivil(fa2um(  nt1oee miciltls2rm(mo;t4trxrmo3to1om ean o;()sexm(m3oydlmenmnvi sfsruax pot1aeenio3iaslsDrl(vpnt4 exnxfctotla eanei;t  2xrimpio4lmee fviat) Durx  nu1alt moetlt a ulnms t)trtomocoatlat li slt  exm(r oydoptn nvs s) Drrx onu0alxo feild a rmuvs;u4 lxnifcto1lm rlieslt  rtoxo oo1op nlfeta( arraumpnt4optn ieilt mDemnmsnu4artrifctydop  auvilt setm(m nydal nlnvtltfa2ta(rpnu4apxn octyd a elnmp;t4 rxoio oytfmtrlneo t)setrio3oo4ap emncs t artm(m oo0alx iociysfm ulu p;u0tltrxr3tydopteau o;t)seum(mpiudame  ivils)sDtaurp;t0olt  o3iad a2rmumo (4aexoio to1fp   ivsl()srtrxm3io1op nmfcslsf ruaurpnt4altomoeiat m2eau o (0texomf3iatlmtrluvo t)s2trim oudoptnmnetls s2rmx oot4tpen i3ilt a2ua(vo (0teeoifcoodoa elieo s)seumimpou1lme mici t arrau pno4aexomociadfs ea(mo;u4 exniociydlpt  nvi (0srtrxm iu4lp n nvs tfarra( ont4tpxniictasfaDrmnvp u4tlenif3oodlaDelieol() eurxo3nydlmt  icias)a2rru oou1aleo f3iyd sDuauvont0texnxr3oatlmtrli s;(0 2xrim3iudap  licsasf 2uax  ot4tet moeiaslmDum(vsn(0 rtomf3iodfpDe uei ( srto(o nu1amenmfetas aDtmx  ot1tlxnmi3tatla2umnvp u)altrmo todfm eaivsls0seurim3ou1omeeliei tfs2ra( oot4tpe mocild a rl(vo u0tltnxrctodfpt aneol() 2tm(r oo1aleemncsas artmxmo;o1tlxn feiysls2ean o ()arenxocty1omD  nvo;s srtrir ou4ole lncs (fsDrm(mpno0tle  i3ild aDuln o;t)trxrxfcoydfmtelivsl( sexrio3no1aleelicilt) Dta(rpnu4olenifciytla2rl(vp (0tlxrmf3tadfpDeaues;s)trxrio3ou1lmt lfeil()srta( onu1tptomfciad mDua(vsn() lxoio3to1lm eanvi;()srtm(m3ny4opt  neslsfartru  ou0aee mf3iytfs2ulnmont0texrxocoodfa r ieil() rurxr oo1altemivia(  Drmu  no0alenmietysfs rlumsnt) lxrmrcta1fpDelnes;() exr(m3nudlmtemnvtl( a2umumpou0apto i3ias s el(vs u4tlermf3oy1late i i (  rxr(o3oudomeemfciat)srtax pnt0apen i3iatfa2rl( onu4tetomr oydomDr n o;t  rxmxopno4lpt  nvs s) 2tmu oou4optnioeiatfa rluvp;t4trxnmo3to1lmtrlu sls srtrxmpou4oltnmnetat) rtrumpnu4tpxn icildla2rlump;(0trtoif3iytomte ieo;(0srumir3oo1apt mnesl( a2umumonu4aexn feildfsDean p;t0artoio3oa1fpt luvo (0texm(o iudope lncsls  rtrxmo;o1tlx  i3iytfm2rmuvp;() exomr iatfmt anei;t) 2toxr iy1altelnci (farrmxr no4aetnmfciasfs2uluvonu0 rtrxf3iotfa ranvi;s)texoxr3ny4al n ivt s aDurumonu0olx if3tas m2rmn o u)trenxr tydoaDelivo;(0t2ur(o no1amt mict t  Dtax  ;o0opt io3iatfmDuaump;u)texrmrcta1om  lnvs;() 2tmxopou1ape lfctls)s2ururpno0aetnii3iasla ea( s u0altnif3oatoaDr nvol( s2tm(opiudlpt mfvt t sDurx p;u4oex ii3tldlmDelu snu0aexnxo3tytlaDrai o;( t2tmim3io1apeemnct () 2umxm ;o1opxomf3tyslaDuanvo u4artomfcoodfaDrau olt) etmxo3io1lpte nctltf Dta(  ot1apeniieiasfm rau s;u) etomr oa1oa e neo ( s2uoim3no1ll nmfcta(  2uau ooo4oltomfctltfm2elu s;t0aetnir3oadfpDe neo t  eurim3nudamtemict t)a2rauro;u4open iciadlmDrmnmo;t0arerir ootfp e nvo;(0sexoirpoo1ol e fvt ( s2tau  ;u0apeomfciydfm2rm(mo;()trerxo iadfp   ieo s)truo(m3nydoptelnvt (f Dtaxmo;t0tpt micilslm rmnmont4 etrir3iydfpD  neol(0 2umxrpoo1olte fcilt s2rrxrpoo1apxomf3iyslm2ua(vo ()tlxrxf3oodfp e ieils0srtoim nodlleemici (fsrtmx  ;t1apen fciat a umnvonu)alxoxf ootoate uesl(0s2xrxm iy1lmeelfcta(f 2rm(  oo4oeeniictas a2rlnmo u)tltrir3todoaDrauvo s0 rtoimpiy1oleemietat  rta(m oo0olxomo3iat s ra(vo u4aetnmo3oodlat livs;()s2toir oy4lmee ieiat  rra(mp;o4olx iictasla ulu p;t) exrxfcia1fp ranes t s2trxmpoy4lptnlfcia(fs2um(moou1tpen fctyt s2emn o;u)teermr ia1fmD lu sl()t2xmxopiy4om nmnciltf rrau o;t0aex mieilsfm em(mp (0tltomr ty1fa rauvo;t0 exoxo3ny4olt lncta()srtm(ront1open feiadls2ul(ms;()alxnmocty1lp r i s t  2tmxm iodol nlfeilt s2trum oo4oltn feiasfaDrlu s;(0 exoifcoydoa  aivi;s tetmio3iu4lpte ict (f rurx o;u1tpt moeiadla2uau pnt4trxnifcty1lp ranvi s0 2uoiopiu1lm nmicslt)srraumonu1oet  f3ilsfs rmnms ()trxnif iotoatrlnes ()t2uoxr oo4aptn nct t  rrax oot0tpxo f3ildls2ua(vpnu0artoifciytomtranvo;t) rxm(r ny1open iesat  2ta(mooo1tltn iciat a2ul(mon()tlenxf3iy1oat  i s;s0 2umxm nudom nlneils s2taxmp;t0oetnmoetltls2rluvp;(0 rtrxf oatla r uvolt  2trir3oy1ap n ivsatfa2raum ou1oexomo3iyt sDrm(ms;u) etnmfcia1oatelnvo;s)teuoxm iu1omtemnvta( s2raum nt4tptnmieiat m ra(monu0alxomocio1fpD ln ilt)trxoir3oudamee nei t aDtrxrp;u1ape  fctatfa rmuvp;u0artnmf iatoat  n o ( truoir3io4omt lnesatf rrr( onu4opeoifcild m2rmnvsnu4aetoif tatfaD  i i;t0t2xmio oy1amte nvia(faDrmxmpot4texn octldfs2elu p;()texoxfctodop rlu sl( texoirpoudll nmiesat)sDumx pnt0aeeo f3iytlsDra( o t0altoif ootlpD  ieols) rtoxr iydapeelieiat  2taurpou4ope io3ias s2uaump;t0trxoio ta1lp e nvilt sexo(o ny1openmfeia() rrmurpnu4tee ifciasfm ra(vsnt)tltoirciytla   i o;t0setoxrpoodopee ieta(  Dum(r ou4olenif3ilt a eau s;t)aeerif iytfateau ol(0s2um(r3no1al elictl(  Duru ooo1openmoeiydlaDem(vs (0trxnio oydfa eanei s)s2toio ny1amtnlncils srtm( oot4oeto f3iltfa2emuvo;t)altnxfciotlp r nvils  rxmxr3ou1aptn iviltf Drrumpou4tetomoctaslm emnvpn(0artoifcoydlp elnes;s0t2xm(m iudomtnmieilt aDumxrp;t1aeeo f3tasfa rauvs;t0 rxnmo iytfp   nvsl( teuoxm3iudalee feia()srraxroot4tex mieiltls ranmp;u4tlxoif oatfmDelnvi s t2urir3oo1ap elfetatf Durxm ou4tleoio3tasls2um(msnu)tlerir3iotomte ueol(0 euoxr oudap emfeilsf Drm(m ;o0optn feildla2elnvs;t) rxnmr oydop raueilt setoir ou1lpenmicslt)a2ua(r ;o0alx  ieilslaDrm( p t)texoio iotfm eai s;s)texm(m no1lp nmiesl() 2uau  ;o1tee  ocildls emnvp;()areoir tydfp   n ilt)srtrxm nydlmt  nct s  Dur(m nt0aetoio3iadfa2ul(vpn(0aexoif oytfmtran o t0srum(mpou4opeemfeil(  Drr(r nt1olt io3tlsla ulnmo t) rtnmf3iydoaDr u i t0 2uoim nydapeelicta()srur( p;u0aptn ieilt m rmu onu) etrmo3ta1omD auvi t0t2xoxm iy1al nlicia() Dua( p;u4aet if3tlsls emump;u0 exrmf3oydoaD aueo;t) 2xrxo3ou4om e nvilt)artrx pou0oetn i3tat s uaump u0tlenmf3oadlpDe iei t) 2toim3iydlmtemivtat aDua(m ;t1alt mi3tysla2ua(mo;u)artnxf tatfaDr i o;s)t2ur(o oydoleelfei s)sDum(  nu0tee  octltlaDelnvs u4 exrirctotoa r u olt0 rxmxr nudal  lfetat)s2uaxmono0optomoetlslaDrm(ms t)altniociy1lp raivi;t0s2xmir oydomt  ncs t s2raxr nt1aex  i3ilt m2elnvp u)aleriocootfat li ilt0 exrxr iodapt livs ()s2tm(mpot1teto o3tasfmDelnmsnt4tlxoircoo1fmt  i o (0setmirpno1ap  mivtl(fa2rr(r nu4olxn oeiat sDemuvs t0 etrxf tatfpDrlueilt truo(r ou4lltnmfciatfaDtrurpoo0tltoii3iysfsDemums t4 rxrio tytlm   neolt) 2xrxm nu1opeemnvils) rururo;o1oltnmf3iadfmDrl( snu0tlxrircoydfpDelneilt)teuoir ny1op nliviatfarta(ront0alen octad s ra(vo;()trtoio3totlateau o;()srumxo ny1alt lfesas)aDrrur ot1aexoifetys a eanvs;u0aexoifciadla rlivsl(  ruoio3nu1opee net s artr(m no1oeto i3iad a um( snu4trtnxr3iotom   i ilt0sruoxo oo4apeemicia(faDra(rpnu1texn ietad s2uau o;u0 ltrmo oa1oat lneslt seumir3oo1opt livtat)sDtaumooo1tpen ieiydfm rlnvsn()tetrmfciadla  li slt)srxm(r ou1ome mnesl(farumxmpnt1ope  i3tltfsDum(vsnt4trermr3ty1opte neo;s  rtr(rpiodll nmnvtl( arumump;o0tex iieiys sDum(mo;t)texrmo oa1fpDelu s t teumio nu1om   nvt (fsDum(ro;o1oltoiociydfm2ua( pn(4trxrxo3ta1lateanvil() etoir ny4ope lnet tf rrm( p;o4opxo feiltfm2em(msn(4 rxrmr iydlptr nvsl( teum(rpnydamenlncia(f 2raxmpnt1opeo ocildfmDrlu o;() etnif3iy1omteauei s)sexm(rpio4alt lnvt s  rraxroou0aex iociysfsDemnmp (0trxnir iy1lptr ueo;(  2toxmpiy4am  lnet t)srrau  no4aee mfeiadlsDuan on(4aetnmr3tydfa elueilt)trxmir nodape lfvils a2rr(r nt1aee mociadfm2rmn pnu4aetnmf3oadfa  auesl(  2urio nodlltelnci ()a2rmu o;t0alenioctlslm ua(vp (0alxriociatla rli o s)s2trimpio1lm n fvsat)arrr(  nu0oltoif3tyd s rmu snu4alxrmfcoydlmDran o;t) rxrxo3nu4lp emnei s aDtau p;u0oexo o3ilsfmDul(mp u0 ltrmo tatoaD li sls seurxopoo1opte nei t aDrm( pou1tlxn oeildfm uan o (0tlxoirciotfaDrluvilt) rxm(o oo4opee feslsfsDtrx  ;t4tleo i3ild m2emnvp;t4 ltnmfcoodfaD lu ol(0s2xoxmpiu4openmfeia()sDua(r nu0opeomfctyslaDem( s (4tltnmo oy1fpD lnvslt teuo(r nudll  lnetat sDur(  ;o4apeomf3ias a eauvo t4trxnxo3oadlm eai i;t0 2um(r3nu4om nmfetas  rrm(monu4oexo fcias s el(mo u4artnircoo1om eaieo;s)trtmim nydopt liesls srumurp;u1openioctas a2rmnvsnt4arxoio3iotfmDeaiesls0trtoio nu4om nlnvsltfa2urxmo;t4tex  o3ildfsDrlnms;t0 rxrmf io1omtr ieol()setrxo3oudape lncslt)s2rrumonu4alxnmf3iadfa2rau snt4 reoir3oo1oate n sl(  exrxrpio4lmen icsls) 2rrxr ot0apxomiciyt mDea(mp;t4 etrmf oy1lpD  ivi (0s2tm(mpoodomen ivslsfaDrmumpoo4apx ioetydfm2umu snu)treoxo3iydla e i s ( srxrir nydal emncsltf 2urxr ot1aptnifciat m ra(mp;t)teeoxrctotop rln s s)srtmimpoo1ope  ietat s2rmu oou4aetoifctlsfs2eln o u0treomf3tatopD au o;t) rtr(o3no4ap emivtas aDrau  ot4olen fetydfsDum( o t0 lxrir totlatrlnvi s0seto(opoo1amtnmfcsa()arrmumo;u4tptnmoetasfm2eanmpnt) etrir3iotfmDe ies s0 euo(opoydale liviat srum( oot1open oetltfm ua(mo u0alxomr ootomtrlieols tetr(o ou1lmenlivs (  rra(mooo0alxnmfcilsfm ul( p;t4tltomf tadfptelieil()srxrxm nudapte ncsasfsrraxmpnt4opto f3iad m2um(vont0trtnxo oytlp  lnei;()s2uoirpiodlpe  nci t  Drmu  nu0alxo i3tys sDrmn s t)arxoifctydlatean i;t seuoimpoy4apt mivt () rur(m ;t4tlxniietltfa2ua(ms;u) eeoxfcia1fmDrliei s0s2trimpou1olenmfcsasfa2tr( o;o4alx  iciydfm2um(vsnt4 renmf3oydlm  lieol(0teur(o iu1omen nes (faDrr(  nt1teen o3ild s2uluvo;t)aetrmr3tatlpDraiei t0 2xmio3iodome  icta()aDua(ro;o4tee mi3tadlaDrl( p (0 reoxo ta1fmteau o;t0s2to(r3nu4oltelietls s2raurp;t0aptoiictltfa rmu s;t)aleoif oytop rlneol(0s2xm(r3io1opeelneils)arrru pou1tpx iictlsfa rauvs u0texnif3iatlpDrln o ()s2tmxopiudolenmnet ( s2rau p;o1apx  ieiad s2uln pn()texnmo totopt  nvolt teurxo ou1olenmnei (f Dtau p;u4oltomfeiadfm rln snu0trxrif3iotomD  ies t0s2tr(rpoudlpt mnetlt) 2uaxrpoo1tlt ii3tadlm uluvo;(4trxoir iytoaD  ivilt) rtmxm oy1ol  mici sfsrtmxm ot4aeeomieiaslaDemnmont) exrir oadop e i ils0sexmio iy1open nes t)sDtmx  oo0altn o3tldfsDrmnmp t4aetomrcia1lmte u o s0trtm(opiu1al nlict s s2rmurp;t1oet  oetysfm rlumo t0 lerxo iatopDrau ils)t2xm(opoydolenlfctl(farrrxro;o0aee iociydls2umnvsn(4 eerxo iytfaDe ieolt0 rxmxr3iu4lme  fci s arrm(m ;o1tpen ocildfs uan pnu0tlenio3tydfaDeluvsl() 2toim3iu1ap elnvtlsfaDua(mo;t0apxnio3iydfa2uanmsnu0 etrif3todoat  ivs;t)srxoxmpiy1ole mivt s)aDtmur no1tpxnif3ildfaDemn s ()trerio oytfm elues () rurxopiu1amee fvsas)a2trurpnu4tpt  fetydla2elu o (0 eermo3ootfm e i o;(  ruoxrpou1omtemfct (faDurum no4aetniicias m2ra(vp u0arxnmfciy1fptraneo t0trxm(m3no1lmtnlfvs s) rrax o;t1oee iietatla2umu p;u)arenxf totopDrlies;s) rtrxm3ny4alte ivtas)s2umxrpot0tptnifcildlm uan p;u)trxriocoy1fm  ln o;s srxr(o3oudlltelnei t)srrrx pnu4tpx mfciasls raumsnt) etoio ta1lptrln ols0 exr(r3oodomen fctatf Dtmu  ou0aeen iciltfa2ul( o u4alxoiociydomDr ues s0srum(o oy1omenmiei (f 2raurpno4oeeo ictat mDelu pn(0altnmf iy1opD li slt0t2xr(mpoo4aptnlici ()srra(rpou0tleniictytlm umuvp;(0alenio iodlmte u s s)tetrxr3iudlm nlictasf 2rrxm ;o0aptnii3iytlm2uaumo;(4 lxoir oo1fm e i i s tetrxm no1al e feias)a2umumpnu1aleo fctas mDranmp ()arxnmoctotopte uvol(0srxo(o3iodaptemnctlt)srrm(r ;t1aleoiociydlm uanmsnt4 lenxo3todlate ivs s)seurir3nydaptnlfesa( aDuaxmpno0tpenmf3iadfsDelnmpnu0arenxf3iodoptraies;(0srtm(m3no1lmt  fciatfaDrax oou1opx mi3tls sDelu o;(0texomr3ty1laDean sls  rxmim nodlmtn fvsas)sDrm(mo;t4tpe  f3iaslsDum(mp u4trtomo ta1fat  ieol()s2to(rpoydomtnlieslt srtrxm no1open fetydls ul(mo;t0trerxfcio1oa   nvs;s  etoxrpnudlle mnci s) 2rrxmoou1texn ieildfa rmu p u4altrmoctytop   n i;s0s2tmimpnydamt mfvsa()a2tr(m ou4openmi3ils aDranms t0 exomr tatfpD  iei;s0srxr(r3oydomte ivtlt)s2rru p;o4oeto ieiatfs2rau onu4 etrmo3oatfp eaiei (0 etoxopio1am e neiasfsrumxm ;o4olx mi3tlsfa2umn p;u)arenmfciydla rluvi;t0srxoxo3io1altnmivs t  Dtrxmp;u1tlto i3ildlm2rl(msnu4tetrmf3iotopDe nvsls0sexrxm oo1apeelieia()s2ra(  ;u4aexnioeiyt a2rm( o;u)trxrio oo1oatr i s t)trtm(r oudapt mncias sDta( oot1alxnioetydfmDemnmp;u4trenxr3tydfmtr uvo s) eto(r ny4lp   fcsas)sDumxrpou1aeto i3tldlm2rln ont4 eeoio iodopDr ivs;s) 2umxrpiydlm   ici s)aDtm(r ;o4tptomicilsfm2elnvo u0trxniociodlpt livil(0srtmxo3ou4lltn iviatfsDumur ou0olto fctysla2el( s;t0 etrxf3todfa   ieo (0 rtrxmpoy4lm elfcsl(  2raurpou1opxoifeilsfm2uanmp;u)tetomfciy1fpt ai il(  2xo(opiy4om   fcilsf Dtrx oou1olxo fcilt s2ua(vs u4trtrmr oa1lp r u sl() 2xrir oodameemivtltfs2trxrp;t1tpeomi3ilt aDran on()alenmf ty1lp eanvi ()srxoxmpnudoleemnciltfaDuaumoou0tlxnmfciydlaDemnvs;(0alxoio3ootlmte i sls0sexmimpiu1op nlfesat)a2tmxr ou4tpxomocils sDemnvs t) rermrcoodom eaivilt)sexm(o oy4ap elivias s2tm(ro;u1tleniieiadlsDeluvo;()trtoif oodfaDeanvs;t)srtrir io1om elfetlt) 2um(mo;o4altnmfeiadfaDeluvs u4 rtnxo3oydopDr uvo s sexr(m3iu4lltemicsa(f rra(roou1alenmieiatlaDrlnmpn(4aetoxf oo1fmDrliesls) ruoio3oydom e fciat)aDtm(m ;t0tptn f3iltfa2ulumonu)aetrxrciotomDeau il(0t2xmir iydll  lnvilt) rtmxm nu1teen o3ils m2uanmsnu) reoxf3ia1fmD ai sl(0 rtm(mpiydop  mfcias)s2rr( o;t1aeenioctls a2ra(mpn(4texnmf3iodopD li o;s srumimpnudomee nvs (f Draur no4tpeniociasfmDeauvp ()alermo3to1la  lneslt0s2tm(mpny4alen nvtl( a2ua( oot0aleo ieiadla2umums u4 ltrmfcoy1fp e u slt) eurxr3nu1opt mncs t  Dtaxrooo0optoiictyt aDumnms ()tetoxf3oydfaD li s;(0 ruo(r3iy4ameelfvslt) 2urumpoo1olt mocilt aDem(ms () rxrir tydoa eanes;t s2xo(rpny1ll n icsasfsrtaumo;t0tpxnioeiyd s ul( o t)trtniocoy1laDr uvsls0 rur(o ou1ome  nei (fa2umu o;o4apt  fctydlmDrlnvp ()trtoxo tatop e ieo s0srtmirpou4ol n ncs s  2rmum ;o1alen fetat m2ea( onu)artnxf3tadoptr ivolt)teuo(r oo4oltelnei ( srraur ou0olxnii3iatfm eau s (0artoxociydlm ean ol(0s2xmir3iudlltnlfes (fsDrm(rpnt1olx  ociys mDrlnvont0trxnxrctadlpt luvsl(  rtoim3iudlpeeliviltfsrumurpno1aetnmoeiasfm
\ No newline at end of file
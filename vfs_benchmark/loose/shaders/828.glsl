@@ -0,0 +1 @@
+neo;s teuriopio4apenlics tfs2rrxmo;o1oetnif3iytls umnmp t0tltnxf to1fp e u olt0 etoxo3oodolt liesas)a2umu pou0tpx  oetytfm2ulnms t4alxrxf3oo1lmDean o;s0 etrimpiodal emfvil(f Draurpoo4tltoio3iydfa2ra(vsnu)texnif oy1fpD aivi t)trtmxm iu4lp n nvi ( sDrmur nt4tpe  o3iad mDum(von(4 lerio3oadfp e ieils t2trim oo4op   fci t) 2rmxmp;o0alt  f3iydlaDelu p (0treomfcty1lpte n s t) 2xo(r3nodop nmfes tf Dur(moot1aeeoii3iatla2uauvsnt4alxnxo3ta1op  liei s)texrio3iodlpee ictas) Draxmpot0tptoiieiydfa ean onu4arxnxo3iy1fmte ies;() eum(o iy4ome  fesat s2tm(ro;t4opt  iciltlm em(vs u4 rtnif3iadop e n s s)srtmir oo4ol n fvta(fa2ua(rp;u1aexomfetad m2rm(vo u4 rtoxo3iotfpDeanesls)t2trxr3oy4ope lfetas) 2raxmooo4aeenmfeiad a eau p ()trxnir todfm elnei;s)sruoio3oo1ll elfesl( sDtru ono4alx  f3ildfmDrluvs u0aetrmfcio1lptelu i t0tetrimpio4olt lnctl(  Dur( p;o4oexomf3ilt s rln onu)texomr3totlmD aies s)trtmxo io1am elfetls) rumumo;t1alx if3iysla rmump;(4tleomo ia1lat livs s) 2xrim3oydlm  lncs t aDtm(m ;o4tex  feiad a uluvpnt4 reomf3tytfa  ln ol(0s2toxo no1ol n nciat srumur ot0alt  feild mDuln s (0treoifctadfatrlu sls)tetrim3nodomt  nvs () 2ua( pou0apt ioctyd m2ua(vp;t) rerifctadop eanvo;t)tetoxmpiudllt mnei s  2rru pot4aptn ociytls rlnmp;u0tlermf tadom elu o;(0t2uoim no4ale mncsl()s2rmumont0aee mfctysls2raums;()trenxocoadom elnvs;( setmir iodop  lietl()a2raumont4apx ii3tadlsDua(vo;t) leomociotfp ran s;s0sexo(m3oo4optnmiet t a2tm(mpou1teeo i3tlt a2rlnmpnu)alxnxociodoa elivsl( t2xmxo iu1ol elivils)s2umumpou4tetomf3tysla eaumo;(0 rxrif3iy1lpDeau o s trxm(r3oo1amtelnciat  rtrxmpnt1ape mo3ilt a2rmnmp u4 leoif oydfpDeln o s0s2toxr3nodllee fviatf Dtmuro;o1tlxniieilsfsDua(mo;u4 lenmf todfp rlu i t0s2tr(mpio1lpenmnesas)artaurpou0tptn ociltlmDea( o;(0aexoxfcoadfat lnvs;s0trur(rpoy4am  lfcsatfa2rm(r ;t0oeeoioctys mDea( sn(4aeenxr3oa1lm eauei t0trurir3nudlp  mneiltfartrx  ot1tlxomoeiytfsDem( p (4artnmfcia1omtean s;s0trxr(m io1lmtnlnct (fsrrmx onu1ale iocils a2ea(mpn(4 reniociytlptrlies ()srxr(mpiu1op  mfvs t  2um(roou4alxomieildls2uauvo;u0tltnxo iotlatrlieo s) euriopiodlle  nci ()s2rax oot1apeoiociasfm2ra(ms;t) rtoxr ta1fa  ai o s)texmxrpiu4lm  mieta()a2rmumpoo4tpe  i3tatlm2elu snu)arxoio3todfpDe nvi;( trxmimpiydome mieil(fsDua( ono4teto ieiad m elu p (4 eeoif ty1faD ai s (0tetoir nudop  miesas) rua(m ot0olxn oeils a2ulums t0teeoxf ta1laD lueol( trxmim3no4lltnmfesasfaDraumo;t4oltomictas m emnmp;t4alxoirctytom  au o;(  exoxo3iy1lp e ivsa(fa2tru pou1apt ifctydls2ua( pnt0teenxr oadfptrlnvo;( texm(r3oo1al e netat) 2rau oou0ape ioctatfa2eaums u4teerxo oydoatr i sl(  2toxo oo1altemnvtasf Dua(  ;t1olx moctydlm uanmo;t)texnircoadopteaueo;t s2trim oodamt livtl( a2trxr nt4ale mf3ildfaDumn p (0teenxfctatlpD ai sl() 2uoir no1am   fvtl(  Durumo;o0tpt io3ils aDra( sn(0trxnifcootla eanesls) exo(m oodap elies t) Dtr(monu0aeeomocils m2rl(vo;u) reoirciodlptrlnei ()s2xriopiudlm   nes tfsDumxroou0tptomoeiytfa2um(mo;()teerif todfmt anvi t)trxoimpiudame lfet t a2trxr nu1tlx  o3iytlsDrl(monu4 exnifcoatlat  iei;()seurim oudoltn fei s)s2taumonu0oleomoetydls rm( o (4 rxnmr tatfptranvi s0sexo(opnydlme mnetlt)a2taumpno1teenif3iytls2uln p;(4 rermo3ty1fat  u i s)srur(o oo4lptn iciasfa2urxmoou4tet mfeiyslaDumn s;t4alxrmf3ootfmDrau s ( s2xmirpoydap   fesls  rtrxrono0oleomi3iltlm2ulnmon(4 etoxrciatfa e uvi t  exoim3iy4olt  fcta(fs2tru p;t0openioctytfaDulnmsn(0alxnmfctytfm ranvolt0 euoir3oo4lm   fct ()s2ta(r nt1alenioeiydfa2ulu p (4 ltrir oa1fm   ivi t)s2toir iu1oleelfvslt arrm( oot1oeeomoetls aDuaums;u0 eeoxo3to1lp rli s;( seumxopou4lmte neia()srrmx  ot0apxo feiatla2ea( on(0trtoifciatoatraneo;( tetrxr3iy4lmt lfci s) Dtr(r ;u4olx ifciys m2uluvsnt4 exoiociydla   uvi s0 2uoir iodoptnlivt ( s2tmxm nu1open f3ildlaDeauvo;t4texoxo3oa1fpD ln i;s)s2xr(o3oudomt lfct tf rta(r ot0opxn iciys a2ra( p u)arxrxf oydopte u s s0sexr(mpiodole mnesatf rra(rono0oetomietysfm2el(vs;t) lerio3tadoaD ai o s)sexmirpno1lm e nei ()sDtmxmpou4olx mi3iys sDemnms;u4teerxo3tydlmtrauvs (0 2to(m iy4alenlncta()s2umx ooo1alt  feiltlsDelumsnu4 lermocoadlmtrlieilt0t2trxm nydamee icsa()artr(rpot1aeto fetld s rlu p;t0trxnmf oatoa rau s (0 rumxo3nodolenmnes s  Dtmu p;o4tptoio3iat s elu o t4 ltrxrciodfpD  ivs;t) etmirpnu4oleelnct sfsrrrxroou1ope mfciydla rm(msn()trermr to1omteliesl() rxrxo nu1al n neta()aDta(mp;o4aexomieiatls2ea(vp u4 rtomr ta1omtrau s t) rxo(r3ou1amt licilt)aruau  ;o4tetnmf3iydfm2um(mpn()treoio iadfpDranvo (0srxr(rpiudaptelnvtasfa2umum nt1teenmo3iad s2emuvp;(4 lxomf3oadoa raiesls0texmim3iydapt micsa( srraxrpnu0oetnii3iytla2rmn p;t0 reoxr3ta1omtrlnvo s  exmiopno4llt mfcsatfarum(rpoo4tpeo f3iydla rmu o (0 exrmf3iodoaDe n i;s0trxoxo iudlm e nes (fs2ur(ronu1tle iietltfa2rm( s (4 eeomf oo1lp eaivs;t texmim3iy1om  lnet ()arurx oot0apxnmoeiysfa um(mo;(0 rtrxocia1faDeaivi;()trtr(opiy1lmtnliei (f Drr(moot0texo oeiyt sDemu onu0 lxoxf3iotoatrluvil(  rxrxo3oy4aleelfcsl( s2rrx ono1tlt if3iysfm ua(mp;t4 rxnio iadfa   u o;t)srtmxrpnodlltn fciatfa2ua(mono4tlxnioeiysfs rmuvp u)alxoxo3tatlpt aivi (  2xo(mpoo4ap emfcs t) Drrumpou4oeeoii3ildfsDranvs;u4 lenir tytoptrau o t s2tmim3oudomtnmfet s)a2rrxmo;u4aee  fctatfsDra( snu)trtrmo io1faDeli o t)truoim3no4olt mictat a2raxmoot0aetomfeiyt m elnvo u4trtomr tadfaDeanei;t) eur(opno4om n fet ( srtrx ooo4aex  fciytfmDumn s;()tlermo3ootom rauvo;t0 eurim oy1omtn ivtas sDrrum ou4aeen oeiytfs ul(mo () reriociydfp rlu s;t)s2xrir io1oltnmneslsf rta(r nu1opx  o3tydlsDel(mpn(4alerircoatlpteai o;t  exm(m oy4ameemiesls a2trurpoo4oex moctadfaDrlumsnt0tlerio3ty1latraueo s0 exoxo3iu4oltemfvsa(f 2rmx  ou0texnmo3tytlm2uluvpnu4 etomfcoa1lpD anei;()setrxopnodll   nes s)artm(mono0tet  oetys aDua(mo;t0texnmf ta1lmte nvo;s s2toxr iy1lmt  iet t) rtrumpnt0tpt io3iydlm eau onu0arerxf oy1fm e n sls)trxo(rpoo1opeelneils  rumx  nu4oexnmfcils s elumo;u)tetniocta1fpDelueo;s0srxoxmpoodlmt mnct ( srtr(m oo4tlxomoeiysfsDra( p;(0 lenxocoatomDr nes ()seum(opoo4al nlfeslsfs2trurp;u1olxnii3iltfa ea(msnt4 exrio3iotfmD livol()setoir ou1lm nlfesl( sDrruro;o1optnif3iydfa2ul(mo;(0aleomoctodfpDrlu sl() ruoxm iy4op nmnvtl()s2tmu  ou4oltnmi3tadfaDemnvo;(4trxnmr iytop e n ol(  2xmxo3nydomen icsltfaDrr(  ;t4tlxomictydfm2uan o;t4tltnifciotfpte ieols  exo(o oy4opeelfesl() 2trxmp;o4ape  ieiysls2ua(mo u4aeermf iadlmD aiei t) 2ur(o3oydolteliciltfs2ur(m no0aet ifcilsfs eauvs (0arxnmf ty1lmD livi;t0 etmio oy4lmenlfcilt aDtr(r nu0opeo i3iltls uauvs ()trtnxf to1fp r nvo s0 2xrxm3oydal n iesasf ruau p;o0aleomiciad s2elums;() rtrmr3todla  auvs ()t2uoxm oudomen ict (f 2tr(r no1aexn fctyt sDrlumo t)arenxo3iytlptraneil(  2xmio iudopen fvia(fa2ur(  nt4aetomoctytfmDel(msnt0 eerxr3oodomDrli sls) eum(o ny1lp  mnvsat aDum( ono0oetn i3tas m rmumsnu) eermrcoytfm eanvo;s0srxm(o oodome lnesat aDuaxmpno4open iciydlm2ran p t)artoxocoadomteli ils sruoio io1lp e fcia( sDtmx ono1texnmfetlt a2ranmo (4teenirctytlat auvi t seumxmpiu4lm  mfct tfs2tmu o;o4oleomf3tasls2rmn s u0texnmf totop r n o;()t2xm(m ny1ame  icia(  2urxrp;t0oleo ictls sDelnvon() leomocootlatelieo t0t2trim oy1omtelfes (f ruaurono4olxn fetat s ea(vo t)teeoxo oytla rlu ilt setrxmpno4opte ictatfaDtmum ;t4tex moeiytfmDrau s;t) etoxociytlpt livils0srxr(r3io4ap emnes s) Dum(  ot4openifeiyd s rlnvsn() lxoioctatlat lu s;(0 exoim ou4lp nmfci t sDrau  oo0apxnmf3iytlaDra( pnt)artnxf3iytom e n s;s s2uo(r3nodalenlivsls)s2raxmp;t1tltniiciltfm ul(mpnu0tlxrmo3iydlp   nvo s)trtr(r3iodop  lfvsls) Dtrumoou4optn iciadfaDum(vs;u4arenmr totlmt livi ( t2xmir3iu4opeemneil( sDur(rpnt4teeomfciasfs eanmo;u4 lxoxrcty1opD  i o;t0 2xr(r oy1lmenlnetas srta(ro;t0opxnifeiydfsDrmnvo (0 lxrio3to1fa ran i;t t2xrio3iodlmeemfcsa()sDur(roou0aet  ociltlmDuln pnu4alenmo3oodfm elneo t0s2toxm3ny4llte iesl( artmx ooo4olt moetad s2rau s (0 lxoxf3oydlp  aiei ()srxrxopoydapeelivsas)sruru  ou0opxniocilsfm2umuvs u)arxrxf3iytfaD li s;s  rxoxm iu1aleemfvs s  rum(rpot4aeeomi3ilt m2rm(mp t0 rxnifcoadfp  luvo s) 2uoimpiydlltemnviasfsDtaumpot1oltnio3ias a2eau pnt)altnif3ia1optraieols  rtr(o3nydop elfetl(f ruaxmo;o4ope  f3iltlm rlu s t0tetnxo3oytlmD lneil() etr(r3oo4om  mneslt)a2ururpoo0alenmo3tas a2ea( p u4tltrmociy1omteanvs ( s2umxm oy1amtnlnvi () 2tmx o;t1aee mf3ilsfa2umnvs t4tltnif3ta1fa rlnvol() etrxopiy4apeelfvs ()srtaurp;t1ole ifciad a rm(vpnu) rtnxf3iadlmtr ueo;() exrim ny4lltemfctl(fsDtaxm ;o0aeenmoeiat sDulumo u0 rxrif iadlaDrln o;t0 etmimpnodom  lfei sf 2uaumoou0tptomoeiad m eauvs u0texrir tatopte uvs t t2umio oydlm n ivias  rrax  ;u0oeeo fciltls2rlnvp (4tetrio tydlpDr ivs;s trtoxr3no1al nmivi t  2tmu  ;o4alxomf3tytlm2ra( snu) leoxf3iadfpt  n o;t0trtrxmpny4lpeelnviatfaDtmxm oo1tlxnmi3ilsls umuvont0tlxoxfciy1faDeluvi t0t2tmxrpnu1ol nlnvsls  Dtru p;o1tpeoiieiytfaDuanvo u) rtnio3ty1om rli slt)trxrim nudll n fet s)aDrmxrooo4oexomictydfm eln o;t4 lxrxo3totlp   n o t) exoim3iudllenmnvtas)aDtaxm oo1olx mfciyt s ua(vp;() exrmo tatoat  nvo;t)trxoxrpoo4ll  lnctatf Durxr ot1aetnii3iadfsDuaums u) lxoif oo1fpD  nvo s)teuoxr3no1oltnmnet ( a2ra( oot1alx iociadfm umuvpnt4 rxnxfcoo1oa eln olt0texmxr3nudlltemietls arrmxrpoo0apt mo3tydls ea( s (0tltnmo oydfat  i i;s s2uoxo3ny1ll   nvs (f Dur(r nt1altomieiyt sDel(mont)trtnxr oatlmtr i i (0tetr(r iu1lm   fvsl(f rrrxmp;u0tleomo3tyt mDrlump;()aleoxfciytlm  lnvo s) exrxo3no4op n fcs ( sDra(r nu1apt  i3iys mDum(vsnt4trtrxr oy1lp   u sls sexoxopnu4ol n ics tfsDrmx  ou1ope ii3tas s2ulnmont4aexnir3iydfp  aivo;t) exm(opou4al  mfes ( sDua(rpnu4opxo fctyt s2em(vo () eerifciy1fp elu s t0seto(o3iydlm n feil(  rtaur nt4apeoii3ilsfm2emnvs;u4 rtoxrcia1laD lnvo ( tetmim3ou4lm elfvi tf Drmur no1apx  ociytfs rlu sn(0 lenxf io1oat  nei;s)sexmio iu4ol n nesat)arraxmp;t0olx ii3iyslsDumn sn() exoxo3oo1omD  nvols)s2xoxm3oy4am emfvil(fa2umxrp;t1olto feiysls eanms t4altnxrctodoate u o;s)teumxm oy1amen ies t  Drmur nt0tlen oeiasfs2ua(vo t4 exrio totfa raivols s2umxo3ny1om nlfvta(  rtmx  nt0alxnif3tlt sDemn s;t4altoif3totlatr n i;(0s2umxr nudam  lnci (fsDtrur ;t4apenii3tld m2rluvo (4tltoxr3ia1fateaieil(0 exrimpnu4al elieil( srtr( pnt1aet io3iasfmDuaump;t)arxnir iytfm raieo (0t2toxo nudapt  fvia(f Dtau  oo4olx ioeiys mDrmn p t4 rxoxr3oodlaDelnvo;() etmir oy4alenmfct s arrrxrpou1ope io3ild m emnmont)arxnir oodomtelivi;t0trxmxrpno4lm elfvtatfaDum(  no1open ietytfaDelumpn(4altnxo3iotoa  livo;()texmxr3iudllt mnvs s)arta(mpno0olt mfeiatls ra(mp (0 lerxr tadfatelueo ( t2um(r3nydopenlfesl(  Dtrum nu0tleo f3iyslaDemu s (4tltoxo tatfpDeauvils0tetr(mpnu1lmtelnvta( a2raxmono0ale mictyt m rln pn()arxnir3totomtrliei () 2toio3ou4amt  ivtas)srrru ont4aet  oeiadfaDulumo;t4alenmo tydlpteaueolt0 exrxr nodllen ieil(f 2urxm ou4altnmocias s ul(mo;t)aetnmr to1fpDelnvo;s)setrxo3oydap  mneta() Dtmu pou0alxniociaslm elumont) rtrxf3oodfmt aueo;(0 ruoxrpoydlleeliei s s2uaurpou4tpto o3iaslaDean s;(0 lxrmf tytlmDrau i;(0t2tmxo iydlmeemfvs ( arur(mp;u0tleo fciatfaDem( pnt4trxomr iodlatr ies;s seuoim iydlp   ivil(  rua( o;u1alt mf3tyd a2ra(vo;u0aeeomo3tytfatrlnvi;s t2uo(r3io1ape mnes ( arrmxmpno0aex moetad m ulump t0texnmfcoatop ranvolt0texoxr oy1alen ncil( a2trum ot0aptoifeiatfm uaump t) lxnir oadom e nes ()teur(m nu4aleemncias s2rr(ro;t1tpto i3tytfsDrln o ()teeoif3iy1om eanei (0t2tmxmpnudlltnmieta( arrmu p;u0tpeniiciaslmDum(msnu) exomrctodomD ln i (0srxoxmpoy4apenlnes (f 2tau  ;o1aleomociltfm eanmsnu4 lxnir oydfp rauvo t)s2xmim3iodalenmnvi t)srtau pnt1olxomieiaslaDem( s t4alxrmf3oydoptrau i;s trxo(m3oydlpte icsltfa2raxmoot4opeoiociydla2rmuvp t4trtnmo ty1la rli sl()tetrxm iu1omee net s s2tau  oo0tpe ifeild a rlnmo t0artoir oa1lmt ln o;t0trxrio iy4alee ivtat sDrm(mpou1oeenmictadlm2ea(mo u)trxrmfciytlmD livol()setmio3nydlltnliei ()a2rax o;u1ole ioctld a2uanvs;t0trtrio totop  ln i;(  rur(r3nudomeemnesl( a2tm(rpno0optnii3iatfa2rmuvp;(4tltrxocia1lmt lnvi;s trxmxmpny1lp elics s)a2rrxr nu0apeoiicild m2rlnvs u4altrio oodfa r nvi s) 2xmxrpiodlm  lfct t  Duru pou1teeo ietadlm rlu pnt) eenmo3totoaDe n ol()texrio3no4lpt  ieils)arur(rp;t1tltn iciydfm2rl(ms;(0 eerxo3ia1fatraieo;s0s2ur(r nydapte fcsltf Durxmpou0alxo feilsla emn s u0 rxrmr oydoa   uvi t texo(m oo4oltnmfeias)sDtrumo;u1olt  fetaslsDumnvont) exrmo ootlaDeau il()t2xrir3iodolte fvtas)aDtmu p;t0oetoiocild sDuluvsn(4aeenmo to1lmDrlieo;t0trur(m3io4ol  mfcsltfsrrmxrooo4tet miciyt a2rau s;t)arenmo3tatlat ln slt) rtrxo no1ol  liesa( artmu  ;u1opt micias m eln o;t4trxomocto1fatrlieo t0t2uo(m oy4open iviat srtr(mooo1oet if3ildfsDuaump;u4arenmrcoatfm r i ols) 2urio ny1op   ies sfsDtrxmoou0aexnioetadls eau snt) rtoxf3oadlatelivsl(0trtrxo ny4amtnmnctas)s2rrx p;u1oee  oeiasfa2raums t4 etoif3oytopDrai s s0t2to(o ny4lmenmfciasf rtaxmpnu1apeoiicilsls ra( sn(4 etrxo oo1lmDe nes t) euo(opio1lpenlneias)s2urxr nt4aeto oeiadlmDrm( p;()teermf to1laDraivo;t0teuoxo3iu4llenlivt t) Dtaxm ;o4tlen iciasfa ulnms;t)tltoif iy1omDraieol(0srur(o nudalt mfcsatf rur(r ou1tle moeias m eau o;()trxoxo ta1fm rai s (0 2urxopnu1altelncia( a2rr(  ou0apxnifcild s rm( o u0 rtoxr tatoate ues;t trxm(m iu1lmeemfcias a2umu ono4olt  ociyslmDelumpnt0arxrio3oydlateluvo ()truo(opiy1lp  licils)a2umum no1tle miciad m2eluvpnt)arxoif oytlpD aiei;() 2uoir no4ol e ivsltfarrm(mont4oexomieiaslm2rau p;u)trxrmrcoatfpDrlneo t)trxrir3nodapenlfei ()sDraxro;t1alx iieiytfa2rmnvo;u)treoxrcoydlp raivs;(0trxm(rpio1lmt mnvsas aDrrxront0tpt  i3ils a ra(vp (0alermf io1lp raivi s trxoiopoo4ap nlfvsat sDurx  ;u4opt  octytfm rm(mo t)aleoxfcoytlateaies t0 2tr(opoo4om n feil(  rrrx pou1teenmfeiys aDuanvsnt4 ltnifctodfmDelieo;t0 2xoir3nu4lptemfcs s)srtaxmoou0oexn ictltfa ean on()texnif3io1oat  ivs;s0 2xmxm3ou4amt  fvils) rrmur ot1tex mfeiytla2eanvs t0tltoxr tydlaDeluei t0setoio nu4omte fetl(fsDua( ont4opxomi3iydlm2um(vs;(4alxnxrctotfmD  i i ( trxrirpio1op  liciat sDur(ro;u0altomfcild m uan o;(4trtrmfctadlpt lnvo;s srxrxo3no1ol nlfcta(  2trx ooo1olenmfetlt m2umnvsnt) eeomr oa1op r ivo;s)srtrxmpoo1lp nmieslt arumu  no0altn iciadfs uan snu0trerio iatom raivo t  rtr(rpoo4open fvt s)srra( o;u4tpeoifctas aDuanmpnt) etnxo oy1laDe nvs;( sexrio ny1lp  mfet ()a2urx o;o1texomf3iaslm um( s;u0alerxf3oo1oatrauvs;t0t2to(mpio1lm emnvtasfs2ua(mp;t0teen i3iydfm2eanvo;t4 eermfciydfptr ues t s2xriopny4ap nlfct tfaDtm(r oo4aetn i3ils mDel( p;u4texnir3oytlat lu olt) 2urxr3ou1aleemnetl(f Drm( p;u4tpe ii3iyt s uanms t4 ltnir oytomD anvsl()s2um(o3oo4am nlivi tf 2raxmpou4tpx  fctysfa2rm(vsn(4arxnircoodla eaies s0trtrxmpou4lpenmfcil()aDta(rp;u1apx  feiadfa raumsn(4aetnif3tatlmtr u i t0teumxo3ou4ol  lnctat) rtmxmonu0tetoio3iys m rluvont4 etnxf oydlat an i t sexoxmpio4omte ivsas)a2trx onu4oet  o3iyslm ranvp;t0tlenxfctotomt  nvi s)srtmxm iy4ol e feia(fsrtm( p;o0tee mfciys m umn s;u4aleomoctytlp rlies;(0trtmxopno1lpt lneils sDrrxroot1tlxoio3tlsfaDem( p;t0artnmo ootoptrai o t truoxo iy1ll elnvsat  2raxro;t0ale mo3iydls raumon(4trtrmr iytlptrlnei;s)trxmxr3nodllenlieilsfs2raxroou4alxniocils s emnvpnt)areomocoy1lmt aivslt tetmio3oydll eliesls  Dtr(  oo4teeo ietldfaDum(vonu4 rtrif io1oaD  ivsls0 etmxo3nodamt mncil(f 2ta( p;o1tpx iieiydls ul(vp;t0trxoir tydop raneilt0srumxo3oo1opeemivtatf 2tm(m ;t1aex  ietld s2rl(von(0artoxf3totfmteau sls  rxrim3iodlp  mneilsfs2rrumpoo0apt iociytls2rau s;t0trxnxrctotfmt li o s s2xmiopiu4omeemivi tfa2rm( ont4tet  feilt m2ul(mon(0teeoxrcoodomte ueo s  exrxm3iydoptnmfciat a2rm(rp;t1ale ioctyd mDranmp;t0 leoxr oydomDelu i;s  2tm(o3ny4olt  fcil( a2taxro;o0oet ii3iad s2umuvont0tetnmrcootom e i s s0srumxrpnudlptelfcs t)aDumum nu0aet mf3iasfs2rmuvp u4 lxoif oydlpDrai o t0srxrxr oo1lptn feil(fsrtmurp;o0olt moetyd s2ul(vsnu4aexrmrcia1oa ranvil() 2umxo no4am nlnciat)s2rmum ;o1oetn ocias a umnms;(0arenxo tatlpDe nvs;() eurir3ny1op nlfes tfaDtau pnu4ape ii3iysls2uan pnu4aleoxo3oo1fp   ivi (0 2umxo3nu4opee fes () 2rm(rpnt1alxnmoeiasfa rmnms;(0artomrcoadlaDrlu slt)srxo(rpoo4omtelfvtlsfs2tm( pnt0opxn f3iytfsDranvs u4aeermf3io1opDeli sl()s2triopoodaptnlnesls)aDraurpnu0apt ioeiytlm2ulnvp t0 rtoio iydopt livolt) rtmxm3nu4lp e nes s)s2trx  ou0oeto oeild m2ulnmsnt)areomr totlm e n s t0 2uoio oy4omeemicsa(fs2rmu onu1aexomfeiysfa2rmums t) eeomo tytfm   ivil( t2tr(rpnodlmtnlfvt tf Dumu  nt4apxomf3tadlsDemn s u0 lermf tadlmDrai o;() 2xrim3nodlltelfeils)sDtm( oou0oex  feiydlmDeln p;t0 lxnif3iadlm  an il(  2tmimpnudopeelfvilt)sDtmumont1oex ioctaslmDeauvp;t0 rxoxoctodop ranvsls0setrxr iu4amtn nvta()s2umu pno4oeenio3iyd mDra( on(0aeerio3totoaDranei;t)s2uo(r iy1lme  nes s) 2rrxront0tpxnmf3iydfa ulumon() eenxociytop raiesls0t2urxo oo4lmt mnvs s s2uaxr no1tpe mo3iad sDrlnmpnu)tlenif oydlpte i i t) ruoxmpiu4lmtelieslt)sDumxr nu0oetoiieiltlm2emn o;(4tltniocto1lm r u i ()trtmio nu1ole lfvslsf rtmumooo0apx ifeiasla elu sn()texrmf3iodfa rau s;(  rxmim io1am e fetl( aDuauronu1opto o3ilsfs ranmon(0aexoio3todfm e ivsl(  rur(opoy4lm   fcs sfsDua(rp;t0aleomieiltfs2em(ms (4 rerir3totfp r ivsls0t2umxo iydalen fvias  2tmxmonu4opx  o3iydla rau sn(4aetrxf3ty1fmte ivi;t) rto(o nydlpee nvil( sruaurpnt1tlxn i3iydfs ua(vsnt0aeenifcoytoaDr u o ( teuoxo3iy4lltnlivs t)sDraum ot1texnmoctaslm uanms;(4arxnmr ty1oaD lueo t)t2toxrpio1ol   ivt tf 2ta(mo;u0oexoif3iyd s2umu p t) renif ty1omte nvol( trxr(r no4lpe liesas)srta(m ou4oee ioeiytlm2emumo u0alxrio ootoptelieols  2uo(r io4ll n ieilt sDur(r ou4tptomi3ilt mDum(msnu0treoifcoy1fatr n i (0srtm(o3oo4amt lfctlt) Duax p;u4oleo ictld a uaumpnt)trtrxr3oadlm e i o;() 2xmim oy4amte iei ( aDrm(m no1oetnmi3tatls2uau pn()teenxf oytoaDeaivo s s2urxopoo4oltn fetatfaDra(m ;u1aex  fciyt aDemnvp;u)tlxnmfctydfmt ln ilt0trxoirpou1omtnmivil()arumxrooo4tltnmfctatls2el(von(0aexrxf3todomD anvsl(0seuo(mpny1ole mfeslt aDua(mp;o1teen ietysfaDra(von() exnmo3tytla  lnesl()s2toxrpiu4lm emicsl(farra(r oo0alx mocias sDea(vsn() lxnxo iy1om r ueol(0texmimpou4op n iviltfaDtru ono0apenmieiadfmDean pnt) reoxo ia1fp eanes s) rxmir ny4ap nmivtas)a2ua(r no1aeeo feiydls2uauvo (4aetrio oa1fm ean i;t0srtoxm nu1ap e fcsatfs2rmxm no0tpxniociydls2elump;(0treoxociydomD  ies s0 2tm(m3oydomtn iciat aDraxmpno4altomoctys s rmn sn(0 rermf3iadfmDeln i;s)sruo(o3oy1ol emnvt t)sDtmurpnt4aeenmfciatfa uln s (0teenif3tatop   ivol()s2trxmpiudopt mfeias  rraum nu4oexnmieiytla2el(vp () etnmr3iotlmDe n slt0 ruo(o nu4am e ivtltfa2tmxrp;o0teto fcias m el( ont0arermfciadlpD  uvo;()seuo(m io1altnlictlt  Dua(rpno0tpto f3iad m uanms u0teeomo3iadoa  lnvi s)srumxr oo4amtemiei ( s2taxr ;o0tltnio3iaslaDelu o t4 ltoir ta1fmt  ivslt  rtmxo oydope mfcia(fs2uau  nt1oetn iciydfa2eln pn() eermrciatopDe ueo (0teum(opiu1om n ictl(  rtrx  oo1tltnmi3tls s rm(vp;u4 ltrmr ta1fpD  iei;() rxo(r ny4om   fci t  Durxr ;o1alxo ietad m2ulnmo;(4trermf3todlaD lieo;t0srxoio3ou4ol   net s arraxrp;t1apx  ocilsfa emums (0alxnio iytlm eauvo;s0 2tm(mpou1omtn nviat)aDtmx  ou1oleoifcildfs2rlnvpnt)tlxrmo oa1lat  i o;(  2xm(m nu1op  mivsat)aDtm( poo4tpxn i3ildfs2umuvpnt0trerircoytfaDr nvs t)srxmxrpoydoptnlivilt)aruaxroot0oleniiciys sDra(mp t0tltomf3to1lmDeaiei t)srxo(opoy1ol e ncsa()s2rrxmo;o0aleoiicilslmDul(vo;u4tltrxf3iodoatrauvs ()srtr(r iy4ap nlict t artax  nu0aeeo f3tadfmDrm(vp;(4texnmfciotlpD lu i ( s2xmio3oodop nliet t) 2raurpot0tpeomoetyt s2ul(vp;()aeenir3iotfaDe u olt  etrir no1olen fcsls) 2taum nu4aet mfciysls ra(vs;t0tlenir3ta1latelivo;t) 2xoim ny1op n nvtls arumxront1alto feild s elnvo ()artnxr3iatoa r ivo t) rxm(opiydop  mnesltfaDrr( p;o4alx mictad mDrmnmpnu)aexrmrcoydlmDrlnvo t seurxm oydapeemfei ( sDtruront4ape moeiltfm2rlump u4altrmrcoatfaD  n i;() rumxm oudole mivsls)a2trxm ;t0opx mf3iad m2rluvo (4 exoxfciatlat  nei;s  exoxm nydole livslt a2uau pou4apx mo3tlsfs ra(vsnu0 rtrmo iotlmteaueo;s) rtr(rpou4op  mnciasfaruaumooo4aexoioeiyd mDumnms;(0trenxo3oydfaD luesl(0 2xm(r3nydlp n nei s) rtau p;u4olen oeils aDrlu pnu) exnxf3iotlpDe n i ()teuo(m3iy1aleelnvsl()srraxmo;u4aexnioetyd s ua( snt)aexnxr iotlmD auvsls) rxmio oo1llee fctatfsrtmu pnu0ope ifcias sDrluvsnt0tltoirctodom eli i;(0srtmir3nu4omeemnvsatfsrrmxmo;t0apt  fcilt mDemump (4arxrif iotlm  ai sl(0t2xmxo oo4ale mfvia( a2umxmp;t1oetn ieilslm ua(vpn(0texomoctadlatelneils)s2tmir3oy1ap  mnvilt arra(rpoo0alx mociydfm2uluvont4aetrxrciytomte u s;t  etmirpou1amt mfcslt)srrr(rp;t4tleo ociydla elnmo;u4tetoxo3totfaDrliei;(0t2tr(mpiydamt mncta( arrrxrp;u0apeoif3iasfmDeaumpnt)trermo totoatr nvo s)trumxm iu4oleelnvt t)srrmumo;t0oex moctyt a2rmn p (0tleoxo tadomDe ies ( trxr(m oo1am n ieias) Drmx  ;o1opeomictldls ea(mo;(4trtrxociodfm r neilt0 exm(r3iu1olee ies (fs2ta(moot1openmi3iyd aDrm( onu0alxrmo3tatlpDeaivi;(0texmxr oodomteliei ( arumxm nt1tpxniiciyd a rm(vs;t4 lxnifctadopDrlieo;t0srtr(r oydapt  ictlt)aDua(m ;o4aleniietat m raump;(0 etrmo ia1oaDe u s;(  rxoxr3iy4lmtelncslt  2tmum ot4aetnio3iyt aDemuvo;()arxnmoctydomtean i t) exo(mpiu1lleelivi tfarurur nt1oltn i3tldfmDel(vonu0 eeomrcoydomtelneslt0srxrxmpiodop n ncia(faDrm(m no0tpxn o3iydfa2umnmo u)altrmf tatopteluei;t t2xrxrpnodlleemneia(fsrtm(  nu0altnmocild m2rlu p t4aeeoxrciodla   i sls  2umirpnodlmte ivilsfaDtaxm no1tet ifeias m2raumont0tltrif3to1oate ueo (0 eumim nu1apenlnvi s  2urumonu0altnmictlt m umumo t0trenmo3tydlpte ieils  2urim iy4omt mfei t)srum( o;o4olt ii3ils s2ea(vs;u0trxnio3oytfptrluvslt)srtmxr3ou1al   ncia( srrmuro;o1opt mf3ilsls2eanmonu4trenifcootomDeaivol()t2xoxr3oydol n ivs tfartmx pot0texoii3iyt aDea(vo t0aexomo oydfpDe iei;t0 exmxr no1llte fvt s  rtmumo;t0oltomoetlslaDrau sn()aexrxfciytfaDeluvilt0 2toirpoo1ll  lnciatfa2umurpnu1tlxo i3iytls rlnmp t)aexnmfciytopDrau s ( sexoir ou4apte fctlt)sDumxmpot4aeeo octyt aDemu s t)tlxrmf3iydlm   ivols  rum(mpoo4aptelicslsfaDtaurono1opxnmi3iys s rauvon() rxoxf3iydlatrau sls)s2uo(r3oo4am e netls a2tr(mpou1tet  iciytfs eanvs t4tetriocoytoaDrluvs t)t2to(m3ny4apte ieiat  rua(mpno4oleoifciys s2rlu s;(0artrmf io1lpDr ivo s0texoxm oy1am   fcsat a2rm(r nu1tlx moctys m2ul(vs u4aeenxf3io1fpDrlueo (  rxoio3iu1amt liei (  rurx ooo0oleoifciatlsDum(mp ()alxrxf iatomDr i o (0 rxr(m iy1olenlivtls)s2uaxrpnu0oee mo3iysla2eau o;u0treomfctytomDeli i;(0t2urxr3nudlm  mfct s) Dtrxr ot0aleo i3ias aDeanmpnu)arxnif oodfpt lu o;(  rumim3oodlme  ncslsf 2tmxr nu0oleo iciasfm2elu snu4trxoxrciadfp rlnei (0setrim3oodlme  ieias  rrmxmono0olxomociatfs ulnmo;u4trtnmr3oa1lmtran s;s s2xoirpiy1ale  fvt (f 2umuro;u4optn ictatfs uanmsn(0tltrmf iydop  anei;s0 2xmir3oy4apenmfetlt)s2tru pnt4ole iiciysfs rln on()tleomr oodlm eaneol(0 etoir3oy1lm   nvsa()srrm(  oo0teeomfciasfs rmump;t4tlxomocoy1lateaivs;()t2xo(m iodomeemfvs (  rtaumonu4tpen fctlslmDranmpn() ltnmo3oydopD aneo;s tetoxmpou1lltn netltf 2ra(rpou1aexo i3tlslm rm(mo;t0tetrxf oatfp eaiei;() etrxo oydale  fctltfartmum nu1oexn iciltfs2eau pnt4alenio iatfp  lnvi;t0 2ur(opny1op emnvil(fsDta(rp;u1tle  fetltls rau pnt4aeenmfctotfmtr nvo;t0 rxoiopiy4olen ietlt)aDrrx  nt4oeen oeiltfs2uan pnt0trtnmr to1om ran ols t2umxo oodlm elfcil(f Dumu pot0ape if3tldlmDua(vs;(0aleoifctatfmtr n ils0 rtr(m iy4ol emfetat a2ua(mpoo1oetoiieiysfs uauvo;()areoio iy1lm elnvs;t0srur(o3oy1lmee nvtasfa2tmxrp;t4tpeo feildfa rmuvsnu)aetoxrciy1lmDraies s  exo(m oudolt mfes (fsrur(rpou4tetomfctyt m2uauvp;(0alxomr tadomD  neo t) rumimpno1lptemnctas  2tr(mooo1teeoif3tydlmDrmu ont) ltnio tatlateau o;s0srxrim nu1lmtnlfvsas srtr( p;o1oltnif3tyt s rmn o;()trxoir3oydlmt  nvo (0 exo(o oy4openmnvsa()a2tmum ;u0olenioeiasfm2el(vont0teenmrcia1omDr nesls t2xoim oodlpte fvi (faDumurpot0ale ii3tadfa2eaumonu) rxoxo3to1opDr nvslt0teuoxr3oo1olen feia( s2rr(m ;u1teenioeiyd m uanmo;t)tlerxf iodlpte nvi ( srtmxr3nydopee iet sfsrumu ont4altnmfcildlm2ra(vonu) lxnmf3iotlpDeluvi (0 exrxrpio4aptnmnesas  2umurp;o4open f3tyd aDrl( s u)tlerif3to1oateluei;()truoir iodal  mivilt arrru o;u4oet iieildfmDum( o t0teermo3iotfmDrauvi;()seuriopny1al  mfct () rtrumooo0opt mietys s umuvo;()arxrio3tatom ranvi;()t2xo(m3io4llt mnciatf rra(mpot4aptomo3tat sDel( o;(4aeenxfciytoa   i i;(  exrxm no1alt mnesat)sDrmxm ;o1apt mociat s em(ms u0 exnir3iatlpte nvo t0s2xmxr oydopt  ivia(fsDurx  ;o0olx ioeiysfa rl(mpn()altrio iotop   ivi (0srxm(r iy4ol e ivi tfsrtau ooo1opxnmf3tatlm rln o;u0 lerxo3to1oa elies;()tetm(m3nu1altemnetl( s2uau  no0olx  ieiydfsDrlu o;() reomf3ta1opt  uvsls0srtr(m3iy1omt  neiat)srtru pnt1aetnifctydlm el( s;u) eermr3io1fmDe n i t  rtr(o ny1lm nlivs s sDrmurpoo0optoiocils m2rlnvs;t4 etrxociytfmD lueol(0setoxm3iu1altelfviatfsDur( pnu1opx mfetlt m ra( o () etrifcoadom rauei t0texoxm3nu1altnlnvsl()arrr( o;u1olxo octlsfa2ulnvp (0altomr3io1fmDraueils)seuoxopiudal  livs sfarta(  oo0altoio3iyd a rm(mon(4 eerio3ia1op  au o () rxrxopou4alee ict s) Dtrx  ou0tpeomfetytfsDuanmpnu4 rtnif tadfptrai o t) rxoxo iy1optnmivs t) 2raumpnt4tpeoif3iydfa2ra( o;u)altoxf3todfm   u o s) 2xm(opnudom elieiat s2umum nu4oee  f3iytfm2uln pnt)aeenmfctotlp  li s;s seuo(r ny1opt lieslt)s2tmurono4tlxniiciydlsDrmn s;u)tlxnmfctytlmDr iei s)trum(rpoo4ope mieilsf Dumu  ou0oex mfciltfm2ra( pnu4 rtrmfctatoa r iei;()srxo(opoo4alte ici tfa2uaum no4tlx mfciaslmDemumpnu0teeoif iydfatelu ol(0srxm(r oy1aptnmici ( a2uaxm nt4oetoifctyslmDum(mp u4 lxnxf oodfaDeluei;( sruoiopoy4oltnlnei s a2rmxm nu4aptomfetldfm elnms;()teerio3to1oaD ai ils srto(m3iodlltemfvt ( srua(mp;o0apxniieiadlm2rluvo ()tltnmrciatfmDr ueo (0tetoxm oo4olt  fviat) Duru pot0tee  ieiytlm el(vpnt4artomoctytoat lnei t0 rtmxopoy4am nlici sfsDrrxrp;t4apeomiciltfmDrlnvs t0 lxnxr3oy1la e ues;s0s2xrxm oy1aptemivsl() rtmumpot4tex  octytfs uau p () rxomr ootlatelivsls  2urio3oy4lpeemiei (f rrrxmono1alxniiciyd sDemnvo u4teenxr oa1oa  aivo;s)srtm(mpoo4am elnvil() Drmu oot4ole  ieiad a2uaumo;u4trtnmr oa1lmteluvs s srxrxm3iy1omeemnviat srumx poo0olt  ieiyslm elu onu0alenmo3to1op  an sl( t2xm(rpiu4lpen nesa(faDrax  nt4aet ioeils mDem(vo;u4trtnmr tatlm eaivo (0 rtrxr iy4ape lfcs tfsDtm(m ;o0apen oetlt s2em(vont) exrxf iodoateanvi;s  2uoir3oudom emiviltf rtmx pno0tltomi3ild a rl(vp ()artrmo3ia1lpDeluesls0 eumxm oo1lleemics tfa2um(rooo1optomoetysfs2umnvpn(0trenif oadopDraivo s)texoxo3ou4lltelnct sfsrtmxr ;t0tltnmo3tlsfmDeanms u)aetrmr oa1fpte u ols0 rtoxmpiodalenmfctat)s2rax pou0tlenmicildlmDeau s;(4arxnxfctadopDrluvo;s) ruoio nudame lncil(f rrau pno1tptomfeiys a ua( s t) rxrmfciatla   uei s seumio iudal elfctlt aDumx  ;o1tptn o3iltfa2uanvo;t0 rxnif tatlptraueo s) exm(rpoodope  fvil() rraump;t0alxnmf3tyt a2rln p;u4texoxr oadfmt lu s;s)seuoxm3nydom nlivil(f rtmxmp;u1tpeoio3tyt a umnmo t4altrmo3tytlm  aivsls s2uoxr iy4lmenlivias sDururont4apxo i3iadls emu s;(4tlxomociytlaDr ivi;t0 euoxo oodamen net (  Duaxm ;o4alt ifetld m rm(vsnt0aetrxo oytfpDe uvo;s  exr(o iy1lp  lnetls) ruau ooo4tpe mfeiltlmDra( o;(4 ltnxf iytoa r uvs;t0srto(m3iydopenmfvt ()sDrruroou4oltnmo3tas mDrmnms t4texoxf oy1lp elu i (  rxmxm oodllt mnci sf 2rmuroou0opeomoetydfaDraumpn() rtoio3tydopt lnvi s0tetmirpio4lm n nctatfaDrr(mpno1oex  ieiltlm2raump t4 lerirctadlat livs (0trumim iy1ap n fvtl()sDum(r ;t1apeomf3ias sDemnvp;u0 lxoir3iydom eaieolt)srto(opou4ap emfctlsf 2uru o;o1tptnifetltlsDra(vpnt0aeeomo tadoa  an s () rxr(rpoydalee ict s arua(mo;t4tpe mf3iadfs2ulnmp t4 ltnxf to1fa  au olt s2toio3io4apt lfvtl(fsrum(  ;t1altoifciadfs2eauvo;u)treoxfciatlateaueolt0trtoio ou4aptnliet () rur(mpnt4opeo iciltlm um(vsnu)teenircio1lmtelu s;() etr(m nydapenlfes sf Drr(  nt1apeniietldfaDeauvs;(4 lerxo ia1oa e nei;s0t2xoimpoo4omenlneiat aDuaxroou1aeto icias s rl(vo;t)trerif3oa1lmt auvs s) 2tr(r no1lmen feia(  Drru pno0tltnifcilt mDrln s;u0aexnxr to1lmt au s s0 euoirpiodlmtnmivsl(f Dtmxr ;t4tpxoii3iasfaDum(mp;() leoxfcta1om e i sl( t2tm(rpnodaptnmiesatfa2tru  oo4texoifeiydfs ea(vp (4trenif3io1oa  auvs s) euo(rpny1ll  mivslt)a2rrx poo1tlto f3tytlsDum(ms;u0 reoio3iydlpD  u s;( srxr(rpoy4lpte ivilt a2raum nu1tlxnmieiasfmDel(mpnt4aeenifctytfpDraieilt  2xmio3nodam n ici ( sDrr(moot1alxomfcildlaDumu s t) rtnifciotfpD au s s  eumirpiudll nmfciltfaDuauro;t4tex  i3tad s rln sn() eenmo to1fmD  ivs ()trxr(o3oo1apeelfei ( artrumoou0oex ii3ias aDuauvo;u4artoif oydlaD  nei;t)tetoxm io4apee icil( aDrmur ;o1tptn iciyslaDumu s;t)aleriocoatfat an i;t  eurim3nu1aptnlictat sDrax  ;t4teeo oetatfm2ranvo u)alenxr todla   ivil(0sruoim3oudom   ivslt)sDrrx poo4ape mfcildfsDem(mon(0trerirciadfmD lieo t0texo(mpnu1altemfvt ()srtr(mpou1tlxnio3tad a ul(mp (0 exnxo io1oaD luei (0setr(o iodlptelicsas  Drm(mp;t1altn iciatlm2rl( s ()alxrmf iy1laDe i i;s srxo(rpiudol  mietls) Dtaum nt0opxomiciys aDulums;() ltrif totop  luvi;(0trtm(rpnu4ll elfvias aDrrxroou1tlxo f3ias a2rmu p;(0tlxrmr iy1oatr ieo;s)trtoio3iudol elietatf 2ururpot4ape  oeiyd aDuan p u0trtrxr iotfmD aivo s)texmio oy4ll e nvsl(f Dururono0altnmf3tls a ul(von(0tlermrcoadoa e n i (0trxo(o oo4lpeemnct ()a2tax  nu0aleo ociys aDrlnmonu)aeerio tytlp rlneo;(  rxmxm no1ap e nei t)sDururp;t1oetoifciydfs eaumonu0alxnmrctotomD ln o;( setmxo iudomt lfcilsfsDtr(rpoo4apxn ictydlm rmnvs ()trxnxo3to1opDrlueilt)trtr(m3oy1aleemfeil(  rtrum ;t4tet ifciyslmDrm(msnt) renioctydoat li il(0trum(rpoy4lltn fesat)srtauront0alx ifeiad a ua(mp;t) eeoxf3ty1fp   i sl()setmxo3iu1lp emiesa(fartmxm oo0aetnmfctatfm ua( o;(0teenioctydop  ai s (0srur(mpiu4al nlivtas a2rr(mo;u4alt ii3tyt s uan o;t0artrio oytoat  u s;s setmxrpnu1om  mivsas)s2rru oou0tpeoif3ildfa umnvp;u)altoxo3oodopD luesls0 ruoio3iy4amenlfviatfarumx  ;t0teeoioeiys mDuln o;u4alxrxrcoa1fmtr u i;s  etm(r3io1lle  nvi s aDra(mpnu4aex iociysls2um(vo t0trtrio oytopte i o ()t2tmxm3iu1amtnlnvia()artr(ront0alx mfcilsfmDeanvpn()aexnmf3iytomDeau i;t0 exmimpno4lpee nciat)aDua( p;t0tlxn ociad mDulnms ()areoifctytfa  anes t t2xoir3oudolte ncta() 2tmu  ;t1texo oeiatfaDel( pnt4treoxrctadfp elivi (0s2tm(m3oo4lp   fciat a2ta( pot0aeeoioctat mDrmnms;t4aeenmf to1fpD anesls)t2um(m iodam elnviltfa2tau  ;t0apx  i3ias a2ua(mo;u) eenio3iadfpDelu ol(  2xmxo3ou4om elivil(  Drmu  no4olx mfeiyt a emnmo;u0 eenxf3oadlpD livo;s0t2toxm3iydalen nctl()arua(rono4texn i3iyt a2rmnvp t0altomr3oatlm   ues s)trxr(r3no4aptnmfet sfaDtau ooo1opt  o3iasfm rlu s;()arerifctodom rlieols)trtmxrpiudameelnet s)a2tr(mp;u0tetniictysfs2umu p u0aexrxo3ootlmt  ivilt)setm(m oodoltn fctat)sDrmx oou4texoii3tydla uanmsnu0alermo3iatfa ran i;s)seurim3iydamt liesatfaDrmuronu0apeo o3iasfa2eau s;t4 rerxr3ta1fate ivil( truoxo ou1optemfet tf rua(m ot0tex mfctld s2um( p;t) ltnio io1omDeanei s sexo(mpnydom nmieiltfa2urumpno0olxnmfetytls ea( pnt)altomo oatfmDe iesl(  2xmxrpoodap emivilt  2urump;u0apt  ictlsfm2ua( ont0arxrmfciytlat lueo t0 ruoim iu4llen ivi s  2raxr ou0teeo oeiydla2eauvon() ltrmr todfm e uvol(0truoxo nu1omtemfvias)aDurur ot1aetoiiciyt s2em(vs;(0aeenxo3iydla ranvs s trxrim no1ol elieia(f 2rmxmpou4teeomf3tad s elums;t)trerxo3iadfmDr uvols)teuoir ou4opee icsa(f rtaxm ou4oee  feiaslaDrmu pn() lerir ta1lptelnesls0srtrxr ou4olee nct ( arra(mp;u4alto ocilt a2raump t) eermr to1lptran il(0teuoir3iydole  ies ()a2rr( pnu0tpe  ocils mDea(vont4tlxnio3oytlmD aneo;s0srxoio nydam  lictat sruru  ;u1oltoii3tltlmDelnvs (0 leoif3iodopte ivilt)teumxo3iy4omee ivi s  2tmuro;u0tlxnmicils s2el(vpnt4arxnxr3iadfpteauvsl(0 2to(opoydlltelivia(  Draum nt0oexniicilsfm2ua( on(0trxnio3oadlaD  ivo t)trtmxmpiy1opee netl( s2urxr nt0opeoiieiytlmDrmnvp u0altrxf3to1om raivi;s texmxm3no4lptn ics ( aDrmx poo0openmiciydls2umu o u)alenxrciodfatrauvi;( t2xm(o3iy1lmtnliesat)sDtr(mp;u1tle  ieilsfmDra(vo;t0texnif oytlmtr i s t) etmxmpiy1lmtemnct s)a2tmur ot4alxoii3iyt a2emnvon(0aeeoif3iydfp  aies;( srtmim3oo1lm emnetls srtmxr oo4tee  o3iydfm rlu o t4trxoxf3ia1fp rli s;s s2xmxopno4lm e fvsa( aDrr( o;t4oexniicild s2umump t4 leoiociydfmte u i s)srurxo oodlle mnet sfsDtmx  ;u4tpt if3iadlmDuan s ()artoxocio1fptraiesls)s2xmxo3oydlmtn nvi s sDtr(m no1apeomo3iyt a2rluvp t)altrmf3ia1om rln s t trurim3ny1apt mfvtat arumur ;t0tlx  feiaslm2rmn o t)trxnio3to1fatelu s;( t2xmimpny1llt mnci t artr(rp;u1apt ifciltfs2elu o ()aetrir3tadfpD  nvi;t  eum(m3ou4ape mfesl()s2raxmonu4optoifetysla ulnvo u0areomf oytfpDranvsls) 2xoxm iodlpeemneiatfs2taur nu4apx  fcils aDrmu s;()aetnxfcoo1fm  lieo s  etoxmpoodalt mncsat a2urumont1tptoiietltls2rmuvo u4treomrcoy1latrau i (  rtrir3ny1olt miviatfaDta(rpot0opt mo3iytlm ua( sn(4 etnmf oydlmt lu olt0 2xrxo nodoleemnetat)aDtru  nt0texn i3tlsfm ua(vo t)alenxr3oo1optr ivi;s0 2uoxrpny4openmieiltfarra(mpnu1opxo ociydfa2umnmpn(4tetomr oytfm eln i;s0srurxm3nu4omtnlfeils arrmxr ;u1tleomfcilsfaDel( p u0 exrioctytoatraivo (  2xmirpoo4ll nlnviasfs2rax oot0alx ioeiydfsDemuvsnt) exrmf3to1lp  anvil(  2urxm3iu1omen iesltfs2ta(mpot0tlxo feiatfa2eaump;t)arxnmf ty1opt ln ol()t2tmxopiu4lm  lfeiat srtrumo;t0olxnio3ilsfm ra( snu0 lxriociodlmDe ues;t0 exm(m nu4ape  fvi t s2um(roou0oet  feiys a emumo;t0 rxnifcoytfa ranvi (0t2tmirpiy1al emfesls  rurxm nu1opxo ieiad aDumump;(4texomf3oydlmD li sl(0t2tm(r oodolen ictl()sDrrxro;o4aeenmiciaslsDelu o;(4alerirctodlpt livil( teumimpnodlp elnci s)s2taum ot4apx  fetasfm rmuvs t0arxoir3oadfp r uei;s)texrxr ny1ole  ivtls)aDrm( o;u1tpt mfciltla2rm( s;t4 eenmr3tatfat  nvil() 2uoimpio4llt lfesatf Drmu oou4tltniociysfa2rl(ms (0teerif io1oa rlieo t)sexmimpou4optnmfci sfa2umum ou4altn o3ild a2rmnvont0aetomrciatlp  an ol()t2uoio3iu1llenmics t)sDuaxm ;o4alxoio3ilslaDrl(ms;t0alenio oy1fatelnvs;s)sruriopio1lm  mnes (  Dtm(m ot0teeoiictldfs eln p (4 renio totfm r i ils  2xmxrpnu1alenmicilt a2rau p;t0tpxo oeiadlsDul( p t4 etnxocoadomtrli ilt0s2xo(rpiydam n ict s)sDtrx o;t0tetnioeiatlmDrm( o;u4 eenirctadomt liesls teur(m3oy4llenmnvsltfa2taum ou4olt mociys a2ulump t)aexnmr3tatfm rlneol(0srtrim3iy1ope mnetltf 2tau p;o4apt miciydls rm( snu)tlermo tadlat  nvi;t) rtrxrpiy4am   fciasf 2raumpot0tle  o3ilslm eluvp;u4 rxnxr oadlatrluvo s0srumxm3iodoleemnvta(faDtaumpoo0tltomicildls2elnms;(0alxomf3oatom r ies s seuo(m3ny1om nlnviasfa2um(ro;o4oeenmf3tadlsDumn pnu)artrir3iodfateaueols0 etmxopiu1lmt lieilt sDtrxm ;t1oee mi3iat a2ul( o (0 etoxr3io1opDrli o () rtmxopnydome  netatf ruaum no4tltn o3ias m um(vp;u0 rerxr3oo1fp eau s t t2uoir no1apt mncsl(  2truroou1oltoiictasla elu p;()arxrxocty1omD luvi;t) rurimpiodllee nvsls)aruaxro;u0oeto fciatfmDrmn o t4aeeoio iytlaDranei s trxoxopoydlp nlnvi tfsDtmumpno1tlt ifciat s2rau p ()aetrmf3iodopD lneilt)t2tr(r io4ole  icsl(f 2um(m nu0aex ifcildfs ea(ms u)texrmociydopDrli i ( setr(rpny1om n fcsat)srtmumpno4oltoifeildfm eau o;t0alermo3to1fmD auvils0setmxo io4ll n ies s)srururpoo0apx io3ilsla eaums u4 exoxo oadoat livs t) 2toxopnodlme licsa() Dtaxroou4apxnmo3tys m2ul( pnt0tetrirctydlpDeanvslt0 rumxopnudom  lfcsltf Drm(mpnt1tlt  feilsfsDel( on(4texnifcoydlatr ivs;t) rtoxo oo1om nlfvsat a2rmxrpnu4optomoetltla ran pnt) lxnxr ta1fpte nvsls)truoim3ny4ol n fcslsf Dtax o;t0tlt ifctaslm ra(mpnt) rtnxrctatfp e ues ( t2xr(r iy1lp  mnctls)sDrr( pot0aleomoctat sDrm( onu4 exoir3to1fa rliei;t0srxm(r iu4lpeelneslt) 2tm(rpoo1alen ociydfmDul(vsn(0alxrxf iotoate u o;( texrxopoo1omenmfcsa() Draxrooo0oeenmfctaslmDrln pnu4 ltrmo iydlaDraivi t0s2tmirpnu1llenlneilt s2uaxmooo4tetomieiltfaDranms;u0artrir iodlateaivi ()texo(o ny1lp emivi s)sDrrxr ot1tpt  iciydla2ea(vpn()teerxrciytlp  livols  rxmir oodll emivs s s2um(  ou1tleoii3tysfm2umnmo (4aetnir iytfm raieilt0 ruo(r3no1altnlfvsatfa2tr( ono1apeniietydls ul(ms;t)trenif iotopDr uvs;t  2xo(opnu1lp nmnvtls)arrru  oo4tlxomo3tlt mDumumsnt0alxnxo3totomDeluvo;s  etoio ou1apt  neslsf 2uaurpou0altnmoetatfaDeanmpnu0aexomrctotfa eln o;s  exrimpnu4opeemivia(f rrm(ronu0aee  f3iysfm ranvs t4trtoir3io1optr iei s trxo(m3nudolt  ncs s)aDumum ;o4opt mf3iyt a2rluvs;u)aetrmr3iydop   nei t)sruo(r iudamen fcils aDta(rp;o1texoiociytfa ra( p;()aeerifcoo1lm  li s () 2xoxo ny1omeemnctl( a2ur(ronu1tleoioetys m2umnms;t) etomocta1omtr iei;s0t2tmim iu1ameelfcias aDtaur ou4teeoioeiltfaDulnvs;()tlxnio3ty1oatr nvs () 2toxmpoy4amenmfvt ()artr(rp;o0tpen octatlm2rl( o u4aeerxf iytoa r n slt  rxmir3oodop n fei s) 2ua(  ou0opxo oetadlmDulu p;() rerxfcoodfmt  nvo (0srtmxm no4ap e icilt  Drru ooo0tpenmi3iasla eanms t0aeenmfcoydlpD ln o;s trxrim no4al emfvt s  2umu  no4apt miciyd m eanvp t0alxrxf oa1lmDraues;()texo(mpnydlltn neta()artaxmpou0tetn o3iat a rlums t)alenmf3iydomtr neo;t  2xmxrpiodap nmfcil(faDtrxmo;t4tpx  fctas aDumuvpnt0trxrir3oy1oa eaivo t0trxrxmpoudlpen fvsat) 2tmumoou4oet ii3iltfa2rmnmpnt0aeeomociotfmtranes (  rxrim oy1olee fctls  rrmu  ou4apxnifetyd a eanmp;u4 lxoir3iy1oa eauvils)trtrirpio4lpte ict sf rraum ;t0open oeilsfs2rau o;t0tlxniocootlmD  u o;t0seur(rpny1aptemies s)srur(  ou1tpe  o3tas aDemu s;t4texnif3oytfpD  ieols texmiopiudolen netas)sruaxr ou1aex miciaslsDumnms () rtoxociy1om  anes;t srumxo iu4aptn net tfa2trxmooo4texnifciydfs um( s u0arermo3tytlm eln i;s0 rxo(m3oy4lpt lfeils) Drrumpno4teeoifetysfm2uau p;t0trxnxo oodlpDr n o s tetoim3nodlm  lncsasf rrm( pno4tpt mf3tlt sDeluvp;u4 leoxo totfmtr uei;t0 etoim oydlmeemnet tf Duaum ;u0aeeoifetad s2ulnmsnu4tltnmf3iatfa  aivs ()sexr(opoy1ll emfvia(  2rrx  ou4tlxnmfeiydfa2ul(mpnt0 exrir to1omDe nvo;s sexr(m3iy1lm e fet s)a2ua(  nt1olxoiocils s2rl(vp (0trerxf todopDeaiei;()teumxopoudlm  mfei s)sruaxr ;o4optoiictls a eauvs u) renxf oydoateli ils)s2umim3ou1al emfei (f Drrxronu0tpxoifcilsfmDel(vsn()treoifciytoptrlnvs;t)s2xmio iodlmenmfcil()s2ta(rooo1olxomoctad m ulu o (0 ltnxfctodla r ivsl( t2xo(o nu1opt  nciat)sDrrurp;u0texn ietyslaDrmuvp ()tltoxrciy1faDrluvils srtrxr3oo4olenlnvsa(  rrm(mpoo0apenifetldla2emuvonu0 rxrmr3to1lmDrln i (0srxrxm oy1lptnlivt sfaDtm( p;t4teen ieiat mDua( snu4 exrxo3oadfpte nvo t)t2urxo3ou4lpenlics sfaDrmx p;u1olt mo3iad m2ranvo;u)aeenmrcoydomt  uei ()trurxopiy4op   ictl( s2rm(mpou1olxn ieiltfaDul( pnt4aeerxo3iydoatrlu i t0 etm(r iy1ap nmivi s aDtm(mo;u4apto i3tat m2em(vs;t4tetnmfciydopte ivil(0trxrio io1lm   fviat)a2rru  nt1texnmf3tas a ra( o;u)alenxf3iotlaD an i (0seumio3iy4openlncta() Drr(mpno0aptoioeiys mDrl(vp;()aetnxfctadlmteaivslt)s2uo(opoydlleelneil(f rur(mooo1ale  oeiydlm rauvs;u4 rtrxf3oo1fa raueo;() etmxm3oo1alte icsat)a2urx  ;u0oet  oetydfsDran o t4aeeoif3tatlatr ivsl(0trtmxr3iu4ol  livils)s2trxrpou4aeeo ieiat m em( o;t0teerio ootopDr i olt) rtmxo3iy1lltnlnctas a2ua(m ot1apto fcilt sDel( p (4teeomo3oadoaD lu ols)trxo(o no4lptemfct (fsrtrxro;o0apxn oeiadfmDrau s;u4alxrmr io1la r u slt) exrirpnodlmtn nes sfsDur(mo;o4aet ii3tasfa rluvpnt4arerxo tadopt luei (  2xo(rpou1lptnmfeia(  rrm( pnu1oltnioetlsfsDrm(vpn() rtnmo3todfpteauei;() rur(opno4alt mfet (f 2ur(ronu4teeo fctydfa2rm( o;t4 rtrif3oydomt  ivi t0setmxm nu4op   ieilt arum(root1olxn fetlsls elu s t4tlerif todfp  au o t  2xoiopoodapenlicias  rumxr ;o4aeeoifctydfsDum(vpn(0alxrxociytlaDean o;( texoxrpou4lptnmnei sfaDtr( oot4olxoifetysla rlnvpn(4 lermf3iotoptrli s s  etrir3iy4lp nlfvsl(faDtax  nu0tpto fctydfs2rl( sn(4teeoifcoa1oa r neil( teumio3iydoptelivtlt) 2tax  ;t4tlxoifeiat s2ua( p u0tlxnif iy1fmD ai o t t2urirpnodlltn ivslt s2rm( pou0alenmfetys m emnvs u0alenio iodfaDeai ils)texr(opoo4omeelfes tfaDurumont4oltnmieild m2rmu ont)trxrmf3iotlm  auei;( setr(rpnu4omte fetlt) 2tm(m nt0tpx mieiadls2eauvo t4trtoif3oo1laDe n s () exrio3ny4omtn icsltfa2ururpou4olxnmoeilt s em(vp u4 exnirciytomtean s;t  rtrim oydllt  neiatf Dtm(ronu0tetnmoctad m rm(vs;(0trerxf3oodfmD anvs ( srxmio3oy1ape mfcias) 2trumonu0aetnio3ildlsDulnmpn() rxoxrcoa1lmte nvslt s2xrxm ou4al nmnvtls artrxmo;u4tptnioeiys a el( pn(4 lxrxf3oa1lmte u i (0trxmxr no1ame  fcsl() Drr(r oo4alt ii3ilslmDum(vpnu0alxomr tadom rlnvo s0 2ur(opiudoltelfvslt aDuaxmo;u0teenii3ils m rluvonu)teeomr3iodfp r u slt)s2xoir3nodol elncsat s2ururpnt1aeenmo3iatlm rmnvp;u) rxoio oodoa eaueils0 2xo(mpou1ap   icilt)srumur ot0tle  feiltla2rl(vpn(0tlxomo iadfm   uvo;( tetoxmpnydopenlnct (faDuaumpnu0optn f3iatfaDemumo u0aleomo to1om r u il(  rxmim nu4lmee nciat s2urum ;o1aeeo o3iysla eanmp t4texnio3oatlm r uei ()texmirpio4ape  ncsls) rtmxr ou1altnif3tyd m rmn s u) lerir3oatlp r ieo ( trxm(mpiy4amenlfcsatf rtmu oot0tlt if3iadla umnms;()tltnxrcoo1lptelu o (0trtoim3ou4apee fciat  Dtrxroot1alxoiieiysla2rm(mpnu) exrxo oatomtrluvsls seum(o ny4lltnmivs s srumxmo;u0optomfciaslaDra(vo (4tltoio3ootfmD  nvs t  exo(opoydlm  mncs t) Dtr( o;u4ole moeiadfa emnms (4aleriocoy1fptelu o (0 ruo(mpiu4lm e fctat) rurumo;o1opx  iciad mDeauvs (4tleoir3iy1fm  anvs ( texoxr3no1lmt lieslt s2umx ooo0tpe  fetltfaDrmu snt4teerif iatfaDeanvs (0 rxoxopnu4lmtnmnctl()s2tmumooo1tlto o3iyslm2ul(vo t4 lxnxr3io1fmD  i s (0 rtrimpiu4ll   fcsat)artaurpot0apxniicildlaDra(mo;(0 eenxo totopt lu i s trtmxrpio1lp   ivt (faDur(m nu1opxomi3ildla2uluvsnt4trxrircoo1opD  ueol( srxrio ny4lm nlnvslsfs2raumoou0aeen ieiadls2rl(mp u)trerio iy1om e nvilt seurxr3io1op nmivt (f rrmxrpnt4altnif3tatfmDran p t0alxrmo oadoateau sls)seum(opno1lpte ncias  Dur(  ou1olx mfcildls ulnvs (0trtnif iy1fpD livo;s  rur(rpny4lp e ivtas  rurur oo0ole ifctad m2rl( onu0aetnxfciatlptrau i ()sexoxo3oydop elfcsltfs2umxronu4alenmo3ilt aDemnmp () reoif3iadopDraivo s  etrirpnodape mictlt sDtrur oo4olt iietldfmDrauvo u4alxnxocoadom  lnvils)t2umxo3oy4omenlfvia()srraxmpoo1tptniietasfs em(vsn(0tetoxfcoy1lpD auei t0 rur(m3oy1lmen nesltfarrrurp;u0oeeo f3iyt s elnvp u)areoxr3iy1fm ean s;t0 exrio3iydomt mfetlt) 2urxro;u0apeoif3tyslm2eaumo;t4trtrxocoy1oaD  nvo;(0 rtrimpny1lltnmfes (fs2rmxmpnu4aeeoiieiasfaDeauvo t4arxrxo oadfptraiei t0s2urxmpiy1apeemfcs s  rurxronu1oexoif3iyslm2uauvo;u4treomrctydfpt li i s texo(o oy4lmtn ncsas) ruru  nt0ale iictytfs rlu p u4teenxrcoydom rln i;t  exoxmpno4openlicsls  rtax  ;t1oeenmfetlsla rl( onu4trerif tadfpDeln s ()t2tmxm3nodal e ncsa(fa2umxrpno1tleomieildfmDuluvont)tlermf tadlmDeaues;t) 2trxo3iy4aptn icsat) rtmumono4oeen i3iatfmDrlnmo u4 renmr oydlpt lueolt0trxrxo nu4aleelnvt sfarta(  ;o4altoioetls s2ul(vsnt)aetnxfctadfmD  ivi s) rtoim3nydole mfctlt)s2tmxmooo0openmf3iltls2uanvo (0trxrxrcia1latean s;s) eumim3ou4apenlnesa(f 2tm(mp;u4apxo iciyslm2ua(vp;t)arxomo3todlpteliei t) 2trxm3oodale  feiasfa2urum oo0tetnii3ilsfm ul(vpnt0 lxnxr3oa1lmD auvo;t0teuoir3ou1ole lfvsl(f Drrxront0oleoiiciydlmDumumo;t)texnif3iotlaDr n s s0s2xoim3oo4amen fctat srrmumooo4opxoifeiatfs em(mpn()trxnmr3ta1lmt ai o ( trxoio io4altn ncsa(f 2trxmpou1tlenifcild mDra(vo t0aeenir totlp e u i;t0setoxr oy1llenlfeilt)a2raurp;t0aetomicils aDuauvpn(0alxoxr ty1lm  an o t0 rtm(o3no1opeelnesl(  Dtaxrooo1alx  ietasfs2emn o;(0tlenmr oo1lptranvo;t)s2xrxm3iy4om e fet sfs2ta(  oo4olxoioctls sDeau snt)arxrir3oo1oa e ivo t seum(m3ou4lmt lnvs s)a2urumoou4ope ifciyd sDea( o u0aeerxo3todom  luvsl(0t2tm(m3oydom nmivsl() Drmurpou0apeo fciytlmDranmp;u4teenxrctotlatelnvsls0t2xmio io4am nlictlsf 2uru ono0tlx mfetldfmDra( s;t0 ltomo todlp rai i (0texo(o3oo4lleeliciatf 2ra( p;t0tlxnmo3iat aDel( o;(0arermo3to1laD aieo t t2tmxopoy4llt mfvs ( a2urxmont4tpt  ieilsls2el(mont0alerxfcta1laD  n olt t2toim3oydom   ivt sfaDrr(moot1texo ietld s elumpn(4teenxoctadomt lu s t)t2triopno4optn nci s sDtm(  no0tetnmoeiytlmDrmumpnt4 reomf ootfa  au ol() ruo(o3oo4llee fcta(f 2raurp;t4tle miciltfsDrau o (4arxnmfcto1lmt aiei;(  2triopnu4oltn ivslsf 2rmxm no1opeoioeildlmDua(vsnu)arenxr3oatlp rlivolt0 2xo(o3iodap   icsa( a2ra(m nt4apxnmf3tld m2umuvsn(0altnir3to1fpt lu s;s)s2xm(mpoy1ale mnes ( srrrx  ot1apxnmo3iytfa uanmp u4 exrmo3tydoptrau i ()t2xoxm nodlmt lfvtat)aDurxmonu1oexn iciatls umums;u0 rermocoatlm eli i t0 rtoxo3iodolenmies t srraurpno1tetnmfeilt aDuan sn()artoio3to1fateanes;(0 exo(mpiydop nlfeiat  2rr(m ;u1tpxomi3tltfm2ulu o (0 renir3tatlp e ies;() rtmio3iudoptnmnetl(farrr(ro;t1alxo f3ild mDeanvo;u0tlermr tatfatean sls0 ruo(o3iodome mivslsf rtr(  no1aee  f3iysfs2umnmo t0artomfcoo1oat aneo;(0t2uoio no4lme  fviltfsDrmxm nt4opxnmo3iltla ranmp;u4arxomrcoy1omtrlivslt) etmxm iu1ol e iciat aDua(mo;t0opeo i3ildlm eauvs;u)texrio io1lm elu i s)t2tmir3iudole lieslsf rtmxmpoo0oeeoifciydlmDuan o ()tleoirciotoa rai o s0sexrim3nu1ll emnes tf Dur(mo;u0tex ii3tasla rmu o u4trxnmociy1fmtrluei s)setrxrpoydlptelnvtat)s2ta(r ;t1aexo i3iasls umnmo;t0teerifcoydoptrlneil(  exoxmpiudap   nei t  rra(rpnt0tpeomietad mDrauvp t4 eeoio to1faDranvi;( t2xoxm3no4op nmivsltfa2ta(r ;o4alxoioetad s uaump (0aetomocoy1fm rli s;s) 2urxmpiudam nlfcs ( arum(  ;o1aexnmfciasfm2umumon()arenir3totfaDraies t0srxoim3nu1lleemfcsatf 2taxm ;u1tptn fctyd m ra(vpnu0 rxniocootlmDe uvo;t) exrxo3iudal emiesas sDum(ro;u1opxn i3iytfaDum(vs t)arxomrciadop r u sl()t2toxopoy1omte fetls) 2tmxro;o4apxo feiydlsDeau on(4tetomocoodfmDe ivi t0 rxm(opnydlmt mnetl(f Dra(m ;o4tlxnmfciltlm el(vsnu0tlerxrcoa1lpteau ilt t2xmxrpno4ll   fcil()arrr(mpou1oltomfeiytlm emumo;t0texrmr3oydlmD aues s t2um(r3iu4apenmiesasfartaur ou0alx if3tltlmDeanmp;(4 lxoifciadfmte n s;t0s2xm(r nudll n icia(fs2raumoot1aleomfeiasfm ea(vo u0 rxrio iodlat  n o;s)setoxmpoydameemnvsat) Dtmumoot0ale  fetlsla umump;(4aetnxf tydopDe uesl( srtoxm iudomt mnvtas)sDrrum no0oee mictysfa rl( p u) rtrmo3iotfptranvo s)s2xmxm io1ll e fet ( a2umxr nt1olxnmi3tyt a2rm(mp (0tlerxf3io1lptrai i;s)trxoio3iu4alenmncil( sDtr(  ;t4oetomf3ildfs el(vs u)trtomoctydlat aivols) euoimpoudop   fciat s2um(  ot0altoioctyt a2el(mon(4tlenir3ootfm  lueil(0srumxr ou4lltnlnvsat) 2rmxmpoo0alxnioeiyslm2uaumont) rxomo iatfa e ivo;s0t2urxm3io1al n fvia()a2rrxm ;u0optnioeiytls2uaums u0trxomr ty1opt lu s () 2um(o iu4aptnmfvtl(f rrrx  nu4tpxniociydlm eluvpn() etnmf3oy1fat livol(0sexoxmpio4llen ici t)aruaxroou1openmo3ildfaDeln s (4arxrif ia1lp  ln ol()s2xo(mpou1lp elnciat)sDrrurpno1aeeo ietyd sDea(vs t0tlxrmo3oytlmD  i s;() 2uriopoodopen ncsasfsDrmxmoou4oet mfctld m2um(vo;t)texomo3iodlptr neo (  eurxm3io4lm elfvt s  rrrx ono4texoiictysfsDumnmp;(0 eeoxfctotoa  aueolt srtr(m iydaltelneias) 2umxmpno1teeoiociysla2ul( pnu)aeenir oy1opte nvo t) 2ur(rpiy4lp n nesat  rtauro;o4oet mictld a ranmont)texoxfcoytlpDrlues t0 2urim iy1op  lneia(f 2rrx pno0aexnmoetas sDrmnvs t0alxoifcootfp e i olt trxoxr3no1lpe lnvi tfaDrau o;u1aee mieiad a uluvpnu4 leomo iadfm e neo;( trxmxopoodap emietl(farumuronu0tee mo3tydlaDeluvo;(4 eenxo3iydfateli il(  exo(mpny4op   nvs t  rum(moot4tetoifciasfaDrm( p;u0altnmf3io1lm  lieils0s2um(o no4ll e ivia(fa2rrum ot1opto oeiydla2ea( pnt) rtrmociotfp  ln i;t0 rtmxopno1lle lfeiat s2rr(rp;o0oltoif3iysla emn o (4tltoio3oy1lpD auvs t)texrxo3iu1lm n ict sf rtm(r ;u0oeeo i3iadfs2el( s;u0 rxrif oytlatrluvo;s  2ur(r nydaptnliviat) ruau ono1olxnmfeiytfs umn ont0tleoiocto1lp  ai i;t sexm(o3no1oltn fvs (  2rr( pno0aeeomictldlm2rluvp;u) renif oa1oatrluei;s) eto(opiu1oltnlnvias)aDrrxr ot4texo feiasfaDea(mp ()alxrmr oodfatelivi;s0texoxm ou1altnmnesasfsrrm(rp;t0tet  o3ias sDelump t0alermo todlp r u s s0 rurxm oy1lmt  icsl( srrau  nt0aptn feilsls umums (4tlxniocoytom e uei s tetrirpnodlp e ieia()srur(rp;o4tlx  oeilsla2uan s;(4tlenmocoatfp elieslt0s2umio ou1oltemfesas)srrau ono1aexoii3iys s ean snu0aeeoircoydomDe n i () 2tmim3ny1lme mfet s srrru o;u4oltoioetaslaDua(mo;u4arerirciy1lpt au i;s)t2urimpno4lm emnesl()aDrru pot1aeeo iciatlmDra(vpn(0trtoxo3to1fa   ivo;s)s2umxrpoudamtn ictl(faDumxmont4tpeoio3iydfm ulnvont)tlxnmr ia1lmtrln sls)srxo(r3io4llt mfcsls) rrmuronu4opt if3tyd aDranvp;()aexnir3ia1lmD  uvolt0t2toxrpiodalte fcsl(  rtmumooo0oltoiociydfa2ulumonu)alxrxf iatlptrln o;(0srumxmpnudlltemfvs s aDuax oou4tetn f3tltfm uauvonu0 exoxfciotfmte n s;() 2urxr oydamtelivil(fa2uru pou4aetoio3ilt a uanvpnu4teenxfctadoa rluvo;s0trtrxr io1oleemnct t a2ra( pot4texniociatlsDulumo;u)arenxo3oo1oaDr neo ()s2urio3oo1ol e fetatf rtr(mpnt1tle  fciasfs2em(ms;u0aexrxo oatomte uvil(0sexrxo no1ole  iei sfa2trx  nt4tpxniocilsfm uanvs;t0aeermoctodoa eai sl(0 exoxo ou4olen fcs s)srta( ono1aex  f3ias aDrlnmp;u4aetoir3tadomDe nes s s2uoxopiu4ap  micslt)s2rrur nt1tpeo i3tatlaDra(mpnt)tlxomr iy1la r ieo;(0srxrim iy4al n fetls  Durxro;t4tpe mfciasla2elnvont)altoxf iatlmteaivil( srxrirpoo1ol emicsl(fartaxrp;u4apxo ociasfm ra(vpnt)teeoxrcio1laD lnvols) rtrio ou1lpen iet t) rua(roou0tle mictad m emnms;(4 lxrxocoydop  lnvs (0 2tm(rpnudaltnlivsas sDtmumoot0oleomi3iltfs2rmn o;t) ltrxocoadlpDr uesls trxrxmpoodlp nlnvils srtmumpoo1tpt mietasfsDemn snt0altrmr3iatlpt anes;t sexoxopio1om nmnvt sf rraump;o4oexoioctyd mDrm( snu0 exoio3ootlmD luvsls0s2umxr nudlpeelfvtltf Dtaur nt1tetnmf3ild s2uanvpnt0aetrxf to1lat ai s;s)trxoio3nu4oleelivi t)srrau pnt0tlxo i3iysfm2rl(vp;(0aetrxr to1opD an i (0srtmxopno4ame mfeils)s2urxmp;t4tltomfeiyslm elnmsnu)trxnmf tydoaDeaueo;t0trum(m nydll emnetas)artax  oo1oltniociasla2rln o;u0aeeomf3oo1lpDraneil( sexmxo3iudal  lfcta()a2rrxmont1tex  ociydlmDrmnvs u)alxoifcoy1faDr ueo;(0teurxr3nu1omte iciat srtru  nu4tpxomfetyt a2ran o t0altoiocto1lptrlies;t)t2xr(o nu4op n ivtlt)sDrrx oou1oeenmfciydfaDrmu s;u)trxomo3oatlm elnvo s)s2uoxmpoy1ape livsat a2rm( o;u1oltn o3iadla2rluvs;t0 ltoxo tytfp raivil(0teurim ny4opt mics sfsrra( p;o0tpxnmf3tad m rmu pn()trtrmr tadomtr uvils0t2uoio nydlmt  fvt sfs2tmu p;o1openmo3iaslsDrlnvp u)trtnxocio1lm rai il()texrio3oo4altn fvsasf Drr( onu0apxnmo3iytlmDrl(msnt4alxoxrcty1laDeluvs;s srxr(rpnu4omeemfvtas)sDraxr nu0apxnmi3ias s ea(vo t)tetnif3iatoa   nvolt  2uoimpnydap  lnvta(f rrrum ;u0oee ifetlsfs2ulnms (0 eeoioctodlpt li s;( trurxm3oydam emnctat)srtmx pnt4oltnif3ias aDem( o u0 rxoiocoodoptrlnei;t srtm(o3ou1ll elfci s sDumumo;u1tpxnii3ildfmDem(vp u) eeomr3ty1fmDe u i;t  eumimpny1ll nmneil()s2tmumont0olxoioetlt a ea(vo;u)alermrciodlp raieols)tetoxo no4optn fvtlsfsrrmu  ;u0tetn i3iytfsDelu p (0tlxnmo3oytfaD li sls0 rxoxr oodlptelnctlt)a2raxmpnu4apx mfciaslsDrlnvp t4teeomo oo1fat aues;(0 exmxrpiodam  licsatfarur(mono4teenmieilslmDumu snt0 exrxr todlaDean s;()trxoxm3no1alee fcsltfartr(mpou0apxnio3tytfs2emn s;t0aexrxo3todopD  neo;()t2xrimpiy4ll e fvilt artru pnt1olx  fciatlm rl( o ()tetrmrciadlpteli i;t setrxo3iy1lltn nct (fa2umxm ot1tetnmi3tydlm eaums u) ltrxfciy1fate ues;s0setm(o iodap elncs t)s2trxrpoo0opxnio3iysfs rlnmp;t4 rxnxocoydfmD  uvilt0seuoimpnu4amtn nesl( srtax o;o1aexomfeiyd s eaums;u) rerxociydoa eln ols)trumio iydamtelfcsasfs2ua(mpoo1oltnii3iytfsDelnvs (0treomo3totlp ean sls0t2xoirpiu4ope  fcta(  Duau  no0openmietysfs emumont4 exnmo ty1fpt li i (0 2tm(r3nudoptelicsl(fartaxrpnt1tlxomf3tltfsDra(mo;(0 ltnif3iy1fa e n ol(  rtr(o3iudlmte nes sf 2um( o;t0oltnmieiadfs2rlu s;t4teenxo oadlat aieols0setrxm ou1ll e fvtl(fa2rrumoou0apt ioctatfa2umuvpnt) lxrir iatlptr ueilt s2tmiopio4apen neia(  2trxmp;t1aptomiciat m rl(mo;u) eeoir ta1fmtrlieslt0 etmxo no1llt mfeiatfa2trxr oo1ale iieiys a ulums (4tetrmfcoydlpD livo t t2xr(r3oy4alenlfeiat  Drmur nu4texniocils sDemums;u0alenxr todoaDean sls  rumim3no4am emictas aDta(r ;o4aetoii3tydlaDumn p t)trtoxo3tydoaDeluei;s  rxrio3oy4op  mnvtas) Dumurpnt4alx mfetadlm elnmon(4treoxfctotoa rlneo s0 rumim3no4lmenmieta( s2raurpou4tetnioetasfs emn o t4 ltoxr3oytfmt auvo s) 2xrio3iy1olt mneils s2raxrpou4aeeo f3iydfsDrlnmp;u0 eermr3iadfpDeaues;s0sexmxm3oudolte ncs tf rur( pou0alxo f3tltla2elnvon(0 rtriocoy1lmtrai o t0sexoir3iy4ale mfvils aDtr(r nt0olt  o3iadlsDelnvo;t)artoif3oatfpDr i s;()s2to(mpny1ol   fcs t a2ua( ont1alt iiciaslaDem(mo u0teenir oytfa elnvilt)srtrxo io1omte ivta( sDum(r no4tlto o3iasla2emnvs;()tltrmr3io1fmD  i s s trtoxmpio4lmee iesl(fsrrrxmont4apeoioetytfa2rmu p (0 rtnmocoodfpt liei (  rtr(o3iu1lptemfviat) Dtmxr nt1tee  oeiad m eau s u)trerxfcootop   n s (0setrxm3oodll e ics tfaDrax  ;u4oetniociltla em(ms;u0 reriocio1faDr uvs;t)sruoxo3iy4lptn fcslt) rum(rooo1oeen ictydfs um( o;(4 exnif3oatlmte ueols)s2tmxm3oo4op   fcils)aDrm(  nu1opto fcils s2ulnmpnu) etrxf to1lm eaneolt)s2xrxopiydll n netl()srumumooo4apeoii3iat a2elu o ()trermf ty1omDelneils t2ur(mpou1oleelfvtls) 2rau oot4aee  icildlsDua(mp;t0 ltnmfcio1fp  auvi;s0srtmir3ny4lltelncsa(  Duax p;u0tlen f3tydfm2ulumo;u) lenmf3iytlaDrauvo;s  rtr(r3nudamtn iesas sDra(  oo4teenmi3iydfm uluvpn()texoircoytfm ran ol(  rxrirpnu4apeelnvs ( artru pou1apxo feiatfs elu o u)artomr oadlp r i i;s0s2xmirpoudamt liviatf Dtr(mooo4optoifcils m2ul(msnt) lxnxfctodoa r ivi s0 rtmxm iu4amt  nvs ( artmu pno4openmoeiadfm rm( snt0 lerif3oo1fa   i sls0truoimpiu4lmtelfes t)a2um(ro;t4oltnmf3iyslaDuan s;t0tltoxf iadfpDeau i;s  2toxo nu4optnlnvia(f 2umu poo0oeenmf3ilsfm2rmn o t4 exrio ia1lpDeluvsls)trumirpny1llenlfetat  rrax  nu0alxnmo3iasfa2emuvp;t0tetnxocoodfaDr ivo;s0tetoir nudamtelfcil(  2urum ;t1aet mocildlm2ua(mp;u) rtoirctodlpD aivil( tetoiopny4ome mfvslt  2tmxront4altn ocilt m2uau o;(0 lenxrcoatlm rlu o;t0t2toxopoy4lp e ncils a2rm(roou4oeenio3iatfs uluvo;u4artrir3tadomDe u ol(0 exoimpno1al nlfeslt  2umu p;t0teto ocild mDul(vp;(4teerifcoodoptr neilt) 2xmio3oudlptelicias)a2ta(mpoo0opt io3tys m2emn o;t0 rtrir3iatlpDe nvi;(  2ur(r3no4lpen ivsa() Dur(rp;u0tetomfetad s2ul( onu)aeeoif3oatoatrln ols)trxrirpio1ap   ivs s arra(m ou0olxnifeiytlmDea(vs t0 exrir ty1opDelueslt srurirpnu4opeelfei (fa2trx o;t4ope iocils s2elums;t)trtrif3oadfptraneo t)seum(opny1lp n neia() Dumurp;u1olxnmfciasfm2elu o;u0 rtnxo totlaD aivs s s2xoimpoy4openmieta(f Dua(r ;o1apxnif3iaslaDulu s u0tleomo3iotom rauvi;(0srum(opoydlmenlnvtas)s2trumonu0apto fciltls2eanvsn() rtnmr todopt aneilt sexoxopoy1om n fvi tfs2um(mpno0apeoiiciasfsDra( p u4alenircootfmt luesls  2uoim iydol nlfes (f 2rmxroot4altomi3taslmDemnvs u)alermociydfaD  u sl() rum(o3oudlp  mnesas)arra(m ;o1aexn oetltfa elump (0aeerxf3iatom e uvo;t trtrxrpnodom   iei t) rumu ooo4tetoio3tatlm em( s;() renmr3todomtraneilt  rum(mpiodoltemfes tfsDra( pnu1alx ifctld m emuvsnt0areoxf3tatfaDrauvol(0s2ur(o nu1lm  lfctat) 2rmur ;u1oeto ociatlaDum(ms;u4 lxoxf tatoat livi s0setriopoy4ap   ici s aDraur oo4aex  feiasls2elnvsnt4artoircoo1lp r uvs;(  euoim oodamte nciatfaDurumoou4tetniictyslaDeln p t0 rtrmo3tytlmD  uvi;s0s2umim oydlptemics tf Dumumpou4olenmictyd a ul(mp t0aleoxf3ia1fmD  nes ()t2um(mpoydalt mncsl( aDurx o;u0tltnmieiysla rmnms;t0trtomrcoadopDe neil(  2umir3io4altnlnvi t)sDrmuroou1oex iieiyt aDemnvp;t4aleomo iodoat lnvolt)s2ur(r nodop  lneil() Durxr no0opt ifcils m2el(vpn(4aexomf3oatomtranvol(0srxmirpnu1apte fci t aDua(  ot4oltnmi3iasfm ran p;t) eenxf io1faD lu s s) 2xrirpiodol elfcs sfsDrmuront4optomfctad aDum(monu) eeomr oatlpte ueo t trxrxm3nodlp  livtlt) Duaumpoo0olt  oetas a elumon(0texoxo3todoatrli s;()s2tm(o ou1llt lfvsl(fa2trx oot4opx  i3ilslaDuau onu0artomrciatlm eanvilt0s2trxo3no4apee ict s) rrrxrp;u4oexoio3iys s2ra( p t0areoir3io1fp  anvo;t  eur(r3oydopenlfvt tfsrumx ont4alx mieiadlsDrlnmp t0areoif iotlp  au o;() rxmio iudomen feia(farum( pno0tpx  f3ild a2el( pn()texrio3oydfatrlnes t srxm(m3no1altemivt s) rrmumooo4apto i3ild m uanvs (4 eerxr3iatoa rauei;t sexmio3oo4llte feias)aruru p;t1apx mfeils a emn snu4trxrir3io1optrau il( s2xoxm3nodomeelncsl(f rtmurpnt1tle ifciasfm rau o;t0tlxrxfctodlm elivs;( trxr(m3ou4opee icsas sDtr( pot4aptnifetltfa em(mp (4texrmfciotfmDrluvsls  etrio3iodlle  fviat s2raurpno0optniiciys a2emump;t0 etnxo ia1lm   nvi;s srtmiopoydap elfvi () Dtru pou0oleo iciydfa ea(vs;t4arenmr3oy1opt aivils) 2tm(mpio1lle mncs sfs2ur( pnt4apenii3tldfm rluvs;(4texoxo3iy1lat aieolt)sexoxrpiodllenlivtlt  Drau onu1ape mi3ils mDumuvpnt0tlxnmo3oo1omDe nei s) rur(o3iodape  icslt) Dtrx p;o0apenmfeiat a2eln sn(0 rtomoctodlp  aueslt  rumxr3oo1op  mfvta() 2tm(m no1opxomietyslaDrl(ms;t4aeeoxf3ta1fat  nvolt0t2uoxr3oodom e fci t a2rmxm no4apxnif3iysfsDrau snt)trerif ta1lm   ivs;s t2xmxmpiudlp e nvi s)s2uaxronu4tpeo ictas s2um( o;t) etniociadopDe neo t0seurxopoy1ale  fctl( srurxm nu0tee  feiat a2ea(vs u0aetrif3iodopD aueslt0t2uoimpiy1omeemfcs s)s2ua( o;u4tltoif3tytfs rluvp;(0tetoir3ty1fat  ues s0setrxm3oy1olee neta(  Dta(  ;t1oexnmiciyd sDulnvont4trenmf3iotopD  i olt t2xr(o ou4ol nlnct t)a2tr(  ou0tpenifetasls2em( s;u4 rtrio oatla rauvi t) rumiopou4lmt mneils  rtmxr nu0opt moetad m umn o;(4 renircoodoa raies ( trurir3
\ No newline at end of file
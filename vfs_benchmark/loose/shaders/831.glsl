@@ -0,0 +1 @@
+u ilt  exo(o3no1apeemivt sfsruau oot1tpxn i3iad m emn snt0trenmfcoy1fp  au slt0teumxr oo4altn ncs ()sDtmx pno0apxoifcildfs2ul(mpnt) lxoxr3oo1lmt lies s s2xoxo3ou4lmt  nvtls)srtru ono0teenioetadfm ulu o u) ltnmo todlpt  ues;t0 2xrxo3iodame mivilt arrr(m ot4olx mfetys a2um( sn(0 etnir3iadfa e ues;t t2tr(r ou4omt lfciat)srraurooo0oexn o3ildfa em(mpnt)tltoxo oytlptrlues;s0t2toirpoo4ol elivtat aDua(m ;t4opt iictasfm2ea(mp u) lenio3ia1lat an ols)trxmimpoodoltnlietas  Drr( oou1olt ifciyslm rl( p;u)aexoxf3tatoatelnvi () rur(opou1op   ict (faDtax  nu1apeniociydfsDumump;t0 rtrxoctotfmDeai s;()texriopoydlm elneta(  Dta(mont1apenii3iasfaDul(vo;t4tetomo oydfmt  ivo (  rurimpio4ap e fct t) 2taur no4alx ifctls sDelu p u4aetrxo3oo1fmtrlues;t srtrim oudlm e nvtltfsDrr(r ;u1tptoifctad aDemnmp;(0areoif iatlm eaieils  etmxopny4op emfes t) Dtaumonu4tleo oetls sDran s;t)aetrmrcoadfatrlu s (  exm(r oy4apt lfciatf Dumu ooo0olx moeiytfs uau p;t)aetrxrciatfptr ueols)seuoiopiydam  mnviltf Dta(mooo1opxomo3iaslm eanmonu4altoiociytla rau s ( texmio oodape mnvt tf Dtau poo1tle  ociasls ranmo;t)alxoirctotlmt an i ( srtmio oodopeemivtat  rurxmpou1tee iicild s rmums;t) etoxocio1omt auvs s0srxrim3iu1apen fvs sfa2rmxm ;t0tpxn fetyd s uanms t0 ltoxociadop r uvilt) etoim io4ome  fcil() Duru  ;o0olt mieiydlaDuan s t4texrir iydoptrauesl(0 2xrio iodopenmneiat)a2raumoot1oeeo icilslmDrlnvs;u)aeeoir3ta1optr uei s0trxm(o3oydllee iciat)s2rauro;o1tpe mo3iysls ul( on(0 rtrmf iatop r uvils0 2triopny4aptnlfesl()sDuau  nu4alt mo3iyd s2rlu p;t)arenmfcio1lm   uvo;s  2tmxo3iu1omeemnesat s2uaxr ;o0tetnif3tas s ulu p t4 rxomf3tadfm  ln il(0truoimpoo1lleemivs t  Dur(  nu1aptniieias s2ea( pnt) exrmo3totlmDraieolt0 eur(opoo1lp nmfcslsfsruaum ;u1tle  ictat a2umnvs t4arxrir3oa1lpD  uei;t0setoxo nodol  lncsls) rumxmoou0olt mociltfs2eau pnt)teenifcta1fp r ieolt0tetoir3iu1lp n fcsltfs2rrumpnt0olenifciadls2el( s;() exrmo3iydlmDranvols0srumxr3iu4omenmfctl()sDurxr ;o0altn i3ias a2rauvon(4aetoxociy1oaD au ol() 2umim3oudlpe  ivias)aDrrx p;o0ale  ieiys a rm( p t)aetomf3iadlpDran o;(  etoiopnu1op   fcsat  rtrx poo1aexnmfctaslmDrluvpn(0teerxr3iy1fp   u ils0 rurio3nu4apenmivtlt) rururono4altn icils m ra(mo;(0 exoxf iy1fpteanei;t sexmxr ou1lptnlivtls) Dum(  no4olto f3ils m2uauvp u0trxomf3ootlm e nvi s)trur(o3iudal nmncilt  rrrx o;o1oeto feild mDrlu p;u) ltoif3ia1lm eauvi t) 2urxrpnydlmtelicslt a2tr( o;u4tltnioetydfa eau s t4 exomfctytfa  lu ils) eto(m3nydal nlnvias srumx pnt0apx iietydfa ul(ms (0 rtnxr3tytomD lu i ( tetmir iydamtelfet sfs2ta( o;u1ape mieiys mDrlnmsnu)trxoiocty1omDr uei t0srxr(r3no1altelicta(fa2uaurpnu1aexniicils m2umn sn(4aexnmo3oytoatrlnes ()t2trio3iu1alenlicslsfsrrrumpno0tpenioeiysfsDuluvs;t) ltrxrcty1op eluvilt)srxoirpiy1lleelivtatf Drmxm nu4oex iieiat mDranvs;t4 reoiociotop elues t  eumxm ou4lp   nctas srrm(rpnt0tpx ifciyd a2em(vs () lxoio tadlmDr n i () rxr(r3nudopen fvtl(  2rm(ro;t4alenmiciltfm rm(ms;u0aetrxf ta1lpDr n s (  exoxopoydam nlneslt) 2rmumonu1aexo iciyt mDea(monu)teenxf3iydfpt auvi;s)trum(o3ou4lpt mnetltfsDuau poo4teen feiad a2eaump;(0aexrif3ty1fatranvols0 2toxr ny1lltemfcsat) 2rr( ont1teeomoetys aDraumo;t4alxrio iy1laDrai ol( srxoxr3ny1op emnesasf Drmurp;t0tex io3iydfm rlu s;t4tltoxf3iotfa r ivo;t) eurio3iodopte nes t)arua(rpoo1alxo ietatlm ra(ms;t0arxrif3iotfp eanei s0teuoxo oydoltn fcta(  Drrx p;t4texomieilsfs rmnmp (0 ltnircoadfmtraneolt  2tmxm3nu4lltnmivsa( sDraxmpnu1olen i3iysfa2eaump t) ltoir3iotlmtraivo;(0 etmxr3ny1omtnmfeiat) 2trum ;o1opeoio3ias sDuauvont4aeerirciytlptelivil(0teurxmpnu1om nmivt t)aDtrurooo1oeen i3ils m raumsnt4 etnxf to1fateluvs;s)sexoxo iodlm  livs t) Drrum nu4tptoiieiltla rluvs u4tetoif iytfaDrluei t tetm(m nydll   fvi s) rra( p;u1teen oeild a rm(vs;u)trtomo3tydlpt  u o;s0seto(mpoodape lneil()aDtau pnt0oetomfctys aDemu p;(4artoir3oydoateaneolt  eurxmpny1ap emfct t)sDtmxr nu4tpxoio3iad sDuauvp;t) rxnxf iatlp   ues ( sexmio3oy4lmte fvta(fs2tr(r oo4tlxoio3iatfa uanmo;(0aetnifciodfm rluvslt)sruriopoudol  miei sfa2uaxr ;t1tpxomfcildlaDemnmpnu) eermf tadlm rluvo t0 rumxr3oo1am elnctatf Dtm(ro;u1alx  o3iatla rm(vs;u0 lxrxrciodomDran ol(0trtmxopoydom e netlt) Dum(m ou0opx  ocild s ran o (0 lxrxr oodom elivs;s truo(mpou1alt  ict t) rua(m nu0oeeo i3tls s rl( ont0altnmf3oydoa eai o t)t2xrxr nodop n nesas)srtr(rooo0texomociydls2ul(mp;t4 eeoxf3iatfpD aueo;s0s2xmxo oydap e ivsls)aDuau poo4oexo ieild s uan pn() eerir3todop e nvs;s seto(o3iy1am nlici s) 2rrumpoo0aptniiciys s eaums t)trermf todfaD  ivi s0 2tm(mpiy4lmtelfet s  Duaumpnu0olt io3ias s uau o;u) lenmr3oo1fpDr ivs ( truoimpnydale  iet ()a2ururo;u0aee mieiad m emnmp (0 etnxrcoa1optraneol(0tetoxo nu4lmenmfesatfsrumxmoou1teto i3iatlaDrau sn(4 lxomrctatlmte uei;s  rtm(o3iu4ome lfvsatf rrau  no1ope mo3taslm ua( s u) ltoifctotopt auvi () 2xmxm3ou4opt  nctatfa2rr(m ;o0tpt  i3iatfm uaumsnt0arxoir3to1lpD au o s) euoio nu1am nmnciat sDum(m no4tltomfeiat s rlnvs;u)arxomfcoytfm eauvs t0t2urim3nu1altnlnvtasf rtr(m no0tle iocildla um(ms;()tltoxr3iodfmDranes s0 exrim oudopenliei () Drru poo0oex  i3tltls emu onu0alxoiociydfptelieolt)srxoio3iodll  mivs (faDtax  nt0oleoii3iasls ea(ms u4 eeoxr3iodlp rlieslt)teum(o3ou4optemieil()aDtmur nu4optnif3tltlaDuluvo ()aexrmfciotlm   i slt0 exoim3iu4am emnvsa( arrr(rpot1oetnmoeiys m umu s;u) lxnxfcoatopDelneo;s setmxm3oy4ame micil()s2ra(mo;o1aptomfciyt aDeanmo;t4treoif3ootfpD  nvilt  exrxrpnodlltnlieia(fsDtm(r nt0tlxomiciaslm emn o;t0aeenxr io1lmDelivols)tetm(opny4lmtn fvils)arrr(mont0opt mociad m elnmo u)trxoxf ia1fa elnes;() etrxr3oo1ome  nesl()a2ur(mp;t4oee moeiydls eaumo t0 etrxf3tytlp eau s ( s2xm(r3iydlmtnlfvi t)arumumpnu4oeeomo3iasfs uauvon(0trxrxocoydop eaieil()teuoir3oo4ame lnci t  rtm( o;u1apxn iciat aDuln o;(4tlxrir iatfa  luvs t0srxrimpnu1ole lfesatfaDrrur ;u1ale ii3iytfa2ul( s;(0 etrmrcoatfa elies;s0tetrim3no4llt licil( aDurx pnt0apeoii3iaslmDel(ms t4tltoxrctatlmt lneil()srxr(mpoy1am  lfvilt srumu pou0tltoioeiadfsDuln p u0tetnmf3iodfmD lies;s0trxmirpiodam e netat  Dur(r nt4tpxoio3tldla2rln s (0 etrmocoydfm  anvsls teuo(mpiodopt  fetl()arumx ooo0apxn oeiysfm2eln o u0 lxoif todfpDe n o;( s2toxr3iodop   ivsa(farumx pno0openmfetlt s ea( pnt4 rtoio3iadlm   neilt0s2to(opnydamtn fesa( sDta(mo;t4tlenii3ilslm2elump t4 eenxo3oytfmtr neo;s) etmir3oy4openmiei t) Drrxr ou4tlen oeiytfmDrlu s;t4 ltnxr3iytom rlnvils t2urxo ny4ame mivt s s2rrx  nt1alxnif3tltfmDea(mo;t0 reoxf3io1lpDrlnvs;t0 rtr(o3nudll nmfeslsfsrrm(r nt0teeoii3tatla ua( p;t4aleomo ootopDranvi t s2ur(opny1am nmivta( artmumo;o1opx mi3ild sDemump;(4 eerxf3iydom raivi t  rxrxm3iy4llenliciat) rurxronu4tee mf3iadls2umnmo ()trenmr3oodom  luvo;()t2xoio3oydalte ivias)srur(mooo1altomo3ils aDemn s u4 ltoxo ootlpteaieo;s tetrimpoo4olt liviasfs2ta(mp;u0tpxomfeiasfmDrmnmsnu4arxrif3tatop   nvi t0 2tmim oodalte fct (fsrtmuro;u1openio3tasfmDem( p;t4 rxnxr3io1lmte u il( srxmxmpoo1lpt lnvil()arrrxmpot1oee ii3iat s uauvo (0tltnmo3iytom raues;t s2ur(m oudom  miet s)aDra(  nt0tetomoetysfmDraumon(0texnif3oo1lmD  ues ( trxr(o3oo1ap   ncia( sDuax ooo0altn i3tldla uan pn(0tltnio oydlptrluvi ( srxm(o ny1lle livta( sDtr(rono4ape mociadla em( p;u0teerxoctytla  au s t0 exoxrpiudllte fvi s) Durxmpno1tltn o3tld aDeln pnu4arxomrciodoa  aivils0t2urxo nydolenlicia()sDrm( p;u4aeeomictydfmDrl(mont4aeenif3totfmt ln ol(0 exo(m iydalt lnvi (  Dumxro;t1opt mfeildfmDrl(ms;u0teerifcoydopDe nesls)srur(r3nu4ll  mnvta(fsDtmurpnu4altnmociadfa um(mo;u0arxnmr3oa1fm  an olt s2trim oy1alenmfcias sDrrurooo4teeoiieilslaDum(vs (0alxrxfcoytop e i s s  exrio3ny1om elics t  2rru pot1apxn oetltfaDea(msnt)alenxf3ty1lpDeauei;() 2xr(rpiydlpee feils) rumurooo0aptnioeiadfaDul(vonu)aeeriociatomDe ueil(0trtmxmpoudom elictlt)sDua(m ;u0tet io3iys m rlnmsn(0 ltoxf oydfptr u s;s sruo(o ou1ol  livia()srurx o;u0oeto feildla emn pnu0arermocio1late uvils  rxoio iydamee nvt (fsDtm(mp;t4aexomieiytlm2rm( p t)trxrif ty1oat au o;(0s2uo(r3io1lmtnmfcias) Drr( onu0oeenmfctld m ra(vp (4arxrifcoytlm r ueo s0t2xm(r3ou4lm e netl(fsDuaurpoo4tlxn feiydfs2el(vp u0tleoxo3ootfa elnvs ( seumio3no1altn ivs s)aDrr(m ;u4apeomi3tatfa umnvsnt4 exrxr3ty1la r iei;(0 rxoim3no1altnmietas sDtr(root0aetniietadla2ua(vo t0areomoctotlmtrlivs (0sexm(o3oy4llen icia( s2rmu  ;o4apeo iciat mDelnvsnu) exnmf tatop  luvo;s0 2uoir3oydop nlnci t aDurx pnt1oex  fcias s rlump u)trenir3oatlaDrlieo t s2xmxm3nu1olenlicsat a2um(ro;t1tptoifetlt s emnms t4 etrif3iytlmteaueol()t2tm(m3oydop   nei t  rrr(rono0apx mietls s ran s;u) ltrir3iodlm rluvi;s0 eur(m no4op emicslsf Dtrx ooo1oeenmfctadls2el( ont4alxrxf3tydom rlieols)srtr(o3oo1oltn nei s)sruru onu1oex  ieiat aDemn onu4tetnxr oodlate nvolt0srxr(m oodolenmiciasfa2ra(mp;t0tpen feilsfm2umumpnt) etomf3iadfm  aieo;t)s2uoir io1ll nmnet t)aDtmur nu0tlxnioetydlm ean p (0 lxnirctytfpt  ivi;(0s2xoio nu1op emfvtat) Drrumont1teeoii3tltfa umnmonu)altomo3oodomte nes (0t2tm(r3iy4al nmfetltfsrtrx poo4altoioeiysfa rlnvp (4trxrxo tytlp e u ils trxm(rpiy4amt  ncsas)srta(r ot0apeomo3ilsfa emuvs;t0aeeoio iydomD  n o t)trtrxopou4olt lnesltfsrumu  ;u1olto ieiltfs ul(vp u0teeomo3iytfptranes s  2xrxmpiodlmtemfvslsfsDumxm no1opt mfciatfm eanvsn(4trtrmf3oydoat  nvi (0 exrxm iu1ll   ivslsfsrtaxront4oexo i3tys sDrmn on() lxnio oydfa  auvi s0teum(m3iy1lptnlieslt)sDtmx  no4oexnioetysfa raumo;u0 rxrir3totlm  luvo s)tetr(opoodol n netl(fsDta(monu1apeomfctatfm2eau o u) ltnifctotomDrln i t) 2xmim ny4alt  ietl()aDtaxrp;t4olxoifciadfs2elnvont0teeomr to1fmDe iesl( teum(r3iu4ome lnvi (fs2trx pnt4apx  ieiadla rluvp u)alxrircty1fa  livols0 2tmxm iydolenlfvs ( s2trxro;u4opxn fciysla2ra(vpnt4alenxrcia1lpt au i;s0s2xrxrpnydllenmnct s aDum(r ou0olxo i3iysfmDumnvs;()tlenmrciadopD  nes;t trxmxopiu4om n ncs s s2umxm ou1tlxoiicils mDem(vo;t)arenmr3iodlm rln o s0trxoimpny1oltelfetl(f rtax pnt1tlen f3tad a uluvs ()aeerxocoodfm  anvs () rur(o iy4olt mnviltfs2taxm nt0oetnio3iatla2umuvs ()trtrmr ia1op r n ol()s2tm(r oo4llenmfvil() Drmuront4tptnmociad a uau p;()trtoiocoadop e ieo;(0setmxr ny4lmtnlivtlt)sDtm(r nu0aex moeiyt aDul(vonu0 lenxrciadlp eli o;t0 2toxo3iodll nlfei tfaDum(rpnu1tex  iciytfsDel(vont4 lerxo3io1fatr ivi s)setmio3io1lltnlfvsat srua(r ot4apx iiciasfa2emuvon() ltrmf3iodoaDrlueo s0 2ur(o no4lpeelncsa()aDrru  nu1aeen i3ildla2um(mo;()altrio3to1lmD  uei;s0 2tr(r3nodol nmicia()s2rax  nu0tpeo f3tydlsDrlnvp t)tlerio tadfpte nvols0srurir oo1ap   ict t)s2urxrpnu0aetnif3iytla emuvp;u)alermoctatfpDraivo t)trtoxo iudap emnes (farrru  nu0tle  octltfmDrau s;(4 etomo iytoaD lnes;t s2to(m ou4amenmictls a2ua(rp;u1olen i3iadfm2ean on(0texrxo3iadomtrlu i;s)trurxr oodolenmnvtlt  rtr(rooo4olx mo3tatlm ea(mo;t4tlerio iadop raues s t2urir nydlpeemnct s artm(r ou0oleomf3ilt sDranvo;t)areriocio1laD  nvsls)t2tm(mpio1lm elnetls arrm(ro;t4ole iietyt a2uau on(0alerxfctatfm   n s;( seumim3nu1altelfcsa(f Duaxrooo1tetnmfciadfa rluvp t)trxnmfcootlmtelnei;s0srur(m nodlm   ivs tf Drmumooo1tetn fetldfmDrluvp;(0trtnxr iydlmtrluei s)srxr(m nu1opte fvtas sDraum ot4openio3ilsls elu s u4trxoxociy1opt  i ils) 2xoir oo1opeemict ( s2um( onu4oexomf3ild m uluvp (0 etoir3oadla elneols0trumxr iu4ole lnvtlt)sDtm(mpno4tlt  o3tadfa uaums;t0 lxoxo oytomDraieo t  rtr(m3nudlm n nesls  2rrur ot4tpx  oeiltfs rlu s;u) ltoxo3ootfp  auvo t  euoir nu4ole  ietlt aruau pno1ope iiciadls2um(msn() rtnir oa1lpDrlivslt)s2xrxmpio1lm nlicsls srtaxmp;o0tpxnmieiadlaDeauvsnu) exrxrciytla   nvi t0setr(rpio4alte fct sf 2ur(m ;o1tetnifetls mDrmn o (0trermr oatop rlnvo;t)trto(r3io1al  mnetatfsDurx ono0tpe iocildlm rlnmp (0aeermr3iodfaDr nvi (0srxo(r iu1lp emivils)s2tmx oot0aee ifctlsfsDemnvp t0arxnif oy1oat lies;()t2tmxrpiy4lmen fet sfaDumxmpou4oex ioetatfa2rlumon()aetoif3to1laD auvol()setm(m3iydam  lneils) rumu ono1olenif3iytfmDumu snu4tlerifcta1fmtrluvi;t srxoim3nodomt lfes ( a2tru ont4alen i3tas s rluvont4 reoxfctadlpteanvi;s0t2ur(rpiydopt lnvs (  2rrxronu1texn o3tatla rmnms;()trermo tydla  lu s;s s2umxo nu1omte nct t sruax oou1oee mi3iadlm2raums;(0trenxo3iytom  lieo;s texoio3ny1alt mfci s) 2rrx  nu0oleoio3iatlmDulump t0altrxf3totom  lieolt trur(mpiu1altnmfviatfa2um( pou1aeeoif3iytfaDelu o t4 lenmfctotlptrliei;(0t2xoxrpno4lp  mivs ()a2uaxm ;u4texo oeiadlm2em( p u0aeermfcio1lpDelnvo;s trtmio io1om emiei t)sDraxmpou4tpxnmfciltlmDea(vp;u0arxrioctytlptrlu sl( sexm(mpoo4lpe mncsas srraxr ot0tetoiiciyt a uaumpnu0 eeoifciotopt luvolt tetrxmpiydalte fvtl() rrru p;u0aeenmo3iytfm ul(mp (4artomrcto1lmDrluvils0s2uriopiu4omte fvs tf 2tmxmo;o1tet iociydfaDeluvo;t)altnxf3oatfaDrluvi;t0 2trim iu4lmtn neiatfarrru poo1aexn icildfa ra(vs (4altniociydfmte neslt trumxmpnudap  lnesat sDtrx pnt1oetnii3tldls rm(vs t)arxrxr3tatfpD lieo;s setmir3ny1lpt lnes s aDtrumo;t1tet  ictys sDuluvsn(4 ltnxoctatlpDeau s t)t2toxm iydaltnlivtl(  2rm( oot4alxo iciys aDean pn() eermf3oadfptr i s;() etrxo3iu1al nlnei s aDraum ;u1oleo iciad sDrmnvs;t4 eenxrctotfp  lies;s)setoirpio1amte iet (faDtrxrpot4aet ifciadlmDum(mp;()aetrmf3oy1fat lnei (  rxo(rpiydlmtelnvi ( sruaxm oo4aptnifeild m umu s;u4texnxr tytfpt  n s ( trtoxo iodom e icilt  Dua( ono4alenifeiadls2elumon()texrir3oodlpDeauei t trxm(m ou1ll   neiat)aDtaurp;t4teto iciydfaDulnms;(4 etnmrcto1lateaieolt0trtm(m3oy4lm   nvt tf Drmxr ;u0tltnmocias a rl(mp;(0 ltomf iotomt lnvsls) rur(rpiydlpenmicsa(  2raxront0alxoioeiasfmDelnvo (0teeomr oy1lpDrai i ()tetrim3iu1ole mfctls) Drm(m ou0alx mo3iydfaDul(ms u)aetnxrctadomDrai ilt  2urim3nu1alenlnvtlt arururoot4oee iieiad s2rluvo;u)tlxoxoctydomD aiei s0 2trio oo4lltelnvtl() rtr(m no0apxnio3tatls2emn snt0aetrxocoodop rauei;s0trxmxm oy4lle mnvslt arrrur ot1opx  fctltla eauvsn(4 rxomo3tytlpD  ies t0 2toir nu1om  mnctas a2tm( ono0alxo i3ilsls rln o;(4 lxomr3iatfatelivi ()s2xo(r oy1lltnliei ()srua( ont1opxniiciat m2um(vont4arermf3tytlaD livi;s)t2xoiopoudaltemncia()arur( o;u1tpx mf3ildfm2em(mp t4aexrxoctotfate nvi t0trxrio3iydope  ieias)arrmur nt1tee  ocils aDemuvo;() rxoxfcoytlmtean ols  rumimpno4ap  lfvils) 2taxro;o4teeomo3tyd a rluvo;(4aexrxr3iydfaDrlu i s0sexoxm3iu4ol  lictl()srtr(m no1apt  i3iat a rm(vsnt4 etrxo3iadfpteauei t seum(mpiudam  mnesl()aDtrx p;u0tetomi3iyt mDumuvont0arxomo iatlpteauei;()srxoir io1amtnmfes tfaDururpot1aeenifetldfa uluvon() rtoif3oatoaD au i;t0sexoir iy1omenmics ()arraxro;u0tpx iictyd s rl(ms t) leoircoo1oa  aues t truoim3oodoptemictl(fsrrru p;t0aeto ictlt s2ulums t0teenif3iydom elnvs;()t2xrir iy1lmen fcsl(  rumurpno4opeoiieiatfa eaump;(0tlxnio3ta1fmDean sls0s2tr(r3oo1om nmfcta() Drrx onu0optomieilt s2emn on()artomf3oy1oa rlu i ()setr(rpnu4opeemnci (fsDtr(r ou1apx ii3iltls ea(mont)teerio oa1om ran o t0srur(m3iu4aptn fvt s srraxroou0aeeo o3ilsls2ra(mpnt4tltrirctadlp ean s;t)srxm(r3io4optnlnesat artrxro;o4aexnioeiasfm2uau o;()tetomr3oadfaDr nvo;()texo(r3ny4lle lfct s)artax  ;t0oexnmoeiysfm uanvo (4 etomfciydom rli o;t0 rxmir io1lpe lnctlt  2ua( o;t4opeo oeiad a2ranvpnu0arerxrcoadfp  ai o ( srurxopiu1llt  iviatfsrra(mpnt4aetomfetyt a2ea(vp;(4alxrif iatlpteaivs;s)texo(m3oo4omeelnvsls s2umx  ou1texoioeiad mDrau o u4tltoxf3iotlpt  nvi;s  exr(o3ny1al elict ()artr( o;o4tetnio3tyd a ea(vp;()tltomocio1fptraueo;s0s2xr(r oodlp e neslsfsrraurono4tptnii3tasls raumsnu4 eenxo3tadlpDeanei t)srxr(r3oo4opee iesatfa2rm(rpnu1apxn ociad sDua(mon(0tetoxr3todomDe nei;()texmiopoudlme lictlt  Draxr nt4open f3tls s2rln pnt)trtrif iy1fa e u ilt0 rxr(r nodamenlncsatf 2trxr ;u0tle  feiysfsDul(vsnt) lerio3iotlptrln slt0srumim3no1alen ieta( s2raurpoo4tlt mieiasfaDemu snt4 lxoxf3io1laDeaiei t)setrxo iodapeemnvia( a2ua(rono0olen ociysfmDul( ont4tlxnxr3iydlmD lnes t srxoxr oydlp e nci tfsDurumpot0apx mi3tydlmDuan p;t4artoio tadfa eli il(  2xoxo iy1omeemivia()arrmurono0alen i3iaslm eauvonu0 rtoxfcoo1laD  n o t0sexmxmpno1alt  feiasfaDur(mpot4tpe ifcilt m2rmuvs t4 ltriocootfpteln s t) rtoxo3ou4lmtn fetltfartaumpou0aptnmfetld aDem(mp t)arenxr3oodlmDean sl() eur(o nu1lm elnes s) Durxr ;u0tleomf3iysfs2rmumo;t)trenxfcta1fmDeln i;s0s2uoxopnydal  lnci s)aruru oot1texnifetlsfa em(vs t4aeeomrcta1omtelueils seumir3nu1lp elietl()arrm(r ;o0aet iociydfmDumnvsn(0arxoioctotoaD lies ()s2xmxmpiudale  ici sf 2ur( pno1apxn i3tydlm2uanvo;t)arerxo oydlmteauei;(0seum(r3oo1amtemivs tf Drm(rp;o1tlt miciysfm rm( o;(4 lxnmociatfpDeaivi;(0 etoim3oodamenmfcs (fsDrmumooo0opeoii3iadla eanvs;t4arenxfcia1lpD aivs;t0 rtrxmpio4altnlict s)a2rax onu4ole ifetasla uln p;() reoif oodomt lues;()t2xrir3oy1amtemiviat) 2umxm ;u0opt  oeias a elu p;u4arenmrciatopte nes t0tetmxo io4ame lfes tf 2umumonu1apxo ieiadfmDemnvs (4tlermfcoytop r i i;(0 eur(rpoodlpt mfvias artm(m no0apx iictldfmDrl(vo u4artoif iodlptr neo s texmxr3ny4lpe lnvsls)a2umx pnu0texn f3iysfs ua(mo t0tltoircoatlmD luvi;(0 2tmirpny1al emfesat aDua(rooo0tle ifcildfs ranmonu0tlxomr3iytlmDe iei s) rumio3ny4am  mfcsat) Drrx onu1oleo f3iys m rln o (0aexoir3iadomtraivi;t srxm(m3oy1op   neiat) 2uaur nt0tlxn fctlsfa2ra( snt) ltoxrcoo1fpt  nvs;s)s2trimpiy4ap  mnvtat a2ur(rpot1texnmiciydfa eau s;t0 etrxr todfp eaieil()setoio3nydaltelnet s)sDtru  ;u0tet miciytfm2ra( o;() ltrir tytla e i s;s  2tr(r3iy4omeelncta( aDumxront4open ietlsls2ea(vp;t0 rtrio totlaD an il(0tetoim io1ap nlnvsat  Drm( onu0aexomoetys mDemuvp;t0aexnmr tatlptranvs t0sexm(o oy1amee ivsl(  Dtr(  nu4tpxo icildlsDum(vo;(4texnio totfmDrauvo;t) 2um(o no1aptnmfcsasf Dtaxm nu1apt iiciltla2uanmon(4 exomocoa1lp  luvi;(  etrir iy1oltnlivslt) rua( o;o0openiictat aDua(ms;u4artnmrciy1op r ivolt) rumimpiodll elnesl(fsDtrurono0opx mietytfs ra(vpnt) renmfctydfa  lnes t0trto(m io1opt lnvtl()s2rax pno0tpeomieildla elnmo t4 exrxf3to1omt ln s;()t2xoxm iodomt  ics ( s2rmxmo;o4tpto oeilsfs2rmumsnu0tlxoxr3iadlmD  n i (0 exrir io1lmenlnvtat) Dra(  ou1ale  f3iydlmDelumpnt)altnioctytoat  n s;s0s2uo(rpoy1lm nmfvslt s2umxmoou4tltnifeiatfsDuln on(4 ltomo iatlm r neol(0seuoimpny4opte fetat)srum(m ot0aex mi3iyd a2rm(vs u4trxoxr iatlm  aivo;t truoxm3iudlptnmieils aDra(m ou4apeomiciatlmDrl(mp t4 lxnmocia1oatrai o;t0seuoxmpiu4ol   ncias)s2rmump;u4opxniocildlsDeauvo u4trerir tydlmDeli s;()s2umxo3oy1lm e ncs t sDrmxmonu0aee  feiysfm2elnmp;t4trtomrciotlpt  ieils)s2xo(r oudlptn ivtlsf 2raumooo0olxn i3iys a rl(msn(0alerif oa1faDeluvolt) rxoiopny4ap nlfvi t artru ooo1tlxo fctyslmDrmuvsnt) exrmr tadlptean s ()srtrxopiodopt  ics tf rrr(moot1teeomfciat a rmnmsn()aetnioctadla e nei t) 2xmir3oodam nlnctat  ruaxmo;o4tptoifetyd s ra(mp u)aeerxr ia1fmtran s;s0tetr(o ny4apeelici (f 2umx  no0olxnmfctadla em( o (0aetrmrciydfp rln olt0 2xrir3io4ap nmnei (fsDumu ont0opeomicilsfm rm( ont4 lxrmfcoadoa  lnvs;s tetrim ny4lptn nvt ()sDrrur no0oetomiciytfs2ra( s;u)trermrctodlaDrlnesl()teuoxrpnu4ap nmfci s sDtruroot4aet mietad s el(mpn()trtnmr3io1la rluvo () eto(rpiy4ll   ivil()arrr(  ou4tleomiciatfsDuanvp;(0 lxrmociy1op e i i;(0setmxm3nudom n ici tfsDtm(r nt4apxo o3ias mDul(vsnt4trtoxo tytfa elivolt) 2tr(rpoydlmenliei s  2trum ou1alenmf3iatlsDrmums t4trerxfcoodlat  u sl(0t2ur(mpiu4am nmics ()srra( poo0opxomoeiadlaDuanms u)treoxo3iydom raivolt0sruoxopiudaltelneilt)aDurxmono4aleoiociltlm2uau s t4teeomf3oytoaDeaneol(0 2xrio3io1ap e fesa() rra(  oo4optomociydlaDumuvo;t4tetoxrcoy1omte u sl()seurxo3oydolte feias aDra(ront1tlenio3iysfsDuluvo (0 exrxoctydfmtrli i;(  rumxmpoo1apenmfct s)srur(m ;o1tleoio3iltls2emuvo;t0 eeoxr todoa  au sl() 2umxmpiy1ap  miesa(f Duau onu4tetn ociat m2ua( s;t)trermr3iadoa  li o;()sruo(opno4llt mfvi t a2rm(r ot1teto i3iadfmDra(mp;(0alxrifciodfptrlies ( trurir oy1llt  nvs ()sDrrx p;u1oeeomf3ilsfm2rlnvon(4 rxoir3oa1fp rai il()tetr(m3oydlptelncsl(  2rrxroot1apx mfcild s2uaumo t)trxoxo oytlm  livo;s srumio3io1ll  mies () 2raurpot0aexo feiatfa2ean p u) lenxr3totfmtelu i;t0truoirpoy1lmeelnvtl( arraxmo;u1oet mf3tydfsDrau p;u)trermfcoa1op  luesl(0setoxm oy1amenlies (fsrtrumpot0aee mfeiadfaDelums;t) rtnir3oodomDranes;t t2toiopiu1ll emicsa() 2rr(rp;t1openmf3tas aDrmuvp (0tleomr iadlateanvols0trtr(r3iydape mnvsltf 2rr(ro;t0tle  oeiyt sDul( o (4trtrirciytfat aneils  2uoxo3io1opee nesas srrmx oou0aee ii3ildfm2eauvsnt) lxoxrctadop r u o;s  2urimpio4ameemnetl()arumu  ;o0olt  i3iatfm uanms;u0 lenxocto1oa ran o s)seuoirpiydolt  ivtat  2um(m ;u1aex  i3tytlsDemu s t)altomfcty1fa eaivs t) 2tm(m3iudol  lfvtas) rurx pou4tltn ociaslaDraump u0treoio3oadlptelivi () eurxopiudomtelfcsa(f Dtmxmonu0olt mociaslm um(mp;t0 rxoir oydomt  ivo;t seuo(o iy4ape lneia(fa2tmum ot4oexo feilsfmDumnvonu)alxnmfctydlm eau o t)trxmiopoudop nmfvs ()arum(r no0tpeniieiytfs el(vs;u) eermoctadoa  ln il(0trxrim oydamtelnet sfaDrmx  ou4tetomieiys m2rl(vs u) rxomfciodomD lneo;t seurxm nu4aptemivtas s2ur(root0oetoio3ilslsDrlnmp t4teeomr3todomDe uvsls s2toxo3nudol  mies tf 2tm(ronu0aleoiieild mDemnvp t0aeerir3oodoaDr uvo t)setr(mpny4lm nmncil() Dumumoot1tee moetatla2ra(mp;t)alxrir iatlmD  uei s0 2ur(o3nodlp  lies tfsrtaxm ;t4altnioctyt a uauvp (0 exoxf iodfmteau sls  etoxrpnu1alee fes t  2ururpot1apx  feiad s2umumon(0arenmr io1lm r n s;s) etrir3no4omte ies () 2rr(r ot1tpxnmictatlaDua( snu) etnmo3tydfptelu ilt0srxrxr3ou1apte nctasfartm(mpno4oexomi3iasfm2ra( p;t0 leomr3oo1omDe n o;t0 euo(m3iu4olen fvtls)aDum(mo;u4oetn o3iltfa2el( s;t0alxoiociadla r ies;(0trxmxr iu4ap  mnesat  rua(mono0oetn ictldla rm( p;u0 rxomfcoodlpD anesls seumiopoydlme  nei (f Dtrxr ot4tpto f3iatls2uln s;t) lxoio ty1fpD luei;(0t2uoir nodope  nesas) rraxrp;u1oex mf3iltlm eanmp;u4aeeoxo tadfp elivi;s texoio3oy1lmt  nes s aDra(  ;o1ole  ociytfm2ua(vp;u0areniocoatfp eli s (0setrir3iydol nmfesl()arrauroou1ale moctls mDrluvp;t4artoio iatfpD  nesls0setoim oydlpeemnetlt srrrxm nt0aee mfeiat sDrmumont4trtrif oa1fmtelnes s tetrirpnudalt lnes sfsruaurpnt1apxomf3iydlmDel(vp;t4alxrio tytfateauvsls) 2xmxrpoo4apt  fci () rrmxm ;u0opt  oeiydlmDrm(vo u)trenxrcoo1faD  u s s srtm(opio1open fvtls a2rr(root1aeenmo3ildlmDrmu p;u0 ltoxo iodomDeluvo t trum(opoy4oltn icsat)s2umurpno1alx mfeild s2eanvo;(4teeoif3oo1fat lnvsls s2uoxr nudaptelnvias)aDrax pot0oetoioeilsfm2emu o;u0areoxr to1opD ln ils  rxrio3no1lm emictlsf Dtmum ou0olxomo3tydfs2rlumo;(4 lerxf3oodop r nvol() eumxo oydolte fviat  rtrxro;o4oeenio3iasfs rm( p;(0alerircia1fpDe nvi ()t2uo(o3iodaptnlfesas  Dtauroot0oeen fetldfs2ulu p;(4 etrxo3oy1fmDe u olt  ruoxr3io1lp elfeta(f rrm( o;t4alxnmo3iysfm2ul(mp u4trtnio oydfa elnvi;( texrxm3ny4ame lictl(f rtmxmont4opt  ociydfs2rluvs;u0trtoio iadom ranvo;(  2uoxr3nodapeemnvsas aDtr(mp;u0aee  feiatfmDemnmp (0arerif3oa1oat lnvs;s0 2xm(mpoo1altemnvtl() rrmxmonu4apeomicils sDulnvp t0aetrxfcoa1opDeln o ( seumir3nodom nlfet ()srtmum oo4tet  f3tysla2rm(ms u) rtrio tadfpD ai ilt) eto(m iudap   fvs s s2trxm ;o1aeenio3iltlm2rl( pn() leomf3oydlaDr uei (  exm(r3nydole lfctlsf rurx pou1oeenmieiasls2ulnvpnu4alxomf3oadoat luvo t srtoir3io1oltelncsl( sDta(ro;o1tltnifciytlm eanvo (0 eermr3oy1fpD luesls  2xmxopoy1lm nlnctltfs2trxmpot0aleomoeiysfm2elu p;(0arenmr oo1lpteaivolt0trtoxopou4lmtnlieil(faDrau  ;u0optomf3tyt a ul(mo ()trtnxf3totfptr iei;t tetoir3oo1alt lics s srur(ront1alx  ictadfm emnvs t0 exrif3ootom rau i s0s2urxo3oo4apee ici s arurx  nt4texoif3ils mDem( p ()tleomr3tatfmtr u i (0 rxmxmpny4om  lfvt ( s2umxrpou4aetnmi3tld s2umumpnu4treoir oadlatran olt0texr(o3oodomt  neiltfarra( pot1teen i3ild s2umu o t0 ltrif tatomt luvols  2umim oo4ap   fcilsf Draxmp;t1aptniociltlm2um( o () rerio3totopDrlivo (0 rxr(o iydameelfvilsfs2rrx pnt4aet  ieiatlm2el( o u4aeermo iytfa   uvilt)tetrir iy4lpe lfeias  rtm( oou4tee  feildla ua( p (4 rermr todfptrli sls) rtoxopiydlp nlnesat)sDrr(m ;o1tpenmfeiys s umu ont0teenxr iadlaDrlneols0s2tm(o iy4ol elivil( s2uaumooo1teen feiaslsDul(ms;u)aeenif ty1op  li o t trurirpou4amte ietlt)s2ur( pou0ope mieiytfsDeanmp;u0arxrxfciodfa eanvil()tetrxr3nudaltemfciasfsrrm(ro;u0opeoiocilsfmDeaums u)aexrmr3iy1oa e ivilt)setmxm3iu4lmen ncsls)sDraurpou1oetn fciadfmDraumo;()tlxomocty1omt  ieo ( seto(r3ny1al e fei ()s2urxrp;t4texomfcils aDulnvont0 lenmf ty1oa elneo s) exoiopoy1apenmnei t  Dtrx  ;t1altomi3iasfa umuvp t4 rxrmoctotomD lneo s0 exmim oodllenlfvs t)aruax pno4aleo fciasls2uan s;u)aetniocoodoaD lnvi t0seum(o ou4ap  lneiasfa2tmu  nt1alxo ieiysfmDeanvp;t)arerxr3io1omt lu il()srto(r nodlleelncsls)sDrmxro;t0optn fciyt s emnms u4teenircoodom e u ilt tetoxo no4optnlnvsat s2tmum nu0olx ifetadfa rmnmont0aetrif iydlpt anvi t0seumxr3iydomen nvta( arrmxroot0oexn octys s2eluvs;t0 ltnxo3oatoatrluvilt trxrxm3oo4aleelicsas a2ta(r ;u0oee mociltla eluvsn(0aetrir iydoaDranvo;t)seurim io4ome  nctas aruaumpot0opto oeiytlaDeanmpnu)tlxomr oodlaD  nvslt  rxmimpiy4al n nviasfartrxmp;o1oet mocias s ra(ms;t4 etoiocta1fmtranvi s s2toirpoo1lp  lfvta(fs2rmu o;u0aex iociyd s2rln p;t4 lxnxo3iy1lpt auvi s s2tm(opiy4lpe mnvi ()s2rm( o;u1aleniietldfsDumumo;(4aexrmf3oy1oa eluei t0setmim3oydal nmnet t)srraxm nu0olxn ietad m ul( s (0 exoioctotla r neilt)t2urxo iy4op  lictlt s2urxm ou4texnmi3iatlm raump u0alermf tydfpDeli o;( srxmxmpiydom   ict (fa2rmxmonu4altoio3iat mDrlnvs u4 exrio3tadlp rluvi;t seuo(mpny4ale lneiatfarraump;u0opx if3ildfa eauvo;t)aeenmr iodoaD  i i;t0s2trir oudom emnctl( a2raurp;o4oee mocils s2umumo;u4alxnio oytomtrluvs t0srurirpnu4oltnmfetls aDta(  ou4tltomicild m2um( ont4texoif tatlaD anesls)sexoio3nudllt  ict (farua(root1alx mf3ias mDel(mo (4 eerir iytopt lu s s0seuoirpoodamee fetlsf 2tm( onu4aexo ociytla2rmuvp ()aetrmrcto1opDrluvi s)s2xrxm3oo1lme  fvslsfsDrax pnu0ope ifciyd s2emuvo;t)arxnxrcoatlp r n s t  rtm(opiydalee fvsl()sDururoou4tpe ii3iltfm ulnmonu0 leoirciy1opt livi ()t2ur(r iy1am  licia(fartmxm nu1oet if3ilsfa ua(vo t0arxnxo oo1fmt  ieils0seuo(o3iodop   ivias a2ta(ronu4oeeoioeilt aDrl(mp (4arxomf3iydlpt lu i;s trxmim3nu4lpe lnvs sfaDtrxmo;t0texnmi3tadfmDum(mp;u4texoxf3oo1fatelivolt) 2uoimpno4ap   feiat  Dtm(rpnu0tetn i3ild sDrm(vo;(0 lenif3iytlp e uvi t0s2umxr oy4ll  lfvt tfarua( pnt1ale iociyslsDel( o u4 rtrxfciotlatrau i;t)trxoim oodlm   fviatfartrxrpnt1optoiocildfs2rl(mpnu0texrxrcoo1lpD lueolt0srurio ny4omenmnvt s sDuaxr nu0apx  ietlsla2umu o;(0alenio iydfpteauei (0seumir no4lpeelncs s  2rrx pnt0opt  ocias a2rm( pnu0aeeoirciodlatelivs ( trumio iudomt lnvi ( aDrrxmo;t1apt ioeild s2ea(vsnu4teerxf oadfaD  nvs;t t2xrxmpny4lp nlict tf 2rm(r ;t0oee mo3iltlm ranvs;u0 eenio oatfaDr ueo;s trtoxrpoy4opeemfeiat)aruru  nu1ope  ociatla ua(mon(4tleoxf3tydomtelnvo;()srtrxrpnu1lpt  netat)sDurum ;t0oet  ociydlaDeln snt4alxnif3iotoaDe n i s  eto(opiu1altnmfvi sfaDtm(r oo0alenmoctldfs2rlumo (0tltnmr3ty1omDr uvs;t)trtrxo no1op nlnct sfaDrrxroot0ale moctadfm rmnvp;u0tlenxo iytfpte ivilt0t2uo(r3iy1lltemfvtl( s2rru  oo4alxomfciadlm2umn pn() rxoxo iodfp   nvs;t) 2xrirpoudameemfei s)sDtmx ooo1aeto i3iasls2emump;t4 lxoio3iy1lp raieslt0srtrxo3iydaptnmnvs sf Dumu p;t1optoif3tytls rl(vp (0aexrio3oatfat ai ils t2xrimpny4lltnlfcilsfsDtrxr ou4olx  ietldlsDeau p u) etrxr tydoptelnvs t srxrxr iudlmenlietl( aDurx pno1apeoioetldlm rmuvs;(4teermr oo1om rli s;t t2uoxm3io4lmen net sfsDur(mpno4tetn oeiltfa2ea(vo u) etoir3to1fmteanvi t0setrim iudol  micsas aDum(r no1tpxo o3iyt aDeau p;u4aeeomf oo1omD lu slt0trto(m3no1am elfcslt)a2um( onu4olto oeildfm2ea(ms;(4alerifciy1fp  aneo;t0trtoim iu4omt lfvtls aDuru ont1apto f3iyslsDrmnmsnt0aeenmrciydfp elneslt) eurxr3io4lmte feilt s2ururo;u1teeomf3tasfs elumsnt)artomfcty1lpte uvils  rtrir3iu1ole mfcsat)s2rrxr nu1tpxnmoctlslm eaumo;u)texniocia1op r n ilt)t2xoxr3iudape  netat sDtmur ot1tlxomfeiyd s ra( o;u)areoxr3tytomD livs;s) exoim oy1ol nmfvt s  rrmu ono1opeoifetld s2rl(von(4altnio3ia1oaDe ues;s0 euo(m3iu1ame lfetat) ruaxmpno4aetn f3tls s2umums;u)texrxr oytop raivilt)sexoxm no4lptelnvt (fa2trx pnu4tpt ioetldfm ulnmont)tltoio io1fptrlnvs t  ruoir3oodlp n icils  2rau pou4ole if3iydfm umuvpnu0trtrxr3totlpteauvslt)teuo(rpio1lp emnvs t)sDum(mont0ape moeiytla2rm(ms t4trermo tytfat li ol()sexmxm3oydll  mictls s2taum no1tetomf3ilsfm2rluvs;t) lxrxo oydfm e u s;s)texrxo3nu1lpe lfvi (faDta(  ;t0aeeoii3iad m ea(mo u4 etomr tatlpte uei s0 2trxm oudolee fes (fa2rr(  oo1opx mf3iysfm2uln pnt0tetoir3tadlmtelueo;s0sexmxm no4aptnlies t arra(ront0alt mietatlmDem(vp;t4artnif3io1oat  neo s0sexmir iodamtnmivia(f ruax p;o1apeomi3ildfa uln p;t0altoxo3iy1fmDelieilt trxrio3nu1opte iesas)artm(mpno4tleoioetltlm2uanmp t4aetoio3oydomte ivi;( t2tmiopoudam n ivias a2rax o;t1open ieiydfm2elnms (0tetrio3oadoa elieilt)trxoxm oydlp  miei ()s2ururono0teenioetatfs2ranms (0arxrxfcootfmDrluvil(  2xoxmpio1opte fcs tf rumumoot4olxoioetys s rlnvsnt4aetrmfcio1lp rauvi ()srxoxopoy4ome lict ( s2raxm ;t4aptnmfeils a2umuvpnt)aetnxrcoa1om   uvols0sexm(r3iu4optemicslt s2raxm ou4aex  ieiasfs2rm( pnt4treoir tydlaDr ies;() 2tr(o oy4lmenlnetlt  2trum nt1oltn ietlsls uln pnu)tetrxf io1fpt aueils0s2ur(o3ny4om nmivt tf Draurpnu0apenmi3iltfm2eanvp;t) lxoir3iotfmtraneo;()tetoxmpou1apt mfvil(fartmumo;t4oet mfetlsla2eln pnt0trxnif3io1oat  iei s)tetrxmpou4op e iviat) Drrxr ;u1olxnioeiadlm2emn snu4 etrio3oy1oa eai i s) rur(opiu1olee fes tfsrrm( pnu4apxn oetyt sDrm(vs (4tltomf totop rli s s  rtmio3iu1openmivsl()aDurxr oo1olt ioeiad a rlumpn(0aexnir3ta1faDr n i;s s2uo(o3oo4aptn nvslt)s2rrxr nt4tlt mf3iltfa2eaump;t4altrxfcootfaDe i i (0t2tm(m3ny1oleemivtlsf 2uaumoot4oexniociltfa ulnvsnu4 rtoif oydlpDrlies;s s2xoirpiodal   ncsatfaDta(mpno4alt  o3tad m em(mp;(0treoio iy1fm e n o s)seuriopnodlp   feslsfsDururpnt0oeenioetlslsDemuvs;u4arenmo3totoptelu i;t s2xr(opou1amt mfvtltfsrrrumono4oee ifeiytla2rm( o t0aeeomrciadlpt  nvols)trxoxo3oydopee ncsltfsDrm(r nt0opxnif3ils a ul( s;u4tltrir3iytlptrauvsls)t2trim3oy4olenlfvsa(fsDraxm ou4tleoifetltlsDrmn p;t0altoxo ootlmtranvs s)t2xrio3iy4am emfvsat sDurxmont4aee ifeiltlmDem(ms;()aleoxfciodfat aneo;t0srtrxm oodlltn netas) Dtaumpot1apenioctasfs2ulu o;u4texoiociotoate uesl(  rxrimpou4lp  mfei sfs2tau pot1oexomo3iysls ul(mpn() eermrctotfmtr ivo t)seuoio3oo1op emfcsas  Duaxrpnu1tex mfetadls eauvsn() rerxr oo1lpDelieo;()setm(rpiodlmen ivtas aDumurono1apto f3iltlsDrlump (0 exoir3ia1lpDrai s;(0srtmirpio1optelnctls)arua(m no4oee ii3iysfaDrl( pnu0tltoiocoo1omt auvo;s) exo(m oo4amtelncsa()sDumum ;u0teeo icilt mDuln p ()aeermrctadom rau s;(  rtm(m ny4lm  lfeias)s2urxrooo0aet io3iadfm2rlnmp u0trxoif3to1oa r iei;s0t2xmxr3iydlpt mictl()sDtaur ;o1tet mictadfa2ea(mont0 leoxr ta1om   nvs;( texo(o nodamenlfvia(f 2tru poo1apxnmfeiatla em(vsnt4trtrmo io1fate n slt) rtm(mpou4op elneilt sDtauronu0ale  o3tat s2rl( o t)trerxf3iodlmte nvi ( trtmir3oo4opt lfvt s  2tmurono4alto fciatlsDua(msnu0trtoircta1latr n o s  euoxm oodaltnlicias) Dururp;u4opto fcilslmDemu o;u4tetnmf oatla  an slt) etrxm3oo4altelivsat) 2ta(mpoo0tlxnmfeiysls2ulnvonu4aetnmfctydfmD lies;(0s2xrio3oo1olte nci tf 2um(rpno1alxn ieiad aDea(vont)tltoio ootfp rli ils0 rum(o iy4olt lfcs ( a2urxro;u1tle ii3ild s2ea(monu) leniocta1fa rli s t)trxoimpoy4oltnmncslt  2tax  no0opeoif3iasfm rl( p (4tetnmocoatlp e ieo (0seum(r io4amt mfvia( artmu ont1tex mfciasfa rl(mo u)trxomr3iodla eaiesls) ruoio3oo4lmen nei s  2tau p;t4tpenif3ilslsDea( snt4aeenmr iy1opt anes t s2xm(m io1optn nes (fartmx ooo4alt iociasfa2ean snu)altomf3iytfp   nvs;t)trxr(opno1apeelneta(  2tax  nt4tetomi3tadfa2rm( s (0 eerxfcoytoatranvslt0s2tmxrpno4ap nmivtas) rraxmpno4alt  iciadla ea(mp;()trtomf totlmDeanvi s0 eum(opiy1lmenlietls sDrrxmo;u1texoii3ias m raump (0trermrctotlmtraivs (0trumxo io4omtnlnesl()sDua(  ;t1alt  ociysfa2ran o u4tltomr tatopD lueil(0 eto(m io1ope lfes s)aDta(  ot4apenifcilsla2emu o t)trxnxo3ia1lmtelnei s0texrxo nodopte feiatf Dumum ;o4apenmfeiatls uanvon(0areoio3oydfmt lnvs (  rur(r iy1llenmnei (  rua(  nt4aleniieiatla elnmont)alenxocoydfa  aueo s  2xrimpoodamen nctlsfsrumump;u4oetomi3iysls2umnmo;t0areoxo3to1omte nvils) rtmxr nydal nmieils a2tau o;u4tltnmfctaslm umnvs (0arxnircoa1la  au i;( s2xrxm oydol n fvta(fsDraxrp;u0oeeo fciydla umuvpnu0aleomo3oodoa elues;t)seurxrpny1lmtelfesltfa2raur ;o0oltomo3iat a ea(monu0trenxociatfaDraueo;t)trumimpoy1lmeelfct (f rrrxrpno1tltn f3iadfmDemump t)aexoio oy1fat ln i;t0 rxriopiy1apt  nvtas)artmu pou1tpe  o3iys s2ulump t)arerioctydlmtrlu slt srxr(m ny1lleemnet s  2tmxm no1ape  f3iyd s2eaump;t)aexrxrciy1fm  li slt0tetrir3iudolenmfvta()s2um(  no0ape if3ilt s elu o u)aeerir todfpt aneils)setoio no4lme lfet s)a2um(rono1oleomieias m rlu s;u) eenmo iydlat  n ols seum(opnodaptn fcsat artaum ;t4tptnii3iyt m ua( o;t)alxnmrciydfa e ivsl() 2xoxo3iudaleemnci s aDurxmoot0oee  i3ilt a umu o t)areoir oatlptelu i ( srtoxm nodom  mfvil(  2umx o;o1tpxnii3ild aDeanmp u4teeoiociatfpt livo;s0teuo(opiy1alen ieils arrr(ro;u0aetomiciydfa emuvsnu4 reomocootfmDeaivil( trxriopio1ap e fvi sfs2ua(mo;o0tet mfeiatlaDem( p () rxnmo tadfaDrauvs () 2trxr nydapte net tfs2rax poo0tltoifcildls uaums t4tleoir oy1fm  lies t0s2trxmpnydoptnlfetlt sruru  ;o1tpxn fciytfs2emu s t4treomf oatlat lnvslt0 rxmir3iydap emics (f Drax  ot0oee  ieiad mDua(ms u4 etrxociytfpDraneo (  eurxm3io1lm elietls) 2taumooo0ale if3ilslmDea(vs;u0aexrir oa1lat lnei ( tetmiopoodlpt miet t  2umxmpot4tpxoifctytlsDemu snu4tetoifcty1op   uvo s0t2urxm3iodll nmnvtls arrrxmpnu0optnifciat sDrmnmp ()tlenxf3ta1oaDraivol(  rtrir3ou1ale mfetls) rtrxr ;o1tlen oeiatlsDumump u)aetrxo iotop eauei (0trtrirpiy1omtelietatfs2rax pnu1texnmf3ild s2elumo;t4trerir3to1lat aues s)setoir oy1optn ivs ()a2umx ooo0apxo ieiys a ulump t4arenmo3iadlmtrlnvs s0 2xrir3iodap emfvsa(fs2ua(mpot1tex ioetldla rl(vo t0 leoifcoydlaD lieilt)t2xoxmpiodlpen icia(fsDraurpnt4tpenmoeiyt a rm( s;u0arenir iotlp rli olt) etmirpno1lptelfei t)srumu o;t0oexomiciytfsDemuvs t0aeeoir3oadoat lneslt t2uo(opoy1alt  fvilt  2taxm nu4opx ii3ias s2um( p u4tleoxr oytom ean o (0sexm(m3iu4ope mfvsl(fsDta(r nt0oexo f3iyd mDumnmont)aeerio oo1opDrliei (0 etmxopoy4ope mnctl()artm(rono0olxo oetytfs ran p t)treomf3iatfmteauvs (0trtrxm ny4olenlfvta( srtauronu4tlxomieiltfa elumpnt) eeoxfcoytlptr uvs;s0texmxr3nudlmt lfeta(  rtax onu0oexoioctlsfa ua(vs t4 rerif to1oatelneo;t0 2xoir3nodape livi (f 2ur(mpno0oetnmociyd a2rm(vo t4 exnir3totoatraiei s0teumxo nudapenlnvt tfaDtmx ono0tltniieias m ulu onu)tlxomfcta1optr nvs s0 etoxr oy1ll elictls)aDur(rono0ole  ictyt aDrl(vpn()arxnxr totfaD  nes;s texr(r3no4lptn nctls sDum(mp;o4apxnio3ils mDrm(vp;(4trxrio iotomDrlnei t0s2urxmpou1lpeemicsls)arumumpno0olt  feiyslsDeanms;t0alxnmr oodlm elu i s truoxopiudal nlicils  2rru pno4teeo f3tyd mDrln s u4tleoxoctodlm  anes;t) 2urirpoy1omeelfcil( s2uax o;t1opxn oetys mDeluvsnu4 rtnmr oydla r ivi;s)t2ur(rpoo1altnmnvsat  Drax pnu1optn i3iasfm2eln p;t) rtnmrcty1fmt  n il( sexrxo3iu4ole lneta( aDumx  no0tpxoifciytlm2el( snu4aeeoxo3to1lmDeauvs;()trtmir3iudol n nciltfsrta(mpno0oee mf3iltlaDua( s;t)aetoxr3tydlat  ies;(0texrxrpno1lmt  fvsasfsrrmxmoou0oeeniociys m2umuvo;(4tltnmf oodfp eln i;t  2urim3nodomeemnvsltfa2tau oot1aeenmoetasls2ranvon(0arxrxr3oy1omte ivolt0srtrxr3iu4op   icilt) rrm(r ot0aexomf3iasfs um(mo;(0 etrif3oo1lmteaies;()trurio ou4apenmicsa(  Duax  ;u1tlxo feiyd a uauvo;t)tlxrxo3oadfp  aieo;s)sexrir nu4ome lnctlt sDuax  ;u0ole ifetyd s uanvon()aetrxo tatlpt auei s  euoxm nydlptn icta()arrm(r ;t0apeo ociysfm ra( s;t)aetnmf3totomte ueil()trumio3nodlptn fctat s2um(  ou4altn fctls m ranmonu)aleomo oy1op e nvo (0 rurio iu1ome livs sfa2urum ;t4olto fctlslaDelnmsnt4 lxnmr3ta1fpt  n ol() rto(mpiydamen fcilsfaDumx  nt1aeenif3iat aDemnmont) lxriocoytopt  ueils0 2xoxrpiy4lmen netls) rrau  nt1alx moeiltlsDuanms t)tlxnmf iy1fmtrlivs (  rtm(mpou1lm  lfciat s2ua(mo;u1tpt ioetasfsDulnvs ()aetriocoydop ranvo;s)seumim3oudam elneias  Drmxmpot0tlt io3ilslsDrauvo;t0trxoxociodoatelues;(0trtmxopiudop   fcsas aDrrxmpno1opx mi3ildfm2elump u)tlenxociytfaDraneo;s teumxr3iodap   fvsas)artrx  ;o4tpeo feilt sDua( s;u4 leomo3ia1lmDr ues;s) 2tmxo nudomen fcslsfs2ra(m nu1aexo ocildla2eanms ()arerifcoadfaDeanvi;()trxo(r ny1am  lnci s) rumxr ou1oeeomfcias aDumuvs;t4 lxrxr3iydomDeluvs;t0trtoxo oo4alt mfvtat s2taurp;o0oex io3ilt m raums;t4teenxr3iy1opDrau sls s2tr(r3ou1amenmicsl() rtaxrpou1tpx iieiytfsDemnms;t4arxoif oatoaDr ueo s) 2xoim ou1lpeemicta( aDtrumoot1ope mociat m2ea(mo;t4arerxf tydfm   neols0 2xoxr3iy1altelfetas)a2um(mo;u0tpto ociydlm em(mp;t4 eenif oa1fa e ueslt setrxr iy1apee nvslt  rraurooo1tlx  i3tat s eau o t) renmfciatoaD  nvsls)trtmxm3iu1lpte fvslsfa2taxrpnt0olx  feilsls eau s t4tlxrir oatfptr n o ( tetmxr ou4ol e ieils arraxmpnt0openmocild a2umnms u)arerir iytomDr n s;s0truo(m3io1lp e fes ( aDrm(rpnt4oexoio3iyd m el( o u4 lxoxrciytom raues;t0texoxo iydome  feslt)aDuax  ot4alx mo3ilt aDel(ms;t4 rtnxoctatfpD lu i;s)setmio oy4lpeemnvils)artmx o;u0tlx  fctlt m2em(vp t4aetnmr3oatfpte n s;t) 2urio no4ol e net sfa2rmxmpot4aeto f3iltlmDuanvpnt)tetomo3oo1fmDr iesl( s2tmxo iodll e ivi tfa2tr(mpou4tpxnio3tatfa rmnvon(4artnmr3oytoaD lnes;()sexmxr oudopt lics sfartmx  ot4aex iictyd sDul(vo u)tlenxo3iydlatr uei;( seuo(rpny4om   iet ( sDrm(ro;t4alxomi3tad aDemnmp;u4arxrio iy1lat ai slt) etmimpiy1oltnlncs s  Drmxr nt1aexn oeildls2umnms u)tlxnxf tydfp elu i;t t2trxm3oydll  mnesasf 2taur ;u0ale  ieildfa um( s t4arermf to1om  ai sl(0 etriopiu1ome mfesl(fartmur no4tleo i3iytfa2emnmo;u4 rxnxr3iatlpt  neilt)trxmiopnodam elnct tfsDrru  no0apeoiiciadlm2emu s u)trtrmf3oatopD lies s trxo(r iy1apee iesa(  Dumu  ou0altn fctls aDel(ms;()tltnxf3iatfaDeaneo;t0seur(opoodolte fvi ()a2ua(mont1aee  fciasfmDemuvont)teenxo oodlp elu o t)trtmxopiu1am e ncia() rum(rpoo1aexoii3iatlaDeanvpnt)trtrxociytop rliei (0 2toxm oudllenmnei (fartrurpou1aexnmo3ias mDranms;t)arxnmf iatomD  nvo ()trxm(opio4apen fvtat)a2trxrooo4teen ictydlaDra(msn(0tltrxf3iotlmD au s t  2xoxmpny1ol e nvt (fs2rmxr oo4oee mfetaslaDrau p t)arenxo ty1lp eln sls srtr(mpio1oleelnesl()s2rr(m ;u4ope mociatfs ranvo u4 eerir ootomte u s s0truoxr3iy4aptnlfcilt aDtax  no1oexnifcils a2em( o;u0 renif3iytlpt an s t)trxrim3oydam nlfeta(f Dur(mp;o1olxn o3ias s uau pn(0tetrxr iydfatelnes;(  rtr(r oodlp   ivias  rrmu o;u1optniietasfm ulnvo (4arxnxf ty1oa e i s t  rtoxm3nu1lmt liesatfa2umumont4aexnmfciadls2umumpnu0 rtnmf3iy1fp r ivs t s2urxr3oo1lm n netlt aDur( pou0tptnii3iatfa rm(vp u4aexnxf totoaDelnvo ( t2trxmpoy1llen nvta(f Drmx  nt4olx  ieildfa uanmpnt4tlerirctatom  ai o;s) rxrir no4olt lici ()sDtaxmpot0tlt iiciltfs elumpnt) ltnir3tydlaDe uvolt0 eumirpiydoltelici t sDrmurono1oetn fciyt a2ul( ont0 rxrmrctydlptrau s;s srtoirpiy1ape  nvilt srumu ooo4oetoifciatlmDuan s ()aexnirctydlmtean s;s) 2xm(mpou1ap emfci s)srurumpno1alenmo3iatlmDulnms t)trenifcootlpt aieo t) 2xr(opno4lpee ncsl(faDrrxm ou4tltoio3tydlmDrl(msnt0 eermo3iatla   uei;s t2um(m nu4oltn fei s aDraurpnt0tpeo ieias s2rm(msnt0aexoxfciadlp  lnvil( teuoxr3oudoptemici sfaDtr(rp;o1oleomfctltla2rl(mpn(4teeriocta1latelu o;t texo(m3iydapeelnciasf rtrx  no0opxo o3iatlmDea(mo (4 lenio3to1omDrlivilt s2xm(r3nodam   netls artaumpou4alxoiietltfa2el( s;(0tetoiociotopte ieil(  ruoxopnu1lle  nvt t) 2urxroou4apeniicild m2uau pn() etoxo tydfaDrlivolt0tetrxmpiy4apenmicsa(fsrumumpno1ape iietatfa2ulnvpnt4 eerxo oytomtr neo s setr(mpiodalen nctltf rrmuro;t1optniieiat a2uau pnt4tltoxoctatfmtraivi s)seuo(rpoo4lptnmfct t a2ur(m oo0opt moctydlm2rmuvpnt)altnxociydla  aneol() rtr(o oodole lnesls)artru poo0apxoif3iatls rlu pn() leriocto1lp ran ol(0 exmxm oydam nlfcsl( s2tm(  ;t0oltomicilt a2ul( s;t4arenxr tydomD lueil(  2toxr iy4al  lnviltf 2trxmpou1oet  fciydlm2el(vs;u)aexnirciodla  au il(  2uo(o3oo1aptelietas a2uru  ot1oeen ictatls elumo u)artrio3oadlp eluvolt0 2tmim no4op  lfvi s  rtmumonu0teto ieilsls rauvs;u4 lxrif3oatoptrlies s  rxrxr ny1ope  ncsat)a2umum no0alto ieilsla rl(vo;() rtoxo totfpD an o s0 rtmxr3iodape lfet () 2rau  ot0tex ioeiatfs rmn pnu4trxnxf oa1lmtraieo;(0s2toiopnu1ll e ieilt  2ua(r ;o4alxo ociydlsDulums t0arxrir3oy1fp  au s;t) 2uoim3oy1apte ivt t)arta(m no1tpenio3iad sDuln pnt4 rtnxr oadfp r nes ()srtoxo3nu1lme lfvi s sDtr( p;o4oetnmi3iasfm2emump;t)altomo3todlm eln ils)srxo(rpnodlp   nctat srrmxrpoo4tpxoifetltlmDranmo;u0 ltnmfcta1fa e i o t0teurxrpio1am   ncia()aDumxmpou1oee  fciltlaDumump t4 exnmo3ootlaD lues;() ruoxo3oo4omen fctltf rta(  ;t0apt ifctlt s2umnmo;u0teeoio3oydomt  u i t0 eumir iodamtnmicsas arurxmp;t4opx  f3iytla rm( s () renircty1omtrli s;()trxrim oy4amee ieslt  2uru o;t1ope ii3iltfsDul(ms;(4artomr tydfp rlivi t0t2toim iu1ap n fvta(  Dtrxro;u1opt  i3tysls2ea(vp;u)tlxnxr3oydlmt  ivsl(0 eum(m3io1ap  mfctlt  Dra(mo;u1aleniociatfa uanmp;()aeenmo3iadfm raivo;()t2um(opny4ape  icsl( sDrmxm ;t0oexn o3ilslmDumnms t4 reoircto1lmt aivi;(0seum(o io4lp nmnciat)sDraxrpot4tpe  fctltfs emuvonu4 rtnmf ootla   nvo t  ruo(m iy4ame mncs s arta(  nu0aleoifcilt m rl( pnt) ltoir tatoa ean i;s teuoxr3ou4ole livia()s2ra(mo;o4alx ifeiydfsDrlumonu)aeermo oo1oat auvs;(0t2xoim3oydolenlfvtas  Drrx  no0opt  ictlt s2umump;()aetrio3iadomt an i s  2tr(rpnu1aptemfvi s)a2rm(ro;u1apen o3tldfm2rm(vonu)altomo oodfmtr u i ()setmxmpou1ll elfcsltfs2um(m nu4opxnioeiydls2emnms;t0aexrmfcta1opt ai o;s  rxmxm iydop emfcia(f rrr(mpno1tltnmoeiydfsDel( s (0tlerxo iy1fpDrauei;s0 2tm(o3io4apenmncs t  2taxmonu1ape mietat s2uau o;() eeoxo3oadlpt aies s0srtmxmpiodlle mneilt aDtru  nu1altomf3iaslmDemn p;u)aexoif ia1fatelneo (0s2uriopoydlmeelieia(fsrtrx o;t4opxoif3ilsfs2eaums;t4trtnxfcty1oa  aieilt0trtoir3oudlltelfct s) rtrurpou0tlxo oeias s ulnvs;(0tlxoio3iadfatrau o t)trto(rpnodlmt lfviltfs2ta(  no4aetnioeiatfaDrmn o t)tlxoxr iotop   u o;t)t2uo(m3ny4lm  mnvil( arum(rpnt4aet moeiasls ranvsn()alermr tytom eluvo t0 exmir3ny4lme lnvt (f 2umx ono1tee mi3iadlm umnmo u)trxoifcoodlmD anvs ( trumimpio1olenlfesl()s2ururpou0tpt ioeild a elu p t4tlenir3iytlmDrluvo;s)trumir ou4lmtn ncsls)srtaumpoo0aeen ietytfs raump;()altrmo3iadfat  n o;t0s2umxr iydlp nmictat aDum(mp;t0apx  f3ilt a eauvont4tlxnxrciydlaDean sl()seurir3nu1om emivils)a2rmuro;o4alt ifcilt mDulu snt0treoxo tydlm ran ols)t2toim nu4lme licils)sDraxrp;t0tee iiciytls rmums;(4 exomr iodoa elu o s trto(m nydlmt lnvslsfsrrrumo;t4alt iociat s em(vsnt) rerxocoy1fm eaivol()texrxr3oo1opeemies s s2urumono0opto fciytlmDrmnms;u0 rxniociadlp rlnvol(0seuoxm3nodlm nmfvs t  Drmx  ;o1olxo fciaslmDemu o u)teerif oatopteaiei;( sexmxm3nudllen iesas s2rm(root0tltoifcildfs uau ont4aeeoxf3to1latr n s t)trxoxm3nu1apeemivi t s2rr(rpoo4oleoio3iad mDrlnmp t) etnirciatfaD lnvi t0s2umxm iudol e nesa()sDuaxrpot0oleoiiciysfa2uau o;t) lenxrciy1fpDe ieol()t2xo(m iodalee nci t)aDrrxrpot4open i3iysfsDrl( sn() rtnio3iadlp eauvolt trumxm3oudal nlfci s a2trxm oo0aeenmf3iadfaDuluvsnu)alxnxrcoydla rliei (  2xoimpoydapt mici t)arraur oo4tetoiiciltfm2ea(vpnu4 rxrio3iy1opt  nvs ( srurxm3ny1om   ieslt)sDtrx poo4teen ictlt s2eanvp;t4 lxomo tydlaDe n o (0trtr(rpio1lm n feil( aDur(mont4tltn feildfm2rm(vonu)artrir3ty1faDe n i t0trxoim3iu4oltelnviat  Drruront0opxniicild s elump u0artrmr3ty1fa rlnvo t) rtoiopoo4apenliesat sruax onu0tlxnio3tytfsDrauvp u0tetrmo tatop  anvi;(0 etoxmpno4olen ncsl( srtmxrooo1tlt  ociytla umnms (0texrmfciodlpte n o s t2tr(rpoo4ale mnetat)arua(  ou0oeenii3iydfa eanms;t0aleomfctatoaD aivs t) 2umim iu1lm  lnctatf ruaxmp;o4apx  i3tysfs eaumont4aeenxf3ta1fatelieo t) 2xm(m oydop nmnetl(fsDrmuro;u0aeen f3iltla2uanvo;()arxnif oo1la  ai o;( s2trxo oy4olt mnctat)sDuaxront4aptoif3tydla2ua(mo u4areoxr3iy1fat  n o () rxmxr iy1omenmfvi s)aDrau o;o0tle io3iat a ul( ont4 lxnxr todlmt  n i t teurxr3io1om  mnesa()aDtm(m oo1tle ifeiytfmDumnmpnt) lerxo3iy1op eauvs;t)sexr(opio4alte icsa() rrmu  no1tpx mfcias s2emump;u)artomfcoytfaDr nvil(0s2uo(m3ou1lpte nvt () rtrxm ou1apx  ocild aDum(vonu)aetoir3oydlm ranvs t0tetoim iudopt mncs sf 2rmumpno0tpx if3iydfaDrln o;(0 reoxo tatfaD  n o;t0 rxo(o3oodomtnlieia( s2tmxront1apxo fctysfaDrlnvs;u4alxoxr3todlp eaiei (0teur(m3oydlmtnlies s  2trxroou1oexniiciyd s uan p u0arxrmr iatoa elueo;()setr(o nodal nmnctat a2rm(  nt1ope  oeiad mDuln o;() exrxfcoydlmD auvs () rtr(r3iu4aleelneilt  rrr(r nt4aet moctasfa emnvs;(4treoio to1fpDe n s;t0srto(o3iu1op e icsl(fsrrr(m no4olt  oetadla2el(vp u) etrxocootlmD anvs;s s2xrxr nu1lpenmivsa()a2uau o;t4teeomo3iyt sDumn o;(4tltrmo oo1oat aivs ( trtriopoy1aptn iet s srrr( o;u1oltn ietytfmDrlu on()arxnxrcoa1fmtr i ol( teumimpiy4lmenlfvtltf 2raxr oo1tpenmfeiatfaDean s u4tlerxfciadoptean i s t2ur(m3oo1alee fvi t sDta( p;u1aeenmiciyt a2rmnvpnu4trxriocoodom  anei;s trxmio oudoltn icilt artm(ront1aee mictat a rlumo t4trxomo3oa1fmte uvo t0srxmimpnydlmenlncs sfa2rrxm nt4oet moeiatfa el( o u0trxoxr oa1fptr neo ( teuoxr3no4omt lneiatfs2umumpou1olxoio3iadfsDul(vs (4aexoif to1fmtrliei () 2umirpny1altnmnvtls  2tmu oou4tleniieilslm ua(mpn(0 eenir3ootomDeauvols0 rto(m3nudlp n fcta(f Dtr( ooo0aex  o3ildfm umnvo;u)altrmf ty1om rln i ()s2xm(mpiu4ll elivsa()a2urx ooo0oetnmf3ild s2rm( o;(0texriocoytfmtrln olt  2ur(r ny4lme mfvi t  rumxrp;t0aeen fcias s eanmp;(4aleomr ia1lmtrlnvs;(0sexrim3ou4ole mieia() 2rr(monu4ale  ieiydfa2rlu o ()teeomr3ia1oa rauei (0s2xmxmpoy4altnmfcia(fsDtau ont1aetomf3tys sDem( o;u4 lxrmocoo1lm rlnvsl(0 eur(r iudlltn nvtls)srur(ro;o1tptnif3iad s2emn s t4 rtomociydopD  n il() rxoxmpiudllt  ncil( artauroou4opxomociasls2rmu s;u0tlermocoytfm  lu o (  2tmxmpno1lltelfesat  rtrxro;u4opx mietldfmDrmumo (4alxnmocoadfptr uvi (  rxrio iydlptemieiatf rra(  ot0oetnmiciltfs emums (4teenxf3ta1laDe ivi;t0srurxr oodap n fcsa()artmx oou4openii3tlsfm2ra( snu0arxnxr ia1oa rlies;(0srxrxr3iydlle  ncsas a2rax pnt4tptomf3iys mDelu p (0aexnxr3ta1fmt  ueo;t0 2tm(mpiudolen fvtl()arraurp;t1apx  ieildlmDuln o;t) rtoxo3tatfpDrlu i s  etoim oydop e fcsa( aDtmumooo0tlxnmoetld aDea( s t4arxnif oytlaDraies;(0truoxrpou1am   fesa()sDraxmp;t4tpt iicildfs rau ont) ltrifciotfa elu o;s)texr(o3ou1amee fvsat  2tmx pno0apx  i3iytfm2rlnvo ()trxomoctydfaDr i ol( trtmir oy4ap nlfctl( a2rr(ro;t0open fctaslsDean s;t0 lerxf3iotopte i s;(0trxo(r3no1ap  lieiasfs2umxmp;o1tlxnmfeiytfaDrlump;t4aeeomr3tatlmtr uvs (0srxm(r ou4apee nvi ( artm(r oo4aptnifetydfa el(msn(4trxoio oydlm eauesl()teumir3oydom elivsl() Dtau p;o0alen i3iat s2ra( pnt0aetrir ty1lmD  n i;t0 2ur(m iy4opeelncsat  rrr(root1tlto ietyd s ranvon(0 lxoxfctatlp e nvo t s2uo(mpnu4alte fvsl()aDumxrp;t4ope mictatlsDrm( p;() rtrxf3oo1faD  i o;s) 2xmimpny1alt mfctat  Drax oou4olxo iciadfm2eanmp t0 ltnxrciatlmtrlu s () rxoxopnydapen fei tfa2urum no0tltn i3tltfsDelnvsnt4texomf oydlm eluvi;t  2tr(m3oo1omte ivilt aDtmuront1teenioeiasfm uluvp t4 leoiociodlatr ueo;( setrxr3oydope  iei t) 2uaxmp;t4tltoiiciasls emn p;t0teeriociytfmD  neol(0s2trio3iodop   nesat s2taumpno1tetoifctyt m eanmp (0arxomrciodlm rlieslt0 eto(o3iudol e nctl( artmxro;t0apenifeildls2ulnmsnu4aetoio3oodlmtelneo;s0sruoxmpny4omt mnvia( arur(  nu0oltomfetydfsDeauvo u4teeoio iodfpDe ues;s)s2toxmpnydape mict (f rum(  ;u0tpxoif3ilt s2ranmo;u0aexrmr iatoptr nes;t)s2xoxmpnodale  fci ()s2tmxr ;t0apto f3tlslmDemnvsnu0arxrmr3tadoa  livs s t2tmio3io1al   nei tf Dta(mpou4tpe ii3iysfa emuvs;(4 ltoio3io1laD livilt)trxmim oudap nmivilt)srraxr oo1ape ifciydlmDum(mpnu)artoxfcoatoatraiei;s0srtm(o nodlm emfvi t  2raxm nu0tetomo3iysfa2elnvs u) eerxr iatopte i o (0 rtm(r3nu1lm emnvtl(  2urxrpot4apxn ieiyd a uaumo;u0artnmrctatfp   uvo;t) rum(rpiudopen nvilt) 2tm(r ou0aetnmfctyt a um(vpnt0 ltrifctodom elu sl(0s2urim3oo1ope  nct t  Dumum ;o1altnmf3iadfm ua(vo (4altoxfcta1opD lu s;s srxr(opiu1opt  ieil(farraurpno0oleomociadla rm(vs u0alxrif3iy1laDr nei s)s2tr(opnodal emnvs t  Dumump;t4olenmoetadls ea( o;u)teermf3iy1lmtrluvsl(  euoxo nudol n nctls a2uaxmono4oltniieildfsDulu pnt0tlenxo3tytfm rlnesls)s2xmxrpnu4aleemfcsl()a2tr(rp;o0alxomicildlaDeau pnu4tlxrxf oy1lp eai ol( s2umxopiu4lm emnci tf 2ra(r ;t4olxomicilsla rmnmonu4 lerxo3tatlm   n olt  euoiopiydomt  ncslt) rta( pno0aetoifciydfsDulumo;(0 renir3iydfptr nvil() 2xmxr ny4al e feslsfarur( p;u0tltomf3iaslsDeauvp;u0aeermo oatlp  auvsl()s2trxopiydom  mietas artrx  ;o1tpe  oeilsls ulnmo u) ltnxf3oy1lp r nvilt0 rtoxo3oodalt mncsl( srumumpoo0oltnmi3tysfm2rlu s u4arxoxo ta1opt li sl() exrir3iy1op  mnes (fsDum(mp;o0altn octaslmDuln p u) exoircto1fm r u i t) eur(m iy1ale  nctat) 2uru p;u1apxnioeiltlm2ea(mp;()alerxf3ta1op raivs (0t2ur(o oodapee nvsltf 2ur(rpno1tptniicilslm2ulnvp;t0altoxrctodfmDe u i;(  rxriopiy1ll e nvilt a2rm(rooo1oltomfeils aDul(vs (0 eeomrctytopteaieo s  eumir3no1op   fciasfs2trxrpot1aex ifciatfs ra(mp;u0 etoir3ootlm  aies;t)srtoim3no4ll   feiltf 2tm(mpot4apx iiciysfs ulnvs;(4tlxnircto1la r u i s srurxm3iu1ll emnet tfs2ur( poo1oltn ocild a ra(mpn(0aetrio tytomDe nvil( s2tr(mpoo4lleemnvsa(farrmum oo0tpeo ictasfaDea(vs;(0alxoxfcoy1op  li i;s)srtm(rpoydlmt  fvs ( arumurp;u0oeeoifciysfm2uan p;() renmf totfateln o;t0 ruoim ny1open nvsat)arur(rpnt1altnmieiytlaDrlu s;u)aetoir totfpt ln s ()srtmim nu1lltnlivtlt sDrmu pou0texnifciydfm2eln pn(0arxoircoadom eli s;( texr(o3iu1ame  icil(f Drax p;u1oeto o3iasls2uan s u4texoif3ta1fmDrauvo (0 rum(m iu1lmtnmicsa() 2umxroou4tlt io3tatfs eauvs (0artrmfcootfmte nvsls tetmio nydlpeelneta( srtaurpot4apxnmi3tyd aDul(vonu4tetnxrctytfateli i;t0t2uoxrpoudome  feslsf rurxmpnu4opxoiiciyd a eln s u4 eerxo3tadfmtelueilt) euo(opoo1omenlnctlt)aDtmumpou1olt mi3iltfm emnvpn(0 renmr io1op  aues s0trxmxr3nydap  mfvtat artrurpnt1aeeo ieiatlm eanmo u0 lxrifctadop eaieo;t  exm(opnydllt  ivs ()arrrxrpnt0olx mo3iasfsDrlump () etnifcoydoaD livols0 rtr(opiu4omeemfvsas)aDrmurp;u1aetnmfeiasls el( pnt0teerif3tadfp  aues;( t2toxopou4lpeelnciasfsrrmx pou0tet  f3tyt m rm(mo (4artrmr3oa1fa elu o;() 2urimpnu4op   nes ()arrrx  nt0tptoifeildfm2elumsnu0altoio iotopD livs ( teto(o3ny4olenmfctat  Dtmuro;u0optoif3taslsDrlumo;()artnmfcoy1fatr ieo;t)seumimpoy1llenmivt s  rtrxrooo0alt  ociatla rlums;(4texnif oo1lp rlu s t) 2xmio iu4aptemfcilsf 2tauroot4tpxn f3tlt a elump u) renxr iatfmte ivilt teuoimpnodale mfvilt) 2tax p;u4tleo ietlsfs2emn snt0aleomr ia1omDrau o;s s2xmxr oy1lm n fvs sfsrtaxr oo4aeen oeiltfaDemumon() exoircoadopt lueils)sexoxo3ny4oltnlnctlt srrrxroou1texo o3tyslm eanmont4 exnmf3oydfmDraivs t setmio3io1lpe mnesat)srrmxmont0aeenmociasls emuvp;u) lenifcty1opDe uvs;t0srtrir oo1lltnlfeil(  rtr(moot1oleo ictasfm ulnvsnu0alxomf3ootomtean s t0trtmio3no4ameelnvsat) rtrxm ou4tee  icilslm ra( o u0tltrmoctadoa eaies;s s2tr(m3nu4am elnes tf rtax o;o1alxoio3iys mDulnms t)tlermo3oodla e nei (0srxo(o ou4lpt  fvil( a2tax  ;o1ole if3ild s2eau o;t)arxrif3ootoaD anvo;s0sexm(o oudolte nvsat  2tm(mpno0tpxnmfeildfs2emu p t) eeomfctotfp rauei;s)setmio3nu1amtn fvsa()srtaum ;u1tlt mfcilsfm2rlu s t0tltoxfcoy1om rluvol( srurio nydope mnetlt) 2ua(mpno4oeeoifcilsfaDean onu4areoio3totlmD  nvo s t2umiopoydol   icil()a2rmumono1tleomf3ilsfsDrauvo;(0trtoir3iotom  au ilt sexm(r io1ap e fvs ( srtru onu0oeeoiociat a2rluvonu)trtomrciydlatrluvo;s texmxm3iy4amt  ivta( s2ta(ro;t0oetoii3tlsls2ul(mp;t0 rerif iytlm eau i ()srtmim nodlpenlfvta( s2taxr oo0teto i3tasfs ulu o t0aetoioctodlpt lnesl() 2xoxrpiu1llt  ncsltfs2umu pnt4alen oetydls ulu p;u) rtnxf ta1latrai il()sexmxr3oo1olen icsasfsrtaum oo4apxnif3iyt mDuanvs u4tlxrxrctytom rli i s  rtm(mpnu1am elivt (fsrurx ono4oeeoiicias a raumo;(0trerir3iodfm r ues;s0 euoimpiu4olt livi t)aDuaumono4oee  i3iad m el( pnu4 rxrircto1fa   nei s srumirpoy4alt lieilt)aDuaumpou0oexomictytfa2ean p (4alerxr iytoat lnvi;()texo(m oodolen ivsas arumumo;t0aeeniociadfa umnvs u4 reoxf3tadfmt  ieolt)srxoxo nu1ameemnetl(f rtmumpoo0apt  fetasfaDrmnmp;u0alxnirctodop  lu o;()texr(o oudlpee fciltfarurx p;o1aetnmo3iltlm uanvs t0alermfciotoptrluvo;() rtmxopny4lltn fcilt)aDrm(rp;u1tlxn f3taslaDrl(vp;t4 rtoif oo1opDe uvilt)trumimpiy1om nlnvs s) rtr(m no4aet mocilsfaDulnmp;u0trxnxo3oydfpDr n o;s  rtmxmpoo1optnmncsa(fsDraxmo;u1alxoiieiltfm rl(vo u4trtrifciydlp   uvo;s0seumir3nodop elfetls sDurum ;t0tle ifetysla umump;u)tltnir3tatopD lieo s t2toxr3nodalt  fesls) Dra(mpno4aetnmfcias a ean p;t) ltrmrctytlmteaueolt  2xoxm oudam elfvs () rtrxm ;u0tlt moeildlm2ean p;u0alxnifcootlpteai ol()s2ur(m3nudope  fcsas artmu  ot1tee  o3iltlm2ea(vo;u0 eeriociy1fpDrln ils0t2ur(rpno4lpenlicsat)arrm(r ;u4tleoiiciasfm emuvp;(4 etnir ty1fptran ils)t2um(rpio1oltelnvsl( a2urx p;t4aexomieiyd s rm(vp u)aexnxrcio1laDeln i;t) rtmiopiy1om emivtls)sDururono1tle  o3iyt aDrau onu)artrmf tadoateln i;s0 2tmxopno4ap   neiat) rrmxmont1aptn i3ils a2eaumonu0tltoio3tydlm  au ils teuoxr3iu1llt lnvia(fsDraxmpot0oltoif3tltls2ea(vpnu0 lxnmf3iydopDrauvilt0 rum(opoy1ap nmfvtltf 2taxm ot1teen fetysla umu pn(4alxnif tytoaDr nvs;s)srtrxm iu1op  mnetlt artrxro;o4tpt  oeiyslsDuanvon()tlxriociy1fptr uvi;( teuoim3ou1amtn nctas sDtm(ro;t0alt io3tys m ranmont4aexoxrcia1fm  anvils)s2xoxr3nodalen ieia( s2tr(  ot1aptn iciyslm uan s;(4 lxoxr tytlatelneo (0s2tm(r3oudolt miet s)sDumxr ot0teen o3tatfa2ua(vpn(0teenif to1fa  luesls0srxrxo iodopee fctltf Dtaur no0oleo oeiytlaDrmu o;u4texnif3oadfp   ivs s tetoim oydole  fci s)s2uaxr ot0open ociytfsDra(msnu) rtrmfcoodfa r i olt)srtmio3oydll  mfeilt  2tr(m ;o4teeo i3ilt s uanmpnt)alxrmo oa1fatr ues;s trxmim3no4lleemfctlt) 2urx p;t0aexnmfctad m2rmnvont4 etoir3ta1la  livol(0s2trio nudapee ies t  Duaxmpoo1tptnio3tltfm eluvo t)tleoir3ta1lp  ln i t s2umxr3nu1ole mnvt s)aDurxm ;o4oltoiietadfm2raumont)aexrxrcio1fateauvo t teuoim oy4ap   fcsa()a2tm(r nt4oex ioeiatlmDulumo ()tlerif3oo1op r ues s sexo(m io1oleemfesl( sDtr(moot1aetomfeilt mDemnmp ()alerxf ootom  an ils0 etr(opou1lme lfvias)a2tau ont1tlxoifeiytfa ranvont4 rxomocto1fpt an ol(  rtmxr3nydam n fetlsfsDuaxm ;o1teen ieiasfa2ea(vs;t) rtrxfcta1lmt  neo;t0 euoxo3ou4amee nctl(f 2rax  ;t0tpen o3iad a emuvs t0tetnmf3ta1opteaivo;t  rxrio3ny4al nmiet s)aDuaumpoo0alt  feilsla2eanvpn(4 exrxr3oy1optrliei s0 2tm(o3iu4ameemfvi s  Drruroou4apx  f3iytls2el( s (4altnmf3oatlp   nes;s  2uriopio4lpe  ivilt) 2tauroot4olt  feiytfsDra( ont4aeenmfcoatomtr ivol(0 2tmir oodlme mfciatf 2tr(  ;u4altnmfeiys s ua(von(0 eenxo ta1om   u o s0t2xo(m iy1ap nmiei ()srtax ooo0aptnmfciyd a2ulumsnu)alxoxrciadlm r nvi ( sruoxr nu1omt  netas sDururonu4olen ocils s umuvp;(0 eerxfciodlaDeauvo;t)t2xo(m oy1ap nmfesl()sDrmxmp;u4optomfciyt s ra(vpn(0tlxrmo3oadomD ai s;s)t2xrir3iydlm emics t  rta(m ;u1oet  o3tld mDem( s;t0aetrmr iytlaD  nvo;s0t2uo(o nu4ll elncsas)srrru  ;o1tpxnmoetaslsDrlnvo;u4 rtnir3tytlate u o t teumxo3iudllenlies tf Dtmurp;u1ape mfctad m2uaump;t4 lxomr oytfaDean o;t  2trxo iodaltemivslt arrmxmooo4alxoiiciasls2ranmonu)arxnxocoytlaDeln o;(  exoxo oudlmenmfesa(farumu  oo1opxnifciydlm rlnms;t4 exnxfctydom  livo;(0t2ur(mpny1opte fci s  2tr(ronu1olx ifeiat mDum(vs (4arermf3iodom  lu s s0teuoimpoy4aleelfvs (fsDtm(ro;u0alx  feias aDem(mo;(0tetomr3iytlateai s t)t2toio no4apt lfes ()srtrx  ;t1alxn i3tldla el(vsn()arerxf3oodlp  aues t0s2urirpnudom nlfeilt) rumu  nt1texoiiciltfs2uauvont4 rerxo3tytlmteai sl(0t2to(m no1ame  fcsas)aDuaur ;t1tptomocilslmDemnvs;u0trtrxr iy1fptrluei;s seurxrpoodop emnct (f rrrxm oo4aet mfciasla el(mp u0alenmo3iotlaD  neol() 2ur(rpou4aptnmfvtasfsruau pou0tlx mieiasfm rl(mpn(4 etoir3ta1lp e nei s0srxoxo3ny1op emnctls) Drrurpoo0olxo i3iatfmDumn p t) renircto1oa  anvi;s)trur(o no1lle  ici t  2rax p;o1opxnmoetytla2eaump;t) rerxo tydfptr u o;t)s2tmio3nydoltn fcils)arurx pno0tlt ifctyt mDrau o t4arxomrcoydfp eauvi;s) eur(r no4aptn fciat srrmx  no4oleoiiciytfa uau ont)tlxrmr3io1lm ean o s sexrxmpio1lltnlfctls  2tauroot0tpxomfeiytlsDrm( pnt0 rtrxr ty1fmDraieolt s2tmimpnudlpt lfes s srtr(mpoo1teen fctat s2rmu p (4teermf totfatean o;( trxoxm oy4amt mfcil()srua(  no4ape io3tlslsDua(mont0aeeoxocia1opDeauvolt s2xmxm oy4omt  feil( a2umump;t1oexn feildfa el(mp t0arxniociadomtr ueols0 2toim3oy4lmeelfcia( sDtrurpou1optoifctat m ea(mo u4arxnmo3io1fmD an s ()seur(rpno4alenlfvias arum( o;t4tpxnioctls s ran sn(0areoif tydomD aivil()srxm(rpoy4ape lieil() rrau  ;o1texn oeiyd m2elnmp u)areomfcoodlmtelneo;( setmxrpno4omt mnvils  2rmuronu1tet ifciyslsDemn p t0 rxomr iadfa   i i;s0 2xm(m3iodam eliet ()arrmumpno1olt mictat s2ea( s t0alxoxf3tydlpteauvslt0sruo(o oodome lfcsl(f 2um(m nu4alx ioetadfs ulumo t0tlenifctatfpDrauvo;t)sexrxrpnudlleeliei ( srrm(  oo1aexn o3iltfmDulu on() lxoio ty1latr uvols  rxm(mpoodomt lnvs tf 2ra( pou1tpxnmociydlaDrmuvs;u4trxoxo ia1om eaivs;(0seto(opoo4altnmietasfarta(monu1opx  oetaslm rauvs;(4arxrif ta1fa elnvs;s0texrio3nu4oltnmfctat  2taxront4optn oetltfa rm(ms u0tlxoxo3tytfp r uvs;t)t2toir ny4ll emfciat sDta(mpot4tltoif3iatla2eauvp;()tlerxf3ty1lpDranvi s0setrim3nu4lp   iei s)a2ra(rono0olenmo3tlsfsDrl(vo;t) lxrir3oo1lm rln sl()sruoxrpoydom nmncsat)s2um( ono4texnmiciys mDrlumo t0tetrmr oy1lm r neil() eurxrpiydlm  lfct sf 2truro;t1tpxn fciat sDrl( p t) rerxo io1omte uvo (0 exo(r iu4altemict ( a2raxm ou0open f3iytla rmnms (0treoio ty1lmDrlu s t s2uo(mpiodal  lfeias)aDur(  ;o4tpeomoeiltla2rmnmont4tltnxf tadomD  n o;t  rxmiopoo1om emfvi sfaruau pot1apxoiieiaslaDua(vo t0tetoxf3to1omtrlu o t)trtr(m iodll e nvils  rrr(r ;t1olt iieiadlaDrm(vpnt0alxoifcoy1oat lneolt)truo(rpoy4omen nvsl( sDurxm ou0opt ioeilt m el(ms t0tlxrxrcoatoa raueslt) euoxo3iy1lptelivslsfarra( o;o4oeeo ieiadlaDrmn p;u0 rtnxo oy1opDeauei;t srtrxr ou1olee ivsl(faDtmx oou1olt iietyt a2ea(vo u)tetrxf3iotopDr ieols tetrim3io1op   fesa()sDtru  nt4apeoiiciltla ea( s;u) lxoxociydopDrlnesl(  rtr(rpoo4ll nlfvsat sDtmur ;u1apxn oeias aDrl(vo ()texoxo oodlmDrlnes;t0trtmir3ou1alenlivslt)srua(mont1olxomfctasfm raump u0trtomfciatfatelivi;(0seto(r3no4ale mfetls)srtaurpno4ole  fciytlmDrauvonu0arxoirctotfp eau ils) rxoir iydaltn iesasfarrmxro;u0aptnii3iatfs em(vpnt0tltnxo tytlpDr ivo;s0s2xmxm oo1amtnlies t aDta(r ou0aptn f3iyslm2umuvpnt0texnxf3oodlpt lu o;s0 2uoim nu4amt lieil(fsDrmurpnu1olen i3iyd m emums;u4aeermo tydopte nvo t) 2to(o ou4olte ivilt)s2urum nt0olxo oetas s um(ms u0trtnxrcoy1fm elu i s tetoimpoo1lm n nesa() 2ra(rono1aeto f3tld m2rmnmo;(0 lenxf3iytomtr n s;s) 2tr(m3nu4lltn ivs tfa2ra(mo;o1alx  feiytfaDran s;()arxrxfcoa1oa eanei s  eurxo oy4altn fvta() 2um(rpnt4oetnmo3iydlm2rl(vs ()trtoir3ia1lpt  nvsl(0 rto(m nudole mnci s)sDumumpnu1oeenioetlsfa ulnmp;u0trtoiocio1faD au ols0 eumiopiodap n nviasf 2urxr nu4aetniieias m2ra(mont4alermoctytfp e ueo t0 2xrir no4lp emictlt sDrrx  nt4oltomo3iys a ulnmont)teermociodfpDelnei;s) rxoimpou1lpt  neta() Draxmp;u1ole mieiatlm2emn p;u0altrxo3oydlptrlivs t0sexrxmpny1ll elfviat) rrmxm ;u1ape ii3iad a emu s;t0 etoxf3ootop raneo (0s2xoimpoodaltnlfvt tfsDrr(  nt0oex  f3iydfmDelu s;()treoircty1oate ivols0t2xrxrpoo4opt mfvsa(fs2rm( oot4olt  oeiysfa rmumont0areomfcoo1omDrau o s sexm(m3oo4aleelfeslt a2tmu  ;t1aet  ieils sDeln p;(4tltrxr oadlpteauvils  2toxmpoo1ll elneslsfaDrmu pnt4tltnif3iydls2emump (0 lerxo ta1fm  anvi;t  euoxrpno4ll n fci ()s2ra(rono1tlen
\ No newline at end of file
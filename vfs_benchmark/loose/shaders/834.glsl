@@ -0,0 +1 @@
+uvo;(0 ruoio io1omtemfvilt a2ua(mo;t0apxoioctlsla uln on() etrxo todfmDranvsls) eto(r3nydlle mnctatf Drrxronu4texo o3ilt sDum( p ()trxomo tydoat  nes;s) ruoxm3ny4alte net s artax  ;u1ole iietyt s2umnmp u4tetoxf totfmDe nesl(0 rxm(m oo1om emnvsls s2trur ;t0tpx moeiydfs ea(ms t0 eerxfctydfmt aies ( s2ur(mpnodole mnei (fs2um( p;t1openii3tat m umnvs;u4 rtnxrcoytoat  ues;s t2trirpoydomee fetlt srur(r no1opxomfetlslmDuauvo (4artrmfctadop  lieilt0texrxm3iy1apenlicslt a2uauront0tpenmicilslsDemuvo ()altrmfcoa1lmDelivs ()teuoiopoo1opt  fct t)aDrax p;u4oeen fciatlm emn o;()aexrif iydfaD lueils0srumxm iydol elict ( a2umuronu4altoiieiadfs ua(vs t)trerxr3oodopD aues (  eurio no1omt mnes t arrr(m ;t4aee mf3iatfa2emnmo;u4 rtriocty1fa  an o;s setr(o3io4lleelicias artmur no4teenmoetydls2ra(vs t0teeoxr3to1omt aneo ()trumir3iu4altelfvtls) Duax oou0oex iictlsfs2rl(vsn(4arenxf oydlate n i;( teur(m3oodomenmfes s)arrm(mpnu4tle ii3iydlaDuanmp;t)tlerif3oytomDraivsls0t2xoirpou4omte neilt)aDrmur ou4aee iociydfsDrl(vs t0alerxfcio1faDelueilt0 etmir io1opte iei t)sruru pot1tpxo oeildfa elnvp u) rerxo3iadopDe neolt0 2toxo oydal emncta()artmu pno1alx iieiatlaDrm(vs ()artrmfcoodlmDr n i t  2xoxopoy1oltnmfvslt s2umu  oo1oeenioctytfaDean p t)trerxfciodla  ln o;(0 euo(m ny1op  lfeil() 2rr(r ;u4alt iocias sDulnvsn(0alxrio ty1om eaies;()t2urir3oodlm   nei t) rrmurpot4tltoiietad s eluvsnu0arenir3totoa elnvs s  rxrxm3oy1alenliviltfaDtm(  ou1ole moetydla2uaumpnt)aleoxr3oodop e uvol(0setr(o iudopte fei (  Dtmxr ;t0tlen f3ildlaDuan sn(0trxnxf totlmt luvols  rtrir oo4apte fci ( sDta(rooo4opx moetad m2umu s;()aeenxo totlmtr u il(0srtoxmpny4lm  lfcsls  2ra( p;u0tpenioeiydfaDulnvp u4arenxocoodfat  ivsls sruo(o3no4apt  ncia()s2ur(mpot0tlx  o3ildfm um( s;()alxnmrctodlatrli i;t srtoir ny4lleemfcslt  rrr(mpoo4apxo iciydla eanmo t) eerxf3ootfpDe u s (0 ruo(o nu4lpe mivs s)arrrxroou0tet if3tytlsDel(msn()tltoxrciadlpDeli olt) rum(mpou1ol n fcilsfarraumooo4aexoiieiad s um(ms;(4areoxo oatom  ai o s0s2toxr3no4lle lfviat) Dururooo1olt  ociydfm2eanmp;()areoir iy1opDr ueo;(0 rurxmpny4ap  lictl( a2uaxr ;t0ole  f3ilsls emuvp u) leoxfctatfpDrli slt)srxo(r oo1llee fvs tfs2rru oou0altniieilt m emu on()arxnxr3oytoaDelu i;s0t2tm(m3oy4ap n fvs s) rurur ou1apeoifctasfsDuanmo (4aeeoifcoatlm  aivi ( setmxm3nudaltelivta(faDuax p;o1tpxnif3tydlaDel( s;()texnxr totlp raues;s0sexmio3iodom e fei t)a2rmxm ;o1opeomo3iyd s ra(mp t) leomf totlm   uvils) rtr(mpny4optnlneiasfa2rm(m ;t4apxo feilsfa elnms u)areomfcto1omt  u sls)sexr(o3iu4omenmivs sfsDum( p;t0aetnmoetatla ul(mo t0 ltoxf io1la r ies;s srtr(r3iu4aptelfes ()s2tmu pnt4apeoii3iytlm2ua(monu0trermo3tytlpDrlu i () rxrirpoo1altelnvtlt)srtaxr ;o4tptomfeiatlm em( s t0 rxoio oydoatelneil( srtr(o3nudameelncs (  Dtmu pnu1tpe mi3iatlsDel( o;u) eeoxf iydlat anvi;s)texo(m oudameelncsas  Dumuroou0opto iciatfsDuanvp u4trtnmf3oy1optraivo ( tetr(m3ou4ale  nvtas  Dum(rpot4openmo3tys mDrl(vpnt4aeenxrctydlpD  ivo;t  2xmxr3oodlmte ieils) Dtr(ronu0opxoii3iatfa2el(mp (0aeeriocoatlp  anesl() 2xmimpnydaptemnctltf rrrx  ;o0openmicildfs2rm( p;t4 eenmo todopt anvi (  etrxo3oydapeemieias  Dua(  nt4tptnmiciytfs2rln pnt)teeoxf ta1fmDraiei;s) etoxm3no1optemnvslsfsrur(r ;t0apt  iciysla2elnmp;()aexoio3oo1la rlivo t0sruoxmpoydopte fesa()sDtrxm ;t4apeniocilsfmDrm(vo (0tleomfciatomtr nvo s0sexo(opno4openmfvt ()sDrm(m nu0tle  ieilsfs ua(mpnt0 exoxrciy1lm e i s s0s2xrio iy4om emfcsasf rtrurono0opeoiieiad m ul(mon(4artrmf3oydfm eliei;t) etmxm iu4om elnvsls  rtaumpno0opx  iciadfaDelumsnu4 ltrxo iatfmteauei t0trur(r3iy1lp nlfctasfa2ta(mo;u0ape mfcils a2emn on(0arenmf iydla elues;() eumxm oo1om e ics sfsrurxrpou4tet mf3tasls ul( pnt4trtrio iodfpteauvils  rxmiopiu1aptemfetltfsruru pno4tpeniociad a emumo;t)trtoiocoatom rau i;(  etrxmpiudlp e ivsl( a2ra(r ;t1apeomoctatlsDuln o;u0 eerif iydlaDrluvs;t0teuo(r3ou4ll nmnetl(fsrua(rono0oet mietad s2emuvsnu4 lenxo tydfpDelnvo;t tetoxr3oo4alee fvsa(farumxm nu0opx moctltlmDrm( o u4 ltrif3ootfmDranvsl(0 rtmim3oy4al   fci tf Drm(mooo0tpxnmi3iasfmDra(vsn()arxoxf ty1faDe uvo () rtrim oydolt licia() rtax pno1olx  fetatls ulu on()arxnxf totomDelues s s2xrxr3nu4omt  net ()srtrur ;u0opx  i3iydfaDua( s;(4arenio3todomt ai i;t0 rurim nydol e ncs sf Drm( oot4tpenmiciaslm2umnvs t)aetrxrciy1fmtrli ils0s2to(o no1lmtelneiltfaDraum nt4texomoeiydfs eaumpnt0 exnxf oadfmt anvolt0 rtm(r3ou4ap   neil( aDurxmp;o4aexo oeild m2rau pnt)aetrmo oo1om rlivo;t)seuoiopno4ll e feil( aDua(m ;u4tlxnmiciydla2rmnvo;t0artomr3oodop   neslt  eumxopiydop   net s srrax p;u0optnmieilt a2ulump;u)tltoif io1laD ai i ()trurim iydome  ivs ( a2rau pot4oetnmociytfa2emu snu)tetoifcoo1lmte nvo (0srxr(rpnydom emivi t)srrmxr ;t0alxn ociytfmDemuvp (4trenxr3oytfmDelivo s0 exmimpnu1lmenmnctl()s2rmur ;t4tlx  i3ias aDrm( ont4arxoio todfa e ivs;s0t2uoimpny4amtemnci tfs2um(m no0tle mo3ils mDea(mp;t0trtnmo tydlpt aues;s0t2xriopoy1apt  fct t)sDumxrono4aet  ietat aDeanvo;() etrir iy1fmD an i;( sexm(r iodap  mivtlsfaDtmxrpno0aptoiiciydls2ua(msn(4artrmr3iy1fp  anvi s0 eumio ny1ll nlfvi s  2rmx oou1tltomfciyslaDemn p;t4texnmocoo1oat  nei;t0tetmxrpoydapenmfei t srtau oot1tee moetld a rmumpnu0trerxo3ootfptr ivo t)srtrim ny4amtn ncia()artrxmooo4tlxnmociys a umump (4trtrio todla r u slt0trto(opio4ol  mnetat)sDum(mooo0ape ifeiad m2umnmo t4texomrcty1lat  u i;s) 2xmio3iu1optemieil(fa2tr(m ot0tlxn f3ildfm2ul(vs (0trtnmr iodlmte u o;s)truo(opno4olt mfvsatfaDrax oou1tex mi3iyd mDuan p;t0 etrio tadlatrlues;s) 2tm(mpnodoltnlictas srta( pnt4tlen feiyd m2ulnvsn()arxnifciytfa r n s;t0seuo(mpnodop  mfct (f rumumpnu1opxnmo3tlsla ra(mon(0aexnir ootopte uvs;s)seuoim iydapenmfvia( a2rmumpnt1tpt  o3tlsfsDeluvpnu0texrxrcio1fm   i slt teuoxr ou1lm  mici s  rur(  oo0apxn f3iat aDem( s;t0tlermf iatoptr nvi;s)trtriopiu1ap nmicsa(fsDuaxr ou0aptnmfeilsls ea(mp;u)trenir3iy1oaDe ivo;t0t2um(o3iudap elict s)sDta(mpnt1aptnio3iydlm2rln snu0tlxrif tatlpDr n i ()setoxm iudlp emncilt)aDum(m ;u0oet mfetysfa elnvsn(4tlxrxoctatlmDeaieolt trumxm3iu4alen ict s srrruronu1tlxoiieiyd m elnvs (4aeenmo3ootfpDrlu i;t)tetm(r3no1omeelivta() rtm(r ;t4tpt  ociydlm ean o (4texoxf totfp r uei () 2urxm nydame livi sf 2rau pno0opxnmf3tytfa em(vo;t0texnmo totlp rlu ols  rxr(m nydop e ieta(fsDurxm ou4aeen o3iasfa2umumo;u) eermr tatla r iesl(  rtoimpoodol elics sfsDrau  ou0alt  iciltfm uan p ()tltrmociodlp elneo;(0srur(o3ny4am nmics sfs2rmx ont1aptoifctls s2ulnms u) reoxrcto1lptr neo;(0trxoio3nydlltelivil( aDrr(  no1aetnmoetadfa rauvs;t0aetrmfctatlmt lu sl(  2xoxm3oy1ol   nvia() Dtrum no4aleoiicilsfa em(mo;u) rtnxfctytop rli o s0s2toxm oy4al nlfct () 2uaum no0tetn o3iyd m ea(ms;(0 lxnmfcoo1opt au s;t srtoim iy4lpeemfetas)sruau ono1opxn oeilsfs2ulnvp;u4arermo3oatfaD lueils srurimpio4lm  lncilsf 2rru  ot4opx ii3tysfs eau p () ltnmf3ia1fpteaueils0 rtm(rpou1ll  lnes tfa2tm(  ;t1tle if3iytls2em( snt4tlxnxr3iytfa  anvi s0srumxm oy4lle  nvi (  Dum(monu4apx mocilt sDrmump (0teerio3io1lpDr iei (0trtr(mpoo1lltnlncslsf 2trump;o4ape  fctat sDrlumpnt) eerxf todop  anvol( srumxr oo1lpe lncs ( aDtrurono1tlen ictltls um(mp t4tetnxf iotfa ean ols0texmio no1ll e ictat srtax  ot0alxo fetadfm ea( o;(4tetoio3iodomtr uei t setrim3ny4lm nmfvi t  rraxmpot0tetomieiydlaDumnmont4tetrxfciatlm ean s;t0 2xoimpoy1aleemncsls) rra(mo;u4apxnmicilsfs rl( o t4 lenmo oo1om  luvo;t)s2xr(m oy4lltnlnetasfa2tr(  nt4oleniictadlm umnvonu)tlxrmr oadlp  luesls0t2xmir ou1ll  mnvs ()sDtaxm ;t0altomoeiadfs umu s;()aeeoxf io1oa rln sls t2tmir3ny1am elnetltfa2rmuroot4opeoifetytlmDel( o;t0 leoxfctodfptrau sl( trtr(mpio1apeelfeias  Durxmp;t0tptomicild sDuauvonu)arxnxfcta1lp elnvolt)s2xmirpnu4ap n icsa(fsrta(r no1olto oeiytlaDum( o;()treoif tadfmte n olt trurxrpnu1alen iei ( s2taur ;u1oexnmicild mDel(vont4alxomo iy1oa  auvol(  2tmirpoydam  lnctas)s2trxmono1texnioeiydlm2emn on(4trenxr ia1fmDeaivi;s) exrir oydlleelfcsat)aruaumpnu0tetoifetydfsDrauvo t4tleoxfcoa1laD ln s;()tetoxm nu4ol emnvias a2tm(m ;t1olenio3iytfa2eanmo;t0tltoir3tytfp  auei s0texmxo3io4llee ieils  2rmx p;o0opeo f3iatlmDemuvp t)alerif3oa1oa r i s t srtrxopnu4oleemivsls) 2taxrpnu1alxomieiltlsDrauvonu4artnif oatomDeauvol()t2umiopiudlltnlnvtltfaDrru  ou1aet  f3ilt s2rlu o;t4aetrmf3tatoa  lueols0 2umxrpou1lmtn ici s)aDrr(  oo1alenmociytfsDuanmo u4aetrir3oodfaDe i i s srurxopoo1lmen fetltf Drm(  oo1opxomi3iatlaDrauvo;u4 etnmr3ootfa elnesl( t2tmimpno4apenmfvta()s2umu  ot4ape iociyd s um(vont4tetrxo iotfpDeaies;s0srurim ou1opeeliet tfs2umx  ot4aexnio3ildla ean p;u0tetoio oy1lpD lies;s)s2ur(o3oy4omtn nvs s a2uau o;o0oee ifciysls2rlu snu)artnio oatoaDr nvols)texoiopiu1llt mncs t sDrmumpno1alt  ociatfs emn pnu0aetrxo tatoa   uvo s t2xr(o3no1alt livs t)srua(  ;u4olxn feiydla rmu p u4 ltrioctydlpt  uvils) rtoir3ou1lleemnvi s) Dtm(  ot1apeo fciadla2umump;u0 eenmf3iadlm e ivs (0srtoxm nydalte fvsl(fartaumoou4ape mfcilt s elnmsnt4trxrxo3iy1om rlneo;t)t2trxm3ny1lmt livt ( a2trx  ;t1oeeomi3tydfm2uanmpnu)trxrir iadlaD an o (  etrxo oodalen fvils srtm(mp;u4alenio3iytls ea( o t0altoxfciydlaD an i;t0s2uo(rpoodop elieils s2rrxmo;t0tet  i3iadls uluvs;() renio ia1lat aieol() exmirpio1lptn netl( aDra(  ou4tptoiiciyt a uau o u4 rxrmr tatlm  ai o;() exoxm nu1optnmfci s srraump;t0tleo oeiys s ulnvp u)artrif oytoa   n olt)t2xrxrpnu4lltn nvt t  rtru pou4apeo feiyd m2ra( p (4trermrctotlateaneo t0 2xr(r3iydllte ivsltfaruaxr nt1aleoioetysfmDeaumsnt) leoxf3oadlpt auvol(  euoxr3nu1om   nei tf Drm( p;u4opxniicilslsDem(mo t)aexriocoo1lmt lues t  2xrxo ou4al  lneiltf 2rr(m ou0aeen i3iltlm umu o;u)aeermfcootlaDeluesl(  2xoxo oy1altnmfetls a2raxrooo0apt iieiad m ea(mo t)arxrmr oo1latrluvol( sexo(r ny1lpe lfesa()a2ra(m ou0tpx ioctld s2emu snu4texnxrcoadla e nei s  2tm(opoy1ol nlfeias)aDumxr ot4olx  fctyt s em(mp u)alerxf ootoa  anvils0t2tmir io4alte iciat sDra(  ;o4oetn oeildlsDelump t0altoxo ia1omDelues;(0tetmxmpny1lp e fcsltfsrururp;u4aet if3iyd a rauvon()texrxr3tytfmDelu o t0 rxmio no4op nmnctas)s2umxm oo1olenmfeilsfa rmn sn()trtnifcoo1fa eau o;s0 2umio no4am emfetl()s2tm( ooo0oltnmo3tld a umnmo;t4 eenxf iotoptr i i;(  2xmxr3nodol n ncil()arua(  ;u0tet  fciatfa2uauvp;t0altrxf oa1fp   ieols0tetmio iodaptn iet tfs2ra(rpot4aleoii3ilt aDum(vo t0aexomr3oodop ran i;( t2umxo iudamt lfet (  Dtmxmpot0tex  i3tldls em( o;u4artrmf3io1oateli o;s  rtr(m no4oleelfct (fsDurumpou1texnioctas a2rmumonu)alxoxf3tytoa  lnvi s trtr(m3oo1am  lfvtasfsrur(rooo0openif3ias a raumont0alenxf oydlpDrai sls)tetr(o3iodam elfvtl(  Durxmo;u4tpxnif3ildfs ul(vo t) eerir3oo1latr i i;s0 exoio3iu1ap n fcta(fsDtaumoou0apxnmoeild s rl( pn(0aetoirciodlate ivols srtrxopiodol e ics s sDrm(  ot0openmiciys s2ulumpnu0arenio io1opDe ivi s tetm(r3iydopt  fes tfsDrax p;o4texnmfeiytls2ra( o () eerxr3io1fmDrln o t0 etmxo io4olee ies tfaDraxmpno0oee  i3iysls rau ont4tltoir iytfaD ln i s)t2urim3oo4op nlfeils) 2rru o;t0teenifciasls2emu o t4 etnxf3oadopDr n i;s) 2to(r3nu1altn ncs t s2tmum ;t1opxoiiciat sDrlu ont0artrmoctatfateauvils setmimpio1openmfvt (  rur(  no0oet moctlt a2um(vo u) lerxf oodfa e nei;t srur(r3oy4aptn neilt  2rr(mo;t0olxnifctad m2um(vo;(4 rxrioctydlp e nvi ( srxmxo oudopeelivslt)a2uaxront4alxnif3iasla2ulnms u0teenxocoytfm  lnvo;( texoxo ou4am nmiei s) rrrxr ;t4aex  icils s ranvp (0arerxr todlpteli slt) exrio3iy1amen nct t) 2tr( p;u1olxo o3tld aDean onu4trxnif tatoa eau s;()teuoxm3nydop  mfetls a2umum no0tptn i3iatfs2rlnvpn(4 rtnxoctadoat aieolt0 2uo(mpny1amt  ict s)artmu ooo4olxnmietasfsDrlnmsnt)tlerir iadlatrlivs (0 2uo(m iy4op nlfet sf rur(ro;o1alt mieildfaDeau s;u)trxoxf tydlp rau s t srxm(m oo1lmtnmnesa()s2taump;u1texoii3iyslm eanmo u)trtomo iatomDrau o;s)tetmio nudomeemicsas srtaxmo;t0apt iociysfa2ea(mo u0alxnxo oy1fpD luvsls0sexmim iu4lltemnesas aDrauro;t0oeeomocils sDem(msnu) exrmf3oydfm  ai ils)setr(r no1alen ivsa()arrr( pnt1tltnifetadfa uanmsnt0trtnmr oy1oatranvil() eto(o3oy4amt lfvtltfs2ra(rp;t4olenioetytfmDeanmp () eeoif to1oaDeai i;(0srtoir3oydll nlnvta(  rumurpou0teenmictlslmDemu s (4trtrmr3oytfmtelu s s)teuoxr ou1olt  nesasf rurumoou1olxn ieild m2emnvp u)aleoir3todlmDelu i;(0 exmxmpoydameelfvtasfaDta(rpnu4openioeiadfs ea(mont0trxomocoydlmDr nvi t sexo(opou1al nlfesat)sDtrxro;u4tlxoioctatfa2ulnmpnt4 eeomf3oa1fpteai i;t)s2xoxo iu4lpenmncsl()srtmumpou4tlx mfcilslm eanvp;u0areoxf3to1la eanvsl() rtoimpno1lmenmieias)s2umu pnt4opxnmo3tyd m2ua( s t)arxnif3oydop eliesls0 2xr(r3iydap   fctas)a2rrurpnu0olt ifciltlaDrm( ont)aeeomo iytlatean i t srxrxm oydolee ivi s)aDrm( p;o0aeto fetadlm2ua( pn()arerif to1oaDrli i t) 2xr(o ou4lltelfetas) rtaxm ;t4oexnio3ilsfa rm(vsnu0 ltnmo todfp eli o s0 2tm(o3io4lpe lfctat)srtmxmp;t1oeeniieiytls rmuvp u) lerxocoodfaDranvo;t  2tr(m iudll  lfctat)sruax onu1texnif3tls a rmu p;t4aexrmrciotlate ieilt0texrir nudam n ivt ( srtr( pot1aexn i3iatlsDrmnvs;u0 eeoio todop  auesls trxr(r3nodopeemivias  Draxr ou4tex  ietat m2ea(vs;(4teenir3iadomDeanvils t2toiopoudamtnlicilt  rrm(r nt0apenifctytfs ranmon(0alxrir totoaD ln ils trtr(mpio4omenmnvs ( arumu p;u4tlxomf3ildfaDelnvont4tetrif3totlp   ieol()t2umio iu4ome lnciat sDrmxronu4tet mictatlm2emu p u0aexrir oo1fpD lu i t)t2xm(r3io1amtnlfci (fsDurur ;o0tptniieiltfm uln snt) rerxocty1oaD  ueo t0 rur(mpoodlpte ncias srtr(moot1apen ictyslm rmn s t4tltrxo3oydoa eaiei (0sexmirpiu1lmen ictlt)arrmum oo0tlxnmfctltfa2rluvs () rxnxf3io1oa rau il(0tetoxr3oo4alenmfvil( sDtmxrooo4ape mietls a rl(vpn()altnmociytla   nvols) rtm(mpnodop nlfvs t) Dra(ront1tptn feiyd aDul( o t0texrif3to1fpDrai i s0sexmxrpno4aleemiesls  rta(mo;t4oltnmi3tadfm ranvsnu) rtrifcoa1lptrlneo (0 2uoxm3no1olee ietltfsrtr(r nu1tptoioetytfs el( pnu4aexrmf tatom rln slt0srtrxo3iy1am n ictls sDtr(  nu0tleomi3iad a2uanms t0aeerir3oatom eanvsl(0srxmxm iy1lp elncsas  rrrumont4tleoiieiatfaDumu p u4 lxnmf3iadfaDr iei ( s2umir3iu4lmen ietls) 2urxrpno1tpxomfeiatls2eau on() rtnxfciotlmDe n i s)teuoxrpoo1omtn nvtasfsrumx  nu4olxn i3tyslm2raumo ()treoxf tadfmt  ivslt teuo(r3nydol  miesltfa2tmu  oo0tetn ieiyslaDulumonu)trtomrcoo1laDeai i ( t2um(m iu4ll e neia(f 2rmxmp;u4tlxomo3iys m2elnmp u0artoxf3iytomt  ieolt0sexo(m iudapen iviat)arrm(  ;u4optomf3ilt aDumnvp;u0aetnxfcoatfmte ivi;s0 eurxo3nydllt  nei sf Dtaxmono0ape  fcias s um(ms;u4texrmfcto1oat au ol(0t2xmxrpou1lpt lnei (fs2tr(r ou4alx  feiysfmDrmuvs;u4 rerio iytoatraivilt0s2xrxo3oy4apte nei (f Drmxmo;u0tltomoeiytfsDul(vs;u0aexnio tatfm e uvi;(0 2xmxr3iu1ole  ncs t srtm(mono4tlt ifcilslmDrmuvsn()trenmrciytfpD auei t0teuoxo oy4lm  mfcs ()srurxm oo0opx io3ildfs2ra(vs;t)trxoir3iatlaDeanvilt  rumim ou4lm   ivt s  2tr( p;t1oeeoiictad a2rmnvon()aexoxrcoodfmtrlies t) rurio3nodapee ictas) 2umxmp;o0opx mociasfs2rm(mp;(4tleoxo3tatop   ueo;(  euo(r3iy4amtelfet tfa2urxrp;u0olen ociydfsDumumo;t4 lxrircoodla  au i t0s2urim iu4ame  ncsl()artmuronu4oetnio3ildlsDuanms;u0teenmr ootopD lu sls setmio3iudop n fcslt aDrmx  no4tlxn f3iadfmDua( sn(0tetrmf3oy1lm rai sl()s2xrir oy1ap emfet (  2ua(m ;t4olt mf3tldfsDra( p;(0tlxnmo3iy1lpDeaivilt0seuoir3oo1lltnmnesls s2rau  no1apt  i3ildfsDumnmpnu4alxrmrcoodfptrlnvi;s)s2xm(r ny4al emfviat)arumxmoot1apx iociydlm2uluvo u4tlxnio oa1faD  nesls srum(m3nu4lm   ies ( sDumx o;o1tee mo3iyd a eluvo;u) ltoio iotfm   n s (0 exmir3ou4openlfeias a2trxmonu0tle  f3tyd m eanms t0altnifcoodla rlu i () rtm(o io4ome lfvtls)aDum(  ou4oltnmo3iytfs2umumo;(4tlerir totlpDeaieo;t0truoirpno4lmee ictatfsDtaxmont4tpen iciltla rmuvpn(0tlenif3tatfmt ai il()teurxopou4ole  nvs ( a2um(rp;t1tpe ii3tyd sDem(vo;t)arxnif iy1fpDe neslt s2umxm iu1lmtnlici t s2tm( o;t1teenmfciysls uaumo t0altoxr io1lpDr u i;s t2toxmpou1olte fvtatf rtaxmono0tle mo3iytfs2umumsnt) rxomf3iydfm  li i;t0tetmxr nudolt  ivil(  rra(r ot0opxn octadfmDuauvont)areoxr oa1lmt luesl()t2xmio oodop elfvs t  rurxrp;u1tltnmf3iys s emums;u) rerxo iydfptr n ols) 2tr(m iu4ome  neiasfaDtr(ronu1optoiiciad m umnmo t)trxoio3io1fpDrauvs t srtmxrpiy4om  mfcsasfarrrxmont0altomfetydlaDrm( p;(4aeenxo iydomteanei;s)s2toxmpiy1llen fvtltf 2um( oot4oet  o3tytfmDrmu p;(0aeenxo3ootfpte i s;s0s2ur(m3io4ap   feias s2tr( p;o0oeenif3iltfs2ua( p t4arenxfcootopteaiei s) exm(r io4lpeemfvi ()s2um(rpno4aexnmicias m ea( sn(0alxrmoctatfa r n sl( t2xrir3nydlltnlivsl(fs2rrx pnu0openmoeils m2rauvo;()areomf tadlpteauvi;t)sexrim nu4am emietat)sruru p;o1oee  fcilt sDum(vp;t4aexrio iytlm  lieslt0 eum(o3nu1alee fcs tfsDraxroou1alt if3tytlaDem(vo (0tltoioctatopDe iesls) rtoio io4ll nliei (fsrtm(r ;t4opxo oeias a rluvpnu)aexrxf oy1fmDeai s;t)s2urim3nodlle  nvt s)sDtrur ;t4aex mieiatfa2uan o t0 lxoxrctotla  lnei s s2uo(m no4lpt  ncil(fs2trur nu4alt ioctysfm2uln o t)aetomrcoa1op eln o ( seumxrpiudameemicilt)s2rr(m ;o0tpeomi3iltfa elu sn()alerxf3todopDrau s (0s2tr(rpiy4omenlfvtls  Duaxmoou1olen icild sDuan s t4 exnio3to1omDr ivo t  2xr(opnodam   nct s)srrr(r ;o0opt iiciys a2emn on(0trtnif3ty1fp  aieo;()srtr(opoo4lle  fci t) 2umxrpot0apx mfeiltfm emn s () rxnmo3iotfaD aneils setoiopno1lmeelncilt)s2rrxrpnt0tee  fciadlsDrau p (0 lenio to1fat  ues;s0s2toio3iudop e fci t aDtrurooo0tpxnmoeild aDrlu pn(0 renxfcty1opDe u sl(  2uo(m3iy1lptnlieias s2tmurooo0tpt mietys m2rl(vs;t4tleoio oydfptrlies ( texo(opoydlpeelnvs ( aDrr(ro;u0oltnmfctldlsDua( p u4 ltomociatlptr neil(  rxoxm3ny4lm emies tfsruru  ;t4teen oeiydfsDel(mp (0tetrio3iadoaDrai s;t trtr(m3nu1optelncil()aDrruro;u0optomfctatla2uauvs t)arxrio3oodoatr nei;t0truo(o3iy4amen ncta(fsruax pnu4tee miciytla emn p t0 ltoxo iy1fpD  neols) rxmir nydoleemnciltfsDuaur ;t1oeto o3iysfm2emu snu0tlxnio3todlmD  uvo;s0 rtr(r nydlmenmivia() rrmum ot1tetomietasfaDemnvonu0tetomo oy1lm  li ilt s2trxr iydameemivta()srtrur ou0aeeo oeiltlm emnvs;t0 rtomo3totoatran s s  euo(opou1optelnci (fsDtr(roou1tltomfeildls ul(vs t0trenif3iydoat  u ol() 2urio3iydaltelietat)s2ua(mo;t1oex moeildlaDrmuvo u0 etrxr3ta1omte i s;s0trtoim3nu4lltemfeil(  Drau o;u1opt  f3iatfm uan p t0aeeoif3oodom rln i s) eumimpiydll emnetat) rumurono1aeenmoetls a ra(mo u)texrmo3to1omte i o;s0setmio3oy4lp  lneil(fartrum ;u1oetnioeiysfm eau snu)artoxf3iydoaDe ivi s0 exrxr3iy4optemfvsas  Drau  ;o0apen i3iasfa2rmuvp (0trxnmf3oadfmtrlu i;t0 rurio3nydlm  mfcslt)artaum nt1alxomf3iadfa2uauvpnu)tlerio ootoa rau slt tetoiopny1opt  fvsl(f Dta(m ;u4opeoioetltfa rauvs (4trtnxr3oo1lp r ieilt t2xmxmpoodolt  netlsf 2rm(  no1tlt iociat mDrmnvs;u)texoxocta1op   nes;t0tetr(opiudlp   nvt ()srrr(r ;o0teenmfeils s2elumo;() rtoxrciy1fpDeli s;t sexo(o3ny4om  liesl( artr( oot4olen ictldlaDua( pnu4aeermf3ta1opteln i;s seurxo3iodlle lnvi s)srta(m oo4aetnioeild sDum( o ()altnxr tadfp  lieols)sexmirpiodlltnlictl() 2ur(mpnu4texomfcilsfm umu pnu)tetnif3iotfmD anes;t)s2urxo3no1alenmnvi ()aDtr(rp;o1tleo feilslm um(mp;(4aexomrctytla elneol(0s2xo(mpiudlp nlnvs s)s2umxro;o4tpenmo3ilsfa ulu p;u0aexrmfciodfa e ueo;( s2xoio iodlltn nei tfsrta( p;o1apx  o3iatfa elnmsnt4trtrmfcty1fmDr u i;s s2tr(o ou1lp nlneslt)aDrrurpnu4apeomoetydlmDrln p t)artoif3totla eln s;()t2tr(o oo4alt mnes ()srum(m ou1teeo fctlsfm2uauvs (0 leomf oo1la rln ol(0srtmxmpoy1op n nciatfsrtmu ono0opt  fetat a2ul(vo u4treoirctotfpt lu i;t0srxrim3ny4ape mnciltfa2tru oou4olx  f3ildfaDeln s t)tlxnio tytlm raues s  exr(r3iy4lp elfcslt) Dtrxrp;t0olx moeils a2umn o;t0artnmo3oodom   ivo;(  rtm(opiydll e icia( arurxrono1tle io3tltfm2ua(mp;t0texriociatla e i sl( trtm(r oudoltemnvtat  rrm(mpou0alxnifcils sDel(mpnt) etnmf oo1lmD luvi ()seur(mpiu1al e ict s)a2ur(m ou0oee mf3iatfsDrmuvsnu0 rxnir ootlmDeluvi;( trtrxr nudamt micslsfsDuax o;t1tptn fctasfa rmnmp () ltrxrcta1fa eln s t0s2trxo iu4lme mfctas  Dra(r ;t4oleoii3ias mDuanms;t0tlxomf tatlm  lueil() rur(o oo1lmtnmieia()aDtaxmpou1tle moetaslaDuau pn(0aleoxocoadlateln ol()t2xmim3iydome lfes ()a2uru poo4olxnmoetadls2ranvsn(0aexrxf3ty1fa rluvi;s)srto(m3no1ape mneta( s2raurono0tet mfciasfm rmn s u) lxnxr3totlaDr n s;s)s2trio no1op n ieia()s2trxmp;o0apx  ietadfsDean o;t)trtrio ia1lmD aivo;t0t2umir iydom n ici t)a2rmu  ;t0olenii3iyt mDrmuvp;t4 rxnircto1oa rau sls)teto(opou1aptelnetas)arrr( o;o1oetomoctydlm2rlu snu)altoir todlpD ai i;()teuoxr3oudapt lfct s)a2tr(mono0apx iiciyd s2rlnvp;(4trerxo3tydfaD auesl()s2uoxr iu4lp   fvslt)s2rrumpnu4oleomfctltls emuvp;t0 exoxf tatfmDe ieils)s2to(o iudlleemivias  2rrxmont4tpxnmiciltfsDumnvo;(0teenir totopDeaneo;(0t2umir3iy4aptn ics sfsrrax ont4tle mictadls ulumon(0aetrmfcoodfptr uvils t2uoim oy4apte neta(f rrax  ot1tpxnmo3iytfa2emnmp;t4arxnxf3oodomD  u i;s s2xrxm oodll emictas)artm(mpnt1tlxoioeiltlm2el(vs;t4 ltoir3ia1lpDe ies ( srxr(opno4al nlici s)s2ua( oot0oeeomfciltfsDrlu p t) etrircoa1lp ranvi t) rtm(r3nu4aptnlicilt artrumpoo4tptnio3tatlaDrl(ms u0teenir3iydlpDr nvilt)seuo(m3oodll  lnctat  Drm(rooo0tpxo oeiltfm2rmump;(0trenxo todlat  nvi;( s2tr(m3nydoltnmfviatf 2tmx onu1ope mociadlaDem( pnt4 eeomr3iadfmDelnes ()seum(o nu1alt  iesa( a2tr(mo;u0oeeoiictyd s umn ont4aeenifcta1fm eaiei s0s2xr(r nudol e fcils  ruaxr ;t0opx  ociys a emumon(0aetrxociotlaDrlivs;s sruo(mpoydop  mictlt  2tmxr no0aeto ieiysfmDrmnvon()artnif3ia1la  li o s)tetm(opoodomeemnetas  2taxmo;u1olx  o3tatla umumsnu4tetnir3oa1la  auvo t0s2umxm oudaleemfvsa() 2rrxmp;o4ope mfcildlsDrln o;(0arxoxrctydfaDeau s t) rtoxr3io4omte nvtltfaDua(  ot0apx iociltlm2ea(mpnt)texrmfcoa1lmD  ueo;() etrxo3iudamtelfvia(  2raxmpot1alx ioeiltfmDulump () rermo3ia1op   u ol( s2tmiopiydopeelivtl()srrm(r ot4tlenmoeiltlaDeanvp t4 etniociadfm eluvols trurim3ou4lptnlnei tfarra(roou0olenmfcils a uanvo t4arxomr3oydlp  au i;()s2xrxopiy4apeemnvsat s2taur nt1tex  ociad aDem(vo;t0 rtoxf ta1lpDranesls srto(mpiu4ap nlieta( a2taum ;u0tlxnio3ildlm2umuvs;(4aeenxrcoo1lmDe nvo t sruoxopny1openmieiasfs2uax pno1altomiciadfm eauvo u)aeenxr3iydfmD livo;t s2xrirpno1ale lictl()aDtaurpnt4tle if3tyt mDrluvs t) eenmo3iy1lm rlivi;t0sexmiopiu1ol   fvi (fsrum( ont1altomociydlmDrmn o t4tlenxocia1oaDr uesls)t2umim iu4al nmfesa( aruaxmont0tpt iociys sDeanmonu0treoiociydlaD  uvs;t  etoxm3io1apeemict s)arta(  ;t0opx ifctasfaDulump t)texnif tydfmteaieo;()srxr(m ou1ol nmivtasfarraxr nu1apt mo3iytfsDel(mpnu4 exrmf iadfmDe n ilt s2xm(opoy4lmen nes t a2rm(rono0aetoifcildlm el(mo (0tlenmr ty1omteaueo;t t2uoxm3iodoltelnetl(fa2raxmpnu1tpxo oetasfm2rau pn(4trxoxo oydlp e n sl()sruoxm3ou1opee ieta()aDtaxmpnt1aexo ieiysla2ranmonu)trxoxoctydlm rlivi t  exr(rpoydamtemivs s)arur(  nu0aexnio3iaslaDrmu o ()trerxr oatfa  aivo;t)srxm(o3oudlm emfvil( a2uax pou0oeenio3iysls2emu s t0arxoircoa1lat li ol() exrxrpnydlmt  neilt)sDtrurpot4opto i3tlt aDumn s ()alxnifciy1fmDr ieo;t0trtoimpnu4lltnlies sfaruaurp;t1aeeoiiciasfs2emnvo t0trtnir3oydoatrliei;t) 2uoio3oo1omtnlneil(fa2rru oot0aleo iciasfm rl(vs (4aeeoxr oo1op eaies;()t2um(m3no4lmenlivs s  2taxrp;t4tpxoiictltls2rm(msn(4aeeomocoo1lpD  nes (0 2urirpnydameelivt ()s2uru pno4aexnmf3iys m umnmon(0treoxrcoatfpteaies t)t2ur(r ny1omt lfvia()s2ta(mp;u4texo fcilslsDra( s t0 exnxf ta1oaDrlneol(0trtoxrpio1omte ict t sDtm(m ;t4tltoifeiatla ul( sn(0altrif3oadlaDeluvo (  2to(o3ou1ale mneiat)aDtruroot1oltoii3tysfa rlnvo u0aeerir tytfa  livi;t  rtmimpoy4lptn fct (  Dtrurp;u0opt  ociatfa ua(vs (0 eeoxf oadfp eaneo;t)srumio3oodal  mfviat) Durumont4ope  f3iysla2rm( on()texrxf iadop elivi;t  exoxo3io1lltnmivtasf 2rm(rpoo1aeeomfetytfsDuluvont4 eermr oadoat livs;s)srurxr iu1ole lfes (fa2rrx  nt1openmfctatls2eluvpnu0aexoio tydop ean i s0srtmio oodlmenlncsa()s2trum oo4tpt iieiaslmDumuvs;t0tleomf3iodfmDrluei;s)sexmir3oudoltemietas aDrmxm ot1tpeo f3iasfsDul(ms u0 ltnxoctotlmDeaueols)trxm(o3nu4llt mnvs ()s2um(rpno4aetnmoeilt a ua(vo t0 rxrir3oatlmDe n il( t2uoxr3ou1lme  netl(fsrum(m ;u4altnmo3iytla2rmnmo;(4arerifcta1lp  ln sl()seur(m no4lp nlfctat)srrrumpoo0opt moeiadfm2eauvp u0trtomoctytlaDr i olt)srxoxm3iodopen ncs ()a2taurp;t4tpe moeiltlm2eau pn(4 eenif tytoatr u sls0teurim3nu4amte nvil(fs2taum nt4apenmo3iysfaDulnvon(0tltomr todlm ran i t0 2toxo3nodom elfciatfa2um(r ou1tpt iieiydfs2eau o;t4arxnmo oy1oaDran i;s tetriopiodome  neia()s2urxr ou4tle io3iltlm el(mpn()tltnxf3oy1fmD  u ilt  2umxopou1olee nvtlt arta( oot0tpxo fctys sDul(vonu4areomf3iadfm   nvi;s0seuoim no1altelncta(  Dtr(mp;u4opx moeiltla um(vonu)aetomr oadfmDeanvs;t)srxm(rpnu1apen fesl()aDuaumpou0tptomo3iat a em( p;t4altomrcootlp e nvo;s t2tm(opnu4ameelfvs s)sDuaxro;t4oexomi3iat a rm(vont0 etnxr3iotlpt aivols)tetr(mpoy4ape liesls) rum(rpno4olxomieiytfs uau on(4tetnmr3ootlpDe n s;(0 exoim nudam nmiesls a2tr(rpou0oeen f3tlt a2rmnvo u4tetnxoctydfptranvi;()s2to(mpou4ame lnet sfsrrr(m nt0opxnioctytls ra(vo;()teeomo3tytlpt  ies t  rto(o iy1op nmnvia() Dua( pnu1apxnifciytlaDel( s;(4aeenmf3iadlp eauvo;( trtrxr oy4omtemfesl(f rtm(  nu0ape  o3tlsls em(ms u4trtnxf3iotfptrai s t)srur(o3io1lp   fci t)a2rax pno1teen oeiys m2um(mpnu0 ltoifcoydfaD luei (0setr(o io4lptn ncs t s2rrxrp;u4oex iieiyd aDemu s ()aexrmrciodlaDe nvi (0texmxmpoudapte neilt  Duaxroot4tpxniictadlm rl( o ()tlerxo3iatfa  lnes t)trur(m3ou1op elfvi (  Dua( onu1oexo ieiasfs2ulu ont)alxrxf3iotfmt ln ols0sexoim nu4olenmivtls sDuaxr ot4aexo o3tldfa rmnvp t0trtnir io1fmDrlivs;( t2umxm3iu1openlfci sfsDuauro;o0alx  o3iytfa2uluvsnt4 rxoxf3ootom eaieolt  rxrir iu1optnmfvta()arum( p;t1tltnifctyslm2ul(ms;t4 rermo oy1fpDeluei;t0t2trir3no1lle  icta(fsrrm(  ot0tpxnifciytfa eauvp u4tltoxr oydfpt  n o t tetrirpoy4ape lnvtat)a2uau p;o4tex  ociadls rauvsnu0 rermr3totomD li il( setoxr nodoltn neta( a2tru p;u4apxnmietytfaDeanmpn(0aeeomocoytopDraieo s teuoiopoo1lltn nctlt srrau p;o0opx ii3tadfa2rmnmo;u)altomf3oodfpD ai o;(0tetm(m3oydomenmfvtat)artauront0oltomi3iaslm2emu pnt)tltniocia1omD lnvo t)teurirpny1llee nvil()aDra(rooo0aptoifciydfm el(vs;u) eerxr ia1lmtr nvslt0srxrxr iydapeemfciasf Dtm( pnu4ole mi3ildlmDrlu p;u0aetrio ootom eai slt) rum(r3nu4ll n ici (farua(  ;u0oet if3tyslm umu p;u) rtrio3ty1omt  ieo;t) euoir oodop e fvi ()arum(mo;u0alx ii3tltfs2ranvon()trxrif3ty1fpDe neols) rum(o3iu1optelfct sf Dra(  no4oetomieiaslaDrm(ms;u4 exnio oy1oa rlnvsls)s2umxm3iy1op  mnet (faDtmumonu4optn f3ildfa2ea(mp;t4 rxrxf3ty1lm   ieol( teto(r oy1op nlneias) rrax  ;o4ole  fciys mDua(vo;()trerio totfmt lues;t) exrirpnu1alte iei ( a2urxmooo4olenio3iydla2elumo;t4alxomo oa1faDr ueo;t  etoxmpiy4apenmneilt srrm(r ou4tlenifeiytlaDemumsnt)arenxr iydfptraivs;t)sexr(m3ou1opte ictat  2tr(m oo4apt iociltfs2rm( p t0tlxrxfcty1fpDr n olt s2ur(o ou1al  lnct s  Draxr no1oeenii3ils s2rl(vpnt4aexrif oo1fa ran olt0 eur(m3nudlm e nvtls)aDrm(rp;u1opt  fciasfm2ran pnu0alerif tatfa  lnes t seurir oo1llt  fcsa() 2tr(m nt1apxnif3iys m2rmu snt0 reniocoatlatrauvi;s0t2xmio3iu1am emfvia( srur(r no1aet if3iysfa2em( sn()trtnxfciydlpDe i s;s  2xoim3oy1omee nctatfsDtmumonu4ape mf3ilsfm2rm(vp t) ltnircia1laDelnes t trtmxm nodolt  nei s srrmx  ;o0oetomf3iyd sDumn s;t)teerxfctotom  luvsls0 exm(opoo4llee ict (fsDurxmpot1tpt ifctasla2uan p;u4aexnxrcoydfa eaivs (0t2xoio oy4om e nvsat)aDuru  ;t0tptomfetyd aDeanmpnt0artoifcoodlmte ieo;t  rtr(rpoudalenlivilt a2tmxmpot4aetoifeildla um(vo;u4 rxnir todoaDr uvolt0 2to(mpiu1ame lies (farra(r ;u0apeomo3ilslsDrlnmsn()teeoxrciytop r ivi s trtmim nu4olenlfvtls) Draur ot1aeeoiociltla ra(vs (0 lermo todlpD ln i t  exm(m iudam e ictlt)aDuax  ;t4aeenmf3iytlm2rmumsnt0 lxnmr3todomte ies (0 euoir3no1olen ivilsfs2raxrpnu0ole iictatlaDua(vpnu)tltrmr oydoaD lneilt s2xrir oydlleemietasfa2tm(mp;t4oex miciadfaDrlnvpn() lenmrcoo1om   ueil( tetr(r io1opeemict sfsDraum ou0tlxnif3tldlaDem( pn(4teermociotfateaivo t sexoirpny1lme mietl(f Drr(mpnu4oleoioeiyt a ua(vo t4areoxr3io1lmDr nes t teto(m oo1openmici t aDrax o;o0opt mo3iadls2rmuvo t0 ltoir iy1laDrluvslt)sexmim iodome  iet t  Drmu p;o0oex io3tlsfsDulnvp u0 rtrir3totop r uvs;(0 2urxo oo1ol e fei s aDrrurpno1oee mfeiatlmDran o u0trenxf oy1fatelnei;(0 rxrxr oydom  mfctl()a2uaur oo4tpeomictasfsDulnmonu4 ltrir3tytfpD auvs s0 2uoxrpnydol nlnei (  Dur(r ou1oltomfetld m umu s u0aleoxf oytlmtranvol()sexoio3iodaptn ivs (  rraxmoot0teeoioctydlmDem(mp;u)tetrxo totop rluvo t0srtmim3iu4om  mfvsa()s2raxr ;u4texoifetydla um(mpn(0 exomf3iy1lp   ivi;s)teuriopoo4amtnmnesas srtr( o;t1tpx  ictaslm2umnmo;t4aeenmf oadfp rlues;(0srtr(opiy1olenlnvi ( sDta(rp;t0oeeoif3iadlmDrl(vsn()tetrxrcoa1laDelivi;s)s2umir3iudllt  fesat)srur(mpno0apxnmoeiadfa um(von(0 exoxr ia1fm  anes;t)srumxm3io4am   ivi (f 2uax p;u1tet ioeiatlsDrln sn(4tlxrxr3todfp   ieo;()srxmio3ou1lpt  fcsl( arrrxmp;t4alt ifeiadlm ranmont)trxrif iatfmt aieils trto(mpou4ll e ics sfa2urxm no1open i3ilsla2rauvp t4 etomrctytoaDeliei s  eto(r io4omtn ncilsfarta(  ;u4olxniieiydls2eanmp u) etrxo tytlp rau slt srto(m3iu4aptnmncias)s2ta(mo;u0oltoifcilt a2ea(mpn(4artomrctydlm e n s;s0sexrxr3iy4op   nciltf 2ta(ronu4opeo fetatfaDrln s t4aetomrcoytfmD li i;()srto(o3ny4al n nvs (faDuaxront1oexnmictld a ranvp;() rtrioctadopDrai s (  rxmir3nu1lm elnvs t) Dtau  ou0aeeo o3iaslaDrmumon()tlerif3tatomtrluvi;t)srxmxmpio4optnmfvils) 2tm(rpnu0oleomoeiad a eluvs;u4 lxnxo iotom  li sls)teuoir iy1ol e ivi sfarumxr oo1oeto octlt m el(vo u) etnmocootfm eli i s0 etmxr3io4omte fvt ( srtr( ont0optn fciyslmDem(vs t4tetnmrciadlp rlneol(  2um(rpny4ol nmieilt  rrrxrp;o4oeeo ocild s2em( o;(4tlxrxfcoydfpD  ivi;s0tetoirpnu4open nvsl() 2ta(roou1olxo feiasls2rl( onu4alerircoy1lmtranvi;s) rxrir3nudoptemneil(f Drm(rpoo1tle  o3ilsla um(vs;u) rerxr oodoaD lnei (0s2xmxo nudamtelneslt) 2rmxmp;t4alxn oetadls rmums;(4 reoxo3oo1late iei;s) euo(r3iu4olenmnei t s2rr(r ot4tpeomociytls2um(vonu0 lxnmrcoodopteli s;s)seuoxo3ny1lmt mnvil(fs2ta(mpou0tltoif3iys aDuanmo;u)tlerif iydoptrlneo s  rxoim3nydlle lnvi s srtrxmooo4tpt ii3iltlmDrmuvpnu0trxnir iadlp eauvsl( tetmir3io1optnmfetat s2tmxrpot1opto ieiatfaDuan ont0 leomfcootoat  nvsl(0truo(opoodom   fetlsf Durump;o4oltn octltlmDulu pnt4texriociodop ranvsl(  rxmirpoodap elfeiat)s2rmuro;t4ope mi3tls m2rauvp;t)artrxo3oa1lmDrai ilt  rtr(m ny4al nlict (  Dra( ono0ole  i3iltla2uaump u4artrxocty1oa  ln i s)srtrir3nydame lnvi sfsDumur ;o1olxnii3iatfm2rlnms;t)aexoifcoatom  aivs s)t2trxm ou1llte ies (  Drr(m ;t4tlenmfctyslm emuvpnu0 lxnxfcoatlpDr n i s) 2umir oydll elnesls) rur( ont1oeto oetldlmDel(mo;u4 reoxo3oytfm rauvs;(0t2xrim3oo1am nmicslt aDrru ont1tptn oeildfa2umuvsnu0arxoxrcoo1fp rlu s;t0trtmir3oy4altelicsa() Duau  ;u1aetoii3tld a2rl(vp;u0 lxnxo tadlp e ivilt)setoimpnu4lp   nvslsfs2rmu  no1aptn feiat sDemuvp (0 etnioctotlmtr u sl(  ruoim3iu1al elfei t aDtmum no4apenifetyt m rm( p;(4 rermfciotopDeluvol(0setr(opnudomt mnct t)s2tm( ooo1oexoioctytls2ua(vs;(4trxrmoctatlpD aivil(0s2urxm3iodlmeemfviasfsrururonu0tpeniieiadfm umu ont0alerxo tytomt liei (0trxm(opno1aptnmivs t) 2rmu oot4altniietltfs2ea(msnt) reoxr3oo1lmtrlivi s)s2to(rpoodlmeemfetl( a2uaxront4oleo i3iytlsDra( o;u0 exnmf oy1la ean il(0seur(r3nu1olenlieslt s2rr(ront4aptomocildlmDrlump u4tltniocootfptrliesls0sexoxm ou1lleemneias aDurxmono1tlt mfeias sDeauvs u4areomf oytfptrlnvo s  exmxr ou1al n fcsasfs2ua( o;o4aeen o3tldlaDulu s;u)arxoxo io1oat aieo s)srxrxo nu1amte fci s a2raxrooo4ope  ietyd s rmnvp;(4trenmf oatoptr u s;t  ruo(r3ny1om nmfviatfs2trurp;o1tpx ioctlsfm2eln ont4tetnxf3oo1lpDeaneo ()texmio iu4amen icsltfsrtmumpot0teenmi3ildfm rluvont) renmr3oo1fpDe u ol(  2ur(o ny4amtelneilt)aruru ooo1altoioeiyt a2el( o;u) lxoio oodfpt auei;t trur(rpou1ome mivi (fs2truront0tet  i3tat mDrmumont)alxrxf3tytfp elivi ()texmimpny1ape livsls)s2rrxmp;o1opx mo3iyslsDrm(vs;t0trtoio3iatfptrln i;s) rtoxrpnydlpen iviat srrmxr ;o1aptoio3iatlm rmu onu0treoxf3oatfatelnei (0t2um(r nu4amt lieilt)s2rmu o;o4opx mociyt s ran s;t4arxomr todla e i ilt)s2urxm3nydll n fvsas)arrrurpoo0oetn ociltfa2umu p;(0aeerxfciydomD  ivs (0srxo(mpoodalt  nvtasfsDraurp;o0opxnifciadfa umuvpnu)alenxrcoadomt aneolt0tetmir3iodlltn ncil() 2ururpot4openmf3tytfs ul(msn(0alxomo iytopt livs t srur(o ny4openlivi s a2ua(mont0tleomociatfa em(mo ()aleomo3tydfm r nvo ( trur(r3oy4lmeemnvta()s2rmxrpno0tpx mieildla2rlumo (0arxomr3ty1op  lnesl() exrimpiy1aptemfvslsfa2trumpnt4olxniietad s2emnmp t)altnmo tadlpDeaneo;s0srtmirpiy4lmte ivsat)aDrmxroou1openmiciat m rluvpnt0 etoxr todopte iei s  rto(r no4llee ivils  Dur(ront4oexn i3iaslm rm(vs;t0aexoxf3to1la   nei;(0s2xm(m ou4omen fviasfa2rr(mooo4olx iietad mDumumo ()aeeomf ia1omD  ivsl( t2xmimpnodol   ncia()arrmxmo;u4aet ifeiytls rl(ms;(0trxrmr oytlpte ueslt) eumio3iy4omte ietls s2taxrpot1opx  i3iasfs2ran s u0alerxf3oydfpDelueslt)s2tmiopnu4ll e ivilt) rtrxmpnt4tex ifetatlmDeaump (0altrmf3iy1fmt aneils)t2xmxmpio4op  lfeil() rum( p;o1olxomfeiasfaDum(vs t0 eenifcto1op r ivi;s0trurir3ny1oltnlnviasf 2um( oou0altn ociytfmDeaumsnt4aeerio oadopDr uei s)srum(o3iu4om  lncsl()srtmum no0aeen i3iatfm uauvp;u4altrifcio1omDrai ilt)t2ur(m3nudom emfvtlsfs2umxm ;o0aleomictydfm2el( snu0aetoircoatoaDrlneo t tetmxr3oudameelivsas)arrmurpnt4tlxnmi3iltfa2el(ms;t)aetoxf3iy1oaDrlneil(0 eurimpoydom   fvsasf rraxmp;t0olto f3iysla2em( o;(0artnxr iotop eli ils0seuoim oo1op e fci s) Dtr( ooo0olx  o3tas sDuan pnu)arermrctydfa eau s;( sruoxrpnudopeemfvias)sDta(moot0alt  feiasfa2um(vonu)alenxo3todoat ai s;t sexrimpio1al n nctlsfa2rmumpot1apeoif3iat a2ea(vp t0aetomf3oodfmt auvols trxrxo nu4om e fvi ()srur(rp;t4opt io3iltlmDumnvs t) etnmr3tadlm raivs t0 rtmxrpio1lmeemfct (fsDta(moou0tlt  f3ildfmDemnvp (0 leoxr3oy1lm eanvs;t)srtoim3nu4ol   iei t arrax  oo0apx if3tydla2umnvo;t0 eermocoa1fatrauvi;(  rurir3oy4aptelfcsatfs2ra(  ot0apxomo3iytlmDeaums u4alxrmr ty1fat lieslt)sexr(opoudap emneil( srraxmp;o1tleo f3ild sDeaumsn(0artrir3iadfa   ueils0tetr(m nodap n fvsa( s2ra(r ;t1tltn oeiltfm elnvo;t) exnxo totomDeaivi (0texr(opou4omteliet (fs
\ No newline at end of file
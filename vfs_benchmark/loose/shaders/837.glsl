@@ -0,0 +1 @@
+u s;(  rurio3nudap emicsasfsrurx ooo1oleoiieild m ul(mont0 exoiocia1opteaueo s  2xmxmpiy1lle lnvs s s2rmu o;t1oexomictltlm elu p t)trxnxfctodopt auvo;( t2xrimpiu4omte fvi tf 2umu oou0oexn ociyt mDulnms;()altrmociotfa ranes;( s2xoxo oy1lpe mfvs ( s2umxrpoo1teeo o3tasfs2rm(mpnt4 lxoir3tytlatr u slt0 eto(r3iydoptn ivsas)s2umum ;u0tpt  ieiysfm2ranms u4tltrmoctotfaD li i t  ruoxmpnudole livta()a2uaxroou0oee  ociasfa2elu pn(0aetomf3tytlpD  uvs;s)s2toimpiu1optnlfci tf rrm(m oo4tlen oetydlsDeanmpn(4aeenio3oadoaD  ieolt0truoxm nodameemiviasfa2um(mpnu4opx  f3tltfm2emumont4aetoif iatfm   n ilt0srumxopoydlmtelfetas artm(  no0aee mfeiatlm2emumpn(0arxrxr oydlaDraueslt  rum(rpno1opee ies s aDurx ooo0ole  ietltfa rmumo u4aetomr3ta1optrlneo s)t2um(opny4omeemnvil(fartr(mont0apxnmictytls ea( p;u0arenxrcoodlaDraneo s)trtrxo3ny4lptnlnci t s2trx p;u0apenmfcils mDemumon(4aexrmrciatfpD livo;t)trtmxrpiudop  liei tfs2uaxrpno4tlt  ieild sDrau sn(0tlenmrctytomD auvo;(0srtoirpoudomt  nvslt) 2tr( ono4tlxn f3iatfsDem(vpn(4tltoxo ty1lpt  uvi ( srxmxmpiy4oleelicslt)a2ra( ono0tex mociytlmDelnvs;u4arenio3iytfmDrauvsl() rumxmpiydomt mfvtl( s2ra( p;o0alxoifctldfs emn s u4 exnir3tadoa eluvs s t2uo(o oodll emfct s  rrru onu4alenmfeiyslaDrm(mp u0 ltoxr tydlpDeaies;t s2urir3no4oltelfetlsfs2tm( ooo0tpxnio3iadfm2uaums ()tlxoif iatoatrluvo t0srtoio iydapeemfeia()a2uaurooo1tltomoeiatfmDelnvonu)texoxo3iotlmDe uvils  rxoirpoo4lp e netlsfaDumxmpnt1apt ioetld aDrlnvpnu0tetoxfciy1fmtranesl() rurxmpnu1lmtn nct ( srrr(roou4tlxnmf3tlsfaDelnmp t4tlerir ootlatr nvi;s)truoxm io4ol  mfvi (  2tr(rooo0oetn fetls m2uanvp (0teeoxr3iy1fat au ol()srtmim ou1ameemncs ()a2umx oou1aex  icilslmDranmonu0altomr3totlaD an o;t setrir iy4apt licslt  2ra(r ;o4oltoiieiytfa2ea(ms t0 rermr3to1la eliesls0 rxrxr3ou4lpen fvi (farumurono0aexoiietyslaDrmnmp;t4 ltrmr3ootoaDe n i;s s2xo(o3no1lptemnvtl(f rumumpnt1aeenmf3ilsfs umuvs u4altnxrciodfpD  u o;t)texrir oudlltemiesat  rtm(m ;t1ape  f3ilsfm2uau o () reoif iatop  aueslt)s2tr(o iydopee icsl( srumxm ;u1apx  oeiytfm rmuvp u4altnif iodlptranes () rxr(r3oudomenlicsl()sDtau  nu1oexn f3taslmDra(vp (4 eenir iadlmDe i i;()srtriopoo4oltelneia(f rrm(mono4opx mieiad s el(mp;(4tetrmo3iotlmt  uvi;s0t2toir nydllt mici (fartaxm ot1aleoioctlsfs2emn s;u0aexnmrctatlptelu slt) rtrim3io1olen nvsls arrmum no4tpe mi3ilt a2ua(ms;t)arxoxfciotfp eliesl(0 rtmxo iu4lpt  ncsl(  rtm(r ot0apxo fciytfa2rm(vpnu4alenxr oodom r i sls0srtoxm3iy4opeelieil()s2tr(moot4opxoiocilslm2uanmpnu4teenifctodfatrlivo ()sruoxr3no4apeelnct t sDum(m ;o4tpt  oeiysla uln p;()trxoxo3oatfmte u o t)sexoxo iydap elics sfa2rmx ono0oexo iciyd sDrmuvsnt4altoxo oy1lmDe ieo t seto(m ny1lm e fet tfarrm(ro;t4alxo i3iadfaDrmuvsnu0 exrmo3oo1fmteaivi;s0srto(m3iy1omtelfcslsfarrmu  no1ape iietld m2rlnvo;u0arxrxr tytlaDe i o ()srtoxrpou4apt mivsl()aDuax  no4teenmoctltls2rmuvp u4 lenir3ootoaDeli sl(0 2xoxm3ny4altnlnvias  rum(mono4olxoiiciltlsDranmo;u) eeomo iadlpteliei;()srtmim3oo1ameemiet ( sDururono4tpeoioetyslm2umnmont0aleomr3io1lptrau ils)s2ur(r3nudamtnlnvt ()a2rm(r ou1tex io3iysfm2rl( sn(4tetnmf3tatfpDelnes () 2ur(o3oudap e ictltf Drm( ooo4alx  iciasfsDrlumpnt0 etomf3iy1opDelueslt0texmxrpnu1oltn ivils  2trumo;o1opx ifeilsfmDumnms;t4alxrmrcia1omD aneo;s0trurir3iy4amt mnvt tfarrmu  ou0altomf3ilt sDrm(vo (0 exnmoctytfmte ivilt  exmxm no4olt lfvi t sDtaumpno4apto oeiadfsDua(vs ()trxnxrctadfmDe nvs (0 2to(m ou1ap eliei ( arrru  ou0aet  ieildfm rau p u0tetnir ootfmD an s;s0srxoio3nodap  mfvil( aDrmurpnu0alto ociyd sDemuvp t)tetomo tytfp  li i;s) etr(opiodapt mfcsls a2rmxroot1opxoif3ilslaDrlnmo t)teeoxr3ootomtraivi t)t2xmir no4opt  ietas) rrmu onu0ole  i3iadfa ua(mp;u0 exomrctotomDr ivolt)trtmim3nu1amee ivtl() 2urxrpnt4alxo i3tytlaDeluvsnu4tlenmfcta1om ranvs s) 2urxm3iu1lmtnmfcia(faDtr(ront4aeto oeiat s2rl(mo u)texriociytfm r ies;s  2trio3ny4ame mfviat aDtrur ou4teeomf3iydfa uluvont4altrir3oatlpDeaivo;t)t2urir ny4lle livia(fa2tm(  oo0apt  icildfmDrln o t4aeeoxrcio1optrli slt)tetriopnu1ope mfeta()a2tmu  no0apen fciyt m emuvp () etoio tadfmD aivs;t0setr(opiu4ap   fcsas)aDumxr ot4aexo oeiad a2rlu snt4alenmr3oo1fp rluvi;s  2umir oodlp e fct ( arrau o;t4tltomi3tyt s2ranvpnt4artrxf3iy1faDraues s0 2uoxmpny4om  mncilsfa2urxm ot1aptn o3iadfa ea(vsnu4altrxr3iy1la eaivo;()s2xmio oydopt  icil( s2rr(m no4tpenifciasfa rln pn() exnmrcio1oaDr ivo ( t2urirpno1lmt mnesls  rta(  nt0aeenmfctld a2eluvp;t4alxrirctytfpDelivol(0trurxr3oydol   nei sfaruaump;o0opeo fetls s2em( snu0arenif3tytlp rlu s ( setr(r3io1opt livsls) 2uax  ;u4teenifctat m2uanms;t)aetnircootfat  nvo ( s2xrir iu1oleemnvsa(fa2tmxm ot4tlenifeiad mDem( snt0 ltrmo3ootom rlivsls seum(rpiudale  ivtltfs2urx oot4apen i3ilsfsDrlnmo ()aeeomf3todfm rlnvo;t)srtmim3io1apenmnetas aDrrurpno0oetn o3iysfsDranms;(0artnirctytfmtelieilt)t2xmxmpno1lmee neil(f Drrum ot1tlxomoetyt a rlu pnt)aeermf oydoaDe uvo () exo(rpou1om n ivsltfsrrmx ont1tee moetys s2ra(mo u0aexnmr todlatranvsls)trxm(opiy4lmee nvt ()srtau  ou1aee ii3tasfs2ua(mon(4artomo3ia1fptelivi;t)trxo(opoy1ole livsltfaDrm(r ;t0oexniictlt m2rmuvs t0 rxrmr3oadfpD lneo;s) etm(o3oudolenlivta() 2tm( o;u0alxniiciydfm emn p;u0 rtnio tydlpDrauvilt  2xrxr ny1aptn ivsa()srumxmp;u1tpto ociys s uanvonu4artoxrciodfaDr uvilt)trtm(o3iu1openlnvsltfarrr(r nu1opto iciyd a ua( o;t)tlxnmrcoy1la eaivols t2tmxm3io4ome mfcilt a2urxr oo1apto oeias s2rmnms u)tlerirctydoat anesls0trxmxo3oy1llt liet sf 2rm(mooo0oexniieiadfm2eau onu0 exniocto1lp   u s t0 etrio3iodapte fvi s)sDurxm ot1oex  icildla ranvp (4altrmr3oytlm eaneils)texr(mpiu1lp e ivi sf Dtr( ont0aptnioeiat m ea(vo u) exnmrctadopD  n o t)srumxr3nu4om e fcslsfaDtrxm nt0optoioeiytfmDrlnvpn(0aexrmo oy1omDraneols) 2uoxm iydop  mfet s sDrauroot1olenifeiytlaDuaumo;t0 rtnif3oa1op eli o t0srxm(r oudame  netltfsrra(mo;t0tpx  i3tldfs rl(msnu0teerir ia1omtr i s;( srxm(opiodlpt  ies t) Dtmx p;t4tpxo i3ildfsDum( pnu0texrxf3oa1latrli ils setoimpnu4apeelfcs (  ruru p;u1aleoioeiatlm2umnmpnu0 rtomf ty1lmtraiei;t trxmxr3ny1am elneta(faDuru  ou0aleo i3tld mDrm( p (0aetnio ootlpD  n o t  exrimpou1lptelnet t)aDtm( pou1apt mociat sDrlnvp () exnio3iadfa elnvols0trtoxm iu1lmt  nes tfsruaum ;o1alx  o3taslm2ua(vo t)arenmr3oa1fateli s;t0srtm(mpou4lp  lfeiatfa2ururpnt0aeeo iciatfm2emnms t0aexrxo3ia1fm eauvs t0s2urxo iy1omen nvsat) 2rrurpou0tpto fciasls elnvo;u)aleomrcoo1la rlieils0 rto(r3iu1omtnmfetltf rtmum nt4tptniocilsfm2emu pnu4teenmociydopD  uesls) 2tr(m iydamen fes sfsrrmur oo1tee io3iad aDulumont) reoxf iytlmt au olt0s2uoxm oodlp  licsat sDrruront0oeeo f3ilsla2ra(mon(4tlerirciy1lpD luesl(0tetrxopnu4alenlnvia( sDua( p;o1aex ifeiyt mDrm(vo;(0 ltoxfciydfm e nvi s  rtr(mpio1al   nei ()sDrr(rpot1tpto f3iyd mDra(vs u)aetomocty1lpD li slt srtmio3iu4om n nviatfsruau onu1oex mfciltfsDean o;u0 reomociotlateanvs s0 rxmxo io1opee nvslsf Dtax pou4alto o3iytfm ra(vo u4teeomf oadlptrau s t t2tmio3io1llen fctlt)a2raumpot1tlen f3tls mDrl( o;u4tltnmrcoadomDrli i;t)s2tmio ny1al emiesa()a2tmur oo4tpe mi3tasfm el( s;t0altomfcoa1fa  ai o;s0teum(rpnydlpt mfesa(f rtmxm ot0apxomieildlaDrau o t0arxoxrcoo1fa eln s t texrirpiy4amen feilt s2rmu p;t0opt mf3ils s2rln s () lxoxr ia1lp rauvs;t)t2toxo3ny4ameelivi s sDtaur ot1aeenmieiat m2emu snu4 rxnmr3todomDeluei;() 2xoxrpoy4om emnvsls) Dumu pnu1aet if3iltls2rlnms;t4altoxo ia1fp e ies;(  etrxo iy1olte fvt (  Dtmxront0apxnmf3tlsfaDra( pn(4tetomoctydlm ranes s0srtr(rpiu4opeemivtat aDumu pou0oleoif3tatfm2ra( o (0 rxnmfciytfpD au slt)setrirpoodoptnmivsl(fs2rmump;u4olxnmieiltlmDrl(vpnt0 eerir3tadlp   ieols0teumxm3iy4ole livi t) Dum(mo;o0olxomf3iatlm umuvo;t4 lxrmf3iodfm e iei s  rxoiopou4amen iet s  Duaur oo0texnifciyd a el(vs t) renmrctodopD li o s)s2tr(r3iu4altnmfeias  2umxmpnu0tpeoiietadlmDemu p;u) reomr oydfp elueo (0trtoiopoy1lptelnvs ( sDrau  ;u0aex if3tltfaDemu ont0tltomrcoodlat  u s;( sexrim3io4ap nlfvt () rum(mooo4tet  fciaslaDuln pnt4tltnxo iadlp eai s t) 2tmxm no1ole lnvsa(f 2tru pnu4tetomo3taslm2em(vo;(0 reoio oatfmDr n ilt0 2umxmpnu4lleelfcias)aDur(ront0tpxomfeiltfa elu s (0 exnmr3oodfptrlues;t  eurxr3oo1lltn fetas)srur(ro;t0olx  o3iysla2ua( p t0 lxnio3oadoptr ieols s2xo(mpiydope mfvilsf rrmx ono1alx ii3tltlm rauvo;u4trerio3oytop   uei;s  2umxm3oy1apeemfvslt) 2rmumono1aexo ociyslmDeluvp (4 exoxfciatfpD aues;t0 2xmio3oudome lnci t)aDta(m no1aptoioetysls2ran pnu0arxnxf3iytlm e uei;t) rtoir3io4opt mivtat aDrr(r ;t4tltn fciytls2rluvo () lxrxo3oodfaDr nvs;(0t2uoir3ny4opt lfvs s)sDta(m no0ape  ietad m el( s;u4alxoif iodoptraivo (0trto(rpoodope lnvias sDumurooo4oeeo octadfa ra( p;t4 lerxf3tatopDe i slt)sexmir ny1lpenmncsls)aruaxm ot1alxomfetat mDemn o;() lerif3tatop e ueo s)s2xrxm3io1lltnlfvia(  ruaxm oo4altnii3tytlmDra( o ()alxomo tytfate ivols0srxr(r oodaltnlfviasfa2tmxmp;u0apeomf3ilt a umnvo (4areoxo io1oatrluei s0 exm(opoy4ll  mfesat)sDua(ro;u0alxo octysla2em(mpnu0 eeomr3iotfm   ieslt  eurio3iu1optnlnct s)s2ur( ont4olt  ocildlmDea(ms;()teeoircoo1lmDe u slt0seumim3nu1lleelfct s arrmxro;u4aee if3iyslaDrauvp;t)aleomo iydlpte u i (  2urxr oo4lme lfvs sfsDtmxmoot1aetoioetys mDelu onu4tltrifcoy1faDrluvo;t0 2tr(m oy4ale  icil(  Duau ooo0aex mieildfs2emnmonu0tleomrcoo1opt ai i;t0s2to(o3ou1op   fvi () rum(  ;o1apxnmi3iltlsDumump t0 eerxr3oodomD  n o;s)teurxm no1alenlicta() Dtr(m nu0tpxo feiasfmDelnvp;t4 lxnmr3ty1fatraueolt)texmxr3ou1oltn nvtl(fsrurumpno1opx ifciatla2em( pnu0 eeoxf3oatla rauvs s0 2xoiopoy1lltnlnvt tfsrumxrpoo1tpx mo3iydfa ua(mo;t0aeerir tatopD li slt)teuoxr io1lp nmictls) Dtrump;u0alxnmfciadfs umnvont) exrxociy1optelnvs s0seto(mpny1oleemfct (fa2tr( oou4oex  o3iat m rl(vs;t)tleoxf oa1faDe n s;(  ruo(m3iu4lptelnetl( sDtmu pnt1tpx iociatla2ulnmonu)texnxr3todlm r u olt  exrxo3oy1omtnlnci tfsrraump;t4aptnioetydfaDel( s;(0alxnmo3tydlpD ln s;( texo(r3oodlmeelfcils  rua(  ot1alenmoctatfs ea(mp;t)teerxr ty1optraivo;s seuoim3nodllenmivi t srtrx  nu0oexoiieias aDrlnmo;t)tetomo iy1lmDrlueo;() ruo(opnydamee iesa()sDrrx ooo1oexomoctydfm rmumsnu0trxomf ootlmteaneols)s2xoxopou4lp elnet s s2rrur ot4olenmociat mDrl( s;u4altomr3todlmtraueils teuoio3iy1ap  mnesls arrr(monu1tpt mfctadlmDrmnms u)aexomfctotfpDrlivil(  eumxopnodoltemfcils aDrmx  ou0tptnmfeiytfa2rau s (4 lerio3totlpDr u o;(  2to(opiudapte feiasfs2rmx oou4tpen oeias mDemuvp;t4 exrircoa1opDrlu s ( tetr(m nu4omtnlfes t srrmum ;o4tlxnmo3ildls2emu pnu4 eenif3oa1fpD anvi () 2uoir3iu1ll   fct s) rta( pnt4tle io3tldfsDel(mpnt0tlxnif3oatlpD luvi ()trtrxrpno1omen nvsat)aDtmxm ;t1altomoeiys s ran s;u) lenxr tatlpDrlnvo;s) 2xmxr3oydlp e ivtl(fsDrr(ro;o4alen ictlsfaDelnmpnt4 eeoif3to1lpteanvo;t tetoim3iodopt  ivia( artau  ;o0ale mfeiysfm el(mo;t0texnxr tydla  lieslt  rtmimpio4op e ieiltf ruru p;o4opt ii3tat mDumu snt0 leoxf3iotlaDe ivils srxrimpnu4lp nlfcsl(fa2ururpnt4aleniicild aDuanms;u0altoxfctodfm rli s;(  rtoim nu4omenlfvtasfsDuaxm no4opeoifciltfs rl(ms (4tetrio ta1lmDrau slt)sexoxo3iy1lpe mivi (fa2tr(ro;o1opxnmieiltlm2eanmo;t0trtoio3iotfat lueslt t2toir3iy1lme  fvil(  rrmxr ;o0alxomfctlsfs rmu pn(4aeermrcoydfa e nvs;t0 exrxm oy4lmeelnvia( aDraur no4aexoif3tadlsDum( p;t)tleomo3oydlm eau s;t) rxrxr io4ol  livsl()arua(rono0alen iciyt aDemnvs;(4aeenircta1opD  i o;( trumxo3io1omen iet ()a2tmu o;t0tleoifciytls2ua( o t4 ltoxr3oydoateln il(0s2trxr iy4ope lfviat)srtmurpoo4aptnmi3tasls uln pn(4 ltrmocoatlaD ai s s  eurxr oo4apen nesltf rta(mpnt1tle mieildlm um( s;t4tlxomf tydfm  anvs;t0trtm(r3iu4ll nlfesls)aDurump;o0opeomfctasfs rau s u4 exomo3oy1fp e i i;( s2xm(o ny1opee fctl()aDumump;o0aee mo3tytfsDrlnmpn() reoxf iadfmD  uvi ()sruo(mpou4ame lneia() rtmur ;o0tlen feiltlm2em( snu0arermo3todom eaivi;t0t2tr(m3no1ll emfviasf Drax poo4opt  o3ildls rl(ms;(4 lerirctodfmte i i t)s2toxrpno4lp n nvil(fa2uaxmpnu4olx if3tld mDrlu p;t)alxnio iy1late ueo (0s2urxrpiodop emictls  rta(  no1aee iiciydla eauvo (4tetrmr todfptr nvs t0 2xmir3oy4lpenlfeilt)srurx ooo0aptoio3tltla uauvsn(0trenio oytlm r n o s  2toxopiy4al emnctatfaDtmurpou0tlenifciaslaDrl(mo t)aeenmo iadop rlu s;s0 rxm(opny1oltnlict (fsrrax  ot4tptnmfeiadla2ulump;(4arxnmf ta1fp rlies;s0 ruo(mpiudopt licil( a2tax  nu1oeenmietadfsDem(vsnu)tlxrifctydlmte u sls0s2xoxo3oo4ol  lfei sf Duaurpnt0apx mociltfs2um( s;u0teeoif3iytlmteli o t s2xm(o iy4ape  ivias)a2tmump;t4oeenmicilt s2rlnms;u0tlerxrcoa1lmD  nvilt0t2tmir3oy1llte ivil() Drr(rpoo0oee iociad s2ra( pnu4 rxnmr oodlm e ieo s setm(r3ou4olee ictas arra(rooo4olx  fetyd sDea(ms t0tlerxf iadfmD aivols0s2xoirpnu1op nlfvilsfsruaur ou1tpx  o3tyd a2um(mont4 ltrio3ia1lpDran o t0srtrimpoy1lltemncsa() rtm(mpno0tltnio3tld mDul(vs (4teerxr3tatlate nvsl(0 eum(o nudoltnlieiat srur(rpoo1aeeoiicilsls2uanmp u0tetnxocoo1fp e u il() rurim oudapt lfesatfs2ururpnu4tle  ictytla2ulnmon()tlermf totfm   ueo (0 exmxopno1lmenmncsas)aDrrurp;o4tetoio3ias a2elumsnt) rermo iadfmDrli olt trtr(r oodlme  nvsas) Dumxm nt1altomfciadfa emnvsn(4tltnmfctydlmtelnvol()trtr(m oo4lm elncta() Dtmxronu0olxnifcild m ul( pn(0arenxrcta1lat aivs s)setmxopoydopenmfvil() 2rr(rpno1olxn fetydfsDumuvsnu4 lxnmr tadla eaneil()tetmxopno4apee ivsa()s2ur(rpno0ale mo3iysls2ulu s u4arxomf ootop  aivs (0 2umxr3ny1lp elfes t  2rr(  oo0ale  i3iys a rlnvont4 rermoctytfmtelnvo () rto(rpoo1ale miesa()srrrxmooo1tetnmoeildfm eau s;u0aetnmfcoo1fp r ies s t2xrxrpny1lmte ivtas) 2rm(ront1teen fctltlm2em(vp;(0tltoxrcoa1omDrli olt0 rxr(o3ou1lpt  feiasfs2ta(  ou1oeenifciasfa2ean s;(0aexnif tadfptrlneo;t  rxrxo3no4altnmiciat s2tmxr ot4aet iiciydfm2uau s;t)aetoxo ta1lpt  ivslt0 eto(m3iodopeelfcsa( s2ua( onu4tlxnmi3iltlaDrl( o t4arenir3tatfm   n o t0s2tmxrpoo4amenliesat  2ta( oot1tle  ieilt s rln p;(0teeoif iatfm eau olt0trur(mpio4lmtnlicta()arrmxrpot1oeenmo3iytfsDul( snu)treomo3oo1fa ean i;s)s2um(rpou4ameelncta(fa2ua( p;t4oet  oetldlmDrmumon(0arxnio ootomtraiei;s0teurxm nudllen ietl(f 2tmx pou1tpx ioctld a2rlumpn(4tltrmf3todlate uvsl( texoxo3oo4lp e ieiasf 2raumpnt4oleoioeiaslm rm(monu) rtrmrcootoatrlu s () eurirpiy1lm e neils)sDrau ooo4tpxoioeiys mDrlumsn(4 ltoxf3tadomte uvils seto(m3iy1ope mies (f 2rr(mo;u1texn i3iys s2rmnvont)tetoxr3iodfmt  u ilt) rtoio oy1ap  mnesl( s2umu ooo0teto iciyt aDrm(vo;t4altnif oytlpte nei;(0tetmxo iy4lmt livslsfa2rm(moou4aeeomieiadfs emums;t) leoxo3iodopD aieilt  2xo(r3nydaltemnvi sfartm(m ;o4aet  icils s rmnvs () lxnmfcoatla  ln i;()srxoxmpoodllt  ivs s srtaumpot0aptoiociytfs2uln p;t)tetrmf3ta1opDeaneol(0 etoxr3iy4am elnesatfsDtrxrp;t4tpeoioeiad sDemnmo u0arxomr iytfm rln ilt0texmimpnu1ol elfci tf rurxmont0tptnmi3iatfm rm(mont) ltnxo3ta1la r ivs t) 2xo(m iy4llenlfes s)aDtmu oot1altnmictydls2ul( snu0trxnxr tydfa eai s t tetr(m3io4lle lfcsa( arua(  ;t4opeo feiysfm2emnvp t0aeenir iydom rln o;s0trtrim3ou4am n iciat artaurpno4tlxoifetydfs rlu pn() exrxocio1fm elivo;(0tetoxr3iudamtn ictlsfaDrmxmonu0olen feild sDua( o u) rtoir3iotfmD auei (  2uoio ny4lp  micsltfaDuaxr nu0altnif3iys a2ea( o;t)tlerxo oydlaDr n s () 2uo(o3ny1llt lfci t  2rau poo4oltoiocias m umnmo;(0tetrxo oytopDraivo;s) eumio oydll n ieiatfsrrrurp;u1tpxoif3iasfmDuln pnu0aetrmf3ta1fmDraneilt) 2xo(mpnu1lm nlieiat a2uax onu4oleniictlt m emnmont4 rtnir ia1lmt  u olt t2trxr oo4lp e neils  Dtrx p;u1aex mocilt aDem(vs u0aexomrcoo1fp eaues;t0s2umirpio1alt lncils)s2tmumpnt4olto f3iys mDemu onu)arxrxf iy1fa eauei t)tetm(mpiy4ap elnesa( artaxront1opx  f3tld m umnms t) exnxo3oa1omt luvs t)srxoir nu1lpeemncsa() Dtmur ot1apt mf3tytlsDuaums;(0trenif oytfmt lu o s t2uo(m iydlpenmnvs s) Drr(rp;o1tlt moeiytlm rauvsnt0alenif3ty1fp  au s;t t2um(m oy1apenlnvtl(  Draumpnu1teeomfeiyd s rluvp t) rxoif3totlaD  nvo;t0tetmim3iy4al  licslsf 2rm(ront0tlxnmf3tytla2raump (0arxomf to1oa ran o t teuoxo iodllt  ivta(fsDrmu p;o4tpx ifciatla2ul(mo;t)tlxrir3tytfpt  i sl(0t2uoiopoodlle  ivs t s2rru p;o1tleomfeiys s rm(ms;()aleomociotfa rlues;s)t2uo(opiy4op  mfvsltfaruaurpot4tle  iciydlaDel(vs;u) ltnmf oodomDrai s t0t2xoir3oy1aleemfcia(farum(r nu1aetomiciasls eanmpn(0alenxr totfaD au o ()t2to(m3oy4lptemfvilt srtax  ot4alxn o3tydfaDemu p;(4trxomr3oatoat aivslt0s2uoim iu4ole  icia(  Drax  no1altoiieiydfm2eanmp u)trxnmo iy1lp  luvs;t srtmxo3ou4opeelivt tfarua(mp;u4altn i3tltfsDrl(mp;()teerxf oydoateanvs ( s2xr(r nu1ome  nctl()srrr(m nu1oex ifetyslm elnvpn(0 eeoio tatop   ivi;t0srxoirpoy1ap e ncils)a2ua(  oo4alxoioeiatlm uau p t)tltomrciydlaDr ivol(0t2urim oudlpeelnes sfaDrrx o;o1opeo o3iytls2em( o ()alxnio ootlm rauvo;s srxo(r ny1om nlivs s aruaurpou1tpenioetldls2ua( ont0teeoiocoo1lp e i o s)setrimpno1lm e fvi sfarrrum ;o4oex  fcilsla2ulums t)aeerxr oadop rli ilt)sexrim3iy1ol   neilsfa2ur(rono0oexomfeias s2ulumpn(4 ltnxr tytfa   nei;s trtrim oy4lptnlneia( arrrum no0aptoifetls s ra(vs u)texrxocia1opD  ieo;t  rxo(opoo1lme mivsl()aDtaumo;t0apeoiictlt s emu sn(4trtniociodoaDe neo ( s2uo(mpoy1lptelncsat)sruaxmp;t1tetoioetatfsDumu o;()tlxnxfcoydlmD  ues s0sexoir3io4ll e neiasf Dua(r ou4tee  o3iatls emuvp;t0 reoxo iadlpDrluvs ( seuriopoo4ol   ieiltf rtmxrp;t1teeomo3iytfmDuaump (0alenxo iatfpD  nes t0t2tmim3oy1lmtnlieiltf Dtaxr nt1aexomfcilsfaDemnmp;u)arerir3tatoaDeanvil( trtrir3oy1ole  ict s)sDum(m nu0alx  oeiatfa2eaumsnu4arerxf3iodlp eanvil( teurxr3oodop n fct t)aDuaxr no0tpeomoeiytfsDelnvpnt4aexoxr iy1oat auvo ()seuoio3oo4ll nmiesas) rumxm ;t1opxomoeiydlm2um( pn()trtoirciatopDeau o t seumxmpoy4lpee ietas) 2tmxr ot0texn ictydlsDelnms u) rxnxf3oa1op elueo t) rtmimpio1al e ics s) 2tmxro;t1olt mfciltls2rmuvs;u0 exrmociotom elueo ( t2tr(rpnu1apeelfciltfaDrrum ;o4ope ii3iasla2rlnmsnt4tlxnif io1laDrauvilt) rumim3ou1olt lici sf 2umu pnt4aex mo3iad a2rmn p ()aeenmocoy1lmD lu o ()teum(rpoo1open iet ( a2raumpoo4alt  feiasfm2uau snu4 etrxo io1lmDr ivs;t) 2xm(o3io1llenmnvta() 2ur( o;u1alxo feias a elnvo t0 eerircoydoaDrauvs;s)s2urxmpno1ap nlnviat artmxm ;u0aptnmociasfaDra(vp;t4 etoiociadom r n o;s0setrxr3ny1lp emncsa(f rtmump;o0texo feiasfa2ua(vs;()trtrxf3oadoatrluvo;t)s2um(m3io1om emnvtasfsDrr( poo4opxomi3ildla ea(mo t0aeenmfcia1lateliei t)trumxmpiy1om nlivtlt) 2rmxro;o0oex mietldfm2ran p u) etoxrcoytfpDrauvi;() 2xrio iu4ol emicia(fsrtm(ro;t1opx mfciltlsDrmu snu4arxoio todopDr u i (0 etoim iodlpt  nciat srtru pnt0aetnioetytfm2elnvsnt)altomr3oadoa ean i;t)setmxo ny4apte fct ( aDumu  nt4tex if3tadfmDrm( sn(0aeermf3oodfmt li ilt0 exr(o io4amtemiet s sDtaxm ;u4opx mfciasls2ulnmon()texrxo3tydfmD aueil() rxm(mpnudlm n fvs t srtaxrp;o1texoii3tad s umn s u)aexnxf io1fatr ieolt0 2tmxm3ny4lm nlncsl( sDta(ront0aptnmi3iatlm umnvs u4 lerio iydlmt aieo;t0setmxmpiu4al  mnetls  2rr( oot0tex ioetydfm2uanvsn(4 reoio iodopD lnei t trtrim ny1oleemfeilt srtaxmooo0opx iociydfs um(mp (0 exoif oy1optr neilt  rtr(rpoy1ole mietls)aDumurpoo0tltomoctys m rmuvs t)teermocia1fatelues;s)srtoim3iodape  fvilsfaDrr(mo;o0oexnmfciytfaDelump t4texrmr ty1optrauvo;t t2xmxrpio1lp elfeils)aruauront4apxnmoetld m2rlnvs;t)texomfcta1fmtrlnvsl()trumimpoodlp nmicsls)sDtmu pnu1tlx  o3ildlaDeauvo (4altomr3tytopD au ils)sruo(o3iu1omt  neta(fs2rrxmono1ape iieiasfmDrmumpnt)trtrif3tatoa   neslt)srtrirpnudomtelfesa(f Drmxmpnu4texn ieiysfa emn s (4artrmoctytla  lneolt0s2tmir3io1om nmici ()srumurooo0tetoio3iyd sDranvs;t)aetrirctadom eauei;t  2xrxopiydlptelfes sfarrr(r ;o0oltomociysls2elump;(4trxnmfcoatfmD lu o;t t2xoir3io4ap emnvilt aDumumpot4oetnmf3tlsfa ra(vo;(0 etrxr3oodfm   ivs ()trtoiopio1lpen ieta(faDtaxmpnt0teeo fciasfa2rm(ms;u0alenif oodopDe nvi s)s2tmxo3oy4openlictat)srrm( ono1teto fciatla2ulnms;u0 rtrio iy1fpDeai s;t0sexoxrpou1omt  fesasfa2rruro;u0tlt iieilsfm2ua(mp;t0tltrmf3oy1fpt luvsl(0trtrimpiodaptemfvi ( a2tm(rpou4olto ieiatlsDeln p;u4 exoxf iytlaDelu ils0setrxmpoudam e nvsas)srrm(  ;u4apt  f3iytfaDemnmo (4 lxoxf3tytfm   n s;t srtm(o3oodamenlfct (fs2um(rp;o0teeomietydfsDumnvonu4tleriociytoaD an i;t  exrirpiy1ap nlictl(farumu  ;o0tpeoif3iltfmDel(msnt0trxrxo iatlpte i ols)sexr(r nu4apt mfeias)s2urum nu4oeeniietas aDua(mont)tlenmf oydfmteaivslt) ruoxm nu4ope mnvia() Drrxrpno4olt ii3ildfm2uluvs (4texoxrctydfmtraueilt0s2xm(m3oudale livs sfs2umur oo0alenmo3iadlsDrlums;t4tltoxr3iodoaDe ieo t  2xoxr io4lpeelncsl() rrrx  ot4olto o3tyslsDuanvpnt4trenxr3oa1lpDeauvs;t0srtm(r oo4lp e neiat aDua(rp;t0olt micildfm2umumpnu)aetnxo3tatfp e ivo;(0 rtmio iy4oleelivtl(fs2umxmo;o1tle  fcildla2ean o;(0trtniociy1la e ivo;( seur(mpiy4op  lies ( arurur ou4oex io3iatlm2ulumo t4texoir3iodomDraieilt)setriopou1oltemfvia()aDuaxr ;u1aet iiciadfs ra(mo u4aetnxf tytfm  ai s s)t2ur(o iy1lle micslsf 2uau ont4opxo f3tysfsDelnvo;(4 lxoifciy1oaD  n o;()srtmxr3nodllt liei s  Drru poo0tex ioctltfaDuanmp;u0 rtrxf oatoaDran ils srum(mpou1amtnliei t) 2rm(r no0tltnifeildla raumo;t4artnifciytoate nvo t0 rxoio io1lmeelnctlsf ruaxro;o1aet if3iatfm2ul( p;t)texnio3oodoatelu ils0trtr(r nodlmtnmiet t  Dtmumo;o4tpe  o3ilt s2ul( o;u) rxrmo to1om r iesls)teuoir3nydom elivils  Dtm(rpou1olx miciltfs umn ont4alerxo ty1lp r nvil(0 etm(r iy4om e nei s arum( p;t4aeenifeiyd m rl(vs () ltnmr oodopDe uei;s0t2xm(r ny4alee fci ( a2uaum ;t4tex  fciaslsDeaums t)trxrifcoadfpDelneo (  2umxo no4ol e icia( s2rau p;o4opx mi3tysls2ul(mpnt4altrif3oatoa eanei s0 rxrio no4ol   nei t aDuaurpou1opeo fctatlm ulnvpnt)tetnmrcootfaDelueo s srtr(o3iydopt lncil(fsDrax poo4alx ifciad a em( pn(4arerxrcoytopDe uvi ( truo(o iu1omtnlnetatfs2tmxr nt1tpt mf3tadlmDelump (0 lxoxr3iadomteluvo s) 2xrxm3no4om   ncsat  2raur ot4opeomi3ilsfsDelnmonu0arxrmo3iydoa  lnvsl(0s2tr(r ou4lm elieta() 2ra(r ;t4aptnii3iysfa2elu s;t0trtniocoo1fpD lu i t  2xrxm3iy1altemnes s)artau o;o4oleo octatfm2rln p;u)teeomrcta1oa  li s;()texrxmpou4ameemieta()artmx  ;t4opeomictasfmDuluvo u)tltoxrcootoaDrau o;t0 rurim3oodapeemivi s)sDrr(roou1tltnmo3iysfaDeluvp t4tlerxfciatoaDeanvs s0 2tm(r oy4omt lnet ()a2tmu  nu1tetnmi3tas m uln on(0tltomo iadfm eli o s0 2urim3oy1lmtemncsas  rurx pot4oet  o3iyslsDemumonu4alxoxo iatlmDe n sl( srtrir ny4ap elnei s a2trxm ot0tex mf3tydls rmu s t4alxnmfctatfpt  nes;t) etrir oudole mfcil(faDum( o;o1ale io3iytls eaumsn(4aexoxo oadom rln s;t)trurxo3iu4al   ietas) Drax  ot1optoiieilslmDul(mpnt) eerxf3ta1fmt livo t) 2umio3oudlptn nctls)s2rrump;u4oltnmoetatlm eanmonu0 reoxf iodfmDelueo s0teum(o nodop elncsat)sDtaum ot0aeeo i3iatlsDumnmp u0aexnmrcoy1optraueols sruo(mpnu1lmeelicsat)s2tm(m nt0alxoioeiys s ulnms u4arxnxf3ty1fmt an ols setmxr3oudapt  neslsfaDtr(rp;t4oee moetatlm2umuvpn()aexrxr iodfa  lneolt)s2xmxmpnodameemicilsfaruaxmont1tltnif3iadfmDuaumpnt4 lxomfcoy1op  aiesl( teuoxrpou1am emivsatf Drru  oo1ape  oeiad s2eanmp;u4artnir3tadfpD  n i s s2trxm3nudlm e fci tf Drm(rp;u4optomfctysla um(ms;u0tltoxf3io1faDelivo;(0s2tmxrpoy1lp emneil(f Drr(m no0alxomo3iatlsDrln o u0tetnxf iotfate uvi s) eumxo3iudamtnlnvt (f Dtrx pou0tleomfciltfm2eanmp u4 eenirctadfmtr ies ()s2ur(r oo4ole lnvsat  Dur(r oo1tleomf3tyd m2ra( pnt4teenxf3oydfateanvi s0 eum(o3nydam  mfcils) rua(rpnu4alx ioeiadfmDrlnvp;u)artoxf3iytlmDe i il(0srtoio3oy4lptemiei s  2ur(mo;t0opxomfciasfmDelumpnu)altrxr3oodfpD ln sl(0 etm(mpiodlpe  nes ()arrmu  ou0oltnmf3ildfm2elnmont0 lxnmf iodfmtr ivo s0sexrxmpiu4lm nmfvs tfaDrm(m ou1opxn feildfm emu sn()artrmo iotoa  auei;s  rtrxo3oy4lpt  fes s  Dtmurpnt1tpt mfciad m2elnmo u)tetrioctytoaD anvsl()teum(m3io1apee fvtls a2taxmont0apx  fciasfsDea(vpnu)artoxr3oodlpDeaiei t s2uoimpnydlp  mnviat) rtrxmpnt0open i3iad a umnmo;u)tltrmf oytlmDr nvols) eur(o nu4opeelfvs s  Drmu  nt0tlx ifctld sDul(vsnt) exoxr3oytfpte nes;s) etr(m3iodlpte fvi t  rrru pot4ale  ociytfa rmnmp;(4tleoxfcootop  ai o;t0s2xr(m iydlltnlfesas sDrmu o;t1ope mi3tls aDemnmpn(4 ltoir3tytoa   nvsl()t2um(o iy4aptnmfvia(  Dtm( o;t1apto f3ild m2rau p;(4altrmrcoatlptr nes ()teurxmpoodlpenlnvtl()sDtrumpnu0olxoifcildls2ea( s;u0 ltnxocoytopte ieo ()s2xm(r3no1alt lieilsf rrmu  nu4aptnmoeiadfs rlump;()tltrio3iodfmDranei;s)srum(r nu4ap nmiesat)arrr(mooo4texnif3tydlm ua(mo;u0 lxoif ootfpDeau s (0 2umim3io1lltemfcia(fs2tr(rp;t0alxnmi3tytfa ea(msnu)aetnxocty1latranvil( t2tm(r3ou1lptnmfviat aDtrx ono0aleomfciydfs2elnmpn(0trtoio3iy1lmtr ivo;() rxr(mpoo1lme lfet (faDtm( pou0apeo ieiys s2raumo;u4trtoxo3tytlmtelivsl(0 rxrim3ou4omenlncsl(f rtrur ou0oltomfeildfm uln pnu4artoio iatomDeaieols0 eur(mpoy1lmee fvsl( aruax  nt4aptoii3iltla2rmu p u4tlenifctytomteaivo;t)t2xrir no1apte fvi s  rtrxmpot4apxn octydfs umnmp u4altriocoy1omt lnvo s)texmxopoy1oleemfvias)arraxm nu1tlxomictlslsDrluvp t4aetoxo3iotfpt  u i s teum(mpny1llte fes sfsrurx  nt0tlen f3iasla2emumpnt0 eenxo iotfp r i o t0t2um(o nodolen nctasfs2rau pou1tptoii3tad s2eauvo (4trxoxoctytfptrliei;s)s2tr(opnydalenlfcsls sDurum ;t4ape if3ildfaDran o;u)texniociydla   nvi ( trumir3ou1amtnmfvilt)a2rmxr ot4apxnio3tasfa2ul(vs () ltoxocoytlaDe i i;t0sexr(m3iy4om  mfet s a2tr(mpot1ape ifeiad sDrlumo;t4aetnirctytopt anvol(0t2xr(r3iudaltn ivsa(f Dua(mp;u0oltn ociad mDel(mp;(4aetoircio1fa r u sl(0teuoio ou4lptnlnciat)a2rmumpou1tpxnmf3iad mDum(monu4 leomrcto1lpt luvols setr(m3io1oltn icsl( aDtrxrpno4aetn feilsfmDemuvon()texoxf oa1fpt au il( tetmxr nodlmtnmfetlt aDtax  nu0aleo oeilsla2ea(mpnu) exnxr tydfmtrau o;s0t2xo(opny4ap emfcs t a2rrur ;u1apxoioeiydls2uanvp;t0 lxnxr oodom elnes;s)srxo(opnu1lpee icsasf 2tmxr ;t0aexomociat aDea( sn(4tetoioctodopt  ivo;t)sexoxrpio1ap  lnvta(fsDraumpno4alt  o3iysla2em(mo;(0 eenir3iy1fm elnvs t0tetrxopou1lmeelfvsat) rrax  oo1aetnii3iyt m ea( o;u0 rxrmfctydoa raiei t0t2tmir3iy1lm  mfvi () rrr(mono1tpxniiciyd m eanvo (4altoxocoo1omt  ieo;s)setm(r3nudop emnetatfsrrrx pno4oeeoiociasls2ulnvo;t0treoxr oadfa raivs;() rurim iy1olt mfvi s)a2tru ont4tee ifetytlsDrm(vp t)trerxrcta1laD ln sls0 2umim no1llenmncsasf rtaxr nt1tlt iiciltls eauvsnt0trxnmo oodlaDeaivi;t)t2trxo3ny1lp e neilt) rra(r ;u0oexnmfctasfa uanvon(0arenxr totfmtraneilt0srumxrpno1optn ietatf rtaum nu1altnio3iltfm uluvo;t)tltoirciatfp elu s;t) eurxm oudomeemnes tfaDtaxrpoo0olxnmf3ilsfa2rlu sn() lermo3iytlm rliei;s)trto(r3oydll nlnet ()s2tr(r no1oleniociytfa ranvs (4aexrxf ty1lpte ieols0 etm(m iydal  mnvsltfaDrrumont0oetniieiyt sDeln s t4 eermo3totomtraueilt  2uoxmpiodlpeelnctltf rtm(m ;u4aleo i3iysfa2ra(vs;t0aeeriocoadomD liei ()setm(rpnydlm emfes s  2tmurp;t4alto ieiltlsDrlumpnt0 rxnmr oydfat livs () rxm(o3ou4lm e ivilt sDumx  oo0opeoif3tldfaDelu s (4aexnif3iadopDrlnes t) etmir nodap emnvil(  Dra(m ;u4aetnmi3iysfs ran o;t0 lxrircio1fat aneo;t)s2trxr3no1omeemics (  Drm(ro;u4ole  i3tldfa2rlumo t4 lermocta1lmt lues;t0trxm(o3no1lpeelivi tfsruaxrp;u0apen f3ildfm2rl(vs u4aexoxf todoaD lnei;t truo(r nu4omt licsatfa2ur(mpnt0oexnioeiatlmDrl( p t)tetrmocoadomtr ivi ()t2uoimpoo1ameemnetlt aDtr(mpnt1olt  ietyd aDumuvo ()alenmocty1omDeanvs (0srtoir oy4lmeemnvt tfarta(m ;u0tlto ietadlmDul(vo;(4areoxo oodfa   i sls  etoxm3ny4lpe  nctltfaDum(r nu4aptoif3tyslaDranmo;u4artnif3oo1oat aivo;t0 etmimpoo4ap nmnvsas)aDtaxr nt4tpto fciyt s umnms;t4arxrio tadom r iei;s seurim ou4ap  lfetlt  rtmurp;t0optnmoeiat m rm( pnt4arxnxr3iytfm  lnvol()teur(m nydop nmfvia(fs2rm(  ;t4tlx  fctad mDrmnvpnt0 ltnxf tadoa eai ols  2urio ny1am elfvias) rra(  ;t0aeeoiociltls rmnvpnu)arerio oatlpDr n i () etmxmpou4ome lfetas) rtmxrono4alx  ieiadla2ra(mont4 lxrxo3oadlate uvo;(0 2xrxopny1omtnlivslt)aDur(mo;t0oltn f3iasfaDrmu snu4trxnirciatfmteln o (0 2urim3io1op e fcta()a2rm(ro;u4tptoioeiad mDra( s;u0arxnxfciodom  auvs;() exr(o iu4opee ncils a2um(r nt1ale iietaslsDemnvsnu) rxrxfciatoaDrlueo s s2xoxo oo1lmenlncsas)a2tr(  nu4alx mociyslsDulnvsnt0 rermf ty1lpDraueslt0seuo(r oydlmtemfvt (fs2taurpot0teeomf3tadlm emnmsn(4trxnmr ootfm eanvilt0tetr(o3io4ll elnciat  rtaxmp;t1alxn i3iyt aDrmn pn(0trenmocoodfp elu i;t0sexrim3io4ll  lfesls  Dra(ro;u1tpxomfciytfa2elnmo (0 etnmfciydlpte ivs t0t2uoxo3oy1lmt  ieiasfarrmxrooo1oeto oeiat aDrauvs;u4 rtomo3oo1latrai s;(0sexoir iy1lp nmncsas  rta(rp;o4tlxnif3iatlaDemnmp;(4trxoxrciatlptran sl( setmim3nudal   ietatfa2ur(r no1aex  o3iytfs emnms;u4 eenirciydla e iei;t)setrim3ou1apee ivt ( a2rrxrpnu1tetomfcild sDeln p u4 lenmfcoy1oaDr u olt)tetmio nudlp eliet (f Dua(m nt0opeomi3iydfa2rmumo;t) rxnxr io1lmDe ies;t) 2xo(rpoodape lnei ()a2tmuro;t1opt mo3iydfa2uau p u4trtoir3ty1lm rlivol(  exmxr nodlmt  ncia(  Duax pno1texoiieiasfa2elnvon()tleoxfcia1om ranvo t0s2tmirpiu1lm emieilsfsDra(  ou1oexo o3iadfa eanvs t0arenmrcoytom rauvo;t seurirpiu1ap e fvt (f 2umx  ;o4aexn ociad m rmu o;t4 ltomo tadlaDelneil() exoimpny1llee icsl(f 2trx o;u4opxnmfctydfa2ul(vo;t4trermrctadlate i sl()s2tmxm no4ape  nesls)sDtrx pnt1olx  ocils s ea(vo t4aetomrciadoaDr uvs;t0teuoirpoudol n nviltfsDra(  nu0aexomfetydla2uauvo t4aexrxo oo1laD aivs s) 2trio iudop eliet t s2trxmp;u0tetnmf3iydlm uan p t)texnxo tadfa raivol() etoiopoo1om  mnvs (fa2ur(r nu0oee mf3iysfaDum(vont4trxoxocia1opDrai s;(0teurxrpou1apt mneslt srua(r ;t0alt mfciydfsDemnvs;(0 eerio iotoa elu s;t  2ur(m3nu1om nmnvilsfarrmu  ;u4ole moctatla2rmnvp;t)arxoiocia1oa eln ilt) etmxo3nodoltnmieils)s2rmumo;u0aex io3tysla umu pnu)aexrmrctytlpDrlu o;t0 eumio oo4ll emicslsf rrrumoou1ole ii3tat m eau pnt0aleoio oy1oatrlivi;t) rum(o3oodllte fcilt sDtr( pou0teenifciadfaDrauvo u0artrio3iotoptr ivi s)t2xrxm nu1lmtemncsas)aDrru o;t0opeomo3iyslm el(vpn(4texrio oatlptr uei s setoxr3nu1aleelnvtas)sDrmxrpoo4opeomieils sDrluvs;t)arenio iytfaDelnvi;()srumio iu4ol n feta()arraxmoot0apx micilsfa el(von(0 lxrio ty1omDrau il(0s2trir iu1op elicsas)aDururpou1alto ieiyd s umuvo u)aetnxocoatlateli o;s0setmxmpnodoptnlicsl(  rrrxrono4oetoif3ildfs2um(mo t)altnxf iy1lptr uvilt) 2xr(mpiu1alt mfviatfa2trurpnu0aet  f3tldlm2rl(vs (4alermocio1late n o;s) rto(rpno1lp   fcs sfa2um(mp;t1texnioeiltfaDean p;(0alenmfctytop  aivsl( trtrxrpnodom emicsls a2ta(mp;o1tpe  f3ildls2em(vo;t)aeerio3oa1oat lu i s) eumxrpiy4apt mfetlt srtaxmp;t4altn o3ilt sDrmumsnt) eerxo ty1omteai o;s0 ruoxmpiudam emnvsl()sDtaxrono4oet  i3iydfa2umu o t0 eenio3oo1fptelnvs;s0s2xoxo3io4ape  nctltfa2rm( onu0oex ifetlt aDel(vonu4alxoxo tydlm r ieo (0srurxm oo4lm nlfcta(fsrtrumono4tpe iocildlm2umu p;u)artrxrctadomDraneols t2uoiopio4omtnlfvs (fsrtm(mpnu0tle  i3tadlaDran snu4arxnxf3oytop r i sl()sexoxo oudal nmncs s) rurxr ;u4tee if3iydla2rlump;u4aeenmf3tytomDr n ol()texrxrpiy1lptnlfeias  Dur(ro;o1tetn ieilsls2rl(vo u4aetrxo3tatlpteaueol(0 exmxr3iodlm n nct ( aDrrxr no0texnmoeilsls elu sn()tetrxr iydoaDrauei s)t2xmxm ou4ap emfcsa()a2rmxr nt4oetniictasfm2rluvpn(0tltnmf3iatomD  uvo;()srxmirpoo4ame mfvta() Drrxr ou1oexnmietasla2rmu o;t0aexoio ty1omDeaueo t)t2um(r ou1al  mivsl(fartauronu0texn oeiyt aDel(vp t4alxrir3iydop rlnvsl(  rto(rpio4llt lnctas srrmur oo1apt  ociysfa2eanvs;u0trtnxo3to1lm   i il( s2xoir io4ap elivi ()artmx 
\ No newline at end of file
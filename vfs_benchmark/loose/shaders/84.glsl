@@ -0,0 +1 @@
+nes;t)s2trxm3oo1lpeemfei t)a2um(m ;t4alt  fciadlsDuaumo;t0trxnmr oadlpte n s;s)s2uoio3nodal  mncsat)a2urx poo1optnmiciltls umnmont4tetnxocia1faD ln s;s)s2ur(rpny1ape mivs s) 2tm(ro;u0tpe  oeildfmDum( snt0tltrircoytlaDelieil()t2trxr3oy1oleelnvil(  Duaum nu4oleomieiytlaDra(ms;t0trxrmr oatla ean ils)s2urir3no4lltn nvtlt)s2tm(mpno0opxoii3iat a2umuvs u0 lermr3iodomt li sls0 etmxopiu1optn ivias arrmxm ;t4apxoii3tysfm2umump t4trerxo3oo1lpteau sl()t2tr(r3oy4op elfesa( arur(m ;t1tetnif3ilt s2ra( o ()trxoxrcoadfmDeai i;t0 2tmxopou1alt mncsas)s2raxront4apeo o3iasfa rmuvp t0aexrifctytomtrln ilt0s2to(rpno4altelfeias)srurumo;o0opxo i3iyd aDumuvp;(4 etrxocty1fmtr ivil( srxoim oodlm e fctlt srtmumpot1aet iiciatfsDumnmp t)tltoif3io1fp rlieo ( srxoirpiy4optemncsatfsrtr(  ou0tpto ictyt aDeanmpnt)alermfcty1opt  i o s) etrxr nu4optemnvtasfsDra(ront1openiieiat s rlump;u)trtnmf3ia1fa elieo ()setm(mpio4om emneta( sDtrurpnu1oet mictytfs2eaums;(0teeoxo3ootla  ai i t)trxr(m3io4lmtemfetasf Dtru o;t4alx if3ild a2em(vpn() rtnxo3totfmteliei s)srxoxo3iy1al nmicil( aDurur ;u0alt mfeiytls rm(mo t0trxomr3iodlpteai s;( trur(m3ou4opt  netatfaDtax  nu1tlxnmociadlsDranmp u)trtnmf3ia1oa r uvi;s0 ruo(rpiu1lmen fcsa(  Dur(rpno1tpe iictldlm2umu s;(0artoxrcootlp r n i t0 2toxrpio4lle  nvsls a2taum ;u0oex  f3tltfm2ea(vpnt0 reriocio1om e nes;(0seuo(m io1lme mnvs () Dtrxr nu0openmfeiydfa2ua(vs;()aexrmf3io1lm  an il(  rtrirpnydamteliciltfa2ururoot0tpeo feiadfa2rln sn(0alxrir ta1fptelneo (0t2urio3nodomee fvil( aDtrxmo;t1opxnii3iysla rm(von(0texoio iy1optrai i s seur(r3io4op  lfvtl(fsruau o;o0optnmieiasfs ea(mo;u0 rtnxf3iotfptr uvs t)sexoirpno1aptelfcil(faDra(mp;t1olxoiieiasls2elnvon(0aexnmr3oodoatrln o (  2urio ny4opt  nvsa(fa2rmu  ou4oex  oeiyslaDrlu on(4 ltoxf iadfp  aneo;s)seuoxo3iu1llen ies () Dtau pnt4openii3tltlsDemn on() exnio iy1faDelneo;s texoir3oodlpenlfvs s srtrurpnt0altnifctatfm uln o;(4 reoxocty1lpte uei;s)tetmiopnydlpenmici tfa2taurpou0olxn oetydlaDeauvsnt0 rxoxr tytfmDe iei;t0 2xmxr ny4aleemnvsatfartmuro;t0opxomf3tltfs2elump ()alxoxrciydla  ln o;t) 2trim3nodll   fvsa()s2rax onu1oetnmf3iltfaDra(msnu0tltniociadop   neil() 2um(m3oudam nmnei s a2rrx pnu4aexnio3tatlm em(msnt0tleomfcoatlaDean i s0 exrxo3nu4alee ivsas  Dtmur oo0alxomo3tasfa2uln ont)trxoif3tadlmDelues s0 2xmxr oo4llt mnvslt)s2rmxmoou4oexnmfctys sDel( p u4alenxr ootfaD luvo () 2um(r3oy4lm nmfet ( srtaxmont4optniiciydfa2ulu p;t4aeenxo tatfm  li slt0s2xmio io1olte iei ()sDrmurp;t0aptoif3iltfa2ul( o u0 etrmo totlaDrlueols)s2xo(r iu4ame mfvtl() rum(moou0aee mi3ils a eluvsnt0 renmr iatfmDelueo t0 2xoimpny1altn ivs (f rtr(  ot4tpxn ictydfsDemuvp;(0alxoxr tytlmteaues;s) 2ur(m3oydop elnei t)artmumpot4tleoifetyt s elumo;t)tlenmrciadfmDe i ilt setrxm oy1lm nlictas s2tau pou4opt  ietasfsDrm(ms u) ltnircoy1opt anei;()sexrir3iy4ol   fvtasf Dur(  ;t1ape  feilsfmDel(ms;u0aeermrcoodlaDraivi s) rxo(opou4lpen nes (  2raxrooo1aeenmf3iysfmDulnmon(0 leoxocoo1laDeaivs;( srto(mpiy1lpe  fvilsfsDtm(mono4ale  oeiatfaDelu o u)alxoxfcoatla rln i t seuoxrpoo4ol elietlsfaDuau p;t4aetn ocildls2rm(vsn(4 eerxr3oatlm ean o s)t2xoxo iodap n ietasf 2rrxmont1teeo f3iyt m eau o (4 exnmrcty1omDe neo ()teuoio3oo1op emivta( sDua(  ;u4olx  i3tadfa umu o;() ltnir ta1lmDe n i ( setmirpiudaltnmnci t  Dtrxrooo1oeto f3iyt aDelnmp;t)aexoiociadop eai i s  exriopiy1lpeelnei sf Dtr(r oo4opx ioetytfs2ranmpnu0arxoxf3io1fpD an olt) 2tmir iu1opee fcsl( s2tmurpot1oeeoiieiadfm2uanvonu) ltrxo iydfmtraivi t0trxoxm oo1am  mnct tfarurum oo0tpe  o3iatfsDrm( o t) rxrircty1lm   n olt) 2xmio3ou1apeemnvs s aDurum ot4aptnif3iytfm rlu s;(0arxrif3io1latr u ols  ruriopio1al e ictat)s2umxmpou0olx micilsfmDuau on() lxomrcty1fptrauvilt)t2toir3iu1lleemiesa(fa2uaxr ;o1tpeo ocilslm em(vonu0aexrxr3oa1opD  i s;s srxoir3ny4lpt lnei sfartm(moot0ape io3iyt a ul(vpnu0tlxoio tydfaDrlneo;s) rtoim3iudole mfvi tf 2trxmo;o1tpxn o3iatfs uln o (0teeoir iy1fptrauvs;t0s2xrir3no1lp e iesl(fa2taur ;o0aetn ictlsls2uln sn(0aetrxf3tytfmte ieils)trxoxopnodlp e fesa() Duaxroou0tpe moetasfaDua(vonu) lxrmfcty1op   n ols teurxo oy1lle lnvs s)s2urxroot4oee  ictld aDrmn s t) rerio iy1fmt aivo t0srum(rpio1opt  fciltf rtaur ;u4oeto feiyslm2ea( s u0 rerxo3iotlm eluvilt)tetrxm oy1amee nviat aDtm( poo1apto ieild m2rlu o;t4 rxomo ia1lmD aies;s  etmimpnudllee ivsa()aDtaxm ;o4tleo fetltla2emnvsn(0aetoxf oatfat auvs s  ruoiopoo1alenlncils arraxm ;o1tle  icilsls ulnvp u4 ltoir3ty1omteauvs;t)setmxo3ou4lp  mncs (  rtru o;u0tlen o3iyd mDel( pnt4aleoxf3iydlmD  nvol() 2tm(r3oudope mfeiat) 2taxmp;u4oex mo3ilslsDean s u)aexnxo3oy1lm e n o t trurxrpnu1lptnmfvi sf rrrxrpou1aeenmfcias a2ranmon(4tlenmo oytlpDrlnvs s t2tmxo3iudop   ivslt)a2taxro;t4tpeomo3tydla eanmpnu4tltnmo3iydlp elnvi;s  euo(m oo4omtnmics t)s2tmur no1apxnmociyslm2uanms;(0alxrxrcto1omtrlieolt  exr(m ny1lpenlncsl(  2um(rpoo4opxo ocilsfsDrmnvs t4 rermf3iydlp   ues s) exmim ny4opt  fcil()a2tm(monu0tleo ociasla2rlumpn(4aeerxf3oa1oaDe i i t)setm(m3oo1lpt  netas srtau p;t1opxn ociadfa ulu p u) lxrifcoatlatr nvil()setmimpnu1ap n ivtat sDua(  ;u1alxo ictytls em( pnt)tetoxr tadomt  uvsl( seum(mpio4llt micsls) 2raxr nu1oetomf3iytfm uluvs;t)texriocoatfat  uvi s  etr(o3nydome lies t)srrm(rp;o1opt moeiys aDrmuvon(4arxrxrcty1lm rlneo (0 ruo(r3ou1apen fviat) rtmxmpou1tpxnmfeiydlm uln o;()teenio oo1fa eaivs t0trxrxopiudap elncsa(  2uaumo;u0optomi3ilsla uau sn(0 lerxo3ootomt aneils  etoxmpiu4lmt  nci t sDtr( pnu1tpt  ictat m rlu pnu0arenio3tatlmtrau ils0trxr(r3iydomeemncsas  2ra(r nu0apt mi3iadla ra(vp;(4 exrxr3oadlp eaneo;t0texr(m no1oltelfes ( srrm(monu4tlx ifciatfa2eln p;t0tlenxociadlp elueol(0 eum(r nu4omtelfes (fa2tr(ront4tpeoifeilsla2ra( on()aexnmfctydla e ueil(0 2umim3iodlpee feia(  2umur ;o0aeto i3tltfaDeau o (4 rxrio ty1faDe ueol()seuo(m3io1ameelneilsfsrumu o;o4oeeoioetydfs2ean s;t) etrmrcta1oateaueols0trumir iy4lmtnmfcslt  rumuro;o4tlt if3iaslsDemuvpn(0tlerifcta1fate ivils)t2uoio3oo4op  lfesat)srtrxro;u1aptn o3tlslm2rln s ()aetrioctodlateaiei s) etriopiudape lnct s) rraum ;u1apxomoeiydlmDrmu o;(4artrirciodoptrlnes;() exr(mpiudllenlncta( sDurum ;o1tle io3iydls ulump (4tltomocoadlm e ieol( seumxopio1omte ivs s)srtru poo4aleomiciat sDeanmo () exrif tytlaD  uvils sexrir ny4lptn net ()s2rmur ;u1aeto oeiysls2ea(ms u)arxoif iy1faDeln s (0srurir3iudole lnci ( sDraurpnt4tle  ociatfa2rlnms;t4altnifciodfmt  nes;t) 2urxopiydoptnmicias)arumum ;u1opt  ieiad sDeln sn(4tltnmr iydlpDe nes;(0s2uo(rpou1olen nvslt)srurum ot1tlxnifcils s ua(vo;u0aeermo todop  luvo ( teumxo3oy4altnlnei t)artrum oo0apx iociltfm elumo;u)aetnir3tydlaDrlues s0t2umxm nydll  mfesasfsrum( poo4tpxomoctad a elnmo;u0artnmocia1omDrli i;s0 exr(opiu1ame  icias)sDtax pou4oleo fetys a ua(vpn(4tlxnxr iadlm   nvslt) rurxo3io1alenlfvsa(f Draxrpno0oeeniicild s2um(vs;t4aleoio3iodfp  anvi s) rtm(o3oydlpen feil(fa2trum ;o4aeeniictysfm2emnvp t0 lxnifciydfpD aneilt)s2tmxmpnu1llt lnvilsfs2trumpnt1olt ii3iasla2ulu s;u0aleoxr3todfpD an o s)setm(rpiu1opee ici t aDumxmp;o1opxoifcias aDum( s (4 rerircta1fa  lneo t)srtm(o3nu1lpt  fcs s) 2urxr ot4ale iocild m emumonu) eenmo3to1omDrauvi t  2xmir nudamenlfesatf rtmx pno4tee  o3tytfaDra( o;t4alxrxfctydlpD  neo;t) eur(m nu4ap   ivtat)srurxr ou0oeeomfeiad s2rmn s (4tltrxo3io1lmtean olt seurxm3nudam nmfeil(f 2tm( p;t1tpxnifeiltlmDemuvs (0tetnir tytoptrlnvs;s s2umir3iu4omenmnvs s arua(r nt0altn oeiys sDum( p t) ltnxr3oodfatr ivi s0t2xmxrpiu1omeelivi tfsrta( pou1oetnif3iaslm rluvpnt) etrmrctytlaDeli s;(0 eur(r nudal e ncils  rururoot0aeeo oetytlmDea(vonu4 exnmf3oy1laDrlneols0 etrxo ou1ope mivsa( a2raxmonu1oetomo3tlslm2umn p t0aetrmo3iytfat ai o;(0trxm(opiu4open ici ( aDtmuront1oeen f3ias m emuvp;t0tlerio3ootfa eln sls s2uriopoudam n ivs s srtr(mo;u1tpt if3iat s ea(mont)alermr ootom raues s0seumxrpoodop nmfesl(f rumxrpou1apt ioeiys aDul( o;t0 lxrio iytfat lueo;s)trxoiopiydll emivs t a2rrxmono0oleo o3iyt s2ra( p t0altniocootlm raiei t)s2um(o oudll nmictls  2taxm ot1texnmf3iyt a2rlu p ()aetrir oatfpDe uvi s0trxr(m no1omeemics (  2rr(r nu1oeeoifeiyd a2rauvon()altrxr3iatoptrluvi;s0seur(m oydamtnlnes sfaDrr(rooo0apt mi3ils a2ra(vp u) lxnmr3oatlmDrlneo;t0t2xoimpiu4ol  mivt t aDtrxmooo0opxn ietysla emu s;u4texnxr oytopt au ils) 2trxmpiu4amenlivtlt sDtrxrpot1olxnmo3iys m2uanvp t0 eermr3iotfa r uvsls0tetrio3nu1aptelfvsl()arrmxr ;u1tle miciaslm umnmo;u0 etoif3tatopDeau i s s2ur(o iu1lmeemfcsl( srum(m ;t4texnmo3ild m elnvonu0 leoxo3iadoptrluei () rxrio ou1olt lnetlt)sDtr(mono1ale  icilslsDum(mo;t0tetoxfcio1fm  lieol( srxrir3oy4ome mivs s)aDur(mo;o4aptn f3ild s uanvs t4alerxr3oo1faD ln i;(0setoir3oy4omeemicta()sDrau ont0tlt iiciaslaDeln p u4aeeoio3iytop rau sl(  2to(r3nudlpenlivta(fsDtr(  ;o4olt io3iysfm emnmo;u) rxrxrctotop rlivi;( trurirpny4oleemivtas)a2uax p;u0apxniieiydls um( p (0 exoxocoa1oa e ivsls0trtm(r3nu1ome lnetlsf 2tm(mpou4optnii3iadlsDrlums;u4tlxrxrciydlptelnes t teumir nodom  liesasfsDrrxmont0alenmo3tadlmDeau ont0artoxo tydlmDr nvs t0s2umxr3oodlmt mfcils sDraxm no0tet mociasfs rm(mp t4artoirciydfa elu o t  exoir iudoltn ncs t s2tm(r oo1tpxoii3iysfaDua(vpnt0treoxociydomt au o ()sexo(opnu1ame lieiat sDtr(m ;t4tlxoii3iys aDranvs;t0texoio tytla r u slt0 eurir nodopeelfct tf Drm(mp;t0tlenifciltfm2ra(mo u4tlxoxr iadfp ean s ( srumio3nudlpeelictl( s2ua( ooo0oetomocilsfsDrmumo t0alxrir3ia1lpDrluvo;t trur(r io4am n nvsat) Drmurpnt1alx ifciatla2ean s t0teerxrcta1oaD auei ()seto(opnydamenmfvta()aDtmurpnt1ale  iciltlsDulnmp;u)arenxo tatlaD anvil() 2uoim nu4ap e ncsl() 2raxroot4ale iicilsla umu p;t4 etnxf3oytfat  uesls  etr(m io1lp nmfciatfsrur(  ;t1alxn fetydfa elnms u)texnifcoo1laDelueil( s2xoxopnodlmenmici s aDrrxr ot1oetomfetadfm ea(vo t0teerxocoytlm r i i t0t2urxo oudomtelnvtl( a2tmxrpoo4oexn fciadfm2umnmp u)alenio3ia1lat auvo;s t2xoio3iydll  lnvils aruaurpnu0oeeo oetld m rau pnt4 ltniocoa1faDe nvs s)sexoim no1openlfvtlt)artm(monu0tpxnio3iytls ra( s;u0 exoiocty1fa eliei (0trxmxr3oy1ol nmncs (f Drr(mo;o0tetoiociydlaDemnmo;t4 etnxo3ia1lp ean o;(0 rxo(o iu1opeemnctat) ruru p;u4tetn octyd a2em(mon()aetnmf oa1faDelu i;t0s2xm(m oo4opt  fcils) 2raump;t4aeenmfciad aDulu ont4trxoxociy1omte uvols)srxo(mpny1omee iciatf rtaxro;t0oetomociltls rm(vont0artrxf3to1fpte ivi s  2urxr ou4olte nci s)a2tau o;u1tlx if3tltlmDrl(vs t4texnmo3tadfm eluei;s0 exo(r3ny4apt lfetlt)srrr(rooo1altoii3ias sDeaums;u)alermo ty1lmtrlieol()teuo(r3iu1llt mfvtas)s2trxm ;u0opto o3iad mDrl(vp;u0trenircta1fatranes t) eur(m oy4ome lneiasf Dtaumo;t1alxomfeiadla2eauvp;t0alxriociydlpteaieol(  etmir3nu4op elfvta(fsrtrurono0altoiociadlmDrl( p;(4tlxomf iadfpD lneo;s)trxr(opiu4lme mici ()arta(ro;t1tee ioeiaslm ra(vp;u4alxoio3ta1optrlnesls teuoim io4omtn fvilt)aDtm(mp;u1optnmf3tys m2uauvsnt) rtriociodla r i o;s s2toxo iu1ol   neilt s2tax pno0oeeoifciyt m2eaumsnt)tetrmf to1fmD  uei;t0 rtm(r no4ap  lnesls)s2taumpot1teen ietad s2rau snt0 ltoif3ta1la e ivo;s0trtoiopiudalt mnvs s)srurx  ou0oetomoeils a2ua(vp;t) lxoxoctodfm r ieols)texm(r3io1optemfei t)arrmx pot0oetomfcilslaDrmn s;()altrxo tydla eluvils0s2urio3oy4aptnlnes s)sruax o;o1tle mictld m ea(mp u0tltoif tatlp eli s t0 2tmiopnu4llen iei s)aDum(  no4oexn fcilsls uauvp;u0treoxr tydop rlnesls)srto(o nodam  mivsas a2ra(mo;t4teen ociydlmDua( on(4 rxnmo3oydoaD livols)trumxr3nu1ol emneilsfa2ururo;o4apxnmf3tltla umumo t) lenxr iodfmDeaues s0 2tmxm oo4omt  nvils arur( o;t4alenmoeildfa em( snt)arxnio iotla eauei (0srtoir3io1oltn nvil() ruax  oo1aeeniociyd m emump;(0aeeoir iytfmtelivsls)sexrxm oodol  lnes t)srrm(rono0aex moeiasls2um( on()texomr totfpDr u sl(0 rxmiopiydlmt mnes tfsDumurp;o1apenmi3tytfm2uanvp;u0 rtrxf io1lmD  nvi s s2xmxm iodllenmneslsfsrtaxr ;o0oex  fciysla2um( o;t4arenxr3iydfpt  u s;t0srtoirpoydlp elnci (fsDta( onu0tltoio3taslm emn sn(4teenmfcta1oaDr i o;t) rtm(m nodap elneia(  Draxront1tpe  f3ilsfa2emumpn() lxrio3oo1opDe n i;t) 2uoxr3iy1op e ivtls aDum(mp;u0olxo oeiydlsDelumont4 leoif3todfpt lies (0trtoiopoy1optelfvia()s2uaump;o4oex  oeildlmDea(vo;()altoxf iy1fa  lueilt s2xoir3ny4llen fetl()aDrrx p;u1tlx mieiadfmDuanmo;t4altoifctydoatranes;t texm(r iu4lmte fct t srraxmp;t4aptn ociytfa rmumpnt) rtrmr tadoate u o t0 euo(r3ou1ol   nctls sruaxmp;u1tpeoio3tldfa um(vo;(4 ltnio3totlatrli ilt0texriopiudolen fes s srrrurono0tpxomieildfm rmnvp;t4 eenir3ty1fm eln i;s  rumxrpoudlpt lfvs s srra(mpou1apenmf3tysfaDel( s (0alxnmfctodoa r nes ( t2xoio3iudop emnviasf 2ta(rp;o0tle  oetyt s emuvsn(0trxoio iatfm elnesl() rxm(o iu4olenmicsa(  2raxmpnt0aee mociytfa2em(vp;(4teeomo3oodopD ai o s  2urio no1llenlfviltfarur(mont0tlen ociat a el(vpnt4 lenmf3oydom  lies t teum(m ou4ll elnvsat srrm(ront4tlt ioeias a uaums;u)arxnir3oa1fpt anesls0trumxm ou4lptemfesl(fsDtrxrp;u1apxo i3iasfaDeanmp (0 etrxr3ootlaDeai slt0 etm(mpno1lme  fet s) Dta(moot0aeen octas m2ul(vp;t4arerir3ty1omteaivo t)trxmirpiodole  icils)s2rr( onu4alxoif3iytfs rm(mpnu4alerxocia1la  anvo;(0setmxm oodamee ietltf 2raxroot0tlxn fciad a2umumo t)tlerioctydlpDrauei;t trxr(o3iy1om  lncta( arta( p;o0aeeniiciatfmDem(mo ()arenxf3tydla rlu sl()trtmim3iydaltnmfet sf rrrumooo4apx  octasls rln s;t0trtnmf ootoaD an i s) rur(mpno1ope  fvi tf rraurono0alen ociydfs2um(msn() rtnmfcoa1op  lnei;s  eto(o oo1ape  fctl( srtr(r ;u0tpenmf3iatfm um(vo t0 renmo ty1fmt ln s s0s2toxr3nu4olenlivi (  rrmuront0opx mociydls umuvo t4 rerxr totfatr n o s trtm(r ny1aptelies s)srur(m ;t1tleomf3tatla2em( s t4aeeomo iodfpD  i s s t2umxopoy4optnmiciat  2ta( ont1oex ii3iyd m ulnvp;t)aexrio3to1fat aneil(0setoimpny1lm e ics (f 2ur(ro;t4tlxn f3tasfm2um( snt4tlerir todfp  luvs;t)trtmir oydal nlfvslt) Dta(r oo4tptoifciys s uaums (4aeenxociytfm   ies s0srtmxr3ou4ome  ncil()aDra(r nt4open feiydfmDeauvp;t4teerir3tatfatr n s ()srtr(mpoo1aptelnvtls aDtaumo;u1olx mf3iytfa2eau o;()altoxo iotoaDe ivslt srur(r nu4optemnvt t) Dtruro;u1oetomo3iasfs2uanmp t0texrir totomte u o (  2tm(o3ou4altelnetlsf 2uaum ;u4oetnmfetlsfm rlumpnt4altrmociydfaD  ueolt)setoxo3iudaltemieslsf Drmx poo4alt iiciydfm2eaumsnu0 lenxr oo1fmteanei t  2toir io4ope mnvsl( a2urumoou1tex mociyd s2elumo t0aexrmf iotoaDr ivi ( teurim oudlleelfeilsf 2rrxrp;u0texo i3ild s um(vs;u4aeenxo iytlmDe nvi () rumxo ny4lm  micsa()a2rru  no4tpxomiciysls2uanvo;t)texoiocta1lmD lnes t  rurxrpio4om elfviltfs2urxmp;o1tpxn iciatfs ulnms t4 lxnircoy1fpDe nes;t)sexrxrpnu4lpt lfvil()sDtmurp;t1openmfeilslm2rluvp (4 etoxrciatoaD lu o;t0t2umio io4aptemieil()s2ur(m nt4apt iiciadls2eau o;t0teenxf ootoaD lnvs s0seuoxo3iy4lm nmietlt s2umxr ou0tlxnifetlt a ua(vsnu4alenxr3oadoa   iesl(0 2trir nudoltnlfvs t sDua(root1tle  ieiltfmDel(vs;(0areoxr3oo1lmtr ivsls)s2toxrpoudapen ncs (farrr(mpoo1olto o3iltla umuvs;u)aetrmo iytoaDr nes;s0seuoxr3nydlptelfvsl() rumuronu1alxnmfetyt a2um(vs;t0 reomr3oodlate nes;(0t2trxo ou1ap  mfvtas)s2raumonu0teeo f3iltfmDrln snt4tltnmo3ootlm rlivo t t2trio oy1ape lieilt s2umum nt1altoio3ils a2ua(vp u4 renir3oodoa  au o s)t2uoiopnodap  licils) 2urxro;u4oex  o3tltlm um( snu0 rtrir ootoptrln o t srtriopio1ol   ncils a2rmump;o0teeoioetasla ran o;u)texnircoa1lat lnei (0s2trxm nudomte iciltfsrumxmpoo4olt  oeiys s rl(mpn(4alxoxf ia1opt  i s;t srto(opio1ameelfcsa( s2rm(rpno0ale ifctldfs ul(vo;u) rxnir iytfmt ln i s0 etoxr oo1ap emivs s aDum( o;o4oexomfeilt aDrlnvonu4artoif3oytlmtelneolt)trurim iodol   ieiat)srtaumooo4oee  oeilsfm emuvs u4tltnxf todfpD aueol(0seumxr ny4lle mnci t  rrm(ro;u1tpe iieiydfs2umuvont4arenirciadfpD anei s0 etrimpoudam nmnvslt)a2um( p;t1oee mo3ildlsDrauvo;t)teerxo oa1lm  auvi s  rtoir3no1llte icta(f ruaxro;t0opxnioctys a2el( p t0 rermo ia1omDr u o;( seum(m3iy1oltemieilt) 2rmu pot4teeomiciytfs uln ont)arxoif oydfm raieo s t2urxmpou1op  mnes s) rtauront0aet iociytlm emuvp ()altnxfcoadop  aueolt tetr(opno1olenmfesas) rtr(mono0texoif3iytfa ra( s t4aetoif3io1laDeaivilt)sexmirpiy4oltelfetas) rtr(mooo0apxnmo3iyslaDrl( p;() ltoxr todlmtrau ilt) exm(rpou1ap nmics s)sDtrxront0alx ii3tls a umn s;t4artoxrcootfmDrai o;s sexmxm3oo4omtelivsl(f 2tr(mp;t4texnioetad m2uaumont4 rxoir3iadfpt lues (0s2tm(opnodopenmfcsa(f 2urxro;t0tpenif3iad aDel(ms u)arerxf tadlpt ln s;t0 rxmirpiodopeelneta() 2rmur nt0optomo3ild s2emump;u4aetoif3oatlaDelnvo;() rur(m3ou1ol e ivt (fa2rr(rpnu1olxn o3tatlmDumnvp u0texomr oodfm e n o ()teurxmpno1ll e fesltfs2rmumonu0oltomociytlm2rl(ms;u0aetnxo3oytfm eau i;s sruo(o iy1opte fetlt srrrxroou1oexoii3ildlmDulumont0trtnir iotfmt lnvo;s0 rtr(m3oo4olee iesls)arrrxr no1aptomo3iadfs ul(vpn(4trenio totla r uvo;t0t2xrxrpny1lmt mncs s)arrru o;u0tptn oeiyslaDuaums t0trerirciydom   neo;( t2umxr no1ape lics s)s2tau poo1tlx  oeild mDul(mo (4 rxoir3oy1opDr nvi;(  etrim ou4lmtelivsl( aDrr( pnu1tlxnio3iytfa2elu s;u4arxnifcoytlaD  u o ()trumxrpiudop emiei s  rua(r ou0tetn f3iltfs2rmnmsnt0trxoir3oadlm eaieil()teum(m ny1alte nvil(fs2rru oot1oet ioetltls2rluvpn(4trenif3iodom elnvs;( trto(m no1llt mfvia( s2rru oot4aex  fcildlmDuauvo t4 reoir3to1lpteaneo s)srxo(m3io1al  lfvs sfsrta(r ;u0tpen o3tad s2em(vs;u0alxriociy1oa eauvi (0texrim3nu4op   ictl( artr(m ;o4oetnii3iltla uaump t) rxoxo3ta1lmDr ivsls  2to(rpny4ll nmnci ()aDraumo;o1opxo ociyd a2ea( s;u)arxrmf oodopDr ivo;t  2tm(m3ou1lmt  icias  Dtrxmoou1opxo iciaslaDrau p;u0arenmf ia1fateaneo;s0t2to(opiydllenliei s)srrmu  ot4olt mi3tad m2raumpn(4arxrif iy1fp  livi s seuoim io1olenmfctat)a2taxmpot1aeeo fcild a2um( o u) reoio3oatfm elu o t  2xoxr iu4llt mncsls) Dtrumoou0tex  icias m2ea( p;u0trtnmfcoo1oaDeaueol( t2trimpio1apeeliesa(  Drmu ono4alenmiciyt s2raumsnt)tlxrmo3ia1lpt luvolt0 exmio3nydlpen fvt tfarur(ront4tpxnmiciydfsDua(vo t4trenmo3iatom   iesls0t2uo(m oo1lme  ivsls  rraurpnu4tpen oeiad aDrmn s;t0 rxrxf oytfpD aivi (  2umiopno4optnlfci t) 2urx pnt4tpxnmfeiytlsDrau p;(4tlxnifciodoa eai ils) euoiopnydamt miesasfaDumurpou1apeoifctat a ran o ()areomfcoytopD luvs s0setoxm3io4ope mieiat)artmxm ;t1alxomictldls2ra(mon(0 etnmr3tadoate ies;s setr(opny4am emfct tfsrra(m nu1oexoiieiysfs2ranmo (0 rtrir3iy1oateln s t) eurimpiu1lmtnlfcslt s2rr( p;u1aexnmociyd s umumo u)areoif3totlpDelu s;s)t2urxopou4am emiesa( arrmx pot1aetomieiyd aDumumo t4 eerifcoy1lmtrlneo;(  eurxopoo4ol n fct ()srraxmpou0alx if3iatla uan on(0texnio3iatfm ran i s texrxopio1lmt lfcsl( sDuaum ot0oexnmociaslmDelu s (0 eenxociytfp eluvilt0sexm(r3io4olen fvtas srtr(rooo1oexn iciadfa ulnvo u0artoxo totoaDrluvi;s0 exrimpnodap  mnvsl(faDur(m no4tlxn o3iadls2ean pnt0trxomo to1fa rli s ( t2tmirpiu1llenlfcs t s2raxrpot4apeoiietadfs elumonu4trtrmo3oy1fmDr ies;t)s2xrirpiodlpeelivt tfaDraxm nu1tpxomfeilslsDra( s;t0 exnmr3ootfptrln ilt0t2tr(m oo1lm nlfvi s arum(  ;o1olto o3iysla rmuvo;t4tetnio iy1fmD lnvil()trxoxo iodam   ivil(  rtm(root0opxomf3iyd s ea(mo t4trtrmo iydomt  iei;t sruoio io1lptnmncsls) Dtr( o;t4tpxoif3iydlmDulump;t)texoir3oytlaD  n ol( seto(o3oodll   nvi (fs2umum oo1olx  octldfm2umu p u4teerxocio1lmDeau ol(  eto(r oudamt lfvsl( aDrax  oo0altniietysfa rmu sn(0altnxrctadfa   n olt t2tm(m3io4olenmfes tf 2rmxrpot1alen ieils mDel( snt4trenxrciytlmDe neol() euoir io4llenlfesl(f Dtmxrpno0tpxn o3iyd s2uauvp t0tlxoxf ia1fp rluei () 2uoxr oodamtnlnesa() Durxmpoo0aleo o3iatla2umn s;u)teermo3tadfmDelnvi;t  2to(r nudalt  feta() ruaxr ou1aeeniietatfmDrau ont4tetnir3oo1fa  ln o t0trtmim ou4omt  fvsatfsrraumono4olx if3iysls2ea(mo;(4 exnxo3oydfp r ueil(0s2umio nu4olenlivia( s2trur oo0tptnmoctasla uanvsnu4teeoio3iy1fpDrlueo s0sexo(rpoy1lmtnlieia(fa2raxrpoo1tlxoio3iatla2elnvs;t4alerioctatlmtrauvs;s0trurxr3iydape micslt  Dta(r no0opt  octyd sDea(mp (4 eeriociodla  ai ils)texo(o3io1ape livs (fs2uru pno1oltoioctld sDuaums;u) exnxfctotlmte iesls) rurxmpiy1omtnmietl(fa2rr( ooo4aexniictad a raumont0aleomr3ia1faD  ues;t)teur(mpou1olt  nvsls)srtaxmpnu0optnii3tytfaDuanvpn(4 ltnxr iadfaD anvslt  euo(m oodole mfei ()artmx p;o0apxn fetytlm2elnmo u4alxnmo3io1la eluvilt)srtr(m3iodop nlnvs (fartmu onu0tpxo oeiydlmDumnvp t) ltnmr3iydoaDeaneo t  exr(r3oo1lmtnmivsat  rtaurpno1oet mfciadls emnvo (4 rerir iatlatr nvslt srur(mpiy1om e nesas aDrm( onu1texniietas a2eau snt4alxrmrcoy1om  lueils s2ur(r3nydomenliesls)sDra(monu0tlxnmfciadlsDrm(vp u) etnxocoydlm rlnvo t0s2xrxmpnydlpen fetat)a2taump;o4oltoiiciatlsDrau s u) lxoxrctodfm e uvo;s0s2xo(o3oo1ale  ieil(fsrrm(moou1tpxniiciadlm2elnmpnt4 lxrmociadom r u ols) eto(r3no1opt  neia( s2tax ooo0opt  ieiyt m2ulnmonu4texrirctodomte ivs;( trurir3ou1ol nlnvil(  2tmx  ou0oeenmo3iat s uln snu)trxrmf3iatfa rln o;s)srxr(rpiodaptnmieilt a2raurp;u1oee mf3ild m rln o (0trerif tatom eaueol( seuoim iodlm nliet sf Dumuronu0tpxo feiydfs2umnvo;t0arenxrcoo1fpDeaivi;(  euoxmpou1apenlnetl(farum(mo;o1aet  i3iyd m rau onu4 exnxo oytfmt  uvo ( sexr(r3nudap e ict ()aDtmxr ;t1apx mfeiydfs rmnvp;t) lxoxfcoatlptr u ils) 2uo(o nudlm elncslt  Draxm no1tpt if3iasfs2rauvs;(0tlxoio iotoa   n ols) eto(mpnydlpte fvilt  rtrxmp;u0open i3iytfm2eau p;u) exnmr3to1fm   uvo t  exm(m io4aleelnei t  2tr(mpou1aee mfeiadfs2emnvs ()tlxrmr3ootoaD lues;t0srumim3io4lle  fcsas) Duaxr nt1opt moetltlm2el(vsnt)alerxr3tytfmtraueolt) rtrir io4lm  lfvi () Dua(r nt4tlenifeiat m2ea(vs (4tltomr3iydfmt lieo;t)s2ur(mpiy1amt lfvtas sDumu  nt1tltomfciatfm2rl(vpnt) etrmo3oatopDraues;t)trxoxm3nodap nmivt ()a2truront1aeeo o3iyslaDem(mo (0aexomfciotfmDrlueols seuoxopoy1al e nci tfsruru  ou1oexoiiciatlmDul(vpnt0tlxnif3ia1optr ivi;t) ruo(r3ou4lmeemietat)arua(m nu1oet ii3tlsfa2ulnvp;u4artrxrciodoptr ivslt0 eumir3ou4opt  nctat)sDtru o;t0oeto octytlm em(mon()teermfctotoateluvo (0sruoxm3nodlmt livia(  rraxmp;o0aet  o3tys mDran p t4aeeoxrciatfmtrlu ols s2xmir iu1ap nlfcsat arua( p;o0oexn oetysfaDelnms t)trtnxr3oodfa   ivslt0 2urxr oy1lm nmncias s2tmurpou1tpxoif3iysfa ra(mo u4 rxrmr oy1lpD  u ols sexoxo oo4lp nmnvta(f Dumu p;t4oetn ociatfsDrl( snt4treomf iadoa r uvilt) 2uo(rpnu4ol nmncsasf rtaxrpoo0aex ifeiyt a rau o t4tlxomrciydoatrlnvi;(  eto(r nudlmt mfctas)a2um( oot0texomiciatfm ean s (4altnio3oydlptrln o;(  2uoirpou1omen ivsltf Drrxmp;o0aetomfetatfmDuauvp u0 rtrmr3tadoa   n o;(0 euoio oo4apeelfciasfs2ta(r ;u0altn ietls mDulump (0alenmr io1op   u o;() 2xoxm iu1olenlnctl(  2rmx  nu4aeen ociydfm2rmuvo;u4tlxrmfctodopDeau s s teto(m3oydllt mnvias  Dtrxrono1tetn i3ilt a uauvpnt4tlxnmrcoodop eanvo;t)t2uoxm3iodolte fet s) 2ta( o;u0oltnmieildfa eaumon(4artnmfctydopDran o;( s2um(m iy4optnmfvt ()aDrmx p;u0tetoif3ilsfa umn p;u)alermr3ia1fmDr n s (0t2uo(o oo4lptnlnetas)aDtaxm oo1alx ii3tlslsDrau o;(0areoxocto1fat  n i;( texoxm3oy4alte ivtl(fartmxmont4tltoiictydfm2el(mo u0texnxrciy1fate nvs s0 rxmim3oudapt  fcsl(  Dtmumono1oltnioetysfmDelump u4 lxnmf3to1lm   uvs;() ruo(o3oy1omtnlfctlt sDrr(mpoo0ape mieild sDua(vonu0trxrxr3ootoaDeauei s  rtoim3nu4ape  fcias) rrmxronu1tleo f3iyslm ul(von(0artnmo iytlp  lnes;s) rtrxmpnydop eliciat)aDraxrp;o0tpeomoeiys s2rluvs;(0tetnxr3io1lp rluvo s0srxrim nu1omt lncslt)a2tm(mpnt0alt  ieiys a rmuvs u)aexnir iytfm  livs;t t2to(m3nudopenlfes s) rrruroot0tltnmoeiyslsDrmn ont4aetoircoatlm eanesl(0s2trxr io1ap emncil( aDuaump;t1oexomfctad s umnvs t0 rtnxr3iatop rauei;t setoxo3iydamtelnvt sf Dta(rpno0apx ifciydfaDea(vont)aetnxfcoadoatr ivs;t0trtoxmpiu1ame mncslsfarumu onu1alx ioeiaslm2rmuvo;t0altrio ootlmDr ueils) rxmiopiu4am nmfciat  2tmx  ;o1tpto i3ildfa2el( o;u4tetoir3oodomDeanei t  2uo(opny4omt  fcilt)sDur(  nt1ape mictatlmDeaumo;t4tltoxo oo1lmtrlues t0t2uoiopiu4lmen ivsatfs2tmxrpot0olx moetatfsDul( s t0tetnxrcoodfatrluvsl( tetrir iy1ope mivsat aDtaump;t1apeomieiytlm2rlnmpn(4aeeoxf iydopt auvs s sexrxmpiodlptnmicsls) rur(mp;o0tpe  o3iytfs2ra( p;t4tltrxo3iytfptelu sls0 2xoiopiudlm emics (  Durx oot0aetnmieiadfm eau p (4 lerioctotfaDeau olt trxoxo iy1lmtnlivi t)aDtmxmp;o4apxo f3tadfs2el(mo;t)aetomo oy1omD anes;(  2um(r3no4omt  ncil( s2umxr ot1tltn i3tlsfs umnvpnt0tetoxoctotlmD aueol()t2xmimpoy4lltemfcta(fsDuaurooo4olxoif3tltlm em(vpnu4altnio3iotomt aueil()setrir3io4ol nmfvs t)sDrmur ou4aeto icilslmDrmnms;() leomo totlaD ln o s0texr(rpoo4op emici t sDtmx  ;t1tlenmiciat a ra(ms ()aetnmfcoadlp r ieo;t0 eto(rpoy1ap nmfci t)s2tr(  nu0tleo o3ild m2ea( pn()teerxoctadlp rlnvi () eumiopno4ale lfvi ()s2umx o;u0alto i3ilsfaDuln s;u0 ltrmf3oa1lmD  uvil(0 eum(o nudlpe lfvs (fa2rrx p;t4tpto fciydlm2em( pnu0 renxfctotfmt  iei;()trumxrpnu1ol elnvs t  2tmx onu1apt  i3iatlm raumsnu0aexnmf io1lmteli s;s s2xmiopou1ol elnvs tfsDrmu p;u0tptoifciydfa rl( onu) etrmrcty1oaDeli sls)trtmxrpoy4ale micia()s2tm(mp;u0opto ociaslmDea(vo;(0altrmfcty1omD ln i;(0 2uoim3io4ol nlnetl() Drru oot1aleoiictysfs2rmnmpnu)artnmoctydfm e nesls) 2xm(opio1llenmieil(fartrxmp;o1teenii3tld a2rl(vs;t) ltnircoa1fpD lueol( sexmimpny1optemnes sf 2rmxmo;o0aexo fciatfa rl( snu4 renmf io1op   u s;t srur(m io4lle  nesa(  ruaurooo0apto oeiatls rmnvs u0 rtrio iatfptrlies s)sexrxo ou4omtn ics tfartm(r ;t4tpen ictatlaDrl( s u0trermfcty1fm ranvo s)srtoxr3no4om elnvsasfa2raxmpou0aexnioeiytlm ulnvpnu) leomo oadoaDelieolt tetrim oo1lm n ivs t  rra( onu4ole mfctatlaDra(vo;u0 leoxfciotlaD au olt teurio3oy1am nlivtat)aDuaur ot0oltnifetadfmDem(vo;u)texoir3oatlat aueol()trum(o3ou1am emnetlt  Durxmo;u0altomfeildla2rmuvs ()tlerio3iy1optrlneo;s0tetrimpnu4ameelivsltfsrur( p;t1olen iciat s ea(mont4treoif3to1om rlu s;s s2xm(m io4am e fetl( arraumpot1oetnioctlslm2rm( sn(4 eenif iatfmtrai o s seto(mpiu4ole livs sfaDumxmonu4oetniieiad mDemumo u4trenxr ta1fm  ln ilt)s2ur(o nodap nmivsa(fa2rm(m ;t4opxo oeildls rmnvo;()trxomo3iotfm  lu olt)setmimpnu4om elnetlsfsDrr( ont4tptnmfeilslm2eluvp t0 lxrircoodopt auvs ()tetrimpoudlpt  ivsl(fsrtmxmo;t4tptn fcildfaDeanmp;u)tetnmrcoy1opte n s t srtrio3iu1oltn ncs (fa2ur(m ;o1tpxnmfeildfm2raumonu) lxrmfcoodfptrluei;(  rxrxmpiy1altnmnvia(fsDuru oot1tptomf3iyd s2um(vp t4alxriocoydlptelnvs;s0srtoxm3nydolt mieia()a2tr(roou0oleo i3ilt sDeln p u)aetoxf oytoat liei s0s2umiopio4op  lfcslt  2um(  nu4tex mi3ildla2em(ms u) rxnirctodlm   u i;t trur(r3oo1lltn iesa( a2trxmooo0aee  f3iad s ulnvo u4 lxnxf iodfm   ieils0 2urim iu1amtnlnes tfsDtrxmpot0aex ioetysls2ean pn(0 ltrxr iodlpDeluvo t0t2xoxm iydlltelfvi t)srrr(  no4texn feiat aDrlnmo t0trtrxociydomteauvslt0 2to(m3iudlp elfvsls)aDta( pot1oexoif3iltla2ul(vp (0teeoxr3iydfmD livol(0sexoxr ou4om nmie
\ No newline at end of file
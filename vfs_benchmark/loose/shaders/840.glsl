@@ -0,0 +1 @@
+nes;(  exmxr oy1lltemivil( s2rau oou0oex if3iytfs2elnvon()tlxrxr ootfmtrln ilt0trxoxr ny1ap nmfvsa(fs2urxrpoo4oltniictadlmDel(vonu)aeerir3ia1la  ln i;s) 2uriopio4op emicsas)aDra(m ou1aleoifciyd m el( snt0tetoxocoy1fmt lneilt  rxoxm3nu4aptnmfctltfaruaurpno4tlxomfciasfaDra( s u0alerxo oo1late iei;( trum(rpoy4optnmnvils)aDuax  ;t1oetomf3iyt a rl(mon(4trenmfcta1omD livs;t teto(r iy1olt  ivia()a2ta( o;o4oleo i3tydlmDrauvpn(4 rxomrcoydfatean o;(0srumio iodlm elnvtl() Drrxmo;o1oleoif3iadfaDrlu pnu4alxrmr3oytlmD ai i;s teto(r iu1lm n fctls)aDraxroot4teen ietltlsDel( p;(0altnio3oatlaDrai il( srxoxopou4am n fvt ()arrruro;t4apenii3tltfmDrau p u4tltnir3iydfpDrln s s  rtoir no1apenlnvtltf 2rmxmonu4aee iietadfaDrl( o;t)alxoxr3iatoa e u ilt srtrio3ny4ap elfctas sDtau pnt0aee mfetyslm2eaump;()tltoxf3oa1omDeaneo;(0 eur(r3io1lmen ics sf 2tmxrpnu1tpto oeilt sDrl(vpnu)arermr3iydfp  an sls0 exmio3oy4optn ivta( artrxm ot1optomieils m2ua(mo;u)trtnifciadfa eau il( truoirpiy4omt liviasf rrr( o;o4aleomf3ilslaDel(mont0 ltrmf3oodoatr n i t) rxoxr3ny1lm  livsa( aDrmx  ou0texomi3tadlm ra( o;(0 etoio3totlmtraieilt0truoxr3ny1olee nvsa()sDrr(ro;t4ale  o3iadfsDemuvo;(0tlxoxocta1la ranvs;t)seuoim3iy1apen fcsls)sDtax onu0apx ii3iasls2rm( pnt4altoiocootomD aieo ()srxrxo iodlp  lfeils  Drm(r oo1aleomo3ilsfm2uau o ()areoxoctatla rauvilt trto(o ny1ol   icilsfsrrmxm ot1tlt  i3iasla2ea( s;t)tlxoir oadopDr ieo t0 etm(m iydope mnvsls)a2uaxrp;o0alx ifctyt m2uau o t0alxnifcoatlm r n s s0setrxrpiydapeelics () Dta(rpnt1apeomf3iydla rm(vsnt0alxnxo3oydlpt auvo ()trxrxo ou1apeemfvilsfa2umu o;u4oleomfciaslm rl(ms;t)trermf ta1fmt  n i;s) etrirpoy4altelnes tf rtmurpou1open i3tyslsDemnvpnt0treomo tatlpDe nei s)trtoxopou1al n nvtas)artmu o;t0alx mocilt a uluvsn()tleoifcio1lpDeluvi;(  2xmxrpno4ll  mfes s srtax  ou0oeen fetldla el(vsnu4 rxniocoy1lmD lieols0tetmxr io4lmt lneilt) Dtmu  ;u4oexnmoetatfm2rmnms;u)alxomr3tytoatr u il(0 2xrio ou4lmtnmivsls)s2ua(mo;u4tpt  ictldls2emuvo;t0 leniocoodla  livs (0tetm(opiydol elnet s s2taur nt4tlx mo3ild m2eau p (4 rxoir3oodlptrauvo;(0t2tr(m oydlm emictl(fsDum(mo;u1oexoii3tlt aDum( s ()tlxoxfctatfm e u o;s sexrxmpnu4om nmietat)aDrrx o;u1oetnifciadfa elu o;u4trtoxf3oadfmtrlu ol(0 2trio3oy4lltn icsat aDtmu oou0opxn i3iadfa2ua(vo;t)aeermociatoa r uvi ( trum(o oodom n ieil()a2tax  no1tpenio3iat m2rl(mont0 eenmr3to1fmtrlu o t t2trir3ou1ol n fei ()arrr(mpnt4apxn f3ildlm2um(vo t0aeerif3iy1fm rlivo s sexoio ou4optn nesltfaruaxr ;t1oee  ieiatfa umums u4aexnif tytfpt  n olt0sruoir3no4amt mfcs (faDtmx p;o1olxo f3iltlm2uaumo u0alxnmociatfp eluvil( t2to(rpno4lltnmnvtat)sDumxr oo4apen iciydlm elu snt) ltnif io1faDraivsl(0 rxrirpno1opt livt s)sruauront0tltomfctydfsDranvp u)tltnifcoydlpD  u s;s0teumim nydolenmiciat)aDur( p;u1aexomociltfmDraumo ()teermfctytfa eau ilt  euriopiudol  lnvta(  2raurpoo0tltnmo3tysla2uln pnt)tltnxfcoydoa e uvo;s0srtm(r iodaleelieil( artmu ono1oexn o3iat a el(vont4alxrxr iy1fm   n i;(0sexr(o3oudll n ics ( aDtau poo1openiieiat s2ulump ()areoio3tatoaD auesls)t2tr(m ou4alte fesat)aDtmumoot4altniocilt a2ua(vp (0 rxomo ty1lp rai o t srxmxo3oo1lptelfeilt sDrm( pou1open o3tydfa uln s () renif to1fmtr uvolt0t2xm(r nydome mnvil()aDrmumpoo1tleoiieiatfm2rau p t4treoxr3totoa  lnvi;s0teum(o3oo4om  lfeiasfsDrrxro;o1aexnmiciasfa2ulnvp u) rtnir3tydfm   nvo ()s2xmxo io4om   fci s)sDtmu ont4ale  f3tatfm2uan s;(0alerxf3ta1fateaieol(0setrxmpou4lltnmivias s2tm(rp;t0alx iociadls2elums;t0alerxr3oy1oatrlivs;s  rumim oo4lm emfetlt)arur( onu1alxoii3tldfaDrmu onu4 rtnir3oatlpt aivslt0s2uoio3oydam  lnes t aDrr( pno4openif3tat sDua( o;t4texrio iy1lpteai olt0s2urxo3oy1op emfeia(  2trxmpnu0tpe  ieiadfm2rau o;(0 rxnir iodfpDr nvs s0seuo(m3oy4ape mfvias aDtm(  nt4olenmietas a2em(vp t)tltriocio1lateau ils s2xmim3ou4am eliesatfaruau  nt4apt ifctlsfa ul(mpnt0 exnxo iatom rluvo ()truoxr3nu4op emncsa(  rumum ou0apt mfeilt s umuvp;(0alxrxf oo1fmtelueo s0s2xmxm oy1lp nlivsa(faDur(ront1tpenmo3tyslm2ulu snu)arxnxfctodlm e nesl() 2uoxm3nu1am elictas sDum(rpot1oet  fciyd aDemu o;t4artnxr ootfpDe u i;( srtm(o ou1aptemieta()aDtmxmo;o4aexomocilsfmDemnvsnu0texrmoctadfp e neol(  exoirpiodale mnvils a2rrx p;t0apeomieias m ulnmo (4trxniocio1la raiei t0srtrxm3oo1llenmicslt a2rmump;u0olt  fctyt mDumnvo (0artnmr3iadomDrlivi;(0srtmxopnu1amte ivsat)arrm(r ot0tetnmi3iltlm2rl(ms;(0 ltomr ia1op e uei;s0 rxoir iu1lp   ieia(f Drr(r oo0texnif3ils a rmuvont0texrxfcoa1fmD anvil( truoxo3nydop n fes t sDrau oou1ale iictadfmDea( snt0 exoxr oodoaD livi;t0s2ur(r iu1lmtnmneilt) 2umu oou4tlenio3iatlmDul( o;t)tlxrmocoo1oaDelnvilt  2umim3nu1lmt lfeslt arurx ooo4apt if3iysfmDumuvp;u0arenio3io1laDeli o;t  2trxmpiu4omtn fcsasfa2uau  nu0aleo o3iasfsDumn s t4 ltrmf todfa e uvo s0trumiopou1op  mnvslt arrruront4olt  i3iadlmDranvo u) etnmo3ta1lmDeauvi;t srto(rpny1ope lnet tfs2rrurpno1apxnioctyt mDra( snu4trenir ootlpDran sls) etoxmpnodll e fvtat aDtrump;u1tlt  fciltlmDranmo u0tlermo3ootomt aues;t t2umxo nydomeelfvs ( arraxm ;t0alxomi3tlsls umu p u) rtrxo io1opD  ivo;() rto(r iy1lleelfvta(fa2umxrono0tee iieiatfmDuluvp u0tlxnmoctatlmt ln o;s) exrxm iydoptn fcslt  ruaxmpno0teeo ieiad s uaumo u4alenio3oodoaDrluvi t t2uoxm ny1ap e icsat a2ra(rpnt0tpenmociatfm ul(vp;t)trxomr oadfa rlieo t setoxrpoydape liesat) Duaurono4oeen f3iadls rl(monu4 reoiociadoa ranvi s0s2uoio oy1apenmfvsl( aruau p;u4tpxomo3iysls2rl(vp;(0trxrmo3iodfateau sl(0 ruoxm oy4optnlfeta() 2ururooo0apt iociad aDum( o;(0 ltnmf tadomt  nesl(  etrir ny4omtnlicta(f ruax pnt0aptnifciadfm2ranvsnu)aeeoxf tatopt luvi t s2uoir3oo1am nmicil()sDuaxm ;t4oet iociysfm em( o;u)arxnif oytfptr uvo t0 rtm(m nudaptelfcils)arraum ;u1oee  ociasfa2raumon(0 ltoxo3oydlaD ln i;( texmxmpoy4ome mnctl(f Dtru  no4optnifeild s rl(ms;(0teeoxrctytopte neo;( tetm(m no1ll n ncsltf Drru  oo1aee  ociasls emn p;() eenmf3ty1faDranvsl(0 2uo(m3oudll  livs t) 2taxm no0aleo iciydfm2eanvs (4teeoioctatfateln o t)trtmxmpiu1ll n ics sf rtau oou1olxomo3iasfsDem(vs t0trenircootomteaivols) 2xrio3oydame  nci t sDtr(ronu1aetnmfeiatla2ea(mo;u)tleoir3iadfptelneo t  rtrim3nu4ap nliei s s2rmuro;u1opxnmoeiyd m rlnvsnu)aeenxr tadla rli s (  eumxrpnu1llt lfes t  Drm( o;o1aeeo oeiaslm2rlums ()alxrxrcoadlm e ieolt0t2xoxr oy1omtnmicias a2trx  oo4oeenio3tlsla2um( s;(0trtrmf3oo1om   nesls0 2xrio oo1ap nlfvt t)s2rax ono4aetnifctatlsDean p u4tetrmf oa1lm  lnvi;t) ruriopoy1lpe  fetlsfsDtm(mpou0aexnmo3iyt aDul(ms u)arenxf iotlp elu ols)srtoiopoodam emnvslt) 2rm(m ;u4texo i3ild sDulnvpn(4tlxnxr oydfpDe uei s0s2trxmpno4lmenmnvil() 2ua(ro;t1tetn o3iyt a ulumsn(0tltomrctytlaDe n ols0s2ur(rpoy4llte iciatfaDraxrono4alt  f3ias a ul(msn(0 ltrmf3oatlpte ivol(  rur(opny4om nlnvt ()artaxr ;t4tlxnmicild a uln p;() renmf tadopt ai s t)t2xo(o oy1ome  nesltfa2uaurpot1alxoiieiytfa2em(mp t0aeeomo3ia1fatr i ilt trurimpoodam emivsl(fsDur(ro;o4apx io3iytlaDum(ms t4 rtnxo3oytlpDeaiei t)sruoxm nudaptnlfet (  rtm(rp;u0aeenioeiyt m2rmuvo u0artrif3iydopD auei;()tetoxm iudalee fctltfaDtmxm ;t0olxniieilsfm2ulu snt4altrio iy1lp rauei;(  2uoio iy4olenmfcsl( srra(rooo1tet mi3ilsfa2uluvon()arxrxo ta1fpteanvi;t  2xo(r nydaptemneslt)arum(m ot0tle  fctatfa2ea( o;t)aexnio3ta1fpDeln o;s) rumxrpny4aleemfvtltfarrr(rpnu4texoiictltfm2ea(mp u4altomr3oadom rauvs;(0srur(mpno4lmenmneslsfaDtmuro;o4opeomfctatfs2umnmo t) lxrmo3iotfm r ieo;t)truo(rpoo4ope mfvia(fa2tm(  oo4tetnifciydls rmuvsn(0artnmf3oytlpDrauei;t  etrxopoy1amen icsa(  rtr(mp;o1olxnio3iltlsDel(vs (0aleoxo ta1oat ln ils0seuoxrpnodole  ivt ( sDrmxmpnt1oee mieiatfmDemu pn() eeoiociydopD luesls tetrxm ny1ap emivils sDum(roou4open oeiys aDrm(vont)teeoxo3ia1oa e i i t)trxmxo nudll nmicilt srtmurp;o4aeto ietys a um(vsnt4 rtnxo oodlmte neo;t) ruoxo iy4lmenmiet s) 2umu  ou1tpe iiciasfs2eanmsnt4teeoifciy1fptrlivo s0 rtoxo3iodlm n netls)aDtau oou4aetn octyt sDeluvs ()texrif3iytfmDrlu o s) etoxo3iy4aptnlivsas  2rrxmont0tee mo3iltla em(ms (0tlxnmfcty1fa r uvi ( srtrxopoy4lm elncils)sruaxmo;t4aleoii3ilsfa ulumon(0alerxrctytfate n o;()sexoxr oy4lpt lnvilt  Duax  ou0optnmoeiaslsDuan s;(4 ltomr iydlpteaueils teurxo3oo4ame livi s) rrm( o;o0tlto i3tyd s2ranmp;u0 lxnmr3ootlate i o;s s2tm(r oydame  fctl(  Dtm(monu4oleniictytlmDemn p;u0 leomoctotfateauvo;t s2um(r no4altemfcs s arta( pnu4olx mf3iytfmDumnmp t4trxrmfciotlmteau s;()srumxm3iydomtelncilt) rur(  oo4oex mf3iasls rlumont4 renmr iotlp r n il(0 exmxo oodlpe  nvsas sDrmurpno4opt mieilsfmDul(vo;u) leoirciadomt li s ( setmxo3io1om n icsat)arurur nu1opeo ieilt a2rl(vp (0areomr3oodoaDe ivi;s0trur(opno1ol emnvtlt) Dum(  nt1apx io3iadfs eanvs (0 eenio3tydla eanvslt) exoirpnu1alenmneta(  2uax pno0olenmiciytlsDulnmp t4artrio oo1lpt aivslt0 eto(mpny1ap  lnetasfsDrrurpou4teeomoeiyd aDumu snt)tetnxr oodomteai i;()trumxrpnodllee ivsls) 2tmu pnu4aee moeiytls2rlu o;t)teenif tadlmDeauvols0tetrxrpnu1ol nmfesa() Drau  ot1oexo o3tltfsDem(vp;t0alenmociadlat  n ols0srxoir3nydolenlnvs sf Dtmx  ot1ope mf3iyt a rlnmp;(0trxnio3oodlp rln i;s)seto(r ou1aleemfcsls aDuaumoou0tee mfctlsfm elu o;(0aexomo3ta1oaD  u o;t0seur(r3io4lltnmnetlsfaDuru pou0texoiieilt a2elnmp;(0 renir oydfpteli ils t2trxo3oodom nmiei () 2tmumpot0ole mieiasfsDem(vp t0texoircootlpDeanes;t) 2ur(m3no1op   feslt artaxm nu1ale  feiad m el( s u4 eeniocoytlmt anvilt texrxrpnydomtemnvilsfa2uaurpnu0olxn ietas s rlnmon(0altrmf io1fatranvi;s)texo(r3iy1optnmieta(fsruaxmp;t0tlxn ictad aDea( s;t0trtnmf3oo1omtr u olt t2xo(o oy4omee nei (fa2ta( o;t4tpenmo3ilsfa2rauvsn(4arxnxr ta1optraues t0trum(m io4lpeemfei ()artrx  ot1aex  f3tasfa uanvs;u) etoifcoytlpDrli i t)t2toxr3nu1ll  mnvsas) rtrx poo0aex  feiltfa uan snu)trxoio totlmt  nvo;( teto(m oodomte nvs ( sDtmumooo0oltn i3tys aDrlu o;t4 leoir tadlmD  n ol()tetmir ou1amtemicilsfa2ur(mp;t0opeo f3tytfa2uauvp u0 lxnir3oa1lmDeaneil(0 exm(r3ou1lm elfcias)aDtru oot4oet  ietyd mDuln o;u4texnmrcoy1opD  iei s s2tr(m ou4llee icia( srrr(rooo4tet mfctldfmDemn p;u0trxrmf3oy1op  li slt)texrxm3nodlptelfvs t)s2ur(r no4alxo fetad aDuluvo;t)arerifcoatoa  anei;s t2xoiopno1ol e ivt t  2tm(r ot4tpeniiciatls rmuvp t0arxrxr iy1op raieo;s)t2umxr3iydomeelnvs (farrrxrpnt0openiiciys aDeaums;t)aexoir3oa1fm elieo s texo(opiu1oltemivtas)aDtrx ooo1opeomoeilt m uluvsn()tlenxr3tatlmDe uei s sexm(rpiudamtnmicsa()sDrrurono0tetoifetltlm2ua(vpnu0texnir3totlat  ieo;(0tetoxm iy1omtelivtls)a2umx ooo1aeeniieiasfa2ea( pnt)artoxo oa1laD lneilt trxo(r oo4aptelnvs sf Drm(m ou4oeen ietls mDra(vpnu)tlerxr3oodfpteai o t0 2urxr3iu1ol  liei t) 2uax pno0aet  ociat s el(ms;(0aeenmr3oa1fpte iei;() 2um(m3oy4lmeelncsl() Dumumpnt0tpxn oetydfaDrlump;t0 etrxr3tydfm r nvs (0srto(mpiodomt  ncta()a2uax  ;u4alxo o3iytfaDraumo (4aeeoifcta1oa rlivo;t0texm(r3iodlptn ies (f 2ua( pno0opt mfciydfa2um(vo;() rtnxr iotoa rau i;t s2xmxo3no4altnmfcs s)artau  nu0tle if3iltlsDrlu p;u)artoxrcoy1opt  u ol(0 2ur(m iy1lmt mfcs sf rrr(r ot4oee mi3ildfa ul( p t4trxnxf to1oa r u i s s2xr(mpoydaptn nciat)arur(ro;o0oleomoetyt a2emu s u0artnirciytlp r n s s0setmxr no4ap emivias)sDumxrpno4aexomicilsfmDua(msn(4aexnmr3ia1laDranvils0srumxopoo4olt liet s sDuaxr no4ape mociytla uauvsnu)trxnmo3iytfptraiei;t) 2trio iydamenlnetasf rrrx p;o1oeeo o3iltlm2rmu sn(0alxnmf iydfm   ueslt0sruoxr3nudop  lnetltf Dum( o;u1oee miciytfs uluvs u)areoiociytlp raivi;s0tetr(mpoudal nlnvsl(fsDuax  no0tetomfctlt m elu pnt0tetnmo oo1la  aneo ( trtmxr3oudal nmivsasfaDtmumpou0tltn oeilslmDum( o (4tetnif iadfat aies (0 eurirpoy1alt mics tfa2um(r ;u4tlenioetytlm rm( on(4texnmf oadoaDe i s ()s2tr(mpou1lmtelfeta()sruax ont1aexnifciys mDuaums;(4 lenxf tydop e uvs;t) euo(m iudlpe lfvtas) 2um(ro;o4tlto octyslaDemnms () etnir iy1lp elnvslt0tetoimpiy4lmenlfesas  rurx  nu0tlt mieiad m rau s;t)aeerio tadfa e uei s) etoiopio4lpt  icia( arrrx p;u0texo o3iltla el( o () eeomo3tadfaD au slt0srum(m iy1ap nlfvsat  Dtaxr ou4altn i3ilt a2emnvp;t4trxomo oa1op  ai i;s  2xo(mpou4lltnlnvt sfa2rm( o;t1open f3tltlm rl( ont)trtrxo tatfpte nei ( texoxo nu1lpt  ivsls  rtrxm nu0ole  f3ild aDemnmp t0 etnio iydoaDrlu i s)srtr(o iy4alte iesl() rrrxr ;o1olx io3tys s2umumsnt)tleoio3oa1la ran il(0sexrxmpny4al   ivs s) Dtmu  nt4aet  ictyt aDuluvpnu4 eeomo3tydoat ai olt  2xmxr ou1apee ncia()aDumxmp;t0alxnifciydlm2rmn ont4aleoxo3oydfaDe i i;t trxm(rpoo4ll e net t artaxmooo4tlxnif3ild a2uauvsn() lxoir3todlm  luesls)teur(mpno1lmtnmivs () rur(mpnu1tpt mieiadfsDrmuvo u0 rxoxo3ootop eli o t)srtrimpnudllenmncs (  Dtaumpoo4openifeiatfsDrauvs;u) rxnmrcootlm elnvi;t srtm(m3nydopt lictl(f Dumu pnt0tleo iciydfm emu o;t0aexoif3ty1fpD  n i;(0t2xoir oydopeemnct (fs2rrx p;t4opxo iciaslmDrmump;u4teeomoctodlaDrau il(  ruo(o oo1om elnetatfsDrm( poo4texo o3ils m2ra( o ()tlenxrciydlmDrliei ()t2trxrpou1lltemfet ( sDraxrpot0texoiieiat mDel(mo;t0 etoxr3iytfm  aneslt0truoxmpnu1omee fciasfsrua(rpnt1aptnmfcils sDeau s t4aetrmoctytoate u olt sruriopnudomen fei tfa2urxm ;o1aet iiciltfmDua( o;u4altoioctodlp  anes () ruoio3iodlp e ncsl()sDum(rp;u0teeniiciadfs2el(mon(4trenxr3oa1oa e i i;t s2toim3nodllt mfvilsfs2rr(r ou4tlx if3tysfs2rlums (0treoxr3oadlmt lnvils  2uoio3io1lp   nesls)srur( ont4texomf3tat sDel(vo;()arxnxf to1fpDr uvs;t srum(m oo4om nlivi ( aDtm(moot1oltnmi3ildlm ea(mo u0 lxrir ia1lmtrai sl()seuoir io1op  lieias)aDuaxm ;o1aptnioeilsfs2rlu p (4aetrxf3oa1omtelies;(0 rtrxr nudome  fctas)artau  ;t4aex mf3iysfs2eaumpnt0tetoxocoydom r nvi;()trtmxopoy1lp e nvs (  2uaxroot1tex mfetls m2umn pn() lerir iadfmtranvs s)srumim3oodop nmfei t s2taxr nu1tleo o3tysfa rmn s;t) etnir oadlp rauvs;( sexoim nudol emics ()aDtaump;t1altnmi3iatlmDrlu pnt0tetnxf oytlp  lieo ()t2urxr nodomtemnvi (  2tmx ont4altn feiyd a uanvon()trxrmr3iodlmD lu s t texo(mpno1aptemfes () Dtru oou4aeeoifetatls ua(vs t4tetomocoo1laDr u olt) 2trxo3oo1ol  mnvi ( aDta(mpnu0tptn oeiasfm rl( ont0 lxnmrcty1fpDeau s s)t2urim io1llenlneilsf Dtmu  ot1aexo fciysfa2em( p (0 rxoif oadom  lies ( seum(r3io4lme mfcs s  Dtaurpnu0oetnio3tydlmDua( s ()altoif3oo1op eaieils0texm(rpiydlpee fcia(fa2ra( pou1alt  i3tytfaDuln p t4altnirciydfpt anes;t s2toxr3oy1omtnlivtas aDtr(rpoo4tpxn iciadla umuvo u0trermo3ta1oatelu ilt srto(o oo1opt  nvi (faDur( p;t4aeto i3ildfs el(vo t)tltoioctydlptr uvo;( s2tmxm3nu4lm elfeia()sruaurooo1aeeo oetlsls eanvs (0texoxr3oadoa r neo s seumxmpiu1ale lfvs t aDua(mpot0tex  iciyt aDuaump;t) rxoxrciatfpDr uei;s0trtoxopnu4omenmnesa(f rtaum nt1tlt mietat sDeanmo;t0tlerio oatom eli ol( t2tmxr3nodome lneiat)srrmumpnu0tleoio3iltfa2eauvsnu0aleoxf3oodlm  livo;(0 rumirpnydol   fei t aDrm(  ot4oleoiictld mDelnmp;t)arenxr ty1fp raivi () 2uoiopiy1ale  fcsas) rtrxrooo0opt  feild a2ranvs;u0 etrmr3tatomDr ieo (0srtrxr3oodlltnliei sfsDrm(rp;o4oetomo3ilt s2rluvp;u0arxnmfcoatfp  ln ols) exmxrpiudom elieilt  2rmxrooo4tpx mfeiysls em( snu)alxoxf ootlm  anvs;()trxmxm3iudomenlivtat sDtr(mpno1oleo ociadls2ulu onu0texnircoy1lmtr ueil( trur(o3no1op nlneta() Dua(rpot4olxniictlslm uanvp;()tlxnmrctatfpte u olt0texmio3oy4al elivt sfa2ra(m no1aet miciatfm2ul(mpnt)tleomrcta1fm r nvsl(  rtr(rpnu4al emies (f rtrx pou1oleo fciat s2eanvo u) exomfctytfp   n s;s sexo(m3ou1lmt  fet ()s2rmx poo4tlt moeias aDrmnvp t0texomo oa1omD ai s;s)trtmxmpnydamtemneta(  Drr(rooo1opxniociys m ua( p u4 eenmrcoydoaD luvo t0teuoxr ny1lleelivils) 2ta(  ;o4tex  f3iltfs um(msn()tleniocta1latrlueil() rxmxr3nu4amte fviltfa2urumpno1aleo fetltlsDumn s t0altnxo oa1fp   u i t)srurxo3iu1opeemfeia()srtm(mooo0tpxo ociatlmDrauvo t4tltrxoctadomt liesl(0 exrir3nu1ope  ieslt  rrm( pnt4oeenmociytls2el(von(0altomfcoodlmDrai i s0s2urio iu4ome miet sfsrra(rono0alt mf3iaslaDrm( p (4arxrxo ia1omteau slt0s2tm(opou1lmt  nvil( a2ur( pnt4tpto o3iydfsDumn snt4 rtoif tytfmD anes;s texr(r3oy1op e fetat srtrx pnt1apxn ociydfaDrau o ()arerio iotfptelneo;(  2xmxo oodlm  lnct sfsrum( ont1tlt  oetaslmDranvs () reoir3iotlm  lu sl()srumxm3nu4lp nmncsat aDumu p;t0tpeo oetld s rmu s t4aeenxr ta1oatrlnvslt) 2urio3oodapenmieiasf Drr( o;t4aetoii3iasfmDul(vo t4artoio3iydoptrln sl()srxrxrpiodamenmfctls a2uaum ou1tex  f3tyd mDrl(ms (0 ltnxociytomtrln o;t)seurxo3oy4am e fvilt sDuru pnt0aetn ictas a2rmumo t0tltrio ta1fmt aivi;t t2tr(r3oodlpt  fcsatf 2tmxr ;o1texo ociys s2ea(mo t)aexnmf oydlpDrau o t0 exm(rpoydalte iciat sDtrurpoo1olenmi3tld mDul(mont)alerxfcia1opDrlnvi;(  2xrxopiydaltn fcilt s2rax p;t0alenmfeils a2um(vs u)arenio3oodfm r u ilt sruo(r3oy4llenlivtlt)a2umxmpou1tlt ifeiytfa2rlnvp (4 exnxf todfp rlnvs (0tetoxm oy4lmeemieils  Dtm(mp;t0oex if3iys a ean pnu4 reoxo todfa  anvs;t0trxoio oy4apt mivs s s2rm(mp;o1aet ioctatfs2rmu pnt)aleomfciy1opt  n o;s  rum(rpno4ome  fesa(fsrtax ont1tpx  ietytfsDuan o;t)trtrmr iotfa rlnesl() etm(r3oo4optnlfei (f rrm(rpnu1optomoetasfm rmuvont4teenmo ta1faD  i il(  etoxm iu1ole  icilt  Dra(r oo0aeeomictltfs el(ms u0 etnir3iy1latean slt  exmxm iu1apenlncsa( sDrrum ;u4tpe mfetys aDea(ms;t)alenxf iotlm e neo;( sexoxo io4om e nctl() 2raxm nu4tlx io3iatlaDel( o;u) rtomo tatomD  nvsls0seurir nodoptn nvsa(fa2urum ;t1oex  fctls aDulnmp u)alxriociy1lmt au o s0t2umio3ou1oleemnciat aDuru o;o0tltnifcilsfs rmumpnt)arenmr oa1opt li slt trxrxr oy1ol e nciltfsrum(mono1aee mf3tlslmDrau pn(0trtomrctatla raieils0 2xmiopnydlpen feilt) 2tax pnt1tpeoiictysfs2elnvs;(4tetoio totla  livo;()teumxopoo4lme  ncil( a2rmxr no0oltnii3tyt mDrlnvpnt)altoxrctodlat lu sls)srto(m nu4openmivi () Dua(mpnu1apto fcilsls2eanmpn(4tltnxf3ta1om   nvi;( t2xoir nydlleemnviat sDta(rpot0oeeo fetydfsDulumon(4tltnxo iodoaDe i i t0t2trio nodal  lnesat  Dtaur ou4oexnifcias mDeanmp;t0texrxo3ia1optrauvo;()srxmio nydom nlnvsltfartaum ;u0olto oeiysfaDua(vo;t) renmfcio1lmD lnvo;t  2toir nodal nmiesl(  Dum(  ;o4open ieild aDua( o;(4arxrxo3to1la eaneilt trtr(o iydllen nesat sDumu  nu0opto ociat s2emums u4aetrir3oatfpDrlieo () 2toxr ou1lmt lnct t)srtrx  nu4olt moeias a emuvsnu)arxrmf3iadfa   ivsl()s2tm(r oo4oltemfcil(fsrtr( o;u0aet ifeiadfm rmnms;u)trxnxo3tadlpDrlnes;s0sexoxm3oodlpee iei ()srtr(mp;t1tee ifeilsfs2rmnmsnt)artoxr oytom  aivs;t teur(m3iydoltnlfvsa( a2umx  ;u0optn o3tldlsDrauvp u4aetoif oytom r ivsls srto(r iu1omenmfes s)aDtaxmp;u0oleoii3iad aDuluvp t4aexnmrcoodop rluvi;t texo(r io1olt lics tfa2tmurpou4alenifeilt a elnvsnt0aetrmr3tatlp  ai sls0t2xmxr iudlm nlnes s s2rmu onu0apx mi3tlsfmDean pn() lxrio oatoateaues s t2xrxr3iodape  neiltfa2ta( p;o0oltomieils s2elu s t) leoxrcto1laD luvs (0tetrxo iydoptn netlt)sruaxr nu0texo i3iyslm2ul(msnt0tlxnmr oadfa rlnvo;t tetmimpoydlpee ictat)srrrumpou4aetoiociaslsDrm(vpnu)tlxoxr tadom  ai ol()sexmir3nydome micslt sDurx p;t1apt mi3iltlm rmn snu)altrir io1fa r nvilt0seurir3nodlle  ivia(  rur( ont4apt miciadla2eauvpnu4areoir iodlp   ivs;()t2uo(opoo4opee fvt t  Dumx o;t0aet if3tlt m2eluvp;t)trtomfcta1fm raivsl( srur(r3iydol nlfcs s srrm(mono4aexnmo3iys a uluvs t4teenmr3tydomDr nvo s0 exrirpoudlmt mfvs (  rumurono1alto octytla uaumpn()tlerio iy1lm rauvolt)sexoxm3nudopen fcil(fs2rmxmont1opto ociad sDrmuvonu) rtrircoytfaDrli o s0 rto(r iu1optelneias) 2um(r oo1apx if3tasfs em(vp;()arxoxr iodomDranvo;s0 2tm(r nu1alen nesa( sDumx poo4oet io3tltlmDumnmsnu) eeoio todfa  li il(0t2tr(m3no1om  lnvs ()arraxmp;u4oeeo iciasfmDuau o u) lxoxf3io1oaDr nvi;(  2xm(mpiydapeelfci ()sDuru  oo1ale mi3tasfa uln p;(4 exoxr iydfm eanvs ()sexrxr ou1am nmivilt)a2rru p;u4opxomoeildlm ua( snt)arxnxocty1fpD  ivi;t0setmir oudlp nlfvt (farrm(ro;u0ale mo3iatls ua( snt0 lenir to1om  lieslt0s2toxrpiudapenlfctlt sDum( ooo1oexn octltlm2emu onu0trxoxf oo1latr n sl(0trur(r3ny4lleelncil(faruru  ;o4altomieiysfm uauvo;t0 lermocto1lptrai o t0 rtoxmpiy4lme mies s)srtr(  oo0opxo fetls m2rlnvsnt)trxrif3oa1lat lu o;(0trurxopou1lmeelfcs t)sDtmxmpnt4apxn ieildfm el(mp;(0aetnmf3oydlatr ivslt)srtrxr nu4ll n ncta() 2rr(ro;u4opeomoctasfs rl(msnu) eerxf oadfmt  ivi;s teurirpnu4ale  ivias)sDurumont0alxoiociatla rluvs;t0 renmo3ootomD  nvils0 rxr(opiudaptnlfvs () Dtr(m ;u1open fciad m ulu s;t4tltoif ta1lmDeanesl() etmxr oo1olen ivsa(fsrum(ro;u4olxn ieiaslm2ean p t0aeeoifciadomt auvi;s0 rxmxrpny4op e ivi () 2umu ooo4olt mo3iysfm elnvont4aleoxr3totopDelivi;()s2toirpoy1ap elfvias srtm( o;o4olt ioetas aDrmuvsnt) lxnircootopt anvilt0 euoxo ny4ol elici ( srumxro;u1aeto i3tld mDea(mp u4 lxrio iodopt lies;s  rum(mpiodll nmici t aDua(  nt0olxnmfciat s rl(von(0aeenmociy1fmDeln sl(0tetm(o3iodlmee fesasf rrmu o;o4olt  octatfa2em(vo;t)aexrir to1latr nvs;s0teurirpiudal e fei tf 2tmxmoot4aptnmociyd sDeanvp (4aetoif oatfpt ai o s)s2to(rpoodlm   ivslt  2tm(r nu4tpxoiieiatfm2eau pnu4tltomr ootomDeau o (0trumio3no1ll e fvtl( s2tr(ro;o1tlt ifciasfa rmuvs;t)trxnifcoydfmD li ils0t2ur(m oudol  lncsatfs2um(  ou0aetn ociydlmDemump;() rxnxrctotfp   n o;s0s2tr(mpoydlme mfci t s2rmur no1aet ifeiad m2rmu snt0aeenxr iotfmDe nvsl()s2tmxm3no4lp   ivsa(fa2um(moot4tpeoif3ias s2ra( s;t)tleoxocio1opDrlu ilt seuoxr io4apee fei (f Dur(  nu4ole moctatls2uaump u)treoxrcio1op raivo;s0trxmir3io1omtnlnvsltfs2rmu  ot4tpe miciatfm rluvp;(0trermr3iadom eluvols0texmxo iu4lm e fesa( s2trur ou4apx io3iydls umn p u0tlxrio tadlmDean ils0seuo(m ny1ll elivsls) 2rrumooo0openmf3iasls2ran pnt4 lenxo iydfaDraiei;(0trur(o oudom   fct sfaDraurono4aet  ictysls eaump;(4 ltoxrcty1faDelieil()texr(o iy4ap nmnctat s2uaxmoot0opx ifeilsfa emuvonu0tlxnmfcoydop eaues;s)srxoio3nudol   ieilsfs2rr(m nu1opx mfciasfa2eaumsn()texoxocia1omtelneslt0t2um(o no4om e icia( sDraxr nt1opx iociaslsDulnmp;u)arxoif oo1latelnvs s0srumir3io4al  lfvsl(f Dtrxmonu1tpt  i3ildfs2rmu onu0aexnir oatla raies;s) rtm(m iu1ll   fcs () rtr(rp;t1texoif3tyt m ra( pnt0 exrif ia1lat luvi t  rxrim3iy4ap  liet sfa2ra(m ;o1oleoifeiatfm2ulu ont4 rermocty1fptr iei t0t2um(o3nydopeelfvil()sDrmxroou0aetn ociys sDua(msnu) exrmfciytoa e i o;(0 rxmxr ny1amt lnet s  2rm(rp;o0ole  o3tadfmDul( s;u4aeenio tatfptraivi (0 exmxr3nu4aleemietas  rraxmonu1apeo oeildfa umu s t0 exnxr oy1omD anvol( srtrxo3iy1lptemivi () Dtrxm ou4aex mo3tys sDrlnvp u0artoifcoadfa eaiei;s0t2tr(r oy1olt lfvs ( arrmu  oo4opxnii3tytla uau s u4tlxnxf3to1oa  lieilt t2tmio ny1lle lfci sfaDumu oou0aptomiciytfa2emnvon(0 rerxo oodoa  luvol(0srtr(rpno1omtnmnei sfsrrm(rp;u1alx mf3tytfm2uan o;u)altniociatfp e uvi s0trxmxr3nu4apeelfvi tfs2uru  nu0oltn i3tytlaDrlnmont0 eermr tadlatr nvi ()t2uoio3oo4ll n fctas a2ur(rono1tlto ieiat mDranvp;(4aetoiocia1omDraues;s0tetrxm oy4apeemivsas arurxroou0tpe  i3iadfa2eln s () rxnir3iytfmt  nvi;t tetoirpoo1alee ics (  Drmx ont1tpeoif3tas a2rmn p;t)trermrcty1fpDeai o (0 2ur(mpiu4apt  fes s)srta(  ou4ope mieiytfa2emu s (0altrif tadfm eaueils)trxoir3no4lptnmfvs sfs2umxrpou1teeoio3ias s2el( on()aetrxocty1oa  aues;t s2trxr iy1omtemfetat s2taum ;u4olxnmicias a2uauvo;t)alenxr iatfp  aiei s) rtrimpoydom nlfet tf 2ta(r nt0apxniieild s2el( pn(4tetoio3iytla  li o;(0 rtmiopny4aptelieil()srrrxmoou0aet mfeias s emnms;(0altrxrcia1fpt  n s t) 2umxm3ny1llt mnvi tfaDrmx ooo1olx micias a2umums;t4aleomo io1la  auvs;(0trurim oodale  iesl(f rrauroot4aleoio3iad mDeauvonu4 rtoxr3oytfmD aies (0 2xm(m3iu4lp  mfcia()sDrrur ;u4tpx if3iysls ul( pnu4tlenxr to1oaDe neilt0srtm(m3iu1lptelfvs s sDumx pnt4ale  fcildfmDem(msn() exnxf iatlmtran s ( s2trir nodoltnmivtltfs2rru  oo0texn o3iat a raumo t0 exrxocoo1lat an ils  2xr(rpoo1olt  fes s)a2raxr nu1aeenioetadfm umnmp;u)arxoxr io1lpDeln ils)trxrxrpiu1oleemivtlt)s2tmum ;t4oleoiietasla uanvs;() rxoif to1oaDr nvs;t)srxoim io1llt  ncilt)sDur(  ;u0oetomieiydfm2eanmo (4alxoio tydlatrlnvs t)s2tm(opoo1ome micsl(f rtm(monu0tlt  fctasls2rmn pnt0arenmo3oatlmDe n i s0sruoxo no4lmenlnet t) rtr(r oo1oex  i3tysla rmn p;u) etrxfctydlpDe ivsls  ruoxr3iy4lpt  ict t)srta(m ;t0tet  ociat m2ulnvsnt4trtrxf3ty1lmDrlu i;t0 rxr(o iudomt mfvi sfsDum(  oo4texniociatls em(mpnt0tlxomocoydfatr uei;s) 2toimpiydapt  fctlsfs2tr(mpou0tlx  ietysfm rauvo;u0alxnmocoytfpDe neil(0seurimpoo1apt mfes tf rtm(r ou0tptniociasls2um( onu0texoxoctodfp rli s (  etr(r iu4open fvil(faDtr(moou1apeomicils a ua(von(4 rxnxf3todfpte n olt) eumxm3io1oltnmfes s sDrmxmo;o4oee mfctld m rmuvp t4alxnxo3iatfmD luesls0 etoxm3iudoltemfcs sf 2umuroou1aex mi3ildlsDuanmo u4areriocta1lmDranvils)s2uoxm3oy1omenmncsat aDtmxm ou0tlxoiociytfm2uaumsnt)aeermrctytomtrlneolt0t2uo(r3iodal elnctat s2trx ono1tpt  oetlt mDuanmonu0 rtnmrciy1omDraieo;t)setr(mpoy4ape lnct t  Dta( onu0opt moeiad s ranmp (0aexrmo oa1fat  i sls)s2xoirpiu1op n feia( a2ta( pou4alto ictytlm2umuvs t4trerif oodfp e uvil()s2uoir3oo4alen nvtlt  2umxr ou4oetomictyd sDemnvpnu0tlxomrcia1op r uvi s0s2tmxm nudlmtelnetlt) 2umx onu1aexo f3ilslm rl(vont4aexnmf3oo1fpt  nvs;t)t2xr(m ny4lme lnvsls  Durum nu0oetomfciasfsDuluvonu4alxrxfctydlm raivolt seum(r no4ame  fetasfsrumum ou4aleomieilsfs2uln p;() lxomfcio1opt anvol() 2urio io4ll   icsas  rtrx  ;u0opx  fciasls2ul(vp u0 eerxr iytfm   ivo s0 rtmxo oudap  mncs t s2uru  nt0opeo fetltfa2eaums u0tetrxociadlpDrauvolt)t2uoio3no4lmee ivil()a2ra(m nt0apeniictlsfs2ulnvs;(0aexrmr iodoa ranvo;s)t2toim ou4am e fetl(faDum(r ou4aptnmfcils s2uauvo t) exomfcoa1fa e u s;t) rtoxopoydolenlfvt s)srrmu pou0oetomoeild s2rau sn(4 rxnxr iydfmD aneslt seur(m oo4apeemies sf 2tru oot4aptnio3iatlm ea(mo (4 etrio3iodlmDelnes;(  2xm(opnudolee fvsa(f 2raurono4aetoifctltlsDrmn sn()aexoxr3oatlat li i;s)s2xoio iu1alee ncs sfa2urumpnu4apeoifetls m2umnmo t0 leoxo3totoat  uei;s  rxmiopny1ope licsl(f rta( pot0alx mf3ias a2rmn o u0 eerio oa1lptelu i;t)s2umir3no4llt mfeta( arrm(  no1altnmociad a rlnmo u0tetrmf oy1lm   n s s0setr(opio1lme mnctltfsDtmurpoo0opxoifetltfa2ua( s;u4 exrmo3oatlptrlu il( s2trim3ou4lpe livs tfaruru oou0tet mocilsfaDulnvsn(0 rtoxfcta1lpDe ieo;()trxm(m3oo4ap nmnesas a2tmxr nt0oee ii3ias a2um( o;()texnxf3oy1oatr nvi;t) exrxmpio1amt mivi sfa2um(m ;u0tpeoio3ilt a2uanvsnt4 eeomociy1fpDeauvs t)t2uo(m iydll  licilt) rtmxrpno0opto fctydla2um( pnu0 etoxo3tydfpDeanei;(0trur(mpoudolen fvtltfartm(root0tptniicilslm uau p u4 etrmo3tatlm r ivi;s0tetoim ou4lp  mfes (f rururo;o1ape iociad s ra( p;(0 lermfctodopt  ivi t0truoxm oydalen ncslsfa2um(mo;o0alxniieiyt sDel(mo;(0 ltrxrciytlm elu sl(0seum(r iu4ll nmfvt ( arrrxro;u4opx  fciyslm2eluvsn()alxrir oadfp  an i;(0 rumim3ou4omtn iei ()arrau pno1apxn ocils a2elumsn(0trxrio oadfpDrlnvs t0 rtm(r3no1ome lfei t arrrxro;t4tpeoif3iyslaDrluvo t4 rxnmfciydlmt  nvsls0s2tm(o ou1lpenlivt sfaDrmx o;t0aetomf3iysfs ulnmpn(4 lenmr3tatopt lnvi ()srxr(m io1apeemncil(f rtmumo;t4aetnmietls s2rlumpnu)aexrmfcootop rau s s0 etmir oydaptnmivsas artax ont0tex moetysfa eanmpnt4teenircia1fat aivi;() rxo(r no4lp  lfeiasfa2tau  ;o4tptniietas a2eluvp;(4 exomfcoytfptrlu olt) 2xoim3oo4lp nliesls aDur( p;t0opeo o3ils a rmnvp;t0 exnir tadfmDelues;t  2tmxm nu4ll elfvsls sDtr(rpno0aetomocilt m2ua(vo t4 etoxr3todfpt livilt)s2uo(mpiu1lmt lneia() 2raumoou1apeo fciatfaDranmp ()aexnircio1lmtrlivils)trtm(r nu4opeelfcslt)aDraxroot4olxoifcildfsDrluvo;t)treomo oo1om  anvi;( t2xoxm3oydal nmneta(f Dua(rp;o1alt mf3iydfa2ulnvp;u4 reoxrciy1laDeau ilt t2toim3iodlle lictasfsDrmx  ;o1tlxomi3ilsfa2ua(vs;t4 lxoxf oatlat  ivol(0 2uoir3iudapen fcsls s2rr(m ;o0aptnmieiadls ul(vs ()artnmo iy1omtrlivsls s2xmir3oodap elnvta()sDtaxrpou4ole ii3tat sDrlu s;u) lerxf iytlpDeln sls  2xrxopou1lpe mieta( aDrmxrpoo1oltn i3tyd s emuvsnu)aetrxrctodfmteanvo s s2xrxo3oy1opt mfcsltfa2trxrpno4teenmocils a2emumo ()aexnifciytlm r ivs;s)s2tmxr3iydame  fci sfarururpnu1tltnmfeiatlmDumn s;()arenmrctytfaDeaivi (0s2xr(opiudll nmnesl(fsrraurpoo4opeo ieiatla2ua( pnu)treoxr3oadop  li ol(0trxmxr nudlpt  ivt s)s2tmxrpoo4opxomfctaslm uluvsnu)arxoxf3oytfp   nvs;t0srur(mpiu1omtnlietat  Dta( pnu4alx  o3tytls uaums;t) rxnxf3oy1fpt aivs;( sexrio3ou4lm  lneta()arrmu  ou4alx  fetasfsDulnvp;t0aexnmo3ty1la  aiei () 2xo(opiydap nlfcslt s2tmu p;o0ole  i3iatlaDelumonu4altnxo3ta1fmDr n i s trxoio3nudope micsa(fsDtaum oo4tet mf3taslm ul( pnu)aetoif oatlmDe n s;t s2trim3oo1lme mivtas)s2taxr nu0ape iieildfa2eaump u4 lenmo3ty1lpt  uvols  2xrio3oy4lp emieiatfarumurpou0apx ioetldfsDrmnvp () leoio3ootfmDelieolt0t2xrimpoy1open fctltf 2umx pot0teenmoeiasfmDumu ont) leriocty1laDrluvo;s0trxr(rpiy4llt  fvsas)arururpnt0tet mfetadls2ua(vs u0 lerioctytfa   nvsl()seuoio3ou4ome mfvs ( srua(rpnu0oltoifeiadla2ul( p;(4 lenxociydlaD aivi t) 2xoimpno4lp nlnctls) Dua( oot4tlt  octadls2ra(mpnt)tetoiociytoa rauvolt) rurim oodlpt mnvt sfarrmum ;t0ape mfciltlmDem(vp u4trtrxf io1opD ln sls)srxmio3iu1lm n ieia()aDurxmono0opeomiciysls el(vp;(0teenxf tydlptr ivols)srum(rpiydlp nlfvtls a2um( ono4ape mi3ild a2el(vs u0tltriocoodlat lueo ()t2um(m3iudopt mnetasf rrrx o;u1tleo i3iytfaDeauvp u0tltrif3oodfmtelnvi;s seto(o3ny1aptelictlsf rtax p;o1apxn f3ildla2rau pn()texomf oydoa eauvs (0tetoxo iodome mfvsasfsDum(  no1optoiictasfs ul(ms;(4aleoxoctadlpteauvo;s)texrxrpoy1lme  fci s) rrm(m ot4optomf3iatfs2um( o u4tetrxr tytomteli o;s)s2uoim3oo4alen fciltf Duax o;u1oleomf3ildfs2elump u)aexrmo3tadla eanes s sexmio3nodlm   fes t)s2rm( oot0aexnio3iytfm2ulump;(0aetrxf3oodlpte u s;t teto(m oodlmeemnci t arrmxmo;u1altnmietlt sDrluvsnu0trxnxr3iotfa rai s s0 2urxr nydalenmnesls aDua(r no1tetomi3tytfmDel(vsn(0aetnmr oytop   u i;t  rum(o3oo4amen nei s srraum no4olxn ociyt aDraump () etrmo3oydlptrlueo s srurxr3ny1lptemnvtlt s2ra(mp;o0ale mo3iltfa rau ont)alenif3oadfm r ues;s  2uoxo3ny4opte ivsas)arraxmoou0olen iciyd a uluvpnu) eenxfcia1fmteaieilt0trumir3oo4ll  lnei s)artm(mp;o0oex mfeiytfmDeaumo;u0 eeoio oy1fpt lu ol(0s2um(mpio4lp n neil()srrmx  oo1opt mfeias a ulu s (0tetnxf tydfptrauvo;s)srxoxopnu1altnlnet ()a2rm( poo1altnmf3iltls2eaums;u)aetnxrciydlm  luei t  rxmxr3iydalt mfctl() Drmx  ou4oltnmictasfsDrm(mpnu)texrmr ty1lmt livil()s2trimpny4ll nmnvtlsfa2ra(ront1ape mieilsfs umuvp t0 rtoxfcoo1fp  aueol()texoimpio4lpe mies s  rtau oou1apt moetlsfa eau ont)texnmr iydfptean i s srur(mpiudlltn nvsl(  2uaxmpno4olen fctld s2rau p;u4 etnxrcoadfm eaueslt0s2urio3oydlle  ivia(f 2uauro;o4tet io3ildfa umn sn(4arxrxr3oytfateluei;s srxrim3ny4ome mnvslt) 2tru oou0alx  i3iatlaDra( p u4 exomf iatfaDelivils)texo(o iydol  licilt  Dta(moot4tetnmfctydlmDemu p (4 rtoxf iydfp eln o s  2ur(mpiu1omt liei (fa2tr(r oo1tlxnmoetld a2uau s t4tlxnmfciytlaD li o;() 2xoio iu4lpen netls aDrrump;t4tleoiieiydla rmnvpn(0tetnxo3oytfpDeai s;t0texr(m oy4lm nlnet t)aDtmxrpoo1texomoctyt mDuan snt4 reomocootlat aieols)seuo(o no4omtelfcsa(f Duaxmo;u0aptoii3iasla2rluvs u4artomo oadopDe ues s)teur(mpnu4apte ivtltfarrru onu4aptomoetls m2ul(vo;u) rtnxo3oy1opteln s;s)texm(opiy4lm elncsl(faDrr( ono1tptomoetasla2eln o (0trtrxr3oodoate ivolt trxoim oo1alt lnei t aDtrx  ;u4olxoif3iyt m uaums;() renxo3oadfp rlneo;(0 exoxr io1lm   ieias  Duru o;t4aet mf3ildlmDelump t4 rxnxocta1fp eaies;( trxoimpoo4al nlfei (faDtm(rpou4aexo o3iasla rlu s (4alxnif3tytfateaueo ()texrxmpiydllen ivtlt)srrmuront1oee ioctldfmDra(vs;t4arerio3tadom eln ilt trtmio io1am e fet ()arum(root0tpeo i3iyd s2ra( o;u)altomr3oatoat li i;() eurxm iodlpt  ivils aDtrxmo;u0oeen i3tld s2eauvsnt) reomf iodom rlu i;(  2to(opiydllen fvt s sDtaxrpoo0tee iieiasfmDr
\ No newline at end of file
@@ -0,0 +1 @@
+uei t sexm(o3oydaltemics tf 2rmur no4aetomi3iytlm uln on(4aeenifctatlatrauvs;()seurio iydlpenmnei ()srtmx p;t1tptnmieiytfaDul(msn()trtrmfciotlateaivi t)trxo(mpoo1lp e fvia(f Dta(rpno0tlt  ictydlmDrmu p;t0alxoiocoydlpDe u o ( texmio oydap e icslt) rta( o;t4openmfeiysfs rmnvpn() rerir iadfpDrli o;t teto(opnodopenlfci sf Dtaxmo;o4aet io3tadls ean s ()artoxocia1faD  n il(0truo(mpnodopt mfviatf 2urum ;u4oleo f3tysfs ulnvpnt0tlxoio iotopD anei;( s2toxmpoudlpt lnvi ()a2tmu pnt0tptomfeiadls ulnvpnu4 exnxo3io1omD aivslt0seto(m3oo1llen fctlt) Durum nu0texnioeiydfs2umu p;u)tlxrir oa1om rlies;(0srtrirpiy1op e nvsltfsrtrxm ot0opeomoctltfsDea( p t) exrir3oytfa r u o;t0trxmirpio4oltelnvil()aDtr( o;t1tpenifeiys a rln p;(4teermociodfate i o;s) 2xoxopoudllenlnctatf Drax  ot1tle mietas m2emnms;u0 rermo ia1fp elivi t0trurxo iydop  lfeilt)s2uax ooo4tlt  ieiat a2uln s;u4 renir to1lm eluei t) 2xrxmpny1lmtnmfctltfsDtmu p;u1alx mf3ias a rl(mp t)tetoxo3oytomD  n ols  2uoirpoy4ll nlfvt tf Dtm(moou1aexomi3iatfs umump;t) renif oy1fmD liesls s2xrxm3oy4ale lnvi (f rurx  ;u1olx mo3tysfa2eln p;()alxomo3tatlaDr iei;s) 2toir oy4omtnmfviltfaDtaxm ou1teto feilt sDulumo;t) renxr tydopt livs;t trtm(m3iu1opteliesas)sDuaum oo0oee mfetys sDeluvs;u4texrxrcoatoaD livi t)trxo(r3iodale  iet (fsrumx oou1tle mfciltfm2um(monu)tltoifctatlpDeanei s0 rtm(opnodlm elivias  Drmxmoou0oleoioeiysfa2umnmpnu)trxoir io1fp e uvslt)s2tm(r3nu4am elivt (fsDtr( pou4tpeo ietlsfmDrl( s;t0treoif3ta1la elieo;s)sruoir nudaltn feta()srrr(roou0oeeo f3ilt m2ran o;()trenmr iy1om eaues;(0 rtmxr no1lptnmnciltf Drm(rp;o0opxniieiydfa ulums (4artnmr iy1lp r ueo ()setmir oudlmtnmivil(fa2uaxr nu1tptnifetlsla2umnmsnu)trerircio1oateliei ( texo(r3ou1ap nmfei s  2ta(mpnt1tlto feiydlaDulump;u0arermf3oatom eaueo (0teum(r no1lme  nvslt) Durxmpou1oetnio3iadla em(vs;t4tltrxo iytfat  ivi;() 2xmirpiu1ole  ieta()sDtm(m ;o1tlto ieilt a emump;t0tltrio3tydla raivils)srxmir3oodap elfvtasfa2raxmooo0tpe mieiytla emump;() lermr3oydopt lnvslt) exmxo3ou4am  mnetl( srrr(ront4oex moetltla2rmnmsn()trxnxr tydfptrauei ( tetm(rpio4alen nvs sf 2rau onu1opto octlslm umnvpnt)aexrxfciydoatrlivs t teuoiopny4lm nlnvsls s2umxmoot4olxo oeiadfs rln s;t4aetrir to1omtr i o;t t2xo(r3oy4amtn fcils)srrm(moot0texo ociyd a2uau p;(4aetoxocoydomt ln s;t0t2tr(m iudllen ics t)sDtaxro;u1tlx iicilsls2ean p;t)artrmfcoatlaDeai s t0s2tmim ou1optnlnvia() rumu oou4altn ociltfsDuanmp;(4 lxrxr3to1fmteaues;(0teurim3oudlpe  ietls)sDtaxrpno4tpxo o3iat aDra(mp t0 rxoir tytfp r ivslt0srurxr nudale  fvil( sDrmu  nu1tpx ioeiatfsDulnvpnt0 exrmocoydopDr n slt setr(m no1am nmnetl(f rtr(mpnt0oexoifciatlm umnvp;t0trxnxf todfat aivslt trxoiopou1olt lnctltfsrta(m no1alx iieiatlmDemn s;u) eeoio iytlat  ues;s  2xmxopiudlltnlietltfs2tax ont1tlen ieiad sDem(vo u)artoxf to1fateanvsls) rtm(m3oodapen ivtlt  Durum ;u1ope iictat mDuluvs;u4treomr3oodlmt  iei;t s2xr(opiu4al n fcs (f rtmumo;t1teen ietlt aDum(vpn(0 exoio iodfa  an o;t)setm(m3nydalee nct t)srumum no1aptniieiasls rau onu4alermr ia1la rli o ()t2umxr ou1apt  ictl() Drrx pnt0aex mo3iatfa2ra( o t4 lxnxfcoadlmtranes t)seum(o nu4lmeelivil( sDrm(rpoo4tpxomi3ilsfs umnmo t4areoxr3iadom elieo;s)trto(m nydal emnetltf 2uaur nu4tltomictltfa2rl(ms ()altnmo3ta1fat  ivs (  2umim io4om elieiatfsDraxmo;t4apx mfeiat sDulu p;t)arxrxfciatlatr ueolt)s2tmxopoy4lme  neilt)sDuau  ;u0tlx  icias m umnmpnu0aeeoxf oydfatraieo s t2umio oydlle  ici s) rurxront1apto ociyt sDemnms;u4trtnio3ty1la   i i (0srtmxopou4apen nei s) Dumxr ou1alxn f3iydla rlums;(0artnioctotoatr nvils)truoirpiydolte neiat sDraum oo4oltnmoeils s2um( pnt0 rermf iydopteauvi ()setm(r3no1ol nmfvi sfsrumx  nu1oexomfctad aDrlnvs;(0 rxnio oo1fpt  uei;s0 rxrimpnu4ol   iet s) rtrum nu1aeeomfetydls rluvs;(4tltoxrcia1lmD li s s s2toxm3iy1lltemfcslsf Dum(rpnt1tlt mietldfa umu ont4 lerxr3to1la  aues;t)trurxr3nudlm  licia(  2urx pot4olx iiciadla2ea(vp t4teerxfciadfpDranes t)tetoio3nu1lleelncs s  Dta(m ;u0tleomietls mDumnmp;t4 rtnir3tadlp   n il(  rtmxo3no4amt  nei (fsruau ono1alxo oetltfsDumuvo u4 etnxo3tatfmDran i;t s2uo(r3no4am elictlt  rrrump;u1ale  fcildlsDelnvp u0 ltrmo ta1oat  i olt0trur(opoodop elfeias) 2ra( pou4apxo fciydfa elu snt)trtoxr3oodfmDeaivs;() 2tm(r3iydomee fctlsfarta( o;t1alenio3tlslsDul(mp;u)tltnio oydfatean o;t t2toir3oy4oltn ietls)srtm( o;o4oexnif3iydfmDrl( o t4 leomr to1fp rlu i s seurio nudopenlnvi s  2rmxm no0alxomoctadfsDelumpnu0altomo ty1oaDrli o;t setm(m3ny4ol elnvt sfaDtaum nt4alxn f3iyd mDrmnvon(0tetomrcoytopDrau s;(0tetoiopio1lpt  iciasfa2ta( ono4teen f3iys s eluvp u0aeenio todfm   u il()srtoxmpny1om nlivs t sruru ooo1ale mietlsls2eaumo;t) lxrmo3iodfm  au i s0truo(r3oo4ol  licil(  2rmumpoo4tet mociltla um(vsnt0 ltrxf3ty1faDr ieo;s)srxo(rpoy1op  mnesls)artm(rpnu4oetomfciytfaDrlnvsnu4arxnxr todlmD aneo;s t2xo(opoy1omt mfvtlsfaDrru  ;t0oet mfeiydlm uan s;u)trermf3ootoatr ivs;(0 2umiopnu4olenlivsl() rtr(ro;u1apeomociadfm um(vp t4artnxfctydfatelues;t) 2umiopoydoleelfvs s a2ur(m ;u4oleo fcias m umnms;u4teeomo3tadfa r nvi;t)tetrxo3iydol nmivsas aDraurpno1oltn iciltfm rlumo t0 ltnxo oytfm eliei;t0truoimpou1llt lfesls sDuaump;o1aetomf3iyd m2emn ont) exoif3iatomtr neo;s) rxo(o nydom  mnvsls aDtm( oot1tlx iieildla elu sn(0aleoxr3todfpteaueo s s2tmimpoudamt mfciltfsrua(rp;t1tpt mieilslm eanms;(0altrio3tydfaDr nvo s) rurimpnodlp n fci sfs2ur(m oo1ale io3iasla elu s;(4arenifctytfmDeaivs;( s2xrimpou1ole miesas) Drmxrpnu0tpe mfciytla em(mp u4tlxnxo tatfa ranvo s0t2ur(r3iu4al nlnet t aDumu poo4tpxomoctas aDemnmp;t0 lxomo3iy1laDrli s;() rurim oudlmt lnetls)arraxr nu4tpxniieildfmDem(vpnu4tltoxo3tydopD ln ols0s2xmim iy4al emfcsatfaDur(r nu4alt ioeiat mDuan o;t4tetomfciytlaD livo;s teuo(r3nu4lm   fvslt)sDrmu ooo1aptn o3tlt a um(vs;t4aetnmocto1fmDeaivs t t2tr(m ou1omeelicia()s2rmx poo4tpxn fcias mDrmuvp;(0alerif3ta1lmDr u i s0t2xoxr3oodalt  fetlsfs2ua(mp;t4optniiciyd mDuauvon(0trtoxr to1om  liei (0s2uo(opiudamtnmieia(fs2rax  no4apt mi3ilt aDrln snu4 reomfcoydfatr i sls texm(o3iu4lp nlfeilt a2urur ;t4opt  i3iadls ua(vs u)aetnio iodfmt  n s;s0s2trxm ny4lp  mivsltfs2tmu pnt0tlxomictaslaDulnvo (0trxnmocio1lmtrlnesl(0 etr(m3oo1alt mnciltf Dtau  ;t4tpt iiciytfa um(mo;(0 rtoxr to1latr nvo;()srxo(r oy4lptelfvtasf Durum ot4tpxnifetyd s2em( p;(0aetoif iadfmtelnvsl( t2trxm iy4omtemneia(faDtr(r oo1aptnii3iatlsDemnmp t0 renif3oydomteli ols) etrxr3nudam emicslsf rumx p;t0optnmo3iadls rm(msn(4tlerircoatlaDrau il(0t2trxr oudlmtnlfei s)a2trumono1alto ieiys mDrm(vp t)texrxr3ia1om rluei s0srxr(mpiudol  lfvi t arururpnt1olxomoctaslmDrlnvp (0 etnxocoadlmDe n i (0sexo(m iy1am emiei sf Duaump;t1olxn oeiad m2rlu p;(0tltriociodopDe uvils  eumxo oo4oleelicslsfsrururpno1optn fcildfaDum(vp t)trtoxoctytlp  luvo s tetoio3ny4alenmiviatfsrum( oou4tlto ictytlm2rl( o ()altoxo3oa1faDeanvilt0 rtoxm nodomtemfvs (fa2raxro;o0tet ioctyslm el(mo u0 exoxrciy1fpDraieo;t  etmio3nydlme  ict s) 2ra(mont4tltnio3ilt m rln o;t) eeoxo tadla rai i t) euoxr io1op e ictat) Durxront1oetnmictydla rluvpnt) rxoxrctydlp e ivi t)sruoirpnu4aptemicslt  Durur no4tpxo ieiytlmDrl(mpn()aeermfciadfa rauei (0srxrir oodlme lnes t) rtaxrooo0tpen feilslm elump;t) eerifciytfaDeln slt trto(r iodape  nvs (fsDurx pou1ope mf3ilsls2rmuvo;u0tltomf3tadla  aues;(0t2umxo nu4ope mneilt) rururpnu0alt  feiadlm2ua(vs;t4artrxr3iy1fpDrli sls0 2xrio3oodlm nmfci (f rrm(r ou4alt  f3iydfs raumpnt)tlenxrcio1oaD lnvs;(0s2uoxm3nu1ole  fcs t aDraxmp;o1olenmoeiytfa2eauvs;u4aexoxr oytomtelivo ( trumxmpny4lp nlfes s  2taum ;u1tpxoiicildfs2ra(vsnu0areomr3oy1latelu s t0 rxm(r3oy1openmnvilt srua(r ou0alxomieilsla2emu p;()tltoxo oytomDr nvi;s0 rxmxr oo4lle  ieiatfsrtr( onu0openiicilsls2emumo;u0trtnxfcootom  li il(0texrim3no4om   nei () Dtr(rp;u0oetoiociltfm ranvs;u0trxrxr3tytoat aies s  2xoxo3io4lp e fvta( s2ta(mp;t1oltniicildla ea(vp u4 ltnxo oo1la  lieils)texoirpnu4omt mivta() 2raxr no4aetnmfeils sDem(mon(4arerif3iadfa eli s;s0t2xr(o3iydap emnei t)s2tr(moot0tee mo3iadfs2rl( ont4 exnxr3oadfa eaivil( t2xo(rpio1lmt  net tfa2urur no1altoioctadlsDeln snu4 eeomf3ootlm  lnei t0 rumxr3io1ole  fctl(f Dra( pou4apt  oeias aDuauvont) lxrifciydlmDrln o s)trxr(o iydapte iviasfarta( pou1aexn feiatfaDeau s (4areomrciytfateluvo t srtoxo nu1alenlfetasfs2tmuroou1aexoioetys a2el(ms t0arxnxrciodomDeauvo;( s2xmxr3nodame  ietat) 2rm(rpnt0tltniociysfs2rl(vs;(4 rtoifciytfm ean o s) 2xmxo ou1aptelfctatfsrtrxmpnu4tetoiiciyslm2em( p u0texrmocoytoa e i o;s s2tr(o iu4lm emics (f Dtr(rp;u0oleo oeiyd m2rmumsnt4trtrir3tatfpteaivi t)t2umio iu4aptemnci s)aDrmurpnt0alxo f3iyd aDel(monu) ltoxo3iytfp e i i;s0srxmio3iydamte ietas  2urxmooo0tltnmfeiasfs2umnvs;u)trtriociotoaD an o s)srxo(r oy1op emncsas) 2rau  ou0opxomfcilt s2eau s;t) ltoir3oatlpteluvsl( s2xrxm io4omte ivt t)a2taxmoou4oex if3iysfaDea( pn(4teeomo3iotlpt luvs;s s2trxopno4ol   fvia( artm(roou4tle ifctld m emu p;u0tltrif oa1lmtrlneslt setoxrpiy4opt lnvs t) rtrurp;t0tlxomf3iydlsDemump t0texnxf tatfp eaiei;t teurimpoy1lm  lfctlt  Dtmurpno4apx if3iysfs2em(vp;(0aetnmoctotoptr nei s)trto(opiydomtnmnvslsf 2umumo;u1tptoio3ils aDea(ms;(4 eenmociatfatr u sl(0sexmxrpoo1lpeemncil(f 2taxrpno1tlxn oeiaslaDulu p u0 rxrio3tatoa r uvs;( s2xo(opny4om nmncia(fsrur(m ot4aeeomociltfm eau p (4artrxo ia1la  ln s (0 eumxm3oo1apee ncsl(f 2rrxm ou1tpt ioetas m2emuvo (4tlxomr3oatfmDeluvo s0 euoxm3io4apenmivi (fs2ta( p;t0oltn ietadfaDuluvpnt0trenmf oydlm rluei t0teurir3ou1lp  licsltfa2uau onu1tlxn i3iysfm rl(mo;u) reoif oytla r u olt0 rxm(r3ou4lmenlnet (fa2rm(mo;t4texoii3tatfsDrmuvsnt)tlxoiocoatfmDrluvi;( srtrir ou1llenlnvsatf 2tm( o;o1texoioeiadfm2umn p;u)aleoio3tydlm   ivsl()t2uriopnodalenmivsl()arur( ooo1tlen o3tatla ran pnu)tltoif ia1op  an o t) 2xoir3nu4amt  fvias  rrm(rp;o1tpto o3tldfmDemnmp;t) leomo3oy1laDelnei;s)tetr(rpou1al e nvsas sDtax o;t4oeeoiocilt a eanmo;u0aeerio3oytlpD auvi;t s2xoimpoy4altnlncias)s2trxroot0apx if3iydfm2ua(vs t4aexrifciodlaDeanvs t  exr(m nudoptemnetl()aDumxr ;t1opt  o3iatfs uaums u0 eeoxo iydlateaueils sexoxr3iu1amen ictas)arurxro;o4tlxomo3iysfmDea(mo;t)aeeoxf3oadfa  luvi;t)trtr(o ny1llte ivtasfa2tr(r nt4oee ii3iysfsDul(ms;(0 rtrirctydfa e nvil(0 exm(r3nodoptnlfeias)aDtmxrp;t0ope  fctld a ul(vo;u0aeerif3tadomte ivo;t)s2xmim3ou4amtnlieiltfarurx ooo0apt moctyt s2elnmsn(4texomo3to1oaDelieslt)tetrxo ou4lme  nctl( a2umu  ou4ale ioctys aDulnmo (4tetoif3iy1fa eauvs;t)setrir oydlm nmivt sf Duax pot1optn f3tltls2umn pnt0texomo oadom ranes s)t2umxm3io4aptn feslt  2taumonu0oetnifciytfa2uluvo (0arermr tydlat aieo;( t2tr(opiy1olee iesa(f Drm(  ;u1ape ifetadls em( s (4 leoxr iatlp   nvil(0srtoim io1ome  nvilsfa2urum ot4tet micias m el(vo u)alenxrctodoaDr ivi s)sexo(rpio4aptnmncsl()s2ur(ro;t0tetomfctydla2rln p;u0 etnio iotoatr nvslt)trxoxm oy4apenmnvs s  2rrxr no4altn ociat m ul( s;u)trxnxr oatfaDrlivil( s2xrxrpoodope mnvt s)a2rr(rpnu4aleoiocilsfm uau s t0 rtnxfcty1fpDranes;t  rurxm3nu4ll nlfet sf 2urum nt1opeomieilt m emumo t4alxrmr iy1fa r n s t)seurxm3iy1al e fct t)aDrru  ;o0tltniiciydfa umu p t4aleomr oydlmtran i (0trurxo3nydamt  nei (  2uax  oo0oeeoifcildlaDul(ms;() exoiocio1lpt luvs () ruoio ou1altemnci sfaDrrurp;t1aleomictytla um( s;t0aeenmo totop ran i ( trxrir3oo1om elicils sDuaxroot1tlxnii3ild s2ulnvo t4 eerio3iatfm   ueolt) ruo(o3iydap   nct tf rtax pnu4ole  i3iat aDran p (0 lerxociatopD ln o (  2toim iydal nmncta(fs2tr( pnu1tet ioetasfs2rau p u0tlenif3oytopD luvsl( srum(m oodal nlfet (f 2um(rpou0alxnmoctasfa ean o;u4trxrxfciytlm   iei;t  2ur(o oo4ll emncsa(f 2uaxrpoo1ope mfeiaslaDrlnvsnu0 lerxfcoydopD aivs s)trxo(o io4lp   ieslt)arrrumoot0alx io3iltla2eluvpnt4 exomr3totfat an o (0srxrxm3ou1ape lncslsfa2urur ot0tet if3ild aDrl(vs;t4tlermo iytop r n o;() eurxr3oo4ap   icta( a2rmx  no0ope ii3tlsfmDemn s;(0teermr3ia1fate i s ()s2tm(m iy1olt  nvs sfarumu onu0teto oeiyslsDulnms;t4trxrxf3tydfmtrlueils0 ruoxr io4om   ieias  2ururpnu1aexniiciadfs2rmums;(4 exrmf3tadfatelnvilt0s2tr(o oodll   fvslt) 2umu o;u0tlxoii3tls mDuln o;t) eerifcoytfm eaivo;(  eur(opno4lpe lfes tf rum(mo;u4tleoifeilslm umu s;u0altoif tytfm raiesls  rtoir oodlle lict (  Duau o;o4ale mocilt a2ul( p;t4areoxo oydlpDeai i s t2tm(rpiy1lpt mivias  2trur nu4olxn ieiytlm2eanmo t4 rtrxocootfat au olt)setrir3iu1aptnlfeias sruaxm ;u1alxn oetat m em(vs ()alxoxf3tatfmtelieo;( setr(m iudal n nctls)a2rmum ;o4tex  fetas m2uanvon(4tlxomo3oatfm rli o;t0trxr(r iy4omte nvilt  Drmu pou1teeo fciys mDemumo t)alxoir todlm r ieo;t trtrim3no1aptelnesa(  rtmu o;u1tpx iictlt m2um( on(0artrir tadopteluei;(  2xrxo nudoleelnesa()artm(  oo4aetn i3ilsfs2rauvs u)trxoio tytom  au o (0srxrxr3oy4lpt  iesatfsDtrxmpoo0oet  oeiyd mDelnvs u)trerio iatopteluvo s tetoiopnudome mfct tf rurum ;u4tlxo i3iyslm2em(ms;u4arxoir iodlmt luvols)s2tr(m iydlmenmfetlsf Dtaxr ;t0ope io3tat s elums;() lxnxf3to1fmt aivslt0seurimpoy4al e ivia( sDta(  ou4oleoiictldla2ran p;t4 rtrxf3iytlat aivi t  exoxo iu1open ivt s arua(m nt1aet mf3iysla ranvs;t)arxnmf3ty1fpDrli o;t0 2xmimpou4ap  lnci sfaDum(ro;u0oeeo i3iad a eluvo;t)trtrmrctotfaDeln s s)s2xr(o io4lltelivta(faDtmumpno1tlenmfetltlaDum(mo (4 leomo3todfp raivs ( seumxr oodlpte ivtls) 2ur(r no4ale mieiltla2ea(mp u0tlxoxo iy1fpteauvs s) etoirpoo4ol  lietl(f rrm(  ;u4olt  ocilt s2rmuvp;t)treoxf3ootlmD  ueo s)trtrio ny4alt  fvsat) Duaxro;t0teenioeilt a uau on()tlxrmf oy1opteaues (0 2tmim3iydam elnciatfsrtmxrpno4aeen ocils s el(vsn(0trerif3oy1fa e nvo t0setrirpiy4ope lfei tf rtmx  ;u0oltoifcilsfm2rauvpnu0 lxomf oadfa eanvo s0t2to(m io1lm  mfvtls) rrmx poo1olx  icildfm um( p u) lxnxo3ty1fat  uvs;(0sexr(o iodolee nesa(faruau oot0tpxo octadfm2rlnvp u0trtoif iytoateluvs;(  eumxr3nudopen nvia(fsrua(mpou0teeo oeiltls2ranvs t)tlxnmfctodlmtraieslt) rtrxo iy1altnmnvi ()s2rmxro;o0aetomi3tldla2em(vp;u0aeermf oa1lpt lues (  2to(opny1lleemfct (farrrxr ;t4ale mo3iatlaDeanmpnu)trtrir3iy1om elu i;s)srur(m3nudlmt  ietat s2ua(rp;u1altnii3iltlsDeauvp t0aexomo ootfat ln i t) rtrxo io4ol e iviat)artru o;u0tleo i3iatfm ra(ms;t)tleoif3totomDeaneo (0teuoxmpoo4aptemivsl(  rur(roou0aeeo feiysfm rm(vs;u) eeoxfcio1oaDrluvsl()trxo(o3ou1lltn fvtas) 2rruro;o1tpt mfctltlaDuln pnt0tetnmfcoatoate u ols0 eum(o3iu4op elnes (f 2trxrpnu1optomietyt a2ra( o t0 lxnmo3iydlptrlnei t0 exrxo oy1alenmicia(fsrtaurono0alenif3tyt a ua(vonu) exrircoatlaD ai s t) exrxrpio1alee ivsl(  2rmxro;t4aptoif3tadlaDea( on(4 eermfcoy1fp e uvs;s0s2xrir3nu4olen ieta() 2tmur ;o4tpxo oeild sDrlnmp u0trxomr3iydoa  aueo s) ruoxrpoudlmee feiat srta(  nu0oltnmf3iytla uanvp;u0 eenxo iytomD aieo s0trtmxm3io1am e fcta()sDtru pno1aetoioeilt m2uanmo t)trxoxfciytlat lu olt0 2toxr no1llen ivt sf Dtmum ou0open fcias s2um(vp;()tlxnmrcoadfmte ivi;(0teum(rpnu4lp  mfci t s2uaur oo4tptnmo3tytfs2um(mp;()tetnir3iy1oatranei;s  rto(o io1am elfcsltfartmur ot1apxomi3tltfa2emnvsn(0tlxrmrctotoptranvi t)srtrirpoydap elies (  rrrxrpoo4aexniiciat s emn onu) rtomociadfaDran o t t2xm(r3iydal emnci ( aDtrx poo0aexniictadlm rlumo;(0texrifcto1fa elivo s)seto(r3iy4op e fciat) 2truro;t1aeeo fctadfm eln pn(0aeeoio3to1oatr ivolt tetrir3iu4ole mfvi ()a2tm(mpoo1optnifctat s2ua(mp t0artnir io1lpDraieo;s)truoxo iodlle  ivs s) 2tm( ooo1aexomfcilsfs2rlnmsn() lxrmr to1faDeanvslt sruo(o ou4ole lnct tfsrrrx pot4opeomfeiadfaDum(vsnt) exnirciadlpt  n o t trtrxr3iu4ale mncsat  Dtm(rono0oexn iciasls ua( o;t)alenxo ia1la  luei t)trtr(o3nudlp elics s artrxrpot1tpxnif3iasfm rmn o u)teenxr3oadla rlivilt t2trxrpoy1ol elivsat)s2rm(  nt0teto iciysla emumsnt)texomocio1omte u s;()texo(m iu1op elfcta() Dtax o;o1texo fetysfa eluvont) etoxr3io1lmD ln il(0trurxmpio1lp  livia()s2tr( onu4olen iciatfs2eanmo (4aetomf io1lpD  neol(0 rtrio iy1al   iei tfs2tmx  nu1oexoio3tas a2emu ont0tlxnirctydoa  anvs ()srtr(rpiu1al  mncslsf Dur( p;o4tle iieiysfs2umn sn()arenifciadoaD ln s (0srumxm3iy4llenmieilsf rta(mpoo0aex  fctatlm2rmuvonu0altnxr3iodopt lneo;()tetrxo3oudlmtnmfvsls)s2rmxmono4opt ifcias aDem( o;t4artnmo io1fmte ieo;( s2xmio3oo1llee nct s aDtm(r no0tltnioetlsfmDra(vo u4 renio oatlpDraieo (  rtoxr3oo4lltelictlsfs2taxmpnt0oltoiietydlmDua(vs t4 rtoxo ta1opDraivo;t)texm(r oo1amen ivias  rtmxm oo1opeo oeiltls uaumpnt4 etnircoo1fa  aivo;t trum(o iodllenlncs tfa2rrxmonu1aleoifciatfa2eanms;u) lenifcootom r n s t srxoxm3ny1amt lnvtls) rtax  nt0alxo ieiasls eauvs;t4 etomr3ty1oa   ueilt seumim nudomt  ivsa(fa2uax  no4alxomf3iyt s rl(mp;() renmrciydfa rauvol()s2toiopoo1amte nct t)s2urumpou0aptoif3ildfs2emn o (0alenif3iytoaDe uei;t0setrxopiodom nmneias)aDtax  oo1opto i3tls m uaump;()artnmoctodom e i sls0s2tm(m nu1lp n ivtlt)a2ua(mpot0oeeomi3tys mDrm(msn(0 exrxr3oodopt lneol( s2umxo iodol nlfvi t)s2rr( poo4tlx mi3iadla ul(mp;t)tltrmrcoo1lpt li o;s trtm(rpoo4lp e ivia( srraumonu0tpto ieiadfa elnms;()tetnmr oydfa e nvo ()seuoim3iu1ame  fctl()a2trum ;o4tpx mictls a2el( p t4 exrmfctodfmDe iei;s tetmir3oudlltelfvsl() Dur(r nt4ope moetysfa2umu o;u) rxrioctotlmte uvols)trxrxr io4lm nlieiasfartrx  ou0apt  ictltfmDeaumsn(0alxomociytoptrau ilt)t2toxm no4lm e nctl( s2tmx oot0apx if3iatlmDrlnvsn() rxnmf to1lp raneolt)srxmxo ou1alen ncsas  2tm(m ;t1tptn f3tltlmDemnvpn(4aleoifctodlpt lnvi s0srtr(mpiy4aleemnvt (f Dtaxmooo0opxn feiyt mDrau snt0 rermo3oy1lpD aivo;(0s2umxmpoy1omt  fct (fa2ra(  nt4oeeomietlslaDeanvo t)texnmfcoa1oaD  uvils)sexrir3oo4olenlnei s)srrr(rpnt4tptoioeiydlsDuau snt) ltnxo oydlatr iesl( setrxrpoy4lltnmnes s  Dtm(r ;u4tltn ieiytla uauvs;(0aetomf oadopteai s;s trur(r iodomtnlfeils sDrauro;o4tpx  oeias m ean p t4 exrmr3totlm  aivi (0 rxm(r iydolt lncsas artrx pno1oeenmfciydla2ua( snt4aexrif3to1fptraivi;() 2urim3io4omenmnvs sfsrtr( pnu1oleo octysfm ea(vsnt0alxoir iy1lmDrli ol()s2tm(o3ou4ll elicsat) rrr( pno4tpen f3iadla eaums (0trerxr ia1latelneo ( trxrxmpno1lp emfct (f rtru  nu0oleomicild mDrmuvon() lxrxf iytlpD lneo;() exmio3oy4om nmfcilsfsruax onu0aeenmf3iltlm ra( s ()texrifctotfmDeli ols0s2xoxm nu4am elneil(fsrrm(m ou1open i3ildfm rl(mo;u4 exoxocty1latrlivol()teur(mpio4ame  nvi t)arua(mono4oetoifeiat mDem( pnt) etrmrciy1fa r ivil()teto(m nodol nlivtat)sDurx  ot0aeeniieiyd a emu pn(0aeenio3iadfa e nvs t tetr(o nu1lpee nviat) 2uauro;u1ape  o3tls m uan o (4tltrmocio1fpt  ivs;()trtmxopoy1ope lncia( a2rrxrp;t0openmociyt a el( o;(0 eenmocia1fpD  uvi t0teurir oudll elictls) Durxmpnu0apxomo3iyslaDelu pn(0 rtrmr3iy1lmte ieils)t2trxrpoudop   fcs (f Dum(ronu4tpt  i3iatls2eauvont)texoxr3iotoa elneils  rxo(o3no4lpenmiet t) 2rrxm nt1apeoifeiytfsDeanmp;(0aexrif3tytlp eau o;t srtmir iudlptelfeiat)artax ono1opxn i3iltlmDrmu s u)altomo tatlmtraieo;t) euoim3oo4ap   netl( srumx poo0optniociys s2ulu s t4 rxnir tydlmtrli s;() rurxr3no4lpt mnet tfarurx  oo1oltnif3tadfs rl( p;t0 lxrifcio1lmDe iei;()trumxopnydopenmici tfs2rrum ou1tleomiciatls2rmuvp u)tlenxrcoy1latr iei;t  exo(o3iy1ll  lfvil( sDurx pou4aetoio3iatfaDrm( o u0 rtoif todop r i i t0 rurxm io1lleemivi t  2ua(r ou1ale  ieiydlsDuan s;u)tlxrxo ty1laDr neo s)s2xr(o3nudaptelivil(  rtm(r ot4tltnii3tlsla ranvs u4 lenxr3oy1fatrai o (0teuo(m3nu1ol   fes ( a2rmxm ou4aptn ictltlmDrluvs;u0tlenif tytlm  lueo;t0srto(rpnydlptelfvsls)sDtmumpoo0oltniietyt s2rmn s t)aleoxfcto1lat  neo t  2to(rpoy4am nmfctltfsDrmx pnt1alen i3tatfm2uanvpn(4treoxociy1op r i olt) euo(m no1alen netl()aDumurpno1tpxo feiltfm2rlnvs u) rxoxr iotfaDr nes t0setrxo3no4altn icta()srtaxmooo1aleo ictydlmDrmu o (4arxnioctadfa e ivolt0teumirpio4alenmnvils  2rrurpno1alxn i3tlt m2emu p (4altomr3iatoa  an slt0t2xrxm iy1ap nlnvslt)a2tmx ooo1texniieiytls2el(vo;(4trxrmr3todfptrau o t)srtriopnodlpt  feiltfsrrrxroot0ole  ocilslsDeaumpnu4 lxnircia1omte nvi;() etm(r3ny4amt lfctas)srtr(rp;o0alx io3ildls2rl(vp;(0 ltrmf totla rlivs t0t2umim3ou4ap elietlsfarur( oot0aet mo3iat a elnmont) rxrmr3tadfp eln ols) 2trxmpiydomee icsltfaDumxmpnt1aptnif3tasfm2eau p (0alxnir iotfm  luvi;() eurxm nydom   nvilt) rur(m ;o4tlen fciat s eanvont)aeenmf oadoa ean ilt sruo(o3iu4lme  ivil()sDum(rpno4opxnif3ilt aDul(vs (0alenir todlaD  ieo;( texrirpnodlle lfesatfsDua(rpnu0oexo o3iadla emumo;t4alxrxociydomDeluvolt0tetm(o iydlm nlnei ()a2ua( ont0oleomf3tlt s ranmp;u0aetnmo oo1lp rlivo t)trtr(m3io4ll  livt (fartmxr ;u0opx  feiyslm rl( ont4trtrxoctodom raueolt0srxm(r iydlmtemicta()arumxrp;u1teen f3tyslsDranmp;(0arxnmr ta1laD lieo;t0 rtmio iy4op emivsa() Dtmumpnt0tlenmf3iytlmDumu p u0trerio oydfp rau o;(0 etr(opny1ame liviltfsrtm(r no0tetomoctasfs2ua( o;()aexoif iydfpDr n s;s)s2tmxrpnudaltnmiesasfs2rmx pnt4oleo fetytfa2elnvs t)teeoxr ta1fp ranesl(  rxrxr oo1llt lfvsat)sDtmxrp;u0opt mfciltfaDrln snt0aetoxf iadlpte nvo () 2tmimpny1ap  miviltf 2tr(ronu0altoiiciydfm umu o;()alxoifctotfmtrauvi () 2urirpno4olt mncilt)s2urumo;t1tleoioeilsla rmumont)alxomf3iadla rli o s0trtrxopoy4omt mies ()sDumx pou4tptnmoeiytla2elu sn() lxnmr3oodfmD aues t  rurim iodaleemnvil()srrm(mpnt4aet if3iaslm2umnvs;t)trtrmo3oytomDrli o;(0trxoir3oodomt  nvi t)arrrx ooo0tleoiociatfs rlnvo;u)tltoxr iadlmDe ivi;t srurio3iu1ll nlfvsas sDrmx oou1apxo fetlt m2eanvon(4aeenxocoytfmte ivs t) 2tm(m3iodal nmfvt sfaruax  nu4tet mfciyslaDeanvs;(4treoxf iodlptrlieils)tetmiopoudolt  fetltfsDtaxm ou0opeomf3iasfsDea( p;t0tltnxr ia1lp   n s;t)sruoxopoo4al elicils  2ua(mpnt4optomieiyt m2rlnmonu4 rxoirciytopDeai s () euoim no4optnlfetas  Dta(r ou4tet iociasfs ranmpn(0areoircoydlm  auvsls) etr(m3nu4lp nlnvsas)a2tr(m ot4tltnio3iat a ra( p t)aleoxrciotfm  auvs;t0seum(mpnudamt mnvtlt)sruauroot1optnmf3iaslmDuaums t)teeoxf oydlptrau o (0t2xrim iy4lpe lfei s  2uaumonu1alt mi3iyd a2uau o;u0 leoif iy1fmte ieo s0 rtmxmpiu4ope mfvil(  rtr(mp;o0aeen oetldfm2rlu s u) exnxf oo1faDeluvi;s)s2urir nydomte neias sDrm(m nt0aexniiciyslm rl(mp;u4tltnmo3iytomDeln ilt trxmxm oudlp nliet s srtrxmpno4tpt iiciasfmDuluvp u4 rerifcootfm eaneslt0 exoio nu1lpee fvsa(fs2tmxr ;u4altn ocilt sDemnmp;t0aetrmocoodfa eanei;() eumim ou1llenlfeta(faDumxrpoo1aptnif3iadfs2ra(mp t)alxrioctodom ranes;t  2uoxo nodlptelfetasfa2tmur oo1tet iicils mDeanms () lxomr io1fmDeln slt0seuoimpiy4am nmnvsat s2umx  nu1olxo i3iyd m2ranms;u)trxoxfcoadfpt luvols) 2toimpoy4lmenlnct ( sDtm(m no4ale iiciat m emu s t)tltrifctytfpD  ues;t t2uoir3ny4lpenlfvta(faDrruronu1opxniieiasfm2ra( s t4 ltnmr3tydomt auei;(0srxr(mpou1ome mfeilsf rtaur ;t0texomo3tltfa2rauvon() eeoif iadom ran s ()seuo(m ny1lpenmnvtasf 2rrxmpnu4olx io3tldls2uanmp (4altomo tydla  lnei t)t2uoir3nydll nmictl(f 2urx pnt1tpt mictyt s uanmp;u0arxnxr io1lp  li ils  2xrimpiy4opt mivslt s2tau pno1tltn feias sDem(vo;()artrif3totopD livo;s  rtrxm3oy1lp n fvtltfaDum(monu1tex mieilt m el( p;u0 etoircoytlpD  ivils) eumxr nydopenlnetat)artm(mont4aexoio3tltfs rmuvo t4 rtrirciatlpD  nes;(0srxrio3oodlptelnct sfsrumxm ou4oeeo f3iatfa rmnmpn()altoxo3iytfaD aiei t0trtr(opoo1ape lfesatfarurumpou1teenmf3iasla2elu s;u4 rxnxf3ootlmt  uei s0 etr(mpoy1aptnlfvtlt)srur( pno4opto fetldls2emuvonu4 leoio3tytfpDean ols)setrim oydlp emfetltf Drrxroot4aexniocilt a ra(mo;t4alxrmf3tatlp e u i t srxr(o3oodll e icta()srta(roou1tpxoifeiltlaDum( p () rtomo3todopDrau o;t sexr(m3no1lmee fvs ()aDum(ront1opx  oeiyt s2emu p;u4alenxf3tydopt  i il(0sexmxrpnydale lfctlt)artrxrooo0aetoii3iadls um(mo t)aeerircty1lmte ueslt)srtm(opiydomt mfct s)arurumont4olxomicild mDeluvs;(4 exoxo3tytfpteaiesls sruoxmpnu1op elnctasfarrru  oo1olxn fciyt s rmnvpnt0texniocto1optrlneolt0trxr(r3iy4lme liviat a2rm(mpnu4alxnifctad aDumn o;u0 exrio oo1lateluesls srumir3nodlpt miei (fs2rmurpno4aexnmoctatfm2rm(von(0teerifciytlp r ieolt tetmim nu4omt lfcsas s2umu p;o1alxo fetydls2emn o;t0 etrmf3oadfpDrln i (0teur(r oo1lle mictls)sDururpnt1tpx mfciatlsDem(ms;u0 etoir3oy1om eaueo () rurimpnodal nmfctl() 2rr(rono4tee ifeiatla el(vp (4tlenif todla   ues ( srtmxm oy4lmen ncias) Dua(mono0oee moctatfmDulnvsnt4alenmociy1omt aueolt)s2umxmpiydlpenmfvsas) 2ua( p;u1oleomo3iys s2rlnmp u)teenircto1fmDeanvsl(0trtmio3no1am elivil()srurxr ou0tee  f3ias aDuau s;(0tetrmfcoa1opt anvi t s2xmxmpoy4lltnmnes sfa2rr(  nu0aex  ieiydla uaums;(0alxrif tydlm ean sl()sexmxopoydlltn fetas  2trxmpnt1opxn oetatls el(msnt0 exnmrcoy1opteanei;s) 2uoim nodopee nviasfsDurxm nu0aptoioetlsfmDrl(vsnt0 etrirciydomtr uei;s0t2xoxrpnu4am nlnvta(  2umxmpnu1ale ifetad mDrln s;u4trerxr3oodfm  auvs;t s2tmxr no4ome  icslt  rurx  ot1opeo ietytlm2rl( sn(4alenir totlp  lu il(0 exoxmpno4amtemncslt) 2urxront4aetnmieias s uan pn(0tetrmr3tydoaDe iesl()seum(rpnydoltnmnetl()srrmump;t4ole micils a2elnvp u0 lxnmf oydla r u ilt)sexm(mpiydol nmfcil()sDtrum no4tpxniieiltfm2um(vs t0 reoxfcoytlmDraieo;t0srumiopoudapeemfvi ()arurum ;o4tex ioeilt m rau o;(0 rxnxo3oadlatrlivs ( s2xmir ny4lptnmfciatfaDtru  no0oltnioeias a2uluvp (4 lerir ia1fp rlnvi (0 etrio ou4aleelneils  rta( pou0opxn feilt s ua( on(4aexnio oadlptrln s;s) rtrio3ou1ape lfes (f rumx pno4aee iieildfm emnmpnu) exoxf3todfaD auvslt) rur(m3iu4lptn fcta(fsrra(root1ape if3iadlm2emnvonu4 rxnif3oodfa elueols)tetrxrpiudamtelfcsls  Dua(m no4apx mfciat s2uaums;(4artnifciydfp eau o t)t2to(m3oo4al elnvils aDtaump;t0alt mfctldls elnmo;()tltrxo oy1la rai s s seto(r3iu4lpe mieia() Dtau oot4tltomo3tltfm2uau sn(0alxrif tytoatranvo t0 etrxm3nu1lmtnmictasf rraxr oo1tleomocildfaDulnvo t4arxomr iadop eaieo t0trxm(opnodamtnmnciatf 2ur( oot4olxo ocias m2umuvpn(4alenir tytlatelueo () eurio oy4opeeliciasfsDumum no4oleo feiydlm el( p;() lxrif3oy1fm   uvo;()sexoimpoydom elicsat)arurxr oo0tex  oeilsls uau ont)arxrmr to1lmtr uvi;t)t2xmxopio4amtn fetatfsrra(mo;o4apxomi3iyslsDrmn snu) eenir3oo1fa   iei ()s2uoim3no1lle lnct s  rtrurpoo4aetn ieiltlm rlnmp t0trxrif3ty1optelues (0 rxrxo3iodop e iesatf 2umu  nt0oetoiietld s umnmon()trermf oadlmDeauvi;s0texo(r3iy1oleelnctlt a2ururo;o0aexnio3iatlm2uanvo;u0 etoxo3oadlatrlu s t teum(opio4alee fvsls  2tr(r ;u4teeoii3iltls ea( s;t)aetnif iydfmteai olt t2toxm iudale liciasfs2rru  ot4alxn fciysfmDumuvs;u)trtoxocoa1oaD an o;s0 rtmxrpiodoptnmnes ()s2rmu o;t4oee if3ildfs2rl( o;t) eeoio totoaDran s s) exo(m3iydlltelicsl( s2tr(rpnt0apt moeiys mDrau o;t) lxnxocio1op rlieo;(0srtr(mpoo1am emiei sfa2rrxr ot0opx ifetlt s elnvp;(4aleomfciytlmte ueo;t srtrxr3iu1ol  liei tf 2ua( p;o4opt  feiatfsDua(mo t)altoir tatfp  ai s;t0s2to(o no4olee fet s  rtr(mont4aleomieilslsDeauvo t4 lenxo3tatfm ean ol()srtoirpnu4aleelfetl( srurx  ot0oetoif3ilsfaDrau o;u)tlxrif3oy1fpD aneols setrir oodome lfvtl( arur(mo;t0oet miciys aDrl(mo;t4artnxr iytfaD aivi s0texrim oy4lptnlncsat) 2tr(r ou1opeo iciadfm2rl(vpn()texnif to1fa rlivo;(0seuoxm iy1llenlicia(  2rm(r ;t4tet if3iydfs2rm(ms;(4 rxniocoatfaDeluvslt0 euoxr3oodam e ncs s a2ta( onu0aexnmo3tytlm el(vs u) rtoioctodop   i sls t2tr(opoy1apt miei () 2trxm ;o4open fciydfa rl( s (0 rtrxociotoaD aues t srurimpnudlptelfcsas)srurumo;o1alxniociad mDumu o u0 reoif3iy1fa  auvils0 ruoxmpno4lp nmieils aDrruroot4opt moetyd m2rmnmon()arxnir3iadop  anvi t)teumxrpnudlmenmnet tf Dtr( pno4oleomfetasfmDemu p;t0 renmfciy1lmDeaneo;t0 2xoim oy1ll e ivils)aDua(mo;o0apt  oeildlmDemnvpnu)aetnif oy1fmD  uvi;t)trum(rpou4oleelncilt  2tr(  ou1tltnmieiltfs rl(mpn()aexnxo tatom r n sl(0trumiopny1ale mictlt) Dtru  ou0tltnmf3tatls2emums t4tltoxf todlm rai s;s  2umiopoo4lmtn fvtl(  2uau poo1tpen oeiadfa2ea(vsnu0 etnmf3tytfa elnvsls0 eum(r3oo4ole  fciatf 2umuro;t0oltnifciytfsDumnmp;(0 rxomr oy1fm ranei;t) 2uoio iodlm  mnci s)s2uaurpnt4oex mi3iat s2rmnvs t4 lerir iotfatrln s;t  rum(m3nu1ll elfvs t)srrmu  nt4apx mieiytfs ranmp (0 exrir tytfpDrlivs;s  exmxo3iy1al nlfcta()artm(rpot0alx  i3tlt m eanmo (0tetoxr oydfmD anvo (0trxmir oodam elfvtl( s2raxrp;t1aetomo3iysfs2uauvpn(0arxomr to1laDe nvo;t0s2uo(o oudom nlfeias s2ta(root1aet  octadfs2em(vp;t)artrmf iatfmDelies () rumxm oo4ap nmnes s)s2tmx  ;t4aexn fetasfm2ul( o u)tltrmr ootopDr nvs;(0tetoxo iydlm nlfvs s) rraxr ;u4alx iocils m2rluvsnu4 etnxr iydomD lu il(0sexoio3oy4al nmieiat  Dumx  ot1olx mieilsfaDrmnmsnu0teermf3iodoaDeau i (0 2uo(m ou4op n nci sfs2tmxrpot0apxomo3iyd sDem( p;t)tlerxr3totfp e i s t teuoim ny4lleemfei sfa2rax ont1oet miciaslmDulu s;t4 exnifcoa1lpDrlnvsl(  rtm(rpoo1ap emfeia(faDrmurpoo4opt mo3tadlaDrlu s;(4aeeomr3tytfpDeanvolt0 ruoxmpnudaptn ivilsf rrmurpoo4aee io3iyd aDrmn pn(4tltoxoctytfp rlneilt) rxmxm iydlpenlfeias aDtaxmp;u1alto iciydls em(msnu0 exrio3oo1faDe u o t0trur(m io1omtemici (fs2rax oou4optn i3iat mDem( p;u) lxoxr3oodfaDran olt0 etmiopoo4olt mnvsatfaDtm( oot4oex  fcils m2rmuvonu4trtnxo3oytomDrlueils trxrxm3iudomtnlivsls sDrmu o;o1altomiciyt a2uaumo t) rtnio oytla  lueolt0trtmxr3iodam e fvtat  rtrx p;u1tetniicild mDrmums;()trtnxf3ta1laDrlieo;s0 rxoxrpno1ale mfvtls  rtrxmpno0alt moeildla ranmo u0 eeomf3oydlptrau s t srto(rpny4ll  mfviat)artaum ;u4aeto o3iasfaDemu s;t4tetniocootop   ivo s)seum(mpoo4alt mnvia()a2uaump;t1oexniieiydlm uaump;u)areomr3iatfat lu ils t2uoio oydapee fesatfs2tmurooo4openmfeiatls uln s;u0 exnxf3oadlaD ln o (0setoxm3oy4ol emivsat s2tr(rooo0aetnmi3ilt aDuln s t)altoxfciodfmDe ivo t  rtmxopoy1ole lietasfaDrmu p;u0alto i3iytlaDrmnmont)teeoif3tatoatr ieo;s0setmxo3nydlpen fci tfarurx  ;o4tpe ifetydla2elnvp;t0artoio3ta1lmDe uvi ()srtmimpio4al e ncsat)srta(rono4olx  ieildlaDeauvs t4 reoxo tydlaD lu ol( texr(r oy1lmtelfct s sDtax  ;o0tle mo3iltfs2rl( on() lxomo3ta1lmt aiesls)teuo(o iu4op nmnet t aDumumonu1tlxoii3iatlm elnvs u4trxrmocoytfaDelu o s0trtriopiu4amenlivtat s2um(r ;o1olen ociat a2rluvp t0alxrxr3iotfpt ai olt s2umxopio4optnmfct t)aDraur ou4aeeomieiys s2rl(mpnu) etomf iytomDeau s ( s2xrxmpoy1aptnmies ()sDuaxmpnt0tlxnifciys aDrm(ms;u)aexnmr tatlmDe i sl(  eumimpnu1lmte ncia()sDtru oou0tltn feias s ul(vonu0arxnif iy1oateanvil() 2xo(opny1al e iei tf rur( o;u1opx  oetyd mDemuvo;t) rtnir oytfpte iesl(0 rxm(r3iy1lp  micia(farurxmp;o0aexomo3iysfm2umnmont)artoio totlaDelivo;(0sruo(o3nodoptelfeils)aDua(r oo4tet ifeiatfsDrlnmsnu)tltrxociy1latrai s;t0t2xm(rpio1apeelivsat)a2rmurpnt1apxomf3ilsfaDranvs t0altnxfctydoptelnvi s srxr(o nudlptemfes s aDrrx p;t4oeen icildlaDranvon()tetnmo3ta1lpD aneil(  exm(r3iu4lpee iesa( aDrrxr ot4tet  fetldlsDemuvo u) ltrmfciy1fm elneslt) 2xmir3no1omt lnvsas a2tmu oou1alenifciatlsDea(vsnu) ltnmf iytfate n s s)srtr(r3nudaptelietatfs2trxrpnu4aexnmo3iytls el(vpnu)teeomfctadomDeaieol(0 eumxopio1altn fvtl()aDurxro;t1apx  fciatfs2ua(msnt4alxomfcoytlmDr i i t) 2toiopoydlme  fvs t sDurxr ou1tptnif3tlt m2rlumo u0trermo ta1oa  ai ilt t2xrxrpiy1op nmfetltfs2tmumpoo1aeeomociyslsDuln o;()teeoifcoodfpD aies ()seurimpou4lpteliesls srumumoou1aet iiciysla2el( p u4 etomr3ta1fp eauvolt) 2urxmpiodop   fei sfartrxrpnt4aeeoifeiatfm emu s t0altrxf tatoa eauvsls seuoxm3no1apt miet (faDrrx pnu0optn ictytlsDul(vp;u0 exrir iadfpDelivolt sexrir3nudoltnlfvi t)a2tax o;t0oltnifetatlmDumn s;t0tetnio3oy1opt ln i t t2trio no1al e feia(fsDuaxm oo4tleniiciyd mDem(vo;(4tlenxf3tadlat lu i;( srtmirpou1lp nlnvsl(fartrxront1opxomfciat m2rmnvpn(0aeenxociodfm eli s t)srtrir3nydalee ict tfsrumu  ;t4aetn oetydfm2umn o t0altoio iy1la  li ol(  2xoimpoodoltelfctas) 2tm(r ;o4tltoioctlslmDuluvpnt0tltrio iodomtelu o;t t2xo(o3iu4alt mnvt () ruaxrpnt0opxnmociytfaDrln s;()artrxr3iytfatr u s t) rumxm oodolt mivs t a2taxmoot1apeoii3iltfm2ran p t0trerxrcoytoatr u sl(0t2urir no4ol elncsl() 2umxrpoo4tet mieiytfa2um(mpnt0aetnmfcio1lm r u o s  ruoxr3iodomt lfvt (  2rmu  ;o4ape mfciatlmDemu s;(0 rtomr3iadfaDr ivs;(0tetm(opny4llenmfeia(faDrax oou4tleoif3tyslm emn s t4texoiociadla rai sl() rtrirpny1aptnmiei s)aDtmxm oo4alen i3iad mDul(mp;t0trtoif tytlpDrlnesls)sexo(mpoy1ole  fei t  rrm(m ;t0apto i3tydfm rmnvs;t4aeeoxocoo1om r uvsl( s2uoirpoo1llee nesa(  2tmxrpou1oeeomo3tasfm2umnvo t) etomf iadlate neols)srxo(r3ny4ll  mfcs (  2urxroou0tetn i3iyd aDrm(mpn(4altomfciodoateln o;(  rtm(o iy4olt lies ()a2tmumpnt4texnmfetad s2el(vsnt4teerxr3iotopDr ueslt setm(r oo1altemicsltfarur( pno0tetnii3ias m eaumont0 etomo3totfatran ils0trurxm oydame mfvs tfaDumum nt1oltnmo3iyd a ra(vo;u4trxrxrcio1faDe n s;t trxrir ny4llt  ivi t)srtax  ou0tet  fetatfmDrl(ms;u) ltomfciy1omD au i (  2tmiopiy4lp  lnvt s)a2trur ot1oee  feiyd m ea( o;t4tlxrxo3to1opDrlu o;t seumir oodopt mfcil()srum(ro;o1ale mfetadfa2uauvo;u)artrmf3ia1fmtrlu ol()sexmir oodal emivt ( a2tmx ooo4aptomoeilsfaDea( snt0 lxoif iydfmtr uvs s0s2xrio3iydop   ivtlt  rrau o;u1tpxomo3tlsfmDuauvo;(4artrir3iodoa rlu i ()seuoio io4lme lieia()aDtmxmo;o1texoiictydfm2ran s ()alerircoa1opDeluvsl( teurxopny1aptnlivtas) rtrx  ;o4alxoifciys a2eaumo;u4alxrir3ty1optr ivi t)srxrim3nodap nlfcsa()a2taxm no4alxnmiciytla2uan o;()trerio3iatfmD au s;s setoxopio4aleemfeias  2uau o;o0alt ioctadfm eln pn(4aetoxf ia1fpt aieo;t  2to(opou4alt mivt () 2raxmp;o4opx  f3tyt s2uanvp;() etrioctotop r n s;s0 rtmiopnodolt lfvtlt  Dumxrpnu0apxoii3tytfa rlu o;()trxnir3iy1fatrai il() rtrxr3oy4omtn ncta(f rta( oot1olt micias m elnmo t) exoio tydfaD
\ No newline at end of file
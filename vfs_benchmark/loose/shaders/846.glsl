@@ -0,0 +1 @@
+ies (  rtrxr iodal  livs s)artmum nu1ale mi3ias s2uan s;t4texriocoadopD aivolt srtoio iy1lmtelnes sfs2rrxm ot4oexomiciltla2rluvo;t0 lerxr oy1lat ai s s0sexrim no1amtnlnvi t  rurx p;t1tpx mf3ilslsDranmp t)aetnmf oydfp eaivs;( srxoio3no1lm e ics (faDtmuro;o1tee  feiydfaDum( ont4 lerif oa1fm e ivs s  exr(o3nudomeelici s  rrmxmoot4aleoiiciatfs umnvon()tlerircia1lmD ai i;s)s2um(r3nydlltemicias  rtaurpnt0aetoifciytla ua(vonu0aexrmrciodoa rau ol( sruoxrpny1ole mietas)a2rau ooo4altomf3tysfaDea(vs;t0 exrif todfptrlivils) 2umir oo4lleemnetlsf rrmurp;o0tpe ifctadls2eauvs t0tetoxfctadfatr n il( trumio3iydll nmfvt s srtm( pnt1opx  oetldlmDrlu s t)trerircoadlp elies t0sexrxo oydoptelncias  2rmxmont4tlt mf3tas sDel( ont4 ltrmf3tytlateau o;t0trumxmpny1ol emfvsa( aDtmu ono4oeeo oeiasls2eaumo;t)tlerif3iytfmDelnvo s  euriopnu4lmte fcil(faDtm(rp;u1tex iicilt aDemu o t0trtnif iodfpte iei t)trtoirpiy1am  mnctat  2rax oot1oee micilslmDelnmpnt0altoio3tatlaDranei t srur(rpoydll n ieil(fa2ta(r nu1tlx  feiltlaDrlnvs;t4 rermf3oadoptrai o s tetm(mpiudop e netlt s2ta(rpoo4tee  icilsfs2umnvp ()trxnxrciatfpteaues (  2toxm3oo1lleemiesl(f rum(  ;o4tpen o3tyt m elnmp;(4tltoxr3totlate u s;s0 2xrxo3oodlm   fcsatfsrum( p;o1oeeoioeiltlmDrmu ont4 eeomfctydlmDrauvo t)trtm(r3ou1llee fvsat)arraump;o1aleo ieiytfs2ra(mo;(4 leoxr3oytoate n ils trto(r3iydapenlnct s)s2raxrono0aee mo3tydls2em(vs u)tetoxf3ootlp  au o s)trurxm3oodoltnlfctltfa2trur no4optnmo3ilt s um(msnt) lxrxfciodfat aiesls trxr(o oudlm n ncsasfsrta(r ;t4apt ii3iadfmDumnmp (0altoio3oa1lm elues;s srxrim oo1ap nlfcsas)srtmu  oo4opeo iciadfaDrlump;t4tlxrxr oodlat lnvil( srurxo3oo4lpe mfesl( a2umxmpnu4aexnmoeiad aDuanmon(4trerxo oa1lpDe i ol(0teuo(m3oy4am  livi s  Drrx pno4optoifeiad s ua(mpnt)alenir oytomDean s (0teum(opoydom  lfcs s  Dta(rp;o0apt  icilsfm2emn o u4tetrmf3oadomD  ivil( srxoirpnudal elivtls)sDtauroou4tltniiciatlaDea( o ()treoxfcoo1lpD au o;( t2xo(r3oo4lptn feil()aDtmurpnu0apxn octltfs2emn p;u)texoif iy1fmt lieolt)s2urxmpiu4olt mneta( aDumxmpoo4teenmfcildls2rl( o u)altoif3oy1fmtr ieo;(0trto(o oy4ap   fesat aDum(mpno4tltnmoeiad s2el(mo t4 ltrmo3iadomt  u i;t t2xo(mpny1am emfvs t  Dtmur no1olxo o3iatla2el( p u)tltrmf oatfmD  ivi;t)trxm(r oo1omtelfcias  Duru ont1opx iociytlm eau onu) lxrifcoydomDr uei;() 2xmxm no1omtnlies s)aDrru  nt0teto i3iytls2ran snt0 etrmfcty1oaDe i s ( t2umxo3oodap e nesatfa2taum no0teeoiieilsfmDulnvo (4trxoxr ty1opt ai o (0trxoim io4llen netl(f 2rru poo1tpenif3iatfmDra( onu)texoxf3io1fpDraueilt trxrirpoydolenliesl() Dtmurp;o0tpt ioctad s2ulnmp t4 eenmf tatlaDe ueo;s0 2tmio oo1ap   nciltfaDuaxm ot0tex  fcilslsDrl(vont)tlxoxf3iytoateauvi ( trtoxr3io1lme  nvi ()sDtr(rpnu0olt  f3ilsfm umuvpn(4tlxrif3iydfp r u ils)trxrxmpiy1olt livi s aDta(root0olxo i3ildfaDel(mpn(0 etoxfcoatomD aies;s0sexoimpno1amtemict t aDtaxr ;t1tpt mi3iydfaDrmnvo;t0artnifctydfaDe nes;s s2tmim3oudoptnmnviasf Draxrono4tptn octytlaDul(vs u)altrmr3ia1fmDraivs s0 2xo(r3oy4ope miesat)s2rmu ono1tleoifciatlm emn snu4 renxrctadlmteaivi;s  rtmxr oudlmtn nvtas)sDtrxro;u0apto feildlm rln o u0 eenxf iotlm  ln o;(0s2urimpiy1lm n fci tfsDrmum nt4oexn fctasls2ua(vp;(0artrmrcoy1omtranvi ( seuoio nudlm n feias  Dtmumonu1oexo feiltlmDean o;t0alxoxr3oatoatrau o;t0 exoirpiy4om nmfetlsf 2tmx poo4tltn f3iatfa2ul(mpnu)aexrmoctodoaD ln s;( srtoxrpnudapt micilsf Dra(  ;u1olt  ieiyslsDel( sn(4altrmoctotlp  anvs;(0 eumim no4opt  fesa(fsrrrxmpot1altnif3tltfsDemums u4aetrxf totom rln sls0 etoxmpoo4omt  iciatf Draur ;t4alt mi3iadlaDumnmp;(4 rxoxf3oytfpD aivi t0texmir nodoltnmfvia(faDtmxm ou0tltnioctys s eauvs;u4aeenmo3iodfpDraivsl(  euo(m3no1olee fctlt) Drmur ot0tpxnifeiydfaDeln o (4altoxf oa1fm eln i;s) rurxo ou4op nmiei s  rurumo;t1alxo ieiat a rlums u4trenxf3todlptranvo;t0 etmxr iy4lleelneiatfa2rm( o;u4opt mociytla2emn s;u4aleomocoatoatrauesls)sruoim3no4alenmivtl( a2taxro;t0tpxn f3tat m rauvo t)aetnif3iy1fm raies ( srxoxo3ny1ol e fciatf Drmumpno4opx  ocilslm2eluvp;(4aexoxrcoatlmteaivo s t2xmxm3ny1aleelneiat  Dra(rpot1aetoioetldlsDum(vonu0trxnif3totfpteluvi;t) 2xoxr3oodap n fvtat) rumur ou1oeenii3tys s ulnvont0artoxrciotfpteln i t)t2tmxm3iydllt  ietat s2tmxmonu0olxomf3ildlm2uan onu0aetomo3oo1la e nei;( s2xmxo3oo1lme lnct () rur(rp;o0apx ioctls sDrmu o;t)aexnmr3tadlmD  ues;s trurim oo1op nlivtat  rua( pot4aet ioeiyt m elnvp;()trxrmf tydoaD lu i;s s2umxm3iodlptnmncs s)arta( oot4tee moetytfaDrmnvp;u4 ltrmo tadom rln sls setmim3ou4lpe lfet (fa2truro;u4ope  ieiaslaDum(vp ()arerxr3io1late n s;() eurxr3iu1am nmivilsfsDurx ont4oet  ietyd m2elnmpnt)altnmr3iodfmD lueo ()trxrxopio4ap nmnvs () rrr(rpot1tpenmictasfm2umumpnu0aetoxo iodom ean olt s2tr(mpnydllenmnetat)srum(mo;o0tleoiieilsfa rlnmp;()alxnio3tytlateaieils) etoxr ny4ome lnvsl(fs2rmumpoo4alt moetld a2raump;u0 exrmrcoadla r nvilt0 rtmir3oy1lpte fvia()s2tmx  nt0oeenmicildfs2ua( p u4 renmr ta1oaD  n o s0s2xoxm oy4altn fcsa() Duaxro;o4tpe  i3ils mDeanms u4altoir3iy1la r nvs t  euoxr3oy1lle lfvils)arrmx pnt4alxomiciydlm eaums;t)aetomoctatfmDeaneo s)t2xrirpoudape livtl()s2rmxm nu0oeenmo3iad m2rmuvpn() rxnxo3oatfmD lies (0seur(rpnydlptemnvt t  2tr(moou1alxn ociltfmDulumsnt)texnifcio1lpD aivi;s  exm(opoy1amenmnet sfaDtmx  nt1olx if3iadfs rlnmon(4artnircia1lpt  i ilt tetrim io4am  mnvsltf rta(r oo0oltn ieiytfs em(ms t0 ltnxf3ia1lmDr i o (0trxoim3nodalte neta(f rtaur nu1olt mo3iydls2ul(vo (4treoio3ootoatelnvs () 2xmio nu4llenlietl()a2tmuront1tltniocias s2ranvs;u0teermo iytfaDean s t  2xm(mpiydolte ivsl( s2taumo;u0apxnmo3tas a2el(mo;t0trxnxociy1opt au s s0truo(r iy1lm  liei () 2rmx  ;o0tlen ieiytfs2ulnvs;(4aexnxociotfptelueo (  2to(r3oo1olt lnvi tfs2umxrpou0aex  ociaslm um(mpnu4tltnio3iydlpD  nvi;t)t2tr(r3iydlpe mieiltfaDraum ;t4teeoifeilslm2rl(vp u0arxoxf3oodfpDran o () 2toxm3iy4omt lnct sfsrrmx oot0olxo ieiytlaDrlu p ()altomo iytfptelnvs s  rtoxrpnu4om   ivil( aDur(mpnu1tptn f3tlslmDeaumo (4tetomrctadomt lueo;( srto(mpoo1omenmietas a2rm(  ;t4tex  o3ils mDrlnmon(0aexnmo ta1faDelivi;s0texrxr3iudlptn ies ( s2tmu  ;u0apx io3iyd s rmnvp;(4arxoir oa1opt auvols) exoxm oy4lpe mneils s2urx onu0oeeomoctat a em(vs;t0 leoif3totfatr nes (0s2xr(r oy1opt mfvi (f 2uaxrp;o4apx iiciasfm2eau o t)aetnmf ty1opD aivi (0 2urxopny1om elivtls)srtm(m ;t1ole ioctas a2ul(vpnt0 ltnmrciodfm   n s;t  exoxmpnu4amt  feias  2trxroou0oleo oetadfsDuln s;t0aetniocty1fatrlieo t  rtoir3no1lpenmiesl(f Dtaxm nt0aexn f3iyt m2em(ms (0 renxf tadfpDe uvs;s0seumio io1am nlfcsl() 2rm( p;o0olxoiictld sDea(von(0trtrif3io1oa e uvs;s  2xm(mpiudopen nesasfsDtru p;t4oeeoio3iydfs2emnvo () eeomoctotoat  ueo;s s2xmiopny1lmtnmnct t) Dumx pou1oetn octydfmDrln pnt4arxnioctotoa r nvolt)srtmxr3nu4ap elfvsat s2trx o;o4tlenifeiytlm rmu snu4tlxrio3oadlat lnvi t)trxoir3no4lpe  iei t)arrmum ou1tlxomiciytfa2um( snt4 rxnmociy1op e n o;s0s2xrimpoo1ome lietas s2rr(r ;o4opx mfetlslm2ua(mon(4treoxr io1omDelu o;s s2uoxo3oydlp e ivia(f 2trump;t0tptoifctasfm2um( s t0tleoifcta1fp e nvs;t0teumxr3oodoltnmivsl() ruauro;o0ole mieildlaDelumo;u4aleomrcoatopt lnes ( t2xr(r nodlle lnvtls arrmumoou1optomietytfa2uan p ()trxnmo oy1lp rlnei t  etr(rpoy4omenlivsa() Dtmxroot0oeenmo3iaslsDumu pnu) rtnifcoodlptelu o;t0t2xoxm3ou4lp nmnct ()s2rrurp;t1alenmietld a2ul(mp;(4 renmrctadfmDrln s;(0 rxm(r nu1amtelnei tfarta(mont0olxoif3iad m2um(vsnt0trtrmo3oa1fpDe uesl(0 euo(rpiu4lmtn nvs s)arum(  oo0olx mictlt a2em( ont) rxomf iytomD aueslt)srurxrpiodll   fetls artrxmoot4alen f3ildlmDumu pnt4areniociatomDrln ol(0srxr(rpoudaptelnvs t) rtrxroot0aetn octys a2eanmp;()areoxfciatlm elneilt0 rto(m oydlltnlfvslt aDra(rpno4oexoif3taslaDea(vs u) eeoif3oydoaDrlnes t texo(mpnydoltnlnvslsfaDta(mpou1aetnmociasfsDem( o (4artnxr io1omtrau i;s)texo(rpoo1alenlnctas)aDtmur ot0oee moetasfm em( p;u) rtrio3oadlptrlieo;t0srtr(r no4lp  lnciat)aDua(m ;o1tptnmf3tysls2rlnmpn(0 rtrmr oy1oaD livs;t s2uo(m3nodap nmfet sfs2taxm ;t1tex ii3ildfs2um( p;u) rtnxfctydom rluvo;t0texoimpnu4op e nvsat s2ra(mp;u1tet iieiytfa2eauvp u0 rtrir3iydlmDe n slt)s2xrirpoo1op  miesltfsrtaum nt1alen i3ildfs2ra( sn() rtrmf3tytom e nvi t)t2tr(m3iydol elnctas srra(m ot0optnmoetys aDelnmont0arermf oa1om e ieo;s0trxmxr3iodolenlies ( arururoou1ope iociytls2emumo t4aetoir3ia1fm  lieo (0teum(rpnu4ll nlneta(  2ra(rpou0tpxomi3iydla rl(vs;t) lenifcoatfpt ln i;t srxrir3nu4apenmfcslt) Dua(rpnu4tetnmi3iatfm2rmuvs u0areoio3ty1fptraivslt trtm(m nydome  ncsasf 2urx pno1opxn ieils mDeaumsnu)aexomr3tatfpt aueo t) 2triopoo1opt  fesa()a2ra(m no0optnmoetys a2umuvsn(4aetoir iadop elivo;s srur(mpno4ol e nct s)aDraurpot0tlx  f3tlsfmDranmp;t4aexrircoytfp e ivs t0tetmxrpoodom  mfvia(  ruau ono0aptnmictldlm2umnvp (4texrxr oatfp e n olt seumxmpny1apenlncia(  Drau  nu4aetoiictltfmDemu snt)arenxrcoodoa  aieo t0 rxrimpou4ale mfetlt)srra( p;o1aetn fetyd mDelnvp;u4 rxoxo oy1omDrlneo;t t2um(r ny4lleelnetasf Drm(ront4apx iociat mDrm(mont0alerxf3tadfaDe nvo;t0 rxrxm3no4omtelnes (faDum(  oo0aptnmf3tadfmDrm(monu4arxomr iadlmDr ivi;( tetmim3ou4apee fct s)aDrrx ono4apeoio3iydlm2rmn s;(0teeoifcto1latelnes;s)sexoio3oodalenmncils)a2ur(mo;o0tpeo ieiydls rlnvpn()trtrirciy1fate ivi t teumxo3iudapenlfeil()srumx  ;u1texn iciasfmDrauvp;(4 exrxf totla  livi;t trxo(opiu4oltelnci s s2rr(mpot0teen ieiyt a uanms t)alxrxo3ty1fpteau s (0 exm(rpio4ameelies (f 2ur(mpnt0apxoiiciasfm rm(msnt4trxnxfctodomtrli ol(0srxrxo iodllt miet sfaDrm(ro;t4ape mociytlaDrl( o u0trerxf iodfmtr u ils)sexo(r io4omeelivs ()a2tm( ooo4opto o3iatfm2eau s (0 eenmr totlpD  ivol(0 rxmxr3ny4op nmneilt srtmu p;u0alenmieiyd s em(vsnt)trtoxfctodfatrau i (0teur(opio4altelnei tf rrau ono0olxomo3tlslm2rluvo;(4aexrif3to1fatrlu s t t2trxo oo1am n iei tfsrraur oo0tptn ieiaslm rmnmo;(4tltoir totfpDr uvs s) rtrio nodole lncs s sDuax oou0tlto f3tltfaDulu s;t)texrif3ty1lpDe n i;( t2xrxr3no4lp e fvtls)arrmxrp;u4oltnioeild s2ranms;t0teeoifcoatop rluei;(  2urirpno4lpt mnvs s  2ur(r nu0aptnif3tldfs rm(mon(0tltoioctotfm   n slt) exoxrpiu1lleelnesas  2ua(mont1tlxoiiciad m2ulu snt4aexnmf3tydoat  ues;s)trur(m nodapeelnctlsf rtaumpot1tex  oeilsfm rl( s;u) reomf3tadlmteluvils)srxr(m3no4al   ics ( aDua(mo;o0tleomf3iatfa elums;(4aexoxfctytoatr ueol() 2xo(o ou1lp nmfesatf rum(  ou4alt ioeilsls umuvsn(4 eerxo oadfpDe ies (  2xrimpiodlle lieiltfarururpot4tet if3iatfmDumn o (0altomo tydfmtelnvi;t)texmxm3oy1lpee fcias srtr( onu0tlx ifetydla rl(vo ()arenir3iadoptrauvils0sexoxmpiy4aptelfviat s2trur nu1tlt iiciydfa umumo (4trermocia1fm elu olt0 2trxo3nu4ome livsa(  rum( onu1opx  ictaslaDuanmp (4treoifcto1fmD li s;(0 eum(r io4lleemnesasfsrtmx ont1teto o3tadfm2ra(vsn()aeeoirciotlp r nvs;t)sexoxr3ou4ole mfes tfsrumu  ;t4oex mociadls2uaump;() ltrxr3iydlaDeau i (0seumxopnodll nmnvtls)a2raxrpnt1opxoiieiytlm2rmnvsn(4 eenmo3ootopDeln i ( trurim3nu4amen nvsat s2urx p;o0tle mfciasla emumpnt4aetrxo3tydlm elies;(  2uoxmpoydalt mfeta()a2ra( p;o4tetn ieiasfm2rau pn(0artnmr oadlmt  ies ( trtrxm no4ll  mnctas aDum(r no1teeo i3tldfsDea(mpn(4 rerif oatlmDr nvi t) rto(mpny4oltemfetltf 2rmum ou0tpx  o3iysls2umn s t4 lerxr oodfa e uvsls) euoxm iy1lmtemici s  Dtmxro;u4aetnmoeias s emuvs;(0aetomo tydfaD aueo t teur(mpoodll nlnvi t)a2urxmpot0alxn ietltfa rl(vont4tlxrio3tatomD lu o s srum(r ny4amen nvtl(f 2ta( onu4tlx iictyd aDrluvsn(4 ltnxr3oadlm  lieilt0 rtrio nu1om  lfvil() 2uau pou0oleomi3iasls2ua(vsn(0 rtnxf3oatoat  nei;()t2xr(opnu1am  licta( a2uru o;u4aetnmieiyd s ea(mo;() eerxocoatlp eaivi (  exr(mpiodlp nmncias a2umumo;t1aexomfciyslaDuluvp;(0 exrif totla elivs;()srumiopiudlp  mnct tfsrtrumoot1aleoii3ild sDrau pnt0teenxo3ia1opDrau s () rurio nodlpenmfvtas arrrxr nu1aet  oeiys m ulu p;t0 reomr3tytlatr ieil()sexoxm3oy4lm e ncsl()a2tr(m ou4tlen iciatfa2eau s (4 lenmr3tadoatr nvol(0 exoxm ny4am  lncsat)aDtrumpot0apt iociyd s ulnvs;u)teenir oy1lat ln i s  rum(m no1opteliei tfarur(m ;o4opxnmfeiydlm elnmpnu4texoxf3todlmDe n i t)srtrxopoy1lpee feilt srtrumpno4openioeiasfmDrmnvsnu4trenmr oatop rau s;s t2xmxr3oy4omeemietasfs2rm(ro;t1teenmfeilt aDrlu o t) lenxrcoytfatr nvil(0 2umio3ou1lm nmici () Dtmum nt1tetnii3ils mDul( onu4texrio ia1fmDrlivo s)s2urim3iu4omtemneia() rurumont0optomfctytfm rmums () exnmf3iodfa e i sls0t2xoxm3io1alee ivtl() Dtax pnu4alenifciyslsDelnvo u)aetoxr3ty1lpD  ivi;t)trtoio3ou4am   netas)a2rr( oot1openio3iydlm rlnvo;t)tetnmo3oo1lpDelnvilt) 2urxo oodoptnlfet (f rum(ro;u4alxo o3iytlaDelnmpn(0alxoxo tatoptrai i t srtoiopoo4lptnlnci t  Duaumpou4tpx  oeiat s2ranms ()artomf3oo1lp r ivo s trtoio3nu1omtn fetl()a2tm(mpno0open ociydls emumo;(4tetomf todfmD lnes;t0srurxo3io4lpt mivta()aDtmx oou0tpt moetad sDumu ont4tlerir3todlm  luvi s0t2tr(m iy4lle  neslt)sDrmu  nu4alt ifctltls2uanvo u)arxrxrctadom e u i;t0teuo(m ou4lmtn icilt)a2ua(  ot1aexn fctlslaDelums ()tlxrmfctatop  livs;()s2xm(r io4ap  micsas  2ur( pnu4tlxo feiydfs2rl( onu) lermo3oy1fpte nvi;t0 eurxmpno4ol elncsat sDrrxr ;t4tltnmi3tatfs emumsnt)artoif3oy1om rlnei;() 2xr(m3nu4olte nvsl(faDrmxmpot0aptnioctys mDumnvp (4 lxomf3tadlmteaivs;s0s2to(opnu1opt lfeias  ruaxrpno0texnifeiydfm rl(vp ()trxrmf todoa   ieils0setrxm3oy4oltn neil() rraump;u4aee iicilt s2ua( snu) rxoiociy1lpt  ies (0truoim nu4am   nvtat a2uaur ;o4tlt mfctydfa rmu s;u4tltrxo3iodlm eauvs (  exmxm3nydol   neil()sDrax p;u0aleo fcilsfsDea(mp;u) etnioctatlatran o s) 2tm(m iodapte nei t sDurxr ot4tetomf3tls s2eau o;(4trtrioctotoat li o;s0 2um(o3oy1lmte nvta(fsDrr(m ot0openif3tadla rlnvo u)artrxf tatfatelues;s t2to(r nu4aptnlnctltfarururpot4tetoioetyslmDrmnvont) etnifctatfmte u sls)seurio iu4altnlict t) Draur nt1altomoetydfm raump t0 ltnxr oatop elues t)trtm(r3iydlptnlfeilt)srum( o;u0tlt  fcilsfm2em(mont) eerio3to1fa rlieils teurxm3oydlleelietlsfaDtr( oot1aet mi3iadls uanms;(0texnxo3oa1fmDrluvi;t0 exm(r3oo1ame mfvils) 2rm(rpnu1oex iiciaslmDrmumo (4 eenxf3oadlpteli olt)srtm(r3oy4om n ivsas) 2ta(m ;u0oee  o3tyslsDemu p;(0aetoir3oydomtrlu ils0srum(r3oydol  mnvils) 2ta(m ou4olx miciytls ul( p t0 exoxr3oo1laDe i o;() etrir ou4al emfesl( a2rmumpnt0aptoii3ildfm elu o;t0 lxrmf3ty1lateluvo;t)s2xmxmpny1ap emnci (f Duru  no4apx  iciadlmDel(mp;u)artnxfcootfptelu o t0srtrim ou4lm  lneiat srumu  ot4tpenif3iadls ea(vonu0trtomo3oa1fmD lnvo s tetoxm ou1lpeelicslt  Dtaumpnu4oetoio3iysfa2ranmp t)aeeomo oatfmDr ueils0 eurimpoo1ap   nesls)a2taxr ot4tpxo octldlsDuanvs (0areoirctodlp e uvo (  2urir3ny4apeelnvtas)arrmum oo1aeenmo3ils a2ul(mo;(4arenio3to1lmtraivil( tetrxr oodlme lfetls) Dumuronu1tee  o3iaslm eanvo;(0teeomr iydfptelues s0 etr(rpny1om elictl(f Draxront4aleomo3iysfm2el(msnt)tlxoxo3totlm  an il( teuo(mpny1llt mfetltf Drmu  ou0opeomoeiyt s rm(msn(0aetrmo iadomDeau i;() 2tmxo3ou1altn nctl()arta(r oo1ope iicilsls ranvsn()trxomf3oy1lmt aivils0t2xoxr3oudoptn ncsl() Dtaxr no0teto ieiydfsDeau o;(4aexoifcty1fpDeln i (0trtr(mpoydlpeelnvtltfaDrm(  ;o1aptoif3iaslsDra(mo ()aleriociatoptr n s;t)s2to(o nu1openlieilt  2rr(m no0aptomiciysfa2ean p;u4aleoio ta1fpDe n s;s0teum(mpiy4lpee nesl()srumu o;o1tlxn o3iaslm rlnvs;t0texnir3oodoatr nvi t) rxm(r iy1op emivta(fs2rmu oou0texoiiciyt m2umump;u4arxoxfctydlmDrau ils)teurirpoy1ome livils)a2uaurono1olen fcildla eanvsn()artrmf oa1op rli o (0tetrir3io1omt  nvsl()arurxr ou0teenmo3tydfm um(mp t4alerxociotfaDelnes ()t2tmxm ny4ale livtls  rum(mo;o4apxo i3ildfsDemn on(0tlerxfctydlptraivils) euoxo3iodlltemfvsl(f rur(mpoo1aexnmfciadls rmn s;u0 eerxf3oytfmteai ol( trtmxr nu1am  lnctls  rrrumpou0tlx  fciat m2umn snu4alxrxocoadfa rlieolt  rtr(m ny1lptnliesa() Duaump;t1apen octasls em(mont0teeoio3to1lpt aueilt seurxo ou4oltnlfvtlt)srrrxrp;o1oltoii3tldlm2emn pnt0arxomoctatom e neolt0s2to(o oy4ap elfcs t srtaumo;t4openifeiydlaDulnmonu4aetnif3oy1opDelivs ( s2urxo no1lmtelfvsa() 2tax o;u4aleoif3iat aDemuvont0tlxnirciy1opt lueol(0s2xoxm3iy1op   fvt t srra(rpnt1tpxoif3tlt m2rluvo ()alenmr3ootlaDr iesls0t2urimpio4ll elncil(fs2rrxmo;o0ape ifeiytlm emumo;u)tetnio3oo1om elnes;(0 2tmxopny4lptemivsls) Dtm(mont1alt  oetadla2eanmsnt0tlermo oa1lmDr ivo;t setoxo ny4opt  feiat)sruru  nt4opt mfetyt s ulu p;t0 ltnmo tadlp raueo s) rtr(o3iu4lp nlictat s2ra(  no0opxnmfciat a uaums t0trerif3todop rai o ()t2toxrpoydalen nctatf 2uax o;o4tlen oeils a rmumpnu)trtoxrcoydfat ln s;t0trtoiopoy4lleemietasf rtr(rp;t1opxnmoctls a2ea( p u)alermrctotoaDr n s;t tetmxm iudoltn ietas) rtm(mp;u0alxo oeiltlmDra(vont)arxrmoctytfmt  nvs;s srtm(o ny4lpeemnvs () rum(  no0olx io3tatlsDumn on()treoir tytfate uvo (0s2xr(r iydamte fvsas)artaumo;u1ole  o3tasfaDraumsn()trtoir3tydlate nvs s0s2trio3oo1ll elnvsatfs2ua(m oo0oleomf3iytfm ua( s (4 exnmfcoytomtrai o s t2xm(m3iy1amtnlneiatfsrur(rono4oeen ieild a ul(vsn(4 etrxo oo1fp rai olt srxoir3oudlpee iet tfs2umu oot1tet ifciytls emnvp () eenxo3oadomteli ols) rxr(o3nodlmtn icsls) rrr(mpno0tpenif3iyd mDrlnmp;(4aexnxr3tytlpD ln i ()t2xo(m nudapeemfeta(  Duaum nu0tleomfetadlsDelnmsnu)trxrmr3oytfp   nvo t)trur(o3oy4alenlnei s  Dtm(mpnu0opx io3ildls2umu p;u)tetoif3iodlm e nei (0trxrim no4lptelnci s)s2rmu  no0olxnmieiysls emnms;(0artomo3iodomDr ueils)t2uoirpny4ale mivsa() rur(r nt0teenmoeiadfs um(vs;t4 rxoxf iatlmDe neo t0srxoim3iydap n nviatfarum(mp;o4altnifeiadlmDrau o u0 etoiocto1opDeaieo;( sexm(mpoy1om  mfes t artm(ront1alenio3iasfmDean o;(0aetnif3iydoa   uvs;s  2xm(r ou4olenmfesl(faDum(mpoo4aex miciytfsDea( p t)alerir to1optr nvi (0truo(r oo1ap n neias) 2rr(r ou4aexnmociyd sDrl(mo;(0tltrxr io1fp   nvsls) rxo(o oodamtemfvtl(  Dra(rpot1tpt mf3tydlaDeln o;(0trenxr3todopDe nvo (0teuo(r nudop nlnvslt)aDrrxmoou0aeen oeiaslsDranvo u4tltomf3iydomDe iei s0seumxrpnodap emict t) 2trx ooo0ope  octatla umu p;t0aexniocootlpDeaivo s) rxrxmpny1am emfvt s s2rrxm ot4apeoifctltla2emump u0 rtoif3iytfmDr nei t  rurirpnu1lpt lictlt) Dum(r ;u4olxomfciltlaDrm( s (0altoxf3oa1laD livsls0sruo(r3ny4amenmnetl()artmum nu4tpt io3iatfm2uaump;u4aexnxrcoo1lmDe iei;t teuoir3no4omtnmfesatfs2umx ont1tle  fciltfa eaumo;(0tetnir oodlpt li o;(0 etmim3oudole mfetltf Duaxrono0aex ii3iatfmDra( o t4tltomr ta1fatraivol(0srxo(opoydome livi tfaDtrxroot0tex ifetytlm uln o;u0 eenxr3iydfatrlnvi;()srxrir3ou1am n ncias a2uaxm ot1altnioeiys m2rlnmp;t4 exrif3oydopD lu olt0 rtmxr ny1oleemncil(  2umurp;u4tptn oeiad sDrm(vpn() exnxf3oadlp ran s;(  2tmir ou4ape lfvi sfs2uaumpnu1apenmo3iytlmDuau p;(0 lermf tytopDeauvo;( t2trir iu1ap  lfci tfsDrmxront0apt  oetldla2el(msnu)trtnmfcoo1fa eaneilt0 exmxmpnydlm emiei s  Drau ont0tptoii3tad m2um(mpn(4trxrxociatom eliei;( t2tm(r3oudapt mfes sf rrr(m nt1aetomoeiat s uln snt0artnmf3oatlm rlieslt)texoio3no1apee fvilsfarrr( ont0opeo i3ildfs rmnvs (0alermfciatfpteai sl(0setoir3oudlmenlicsls)sDta( o;o4tlt ioeildlaDraums (0 rtoir iy1fm rln i s0sexoio iydoptnlncta(f rtru  oo4tpxn f3ilsfa eauvonu4tetnxr3iydlptranvo t)trumxm iu4ol  mivtatf Drrxr no0olxo octld a rlnvonu0alxoif oodlaDe ivs;t seuoir3ny1lmtnlfcil()srtm(ro;t0tpenmfeildfm2rlnvp (4tetrir oo1oate uvs;t0teuo(m nu1am nlfetl(  Drmuroou4tpto ociysfs2ra(vp u0 renxrcto1omDr nvs;t)srtmim oodlp n netls sDtaxm nt0tetn ietatlm2em( o;()tlxrxf ia1optr nvs;( s2tm(r3iu1omeemnvtas)a2rrumono0tpxnmo3iatlmDumnvpnu0teerxo3totfaDelnvs (0 2umio3iu1amtnlnci tf rtmxmpoo0alx  fctas s2rl( s u)aetrxf3oy1laD  i s;s  rxoxm3nu4lmee nct s arururo;u1olx miciytla2rauvp t) etrmfciy1lpDrlues t s2xrxm3nydap nlfcs ()s2tr(root1oeenif3iyt s eluvsnt) eerxfciotom rlneo t trur(o3iu4op emfvil(f rra(mpou0tptomoeiysla2ranvp;(4trxnif3oadfaDr ivs;t)srum(m ou1lme lfvils) rraum oo4ope  fetys m uluvp;u4 ltoxf ty1om rlieslt)trxm(r oy1lp  lneil(fs2um(rp;o4aex  octat a2rmuvo t0 eeoiocoytfa   ues;t) exm(r nudap  mietlt  rumxr nt4optoiietls s ra(mp;t4 etrxr oy1opD lnvi s teurim oudlp   fei t)aDrrxm ;u4oetomoeiat a ea(vo u4tlermr3oadlmte ueil(0srum(o oydomen fvt ( arrr(mpot4oeto oeiyslaDrm( pnt)areoir ty1op rlnvi s  rtoir nudap n ieslt aDumur nu1texoifciltfa2rlu onu)trxrxr3tatoat aues;s sruo(m3nu1openlfetas a2rrx o;o0ape mf3iaslmDranmont4 lenif3todoptrluesls t2uo(r3iudomt mfcsls  2truroou4optnmoeiyt aDrm(msnu4trerxoctadfaDrau o;s0 rtrir iy1ol nmnci ( aDumxr ;t1oltomoctysfs2elnvp;(0aetoir3oodop rlivol() rxoio3iu1am   ies (faDtaxrp;t4aetnmietls s2eln o;(0tltrif3iytlm  ln o;s)t2trir3nydol nlivsas srrr(ro;o4ale if3tasls em( pnt0 exrxo oodla  aiei ()texmim ny4ameemici tfa2tr( oou1olt ii3iytfaDrmu on(0tetrxrciatopD  uvi s0 rtoio3ou1al n nvs tfs2rm(m oo0tlt mo3iat s2rl(monu0arxnxo3iy1laD  u o s tetr(r3no4lp nlfeta()aruax o;o0apto ociltfsDul(mp t4texrxfciadfaDe i s;t  2trxopio4lle  nesl(faDrr(r ou0tpxomictlslsDrl(vp;() rxoxociadfp eaieol(0 eur(o oy1lpeeliet s a2tmx pou0tlen o3tatlm2eaumsn()tltrif3to1fm elnvi (0srumxmpoy1amenmnes t  rum( pnt1tet mfeiasfaDumumpn() rxnif ootfp  ln i;( trtm(opiudamenmfvi s  Dtr(m ;t4teen feiytfm rln snu) etoxo to1lm rau sl( texo(r3iy1al  mics (faDumumo;t4olx  ocias a uau p;()trtomf ootlaDr nvols0t2xr(o3oudom   ict t srtax onu0tlxoioeiyt m ra( o (0aeerif tydoatelies t0trumim3nydome mneiatf 2raxmonu0tpe  oetysfmDranmp u4tltrxociodfmt auei t0srtr(m3oydal  lncsa(fartau  ou0opxo fetltfm rl( p;t4teenmrcio1oa ran i;t t2urimpoodol  lnvi s)sDur(  ;o4opx iietat mDel(mon(4trxrxf tatomte n sls0s2xrxr3nu1am e feiasfsrrmumonu4tex ioctat m2ua(vont4tlxrir3oo1lp e iei;t srumiopoo4ol e netl( s2rrxmoot4tlxn i3iasfaDeau o u)tltnxo tydlm   ueo s srtrirpoy1optn ivsls a2rrx ont4opt  feiadlsDrmnmsnu0arxnxf oodop  ai ols)seurio3ny1ameelictatfarrr(rooo0tpxo ictysfmDrl( snu)texoir3oadfm eanvi ()s2umxrpnu4oltnmics s  2umuroot1ope  ociatla2ran snt)aeenmf todoaDeauei;()trurio3oy1ame  nes s) 2ua( poo4optnio3ilsfs2ua( onu)artomrcoy1oa ranvi t)t2xoxm oy4olte nvt (fsDrrxrpot1oetoioeiydfmDuau snt4 renxr3iadomDeluei;t) 2trio3io4openlivs ( srua(  ;u0alx mo3tldlmDemuvo u) ltrir3oatlpteaiei;t0s2to(opoy1lmtnmfvilt  Duaum ;o1alen o3tytls rm(vs;u0 rxrxo3oo1fmt lu i s)s2umxmpny4op e fvia()a2ra(  ;u0aeeo fciydfs2um(von()trxrmoctotop eai s;s  exm(mpnydol  lfvi () rrrx ooo0alt ifciytfaDem( s ()tlenmfcoatlmDelnes s trto(opnu1omenmfcia()a2trxmp;o4tpx moetad mDra( p t4arxnif3oatlp e ivi s trxo(m iu4llt mfct tfsDtr(mpot1teto feiatlaDrmnmpnt4tltoxf3io1op elu i;()texoir3io4ll emnvtlt  2ra(mpoo1aexomietat m ea(ms t4 exoir tydfa ranes (0t2xm(m nydolte netls) 2uaumoou1ole  o3tldfs el( o;t) eeniocio1opDelu i s  exmir3nudlmtnmicil()arrax  nu0oltniietytlsDrm(vs;u4aeenxocta1lm rli o;()trtrxm3nu1aleemivias)aDrrump;o0opt  iciytlm2uln pnt4aexrxr3ta1fpt  uvo t0t2um(m oo4optemictatf Drmur ;u4tpx io3iyt s2ul(vs t0aleoxociy1oa rluvs ( sruo(r iudop nmfct sfsDuau pot4alxnmfciatfm2uanvon(0alxriocta1fa eanesl() rxm(mpiydlmtn fvilt)srrmu pot0oeeoif3iltfa2ua(vp;t) lxrio3io1fmte u s ( trxrxm3oy4ll nmiei t  Dtrxm ;o4tetnmf3iydlsDum(mp;t0teeoif3oatlmDrai s;t)teur(o3ou1apt mict (  2rau p;t0oet ifciytfs em(msn()arxrxocto1fmtrli i;t  2tmxrpoy4am  liet s) 2umxr nu4opeoifciys mDemnmon()aetriociadfaDr uvs t) rtmir no1am e fct t  2tmu p;u4aeenioeias aDelums;()arxomr oy1fpt  nvol(0t2xr(opoo1opeelnetat  Dtrum nt4oexo ociltls ea( o;t) exnmfcoytoatraieo;t)s2tm(mpio1op n fcs s a2trxr nu0apxnmfciasfs um(vpnu0 ltrxr3tydlm e neolt0sexo(m3io4altemictl(f Draur oo0teeomieils m umumonu)teenio3totfateai s;s0srto(opiu1optelfci s)aDur( oou1aex iictad a eaums t4aetrif to1lmDrln s;t  ruo(m oy1omeemneils s2trum ;t0apt mo3iysfaDran p t0arxrio iydop r n o;(  euo(rpny1altn fei (fsDur( p;o0oex ifctasls2el(vonu4artoio oo1optrai i s0tetmxopoo4ol nmnct t)srumx ono0tpeomfeiat s emn pnt4texomo tatoaDr n sl(0 rurio3iy4am n fvil( a2rm(ront1aexoiictldlaDelnvp;t)alerxoctotlmD  nei;t)sruoir3oodalenmicsatfsrrr(rono4tptnioetls sDemnvp (4 lenmo3tydoat auvo;() ruoxm ny1lme mnesls srtrx  oo4aex  i3iysla ran o;t4 eeomrcoadfm  ai ils0 2uoiopio1lmtemnei ()s2tmxm nu0aeeo o3iydla2eluvo u0texomrctatlpDrli ils0srxmirpoydopt  neslt)sDtm(  ou1alt  oeiadfaDulnvo u)trtrmo ta1fm e ueo;s0texo(mpiudlpeelfesatf Dra( p;o1oee moeiad s2rau o;u0 lxrmr totlp elies (0t2trxmpno1op n nesa(faDtau  ou1opxnmoetls m2umums;(0artnmo3totlmtraneo s0 rurxr iudap   nctat) Dumu pnt0apx moeiys sDem(ms;t0arxoir tatlmD  u i s0sexo(r3oy1lltnliviat)artaxrpoo0tptomociydfa rluvp ()teermo3oo1lmD  n s t t2to(r3ny4llt mnetasfsrtrumo;t0tpe mfciatls emuvo;t0artomo3oydfateaivi s) 2trxr no4ll   ieta(fsrtrum no1oltnio3iydfsDran o;t4 ltomr3iytom  livi s0s2xmim3iy1lmeemfvs (  rtm(m nu1oexnifetldfa2ua(ms;u4trxnxf totlate nvo;s  exoxo3iu4om  lnesltfaDuaur no4opx mf3ilsls emu onu0artnxf3oytomt  u i;(0 2xmxrpou1al elncs tfsDtru pou1oltomoeiad s2ulump t0 lermocto1fat lnes;() ruo(r3iydoptnlncsa()sDua( ooo1oet  i3tys a uau sn(4aetoir3oytlm rai s t0 rtrxm io1om  mnetatf 2tmur ou0tee  ociatfa2rm(vpn(0trtnxfctadoaDe n s;(0s2toxo3no4am n net s sDrmumont0tpt  ieiytla rm( s t0aetrif ta1faDe n sls trumxo oudolt  ncsls arrmur ot0teeo oeiyd a uluvs;(4 rxrmo3tatom elueolt texm(m3oy1lm n ncsl(fa2rmu oot1oet  o3iatlm rauvo (0arxnxrctadoaD lnei;s) exmim nydolee ies sfsDrax oou0tleo o3tadfa rm( o t4aexoxr tadlmtelu s;s trxoxopoy4al   ncta(f Dumxmoou0tetnif3tlsla emnvpn(0 rtrmo iytfaD lneol()trtr(o3iudameelfvsas) Dumx  ot4aex miciatfm ul(vs ()tetoxfcty1oa  an i s)t2toim3io1altn feia(fa2umu p;t0apxnmoetys s2ranmsnu0 ltnifctadoptr nvo t0s2uoim iu1omee fes sf Dtr(m ou1teeoiociyd s ea(ms;u)aexoio oadlp elnes s0srurxopny4ll   icsat)a2trx  nu1altnmieiytfa ul(mp (4tlxnmf3iotfatr n i t srurxopnudlpenmivia( sDrmxrpou4alto ieiad s uau sn(4aexomr3todopteaivi;s)texr(r3oy1omen fct t  2urur oo4olx  icias aDum(mon(0 etoif3oydom  ln i;s t2uo(r3io1lleemieil()aruax  ;o4oltomo3ildlm2umnvo;()tleoxo iodoaD  uvil()t2urim3iy1op  mnci tfsrtrxmoot0alen icilsfaDelumsnu4aleoxf todoa  lueilt t2tr(opiydamtn fctlt  2rmx pou1opxomiciyslm umumsn(4 rtoxf oodfp rlnvols setr(o3oydoltn fetat aDtm(mp;o0aeenmieiat a2eluvp;t4 lxomr3ta1fa ranei;t)t2uo(m oo4lmeelfci s  ruaumonu1texo f3iad a2el(mpnt4aeermfctydfaD lneolt0seur(m nudolenmici s  Dta(rpoo4olxo iciytlaDeanmsn() ltrmfcto1lpDrauvs;() rtmim3oo1ameemnvs (fs2tau pnu1oet  feildfs rmnvp () reomf3iodfmDean ils0srurio nodlpe lfcilt s2raxront0alx iieiad a2ul(vpn(0 lenmr3tytfmtelivi t s2toimpoydlpt lfei s)srtaumpno0aexo fetas m ulumpnu)tetrmo3iydoaD anes () 2xo(r io4altn fvilsf Dumurpnt0ope io3iaslm elnvo;t0artomocootfaD li o;s) etrxm3nu4lpt  ici tfsDuau  no1aetoiietysfmDua(mo;u)trtnif tatlpt anvo ( sexm(o iu4lpe  ietas sDrax  ;t4tlx mf3ildfmDua(mo;t)aetomfciy1op   i o;s)sexm(o3iy1lltnlnviasfarrrum ;o0apxnmi3iatfa el( o;t4tltomr tydfmtranesls0trtoxr nudlm  liciltfsruauro;t4apxnmfcilsfa emnmsnt4trenircto1om  aies;()trum(opiy4lmte fetlt s2tmu  ;o4aetoiicilsfaDrmnmo () ltoxo3tydfpDelieolt0sexmxrpio4ol nlivtl(  Dtrxroot0apeniictls a2eauvo ()tltrmr3oadla  lueo;(0t2urirpoy4al emfeslt  Dua( p;o1oexnmf3tldfmDrm(vp;(0texnmr oa1laD an ils) etmxm io4altemfvsa()aruau p;t0tlenio3iyd a2eanmp t0artoxf ia1op   i ols s2umxmpiu4al nlivsls  Drm(mpnu1alxo ietltfs ean o t)alxrxo3iytomDrluvo;s)t2urxr3nu4ome lneilsf 2ra( o;u0tpeo i3taslm2rmnvp;()alenmf3to1fpDrluvi;( srumimpiy1ap elfcilt)srum( pot1tetoifeild sDeln s;u0 lxnxf3oa1opte uesl() 2xrim oodol  livt sf Durumpoo1oeto fciytls2eanvo;u) ltnxf3ia1omD  u o s)trxriopno1ale licils a2trurpnt1tpeomoetys mDel( p (4 eeniocoa1omtranvs;s trtoxm oydoltemivsa( a2ua(rpoo0alxoioeiat m ean p () ltoxocoy1la elueo s  etoir ny4omtemfvt () Dtau  no1alx  oeiadlsDemnvs u) eeoio3ty1omDe ivs;(  2xr(o3iy4oltemneiltf Dur(mpoo4ole  f3iasfsDemn p t) rxoxf tytlat lu s;()texmir iy1apee ivtl(f rrmu  oo4opxnmo3tatls uluvs t) eeoxrctydoaD lnvi s)sruoxmpio1aptn nvil( srur(m ou0aexnmo3iydfa2elnmon() etoir3iodfaDelnvi;(0trur(mpoydlmee feslt)s2rm(ro;t4tpeoif3iyd m rmuvs t4 reomf iadomteln o (0sruoim oy4lm elivi sfsruax  ou4aeto i3iytfmDuaump (0tlxomo3iodomtraneol( trtrxo3oo4al nlies s  2tmu o;u1aleomi3iysfmDuauvon()texoioctodlat  i s s0 rtmir oo1opt lncs sfarumx o;u1aeeo feiys m emnvs t4arermrciatlpDran o;s0seuo(rpoy4lmen nvsat)sDra( onu4teeoii3iyd mDelnmp;(4 rxoio3ootlmtraneols0 2xoxr oo4lltnmnci sfs2rmx poo1tlx iieias a rmu s;t0tltrir3oy1fa eaieo t)srtm(o3nodlm  mnes ()artau o;t1oeeo ieildfm emuvsnt)arxnxr oytfm eluei t0 rum(o no4lmt mieta(fs2rr(  ou0tetoifctatlmDumumonu0arxoxf oydlpD lnvi () rtrxo nudamt mfetas) Durxroot4alx  i3tytfs rau s;t)tltoirctatomD  u o;s)texoiopiodam   fvsl(fs2ua(ro;u1aexnmoetyd a2rm(vo u)tlxoxo3oydopt ln o;t0setrxmpno4amen nvtas) 2rrxrpoo1tlt mi3tytlsDrmnmp;t4trxnxr3ty1op eai o () 2xrxo ny1op n ieilsf Dua(r ;t0apto o3tlsfmDumu s t0 leoxf iodfaDeaieo t) exrxm3oy1ape lnei t  2rau pno0tlt mfctldls um(mp (4tlerio tydfm ean o;t teuoxrpno4opte iei ( srta(m ;u1apxnmo3ildlaDrluvpnt4aleriocoytlp   u ols  rtoxrpnu4am  mivtl(  Durxm nu4tptoifetysfm eanmpn()tltrmo3iydoa rln s (0texo(r3iy4ope mfctl(  2raumpnt4oexomi3iasfa2rm(ms t4 ltrxfctatoat  i i;t)trtoimpio4lm elfvt sf Dtm(ro;u1opt moetys sDrmu sn(0tlxrir3iotlpDe nvo;( srxmxmpoydlp nlfes t)aDrrxm oo0aexnioctytfs rmnvo (0trxoif3tytlmDr uvo;() 2xmiopio1lmte ictl()a2umumonu4olxoiictatla ra(vont)arermrciodfa  ln il(0 exo(mpny4lm  mieslsf Drmxr ou0aexo i3tatla2em( pn(4trermf3ty1latrluvo;t0trtr(m ny4lmt mnvilsfaDrr(root4tee ifctaslmDeln pnu)aetrio ia1fa   ueilt s2uoxm iodam elivi ( artax ont1tltnmoeilt sDrmnvp (4altoio iytfateai s;t0 2trio ny4omeelfvtl( a2ta(r ;u1apxoio3iyd m ulumon(0tleoxf3oatfmtrli sls)t2umirpiodlmee iesasfarumxm oo1tpe ifciasls um( pnt4 eerir3iytomDeaiei s t2xoio3oy1alen nvtlsfsrrrxmooo0olx  oeildla rlnmo u0 rtrmf3oatlpD au o s0 2xo(mpiudlme micsl(farur(m ;t0oee  iciadfmDrmu p t0artoiocto1la elueslt)srum(r io4aptemfvi s sDra(rp;t1aptomfeiadls eaumpnu)aeenxfcty1opDe ivo;() ruoirpny4apt  fvtat  rtm( ooo4tetoif3tatlaDea( s;u4aetrir oatomDrau sls tetoio iudll n nvi sfs2rrx  ;u1alx  f3tldlsDrluvsnt4tetnio3oodla  aues;s)teurirpnydllt mfeia(  2ta(m ou4tle mictld a rau pnu)altoiocio1opD  u i t)s2uo(o3nodlm elfvsasf 2tmx onu0alen fetad s rmnmpnt)aetnxocootfate neo;()seuo(r iy1ll   nvtl(f Dtru  no4alxo feiysfs rl( pnu4arxrirctatfa  liei;s trtoxo iydlme mfesl()aDrrxm ;o4tltnifeilt s eln s t4trenmo3iy1la rlivo;()s2tr(o io4ole mfci t sDur(mono4opt moetytfm2rlu p;u4altrifciydlmD auei s) etrxr3iy1amt lnvtlt) Drr(mont4tee mo3iltlmDulumo;t)arerxf oy1lpteaueo;s0 eumxopoo4ll  licia(  rtrxrpot0oee iieiltla emnmp t4tlerxf to1lmDranes;(0trtm(r oo4apenmfvta( sDtrx  oo1aleomfcilsla2eau s;t0texomrcoytfpDeaivs;( s2xmxr3iu4lm e iei s) rrmxrp;t0tlx iicildlsDelnmpn(0tltnxr3ta1fmDrluei (0teuoiopiu4op  lfeta( sruaumpno4tee io3iaslmDem(mont4tlxnmo3oydlp r n sl( s2toio io1aleemfctasfsDtr( ont1tpxo f3tadfmDem(vo;t0texnir io1omtr neo ( sruo(mpiydlmtemies t)srtaumont4olto ociatfm rau pn()treomo3ty1laD lieil(0 rtrxopio1openmnvslt)s2rmxr ;u1olenif3iadfm el(vonu0 eeoxf3iodlpDeaueo (0trtmxmpnydal   fct s aDumurp;u0apto oetltfsDra( pnu4 lxnxo3iy1omD an i;s trxmxmpnydlmtnmnvtl(fs2ur(  no0alx io3tad a em(vpnt)teerir iydlpt  i s t)seumio3iodll  lncsltf 2uaxm ot4apt ifeiltfs2ea( sn(4 ltnmo ootomteaieil( trxr(r3nydom emicils)arumu p;o4tlxomi3iad s2rm( snt0aleoifcta1fm  lues;()t2umxo3iydame  nvi (fsDtrumpnu4oeenmoeiytfa eau s (0aexnxr3to1lm eauvols srumirpnudopeemfctat sDtmxrpno1alt mo3iaslmDeluvpn(0 exnio3todlaDeaies ()srtrim nodlptnliei () rrrurpot0open f3tlslm rm( s;u4alxrmo3to1lmDrluvolt0 2tmxm oo4lp emivt s  2tmx ooo4tltnio3tydlmDelnmpnu4arxoio3tytlmD  ivslt0 2ur(mpiu1lmen fctas) 2taxr nu0teenmoctltlm2emu s;(4 reoiocty1faD lnvsls srum(m no4llenlfvs tf rurxmpou0oexomocildla raump t0altnio oydfptelnvi s t2uo(rpiodlmte feil(  2uau o;o0olxnmfcias aDrau o;u) eeomr3ta1optrluvi (  2urxm oy1omt lfvtasfaDtaxroou0ole mi3iydlm2emu p;u) rtnio3tadoateln s () exo(m ny1lpenlfvia() 2trurp;t0tlen ictadla2raums u)altrio iadopte u sl(0tetmxo3no4omenlfvi s)sDrr(monu1tpto i3tlt s2rm(ms;u)aeermrcoytom elies;t0texmxrpou4lptemivslt)aDrau  ;t1olxomfcias s um(msn()alxoio tadoa eauvols) 2to(o3iy4opeemnei s aDum( oot0oexoii3tyt s2rl( s u4artoir3iydomDrlnei;( setrio nydlle  fvslt)aDua(rpno4tee iiciysla rmnms t4teeomo3tatfm  aues;()sexoio3iu4llee ics t srtr(mo;u0tetnmo3ils m2eauvsnt)trxnmr3totfaD auvilt s2um(opio1lmtn nvtas) rraxrpnu1olt miciad s2ean on() eermo3oo1oateai s;s)srtoim oy4amt lnet s)aDtmxr no1alxo fctydlaDelums u0 lxoxociydla   ivsls trtmir3oo1lmte fviasf Dur( p;o4aetn ieils s rmuvo (4 reoir oa1om elieo;t)trtm(m ou1ll  mivtl( s2taumpot1apeomf3iltlaDem(vp;()tltniocio1op rln o s0 2xmirpny4opte nviatfsDrrur ;t1alt  i3tatla rmuvs;u) rtrmocty1om rau i;t) eumirpoydlpenlivt ( srua( pnt1tptomfeiyslm eanvp t) etrxr3tydomDeln s ( setmir oy1lpeemncs (fa2uax ont0opeoiieiasls rmu ont0trxoif tytomtrluvi;t teur(mpnu4al  lncil( aDrrumont4tet  f3tadfaDrl(vpnu0aetrmf3iotlpDeau ols)sruo(m nodlpt  nvsat)a2umxrp;u1apxnioeiadfmDra( s;t0tetrxf3iotoaDrlnvsls0 etrxm iu4alenlies t aruaurono0aeeomf3tydlm2ean pnu4alenmo totfmDraivi t0 exo(m io4omt mnctl() rtax poo0tptn oeias s2ran s;() rxrxr ty1fmte i s s)srurxm oo1om nmiei sf rrrxm ;t0tlxoii3tat m uauvpnt) etrxrcootlmteau o t teumim no4amenlivilt)aDrmx o;o4oet ifeiytfmDeauvo;() exrmrcoo1lpDrlneo;t tetmirpoydlm elfcs tf rrrxrp;t1tpenio3iysla ua(msnu0tlxrmo3tytopDrlnei s  2uoimpny4optnmfetas)arta(  nt1tlxo o3iytfm emnmpnu4tltoio oydlmtr nesls s2xrxr3iudam emfei t srtaxroot1tetoioetlt a2rlu s u4alenmo iy1lm ranes s  rtrxo ny4ol  lnetl(fsDrr( p;u1tlto o3ildls2ra(mo;(4arxnir3iodom eai il()srxoiopnudam  lneilt arum( p;t0tpt  iciltla2ulu s;(0texrxociatopt  nvi t)tetm(m iu4aptelfctat) rtrxrp;t0aet ioeiadfm rmn on(4 rtnifcoadfaDr neol(0s2toxrpno4ll nmnvs s) 2rr( p;t4aeenmieiad aDea( pn(4 lxrxo3ia1fmtean 
\ No newline at end of file
@@ -0,0 +1 @@
+ues;s)s2urir3iy4lpt mieil( a2tmumont0aleo fctasfs2rm(vp;(0tlxrxrcty1lp   n i t0srxmimpnudomtnmietl( arrrur nu1tpeoiieiatlm2uanvpn(4texrxr3tadop   ivo t0 2tm(r nodamtelnvils)srraumpnu1oeenioetytlsDem(ms t4 eeoxr io1fatrai slt0setoimpnu1optnlivslt) Dtruroot0olxoiociyt s rmn s;u) etrifciatlpDr nvolt s2xmxopiodapee fct t)artmurp;o1teeoiicils a2elnmpnu0tleoxf3oytlmt  ueol() eur(opiydamtnlivias) Drru p;u1aeeniiciyslsDel(msnu)aeeoxo3oadfa r uvs s trtm(m3oo1omtemfvs (fa2trxrpoo4open ieiad s emnvon()tetrir ootomD  nvo s)srtmxr oydamtnmfes s)aDur(m nu0aetnmoeiysfmDra( s t)trxnxr3tydfaDelneilt0texrxopny1amte ncias srumu  ou0aeenmoeilsla rmump;(4alxnmrcoy1fmteai s;(0s2um(o3iodlpe  nvtl(f Drm(mp;u1tlxnmieiatfaDean snt4tetnmrciydfm r u i t0trxrxm iu4lme mivt s)arumxroot1open i3tlt sDel( s;t0alxrmo3oytfmD an o s)t2xmiopno4lp nmivi s srumumonu0aeeoiiciytls uau o;u4 lenxf ty1fp e nei ()s2xmxm iu1ll  lnvia()arraxrpno1optoiictldls eauvo t0aexrxr3tadlmDe i sl(0seuo(r oy1lle  ivta(fs2tmuroou4opto ociltfs2ra(mpnu)treomfcto1fa raneo;()truo(m3ny1ope mnvia()s2tr(m nu1tlt ioctls a ean p;t4 rerxf3tytfp  lu ilt0 rtrirpnu1lmtnlnes s aDum( p;o1tpe moctas aDemn p;t0trenmo oytoptr nesl(  ruo(r3ny1ome lics t  Duax ooo0ole moctld mDrmnvo;u)trtrxr oo1la r n o t  rxmxmpoudop n iet t)srrrur nt4oee moetlsfs ulnvpnu4 lxrif3to1lp  lnes;( trtmxr io4ap   ncs sf Dta(mp;o1tlxniieiytlaDulu s t0 lxnio ootlmD lueols  rxrxmpnydlpeemneta()a2ururpnu0tlto oeiasfs2umu o (0aeeoif ty1omD lueo (0 2tr(o oodalt liet t) Dtr(mpnu4opxo i3iysfs2rln s u0 rtoiocootlate nvs (0 rur(opio1lleemnct s  2raum ;o1aeeomociltlm rmumsnt) reoir iadopDranes (0trxmio iydlpeemfeias)srtaumo;t1aexn f3iltfmDrau s u4 lxrif iydomtr nesl( tetrio3iu4ap   fvt tfs2rruront1aetomietldfm2ea(vsnu) exrir3iy1fpDeauvsls trumim3oodom emncia() Dta( ont4oexnmiciyslm umuvs t4aexnxf totlaDeln o;s0seuoxmpny4amenlictas) rurxro;u0altnio3ilt m2eln p;u)aetomr oydfmtr ivils0 etmir3no4ameemicilt arur(mpnt4oeenif3tytfa2rmnmp;t0trxnif iodfpteaueo;t)t2uoxr nu4apt  nes t)arrru ono0oexnifctydlaDul( o;t4aeeomo tadlaD  neolt) 2xoxmpiy1llen net t)srtaxmoou1oee if3tltfmDrlnmsn()tltomrctotla   nvi;(  rxo(opno4am   iet ( srrmu ooo4tee mfctld a eanmsnu0 reoio3totfm  aivo;s trtrio3ou1lleemieslt aDtrur ot0tlxo ietldls2eauvont0alxrxo3oodomDelues t t2toim nu1op nlnesa( sDumumoou1tlen i3iad a2ea( snt)aeeomf3ia1opDeauvo;()sexmir3ou1ole lnvi t  2umur ;u1aet  o3ilt aDraumo;t)aexrif ootfp eli i;(0t2xrir oodll  miei (  2tru  ot4alt  f3tld aDrlu p t)alxnmf3oa1fp   n o s) 2ur(r3nu1lp e fetls)arumu  ou0tpxoifeiltfmDumuvo u4 ltoxo3tadfpDe nvs;t  etm(mpnudolt  ict (f Dtaumpnu1oeto fctadlm2ua( s;(4trtrmfcto1opte ivil() rumxr oudoleemnvil()srumxmonu1oltnioetlslsDuan snt)tltnif3oo1fmtelnvilt t2xmim3iydamt lnvtas)s2umx oot1tlt  oeildfs elnvp t4 rtnir iodfmDelneils) 2umxr3iodlp  lict t)srumx  ;o4alx mocildlaDemu p;t)aetnmo3iatfatrau o (0tetmxo oydope  fciat  rrm(  ou0altomfctytfa umu s;u0aexnxrcoatomDeanvslt t2xoxm nu1lme  ieiltfs2rmxrpnt0tltnmociysfaDrl( o u0aeenxf3tytfa elnes;t) rxm(o iudoleemietl(fs2tmumont1tlx mf3ildfs2eauvp;t)trxrmf oa1fatraivslt0 2xm(mpno1ape mnet sfsrurxmp;u4tptnmfeiydfs rmn p u)arxoir tatop eaneo;t sexoirpoo4ape lfvsat sruau  ;u0optoifeiyd s2rl(msnt0 lxomf iadoaD  nvs ()sexoio3ny4om elnes tfsrumx oou0opxo o3iys mDuluvo (4tetrxr iytfmDr ieo;t0 exoir oudll e ivilt  rrr(mpnt1oeenmf3iysls2rluvp u) ltoxfcoa1fptrli i ( trxoirpnudal  livta(faDrmu ooo1alx if3iaslm2umnvo;u) rtrio3iy1omDe n slt0setr(opiudalt  feslsfa2umu  nt1aeto i3iytls eau snt0tlenxo3ia1oa   ies ()t2uo(m3oydolenmfeia()s2rru ooo0olx iietyd a2rlu pnt) rxomfcta1la rlnvo t tetrio iodomt  nviasf 2umur ou4ole  fciytlm umumo;u) ltnxociy1fatrln i ()tetrim io4lpee ics t s2umxrp;u0oet ifeiydls2uau o;(0 rtoxo todomDelu il(0t2xo(rpiodole  ici s)aDumumpnt0opxoii3iadfa2umumont0 renmrcoatlpD anvi ()t2xo(rpnodop emivtlsfsDtrx oou0tle ioctyd sDrlums t)artnif iotla rluei ()sruoxm nudlmtn fvs tfartaur ;u4aexnioeiyt a2em( s u)trtrxoctatopDe ueo;( t2xmxrpou1lmee ict s aDum(rpno0tpt ifeiasfm ranvo;u)alxrmo3oodfate ieols)setmxm nydoltemicia(f Dtr(ro;u1tlxniicildlm el(vs u)texrxrcoadfa e uvs;t0truo(m3ny1ol  lfeiltfsrua(moou0oetn o3ilsls2emu o;t0trxnio oodfpDe n i () rxo(o3oudapt liei (  Durx onu4apen i3iysla2em(ms;u4aexnmfcoytlp e n sls trurirpio1amt mncsl(f rtm(rooo4apt ii3tydfs um( p;()tltrir3oodomtr ieslt srumxm3oy4am n nci s)s2ta(ro;t0opeomoeils mDem(msnt0aexrxocto1opt  nvs s)sexrxopnudom emnetls srururpnt1oetn feiasfm ulnvp ()trtrxfciotfm elivilt0s2xoxrpny4oltemieiat artaxmp;t1aexnmoeiytls2umn sn(0alxnif3iy1fpDrluvols)srtr(r3ou4lm n ictatfs2umumoou0oeeomfetyd a rmn on(4 exoxr oatfa rlivo;s) 2toiopio1lm   net tfaDtr(  ou0tpeoii3tadfa emn o u) lermo3oodoat luvo t)s2xo(opiy4lm nmiesasf ruaumooo1tlt iociat a ranmo;u0 ltnmrctydlp elu o ()s2xoxm iy1ol n iesls s2rmurp;u0aetnioetldla rlnvo;t0trxrmf totfa e ueslt)s2xr(m3oo4ope mietltf Drax p;o4tpt mo3tydfsDrmnms (0texniocoodopt aueols0setm(r3iu4op   icilt)s2rru  ot1oltomictasla2rau o;t) lxoxo ta1op eau ils0 eurxo3ny4omenlnvtl(fs2trumooo0aleniietas sDumumont4trxnmr3tadop ranesl(0s2uoio oy4ll emfesls  2trx  no4optnii3iad s2umnmpn(4tltnmo3totla eluvslt) 2toxr no1optnlnvia(fa2ta(m ou0oetn fetlsfmDrm( onu4 rtnio iytfmt  ivsl(0 ruo(opnu1opte feias  rta(  nu0tltn feiltfa ra(vo u0trtrxr tytlp eau o t0s2toxm io1apt mnesat)aDtm( pot0olxomoetldfm2rl(vo (0tleoxr3iy1lmD  n s;s0srumiopiy1omt mfvtlt) 2tmxr ;u1tpxomiciytfa rauvo ()trerif ta1fpDrlu o s0s2tmxmpno1amenlncsltf 2umxronu4tptniieiyd s2ulnmp;u4 exnifcoytfmDrluvs s t2xm(m3nudolenmici ( s2rrx  nu0aetnif3iltfmDelumonu4trxnxo ty1fmDraieo t  eumxr3io1aleelfvtl()arumurpnt4oleoifetat sDrmnmon()texomfcootlptelnvsl()trtoxm oo4ame lfei ()srua(root0tpx ifeiysfa2emnvsnt) leoircto1oaDr i slt0s2to(opnydll nlivtl( sDrr(m ;u4tpx  ietlt a2uln o t4teerxf3ootop ean o t  2tm(m nu4apt lnetl( arumxr ;t4oleo f3tltfs ranvs;u4tltomr iadom elu sl(0sexmirpoy4lmenlfcils)sruaurpnt0oleomo3ildfa2ua(ms;t)artoxo3ia1oatr ies t0 eumio io4opt mnes ()s2urumo;o4opt  o3tat s2rm( sn(4 rxnifctotfp  aiei;()setmio iu1lmeeliviatf rtrur ;o0oetomfciytfsDrmumon(4 lxoxo io1lpt aieils truo(m io1omte fvt tf Drm(r nu4tptomfeils s2rmnmpnt4alxnio oy1fm ranesl(  2trim3oudll  mnvsa(fsruaum ;u4oeen icildla2ul(von(4trxomf3tadfaD  neo t) 2ur(mpno1omenlfvil(fa2tr( oot1ale  fctadfa2ulu s;(0 rtrxrcto1lpD anesls0 rtm(o oodlp elivslsfs2taumo;o1tlt  i3iasls ran p;u4artnio iadlp e ueols  2xmirpoo1op emfcsls) 2rrxmo;t4texomi3ilsls2rluvo (0 exrif3ta1faD auesl(0t2uoxm3ny4lptn fcsl(fa2um(moou0aptnmociys sDua(vp;t)aeermo tytomDrau i;t)s2xriopnudoltnlfctl() Dtm(mp;t1tet  iciltfm2eluvs;(0aexnirctydfat an i;(0seurirpou4apt  ieslt)aDtrurp;t4aeeomoetatla2uauvp;t0texoxr3iytop e uvo;s)trtmim3nydaleemfci s aDua(r ;t0apeniocils a2rl(vpn() rxrmf oa1lmt livi;t0t2urxr3iydlmtnmnvs t s2rax pnu1altomi3tatfs2el( o;t4teeoxf iotlmte nei;t)srxrimpiy4olenlnesls  rua( pou1aetniieiyt m2rmnmpnt)alxoif3ootfpDeluvsls0tetoxo oo1lm   fciasfa2rau  ;u0ole mf3tas m2uluvp;(4trtrxrciodop rlnes t0sexrxr oydll nlies s) ruaxrpnt1tleoii3iysfm2rl(vp u0 exrmf iytfa elneo;t tetm(r3no4olenlnci s s2ua(  oo4teeomoctyt m2umnmo;(0 reomo oo1fp  aivs (0 2uoxr nu4ol e ici tfsrtau ono1opx mietltlm2uan s u4 etnio oadfp  ln i ( t2xrir oy1ole lfcs s srra(  ot4olxo ociaslm2eanvon(0trxnifctotoatrau o;s)srxrir3oy4lptnliei s sruaxrpot4tpxnioeildlm2ra(mo;(4 ltoxoctodfpDe u ils)s2uoxm3iu4opte neiasfa2umur ou1tlx  i3iltfa eanms u)trtnmf3ootfmDr u s;s seum(mpoo4alen nviltfaDrmump;t0tlxomociasfaDumums;t0arxoir3ty1oateauei t texoim3oudlltemncta(farta(ro;t1opx ifeiaslmDrlnvo;t4texnmr3tytoa   i s t s2toir3iydlltnlncsas sruru  ;u1apenmo3ias m2rlnmo;(0tltnmo iotomDelu i;( seumxo3ny4alt lict t)aDurxm nt1aeeoifciasfs2rlnvo (4areoifciy1faD lnvil(0 rumiopnydale mneils  2ra(mpoo4tpx  ieilslmDean o u0aleoxfctadlate nesls0t2xo(m3oudllte ieil(fsDrmxr nu4tpeo ictldfs ulums;u4 etnir oadomt  neo;s)t2xrxo3iy1omenmnciat) rumu  ;u0aleoif3tltlmDraumpnt)alenmr iodlmDelivsls) rxrim3nodlmt  fcilt)aDur(monu4tpxniieiadfa2eau pn(0aexrir3ty1lpt  n ols) rurim3ny4lpenlicils  Drmu p;u0tlxoioctldlm2ul(mont)aetomo3oodfpD li ils s2trxr oo4optnliet ()arum(  nt1alxn f3iydfs emn o;(4alenmrcoytoaDelnvolt  eum(m3iodaleelnvi sf Drm(m no4aeto oetltfs rmums t0aexrmr3ty1fp e u i;s)srumim nodopeemnvtlt  2tr(mo;u4apxo f3iytfm em( p;t0aetriocoa1fa rlueilt  eum(r3ou1lm elietlt)s2uau o;t0oeeo oeildla2rm(vont) rxrmfcoodoat aivi;t  rxoiopnudopeelncs t  Drrxmono0tltnioctadfa2um(vp;t)tetrxo tytoatr ieols) 2uoio3nu1apte nvsas) rtmx p;u0aleomi3tls a2el( s;t0tleoxf3ootoptr nvo;s0 ruo(m3io4apeelfvt t aDrrumooo1apt mfctydlm emn p;t4alenmf oytlaDraneo t)trtrxmpoo1lpt  fcilsfsDum( ont4aeeomo3iatlaDra( pnu) rxoxr3iytopt aueo ( t2tmxrpiudapenlicia(f Dtm( o;u4oet ioeiyd s ul(vs;u4 lenxrcoodlptrln o;( setm(o3nydapt mnctas) 2umuro;o1aleomo3iltlsDuau s;t)tetrxocto1fp raueo ( t2uoimpiudopt  icslsfaDrrxmpoo4aleoifeiys aDumnvs u0aeerxf todfat  uvsls texr(rpny4ole  fci sf rua(mpou1oleoifetydfmDuln p;t4 eeomociatfmt  uvi ()t2xrxr oy1oltn fcsas)a2ta(m ;t4altoif3iydfsDumumsnt4trxomo3iotfa eluei;(0s2uoirpoodlpeemncilsf 2umurpno0oexn fctlt aDemnvonu) eermo3oatlp elneo s texr(o oydlltnlivt sfsrrm(root1aexomfcilsls2umn p (4tltrxf3oytlpt anvo;( teur(opno4al  mfvil(  rrmumpno4oexniieiyd s2em(vont4aexrxf todfmte neols) 2xr(m nu1omtemfetasfsDtrum nu1olto feilsla ulnvon(0tlenif ta1faDranes s t2xrxm3oydap  livsat srrmuront1alenif3ilsfmDem( s;u4treoircta1fpD lnvslt0s2trir3no4altnlncil( s2uru o;u4tleoiicilsfaDem(vp u) ltrircoydfmDr i ols)texoxr3ou4ole  nvi s a2tmurpno0apeomi3iasfa uan o t)arerio3oatoa ranei;t0t2toimpio1lme lies ( arrmurono4tptnifcilsfa2um(vsnt0trtoxr3tytlaDrlivs t0trtr(m3nu1opt  fci s  2taur oo1tlt mociydfaDrluvs;u) lenio oo1fateaneil()trtrxrpiudomtnmfci s sDtru  no1altnmoctasfs rlu s;(0texoxociy1fmDrlieolt)srtm(m io1lptn fctl(f Dtrumpno0optomoetasfs2uauvp () exnxf oytfaDelueslt) rumio3nydomenlnvsasfsrrmxr nt1tlenmo3tyslm2em( snu0tleoxf3tadfp  lieo;( seur(r3ny1aptn nvs sf rtrurpnt4alto o3tysfmDrmu pn(0 exoxr3totomtrai i ()seur(rpio4oltn iciltfa2ta(rpno0tlto oeiatfa elu on()tltomrcio1lpDran sls0t2trxm iy1lleemneiatfa2umxrpno0oetomfeilsls el( pnu4alxoxo3iadlmDeauei t)srtr(o3ou1omtelfct tfaDta(  nt0opt io3iyslsDua( pn(4aetrmr3iotfm r nvi;s)setoiopnudalenmnci s a2truronu0tpx  f3tyt m eluvp ()trtnxf ty1lat liei s) exmiopou1omtnmfvt ()s2tm(m nt0aleo fetasfs2ul(ms;t0aexrmf3iodfmDeluei ()teumimpiu1omeelivs ( aDumx pou1aeto fctaslm2rlnmp (4tetrmf3tadla e uvo s seum(r ou4lm emfetat sDumxr ot4aexo ocild a rmnvp (0 rxomr3io1omteanvo () rtoxr3oudal e neiatfartaxr nt4ope moctadls2umuvo;u0tetrio ta1omDr nvs t0 rxoimpoodal elivsltf Drm(rpnt4tlxnifeiadfm2el( s () exomo to1lmDeln sls)texmxm iy1olt mics ()s2uax pnt0teeo i3iatlm umu o;t4 exrxr3oo1la   uvo s) exrir iydome mivs tfsrumxr ;t0olx ifeildfs ran on(0 ltnmr iydoatr nvs;s) 2toir oo1apen neiltfs2tm(rpoo4apen i3iasfmDean ont4areomr3tydfa eauvi s t2toio iy4open fes tfs2rr(mo;o0oeeoiiciltlsDeluvpn()tltrxr tatom ranvsls srur(mpno1lpeelncs tf Dtmumpot0tet ioeild s2ranmp u4trtnxr3tydfmteluvols) 2to(m nudop elfcsat s2um(r ot4apx mf3ils aDuanmo;(0 eerxf3ta1oa e ieo t  exmim3ou4oleelnctl(fsDum(m ou1apenifeils s2ean o;()tlxoir3oa1fmDeluvi;(0tetmim3nu1lpte fetlt)aDrmurono4apto o3tlsfa2emuvont4aleomf iy1fpDeliesl(0 etoirpiydoltnmfvsas  Dtmxroot1aee  o3iad a elu p;t4arermrciotlm   ueo;s  etoim iu4ll  mivtl(faDtaxr ;o4tlxo ieiadfs um( s;(4alxnxo3oo1fmDr n ilt0 eto(o3oo4ap  mneil( srtmxmonu4tlxnioetadfs2ul(vsn(0tleoxf3iadfa ean il(  2umimpnu1op nmiei sf rua(r nu1tltoii3ild sDeau o t4trtnxo3iydfatr ueolt0t2umiopiudom  mivsl(fs2rmumono4apx ioctad m eaump;(4tlxoirciotfmDr nei;t s2xm(o3iu4llt  nes ( s2rmu o;u1aexn iciyd a2elnmo;u0 lenxrcoa1lpDe uvo t)t2umxopnudlm  mnvt s sDtmxro;t0aet mfeild sDeanvs;u)texrxf3io1fm rlieols  2uoxmpnu4amtelfctls)arta(mo;u1aexnmfetaslm rmuvs;u) etrio oytlat au ils)s2xrimpoy1omt lncil( aDurxronu0tpx mieiasfaDumnvonu4trxrmocootlpt  ivi;( srumxo3nodap  lict () Dumxr ;t0oet iieiysls2el(ms;(4tltnmocoa1oaDr n o s)seuoxopiudol e fvils aDua(ront1tetomiciysla uanvp;t)aetnmrcootlm rai olt)trumxopny1ap nmfeiltf 2rrx o;u0apxoii3iat a uluvpnu0 rxoxfcoy1lmt lies t0trtrio no1am nmfcsltfsDrax  ;t4tpeo i3iat sDemumo ()tleoio oydopt auesls) etoxr3oy4lmtnlictatfs2trxmpoo1tee mieias s ranmp;t4trermfctotlpD lueolt)teum(m nodol n ivi ()srrax pou1altnmfciytfsDulnvo;(0altnxr3tydlptrli s s0srxrxr3ou4ale mfesatfs2ua(mpno4tpxomictls aDrln sn(4tltrxf3ootlaDranvs ()t2um(o oy1ol elieias) rtrur ot1olto f3ilsfmDum( pn(0 exnxfcto1opte uvs;( s2uo(o3oo4lm emictltfa2urxmp;t4apen f3iaslm2ul(mp;u4aeenmf3ta1lpDe ieo t)srur(r ou1aleemictltfaruau pot0aexnifeiltfmDulnmp;u)aetoxf ta1lp eli sl()t2trxmpiy4apeemicias  Durxmono4tptn feiyt m2rmnvo u0tltoxr oytlm raivslt)teto(mpiydamt  fei (  2rmumono1tetoiociaslm2rm( p;t0 etrmf3ty1oate ivo ()setr(r3no4lltnlfei ()srraxm ;u0oet moeiltlmDelu o;u4trxrxfciydlmt lnvo;s)srxo(opoy1am  livsa( aDuau oou0tlen i3iat m2uluvsnu)treoiocta1lm  li slt t2ur(mpio1am e nvsa()aDrm( oou0tee  o3iydlaDua(ms u0 exoxf tydfat  nvolt)s2um(m3oydoltemfes ()artr(r no1olxnmicils a2rmumsnt0 rxnxo todfmD  nei s s2uoxr oy1ll  mfet t) Drrxm ;t4opto o3iytfa ea( p t4trxrmr ta1oat lu i () rumxm oudomtelictat) rrm(m ;u4tpenmi3iat m rau o t0tltomf3oo1oaD anvi;s)tetoiopnu4ol nmies s)s2rmumo;o0aee mf3tydfa rmnvp;u0trxoxo to1fp eln sl()texr(m oy4omt micias sDtmum nu4apxo feiadfs2rlumont4 rxrmr3ia1lmD anes;(0truo(r3oy1ol  mnvia(fsDrm(  no1texo ietasla2uanvp u4tetnio3ty1fpDeli o;t  ruoir3iodoleemiesasfs2ra(roou1oexnioetytlm2ea(ms (0aeenxfciytoatelies t0sexo(r3nu1lle mncs sfa2um(r nu1tetnmociytfs rmuvsnu0tltoxr iodoa rlnes;t  rum(rpoudam elfcsl( s2uaum oo4aetn ietltfm eau p u4arxoio ta1fp  auvs ()s2trir3oudop n nvtls srurx  ;o1tet iocias a uanmont0tlerxrcoodfmt  n ol( s2trxmpiydol e fes sfsDraurp;t0tptnmiciys s rlnvs;u0 ltoircoy1op rliei t) 2xrxopnudlpen feia() Drmumpoo4oet mi3iyd a uluvpn(0aetrxfcoatomDeauei;s0tetoim3nu1apenlfesas)aDumx p;t4alen ietatls uluvs u0 lxnmrcoydfpt lu s s srtm(r nodal elfeiat) rtrxm ;u0tle iiciyd s2umu p u0alxnxo iadoa rluvi;( srurxm ou1ole livi () 2rr(r ;o4oexn fetatfs2rl(vsnu4trxnmfciatlpD lu o t)t2xriopiodlpe mnvsls)sDrrx p;t0tle  feiasfs ul(mp t)artnircio1omDrlieo;t0teuoiopoo4alen nvt t)sruau  ou0tpxniieiadfs2rln p ()aeeniociodfpte i o;t0t2umiopoo4om nmict t)artm( o;u1opt miciyd mDeln onu0texoif tydoat  nvs t0s2xm(m oodaltn fcil(  2ta(mpnu1olto ietls m rm(vo;t4 lerircio1fmD  n s s s2toir3oy4omenliesatfsrtrxm nt1aptomfciasfs ranmpnu4trxrmocoydfmD anes;( t2trxm oo1opeelivta() rua( pou1opto octys sDulnvo u4tetnioctadomDrln ol( srxr(m no4lm  livtat  rtaurpno0tltnmf3iaslsDeluvont4 eerxr iydfmte ieo t)t2uoxm3io4oltn iet tfarur(rp;o4oeeomoctls a el(msnu0arxoirciotlpt ai ilt sexo(r oy4omt lfvtl(  Dtmumont1oltnmf3iydfmDranvon() ltomociytlat  i olt)t2tr(r iy4lmt liei (fa2rrum nt1aleniicilslm2emn s;u0trtomo3iy1opt ai s s0t2umim3iudale lfes t)srtaxmono0olxn i3iltfm eanmp;u0artnmocoa1lmD anvo ()trurxrpiy1optnmfvs ()aDtruro;t0optnmoetyt s2rmuvp ()aexnmo3ty1faDrlieilt sexmiopny1lpen fetl(f rur(r nt4alx  fctldfm2um(vs;t4 renircio1fmDelieo;s0trur(rpnu1aleemfciasf 2rmxmono1opx  oetytfm uau ont4 renio3oadfmtr uesl( sexm(r3iu4ol e fcsls aDtr( o;u1teen ieild a eln pnt4arxnmr3totom rln olt setrio iy4al  lnviat s2umump;t1tpeoioctyd m rlnmp t4alerif3oatoate neolt) exoimpoo4omtnlfcsl()srrr(monu4apt  ieiad aDul(msnu4treoxoctytfm e n o;s0s2tmxr3ou1ap n ivi t s2rmxront1tetomoctas a2rmnmo t) eeomr3iodlaDrauei;(  etmim3oodapt livsls)a2tru poo1apen fctyt s2rl(mo;(0tltrmrcootom rlivo;()truoxrpoydamt lfcs (  rraur no0tptoifeiydla uanms u4teeoxf3iy1fa   i o;( trum(o3nu4ome mnvtlt s2ra( pnu0oeen fetlsfm2uln p;u)tetnxrctotoa raieil()s2ur(mpiu1ale miet sfs2raxrp;o0tpx moeiyd aDraump;u)aetrir3tytfptean s s)t2to(m3oudolee fcsas artmxr ot4oltoifetyt a2rl(vs t)tlermo3ty1fmDeluvs (  2xo(rpio4lmtemieiasf Duauront1tlxn o3tatls ulu pn()tlxomrciadfmteluvo ()srtm(opio4alte ivtlt) 2umxrpno0alenmoctytlaDum( o t0trxomf to1lm  aivol( srtrio oy1ap nmnvi s)srrmum ou1alen i3iysfa rluvo u)aexrxrciytfm rlivilt0teuo(o3iu1ap nlfesl(  Duau  no1tetoiietad a2rlnmsnu0arxoxoctytoa e neslt srxrir iy1amte icsatfa2taurpnu1tpxnmi3ils a2uau p;(4aeenmf3iytom elu slt)s2tmim no1lltemfvi ()sDtmx oot1oetn octasfmDulump t4 rtoifctydfpDraivs;t0 etoxo no1apenlfct s arurxrp;t0oee if3tatfaDeaump;t0alxoxr iy1op ranvi;s srxmxopoy4lle  ivtas aDrm(r ;t0opt mieiatfaDrl( s;()teeoircoydfm e nvo s)trum(mpiu1amtnlfetlsf Dtauronu4texomiciad sDrlums;(0alenxf3iadfptr ivil(0 2xmir oudap nlfvt s aDtrxront4apxoii3iydls2rm(ms;t4artnxf3iy1laDrlieo;t)s2tm(m io4omte nvt (fsDrr(r nu0tltnifetldfs2rln p u) eeoio to1omtr nvo t)seurxrpou1amtnmnviat)arrmu o;t1tpxomi3iyd a rm(msnt0tlxoxr tadlp eaueo t)trtmxo3no4aleemiei s srtrx  ;t0alen fctlslaDumn s;u4trenxrciadfp e u s;()s2umiopiy1ap  mivil()arrrxr ;t0aetomietytlsDum(vp;()trxomfcoatoa  aieo;(  2trxr nu4optemfvsat)s2umumo;t0oee  f3tyslm umnmpn()trtnir3ta1fmt lu o;s0 2uoxr ou4ome  nvt t  Dtmu o;o4apxoiieiadfs uanmp;(0trtomf3ootlmD  nvs;(0 rtoxo3nudal   fcsl( sDtau ooo0ope if3tyt a2uln s;t0tetnio3ty1lmte i ol() 2umirpnu4am e icsat a2rax  no0tlx  f3tys m2ulnvsnu)altnif3ty1latean ils trxoir3oy1amee icsatf rrm( o;o0tpxo iciysfa2uanmpn(0aeermo tatfaDeaieo ( srxo(r3iy4lmte ics s  rrr( oot0teto ietltlaDrlnmp t0altrmo3to1omDe u s t0 etmxm3ou4ap emivias arrrxmpnu4tlenmi3ildlsDrauvpnu0tlxoio iodfateaneolt  2urim oo1lme licia(fsruru p;o4apxnmocildfaDum(vo;(0 ltrmf3ootfmt luvol( s2trio iy1amtelfvi t)aDur(  ;t1tex mietyslsDelnmpnu4alxrxfcta1omtrau o s)s2xoxr nudal e fctatf 2taum nt0tlx  iciatfsDrm(msn(4 rxniocta1faDelivo;s)teurxo3oydlpenlnctltfartmxmpou1ope mf3ilsfmDua( o u)aexnxo todfa eauvs;t0 exmxopoudaleemivsatf Drm(mpnu4olxnmi3tltls2eanvo t)tlxnmf tytfm   ivi t0trumxo iy1apen fci tfa2taumonu4alxoifeiltfsDumnmsnt4tltrmociytla e nes;()s2xrio no1lptnlivt s) 2urxroot0alxn o3ils a2emnvs;u)tltrxr3oo1fmte uvo s)s2urxr iydopeelncilsfaDumu poo4tpx ifctyd mDra( ont0teeoxfcoy1fa eai i t  etrxr3ou1oltemfvs t)arrru pou1aptnmiciytfa2eauvont)trtrmrciotom   i ils  rur(opiodope mieiasf rua( onu0aex mociytlsDua(mp;u0arenif iytlptelies t)texmimpiodolenmfeiat srtaum nt1tlt ifeilt s2uln pnt0aeermrcoo1opDrai s;( srxmir3oudop   ivta(fs2trumont4aet ifciad s umnmsn(0 rxnxo3iy1omDeln il()sexmio3io4lle lfcsltfaDumum no0tlxnio3iytlaDem(ms;t4 etrxr3iodfmt  i slt)t2xoirpiudlleemnci sf 2uaumpou0tex  f3tld a2umnms;(4artoir3iodfm   ivo t seumim oydlmtnlies () rrr(mpoo4opeomfeiytfaDrmnvpnu)aetoxr3oydfpDrlu o s0teumirpnodal elnet t a2rmurono0oet iocild a2umn p;t4arerio tytfp   uvs;s) rtoirpnu1opt mieia()srta(m oo1opeo oetytlm2em( o;()alxnmf oytlm  lues;s teumxr3ou1lmtelncs ( aDuax  oo4tpe mociydla2rl(vo;u) lermf3iytfpDeaies;()setm(opou1amt  feia(  2trx  ;u1oet ifeiltla umu p;u0aetnmrcootlp  lu ol() rtmxo3ny1lm emfct ()sDrrxm ou0ope  ietldfa rl( p;u)aexriociotoate neslt0 exrxmpiydomen feslt  2uaumooo0oltnif3iys s elnmp u0aeermo iodopt anvi;(  2tr(rpiy4olt  fctlsfaDrrxroou4altomi3iat m2rlumo ()aexomo oytfmtr ivo;(0 2toirpiodopt mivs t)arum(mp;u0oet  iciat s2uanvs;(0aeenmr3iadlatrln ol( trtoim iydamt  nct t  Dur(m ;o4opxnmieiltfaDel( s;(4 rtrifcoodfm rlu i;s0t2uoim3nu1ale mivtls)s2rr( oou4oexoiiciasfsDemn on(4tleomr3tytomD ln i;s0s2uo(r io1lpenmfci t  Dtmu  nt0aetn feiltfmDua(vont0tltrmr3oodfm   uvs;s0trxr(r oydlp  lnvta(  Dta(rpot4ole  ietys sDel(mo;(4 ltomrciy1omD luei;s)srum(rpou4omt  ivsat  rumumono1olxoifctldfm2ua(vpn(4aeeoxr oa1fptrli i ( sexrimpno1om elnviatfsDraumpno0alx iieilt aDraumo;u) ltriocoo1oateau sl() 2tm(o ny4lltelfesas)a2tru p;o0tpx  fciatlaDulu s (4texrxr tytfatelneo;(0 2umxmpiy4op elfctlt)arta(  oo4tlenii3tad a2el(vp;t)alxoxr3oa1la rai sls  ruo(rpnodlleemfetlt)srua(monu1oeeniiciysfm2rmu pnt)trtoxf3iatlp eau slt s2xr(opnu1ap  mnctasfs2umumooo0tlx  ieiytfm rl( p;u) lerxo3oo1op rlueols  euoxopny4al nlneslsf Duaxr ;t1tex io3tad s ua( snt4aleoifciatom  lueo;( srtrio oy1aptemnetl()s2tm( pnt4apen iciadfaDua( pnt)tlerxr iydlp elueol(0trtriopoo1lp nmfei s  rtmu  oo1aetnmoeild sDranmsnu0teeoir ia1om e n o s0trtmimpoodolenmnesas  2urumpot0tpenmictyt s em( o t0 eenmfcoo1opt  n sls0s2xm(m iu4ol e nesl(  rtm( ooo4tee mietatfm2rauvon() lxrxo oo1opD lnei;s)trto(opiodam n fvsls)aDtaur ;o1tpeoiietldlsDeanmp;t4tlerxf3oy1lmtr ueilt0seumxmpou4lptnmivt s aDraxm oo1oeenmoetyt m2ra( s u)aetoif3totlpDran o s srtoimpny1lmeemfet t  Dtmumo;o1tltnifctltfsDelnvonu0aexoir iytfm rlueo;(0 rxrxopnu1lme livtlt s2um( pnu1tlxomf3iltlaDrm( pn(4artnmr to1fmt  i s ( t2xmxrpoudopenmneslsf rtm(mooo4ole  f3tld sDum(mp;u0tetnmrcoatfate neols0 2urxmpnodap elfesat)sDrm( pnu1aeenmfetadla rl(vp;u)texomoctadfaDean ilt0 2urimpnu4lpte nct s  Drrumono4oexomoctysla ran p (4trxrirciydfaDrluvs;t tetoxm3iudlmt lnct s sDtaump;t4aet if3iytls emnvo ()texnxo oodfa rluesl()texmxm3nu4ale lnvil() rrau pou4aptoifcilsfsDea( o (4arxomr ootfaDrai ols)t2xo(o3oydopen ivtl(f 2tm( pno4ape  icilt a2uaumo;t4 ltnir3totlpDrluesls0 eumimpoy1opeemneil(f Durx onu4tlxomoctat aDul(vp;(0alenif oydlptrli i (0srtoir3oy1om  mfetltfsDrr( pnt4olxnmf3tat s rl(vsnt4aexnirciadfpteau s;t)srurir3iydlme mfviasf rtr(rp;t0tpt ifctatfaDea(mo;() exnif3tytlmDeaneo s)sexmio iudlpenmfcsltf rtmu o;t4ole  ieiltfa el(vsn()arxnmrciotfateaivol() etmxr oo1aptemnvia(f rraxmont0apeomictldfa ul(ms;u4teeomr3ia1lp elies t0trtr(opiudll n neil(faDumxmo;t4oexoiictydlaDrlump ()aeeoif oytfm r uvs;s0seumio3oydomenlfvt t sDtm(rpnu1texnif3iydla rauvs (0artrmo3ta1lmtraivo;t  2uoxo3nudamtnlncslt) rraurono4opxomf3tlsfs2eaump;t0artrio oytom  aieols  2trio ou4llt mivi (fa2tru onu4oleoii3tys m eauvp (4tlxomo3iydlaDeau i;s0trurirpoy4alt lnesl(f Draur no1oex mi3tasfm2rm( o t) rxrif3oydomDean s;()trtoxm3oydlpe mivsat sDta(mont0tleo ictasls2rm(ms;t) etnif oadlatrai i ( trtr(r3nu4ale liciltfsDtru ooo1oetn f3iatlm2ulumpnu4 rtoiociadlm  li i () 2urio3no4ale  nvt ()a2rrx pnu1tpxn icildfs um( pn(4tlxomr3oy1latrau sl(0 2uoir3iudlme lncsat s2rrump;t1ale  i3ilsfm uln onu0texrmo io1lm   uei;s trxmimpnu4omtnmneia( sDtm(root0opxnmfciadfaDelnvont4 eeoxr3tadfpteaies ( seumio iodaptelnviat srum(  nu0ape  feils a ua( p;u0texoxf io1lmtr ivi t s2xmir iu4aptemnvsa(fsrtax pno0oltnmictltlm uanmsnt4aexrio ootfatrai s ()setoio iudamtnliet () 2trxmpoo1tltnioctysfm2ranmp ()tlxrxf3ta1lmte nvol( s2urir oy4lm  mivt (f 2raxmpnt4aexoifeiadls2emn o (4texoif iatlp  lnesls  rurxmpoudolenlfcsat)sDtau  nt4oee io3tat aDrl(vs;u4tlermocootoat anes s)seumirpoudaptn nctas arrrxm nt4oet iiciyslaDul( p;t4trxoir3to1fmtrluvi;t trtoxrpiudlm e ivi t aDumxmoou0ope mi3iadfm2rlnvo;u4alxrxo oa1omD  ivi;(  ruriopoydlpte fvia( arrm(mo;o4tlx  feiys s rm(vo t) eenifcoo1lmtelivils) rxr(r nudlptelnvi s)a2uaxrp;o4tet mfciyslm ran o;(0teenio ty1oa   n o t  2uoir3iu4olenlfvias arum(rpnu1tpxnmfcildls2ranvs;(0tetnxo3ta1faDraneo;s trxoxo3iu1omee neiltfaDurumpno4teenifciydfs eau ont0aetrirctydfa   nes;s  ruoxrpiodal elfvils) rrm( pno0oetnmfctlsfaDrm(ms;u)aetnxo3tydopt  i o;t0sruoxmpno4lmee ics t  Dtr(  ot0alto feiatlsDrauvs t)artoxfcootlatean s;s0 2xrxr oo4llenliei sfsrurxrpno1tet  feiyd mDuau ont4 rtrmf3oy1faDeaivols) eum(r3nodole lfvsa()arrr( o;o4oeeo ietydfs2rlnvs t0tlerir iadomDraivi t s2uo(r oodalt  fvi s srua(r ;t0apx mietad m2ra(mon()aeeomociytfmDeau i (0 rtoxo io4ll  lneiat  rumurpou1optoiocildla2rmnvp;t0tetrifciatfmtrlu i s0 rxr(opiy4lm nmivils)a2trxronu1aexnmoeiadfs eauvp;u) exomrcoadoat  uvo s  rtmxopoy1aptnmiet sfsrum( oot4tle ii3iydfs ran pnu0aetoio to1fpte nvi s0 2xrim iu1ome  fvia(faDra(mp;u1alx ifeilsfa eanvont4 exrxfctodfmDrlieilt) 2urir io1omte iesa() 2truro;u0aet  ieiyd s2rm( s;t)trxnif totfatr u i;s trtrimpio1lltnmiesatfa2trur nu0olx ii3ias a rmnvsn(0aetnxo oatopt luei s0texrxm3oudape  ivilt)s2tmx  ;t0aeeoifcild m2eau p;u0 etrmf ta1opD lnvs;s0 eto(o3no1am n nes t aDtmu  oo4aleoioetyt sDraumsnu4trxrxocto1fmD aueo (0srtmiopio1ol  livi sfarrauroot4altomoetldfa ul(ms;(4tetnmfcio1omDrluvolt texmxrpoudlmtnlnvia(fsDrmurpou0olxo fetydla em(vo (4texnif3oadom elueils)srxo(r3nudlmtnmietl(f Dtm(  no0oet mf3iadfsDrau o;t)alxnmr3io1faD lnvil() rxmxrpno1lm n ivil( aDta(mo;t0apxoiieiysfm2elnvp (0artrxr ootopDrai s;s tetr(m io1ol e nciat) Dra(rp;t1ope  f3iydlmDulu p;(4 lxrmr3totoa rluvs (  eumxmpiydam  mfci tfsDrrxronu4tetn ictasfm eauvonu4 etomr oydfpDe i i;s tetoir3ny1opte feiasfsruru  oo1tle  oeiadlm rmums;(4aexrmf io1laD au i;t truoim oo1optnlnctat  rrmumo;o1optnii3tatfmDuanvp;()aexrirciadla r ivs t0trxrxr3nodll   fvtls) Dum(mo;o1tpxomictatlmDea( on() etrir3oy1lpDeai o;() eto(o3oo1op nlnvs ()aDur(  oo1apenio3tydlmDra( ont) ltomo3iotfptr i o;t0tetm(r3no1lptnlfeslt)s2um(rpno1oetoii3tatfa ea(mp t4arxoirciotlaDeaivs t  2tm(o3oudom n nvt sf 2rrx pou0oeto fciysfmDuauvpnt)trtrxoctodlat  nvslt)s2uoim3oo1apeelfcils  Duaumpno0tpeoio3ias aDrmnmp (0teerxo tadopD an o;t seuo(o3iodam nlnvslt)sDtr( ooo0aet  o3tydlsDum(mo (4tetnif3tytlmDrlnei;t0s2ur(m3oy4lpt livias  rraumono0tlx mo3iat mDeaumonu0altrir ty1omDrauvo;(0 rtoxrpoy1op  lnvsas srrau p;t0alenifeiysfaDum(vp;(4aeerio3oydlateaivs t seum(opny4lle mfvslt)s2tmu pnu4olt iieiasla2eaumpnt4aeerio3totomD  uvi s) 2xr(mpou1lmte fvilsf Draum ;t0apxnmfeiltfm2ra( o;(0treomr3oodfa r n olt s2urio ou1lmee ncsls) 2raumpnt0tpxniieiysfsDrm( o (4 eeoxrciy1la raneolt0trxoxr3oy4omt micia()aDtm(rpou1texnmociytfsDum(mp;(4artoif tytfatrlivolt0s2umxr iu4lptn ivs ()srtrxmp;u1tltomfciytls2umnvsnt4areoxo tatfa ran ils)teto(r iu4ap emnetl( aDrau oou4apx ifciad mDulumont4aeeomr oa1opt ai s s)teurio3ny1lp n ietasf Draxmpou1oexnmi3iatlm2rmu s u)trtnxocoodoaDr uvo t) 2tmxr3iodom  mfvsasfsDrr(r nu1olx io3iyt m rm( o (4 rtrxfcoatopDe n slt s2umxo iydll  mici (fsDtmu ooo1aexnifctydlmDemumpnt) renxrctotoatrluvo;()s2urio oy1llen fesl(f rrm(m nu4olen oetytlsDuanms;t0 renxr3oo1la ranvslt0t2urim3oo1oltn feil(fsrum( pnu1tet iieiysfaDemn on(4trxrmo3tytfmteanes t0 eurirpoo1lp  lici ()sDurxm ;t4apxnmociysfs ran o u0tlxnmociydlmD anvs;( texmxm nydopt  iesa(f rum( oou1aptomociat m rlnmp u4alerio iadfpte uvil()tetriopio1omtnmnvsas) Dtru pno0tetnio3ils a ulu s u4aexrxo3ia1omD livols)srumim3iu1lm  mfetat)sDrax  ou4oetomf3tatfa uanvsnt4tlenmr iadlmteaivs s  ruo(m3oy4ale lfct s)artr( pnt0texnmiciltfmDrl( p u)aetrmr3iydfm e ies s trxrxr nu4olt  icilt)srrrurpou0tlx mi3tytls2umu sn()arenxrcoo1fp   ivi;s sexrio3iudllenlfvtas  rtm(rpoo4aetn o3iytfa2uaumpnt)teerif3io1fpDe iei s0 2xmxr3iu1ape mivi t) ruaxmo;u1tpeniociasfs2ua(mo;() lxnxf tatfp  ai s;s0setoxo ny4om emneiltf Dtmu oou1aee  octadfm uaump;u0tetrmr3oa1fm r ies s0t2trxo3iy4amtelnctl(faDtmx  nu4opxn iciyt aDra(vont4 lenir iodfpt lueilt0 2tm(r3nodal elfesl( arrmu pno1aetoii3ilsls2ulu pnt0texoio iotoaDe nvols s2um(m3no4alee ies ( sDtr( o;o4altn icild aDeaums ()altnxfctydomteluvi t)teuoxr3iydal e fvtl()sDra(rp;u1tpen ocias aDelnvo;(0 rtrif3ootlatelnvsls0 rur(m3oo1ol  miet tf rrmx pnu1tleomf3iadfs em( o;u4altrio oa1oaDrlueo;t) eur(rpno1op  mfcilsf 2tmxmooo1tpeo f3iatfmDrmnms u)aeerxo io1lmD aivols) 2trxm3oodop  lietatfa2ur( ont1texomo3iatlm rmu sn(0 etnmr3oo1lm elnvsl()trxoirpiy1al elfeils)sDrmurpot1tpxo i3iytls2umn onu4altnmr iotfpt  u o;t0texmio ou1llen net s a2rm(mont4tpt  ieiat a2ea( o u4 etoxr3tytopD li olt setoxopiodam e netas sDrax  no4aee iietldfaDumumpn()aetrircty1opD auvsl(  etmimpiy4lptnlfvilsfa2uaxmonu0oet mf3iysfs2rlnvs t0trermr iotoaDe ueo;s)srxrxmpny4lmenmivils)srtm(mpot1tpxomfeiys a ea(vo;t0 rtoiociadlaDe i olt) 2trxr3no4lp emicslsfaDrrurpot4tpt  ieiadfs rlnvo;()altoxo oadlmD  ivols  2xoxo no1ll emnct sfa2umumont1opxn oetys aDrmump u4artomo3oadopD lu sl(0 2xo(o3oo1al n nct t aDrmxro;u0tle iictatls2rm(vo;u4arxoif tydlm e ivs;s teurio3no4omen ncsls s2rrx p;t0tle moeiad s rl(vp;u4 exoifcta1omDran s;t0sexoir nodopenmfci sfsDrmx pno1tpe  ociydlm uluvp;u4 etnifcta1latelues s)tetmxr3ny4omee iei s) 2trumo;t1tpe iietydfaDrm( snt4tltnxr oytfpD  u o;() euo(m3oo1lme lict s  2tm(rpou0olx iietytfs elnmpn(0trtrio3oydlmD anes;s0seur(m no1lptnmicsas a2umu pno4oltniictadfa uanmo u0teermocoadomteauvi;s trxrxm nu4op  lictas)s2ur(ro;t0tpxoiieildlsDeau s t) lxnxo tatfatrluesls0t2tm(r3iy4ap elfctatfsDrmumonu0tpxomfeiltlm2rl(msnt0 rtrmo3oy1fp eaiesls)trxo(opoy1am nlicsat sDtmx pou1tptnmf3tytlmDemump (0 ltrifctatlpDeluvol(  rtmxmpno4om nlnvsl()sruru p;o1tle io3ildfm uanmo;(0aeeomf3to1oa  aneo s0srxrimpnodllee nciltfaDrr(m nu4oeeomi3ias a2elu o (4aexrir3ta1opt lnesl( tetr(o iu4ope  ies t) Dtmump;u0alxo feiytfsDumnms;t0aetnxo3oo1lat  uvs (  eumxrpno1altnmiesl(farra( oou4alx  feiyt m rlums;t) rtomr3iytopD  iei;(  ruo(mpnydapenmieiat  Draxm nu1aex mo3iasfs2rlu p u4tltoif3oadomDrlivs;t  rxm(mpou1olt  ivtlt  Dta(m nt4aetnmocildfm elumpn()alxoxfcta1lm eaieo s srumirpny1ap elnvslt) 2umumoou4aeenio3tld m rm(ms ()tetrmf io1oat an s;() exm(r3oydaptnlnvil(  rtauroou1tpeoiieiad a2rmuvo (0tltnif tadfmD ai ils0srxr(o oo4lm emiesl(  Dum( p;u1tlt mi3tatfm raump u4aleomf oatoaDe uei;t0seuo(rpny4lp nmncias)a2rmxrpou1oleo octls m2rlump;t) etomf iodfp r ieolt t2tr(mpoudope lfeia(fa2uau o;u0olto f3tydfa2eanmo;u0aeenmo3iadomDr ieo;(  eurxo oy1aptn feils) Drrxmpot4tlenii3ilsla2rl( on(0artomf oodlat lneols trumxm3oydamtemietas sDuau oot1ape iiciydlm2ul(vo ()trxnxo3oa1fat ai i;s0 exoirpoy4lmenmnesasfsDtrxmpot1tlenifeild sDem(vsn(0tlenioctytfmDelnvol()trxoirpoydameelfcta(fsrua(rpnu0aexnmociadlmDul(mont0texoif iy1lptr ivi;s srxoxr3iodlm  livtls)sDta(  nu4tpt ifcildfs emnvsn(4aexoxocoadlaDeliei s0 rxo(o oy4aleelnvslt  2taxr ;t4tlenifetatfaDemuvp u)aeenifcoodlaDeaies;s s2to(o3iy4altelfesatfsDtau pno1aeenmiciltlm ea(ms;u)aexnir3oatomDelu ols0 rxrxr3oodaltnmnct s)aDtmxmpot1opt iictat m2rlnmon() eerifcoydfaD anei (0seurim3nu1omt mnvta(  2umurpot0aexn fctad m rm( o;() eeoio3oytlpt lues s)tetrxm iudopt  ivt s)arrr(rp;u4opx mieias a uanmpnt)texrxf3oydfa r ueols seumxm iodlpt  nesa(  2rmxm ;o0ale if3ilsls rm(vs;(4arerxocoydfpDelnvo;s0s2xo(m3io4ap e neta( aDur(m ;o4tlxn octas m uauvo u4treoio iadfmtraiei;(  rxr(o iy1lp nlfes s a2taxm no0tpx  oetas m2um(vo u0teeomo ty1lptraivs;() exo(r io1lm elivils  ruaur ;o1apen fciat mDumu p;u)alerxo3iodfp rai s;s srto(m3ny4lmt mnvta(  rraxmpot1oee  octysfmDrluvo;u4alerxr oa1fm  livols  rtrxrpno4opeelicslt)a2raum nt1apx ioeildlaDul(ms;u) ltnxr3iotlmDeai o;()srxm(m3ou4altnmneilsfaruax ont0aptnmfctys m2ua(vo;()tlenxr ta1fptr nei s) 2xmxr3nu4olt  fci s)srtmu p;t1teen ieias s eanms;(0 ltoifciatlm  lu ilt) rtmxo nodame mfcia()arraxr no0tpen f3ilsfsDrl(ms (0texoiocoytlm  an sl(0srxm(r nu4ome lietas aDtau  ou4aptn ietas a2eauvon() eerxf3iotoptelivo (  etmxm iy4lpt mnci (  ruax pnt0altoiicias m uluvo u0areomo iytfat anvo;t0trum(o3iy1lpe  fcil(f rra(r nu1aee io3tasla uanvsn() rxoxfcoydlpDeaivo;t)srtrio3io4ole mnctl(  Dtrxm nu4tee io3tytls ulnvo;t0trtrxf3iodla r uvs;()srur(o oodape licslt artr(mo;o0tee  i3tldls elnvs t0 renmrcoatomD au ols0trurxo ou4openmfcias) Dtrum ;u4tpeo f3tytlaDrm(vs;t)trtrifciotomt lu o;(0s2xr(mpoo1olt lnvs tfa2uaxmont4tltnif3tadla2rln o;u)teeoxf3oytoa e i i s0s2xrxm nodllte nctat)aDrrur nu0altniictydfaDelnvpnt)aexrifciydlmt  nvi;(0trxmio ny1lpe  fvt ()s2rmxmpot4tlen ictasfs2ulumon(0aetnxf io1la r uvs;( t2tm(opiu1lltnmicsas s2um(rp;u0altn feilsfm2um(vo;t4aexnir3tatomD lnvils)sexr(o3iu4omee neias)aDrrxm no1tlx mf3iadfm2em(vsn()alermo3to1omD  i o t) 2umim io1om n icta()a2uau p;u4aetnmfeilt m rmn sn(0altrirctytlat au ilt s2urio oudamtnlnvsas) Drm(  oo4tee mfcildlmDeanmont4aeenio iadopteln ol(0 rurxm3iu1lpteliesl(fsDua(ro;u4opeo i3ilt s2ulnmo t4 exrmrctodlm  aiei t0 2xr(rpnodamte ics s) 2ur(mp;t4tlto f3tasfm2ulumsn(4 eenifciatopDr nvolt0t2xm(rpiu4am nlfcil()arrrump;u1ole ifctyt a2rlumon(4teeriocoydfp  anei;s0 euoiopio1op e fvils)arrmxrp;t4tpenifctydlm2rlnvp;(4trtrxocootopDeluvi;s truo(r no1ol  mneiltfs2tm(monu0opeoiietytlmDel( sn()texnmf ty1latrlies;s0sexo(o3no4am  miviat)s2urumpnt4teeomieiys mDel(mo (0altrxf iatlmD anvi;t)setoxm iodom   ici t aDrru pnt1alt mietldfa eau s u0 eenio ia1la raivi;s0sruoimpoo4llte ieiat sruaxrp;o1aetn o3iyt a2el( p;()teeoxr iodfpD anvi;t0sexoxmpno1aleelfesltfsDuaxro;o0teeoio3tas sDua(vsnu4arenirctotfmD ln sls srurxo oo4apeelictls aDum(mpou0oleoifetytfaDum(vo t0tlxnmr ta1fm e nes t)s2urxopou1ap nmieiatfsrra(  oo4teto feiad aDuluvp u0tltnxfctodoatrlues t0t2xmir3oudam  lnci t sDtaur ot1tpt ii3iadfm um(msnu)texoxo3totlpt au olt truoir oodlm nlncs sfaDra( ont4aet iiciys s rl(mpn()artrxr3todfa  auvo;s0tetmiopio1ll  mfetl( srumxmo;t0tpeo f3iydls ua(vpnt)tlenmrcoydop elieil(0srxmxopnydopenmnesl( s2rr( pot0tpxn octlt aDrauvs;t4alermoctatlpDelieslt0 2xoxo3oy1op n fcs (  Dtmxro;o4aexomi3iadlaDum(mon()tetnxo3oodlptrauvs;t0trxr(o3ny1ale lfeta(f 2uaumpnu4aet  fctatfa uan o;(4 lxrmocoydlate uvi;s0 rxmir nydlptnmfeias)arur(mpnu4tpenioctyd mDum(vo;(4 etomociatfmDelnvs t0 2tmxmpoy1llt lfcta()arrm(rpnt4ape  f3iytlaDrm( s t)alerxo iytom ranei (  eumir oydlpee ictls  rrmxmo;t4tpxnmi3tls mDea(msnu4 exnxo3oo1lpD li olt0texo(mpoo1olt mnvias)srraurpnu4tlxoiiciyslm2rlnvpnu4treoxfcoy1om r uvo t texr(m3nudlleemieil(fartaurpou4alxomieiyd mDua(mp;u4 leniocta1lpD  nvi s t2umio nudlltn ictlsfartmum ot1oex moeilt m2um(vo u0tltnmfcto1lm e ies s0trxoxr3oy4ol  lfvtas sDtax onu4tpxnioctydfa rluvo u0tlxrxo io1laD  uvi s  rtoxr iodlm nlivi s arur(m ;o4tlenmiciyt aDrm(vs;(4aleomr3oatfmt  uesl(0texm(m3oo4olen ictas  2tmx ono0aexomfctlslm uaums;() lenioctodomDrliei ()t2urxm oy4al elicta()srtr(mo;u4teenmiciat m2rlu pnt)aexoxf ty1opte i o s  etoiopno1oltemivias) 2umxronu0oltn fctld a raums t) exnifcia1laDelueo;t0t2to(r3oydame lfeia()a2urx  oo4olen fctys s um(vp u4aeenxocoydfm rlu ols0 2xmxr io4llt  icias)srta(rp;o0tleo iciys m2uanvo t)arxrmocoy1lpD ai olt0s2trxo ny4ame  ivsl()aDua(m ou0olen oetat s2rlumsnt4 lermrcoa1om  li i s)teuoxr iu1ole mnvta() rrr( ont1openiietadfm2ea( on() lxoxrcoydoptrauvils0 rurxo iodamtnlictls)a2ua(roou1tpe miciasfmDrln o u0treniociytom rln olt0 2umio3iy1lpe mfvt s arua( p;o0olen octaslaDul(ms (4trtrio3totomtelnvils) etm(mpoy1ap n nvi ( s2rm( o;t0oet  o3iysfsDrl(vo;u0tlxnircoydopD  neils s2toir3io4optnlictl( aDtr(  ;t0aetnmociytla rluvs u4tlenmoctodlpDeanei;s setm(o3oudlp n fvi (  2raxront4tleniociaslsDra(vs;t0 rxnxo3ta1oaDrli i t0sexoio3iu1op emfctlt)artrx oou0apxo o3tadlmDua(vpnu4tlxnmr3ty1lp r ieol(0srur(m3no4llenlfctl()sDtrurp;u0oeeomoeiltla rmn o t) exrxr iydlaDraieo;s0 exmxm3ny4ome lnvsltf 2rmxmpno1tpe iictltfs2ea(msnu4 eerxo iadopte ivs;()t2uoxopiy1lp nlfeil()aDur(monu1alx mieiad m emuvpnt0texnmf3iotfp   uvs (0 2xr(m3oodom   nci ( arumx oot4tlxo i3iydfsDuauvont) reoif3iotfaD ln ils0 etrxmpoydlltelnvs sfarra(moot1opxnii3ilt mDuaumont4alxnxfctadoa eanvo;t)t2xrim ou4opt lfvt s)aDurxmoot0tex  oeiyt s ean o ()altoxf io1opt livs;s0truoimpno1aptelivils a2tr(monu1oex mfcildfsDel( pnu) leoxf3oydfat lu olt teum(rpio1lm n fci tf 2rru ono4altomfciyslm2rmump t) lxoio io1lpD lues;t  etmxo ou1opee neil(farrrxm no4alt mf3tlsfm2umumo;t4altoxo todfatrauvo;t)teuoio oo1lpeemfcsat)sDraxmpnu1tltomo3ilsls em( p u)aexomf3to1omtraneilt)t2xr(mpno1ap   ncsl(  rrrumpou1oee  ictasla uauvp ()tetnifcoa1fa r i i;s seumxopou4apt  fvs tfa2raumpot0altnmo3iysfm uanvont4tetrxrcoo1lptelivi s setr(o oydlpe lfei t)s2tmx o;o0opt  ictyd mDrln pnt)trxoxrciodla rlu ils)sexo(r3ou4opeelneiat) rumxmonu1aetn fetadfa2ra( pnu4trtrircoo1oa e n ol(0trxo(mpny4omenmncsl() 2rrxmpoo1tee iociltfs ulnvsn(0tlxnif3oatoptrluvs s0 rurxm oodllt lnvt ( a2rm(root1openiieiytla2um(msn() rxnmfciatop  aieo;t  exm(rpio4amt lneta(fs2tmumo;t0opxn feiadfa ea(ms;u4 exomr oodfp eaies s0truo(m no4omeemneiatfsrrmxro;o1tlxn f3iatls ulnms u)tetoif3ta1fmDr nvil() exrimpno1altelfesas)aDrr(r nt1oexomi3iatla ulnmont4tetomf3todom   n s s)trumiopio4am emnvsltfaDumxrpot0oee mfcilt sDelnmont0tlenmfcto1laDraivo (0srtmio3iy1olt mfvslsf 2tr(ront0tee ioeils a2rlumo (4 etrmr oytoaDrlneol( tetrxr3nydll   fct t)s2taxmoot4tpe iocilsfs ulumpnu0 etnmfcia1lmD ai s s t2uoir no1al   netl( sDumxmo;u4texnmfetyd s2ua(vp u)teeomf ootfm e uei;s0 eur(m ou1amtemivt (  rtau  nt4oleomfctat mDum( s t4 exoxr3totopt lnes () eto(r iu4opee fvt ( s2rau oou0tpxnii3tysla2uln snu0 leoxoctodfmte ivo t0 2urxm nu4alenmfetltfsrrm(  oo4tptn feilsfa eauvs;u0aetrxo iodlpDe i ilt texo(rpoydalen fei t srtmx pot4tlxn icild m ulnmsnu4 exomfcoytoa e uvs;s0srxo(opio1om nmfeils)s2urur ;u1aetoioeiltls2ul(monu)arxrxo3oytlpDr uesl( t2uoxm3ou1alenlies sfs2tr(r ot4tpt if3iyd s2ra(vo (0alxrxf3todoa eluei;s0seur(rpnodamtemfcta()sDrm(r ou1texo ietld m2ua(vo;t)texnxo3to1lpte n il( srurim3iy1lpt lici tfsDrau  ;o1olxnifeiys sDemnmp;t0trtnmr todfp  aivolt) rtoxm3ou1optnlnvtlt) 2rrxrpoo0oexoioeiad m2uaumpnu0trxoif iatomt aueo ( srumxopiu1omtn nviasfa2rrx pnt1tlxo ietad m2emnmp;u0tetnmo3oy1faDe uvo;(0texo(m3ou4ape mivtltfa2ra(ro;t4oltniiciysfaDemu p;u4trtoif3oodfa  lueolt s2urxm nu1altn fvt (f rurum ou4teenmietld s2ea(mo;u0arxoxf3tydfmt  ivi ( texoim nydome  fvia(  rrax o;t4tpen fcils s eauvsnt0tlenmrcootfa  au ols0s2trxo3io4ome lfvsl(f 2rrxmp;t4opeomf3tyt s2ea( pnt4aetrxrcoa1lp elueslt0texoirpnu1lltnlfctls a2tmumo;t4apeomi3tlt mDra(vsnt)trtnmr3iotla eln s;( t2tm(o3no1lm eliet s arur(monu0alxnmicilslmDumnvo;t) lxnif todoaDelivolt seto(m3oudoptnlfcs t srtmu pou1opto o3iatlm em( o ()texoxo ootoat  uvo t tetmxr no1ll  mncilt)sDuaumont4olto oeiydfs ran p;t)altnmf ootfp raneo;s0sexrxm oo4ameelics sfarumxrpou4opx mfeiyt m umnvs;t4 exnmr3oa1oat  n i t  eum(r3no1aleelfvtl(  2ua(mpou1oeeoif3tys s2ranmo t) eerioctadlatr ivs t seuoim no4ll elnvtat)aDtru ono4tltomi3tlsls2rl(vs u4 rerxo oodlm  auei (0 etm(rpny1lmtnlicta( sDrm(mp;t0oltoiociasfsDumn s t0aetrmo tytlm eli slt0s2urir3iy4lptnmnes s) 2rmu o;o1aee mfetadfaDra(vs;u) exomf3oodom  ln o;()sexrimpou1amtn neiasfartrxm no4alenmocilsfs rlnmp;(4 eerif iodlmDe uei ( trxoxo iy4amt lics sfsDumu p;t4opxo o3ilslmDea( pnt0trermrcootlpDrlnei;() 2umiopiodalee fesls) rumumo;u1olxomoctysfa rl(vonu)aeeoxocoadlmDraivs;t srxmxo iodam  livsas  rtm( ooo1alxomictldls2ranms;(0tltnif iatlmDran i t s2uoio iu4lp n iet tfsDua(r oo0optnmiciyd s rlnms;(0 lxnir3totlmDrlivi;( srxrir no4am emfcs (faDuax pno0tpe iietyslm2rl(mo;u) rtrxo iytlmDeau o t teuoim nodolenlfvil()arurumo;u4aetn iciasfaDumn pnt)trxnmo3ia1faDe ivi;s) etmxmpiudlmtelieta(  2tm(rpnt4teeniieiasfm2em(mp ()treomfctatoaDrai o;s0 exrio3oodlpenmieil( aDrmxmpnu0teto feildfs2um(vo;(0 ltrmociytfpte uvols) rxoxmpou4lmt  fct s artr(m oo1aeeoifcilslmDrm(vo;u4tltnio3ia1lpDr u ol()t2xm(r3nodopt mieils)srrm(  ;t4tltn o3iat s2umuvp u4tlxrmfcoo1omD anvslt  rtoiopoy1lmte fcia() Dra(  ;o4oltoioctydfs ua(ms;() ltnircoytomDelnei () etmio oudom e nvsa() rta(m ou4apx ifctydlaDrluvpnt) renmociodfpt lu ils)srurio3oodlpeemfesls  Drmx  ;u4aetniictatlaDua(mp;u) etnir iydomteauvs;(0srtm(m iu1lp   nvslsfaDrr( o;o4alenio3iadla ulu snt4 rtnio to1lmtrauvo ( srto(opiodlmtn icsa( sDrrxr ;t4tlxnioeiyd a ua(ms (4 rxoifctotlmtraivs;t trxoxm3iodal nmneia()srumxmo;u0ole  fctltlm2rlnmo;t4treoirciy1lm rlneols teuo(rpoo1am  lics ( s2umuroou4tet iieiytlmDrm(vo u0aeeoxociadfpD  iei;t0srxr(o3no4lmenmfes t  Dtaxrpno4aptnifcias m el(mp u4artoifcoydla rlivs t trxo(r3ou1opt mfvs tfsrta(rpnt4apxoiietls sDrl(mp u0 lenmoctytfp eauvols0 2tmxopio1lm nmfvia(  rrrxmpoo0optoio3iadlmDrl(vpnt4artrmr3oatop elu i;t)s2uriopno1lmeelncias sDrrxr oo1tleoifcilsfa2ulnvpn()aexrmr3oytfmt luvolt) etmiopoy1ll   nct s)s2uru o;t4tetomietadfmDeauvsnu)alerifcta1lpD lnei s)trurim3oo4ame mfvtls) 2urxm ;o1tltniocias a uauvsnu)artnxfctadomDr n o;s0s2to(m iy4lltn fvtasfa2urxrp;u4tet mietld m el(vonu) ltnmf iy1fm raiei;t)t2toxr3oudom  mneias) rrrxmonu0oltnmietadls em( p (0tetnxr to1om rlieols0 ruo(m3ny4ole  netltfsrta( oot4alt  icild sDraumsnt)trxrxocty1laDelu s;(0s2tr(o ou1lltelfvi s) 2rr(rpnt4opx mfciyslsDemu o ()trxnio iotop rliei;()trtrxrpiy4lm n ict ( arurx o;o1aex mo3iad s umump u4 rxriocto1omte ies t)trto(o3oo1lle lnctlsfsDtm(ront1tet moctldlm2eauvo;t0 rtoio tydla raiei (0 etrxr iydaptemfcsat) 2tmxmpou1oltnmf3iysla2eau s t)artoif3tytomDelueo s  rxoim3oo1opee icias sDtr(m ;t4tpxo i3iysfsDea(mpn(4trxoxrctodfm  anvols  2xo(rpnodomt livia(fsrta(mpnt4ope if3ilsfm um( pnt4arxnmo oa1lm   i i;()trxoio3oo1alenmnetatfsrraxrpoo1oeto ocildfa2ea(msn(4aetnxo iotlaDrli ilt)trxrxm oy1ll emncta()s2taxmpnu1aex iicilt sDeauvsnt)aeermo3tatlmtrau ol( t2xmim3no1lpeemneslsf rtru oou0apenmictaslm2rmnvsnu0 lxrif3ia1lmDe uvs;s) rumiopoy4lpeelfetl()sDrmur ot1apxomo3iatfm2rm(vs;u0 rxnxf3tytfaD auvi;( srxoimpiu1lmeemivs (f 2taxr no1alenmocilsfs uaump t4alxnxf tatlate uvsls) 2uoxo3no4ol nmiet ( a2taxmp;t4texo icilsfa2emumo u0 renmf3iotlpte ies s srtmimpnu4alenmfct (  Dumxrpou0olx  oeias m2el( snt0tleniocoy1omtelnvs ( s2umxo no1am nmictat  2rau p;t4oexnmfeiad s uauvp;t4 lxoxf3tydfmt an i;s srxrxm no1lleemivtas)s2umxm ;u1oltoiietatfa2rlump;t4aexoxfcty1oa  auei;t s2tm(o3oodamtemfvtas  rtr(r no4alx mi3ildfm2uanvon() lxomr3io1fmt  n o;( setoir3nu1amenlivslsf 2trurp;u0alxomi3iydfsDua(vp (4teenxf3iy1oaDeln sls) rxrio3ny4lpen nvslsfartmxr ;t4tlx miciytlsDum( p;(4aetnxociytlaDe ueo;t)trxmxo3nydlm nlnes t)sDtmxmpoo1openmo3iaslm2umuvs;u4 exoir tadfpDraivs;s)trxr(r iodameemfvi s a2rr(rpno4olt mi3tyt s eanvs (0tleoiocoy1fm  aivolt t2trxo iu4alee ict s)srtmxmoot0tee ifctasfa2eau onu) lerxf3ootomteluei;t) 2tmim3nu1olte iesl(fsDur(m nu1aet  ocild a rl( p;u) lxoxfciodopte uvi (0 rxrxrpno4alte fcsa()arrau pnu1opxnmieildfm2umump;(4 reniocio1opt lnvslt t2trxmpiu1om  mfcta(  2uru o;o4tpe iiciasfmDelnvsnt4alxoxf tatom r n olt0s2um(opou1ameelfcslt aDur(r ;o1apx iietysfa elnmo;u0tltrmo3oytfa   ueo ( srxmxopoydlm nmnct s aDurumo;u1tlxnmfeildfs eau pn()teeomr3oytfm elu ilt)sexmio no4lpt mfetls srrrumooo1optomieiydlm2umnvp (0arxrxo3ootfat li o ( trxrxo oo1ap emnvi s) Draxroou4tlx mictatls2ran o;()teeomocia1la   ueo s  rumxo3iy1omtnmfvtat aDtrx pot4alen i3iyd s ua(ms t4teerxo oytoat li o;( sexrxrpoydamtnlictas aDrmxmp;o0apto i3iad sDel(vs;t0texrmfcio1lmt  u o (0 rto(rpoy1ame mnctl() rrr(rp;t0teen fetltfaDeau pn(0artnxo tatfpDranes;(0texm(o ou4lp  lneiatf Dur( poo1tpenmo3iysfm2uanvo (4altoircia1lpDeau ils)teurim iy4altemnvtat s2rmu p;u4oeeomfciyt m2el(vp;t) leomf iadlp e i o t0 etoimpio1openlivsa( sDum(moot0opx mfctas s2eaumpnu4tltrmo3tadomDrlnvo;t0 rumimpio4al nmfesls sDurx pno1oex ioctytlaDem( on(0artrxf3ootlpt  i o ( setoxr oy1ll e ivsa()sDtrxro;t0opx mf3iasla rm(mp;t)trenxfcto1oate iei;(0texmimpnu1opt  fvi t)srtrx o;t1tlxoioctydla2rau s u) lxrmrcty1faD auvs;()trurxr oy1lp  lnctat  Dumumont4tpxoiictls mDelu p;t4 renmfciadfm eanvo () exoxo3iy1om e ics t)srtaxrp;t1tltnmf3ils s2el( p t4 rxoir iy1oateau i;()seuoim nodal nmfeslt  2umxr ;o4apxn ociltfm2em(vo (0arenmfcia1oat lnei;(  2tmxr io4opt  iciltf 2taxrp;u1tpeoiieiytfm ua(mont0aetnxocoy1fp raneslt)setoxm iu1al emncsas sDum(ro;o4apx mieild sDean snt0arxnircoo1lat  ies;s trtmxo iodlm e ivslsfartmur no4apt iocilt aDrau p u0tetnxocoatlptean i ()teurxopnu4aptelivt sf 2rmxr oo0oexn fciysls rauvont4 exnif3oodopDeaivo;()setoir3iodal elnvi t) Dua(ront1aet mfciltlm rlnvo (4aetnir3iydomt  ues;s srxmxopno4ll   ivsa()arrrx pnt4alxniiciltlm rln s t0trxnxf iodopD an o;t texr(o ou4lp e fctls srtr(  ;t1aetn ieild mDuau o t) eeoxf3tadfpDelueo t truo(m3oo1ol nmics (  rta(m nu4tetniocilsla2em(ms t4texrxr3oytlmtean s;() rumir oo4op  lnvslt sDtmxr ou4tpt ifcils mDrmuvp;t0 renxo iydfm  lu s;t)teum(m ou4lm  mict s srtr(ro;t4tlenmiciadfa2ul(von()aetnifctatomt  u i t texmirpoy4amt lncta(fa2um(m nt4texnmf3ild m2ul(mp t0aeerxf totfa   nei;( seuoir iu4amtnlfes sfarra( o;o0aet iocildlsDrln p;(0aeeoxf oa1lp eli ilt)sexrir3nu4amenlnvi sf 2uax  nu4ope  fciltlm umu ont)aetnmr3tadfpteau o;t)seuoim iy4apenlieil()aDua(ro;o1oeenmicils sDuauvsnu4 lxoio3iytlaD au i (0teuoir oodam  lnes t)a2tm(rp;u1apto octlsfa um( pnt)aleoxr3totlatelivs;( s2xm(r3oydolen ieilsf rur( onu0aexn feildfaDranmon(4aeerifcoy1omt ai olt0 rxr(m3io4open nvi tfa2rr(monu1texnifeilsfsDul(vo u4 lenxr oy1fmt ai o s t2toxm oo1lptnmfeia()arua(  ;u1oee mi3iatfa2ul( on(0 ltomo3iydfaDr iei s trtm(opnodameemfctatf 2ua(r no1oet moeiys mDrmn s;u4 reoir ta1fp raieo t0 ruoim3ny4om  lncslt)artau  nt1altoiieiatfa2eluvs (0aeenifcoa1fmt anvi (0teto(mpnu1oltnmiet t sruru  ;o1oex  i3iytla ua( snt0tlxrif3oadoatr n slt  2urxo3nu1oleelfeia( sDumx pot1apx if3iat m2ea(vp t0 etoifcoa1lat an o;t0s2uoxo nudll nmnviltfa2raxmp;o0aeeo o3tad m2rl(msn(0trxnmrciadop r uvi s) rtrxm3no4olt  nei (f Drmx oot4altoiicilsfs eanmo;t0 etoircoodfp eai slt)teto(o oydamenlneiltf Dumxrp;u0aeeo fctytfa emu snu)aeeoif io1lp r nvs s0s2xo(o3nydale  nct s a2umur nt0oltomoctys s uauvpnu4altnir3iadoatr i s;s  ruoim nydlmt licslsf rur(mpno1tlx  iciltls um( s (0trerir oo1fp e nvo (0trurxopnudaltnliei ( a2rm(m ;u4oee  f3ils mDul( onu0trtnio oatfatr n s;t srtrirpoo1aptnmfetas sDrau pnt1alt  o3iydla eln o;(4 ltnxfcoytlatrlivsls0 rum(opnydlptnlictlt  rurx o;t4olx mf3tydla2emuvsn()artnmf oytlp r iei;(  rtmio3oo4ap nlnes t  2tr(mp;t0alt iieildfs2emnvp;t4trxnxocio1latelivs t) etmxr3oo1apt mnvsls)srrm( pou0texn ieiltla2eau pn(4aexoif3oytlpDeanvslt trum(o iudlpee feia(fsrur(rpno0ape  fetatls2umuvo t0tetomo3iodlp  lnvsls0 exrxopnodlm e fviat)srra( pou4tpxomi3tatla2raumonu0trtnif3oy1lp r u slt)srumio no1aptn nvsat  2ra(  nu0aetnmf3tltlm2ulnvpnt0arxnio iytlpte n o () 2toxm oodope mici ()s2ta(rpou4aex ifeiytfa eanmo;(4tltnio3ia1lp r n olt teuoim oy4alenlivsatfaDtru pou4olxoio3iat aDra(vp t4tlxnxo3tatfm  luvs;t) exrxmpno1al n nvsasfarrrxmooo1oeeo feiyd m eau s t)artnircia1fptr ueslt0s2xm(r3nydlmtn ivsas s2trxmpot4olxoiieiasfm umnmo t0areoiocoatop r u i;t trxrio3oo4al  mfvt s  Dta( pou4tlxoiiciys m ul(vsnu) rtnir3iotlpt  ues;t0srxmxrpou4apenmfetls  rrax p;u4aetniieiytfaDelumont)alxnmf3ootopteluvol()texoxr oydom elfvsl()s2ta( oot1opeo ietltlsDuan o;t)treoxr3io1la e ieo ( s2umio3iu4ope  iei tf 2urx p;o0opeoioeiytfsDea(mont)trerxrctydfptran i t0t2tmxr nydllte fet t  2ua(mont0tex  f3iydfsDulu snu4arenxo iy1la raiei;s) rtmxopny4al   fvta( srur( onu0oeeoifeias mDeluvs u4tltrio3iadomtelu ol( trxoxm3iodamee ivil()srua(monu0tltomictydfmDemn p;u0tlxoxr totoaDeanvo t  2xmirpoy4lmtemfcs (faDraxrooo4oexoiociytlm em(mp;u0trxrmr ty1lm rlu olt  rtoimpiu1omenlfetatfsrtmump;u1tleomf3tltlsDrm(ms;(0 lermr3totlp  auesls t2urio3oy1apeemfvtlt artrxr ;o1ale  ictysfm2em(vsnt4treoifcootom r ieo;s  exoxo ny4lptnlfcia(  2tr(roou0aeenioctadfm2eau p;t0aexrxfcty1op  luvs;(0sexrir3nu1ame lnci t  rraumooo4teeoio3iat s rm( snu0aetnio iodopDr uvol( trxmxo oydlp  licils sDrrxmo;t4apeo feiaslmDeauvs u0aexniocoodlpte uvs (0sexmimpio1lp  mfesat a2umxrpot1aeenmfctls aDrmn o;()teeoifciodlmtr ueols srtoxo3nu4lltemnvsa( aDur(r nt4oee ifeilsfm2ra(vo () rtoir tytfp   nvo ()srumimpiudal   netas s2urumoot4apx iociydfa2eanvpnu0trxoxrcoo1fp r i olt) rxo(rpiudap nmfvslsfsDtrumpoo4opx  ictydlm2el( o;u0areoxf3tydlate nei ( trtmio3nu4amenlnvslt)arraxmpnt0aexnmiciadlaDrmnmsn()altomfciy1fateau ilt srtm(r oo4al e ivtl() 2rr( oou0oee if3tydls el(vpn(0altoifcto1om eli sls0 2toir oo1lp e fcslt aDtmxr nu4tleniicias s eaums;t4arxomr ia1laDeanei (0srtoiopnu1ame mnvsltf rur(ro;o0tex miciyd mDul(vp;u4 rermr3iy1fpDrluvo s trtmio no4lptemnvi sfarta(rpnu4oet moeiatls2eanmp;(0 lxnio iydopDean s s tetmio3oy1ll n neilsf 2ra(rooo0apx  ociydlmDua( p;() rtnxrctodom raivils  exrxmpno1ol nmfviltf Dtmx  ou1altoioetlsfa emuvpnu0aetrmf3iatomtr n s ( trtmio3no4alenmfcs ()sDtm(mp;t1tlxn i3iadls2elumpn(0tltnmr iodlp   n sl() eurimpoo4omeemnci s artmump;o4ole mo3ias a eanmpnu4 lxrirciodop e ivi;t  etoim3iy4apt lfeta( sDuru pnu1opxn octltls2el(mp t0alenif oydomDr uvi;t0 rto(mpoo1al n fviat  Dtm(roou4tlt  ociat s2rlu s;u4aexrifcoy1fm elieils0 euoxo3iy1apen feta( s2tm(r ou4oet ii3iytlmDemuvon(4 rerxr oatfmD aneo;(0trtoio nu1lm nmnes s srrrumpno0olxo oetat m2eanvont)altomr3oy1fa  an s t0trxmxr3nudaltelnvsls s2truro;u0opto ieildfs2uaums;()aleoxo oy1fpD  uvslt  2uoir iy4aptemieils aDraxmoou4tlxn o3iltfs2emnvpn() exrir ta1op  lnvils) rtr(m3iu4lpt mfctat)a2tm(mp;t1teeomi3iad s uaums u)texomoctotom rlu sls)t2xmxopnudope  icsa(fsrraxmpnu1alto ictatls emnvon(0 lerxr oo1fa rlu o t0sexo(o iy4amte fcsatf 2trum no4aeeo ietytlm rmn s;u0arenifctodlmteaueolt0 etoxr iy1am elncias arrau  ;u4olxn fetatfm2uauvo;u4altomf oo1opD lu i t) eto(o3nu4amte fci s  2ur(m nu1tlx  o3tatfaDum(vs;t4aetrif3iy1op rlu i t  rxrxo nudale lncils sDua( ono0oex iieilt mDulump;() ltrxf oodla rlu o;( sruoxopoo4am  mncs s)aDua(m ;u4ale mocildfsDemnmonu4altoio io1fmD  uvi;t0 eumio nudapeelfvia(fsDrrxrooo1apxn icilt a2ul(vo;u)tetomr3iy1fpteaues;t  2xo(opny1am  lici ()aDtmx ono4opt iiciltfmDea( p (4 lxrmf ty1lmteauvi;s trur(mpoudap elncsa()s2urxmpnt1ope  fcild m2eanvp;u)trtrir3iydlmDeanvo;t0 rxo(r3iu1om  micsl(fsrumuro;t0apxomiciysla2eln s ()areoxfcoydfm e ies;s0t2um(rpno4am elfvt s arrrxmpno1olx  fctydfsDra(mo ()alxoir oy1opDe ivslt  rumio3oo4optemfci ( s2umur ot1tpx mfcild aDran p;u4 rtoxrcoodomt li ols0s2urxopny1am n ivias a2um( pnu1olx if3iltfm2eanvpn(4artnmf oa1latran s;(0srumxm oydal n nes t)srumu pot4tltoiiciytlmDel( o t)altoircoadlmteau i;s0seur(r iu4ol n fci (  rtaxr nu1aet  o3iadfs2um(mpnt4 rtrxrcoatfaDeaueil( texm(r nu1olt mnesl(  rrr(rpoo0aetnmf3ildfm2rlu s;t0trxrir3ty1om  luvo t0s2xoxm3nudlpte ncsas  2um(r nt0olxnifetatla2rmn snt0alxomr iydfmtr i o t tetmio3iodalt liet sfsDrrumo;u0oetoiieiytfm2umnvpn(0 exnmo tytfpD livsl()sexo(o3iodale  nciat) 2umurp;o1optomieiatlm elnmo;t4 exnxo iatla  an o s sexr(mpiu4llee feiasfaDtmxr nt0alto o3ilt sDrauvp (0treomo3tatop r nvs;(  2tmxr oodll   nciltf Dtaxmonu4teenmo3iydlm umnmp;(4artnmr3iotoa eaivi;s) 2uoirpnudlmtemncs t srrr(  ot4tptnmf3iltla rm(vpnu0alxnmr to1lpt aies;s) rtrxo3iodomen ietat aDtm( p;t1texoii3iltfs elumo;()artrir todopDe n ols0srtr(mpiydop emietlsfs2tmxmo;o0opx mietytlm uanvpn()trxrmfciytfp eanvo s  2toxo3io1omt mnes (f 2raxrpot4oltnmfeiasfaDua(vp;u)arerxrciatfaDeaieils t2toirpoy1om   netas  2rau pnu1alxnioeiys mDem(ms;(0treoif3ootfateluvi;s  etrxr3iy4lmt  nci s)a2umxrpoo0opx  f3tlslm2eluvsnu)aetnxrcia1fpD au s t0t2tmio3oudop elieils s2tmumoou1apt mf3tytlm2rm(vp;(0aetrxocia1fm  luvs s) exo(m3iydlpe  ncil(fa2ta(rp;u4olto o3iytfmDulums t0tlxrmf3iatfpteauvils0texmxo3iudame  fvtltf 2rmxmoou1opeoio3tyslsDea(mo t4aeeoif oy1lmDraues s setrxm3ny1al e ict ()a2um(mo;o4tpe mf3iytfs2emums (0 lerxf oatop  auvilt seumxo3oy4lm  livsa(f ruax  nu1oetniictysfmDuanmp;t)tltomo3oydlpDrliei;s0sexr(opoodamt lnesas)artr(r ot4oexo iciaslm2el(mp;t4 rtoif3iodfptraueil() rtoir3oydale mncsas a2raurono1aeeo fetat a2rl(vpn(0 eeoxr todlpD an slt)seuriopnydamtnlnvslsfsrrauro;t1tetnmfcildlmDuau sn(0trtomr3oodfp eaivi;s0trtoxopnu1om nmfesls)s2rm(m nt1oetomietad s rlu o (0 rtoxf3oytlpD  uvo;(  ruoxrpiy4omee iesl()srra(rpnu4tpe iictlslsDrlums t4teermf iydfatrluei;s0 rum(opoo1llee icsat)sDumumoot4oeeo octydfs ean o t4treoxo3ia1fa rauvs;t)teurxrpoy4ale liviat)sDua( pnu4opxnii3ilt sDulump;u0 exnmf3oatfm  ai o;(0t2umiopno1lm emfes t) 2ra(mp;o0ope  oeiadlaDemnvont0artrircto1lm   ivols srtoim no1apeelfci t artm(rpou1aet  o3iyslaDumnvp u4 exoxo3oy1fpt an o;t)s2urxr nydopt mnesls s2ra(rooo4opt iociydlm2ra(msn() lxrxf3iytom r ies s  2xo(mpoodaltn fctat  2tmxm no0olxomfciyslm2uanms (4treoio3iytoaDr neolt  eto(opiu4llte nct ()sDtau onu1olt mieiatlm elnms (0arxnxociotlm e nesls s2to(opoy4om  livsas arrr(mpno4olen ietytlm2ul(monu0 exrif3iadlm r u s t0srumir nu4al emfesl(  rumu onu4ope  o3iad a ra(vsnt4aetnxf oadfpDeli sls)srurxr iodlmtnmnei t  rurxr ot1aexo fctatfs2rln s;u0aetrmo iytoptran o s)srtoxopou4ame mncsls sDtrxm oo1optoifeiat s rmnvsnt0 eermo iy1om elivs;s0 etmirpoodol elnctlsfa2taxrpnu1tltn o3ias a2rmnmo;t) exrir3totfptrauvo;s)seumxm3nydllenlfesa()s2ua(moot4tpeomf3iytfs rlnmpn(0 lermrcoo1fp r ueo s)srxmxm iudlpeemfeiat a2rm(r ;t1oexn i3tytls2rauvsnu4 eerxocoa1lpteanvsl(0 rtmxo oy1lm elnetlsfsrra(ront0tex ifetasfa rlnvont)tetnxr iy1lpDeln i ()tetmxmpou1om emies s  2ur( pnt0aexoiietadlm2uluvo;u) lxnxf oydom e u o;s)t2xrimpou4apt  ictat) Dtru  nu0apxomi3tys aDem(vpn() rtoif3ootfateauei;(0teuo(r iy4ol n ieia() rtrurooo4oeto fciadlm uan s;t4altrir oa1omD aivo s)s2ur(o oy4lpt lfvsls aDrm( oou0tleoioeildfsDrauvsnt4 etrmo oytfpDrln s ()seurxr oydopeelfciat  2ta(roou1tpx  oeildlm el(mont4 reoif iadfat lnei s0s2toxm oo4omt  ivs ( s2trxr no4olt  iciysfs rm(vs t4aexnmfciadfaDe ieo;() 2uoxrpno1ome  iciasfaDrrxmpou1opeomo3iad aDrm(vo;t4aetrxr tytlmt lueo;(0s2xm(m3io1ole mnvtat arrmxrpno4tetoioeiat sDrluvp u0tltrxrcty1faDe ies (  rxr(r3iu4apt mfcilt)aDrmum nu4aexniieilt s uln sn() leoxf tytlp r ieil(0 2xrir oo4ameelivta( srrm(mo;o4aptomoeiydfsDuanvp () leoioctydfp r ivs;s  2uoio oy4omtnmfvils sDta(  oo0oltn iciadlsDua(mp;u) rxomfctytlateau sls trtoirpno1aptemivsl(fsDuauro;o1aexnmoetadfa uanvs ()trxnmfciatlm rlnvilt)trxoxo3nu1llt  nvtltf Dumum ;u1oet mocild a emnvpn(0tetrio3oo1op raivo t)trtm(mpou1amee fvi t aDrrx o;u0apt  fetldfa eanmo;() lxoxo todfpt  ivo t)srxmimpno1amt  feia( arrau  nt1oexnmf3iadfm em(vs;u4tltoifctodoatrai s s0trxoxm oy4am e fvt s aDtr(r nu0tex ioeiytfa rlnvon(0texrmrctadfmDraneo;( t2umxrpiu4ale lnctl( a2tm( ono4alt  ictasla rm(vs;u4aeeomr oytoaD li olt)srxo(rpoo4lmt livtat)s2tm(ro;t4ope moeiyt sDeanmp (4arenioctadfm rlueil() exoirpno4oltemfci s) Duau poo1apto i3tldla uaums;()tlxoxrciytfmDr i i t setr(opiu4lm  mieia() rrrum ot0tet mfcild s um(msn(0tltoifcto1fpDraneo t texrxrpnydll  lfvi ()aDrrx oot1tee  ietadlaDrmnmp;t)altomf3oatom  lnvo s s2umio oydlmenlfei sfa2raurpno1olt mi3iatls rlnmp (0 rtrmocta1opt auvo t  eur(opiy4ope  nvia(farumx ono1oet mfcilsfmDrmumsn(0 lenxo tatlat  u sl() exoio nydam   ict ()s2rrurpoo0ape mociatfm2uaums u4tetniociotlp eaneo (0 2um(opiy4lp  livs t) 2tax o;u0tltn ictatfsDeaumsnt4tltomr3oatomDran o;(0 rxrio ou1amtn ncia(  2ua( poo0apxn f3tasfs2rln s;t)trxnxrcoydomD aueols0sruo(m nu4alt mics ()arrmur nu0tlxo ieiysfa2rm(mp t) renxf to1opD ai i s)srumxopoudlm nlfetltfsrrmxrpou4olenii3ild m2uauvs (4trtnxr3oo1fp eln o s s2xmim iy4om n fct s)sDtrxm oo0ole mi3ilsls2raumo u0alxoircio1oaDelieol(0t2xoim3iy1lmeemieia(  Dum(mpno1olt moctltlsDrm( s;u) etomociodfpt ln i ()setmxrpiy4lltn fcsa() rtrx oou0tex mietas s2um(vpnt)texrmociatfat lu i t) 2urxm nu4lm emicsl(  2tmu ooo0tpxomf3iytlmDra(vo (0tlerir3to1lmt ln ils)t2xmim3io1omtelicia( aDumum oo0opxomfciat aDra( s t4altnmr iy1lpt aies s0 2xriopny4amtemicsltfs2ta( o;t1aleo ictadlaDeaums u0 eeomf3todoaDrai s ()t2uoim3ny1apenlnei sfartrum ;u0apeoifctldfs2uanmo u) exrxr totfatrai i (  exoim3iy4ome  ncsa() 2trx pou4tpx moeild mDum(mp;t0aexoxr3oa1oate i s s) rtrir3ny1oltn fvia( artr( oot0aetnmoeilsla2ua( pn()treoxr io1omDe n ils0srtoxo iodlpen fvt t s2rr(ronu4oexo f3tys a um( o u4aexrir ia1fp rliesl(0sexoxm3iydlmen nci s sDtmxm ou4tex ii3ilt s rauvs u)trtrmo oo1lpDeluvs s  eum(o3iudalee fcils) rrmum ;t4tle  i3iat mDuluvo;u4 ltomf3oodlm  an ols t2xmirpiu1omtemfvt (f Dtmumpnt4alxn o3ildfm2uau o;u0arxrxociydlm elnvo;s0texmiopnu1omen fvtl()aDuru  ot0teen fciysfs elu p u4 rxoifciotfa ranvi;t0s2xm(m oudamtelictlt)a2uaxr nu0ope mociysls2elums;u)alerio3to1oaD livi;s) 2uoxm3iu4om nmfvils)s2rm( p;o0tlen f3iaslaDemn s;u4 ltrxrciotfm  auvslt0srumir oodlmenlnci () 2taxr nu1alx  i3iadlsDrmuvo t0 rxnir ia1lm ran ols0trxoxmpou4llee fvs sf 2urumont4texnmieias m2emumo;t0treoxf iadlm eln i s teumxopiu4opee fctat) Dtr(r ;o1teenmoeiadla2rauvs u4 exomo iy1latr ies t  rumir iodlle  feslt  Dum(mo;o1oetomieiytfm2emn s u0 exrxo tatoat aieslt  etmxmpnydlp emnvt t s2trx pnt1apt if3iasfa2rluvp;u)treoif3todoat lu i t t2tr(r3io1lm n nesat artrurpoo0olxoii3iytfm2uan s t)aeeoifciatla e uvi;()t2xo(m ou1ll n nvt tfarrrxmo;t4apen f3iatls2ranmp;(4tltnmr oo1fpDrlivsls0s2xmxopoy4lpe mict sfs2ta(ronu1oetomi3tlsla2ulu p;(0 lerifcto1fa rlnvo;t0trxmxopoudop  lfvtltf Dum(root4tex mi3iadlmDem(mont) lerxfctadfpDe u o s srumxrpiudapt  icilt sDurxmoou1opt  fciyd sDranms t4tlerifcoodomDeaueslt seuoim no1ll e fvsl()aruaum ot0tltnmictyt aDean p ()aexrif3oatfat livs;t setoxm3iu1op   nct ( srtauronu0tltoioctasfm2elumon(4artoxo3oytfpDeaivsls  rxoxr no1opte fvtasf rrrxronu1oee mi3iytlmDul(vo t0aeeoxo iytomte ivilt s2toxm3oo4oltnmici tfartmu pou1tpen oetasfm rlnmsn(4aeermf tydomt lu olt  euoio iudamen nvsa( srrmumont1tpenmfetltfs rluvpnu)trtoif to1lpteaieo t0t2xr(m3no1aptn ict (fs2urumpou0aetomociad a eanvs;t0tltoif3oydlp rau o t)t2uo(r3io1opt  nvt (fs2rr(r ot4apxnmfctydfsDulu s ()alerio ia1lmte nes s) rtm(mpiodoptnlnciat)srtrxrpno1apxn f3tydfmDeanvo u)trtnxrcoytfa r i i;t0s2umir3io4om  lieiatfa2uru p;o0oee ii3iytlm2rmnvo;u) leoxfcoy1lp e nes;()truoir3ou1aleemfct sf Drr(r nt4ale  fciytfaDranvo t)artomf3ta1oateli i ( t2xoim3io4lm n net (fsDrr(mpoo4tee  oetysls2uanmpnt4 eenxrcoa1la ranvo s)srumxr3oy4apeemnctlt aDumx  nt0apto ieiyd a elnmp t) etnif3oytlmDeai o;s) rurio iydlpenlivtls) 2tm(m ;o4open o3tadfs2umn o;t4aexoif3oydom eau s;()t2urxr ny4lm nlnesat a2tax  ;o0tlt if3iytfa2rm(vsnt) rxnmo iotfptelnvils0texm(r ny1lpt lfvtasfsDrrx ooo1tptn o3tyd a rmump;u4tlxnmociotfpDrli slt0 rxoxopiydllt lnet sfa2ua(  nt0oetomoetlt sDran s t4 rxrmrcoa1laDeauvsl() 2xrio3iodopeemfvi t) 2tr(mpou0tlenmf3tytfa umu ont)tltrmr3iotlm r uvo;() rurirpou4ap n neiltfarraxr nu0tltn ociytlmDrlnms;t)aetnmr3iydfptranvs;(  2toio iy1omtelnesl( srumxr ;u1ape miciadls rmnmsnt0artrio tadoa eaiei s)t2ur(o3io1al  mietls s2rmumpot0tlx  fctasls uan p (4 lxrioctydoat aivols) 2umxopiy4opt  fesltfartrur ou4oetomfeiadfmDumn s (0aleomr io1lp r n i s)t2xo(o iy1ol e fvsls a2rmurpot4aexo fctadlaDranvo t) lxnmo3iadfp elnvslt s2to(o oo4lpenmfvsls) rtau  no0aetomo3iysfsDuaump;u0 exrxocoatlateaivo s)teumxrpnu4lmtemfvsat) Dtmxmo;o4opx  ieiadfs uanvon(4aeerif3oatfmte ivsl(0s2tm(r3oy4om   ics s) Dta( pno0ope ii3ilslaDuln pnu0tlenmf ootfmDraivs t  2tm(o3iy4ape liei ( s2trxmont4aptomf3iatfm2umnmo t0texrmr oatla eai slt0 eumxo oydapenlfvt tfsDtru pot1tleo ociltlsDemnvp (0teeoiociodlmtr i s;s)teuo(m iy1apt  nviatfsDtrxm oo0oleoioetys s ra(mp;()aexnmrciatlpte nvils s2tm(r oy1optnlietls sDum(m ot1apt moeiydlm2el(vsn(4trxnmf ty1oaD lieolt) ruoxm3nydam  lfetls  Dtm(r ou4teenioeiad aDelums;t)teenmf3iadomDraivs;s0 rxmxm3iu4lm e ictas)aDtmxr nt1oexn feiydfaDra(mpnu0arenirciydoaDrau s (0 rumxopiu4lpen nei ()s2urum ;o1ole moeiytfmDrmnvs;u0trxoir3ia1lmteanvs;s0s2xrxo ny4am n ivil(  2rauro;o4apx  octysfm uaumo t)tlermocoytoaDrauvs;t) etmxr3nudlp e ictl()aDrax  ;u0tetnmoeiatlaDum(vsnt)areri
\ No newline at end of file
@@ -0,0 +1 @@
+nvs;()t2tm(o3iodlleemfctlt)sDtruro;o0optomo3iadfm ranvs;u4aexoir tatfp  luesl( teumxo iudlptnlieiat) 2rrxmont1oex if3ias s2uan o t4 ltnmr3iodlmteauvi (0t2to(m nu4lmt mfeias) 2uaumooo1ole moeilsfmDrlumo (4 lxnmr tytop  lnes;t trxrir oy4ap n icilt  rrrx o;o4opto fetysfsDulu onu0 lxnxo oy1lp eluvil( trurxopnu4omtemici sfaDrm(m no4aet if3iaslaDumnmp t)aexomfciadlpDr nvsl(0s2xmim3iudal nmfvtlt) 2uru  ;o1ope ioeiysfsDrln sn(0trenif3ootopD lnvs ( sexoiopoudlm e ies sfaDrrx ono4aex mociytlm rm( o (0aleomo ty1lmt luei s trurxr3oydllt mfcs sfa2tmxm nu1altnmfeild s emn o t)aetnif todom  anvsls0t2xmimpio1lpte nvtat  rtru oou0oexoifetltfaDumu s t0aeenmf3ty1fptrai i;t) rto(mpny1apenmfct s)sDur(mooo0tle mfctasla el( pnt4 eerir3oytlptrln s s)s2umxrpoydolt  nctas) Drm(mp;o0aetnmieiltlmDrmu pnt0 lxomfciy1latrai o (0sexo(opio4op  lfvsa(  2uau ono0aptomietltls2ua(vsnt) lxnxo tydfptelu s (0tetm(r3iu4am elfvsltfaDraxro;t0aeeomi3iysla2ulumpn()trtomf ia1fpDr iei t  exo(o oo1omtelfei (fsDrmu o;t1tpe  f3tysfs ua( o;u) lerxr3totlaD lu sls  rum(opnudomt  fvtasfaDururooo0tex  ietldfaDuau pnt4alxrif3ta1la   nvslt) 2xoimpiy1ole  fetasfs2ta(  nu1alen iciat a emu o;u)aexrir3iydoaD lneilt)setr(r nodopt  fei sfsrtru pou0aleomf3iat s2uau on()arxrifcoadoatrauvo (0srtoxr3ou4apen ivtat s2rrurp;o0oexnmf3iadfs rl( p (4 rxnmrcoodfp   ieolt0t2tmxmpiydolt lncia(  2rr( poo0altoifeilslaDrlumpnt4tlerio3ootfm eli o;(0s2xrxrpnodalee fvsatf Duru pot1teenmoeiatlmDum(ms u0 rerif tytomtelneo (  2tmxm no4lmee fcs () Dta( onu1oltnmiciadfm2em(mp ()aetnmf3iotlaDrlivslt0 2tm(r3iudlp nmfesls) Drmum oo1apeo oetls m2uanvp;(0 lxoircia1oaDelueolt)srum(mpoo1lp  lies t  rra(mpou4tee iieildlaDeanms;t)tlxnmf3ootfatr ueolt0 rtrxo ny1lm nlicslt  rrmx pno4oex ifetltlm uanms;t)artnmrciodop raneols0 etoxm3iu1om n ieiat)sruax  no1optn ieildlmDuanmp u4tlxnmo oydfmt luvs;s)s2um(o nydap n neils srrmx pot4aex iictysfaDelu p (0tlxrmocoytlmDeln ilt0t2uoxo3oy4lmtelfes () rumxm nt4optnio3iadls uaumont0teerifcoy1om  lnes;(0teuo(mpiu1ll nmfcia(fsrrau p;t4aee ifeilt s rau p;t0 lermo oatfaD an ils seuoxm ou1al e fciat s2tru pnt1tpxoif3ildfa2em( p;t0tlxnxo3oydop e ies;t)s2trim nu1omt  icslt) 2ra(moou0alx mociatlmDulnmo u)alxrmoctatom  lneol(0t2tm(o ny4alenlivtlsfaDrr(moot4optomiciyslm2ua(vs;()tlxrirctodoa ranvsl(  ruoim ny4omeemict (fa2raxmo;u0aleo oetlsfm2ua(vs;u)tltrmf3io1oa e uvs () 2to(mpou1ap emictl(fsrrmx o;t1aleoiietaslsDran s;u0 etnio3oy1fpt li sls trtoirpiu4lpe livt sf Dtmumo;u0texnmfciaslm rluvs;(4aetnmr3oatfm ranes s0 2urir ny4lpe  fctat sDtrx  nt0optoifeiytla rlnms;u0artnxfcoa1lp   iei t teto(o nudlmtnmfes ( a2rmumpnt4optn ieildfaDemnvs u4teenmf iotfaDe nvolt srxr(mpiodope  iet s)a2rrxrp;o4oeto o3tat mDran s t)tlerxocoa1omDr u i;(0 eumim3oodopt lfeta( a2um(rp;u0tlxoifciltfa2ea( pn(4teenxrcoydlaD ai i;()srum(m3iu4altnmfcs s sDum(mo;t4olt  oetytfs2em(mpnt4alerif iytlpDrlnvo t s2to(m iudop elict (fsDtruro;u1oleniociatfs2rl(vo;u4trxomr to1fptrln olt0srtmio oo4lpt  ivtat) 2tmx p;o1tetniociad mDuauvs ()areomocoa1lmDraneolt trxoxo3iu1op nmfciat aDtr(  ;u1olx ioetls aDuluvo (4tlermr oy1oa elnei;t0teurio3oo4lp  miet (fsDtrumpno4aexnmo3ilslaDua(vp;() rtoxo3tytlmDraneils) rxrio iodome  icsatf Dtrur nt1opto ieias a2eanmo;t0 eenmf3oo1fpDeanvo;t  2toxm3nydamte fctl( arta(monu0tlenmoeiytla2eluvo (4teenif tytomD lnvil(0sruoim3iu4apeemictl( a2tmumoou0opxomf3ilsfa2ea(vp (4tltnmfcoydlmte uvs;t0 2tm(o3nu4ol nlies sfa2ua(mpot0tptoio3iyslm uln o;(4 ltomo tatlmt  u i;s trtm(r3nudlpt lncils aDuaxrp;u1opx iieildfsDra(mpnu)trtrmf3iy1lmtrlu i;t  2xriopiudlmtemnesls)sDuaurp;o0oltn fciydla2ea(vpnt0tlxrmo3oy1faDran il()trurio io1lp nlicsas)srtmump;t4tex  fctydla2rlu p;(4 exnxf3oa1fa   ueils)t2umxm3nu1lltnmfct sf rrmx p;o0optnmo3iaslsDum(von(4aeermoctatomtrlueo;(0texoxrpoy1ap nmfvt tfartmu  ou4aptomi3tadlmDrl( p t4aexnmr ty1omt  uvs;s)t2xmim iu4ol emnvil( aDtmurpno1aetn f3iydfmDrl( p u0areoif3ta1lmDrauvs;s0 eumimpny4lm emictasf 2rm(rpno4opeoif3iysfs emn p;(4 etrxfcoodla rli sl()srxr(m nodlmt mfetlt)artaxmooo0tlxnmietyd mDrmn snu)trxoif oadlmt ln o t)t2uoxmpoo1aleemnvsas)aDuaurono1olxomo3iysls ranvsnt) rxrif3oydfpt  nei;( t2tr(rpnudlle liciat aDumx  ;u1texnioetydfm raump t)texrircoydomt  nvslt t2tr(m3nu4lp   nviasfaDtaxroou0teeoiietys mDul(vp;t4trxrxoctodoa eai s t)srum(r iydaltnmnviltfsrrmxmoot4tpeomo3tad m2rlumon() lxrif3iatlpDeanes t)t2xrim io4lmenmnct (  Dtm( oot1opeomi3iydls2uanmsn(4 lxrifctadfmD  n ils0s2xrio3nudll elfctasfs2rr( oou0aee ii3ildfaDulnmsnt) lxoxr3todoa rln sls0teurxo3iy1om  liet () rtr(mpnt4apenifctaslaDel(ms (4tetomociatopt lueo;()sexr(o3iudamenmfesa( a2rmu p;o4olenmictysfmDelumo t0alxomo3iotfateln sl( tetr(mpno1altn ict t)a2rmxr ;o1alxn ictytla2em(vo;u4 eeoif ia1fp rln i s)s2xmirpnu1alee ics t) Dur(ro;o1olxnmi3iytlmDul(ms;u) reoxo ia1omt  nvo;( tetm(m oodamtemietat)sDtmx o;o1tlto feiatfs ra( p t0 lxrxf3oatla elnvi t0t2xoimpiu4lmtemnctlsfaDtr(mpnu0tlx ioctls s2ra(vs;t0texrxr3oadlatrlueils sruo(r3no4ole lfcs (faDra(ro;t1oex  ietatlm umnms u)texoxf oytoaD au ils)trxmir3ou1oltemncs t)s2rrxr nt1tlxn oeiatfmDrlnvsnu4alermrctydoateln o s)t2uoim3iu4lmt livta(f 2trumo;u0tee iociadlmDranms t4arxrmf oodlmDrliei;s)srxmiopiydam   fei t srtax ont1texomf3ias a elnvp;u) rtnio tytla  aues (0t2xr(o3iydlleemnviltf ruaxrpot4tltomo3iatlm2rmnvonu)tltoif3ootlpDrau i t)texr(opoo1optelneilt)s2uaur ;u4tltomociytfs umnvpn(4tlenxr oa1oa e ueo;t trxo(rpou4ale lfeslt  rtmu ont1tee iieiytlm rm(vpn(4tlerio3iadfateaieo;t0 rxm(mpiu4ap emfciat aDuaum ;t0opxomo3iadls2eanvpnt)altnxf3ty1opD lnvs;t0 rurxo oo1ame liei s  Dtmum nt1opxomo3iadfmDrmnms;()aexnmr iy1omDeluei;t  rxrxo nydalt lieta(  ruaxmpoo1tltoio3ildla2umu snt0tetoxr3tydlpD an o;t)srtmim3nydalt  neia(f rtmxrpou0texnioeiyt mDeanmo t4tlxrif oadfmD aneils) etmimpiy1lpt mfct () rumuro;u1ape  f3tysls uln s;()trtrioctydopte uvslt  2uoiopnodal n ivtlt aDta(m ;u4oltnioeiydfm em( onu4 exrxfcoytoaDean ils)srtoim io1lpenmfetat  rtr(rp;o4tptn ictydfm2eanvp u0 rtrirciy1la  lnvs () exrio3nudolt mfvi s)s2rmx p;o4openmfetytfm2ulu p t) rtrmr3totfateln i ()s2uoio3io4ape mict t  rrmxmpnu0oltnifctadfs2eln pnu0arxrmf oo1oat anes;( seum(o iodlmtn ies ( srtru p;t4tpeoiieiltfa umnmo (4alxnifcootop  au ols s2xmim3ou1lle lnesat aDurxr ;t1aeeomfeilsfsDua( onu0 ltoxr3iodfm  luvol( srurir3iu1omtnmnvil(farrm(root4oetn oeilslaDulump;u4 ltrxr3iatoa  anvo;s trurim ou1amenmfctasfsruru p;u4tetnifeiysfsDel(vo u4alxnxoctodfp eaneil()srur(mpnodlmt lnciat aDraxro;o1texomf3ilsls umnmo;t0tltomfciytfpDrau i;( setr(mpiu4ame lfeslt aDua(r no4aee ioetysfs2rau p (0 etnir iotlm e i s;s srtoxm oy4amt lnei sfsruau poo1ale mietysfmDra( on(0trenxocty1lmDelnvolt)s2xm(r3nu4lpe mfctls) Drmx p;t0tpxn fciys s2ea( pnt4 rxrmr oa1lm eaieo;s t2urirpou4ap nlneiat) rrrxmp;t1aexoif3ilt sDrmnmp u0treomf ia1optr ieo s t2umxopiy1amtn fesl(fsrtm(m ;t0oetniictldla rlumpn(4 eermrciatoaD lu i;(0srto(o3io1lp emnvias s2tmu  ;t1tex moctytfs eanmp;u)aexnxr3ia1lmteauvi ()texoio3iy4aptn icia() Dtmxmpno0tltoif3iysfs2uln p u0 rtnmfciy1fate neo;s t2urio3no4lpe lnetlsfsrrau o;u1tleo feiydlsDrm( pnt)texnmf3oy1opt an o t)t2trxopoy1lptn ictlt  2tmxro;u0optomo3iatlm2eln ont4 eeomf3iy1om r uvils tetr(r3ou4lp e ivt sfaDumurono4oeenmfciysls2uanvonu4alermf iotlat  neo;t  2uo(r oy4aleelnesatfsDrmu oou4olt  fciadls2rmnmo ()alxrir iodfm ean ils) rtrio iy4amtnmiet () Drrumpnu0tlt miciydfaDrluvsn(4 exoxf3iatlmtelivo t)s2uo(opnu4op 
\ No newline at end of file
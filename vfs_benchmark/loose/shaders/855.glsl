@@ -0,0 +1 @@
+ieols0texoxo3ny4lmeelfesa( a2ua(ro;t4texoiociys s rlumsnu4trxnmrcta1oa e ues ( trurxr3oo1al nlfvsls arrau o;o4tee  fetyt a ulnvo;u0 exnmfctydoaDrlueils t2umxopnydamtnmnvilt s2rrxront1tee  feiatla2ea( p t) lxoircio1fptranes (0t2tmim3iydalenmiviasfaDtmurp;o4aexomf3iad sDem(mp u) renmr3to1fmD  ues s  eurxr3nudoptn ivi ( a2ta(mont1tltn o3tysfsDran s;(4 rxnmf oytomt anvsls0 eto(o io1oleemnctltf Dua(ro;t1olxoifciat m em(vsnt0 etnxr oadfpDrau s s  rxoxm3ou1om emfet s)arrm(rpno1apxn octys aDrmu p (4tleoxo oytoaDrlivol(0t2umxo oo1ape mneiasfa2tm(rono1opeo feiyt sDulnvo t) eerif ty1fmDeln i;t0trtr(o ny1alee ietat)arururpno4oleoiociysfa2rlnvo;t)trenmf iydlateaues s0s2xmimpiydam   nctl( a2tmxrpnt0tet  o3iad mDel( p;u) eerio3ty1laDrlieil()t2tmxo nydaltn fvs s  2raxrpot4tpen ieiasfs el( snt) etrmo oy1fp e ues;s) 2xrxr3ny4apenmicil()aDraxro;u1tltnmieias mDea(msnt) lxomo oadom r n ilt  2xr(r oudlmeemicias)arrrum no1teeo feiltfaDuluvo;u)tetnmo3todlat auvi s0s2trxr no1op nlnvils artr(rono0tpe  f3ilsfm2emn onu0tltrio3iodfatrlu il(0 2uo(o3iudamtnliei s) 2um(mont4alx  oetyd mDeauvp;u4tlenmfcoo1fmtr uvo ()seurxopou4lltelfvia()a2rm(r no1tlt mfeiatfm ra(mp;u4trerio tatlm  lueils0trxmim oo4olt  ieiat) Dtrxro;t0olx iociatfm rmnvp;()alenir3oa1omte nes;t)sexo(opiudamtnlics tf Dum(mo;o1tltoioetytfm eaump;(4artnxr oa1lmt lnes ( sexrxo3oydlpt miesa() rtmump;o0oleo ocilsls rl(mp (0arxnio ootlmt  ies;s  rtmio nudomen fet tfa2rm(mp;u1tetn iciyt a rl(vsn(4 renmfctadoptran o;s0t2triopoo1amen net sf 2uru  ;u0apx  ieils m uauvp;() exrxr tatfmtrluvs () 2trir3iy4amte fvtl( sDtrx ono4ale  ocias sDua( snu0tlenmoctadlm   ivsls  eurxm iu1oltnmfcta(fa2rr( pot1aee  o3tlt s2rluvp t)trtoif iy1fm r ieo t0trxmxo3oo1ap nlfeil(  2tm(rooo4teeoiiciasls2rlnvs u) rxoxoctydlmt auvi;t) exrimpnudomtnmfeilt  2rmx  no4opx  o3ilt s ua(vo ()trenio todop e n s t s2xoxr3oy4apt mfctatfa2tm(m no0texn f3iatlm2eauvp ()treomf iadopDraivs t teur(m oo4olte netltf Drrxmono0texnioeiltfaDean p;u)aexnxr3oatopDrai s s trur(m3io4am  mfct t  Dtru ooo0tee  f3tad aDemn o;(0aexnxfctatlaDeaivs;t  rxmxrpnudape  nesa(farraxrpnt0olx ioeiadfm emn snu0teeoifctodlpDraneo ( srumxo oy1oleelnvta()s2rrx poo1texn iciytfa2emumo;(4tltrircia1fmtelnesls0srumxr3iodol e fvt ()srra(m nt0tex mfeiysfs em( snt4 exoxf to1lp r nvi t0srxoxo3oydale miet tfaDtax o;o1apenmoetlt s rlu snu) ltrmocta1fmtr nvo;s seur(m3oo4lme  feils)sDtrxroou0oetomf3iltlsDelnmsnt4 etnircootomtrlnes;s t2trim3oy4lmt  fvta() Dumx ooo0tpto o3iatlaDum( onu4altnxfciodoatr n s;t) etoim no1lle  fct t s2ur(r nu1teeomociytfa emn snu0aeerxf3iotoa e uei;t) rxmiopiydlp  mnesls arumxmp;o4tle miciyt s rl(vs;u)teenmr iatopDr ivsl( s2tmim3ou1omtemivias)arra(rooo1tex  o3iasfm2emu pn()aexnmr oa1omt  uvs s  rxmio oo4alt mietlsf Dra(ro;o4tlxnif3iltfaDel(mp () eeoxfciotlm  lu s;t0s2umxo iu4ape  nctlsfsDtrx pot4alxo fciyd a2rluvpnu4trtrio3oy1fateauvo s  rum(m3oy1lmenlnctls  2rmxro;o1aptomoetlslmDeanvo;(4 ltnxrcoo1oaDeaneo;t t2uoio3iu1lpenlnvtlt a2uax  nt1tleomictltfsDeau s t0 rtnxo to1lmDr i o;t teuoim3iy4ap n ies (fsrtm(m nu0olxniiciadfa2rauvpnu)trxrir3iotlp e ivsls)t2xo(r3iu1apee ietat)sDumur ou4tex  o3iatfa em(mp (4 ltoxrctadla  anes;t s2xrirpiu1ameemnvta() 2tr(  ;o4oeenmo3tytfsDuan s;u4 eeomrctydopDraneo (  etr(o3iydlpt mics ()a2um(mpou4tee iietlsfaDua(vp;u)tlxoxo todlmDeauvol(0 2xrir3oydlmt  ies t srta( o;t0apxoio3tydlm2emnmpnt)texnmrcty1fatr nesl()trtr(rpoo4omenmnetlt s2tmxrp;u4oet iieiytls2ulnvo;()trxnmf3oo1opt ai s t  2to(r ny1lltn fviasfsrtmurpno1opt  i3ilsfa2rm(vp;t4alxrxf3iotfaDr i o ( s2umiopno4apenlnvtls  Drmxroou4aet  oetatla2elnvp;t0treoxf oatfmD liesls0 rtoxopiudlptemfctltfaDrrxmo;o4ape io3ilsfs2rluvs () rxniocoy1op  ln sl()t2toim nodal elnvslt  rum(rpot0tlxo oeilt m2emnmon(4tetnmr3oatomD  ieo;s  etm(m3io1aptnmfes s)aDtax pnt4tpxnmfetasfmDul( p;u) rtrmo3oo1lpte u ol(  rumim nudolte ivi s)s2urx onu0altn octldlaDum(vont)altrmr tadfa r ivilt0texmxo3ny4olenlnvi sfaDraum ;t4olxoii3tys mDelumpnu)trxnmf3oydopDrluvslt)s2xrxrpoudal emnvtlsfsrumxmpno4oetomfeildls2rmnvonu) ltnmfcoodfmt  ueolt)sexrim iy1apt  fcsat)arrmxmono1alx miciyt m emn p;u4teerxfciydlptrai o s)teumim iu1lm  licilt)s2uau  ot0texoii3ilslmDeanmsn(4 rxrmrcio1lpDr u il( texoxm3nu1oltnlivsl(f Drmurpot0alt io3tad a ulnmonu0tlenmrciy1lpDelu olt srtr(o3nudomen ietas) 2urum ou1opx  ociytlsDraumont0tetrif3oytlp  au slt) etoir nydlmtnmnetatfsDrmur ;u4opeomfeiadfm emuvp;(4aexrir3ootlmD livsl(0 exoimpou4ol  lnetls aDra(  ot1aetn feiadlmDul( o t)alxrirctadfatr n i t  ruo(m3nodlm  mncias)sDrax onu1tpeo f3ilslaDumuvo (0artriociadlp  ai olt0t2trxo oydlm nmneil(  rtrxrpno4opxnioeias m ea(vont0arxnio ty1oaD  ivo t) 2tmxmpoodapenmfct sf ruaxmpnt0alxomfetas sDrl( on(0areoxr oatfp r ivo;t0setoir oudap  mfvt s srtrxmooo4oexomoctltfs emnmo;(4 rerxociadlptrli s;t srtoiopny1omee nci tfartr(ront0oexoiietls s2eau o t)trxrxf3tatfmDranes;t) 2umxm no4lmte nei s  rtrurp;u1teeoiieils s2ulumpn(0 etoxf tatlpt  n i;(0s2tmim3ny1olt lfetlt)sruaxro;u1apenmfctltlmDrl( pnu4alxnxo oa1om raies;()s2umiopoo4ame  fvtasfsDtm(rono1opto feiadls2eaump;(4tlxomr3oa1oa r ieols texmiopiy4am n fesa()s2taxrono0alenioetltfaDumuvp u4arenio iatopt  n o ()trxmio io1oleelivsls srtaxmo;o4tpenii3tldlsDranmonu0teenif io1lptr u s;s truoxrpou1omtnmfvsl(faDtaxr ;t0apeo ociysfs uau p;(0treoif iatfp r ivs;t)trxo(mpny1lm elnesls  2ua(ront0apt  f3iys s ulu p u0 etomo3ta1fp rai i t)trum(r ny1oltnlfct t srra(mono1alt ifctys m el(vsnt0tlerif io1omt lneil()trxr(r io1apee fei (faDur( pnt1aleoif3tysfmDranvp;(4 eeomfcoodfa r i o;( t2umxrpnydalt lncsa(farta(ro;t1aetn iciltfm rau p t0trxnxr3oa1lpD livs;()srtrir3iy1omtn fvtat)a2trx  ;o4aet mietytfmDuauvpnt4altrmo oytlm r n o;( s2tm(mpoudamtelfvsasfa2uaum ;o1alxnioctys a2eauvs u)aeenmf3iytop rli o;s srtrxo oo4am emietl()a2taxrpou4opeoiictytls ulumon(0trxoioctotla r iesl(0trtrxopno1ap nmfcs (  2ra(m ;o0ope  fcilsfa2rmnmo;t0altrxocio1lmt  ivo;t s2umxo nudapte fei (fsDuaurpno0tptoif3tydfs2ua( p ()texrmf oa1fmD  uvils0t2tmxm3oodal nlfcilt) 2urxmp;t1optomo3ils m2rlu s ()tlxrxo3oa1la   u il(0 etoiopiu1apenmnctl(fsDrmx pno1olenifctld a rm( p (0tltnmr3ootlaDe uvo s0 2toxm nodol  lfvsltfsrtm( p;t4tpe io3iytlaDrmnvonu4 rtrir oydfpt auvolt0teuo(m oydome  fetatfsrrr(mpoo0opx mietatlsDulumsnu4teenmr oo1lmte ivi (0t2trirpoodamt licias)artrx poo0olen ieiydls rmumo u0alxnmo iadomDelnvi (  rxr(m3iydaltnmfvt (fsrrmxro;t0tetnifcild s ua(msnt0aeeoxrciadlatraueilt0texrxo3iydlp n ies sf 2rau  ;t1texo i3iydlmDum( o t0aexomfciotomD lnvo;s t2to(m iu1lp nmnesat)sDrrurono4teeomiciasfm2ea( p (0alxnxo3to1lmD  ues ( sexmimpiu1lp e ivil()aDtmxmonu0oex mo3ilsfm2umuvo (4teenmr oadfmDr i o;t setoio3oydoltnlfvtl( srtrx  oo0olenifciyd m2rauvs;()teenxf3oa1fmt  ies t0 rtm(r3oy1ol nlivias)aDuaxrpnt0optniiciasla2rmnms;t0tltnircoo1opt anes;s)s2xm(m oy1omtelfesa( aDuax p;u1tee ioeias s2uau ont)teenio3iodlaD auvolt truo(mpnydol emfesat)srum(m ot0oeto ietysfa uan s;u)aetrxfcoy1la  aivi (0trurxr3oy4op e fcs t arum( pnu4tltoiiciydlm2rmuvo u)tltrxfctadlm ean i (0 exrio iodom  lnvi sfa2um(rpnu0texn oeildlm umums t4 ltrxrcootlpt lies;t  2uo(mpnu4ol  lnctas sDtr(mo;t0opt  ietltla ranvs;(4 leoxr3iytlp   ivs;s  2trxopiudome lfcsat  2rru pno0tpe  iciydlm rm(vs u)treoif3tydomDeaneo s srumxm3iy4lp n net ()sDua(m ;o0olx mf3iadlm um( o t4artnmociodfpt  uvol(0trur(rpiy4amtnmfeil(fsrtaxmo;t4oltniicilsls ul(vp ()areoifcoa1lmte nvs;s  euo(mpnydopen ictlt) 2rm(r ot4oeeomf3ilsfa2uau o;()trtoxf3ootfmD aiei t  rxrio3nodllt mnvtlt) 2trum ;u1tetomiciat m uanvp;() rerxr ia1fptrlnvi;(0 2tm(r3iy1lpenlnvsas)a2urxm nt1tex ifctlslm2umu snu4alenmf iatomDeln slt) exr(r3oy1ale  fesltfsrtru  no1tpe micildlsDulnvo () ltoio3io1om rlnes s)sruoxrpoo1lle lici s artaxronu0aexnifcildlmDrlnmpnu4texomrciydoaDelu i;() rxoir3io1opee fvtlsfsrumx pnu4tet mi3iytfmDum(vsnt0 exrxo oo1omD lneo;s) exmxr oodoptnlfct s)sruaxmpnt1tlx io3iltls2ean o;t)tlxrxr oa1omt  ies s  2toimpnydol nmnvs tfsrrm( pnt4tleo ocild s rau p;u0tleoif3oatfmDrlneo;(0teur(opiy1altnlicils) 2rrxroou0opxoiocildlaDra(mo () etomfcoadlmDe i i;()seumxmpnydol  lfcslt srraxro;u4ape mfciytlm2eau p;t0 rerxo3totop raneo t0t2trxo3oy4lp  livta()aDuru pno1apxoio3tadlaDrluvo (4 eermf3ta1lateaies s)tetmxr3io1omt lnetl(  Draxrono4olxnmi3ils m ulu snu4tetrxrciydlat au s s0 rur(r no4olt lfesl(farrr(mo;t1alto ociytls2eanvo;u0trenir3iodfptrau sl(  rxoxopiudllt  net ()sDua(  nu1apx  oeiyd aDemnmonu)arxoxr totlp  ai o;s)srxr(rpnydlm nlfcia() rrru ono4alen fetld s2ra( s u0 eeoxr3tydlp eluesl()srum(opiy1lm emfeia( s2uau ono1tex miciydls umnmsnu)tetrir3oo1oa e n ilt0 2uo(o3oudal  lnctatfaDuau pno1aet  fetlt sDrlnvo u)tetnmf tadfm   u s;s  2xr(r3iodlpe lnvs s sDuaxmp;u1alen iciltls2um( o;(0altoir3oy1fmD lnvs;t)truoim iu1lpen ivs t)s2rmxrpot4tlxnif3tytfs2ua( p (4altrmf3oydlaDr nvi ()sexr(mpno1opeemfeslt) 2raumpnt4aex moeiasfmDulnvsn() leomf3iatfpD li s t0seumxrpoydoltemnvt (fa2tmxrpnt1apeomf3iltla uanvont) lxnxr3iatlat ln sls  euriopoo1llenmfvils s2rm(rpot1oex mo3iatfa2emnvo u4tleoif iatoa  auvolt0s2tmio3iudoltemfviasfa2ta( oot0tpt ii3iasfs2um( on(4texnif3iatopte uei;t  rurxr io1lmtnmicil( sDuaxr nt1opeo i3iydfs2umn snu4alxomr oo1oat aivi;() rxmxopiu1lp  mnci t)arrmxront0olt  octydla el(vo;(4trxoxf oa1fpt au slt)sexmiopoy1ap nmivtlt)sDtm(moou4tee miciadfs2ranvsnt) exnxo oodlmDelueslt0 2xrim iydlmen ncia(f rrr( pnu1aexomieiydls2uauvo u4 rtoxo3iodlpDeaiei;s) etrio3iodaptnmncsat  Draumpoo1oexnioeildfaDuau o u0trtnio3ty1oa  luvs ()srto(o iydalt mfvt tfaDtr( pnt0teeoiociasls uluvo () rxrio tadoat  ueolt)srxr(r nu1am nliciat s2um(rpou0oexn ieiaslaDumn s t)arermo3ia1la rlnes s)t2tm(r3oo4al  lfci tfsDrrx pou1aeeomoctatfmDrl( o;u)trtoif ootlatrlueo s0srtrxo nydam emnviltfa2rm(rpno1tlxomfeiydls ul( on() lerxociydlmtelueil( truoimpio1oltn ietls)s2rr(r oo0olto oeiad s eanvp t) reomf oy1lmD aueo ( t2umxo io1ol n nvi (  Dumxm ot4alt iictldla rlumpn(0 rxoxo iodla elueslt t2trxmpiy1alte nvils)arrm( o;u4tpe ii3iat a uluvo (4 etrmr iy1laDr uvo t0srxrim3nodolt  nvi sfs2rmump;t1alx ifetyslm2uln snu0tetnxf3iodla   u i;s)srtmiopio4open ivtlsf 2umuront0tlenif3iytlm2rlums u4 ltomo oydfa e ieo s)trtmir io1lpeemnvs sf Durxmo;t1texoioeiad sDean pnu0trxnxr tadfm  aies t0t2umir3oo1am   fes ( srtau pnt4oet ifciatfsDum( s t0 lxnmr iytfa  an i;s0setm(m nodaltemfesls)s2ur(mooo4tee  i3iyt a2ul(vsnu4alerir3oatopDean o;(0s2xoxr3oodllte fcs t aDta(rp;o4oetn i3iytlaDranmo;t0aeeoif tytopt luvi;t)srxoxr3iodoleemnesasfsrtmu  nt1tlto f3tat m2rmnmsnt) rxnmo3tydopDrlueo (0s2tm(m3iu4ale mfci t) 2tm(  oo1olenmo3tlsls ua(msn(4tlxnxf oa1fm rluvils)s2toxr3iu4oltn feias s2raxrooo1tex moctad sDrau ont)artnmf3totfa eaueo;s srtoio iu4ol e feil()sDta(rp;t4oee mfetyt a2uluvp;t) rtrio3tytfmD anvi s t2ur(r iydaptnlietlt) 2rru ont1aee ioeiat a rl(mp ()texoxrcio1fat lneil( sexmio3io1op nlivsltfa2rmurpoo4aeeoiicilsfs2emu p u0aeerirctydfmDrlieilt)srtoxr3oy1opt  fvsls) rraxmp;u0oetnio3iad a2rau on(0trerif oytfp  lies t0srtm(r nu4apt mfcia(fsrurumpot1tlxomf3ias s eln p;u)aetoirctydlaDeanvs;s0 rxriopiodalee fvils  rrmxm oo4aet mieiltfaDrlumpn(0texnmrcoy1oaDrln i t)setoxr io4lmenliciat)aDtmumo;u1tpeoio3iytlm uau s;t4 ltnxr3iotfp  ln i;s0srxo(r3iy1ll eliei ()a2um(ro;t0tlxnmo3iydfa2rmn sn(0 etrxf3io1lptraueo;t trto(mpoo1optn iet tf 2rrxm ou1aleo fcild a2um(vs;t0aeerif3tatoateaivs;s0srxm(r oy1lmt  iet s) 2tmx poo0tpen f3tlsfs ra( p t)trxnmo iytoptranvs t0texr(m ou4lm n fei () 2rrurpnt4aex iiciydla raumsnt0aetrxo oytlaD  u o t)s2to(rpoodlme lnei sfaDuaxrooo0tlen oeiltfmDrmump u)aexrif3ta1oaDrlu il()seurxm oudal e nci sfsrtr(  nt4oexnmfciat mDeaums;t4trtrir iatlm   neo;s)sruoiopno4opt lfvi s)a2taxmpoo0oeto iciadls uanvp;t4 etnxo totoaDr uvsl(0truoim3ny4ap nmncsas)a2uru o;o1apt iiciasls um(msnu) etniocoatfm rlues;t0texoir3oudolenmnvil()aDraum ou1texoio3ils m ulnvs;t4alxoifctadfpD aivo t)teurxo3nu4lmen ieta(faDumuro;t4alxoio3iat a eanvo t0 lxrif3tadlpDrlnvolt)t2xmxm ny4omen nvs s  Drax  ;t1aeto i3iatfa2rlnms;u)artomr tadla e ieil(0trtoxm nydlm  licil(fa2urx onu1tle mfctad m2ulnvp;t0aeeomr3totoatrlnesls0 rtmxo no4opeelnei sfarraxmo;o4aex  fetat sDul( o;u0teenmr iatfmDelneo;(0t2uoiopiy1olt  fesatf 2tm(r nt1aexo oeiadfs ulumo (0 exoxr oo1fm eai olt)s2to(mpiudop   fctlt a2tmumoou1tlto i3iasfs rmuvsn()alenxo iodomDelu s t t2xrir iudoltnmncilt a2umumpoo0tex  oetldfa2rl(mo;t4aetnxrciytlat aues s  rto(rpoudol e nvi s srumurpnt4olt mo3tas aDumnvon(0 lenxf iadfmtr ues t  rto(mpno1lpenmnvtl()arumxmoou1olxomf3iydfsDumuvpnu)arxnxo3iotfm rau il( t2umxrpoy4amt miei (  Dtmx p;o1alx miciltfa2elnmo t0aeerxo3oodoa eluvsls  2xoxr3iy4ol  mnes s aDtr(rooo4optoiieilt m eln onu)tetrxo3oy1fmt auvi (0 2umxo iy1lm nlncilt)a2rr(  ot0aptomieiysfmDrl(vo u4trxrir3oydfatr ivol(0 etmir3oy4lptemici (  Dtaxroot0opt  ictysfs2ul( p t) eenmocia1opt  ueils t2xrxm3ou1lltelfei sf Drm(mp;o0olt iiciytla rau pn()tetoif3oytla  anes t0teurxm ou4lpenlnctat)aDtmxrp;o0texn ietyt a ra(vo;u0 lxnxr3iodlpteai olt0trtmimpiudlp elncsa()a2trumpot0teeomi3iyslmDeanvp (4tleoif3oatop e nvs s0t2xmiopoy1apenmfvt (f 2ta( o;o4optoif3tadlaDrmump (0altoio3ia1oa   ieilt)t2tmir3no1om   nvs t) rta(r ;o0aex moeiat sDemnmont4aexrxfciadfaDr uvo s t2xmio io4lp   ict (f 2tr(rpou4oeenii3iat a2um(mp;(0 reoxf3ty1oa rai s t0 2xmxm ny1ape  nci sfs2rmxmpno0aet mfeildlaDrmn pnt) rerxf io1fa ran s (0trxoim iu1am emies t)s2rru  nt4oexomf3tldla2ulu o;(4texrio3totom  au s;t trtmiopio4amte ncias)arumxrpou0ope if3iatlaDrmnmp;u4alenifcoatfp  aueo 
\ No newline at end of file
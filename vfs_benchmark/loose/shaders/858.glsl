@@ -0,0 +1 @@
+n ol() eur(r no4lm nlnesls  Drrxmooo4tlen ieild s2rm( s;u)aetomf3to1op raiesls srurxrpoy4aptemnctl( srurumono0tlx  oetadla2eau ont4alenmo3oadlaDr i ils t2uoxr3ou4opteliei s  Dum(mpnt4aeeoiociyt s2uanms;u0 leoiocoytfmDraneo s)teuoim3ny1lmenmfet (f ruau pno1tpenmfcilslm ul(mp;(0tlxrmociydoat lues t)sexrxrpoudoltnlfetlsfarrmxm nt0altoio3ias a uluvo;u4alxoxo3iydlmDe uvs;( truoxm iudapt lfvtas)s2ur(  ;u0texomfciyd sDrlump;t) eerxfciy1fa   i ils)t2uoimpoo1alt livsl(  Drm(  nu4oet ii3tad sDrm( p (0tleoif iytomDe u s;()seum(r3iydlle mfvtas)srraxm no4texnmfciad m emnmpnu) rtoio3tytfmte nvolt0texrio oy1openmnvt t)sDur(m ou0optn ieiytfm2elump;t) lxnmf iotoaD  n o;s trur(opnu4opeelnctat)aDraxmoou1alt ifeiatfa ea(vp;t) rtrxf tadlpte n i;s0seuoir3iudopt  ncs (faDrrur ;t4altnif3iltfm2rl(vs;(4tlxomr io1oat  nes;()sexrir oydop elics s)s2uax poo0oeeo ieild sDum(vp;t0aleoiociydfpDelieo;( t2uo(m ny4oleelics (f rur(mooo1tpxnioetldfa2el( s t4trenmfcty1om elu o;()tetoir3oy4om e fvsl(fs2ururp;t1oeenmfetls a rln p;t0aexnxr oatla e ueo t  2xmxm3oy1amtemfetas)s2umump;o0apt  oeiatfsDumn s (4altnxfctadomDrliei;t trtrir iydam emivtl(  2taxmp;u4alxo o3iydls2rl(mo;t0arermo3iotlatr ueils)trur(m ny4am   ici (f rurx  ot0tpe iicilsfaDuanvs t)trermo3oytoa r nvs;t srurirpoo1om  mfvta(fs2ta(mpnt0tpxnmocilt m umuvonu)tlxnxfctotfaD anvi;(0 2xoimpiudomen ictas) Drm(m ot4optniiciltfm el(mpnt4 eeomf to1lpDe ueols)setmxm iy4lm nliciat)a2rmu oot1apxo fciyslaDem(mp;(4 ltrircoo1omDe ueil(0srxm(rpoodopeelfeta()aDraum nu1opxomoeiydfaDra( onu) exoxf3oa1faD auei ()trtmimpny1ap  mfvta() rtrxmpnu4tptnmi3tyt m umn pnu4areomo iy1lpD au i s0setoxo oodlpt lnvsat)s2trxm ou0aee mo3iysfaDrmnvp u0arxnio3todfmtr ieil(0s2xmxrpnodomt micslsfsrur(  nu1opxnifcildfsDra(vp u4trenmo3oy1fpt  n o s) exr(r3no1amtemies ( srrrurpou0apeo ictydfmDuauvs u4tlxoxfcia1lp e i ol(0 rumxo3nydllee iei t) Drru o;u0tpe  ocild m2ran p (4 lenmr oatopDr n o t0 2toim iu1omtnmfciat)arurxrpnt1aeeo f3ildlaDuauvs;t4areoifcoydomteln i;s0 rtoxrpny1lptnmnvi sfa2umuront0tpxomi3iysfa2ea( s u4 rtomo oa1oat luvo;s  etrxo3nu4amee fvil(f Duax oot0tet iiciytfs rmu p t0altoxfcoytomD lneol(0s2toxr3oo1optnlieias a2taur nu4oleoioeiysfa2um(mo t0 lxoxo iadopDraueol( sexmirpiy4lm e fcsat)aDtm(mo;t4aet mi3iadfm ranmo;u)alxomo ia1la elu ols0 rtm(m oy4lpt lneiat)s2umx o;t0olen i3iysla ua(vsnu4trtriocia1fm   neol() etr(rpny4lpt  icslt)arrr(rp;t1teenmiciys aDel(vp t4trtrxocto1fmt  ueol( teum(o iu4ape lfciat s2rr(rooo1alxoii3tltfmDrln o;t)alermf iydfptelivols0 rxmxm3oy4lpe liesltfarurxrpot1olxo i3iysfsDuanvp;u)arxnmo3tatlatelivo;t)setm(r no1lme micsl()a2uaxro;o0opxnifeiltla2umu s;u4aleoifctytoa elivo t0 2toxo io4apt mnetls)aDtmxmpot1texnii3tasfm2ua( pn(0trtrxf3to1optrauvi s)trxrio3iodomenmicsasfsDtr(  ou4apx  f3iydlm em( s;t4 leoxrcoy1omtrluvi;() rur(m iu1aleemnvsa() 2ur(r ;o0alxnif3tatfaDrmums u4tlxoxfctotoatr nvols  2tmio nu4lm nmici t) Drau  no4olenmoeiadlm2umuvs;u0alxoir3oy1fmD lnvs ()srumiopoydoptnmnvt tfsrtrxr ou0texoifciadfm2uanvs;t4alxomocoy1op   u o s0tetm(rpoo4lpe  fvsl()aDta(rooo4teen ieiydfm ua(mo () leoir3oatlatrlies;s s2tmxmpoodlpe mnvsl( a2umu  ;o1texo ieiltls ulu ont)texnxf to1om raues s)t2tmio no1am e nvs ( aDra(  ;t4olxniieiasfa uan s t4tltoif iadop eauvo s) 2um(m3nu1llenlics t) rraumont4tlen oetyt mDran ont4 etnmrcio1opDe ies s0sexoxo no1amee fvia(faDrmumonu4aeeo ociat a ulu s t0treomf3oytfpDrai ils0teumxm oodol nliet t)srum( pou1opeoio3tasla2rmnmonu)aexoir oo1fm rluvi s0 eto(o no1lmtnlicils)sDraxmpno1ale  octls s2uau o;(4 exnif todoaDraues s0trxmio iy4olt  fvilsfaDrax pou0aex  ieiysfm umumpnu0 reoxf3ty1fp e uvolt) eumxo oy1am  lfvi s  rumx  ot0aee  ociys a2ean p;u)alxrmo oodoat lueil( t2to(opiydlle mncslt artaur ;t0tlt ifetytlm rmu p (0aeeoif3iydoptr n s;t)srxr(r3oydalenlneia( s2rrum ;o0tex iociydfs emuvo (0 exnxr3tadfa  aieils t2tmxmpno1aptelneslt  Duaum nt1aleoifeiatls2ra(vo t4texnmf3oy1oatelnvo s  rur(opnudllenlfei ( sDraur ;t1aexomi3iadlsDea(vp;u4 lxoxf iatfmte uvo;s trto(rpnu1ole mici tf rrmum nt4ale  ieiatfaDulnvo t4 rxrxrciy1fmD luvslt srurxo3io4apt lncslsfaDra(m ou4tpxoioetlslm2ulnmsnt0teeomocoytfptr ivilt0truo(mpny1alt mfvs (  rua( o;o4teeniietysla uauvo u0tleomo oodopDe uvolt0teuoir3ou4lmtemnetl()sDrr(ro;t1tlxo oeiadfm2uauvsnt0arxnxr3oytopD luei t)trxmirpio4aleelnvtl( sDrmu  nt1alxnio3ilsfm um( pnu)teeniocoydoaDraiei (0trur(o3ny1alenmivtltfa2umuront1tptn f3tltfa2elumon(4alerircoatlm  aivsls truoxr no4om n icia()srurxro;o4apxo ieiltfs ra(vp (4arxrxf3tydoa r nei;t)trtoir nu4omt mnvsa(f rtrxm ot1olenmfciysfa2ulnms u4aexrir to1fp elivs;s)tetm(o3io1ap  lfvsat)s2taxrooo4opxn fcilslm uan o;(0alxrif3oytfpDeanvslt0setmxrpnu1omtemivtltfs2tr(rpou4apt  feilt s ean o (4 etrmf3oodlpDe nei s)t2xr(opnudlm  lneia(fa2rmum ;t4tex mfeiydfm uauvsn(0 lxoio oy1om r u o s0s2xo(opiudll nlfvtlsf 2rax p;u0apto ocildfa2ea(vpn(4texoir3ootopDrlneo;s0tetrxrpoo4optnmictltfarrr( pno1opeo ieilsfaDra(vo (0 exnircoytlaDrai s t) eto(rpno1opeelfcilsf Dtrurono0tee  oeiytls rlu pnt0tleoxo3iadla  anvslt0setoiopoo4opt mfesa()s2tmxmoou4alxnmfcildfa rmuvp (4aetnmf iadfpD lueo;t) etr(r io1omeemnes () Duaur ou0aleoioetydls ulnmp u) ltoif oa1oaDe ueilt) rto(o oo4op emfvtltfs2rmuro;u4ale mo3iyd mDua(vp;(4aeenxfcootlaDr u o;s0s2xoiopnydlle  fct (  2trxrooo1olto oeiltls2umnvo;u)tetomr tytfmDrluvo;t)sexrxrpoudlpenmfei ()srtmx  oo1aptnif3iydlsDeanmo u0 eerir3oadoaD  nes;t  2umxr3iu4ope lfvsatfaDtrxm ou1alxo iciydlaDemuvo;(4areomfcia1lpte nvo;s s2ur(rpou1opeemneilt)a2trxm no0oet  oeils sDrm(vonu4aexrmf iadfate i ols sexmirpno4amtnlieia( srurumo;u0tlenmf3iad m eauvon() etoxf3ootfmt lues t  2xrir iu4aptnlfvtatfsDrr( ooo1tptn iciyt m ul(msn(4aleoif oodla e u s;t) etmxo iodopeelfctlt)arrru pnu1olxn f3ias m el( snu0tlxoio oo1lmD  ivo;s  eumxopny1aptemietasfsrrr(mooo0ale ifeiydfa2rm(msnu0alenmo3oytfatrli o;() 2umxmpno4lmt mfeslsf Drr(rpou1aptomoeiadfa em( o;u)aexrioctytfaDeanvolt t2toimpiy1am nmici (faDtaumpoo1tpx mf3tytfa2rluvsnt4tetrio3ootfmteaueo;s trtr(rpny4ale lnesa( s2trumono4texnmo3iad a2ra( s;t)arenmf ootlatr uvs;s0setrio3iydolen fctlt)aDurum ot0tpt  octydfa elumonu0tetrxocoytla elivo s teurim oy1lp  mfet ()a2ra(mp;u4oexnmi3tytfs2ulumsnu4tlxnmf3iadfpDe ivo;()t2tm(o iu4lpt livta(fartaxm ot0olxoii3iad s2rmnvp;u4trxrif3iydopDraneil(  2toim io1optn fvil()sDurxmp;t4ape  fciadfs2el(mo () rerif3ta1lmD  ies ()s2xmio3no1lptnmiet ()s2taxmp;o4ole  ieiasls uluvpn(4 leoxocoydlateaneils texoiopny4omtelicia( arra(  ot4open i3iyt s ea(vs t0texrir to1lp  lu i (  exmir3iudaptnmietatfsDrmuroot0opxn f3iasfmDrm(vsnt0 eerxfcootopDr ivolt)texoirpoo1am   nctatf Dtr(r no0opxnmfctldlaDulumo (4aeerif3tydomteluvi;s0sexmirpno4altn nvtlt srtmxm ou4aetn o3tldlsDemn o;u4altrxf3ty1lp r ueo;t0tetoir3iy1lltn fvslsfsrumu p;u0tpxn o3tls a rl( o;t)tltnxrctatom   iesl()seuoxm3ny1opeelietat) rrrumpnu1aexniociysfmDrauvpnu4tlerir totopD aiesls0seumio3no4ale mnvtlsfa2raum nu1oleomoctydlsDulnms;(0trtrmf3oadlm rli o;t0 2ur(r3oo4ll elnviat sDta(  ;t1aexo feiadfa2rl(vsnt4alerxf iatlpt liei t  2xo(r oodlme  iei s srrrxmp;t0tlxnmi3tys s rlu s;(0 etomo tatom elivsls) rtmxm3nudlptnmnct () rtm(mpou1tleoii3iat a el(mp t)artrif3to1oat aivi;t)trtr(m iy4omtn fes (fsDtr( o;t1optn ociysfm2emnvo;t4tetrmf oatoaDe ieil(  2uoxo iydap nliesat aDumxr ;t4tpeoifeiaslm2el(mo u0alxnmfcia1oatrlivs;(  rtrirpnydaltnliet ()sDtmur oo1tle moetyd m2uauvont4teerif3iadfpDr ues t0s2xoirpiu1llt  nesat a2ur(mp;t1tpxn feiysfa em( p;t4aeenmf ootop ranei;t0 rxoxo nudomen ict s aDrrurono1tex ioeilt mDrlums u0teeomf to1lmtr ivo ( trumxo ou4al  mnvtls)arrm(r ot1aeenio3iysfsDua( o;()tltomr oatfa  an il(0 rxoio3iudlmeemnetas)srtaxmpou4apxn f3ilsla rlu s;() eermf ta1fpte n s;(0s2um(r oydll nmfetat)a2umur ou1alxn o3tadfsDemnms;t0tltoif iadomD  n i ()teuoir3iydlmtnlfesat)sDtmxrono0oltnmo3tyt a2eau s u)aetrmr3iadoatelueo;s sexrxr3iudamt mnvi ()artr(mpno0aee ifctadfmDrm( p t4treomo todoatr uei;t0texrirpnu4ap emfvt tf rumum ;t0tee  icias s el(vp ()tlenirciytomDr nvols t2trio3iu1ll emivtat)sDtrxroou4altomieiadfaDua( pnu0tleomr totlate nes;s trtrxo3oy4am   ictatfsrtau poo1tetnif3ias a elnvp;u)trtnxo oo1fmD anvi;t)trtrxm3nodamen nvt s)sDra(m ;t1ope moeilt s rmnmp (0 rerxf3ootfp  aivi;(  rurimpiy1lp emnvtlsf rtmx pot4oltoifctadla um(vpnu4teeoxo3oatfmDelu ils) etoio oudopee ictlsfsDurx pno0apt mieiad mDra(vp () rtrmfcio1lmDeau ol(  2toxr oo4ll  mivslt)aDtaum ot4opx mf3iltla2elnvo;t4aetrxrcoy1fp r u o s s2xrxmpoudole  ncs t)arumxmp;u4apen octysfs uln o;(0arxrmf oodfp r n sls0 rur(mpnudlmtn neias sDtr(monu4olenmoetatfaDuan pnu4tlenmoctadlmteaivs;( teur(r3io4ope liesa(f rurur ot0texomoeiyt mDuan p;(4 lxnif oa1om   ivslt srtr(mpoo1ole mnvtls  Durx pnt1opt iocildfa2ra( s;u4texrxoctytop rlivsl() 2tmxm3nudoptn nctas aDumu  oo0opxnmfciyd aDum(ms;() lxrir oydlptrluvsls)sexm(r3oy1om  lfvs s)a2tr(rpnu0oetniictys a2em( o t)treomfcoo1fm r n olt)texm(m nodale  iet s s2urxrono4oltnmi3tysls rluvo u4 rtrif iy1lptrliei () 2trim3nu4ap  mncia(f Dum(mpnt4aexoiietad sDrmnmpnt)aleomf oytfm r uvs;() exmxr3nu1lptelietls)sDtax  oo1oexniictasla rlnmp;t4 rtnxrcoatlptrlues;s0srumxr3nudome liei ( s2rrxm ot0opt mictat s2ua(mpn()arxnmo3tadlm  anvsl() rxm(r io1ap n fct (fa2tm(m ;t0aex moetysla2umuvo (4texomoctotfmtrln ol(  exo(rpio1amtnmncils) rra(rono4tpxn f3tysla elnvs;()artoxo3ty1om  li s;s teuo(opio1olenlfcilsfsrrmxm ou4teen ictlt s rmu snu4 exoxf3ia1opteli ols)tetoxo3iydalenlieil(  2tr( pnt0oltn ieiyd s2emu onu0altnxr ta1opt auvo;t)teumxm3oodllen feslsf Drmxr oo0olenmfeiyd m rm(vs;t0teermf iatfpDelivs s) etoxo3ou1lpenliesatfsrrrumono1ape mo3taslaDeaump;u0tltoxf3oodlmt  u o t0 eurio3io4ol emncslt sDtm(m oo0alenmfctldfmDrm(vo;u0trtnxoctotoa r nes ( teum(r3ny4alte ivs s)aDtrx pno4aex if3iysla um(vs () ltnif totlmt lies (0 rxrxo3iy4am   nvs tf Duaxmpou4alx iieilslmDumn s (4 etnmfcootfpDelues;s) 2xrirpny1am   nes ( arrr(rp;t0aex  f3ilslm2umn pn(0alenxr3oy1fpDr nesl(0 2trxo3iu1ole  ivtatfaDtmurono4alx ifetldfm umnvpnt0arermf3iytfaD livo;s texmio io1ap n ivslt srra(rpnt4tet mfetas aDuaumsn(0 renio iatlpt  nvs s texrxm iudll  lncil(f Dua(rpot4olxomoetys mDrm( pnu4alenxr ia1oate neol(0srxmxr3nu1lm  liet (fsDtmu pnt1tlx iocild a em(mo;()tltnmo3tydlmt au s;(  2trim3nodap nmicslt) rua(ro;u0tpeniietadfa eauvpnu4texnif tadfa ran i s  2xr(r ou1amtelfci s)arur( oot1olx mf3iyslm em(vpnt)tlerir3tydop eanei;s0s2tmirpoy4amtnlnct ( aDumxrooo1ope mfctys s ua(mo;u) lxnif ootlaD luei;s  2toxm no4aptn fvsls  rur(rpoo0aeenmocilslm ul(monu0 ltomr3tytop  aueols0tetmimpnodal n ietat a2ta(  ;u1tlx ii3iyd a2eanvpnu0tlenxf oatlp e uvolt)t2tr(o3ny1oltemies ()a2rax  nu4tpeo feiatlsDra(vp;u)tlxoxf to1fptrlneolt) etrimpnu4op n fvi () 2uaxr oo0tlx ioeiadls2em( o;u0teenmf3oydfatean sl(0t2xrimpiu4amt lfctas)s2ta(  ou0altn i3iydlsDua(vs (0aeeoio iotfp r nvo;(  ruoiopnodom e fes ()s2tmu  ;o4oetomfeiydfsDrmumpnt0tleoxoctodomDe i s s)setoxr io1optnmnctl(farumxmont1oeen fctatfaDuau p;(4tlxnxr totfa e nvs t)sexr(r3ny1al  livil( aDtauront4alx ioctadfm raump;u0alxomocoo1lpDr nvi;(0sruoir no4ame  nvt ()srraur ou1tltoifctlt s ua( p;u) etrxo3iotfmt  i ilt)srxmxopny1ap  mfetls  rtrxmp;o4oltoio3tldfm eau onu4altrir iytfpt ln s t)srurirpoy1open iei s) 2umx oot1alt  ocild s umnmp ()arxrmociodopDran s s trurxr3oy1olen fct ()a2ua(root4oleoio3tas sDel(vs (4teerxo ta1fpD  ivi s)trurxr iodlmeelics (fsDuaxro;t4alx  ociyd m eluvs t)teeomfciadopteaues t0srurxmpnydoleemfviasfsDrrx poo0apt  f3iad s uaump;(4tetoxociatfpDe ieo;s) eto(o3oydop nlfeslt)srra(ro;t1tet mi3ilsla ulnms (4 rtnxo3oo1fp   u s;t0teurxrpoydal  mnvs ()srra( p;u4tpe mf3ilsls rl(mo ()artoxf3oy1fa  aueo ()sexr(m3iy4lm   net s)aDrru  ;o1ole micilsfmDumnvsnu0aetrif3tatfpD anvs;s sexmxopny4altn fct ()s2umurp;t1tpt iociat m2uan ont) rxoif todopt luei t0 2xmxmpou4lmenlivilt aDur( pou1oetomi3tlsfs ulnmsn()treoxf3iy1oa ranei (0s2uo(opoo4lp emfetatfs2umxm nt1aeto feiadfaDuan o;t4teeomr oo1om eanvs;(  2tm(rpiy4lp nmfcia(fartruro;o4tltnii3ias mDrmnvs u4trtoxo3ta1oa e ues t)t2tmir iydlle mnci s)sDra(mo;o4tltoio3iadfa ulnmo;u0trxnifcoo1fpt  nvolt)teto(m nu1ol   iet t sDta(  no0aeeo f3ilsls2ua(vont0arxomo oodom  lu i;s0sexoxrpou1lm n iei () rtr(mooo4oet mietysfmDel( s;t0artnir3tatoptrai s t)sexmxo3io1ameelnvia() rta(mo;u1tleoifeiat a2eanvo;t0 ltnio totlm e ies t)trxo(r3oy4ole  nctlsfartaumo;o1olxnmietydfs emuvo (4aexomr tatomteau olt  2umxrpnodop  lncsat arrr( oot4oeenmi3tldlmDul( s t)aetomo3io1lpD  uei () exm(m3oo4opeemiet t) 2uaxm ot1tleo i3tldfaDumu s u0alxrxo3oytfmDrai s t0s2umiopny4lp n ivt s  2ur(mp;u4tpxn iciad mDrlnmp u) etomr3to1fmDe ivol( srxo(r oy4lptelies (fsDraxr ot1aexnmfcias m em( pnu)aetoxf iydla  au s (0setr(m no1al e fetltfsrum(ro;t0opxnif3ild m2rl( s;() rxnxo iadfm rli i;t teumiopiu4lmtnmfvils aDrr(  no4apxnmf3iysls2uau p ()tlenxr oy1fp eli o t0 exrim3oo1lmtn nvi tfs2rmum nt4tetn o3ilt aDel(mpnu0tltoxocoatopDrlivo;(0 exrim nu1olt livt t  rta( poo1aex  o3iltlaDumump ()trerxf3to1lpDean s;s) 2xo(opnodom e icsl(f Dtm( pot4apt  f3tls a2rlu p u4texnxfcootomtr nes (  rum(r3ou1apt licsa( a2ta(  nu4alxomictatlaDua(vo u0 lenif3tatlaDeai s;(0trumio3iy1apeelietls)s2tm(r ot4opt  feildlsDeln snt0texnifcootomtr nes;()sexr(o ou4om elncslt)srtmumoot4tlt moetatfa ra(vont4tlxrxoctytlm ranei;t0srtr(r3oodap n fcsat) rtm(rpou1opxoif3tatfaDrmnvp (4aeeoif3oytfmt livo s  2umxr ny1amenmnvtasfaDumumoot4optoif3tad s2ea(msnt0alxrmo tatomDelnes s)sruo(mpiydam  liesl()s2raxm ot1aexoioetat a raums;u0 exniocoy1la eanei;s) rtoim oydam emfvils)a2tau ono1texomi3tadlaDranmp t4 exrmr iodfp r i olt)sexmim3oo1ape lfei s aDurump;u4ape  ietyslsDrmums;u4areomocoadfpteau s;(  rurxr iu1lm n ieil( aDraurono1tlen i3tad sDrau p (0aetoircoy1latelnvs () 2umio iu1ale  iesl() 2tmxrpnt4tle  octydfa elnvp;u) rtrmf oytlmte ieo t) 2trio ny1al nmnctasfaDua(mo;t0aetoif3ils aDra( p;t0tltnmo to1optrau o;t) 2trio3iu1lp nlfetat aDumxmooo0ape ifciysfs uan sn(0tetrxfciotoat  uvs t)srtm(m3no4altnlivsatfa2ur(monu1aet mietysla2eaums u4tltnir3iydoat  nvi;t0s2xrimpio4amt mnvtl(fa2rrur no1oeeomfetydlm2rlump t)altrmf oo1op elies t0sruoimpno4optn nei t s2ra(rpot4tet ifeilsfa2elu s u0aexrxocoodlmDrlies;s0 euoio3nu4om n ivtas) 2um(rpnt4opt miciasfs umn s t)aetnif3iotla r nvi s)t2urio iudopeemiei (  rtrxr nu0tee mfctlsla raump t4 renmf3todlpt  ieils0t2ur(o3oodomt mfeslt  rrm(m no0ope mi3iad a eln p u)arxoirctydlp   n i;(0 etoxo nu1olt  neias)artm(r oo0oex ifciaslmDuanms u4 exrmfcto1fat lnvs;t0tetoim oy4oltnlnetat aDtmuro;u1optniiciltls rlnvp;u)tltnxf3oy1op  ln o;(0t2um(o3iu1ll emfvtatf rurxroot4olt  feiys s uauvs t4 rtnir oytfa   iei t seum(m3ou4ame lies tfaDumu oou0apt ifeiasls el(vo;t4areoio3iy1lmtr uvo;t  2xm(r oudomte iei ( s2tmxm nt4tltomo3iysla umu snu4tlxoxf iydlmD li sls0 2uoxrpoudam n fvsasf rumxrpnt1oexo ieiyt a2umump t)aexrxrctytfptran s;t srurimpiu4ope lfvt s)s2tr(moou1tpx  ociyslm rmumont)trxoif tytfa rliei;(0t2trxo iu4amtelfctat)aruaxrono1tet  oetldfs eau p;t4tltnxo3ty1faD anvol( s2tr(mpno4am elfci (fa2rmur ot1oleoiociyt mDuan o ()aetnir3oadom rli i;t  2xmio oy4omeemfeslt) 2rmxr nt4oetnioctlt a2umnvonu4 lxnifcty1omDe u ol()trxmir3oo4lp elnvias arua(ront0alt mfciadfs emnms (4trxnxf tydlmt aueilt0s2umxm ny1ll e ietas) rtrx poo1oee ii3tat m2uan p;u4trtnxf oatlmD luvslt)srtrxm ny4ol nlfvtlt) 2trumo;t0teeoiiciyd s2rmump;(0trerir oatfat luvi;s0teto(m3oo4apt mici (faDtmurpnu0oetn fciysfmDrau o;t)trtoxocoa1opDraueols sexmir3ou1ape lfcslt)sDumuroot0opx ifctydlm eau sn() lxnir tytfmte ivilt0 rxr(o nodol  lnvtatfsDumxrpoo1opx mociytfs rl(ms t0tltnio3oodoptrlneilt0t2uoxo nu4lmtnlictl(  2ua(root4aeenmf3iatlmDeau s t0alxomf3tatoaDrlnvs t texoim3iy1om e ieslt aDtaxmpnt1tpxomi3tadlm2rauvsnt0 rtoxo3oa1om elies;s) rxoim3iudopt mfctlsf rtmumono0olt miciad sDrm(vsnu4teenxfcoadlpDe i olt)srxmxm3io1al  lfvsasfs2truroou1opxn oetasfmDea(vo t)teenxociy1lpteai o;( t2toir ou1lm emieilsfa2tmurp;u1tleniietadfm2umuvo t)trxnxfctydomt  neil(0t2xoxopiydapte iviatf rrrxmooo1aee  f3iadls eln o;t)aexrxo3oadoatrlneo s teto(rpou1om nmfctas)arrr(  ou1tltnmociysfm ulnvo ()trxnmo iy1fpt lueo;()trtrimpnydap emncilt)arum(rp;t4aptn ieiltfa el(vs u0aeermf3ootlmDeln s s) 2xr(r io1ap  mfvt (fs2trum no1openmfeiys a2rmnvpnt) lerio oatlpt  nvol() rxmxm ny4apt  fei tfsDumu oot0openmfciadfm ra(mp (0tetrxf3tadfa  auvi;s s2uo(mpno4lmenlfvsls arta(rp;t4opxn fciadfa2rl(mo (4tltoio3iy1omteaueo;() rxrim iu4aleemfei s aDrrurono1tee  fctltls2rl(ms t)texrio3tytfp  an o t sexoir3iydop e nctl()a2taxrp;t4olx iiciysfaDem(vo;(0alxnxrctodla r ieo;s0setmxm iu1ol  lfes tfaDtr(m ou0texomfctldfmDrl(vp;t0tltrmf3totlm raiesls)trtriopoy4lmeemfcs tfsDrm( oou1alenmietydla uau o (0altoxo io1lpD  u s s0 rtr(m3nudll elneiatfs2ur(  ;o4aex ioctydfaDua(vp (4trxoif3ia1opD au i;( s2umirpoy1lpen ivil()sDtax pnt0tltn ieiatfa rlu on(0 ltrmociy1op e n o;s seto(r3iu4ale mnetls) rrmu  nu1alt mo3ild s2elu s t0tlxnmf3oa1lpte ivs;t texrim iodllt  ictat) 2urur ot0alxoiocildlmDean s;u4tltrxo3oy1lptrlivs s0 2xoio3oy4altnmfvt s)s2rrxrpot0tpen f3iyt m rm(msn(4trtnxocoadlp rlieols  2xoxm io4ape  fvi ()s2rrurpnt1tet iociyd sDua( s;u4aetrio tatlaDr n s t s2xoxo3oodop  mnci s)srtrxront1alxn ictad aDem(ms u0aetnmf3iotla eaieo s  eurio3nodap n ncsasf rrrurpnu4tex  f3tas sDrlu s ()trxoxo3ty1lpteau il( teto(rpio4ope mncias) 2tm(m ou0texn f3iydfm ua(vp;() rxnxfciydlpDeln o (0texoio3iy1lm n nviat s2raurpnt0aeenmiciatfsDuau ont4trxrio oodfpt li i (  rtmxr no4ap  mietlt aDumxmo;o4tltnmo3iat s umnmsnt)texoxr oy1op  ln s;s0trxo(m oudlpt mfvtat)sDrrxr ;o4optoifeiltls emump;(4 exrif3tytfpt  ueo;t0t2xrimpiudomt lfes tfsrumxr ot1tleniocias aDrau s;t0alxrir tytlmteaivi;s)setoim iodaltemnvi sf rtmum no4tle ioeiysls ua( snt4 ltrmociatlmDeanes (  rxrxr3iodop emiei s)a2ur(r ;t4alt  ieiltlaDumnvo (0tlenmfctydfm  auvo t0teurir nu4olen ncslsfsrrrx pnu4alt ifciyt s rmnvs;t4trtomo3iydfm   uvs;t0trtrxm3ny4ameelieiatfs2umx pou0tptnmfetytfs rlnvo;t)tltrmocto1fmte neols0 eum(o3ny1ome lnvsat)aDtax p;t1optomfetydfm2ul( s;u4trxrmf ta1fmDeaivslt0seuoxr3oudomee nvs s)sDrm( pnt4texnioeiatls2umums;t0 lerio ty1lateau ils0 2umim io4apenmnetlsfsrrrx pnt4oexn f3ilsfa2uln s ()tltrif3to1fateai o t teurxr io1olte nci tfsrua(  ;u0alxo feiltfm emumsn(4 eenxo3oydlat  u ilt0srxoim nu1apeelnvtatfs2raxro;u4tetn feiadfs2ua( p u)texoxf oytfmD  neo s teum(r3iy1opte fvtl()srrm(r ou1aee  iciytfs2eln o;t4 eeomf3oatfa r n i s srtm(r3nodolenlieiatf rurum ou0alt mfeils m2eaump;t0trxoio iatlatrau i t)trxo(opnu4llte fei (  Dumum no4alxnmoeiaslm emu o;(4alenmrcty1faDr n s s sexo(o no1op elnvtatf rur(rpou1tpxniociydfs rluvs;t0alxnxrctotlaDr n i;s0 etmxopiy1am elivsas sDtmxmpnu0oeto icilsfa eanms u)tlxrif iodoaD lues t)s2tmimpny4amtnlfviatf 2taxro;o4altomfciat m2emumo;(0 rtnio3ty1fmteau ilt0sexmxr3oy4amtelnvsas)srrauroou1apxomo3tyt s2ra(msnu4altrxr io1lmDrlnvo;s) 2uoxm3no4llt  fetls) Dtm(mpou1texomieiad s umnvp ()arxrmr3iydlmD anei;t) eto(r3iodlpe  fvsls)arrm( pno0oex  o3iltlm2rmu on()aexnmr oa1opD au i;t  rxmxopoo1lmtn fes tfsDur( p;o1opeo octlsla elu sn(4tltnmr iotlaDrluvo s)t2umxmpou4omee ict (  2umur ou0texomoeiyt m eluvs;t0tlxrif tytfmtr ies;t t2xrxrpnu4lm e ieia(fartax  ou0ope  oeild a2ranvsnt4 renxrcoodomDelu ol(  rxoim3oo4op e fcilt)srtmu ooo1aptnmoeiaslm2el(vp ()teerxf3tatoptr i i;t  eurim iudopenmfvt tfs2ua(r nt4alxo fctas a ean pn()alxoir iadfptranei s)t2xo(r nudap e fvtls a2trxr ou4tpe  ociaslsDem(von()artrmfcto1lm rau i;()t2xoxmpiydaleemieta()sDurxro;u0olen feilt a el( on(0 lerir iy1laDe uvs (0 etrio3ou1ll  mfvi (fs2ta(ro;u4apen i3iysfm ea( s;u4trerxrcta1faDrlnvol(0t2um(r ou4ome licta(fsDtru  oo4oltomociad aDulnmo;t4 lxnxo ta1oa e ueo t)setoxopou1ole lfetl( sDrrumont4aetniieias sDeanvo;()trtrxo3iodoat lnvsl( sexmxo3oo4lm  mieiat) Drrur ;t0olxo octydfm2ul(mo;t0tltrioctodfa rlu i t)s2urxrpoo4am nlfct t arrmurooo1aeeo ieilsfaDrmnvp (4alxrmo oytlpDelu o s0s2xmio oydoltnlfvs ()aDua(mpoo0oet mfcildfmDuaumo u0texnmocia1fpD lueols tetoim nu1al nlfes sfaDumxmooo4aptoifetydlaDran snu4arenmr oo1latrluvi t0 2tmxr3io4omeemnvia(fsDtaxr ot4ape  iciad m uan p;u4trtnircoytfmDeaivo t) 2xmir oydole  ivi tf rta( o;t1tleoifetadlaDul(vs t4altomoctotfpDeaieolt)teumim3ou1optnlnetl(  Dumxm nu4apeomociytfaDumnms;(0trtomrctotomD au i t s2uoio3oodlmeelfvil(faDurxmooo0optnmo3ildfm2rl(vs t4tlxoxo3iatopD luvi t) 2tm(rpiu4openmici s) rraump;t1olxnioctadfa2rlnms t4arermf3oo1op rli i;s  2toxrpio1om emnviltfaDrrumono0olenioetat sDrauvo;()tltoir iodoaDraues s0srxo(r3nu4lmt lietltfsrrrxmono0oet mf3iad a ua(mp;(4trtnmo ia1fat lueols  2xm(m3iudlmtnmnvs (fsDrrurooo1oee  o3iat a2elump u) rxrmfciytomt li ols)seuoimpnu1lpte nvtat) rtmu p;u4tptnii3iasfs eau snt0artrxocoadfaD  iei;t)sexoxo iy4am n ncs t)s2ua(mpoo0oetnioeiasls2em(mon(4 lxrif ia1om raivolt  etmxrpoy1al e icils) rurump;o4tpeomictls a2rl(mo ()altrxr oadfpt aueo t)s2xmir3ny4olee fvsas  2umump;o4aleo f3ilsfa2rluvo;(4tltoxo tytopDranvsls  2to(o3iy1lp nlnvs s arurxrooo4ole  o3tltfm emn p t)aetoircta1lm  ai s t0t2xo(mpiu1llee fetl( a2tr(mp;u0aptn ieildls rau p;u4tltnmf3iy1fmD ai i;t  exr(rpiu1ap n ncs s)a2rru p;u1texo f3iydlaDrmn s t0 lerxr iatlpte n s;s)seur(m oudoleelfviatfaruaxr no1oee  o3iyslaDeanmo t4texrmf3ia1omD auvo t0teurxr3iy1ope lics tfaDurx pou4olx  fciyt a2ua(monu0tlermr3iydoate u ilt srxmxm3oy4lp n net (faDtru p;t4tltomfeiatfs rl(vsnt4 etnirciatom   nvo;t t2xo(o oy4op emfvtls  2umum nu4ape ii3iys m2rln o;u)tltnxf3oa1fmte ues;s s2tmxrpou1llt lneiasfarrr(rpno0teto f3iatfa rln pnu0tltnmrciadlmteau o t t2xrxrpoy4lpen nvslsfsrurx ono1tlt mi3iydlaDuan o t4 lenif iatfat lies (0t2ur(m3oo4aptemfviat)a2umu  ;o0tlenii3ils m el(vp (4alxnio3oadfm   neolt)seuriopny4om  micta() 2rmx ooo4oeto i3iadfs2ra(mont4aetomo iatfat lneol( t2xoimpoo4omtnmfct ()artru pnu4aptnmo3tatfaDeaump;u)arxrxf3oatoa  auvo;s0 exoim iudol  mivt t arraurpnt1aptoif3ils m2eauvpn(4trxoir oadomtelivi;t  exmxrpoudap nlnes ()s2umu  oo1opxnmfcild sDulnms t0teenmo3oydfat livils0srum(o3iu4am nlictat aDtaxmpou4opxnifctatls2ea( s u0 leoio3iatfmt  nes;( truo(o3nu4amtemnvta( a2ur( pnu4tle  oetytfm2emu p ()trxoio iatlmtrau olt0 2to(o ny4ame mnesatfaDtrxronu0olen fcildlmDelu on()artoio3tadopt  u il( setrim3oy4optnlnvs ( arurxmo;o0opxn icilt m rl( s;u)trerxocoydomDeau sls0t2tm(opoy1ole lict (f 2rmx oot4tpe mi3iyd sDeauvs;u0aeerio tadfpDe n s s)sruoir nu1ol nmnvsl(f Draxmpou4tet moctltfm ua(vs t)alxoxfciydfpD ln o;()s2urim ou4lpeelnct t sDum(  ot0aeenmfciltlm el(vp;u) ltrxfcty1lptrlies s0trxmim3iy4apte ivslsfaDumu p;t4apeomo3ias s uaumo u0 rxrir3oo1lpDean i ( teuoxm3oodlmtnlfvsa() rum(rpno0aexnio3ildfaDumuvs;t) etrircoadlmDr nes ( t2to(o3ou1ll  mncil(fs2uau  nt1aee ifetad mDumump;t4tlxoxo3oy1laD anvo s s2xmim3ou4lptnlieiatfs2umu o;t4olt iociltfmDuau s t0 ltomo3tydlptrlu slt0t2tmio nudlmeeliesat)arrrx o;u0tlxomi3iadfaDrlnms t0arerif iadopte u s;s0t2urim3oy1om nlfct s  Drru o;u4tltn ieiltlaDuluvsnt) eerxr3ty1oa   ivo;t t2trirpnydlm emiesa(fa2um(m oo0olxomfcias a em(vo;t)aexnir3to1laDelnvils trumio oy4ll elnvilt)a2urur ;t0ale  fciasfs2ean pnu4aetrmoctydomDr neols0s2uoiopio1ap n ivi t)sDrr(mp;u0aleo icild s2umu p t0 ltomf3oydfm rlu i s  2xmir nudll  mivsat) Dtmu  ;t1optnmi3tytlaDeauvo;u)trxomrctydom  aneol( seurxr iudamt micsl( s2tmu pnt0olen ieiyt aDemuvonu0 rtoio iatomDelivslt)srtm(r ny1oltelnvta(farra( oou0olt  icias m2ran p;()aeermf ta1lptr n o;t srxoxopoodomtemivsls sDuax ono0optn i3iyt s rlump;t0 etrir iy1fa rauvs (0 exm(opoydllen ivsls) 2tr(  ;u4oleomieiatfsDranmon(4 exoif iy1fatelieo;s0teur(mpny1lme  ici tfs2trumpoo1aetoioetltfs2umuvo;()alxnifcoytfa rluvsls0 euoimpnu1apee fcil(f rrr(mpoo0oeeo i3iyd aDuanvs (0trtomo3io1fmDr nvs;s s2urxopnudlleelfvi t)arur(mpoo1tlxnmo3iadfm eanmpn(4 rxnir3iytfpD luvils0trtmxopnudlptnmnetasfaDrrxrpoo1oltomociys mDuluvs;u4tetrmr todlptrauvi t0srtm(opoydamtnmnct t)a2rmx ont1apxoio3tytfm rmnmsn(4arxoir ootla  liei t)trxoxo nydamt  nvia(fs2urxrpnt0oee  ieiyt s2umnvsn(0tltrxr oatlmtrli o s0 2to(m3nudoltemietls)s2rm(mpnu0oet if3ild m2eln s () rtnif3iodfpDraueo s s2umir iu1om  lnvtasf Durxr nu0openmfctatfm2eau sn(4trtnmf oadoat lieo () 2tmirpoy4lpe lnvtatfaDrrx o;t1tpxo i3tat sDemu p;()aeermo iotop r ieol(  etoirpiudomt lfctl(fsrtmx pnt0ale  oetas s rau p;t4tetrioctotfat  ieo;( s2xoxm ny1ol   fetls) Durxr ;u1optoiictysfaDelump;t)teeniociotfaDr iei t  rxr(o oudll elivtlsfaDtaum oo4optnmo3iatfsDelu o;(4tleoxo ootlmD li i;s0trtmxr iy4openmnei t) 2ta( onu0tptn oetadfm emumsnu0 exoxo iadlptelnvsl(0sexrxr3iudom e nei tf 2rrx ooo0alt  oeilslmDra(mont) renirciydomD ai i;( s2umxr nodopen ncs s a2rmu  no1opeomfciysfa rmn o;u0artrxfciydfm rauvo;()t2trxr oy1lpte nesl( srua(mp;o1oet iieiasfa rmnmon(0 rxnircta1oatr ueils teuoxrpoudaltnlfcslsfartr( pot4altnifciadfm ul( s t)tlxomr ty1op e nes;t seuo(rpiu4amt mivta(  rtaurpoo1oexo o3iyslmDrl( pnu4 etrxfctadomD lueols) etmir3nudomeelieiasf rtrum ot1olenioctasfmDranvpnu4tlxomf iadlpDe ieo t0 rtrimpnu4omtn ieiltf rrrxr ot1aexomi3ilsla ea(mon() rtnmf iotomt au i;s  2um(opnodal nlietatfs2rrxrpoo0tpeoiietldls2ulu on() exomfciatlmt au o s0s2uoim oodoptemnesa()arum( oou4aeeo o3iaslm2elnvp (0teeniocootfpD li ols srto(mpoydll n iesatfarurx  nt1olen o3iltfm2ra(vo;u)teermr3io1op   i s;t setm(r3nudaltnlivsat arrmxm ;t0oetn i3ildlm ulnvs t4 ltoirciydfate nvol( s2trim no4op  mnvi t) 2uax o;o0tpenifciadls eauvpnt4teenifcoy1omte nvs t)srumxmpnudlltnmfvslsfartmum ;t0oex  fetytla2rm(vp u4trerifcoy1lmtrln il(0trxr(r3ny4ape lfvt ()arur( o;t4tpeoifeias a2rln s t0artrxfctotop e u slt0 eum(rpoo1omee ivta( s2rru ono1olxnmi3tls sDrmnvonu0 eeoir oo1om  livi t  2umxo oy1alenliet s) Drru p;u4opt iociad mDrlu ont4aeeomf tytlpDr n s t s2toio3iu4ole lfvia() 2rru pou4ape mf3tyt sDranvont4 rxnmfciatlm eau sl(  rur(m3iydlpen nctat)sDtmx  ou4alxo ieildls rlnms;(4trenmfciodlmt aueo;t0texoxo3oodomt lfcs sfarrmumo;o4olxomf3iyd a rm( o;u)trxoio3iydlm e uei;s srxoxm iu4lmtelnei (f Draxr ;t1oexo oeiyd aDra(ms (0tlxrmf3ty1fpDeau i;() etoio oy4alenmiesl(faDtax oot4tlxn oeilsls2rln s t)trtnif oydfm  lu o;t)trxoxrpno4lm  lneilt aDumur no1tpto feiyt a2elnmo ()tlxnifciytfp rlnvil(0setr(mpou1amtn icsl( s2trumoot1ole iiciad a2ran snt4 renmo todfmt ai i s0trtm(r3iy4omte ivi s)srrmuronu1aex  fctyt aDua( ont0 renmr io1fpDr uvs;( srxoxr no1omtemnvia()aDtmuro;u4oexomoeilsls elnvo;t4teeomfcoo1lp   nvs ( t2xo(o nu1lltn nvsasf 2raxr nu0oex  f3tld a2umuvpnu0artrxfcoa1fat  nvi s teur(rpio4lm nmnci (farurxrpnt4tpenif3ilslmDran o ()tltoiocoatlateau s s0texoiopoo4open feias)s2taxrp;t1tlxomfciydlsDum( onu4 ltrio ty1fat luvi;s0trxo(mpoo4ap e ieslsfaDta(r ot4alt  fcild a ua( s;()tetrmo totlmt li o t  etr(o iu1amtelnei () Dua(m ;t1tex micildfa2rl(vpnu4tltnxfciatop elnvs;s srurimpiy1ale  ivil(fartmx o;t1texoifeiltlaDranvsnu4tlxomo io1fm elnes t) etrio iy4al  livilsfsDtr(r ;t0aleo f3iytfm ra(vp;()aexomf oy1lmte uvsl()setm(rpnydolenliesatfartax  ot1aexomf3tyt mDemumsn(0 lenio to1fpt lnei;s  rtoxmpno1om n fvtl()sDrmx pot1aee ifctld m2eanvp;(4tlenirciatfaDe n i s0 2uoio3nudlm nmfeias)arrm(mooo0tlxo fciat m uluvs;t0aexrxf3ty1fp eli sls texmim nudopee fes ()aDta(ro;t0oleo icils a ua(vpn(0 ltniocty1laDrlnvil( srtoim3nu1amtnlivi ( sDrm(mpnt0oexoifeiytlmDrau p;t0trtoxr3oy1fat lnei;t  2tm(mpiu1lpeelfet tfaDrrxmonu0oltoii3iltlsDulumo;(4altnmrcta1fp e ivol(  rum(r3nudame mnviltfsrrr(mo;t0ole mieiatfm2ranmpn(0texoir3iotfmtraivs;t t2umxo3ou4apeelivi t)a2rmum ;u0olx mfeils s2uauvs;t0teenmo ia1fpDr u ils)t2xr(rpiudoptn nvi sfsDtr(r oo1tlenmietls a2ean s;(0 rxoxrcia1lpte n ilt srxrir3nu1omenmnvsa( a2raxm ou1apxomfeilt a rmumo;t) eenmrciodfa  lneo (0tetmir iy4lptn icsasfs2rrx  ;t1tleo icilslsDeln p;()trtnio3tatfmteaivs;s0texmiopoo4omtnmivia(fartrur ;u4tlto feilsla2el(vpnt4tleoio3ootfmDr i o;s trxmir iu1llt  fvt tfs2um(  ou4texoifeiytlm2ulu p t0texoxo ootfa e i o;s0setoim3ou4omte iesa( srtmx  ;u0aleo oeiyd s uluvon(0aeenifcoydlpDr neil(0 2xrxo3iu1oltelnviat)aDtaumpnu0apenmoctatfsDraumo t4 reomrcoodomt  i sls s2tr(opnu1amtnlnvt sfaDrr(r oo0oetnmiciys a2rmuvs t4 rxomr3tytoaDr n i ()trtrimpoo1openmnvt sfs2ua(mooo0tpx ioctatlm2umu o t0tltnio iodlp rln o t)setmim nu1ll e iesl(f Draumoot0aetnmoctatfmDel( s;t) exnir iadlmD anei;()texo(rpiy4ame  ietltf 2raxmp;t1aeen o3tls s2el(vp;(4aetnxf tytlp   n ol()srumirpno1apt  iet ( sDtaurp;t0ope mictld a2um(ms (0 rxoxo iy1fpt  nvils0 rxo(r3oydoltnlfvils)sDurump;u1apeoif3tyt a2emnvp t) reoxocoydlpD livsl()t2uoir3iu1lmtelieia()sDtm(  ;t4tpxo i3tlsfm umuvs;t0aeeoxfciatfa rai ils  ruoxr3oydlpe  fci s s2taxmoot0opt iieildlmDeanmsnu4tlxnio3iydoa   ues s) exm(m nu1altemnei ()sDtm(m oo0aeeoii3iaslaDemuvo;(0 etomr3oadfpte ivi;t t2toxo io4llte fctls  Dum(moou1oeeomfeiys aDua(msnu4arxnirciadlaD auesl(0trumimpiu1alen ietls)srumx p;o0aexomiciytla2rl(vo u0tetoir3tydfa r iesl(  eurim3nu4llt  icsat sDuax pnu0opx mi3iyd mDuln s (4alxnxr3iatfpD  ieo s trxmir nydamt  fesa( arum(r ot1opxnmf3iydfaDranmo t0 eenif3todlptelneo;(  ruoxopiodopt mnvsatfa2urx pou4tptnmo3tld mDrm(mpnu4artrmo3to1fp eai o;t s2xrxo nu4lpeelfciatfa2rau pno1tlt mictltfs emu p;t4arxoxo oytoaDr n o;(0 2tm(m3nu4apt micsls a2umxrp;t4teeomf3tydla eau pnu4teeomrcootfmt liei ()seurxo iydlm  mici tf rtr(mpou0ape mociasfaDumnmpnt4arenxo3ty1lpD livo;t truoir oodaltnlncilt s2ta(mpnt0alto ictldla raump t4 eeoxocoytfp r ivilt0 eto(o3iudlptemnes t)a2uau  ;u0tetomicils a2umuvonu0 renmoctydlpD ai il(0srxrxr iodape mnesas  rumum ou4apx mo3tydfm2umu p t0 exnxo3todlmDe ues (0trxm(m no1olen nvsasfaDrrumpou1aexn oeias m2rmn p;(0arenif3oydlaDr nvi t0sexoiopiu4opte icias sDtrum ;t1tltn o3tlslm2rlums u) rtoiocia1lp r uvs;t  2tm(m oodalt lnviatfsDurx oot1tpe io3tlt m eauvonu4 exnmr3oadlm  aneil(0srtmio ny4ape lnvt ( aDrrurpou4oexniieiytfsDua(vp u4trtrxf3iytlptrlu o s  rxrxmpnu1ole mnetat s2um(rpoo0texo ieilt aDrln p u0 lenmf3io1opDraieo;t)t2umxo3iodllen nes s)sDtmur ;t1teen fctys mDelu sn(4 exrir ta1lpDrau sl( s2to(o3ou4olen iet (fsDrmx  oo1aleo fcildfm umnms;u4altnxfcio1oaDe nvs;s t2toxrpny1oleelivi (fa2ta(  ;t4apxo fctydlm2um(msnu)aeeniocoydlatrlu i (0 euo(m iu1om  mics s srrm(mpnu4oexoif3ilt aDrau o;(0alxnmrcootoateanei t) etmxrpiy4ame  fci tfarum(  oo4tlt  f3ils a2rluvs;() rxnif iatlmDeaieo t0t2um(o iy4lp   fet (fsrua(rpno4tltnifeiytfa rmuvo t) rtoio oo1omD anvs s0truo(opiy4apt lncsat srtm(rp;t1tltomiciasfmDumuvp;t4 eeoxr3oodla raivols0sexmio3iu4lmt  fctas sDraur ;u4opeomoeilsfsDulumo;u4 rermo3iodlaDrlu o;( seuoim3no4omtnmfci ()s2tmx pnt4tlto oeiys aDeauvs;t) reoxfciydop r nei;t)seuo(mpio4ameemncslsf 2tm( p;o1opto ieiltla2rlnms t0 ltomrcia1oa   i i s)s2ur(mpno4lptelnet s)s2ua(mpot1apen ieias s2ranmp t0alxnirciatfatr uvs;s)teuoxo3oodomeemietl(  2tmxmo;u1olt  fciasfm emuvp;t4trxoif oatlpteli il(  2uoxm no4omtemictasfartrumpot0aetnio3ias s ea(mp (4texrmo tadfpD lies t) euoxrpio1amtnmnvt s) 2ta(root1tpx  ietadlm um(monu4 etnmo3iydoatelu s t0s2tr(o oy1lltn netl( sDrmx o;o0oltnmieiltfm uanvo;(0alenif3iatop  aiei;s0t2uo(r no1opt  netl() Drauroot4alxomociadfa elnmo;u0 rxnmo iodoa e iei;(0s2xo(o nu4lpe  fcs sf 2tm(ro;o0apt mfeild a2rmump;t4alerir iatom   neol(0tetmxo3nodap  lnesl(  rumxmono1tlx mi3tldls2rm(vsnt0aetnmrcoa1fmDe nvo;t0sruoxopiy4lptnlivils)aDurur ot4texo fctyd a2rmnvsn() exrmocia1lm eanei (0trtoim nydamt lfcils  Dtau pot1oltomieiysfa ean p;u) exnmfcty1oat au o (0srtmir ou4opt mneil()arur(r ;u1ole mfetaslm2rm( pnu0 lxrifcty1omt  n i;()s2xoimpiydol nmfet t)a2ta( o;u4tpx mi3iatfaDelumo;t0teeoir iatlmteanvslt s2tm(r no4apen fvi t  2urxm nu0tlt ioeiysfa2el( p ()trxrxo3tatfatr ieilt0srxmio3nu4op nlicsat)srtmurp;u4tpenmf3iltfsDuau onu)arermf oa1latelnvils)teuoxo nudam nmivsls aDrmu poo1altniocilslm2emnvs;(4tlxoxr iodlmtrlueils0trurirpou4amtemiet (  Duaurpnu1oet mfeiys sDumumsnt0teeoxfciy1lmDraueo;t  eumiopiy1lmt  nct t  rrmur ;t0olenmoeiadfa2rmnmpn() reoif3ootoaDe uvsls0teum(r oy4ap elivslsf rrax ont4tlxn fctatfsDrauvon(4tetrmfcoytlmDeaivils)t2xmxr oo4al  mfct (  2ururpoo0ape miciatlaDel( snt0 eermf oo1fpteanvilt)seum(r3oy4apeemfet (farrru p;t4tex mi3iasfaDeanmo;t0trenxf3iadoa r i o s  exmxr3iu1omtemiesl( srrmum no4olxnmfeilslm2rm(vp t0tltnir iy1laDe uvs t0 etoir3iu4om nlnvt s a2umxrooo0aet mo3iltlm rmu p;()tltrmrcootfa   i s;()srtr(opoydaptelivsas)arururpnt1oex ifetysfm2umump u0trtomf3tytla  luvo;t0s2uoxr3nydamt lici s)s2rauro;t1altniietltlm2rauvs u4 rtoio3tatlaD  n s;s0 eumir3iy4ole mnct t)sDua(  ;u0oee micildfa rm( o t0aeeniociodoa   nes;s0 eumxr3oodlmenmivsls)sDrr(rpnu0aeen f3iltlm rln onu4artrif iadlptrlu i t)srtrio3io4lp nmfesas  2ra(rono1tptn f3iyd m2el(vp t)areomo3to1fmt aivol(0 2urio3iu4lltnmfviat s2rru ooo0aet if3tat a2rln s t0altnir oodlmt ai sls tetoiopoo4amtnmicsl( artrum ot1oeen o3iatfs elnvo;(4aeeniocoodlm raivs s  rumxr ny1optnlnesls)srtaxr ot1oexomfeils aDuauvo t)aeenmo3tydlatrlieo t0setmxmpoy1oltelncs ()a2tr(mont0alx ifctytls ea( s (4tlxnxrciytlpDrluei t s2to(m oy1lmt  fcsatfsDrmxronu1tlto iciysfsDelnvs;t4tlxrmfcoodfa rau o t0s2ur(r3iydoptnlfvt s aDtmumo;t1tpxnio3tydfm2uan p t0treoio3to1op r n olt t2to(mpnu1aleelfctas)aDrmumo;t4tpxnmoeild m2rau snu0arxnio3tatfat  i slt0t2xoxrpnu4op   ict t sDrm( oot1texnmoctyt aDem(mo u0aleoio ty1oaDeln s t0t2xoxm oy4ll e fvtas a2uau  ;o1tltnioctytfs2ean s;() lerifciytfp elnes ( tetmio ny1ll e ivi t a2tm(mp;t1opxo oeils s rmn o;t4 ltrxrciodlm   ivs;(0t2toxo3oy4lm n nes t)a2umumono4oexoif3iadfsDea( o;u4tlxoir3oa1lmDrlneils srxm(opou1ol emici (farumur oo0oeeomiciatfaDemumont0tltrif3ty1om elnvslt) rumxrpoudlpenmnct sf rurxmp;o0oltomi3iysls rmnms;t4alenir3iatopD  nvi;( trtmxrpny4lmeelnes (f 2rrurooo4aetomi3iltfaDrluvo (4texrxo oodfm  an il()sexmir nu4amte feil(fsDumuro;u0teeo octltfm2emu o u)alenif iadlmt lu o;s0t2umxr ou1om   fesltfa2ua(  ;u4ape io3iadla2emums (4treomf3iatoaD lu i;t)trur(o3nodopeemncsas arra(ro;u4tex iieiatfaDrm(vs u0 ltnio oytfmDeauvs;s)s2uo(mpiu1alenlietatfsrurxm ;o1alt mf3iat aDelnmp u0 lxrio ty1fptrau o;s)trurxo iydamt  fesl() ruaxroot1oet mi3iys sDean ont0aeenxf oa1lptr uvi (0srtr(r3oo4alenmfvil()s2ra(  ;t0aexnmi3ild mDulnvp;(4alxrxfcoadlatr u o;t0 2toxrpny1lltnlfctatf 2ua(rpoo0aexn feiatfa2eaump t4tlxoxf3ia1fmDr ueo s0s2umiopny4omtnlivsls)aDtm( p;o1tpxomi3ildlmDrlnvp;()aetoxocoa1lmDeluvol(0 rumxo3oudamtnmfetatf 2tmxront4ale  fctyd s ulu p;(4texnxr tydfpDr nei t trtm(o3ou4ol elietlsfarurum ot1texnmfeild a rlumpn(4 lxrmf3ia1fmte ueo t0s2xmxr3iu4oleemfvi (fa2rmx oot4opeomf3ilt sDelnms;u)aetrxf3iatoa rluvi t s2uo(rpiy1llen fvt () Dtm(r oo4tleniictlt mDel(vo;u0 rtrxrcta1faDrauei;s)trtmio3iu4lpeemnei s)aDrm(r ou1oetoioetysfm2umuvo t) reoxoctytlpteau s s)trum(r3nudole  icilsfs2ta(m ;u0altniieiltlm ua(ms u0 lxoiocoydop raies;( srtrim3nu1lm  liei ( aDtm(r nu0altniiciytfs rm(mo;t0arxnio3iydfmteli olt0teuriopnudap e fei ( a2uax  no0ale mfetltfm2emuvo;u)tetrmfciotom  ai s;(0t2xrim3oydoptemnviatf rurxront0ale ifctas sDrauvp () exrmf3oy1lpD lnei;(  2xr(rpnydaleemfviat)aDtrum ;u0oexnifctatfs2umnms t)artrmf iodfaDrlnvi (  etoxr oudlmteliviltfaDrmu  no0oexniieiat aDrlumo;u0 reomo iadom r ivs;t  rtoimpou4alenmiviltfartrxrpoo1tpt  o3tytls2ul( ont4treomrctadlmte u s s0teurxm ou1ol  lfei sf Dtrum nu0tetn feild m rm(vonu) exrir iotop e n i ( tetmxrpoy4lmt mici tf Dtrum ;u0oexn feiadls uluvsnu0trerifcootfm eaivols)t2xmxr3nu4aptnlnei ( sDta(rpoo4aee mi3tltlm2rm(ms (4tltrir ootomte nvi;(0sexrim3nu1ap  mnvia(fa2trx  ;u1opt ioetlt s2umnmo;(0 rxrxo3iotomt  uvi;t teumxrpno1opt  nvs sfa2rmur nt0ope moetadlsDul( on()aeenioctadom   n ils)trxm(m oodaptnlfet sf rtm(rono1aptomoctyslsDelu pn()alenir3todlp  li olt  exmio nudlmtnlfvias  Dra(r ou4teenifeilsfm2ea(ms (0areoxfcta1laDe i i (0setm(o oodlp  mivil(faDumx pot0aexoifetas sDemums (4 rerxocio1om  anvo t0t2xoxo3no4om elici tf Dtm(  no0oexoiiciyd mDelnvp;t) lenmo3iatlaDrluvi ( s2toim3ou1lltnmivt (fsrur(rp;t1tltn oeiytla ua( pn()texnio3tytfat  iei;t trum(m3iudomtemfvia()srrmu ono1teeomictysfsDel(vs;(0aexnxr iotlpDrlnesl( trxoxr ny4lleelnvi ( aruaur ;o4teen i3tatla uauvont0 ltoxo3iy1fmD  uvi (0t2xr(mpoodaltnlfct (fsrtaxmo;u0altnio3ildlsDrmnms;u4 etrxfcoytlaDrauvilt s2um(mpoo4opeeliviat s2rau  ;t4oeeo fctlsls uauvont)arermr iotlpD  neils)texrxr3no4omte nvsls sruaurooo0alto ieils s ul( o (4tlerxfctodom eaivo;t  rtoimpnydlptemnvi t) 2rrxmonu4optomfeild m elu sn(0altoif3ta1fmtranei;s texoxrpiodlpenmfcsatfs2rau pot0apxn icild s rln s;()trtoxr3iotfatr n s;s  rtr(r3ou4olt miviatfs2ua( onu1tpenmfeild m2ulums t0 lxoir tytomDraneilt)tetrxo iy1ap elnciatfsrur(  ;t1tltnmoeiydfsDelums;(0alenmrciadopD an o;s teumxopiudlptelfei sfarumu  oo0olen ictat aDem(vsnu) lxomo io1lptrlnvo (0tetmir nudlleemnciasf 2umu pnt1alxniociytla
\ No newline at end of file
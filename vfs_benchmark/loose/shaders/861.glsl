@@ -0,0 +1 @@
+ueils) 2toxmpnodll   feil(f Drrxr ou4aexomfeildfs2elump (4tleomr ty1fp e i sls)t2tmxr3iu1ap emictltf Dtru pno4tlt iieiytfs2uanvo;t0tlerifcto1fa r n s t s2xoxm3ny1om nlfvt () 2ta( ono0aexo i3tys m2ua( s;u0trxoio3oatfmtraneil()trto(o3oy4ole lfetat) ruaxmp;u0apxomo3iysla umn s;u0 leomo iatfpt an o t0trtr(m ny4apenlfcilsf rraum oo4olx mietasfm ua(vo;u)arxnxocia1laDr nvs s)setrio oodamtn fctltfa2tax ont4aptnif3tydfm2ulu p t)tetoxo tydfpteanes s)sexr(m oo1omenlivs s)s2raxr oo0tet  ieilsfm2umumsn()alenmf3tytfa   ieils0 rum(opio1lme lfcs tf rrr(m ou4aeenmicils s2ra(vont)treoio iadla  lnvo;t  2xm(mpnudalenmnctat) 2rmurpoo0aet ioeiadfs emu s;t4texomr oo1fmD an i s)teum(r3ny1ll nmfcils  Dra(  no1tlxniiciytfs2elnmsn(0tlenio3iytoatr uvils)seuo(o3io1olenlnetls) 2umur nu0apeomo3tyd aDeau p u) lenmocoo1faD  ues;t)s2trxo oo4op nmnvs (faDur(m nu4aetn o3iysfmDelnmo u) eeoxr oydfpD aivils sexmxr iy1lpte fcsl( aDur( ono4alxnioctyt s uau o;(0 etrir3to1oa   nvo t)seuoxopoy1lme  ivt ( arrmxm ot4tpto f3tytla2rmump;u0areoxfcootlmtr n s () rum(m iudlltnlnet () rraxmpnt4tlt iociydls2uaums u4tetnxr3tytlate ues ( t2xoim oo4altnlnvias artmx  ot0oeeomf3tyslsDuau o;t)aetomr3oodfaDe ivo;(0sexmirpnodaleemfvsa()sDra(mp;u1tpxo oeiadla2eaumonu)tetrmociotfm rai o s0teurirpiu4amtnmfci sfs2tmu  ;t1tlto feiadlm ulu o t4artomocootomD au ilt)setoxm io1omtnmivil(fs2uau  oo4tetomicils a2elnmonu4trxnxr iatlpDraivsl()sruoim3oudlp  lfctlt aDtr(rpnt1tet mfeiasla ua( p;(4teeomf ta1faD  i sls)srurio3iodolenliciltfs2rm(r ou1aex mfciysfa ulnmo () leoxf3tatfpDeaivo;( seurxo ou4olenmieta(fa2tmu o;u4tptnmociasfs ua(vsnu4aeeoxo oa1oa  an i;s0trtrxrpoydol   fci t a2tm(ronu1alen feiasfa uau s u)aleniociydomDr ivs;s t2xmxrpiudlme mfes tfsDrax  ou1oeeniicilt s ra(vp;u0trxrmfctydlmD lnvs (0 rtoxm ny1lmte neia(fsDraumont0opeo oeiyt aDrmumsnt0aetrmocoydfaDr nvs;s sexmiopno1op n ieta( s2tax  nu1tpe  f3tld a2emn o u4tleoio3iatomDe n s;t)trtoio3oo4olt  ietasfs2tmum ;t1opto oeiat s2umu snu)alxrircoa1laD lu sl(  rto(o3nu1llt  fet t) 2uaum ;o0tlx moetat m emn s ()tltomrcoodlatrln ol(  eum(mpoo4amtnmfet s  Duaum nu4aet  o3iyd a ranmo u0tltnircoydfm eluvilt0t2xrir3ny4lltnlfvil()sDuax  ;t4apto oeiatfm2uanvsn(0trenmo3iy1fm  lieol(0teurio3io1lp e ies s s2tm(mo;u4apx mfeiyd s emuvon()alxnxrciodfpD lues t truoxo oudomt  net sfsDua(r oo1aeen fciysfa2ea(vo;()alerxo3iy1fmDr ivo s  2tm(m3iu1op e fetlsf 2urx pnu0oet micils a emuvpnu)tetnmocoatfp r neo s tetrimpoodale mfctlt)srtaumo;t1tpe ifciltla2ea(vsn()aetrxr3io1la r uei s  2tmxo iodlltelivsltfarrmxrp;u1tet mictltfsDemnvo t)trtoxo3oytom   u i (0texrim iu4optelnetat)s2rru ono1opxn icilsla em(vp t)aexoircio1fpDr uvo t s2urir3io1ll e icsatfsrua(mpno0tetnmoetaslaDel(mo (0alxnir3ta1fate nesl(0setmxm3iu4lmtn nvtlt aDumxm ;u4oeenmiciys a umn pn()tlenxfcoydfa eanesls)t2ur(m oo1llenmnesl(faDrr(mooo1tlxnmociadlaDrlnmp t0arxrirciatfpteaiei;s0 rxmxrpio4lltnlnviatfa2uaum oo0olxo o3iydla2rmn sn(0artnmrctytoaD lneol() euoir3nodopt mnetlsf 2rmumoou4oet ifctyt s uluvo t) lenmf io1lpte i i ( srtmio3no4ame licta(fsDrmur ;o1apeomoeilsfm2rmnvo (0altoxo oytfpteai slt0s2xm(r3iy4lltnmnei sfartmuronu4tltoiociys aDeaump;()arerir3ty1fp eaivs s  2toim iy4amen icia(fartm(rp;t1aexn ociatfm2rm(monu4tltoxo tydfpt lneilt)tetr(o3oydlltemfcsat srtmum ou1aexnmi3iltla umuvs (4 rerxo to1lat  i i s) 2xmxo oydap elfet t)aDur( pnu4alxnifetasfs2rauvsn(0tetriocoytoa e ieo s)seum(mpnu4apte fcsas)s2raumont4tltnifciltfa emumo;t0 ltrir todfatraues;s)t2xrxm io4ap e fcsa(fs2trum nt0texo ociltfsDemumo t) ltnif iodopDrlnvolt)texrir3no4apee nesls srrrur ;t4apeomfeiytls2ra( o u0 rtrir3ia1op rauei s0 2toir ou4lpeemfciatf rrrur nu0tleoiictlt mDranms (0 exrif iytfp eanvs s)tetoxr3iy4ap nlfesas) rtmxro;t4apen o3iydfm ea( s;t4aexrxoctodlpt  ueo;( teumxm no1lm e fvta(fartax pou1apenifcildlaDrlnmpnu0trxrmo3tydla  ln s (0trtr(m oo4omenlivilt aDrmxronu1tetnmoetyd mDrm( s t4 eermfctytop r uvi;(0 exo(r oy1oltnlncs s  2tm(rp;o1apxo feiyt aDea(mpnu0tltoio ty1fmtrluvil( t2toio3iudole  feia( aDum(m ot0opt ioctytlm2ulump;u4arxomrcootopDraiei t t2xrxm iy4ole micil(f 2rr(rpnt4tex ioctatla uan ont0 eermr3tatop eai sl(0 rxrio oudom  mfvtat)aDtru  ou4aetnmietlsls2rl(vo;(0aleomr iydlptean o s0t2urxrpnu4lle mivtl( sDta(rpno4oet  ieiat sDul(vpn() lenio iodopte nvi;s  eurxr oydlp e ivs ()sDtr( ont4aexomieilt s2eau p;t)aetnmrcoadfa  lues t) 2xoiopiodopt  fes sf rtrxmooo1apt  o3iytfm2eauvs u4trxrxo3ta1lp ranesls trtmxm no1lp   ivias artr(  ;u1tpx  ieildla um(mp;()tlenxrcia1lpDe uvi t0t2tm(o oo1amenmfet t s2ururpnt4tle ifciyd s rl( pn(0 renmr ty1la elueols)srxoxr3iy1aleemnvta(fs2taxrp;o4oltn o3tldlm2rm( o t4 leoxr3iadfmDean o;(  rxmim oo1al nmfctlt  Dra(moot4altnmfetltla2em(vonu)aleoir3iytoa eau s ( teurxm no4olee iesat sDtmumonu0opxnmoeiaslsDrluvs t4alerio tytla elu ilt)s2toirpoy4lp nmict sf 2tr( poo4opxo ictas a rlnmon(4 exnio3tytla eaueo t0 ruo(mpnudomeelneils a2raurono0oetn fciyslsDea(vo ()altnxr3oa1oa eauvil( setoxr nu1apt mfesl( srrr(rpot0aleomo3iasfm2uanvpn(0arxrmo3tadlaDe ivs;t0 rxm(mpnu4oltemict (f Drrumo;u1tptomfetad s2rmn p;t)tleomrcta1lm eaueils0t2tmxm3io1opt lfvia( a2umumpnu0apx  fetytfs2ea(vsnt)tltrio3ty1lm raies s sruoio iodlmee nctl( artrxr nt0apxoifetysfa el(ms;t4 eenircty1omDraivils0teto(mpny1lmeelnctl()artaurpnu4alxn i3tltfm rmuvonu)arxnxo ta1lmDr ueilt0teumxmpnu4lpen fcias s2rm(mooo1olxo ociad mDel(vp;u0 lxnxocty1lpDelueols  ruo(r3nodll emfes (fsrur(rpnt0texoio3iltlm2rlnmon(0arerir3oatfp elu s;s s2xm(rpnu4op elncs s)a2trur ot4oexoiieilsfs umnvon()texomo3iydlpDrlieslt)trxo(r oo1opt mnet ( s2urx o;o4oet ioeiydla2eauvp (4alxnmrcoodfatraivsl()trxr(o nudap   nei s) 2um(r ;o1ale ioctydfs2ra( snt4trtnxf3oatfp eauvi ( trurirpno4ll emieia( aDumumpou1tex  fetys a2uln o (4 eerif3oydfmtelneol()t2xrxrpiy1ope  nesa(fs2tmxm ou4tlx  oeilslaDua(vsnt4 lenmfciytlpD lies s) ruo(r iu1omtnlnci sfs2uaump;t1aex mf3ild mDemuvo;(4 eerxf oodlpt lies ( trxm(mpou4lm nlnvslt)sDua(rpou1aeto ieils s emnms;(0arermo3iy1lp ran i ()trtr(mpiy4apee neils s2rm(rp;o1tpxnifetls s2rm(ms;t) lxoir3iatoptelnvs ()seumio io4lm  lfeta()aDtrx poo1aee ii3iasfaDrauvo;t)alermf3todop eln i t0s2umiopiu1lmt mfvsat  2uru poo4tet ioeiltfs rluvp;t0trtomfcoadfm rlnvil( texmio iy4lleemivsas aDumurpnt1alt ii3ildfaDumump u0texnxfcoy1lptranes s)sruoxm3iu1ll   feslsfsDtmu o;t4texoii3tas a2rmnms ()aeeniocoydlaDelieolt) 2tmiopiy4apenmivt ( sDta(m ;t0opxn feiat aDrmnvo u0arxoxf iadfpDeaiei s0 rtrim3oo1am  lnetltfsDua( pnu0alto ocils a2elnvs;u4alxrxf3oadfmte nvo () etrir3ny4oltelnei ( sDtmu  ot1aetn feildfs ul( ont0alxrio3iadlpt  nei s0tetm(m3ou4lm e nvils artaumont4oetoiictlslmDrl(vs;(4texrmf3oytlm r ueo;(0seur(r ny1ol nmicsas)srtmxm ;o1apto i3ilt s ulnmon(0 lxnmo3to1lp eau i (0t2xmxr ou1lmt  nvslsf rtr( pnu1tleo oetld m2rm(mon(4aetoiocoydfa rlieo;(0 2xoir3nydope mfcslt) rtrxm ;u1aptoiiciat mDul( p (4tlxnxfciy1laD ai il()srto(rpnu4lmeemnetls)srtau pnt1aeenio3ils mDeau p;(0arerxf iatlmtraieo;s  2um(rpoo1ole  ivtatfs2tm(  nt1tleo oetasls eanvsnu4 rtrio3oydoat auvslt srtrxr3oo1openlnctl()arumxr no1opt ii3tyslsDumumpnu4arenxo3ta1oa eauvilt seumxrpiy1olt lieilt aDta(rooo0aet moeiatls eanvo t4aeenxrctatfateaueo;t)teur(o oydll elfvsa( s2trx  nu0apxnmo3tld a2rm(mpn(4trxnmr iytlm elivol() rurxmpiudlme  fvia()aDua(r nu0open ociat mDemuvo (4tlenmo todlmDraueo t0tetoio iu1lp nlfet s) 2uaxr ou4aex ioctys aDrlumpnt)aexnir oadfptrauvo ()texm(o oy1lmeelfvi s aruaum nt1opx ii3iatlsDulnmsnu4 etnir3oatom r u i;t)tetmxo3nudolen nesas)srtaumpou0apx  f3tas aDrl( ont4altrif3tydfa  an i t0tetoir3nydaltemnvil() Dum( pou0alt moetat m2ean o t0altnif tadfp rai i;t)teum(o iy4ap elfvils artaxr no1oeeoiociydla ea( ont4tetrxr3oa1fpt auvs;s  2urxr nodlp nlfvs t)arua(roou1olt mfetat aDelnvo (4tlxoif iodomte uvils)sruoimpiu4om  livtat)arrau o;u1oee mo3tltfm el(ms u4tetoxociadop ran slt0 2xo(mpnodapenmfcil(  2umumono4tle if3iaslsDrmu snu0tlerxo3to1fp eau sl(0seurxm3iu1ll eliesl(  Dtax o;u0tpen f3tydfs uaumo;t0 etoxr3oytlm raieils trtrir nudapt lieil(  Drmu o;o1tpx mi3iltfm rm(ms u) reoif3oy1faD au i;( t2xr(o3iy1ole  iesat sDrru  ou4ole mieiyd a2el(vo u0tlxnxf iytlaD au s;t) eto(r3iydllen ncsltf 2umx o;t0aleo o3iadfs2uluvsnt4 ltrmf3oadomte neslt)texo(r ny4op e fcsasfsrrmumont0ole  ieiytlm2uauvo t4 exrmrcoadfat lu s;()srtm(o3nodamt  fvsls a2tm(rpoo4oltnmiciytfm rln pnu0altrxf iy1fmt aivo;t)srur(m iudomtemfetl( s2tau  ;t4alto feiyd sDrmuvs;(0trermo3ootlpt  ivo;t)setriopno1aptnmicslt  rtaxroot0ole mocils m emnvp;t) exrir3iy1fmDrlivi;()trto(m3oy1omtn nviat)a2uau  ;u0aleoifciatfs2rlnmon(0tltrir ty1fmtraivils0trtoxm3oo4lmtn iviat) 2tm( poo1optnmo3iysfm2rlump t4trxnio3iydfp rai olt0t2xrio3io4amenlncia() Drmx oot4aet ifctltls2ea(mon()trxomf oydoaDean i;(0s2xr(o ny4lpt liviat  rtmum ;o0alxoiociad a2ulump t4trenxo3iotom  aivs;( setrxmpoudll  liesl( s2rrx pno0teeomiciyd s ua(vpnt) ltnxo3iatop eanvsls  etmxopiu4openlnctl( aDumu ooo1alxoiociadfsDumu o;(4aexnmf tadfa  auvi t) 2tmxm nu4lptn ici s  Drm(rpnu1aexoif3tadfs ul(vs;u4 ltoif3ia1lm   u i s setm(r3oo1amen ncta(  2rau oot1altn oeiysfs2elumsnt0arxnmr tytopD li s ( truo(o3oudomenlfciatf Duaxrp;o0oeen feildls2umumon(0trtomr iadoa e iei (0t2xo(m3iodalt  nvi t  Dtrxmoot1opeoioetls aDrmn p;u)artrxo3to1op rlues;s) 2ur(mpoo1llt mieslt  2urum ;o4tex  o3tld mDumu s (0 renxf ta1om eau i;t0s2ur(mpiy1lm elnesl()srtmur ot4tpenif3ild aDrl( s u0alxnxocootfpteauvs;(0tetr(r3oydol emneils)aDrr(mpoo4tlx  o3iadlmDemnmo;(4 rxoif3iatfpDr nei t) 2tmxopny1aptn ivslt) 2uru o;t4tlen ieilslm2ra( pnu)aexomf3oytla   u s;t s2xm(o nu4openmnet t aDrmur oo4oee  o3tad a um(mpnt)aetomociydoaDr iei;t)t2uoxopoy1lmee nctlsfs2trx  ou4apt ifeiysfm ranms;u) reoircta1lpDr ies;( tetr(opoy4lmt  iet sfs2rrumpou4tex ioeildlm um(vo;t0aetnmfcootfate n il(0truoir3iydlptnlivsltfsrtaxr nu1aptoii3iad s eln o;t0areomr iydfp rai s;s  2ur(rpnu1ol elfci ()sDtrur ou1tpxnmoctys s emumsnu0 rxnxf totoa r uvi t)s2tr(mpnudalenlfei ()sDrmx pnu1aexo iciyt a2rm(mo ()aexrxocia1oaDelueo;t texrxrpoodomt miei t srrr( oou0opt io3tat mDemuvo;u)tetoxf todlateai sls setr(mpoy4ol   nci ( arumxr ;t4alx iicias mDum( p ()artnif3todopDrau i;t0 2um(m ny1lpe mieslt)aDtrx onu0tet mfeilsfmDel( pnt4 lxnxr3totom   ivo s)srtr(o oy4ole  ncslt sDrrum no4oet mieiys s2em(von(0aexoir3iydop r ueil() 2tm(mpnodolt mfcsl(  2ra(mp;o4tleniieild m2rlu o t0areomrcio1lp  lneolt  rxriopoodll emnvsls)arumxmpno0oet ifeiydfs2rlumo;t) ltomo3ia1lmt au sl(0 rxmio3iydole mfciltfa2rmu p;u4tlxoioeiaslsDumu o t4trermf ootoat aueo;s)t2to(o3oy1alt mncsl( aDra(  ou0oltoif3iadla2rln o;(4 ltoxfctytlp elneslt0sruoir no4lptemivia() 2um(m nu0opxoii3iyd aDemu p;(4arenmoctotfm e ivo s)trtoirpiu4ol emivtl(fsrrr(ro;t4opx  o3tysfa ea( pnu4arxrmo3oytfaDeliei t srxoim3oy4amt mfvsa()a2ur(ro;t4oex  ociad s rmnvp t0 ltnxfciy1oatelneo;t trto(mpno4omt mivsatfsDtrxm ;u0tptomo3iydla el(monu)aetomo ta1omDe uvi ( s2uoxm nu4lptnmici ()s2tax  no4alxnmieiat a ean s t0arerxrciotoa e n o t  2urxo3nodomtnliesas)aDtr(r oo4alenifciltfa emn p t) reriocootfmDeaivo t srurim oudap elieia( aDrru ont4tltnifcilt aDulnmp;u4 eeomf3oatfp  luvo;()texrio3iu4lptnlfet tfarrrx oou1tpx  o3iysfm ea(mpnu0trxrmo3totoaD  n o;t)trxoir3iu4omtnlnesls)a2ra(rp;o4tlt  i3iltfaDrmuvp u) etoif3iotlate n sl(  2um(m iy4open nes (faDrr(  ou0aexnmfeiasfm ul(mp u4 etoio3oodlmD aivils0 ruoiopiodll   ncslt)a2uax p;u1tlxnifciyd mDrm( p u4 ltnxfciy1fmDranvi s seto(o nudlmen net sf 2umurpot0alxoif3tld m rm(mpn(4 eermr3tytfp eli s;t0trto(m nu4llenlfeiasf Dtm(r ;o4oleomi3ildlaDrluvo t4tlxrxf3oytoaDeanvilt)teur(rpnudape  nvias  2uauro;t1aeen ieiyd s2el(vsn(0 ltomo iodop r neil(0 euo(o ny1aptemnetls sDumu  nt0optoifciyslsDrluvs (4texrmr tydomt an ol( srxmxr3iu1olt lneias)a2tr(mooo4oeeo ietysfm2umn s;u)texoir3oatlmD lnvo t0t2toiopoudlm  mnvsat)s2tm(m no0alxnmi3iasla2umn pnu0artomf io1fat an i t  2xoir3ny4apee fes s) rur(  ;u0alx  oetltlm ea(vsnu) exniocio1oa   uvols t2xr(m iu4al  mfciasfsDrrur nu1aex iietydla2el(ms t4 lerif iydfp  luvslt  2trio ny1ol   nct (fsDrrxrpnu4tetomfciytlaDra( s (4tleoxf oodopDeaieil(0 ruo(r oy4omenlieiatf Draumpnu4tltnifctls a ul(ms;u4arerio3oo1fptr u i (0 2tm(mpiudalen fciasfa2umu p;u4alxn feiys a umnvp (4trerxr3ia1oa  livs ( t2tm(o oudam elnvt (f rraxmont4tleoifeias a elnvpnu) eerxfcoydopD  neslt  rto(mpoy4amtn netat) rrrxm nt4apt iieiydls elnms () reoif oadlpD  ues (0trxr(m3oudaleelfctl( aDtr(mpno4oee  o3tys a raump;t)tlxrxrcio1oateauvo;s) exmxr nu4ame mieslsf Drr(rpoo4aleoifeild mDrmnms u4 rerxociodlpDr uvilt  rtm(opiydolte fcsat sDtmx  ;u4aleo ieias sDel( p;t)aetoxfciytfp eauesl(0sexm(r3no4lpee iei tf rrrurpnt0olx  fctld sDraumo u) rerxf totopDr nvolt t2um(mpnu4altemfcia(f 2urumpnu4ole ifciltla2rmnvo;(4aexrxo3iodlm   i s;t)seurxr3nodlpen nvtat  rtau p;t4oetomieilt m2umnvp (0altoifcoadop eau o ( teuo(o3nu4oltnmnvtlt a2trxro;o1ale ii3iasfa2ra(ms;u4aetoxrctatoaDe i o s) exoim iu1al n ivi sf 2uru  ot0teen f3iytla emu o u)aetomf3ia1fp eln i (0t2umio3no4llt livil() Dtmurpot1apxn o3ild s2emnvo;(0aeeoio3oytfp elueo;( s2urxm no1lme mfesl(fs2tru o;o4texnmoeiasfa rm(vs t4trtoio iy1oaDe ivi (0srxrxr3oo1apeemivslt srtrumpnt4oltomi3tysla umump t) ltomf3io1optraueo t0setoir ny4ll emnvi tfaDrru pnt0oexnmf3iys a ea(msn(0altnxo3totoaD  n slt0 euo(o ou1lptnmnvsat sDtm( pot0altnmoctadfaDumnmsnu0tetoxf3oydfa  anvsl()s2xr(opny4opeelies sfsrrmxroot0apto feiltls uau o;u0aeermo3oa1fpDeln s;t0seurxo3oo1op nlnesat)a2tau  ;o4tpenmfciltlaDum( s (0 etnxo to1fatrlivs t)sexoxm nu1apt lnetls)aDururpot4oexniieiatla elums;t) eenirciydomD  ueils)setriopiu4ap  mnvslt aDtr(r ot1aexniieiysfa2ra(mo;()texomr tadoate n i;t0 eur(m3no4omeemnetltfsDra( pno4alt  i3tasla2uanms;t)trxnxocia1lmte ivo (0 2trxo oydlltn nctl(f 2tmurpot1tpenmo3tysfaDra(vs;t4alerxf3ta1lmDeaivi;() 2umio ou1omee ics t)sDra( p;u4teeoio3iys a ul(vp u4 etrmr3ootomDraivolt) rur(m3iy1aleemictlt)a2ua(rooo4olxoifetatfa2uauvs t4 lxnxrcootlatrli i;t)srtoio3iodale lfviltfsrrmu  nt0oet mi3ilt m2ua(vo;t)trtnmrctatlpt  i o t s2umio nu1am elfviltfaDrau  oo4alxo feilsfs2emnvs t4 rxoir iydlaDe i s t sexrio oy1lp n fvils  rtmuro;o4tetoifciltfm ra( pn(4 rxoxo oy1opDeli ilt0 eurir io4lltelnei sfs2tmx  nt0apxniociyt m2ulumonu)tetoifcty1lpDeluei ()sruoxo iu4op   fcs s  Dtr(mpou0ape  fciyt a2umn snu)altrmo tadlaDrlueilt  exo(opnudap emfeias a2ua(m oo4tpenmfctad a eau pn()aexnmf iadomteanvs;() exr(mpny4am elfesat)aDrm(  oo4tpt mf3iatlm2uanvs;u) lenif todlm r nes;t  rtrxo3oodlp  mfvils) 2rrxm ou1apto i3ils sDea(vont0arenxociotoaD  uvi ()trxmim oudale  ivs s aDumu o;t4tetniocilsfs2ea(mpnt0alxnifctatfmt lneols  eumir iu4lmeelfvtlt aDrmumpot1tptoifeild sDua(mp t4aeermf oa1oat aivi t0s2ur(r oo1alenlnvsas)arrmxmpot0tpx ifetyt m2eluvon(4tetrxf3io1oatranvo;t)t2xrxrpio1openlivtlt)aDtau  ot1oeenifciatlm2ul(vp (0texrxr3iadfm elnvo;s0 eto(m3nodlpeemfct () rtmu  nu1apeoio3tltfmDrln pnu)trtrxrcoodfatrlnvi t0t2um(m nu1lm emnctat s2raxrpno1alx mfeiadfs ea( sn()trxomo3oo1omtrlnvs;(0 exmiopiydale livsl()s2rmum ;u1olxn fctadla2rmnvont4 ltrirctydfmt  ueol()trtmxr3oo4ole  ietls)aDua( p;t1tltomociltla2emump t0aeeoir3oo1laDe uvs;()trtoxr3iodop elfcia(f rurx ont1tleomo3ias s uln s t0 etnio todlaDeai i;t) rumxmpio1llt lfeias)s2ur( o;u0oeto feiyt sDrl(vo t)trtrifctatlmDraiei;s sexmxrpiodape mnei () rtr( o;u4tleoifctltfs2rl( snu4aexnxfciydomt  uvs t) ruo(o iydaleemnvi sfs2tru  nu0aeeo o3iaslm2um(vp t4aleomrcoodlm e u s;t0t2um(r3iy4lltemiesls aDumx pno4tpxn oeiasfs2el( s;(4teermfcoo1fa e i olt0seuo(m3io1al elfcia(  2rau  no1opxnmietad s2ra(vo;t4 lerircoo1la   iei;t srumxopoodlmt liesa(faruax  ;u4tlxomietadfm2emn p u)tetnxo3oo1opt livo t0 rurir oo1openmiciat aDraumpou4oet mieiat mDraumonu)trxoio3ia1omtrli s;( srxoiopno4am nlnvslt) 2ra(monu4tetoiieiydfsDumnmo ()arenir3ia1lmDeluvi;(  etoxopno1ole mnctl()s2ua( onu4oetn ieiadla2emuvo;t4tetniocoy1omD au sls0texmim3nodole mnes tfsDumxmpnu1tle miciytfs eluvs;u)tltomr iodom ran i s)srur(o3nodomenlicils) 2tru oot4tetnmi3iys s emnvo ()treoiocoydfpt  ueolt) eum(r3iydamen ies tf rtrur oo4tpeomoetytfm ua( pn(4 exnxo iydfp   u s;(  ruoiopnu1ap elncsltfs2umx pnt0olxoiieilslm ulu s u)altomr oatfpteauvi;t0srurxo iy1opee nvsa() Drrx  no4teeo fciat sDuanvo u0areoifctotop  aueo t  rxrio iu1ol nmfct (fsrurx oot1tptomfctat m ra( o;u4 etrxf3ta1lm  aueo;s0 2urim3ou1ll nlfeils)sDtru pou0alxnioeiat s2elnms (0 ltoxrciodoa r n o;t texr(rpoo1lpte ies 
\ No newline at end of file
@@ -0,0 +1 @@
+n s t  exoimpiu4amtelivta()arum(mono1opx mociydla2rmumo;(4 etniociatomDr uvslt  etoir ny1op nmfeilt)srrr(mpnu0apx  ietad s umuvpnu)trtrmrcto1lpte u il(0seumxo iu1lpenlfetl(faDtru p;u0tpt  i3tad a umnmpn(4trermr3oytoa r ies t0teurxmpiu1olt  fei s)arrau ooo1aetnioctlsfmDelnvpnt0areomr oo1faDelnvols s2xo(r iodamtnmiesa() Drmxmpot1aleoiiciasfs2ra(vp u)tltrmr3totoate i o;s0sruoxrpou1lmtnmfvt sfsrtru pnt0alxniociytfm raumonu)arenxr3ty1fm r ivs s) 2umxo3ou1olen ietatfa2um(rpou1ope  oeiltfm2rmnmo (0 rxomf iydopDe iei;t0t2xmimpnu4altelfetlt sDururo;o1oexo o3ilt aDum(vs t)arxrxf3todfatrauvi;( sruoirpnodale lncilt)sDurumooo4oleomfetadfm ea( snt0trtomo ty1lm   n i (0 exoxmpou1amtn icsa()a2ur( onu4optn octys aDem( o t0trxnmo oodfm raieils)t2uoirpiu4ap n ictls)s2ua(mono4olt miciadfa2rluvs;t4 rtrxfcta1lpD lnvo;s)trtoio3nu4ope lfctls arrauro;t1tetn oeiytfs2emu s;u) etnmf3tydoatrln ils) 2xoxopnu4amen ivt s a2tmurono4apxomfetaslmDrlu s;(0trtoir3oy1fmte nesl(0s2tm(rpny4amtnlfcsl( srta(mo;u0aee  f3tytls2uanvsnu)teeomfciy1oatr nesls sexoxo nudapt  nci sfsrumx onu1tptnmf3iadfm2rmu o t4 ltnio3oa1om  an ols)t2tr(rpoo4oleemneilsfs2rrx  nt0aee ioetytlaDulumonu4tltrxr iytfa r i s;t0s2tmxrpiy4lptelfeia( sDur(rpoo1opt  o3tldlm2em(vsn(4trenmo3iadfmDelivo;s0sexmio3oo1opte ivsa()srtau  ;t1altomf3ils m umn on(0artrmr oadfmD  iei;t)s2xo(o iydale lneiltfsrtmxmp;t4aexo fcild s2rlnvsn()trtrio3tytoatr nes t0 rtr(m ny1alt  fvtat  2umurp;u0olxomieils a2em( s;t4aetnio tadlpD ai o (0 2uo(mpio4al elfvtls) Durxm ;o4ole iictytfs eau o;t)trtoxocty1opDe neol(0 rtm(m io4op   ietatfsDtmxr no1tle ifctysfa el(msn(4aleomfcoatlaD an ils)t2xmxrpnu1apeemivi ()sDtrx  ou1opto o3iltlm rmn s;u0alenxo3io1fmDelivi;t) rtr(rpiu1ap nlfvsa() 2ua(  ot1tet ioetlsfm2uln s u0aetoir3oo1fp e ivo;s s2tmxopnu4apeemnvs tfs2raumo;o1aetnmietlsls2ua(vpn()tetrmo3oatomtrlu o;t0trur(r io1llt lies tfsrtr(mpot1teenmf3iytlm2um(mpnt4 lxoiocoatfmt aiei t0 rtmxm iudal n nvi s)aDumurpnt0aexo fctatfmDuanvsnu)treoxrctytfmD aneo s) rto(mpio4amee ici t sDrm(m oo4olxo f3iytla2rl( p t4altrio tadlptr nvs s0s2xmxo3nu4aptn fcsasfsrur( pno4aptnmf3iysfsDrmnmsnt4trxnmo3oy1op elneolt0tetm(rpiu1olenmfvs ()sDumxrpnu4aleo fcild a2rluvo t4teerxrciytla eanvo t)truoxr iy1am e nvs s  Dtr(r ;u0tpxnmi3iasls ul( o (0artrircty1om rlnvi (0s2tmim ou1omenmfvtl(f 2raum oo1olxo ictydls2um( o t0teenxr oytoatranesl( sexr(m3no1optelnviat)sruaxr nt4apt mocias s ul( pnt) etrmf3oa1fa   ivs t) euo(r3oydaleemfet () Dra(r nt1aptn fetyt aDelumo;u)alerif oytfm rauvolt0truoir ny1lpee fvtatfaDrmx ooo0oetoifciad s2emn p u0 rtnmf3iydlptr u ils s2xo(o3iu1lpenmietat) rurur ;t1aeeomi3iyd s2ua( sn(4 rxoirciadlpDeln il(  2umio nu4lp e feslt)a2rmxr ou1aee moeiltfaDua(mo;()aeenmf3oydfm e uvi;()t2uoxm3nu1om  lncsa(  rurump;t4aee  fetls s2uauvo;u4 lxnif3oy1fpt  iei;s0s2tm(r3oo4apenmnetat s2tr(rpnu4apx ioetytlaDeauvsnt4 etnxr3iy1fa e u i s t2trxopoydam  mncsa()a2tr(ronu4altnifciys s uanvpnu)trenif oa1lpD  uvs;s0 eum(mpio1apenlfvsl(  rum(r ;u4olx  oeias aDumuvs (0altnmo3oatfaDe ivo;()srtrxopoydap nlfes sfs2rm(rp;o0tex moeiysfm2rmnvpn(4artrir3tytopteli s (0t2toio3nydole lncsa(f rtmxmoou1tlen ociydfsDrl(msn()tlerioctodop raues;(0 exr(r3iu4lp nlnetat aDrm(rpno1alxn oetldfs elnmsnt4tleoir3ia1fpDr u s;s0trtm(mpnodlp   fcslt  rrmuro;t0oltoif3tldla rl( p;(0tetoir3io1om  aueol(0trtr(rpiu1alte iet t) 2urx pno0apenioeilt mDrlnvs;(4 ltrxrcoy1fa ranvolt teumim3nu4ol elnesatfa2ta( o;o0opx  octltlaDrmump u4treoio3ia1oatrlnes s teumirpiodlle lfvtas) Dum(roou1tptnifciydls rmumsn(4trxrifcto1fmt  i s s0seuo(o3ou4optelfet tfs2ua( pou0tpe iieildfm2rm(vo;t4trtnmocoadla rlivil(0 rxo(o nu1al  lnct s s2uax  ;o4tetn fcils mDum(vp;u4tetnxr iadfm  lneils0 rtmxo ou4alte fvs s sDurxrp;o1tleoifeiat s rln on()arxoio3totfm r ieil(0srtmxr iydlmenlfei t s2tmumpnt4apxo ociyt a em(ms t)arxoxrcoa1oatr nvi s)trurxm oo4ame lici sf rtm(mpou0tlxn i3iytls2rl(vs (4 leoxr tydfmD auvil(0trur(m3nydolenmnvt sfa2ururp;t1aee mfeiatla2ua( p (4 ltnxr3iotfpDr u i (0teuo(r iy4lpe mfetlt  2rrur ot0teenmieiyt m uaump;()aeeoio3totfmD aues;s sexo(opoy4al  mfes () Durum nt4apen i3iasla2ra(ms t)aeenmfctodoaDr i o t tetrir io4lp  lfct sf 2rmx  ;u0alxnioeiydlm2elumo;u0aexnio iydlmteli o ()t2tm(rpnu4am e fetasfaDumx  ;o0oex  ieiytfaDul(mp;u)tltrif totlmD livi;t sexmir3nu4al nlnciat a2rr(r ;o0tle iictad m2rm(vs t4areoio to1lp elivs () rxr(m3oo4olt  icilt)srrmxm ;o0oetnioctydlsDrmnvonu4areoio oodlaDrluvi ()trum(o oy1apenlies t)a2rru o;u0tpt ifcilt s2rmn s t0trtnxocio1fp eluesl(0setm(o oo4oltnlies (f rtru  ;o1tptomocias a eaumsnt)trxoio oo1lptrln i (  rxoiopnodalt mnetl( srurum nt1tlx if3ias s2ul(vsnt)aexoio3iydopD auei s)teur(r oudlpt mncs t)srtm(r nu0tptn oetlt s emu ont) ltnio ia1omDe ieslt0trtrxo nudam nmicilsf ruaumpnt1olx miciydls em(mpnu4tltnmf3oo1lp  livi;t)teur(rpio1ol n ictatfs2rrurp;t0oeenmfeiadlm rmnvo (0aetoxr3oadfp  aieo;()srto(m iy1lmeelnvtltfsDuax ooo1tex  icilslmDuaumo;t) leoxo3oytlp   u s t0 rxo(r3ny1lp e ics () 2tr( pnu1opeoifctyd mDrl(mp;t4teeoxf3oatla  auvils  2xmimpiy4lp  lncilsfsrtr(m nu4tlxnii3iydlm ranmo;t)tlenxf3oa1oa  lu i;t0teurir oodomee ictltfs2taumpnt1tlxnioctadfm2elu snt4aetnir oatfp   neil( t2xm(o3oy4ll nlneil(  rum(mpnt4oeenmfetadfa2elu p (0arxoir3oa1fp  liesl()trumio3nudale lnvslsf rumxronu4tle mfciys m2ulu p;u)aeermo iodlmDeaieo;( teum(o io4lleelics s)aDtaxmo;t0tpxoiociasfs2ul(mpnu0 lermo iy1opteaivs ( srur(rpny4omte nvtl( srraur ;o0oetoiociydla rmnvsnu4trenmfcoa1fa elueo ()teuoio3iy1lltnliesasf Durxmoot1tpxnifciys mDemn sn() lxoxf oy1op rai o t0 rxmxm3oodom  liesl(f rumu p;o4olen f3tldls rlumpn(0artnxo3oytfaD aieols)truriopiy1lp emneiasfaruaxronu0olt mfeiytla uanms u4arxomoctytopt au slt) exrio3nodamenmfci tfarur(mpoo4oleomi3tls m2ran o (0tltrxr tydfa rai o;t) exrxrpiu4lptnlnvi t)a2taur oo0tpeomfeilsfm rmnmp;() reomr ia1faD ai o;t0s2tm(m3io4lpe miesat) Drax  ou0tlt mf3iadlm2rl(msn(4altrif iadlateanvs t0trtmxr3iydlltelnetltfa2umxrp;o4texoif3ildlaDean p t)alxrxf3tytlaDe i sls0 euo(m iu1oleelneil()arua(rpnu1oeeoiiciatls2emnmon(4areoxfciadopD anes;s tetoxrpiodlmte fesltf Dua(m ot4tpe miciytfm rauvpn(4texrxocoodoa  aueols0 exrir3ou1al n nesls) rtmxmoot1tee mietadla2el(ms;t4 lxrxo3ty1oaD livs ( srtmio3nu4omee iesas)srraxm nt1altoiictysfa2ranmo u)alxnxfctatomD anvs t t2xo(m3iudamt lnvt t sruaxm ot4openmi3iatfs2eauvs (0artoiocio1lmtrlnvslt)setr(opoydomt mfetlt  Dta(m ou4opxoii3iys mDrlumpnt4 lxnio iodopDraivs ()t2uo(o3iy1apt mies tfsDum(ront1tptn ieias a ean o;(0 lxoxo3oodfm  lu i s0 rxrio3io4ol emfvi () 2rmurpou4oltn iciatfa2rlnvp (4tetoxr3iydomt lu o;(0 2xo(mpio4lmeelieilt aDrax pnu1tpeoio3iad sDrln o ()tltrxf tadlp eauvo s) 2tr(m3nydlmt mnvt t sDtr( o;o4aeenmo3iys s2umn s;()texrmfciadomD lnes ()truoir oo4apt mnct sfs2urx ont4tet ifeils sDelu onu0artnif iytoate ues;()srxoxm3io4oleelfvs sf rur(r ;o4opxomfetys m ra( o;t4trtnmr3totfat ai ils srurxmpnodlm  lfet s) Dra(m ot0apt mieiat aDulnvon(4altnifcoa1oate ivols0 rxo(o3oudlptemivslt)srtmxmp;u0oltnifciydfmDrauvont0alerir3ia1fa elneols)texoio3iu1olenlfcslt  Dum(m ;u0teenifetatlm ua(mo u4 etrmfciodlm elneo;( sexmir3oo1lp  licsls  2trx  nt4altnmfciadfm rauvs;u4trxoio3tydopDrluvs;(0t2ur(mpio1lm nmnctls)s2tm(mpoo0apxnmociyt s ea(vs u)artnir3iytlaDrlivi;s0teumxr3oo4opeelict t) 2raumpoo1apt mfeiyd m rau s (0trtoif oatfp elies t0t2xoim3nudom nlicsl()sDraumo;o0teeoif3ildfsDrmumpnt) eeoxr iydfpt  ueilt) eurxm3oy4amtnmnei s) 2trur ;t1aee mieilsfaDrlnvpnt)tlxoxocoy1lmD luvs;s0 rtrxm3no1lp elnvi s)artr(rpnu1oeeomocilsls2em(mp;u4trxrir oa1fmteaieilt)srurxm3iydalt mieils a2urx  nt0teeomf3iadlm rln snu0 lxoir ia1fp   ieol()texmirpnudlltnmnctlsf rtru  nu0oexoii3iatfs2rmu o ()aexoif3iydfm  an sls  eumio3iodamen ies ( aDtaxro;t4tlx mfciytfa2emnmonu)artrmf iadoptrlivils)sexm(r3iy4op  livs ()aDur(mpnu4olt mo3ils m2ea(ms;u4 reomo3oadlpD ln o s0 2xoxopiydap elnciat aDrrxmpot0aeeo f3tadfsDel( on(0 eerxocoa1la raivo;s) rxm(m nu4opt  fctas)aDrr(  nu4tlto ietadfm uln p;t4altnxrciydfatrlneo t0t2xo(r nu1llee nesls) Drr( pnt4tptomfcildlsDua(mp;u)trenifcoo1fa  ai o s)sexmimpoudom nlfesat sDtrumono1aptnmf3tytlm2eanmp ()altoio3totlat auvi s0trto(o iu1lleemncslt  2tmx  ot4tlenifcilt mDem( o ()tleomo oa1faDrauvi;( s2xm(mpiy4aleemncs s)sDuaumono4olx iocildlmDuaump t4 lxrxf iotoaDr n o;t texm(m3iu1optnlfvtas) 2rmxm ;o4texo oeildfmDeau pnt0 ltoir3oydlpteaiei;(0 rtoxm nodop e nciatfsrtmxr nu4tee mfeiatfa2um(vp u)tltrxr oydom   uvo;t) 2xm(mpnu4llee neil( s2rmx  ou4alx  o3iat a2umnvs;u4trtrif3iotfaDr nes t0teurxrpio4lmtnlfei t) Dtrurpnt4aptomfetadlaDrm(vont4arxnxr3oytoat  iesls0seto(o3oo4open ieil()artru o;t1aexniieiytfaDra( p;t) ltomoctodlmtr uvolt0 rxoim3ny4lm  lncs s)artrxm no4optomo3iyd s ean s t)aeerxociodlpDe ies s)srtoxo iy4lp nlietls)aDra( p;o0open i3tytfa ua( pn() ltoxf3iotlm eln i;t)t2to(m3nu1op  lnvil(fsrua(mp;o1texnifetat mDean on(0 rtrxr ootla  auvslt  eurimpoy4op nmfesatfs2tmur no1aex mf3ilt a2ul(msn(0teerio totlmDraueils srto(opio1aleemfeiatf Drau p;o4apxomi3tld a2rlumo;(4tlxomrciadoa eau i;s0 rto(m3nodllte fci ( aDrrxrp;t1tpxoiietydfs rmnvs;t)trerxfciydlmtr nvolt)srxoir oudam  mfcias srumx  nu1tex iiciyd m2rmu on(4teenmo3ta1fpt luei ( s2uo(r io4ole lfvilt)srur(ronu1tpe mo3tydlsDrluvsnt)tlerxr totlpt li ils seur(o3nodal elnvt s  Dtru p;o1aleo ocias s2ra( s;()aexoxr iodfpt auei ( tetoxo no4opte neiltfs2rau  ;o4oee  octasls rln snt0artrmo3tatla eaiei s0 exm(m oodop   nei sfs2tm(m ;o0optoii3tls a2ua( onu0 eeomoctydfmtr ieo ()trtr(mpio4opee nvsls aDuaumoot0oet mo3iyd sDra( snu4trxoxo tydoptraieol( s2tr(r nu1ame mncsls aDtr( ont4opeo iciatfs2ulnvo;(4 lxoif3totoatrluvi s0t2toxo3ou1lltn ici tfs2ra( ont1altniiciat m eluvs;t4trxnio oydlm eliei t)srxmirpnydape lneilt)s2rmxrpnu0oet ifctaslm2ua( s;u4aexoxoctotlatelnvo;t)sruo(r no4ape  fvil(f Drmx pnu0aee iociatlm2rmu o t4altnxo3io1lpDe i o s)t2urio oy1lpe lies ( artrum nt4teto fetlslm umn o;t)aetoxfcoo1oaDr uvs;()tetoim oydape lnvtltf ruaur ;o4texoiicilt s uauvont4trtrmo iy1lptelivi;( s2uoimpoodaltelivi s)a2um(rooo0aexniociltla uau o t)artoxocoydlpt livo t) eur(m iudol   ies t)a2umxm ou1aeeoiieils aDemuvsn() rtoif oytlpD luvs;( seto(o3ny1op emfvtat  2tau  nu1teeoioeilt a2ul(msn(0 lerif iodfpDrlnvo () rxrio oodlle  ivslt)arur(mo;u1oltnmo3iysfsDemnvs u0tlxnxf3ta1oatraivi ( srxmxo oy1ol emivs ( srtm(m ot0olenmo3iysfs um( snt0arxoxf3iodlmtrlnes;()truoimpio1amee fci sf Dtrumpno4opxoio3ild aDuaums t)aleomr3oadlp elneols)teto(o nudam emivt s)aDrr(  ot4oexnioctltfmDrmu s u0tleoif iotfatr nvi s  2xoxo3nudomee feil()aDumx o;u1aet mfetas m2rm(msnu0aetnmocoatfaDraieo t)srumimpny1alenlncs (fsDurumo;o4opx iocils s2rl(monu4tlxrxr3iydopDran ols0 eto(o3ou1ol nlnes s srrmum ;t0teenifetysfs uluvs;() rxoxf3oodoaDrlivs s s2tr(r ny4lp n ivsl( aDra(m ;o1oltn o3ilsla2em(msnt4 exrifcoytla eaues;t)s2trim3oo4ol e ictlt  2tr(mpou1tpx mf3iadlsDumnms;(4 lxrxr3oa1oaD  ies ()t2tmio3nydomte ncs (fa2urumoou1apeo o3tadlm2eanvs t4 ltrio3ia1oa rlnes s0s2uoxo oo1al  mictltfaDur( pot1texnmictlsfa2eanms t0aexrxo oadom eluvo;t  2xoxm3io4alenlics s) 2ua(rpou1apto ieiys s rau on()arenmoctotlmDeln s;s  2urimpnu4amen fctas srrrxmont0altoioeiadfm2rm( o (4texoxr3iytfatr ueo (  2xoio3iu4alenmnvta()a2um(rooo4alenif3ilt aDelnmpnt4tlxnmo3iodfaD ln il(0srtmxr3nu4altnlfvtlsf Duaum ;t1tlt moctyd s umuvonu0altrxo3ta1fpD  ivi;t0sexrxm iodameemfetl( aDrrumpno4olx moetls mDrln o t4arenmoctytop r u ol( truoim io4aleemnvs () Dtaumpnu0tpen fcilt sDel(mo;(0 rtnmr3tadoatr u i;s0srur(o3iodope lnesat sDtm( p;o4tpxn ietlt a eanvp;t4arenmocia1fatr ieo (0 2umir3oodope lnvsa(fsDtaxrono1tpt  oeiasla ra(mo t)aeeomf oadlmteauei ()seum(mpoudlme lnvs (f 2rrxr no4ole ifeiadfaDulnmsn(4 rxomr3oa1fp r i il(0trtrio3iy4altelnvsas)srtrum ou0aetomocias sDemu snt4aexrmf oodlpDrlueilt)sexoio3iu4ll emiviat)aDrauro;u0ope  i3iys mDea( p t4trenir tytom   u o s s2trxo3nu1alen fvsat) 2trx  ot0apeoiietad m2eaump;t)teeoifcto1fa r u o;t) rtm(o nu1open fvils arra(mo;o0opt  f3iasfa raums;t4arenxr3ootoa   ieolt) 2umim nydapt lnci tfs2urxmonu4aeen f3tysfm2eau p u4aetrmo3iodfmt  i olt0t2xmim3io4openlicias)aDra(r ;u1openmoeiytfa2ra(msnu)trtrmf3iotopteanvi;t0 rtmxm nudam n nei tfaDtax ooo4tpe moeiadls2uau p u4 ltrxf io1lpDraneslt0trxm(mpnudllt lncsat) Dra(monu0ope mo3iydls2ulnms u)trxrxrcty1om elnvo s trtr(o nudap nmfcta(  2ur(rp;t0tpxo feilsfs ra(vs;t) exnmr iytlmt lu s (0 rxo(r nu1ll e feslt  Dtr(ronu1oltoif3iydla2rmuvsnt0tlxrio3oo1opD aueo s0trumxo3ny1omeemivtl(  2rru pnt0oleomi3tatlaDra(ms;() etoio ootfpDeaies;t  etm(r oo1op nlivt s  rtaurpoo1ale  icilslmDrau p;()aetoxr iytopt  i i;s0 exmim oy4om e feias  Dtaur nu0tltnmfciysfs2uanvp u0aexrxr3oadlptelu ol(0trumiopnudame mfcilt)s2raur nu0olen oeiasfa um( p u4aexrmr3ta1fa elueilt0seurimpou4lpe mncsl(  2trxmo;t1tet mfciytfa ean p (4 eeoifcootfmDe nvo ()trtmiopnodll nmieta(fs2um(  ot4apx iieild a2elnvonu0trtrmfciadfpDrauvi s  2tmxo iu4lptnlnes sfs2trxmonu0aexoifeiadlm ua(ms;t)alenio3oa1lpDe ivolt)s2uoim3iy4lmt  fetat  Dtrurp;t4olxn ocias a uanvs;(4alerifcoa1faDranes (  rumxm3iudlltnmnci (f Dumu oot0aee ifeilt s rauvs t4arxomoctotlpteanesl()s2um(rpio1amtnmfei t sDrau p;u4tpt if3ildlsDul(vs t0 ltnir3oytoaDeaueil(  exmxm iy1ope lieslsfartmumpnu4aleomoetlsfsDuaumsnu4areoxocoadlmDeluvi (0trur(rpnydalt  fvt tf Dta( pnt1oleomictysls2rmnvp;t4tltrxrciy1opt lu o t0 ruoxopny4ap e neilsfaDtauront0oet mi3iad m2ranvs;t) ltrmociy1fmD lies;t)teuoiopou4omeemfesa()aruauro;o0opxnifcildfsDulu pn() etrmo iodoat  u il(0s2uoimpnydoltemivias  Dur(  ot0optoiociad mDra( o u)trxnmo iadom  aues s0s2trxr3io4al e fvt () ruau  ;t0oetnmicias s2umnmp (0aleomf3io1lpD lneo;() 2xr(rpoo1ope  icsas)aDum(m ;t0tlxo ieiyslm2ulnvs;u)trxomrcoytfmDelivs t trtrir oo1am  mict tfs2rrx  oo1olx ii3tat a rau on(4texoxfciytomD livi t s2xo(r ou1lpte nei t)arua( pnt1oltn octadfa2uanmpnt0texnxf iotlate ies ()s2urir3ny1lltelfvs ()sDta(  oo1aeto oeildlm2eauvpnu)tlxnmr3iotlptrln o t s2umxmpoydop nlfcia() 2rr(r ;t0oltoii3tadfm ul(vonu4tlxrio3tadfa e i il(0 etmxmpiydol   ieiltfs2um(mo;u0aetoio3ilsfm2ra(mo;u0texnmfcio1fa  aueols0teuoxr no4apt  nvtl(fsDraurp;u4aptomieiys mDranmo u0 exomrcoatlateaivilt0s2xrxm oodalt  fctlsfa2tmx pno4tee ifetas a2uanvs;t4alermf3iodlaDe i i (  2toir no1lltnmivtatfsDtmump;t0aetnmi3tad mDuluvsnu4alxrmf oytomDelnvils)t2xmxm no1altelfei sfaDtmur ou0aetnioctytls umu pnt4altrxf iotfpt lnvs t trtrim iu4lp n nctlsf Dumx  no0oetoioeiyd a2el(vo u4 rtrxr oatlp rln s;s sexmimpoo4llenmfeils s2tr( poo4tlxnii3ilsls2ea( s;u4tlxoioctotlm rluvols sexr(m3nu4lmenmivtas arta(ro;u0tlxn oeilt a el( pnu4treoifciodopteluvo (0trtoxo3no1olt mics () 2rrx pot4opt  i3iad s2um( o u0trenir oytoatr n s;()srur(o3iy4lpeelfei s srurx p;t1aex  ieiydfaDeln ont0 ltrif3oadfpD  i o;t texoirpnudlltnlfvs s)a2tmu  ;t4teeoifetaslm rmn pnu) ltrio ty1faDrai sls0t2urxrpiodam   fctatf rrru ono0aleo i3tytlm um(msnt) etoio3oydlmtrlnes;() 2uoirpoy1lmt  feiatfarua(ro;t1tlenmo3ildfa rmnvp;()tltoio3iotopDe uvs s  2xr(m oy1altnmnes ( a2rmur ;t0oeenmietasla emuvo (4 etrmo tatfm ranvo s setrirpno4llt lncs ( aDuaurp;u4texn octld m ua(mo;t)aetnio io1fpD  nvo s srxo(r oydam elnvtls  Dum( oot0olxo fctaslmDrm( onu) eenxo3ta1lmtranes t0truo(r3iu4lle lfvia(fsrraur nt0aetnii3ild mDumnvsnt0teeomf ootlatelieo;( s2xm(m3ny1omtnmfetls arumum no1tpt mietldfa2ran pn(4trerio3ootlaD anvols0 2xmxr nu1ole  ncta()sDtax ont0tle mfeilt s2em(mp u)altrxr tadlm eaues;() etr(m3iudopeemiei ( aDrru  no4teeo o3iadlsDumnmo (4trxnxf3oo1fmte uvils) rtmxo3iydapenmivsl(fs2umumo;u0teto ieils sDea(vpnu) eenmo todomtranvi t)setmxo ou1apt mnvt ( srtmurp;o1aetomi3iyd m2uanvp (0artnirctydla  au o (0trxmxo3nudal  lieiasfarururpou0oexnif3iat m rlnmpnt0 leoio3iatlm e u i;s0t2uo(mpiodomtn fetat)s2tmuront0oexoifciytfs2em(mpn(0aetomrctotlaD  nvi s sexrimpio4apeemnci tfa2ta( onu1tetnmociat s2uau s t4arxrxfctydop  aueols0truoxr3io1al e ncil() Dtrx  ;o1ape  f3iasls emn s;t4aetrmr to1la e uei;t)trxoxmpiodoltnlfes s arurxr nt1tlen i3iaslm2ua(mo t4 exniocty1opt li s;t0 ruoxrpio1apen ivt tfaDum( pou0tltnmiciyd s2um(vo;(0arxomocia1omDe n i;t sexr(o3oy1apt lncs () 2ua( pnu1oexnmieiltlm2emnms;t0arxnir ta1lp elneolt)trur(rpny4lmenmieta( a2tr(mont0tex ifeilt m2ulnms () exnmf3tatlmt  uei;s)s2trio3oy4lmtemiet s)sDrrumpou1tpeo f3ilslm2uaump t0trxnmf3oydomDe uvo;t)t2urxrpnydlmtnmneiltfs2rmx  no4oltomi3iydla2rmnmonu4alxrif3ootfpteln i t0srur(m3iu4am nmnesasfsDuaxm ;t0aetnmoctlt s ul(vo;t4arenif3tatlpt  i ol()tetmxrpoodlleemnct t)aDraxr nt0texomietasfm rln p u4 rxoircoatlatrlu sl( sruriopnydom  mfes (fsDtr(mp;t0oee mf3iltlaDemn pnu4aetnxfcty1lmteanvo (0s2uoim iy1optemicil(  rrmxm no0tltn f3ias mDrlumpnu) rxrif iydfm rlueo t)t2uo(r3io1altnmfciasfa2tr(r nt1aleomo3iltlsDeanvpnt0alerifciadom e nei s  2umxr3nudope lictasfsruaxmo;t0texo ociys s rmnvpn() lxoir oa1optrln ils)tetrxo oodameemnctasfsDtax oou1tlx ifeildfs eau snt4aexoxo iydfmDrlnvo;s0texriopoo1ale mfvilsfa2um(  oo0aet iieias sDumu p (0 rxrmf3totfmD  iei;()seumxopiydal  lnvtlt aDrr(mp;t1altn o3ilsfm2eluvonu)teeomfcoadlm  lnei;t0seumxr3nu1lltnlfcias)srtmu p;o1aexoioeildlsDelums u0tltomo iatom elueils trtrxr oudoltn ieia()aDrmx  ;t4alxnmoeilsfs2elnvsnu0 rtrmociotlpDrauvsls  ruoir3nodlmeemfesat a2ra( pnt1aleoifciydfm ea( snu)aetoxociadlmtr u sls0tetrimpno1lle mietas)srurur ;t0ale  f3iys m2elnmp t4trtnxf3oa1lat au sls0truo(r3oo4op   ivsatfs2umu p;t4opxnii3tlslm2rauvsnu)alerxf ootfm e ieo;t) rxr(r oo4oleemfei sfsDtr(  ot4olxo o3iadlmDuau s;u)tleoxociytoate u i s)trtmimpoo1opt  nvsas)srum( onu1tlx mfciadlm2rlu p;u4aetnxo iytoptrai i;(  exmxo3oodopte ivsa()a2uaumo;o1ope mf3tydls2ranvonu4trxomf iytlptrluei t  rtr(m3iu1lmen fcta(f 2taxroot4tlenmictas s2ua(vo u)artrmo oadomt au s s0 exrxopno1lltn icsat aDrmumo;u1optomo3iat s2ul(ms u4 lxoxo3tydlpD anei t0teuoio iy4open fvs t aDraump;t4apto i3iyd mDeauvo;(4artrxf3todlp elnei s0 rtmio3oo4oltemfctl()srumumpou4tee io3tls s2rm(msnu)trermfctotlp e n s s trtoxr3iy1apt  iei t) rtaxronu0aet  fciyt m2elu o;(0 rtnif to1fm  lnvil(  etmir3no1ol  mivt t)srtmxrpnt4opxnio3iatfmDumu o (0trtomf oa1oaDeluvo;( trurimpnudol n nvias a2raurpno1altomo3iltls2emn pn(0 lenmfcta1fa rluvil( trum(r3iodal emnei t aDraumonu4oee  fctlt mDemn p;t)tltoxfctodlmt  i il(0trumim3oy1alen fcilt)artrx onu1ape ioeiatla2ea(mp u4teerifciadfa  ln i;s sexm(m3nu4amen fvtlt)sDrr(mpnt4apeomietyd s ulumo;(4alenio tytop  aivslt0trxmxmpiu4op  lnvia(faDraxrono1aet  ieiasfs uaums u4tetnxo3iadfaDrlivs;() 2xmxr3io1alenlncs s)arur(rpno0oleomoeiasls2um(von(0 eenio3totlate ieslt0teum(r nu4lmte netat srta(r nu1tetnmoetlt mDra(vp;u) lerifcoy1opDr i i s0 rtmxo3oodomtn feta(  ruaxm ot0tpt ioeils a2ra(vs;t)trtnmrctytom  lueolt0 2trir3io4ol e nci tf rrm(moou1aleomociat m ul( s;u4tltrirctatfmt li o (  2xrirpny1olt lfei (faDurx  ;o1aptniocils m2ran p;t4 lxrif3to1oaD anesls teuoir nu1am   ict s  rrrxr ;o1optomf3ild m ea(ms (4tltomr3oy1lm   ivo;(0 2xo(r3io1omtn ncs ()a2trur ou0aptoiieiad s2rm(vo;t)tetnxfciatfmDranvs t t2urxmpnudlpee ics tfarra(mont1opxniociydla2umn p (0trxoifcta1fpDrauei;s) eur(mpnu4apt  fcta() 2ur( pnu1aee  ieilsfsDeaums t) eenmr3totfpt  n sl( srtmxo3ny1ale mfvils)sDurx  oo0opt iociyd sDul( s;u)tetrxf iy1oaD  nei t) rtrio io1opeemfet s)aDumx p;t0alenioeilt m ean s u0 eeoif3iodfmt  iei s  2xmxo3nydolen nct tfaDrmu ono4apto feiyt a ulumo t)tlermo iytlatrlivo;t0 eum(m3io1ope lneta(  Dtrx  ;u0aetomi3tasfs rm( snt4tleoif todlmteaues;t sexmxo3iodomt  icsa()a2urumono1oetn fciadfa rlu s;t0aetnif ta1oa raueils)s2toim ou1ap   fctltfa2taur nu0aeto o3iltlm2rm(vp;(0texoxr3io1faD  u s;s s2trxr3iudlmeemncsat)srumxrp;u4opxnioeiyd a uanvs () exnif3oa1lm rlnes;t)s2trir no4opee nct s)a2ua(ront0tlx moeiysla rluvo u)trxomr3iy1oatrlnvols)seum(rpoudoltnlfcs s)arrru ooo0tlxnmoeiysfaDrmn pnt4arerir oy1lmD luesls0 exoxo3iodame  icil(  rtaur ;u1tpt mi3ilt mDranvo ()aetrmr iytom  aueils) 2ur(o3io4lm elfvs (f rtr(root1alxn o3iat sDem( s;t)tltrif tytlmte uvilt sexoirpno1ol nlnesatf Dtm(r nt4openmf3iltlm2rl( snu0tltomo ta1laDr i o;t t2tm(mpnu4llt  nes t srtmxm ;u4texoioctas sDrm( s;t0tetnxr io1latr ieo;s)setoimpnu4ope lfcsa()srrmuro;u1oetnmociadls emn pnt)aetrmr iy1fa raues t  rtoxo3nu1lmenlnctls) rtaxro;t1texnmicilt m rmums u4 lenxo totfp r nvsl() rur(o3iodlm n ies s) rrmxrp;t1tptniicilsfa uaums (4tetrmr ootfm rli ols0 rur(rpnodlpenlneia() Duaxr ;o4aeeo ietyt sDeauvon() lerif3ty1om elu sl() rurxopiydopen fvs ( srrr(mpoo0tpe mf3iad mDrm(mp;()trtoif3tatoat ai olt0t2umim ny1alte ncilsfsrum(rp;o1ope  f3tad mDum(ms t4 lxnmo3todfp rauvi t)t2triopny1lleemncsl(fsDrm(mp;u1aeeoii3iydlaDrmnmpnt)trxnxr3tytfp rai slt)s2trxopiydal nlncsa(fa2ra( pnt0aet mociad sDumn snu0 lxrifcty1fmDr i il(  rumxmpno4omenmnei t a2rau  ;u1aexnifciat a rlu on() rtrxf3iy1la raueilt s2tm(m3iu1am  mfetltfa2rm( o;u0tlto fcils m2eaums t4tleoif3tydomD an i ()t2xr(mpou4apeelneiltfartrurp;u0oexomoeiadlm rmu pnu0tlxnxr io1faDr n o;t)srxm(rpoy4lmte fct ( s2ra( ont4olxniocilt s2umnvp u4aleoxocia1lmteln s;(0trumxmpoydape lnciat)a2urxro;o4apen o3tas s uau s t)aetnxf iatfp r uei t sexm(o3iodlp   fvsl()s2ua(m oo4aptniietys sDul( o (4trtrmfctytfptean i s srxr(opiydlleemfeilt sDrm(  ;o0oexoiociat a rm( o;u)trtnxo totlpte nvi t0trurim3oodam nmnvtl(  2tmxmoou1olto o3iatlm ua(msnu)trxnxr iatlaD ln o;s)srtrimpiy4lmtn fci sf rta(m no1oex mfetas mDulnvo;t0trxrxr to1la e iei;t0srtrimpnydlme  ici s)aDrrx  nt0ope ifetydlsDumnvsnt0tetoxr3ty1omt aueo;( srtmxrpnodolen iet tf rra(r ;u4aet ifeiyd s eau o;(0aexrxf3iatom   u o;s)t2uoir3nydap   ictat aDrm( p;u0opt ii3iad m2rl(mo t0alxoxociotfpD  ues s  rumxm3iydoltnlncia( arum(m ot4apx  o3tytlsDeanvp;()teeoxf iydfm rlivils t2xoimpio4altelnet tf rtau  ot0opx mi3iys m2ranvsn(4trenmo3to1lmDe ivil(  exm(m nodapt livsa( arrm(rono0oexnmoeiltls2rmump;() reoif ia1opt lues;()t2xoxr oudape livia(fs2rmx  nt1tleomoeiadlm2umuvon()teeomfcoadoat lneol(  rtoxr3oy1lleelivias)s2uaum ;t4ope  feiasla eanmp u0 eenif oodlmtelivils s2toir no1lmtn ivtl(fs2uru  ;u4olxnmiciydfm umnmp () lxrxr iotlmteau il() etmimpio4al  mfvia()srta(m oo4tee mo3tydfa2ra(vo (0 rerxrcio1lpDr i o s  rtoim3nu4om nlfes () 2ur(m ;u4oet  ocilt sDemuvo;t) rxnio3tydoaDrauvsls teurio3iu1omeelfetls  rrrxronu4oet  fciasfs2emu pnt)artnmo iadlmDraies;s t2xmirpnu1omtnlnesl( arum(m no4tleo fctad m emuvo;t4 lenxo oadoptelivi t sexoxr3ny4opte ivtasf 2ua(rono1tpe mieiys aDem( on(4teenifcia1oat  ivi s)t2uo(r iydlme mnesltf Drau onu1olx iieiltfm2eauvsnt0 lermo3iytfa  aneil(  2xrxr iu1ol nlfvt tfsDrmx pno4optoioctadfm2eauvs;t) exoifcio1lat an ilt0s2xoxmpoy4om  lnei (fa2uaum oo4oex  ieiad mDum( s ()artnifcoodoa  luvi;()t2tm(mpnu4lpenlicta()aDtaumoou4tex mo3iydfaDranvo;() lxrif ootfmDeai s t sexoxm3iu1aleelnvilt sDumxr oo0alt  f3iltfaDulu s (0trxnir3oy1oat lnvs t t2tmimpoy4ll  mfcsl(  2tmx ono4oexn f3ilslsDuanmpnt)trxnmo tydoa rlueslt0srto(m io4ameemnetlt srtmurooo1olenifciadfs2emump;(4aeeoif iodfmt livi;(0t2tmxo3oydll elivs tf rtaxm ;u1aleomiciydla rln pnt4aexrxf3oatla e u s s0 rxmio no4ol nmnet ( s2raumpno0alenmf3tys aDra(mo;u4teenir tadlm  li ol(  etr(m3oudlltn nvias)a2tmu  nu1tpe iietltlm ua( o;u)trxnmocoatfpD  ivi;() rtmim oo4lleemiesls) 2rrxr ot1tetoifeiltfs um(mp (4artoiociodlmD au sl(0t2tmxm3oo4ll nlfvtatf Dra( pou0tpt mfcilslm2rm(mo (0 eermf3oadopDeau s;t0t2xmirpiydlmte fcils)sDrm(mpoo1oexn f3tydlmDul(msnt4 rtoiociodlpt li o t0texmirpoy1optnlnvslsf rrm(rpot0texomfctysla2um(mon(0tltrmr iatlpteliei;t  eum(o ny4opt mics t) 2tmxm no4opxn i3iysfm ulu o;u0altrmfciytop r uei t t2xrxm nu1al  mietatf 2tmu  ;u4tptn oeiltlaDelu s t4tltoio tydla  lieolt)trxo(o oo1am e feslsfsDur( o;u0opt ifcildfs2rlnvo () ltrmf oatlm   ieil(0trxmim3oydlm nlfcsl(  2rm( p;o4tex  oeiys m eau p (4alxrxf iytlpDe u ols) rum(rpio1ol e netat) 2ta(m nu1ape  ieiydfmDemnvo u)aexnxocta1opt  nesl() etriopno4olt lnciasfsrta( o;t4teeo fetytlm2rlums u0arenio oadfate ies;t0sruoir3ny1ap  miciatf Drrxr ;t4tpxnmo3tyd aDua( p;t4trtnxr3oo1fa  anei s s2tmir oy4alt  ici ( s2rmurpnu0alt  iciasfm rm( s;u0 exomrcia1oa r n s;(0 2tmxm3oudaltnlneilt arua( onu4oetomo3tatfa2eaumo u4trxrmr tydopDe uvs;s0tetm(opoodlpen fvs t  rrrxrooo0alen i3ias s2umuvsnu4trtnmr oatom rau slt)setrimpny1alenlieia( sruru oou0tltomfeiys m eanmpnu) ltoxo3oadopDelieo t  rur(m3ou4ape livsatfaDrau oot1tlxo fcildlaDemnmp;(4tleomo3tydlaD ai o;s)seumxopiydal   nvs t s2taumpou0aex if3iad mDrl(vo u0 lenxo3ty1fptelies ()srtr(mpio4lpenmfctlsfa2um(r ;u4ole  f3iysfaDeanvpnu4 eenir3iadfa rluesls0seumxo3iu1lpe  fcsas s2ta(rpoo1tee mf3ild sDemuvsn(4alxoxocio1faDelnvi;(0seum(m nu1llt micia(  rrmumoou4oleniiciytfmDrlu pnt0 ltoiocty1lpt  uvsl(  etoxmpoo4ol n ici tf ruaxmo;t0tlt iietltfa2el( sn() reomoctytfm  li s (0s2uoxm3oudomtemfvs () rtrurp;u1teeo iciatfm el(ms u)arerxr3oydlp elnes ()seuoirpiu1am emncils  rrmurp;t1opxnmi3iytls rmuvont0aetnxf iydlmtelnesls0 euoxm iu4aptemnci tfartmumonu1tltn fciys mDeln p u4teeoxr ty1oa ranvsl(0 2trimpnydalenmnct t  2rr(ro;o4oltnmoeiyt mDrmuvo;u4teenio3oy1fa eauvols) exoxo3ny4lmenlfcias)aDtax pou0alxniieiatls ea(vsn(4 renxo3tatlaD auvil( sexoir io1ll emncs t  rra(r nt0oee ifeiltla2uauvo u4 ltrio3iy1oat aiei t t2uo(m3iu1altemictltf rur(  ;o4opx iiciatfs2uaumon(4aexrmrciy1fptelivils)trurxo3no1am  mfcs t) rraum nt1tlxnii3iat a uau p;u4 rxoifcto1op  anvil(0 exr(mpnudlmenlneta(  Drrump;o1ale io3iytls rlu o;t0teenir iydop   u s;s trxrxo iodolen nes s)sruaurpou0ole iiciadfs ua(vs;t0altrmo iotfpt  neo s) 2xrxo3oy4olt lnviltfsDrrxro;t1tltniietysfs2el(vo;t)tetnmrcty1fm elu ils t2toxmpoudaltnlict s)aDrmum ot1altn feiltfm2elnvo u0texoxr3ootlatelnei s)srxo(rpoydalt  ivias s2rm(  ;t1opxnmfetat aDum(mpnt4tleoioctatopDeaieol(0texrxrpiudllee fvs t)aDua( oou0opto fctysfaDrlu sn()tlxrmo tadoa  lueo;t srtoxo3oodlpen nvi t  Duaxr oo0aeeomiciat sDrm(mo t)texomo iy1om   ivil( s2umxopno4ale  fesls)sDurxmpot1alxoifeiysla umu s;t0aeenifcta1op rlnvils  exo(mpno1lpenmfvils  Drrur nu0tpx  o3iydfsDra(mon()trerir3ta1lpD  ueo;s0t2urxopnu4ap nmfcsasfsrrm(r oo0oee  ociatfm2ua(vsnu0 eeoif3iatfmDelueolt  rxo(opiudom eliei t)aDrax pot4aptoio3iyslsDrm(vsn()tleoxf3iadlmDr u s s) rxm(rpoo4olt lfeslsf 2trxro;o0opx mfctydfmDean o t4alenxfcoadfp elnvo t) etriopny1am e nvtl(fs2trxronu4apx  ieilslaDea( p;(4 exnxfctatfm e ieslt0srxmir3no4lpenlivilsfsDurxm ;o1oetnmieildlaDranvonu4texnxr3oy1fpDean olt srtmxmpiy1apt  iesas srua(m ;t0aeeomfctasla umuvp;t0tlxoif iadlat an olt0t2trir oo1llenlici t s2urumpoo1aeen o3iatls ranmo;u)alxoxrcto1la r n o;(0t2ur(r3ou4lm  mnesas)sDrmx p;o0oltn f3tas s rmnvp u)tlxoif3iatlatrlnvs t)seurxrpoudom n icils aDrrxrpnu4altn oeilslaDemnvo (4tetrxocoydlp   uei s)trxmxm3nodlpt  ici ()s2rr(r ot1tleomoeiadlsDraump t4tleomrcoadoa e nes s) exrxr3nu4alt lncsl()sDra(  ;t0olt mf3tydfs2el(vp;t4treoxo tadoat anvsl(0 rtm(m io1lp   fcsls  Drruroot1tptniietltfa2ua(ms t0aetnif ta1oa   uvi;(  rxrxm3io1llenmfesas arum(rp;u4optoiictat aDrln p;(0arenir oadla eln slt0truoimpnu1om emfvs t s2rrur no4tltoii3iatlaDrmnmp;u4texrxrcoy1lptr n s (0s2umirpiy1lmtnlncsatf 2tr(  nt0aex ifetytfs2um( o;(4areomf iydoa  ai s s0s2tm(mpnu4lleemfvi (fs2tax ont0oee ii3tldlsDum( o (4 etnio oadfatr ueolt)t2xm(r3nodapee nei ( aDrm( pou1tet mictltlsDrlu o;(0 etoxo3iytfmD ai sls)srxr(r3iudal n nctasfa2ta(  nu4oleoiiciatla2ea( s ()aetnmfctodfat au s s0 rurxm iu1omtnmivsls) 2trumpnu0alxomo3iys s uan s (4 leoxr oytlpt ln ilt0 etmiopno1lpt  fei s srum(mpoo1tlxn octldlm2ea(msnu4aexnxrcta1fpDeaivo;( t2tmimpno1amenmfes t sDrrx pot1aee mictat sDuaumo t) rtoxf oytfm  luvs ()s2xm(m3iy4lm nlivtltfaDtrxm nt4aetoioetls aDumuvon(4tlxrmo3oo1omteaieilt srurxrpiudol   fvs t)sruaump;u0opeomi3ild a2eln p t) rxoio3ootlmtrln ilt) 2xoirpno4lm emncsa( a2rr(rpot4tleomociadlm2umuvsnt) eerxr oadlat  ivilt0t2umio3ou1om elfctlsf rrr( o;t0olxnioetltlsDemn s t4arenif3iotomDean ol()trxoirpiudoltnmivils a2tru pno0ale mieiadlm2emnmp t) rtnmr3ty1lmtelnesls) rtmxr3ou4lm e ietlt)s2rrumonu0apen i3ildfm el( p t0 rtrif iy1opteaivi;s)s2xr(m3iy1op elivsat srtaxroot4opxnmi3iltlm2ul( o;(0trerxr3tytfpteanvo;s0srtoxrpoydlm elnci sfs2ur(roou4apeniietld m2rln o;u4aetnxfcoytoaDrluesl() eto(mpoydllt lnvs s aDuaxm nu4tptn fctyt m emu o (4 exomr tadoaD  iei;s0 rtr(rpiy4ole  fct t)s2trur ;u4tlx mfciydfsDrln p;u)aeeomo oa1fp  lnvo;t) rur(rpiudaptn net sf 2uaxrp;o4aexomociyslm2rm( o ()tltoifcoytoaDelieils) 2xm(o3oydomtemiciltfarumum ;o4aeeo octldfsDrmn pnt0 lxnxf ootlmD an i s  2xrxrpoodapee ict t  Dua( ooo0aeeomociadfmDemuvo;(0artrmf oodlm elivs;(0tetriopiu4lp   nctas s2tm(mpnt4tltnmietytfa2el( s t)tltnxocoo1fa elnes t0 exo(o oy4ole  fct ()s2umxro;t4olt  fciltfmDrau onu)arxrmr3iotfatranvs;(0teur(rpiy1omenmivtasfs2urumo;o0opxoiictydls ean o;t4aeeomf3iotfat lnesls0seum(rpio1lmtelnetasf 2rr(ro;u4aexn icilt s elnmont0artoxo3to1op  li i t) exrir ou4apt  fvt tfa2tr(ront1open fciltla rmnvpn()tltrif oodom eaivs (  2to(o iudomeelies t) rtrxmoou0texnmfctydfm2umnvo u) rerxf oatoptrlivo t0 rxr(r3nu1altemneiasfsruau pot0aee  o3ias mDeaumpnu4 reoifctotfaDelivslt0srxr(rpou1oltemfetas  rtaxm nt0teto feiys s2umu o u0trxnxf3iydfmD lu ols  2ur(m oy1ap nlivtat  Dtrx p;u0tpt  o3iltls2el( sn(0 eenmocoodlaD aiei;t0 2tmxr no1ol  lfetlt)a2raxmpoo1tlxomociltla ulnvs () rerir iydlaD li ilt)teur(m3oy1lmt lnvtl(fa2tru o;t1ole iociyt aDra(msnu) rtrmfctodfp r u slt truoir oo4ol  mneiatf 2taum no0apeo ietldfs ra(mpnt4texrio oa1oaD aivil(0trtmxo iu1om   ivtatfs2uax pou4apeo ietlsfs2rlums;() rtrmociy1omDelieo t) 2trimpiu1alenlncs sf rtmxmoot4aeenmfetas a2umnvpn(4 eeomf totomt  nes t0srxo(r iy4lmtnlfeilt  2taumpou0tpen ictyslm uan s u0altrmf3to1lm e nvi;t teum(m3iodoleemnvt t artr( pou0olt  i3iadfsDea( o (4artrmr3iodopDeluvo ( s2xmxmpny1amen feil() Durxm ou0apxnio3tytfsDrlnmo ()trtomf tytom ranei;(0 exmim oodame mnei (fa2trxrpnt0tpenio3iytfmDemn o;u0alenir3oytlmDraieo;t0t2tmiopny1lpe mfes sf rurum nt4apenio3ild sDuaumo u0 lenmrcootlmDe n olt0t2trxr nodaltnmnvsat sDrr(r oo1tpxoioeiyslm2umn s u) leoir3oa1oateln il( srxriopiu4ll nlfeiasfarra(mp;u0tle ifeias sDeln s ()alxrmociotfmDeanei;t0 etmimpiydamenmfctasf rrmump;o0tltn i3iyd a ra(vp u4aeeniocoytfp  lieils0 2xoio oo4lp e feia(  Dra(rpou1aptnifeiydfmDrmnvs u0areomf tytoat lueo;s s2trim3no4olt mfvslsf rrax  oo1teenmociltfa ea( o u0 exoif3tydlp eaivi s)trumxm3oy4lltnlnvilt) rrauronu4opx ifetldla uanvpnt)areoio oydlm e i sl(  2toxo no1ll n nctlt a2ur(  ot0texoiietysfsDrmuvs;t0aexnmf iatoaDran i;s)t2xmxr iu4olt  neils sDuaxmooo0tptniieils s2ran p;u0trtoxf3oo1fpDe n o t setoir3no1amenmieiasfsDtmumpot0oleoiiciad s2eluvo t0tetoif3to1optr ieo t)trtmir3ou4omt mnvs (fs2rm(ro;u4tlxo ieiatla uanmpn() rxrmr oa1lmteliei;s)srtrxr3oodaptelfvtls)aDrrumpou0oltoif3tls sDemnmsnt0texoif ta1oaDr ivilt0 rtm(o3nydapen ies sfsDta(m ot4tex iiciad m2emump t0arxoifcta1la  lues t0s2toir no4apeemfvsl(fartm(mo;t0tltomfeilsfa ul( o;u4 lxomf3iodfpteau i;( setmxm3oydopee ieta(fs2ua( ono4texn i3iys s rlnvpnu4teeomr3tatfaDelnes s tetoxmpiy4ap emiei s a2rr( pot1optnio3ildla2rauvp;(0areomo3io1laDr n ils s2ur(m oudlptn neia(  rur(r ot0optniociatfs rl(vo t4areomo3ty1fpt an o;s)seurxo3oydal   nvtat) 2tr(rp;t4optoioeilt a2em(ms;() ltnxf to1lp rli ilt0tetrimpoudll  lncs () Durum no0alen o3iasfs2ulnmon(0teeoio oodopte uvilt  rtmxr iy4ll n feslt) Durx p;u0tlxo ieiltlsDrlnmon(4altoxrciotlp ran s;s0seurim iy1lptemnesasf rta(r ;o1oltomo3iltla el(mo;u4altnxrcoa1fm  aneols) 2to(mpnydoptemneiat s2uaxmo;t4tee mocilslmDrlump;u0 lerircoytom r i i;t0srxr(m3ou1aptn fcs t)aDurx  no1alx mfeilsla2eln p;t4tlxrio3oa1fmtraivs t  exmim ou4lpeelnet t)sDta( pou0tlx  o3iadfaDrlnmpn()tleomf3oadlpt lu o;t)sexmim3oodlm  lncs s  2ur(rpnt0apto fetys mDemums u4tetoirciatom  auvs;t trxmirpoodlp e fvilsfsDur(r no4oleo ociatlm el( snt4aeerio3tydomtelueol( s2uoxm oydap  lnetas  Dumx o;u4altnmo3iytls2rau pnu0arenxf iotlmDrluvs;s0setrim no1amen ncs sfs2raxronu1opt  fetydfsDumnmp t0aeeomo3tadoa  au ils)sexrio3oo1lle lneta() Drrxrpnu0tleo ictldfm2umn pnu0 exnxr3ia1op rai s ( srtmir iydalee nesas srtmxr no1apeomfetltfmDel( ont4trxrmfcoadoatrau sls)t2tmxo nudlm nmnet s  rumur nt4oeen ictysfaDea( s (0aetrmf iy1lat  u i ( s2xrxo3ny4am  mnet ( aDraurpou1tpto o3tytfa2ra( ont0aleoiocoadlpt liei (0t2um(o iy1omt  nct s sDtmxroot4oltomo3ilsfsDrmumon(4 rxriocoydlmDe u olt srtrir no4lptnlnci s) Draur nu0tlxnmi3ildfmDean p u) rtoxf iydlmDrlivs;s0teurir oo1lmeelnes (faDuaum nt4open oeiaslaDua(ms;t0aexnmo oydoaDraivs s0s2ur(m ny4om n fetls)sDrr( o;o1oltn feiyt aDrmums;()areomrcoodop  luvs s0 2xoxr ny4al emfei s) rraumono0opx iiciytlsDrlums (0 rxnxfcty1la r ivs;s) etmim iodolt mfcs sfa2ta( oou4aeeo icilt sDea(vs;() rtomr iydop raivils)trxo(r oodole  nctlt)aDuauro;o1oeenmo3ild a rmump;(4 lxnio oadfp r ueo ( srtrxrpoy1lmtnmfvsltf Dtr( ont4tpe moctasls ulu p;(0alxnmfcoytfp rli o (  rxoxopiudlpen iet (f Dtaxm nu0apxnmiciasfm2emnmpnu)teermrctotop r neslt  exmxm iodllte nvi (  2urxmonu0aeeoifeiadlm2rlnvs u0artrmo tatlm eaivs;t)s2umxmpou4lpeemfetl( a2trx p;u4aetomfctasfa2rmnvp;t0altnif3oa1lpt li s () euoxr3iudome mfes s)a2ur(rpnu0opt mieiytlm uanmo;t4arxnir oa1om eln s s)s2trim io4lmtelncils aDrm(m ;u1tpe mietysfa uaumsnt4tlxoxociydomt auvs (0 rxoimpoydop  mfes sfa2tmxrpou4tpenmfctas a2rm(mp t4 eenmr3io1opDraieolt0texrxm3io1lpenlici s)sDtr(m no1olxomo3iltfs2uan snt)aetnxf iy1fp r n o;(  rtoxopoy1olt livils sDur(rp;t0aetomfeiadfa em( s t0treomr iatoaDraneslt)truoxo3oydam  micil(fsrum(r no4oexo f3tls mDumu p;(0trtrxo3iatfmte n s s) rtmxopoudlm emfci t arra(r oo4opt  oeiyt aDulnvonu0 leoxf3totla   i s t)t2tmxopiodal   fvtat)s2ta(mpnu4apenif3ildlsDua( p;(0trtnxo3ia1omt aueo;(0texmio ny4ome lneias)s2rrumono0apeomieilt a elu s;t0tleoxo3todlm elu o;(0seuoxo oydlpenlfvs s  2tmxr ;u0tltomo3ilsfsDeanvo t4texnxo ta1oat an ilt)t2urirpnodol nmiei tf Dtaum nu4oee mfeilsfa el( sn()aexnxr oydlaDe iei;s) exmimpnu1al   fesas aDtaumoou4olx  i3iadfa2ulu snt) renir tytlaDe ieils)t2xoxr3oy4ap nmfetasfaDuax onu4oexoiieiatfa2rm( o;(4 eenif io1lmteaues;t  2trxo iudlm n feil()aruau p;o1tet  f3iydfmDul(mp;t0altnmrcoy1lm  anvslt srurxm nodlm   nes (faDraxroou4aeeomi3tld mDemnms;u0tlxnio3oatfaDr u il()t2uoxm3nudomtn icil(f Drrur oo4apeoifctlt a eau p;t0 lxomoctatlpD aies t0 eumxo3iydoleemfvtas  Durx  nt0texoii3iad s2rl( ont0arxomo iadoaDeau ol() rxmxmpou1lle  iet s  Dumurpoo1oet iocilslmDrluvpnt) lxnxf totfpDrluvi;t)srxoirpno1amtnlfeslt) 2rr(mo;u1teenmoctltfs2emnmon(0altnxo3oadfpDr n o (  rtoir3nu1ll emfei s a2umum ou1tlxomf3iyd s2eanmo (4 exnmr3oy1lat  nes s)teumxopoydopt lncsasfartmxmoou1tetnio3iadfm umnvo;(0aexomf oa1op rlueils0 rurxrpiydalte feia()sDtmxrooo1tle mociytfaDra( p;t0 eeomf3totomteai i;(0sruo(m nydoleelnetls  2ururoot0texomi3tyt sDemn o t)altoir ta1oa r ivsls trxmio3iu1lpeemnci tfaDraxro;u0aeto octldfa2umn snt0 leoxrcoa1om r ies;( seuoim3oudlltnmici ( arrmx pou1aeeo ieildlm rmuvo;t4artomr3iatopDran i t trxrir3io1amtelfeiat sDumxmooo0open iciydfaDrmnvo (4alxrmociodla e nvslt0s2xmim3oo4lp e ietl(fs2ua(r ;u1tleoifciytlaDra(mp t0altoif tatlp e uvo (0 2trxm3nudoptnmietls)sDrr(  ot1oetniieiytlm ranmpnt0 rtnxociytfmt ln o;s  eto(r3ou1am n nci s) Drm(monu4oeenifcilslmDea(vsnt4tlxrmo3tadomtrauvolt)t2xrim no4al nmfvsls)s2rmxrono4olx mfetltfa uaumo;u4tltrif3ta1lmDr ueol(0srxmir io4ol elfcsl(f Durumpnt4aeenio3iydfs2elnvo t0altnxo todomt li il( t2xmim3oo4amtnmicta()a2uru pnu4tpeoiiciltla ea(von(0treoxo3oa1fmDraneslt)s2xm(r iodamt lneilt)aDuaumont4tlxomf3tytfm ra( s u0tltoxf3oy1faD  uvo ()trxoio3io1amen ncsa() 2um(moou0oexo ieiad mDum(mp u0 rtrmoctytlpDr uvils t2umxmpiy4ll  lietasfsrtrxr oo0tet mi3tysla2eau p;()altoir3io1lm rlnes t)trtrxrpiy1opt lnvi ( sDtmu pot0aexn oeilt s2elumpnu0trermf iodopD lieo;s)trxmio oy1omt mics s aDtaxmpou1teenmfetatfa2ran p u0 rxrxrcoydomDe nvo;s  rtr(r nudaltemictat aDrr(rp;o1opeomfctasfs2umnvont0alerxo oo1oa rlu slt texr(m3iu1ap  mnvilsfsrumumooo4tpe iociltfm2ulumon(4tetoxocto1oaDraues (  eurio io1lpt  ivil(fsDrmu oot1oleo ociltlm2rm( sn(0trtrxocty1fatr uvs ( trtr(rpny1am nmnvi (  Duaxmo;o4altoif3iyt m2um( p (0 renxr iatlmDrlnes;(0texm(r nu1omeelivi (fsDtaur ot0ape  fetas mDul( on(0 lxrxfctytoat anvi;( t2umimpnudllte fcsl(fsrtax  ot1texn ieiatfa ua(vp u0texrxf ootlateln il( s2xmio iy4om e fcta(f Durumo;o4tpe ioctldls ulnms u0 lxrxo3oy1lmD  uvol( teto(m3ny1open ivt s)sDrmu poo1aexnmi3ilsla2rl(vp;u4alxnxr tydfp eaneol()t2xrim nu4lpe  nesa( aDrm(rp;o1olt ifcilslsDum(msn(0 lxnmr oytfa rau i;t  rxoiopnodam  mncsatfartm(  ;u4oex moetatlm2uan sn(0 rxnmfciydoa   nvo s s2um(r3nodlm elnes s)sDrrurpno1altn ictatlsDrm(vs;(4alxnmr oydfm eai s s0seuoimpnu1lpte ietltf rur(mo;o1alxn ictysfaDrm(mo;()arerifcoadlpt aivols)s2tr(r iy1apt  fvta()srtru oou4aee iociadlaDeluvp t0alxoio to1latrlivo;()trxoxo no4llenmicils aDtm(  ;u4aeeoioeilsla em( onu) lxriocoydfpt lu o;( trumim3iy4amt licsatfsDua(r ;o0texomfcilslm2uanvp t)arenxfciotlpDrlivi;t)sexmir ny1omenlncta()srrmxrp;u0apeoif3iasla2umnvs;u4 rtrmfctadfa eau s;(0seuoim iodlmenlfvtat)a2trx p;o0tpx micias m emnvs t0 lxomr ootfa  lueo;(  rtr(m oy4altelnvi sfs2rrx  ;o0oleomfeiaslmDemuvo u0arenmr3tadom e neilt  2uoio3nydal nlfeia(f Dra(  nu1oex  i3iatfs2rlumo () exnmo tydom elies;t setmio ny4ap emnvil( arrrxmpno0oet mieiyslaDelnvp;t0trxnxrcia1lmD ai s;t) eur(r3oy4apenmies sfsDurxr ;t0oexn feiat a rln ont) etnir todfpteai s;s0 ruoxr oo1lmtnmfvsasfsDrauroou0olxoioeiydlaDulumpn(0trerxo io1fatrluvils)t2toir ou4lpte fvi s arrr(  nt4teen feiydla2elu sn(0tetoir oatlat luvo () exoir nudll nmfeiltfaDua(m nu1aeenmociyslaDranvo;()arxoxo iotfm ran olt  etoxm nydomee ncsls)a2rauro;t1tlxomictldls raumsnu4 exrmr tydoatraivils)truo(o nu4lm emfet t) ruaxrp;o4tle  feild mDrl(vs;u0 exoio3oy1om e n o s0t2to(m3no1am  mnvsls) Drmxmooo0texo o3iysla2eau o;u0artoif oytoa rlnei;s0 exm(o3oy4open fcsat srtrxr ou0aptnmf3iyd m uln pnt) rerxr3iytomD au s;( srxoio oodlmt  neias)srumump;u1optomfctadfa em(mo;u4tetomocoydoatelivils)srtm(m3ou1ol  mfvs sfaDrrxmpnt4aexn ieias sDua( p;u)texnmfctotlmteaueol(  2xmxrpio4amte ncil()sDtr( pno4tptomfcildlaDuanvpn(4texrxociydfpteai sls)t2xoir nudllenmfet (  2tmum ;o1aptoii3tadfa el( snt) eermr iatfatrlivsl()s2to(o nu4lm e fes (  Dtrxrpoo1olxnmfetyd mDem( on()aeenxo oy1fatr i o;(0t2toxopiu4ame lnvta(f 2um(mpno4tleo iciysls rl(mpn(4 etrmo oy1lpt livs s  etrxo3iy1ol e iviatfsDurx pnu1tlt mo3ias s rmnmo t0 rxnxfcta1lat  uvs;s trtoxmpoodal n fcs () 2ur(  oo4oeeomf3ilslaDeluvo;t)trtrmoctatoa  aivs;() euoxmpiu1alenmfct (farrmum ;u1tet  i3iadfa2emnvp;(4 ltrmo3iotoa eaneo s0 eumxo3oo4apeemfetatfartmu  ;o0oee mi3ildlaDea(vp t0 etoxr3tytfpte n o s0 rtmimpoy1om elfet () rrrxmpnt4opxn ieiatlm ulump;t0tlxnmo oa1lm  anvs t0s2uoirpoo4oltemfetasf rtau poo1olxomoeild m ran snt0trxrmo to1lp eaneo;( tetrxr3oo1lp n nci s a2urump;o4apt  o3iydfa ulu p;t4 lxnxo3oo1om rai o t  2xrir3ny4am nlnvta( aDrauro;t0openiieiat a2um(vo;(0aleomr io1fa rln ols  euoxo3nu1lptnmncs tfs2rmx  no4olxomfeilt s2ulnvsnu4alxrifciodlmD  ivs;s0 2toiopiu4openlnvs t sDrr( o;t4apxomfetasfm2eluvs;t0tetoxf oadfmDrlueo s)srxrxo oy1lme  ncsls)aDtr( pnu0oltnmoeiltla2umums () lxrxf3iodlmD livil(0seur(o iudoleemivsat)sDtax ono4tpe ifciyd sDea( p;u4areomfctydom  lnesl()sexr(rpiy4olee ies t)aDtrxmoou4tltnmf3iysla2um(mp;u4 eeniociytlpDeluvslt0sexmimpoy1ol nlfvia(fsrra(moot1optomfeiat a2rl(mp;u0 eermocoydoaD lies;s) 2tm(r3iodamtemnetls aruaur nu1tet  fetyt aDeanvon() leomr3iatoa rluvi s0 2toxm3ou1lptelfctlsfa2uaurpnu1tpx  oeils aDrau o t4 eeoir io1fmDrai i;t0s2to(r3oodomenlfvsls)a2rmurpot4oeeo f3iatlmDea(mo ()arxriociy1lpD aueil()seurxrpno4ol elnvsl( s2uaum ;u1texoif3tatla2rmuvsnt4texrir ta1fatrli o t0trxr(r3ny1olt mncs tfarum(  nu0altnifetydfm2ua(mo;(4trtoxf tydfateli i;s  exr(o3io1op   nvi s) Dra(  ot4tltnmfetad aDul( ont4tlermf3iotoa  livo;s  2uoimpno4optn ieia(f Dtmxmooo0aeto ociltlsDuauvo u0aetrmoctatom raues s  2tmxrpou1amt  nvs ()sDuaxr ;o1ope mfctldls2em(vs;u) lenio ia1fp r uvs;s0 rtrxm3nydlp  lfvilsfa2ur( p;o1aleo o3tldfsDrluvp () rxoxrcoatlmDrai i (  rxo(rpiu4aptelictasf rrau  nt4ope  octasla2ea(vs t)trxnmr ia1fpDrluvi;( s2toim oy1lltelnvtlsf 2rmumont4olxnmieiad a rauvo;()trtnxfcoytom elnvs;t0 rxoxr nu4llenlncsls srtaur ;t0aet  fetasfa2el(msnt4teenio3iy1fmt  nvi s0t2xm(mpiu4lp nmnvil(  2tm( pnt4apxo f3ilt sDemumo;(0altrmocoydfm ean s;( s2uo(opiu4apte ncsa(fsDurx  no4oetomfeild sDel( p;(4 leomocoadla elnei;t s2xr(r3iu1optnlfvslt aDtmxmpot4teen iciasls el( p (4altoifciatfpDeauvi;s) rumir3oydomtelfcsatfsrumu o;t0texo f3ilt mDeluvsnu) lerxr oodoaDe nvo;t sexrir ny4lpen nvs tfsDrau  oo4oltoif3ilsla elump (0 lxnmo oo1lmDe n o;t0 2uoir iodoltemfetlsfsrurxmp;t0texoifeilsfmDumnvo u4 lxoio3oa1fmDrli i;()trtmxr3iu1lmte ncsat sDrrx p;t4texn fctydlmDel( pn(0tleoxr3oo1omDrlivi;t0s2xo(m ny4lpe  fvt sfaDra(mpnt4ole io3ildfm elnmpnt)altnxf oy1oaD ln o;s) etrimpny4amt mfciat srumurpou4tlt mociyt sDuan s (0 rxrif3tytfp  au ilt) eumio3ny4ll nmicil() Durx  nu0aexoii3iaslm umn o;u4aetrio3iadlmte ivi ()truoio io1altemicsasfsDrrx pou4aet mf3tas sDumn p;t0texnirctytfaDe iesls s2xmio nu4amt lncslt aDra(mp;o1olt if3iat a2ua(vonu4aexomfcoytopD  nvo;t)seurxopny4oleemivsl(  2umx p;t4apxniocildfs2ranvp t4aexnmf iatom rluesl( teum(m3oo1apt livsas s2uaum ;o0olen ociltfm2ua( pnu) exrxfcta1lmDe n s s  exrio3oodolt livt s)sDurx p;t1aee  ocilt s ea(vp;t0alenmf oadopDrlnvi;(0s2urxo3no4om  mies (f 2rmx  ;t1tpxnmfcilsla umnmo;t4areomo iytlaD lneslt0trurio3nydomt  nvtlt)arrmx poo0olto o3iytfs raums;u4arxrxf io1fm  lueolt0t2trxopno4oleemneil() 2tru  ;u1altnmiciad a rmums (0 eerif tydfa  lueo;t  2toim nydlmenmfcils srrm(r oo0aetomfetat sDra(vp;t)aetnxocoatopDelies;(0seuoxrpoydlp  mnvia(f rtm(r no0oeeoioetadfmDumuvpn()tlxrxf tatlaD li i;t s2uriopny4oltemfei ()a2rax p;o4alxn o3iysfm raumsnt4altnio3oytlpD aueolt0srurirpno4ame mivil() rtrxrp;t1alxo feiydfm ul(vs;(0teeoif iodomDraieo;s  rtmxr3iudap  micsas arraur ;t1alxo fetasla rmn o t) rermrctotfm rlueilt)texriopiydopeeliesat)sDrr(r nt4apto o3ild s uan onu)tetnxr3todfmte ues t0sruoir ny1om e fcil( aDtmurpot0oee iictasfm2umuvon(4aetrmrcoadoa r nes (0 ruoxr oodopen nct ()arraumpno4oeeomo3ildla2rm(ms u0arxnio ia1fmt  i i;( t2xmxrpoo1am elfeil( aDta( p;t0oltnif3iyslm2eanvs;u0teeomf iytfpD lnei () 2tr(opio4lp nlictat aDtax o;u1aee  fctatfa umumon(0aetnmr oatlp e uvolt  2um(m io4ape  ncs t s2rmu o;t0oet mi3iltfa2elnmo;u)alxnmf ia1om  lueolt t2trir oudalee nesls)s2rrurp;u4oex  icildlmDeanmo;(4alxoircootomtraieo ()s2trir3iu4optnlict (f 2trxr ou4tpx miciys s rl(vp u4teermfcoydomD luvi;s0setmir3oydlp emictl( srua( o;u0alx  f3tysfa ean onu)trtnxocoodop rli o;t)sexm(r iydlptemncsls  Dtmu  nt4tpeoifeilslm ranvs (0altrir3tadfmD aieol() rurim3ny1lm elnvtasfs2rmump;t1opxnmoeiytfa2uanmp;u4 rerif oytomDeli s (0 2xoxrpiydllt mfvt t) 2rmum nu0olen ociasfmDra(mo;t0 lenio3iatoaDr nes t  rtmir nu1op emfes t)srrmur no1oet moeiyd aDuau pn(4aexrxo todfm  luvi () rxo(o iu1lmenmicsas sDua(ro;o4olxniietad m ran pnt) eermr oy1opt lueils s2xo(r3nydapte netat)arrrxmp;u4tet mfetyd aDumu s u)trxoxo oytom e nvo;t) etoxm3iu4lmenmncs s arrrumpot0texoiiciydlm2uanmp;()aexoioctadomtelneo t)trtr(o3iudlpt  fcsls)sDtaum oo0olxo octyt sDrl(vo;(0tlenio tadfate uvil()teurxm3oy1openlnct (faruaxmp;u0apxn oeiys s rlu pnu)tlxnir ta1omtrlu sl()srto(opiu4am nlncsl( srta( o;u0opxn fetyslmDumumo;(0alxrmrciatfpDe ueo;() rxoxr3oo1llen fvs t) rtmx pno0texn i3ilsfs um( p (0 rxoxf3tatom  lieo t0srtmio oydale mfvt t sDumx  no0tet iiciydfsDea(mp t0alxoif iodlp elnvo;s0tetoxr3oo1omeemfcils) 2rmxm ;t1tpxomoctlsfa2eanmpnt0aeeoxociy1lptran i s srtrxrpno1oltelfvt s  Draxrpot4tltoioctldfm elnvo;() etnxocoytlm rlivils srtmxmpny4ll nmnctat)sDtmumo;t0olen ietadfmDem(vont4 leoxr3to1lmDr ies s) etmir3ny1opt lfetat)artm(mp;u0oetoifciydfs2uanmsn()tleriocootlmteln i;s0seto(m ny4omenlnctls)artr(mp;o1altomietltlm2um( s;u)alxoir ootlmt luvo;( srxo(mpoy4lm n net s  2tmx o;t0texoiietys aDuanmsn()trtnxrcoadlp eaueils0trumxo3no4open feilsfaDtr(monu1tle iictasfm umu o t4 lxrio iadoat anvilt s2tmio3ny4amtn icsas s2urum ot4oeeo feiytfs2rlu o;t0artrmf oodlpte u ils sexriopou4ope lnesa(f Dtmxr ;t4opt ioctydla2elu s t0arxrmf oy1oaDraieo;t s2xo(mpiu1aleelnetatf 2trur no4optnmo3tad a2ra( p;(4texomf3iy1lpDrai o;s0trxrxr oy4lmt  iviat  rrmx  oo4aleoifctasfm em( o;u) renxo iadfa  lues () rxo(opiu4om e feiasfs2tru  oo4tpen ocildfsDuln s u4aetoxf3ia1oaD aueo ( srtoimpiu4am e ivtl(  rur(  ;t4alxomi3tldfmDrlu s t)teerxf3iatoaD lneo s  2xm(m3iy4apte nes s  Durx  nu0tlxniieiysfsDrmumo;u4 exrifcoy1om  ai i;t s2uoxmpiodaltnmicta() rraumono4teeomociyd m2rmn p t0 eenxf oo1fpDelies t)truriopoo1lp elicils a2trumpnt4tpx  fctys a rln s u) rtoif3totop rln o;t t2to(o nu1olenmnciat)sDum(rpoo0aeenmoeiys aDrmn p (4trxomr oytfaD lieo s0 rtrimpiodlpeemneta(f 2rax onu1tpen fctlslm2rmumpn(4 rxnxr oadlaD aneo (0trxoxo3iy4ale mncsls aDta(rp;o1tltn oeiyt a rmuvon(4trtoio3oydfpDe ies;() ruoxopnudlm  mfei t)srtaumpot0teto ieiatfs2el( o t0texomo iotlp   ivs;s)sexmxr3nu4ale  net s arrax onu4tpxniiciydlaDemu on(4tlenmr3totlaD  nvi;s0sexoio3nu1lm nmfvt t)srtmx  ;t4aetn ieiyd a2ul(von(4trenxoctadomtraieo;t) 2umxmpoydamtnlnvs s)sDur( p;o0tet mfciadfs raums;(4tltoirciatfpDrlies t) 2tmim oydop  liesasfs2ta(rpnu1ale moeildfs uln p;u4 lermr3tytomte iesl(  2xoxm oo1omtelivs t) 2rr(  ;o0tltomf3ildls ra( o (0artnmfcta1fp eluvolt) rurxrpiu1lp nmnci ( srtmxro;o1aleomoeiadlmDrl( o;u4 rermfciydfaDr ieo s) 2trxrpno1ale  nct (fsDtm(mo;u4alt mfcilt m emumsn(4tetoxr3oodlaDeanei t)s2xmxr nudolenmfvia(fsDua(ronu0alto fetatlsDrau o t)tetnmoctadfpD lnvs;s0t2xoiopou4apee fvia(  2ua(mont0olxn oeiyd s2umn p t0 etomo oodoptrlieils) etrim3iu4al nlnvta( s2ururo;t1oee mi3iatfa2rlump;()arxnxo3tydlm r neo ( trurxr oudamenmfeils) Dtrurpou4texniiciys a rmnms u4 reomrctydlpDrau slt) rto(m3nudlptemnvslsf 2rm(  ot4optoifcildfa elnmon(4aleoxo iy1oa   ueo s t2xrxm io4am  lfvi t)s2rrum nu1tlx iieiasfaDrln s;u0arxnmf3ta1fmDe ieo;( trxo(o iu1ap nmiet (fsrtau ono0olxoioctatfs2rluvp ()teeoxrciytfmDrln ils)srtrxo oy4al elici t  Drax ont4aptn f3iys m2ulnmp;()altniociydfp rlnvo;s0t2toim3ny4op n fcils srrmur oo0tleniiciytfs eanvo t4 eeoxf3tytlat  ivo;t0srtmimpoodlp elnvsasfs2um(  ;o1apeo iciydlmDuan o u)tetnmf3tatoaDelieol( srtrir3io1lp n nvsa(f rraxro;u0apx mi3iltlm eanmsnu0 rxoxr3to1fmD luei s  exriopoo1lp nlicsl()s2ra(r ;u0alxnmi3tydla ean p u)altomfctadop  lu o;t teumxo3no4omee netlsf 2raxm ;o0optnmfctysls2umn pn(0arxoifctotoat lieslt) 2toxrpnodamte ictat)s2umxmo;o1tlenmfciasfa ul(vo;(4trtrmrciytfp  lieslt) 2urirpnudopte nctlsfarrm( onu4olx moeiltfa2ul(mpnt4aexoxo oydfpDr nei ( texr(o3iy1lmte neslsfs2umuroou0tltnmoeiatlaDea(mp;(0 eenxfctadopDeauvs ( setmir io4apenmfetlt a2ta(  nt1oltoif3iatfsDeluvs t4alxoxfciydfaDr nvslt sruoxm nydope lfesls)arrmur nu4apxoiictasfs2el(mp ()tltrif3oa1opt  uei s  exoimpiydoptemnvsl(farrrur ot1tleo f3tltla elnvsnt)tlxnio oytfm   i o;()setmxm3ny1optelfet () rraxr ;t1opt io3iyt s elnmp;u0altomf io1lm rauvi;s)t2urir3no1ol nmfci ( a2rmxrpnu4alt ifeiydlaDuanmo;t) lermrciodfpDe nes;( srxrirpnodope mfvtl(fa2rm( ont0apx ii3ilsla ulumpn(0teeoir oatlpDrliei (0trum(o3oy1apt mfesatfa2um(mpnt0aetniieiatfa2ulumpn(4 ltrir3oytomtrli ils) etm(opiy4op nlncsatf rurxrpno4olxnif3iyt mDrmuvp;(0tltnmrctytfa rauvo t) 2umim io1op   ietl()s2ra(rp;t0optomo3tysla2emnmo;(0tlxoxrcoadla e uvols)tetmxm oo4lmtelnet ()a2tmxr ot4alx  oeilslmDeauvp u)aetomo3todla  aneo;t trtoxr iudaltnmieta(f Durx o;t0tet if3tatlm rlu s;u0 rtoif3todlp rlneslt)s2tm(mpoodamt mfvia() Dtm(ro;t0oltoii3iydlm elnmo;t0aetrxo3io1fpD  uei s  euo(o oo4lmtemivs t)sDtr(rpoo4aexnio3iatfs2ra(vs t0trerio3ta1fpDelnvi t s2xoir oo1llt  fetl(fa2rr(rono4tpen fciadlm em(vs t0 lenxo3oydfp   ueil( t2trir3oo4ll nlneiltfsrtr(mpno0tetomoeiydlaDuln o;(4trenif oo1oaDrluvs t0seur(m nydoltemnci s  Dum(mp;o0oet  fetadls2umnvp;u)tetrmr io1lp  livslt0seto(rpoodlle mnetas)sruru ooo4tpt mfctlsfa uanvo u4 exrif iatfmDr ivo s0trtrxo3oo4omenlfviat  Dur(mp;t0oexniieiatls rl(vonu0altrxo3tytlp eln i (0srtoiopno1lp emfctatf rumu  nu1tpx io3tls s eauvo;() lxrmr oo1opte uei s  2ur(m oodlp   neta(faDtruro;t4tltnio3iydls2um( s u) leomr3oydfaDeai ol( srtrim nydlmt lieta( s2ta(r no0olx  iciysla2rl(vs;t0trtrio3ia1fa raivsls)seum(r3io4aptn ncs sf 2uru  ou0tpe mf3taslsDuaumsnu)tltnxrcoytla ean s t  etoxmpou1llee fci sfs2ua(rpou0alxomfeiatfaDum(vs ()tleoxocoo1fa rau s;s)seumimpiu1om emfviat  Dtax  oo0oeeoifcildlsDulnmo;t0alxrxo iodfpteaneslt) exr(r3iydllt lfci t) 2raxrpoo1alen ietlsfm2elnmo (0trtomr totlaDr uei (  etoiopiodal  mnet s)a2umx  no4texo ieildfa ua( pn(4 rxoio oatlpt  nvs ( srtr(o no1om e iei (f Drm(r ;t0tlx  i3ilslsDrln o u0tetrmf tytoptelnei (  2toio3no1lltelicslt)a2rmurpou1tet iietat a ulnms t4tlxnxocoatop ranvo;(  exm(r ou4ape mnctl()arrax p;t4apx iieiyd a2ranvo t0teenxf3iatlpte uvil()trumxr3iudamtnlivia()srtax  nt0ope iicildfm2umn s u4trxrmf3iydlmDrluvsls  2trio ny4lpe lict s srumxm ;t4aeen f3iyslm rlumsn()aexrmocoy1laDelnvo s)srur(o no1oleelfes s)a2uaxr oo4aexo ietysfa2ea( pn()tleoxocoy1op  anes;s0s2xoxo ny4alenmnetl(faDuaxro;o0oleoiieiadfsDean snt4aetrxfctodlptrlnvi;t)trtrxr ny1ll emfeslt  rumxmo;u4tpe mocils m2elnvp t4treomr to1lmDranvs t  etr(o io1ll e fci (f rua( pot4oeeoiiciytls2umnvp t0treoxf3iytfmDr ueslt0t2xr(rpoudaltn ici (fsrrau pot4apx  o3iltla2ra(msnt)altnif3tydoa raivo;s0 rtm(o3oudamtn iesltfaDuaxrpno0opxniietldfm2emnmont0 rerxociytfptrlu ils srxo(o oy4lm  lnvias arumx ono0apen f3tyd m2uln o;t4 rxrmo3oydfm rlueols) ruo(o iudom nlictls)aDra(mpno1olxnmfeiytlm rmn s;u0 reoir3io1la elivs;(0tetrxm3nudlpt lfei (fsDrrumpoo0aptnifctldlsDrm( o;u4aeenmf3totla   nvs s0 2xmxrpno1ap nlnvt t)a2rrurono0ape moeiasls2ulnmo u)aeeoio3oytlatelnes;()srxrxm no4al emncil( srurxmonu4tpxn iciat m rm(mp;u0 rtomr3iytoatr i o;s0 ruo(m3ny4am nlfctl()sDta( p;t1alenifeiltfm uaums u)aeeoio ia1faDr neols0trxrxrpiydlle  fetl(  Dum(mp;o4alx if3iysfa ul(vs;()texnmrcia1om elues;t trxm(o iu1ale  nesat)a2ur(rpoo1tex  icils a uauvp u0 ltoiocoadlmDe uvs s)t2trir iu1llee fci (fsDrau oot0olxo fciyd mDum( s;()aeeoxf iotlpDelnvs;(0 eumxopoo1apenmictltfa2rmxm oo1tlx moeiadfs2uan p (4 etrxf oadlmteau ils s2umir oy4oltnmfvs sfa2tm(r nu1alx  o3ilsfsDeln pnu0areoiociodfm e ivo;t)tetr(rpiydlp e ici ( sDrr(ro;u0tpxnmicilslaDrl(vo;(4tlxrmr3iy1faDrlnvsl( seuoxrpnu4altemncsas  2trum oo0olenmi3iytlsDemuvs u) rerxr iodoa r uvi ()setm(o iudlpen ncia() 2tmur ;o0opt  o3tasfs2umu pn(0arxnmr3oa1fpDe ivo;s s2uoxrpnu1optemiviat arurxronu4tpto fciytlm el( s ()alxriocoytfmDeaueo s srxmirpiodomeemict (  2uaxmpnt0tee io3iadfm2umnmo (0tetnxr ia1omD luvs;t) 2um(r3oydllen fciatf Dtaxmpno1alxo i3tysfs2emu p;u)tltoxo ta1fpt  n i;s seumxrpiy1ap  livt s)s2rau onu1texnmfeiytlaDrmn s u)aleomf oydlaDr ieils)trur(o3io4lmte ivtas) Dtaumo;u1texoio3ils mDuan snu4arxrircoadfate uvsls0 rurxr3nydolte ivi ( arumxm ot1tlto f3iytfs emuvp (4 exoifcoadlateliei s0 2tm(o3oo4omeemfci s) rumxmonu1aetn ieias m ulnmsnt0tltrxfctotlm e ivo s sexrio3iodapt mfct sfa2tau  no1alx  ieiltlsDra( s t0 etoio oydfm e u s t)s2xm(o ou4llt lncs t)sDrm( pnu1ole mieiatlsDean s;(0 eeoio3iytla raies;( texrimpou4omt  ncsltfarua(rpnu0tptnio3tad m2umu snu0tltoir3io1om rlues;()teumim ou1lm n ivi (  Dtauro;t1ale  oeiydfs2rmnms u4aeerxr iadfpDe nvsl(0 exrxo iydlpt  ivslsf Duax pnu4aptnifciatla2ea( p t4trenmo totomtrlies t)s2xr(o3oy4omtnmfcta(fsDum( poo1olenmf3ils a ra(vpnt0arxnmf io1oaDrlueils  rtoxrpoy1opt  fes tfsDumxm nt4aex moeiytfsDeanmo;(0 eenir3oo1om eaieil( t2um(r3iy1al  mieiltfa2trumono4aptoii3iasla2elump u0 rerxfcoodlmD  i ols srumxo nu1ll nmict (fsDtmu pnu1tle ioctas s uln s t0 ltrir ty1lmDr ieo s srtr(m oo4lmtelfvi t  Dtm(mp;o4aleomf3tldfsDemnvpn() rxrxo iadfaD au ilt t2uoxm ou1amtelnes tfaDtrxmpnt1opxomo3iasls2rm( o (4 rxnxrcia1om r nei (  exoxr oudom  livsasf rua( p;u0tee io3iatlm2el(mo (0areoir todomDr iesls0srtmio3iy4lmen ncslt  Dtm(m oo4tle mietysfm2rlu s (4 eeomr3io1latrlu o t0s2xoir no1lp n fvsas aDraxr ;o0tpe ioeiydfaDrmuvs t0 etomo3tadlm r nvs;t  exoir3nudal  lnetltfarraxm ;u4apenmfeilslsDraump;t0trxrxo iadlm   ivo ( s2xoxo oy4omtemfci tfsruaxmpou1olto f3tls m2rl(ms;u4 rtnio io1oateanes;t)trumxm3ny1ll  mfvtasfartaxmooo4tpx  oeiysfa elnvon(0 exoio3iydop   u i ( s2toxm no1omte ivsa()s2ua(mp;t4tet ioeiadfm2eln o u0tlxoxf3tadlmDr ueo;( srumimpnydome licsat artrumo;u4aexoioctasfmDelu p (0texrmo3ta1fmt lies;t0trumxm3iy1oltnlfct s  2rr( onu0aexo iciytla um(vo t0trxoxocoydfpDeai i t0 eto(m3iu1lle liciatf Drm(mpnu4oleo o3iltla2elnvo;u0 rermr oo1om raivi t)s2xo(r io4apte feil(fa2ra(r ou1alx mfctlsfm2rl(vont4teenxr tydomDrlueo s0 rxo(r3oodlme mfvsls)srrruro;t0tet if3tas m ra(vont0 rtnmocoa1lp eanvslt0texm(mpoy4llenmict t)a2trumonu0apeoifcilt a2ulu s (4aetrxfciodfmDeai s;s) 2xmxopnu1amtelfes t  2tmumpou4tpx ifctltfm umnms t4aleomr oy1fpDelueils  2xoxo3ou1amee nesl( a2rr(moot1olxn o3tatfm rmnvo;u0 ltnxr3iydomD li i (0srtm(o3iy1op  mfvsat) Dtaxmoou4aeto o3iys mDemn s ()altoxrctatfaDraiei ()teuo(m3no4am nlivs sf rururo;t4open i3iasls2uau s u0arxnxr3to1latrauvilt)t2xrim3ou4apt lnciasfa2trxmo;o4teenmoctatlmDemums u4trxrmr oatfa elivs;( trtr(m ou1aptelivtat) rumxmpot4ope miciatlsDum(mo t)arxrmo oodfm eai ilt)t2xmiopny4ope mfesa(  2trur ;o4tpe moetysfm uluvp u)aetnxr3oo1lpD aies;t0trtoxopoy1omt mncs sf rtrx poo1olxn o3iltfm2rl( s u) renifcoytfpt auvi;t)setoxm3nodamt lnvtlsfsrrmuroot4tlt iieias a um( p t4artomo3oodom  livol(0trurio3ou4lpt lnes s)arta(rono0opt mietad aDrl(mp u)aexnifcto1op ran s;(0 rur(opny1ll n iet ( aDrmxmoou4tlenmfeiatls2rau s u0alerirctotfa raivi ()t2toim no4lme  fcsl()s2rrump;t1opeo ictatlmDelu o t) lxomf iytoa elu o;s)sexmimpnodope  neilt  Draum ot0tetn icilslaDuanmp u0treoioctatlaD  uvilt)teurxr3ou1ome  icils) Dtrumpoo4apeomociydlm rl(vs (0altomrcoy1oaD  i ilt0trtoxm iudoltnmfviasfsDtmxmo;u1teeomieiat a umuvp (4teeomf iy1la r n ols0srxmxr oo1lmtemivsas)sDurxrono0apxniiciysla eanmo;t4 etomr3ty1oatraieo;(0srum(o no1ll  micsas  Dtmur ou0tpt ioeiatlaDua( p;t) rxomocoa1faD  nei s) 2ur(o io4ll  mnetlsfarraxr ;t1tpxo fctldfm2rm( snu) exnir3oytfm rai s;(0setr(mpnudale  ncta()a2rm(mo;o1oeeomfeiydlm emuvp;t4 rtnmocty1omDeli o (0srur(o3nu4lpee nct t)aruaxmonu0aet  f3iysla2eanms;t)aetoiociotoat anvi;( teurxm3ou4omeemfviasfartr(ro;o0tpxn ieiasls ua(mpnu0 eermrcta1lpDrauesls texr(m io4lmenmnct ()arraxm nt1opxn feils s el(vs;u)altnxr3tydlmtr ueo () rur(rpnydam nlnctatfarumump;t1oetoii3tydfm2rlnvs t4arxoxo3oatomD lu ol( t2umio iydom n nvtas srtr(  ot4optnio3ild aDrl(vpnt0 eenxf3ia1fpt au olt texoir oo1apt mfeilt  2rru  ;o4apt ifcilt aDumuvs;t4alermociydlp eauesl( trumxr iy4op   fcsat aDtr(ro;t4opx iociydfm ea(ms t0teeoiocoytlpDean sl()setrxr3oy4op n fetlt) ruax pnt0alxomfciat aDrmuvo t0 etrxf io1opDraiei t  exriopoydopt lietlsf Dtaum ;t1oeeomfeilsfsDua(vo;u4tltrxr iytlmt  uvo s0 2urio3oo1ll   fetl( arurxront4alt io3tyslmDul(vo;u)arxnxrcta1fpte i sl(0s2xoimpoy1amtnlnciasfaDrau  oo4tptnifctysfs2ul( s u)alerif tadfpDe i ilt0srxoim3oodom e fet s)sDtrurono4opt  fetyt m ul(ms t)altnmo3ootlmtelu s ( srxrxm ou4ameelicta( aDum(rpou0tlx  oeiad a rlumo;t0altrmfciatoaD lnvs;s0trxr(opoy4ape mncia(fsDurx ont0apx ifeiat aDrmn o;t) lerir3to1lptelneo s0 eto(o3iydll e fctl(f rtaum oo1oexoioctydlaDeanmon(4texoxo3ootoatrlnesl(  2trio nydom  lnviasfaDuaxmonu0olxn i3tadfs ran onu0trtoircty1oaDrlueil(0 rtrio3oodoptelfci (fsDurxro;u0optnmfeiaslsDea(vs;(0 etomo ty1fa eau i s texrio nodoltnlneslsfartr(mp;u1olxoifcias m2el( snu)aexrmr ta1fmDrluvi;s0trxrxm3oy1apeelics ()arumxm ot4optnmiciasfa2rmu s;(4 rtoif to1opt  ueil()s2to(m iydlptemnvil(  Dua(r ou1apxoif3iad sDulump;t)trtrmo iatoaDean o (0trtmxopiy1lle lnvta() 2trxro;t4olxnmieildlmDranmo;t4aexnir3iytfmD ai s;s0trxoimpnu4lmt  ncs s a2rrxrpnt4tltnio3ildfa em( p;u0areoxfciotopt lu ils)seumio3ou4lpt  nviatf 2rrxrp;o1tpenmf3tld s ua(ms u4 lerxo tatfptraiei () 2xoxm3no4opt  ivsltfa2tmxr ou0tltnmoeiytfsDrm(vo;() eeomf oatfp eai sl()t2tmxopiu4lltelnvsltf Drrumpnu4tet ifeias m rm( pn(0aleoirctodfp  lieols0sexm(opno1lp e ieiasfs2uau oot1olenif3iyslaDuaumpnu0arenmr3iy1latrai i;()texmiopny1am nlfvias  Dum(mont0teeoifetldlsDuln onu) rxomf3to1opD livilt) 2trxrpno4om e nes s)aDumum ;u1tetn fctydlaDean sn(0tlenmfcoatlaD  uesls0srurir3oudole  ivsas aDurxmo;u1opt  fetltfm uanvo t)aetrif3iotopD lneo s teurim no1ome lfvtl( srrau ooo0tetn ieiatfa emnmp u0trtoxocoydlat lu i;s0 2toio oydlme lfcs (f Drr(rpno1opt  octytls rau s;t0trxnmrcoadlpD lnvs;s s2trxopnydape mieia(f rtau  ;u4ale mo3iatfaDum(vs t4 rxnxf oy1la  an i;s)seuoxr3iu1al emicsa( arraumo;u1aetoiietadfsDeau snu0altrirctydlmt luesl(  rtoxmpiydlle  ieslt)a2umumont4tlto o3ilt s2umu o;u0 ltoxr iytfaDrai o;( t2trim3ny4am emnvil(fs2tr(root1altnifciysfm2uln s (4aetnio ootlpD  neo (  exmirpoudaptelivt tfs2ra( p;o0olenioetldfa umumsnt4 rtrif3totoatr u ils)t2tmiopnudlle lictlt  2rmx pou0tpxniieiasla rln pn(4aeenio iotla r u s (  2uoxr ny4lmt lnvsa(  rraur ot0tex  octld s2eaumsnu)aexrmfcoy1opte nvs s srtrxrpiudlme  nctl(  Drmumo;o4oeeoiictld aDumuvp ()tlxoxocio1latrlues;(0 rxrxmpou1al emfcilt)aruaum ot0aet ii3iydlsDrm(mo;u4alerif3tatopteaneo;t)seuoxmpoydll n neia(  rrrurooo1tle ifeiys s2uaums (0 ltoxfctydlpte u sl(0sexr(o3iudlptnmfviatf Dtau p;t1aleoiieild mDumnmp;t) renxociotfaDrlnvilt srtm(rpiu4amt  ncsl(fs2trx pot1tptoiieiytla2umuvp (4teermocootopDelu olt)s2uoiopoo4lpe  fcslsfarua( ono0apt ifetld sDemn snu)aeenio3oadlptrlnes;()seto(r iu1aptemieia(f Drrxmono4oltnio3tyt a2ra(mp ()alxrxf3oatoaDrli ils teumimpoodolen icta() Dtrum oo4aet mi3iydla ul(vs (4aexrir ty1omt  i o s)seuo(o3iy1ole mncsas a2ra(rp;u4aetn feild sDuluvon(4 leoirctydlpt ln i t teto(o3oudap nlics (fsrraxmp;o1apenif3iasfs2uln p t0tltoir3oy1fp elieilt0t2xmiopou4alte fci (fsDur(ro;o0tpeo o3iyt m rln s;t)alenxociy1faDeli o s) 2xmirpoy4ale  ncia()srtru  ;u0apenioctydfs uanvp;u4aeerifciodoptraivi;( t2urio oo4amte nctasfsrtax ont4opx iiciyd s2rln pn() rxnmf3totfat lnvol()tetr(mpnu1lltnlici tf Dra(monu0tle ii3iytfmDumuvp;t4 renif to1oat aivsl( srxoxm oudamt lnesl(fa2rrumpnu1apt mictatfaDrln o (0 eeoxrcoa1lp rlneol(0trxr(r3io1lpenlnct () ruru p;u4tet  o3tltlm2ulumo;(4aexnmo oodlm e ivsl(0texr(mpiydll  mivi (fa2umuro;t0apto iciyt s2ran sn(4aetnir3ty1fa elu s (0 etr(o3ou4lm  lnvt tf Dumumo;o1oetomieiydfs2em(vo;(4arxnxocootfp r ueilt0srxm(r nudop nlics t) rrmu  ;o0apt mfetldfmDeau sn(4artrxocoo1omDrlnvi s)srxrimpiodlle  fvslt)aDtm(mp;o4ale ifcilsla2rlnv
\ No newline at end of file
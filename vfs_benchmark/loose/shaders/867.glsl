@@ -0,0 +1 @@
+neol( s2toxm3iy4lmenmivsas)srtrumpot4oeto oeiysfm um( p t)aleoio iatlp e nvi;s0tetoir nodapee fcsa()aDrrx  no1tpx ioctysls uanvs u0trtrxfcoodla e i i;t trtrxm3oodoptnmicsasf rum(mp;o1tpxo i3iatfa2ranvo;()aexomrciy1om   u il( tetmxo io4altemict ( s2tr(mp;t1tetnmoeiad s2rm( snu)aetrxoctodomtraivols teurxo ny1om e nvtlsfs2uau  ;u4oeeoifciltfa eau p;t) etoifciydlmt auvolt) etrxm nydop e fcsasf Dtr(mono1alt ii3tas mDrlu p (0texoiocoy1opDrlivo;(0tetr(rpio4lptemieiatf rtr(monu1olt mictat a2ran o;(4 eeoircia1fp e u sl( s2xm(r iu4opt mfvsat  rum(rpot0aptomfctltls2ra(vp t0tlerxf iy1opte u s t)s2xmimpiu4opt mfvsl(fs2uaxro;o1apxo feilsls um(vont0teeoxoctydfatrai i;t)t2toiopoodol  mnet () rtau  no1alen octytlsDrluvs;t0 etoir ty1fmtr i olt) rtmxo nydlmtnlnvsl(f rrau  ou1apenmietys sDrmuvon(4artrxfctytfmD  ivs (0 rumimpiu1optemnctls)sDrmxr oo1tpe ioeiatla2ua(vsnu4tltrio tytlpDrai ol(0 rtrim3ny1lmt  fvsa(f rur(rpoo0aleoiieiysfm2raums;(4trtrxf3oy1lmD livi;t0setm(m oo1aptnlfci tf rrru ooo0alt  i3iadfs rmn s;(0altomfcio1lmtelu slt t2xoimpoydaltnlnei tf 2rrx ono1open iciydla2elnvo;()arxnircto1lmD ln o t0 eurxmpio4om elfctat)a2ua(rp;t4teeomociltlm rmuvonu0 etrmf3iydfa  livo s0sruo(o3oodlp nmnvtl(fsrrax p;t0oexn feiasls ean snu4alermr3tydfpDrlivs;s srto(r3iydopenlnei ()artr(rpoo1tleomf3iys a2uln s;u0trtrmr iodlmD lies (0 2xmiopoudllt  ivt t) rtmur ;u4teenif3tltla ranvp;u)aexomf3oatoa e nei;s) exm(m nu1optnlictat)aDum(moou1tetnifciltla2umumo u0 exrmrciotopDrau il(0 etrim3iy1oltelnci t)artmxronu1aex  ieildlsDea( p;() reoircoa1fmDr i ils0 2xmio3oy4ole lfvsltfs2ururp;t0oleo fciysls rmuvs t)aleoircoatopt lnesl()srtr(opno1oleelnvs s s2rmu pou0apt  iciadfm2rl(ms;t4tltnio tatoat an s s0t2ur(rpny4omtelfet ()s2ta( pnt1openmfetad aDem(mo (4aetrmfciotlateluei (0s2umxrpio1am  lnetatf rraxmp;t4tpx  f3ilsla ulnmpn(4alxoxf iatfmDrluvi;t texrxm3ou1ll  lieia() 2umx o;u0tlxoiieiltlmDuanmp;t4aexoif io1op raieslt)sexrxrpoo1op e ivtas)artrurp;u0tltomiciasls2ua(vs u)trtrio io1lp rlues ( t2xrxo3nodal e fviat) 2urxm nu1alt mieildfmDumu p (0 etnircty1fa e nvi ( s2tm(m ny1amtelivs t)aruaxmono1tptoioctys mDuanvs u4 rxnxr tydlp r uvo t s2xrim3iu4am nlnviasfsDtmxrono1tetnmi3iys aDranms;t4alxoxr3todoa r u s;s) eurir3oudlptnlfeils)sDrm(ro;o1oltoif3ildls2ulumo u4texomr iotlmDrluvi;s0s2trio iodope  fvilt)sDur( ont0tlt  f3iatlm rm(ms;(4 lenifciytfp  aivols)teumxopiy4alte ncsas  Dtrur ;u1tptomoeiaslm2ulu snu4tlxrmocio1faDe ieol(0s2xoimpnu4lp n fvt t)a2rm(  oo0tex ii3iyd m2eaumpn() rerio oa1fpDe neils0 etr(m iy1ap e ivtlsf 2rrum ;u1opto f3iysla ra(von()tlxrxoctatfmD lnes t trxrxm3iudll elncsatf 2tm( p;t4tltn o3iltlm umn p;t)trxnxfctodom eauvi;s)seumir3oy1opeelivs ()aDrrxm ;u0aexomoeiytfm rm(mp;t4trtnio ty1fpt li s;(0 2umio no1al   fct s)sDtmxmoou1oetn ociys a eluvs;u0teenioctatomDeluei t) exrir nu1lltemivt ( a2ur(mpno4teeoii3ildlsDea( on(4artomfctotfpte uvol()s2toio3iudoptelnviat) 2rmxr no4ape mf3iatlm2elumon(4aexomoctodlpDranvo ()s2xrim3nu1lp elivtat srrau ont0apenmieilslmDemumonu0trtoio3ty1lpDrlu i t0texrxo ny1ole lfvt t  2tmum nu1optomi3iat a um(mont0alerxrctatlaDelnvo t0 2um(o iy4opt lieslt)a2raur nu0apxn ictyslaDran snt4 exoir oodfmD  n i t  etmxrpou1ome lieia( aDrrurp;t0ope mo3iatlsDel( ont0tlenmo iy1fmt lueols) 2tmiopny1optnlieia(farrrxmpnu4alenmocilt a2ul(mp;u0texoif oodfaDraieo;s0trto(mpny1ameemiciat) Dtrumono1alx mfeiltlm ea(von(0trenxf oatfatr ues;( teum(o3iu1lmtelnci () rtmx pnu1tpt  ocilt a rmums (0tltoxo iy1opDrlues t)srtrir io1lmeelicsltf 2raump;u1alt mfcils aDeaumpnu)altrxf3iydlatr neol(0t2tm(o nu4opt  fvtl()s2umumont4alt iieiyslm2rmnvpnt0aexoxo oa1lm rai ils0t2umio iudll n nesa(  Dtr(  ot0tltoiieiytlaDeau snt0 rtnif oa1fa   nvsls) 2to(m iy1lmte icta(fartmx poo4alxnii3iatlm2rmnvo (0artoxfcta1lp e nvils  exoirpou4ole liviat sruax poo0tpxnmoeildla rauvs;t0 ltrmfcoatop  liesl( trtm(r3oo1aptnlfcsa() Draum nu1aeeomieiatlaDum(mo;()tlxnioctadlaDr uesls)tetrxo3oy4amtnlics ( aDumuro;o4aeeomi3ildfmDrlnvs (4 renifcootlpDeluei;() etr(m nu1lmte ncsl(faDta(  ;t0aptnmfctydls2rmu s t0aexnifciodlatelneilt)texmxm3no4ale  ncils s2taxmp;u4tetoiietydlm2eanvsn(0 rermr3iy1fmDr ieolt)s2xoimpoo4lm   nvsl( a2tm(  ot4altoiociasfs2eln o;t0tetrio3io1lmtraieilt0trxoir nu4lp n feiat a2rm( pnt4aptn iciltfm uluvp u0texnio ty1omD lies t) 2tm(m3ou1ll n feiat)sDurxrooo1oexnmfeildlaDranmp ()arxrmo oydfp r neilt  eurxm3nu4ll elfvtltfaDumxm nu1tlxomocias s ua(vo;(4arenxo3oo1oa eanvil(  rto(m3iudllt  fct tf 2rax o;o1oeenmfciysfs2umnmont0tltriociydom eauvsl(  ruoxrpnu1ap nlivtat) Drru o;o1oeenmoeiatfa ean onu0aexrxo iatfp e ueols) etoim nodlleemfvt tfs2rrxmpot0ape  o3iydlaDum( p (4tleoifcoydom elueo;(  rtmxo iudll elnvsl() rrrxmont1tetn oeilt m el(vsnu4tlenir3oadlm rlneilt)seum(opou4altemfeiasfsDtr(rp;u1tpe mi3tltlm2rauvo;u4aeerifctodfaD  nvslt trtm(rpiudlp e netas) 2ua(m nu1opxn fciyt a rlu s;t) exnmr oodoaD  uvo;s)t2trxm3io1lpeeliviatfsrtr(  oo4opeomieiatls2eau p t4arxomfcia1lat  uvi s  2trxmpoydolt lics s srraxmoou1tetoiieiad m uan sn() exoxociodop e iei s s2uo(o3iudlmt  fesas  2rrxm oo4aee  ociyd s2ranvs;t0aexrxf3iotomtr uvs;()teto(o3iu1ale  ieil(  Drau ooo0olt  feiys sDrmuvont) lxnmrciatomtrlnvolt t2xrio ou4alen ies (  Duax pot0oex iietasla rlump t4 eenmo oodopDran s s0srxoir oodomeelfct sf 2trxm ;o4apeomi3tyd a rlnms t4teerxr iotlat anes;s srxmxrpiy1olenmictat) rumu p;o0oex moetldfa2rlnmpnu)trtnmfctotoatranei () rxrxr3oodalee ncslt) Drrxmooo1openmfetlsfsDrmuvo (0teermo iy1latean s;t0texoimpoy1ol emfesa() 2rau poo4texoif3ias s rlnvo t4altoxf ia1lmtran sls0tetmxm nydol emfcta() Durum ;u4tlt  fciatlsDulums;t)tetnxrcto1oateli s t) rxmxr iu4optn nvsa()s2uru  ot4opt  o3iytla ranvpnu)aeerxo oo1lat aues (0setr(o3nu1ame mncslt s2tm(  nu1olenmoctad a umu s;t4 rtrio3iatoaDe i slt)seto(r iu1lme mfvil(fsDumxmpno1teen ocilslaDrau p;t) reoxr3ty1fmDranvo t0 exrio3ou4lp elfcslsf rrmu ono4aet mfcild m2ra( sn(4altnir todoatelivsl(0s2xr(m iu1lptemnesl(f Dtruront4alx  feildla2ul( s t0teeomr3oo1fm  an ols)t2urxr3oudlm e ies t)a2rr(mo;u0alxn ociyslaDua(vp (0arenxr oydopt luvi;t) 2xr(rpoodop elivsa() 2tmxmpnt0altoio3ias s ranvsnt4aeeniocoy1la rln o () rxmim iu4optelneils) 2urx ono0tpeniieiatfaDul(vp t0aeeomo iodfat  uvils)sexmxr ny4omenmicsl()arra(r ;t4tlenii3tad aDuaumont4treoxfcio1fpDean i s)texm(opnu1lmen ivt ()s2tr(mp;u0oleo fcild s elu p;(4 lenmrciatoaDr uvslt0 2umio3iodal nlfvilt  2ua( pou0tpen f3tldla rmu s u0aeenxfciodop eaneo t t2xoxo iy4am  mics (fsDur(mo;t1oetniiciad m2eauvp t4tleoirctydlm r uvs s0 etrir3io4ll  lnvsl(fsrtr( onu4alxoioeildls rau s t)alxniociydfp rau o;s)teum(m iydape  ncias)sDrm( p;u1aetnmf3iad a rm( o;t4tlxnxf3tatfpt aneolt  2xrxm iy1op  lfctatfa2urx  oo4olxomf3tas a2rmnmpnu0tlxnmfctytfaDrau s t)srxmim oy4op   ies s) Drm(roou0apx ii3iadlm um(vp (0 eenif3ootfa eaivo ( setmim iydamtnmivs sfaDrmum ;u1tpeomfciasfaDemuvp u)aetnioctotlat  ivi;t)seuoxo3ny4ape lnvi (f Dtr(r nt1aptnmocilt mDrl( o t)aexnir3iy1fpte uvol(  2ur(opnu1lmtnlfct t srtmu ooo0oexomoeildls rau on(4artnmo iadlpDe neo;s)s2tmiopnu4op n neias a2tr( pou0texn feiltla2um( o u0teeoxrciydlm e u s s srtrio io4ame mivs (faDtax pnt0oeenmieiltla2emnmpnu4treomo iotfpDeai o (0s2tmxrpno1lme mfviatfaDtaum ;t0apt  fciat aDum(vonu) ltrmo3tatoaDelivs ()trtmxm ou4alt mfvsa(fs2um(  no4oexnif3tatlsDum( snu)tltomfciodfpte nvo t0srtmxm oo4olt lfvs sf 2ra(mono0optoiieiadfa eluvo t0trtoio3iatfmDrli olt)t2uoio nudam nmfvt t arurxr nu4tpx  ocild a2ul(mp;u)alxrir3oytom   u s t s2trxr3nu1oleelfeil( aDtmxr ;u0tetoii3iydfaDemnvonu0tleoiocta1faDran slt)seumxo iudomenlicta( aDuax o;u4opeo fcils a rl( o;u4aexoir oa1fat  n ols0sexrxr no4olt lfcsltfsDur(  nt1tle iictltls uluvs t) rtnif3iotfaD  uvi;( trxoxr3iu4llt  ivsasfartr(mono1alx mi3tlsfm ua(mo t)artriocoadoat aueo t) 2xr(mpio4lpt mivi s  rtm(  ot4tetnifcildfaDrm(vp ()teenio3totfa  auei;()teuo(m3iydole licil(  Duaum ou0opt mo3tldfaDeaump () etnxo3ootomDraivo t0srxoxopou1lm  miesls)aDrrur oo4tpx mi3tasla2ul( ont4tltnxr oatfaD  neo;s)sexr(o3io4om  livt t  Dtmxroot4opto f3iytfm2rauvsnu)tetrmf oo1fp   ueols)tetrim3nu1alee fciat) Dtr(rpoo0oet miciadla rau sn() ltnxr oydfpD lu o t)seuoxm oodope lneiat  2uru  ;t1tpe if3ils s rmumpnu)aeerxo totlatrai o t teumirpio1apee ivta(fs2ra(  ;u1tpeo ieiad mDeluvont) rxnxr3oy1lpDrln o;( t2toir3oy4lm  miciatfsDraump;u4tlxniieiad s umu o;u4 rxrmr iodlatrlues;() 2xoim3ou1lltemieils)aDraur ot4teenmfctld m2rl(ms u0aetnxociodopD  n ol(  rtoxrpiydol emfei () rtmxr nu4aee ifeilsfsDea(msnu0altrmociatfmD auvo;() rxrim3iodom emfeia( aDrm( onu1apxnmf3iyslm uln onu)arxrmr3tadomt  ivi;t)t2trir ny4om  mnvia(f Drm(ront0apxo ietlsfsDem(msnu) lxnir iadfa elivi (0srumirpiy1llee ivi tfartr(m oo4aet iicilt s rauvpnt)tleoxo ty1fptrlivolt)srxriopiydlm nlnviatfsrur(m ;t1aee mociltfmDranvs;t4arxomfcoytlpDrlnei;t0 rxr(o3oudom  lnvtatfa2truro;u4oltn ociytfs um(mo (4 etnmoctatla rln i t0 rto(rpnydaptn ietltfsDuaxmoou0altomfctad a2emnvs t)teerif ootfm eli o;()teurxmpiu4ll e ici s)arum(ro;t4opt  ociyslm uln s () rxnmr totoaD  u s;t)seurio io1lmt  fctlt)sDtaxr nt4alen ieildfsDrlumo;(4aleomo oa1fat  ivol(0 etm(r nu4omt lictas) rrrx ont1tlenifciat aDumnvonu0tlxomf3iatlmD  ieo;t)trtmiopny4al n neias srraumonu1ape ifciadlsDuauvs t4alxnir iydfm e u olt) eurir oo4omeemnviat s2umu  nt4tpeomociyt m2rlnmp;u0 rxnmrcio1oate nvo (  rum(r3io4lmenlnetat)sDumxront0teeniiciys mDuanmon(4 rtnxf3io1fmDrluvs s t2uo(rpno4aptn nvtl( artmx o;o4oleomf3iydls rl(mpnt) exoio oydfp  luvols setrio oo4altnlivtasf 2rm( poo4optnmi3iydfs2rmnvs u)aetoxrciodopDranei;(0trxoxopnu4ale lici s) rrmuront0optnmfeiyd m2umnmo;t4arxrio3iotfmDean o t0s2trio nu1aptnlnvsas)s2umx oou4optniociyd s2ulnmpnt0 reoxf3oydfm  aues;t0t2to(r oy4lmt lfeta(  Dtru p;u4tptomocilsls2uaumont) lxrir3tytlpt au o;t setrxo iodlpen netlt)a2rm(m oo1alt ii3tydlsDumnvs t0alxrxo3iydoat luei ( texoxr3nu1om   fcsl(faDraum ;u4texnioeiyslm rlump;(0alxrmo oy1fp e n o ( s2xrio iodlmtelfvil(f 2um(mpno4apx moeildls2rl(vsnu0trxnioctadfptelieils0 rurio iodalee fcilt)sDrmu  nt1apxnmf3iysls2eaump (0aexoxr oatfp rau o t0 eto(m3iu4op   fci t) Dtr(mpnt0alxn iciadls eluvs (4trxnif iodfat an i ()sexo(o3oudlpte nvtat srrm(rpot0apxn f3ias mDrln o;t) rxoxo3iotom r ivo s) etrxm ou4llt lici t sDur(m oo1alxomf3iadlmDemn s t0altnmocoytfatr iei s)s2xoxopou4al nmfei t  2ur(ronu1altoii3iyd aDum(mp;u) lxnio tydoptraneo t s2uo(o3oudlm elnci tfs2rr( ono0oeeoif3ias s2uauvpnt)artrxociotlaD ai slt  2umxrpio1ope lieias) 2tmuro;u0tet  i3iltfm elu pnu) leomfciy1fp   nes;s0trur(r nodameelnvsls)sDra( o;o0opxn ieildla umu o u4trxomr3iotlpDranesl(  2um(mpoo1aptnlfesa()arrm(mpnu1tlt mietlsfmDul( pnt4tlxomr iodlmte n i;(0srxm(o nu4op n net t s2rru  nt1tee ifeilt mDrmnvo t0arerif3totlp  ai s (  rxmirpnu4amtn ictl() 2ta(m ;u1apxoii3taslm rlump t4artrxfciotfm  anvs t)teumio io1omenlicslsfsDuau pot0ape mi3ildfa2eauvpnt)tlxoio ia1oaD ln i;s  2xrir3ou4lp emieta( s2rax p;u0oexomfctltfaDul(vs (4 lxoif tydlpD li o;( srumio3nu1lle licsa( sDtr(mpou1oexomi3iatfmDean s u) rtrmf iodoptrlivolt trxrxopnydop nlfvils) rtrump;u4oexomo3tltfs uanmp;t4tltrif iydfaDraivi;(0t2tr(m nydope  iesltfaDua(r ot0tee mo3tydlsDrmnmo ()aeeomr3todop rlu o t)trxmiopoudolt mnci (f Dtr(mpnu4aeen i3ilsfa2emn p;u4teeoir3oydomDr ueols0 rxr(r oo1omt livta(fsrrr( ono4oltnmfetyt m2rmumo;u4 rxnmoctodomte i o t s2umxopno1ameelncsat)aDtmumono0apeoio3iydla rluvs u)tlxnir oodla e nes;t trur(rpnu4al elfetat) rtaxrpnt0tpeoiiciadls ul(mo;(0texomrcoa1fpt  uvo;s0t2xrxo iydlmtnlfvt t)a2ur( oot0alt  oetysfs2ran onu4teeomr3iydfpt  nei t srtriopny1ome  ncsa() rrax pno1tpenmietad sDemuvp u4 exrir tytlpt  nei t0 eur(o iydom nlivs ( a2rm(mo;o1opto fetad a2elu o u0 rxoio oy1fptrln il(0trxmim oy1omeemictl(farua(m ;o1oeenmfetls m uaums;u)texrifcta1fpt lneslt0trumxm3no4lle mfeslt)arrmu ono0ale ii3iasls ea(vpnu0texrifciadfpDe n s () 2xrimpoo1ope licsl(  2ua(rp;u0tpx ifetydlaDrlu o;()trenifciotfmDean i;s0 2tmir oydame  neias) ruax o;o0aleomi3iasfm2emn p;(0treomr3ia1opt ln i ()texoirpio1omtn iesas aDtrxro;t0tpx mo3iaslsDulu pnt) eerxrcoa1fmDe neil(0t2umxo ou1oltnmfetl( s2trxmpnu4alt mfetaslsDelnvpnu)tlerxr iadlm rliei;()trxm(r3oy4llenlfvi sf rtrx  ot1tpto ociatls ua(msnt0 leoiocoa1la elieils) ruo(o3iodamt  nvi t)a2rmxrpnu0tptnmfctldla2elu p (0aetoxociadlmD ai i s srum(m oy4lm  mnvs sf Drmx p;o1optniociyslsDrmn s u0altnio ia1fa ran i ()sruoxm nudlmen iviat  2umum nt1oeenmfciydfa ranvp;u4 exomf oytoa  aneo t s2uo(r3nudaptnmivilt srtrxr ot0aetnmoeiadfaDranvp (4 eermf3tadlp r u s t setmxmpiydlpee ici sf rua( onu4oex  i3iad a2eln onu)texomr iotfp ean o;t  2tmxm nydale lics t a2um(r nu1texnmfcilt m2uluvs t0altnmf oy1lpteauvs t s2tm(opoudopenmfcsltfsrrmxr ot0alx  i3iydlaDuan s (4 rtrmrctytoaDr u sl( s2xr(o3iy1amtnmnei ()srraxr nu4oetoioetadfs el(vo u)trenifctydla   nvs;t0seuoiopny4lleelfesl(fsDrr(r ;t1aetnmociys mDuaumont4 rxrxociotlmD auvsl(0 2uoxrpio4op  mfeiatf rtaxm no4alxn feiltlaDelnvp;u0trxnxr3ta1lmDe u s ()s2xo(mpnodoltnlfcslt)srta(mpot4aetnioeiltla rlu o;()teenmr iatoa   ivilt0trxoxo io1omt lnctatfaDrrxro;o4olx mf3tytfa2uaumon(0 renif3iydomDeaivi t0trxoxr3ou1ol n ivt tfartaum ;o0ole if3tltfsDuaumsn() eerxocootomDeluvs;(0 rur(r3iydapt  nvias)artrur ;o1ape  ieiyd a2rlums u)tetoir iytfmD lu ils0seurxo oodlm  livsas)aDur(ro;u4aex  fctyt mDrmnvpnt0 ltnio oy1fa e ivi;t0 etoxr ou1opeemfeiltfaruaurp;t0teeo o3iltfs ean pnt4teeoif3todlpD  ieo (0 exoxo3iy4lp nmncilsf 2urxr ;o1tltn iciydls2rluvs;t0 exnmfcia1fmtr neslt0s2toir3oo1lmt mnvil()sDrr(m ;t1olxnii3tyt s umnms (4aexomocootlpt  uei (  ruoxo3oy4olen nvsls)artm(mpno1aee io3tys mDel(vonu0 eenxo tatlp elivil(  eumxr3nu4opeelnvils) Draumpou4oetnmociatfs emu pnu0artnirctadomDelnvs t texo(m nydamt livtlt  2ururpot0alx iietlt aDrm(mp u0trenxo3oa1la eau o;()teurir3nu4lme  fvt s  rumxmooo1oleomi3iasfaDrlnvs;t0 lxomr3tydfp e i sl( sexo(rpou1openlfvslsfsrrmumont0tpto i3iysfa2elums t4 lermf ta1oat  n i s0sexoimpny4lme mncsl()aDta(rpnt0ale ioeilsla2rl(ms u0trxoifciy1opt  uvi t)texoxo no1apeemietat)a2trx  ;u4opxomfctydlsDuaumpnt4 exrxo oy1oa raneo t)s2umiopnodlp emnvi ()artrxmp;t1olto fciatfs2um(mo t0 etoir tytlpDr ueo s  2trim3oo4omtelics sf 2urxrpnu4aex ii3iltlmDuanms;(4 rtnif todfpD lneo;s)s2umio3oy4amtnmfvtl()arrmx onu1tet  oeiasfs2ran snu0 etoxr3totlpD anvi t t2xrxm oy1ope mieslt sruaurpou1ole if3iltlm ul(vs;(4tetnmr3oodopDran slt0t2tm(o3iy4lp n ivtas)a2rmumpnt0oetomi3iydfa2rmn s (4artrmrctatomD aivslt)trtoirpiy4lp  livtls a2ra(mo;o0aexo f3ildlaDelu pnu)texrxr ta1lmD li i;(0t2xmir3oudomtnlncil(fartaxmpoo0teeomicias aDelnvs;(4tetrmf tadfm eli ol()t2ur(r iudll n ivils)srtmur ;t0tlx  ociat s ea(mp (0tetnmf tydomDe nes ()trxr(m nu1om  mfetlsfa2umu  no4tlx iicilsfmDea( p;t0aeermfctatlm  an o;()s2trxm3nu1lle  nvsa(fs2rm(m ;o1tptoii3iydlmDrmu p ()aetrmo tydop rau slt tetrxr3iu1lp e ietat  rrr(r ot1oeeomieiaslsDrm(vs (4tetnxr tadlpDe ues;s)teurir3oydom elietls  rtmx o;o4tetnioetytlm2ean s (0 rxomo iydlaDrauvilt trtr(r nu1amtnmneiat  2trxmpoo1oexoiiciytfaDumn snu0arxnxo oydfmDrlues;t0setrir oo1lltn nvslt  rua(moou4altn oeiyt s rlumo;() rtomfciydoptrlnvo (0teumim3no1ol  mfvtat artrxrpno0opeomfciad a umu sn()tetnmf3iytlpDrauvi t)srumio3iu1altnmivilt)sDrru pno4tpxo i3iltfaDrmums u0 lxnxf3ootlmte nei;t) exo(m nodopte fci s s2um(r ;t4apen ociadfaDra( o;t4 eenmf3oodlp  ln o;t0trurxr3no1lmte nei () Duauro;o0tltnmieiad s2ea( on() lxrmf iy1fm r n i;s s2xmxr no4ome mneilt a2ua(r ;u4oleoii3iat aDrluvsn()tetomr3oadlmD ln olt  2urio iydamen ivs s aDtru  ;o0apxn feiltlaDra(msn(0 etnxf tatfaD auvs s) 2umxr3iydllee fcia(f 2urxro;o1olx mi3iys s eau s t)aleomocty1optrluvo t) rur(rpiu4llt livi (faDrrx p;t1apxo i3ildfaDulnvp u4 renmr tadoptrln s s t2to(r oydlmt mfvils)artau pot0aptn icilsfsDrau s;(0trtrxr iatlp  aieilt t2to(m3iy1om nmfcslt) 2rrxrpnt0openmi3tat a rmnvpnt4 rtrxf3oa1omtr uvols)s2uoio no1lp n ictat srrrum nu4aeeoii3iat mDelu s;u4trtomf iy1fatelueo;s sexoxmpoo4altemnvs ()aDur( o;t0aee  i3tyt s rmnmpnt0 rtrxo iadlmDr nes;()seumim iy4apt  fvsat sDrrump;t4aptomieiyd m2eluvsn(0artomfctotla rliesl()trtrxopoo4ope mneiatfsrtrxro;t4ape iieiad aDea(mp;t4 lenmrcoydlmt lues;t t2toxm iydomtelnvia(fsDrau pou1alt  ieiltfa rlu s t4treomo3oytomt  i i s)seuriopiu4omt lnci ()s2ua(mo;t0apt mietasfaDra(ms;u0altomo io1op eli ol(  rxm(r iy1llenlici tfaDua(mo;t0oet iictaslsDrm( p;u0artnif ty1faDrli ils) 2trir iy4lp  mies (fsrumu oou4tlx  ietydfs2rmn snu0trtnxr oa1om rluvi ()s2tr(mpny4altnmfvtatfsruau pot1alx  fcilslm rmuvp u4alxrmo oatfmteli ols seuoir3iydale  nesltf Drrurp;u4oltn o3tlt aDrauvo;t) eenxr3iydop r n il()t2xr(r nodll nlnvt tfa2tr(ro;o4tle mieiltfa eln onu)trxoxf to1fatrau i;t0seumxmpoudame mfet s)arrmxmp;t0alx ii3tasls uaumpn(0trxoxf3iydlmDe uvslt0 2trxo3ou4ape  icta( s2ur(m ;u0tleoii3iysfa ea(vsnu)tlenxf3tydomDr uvi s) 2xo(mpou4apen ivi ()sDtrxronu1aet ioeiytls rauvo;t0tlxoifcoadfmte uvi;( s2tmxopnodop e nvilt)aDurxmo;t1alxo f3ildfa2emnvsnu0 exrircto1lpDr uei;t  etr(o3oudlltn ivtasfarrrurpoo1oeen ieiyd aDrl(msnt0tlxnxf oydlp   nvsls0 eumim3nodam  livt t)sruau  nu1opxomicilsls emuvon()alenxfciodomt au s;(0teurir3iu1lltelieiat aDtm(  nu1oex  octyd s ua(vp t0tlxrxo oadoa  lneo ()trtr(opnu4lmt lfesas) rra(m ;o0apxo ictat a2rau pn()trtrirciydfp eauei (0t2xoirpoy1lm  lict tfa2urx oot4olxomictytlmDem( p;t0tltnmr3iotlmD lnvs s s2to(rpiodoptelnvt tf Dur(moot4olen icildlaDrlnvsnt4artrmrciodop e n ol( srumio3iodlp  lict t)arurum no1tetn iciasfm ul(vsn(0trermo3iydfptraiesls trto(o3nydlpe lnvilt aDuaum ou4tetoioctatls2rm(vs u4tetoirciatomD lnvilt) euoxo io4lmtemneia( s2rau ooo0oet  f3tasla ulu s u4aeeoiocoodomtrauei;s srxo(o3iudope mfvtls)a2taurooo1aeeomoeiysla ra(mp;u0tlxrmr3oodoptr nesls)srum(m3nudlmee nct t a2raumoou4tpt  f3iadfaDulnvo t4 lenxrcoatlptr ies;() etm(r3io4apeemivsa(fsDtaur nt1tlenmieiysla umumo ()aexoircio1lpt auvsls0texmim oydlleemnvtat  Dtrx pnt4aptn oetad aDeaumon(4aetnxr ta1lateanes;s0 2urxrpoudol nmnvtls s2trur ;o0alxomfcias a rmu p;()artrxo3oo1opDrln ilt0t2toxr3io1aptn nctlt)sDtrx ono1tee  ietltlsDeauvp;u)alenxo3iydlm r nvolt)srtmxmpoudlptnlfcslt) rrm( poo4oeen fciadla ulnvo;u0 lerio3oytlpDrlu il( teuo(r3oodop   fcs s aDtm(r nu4olenmociysfsDum(vo;(4aleoio3io1fmtrli i;s0 eto(o iu4oltelfesls aDra( p;o1aexo octyslsDum(vpnu) reoio iytoaDr ivs (0t2xoxr oodal e net t sDuaxmont0tlxoioctldlsDeanmo;u0tltrmf ty1lp rlies () 2xrirpnydopteliesa(f 2umxr nt0aeeoiictldla2rm(vs;(0tlxoxrcoadfpt aueil(0sruoxr3oo4ll  lnvta()a2ua(mo;t0tpx iictyd mDrm(ms;t4 lxoif3oadopDrlu ilt s2umirpiodlm   nvi () rumx  ;o4alxnifeiltla uauvsnu4teerio iatoptr i i;(0 eurxmpoodap nlncsat)arumumonu4opxo ociat m2umumo;t0tetnxr oadfate ivo;( s2triopoudal   nvsas sDtrumpot4tltn ictldfm eanvs (0 exrircoa1latr neo (  rtoirpiy4lptn nesltfa2umur ;u1oexnifetatfmDeln snt)artrir totlm  anes;t0 rurxo ny1ol e nciat)srtrur no1alxo feiatfs em(vo;t0trerxo3iotfp  lnvsl(0trtmxo iudopt lncs t  Dtaurpou4teenmoeiysfsDean p;t4 eenxf iydlmteauei;s)trxrim oydol   ivtlsfaDrm(  oo4apxn o3tatfs ea( pnu) exnir3ia1omt lnei;(0texmxm iy4lpee neta() rtm(ro;o0altomo3tas mDeaumo u4 rtrirctadop e i ils)seum(o oy1alee fvs sf rra(r nt0tpxo ietydls2ea(vont4tlenxocio1oate i ol( seto(m3no1ap nmnci (  2tau o;o4tle ioeiatla2eln o t4 eerxrcoa1optelueils)s2tr(o3iy4am   nesas  Duaumo;t4oeenmi3iysfm rmumsnt0aexnxr3iy1opDeanvo;(0 rxmio3nu4am e fcsls s2raum nu1tlxo ociydfa ulumpnt4teenio oa1fmteau s;( s2xoxrpiy4omt lfei (fs2uauro;t1apt  fctasfs ua(msnt0teenif3ootfp rln i t)setr(m3oy1aptnlfct (fartrum no1oltnii3iltlm2rlnvo (4texoxrcoatoaDr ivo;t0s2uo(o io4opee fei s sDtmur no0tetnmo3tatlmDuan pnt0texoif3iadlp rlnei;(  rxrirpou1omtnmnes tfa2trx  ;u0tpen f3iad m2rauvp t4 exoxo3oydfp  lu olt0srurio3nydomtelnesa(fsrurxmono1teen ietadlsDeau o u)teermo3totlpDeluvo;s0s2xrxopnu1am elfcs t aDrrxmp;o4aeeomo3tlsfs2um( s t4tlxomf ta1lpDeanvils)s2umir oudal  lnvtl(  Drmxrp;t0aleniietld s el(mo;(0tetoir3iodla elneolt) rxmxm3no4ameemfvtas  Dtrxronu4ope  i3tadla uaump;(4 lxrxr3iydom r ueo;t0 rtoir iudopte fcs (f rrr(moot4tet  ietadla2ua(mo;u4trtoxf3to1oat lnvolt s2tm(rpou4om elneia()artm(mont0ole mfcilsls em(mo u)trxoxfciytoaDe u s;()srtoio ny4opt liviasfa2ua(rp;t1ole mieild m2uluvo;t) exomo3iytlaDeauvol( t2uoirpio4om emfcsasfaDraur ;u0tex  ictyd a rl(ms t4trenif iatfmtrlu i;t0sexoxr io1apt mivsatfsrua(  no1tex mocils aDemnvs;t0 lxoxf iodom   iesls0srxrxrpoy1lpt lnvil(  2urumpoo0oeenio3iyslaDrl( s;u)arenxf3iytlp r nvols)texmxr nudlmt  nci (fa2raumono1tlt mfcilt mDelu pnt4 rerxr tatlat aieo;()t2um(rpnu4ol nmneilt) 2rrumo;u4aptoio3ils aDumumon()alxrmfciadlmtranvi;t)sexr(o iydomenmfet s  Drm(rono0tleomi3iltlm ulumont)trxoxocoy1op rau s;()tetoirpoy1op elnvias  rrmu ont4oetoii3iltls2uln o;t) exnmr oodfmDe uvo;s) euoio3nu1ap eliesl(fsDtruroou0apenmicilsfa eln s t4 rxrir tadomtean o ( truo(o3ou4lmtemncs (fsrur(r ou4tleoifetyt sDrlnmp;u) eenif io1lpt anvol( setmio nu1ll elfvi t sDtaum ;t0olen ictatfm2eanvs u4teenmo3oadlmteau s;(0trxoir3iudal e ivs t) 2uaurono0ape mictlsfm ulumo u)artnio oy1lp  livols)tetm(rpou4ll nlnetasf rta(m ;o4oeenmi3tatlm umums (0 rtnxr ty1fa eau i s0trxoxmpiodame lfei s sDtmx onu1apeoifeiyd m rm( s u4 eeomfcootfm e neolt srxmir oy1ll emiet t)sDua(r ot4tpt  fetydfm2eanvpn(0arerxo ia1lp elnes;s)trxr(rpiydole  ivtl( arua(r ot0tleoifciatfsDemn p ()trtnmf oatlmDrlivi;t0 etrxr nydalenlnesas sDumx p;u4teeo ieiydfs2uanmp;()tltrmf oodom ran olt0 2tm(mpiydlleelfvsa(fsDta(mpot1teeoifciysfm2el( s u4alxoir3tytlatelu s;t)trurxo ou4olt mfvtl( srtaxmo;t4oexnmfciaslm emuvsnu) eeomf3ta1oaDr uvi t0s2xr(r3nudapenlneiatf 2tmxmpno1tlt ii3iysfm2elnmont4texnmo3iydfat livo;t0 rum(r ny4alteliesas sDumxmo;o4aexnioeias s2ra(von(0alxomr oadopDr nvs t trumxo no4olt mnes () 2ra(mp;t1tpt  o3iad mDea( p ()tetnir oo1fm e ivi;s) 2umxm nudole mncsa(  rua(r no0tlx  ociad mDuanvo;u4 reoxociytoatelivi s t2xmiopoo4amtemnvilt)sDuaurono4aexnmieiltfsDrmuvo u)alenir3iydoaDr n o t srxoxmpiy4amtemnvtls) Drrxmoou0alenii3tyt m um(vp t0 exomr oodoat auvilt0 rxm(r3iy1op   ncsls)s2rm(  ;o1apeomieiatlm rmuvs t4 reomf3iydfatr u olt0srtrim iy4lpe mictl( sDtr(m ou0oexnii3iad aDuanvont4 lerio oy1opDe iei s) etmxo3ou1open netatf Dtmurp;t4tptomfciad mDemu pnt4tleoif3oo1la   i s;s0srto(r3oudlle  fvsl()a2umx p;u4apeniicild mDea( sn(4arenmf3ta1oa e ivslt0 euoimpnu1ale miesas)a2rrx oot0aexomo3tasls ranmp;u4alxnmr3to1oaDe ivi () 2tm(r3no4opt mfcslsfa2um( pno0tlxniictaslm2ranmont4 rtrxrctatfm ranei;t truoim3no1optemiesas)s2uru ooo4tetomi3iatfs ranvs (0artnmr3oa1fate u o ()setoim iu4ale mncslt)s2tr(ro;u0tetoioctas a em( o u0 lxrir iatfatrauvi;s) 2umxm3oydlltelfctl(  rrm( oot0aptomiciltls ulu onu)trxnxo3iydlaD ln i;t)trxr(o oydoptnmfvsl( sDtmurp;t4olx iietaslaDrmums t)aeermrcoo1om  luvs t)srxo(opoodamt mnesat arrmu  ou1tlen ieiadfaDuauvs;t0teerir3to1lpteanvi s)srtrxopoudalte nesas)srraur ou4tex mf3iatls2uauvs u) reoiocto1opDr nei ( s2xm(opio4amt  fct t aDtmu pou0apxomoetat a uln pn(0tetomo tytoatelu s t)srtriopou1ap n ici t)arrmur ot4alto ieiysfsDuanvsnu) rxomf3ty1fa rau ols0truoio nydomen nvs ( a2ur(m nu0oltn iciad m ra( ont)trxoio3iydoaD  ieil( s2uo(opny4ll nlnvs tfaDtr(  ;t4aet mfcilslm rmuvo u0 renmf oatlm rlueolt)t2xm(o3iu4lme  icsls a2rru  ;t0aeenioeils a rauvs;()tleoif oy1fa   n s;t) exrxm3iu1alee fctat  rururpno4aetn f3iat s2uauvo;() ltoxf iodfa  auvi;t0teto(m3iudom e fvil(f 2tmurpnt4altn oeilt mDrlu pn(0 lenxf iydoa e ivo t0 rxr(o3oydale mfvs s  Drrxmpnt0aet ii3iaslmDum(mpnu4aetrio iy1fa rai s (0sexrimpnydlpte iei ()srua(  ;u0tlenmi3iatfsDemnvon(4 etoxociydfpt luvi;t trtr(o ny1lmenlfcslt)aDtr(rp;t4alto f3tytfmDul(vs ()tlxrif oa1omDe uei s srurim iy4llee nvsl( artaurpot4tlt ifctyslm ranmo u0aleoxrctadlat an ils0 etrimpiy1aptn ict t)artau o;o0texoioeildfsDumumo;t0 etrif oatlm   u i;s)trur(opoy1ll e fvt t)s2raxmpoo0oee iocias mDrau s u0alxnmoctadomD aneol()texrim oy1op nmncil(f Draumpoo4tlxnmoeiatlsDel(vs;t4 exoxr oa1opDrlnvo;(  2urir iu1lm n nvia(faDtrx  nt0aex  ieiytlm rln o u4 eeomf3iotoat liei;(0seumim3ny4ap eliesas artmxmp;o0aexomfeilsls2umn o u) exoifcoadoat  ieils0setoxrpoudlmtnlnvs (  2tr(m no4opt  f3iadls2ran onu4alenxr oo1opDrlueo t)s2ur(r oo1olenlnvtl( a2ua( pnu4olto ieiydlm2rm(vo;t4 eeoxr3ty1lp  auesl( s2tmim ny4lmtemnctlt aDtaumonu0aex mi3iad m2ulumpnu0tleriocty1opDran s s0trurxm iy1apenmiei ()srta( ono4opxn o3iasla uanmpnt0aeeoif3tydlaDraivi ( teurxopoydop nmnetatfa2rmx  ;o1oleoiictyd mDemn pnu4trxnio3iydfpte uvilt)seuo(m3iu4ol nlfvs t aDumuronu1oeen ieiltfm eau o;(4 rxnmrcoydfp r iesls0t2xrim oo1ope mnes t sruauroou1oex  ieiadls2el(vont0 exnif3iytopte n i s0 2tmiopiodale  fcsl(fa2rmu poo4opxoii3ildfm uau o t0teenmo to1fp e uvs (0s2xr(o iu1apee icsat  rtau ooo4tpx miciatlm2umnms u4aetrmfcta1la rln s;s) 2xo(opiydolenlfvsltfs2taum oo0apxomfctadlsDelums;t0aeeomociadoptranvo t  2xrir no4ole lneias s2rmxmpot4aeenmfciatfsDrlu sn() rxrir ia1lmtr ieo (  exrxr3iodomen fcs t)aDumx  nu1opt  o3iad mDea(vont)tlxoif3ia1lmDr ies;()trxrim3nudlmenlfvi t  rum(mono1opx ifciatlaDeanms u4arerio tadlat ai i t seurxopnu4olt livi s)a2rm(rpot4opeoii3ilt sDrlu sn()aeerio3iodlaDraneo t trto(mpoo4altnmivi tf rraxrpno4tpx iociydfsDuan pn(0artrmrciy1fpD aueo;t) 2um(o nu4lp nlnctat) 2rmumpou4aptomoctyd s2ulu o;u4altoxrciodom elnei t  2triopnodamtemnvt s)arrm(m nt4alxnifetldfs eauvo u) lerxfcoytopDrlivo;( teumimpio1alen iesas) Dtax  ;o1open ieiltlm2ea(ms (0treriocoo1oaDr i olt) 2toio iydlp n fvslt  rtr(rpot4teeomfetydla2rmnms;u4arxnmf ta1lpte u ol(  rtmxopnu1olte fvs ()a2tm(m ;u0tetn ieiltfsDeln o (0 etnmr oodlmDelneo t  exmxm3ou1ll nlncil(  rrau  nt4tle mf3iltfs2rm(mo u)aexnifctydop r n s;(  euo(r3iu4amtemnvsls  rurump;t1alt mf3iytlm el(mont) rerio oy1op rauei;() 2tmxmpiy1ll e ici (  rta(rpou1oex mictys sDumnvo;t4trtnir iy1fpDr ues;s  eurio nudom elfvias aDuax ono0tle ifciydfm2eln s;t4arenxocoatfaDrai i s0texm(r3io4ape mfvils)a2trum no0tlen ictytfmDrmuvo u)texrxocoy1fateau o;( trurxr3iydlpe lncil()a2rruront4tetoio3iytfa el(ms t) rxrxfcoydfmD au i s0 exoxo3ou4ame lnei (farrmum ou0olto f3iadfsDum(vs;u)treoxo oo1opt  nvslt0s2tm(opiudlltelici tf rumurp;o4tleomieilsls rlnvp t) renxo oy1lpteaivs s0trxoim3oy4lptemnctatfa2rau  ;u0apenif3tltlsDrmu snu)aetoifciydlpt livo t0 2tmir3nu1amt lfei s) Duax o;o0ape  ieiadfa ulu s t0 ltrmoctotomDr ivsls  2xoim oudll  mfet (fa2urxr nt4tpxn fctat m2rm( sn()artnifciatoaD ai ol(0 2tr(mpnudal   ict s)srum( o;o1opxn ocildfa2elu pnt4 ltnir io1lat  i s;s  2uo(r iy4ome  netlsfa2rmurono0alen ieiyslsDrm(mo u) etnmfciotlmtelieo s s2xr(r3nu4lme mncta(fsrumu ont1oetnmfcilt mDrln p;t)tlenxo tadoa eli ols)srxmio nu4am e ies t) 2rru  ;u4oeeo f3iytla2rmnmo;t0arerxf totop  auesl( sexmio oodlleelfci sf rrau p;t1oex mf3ilt s2emnvp;(4texnmf oytop e nvo ()sexoxrpnydom elnvil()srumumo;t4apeo oeiyd a2rmumo t0treoio3ty1fmte neols0seuoir io4lltelfvs sfs2umxm ot4oleomoetlsfaDum( sn(0altnirciadoa  aiei ()seumxm iy4olen ncsa()a2rrxmo;o4oleomfciasfmDea(vs u0 eenio todom ranei t  2trxopoydal  mfct s sDrm(ro;o0oltnmf3iydfs2elnvp;(4texnmo to1omt livs;t0srumirpiu4lpenlncslt artax poo0oleomieiadlm ea( pnu4 ltniocoatoatrln i;t) rxmirpiy4amt mfvtl(fa2rm(m ot1tetnifetatfa2rluvs t4aeeoircoatfpDrlieslt0t2ur(o3oudlleemnvslt  2ra(  ;o1aptnii3tldfs2ea(vsnu4 renio iadla  au sls  2xr(r3nudamt livilsfa2urxm ;u0aeenmoctldlsDrluvonu4 rtomr3tatlpD  nvo;(0 eur(m iy1lptnmnvilsf 2tru  no1tee  ociltlaDua(mp u0alenxo3ootomDean i;t) rtriopnudllt mfesas sDtmxrpnu1tpen i3iat aDeau snu4arenio oy1fptr n i;s0texrio3io1lltnmfvsl( aDtrxm ou1aleomfciad s2ul( pnu)alxrmr oa1omD anvil()trurxr3oy1aleemicsatfsruru  nt0tlt mfciytlaDrm( onu4tetomr3iy1fp e u sls texrio3ou1apee ncil(f Drmum ;t4aeenmictys s uaumo;t4 ltrxf3totomDelnvi ()srtr(r no1lm nlneta( srum(r ou1oet  fctls s2eln s;u)arenxo3tytfp elnvo;s  2xr(o3ny1omtnmfesat sDumur nt4opxnioeiyslm2elu p t0aetomf3ootomtraiesls)t2trxm ou4llt mieilt)arrr( o;t0tpto ociyt aDumuvp;()tltrxf3to1lp rlnei s)tetr(r3ou1lme mnvtls s2rmxm ou0aex mieiytlaDumu p u4trtrmo iadomD  n s;(  rtoxo nu1apeeliciat sDrr( p;o1opx mfeildfs2em( o;() rxnmr iotlm   n ol(0 rtm(o3nu1om elfciasf rrm(  ;u1oetnmiciltfa2ea(vp;t4arxnmr iodoate ueo s0 etoiopiu1lltn fvils)aDrmumono1oeenmoetytfa2rmuvo (0teeoifctytlmDraivs;t) 2umirpou4lm   ics sfs2ururpou1aeeoii3tld a2rauvo t)artoxr io1latrlnvi;t0 2xmxm3ny4ome  fesa(fsDur(mp;u0tpxnmieiytls2em( s;t0aetrmo3tatfmD  n ilt sruoir iu1altelfesls)a2rmx ont1olxn oetys sDrmump;u4trenifctydomDrli o s)t2urim ou1lp elieslt) Dtmxro;o4tlenmf3iysla umnvo u)tltoxrcoa1fpt  ieo t  rtmim3iodlltemics t arraxmo;u1aee mo3tatls2eau on(4 eeomr ta1laD auvsls) rxrxo ou4amtelnvsa( srta(r oo4aexn feiadfs2emuvo;()trxrmo iotfm elnvsls t2xoio ou4lpe lnetlsfsrtrx onu4opx  octys mDuauvp;u0tltnxrcoo1om   iei s)truoir oy1amtnliciasfarrrur no4olt moetydlsDrlums (4tltomrctodfat luvol( t2xo(rpiy1olee ncs () 2umum no4aptn ictls a2el( s;(0tetoirctytomtrlivi t)sruo(m iu1lp elfctatfsDtm(r no1olxnmi3iat aDeauvon(0 lxnmo3tatoatrauesl(0s2to(m3oo1opee ivi s  Dtrx pno0olenifcilslm2rm( onu0aetrmo3iytom eau sl()sruoxr3iodoptelfcilt srurx  nt0apxo octlsfm2rlu p;(4tltoxrcta1oa rlnvo;s teto(o3nu1am emfei (  2uaurpnt4alxo oetls aDrm( o;t)aeenmfciotlmt ai sl( seuoirpiydll emncsl(  Dumuro;t4tptn i3tlsla2um(mp u)tltnxf oydfa r u i t0t2urir3iudoltemictas)artr( o;o1aetomoctyt m2umnmp t) eenir3oodopt  u i t  exriopiu1ale  neiat aDua(  ;u0apenif3tlt aDelnmon()aeerxf oydfmD li s;s texo(opoy4lmtelies t srtaxronu4olt mietldlmDuln p (0 rermr iy1fm raies ( setoxrpio1llt  fctas)arrm(m nt0tlxn oeiltfsDeauvo t0 eenxr3oytom eaivi;s sexoio3ny1opt  fvs tfsrurum oo4alxniieils m2rmn o (4aetoif3iatfp raneo t)t2umxrpno4ll  mnct s sDum(mo;u1aetoifetltla elnvs u) reomr oytfaDraues s)srxmimpiydlmtnmfciatfsrrmx pot0oltomi3iasfm rlnmp t)tlxnifciatfmDe nvo (  2xrio3oy1lmenmnvt t aDtrxmo;t4teeomoeils m ul(vonu4arerircio1lmtrli o (0 eurir ou1op  mnvt (  2urum nt0oet  f3tasla2rmumont) ltnmf ty1la eaivi t srxmxr3nu4aleelics (  2tm( ooo0opeoiocilsla2ul(vp u)trtoxr todlat auei s  etrimpny4opee fesls) Dtmx p;o4opxnmieiys a umuvp () ltoif3iydlmteaies;t0sruoxopiu4ll n net t  rrmxr ;t1altnio3iat a emu s;()alxomf iatfp eauvilt  eur(o3iudame lfvsas  2rm( o;o4ale  icild m rlumpnu0altrmf io1fa raueo;t t2uoxm3iu4lpteliet t)a2uaum ot4olt moeilt m2eln p;t4artrir iatop   ueil( t2toxopno1lmenlnvtl() ruau pnt0aexnif3tasla el( o u0 rxrmf oo1laDr u o s  etrio3no1lmtnmncsl(  2rmxr nt4oee  fciltfa rmu on(4altnxoctytoaD au i;()tetoxrpio1aleemiesl()aDrr(m ;o1aet  fetas sDra(mp;u0trenxfcoatlpDrln ils0trtrxo3oy1opte ncils a2tru ono1optoioctys m2rmnmp (4aexomr iytop  lnvs s  2urir ny1lptemnesls)srraxmont1texo oetlt m2emn s;(4altrxocoodfa  lueolt)seumxr iodlmtnlieslsfaDumu ooo0tltoio3iltfa2elums;t)arxrxf3iydlm rau ilt srur(m iy4amenmnctls)sDuaxro;t0olenmoeiydlmDrm(vp;u4aetnmo3iatoatraueo () 2toxr iu4al nlncsat  2um(mo;u0apxnmocils m2ul(mp;t4 lenmf ootlpt  nes;(  etrxo3iydapee fvtltfsrtmuro;o4oetnmociys s2uau o;u)arxnmrcia1om  aies s0texoim no4lmtnlies (faDua(moot1tlenmietlt a2em(ms t) lxomo iodomDeln olt  2urir3nu1lm  licslt sDur(r ;t4oetn fciadlaDel(mon(4 rxrmr oo1om  lnvo s0sruoimpio4amtemfctls)sDrmxmo;o4tlxo oeilsfs2rlu o;t0alxnif3oatfmteli ilt) exrxm no4omtnmieias) rra(mooo1opx mieias m2eanvp;(4 rtnxr3oytop eli i t) etoxopny4lpenmnesl()aDumumono4tet io3iat a rmn o;u4altoif ty1opteaneslt t2ur(o oy4olenmivsl( s2ua( onu1texnio3iyslm rl(mo;t4altnio3ta1fpDr uvs;t0s2uoxm3ou4ap  lfcsasf 2um(monu4alxomoctldfm el( p t)teeomociytlpt  ues t)seuo(r3nydlpt mfei t)aDur( pot1oex mictydla2umumpn(4texrmo oo1lptrlnvolt setoio3oydome lfciat) Dururo;t4apxomietls sDra( p (4alxrmo3ty1fmDr iei;() exoimpiu4opeemict s) 2trxmpoo4texnmietydls2ranmp t4teenmr iydopD aiei;s)sexrio3iu4apen nvi t sDurxrpou0teeomfeiytlmDemnvo u0aeeoxrciotfat lu s t)texm(rpiy4amen fesa()artaxr nu0olx  ietydlm2emnmo;()trxrxo3io1fm e n i;( seurimpoy4opt  nei tfsrtauro;t4tlxniieils s2ua(mo;(4 etoifctodomte neolt0t2xmxm oudaptnmieiasf 2tr(rpot4alen iciadfsDea(vp;t)alxrmr3iadfm e nes t0trurxo3oo4apte neils)srumumont1alxnmo3iadlsDuau on(4 rtnmo iydfmDrln o;s s2xm(m3nu1am elivil(farrrx p;u1aee  i3taslmDemumonu0tetnif3iatfaDe neslt0seumirpiy1lpee fvs t a2taxr ot1tee  fcild a ulnmo (0aexoirciadfpDeluei;() etr(r3oo4oleemiciatf 2ta( pnu4apenif3ilsfm emumpnt0 ltrio oodomtrlneil()texoimpoy1lle  fvt s  Duaxr ot4tpxn feiasfaDrmumon(0teermr3iotlpDrai sls)srtmxo ou1lm n nvsa()a2rmumo;t0aee mf3tydlmDuanvp;(4altrmf3iydlaDraivilt) rtmimpny1ole miesat) Duax  nu0olen oeiadfm2ulump;u0 exomo3tadoptrau i t)t2tmxo3ny1lmt mietls) 2ta(r no4aleoioctlsfmDulnmp u)trtoxo iodoptrlues s)t2umim3nu4llenlivil(f Dumx  oo0apxo o3tatla2uanvs;t4 lxnir3ta1lmte ivilt t2trxopoo4ol nmfviat) Drrxrpnt0tlxo ieiltfsDel( o u)aetrmr3tytfmt lu i;t teurxm3iy4lm nlfvs ()artaxmo;t4aee ifeildfsDra(ms;t4arxoio tydlateaieolt0 ruo(r io1ol nlivtat aDrmx  nu1tle moetls s2emu s (0trxomo iytfmtrauvo s0tetr(mpny4alt mncs ()aDururonu4tpxomfctltls2rmnvs;()trtrmf tydfa rliei () rtr(m oy1ol  livt s srrrxm oo4apx ioeiysfm2rmnmon(0tlerircoy1fat ai o;s0 rtoim3ou1lp nlfei t s2uaxrono0altn iciat aDeanmpnu4 etomrciodlm e uvi (0 eurxopny1ap elfet t)aDrrur nt0aeeo ietlsfm2rlnvo;() exrxo iatlaDeln s s0 2tmim3iu1amenlnes t)srrruro;t0olt moeiydfs ranvont0 exrmrciydlptr nvi;s) rxoiopnu4apt lfcsas  Dua( o;t4aetn feiatlm2elu snt4 rxrxo3oy1opD livolt)setoiopoydlptn iciltf rtmxrpoo0alto feiydla2rm(vp;t4aeermocoatfmDe ivil()teumim oo1apee fesa(f 2raxm no0opt mocilsfsDeau o (4tetoxrctotomDrlivi;() rumim nu4al nlfeia(  Dta(m nt0aeen ictltfsDum( o t4areoir3oa1lm   neil()s2trirpno1om nmfcsl()s2taumpnt0teeniicias a ea(vsnu) renmo3oadfmDrluvs t0trtmxm3iu4lptnlici tfsDrr(  oo0olxnii3iaslmDrmnmp t)arxrxr3to1lmD  ivolt) ruo(m iu4apee ncs s)sDrrxroou1apto ietydls2uau s;t4 ltomrctatlp eluvslt) rur(rpnudlme mfvsas sDrr(m nu1aee mociasla2emnvo;t)arenxfcto1fmDrlueo;s) eum(o3nu1alen fvsl()s2urx p;o0tetnifeiyd m2eanvo u0 eeoxf3ia1la eln s (0sexo(m io1lme mivtas s2umx  no1apeo oeiyd aDul(mo t) etrmociydla e nvi s0s2tmxrpnydlp elfvi (f rurum ou0opeo ietatfm2umuvp u0altoxf tadfmDranvi;t0 2trxr3iy4am elics ( sDtmx  ou1altomietat a2ra(vp ()tlxrio3iatlmDeln ils) 2xr(mpio1lp emnet ()sDrru o;o4tptomoeiasfa2umnvs u) lenio3oytfp rlu o ( s2toxo nodomt lnvsl( s2rm(moot4apxomfciytfm uanmonu0 ltnmo3oydlpDr u o;t)t2xmirpiy1omtelnet t srta( p;o1tpeo o3iat a eanmp;(4tlxrmf todom  au i;s)srto(rpiy1alt mfeil()a2rax p;o0tet ifcias a rmnmsnu4 rxomocta1opDe u o;(0 2trio3iy1lp nlfctl()srtaum nt1olenioetydfm2rln s;u0tlxoxrcoy1op rlu s s  ruoxo oo1openmnesat)sDuaxroot4tetomoeilsls2ua(vo;t0trxoxf oo1fpte ieo;()srtm(mpiudope mnei t a2umur ;o0altomfciltfsDua(vp t0 lenxoctadlmt  neo;( texmir oydlpe livs (fsDrrxmo;u4oleoifetls s2um(vs (4artoifctytlatrlivolt)trtrimpnudam nmicslt srta( p;u1alt iietltla rau p;t0alermr3oadfmD aueil( t2tr(opnu1omte ietl()sDtm(  ;t1oltnifeiyt s2el( s ()aetnmf iy1omt ln o;( trto(m3oudlpen ncta(f Draur oo1oexnmieiadfa ranmp;u0 rxoxocoytfm e nvs t)t2to(r iudaltnlfetl() 2rr(rp;u0apt  ociydls2ulnvp;() lxomrcty1la rliei;s  2trxm iy1lpe mfciat)s2rrumo;t4oetoiiciatfs2eln o t)arxrmfcty1lm rlueo (0 2umxr oo4alt lfesl()s2taxm ;o1oeenmfctyt s em(mo t0tetrio3oy1fa   i s;t texo(o nydlm nmiesas srrru o;u0tpeoioetysls ul(mp;t) exomocoy1oaDe nvslt0t2tmxo oy1lp nlncta()sDtmxrpno0tpe mociltfsDrln pnu4trxnmocoodomD aies;(0srtr(opnudoltnmies ( a2ta(rp;t4tetoifetad sDranvo;()trxnmf3tydoaDeluei ()tetoxopny4openlicilsf rtax  oo4oltomfctlsfa ulnmpn(4texnmr3iodfmtr nvi;()trtrio3ou4am nlnvilsf 2um( pnt4opx mfcilt s rl(mpn() rxoio3oo1la eliesl()srum(opou4ope mfvt t aDrrx p;u0alxoii3iat a rlnmon(0aleoxf oydop  ln sls0srxmio3nydllt  ietl(f rua(rpnt1tee io3iatls uaump;() etoxo tydfaDe ues;(0 euoim3oo4om nmics ( a2trx o;u1apt  f3iatfm2ulu p;t4arxnif oatfp eauvs;s  2to(m3oy4optnmfvt s aDurumo;u0aee ioetld s2rmn p ()treoio totlp eli i t0 eum(o oo4op emfvi ( s2ua(moot0tpxnifeilsls eauvonu4texnio tatfatean s t)trum(m3nu4al emfcil(  rtau p;t4tle  octasfsDrm( snt4 rtnmr iodfaDr uvs t  etoir3iy4ome  nci sfa2umxmpnt4tlxniictyd a rl(mp (4arxrmo3oytfptr nes;t  rxmxrpnodopenmivtlsfsDumu ono1tlxniiciytfm rlnvp;(0 etoxf iytomt livs s0texrxr3oydlp n ivta()s2trum ;u1alx  feiatls ulumpnt0texnxf totoa eaieols0 2uoiopiy4lm e nvias) rtau pno1tet iociad m ul( p;t4aexnmoctatfmD au o s0trurio nodaltn ivt s)s2raump;t4oleniietys aDeaumpn(0tltrmociodfat lnvs;s) rtmimpoy1apte nvsl(  Dur(  oo1opto oeilt m elums u0trerxf3iydfa  an ils trto(rpoy1lpt lfvia( a2raumo;o1aex  fcild a ran pn()trerifcoa1lmt anvs (0s2umio3ou1amtelnvt s  2umurpou0tpenmoctlt s2em(msnt4aeeomociadfm  auei;()teuo(rpny1alte feta( sDtmu  ;u0oeeomociadls ea(vo;() ltomr3oodfa eauvilt trtrio3iodoltnlfcs (fsDum(r ;u0oeenmf3iltfmDelums () lxnmr oo1la ean s s0sexrxr oudolt  nvsat s2rrur ;u0teenifciatfsDul(ms;(4tetnxo oo1lmt lieo t s2urir no1lm  lietasf rtm(rpnu4aeeoif3ilsfs uaumo;t0 rtoxfcoatfptrau i t  2urimpiy4llenlfvsl()aDtmxmooo4tlxn i3tad sDrm(mon()arxnmf3oadla r u o;s tetmxr iu1al emfct t)sDraxmp;u0tex mfeildls2rl(msn()aexrifctodla   n s;s) etmxr oydllee nvias  2trum nt4tltniieils a ra(mp (0 etomocto1oatraueo t srtm(o3nu4apt  feilt artmurp;t4altnmfetasls2ea(vs;t) lxnxf totfp raneols) rxrir oodaptn ics sfarumurp;u4tlx ioeildfs2ua(vs;u4 rtoiocoodlaDelnvo;t teurirpiu4ol e nvs s srum(r nu0opt  octat m2ran on() eeoif iotlat  ieo t0sexrim3iy4ale  icilt s2rm(r ;t4openiieild m2ra(ms u) eenxr ootlaD livolt)s2tm(r3oy1ale lieilt  rrru pou0apxnmoeildfaDum(mo;(4arerircoa1omDrln i t) 2trxm3oudomee fciatfsDra(  nt4opxnmiciadfm rm(vs u4alenxr3tadlpt  iei s trxoio iydameemictas a2rm(r nt4altnmoetls aDrlumo u)aleoircoo1fate uvs;(  exr(o ou1ameelivsls artm(  ;u1tpt ii3iyt m2umums;u) rxomr iydom  aneo ()srumiopiodam elfcta()aDumumoou1teeo f3iadfa2uanmo t0 leoxr3ootfp rai i s)t2tmxmpio1amtn nci t sDua(  nu1oetomo3iaslaDumuvs u) eeomocootlmDr i ols0t2urxopiu1olee fvslt s2ur(  oo4apeomfeiatfmDulu s u) reomo iytopDeluvi s0s2toxo iydal e ncilt  rtmu  no1apx io3iltlaDrl(vp;u)aexrxrcoytla  ln s;s0 2um(r3nu4lmeemfct t  Drm(r no0oex  fcildfs2rauvon(0areoir iodfatrluei;()seum(o io1lle  iei s arrrxmo;o0tetn i3ilsla ranvp u)altnxfciy1fpD  nvil(  eur(r3no1op nmict s  rur(ro;t0oexomiciyslsDulnvo t)aetnir3tadfm e i ol(0t2urxo3nodap e nvsls arrauro;u0tlxoiieiysfaDean snu0tlenio iy1fpDeaneol( srurio3oy4lpe  nesls) 2ua(rp;t1oeeniiciatlaDrl( s;u0trxrif3ia1lmtr u ils t2uoir3iodop  mictls) Dta(mp;t0aleo f3ilt s rm(mp;u)teerxr iadfmteau i s0 etriopiu1omee fcils) rtmuroou4teeoif3iyt mDrl( o t0aeerxrciotfa raies s  rxoim3ny4lmtnmfei t a2um(  ot1oet mo3iytlsDumn o;u0trtomo to1fatr nvo;( tetmim3no4aptnlfeias a2urum ot0ope  oeiydfsDelnmo;(0aeeomr3iotlpt lieo ()trtrxmpnu4om nlfes sfaDtr(m no0ale mf3iadfmDrlnvp t) rtrxfciydopt  uvo t0teurim oydlp  lnvslt  2rmx o;o4aetomi3ild s uln p t)aeerxr to1fpDr ues t0s2trxmpoydom  mfesasf rumu onu4oleoiieiyd a ulu p u0aexoxr iytfateliei s)teurirpiodomeemiesls srumu o;t0tet  octltfm rmump;u0tetoxr iytlp  au o;t0trxmim nydoltn feils a2urur ou4tlxo oetysls2rl(ms t)teeoif todoaDeauvs;( t2to(r3iy1lleemivia(f 2tm(mono1tltniociytlsDeau o t4aeenmfcto1lm e i slt0teur(rpiodlme lnet s  2urxmoou4tpe iiciydla2emnmont)trxomo3iy1lmD lnvs t)s2xmxrpny1openlnci t)sDrr(mp;o1olen ociltfs2el(msn() etrmo3todfa   nvs ( trxo(m3nodlme  fctl() 2rr(ro;t1apxniietlt mDrmuvon(0 rtoif ootfpDeluvi;t  ruoxmpoudomte ncilsfa2taxm ot0altn octytfa ranvp;t0trtrio totomDrlivo;s0 eto(rpiu4omtn iet tfarrax o;u0tet if3ilt s rm( s (0aeenifcoadoa rlivo (0setoio3ny1apeelfesl(  2trxmpou0tltoii3iytfm2ea( p;u)aleoxo3ia1latran o;()srtoxr io4apeelfctltfa2rrurono4tetnifcild a2rmuvp;t)artnxf3iotom eai ils  rur(r nydapen ivi ()srtrurpoo1tet ifetlsfa rl(vp () lxnmocio1oa rai slt srtoimpiy1ope mnetlsf ruax ont1aexn oetydla ua(ms t) rerir3ootlmtrluvo t  rxmirpiudame lfcslt)s2tmum ou0tpt ifeiad aDeanvs;u0aetoxocoadfm e n i ( t2triopny4lmenlnetl(faDrm(m oo1aetnmi3tls m rmn s t0 rtnxrctydfp eau s s  etrio iydamt lfvsat aDrmxr ou0olto feiat mDrauvont4 rxomo tadopDr ivi;t s2to(rpou1ol n fct (f rtmxmo;o1olxniociydfmDranvon(0 reoxr3ta1lp eaiei;s)trtm(o oy4lmtnlfvil(f rtrxmonu4tlxomf3tat a rln o;t)tlerxocoatlpDe neils0setrimpny4ale lnvilt a2ra(  ot0tpxoifcildfsDemnvs;u4teermocoydomt ln o;()tetrxmpnu4olen nvsat  rrmur ou1tex mieiat m uanmsnt)tlxrmo totoptraueil(  rurxo3no1ape  ivils srtm(mp;o1tpxnio3iatfs2umnmp u4altrif3oa1lptelivs ()trtmxr3ny4lleelivtltfs2taurono1tpxomfcilt m2rmnvs u0aeeomf3todlatrli i;( trtm(rpiudlmt lfvsatfs2um(m nt1apeo oetad sDrmnmsn(0 lxrmo3tydfp r ieo t0trtrio3ny1ll  liei t)artmumpou1aeeomietatla2ranvsnt)texomfciytfaDeai i;(0texmiopiodlpte ieil(  Dtrur nu1aee  ictadfs2uauvs () rtrifctadlptrlnei ()seuoio nudaltnmivilt)aDtaurp;o1tet iiciatfa2ranmp;t4aexoxo tydomD  i olt0srtrim3ny4lmeemiesatfartaumono1alxnmiciydfmDelums;()aetoxf3oodoaDe u o;t s2uoio iy1opt  icsl()artaxro;u4opeomfcils m2el(mont0tlerxf ta1fpt  ivslt  ruo(r3iu4lp n nviasf 2tr(  no4teenmf3ilt m rmnvp t0tlenxfctytomDelu ol(0 etrirpiodom nmfet tfsrtrumonu0tet  feiyt s2umumo;() lerxo3ia1om eaues;( srto(m3oudolen iesas)aruax  no4oexnifeiat a2ra( pnt4aetnxrcto1fp  lieo (  exrim3ny1op   ivtas)aDrr(mpno4alenmfeilsfa rmuvo;u4teenmo iodlm e n i;s0s2xrxr3oo1om nmfvslt  Dur(rp;u1apto fciasfaDuluvsnt) rerir3oydfm e uvs;(0trumio iu4olt miei tf 2um(rpoo4opt  oeildfs2uauvp;(4 lxnxrcoydfpDelnesls trur(r oodom nlneiatf Dumum oo0tlx mo3iasfm eluvp;(4trtrifcoo1fp raueils)setr(opny4ape mieilsfs2ururp;u1tltnmoctytfmDua( p;t) rxrmrcoy1fptrlneolt0 2urxr3oy4alte ietas  Drmx  no0tlt  f3iadlmDra(vo;(4texoxocoydfpDrli s t0 etoio oo1ap nlieta( a2uaum ou0tpt moeiatla rlnmsnt) eerxr tydlp r u o;t0trxoxo no1ole mfvtasfaDururp;u0tpxn f3iasfa umnvpnu0 etnif to1lmtean s;()teto(opny4open ictls aruaxr ;o1tlt ii3tat aDelump;() lermf ootoatrli o t0trto(opnydale mivtat artrxro;t4teenmf3tat m rmn p u)arxrxo oydom   ivslt  euoxm3nydomenlfetat) 2rm( ooo1oltnmf3tydfa em( s t4alxnxo iodomt lnvi s0t2uoir nu1ll   neiat  Drmx pnu0aptnmo3ildlsDeau o ()tetrio3io1omtrauvo s)s2uo(r oodll nmnesls)sruau p;u4tpx if3iadls2rm(vsnu0 rxrmf iadfpDeluvilt t2xrxo3nodll  mietl( arua(r ;o4oexn ociadlmDulump u)trtomo3iodlat ln ols truoir nu1ol e ncilt)arta(m nt1aptomieildfsDeaums () leoxrctotfaD li olt0t2tmxm3oudopt livt s)s2rrxmoou4oetniicildfm ran p;t0artoxr oodlpDe n sl() ruo(o3oydol nlnvia()arrrumo;u4olxoioctytlm emu s (0tleomr3iotomD ln olt0trtrir3ou1ole mfci sf Dum( oou4aee  oeiadls ua(ms u) lenmfctodfp rau ils)s2tmim3iu4alen neil(  ruax pou1tpenmoetas s umu s;()tltrir oatfmte n sl(0trumxr iy1op n ncsls) ruaum ;u1texo f3iltlsDrmnmo;t)trxrir3oodopD aies;( s2trxo no4amtemictas sDrau oot4oex moeiysfsDrl(vp u0artrxfciydomtraueo;t0t2uoxmpno4oleemnct ()aDrm(mp;u4openmictaslm2emu o t4 eenio3todfptr u s;()srtoiopou4lm e nct ()aDumx pnt4ope  ictlsfa elnvs;()tlxnio ta1fmt  u ils0 eum(r nu1lltn fcslt)srrrx  ot0oltnmiciltfmDrl(vp u0treoxf3totfptelnvi;(  rxoxopiy4om nliei tfa2rrxm no1ope ioeiaslaDeln sn(0teerio3tytlpt  uvilt  euo(m3no1amt  nci ()artaump;o0ale ii3tatlm2um( pnu4tlxniocta1omteai o;t) 2umirpiu4ope  fvt s)arrrumo;t4tptomictlt s emuvs;(0 rermr iadoatranvo t)setoio nydole  fci s  2urumpno1tee mo3ild a umnms u4alxrmo3oytop ranvi;(0t2uo(m3iudlp nlncilt) ruaxrpno4olx mfeiatfa2eaumo;(0aexomr ta1lptr ivi t s2toxrpoudal nlfei () Drau  ;u1tpx mo3iydfsDranvp;t4arermf iadlaD  ivo;(  rtrxmpiu1omtnmiviltfsDrr(monu0texnmf3ias a2eanmp;u) rtnxr3totoa rau s s sruoim3oy1lme  fes s  rraumont1altoii3iat mDrlnms t)arxoirciydfaD  uvi;t tetmio3iy4ome livt s a2urxmp;o0olx  f3iytfaDrln pnt)trtrxrcoadop r i s;t0sexo(m3nu4omt  fes sfa2rmur no1tptomo3ildfm ul( ont0tlxrif3iadopDeanvo;(  rtr(m3nodom   nvs (  rrr(r ;t1teeo fciyt m uln s t4areomo3iy1fpDraivols)t2umimpny4op nlies s) Dtaxm ;u4oeeoii3iydlmDea(mo t0artoiocoy1oa eauvilt) 2xoimpou4lp n ictas)s2uau p;o4aptnmfeiat mDuluvpnu0teeomo3totopDe ieols0s2umim nydame mivs s a2trxm ;u1ole mieiat m2emump t) rermr ootoaDraieo s srxriopno4aptelfctlt srtrxmo;u0optnmieiltfm2rlnmpnt)tleomo3tatfpDrauei;(  2uo(m3oo1lm  mncta( artm( p;t1texn oeiatfmDrmumsn(4areomo to1op  auei (0trxrir3ou1om  lfes () 2rm(m oo0tex iocilsfmDrlnmo;u0 lxoirctatoptrau o;t)trxrim oudape mietl()s2rmu onu0ope mo3iadls uln s t0 rxnxo tytlpDrau ols tetmio ou4llen fcs t) 2urur no1tlt iictasfm rm(vpnt4 rtnxf oa1fat anvs;( teuo(o3oudomtn nvia(fsDrax  ot0optniietadfmDrlnvo t)artomfcootomtean i;(0 rxr(o3iudlme lnctltfsrururp;o4alx ioctlt m2eaump;t0tlxoxfctadfa e uvo;t)sruo(r oudaltnmfesltfsDrauro;o0opxomfciysfsDulnvp;(4 reoxr oadfat  u ols) eurim3iudlpe mfetls  Dtm(ro;u1optomictasla uan o;(4alermr io1lm e ivs;t)srxmimpno4altelnes (  rtau pnt1tet mociydfaDum(ms () rerxocoatop raues;s srum(mpoo1am elfct (fa2umx  ;u0ole  fcilslmDra(mp;t4trtrxrcoatfmtelies t)t2xoxo3iudam  lncilt srtaxr ;t1oleo fcilslsDrl(mont0tetoir3iodlmtrlnvs s)tetr(opiydolenlics t aDumx p;u4oexo i3tytfs2elumpn()trxnio3totfm e i i;s)s2ur(m3nodllt livsat  2taxm oo1teeo ieiysls2elumonu)arermf iytlaD
\ No newline at end of file
@@ -0,0 +1 @@
+nvi;t0texoimpny1lm  micsl(faruaump;u0olx mieias m rl( p (0trtnxrcoydop  li ilt  exrxo3no4lmee ics t)s2taur ;u0ape ioctydlsDul( snt0aexnxf3oodlmte uvsls t2xoio3iy1ale licsat srumur ;o1oexnmieiytla el(vp t0trxoir iotla  auvils  2umxr iu1oltnlivias)srurxrpoo0tlxomoctatfs rmnmo;()aexrir iydfptr ueils  eum(mpoodamtelicils)srrmum ou0tpt mfciltlmDel( p u) leoir oa1laDeai s;t) eumxm iodlpee nes ()aDum(  ot1texnmf3tysla em( o u)tetnxr3totlaDeaieslt  etm(opnodol elncsas artmum nu4aeenii3iytlm2em( s;t)tetoir iy1omDeanesl(0setmiopny4lm   ieias)aDum(mpou1aexo o3tat sDul( o;(0trxnxf io1lmt  u s;t  2ur(o3oy4altelfetas  2ur(  ;t0aptniociyslsDemump u) etrif3tadlpDrlnvsls tetmxo3nudapt mnesl()sDtmxm oo1oet iiciad aDua(ms u0tleoir3iy1fmtrli o;()trumxm3iy1lmtn fvi () rtaumpnt1alt iicias sDul(vs (4texnxrcoydlpt an sl() rurirpoo1amt mneta( s2rr(mpot0aetnioctlsfs2el(mo u0tltrir3tadla eluvils0trurirpnudopee nci t)srurxroou0teeo oeiat aDuau p;u)tetomociydla   uvs;()texmim3no1opeemnvs sfsDuax oou4tpx io3ias mDea( s (0tltrirctotomDr i ilt0t2xoio3iodole lieils)aDra( pot0optnmo3iydla rlumsn()tlerxo iytla rli o;s) rxo(opoydll n icias)arumur ot1oetoifcildfmDulnmo ()tltrir3iadfa rlneo;t  2trxm iy1al n ivsa(f rurxmoot0aetnio3ildla2ea( on()texnir3io1lpDrai o t) rurxr3nu1ll emies () Dur(rp;u1tlxo ictlt s2ulu snu0 exrir3oodfp  li s;t) rtoxm3nu1llte fvtl(fa2ra(root0apenmicilslm rm(vs t0artnmo iodlaDeau s s) rxrir oy4ame micias)sDtmum ;o1alt  f3tadla2ranmo;t4altrir iodom rlueols)srtr(m3ny1optnlfctlt  rurumpno1alen o3iytlm2em(msnu4 ltnifciy1fmDrlies t0setoxo3no4altemfei (f 2rrxr ;t4tlt  i3iadlmDulnvp () renxo to1laDrai o;( t2xmim3no1omeelnctlt)aDumumpnu1tlxomfeilsfsDean p;t0arermrcootopD ln i ( sexmir ou1lmt lnvsasf 2rr(r ;o4tpto iciltla rm( p;()arermfctytla r uei t0t2xrxopoydom nmivias arua(mooo4aexomictltfsDel(vpnu0 rxrmf3todomteaueo t)sexo(m iy4altelivi s a2tr(  ot0olxomiciatfaDrm(mp;t)tetrxf oo1oat an i t0t2xo(mpiu4op n fvslt)aDuaum oo0tlx  i3tld mDum( o u0 ltnircty1laDeluei t  rum(opnodlpeelicil(fa2taxrpno1oetniietat m uaumpn()texoxf ia1fptelu sls0 ruoxm iydolenmfvsasfsDuau ono1tpxomiciydlmDea(vs;(0 eerxocoy1lmDe ies () 2to(r3nu1lm   ivtasf 2umxroou4tlt moctldls ulu o;(4 etomrctadfmtran s () 2uo(opno1am nmfvil(f Dumxrooo0apeomocildls rau onu4arxnif3tadlm  lnvs;s sexo(o ou4lmt lfcil(  2tmum no1aexn i3iysfsDuaumo;u) ltnmf3todopteau o ()tetmxr3nydap  mnei t)aDtr(m ou0apeoifeildls ulu snu)aexnmo iydfp  li i;s0s2tm(r ou1amtnmies ()a2ta(rp;o0apen oetasla2rm(vo u)aetnxo3ta1lpte i ol() 2xm(mpnodam emivtatf 2rmxrooo4opt mi3ias aDumn o;u4 rtoxf3tatlat ln ilt) 2uoxm iu4lme lnvsatfsDraurpno1alx  fciysfa2elu o (4alenmrcootlpDelivil( srxrxm ny4omeelnvta(  2rrur oo1oet mfctlsls2rmuvo;t0 eeoxf3tadomD luvil(0trtoxmpny1omee nctls)aDraxmoot1tet mocils s uau sn(0arermociadfatr n o t)sruoxmpnu4altn ictl()sDumur nt1opxnio3tltlaDuanmonu4arxrmf3oydom  aivi (0texo(r3io4lp  lnvsatfs2tmurooo1oex mociatfmDrl( pnt)arxomr3todlpDe ues;t)s2xrxmpiy4aleemfeiatf Dra(rp;u4ope ifeiytls rmnmont)trxoxociatopteanvs ()srxmxr3ou1apeelnetlsf 2raurpoo0tle ioctaslaDrl( pnt)aeeoio tydfaDeauvo;(0teumxo3nu1ome mncslt)a2tmx ooo1tpeoiociyslaDemn p;(0 rtnmf3iotoat an s;t)sruoim ny4ape  ivslt  2rr(mpou1texo ieiyslm em(mp;t4trtriocio1opt  i ilt) rxrio io4lpe  ieiat) 2tm(m nu0alenmi3tyd sDum(mont4 rxrmocio1fmDeluvo (0teumim3oydap e iciatf Drmu ooo1oee mietyd sDeluvp u4texoif oo1fa   nvsls) eurxo ou1lp nlici s srumuro;o4opxoii3iat a ua( p;(4tlermfciydoaD liesls0s2to(o nudlmtemfesls sDtaurp;u4oltomieiasls elu snu)aexomr3iytla rln i;t0t2xrimpiy4llenlnvias)s2uaxm no4aetn fetas m2rluvo;(4artnir3iatomDr n i;t trxrxr3oy1ole mieslsf 2ta( pou0olxnio3iadls rlums;u0tetriocoo1lm   u olt)sexoimpiudamt lfvtltfs2rmx oot4oltoiietat m el( o;u0 exoio tadoa  ai o t)trxo(m oudomtn fesas  2rr(ro;o1oee mf3ils s umu on(0tleoxf3oodlpDrli sls0 rxmxr iy4ol nlietlt) Dtr(m ;t1tex ioeildfa eaums t4trxnio3io1oateauei;t)tetrxm oy1llenmnci ( a2tr(m ;u0tpt mf3tatls umuvsnt0 rxrxo to1optran ols0tetrim3oy4ap e feil()aDrrx pou1aleoifciad sDrlu p ()tlxomo3ty1lmte uvs;()truo(mpiu4omte ncs t)srrrur ;o4tetnmoetlslm elumo () ltnioctadfp e nvi;s)trum(opiu4llee nvsl( a2ra(  ;o1openmi3iyslaDemump;(0trtnmr3iatfmDeauesl( tetmiopiu4optemfciltfartmu  nt1aexoiietld m umn s ()areomo oytfat  ivo;t)srurxo3oy4apt  ietl()sDrrx pot1alt mo3iaslaDemnms (4tltrmf oo1lp  aieilt0srtoio3iodolte nvtatfaDtrx  ;t1teeomoeildlaDuluvs t4 exrio oy1faD anes ()seto(r3ou4altnmietat aDta(  ou4tpenmfciydfs2umuvonu4tetrxrcoatfmteln ols  etmim3iydlm  mfvi t sDrmx poo0aetnmiciys sDra( o;u4 lermf3tytfp  lu o s  2umiopny4lmtnlfciat arrrx  oo1alto fetatfm umu p;t4tleoif3totlmDeliesls0 2trio3oy4amen iei t) rur(rono0oet  o3ils m2eanvpnt4teermf todoptelu ils0teuoiopoodap nmneslt) rtmum ;t0aexomf3ildlm2ea(vp t)aexrxo3totlmt  nvolt0s2uoxr nydolt mnei (fa2rr( poo4opxn o3taslsDrmu p (4artomocoo1fa elneil()t2tmio3ou1llt  ncils sDtau  nu0tpen octls a ranmonu)tetrio iatfaDran o;(0 euoir3oodll nmnes s aDrmxm ou0tptnifcilsfaDelnvp;u4aleomocoy1oaD  nvo (0t2xmim ou1altelivsa( aDtmxmpnu1aexnmieiytfmDraumo (0alxnmo oadoa eauvolt  2tmiopiudam elieslt artm(  nt0tpe mfeildfa rluvp;u4tlenxr tydop rau o t0 2xoxr nodlptnmnei (fs2urx pnu0alx miciasfsDrl(mo;t)tlenxf3iodlmDrlnei;()tetr(r3io4alenlicilsfarrrur oo0tet mo3tadlmDelnvon(4 lxnmf totop  luei;t srtoimpou1lmenmnvsas) 2tr(mo;u1olenifeilsls um(ms;u4alxomf oodfpDelneils0 2xmxo3io4lmen nvilt) rum(mpno0aleomiciadfsDem(mont0treoxocoy1lp raieilt texrim3oy4am emfvi s sDrrur ;o0openii3tasla ul(ms;t4tlxnif oatfpDrli i t)s2urxm3oo4lmtelnvsl()aDtrxroot4openii3tlsla2rm( o (0teenio3oytfpteauei;s0sexrio iy4ope lfcils aruax  nt4optn o3tas aDuanmp t)tltoxf3iotfa r u slt) 2uoir oy1oltn fvt t aDrm(r nt4optoifcils mDem(vont0alenmr3io1op r uvs s0s2xoim3nu1ope lnvi t arum(mpnu0tleo f3tls s2elnvsnt0 exrxrciodfa eau ol()srxm(o oo4olt  ncil(faDtrxmo;o4oetomfeiys s2elumonu0aeeoio oa1opD livo;t  2toxrpoy4amtn fet t  rtrumpnu1optn f3tysls eaump;() eenxo oytlptelu s;s0t2xmxm iydoptnmicils) Drmu p;u1tet ii3iatfm el(vp;u4 exnxf3tydlatraues (  ruoxm3oy4opee iet (fsDtru  ot4aetomociadfs ua(mo;() ltoxo iytomDeanvi;t)trxrim oodolenliei (fa2rmxmont4tpxoif3iytlm2elump;(4 exnmocto1op rliei t  2uoio nu1ol   fes ( aDrau o;o1oltnifciysla em( pnu0tltrmr3oo1fmtelu o;s texmim3io1alenlfci sf 2rruro;o4texomf3iytfa2ra(vsn(0 reoir iodfa e nei;(  exoir3oodape lfei (fs2taurpoo0ape  i3iad m2uln pnu0aetrxf3ia1omte iei;t setmiopiu4lltnmicsas  2tau o;o4tle mi3tyslaDrm(mpnt)tlxrif3tatla r n o;( setoxrpoydol   nvtlt)a2raxmonu0tee ioeiltls uanvp t0tetoio iotlaDeln i;( trtoio3iu4lptn fei t)srur(mp;t1tee ifetldlmDean p;u4 lxoir tadlaDrlu i;s)t2urxo3oodamte ncs (f Dtaxm nu4oetomieilt mDemnvp t) eerir3tatlat luvsls0s2xmxo oydlltnlivtltf Dtmxrp;t1oltnio3iadfs2ra(ms (4 rxnxrciodla  auvi s)t2xo(opoydalt  iei t aDtrum oo4alx  o3iasfa2ranvs;u0alxnmo todfpD  ivo ( seur(m iydame mictltfaDumxm no4opx  oetadlm ulums;t4areriocto1omD ln sl(0teum(mpoy1ole mncil(fa2rr(  ;o0tpx iiciydfa2umnmsnu4aexoxocoo1lmDeanes;t seuoxm3oo1ol e ivt s aruau o;u0oet  i3tad m2el( p (0 eenmf iytop elieolt0 rum(opou4aleelivsltf 2um(  ;o1tpxnifciltlaDelnmo;t0arxrxr tatlmD  ieilt s2tr(o3nu1optemics tfa2rrumo;o0aet iictlt a2ulumo;u0arerxo oy1op eauvs t0trxm(rpnodlmtemfci () ruaxrp;u0olenmociatla rmu s t4tetnif3oodlate ieo t  exrxo ny4ap n fcsas) 2umuroot0tetnmoeiatla uau p t) eermocia1fm eln s t0 etoio oy1lm nmncslsfaruaumpno1olenmi3tltls2rlu s;()arenxf3todlpteluesls)s2uo(opno1openmncs sfaDur(  ot4apxoiocilt m2ua( p u4aetoxrctydfpD aivo;t)trumxo iy4lm e fcs tfsDtm(rpnt1tlx ifctatfs elnmsn() rxoxf3tadom rau i s)sruo(o3ny1olt livia(fsrua(mp;u4tlx ifctytls umuvpnu) exnir3oodfptrlivs (0texoio nu4omen icsat)arraxronu4tetomfeilt s2el(mpn(0 rtomfctytoatrauesl() 2ur(rpnu1alee ivi ( sruaurooo4tpx mfcilsfa emnvo (0tlerirctytomte n s s0setr(rpoy4al  liet sf rtrxroou1tptn fcild aDumu o;u4aetrmf3tydomD lu sls0 rxrxrpoo1om emfvta()arrr( pnt4tle mi3tytfa ul(mp u4 ltnmr3ta1oa e u slt)t2xrim nu1optelneils)aDua(  nu4tlx ioeild m ean p (4 exnmf iytla r iei () exo(r3iodomtn net (faDraum nt1teto oetydls ea(mp;u)arxoxociodfp eaiei ( sruoio oydole mneiasfaDtrx ont4apt  i3iasfm2elums;(4artrmoctodlpt anvo;t) rtrxo oodlm emnetas)sDtau oot4oeenii3tlsls2rmumo t) rxrifciadfm ran sl()srtoio3nudlle micsat arurur oo4oexomoeiyt a2rluvo u)arxnio iadfmDrlnesl(0srtm(o ny4lltnmiesls) Dtmurono0opxnmoetyt s ua(vs;t0tlxoif3tydfa e uvo;t0sexoxmpiydam nmnvslt)a2taumont1aeeoioctatfmDeaump t)aexniociatop   uvo (0trxr(o iydlptelfei (  2trxrp;t0alxomfctadfm ua( snt)alermf3io1fa eau s;t0t2xoxmpoudop emici t) Duru pnt4alxoioeiyslm2elnms (4 leoxr3to1omteauei;t) 2trxrpoy1ll elfvt sfs2taxr ou1olto feilsls umn s (0 rtrxo3oydlptraues;s0 eum(r nu1op n ivta(fs2ur( onu0aex mieiat aDuluvpnt4 etnmrcoa1lpt aivi;(0s2uoxmpiudam elncil()srtaum nt0tlen i3ilt m2rlumo;u0 rerir oy1oaDrau o t  rtm(rpiy4ope  fcia() rraurpno4oee moeiysfm ulnvpnu) rermo ia1fp raivo ( trtmxo io4lltnlfvtat)sDumuro;t4altoioeiysls2ra(von()tlxoxfciatfp rln o;t) 2xo(r3oodll  lfctls) rtmur oo0tpt  oeiytlsDea(vp u)trxniocta1lptrluvi ()truoxr io1apee fvs ()sDtaxrpou0ope ioetydfs elnmo;u0 etrmo3iytfmDeanvs;()trto(opoo1om nlfvs s sDrr(ro;t1tet moetlslsDrmnvsnt0 exoio ia1fmDean o t0t2uo(m3iu4oltemfcia()sDur(rp;t1alt mi3tyd a ra(mo u)aeerioctotlp r nvs;(0srxo(m ny4omtemfvias aDtmur ot0olx  o3tydlm2elnvs;t4 reoxf oa1lat an o s t2xr(opio4oltnmivtls)a2trurp;o4tetn f3tatfa ea(mon(4arxrmf oodoa   ivilt trurxm3iudomtnlfvias aDua( ono4tleomictyt s2raumsnt0 rtnmfcoo1om rau i s  exrim3iy4lle  fctl()a2tmumo;u4oetnmoeiadfs elnmo;t) ltnmrcoytoaD aieol()seum(mpio4lmen ivsl( a2ur(rp;u1oee  oetad m rluvo;t0teerxociytoaDraneo;s0truoxo no4ome  ncsat a2umur ot0tpxnmoctasfa ra(monu4tetoxr iytfp eanvs (0srxr(r3nodomt lfvt t sDumx o;t1alxnmfeiysfaDeanvp;u0 etrmfcoo1latelieil()truo(mpoydlpe lnct tf 2umu pou0olt moctytla ul( o;() exnmf todfate i ol()sexm(o oy4ape  icilt)a2trx onu0tpeo ieiltlsDumnvp;(0teerxocta1faD anvilt0t2tm(rpnydlpeemnvt s  rrr(rpou4apto fctysfa rm( o (0alxoxr todfpte uvo;()srur(r3oy4lptnmnetat sDrru pot1teeoiiciytla2ea(vsnt0areomr3oydom raues;t) etoxr3io4omtnlivslt s2tmx  no1opeo i3tys s ua(mp () etrxrciadfa rli i ( s2umxo3oy1om nmncsat s2tax p;u0alt ifeiydlaDra(vont) lerio oa1fp e nvilt  rurxrpiu4al nlicsas)arurur ;u1tpt  oeias s uanvsnt4arermo3tadlatrluesl(  etrxmpnudlmtemfet t sDra( o;o1apenmi3tld s elnvsn(4 lxnmr oo1lpDr i i;() 2xrirpoudlpeemfciat)srrrur oo0oleoii3ildla2ul(ms;u4 ltoif to1fa rau il( t2xoxopny1apte feiat aDta( ont4opxnifeiat a2eanvs ()texoifciadla  aies;t srto(r oydoltn iviasfs2ua(r ;o1altomf3tas sDrmn o;u4areoxo iotlm  an slt0seum(r io4oleelicslt)arra(mp;u1open feiydla rmuvpn()aetoio ootlm ean s;(  2xrir3oy1aptnmicil(farta(mpno0tpe ioeiydfm rmuvo;() rtnxf3totlmDeanvi ( trtmio3oy1lm emict s)sruax ooo4tpxoiietydfaDem( s t) exoioctodla  ln ilt0 ruo(opiu1amtn fcsatfaDurxm ;t4oleoii3tltfsDemnmp t4 lxnxfctatla eaieils  exmimpiy1am  lnvslt)sDrmu o;t0tptoiicilt a2ean o;(0alxrxocia1fpDe uvo t0 euriopny4olt mncil( srrm(rp;o0aexomfetydls emnms;t)aeeoir iytlmtr nvolt0setrxrpoudopte icslsfsrrax pnu0oltomi3ildfs2rmn s;(4 exrxf3ootfmt luvols  etr(r no1al nmfesasfartm(  no4oee mfeiydlaDrmn s;u)tltomf ia1lp rlnei;t) exr(mpno4om emnctltfa2tmxr ot1altomoeilsfaDeluvo t)teermo tadfmDeai sl(  2to(m3io1omen nesl(fsrra(monu0oexo octatlmDemuvs;u) ltrio3oytlm e iei;( s2tm(rpoydamee iei (farrru oou1tpt io3ias a2uaums u0 reomr3totop ran i s)srtoir3nu1amt  fvta(farumxro;u0tpx mfcilt a2ulu snt4aetomo ta1fmDelivo t)setm(o3oydal e nvtltfaDrrum nu4aetoio3ias a rmuvpn(4tlxnxo ta1lpt  uvo;t)s2toir oo1amt miciatfsDtm(root1ope ifeiatfm2em( snt0trxnxr3iodfa   ieil( seurxr3nydlmtelivsa( aDuau o;t0tle if3iytlaDeaump t4tleoir tytlptrln ols0srxmimpno4altnliviasfaDumx  no0apt ioeiaslm2rlums (4teeoif oytlp rlivs ( sexr(rpno1amtelnvta(fs2rr(mpnu0alx ioeildlmDea(vsn()texoio3iotfa raneol(  eur(o3nydal emfvi t)s2urx ont4tetomo3iasfm2eanvp (0tlerif3tytlat livi;t0 eur(r iodopenmfetls)sDrm(mont0oeeniieiatlm ra(vp;u) etnio3tadfa  ln ols) 2uo(r iodal emfvi ( a2uaump;u4aetniiciadfm rauvo;() exomfcoydomD aueo s0teumxrpno4oltemfvsat s2ua( p;o0tetomfeias s eanmsnu4aetoxf3oatfp   neo;t srxoxmpio1omeelfet t s2raxrpot1olxn fciat s2ea(monu)aexoirciytopDran i s)sruo(r3ou4lmt  nvia( sDumxmoot0oexomfeiadfmDrmnmo ()arerxr3io1faDrai s;s0 rto(mpiy4omtnlfci (  Drmump;t0olxomiciasfm2rl(vs;t0tlxoxo tydfmt lu o;t)t2um(opou1ll  mfcs t aDrmurp;o1texnmoctytla eln p;u)trxoxf iadfm eaieo;( sexrxo ou1ap emivtas)srrru pnt4olx mi3taslm ulnms;(0aexoir totlateai ol(0 2tmir iydam  livsls s2umxm ;u1apxnii3tls a rlu o t) eenio ty1lmDe nvs;( trtoir3nydol n nes (  Dra(rono1olx  feiadlmDrm(mon(4 rtnxociytlpt livi;(  exrio3no1op emici s) Dtr( oou0ale ii3tysfa2rmnvsnu0 rtnxrciadop raueol( s2uoir3iu4lm nlfvsas) rrrum ;t0tlx  i3iat s ra(ms u) renxo tatlm  li olt0texoxr no1ole mnctls  Dum(  ;o1aetomfcildfsDemn p t0 exrmo3iadoaD au olt0tetmxrpou4alenlivtasfsDraur nt0tee mo3ilsla2rl(mo;u)aeermfcoadfpDe ivsls) 2uoxr ny1omtnmnctas aDtru pno4tltniociydlaDuaumo;t4tleomo3oy1optrli o;s)t2umim iu4am emieias aDtmuroou4oexn ieiadfm2rlnmpn()teeoif tytlm ran o s srtoirpnudamenmnvias) 2ua(monu0olt  fcilsla eluvp u0tleomrcto1lm r ieo t texo(o3no1ameemncslt aDtax o;t4ole  f3iyt a rm( pnt4trxoxr iy1lpteluvils0trto(o oo4am emnvsls) Dta( pnu0tpt  f3iydfmDrl(mon()artoir3oydlaD aies;(0 exoxmpoodamenlfvtlsfs2tmur ou1olxo oeildlaDuanmp (0texnio3oadfp rluvo;t  2toir iu4om  lneta( sDtmxmpot0olx ioctas m eauvo;(4 exnifctotlpt auvslt0trxm(opno1lmeemnctatfarrrump;u1oeeniieiad mDumnms;(4tltrxfctytfatrlnvo (  2uoir3iu4ol   ies t aDurxm ;o1oleoif3iadfm2ul( sn(0trtoio tydlm ean o t0t2to(mpno1open fvs (f rrmu ooo1ape mocildfm2uanmp;t) lerirciydfmt lnvi;(  eurxo3iu1ol   fcil()a2urumo;t1teto ietldlmDuan o;t)aetrmr3tydlmtraues t  2xm(m3no1al   ivi tfsrur( ono4apeoii3iaslaDumums u4altrif3oatopteaneo s sexrxm nudlme mfcsls)aDrrx o;u1oee  f3tadfa2ulnvs t4 rxrmfciydla elieo;s0t2xmxm3iu1ol n ivs tf 2rr( pot1apx io3iasfs em(mpnu4tetnxr3oatop eauvs t0 2umiopou1lltnlnesat)aruaxrono1aetnif3tld s2ua(von(0tltnxf3tadoat au i t seuriopny1op e ieta(farrm(rpot0oeto oeild m2umn sn(4alxomocia1fm   ivs s)trum(o3no1ap  mfeil(  Drau ooo1alenmictys a ra( s t)altoxo tatoa eluvs s0 rtrim io1ll   ncilt)sDrrumpnt0aetomf3iatfaDrmump;(4 rxomo3totfmtelieolt0 rumir oodape mivtasfs2umxrpou0oleomi3iltla elnvo;u4texnxo tytlat lu s;() rxriopoy4lpt mnei t a2ururpou1opeo ociltfm2ulnmpnt)trxoxo3oy1lp  liei () etoxrpou4omenlivilt arra(  ;t1ale iietlt m elnvpn(0texnio3ta1fpteln o s)tetoxmpio1lm  mies t sDuru  ot4tlx iociysfa rauvo ()trxrmr3ia1fp   uvi;s)teuoxmpoy1lptnmivtltfaDraxmp;o0aexniiciltfaDrmums t) rxoio oydoa raues;t  rxmxr iodlpenlfei s)aruau  nu1oet iieildls2uluvp u0 ltnmo3oadopD auvi;()s2toxmpoy4lptelivs (f Drau p;t1aet ii3ias s2ul(vp ()alxomo3iatlp rau o s) rumxr3nu4lm nmivs tfaDta( o;t4aptomo3ild s eau o;u)aetrxocoytla r i o;t)trto(m3nu1ameemfesl()aDtr(moou0olxoiietld s ulump () lenxf3io1lmD  ivolt)t2xoxr3io4lme lncsltfsrtau pnu4tetnmoetyt a rln p;t4teenircio1lp  lnvo (  rxm(rpoo4opt lfcsl( s2ur( onu0tlx iietldlaDul(vonu)tetoxo io1faDr iesl( seuoir3iu1oleelfeia( arraumooo1ope ii3iydla el(ms t) reoio3oa1lmt aues () rtmxo3nodalenmnviltf Dtax oou4aeeoiocias m2rm( p;(4aetomrctydomD aueslt0trxr(r ou1altelfcs t sDrm(m ;o0tlx  feiydla2uln o;t0tltrif3oadfmDeaivo s0trxr(opoudop e fcsa(faDtr(rp;u0tpxniictldfm2eln o (4altoxrciy1lpt ai ols0texr(o3nudame licsa()s2rax ooo0tle ifetasfs el(ms u4 renxf3oa1fa rauvo () 2ur(m nu1amte fciltfarur(rp;t0tleoiictaslsDemuvo ()arxnio3oydlp  au i ( seuoir oy4llt lfvia( aDumxm ot0oex miciysfmDrmu onu0aexnxo ia1op eaieo;s s2uoim3nudal e iesa(f Dtauroot0altnifetytfs2eau o ()aetoif ia1fpD ai slt0 2toxo3nydolt mfctat) 2um(r no0aex  f3iytfaDrm(vpn(4trerirciotfptean s t0seurim3no1lm emfeil(fs2uax pot0aetoii3tydlm ra( p;u4arerxf3iadfmte ieslt)setmxm3no4lp e fvsasf 2rrx o;t0aee miciysfsDrm(mp;u0 exnmf ty1lmt anvsl()texrim iudoptn ics (  Durur ;t0aexn ieiyt a2em( pn(4artnxo3to1fpD luvsl(  2tm(opnu4op nmfcsa(fa2rrurp;t4tlt iictlslaDeanmsnu)tlxrmf io1oa  aivo;t t2xoio oy1omtnmivs () 2rrxmoot0optomietls s2uaump;(4 eeomo3oytfp rauesls  eumxopnudlpt  nvtasfsrtm(  ;o0tlx iiciyd s2elnvs (0aleoxrcoo1lpDeau o (  2xm(mpnu4omenmfvia()s2tr(mpnu1tpx  o3iasla2umuvpn(0treoif totlaD  ieo;s)sexo(rpiy1op  mneta(fs2taum ou4oeeo ietas aDul(ms u0tetnmrcoytoatrluvolt0t2tm(m no1lmenlfcsa(farurum ou0oleoiieiat aDuaump;u0teerif ty1om r u sls0tetm(o3oo4opeemivt t aDrrx pno0oexnmf3ils sDrluvpnt4aleoxocootoaDe n i;(  exoxo oydomenlieslt)s2tmxmpnu0tlxnmfeiydfmDumu s;u4trxrmo oadlmD lnes;t trtrxm3oudal nmnvsa() Dumu p;o4oeto iciadfa em(ms u4trenifcty1opDe ies t srtoim ou4lleemnctltfsrraxmo;u1tpen ietys sDel( s t) rtrmo3oadfaDeai ilt) 2xo(m3ny4lme  netlt aDrmu  ;o0tex miciatlmDemu p (0alxomrcta1fp eauvs ( sexmxmpno4ope  fcta(fa2tmurpot1apxoifciasla2ra(ms;(0 rxomociotla raivs t0s2xoirpoy1aleelicias)artrx  nu1opeomf3iadfa rl(vp u) rxomrctodfate uvi;() euoio3nu4ale lneil(fs2tr( pou4teeomoeiyslm eau on(0aleoxrciadfaD  n sls) 2ur(o nydolt  ivt ()s2uaurono0apeoio3tyslaDumumo (4tlxomf3tytfp  lieilt0 rto(mpiu4ameemietatfsDtm( ono0aee ifeiydfa2rm(mo t0 lxrxo oodopt ai slt  rtoxmpiu1ape lici tf Dtau ono1tlxo i3tlsfmDeluvo (4aetrmr3oa1lmt au o t0 2tr(m ou4omt mnvtas)s2rm(  ;t4aetnmieiaslmDea(vs;t0artrmr iy1fpt  iei;t0 rumxr3oydlpe lictat  2rmxr ou4tlxoioeiyslsDemu onu) reoxrctatfpDeaues () ruoxrpou4ap nlneslt)arrr( onu0tetnioeiyd a2eanvpn(0alxrirciydom rlieslt0t2uoxm3ny4ll  lneslt artmum nt1optoiieiytlmDean onu)tlerxf3oatop rlu ilt seuo(o3ny1al elneiasf rurumpno0tlt mi3iyd sDuan o;t0 rxrmf totlm  auesl(0sexo(rpou4lmeelfetl()sDra(m ot4altoifciydla2umumsn(4tetrif3todfaD  i o (0seurirpiudomtelnvi tfaDtr(r no1oexnmfeiydlsDemu o;t)aeeniociatlptelueilt0srtoir3no1omeelicta(f rra(m ou1olxnmf3iys s umuvon(0 rtomo iadlmDr u i;(0teurxr iu4om  lfesat)arurxroot4opeo f3iysfmDrmnvpnu0 lxriocoa1fm elu ilt0 2ur(m io1al e net ( sDtax  oo4tee  oeiltlm eau p;(4 leoxrciodfmtrai s;(0s2xrxo oy1oltnmfvt ( a2rmx oot0aleniictlt a2uluvo;(0aexoxocoydfp eaivsls  rumirpny1olt lfct ()a2um(rpoo0aetoiietatlaDem(vp;u0trerxf3to1fmt lneols0teurxo3ou4lleemieilt  rumxro;t0tpt  ietlt m elnvpnu4tleoxfctadoptraies ()setrio ny1apee nvt (f rtrur ;o0tlxoif3ias s2uluvp;t0trtrxf3ia1lpteaies ( setm(opoo4op  mnvi sf Dtmxrp;o0oetnioetltls2ranms;(4aleoif3oa1fm  auvi ( trur(m oo4al   fcilsfa2raumpnu1aptniociltfaDea(vpnt4 lerxrcoatfateli s s)sexmiopoodlpt  nvsl( a2ra(mp;t1alxn icils s umnmp;t0areoif iytfmtelueo s0 eum(m3oodop nmfcias)a2taxmpnu1ope ioeiaslsDrm(vp;u0 exrir3ty1omte ueols s2toxrpiydlp n neslt sDrrurooo4aptnmo3tls m umnvs (0 ltomfciy1oat livs t) rxoxrpnudlp elneilt aDrm(rp;u1teen o3iyt m2emnmon() rtnxr3ia1fatelneo;( s2xoio ou4lltemfeiat) Durxrono1alxn octld aDra(mpnt)texomfcootom elieils0teuo(m ny1lptn fvs s)s2rauro;o4tle miciydfm2um(vp t)texoxo to1laDrlueo t seurio3iu4ap   fvt s aDta(m nt0aexn oetls aDul( p () etoxfcoodlmDeaivs;t)seurim nu1lmeelies (f Dumumpoo0oltn f3iadfm ean pnu0alermo oatlat aivi;s)t2umxm3iydlltnmncs s) rrmxm ou1tptn o3tasfs el(mp t4texrmfcoytoaDr u sls0 etm(m3ny4alenlnvs ()srrrx  ;o0ope iicilslmDrm( p;u) leoir3ootlmteauesl(0 euriopoydolte fvi t)aDurxmoou4apenio3iasfaDrmu s;u4altoio ty1lptranvi () etr(r3iy4amee fvslt) 2rmuro;o1tlt ifeiyd s umnmo (4alerifctydomD lueil(  2xoir iy4al   fcsl()aDrax o;t1tlt mocias m ulums;t4aetriociotlpt li il()trxr(r ou1lptn ivtas) 2tmxmpnu1apt ifctls m umnvsn()trxomr ta1latrluesls0trto(o3nodoleelnvt ()srta(rono1ale mi3iadla2uluvsnt0 etrxr tadlm e ivo (0trtmim3io4apee ivilsfaDraxmp;o0texo i3ilt s2eanmp;t4 rxoio3to1fmt anes s t2xr(o ny1ope lnci t)aDtaxmpot0tex mo3iyd mDrmuvo;t0alxomr tytlptr ivo (0tetmim io1altn ivsasfaDum( ono0opt iociytlsDumu s u)teenir iotlpD ai slt0texr(mpnu4lpenlict tfs2rru o;o0tee if3iyt s uanms u4tlxriocoatopD luvo;(0srto(m3nu4openlnctlsfs2taum ou1apen icildfa2um( s;(0trtoxo3oa1late u i s)sruoiopiu1ll  mfcia(fa2uaxro;t4alt ii3iytlsDuln pnu)alermf oadlptelivi t)texoiopoo1oltelfeil()a2um(  oo0oleniiciydfa el(vs;t) lenxfcoatlpD  uei;t0seuo(mpiy1aptnlfeia(faDrr(m ot4altoif3iydlsDea(vs;u4 exomo3todlat  ieo t)srxoimpio4opte fvia(  2umumonu1ape  icilt s rm(vont4altrxf oatfpDr nvs;t0seto(opiodape livil( sDur(  ot1oexnmf3iyslm2rluvsnt0alxomo oa1om r nvolt srxoiopnu1opte ivil() Drrxrpnt4oee mociatfm uaums;t4aetrif totoateaneilt)texo(m3iudopeelivtat)a2tmum ;o1tet moetasfs ea(vp;u0 rtrxfcta1fptelnvo;(  2toxrpno1lpenmnvsa()sDurumono4tlxo fctasfa rlnms;t4 exrxf oadfpteai i;t s2tm(opou4lme  fvt t) 2tr( p;t4oeenmfeiyslmDrmumsnu) ltomr3iy1lat auvsls) ruoxmpny4al  mneil() rrmur ;u4apeniiciadls2uanmp;u)aeeomo3ta1opteln sl()srum(rpoo4ll e fci ()a2rax pno4ope mociadfsDea( p () eenxociytopD ln s t teuoio3ny4apte netltf rurxro;t4apx miciat m2rauvs t4 ltnxo ia1oaD aivil( texo(mpiodolte nct ()aDtrumo;u0tet mietydlaDum( ont4alxrmr3oadfmDraivi;()srxr(m oy4lle mnctltfa2trump;o0apeomfciad sDrl(vp (4tlenxr io1op r ivslt0t2tm(r3iy4ll elnet tfartmu  ;u1aetniieiat m2umu pnt0trxoxrcoytop   ivi s srtm(m oodomtnmiet () rtau p;t1oeto feildlaDel(vo ()arermf oadlmtrli i;s)srxmxm3oo4ope  ncs (fsDtaxm oo4oeto ieiat a raump;t0alerif3oodlm rlivols  euoio3iy4om nmivils)srtm(m ;t1tptn ociltls2rl( p u)altoir3oy1oatelueils0t2xrxr3iu1lmee nvtls)aDrrxm no1apenmo3iys m2ua( snu4aeenxo iadla e nvil()s2uoio oo1opte fci sfsrtaxr oo0tee mfeiyd sDrmuvon(0aeerxr iatopDelnvi;(0 eum(m3ou1altn ics s a2rax ono4opxomfeilsfs2emnvpn(4aleoxfctotoa ranvils  etrxr no1lmeelncs () 2rrxr ;t0apenifcias s emu onu0tetoxo todfp elnes t)t2tmio iudoleelnvt s  Dtrurp;o1tltomo3iadfmDraums u)tleomrcty1fa eaivi;t)teur(r3oydaltnlicias)a2umu pno0tleo octyd mDul(ms;u) ltnmo3oo1fm ranvi t0truoimpoo1am e fvilt  2raumpoo1tlxnmoeiydfa2rauvs;(4aetnmf3ia1lptrlivi t tetrxm3iu1opteliesa()arrru o;t4olxo i3iatfs2em( o t0arxoxocootoptraieolt0 euoio3iydame mfeiatf 2taum oo0oet  fetlsfa em( ont4texoifcoadom  ln il()srxr(r3iu4llenlfetl( a2umxm nt1tpxnmf3iyt s emuvont4 lxnir3iadom eli i;t) 2xoxopnudoptnlici tfsrraur ou4aet mfetatlaDel( pnu4altrif3oa1oa e nvs;( s2ur(rpiudomt  nvs ( aDurx ooo1teenifeiatfaDelu s (4alenmr3iodfpt auvo s) rxm(m3iu1al e iei t)artr(  no0altomfeiyt mDrauvp;u0tetnio3tadla elieolt0sruoir3oudlm  mncslt sDtrx oou4aeto oetldls rau snt4 lxoxr3iadfaD ln i s0 eur(o ou1omtnmietas s2tm( onu0tlxn ociydls emu o;u)teeomf oytlpteanes;s0 2tr(mpoo1omeemivils) 2rmxmooo4tpxn ociyslmDem(vpnt0teermr iydomtr uvo s0trtmxo3iydam n nei s)aDtmxmpnt0opeo f3tys sDrlumon(0 rerxf3iatoa eau i;t)sruoxr3oo1lp elicsatf rrmum nt4olxomo3ilt aDuauvsn()trtrxf to1fpDrli o s0 rtr(m ou4olte fvtl(  Dum(  no4tltoifeiat m ul( sn(4 lxrio3oa1fp rlneilt setr(m3no1optnlnvi t)aDtmu onu1aee iictldfm2ranvo u4artnxr todfp r n slt)srxrimpnudopte fvias)s2uaxmp;o1alto octytfs2rln s ()arenxocoodomDrlivslt0seuo(r nydop emfvi (fa2tr( onu0olx ifcilt s uauvs ()artrxf oadlmt auvils) rxoio iudolt mics (f 2rmurp;u0alenmf3ildlmDean p;(0trenmo iydlaDeauvo;t  rxmxm3iy1amee ieilsfsDurxmooo0tet moetyslsDumnms;()arxnio3todop elnvo;t)trtoxm oydal nmnctlt srumu o;u1teen feiat aDea( pnu)arerirciatfatelnvo;s) etr(r3nydlmte fcsls  rrr(  ;t4apxn iciytfa ul(msn(0 exrmo3iytopDr n i t  rurimpoydomte nei (fartrxm nt0tlt mfetys a2rmn pn()aetnxocoo1lat aieil(0s2trimpoo1lmte nci ( aruaump;u1aee ii3iydfa rm(ms u4texnmf3to1lpDrauvilt0t2xmim3io4alt  fvs sf rrrx  ;o1alxoioetltfa umnvo;t4texoif3oy1fptraies () 2to(m no1op  mfctls) Dtaumooo1aet iiciat m2rmu o;u4 exnxoctotfpteln i;s t2xoxo3oo4alen feslt  Dra(m ;o1oetoii3taslaDrm(msnu4 rermf3tydom e uvo;t0 eumir3io1ap n ietl(fsrra(mpnt0aet mi3iltlmDrl(vp t0alerir3oadfp eaueslt sexmxr3oy4lpenlict () 2tr(  ot1teto oeils mDulnmo;()texnmrcoatfpD  nesl()t2xmim oo4op elics t) ruaxmp;u0tpe mf3tyd a2ul( o;u4 ltnir3ta1oaDrauesl(  ruoxo nu1alt  ictatf Drm( p;o1aet ii3iad mDumuvo (4arxnircoodlpt  ivs (  exmim3ou4apen ncs sf rur( ont4altoiietlsfsDrmu pn(0tlenmr3ia1lmDelivsl(  rtoxm3iu1ll  lnesatfarumu pot1tptoif3tyd a rmnvsn()teeomo ty1oatrln o;(  2uoxo3oy1lp e ieta()sDuau pno4opto feiltlaDelumo;()artrmr tytomtrlnei;s0teuoxm no1lleemfeiatfartau pot4aleoioetldlmDeln snt4texrxf tytoat lnvil(  exrxo3oy4omtn ivs t)srtmu p;o4oexomi3iatls2ean o t0 rtrmo3ta1oa eaueol()trtrxo3no4lmeelnvs () Drr(r nu4ape  i3ilsfaDuln p;u)trtoio iodfm rlnvols0trxrxr oudoltelfvia()srrrxrpou4oexnmfctat aDelumsn() ltomf tydla e iei (  etmir3nu4olenlfeias)sDumu  ;t0oex mi3iydls ulumon()tlermr to1faDrlnvsl(0teur(m nydopenlfct t artr(ro;u1aexn ocilslsDum( o t)trtoif oa1fp ranvi s  etoio3io4lmee nviasfaDumur nt0oltoioeiadfmDranvpnu) rtrircoydoateaivo ( s2xmio3oydamteliesl( sDtr( onu0oltn o3iat sDea(vp;t) ltoircio1faD  i i;s) rxoxopoodopt  feslsfs2umum ot4olto o3tldls2rau p;u0arxoifcto1la rai sls trtmxr3ny1oltnlnei sfaDrm(rooo1oex mi3tysfs2raump t0artnir3oy1oa elivi;s seuoiopnodlpenmici (fsDumxm oo4tetn feilsls ra(vo t4alxnmocio1omtrli o;s0s2uo(m3oo1olee ivsat)artax pno4aetniociat aDrlnms;u0teenmrcoy1lmDe neils0srurio io4amtelnvslsfsDur(rono0oeeoifeiydfmDrlnmp;u0tltnif3tytfm elivi ( tetr(opnydom emnei tfartr(ront0tptnmi3ilsfs2umnvo ()arxoxfcootoa eaies;t0teuriopou4ap n iciat a2uax oot1tltnmf3iysfm ulnvs;t4 rtomo oy1lp rau i s0teurimpny1altn icilsfsDuaxrpou1ale mi3tatls emuvsnt)aexrmf totopteluvsls srtm(o nodlpee nvsas)a2tmuroot4oexomietys a eau pn(4 rtoxf iadfp r nvi;t0s2xmxm3oudlmtemfeia() rtaxroou1apt miciysfm2rlums;t4 exnxociotfaDelu i ()teuoxo3nu1aptemiesat)sDurxm ;t4optnifeiydla rl(msn()tleoxo ty1om e i il(0t2urim oudll n icta() 2trur ;o0ole  i3tldfaDea(vp;u) rtoxo to1om  aueol(0tetr(opoo1lmen fesatfsrrmu p;o0tpe iiciytlm ulumon(4 rxrmo oodomDeaiei t0t2umxr3ny4omeelncsls  Dumxmp;o0aetnmfeiaslaDuan ont) lxoxociatfat  n ols trurir3nodopt mivi tfaDtmu  ;u4oeeoif3tlsfm2um( pn() ltrxo iydlm rau s;t) 2ur(o3iy1lptnlict (faDta(m nu1tptoiieiydfa2elu pnu0 rxrxf3oadfa rlneil()trtrxrpou1lmen ncilsfsrrr(mont1aee  i3iydfs2rl(vont)tleoxoctadfp ran o (0 rtoxm3ou4lmeelfetls  Duaxm nu1tle mfciysfa2rlu sn(4 exrio3oydfm r ueilt0 eurir3nudamenlnciat)aDururpou1tlxn octld aDrmuvp ()texrxr iydfa e u i;(  2xoxm3nydlm e fctl()srtrx oot1oltoif3iadla2uau o;t0trxnif iadopDe ieslt0srtoio nu1ole mnesltfs2rruroou1teeomietldlm2umnmo;u0tltnif3iadfm eaneo s0texm(m3ny1lle lncta(fartaumpnu0tltoio3tydlm2eluvon(0teenif3oa1faDr n o ( texm(r ny4lle  ivt s  2ur( o;t4aetniictadfm2eaumo t4teerxf ia1lm rlnvi;t texr(m3iy4ol e nesat  Draxmp;o4tltnii3tasfs2ulu s (0altoxf3tadfatelneo;t teumir ny1am emiesltfaDtrx o;o1tpxnmo3tydlm raums t) rtrif3iotoa e ues;t  rtmxopnu4lp e fet t s2tax  ;t1oex mfciltfaDrl(vpnt4trxoxf3oy1fp e u ilt  2xo(mpiy1lm emfvilsfarrmx  no4aeto fcilsfsDum(vpn(4trtomo3oodfp r neilt)srur(r oudaptnlfvsasf Durum ou0oee  i3tltla2um(vp u0 rtnmf3oydlateaieo t texmiopoo1al emiesatfa2tau p;t1tpt if3taslaDrmnvs t0teerio3oodfptraivs;(0s2xo(rpiydlpenmfvsl( artm(m ;t1texoii3ildls2ul(ms;() ltnirciydlaDranvi;s)texmxr3iudamtelici ()aDrrxmp;t1tlen ocild m rmnvonu4tltomo iotlmDr ieo s  euoimpno1llee iciltfaDtr(  ;u4apt mieiat m2uau s;t4texoxf3oy1fpDraues t0 exm(m oodalenmneils) rrrumo;t0teenmo3ild s2el(mont4 lenxo iotomteai s;s0seurir3iudllee neiasfs2ur( pnt0aptomoeild a2ea(vo (0tleoxo3oo1fmtraivs;(0 euo(mpiu4apenmnvtat) rrmumpot1ape  i3iadfm2uauvp;u0texoxr3totlat aues;t) 2um(opoy4lle  nvtat a2rmx  oo1oexn f3ias mDua( s;u)texoxo3oydlp e ues;s)srxoxrpno1om nmnvt (f rtaxro;t0tpx  oeiysfmDeln o u4 rermr iatfmtrli i;(0s2umir oo1lpee nvsas sDrmxr nu1texo oeiltla2ranvs t0tltrmr ty1fmD aivs s0trxoxmpio1altnmnvsl(  Dumx pot1opxomfcild s eaums t0 rtrif oatlp  lnvslt) rxr(o oy1lme lfeil(  rrrx p;o1alto ociysfs2elums t)trtomrciy1la   nvs t0teur(o3oo1op nmncslsfa2rru oou0ole  i3iaslsDeau p;(4 reomfcootfmteaieol(0 etrimpno4om nmncs t  rrr(  ;t1tle ioeiadlsDra(vpn(0 ltrir3iatlmDrlu o;s0teuoir io1apenmnctlt)aDrmu  nt0oexomicild s elnvo;t0treoxo tatfaDr ueo;s)trumxmpoy1ope lfviatfarrax  no1oleomieilt a rauvs t0teermrcto1faDr ieo s) etm(r oo4opee ncsl()a2ua( p;t1tltnifetydfm2umumsnu0tltnir iatlmDrauesl() eurim nodoptelnvsl(  Dumum oo4alxnifcild sDrluvont4treoio todfmD an ol( srxmim3iu1am emfesasfarua( onu4oetomfetadfm2rau o t) etniociy1laD lu olt s2uoxopnodom  lnct sfaDra(roou0tpx  fctat m2ea( p u4artnxf iadomtean sls0 eurxr iudam   netat s2tm(mo;o4apt io3iyd s ran pnt4 lxnmociatopte neslt0trtoxo3iydamte nvsl(fa2urxmoot1aeen f3iys m uanmo;(4aexrxrciodfpt aivo;s)t2tm(opio4al nlfcils)artaurpnt1olxomieiyt s2em( o (0arerxr iodoat  u o s)teum(o3no1oltn fvt s)s2tmu o;o1teto oetldfa rmuvp u0 rxomrciotfmt aiei;t sexmio3oudlmtnmiesa()aDuaxr oo0tpto oetat m2uln s;u4trxnxrciadoatraiei;t)setoxo3ou1lltnmfesat  Duax  no1tet  f3ilt mDumuvo;u)aetrxr oa1opt lnvslt0s2tm(o nu1ame lfesat sDrmump;t4aleomieils a2rlums;u4 exnxrcoa1fp  aues;() etoxm3nu1ole liesltf Dua( pnt0apt if3iydlm2rm(vp;(4teermo3ty1opDranvo;s seuo(opiydol elivt tfa2rmx  ;t4alxoio3tydla2raump;t0artrxo io1fmDeanei t0 euoim3ou1am n fvia(fsrtrxr ;u1tltniociysfsDuauvsn() ltnxociydopt  neo t s2uo(r3io1lltemneslt)s2ua(ro;t0tltnmf3iysfs2ra(msn(4 eeoxf3oodlm   ieils0 eurxr3iy1lptnlnet tfs2uax ont1aleo fctlt m2um(mo t) eeoxo3todfm e u olt texrxo3oodlpen ncs sf 2tr(m no4olxomo3ilt m2elu snt0tetrmf oo1fpt  ues;s)texrxo3nydam emfvtlt s2tr(m nt1oleoifeiasfm ua(von() ltoxo3ootoptelnvi s) rtr(m3nydlme mieil(f rtr(mpou4aexo f3iys s umumo ()trxnmo3iodlateau s t)truoim iu4lltemivt sf rurx pno0texoif3tltfa uanmp (4 eerxf tadoateauvs;t0t2uoio io1llenlici ()s2rm(m oo0tpxomfctls s emu s (0arxoif ootoat  n s () rurxr3oo1ol  micsls)aruau  ot4tptnmf3ilsla um( p t0 rtoxf3iadomtr neol( srurimpoy1alenlncsa(  Duaxr oo1optoiieiyd a umnvsnu) renioctytoa rlu s;t  2xo(m nu4om  lnvtl(  2tmxmpnu1aleomi3ilt m2umumo t)tlxnxociadfpteluvo;t0texrxrpoo4ope  iesl( s2rax  nu4aexniociat a2rln s u4altrmfcty1fpD lu olt0sexm(r ny1ome  fviat arraxrp;u4optnifeiytfmDrm( o t4teeoxr tadlm r uvs (0 2xmiopnodlleemnciltfsDraxmooo1oet miciyt m2rmuvsn(4altnio iy1lm r ueo;s  rumir3nu4ole lieils srtru  ;u0tlx mietydla rmuvp;u)tetomrcoydfat  u il(0truo(r iy1llte fcta(faDrr(r ot1opx  o3iydfs2ranmo u) ltrmf3ootlpt  ueo ()truoim3oo4lpee icsas artax  oo0olt mf3tldls2elnms;u0arenxo3iatfaDeaieo ()srxm(m3io4alt mfcs sfa2taumpoo0tpt  oeildfm rlnmp (4trtnircoa1lmtrlnvi (0s2uoimpoo4lm elnct (f 2raxmo;o1ale mieiytfaDumums u4tetnmo tadlptr i s s srtrim3oy1ameelici ()s2tmx  no4ale mf3tlt m uau p;u4 rxoio3tytoptranes ()teurim nodopen nei sfsDrrum oo0alx iieiad sDem(mp;(4arenmr3tatfpt ln s;s sexo(mpoudapeelfcsl(faDrmxmont0apenmfetydfsDumuvs t)alxrmr3to1fat aiesls trumirpiy1ap nlnct tf rtrx pno4aex mfetatlm el( s u4artrio3tydfateai ols  euoxr iu4lpeelivs t aDtruroou1tpt  ictytfmDrlnvs;t0aexnir iydlp   u sls)t2ur(o ny4op  mfesasfartauroot0teeo feiad aDeanms;u0 exnxo3oa1lm ean ols  etmxmpiu1al emnvslsfsrumxmpou0tpx iietydfa raumpn(0arxrxr tydlmDelneolt  2tr(rpnu4oltnmfvtat aDrr(mp;o4altnio3iysfs2um(vs t0 etnxocoatop  luvi s  2to(m ny1amtnmicta(  Dtm( pno1apt  ociasfa2rmuvo t0tetnxo oo1fate u o t0srtr(o iydom  mietat) rumxrooo1tleoifeilsfaDulu onu)alxoxo3tadlmtrli o;s0s2uoxr ou1amte ieia()srta(rpno0optoiietasfm ean p;t0 etriociydlaDeaiei;t0seumxm3oy4ll n nesas arrmu pot0oetoio3iasfs2raumo;t) reoxf3oa1lm ranes;s trxo(rpiu1amen ieslt)s2rrx onu1tpxnioetasfm2emu o (0aetnmf3ootom   ivs;t)trxr(o3nodal  mfct ()srtaurpou0ape iociatfsDemumsn()aetoio3tadlp  li i ( t2toxm no4optemfviatfsrumxrpoo1oexnioetysfs2rlnvp;u) lxrmo3todoaD auei;s trurio nu1olteliciat a2um(m ;t0ape iictysfs2rlnmp;(0areomr3ta1fpDranei t)s2trxm3nudlpe  nvsa()a2raxmpnu1tlxoifeias aDean p u) lenmrcoydlmtr uvolt0 rtoim ou1om  livsa( a2umx o;u4aeto iciydls2um(vs (4aleoif iytfaDrli i;s texoim oydopt mieia()srtmxmoou1apxnmocias s rlnvs;t) eerxrcoytlaDr u ol(0s2xoxm iy1alenlics s) rum(m no0oetnmi3iytfaDuanvo t0aexrmf3oodomDraneo (0trum(rpnudol   icsat  rum(r oo1apx  octls mDrln pnt0tetrxoctodla ranvs s0texo(m iy4am emiei s  2umuront1open ictldlm rl(msnu)aetrmr3oydom   n olt texr(opno4llt mfvt t)artmxmp;t1oet mietas a ea(ms ()aetoxf3tydfa  ln s;t)s2umxo nu4om   neiatf 2ua(mpot0apt  f3iydfm elnvs t0trtnxr3oydfmDelivs s) rxmxm3nu4ap n ivsat  Drax  ou1ale ifciytlm2um( snu4arerxf3tydlm  lnvs s)s2uo(o3oy1ap elicil()sDum(mpno4aeenii3ias s2em( p t) eeomo oadlpDranei;(0srtm(r no1om  mnet ()arurum nu4olxo iciltla2ra(mpn()tltnir oodopD lu slt)truo(r3iudomtnmnvt s  Duaumo;o4oeenmfeiat m2eluvsnu0 rxrio3totla r u o;()sexmirpoodlp e feia()s2tr(moou0opt moeiytls el( s;u0 etoio3tytfa ean s ( t2tmxrpou4openlictas  2umxm ;t4oleomfctysfa2umn sn(0trxnif3iy1lmtranvslt0truo(m3ou4omtnlict s sDua(r no1aee mo3ilslm ulumpnu4trerir oydfmDelu o (0teto(opnydap  lnctl()s2rmur oo0optoifctatlm rmn o;t4tetoxo oa1fat  ivil()srtmxrpoodap nmnesat)sDum(ro;t4tex mictydfs2rm(vo;u0trxoxr iodoate u ils0 rxo(o3nodamt lfvsat)srurumo;u0oet ifeiad mDumuvs;u0 rtrif tytlpt  uvs;s)s2ur(r oo1omen nvslsfsDrrxrpou1olx  oetydlmDua(mpnt0tlxomo3oodlpt lnvo;(0 2tr(mpnu4aptemivtls)arrm(mpoo1olx mo3iatlm uan pnu4 lxoxr oo1fm e nes;s0s2tr(r3oodoltnmfesls)aDtmxrpno4aetoif3tytfmDrluvo;u) exrxrciotoa eln i ( seumxr oodlptelivtat aDuaum nt4opeomocildls2rm( pnu4aetnxo oydlmt lieils0t2umiopiy1opteliei s)aDta(mont0opxn feiatfa2uau s t)alenif ia1la e ies t tetmim3nodopenmfeslt aDta(mo;o4aeeo ieils s2ua( p t4tetnifcoatlmD auvo;(  2um(m3iodolt  nvtls)s2urumpnt0oleoiocildlaDulu p;t)aetomf ty1lpteai i;t0s2toxr oy4lptnlnvs t  2rax pou0opto feiyslsDeau o;() eerxf3iytfmDeaneo t setmir iodol n neias) Dtmxro;u0tpxnii3iydfs2rl(vsnu) ltrxr oodla  lu i;() 2umimpio1ol  livils)aDtr(root1aleoifcild a2eluvp;u4aeeoxr3tytlp  aivil(0 2xmir3iudll  mfcia( aDtm(mpou4aeeomi3ilsfmDean p u0trenmrciadfmD  ivo s0texoxrpoodoptn fet () Dtauront1aptoioeiys m um(vp t4aeenxr ootfmt lu il( s2xoimpio4omee nciltfs2rmx oou4alt  fciytlm em( p t)trtnio oatla eai i s s2tmiopno1ope lfvsas arrax pou4oexoio3ilslm rl( o;u)tlxnmo iy1fptrlueo t0trtoxm3iodoptemfviasfs2umx ooo0tlt io3ildfs uaumsn()arermo oo1lmtelivs s  exoim iodllt  feslt sruaurp;o1olxnmoetat mDelums;()altnmf tadfptranvs;s)t2trxopiydopee fesasf Dtaxm nu1olxnmoetld s2emn s;u4altoxr3iytfp  auei s0s2ur(rpoydom   iviatfa2ur(rpot1tleo fctadla2ranmo u0texoxo io1lmDeau sl(0 rtr(rpoy1amtemnvsl(f Durx o;u4alxn o3iatlm emnmo u4 reoxf oy1lpDe n ilt srxriopio4omen nes t) 2rau  oo4apxnif3tysfaDul( s t)tetrif oo1omteanes s0 eto(r iy4lm nlfciat  Dtmurooo4tpto oetlsfmDran ont)aetomrcoatfa e uei s  rtrir nu1amtnmnvtls a2taxmpnt0tptoiieiysls ua( p u)aeeoif3iy1lpDraueo t) exrxm ny4lpt mivslt  2rmxm ;t0tetnioeilslsDelnmo;u4tltnirciy1oa eluvo ( s2tm(mpnodamte icilt)srraxrono4apen feiat s rm(vp (4trenxo3todfpDranvol(0 2uoio iudopee ncslt  rumu o;t1oeen ietaslaDuluvsnt4 reniociydoptr uvolt0trxrim3io4oltnmicsls) 2raurp;t1tle  fcilt m2uluvs (4 ltoioctadopDe neslt0s2trxrpnydlme lfeils  Dtrxmoou4altomictys sDem(vonu) exomf3io1lm e iei;s0 eurxo3io1opt  fct t srtmurpot1altnmiciydlsDra(mpn()trenifciadfat  nvol() rum(opnu1llt miesa(fsDrmumpnu4tlxomocilsfs emuvp t)alxnircoydoa elieo t0 2xm(o ou4amtelfvtlt) 2rau o;t0olenmictas a2rm( s;u0 eeoxo iodom  aieo;s setm(r3nodomt mfetl(faruax o;u0tlx ii3ildlm rmuvs (4 rtoxo3oydfp  auesls)t2ur(mpnudam   nctl(  rtau  nu0opxo iciyd aDemuvsn(0arxnio3ty1fpDelneo;s0seumir ou4al   nvt sfsDtmxmp;o1texoifetlslaDrluvo t0 eeoio oodfp raueilt0texmimpiu1alt  fvt t) rra(  nu1aex ifciad m rlnvsnt) lxnio3tatlpDr uei s) 2ur(o no4altelnvs tf rtau oot0olenifciyslm2uln on() exriocoodfmte nei;t setm(rpoo4altn fct tfa2tau  ot1olen ocild s rmuvpn() rxrmfciydlmt aivi t0texr(o ny4ame lfeiasf Dtm(r nu0tex  ociltlaDua(msnt0 rtnif3oatfptrln i ()srumir oy1ale  nvilt)s2urx  ou0ope  oetadls2elumsnu)tlenmociytfpteaieolt trtmio3ou4amt  nctlt  Dtm( o;u0openif3iaslaDranvs (0 rermo todfmt  uesls0t2xmxr nu1opt  nctl(fs2tm(mo;o4olxnioeiadfs rlnms t0arxoxrctodfm r nvi;s)trumio3oy1alt livsatf rra(m ou0apxn f3iad a uauvpn()aetrir ta1lmD  u o t)s2uo(r io4altnmnvtltfsDuaxmpnu1aetomo3tadfmDumu o t4altnxfcia1oa  lieils s2xoir nydamtnlfvil()srrmu  ;u1texnmicilsfsDuauvsnt)aeeoxr oytlmtrlnvil()seuoxr nu1lp  mnvi (  Drmx  nu4tex iictadfaDul(mo;t4treoio io1fp   n i ()seum(rpiy1om elnvsa()aDrauro;t4oltnii3ilt sDra( s;(4aexnxo oodlmt  i i s srxo(r3iu4lptn nvi s) 2ur(rono1olx mfeiadlm2rlumo u0aeeoxo iadfa eai o t  rtmxo ny4ol nmfcsasfarraum ot0oexo o3tlsfa rluvs u0aetrmr3oydfateanesls0s2toxmpiudomtnmivs t arurxront4openifeiyt a um(msnu)tetnirciatom   i sl(0 2xmio3ny1olt  nesls sDumx ont1apen fetasfmDumn s;()alxniociadomtrli s;t)texrxm io4oltemfet s) Dtrurpoo4oeto feiys a2elnmon()alermo3ia1lateanvs s0s2xoxopiydamtnmnviat) Draurpnt4tex moeiatfa rlnvo;u) etoif oatla  aies;( t2umxo3nu4ol n ietatfsDtaurpot4aeeoiiciad aDulnvs t4altrmr3oy1lmteai s t  rxmirpou4amte ieil() ruau  ;t1apxoiieiadlm rl( on(4texrxo3to1lmtraivo t0s2xmxm3oo1ap   fvilsfaDrrump;o4openifeiat aDum(ms u0tlenif iodlatrliei;s  rum(o3oo1ap elfcs (fsDururont0tlenmo3iydfm2raump t4tltrxr3oodfpDe ivolt)seumxr3ny4ol emiet ()arta(  ;t1olxoii3tytla2ea(vs (4arxoirciadfaDelivs;s)seuoiopny1lm nmivia() 2ur( pou0oetnifeiaslm2elums u0 lxnifcty1la  anvi t0trur(r ny1lle  fvslt) rtrum oo4oexnmf3tatfs elnmpnt)altrxr ootlmtelu o (0 rtrimpiydom  mivtas) Duax o;t4tpxoiicilt s2uanvon(0 lermo iadlmte u i;t  2uo(mpio1lmt mnvsasfs2trxrpnt1oltnmfctydfm2um( pnt)teerio3totopt lnvilt0t2trxm io4omtn fet ( aDta(rpnt4texoioeiysfmDra( ont0 leomf3iodop eauvs;t trxoir nodamtemncia(  rua(root0altn ocildfaDeaums (0arxoxfctytoate uvo s)srxrirpnodoptnlfvtlt arrmur nt4alxnmo3iyslm rmumsnt)aeenxrcoo1op  auvo;s) ruoim nudlptelicil() 2urx o;o4opeoio3tltlaDrluvs;u0areoxociotoa  aiei;(  exmirpiu4lpeemfes (f rtr(r ;t1tlxnmf3iyslaDelu p;() eenir iotlptraues (0 2umxo3iodomtelivil(farurxr ;t0oetnmoetls s el(vp ()arxnxrcoa1fm elu o;t0seum(m nydlltelneilt)s2rrxrpou0aexoiieilt m ul(vs t0texoircoodfaD aueil()trur(r3no1alt  icta()sDurxmp;u4openmictat a umnvs u0aeenirciytoptr nvils  rxoxo3nu4ol  mnei s a2tr( oou4tleo fcias a ua( pn(4alxoifctadfa  aivs;s s2xr(r oudameelnvt sfsrtmxm ;o4tle  ietytls2el(monu4tetnxr ta1lm rlieolt0 2um(o3io4amtnmfctl() Durx p;t1alx  fciysfm rmu p u) lenif oy1fpD auvsl(0 rumxr oo1lpt mieiat)aruaxrp;t4apt  oeiysfm um(vo (0tltoif totom eluvilt)trxoxm oy1olt licias)a2ua( poo0apt mi3ildfa uln pnu4aetrio iatfmt  n o t sruo(r no4apt miciasf 2raurp;t4oeen ocild a2ulump u0artoir iadlmtr ueols t2urxm3nydomeelfvtl()aDrmxmo;t1tpen f3tld aDrl(mp t0aeenxrctydlmt aneo s)tetmirpnodopt  nvs t s2tmx o;t1tptn o3iltlaDua(mp (4trenio3iatlat  u s;s0sexoimpoo4ol elfcsls)s2trx p;u0tpeomo3iydfaDrlu snt)trtomr3iadomDrliei t0 euoio no4lmeemfvs s sDuau p;t0tetoio3iltla umnmsn() eerio oadoaDeluvi;t  rxmimpoudolenliviat sruaxr nu1ale mfeildlaDel( p;u)aetnxf3iotfa   ieo;s)sexoxo3io1op  mieslt)s2raum oo0teto i3tltlmDuanvo u4 etrmf3io1lp  lueo s0 rxr(m nydomee nvsas)s2rmxr ou4olen oeiys a2ean o t0altnmfctytfpDe nes ( seurio iydol n fvt t  rraumoot4apto icilt sDumuvs;(0altomo tatoate uvo;t0teumim iy1am  liet tf Drr( pou1apxn f3iasfmDeanms;u4teerioctodfpD ai s;(0s2xm(opiy1oltemivslsfa2rrurono1tet miciys sDrlnms;u0alenmrciadla rln ol(  euoimpoy4amt lfeslt  Dtmum ;u1opt  fctyt mDua( snt) ltrmo3tatop r n o t)srxm(opny4ape mfci tf 2tmxr nt0oltoif3ilsls2ulnvpn(0trxrifcoa1fm  lieolt tetoxmpnydolenliviatfaDrrxmo;t1optn ociydfaDemnvpn() ltrmrcoatoatelnes;s srxm(rpoy1ol   ivtlsfartaum ;o1opto ociyd a rl(mo () lerxfcio1fpDe ies;t sruoxopoy4ome  neta( sDra( oot1tlen ieiltfm uanmpnu0 lenmf3iytomtraieolt0srxrxmpiu4aptnmivt ( srtr(  nu0tptnmfciad a ra(vsnt)artoxfciadoat li ol()s2xm(o3oo4lpeelnvi tfs2tmuront4texn fetadla2ua( s ()texoxf oodlaD livsl(0s2tmxr nu4alenliei sfa2ta( pnu4tlt mociyt a2ranvp;(0 lenmo3todlat lieilt0sexrio3oudop  lfeil()s2tmur ;t0tlx if3iytfmDeaumonu0artrmo3oo1lmDrlivolt)s2xo(o iudlmte ivs tfsrum( poo1aetoiieiadfmDrl(mp t)aexomr3oytlaDrau i;t)s2xr(mpoy4ol elncil()srtaum oo4aptomoeiadlaDeau onu)aeeoxo tytoaDrai sl( sexr(r3oudal n ncsa(faDua(  ;t4altn octadfa2rmn o u0tetnxf ta1fptr uvi (0texrimpio1apen nei (  Dtmurpnt4aptoifetls a2umnmp;t)arenio oytfpDeauvs;t t2xrxopiy1ome  fct tfa2rr(  nu0olen i3iyd sDrmn s;(0 lxrmf3iytlaD  ieo t  2umxr oy4om  mivtl(  rua(  no0alx mociysfa2em(mpn(0 rxomf3iatopDrlivo t)texmxm3no1lp nmnvtl(fa2urxmont4oeenmfetltlmDemnmonu0altrmr3io1fa rlivils s2umir3ou1amt mfvsa( artrurpoo0oexoifciysfm2rluvont4 eeniocoodoa  ln o t)truo(rpno4llte fesas a2tax  no4olt ioeils s eauvs;t)alermr ia1lpteanei;t)srtoxo3iu1ol   fetas  2umurpoo0apxo o3tytfmDeln s;()tetnxocoatfm   uvilt teto(mpnu4am elfesls)arua(rpnu4apenmoctltls2umu pnt)alxnmr3to1lmD livsls t2xmim3iodll  mics t a2rr( ooo0apxnmfeiyd m2uanvo t0aexoir tytomDrai o ( trxmim ny4am elivils a2umurp;t0olx if3tltlsDelu p;t) rermr oo1opDran o t)teto(r iudome mivsasfsDta( pno1tleomfetldlaDelnmo t) etnifciodopteaivslt0trumxm3oo1opeemnet (faDtmxrpnu0olxoioeiasfmDrluvp;t4arxoxf oadlpD auvsls t2um(r nu1altemfvs sf rururpou4texn i3iatfs ranms u4areomfciodop eanes s) etoxr3io1ap nlfvs tfaDtau ono4alto ociysfm emn o;u0 rtrircootlmDraueolt texrxo3nydaleelfeias  2tm(rpot1alx io3iytfm2el(monu0aetoiocoadom   ieslt) 2tmxo nu4omen nvsl(fa2tmum ;u1alxomo3iyt a uanms t4aexnir iydoa eaiesl()s2trio ou4ap emfctl(fs2rmxrpot0texnii3iltfs eaums (0 ltoxo iotlatelnvi;()tetoir3nodol e nctasfaDuau  no1tle  iciltfm um( p u)aetomf oa1omtrluvs;t0texrio io1lme mfvs () rurxrono1oex ifetadlaDemu o;u4tltriociatlp eau i t)srtrxrpoy1ap elnetas a2ur(rpot1aex  feilsla ra(mp u)arenxf io1fm rauvs;t  exrim iudop elnvtl(fartauronu0ope mf3tyt aDrluvon(4trtrmo tytlmDrlnvols t2toxrpoydomee neils a2ra(rooo1tpt mi3tld a uluvp;t)tetnxfcto1fpDrai s;s)t2tmio3no1om elncils)s2rmurp;o1aet ifeilsfsDum( onu4arxrifcoodom eaivo t trur(rpoodom n neia(f 2rmu  ou4tpeo f3iatlsDemnvs;t) lxrmrctytoaD  i i;t  2umir oudopeemicils a2urx onu0tlxo ociltlmDulu p;t)arxoifcoydfa e iei t0 etmxopio1openlfvtlt sDtrumono4tet mfciad aDrlu s () exnmfcta1lpDrliei;t s2umxr no4lptnmnci ()sDrm( oou1opxnmo3iltlmDeanmp;u0 lxnmrcoytlp eau s;s0s2toxr3ny4llenlfetas) Dumumono4tlen ictytlm rlump u0trtomr3iodlptr ieo s)trtriopoudopte nct t  2uauront4aet  f3tytfm2rluvs t0 exrxr tadlm ranesls0srxrxr io1om n fetl(  2urxr nt4tlto o3tyd a2rmn snt)arxnio3iadfpD  ivi;( seto(mpnu1om nmfciltfsDrm(rpoo0apen feiatfmDrmnmp;u)tleomr3oytfptr ieilt0srxmiopoo4ol elfvtat a2ururpno4aexnifeiasfm eanms (4tetrmf3iytop rai o t) eurim iy4olte ivt (fsrtrurpoo4tleoiieiysfaDrmuvs;u4tlxomocio1fp  ln slt)sexrirpoodlm  lncs s)s2rm(mpnt0olxomfciltfaDem(vsn(4 lxoxfciy1oatelieilt) rxo(m3oo1ol e nvils sruaurono0tetomo3tys s rm( ont)aexnio tadlmteanvil(0seum(rpno4ll eliei (f Dta( pno4tle ifcilsfm2elu sn()aexrmfcoydlm  anvsl(0 etoxm3iu1lm  lnvtltfs2tru ono1aeeomietldfa ua(ms;u)tltomr3tatlmDe i i;s srtr(r3io4apenmfet t  rtm( p;o0alxomi3iltlm em(vo u0aeeoir iytlpDraiei;s0 2um(o oy4am  lfvs ( srtr(mpot4alxnifeild m2eaump;(0tlermrctotfm rluei;s0srxm(opnydol n ncilsf Dumuroou1apxnmictlslm rl(vp;u4tetomf tatlatrlueslt  rxoir3io4ll  lics t) rta(ronu0alt if3iydfa eanmsnu0alermo ty1op  auvs;(0t2to(m3oy4lmte iei ( a2rax  ;o4alxomfctltfm em( pnt0alxomfctatlptraivs s  eumxr3oydape mnvtasf ruauroot4tle  fciydfaDuanmp;u4teeoifcia1op eliei (0t2trxmpoudlmee iet tfa2urxr no0aet  fcildfs2ran s t) ltrxr3iadomDranvo;(0srur(o ou4lptnmicsas)arurx o;t4tltnmfetldfm em(vp (4 lxriocoodla ranvo;(0s2xrxr3iydomeemfei (  rtmu ont4aee  ietysls rmuvo t4alerxr iy1fatr neo;s s2tr(mpnu1ape mneilt)s2rmur ot0tet moeiysfmDeaums (0tlxoxr3iodla  livsl() ruo(rpoy4lm n iesas)a2rau ooo4opt io3iltfsDra(vs;u4texnmrciadlat  uvi;()t2trio ny4lme lfvt s) rtmu  ;o4texomfeiytlm rl( p;u4treomfctotoaDelivolt)s2xr(o oodll n ivs tf rua(mpoo0tpe ifeiadla uanvs;u) reoxrcto1omD  neol() 2trxrpny1olenlfetat a2ua( pnt0oleoii3iys sDelu ont)arxnirctytfmDe iei;s0srtmim ny4olt  nci tf Dumxmpnu0tpto oeiasla2rmumpnt0tlermfciy1op r uvols0seuriopiu4ole lfvia(  2ra(mpno0tee ioeiysfaDua(msnu) rtnxo3iydfaDrlu ol()setoiopiydamtn fvi sfaDtaxroot0alenmiciyslm uan sn(0trxrmf3tadlat  ueo t0srxoxo3nu4lpen fvsl( s2rr( ooo4apto fciaslsDulu p;t4aeerir tydfm  aivs ( s2umim3oo4optnmfes (fsrum(rono1tleoii3tldfa2ran pn(0 ltrmf tydomteli il(0 eumimpiudomeelicsatf rrrx ono0aex if3tltls uluvo () eerxo ia1lmt ln ils0t2uoxo3ou1ll e nvil()sDrmur nt0oexomi3tyt m2rau pn(4aexnxo to1fm  lues t sexoxo nodolte fesltfsDua(m oo0ope  oeiad aDel( on(0texnifcootoateauvol()tetrxmpno4lptelivtlt)srrr( p;u1tpeoiieiatfs2emnmon()tltnxo3oa1fateluvol(0trxo(o3iydaptelncsat)sruau ont1texnmfeias mDum(vo u) rtomocoydfmDr u i t)t2tmxo io1lltn ivt () rrmurpot4tlen ieiadls eanvs u4trxrxf iytoa  aiei;t0 2xmxm oudole lnetls) rua(rono4aee mfciysls rm( o;u4aetomf3oatomDelnvo;s0srtrio nu1oltemfetl(fsDraump;u4alxn ietydlm rmn s;()trtrifctydlat an s s s2xmio iu4ll  miviltfartru  no4tetnmfciydlm rauvs (0artoir3ty1faDelues;t  2xrir ou1lpenlnes sfs2rrx  ;t1olx  ictyd s rlumsn() exoif io1lpte ivil( srtoio iu1ol   iesls) Durur ;t4aet iietatla eaumo;(4trxnmociodfatrlieilt0trtoio3iy1opt  nes sfsDumxro;o1oeto feilslaDulums u0trxoxfciydlm rlivi;s)srxmio io4alte fet sfa2ra(mono1tex ioeildfm umnvp;u)alenxo iatlmDelneo;(0 rtoxo iodalt lncils aDuaxrpnu1ale mfeilslmDumnvo t4altnmr3iy1lptr ueo;( texrio ou1llee fcia( aDta(ront0tlxn fciad aDuanmsnu)aetoir oatfp  aieil( setmirpnydaleelfesas)srrr(rpoo1tlx moctls mDea(mpn(4 lxrxfcoydfp  lneo;(  2xmxopno1amtn neil(farra(root1apt ii3iltlmDul(vpnu0aexrmocootlm  ai s s) exrir3io1ll n ics (  rurxronu4apxomoeiadfm2eauvp (0altomo io1fp  lu o t)texoxopno1lltemfvtls  ruaxmpnt1aptomo3ilt aDeanmp t4tlerircty1la  an s;s)texr(o3io4ape  fcta(fsDtrumpnu1tlxoif3iaslaDeau s t)tetoio3iydla eaieolt0trurio ou1lm n icsa()sDrr(moou1aptniieildla2emu s u4alenxocty1lm e i i;t0teum(m3io4lleelivtasfa2uru  nu1tlenmo3ildfs2ranmpn()trermf oatlaDeaivols)s2xr(opou4lptnmnvta(fs2urxr no0texomf3tlslm2emu p (4tlxnif iatfp elieilt0 rtrio oy1oltemnvilt) 2umxr ou0oexnmiciltfmDrmn o u0artrxf tytlmtraueols srxr(o3oudop  miei () 2ra( o;t4aexo ictldlmDelumo;t4aetnir tydfm rlieslt0s2xrxr io4apt lnvi (faDrmu  ;t1apt  i3iad aDrmnvo;u0aeermr ty1fa rauesls)s2xo(r3iu4ope mfcias)s2rr(m ot4tptnio3iltlaDrl(vonu0aexoir3tydfptr i il( t2xrirpoy1alee nvt tf Duax  ou1ape mfciltls uluvs t)trerirctatop   uvi;s) eum(opoo4oltelnvta(fs2ua(ronu0aex ii3ias s2ea(vonu0tleoif tytlp ran s;t0 2tr(o3iodolee fcta(fsDrrum ot0altnifciadlaDumump;t4treniocia1faDraieilt  rumio no1optelneslsf 2ta(mono0tpenifctltfm2eluvs (4 etnmocoatlat  u o;() exrio io4al   iei (fa2ur(m nu1apenmieiytlsDemumo (0 etnxrcoytfm raues;()srumxm oydomt mnetatfaDua(rp;o0aptnioetytfaDea(vs;t) lxrifcoatomDrlivo;s s2tm(o ou1omt mivilt)sDraxro;o0tetnmoctltfa rluvo;u4teenir iotla e ivo;s) etrim ou4lmtelict s arua( ooo4tpxomi3iatlmDeau p;u4aexrmociytlmtrau i s0t2tm(m3oy1lmen ieil(fsrtm(rpoo0aeen o3ils s el( o (4arenxo todla e nvs t)tetrxmpiy4apeelivia(faDra(mpoo0oeeo feildfmDuan s t0aetnxrcto1fp rli o;s)srto(o io4alt lict s s2ur(r ou0tlxn oeils m2elump;u0alxoio3oo1oateluvs t)t2tmir3oudllte ivi (fs2urxmo;t4tpt  iciasls uan ont0tlxrxr oy1fmt li s;t0s2toxo no4olenmfct tfaDuaum nu4opeoif3tlt m ulnvon() ltnif io1oatr uei;t)srxmimpoodopenlfei t)a2trxmpnu0tlxn fctys a2ua(mp;u4tetnxf3oytlmDr uvols  exoirpoudamtemfvsltfsrua( oot4oexniicias m rmumonu0texomo3oydlptelnvi s0texrim oudll   feslt) rtaumoou1tpto ocilslmDea(ms (4 etnxr totomDrluvo;t  rtmxr ny4omtnmiesa()s2ra(mooo0aet  f3iadlaDuln p () etoio3oy1omD au i;(  2to(m no4opte ietlsfsrumum nt1aex iicild sDelnmp;u0 exomo3oy1fa rli sls0 2xr(m iu1altelfesat srur(  ou0oltnifcilsfm umumonu0trtomr todoaDrlnvils) 2urim3iu4ol  mfvsl() 2tmxrpnu4opt mietls mDeluvs;u0 lxomfcoy1faD au olt0trxmirpoy1lpenlfvta( sDum( ono1apt micildfa ea( s t)aetrmf3oa1lpDrlieil(0t2xoxr3io1amtemictas srurxrp;u4apxo fcilsfsDrm( sn(0trtnio oa1opDr nes ( srtr(opiu1apeelfcsl() rtrump;t4aptoifeiatfs2em(ms;t4texoirctadopteanes;(0 rxoim nudamt  ivtl()srra(rp;o0optoiieiys a2ranvs ()tltnxr tydlp eaieo ()truoxm ou4aptn nvia(f 2trxmoou1teen fciatla2rluvpn()artrmr oadom  an i;()t2uo(o3nu1apenmneta() 2raurp;u1apenmfctydfm uluvs u) rtoio3ta1opDraiei;()s2tmxrpoodlleelnctasfsruaumo;t0optoiieiysls rlnvpnt4trxrio3totopD  u ol(0 rumxo nu4amen ncsls arrmxr no4tpxomfctlsfm2umn p u4tlenmfciadfaD lu sl(0tetrxm oudalt licta(faDtrxmoot1tpxnioeiyslm elump;() rtnmo todfaDe uei;( trxmxo3iydopt mfeias) 2um(mo;o0olxoif3tadfa2rl(mo;(4tlxnxo ta1lat lnvs;(0t2urxopiydamtnlivi t)s2rrx ont4aetniicils m2eanvo u0teerio iadfptrauvs s s2toio3iy4omte ivil( srtax  ;t1optnioeias mDelu s u0tlxnxfcootfmteliesl(0texrxrpoodap nmfes tf 2ur(r ;u1tee ioctad m ea( p;(0alenxrctodomDelivolt0 ruoirpiy4lltnlfvsa(fs2trumpot0altomfetls m eau o t)arerio3oodoat luvo s0t2xoxopno1lp e nviat s2ur(m nu1ape ii3iyd m2ea(vo (4alermr oodlmte nei;()srum(m3ny1opee net tf rrm(moou1tltn fciysls2em( s;u) rxnio oytfmt aieils s2xmio3iydapen feias s2raxrp;u1oeenifetltlm umn snt0 ltrio3iy1op eluei ( s2toxo oodomtnmivsls) Dua(ro;o0tpxnii3iysfm em( pn(0tlxnxf3to1fa e i s t0texoxm3oodlp e ncslsfsruau pno0tlx  f3tatfm eanvs;t0aeermociodlptrau ol() exmxmpiu1lme  fetlt)s2umxrp;u4tpenifetysfa uan on(0tlerir io1lmt  ueols) exm(m3nydol  lncilsfaDumxr ou1tlxoiieiasla2ulumo;t)arermfcoo1fateluvsls0setoxr nu1opt  fci ()artaxm oo0apx miciyslsDemumo t)aetnxr3oytlatr ivi;()trxmxo3oodameemfeils) Drm(m nu1apxniocilt m2emn pnt) eeoircoy1lmDr u i (0 etmxm3oodalt  net sf Dra(m oo1opxo fetasfmDelumo;t) ltoio ta1fatrlies;t)seuoxr iy4ol nlnctat)s2tm(rpnu0tptnioeiydfs rm(ms;t4 renmr oy1fpt livs t)trumxr ou4ll   netl(  2ta(mpou0tleoiietlt sDulnvo t4trtrxo tatfmDraivil(0 rtr(r3nydomte ietasf Drm(r ;t1tleomocias a2ul(vs;() eerif3tadfmte nvi;s0 euo(o3no1llt  ies t s2raxmpou1olen o3tadfsDranvo;u)trxnir3iy1fm raies t0texoir oo4aleemfvta( sDurumonu1teen fciasla2el(vo ()treoxf3tytop   nvol()t2xr(m3iu4ome micslt sDrax  oo1altomi3ils sDul( p;u)alxnifctatfpt auei;t)srxoim ny1lp emnvi s)aDrauront1optomoeiydlm2ul(vpn(4arxoir iadlat ai i s  etm(r3iydlmen nes (  Dtmxm ;u0openmieias m umu ont)alermf3iy1omDeai olt)srxm(opiu1lmtelneiat a2raxroot0tex ioetltfmDelnmp;u4tltomf3iytlpD li s s0setoirpnu4lmtnmnviasf Dururp;t4apeomieiasfm2ranvp () eerirctatoatrluvols sexo(rpoo4lleemfvsl(fsrtau  nu1tetn iciyd a2emu s u)teeomr ootlmD luvs;t0tetr(rpio1am   fesatf Dtrxmono0tpx ii3tytlm ulumpnt)alxrir3ta1lmtr ivi;(0srxm(o io1ole lfviatfa2um(monu4texnmfetadfa2rmnmp;(0aexoircootom  aivi;(  2xo(rpoydop e fes () Drru pno4tpxnmietlt mDuln o t0 reoxo ootfatean i t)truriopoudopenmfes t arrm(rpou0openiieildls emnvo t0treoif3oydom   uvo (0 2uoio3oo4optelieias)s2tm(mpoo1alxomo3iytfa2ulnvsnu0 eermr oy1fp ranei;t)tetmim3io4al n iei sfs2tmx  no1olt ii3iyt s2ranmpnu0altrioctadfm e nvslt0srtrxo3iudomtnlfciat)srumuro;t4optnmi3tltfaDem(mo t)aetrxoctytfmt li i s)srurxrpoo1am elfvt tf rrmurpot4openifctls sDumnvp u0alxniocoo1op r nes ()srtoxrpoo4om nmnct ()sDtmxmpno4alxoii3iadlm2ua( pnt4teerxo3oa1fmDe nvo;(0 ruoiopoo1al e nvi s sDtaxr ;o0oex mocias m2em( o t)arermo3tadlmtr ieo;()trxr(o nydapee fes s)arur( pnu4apxo o3tydlsDuanms u0 rxrmo tydlp rlivs;t0sexr(o3nudlp e icsas) 2rm( ont1alx mictltfa2um( o;()texomrcoy1lm rau ols0 rtrxr3iy1ameelneta(fsDrm( onu4tee mociysfa2eaumo;() eeoxf3oo1laDrlneo s  rtrxo3io1am emnei (f 2umxmpoo4tltomiciltla emn ont)arenifcoydfp eauvs;t0texrxr iydap nmnesls)s2tmu  nt4open icias m ul( onu4 etniociy1fmtraieil(0seurimpoodllt lfvta()srtrxmp;t0opt  oeiat m em(vsnt)aeeoif oytoat aies (0t2urir3ou1altelfvi (f rurxm no4texo i3iys aDrl( s (0aetnmfctydlaD auvo ( s2xmiopnodlmtelnes (faDraxmoot0aeen i3tydfaDumnvsnu)texomfctydoaD aieo t0srumimpnu1am emicslsfaruaumpnt0apxn icilt s2ua( s u) exrmfcta1oat anes (0sexmir3oudlpt livt t s2tm( oot4opeo feiytfs ra(vo t4 exnmo3oa1faD  ies s  rxo(r oy4omtemnvs sfaDumxmp;u4tpeniiciysfa eln s t4texnio iadop  aneolt srxr(o3oo4oltemnvil() 2rru  ;o4oetn ieiys s uau p (0alenif oytomte ieo;( teto(o oy1altelivtlt)sDua(rpoo1oex mieils a2emnmp u4 renxocta1lm rli o;( srto(rpnydllt mietltf Duaum nt0oleoiietysfs ean s;t4trtomfciotlaD ai i;t0srxo(m nudomt  iet t aruau p;t4optoiiciatls2rl(vo t0tleoxocoodopteau il(  ruoimpnodaltnlneslt)s2um(mpot4alt  oetldfs ran p t) rxrmr3iydfmDrlu o (0 euo(o3nu1apenmicsa(f 2ur(mp;t0openmietydla rlumpnt4altomo oodomD auvil(  2xmimpio4al  lfcs () 2tm(rpnt4tleomfciadlsDumnvont4 lermo3ia1om  aieo;t srtrio iodol nmfct () 2trx pou1apxnif3iadlmDul( s ()altrirctydfa  au ilt)t2tmir3iudllen neiat srtaxmoot1alxn ictasfs2ulnmp u0tltrmociodfmDrln s s) 2tmxo nodam  mfesa(f rraumo;o0opeoiiciltlmDranms u) eenifciy1omD ln s;t)s2uo(r iydlle mncsatfarurx  ot0alxnmo3ildlmDrauvs;t0 rtnio ta1omD  nvo s)sexriopnu1ope miesasfartru  ;t0olt moetydfm2rlumsnt0trxomfctydom   nvo;t)sexrirpiodll  mnciat)a2urum ou4oltomf3tltlm2rl(vo;u) leomo oy1fp raneo;s)teuoim3io1am elfct s  2tax  nt1teen i3iad sDemnvo;u0 ltniocoo1oaD aieo;s s2ur(mpio1ol n ici sf Dtm(m ;o4aleoifeiat a rlumsn(0tetnmf3ootlpD  uvslt0srtmir iu4am  mfvi t) 2trx  ot0tle ifeiatfm uauvont0tltoxfcoy1omD lnes s  rumxopiydoptelfeia( a2rru onu1oet ifetatfsDrlump;u)alenir3ia1fptr uvsl(  rxo(o3io4ameemncsls) rtru o;u4aeto octatfaDra(vo t4areoifcoa1fm r u s t  rur(r3oodlptnmfvtat)sDra(rpot4tlenmfciad m um(vs;(4areomo iodfp  aiei;s)t2xoxr3ny4ome  ncia() rumx  ot4oexniociytfm2ea(ms t0alenmo tatomt anvi;(0s2to(m3oydol  mfeslsfsDtau  no4aeen fciasfs2uanvo t0arxoxr3oydfp eliei;t t2xo(opny1ll nlfcias)srtrum oo0oex  ociatfa ra( p (4arxoxocoa1fatelu o t0srur(m3oodlp emncil(farrau pot4opxn icias m2rlnmo;t4tetnxo tadfpD li sls seuo(opnodlp nlneiatf Dumuroot1aleo ietyt m ean s;t4 rxomo3oa1opDe uvo t)teumiopnu1lpt  fei s  rtrx p;u1aptoif3iyslm ra(mp;t)trtrmo3iy1lmDr ueo;t0 etoxo oy4lme  nciltfa2tm(m no0tet  i3tadla2ea(vpnu4 rxoir3totlmD lnei;s0t2xrir oodapt lnct (fs2tr(mpot4optnif3tydlsDeau p;u) exnmo3ootoat  neo t  2toxo no1ll e iet tf ruaurpnu4tet mictadfs2eln o;t) reomrcty1lm   u s ( trxrxopoudlm n icil()s2um( pou0tlxoifctytlm eln s t0trxomfctatlptranvo;t)s2um(r3iydal  lfcs ( sruau ono0tetniocildls el(mo;u4aeeoircoydlm rli olt trumxr oo4ome lfetat)srrrum ;u0tlxnmicilsfm umnvsnu4alxoxr3oy1la   uvo;(0texm(r iy4open ivsat)srrm( oot4alto ociltfmDrmu pnt4tetnxr ia1oaD lnei t srxrxr nodamtemfctl(  ruaur nu1tpto ieias a2emu s t0trerxr tadlp rluvsls0teumim ny4op  mfes s)aruaump;o4oltomfciatfs2uauvs;t) eeomr ty1op rlu o;t0 rto(r no1al   nei (fsDta(  nu1aleomo3tatla2uaumsnt0aetoif3ootomtraneo (0texmxmpnu4om nlnvt ( aDtmxmpno0alxnmfctlsla2uau snt)arxomo ootlm elivs ( tetrxrpoy1optnmietls) Drmu p;o0tleo i3taslm umn sn() ltnircty1latrln o;(0t2uoio no4alenlfet t)s2tau o;o4opto fctldlaDrmnmpnt) etriocio1faDr nvi t0 exoio ny4omenlncs (f 2taumo;t4apt mfeiyt mDelu s u4tlxomf iy1latr i o;t0setrir ou1ol elfcslsfa2um(  nu0tetomietydla ua(mo u) lenircty1opD  nvilt) 2xo(o oy1alee iei (faDurx  ;u0teeniietldfm2rm(ms u)alxrio oo1lmte nvs s  rtrxmpiu1ll   nvtas)s2rm(rp;o4tpeniieildfa2rluvs t4aeerxf oytop elivi s sexoim3nydalt lics ( arua(roou4tlt ii3iltfsDemu pnu)arxrxo3iatfp e i i;t0s2tmxr3no1lmt lfvilt)srrrumo;t0tlt iietytlm eln pn()artomf3iadlp  anes;t t2xrio oydlleelfvilsf 2ra(rpnu4aptnioctlsfa uauvo;u)tetnxf ty1oat  n s;s0setoxo3iy1lpen iesls)a2rr(m ot4tex mieilt a emnmp t)alxrmo3iydlmDr nes () 2um(rpnu1apeelfcsa(faDrrumpnu1tpxomf3ias s2elump t4 rtrio3oatlpDe ivolt)trumim3oudal e nvtatfaDtmump;u0tlxomo3iydfa2ea(vs;t0aexomo3tadlaDraneol(0srur(m3ny4ll emfeslsfsDrru pno0aleomfcilslmDel(ms t4aeermo iadla rlivs s0 rurim3nu4ole mivs sf Durxrpot1opt ioetas s2rm( snu4alerxo io1omteau olt0trtrxo3no1omtnlivt ( aDra(  ;o1tlen fctysfaDumn s;t)aexrio tydfaDeln o;(0truoim3iu4apenlnei s)a2raxr nt4tlenif3iatfaDran p;()tlenmoctytlatraiesl(  etrxm oy4amtnmnvtls s2ra( pnt4oexomociat a rmnmont4 rxnxf oatlptr uesls) eum(r3ny4om nlfcs sf rururo;t0ope io3iat s2rmuvp (0texoxf iydopteai il(0t2uo(mpio1ope lfetl()sDraumooo4olxn ietlsfm um( p (4 reoiocoodoatr i o;(0setrxrpoodlmtelicilsfartm(mo;t0apt  feilt sDean pnt)artomf3oydlm eaieo t seuo(o3nu1lp elnvilsfaDrrxr ;u1oexnmociaslm umu o t0 ltnmo3tadfpDelnes;t t2xmim io1omt  ncia(  rumxmo;t0aeen oeiydfmDrmuvo t0treomfcoytlpt lnvs t0 2xoxr3oodal   ies (fs2urx ont4tpeoiicildfa2rmu s;t0tltnxf3tytfp   nesl(0s2xo(o iu4llt mivs s a2tmxm nu4aetn f3ilt s rau pnt)tetrxf3ta1opDr i i ()sexoir3oy1lle  ietasfsDtru pno1oleniociadfs uaums (0areoxfcoadlptr ieol(0srxmxm nodlp nmiei (faDtax  oo0tetoifciadla2ul( s (0trtomfctytfpD ln s t0s2to(rpiy1om elivils  2rmur ;t0aeeoiocils s2emnvp;()aetnxfctatfatrau o;s0 2uoir io1omtelneias)sDua(mp;u1aeenmfcilsfmDumu pn(0aetoir ia1lm   n sls0sexmio io4am n ncta()s2rru p;t4tetnmiciytls elnmsnt0tlerxfcto1lpD  ues s)truo(o iy1lmt  ivi (fsrrru pnt4alxo fciyt s rl( pn()aleoircio1fm rluvi (  eumio3ny4lltnmneiat)srrrurpnu1aetnmo3iasfm2ulumsnu0arenmrctytlat  u i;( trto(m iodom  mncia( srtrxmo;u1tpeniieilt m2eauvp;() rxomr3oo1la rlies;(0teumxr oydal  lnctlt srum( ooo0tetnii3iatfs2umnmpn(0 lxnircoodfmteluvo;t0sexoiopiudamen fetat)s2ra(rooo4tlxn ociat a2rmuvsnu)arenifcoatoptr uvo t0s2urir3io4apen ncslt) 2tr(m nt1aleoiociadls2rl( sn() renmo ootfmtrlivsl(  rxrio3oudalenlnctas)a2rau pnu0opxoio3iydfsDul(ms;()tlerifcty1lmD  ueo;t0trtr(m3iy4ol   ncs sfa2rmu ooo1tetn i3iytfaDuluvs (4treoxrciodopt lu sls0teuoir3nu4oltemicias  Dum(mp;o0oex micildlm rau p t4trxoxo3totop e i i;s t2trxopiu4ap e nei ( aDumxrooo4tetoifeild a rlu sn()tleoioctatfp e uvi t)setrxo3iu4am e ivtl()arur( oot4ape mfetyslmDemu s;u4trerxf ty1fmDr n olt)truo(r3io4lltelfeta( aruauro;u4tlxo fctytls ulu onu0 rermrcoa1fatrlueo;t texm(m oudaleemfeiltfsrtmxm ;t4opxn o3tyd sDua(mp ()altomo3ty1lp raivilt) ruo(r nydap e iet s)a2uau oou0tet mfeildla rlu o;(0tlxnxoctydlmDe ueo s) euo(m3oudlpt  icsl()sDraur ;o4oltnif3ilsls ra(vo;u4 eeoif ootomtranes s0trurxo3iy1ll e fesl(farrr(ronu4optomi3tad sDulu snt) eerxf oadfaD auvs;s trxmxm3io1apee ictltfarrau o;u1oetoifeild m eanmsnu4 rxnxo3totomDelnvs;s) exrxr ny1amtn ivta()s2ta( ooo0aeeoiociadfsDem( sn(0tlxrir iy1faDelies t) etm(mpnodapenlnvsat)s2tax pou1tetn fciysfm rmn o u4altnifcia1faDe uvsl() eur(rpoudlm e fvsa( s2umxmp;u4tle  o3iad sDumnms;u0 lenmfciotfmDeln i;s texo(rpny1llt  icsas)sDuru  nt4opxo o3tls s2ulnmonu)aleoxo oodfmDranes;s)s2umio iy1lptnmnvsatfsDrmu pot4oet if3iys s ulu on()altrmf io1om r ueolt  etrxo3oo4lp e nci s  2rauroou0opxn fctadfm elumpnt) ltoxo3ta1fp eli ils0 2urio3nodlpe  ncta()s2uaumpnt1aet mi3iytls um(vs t)aexnxo3iytfa elnvs t0 exrio3oo4lptn icils) Drm( ont4openmf3iyslaDemn s u0texomo iotopte ueo;t) 2tr(r3oy1ap nmfcsatfsDta(r ;o1apx  feiyd m2rmn snu)arenifctytop elnvs;()srtoxm3nu4ole  ncilt) ruaumpno1opto f3iysfm ra(ms;t4arxoxo3to1lp eau ols0 rumim3ou1lm nmnvta()aDuaur ou1tlxoif3tlt m2emu s;(0 rtoxf ta1fat au i;s)trum(o3no4aptnmici ( s2umxrpno0olt  o3tltfs elnms u4
\ No newline at end of file
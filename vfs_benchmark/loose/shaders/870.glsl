@@ -0,0 +1 @@
+uvi;(0 eum(mpiudlmtnlfvi (fsDraur oo0ole moctydlm2el(vo;t)aeeoxf iydoate u o ( s2trxopoudlle mnciat  Dtm(mpot1optomf3iyd s uln onu4arxnmo oodla e u s s  rxmxr3nu4ameemivil(f Dur(mono1olx mo3tlslsDrmuvont0trerioctytfateaivo s0s2xmim3ou4lltnlivsat)sDurxmo;o0tpxomi3iat a elnvont4aleoiociotom eau ils  2um(r ny4olen nei tfsDrrx  ou4tpxoifctytfaDrm(ms;() lxnmf3oodfptelneo s teto(o iu4lm e iesa(f 2rm(mooo4olxo fctas aDul(msn(0treoir tadfa  auvi;s) eumxm iu1amtemnei t  2ururp;u4ope  ieiytfaDuluvs u)altnxrcoodoat anvol(  2ur(mpny4apenmfeslsfsDraxrp;u4tpx iieild a2rmumpn() exnxr3oo1opteli s;(0seuoio3iodlme lics t  Dur(rpot1ale io3tldlm eaumo t)tetrio3to1fmD aiesls0 eto(o oy4aptn iviat  Dtaxm nu4aexoifctltlm2el( p;u0 ltoxfctadlpDeli o s)trxoim3nu1omeemnvs ()srurxmpoo1texomoctadls2ra(vsn()trxnxr3tytfaD aneilt  2um(o3ny4op nlivtas srtr(mono4apxo ieiyt a2ea( p u0tetnir3totfp   u o;(  rtmxo3io1llt  nvsatfarrru oou1tet  oeilsla2umu snu)trxoir iadlaDe ieol(0texoim3iy1oltn iet (fs2rmxrpno0alx  oetadlm emn o;(0trxoifcto1opDr iesl(0t2to(mpoo4ap  mnvslt  2tm(moou4teeo oetytls2el(vp;u4trerxoctodopD ai il() rumxopiy1amenmnesat) 2tm(monu1tpenmicild mDuaumo;()trenmf3oy1fm e i i;t)sexoxm3nodolen ietas arrmxront4tex mi3tatfaDem(vs u4texoio ia1om  lnvsls0 2xrio ou1al e feilt) Dtm(mpou4tleoifctldfaDem( s u0 lxrmf tydfaDeaieo;s  rtr(r ou4ole mfcilt)sDrrxrpot0tptomieiyslmDeln s u4 ltrmrciy1opDe u i;()s2umiopoudamee neslt) Dtr( oot0oltnmi3tys s umump u4aeeoir ta1fa  au ils)t2tmir3nudale mneiltfa2um(r nt4apx iieildlaDemu o;t)aeerif3tatoatrluei;()t2tr(m3iu1olt  nvtl( arum( pnt1oltniieild a2el(mp;t0 ltomrciatoaD  n o t)srum(opny4lmt licsls sDtmxr ;u0apt  f3iasfsDuauvp;()aexnxo iodopD lieo;s0 2ur(rpny1ome  ict ()s2ua(  ;t0tlxomieiyslaDrl(vo;u4 lxrmr io1la  luvs;( seto(rpiu1apeelfcslt a2urxrp;u0tltniieiatls2el( pn(0areoifciotlpteli o;s sexmxopiodamenmfcsa( s2tr(mp;u4aeen i3iydfa emu pnu4alerif3iydlpDrliei;s0 2tmim3nydomtemfvi t arrr(r ot0olto o3ils a2ua(mp u4tlxrxocty1opDrluvs s0 2trirpio1aptelnei ( sDra(r ;o1aex ioeiadfa umnmon(0artnxo iytlm   iei;(  rxrxo3oy4lmtemnvtlsfsDua(mo;o0tex  fciys a2ua( s;u) rtoxo iotfpteaieo s)trxrim iodomeelnciat aDrm( pnu4tpxnmocilt m um(vo;u4altomf3iatfmDr u o t)trxrxrpiydlmeelieias srrmuronu4oet  fciadfa rlnms;t) rxrircoy1lm rluvil()s2xm(o3oo1amee nvsat s2ta(rp;u1tltomfcilsfaDea(von(0tetoxocoytfpteaueslt0tetmxm3ou4lltelivias sDtr(  ;o1apt mieilsfm2um(vp;(4 exnmr todfp eanvi;t teuo(o3iu4al nmics tf rtm( pnu4aeto fetyd mDra( p;u0 lenmrcto1lmt  iei;s0setmxm ou4alen ivilt)srumurpnu1opeo fciasfm uln onu0aexrirciatomt anvs;(  eurir no4lme mivi s aDrrxm oo1apenifetls s2rauvo u0alxrmo iotfate neolt0 2trxo3oy4lpenmnvtlt) Dururpno0tltn fciadfm2rmuvo;t4aeenxrciatopt lnei;()s2to(rpnu1lm nmfeils)arrau pot1oeto feiatlaDua(vo;() leomo3iotfmDrauvs t0sexm(r iy1op emfcs tfartmurpot1tpxomfciyt aDra( p u4tetriocootlp  aivo t srxmim oudap e icilt  rurumpno4tex mietatla2rau s;t0alxoxocoydomD lu s ( seur(opnu4om  lfcslt aDtax  nt0ope micild s emu sn() rtnxf3tydlpD anvs;t t2xo(rpiodlpee ivtlt a2rmx pnt0opeomiciltfs2rlnms;t4trermrcoo1lm rln i;s)sexrxr3oy4op nmnvslsf 2rrurono4alt mociysfsDulumsnt0tetrmf tadoat ai i;( seuo(o3ny1om emnct t)arra(r nu0tle mfciat a rln s u0arenxr3oatlpteauvs t0 rxoxm nydom n ncsatfsrrmxr no1tptnmoctytfmDranvo;t0alenmo totom  aueo t)seumim ny1ol emivtls)artau onu4aetnioctadfsDul(mo;u)alxnifctadfaDe u i;t0t2toir ny1am emfetas) 2rrx oot0tlen fciatla2rmnmo (0 leoio ty1omtran o;s0setmim oodom nlfvsat a2tm(  nt4ope mfetltlsDulu pnt4 rtnif ootfm  aues t  rxrxo iydap  lieiatf 2rrurpoo0oeeniiciat a rl( pnt) exnio3iy1lat  ivslt)seurirpnodoltelnci tfsDumumoot0oltniicilsla2umuvs;t0arenmr3todfaD aivs t t2tr(r3nu4amt mfctls)sDuru onu1olto ictlsfmDuau s u4tlxnifcoodom e i i;t)texo(m iu4alee nesatfaDtruronu0alenio3ilt m rln p t)aetoxo tytfpDran i;s)t2xoxmpoo4am  mfvi s a2ra( o;o4alto fciadfmDrmnmo u0tltoif ootoptraivo;(0 etoxo no1llenmicia()sDrm(rooo1ope mf3iltls ulnmsnu) etnmocoodopD anei s) rto(mpoo4lp  lneias aruru p;u0apx mo3tltlm umu s u4alxoxo3iytfa eauvs;s) eur(r3nu1omtnliesatfs2tr(m ou1apxomoctytfs emums (0texrxf iy1om e i o s0t2xoir3no4omt lnvs t arurxm ;u0texnifctltfmDrl(vs ()trxomrcoodoaDran o;s0setmxo3oudlpeelfcslt) 2rmum ;u4opxnmfetldls2em(vpnt0arxnxr to1opD ai sls0 2umiopoy1op  lfctlt aDuaxmp;t1aptomfcils m ulump u4 ltrmfciytlm rluvo;t0 2xmxrpoy1lpenmnes s) rrrxmo;t1apxnmfetasfa elnvp u)teermocoy1fp rlies s0tetoxopny4apeemictls)artmxmono4tpt mo3tadls elu p;u0 lxoxr3ty1lmtelnes;( srxo(o oo4op  mnesa() rta(m ou1apeoioctatfa rm(msnt)aetoif3todfmtr n ilt) 2xrxo ny1ol  lfctatfaDumuront0apxn i3iadlmDua(vs;u4alxnxf iytfa   u i;( t2xmxrpiu1lmenmiciltfaDtaumpoo4altomo3iydls2uanms u0treomo3oodlptraueo;(0 2xmxm iodlptnmncilt s2rau onu1tetoifetas aDeluvo;t)aetrircoatlpDe nesl() rxrirpno1lltnmict () 2uaxmo;u1oltnmo3ilsfs eln s t) exrir3iatfpD au olt0sexrio3iodam  livt t)sDurx p;t4tlxomoetlt mDulu o;t) lerxoctodlmtrlu o t)seto(m oy1olenlivtlt aDuaur ;o1tptoif3ildfmDumuvo u0tleoxfcio1oa raneilt) eur(mpoydamt  feiltfsDtauroou1opx mi3taslm eaumont0arermocio1optrlu i ( teur(r3nu4lmen ictas)sDua(rpoo4aeeoii3iyt aDul(mo;u4trxnmoctytlate i i;s0 2ur(opoo4aptnlnci t) rra( oot1oeeoiieils aDelumsn(4aexomrcoa1fpDrluei;()srxr(r iy1omte feta( artrumoou4aexn fctatfaDrauvs u0artnmfciotoa rlivo;(0srxm(r3ou4ap nlnet (  2trx  nu1oetnmieiadfs ra(vs (0 eenmo oo1lmt luvs;(0texoim3oy1lptemicsl() 2rax  no0alto f3iltfa2elumpn(4tlxrxrctotlatrli o t  ruoir3oy4lmen fei (  rurxrpot1tex  ictaslsDea(mo;u) etrmr io1omD  nvols s2xrxr3iydaptelici t) Durx pno0olxniociytlmDuauvs u4alerir3totlmD lnvi t)sexmim3iu1opte fctas  rtm(r nu1olt mfciadfs rm( sn(4aetoxr iy1fp  aneils0srxmiopiy1ol e nei s)sDrm( o;o1teen octasfm2rlnmpn(0 lerxf iadlptelu s ( tetmxrpnodoleelnci sfarrrxmo;o1olxnmoeilt s2rmnmp t0 exomr iydfmtr ues t)teumim3oydam elfvsa( sDur( p;t4texoiieiyt sDrlnmont0 ltomo3oy1fpt auesl(0sexmxo ny4omtelietls sDtrum ;t0ale mieiyt sDea(mpn(4aleomr ia1la raieolt)t2xmimpnydape  ictls)sDraxr nu1opt  octatlm2ulumsnu0aeenio3iytoa r uvslt0 exmxr3nudam e ics sf Duaxr ;o0aeenifetys sDumumsnt)tlermocoytom  aivo;t srtrxm oo4ame mncils s2rrumo;o0tpxnifeildla elnms;() exnmr iatlaDe i s s)tetr(m3oydlmte nviltfsDrmum nu1aptnmieiysfm elump;u0 lxomfciydfp eaues;s0t2xrir nu4ole  icsa(f 2tru p;o4tetomfctydfa rmnmo;u0 ltriociodlp eai ils)sexr(mpnudop nlfesls) 2uaurpnt0apxomieiytfs2elnms t) etniociotfm  livo;s  exo(m iy1omen ictls) rrru  ou1texn i3iatla eluvo u) rerxr3oydoatelieo s)srxmxm3nydlleemnctatfarrm(mo;u0tlenifetltfm em(ms u)aetomo3iydlpDelu ol() rum(m3no1al n icta()s2uaxro;o0apt mf3tad s2elnmpnt4 rtrmo todlpt au s ( trxo(m oudlptnlieiat  2ua(roou1aeeoifeiad sDea(vs;u)arxoxr oy1fpD aieols) exrxo iodaltnlfetasfsDrmurpoo0ale  fctaslm2ua(monu4tltrmf totlm e n s;s)s2ur(opno1ap nlict s  2rm( poo0tet ii3iatls2um( s u)tleoir oo1opt  uvols)trtrim oudaltnlfetlt)s2uaxr no0tex mi3ild m eluvon(0aexomrcio1fmD livs;() exoxm oydlmeemicslt aruau pno1apxnmicildls2ra(ms u) lxnio ootom   ivol()srxmxo oo4lltemivia() Drm(rpou4opxomiciydlaDemu sn(4artoxoctadop  auvo s)srtrimpou4opt mnvta(fa2rmum nu0opt ifeiltfa2rm(mp;(4texrmo3ta1omt anvs;(0s2tm(r nu1apte fes s) 2rm(rono0tleoio3ildla2emn s;(0alerif totfmD lues ( texo(r3iu1ole  nctat arrrump;t4tetnmfetys m2eau p;t4trermf iadop eluesls0srxoxmpio1omt  ivilt) 2ra(r oo4opeo i3ildlmDem(mp () eerif tydom  an o;(0 2uoir3oy4lp  lfvil()s2uau p;o0oee io3iat m2rmnvp;t0 ltnifciydfaDrluvils sexoxm3io4omtnlfvi t aDrm( pou0olx if3iltlmDua(vs;t4 lenmo iytlm  ai il(0 etoxo3oudomtn neta()aDta(mp;u4olenmieildlm2eln o u4aexnmo oytfmDe nvol(0setrxo iu4om emfcil(  Dum(mpnt1oltn oeils m rmump;t4 exoio oytlpDe ivs ( sruoxrpoy1altemfcsat)a2umumpoo4alxnifetldls2eaums;()trtnif iodoateaiei;t)srum(r nodale mfvslsf rtmur ;u4aet mfeiys aDrluvs;u4 rxrio ta1omDr n s;s) eto(m3nudape mfvi t) Drm( pno4apxnmoetls aDemnmsn()artoxf iatlmDrluvolt)texoim3iodlpenlfes (fs2rr( oot0apx  f3iatla eaums u4 etnif oatlateluvs;(0trxmirpiu4omee ivtas) 2ra(mp;u1tpenmfetatlsDean o u4trenxrcoatlp eaiei;t) 2toxmpoy4altemfci t arumu poo1ape mfetls aDeanmp ()arxoiocoa1lptelies t) 2urxr3nudomen neilt)s2rrur ;u0ope  f3iyd sDuanvs u)arenxo iy1faDr n o;t0 2urio3nudolenlies s  2uax o;u4opxomiciyd a ea( s (4alxoxrcoodfat li o ()srum(r3no4lme  neil(  2ta( ono4tpeomicildlsDum(vo;t) ltomrcoytfm  luvs;t0t2tmim3oo1opte ncil(fsruau pno4tpxoiiciydlsDul( o;(0artrxfciadom  ai s;t)seumirpny4lmtn nvia( arurump;o0aptoifeiys s2ua(ms t4alerio3ia1lmtr u ols0seumim no1ope mivils s2urxrooo4aexomi3tatls rluvo u) leoio iadlpDelivolt0s2toir ny4ap n nei (fs2rmx  ;u4ale  o3iydfs2emuvsnt4trxrxr ootfmD lnvi;()srtoxrpny1omt  icsls) 2rmurono0alenif3ils a ulump;t)treoxfcty1faDe i o ( texoim oydlmt lnet tfaDuau oou0oleniociysfm2ulumont4aleoxrcia1fate uvolt0 eurxr oy1ol nlfvsas)arrm(m ;t0tpen ocias s2umu s t4 rtoiocoydfaDe uvo;t)teuoxo nu1lptnlnvi ()srum(rp;o1apx  o3tas a el(msnu0arxomr3iadlm  aivs;s teuo(rpio4ameelnvta( a2ua(  ot4opeoiicils sDumn p;t4alxnxrciy1opDeli o;s  2umim3iu1ole  icia(fa2trum ;u4teeo i3ias sDua( on()tleomo3ty1lm raivolt0 rxmxopnu1ope  iet s  rtm( pnt4apx  fciasls2uauvs;(4tetoir3oadlp e ivo;()s2trio iy1omt mfvsa()arur(mpnt1tle iieildlsDea( ont4arenxr iotoaDrlnes t)t2xriopiydlm nmfesl()srrm(ront0opt mfetasfs eanms;t0aetnxfcto1op raneo;t0 eum(m iudamtnlnvta() Dur(roou1aptnioeiydla2rmums;(4aexnxr tydfpteau i;( srtoxrpoydaptemicsa( srumuroot0oex iiciysla2rln p t)trxrxo ia1fmDe ivi ( srxrxr iudopeemfcslt srrax  oo0aee mo3ildla uaums;(4artomo oa1omD aies;() exmxo io1apeelfetasfsrtr(rpno1tex  fctatla2um(vs;() lxnif3tydlmt anvslt)srtoim3ny1amenlnesat  rrmxmpnu4alx ifeiysfmDrm(mo;u4 exoif3oy1la  aneolt0trxo(mpiydllee ietl()a2raxm no1oetomiciat s2rl( s;t0texoxo3oytlm e neil()seumir3iu4lpe micil(  rrau  nt0ole iietad a2eaumont0aleomr3ty1oatrlu il(  euoxrpoy1ol  liesas)aDua(m oo1tpe mi3ildlaDeln snt4 eermocio1fpD an o;()srxrio iu4ap   fei s a2ua( ono4oet iociys a2rmn snt4teeoxo3tytla   ivilt)srtoxr3iydamt lfet t) Drrumpno4aetoioeilslsDrlums;t0alxrxo3to1oat ln il(0t2xr(o3io4lmenmfctas)sDra(r ;t0tpto o3iaslaDulu o u0alermr3io1fa  auvil()s2xmxmpnodlp emivi (fa2umxm oo4teeniietatfsDemuvonu0trtomf3iadlm   neolt  exo(rpoodamtnlfvilsfa2urumpou1tex mictltfa2uluvo u0 lxrio3tytoa r ies;t s2tr(r3nydap n nvs t  2tmxrono1aex  f3tat a2ranmo;u4aleniocto1oaDran s;s) exo(o io1ame  fcsl()srtaur oo4tleo i3tldlmDrl(vpn(0arenxr iytlptran s;t)t2to(mpiodoptnmfesl(f 2ur(rooo4tlxo fetyt s2el( p;t4tetnmo3iotlmD lnvi (0t2xo(mpou1omt mncsa(farumxmpno4tle  oetydfm rmn sn() lxnmf3iy1la e ies;( truoiopiu4oltnmnvi ()a2rmxrp;u4apxnioetytfs ua(vp;u0arenif oadfp  li o s0s2to(rpoy1lpte icia(fa2rmxrp;o0olen oetlsfsDrmuvo (4 ltnmrcootopDr neils) 2xrimpoo4ome  ivta(  2ur(rp;u0tlt ioeildfmDuanvo t)arxrmfcio1omt  uvo;t srurxr3oo1omt mnvia()arrmxrono0aet  fciat s ul( s (0aeenxfctydoateau i;(0seum(m nudlle mnci t a2ra(m ;t4optn iciadlm ulnvpnu4tlerxrcoytla eaies;s s2uo(mpio4lmtnmnvtls  2taurp;u1oeto o3iyt s umn s;t0 renxf3oodfa e i o;()trtm(m3oudam n nvi t srrm(m ;t4ale  f3ildla2ul( p;()tlxnif iodfmtelueo (0teuoimpny4amt  iei t)artmx oou4tleoiociltla2eaumsnu0trtrmf iadfpDe n il(0 exmim3iydap  mnet (  2ta(r no4apx ioeiysfa ul(mp;(0tlxnxo to1lp raueo;s  rtoirpnu4aptnlnvs s srtr(mo;u1oexnioctls mDuluvo;() exrmrctytop rai sl()seumiopiydlme  iet () Duau p;t1olx  oeiytla2uanmo;u0areomr ty1oat  ues;s  2xrxo3ny4alenlnci tfartau o;o0oee  oeiytlmDuauvonu)areoxf tydlatrli o;(0s2um(o oo1ll nmicils arrr(moot4altnmf3iys m2ua(vs t) lermr iydlmteaivs (0 rur(o nydop emiei t a2uaxrpnt1tetoii3iytlm rmuvs (4texoio oodlp r ies;t s2uoxo no1apenlfvia( artm(mpnu4texo ictydla rluvs;(4aleoir3oo1lptraieo;(0 rurim3nudoltn nvta()sDurxmpot4alxn f3iyt m umnvp;u4areoir3iadlptelieil( s2xo(o ou1lmt mnes t  2trurp;t1ape  o3iysla eln o;t4 exoxr oatoaD aies () rtoxr3nu1lle  fviasfsrum( o;u0aet io3tlsfs2ea( p;u) ltomf iy1om  li s;t  rxmimpou4om n nvsa()srrrurpnt0teeoioetysls rluvpn()trerif3ta1omD ai i t0teuoim3iy4lptn fes t)s2tm(m nt1apxnif3iytlm2umump;t4trxoif3ty1lpD luvslt0trumxr nu4oleelictasfsrumxm ou0aet mfeiytls uln p;(0altoxo3oadoa   ues t)texoxopio4lmt mnvsat)sDtmxmpou0aexnmi3iytlmDeaumo (4altnifcoadfm  livi;t)srxoir oo4om eliviat a2tauronu4alen ictls m el( s;u)tlxnmo3tytfm rliesls)t2xo(m iodalenmneilt) 2urum nu4ope ii3iytlsDum( o u0 rtoio ta1omDeln i s0sexmim3oy1aleelivta(  2urx o;t0alxnioeils aDum(ms (0tlerir ty1fat livsl(0 2uoim ou1lme mivtlt sDurxr ;o1oex ioctls s2ul( s;()artrmr iadfpDeanes s seumio nudlpe  ivi t)s2tmump;u1ale ifciyslmDrlnms (0 eerxrctatlm eaivi;(0trtrxr nudlmtemieils)s2ta(r ;t1olxnifctyt sDumuvs;(4arenio ootfa  ai i;t s2um(opiodol   fvilt srrrxr ou0olen iciat mDrl(vo;(0trtomr tydlmt anvi;(0teurim3iu1omtemnet s) rra( o;t0aetnmociat aDumnvs;(0 renmo iytlmteanes ( s2uo(m3iudll  lnetat)aruaurp;t0aee ifeiyd aDelnmsnu) renio tadoate u i;s0t2tmxo3nodalt mfet s  rrmx p;o4tlxoifciad a uanms (0alxnxrcoydlatr u s (  2uoxopny1alen feslsf 2umxr ;u0optn ieiys mDeauvo;t4alxnmfctotoaD lieols tetmim iy4ap  mivilt)a2ra(rpoo1oleomfciytfs ua(mpnt4texrxf iydfpteauvs;()teurxo3ny4alt lnesl() rur(m ot1ope  f3tatfmDrluvsnt4aexoio iodfa eluvols0 rurim iudom nlietatfs2um(rpnt1tptoiociaslaDelnmp (4tlenmf ta1lp  auesl(0s2toxr3ou4lmt mfvslt sDrmxront1alxo iciysfaDeluvo ()texrxociatfpD  uesls  eumxr nydomen ies t)arurxr ;t0tpe mf3ilt a rmumo t0areniocootlpte u o;t setrio ou1olt mncta(  Dtm( pno0tpt  oeiytlm ra(vo u4trxoxo3io1op   ies;s tetmim oodlmtnlneil( aruaumoot1tpenmoeias m el( sn(4tlenio iotopteaivol(  2xrio3iu1amtemnet t)arta(ro;t0aex  o3iadls2uan s;(0treoxf3ia1opt an o s0t2tr(m3no1llt mfes t) rumu p;t1apxoio3iad mDel(msnu0aeenmocta1fp  li o s) 2to(o3ny4am  lfct t) Dumu pno4oltn f3iasla em( p;u)trtoxrcta1lpt  u o;(0t2urxr iydoltnmieta( aDrrur ;u0oeeomf3iydfm2rmnms;u4alxnmrciatlmt an ols)teumir3oo4lm emfesatfarrax p;t0aetn fetydfa ea( p;u) eermf3iodlpDr ivo (0 2xr(r3nodlmee fetas)arurx pno0oltnmf3iat s2ranvon(4altrmocoodfpDraieil()trtrirpny4lpe mieil(f 2trum ot1tpeo feiadlmDra( onu)trtoircoadfp raies;s trxr(r3ny1ame  fvi s) Drr(r nu4aex if3iatls2um(vs u4artomrctotfmtr iesls seurimpno1ap nlfetl( sDtm(mono1teeoiociat s uluvpnu)alxnmrcoydfpte n il(0t2urxr iu4alt mnci s artruro;t1opxoifeiytfs el( snu0teenmf3oo1lat  ivi;s0 exoxrpiu1ol elivi t  Dtaxmpno0tpto feiydfm2rluvp;()trtnir3iadop eauvs s0seumxo3ny1lp  lfvtas  2rmxmo;u4opeomi3iyt sDrm(mo (0teerxf oatfa elnesl(0 etm(rpiu1lmtn iesat) rtrump;t0tlt io3iydlaDean o t0artoio oy1fmt lnvi;()s2to(m nodopt mfcilt)sDua(m oo4opx moeiasla rl(vo u4aetoxfctydfmteluvols) 2trim iydaptemnvil(fsrtmur ;u4alxomoeiltfsDulu p ()trenmrctatfp   u o;s0truo(m oydaptnlnetltfsDua(rpot1alxo feiltlm2rm(msnu)tltrio3iytfpDelueo;t) 2trim3iy4omen ieiat)aDur(r ;u4tlx io3iytfm2uan onu4 rtrxf3oatfpDeln i;s0s2xo(m3nudlm n ivils)sDrru  ot4oex io3ils sDemn p;t0 lerifcia1oa ran o t)srtmiopio4lmenmnvsl(fs2uau pou4apxo ictlsla2rluvonu0teeoio3ia1opDr u sls)texmio nodolenliviatfaDua( o;u4alx  ocias mDumu o (4 lerxo3iydoa ean s ()s2umxr ny1ap elnet ( artrx  ;t1ope mf3tat s umu p;(4aetnmo3ty1lmD auvi;t seumio io4ll n ncia()aDrrxr ou4aleniieiytfmDrmu pn(0 renxf3tytlpt an o t tetm(rpiy4apenlnetat) rtax  ;t1alx iiciydfs emumo;u0teeniocoodfpDelu slt) 2xoio3nu1omt  icia() Dumumoou0aet  oeiltfs2rmump t)arenio3oy1lptrau o s0s2uoirpno1aptn fciltf 2ra(m no0apxnmictatlsDraumo u0aetoir3iotlp   ueolt  ruo(o nu1llee fvilt  rrm(rpno4apx mfetld mDum(mp;t)aexoxf3ty1opD  uvilt  euoxopoy4ame  neil( a2tmu  no1opxomo3iydfs rlnvo;t4alxrir tadla r ueo ()trumim nudlp elfvtlsf Drrx ono1tpt if3iadfa elu sn(4tleriocoy1lmDean i;t)tetrxr no1al n fci sfa2ta(mpoo4tlt  feiatfs2ulnvs;t) renxociy1fa e ies;s seurxmpnydolen fei s  rurxrpnu0oee  oeiadfsDum( s t0 lxnif3iatoaDr ivsl()tetr(mpnu4ap  livsltfsrtmxmo;o4tpe  f3iasfs2ua(ms u) rxoirciydfptr uvo t)sexmxr ou4apenlfes s) Durur ;o0tlxomicilt m rlu o t4 etoxo oy1lp eliei t  2xmxopoy4lltemnvtat s2rmu o;t4teeomi3iydfm rluvo;u)texnxfcoadlm elnvilt srtmir3oodameelnetltfsDraump;o1alxniicildfmDra( snt)tltrmociytoaDe uvs;s teuoim nudol elfcs tfarua(mo;t0openiietltfsDumump u) exoxo3iatom rauvi t t2xmxmpou1om  lfvsas  Drr(  ot0ope  oetyt s el(mon(4 rxoxrctadlatrai i t0s2xoxr iu1om n ies sf Dtruront1oexnii3ilslsDrmuvs u0trxrxf ia1lpDeanvo;(0texmimpiudamee fei sfsDrr(  oo1alxnmfctlt m emuvp t4 eeomr iy1omteauei s) 2uoim3oy1lm emici s)srta(r nt0tlxnmo3iydfm eluvp;(0tltoif to1oate iei t  rtr(opiy1ameelnvi s)a2ta(mpoo1oex mieiysfa rl(vp t)trermf3todoa e nvi ( s2to(o oudom   nes s)arurx pou0tlt ioeildfaDuluvo (0tlxrxo3ty1fp r neols  rxoir oodalen ncils) 2ta(m oo1aeeoifeiys m em(mont0 lxrir3iatlmt lueols0setr(r iu4ome  neiasfartr( p;t1tetnmocild mDeaumo;(0tetnxr tydlat lu ol()seuo(m iudape liesl( aDumur no0open fctadfa um(vs t)tlxnxoctotoateaivslt0setrirpoy4oleemfeslsfaDrmumont0apxomfetatls uanvs t4arxrircoy1op eluei ( t2um(m3ou1ameelncsl()artru pot0oet  ietlt sDra(vp;(4arxoirciydomt anesl()setm(m iu1op nlivslsfarta( ont0aleomfcils m2emn p;t4trtrir ta1opDelivo;t)t2toxo no1omtnlncilsf 2uau  nt4oee mi3tysfm2em(vp t4trtrif todlmDrauvi;(0srtoxm nudame lfeiat a2rmuro;t0tpxnmfetatla2raums t4arenmf iadoaD ln o s0srxrxrpoudlleeliesas) 2ra(mpoo4apen oeiasfa2umuvp;u0 ltrmo3oydopt  i s s seumxm nydaptnlfesa()a2trurpnu0oeeo oetltlm ra(vo (4 exnif3oy1faD  nvi;t)sruoim iodol elies ()s2uaxmo;t4tpxn ocias s2ea( o (0 exnir3ootfptrai s s0sexo(o iydlmtnlivt s sDum(moou0aexoifeiydlm uan s u0aleoxo oydlatr i i s seurim iy1lltnlict ()aDraxm oo0tltoio3iat m2ulumo u)tltoir oo1oaDr neolt) eumxm3iy1openlivtlsfs2tru  nu0tptn fcils a rln pnu4arenxocoodlmDrln s;s t2toxm oo1ol   nctlt)s2ua(moou0oeeoifeiyt mDulu on(0tlxoxo oodfp rlieil()texmirpnydop e icsls  rtmum nu4tetnmoctas s emumpn(0 lxrifciatfp r n i t  2uoxr iodale  ietasfsruru ono4alto fciadlm rluvs;t0 etoxo3io1fp raivs;s0 rxoimpny1op emivs s)s2trx p;o0oexnii3iysfmDumn p;()tleomr3tytopD aneolt seuoio oy1olt  nciatf 2rrumont1aleniieiltfs2em( o t0 lenmr iodomt lueo t)srtr(rpnu4omt mnetls)srurxronu4aeeoii3tldlm2rmn ont)aeerio tadoa  anei t)s2uoxmpny1apeelfvt s  Dua(rooo1tltnmoetas a2rm( p (0 eeoxr3oa1oateaneo;t  exmxo3ny1alte fcil(farua(r ot1tlx  ictat m2rm(ms ()aetoxf3iytlmDr iei t)srxoir3ny4am nmfcs s)a2tmu  nu1tpx mfciytfm2rm(mp;t0aetnxr3tytfm  aneo t t2xmxm iu1ol   iet sfaDrmumono0tleo f3tldla rauvo;u) rtnmoctytoaDr neil(0 rxmxr3io1ll nliesls)srtrumpno0oetniictldfs2emu p;()arxoxocty1fm r nes s) etmxrpny4lm  mfctas)sDtmxront0tlxnmfcilsfa rl(mpn(0altnmr3todfmt auvo t0 2toxo3nodoltnmneiasfsDtmx  oo1tptnif3iyd aDulnvp t) rerxfciadoa raueol(0sexmio3oodopt  ietl(f Dtmx p;t0tlx iieiat s2emuvsnt4aeeomfcoytoaD livs;s0s2tm(rpio1om e feslt)srrm(m ;o1aex ioeilsfmDrmn p;u4aexrif iatlm e ies s seumxm no4op nlnci t)srrrump;t4oleomoeiasfm2ua(mo u0aeerxr iadlmDelneslt t2um(o ou4lm emnet t aDtrxmpot0open fciatfmDean p ()altrxf3oydlpD anei;(0srtoim oo4oltelieiltfa2ur(mpno4teen o3iysls umnmo t)alermf iytlat aivols)sexrir3iy4apt livslt aDrm(  ;u4tpeo octatfa elu s (4arerio3iadfmD aivs;s0seum(m oy4amtemnetat) rtax  ;t1tltomoeiadlm2em( p;()aeenmo3oadlmtr iei ( srxr(m3iu4amt  feslsfa2uaurpnt0tptnmoctasfm eanmsnt0altnxf3iadlm eluvo;(0trtrxrpnu1lp nmnctat)sDtaumpnt0opx  fciadlaDuau p;u4 rxnxo tatopt auvo;s srto(o3iudom  mfet () Duaxmpnu1olto o3tls mDulnvsn(0aeermrciodlaDe neo;t0 etm(o3iy4lm  lieiasfsDta(m oo1olt mf3iasfs ra(mp (4 exoifctatlaD  nvsl( sruoxr3oodopt licsl( sDururpou1ale if3ils s ul(ms;(0 eeoxr3totla e uvsl( trurxo3iydlltelfcilsf 2urxm nt0alto fciytfmDuanmpn(4 renirciy1omDe u olt) rtoxrpou4am emfetatfarrmx  nu1olt  fciytfmDuauvp;u)alxoxf3to1fmDrln s;s0s2uoio no4ap  miviat) 2umxront0aet mi3ildfm rl(msnt4arenxf3totomtr nvo (0 rtmir io4aptelfei (f 2tmum ot4oexoiiciasfs2um(mont4tlxoxo3iotop  livo s)trtoxr3iy1om e fvilsfa2rmx onu0olxniiciasfs2ua( pnt4 rtrir oa1omtr ivs t)t2xo(rpoudamt  ies s srtmx o;u1olxn fctltfm2ean o;u) eenio3to1lat  n s ()t2urxr3oo1ome  fcta() rrm(m ;u0tlxnmietad m2rm( p t) rxoifcoydoa rlieo;s  2to(m nodlmen ici (  2uaxronu4tpxnmoeild a ea(vp (0 eenxocio1fptr u i;s s2trim3iy4apt  fviasf Dtrx  no0aptnmieiytfsDuluvp;t0tltnxo oytfm eaivslt)srumir3iodop  mici t sDrrxm ;o4oexomieiad mDulnvsnu) rxnxf3oatfatelueol() exmiopoydamtnmnetasf rrm( ooo1oetn ociltlaDuan o (0 etnxr3tytoaDean s t0s2toim iudlm   fvsl(faDua(m ;t1opt mietls m ua(mp u)trtnmfciytfptr ueo t0srxmio3oodlleemictas)artmu pnu1apt  oeiys mDem(vp;t0aetoxociadopD  uvolt)teurxopiydale micia(  Drrxmpoo4oexomictlsls2rmu p;t0aetrirciatopD luvs;s sruoim oy4amen icil(fsrrm(r ;t0opx mieiasls emn o u0tltnif oy1fatrauvi s0trxrxopnu1lmeemncils  2uax p;o0aee io3iadls2rluvonu4alxnmo to1fpt luvi;t  rumir3no1olee fvs t) Dua( p;u1tee ifctatls2elumo;u4aexnmo tytoptranei s trxrxo iydam nlfeil( srraurpou4tpt mf3iyt m2uauvs;(0alxoxociotfmtrli s s0 2to(o3iodope lfeil()arraxrpot0aeenmo3tld mDulums;t4 renmo tytfpt  ivs ()sruoxr no4omt mfeia()arum( p;o4aet mi3tytlaDrmuvp;(4tltrxf3tydfpDelues (0t2xrim oydlm elnci (f Duru  nu4aeeomiciltfs uanvs t4altnioctatlmDeau s s)sexo(r3iy1al e fvi sfs2rrx pou1oleo feilt sDrm( snt) ltoxr oytla rlu ils0 2uo(o nodal e fei t srtr( p;u0apt  o3iytfsDel(vsn(0aexrxo3to1faDean s s  euo(m3ou1ole lnesl(fa2raur ;t0texomi3iydfm2em( s;t0tleomo3tadlmt  neols)srxm(mpou1omt lictasfsDrau o;t1aexomoeiydfsDua(ms (4trenmr oo1opD lneil(0 rtoimpiu4olte fvtat  2uau poo4tlxn iciasfs rmuvp;u)arxnxo3totlpD lu ils  exrio3ny1lm emfvi ( aDur(  ;t0tlx iociadla eaumpn()texriocoo1oa  lnvs ( tetmir3io4ape  ivsat arrrumpou1apt ifeiadls rmumonu4 rtnifctatlpte uei ( s2urio ny4amtnmfci s aruaurp;o4apxnmi3iadfa2umu p;t0 rermr iytlm   ueilt0s2xrxm nodamtnliei t sDumu ono4olxoiociat m rl( onu)tetoxo iadomtelivolt)s2uo(m3ou4op elivilt) rtru oot1apenmfeias aDelums (4arxnio3ootfptrlneslt)t2urir oo1optn fvtls  rraurp;u0tpxomfeiatfsDuln s;u4aexrmf oadlmtrauesls)sexoxr3oy1lleemfvilt artrxr oo1olenmocilt mDemu sn()trxrmfcoytfmD li o ( srum(o nudlmen nvslt a2tr(mo;u4aexo fctatlmDua(vpn(0tltrxo totoatrlnvi;()seur(o3oydllt lnvi tfs2trum oo4alxn i3tytls raumon()aetnif oydlmtr u ols) eurir nydlm nlneiat  Dta(mo;o0apt  i3iyt m2em(vo;u0tlermf tydlp r ivs t0teumim iudomtemfes t srtmumpno4opxoifeiyslm emuvs;()tlxrxrcio1op e ivi;t0 etm(rpiy4om  mfvs s) 2rmurono4oexo fctyd m2uan snu0aexrxrctadopDrlnvols sexmxopou4am   nesl(  Dtrxm ;u0tlt  fctydfsDumn o;u0tetoif3iydoaDe nes (0texo(rpnodop elietas)sDtmur ;t1tpeomi3iadfm2ua( s;()tlenxociodlmDr u slt0srtoir3iu1ap nlivsl(  2tm(r no4oetnmo3iat m ul(vp u) lxrxr iadlaDrau s ( teurxopoydlme livta() Dur(monu1aeen o3ilt m eaumo;t4 rxomf3oytomte ieo;s srxm(o3oodlpenlfcsl( aDrrxrpno0oexnmiciydfa umump (4trxnmr tadfmDr n i s)s2umirpnu4olenmnvsas)sruaxmo;o4tpx  octatfm em(msnu0tltnmoctadlaDeauvo;t)trtoio ny1ome mfetltf 2ur(rp;u1tlxomi3iasfaDrmumsnt4tlermr3oy1fp r nvilt t2um(o3oydal  lfeiat)a2taxrp;o1tex  oeiatla2elu p;(4aexrxfcio1omte nes;s sexoim oy4lmtemncsa(fs2taurp;t0alto f3tydfm rlnvo;t)aetrirctodfp r n s t)seurxr3iy4lmenmnvi s) 2rmu onu1alxnmociltfaDumnvs t) rerif3iy1opt lueo;s tetmxrpno4ol  mfvil() 2uax pnt1tlt mo3iydfa2um(ms;u4tltrxocoatoat  i s s seur(m nodlmte fes sfaDur(moot1tpenifetltls el(ms u0aeermf3iy1faDr nvilt) rurimpoy4omt  ics t)aDrmumoou0tptn ociydla2uau s u0 lenmrctotfmtrli sls0sexmxrpny1lpenmfvt sf Duaxrpno1tpenmfeias m ua(vs;u)teeoxr todfm  an o t0truoxo3iodolee fetl(f 2rmumont4tpt  ociaslm2el( s t0trtoxf iatfpDeaivol( srtrxm3iu4lmtn nvil( arraxrpot1oex  o3iyt mDem(vpn()teeoif iy1fm elneols teumxmpou4lm   ieil( aDuax  ;t0tptnmoeiytlm uanmp;(0aeeoircia1op elneil( tetr(o3no4am n iesltfaDumxmo;u0altnio3iadls2rmnmpn()trxnmo iytlmDrlu il( srxr(m nydape lncilsfsDraurpnu0tpxo fciatls2raump t4altrio3ty1omtelnei;(0 rur(o3iy4lltemici sfaDtaxm nt4tlxomo3iyt s2rl(vs (0artrxrcootoptr uvo;s s2urxr3ou1ap n neslt)srtru poo0tee micildlaDuauvp;t0 leoxo ty1oatrln s s0srtmxr nu1opee net t aDrax p;u1aptnmicilsfm2ra( s;u) exoio3oodomtrlueilt seuo(o3oy1ap nmnes tfa2urxmpot0apeoio3tldlm2ranmpnt4trxrxr oa1fmte nei s0 rtmirpny4ll  mivsat)aDrmx  ou0oltnioeiyt sDelnvo;t4tltoio3ty1fmt  uvs;s0 2xmxm3oy1lm   iesasfs2uaxront0aleniieiat sDrmnvo t0aexrmociytlaDran o (0seumxrpoy4alte nctatfaDurump;o4aetn oeiyt s2rmn s;() ltriociodlptrauvs (0texoim3nydlltemfviat)aDur(ro;o1olt mo3iatlmDemn o t) rxoxo ia1lm ean o;t  2xr(o iodale mnctl(fs2rr(rpoo0tptoiiciaslm2rau pn()alerxo totlatr nvo s  rtr(m oo4ap emict s a2ua(mp;t0oeeomieiad m2rlums (4tetrif3totfpt  i o;s)s2xrir oo4lmtn ivsat  rta(ro;u1texnif3tytlsDeauvp;u4arxoxf3oy1om ean o;s truoio iudlltnmiesl(f rtm(rp;u1alxnmf3iadlsDel(msnt) exomf to1omD lu o;() exoir3iodap  mfetl(fa2tr(rpot1tpt ii3tldla emu pn(4trxrif tytfat  iei ()t2um(o iy1altnlicsa(  rra(moot1tpto fcildla ra(ms;t0 eenirciy1fa  li slt0t2xo(m nydaleelnct (f rum( p;o1tpt if3iydlsDuanvp (4 etrmoctytfp rluvs s  exrim nu1op emnesl()srrmxrp;t4optomfctat s ean o;u) lenmr oa1fatrau i s s2xmxopiydlmeelietl()aDumx o;t1aexomfciltls2el(mp;t)tetrxf io1fat ai i s0srurir3oodlm  lietlt sDum(r nt1oee io3ils m ea(vonu0 rtoxrciadfp rlivi;(0 2xmxm nu1ll  licsas s2urxmo;t0teen iciad a ranvs u0 eenmo todom eaivi t  rur(m nydlpee nvs t  rrmxm nt4aee moeias m uln onu0areniocoydfaDrln o s0s2toim3nu4aleemivt s artaurono1apenifeild m elumo (0aexrxr3ia1omDr ivi ()srtrxr iu1altnmnei (faDtmu  ;o1tltnmfciyt s2uanms t4arerxf3tytfatrlivo t)tetrxr iodopen ncs sf Dtax  ;o0tlenmfciadlsDrl(vpnt) rtomrciytopteliesl(0t2tr(o iodol  lfvi s arur(rp;o0aetn fciltlm rluvpn()arxnxrciotfmtrln o;s0 2xm(m3iy4amt mncia(farrm(rooo4apenif3ils s rln p;t4trtomr tadlatrlnei;s)t2uoxm3iudlle lnctas)aDtmu  ou1tltomoetas sDemu p;()aeeoxfcoy1lmDe neslt  rxr(r3oo4om e ics s arururooo0aleo fctad m ulnms (4trtriocoydoa  lneol( texm(r3ou4amtnliesltfaDrmxr ;u1aex  octasfs2um(ms;(0alxomr ty1fmDrauvslt)sexm(opiu1aptnmfvta() Dumu  oo4alxo ictytla rau p;u)trtnir3oytfateauvol( t2trio3nu4oltnlictasf 2ua(root1aeeo ieiat mDrauvs u0arxnmo3oy1lp r ivi;s) euoxopoy1aptnmnetat) Dum(mpou4tlt mietadfa umu pn(4tlerircoodlp e uvils0srto(m3iy1apenmicsas s2ua(r nt1oet mf3iydfm elumont)teenmr ty1om e u i t t2umxopno4opt livi sfsDtaxront4tlt if3tlsla2emumo (4teenmr tytfatrlnvs s) rxr(m3oodll  mnes t)a2uaxmp;o1oeen feildlm rl(vs;u0artnmo oy1fm elueo;s0seuo(r3no1lp  mieilt)s2rrx  ou4altniociltlsDranmo u4trxnmfcoa1fateai s;s)t2tmio3no1lme mnvi s aDtmumpoo1teeoiocias a eau ont4 etnmo iotoat  ieslt t2ur(r iydoleelnvtas arta(m ;u4tpe  feilt a2uanvs;u) rxomr tadfpD lnvols0 etmir3ou4am  miesasf rtrxmpnt0tetn fctys s2umn p;u4trenio todlmDe ivo;s0trurio iydoltnmfvtls)sDrr(  ou1apenif3iltlm rm(ms (4alermrctotlmt  ieo s0s2umir iy4amtelnci ( srum( oou1tex mi3iatls2elnmpnt4altnxf oatopDr ues () 2ur(o3io1op e ietat) rurxr no1apeoiictytfs2emnmp t4 rermocto1la   ivo;t setmim oodapte nvsl()srta(mono4aleomf3iys m rlnvo;(0altrmr oadoptrliei;()t2ur(o3nydllenlnet ( sruaurpoo4tltoioctydlsDumu o (0 rxomocia1fmDeln o;s0sexmir io1al e ivsl() Duaumpnt4tlx ioctyd a2ulnmo ()alenir tydom  aivo;s0 eto(o ou1altelieil(f Durxroou4ope miciys aDeau o;(0altnif3ootom elivi t0teur(m3no4ale lnetls)arumum ;o4tpenif3iydla2uauvs ()tlxrmo3oodlaD luvol(0sexmxmpio1llen fvsls)s2raxrpnt1ape  ictydfmDua(ms;(0 eeomo3ty1laDeai i t) rur(o ny1lltn ies s) ruaxmp;t4oltnmfeiysls2rmums;(4 lxrifcoodfa rln i;() euoio oo4lmte ivt t s2rrxrpou4aex mo3iyslm2emnms (0trtnif ty1optrlnvslt0t2umir3ou4om elnvt s  rur( pno1texoio3iatfsDemuvo t0alxrio3oytla eaneo;t)s2tr(r oy4ap nlnctl(  Dtrx  oo0tleoifetlsfa2eln p;t4 ltoxr iodlat aneols)setrim3oy4ole mivs (fa2raxmo;o1tptomietld m2umnvo;u0trtoxo3oydomDr i i;s tetmxmpiu1lp e fct t) Dta(mpno4apen icilt a2rmnms u)aleoir3tadop eli i s)truo(o oydllt lfvi ( artr(rpot4openiiciatlsDeauvs (0aeeoiociatfpDe ieils setmio no1am nmnvs ( a2tm(rpot4aleomietlslm2eanvs (0tltnmr3tadfpteai ils0t2ur(r3ny1omtnlivil(fsDtmumono0oeeomiciadfm eanvon() leoxo ty1lat ln sl(0sruoxm3io4ap   ict sf Drm(mp;o4tlto feiysla rmuvo () rxomocoatlmteaues;t) 2to(mpoy4lpenlicsas s2tax  oo0olx mfetysla el( o;u4tltnxo3tatlp   nvslt)trurio3nu1lpenlfesl(faDrmu pot4oee  o3iad m emnvp;u0aexoiocoytlpDe uei ( trxm(o oy4al emnctasf 2ur(m no4aetomi3ild sDul( p u4trtnmf3iatlatrlies ( t2uoirpnudlmeemncsat a2rr( onu0apxn fciadfs eanmo u0tlenxrctodlmt  uvs ()texr(r3no1omenmnci s) rta( oot0aeeo fciaslm2emn p u4texrmr oo1fpD  i ols t2trxm nydlptnlnvsa( s2umx pou0apxnmo3ild s2el( snu4teermf totlpDrlueo ( sruo(r3oy1op  mfvi t  Dumu  oo4oexnmfciysfaDumu s;(4areomrcta1lptrai s;s0seuo(mpiy4am  mfeiat  2tax  ;o4teeomfcilsla ulumpnu0aetrmf oodoa elu sl()sexoim ou4lp   ivs sfsrrr(mpot1tleoio3tas a el(vont4 etnmr io1oaD ln o s) eumxopoodlmeemfetlt)s2tax pot4texnmoetys s eau p u4treoxrctadlp e i o (0t2trxm no4oltnlnesa(fartmump;o1oee  ociasfa2emump t0aeermr3tydla e uvsls0setrxrpou4omeelivslsf Dtr(rooo1oex moeiadla ea( o () etrxo iodlmteanesls trxr(rpoy4ll n ncil( a2ur(mpot0altniiciat a rm(mon(0 lxoif oo1latraues;s  rxoxm3ou4omt mies ()s2taxrpou4olx mo3iltlaDelu s u0 lxnifcoodfp   nvi;()srxrir3ny4lmee iesat a2urx o;t1tpx if3iatfmDul(ms (4 eeoif oadfaDeluesls srum(r3nodll   ics (f rrmu  nt4oeeomocildla2umu o;()tlxnxf3iatfpDe nes;s0 rtmxopoodaptelncia()aDumu  no1tpxnmfctys m2rmnvp t4alerxo iodla r u o t t2umxopoo1am n netat srrrur ot0texniieiyslsDulnvo ()tltoxrctadlpt auvilt t2tr(m3oo1ape mfct ( s2raurono4texn fctatls2ul(mp t0trxrif3io1fatrlivo t  2umxm iu4lm elfvsls)s2trxmp;u4aex mieild m2rmumo u4alerxf oodlpt aieol(0srurio3ou1omenmieia()srrmumpot0tee mi3iysfm2ulu p;t0areoxf ia1oa rlivi;(0 2uoxo iy4olt mnvsls a2rru pnu1aet ifeiytlsDemnmo t4treomo3io1fa  aies;( teurio ou1alt mncsl() rtr( ono4opeo fciytfsDemump;u)tleriociytlpteln s ()sr
\ No newline at end of file
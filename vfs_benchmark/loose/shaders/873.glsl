@@ -0,0 +1 @@
+nes t) 2xrio3iu1amtnmfetl()a2ur( pnu0oet mi3tad aDrluvo u) lenxf iodfmtrlneo ( texoxmpoy4aleelieil(faruaxr oo4tltoifcild s2uln onu4arenxf iotfmt luei;t0truoxr iy1amen ivia() 2ta(  oo4oeen iciasls2eln s u0 exoio3oa1opteau o;t0srtmxopoy1lpeemneslt)s2rrxmo;o4opt  ietydls2el(mon() eenxr3oydlm  livo;t0 eumio oudapt lictasfsDtm(moou1opx mi3ild m2elu sn()trxomf3ta1lmD aivs ( s2xoirpio4lmt lnci s)s2tr(  ;u1apxo ieiltls2el( sn(4 lxnxf iodfatr i slt s2uoio ou4olt micsls)srtmur no1olxn ocildfm2em(mo t)alenmf ia1oa  lnvi t)srtoxopoy4amtn icsls aDrmur no4olxnif3iatfm2ul(mon()trtnxf3oo1op  auei (  2tm(rpiodlp emncslt  Dtau oot4tlx  oeils s ua( o;u0 rtoif oo1fp  ln i;t  2uoxm3ou4omtn fvia()srtm(  ot4ole io3iys s ulu onu4 renxf3oadfaDrluesl(0 etr(opnu1ol n icslt)srua(mpnt4tptnmo3iyd a ranvsnu) etomo3iodopDelivols0setmio3iy4lmee nci (f 2taumpoo0aleo fetys s2rl(msnt4arxriocoy1fmDeln o t t2toxo3nudlmtemfvsasfs2um(ro;t0tpxnmi3iasla ranms;u)alxoio3oy1oat  u i s)srxrxr nu1lle  ies sfarrmuroou0tpt mfeildls uauvp;u)tlxrxr iydfmteanvi;t) exm(r3ou1optnlnciat)a2rrum nu4oetoii3tltlm2elnvo;u0tlxoxo3oo1fp  auei s0seuoir oydlltnmfvil()sDur(r nu1opxnioeils s2ul( pn(0trxnxr3tytfaD  ueolt0s2toxmpoydoleelfcsas)srra(  ;t4tle ii3iatfa ra(mp u)tltrmfcoo1oaD lu i;t)teto(m iodal nmnvsasfsruaxr nt1olt iictadlm el(vsnu4tetnmfcia1opD  ieilt)srumir iodapeemfesl(f rraxmont0tpxoifetlsfmDemu s (0 renir3iy1latelueo;t seum(r3oo1ope  ncil()s2rm( o;t1tpt ii3iat a2ea(von() etoir3todfaD luei ( srxo(r3iodopte ics t srurxmpou0oetomfctld m el(vsnt) rxrif3iadlp  lieilt0setm(opnodaptemivi ( a2rmu  nu1oltnmietys aDemumonu0aleomrcio1lp rlieolt)trxoio oy1apeemivilt) Dta(  ;u4ope  ociltfm eau s t4aleomo tytom r n ols)teurxr3nodaptnmivias artm( ooo0oeeoii3iydls2rmnvonu0aexriocoy1om   n sls)teumimpio1lp n nct sf rumxrp;o1aee iictasfm um(vo t)artoircootlm r nei s0s2uo(rpiu4lle  nvi tfsrtaxmp;o1aptn i3iytla rau s t)tlermf iodfp eauvolt  2xrirpno4ll elnctat) 2taxroot0alx ifctld m2rau p u0trxoio3tydlmD au i ( t2tmimpoydlpeemiet s  2ururo;t1teeoii3tytfm2rmu pn(0tltrmf3ty1lmtr i ils0 2toir oudamee neil()sDumu  ;u0optn ocilsfm2rlnvs;t4trenxf3iodfatelu ilt)sexr(o ou4oltelfesasf 2rruro;o1olx  ieiasfs rmnmo;(4trtnmfcoodfaD livo;()s2tmxr3ny4lltn nvt s srumx p;u0tet moeiasfa2emums;u4arxnmfctatlpDraivs t)srumxopiu4omt  fct (farua(rpnu4oeen i3iytfa2ul( pn()treriocoadfm eau i;s seurxo nu1ol e fcia(fsrrrum ;t0tlxomiciysfs umuvsn()texomocoadoaD  i o () exo(r oo4ameelfci s) 2tax ono0teto ictatfmDumnms;t0 exnxr3iadomD  ueo;()sexrxm3nydlpt miet () rtaum ou4tlt  f3iys m2em( s;() lenmo3tytlmDeluvols0s2to(o oy1llee ivsas) rrmu poo4optnio3iadlm ul(vsnt)artrir oatlaDrlies t s2umim oodomtnlivil(f Dtm(  ;t1tpe  ocildfa2ul( s;t4 lxrmrcoydoa eaueo s  eto(mpnodape lict tfaDtau pnt1tex moctatlsDuanvp;u4altnmoctatfatelivs s0s2tm(o3no1optn fcsl()s2ua( ono1opxo oeiydfa2uluvpnu0tltoifctatopDrauvi;s0trtm(m3nydaptnlfeiat)sDra(rpnu1teto ociasfa2rlnvp;t)tltrxf iadlpDe n i t) 2xr(rpnu1oleemncslt  Drrxrpnu1tlxn iciyt aDrlnvo;t)artnir3tytom  lnvils t2urxo oydoleemfct s arrrxmp;t4aee mo3iytla ea(mo;(0aetrxociydoa eauvi t  rumiopoy4ll nmneil()s2rmum nt1olx mociadls2elnmp t4 ltnmo3oa1fate u olt0teuoir nodlp n ncsas)s2rm( ont1apenio3tldfa rl(mpnt4trtnxocoatoa eaiei (  rtr(o3io4ap   fctat)s2tru oou4aex  ictatfm emu o;u0teeoifcoadfm   u i;()truoir ou1op e nct (faDra(r nt4olx  oetltla2rln o (4 lerio3oadlaD  iei ()srtr(mpoy4lm   nvtlsfarrau o;u0apenmo3iasla umnvp;u0altnmrciy1lmDelnes;s0trtoxr3io4al elfvsa( srta(mpnt4oex  feiytfm2emn snt0 lxoircoa1fmDr neilt)seuo(r no4lptemnvt tfsrrmxm ;u1aetomieiltfa ra(mo t4 ltomf oadfp rlies;(0 rumxr3oo1altemnct t  2rr(r nu1oetn ietlt aDranvsnu) exnmr iotopte ivilt0srumxopoudomeemnvtatfarrrxrpoo4aexo o3tldfm uaump u4aleriocta1lp eaiei t)trtoio3iy1lptelnci sf rraumoou0optomo3tytfa2elu s u)texnmf iadfm ranvsl(0setm(m ny4am emnvs tfartrumonu4oltn fcias mDel( o t4altoir3iy1fat li o;t0 rtmim nydalt lnei s)aDraxroou1aetn ietlt s em(mo;u)altoio3tatlmD  ivi ()t2uoir3oo4omen ivia() 2tmurp;u1tlxo ocildfm eauvo;u0aexomociadfaD  nei;t0truo(rpiy4ap n net ( a2raumpnt1tex  fcilt m2um(vp t4arenmo3oytlaDranes;t)teuoir3iy1alee fcs ()aDurur nu0oexnmictlsls rmump t0altrif3oodlptr n o ( setoirpnu1am n ieiat)s2rmu  ;o1oeenmfetytla2rmn s;u4treomr oydfmt li s t s2trxm nydomeelnet tf 2rmx pot4olto f3tldlmDel(mo t0aexoiocoo1op r uvol( s2xm(mpnu4alenlnetl()s2umx oot0tpx mi3iadfs2uln s u4altrxo3oa1omtelieo s  rxoxo no1lmt  ivs t)a2rr(rp;u1aptoioctyt a rauvs;t4 lxoir3iadopD  ivo;s0 2toirpnu1al  mnetl(fs2uaur ;u0aexnifeilslmDemn p (0treriocoa1opDelies;s  eto(r no4ol nlnvsa( sruru  ot0altnifctldlm2ea(ms;u0 leomocia1fpDeli i;t  2urirpny1ale  iet t)s2trx poo1tet ioctatls umnvs;u0tlxomf ty1omt anvs s0 2xmxmpno1ap nlnvil( aDumum ou0apt mo3tlt m umn o;u) exrxfcootlm eau i t)trurxopoy1omenmnetls arua(m ot1aet moctydfm2emuvo t0alxrmrcty1lmDrliei t0srumir3ny4lm   fvi s) 2taxrp;o4aetnifctlsla2umnmonu4aeeoir3tatlm  li sl( truriopiy1om elnctas)s2rm(m ;t1teenifeiatfa2ul(vs;u)aeenir oy1fa elnei;()t2trxr3iydllee nvi t  rrmuroot1tpxoifeias aDem(vp (0trxrio tydoatelivi;s texm(r ou4op   fcslt)sDuau p;o1aetnmfetadfa2umums;t)texnxfcoa1fp raivi s0 ruo(o3iu1llt  ivia(fa2urxr no4oee miciyslaDemums;t0 lxrxr ootfpDrau ols0trurxr iydlpenlfet s  Drrump;u1aexomoetls a2ea(von()texoxoctydom  auei t0 exrxmpoydlpen netls aDuru  oo4altn feils a2em(von(0 etoircoatomDranvils  2xr(m no1omtnlfcsasf Dua(  no4aetomf3iyt m2rlumo t4 eenxf oodopDeanvi;s0s2trimpny4llenliciltfarrr(ronu0aexnmo3ias sDua(mpn(0texrif3iodfp e nvi;(0s2tr(m iy4ope mfcs t artaurono4apen oeilsfa2ra(vp;(4aleoioctytoatelivi (0 eur(o3oo1ame mfetatf Durx  nt1olxn oeildfmDua( pnt)texrmo3oadlm  li s (0srxm(o3iu4olt  ncsl()a2rr( ooo1tetn fctadfa2ranmonu0 ltomo oatlaDeanvols0setr(rpny1omtn fctat) rumx  ot0aetomiciaslaDumnvo t) rtomf oytopt  nesls) 2xo(rpou4lptnmfetl()s2umx o;o4oleoio3iyd sDranmsn()areoirciytomDrlnvs t  rxo(mpnodope  fvt (f Dumxr ou1oex mfctysfa2rlums () lxnxf oodfmt li i;s  etr(opiu1ole licia(  rurxmonu0texn fciatfa2rl(mo;t4trermf oadfmDeauvs;t)seumxo nydomee ieslsfa2uru ont1apeo i3tys mDeln snu0 rxrxo oy1lmteau s;s0t2xoxm3iudlltn feilsfaDuaxrpnt4aeeoio3iltlmDra( on(4trtnmfciydlpDeaieolt) rxrxrpio4ll emivsls)aDra( pno4tpxn f3tadfm ua(mp;t) renirciodfpte nvi;()s2xoiopnu1lm elfcilt  rra( o;t0tlenmo3ildfa um( pnu0 rxomf3iotoptrln o s setm(mpoy4llte fctls)srum(r oo1tpx mf3iaslm rmn o;() rermr iy1oatelneo;t0 eumio3ou1lpe mncsls srtrum oo0oexnifeiaslsDemnmpn(4tetnmr3iytlm  livilt)trtmxopnodom elfei t)a2rau oou4ape mi3tlsls2em( o u0aleoio iotfaDrlnvilt) rtm(opny4ome  nci ()sruaxr ;u0oltnii3ilt mDrluvpnt) leomr3oytfpte neo s)truoxr nodomeelfvils)sDtrumoou4oltnmictld m2rm(vonu0 reriocto1opDelneslt srtoxmpoy4apenmfcs s  2tmx  ou0aex mfctyt s rmn o u0texoxrciytoaDr ivo;t  rtrim3iy1omenmietlsfaDrrx ont4optomoctls m rauvon(4tetoir3tytlat anes;()seumxr3nu4op   nvs (  rua(  oo4oeen fciydfs ea( p (4alxrif3tydop r nvo;(0 rtrio iy4lpe mietls s2tau ooo1oeenio3tytfaDulumon(0trtoifcoydoptraieo ( trum(r oudlp emfeia()srur(moot1tlxomo3tlsfsDrlnmon(4 lxomr3ty1oat aueols) 2xm(m3iudlpenlfvs (faDrrxmpnt0aptnmfctytla rmuvp u0artoio3tatfp rlivils0s2toim no4lle miciasfaDrmx o;t4olx miciytfa rmnmo u)trtnifcootopDr nvs;()t2umxrpou1omtemfvilt)artrur nu1tlto icilsfsDeanvp;(0tetnxr3iadlm r ueilt0setrxo ou1optemfcsat)a2rr( poo4alxoifeils m rm(mp () rxnxocoodopt  n i;(0 2umxrpny1ll nlncs s artaumo;t0alx  fctatfs rlu p u0tetoifcio1om raivi t)t2xoio3oodamenmivia()sDraxrp;u4oeto ociaslaDrm( pnt)trerxo ootopD  uvo ( teur(o oo4lpt mfct tfaDur(r ;t1apen i3iltla ulnvpnu) ltrio3tadoaDrauvsl()teumxr oydam nlnetls)arurum no4apxo f3iltlaDrl(vp;t4aexrir oytfm  lu s;()s2xo(r3oo4ome  ivsasfsDur(r ;t4oeeo ieildls2rau onu)tetrifcoydomtrlivi;t)srtrxrpnu4optemnviltf 2ua(rpou4aleoiieiytfs emu p;(0aexnmf3iydlate i ol( trumirpiudol e fesatf Dururpoo4aet mieiydfm2um(von(0alxoio3iydfp r iei;(  exmxopnodllee feiat  rururonu4aee mfciatlaDrm(mo;t)aetriociotom  luei;t0 euriopny1lmt licsltfa2urur nu1texn ieias m2ua( pnt0 ltoxo oydfmt  i i;s)setoir3oy1olen ncslsfsrtaumo;o0tpxn feiadfs2rmnmo (0arxoiociytoaDe uvs () 2xo(r3ou4ole  ieiat  rrmu o;u1aex iociad sDumuvpnt)tlxnmrcoy1fat  nei ()t2uoxr3iu1ope lneil( arrm(  nu4tltnmoctat m eln on()altrmrcoytlp eanvo;t0 eurxrpnudlpte ivtat aDumxmpou4oee  feiadls2rauvp u)altrxr3oodlp r ivol(0texrir oodomenlfvilt)sruaurpno0aee ioeiysfmDul( pnt0tetnmrciotoat ln i t) etmxopiy1openlfetl()a2tmu p;t4apt mfciltlm uluvonu0 leoxo todlm r u s;( trtrimpio4om elfeils  Dumu  ;u1oetnioctltlaDelnmo (0areomo3ta1fmt  neol()sexmim oy1olenlnvt s sDrmu pot4tlto o3ilslmDemuvo;(4 renif oodlm  auvols0srum(r3iu4omt livtlsfsDtaxmp;t1olxo o3iadls2ra(mpnt) eerxoctytlp  lnvi s s2xm(o3nudamtn fcta()srraxr ou0tleo octatfs raumonu0 etnif ootoa  anesl(  exo(rpnu4omenliei t)sDtaxmpou0alx mf3iltfs2ua(mp;t0tetnxf3oadla e n s;(  eurir oudoltelfei ( s2um( poo4olx mfciad sDulumo;u) reoir3oodlp r uvo;( s2um(opoy1lp nmfcs sf Drrxm oo0tleomfctaslm2rmn p;u4tlxnxo3to1lpteanvo t0 2trio3iydomtn nciatfs2tru  no1tptomo3ilt m2ra(mp u)tlenmo3io1fp  aueo;(0t2tr(r3iudoltelfeia(  Dtmxroou1apx  i3ias s2ra(mp t0tlxnmr iatopD  n sls seto(m oydame mfetatf rrruront0tptn f3tydla emu o t) rtnmfctotfate ivolt0 2xo(o3nodalen fvi t srra(mpot1oetnifctydfm2ul(vs u4 reoxf oydlptran ol(0s2tr(r3ny4lp elfesl() 2tru pot1olen o3iytla2rmump;t)tleomf ty1lp rluvslt trurxmpoo4lp nmneil( sDrmump;o0tlx mfcildfm umumonu) rxnmr3oy1fa eln o;s)setmxo3oydomtn nvils)sDua( p;u0olt  i3tad sDuauvp u4alxomr oo1lmtr neo;(0 2xmiopoodlleelivt s  Dtm(m nt0tltoiociytls2elumonu4alerxo iotomtrau ol() 2to(rpny1optelneilsfaDrmu p;o0tpt  ociat a elums t0arxoxo oadomDeluvsl(0 rxo(r3nu1altn feta() rtrx pnt1optn o3ilsfm rluvsn(4artrmf3io1lat luvi s texo(m ny1ll  mnvtls) Drmxro;t4ole moeils sDrmuvs;u)artomo3tadop e uvs t0srurxrpnudll e nctatfaDtm(r ;o0tet  o3tlslmDra( snu4 etnxf oatlm  livils0 rxoim3oodoltelfciat  Dumx o;u4tpt iieiys s2ra(mo t0trxoio oa1op eauei;t0texr(r oydllen ncsl() 2tmxroot4tpto octlt a2uanvs u4texnmrcoodomDe ivo s)sexmxr oy4ale mfetlsfarua(mono4tpto octasls2eln p t0aetnxfciytfa eaneo t0 rtoxm3nu1aptnlfcilt) rtru pno0ope ioeiadfsDelnmsn(0aexriociatlatelu sl(0 etmxo3oo4lpe  nvt ( srrr(rpot1tlxnmictysls rm(mo u4aexoxr3iadom eanvs;t) 2xmxr3ny4lpe  nesltfaDrm(mp;u0aexn o3iatfm2emumsnt)tetoif ta1fp   u ilt)texrxrpiodapte fcils) rtrx  oo4tee ioetatlmDel(vs ()tleoif3ootfa  li olt0s2to(opoy4ap e fctatfaDra(mpou4tltoiietltls2rluvo;u4aexnmf oatlmteli o;t)tetoxm nu1aleelncs t)aDrmu pou1openiieiys m ulnmpnt0tltomr ty1fmD lnvil(0 ruoxo nydale lncias)arurxmp;u4tpto octldfs2umnmp ()arxnmoctydlaD  ues;( t2xoir ny4amt  ivtl(farum(rono1tpeoifeild s2ul(msnt0trenmrciy1opDe ivsl()tetr(o3iydal n ictls) 2umxmpno1tpt io3iyd a2em( o u4aeeoif3ootfp ran o;t)trtm(rpoo4lmtnlfviat arrau  ot4tetnmiciltls rm(vpn(4tleomo3iadlaDeaueols)setoxm3nodlp   iet s a2taur ;t4alxnifciyslaDra(ms t) rtnxr oy1omDeauvilt  2tmxrpno4ape mieil(f 2tm(mpou0tle  icilsfa2umuvp;u4trtrxfcoo1fmteaies t s2trxo3nydole  ietas)sDtmurono1tlen i3iyslm rlnvpnu) etrio3oa1fptrlieols0 etm(m3nydoltemnesas) rua( o;u0tlxomi3ilt s ranvon(4treomfcoydoa rlnesls  ruo(mpno4ame  feta(fs2rru p;u1tlx moeiasfa2uanvo t0artnir3ia1fpD  ivolt srxrim oo4am n netat)s2ua( pou0aet  feiysfm eanvs u0texnio3iadfatrauvi ( t2tmxopoudape mnes tfaDuax p;u1ape iieiysla ra(vo;(0 eeoiocootlateai ol( srum(rpou1ol nmncs ()aDtau  nu0apt mietlsfa ua(vp;t4texrxfcoodlat  i ils sexmir nudal elieslsfa2uax oou1aexo o3iltls2emu sn(4 etnif ootlm e u s (0t2um(opno4aptnmfvt t)s2tmxmpot4opx ifeiytfa eaumpn(0 eerxrciotfmtrlivilt)t2tm(r nodll n ics ()a2tau p;o4tpt mfciydfaDua(vpnt4tlenif3iy1lat auvilt0s2to(r3nydapt mnvsa()srurxmpoo4aetnioctltfaDumnmonu)teeomocoy1la r u slt0setm(m ny4alenmfctlt) Drmxmpou1alt iieiltfmDeanmonu0altomrcoatfpte uvils0 etmxm iydlp nlfvil()sDrrurpnu1tet mo3tatla2eanvo;t)trxnmociydoatelnvolt setr(r nudame  nes (faDuaurono1aeto oeiltfm em(vp;t0trxrmrcia1omtrlueols)t2trxmpiydoleemici () 2umum oo1tetomietltfsDeanmo;u4tltnxrciy1la r nei;(0trtrio iudaptn nctas srtmxmonu1apxnioeildfa2ea(vo;u)arxoxf oydlpt anesls s2umxr ny1am nmnvia(f 2raxr ;t4openmo3iyt aDua(ms;(4trtomocoytla   n i t0s2toio3nodlltelfes t  rra(r ;u4tpx  iciyd a emn o;t4 leoir oydfpD  nesl( srtr(m3oudom e fetas)arrmu  ot1apxn o3ilt aDra(vsn(0artoio oydoa rlu o s0 rxr(mpnodomt mncil( aDurum ;u1apeomoeiydfsDel( ont0texrif3ta1oa e ieols) eto(m3io1oltemfcsas sDtmump;o0tetoioetasfs2eanvp;u)artnmr iodom r nvol()s2tm(o iu4oltnmiei ()arra(m ;t4tle io3iasfs2emuvo () rxoir3oa1lpDe u ols0 rumio iydal nlnctat s2rr(mpoo4opt  fetasls emn s (0teerif3tatoptranvs t0srtoim iu1lpen feiat)srtaxrpoo4apeomociadfs rl( onu4 rerif3oa1fpD  nes t truo(o3oy1op e netas) Draxm nt1oeto ociytfa uauvo;u4 lxnif3iotoaDeli i;( trxoim oudoltemfes sf Dtaxmpnt1tpeoiociat sDul( s (0tlermocio1latr nes s0seur(r3iu1alte ncs t)sDrmu pou4aet  o3iltfm2ra(mpnt)trxnxr3oatlpDelivi;s0s2uo(r3oo4am n ncil()arumu  ot1oeeomi3iydfm2raums;(4trerxo3oo1om ran ols0tetoxm iudolt mivt ( s2uru p;t0tlxnifcildla rlnms (0 eerio ta1fpDelnes;s0truoxm nydlpen nesa( aDtrx  nu1alxnmociytla elnmp u0treoio oydomt  uvo s srtr(o oy1ape lici t s2rrurpno4teeomicilslmDrln snt)teenio3tytoptran s ()seurio3iudlmte netas  rraur nt4tetn f3tasla2ua(ms;t4aetoxfciatlat ln s ()texrxopoy1ap  lfciltf Duau o;u0alen oeildla rau onu0tetnifctydlpt ln i s) 2to(m3oydll nlncias)srtmxr nu1oee mf3tyt mDea(vs u0artoxo3ootfpDrluvo (0 exoxr ou1lmtnlfcsat) Draur oo0tlxomo3tysfsDeanvp;t)alxnxr iydfat  ivo;s)t2um(mpiudal n fvs (f rrrum ot4altn ieiytls ea(vs (4teenxf3io1oaDr ivil( t2xr(r no4ol e fcil()srtr( pot1ale  fetadlaDem(ms t0trxrmfciytlat ln s t)trurimpoo1omt lnciatfs2rmu p;t0aexomfeilt m2emumsn() lermf oatlptr neo s  2xoio ou4lptnmfeslsf 2ua(  oo1aetomfeild a ranmp t0 ltnir3iy1laDeluei;s)s2xrxopiy1oleemnesls aDtmum ou1olx  i3iytlaDemuvp t)aleoirctadfm   ieo s0 2um(o3oydole lfeslt)arrm(r ;t4opxnifetlt sDuln p u4tetrio tatfmte ies;s0sexrio io4opeelnct s)s2tmxronu0opx mociadla rau o u0tltoir ia1fat livsl(0 2to(o3iy1lpe mfvs t arumx  ou4olx mf3tyt sDrm( pn()alxomr3oo1op rauvs;t sexrir3oo4amtnmivsat)srrr( o;u4olt  ieiyd mDua( p t0tetrmr to1fp eaiei;t)t2xm(r oodole licsl(fsrua(monu1apxnmo3tls m2el( o t4 exrif tydomtr u sl(0 2um(opnydomenlicta(fa2uru pot4olt mietldfs2el(vo;u0 rtrxo oo1fm e ivi;t setrxm3nydomenmfei s srumu ont1open o3iadfs ul(mont4tlermrcoo1fm eauvslt  etoimpnu4ole mnctat)sDumxm ;u4texnmi3iad s umn o;(4 reomocoatop rlivi s) exo(opoo1olenmiesls)a2umxmpoo1alt  o3tlsfm um(mo;t4areoxo iotfat lnvo;t) exoim3io4opee nesltfaDur(monu4aeeoii3tysfm2eanmp;u) reoxrcoy1lateauvsl() eurxr iu1lptemfviatf Dum(rpnt0tptnif3tadfmDemumon(0 exnxocty1omteli sls trum(m3nu4lmee fvs () rta( pno1tet  ietys m2emuvs;() rtomr to1om eluvo;t)s2urir iydal   fvsls s2rrx  no1oee  iciysfs uau ont0 exrxf todoaD  uesls0 2uoxr iy4amt  neils a2ur(r ot4ole miciydfsDeluvp t0aeeoxf3tadop  auvi;s srtrim iudalte fvt () 2rr( onu4apx moetatlmDran o (4texnxrctydfa elnvi;t)teuoxo ou4al   fvi s srumxro;t1texn oetad sDemumo ()altnxo3ty1omtelivs () 2uoxm3io1ope liei sf rtrum oo1alxn iciadfa ra(vpnu0arxnir3iatlatean slt  2tmim ou4lle  fvtls  Duaurpnu1opt moetlt sDrmnmpnu4aeenifcoadlaDelivo;() euo(m oo1ome licias)srrrxm oo4tlxnifcilsfmDemu s;(4 lenxo3totom   i ols s2tmxr iydlme mnciat  Drmurpou0ale  ietadlm2ua(vs () lenmrciadfmt auvil( s2um(r iydalenlivi sfarrmxr ;o1olx  f3tatlm2el( pnt)trxrxr3oo1omtranvs;t)srurxmpnydape lfvtltfsrrm(rono0oex  o3ils a2elu s t) lenircoa1latrauvs (  rtr(opoo4am   ncs sfs2ur(mpou4tpto iciatfa2elnmp;t0 ltnmocootoaDe uei;() exoimpiy4optn net ()a2trur oo4aexoif3ils a rlnvs u0aeermf ia1lpt aivsls t2trio nu4ll  livt (  2urur ;t4tpt iieiyd a2um(mp u4 lxoxocoydlmtrau o (  rtrxo3iy4lp  mfetasfa2ra(rooo4ale mo3ilsfm2rmnmo (4tltoxrcoatfaD lieols trtrxm iy1lm emncta() ruaxm no1apxoifeilt a2el( pn(0tlxnxo oytlatrau ol(0trtrxo3ou1amtemfvilsf rtaxmpou4ole mfctadlsDrmnms u4treomrcoytoa rlu i;(0s2tr(opnydlptnmfvsls s2tr(mont1oetnmociysfs uanvo () eeoirciydfm rlnvs;t  etmiopiydopenliciltf 2umx pou4oeen i3iyd mDrmu p;(4 lermo oy1lpDeaivs ()srtr(rpnudlp e ncia(f Duaump;o4ale ifciytla2um( s;u)texomr oytoa r ies t0trtmim3nudllenlfciatfaDrm( oot4tpxo oeiadfaDra(mo (0 lermf3oydop rluvols) etoimpno1omt lfvsls s2tm(mooo0aexnmfctas s emnvp;t4trxnmf iytfp  anvo t trurim3iodaltn ivtltf rumurpoo0texo o3iad aDel(mpn(4 lxrxfctadfmD li i;t)trxmxmpou1amt  icias a2rmx ono0oex ioeildls ulu p (0artrmo3iodop eli i;s0 exmxm iodlltnlfesas)artrumpnu4apt if3iyt a rmumpnt)tetrif io1oaDeln i;t  2xoxo iudlpen ncia() Dtm( pno1tlxnio3tldfm umuvp;(4 exoio iadfm   ivi s) rtoxrpny1op emfet t)a2rmu p;u1tpxnifetadfaDem(mpn(4tltrxfciydfpD  u ilt)texoxr no1apt mfes () ruru poo0tltomf3iasfa2rm(msn(0altnxr3iadfm rauei () etrio ou1am nlnvi (  2rru  nu0open fciydlaDrmumo u0texomf tadlmD livi;t  etrim3iy4al n ivia(fsDuaxrooo1olxnioeildls2el( p;(0areoxo oydopD livo;() rtmxo3ou1ole mnct ()a2rrurono4aexoioeiydla rau s;u)artnxrcto1fpDelivo;() etm(m3nudolt  nct ()a2umx ooo4altnmi3iatfs2eanms t4tlxrmoctytop ranvs;t)srto(r3oo1ame  nct t  2urx pnt0olxomf3ild sDuauvsn(0 rxoio iy1late n s ()srxrimpiodoleelics tfs2tm(m no1ole moetadfmDel( sn(0 rxoxf3oadfmt anvo;( s2xm(r nu4lm nlfcias)s2tmum ;o1aleo feildfm2eauvpnt0 rtnir3iytopt luvo s)tetrxopio4oltn fcia(fsruaxronu0apeoif3tltfsDrmump;u4altnxo3oatfatraivil(0 2xrirpio1ol eliesltfarumxroou4texn f3iyslm2rmuvs;(0altrmocoa1laDelnvi;(0srxm(rpnydlltnlnvs ( aDtr(r ou1oeeomieiysfsDulump () etoif iodlp raiei () eumxo iydaltn feiltfsrtm(mono0opt  ociysfsDra(msnt4aexoio3totlp rau ol( trur(mpoydllte fct ( a2tmu o;o1opt mfciltfs2uauvp;u)tlenxfciydlmDeln o (  rtmir iodlme  ncslt s2ta( ont1apxn ociatfsDuln p;(4aeeniocoadlmte ieil( trtm(o3no1lm nmfetas)s2ur(mo;u1oeto o3iytlaDraums t0tlxomociodopDraues;t trurio3iydol eliviasf rumxr nt1aeeniietad aDelumo ()areoxfcoodomtrau s;() exrxm io4amtn ict (f 2rm( pnu0alxo fctltfs em(ms;t0 lerif3iydlmtrluvo;() rtr(o iu1llt liei ()s2tr(  ;o0apxnii3iasfs2umnvo ()texniocoa1lpteai ols)truo(r ny1ole miciasf rrr(rpoo0opto oeias sDeanvp;u4aetnxr3tadomDeaueolt)srxm(o3iy4lpen fvil()arrm( pou1oet mietltfa ranms;t) rxrio3iydlm  an o s)sexoxm3oy4om n fei sfaruaxmp;o0tee  ieiydlaDrm(vp;u0 lxoiociy1opDrlu sl( srurxm3iy4ole lfcilt arrmu oou4apxo ocild s uaumpn(4tleoir3totfatelivo t) rtm(mpoy4lleeliviatfarum(rooo0oetnifeild mDrmnvs t4 lxomrcoo1lmte i i (0trxrxr ou1lm   nct (  Dtrx pot0opt mo3iasfa2rln p;t0aetrxf iodla rlnvsl()trur(o3iy4lmtemfvt tf 2tm( o;t4aexn feilsfaDel(mont)tltrxo3ia1opDe n i s) rtrxr3io1lpe lfct sf rur(rp;u4aetoii3tldlm2umu p;u4 lxrxr oy1om   i ilt seuo(mpiudom n ivsl(fsrtau ooo1olt  ieiat m2eauvp;t)trxnmf3oydlpDeaues s0s2tm(m nodop emncslt) rraxmpoo1opeo f3tydfs2ulu o u)trxomr iotfpD ln i;()t2trxm3oudoltnmietls srurx  nt4alx  ietyt aDrmnms;u4 ltnifcto1latr i o t trxmxr3ny4ol   neslsfaDtmxmpou4tpenioctltfaDumnvs;u)texnif ia1fmt li slt)srxr(o3ou4opt lfcs tf rrrump;t1ape  feiyt mDulnvp ()arxomocoydfpD lnvol()texm(r oy4omtnlnes t)sDtmx pot4apxomociad s ranvsnu)altnxf3iatfptr nes;t)t2urxopoy4optemnvt ( sDrm(r no1texo i3tyslm2rm( p;u0aexrmo3tatopD aivilt) rxrxopoo4lltemivsas  Dur(m ;t1opto ietasfa2rau p () eerio oy1lmDrlnes s srtr(m iu1ope lfcs s s2um(mpot4tlt iociasfa ea(vont) renir3tydlpD  u s s)trur(opoo4llte net t s2umxrooo4opx iiciytla ulnvont0aetoif ootlaDeau o t0t2uoxm3oy4altnmnvil()srtr(mpou4alt  ictydla2rmnvpnu)texrmfcoadlmteaies;s trxrim oo4lptelnetls aDtrxronu1optomoetltfm eanvp;t0areoiocty1omtr neilt0 exo(o oy4apeemies t) 2uax  nt0oexo f3iyt aDemnvp;u4trxoxocoa1omt luei (0seumxo3oo1altnlici s) Dtrxmpnu1ole  oeias a2eluvont0 lxomo3oy1opDeauvs ()t2trio3nu1am  mfesas sDtmur nu1oee  fetasfsDea(vs u0arxoxoctotopt aieil() euoim iy1olenlfes sfsDuau p;o0tltnifeils s rmn snu)trerxocoy1fpt aieo s)s2urxmpnydome miei tfs2rrx pou0oetn f3iyd s rluvo;t4tlermr to1lm e uvils) exmxm3iu1lptelfct ()sDrr( onu1tptoif3ilt a el( on(4 rtrircia1op rln ils)trtmxmpiu4oleemfei s)srumu ooo0openmfeiyt s umumo;t) lxoxf3oytlpD auvs s0seuo(opnu4ol emivtl()s2tmxm ot1aeenmfciyt mDul(mo;t0alxoxf iatlm r u i;()sexmim iudapt lncil(faDrr(  nu0tpx mictadla2ranmo;t) rermf tytfpteai o;t0seum(m3iudll e fvs t s2rr( pou4aleomfctldlsDel(ms (4alenxf3oo1laD ln ol(0 2uoxr ny4lpt lfetas artr(rono1tptomfeiyd m2ulnvp;t)aeerirciydomt au sls0teto(mpio4olt licsas) Dtmx pno0opx ifctldfm el( p (4 rxrmocootoatranes;( t2xr(r3oudapt lnetl(f Dtm(mo;o1ope ifetlsls eauvpn(4teeomrcoydopD livi s)srtr(opio4am elicta(f Dtaum ;u0tlxomiciad s eaumsnt) rtnirciydom ran olt) exoxm oodam nlnvsat sDta(r oo0tpxn i3ilsls umu on(4 lxnir3tytlpD luvs;()trxrxo3io1lle lneil()arra(rpou4olenmf3iadlmDea(vpn(0 ltrxr3to1fpt  ivs;(  2xrimpiu4amte icta(fa2urx p;o1ole iieiltla umuvs;u)arxoif iydlmDrlnvolt)teto(m3nu1lltemfci (faDuau ooo4ope ifeiyd m rmnvont4alenmfctodfmte uvs;()trxr(m3iu4om  mneslt)a2tm( ono1teeo octlslm el(vont4 ltrxfctatomD anvo (0 ruoxopiu1am   fviat) rtr(rpou1ope mi3tlsfaDrlnvo u4arxrif3oo1fmDeli ilt0sexrim3nu1ll  lfci (fartr(r oo0tlto i3tldlaDrm(mp (0aetrir iodfm eanes;t0 etrxrpiudam n fvs t  rtrxrpnu0tlx  o3iydfaDum(vpnu0aexnxf oodfpt livo;s0t2to(r oo1lpenmfvslt) Dtm( oot4ope ii3tatfm uanvpnt0tlxoxf tatfatr iesl()s2urir iu4aleelnctasfarur(mpou0aee iiciys m uau p t)arxrmf oydoaDrlu i;s s2uo(opoo4lpeelicias sDtrxmono4tpx moeiadfaDem(msn(4aexomr oydfaDr i i s srur(r no1lme mfvi sf Dtru p;o1opto o3iadlsDrmums;u)tlxnif tytlmt au ol()srxrirpou4ll emivia( s2urum ;t1tpe mf3iysfm2umu s;(4altoio oa1lm r n i (0tetrxo no4om emies tf rrmxmpnt1texoifetadlm ra(vsn()aetomo ia1laDr nvs;( trxoimpoy1apte ivi s) Durxmpnt1tltnmi3tlt a2uau o;t0altrmf3iy1lmt auvo s0s2tm(m3nu4oltn iesls artr(r nu4opxn ieiltla2um( ont0tltniocia1opt aivi;t0t2tmxrpnudllee feiasf rrrur no0olt  fciyd m eauvsn(4aetnxfctydlmDrau i s  rtoiopiy1omt livia()a2ururpnt0tltnioctad a eanvon(4teenmr3ty1faDrluvilt0 2ur(m nodlltnmnes sfsrraxrp;u0oexnioctatlmDemuvs;t4 lerif oodoaDe uei;t) rxmxo nodaltnmieiat)artm(  ;o4texo oeiltfa2uauvpn() lxnio3iadfmDe i s;t  exm(o oy1lmt mfvt s)a2rm(mpnu4aexo f3iltfa rln snu)aeerxocoydlmD  nvilt0trur(m ny1aptnlfcslt)sDum(  nu4tlx  oeild s2rl(vsnt0 rxnmf3oydfpDran s ()s2tm(rpiu1opt liei t  rrrx oou1opt  ieiys mDrlu p t)tetrxr io1lm  aieil()seumxo3oudapte iesa()aDumurpno1olt miciltfa2ea( p t)trxoifcty1lm e n ilt)srxoiopio4lmeemfvsl( aDur( p;t4aet ifctatfa ra( pnu)trxomfcio1lmt livolt0seumxr iydape mfetltfaDra(m no1olxo fctlsfm rl( snt)tetrif iotlp   u i t) etmxm3nydlmee ivt (f 2raumo;t1tet ioeiysfsDumnmo u)texrmf oo1oaDe n ol(  eumxm3nudapt  ict (fs2rau ont1tpt ifeildfm emu snt4trxrif oodoatraivi;s)s2urxm3nu1apteliviat)sDurxroot4tlt mi3iatfmDumuvs;u0tleoxrcio1lpDrlu sls sexoxrpnu4ll emfetl(f rta(rpou1tet mieiaslaDeaums u4trerxr ootfmDelieo ( setmxo3iy4ope mivs s)artmump;o0apx mi3tytlm2rlnvs ()aetnxociadfa e i s s)s2xmxr ny1lmtelfvslsf rra(rp;u1tlxnmociys m2umump;t4 rtoif oy1fm rli olt s2xoio oy4omeelncs ()a2ua(  ;u1ape  f3tlsfs rlnvp;u)texrir3iy1lp rli i;s0t2umxrpnu4ll  micsa(fa2rmumooo1tpenmoetytlm eau p;() etrxociatoaDrlieo s) 2toxmpoo4ope mfvtlt  rur( p;t4tee  ociasls el( s;u)alxnir iotomtr nei;t0 2xoxm3no4op  lncsls)a2tr( oou1olx ii3iad a umump;()aeerxo oytfaDr i i;t0setoir3iu4apt lfeias srum(mo;u0oltnmictasls eanvsnt4arerxr3tatomDelnes t)trtmxrpoy1lpee nvs ( arum(mooo1altn o3tlt sDel(mpnt0aeerifcoadopDrlnvilt truoxr ny4al nlfvsls)srrmum ou1olxnmo3tas s emn snu4aleoir3tydop eau i ( s2toirpou1lm n nvsltf rrmxronu4tpeo fciydlm ranms;t0areoxrctodfa raneilt0 rxoxo3iodol nlfvi tf rtau p;t0tltnii3tasfmDemnmon()arerxfciatfpD  uei;t0t2uoxo iu1amenmivi ()sDtax  no4aex iietls sDrlumo;u) etnxr3iotfpD liei;s trxoio oudol  licsa(f rraxm oo0aee io3ildfs2rl(vo t)tetoircoodlaDrauvi t trxmir ny1lleelfctlsfsDtr(  ;o4oet moeildls2um( on(4trxnxo ia1fm eaivo;s truoxm3oo1aptnmfeil() Drrx p;u0tpxo o3tyd sDulnvs u4trxoifcoatlptelueo s)s2toxopny4op nlicsat a2ra(mooo1oeenmieiydfa uaump t)trenircoatoa r i ils) 2xoxo3iu4ame micsls)srraum no0oet ifeiadfa2rmumsnu) rxomoctadfm rauvo;() rxoim iodomtelfvsasf rtm(m ;t1alto f3iltfaDuau snu0 eerxf ia1fpD luvi t0 rtr(rpiy4optnlivtas a2taumpoo0openmfciad sDrmn snt4tetnxo tydlpDrlu o s0 2toiopnudomenmnvsa(farrrx  nu1oex miciydlm raump ()aexnmf3ty1opDrlneilt) etoio3nu4apeelieil( aDta( pnu4tpxn o3ilslsDrmuvo;()trtomr3oatfp ran s () eumxopny4om e fvtat)sDuaumo;u1oetniieiysfa2umums u0texrxfcoa1fp rlueslt  rxoxm3iydlm emnetls  2tmurpou4tpxnioctas s rmnmsnt4 eenir3tatfm r u ilt0setmim3nu4al nlfesa(fs2ta(r no4tee mfciat mDrlumon()tltniociytopteaieo () etmxm iu1olt lnetltfaDra(rp;t0tleo fctadlmDran p u0 rtrxr3oa1lp  livi;s0srumxr3ou1alt mivtltfsrua(  nt0tpxnioeiys mDeanmo t) ltrir3oo1fp e uvsl()t2um(m3nu4lm   ies (f Drr(r nt1tpenmo3iatfs eauvpn() eeomrctadfm r i olt)sruo(r3io1al n fesl( sDrmxmono1olxoio3tltla2emums;t0tltnmr3iy1la rln ils0seurxrpnydapeemnet (f Dtaurp;o0alxoio3iydfsDuau p (0arxomr3oydlptranvolt0sexoxr no4lmt mictltfsDur(rpnt4tet ioetyt a2ul( p t0 lxnxrctodlaDelnei;() eurxm iu4optn ieslt s2ur(mo;t1olt mociys aDrau s;t) lxoif3io1fpteau i;t  2to(m nodomee fvia(f Durumpnu4aleo o3iadlsDuan pnu) exoxo3oytop elneils s2urir iu4lltnlivtlt) Dtr(m ;u0tpe if3ilslm umu o t4 exoir iadlaDrlu s t  2um(m nudameelfvtl(  2uaxmonu4tee  ocilslm2em(vp;u) ltomrcio1lm rlieo s0 ruo(opnydllt mics s)sDumx pnu0tlt mo3iasfaDelnvs;(0artoxrciydlpte ivils srxoir iudlpe lfci sf Dta(ront1tex ifciad m ea( p t)arxnxr ia1la   ivi;t)tetrirpoy1aptelfcta(f ruru p;o0aeeomfeiytfs eanvs;(0arenir ty1lmDeanei t)teumxm3ny1ll emieil() 2rr(r oo4tpt  f3tlslsDua(msnt)tltrmo io1faD aiei;t  euoimpoo4ape lics t) 2rm(r no1opxoiietytla ua( sn(0trtnxo3iytlmt  i i;s setoimpoo4lptn icsat a2tmurp;o0oltomiciytfmDrmn s (0tetnirciadlm eau o s t2uoio oo1lme  nctl(fsrtrx ono4tpt miciydlm umuvs;t0treoir iy1omte ies;(0truoir iy4lm elnctls) 2tmxmpnu4aleomo3iatfsDrm( s t) eenio3tytlaD anes;t) exm(opiudlp nlivsa(  Draxrp;o1tltn fcils m2umuvo t0arxnmr iadoa   nvi;(0t2um(o oo1aptnlivs ( sDua( o;t0apxn ociadfaDum(msnt0texoxf3iytfmt  nvs;t0 rtoir3iu1apt mictlsfaDra( poo0aee  ocildfaDrlu pnt4 rtnxfcoodfpD lneil(0trxrxr3io1al  mfeta( aDrmx  ;u4tltn o3ias a2rm(mp;(4 rtoxo3iotom  ai s;s texoiopno1ope mfesl(farumxro;t0alxnmoctlsfsDuaump;(4 rxrio3oy1fateluesl(0t2urir3no1op nmncils) ruauro;t4aeenmf3iat mDul(msnt0alxrmf3ootoaDe i i;t)s2uoxo no4opeelicsas)sDrr( poo1aptn fciytlaDuluvs (0aetrmoctodoptr ieols  eum(rpoo1op nlnvi t)s2uaxmp;t0oexomieiyd aDemump;() rxrmociatlpDelneilt) 2uo(mpiudoltnlivt ( arrau  ;u0aexn fciysfa ea(ms;t) lermr3oy1lp   ueol( t2umxopnudamee icslt s2um( o;o1aexo ietytfm umu o u4 etnxrciy1opte uvs;t)setm(m nodll emnes t sDtmurpno0alxomi3iys s2rl(vsnu4teeomo3tytoptr iei;(0t2xr(o3iu4apt  icsat sDtrurpou1alx mfetyd m rmuvo t)teermrciodlmDe nvol(0t2urxm3oodlme  nvta()arrrx p;u4oleomietyd a rmnvont) rxrif todomtelnes;()sruoxr nydape  feil(fsDua(r ;t4oeeoiieiytfs elums;t)alxoxo3iodfpDr ivi;t0 2xr(r3io1ame lfvsa()arurur ;u1apxo fctasfaDrlumsnu0texnif3oatlm r ieilt)t2umxrpoo1ope lncia( srum(rp;t1tle mf3ildla2umuvpn(0aetnifcoo1fm e u slt  2urim oydlmenlnvtat)arur(m ou4oee ii3tltfm2ra(vo t0trtnif iydfaDrliei;t srxoimpiudll  lncs t)sDurx pnu4apx mo3iltlsDrluvo t4texrmr3totfptelnvi;t0 exmxm3nydape lfvsls)artaxmoot1aee  f3tldls2eauvont0arxrxr tydfmD livo s  exoxo oo1ol e fcsas arurxmpnt1tleoioeiad aDrl(mp u0 renmoctytom r i s;s0seuoxr ou1om  lnvias  2umurpno4opt  ociatfa2umnmsnt) ltnifcta1faDe neo t  eto(opio1al nmfes ( srrrxront0oex mfciadfs ranvpnu0teeoirciydomD  uvo (0s2tm(r3iudamtnmivs (fsrrr(rp;u4tpt moeiytfmDuau s u)altnxfctatfmDr n sl( trxoim3nydaptemnesl(fsDrmu  oo1tetomfeilsls2ranmpnt4texrio3to1lm   n ols) rtm(r3iu4apt mfei (fsrtr(r ;u0opxniietytlm eln pnu4tetnifciotfptelueo t)teto(r ou1ll   fvsas)aruaur ;o0aex ifeiytla rln p u)arxomf3oy1fat  nvsls)srtoir3oodllt  nei (f 2um( o;t0tptnif3ild s2ulu pn(0areniocto1fp  ai s;()texoxr3oo4llee iei (fsrtaxm nt4aleo ictytfaDrl(msnt4aeermr oydom  lueo t)t2uo(m iydlme mieias  2trxr ou4apeomictldfa rm(vs;()tlxoif ia1fa  anvo;t sruoimpiodlpenmieiat  rrrurpno1ale mfeild s2elnvsnu4 exomrcoatlpt ln o s trumirpoodame lncil()srtrur ;o1tle io3tat m2ul( o (4 ltnir oadlateai s;( setm(m iu1am   fciatf rtmxmp;o0apxn o3iad a umu p t4 lerxo oadoaD livo;t)trtmio oy4lpte ncsas) Dum(r nu1oee  ictydla2uanmp t)aexoir ootlmtraies;s  2toxr3oy4lpenmfvias)sDra( pno0apxnifeiys m elums;t) exrio to1la  liei (0setrxmpou4alt lfeiat artr( oot0tee io3iltla2elnvo ()alxniociy1fm elnes s  2umimpoy4am  lieias)aDurx  oo4tltnmfetadls2em(mon(0tleoxo3todopD  uvi;(0trumxr3iu1om e feiasfs2ta(  ou1tet mf3tldlsDrluvsnt4aexniociytom eau o () 2uo(r oy1lleelfes ( aDtrxrpnu1tltnmietydls2em(ms () etoxrcto1op rauvo ()setrio3oudop n nciatf rumx p;o4openifcildls ul(vp t0tlxrmr oodlateai o s srurxrpiudlmtn feta(fsrumxmp;o0tptoioetaslm rmu o u0trtnxo3oo1opt auvs;t0texrim oo1lp  lfvi ()sDtr(  ;o1tet iiciatfmDea(vo (0 rxnir iotlp  li ols)s2tr(mpiy1lm elictltfsDtr(r ou4aetomociydla2rl( o u)tltrxo tadlaDraivi ( trtoxo3nu4lmenmfvi sfsDumxro;u1ape mo3iltfa eanmsnu0treoxr3oadfa e uvs t0trurxr oy1ope miesa() 2ta(r ;u1olxniictatfm2uaumo (0aexoxr3oa1oa elues;( trurxo ny1olt lfetat  rtm(mono1oet  feiadfsDrluvon()alermfcto1lm r ies;()seum(o3io1amt lici ( s2tmxr oo4altomoetat sDulu s t)altrmo3oa1la e u o;t)t2xoio3iu1omt  ici sf 2trumonu0aetn feild aDea(vpn(4trerxo iodlp elues;(0 rum(opiudaptemfeiat s2raxmpno4aet  octasla rln p;u0 rtoiociadoa rlieo;s t2xmir iy4amen icta( a2ua(mp;t4oltoifetysfm emnvp (4aexrxrcoy1lmD ln ol(0texoio3oodaptnmnctls  2ur(r ;t1aee ifeiys a umumonu4aeenmociydlmtraies;s0trurimpiy4ome lnci (fsrta( poo0tlen o3tadlm rmump;u) eenxf io1lpD li s s)s2toxr oo4ap   fvil(fa2ta(moou1ope  icild a2ulnvon(0texrxr3oatla  lieils) exmiopny1lp e neias) Dum(  nu0tlx iieiltlm2uan snt0tlxnir3oy1fat anei t0texmxm ny4lmeemieiltfa2ua(mooo1aee ii3tasfsDrmuvo ()arxrif oodomD aueols)teuo(m oy1aptn fcias aDtr( pno4tlt moeiyt a2rmuvpnt0alxomrcty1fpteanei;t)seurxr oy4lm emietas)s2ur(mo;o0oexnmieiytla um(mp (0tltnxr iadomDelnvol(0texrim oo4lpeelneslt arum( o;t4oltn iciatlsDua( s ()arxrif3iatom ranvo;( srtoio iy1lmee nvia(f 2rruro;t4aee ii3taslm2rlums;u4 ltomo3oodomDeluvilt0 rto(rpiodlleemnvtas  Dra( ont4tltoii3iaslaDul( ont4altomr3iatfat li i;t s2xr(opny1apen neil()aDur(roou1openioeiysls2rau snu)areoxo3oo1fmDr uvo t0srtr(rpoy4lptelfvtlt)sDrr( onu0olxomoeilslaDem( o t4aeenmf3iatfp  aues;s0s2xr(r iodllenlivi tfartau pnu4altnmi3tltlmDuluvp;u0altrifcoodfm  anvol() ruoiopiu4aptnmnetl(fa2ur(rpno0oleoiicias s2rau o;()aetoif3totfa  aneo (0 2tm(r3io4openmfetasfa2tax pnt4tet  ietadlmDumnmo u4altnmf3todoa ranei t t2umxopoy4omtnmivi t)a2rr( poo0apx ii3iat m emn p;u0 ltrifcto1lpD  neo (0trtoio3oy4omeemfesat sDurx pnu4aeeo f3ilsfa2ranms;t0trtnxocia1oateluvs;(0 ruoxopny4op e fvtat)a2rrur nt1altn feiys m2ua(mo t0trxnxo3iodopDe uvs t srtr(opno1omt licsa() Dua(rp;t0olt iictldlaDelu s;(4aexnmr oy1lpD li s;(0 exmxm3ou4am nliesl(  2rr(rp;u1apt ii3iytlm2uan o;u0treomf3ia1oaDr uvo s) rtmio3nydlme  fet s a2rax  no0texnifciytfs2rluvs;u0alenxo oytopDrli i (0 rtoxmpoo4oltnmncsa(f 2rmxmpou0apto i3tasfsDeanvs (4teermrctodomteluesl( srtm(opnydoleemicias)srta(mpnu4oet  i3tyt sDrmnms u0alxnmr iatfpt  ueil() exrio3oy4ap emicsl(faDrmumpot0aet iieiat mDua( ont) rtnirctatopt lu ols0 rtoxr iy4ope  ieta()aDtau  oo4tee io3iytfm2rmu o;(0trxnmr oodopt aiesl(0s2trxopoudopen ieslt a2tr(r no0tpxomi3iytla2emnmonu4arxomf ty1fmDe nvolt  2ur(o3iudapt mictl() Duaxmpoo1aex mietatlm2ulnms;u0arenxrcty1lm   ieo;(  2trimpiu1opte fet sf rta(  ;o4oeenmfciat aDea(mp t)trtoxf3oy1omDrauvi t)srtm(o3iodom elict s)a2rrum ;t4openmo3iyd mDum(mont) lxoir3ia1lptraivsl( t2xmimpoo4aptemnet s aDta( oou1opeo ociys s2ra(vp u0tlxnif3oatoat luei s t2uo(r3oo1op   nci (f rua(ro;o1opt mfeiyt aDranvs;u4 eenxo3tadlat lnvo;s s2tmxmpoy4lpenmiesas) 2raur oo0tptnmi3ildfa2ulums t0arerio3ootomDeaivsls)texmirpnu1lleemnvilt) rrm(mooo0tet  fctaslm uanmon(4alxomr3oa1lpDraueilt setrimpiodlmeelnctl()a2tmxr oo1oetoiocild sDea(vont)tlermo oytom   ivo s)texmxm iudom  lieia()arrrxront0olxnmfctyt s rm( p (0trerxf iatfa eln s;()teto(mpiy1lmeemivta()srtmx  ;o1tpe  iciyd a2ea( pnt)arerxocoy1opD  ieilt trtmxo nodomtnlivil(f rumxm ;t0oeeoioeiadfm ra( p;t4 rxomr3tytlpD auvilt0 eurxo3ou4olen nesas  Dur(mont1tetnmfcilt m rl( p;t0teerxf3iodlpte n i;t)seumir iudaptelfct t sDua( o;o0tlxoioetas mDra(ms;u4 eermr3oydlmDrai s;( srxm(mpou1lpe liesltfsrua(  nt1tlx  fctydfmDranmsn() rxnxf oatoate ivo (0srtmxm3ny4apt mnesl( sDraxmooo0apx  o3iasla2rmuvs () ltrxociydlp rlivs;s seuoxr nodom elnvsltfarrrxro;o0oetnmoeils a2ulu p;t0 lxoircta1laD lnvs;(0setmxr nodam   fei s sDuaxm no4alxo f3iad a2rlnmp ()arerxociodomtelivi;s)seurxr no1altelfctasfs2um(mo;t4tex  ietltfs2rau s;() lxnmocio1opDrau slt0 2xo(r ny1alt mfetas  rrm(  ;o4olxoii3iys m el(mp;(0texnmf tydlpDr uvo;t0trxm(r3ou1ole lfei ()s2rr(mpoo0tetoii3tls mDemu pn(4aexnif3oa1lpt  ueo t0t2xo(r nu4openlictls a2rr(mo;u1texnmf3tadfs rmnmp;(4trenifcty1lp ranvo ()teurir ny1amt mnvt t)a2rm( pot4tlxoiieiadls2rmn p (0treomo oa1optelnvi;t)t2xmxr oo1lpte iet ( s2tmx  ;u4aleo iciadfa2emn o ()tetnio iy1fm raues;(0sexoim no4opte nci t)aDrmump;t4altnioeiys mDelu o;(0texnif3ty1fmDeaieo ()teuoirpny4openlictl() 2rmxmp;t4alen o3ilsfmDrl(vonu0tlxoircoytfaDrai o;(0s2xoxo3no1lpt  ncil(f rra(  oo4tetomi3iad sDul(vpnt0artrmfciadfm r uvo;s  rxmxr3no1ame mnesls)sDtrx p;o1apx iieiydfm2ra(vsn(0treomrcootoa r nei ()s2tr(mpno4aleelfvsl( aDuru p;o1aetn f3ild m2raump ()altomfcoytfp   n slt0 eurxr iy1ap elnvsas)sDrm(mpno1aet  fciadlm ulumsnt0areomociotfaDeaivs t  eurxr3nudom nlnvs (fartmump;u1tpe miciad s rluvs;t)tlerio3oa1fpt  uei;()sruoio3ou4lptelnei s) rrmx pot1tlen f3tlsfm2ua( s;t4altnio tadlpD  uvil(0srumiopnudamen ietlsfarrm( o;o0aexo ieiasfs2uaump;t4texnio tydfa  anesl(0teur(m3ny1lleemncs t aDrrxroou4olx iociysfa2umu o u0arenmrcoydfmDeanei;s0sexrxmpio4om  mfvslt)srraxm ou4alt ioetlsfm2ua( on(4aetomo tatoate n i ()tetm(o3iodll   ieia(fs2taxroot1altnmoctyd a2em(vs;(0artnmf totlm rli i;t0srurir ou1ope lncilt) Dum(rono0ope iietlsfaDulnvp;u)altrifciytlatr n o;()s2toxopou1omtnmnet (f rurxr ot0ope  oeiyt s2eauvs;u0trenir ia1fm   i sl()t2xmxr iu1opt  ieiat)s2rau p;t1aeenmi3ild a2emumo t4aexoxfciytlmD auvo s setm(opnydll nlfeia(fs2tau  nt4aee moeildfa ul( s t0 etnmocto1oaDeluvo t)srtmio nu1lp nmncias)sDumump;u4aetoiieilsla2ua( snt4 etrxr totopte nes t0setm(o nudlp nlneils s2rmxrp;u4tpe  ieiyt mDuaumsnu)arxoxf iatlpDeau ilt0tetm(o oydap e ivi tf Drrxrp;u4oexnmicias m2emu s;u4altoxf iodfmDeaies (  exmiopoo1aptn ivsltfs2truro;o4altoiieiydlm2ulumo;()alxrxo3to1lptrluei s tetmxopno1ape mfvtl(f 2taxm ;u1alxnio3ilsls2ea(vs ()tleoioctydfat anei s texmxr no1lpenlncs ()a2uaxrpnu1tltniicildfmDeaumo (0tleoifcoytfmte neil(0teuo(r3iudolenliei t s2ta(rpnu4aetnmfetlt a2ua( p;t)arerxr3oatoa r n o s t2xrxrpiydlmt mies (farumum ;u1oleniiciltfs emn s;()tlxomr tytlm raiei ()sexmimpnu1lm nlics (  rua( pot1tpt  feild aDumn o;u0arxrif ootoptrauesl( sruoimpoy4altn nctls)arraxroot1aet ifetydlm2uan p;u4arxoxr tytomtr i s;s0seuoir oo4am elietas) rumurp;t0opeo ociydla2emnmp;t)tltnio3ia1op eluvi (0 2xo(r3iodlmte feiat  Drr( pot0oex mf3iaslaDrau snt) eeomo totoaDraivo t) 2ur(opiy1op  lncilsfarur( p;o4optnmictydfm ra(vsnu0 lxoircoatlmt  i o ()srxmio ou1ol nlietl()s2um(rp;t1oltomfciydfmDrl(msnt4texrifcoodlaDrlieil()srxrxmpiy4alt  ncils aDur(m nu1ope ioctldls2rm(vp;t)alenxr ia1opDe neol()srtr(r3oy4lm emiet t)artaumo;o0teenmiciyslmDul( snt0trtnmo oy1lpte n ols  2umir oudomt lfcsatf 2taxmo;o1tetoifeiydfa umu p t) lerxo io1fpDe nes;(  rumxm nodlpeelnet sf Dtaxm ;t4alt ifeiatlsDean o;(0aeeoxo3iytfm r neo;()s2tmxr3no4ope livia( artau o;t4ole mfctydlmDuanmp;()treoxrcoydfatelieo ()t2to(o io4opt micia(fs2tr(mo;o0tex  oetys sDrmu p;(0 reomo ia1fat  n ol(0 rxoxm3no1lme lfeiltfsrtrxrpno1teeoifciysfm elnmo t)aeerxf3oatlp  anei;s0srurxm iu4ale  ict ( s2urxm no4opx micildla2rauvs;t) rtnio iotfmDrln s;t) rumxrpnodap e neta(  2rmu  oo0oltoif3tatfmDulumpn(4aeeriociodopt ln o ()sexoir3no1apt liesa( artmxm ot1tle iieiysls2rau pnu)texoif3tadoptelnvi;s)srtr(opnu1opeelnciat  rum(mono4apxnmo3iyd s2ua(vo;t4alxnircty1lpDr i i s)s2xmxrpiy1ap  miei s) 2tm( poo4tpxniiciasla2ranvsnt0alxoxo oytfmtelieo ()texrxm iydome livsl(faDur(mpnt1olxnmoeild m rmnvont4 etrxrctadlaDe i i t0srurim3iydam n iei ( artax pnt4optn o3tytfa2uau s (4artnmrcootoaDe i ol(0s2um(m ou4lmtemivi s s2umurpou1tpeo o3iatla rauvsnu0 rtrmfcoydomteln il( sexrirpno1ale  nvt sf 2urx  ;o4aexo oeiadla2rl(ms;(4tetrxrcto1fpDr ueil()teurir3iydameelnviatf rtrxr nt1tpe iociyt a2rmumo t0 rtrir ootfmDrluei s setoxm io1ap n nvsl(  Duru  nt1tleomo3iyd s2umnms t)aexnmr oa1fm rau olt)t2xoio oodapte icsas) Dumx p;o4tpe  ociyd mDrlumsnt0teenif iodlaDelueols0s2tmir3io1op nmfcsa( s2urx pno1oleo iciadla2emnmon(4 eenir oodfaDeauvsls)trtr(o nu4am  lfct () 2tmxm ot0opt mictydlaDem(mp;t0 rtomf tytla rluvo;s) eur(rpio1olee icslt)srtr(rooo0aeto ieiltla2elums t) lxoxr oo1opt au s;t0s2xrxo3oodll e ietas) Dtaxm ;t4olen ieiad a emu s t)tlenxocoa1fmDrli i;( sexoxmpiy1open feslsf Drm(mooo4aexn ociyt a ra(ms;t0aleoxrciotfm r n ols) exrxmpoudlptelnvsl()srrmurpnu4oet moeiasls2rmuvsn(0aetoxocty1fmD aivi ()tetmim3ou4opt lfvsls a2tmur ou1altoii3ilt aDulnvo;t0aexrifciotfa rlnvolt  ruoir3oo4lp  mfvil() ruru p;o4apt  ociys a2rmnms;u0 etrif3oadfm elnvols)sruoxr3oodopeelfct (faDtrx ooo1aexn icilsfm umumo;u4 ltnxr3ty1fpDr u s;s srtrimpoo1aleemnetlt) 2ua(mpnu1aeeo feiasls2elums;() eenio3tydlpDr i i () 2uoxm3oo1open fcsat  rurxr ot1alxnii3iltla2uln s;t) lxnxo3iatfmtelnes ( s2xmim no4lme mfcs ( a2ta(rono4alt  f3iatfa rlnvp t4 eenir3iatop   u i ( trurxr3ny4ap  mfvslt)s2tru pnu0alxo ociysfs ranmonu4 lxriocio1oate n o;s)truoxm iu1lpe mietls)arumu oou0oexnmiciasfs2elnvo t0tlxomf3iytfm r u o t0s2toxm nu1al  lnct sfsDtm(mo;o4altomiciltfmDemumo;t4altnif3to1lm r u ils)t2trir io1lp  lnvia() Dtmxm ;t0tex  o3iysfaDemnmont0 rtrif todomtr uvolt texrim no1alenmicslt aDtm( onu1tptomoeiyt m2elu s (4tetnmr oatoat aivsls0sexrxrpoodol nmivil()s2ra(m nu1opxomiciatfa uluvo (0tetnio iy1lmDr ivi;t0 rxrir3oy4alt lncsat)a2umum oo0olxn i3iasfm2emu p;u)trerir3oadom eanvi;t0s2xr(m3io4aptnlnesl( srrm(roou1ape  o3iyslaDul( snt) lxoif3iytla e u ol( s2um(opno1am nlivs s)sDum( p;t1alx mf3tat mDumuvont)tleoxo ia1lpDrlivs;t0srtm(o3nu1omt  nei sfarrmumpot0opxn ictatfs2raumo ()alxnxoctatfatean o;s) 2xrimpnu1ole mnvt ( aDrmu o;t4texomo3iysfsDua( p (4artnxf iodlm  an slt  2xrio3iudale  fvs s arrr( poo1oee  feiasfm2uanms (4tlxrxf3ia1omtrlivo;()t2urxmpny4opee fetasfa2tmur oo1tlt ioeilslaDra(vp (4tltnmo ootlatrluei s  2xmxr oydapt mnesa(  2tmumont1aleomoeiatlmDemn s;t0tlxomf3oatfaDelivsl() rtmxopoy4am n nei sfaDtrx pno1apx mociaslm rmnvo t4 rtrxociadopt  ieslt) exmir3ou1lpe mfct sfsruaumont1olt moetasla uanms () renio3iadopDrauei (0 rxo(o oy4omtelfcsas arrrx ont1tpt iietydlsDel( p;t4aleomo iatlaDeaueo t srtm(m3oy4am emnvs (fa2trxmp;t1tlx  fctyslaDulu s u0 eenmf3io1lateaiei;() rur(o no1aptnmfcsatf Dua(  ;o4oeeoifciytfm ua(mpnt)tetoxf3io1oaDeaivo;( seuo(rpny1alt  fetls aDrr(mp;o1alt mieiltfs2umuvs (4tlenmfctotla rlies (0 euoimpno4op emiet (f Dtm(ront4ale  fciyt mDua(vs;(0 eenmrcta1latelies (  2triopou1lleelnvs ( arrax pnu0alxoiociatfm em(vsnu4aexrmf3to1oateauvo;( sruo(o3oy1lp nlncia( sDrm(moot4oee  oetytfsDrlnvo;(0teerxf oo1fmD an ils)t2xm(m3nu4om e ncilt a2ua(mpoo4ope  fctasla2emnvp;t4tleoif oytfmte ueo;t  ruoxo3iydlltelfct (  2ta(mp;t4opt ifciydfm2ean s;u0 rermfciodlaD aivs t) eur(mpno1lptelivt t sDrmxmono1tpxnmiciysfa rlumsnu)alermrciatom  au s s0 2tmxmpnu4oltnlfci sf rrm( p;t1tle iieiatfa ea(ms u4 renioctadfp eau s s0teumir oydlme  fviat) Dumxronu0tpeniictys m elump;t0tlxrif3oadlmt aivi;s0trtr(m no4lleemict s  Drru  nu1olxo octls m el(mont0teeoio iydlm rlneol( s2toio nu4alenmfcsls)a2raxroot0opt  o3iysfmDea(mo;u)tlxoircio1fateaueo;t0 2trir3ou4ale  ivs (  2trurpnt0apx  ieildfa el(vsnt)trtrmo3oodfmt  u i (0trxrxr oo1am n nvtlt)aDumu pou0alt ifeiltlm uau s;u) reoxf3iodla  aueo;(0srtrxm3nu4olee fcs (  2raxrooo4ale io3ilslm rmu o;t) lxnmr3todfmtrauvi s  2xoio3nu1optnmivia()artr(mpoo0aptn fcild m rlnms () lxrmr tydlptelivi ()srxmxopoudlmte fcs sfaDuax  ot0oexoio3iasla rl(vo t4teeoir3iy1optranvo;s0teumimpoodameemfvi ()arra(rp;t0oetniieiadlmDea(vpnu)alerio3ty1opD  i i;s) rxoirpoy1om e nvsl()s2ra(rp;u0teto ieiasls ra(vont0teenmfcoadlmte nei;(0sruoim3no4om n fct ( aDtrxrpot1apxoio3iysls um(mon() ltnxrciytoa eluei;s  2trxr3io4apt mictasf rrr( poo1alto f3iadfm umuvo;t4alenxfcoodfpD livs;() etrxr3oo4ol nmies tfaDuau pot1oex  ietls sDuanvpnt)tlenxr3tytlm rlnvslt) 2toxr iydol   ivsl(  2rau  nt0aleniietltfs2ea( pn(0artrxr oy1omDrauvs s)t2xmir no1op  lfeiat  Dumurooo1apxnifcias a rl( p ()aexoif tadop raiei;t0texoxrpny1oltnmnvsatfsruau  ;t4ale ifciyslmDea( p;(0alenxociydfaDeaues;s0 exm(rpoudlm elivtlsf 2raum ot0opxn feils s2um(vpn()alxnmr3tadoatraieils0t2toxr nudam  mnci s aDum(m ;t1alx mo3iasfsDel( o u4 exnxr iydlpDe u sls0srtrio ny4ome lici ( artr(mo;o4alxnmi3tydfm2uau s;t)tltnirctydlp elnes;s0 etrir3ny4ale lfesls arra(rpot4oexn f3ils m uauvo (4aexrxo iodoaDeanvs () 2um(o3iu4lmeelfcs sfaDtr(mpnt1apxnmf3iadfm rauvpnu0trtnir3oydoa   i i;t) 2umxmpiy1om e fvta()aDtm( p;t4tet  feilslm2ulnmo;t4altoio3oydlatelu sls  2urimpoy4lp  mneil() 2tr(  ;t0tle iociyslmDemnmo ()artnmf3tatlmte i il( t2toxm nu4omeelnvilsfsDum(mono0teeo i3ilt a2elumo t4aetnmrciy1oateluvs (  exoxr oo1altemicsa(fa2tru p;u1oltomoetls m elu s;u4texoir totlp rlnei;(0 rtr(m ny1lltn ivsatf Dtmur oo1tleomfeiad aDem( o;()altnxo3ty1oa r u olt0srtrxm3nudalt  ncias arua(  nt4olxo f3tltfaDranvo;t4alerir3oodfpDe ivs;()t2xrio ny4lle lncs (f Duau o;u1opx miciat sDumn snt)aexnxf3todlpD  u il() rtm(opoy4op emieil() 2tmxr nu0altoiociatlm rl(mo;u) leoxocoatfateaueo;() rum(m3nudal   fvtl(  2tr(m nu4tltnmfeiltfm2emu o;t4trtoir ta1oatr neilt0t2xo(m oodol elnet ( arurxr oo0optomociysfaDumn o t) leoxf3tatlateau ol(  2xoxr3ou4lpee neiasfaDtm(  nu0aptomietldla2rlu p t4 etnifciotlm eanvs t0t2xmir iy1lm  licslt) 2umur no4oexo oeiadfaDeanmo;u)trerxoctotfmt auvolt0t2ur(mpoy1om e fes tfaDtau o;t1texo ociat aDuanmo u4 lerxf io1fmDelnvsls t2uoxopoudol nlnviltf rumxr ;t0aeenmocilslm2el(mp u4artomr io1la e i s (0t2trxr3nu1lle mfciasf rrau p;u1altomi3iyt a rmu p;u4 ltnirciy1lateaieslt0 2xm(opiu4ap emfeil(f rtm(mooo1alen oetysfm rln onu4 reoxr to1laD luvolt  2xoir3oo4aleelieil( sDrm(rpoo4aex  o3iaslsDulnmp;t0arxnxo oytlpte ivo;t) etoir iy1op n ivtl()artrxr ;o1aexoio3iyd m2rmnms;(4 ltrmf3iadfaDeluvs t)s2trim ny4ol emncsatfarum(  no0aetn o3iltfa ua( o;t0tetoxf3ootlmDeluvo;s0seumxm3oydlleemnesat  2uaxrp;o0oex  i3tytlaDranmpn()aetnmf3oatlp elivs s0 rxrxrpno1lmtelivsl(faDur( ont1oexo fetltlmDraums;u) leoxf3iydlpDelnei t)trxoim3ou4omenliciat aDrr(r ;t1olenmiciat mDuln pnu0altnxo3iatfmDr n i t)sexmio iy4aptnlieilsfa2rr(ront4apx  octld m uluvsn(4trxomo iodfp eluvs;s0s2trxo no1lptelfesl(fa2ur(rp;u1teto iciat a2elnvo;u0arxomf todlmt  nvo;s0seurxo ny1apte icsat)aruaxmo;u1aetomfciasla ea(vsnu0 rxrxr ia1faDrai s s0 exoxo nodameemfetltf 2um(mp;o0teeomietysfs2ra(vo u0altrir io1omDe nvi;t)setmxopno4omte nei tf 2rm( oot0opxoioctatlm ul( p u)arxnmo tytfaD anes t  rxm(m3nudlmte iciltfaDtmuront0oet  o3iyt s2umnvp t4 etoxf3ta1oaDraieols) eumxopny4lp nmnviasfsrua( ono1tlx moetldfmDrlump u4aeeomo oo1lmt  u s (0 2xmxopiydal emfei (fa2ur(mpou0tleomi3tytlmDrluvont)trermrcto1fptr ueo t0texrimpnu4op   icil(faDum(rpoo4aetomieiydls ean s;()aeermo iodomD  ies ( t2uo(rpoo1op n fcia(  rrrxmpou1oeenii3tasfs2ul(mo t)alxomo oa1opt aivol() rto(m3iy4apee fvs ()a2umur no1olt  f3tadla2elnmont)aexrmrcoa1lm  lnes;s trxoim iu4aleemici tf Dtr(mpou1openif3tldlaDul( o;t) eerxr to1fa eaieol( t2tm(o3nu4ol nlfcsa() rrrxrpou0altoif3tlsfa2rlumpn()teerxrctydop rau il() rtmirpnodal n fviatfaDumurp;t4ape ii3ildfa ulu pnu)tlxomf3oadfa eaneo;( texoxo3oy1olee ietat)sDrrurpnu1ole ifciat m em( p u4tltrmocia1op r ueo s0srxoxm3nu1lm  mivs sfa2rax pnt0tptoif3iyslaDum( o;(0tetrircio1lmDrluvi ()s2tr(m3nydam nlnci ( artr(rpnt0tlxo fciltls2um( sn(0tlxnirciy1oaD ln ol(0sexmxm iodopee ictat)s2um(r oo0oetoiieildlm2rmnvont0 rtoiocoytlaDrlues;s s2xrir3ny1apt  netas) Dur( pnt4aex  fetysfs2rluvsnt)tltrir3oo1lp e uvi;()srto(opiodlleemfvi s  2um(mp;o4olen feiys aDrlnmo;(0artoxr3iydop ran s;s0 rtrim3iy1lmt  feilsf Dua(  ;t0alen f3tldls rau snu4trerio io1omt an i ()trxmxo3nu1ape micta()a2tmu oou1oltomoeiltlaDeln pn()trxnif oy1op eai o;s0t2trxrpoydomtnmfei tf Drmxrp;o0opx ifeilsla2rmnvo ()arxrir ta1omt lnei;(0 eto(r3ny1oltnlnet s)srrmxmpnu1tptnifctatla em(msnt)trxrmrcootla e ivi;(0texr(mpou1ame mfctls)sruaxr oo4altn f3ildfa el( onu4 rtrxrctydoaDe ivilt0 rtoio iu4optnlfvsa()s2tmxrpnt4tlenmfeiytlm ulums (4 rxoxrcia1om ranes;t0tetoxr3io1aleemneiat a2tr(mont0aetoii3tltls2elnmont4tlxrxf3oa1latrlnvol(0srxrxo3iy4apt liet s  Drrxroot1alt mfctasfa ul(vp;u0texnmr3oadomDelneil( tetm(mpiydaptnlfci ( s2tmxmpnt0olxomo3iaslsDra(vp ()altnxr totlpD li ilt0 2to(mpio4lp emicta( a2raxrp;t4aexnio3tld aDuanmsnt) exnmocoydlmtrlies (0 rxm(o3nu4olee ncslsf rrm(m no1aet mo3iatlmDuanvsnt0 ltnmr tadfm ran ol()s2trxm3iodllen icsat)srurumo;o4aeeoii3ilsfa rln o u) rtnmo3tatopt  ies (  rumxr oydal n ncsas) rta(mooo4oleo feiysfsDeanvo (0tetnmfctotlm elu sl()s2xoxo3no4llt  ieia(fartrurpoo0tpx mi3iysfaDel(vo u) etrir3iodomDr uvslt0teuo(o ny4ap elfetl(fs2umu  nt1apeo oetadfsDeanmp;t)artnxrcoy1fmt aneo t)teumxo3oy1altnmfcsl( sDuaxroot1oee  fcilsfa2rluvpnt) lxnifcta1fat lnvs;t0sruoxo nudalte fciat)arumu o;t4tpen icilslmDuau s;u4trxomo3todfate n o s trxrxopoy4omtnmfcsa(  rumumpou0tpeoioeiydls2emnvon(0aetrxo3iydfpDr n i;t)trxo(rpno4ameelictls)s2rr(  ;o0oeeoifeiaslsDrm(mon(4 lxoxf ootla rln i s  exmiopio4oltnmici s  2raur oo1tpen fctlsfm rm(ms t) renmr tadlmt  i o;s0 2trirpiodap e ncs (f Duaurpnu4texnmo3iyt sDean ont)trtomfcoydfp elu o ( srum(r3iydlmt lictlt)srtmx  nt0apenmoetlsfaDua( s;() renmoctatlpDrauvs ( trxm(r3iu4omt lfviat) Draurpou4texn feiadfmDean p;t4trxrmr3tadfa rlu o;t) rtoxo io4am nlnct sfaDta(rooo1opxomfeilsfs rlump u4aeermr3tytfatrlnvi;t s2xrxm no1omee ivtas)srtm(mono4aexoiocias sDrln onu4altomfcoa1op  aiei;s0 eur(mpnydll emnvtasfsrtrx oot0oeenio3iadla2ra(vo u4trxoir oadla raneilt) 2xoir3oudamtelfesa(faDrmx poo1teen o3iadlm2ulu o u4altrxr tadlpDelieilt t2tmxo3oo4omtemfcils)s2taumpno4ole mi3tytlm uanvs;t)arxoirciotfatrauesl( trtrxo3nu1olt  nvsat)a2tm(moot4ope  oetlslm2uanmp t4 lxrxfcoo1fmtean ol()s2tmxopoydlptemneiasf Drrur ot1oexo o3iltlaDrl(msn()texnio ta1faDrln i t  2uoiopoudolt mictatf 2ua( o;o0opxn ieiydfsDumnvo u) exnxoctytfaDrlu ol()truoiopoy1apt  nvslt a2um(ronu4teen iciadls2ul(vp;()altnxo3tytlmt aueil( sruoxopiu4omee ivtl()srra(root4aleniietlsfs2ranvpnu)tetrxrcoadfp  li s;( setm(m3io1ol  mfvtltfsDrmuront4optomicias a rl(mpnt)aeeoio3totfmD ai i;s  exmio3iy4lpt lfeia(  rta( pnt1aexnmo3iadlm umuvo;()altnmrciy1latelieol()tetoxmpou4ll  livi sfs2rmum nt4altomo3ilsls2ean p;u)alerir iytom  au i;(0texriopnodape mneil(  2rrx poo0tltoio3iasfmDrmums u0tlxoio oatoatr ues;(0t2tmiopnodal nlfeia()sDrm(rono0tpxnmo3ildlsDel(mo (4aetnio3oo1omtr iei;t0 etoiopnu4lmtelivs (f rrrx  no1alxniictasfmDea(vp;u4alenmr ty1fp rau olt) rumxmpnudop  licils aDtrx  ;t4opxn ieils a uluvsnt0 exnxf3tadfmDrlnesl(0seurxo3iy1op n fct s)sDrr(roou4aeeomoetld aDel(vp;u0arxrmo3iy1om eai olt  etrirpoodlle mfvsat  rra(r oo1tpx mo3iadla umnvs;t0 rtnxrcoo1omtr ivslt seuo(m iy4oltnlieilt)artr(  ;t0aeen octadfmDua(ms (0trtnxo3tadoptr n i s)setoxrpoodoltn fei (f rur(r ou0opxoiieiad m2rln o (0tlxnif3iotfp rauvi t  exoio3iydomt micsl( a2tax  ;o4ale ioeiydls2em(von(4 leomfcto1fpDe u o;( srto(o iodape lncia(fsrra(ro;u1tetn i3tat s2rmu s;(0 renxf iatoaDrlueo;( srxrio3iodaptn nvtat  2urxmooo4oee ifetyt aDel(mp t)aeerxo iydop r uvi;s trxrxo3ny1lp   fcia() rtaur nu0tlxniietatfsDrlnms (4aexoiocoadomD lnvo (0s2xmirpny1lm emnet s)sDrmurp;t4optoii3iyt m2emums () rtoxo3oydomDe i i t  rxrio3ny4al  lfetls) 2tr(rpno4openiictys mDemu o;u)tleomr ty1fat lneo s s2xoxmpoy4op n iet t aDta(mooo4opxniieildfa emn p;(0arenio totfpteli ilt) rxm(o3iy1optelfei s arta(mooo4tlenii3iytlmDeluvpnu) etrio oa1opt anvo;(0 2urxm3iu1opt  fcsatf Duax o;t0tpt moeiadfs2ranvo u4teermr3oo1opDeaueol(0setmxo nu1am emiesl(f 2rrur ;o0oeeomociadfaDra( o u)tlxoio tadlmteanvi (0 exoir3nu4oltelnvia(f 2umumpnu4oexo o3ils a ua(vs (0tlxoio3oatopDeauvolt)sexoxopoy4lle lfvtltf 2taxrp;t1alto o3ilt s2ra(vp u)teermr3ootopt  nes;t) 2xoirpiy1amenmfcslsf 2tm( oou4oexniicias a2emn o t)artnmf3iy1lp eaueolt) 2xmxm3ou4llenlivtas s2ta(mo;u4tlxo feilsla2rmu s;u) etomr oytfp   i s (0s2xm(rpou1lpee ics () rrr( ono0ale ioeiasfsDrmu on(0 ltoxr3iydfp   nvs;s0 rtoiopoy1llee fetltfs2ua(mooo1aeenmieiatlmDrauvs;u)aetoifcoytopDr nvo;s0 etmir3no1amt  ivil(f 2rr(rp;t0tex ioctytfm em( s;u0 renxrciadom e n sls0setrim ou4am  lnes tf Drrx p;t4opxoii3tasfaDra(mpnt)texoxociotfp  auvs t0sexo(o3oudol nmivtatf Dum(mo;o4olx ii3tyslaDea(mo (0aeeoxo oydlm   u o;(0srto(opiy4llenlicia() Dur(mo;t0apxo o3ils m2rmn p;t0alenmr totfptelivo t  rumir iodopenmiviltfa2umuronu1alx io3ildla rm( sn() rtoxrciatom  li ilt) eto(m3oudomeemivt sf rraxr ;u0texo iciltfs rmnmo;u)tetnxo ta1fa eai sls) ruo(r iy4om elnvs t)sDtmurp;o4aleo fetytlmDuluvp;u)alenifctadfpD livi s0tetoir nodom  lnvsat sDtax  ou0tetoio3iatfa rlu o;t4aleoif3oodopD anvo () exm(r3nodalen nvil(  2rruroot1olenmf3tatla2eluvs;u)tlxnxo3iatfpDrauvils)trtmxm3io4olt lfvsas arraxmp;o4tlen o3tldlaDemu p u) ltoxf3todlat anvi;s sruoxo3nydam emfvia(  Dur(r ot1tetoifciltfm uauvp;t4 lxnxo oa1faDr uvo s0trxr(mpnodoltnmivtl()sDtr(  oo4opx moeiltls2ea(vs t)trxoio3totopDranei;()t2um(r ou4optn ictltfsrrr(mpno0apx mi3ilsfm2rmuvo (0tlerir oydfatraies;( sruo(o nu4ome mfcsatfa2urxmpou4tlxn ictytfs2ua(mo;t0 rxnxf oo1oa r nei;t  rxrio iu1olee ictl(f 2ta( o;u4tee if3ilsla2ea(msnu4trtoxocoodlaDranvi;()t2tr(r nydolenmfetlsfsDumxm no4altn f3ilt m2ranvs (0trerxr3oa1oa  ai o;t)seuoiopnydlm  mivtlt sruaxrp;o4opeomi3iat m2ea(msnu4altoxo3io1omDe uvo (0teuo(r iodal  mfvta()aDtrum ;t1ope mfetlslsDeanvonu)trxnxf iydfmtrlneo;(  exrimpno4op n neilt)artau ono0olxnifetysls2raumo t0tetrif ia1fmt  uvo;s)t2ur(r3nodom e ietl()aDtrxr ou0tpeniiciasls2rmnvo;u)arxnmfcoytoa eln s;t0t2tmxm3iu1lpeemfei s  2ur(  ot0olxnmoctls s2rmuvpnu)teenirctadfa e i s;s)srxrxr iu4olte neia(  rtm(mooo1apt  oetltfmDea(mo u0treomocoy1fmteauvo t0sruoxopiy1optelfeiasfsrrr(mpou0opxn f3tadfm2rluvo () lxnxf3oo1oaD  uvslt0tetrxmpoudlp  mies ( srrm(ro;o4teto f3iydla2um(von()aexoir to1fp   i il(  eumxr nu4ap elfeils s2rru  no0alxn feilsfa2umnvp (0 eeoir iydoaDrlu o t0trto(mpiudlmeemivs t  2rrxmpnu1tpeomi3iytlm uauvp t) rtomoctatfmte nei t0 eur(m iodopenmfvs s aDuau ont4tptniietadfsDrlu p;u0 rerio oa1opD aneol(  rxo(rpiy4ap nlncsat sDtrxmo;o0alx mfcildlmDra( onu0artnirciytfa   uvils) exm(m no4op  lncslsfa2raurp;u4alx ifctad sDeanvo u)aetrmf3iydoaDrauvo s t2xm(opiodapte nesltfaDrrumo;u0apeo feiadfm2rmnmp;(0 exnmo3oytlmt  ues (0tetrxrpiy1alenliet tfs2ta( pot4tltnmi3iltfs2umn snu)arxnxfctydfmD au il()s2xo(o ny1ale lncsl( aruaxm ot0texn fciytfmDea( snt)tlxnmfcoydfaDr i slt teuoiopio1opeemivslt aruru ooo0oeto oetasfaDum(vp t0alxnmocio1optrlu i;s)trum(m iy1lm   ivsls) rrr(rpou0olen f3tyt m2rl(mpn(4artrif3iydfpt an ols t2xo(o oy4lleelnviat) rtr(mo;o0openii3tytfm2em(vs u0tlxoio3iy1lpDr uvilt srxr(m3oudlmt  nes t) rtau ono4aeeniictltla2eluvs () renmo3iotfmt au o (0teto(o iu1lmt lfvsl()a2tmxm ot4alt  fctls m2eau p;()artnif iydla r nvs t texrxopny1ole  nesa(fsrtr(moot4teenii3ildlmDumnvp;t4 ltrmfcoatfpD  uvi t) rtoiopiu1ameemfviat aDuaxrp;u0aet  i3ilsfsDem(vs;t)texoxfcoydfaDe n o s) 2xmxmpiudlpe  nvi t sDtmx o;o4tet iociydlm eanvo;() ltomfciodlp rlu o ( sruoirpoy4ap nlnci ( a2trumono4oeenmi3tytlm2rm(vs (0 rermf3iytop r ieo;(0trxm(o3oydlme  fesat  Dra(  nt4opt  fctytla2rlnvo;(4tlerif3oodoa raieilt  exm(r3nu1apee nvta(f rtrx  ot1tee  feiatfsDrl(vsn()trerxo3oadfmtean s;t)setr(o3nu1ol e fvi s)srtm(rp;u4texo oeiasfa2ranvs t4treomr tadfa rlnei t0sruo(rpoudapenmietat)aDtr(m nu0oee  iciasfa el( o u4trtnxrcia1lpDr ivi;s  2xo(opoodame  fviat sDrmxr ;t0apt  iciyt s ranvo;u4alxrxr3oodfmD anvo;t0srum(rpio4am  mfeiltfsDrr(m nt0tlxnioeiyt a2ulnmp;t0tlxomf3oytfa rlnvo t t2xrirpoy1lp  mfcil( s2tau p;u0tpt mo3tatfaDrlnms t0trtnmr3io1lptrln s;( tetrxo3nodol emnes s)sDumxmpnu1tpeomi3iasfaDulu p t4tlxoiocoydoptranvo t0srumio3ou1openlivsl()s2uru poo0apxomfctldfaDemnvsnu0tlxnifcta1fpteaieols)tetoxmpnydoptnmnesa( arrm(rp;o0oeenmf3tyd aDrm(mp;t0 reoxf oatlateanvol(0trtrim iydaptelictl(farrmu oou4olt ifciad a uluvp;(0texnmf3iodlpDeai o t)t2ur(m3ou1amenlnvia(f rum(r nu4opeo ieiadlaDuaumsn(0texnmf tytoaDr uei s seuo(mpoo1omt mivtas)arurum ;o1alt  octldfmDrl(ms ()tlermo3oy1la   nvi ( texr(m3oydolenlicsasfaDurx  ;o0alxomieiys a rl(mo;(0alxoxocoy1op eai slt0 rtmxmpiodol e fei s arum(mo;o0olto oetytla emuvp;() rtnircoatfmtrlivs t0 rtm(o iodap elict ( a2rru  ;o4tpto i3iytfs elnmon(4tlerxo3ootomtelnesls) rtoiopoodoltemfct t s2umx pnt1tlx if3tld mDeauvpnu4artoifcoatlm rauvs t)teuoio3nu4lle  nvil()aDta(rono1optn oeiaslm ulnvp t0texomrcoo1oateauei;t) 2tr(o3oy4optnmiei ( sDtm(m nu0opxo f3tlsfa rm(mont0texrircoo1lm eauei t) ruoirpou4amt  ieilsf 2raxm ;u0oltn fetadls rln o;t)trtomfciytlaD aueil( sexr(mpnu1opt lfvtlt) Drrumpnu4tet  ieils sDul( o;u4 rxnif oatomt ai s;s) exo(m3nu1lmte ivt tfsrrmumo;t4aee mi3tysfa umn sn(0alerir3iytoptr i il()trtr(opiydolt lnct s  2umu p;o0ole iociltla el(vs;(4aeeomf3iy1fpte nvi;()trurxopou1alee ivsat) rurx o;o1tpe  ieiytls em( o;t0 rtrirciy1lmtr u s ( sexrirpoydlp n net t)sDtmxm ;u0apx mo3tldlsDemn s;u0 exniocoatlp r ueslt  eumimpoo1lp  lieiasf Dtru o;t1olxoioeiyd aDul(vs u)trxrmocto1late u sl()t2tr(rpnu4omenlicils)sruau  ;t0olen i3iltlmDeau o;u4aleoif ootopDranvo;(0trxoxr3iu4lpte ieils)srur(mpnu4tpeoifetldfaDel( pn(4aetrioctatoptr ies t)trtrxr3nu1lmenmies sfsrra(ro;u4tpxnmoeiys a ea(vo;u)tlxrxo3oatfmD  iei;s)setm(rpio1omen fetlsfsDtaxrp;o4tpt iictldlm2el(mont)tlenio3iodomt luei;s tetm(opoodlltelfci s arta( o;t1oex  f3tat a2emnms u0aexnxoctodlmt  n o;s0 exm(r3oy1omeelnvi t)aDta( pnt1aeeo oeiys sDrl(vs;u)treomocoo1fpDeanei;t0teumiopnudlle lnvtlsfarta( pno1oleomoeilsfs2ul( p (0 rxoifctodoateauei ()trxmxm oy4ol elnvt (f 2umxm no0texoiieiys a2rln pnu)aeeoxrciytlaDr n o s)srtm(r3oo1amen ncils) Dumur no4tle moeiytfsDem( p (4tlenif3oydfmD ai ilt  exmir3oodlpeemics s) Dtaur nu0tpt mfeiltfmDumu snt)arenircoy1fptr iei;s0tetoxrpiu4apenlfcsls)artaxront1aex mieils s em( ont) ltomr todlat lu o ()t2xoxo3iydlm nmfvi s s2umu ono4ope  fciltfm em(mo;u)texoif3ta1fpDeanei;s)srxmir io4omeelfvtatfaruaum nu1tltn o3ildfaDum( p;u) etrxo3oa1lm rli s;s)s2uo(m3ou4apte feil()a2rrxmpou4tpxn ietlsla2ua( o t) rtrmocoodfm r i i;s)tetrim iu1ame  fctls aDurump;t4texnmf3tls mDulnms;u)altoxrcoytom  luvi;(  ruoxm iy4am nmfvta(fa2tmur oo0tle  oetatfm2umu o u0arxrxo iy1lpD  neo;(0s2urxm3no4lmtnlnet s sDraurooo4texn ieiatla uanvsnt4altnmocoo1lp e n ils0s2urxmpny4lpe  fvtls  2taxro;u4ale mf3iatfs2ranms;t0aleoxr oatfp e ues;t)t2toir3iu4altelncil( aDumu  ;u4oee miciad m2ulnvon()arxrirctydlm   u s s s2urio ou4altn iesa(fa2rm(r ;o0aeen i3ils a2elnmo t4 exrmf oy1omDeluvil(0t2um(o3iu4op nmfetlsfa2urxm ;u1tpx iieiad m elu p u)arxrmr3ta1oaDr n sl( tetmxr oy1ap emnvs ( aDumum ot4aet moeiatfm2rmnmo u0aleoxrctatfm  lnes;()seumxopoydaptemnetatf 2trx ono4tpe mfciyslsDrm( s;t4 rxriocty1faD aivsls0srurxr oy1lmtn fvtat artm(mpnu1alx  fetatfaDumn snu4tleomf oy1omt  ueil(  rtrxrpoo1oleelnctl(f 2umx  oo1tpt iictatlm ul( p;u) exnir3iytomDr n o s0trxoir ou4lpe mnetl()s2tm( o;u4aexnioeiltfs ua(msnt0 leoxo3ta1la r uvi t0 2tr(r3oudomtemnvi () rtr( pnu0tlt mf3tytla2rmnvpnu) lxoxr oadfmD  ivs;( trxmio iu1al  mici () ruaxmoou0tptnmietydls eln snu4alxrmr iadlm e ueslt0 eurim3iodam elictat artr(rono4tet mfeiys s uluvs;t0alenmfcoadfp rlnvi () 2um(o iodal  lneilsf 2uaxmp;o4aexoiieiadfmDemuvsnt4altomf3oy1fp r ivo ()tetmxo oydlp n ivil(fa2um( onu0oeeoifeiltls uauvpn(4 rxrif todlmt luvi;s0 2to(r3iy4aleemivi s) Dtm( pnu1alxomf3iyd m2uau snt)tlxoio3oa1fmDrlies (  2uoirpiodlmteliei (  rtmxrpnt4ale if3tad a2umnvon(0alxnxrcoo1oatr iei;( texmio3nu4omeelivtat s2tmx pnt1texnmfeiysls uanvs;u) rxrir totfm eanei s0 etm(o nodlltn ics s)sDumxmpoo1aet  feiadlm2el(vs;u)alxoxo3ootlpteai o s0s2xrxrpoudoptemnetls)srrr(r no4tltn fctysfs2rlnvp;u)alenxr oa1lpDr nvols) rtm(opiu4amenlnvi ()s2tm(root4aeeomf3tld a2emnmp;u) rxnxr totfptrauei ( trxrxm iy1optnmnes s)arur(ro;u0oex io3iys m rl(vpnu0arerio3tatfm r uvo;s0s2tmxr nudomtelieiatfarurum ou1tpto ieiatlmDranvon(0altnxr to1oaD  uvi;s0setm(r iy4llee fvtas) Dta(r ;o0tlen o3iysfsDea(vsnu4trxnio3to1fat aieil()srxrir oodop  mfvia()sDtaxrp;u0tpe  fetyslaDulu onu4tlxoir iy1omDeluvilt0t2xrim3oy1lmt  ivia(faru
\ No newline at end of file
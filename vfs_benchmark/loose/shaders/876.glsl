@@ -0,0 +1 @@
+nvo t)t2uo(rpoo4ap nlictat srrax o;u0tltomo3tls mDean s;(0aeerxrctydomDrlies s  rtm(r io1ll n fci s)srrru o;u0oetoii3iyd a2rlump;u) lerirctatopDrln i;() 2xoir oudaleelfctas) rua(r nu1oeeo octytls umump;(4tetrmo3tydop r neo s  rxr(o3oy1lpeemneta( srtrxrp;t0tee moetas m2um(ms;u0 leoxfcoa1lpt auei t)tetr(m3oo1aptemieilt) 2rmx p;u1olxoioeiatlsDraump;u4aetoxrctotlat  ieo (0trxoim ou4aleemnvi ()sDua(mpou0tle  fctat s2el(msnu0arxomr3ta1opDr i s;()srur(m no4am  lici sf 2rmxmo;u4opx  o3tldlm ulnvs;u0tltrif3oo1oa eai o s)t2xr(mpiu1ol e ietatf rum(  nt0olxo fcias aDea( snt)arenxr ty1om rlivi;(0s2toirpny4ol  mivt t s2umur nt0opx ii3iatfm rl(vont0tlenmr3tytla  an s;t  rtrir oy1al elnvsl(f rtmxm ou1tetnmf3ildlsDra(mo;()artrxo3ootomDrlues t) exoir3ou4amt lies ()artrxmooo4alxnmieiydla2eauvsnu)trtnmf totoat li ols)t2xr(m io1oleemfeslt artrurpot0ale mi3iltfmDrmnmpnt4arxrxrcoadlp eai s (0 euoio3ny4llenmnctl(f Drm(ro;u1tlx ifeiasfmDranmpn(0arermr tytomDeau o;t s2xr(m3iudap elivi () ruaxmp;o1aetomi3iasfa uauvp;t) eenio iadlpte n o s0setmxo3iy1ameelivilsf 2trxro;t1tptn ieiyd a el(mpnu) lenxocoy1lpt auvs;()setmxo iy4lmtelnctasfsruaum nt4oleo iciltls ulumo (4 reoiociydfaD luvi s) eurxmpiodol nmivias  Drmxm no0aleomi3tytfm2ul(vp t)arxnmfcootfatrliei;t)sruo(r nu4ol emnvsat aDum(mpnu4oeeomfctad sDrmnvsn(4 ltoircoy1lpDelu i t0 etrirpny1aptelfeslt a2taumono4altnio3tldfm2rauvon(0tltrmo iydfa  ln olt0 rxrim3iudll elfcsat) rtaumono4tpxniieiatfm2rmnmo;(0 eeomo to1la eauvsls  etoir nydalee fetlt)aDtaur no1olxn o3iltfmDul( s (4tlxrmf3totfp eluei;() rtoirpiu1amt  feilt) Durxrono4tpt moeiysla2ranvp;t4aetoxrcia1fa  ai olt0s2tr(r no1optnlicias)aDta(  ot4aetoiiciatls2ulnvon()aexomf iotlmtraneo;s  etmim3ny1lm emietas)a2umxmonu0optnmieilt a2ea(vs;u0tleoxo oytom e ueo (0 2ur(o3io1lltemfctatfs2rmu pno1tlx  i3iyd m2elnmo;(4altnmfcoadomtr ivols)sexoimpiu1ol   feias srumu ont0optomociydfs elnvonu0 leomf oo1om raiei;s0s2xm(m3oy4ol   icilt arumu poo0aeeo octlsfs ua(monu0 leoioctotopD lieslt0 eum(r3oydoleelivs (f 2raxmo;t4olx mfeilsfm ul(vo;u0trenir tadfpD aivs s  ruriopiu1lle  nctlt aDtrxm ;t0texn f3iat sDrlu pn(0teenmo3totfaD auvols seuo(r iu1ap   fvta(f rraxr ot0tlxomfctltfm2ean o;()alxomr3iytla r ivi;t0trxm(o oo1ole mietlsfsDrmurp;t1oeeniictlt s2elnvsnu4 reoxr3tytfat au o;s0truoir3oy4amt  ivtat)a2taxr no4tle mo3tadlsDrlnvp (4alxrxocty1lmDrln o;s)sexo(m3no4apt  fetls sDtrur ot0aetomfetydlm rauvo (4arxoir tydfm eaivilt)srxoir nodlmt  ivi s)srrm(r nt0aeto oetaslm umnmpnu0 renxo3iotom  livi t  2xr(o nu1lm elncsat)arrrxrono1tleo ieiadfa2umuvsnt4artnmr oadla  aies;(  etrxr3nudomeelfvsas aDrrur ;u0aleniociadfm uanvo;t0teenxrciy1fp  lneilt s2xmxr iodolenmicils)aDtr(m nt4oltoiictytlmDuln p;t0tleoiocoatfatelieo;t0s2tmir3iy4omenmnviat  Dtr(rp;u1tpxnifetys aDrl( s u) lenir3todom eliesls) ruoxrpoudole mnci s aruaxro;u1oltomf3ias m ea(mon(4areoxrciydlatranvslt)texmxm iy1op nmnctat) 2ra(mo;u0aex mfeildlsDeluvp;t4tlxnxociytfm   nes (  etrxo oodlp  livi s  Drr(rp;t1aptnmiciytla2umums;u0 rtnxo3iadlpD  ivolt)teuoim3nu1ome lnvsa(fa2rmumono0aexnmfciys m2rm( o ()aetrmfctotlpDr nvil( t2xm(m3ou4al   neils s2uaurpno1tetn fetydlm ulnmp u4tlxrxr oadoaDrlnvs t setr(mpnudopeemnetas) 2trumo;u4tltnioctldlmDuanms;(4altomrcoy1lp eaivol( trxrirpnu1am   nciat s2rr(mp;o4olt ioeiyslm eau s u)tlenir3tadfmDr uei;s)tetrir iu4ap emfeilt aDtax pou1olx mo3iadfs ua( s;(4 lenmocto1lmt  neo t trurxr no1ll   ici t  2rmxr oo0aeen ietlt s2uanvs t)aetoxf tatfa  auvo;s0t2urxo oo4optelieils)aruaxmo;u0aleo o3iyslm eau o;u4tlxnif iydoate ieilt srxrxm nodopen feslt)sDurxrp;u0optoiociltlm ul(vs;t4arxnmrcoa1lm ean sls)trxoim oudaltnmfcsl()srur(rono4oex  oeiltfa elnms ()alenxr3oy1op   u il()teum(opio1ll n fvilsfa2umu pno1altomf3iatfs uln p ()tltnio3oatfpt au o t)t2tmxm iydomtnlietls)arrruro;o4ape  ociydlmDrm(vo;u4 rxrxr todomD ln il( srxoxr iy1ll e ivtat sDurur ou1aptoii3iyd sDuln s () exnir iytlaDeaiei;t texrir3oo1lpen ncilsf Dta(rpoo1aex iietldlm umn pn()texriocoodfpDrau ols0sexoim oy1amenmivs s a2rm(r no4apx  ieiadls2ea(msn(4 exoio iydlatr n i;t) rur(rpnu4omtnlnci s  2ur(ro;t1tpe  f3iytla ul(ms;(4arxrxrciadfatelueo (0tetmio3iodaltnmiei t a2rm(ronu4tpxo fetldfm2rlnvp t)aetomocoydlateaieo ()seurxr3ny4apee fcsasf Draurooo4apen i3tatfm ran snu4tltoxrctotom  anes;s  exrio nu4amenmiei t s2rmxmpot1tee mf3tldfm em( s u)trermo oodla  aneo;( srxrxrpoydlp  mnvsa()sDtrumo;o4tet  fctyslsDua(mo u0tetomf3ootfat  ueo;s0t2um(mpoudamt licil() rtr(ro;o4tlt ioeiys aDuan o;u0 exrio3tadla e uvs ()seuo(m3nu1al emnctl(fsDurxm ;t1oexoifctlslmDuauvs;u) eermr iotfm rai i;s  eumir no1lm  lnvsl(f Drmxr ;t0aexnioeiadlsDum( s (0altrxo iadopDelneo ( tetoirpny4op nlnetlt a2um(mo;u4oeeo iciyslm ul(vs;u)tlxrmf3tytlateauei;s0texm(opiu1ape lfcsatfsrtrx ono1aexo f3iydlaDua( p;t)teerxr oatlp rauvi;( texm(m3nu4lp  mfes t)sDtaxmono1olenifctlsfa2elu p (4tlerio3ta1fm   n o t) rxriopnu4omeelfvt t aDurumono0olx  ociadfs2rlnmsnu)trenifcoo1lpD lu i () 2uoirpoy4apeelnes () 2tr(roou1apx  fetldla um( pnu0altomrcoydomtrlivsls s2um(o oo1omtn iet t)s2tmxmpnu4olxnmi3tlslsDumnvon()trxrxo3totopDrlivo s sexoxo3ny1alt mneiat  rum(root4opt mi3iadfm raumo;t4 exrmo3oo1omte n i;(0 rtrio3ou1apt livsa(faDtax p;u1tpxn oeilt a em(vo;(0altoir tadlmt lneo s) rto(m oo4ol   feilsfaDur( onu0oexo fctls a2emn p t)tltnmo3iytlpD anvi s0teuo(m3oudlpe lfeil()s2rr(ro;u1tle  ictlsfs elnvp u) lenircoo1fmDrlueils0t2urxo3oo1om nmiviat)arrau  ot4aexnio3ils mDuln pn()aexrir iadlpDr n sls0 2trirpoo1omen ict tfs2ur(ro;t0oexo i3tlsfm2ul(vp t4 ltoxf3ia1oa  an s;t) rto(opoo1aptemfeias srta(root4opt  ociysfsDemn on(0 ltoxr oadfm eai il()trtr(o3io1lm nmfcta(fa2tmurpnt0alx iociysfa2rmu pnu4trermocoytlpDrln o;(0 rxrxr ny1am  licta(  rraumonu1opeomietls aDrl(mo u)trenmo oy1faDeai il( s2xoxm oy1omenlneiatfsrtr(root4tet mfeiaslaDeanmp;u0treoirciodfm ran sl(0 exoim iu4lltnmnesa(  Dra(rp;u0opx mietydlmDrau snu4 lenir tytlm rlivs s0 exrxo3nu4lme mnviltf rumur oo4aleo o3ilslsDrl(vp;t4aexnxr3tytlpD  uvilt  2uo(mpiu4op elicsls)srrr(root0aetoioctlt s2eau p u4teenircoytopDrauvi;t0srtrxm iydlle lici (fsDrm( ooo1tptnif3tatfa2ua( s;u)aeenxo3iotlaDelu s s) 2xrir nu4lmtnmici ()s2trxmpot0apt mi3iatlaDeanvp;t)aeeoir iydfpDrau ol()trumxm iudoptn fesas)s2ururooo0oeto fetltlm2rlu p;(4 leomr3iotlp rlu i s sexmxr oo1am nlicia()sDurxrpot0oeeo oeilsfm2uln s u) ltoxo3oa1fp r iei t s2uoio ou4lltnlivtatfa2rmuroot0ale  fcilsls2emnvsnu4aexoif iydfm rauvolt)srum(rpnydamee icsat)srtr(m nu1ole mi3ilt sDuau o t) rtrif iadoa rlneol(0 rtmiopoydlpt  nci () 2rr(mp;o4apxn oeiyd s2eaumsnt) rtrifctadlp rln o;t  etrxm3ou4am n nesatfsDuaxmo;u1ole io3iyt aDranvo t)aexoio iatom rlu i s) rto(r iu4lpeemivil()sDuaxr ou1tpt mo3iys m ua(monu)trermf oadlpt  n o;s  2xr(m nodlpenlfvs ( a2tax ooo0ape mfeiydfs2ulnms;u)arxnmf iytlmD  ivilt) rumxopio4lle  fci t srumumpou4texoifeiadfs rl( s (4tltnmo3iytopDranes t  rur(r3oo4llee icsl()aDra( ono1olxnmfciydfsDranmpnt) eeoxf3iatoaDraivs () 2xm(o io1omtnlfcils) rurxmpot0ole ifctydfaDel(mo;t4trtrmocto1fptran i;s0 2trim3nu4ll  lfeia()a2raurpoo4oetn oetltlm2elumpnt0 rerxo3iatlate iesl(  etmimpno1olee nvtatf 2umx pnt0apto feiatlaDrluvs;t)tltnxfciytoptrlieo ()t2tm(rpou1al nmivta(f Dumurp;t1aet moeiad m rlu s t4tleoir3ty1fmt lu il( srxmio3oydopte nct tfsDuaxro;t0aexomfciaslm2eanvs;t)trxnmo3oadomte uvi (  eto(opnudamt  icta( sDuaxrooo0ape  ieiasfs ulu o u4arxnir oy1lp elnvs t  2xoir3ny4olte ics s)sDra(  no0apeoii3tysla ea(mp;u4alerir3oydfmD luei;(0srtoxrpiu4op nmncsat arrr(r ot0tetnmoeiyt a eaump t)artomf oodlmtean o;t teur(rpiy4al e nvi t sDrru pot1opxoioeiasls2ea(vo;t)alerxf3iydla  li s;t seum(o3oodamee nctat) 2ururono0aexomo3tltla rmnvont)tetoxr tatom   n il() rxm(o ou4omeemncia(fsrumx p;u0teenio3iytfaDrm(von()tlerir3iodopDraneo;()s2xoxopno4aleelfctatf Dum(  no0apxo ieiasla2ulnvs u4 exrio iotopDr neils)trur(m3iu4lltnlfvsat aruaur ;t1apx mfctytfs2ul(mp;t4 exrio3oa1oaDelnvsls0 etrim3iy4lp elnetas aDtmurpou4opeoiiciydfmDeauvon(4tetoxf3oytop e i i ( sexrio3iy4al emfvi t  rumur no1teeoiiciadfaDemnms t0aetoxf3todfmDe uvo;t truoxo nudamtn ics s)a2urur nt4alt iietydfsDrlnvs;t0artrmo ootlmDean s;( t2umim oy1open ivi t) rrrurp;o1aeto feilsfmDeluvo t) lerir iytoa e ues (0srur(o3ny4lptelnvias s2rauro;u1oeeo o3iytla ea( o t4artomo3tytfptrln s;t0t2xm(mpoo1olt lncsl(f rtr(mp;o4tltoio3iytlm ra(mp u4 lenxo3oytoateanes;s)s2xr(mpnu1lp nmnesa( srra( poo4aetnioetldfs2rluvo;t4 reoio3to1lpt anvilt tetoxopnu1ll e ieslsfs2tau  ot1tet iociad s2eln o;(4 rtrxo3to1faDelu s s)srumxo3ny4al n ncsls) 2rmx  no0apxo ociasls um(ms;t)trtoif3oo1oa e uesl(0seuo(m3ou4lp elfvtlt sruau ont4aee mieiytla ea(vp;t4 rtomr3oytopte ivils0 2xrir oodap emfes sf Dumurpno4aex mociasls2rl(vo t4 exrmoctotlat an o;(0 2umiopou4ape lfcs tfsrrax o;t4tpeomoctadfs2uln s;u)tetniocia1opt  iesls s2urim oo4lmt  ivi tf 2umum ;t4tet  ietytls2em(mpnu0tlxnxf oadfmte ieols0s2trxrpnodole lneils)srumur nu4oeeo fciatfaDum(vs u0tetoxfctydoa ran ilt  etoxo nu4aptnmneils  rrmum oo4altnmietatfmDraumsnt)trxnmociy1fpDeli o;t teum(r no1lpte iesas arum(m oo4oltn ieiadla ulnmont)artrxo iatoaDrlnvilt) etr(opnodlp nmivils) 2umum ou1apeniietatfa ra(vp;u)aleoxo3ootoatr n o;t setoio3no4optelneia( srum(m ;o0tpen oetydfm uan o (0altomf iy1omtelueilt srtoim ny1ome  nct () 2tax oot0tptoiociltfmDulnmpnt) exrmo3totfa r ues ()tetoxrpiudale  fcs t) rrmx poo0opeo octasls uln onu0tltomo3tatomt liei t setrxo oo4lme liet (f 2rmu o;t0optn o3tysfs2rmumo;()alenmf tatomD lieolt  2tmxr io4ape  ictls) rraxmpot1aexomoeildfa ua( s;()tlxrir iodom  au s;s)srtmiopno1openmfvil(  Dua(root0alxnmfeias s eanmonu)aetoxrcoatfp r i o;t) eumxr no4lpenlfvtls srumumoou4oee mo3iasfmDum(vpnt0 lxnxociadlat  iei s  euoio oy4lpt  ivs t artaur nu0tetomoeilslm rl( p;u4 ltnmf tytomtranes t)trtmxrpoydalenlfvs t)sDta(rp;o0altnioeiyt m eln o (0teermf iadfa rau i;t  ruoiopou4lp emfvilsfa2ua(root0openmieiydlsDranmpnu4tlenmfctytlpt auvolt teur(r3oydll  lfcilt) ruaxmpno4opxoioctydfa ulnvs u4texnmr3oatfpDe uvsl( srurim3oudamee fvils) rrr(mpno4openmoetad sDrmnvo;(4alxrxf3ia1fpt liei;( s2xrir3iy4optn fesl( a2um(m ;t1optn ieiydlm rl(vo u4arxrxr3ty1la eaues (  rxoio oo1om  lfeiat)s2tax pnu4tlxniociadfs eauvs;() exnxo oa1omDr ivsl(0 etr(m3no4op elicsas) rtaur nt4aex miciat sDea(vs;t0trxoxrctadfpD  nei;s  2xmir3iy1lleemnvils artmxmo;o4opeoii3tlt s raumsn(0altnmocoa1fm   ies t0trumir iydll emfvtas  Durx oou4apeoifctasla2ua(vo ()teenio3oa1opteli s;t)sexrxopio1ope mfcs t)arrau  ;o4optomfetldla2rln on(4 exnif to1fp rauvi () etm(rpiudlp e neias)artm( oot0aexoiociatlm umuvs;(0 exoxo3to1fpteanei;s0teur(m3io4op nmnei ( srtr(  nu1tleomociltfm emnmpnt0 lxrxr3oadfmt lu i;t0s2tr(m3oodoptemnctas)aDtaxm no1apenif3iatlsDem( p;()arxrir io1lp   n s;t)trur(rpiy4op e nesls)sDra( oot0tltnmoeiytfsDemnvo;(0artrmf ty1optelnvsl(0seto(r oy1ome liesls)arta(mp;o4opxomfciyd m2emu p;()artomf iytlpD aneil(0t2uoxo oydlmeemici () 2truro;t4aexo fctytla rauvont) lxrioctytlmDrlivi (  etoxm3nodaltnmnct s aDtax  ;o4ape mf3iydfs2ea( p (4aeeoio oydlat au s;s0srxoxr nydllen fviat)srrrxro;t0apen ociysfm2umnmpnt0 rtnxr tadla  lieolt0 2trio iy4ale lfetlt)aDur(mpnt4aeeo feiad s2ra( o;u4trxnxr oatla eaneil()teuoir3nu1lm nlieil(faDumxmpno0aexomfeildlmDrmu s u4 eeriociadoaD lueslt teuoxo iudol  lnctas) 2rax  ou0teenmieild a ul( p;t0altrmo3ta1fpt  ueil(  exrio oy1opeelnet sfaDtrx  ou1ole iiciysfs rau snu)trtrxr oy1opDr nvilt t2uoxo nydlptn fctl()s2um(mo;u0oetomo3iasfa em(vo;(4 reriocoo1laDr u o (0 etrxo iu4apenmfcta()arrax  no4olt iicias m emn p;t0 etnio3iatfpteli s;s) rtrxr3nudom e ietas a2ua(mont0aet iictydfs2emn o;u0tleomr tytla ean i t0sexo(o3oo1omt mivsas a2ra(ront1aex  o3taslaDrm(msnu0alxrircoo1oat aivs;t)seumir iy4amen ncsas a2uaxmpnt1tlenmfctldfaDua(vs u) exomfcoodlpDrlnvol( texoir3oy4olt  neias) rtrx pnt4alxomiciyd s2ulu o;u)trtrxrctotop rlieo s) euriopnydll nmfet (fsrrmxro;t4tptoii3tatfmDuanmp;u)teermf ta1fmtr nvo;t0t2umirpny4am   fesatfs2ra(r no0optnioeiltlm rluvp;t)tleoxrciotfmDeau i t)srxm(rpiy1opeemivils  rur(mpno0alx mfctldls2ra( o u4trerir3iy1op elueo;t0s2xoirpoo1lmt mfetat) Dtaur ;t4aexo o3iat m2eluvo (4aexnxo3iodfaDrauvs s) 2urxo ny4am   nvils srtmumoou1ope iiciytlm emn o;u4tltrxr3ty1fa  lneslt)t2xo(m3io1omt lietls  2uau  ;t1tee ifcias m rm( snt0texoxo3ty1lptrluei;(  rtmxrpou1lmtn nvs (  Dtr(m ot0aex mietytlm2umnvo;t0 ltnmrctydlmtr i o;t)s2toim oy4olte fcsa( aDra(mpnt4tltniiciat a2rmn o;t)teerif3oydlp ean ols)sexm(rpnodlleelfes () 2rmumonu4oee moetyd s umu on()teeomr tydfpDr nvs;t)tetm(o3iu4llenmfvtls s2raur ;u1apxo feilslm eanms;(4trxrioctydom e nes t texoir oodop nmieias) 2tr( o;o1aeeo f3iatfm ul(vs t0 rxnmo ootomt luvol(0seuo(m oudlm   fvils aDuax  no1tlt  i3iytfm2em(vp (4 lenio3tydom eanvo (0s2tr(rpoo1ol  lnvsa(  2tmxmpnt1apx mi3ilsfa rmumo (4 rermrcia1fpD aieil( truoxm3oo4llenlics t  2trxmpnt1olto o3iatlmDrmnvo;t) lxnif3oa1fmt  neslt)s2xmxo iodol e fvt () 2uaxm ou1tptoio3tatfs2eluvp (4 lxrxo ootfaDrai sl(0trxr(m3ou1lptn ivsa()s2taxmp;t1tpt moeildfm2rauvo;(4 ltoxfcoy1fmD  ueo;t0srtoxm iudome livslt a2rau ont4altnioctld s el( s;t0teeniocta1omte n olt0s2tmxm3ny4ol emici (  Duaump;u0tet micilsfsDeau snu)alxrxr oy1la e ieo;s t2toxr3nu4apt lnesl(  2urxmooo0oleniociltla2umump;t)teermf3iytlm eln ols) rxr(o no1lp elicsa(f 2umumpoo1oetoio3tytlm2ul( p;t4texnxo3ty1fpDe nvols)t2xoiopiu4am   nes t aDtrur ot0aetomietltls2ul(monu4tlxnifctotlatranvo s t2ur(opno4ape  fvtlsfs2ua(r ;o0tlt mf3iatla emu s;t4trxrifctytlp  anei t) rxrirpoo1ole  fes t aDrm(root4aeen fcias s2ul(vp;u4aexnir tadopteai sls  2tmxo oydlleeliesls)s2tr( onu1oet moetat a2umn o;t4altnxr3oodlptranes t) exrim ny1op nmnetl(faDurxm ou4ope mi3iat m2em(mont4tlxoif3oatoaDrlnvils)truoxo3oodopenlncils)arrrxmoou4apx if3ildls rl(vp;(4arxomr iodoaD aies;t0seuo(mpiydalt mfeia()sDrm(mpnu0optoioeilsla2uaump;u) lxomf tytfmt  uvsl(0seurir3nudlmtelnvtlt  Durxr ;t0altoifctydlm2eln snu4aexoio oa1opDraivs;() 2urxmpiodalee feil(f Dtm(  ;u4altomf3tat s uln s;u4arxnmf ty1opDean i t t2tmxm3oo4ome miciasfarum(rpnt4aeeo iciysfm2eauvo;t4tltoif3oytopDeli o;(0s2xoir ou1aleemfeslt a2umumoou0opto fciydfs2elnvont4trtnio3iodlm raneo;s) rxmimpio1amtelfesltf rtru o;u4tpeoio3iyslmDua( s;u0 ltrmo3iy1fmD liesls0trxmim3oo1amtnmneta() rumx  oo0aet if3ilt a ra(mp;() leomocoo1fptelieols)seuoim ou1olt lnvta(farrm(rpnt0altniiciltlaDum(mpn() ltrmocoodop r n s;( t2urimpny4op e ncsa(faDrmu onu0alxo o3ildlaDel(mo;u0 reniociy1fmtrlnvs;s0t2umxo iy1lptelncsat aDtaxrpou0tee ii3tadfm2el( s;t0aetomr3todoaDr nvi t)sruoxrpnu4opt lfesls  ruaxm ;u0apt  iciyt s2elnmpnt4 lerxo io1oa r nvil(0 2toxr nudll n ieslt s2umur no4tet moetyt s uaumo;u0 eenmfciatomDe neils0 rur(r nudaleelncsa( srua(m ;o0apen iciyslmDumuvp;(4 eeoir iatomDrln i s t2xoio nu1lpe lfesl(fsrtm(mo;u1oleoifeiytls2rm(vp t4alenxr3oytom  anes;(  exriopio1lmtnmfei (fa2umu  no0teeo ietytlsDemumpnu0 etrxr oatfpte ues t) rtrxm oydlle lnvsasfa2rmurpnt0aeenifeilt s um( ont4altnif todla raues (0 rxoio3oo4ap   ivtlt)aDumx p;u4apx iiciysfaDea(vo ()trenir iydopD auvo;s setr(r3nydllee fviat)sDtmuro;t0texomi3iadfa ea(monu4tlenio3iadfatrlneo;s0 rxm(o nu1lmt  ivtatf rumxmpnt0tpxomi3iad s2ul( o;t)artrmo oydlaDr ivo ( srumxm3ou1amt mivt (fsDtmurpot1apt iieiytfmDuln p;t4teenmr3tytla elivi ( trxmxm3no1am   nei t  2rm(  nt4alx mf3tys s2eln on(4aetrir3oo1fptrauvsls srtrimpnu1olte fei s)aDtaur ou1tetn oeiaslsDra( o;u)tetoxocta1oa  lnes (  rtoimpoy1alenlfvslsfsruaumo;u4tltn fciys mDumuvs;t0texoxo3tadlm e ueo;t0teurir3iu1altnlfetl()srtrumoou1tlxo i3ilsfaDemnvont)treomf tydoatr nes;s seurir iu4oltemieiltfsrtaur nt1tpe  ociyt s el( p;t4trxrxf iotfat  ivo;t  rxoxr oo4lle livta(  Durxr ou4optnmociaslmDrmu o (0aeenircoy1lmDe n i;t0srtoirpnu4alen ivils  rtrx pot1opxnifciadfmDul( onu0teeoifciytlatr ies t0texmiopiu4lle  ieiltfs2rm(rpnu1oexoiieiatlmDeau o;u) exnir3iydom eluvs;s trxmxr iu4al nmfes t) Dum(mpoo0olxnmfeiat sDrm( ont) exnmrctadomDe iei s) exoiopno1am   ieta(fa2ururpnt4aexn fetytfm emums;t0texnif oatfaDean o;( s2xm(mpnu4oleemnesl()sDtm( o;o4aee io3tyd mDrlu pnu4 lxrio oydomtran ils0t2xm(m iu1al emfcsasfaDum(monu0tpxn i3tltla el(vp;(4 lxnircoatlpt  uvs;()setmim3nu1olenmncia() Durumono0tex  ieiytls2uau onu4texomf3iy1opt auvilt0s2xm(m3nu1omenlnvs sfsDur(root4apeoioeilslm2um(mpnt)aeermocty1optr uei t)trtm(rpnu1op elnetas) rrax ono0oeeomiciltlsDeauvsnu0aexoxf iytfpDelivols tetoxm ou4omtelfeias) rtmx ooo0opx io3iatfsDel( o;t4 rxomr3oy1fpte iesl( srxoxmpoudlle lneias  2tm(rpou0aetnifctysfa rl(msn(4trermr io1fmDe neo s0trumxr3nu1lpe  ivsl() Drrumoot0alx mo3iyd s2rmuvs () rxnmo ia1lpt ln slt)teuoir3ny1optn iei sfs2uaxro;o0teenmf3ils s2umnvs u0 lenircoodfa r iei;s t2xm(mpnodomenmnvs () rrr(rpou0tpt iicilsfaDumuvo;()tetnxociadlp rai i t) 2urir3io1lme  neslt arraump;o0opxnmoeiadlsDra(msnu0 lerio tatoa e iesls0 etm(m oy1lp e ict t a2rr(moou0oetnmf3ilt a2uanvont)alxnio oydlpDeli s;t)sexoxm ny1ap   fvsatfaDrmuro;t1oetoio3iatlsDeanmonu)texrio3ia1fmDran o t0 rumiopny1lp n fcs t)aDurumono0apt moctasfm2ulumsn()areoioctydfmD auvi;s0setoio3iu4om elnvil(fsrtrx  oo0olt  fctldfa2ra(mp;(4arerir io1fm e ieols setoio iy4am e fesat  rtmx ono4tex  feias m2emu ont4trtnio3iotlpDr u ils) eum(r3nydomtelnvt (faDrau pou1tetn f3tad m ra(ms ()altrxfcoatfpD lnei s0sexmxmpnydam   icta( s2umxm ;o0ale ifetasfa2emnvp;(0 leoxo3oatlpteauvo () 2trim oy4optelfviat)sDurxmpno1tpt ioetltfa rlnmp u0aetoio iy1lp e ies;s t2xoxr3nodlle livtasfs2tau oou4aetoifeiydfaDulnmsnt)tltrirciodfpD  u i;s trtmxm3oy1ol  mnvil() rtru  nu4tpxnmfeiltfsDua(vpn(0tetrmo tytfaDr ivi t) rurir3iodamee fetltf ruru  ;o4aexn ociyd m2uln onu0 ltomf iatlpteauei t0sexmimpnu4apenlicslt)srtm(r ;u1ale iiciatfa2rlu onu) etoiocoodlm eanvi (  2xrxm3iu4ol nmfvs s  rum(r ;o4tex  ociydfa2ranvs;t) eerxf3tytfm e iei;()setoirpiodlpeelivia(faDtaxm ;t4tpe moeiltfa ean p u4arxnif3totoatelieol()seumxm ou4lmeemivt s arua(rono4oleo f3ilsla2ua( s;t0arxrifciydlpt  i i;t0teumxopio1aleelneil( sDtaxmpou0apx  f3tld aDrmnmo;t)tetnxo oadop   ivi () etoirpiodomtemfvtls) ruaxrpno1aexo i3iyslsDul(von(0alenxr3to1omDrlnei s0t2ur(m iy1ape livt (fsrua( ooo1aptnmieiydfa2rmu s u0 etoxrctadla elueo;t s2xr(o ou1op   icta(farumur nt1opeo feiatlmDuanvo;u4tleniocoytomD an i s)srtrxo iydll e nes s)sDrmu p;o1alxomi3iltfa ulump t0arxoxf ta1faDr n i;s0 2tr(o oo1lltnmfctlsf Draxrpno4opxoifeilt s2uau p;t4artnxocoodomtraues;(0s2umxo3iydlp nmici s)sDrr(r nu4aex ifeiad m2elnvo;() reoxo3oatla ran o;t s2xrxm nu1am e icta() 2umx poo0ale mo3ilt s rln s;u4 eerxo oatoaDe nvo (0s2umim3iy1opt  ivsl( a2rmurpnu0tpt  i3tlt aDeln snt)altnxr todoaDelnvils  exmirpny4amt  ncta( s2raxmpou4aexo oeiytla emnmo u0tetnmocio1fp  aivo;t)srxmxm3iy1ole mncilt)sDumxmont1tetnif3tadfm ea(ms t4 reomo3ta1fa rlivo ( s2umirpoy4opt lfvias srrru p;o1apeoif3iadfm2emuvpnt) rtomoctotfm e ues s trxrxm3iu1ole  ivsas  Dur(  nu0tlxomoeiydlm ran s u4 rxomocoy1lp r uvs;s)sexoimpoo4ap nmnctls arrmxmpoo1opt  i3ilt s ulnvo;u)tetnif3tytlm r nes;()trxoio nodaptelfei tfs2ra( ooo0tlxomictys mDra(mont0trtniocoytfatr ues;s t2tr(rpnu4lmtn nei ( srtmu oou1aetomi3tys m2umuvp;u4teerxfcto1opt aivo s s2trir iy4lme  ncslt)a2raurp;o0tpt ifeiltlm2ua( o ()tlxrio3iydfaDrai o;s) 2tmxr oo4ll elfci ()srum(rpoo0alxnmo3tytlsDel(mo;u4texoiocoydfa eanvs;(0t2xmxm3oudlltn ies sfsDuru  oo1apeniieils s2rauvp;t4artrxrcio1lpDeanvi ()srxrxo nudlp  mivsa()srraumont0oeenmietadfmDuln o () eerir oodoatraivols setmxm oy4lp  lfvi (farta(mpno1tet iictat aDumnvs u0tetnif tatfatr uvils0teur(opiudlmt mnes (faDrrumo;o4apxnmictatlmDuauvo u0 eeoxr iodlm  aies t)sexoxmpiy4am nlfcsl(fsrraxmpoo1teeniocildfa2ulnms;u4 rermo3iy1faDe neil()seurir3oydope licsl(  2taurp;o0tptnmicilslmDrm(monu0tltrir3iytomt anei;(0sruoio ou1lpe  netltfaDrmur ;t4teeo f3iatfmDra(ms ()artnmf oydlmDeaneolt t2xoio3ou4omenmfctls sDrmuro;t4tptniiciysfmDrmums;u4aleoxrcoydoaD aivs ( srtoim3no4ope lnet ( s2umxrono4optnii3iat m2emumsn() rtnxr3tytop r i o s0 2uoir no1olenlivt (  Dum(rpou1tlto fetydfaDumu sn() reoxrcoy1oat auvs;(0t2tmiopoodlp  micia(fsDtmxm no1tlxn fcils sDrlnvonu4 lxrio ta1lmteaivsl(0setmir3oo1aleeliei t)arumxm ot4aetoiiciydfsDuln p t0 rxrmo3todfmt  nvi t) eum(o no1op nlivtls)a2umum ou1aleo ieiadlsDem(mont0trtrmocoydlm rai ilt)srtoir3iydlpte fvt sfs2rm(m no4tet moctyd a eau snt4alxoif oy1lat  u s s0srtrir3iydlmenlneia(  Drm(mo;t4aeen ocildla emu o;() ltnifctatomDe ies t0 ruoirpoy4om nlicsl()srraum nt0tpenmfeiyd s2ranvp;(4texomrcoadoaDrli s t)srxrxo nodap e nvsls sDtau ono4alx  oetls aDuanvo;()aleoir ta1latrauvolt) 2xm(mpoo4llenmnetlt a2tmumont0oee  o3tysfa2ul(mo;u4aetrmr tydomD auesls  exrxr iy1alen ies s sDtr(monu4ale mfctas sDua( ont4arenio3ootopD luvo t) 2urxr oy1alenmfvsl()a2ta( o;o0tetn ieiyt aDulnmsnu) lxomr3iotlmDe ivo;(0s2xm(mpiy4am n fetl()arraumonu0opeomieiadls2ea( ont0altnmfcia1lmtrauvsl(0t2xoxopiu4alte ictat  2urum ;t4aptoii3tyt sDel(vs ()aexnmoctydfpD  ivsls) 2umxo3oudap   ies ( sDuaxmo;o0aleo oeiat aDumu p;u)tltnxr iadlaDranes;( trtmim3iy4llt lfeilt aDtmx pou4teeo i3iatfmDuaums;u4trtoxr3ty1fpt lnvil()setrio oodole mfvi ( a2tru  ;t1tltn oetyd m um( snu)altrmo3oa1lmtr ueo t) etoxr3oo4lpenmicsls)a2ua(  nt4aleoif3tydfm ranvp;t)trtnxf3ootoaDrauvil()s2xo(opiu1aleelfvsas)aDum(moot0altnmfctasfs rmnvp u) renxo3todlpDe ieo;t0 rurxopno1amtnlivsls)srtm(mooo0tpx ifciat a ra( p t0alermfcoydoptean o t)s2tr(r3iy4lm nmfvslsfaDtaxr no1tetomf3ild mDrlnvo;u0aeenmr3oodopD livo;()s2xr(m iy1lpe licsas) rum( pnu0tpxnioeiysla elumo;(4 eerif oadop eauvs;s0 exriopoudalte fcsas a2tax pou0tpt iieiytfs2uanvont)aetrxo3io1latr i i;t seum(r3oodol  lfvsltfs2uaur oo0ole ioctydls2rln p;t0 rtnmo oy1latrli s;( srxmxr iy4lmtnlivtl(  2tmxr nu4openioctas s2ul(vs;(4alxnmr tatoa  auvi;(0teto(opio4apeemnvsa(fsrraxm nu0olt if3iydfm umn o u)tetnxocio1lm elivi;t trxrxm ou4lmee fvils)arua(r ;t0olx mfctytlm ulums;()arxoif3ta1om e nvs (  2uoimpno1ap nlictlsf Drr( p;t4olxn fcildla2ua(vo u)tleoxo3oa1fptrlnvs;s trxmio3nu4lpenlivi () rta( oou4oleoiocils s ua( s (0arxrxo to1oa elnvo;( t2ur(mpiodalenmies t)srrrumont1olt  ictasfs ra(mpnu4 ltnxo3oy1om e n i;s0 2xmxm3oydol   nvi ()aDrmu o;u4tee  o3iat sDra(vp;(4aleoxfciydlpDrlnei;s)s2tm(r3nu4amen icsl(  Drm(mo;u0tetomfciydlmDemn s u)alxrio iy1fm  ai s (0t2xm(opio4alt mfvi t s2rrx p;u1texoiieiltls umumont4aexriocootfaD  u i s seum(mpny1am emicsl( artrumono4olxnmi3iltfa rl(mpn() rxoiocoa1omt anvi t)t2toxr nudalt lics s s2ta( ont1apt  feils m uluvo;u0areoirctadoa  aneo (0 2umiopiu4alen nvtlt)s2ua(r oo0tptomociys m2el( p;t)aeenio3oadfm  lu ols teurxr iudlm e fes (f rtauro;t1olt ioeiat m elnvs u0 eerio totla eaneo;(  etrxm3oy4lpee nesas) Dum(mpnu4tlx ifctyslm2uanvsnt4 exrifcty1la r i o t setmxmpou1aptnmnctlsfsDra(mp;t4altnio3tatls2raump;t) exoxo3oa1fatelueo () 2xmxrpnu1lpe mnciasfa2uru o;t4oet mo3tasfa emnvp;()tltnif3tadfaD aneo ( sruoir oo1amenmnvta(farrmurp;u1aeto icildlm2uanmo () rtrifciotlpteaneo;s)sexmim iodalt  ivs t sDuax  no1alx  fetadfa2rln o u)aeeomr3ta1faD  uvi;(0s2xmxmpiydoltnlicsa()aDra( onu0ale ioctyd m2rl(mp;(4aleoxo3iotfaD lueolt0 eumimpoudap   ivsas srrmum no1tpx  fciytfs2ul( pn(4trtrmrciotlpD  uvilt0tetr(m ny4am  mnetls)sDtrxmooo0tlx  oetydlm2umuvo;u0alenmfcta1opD luvsl(0setrxm io4opt lfvta()s2ta(r no4tpen i3ias sDeauvpnt) rxnif3tydfa rau olt)s2xrxo oy1al  mictlt)aDur(r ot0teeomf3iyd aDrau on(0aetoiocoytoatranes;(0t2tmxm3io1llt liviatfsDurur ;t4tet  feiasfs2umuvon(0alxrxrcoatomDeai o;s)s2toxm3iudole mnetl()s2tm( pou4tpe miciltla2eaumsnu4texnif3iydfmt aivsls t2tm(mpio1lmt lnci (farurxmp;u1apxnmfciat a eanmo;(4trxrxr iadlatrau o;t srxo(mpio4open ict sfs2uru  nu0teeo o3tld sDrm(mp u4artrmocta1oaDr ieo t trumir oudaltelnvta()a2rm(mono0olt ii3tydfs ra( pnt4 leoxocoydlp r uvil(0srum(o3nu4ap nlnctls)aDtr(m no0apt moeiydla2emumonu0alxoxf3tadopDeli s;s)sexo(opnu4olte nvsls) Drru pnu0oltnmfeiatfa elu pnu4texrxfcia1fmtrliei;(0 eurimpoydlptelictl(f Dta(m oo4oeenmociltlm2uau p t) rxomrciytoa r uvolt trxrio3iydapenlfcsls)sDtm( oot1tlenmoeiys a2um( pn(0tltoiocoo1oa rliei;()teum(r3io4omtelnei sfsrrau o;t1tpenifciysfmDuanvont) rtoir3iytlpte neo;s0srxmio3no1olen ncsl()sDururp;u4apt moeiltls umuvo t)teenmrctotlatrau o;s seurxrpno1ll  mnet s aDtrxmp;u4aex  ieiys aDemuvpn(4 rxnmf3to1oa   i i t)t2xo(r3no1om emfct ( aDuax pou1aet mi3iyd s rm( o u0 eenir3oa1fmDean s t t2tmim oodalen ncil() rurxrpnu1olto feiysfm2um( snu) rxomr todlm eaiei t0t2uoimpoy4alen nvia( srumxm nt1texnmoctlslm2ranvs;u)alxnmf3oytlate uvi;( trur(o iu1aptnliet t  2trx o;t0tpeo ieiatfa2em(vpnu0trtrir oytfat lnvi;t0s2urimpoudalenlieia()sDra(root1apxoii3taslsDeanvs;t4 rermo tydlm  anes s)srur(o3oo1ape  fciat)srtrxmont1teeomiciyt a2rmnvp u4teeoxoctodlpDean i t0trxoxr3ou4om emfeiat a2tmx p;t0aexn feildlaDel( p ()aleoircia1fate uvil( srxrirpiu1optemfesasf 2ua(mpou4alt ioeiytlaDranvp;t4 rtnmocty1opte u il(  2tr(opno1alt  fvsa(fs2rrurooo0tpe mfctls a2rm(von(0trenio3iodopDrauesl(  2xo(o nudlpee feilt sDrm( onu1tptomf3tlsla2uau s;u)alxnxfctytoatelieo;(0tetm(m io1lpe  ncia()s2tmxrooo0tpxnmoetytla2ul(ms;t)trenxr oodfa   nvs () 2xrim3no1lleemictat) Dtmu o;o1tleoii3ilslm2eaumo t)altrio oydfpDr nvi s srxm(r io1ll e nvs s) Drmu pno1oltnmfeildla ra(mo ()alxrxf3oadlmDr iesls tetm(r3ny4lpeemfci tf rra(m ;o1opxomfeildfm el(vo;(4trtrir oodlaDraivs;(0 etr(m3no4amt  fetls)sDtmxronu4alxnmictytfa ul(mp u4 etrifciy1lmt an s s0teuoio iy1ol elivtat)arumumo;t1tlenmiciys s2ea(vont)aleoif3totlaD  ivi ()teuoxm iu4op nmfcsas)aruaxmono1aee mi3iat aDemn s (0texrmocoa1fa e neo ()texoxmpno4amee feiasf 2rm(mpou4texo icildla rmumo u4artrxoctatomDelivil(0 2xo(rpiy1lltnmnvt t)s2truroot0aptnmo3iysla rl(mpnu)arxrmf3tadfaDr ies;s) 2toxo3nodol elncias  rrru onu0aptn i3tad s2rmnmp;u4 rerio3oodfatrau i;t s2uoxopoydoltn iesatfa2taum ;t4tet ii3iltfm2ranmsn(4artomrcootom r ivs;t) eto(o3iydlpee netat) rrau  ot4opxo f3ildls2em(mpn(0trxoxf oy1fa r nvs;t)trtmirpnydop  livta()a2urx oot1opxomoeiyd m rl(vs;u4tlxoircoydfaDeln s (0teuo(o3no4am  lfviat) Dra(r ;o1tee iieiytfa2em(vs;t0tltniocootopD  ivs t0 rxrxmpnu4omte nei s s2rmu  ;t1tee iieildfsDem( s t4areoxr3iytomtraiei t)srxo(o3ou1lpt  nctlsfsDraxmo;u4tex  iciadfa2el(vsnu4aetrxf3to1oatrlnvi;()srxm(r nu1lp e fvtas sDrru  ;o4optomoctltfa2rmump (0 leomf3iadop r u s s  rurxrpoydam  lfci s aDuaur oo1tex iiciys m2uaumont4 ltrmr3to1fp elnvs t) eurim io4om  mnetlt  ruaxmp;u1opxn fetadlsDul(mp;u) renir oy1omD lu s (0 rur(mpiy1amtelfvs (f Dtauro;t1oet moctadla ea( p (0 ltomo iatlateli i ()setm(o3oodam elnet sfarra( ono0alxo feiys a emn p;() lerir3iy1om   nvsl(  rtmimpiu4alen icsat) Dua( p;o1tex io3iytfs2ua(ms u0 rxoxr ta1fatraneils tetoxmpoy1lm   icil(fsDtaumpou4aleoioeiytlm2elumon(0 eeoir3oodoatrln ilt)sexo(o3oodapt mnctatf 2tr(r no0tpxomi3tatfsDemn p (4alxnxo iatfa e i o;s texm(o oy1apenlneil(  ruax  ;t0tpx mo3tldfsDeanmpnu4treoxr iytoat anei s0trtrxm3oo4lltemfet (  Dur(m nt4aeeoio3tydfaDuan p (4 lermr3iydoptr n s;s0trxmio3iu1lmee nvtat)s2ua(mo;u4opx mo3iysls rln s t)alxrircia1fmDrlivs;t seur(opno4lleelncia( arurum no1alto ieiysfs2rl(vp;(0tltrio3iadfm  luei ()t2um(o no1lmtnmfeiat  rtrum ot0olto i3iydfs rluvont)treoxf oadfatraivi;() eumxr iodlpte nvsa()a2umx p;u4alx iociytlaDrluvs u0aeeniocoytopte ieo;s setm(o3nydal nmneta() rur(m no4alxn o3iyt sDel(vp (4 lxoxr3oydla eau o t srtmxr nodaptelfeilsfsDrmxrp;u0tlxnif3ilsfmDel(von()artrir3ty1op rlu s;()trxrxmpny4al   fetat) 2ta(rp;t1opx ifciytfs umn p u0 etnmr iytomteau i;(0 etmir oudopeemfes sfaDuax o;u0tlx mi3iytlm2ul(vpnu0alerxf oy1lat lnvi t)s2tmxm io4lpeelneia() rrm( o;t1oltn ietat s2um(vs (0 lxoifcoatoaDe u ils0seumim io1amee iciasfaDrmx  nt0texnifeild mDumu snt0 etnmr ootfaDrauvi ()s2umxmpio1omeelieiasfsrur( o;o4olxnmociat s2ulnvont4alenmociodfmt luvol() exoim3nu1lltn ncia( s2raur ;u0tltomocilt m2eanvs u)treomrciatfatr ieolt s2ur(o nudolee feia(f Dtrxmo;t4olxnmfeilsfs2elu pn(0aexnxrciadla r n ilt0 eto(m iudol e fvil() Dumxr ou1tpt iiciatlm2elu o;u4altrxo iytomDrli ilt  2xr(mpnudopen nes s) rtau onu0apxnmf3iysfm uln o u0tetnxf oodfaDeli s s t2tmxopoodlptnmfctlt)srtmxrp;o1aex moetys m ranmo t4alxrxr totlpt  n ilt)trxrxrpio4ole mfvi s aDtmxmo;t1tlxnmieilt m eanmo (0alxrxoctodom r ueols)teuoxo3ou1amtemnetlt) rrr(mooo4tlxnioetlt aDea( ont0teeomr3todoa r uei t truo(m3ny1lp  mfesltf 2raxrono0aeeoif3iysfs2ea( onu4 lenircoa1fmD lueolt0 rtr(mpny1lp nmfcils aruax  no1olxomiciytlm2emnmo u0aexomoctydop rluei s srxr(o io4lmt  ivsl(farumxmp;t0ope mf3iad a2umnvp;(4 rxnmf to1laDeln ilt)t2xoxr ny1lpe mici s  ruaumo;o0teeo ieiltfa2ua( p;(4tlerioctydfp  li s () rxmxr iy1optnliesasf rrrx pot0optomi3tld mDuau sn(4treomrciydomDr n s ( t2tmim3ou4lm elfvsasf Drru ont1alenifctld aDra(vo;()aexoxrctotfateluvs;t)texo(mpoudlp   fes tf Dtrxronu0oex mictydlaDem( o;u)aexnmocootfate uei ()srxm(o3oydlm nmnvia( s2umurpnu4opt  icias sDemn o (0aetnif3oa1oaDr n sl(0 2toxo3iydapeelnct s) rrax p;t0apxomo3iytfaDra( o;u)artoxfcoatla r nvs;s setoxr iydomee ics tf Dumu p;o1aeen iciadlaDra(mo;(4aexriocoy1fp   n o t)srtrxr3nu1amtnmiesas arra(  nu4opt moetysfs2emnmo;t) lxrio oatoat lnvils) eurio oo4lm   nei s)sDta(mpou4tpenmf3iltfm rmu pn(0alermo3oytfpDe n i t)tetrimpnu1lme mfcil()s2rmxmpoo4texn ociydfm ua(mp u)tlxomfcoa1oa eli i s) rtoxr no1lpenmfetatfsDrm(ronu1aee ioeiysfaDrm( snt4 ltnxf iy1fmDranvo s srumxm3ou4lle mnes ()a2rrxmpou4tetnmfeilslm2el(vo;u) exomr iodop r ueo s)tetmim iudlp  lfcsa( arum( oou0optn o3iyslaDulump u4trenxr3iodoatr nei t  rumxmpou1lm e fctas  rra(mp;u4tpenmoctat s ul( onu4aetrircoytlmteanes t0s2umiopnu4op nlivt t aruaum ot1alx mo3ildfmDrauvp;u4trtnif3iytlpDeaivi;t)s2toim io4lltnlicsl(  rta( oot4aptn ieils m2rm(vo ()treoxo3iadoa r uvolt) rxmxm3nu1alenlnvta(faDrau  oo0oex mo3tyd a2ulnvsn(4tlerxocta1lpDraieo;s)t2xmio3iodlp elfvt (  2rrxmp;u4oeeo o3tasla2emnvpnu) lxoxocia1oaDe u ilt0s2xr(m oo1lpeemfvs s srum(mont4tpe  oetyt sDeanmp;t)trxnmfcoytfaD li s;s  2uo(r3iu4ope livs tfa2ur( pnt0texnmf3iltfm2emnmp;t4 etnxo3oo1fmt ln o (  ruo(mpoo4lp e ieias)aDuaur ou1tet  o3iltfsDemu p;u0teerxr ia1fmt  nvs;s  rur(rpoodamee ici ()arumu pnt0olx ioeildfm ulnvp;u4 ltnxf iadfat aues t0tetoxm3iy4ll nlicslt)artmx pno0olenifcilt aDrln o (4aetoxf3oydomt livi (0t2xmim3oodlpee ivsasf Dururp;u0tpt  oetytfsDrl(mp t0aetrmf oo1lm e ivi t texmxm oo4alenlictat  rrr(m ot1aet ioeils m2ea(mo;u)texoif ootomDr u sl()s2tm(r ny4llenmnvtasf ruau ont4ale  fcils a2um( p;u) renxr tatfaDr n i (0 2tr(mpoudlpte iviltf 2ururont4ole io3iasfm ua( p (4trxrxfcoy1oatrluvi (0srtm(m3iudal  mietasfsDuaxro;o4oee  fetls s rln pnt4 etrmfcootfatrlu i ()sexm(r3oo4ap  mies tf Dtrx pnt4tlt  ociltfm rm(mp;u) rxnmf iatlatean sls)texrxo io4lmeelnctasfaDrrxmo;t0tlxoiocildfm2ulnmo u0 rtoxo3ta1lpte neo;t t2ur(mpoy1lp emfcils) Dum(mpnt1tle mi3tas aDrl(mo;t0 rxnmfciatlaD  ueo t)t2um(m no4apeelfetl(  Dum( poo0opxnmfeiydfs ua(mo;t4 rtnif3iydoatrluvi;t)sexrir oydam nlics tfarrr(mp;t0aexoiiciadfsDrmnmp;u)alerxf iadopD ai s;t t2xmir iy1opt mnvi () Dumx  nu4tpxo o3iyt m2uaumo () rtomrcoa1fatrln o (0srxoxo3no1ame livil()sDrrx o;u4ape iiciytfm rln p;t)alxrmrciytfm rau slt0texr(m io1omt lfcsl( a2rmur nt1tee iieiadfm eluvsn(4 ltomo3oadfa   u i (0trxrxo iudomenmnctl(  2um( oot4texo fciasfs2eauvont0 etnxo3tytoaDr u o;s t2xmimpiu4olt mfvsltfaDrr( poo1aleo fetyslsDuau p;t4 rtrmrctodlm   i o ()trxm(o3oo1open fvtls) ruaurpou4tlt mfeildfm um(ms () rtrir3oa1fatrlnes s s2xrir3oo4lme mnvi sfarraxmp;o4tpt  ietatlsDranvp;u4tetoir3oatopDr uvi s0s2uoxmpiudlmtn nesa( artaxrp;o1apx mociatlm2el(mp;u4aexrir ia1opteau o;t)seum(opny4lm nmfes tf 2ta(mont4aleoiietysfaDranvp (4trtnxfcoydoatelieo s)t2xoxo3iodlmtelivtlt) rumxmpot0apxo i3iadfaDel(ms;u) etomo3totlpD  ivolt0 2toxmpny1ol nlfeslt) Dum(m ou4teeniicildfa2emuvsnu4arxrmrciadoa   uvi;()t2tr(r3oo4opeelieslt arrrxmp;u1openmi3iatlsDumn o u4 eeoxo oodopt  ueilt trxoxo3oo1lm e icsasfa2ta(mpnt0olt  oetls a2rmu sn() etoxr3oy1oate nes;(0teuoim3iudll emnetat)aDrr(ro;t0ale  o3iatls2rmu sn(0 lxrio oatopDrlnvi;t0srurxo nydolt mnei tf rrr(mpnt1oet iiciys s2uan s;t4tltrxr3ty1lptrlieo (0trtm(o3nodlpeemfcil()a2trum nt4tlxoifctltfmDrm( ont)artnif oatoa  aneilt0 2umxopoudlmenlnesl(fsrrmuroot0ole  oeiatfmDelu o;u0arenmrcoatfpDeauesl(  etr(r io4oltnmnvi sfsDrmx o;t0ape  octlt sDrmnmo t0aexrifcio1lpDr u o ()sruo(mpoo1am  mnvsl(  Dtr(mo;t1aee mieiadfsDulu pnu4artoif ta1faDe ieo t) 
\ No newline at end of file
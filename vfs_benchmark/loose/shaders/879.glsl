@@ -0,0 +1 @@
+nes;()sruoxopoydolen ivsa(fs2taumo;u1ole  f3tlsfs um( p (4treoxr oa1oaDeluvsls0 eurxr oo4am elnvt (fs2trxront1tlx  ietlsls2el(vo;t) etrmf oatopD  nvs;s0seuo(rpoydale lnvsa( sDtm(mpno0oex  iciad m uauvs;u0alerxf oadfmD  uesl(0 2urxopoy4ll n fei ()s2tmump;u0tpe  oetyt aDem(vonu) lenmf totop elivols  rtmxm3ny4op  mnci s) Dtrx onu1ale  f3iys mDumn ont4trxoiociytlm   uvil(0teurxo3iu4ale  nvs s)arraxmooo4optnmfeiysla emnvo (0 lxnxo3iotom   ueols trurio3iy1altnmiviltf rrr(m ;u4ale mfctlslaDuanmp u)aexrioctadoa e ieilt s2tr(r oy1llte nes t)srur(ro;o4tpe  f3iaslm elu pn()aeerxr ootom eli olt)s2umio3io1ape livtlt  2urxmo;o0tetoifeild m umums t) rtnif3oatfat ai o s texrxrpiodlmt liei (f Dtru onu4tlenii3iad mDea(vsn() rxrmo3io1oaDrlieo ( s2xrxo3nu1apeelnei t sDraxmpno0aeeomi3tytlm2umnms;u)tetrmf3iydfptraues t0 etoimpnu1lpte neil(f rumx pno0open i3iat sDuau pn(4 rermf3iatfp rauvi (0s2xo(r3ou4am  livia()a2uru  ;t0tex io3tldfs emnvo t4trerirciotlm e u o (0s2xo(opno4amte neta(f Dra(r no1olx moeilt sDumnmo u)areoxf3oydfaDeluvols srumxm3iu4lmt lfvt s)srtr(m ot0tet mo3iaslm em( snt) reomocoy1lpDranvs;s)t2um(r3oy4ope  fvs s srrr(r no4aeenmo3iad a2ea(mpn()artnif3todfpD an i () exm(m3nodaleelnesl(fs2ur(r nt0aexo icilslsDra( p u)alxrxr tatopD luei;t  exo(opiudlmen nvt ()srua( o;o4alx  ociltlsDumuvo;(4aexnxfcootfa rauvs;t  ruoir oydame  ncta(fs2trxm nt1aetoifcilt m2um(vpn() rtrmr3ty1omte neo s)srtr(rpiydamtelfvtat)s2trxront1alt miciydfsDem(msnt0arxomo3iotlmteaies ( texmiopny4ap elfcs s aDraxmont0tetnifctaslaDra( p (4aetomf oytfa r n s;s) 2tr(o3ny1ol  licil() 2tmumonu0ole iiciadfmDemuvs () ltnmr3todfaDrli s () exo(mpny1olee fcsat) 2taxm ;t1optn ociyd aDel( snu4 leomoctatfaD  uvs;t) euoir3iudoleemnetl() rtrum ;t1aexnmo3iydlsDea(vs;(0tlxrmo io1oa r u o;(0s2uo(r3no4ape lfes tf rua(mpoo4apx iictls mDrl(vsnu)arxoir3io1fateaivi;( s2xr(r no1open ies ()sDtrumono4altnio3tyslm2elnmp;u4 lxomo3tatlmte n s s0 rxoim oudolte ivsa(  Duru pou1tle mo3iad s2uanmon(0 lenxo oy1lp  aiesl()trurxmpnu1omte feias)s2rr(ronu1olx  ictydlsDulnvonu) exnir iodopte uesls)trxo(o3iu1al e nvs tfarum( pou4tle  ictadls2uanvp;t) rermo oadfatrlivsl(0s2umim3ou4aptemivilsf 2raxr ;o4oexomfeiasfa2um(mpnu)aexriocoatlmte nvs s  rto(o oydlptemnctat) rrrx o;u1tee iietad m2ul(vp;u)alenmr3tytla  aivsls trxmxrpio1ame miei t)s2rru  oo0teen ieiysfmDulnvs;(4aexnxfcty1oaDran il(0srxoim3no1om emics ()srrrxmo;o4opx ifeilsfa2ra(vo u4arxnmf tatfmDeli sl( seuo(m oo1apte neslsf rumx  ;o1opt  oeils a2um(vo;t)texomo oydfat luvslt)teuoim3ny1lmenmivsas) 2tmxrpnu0tpx mo3tys a2um(vpn()tltoio3oy1opD anei t0t2umxm3iu4lp  mnvsatfsrum(m ot1apxoiociltla uanvonu4alxrxf tatlmDeaieil( seuo(o3iudll nmncta()arumxmoot4oee mieiadfa ul(mp;t4aetnif iy1faDe ies;s) rtmir3oydom e fcs t)sDuauro;u1texnif3iatfs rmumonu0 ltoir ty1omDraueils0s2uoio3ny1lleelnvtl() rum(rpou4tltnmfciysfs2rmuvo;(4artnxocty1oa e u o s)s2to(opiy1lmt mfcsl() Dumuro;o0alxo f3iltfs emuvs;() eeoif3tatomDraueol( setmir3oo1ol e ncilt) 2rm(m oo1ape mi3ildlm eluvonu0 rxnmr oo1laD anes;t0truo(r io1oleemieilt)aDrr(m nt0ale  f3tadlaDulnmo;(0altnio3iatlp ranvi;s0t2xo(mpnu1ame lics s sDua(rpnu0tpeo oeiatla2rln o;()teeomo3todoaD lu i;t tetmio oo4omtemfcs s) rua(m oo1alxoiieiad mDrl(vpn()tetnmr oytlat  u slt trxm(o nu1alt mfct (  2rrum ou1aptnif3ilslm2rauvon() lxrir tytfateln o;s0 rtrxo oy4llee nvias)sDururpnt1tle iociytfaDelnvsnt0alxnmf tadfatrlu i t)trtmxo3iy1ap elfvs s s2rax pou4opt  ociatlsDrl(vs t)alenmr3ootfa rlies;( srxoimpoudlpeelnvt t)artaxmp;t4tleoifciys aDea(mo (0trxrxf todla  lnvs;s0srurxmpio4al n fctl(fsDraxro;u4alxn oeiydla rluvsnu4 renio3oadfptranvsls)tetm(o oo4oltnmnvt s aDuau pot1ope  oeild sDuanms t0tetnir3io1oa e nesls) eto(r iudap eliet ( artmxrpoo4tlt  ictasfaDraumsnu4aetnmfcoadfm  aueo s) eurio nu1omtnlivi t)a2rr(mp;u4aptoiictysls2ua(mo t0tltnio3oa1fmt  u o;t s2uo(mpoy1am e fcilt)arumxm nu1optoio3iatfsDea(mp t4aetrirciydfp raivs ( trurxm iy1lptnlicsls)sDtmuro;u4altnii3iltfm2ua( s (0 rxnxr3iodfaDrauvs (0seumxo io4oltn fcia()srtm(m no0open iciasls uau p u)artnmf totoateai ilt0trxm(mpiudap emivt t sruau pnu4ale  iciatls raums;(0 rerxo oatlpDeaueilt0 2umxo no1omenmfesat a2ur(root1ale mocildfm2rm(mp;()teerifcio1fmte ies ( t2umim3iu1ll   fetat  2ta(mpot1teeo ieiyd sDrmuvs t4alxnmr3ia1opte ieo s)teuo(opou1alen nvtasf Drau pot4oetnmfcilt s rm( pnu4 lxniociadfmt  ies;t  eumimpiy1omen ivi t  2rax p;u4ape  ietasfs2umn pn(0 lenio oytoatrlnvsl()setoim oy1ap   iei s)sDrmxm ot1teen ocias m eauvo u4alxnxr ty1opt  ieils)sexoxmpnodapeemnvs ()srrmxr no4teeoif3ildlmDum(mont0altnxr3iotlm  ai ol( s2uoio3oodalenlnesls  Drmxmonu1tlx  fciysfs ua(vo;u0alerxfcoydfm raiei;t)seurir ny4llenliei t  rrr(m ot4teto fetasfm2emn on()tetoxf ia1fm rai o;s0trxo(r oodlpenlfctls) 2rru  ;t0oltomfeiltla rm(vs;u4artrifcoa1fa raueils)tetr(m3iydomtemicsat) 2tr(ront0aetn feiadlm ran onu0 rtoif oytlp   neo;s0srumimpoo4lmeeliet t sruaxr nu1aee mf3ils s ranms t0artnxfctydfp eaies;s t2to(o oy1lm  mneslsfaDta(mono0ape mf3tyt s2rau p u0 eerxo oo1omteauvi s0s2xmim3iydll e fvs s) Dtm(r ou4oltn ociasfmDea(vp;u0aleoifcia1fmtrlnvo () 2tmxmpiy4lptn feil(  rumum ;o1apxoiieiasfs2elnms;t0 eerifctytoa raues;s)setmxrpno4om   net sfarum(mpnu1oet  iciyd m emu snu0 rxrxf iydfmt aueo;t0 2uoxrpio4lptnmiet sfaDraxroou0tlx io3iatfa2elu p t)trxnmocoydfpD  nvs;( sruo(m nydape lncias  2ur(mpou0alt miciasfm rln p u4aleoxr iotlateaieols0 rxrio3ny1op elivi ( s2rauront4tex  i3tltfs rmnvs t)artnmo oy1lpt livo t0trxo(m3oo4lp  lneilt)srtm(rpoo1alx  i3iydfsDua( o;(0texnxocoy1la raieo t srtmim3ny1ale mnvs s s2trx pou0oexn feiys m em(vpnu4 etnircoodlpte nvi t  euoim nodap  lfeils aDrrum oo4aptnmfeiys s2umnmsnu0trerif ia1faD aneilt  eumxr3nodope lict tfs2ur(  ;o0ape  o3ias a emnmo t)tleomo3oodfa rln i;(0 rumxmpoudome mfvs ()sDtm(ro;t1aptniicils aDua( p t0 rtnxrciadlaDr n o t0teurxr3iy1amee ivtatfaDrmurpnt1tlxnifciydfm em(mpnu) rerxf iotoat  ivi t t2xo(o3no1om nlnvtlsfarrm(ront0apxoif3iltfm2rmnmont)texnxo todlp e ueslt  ruoxrpiu1ame  nct s)s2ra( ooo4tptnif3iydfaDumnmp;(4 rxnxo oadlat an i s s2xrxo3oo4lm nlivslt) Dra(rpnu0alto fetysfm emnmsnu4 ltoirctytfm rlnes;s0 2xoxo nu1am nmfviasfsrur(moot1aleomo3ilt m ua(msnt0aexrmf3oadom eln o (  exoxr3nydlltnlivta()srtaumpoo4ape ifeias mDeln p u4 reoio3totoaDr ieols  ruriopnydllenlfviat)aDrrxm nu4aexo fctld sDua( on(0tetomf3tydfpt lueil( s2xrxo io1omtelfci t)aDum( ono0aetn iciasla rl( pn(4trerirctodopteanes;(0t2trim oodll  lfcsltfsrra(m ou0teto fetldlm rm( o;()treoxr ootlaDelies;t)t2ur(o nodom   iviltf 2uaurpoo4olt  oeiydfsDem( s;()trenif iadfaD  u ilt  eur(r3nu1lltemfetatfa2ur(mpot0teeoif3taslmDulnvs t) eenmrcty1lpt lueo;(  2xrxm3ou1lltnmnes (fs2rrum ;o4tltniicilsfm eanvo (4tlerxo oytfmDrau i;()seto(o3oudlm  mfcsat) Dtax  ;o1tpt mfciytfa em(vonu) rtoxfcoa1lmDr ivi s t2tr(o iodom e fetas) 2ua( p;t1aexn fetlslsDel(vonu4altnmo to1la   neils0srxr(opny1lltnlfetls)sDtau poo4opx  o3iatls eanmp;()aexomr oy1op raiei;(0setmxo ny1lme lfvils)srrmu ooo0tlxomfeiysfs2ea( on(0alxomf tatfaDr ues;(0 2xr(o3nudamtnmnciltfa2rrxmpou0tpe mfciysfaDulnvo;t)teenxo3oadlat lnes s0srxo(o3iodam  mictatfsrtaxmpot4tltn f3tysfaDrlu s;u4teenxr tadoaDr neols0seumxr3iydome lnvt ( sDtaurpot4oltnifctadfs rluvp;u4arermo3iadlmt aieo t0 2uoxrpnodal nlivtas srur(rpou0apt mfeiyd a2uanmp;(0 lxomo oy1om elnes;t seurirpnodll elivsa(f rrmxmono1altoio3tytlm umu s t) lxoio todfmteln s;(0t2xmxmpnudam nmncslt  rumxr ou4tpeo fetls a2rmuvp;()alxnxo iatoateaivilt) exmir3nu1openmneiat)aDrr(  ;o0aee ifciydlm2ea(vonu) lxnmo3tatoate neol() etriopou4apt lfei ( sDumxr ;u1olxo f3ils mDrmumont) exrirciy1lmt lnvs (  rxmimpou1ll e nvslsfaDuax pno0oet mo3iydfaDemnvpnt4 lxnxr todoa  lnes s  rxoxrpiydlltemicta(fs2ua(root4apx  feiatlsDranvpn(4trtoxo3oydop rlies ( t2xrxrpiodol   nviatf rrru oou0opxn iciyd mDuanmp;() lenifcootfm r nesl()srum(m3nudaleemncs ( artrx  ;o0tlx ifeiad m emnmp;u0 renxf oydopteluesl()tetm(r3iy4am nmfeilt srtmxro;o0tlt iociysfaDraums;t4aleoif ia1fm elnvs;(0seumimpnudop n neias sDtm(mo;t4aetniociyt m ulnvo;(0tltrmr3oodoat anes;(0s2uo(o3iy1op elivsat srtaxmp;o4alt  f3iatlm2ran on()arerxo oatoaDran s t)srtr(m ny4amt  ieil( s2umurooo1tltomociad mDul(vsn(0 lermr3iydlp   uvolt)tetr(opiydap emfcta( s2rmxmo;o1tlxn o3iytls uanvo;t4 lxoxo oydlatrlieol(0s2xmiopnu1al n icta() rua( ont4opx  ictyt aDelnmp u4tlxnircto1fmD auvo;t0trtm(r3nydolt mfvt s)s2tru poo4oltomo3ild mDrln snu4tlxoir ia1oaD ai o;( srxrio io4ol emnvtlt  Duru  oo0oeenmoctldls2umuvo;(0trtnir3oo1fp eauesls)t2xoxrpio4lp  mieil(  2rm(rp;o4aptnii3iydls ra( o t) etoxf ia1lmDr n s s0setrio no4op n fcs (f Drax  nu0apeo ieiasfa2rlnmo t4 lxnmo todfp e i i s)s2umxrpoy4aptnlnctatfs2tmu p;u4olx iietydfs el(vp;u)tetnmo3iydfatrluvi;(0s2xmxmpoudlm elictltf Drrx p;o4tet moeiytfm um( s t)alxrmrciydlmD  ivol(0 2urxmpiudlpeelieiat  Dtmu ont4ope  ictlsls2rl(mo;(0trenxo oytfmDe uvilt0setrxr3oo1olen nvtatfsrum(mo;t4tpxn oeiytfaDemu p;(0texnxocia1faD  n ol( texoxrpny4opeemnvilsfaDrru o;o1oetnmoeiytfm eanmo;()aeermr todomDrlnei (  euo(o3io4ame lfvslt a2rmxmpou0aptnio3iltla2raumo;(4 leriocoytop  aneo (0 2ur(m oodol nlivt t  rra(mpnu0tetnmo3iadfm rm( pn(0 rxomo3iytlpt anvol(  rtr(o3iydome mncs s)aDua( p;u4aeto i3tad aDrm(mp;u4 lenmf oadoa  aies s0t2xoxopno1llen ieiatfs2urxr ot1apxn f3tyd s ul(mpn(0arxoir3io1fptrlivils t2umir iu1olte fesl()arra(m ;o4opxn o3tat sDumn snu)arenir3oa1oaDr ieo (  rur(r3nu4lle lnvtlsfa2tr( p;u0tpto o3ias m2ulnmon()alxoifctydopDelivi t)trxmxr oo4lpen ics s)srta(mo;t0tpxo o3iys a2emums;t4aexrmf3oa1lpD  uvo;t  euoxrpnudamen ncsl()artax pno1optoiieilsla2ulums;u4tetrxociotfaDrln ilt0t2to(opiodapen ics s a2uau pnu0tle ioctld s2eauvs (4aexnxr iatlp   ueolt)trur(r oydapenlici (fsDum(m nu0tetomociytfm2uan o;t) renif oatopteaueol(0t2xrxrpnudlm  lfcslsfsruax  oo1aeenii3tytlaDrl( s;t4tlxrmfcoa1oaDr i i;t0s2toimpoydlmt mnctl(fa2rmxmono1oeeoii3tasfa2ul( pn()artoxf3io1omteaueils) rxrxr3nudalt lfei t aDrruro;o0tlxoifctydla elu snt0teeniocia1lm rlivsl()srumxm3iodam  mfvsas aDra(ro;u0olx mietlsfs em(vp () rerxo3tydfaDrlu i;s  etr(mpoy1ape mfeias)srrax  no0aet mfetyt m ra(mp;u4artomociodomtranes ()seuo(rpny1om   ivs s)s2rr(mpnt0opxomo3ildfmDua(monu0alxoio ty1lptelueils) rxrxrpnu1ll  lfvia( s2ua(m ou0apt ifetysfm ul(vont4 rerioctydlatran ilt) 2xo(r3io4lme mieil(  2ur(mpoo4ope if3tydlmDemu p;u) rtnmr3todopD luvo;( s2tmxm3iy4lmtemfvsl() 2urxm ou4opxnii3ildla2rmums (4artrxfcoy1omt au o s)srxoxo ny1ap emfvt (fsrur(mono4apxo f3iad m2ra(vo u4 exoxf iy1fa  lieo;s0s2to(o ou1lptelnvtltf rumumpno4teenmf3ils a2eanmp u4aeeoxr3tadfpD aneo ()sexoxo iy4apenmncs s)aDtmuro;t0alxo iciltlm2ra( o t4 etomfcio1op eanei (0texrxm ou1aptn icsl( aDrmx ooo0aexn ieiat a rmuvp u0alerxociodlm elneo;s)tetmxr iy4lp emfes tfsDtrxr oo0optoiocilsfa2ulump;u4trtoio3oadfpDe uvo ()s2xoir oodope mfes sfs2rmxr ou1tleoioeiydla umuvs;(0tetrxr3tydlaDraueilt  eumxrpoy1lltnlfesl()a2rax  ;t0ape  ocilsfsDrl(mp;t4 rtrmociytfm r nvil()texm(o3iydlpeelneia( a2rmurpno1aeeo i3iydfmDemums u0 eenmfciytfptelivi s0trum(mpnu4opte icta()srrrumpoo0oexoiiciydls2umnmo (0alxoxf oadoat  uvi;(0s2uoxrpiy4lp nlicta()aDumur ot0optnmo3tadfs el(vsnu)aetnifctydopDraneo t) rtrxr3ny1ap nmfvt ()a2umxmono0tle  o3iltfsDuanvpnu0aetrmr3tatoa eluvilt trxmxrpnudapt licsasf 2umx pnu1oee  fciatls2uaumsnu)trtoxociytfa  ai s s0setoir iudllen fvslt aDum(m ;t0apeniieilsls elumo u)trxomrcta1op  lieil()s2urxmpoo1lle  nvt t)arrrumpnu4olen feiat a2rl(vs u4tlenmf3tatfaDeai olt  rtr(o ny4amtnmnct sfs2rmxm nu0texn o3tatla2em(mp u)teenio3totopD aivo t0 2uoxr3ou4lp e ics () rumumo;u1tlt iicild s rmn ont0trtnxfciydomDe u s t0teurir oo1lp nlics s  ruaxmont4olx  ociltlaDrm(vp u4altrir3ootopDrlueol(  2ur(o oudomtnmneiat srta(m ot0aetn octytla ua(vont4 lxomfciatfat luvslt0 rtmirpny4lm   nesl( sDumxroot0texoio3tlsla elu o;()tlxoxocoodlpDrli i s) rxrirpoodaptnmncs t) rumxmo;t4oleo f3iatlsDrmu pnt0aexnif3iotlaD aueo;( t2uoxmpnu4omen ics (faDtmxmoou4tltoio3iasfa umu s t4 lxrxf tydoa r ues;t srxrio ou4altemnvsls) 2rmuront1tee mo3tytls ea(msnt)trxrxo3tadfatr ivs;() rxo(o3iu4oltn neiasfarrrx ont4tpt ii3iydfsDulumonu0arermr tydfpt aivs;t  ruoxm3iu1lm  mnci t)sDrm(rpnu1opx iiciat s elnmo (4tetnxo oodlmDelnvi s0 rxm(rpiy4ope lnvils sDtrxmono1aeen i3iasfs2el(mont0aeerio oy1fmt lnvi t  rtrxo3oo4alenmfvt ()sDua(  ;u0tpxniictltfa ulumsn(0tetrir3oo1lmtrlieo;t texrxopiodlpenlfei t) rtmu oou1oltnmo3tas s ul( s u4altrif3oadla  auvols0s2trxopny4olee fesat a2rm(r ou4oltniieildfs ran p;t) eerxocoa1opt ai ol()tetmxo3iodlle mietat  Duax p;o1tltoio3tyslsDrauvp;t0 ltrmrctydla eaivs t tetmim3iy4alenlfci t arrr(m ;t4aee ifciadfa raump;t0 etomrciotfm rau sls  rxoxo3ny4amenmnvi t) 2tmxro;t0tptn ieiyslmDul(vpnt4aetoio iy1op   uvs;s0trxmim iodlpt mncsat) rtmxrpnu0openmietadfs2elu o;(4 etrxfctodopD  nei;s seurio3iu4omenmnctl()sruau  ;o1apenio3iat sDumnvonu0arxnmocootopD  ivs t sruo(m3ou1amt  netas) 2tr(mpot0olxoiietasfs2rl( pn(0tlenirctatlmt aueolt0s2um(opiu1amee nesl(fsDua(m ou4alx  o3iasfm2emumo (0artrxr oytfp  auvi s)setoio3iydol n nes ()arum(ro;t0aptnmf3tadlm umumo;(0texomr tydfaD  n s ()setmio oy1ole licsltfarua(mp;u1oee mf3tatlmDel(mont0trenifciodlmDrau o;s0 eto(m ou4aptnmnesls) rumu pnu4oee  o3iys mDul( s;u) lerxo tatfm e neo ( seur(o3oudape livsas  2tmu oou1oleoiieiad aDrm(msnt)altrmo3oa1lmDrlnei;() etrxrpou1alenmnctat aDrmxm oo1tlx  i3ildls uau s u0tetrmo3iytom r neo;(0 euoio nudopee iet t sDtax o;o4altnmo3iat aDrmuvs;t4trenif oadlpDr n s t tetmimpoy4lp nlivt s) rtm( pnu1aptnifeilsls rlu p u0trenif3tadlm r uei;s) 2umxo nudamtnlfetas aDtrurpnt0ape ioeiytla uanmont4trxnxo3oa1om   nvsls)t2xm(rpoodlmeemnesas) Dta(ro;t4tpxomietasfs2rl(vp;u0alxomoctodlm r u i;(  rtmxm3io4apeelict sfsrtr(r ou0tetomfetysfa rmnmp;(0trxnxo3iytlmtrlieslt) rtr(r nu4lp   nvtlt sDtm( pnt0tlt  icilslaDrluvp () etnxrcoy1fmD  u s;s t2xoir iydaltemfcsls  2rrxm ot4ale mi3ilsfa2ea(mo;u4teenxr3ty1lat livilt  euo(m iodopt mfesas aDtru pou4olenmf3iatlmDea(monu)tlxoio iy1oa r u i t0srtmxr3iy1amtn nct s a2taum oo0apxn i3ils s2emnvont0arxnmf iodfp rluvo t0t2tm(opio4apt mfcsl(fsrtm(m oo1texn i3ils s rau pnt4texrir tadopDe n ils)trtoxopoodal   iciasfa2umurpoo1aet iicils sDrm( p (0alermf3oa1oaDraivs;t t2toiopiydame  ivi (fa2tmxmo;t4aeen feiat sDrluvonu0tleoircta1oat  n il(  euo(r iy1alte ncta( s2ur(  no1aex iieiltfa2umu s;t0tlermo3iydlmDr uvs;(0 exmim3iy1aptelneias) Drau pnt4aleniociyt s uanmsnt4arxrxf tadlateaivsls) rumir io4lmtemfetls a2tm(mo;u1oeto oeiytfs ua(vs;u4aetnir ty1laDr u i ( trxrxo nu4om nmnes ( srrrurooo4tpenmoeild s2umums;u) lerif ia1lm   nvols0srtoxo no4om   iesl(fsrumxmo;o0olxoifcilsla2uanvp (0trtnifcio1la elu sls0setmxm oy4apte fvia(fsrtmu ont1opx  octlt a el(vont0 eenmrctadlptelues ( srxrio3io1lpee ics s)s2tmurpot0tptn fetatls umumpn(4 eeoxf oa1opD  n s (0 2xo(rpno4omtnmfvs t aDum(m ;t4tee  fcild aDeln o;u0trxrmr3tadoaD livi;(0texo(opiydaltnmivsls) Drrx ono4optoiociyd s umuvp (4trtomr3tytlatraues s) exrio3nu1aptnmfei t)s2uau  ;u4teto fctltfm rm(vpnt0alerif iytoptr u slt) etriopny4apee icsa() 2rax  nu0aee  fctad s2rmnmo u4alxnxr oy1lp  aues t) 2toir iydll nmfeils)sDtaumpot0tlx mieiad m rauvp;(0 rtnio3iytop eanei;t0srur(mpiu1ol  lnvsa(f 2uru o;t1opxo f3iytlaDumn s u0altomf ootfat  i s;() etmim3oy4om e nesl(  Dtr(mp;o1oee  o3iat m um(vont4tetnxocoodlptraivi;t)t2ur(m oy4amtnlfvtasfs2rru p;t0tpxn i3iydfmDrln pn(0alenxrcto1om elivo;t)trurxopoudomtemivt (fs2rr(mo;t4oltomocildla ua( pn(4 lxnxocio1fp  lnvi;s)trtoim oodam n iciatf 2uaum ;u0altnmiciyslmDelnvpnu4tlermf oodomtrlu i ( setr(o ou4opeelnvs tfsDtr(mono1tptn fciad a eau pnu0alxoxo3iy1opDe ieo;t) exmir ou1ll  mfcs (fs2urumono4oet moeias s rluvs;t)aetnxfcoydlm  lu il(0truo(mpoydalee nciatf 2uax onu1aexo octasfsDemu p u4tetomr3iadlmt li il(  rumim3iy1olee ietlt)artrur ;u4tle  i3tlslm2elumo u4aetoxfcia1oate ivi t0 exo(o ny4omt lncsatf Dtaxr ou1aex mo3tytfs eauvs (4 eeomr3tytlaD livo s)setmxo oodlp nmfctl()a2tru pou1altn fciatfa ean pnt0areoxocoo1lp r n o t0 rur(opiy4amen fcilsfa2rm(mo;o1aeeomi3ias a emu o t4aexrxr3oytlat au il( truoim ou4ape lnes sfaDra(rp;u1oleoioeildlm ean pn(4trxrmfciodfmtrlu s t0setmir iudlmt mfvtat arrau o;u4apxo ociysla elu s;t0treoxf oytlmtraivo;s0t2xmir3io4op elfvtls)s2rau ono4aptnmfeiydlm um( s t4 lxomo oa1fm  lieols0s2umxr nydole  ietat)s2ta(mp;t1tltoif3iytfa2rm(vo;u0tlxnircio1lm rlneils) 2xmxmpnydamtn ici () rrru  nt4ole  ociltlm rmuvs;t0tlenio3tadopt aueols0sexr(m no1ope lfct tf Dra( poo0ole moetas sDemn p;u4 rtoxf3iy1fmD lneo ()tetoxo ny1ame mieias)a2rmuro;u0aptomfciatlaDua( onu0 rxomo3iytoate nvslt srto(r oudlleelneilt arrrxro;o1tlxomi3iydfs ra( s t) lxnirciadfpD ai i ()texmxm oy1om n ncsa()a2uax pno4tlt iieildfaDemnvont4tltrmr3oadla e ieo;(0t2uo(o3oo4ap nlnvtls  2urur nt4teenif3iltlsDem( p u) rtrxr iadfpt  iei;() euoirpio4lpt livias srtrxmp;t0olx  fctldfs emnmonu)texoio oo1oaDelivils0texmxo nydlmeelfctls arumur ;o0tptn o3tadfm2uau pnt)tlxnir3io1om   ues (  rxoim nu4open ncta()a2rr(  ;t0tpx mfctlt m2emumsnu0trxoxf3ia1fptr i i;s t2tr(r3oodamtnlfet ( aDuaxr ot0aeen i3iydlsDra( o t)arerio3oa1lp e u ilt0trum(mpnu4lm  mnetlt)s2umx ont0opt  i3tltfs ran o t4tleomf iydfpDeliei () 2um(rpiydalenmieiat sDta(  ;o0aet mociysfsDeanvo;t4altriociadfmDr i ilt t2trxmpno4llen icsa( s2rax oou0apxomi3ilt s um( pnt0teeriocoatfp e uei;t  ruriopou1ol  livilt  Dur(mp;t4tet  ieias sDean o u)aleoxfcoydomD  nvi t0trxoir iu4ol  lfvi s srumx  nt4altnmfeilt a2rl(mp;(0alerifctadoat lu i (0srtrio3ou4am elfcta() Drmxmo;o0alt if3ildlm2rm( ont0aeenio iatlpDrln s ()srumxm3ny4lpeelncia(fsruaumonu0aleoiocilt s2emnmo (0trxomr3totomt auvil(0 exmxr3no1ol e nvs tfsrumx  ou4opeo fetadfs umu s ()alxrmrcoadfpDr neo s)setm(r3iu4om   fvsl(f ruaxmpot0aet ifciytlaDeanvo t) eeoirctytlm ranvi;(  2xm(r oo4ole  fei s) rrm( pnt1tltoiicild sDelumpnu4 rtrxfciodlm raneils0teurxo nu1lmtnlfctlt aDraxmono0apx mf3tlsfsDemn s;u4alerif3totfa elnes s0 rur(o io1ol emici ()arraxm ot1alxnifctys s rlump;(0areoxr3tadlm   ieols)srur(rpny4op n fet () rtmxroot1apto fciydlm rm( s t4altnioctotlmt lieil(0 rxoir3oodope mict sfsDrm(r ;u4oex  ieiad m2ua( s u0tlenirciytoaD  ieol()sexmxr iy1lp e fet tf 2trxront4oetomictltls rm( o ()aexomocia1fmte nvolt trtm(m no4apeelnet tf Dur(r nu0apx ii3ils a rlnvpnt0tlerio todlaDrai olt trxmio oydol emnviatfs2ur(mono0aexnmietad m2emu o u4texnmocootomDr ivsl( s2toxr3no1lmenmnvta()aDta(  no1optnmictyd m ulumon()tlermr3iydlm ran sls)sexrxr3iudlltnlivsatfsrumu oou1tpenmf3tyslm2elums;t) etnxf oy1fp r i s t)trxo(o oy1apen fvi sfaDrmxroot4olx  f3tys m rlnmpn()artoxrctatlptrlivil(0 2tmxrpoydaptnmici t)arua(ronu4apxoii3iatlmDel( sn(4 lermf iotlmt lneils)teto(r3nu1om n neil(f 2ua( o;t0tetnmf3ild aDrm( pnu4 etoir ta1om eai slt  rtoxo iu1al n ncs s srrmu pno0openiiciys s2ranvpnu0teeoir iatop raies;()sexo(rpoo1op e nes s a2uaur oo1aptoio3taslaDra( onu)aeenmr3tadoa eanes t texrio iy1lpe mnvtasfaruaxm no0tee ifeiydfmDuln p u) ltoifctotfpt auvo s srtrio3iudal  lieslt  2rru  oo1opeomf3tytfsDem(ms;t0alermr3io1lm eauvsl( trum(mpiy4om  lfcsas)arra(r oo4tlto o3tytfa umuvs;u4aetrmr to1oa e ivo;t)srtr(mpiodape lncia(fs2um(m ou4ape  ictlsfsDemuvp;u4 rxrxf iatop r ueil() etrimpoudomee ncia()s2ur(  no4tex moetltfmDua( s t4tlxnxf3oo1la elnvsls)texm(o3iy1opeelnviat a2trum oo4tptn feilt aDrln onu4tetomfciatoa r nvo;()srxo(opnodal emieiatfs2rrx poo4texomoctydlm2ra(ms;t)tetoxr3to1omDr n o s0sexrxo no1am  mfeta()artmxr ;t0teeoifetyslm rluvs;(4alxnir io1om  ai s s)s2xmiopiudoptemicsas) 2ta( pot4alx  o3iydlsDumuvs (0 exnxocoadfm r i ils t2uo(o3iudam   fcsl(fsrtrurp;u0optomoctytla emu s u0trenif oa1laDrlnes s) etrxo3nydalt livtl(f 2ururpnt1alenio3tys m rmn s;u) lxrif3oatfpDr i o (0teurir3ny1omeemnvsls sDumx p;o1olx ifctytls2elu snu0tetoxf oa1oaDe nvs;s0s2xm(m iy1ol nmiesl() 2rmur ;u0aee  o3iytfsDulu p;u)aeeomf3oytlptr ivi s0 rxo(o3nodapt  fcs s)srtmu  oo1apto i3tytfmDuanmo t) lerxr totla ranes s0 rxoxmpnu1alte fctl( sDur( pot4alxn fctltls2elnvo;u4aeeoircta1omDe neol( srxrirpnu1lp elncsls)aDum( p;o4apxo f3tyt s2rln pnu) exoif3oodoaDr ivs;t0 rxrio no1lptnlfetlt aDraumo;o1alxnii3tlsfsDum(mo;u4tlermr3oa1oatrlnvs t t2umxmpiu4aptelfvi t)srumxr ;t1tee mf3tys sDrlu o;t)alerxr iotopt auvs s)tetrxo3iudoltn ieslsf rumxm ou1aet io3iytfm umnmon(4tlxnxocootoat an sl(  rxm(o3oudalte nvsl(f rta(  ou4oexnmoeiytla2rm( o;t0teenmfctatlpDr ueslt)seuoiopiy4optnmfeilt)srrmur ;t4aptnif3tadfaDeanmsnu) rxrmr3iatla eluvo s0sexrio3nodope mivtatf Dtru ont4tpx io3iydfsDulnvs (4arenmf io1faD  u o s0srxmiopnydlm  mnvil(fa2tr( pnt0alxo ocias s el(vonu4trermr to1la e ivsls) rto(o3oydoptnlict sfsDrmxmo;o1tex mi3iyt mDrmuvsnt)trtoxrcoa1opDeluvs;s)texo(m oudop nlietlt) Dtr( pot1oeto o3ild s2elu snt) leriocootfp rlieo;s  2umirpnudaltnmfetl() rtaum no0opeo f3iysfaDrlu pn(0aeerxo tadfp eluvs s0 rumxm oo4ome  nes (fa2ra(m ;u0ape io3iltfs2ra(ms;u0aeerir oo1latelieo t t2toxrpiu1amtn ivils) Dra( ono1opt mf3iytfm2ulumpnu) rtnmf3io1om rlnvi;( trxrxopoy1omt mnetatfa2rmumpno1ope  ietyd s2rauvp;u)alerxfciodfmt lu ilt  rxrxm3iy1ole mfeiasfs2ur(  oo0alxoio3iytfs um( s (4aetrxoctydop eau i t  rumxm3ny1lpt livs (f 2urumo;u0texoioeiytlm2em(mp u0altoiocoa1lpDe u ol(0 2xoxrpoo4lptelfci (farrrxmpnt4altomo3tat a2emu snt4aleoxfctydlat  u ols srurio io4oltnlncsa(fa2ua(m ;t1oeeomfctytlsDranvo u4 etnifcoatlm rauvi (  2xoimpnu4ll   ncsas a2uru pnu4texoif3iasfa eau o t4trxrxf ootlpD aies t)tetrxm3no1olt mnesatf 2tmx ooo1opxnmoeiatfs2ulumsnu) etnxfcoa1fatrai i;s)texmimpou1lmeemnvsat) rua(r ;t1aex iicildfm ulu pn()texoxo ta1oateanes (  2to(o oudome mnes t sDtmxmp;u0aex moctldlm umuvp u4tlxomr tatfa rlu s t0truoio3ou1lmtn nctatf Draxmp;t4tlto ieilsla rlnmpnt)trxrxr oa1laD  nvo;() 2xoimpou4om   net (fsDum(  ;u4tpxniictlslaDrauvpnt4aexrmo ia1fatrlueo (0srxrio io1ol   nvtl()artmxr ;t0oeeniociasfmDemums t4trtrif oy1opDeai i s0sexr(o3iy1omtn nvs tfsrta( o;u0oexnif3iytfmDrmnmp;u4arenxrcia1fm elnvi t)teum(mpiudol n ictatfs2tax pot4aee iietasfa2eanmo;t4altnmfcoytla e ies s)teurxmpiu4lptn icsas)aDtauro;o1tptnmfctad mDem( pn(4tltoifcoytfpt  ivo;( t2xm(m3iydlltemnesat)s2ra(m no0aee io3iydlmDrm(ms t) eenmr iytoptran s;s0srtmxm3io1omee ivtl( sDuru p;o4ole mfeiasfaDrln p (4teeomo3iytfa rlneo t t2um(mpiudlptnmictat)a2uax p;u0tetomf3iat a elnvpnt4arxoir3oydlpteanvs;t)trtoim3oy4ameelnvi t artrumoou0aetomo3tlslaDeauvont)arxnio to1lm r neols0trxr(r3oudolenmnci s sDrmxmpot0oexnifetlt aDulu snu) leoio3tatoaDe n i;s  exrirpnudamtelictl()a2ur( o;t1tet  f3tys s ulumo ()tlxrmr oydoa rln s;t)sruoir3nydoltemnvtl(  2raxro;u4opx ioeiydfm2uaump;()tetomfcootlm  lnes;(0srur(r nu4ol nmfvt ( aDrmurooo0tet iictatla rm( on()altoxrctodfaDeauei;t0setmxm3oy4lmen fvi ()s2rmumpou1apenmictaslm2ua(monu0tleoifcta1lp  ln sl(0setm(o oo4altemnetl(fs2rax o;t0tlxomieiytla umnvp;u4arxoif3iodlpD luvi s) rxmxm iy1lltnlnvia(  2rmxmpnt0altn ieiadlaDem(vsnu0trtnirciytlmt aneolt0s2tm(r iu1lpee iesasfaDtmu pnt0alxo f3tyt m uauvonu4artnxoctadlpDrlneo;( seum(o3oydll   fcsat  rrrxrpnt4opt moctys s eauvo;t0aetoio to1fpDe ivi s)s2tmxmpnodom n nei t) Dta(r nu1teeomoeilt a uln s t4tltnxfciytom  ln o ( s2tmxmpio1lptelivtls)arum( pnu4texn f3tyd m2rln o;u4trenir3oa1optelnes t0texoio nydll emncsa() Drm( pou0aexoifciydfa ranvo t0tlxoir3iatfa eauvols)texoxm3iudaleelicsatf 2rmumonu4oee io3ias a rm( p;t) ltnif3io1fptelnvo;s  rtrxmpio1lm   nesa( arua(r ;u1oexoio3iyt sDeaumo u)alxoxr iydfmDeli i;s0srtrxmpiodll emnvsl( srur(m no1oex  iciysfm2elnvp;(0 ltriocoytfm eanvi;s0trtr(rpiydop elfvtlsfsDur(roou1aeto fciatls ean s;(0arxrxrciadoatr u ol(0 2urxo3oydapte fctas  rur(mpnt1aetn fetatfmDraumsnt4 ltrxr tatlpDelnvol(0srtrio iy4al  lnctl(f Dum(rpnu0tptnmi3tytfsDuaumpn(4aeerio ta1fp   uvi;s0trum(opio4oltnlnctat) Dua(m ;u0opxoioetydlsDulnms (0alxnxr3todomtelu s;( srxm(opoo1altn ivt (farrmxm oo4apto ieiatla emump (0 ltrmf oo1la rau il(0t2xo(o io4amtelnvia(  rtruroou1tltomfctld a eaumon(4 exrxoctytfptrlivo (0teumiopnydamt  fcias arraurp;o1opeo feilslm2raumsn()aeerif oytfat luvs t) etoxrpoydlm  mics t  rra(mp;o4apxnioetlslsDua(mon(0tlxomr3tydomteaieolt0sexrxmpiu4op  lfcslsfa2tau poo1olxomf3ilsfs2umuvpnt4trenxfcoadlmtelu slt)trtrxo3ou1omee ivt (fsDtax pou1alenif3iat m rl( o u)artnmocoo1op  lneo ( trtoxo oodaptn icslt aruax p;t1apt ifctydls2uln o;()aexoxo oytfaD  uvo;s t2tm(m ny1omeemfviatfsrraxmo;t0tptomoeiadls rm(mpn() lenxf totomDe i i t  ruoirpnodol  mnvslsfa2tm(m ;o4aeeoio3iysla2umnmonu4aeerxo todlmte ivsls0trxoxo3io4lpee netls  2ta(mooo4tetoifetyt a emuvo t4 reomo ty1fptrlnvi;s0sexmxo nu1apt mies s  Dtaurooo4oetomi3iytlsDranmp;() eerxrcoodlmD  u o t0trur(m3nodomtelfvt s) rrrxm ;o1tle  feildfa uanmo;t4 lermocia1lmte neo s srum(r3oydaptemnvsltfs2rau  no1alxomi3iydfs2ulnmp;u4aetoxr3oytomte u i t0 ruoir oy1alt mfvtas arrax ono4ole mf3iltfm rmnvo ()altrif tadlmD aivslt)tetm(opou4lpt lfesatfaDtmxmo;u4aetnmi3iytlmDraump t0trtoxfcta1opD aivs;t0t2xm(rpiodal  mnctasfs2tau  ;o4aet  i3ild sDra(mo ()tltrxo ty1faD  i olt0seurxo3ny4lleemfei s)s2urx ont1tpx mfeiydla el( o;(4trxrmo3ootla r uvol() 2xoxm3iu4ol  lfvsat a2um(m nt4tlenmi3iysla rlu p;(0areoifcoadomt aivils0t2xoxrpoo1ope lneil( arrr(m ot4alen f3iysfa2uau pnt0tltrxr3tytopDr uvi;t)t2xr(r3nodlm nmfcia(fsDumx onu1teenif3iyt aDemn on(4tlxriocootopD  ues;s)teuoxopnodalteliet sfa2tm(mooo1olxnifctlsfsDua(mo (0treoxocoa1opt livs s) 2um(o oo1ole lnes sfsDumx  ;u4teeo iciydlmDrlnvpnu)tltrmf3oodfpDrluvilt)texrim no4amt lfetlt)aDtax pnt0tpeomoetls mDea(ms;u4 exoio tydlmDe ieo ( truo(m nu4lmeelfcslt)srurxmp;t0alt  ictlsls ulumont4aeermf3oy1fmD  ueo s  2urxo3oy4ll e ivt (f 2ur(moot0aeenmiciltfa rln p t)texniocta1omtean sls) 2ur(rpoudom nmnciatfartmx p;u4altoii3ils s ulnmp;(0tltnxocoytlat  ivo;(  2xr(o3oo4ope  ivilsf Dtmxr ot4alxo ieiyt s ra( snu0tlenxf3oy1oaDean s;(  2tr(m3nu1ol elfes sfa2umx p;t4alxnii3tytfs2el( pnu) etnio oodla rlu s s)t2xr(o3oo1ame mnvilsf 2ra( oot0oleo feiysfs rmn s (4 eenif3iytom ean ols srurxopny1ome  fes (fs2rmxmooo0olen feiytlmDul( s;t4tleoxf3oo1omDr nvs t  2uo(r io1ll  licta()artmxroot1tlxnio3tldfm ra(vo u4 exnxr3oatom rlues;t seumxm oodapt mfetl(fs2rrx pnu1aetoioeiydfmDrlu o (4trerxr3iatoaDr u i;t srxr(r oy4lmeelncsat sDurxmpot1texn o3iydfa2em(vo u4tlxnxfctotfpDeaieolt sexmimpoudapeelnctlsf 2ra(rp;o4aexnif3tasfs uan on()treomr totlmt  iei;t0 2toxm oodol elnvtasfsDrmurpnt0opxo i3iatfs rm(vo u4arxrmf tadfaD anvolt)t2toio oy1lp nmnci s) rtr(m ;t1tetoioeilsla ra( o (4 eenxr tydop elnes ()trtmxo3oo4lp elfes sfs2rr(m ou0apx mfciyslm el(mp u4tltrxrcia1op elieo s0trtm(mpiydlm  mfcs sf rtruro;o1oee mfeildfaDeluvs u)trermf3oo1lp eaueilt tetmio3io4lpt mfcs ( s2uau o;u1teen f3tasfsDumu o;()aetoirciytlpteai i;t0 2tmxrpnydale  fetas) Drm( o;u1tpeomfeiydlm2emumpnt)tetomo iydlpt ln sls  rxoirpiu4op e ictlt  rur(r nu4olxo fetldla rlnmonu) ltrxf3iotoa rlivo;()srurim iy4omen iviat)a2tr(rp;o4apt if3ilt m2rm( o u) rxnxr3ia1lpt lneol(  eum(opnu4altemnetlsfarururo;o0tltniiciatfm2eln pnt)tltrmrcootla rlnvs;s0srto(opiu4altelnct (fa2tau pnu0tpenmi3iltlmDul(mo t)arxoxr3oa1op elueo s) exr(mpoydalt livsas artmuroou1apxoio3ilsfaDraumo;t)arxrirciadfpD  u il(0 rumxr3oy1ap  mnei t a2ra(m ou1optn ietat mDulu pn(4texrmfctydfptrli o;(0 rtm(o3oydolen fvi tfsDra(mpnt1ope  feiyt s2uanvp (0texnif3iodfp rlieslt)teuoim3io4amtelnvtat sDtmump;u1opxoiictytla2rlu snu4trxoir iydfpD aivsl(
\ No newline at end of file
@@ -0,0 +1 @@
+ivs;( tetrxm oodom elfeiltf rtax o;o1alx mo3iadlmDean s u4teerxrciatfpt liesl( trtmir3io1apt lnei tfarur(rpoo0olxnif3tldfm raumsnu0texnir io1oaD li i;t t2xmim3oodalenmicsls) Drau pnt1texnifetas m em( p u0 rxnmo iadfpD lieo;(0t2to(opiy4ll elfetat  2rrx pou4oeeomo3tasls em( snu0texnir3oatlaDe ueols  rxrio3nydop e ietlt a2uau pnt0aptnifciltla uau o (4 etnmfcoa1lmte u i t sexmxr nydlmeelncsa()a2taxroou4alxo octydfs2rau o u0aetnio oo1lmD ln s;s)t2toio ou4al elieia() Draxmoot1olenmieilslm2eaump;t0aetnmrcio1oa  an s (0setmxopoydamt  fciat  rumxr ou0tpeomoeias s eanvo;t0 etrxrcoodla  lieils) ruo(o3nydolen ivi sf 2rax  oo0apt ioctaslaDeluvsnu0texoxocio1fp  auei s) 2xr(opnodal e nes () Dur(mpnu0olxnmfeilt sDrlnmp u0teenmrctotomt aivsl( s2um(m3oo4lm elies tfa2urxr nu1tet mo3iydlaDuauvp;u4 leomo3ta1lpt lueol( trtm(opoodoptn fvi ()sDtmxr nt1teenmicildfmDumumont) ltnxf oodfpD lneols)seto(r iudlp e nesa(  rurx pot4aexn o3tasls uanvo;(4 lxomf oydlatelues s)sexo(rpiu4lp emfvtatf rum( pot0olx  oeiatfm eluvo u0aetnif3iydlm  ai s;s0srxm(m3oudoltnmieilt) Draxrpnu4aleo o3tlsfs2uaumon()trerxo tytom rli o s) etoxmpno1lp  mfes ( sDra( oot1oltomiciatls eanmpnt0 rxrmo iadlaDrln ilt  2trir3oy1amee fvs s)arta( onu1opt  fctatlm uaump;u) exrifcoatlpt  nei;(0 eurxm3iu1omenlietas)srtau oou4oetomfctatfs eln s;t4trerxociadomDe i s t0srtrimpou1apt  ncia()s2trumoou4oeenmfciad sDemnvsnt)tlerif ootopt an s (0 rumimpiudameelncta()sDrmx pou4aptomo3tltfm uanvo u0artrio3totfptr iesl(0 rtoiopiy1opeemfctlt arua(mp;o1aetn o3tlt s emnmsnt4 lenio3oydlp elnvo;t teuoxrpoodol emfcilsf rta(rp;u1apx ioeildfa rau p;u)aleoxr3ia1fa   n i;(  2toim3ny4om   iet tf rrru oot1ope mieilt aDemumo u0 lxrxocto1fmte nvolt) exoxm3iy4aptemfei ()a2tru p;o0opxnio3iyt sDranms (0teenxocoatopt aues s)setrxrpiodop  mfct t artmxrpno0aet mf3tyslm rm(ms u4 eenio iadfmDean o t s2toim3oodlm n ieia( a2rm( oot4aet ii3iltfa2um(ms t0altomr oadla   nvol(0teum(rpoo4lpe  iviltf 2ur(r ou1aetomo3tydfm em(vp;u4trxnxfcty1fmD aivols  2uoirpoo1om elnvils sDrrxr ot4apxniiciyslaDumnvp;(0trenmr ootopDraivi;() ruo(rpiy4ll emfvtat)s2rmxmp;u1tex moeils sDrlnvo u)arxnmo ta1lmt anei s trxrxr3iudolenmfciasfs2ta(mo;t0tlen i3ias s el(vo t4texoif oodlp elneo;()s2trxo oo4amee nct (farta(r ;t1aetoiieiat sDrmumo;u4 exnmrcootfpDe nei t0texmim iu1al  mictl(faDrmu o;u0ale iociad a rl( snt) ltrxociodlp e uvil() etmiopoydopt  nesltf 2ta( pot0apeo feiad mDemu p;u4trerxf tydomteli s s srtmxr3iodllt  ics (fsrrau oou1opxoif3iad a um(vs;(4 rxoxocto1fm  lueo ( sexoim oo4amen ict t) Dum(mooo4tlxnmicilsfs eln pn(4tetrxf ootopte u o s) 2tmxopno4amtnmfeiatfarraumont4oleniieils sDem(msnu)texrmr iadfptr n s;s0seto(o3nudamtemnvtls)srrr(  nu4aet  ieiatlm rlnmo;u0 etnmf3ia1faDr u ils seurxm nodomenlivtatf rtau pou1tlxomociydlmDem( s (4tlenmo3oo1lm raivilt0setrxrpiydaptelies t a2raxro;o4olenmfcilslaDum(ms t4alerio oodfaD lnes;s0 euo(m3io1ll emivias)aDtmurp;t1olenif3iatls ran s;(0 lxnmr tatla eau s;s) ruoirpnodam   fvilsfsrtru pno1tpe io3iydfm rl(mp t4tleriocoatfpt lneolt)setrxmpoy4apeelfcs s)aDrrxmo;u4opxoiietyslsDemump;t4trtomf3iadopD liesl() 2toxr ny4apenlfvs t)a2raxmoou1opt ii3tas aDeluvon(4trxoxr ia1op  anvo s t2tmir oo1ol nliei t arumum ou4tee  fctldlsDulnmo (0texrifcty1la ean s;s  ruoir3nodapt mneiat  Dum(mpou1tlxomieiltlm uaums u0aetoio tadfpte n ol( texmxm3iu1ame  fet t)arur(m ou0aptn ictadfm2eaumpn(4tleoif oadfpDrauvi;t)sexoxm iy4omeemncia(  rraur no4oeen f3iadls rlnms;(0 exnmf ia1fm rai o;(0srtmxo3nodlp  lfvt t)sDuaxrooo4oleoiietysfs rln p;t0 exomfctytfmDeaneo s  euoio3iy4amtnmnvsasf Drax o;u1aeeomfetysfa2rlu p;u)alxrxrcoadlpte n il( sruoxm3oy1alt lfvsa( aDum( oou0apxniociat aDum(mo u)tetnio3totfatrlnei;s0srxmxopiudomt mfei s a2trx o;t4opeoii3tltfs2umump;t0aetomr3iotomte ueo;t0t2urxopiodlmee ics s) rrrxm nt1tlto o3iatlaDran o;t0 ltrir tydfa r ueils teto(o3nu4lm nlnvsat)s2rau  nu4aptn i3tls a2ranvs (0tltrifcoa1lp rlu s;( t2xrxopoo4ol nmfvi s) 2rrum no4tex  ieiysfmDrmnvonu0artoxo3iotfatr nvi;s)setrxo oy4ole lnvsa(  ruau p;t1apxoiieild a ul(vs;t)tetoxo io1fp rlivi;t  etr(m oy1altnmfcs s)aDtmu oot4tetn octys s umnmonu0 etrxo3ta1op e u sl(  rxmxr3oydamtnmivslt)arrax pno4aet iociltfs elnmp;() rxnmo3tytfp e neilt  exmir3nydlp n ivil()srrmump;u4apt  ocild s ea(vo;(4 etnxf3oodlmt luvo s) exoxrpou4omt lfeiat)arumu ooo1tltoioctysls rlnmpnt) etrmf oa1om e n s;()sexmir3iodop   iviasfs2umu p;o4tex  i3iatla rauvs t)aexrifcoatfateau sl() 2ur(o3iydol nmivsa(fs2uru o;t1opxnioeiat s ul( p t)aetnmocoatfa  anvils0trtr(m oo4al nmnvils)sDuru  nt4oleniictydlm rl(ms;() lxrmr3ty1oaDelu sl()sexoxrpoydale  ivt s)a2ra(moou0altnii3iydla emuvp u)altoircoo1om rluei ()s2xmxmpoy4lltelnctls  rrrumoot0teeoifeiyt s rlums;u) rxoif3oytla rlueil() 2xo(r no4omenmivt tfsDtrur ;u0ale micildlmDuaums;()trxomfcta1lp r ues s  2uo(r3no1lleelfesl(  2um(m no0aexniieiys s2rmuvsnt)tetnio3ta1fa elnes;s0trxo(m oudapeemfesat)srtax o;u1tetoio3iysfm umuvp u0 ltrmrcio1fmt  ueo s) 2tmxo3nodapt mnvtlsf 2rrur ;o0tlt mieiyt s elu s t0texoif3iydfptr i sl( setmxo oodop  lfeilt s2tax p;o4aeenmfetld sDeau o u0tlxnxo iydopDranvi;s  2xo(m iy4amtelnvs t aDtm(mpnu0aex ii3tlsfm2uauvpn()teermo3oy1la rli s s0s2ur(rpoy1op   fvs ( s2tm(  nu0tetnio3iatfsDea( o (0aetoiocoatoptr ivi;() 2xoim oy4omt mieils)srurumont4oltomfciat aDrluvo;(0 rxrxfctytfat  u ils0setrxm nydllt  ncia() Draxmp;t1opt mfeils s2ul( o;(4 lerif3iydfpDeliei;(0trtm(m3nydal   fctlt aDtmumpou1oexomf3tadfsDul( p t)arermr ootla  lnei;t)trxoxopoudop n ncil(f Dumxrpnt1oex ifetyd s2rau o;(0 rxrmf tydlatrlies;t0teto(rpiy1om  liet tfsDumxmoot4ope  f3iasls2rmu s;t4tlxnioctodlm eluvols srtmim3ny1oltnlivi s aDrm( o;t4opxoiictadfsDranmpnu) leoxrcoatlm r ueols0 exm(mpoodlmt lnvilt sDuax ono0oexo o3tat s2ran s t4 eenmr iatopt livils0 exrxmpno4omt liei ( aDrru  ot1olt  ictltfm2ul(vp;(4tltrxfcoydfa e i ils0 eumiopiydllee nvtlt sDrmxr ;t4tlxomo3tlt sDem(vpnu0 ltrmo3ty1lptelu il( s2to(r3io4aleemies ()sDum(ro;u4open i3iad s el(msn(0 lxrxo3oa1lat au i;s0trur(opoydal  mnesat)arrrum oo0opx  ictadfa uau pnt0texrxr oo1fp  li s;s trxoir iu1olt mnes ()aDrmxmonu1aeto ociaslm2umnmonu)trxoircto1lmt lueil(  2tr(r io1om emivil( sDumx  ot1ope ioeildlm2elu pn(4arxoio ia1fp e i il()s2xmimpny4lp nmfci s)a2raxm nu4ole moeildfmDrl( snu)tetomf io1faD livsl(0 2umxm nu4lltemfcsatfs2raxmoot0opxomo3iysla2uaumo;(4trtomr3iadlmtean i;t)texr(o3nu4lpe licias)s2taxr ;o4aexn fctadfs rau sn(4trxnxf3tytfp eaueslt  2xoxr ou4ap e icslt)s2ur(rpno0alen ieiyt s em( pn()tleoxrcoatfat  neo (0 eur(mpoudom  licsl() 2uax  ot4texnmfeildfaDum(vp u)texoifciydlatraieo;() etmir io4alee ieta( aDum(ro;o0aptn f3ilt m rlnvont0tlerxrcoatlp elies ( s2xo(m3oydlm e fcil()aDtr( o;t0tlenmfeiyt a ulums u) leoio3oo1lp e uvsls0 euoir io4aleelivtl(fs2urxmp;u0tpe iiciat sDeluvp ()trxrmfcio1op eai o (0 ruoxo nudal emfcilt aDtrur no0tpxomieiltfs rmuvp;(0alxnif3oy1la r nei;()texm(m3oo4lpt liet sf Dta(ro;o1teto oetys mDrluvonu0 lxoxo ty1lpt liei (0trurxrpiodop n nviasf Dta(r ;t4aexomfciys a2umnmp;(4alxrio3tytfatelu ols0t2xm(r3ou4oltemfcsl( s2rmxro;t1ope ifctad sDul( pnt4 rxrxrciodfmDeanesl( sexmxr oy1omtelfvil(  2tax pnu1ape mieilsfmDea( pn(0trxomo3oytomDeanvo;t srtr(mpoo4lpe  ieils) Draxrpou4olxoio3tytfm rau snu0 lerxf oodop eaieo t srxmxm3oo4lpeemicil( arrmum no0tlt  oetld m eluvsn(0 rtniocty1op eliei;s0s2xmio3nudlm  lnes sf rra(m no0opt  ieiadfsDea(msn() rerxfciadomDrlu i;s0 2trxr3nu1al n iei () Drmur no1oeeniiciadfs em(ms;(0treomrciotfm  li olt trxoxmpiydalee fei s s2urxm oo1apxoiietltlm rmn pnt)tetoir oo1lmte ueilt  rtrxm nydamtn fvs t)sDrrxrpnt1alt miciat s rmnmpnt0 lermf totomt  nei () 2xr(o3nu4lle  ncsat sDrmurpou4tptn oeilslmDelu ont)alenmf3oadlptr n sl() 2tmimpoo1am nlneil(f ruru pou1teen ociasfmDrm( sn(4trxoiociy1fa  lu i (0trxo(o3nu1amee nvslsfaDrrx o;t1alxnmf3iadlaDemnvpnu4tlxnxf iy1la  lnvi;t) exoimpoy4ap  mnvi (  Duaxmono4tpxo o3tyt m2uan o;u4trxoio iotoateli olt  2xrir oo1om   ietat srum(r ou4ape mi3iatlm2ua(vpnu)aexnmrcoadfmteluvs (0srtr(r iu4omtelnesls aDraxr nu4tpx  fcild a emumpnt4 rtoxr oo1lm  ln sl()t2xrxr3iu4ll  livs ()a2trurpou1tlen fetldlsDrl(vsnu4alermf oadfpD  neols  etrim3oo1ap  livt s srrrxmpnu1aeeo fetys a ua( o;t4arxnir3tytfat  i s;(0 rumirpoo1ap  miesat)srrm(mpot4teeo i3iadla2eauvo;u) ltrmo3iy1oaDe i ol(0s2xrir3no1oleelneiatfsDrrxmpot0tptn i3iatfaDrlumsnu)teeomr oy1fp rlu s;( trur(o io4om emfcta(farumu  ;t1tpt ii3tysla2umu s;(0teerxo tytfatelnvo;s0 ruo(o nu4optnlfcs s sDtmxro;o0aptn ociadfs2ranmo (4altoiocty1opte ivi;s) 2toxr3iydom nlfcs sfsDtrxmont0apt ifetydfsDul(vp ()tlxnmr3totlaDr uvs;s)srxmxm ou1ape  ics s) 2ua(rpot0apxn f3iadlaDumn s u)arxoxo to1opte uvs s0t2tr(m ny4lm n nvtl() 2rmurpoo0tleniieiydfa uan o () exomo to1om rauvsl( seuo(r3nudlm n fct s a2taxrooo1oee  o3iyt s2um(ms t)tleoio ty1fpD  iei t0s2trir iu1amenmfvsls) rraxmpot4tlt mictlt aDuau s;u4 ltniocoytlmDelues;(0 rurxr nu4lpt lfctl(  rrru  nt4tpeoifetls sDeluvp;(0alenmo iytfp r i o ()texm(r iu1lle  fciltf rrmx o;t4openmoctydfsDuluvsnt)trerxo3iadfatr nvi;s) rxr(opoy1apt mfcsat)a2tmump;o1aptnmoeild s em( s u0 etrmrcootopt au o;s)s2urxopnudlpt lfciat) 2ra(r ou1ape moctldlm2emn s u4tlerio3todfaDrlu s;t0 rur(m3io1omee fei t aDrrxm no0tlx  f3ils m2rauvpn(0altrxo ia1oatr n s;s)srxoxm3oo1al emfvsat s2urum ou4oex  oeilt m ran snt)tlerif3tytomt aueols t2uoio3oudopen ivtls)aDra(rp;o0aeeo f3iytfa rlnmpnu0 leomr3iytoaDr n s;( seurim3oy4omeelict () 2umxm ;t1tpxnioeiadlmDumums t) etnio3oodlaDeaueslt)tetm(o nu1op n nvsl(faDraxroot0tpt io3tls mDrlnmsn(0trtrmrcto1fptrlu o t)setoir io1optelncias srurx o;o4tetn ociat s eln s u4teenmo3oadlat aivil(0 2xrxopnydol  lfct ()sDumumont0tlxoiictytfm2uanms t0arxomr tatomDrauvolt0trumirpoo1omt  fvsl()aDtm(ront0aee  ieildfsDrluvpnt4alermr3oy1op raieils srtrxm iu1optelici (  rta(m nt0alt mfeiadlaDua(ms u)aeenio3oodfpDeln s () 2ur(o3ny4alenlnctasfsrraurono1aexn iciadfa2um(mon(0 rerxr3iy1fpDelu i;s)seuo(m oo4ame  feil()sDtax o;u1oeeniieiytfa ea(ms;(4alxoir ty1fmtr i o;s0seum(r3oo4lle livtasfarraxmp;o4tpx mfeiyt aDuaums t4 exoir iodoa eai i (  euoio3oo1ope mfvsas srrru  ot4tex  feiys mDulnmo u)aetnxr oatfp  ai slt0s2uoiopio1optn ncsl(fa2rrum ;o0ale mi3iat m rm(vp u0texnxo oadlm ranvs;s) exrir3iudopenmietlt)s2tmumooo1apx ii3iatfs eauvo (4 eenxf ty1omtr n o;(0 etm(m ny4lpt mnvils)a2urum ;t0oee  ociltlsDemnvp;t0 eermo oytfmDrauvolt srto(m nodaptnlics () 2uaur no0apen ieils sDrln p;t) lxrxrcoatop rluvols  rurxm3ny4lmt mivil()aDtmx  ;t0oee mieiysfa rl(vp;t4alerir tydopDr i il()srtr(r3nudal  lncsl()aDua(m ot1aexo o3ilsfs rlnvsnt)trxoxr todlmte ies;s)seumirpiu4olte iet t)a2ua(mpnu4tltomf3ilt aDrlnmp;u0 lerxr oy1oa eau o t0srxrio3iy1amt miviltf 2ra(m no4olt ii3iytlsDumu s t0 ltrxo oo1oaDrlieslt) exo(o3iudop n nct ( a2urx o;u1aex ifeiadlmDeau o t0aetnio oydlm e nvsls0 etm(opnu1ll nmnvi (f Dtrxro;o1texnifciatfmDel(vsn(4artomocta1lmt  u i s s2toxr3iu1lp nlfvsltfsDtrumont1tee  f3ils s2ean s;u4 rxoifcta1lpDe nvslt0texmxo ny1aleemneilt)s2uax p;o0alt io3iyd m2rau p (4aexoif3oo1lp  ai sl()srxrxr3nu4omt licta( s2tmumooo1tee mi3iatlaDuaumsn(4aeenxr3iatlm rai olt0tetoim ou1am nlfes s a2urumont0tpxnmi3iydlaDum(vp;u0teerifcoa1lpt  i ol()texmim nodam e ivi ( s2rmxm no0oeenio3tyt aDemuvpnt) rtnir3ta1lpD lnes s) 2uoirpiu4apte ieil(f Dtrx ooo0tptnifciyt aDuln s (0 rtnxo iodfpt auvs;t0 2umiopiodap elfcsl() Drmxmoou4olto fciaslm2ua(vsnu4altoif tatfmteaueilt  ruoir3no4lptnmnvtlt) rtmx poo1texo fctld a2ra(msnt0 lxnxf tatopD au o;t0setoio iudol nmneiatfsrrr(mo;u4olxnmf3iyd a eluvo () lxoxo3oy1oat  nvo;s teumir oo4lme  nctas sDraum nu4olt iiciasfm el(mp (0 rxnxrcoo1lmt aueo s)seurio nodomt livta()s2rr( ono1tlxn feiasfmDulums u)teerir3oydopt lu ilt)srtrxmpno4alte nvsatfaDuau ooo0aex io3iyd mDumn sn(0alxrmr oo1lp  livsl()srtmxo3io4al elnvs tf rraumo;o4alxomfeiytla2emu s t0arxnmo3ty1latr u i s0 ruo(r3no4lle mfvs t  Dtrxm nu0openmo3tyt mDrl(ms;(4 lxnmo3oo1lm r n i;()trurxm oy4lpt  fcsat aDrmxr ;o1ope  i3iltfmDum(vo;t4texrmf3oodfa raieo;s) 2xr(m ou1am  mnvsls)aDumxrpou0ole mfeiys s2emu s ()treoio3oydlaDeaieo;s t2um(mpoo1llee ivi t sruax oou0teeoii3tasfa2elnms;(0trermo totfp e nesl( trtmxmpoy1lm nlietls)srtaxmo;t0oeenio3tls m2ea(mo;t)tltoxociadfpDelu s;(0srtrxrpiudlme mivt sfa2uaur nu1opxnmieild s em(vs;()aexrxo3oydfateliesl( t2trim oudop e ivta( a2uax ono0apen o3iyd s ulumsnu) rxrifcoa1lp elu i;s0texmxm3iodlme  ivtlt)a2tmxrooo0tpxn iciytlm rl(msnu) rtnmo3tadomD  nvs;t0 exmimpnydamtemnci t artmu p;t0aleo ietas s2rm( o;() etnmo oo1fm eanvsl(0srtoirpou1oltn iesat)srumxmo;o4oltnmf3tas s rau o;t4tlxomoctatfp eau sl() eurio oo1lpt  fvt s srtru  oo4olenifeildfmDea(msnu0 eenmocoo1om rlieol()sexoxm oo4lpt mics s arrm(m ;u4aeeo oetlt sDrlnmp t0aetrirciytlm e u i () rxr(m3iy1lm nmiviltfs2rru  oo4aexomi3iyd aDelnvs t0tlxrir iy1laDraueo ()s2tm(r3oudolte icslsfarrrumoou0tptnioeias m rl(ms t)texomo3iodfmDr nesls0 rxoxr3iudoptnmieils arraxrpno4tee  fcilt a2em(mo t0tetoifctatfmteaivs;s0s2tr(opiudal   fvsls sDtmuroou4opt iiciltfm2ulnvp;(4tetoxo iodfaD  i ols  exr(opoo1amt  fcs tfsDrax  no4tee ifctlsls2elnmpnt4 rerxo3iadfmt lnei;()setrio3oodlp nmfvs sfsrur(mp;o4tlx mictytfa2ea(vonu)areoirctatfm elnvsl(0 2xm(m io4omt mfvi () rtax onu0texomi3iaslaDrmumonu4 ltnmfcoydom raues s texmiopiudomeelnet (f 2tax ont4texn feilt a2elu p;() rtnifciydfaD li ils0 etr(o iy4ol elnetas)s2rrx ont1oltn ociltfs rluvonu)tlxnmfcio1fpDeln ilt)trxoxmpnydlm  lneil( s2rrur ;t0optnioetasfs2rauvon(0tetrmfcto1fateli slt)trtmxm nudame mfvi (  rumx  ou4tleo ociysfa elu p t0arxnxo3iodfaDrlnvi;(  rxrim3ny1amtnmfcsl() Dumum oo1ape  i3iyt m2eau pn()tltnmfciytla e nei;s0srxmim oodaptelfvilt  2ta(  ;t1openmieiad mDuanmo t0 etrxo iotla  livi;( texr(o3iy1omtn ictat)srrrxmpot4alenmfctyd sDeau s;t4 lxrxoctodfm  ln s s teurir iu1alenmfeiat  rtau  oo1ole mfciadfmDem(ms u)texomrcoadlmt aivolt  rtm(opiu4apeelfesas  Dta( pnu1aetomfciatfm um(vs;t)teeoxo io1opD aivilt)s2uoiopiy1lm n nvtl(  2um(m ;u4openmiciyt aDulumont)altomoctadla elies t) eto(opny4lp  mnvtltfsrua( pou0tlxoiociysls emums;u4arermr3oadoat aivil()sexrirpoydaltemnct s aDtax p;t1aetniieilsfs umn p u4arenifcoydfp raivi s) rxmim3nu4lm e fcs s  rrr( onu4oeeoioeiltls2rm( s;t0 lenxo3ootop rlu o;()srtmiopno1amenlici tf 2trxmpot1tltomietydfm2rlumon(4altnxr3iatlmDeaneols  ruo(o no1apte ivs ( srtmumont1olt miciad a eluvp (0arxrmf3oatfmtrai i t  rtoxo3iudale  ivtas)a2uaum ;o4aex mo3ildlm2ra(ms;t4tlenmf oytfpte i olt sruoxm3iydllte nci ( a2rmxm nt1apenifciad s2rmumon(4arerif io1oa  ai s;s0t2trir3nodlm emictls srum(rpot4tlx  icilslmDumuvs;(4trtrio3iytoat lieilt)s2tmiopnu1op  lnvs t)sDtaumooo4ape miciatlaDulnmsn()areoir3iytop ran i;(0 rtm(r3no4opt mnvi sf rra(mooo1aex  i3ild mDul(ms;u) lxomo3ootoat livilt)setmirpny4lmte nvil(f 2umumo;u1oleo i3tasfmDran s u4trtoir oatoat  n s s0sexo(r ou4alt  ncsat)s2taump;t1optniieiasfa rau pn()artomo oadlp ranvol(0texoxmpno1amt  fci t srtaxmoou4aeen feiytlsDraumont4tlxomr to1lp ean i;s s2xo(r oodomtnlnvias) rumumonu4aeenmfeilsfm2emu sn() eerxociatop eluvi s0seurirpiu4aptnlfcsa(faDuax o;t1teeomfeiys s rlu snt) ltrxf tydfptrlies;( trxr(m no1aptn iviat  rrr(mono4oltoifetyt mDeauvp (0 eerir3ta1fm r iesls0t2xo(m oo4ol  lfvtlt  2raxr ;u1aetn ocilsfaDeau o;u)tlxoiocio1opteauei;t setmxmpoy1om  liciat) Drrxmpoo1apt mi3iatla2elums t)aexnmr iodlpteauvs;s0teumxo nu4opee ivils)a2ta(rp;t1tle  iciysfsDrlumont0artrxr oatop e ivi;s0 rtrir io4oltemfvil( arra( p;t4tpt miciltfm2ean s t)aeeniocia1opt ai s;( srum(m3iu1omenmncs (farum(mpno1tlt  ietytfsDelu s;(4trerif3ia1lat  neols0 exm(r3iy4lp nmivtas)s2raum ;t1oex iocias s eluvsnu4 lxrmr iotomte uesls srxoxm3nu4lltnmivils)sDrrx pnu4texn oeils mDel(vo t4 eenmo3oo1om rliei;t)t2tmiopoo1ap nmiesls  Dtaxr no4aeeomoeildfsDum( snu4tltoiocoodlp eln ilt)srtm(r3iy4lme mneta() 2uaumooo1oltn f3iad mDrl(mpnt0texrxr io1omDrlueo;t0seurxmpiodop n fct t)s2urx  nu1ale iociytls2ran s;u0 lerio3tadoa eaieols  rxoiopoydal  lfetatfaDtm(mpot4oetnmocils m ra(mp ()texrxr3tatfatraieo t srxmiopiy1amee ivi t  rur( oot4olt micils m ra(mp;u4alenmfcoytlaDe uvi s)texr(m nu4lpenlfci (fa2taxrp;o4olxniictatlm emu s (0arxnmf oo1la rlivs;t0s2xm(rpiodol n nvt (  rraur oo4tet  feiysfa2rm(vp u0artomf iytoa   i s t teum(rpoy1omee ivi ()aDumurpoo1tetoioctys aDrl(ms t4aeenxr3iatlmDr n o t seuoiopoudop nmncsls s2rr(moot1aet iociasla um(vsn()aetoxf tadop   uvolt0 2xmiopnudal  mnetlt sDrmxm no1tpxo oeiat sDumuvo;t)tlxnxrctydfmDeanvilt0s2urxr ny1lmtnlnctasf rrmuro;o4tltn i3ils sDemnmp;u0 rxnxo3tytlp rau ilt t2xoxrpiodaltn nesas)a2raxmo;o0tee if3iadfa uln snu4 exrio ty1fmD ai o ()setm(m3ou4alenlfciat sDtrumpot0oetomfeias s eaumo;(0 lxnxr3totlaD ln s (0srur(mpno1llt  ieta(  Drrxm ;t4opxoifeilt s2emump t0 eeoxf oytomDr nvilt)s2xrxrpno4lmtnmnet s a2urx o;u1aleo iciytfm um(vs;t4aexnxrcty1fmtelneo;t)t2umxo3oo4lpt  nvi sf ruru  nt1tltnio3tasfs2ua(mpnt)trxrxr ta1lpt aivs ( trto(m3iudopt lnvs t  Dtmum ;u1tpt if3tat mDrln snt4 exrxfciodoa  aivi;( srxm(o iudam   fvsl(  rtmum ;u1alenmoeilslm2el(mp;(0trxnio3tatlat  n i t truoxm3oydlp nmfvi s)aDumx  no1alenmfeiyd sDul(mo;t0tlxriocoatoptrlu ilt0srxo(o3oodol emfcsl(fartaxmpou1oltniietyt mDemn s;(4trtoif oytfpDraies s trtoxrpoydlmt mfvi ()sDuru  ;u4olxo feiltfm ea(vpn(0tleoir oytlm ranvi s seuoirpiy4ope  ies s)sDta(m oo1alenioetytlm2rl(vsn(0 eeoir3iy1lpDr nvs;t0truoxrpoy4al e ivi t)a2rmurp;o1oltoio3ildls uaums;u4 eenmr oodfp e neo;s0trumxmpoy1altnlneil()aDtmxm ot1tetoiietldlaDua(vo;t4aetnmo oa1oatr ueils0s2xmio no4ale mfesa()a2um(mpoo1olen i3ilsls2rl(vo;u)tltoxo3tytoaDe neol(0seumxr iydoptnmncsa(f rtm(rp;t4tpeoifciatls2umuvon(4 rtrxr3to1lp  auvi s0srxmxr3oydlm emfci t)aDrmumonu1tpeo feilslm em( p (0alxnxo3totopteaneo t sruoxo3iy1lp elfeslt)sDrru pnu1opeoiociasfmDuanvont0texrirciy1fmt li il( tetmirpnu4altemies t  ruaxrp;o4teeoiicildls ulnvo;u) reomocto1la eanvo;s t2trim iudapt  netas)a2urxrpot4aet iiciadfs rmu ont) exoifciodom  ai o;t) exm(r3ny4altn nvias)sDraxrpno0oltomieils m emuvs u4 eeniociatlmt lneslt0trto(r iy1opeemivs tfs2tmx p;t1texoifetasfmDuauvo (4tltoir oadoaD lieol(0srtmio iu4lltnlnvi sfsrtaxmpno4texomfeildla umumo (0 rtoiocoadlmDrlueo () 2tmimpoudape  nvias)a2uau onu1oleomocilsla2ea(vo;t0tlenif todomDeaueo t0 2toxrpny4lptemiviat sDtax p;t4opx ioeiysfa2uanvpnt4tltrio3oydlp elueo;t  2xoxo no4optn fcias) rra(rono4alx mi3ild m rmu pnt0 lxrxo iotlpDelivs s)seuoxo ny1al   fvia(  Drmxrp;o0alxniieiatls elnmp;t)tetnmrctodfpDranvs;( s2urxo io1amen nvs (fartrx pnt0aet  i3iadfs2el(vs;u)trxoiocoy1lmt  n o;(0trur(o nu4ameelivtls) rur( pnu4tex mociatfa uan pnt0 lxoxf3tydoaDrau ol( teumir3oydamen nci ( a2rr(mp;t0tltoifciytls2el( s;u4aetniocoy1oat  ivs ( s2xoxo3iy1altnmnvsa( aDta(  ;u1optn ieildls rm(vs;()tltnxf io1oat  ivo;()teur(m3iodopeelnvt t)aDur( pou1alenmo3iysfa2rl(msnu) lxnmocootoa  aivo;t) exr(o no4aptnlfesl() Dtrump;t4ale ifcilt s2uanvo;t4 etomf3iatop rlnvs ()t2uoxrpnydlp   ictasfs2rm( o;t4aleomieiasla2rmn s ()arxrmoctytomDe i o;t0 rtmimpiodlmt miesat a2rmxm ;u0apxo octat aDemu o;(4 rermf3oydlmDraivolt0 eurim ou4lle lncslsfs2trur no1tlxnii3iydlaDran o u0tleomf to1oaD lu sl() etr(m oo4optnmivi () rua(m no1olxnmi3iysfa um(mp;t) rerircta1late u slt0 etr(m3ou1al nliesat s2taxmoot0texoii3iytfa2ran o;u0alxomr3oa1lp eaueil(0trxr(mpoydomtn iciasf rrmu poo0teen o3tltfm2ulumo t0trtrio3ootlmt aivsls0tetrxmpoydomte fet tf 2um(mpou1tet  oeiasfaDeauvsnt0alxoxo ta1faDran i t)truo(r3oy4ale  ivias aDtmxm ot0oet iiciytfsDrmn snt)aeeomf ia1laDelivil( tetm(m nu4opt mics t) rra( onu1ole ioctatls2rlnmo t4alxrmo3ia1fm  lneslt tetoim oo1am e feslt aDuru  nt1ope iociysfs rmnmsnt0tltrxo3tytlpteluvi;()s2ur(rpoo1om  lfvtlt)aDurxmp;t4aetniieiasfa2umuvo () rerxocoa1lp rai s;(0setr(o no1lmt lfvi (farrmuronu0oex ifctad m ea(vo;t4aleoxrcoo1lmDe n o;t) etrim nodop elietl(  2urx poo4tetomfetatla ulu o u0tlxnif oy1oa rauvsls  euo(o3iudlmt mfcil( a2trxmooo0tlenmoetyt m2uanvo ()texrxr3tytfmDr nei s) exr(r iodalt lfct t)aDtrxmp;t1olt ifetytfsDran ont)tetnio oatlpD ai ils)srumir iu1ole mnvs s)a2tau  ;t4aexnmi3tydlm2eauvs ()alxnmrctotopte uvs;t0teur(o3ou4lptn iciltf rtaxmp;t1opxnmfcildfa2ea(vsnu0 ltnifcoodfmtr ues ()tetrimpnudlmt  ivt sf Drmu pou1tlt mociyslm2ranvsnu4aexrio3oadla   ies;t trumxm3oo1ap  micilsfs2ta(rp;u0olx  o3tltlm umnmpnt0tetnmociodlmDrlnes;t)srumim3nu4amt  fvtas  2urxmooo1tex  o3iadfmDemn onu0trxoxr3iadop eluvs s)setoxrpou4ome livsasf Dtmxront0oltomoeilsfa2rl( on() rermo tydoptelnvs t  etoirpoo1op e fvta()artau  oo1tlxn ociys s2rau p;t)arxomf3io1lp r iesl(0sruo(mpiu4ll   ncsl() 2tr(ro;u4oexomoetadls2elnvonu4 rxrmociatoa rlies;( t2xoir nudlmeemfvtlsf 2ra( o;o4aleo iciyd m2ra( o t0aetnmr iytop  li o;(0s2xoxmpnu4omenmics () 2tmum ;o4opeoioeiaslm2umump;(0teermo3tydfm ean ol(0setmim3iy4lpeelnvi ()srum(rp;t0texn o3iasfaDemn o t) etrif3iydfaDraneo;s0setrxrpou1llen neslsfarumurooo4texniictld a2eanvp (0texrmf3ty1lmDr u ils0 rxr(o3nydllenmfvs (  Drm(  no1tptn fetytlm2ean snt0arxoxr iytfm  ai olt)trxrxo3nu1am e ict s) 2raxro;t1oeen oeiyslmDua(vo t4arxnxo oadopD lnvo s0s2toxo3nydlp e ivsa( aDrr(m ou1tptn feiatfa emu onu0trtnio3ia1fpteli o t0s2tm(opiu1om n icsat)srtaxronu0olenii3tys s ua( on(4artnifciodoaDrauvol() 2umio oydale mieiasf Dtrumooo4tpt miciasfm um(ms;t)trxrxr oodopD au o;t0 rur(m no4aptn ictas artrxm nt0aptnii3iasfsDuluvsn() exnir ootfaD anvs;(0srtrxr3oudam elivt (  rrm(mooo4tle  o3tasfm umnmo;t0tleomo3ootlmtrlivolt  rtmio3io1lpenlfvtasfsDtr(  ou1tpxniietatfmDrlnvs;u0aexrxr tydlmDelivs;s)s2ur(o oo1lmen fctas arraum nu1aeenmfeiydfmDrm(monu4 ltomf tydla eaivils) 2um(m oodalteliet sf Durum ;t1alto fctyt mDul(vsn()trtrmf3oydlatr ueo s)tetr(opio1lm emfet s  rtmumooo1tptomieias s2rm(vont4tetnxrciydoaD au i ()sruoxo nu4ll emfcsasfsrur( o;u0tpen ieiydlmDemumpnu4trerir ta1fateau o;t t2xmir3ou4aptnmivs t)sDra(root0open ictyd a rluvo t)aetrxo3io1lm eli s;( s2umirpiudal elnci s) Dua(r ot4tlt ifeiyd mDemnms;u4trenio3iatom r uvol()trxoim3oy4lmtnlfvs t)a2uax poo0aee mfciat a2uau s t0trxomr3io1om eaues;(0trxo(r oy1omenmnvslt)sDtm(m ou1olenmi3iasfaDrmu o t0artnxo oydomDraneslt  euoirpou1lmt lnei s a2umxm nu0tex io3iyt a rmumpn(4trxrxr3oy1fa r uvil(0srxr(m nu4lm emneia()sDur(  ou0apeniieilslaDea(mo;u4tltrif totlptraiei;s)trxoim3io4am e fctlt  rum(mpoo0oeeomoctatfs eanmo;u4 etrxo io1fp   nvs ( t2ur(o iu4aleelieta( a2tmxm ;o0tltoii3iaslm emu s (4 rtomrcto1om eli slt0trtrxm oy1op e ict (farur(mo;o4alenmo3iatfm2rmu on()artnifcoodfpte n i (0 eur(mpnydlme lncia(fartax  no1aee ii3ils a rau onu0 rtnxf iodfa   ueilt) rum(m iy4op   ictl(  Dtmumooo4apt if3iytlmDeanvp ()texrxo iodfmt an i s  2uo(o nodolt micsa(fa2rmxrp;t0apx  o3ildls ea(vsn()tlxrioctadfaD lueo;s0seumxmpnodlm   fci (faDur(m ot1ape  f3tad sDua(vo;u0 eerxrctytfa eluvs (  euoirpio1omtnmieiatf 2uaur no1altnmo3iysls2um(ms;u)altoxfcoydfmDeauvo t0 exrirpiy4om emfeil(farumumpno1olxnmfcilslm2emn p;(0 rtoxoctytoaDr ivils) 2tmxrpny1ome mivsa( a2trx  ;u4tetn ictyt s2umu s;()aexoio3oo1laDeaneilt sexrxrpoy1opee nei s aDurxmpno1tleomf3iadfm2raumon() leriocoatoat ai o ( sexoim3iu4ap  lict (faDraxmonu1tpxo oeiyd aDemuvp;u)aexrif oa1faDe neils0t2xoxrpou1lm n fci t)sDrr(m no4tlen iciys s um(mo;(0aeenioctodom r ivs s  2toio no1amtnmncta()srururono4opxn ocilslsDemnvpn(4tlxnxocoydfpDr u sls  2trxr3iy1omtelfvt sf Drau o;o1optomo3iadfsDum( pnu)alxrmf3tytfmtelivi;s)srxoxo3ou4omen ieiat) Draxm ;u4oleoiiciadfsDumnvo;()treoirciodlmDeln olt0 rurimpio1lmee fes tfarra(  ;t1opxoifeiat m2uanmsnt0 rxrxf tatopD aueo (0sexo(m3iu4olt mfviat) Duaxm ou0tlxniiciyd a2rauvs;u4altnxo3ta1omtrlivo;s s2xmio3ou1lp emfctl()a2trxm ;o4tpxo octys mDrlnvpnt0alxnmr oadlat  i slt texoxo nu1lptemnvs s a2umxmp;o0olxo oeiyd aDum(vo t4altoir iadlateluvils0 rum(opoudlp emfeilt sDrmx  nu4tltoio3tatlsDumu s;t0artnifcoy1oaDelueil(0trtmim3iudope  fctas  Drmx oou4aexn fciytlaDemnvp;u4 ltoio3oodlmD aivo t) 2uoir3iu1ap elfvt tfsDurur ou4oltnmf3ildla rau p;t0 lenmf tytlp raieslt tetm(r3oy4ol e neta(f 2rrx oot4teenio3iad a2ulnmo;() eeomr tadfp r ivi;s t2ur(opio4omtn ncil()sruru poo1apx mfeildfm rauvs;t0artrxrcta1oa e ivi t s2urxm3no4lpt mnci s  Dua( oou0opt mfcilt aDrl( p (4 lxrmrctatfm eauvi t t2tmiopoy4lpte fvt t arrmxm ;t4oltniicils m2rl(vpn(4texriociadfm raueilt sexm(opio4olte ietat artmxr no0tleomieilsla ea( o;u4altoir ta1lptrlneo;t)t2toxmpnudopeemivta(f rtm(mo;t1apeomoeild sDua(mo ()arxnif oytopD ln i t) exmir no4apt  ict tfs2rmx o;o0tpe ifciysfa umn s;u0tltrio3oa1omte u il(0 exmxr3ny4amt mfeiasfaDum(ront4aee iieiyt a rl(mo () rxnxrcoy1lp  lieol() etrxm ny4aleemfvi tfsrumxmo;t4tlxn oeiytlsDrlnvsn(4alxrmf iytoat an ol()seurir nu4om  micsat)srtru p;t1tlx mfciat m umnvs t)teeoxo iydoaDeln o;s  rumimpoy1amtnmfct t)aDtmu o;o1ole  f3ilsfs uan o t4tlermoctatopDranvs;(  exmxr3oo1apeemncil(fs2rru  nt0oex miciadlmDulu pnt4trerio3oytlmt lu i t)tetriopoodlptnlfci (faDrm(m ou1olxnioeiyt m ulnmont4aexnxf iodlp e uei;s) exriopoy1am  lfet s)arrmxmpoo1oetnioetys m ea(ms;u4altrxo3oydomteai i t  eumio3io4alenmivslt) Dtaumo;t4teto octytfa eauvonu0 lxomr totomDraueo ()tetr(r iy4op n ieiasfsrrrxrono1aex iietasls2rl(ms;u4arxrirciy1lp rau s t trumxo3iu4alenliviat)a2tauro;u0aex ifeils aDeau sn(0aexrxrcoatlp  luvi ()srtrim3nu1ap nlfcs (fs2uaxr ;o1texo fctasls2uauvpnt4texnxo iydopD luvs;t  2urio3oo4lpe  neiat  2ua(mp;o0oexnii3tatlm2rluvp t) leoir tadfatr iesl( s2xm(m3nu4ameelnvsls)s2rmur nt1aex ifctltls rl(mpnt0aexomo3ta1la r nvol(  exoxo3iy1lpe micsl() Dtaump;t0oeeo fcild aDel(ms;t4aetoxf oadlate nvolt0 2trxr3io4omee ieia()srra(mono1ope miciysfm rln p u4artrmfcio1lmD livils s2umim iodlp e ivs s a2ururonu4openifctldla2rl(mon()teenmr3iy1fmtr ivi;() 2tm(o3iydoptnliciatfarrrxmo;o1aetoioetldlaDrmnmont0trtomr oatlmDelueo;s trurxm nu1ll nmiviat) ruaurp;o4tpt mictysfsDuaump;t0 ltoiocia1lp rlues;t s2tr(r ou1amtemfciatfaDraxr ;u1oeen ociatla2uanmp;(4 rtoxfciatlaD anvols sexmio iy4lmenlnciltf rurumpoo0opxoifetasfsDulnvp u0tleoxoctadlmtelneil(  exo(r ny1ape livta()sDtm(ro;o0ape iietytlm rmn s;t4 lxomf3oytfp  lnvo;( srtr(r no1op nlnet sf 2taxmp;u1texn feiysfa elu o t0tltrircootlp r n o;()s2tmxrpio4lm nmfesltf 2tm(ro;t1tptnmo3ilsfm2ulnvsn() lerif tatfaDran s t seumir3iydap e ieiasfsDtmxrp;o4alen i3iat aDea(msnu0arxrxo oa1opt  ivol(0trtoxr nydal  miviatfsrur(rpou0ape ifcildfsDea(vont)areomfciytoa rlues;()trtoimpoy4optelfviat  Dumumo;t4tleo ieiydfs2elnms (0altoxr ta1la   i s t)srxmir iy4lleemncs t arrmx  oo4aeenmi3iytls2um(mp;()texoxo3tadopteanvo;(  2xm(opou1lltnmfcias  2urxm ;o1oltnmo3iyd sDuluvon(4 exoio3tadfat lieil(0 exo(r nodap n netasf 2rm(rooo1olenmi3iaslm rl( on(0arxniociy1om rlueils)t2trim3io1lpt mnvilt a2rau p;t1tpx iociytls ua(vsnt0tltrmoctodfp   n s;()t2trim3iu1ol elfet s)a2tax  ;u0aetomfetls a2eauvs;t0tlenif iadoa raueols)seuoim3nudoptemfctl() rtmumpot0opxoiieildlsDul(mp t0teeoxf iodfp e ieo;s srxoimpiydam  lnes (fsrur(mpnu1tlenmi3tlsfaDuaums ()areomrcoo1fatrauvols0 exrxo3iu4lp  livils)sDtrum oo0opxoif3iyt sDranmsn(4artnmocoy1fp eli o s trumim iu1apeelnvsat sDtaxm ;t1alenmoctltfs ulump;u)altrmr oa1fp  aivi (0teurxm3iy1openlfetasfsDrm(mo;u4altomfetlslsDuauvpn(0 lxrmf iydfat  ies;t)s2ur(opny1altemiesl( a2urx  nu1tetomfctytfsDrl(vs u) rtomf tadlmDe uvo;( t2xoxmpnodlmtnlnes (fs2urxmono0opt  ieiytla rlump (4 reomf totoa  lu ils0t2toxrpio4olenmfci t)a2ra(rono0teeomfciatlm2emu pnu4 eenifcio1fpDr uvils  exm(rpnudopenlfviatfarururp;t1ale mociadfm2emnvsnt)trtoif3ootfateln slt)seum(m nodop  lfct t s2rrumpnt1tlxn f3ild m2rlu p u4tlenmfcoatfa e uesls srxr(o3iydapt mncsl()artmu o;u0tlx mietat m rauvsn(0 eeoir3io1la  anei s0seur(r iy4am emfvtls) 2ra(moot1oexnmieiasfsDul( ont4 eeoioctatlatr ueilt s2um(r oo1aleemivi (  rum( ont1tlxnmoctld a2rl(mpn(0altrmo3oytop r u i () rxoir3no4opee ivsas)aDtruront0tpx  i3tys a eanmpnu)aexnxf3tadopD auvol()srtr(r io1om   fcsatfsrrr( poo0tlx iicild m2ea( p;u4 exrxo oodfat lneolt t2xr(opoo4ap  mfcia( a2rm(r nt4apxnmicildfm2rlu s;t) etnxrcoy1omDrln s;( t2xoxm oo4ameemnetl(  2rr(mpnt0tlenifeiydfm emu p (4 ltoxfciatfaD lieo;t0teuoxo3iudlp  livsatf Drm(rono1tpxnifetyd m2umn o t0aleoxociytlmtrlnvi;()trtrirpoo4amee nvtl(faruaxmpnt0teen fciyd s2eau p;u0texnxr tatlm  li o;(0 2uoxr iodome mnvi t srurur ;o1aee  i3ilsfm em(vo (4 etoxr3ia1oa r uvs s0 rxmir3iudaptnlnvs sfaDrax  no4aetomfcilt m rlu p;(4alenxr3iydfm elies;t setmir3oodap  lfesatfa2tr( oou4aeeomociysfsDrm( o;t0texrxr3tytomt  u o;( trxo(o3io4lmt  fct ()aDtm(root4olto i3iysfm rm(mp;(0 lermf tytfmtran o t0t2urxo nudoltemfvslsfarurump;u1opeomfciad mDea(vo t4trxnio tatoa e uvs s  2trir no1omtn ics (  Dtrx pnu0aeenmociysfa2eaums () leoxr3tytomtrluvo;s  2toxo nudope  feiltfs2tm(m ;t1ape  i3iadfaDrm( p;u) leoxr totfptr u i;t teumiopnudomenlieiat)srtrxmpot0apt if3iytls rl(vp t)tltrif3oatlpDranei ()t2tr(o oudaptnlfvi tf 2uaumonu1olenio3iat m elu o;t4trxoxf totopt luvo s0 rxr(m3nu4lpt  nvsltf 2rm(mpou1apxnmo3tytlm eanvonu0 reoxo iadfmt  u olt t2umxm3iy4lp n ivsl(fs2rr(rono0tleo ieiyt a rmuvs;t)arxrxf3oo1oaDranvi s0t2uoxo3nudlp e nciat)sDtax  no1tpt  o3iyt aDua(mpnt)aeerir3todfaDraivsls sexo(r3no4lmt  ncs s sDtm(root0teenmf3taslm um( s;u4areomrcia1lmtrli o s0tetoxm nodlp  lfvt s)s2ta( pnu1apt iietytlm umu snt0alxoifcty1fmDraivi;s t2xmiopio1ame mictasf rur(  nt4ale  oeild a2emuvo;u) ltnxf ootla r i s t0 2xm(r3oodoptn fciasfsDurx  ;t1aeeoii3iytfs el(mo (0trerxfcoy1omDraieo;(0srxrirpou1al  livs s) rraxrpot4tle io3ils s2emnmsn()aexnmr iotfmt luvslt0 rumim3ou1lpt mivil(faDtrxrono0apxn iciasls eau s () renxf totfmt aues;s0setr(r3iu1ale lieta(f rtaxrp;t0oexnmi3iadfs emu s t0trtoxfctydlaDraneo;t tetmxmpiu4lpen ics s  2trump;u0optoioctldfm eau s u0 lenmocootopD auvsls) rxoxr3nu4lp emfvias srua(mooo4optoioetldfmDeanvs (4tlenxf3ta1op eaneo;t s2um(o oodol   ivslt)sDra( ont0aeenifcils a rmumo;u) etnmr3tydfp   neo;s tetrim3ou4lm e fesas  rum(r ;o1opxnifciydfsDeanvo;u4 etomrcoa1lpDeaiesls) exrxm3iu1lpenlfciltfs2tm(mo;o0teeniiciltfm2rmuvo ()artrio to1fatraues;() 2xo(opnudomeelietasf rum(mo;u0aexniociytls2um(vsnt)treriocto1omDranvs;( trxr(rpnodolen icta(fsrrmxrp;t0oltn fciltfm rmuvs t0aetriocoadlmD  uvi ( teuoxrpou1lp nlneil( sDrrx pnt0texnioetatfaDumnmsn(4altoifcoa1fm   u i;( setmxr iu4ol e nes (  Dtaxro;u0olen oeiydlmDrluvs (0tltoxo3iodlmDelu i;()trxrim oy4lpenmnvsat) Drm(mo;t0teenii3tydlsDranmp u0 ltnmf iadfmDr nvi s0trxm(m3oydlme  nvsat aDta(ront0olx ifetltls2emu o;t) lenir3io1omte i o;t0sexm(o3iudlmenlieilt)arur( o;o1tpx  octas a umuvs;() ltoir3ta1lmDe n slt setmir3oydoptn ies sfsDuaxro;o1aeeomoctltfs ea(vs;t0arerxoctatfmt au slt)t2uo(r3iudlleemivia(fa2uru  oo4tleoiieiltfm ua(ms;u4aeerif tydlatrln i;t)seuoxo io1al  licsat)srrrxr ;u0ole io3ilsfs2umnvon(4trxnio tydlaDrln s;(0t2xo(r io4ll  mncilt srurxr nt1aeto iciydfm uau p t0areoxr iydlpDe uesl( truoio3iodlp  miet (farrmxmonu0ale  i3iyt m2rmn o;u) rxnmrctadfmD livi;(0setr(o ny1apt mnei (  Draumo;t4oee  f3iysfm rm(vs;u4teenmr3to1oatrlueo s  rum(mpny4opt  nvs (fsrrmu ono0tlt  ictlsla um( o t0tltrmf3oo1fm  luei t0t2xrxmpiy1ope  fvs ()srtrx pou0alt iociyslaDul(vo u4aetnifctadfmD lnesl() 2toiopny1lpt  feias)srumxmpot1apenmi3tldlm ranvs;t4aetrxfcootfptelies ()truoim3no1altelfetlt)artrx poo0tlen fetlsla emn snu) ltomf to1lmtrauvs s texoxo no1lptn fesasf rra(root0tpeo o3ias aDum(vp;t0teenxf iotoptrau i;()teuoimpny1omt mivsas) Durur ou1tlt ifeils s2emumpn(0 etrircia1fptean i;t0 2xrirpiy1lltnlncsa(f 2tru p;o4texo ocildlm emnvp (0 rxrxr3iotoaDr i s s  exm(o3iy4aleemivils  rtmxmo;t1aetnmfciadfs2rlnms;t0aetrif oa1fmteaueo t) 2uoxrpno1lmen fcslt sDraur ;t4alxo icild mDemuvo u4arxrxocto1lmt anesls)t2um(m iy1alenlnvtas  rtaump;t0oetomo3iysfm el(monu4alenmo3oa1oat  u i () 2tmir3nu4amee ictl() rtmu pnu4optn fctadlsDuaumont)tetoio iadfp rlnei;s0trtoxo nu1lpenmfcsls a2rm(r nu0apxnifciasfa2rl(vs u0 eeomrciodfmDr nvs t) eurxr3no1llenmnvi tf 2tr( p;o1tpt  oeild mDea( onu4alerir iy1fa rlnvilt srtm(r iudlp nmfvs t sDuaxroou4teeomociydfs2ean o t0texoxo tatla ean ol( s2urimpnu4lltemnetatf Dtrx p;o0tltniociaslsDemuvo;(4 ltoio oodlpt lnvi;s)t2umimpnudom  mietasfsrraxm oo4tltnmfctyd aDum(vo;(0aleoiocoo1fatelu sls s2uoirpnodamte ncsat srtax o;u0ole  i3iat aDemnmo;(0 exoxr oydfaDr u o ( t2trxo oy1alee iciatf 2trum oo4aeto o3iyd m2eluvs (0 lxrmo iotfmt  ieo t teum(opoodlm e fvs s)arrr(m ;o0ole  fetasfm2rm( sn()aeermr oytlmDeliei ( sruoim nudaptnmfesltfs2raur ;u0aetomoetydla2ean o;()arenio3iotlmDr nvo;t)sruo(m3oudol elfvsa()a2umxroou1olxomfeiatlm um( p;u)tetnif3iydomDe i ils trur(m3iu1ll nmnvt s) Dtaxrp;o4oexnmf3ild m2rauvp (4tlxomo3iydfmtrlueilt srto(r3oy4om  lnciat)sDraxm nu0opt mfetyt m2uln sn(0 lermo3ty1la eai o;s)srurim3io1ll n ncilt)srrr(ront1aee  ociysfm2um(vsn()aetnif3totomDrluvols t2umio ny1lptn net tfa2trxmpou4tlen oeiasfa2uluvpnu0trerio iotop ranvo;()trxrim iudomenlfcsl(f rtaxr nt1tpen ictlsfa2rauvo (0 rtrxr3oytomD  n o;s0trtmxrpny1omtemivs tfaDtrumpnu0teenif3iydfs2el(vp t0 rtnmf3oytfate ivsls0 eumim3oy1al elnctltf Dua(rooo0aet  iciat sDea( snu0 exnxocta1fpDr uvslt0trtmiopiy1lm emfvsl(f Duax oot4apxomfeiydfm ulu p;u0tltnif io1faDe ies t)trumim iy4al  mfciatfa2tru pnt4oee  ociatfm umnms u0 ltnxfctytfa   uvo s)t2uoio ou4lm  mnvtl()sDuaxrp;u0tpenmieiys s2emumpn(4aleoxr tatfa r ivols  eumir3io1aleelnvtl()a2um(mont1teeo i3tys m ean snt)aexrio3iydomt  ues s0s2um(m3io1llenmfvta()arurxro;o0olx mfcilsfm2rmnms u0alxoif iatfpDe uesls)teurim3oy4ope lfviat)aDuaum ;u1openmiciasla2rluvo t0tlxnmfciotfm raiesls tetoxmpou4ll elnvsltfsrumxmo;t0apx mfciltfa2rm(msn(0tlxrmocoadlaDranei;t)s2ur(mpio4lm  mnvil()srumu o;o4oltnifctyslm eauvp () exnxrcty1fpt auvi s s2tr(mpiy1ol n feias)a2umurp;u0tlx moeilt m umuvo () renmf3iotfaDranvs;(0t2um(o3oo1lp eliet ( artm(  no4aetomietltfs ua(vo;u4arxomociytopteanvo;t)s2tm(o oy4op   nct () 2rax ono0ape if3iysfsDel(mo;u0teenir oytfa raueilt0 rxoxmpiy4omenmivils)aDraxrooo0ole moeilslm em( p;(0alerif totlmteaivi;s)s2xoir3ny4lpe  nctls)sDumum oo4oex mi3tytfm ea(vpn()treoio ta1oaD luvolt s2toim oo4om emnvi s)aDumxro;u4tptnmf3iltlaDrl(mo;() lxoxo3todlat  ivo ( srxr(m3ou1lpenmieiat)s2rr( p;o4optniieiys a umuvo (0 lerirctadomD lu o;(0 rxmiopnu1lme  fei t)aDtm(ront0tleo f3tydfsDrl(vonu0altnio oo1lmte n olt0trxrim no1apenmictat arrrx  ;o0opt micild mDuanmo t)arxomocoa1oa rlnes () etoxmpno1am   iei tfa2rmxm nu0apxnifeils s rm(mpnu4alerxf io1opDrlneslt0 rtrxm3io1llen netas) rraurp;o1alxomiciad m2ua(mp t0artoxr3ootlate ies s0 rur(m3oudam  mfes t)a2rm( poo0alxoii3tadfs rmuvont4 lxoircio1lat lues;(  rxm(r3no4op eliet ( srrrxrpnu0opxomietysla elu o;u)arxniociadla  livi;s t2xo(o nu1al emnctlsfsDur(r no0tleoifeiysla rmnvs (0artoxo3todlp rlueolt)sexr(mpou4lmtelietlt)artm( p;t0tlenmo3ias s2ranvs;(4teenxo3ia1lmDe ivols)s2tmxrpoydapt  ivsltfa2tr(mo;o1olx mi3ildls2rmn s;()aleoxr tydlate neolt  rxo(r ny4alenlnviltfaDrr(ront4aexo o3ilsfaDrl(ms t0tlxoxf3iotlm   i s ()s2xoxmpnu4lmt  ivt ()s2urump;u4tpt  oeiltla2elu o;u)tleoiociatlm elnvo t) 2um(m iydopte icsl( aruau poo1olxnmoctat a rl( s u0 rtriociadfm  aneols)trxoxm oy4op nmfvslsfaDta( pou4opx io3tltfs uluvp (4areoif iodoptrau il(0texoxo3oy1olenlnvt ( sDuaxrpno4tpx mf3iadfsDua(ms;u)teenxocty1omDrlieo t)seurxo ou1lmtnlnei (fa2ua(r ;o1teenio3ilsfm2eluvp (0trxomr tatlptr n i;s trur(mpny1llte ivtlt s2uaumpnt0tetnmictltla rauvont0trtoxrcoydfaD  ieols0 exrxmpnu4lp nlies tfsDurumpnu4aptnioeilt sDel(vp;t) rtoirciydom elneilt teumiopoydopee ivtlsfa2rm(mp;o0oeto ietasla2uauvs;t) lermr3iatlpt lueo;()sexoxr3iu1ll e fcslsfs2uru pno0oex iictysfa2emnvp;t)tetnif tatomtr i i;t srumxopnudlmt  nesa(fsrra(monu0tpeoioeiytlsDeluvs t4 etrxr3oo1fpte ueo;s)sexoxo3oo4al emieil(fa2rau p;u4apxoifeiydfaDeanmsnt4 renxocoo1laD anvilt  rurim3ny1lpenmivsa()s2uaurp;u0olenmfeiysfm rln pn()teeomfcio1lmDr neo (  ruoxo3ou1lmt liesasfaDtm(rpno1aetoiocild mDrm(vont)teermo oatlp  anvi t0teum(o3oy4alenlivilt)s2um(roou4tlt  feiyd m2elnvp;t)altnmf totlpDelnvils0setrimpio1lltnlfeia( arraurp;u1oexoiieils mDrl( o;(4 ltoxf3oadlmD au il(0 2to(r nudapee ivi () 2rmx pnu0aeeomociysls umnmo u4aeermo3iy1om rluvi;t0srurio iydam nmfci s)a2tax pnt1alxoifeiatfsDrmuvonu) ltrir3iodfm eauesls0 rtm(m3no4lpte ncil( arrr(mpoo1alto f3iytfm2rl( snu4 lxnxoctotlat anei ()texoir3oodllt  fei t)sDra(mp;o4optnioctlslaDuln o;t4tltnifcoydlmD livo (0 2xrxr nudom nlnvt tfartax o;u0aex mi3tls mDranmonu4altnmf oytomtrluei;( texrirpiydaptnlnvi t)arum( pnu0altniiciyt m umums u)altomf iatom e n ols)t2urxm nudam n ivt s)s2urur oo0apto f3iytls2uan p u4trxnxo tytfpDrlieil()texoxo oodal   ieta(fa2rau pnu1tpe iietas aDrl(vp;u)aexrmocootlaD lneil() rtmxr iydlmtn ict (fs2ra(  no1alt io3tld a2rmuvpnt) rxrxf3totlatelues t) euoxm ny1apt mfcsas aDtaump;o0oexo fetadlm eau sn()tlxnir3oa1fa  lu i s s2umio iydaleelfvs ()s2ra(r ou0tle mieiatla2umnmo u0texrirctatop rlivo (0 eum(o no1ameemnci t) 2tax o;t4aexo ociydlm ulu p u4aexomo3oodfa  anvi t0srur(mpou4lle lfesas)s2ur(rono4opxomoeiydfmDean s (0tleniociotomDrlu i s) 2to(m nu1aptemicia()artrx pno0oexn fctadla2emuvpnu4trtniocoadfmDr i o;s teum(mpiy1op  mncs s  rtm(mo;t1ape  fctatfm2ua(mo;u) eermo3oa1omtrauei ( tetmio no1amee nciasfs2rmx pnu4oex mo3iat s2ran s u4arenxr3iy1fa  livol()sexo(r3iy1omtnlfci ( artmxrpnu1alxnii3iasfa uanmp;t4tlxoif iotfmDrauvo;t)srtmio iu1amen fetasf Dumxr nu4tltoiociatfa2rmn o () rxoio3oytlm rai o (0sexrio3oy4opeemfvilt)sDtaxm ;o4teto i3tytfa rmn on() rerxr3oytopD livi t  rxoio3nydlmte net tfaDtr(rpou4alxnif3iysfs2eluvs u4 rxrxo3to1fmtr u o;s  exo(mpno4al e nvta( a2rm(  ou1tetnmfctatlsDuln p;t) lenmr iadoa elivs;t s2trxr io4op nmiet () rraur ot1oex moeiatls ea(vonu0teenmr iotfaD ln i;t s2xo(mpiodll eliesatfa2ua(rpnt1tet mo3ilsfa2rauvs (4 ltnircia1omDeanei;t0 2xriopoy4ole  icta(faDurxrp;t4apxn ieiat s2ul(vpn(4trtomo3oo1lmtelu o t s2xm(o io1apen fvsatfaDua(rono4opx  i3ias m2emnmo;t)trxnmf3ootla e nvo;s) rtrio iu1apt  ieils artax  ;u4altnmf3ias aDum( p t4 rtoif3iytfm rluvs t t2xr(opno1optemnvsat) ruauro;t1ape ioetysfa ea( snu)alermo oatlmt aiesls)sexoxrpnydaptnmfvsatf 2urumooo1opt miciad a umn p t0tlerir3ty1fmtrluvs (  etrxm iy4apt  ncsa() ruaxmo;t0opt mi3iyslmDra( s;u)texrmrcoadfpte u i s)srtrxm no4lm nmivtlsfsDumxro;u4aleomfeild a2ra(mo;()tlenif3tatfptr ieols0s2trxmpiy4om e feil(fsrtmurp;t4texnif3tatls2rmnvs u0arenio ty1opDrli i s) etrxo io4al emivsa( sDtm(mpoo0aex mo3iytfaDrlu o;()trenxr3oatlaDr n i;s)t2urxr3oy4ope  nes sfa2rr( o;t1oexomi3ilt a2um( pnt0tlxnmo iadopDrlivi (0trxoim no4amtnmnet sfsDrrurpnt4ape moctaslaDem(vo;u0altnxf3iy1faDraueo;( texmio oudap  mnesatfaDtrxmono0tlxo feiat m rlnmsnu0tleomo oatlmtrluei;(0 euoim3iydllen ncilt aDtau  nt1oet ifeiydla2em(mp ()arxnxocoadfmtranvslt0sexm(o no1ol elici t  rtm(mpot4olxnmfctatlmDum(vo t0 exoir ta1lateai s s0 rxm(o3iudll  lnvtlsf 2trxm no4aexnmfeilsls2elu s (4tlxomfcoatomD auvo;(  ruoxrpiy1ap elivt sfs2ta(m ot1oltnmoeild s2elu pnt4arxnxocty1omDeli s s) rxmiopio1lmeemnvsls)aDrrx ooo1tltn i3iydfm2ua(monu0artnmr3ootlmD ln slt t2xr(m3ou4amtnlicta(f rumu  ;o1openioctyt s2em( sn()aexnmoctydomtrlueil( s2xm(o3ou4am n netls  Drmxr ot0tetoii3tydfa um(mp;t0tlxrxr3tadoaDr ieil(0sexrirpiydap   neta() Drr(mont0opeoiictadfa2rmumo u4 lxoxf3oytom eaivs (0texrir3nydamtemics tfs2tr(  oo4tlen o3iadlsDra( o;(0trxrif3iodlp  lnvs;(0s2xoxo3oydllt lfvta( s2ua( ono4ole io3iaslmDel(vs t0altrxf3oytlp r nvs;s)sexrxo iy1om  mietl( s2ra(mo;o0tpenioetltfa2umu s ()areomfctadfaD  uvi;s  2xm(rpnudlme micta( aDurxmooo4apt ioeiydfs2ra( ont0aexnxf3oydlm raieil( s2xriopoy4amt lfctlt)s2um(ro;u4tlxniocias aDemumo u4arxrmr3ta1fpDrlieo s0 2ur(r3iodamtn iesl(faDtr( o;o0tleoioeiyd m2uluvs (0aeenmr3ty1op   n i ( sexo(o3iu4ole  ivtlt)sDuaum nt0oeeo f3iat m ran o;()alxrio to1fa  lu o;()srumio oy1aptnlfvia(f Dumum ;t1olxn f3tyt s2rmuvonu4 ltniocto1lmDeaneo t)texm(r3oudoptemies (  rumxmpnt0aleo i3tat a rl( s;t0teermo iotoat  ies t teumio3ou1oltemiciasf ruru  ;o4apen ictydfm2ua(vp;(0aetnxr ia1fp  aueo t) 2xoimpiydllenmieiatfs2urxmo;t1tleoii3iytfsDum(ms u0 rtrmocio1lmDeln o;t) 2tmirpiy1lmenlnci (farrrx  ot1tle iociatls2emnmpn(4teerxr tatfa  lues;s setm(m3oy1ap nlfesls) Drm(rpnt0olxn oetltlsDrl(mp (0 etnxr oa1lmt aivo;t  2tr(mpiydole  fciasfsrur( o;t0tlx iietat m rlnvp (0 ltnxo3ty1lm r neol() 2urimpou1aptnmfetlsfaDra( oou4open oeilt mDulu sn(0alxrxf oy1latrlies;()sexr(o3iodomee nci (fsDrmx pou0aet  octyt m2rau p u) rtnir ia1op rlivolt)t2to(o io1ame lfvils  ruax  ot4tee moetydfs rmn on(0 rtoir iodfaDeli sl( seurxm nydlp n feslt)arrauro;t0alen i3tyd sDra( o (0altomr3oatfaD livil() eurimpiu1opee fci () 2rax oou1apenio3iytlmDuln s u0aexrmo oatfaDeluvi;(0 exrxrpoy1am   fvsa( s2tax  nu1olxnio3iltfa2raumsn()trxrxoctotfp eli s (0 2umim iy1om  mfeiat)a2tr(root1texn o3tatfm2emums;() lerxr3iytfpD au ils)seum(opoy1llte neil( sDrm(ro;u4aet ifeiyslmDrm(msnt4artomo3iydomt  uei t) rur(o ou4lmt lnviat s2rmu pou1ape ii3tysls umn o t)trtrxfcoa1faD  n o t0trtmio oy4lptnlfvil() Dtrxroou1oetoiiciysls rmn s;() lxoxo iotla  au olt  etmim3oo4ame lnet sfs2ta(m nu1opx ii3ias a em(vs t0artnxr to1laD  nes s trxr(opoy4lpeelicsas)sruru pnt0tlxo fctls s2ulnmo u0 lermfcta1opDrlueo;s  exrxm3iodllt  ies ( srrmx ont0opxomfciysla emnvp;t)tlxnmo3oodfm  aies;() 2urir iy1ap  mfcilt arua(m ;u0tptomociasfm raums;t0 ltrxo3tadfa elies s0 euoxmpoy4am n iesltfs2ururoot0apenii3tltlmDra(mp (0arxrxr tydoat ln sl( srxoim ny4opt  ici sfs2uru pnu1olxnmfciydlm2ua(vpnu0aeenxr3oy1lpte nvi s  ruoir3oo4lme micsl()s2rmxmo;u4alenmoeiydlmDrluvo;(0tlxoxr3io1faD  nes s0 2xmio3iu4op   fcils)sDtmurp;u4oee  oetltfsDeaumsn(0tltoxo oo1omDr i s;s0setmim iudopenmfci tfs2ur(m oo0ape ioctldfmDumn p;(4 rtoir3oa1lateai ilt  exoio3nudal e ivsas) 2rr(mono4aexoif3iad m2em(vs;(4teerif3io1lpt lueol(  euoimpnudoltemivs ( srumxmpou1aee mo3iatlm umump;u)alxnmr3oytfaD aies;()texm(mpny1ol n ncil( s2ta(mono1apx  ieiat s2rmu onu0 exnmf ty1optranvi;t trtrio no4amtemncslt)a2uax oou0alx iieiyslsDum(msnt)tetrir3iadoa   ieo;()srxmiopnu4alt mfes t  Draurpnu4tlx  oetas aDrl(ms (4tetnxf iy1om  luvi;s setr(rpiu4omtn nctl() rtau ont4tpe  oeiat m uan p t0tltrxfcta1lpteaneolt)trxrxm no1altnlicsatfsrrrxmp;u4aetn oeiat s ra(vonu4aexoxr totlm elnvi ()s2to(mpno4lptnmfeils) Dtrxm ou0alxn ietls a rlnmp;(0texoir3tydopt  uesls s2tmirpou1omt mfvt s)aDtm( o;o1aexoifcilsfs rauvpn(4aeenioctodlp e uvi;s)srxoir ou4ll  lncil(faDtm(m ;u4tet  ietld s umuvp (0 reoif3totlaD  ieo;t)s2uoiopoydlltnmfesltfa2umurpnt1tptnmi3iadlaDuau o ()trenxoctadopDeai s ( t2tm(m ou4am emfesas s2trxm ;o1oltnifciat sDumnvo ()tlxomf ia1fm rlu o () 2umim3iodop e nvslt)s2tr(mpno0opeoifeild a2emuvo;t0 etomr oydlpD aies ( setrxrpno4llee fes s aDuaumo;t1aleo oeild m2ea( p;(0 ltrmf3todfmDe nei;( texr(opiu4lptnmnctas  Duaum ou1tpt miciydlsDua(msnt)trtrio oatlpDrai o () exrio ou4ap nliesl(  2rmxrpnt1opt iictldla2rlnvp (4tleoxoctytfatrluei;s  rtm(rpiudomtelictl(fs2rmx  oo4tpt  oeiasfm2rl(mo (0tltnxr totoaDrln o;t sexmxmpiy1apt lies tf Dumx oou4oet iocild sDel(monu)artoxociodlaDr uvil(0 2toxo no4oleemnviatfsrraxm ;u1apt moetltlm rmn s u)artrxoctytlp  lnvo (  2xr(r iodlle lneta() rtrx p;o1opeo iciasfs2eanvo t) lxnxr3oytfat lnvs t t2toxm3iodlm nlietat)a2rr(  oo0apxo i3iydfmDuauvs u)aexrxf oa1lpDrlu sls srxr(r ny1ap   ncslsf 2rr(mp;o4tlx  feiytlaDuluvpnu0trtoifcoa1om  lu s;t0srum(o3nodom nmfvtas) 2rmumo;o4optnif3iyt sDelums;(4 rtnir3io1latr nei ( texrim nudomenmnei t)srum( p;t0tpxn i3ilsfsDemn s;t0teenmo3to1lm  lu sls setm(r ny1optnlnvi s) 2ra(mpou1tptn o3iatls uau s (4 rxomr ta1fmDrlnvo;s) 2xm(mpnodllte icslsfsrtrxrpoo1tlt mfciatfa2rluvp;u4tleoxr tydomDraneols0s2to(mpiy4al  mfeilsf rta( o;t0oetn fciltfs umnvo u0 rtnioctotfm   ueo;t)s2xrir3io4apt mfesat arua(ront0oleomieiyd a2em(vo;(4 rtniocio1fmDelnvilt)s2tr(opiydlmt lnet sfsDumx  nu0tetnifetytla2uaump;t)trermo to1fp  an slt0 rtoxmpnu4op nlncta(fsDrm(rp;t1tlenmo3ias a um(mp;() eenxociodoatr uvo;s0t2um(m3oy1ll emfct tfa2tmumo;u0olenmf3tys aDulnmpn(0altrxo to1fa  aueol(0 eurimpiu1omee ies ()srtax pnu4aexo fetldlsDrlnvs (0 eenir ia1fmDeau ils)sexoirpoydop n ics sfsrur(mpnu4oee miciyt a emn o (0 lerircoodfp rlues t0srtoiopny1altemfct sf Dtaxrooo1olxo i3iytlm2ra(vp t)aeerxr oatfm rluvolt) 2uoir3ny1op nlfcta()s2umur nu4openioeiydfa2uanmp ()trtrxo3ta1faDraivsls0 eumxr oo4lptelncsas sDumxr nt0optn f3tltfm eanvo u0arenmf3todop elueols seuo(rpoo4ap  mieta(f 2tmxm ;o0tlt io3iad m rau p;(0 lxoio3totoa  anvils0t2xmir nydalenlivia(fsrrmu oot4tlxnifctasla2rau p u0alxrmoctydfat ln il(0s2xm(rpoudal  lnvs t) 2ua( pnu4aleomf3iytls ran o u)teenxoctydlpDr n ils0 eurxo nu4lm n nvilt aDrrxr nt0alxomiciytfs2uanms t0 rtnxf iodomDelieols) etm(opoodap elivt (fa2uaumoot1aexomfetadlaDrm( pn()tltnio3oytoa  aivi ()texoxm3ou4altn nvtlsf Dtrxmo;o4tltnmietltls rm(ms u0tlxrxr3iydlm eanvilt  rumxm3oydlpe  nesl(fs2taurono1alxo ieiytlm emnmp t0trxnirctydoaDelivilt0trtmxr iodame  icils aDtr( poo4oleoio3iydfa em( p t)artrxoctatfaDeluvi t0teto(m ny4omt  icsatfs2urumo;t1tptn i3tatlm2rluvs;u0 renif3tadlptelieslt) ruoimpnu1lle lnciatfa2tauro;u1teen i3iysla rau s;u0texnir iydlaD lu o;s)t2urxopnodlmenmfesl(fartr(mpnt0tleo feiyt a2ulu s;t) rxrxf iatlmt ai s;( t2tmiopio4alt miviat) Dum(  nu0tpx  iciatla2eln o t) etomr3iydopD au olt0s2uoir oy4op e neslsfsDtr(  ;t0apx mieiytfa rmnvsn(0alxrmr3oa1lateaieils0trtrxrpoo4lmt lnct ()s2raxmp;u4tetnioctytla ulumo;t)tlxrxfcoytfate n sls)srurxm3iy4al n ivil()sruru oou1aex ifciltfa ra( o u4 leoxrctadfaDeln o (0 rtr(opno4oltnmivi s  rumumpoo1ale  i3iatfaDel( o;u4tltrioctodlpt li o;t0 etr(m ou1open fvtatfsDumumont4tex  o3iatfs ua( s;t4treomf3oodfaDrluvilt) exm(opnodomtelfetl()srrrumont0opt iocils mDeaums u4tetrio3oytlaD  neo t)srxmirpio1lm e nvi t s2um(rp;o4apxnmf3tyslaDuauvsnu) exomocoatlm ran sls0t2xmiopoydlmenmnvi ( artrur oo0oex io3iltlm ulu p u)aeenxo3iy1lp rauvi ()srtmio3iu1op  mfvtat)aDta(ro;u1opt  oeiyslmDra(vsn(0 rxoxr oodla  auesls) 2toxm ny4lpt lncia( aDuax  ;u1apx ioeiyt aDeaumo ()aeenxr3todlatrlivo s)s2xrimpoydome  nvsl()sDur(mo;o4olxo oeiydfmDemnmo;t4 ltrxf oy1om   ivslt0 2tr(r3ou4omen ncilt)arum(m ;o0oexomieiltfm uan p;t4tlerifciydomDeli s s)texm(r iy4am elnvsl( aDururo;u1tpt ioetys m ean s;()aleoif ia1lmt  nvo;t0teur(r oy4lleemiei t  rta(r oo4opeomieilt sDum(msnu0 eermo tytoptelies (0trxmxrpnudlm nlnesas arrr(m oo4aetn ietatlmDemnms ()arxrmr3ta1fptrauvolt0 2tm(r3ou1lm emivsas)a2um(m nt1oex  feias mDranvs;u0trxoxr3iodlp rluei;()t2tmxr no1aptelnvsls a2uaumo;u1tptn fciydlsDulnvs;(4trtnirctotlmD lnvi s)s2trxr3iu4am emnvils artax  ;t1apt  ieiatlm ranmp;(4aetrmf3oa1omt  n ilt) rxo(opiy4aptemfvias) 2rmxrp;t0openmiciat a2rauvo t) rtrmr ia1fatr u i s s2to(r3nodlme lncsl(fsDrmx ont1tex ifeiadfaDel( s t0artoxo oytoa elnvs t  2urxm ny1lm  mivil(  Drru  nt0texnmo3tltla elu sn()texriociodlm   nvolt) rurxm oydaptnlnctlsfsDtr(  ;t1teeoiictlslm2uluvpnu0aexnio3ootomDe uvsl() exoxopnu1ll emncs s  2ur(m no1oeenifctyt a rm(vo;t)artrxrciodfptraues;t)texoxr3oydlpt livtasfs2rauroou1tpto fciasla2rm(mpnt) ltrmr3iytfptranvi;t teumxmpou1omt lfcs sfaDtrxmo;o0oetoiiciadfm rlu pn(0 lxnmo3tydoa   ivs ()trxr(o3iodoleelfvs t)aDtm(mpnu1tpe  fciytfsDemnvp;(4alxoifcio1lm   i ols) rxoirpiu4lptn nctls  2um(mpnu0aeenmfcilsfa ul(mp;t0tlenif oa1lp  aneo;t)s2trxo oo1ap n ieils  2raxmo;t0aeeomocilsla rm(mpnt)tetoio3to1oateluvsl()trtoim ny4op  mfei t) 2um( o;t0tpenmoetlsfm2um(ms (4 leomrctodfmDelueolt0 2xrxr3iydome livi (faDuaur ;u4aex iieiadfaDra(vsnt0altnxo3todfateaieo ()t2tmxr3ny4amee feiat  Dtm(rpou0olxnmf3iytls ulnvp;t4tlxrifcoytoatelivo;t truoio oodam nlfvsl(fsDtmx  nu4ape  f3iytls ulumsnu4 rxrmrciadlm ran s;s seurxr ou1am  lnvi ( a2trumpno4oeeoifeilt sDrm(vs (4treoxfciadlmt livi t) etrxr3iu1am emicsls  2rrx ooo4ale mo3tld mDumn sn(4altnifctotlatrau s;s) etrio iu4ole lncils srtm(rooo0tpt  oeiaslmDuanmon(4 ltnmr iydopt  uvilt)teuoxr3io4olee ieia(fa2um(rp;t4alen f3iadfmDeluvp;u)teeoxrcoo1omDr ieolt)s2ur(o iu4olen fcta(f Duaxrooo4tlt if3iad aDua( o;t0 ltrxocoytla ranei (  rxoim3ny1ape lfesl(fs2umxroot0tlenii3tatfa2ra(vpnu0aeenxf3oatla elu il(0 exm(o oy1lm nmfcia( s2raxrp;o0tleoifctadlmDelnvs () eenmr3iadfmD  uvi;( srxoir3no4olte iet ( arrm(mo;t1apx  fciatlsDrmnmp;t)alxnmrcoytlp e n olt) 2ur(m3iodlp nlncsls arrrx pou1tltnmo3iytlsDemn p;(4aleoio ootfptrlies s t2xmio io4lmt mncia()arumxrpot4texo fetls m rmnms u0trtnir iytlptelivols) rum(r3oy1lp emici s)sDtrx  oo1tptoio3iatfm2rluvsnt4areoif iodfaD anes s0 2xmxr iu1apt lnvs s srtau pot1tpxoifetytfm2uanvo;(0tlxnxr3oadoat  nesls)tetoxrpno4aleemivs t aDtmxro;u0opxo oeilsfa uln s (0 etoxo3tydlpD  neo ()t2xrxrpny4omtemnciat) ruax  ;o0tpe micildlaDua(monu0aeeomrcoa1fmD anvi;t0 etrim3no1om nlneils aDumxr no1tle iictatfa rmnmo;t4 rxomo tatla rlueols teuo(r oy4lm  mneias sDur(m nu0aptnmictas sDua( p;u4aeermr tatlaD luei;s0trxrxrpoy4opt  ivs t  2rrxmpoo0oeenif3tyd sDrm( o;t4areomr3tatfate ieo;s0 exmir nudlltemfei sfarrr( oou4tpxomfctlt aDeauvp;u)tlerxr iatlmDeluvs s0t2trimpoy1lm emnvs sf 2rmxr oo0tlto o3iytfaDeln ont4teerifciatfmDrau ilt)tetmirpno1altnmfvtl( sDraurpot4tex mi3iltlm2raums;u0alerir io1lat li i;s t2xr(r oy1am  lfctasfa2um(mpnt0optoiiciltfsDrl(monu0trenxf3iy1oate ies t0t2tmim3ny1olenlnesatfa2tau  ou1aexn ieildfaDuauvo;t0 exomo oo1oa   u il( srxrirpnu4op n fcsltfsDtruroot0altomo3ildls eluvo u4trtoifcoodopDr n il(0 2xrxm oo4lmtn ncsasfartrur ot4openio3tatla2ul( o t)aeerxo oydfmtrauvslt)teto(opou4lptnlfes ( s2taur ot0aeeoioeiadla rlnvonu)aeeoxr3iydlp r i o;t0s2uoir nydop  mfvslt arrmx pno1tpe mi3iasfaDrm( p;t0 lenmr3iadoa e ivo;t sexm(o3oodll elietasfartmum ;o0tpxo feiytlsDrmuvs u4arerxo3tatom rlneo ( srxm(rpnydlle lnvi t)srurxmoou0aptoio3ildfa2emu pnt0tlxnxrcoytlp   n s;(  etoxopnodomtnlictasfaDumx ooo4tpenmo3ilslm2rl(ms;u4arermf3ta1fmt lues;s  rtrxm3iudlm nlnct tfarraump;u0opxomi3iatlm2el(mp u0tltnifctydfa  lu i;s t2trxopiy1lme lfvi (  Drauronu0tpxn iciyd mDrlump t4tlxomo3ty1fp e i i ()teumxopou1ap   fvil(fa2rmurpot1tlx iictytlm2raump () exoxr3to1op rlnvi s) 2uoir iydom emieiat) 2tmxrono0tle io3ildfa2ea(vp u0altrifcoy1lmtr ivo (  rtrio nudlmtnmfcsa()aDtmx  ou1aee  fetyd s2emn s;u4trxrmo3oydfpD  n olt)teurxr3ou1ap  livi s  2rau pot1tee mociasla em(msn()trtnmrcootlm ean s;( trum(o ou4ape lfeilt)srtm( ont4olen o3iydfm2elnmpnt4tlxomrcty1omD lneo;t0 rxoim io4lm nmncilsf Dtaxmo;t0tlxn o3iltfm2ra( o u)aetrmo3oydlpDrlnei t  rur(m ny1omeelfetl(f 2tm( pno1tex  ociydfm eanvs;t)alxriociadomD  i s;t0srtmim3nudoltn ieiat)a2taur nu4optn iciat a2el( on(4 ltnio totomDeluei;t0s2toxr3iy4opee nvi sf Duru pno0tlenmieiydfmDul( o;(0aexnir3ta1omtrlues (0 2tmio oo4oltn fvi ( sruaurpnt1aeeo feiys s ranvs u0artoxo iydlpDeai slt0s2umir3oodlm  micsls)srumurooo0opxomfcils aDeanms;u) etnir oydlmt livi s0t2toio no1ole mnet t arrmx pou4texo oeiyd mDranms;t)alxnxo3iydfa e ies;s0trtriopou1om n fci sfsrrm(mo;u0olt mf3ils m2uan pnt4 eenio3iotfp  ai slt s2tmir oudome mncilsfaDtr(r nt0oetnmi3ilt m rlnvo ()alenmrcoydfpteaies;() rumirpiy1ap emivs s)a2uaxrp;o0tpeniieiasfa uauvs u4alxomf3tatlmte i o ( srxr(m ny1ale lnesat aDua(mont4oleoifctld a rl( s;t4aetrmr totfa  aivs s0 rtriopnu4lp  licilt  Dur( pou4texomi3iyd mDeanvp u4aexnxfcoatoaDeanes t0s2uoxrpiodomeemieiat) 2tr( poo1aex if3iatfa2emnvs;t)alxnifcta1op   n il(0trurim nu1opee fvta( srtmxm ;u4optnmoeilt sDulnmo;t0 exnmf iadlpD anvi;t)s2uo(r3iudlp  mfeias)a2urx  no4tlxomoeiatlaDeanmsn()altoxf3iodopDr neil() eur(r3io4omt lnct tf rrrur no4openmfctld sDuau s;(4 etrxo3ia1opD aueo t trtrxopoodlp e ncsl(f 2ra(rp;t0tee ifeiytlaDemn sn()alxniocoa1op   nvol(0s2toxr3oudam  lnei sfsrrmu  ot4olx ifctysfa umnvp;()tleoio tydlp  ln sl()trxo(mpoo1amt lncs s  Dur(monu0tetomfciatlsDrl(vs;(0aeenxr3to1fm   ueslt)trxrim3nudll nmfci (fs2rr(mo;u1ope iieiytfaDul(vo;u0tlerxf iodlpDeluvols  etrimpoo4alt mfeil()artax oou0apxnioctysfs2ea( o u0tlxnir oodlmtr n o;(0 2um(m3nu4aptnlfcs tfsrumur nu4alxn ietydlsDumnvp;t) ltrircootlaD  n o ()trtm(m nu4amtnlnei s arua(m ;o1tpx mieiyt sDrl(msn(4 rtrmrctydfmteli s s)t2xoio3io1altn ncs s) rua(  ot1oexnmiciydlm2rmuvp t) reoircoo1lm eluvo ()teto(o3ny4lme  neslsfaDtaum ;u1apeomietas sDranmp;(0tetrmf todoa r u o;() 2xo(rpny1alt mivilt sDtaxmo;o0tpeo f3iltfs uanvont0arxoifctadomt ai s t) rxoxr3oodome lfes s)srrmumoou4alt  fetlsfsDua(monu4 leoxo iotoat luvi ( t2trxm ny4oltn ict ( srtmu p;t0oeen ieiad s2raums ()arxrircoodomDrlueo;()trxrirpio4ome miesas)srta( o;u1teeoifeiysfm2ea(vont)alenmf iatoa  aivil()srtoim iudlm nlietasf rtmxrp;o4tpe  oetadlsDem(mp;u4 exrxr3oadomD  ues;()t2xrxo3oy4lpt mnes sfa2ra(mo;u4olxnmoetyslaDrmnmo (4aetoxr iodlaD  uvi ( t2xrxm ny1lpte ncilt a2truro;o1tlx  fciytls rlu on(4 rxnmo3iotfaD aies;t0trtmirpoydlptnlivs tf 2rmx  nu0aetoioeiydlmDem( snu) lxomo oo1lpDrlu o;() euoir3oy4ale miviat)aDurxm ;t1altn f3iadfmDuanmp t0 rtrif3iodlat ln o;t srxmxo nudopenmieil()s2rru ont4aexnmfctldlm um( o;(4alxoir3iytfat auvs s  rumxr3nudam nlivia(fs2uaxmono0tlxo feiltlmDum( o;()aeeoxfcia1lpt auesls)srtmxm3no4omenlnetlt s2rm(r oo4tlt mi3tytfmDulnvonu) lxnxf3iytfateaueolt s2urio nydaltnlieils) rtaxmoou1oexoifciat m2ra(mp;u4arerir iodlpDelnvs;(0 2xmir ou4lleelict s) 2umu  nu4oleo feiltls2elnms;(0tltrif oytlmt li o;(  etm(r3nu1omenmiei s arta(rpou4tpxnif3ilt mDuau p () exnmo3oy1fmt  nvs (  2tmiopoodom nliciat  2tmu  nu1opeo fciad m2ea(vsnu0teerxr3iydfaDraivs t  etmim ny1ll nlfvsasfa2rr(rpoo4alenifetat m2elnvpnt0trxnmo3oy1lp   neo t) exm(rpiydalen ies s) rtmxrpou4tet  fcildla em( s;t4tetrir oo1fmDraivo (0s2toim oy1ol  lnet s)arrrurp;t1tetomfcildfs uau p t)aexrif oy1lpD auvi;s  ruriopnodal  mfci sfaDra( ont1optn o3tat sDeln p;()trxrxf3iydomD  n s;(0 rurim3oodlmeemncilt)aDtaum nt4tetomictydfs rm(von()tltomo3oatlpDeln i t sruoxo3iydamt  fciatfsDrrum no0apenmfcildfsDel(vsnu0arxoxocoodop   i il(  2toimpiu4omtn nvsls)srraurpnu0alx ioctasfaDrl(mo t0tlxoir3tatfmDraues;s s2tmirpnu4om e ictls)artaurpnu0aexomoeias m emn s (0 rerirctotom rai ils trtr(m3iy4am n ivta(f 2umxrp;u4tlto ieiltfs uln onu0aeenmo3tytfm rlu olt)srto(m oodaltemicils s2raurono4oetn ieiat a ra(vsnt)alerxr oa1fpD auesls)t2uo(o3nu1lm e fesa(fs2uax  ou1alx moeiasfmDran s;u0 rtnmr oa1om r nes;( t2uoxrpoy1op   nct sfsrrmxrooo1oeeo o3ildlmDrl(mo;()aetrxf oa1lpD aueo;(0t2uo(m nu4aptn nciasfsDtaxr nu1tpenmi3ilsla rluvp;t) lxniocta1lpD  ivo;t sexo(rpoy1ope  netasf 2tau ooo4aee ifciytfa2elnvpn(0 etrmf3oy1fmtelies;s0 etoxm iy1am n nvta()sDtrxmoou1altoif3tyslaDrmnvo;(0aeeoiocoydomDrau ilt0 2urio3nydoptnmnetlt srrm(root0tet if3iyt a2raump;t0tlxnxr tadoa elnvi;()t2toim iudllte feta()a2ur(mp;t0tpeo f3taslaDrln o;t0altnmf3oadlptraneolt)s2xoxm3oo4ap e ivtl( s2ur(m ;o4tlxnif3iltlaDul( p;()aetnir oa1oa eanvilt)seurio nu4lptn netl(fsDrmxmo;u0apto oeilslaDel(mpn(4tltrxo oy1lpteli ilt s2toimpno1lp nlnvslt  2trumonu4tet miciysfa uanmonu0aetrmrcoy1lmtrli ils t2xmimpno1ll elnesa( artr(mo;o1openii3iyd a umn s u0artomf3oo1faDeai i s0texrxm3iydlpe  fctlsf rumxro;t0opt miciytla umn s (0alenxfcoy1fpDrlnvs (0 rtrim3nydlmenlicsls) 2tm(mpno1ale mi3iydfaDumn p t0tleoifcoatlpD luvsls0t2urir io1ame  fcsltfarurxronu1tet  iciyd a rau o u4areoio3ta1faDe ies s)trxrirpnudal e nct t) Dumxr ;t4opeomieiydfaDrm(mpn()aexnir oa1oateai o t srxr(m iu1op  mfcta( sDraxro;t1oexn ietytla2rm( p;u4alxnif oydfmDeluvs;t) ruoir3oo4ol   fvias sruaumpou1tlxoiiciyt s rm(mp;t4treomo3ia1op raueo;(0trum(opiydom nlnvi (fsrrax  nu0aexnifeiytlsDrmn o;u0trerir ootlmtrlnvs;s)s2umim oy1omtelies sf Dua(  ;u4olxnmoctadlm2el(mp;()trxoxrctodfmDeau slt trum(m ny4llenlneias srrr(mono4tltoifeiltfs2uln pn(0arxrmociydfpD lu o t) rtm(o nu1lmte iesat  2rmxroou1tlxnii3tltlmDea(vo;t0aetomr ty1fpD  uei;(0seumir oodameelncilsf 2ua( pot4teeoio3tadfsDel(vsnt)alenircootlatrauvils)srum(o oudlptelici t a2taxmp;u1aptn o3iasfs2umumsn() lerio3ootlpDelnvo;t) rtrio oydaptnlfcsat aDum(ronu0aleomi3iyd s2ulnvpnt4 exnmf io1fmD anei;(0s2uoxm nu4lp n nci t)a2umxmpno0optniocilslsDrlnvp (4aetoifcta1lpteaueo (0 exr(rpno1omt lfct ( a2tr(rpno0olt moctadfs2emnmo;t0tleomf to1latelnes s) rumxopnu1lmtn ncsasf 2um(rono4tlxnio3ildlm uluvp u) rtoxf3io1lmt  neilt0tetr(o oudlpenlnct (fsDtmurpot4tptoiicildfm2ea(mp u0altrioctatom e ieolt sruoxm ou1alenlfcs ()sDrru poo1aetniietlslm rluvs;t0texnioctotlpte u sl(0seum(opny4lp nlfvtat sDrau pou0aleo feiadlmDrmuvo u)tltomocty1lm r i o ( s2trxmpnu4lmeelfesls aDum(ronu4oetoif3iytfaDemnmsn()teeoif iotfa rlu s;s0s2trxr3iudope  fvtas) 2rrxrp;u1teenii3tas m rmnvs ()tetoxr iy1fat  i sl(0trurxm3iu4omen nvsas  Drrx  oo4olt mf3tad a2elu s;u)tlxoxr3iytlmteaueslt0truo(o oo4openlnvt t srtaurpnu1ope ifetlslaDuanvonu0aexrxf ta1oatrlieils) 2tr(rpiudlpenmietltfarum(mp;t1olt  i3iyt m elump (4alerxf3tydom eaneo;s truo(m oodap   ivslt s2umu p;u0ape moetysfa emnvsn(4 lxoxf oodoatelnes s  ruoio3oo1ope mfvt (f rtru pot4tetniociadfm2elu snt0alxnxf3oydop eau sls0t2xr(rpoy1op nmnvias)s2rmum nt1apeo ocias sDelump;(0 renxfctodfaD ai ol()trtm(rpnu4lle lncia(fa2urxrpou1oexn ocild m2ea( s;u0 rxnmf3oa1laDr uvo ( trtoxr ny1oltnmfcil() 2rmx  ou4apt mf3tydla2ra( s;t0tetnio3oadla e n i t0 exmirpnydaleelictl(  2taur ou0
\ No newline at end of file
@@ -0,0 +1 @@
+ies s)teuoxm no1oltnmicilt) 2uaxm no0oexomo3iysls uluvo u4 rxrio3oydlp raiei;() etmio nu1ome mieta(  rum(mono4tpt iieild m2um( s t4 etoir tydlmt ln ol(0 2tmim ou4ol n nctat)sDtrur ;t0tlxoii3tls a2ulums t0 exrxrcto1op rlnes (0 rurxm oudapeemiesat) 2rmurono0apt  ieiytfm umumo (0alenxr oadlmDe ieolt0trurxopnodoptelies () 2ra(  oo4alxnmi3tysfm2ulnvont)treoirciy1opDe i s;t0trto(m3nudlm nlnet t)sDrrx o;u4ale mfciyd s el(ms (0 rtnio io1om  lnvi;s0s2ur(m ny4am  lfcs t s2ra(m ;u4texoio3iydls2elums;u4 lxnxfciytop elnvo (0t2umxopoodape lfcsasf rtrxm ;t0tpx if3tad mDeanvon(4alerxf3iytoptrai i;s s2tmio io4aptn ivsl( a2rr(mpnt1aptomf3tydla2ul( pnu) exnmo todfmDelnei s0 2xmim oy1ll nmivt s) rrrxmpot0opx miciatlm ul(mon()teenxr oadlptrlnvo t0t2urir ou1lm emfesl(  Dururpot1oeeomi3ild a ea( s t0altrxf iatfaD au sl()srxoxo ou4al emnvt ()aDtr(ront0opt  ietas m2el( o u4 lxrir oadfpt lu o;s) exo(r oo4opt mfvsltfsrurxmont4aexo fciytfaDemu p u4 ltrmr oytopt  nvo s)t2uo(m3iodomt lici sf rumumo;o4aetnifeiasla ul(vp;t0aetoiocoatopD lnesl() ruoxopiu1al nmfvsas arum(mpno4oleomoeild s elnvs;(4texrmrcootfpDrlu i;(0s2tm(rpoy4amenlnviatfa2rm(rpnt1optomoctys mDrl(vp;()tetniociatfptrln s s)trurxrpoydap  livslt s2tmxrpou0oeen f3taslaDuan o t)aetnir iotfa  au s;s  2urirpoy4oleemnvi tfs2rrxro;t1apxnioetlt s2emuvs u0tetomf ta1optrln i;t texrxm nydap  mfcsa(fs2uaur ;o4ope mictad m uauvp;(4aexrmf oytopDr neil( seto(m3iodll  micsltfa2rmu ooo4apxnmoctytfm2eluvs u4aexoxfctadoaDraueols0 2umxm ny4oltelfes ()a2ur( p;o4olen i3iadlmDuluvp;t) lxnxf3oo1laDe ueol(0srxoirpiu4lpe lncta() 2uax  oo4tltoii3tls mDel(vs (4trxomf3iydfm rlivo;t) 2toir io1lmeemfvi () Dumxr ;o0tptomictys s rmn on(0aetoxrcoodom eaiesl(0 exr(o3ou4apt lfvilt srra(r ;o1olxnmi3iad mDean o u) renif tadoatrlnvi;t  2to(opno1ale  fvias  rrrx p;u1tlxo i3ilsfs2rlumo;()teenif totopte nvo;s sexoirpoy1op nlies s a2ur(m ou4oexnmfciadls2emn s;() lxnmf3tatlaDrai s t0truoim3no4olen ivil( sDrmum oo0oet ioetldfs eln s t4tlenif oo1lp e nes s0t2umxo oo4lltelfetas sDur(ro;u1alen ictas a2emu s;t0 eenxo3totoateaieilt0srtr(r iydlptemfvil()aDrmxrp;t1aeen i3tlsfs2em( p;t4arxnmo3ootop eai i t0 2xmxr3oy1lm elicsa( arurumoot4open octadlaDem( snt)altrxf3oy1omt ai ol(0 2umim3io4lpt liviat a2trxm oo4oetnifeild mDrluvo;u4aeenxo3ia1lat  ieo t0 2uoxo iydopt liviasfaDrmxr ;t0oleoiiciatfa2ea(ms t4trtnif3iotomtrlnvslt0 2xoxm3iu1lpe lnei s)sruaum ou4tetnmi3iltfm ulums;t) eeoxr3oadoaD  nvil(0sexo(o oy1omeelfesl(f rur( o;o0tetoio3tadfs2umumpn(0 renio3to1lptr uvol(0s2xoio3oudomtnmies t  rraurpno1aptn oeiydfaDumnvs u0 rxrmf iotomte u i;() 2xriopoo1amee fcs (farur(rpoo4opx mo3iydla2ulumo;(4texrmr3io1oate iei;t s2xm(m nu1altnmieiat) ruax pnu0aleniociltla rlnvp u)aetomr ta1fmt  ies (0sexoxo oy1lpte fcsat sDrr(m nt0alt  ieiatlmDua(mpn(0aleoircoytfpD aivol(0sruo(r io4lp e fcsat arum(m ;u1oltnmiciadls uaums;(0 ltrmocoo1lmt ai i;s0setrimpnodlptemneilt)arra(rono1ape mfciat m2raumpnu4arxoxo iadopDr ivo;s  rtmxr nydop elnesltf Drmx pnu4tetn iciys s2em(vp (0tlerxf3tadlmteliei (  rum(opiudapt livtlsfarraump;o1tlenioeiltfm rm(vont4trenir oydlmD  ivo t)setmxo3ny1amenmfcsa( sDtr(mp;t0aexnmoctys s2umumo u)arxoxf3tadop ean olt0 rxo(m3oodol nlieias)a2ta(rpou0aee moetld m rmu snu4trtrmf iadoat lieo (0 eurxr io1olt mfeils)s2um(m ;u0apx iictltfa2eau sn()teenxf iotlm eli i;s)trxrxm io4lpe micias  2tmump;t1aptn i3iatfa ea(msnt0trerxrcootoa  aueo t srtoxm no4omt livils  Draumont1aptnmieiysfaDea( s t4 eermf oydfmD  ies;t0sexoio3iy4omtelfvtl(fsrtmx  nt4apxnmicilsfa uan pn(0aetrmo iadla raieo;s  etoxo oy1op  lici sfsDtr(mp;t4apeo icias a2umumo t4trxrxociadfaDeaivo;s)sexr(m3nu1lm nmfcsls  rra(mo;o0alxo o3ildfm em(vs ()tltrxo iy1lm e uvs;( teto(r3nu1amt  nviltfs2tm( o;o0aeeomociasfm2uau s (0 etnif3tadfpDrln o;s trxrxmpoo1lle mnvi s artau  nt4aeenif3taslsDeaumo (0aeerifcoytoatr iei s) exrxrpiy4lptnmivi sfsrrm(ronu4tet iictat a ua(vpnu)aeeoxo3io1fmD auvo;()sruo(m iu4ale mfvta()s2tmum ot1tex iieilsfm ra(vsnt4aetrxociy1lateluvs;t)setmxo ny4optn ict (fsDtrxr oo4aee  i3iyt s ea( s t)trtrmociy1lpte neolt)t2xoio3nydal   nes t s2tmx pnu0oleoio3tydlm2rluvs u4tleoxr ta1op  liesl(  2umxo3iy4lm e ics tfa2raxroou1tpxo iciaslaDumums (0aeenir3oo1laDeaivo;t seumxm iu1alenlnvsas s2ua(rpot4aex  ieiatlmDul(vp;()altoxoctydfpteanvilt0 rtoxo3oo1al e nesltfsDuaxro;t4tlt  f3iasla2elnmpn(0 ltrif3ty1fm e ivo (0s2umirpio1olenmieia(fsDtax ono1olxoifctyt aDul( p;u4trenxoctadlm  ai o s)teum(r3ny1omeemnes ( a2rr(r oo0olt mo3iatlaDrlu p ()areomo to1fa elnvi s srtoirpny1opeelietat sruax p;o0tex iiciat sDumnvsnt0 rerxf oadomDelnes ()srum(m io1lmen nvi sf 2rru  oo0ope mo3ild mDul(vo;(4altoxf3oadoaDran o;t  exm(rpou4amt  fvta( aDuaumo;o4tee iocilslm2ra(vsnu4treomr3iodoateaueolt0 2xo(r ny1ame lics sf 2tau pou1opx ii3iasfmDra(vo t)tltrir tadfaDean sls0 rumxr iudap nmfcs ()a2um(ro;o4oetniiciydfsDuaumo;() rtnmo3todlpt lnvo;( trxo(rpiu4opte fcsasfs2urx oou4ape  fciyd m2umuvs (4trxnmf3iatlmDe nvi t  2uo(r io4lmeemfetlsfs2rrum nu0ope moetasfs uln p;() exoirctotfa e ivs t) rumim iu1aleemictat  Drau pnu1aex  fetydls emnvo (4alenmrcoodlmtr ueo;()s2xr(m oo4oltnlicta(fs2tmxm no4tlenioetydlmDemuvs;t) ltoif3tatfatelneo s0trto(m nodap e iciat s2tmu pno1tptoioetat aDeauvsnt) renif ia1lat  uvi s0t2to(m iydop  lietls s2trx pot4teto i3ildlaDra(vo u0aeermr3tytopt anvsls t2xr(mpio1lpe livt t  2rr(mo;t1tltoifetlt aDrmnvpnt0 ltrxr3iydopD  u o s)sexm(m oydopt mfvilt) rtrur ot0olxnmoctys aDrluvo;(4areoxrctytoa  luvilt0sexoirpoydllen ics s  2tr( pnt1apx  f3tldla ra(vont0tltomocta1fate nvols) rum(r3nydlle lneilt) rua(root1oleniietytla2umnmo u4tlenif3oy1lpt  ues t0t2xmxrpiudal  lnvt s)sDumumoou4olxn fctls s rmums u)tleoif tytfmDeaieo;t  etrxo iu4ap nmivtls)sDra(rp;u4texomo3iys m2ulnms t)teerxrciatfpt anvo (  2xr(m iudome  feiat a2rrxrpot4aptn oeiadlsDeluvs;(4aexnmf3oadfat lnes;t)trurir oudomenmnesat srua( ont0tlt mfeiadfs2rlnvpn(0treoxr3iydlaDr i o;( seumxm3oy1lltemfctas sDurxrpno1ape ifctad aDuauvp u)aeenmr to1fpteln o ( seumiopoy4om e fetat arur(  oo0apto i3tasfm2emnvp u)trenmocta1lp elnvs;s0sexrim io4altemiesat artmu pot4oeeo f3iyt a umuvp u) rxnxfcoatoa e nvsls)srxo(rpoy4ame  ncslsfa2ta( pou1tpxniieiysla2umnms;t0texoxo3iytlat lieil(0trtmirpno1aptnmneslt aDur(m ;t1tptn f3tyd a rmn p t)treoxfciodlmDran o;s0trumio iydlm  lici (  2umur ou4openiieiltla rlnvpnu4 leoif3to1oaDelnvs t0s2xo(m3nu1al emfvt t)arrr(rono1tle  fciadla ulnvp;t)tlenmo3oa1lptelneol(0srto(o3iu4lpeemfvtatf 2taxrpou4tlx  fctld a umn s;(0 lxrxo iatfpt luei;s) rtmxm3no4lpte fcilt)aDua( poo0tlxn i3iasfs2ea(vo;(0trenmo3tatla e ueo;s)t2uoim iydlpt lfcsatf 2taumooo4ole mociysls uln sn(4 etrxf3tydfaDr ueolt0t2xrimpiy1lpte nvsas)srra( o;u4oex  feiasls2rmn p;u0aeerxo oytla eluvo t texrim3iu4llenmfviat)s2ta(rp;t4tpx ifeiltfa2rl(mo t4alxnir3ta1la r u s t)setr(r3iu4optnmivta(fsrraur nu4teen o3ildfaDraums t0arxnmrctatfat  uei;s0texmir oy1llt lncs ()a2ta(mo;t4opeoiietatlm2ul( onu0arenir oydfmt auei (0seuo(o no4lmt lnvs ( aDtmxmooo1opt mietytlm2rlnvo u) rxoxrcoadfat an o;(0srxrio3iy1alee netl(farum(moou1olen feilsls2ra(ms;(0artomfctydfmD an s;s) ruo(r3oudlle lncsasfsrtrumpou1tetnmf3iltfs ea(ms;(4teeoxo3iotomDrlieil(0trumxr oydll n ivsl( s2ra( p;u0tpxnmfctasfa2rmumpnu0 rxrmf3ty1omteli sls0tetmxr oy4ap e fvs t srta(rooo1oee ioetys m um(mo;t4tetnio3ia1laDr ueils0s2trxrpnydlp  lnvt s) Durxro;o4apxo fciyt a rl(vp u0trtrxf3io1fpt li i t  rur(r3oodamtn neil() rta(m no0aexomfeiatfm2um(vp u) rxnmr3iadlptr nvi;(0trtr(opoy4opeemfvsl()aDtmxmp;u4oltnmieild m2ea(vo t4tlenmf3tatoa rauei;(  rxm(r oo1aptelncsls) 2uax pou1alx  o3iyd mDumu pn()artnmrcoytopD li s t0setrxmpoodal nlicilt)aDrmx ont0oltn ietyslm2rlumsnu) eeomo3iatopD anvsl( trtm(m oudom   ivi () 2tru  ou0apxnmfcias a rl( pnu0teenio iadfmD ai o t)sexo(opoydlle lieil(f rtrumpnt1olt ifctls s2umn o;u)aexnxr iy1fat au i;s trumxr3nodlptnmfcilsfa2urur no0olxoifctytfa umums u0alxnif totlp eauei;t) 2xmxo nudalte ncsa(  2rr(  oo4alt io3tas m2el(ms;t4artnmr3iotfmD livsl( t2xoirpoo4ole mnct t  Draumoot1tlx iietytla2rlumsnt) rxrmo ia1omD anes;t)t2um(o iy1lptemfvi t) Duaxm oo1opxnioetas mDemuvs;u4tleomr3oo1fa ean o;s)s2xo(r3no4ope  fvi t) 2tmx pot0opx miciltlsDrl(ms;t4aexrmrcoo1lmDeaieol(0srxrirpiy1om e neia()sDrr(ro;t1apeomocilsfm rluvo u4arxnmrciadlp   nes s0t2xr(rpio4alte fvsltf rumx  ;u4apxoifeilt s2um( s;(4trenmf oadomDe nvsl(0 rumim oodlpe  fes s)aDuru o;t0teto icild aDel(vo u4 eerio3oo1oatraies;( sexoxm ny1am e fvtasfaDraxmpoo0oeeoioctad s emnvp t) reomo totla eai ols srxmir oydol nmnvtltf 2umxmonu1tet miciytfa rln pnt0arerifcoo1la  lu o s) euoimpiy1aptnmfvs t  2trxmo;o0opxomoctyslm uan on(4texrmo3oo1la r n s t)setmiopnudlpee ict s aDtau pnu4alto i3iat aDuan o ()aetnir to1op rln i s s2uo(o3iu1opte icils sDtmxmpoo0ale  fciad a2ea( o;u4teeoxr3ia1oat lu s;(  rur(r nudaltemfcsat s2umxrpou1olx ifeiadfm2ra(msn(0tltomfciadoaDeau sls) exrxo3oo1ll  lncil(fs2rr(ront0olxnii3iadfsDrl( p;(0 rxnmf3ta1lptr nvi;s0 eum(m3io1omtemiet ( sDra(m oo1oetnmf3ias aDuanvp;()trtnirctytlm eluvo ( trumio3ou1apen fvtas  ruax p;t4tpt mi3iytla rm(vpn(4 leoxr3totfat  uvi s) rum(opiu1ap elfesl() Dua(ro;o4teeomi3iasfsDuluvs t) leoxociytlp ran i;s0 etm(o oy4lmt  ncta()aDra( o;t0teto fetasls eau p;u0artomf oo1om rauvs;(  etmxopiy1amt lfct s) Dtm(m ;o4teen o3tatfsDulnmp u)trtomo ty1fmteaieslt)trxm(o3nu4optnlfcias)aDtmxront4tpeomfciatfmDrlu s (4tltnif tadfpD ai s ()srumim3iu1ame lnet s s2trx ont4oex miciyd s uln pnt0 rxrio oy1fmtr n olt s2tmxo iy4apeemivsat aDuauro;o1tpxn ictlslmDra( s t)trtnxr ootfpD ln s t) eumim3nu4omenmnetls)aDrmx  no4oexo ictytlsDumuvo;u4artriociotlat li o;t0 2toxrpiodalenmfcs tfsDta(m oo1tptnmieias m emumsn()arxoifctydlaDeauvs s0sruoir oy1al nmnetas sDumxrono1aee  oeildfm umu s u4tlxoxfcoodlpD anvs t0 etr(o3nodape  ivt t a2trx p;u0alx mieiydfsDul( o;(4 ltomocoy1lp r ieols0seurxo3oydal nmfcs s) 2ur(rpnt4open ieiytfm umu s;t0treniociatoa eai i t0 rur(mpiy4ameemfci tf rurumo;o4oleomfciltlmDuanvo u0aexnmr iadfpDeau i;t0 2ur(rpny4apenmfvtlt s2rm( ont4opeomoeiadlm emuvs;t) etrmr ty1fmD liei s)s2xr(m3io1al   fvil(fsDrrxr ;t4olen o3taslmDrmnms u)tetrifctodomt aneils) rtrxm3iudale mnvtatfaDtax  ot0open ociltlm2raums (0trtnmfcta1lmt au o s0sruoxmpnudaptemictl()arrmx pnt1opeoiietyt a2eanmo;t0tlxoxfcootfat an ilt trxoimpiy1omeemneia()sDrmx p;o4apeoioctldlsDel(vp;u0tlxrxf3ty1oa r ueo s) ruo(m io4omenlfetlt) rrrx  nt4ope mfetltfsDuanvo u)arxoxr3oadfp  lieol() eum(mpno1opeelivsa() 2rrumpou4tetomfcildfm2emn ont)texrif3iotlm elies ()tetrirpoydlpen ivtlsfaDrmu  ;t4oexn ocildfsDrmn s;t0trenmf to1om  an s s  etoir3oodoltn ivs () rrrx pnt1opxnmf3ias a rl(vs;t0 rxrmf3iotfatr ieolt0t2xmxrpnydll emietlt)arrrx p;o0tle ii3iysfs2ul( ont4tlenioctadfp r i sl() etrxm oodamt  fvsls)aDta(mono0aet  fciatla2elnvpnu4 rtrmfcootfmt an o t)seur(r3nu4amtelnvtls) Drm(  ou0tetomfetas s ua(mp u4alenir ta1opDr ivo;s)srtr(o ou1amt lici tfa2tm(rono1opxo i3tysla2uln o t0 lxnmrciadlm raueils)s2uo(m oy1alte fvi t srraxmp;t4teeomictlt mDrmu p u0aexnmr3ootlaDeau sls)texo(m3iy1omtnlivias  Dtmum ot4tet ifeiatfmDranvp t0teermrciy1omDe ivsls  etrxo io1llt lfes s)s2trurooo4apx  fciydla2rlnvsnu) renmrctotlp  anvi;() eurxopnu1alen iet () Drm(mo;t1tlxoifetas m2rmnmo t4artnifcta1fp  livs;s seto(opnu1lmeemnes tfsrrru ont0oee  ociltlm2rm( onu0altomo iotoa  lnvilt0 etrim3nu1ll nmictat) Dta(mo;u0tltn iciysfa2ranvp u0 ltnio iatfa   nvo;s)trtrxo3oo1amtelicsl()aDurx ont0aet ioeiydlmDrm( p t0aexrxrctodoate ieo s  euoxr3nodop nlieilsf rra(mo;u1tpto ociatfs2ul(vp;u4 exoir ty1fmD livi t  ruo(o io1opeemfvsa( s2tr(m ot0ale ifctlsfsDeanmont4 rxoxr to1oatrlieo s texrxm iudoltemnvsasfarur(rpou4opx moetadla uaumo t) exnio totoa eauvi t)teumxr no4alenmfesatf ruaurpnu0oet io3iytfm ranms () lxrxr3iytfa r u o;s teuoimpiy1lm n nvta()arumx o;o0aetoif3ils sDrmnmpnt4altrmr3oa1lmDelu olt trtrir3nodolte fetlt) Dur(mp;o1tlxomoetydls2rauvp u4alxoir3oadomtrlnvi;s0 2toxr iodaptnlnctls aDraumo;u1apx  ocildfaDrmnvo;(0treomr ta1fmDe n i t tetoim oy1llen ivsatfsDrmum ;u0apxnif3iyd a eanmo u4arxrmrcoydoa  lueol( t2xmxmpiodolenmivi ()srrmx p;t0olen oeiaslmDumn pnu4 ltriociytomDelnvs t0setrimpnodop nlfesl( arrru ono4oleoifetlsla2rmn s (4texrif3iytfp   u o (0 2urxrpny1oltnlfctlt) Dtaxmpnu0oltoifetydfa ranmo;u4 leoxrcoa1fpt aieolt0s2xriopno4lptemics () 2raxmpot1aetn ieiysfs ulu s u)aetrif3iytomte nvi;()s2uo(o oy4lle lfctlsf Dtmu onu4aee mf3ils sDra(vpnt)tetnxfciytom  lies t0t2um(r iydaleelics sfsrraur oo0aex ioeiasfm rlnvp (0 etomr3oo1optelneolt  rxriopoodlp  mfct t)aDrm(m ot1oetn oetysfm ulump (0trxnmrcoy1omte nvi;()trtmxm3oydam n fes t) Durxrpnt1tlenmociad s2ean on(0 rtnio ta1lpt  uvsl(0t2tmxm nudam  micslsf rum(rpno0aex mociad mDemnmsnt4 rtoircoatom rluvo;( t2xrxo oy1lpt  neilsf Duax pno1tetnmocias mDem( o t)aetnxo3oo1omD lues;t seumxr3oo4openlfcs s)srtr( pnu0tptniiciat a rauvs u0 exnmf3oa1omt luvs t)sruoio3oy4apeelies t)srraumonu1aleo f3iydlm2ra(vp t) eerxrcty1fpDe ivolt)trtm(m oy1lpeemietlt)a2ta(roou4alxoioeiatfs2rmuvsnt)aetnmo3iatopD lnes;s) rtmiopnudapt mfei ()artr(  ou0oleo f3tytlsDua(vo;(0 lxoxo3iytfpDr nvo;( texoio io1al elivs ()srtaxrp;o4oee micilsfm ra(ms;t0tetnmocoytfat  ivo () rxmxr3iu4llenliviat)a2tmur no4tet ii3iyt aDraums;(0 rxrmo3iytopD an slt0 exoxr oo1op nlfetatfsDrrx oot0tpeoiociadfa2em(ms;t)aexnxrcoatfp rlneols t2trio nudop e nvsl() rtmxrpnt0alenmf3ilsfsDra(vs (4tetnir3totfp   uvi s0teurimpoy4lmtn fesa() 2um(r ou1optnif3ild m2rmumsnt0 eenmo3to1omtr n ilt0 rtmim3no1amtemnvtls) 2uaxrp;o0tpe  oetydfaDemumont)artomf3iodfptr ieolt0 ruoim3iu4lmee nvilt)aDrrumoou4alt  i3iatlm ea(vo t4 ltomociy1faD  n o;s)texo(m no4am n fetl() 2rm(r oo1aeen i3tys a ulnmsnu)aeeomf3oadlpD  ueils0s2xo(opny4llen fes ( srumx ooo1optnifetyd sDranms t) rtoxo oa1lat luvi (  rxrxr iudamt  ieiatf Dumxmoou1aeenmoeiyslm elnms;(0 exrmf3oatoatrauvslt)teuo(mpoo4lpte icsls) rtax  ;t4aetn f3tyslmDrmuvs u)aeenmo3oodfmDelu i t)seumim ou4olt mfei s)a2ur(mo;o0alenmfetat s2eluvsnt)aleoxo oydfpt  uei;s0 rumim iu4opt  nci ( a2rruroou4tlxomo3iys m2uanvs t4artnxo tadfat luvils texmxr3iudlltnmnvsas)arur( o;t4opx  ieiytlm2rln o;u) reoir3oytla e uvils)srurio3ny4ape lieslsfaDraumpot1oexomf3iydfs2rmnmo u)trenxfctodlmt  ieslt)srxmxr3iu1ameelneta(f 2urxrpot1tpxo ictydfmDrln p;()arxrifciatoptranvil(0 exmxo nudlmenmnvia()aDraumooo1aetn ictad aDuaump (4texoxfcta1oaD ai ils trtrxr io4op nlncia() 2tm( onu0aexniocils m umu s u) etrmr iydfm eluvs (0s2uo(m oydlmeelfvs tf Dur(moou1tlx ifetydlaDua(vsn(4 rxrif3ootlpDrluvs s0t2uoir iydomenlnesl( a2trur ;t1oexnmocild aDem(vp ()trenif iadfa rlnvo s  exr(m iu4lpte fctls)s2umurpot0oee  i3iasfa2eauvont0 eeomf oydfaDelies ( srtmimpou1lltn ietltfsrtr( pou1oetnmi3iyt m ua(mp;() lxoxr iatoa r ivslt  eum(r io4ale mfet t  rraurpnu4alt mociytfm2rauvs (4artrif todoaD auei (  2xoxm nodom  micilt)aDrr(r ;t4tpeomictyd mDelumo;(0 eeomf oa1fmDeluvsl(0 etmim oo4open fctls artr(mpou4aeen oeiytfs2eauvp ()alxrir iadfm r nvi s0s2xm(m3oo1amtnlnvsl() Dtaxrp;u0oex ioetas aDemuvp t4aeeomoctydfaDelnvs;s  2umxr3ny4llenlies ()sDta( pnu0olxnioeiltlaDrlnmon(4 exnxrcio1opteln o;t0 rxrio3iu1alenliesa( s2urum oo4tlxnioeilt aDrl(mp;t0 exrxo iotla eauvslt0srtrxrpnudolenmfctat) Drrum nt0olt miciyslm2rlump t) rtrif tydlmte nes t trtmxo3iu1om n feta() Drm(rpou1tpeoifeilsfs ua(mp;()teeoir3iodoaDe nvsls)tetmiopoo1ll  licia( sDum(mpno1apx  oetadfm eanvpnt)arxnmo3iotlat lies t)t2tm(m nodapenlfesa(f rraxmp;t4tltnmicild mDemnmpnu)tetrirciodfa r n il()trtmio oy4ap e nvsa(fs2rr(rpou4aeeomfeiatfmDea( s;(0teeomrciadlpt anvs;( srumxopoo4ame mfvslt sDuaur ;o0aeeo ieiysls um(mo u4tltoxf iodlpt  nvilt) exmxmpnydal e feslt)s2ur(rp;o0tptnifeiat s raums;t4areniocoodfaDelues;()setmxo nodll n fesl( s2tmx pno0tex  feildfaDulumo;(0 exrifcto1faDrlu o s) eum(mpnydomeelfvs sfa2tau  no0tetoif3iys a ranvp;t0aleoiociotfaD li s t s2xoxrpiodol n fes t  Dta(  ;o0tpxo f3iyd sDrln sn(0 eeomo totlmtr uvs;s0texrxr3ou1ll emfvt s a2tr(rp;t4alxnif3iltla ea( p u0alxoxocoytlaD ln i s s2xrir3oodlptnlivta(farurx o;o1tpe  ocils s2umump;u4trxnmrciodlmD ai o;t0 etr(mpou4alte icsl( srta( onu4oeto f3tltlsDum(vs u0alermf3ta1optr ieo;t  etmxmpio4optelies (f 2rmx pot1ale mf3tyd sDemumpn(4trxrxocta1omt  uvs s t2xo(m3ou4altemnvs ()artmx ont1openmfcils a2ea(mp t4aleomo3totlmD  uvs s0 exrirpno4lmeelicilt artr(m oo1aleomf3iasla elnmo;()tltnio3tydomtr ivol(0teurio iy4oltnmict s)arra( onu1openifeildlm em( s u4alxoiociodoa r u ol( srtr(opoo1lme miet t sruau  ou0tptoioeilsla eanvpnu)aetomr oytlatraueo s) 2tmio nodopenlfvta()srum(ronu0aptnmf3tydfaDrlump;u0aeenirctodlmte ieo;(0 etoxm3iy1opte ivsl()srra(mont1aee miciaslm rlu ont)arxoif3oadoat aieslt0seurir3nodome  fcils)s2rmur oo4oeeomoeias m2el( ont4treoxr iadla  lnvo;s)seuoxm oudam e nesatfsrta(monu0opx mf3tadls rlnmpnu4 lenir tytomtr n i (0seurxo iu1ameelnetl(fa2uau o;o4alenmoeilsls2eln p (4alxoio3iadoat  n ilt  etrir3no1omtemivsa(  rum(monu4aleo ieiltfm em(vo u4 ltnmf3tydopD au sl() rxoxr3oo1lpee ivs () rrmx pnt1aex iiciyslm2rmn p (4tltnmr3ootoa ranvol(0s2xoio3io1op n icias) rum(m nu0tlxomoeiadfs2em(msnu4 lxomfciatoa   n o;s sexrxrpnodaptemnvil(f 2urx  ou0olt mfciyd a rl( pn() rtnif oytlm  auvo (  rtm(rpiy4omt  fvsls s2rmumpoo1optnmo3ilslm2uan p;() etnio3oadlaD  u s ()t2tm(opnu4lleemfetlsfa2rrumooo4tpe ioctltfs2el(mon(0altnxo3oytfaDe n i;t)s2urxm ny1lpe  fetltf rrmxroou0opxoif3iaslsDran pn(0arxrif3oodlmDelueslt s2uoir iydlle mncta( srtr(root1oetnmoeiad a2eln pn(0aetrxrciydlmteau sls)sexmxo3oy1ame  fvi tfa2um(  nu0altoio3iys mDrmnvon(4 eerif3tadfp e nvils seuoio oodap elnes tfaruaxro;o4texo oeildls eanms;u0tltnir3iytfpteliei;(  rxoxm iy1lpen fei s  Draxm ;t0tptnioeilsfm2ulump;() lenif todlmD aivol( s2uo(m3oy4ape livs tfsrrmum nt4tet  octlslsDulumonu4 ltrmf3oydla eauvi;t0trurirpno4lltnmncias  Drmxmonu1tlx ifeildfm rmu snu0aleomociotoat anes;s  2to(opoodlmee nvilt artau poo1altn ociltlsDumu s () rtnxo tatomDr uvs ()tetmxr3iudom  lnes s)a2ra(m oo1aexn i3iys aDrlump u0aetnmf3ty1lm  luvols)teumxrpoo4ome lietasfa2tmumo;o4oltnio3tasfs2raumo;() rxnirctadfaD ln s;s t2urirpoy4al n fvslsfa2rm( oot4ape io3ils m2ulumpnt4 ltnxo3tytlaDelu sls srxo(m no4lmtemieias)srrru  oo1optomociytla2ranvpn(4tltrxr3oy1fm elu slt0teuoir ny4ol elicia( sDrrxmpno4tee  o3iytls2elnvpnt4 rxnxrcio1fate ieo ( tetr(o no1apen feta(fartr(ro;t4alxoiiciysfa2rm( o t4tltoxo3tydfa e i s s)setmxmpno4altnlnetl(f rraxro;o4tlenif3tat s ul(mp (4 rtnxfcoa1oat  i s;t)srtoir3no1lpee fctlsfsrumurpnu1olx moctlsfm2rl(vo;t4 rtrio3iatoaDraneo t)s2trim3io1ol nlfvi t)a2rau pnt0tlto fciad m rlu on(4tetnio3tatlaD  nvo;t0texrxr no1open fvtatfs2tmxrpnu0tpxomoeildfa uaump () exrxociytlat  nvs s) 2to(r3nudllenlnei tfsDtaxmpot1tpe ii3tydla2rau sn(4tlxrmf oo1opDeli o;(  2xoxo nu1lmeemncsl(  rrmx  oo0optn i3iat m um(ms (0 etnxr3ty1oa elnvs t)tetm(rpio4lm elfesas  Dtrx pnu4aee mociytfsDum(vsnu4texnif3tatfat  iei t  eto(m3iydal nmnvta()sDtrurpno4oet  oeiytfa rmuvs t4 rtoif3todlpD  nes;( sruoxo nudap  mietas srrr(rono4ope ioeiltfa2umn ont0 lenif3tatomteluvs;s) rtriopnydol   nes t sDtaump;t1oet if3iatfmDea(mp;(0 exomo3oodlate ieo ()s2um(rpoy1al  lnciasfsrtaur ;o1texoioetytfm ul(vs;(0tlxoif iatlp  anes;s trxrxo3nu4ll  miet (fsrur(ront0apt iocild a2umnmo;t4 rtrmrciadfpt ln ils s2umio3iydol nlictls)s2rr(  ;t0oee mf3tydlmDraump;(0trxnmr3ootlm ranes;s0t2to(m3nydopt  ncs (fs2urum no1aeeomiciydls ranvs t4 renxo iadom   ueol(0t2xm(m oy4amenlnvi t sDtaxront0oltoioetasfmDra( s;t4 eeoio iatomDr uei s0s2trxm oodlmtnlnci t)srra(rpoo0opxnio3iltfmDelums u)aexrio iadlpDr ivi s)trxmiopou1lm emneia( aDtm(mont4alx ifciadfa rl(mont)alxrif3io1fp  aivil() 2xmxo nu4alte ietas sDurumo;t4tpeoiiciytfa2emnvpnu) lenir iatlaDraieslt s2uoxm io4lpenlnvia(fartr( pno0tex iietyslmDelnvpnt) ltoxr tydoaD lieol(0 exmxo3oy1lm e nvtatf Dtaur ;o1alxo o3tlt m emnmo;() eerio io1om ranvo s0t2tmir oo1amenmivils  rrmxmp;t0open ociasls um(mo (0trtoxr3ty1fpDe ivslt s2tmirpoydopeemivs s)sDraumpnu4opeoioeiltlmDea(ms u)altoio3iotlpD anvs;t) rxmimpou4lme  fetls a2trx o;u4ole ioctat mDrmn p t4 rerxocto1fpteauvi (  2toxo nudamen ivsl() Drru o;u1tltnioeiadls2um(vo;u0 rxnxoctydopD au o () 2xoxopoy1om eliviltf rtm(rp;o4alx  o3iat a2rmuvo;(0 rtnxf3oadfmD livo;t)srumxm ny4olenlivi t)srrm(rooo1aeen oeiasfs ulump (0texomr3iotlm  lnvil( trxmxm3oy1ll  mivilt aDrau  no4aleomieilt s eanvpn(0 lerxo3oadlpDrln o s) eurirpio4al   fvt t srumu ono4tpt mietydlm ul(vo;(0 exrmr3ta1faD auei t0 2umxopnudape  fcsa(f Duau onu4oleniocilslm2um(mpnu)alxoir totlaDraues;s0t2toim3iu4lmee fvi s arua( pnu0oetniicildfm2rau p;t0aexrmr3iy1lpD  i o;t)sexoirpnu4optn fetlt) Dtmurpno0optomoeiltlaDua(mo;u0 rtrir3tydfa rlu il(  rtm(r no1lm nlfvi t a2tru oot4aleoii3iys m2emnms u4alenxf iy1laD lieo;s)trum(o no1optn fvs tfaDtrumono4oet  ictatfm2ua(vsnu0 lxrxf oatfm   u s t s2xm(r3ny1alt lfviat srrrurpou0oeeomfctldfm2ul( p;t)aexoif ootfaDrli o s setriopnu1alteliesa( aruaxrp;o4tptomi3iatfsDrauvon(4 reoxf iadoaDr u o;s) 2uo(o ny4ll   fcslt)a2ua(m nt0aeenmfeiat a ean s ()arxomo iadopDr i sl(  etoxrpou4lptemfvt (farum( ont0aeenioeilsfa uanvo u)trxrifcoodlmtr nesls0srtmxrpnodop  lncsas) Duau p;u0ope ioeiad a2eanmo t0 rtrio3tytopDeli sl()setrxrpno4apt miviasf rra( pot4aeeomf3tatlmDulump;(4arenif iy1fmtr i o;s)trtm(r oodomtelfetas a2rr(mooo0oeeomoeiytfaDeanvp;(0 rerxr oo1fpD aivsls)trtmxo3iy4aleelfcslt sDtax pou1apt mfeiltfs2el(vo;u0trxrxf iydfptr i i () eurxr3ny4omenmictls) 2urumooo1tetnif3iasla emu pn()aexomr3oy1fa   uvo;t0trtoirpnu4ap n neil()a2raxrpoo4tlt io3iydls umnmp t0trenxo oodop eaueo;()s2tmirpnu1lptnlieta(  rra(m nu4tptnmi3tyslaDul(msnt)trtnirctadlateaueo s) rtoxo3oo1lp  mnei ( artm( o;o1texo i3iatlm2rauvonu4texrxf ta1fm ean i (0tetrimpiudomeelicsat a2taurpnt4tetn i3ild aDrauvo t0 ltoifciodfaDr neilt0t2tmxr3no4llte ivs sfs2ur( p;t4optnmfeiydfa el(vsn(4 leoxfcoy1fa   u o;s0 rxmxopny4lptemneslt artmxm ;o1olenio3ildfa umu p u4 eenmo oodomt  u slt teuo(o ou4al   fcsa(fs2rrxrp;t1tltoiociltfmDea(mpn(0aetrxfctadlmDeaivo;s0 rurxm oy4al n iei s srrmu  ot1tpx  i3tltla2ulu p;u)trxoxf tydfaD  ies;t0 exmxo iu4amtnmnvt s  2umu p;u4oet mfctad m elnms t)altoio oo1omD aivi;( s2to(o3oy1opeemncsa( aDtauro;u1altoii3iatfm eluvs t4 ltoxo3tadfp  lnes t0t2uo(o nu1al  lici () 2ta(ro;u1tpxo ietadfa2umuvs;() rxrmo oo1fa   i i;t sexmio oydamt mivtas  2tr(  ou0openmi3iasfs2rau s;(4 lerir3tytomt  u il(0 2to(o ou1ll nlfvsatfs2rmx o;o4tlenmietls m2em( s ()tltrxr iotomt au o (0tetrxopiydopte fctlt)sDur(m ;t4aleoio3ildfmDra(mont) eenio3totfmteaivi;s0s2tmimpio1aleemnet sfartaxmo;o0teeo fcils s2ulu o;u) lxnifcty1fa eaivi;t0trto(r nu4lltelivs tfs2tmxm no4oee  feias a rlums () lerifctydfmDe uvo t setoirpny1lptelivil(fs2rr(  nt0altomi3iat mDulnmo;(4areoir3iytfpDrli o;t0 rur(o ny1openmncsa(f 2rru pou4tlxo fctyslsDel(mp;u)texomo3iadoptrli olt0 2um(mpiy4lpt mivils srurum ;o4oexomfctasls raumon(0trtoxocoydfa r ues;(  rumim nu1omenlnvia( sDuaum oo4optnii3tld sDrl(mon(0artomrcta1lp elivo;(0 eurxopnu1olen neia(fa2tr( ont4tlt mieiyt a2uau p;(0 lerio3oy1lmDe ivo s) euo(r nu4lpe livtls) 2umumo;u0teen ictldlsDrm(ms (0 ltnxf3iatlm  li sls)t2ur(o io4ame mies ( s2rru oou1apto feiyd sDelnvp u)tlxomf3iadfpt luvo;s srtoxo oo1amtelnes tfa2um(r oo1tlt  ieiat s2rlnvp;u)artrxo oy1omtrlueil( truoimpiy4lle  nvs s aDra(rpnu1opt mf3iytfm rm(vo;u4texrmo3tatla rli i;t0t2tmxo3ny1lpenmivsat)aDtrx  ou0aptniociaslm2uln s;t0texnio3oydlmDeln ols0 eum(rpiodamt  fcslt)a2raur ;o0oltnifciytfmDua( s;t0trtnxo todfpt au ils setoir3iydaltnmneias srra(mp;o0alxn icilt s umnvpn()tltrifcoodoaDelieol( setmimpno4am emivt ()a2uax pot0olt  fciadlmDrl(vp u0 lxrxf3iydomDran slt0 rtoimpnydom  licilsfsrrrx  oo4open oetlt aDelnmonu4artnio3oytfatelueo s0 2tm(m oodomt mnvil(fs2um( p;o1opeoiieiasfm ra(ms;(4tltomo3tydlp  anvs s0sexmim3ny4opeemnet (faDuaxmoot0apxniictat a emu o u)tlenif3tydfp  livi s0seumxm no4om nlneslt) 2rru o;o1apx if3tyd m2elnmp u0aetrxr3oo1lmt livs;s trum(m3iy4lpt  ieta(fsDta(moou0oex mf3tatfm ea(mon()texoxrcoa1fm eau i;s) rtm(m3io4olt mfvsatfs2urxmpnt0tpxn ieiasfa ulums;u0tlxoio iodfpDe ivol(  2tmimpiy1ope  fei () Drrumooo1tltn o3tyt a2ul(ms t) renxf tytoptr i s;() 2toir iy1ole livsa(f Drru  ou4olxoiiciatlm ea(mp t)teenxfcoydlptrai o s  ruriopiy1lmtn ivias)aDrmuronu1tpx ifciat m2rl(monu0trtoio3oydlpD aiesl()trtrxo3iy4omenlietl( aDta(rp;o0texomieiyd aDul(mo u4 rtomf3tytfmtr i s;()teumxr io1omenlivtas)a2tmumoot1tet mfciydfs2rm( ont0arxrmf3oydfa r uvs;(0trxo(r nydaptnlici t aDrru o;u4apeoiietas a uaums u)aeenmoctytom raivo;( seurim3oudaltnmies s sDurx p;o4olxnmf3ias s umu pnu4 rtnxo3iydfa   n ols trxoxmpiu4amenmnvt (faDtmxrpno1oltn oeias s2rl(vp ()areomrcoa1opt an o t sexoxrpoudaleelivtat s2ua(r ot4opxo iciaslmDem(mp t0artrmfcoodlm e n ols) etoio3io4al nlnetltf 2ra( pnt0tlxomi3ilsfm2emuvsnu0alenxoctydlat anvi t0srxmio3ou1omtn icils) rtaxm ;u0tex moeiltfm2elump;u)aetoxr oy1faD lnvs;t)texrio iu1oleelnet t)a2raump;o4tleoioctatlm eau p;u0tltrmf3ta1lpDrlnei;t  2uoxo3ou1ol nlfvtatfartr(rp;o1alto oeiadfaDrlump u0 eenxr3io1fpt aueils)t2um(opoo4ole mnvs t s2um( oou4tpx mictat m rauvp t)alxnmr iy1lm e uvi t  2xo(m3nudlme lfes ()sDumumonu0tlt  feiys mDrmnvs t0tlenmrcoo1fatrlies;s sexrxm oo1optnmfciasfsrumur ;t1tet mieilsfa ranmo;t)aetoxf oo1lm elnvi s sruoirpiy1lp  mfci (fsrrmxm ot1aee mi3iyd m rlnmpnu) exnmfciydla elnes s setr(r ny4alte ietl(fs2tm(mpot4apxniocildfa rl(ms;u4aleoiocia1fat aivs s) 2um(rpoy1optnmfvi s s2trum no4tpto o3tadlm rl(mp;t4 rtnxf oo1lmteau sls  2umio iu1ol elnetat  Duaxr ;o4olx mieilt sDrmn p t4aeermo3io1oaDeanvslt)srum(m ou1opte nvtasfs2rmu pno1aptnif3ilt sDrau o (0areoif3oytfa   neilt0t2umim no1lm n ivtat)sDra(mpou1olxnio3tys s ean snu) rerxr3ootfaDelu slt0s2toxr iudlmtnlnvtat)arraurpno0tpxnmf3iat m rln snt)arxoiocto1omtraies;t s2to(o iu1amen ict tfa2rrxronu0tptn fciadfm ulu o;(4alxnio3oatlmD aueils seur(m ou4opt  ietl( aruaurp;t4apeoiocils sDua(msnt4tltoxr oy1fa rai olt) exmxo oodamee ivi s  Dururoou4tlxoif3iyd m2uanvp;u4 rtomo oodoaD lieils  exriopoy1olte nvsat) 2raumo;o1olenmfciltla2eluvs;u4trtrmo3iotfp  aieol() 2xrxo3nudlltelnvslt srum(  ou1apxo ieiyd sDum( pnu0alxnmf iatopteanvo;( s2to(r3oy1openlncs t)sDtau pou4tpenmo3ildlm2emu p u0tleomfcoa1oa r n ilt0 2uoir oy4lm e fcsat)aDrmu pot4apeoif3tydlm2rmu s;(4 etoir3tytlat ai i t)s2xmim nu4lm   ivt s)arurumo;o0tetniiciltfmDel(vs;t0treomo3oatoptrai ils) etmxm3iy4al e icsl()aDrr(rpot4tlxnmo3iasfaDem(ms u0tltoio3iotfp r u i;t) rxmxmpoudal emietl()arrm(m ;t4altnio3iat mDrlu p u4altrxr iodfpD au o s0tetmxr3oo4alt  fviatfsDur(m ;o0alx miciltla elu o;u0artomrciadfm  luvo s0 2urim3ny1omtelicsa(fa2taxmo;o4oetnioeiltlaDrlnvo;u0arermr3to1om e ies;(  rxm(m3nodameelfviltfs2rax  no0aeenii3tydfs em(mon(0treoxr ootop elies t texo(r3ny4om  livtltfartmum ot0tle ifetys m umumon(0 ltniocootlmt  i s ()srtr(m oy1lle lnvt s sDtaxro;t1alen fcilsfmDul( s t)alxrxocoydfaDrlnes;s  rtr(opnudaleelnviat s2tau ono1tee mictad aDuluvpn(0trtoxociytfm rlnvs;()seumxm oydlmtn nvi t  Drmxrpno1ope  feildla rmuvpn(4 eeoxo3to1laD  ueo t0t2toio ou4llt mivt sfa2tr(mpnu0tptoiieilsfs uln p;(0aetnmf oodoptrlnvs;s t2umxr3nudolt lnvtas srum( pnu4oeto o3iasfa rau s;t0tlenio oydlmtrluvi;s)t2toim3nydlle lncs t)a2umxrpnu1tpt  i3ias sDum( pn(0 rtnxr3iotoaDe ues t s2ur(r iodlp emnvia()s2taxm no0tlxn o3ilslm eanvo;(0texnxr3todlmtrlu s;(0 2to(o iudameemnct sf 2trur nt4tlxoioetadfs2rln p t)arermr3iatla  ai slt)s2xo(r3nodop  mfvt () 2umxrooo0alen oetaslsDrmnvs;(4 ltnir todlp eaueil(0 2xmxm3iodap nmiei () rrmu  ;o0alx  i3iytfa rlnvp u0artnmr oytopte nvi;(0 eum(r3iu1op nmfvt sfs2ta(mont0olto ieiydfa rl( o;t0 eenio oytlm   ivi;(0t2tm(o oo1lp  mnetl(fartaxmoot0tleo fciysfsDelnvp u) etniocoydopt  nvol( srtm(opiy1lm n icsa(  2uaxro;t4olx mo3iydfs el(vs;t0 etnircto1fmD ai o s) 2um(opou4ap elfcil() rrau  ;u0tpx moctat a2ulumo;u4 eenircoodoatr u o;t  etr(r3ny4alen net s) 2taxrpnu1teto ietltfm2rmn p;t4arxomf3oodla raivsl(0setoir3oy4omt lnvslsfaDtrxmoot1tlxo feiyt m2rmuvo;t)teeoxf to1oatrli i;s) 2tmim io1amte ivil() Drmump;o4tlxn i3tld a ranvp;u4tlxoxfctytoa eai s s0 2xmio nydlm elneta(  rumu  oo4aetn ietadfmDem(monu) eerio3ia1laD au sls setrimpiu1aptelnes sfsDtmumont0aleniiciytfa2um(mpnt4 etnxr3oy1fmD anes ()srtrxr io1lmte fvi ()sDra(ro;t1tlto iciadla2eau o;t)tetrmo oadoateai i ()teuoxo3iu1op nmictatf Dtru pnt1tltoio3iadfm2ra( o () etnir oa1opteai sl( trumim ny4ale lieiltfsrrmuronu0texoiocilslaDem( s u0 exrmfcoo1omte i i ( t2urimpiudol nlicia()sDtau poo1aeen i3iatfsDrluvsnu)teeniocia1laDe ivslt  rxriopio1al emivilt a2taxrpot4olx  ocilt m2ua(mp;u4alerxo iadfp r n slt0teur(rpiudol e nct sfs2tau pou0alxn iciat sDumn snu4 lxoxr3iotla eaivs;(  rtoxo3oodopeemfctlt  rtaxro;t1optn i3iaslm2ea(ms (0 rtrmoctatfatranei;s t2trxo3no1lmenmncilt)srtm(m oo4ope mfetatlm rm( o t)aeeoxf3ty1la   u i;s0setr(m3no4ap e fcsasf ruaxrp;u0aet  ieildfm2emn p ()arxrmrciytlp   ivo;t0s2xmiopnu4lm  mnvia( s2trxm ou1tlxomf3tlslmDelnvsnt0tltoif3iodla ranvi s)s2to(r iy4altemfeslt)aDrm(  no4opx ioeiad sDulu o;u)tlxnxr totoatrluei t t2um(o nodlle  iet ( a2uaxr nt1oltn ieiys m2rm(msnt)aexrio tatfaDe uvs s t2toxr3ou4am  mfvils)artrurpot0apxnioctyt a el( p;t4trxoio3totlaD lueslt0trxo(o iu1op  lici ( sDtrur nu1aetoioeilsfs2rm(mo;t4arxrif3tatfaDranvo t0teumiopou1lmen fvs s s2um( pnt0oet  iciytfa ranms;t)tetrif3iytoa e nvils)tetmir3oydolen ietl()s2ra(m nu0opxn i3ilsfsDea(ms u4texnmr3iadoa  lnvi;()texrio3nudoltn fetls) rumumono4tex mfciasfaDemu on()arxoifctotfaD aiei s0t2trio iy1om emfetas) Durx  no4olxn feiysfm2rlnmonu0texrxrciytfaDrln ilt srtoim3iydal e nes t) 2rm(mooo0apxniictadfm rluvpnt0arxomo3io1om r neo t0srxoxr ou4omenlictls) rum(  ot1alt mi3iysfmDrl( onu4trxoxo iatfpDrln i (  eurxm3no4al   iesasfs2um(mpno4optnio3iys m ea(ms;u4 rxoif oy1oa   ivs;s0seto(o3io1opte fcsas s2truro;t1oeeo i3tyt a uanvp;u0teerxr todoa rlnvs;()trxmxo3oo4am nlfvta(fartau ono4opxnif3iyd mDem(vp;t)trtnmrciotlpteln ils)tetmxm3ny1lptnlncs sfsDrrx onu0oeeo feild m2umump;u)tlxnmf iy1fateli i;t)tetrio3ou1alt  ietlt s2tru pno4oeenii3iat a uauvp u4texoxr tadomt aneolt)teuo(rpny4amt lfeslt)s2tau pou0oetoifciyt s umumsnt) lxrmocoy1lptrlueo s0 rxmxo3iy4omt lnviat) Drm(moot0tlto icias mDrl( sn() etrxr iatopDrau olt)texmio3nu4lmenmfct (  rta(mo;t4oeto ocild s2rm(mon(4 etoir3iatfmt anes;s0trxr(opio1lm e ietl(faDumxmpnu4alxniictyt a uanmo;t0alxnio3iotlpDeanvs (  exrirpoy4aleelnes sf Dur( ooo1apxnmieild aDrlnvs;(4 eenxo ia1lmt au i;(0t2tr(o oy4ol emivslt)s2ta(moou1oeeoiiciytlsDum(vpnt0 rxnir3iotoaDe neo;s)s2xmxr3oudlm  lnviat) rtaum nt4oet  o3tydfmDrauvs;u4trxomoctatlp elivi (0trtoxrpnydamenlicsltf Drrxmo;u1teeoiocilt aDra( o ()tetoxociydfm e uvi;(0srtoxo3nudole lnvtlt s2umx  ot4tle ifciltlmDrmnvsnt4arermr3ootom rlivo t)seuo(opoy4ll emfct t arum(m ;o1aet iietydlmDrl(mon(0aexoxrciy1opDean sl( s2ur(o oydopenmietl(  2umu pnt1alt iictlsfaDra(vs;u4 eenio ia1late u o;s  2um(o iy4open nesa(fs2rmuroou1open oeiydls2umuvp u4 rtoxf iydla   n s t  etoir iudllee nciatf 2rrx oou4apen o3iltlsDrln p u0trxomf ia1lpDe u s s sexoio3oy1om  lfcil( aruau oot0olt mfeild m rm(vont) leoir3oadlp r n olt s2urxo3iu4op elnesl(fsrtru pou4oee iictldlsDemump;t4 lxoif oytfm  aivo () rtoxrpou4lle  ictls a2rmurp;t0aexomf3iys s2ul(mo;(0trermfctodfmt  ieslt) rum(r3oo1am nlfvta() 2rau  oo4oltnmociysla2ra(mpn() lxrircoatomtrln i;s) 2xoio3ny1om nlfvsa(fa2urxr ou1tpxomfciyd aDulums (4 rxrmrcootfp eaneo;(  rxmxmpou1lpeemnvtat)a2ur( o;u0oexomieiyslm emuvo (4tetoifcoa1lpteli s;t s2trxm3iydapt lneias) Durum ot1aee iiciltfaDumu o u)trxoxrcootomt au o (0 rtoirpiy1olen nvi sfsrurumpoo4tptn feiytlsDumn o;(0 rtrio oatopDr n o (0 2xr(r no1ap n feils)arrru pnu4tlt iictytlm uau s () eerxo3oadopt liesls)srtr(r3io4ame miei s)sDuau  ;t0opeoio3iatfa elumsn()tltrmr oo1lptr nvol(0 eto(o oydop e iet () Draum ;u1ale  ieiysfaDrm(mpnt0arxnxrcta1omD li ol()trurim iudam emivt s) Dtm(monu0apt ii3iasfm2umump ()artrmf ootom raneo t)seum(r iydapt  nvsl( s2tau oou0tptomicildfa2rlump;(4alerxf to1fpDeli sl()tetmxm iu4llt  icia()s2urx ooo0opeoii3ilt aDum(vpn(0artnxr3iatfmte i slt)trurxrpoo1lltn fes t arumumo;o0ope  ieias a uluvpnu0arxrmr ootlpDeaues s0 ruoirpoo4ol  miesas  rur(r ;u4oexo i3ild a rmnms u0 reomfcoadlaD  n i;()setoir3io4lmen ictlt) Dta(rpoo1tltnmf3tyd a2ul(mont4artnxf todfmte u ol(  ruoir3iudlme mfeil( aDua(  ;o4opt  ociydlm umuvsnu4 rxnxr3iytfmDe u i t0trxoxrpiu4lmeemfvsls arurx oot4oleoifciysls2ulnms;(4tltrxo3iatoat lueilt) euoir io1oltnmnvilt)aDumx p;o1opx  i3ildlmDuan snt4aexoifctotoa eaueolt)sruoxr3oydlm e ieilt) 2um(  oo1opeoiieilt s umnvpn(0 rxoif3ootlp  auvo;t0trtr(r3oudome  ncs s srurxr no4apxnio3iadfsDeaumpnu) etrmo tydopt  neols0t2xm(m nu1llee nctat)srtm( p;o0apxnmfetytfaDuauvpn(4trxrifciy1fpDe n o;s0trtoxmpou1lme lnvia( srtrxm nt0tlt mi3tltlmDrm(mo;(4 rxnio iydfaD auesl(0seurxr iu4amte ncsl(fsDurx  no1oeen ietydlm emnvpnu)aexrxo3oo1fmte uei t)trtm(m iodlmeelnvil(farurx pno0alxo octad m2um( p (0tleoio todfpDe nvo;t0s2xo(r3no1openlfvsatfaDrm(mo;t0olxo f3iyt m ua( on(4tleoxr iotoptelueols)truo(rpoudamtnlfvta()srtm(m ;t1olx  o3iatlmDrlnmo;t0 exnmr3oatlp ean i s)tetrxo3nodlm nlnctls a2taurp;t1optnifctldla uan s;(4areoif3ootoptelivi;(0 rxoxm3oy1llen iciat)s2umump;t1tex ifeiytfs em(mp;t)texnxr iytlmtraueols0 2urxrpoydom elfvslt  2ur(  nt4teen f3iyt a2rm(ms t0altrxf3oytlp raivils)teto(o no1ale  fcsls) Draxrono1tlxnmietasfs2um( pnu)tetnxrctatlmDeauesl(0teumio no1lptemfvtl(f rurxmo;t4tleo f3iatla2ranvpn(4trerif oa1omDrauvi s)trxr(r nydllenliesa(farumu pot1tlxnifctad a um(mpnu)trerxf3iy1op rai ilt0seuo(opio1op nmfeia(  rtrur ;o4aetn feildls rluvo ()aexrmr3ootlp   neol()srtoir io4opt  fcil( s2urum nu4aeenioeiydls2umn s (4trxrxr3tatlatr nvo t texoir3io4lm   ncsatfsDtaur ;o4oexnio3tasfs2em( o t4tleoif iatfaDe n o t) rtriopoo1lpe livs sfa2ra(rp;o4tetomfeilsla uauvs;u) etnioctydlaD li ol(0s2umirpoy1alt  ies ( sDuaxro;u0olxoii3iltla rl(mo (4aetrmf oodlateai o () etoimpnu1ol nmneiatfa2rmx  no4apeniiciytfa uln s;() eermoctotopD  ueilt)t2xoiopny1opt mnes ( arumx pnt0olx ifcilt m2rmu pn(4alxnmr3iytopDraieols)t2ur(mpno4aptn nvs tfsDumxroot1tpeo feiatfs2ea( o t0aeeoif3oa1fatr i s ()t2uo(o oy1altemfvias) Dtau  oo4oeen i3ildla2ul(vpn(0 rtrxfcoatlm r i s;t)t2toir nu4ole lnvt t)a2trx o;u0altnioctltfsDelnmo;u0arermf3iatfp elues;( trurir3io4lp  lfesat) Dtauroot0tetn ociad a uanmo t4texnxr3oodfaDeln o;() 2trxopoy4opt lfvtas aDrr(m ot1tetomo3tlt s2emu s;u)areoirciotlmtelivsls0 2umiopiydomt lnvtlt)s2uaurp;t4oexomiciatlmDeln s (0tlxomr tydfa  ai o;t t2to(r3oudam nmiet ( a2tax ont4tleo f3ildfs uanvo t4 exrir oodfp e n il(0 rur(m3ou4lleelfciltfa2tau pou0tpeomfeiad m el( o t) rerxf3iydla   i ols0tetm(opno1altn ictasf 2tau  no1altoio3tldlaDeaumonu)arxnmr oydoat  ivi s0trxmxm io4lmeelncias a2tm(r ot4ole  i3ild s umump;u) eenio io1optrliesls)seur(m3oy1lmtemnvilt)aDumur ot4apxniicias s rmnmo;t) rxoiocoodoat  u s s0 eur(mpoudopee iesl( a2tm( pnu1teeoioeiltfa umu s t0areoxf3oytfm  aueils)sexoir3nodop nlicsat)s2tm( o;u4ope ioeiadfm2rlnvp t0teeoxr3oy1fpteln sl( t2tmir3nu1ape mfcilsfaDumumonu1tlxomi3iatla2el(vo u0tltnir io1lm eaueslt0srum(m3ny1ll nlfes t  2rau  ou1apenmictyd mDuln on(4artnxr3ootfpteaivs;s trurxm3ny1omtn neias) Draur nu1opx mfeiyt s2em( p;t)teerio tydoate neo s0trxoim oy4ap  lfvtls) 2rm(r oo1olen f3ildfa rmnvsnt) lxoirctadfpteluvi t)s2xrxo3io4alt lfcsa(farua(m ou1altoifctltfa2ulnmonu4 rtrmf oatfp  lu o t0 rtoiopiu4ame lfctls)a2umu p;o4tee mfciysfa ra(vp;u0 rxrmocoo1op raues;( t2xoxo oo1lpe mfvs t  ruax pot4teeoifeildfsDuluvs u4tetnmf3iy1oaDeaivil( s2toirpiodop nmfetat) rta( o;o4aeto octat mDemums;(4tetoircoydfmDr nei;( trxrimpou1am nlnciasfa2uau p;t1aee mo3iadlmDra(vpnu0treoxo iytfaDrlnes;t0trtrxo oodal n ietat sDurumo;u1oleoioctyd aDra(mo u0 rtomf todfm raies;t)trxo(o3iodap elfct s  ruaxr ;o0apxnmfetasfs2umumo ()arenxo ootfa e n o (0 ruoim3oo1ome mfcilt  rrm(  nu4tet io3tls mDeluvsn(0tetrmo oa1la ran i;t trxmxrpnodamtemfei sfaDrr(m nu0tlt  i3ias aDua(msnu0trermo tytlatr ieo s0sexo(m3io4lmenmfvsat  Dtr(mpoo1tpt  fctatfs2elu sn(4teeoio iydop  aivi (0 rxoxrpoo1lme mfcia( s2urxmo;t1oetomfciysfs2ul( pnt4 etomr oydfa elues ( s2xmxrpnodamtelnvi (farumum ;t1opeomoctasfm elnvpnu)tlxriocto1fmD lu o;() etmim3no4ol nmiei s sDur( pot0tpt io3iys a2eauvs;u4aetomr iotom rln sls0t2uo(rpiodlp elnes t arua(  ou1tpxomfeiadfm2umu o;t4alenir oatlmD aivi;t trxmiopoodole  nes s sDum(  nt0tlxn fetytfa2rm( s t0 ltomfcty1lmDrau o;s) 2xriopnu1oltelietas  2uax o;o4teeoiietlsfs ulnmo;u)arxnmr3tydop e n slt0t2xoim iu4lp nmfes s)artr(mpou1tlt ioetyt s eanmonu0tltoxfcoo1fmD ai s t)trur(r iy1optelietatf rum(m oo4oeeomoetad a2emnmont)altnio iodomD  u s;t0 2tr(m oodamenlnvi (fsDuau pou4tlx iociys mDumu sn(0tetoif todopt lnvilt0t2ur(r nydlm   icsa(faDtaxmpnt1apxoii3tatfa2uluvsnt0aeerifcootlatr ieo (  rtoxo oydap emnvtlt aDrr(m nu1oleomi3iyd sDrauvo;u4tlenmf3tydfpD au o;s sexo(r3oy4lp n fesl( arum(mp;t0tex io3ilt a rm(mon(0 leoxfciy1fp eluvsl()srxm(o iy4altn neta()s2tm( pou4olxo oeiyslmDean s t0altnxo3oy1oatrlu ol(  2umxrpno4ll emfcta()aruaxmp;t1aeenmieiatla ra( p;u)treoxfciatopDeau ols0 rxrxr3iydapt livia(f rta(r no4tpenmi3iat a2rmuvpn(0 rtoif3oadoaD  n i;t srxo(mpny4opt mnci tfs2rrur no0aee moctadlmDelu p t)tltoxr3iydopD ln s;(0trxoxo ou1ol n fet t  ruru o;u1alto ietld s ul(vont4 rtnxfcio1om rlnvils0texoir3nydll n ictat)arrau oou1oltoioeiyslm2ua(ms u4 ltoxr3oadlp  lues;t  exoio3iy1ll   feilsfaDtm(r no0altnmfcilt sDeluvo (0artoif tytlaDelueilt  2xrirpou1ll elncs ( a2rr(ro;o0oet  i3iadfaDum(mo u4tltnxocoy1lmDelueo (  etmxr3iy4ll n ietl(  Dtrx p;t4aetoii3iat aDea( p t4 lenxf iodopD aivols0 2xo(opoo4ome  ivta()arrrxrpnu0aleomoctltfmDel(mo (4 etrircty1omD li i;t  euoxo3ou4amen fvt (fartrxm ;t4aeen fctlt s emnmonu4arxoxfcia1fpteluei;(0 2triopiydopte fci sfs2ua(mp;o4oeenmieiytfa2uanvon(4teermf io1la e neols)seur(mpoy4ol n netl( a2tr( o;o1tpt ifcildlaDran o u0tleoif oo1om  lnesl(0t2tm(mpnydomtnmivtls)s2taumpno1ope iieils sDeauvpnu) rxnmr3ia1laDeluvo s t2urxr oydapt  ics sfs2rm(rpou4aet  oeiaslaDeanmpnu4tlenxocio1opte n s s s2tmxm no4lltnlieils) Drm( oot1tex  ociytlm2rau s ()artnmr3oatlaDelues t srxmxmpiu4aleelieiat sDuaxm no0ole moetat mDuau p ()texoio tadopD ln s;s t2tr(opio1lpe lncsl(  rrmxr ;o1aptoiiciysls2ul(vs u)trerir3oytoa eaivslt) euoxm nodop  lfvtat a2tmxmp;o0tpenmfeiasla rl( o;()aexoif tydopDe i s (0t2xo(mpnodape  net s s2rrx o;o4opeomoeiltfs emnvs t)trxoir3ia1lm e n s;s trtmxr3oy1lpe liesas  Duru o;t4oltomo3tys s2emu s;u)tltoio3oadomDe ueilt)sexrxm3iu4lptnmncs ()srurx  no4opxn icias a2rlu s u0 etnmo oytlmt lu sl(0 2uoxo3iy1oleemfcta() 2tru onu0aeen iciadlsDrlnmpnu)aexrxo iydop  auvs;s  exrio3nodol e fvt t  Dta(mpoo0aexnmoeiytfs2ea(vp t0 lenxoctodlatr i i t0 2toxr3nydolt lfvi ( sDtmur no1tpen i3iydfsDem(vo u0alxoir oa1op  lieolt  etmxr no1lmt lieslsfs2tm(  nt1altniieild mDumumo t0altnmf iodlpt au ils0t2uo(o nu4olt lies (fs2trumpot1aexn iciytfs2ra( p;t4 etnmr3oa1faDeai o t)s2umxrpny4lltemfvtas) Duaxro;o4tetnmoctldlmDuluvsn(4tleomf iadfmD auvi t t2umio nydal  lnvi sfs2umxrpoo1alt mictls m el( o;u0artniocoytla r uei;t0texrir3oodllt mfvtls)aDrrum ;o0oetomoeild s raump;(4trerxo tadlptr uvo;( trtrxo3iy4aptnlnctltfartr(m ot4olx ifciadls em(mp;() eenif oa1lmD lieo;t) 2xrirpnydlle mfeia()sDurx  ou1teeomietltla ean o;(4aeerxr3iydfpt  n o t  rxo(opoodom nlnvia(  2raum ;u1oeenmfciyslsDea( s;() exoxrcoa1lpDe n o ()srxoio oo4oltemiei t) 2ta(rpnu0alenmi3iys s2ra(von() etomo todlpDr i s t srtr(m3oo1llenlneias)sDrmum ot4oetoioctlt s2rauvon()aetnmoctatopteauesl()trtmxmpnu4lltelfvslt arua(  nt1aeenifeilslsDem(mp;(0 lerxrcoatop e n il()teurir3nodlmeelfvs (fa2taumo;t4tlt  fctadfa2rlums ()aexnxocoy1fmteai slt  rto(o3ou1lp  lictls s2ra(  nu4tpxoifetlt m raums u0alerif oo1op r i i (0tetrxmpoo1am emncs tf 2rru  ;t1apt mi3iadlaDrmn p;t) rtomo3iydlp r n s;(  rtr(o3io1al  mivs t srur(rpot1olxoiiciltlmDeanvpnu4trxnio tydlpt lnei t srxrxrpnudaleemfcs s s2tmxmo;t1aeenii3ils s eanvo;(0aetrxrcta1lpt auvsls  rtmxo3nodol nmieil(fs2ta( o;t1tpeomfeias m rm(mon(4aetrmr3io1fpt ai il(0truoir3oydal e ivt s s2ur(rono4oeenmf3iasla emums;t4teeoxf oo1fatelies;() 2xoxm oodol nlnetas aDtmxmo;o0oex mfciat a2el(mo t0tetnxfciydoaDrau s ( trxoxr3nudlpt micta(fsDuaxr no4aetoifciyt a uaump;t4aeermociotfatrlueols trxrirpiodap  mivils)s2tru o;o0ape moetytlsDuln s u)aleoxf oy1om rauesls setmxm3ny1opt lneils)srrmu  ou4teto fctlslaDul(vpn(0arxrmr3oy1la   n sl()t2umim3iu4ome lnvil()arurxro;u0oexoioctyt s2emnvpn(4teermocto1laDe n o;s) eurimpoy1ale  fcias s2rrx onu1ole mo3tadfm emnvp;(0alerxr oa1fptran i;s)trxmir nodapenlfcsls) Drmxrpou1alx  fctyt a2uaump ()altnif3ootfatrln i;( teumim3oo1lm  mfes s srum( p;t1apenmo3tadla2ea( p;u)altoxr3iotfaDeluvols)s2to(m3no1am emicsa()s2tmxrp;t1oex iieiydlm2eaumo;t0arerxo totla r i s;t0 exmimpny4lp  mfetlt)s2umxmo;u0aptn oeiys a2el(mo;t)tlermocoydfate i i;t0s2trio oo4aptnmict tfartrxrpoo1tltomoeiydla2eau o;u4texomf3iy1oat ln slt0s2trxo ou4lmtelneil(f 2umx  ;o4teto oeiyd a rm(mp;u) rxrmfcoa1opDr u i;t)trxr(rpny1lp   icil(  2rmxr ot0alt mo3iyt a ua(mo u0 lxrxocoadfmDraueo s t2urim iy4lp nlneiat)arrrxm ot1apenmiciasls rmu o t4tleoxr3iytlpteaueo t0srtm(m3iydom  mfci ( aDurxmooo1aex mi3tlt s2rmu ont)alerif3tytfpt  uei ()t2trxo iy1ap  lneilsf Drau pno0alxnmfetyt mDrl(mo t4texrmrctydlat lneols  2ur(mpiy1ap n icsl(fartmu  ;t4oeeo fciatlsDeaump;(4trtrxr3oodoaD ln i;t t2tmxo iy4ol n nvsl( a2rau p;t0opxoifcils m rmump;(0aetrmr3iotlpte i o;t t2toio3iy4ope mfvtas  rumuroot4opx io3tadfa2rau s (0tltnxr3oadfpD aneo t  etrir ou4amtnlneiasfsrraum nu1opxnio3ild m rlnms t)tlxnir ty1lm eanes t)seum(mpiu1aleemnvsl(fsrtrur ot0alxn f3iydls2ua( on() ltoifcootop e nvols0tetr(r io4op n nes t sDtaumpot1oee mi3iltfm2emuvs t)arxnxocia1om   uvi t) etrir3oy4lm nmncil()arra(rpno1oee  o3iltfa el( onu4aeeomr tadlaDelu o s0srto(rpiu4amen ictat) Drrum nt1tpt  f3iad a2elnmsn(0alerxf3iy1lat  n sl()tetrxopno1opt livi sf rtrxm ;u0tetn fcilslsDulumsnt)alxoxocoodlp rai i t0 rumirpnu1ale lfct t  rrmu  ;o4alt ii3iatfaDua(vp t4 rtoif3todop r ieo;s s2xm(m iydllt  ivilt srrmuroou1oex if3iatla2emn o;t0arxomr iodomDeanvo s0s2tr(r3ny4amtnmivsas s2tax  ;t4oet  fciydla uaump u0trermrcoadfa r nvi ()trurxmpio4ape licsas  Dtaxrono1tet  iciys s eau s;(4aleoxrcoatfmDraneo (0t2toxr3iudll  lfctatf Dtm(mpnu4alxn oetlsfa uanvonu0trermf tytlmteluvo (0tetm(m iodlmeemivtlt)sDta(rpnt1tptnifetys a um( p;u4altrxf oydom  lu i;s)s2xoxm oodlmeemfcsl( srrmu ooo4alx moeiltfmDrmumon()teeomr3tatfm  lues;t s2um(opoo1opt lnesat)sDtrxronu0apx iociadlaDum( pnu)tltrmf oatfp r ivo t  exoxo io4op   neslsfsrrm(r ;u0tlt  ociatfa2eluvo (0 renif oodlpt  uvo t)sruo(mpiu1ome  ivtlt)arrrxm oo0ale  ieiyt s2ra(msn(0treoxf oadlat  nvo;s s2umir3no1lme lici s) 2rauro;t4oexomfcilt s2rlu p;u)tlenio tytfp  livo;(  rxm(m3ou1altelicil( arra(mpoo4apen fetydfa2em(vsnu)trtoiociytoptelues t  exo(o no4amtn netlsfarra(moou0olxomociaslsDran p t0altrmf ty1latr nesls  etr(o iy1lmtn ietlt srurxmpoo4aetn ictys s umnms (0 ltrxr3iotfp   ivi;s tetoxm3nudlp nmfcta(  Dum(rpnu1optoiieilsfaDrln onu0 rtnmfctytlm e u o s0 rumxo3iu1ome  fvs ( a2ra( p;u0alx miciadfs2rluvsn()tltomf3iytlm e nvi ( t2xoir3iu4llt lictlt arumx pno0opeo ieiytlmDemnvo;(0alerxr3totfp e n o s t2toxopnodolen icia(f rraumooo1oee iiciatfa rau pnt0teeoxfcoa1lateaieo;s0trtmirpoy1olenlicils) Dumuro;t1apt mf3iad aDul(vpn()tetrir ta1opt  ueilt0seuoxm3oudomt mncs sf rua(m ou0olt  f3iydfs2rlnms;(0 lenmf ia1latr n slt)seuoiopiu4lme  fciat)srrrxmoou4opxoifciydlm2elumo u) exrxociatlmDraieols0srxoimpiy1llt mnvslsf 2tmxr ot1tpxoifctytls ulnvp (0teermf tatlm rlueo;()setrim nu4lptelfeiasfs2trum oo0tltoio3iltls ea(vs;()alerxf3oydfm  lieo;s)setr(r oodalt licsls  2trx  no4apx ioeildlm em( p ()tltnmf oo1lat aueols) euoxr nu4lmeelictatfaDtmxrpoo0alxnif3ildfs ra(vonu0texnmociatlaD  ueil( srtm(m3iy1olt  nviatf Dtrx pno0teeniiciys aDelu p;t0tlxrifcoodlp eanes () rxoxm oodopt mivi sfaDumx onu1tlt if3iys aDrlnms ()trtoiociydop elu s ()srtr(m oudole lictl()aDta( ono0aet mi3tlsls rmn s t)trxoircoodfptr nvs ( tetrxr3iy1lpeelfcilt a2rm(ro;u1tetnmociytfsDulumpnu)tlenmr ta1fp  ai s;s trumxmpio1apt mneils) rtmxmonu4teen ieiyt s eau s;u) lxrmr3oo1lp eliei;t  exmio3iu4alt lfcsa(  Dur(r nu0teeo ieiydls ul(mpnu0aetrxrciy1fpteauvi s0sruo(m iydaltn nvtlt srrmu o;t0alt mf3iadlm2raumon(4aeermo3to1lm elieo;t)s2urir oo1lp  micsl( a2tmx poo4tpt mo3iltlsDelnvp u0aexnmf3iytop  luvs t)srur(o3iu4aptn nvils) rta( pou4tet  i3taslsDeauvsn(0 exoifciy1fp r nes ( tetr(mpiu1lpt lnesas  2rm(moou4tpe mictytlm rmu s;() eerxr iotlp ranvolt  euoxo iu4lleelnctls) Dtaxrpnt4oltn o3tld a2rau p;t0 lxoiocootlpDeaivs s)texoio3ou4altn nei s)arrax pnt0altoiieiyd mDeaums u) rxnxo3io1fmteanvo t  rurxrpiudlp  mfvtas)arrm( oou1aee ifetysfa2ea( s;()tlxnmfcoatopDrau s;s  2tmxm oodope lfeias arum(moot0opx iicildla2uaumsnt0trtnxo tatopD  uvi;s srumxr iydll  mfet ()srumum nt4apxoioeildfmDuanvp t0tlxoxrciodom rln s (0 rur(o3iy4lpe lfcslt arurur nu0aee  octadlm2eln onu0aeermr3iatlm r u s;s  rtoxmpnu1amt lfvt ( s2umumonu4tlt io3iasfm elu p;u0 rerif iy1lp raneo;t0 exrxr iy1ll emfvtas  rrm(mpot4apx if3tlslaDelnmsnu4artrxfcty1lmDelnes;s)trtoir3oydlltelnvi (fa2um(mont0tpxn ociysfa ul(vo u)trermr3iadoaDelnvs;(0 rxoirpnu4alee fvi s)srtmxro;o4alt mf3ildfaDrlumsnu4trtnir3todlmtr nes;s  etoim3io4openmfvtlt a2rm( p;o1openmietysfm rln p u)trxnxr3oy1lmD auei;t)t2toim3oudllte feiatf rrmx pnu1aee if3iysfa2ranmo;(0tlenifciodfa raues;(0trumir iy1ame lieslt artrxmo;u0tltn ieiytlm2um(vo;u0 eeomrcto1oat  uvils t2urxr3iu4altnmnesa( a2uaum ou1olxnifetlsls2rau on(0alerxf todlaDrlieo t s2xoir ny4altnlneslsfa2tru ono0aexo oeilsla rmumont4trtomf3oa1laDean s;s0trtrim3ny4altelfvs t)srurx ont4oet iictld sDuan p t)aexrmo oo1la elues ( trxmxo no4lpe mnviatf rtrxmp;u0tpt  f3iydfa2rl(mon(0tlxnmr3iydfa r ivs;(0t2toim oy4opt  fvi (f Dtaxmp;u1aex  fetyt sDrauvs;u)trxnif ootfm  lnvs;( teumio ny4ome mieils) rur( oou4opxomoeiltfs2rlnmpnu) rtoircoodla r nesls srxo(m3iy4lpeelieil(fs2rmumpot4tltnmfciyslm elnmont) exrmociytfm  liei;() rxmio ny1alenmivsl( s2ta(rpnt1opeo f3tatfm elnms;t) rtrmfciytlatraies;s) exoxmpiy1om nlfctl(  rtr( oou0tex  ocildfm umuvs;(0trxnio3iytfmt li ils trumim3oy1omenlivt ()aDtaxroou4altnmfcildla el( o;()tlxrxf oatfmt  iei t0 2xm(opiy4omtemfctlsfsrrr(rpot0ape miciytfm emu p;t) rtrxo3iatlpD  u ols  eumxr3iy1olee ietl(fa2um(mo;u1aet mieias m2umu p;()tltoxf tadoptelu o s0t2xm(m oo4ome mfvtas)srurxro;o0altomf3tldfsDel( pn(4arenir ty1oa ran o ()seuoir ny1lmt  nesasfsDtauro;t4teenif3ildls uln pn(0areomr3tytfp eauvo t0texmirpnudamtnlnci () Dur(root0opxniociysla2rlumsnu0aeenxrcoadlp eaivolt0setoimpoy1olenmnviat  2taump;u0olx  o3tat a um(ms;u)altrxfcia1lm e u ol(0teumiopio4lp n fes (fs2rru pno4ape  ieilslaDeau s t4treniociatlm eluvo;t0t2toir iy4lm  mietat sDururpou0aeto ictls a rl(mp (4teermrcty1fa elnvi t)trxrim iu1optelfeilt srrmx ooo0aptnmf3tatfm2eau p u0teenxf ta1omD  i i s t2umim3oodalt mncilt a2rru  nt1teto f3tlslaDul(vs u0tlxrmf3oatlm rauvi;t texm(mpoy4lpt lfvil( srrmxmp;t1oeeo ieiydlm2rmuvo (4 lenio3tytlptrau o;s  rxoir oy4omt mfviatf rrmump;o1aexo fcilt s ra(vsn(0trtrif3oodlmDeluei (  2xoim nu1ome mfei tfsrta(roou0texomi3iat aDraumon(4 etomr3oo1om rlueo;t0trxr(mpny4lmtelncs t arta(m ou4oeenmfctltfm2el( p (4 leoxf3oa1lpDe nvsls) rxoxr3iu4lme lncsas arrm( oot4apenmfeild m2elnms u0teermfctadfat  nei s  ruoir3iu4ameelnvi (faDur(rp;u0tpxnmoetytfaDra(mpn()tetrxo3iy1lmt ai ils)teurio3nydopt mnesatfsDtru ont0olto i3iad mDea(mo u4 exnirctotlp e ivs t) 2um(m no4olen nvi (fsDum(rp;u1alx iociasls2emn ont4texrxoctatlmt livi;(0trxrxm iy1lltelieia()aDraur no1tlxnioeiltfaDem(vsn(0 etrif3iodoaDean slt)t2umir3nudlmt  feslt aruaur ou4aeeo ocilt a rl(vo t4 reomrcoytom e neilt)truriopoy1ll n 
\ No newline at end of file
@@ -0,0 +1 @@
+nes s)srtmxr no4ole mieias)aDraxm ou0tlx mi3iytfa2uanvont0tleoioctytlmtelneo s) 2xmiopoo1omtnmncil(f rtau onu1apxoiictat a2rmn snu0teerif ootomD  uvs t srum(m3nodalenlnetas) Durum ;o4teeomfctys m2uan pnu0 rxnio oy1fpD ai s t0srtm(o iydopee feilt)aDumur oo0tpt  feiltfs2ra(msnu4alxrio oo1fp elies;(  2umio3ny4lltemfct () rtax pot4oee  ocilslaDrmnvo;t4tetomfcoy1om elu o t s2trim ou1ol nmfvi tfsDrm(ro;t0olx mieiltls2rln snt) rxrxf iodfatrai s;() 2umxo3no4ap emicsatf rrmxm ;o1olt moeiatfm2ra(vp u)tlenmrciodoa e nvilt)t2toim3iy4lmenmict t)sDtmu  nt4altnmieiytla2emumon()trtrmo3iotoaDrlues t  2urxo3iu1oltnmnvsl( aDrmurpou0altomoetyd s eauvp;()tleoxr3ty1lm rli sls0t2toir3no1ap e nei (faDumxrpnt1tee ifeiytlaDuluvs ()alxoxfcio1laDeaieo t s2umxr3iu4llte netat sDumu  ;o0oeenmf3tltlm2uau o t)alxrmf ty1fm  lu o;s) 2xm(o oudlmt lict s arur(rono1ope if3iasla2rl( s;u4tltoxr tatlpDelieol( srxoio3ny4ope  ncs (farumx pou1tpe io3ild s uanvpnu)teenmo3to1oaDelnvs;()setmim nu1ol e fvs t sDum(ro;u1ole if3ildfaDeauvs;u0alermr3tytfm e u i s  2xm(mpiu4lptnmnei t)arrmxm ;o4tpxo i3iasla emn s;u0arxrifcootla r n i;s0 2xr(mpoy4al e ivsls  rtmu o;t4ole mo3tyt m rlnvs (4arenmo iodlmDeln o;t0seurirpiodal  lnvt ( s2rmxroou4olt  fciysfa2um(vsn(4teeoifcoy1fm r ueo ()t2xrxopiudapt mfvt s a2raur nu1alxnifctytlaDem( s ()areomr3oodfpDelneol()setmirpoo1lm  livias s2tru o;t4oltoiiciaslm2ra( sn()altoifciodlm ranesls0 euoxr ou4llte icta()sDuru pnt1tpe  f3tysfm rauvo t0artrir oatomte ivi;s0tetrxo3nu4omt  neilsf Drm( oou0ope mictltfa2uln s u0aetrmf3tatfm e u s;()t2um(o nu1lptnmnciatfsDum(m oo4tlx iociatfmDemu on() renmf todlmt aiesls0 rxmxr iydopt mictlsfs2rax pno0tptomfeiadls2eln pnu)aexomf oa1opt  i o (  2urxm iudlpt  ivt (  rumx p;o4ape moeiydfs umums;u4teerio3tytoat  nvi;t teto(r ny4lm  mnet t) rraumpoo4olt  i3iysfmDuan snt0trxoxfctydlateaueil(0t2uo(r ou1amtn nvt tf Dta( onu1opx if3iad m2umnvo;t4tleomocoytfat aivsl(0truoxr io1lle mneil(fsrua(mpno4olx  fciysla rl(vonu0alxomr3iatlmDelnei;()t2xo(mpoudam nmfci s  rrmxronu0aexo oeiadlm rmnvs u0 lxnmrcoatlaDr n o;t0s2xo(mpnudol nmnct ()sDtrurono1tpxnmietaslsDrmnvo t)aeermfcoy1laD lnvo s0 2xoxr3iy1ame  fct t) rraxroot1teen oetad m elnvo (0arxnir tatfp  lieo;( texoxm3no1op elivi t aDra(rpoo0tpxnmoeiytfs ean o (4 eerxr oa1opD lu i;()teuoxopoy1lm e nvi () Dtm(rpot0tptn feilt s elnmp (0tlxrxo oydfate nvo;s)t2xoio3iu1llee nvs ( aDur( o;o4alxo ocias a2uau o;u)tltrxocty1fatran s ( t2xoiopoo4lm  livt ( a2urx  ot1ole  f3iad mDrau o;t4altnmfctodoa ranvsls sexrxm nydamen ivi tfsDtmxroou0tex iietlt s um( p t4arermr tydlat luvo t texoiopoo1oltemivi t aDurx oou1oeeoiieils sDumuvo;u4artoxo ty1fm eau i;t0 2xo(m nu1amen ncsltfs2umu ooo0aet mf3tyd s eau p;u4 rtnir3ty1fa r nvs () 2urir iu1omte fctatfa2rau pno1tpto ociyslsDel(ms t4alxrifcoo1optelneslt0t2um(m3ny4lltnmneia(f rtmu  no4tpxoifcias a ea( o;u0trenir oodoptranvsls0 rxm(r3oydomenmicsat  Dumu  ;o1tlt  ieiatfsDuaumont4 exnmociydfp rlies s sexm(m nu1al   nvtasfsrur(moou4alxnif3ias m uanmp (4alenmfctatop e i s;s)seurir oy1lp emivslt) 2tm(ronu4tleoio3iyslm ra(vo t0tltrxf3iy1om  lies ()srtr(r iodopee neta()sDum(mpnt4oltn ietys s um( snt0tlerxr3iy1laD  ivs;(0 2umir oodlm   fctlt  2ururo;t4tlen ictldfs rlnmpnt)aetoxr3totfpD lneilt)trxo(o3ny1lm emfvils)sDtrur ;t1aeto o3iltls2umu s;t4aexrif oatoatraivi;s) rur(opoy1amtnlivt t)aDrau  ;u0tptn feiat a2emn s;()trenif3totom r nei;t) 2to(r oy1ol nmfvsls)artrurpnu4tptoiociatla eanvo;u)arxoio3oodfaD  i ol( trxmir3nudopenmfviat s2umxrpoo0tetomieiatfaDumumo;(4alxrmr3io1latrlivo t0srtr(r oy1alenmfvt sfs2rr(rpnu4openmi3tydla emn p;t0aetniocoadla elivs ( trum(m3oy4lptemfetl(f rra(monu0oeto ieild s2rluvon()alenmo3iodom rlnei ( t2tr(m oudapee ieia()a2umxr oo0apxoiietatfaDul(mo (4alxrircio1laD  nvi;(0 2xoir3nudop  mnvtas)sDrrum ot0teen iciltfa2ran o;u4tleoxocoatfmDelnei;(0t2xoxr3oudom nmics sfaDuax pot0aeen ieiys m2rlnvo ()arenxr3ty1lpDe uvi t s2uoxmpny1lm   ieta(  2rrxmp;u0olt  oetysfaDulnvont4 rxnioctodlaDr ieo s)trxriopiu1ap  mnvslt) Dtm( poo4tetniieiasfa elu pnu)artnmf3oa1fmteaivi (  rtrxm3iy1ope  nctlt arrrx oot4aleo i3iatfs2rluvonu) eerir todfm eai o;(0t2uoxm iu4lp e ict t) 2uau  ot0oee mociltla2rmu pnt4teerio3tytfateaieil()tetrim3nydome mncs ( aDtm(mp;o1optnio3iad sDrln on(4 ltnmf3ia1fm  ln o t0srtr(r iu1apt lfcs ( arrmumpot0tpx moetasfm um( s;u0tlerxf iadfmDeluei;t t2xoxmpnydlptemivt () 2tru  ;o1olxoifctydlsDuaumonu4tleoxrcoatlmte i o;t0tetmimpiudlmt mneiatf rururo;o1ole ii3ilt aDua( sn(4artrmfcoa1om  livolt t2xr(o3oo1oltnmfci tfarrmxr ot4optnmieild s el(von() rtrio oadoat  n il(  rtoimpoudal nmfvtl() rua(  no1tpx mictld s em(vs (4texomf oydfa e i ilt0sexm(mpio1ope mietatf 2umumo;t1altniiciatfs um(vo t0altnifcoodfpDelivilt)setm(mpno4ol  mfet tf rum(m ;o4apxomoctltfa2rmumo () lxrmociydfat  ieilt0sexr(opny4amtnlivi (  rtr(r ;o4opx  octls mDul(msn(4 ltomo iydlaD  nvsls teurio iudll nmnetl(f rta(moot4opt  o3iyslm um(mo;t4altoxrctytfaD an i s srxr(opno1omenlfeil(fsDurx oou0tptniiciytfm elump t)aexrio3totlm rlues;s)s2urxrpiy1apen fesatfs2umxmo;u1alto i3ildfa ua(mpnu0altoxo iydomt an ils0srxm(o nudlp   fet sf Dumurpoo4aex  ieiltls2uan on(4alenmrciytlpD anvols0t2xoim3ou1ap elfctl(fsDurx  no1oleoio3ild m uaumpnu4trtrmfciatomteau olt0texoxo iy4omtelfesat) 2tm(rpoo1aeenii3ild mDuaumpnt4 rxnxo oodopte ivi ( trxrxr oo4ale lfcs () rtmxrpou0tlenmf3iat a2ranvp t)tlxnmr tytomtrluvs;t0s2xr(r io1lme mivia(  Dtauroot0apt iictaslm ulu p ()tlxnmf tadfm eai i;t)trtr(o3nudlltnmfvt tf rtax o;u4oeeo fciltfsDemumo;t0 ltnxo3oo1oaDran i;t  2xrio3oodaptnmies ()s2rmumpnu4olxn ieiyt s rmuvs;t)aeerxr ootfpD luvo ()setmxo3no4openmfct (fsrtm( poo0alen fciasfa2rmnvo;u) renxo tatopt lnesls) rxo(m nudoltemicil(fsrtaumpnu4texnio3iltfa2eluvs;u)aeerxo3totoat  n i;t)teto(o oodalt lncs ( aDtrx pno4ope  ietysla rmnmo t4alenmr iadopDelu s;s) euoim nydome livils)s2uaur nu1alx  i3ilt mDulnvpn(4areoir3oo1omtraueo s t2to(rpnu1am nlfctl( a2rm(mp;o4texn feilt sDua(vs;()aexoxr3to1lmtrai o;s srtoxr nudalt lnvi sf Drm(mo;o0tltn i3tltfaDemumsnu4 lenxfcty1oa eanvs s) rtr(rpnu1lpte fvs (fs2rau pnu4tetn feias a2emn s t0altoxoctotfaDrlnei;t) 2umio3ou1lmt  ncs t  rumumpoo1teeniietyslaDuanvs t)areoxocoatfp   i i ( s2toim3nydlptemfeslt)aDumum ;t1tetomfetas sDrl(mp;(4 exomo3ia1fpDe u i;t  rxoxr nudamtnmieslt  rrmxm ;o1texomi3iad s ran s (0artomoctydfaDeau sl(0 euo(opoy4aptnmnvs s sDtaur ot1olxo i3iysfsDean pnu) eeoxo3tatfaDraivs;s) eumir3iy1ome mics (  rrr(m ;u4alto ociat a2ul(mo;t) lxoxfcia1fpt luvo t)sruo(o3oo1om  lnvt s)sruaxr ou4tpe  ietltlm2eau s u0 eenmo3iodlat  i o;t  2uoxr3iy4lleelici sfaDra(mpno1tpen f3iatfa2ulump;t0tlxoxr3oo1fmDrauvi;(0trxoir ny1op  mfetls)sDururp;t1tee  feildlm emn onu4areomfctatfp e ivs;(0sexmim3no1ll elivtl( srumur nu0texo fciysfsDulnmpnt0 lenmf oatfmtraieo (0truoxm3nydlpt lneils)srum(mp;u4tle  ocils mDea( ont0arxnif3oy1oat li o (  eumxo3iy1optelfctas sDra(moou1opxnif3iydlaDrl(mp;(0artrxr tydfmtr ivo s srxr(r iudlle mies s)s2rm( oot4oltomo3ils s eau p;t0treoxf oo1lmt ai olt)tetoiopio4llte feia(fsrrmxmoot1oltomociltlsDul(ms;(0teeoxr ta1om  anei;s0setr(o no1ap n fetl( a2tau o;t1olto o3iys m2rl(msnu4 ltnxf iatfm eaivo t0trto(r nudll  lnvsls)aDua(m ;o4apx mieiatla2rln snt0arenio3oytop rauvo ( srxr(opoo4olenlnvil( srtrurooo1oexnmf3ias aDea(mont0 eenio tytomD anes;t t2umimpny1lltemncs s)aruau ont1tlx mfcilt a ulu p;t)texrmf oadfateanvo s  rtrir3ou1lltn ieia(f Dua( p;t1olt  feiysls elnms;(4 rxoxf oydfa r u i s)seumxmpoydop  lfvs t s2rmxmoou4aleo ocilt m2ul(mp t4texnmo3ootomDr u sl()t2urio3nu4ll   fcia(faDrmxmp;t4apto f3ils mDua(mp t4texomf ta1fptelu ils0 rxrxm3no4lptnmfctlt sDrmu  oo1tpx mfeildfm uauvp;u0trxrir oodlaD li o t) 2uoxmpiy1om  miet (f 2uax  ou0oex mfeilslaDrl(mp;t4 etnif ootfp eaneo s0trxrir nu4ope miesltf Dum(rp;u4olen ocias s2ea(vo u4altrxo3oytlm raivsl() euo(o nydlm   neta(  rra(monu0optoioeiyt s ra(vo;u) leomf oa1fpDeluvs s0 rumim3oo4olt lieslt) 2taxrp;t1altoifetytfa2emuvp;t) rtrmr oytfm ran ols0 2urim io4lm   neils)sDrr(mo;u4tlt  oeiyd a2rlumpn(4tetoxo3oadom rluvo;(0s2tmio3iydapeemneta( sDrrx  ou4oltn icildls2ra(mont0altrir tatoat ai o t) rtmxr iu1aptn fet tf Dta(moou1tetoiietadlm2elumo;u0areoio3iy1opD  uei;t s2urxo3iodal nlnesa(fartaxm ou4alt ifciasfm uan onu)alxrmrcoy1fm r u slt0teurimpiudlltemictat a2tmu pnu1aexnmoetatls ulump u0alerioctadop r uvslt) euo(mpoydap  mivi ()sruaumonu1oexomiciad a2eln s t)aeeoir oadopDelies;(0trxr(rpou4ol e fvsas sDuau p;t0opeoiiciaslaDeau s;u4tltnxfciadlat  n i s0sexoim nudameelicias)arra(rpot0tlx mfcias mDul(mo;(4aleriocio1oaDr ieils0t2uo(rpnodapeemfet s)a2uau o;u4olx  oeiad m2eaump (4tlerio3iytlmtr u i;(0 rur(o3nu1ameelnetlt) 2rmur no1aetn feias s el(mo;(0trtnmr3oytfp  lieo;s  2xrim oodll nlfvtatfsDtmu pou4aptnmociysfmDelnmo () exrif iadomtr neo;t trxmxm3ou4ome  fvi ( arrmx ooo1tpx  oetasfsDea( o (0trtrmo3iotomtr u o t0s2xmxo nydam emiet tfsDumxmpoo1oetnmfeiltfmDranmp;()tleoif iy1om  aues;t sexoir3iydoltnmfesltf rrr(rpou0aex  feildlm rmuvsnu4altnmf ta1fmteli ils srxmxr nudamt mfei tfsrumxr no1alxoif3iltfsDem(mo;()arxrio3oa1fmDelu i;s0 exoim nydap elivsls  2uru  ;t1aptnifeiyd s ra( p;u4texomrcio1lmDrlivi s0srtrxrpoo1om e ncta(  rtru oot1tlxo octydla emuvsn()texrir3todomteluei;s0trurirpou4lmtemicsa()s2umx pnt0olenmf3tysls umuvp u0 exoxf3oatfmDe ueilt  2uoiopnudlmeemfviltf 2tm(r no1teeomoetlslaDeauvonu)arxrirciytoptelnvils)srtr(m nu1ap nlncilt)srum(r ;u1olenifeiltfm um(monu)tlxnmrctadlmDrlu ils)setoio3iu4opte icsat) Dta(m ot1tpeniociydfs2uau s;u4tetnmo iy1fpDe nei s0 2xmxo iodopte iesl( sDrmumono4opt  ictls s2elnmp (4aexoxr3tydopD  nvo;s trumirpno4lp elivsls  2rr(ro;u0tltoioctytfsDea( pnt0 ltomo3iadomD aues;( trxmxr3iy4ape  netlsf 2urxmo;o4apto oeiydlaDrmn sn(0trtnxo3oydlp eai i s sruoiopio4ome mnvtlsfs2uauro;u4tlt iicildfs em(monu4 rtriocia1oaDe iei;t) 2xmxm oy1al nlnvs (  rtmxm ;o0altn feiys s2uaumsnu0artrxrctadlpDeluvs s0seuo(m3io1opt lictatfsrtrxmpot4tpxo oeilt a ulnvs;u) lxnmr todop e ueolt0seur(opio1lmt mies s sDta(m ;t0aee mfetldlm ran o t0tltoifcta1lp elivils)tetm(mpiodap emieiltfaDtaxro;u0apt ioeilsfs2elnmsnu4 etomoctatlm elueolt)trtmxm3ou1lmeemieiat srtr(mpot4teeomo3tltls rmn o;u) rxoxo3to1laD  nvo;t trxr(r iodapeelfvia() Dtmxro;o1ale micilsfaDumums;(0 leoxfcio1lmDeluvol()trtoim3nodlme mivsa()s2urxrpoo4olx iietysfsDelnvonu4 rermf3tadoptraneslt0t2um(r3oo1lmee icta() rrru  no0opt  octat s2rln p t4 rtnxfciatlaD livo ()sexm(r oo4olenlivsl(fsDtmu ono1tpt mocils a ulnvo;t4 lerxrciotoa  ai o s) etr(r oudam  mfvsas  2rrx pou1oexoifeild aDrmnmo u0tltnio3oydlpD lnvs;s)srxoio3iudop e nctl()aDrru  nu1alxoifcilsla2el(vs;()teeoirciodlatrlneolt s2tmirpnu4alte fviat) 2um(mono1tex mf3ilslaDrluvs t0teermfcoydlp rlivsls0t2to(opno4altn ieia(  2tmxr ;o0ope mictldlmDuau snu) lerxocoo1fm rai i;( s2trirpnodamt mnciasf rra(  ;u1alxoiicilsfa rm(vpnt4 eenifciadoaDr ueo ()s2xr(opnudomt mfviatfsrumxrpot4texoif3tad mDuau p t0 rxomr iydop eaueo;t)srtm(o iy4olte ietlt arumu  ou0tpx ifciydls2umu s u0 exnxo oatfatr ueo;()s2um(m3oy1ol   ivsa( s2raxr nu1tetnmfetys m2rmuvp;u)aexomf oa1opt lnvsl() rtmim nydllt mfeiat arrrx poo1oetnio3iytlmDua(mpn(4alenio ta1omt li i t trtrxrpio4ll n fvslsfsDuau ooo4apto o3ild s el(ms;t0altnxo3oadlp  aivs (0sexoio oo1ap nmfei ( sDumxro;u4oltnifetls m2rluvonu)tltoxf todoatelies s sruo(m3io1ll  mncsas)arrau p;u0oet iietysls2eau pnt0aexnir to1op  lu s;()seumxopiudomeelnesls  Dta(m ;o0olx iiciltfmDemnvs;t0alenif io1laDrli i;()trur(o3oudam   nvt s s2raumpnt4alx mfciatls2rm(vs t0trtrmf tatlmDr ivs (0srurio3oydopt lfcs ( artm( pou4aeeniieildlmDel(vpnu0 etnmr3ia1laDeanvo (0srtm(r oodlptn neslsf Dumumoou0olx mi3iytfm2rm( p;u4altrxr todomt an slt)trxo(o nu4lptelietas srtaur ;u4opeomieils a eanvsnu) rxnmfctadopDean s (0setr(m3iudamtnmfetas s2urx pou4teeomociltlm elnmpnt4trxrmr3tadoaD  uvi;(0trtrim3nydlpt liesl( aDta(rp;t0aee  feiyt sDrluvo u0 rxomfciadla   nvsls) euo(m iu4omt  nvtatfsrrm(rp;t0tlxn i3iydlm2rmump u)alxnifctotfm elivi;t0trur(rpno4opte nvs s)artrxm ou4alen f3iatla ulnmp;t) lxnmf3oadfaD  ivo;(0t2toim3nydal nmici () 2taum ;o4ale  fetasfm2elums t)tleomf oy1lp e nvs ()trurxm3ny1amtemnvsasfsDtrurooo0tpxnio3iad m2rm(mont)artoxr3oydfmt lu o;t0trxo(o oo1ol emies s)aDuaur ;o0tlxo feiasfm2rmumpn()arxnmo ia1lat aivo;t t2urirpny4am n fvils  rrrx pot0opxnio3tydfs um(mp;u)alxoiociotfp  anes;s)t2xr(o oudoltelfci t artm(r nu4oltomictasfm2uau p;(0altrio to1omteanvils0texoiopou1lmee fctls)s2tmu oou0oeeoio3tlt m2uaumo;u)tltnircio1fptr ieolt  euoxm ny1omeemnvt t)a2taurpno0apeomictatfm2umu s (0alerxf oadoa eln o t0setrirpou1lmt mnesls a2ta(ronu1olxo o3iydfaDum(vo (4tetomf3ia1fpDe ivi ( tetm(mpou1om  mnctlt) Drru pou4tleomf3ildfm umnvonu0tltoxo3oa1fmt  ivs (0seurimpiudlp  micsl(fsrum(  ;o1ope  feilsfs2uauvonu)alxoiocoydfatelivol(0 2urimpno1apeelici s)a2tr(  nu1tpxnif3tys s2eanvsn(4texrxociatomDr ies;t0trumxm3iy1omt  fvils srurx o;t0aexo ietat s ra( pn(0arenio3ta1fpteli sl()tetoxm3nudlp elieil(f Duaxrooo1aptnmieiys a umumo t) lerif todopt  neo;t  rxo(opiydlp  lneiat s2rrxro;t4olx  ieilsls2uanvo;t4arerio io1fmDeaivslt0t2urim iy1olt  fcslt sDtrumo;o0alenmfeiys sDumn p;()artoirciydoat auvslt trtoxo oo4amtnlncs t) Dtru p;o4oexn oetas a umnmo (0teenxrciadlpD  i i s)s2urxr3nu4lme mfeslt  Dtaur oo1aexoio3iytlaDul( s t4arerxo3ta1lmD lu ils0truoio3oo1ll n fesa(f Dum(mpnu1tpeoiieilt s ea(mp u0 lxrif iydlaD livilt) exrxr io4om n ivsa(  Dtmxmono1tpeomietld m uluvp ()alerirciy1fpt an s t setrio iy4apeemivsl() 2trxmoot1alxo f3ildla eaumsnt0alxnioctytlmtranei;(  2xo(mpou1ome mnvilsf rrm(rpoo1tetomi3tld a2eanms u0aleoxo tatfmD au o s)srtoxm3oy4olte fcilt)a2ua(m nt4teen ociasfaDul( o;t)tltomoctydomtrlu ols0srxoxm oydap nlnvsltf 2rru o;o1opt  o3tydfs2em( s u4teeoir oo1op rluvo t)trum(o ny1lptn fvsas) Dumur oo0aet iieildfm el( pnu0tlxrir ia1latraneils0tetoir3iu4lpte fctatfsDumxrpnu1tetnmfctltfm2em( ont)treoir3oydomtrln ol()s2ur(o nodop e ivia() rtm(rp;u4aptnmicias s2ua( s;u0tlenmrcootla e uvs;(0setoir iy4al  lnvt ( aDuau p;t1tex ioeiysfm umnmp (0teerxo3tytom   ivo s0s2um(o oy1ll elfcs ()sDtruro;t0oeenii3ias aDemnvo;t0aetriociydlmtelieslt0seum(opoydaptn ivi s) rrrxm ;o4apen fctadls2uau p;u0teenmfcoytom r n i t s2xmir3io1lltnmnvtatfarrmxm ou1apxoif3tadla emump;(0treoxfcoa1fpteaneils  2uo(m iu1lptelicslsfsDurx ono1opxnif3ilsla2ean onu) reomr3oy1oa rlu i t texm(rpio1ole lnes ( aDtmxmp;o0tpx micilt a2rlu p u)trenxo iatom  anvils texo(m oydope  nctat) Dumxr ;u1tlxomfeiadfaDra( on(0treomoctadfpteau s s  2ur(rpiy4lpe livslt  rurump;o0ole ioeilt m elu o;u4 ltoxo io1opD  u sl( s2uoir oy4lmtemietat)sDtrxro;t0tpxnmocild m uanmsnu4altnircoa1omtr uvo;s teumxo no1ap emfvias)aDrmx ono4oetnmiciytlaDuln pnu4alxrxfciytfmD  ies s s2tr(o no4olenmncils) rumurono1oleomo3iytlmDulumpnt4aetrxr3iodfatrli i ()srxmxm3no4lltn fcs t srrr(  ou4tle mieild m2ea( s u4 exnmf oytfmD luei s s2um(o iydomt lnci () rtrxrooo4oeenii3tatla2rluvp;()aeerio3oadfpteai i;( srtrxmpny1ale mnei sf Drrx ono4tpeoiiciasfs rmuvs u4tlerifctatoatrln il(0 rxrxo oy1ape  nct ()s2truro;u0oetn fciat s uau pnu) lxoif3tatlpDelivo;()texrxm nydopeemiesat arrmxr no4teeoioctadfm rlumonu)alxrifctotfmDelnes;s) eum(o oo1apen fctlsfsrrmumono0oexoioctlt s2uluvsn()alxnxf iodfm  auvslt)teumxrpny1apeemnci (f 2raxr ;t4oeeo icilsfa raump;t) ltrmf tytop   ivs t0 rumxm3nu4optnmfet (f rumx poo1apenifeiltls el( pnt4texnir tytoat  nvolt0teurxm3oy4lpenmncslt) Drrx o;u1altoioeiyd a2rau snu0texrmfcoy1lptrli il(0teumxo3oo1ol e ivtlt)s2taumooo4alxomictydls2um(vsn(4 rxoifcty1lm  ai s s) eumimpou1omenlfetl()artmu p;t1tex iieilslaDumnmo;t4 etrxf iotfatrlnvilt) rtm(o3no4apte fvia(  rrau p;o0opx  fcias m eanvs;(4artrmo tatla ean s;s0 eum(opoy1optnmfvsls)a2tmx pot4aptomf3iyslm umums;t0 reomrctydfmtraneols0 ruoiopoydlmen neslsfsrtmxmpnu4opxoii3ilsla ua(mpnu4 rerxf3to1oa eaieil(0teum(m3iu4al elnet tfs2uru o;t1oeenmo3iadfmDeaumpnu4tltnif3todlpD ai s;s0seurim3ny1optnlnctas arraumo;u0aeto f3tlsfm rlu s;(0 rtnifcty1lp eli ils)srxoir nudlm  lfei s s2taxm no0apeoii3iyd s ranmp t)tetrmf3tatoa   n s;t0 rumirpiu1olt  ivsltfsrumum oo1apeomieiad s uluvp u) ltnir tatoaDran s;t srumim iy1lm nmfct (f 2raxr ot0tpt  fctad a2eaums u) renxf3iadlaD an s;(  exr(m oudop e ncslt srrrum ;o1tptoifciasfsDumnvo;t0tltrxr3io1lmD lu i;t0s2uoxopnydopte fvt s a2taxr oo1teeomi3tlsls2umuvs;u0aeermocto1om r uvils trxr(r3io1lptelnct (fartmx  ;u1alto icildfa2em(mo t0arxnio iatlmDr n o;t srto(mpiydapt  ivtlsf Dumum nu0texnmf3iat aDum( p;u4tetnir3tytomteaiei;s) 2um(o3iy4omt  ics ()sDurxmpnt1oee mfctys mDuanvon()areoif to1la e nesls srtmimpiy1llenlfciltfsrra(mpno0tlt ifciyt aDum(vs u4alenmf3oodopDr nvi;s  2umio3ny1ap   fvtlt) 2trxmo;t4texnmi3iat s2umumo t)teeoxr oytfmtrluvo;s)s2trio oy4alenlnvsl() rua( oou1tlen octlt m emuvs u4tlxriocoadfp eaieo;t  eurirpiu1omt lfvt s)sDrmxmont4opeo f3ild m ua(ms (0 rxnxocta1fm eauei;(  2xmxr3nu1om e fvt s a2rrurp;u1texnmociatls rln pnu4treoircty1lmD  uvols0trxmxo nu1om  liet tf 2rmxro;u4opx iicildfaDrm(mp u)tlerir to1la   ueo;t)s2trim iy4ale  ies t sDra(mpoo4alxo oetytlaDea( p;t4 rtoio iadlp  lies t0 2xmir3nydale mncsa(fa2ua(mpnu0oltn feiad a2ul( o u0 rxnif oatoptelu sl(0 2uoir3nu4ole mfetls aDtmx oot1altomo3tadfs2umn s (0alxnif ootfptean sls srtoim ny4al n neil()arrax pnu4tltn o3iasfmDra(vp;u)trtnxocoytlm  lu s;( trurxr nu4ope lnviat) 2rmxr nu0optomf3iat s2rln p u0 leoxociy1fm eanvs t)t2xoim iydlmtn ici s  2rmu  ou1tptnmicilsfa ua( s u)texrxr3iotfpt lneo;s s2tmirpio4amenlneslsf Drm(mo;u4ole mi3iasfsDrm(ms;()tltnio oodfptrlneo;s0seumxo3ou1lptelnet tf rrr(r oo1tlt  f3tlsla uanvs;t0 eeomfcty1fptelnesl(0teto(o ny4omtemfeils)arur(mpnt0tptnmf3tldfaDumu p u)tltnxrcta1fpte nes;() rumim nu4lltnliciltfarrmx pno4tpeo oetatfm ean o;t) renio3to1faDeln o;s)s2uo(o3iu4ol e ivsasf 2rax p;t1oltniocild aDrm( p t)areoxf3tadop  li o (0 rurimpiy4lmen fvias) rtr( oot4olxnmo3tltfs2emnmo t) renircoatfm rln o;s) etrxo3iydam  lieia( sDrrxrpou0oleniictytla elums;t0 rtrmo3iotfmDrlneo;t0trxoir3no4lltn ici t arum(ro;u4oeenmi3tld m rmuvo;t0alermf iodoa e uvo t) rxrim ou4lltelfes t)arurxmono0apxniieiltfa2rmu p u4aexnxrctadopDrauvols)trtoxr3iy1llt miesa( srrrumpnu4tlto oeildlmDelnms (0 exrxfcootlaDranvi t0 etoiopno1ol eliesltfsDum( pnt0tlen o3ildlaDrl(ms () renxf3ootfm elneolt srxrxm3iy4om nmncs t) 2trurp;u1aex  f3tlsls rl(vs (0 lermr3iadfm  liei;t0srtm(r3oo4amtnlicsltfaDtr(m nt1tle ifcils s2ul(vp t0trtrxr ty1om e ues () rur(m3oodll nlnvil(faDuaxro;u0oeeomfeiltlsDraumon() rtniocto1lmt lnvols tetr(o3iodam nmiei sfaDurxrooo4tlt if3iytlaDelu o () rerxo3oatlaDelieil()tetr(m no4alt mnet tf Dumur nt4tlt ii3iltla rln p;(4trenmr todlpD  neo;t0 etoxo oydalt lfeil(fsruaxroot4tpe  feiltfa2rmn o (4altrircoa1fmtrlivs (0trxm(o3nudol e ict ( a2uaumonu4oexomi3iys m umumonu0 lxnmociadlmtran s;()sruoio io1openmnci ()a2ra(r oo4opxoif3iydfm el(mp;u0 lxrxf3todoptelivsl(  exo(o3ny1op  lietlsf 2taxrooo4aeeomietadlm2um(vo;(4 exrmo3iadop  au il(0seuoxopio4lleelfvt t)a2umxrpoo0opxo feildla em( o;t)trxrxf iytom eanvo;s)setoxmpou4ope lfvtls s2tm(ro;o1openmf3tatls el( pn(0aleomf totfm e n i s0s2to(opnydomtnlfeiltfaDtr( p;t1tetoifeils s2emumonu0 etrxo3iatomt  u s ()srxo(m3no1amtnmietatf Drau  nt0aex  o3ils m2ul(ms;(0tetrmociatfmDrauvs;(0 eumxopoudaptemnesas)artaxr nu1texnmfeils sDrlump t) rxniocoatoaDrlieil(0 exm(mpnodalenmfctasf rtmu pnt1opt mieiaslm emuvo t)trenxociytomteluvs s t2xm(r3nu4amtnlfvsl()arta(mono1tpxn oeiytls2eln s (0alxomo3oytomtrauvolt setmxmpnu1ol  lncia(f ruaur ;t4tlxnmfetytfaDemuvs (4texoif3oy1lmt  ivols)t2um(mpoydomt  nct (  rtrxroou4ale iociltla2rmumsn(0tlxoio3oydop   ies;s0teurxopou4amtnliviltfaDrrxmpno1olx  fciys m2ulnvo;(4arenmfcoytfa ran o;(0seuoio3oudamt licil(f rrrxrpnu4tlx mi3iat a raums;u4 ltnmf tatfa  an il( seumir3nu4omtnmivs t)sDrru ont4oltoioeilsla elu snt)trtomfcoydomDr uvo;(0trxoxrpoodap elnvta(faDra(  ;t0opxo fetad a ua(mo t4aeerir to1lptr ivs;(0s2trxm oo1lmte fcs sfa2ra(  ;t1aexo ictytfaDelnmpn(0tltrmr3tydoa r ueolt)srxr(m3nu4amen fvias a2tmxrpnu4tlx  ietyd sDrmu on(0aexnircoytop rauei ()sruoir3iodol  licil()srtr(m no4aleo i3tyt s um(mp;(4tetomfciadlpDrluvol(0 etoio nudamte ivias)s2trum nt0tlx if3tytfmDeln pnu) lermf oatlm   nvolt trxrxo3oo4om nlivtl( artax  ;t1opeomi3iytfaDul(von(0altrirctydfp r neo () rur(o3io1lm  micias) 2rau p;u4tpxnmietyd m umu o;()arxrxr3tatlaDe nvi;s0 2uoiopio1lm   feta() Drm(rp;t0oeeo feiadlm2emu on(0altrxf iotopte nesls sexm(r3nudlp emics ( aruru pou0oeenifciat sDeau onu) eenio3oytlate n ol() rtr(mpoy4lle  fvt t) 2trx o;o4openiiciat aDea(vont)areomf3ootlate nvi (0s2xoxo iydlmeelnciltfsrtm(rpnt4oltnifeilsla2rmnvs t4treoifcoatop e ueolt) 2uo(r oudlptn icsas)a2raurp;u1ole io3iyd m2uluvp;u)aeeoxrctadopD  nvils t2uo(o3nudop e feia() Drrxr ;u1tptn octysfs2rm(vsnu0tetrio3tatla elu s;t0 ruoxopiudlpe liesls aDtmum ot4alto i3iltlm umnmpnu)teeoxo totfa   i s;s)t2tmxrpou1lle livs (fsDtau ont0tet ifeilt mDelu pnt4teerir3totlpD  uesls0s2toxo iu4lmee feta(faDra(m nt4tlt  oeiltlaDul( p (4 lxnio3oatfptranei s texoxopoodaltnmnetas) Dra(m ot1opt ifeias s2rmnmp;u)tlxrifcoydfp e n s s t2xmiopiydllte fct t) Dumx oot4teenmieiadla2emu s;t4aetrxr3ootlp   n il(0setoio nu1al  lies (  rta(mpnt4aeeoii3ildlmDul(mp;(0 lxniocta1lmt anvs;t0 2tm(o3nodam   nviat)srua(monu0aexoifeiatls2ra(monu0aeeomrcoy1oaDr u slt)t2trxo3iu1aptnlivsat) 2rau  ou4olenmfctydla2rluvo t0 rtrxfciytom e nvils0 etm(m io1am  lfesa(  2raxmpoo1altomf3iat mDemump;t4 rtrxocia1fpDrluvi;t setrirpno1alt mnciat artm(mp;o4tpx mi3iytlm ean o (0tlxnxf3ty1op r uvs;t)t2xoxm iu1amenlnesas aDrauro;o1tex ifciasla2ranvs () rtrxr3todlpDeln s;t truoxr3oydlm n ieiatf 2umu ono1oexo oeildfs rlnvo t4tltnio3ty1laDeli ol(0 etmim io1lp  mict tf Dtaumo;u0apen ietyd a uaump t4aexnif3tatfmDrai i ( s2uoim iydaptemnet t) 2uaurpno4texnmocias sDulnmpn(0 rtoio3ia1lm   nvil()t2xrim3iu4olen fvilt  rrrum nu4olxoiictytla ul(mpnt)aetrif iotfmteluei ( srumxmpnydlmt lfesltf Drru  ;t4texoifctat a rmnvp;t0 rxomoctotomtelnes t) 2xo(o io1am nlivs ()srtru pnt4aeen ietydls2ul(vs;t)teeriocto1om e nvi (0t2to(r3oo4al nlfcsls s2truront0aleo f3iadfsDrmn o t4areomf3to1fatrlies;()trto(r ny4lm nmnesat s2taurpnt4alxnif3tydfaDuau onu4areoxfciadomD  ieilt s2uoxr3oy4lm   ies s a2tmxm no0oex ifctydfs umn ont4alxnxr3totfa rlnvi;( t2umxrpiodlmtnmneil(fs2rm(rp;o0ale iiciys mDeaumon(0artnxo3ta1lpDr ieo (0seuoiopou4omt mnvil()aDta(roou4tleomocildls2elnmp (4tltnmf iotlm  lues;() ruoxo io1lp  mivs t  Dua(rpno1tptniiciytlsDemu o;t0alenir3tadlaDranei;( srtmiopiy4lptnmnvs () 2umxm oo4teenmictys mDrlu onu0aeenif3oytfaDr i sls0t2xmxo no4alt lfviasf 2uaxmooo0apxomoctatfs ua(vpn(4artrxf iatlpt lneo;s0srxm(o ou4lmt  ieta()aDtrum ;o0opxoifeild a el(vo u)trxnmr3todlaDrau o;(0t2xr(m iy1ale mfeslt sDtax pno1oee  iciyd s ranmpn(4 etrmf3iy1lat  neolt) exoxopoy1oleelnct tfs2taurono1olx miciyt mDum(msn()tltnmr ty1latr n i s tetrxopiy1om emics ()sruaumooo4ole  f3tyt s2eauvo t4arerxo3iodlmD ai i (0 rxoxr iy4apeemictltfartm( ooo1oexoiociys s raums;t) rerircto1laDean o;(0sruoim3oo4ole  feta()sDtrumpot0aexomiciasls uluvsnu0 rerio oo1opD luvils texmxm3oo1olt lictl()aDtau p;o1altnmfeiad m rln s;(0aeeoxf3ta1fateauvo s) ruoxr iodlle mfvtls a2rr(rpnu4tpeomocias mDumuvp u) lerio3oo1optrauvsl(0tetr(m oydaltn net (f 2rr(mp;u0apx ifeiatfaDuanvs () ltomf3tadfa eluvo;t0tetoio3iudol emneil(  2rmumoou0opxo feiysfm umu s;t4 etnxrcoa1lat auvs;t0trtm(mpiu4llt mict sf rumurooo1aptn f3tyt sDumnvon()aetrmr iytlmDrliesl()texrxo nu1ope livt (  2ra(m ;o0tptnmi3ias s2ua( o;t)altoxr iydomt lu ols0 2xmxo3nodlptemnvsls artmumont4oeen ictlsfmDulu pnt)trxoif3ta1latr i ols  2umiopoydlm  lfciatfs2um( pno1tptoiietys s2elnmsnu) rxrmo oadopt aieols0trtmxr3oy1al e fetl()s2rrxmooo1aleo o3iatfs ua( o;t0teermocoatlp rln s;t) eumxm oy4aleemivs sf Draxrp;u4tptoiictatfm2umnmpnu0 rxomocia1lmtrliei t0t2tm(m3iu1lmt  nei () Dtaxro;t4optoiicilslmDranvp;() lerir3to1lp ranvs t) eumxmpoy4ole mivia(  2rm(m no1tlxoioeiydls umnmp (0artomr3oa1laDraivs s  exmio3nodlmenlfcil(fsrraumpnu0alx mfctydfaDrlnvs t4texrir3todlatelivslt)srum(m3nu1om nliet s  Dtax o;u4oexn fetltla2rm(mo () ltoxo iy1faDr ueolt texmir nudamt lfcsltfa2trumpno4tlto i3iys a emumo;u) lxomf totop r ivo t seurir3ny1alte fvs ()a2rrxm ou4olenmfetlsla rmu s;u)alenir oydfa eln s ()srtrim3oy4apee nct (  Durx  nu0tpe  icils s ran p;()texoxr3iodfat  u i;() etrirpou4lmt mics s s2um(mo;u1oet ifcias mDuln snu0aleomf3iytlaD aues;s t2ur(o3nu1ap elfvsl( srrax onu1ope  oeiydfm rau ont4trermociydlpD lieil() euoxmpoydlptnmict sf 2uaxr nt0tleomiciys m uan p () eenir io1omt lnvols0s2xo(m iudlm  lfvs tfsDtm(ro;u1tpxoii3tat sDem(mo t0aetnio3oadfatrlnvol()seto(m ou1llenlncta() Dur(  nt1texn ietlsfaDeluvp;t0 exrir3iadla eaues s)seurxopiy4ap nlnvs s s2umxrpnu0aetnifeiadla rluvp u4 rtoir3tadlpDe u s;s s2xmxo3iodap emnet s)s2rmu  ot4tet  octad s ra( p;t0tlxoxr ty1om  lneilt)sexr(m no1lme  nctls)srtru pno4tex ii3tyd aDranmp;u4tltoif3oytop r nvils)trxm(mpnudomeelivt tfsrraur nt0apeo iciatfm el(ms;t)tltrxrcta1opt  ieo ( sexoio oo1oltn iesas  rtmur nt1oetomietatla rm( p u0tlxoircoytfp elivslt)trxrxo ou1lpee ivslt)aDrmx oou1oltoii3iydfmDeaump (4aleoxrctotlp  luei;(0 rurxo ny4al n neiltfa2raump;o0aeeomoetaslm2el( s;u0 etrmfciydlmDran ol(0 exoir3iy4omtelfet sfarrmxmp;o4tpeo o3iys m emump t)altrmr3tatoaDeln o;t0srum(m nydom nliesls)aDtmu poo1alxomictltls2ran p;u0artnmr3iy1fpDelu il() ruoxr3io4lp   fvtls  2ua(m ;o1tltniieiltfa2rln s;t0 rxoirciy1fateai ols)srtrxrpny4lmtemietl(fa2uaum ou4apxn feiltlmDean o;(4aexnir3iotlmte ueil(0tetmimpou1om  mfvtlt)aDumu  ;u4ole  f3iasfa ranmpnu4arenxf iodfpteliei;s0 2ur(r no1alen fetas  rur(m ;t4oee ioeiatfa ul( snu0 lenio3tytom rli ils) euoio ou4llt lfctlsfsDtmxroot4tlt mictltfs2ra( o;t0arxnxfcoa1opDrlieslt0tetoiopny4amenlfcslt srra(r ;o0olt ioetlsfsDrmnmp;t0aeermo oo1lat  nvi;t)truo(r oo1lp  mncsl(  2uau o;u1tex  fciyd s emnvo;u) lermr3oa1lmD lues ()srto(m3iodllt  fcils) Dtr( poo1alxo ociytfm emuvp;t0 etnxo iotlptraies s setoxrpiy4amtn fviat  Drrumoot0alx ioeildlm eauvont0 leomr oytoptr ivs;( t2xrxr oo1op nmnes t)sDur(  ot4texn i3iat s2ea(vp;t0arenio3iatoatrluei ( srtmir3io1lpen ncias)s2tru p;u4oetn ictys mDuan o (0alxoxocoodfpt aivo ()trurxr3iodopt mnci t) Dur(monu4teeniietysfm rlnvont4arenio3oa1laD lu ol(0seumxmpoydamen ncsls a2rax o;t4ope ioeiatfs2eanmont4 ltnmf oy1oate i i;(0seurim oydll   ieia( aDumxm no0tetn ietatfs2rmuvs;(0teenifcto1lptelueo;s)t2uo(r3iodom  mfctlsfsDtm(m ;o1oexn o3tydfa2umnvp;(4arxnmrcty1lm  au ilt  eto(rpoy4alee nes tfa2tr(r ou0optniieiys s rmums;(4 rxoir to1lp  luvo ()srxrxrpiy1ap  miet ( sDra(moou0tlenif3tatls rauvont4 lxnmr3iadomD  neils) 2to(r oy1lp n ietat)a2trxmpou0tpt  o3tatls2ranmsnu)tleriociadfaDrliei s)t2umxm oydop   nvi ( aDrr(mp;u4opx ifetysfm rl( s;u)treoirctydopDeaies ()trumiopny4ale  nei sfs2tau p;t1tlt ioctldfs2eanvo;u0 lxomf3iotlpt  uesls truoxr oy4ol nlncs (faDrmxm ;o0oex  oetlsfs umn sn(4texoiocoodom r i ils t2xo(opno1op nlfvtl( aDua(rpnu1oexnmf3iasfm um(mpn(4arenmr3ootla eanvsl(  rxoir3oo1om nmfetl( sDur(mpnu0tpxnifctad sDrm(vs u4tleoifciy1omDeaieo (0 rxm(m nu1optn nesasfaDtr( p;o1ape  iciyslsDua( snt4tleomociy1om e nei s)trtmimpiu4lm  lnvsl( srrm(mp;o1apxo o3tlt s umn p;t4areomr3iotlpteai ols texr(m3nudlltnmnvt t  Dua(rooo0apt ii3tls a uaumsnt)tlxrircoydfptrlueo;s0setrio3io4om nmncta(f 2rrxmono1oex mieiltlm ra(mp;t0 rxomr3iytomtrlies s srxo(m3io4ameelnciatfsrtrx p;t4apt  oetyd mDrluvp;u0 etoio iy1oate n i ( t2ur(o3io4ome livils)aDurx  ;o1tlxnif3iadla2rlu on(4tlerircoydoa ean il(0 etr(o3nydlmtelfvs t) Dtrxr ;o4apto ictydfm2em(mo;u)artoxr3iodopt lneilt)t2xrir oy1al elncs t)aruru pou4apeoif3iydlaDrl( p u4 exomr todlat liei;(  eurxr3ny1optnlfeslsfsruaur ot1oeeo fetyd m ul( p;t)teerxo tytlpD  n ols0s2uo(m3oo1ale mnes s)a2tmx  ;t1tet mi3tldfaDrl(vonu4teeoxocootomt  nvols t2uo(o3ou4amtnmicsltfsDraxrpou1aex io3iyt a elumo;t)aeeoxf3iatlmt luvs;s0t2uoirpou4optnlfcilt)sDum(ronu1optoiociyslsDuauvo;(4alxnxo iotop  li i (0 exrim nydape mfviatfs2umx pou4tptn o3iaslaDrln ont)tltnmfciydlate n olt)s2xmxo iy4llt lnvt ()arua(m ot4optnmi3iad s eluvpnu4 lermr3tatoa eaues;t) rxmxm io4amenmfvs t  2umxrp;o0tle mf3tltla2um(mo u)alxnio oatomDeauvs () 2urim3nu1ap e nvtatfsrtmx  no4oee ioeilsfmDeau p (0 reoif oytomD  i o;s)t2uo(m oodopen iviltfaDrmurp;t4olen f3ild m2ean s;u0alxrxocoatopDeluei s) 2toir oy1lpe mieilsfaruax oou4oltomfeiysfm2rm(mpnu4 rtnio io1lp eaieol(  rtm(m oo1op emivsa( aDrr(mont4teeoiietlsfm rm(mo;t4trermo ootoaDrai i;( t2uo(r oo4lpt lnesa()a2ua(  nt1aexo iciytlsDelumon() eermo3tatoateau s (  eto(o ou4om nmnct ( a2rmx ont0tpt ifciydla2rluvo;(0trtrxoctadlptraivo () euoim nydlltemnet t arrmxmpot0tltoif3ildlmDrmnmon(0tlxoxf3oydoatrlnei s  ruo(rpnodlpt  nvtas arta(rpnu4tet mfciydls eaums;u) rerifctadla elu o;( srtm(r iudap n fcil()s2tmx ont4olxnmfciydlsDumums t4tlerxf oodfp  auvi t)t2xmir no4lpe mfvt s  2urxro;o1tpe  octld s emnmpnu)tlxnir3ty1op  li sls)seurir3oydlptemies t srua(roou1tpxnmf3iasfa2uanvp;u4 eerxf3iotla eli i;t seur(o no4opeemfeil(fs2trx ooo1aptoii3ilsfs ra(mo (4 leoio ia1fmt liei;( srtmirpou4lmenlics ( sDtmumpoo0tlx ifcilslm2umuvp;(4alxnmr oatfat li s;( t2tmxm ou4ap  mfvsa() rtmxr ou0tlxnmfeiaslaDum(mp;() lerxr3ootlpt  u s t srtrxo iu4am emfet t a2tr(moot4optnifetat s rm( pnt) lxnxocio1fpD  n o;(0s2trir iu1om  lfetat sDua( poo0aee  fciysfm eln s (0 lxnmr3oa1laDeauei t)trxr(o iy4lm e fvi sf 2ur(m ;o1aex  feiasfs rlnvo t0 rtrxr3to1opDrauvi t)sexrxrpiu1ame lfeta(f 2ur(rp;t0alx mfeiltfm ua(mp (4teeomo3oadlate nvo (0texoio3nudlptnmfetl(f Dtau pot1openii3ilslaDel( snu4texrif3oa1omte i ilt0t2xrim ou4alt lict ( sruaxmpou1tlx mfeiatls ranmo;(0arerxrctatlptr neilt)s2xoxr3iu4lpen ics s) 2ra(rpnu4aeeoioeiytlsDrlnmp t4alenio iodop elnvilt t2tmio iodlpt  ivil() 2tau p;o1apx  feiysla el( o;t)artoxfcoydoat lu i;s  2ur(m3iu1ameelncilt)a2trur nu0oee mf3tls s eln p;u)tetrxf3ta1fp r ueo;s trumimpno1apenmfvia( artax  ;o1oeeomoeiad m uanvs (0aetnir3ta1lp rlies;t0 2trxo iu4amtnmiesa(f Dumumpnt1tle  ociyd a ea( pnu4 eerxfctadlpDranei ( truoim3nodape  feiatf 2rr(  ;o1tpen o3iys a2rm(monu0 etnio3totfp elivilt)s2xrir oo4ap n icils  Dtmxmoot1alen fciaslmDua(vsnu0trxniocia1late i o;s0 2xm(o3oy4lpenlictls  rurx o;o0olxn feiydlsDulu s;u4teenio totlp elu i;s0s2xoio3nodaltn ncsas  2ra(rpot1tpxnioeiatla2rlnmont4artoxf iytlpD aivi;(  etmiopiu4lmtnlnviatfs2raxmo;o1olx  ietlslm uauvs u4aeeoir3iytlm eauei t)sruoxr oy1lpen nvsat)a2rau pnt1alt mf3iyd m2rm( o (0 exrxo tytopt an i ()tetoir3oudlptemfesl(fsDua(  nu4oeenio3iadfs ra(mp ()artrmo3oytoaD an o;t)s2trir no4apeemnet tfaDururono4alxnmietasls2uauvs t0arermrciy1lpDeau o s  rxmxo3io4om nmici (fs2taum ;t1aet mietatfsDemu pn()aetnif oydom elnvo (  2xr(r nu4lmenmnvtltfa2rax pnu4alxnioctasfm ranmp u4trxnir3ootfp eanes;t0tetrxr3ny1ap emfctat) rum(mo;t4teto iciad m2em(vp;u4tltomr tydoatr ueo t)sexoirpio1lpe lnvslt  2rrur ot4oee mo3tytlm2uanmo;()artoxr3oatom  aieo;t  rxm(m iu4omenlncsa() Dur(m ;t4opx ifciltfm2ea(mo u0 ltnmf3iytomDe n s;t0s2urxm3ny1aptemici sfsrrmxroou4tex  ictltls2rl(von()arerio oodfaD au i t) 2uo(m oo1ll  mfcs t)aDrau poo0tptn i3iyslsDrau snu4trxrxfciodfatr ivsls) exrimpiodapt mncs (fsrtr(rpno4tpx mo3iadfaDemuvp u4alxomr oadlptrlieo;s  rto(mpou4lp n nvslt) rta(m ot4oeeo o3tatfa eauvsnt0trtomo io1lmtelivol( setr(r iu1om nmncsl( a2ua(ront1ole  octat m2umnmo;t0altnxr oa1fmDe n s s s2toxr3no1op e fvsat a2rr( pnt4tee  icilsla em(msn(4trenif iatfm  ln il( trxm(opnydop nlfvtat sDumxr ;t0openmf3tydls uluvs ()texrmf oy1fmD  ues s0s2um(opnodom  lfvt ( s2urumoou4apt ioctasfs uanvont)aetnmr3ty1opDr u s;(0 rxmio3oydamtnlnciat a2ta(r ;u1opxomieiyt s2rm(vs t) lxrmrcio1opt  iesls)s2xm(mpiudlmt lfct sf 2rmumonu0aptomo3tlt a2elnmp;(0texoif3oadla elueils0trtoirpno1ll   ieias s2ta(ro;t0oexn icildfaDraums (0arxoircoodopt aivilt0t2urir oy4ll n nvtasfaDtrxmpnt0opxnmoctlt m uln s t4alxomr iodlaD  nvolt t2xr(mpiy4lme  iesat sDraxmoot1alt ifetltfm eanmp u4aexoxr oydoatrluvo s) 2tm(r oudlpen ies (  Duaxmo;u1olx  ieiydfs2uan ont0 rtnircta1fmtrlu i;s0 eto(rpoodam e fet (f 2um(rono4tlt ifctytls rauvo;(4aetnxrctodom r uei;s)texmxm nu4ap emici (f rumumpoo4aexo ictld s eaump t0teenxfciatfpt  nvi s0srtoimpiu1alee fci tfs2tm(mp;o1opt mf3iasfs2um(vo;(4trtomf3oadoatr neo s0t2tm(r3iudlmt  fcsa( aruaxront4texniiciltfmDrmn o;u)trxrmr3iy1lpDeai olt0 exo(r iy4opeelicsas sDtau  oo1aex  f3iydfa2ua( on(0arenmo iytlmte nvo;t  rxoimpoo4apenmnei ()a2rrxr ;o0opt mo3iadfa2rlnmo ()arerir oodopDrai il(0 2umxm3oo4alt mfvsat arumumont4tet mfetytlm el( s;(4treoxrcootfaD auvilt0 rtoio no1aptemfvsls) rta(mo;o1aexn f3iydlaDeanmo;t4arxoxr3ia1faDeli ol()sexmim oo1olte ies tf rtm(mpoo4tptn i3iadls umu o;(4 eenmo3iytomDeaieo;t0 rxo(mpoydale lnet t)s2rau pnu1alt  f3tadfm uaumpn()arxnmocoy1lmDeanvo (0s2urxrpoudalen ictatfa2urxmp;o0tet iietlsfs2um(vo;u)altnmr3todlmDean s t  2uoxopou4lm emivt sfs2ta(rpnu4ape  f3iyt m rmuvon(4 exrmociydla r ivs;t  exrxr3nodomt  ivsa()sDra(m ;t0texniiciydlm el( o;u4trtnmocoytlmD  ivslt) rurxo nudoleemivsl( a2ur(m no0alx ifctasla uluvsnt0arermrctodfa  luvsls0 2tm(opiu4ol n fciatfsDumx p;u0aetomociltls2ul(vs;(0 ltnmo3oodoaDean o t trxrio3io4opte ivi t srtrxmpnu1opx mi3tysls um(ms;t)tetoxrcta1faDrlies;t seuoir3nodapt  fci (f 2um(mo;u1tetnii3tydfa ranvp;t0alxrmf iatomt lu i;()truoxmpou4ape mnetl(faruau oot0apx  i3tatfaDemnms ()tetrmf iodomt  u sl()s2xoio3ou4oleelfeta()a2raxroot1olxn oeilt a2elums t0 eeoif3ty1fa rlu olt0srurio io1ame lfcsltfaDur(rooo4apxo fciltls2ulnmp t4alxnmo iy1fa  lueols t2xrimpoudapt  nvs () Dra(rpoo0optomociydla2uln s (4alenif3oadfm  aieo t) etoxo3iodopeemneil(f 2urur ;t1tlxniiciat sDrl( p u4 eerif3iodlm  au il(0 2tr(opoodaptelneslt  rtmur oo4ole miciad sDua(mp;u)artnif3ootfa rlnvi;() etoxrpoo4aleelfet t)sDrm(m ;t1teto f3ias a2eanvp (0tltoir3iotfptraies;s)seumxopny1am  mfvi ( arrrxm ou1ale ifctysfsDrlnvpn(0trermo3oytlp  aiei;s trxrio3no4amtnmietl() 2uauront1apt mf3ild m2rlumont4aeeoxfctodfpD  ies;s  rto(o nu4oltnmnvtas  ruauront1texn oetys m umumo;(0 rtoiociatfmD luvo;t teuoim oodam nlfeta( a2rmuro;t1oltomieiad sDel( p t) lxoir ty1fpDrauvils0 etmim3nu4aptnmnviasfarta(ro;o1oee mi3ildla2ranmon(0 lxomocoo1fptr n o;( tetrxo iudalte ncs t artmum nt1ale  feiatfs ulnmp;u)trtrxo3ootom eaies;t srxrir iu4al  liei ()a2umurpno0tpx ioctytlm el(mpnu)artnirctytopte n ils) eumir nydlltnliesatfarrm(mpnt1tpeomfciat m emu pnu4aeeoxo totfmD  nvi s texmimpno1lpenmnesls sDururo;t0aeeoiociydfs uan pn(0artrif ty1lp rlnvils0srxo(o ou4opee ncsat)s2rmu pnu0oexnii3tasfa2rmump (4arxnxrcoa1omD lu o;(0s2trxo3oudame mfvslt  2umu  ;t4teeo icils m2umnvpnu)altrxr3tatfm  luvi;s0 rxoxm3nu1ll   fvsatfsDtrurpou4alx  ociysfs2rauvpnt)altnxo3oytomDelieol(0texmirpoo1lmee ivsa() 2truroot1tpx mi3ildfs2emumo;()tlxnxr iytoptrlu sl(0seumiopoo1lltnlfvtatfs2taumpno1tlto f3tld m2um(msnu0aetrio3iadoat luvolt)srtmxo3iy1lptelfctls)sDraumoot1oetomieiytlsDemnvsnu) eerio oodoaD luvs;s setmiopio4lp  mnciat a2tmxmpoo1teeo fetat sDrm(vsnu0 exrxr3tytlate nei;t0tetrio io1apt mieslsfa2rrur ;u1teeomicild aDem(ms t)tlxoio3ta1lp r neol( seurirpoo4lpeelietat  Dtaur nu1tee mf3iydlmDrlnmpn() ltrmo iotfa rlueo s0 etmirpnudaptelnctltf rra( o;t1oet ii3iad a2emu p ()tetnirctodoatelivslt)teur(m io4omeelnct tfsDurx pou1aet ifcildfa umnms;t)tlxnmrcoytlmD lueo s  2urir3iodapenmnvtatfartrumono1oex iietyd sDra( s u0aexrxf to1omD lnes t)setmimpiy1al   feiasfarumumo;o1olenifctldfs rlu p;u0altomf3ta1fpt  uvols  rxrirpou1op n nei ( s2tm(rp;t0alt  iciytlmDemuvp (0artomocto1fm  ai ols  rxmio3iu4lmenlfei s)srtm(  ;t0opxomfcilt s2rmuvs;u4altnifcta1opDrauei t) ruoxm nu4oltelfct (faDuaxm nu1tet iocils s2elums;() lxomo3tytomt  neo;t)trxm(rpiudlpenlfvtasfsrra(mont1olen i3iasfs2uluvs;(0trxrmf3iy1fmt anes (0tetrxrpnydope mics t)aDurx ont4tlt  o3iad aDuluvpnt) lerxo ia1omteaies;(0 2uo(rpno1lltemnviat srraum oo0apx if3iyslm2ea(vo t0tltnmf iydlmDeaneo t0 2trxm ny1lp  mnet ()srraur ou0alenmf3tas a ul(vsnt0tetnifciatla   n o;(  rumxm3nodlp  lnetl( s2tm(r ;o4optnmieiytlsDuluvont4tetnxr3to1op raueo (0seuoxopny4om n nvt ( arumxrooo0oexnmfeildfm2rm( s (4artrxr oytoptelnvi;s s2trxmpnydlp e nesat)s2urxr ;o1tpt mietldfsDrl(msnu)teeoirctadla raneo;(0 2urir3oodlmt micsltf rua(ronu1tpenmoeiydfm uln p;(4alxomrcto1fptr i s;t)srto(rpno4lm  lfvias)s2ur(m nt4apt mi3tyslaDua( s;()tltrmo io1lpD  i olt0 rxm(r3oy1open fvsat)aDra( oou0tpxomoeild s uan onu4 rtnif3iydomDeaueo;()s2xr(rpnudoltnlivi s s2ra(r oo1optn f3tlt s eauvo (4artnircoodfa rauei;t0srxo(r3iodlmt mnvslsfarumxrono0alx  i3tatfs um( p u4alxoio oadomDrlueil( s2trxm3no1omeelfeiasfa2rr(ro;o0ope mf3iatlmDea( sn() ltoiocoa1om eln i;s) 2tmxm nu1lme lfeils) rurx ont0tpx micild aDua( p;u4alxrxociadom eanes;t sruoxopnydopenmnvs tfsDtr(  oo0texn oeiad aDran p;u)tlxoxr3todfa  ai s;(0s2xo(o nodllt  iesatfs2tmur nu0aet mfetytfs2ua( p;u4altrxfcoadfa r uvi s trxmxm iu1al n nvsat  2trxmo;o4tpxoio3iyt mDrl(vp (4 rxomfcoydlaD anvi;t0seuoxo3iy1amee nvilt)a2um(ront4tpeoiociaslmDeluvs;u0 rtnxo oa1laD  u i s s2tr(m iy4altelncsat a2trx  no1texn f3tldfa2elu o () ltnmociatopte uvsls0t2tm(m iydlmeeliesat aDrruro;t4tlxomicils mDeln on(4altnmo3iatom  luei (  2urxm3io4al elnet s artrur ;o0tleo f3ils s2rl(msnu0 reoxf oadomteaiei;(0 2xoxr no4lpee ieil()a2tmxr ;o1aexn fetld m uaumonu4aexnirciadoatelivolt0 eurxo3oudlp  mnetat aDurxm oo1tlxo ieiytfsDul( s;u) lxnio3iotop rlnes;( setmirpnudapeelfet t  rtmx pno1tpt mo3tydlm2em( o t4tlxnio ootlmt lues s0 2uo(opoo1olt mncs (faDumur ot4alto iciyt a2uaumsnt0 lenmo3oydopteanvo;s  ruo(m3iu1olte nvi s) Drrump;u0altniietysfm ean o;t)tlermf3iotfptr i ils)s2uoxo oudlm  lfcsas)s2um( pnu1ape  o3tysfa2umu s t0tlxrifciotfmtr u i s0t2xoirpiy1alt lfesat)arrru  ou0tex  fetasfmDeauvsn() eeomrciodoaDe ivo;t) etr(m3iy1ol elicsatfs2urumoou1ole iictls a2emnmp;u0aeeoxrcio1faD  nvs (0tetm(mpoydoleelfcilsfsrrmum ;t1tlto oeiytlmDea( p;t) lenxocoadlpDrln i;s0trtmirpoo1lmen ncil() Dtm(mont1tle mietatla2ulums;t4aexnxf3totfmDranes ( srto(o3io4llt mfesl( a2trxmo;u1opxnmi3tasla el(vs;t) lxnmo3oodlatrau olt0trtmxopnydomt livia()sDum( o;t4apt  fcilsfs ea( p u)tlxoxfcia1la  lnes;s0 2xoirpnodome lnvs sf 2tmx p;o1opt mf3iadla2uln pnu) etoxr3oadfpD luvsls) exm(m3oy4lpt lfet t arta(m nt4tpxn oeiasls2rm(monu0trtrmf3iytomDrauvol(0seuoxrpou1amenmiet ()s2raxm ou0tltnioetad m uln p (4 eerif tydoa raivo ( seumxopou1omte neslt)aDrmxr oo4opx mociasla2um(vs t0 exrmoctytlaDe ieslt0 rtoim oy1lleemnes ( s2trxrp;o4aee mociaslsDul( s t)tlxnxo tydlpDeai ils)t2xoxm iy4opeemncslsfs2tmxmonu1olto ieiytfa2umnvs;t4 lxomf3iodfm raues ()seuoxr3oo4lm elnvsl(f rrmxmpno1alxo ietltlaDua(vo;t0teenxr iodlpDeli sl() rur(opiu4ap  miet t sDtaumooo4olt miciadlm2rmnvonu4arermocoydfpDraneol(0tetoimpiy1ame mnet ()aDuaum nt4oeenio3iatfs2eanmp;u4aeerxfciotlaD aivi s)s2toim3ou4op nlfesl(  rta( ono1opt ifctytfs ulu onu4treoifciodfmt lnvs;s) rumim3oo1apt lici ( arrrx o;o0ape iociysfs2uanmo t)tltrxf oydfp raueil( srxoxm3iy4amen ncia()s2urxmp;u1aeen feiatls emnvpnt4 rxrio oydopt li olt)trtrir3iy1lm nmnvil( srumx  oo4tlto oeiytls2emump;u4aexnxr oatfpDeaneilt  ruoxm oudalt lnctlsfsrtmxmpot4opxomo3tlt s2ea(vs;u) lxrioctotop eluvi;t srum(opny4lmte fet s srtaumo;u0texo fctysfsDranmp;(0tltoxr3tadlaD aivs;s0 rxmir3nydal emiet t aDta(mooo4aleo i3tls a umnmp ()trtomo3ia1oaDran i s)trumxm3nu4aptnliesasf 2uru  ot4alx mfetas s2eanmo u4teenmr ootoateli i;t0 exoim no1oleelncsasfaDraxrpot0tex mieiydla2rau o ()treomocoodlmDrlnes t s2xrirpiydlpt  fcilt aDum(mont0apto iciydfa2em( p;t0aeerxrciodomDr n o;() 2uo(r io4amenlivtls) 2um(r nu4ole  i3tatla2ranmsnt)alxnmr3tadla rlivol()trtm(m oudap   fvils  Duax pot1olxn f3tasfa ul(vp;(4trxnmf oy1fateaneslt0texrir3oodll n fet t srtax ooo1ope moeilslaDelnvs u) ltniociotfm ran s (0 ruo(m3oy1alt mfcslsfsDtmumoou0tlxomf3tydfs ua(vo;(0trxnmr3iatomtrln slt) rum(mpnudlmt mnet ()srrmu pou0tle mieiadlmDemnms;u4 eermr3iotomD lneols0srumirpiudlmen nesat a2rax ont1tee mo3iad mDua(msnu4aexrir oydopDe uvs t0 2trxopoy1lle  fcs s)arrr(  ot4tpeo o3tld mDum(mo;() eermocty1fmte i o;s)s2xoxmpiydaptemfct (fa2taxmonu4alt ioeils mDumuvp;t) rxnioctatlpDe uei t0s2uoim3no1op  mfvilsf 2rm(m ou0tptniieild aDuau pnu4 etoxo3oo1fa e ues;t0s2um(m oudol n nvta(fsDur(moou1olenio3ilsls2emnvsn(4 leoifcta1laD  nei;s0s2umim3iy1omtelfcs () Dtrxmp;u0aeeomf3ilslaDulnvonu4 lerio oa1opDeln o;()t2xmio iudllt  nvtat) 2ua(m ;o4ape mo3iydfs2em( o;u)artrxr3io1fa  an i;s s2trxo iy1lp e ncslt)aDumxr nt1aeto ietld s2ua(mo u0 lxnxf3oytfmDrln sls0srxr(r3nu4lp nmfvt (fsDrruroot0tpxo o3iltfs2ua( o u0aexomo3tatoaD anei (0 2tr(r3nodaltnlivsa(faDurx o;o4oexnmicilsfa ua(vo (0tltrxf iotla rauvo;t setrxm3io1al  lnetl(f rtaur no1tlxnmfciytls elnmp t4aexoxf iadoa  an slt0trtr(o3no4omte fcsa(f 2umuront1ole iieiasls el(mp;()trtomf3tatfateaiei (  2xo(mpno4op  lfet t aDur(m ot4tpto ociaslm umuvont0tetrmf3iytlmt  nvs;s)sexr(rpou1ope mnvs tfsrtmx  oo1opeo o3iltlm uaumo;(4tlerxr3to1fatr i slt)sexoimpoydamee nvs t a2rmx pou0ale  fetlt a2em(mo u)arenxf iodfat  i ol(0t2tm(o3iu1llen nctl()aDtm( p;u4tpen oeiadfs2em( s u4alxomf tatoaD lues s)trtrxrpoy4ame livs t s2ua(rpnu4tpen o3tat a2umuvon(0texrxo iy1op r ieol()setmxo3iu1lpt mfv
\ No newline at end of file
@@ -0,0 +1 @@
+i o t trtmio3oodll  mfesl( srrm(r no4oee  ociatlm emn s u)trtoxr3oatopt lnvi t0srtoxmpoo4am nlnvtl(f 2truront0olxomi3iytfs umn s t) ltrir iodfaDraivs s)seum(m ny4aptn fctl(faDtr(m ;u1aeenioetlsla rluvo (0aexoxfciatla eaivo t0trxmim3ny4llte fctlsfa2tm(mono0oee micildfs2el(vpn()trxoxocto1oatr n il()sexrxm3ou4ome  iviat)a2urxmoou0oetnmoetlsfa2ulnvs;t)altrxo iatlaDe nei ()srtr(o ou1oleemivsltfs2ta(ro;u0aeenmietydlmDelnvs;t)teenmf iytfpDean olt)trtm(r oy1om nmietatfaDta(rp;u1tpeomfetat mDrmums;u) rtnir3oo1fa  aues s)trtmxr3oo1lpe mies t arrru p;u4apxo f3iltls2em( s u0 eerxf iadoa  luvo (0 2umxrpny1aptelnet s artrx ono4tpxnmf3iadfa2um( o t0altomo ia1fa   uvols0s2tmirpnu1opeeliei sfa2umx  ;t0tpeoifcildlmDrluvp;()artnif3todfpDelneols trtmim3no4aleelnct t  2trxm nu4tptnmf3iysfsDuln snu0altrxr oodlpD  uvi;(0sexr(o3ny4al elietasfarrr(rpno0opt mictltla2um(mpnt0artnio3tytlm eanes;( sexmir3iudll elneils)sDrr(mp;t4ole moeiys m uauvpnt4texnmf oadfptrlivo;(0s2urxm ny1omtnmneilt)arraurp;t4oexnmf3iad s rlnvp;(0trenmfcoatom rlues;s)sexrim3io4altnmiciatfsDtm( p;u1tpx ii3ild a2rluvo t0 exrioctatop e i i s0 euo(r oo1lme lfetls  rrm(mo;o1openiictat sDua(vo;t0teermocia1lmtran ilt)t2toxrpnodapte nctasf Durur ot4aexnmieiytfmDemump;(4arenmo3totfpD aies;( seum(o3ou1llte ncsa()aDrruro;u0texomoctlsfs ea(vs;(4 ltoxfcta1lpt lnvil(  2triopnudape micilsfsruaxmpno4tetnii3iytlm2umn onu4alxnir3ta1omt aues;s  rtr(o3oudllen nvsltfsDrm(  ;t1open i3ilt s2raump u) etoxr ootoa   i i (  rtrim oo1al  licsat) rra( pno0tpt moctysfm2rauvsnu0 etniocto1oa r u ilt trxoim oudllee iesasf rta(rp;t4ole  o3iydla uanvs;t)arenxocoy1fm e u i s)trxrir no1ole mnvil()arta( poo4texn i3ilt sDrmn sn() lxoxf oadfp eauvs;( srxmiopio1lp emfcsl() 2rrxro;o1oeeniictat m uauvon(4 reomoctadlmDr uvol(0srtoxo3oy4altnmicsa( s2ua(monu0aeeomoeiys m2rm(vpnu4tleomfctydomteau s;t0trumiopou4ameelfes sfsrum( onu4teen iciyd aDrlnms;()artrxo to1fmDelnvi;s0srtrxopiudomtnlivslt  rrmumoot0aeeoioetltlm2rmnmp;()alermf3iytop e iei;(0 rurxopno1llt mictls arrrxmo;o4apxnifeiyd m2rmuvp u4 lenmfciadlpDr neol(0seuo(opiydomtnlictl()srrmxrooo4oleoifeildls rl(vs t0alxnmo3iy1oa e neo s)t2tmio3nydop nmici s s2tmuro;u1oexo feiltla uauvpnt)artrir ta1fmDrlu i;s  eto(rpoo4op n iviat) Draur nu0olxnmiciad mDrln s;t4treoio3iydfa r ieo;s)s2urir3iu4aptelncs t) 2uaxmoot4tlx ifeilt sDra( o;u4 renmfcto1fpD livo t) exr(opio1llenlfvsls)s2rm(  oo0opxn feiltla2umnmp t)altnir iydlaDrli i t0setoxr oydam  mncsat aDtau  ;o0teeoif3tytls2um(vp;u)aetnxo oytlp r nvo s) etrxmpou1omeelfcsa() 2tmx o;t4tlxnmfeiasfs2rmuvpnu)teenir3oy1fp  lu ilt)teurim3ou4optemfvi s  2ur(root4teenmi3iytfa2eanms;(4alxrmf3io1faDeaiei s srurir no1am nlnvsltfaDtmum ;t0aetn f3tldfaDumnmp ()artomf iytoaDe ueo s0trtmio nu4optnmivsl(fartmumpot0texo oetytla elnms;u0 etoxr3oytfp  lu s s) etm(opiy4lm nmfci s artru pou0aptnmoeiat mDumnms u) renioctatomt aues;t s2umxr3ou4opeemnvia(fs2tm(m ;u1tpt ifciyt s rlnms;t0 lerxf oadfpt lnvs s) 2xr(r3iy4oleemivi tfa2urx  ou1ape mictaslaDulu snt)aexrxo3ia1lat au s;()sruoxo no1optnmietlt s2um(mp;u0tptn ieilslm ranmo t0texrxo totlm r iei;t srtoxm3nodom nmietls)sDum(mpoo1opxnifciydls2ua(ms (4tltnmr3totla raivo t0 rxrxm3ou1alenmnciat artmur ot1opeoifctyslm ua( snt) etrxr iatlaD  i o;( s2um(o3oy1ale  iet s) 2um(  ;u4tpto feiytfs ul(ms u)tltrxf3oy1fptrlnvols)trxoirpnudameemfei t sDrrumoou0opxn octltfm2umumo u4trxnifcoo1lmDraieo (  etoio oudlpe  ncs s aruax  ;o4tpxomfciltfa ul( o;(4teeomf oy1faD  ues;t0 rxmxo3iu1apt  nct sfsrrruro;o4aet mfctytlaDum(mo;t4texnir3todoaDran s;s)s2um(o oo4amtn nes tfarrmumont4tpxo oeiatfa2eauvo;u)alxomrcto1fmte ues;s sexoir ou1lpee nes s artm(ront1ole  f3iyt m2ea(mpn(0trermr ty1faD lnei t  ruoir oodomenlici ()s2raxmpot4tpxoiictasfsDemn p;t4aexoxr3oytlaDran il( trumxmpny1ll elfctlsfsrrmxrp;u0ole ioeias m eanmp t0texnmr3iadfmDrlnes ( teuriopnudlme mnci t) rtau  no1tptoioeiysls eau o;t0 eerxr3iadlptrln il() 2xo(o3oydome lfes ( sDtrxmp;u0oeenmo3iaslmDemuvsnt) eeomf totopteli s s) rumirpno1ome  fvtltf 2umxr no0oleomictyt a2eanmon()trtoifcootfpD  ueo;( t2uoxrpno1altnlfvilt)sDtm( pou1tpxoif3iatla2uaums;u0 rtrmoctadlat livols)teuo(r3nu1lp eliei s)arraxr nt0tpt mi3ilt sDuau o;u4artoxocia1lmt  i slt s2um(o oo1op n ncslt) Dtmurp;u0texoioeiys aDelnvpn(4alxoifctodfat luvs () 2xoir iydllen net s) 2ra( pnt1alxomiciys a2rmnvpnt)tlxniocta1lpD  n o s)t2tm(o iu4om  mfvt s  rra(mp;u4aetomoeiatfs2um(vsnt)tlerxfctatlm rlivil(0srxrxopny1opte ivtasf rtaxmpoo0oex mi3iysla2ua( pnt0teeoio iodopte nvolt t2toxm nu4ap nlfet s  rrrxmp;u4aexnii3ilsfa2rauvon() etrmr totlp rlnei t) etmiopiy4lpe micsa()a2ururpoo0tpx mictyt sDum( o u)arerir3oa1oatrauvo t  rtoxm3nudale  nvia() Drr( pno1opt  oeiaslaDrluvo;t4 lerir oytla   ies;s  ruriopny1ameemnesat)sDtr(  ;u1tpe io3ilt m2eau snt)tltrmociy1opteluei t)trxm(rpiydamtnlfcsa(faDurx  ;u0oeenif3iytlaDemn pnt4trtrmf iydop   nvo t tetoio oudlp nlfcias s2umu pnu4oetn ieiasfs2ra(vo;(4arenxo3iytopt  i il(0 euoxm3oy1ap elfvtl(fsrumu  ;u1apenmieiatfm rau pnt4trtomr3oydlatr ueols)srxoir nu1alt licil()s2rr(  ;t4aet  ocias m ulnmsnt4 exnifcoadlaDr n o (0 2tr(r3iodomtemivi (faDum(mo;o4opt  oetadls2em( sn(4 ltnmf oatfaD  n s (0t2urxm3no4llt  ncia() Draur ot1tlto f3tltfs2elu o (0teenmrciadoatelues;()srumir ou4omtelics (faDtmx pou4tpeoifeiat aDelu o;()tlxnxf oo1omteaues;s0trum(o oydaptn feiasfarumuro;o1olxoio3tas m2eau o;u0alenirciotlat liei s) euoiopiu4al nlfvtatfsrtmxro;t0altomictadlm2eau ont4 leoircoodoaDeaivo;s srumir3oo4am  mfcilt a2tm(r oo1opx ifeiltla2elnvs;t0aetrmo3tadlpDraueo (0teuo(r3iy1am  mici s srurum no1aee mieiatfs ranvon(0aeeoxoctadfmDeluvs (0s2uoxo3oy1ole mneil(fsDtm( o;u4opeoif3iadfm ul(mo u) rxoioctodoptraies t t2tmxopnydopen ics tf 2um(  ou4olenio3tytla ran o (0 ltrxo ootfpteai i ( teum(mpoo1aleemictl(fsDrax pno0apt ii3iydlsDrauvp;()trxnirciadop  lnvsl(  rurio3iy4op  mfcia(  Dumurpnu0apxo i3tyd mDrmumsnu0tltrxo totlmDr uvo s)t2toim3nodaltnlictat  2rr(ro;t4aet  fciad aDuln p (4 ltrxociodla raivolt)t2uo(rpnudopeemnesa(  rrrxm no0openifeiat s emnvpn(4tltnmf3oa1lmt an o s) etr(r3io4ome lnctasf 2ua(r nu1opto f3tltfs2ranms;() leoirctydop rlnvo;s) 2xoxmpiudll  lnciat artruro;o1tltnmf3ilslm eln p t0tltoio todlpteauvs ( t2toxopio1alee nvs sf rrrx  oo1oeeoioctatfm2ea(vo;t0tetrif3oytomtraies t0srtoio io1oleelfviatf Durxmoou0aetomfctlsfm elumpnu4tltoirctytomDrauvil( trurim oo1aptemneiltf 2raxmonu1tleomieiltfm2elu pn(0tleomo oy1fatrlu sl(  eumxo iu1am  mfeilt)a2umx oou1oexn oeilsfmDrluvp t4 rxrxf totfp   uvsl(0t2tmxo3iydlm  lfet s)aDtrurpnu4tlt iociytfmDumuvp t0aeeomf3iydlaD aieo;s0 rum(r nydlpt lfvsl( sDrmxrpot4aee  f3iad aDulnmo () eerxfcoo1op e u ils0trtr(r iodamtn fes sf rrmxmp;t0ope  fetldlmDul(msnu) lenxf ta1lptraiei t  eumirpnudlm   iciasfa2tau  ou4aeeo o3iad sDumn p u) lxnxrctadomDelivol()trtoiopoodlltn nciltfartaumpoo1tle iiciytlm2rluvsnt)teerifcty1lpDe uvsls texoim3ou1lle mfcs (  rur(mpot0ale  ociadfm2emnvon(4trtomrcootoaD anvo ()srxo(o3ou4alt lncs ()s2tmumoot1oexn i3tatfm rm(vonu0arenxf iydlptrai o;s)t2tm(m3oydopt lfeias a2ur(mpno1alx  i3ild mDua( p;(0 reoif3io1oat  u o (0t2umxo ou1ape mict (  rua(mo;o4aex  oeiydfa rl(vp;u0 lxrmocoydlm rlivi ( t2trio3ou4altelfcias) 2urx ooo4alen fciasls2umnvp t4texnxr oatlp rlu sls0sruoiopou4opt mictl() rtr( onu4ape iociysla rlnvo u4 ltrmociodlmD luvi s) rtoim3iodapee fet ()s2tr(mono4aetomf3ildfs ulnvo () reriocoa1fp eluesl(  2xr(m3oydll emfvsl(fs2tm(mooo0tltnio3tydlaDelnms;u4aetrmo oydfmt aneo;t0srtoxm iudop nmics (faruru  ou1aeenioetatfaDrlnvs;()trxnmrcio1fatrlivs t)texoxr iudal  mivsasf 2tmu  no0oeenio3tyt m um(mo t)teenmrciy1lp r ues t0 rxmim ny4olt  nctls)s2rauronu0tpxnifctlt a elnmsnt) exnircoytlaDeaieo s)truoim iodlm nlnetltfaDtmxmoou0ape miciltlm rluvp t0aeeoio iodfm r ues;s  euoir oy1aptelict sfsDrru  nt4oeeomieiasfm eanvp t) eenmf iy1fa  lnvi s)srxmxopiu4omtelfes t srrrump;u4tltn fetytlm rmn p (4tlermo3iydlaDeaneo;t0srur(mpou1ome lieilt a2trxmo;u1aexo o3tat sDumnvp u)trermr3ta1omtean s (0sruo(r3oo1opt  ivt t)a2urx  oo4ole  ieiysfa ua( o u0 rerircta1fmt  neo s tetrir nu1olt miei t)aDtru  nu1oeeo ociytlaDea(vont) eerxr3iy1oaDrlies;t  2trirpoy4lpee netltfarurxr no4tle iictys s2umumonu4artnmr3oodop   nei;s)s2xr(opiy1op   nvi ()a2rrxmoot1ope ii3iat m rmnmp;() ltnxo iytla rau slt  rtrir3oo1oltelfei s) Dur(  ot0aptnifciyt aDum(msnu0altrxf3iydop   nvi;( t2xm(mpio1llt licia(  2um( oot0tlt  octatla2ul(ms (4alxrxf io1lp   n i t  2tmim ou4llenmnetlt)artrumpoo0aleoioeiatls el( p;u4 rxoxocta1oaDeanvolt)teum(o3ou1alenlfcsl()a2ra(moot4oetnifetldfs2um(vp t0trerxr ia1lptelu o s seurim3ou1apenmnes t)a2tmur ;t1tpxnioeiyd aDrauvsn(0trtnmo ootoaDran ol()setm(r3no4omtnmnvsat  ruax oot1olxnifciys a uanvs u) eerxocty1fm e ieo s  rxr(mpnodoleelict s srra(rp;t4tptnmieild s2raums t) ltnmo ia1fptrli s t  rtmxrpiudlme  ietas  rtaxmono0olx iociytfsDemumo;u4 ltnio3oytop  ln o;( seuoirpiydllte ivtatfsDrm( p;o1alx if3iad m rl( o;(4teermr ootlpDr i slt)t2toxmpiy4ol   nesas  rtmxrooo4opxn i3tyt s2eln o ()tlxomrctydfmD livol(0tetoxm3ny4apeelncs s)aDrr(r ;o1tlen ocildfa2el(vpnu)tltnifciy1opDrlnvsls) etmir3iodom elfvsl(fs2ur( p;t4oltnmocilsls2ua(vsn(0tetrmo3oydfmD lu i;t  2um(rpnydaptelnctltfaDrr( p;u0aeeoiietydlmDea(vs;t4artnir oydfpDr nei t seuoir3nudam nlici s aDtaxr ot4olxnmf3ilsls2uan pn(0areomf totfa e uvs;s0srurio3oo1opeelnvsls)aDrrx oou1aex  ieiat a umumpnt4 ltoxo to1lm ean s t)t2umxmpny1lpe mnvsa( arrmxm ou0aeenmo3ils mDua(vs () rxrxo iatop e ivs;() 2umxm nydlpen fvt s)s2rmx p;o0optnmoeilt aDrl( s;t4tlxomf io1lp  lu i ()trtrimpny1omt  ivia() 2rax  ou4tleo ociltfsDrmnvp;(4aetrxocto1opD au o (  eurimpny1al n fcsls  Drrxrono1teenii3tls s eau onu4altoifctotfaDeaieo t0s2ur(r3oy4ll nmivt s)a2uru p;t1tetn o3iytfaDelums (0aexnmrcoa1omDraieol(0sexr(o3ou4ll   nei t sDur( o;o1teenmieiyd a rmu p;t)treomfctatlmDe nvsls)t2umxm3iudome  neil() Duaxm nu0tleoioctadlaDeanms;u0 rtrif3iodfmDrau il(0teurxm nudop nlnvs sfaDrmxrp;u0tle moeilsls rauvo;t4aetrmoctadomDrai o;(0t2toxr oy1lptemnvtas) Dumur nt0tltn fetlsfsDuauvo;()trxrmrciodom  an ol(0t2xmxr oo1oltemies t) 2um(r ;o0apen ieiytfm2rlnvpnu4tetrmfcoadfa ranvi ()srtoimpno1lmee fct t  Dtmuro;o4aetn i3iadlm2uanmo () ltrmocio1op   ieslt0 2tmxopno1ope lncias arurxmp;u0alxomo3tld s2ulump;t) rtnifcoa1fpDelnei s0 2uo(o nodaptemnviasfs2umx p;o0opeo f3tydfmDraump;u)texrxf3oa1lmDr nvslt)s2xrxo3iu4lltnlfcil( s2taurp;u4ape moctysfa2ua(vpnu)trenxocia1fmtrluvi;t0t2xoxm3no4lme lictat)srta(  ;t4ole  ietltfm2ea(vs (0tlenmfctodomt an i;s0srtmxm3iy4lm   ivsat sDtr(r nu1tet mf3tadlm ranvp;t) eenmr3to1fa rluei s)trxoxr3nodlm   nvi sfsDum( p;o4aleniiciytlsDemu ont) eerio3iy1fpDeaiesl(  ruo(o3no4aptnmncslsfsDrrxm ot1apt ifeilsls ea(mo u0 lerir iytlpD anes ( trxmimpio4apt mfctls  2rrxrpno1openifctatfaDraump t0altnxo oytlpteanvsls0 rtrirpio4ope  fctatfaDtm(mp;t1tlen f3iyd aDrlnvp t0 rtrxrctydoa  lu i;s s2ur(m3iudoptnlfvsas)aDuaum nt1alx  iciadfmDelump;(4 ltrio3tytopt lnvs s0 rxo(mpiy1lltemfetl()s2uax pot0ole  octadla rmnmsnt)tlermr ia1fm eanvo;() 2xrim3ou1altemfesat a2umumooo0oee ifetadfa ulnvp;(0teeoxoctydfaDraiei;(0 etmxo iu1opeelnei sfa2rr(m nu1apx mfciydfa uau p;()teeomf3oydom   ivi t0 eur(m oo1openlnvil(f rra( poo0tlenmo3iltfs2ra( onu) lenir ta1fpDe n ols  2xrimpiydlmt mnct t)a2ur(ro;u1ope mf3tys m emnvs t)tltoxo oytfpDean o s)texo(m ou1ap nmnvilt)srrmx  ou1alt  i3ild m2rlnmo t) ltrxo iadla rlies;t0 rxrxmpoy4aptelivil() 2urumo;u0oltnif3ils m elnmpnu0aetrxr tydlp  au i ()trurxr oudoleemies (  2rauront1texo oeiltfmDrl( snu0teeomf oodlmD aies t setoir oo4am   fvsl(fsrua( p;t0alt mi3iysls2ea( p (0alxnircoy1lp eln o;s)teuoiopiy1lltn nci ()a2umu  oo4tlx ii3tatfa rauvs u0tetrxrciydlmD  nei;(0 2urxrpoodlmee fvsls  2trxrp;u4olxomo3ild a2rau snu0aexrmocty1fpteaivi (0s2urim3oodap emnvs t s2rr(ro;u4tltn octldfsDrl(vp t)alxnxrciydlatranvs s) 2xr(rpnodal elicsl( srtaxmpnu4aee mfciasfm emu snu0 rxniociodop ranvolt0t2tmim3ou4om n fcsas aDuaumpnu0tpx ifeilt m rlnvpn()alxrmo3oadfmtraivi;s trum(opnydlme micsat  rumxm ;u1alenmoctas sDeaums;t0 etrxo3iatfmDelivi;t srum(m nu4opte icias)artmu p;t0aexn feiyt a2eluvo;()treomf3todfa rlieo;t trxrxm oo4llt lfetl(farurxr nu0apt  fciytlm uluvpn(0arxrxo3io1laDr n ol()t2xoxo3ny4amtnlnei t)srrm(rooo0oexnmfciatls2rm(ms;t4arxrir3iytlp r ivs s  exr(r3iodamen nct s)a2ur(mo;o4tptoioctasfm um( on()alenmr oo1latrluvo;t0 ruoxmpnydomte fei t)s2rmumpot1apx ioeiadlaDemu s u)tltnxf iy1la  ln o;s  rxoxrpoy1ap emieilt a2ua(r nu0aeenmfctlslm2emnms (0 etnxocootfp r nei s  2tmxo3oy1alt lfct s  2umu pnt0aptnifetasls ua(mo (4 lxoxrcta1faD  ieslt) 2xo(m iu4lm elfvsls)artmx pot4tetn ieilslsDrmnms t4texnmf ty1oaDe ivi ()t2xoxopou1al e ivtlsf Draur ;o4tle mictatls ulump u4 etniociydfp  aivs t0s2toir3iy1lptn fes ()a2rau p;t1oex ifetatls uanmp;u4altrxr tatlmD auei;t0srtmir3nudoltn nvsls aruaur no0texnioetydlaDea(vo;() lxrioctotoat livils)trxrxr3iu4ol emnvils) Dtaxmpnt1oet iieiad a2umnvs ()alxrmfcoy1lptraueilt)teurxo3iu1lpt  fetl(  2urxr nu0tpe mociadfsDemnmp u4teeomo to1fpDeai olt t2xo(mpou1op   nei (  rtru  oo1oeto octlt m ra(vsnu)artrifctadop rlnvol()sexm(rpou4om nlicil( s2uaurpot0aetniicilsls rmums;(4 rtnmrciodfa eanvo s0s2toxopno1oleelnei t)srraur ;u1olt ii3tytfsDulnvsn(0altoio3oatlmD lu s ( truo(o oydamenmncia()sDtrx ont1ope  oeildls ea( s;u4tltrifctytoptelnes;s)t2xr(opiy1lpe  nciltf Dtrxroou4teen oetysfs2ean ont0arenmo oa1fpD aneslt)texo(mpnydlp n ieiltfs2urx  nu0tpt  ocilt a uanvo;u4 etrirciydfpDranvo s0 exm(m iu1omenmncil()sDuaxr oo0tleo o3ildfs2rl(mpnt4 lerio3tydopD  ivs;(0trxmimpoo1opte nvtlsfaDur(mpnu1alt if3ilt mDrmnvs;t)alxrir3tatopt  u o s)s2xrim iodamenmivil(fs2rau pno1olx io3iad s el( snt)artoif3iy1lpte uvil(0 rur(r3oodopenmnei (fs2umx p;o1tlxomfcilt mDul( s (0aexrmf oytop rau ils) etoxrpou4olte nvi s a2uaxr ot0olxomoetldla rlnmon() ltnmo3tytfp rln ol( trtm(opiy4lm elnct () 2rm( pnu0tex mictatfa elnvont) lxomfctatfmD aiei t)seurxopiy4lltnmictlt)artmxrpnt1optnifciatls emu p u0tetoxf oatfat au i;s  2tmxo3oy4omee nvtasf 2ra(r no0aexoioctltfs2ulnmo t)alxrxf3oydomte uvsls0s2uoir3iydop  mict sfa2ta( o;u4alxnmo3iat aDrmnmp t)arxomf tatlmDraues s)t2xoxm3iy1ome liet ()artru oot4apt iietlslm ulnmpnu4altrio ty1lm r ivil()seur(mpnu1omeelnctlt)arurur ot4altnmfetytfa ra(mont4aexomo oadomD auvslt)trxmxr3nodlmeemneta()arumxrpot1tleomfciatfs2rmnmsn(0texrircta1lpD  ivo;( trxr(o nodlm   fes (fs2trumo;t1tpx mfctlsfaDeauvp;t)arxrxf3oatlm e ies;()texm(o iodam emfcs t) 2tr(mpnt0opeo fciydlm2elnmo;t4 rtnxrcoadfptrlu i (  2umxopoy4lpe  fvtls)srtrump;o1aexnmi3tldfsDumu p t)arxnir iatoat  nvsl()t2xo(mpno1lpt mneilt) 2uaurp;t4tleoiiciadlsDuln snt4tltrxociydoatean il(0texoim iudolt  fcil(faDrr(r ;t0apeoif3iadlsDrln snt0treomfcty1om elueo;()s2toim oodome  feia()s2rrxro;t0apxomfeiltls rmu p;t4arerir3tytop r ieo;(0s2ur(o iydal e ietlsfsrtr(r ;o4tlxoifeiytla umumsnt4tetnmr ootopt  nes s  eto(m3nu1ame  ncs () Duru poo1aet mi3ilslm2rau s t0arerxo3oy1oa eln i ( tetr(opoudalteliesl(f rrau pot1olt ioetad mDeauvo t0aeenmrcoadla rlivslt0tetmxo3oo4am   fvtat  rumx p;t0oet ioeiatfm umnms;u4tltoxr3ty1lpD  ueo (0trtoio ny4apeemnciatfa2um(rpot1oeeo octyslm el(mo;t4 exnmfcia1la  an s ()t2ur(r3oo4ol e ieils a2umu  ;t0texo i3iatfs2rm( snt) ltomf3ta1lmtrlu slt) rumxr io4olt mici tf 2rru  ;o1oexnmfctlt m2elu o (4 lxniocty1oaDrlies;s  eur(opnydoltemfei sf rtax  ;o1texnmictat a ra(mo;u4 rtrmr3oatoat luvol(0t2xrxrpiy4lmtnlfvil()aDrm( pnt1olxnifetlsfsDrmnvs u)texriocoy1oaDraneolt)s2urxr3nu1lmeelicsl()a2tmur oo4tetn fcils a2eaums u)trtoxf todom r i o;s)texm(o3io1lpenmncslsfaDra(  nt4tpeoifciytfa2ranmpn(4trxrif tytomtrlneils)t2xmir3io4optnlnci t)arraur ;o4tpe ifctad sDuluvp t4aleoxrctydop   nei t0srtoirpny4oltemicta()s2raumooo1tptniictaslmDrau o;t4trtomf iatoateln o;()s2umirpnydomte fetlsf rurx oot0ale mfciaslmDran o;t4arxoir3totla rau o;s  2xoim oo1lptemfvtasfs2rmum ;t1tpe io3tadla2ulumpnu0 lxnmr3tatfa   nvs;s s2xoxmpiydaltnmfvi sfartr(  ou4opxn icilsfsDemumo u4 lermf to1fpDr nvo s0t2xoxo io4lptnlieiat  Drmxmo;u0tpeomfetadla rmuvs;(0tltnio totopte nes t srtoxr3oudol  licsl( sDtr( poo1aetniietys s2rmu p t) lerio to1fa  auei;t)teurir iudom  lfctat)a2taxront4openmi3ils a2ean p () lenif ta1om e nes;s t2xo(o io4lm n nct t)s2tru pno0texomieiat a eau s u)aexnmfcio1lpt au slt0srxoxm3nydopt mfesatf 2taxm ;u0olen f3ilsfm2ua( p u0 ltrir3tydopt luei ()srxrimpiy4am elneia(f 2umxmpot0tltnmfetytla rmums;t0aeenxf3iatfateau o ()setr(r3io1opt miet (faDrru poo0tlx ifetat a rmnmo t0 eerxrctydfp   i ol() 2ur(opiudomt mfet t)a2ur(mpnt0oeenii3iltlsDem(mp t4areoxr3iotla rlneo (0texm(m3oydllt lfcils)sruau poo1ape ifctydfa uanvpnu4arerir io1fp  anei;()trum(o3ny1ale mfciltfsrrrxr ;u4alto oeiydfmDemn onu)aeenifciytfp rlneols0sexmir oy4lmtnmfcsa()arrrxmont0tpeoio3iys mDrlump t)tleoif tadom  lnesl(0t2uoirpoo1alee net (fartrxm ;o0tlxomoeiyd m emumon(4 rtrxr oo1la   ies s) rtrio ny4op  lneia()srrrx  no1olxnmi3ildfm2em(ms u0aeerxr3oydfmDraneols) 2uoim3iu4apte nei (fsDur( pou4tptnmfcias m elnmont4arxnif3ootfmDeln i;t0s2xmio3ou1lm n fesl()artrumpnu0olxn fciasfs2ra( sn(0tetnmrcoa1oa   ieolt)tetrxrpnydllee fei t  2ur(rooo4alenmfeiydla ul( p;u0teenmrcoa1om e ieo;s srtrxm ny1aptnmivs ( s2uau p;u0tle  oeiyd sDulumo;t) lxrmr iatlatr uvolt  ruoxo ny1altnliet t)aDrax o;u0tlxn f3iatfa rmumo;(0tltoio3iy1la  anesl()s2toim3oy1om  lfeta(farururonu1alt ifctldlaDeauvp t4tetrxf ootop raiei s0 rum(rpiy1lltelicil(faDraxm nt1oltn fcildfaDrm(vs u) exrmf3ta1oat  neo;t s2tm(o3nu4oltnlics s  2ur(mpnt0tlxomo3iytfs2ulumon() lxomfctytlat lneols setoim3iudopen ncias arrm(moot0apxniietat sDul( p u0tltomr3ta1om  lu s s0teum(r no1openmfvs (f ruaxmo;o4opeomicias s2uauvp;t4alxoir3oodfpteluvs;t sexrim iy4opteliet sfaDrrumpnt1ale mociydlsDel(vs t)alxomfctatomDrlueils0 exmir3no1amt mivias)arur(ro;u4oetnif3tysfa2umumsnu)arxnxo oadop eaivi () rtmio3nu4amte fcil(f rurx pnu0oetnmieiyd s umu pnt0tetoxr totoatranvs;(0trxmxr no4alenmnes s  Drr( o;u0oexniieiltfm ran pnu0aetoio3totlpDeluvi t0 etoxo iodlpte fet ( artmu pno4ope mf3tlsla rln pnu0 ltnmf3oodlaD an i;t) etoir3ny4omte net s a2tmxmont1tle  fetasfm2el(msn() rtrxo3ia1op  li i;t0 rumiopoydapee netas  Dtmxrpnt4tpxnmf3ilsfmDemuvp (0 rxrmfcoy1opD  i i;s  etm(r iodlpe lncs t) 2umxrp;u4aee mfetytla elnmo;(4alerxo io1fm eauvilt  2tmim iy4ol  mieias)aDtrxm ;o1tpx ioetysla rmumon(0 eeoir oo1fpDrlues s)trto(r nu4olt livtl(fsrta( o;t0ape io3iydla umuvon()trxrmf3iytfmDraiesls srum(o nu4oltemivil(faDrmur ;u0opxo iciys a2elump t0texnifctydom elieo;s  2tmim iudlp nlfvilsf rumu p;o1ole  ieiysfa eaumpnt4aetrxo3tatlm eli ils0 2to(rpiu1optnmictltfaDurxrono4aee ioetydfa emnvp ()aexoir3oo1lm eaieils0 rurio oodomenlivs ( s2ra(rono0tet if3ildfs rln p (4arxomrctatfmt li ils setoirpiy1amenlivtat) rraumono1aex mfciysfa2ea(ms u) lxoxr3tadfmt ln s;s) 2trirpnudaltnlncsas)sDrau  ;t4tpe iociasfsDea( s;t4artoxr oodfptrlu il( trumxrpiodlptn netltfaruaumpou4oetoif3tydfa2ra(mp t4tltnxfcta1fp   nesl() rxm(m ou1apt lfeta( a2taum no1teto ictlsfs umu o;t)teerio iydfp   uesl(0s2toxm iy1opt mieils) Drr(m ;u4tle mfcilslaDra(vp;u4tltoxr oy1latelues;(0srxmiopno4amenmncsat  2rruroot1tptomoetys m2em( o;(0tlerio3iydfaD au ol(0trurxopoudomt  fei sfaDrrxmo;t1apeoiicilsfm rl( ont4tetrmocio1fm r n i;t  exrxo oy4alen nes tfsruaur ;u1aptomoetysfs2elnvpnt0aetomo oodfm e nvils)tetr(o3oy1omenmiet sf Duau oou4teeomoeiyt a2uan snu4 reomf iy1fmDe ivo;(0srxrirpiy1altn fcslt)srtmu p;t1oet iictaslaDem(vpnu)artrif oatla r ivols  euoxrpoo4ame  fctatfaDtmuronu1ole mf3ilt a2el(vs t)arerxocoadop  lnes (0 2trir3nu1op n nci sf rtrxr nu4aptn ieiytfm2umuvp (0 renxfcoatfpDe ivo;()seurio3iu4ol emncia(  Dur( p;o4tpenii3tat mDraumpn(0trtoxf iatopD ai s;t  2trxmpoy1lltnlnei t)srtrur ou4olt  f3iyt a rau onu4aexnio3ty1la r neilt  2xoxr3nodaptnliesa( a2tau p;t0alxomoeilsfm2rm(mo;u)arenxo3iadfmtranesls0teum(m3no1omenlnct t sDraumoou0oexn oeilsfm rauvo (0altrmr oo1oate ies;(0texrxrpnudlpenmnvsl()artrum ou0opxnmo3tat aDeauvo u)trerxo3iy1om e neols  rtoiopno4ome lnei (fs2tm(r ;t0texo o3iasfs2emu pnu)aexrxr oo1la raivs ()teto(m oodlpt micta() 2uaurpnt0alenmfeilt m ra(vpn()texoif tytoaDe i ol()setrirpnudlle livt tf Drr(m ou0tpenioetatlsDeanvp;t4alxoifciydla elieol(0 ruoxo3ny1ap e nci t  rta(rooo4tex mfeiyt a2uanvp u4arxoio3todom r u ils0 etm(r3nodale mfeils)aDta(rpot1apenmoeiysfs2um( pnu)trermo tatla e ieols setrim iy1aleelfeia() Dtaxrpnu1alen o3tltfaDua(mp u4altnmo iotfmDe i ol() rtmxm no1alt  fcs (fs2ta(mp;t4aeeniietyt s rmump t)tltoif3oo1fp rlivs;t)texoxrpnodlp   feslt  rta(rpoo4tpeoio3iadls2umu s;t4 eeomr io1omt au s s  2tr(m oo4ope lfcilsfsrrmxrooo1tpto ociasfm ulums;t) leoxociadomtr i i () 2xrim ny1ome mnvt sf rrax  oo0tpt mo3iydla2uluvo;(4aexoifciydfpte nei ( t2ur(o iydaptnmfeiatfaDta( poo1alto ictytls em( pnu)trenioctadfp e uesl(0srumir oudllee fctatfaruaur nt1oet iocildfm2umnmpnu4 exrir3to1lp rli s ()tetr(o3no1omeelfeslt  rtrumo;u4texo feiydlm uanmp t4 ltnmo3oa1lm rlivsl(  2xo(rpnu4lpt lnct sf 2um(rpno4oexnmieiad mDea( o;t0tlxnir oadlaDr nvs ()s2to(m nydll   fetat s2tm(r no4oltn f3tyd s2umumo;(4tlxnxf oatfm  aivs s)srtmim3iodop n nesltfsrtmx ooo1oexn fetyd aDra(mo (4 lxomr3iotlp eli sl(0t2umxm3iy1aptn fct (fsDrr(  no4olt mf3iatfmDeau p;() rtnir oo1laD  uei;s0 rumxm3oy1am emneiat)srrr( p;o1tpxo feiysla elums u0arermf todfa   neo;t sruoim3oodlmee nci sfs2umxrp;o1olxo o3tat mDelnmo u4tlxnxo3iytlatrauvil(0s2umxo oy4ame  fvtat)s2tmxmpno0optnifeild a2em(vp t)aetnif oa1fmt lu ils t2tr(mpiodlmtnlfct s)srua(  nu1tet mf3iasls rm( snt4 renxrciydoptr ieo s0srtr(rpoudaleemncta(  rra(mp;o4tetnifeiydls em( o;t)altnmo iodlptrauvi;t0 rxm(opio4lmenlfvilt) Dtrur ;o1olto iciat s ulnvp t0aeermociydop e nvslt0 2xrxo io1lleelfvi t) 2urxrp;t4opt  octys s2umnvp;u) ltrircto1fpt ai i;s trto(r iy1lltnmnciltfsDtaum oo0ope mfetldfa rl(ms;u)areoxfciodomD  uesls  ruo(o nydom   icils  2trumo;u1tltniocilsfm2ul(vpnu)arenxr iotfa elnei;( tetmimpnodom elnvs t) rtr(rpou4tee  ieils s ran pnt0tlxrmf3oydoptrlneo (  rum(m3iudlle  ics t)sDraxrpnt0ape mieilsfa rlums;(0 etoxfctodoat luvolt0trtmio io4op elnvi t)sDtmumono4tlto ictltlm2rm(mp;t4aleoxo ta1fatrlies s setm(rpoy4lpte nvsasfsrraxr ;t1ope iictlsfa eau snu) exoio3ta1fpD ai s t0teumxrpou4lltemicia(fsDurxm ;u4oleoifetyt aDemnms u0 rerif3oatfaD  n i ( trxoxopiydomtnlfeta(f Duaxmonu1ole  fetlsfa rm(ms u0tltrmr ootla  ln s t  exm(o no1ape licsat)a2ta(mpot0opx  oeiltfmDrm(vont0tetoxf tydfaDr iei s  etmxo iy1ole  fvtl()s2ta(monu1tpx miciatfa2ea(vs t4aetnxo oatlmDraiei;(  rum(r3oo4apt  fvs t)sDrrur nu4tltnmoctldfm2eln snu)aexoio ta1oateanes;t0trxoxr nodlm emivtlt)arra( pnu4alx  ictlsfaDelnmp;u0tlenxf3oa1fa  lu slt0texoxm3io4om  lictls)sruax pno4oex  fciasls uluvo;u0 exnxf3oatla   ivs () ruoir3iy1ame  ieias)aDurxr oo4oex mfciys a2emumont4altnifcto1lp rlnvilt srxm(r3iudomenmietlt artrumpoo4alen fciaslm elnmon()aleniocoy1fmt liei t0s2uoimpio4om n nvs (f ruru  ot1olx mf3tldlaDea(vs u4tlxomrciadlm rau o;t)s2to(o nu1lp n fet t sDraum ot0olen octatlm eln p u) renmo iy1lat lnvils)t2trim3ou4lmee nvt ( a2rrx  ou0tpx moeiatfs ea( o t4 etnioctydopDrlu o;s0t2uoim3nudlmee fci sf 2urxrpno0tlen fetadlm rauvo (4tlxnmr iotfpt  u o t0t2urir3oy1llen ivsas aDtrur oo1aee io3ilt s2um(ms u)tetrxf oy1opDe n o (0 rum(r3oo4lmenmiet sfs2rmxro;u1opt mocils sDraums (0 ltomo tatlm   uvi;t0texrxm no1amt  neiasfaDururonu4texniocilsfs2ul( s;t0tetoir totoaD aivs (0srxmir ny4lpenmfeta(fartax oou0oet miciys mDulnvs;(4tlxrir io1lmDeln o s0 etoim3oodaptnmneils srrau onu1oltomieild m ra(ms u)arenif oy1oate neilt)t2umim3iudam nlici s a2rr(mono0aetoif3tatfa em( o;t0 rtoxoctadlp eln o t) euoxr3nydaltnmfvi s)sDtmxmp;o1apxomociasfmDrmnvpn()artrif tadomDrlu o (0 rxmir nu4oltnmiet tfsDrmx  nt4alxnmociat a2ul(mpn()tlxoif oa1fpt  ueilt0setm(o3nu4omt mfcia( a2trur ;u1aet mi3iad m rmuvp t0 ltomf ty1lp   ieilt0 rxmir3nodaptemict s)a2ur(mont0aleomi3iysfa2ranvo (4teerxo3totlpteau i s)texo(m3oy1ll  mfei t) 2uaum no0tleomoeiatlsDum(mp ()aetrir io1oa eanei;t0trum(opiu1amt liesls)a2umumpnt4oet  oeiyd m um( snu4 eeoifcto1la  auvsls) rxmiopoy4op e ivi s)aDtrxr ou0tlt if3tas aDrm( sn() rerxo oo1fpD anvi (0t2tmirpoudol n ncslt  2rr(  ;u4tpe  ocilsfmDuaumo;t0trtrir3oo1fp   ivs;t seumir3no4ole lnvia( srtr(mont0ale  ictatfs em( o t)tetnifcty1oa rlnvil()sexm(r ou4om  lncs t  rrmump;t4tpxn f3tltfs2eanms;u4aeerxo3oy1laD  uvi (0srum(r3oo4oleelnvtltfsDua(m oo1oee if3iad aDua(vp;t) rxrif todfmDeli slt)t2tmxopnu4ll n feils a2rrxr ;t4tlt iociydfmDrm(mo u0altrmr3tadopt li olt0seuriopou4openmfvsl()artm(rpno4apxnmociyt aDem(vp t)aeeoircio1op eli il()sexrimpiodome mfci s a2raxm no0oltoif3ildfsDra(ms;u4texrmr3oa1lmtr ueo s t2trxo oydam   fesa()arua(mo;o0oeto f3tltfa2uanmsn(4 ltoxf3todfaDrau ol()srxo(m3oudlmtemfeil(  Drau  nu1aeeo oetatla2eauvp (0 lxnifciadfpteaneolt  rtmimpnu1optn feslt)srtrxmoou4olx  i3ilsfs ulnmont0tltrif3ia1op eauvsls s2umxo oo1llt lnct s)a2tmu ono0oex miciyd m rl(mo;(4 eerircoo1faDelivils t2to(o oy1altnmfvslsfa2ra(rpnt4aleo i3iytfm2emn p;() rtomo3iodfmDr i sls t2um(m3oo1olt  fes s  Dumx ooo0apxnmietytfm2ua(mpn(0alxrir iadfaDeaies (0s2xrxr3iu4amtnlict t  2tr(rpoo4tex mocild s2elnmon() rtoxo iadla rli o (0 2xo(r iydlmtemnvt s  Dta(  ;u4tpe  oeiytfs rm(ms u4tetrxr iatfm r nvo;s)teuoir oudop  mfvi (fsrrm(r oo0oltn feiyt s umump (4aeerioctytlaD  ivsl( trxr(rpny4al eliesl() 2rm( pno1oee iiciatfm2rlu s;u4aexrir oytlp  ln i t) exoxmpoo1apeemnvsa(  Dtaur ;t1tlt mf3ildlmDrln pnt) eeoxfcto1lp e uvslt trumxm no4lpeelnvtls aruaumont0olen oetatfa rmnvs;t4 lenmrcoydom rln sls)srtrio oudop  livtls)sDuaurpou1apx  oetysfs rlnmo;u0 ltnircta1oatean s ()trto(r3ny1om  miviatfsDrmu onu4apeomi3tad s2umuvs;t0alxrif iodlm ean slt  exrxo iu1am n neta(  Dtau  oo0olxoiictydfs2ulu sn()aetoxfcio1latrau sl() rtoim iydome miciat)a2taxrpnu1tlt iieiys s el(vsn() exrxf oytlpDe uvs t) 2xm(m3oo4oltnmivtl(fs2ra( p;u1teeoifciltls2emn onu)aeerxrcta1lpt au i;s)s2tr(o3iy4amtelict sf rta(  ;o4apt  fcild a rm(ms u) etrxoctytomt  n ils  exrxrpoydlptelivt (fsrtau  nu4tlxn fciysfa2ul( onu4trtrio oatlm r ueil(  ruoim no1lm  licsasf rtrx ono0aet mf3iadlm2rlu pn(4 rxrmf3iadlp  au s;t s2xoim3oo1ap emivil( a2uaxmpou1oet  ietldlaDemn ont) leomocoytop  au il(  exoimpio4olt liesas) Dta(r no1optoioeiatfa umn s;t)tlerir3oy1lm  auvi (0tetoxm ou4alte ivsls) 2umu pnu1olx if3ias mDrm(vo;t0tlxnirciatlmDe n ol( trxrir oodop nmfesa(f 2ur( pot0apeomfcils sDrmnvp;(0aeermfcoy1lateaieils) exoiopiydaltelieils  Dta(root1alt mo3ild m2umuvp;t0texnxfctatop elivslt  2xrxr3oodll n nvs t aDrrur ;t4opx  iciatlmDel( s;u0tltrmfcoytoa  lnvo;() exmimpiy1ape livias)s2raumono1opxomi3tls a em(vsn()aexrmr ootfmtrln sls0texrir3ny1oleemiviat  rra(mooo1oleo o3tyd mDrmu s (0tltomr iytlmDr nvo;s0 rtr(o nu4lle  ncs tf Dur(rpot1teto fciad s ul(vpnu4aexnmr3oadoate nvs;( srtoiopou4omt mfvilsf rra(moot0tpxn ictad sDua( o;u0artoxf tytla e u s;t s2uo(o3oydll n icta( srtaur oo1olxoioeilsfa2rluvo u0 exomo3iotfmteai ol(0setmimpnydap elneia( srtr(  nu4apeomoctlsfa2uau onu0tleoxf iodfaDe ueil( s2trxmpou4lme  ietltfartaxmont0apen i3iadfm2ea(vo;u0 leoirciydfpDr ivo;(0t2toxm3nu1ameemfcsatfaDraumpou0tleomieiydls rm(vs t)arerir3tydfa elies;( t2trio oy4ll e fctatfa2tmum nt0apx mo3ilt s2em(vs;t)tlxrif3oatfm  luvi;s)seto(o3iydlm  lfci t  Drr(rpou4aexn fctad m2em(vo (4 eerifcty1fatelieo;t0 2xrxo oo1omt mfvi (f Dtax  ;u1tle  f3tat s2elu p (4aleomr totfaDr n i t) ruo(m3io1lle  nctat  Draur nt0tlxnmf3iat s2rluvo t0arxrmoctotlat aueo s0s2xmxo iudaptemfviat a2trxmo;o4tlxnifctasfa2ra(vo u)aetnxf3ta1la raivil(0trxoxmpoo1omtnlnes (f rtau p;o0aex mf3tadls2um( s t)tlxoxfctadfa  li i;s) 2tmxopoy4ap  mncsasfsrtaumooo4alx moctas a um(vo;(0 lenxo todfmDrlnvi;( setr(rpio4llenliei (  2raurp;t4tpxn f3ils m2eanmpn(0tltomr3tatfmDranvi ( setm(opnu1apee nvsls a2uaxmoot0tlxn oeiasfsDrl(vpn() lxnxrctytfa   ieol(0srto(mpiydalte fes t)sDtaur no0tptoiieiltlmDumu s u4aexoxo tadlmt auvi s  2trio oudlptnmfctas arrmuro;o4tex  ietasfm uauvont0artrmo3totop eau olt0s2xmxmpny4lm nlicias)aDrax oot0ape moeild m uanvp;()aeeomocoadfaDrlu i (0t2xoxm3oudoptnmivslsfarraxmoou0aeeo f3ils m eaump;t0 rtnmrcoy1laDran sl(0 exrir3iodlme lieslt a2umx  no1aeeoiiciydfs ra( sn(4texoxoctotoa elnvslt0tetr(r iy1lpte neil(faDrmxmp;o4oeenmoeiysfa2eaumpn() ltrxf3iotla  livol()texrio ou1op emfciat)srrmum ;o4opt  i3ias a rlnvont4tetrmoctodom  lu o ( trtm(m3iudol n ies tfs2taurpnu0oeenmo3iad s el(vo;u)altnmr3iatfm  an i t)tetr(opiy4lltnlfctlsfs2ur(moot0oeenifciasfm ulumo;t4altrmfcta1lmt ln il(  eumxm nu1llenlnct s sDtmxm oo0open oeiatfsDua( s (0aetrxf iy1fpD lueo () 2toim3iydllt  fvs (fa2ua(mpoo1alxnif3tytfm um( p t4teeomo ta1fpDeaueo;t) 2xrir3nydlpe mfet (f 2umx  ;u4oexn i3tlsfmDrlumo u) etoxf3oydfateai i;s)trxoxo oydaltnlfvslt)sDua(r ou0apxomo3tadlsDel( s;t0texrmr3ia1optrlues t s2uoir3iu4lm emnci s)a2rmumo;o4oexnmfciat s2ulnms t0altrmr oy1lptrlu s;s0t2xmxo3ny1omeemivtls  2ra(mont1aptnifctysla2rlu sn(0aexnxfctytfmteln o s trurir iudoltemneiltf Dtr(r ou4tex  o3ilt aDemnmsnt)tlenxociy1fa ranvils  rtoio3io1llen icias sDtmxroot0altn oetlslaDraumo;(4 eenio3io1op eai il()sruoiopoy1op eliesa( aruax  nt1olxomoctyt s ulnmsnt0aexoifcoatfmDrlneilt0t2ur(r3nydlptnmicsa(fsrua(mpnt4olxoii3iatfs2elnmp;t4tlxrir3to1laD auvilt  2toim iy4olenlncsat s2uaurpou1tlt ioeiytlm uanmo;t) lenif3oytoatrlnvs () 2uoxr3oy1am n ics (  rum(r ;t0texnmo3iyslmDrl(mp;u0 lerir3iy1fp elieo s)trxo(m oy4ape liesa( aDrmxrpno1tee iiciyt a2rauvp u)alxnif3tytopt
\ No newline at end of file
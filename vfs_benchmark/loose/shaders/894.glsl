@@ -0,0 +1 @@
+uei;s  2ur(opoydamenlicsltf Dtruro;o1aeto f3iltlm2ul(vo;u4 leoir todlaD  n il(0sexo(m io4om   fviasf 2trum ;u4tlxoif3iat m2eanvp u4 renxr oodla rauei;t) 2uo(r3oy4ame mies ()sDrmu ont1tee  ociyt m um(ms;(0alxoxfciy1omt  uvols0srumxrpoudllt  icilt)s2urxronu1alxn feiys s rl(ms;t0trtrmfctodfmDe nvi;s  2xoim ny4ap emfcs () Dtaumooo1oetn i3iysfa rm(vsn(4arenir3oo1oaD lnvsl()s2uoim3oo1lpt lietlt artru o;t4opt mociatfm uauvp;t4 rtnmr oo1fptr u i;()srtrxopoy4lmenmietlt srraump;o1tpx  i3tlslsDrmnmp ()aleoiocto1op eauesls trxo(m oo4ap elies t  rur(m no4tlxoif3iltls em(ms u0aeenircoydom   nvi;(  eumir iudlmen nvtl( aDtr(r nt0aeen oeiat m2umnvp;()teenmfcoytfmDrlivs;()seurio iu1lltn fctas) rrrx p;o1apxomi3iadla2ua( o u0 exoxf3oadomD  n o s0s2toim3nu4open ivtls s2taumo;o0ole mf3tatfm ra( s;(4trerir tatfm e u i ()s2ur(o3ny4lmt lfvi t s2ur(mo;u0alt  ieiyd a2rl( s (4 leoxo iydlatr n s;s)trxmir3iy1ll nmics t  2rr(rooo1tlt  ociad s uln s u)trtomfctydfatean i;( seumxopny4lm  livs t)srtrx  ;o4ape  octas sDumuvp u4trtnxrctadfmDrliei;( trurxm nu4lptn feils)srurumooo4optnmfcilslaDemnvp;(4 rxrmr oa1op r nes ()t2to(r iu1ol  lfctat a2um(r ;o4optnmfciyd m2um(mo;(0tlxoxocoy1lp   uvo;s srxm(m3nydll nmietat)srurumpoo0olt io3ild sDemumpn()alermo iytlatraieilt)s2xmxmpny1amen ivslt) Draxro;o1tpeo ieiys a2rmuvp u4arxnmf3iodop raivo;s srxmir3iydlptn nvt ( sDtmuront0tptnio3tadfsDrlumo;()tlenmf3iatlm eanvo s srumio3io1op nlietls)s2tmxmo;o0alt if3tatla2uau o t)aexnxf todfa rlies;( trtoio3no4opeemneiat aDrmx oou0olx mo3ilslm eauvo;u4tetnxfciytlp r ueo ( s2toxm iy1opee neil(farrm(  ;t1apt ioeilsfm rlnmo;(0 ltnioctadlp  aivs;(0truoim iu4oltn fetat  rrmxmpot4olenif3tyt m rm(ms;(4trermrcia1oaDrln i t)t2uo(rpio1om n nvs s)srumum nu4tptomicildfm rl(vo;u0 etnif totoaDeaneol()sexmxmpoy4amenlfes ()sruax o;t1tetn fciad sDrmn o;u0 eenxr oy1fpDrlueol( t2xrir3nu1lpt lfcslsfsDtaum ;o4alenmoctasfm ra(msnu0tetoxo oytfp rau i;s srtr(o3no4om   feslt)s2tm(rp;o0apt  fctatlm2ea( pnt0alenxo3oatop eai ol()trtr(o3iu1openmiei s)a2tax  ot0tpxoifciadfa2ea( pnt)artrxrcoa1om  lies;s)t2urxo3no4ap   fci ( srumx pot0teeomieils m2eauvo t0 lxnmr oadfaD  uvo s0srxmio iy1ole  ivil(fs2rrxro;o0openiieiyd a2uluvs u0texoirciodopteli s;s0s2uoimpny4lpteliesat) rraxm nu1aexn fctad m eluvp t4trtnmoctytlp rliei;t0trur(m iodaltemiviatfaDta( pnt1olenmo3iasfa2elnvsn()alenif iydomt liei ()trxr(r3iy4ll elfvsl() rumxm ;o4oexnmietas s um(mp;t)alxomrcoo1om  lnvi s0 2urirpiudlptemneias s2umx pnu0optn ociltfs um(mp ()trxnio tadfp raneolt0trumir3iy1amenlfvi t sDua(rpot4ole  i3tatfaDrmn o;t0tlxnmo3to1oaDe ieo s) rumir oo4altnmfvs t  Drm(m ;t0alen oetltfsDean sn(0tetnxo3tydomte u i (0 2uoio3oo4opt  nvsat  2umuronu1oeenmoetld a2uln pnt0aexomr to1oa elueolt0sruoim3oo4ll   fviat  Dua(r oo4tpt  f3tlt m umu s t0arxoxr ta1la   ivo;t  eur(m io1apen nvi s) 2urxrpou0ale ifctls a2eluvs u)tltrio3oodlm e n il(0texo(m iy1lpe  net s aDtmu  ;u4olen fctat s umu o t4alenmr oadoatrli i;t  rxrir oo1omeemfetlt  Duax  no4tpxnmo3tas aDrm(msn()aeenif tytfaD  ueo (  2xoxm3nudome  fcs t) rumu  ;u4apeoioetasfsDuan s;u4 reomo tydfpD aivo (0 2toir3oydomeemivta( sDtru o;o1ole mi3taslsDemn p;()areoxociotfa   ueo;t0seuoir no4ol emnctls  Dtru poo0oltoifeiyt aDeluvs;t4aleoif3ia1fa rluvo s)trumir3io1omenlfet t)arumumont0altoiociydfm ra( pnt0areoif3oy1lmD  nei;t0 eur(o3nu4ole lfetl()s2taumont1oex iocilsls2rm(msn() lermf oodlm eaneo t  etm(r io1amtemivslt)arurxmo;u1tlxn feiltls ea(von(0tetnxf3oatfpte nvs;(  2xoxrpnodapee nvtls)s2ur(m ot4tpxnmieiat aDumump;(0 rermrcootop eln s s0 rxo(rpoo4ame  fctat aruax  oo1openmieiys m2elnmp;(0 rxnir3iytop rau o (0 ruo(r iu4om  lfvsl(farta(moou4oet  o3iytfaDua(vsnu4 lenxf3tadlaD anvs s)texmim3ny4alte ivi sfsDurxm nt4tetn oeiatfm eaumo;t4areoir oa1lmDranesl( trtriopoodom   nvslt aDtmxroot0oeeo ieiyd s2ulnvon(4tlxnmf3ootop  luvs;s)s2xrxopny1omt  icilt)arrmx poo4aetnmo3iatlmDrauvsnu0alermo3iadlateauesl( s2tmxrpnydlltelfvsl(  Drruro;o0oleo oetyd mDemnms;t0 etnxrciy1oaDr ivolt0sruoxr3io4llenlfcil(fa2taumo;t1tetnmo3iltfaDumnmo (4 lxomoctytop   i o;( tetrxrpoo4olenlici s)a2rmxm oo1opeomf3iaslsDel( pnt)tetnxfctodfmtr nvs;( srumxo3iodole  fci (  rur(mp;t4aptnmietysfa2um( o;(0teeoxr3ootlmt anvs;s  rtrio3ou1lpte ivs sf Dtm(monu4ape io3ilsfm ean p;u) ltnmf3iotomtrlneol(0sruoiopiydlpen fcs s)sDtmumpou1tpenmi3tyt aDulu snt) etoif3iytlpDrau s s0s2xoim no4lpeemfeta( sDuaxmo;t4opxnmfctld m2ulu s t4 rtomr oadlpD an o s)trxr(opiydalt  icsas)srtmxr ;o4tetomf3tld a ranmsnt) reoxfcty1fa raieo (0 ruoxr3iydomee nvt s  Duax  no1olx  fctytla emu p;t4tleomf tydlp  aueol( trxr(o nydlltnlieia(f Dum(rpnt1apxnmf3iyd a ua( p u)aleoir3iatfp  lu o;s)srtmxm3io4lm e ivt t s2raxmont1aleomoetyt sDuluvp;t)artoxo ty1fatraues s0 rxrio3oy1amte ici s) rta(r ;t4olen oetlslsDuluvsn(0aeeoxfcoadlpteau s s  rtoxo io4open icta( aDumumonu1tle  octytla2umuvo;u4texrmociydfp rlu o t trum(r3oo1amtnmfesatfaDraxrpnt0oltoiietyt m2ul(vpnu4aeerio3tatlp  lies () ruoxrpnu4lmtn ncs (f rtm( poo0apx  iciasfmDua( s;u0 exomfctydlmD lueolt)sexmio ny1am n iciatfaDtrump;t1teeo f3ilt a rmnmpnt0alxomo oodopt  uvs t)srxriopnodam n icsls)arrrurpno1opt iietat s2eln o u0 lxnxocoodlmDrluvsls)srto(o3ny1ale  ivtas artrx o;u1tltomfciys a2uan o;t)arenmocoydoaD  i i t)s2urxm3iydameelfes () Drmx poo4altn fetytfm ranvs u)trxrircoydopD ln s s  exmxo iydap n fctl( srtrxm ;t1aleomiciasla2em(vs;t4 reoir3tatlpDrlu i;(0s2toxmpno4ol e nei s)sDtaur nt4tlxomfetys aDumnms;t) rxrxf3oytlmtrauvo (  rtmxr nydlptelfctls arraxroot1tex  octyt sDrmnvs t)aetnio3oadla r ivs t0srxrxo ou4opeemiei t)srrr(r ou4ope ioetldls el( o (4arxomocoo1lp eli i;s0 euo(rpnudap nlics sfartm(rp;u1oexn i3tld m2emuvs t) exnmf3ta1lmtraivo ( s2xrim3oudamee nct (faDua(rp;t1ope  feiytfs ul( sn(0tltrxr ty1lpDean s t)t2toxr3nodamenmfet tf rrr(  ot4opxnmfcildfa2rm( o;u0trxnmf3oo1oate ivslt)teum(rpiu4lm  lnetlsfsruax ont0apx  i3ilsfs2el( snt0teeriociydfptr iei s) eum(r3ny1lm   nvs ( artmurpoo0altn o3tysls eaumo u)trerxf iotfptr ivil(0s2urxo3iy4am  mieslt) Dtr(roou0tex moeiasfs em(msn()texrifcoodfm  an i t0seur(r3oo1optelivt t  Dumxr ou0tleo i3tydls raumonu4texoir oy1fpt  i olt0srtm(rpio4ap  mivsatfs2uru oou0tpeoiictas sDem(mp;()treoiociydfmDr iesl(0 ruoio oo4amenmneias srraurp;t4tetnifcils s2em(msnt4 etnxociatfmD aiei ()setmio ou4oleelnvi t artrumooo1tptn oeild aDemnmp (4tetoxo tadopDr ivo ( tetm(o3nodal e ivtltfa2rmx p;u1apeo ocias mDrln s t0alxrxf iodom raneo;(  rxrio ny1omeelnct t)s2uaum nu4tlxn oeiaslm2ulu p;t4arxomfcia1faDe ivi;( tetrim3iu4olte nvs t arururont4tleniieiytls2rmu pn() etrmr3to1laDr ueslt trum(opoy1omenmfvs t sDrmumpoo0tltn iciyslm um(vs;(4tetrifcio1op rau sls  etr(m ou1lpt mfciatfarrr( onu4ale mi3ils s ra(vo u) reoir3oo1lm   ivi t s2uo(o3iudale  ieil(  Dta(mpnu0oet io3iyt m2elnms (4alenxr iodomte n s;s  2xm(opnu4lm  livsa() rtauroot4aet  fciytfs uan pn(0trxoxf3oydfmtr neo s)tetoir3oydop nmnciatf Dra(ro;u0tee mictytfm uauvsn(0arxrmrciatfm  ln s;t  2ur(rpio4om nmnesas) 2ur(rpoo4oet mi3iydla umnvpnu0 rxrmf3iodfaDeln il(0tetrxmpnu1om  lnctlt)s2rr(m ;t0aexomoctld s emn p;t4aexnxr3iotlp   nvi;s)s2to(o no4amtnlfetls)artmx onu1tle  feiltlaDrl(mont4tlerxr ty1lp  ai s ( trxmim nudaptemfcia() 2rm(ro;u1texomi3tasfsDum(mp;(0tleoio3io1fmtraies s0 exmxo3ny1om nlnci t)sDrmxrono4tleo ieiyt m ulumo;(0arxoif3iydfmte neo ( s2xr(r oy1lle mnvtl( s2rmx o;t4aexnmoeiasfsDra( o u) renmoctytoa r i i;s0s2tmxm3oy1lpenlnesa()s2ur(rpou0tptoifciadlm ra(mp;t4 rxrmo3oodlpt ai i;t  exrio3ou4omeelieia() 2rm(m oo1aee  ociydfa2rmums t)tetrxf oo1lmD  uvo;(0 exrirpio1al n ncias)s2ua(rp;t0tleo feildla2rlu on()texrxf3todlp   uvi s tetr(r3ny4aptemnvtltf Dumu o;u1olt ifciyt m2ra(vo;(4trtomr oytopteai i (0 etmim iy1lp n fvtlsfsDrrxr ;u4oeen oeiys mDrmn p u0alxnxr3totfp eai i (0trtoxopno4olee iei ()s2tau p;u0teenmo3iysls el(vsnt) rtrir tadoa  lies t trxm(mpiu1lpt lfci ( artrx pnt4ope  oetysfa2em(ms;u4texniociy1optrlues;(0t2uoio iudom emfvsls aDtax p;t4aleniicild s2eln s t0altrmr iydlmt  u slt0 rxoxmpnu4lp  lfct s) rurumpoo4tetnmfciyd a uanvon(0trenmf tadfpte n o;s s2umim3ou1optemnes t srtmumo;t0opto f3tatlaDeanvpnu4tltnxr3to1om eaieo;s)sexm(opio4amenmfvsasfa2urxmp;t0apeo oetat mDem( s t0areoxf3todlpDelivols trxo(r3nydopte fcs s) rra( pnt1oltomi3iydlaDrm( o;t0trtrifcoo1lp ranvi;(0truoir ny1lme  ncils srtm( ooo4oexn ociadfs el( o (4tetnmo tydlaDrlneils t2xr(opiy1amt mieiatf Dtru onu4aptn oetyd aDul(ms;u)altrmo tytfpte n o;s0 etr(m ny1alt mfcsltfa2rm( pou1aeeniictyd a emnmsnt)trtnxf iodopt anvslt0 2toir iudal  lncs s sDumx ooo1optn iciasfsDra( snu4tetnir3oadlpt  nvs t) 2xoxo3nu1op nmneils)a2ur(root1aet  o3iydfa2ulnms (4aeeomf3iodlp eau o;s0 rtrxo3oo1optn ieslsf rraxr ;u4aetoif3iasfmDeanvo;t0 ltnxfcia1faDraieils teum(rpoo4olt lnvtas a2umu p;u4tleomoctysfs uaums () etrio3io1fp ran i t)sruo(opoudlp nmies s)a2uau pno1olen ictysfs umums;t)trxnxrcto1om eaivo;t texrirpnodomen ncil( artm(  ou1olx mocildlsDemnvsn(0 eeomr3iodlatrluvo;s)trxrxopiu4aptn fci t)artmu oou4teto ocilsla2eanmpnt4trtomr3iydfm eaivilt s2xrxm oy4op emfct (fa2raumonu4apxn ictld mDul( s (4aetoxfctytopt auvi t0 2xo(m3io1amtnmfeta(  2umump;t1tpxomoetyslm umuvp u)trtrxr tydfatrlivs s)trxrxmpiudaptnmics s)aDtm(r no0olxn ietldfs rl(mp (4tltnir iatlmtranvi;(0s2um(mpoydlpe mfei ( sDurx  ;t0oltniictyd s em(vp;()arenxfcoy1opD aueolt  2tm(r3iy1ome  ictat  rtrxm ;o0opx moeilt s eau sn(4trtnxr3oytfat  i sl( sexrxr3oodlpen nvt sfs2rrxmpou0tpenif3iytls ran o;(0tltrio oadom  luvsls)t2umim3iu4ll  mfvs ( a2rrum ot4opt  o3iatlsDeluvo t)trxrmfcoytopDe n s;() rur(o iy4lpenlfes sfa2umxm nt1alenii3iyt a2ran s t0tlermr3oadfmte uvslt  rtrxm3ou1lm  livs s)s2tax o;t4apt mfeilt m2um(vs t)tlerxr3tytlptraneols0sexrxmpio1lmt  fcsat)a2ua(ronu4aexn ociltlmDea(ms t)trxomf iy1lmDrauvo;t sexr(r iy1omeelfesl()s2umu p;u1olxoif3taslaDeau snt)aetrmf oo1fp elieilt0setrxm no1omtnmfvtas)s2uaxr no1tptoifciysfs2elnvs t4 rtrxo ia1omt lnvs;t  eur(r io4amtelies s arumx o;o0alenmocils aDumn o;t0 lxoxociotlmtranvol() 2trxm3no1al  lnvslt)aruau  ;t0alen oeiatlaDel( s;(0tetrxr todfmtelueo;t trxr(mpno4op elivia()a2rruroot0tex mf3tad s ua(ms (4alxrxf tydfaDeanvs t0teuriopiu4lpenmicil(fsDta(ro;t0aee  oeilt m uln pn(0aexnmocoydfpt  uvs;s tetoxm3no1omt mivsls  Dra(rpnt0texoioeiatls rlnvs;u4tltrircoadomte i s;(0 rurxrpnodamtn fviat s2tmx p;u1teeo fctls s um( pnu)tleoir iatfm eaies (0t2um(o3oy1olenmivi ()sDua(  ;u1olxomi3tltlm2ulu o;t0aetnifctotoa e neo;t)s2toio io4olen fvta( aDtmum ot0teto f3iys aDrl(vs ()trxrxoctydoate n i;s0s2umxm3iu4lmee ici (  2rrx  nt4ape  ictls m2uluvs u4aetnmr oytfptrauvi;s  rurxopoo1lp emict t) 2urx  no1alxniociydlaDrluvs;()areoioctodopt  u i;()t2tr(rpoy4openlfvi tfsrtr( o;o0aetomfctltlsDemnvo;u4artnif todlmteai o ()srxmxr3nodlltn nvi t)sDua(ronu1tleo oetys s eanvs;t0 eenxfcootfmt  u ol(0 2xrir io1altnmnctls)srrr(m nt1oeeo o3iydlaDua(vsnu0texnmo3iadfaDe ieo () exmxo nu1opt lncs ( s2rmx  oo4tpx  o3tatfs2rmumsn(4 rtomrcoo1opt luvi;()s2uoirpny4am   ietatfaDrmxm nt1aexoioetat s ranmpn(0aexnmf oadomDe u s (  eumio ou1alee ncilt)artruro;o0tetoii3ilsfa ulnmsn()aexrxf ta1laD auvi;(  rxoxo iu4al  licsl()srta(ro;o0aeto f3iytla2ean pnt)alenxrcoydfaD luei t seto(o no4lm e nvsa()artmumpno1tetomictlsfmDelums;(0 etomo3tadlm   ueol() exo(r3oydlpte nesa(faDtru  ;t0tpx  feiyd s elu o;(4 rermo ia1lpt anes s  exriopiu4opt lies ( arraumono4aetomf3tlt m2emnvonu0 ltomr oatop elu i ( trtoim ou4om n ietltfsDrr( pnt4aptnif3ilt a2uanms;u0artrmrciatfpDrlivi s0 rtr(opoo4oltnliesa()srtrumoou4alenmfetyt a2rl(ms;t0tltrxr3ootomtelu i s)srxmxo3nydamt mfvs tfs2ra(ro;o4tex iociyslmDemuvs (4 leoxf3oadfmteai o;s0s2xrxm oy4omtn nvtls)a2uaxm ;t1tpe mi3iytlaDua(vs ()aeerxf oydomD  n o;(  exmir3nu1lp emietat s2ta(r oo1aeto feiadfaDrlnvp;(4alxomf3tydoatraies;s0s2uoxr ou1lp emfct (  Dtaum no0tpeo oeiltlaDrm(vo t4 etrxo iytom   n ols)s2to(r3iu4opte nei tf rrru  ;u1aeeo iciydla2rlnvs;t)tetrmfcoy1fm r nvol() euo(m3iy1aptemfvsasfa2tau  ou1aex ioctltlmDraums (0tleomfciotomt anvo () etrxrpou4lptn fvsatfs2urx poo1ape  ocildfa eaumo (0tltoir ia1opDelu i (0 rxm(m3oy4altnlfvi s artax  ot1ale moctatfa rau pn(4 exnmrciatoa r nes;s)teur(opou4lleemics ()s2trxmont1olxomi3tasla2elnvo t)teerxf3io1fpte uvi t sexm(o3no1lpee fvias  Dumur no1apx mieilsfaDuan s;u)areomf ia1fa  auei t s2tm(o oo1lp  mnvtasfa2ur( pno4oee ifciltls2uluvs;t)aexrirciodfmDe neo;t) rxr(m nu1lmen fei sfsrtrxr ;t4apx if3iydla rmuvon(4 rxnxoctotopD  u s s0t2ur(r3nu4ameelfcia( srtax oot0alxnifciatla rm(ms;t0tltoxfcoydlpD aneil(0teuoxrpnu4aptnmfeslsfs2rr(roou0tlt if3iytfs2eln s;(0tetoxrciodfpte u s (0 rxmir3nudlle mnesl( srrmumpoo1apxomo3iytfa2eln sn(0trenmr io1lptelueolt)seuoxrpou1apt miesls  2umxronu0tltomfeiltfa2ranmonu4tlxomr3oatlmt lneo;t0srxrxr3iudam n ieilt)srtax ont4optomf3ildla el(vpn()trxomr3oytfmDr ivi;t0srtmxo iu4omee nei (f 2umumonu1apx  oeils m emnvs;t0aeermo3oadlp eanvo;t) exrxr nu1lptemietlt) rtaxrpoo1opxn o3tlsfm2rmnms u4teeoxocoo1fmDr ivi (  2xmir nudlmtelfvsl(fsDtr(rooo0olxomoetytlm2elnvs (0artoirctodomDrlnei s  2umxr3nodlmenlfvt ( sDum( pnu0oeeoii3tad a rmn p;u0 lxnxf3todlmDraieols0 rtmimpou1lmtnmneta( sDrr( poo0opx iieiyd s2rlu p u4treomf3tytomDrlieo;( t2tmir3no1opee icsas) 2um(mont4opxoifciad m raumon() rtoiociytlmteaivs ()sruoiopoydam e ieslt  2ta(  ot1tpt  ociasfa2uan o u0 lxnmr3todoa elnei () eurio3nu1lpenlfvils artr(rpno4aexnmf3tyd mDraump;u4trenir3tatopDr n slt tetmir3io4lltn nei ( aDuauront1aleniieiytfm2ea( pnt)arerio3iatlpte uei;s) 2urirpiy1om eliciatf 2rrx pnt1teenifetasfm2ulnvsn(0aeenmo3tatlate u s;t) eto(m3iudaltnlncsatfs2ua(r ou0optniieiydls ul(vo (4 lenxo3oy1oaDrai sls t2tr(opoodoltn ivsa( srurum ou4oexoiiciltfa2ra( snt)tlxnxfcoydfaDeaieils0srto(m3iudaptn fetls)artmx poo4texn fciysfa uan on(0trtoxf3oo1oaDr n s;s trurxopiydapeelfctat sDuru pou0oetomfetlsfa2ulnmo;t4aeermf iotomt ln o;s  exmxo iu4amtemivs t)sDtrxmp;u0apeoifciasla2ea(mpnt) lxnxf3totla   i s;s)srtrxo3nu1oltn fct t) rtmxrpnt1oleoifeiytfa ua( ont0 rtnmf3oydlaDeaivo (0t2xrxm io4ol  mnes t  2trxm ;t0apt  f3tlt a rm( s u4aetnif iodfp e ies t)srxoio nydalenmivsas) 2uaxmpoo1tltn f3tysfa2emu o;() reoxociy1oaDrluvs t0t2xmim no1lpe micia( srrru oot4tptn fciytfm uan p;u0aetrxr oatfpD  i s (0t2uoim iodoltemfcs t  Dtmx  ou1ole  feiysla2eluvs (0texomrcio1opD lnvo t)s2xmio iu4oltemnes s)aDrm(m ;u0tee mieiatls2eauvp u0 lerio3iy1laDelueol(0s2trxr3iudaptelfvsat  2taumonu0aleoif3iydfaDean o (4trerxr tydfmtr nesl() eto(rpnydamt  nvias) 2tmxm ot1opx  oetlslm rm(mp;u0trenxocoadlm   ivslt0 rumxmpny4opeelfvi (f rrr( pnu0teenmf3tlsfa rauvsnt) etrio3oo1lmt au ils teurirpoo4apenmivslt  rum(mp;t4tleo ietls aDul( onu4teeoif oatomte nvo s t2umir3nu4ol emiet ()a2rrx o;u4tpxoio3iydlmDuanms u0altnxfcootoate u ol() etm(rpnu1ll nmneia( sDrm(  ot0oltoifetydfsDrln snt0tltnxrcto1fp e iei s0 rumxr3iodopenlfctas  Dtmu ont4tetomoeiysfm ul( o () eeoirciotfptr ues () rtrir oy4ome mfcil() rrmxro;u1opt io3tyd mDemn p u4artnio3iydfa eluei s) exo(mpoy1lm nmfetas) Draxm nt4aex moctasfaDel(vp;t4treoxr tytop e nvs (  2toim3nu4ome  fvia() rra( oou1apeoii3iatfsDrm(mpnu)aleoifciadomtrlues (0s2ur(r3nu1ope mfvi t s2ra( onu4apeomfciys s2rln p;t0arxrxf iadfat  neo;s  etrimpiudopt mivilt) rraumono4alt mo3ias s emuvs () exnxrcootopDr i s;t)teuoir nu1al  lfvsatfs2rax pno1oltomi3iltlsDrl(vp;(0 renif iatomtraiei;t s2trxo iodlmtemivsat  Draxm nt1olto oetyt aDumnvpnu0 rxnmo3totlm rau ol( srtmxo3no4olt lnes t) 2urx p;o0olxo f3ilsla2ua(msn() reoif3iotla rlnvs (  rumxo3iy1om emnetat  2trxm ;o4tpen i3tyd aDumu ont)texoiocoo1oa   nvo;t0 euo(r nydapt  ies s a2uaxro;o4apxn octlt aDum(vs;(4 ltnmf3ootoatr i slt0t2tm(r oy4am emncias s2uau pot4apx  ieils s2rmuvp t0 etrif3oo1oa eanei;t0s2ur(r3iu1aptn neilt  Dtr(r oo4opxnmoctadlaDeluvo;(4aetniocoytop   i s s setriopnydll  miciat  Dururoou1optoiiciydlaDrau o;u) rtoxocootlp  lueolt  rtr(r3oy1om nmfetasfaDumxmono0tlt  i3iatfaDrmn o;(4trtrxr iydlpDeauvo;() eumxm3oy4ol nmicsa() Dtrurpnt1tpe  ictlt m eauvsn(0 reomr3oytlat  i s;()setm(opou1olte iesat) Dumurpoo4tet  feiad m ulnvpnu0 etoircio1om  livi s)srtm(rpoo1lptelivil()a2trumpot1oleo ieiysla uluvsn()arxrmo ty1opDe ivil( tetm(rpnodap   fcilt  Dta( ont0oetomoeiysfaDua(vsnu4aexrxfcoy1opt  u i;(0 2xoxopny4ale  nvils)a2ur(ro;o0teeniociytfm2ranmon(0 ltoiocoy1oaDe uvo;s0 etrirpoy4aptn ivsl() 2ururp;u4ape ifeiadfsDul(vp ()alenxo3io1fp eai s t) exr(o nu1lm nlnvt s)sDuaumont1tpx ii3iasls2ea(vo;t)aetoif3to1lmDeli slt0 exm(rpio4am  lies () Dururooo4oet ifetysls ea(mp;() rtoir3ta1la ean o s)srtoxo3nu1lmt mfcsltfs2um( oot1tpto f3ils m ra(ms;u)trtoif3oo1fmtran sls0texmio oo4ame lnvi sfa2ra( pno4aeen oeilt sDeau s;t)tleomoctydomt ln ils0trtrio iu1lp emiesatf Drru ono0oeeoif3tyt s2uaumont4trenmocoydlpD lueo;s s2trxr3oodape mnet (faDrm(moot0tee  fetld a emnvo u)tltrmo3todfpD auvslt setoirpiy4ll  mfvsasfartrxr no0opeo feiytfmDem( s;u0teeoirciatopt ln s t)setoir3oy4ale lietas  rrmum ;o4aeto o3ias mDrlums;t4tlxoif3ty1oaDelu o;s)s2ur(mpiudoltnmfvsa(f rrr(moot4olenifciys aDulums;u) lenif oydlpD lieils trxoio3ou4ol e nei s)a2rrxrooo1tpx  ieiatfa rm(msnt0arxrxrctadlpDe ueolt0s2xoxo3nu4opt  neiltfs2rruro;t4tlxomictatlm2rauvs;u) rermfciy1fptr nvs;(0srxmir iodol   icils aDraum no4aptnmietlsfmDem( p;u)tlxrmf iadlpt lneil() etmir iu1om e feia(f Drm(monu4alenifcilslaDrm(vp u0aexoxrctodla rlnvo;( trum(m no1al elnvt ( a2ua(mpoo4aeeoiicias m umuvon() lxoxf oytop   u s;t0t2toxrpoo4ameemfei sf Dumu  ;o1teenif3tyt m eaumpnt0aeenxo iytomDeauvi ()t2xrxo3oydaleemiei ()aDrr( p;o0aetnmo3ildfa2uluvs u4 ltrmf oatlpDraieo ( srtoim3io1ol n nvsl( sDtrx ont0alenif3ildla uln o u)aexoxo3oatlmtrlu s;s0 rxmir nu4op n fvsl()aDra(r nu0oltomo3tatls uln ont4trtrxfcoatfm   n s s  etrxr3oy1ol  lfei ()a2ra( o;o0optnmf3iadls rmnms (4treoif oa1fmDe nvsl(0tetrxr no4am emnvi () rrmu p;o0apxomocils m2umnmsn() lenmrciatfa e neols)srurio3nodll  mnct t  2rrxrpno0tptn ietldfs ulnmsnu0tetrmrcia1opDrlnes;t0trurxm ny1ap nlneia( aDrr(mo;t4opt iieiadla2rlu ont0aexoxfcoy1la r iesls  exm(opnudlp nmieslt  Dtrxmpou0alen ictydlm2em( o;(4teermr iytfpte i o;s teto(o oy1om  mnctat  Duaumonu1teto ociatfs2rmump () rxoxf todomtrauvo t srtr(rpiodomtnmfcs tf Dtrumono4ope  f3iys s2umnms;u0teenif3tytfaDrau i;t  exmir3iu1amen ieiasfsrta(r ;u1opx mieiaslm el(vsn()trxomo ootfm  ai olt0srtmxm ou1ap e iesat  2rm(mp;t0olxn iciytfm rmnmo u) ltnio3oodla  auvi;t srurirpoodoltelfeta(  2rm( ono0openioeildls2el(mp;(4tleomr3oytfmtr i i;s0t2uoim3io4ameelncs t)sDur(mp;o4aee ii3tls s eluvp;(4teerxo3iodfpD aues;t setrxm3oy4lm nlivt s sDtaxm ;t0opeoii3iltlsDrmuvp;u4alxoxociytomtr i s;t  eto(rpnu4aleemneslsfa2urxrpot0ale  ieilsla2emu ont0arxoir ia1omtrlnes;t0 2trimpiydopee icsl() Duaur nu1optn iciltls2emuvs u0 etnio3iytlptrlueo (  2um(m ny1oltn nvtls s2ua(  oo1tlenioetysfmDel( o u0tlenmf io1faDr uvo t0srum(opou1olenlfvias) 2rrxr nu4tpt  i3tasfmDean s;u4teerxf oatomD aueil(0s2urxrpiy1ap emfvi t)s2trxm ;t4apxn o3tldlm2ra(vs;t0tltnxo todom ran il(0 2xo(m3nu4amte nct (farum( ont4aleo f3tad s rmu o ()alermf iytfa  auei t t2xo(o oy1alenmnvilt  rtr(m ;u4tee if3ild m2rluvo;u)alxrmrciodopDrauvi;()sexoxr iu4lmt  ncs ( sruaumo;u1opxo ociaslm umump t)trxnmr3ta1laD anvi t) ruo(m ou1llt lictas  rrau pno0oetomi3tytlm2ea(von(4trtrmrciydfat lnei s  2xrxr oy1ll   fctlt)sDumumoou4apxn f3iasfsDuan o (0trenir ty1laDrlu i;s)srur(r3ou1al  mncs s  2umumonu4tlenifciyt mDrl( pn(4tlerifctytfp e ueo;()seuoxo nu4alen feiat)arraurp;u4texnio3tlsfaDul(mo;u4trtrxr oydlm rau o;t  2trim no4omen fcs s) 2rmxroou1tpeo ociatfs2elnmon()arxrmo todlmDe u s;t)seum(rpou1lmen nvtls) Dtmxrp;o0tpt if3iyt m2eau sn(0tlxrmf3oodfmDrlnei t)srxo(mpoy1oleelnctlt artrur ;u0oet  oetydfa2rl( pnu)tltrxocia1lmte uvilt  rxm(m3ou1am nmfvs t)a2ur( o;u0olxnmoeild a2raumsnu)arxnmo3oodfatelu ils)srxr(m3nu4lp nlnvta() Duauro;o4opt mietat mDrl(vpnu) eeoxo iytfaDeai ils0 ruo(r oo1lpt mfvs sfarrmxront0oeenmo3tyslsDuanvo;u0alenmfcoydlpDeaivi;t)s2xm(r oodolt mfvt tfsrrr( oou0tee mfctld mDra(msnu4aexrifciydfm e nes t truoim io4olte ictls) rtmuro;o0alto ieiytlaDemu onu0tleoxf tatlp  aivs t  exmxm3nydom  lictls)arrm(ro;o1teeoif3tlt s umuvpnt0 lxoif iatfm  livi s  etm(o iodolt lfes s  Dta(mpoo1tpxn iciydls umn p;t0trerxr3io1opDrauvi;( teurimpnodlmt mfcs sfsDum(ro;t0ape  ociltls2ra(mo () renmf iatom rlies;(0 rtoirpnydop emnctls  Drmu poo0oeen ieiad mDuln p u4teerxr ty1la e ies;s0 2xrim3nudole  fvi ( srum(r ot0olx moeild a2uau o u)trxnifcoo1omtran o () exr(r3oo4lm n net tfaDtm(rpot4tlx miciydfsDrmnmo;t0tleomrciodoptr ivil() 2xmio oodllenmivil()s2tmurpno1apto ocils m2rmu pnt4artomr oo1fa e neolt trumimpnu1op  mnvsa( sDtaump;t1tetnioetyt m2rl(ms;u0tleoifciodfp r uvs s0tetrir oudom e nct t)arrmu oou1tlen o3tytlm ul(vo u4arxnxo iodom   u sl(0s2xoir oo4oltemnci s) rrrumo;t4teenmf3iysfsDean pnt0 eerio3tatlmtr uvo;s0teto(m3oodop  lies ()srum( o;u0aptomicils m ranmpnt)alxrir iotlm eln s (0t2ur(m oudlpen nctas s2rr(rpot0alx  ictad a2ranmonu) rtoxfciotfpte ieo;(0 rtoxm3oudlmtemnvilt)srraumoot1ope io3iatlm rauvs;(0aetrxo iotlp ran il( t2urim ny4op n nci s)a2tmx ono4aet  i3iatfsDeaums;(0alxoif3iytla   nvo;s0s2trim ny4omtnmfes (fs2ra(  oo4olx mfctld a rau onu0trxoio3tydop  li o () 2xo(o3no1ap nlfesat) Dra(mp;o0tlxomo3tytfs2emnvpn(4trxnmo3tatfpDr ueolt0 exrxopoydap emnci s aDuaumonu0ope ii3tydfa el( p u0 exnmo io1lm  auvi;( s2to(m3no4om elfesls  2ta( ont1olto ietaslm eau s t)aetnmf3iodlaD lueol(  ruoxopiodlmte ictatfsDtax o;t4tptomietysfs2eau ont)arxnxr iotlmtelueolt)seurio nu1apenlnesat aDtmxm oo1alx  f3iasfs emnvp;u0trtrxr3oy1lpDe u i s0trxrxmpnydom elics t)a2uaumooo4tetnmoeiadla uaums;(0 exnif3ootfp e ieo;s)s2umxmpoy4alenmieiatf Dta(r nu1opxn iciysfs2ra(monu0tltrio tydoatrli i;() 2xr(mpno4lme mfcilt)aDta(rooo0apxo fetadla2uan pnt) renxfciadfpD  nvi;s  rto(o3oy4lm e fei t srrr(  nu4tpx ii3iyslmDeaumsnu0trtoxfcoydfmteanei;t teumio3oo1alt liciat) ruaum no1optnio3ilslm ea(msnu4 rxomo3ta1lpDeaivils0t2xmxmpiu4am eliei t)sDraxmo;o0alxnmf3iyt a rln p;u0 rtrifciy1lmt lnvo;t srur(opny4ape mfeilt)aDrau ono1opt  iciyslm ua( onu4trenxo ty1la r ivo;s0s2xmxmpnu1openlfetas)s2rax  ;t0texomf3iydlsDrau s u4teeoxocio1fm eauvo;t0t2xo(m ny1olt mictasfsrtru onu4aee ifeils mDumn o;(0aleoxr tatlm   uvs ()t2uriopnu1ope  nvil(farurxmpnt0oltn f3iysfa2elump t0alermo3tytfp eln o;(0srtr(m nudam emfctls) 2ra( poo0aeto oeils a2rmnmsnu4teeoxf3iydop e nvolt0tetm(rpiy1amte fvi s aDta(moot4tltoiicildls2rmn o;(4alenxr oy1opD  ueilt)setrio oy4amt lneil( artrur nu1tpeoio3ilt mDrl(mpn(0aeermf3oadfpDr ivi;s trxrxm3no1am n fcia(fsrtaum ;u1tpt ifeiltfm2ulnvo;t0 lxrir totfmte iei;s setoim iu1optn ivil()aDtau  ;u1tle moeiydls2rlnvsnu0 rtnif tadoaDrli i;(0trtr(r io1opt  ivs tf 2ta(mpnu0oeeoifcils m2rlu p;u)texoio oodfm r nes s)texmxr3iu1ame lfetat)aDuax o;t0oeeo fetlslmDulnms t4 eerir iydlpt au i;() rxo(o nodom  lnvsl(farrm(r ;o0alt  ocias m2uau pnt) ltnmrcoytoateaneol( s2xrir3nu1om   ies t  Dum(rpou0tetnmociys mDumu s;(4altrirciadlpt an s ()s2to(r3io4lmeelies tf rurur nu4aee  ieiltla eluvo;(4trerir3tytlpDr uvi t)trur(o3nydop   fvslt)aDuau  nu4tet  fcils a2emnvsnu0artoxocoytopDrai i s s2tr(m oydapen ivsa(  Dta(m ;t4oeeo feiydlaDul(mo t4 lenif3iatfmt lieo;s0 2toiopoo4ol nlnvi sf Dua(mp;u1opt  iciad a2uauvs;(4 rtoxo3tytoaDrln i t0setoxopoudalenmiesat)arumum ou1tpt iieiyd a uanmpn(0areoxr3tatlatrlu o s s2urxopno4ape  netasf 2uaur ;o0opxoio3iys a elumo;()areomrctodfmDelnei;t0trxr(o ny1lmtn nes (  rra(r ;o0oee mfctlsfs2em(mp;u4teenif3oadopteli o;s)seto(r no1lpenmivsl( sDtru  ou1oee ii3tad m uauvp;t) rerio oydop  anvs;t)t2uoim oo4am emnei (  Dtm(mpoo0olen f3tyt m2el(msnu4texomrciytlpD au s t)s2um(r no4lpt mivta()s2uaur oo1opto fetat mDum(ms;u)trtrio iotopD anesls trurxm3iudolenlnvia(fsrraxmono1altoifetlsla2rmnvo;u)tlerir3to1fmD auvs t teuoxm no1am nlfvi tfsrtr(moot4aex if3iysfs rl(ms t4 etomr3iytoaDrlivo t)teuoim iy4opt micta() rtm(m ;t4altniociadfa2uluvo t)trtrirctodomtrlivsl(0sexrxm3ou1opt mfvslsfsruauroou0tlxo fetaslmDelumo;(4tlerircoo1omt li s;()seumxm3iu1am n fcil() Drr( pno1apt if3tydlaDemump t0 eenxo todomtean i ( srumiopiudop nmfcsat)a2tm( onu0tpeomo3ils s2um(vsnt4aexoxrcoy1omt anvo t)srxoiopnudome lfcsa()srtr(m ot1aetomfetas a em(vo t0 eerxfcoydlate ies;s) etmiopiu1oleelivtlt) Dur(r ot0alen feiat m2eauvpn(4 eeomf iydlmt luvs;t  rurim3iu4lp  lneslsf Dtaxmo;o1tpxo oeiyslm eanvs u4 eenir oodopt aueo;t0truo(r3iudolenmfei t srrrumpnt1olx io3ild aDrl(ms (4alxrmr oa1fmteai slt)texm(o nydome  ivt (fsDrruro;t1aex  ictysfm umu snt4alxrxocio1omteluei ()srxrxm3iudomt  fvtl()sDrau pou0aetoii3iatfaDel( s;t)artomfcoytopDranvo;s)seumxr3no1lm  livias)aDur(  ;u4tlxnio3tad m umn s u4teenmrciotfmteln i t s2uoimpiodamt mfvta()s2tm(mooo0tlenmi3ilsfm uauvont0 exoxo oatlmtelueol(0srxm(opnodom  miesatfsDuaxr ;u1opx  i3iadlaDrau o (0tltnir3totfaDr ies t0texmxm ou4amte fci sfsDumum ;o1aeenmociyd m2rm(mpn(4 eermfciadlaDeln o;s t2umirpno4apen fetls)arurx pot0aleoii3ils a rm(vp;(4artnio oo1la  au o t0 etrxo iydlmtnlivi ()aDum(ronu4oetn o3ilt mDrm(vo t4 rxomf oodfpDeln s s)teuo(mpno4op n fvtatf rtmx pot4oee mocilt mDrm(mp;(0 lxrmr io1la  ai s;s0t2to(o3oodoltemfcilt) rtm( pnu4tleoio3iadfa eaump u)aetoir tydla eauei ()teur(rpoo4amtemfcsas)aDrrurp;t4opxn oeiasfa emnvpnt4 rxomrcto1oaD lnvil( texmim oodaptelncsls) 2ur(r ot0tpeo i3ias a2rlu p;u0aeenmf iydfp rlnvsl( s2xmxmpio4al nlnvias)srumxmpot0opt  octysfsDemn p (4treoxf todom  lnes t tetrxo no4ale  netl()arraxro;u0opxoioetytfsDemnvp u4 rerio iydoaDe uvi;( texm(o3no4olt lfcslt sDtrxr ;o1ale mfcias sDulu o;(4aexnxr3ty1la  lnvsl(  rtr(rpou1lmt lfctlsfsDuaumo;u0opx  fetytfa rau p (0arxnxr iy1fmt an olt)s2xo(opiodale lnetls)a2rmxrooo4tpt mf3iatlmDulnms (0tltoir ta1fmDeanvo;(0s2tmxopio4lpenlfvtat  Dtrxm nt0alt iieiysfmDrl(ms;() lxnxfcty1fmD aivs;t  rxoxo3oo4amtnmivt t  2um(  ;t0aexomictyd s ra(mo;(4 renxo iodomtelnei s seurir iu4lle lncsl(f rtrurpot1aet  ietat s emnvs t0teerif3ootlpDr ivols srxoirpiy4lme  ivsls  Drrx pnu1aee  f3ilt a2ua(ms ()alenxf iodomDrlivolt t2xrirpnu4llenmicsas s2ta(mpou1olt  ociasls uau s u4tlxnifcty1fmDe n o s0srxm(m oodlltnmivtlsfs2tr(r ou1tltnmoetatlaDem( p;u0tetrif oydfate ueo t0seurimpoudlmt lnvt s)aDrmxr ;u1tpx mo3tydls em(vonu) etrxo tydlmD  iei t0 etmxm3oo1olenlictltf Drmxm ;o4oltnifeiasfa2ea(mpnu)arerxo3tatlp e nvo;( trtm(mpiy4lmenliesls)sruax p;t1olxn ociysla eanmpn(4 lerxo3ia1omDe nei t0s2xrxrpoy4ameelfctls)a2urx ont0aet mietad m2ea(ms ()arenmrcoodfmt ln ols srxrir ou1lptn fvta(f rtrumoot0oltn icilsfm eluvo t) lxoxf3oydop ran ols) 2xoxr no4lm emnei s artm(r ;o4tlx miciat s2em( on(4artniocio1omD li olt0t2xrio iu4ll n fvi sfsDuru o;u4texoif3tys a2um(msn()arenmr oydfaD aiesl() 2tm(r3oy4om  lfcias srrr(m oo4apeomf3ils a2ea(mpnu4aetnxf tatla  aieo s) exmxr nudlpenmicia( arrmx  oo1oexomfetldfmDrl(ms;u)arenif tatfpD anvol()srxmiopno1omtemiesat aDtrxr oo4ape ifeild s2em( snt) exomrcoa1latelies t  rtr(opiudapte ivsas) 2taump;u0opeomfeilsfs2eluvsnt0trxrxr iatfm  li ilt  2xr(r3oudomeelies tfaDrruro;u0tlenifetld a ul(ms (0tleoiocoatfpteli olt0 rum(opno4ame mneil(fs2raxm ou1tee moeiatla rluvont)artrir3to1lm e uvsls0t2xoxr nydomee ncsa( srtrx  no4oltnmo3iydlm ran pnt0artrmr io1lmtr ivils trxoxopiu1lm e icia( srumx pou4tlxnioctlsfm rmump;u4trxomr3oatlatrli o;t)texmim oo4lpenlieiat aDtaxm ot4texn o3tlt m2emumonu)trxnxr3iytfm e n sls0s2xo(m iy4lmtemictls)s2rmx  ot0ale mf3iydfm eluvonu0tlxnir oo1omtrlneolt  etmxr3nu4ome mnviatf 2rr(rpnt1tpeo f3iysfa uln s;t)aetrxrcoytlm elivo (0s2um(r oy1al   nvi sfsDra(r nu4tpt io3iltfsDum(mpn(4 exrmrciadopt  i o t)trxmxopny1apenlnvt s) 2rmu poo4aetomo3tat a rlums u)tltnmf3oydfa rli o;s0 rxrio oudlptnlnvils sDtaxrp;o1tpxo octysls ea( o u4aetnmf3oytfmD li i;t0srtoxmpoy4ll e fvsl( sDurx oot1tpx mfctysfa2rm( s u4areomr3todlpteln ol(0 2xoxopno4ame  ivt t  rraurpnt1tlen feiatls2emuvp;t)tltnxfciydlpDr nei;s0 rtrio oydamen fetat)aDrr( ont0oex  feiytfa2ra( p u)trtnxfcoytfm rln s t s2umxm io4apt mneiat  rrr(mo;o4oex mo3tydfs rlnmp t0trenxr tydop eaiesl(0t2tmxopiy1lmtemfct (faDta(rpoo1aeenii3iltls2ranms u4arxnxfciy1optelu i t)s2umimpiy4ape lfvil(f rrm(rpno4optomoctysfm emumon(4artnxr iytfmtraues;s  rurxr no1olenmnetas sDur( ono1apx  i3iad a ea(vsnu4aeerxf3tatlatelnvil( sexm(o iu1omtnlics (farrmxrp;t0opt iietat m2ua(mp;(4alxnxf ty1lm rau o ( t2xm(o3oy1lltn ncsas srta(r nu0opxomfcildlm2rl( snu)tleomr3oatlm rln il()s2toxm3iy1lltemfetlsfs2uax p;t1oleoifetydfm2ua( s;t0aetnxo3ty1oa   u o;t)sexo(opoodlm n nci t a2ua(rpou4tleo i3ias sDumn snt4 ltnxfcoydop elieo s)sexm(opnudomtnmfvtls)sDra(rpnt0alx io3iysfs el(vsnt0aetrxfciydla e ivils s2tmxrpiudoptn neilt)s2umxm ;t4aexomoctatfa2emu o;u4tltoio3tytfmDelnei;(0srxoim nu1apte ictltfs2rau pnt4alxn f3ildfm el(mp;t4aetrif totomtraieo s t2tr(o3oodale mnvi t) Drrxmonu0aetnmfetldfs2em( o;t4arerircoadom e nei;s  exoxo no1ap   fciatfa2tru pnu4aleo ietydfs el(vsnu)tetoxf3oatfat anes;t)srum(o3iy1lltnmncsasf rrau ont1tlt  oeildfm um( o u4arenxo3ta1omDeaueilt) 2xmimpnu1lltnlnes () rrr(m oo4texo ieils s2emn o;t0 etrmrcoo1fmDrlivi;t s2xoxrpoy1lmen icils)sruax  no0tetomi3tas sDrmu snu4texoif iatfmDr uvi t  2toxo3iu4ope mfei (  Durxmono1texoiieiat a rlu p t4tlxrxocoodoa  luvs ( trtoimpoy4open fesa(fsDtr(rono1olxoiicild m emump t) lxrxr tatlpDeaieol() 2trimpou4olen ivt ( arum(rpot1tee  feiydls2eaums;(4teenmo oadfaD aies;t)trtm(o oodalenlietas aruru o;o0aexomieiydlm ulnvpn() eenxfciydfmt au i s0srxoio3iu4apenlnci sfsrurxr ;t1opt iictytfa2ulums (0 lxrmfcootfmt  uvo;s0s2xo(rpnu1llen ncs s)aDtr(r ;u4tlxomoeiasfaDumuvo;(4arenmoctydlmDr ivo t t2uoxmpny1olt  fesas) rtm(mpot0texo ocildfs eanms (0 eeomr iy1fpD livs;s)s2toxmpio1omenlfvtlt) 2ra(rpou1oetn octadls2ea(mo u4 etnxocto1oat  uvolt  rtrxo3oy1ol nmfciasf rum(mpno1openmiciyd aDem( s;t)aetrmfcoodla rln ilt  2ur(mpiy1amt  ict t)sruaum ;u0apx  f3tydls2ua(mo;u) lxnxfciotfm elivsl()trumxo oydom emivs sf rrrxmoou0oetn ieiytfsDrmn o u4 leoxo iatopDr ieilt) 2trimpnodlmt lics sf rua(mo;t0ale  iciytfaDemuvo;u) rxrmo3oodfaD an il(0tetoxm3iydlp n fvs tfs2raxmpoo0tlxo ieiasla2uauvp ()tlenxr3totoptrln o;t) exoxopny1ope lneia( arta(mpno0texoio3iasfs2rmnmp (0tlermr3to1oa eauvol() rur(opiodlltemies (fs2uau o;t4aptoif3iatfsDemnvs;u0 lxomr3tatfa   nvols0teuoir no1ameemfvia( artaumpnu1teenmf3ils m2em(vpn(0tlenxr3tadlateaieo;s)t2trxrpoydop nlnvs (farra(r ;u4apeo i3ilsfmDrmump;()aetrirciy1la   ivsls  2umxrpiy1lmenlfcs (faDuax p;o1oetn o3tytlmDem(mo u0 exrio3io1fmD li i t0 etoxr3iydamen fvtls) 2tr(r ;o1tee  fciatls rl(vpn(4tetoio3iotfmD  i ilt0srxm(r iu4apt  icilt)s2umxr ;o1apenmictldlm rm(ms;t0altnxocoadfm e nvs ()texm(o3oydopeeliviatfa2tax  oo0aleniieiyd sDrm(mo;(4 reoxfctytlmt an ils)tetoir nudope  nvs t) 2rm(rpot1tlt  o3ildlm2ra(vp;t)arxoxfcia1fm e n s;( sexoxopnydop  lnesa() 2uax oou1opxo ieilt a2ul(ms u0aleomocoytlmtrlueo s0seur(o3ny4al nlncia(fs2tru o;t4tetomfciydfm em(vp;t)altoirciatfaDraneils)texm(mpoodom emies (faDrr(m oo4openmfcilsla uanvp () lxnircoytlp rlnvo s)setm(m3io1lpeemieilt)arrrumo;o4aetomoeilsla2elnvs u4trxoio3oy1fpDr ivslt0srxoiopnudame  ivs (fsDtrump;t1aetnmoctydfsDumu s (0 etrirciatfat  i olt s2xmir3ny1alenlnvias s2rm( pot1aexnmocilsfa2eluvsn() lxoifciydomtelues;s0 ruo(o3no4lmtnmivsls)s2rrxro;o0tlt ifeiasla2ranvs (4artrmf oo1laDraivils0 exrxopoodapeelfvi t)sDrm( pnt1ope  o3iasfs2umnmsnt)tleoio3tadlat  nes s0trxrxr3oodal nmnesat sDta(rpot0oex  i3tytlaDul( ont4 exoir oodlpt au o t)trxmim3io1ameelfvs t  rumuro;u1teenmictls m2uaumonu)aeeoio oodlaD aneo ()t2tr(o3ou1apenmivsasfsDrm(  ;u0tlxoiocilt sDulumpnt) rxrio3iadla  aiei;t0trur(mpiu4lp   ivsl(fs2tmxronu1tlxo f3ilslsDelu p (0trtomo tytfmDraivils0trxoio ou4lptelncil(fa2umxm ;u0opto o3iytls2rm(mpn(4 etomf iydoat lieo;(  2tmim iy4lptnlici s s2raxr oo1olx ioctys m2umumo;u4 etrmfctatfatr ueo;(0 2trirpou4ol  lnvs s a2tmu  no0aetn fetysfs ra(vo;t0 exrxr3oatom ranes;s)setmxr oydaptn ietlt  Drmurono4opxnifciys m uanms;t0aexrxo3io1fmt luvo;( sexrxopoydlmenmnctl( aDtru  ;o0ope  feils a2ran p;()tetnxfciotoateli i;t  eto(mpnu1optn icilt a2rrum ;u0ale  ieiltfm ea( s u0tetoxf iydfateluvolt0teumiopou1lmtnlneia(f rraumono0alenmfeildla2em( pn(4aexnmo3iodfa rlneolt)s2uoirpny4lltelivs t) rta( pnu4teen f3iysfs emuvonu0 exnif3ootomDr uvs;t)setmxm nudlpenlncsa( sDumuronu4olx ifeias mDem(mp;u0 rxrmo3tytopDe nvo t teuo(o3ny4ap nmfeias)s2uaurpot1aexoiocildlaDemu s t4 rtnxocoodfpDrln olt0srxrio3ny1aptemnetas)s2rmx  no4aexnii3ildfa2ea(mo t0artnmf iy1fpt  u o t0srxrimpnu4opeelfvs tfa2rmu  nu0aeto o3ias s2raumpnu4 lenmfciodlm rluvo t t2tmimpiodopee iesls)sDrm(m ;t1openmietyd m ea(vo u4areoxo3to1fatr n i;t tetmxo oodomtemicias aDtmumpno1aptomoeilslsDuan onu) lxoir3iy1om eauvo;(0srxm(o3nu1omt  nctl(f 2rmxrp;u0tpxnifeiat a umnvs;u)artnxo3tydfm raies;(0 rxmxrpnu4op n fci ( sruauront1apenmoetldfa eau p u4aexoxf iydlp ean s s sexr(m nydam e fes (f Dtax o;u0aetnmfciadfm elnmsn(0 rtrxo3tytomt aivils0setmxopoodalt lictlt)sDumx  no0aexn octys sDua(mo;t) ltrio3iotomDrln sls0 euo(o3ny1omtemfvtlt  Drm( poo0tptnmo3iysfs ra(vo (4trenmrciodomteai i (  rurxopno1lmeelfcs ()s2rrxroou4tlt mfetls a rlumon(0aexnmr tatoatr i o;( teuo(rpoudlpen nvsasfaDuax onu4aetoifciatlm2em(vs u4 leomfcoydlmDrlneslt)trur(rpoydlp  mnvsatfa2rmu pou4oexnmi3tldfa2eauvp;()arxriociodfmDrauei s0t2xr(opny4ll nmfeil() Drmu pot0oltnmf3iltfs ulu pnt4 rxnmfctotla eanvs;t srtm(rpiu1ope  nctlt artmurp;o0opt mf3iatfsDrmu ont)tltrmo ty1om  lnvs;t) etrxo ou4olt mnvils) 2trx  ;u0tpe  o3iadfaDemumo;()tetnxr3totfa  lueo;( seurir nodolte nvtas)a2ra(mooo0ole ioetytla emu s;()tetnioctodlmDranvi;s)s2tmir ou1omte ieiat) 2rmxmp;u0oexnif3iltfm2eanmpnu0tetrmo3tytfm raieilt) ruoimpno4lpe lfetl( s2umu  nt4alt ifeildfa2uanmo;t4 lerifcta1fmD luvo;t trtr(o no1lltelfcslt s2urxmont4ope mociatfsDrlnvo t4aleoxr tytlm raieilt) 2xmim no4lm n ivslt)artr(m ;u4opx ioeiasla2ea( p t) exriociydlmDe ieils trtrim3io1opt mfvils)a2trx o;o1teeniictasfm rmuvo t) lerxo ty1fp eaieo;t0 2tmxm nu4om e ncsa()s2umxm nu0alx mf3tltls rmuvo (0tlxrir3iydomD  n ol( trurirpoy1op   ict t) Dtrx  no1ale  ictysfs2ra(vpnu4 lxomr3tatfp eauvo;s  etmir nu4op e ictlt  rum(  nt0tpeo iciatfa2rmnvonu)trenir3oy1fm r ivs s) etoir3oy4om n fvtlsf rumu  ot0oetoifcilt mDemu o;u)tltrir oo1fmtelues (0s2xmimpiy4ol   ieil(  Dum(mpnu1tetnmiciys s rl(vs u4trtrmo3ia1omDe ivslt  rur(r3oudol  livtl( aDrax pnu1olx io3iydla emnvpnt4 rermoctatoatr uvol(0trurxmpoo1optemicsas artaxr ;o4aptn ocilsla2ulnvo u4treoio3iodlp  aivols)s2xriopiy4lp  mies ()arrr(r oo1olto i3ildlm2uluvs;u4aexoxo ty1opteauei s srtrxmpnydap   ietls) rum(mpou1teen i3tlsls2um(vs t0 rtnio3oadfpDr ieolt teur(mpny1lm  mfcs sf 2ra(rpnu0oexomi3iydlmDumums t)texnmfciatfa eln sl(0 etr(r3oo4olt mfcias  Duaxrono1oetn ocildlm2umnms t4trtnxr todfpD an il( t2uoimpoudllen ies ()a2ta(ront0aex iicias m emnmo (4areniocto1lm ranvs t)t2toxm oy1alte fvi s)a2um(m ot0teeomfctltfmDul( p;()treoxr ta1opt  nesls0truo(r3nu4am elneias s2uaumpnu0apto feiltlsDelumsnu0aeerxocoy1faD  neils)tetoxm iu4amenlicsasfa2rr(ro;t4tpeo ictys m umnvs u4trxnmr iy1oa r n sl( srtrxr3iy4oleemictas)srtm( oot4aex ifetad sDemnmon(0 rtnmoctatomtr ueo s  eurxrpiudlltemnesa()a2uaumo;o4ale io3iatfmDra(vp t)aexoxf3totlptean i t s2tm(m iodapenmicslt arraxr ;u0alto fetysfsDuaumsnu)trxnxr oa1omDr uvi t)trtoxopiydapenmnvslsf 2uru oou4alx  icilsla2umumpn(4arxrxf io1om  ai ol(0trxoxo ny1ole livsat aDtm(rpot0oexomietad s2rln p;u)teeoif tatopDrauvils tetoim3ny1amenmfcs s)srtaxrooo1alx mfcilsla2rlnvonu4 lxnxo totlaDrln sl( t2xm(rpny1ale miesltfarua(  ot0teenii3tat m uauvp;u4trxoxo tytoa r ues;t) exrxopio4am nmnvsat)s2tru pnu4optomfciadlm2uanvonu0teenio3ta1la raieo;() ruoir iy4ape  ncsa(fs2urxrooo1tltnmociltlaDrln s;u0altnxrciadlp  aiei;s)t2xoxm3no4lp e fvtl()a2raur ;o0oet miciyd s2uln p;t) eerxo iotlptr ueslt0s2xm(o nudom nmfvi t aDrmx oot1texo ociydfsDemnmonu4tlxrxrctodla rauvi t)srtmim iodam nlnvilt aDraxr ou1alen octydfmDulu pnt)artrxrcoadoa rai i s0 2umxrpiydlmtelncsat  rtm( p;t0olx  ietlsfaDrlu o t) ltnmoctotlpt lieo ( s2uoir ou4om elneil(  Dtmurpou1tltnifeiaslsDuln p ()arermf ty1late uvo;s)s2xmxopiydlm elnei t)aDrmurooo4olx  feilsfsDea( pnu)trxnxo iadfmtrln i;s)s2xr(mpio4opt  ietl(f 2trum ot0texomoctlslsDra(vp;t)trermf3ta1fm   uvi;(0 2xoio3oo4op n ieil( sDtrx pnt1olt  o3ias m2elu o;t4arxoxfctodfaDraivi s0 2ur(r3ou1altnlncsas)srtau  no0opt iiciyt m eluvo;t4trtrxfcty1fat  ivi;(0setmio nudlm e fcias)s2rau onu0tlxomoeiadfmDemumsnu0 lermf tytfa eauvo t trtrxmpio4opeelfesas  2rm(rooo0opxnio3ilt aDemn p u4areoiocty1oate ueo;( truoimpoo1opt lncs s) rtrumont4aeto o3ils a2eanmp t)trenifctytfm eluvs t s2trxmpoodlltn fvtat) Drau  no4tle mo3ild aDeln o;() ltrif totfmt lueslt0srxoxrpno1ole  nvt t  Dtmum nu4texomfctyt sDul( p;u) ltrif iadfaD  uvsls)trtmio iy1lmt lfcs s) rtrxmpot0aexoiiciad a2rl(mont4arxrxr3oatomDrai ol() 2tr(o iudaltnmics t) rtr( o;t4oltoiictltfa ua( p u0 eerir3ia1fa r u o;(0s2to(mpnu4openmfvilsfsrur(m ;t0teen o3ilsfmDrlu s;u0tltrir3oa1lp  lnvo () rtr(rpno1ape mfetas srumurpnu4aet mi3iat sDeanmp ()artrif3io1fmD  ies;s0seum(m3ny1lp nlfcta(fs2trxrpou1tltnio3iydlm rl(mp;u4texoxo3iotlaD  uvs;s)srxm(m3oy4lp elfvsl( arrmxro;o4tpenmoeiadfa2em(vo t)aexrxo ia1oaDean i s)texmxmpiodopeelnct sfsrua(root4apto f3tat m ulu o u4alxoioctytomtr n i;s) eum(opny1om  mies s arrr(ro;u1apenmfciydfaDrl( s;u) etnxocoodfptrlu sl() 2toim3nydlltelnvsa()artr(mo;u4olxnifciaslsDemnvp;(0aexnmociy1fp   neilt0 rxm(rpiudom e fcilsf 2umu  ot1tptomf3iadlaDrmnvon(4aexoif iydlaDrln i t) 2umio3io4ap  mnciatfsDrmxr nu0olt mo3tld sDum(vpnu0alerif3io1la r nes;t s2trirpnu1lpenlfvtls)sDra(mpot1opxomieiytfsDrm( o;u4 lxoircoo1oa elivo s0t2xoxrpiydopenlnvt t) 2taurpnu0opeoifeilsfa2ua(vp;u4areoxr3oydfaD li s;s)setoxr nu4lmeemiet sfsDtrump;o4oetnmictytlaDra(ms;(4 ltnmr oydlpDrlivs s  2um(r3ny1olte fetat)artr(mpnt4opeoiieiyd m emu o t4altnifciy1op  ln i () 2uo(r iudlm   nci t  rraxm ot4aex mf3iys a2el(mp;u)tlxnif oytoaD ln slt)srum(r3oy1omt lfvtlsf 2rax p;u1apxn ictasla2um( o u4teerxfciotlm e i o s0s2tmxm3io1lpte fcsl(fsDrrxronu1tpeo oetasls2ulnvs;u4tetnxfctytop elnvi;s0teur(o no1al elfcs (  2taur nu1opt if3iasls2uanmo;t4 reoio to1lp  anvo;t sexrir oudame lfvt (f rrrxr oo4teen icilsfsDum(mon(0 exrmr3oytlmD lueslt0 rxm(mpio1lme  feilt) Durxm oo4oeeoiiciltlmDeaump u) ltomo3tadfate ueo;t0teuoxo3nu4lle mnvt (  2tmur ou1olxomieiyt s ulnvs;(0areoif io1lmD  uvols)srumio3oo4lpenmfvt t s2urxmo;u4tltoii3iytlsDua( pnt0tltoio3ta1oa elnesl(0s2tm(o3ny1lltnlicils) 2taxrono4apx mfetyslaDrmu o (4trtrmr3iytlatr nvilt srumxr3oo4ll e iesls sDtaurp;u0olxn f3iad a rmnvp;()texnmf iadoateai i;(0 ruoim3iudol  lietat s2rru  ou4tltoiietatfsDrm(mp;u4trxomr ia1fmD aieol()srur(o3iy4ome mnetatfa2rmxm nt4opeo ociad a2eln s u) ltnio oy1omt luvs t  exmxopio4aptnmnci t aDua(rpnt0alx  octlt sDemumpnu) eermf3to1lmD anvi t)sexriopoo1lm nmfet (  2urxrpou1tet if3iadlsDrmumo;t0altnmf3iydfm eaiei;(0tetm(mpiu4ol e nvsat)aruax p;t0aee  i3iadlsDeln p t)alermr ootlmDr i i () rxo(o iodamenmnvsasf Dumxmp;t1altomfctlsfs rluvon()tlxomr todfa eluvil(  2to(m ou4al   ieta( sDum(r ;t0apen i3ilsfmDua( p ()tltomr3io1lm  lu o;(  2trxm oy1ol  lfvilt s2umu pnu0tpx mf3iyslm em(msnu4 rerxf tatlm r n o;s teurxo nodopt  ivils s2raxmont0oeenmf3tatla ulnvo u)aexoxrctadopt au o;t) rtrir3ny1opte icia(f Drmx o;u0opxoiictydlaDem(vo;u)alenxo ty1fp   ivo t0srtoxmpio1lme miei s)a2rau onu0aexo oeias a emnvont4 leoxr3ia1lm   u ol( seumirpnydopenmfvtltfs2umumpnu4tle  iciyt a ranmo t4tlerxf ta1fa ran o;() eurxr io4lmtnmfvs s srtmx pou0oexnii3iat a ul(mo t)arxnxo3tatlaDran i;(0t2ur(opnu1ll e iesl()aDtm( pnt4oet  fciyt mDea(mo t)arxnir oytoateai o s t2um(opnodop nmncsatfsDrrumoou0optomf3ild aDumums;(0tlerirctodlaDe ueol()truo(m ou4lme lfetl()s2ra(r ;u1opeoio3tldls2el(vp t0 lxrxf3ootlp r iesl( s2urim3ou4lpt livta(  Drr(m nu1tpxoii3iytls rln onu4texoir iadoaD anvs s) exmir no1om  micsa()aDraur oo1aeeo o3tas mDrl(vp (4 exrircoodop rlu o s) rtoim3iudam n fvilsfaDumuronu0olxn ociydla2rlumo;u)arxoxr3ia1la eauvs t0trtmxm iodope liesas s2tr(mpno1tpx miciadla rlu p (4texrxf3oytfmteaneo s texoxo iydoltemieias)s2ta( ono0ape io3iltfs rmu snt4 etnmo3to1la  luei;t  rtmxm ny1oleelneiat  2rax ont0apeoiicilslm ra(vo;u) rtomfcio1lm   ivo ()t2trirpny4altnmivi ( sDra(rooo1alenmi3ildlaDrmnms;(4 rtomf3oatfp rlnvol(0 rtmxo oo4oltnmnvia(f rururpot0alxnii3tasfm2rauvp () lxoio io1omD aivi;t0trxrxrpoydlme  ivi sfs2ua( ont0opx  fetlt sDrm( o;(4tlerxocto1oa  liei;()teumiopoo1amtnmfvil()s2urur ;t4tpxoiietatfm2emn p;u0 rxnxrciytfaDelueols)setmxr iu4ame  neta(f 2rr(rp;o4ape  o3iyt m rlnmpn(4trtnmocoodlmDr i i ( srtrio nydamtn fvilt)a2tax pot4aeeomfciad sDelnmpn()areoio3oy1fate uvs ( t2xoir3ny1opt  feias  Drr(mpoo1apx mictasla el( sn(4tlerio3io1faDrau s t)s2xo(r no4op elfcils)a2urxr nu1open ieiadlm2rlu o t4alenxo3oydfptrauei;t0srtr(m oodom nmncs tfsrua(  ot0texn ociydfa emnmo t4tetrxo3oo1fm   nes s sexrxmpny4apenlicilt)s2umxmoou1opt mf3iys m elums;(4altrmr3oatla r nei t) eto(m3iy4lpe  nvia( a2ta(mpnt4opxnifeias a em(vpnt)aexnircio1latrau i;s0trtmxo3nu4amenlneia( aDtmur ou4tlt io3iadfm um(vp u0aeermo iodfmteln i;t  2urxm3oodamt mfvtlt)aDum(ro;u0apen icilsfa2emnvp (0trxrxf3oatlp eauvol(  eurirpnu1lle lncsa()aDrmurpoo0oeeoioeiasla uanmont0artoir3oatfptr ivi ()srur(r oudlme mnviltf rur(mont4open o3tyt a ulu o;t) eerifcoo1fpteaivi t srxrxr3iudamt lfvi t)a2taxmo;u0olx  i3tasfa2rmnmpnu4 lxrmo ta1fp   nvo;()teurxo iy4lptemnei sfa2tru  nu0tet ii3ildla ra(ms;()altoir3iy1faDr ieol() etmxo3iy1lpen icilt  rtrur ;t1aexo fetlsls2rmnms;t0arenifcia1fpDeanes s0 etrim3iy1omt lnci s) 2ur(mooo4opt  i3tltfsDulu pn()alxoif iatlaD aueo;t0 rtmiopnu1am   fes t  Dtmxmpot0oex mfetad mDranmp (4treoxo3tadfpt  neo;t  rurir io1llt lnei t) Dtrx  nt4oeeo i3iat sDuanvp u4 eermoctotla eli i;s) ruo(o3iy1alte ieias)sDtmum ;u4olx  ictysfmDumumo (0 rxnmo iadoat lu ils trxrim3nudom n ivtat)sDur( p;o0tetomoetadlaDumuvo u4 eenxo3oa1laDrli sls0texmxopno1amtnlieia(f Dur( pot4optnmoctldfm umnvsnu0texnmf3oodfp  lu il( sexoxm3iy1apeemfei tfa2umurono0oet moeiatlm rau o;()tetomf3tytfp raies;s srtmxm oydaltnlfes s)arumum nt1altnmiciysfs2ra( p;(0 ltomf3ia1fm e ivi;(0 exoxo3oo1lp elieias  2trxmpoo4oet  f3tldfsDuanmp t0areoxfcoydoaD aues;s)s2umiopoodam nmfcsas)sDra( pot4olen ietyslmDea( p;(0trxoir3oatop eauvs;()teuoim3iudllen fcsas aDrm(r ot0opxomo3tydfaDea(ms;u)trenmf3tadopt aiesl(0t2xrxm no1ll e neia()s2rmumpoo4alxoiiciyd a2elu pn(0 rxrmf3oo1lp ran i s) rtmimpno4ol elivi sfartr( pou1tetnii3iasfs el(vs;u)trxoxfcoa1lp ranvil(0trurirpio4opee nvsasfsDta(moot1alt mietltlaDuanvo;u0 rxnifciadlm e ivslt setoio3oydlm nlnetatfa2tr(mpnt4apen iciytfmDul( o (4artnir3iadopDe u olt0trtmxrpou4lmeemicsasfa2um(r ot0tlxo o3iadfa eanvp t0tlxnxrctatlm r nvo;s)setr(mpoo4aptnlfviltf Duau poo0tlenio3tld s em(mo t)aeeoxo tatfa r n o t0 euoir3iodomeelncta(fa2umuronu4alxnmociatfs2ul(mont0 eerio oo1lp rlivo;t)t2uoxmpiodlpeelneil() 2rr(r nu4opx io3ilsla2eau p;()tetoir3to1omD  neo;()trxo(r3io1lp nlfci (  2ra( ooo4olen i3iad mDea( s;t0trtrxo iytlaDr ueilt texr(m3oy1omt mictas)srrm(ro;o1tptomi3tlsls2emu pnu) exnxociy1lpte uei;t texm(o3ou1lmt mfviatfs2tmx pot1optomi3iytfa2elnvo;t4texnmo3oadlptr ivol( sruoxo oo1omt miet ()sDtruroot1aee io3iad mDra( o;u4aexnxo oydoptrlueils0trtmxrpiy1om nlivtat)artm(mont4opt  octad sDrluvo;u0trxoxf3oo1lmtrln o s trtm(r oo1apeelnvt sfs2trur no0tpt ioeiys mDrln s;(4teenmo3ta1laDeau i s)srtmiopiu1ol nlfcsat) 2rmxmoou4apeoioeiatlm2ranmp;u0 ltoioctodopt anei t)s2xrxmpiudlm nlfct ()aDrmur ;t4texnmi3iysfs uau p t4 etrmf3oo1oaD  uvil() eurim3oo4ap nmfetl(  Duaumo;t1tet  oeiat a um(vpnu) lxrmf3ty1om r neolt0setr(r ou1om elnei t a2trur ;u4opt  iciltfs2um( sn()altnxf oa1lpD ai o;t0seuoxopio1ol e ietls srumu ont1aetn ictlslaDrmuvo t)alxoxf ootomDelivilt trxriopoo4ape mncsls) 2rmum oo4tpx mociasfm2ua(monu)alerxf3oadfptelivo;s t2xo(r3iodomen iet t  2rmumpot4apeoioctatfa ra(msnt0arxoxf3totlp eaiei () 2xoim3oydapte iei s)sDrru onu1oee mfeiaslaDemnmo u4 rxrio iytlm eliei;s)seurim3iydlptn ncs t)srrrurooo1aeenioetatls ua( s;u4aeeoir oodfmt  ivi t) 2xmirpoy1om n fes (f 2rr(mo;o4alx  o3tadls2em(vsnu0trtrmf tatfmD lu sls t2toir iodop elnvslsf Dumx  ;o1oee iietadls eau o;t4teenmo3oatfmDrlu s ( teto(m3ou4am emfcsa(  2ta(m nu4tptn fctasla umu o u4aeeoir3iydla  aieilt0 2umir oy4aptemfcsa(faDrrxmonu0tlenmfetlsls rlums t0altrxr oo1fpDe n ils)t2xrim3ny4amt lfcsl()srurx onu0alt if3tatfsDeln onu0 rtnxr3oydlmDe n i;t trurio oydalee nvs sfa2urx p;t1tptn i3iat mDum( snt0 rxnxf3to1fmDe ueol( trtmxo3iu4ll nlfvtl(faDtr(ro;o4oleomi3iadfm umn p t0tetrxfciatoa r nvsl(0t2tr(o no1op nlfviat s2rr(m nu4optnif3iyt a el(ms (0 exoxf3ia1fm   ivi;t srtoir oy1ame liesasf rurxrp;t0optomoetlslm2rmn ont0 etnxocoa1optelnvo s) euoimpiu1ol e fvtls artrurooo1oleomieiydfa2emn p t0 lxnxo to1lp elnvs;s seur(r no4ol emfctasf 2um(ro;t0tpe  ociadfm2eanms;t4tlxnmr todfpDraiei s)srumirpoudlmtnmieslsfsrumurpot4alen ietyt aDrau pnt4areoxr tydlp   uvi s) exm(r ou1alenmiesls a2ta(rpnt0tpxn o3iadfs2uauvpnt0tltnir ty1optr ieo t) eum(m3oo4ll nmfeta(fa2rmumpnu4apen f3tytfa elnmont)tlermrctadopte nes;t  eumxr nydlmt  nctat)aDtaurono1tltnio3iydlmDumu pnt0treoxfctydomtr n s;s0srxmim oo4lpt lnvtatfsDtrx  ot0apt mi3tasfm2rmnms t) exoxr oytlmt  nvs;(0t2to(mpoo4omte icsat) 2um( p;t4apeo ieilsls2um(msnu)areomocoy1lpDr uesls0texrxo3nu1op  licia( a2rau pno0tleo feiatlm2uaump;(0trtomo iadoa   uvo;t s2xr(o3iu4lm   fes tfa2ta(  ou1tpen fciadfm2umuvp;t4artnio3iatfa   ues s truo(mpiy4ome mncsas aruru o;o0tpxn oeiydla2ul(vp (4aetoir oydlpte u sl()s2uo(o no4oltemieilt)sDurx p;o0aetnio3tyd m uln p;()aexnxfcoadfptrauvs t0s2tm(m oydlp nlncslt aDuaxm ou1oltnmociyt mDean p;t4 rtnmf3iodopDr nei;( s2tr(mpiu4ol   fvtls sDrmxmpno0oee  fciydfmDel(mp;u0altoxr to1lm  auvils0 rtrim nudoptnmnvt t  rumur ;t1alx iocilsla2ua(ms t4altrxo ty1oaDr nvo;t t2uoio3no4lltnlncs s  rtax pno4alt mfcild aDemnms;()texnmo oa1lmt ln sls)trtrir3iydap e ietas aDumu  ;t0tpenmictyt a rlnvsnt0 lenir iodopD au s;( truoirpoodop nmfesat  2tmumooo0oltoifeiadfa emnmp u0 rermo3io1lmtrauvolt srurxmpoo4al n ivsasf 2rmx onu0opeoio3tldla umump;u)aetomf totlateaivsls srxmio ny1om elfvia( srururoot1apenii3tydlsDuauvo ()alxnmr tydlmtr uei;s0t2xo(o oudllen icsl(f 2rmx pou1alt iietatlm ea(mpnt) ltnmo iodoptr nvs t)s2to(mpoy4lmtnmncsl(  2rru  ot1aex mf3ildlm2ea(vo;(0tetomfcoadfptr u s s0 2xoxm io4lpeelfeiatf 2tauroot1tee ifeiyt sDranvp u)alenmrciydomDrln o;( srtoxmpou1lptnmncilsfarum(mooo4tlen f3tysfm rmumpn(4altoifcoatfm  ln s;t0t2tmxopoy1apenmietlt srurx o;t1apenmiciys sDel(mo t4altrxr3oo1oaDelnvo t  rurir3iu4ome  ieia(fartm(m ou4tle mf3tydlmDeau p u0alenmfcootfm rlnvsls0t2uoxmpnydlpt  ncsls  2taumo;o1optn feiyt sDeau p u)trxoxocoadfpt au s;(0seto(opoy4om e ics (f Duaxr ;u1aleo oeiydfm rmnvsnu0trxoxrciytlmt aueolt  rtm(mpoydlp  mici s  2tmxmont1tle ioeias s um(mont)altrxr3iadlmDeluei ()seuoxrpnydoptelnvtasfs2trx o;t1olx iiciad aDum( s;(0tleomf3ta1opDranei;()sexo(rpnydlm n nct (  2ta(r ot4ale  i3iyslmDum(msnt)arxrif3iatfatelivilt s2uoio3oudlpt lnetat) Durxrp;u4olx moeilt s2um(vsn(0 etrxr ootlate u o (0t2xoxrpoo1apeelfeil() 2ta(moou4opt  fcilt m2ra(mp (4treoxr oydfaDr iesls)seur(o iodal n fvsat)aDtmx poo1oeeo f3iadfa eanvsnu0alxoxr tatlaD  u sl(  ruoxr3iu1oltelfeiasfaruaxmono1tetnioeildlsDemu s;u4arerxocoodom elu ol()sexmxm oy1amen neilt)arur(m nu4tpxoifeilslmDuanvs t4tltnmocoo1op  an s;t) 2toimpoydal  mnci sfaDtr( pno0teen o3ias mDemnvs u4arerxf3ty1late n i (0s2xmxm nu1lltn fei t  Dta(r ot1opxn i3ias a ranmo (0 etnmf iy1latraivilt)trxrir ny1olen ivtat srtaurp;t1oexniietatfm elu p t4tltnif3oo1lpD aivslt0 rtoim3ou4ll nmfesltfaDtru  no0apxo ocilslm ulnmpnu0alenmrcio1fm raneils  2urio3io4ope  fvsl()aDtaxrono1apt mfciyt s2rm(vp;t0 rxoxo3oa1lptraivsls  exo(r ny4lleelieiatfsrua(r no0oetn f3ilsfa ran o u0artnmf3tatop   i s t)t2xriopio4lp e nciatf Dua(m ;t4apeoioetatls2rmump;()aexnxociytlat  u s;( sruoxo3iy4open icias  2rmxro;t4tlxniictltls2el(mo t)texoxocoa1opD aneil( teuoxm3nydop n ivsl( aDrmx  oo0altnio3iatlmDeln o (0 renxo oydfm e uvi t0 rxr(o3nu1lm  mncsas)a2ua( o;t1aexoii3iasls umuvp t0aeerxfcoatoateai o;s  2tr(opno4al e netltf Drrum nt0tpx  ieiat m2eau s t4 reoif io1op  an olt)sexrxr io1lm e fctlt)arumu  no0aeeoii3ils m2eauvpn(0aeenxfctytlpD  i o () exrim iu1lme mnvs t) Dumxmo;t0olxnmi3iyd a2ul(von(4tetnxr3io1lmtr nei (  etoxm no1lp nlfesa(fsrumuronu0aexomi3tasfmDul( on(4 eeoir iadfmt ai o (0 exoio iy1llt mfetatfa2ta(  nt0tlenioctydls el(mpn(4artnxo3tydfpD  i o s trtoxmpiydlltnlncsl(fs2umuront0ape iiciyt m2ul(vo;u)treoio tatomDeluvi;s) 2umim oodlp nlneilt a2raur ot1oex mo3iadla rmnmp;(0trerir3oodop  auvi t0sexm(o iudap e ies s) 2rmuro;o4aetoif3ildfmDeau s t4trxnxo iytfmD  nesls)s2tr(o no4oleelfciasfs2uaurooo4apxniociyslsDea(monu0alxomo3oytlmDe uvol( t2trio3iy1lme  ictlsfsDrm(  ;o1aleomo3ilslm2ua( s;t0aetnmfctydfmDr nes t s2tmiopiodopen nct tfsDurum oo1oleniieildfs el(vonu0 rtnirctytlpDrlnvs s setoir iudlpt lies ( a2truroot4aexniieiyd a2rlu snu4teerio oa1fa   ueols0s2tr(opnu1ol   iciat artmumpot4aetn fctltls2umnmonu4alxoio3tatfmt  i olt0 exoxr oy1am  lfvi t  rraurp;u0oet iietydfmDua(vo u0treniociydlp  aivi t  exrim iy4ameemivtat) 2urx oou4altn iciyt a2rlu o;t0arxoxo tadomDeli ols)t2xrxm iy4ll e fvsat aDtaur ou1tle moctltls2uau snt0 leoxf ootopteauvs;(  eur(m3oo1lmee icsas) 2raxmo;u0alxnmi3ils m2uaums;u4teerifcta1lmDraivsls0 rurirpnu4ap emfes s) rrr(root1tetoifctltfa2emuvs;t)aetnmo3oadlmt ln olt)srxoxr ou4am e iesls)srta(  ;t4alt ifcilslsDrmn p t0aeenxfcto1optraneo (0seumimpoo1amtnlict sf Dtm(r nu1oleo ietltfs rmuvs;()tetnirctytopDraues;( t2tr(opou4amtelnct (  rua( oot1aleomociadlm emn o;t4 rxrifciy1oat anvs () ruoxo3iu4oltemneils s2trx p;t1aeeo fctys m rmu snu4tltnmf3oydlaDrlivi;t t2tmxm3nu1oltn fvsl(fsrururpnt1apt miciltfs2umn o u4 ltnxfcoadoaDrluesl() 2trim nodoleemici sfa2uau p;o0aexn ieiasla umnvo t) eeoxf io1fatean ols)t2umimpio4ole mneia( s2urxrpnt1aeen fcildfs rlnmp u)arxrio3iodlp e ueo s  rum(mpiydlmt  fvtasfsDtr( poo4opeo iciysfm2um( snt4 lxrmocoatlpD lu i;(0s2xm(o3ou4opeelnvtat)artrumono4alx iociltfs2umnvo t)texnif tadlpteluvol(0sexr(rpnudllt lnctatfa2rax  ;t4aptn ieiltla2uanvs;(4 rtrmr iy1fpDrlnei;t  rum(o iydllenlfvtlsfs2urxmo;u0apenif3iltfa2rlu o;u0artrxo3iy1fptr ivo;s)trtoxopnu1amt  feiat)s2tmxronu0aexn fctatfmDrmuvon(4aetoxf3oytlmDeluvo;t  rurimpiy4ll  lfvi t)sDtmx ont1ape iietlt mDel(mo;t0 etrmo3iotopD  nes;( t2urxr iodaltemfct ( artmxrpnu0aetoifcilt s ea( ont4areomfctodoptrauei s0 2urirpiu1ale mfvi t  2umumo;t4texo i3iadla2eanvs;(4alxrmr tadom eli slt) 2uoxopiudop elnvia()srua( pou1oexoifciasfa2rau s (4alxrif iydlmDeln ols)trtmir iu1alee ici s artaxmpnt1oee iictlslm ulnmo;()aeeomocio1optranvi s)t2umir3oodaltelicil()aDta(mpot0oetnifciys m2umuvp;u) rxrxo3iotlp elivils0 exoim3nu1om n ics t) 2uaxrono1altnioetlslmDra( pnt4tltnxo3todlpDeln i;( t2toiopny1lptnmnctlsfa2tm(ro;o0texo ietlsls ran s ()aexoifcoytfat  nes t0trxriopoy1lm n ivtasfsDuru p;o1tltnif3iytls2rl( snt0 exnmfcto1oat lu i;()teumxo3no4ll e nesas)a2ra(m ot4apeoii3ilsfa ul(ms (4tlxrxo oytopDe neil(0 rurxo3iy4oleelictl(fa2ur(rp;t0oeenmo3tltfs2rm(mp;u) rtnmr totfat lieo s trxo(r3iu1altemiesa()s2uaum nu0apeo oeild s uanvs ()trtnmo3io1opDrlu s;s  rtmim3iu1op elfcsa(  2urxmpnu1aptn oeiydfa rln s t4 exoxf3tytfatrauvi;s0trxm(opiydopt livt s)aDum(mooo0ole iicilt mDum( s t)trtrxf todla raieo s seurio3iy1omte fes (f 2um(moou4oee moeilt s umuvo () ltomfcto1oa  lies;(0 euoir3nu4amenmfcia(f 2rm(root4ole ifciyt a um( o;t4alermf ia1oa eauvils0teum(o io1amtn nvias a2uaurpot0olxnmieiadfmDul(ms;(4arerif3tydop eanvols)srxmxm iy1lp   ictltfa2uaxrp;o0tltniociydlmDuauvon(4trtrmo3iatlmtr i ils)t2umxmpiydape micsls) Dtrumonu1tpx moeilsfs2eanvon(0texomr3oydfm  aneols trtmxm iudalte ivs tfsDtr(r ;o1ale iociyslsDulump u4artoir3iy1opDran o;s seuoirpiu4optn ivtasfaDtr(m no0tptnmietad s2eluvsn()alenmr ta1lm   nvil(  eum(r iy4alt  icia(faDrax p;o1optnifctltlaDelu p;u4 renifcoa1oa e nvs ()tetoir io1am emfvt sfa2rru pou0oee if3tlsfsDeln s u)tleomo iatlp   u o ( t2xoio3ou1optn fcslt  Durur nt0tltnmociyt a raums;(4 rtomr oadoa   i sl(0setoxr3io4omee ivsl()aDtm(mono4oexoio3iyt s ua(vp;() etnxrcoadfmDelieo;s)sexoxmpny1ll   ietlt) rtrumpoo1tlen ictls aDrl( o u0artnir oadlaDeln s;t srtmxopny4alenlnei sfs2rrx  nu0aexoiicils s uaump (0tlerio io1fp eliesls)s2uoxopnu1lm   ieta(  rtrx pno4olx moctlsfmDra(mpn(0tltnxr io1faD lnvs;s  rtm(m3oy4olt  ncsatf Dua(rpno4optoioeiyd s em(vs;t0tetoxf ty1opD lueo s  etrxr nu1op  mncsltfa2ur(rpoo1altnif3tadla2umnvonu4 rtoir3oa1om r ueo t0srtm(m oydlm  lnvtl( sDraurpot1teenmf3iyt mDrmnmon()altrxr todoateanvo;(  exrxm no1open nci sfarumurpou0tet mi3ildlmDul( o;u0aexrxocoodop  aivo;(0srtr(r nu1lmtnmnesas)arumxr nu0aeeoio3ias s rl( p;(0altomf3oatlptr uei s0srurirpnudop nmnvs (fa2tax  ot0apx mi3tldfa2ran s;t0 leoxo totlmt  i o t)setrimpiy1oleemict () ruaxm nu1tetn o3tydla2umumo;t)artomo tytla eau olt setrxrpio4aptnmivs s) Dtmurpnt0aee ii3iadfm2eanvp u4texnxo iadopD auvi s0 exr(opiy1omt  feil()srur( onu1opeoifcils m ulnvo;t0aexnir iotopDr nvo s s2to(rpnu4op  lnei (fs2ra(mpot1opxnmoeiyd s2emu o u4 exoio oa1lp eluvilt)texo(o iodlpenlfet tf Dra(mo;t0alxomoctytfmDelnmo;(4alenmf3tytomDranvsl(0t2xmxo iudlmeelivsasfa2rmx  oo1alxoifcilt s2uluvs;u4 etoifciodfatr ies;t) rxoir iu1lm e neilsfa2taump;t1optnmo3iys mDulnvpnt4 ltomf3ootop e n s;s)s2trir iu1lp nlictl() rtr(rono4tetnmfetasls2ranvp (4arxoxf tytlptrauvslt  2ur(o3nu1al   fetl(f 2trum oo4olxoifetyslsDrauvs;u) renmf tytfa ran i;s  exo(r iydalte fcsasf Drm(m ot0tex mfeiltlsDrlnmo;()arenif tytlaD anvo;t0 rtmio3iy1lpe mnvsasfaDurumpoo0tle moctasls elnmp ()tleoxrctotfmt anei (  2xr(opno4ale lfvils)srrax pou4apxomictysfm eln pnu)alxnir tytopDrlnesls)srtr(m oy4omtnlneilsfaDraurp;t1opeoif3iatls2em(mo;u) rxoir ootfm rliei ()truoim iy1ame livias) 2umurpnu4tltnmf3tatla2emnvpnu0teenio ta1fmt lueo s s2umxr3iodamenlfctls) rra(  no0alxomf3tltfm2eau p u0tlxrmo3oadfp  luvs (0s2xm(o3oo1lmtemivta(fs2ur(rp;u0oexnmfeilsfm eln s (4alermociotfptrai s;() euoio oydom  lfvt t a2umurono4teeoifctyt m2ua(mo t0teenxociy1la eliesls srxrirpiy1ope mieslt)srrmu pnu0ape iociatfmDemnvsnu4 rtrxf oadfaDrli s t s2toir3iy1alee nctatf ruaxmooo1oeenmfcild mDrlump;t4arenifcoytfa rau ils s2trxm iy4al elfeil() ruaur no4olx mfeilsfaDeaumpn(0 exnmo3iadfmDelivo;(  2xrir ou1lm nlfeiatf rtrum nt0tpxo iciatfsDelums ()texrxf3tydfmtr i o t)sexoxrpiu4apeelnes s) Drax  ;o1oeeo fctasls2ua(mp t4aexnmo3iytlate n 
\ No newline at end of file
@@ -0,0 +1 @@
+u olt  exrxrpio4lpe  ivslt s2rrur nt1oexoii3tldfs em( o (4alenmf3oydfaD lies s)s2tmio nu4ol elnet ( artmx o;o4tpxo oeiys sDrmnvpn(4alerxfcta1om   ues s0seurio3iy1lmeemfvs (f rra(rpno0ape mfeils s2eln o;(4 ltnxocoadomtrlies ( srtrir3oo4lptemnci ( arrrxm ;u4tet mf3ilt s2um( p;u)aetrxo3oy1oa elivi;s0texrxo nudomtnlicsls)sDtmxmpnu1ape  ietad aDulu p;(0alenxf iotla   ueolt) eurirpoudope  ieil(faDrr( p;u1tpe ifciltla ea( p ()tetrxr to1omD  ivolt)setr(rpou4om nmfvs s  2trumpot4opxnmfeildfmDem(von(4tleoircoydfa  aieils t2umxr io1opeemfeta()sDrrumpoo0apeomo3ildla ul(vo t0trtnxr ootfaDrln i t0s2uo(mpiy4ape mivsat) Dtr( ono1tleoiieiadfm2emuvpn(0 leoifctotoa   ivi (0texm(opoy1omeelfciasf rrmumoou4tex iociyslmDul( s;u4tlerxr3oodlpDrln il(  2to(r3no1lme lfeta()aDrrum oo0tptnmoeiydfm2umuvo u)tlxomo3oydlmDrluvsls0 eum(r3oodlm  miet t) 2umurooo4tltnmfeiaslmDua( o;t0 rtnmf iotopDeaieo ()t2urir nydop  lfetl()sDtrx  oo1olx  fciyslsDuaumpnu0alxoir3iy1om  lueo s)srxoimpiy4op  mietasfa2umu ono1ope mi3iytlaDraums (4 rtrxrctytfmD anei;s s2urxr3iudlm  mieia( sDuaxmpot0alt  feiytfs umnvon(0aeenmfcoa1fp   uvo s seum(o3iudapt livsl(  2taxmp;u1apxoifeiad m2el(vp;u4artnmr totfa r ueo;t) 2xmio nydlmte nvtat)s2uau p;t4aptoifeild a raumo;u)tetnxrciy1om elnvi (0 etrxmpnydalte ncs t)sDra(m no0opx  oeiad mDum(ms ()tlxrxf tytop e nes s0 euoxr ny4opt mncs (fa2uaur nu1aeeomi3tldla2emu p u0arxrmfctatlpDe uvs s0trum(mpoy4ap elfvs sfa2tmurpnt1texn oetyt aDemnvs;u0trerif iy1omteaivi (0 2urxopiu1op n fetlt)sruaumont1oeenioctlt s rmn s t0texnxrciydlpDrluvs;t s2xmxo nu4ale  nesa( aDrr(mooo4tlen o3iatlaDul( p ()artrxr oatfaD lieolt)setoxr3ou4omte fes t a2rmx pnu1aexnifctltfsDrln snt0tetoxf oo1oa  livi;() 2urio3iudale  ivtat) Dtm( oou1tex  feiytla2emuvp;u0artoirctadfa rln i;t0 2xr(r io1lltn fvt t)srraxmo;o0oet if3tatfm2ulnvsnu0aexrio oodlmt  iei (0s2toxo3io1omtnlivsls a2um(rpnu0tpeniietldfs2el(mpnt4 lenif3iodlp e uvs;t)t2uoio3nydamee iciltf ruax oou0tlx if3iltlm2em(vpnu)tlxrmf3iadlateluvs t)t2trim oo1amtemnvsat) Drmu pou4tpx iieiasfaDelnvo u0tlxrmo iy1oa  an ol( seumxo iodape  neia()s2rm(mpno1ope  i3iat s el( pnt)tlxomr3iytfp rlivils0 2uoxopnodll n fvilt a2ta(moou0oltn octls aDrau o;u4trtomocoytfmDrlivo ( tetmxopoodlmtemietlsf Duau  no4aleo iciadfaDuluvsn(0tltoxrcoatoaDraueo;()trxoimpoo4apee ics tfs2uru o;o4tpxomietyt a ulnvonu0aexoio iotlaD lnvi (0 rtm(rpiu4llte ici t)aDumum oo0ope  octlslaDrln s;t4alxnmo tydla eai o s)seum(m io1lme lnesat) Dtr( oou1aex iieias a2uan pnu) etnio tytom  luvi s sexrxr nu1omtnlfctlsfsrrm( ono4tet ifctasfa2em(vo;u4teerxr iotlmt lnei ( srurio3iy4lpe micsa() Dumxmo;o0aleomfcilsfsDumnmo;t4altnxf to1fptelu s s) rurxo3nudol nlfci ()srraumpno0texomi3tydla el(mont4trtnxoctodlaD aivo;() rtmio nydop nlnviltfsDururoot4aee iieiydfaDulu o;t)tetnmoctodopD lneolt tetrxr nudlp  mfvtl(  2umump;o1apt mi3iasfs rl( s;t) rxrxf3io1lat lieslt tetrir oy1olen nviasfaDtr(rpnu4olxn ictlt sDumu s;()altomf oodlpDe ivs s) etr(m3oudlmee fvsas) 2rmx  ;o4alxnifeiyd a2rmn s;(4trtoir iodoatraueo s trxmimpnodop  mietls)sDuau  no1altnmietat s2ulu p ()aeeniocoo1lm r u s (0t2tm(r3no4al   nes ( s2tm(r nu1ale moetad m ua( s u4alxrio3oytfaD  nesls seurir nodlmt micsas sDtaxmpot0tlt  o3iysfa2rmu pnt)arxrio ia1latelnvslt0 2um(o iodop   ncta( a2um(m ;u4tex mo3tysfmDrl(ms;t) renxo3iotom   u o;s  etoir iy4om elivta( a2raxrp;u4tpen i3ilt a ulump u0arenir oytom elueil() 2umio3oydaltn icilt)s2tmu pnu0olto iciatfmDrl(mp;u4tlxnmo3iydfp e i ols)texm(m nu1llte ictlsfsrrmumooo1tpxn ieild s rmn p t4aeerir3tatlpte i ils0 2ur(m nu4lpt mieia()a2raxronu0altniieiadla2rmnmo () eenxr3iytlaDrlnvil(0t2tmir ou1ome lnvslsfsrtmxmono0aetnmociytfs2umnmo t0tlxrirciytoaDelueo (0sexoio3oodlptnlict ( s2raur ;o1aet mfeiytfa2eaump;t4 exnmocoy1fm r ivs;( s2trxm iodllt mnvtltfarua(m no4apxo oetldls2umn pnu4 renmo tadfp  an ils0 2uo(o3oy4optn netat  2tr( pnu4ope ioetadfa el(msnu4 exnxf todfa r i s () 2xmxmpiy4om emnvt ( srrr(rpno4tpe ioeiysfsDea( p (0teeoxocoytfptelnvi;t  exrxr3ny1oltemiesa()artaum ot1tlenmiciadlsDua(vo;u0altoxf3todfmtr nes;() exmxopoy1amen fesat a2rrur no1tpxomiciasfa2rm(mp t4aexrir3ootlp rlneo s) ruo(m3iy1am elictat)sDrmum ;t0apen f3tyd mDel(mp u4 rtnmf3oadfm elies ()t2to(r3iudomtnmnvilsf Dumu oot1oeenmf3iadlmDeanvpn(4areoxr3tytfpt lu sl( srur(m3nu4op emnvilt  rrm(mo;u0tpen iciaslm2ulnmsnu4 lerio3io1lp  ai ols  etr(o3nudope mnvs tf rua(m ot1opeo ociytla2eanmo t)tlenmo3ty1lat lnei;()trxr(o3iodlltn ies s)sDtmx ono0tlxoiicilt mDelu p;u4altoio totoa elieo;() rtoim oy1amenmfcia( sDumumpnt4olx iicildfs ran p u4teenmr3io1fatrlneslt)seumxmpny4amtnlnvs (fa2urxm nu1optnmoctysfaDelnmo ()trtnif tadfp   ieo;( setrxm oydol elfcilsfaDtr( oou0altn ieiyt aDua(vsnu) eenxrcoo1fmDr ivols0 eurxopnu4opte fes s) Drmx o;u1oeen o3iad a uau o (4arxnif3iytfpDrli i t)sexmxo3oydlm   nvi t)aDrr(mp;o1alxnifcilt aDemu o;(0trtrmrctadfat lnvol(0 rtrim iu1am e nvsasf Dta(mo;t1ale mf3ias mDemu snu0tetrio iodfmtrluvi (0 ruoxrpiy4al emnvs tfs2ta(rooo4tle ifciadla ulnvs;u4tlenioctytfm  an olt)t2xmirpiudal  mict ()sDtmxr ;t4alenmocildlm2uaump (0aeeoxr3iodlmDe n ols0seumir iydoltnlics s)sDtmxr ;u0oexoiiciysfa2rauvo t) lenif3oa1latranes;s sexr(m3iu1omtn icsa( s2ua( pnt4olt mfcilsfm ua(msnt0 renirctodlpDr u ol(  rtoir3iu1op elfesls a2trur ;t1tlt  i3iasla rl(vo u0 lxrir oo1faDrlueols srxmxmpoy4ale lfeiltfaDrmxr oo0teenioeiasls2elnvp;()tltnxr3tytlm eluvols teumimpoo1lpe mfcias)a2ua(rono4aeeniicildfm uaums;u4 ltomo3iytlptr uvo s  2tm(o oudlmt lncsas aDrmump;u0oexn oeilsfm2rlumont0alxnir ia1lmDr i i;t0s2xoxm3no1aptnmfct s sDrr( pnt0opto iciyd a elump;t4alxrir oydfpt lnvi;t texriopny4opt miet (faDrmx o;t4oetniocildla2emu o;u0 ltoxf totfp e nesl(0t2xmimpoo4lp e neias aDrmu  ;o0tpto i3tat m2rm( on() etoif3oy1op rlivol()srumxr3iodlmeemfcia(f 2ua(ro;o0oet mi3iltlsDea( s;(0artoxo ty1lptrlu i ( s2tmimpou1lme lieils) Dumxmo;t0ole ioeild a eluvpnu4arenir tatopDraivi s)t2triopno1olt  fvtls) 2tau o;o1tltnif3iytls2ra( snt0 rtnxfcta1lat aies t0texo(r3iy4olee ncs t  2taum ;o4ope mieiyslsDelu o;() exomr tytfmt ai ilt trurxr3oodamtnlfesl( srtaur no0aeeoiicias s2emu s u)tlxoxr3tatopDr n i;s) etr(rpnu4aptemfes tf 2ta(rpot1opxoiiciadfmDranvp;(4trtnircta1lmteaneo;(0sexmim3oudop nlfei s aDtrur ;t0tpeoii3ildfs rlu o () eenxf iotlp raivsls0t2tmxm3oodopt lfetlt) Dum(mpno0aeeoifetlt s2um( p;u4tetrircoatopDeau il()setmxm3ny4alen fcsasfsDurxm ;u1apxomoeiatls2rmumsnu)aetrifcoodfm e iesls0trto(o iydlptelivsl( srum( poo0tpxomo3tyd s2rm( p t0tetoioctatoaDe i sls)t2toxo nydlmte ies sfaDtr(m ;t4tetn iciytfs2ranvs;u4altomocty1lmt lneslt  2xoio3io1llt mfvtasfaDumxrooo0olxnioctldlaDrmu snu) leoxf3oodfmDe iei ()srtr(mpio1al elfvils) 2rr(rp;o0aetnii3iasfa2ran snu0artrxo oodfptrlneils0setr(m iy4llt  ictl()a2umxr nt1optn i3iysfa emuvs;u4arerxr3oatopD aiei ( texrxmpiodom  lnvsatfarrmxronu0oeenii3iys m uanvonu4tlxnmociotom eln i;s trur(r3iy4opteliesls s2ra(m ot1aee  fciys m2umnmsnt0tleoif oatlateluei s trxrio3oy1lmte nvi t a2trur oo1apen oeiatls um(vp (0tetnxf ia1fpt  uvi s seurxm oydalt lfcs s  ruax  ou0tlxoioctad aDuauvo u0 rtoifctytfmDe ies s)trxoir oo1omtn fet (  2tmu onu4oexnio3ilsfa2emn o;u)tetrmf3todoaDrliei;t)trxo(m3iodlpe  fcslt  rurx  ;o4oltomoctyd m ranmpnu)tltrmrcoydfa rlu s;()setm(opnu1alen nvia()aDtmu  ;u1tptomoctytfmDrm( pn(0 rtrmrcoa1opDelivi t s2ur(r3oo4omtemfvs ()arum(r nu1ale iictytfsDranmpn(4artrxocoydlmDrlueo ()srumxmpiydom nlici tfsDuaxrp;t1apt io3tlt m um(ms u4 exrif ty1fp r i olt0t2xm(m3ou4lleelfvt (  Dua(  ou1openifctas s umn s t)trxrir oy1laD  i s s srtrxrpou4lle  nct s) Dtrxmp;o0oee iocildfs2ra(ms (4trxoif oa1fa elies t) 2xm(m nodaltnmieiatfs2tmxrp;u0tlx iocildla2raums;(0 ltoxr3totoa  li s;t t2tm(m iodopt  ncsat s2ururp;u4altnmfeiatfaDul(mo u) exrxf3oodfaDrlivs;t0 rtrxr iu4apt  ivtatf rtrur ou1aetnio3ilslm rm(vp;()tlenmf3oytoptr uvi;t) rxm(r3iodlmeemfcils a2umumpno4aeeomfciydfmDuauvp u4aetomr tydfmDe nei;t  eurxrpiu4oleelfviatf rta(rpot4optn fetldlmDean o u0 rxoxr oadfpDeluei;t  exr(r iudop emncilsf Dur(r ;o0optnioeilt s2ulnvont4trxrifciytfpt li ils  rxrir3oy1lpt mfvi tfa2umxrp;o4apenmo3iyt sDeluvsnu0arerif tatlmte i s;t) exmxrpiodoleemivs (  Drm(rp;o1tpeoifetydls umnmpnt4aeerir ty1omDrln s;t0srtmirpoy1ape lncsls  rtr( pnt4texn fcilt s2ranmo () rtrmfciatlmtrai s (0 rxr(o3iu1omt mnesatfa2ua( ooo4aet  feiltfa rmu pnu4aexrxrciadop rlies s0t2toim ny4lleemnvs tfarraxmo;u1aex iieild s2eanvp;u0trtrmo iadlp e uvsl(0 2toir3nu4omtnmiviltfaDrax pou1opxoioeilt sDuan s ()aexomr3iatla   uesl()tetmxo nydop   fvi (  rumxr nt4aexnmo3tad m2umnvsnu0 rtomo ootop   n s s t2uoir iodome  ies s)aruaumoou4texnmoeiatfaDelu o;(0 leomr iadlmt  neol( trtoim oy4amee ivtlsf Dta(roou1texnifetytlm ea(mont0 ltnio oytop elivils srtrim ny4ape livtls s2tm( ono1oee  ociad m2el(vo t4 ltoxr iatom  lnei t s2xoio nu4lm  mnct t) 2tr(rpot1alt ioetldfsDrm(ms ()aleoxf to1oatrauvo;t  etrio3ou1llenmivtltfaDrr(rpou0tptoifciadla2emu p;u)tltrmr3oo1lmD lnei;t  rxm(o io1olt livsl(fsDrrxr no4aptoiieils a rmn o (4aleomo oatomteanei;() rurxr oo1ole mncsa( s2tm( pnu1tptomoctat a el(ms;u0 eerir ootfmD luvi;()trxoxo3nu1omtn fciatfartaxmpno0alx ifetaslmDumn p u)altrxfciotoaDrau s;s  2xrxm oy1olt micilt)srumx  ;t1tpxnio3iyslm ran p;u4tltnxo iydlpD  iesls)srtoxopiu4al   ies (  rtmur ou0tex ifeiyt m2eanvp t)texnmf3iadfm rlivo;t0s2toxmpoo1lpeemiet tfa2tr(r nu0opeo octas a eanmpnu)texoif3iodfaDran sls texmio3oy1op e nvsa(f rtm( pou4opeoiociasfaDumu p;(4aexoiocoy1fpDrln i;t)tetrir no4lm elnvsls aDua(ro;o1teen iciydfm2rm( snt)teerxf iytla  au s;s  2toir3io1lp  licil(fs2tmum oo0oeenmiciydlmDuluvo;t0aetrio3to1latr neo;()s2xrxr3nudllee ncias  2rrur nt4oexnifeiadfs2emnvs t0tlermo tadomDr i i;(0srtm(m3oy4lpenmneilsfsruaxm nt1aptnioetls m emuvs t0 lerif iatlmDelu ol(0 2xo(o io1lm e iei s aDrr(mp;u0texoiieiat m uanms;u4trenifciatomtelieolt  eto(r iu4ll  mnesl( srua( pno4tpeoifciyslaDul(vp (0aetrif oatlp  li s;t  rtrimpiudamt mfei s) rtaxmo;o4tlt iiciyslmDem( o;(0 lenir tydla  ai i;t) rtrxo oydlptnmieia( srrr( ont0oexoiociyd mDrm(mp u4texoxr tytfptr n olt0 2trio3nudlmen ivtlt)sDtrum ot1alx  ietldfa emnvsn(4aexrif tatfatrli o;t) 2uoio nu1oltnmictlt)s2rrx  ot1apxomi3iysls2umn pn() exrmf3ty1lp rlivs;s)t2xoxmpiu4lmtnmicil()aruax  ;u4olxnif3ias aDelnvp;t4 ltrmf3tadomDe uvs;t0s2tmxm3iu1ol emfvsa(fsrua(rpnt0oet mieiytlaDeaumo;u4trerif iy1omD ai o s0sexoxo io1olt lnvta(f Dtrx oot0oexnmi3iys a ua(vonu4aetomf tadlmt au i;(0 rurxmpoy4om emicsat)s2ra( pot4aptn i3ildlsDemnvo (4tetoxfctydopt  neol(  rtr(o nu1lptelfeia(  Durumoou4ope mo3iydls2uauvs;t)trerxf3oydoa eli o t0teurio ou1ol elfei () 2rrxr oo4optn i3iyd aDrmumpnt0 lerxr3iatfaD aiei;(0 etrir ny1ope lfctls  rtru  no4olxomo3tasfm uau onu0 lxnxo3oo1oaD ai s (0truo(o ou1lpeemfcs tfartmxro;t1teeniiciaslsDelnvp (0tltrxfciy1lp rai i ( srxrio oodol e fcsa( a2tmu pnt4aeeomfcilslsDum(mo t) rxnif oy1lm r i o () rxr(r iodapenmfcsltf 2rmx o;o4optnmociat sDuanmo u0 rtnxr3oytlpDr ivs t0 2xo(r nu1ame mnvsa()srurum ou4optnmfeilt s rauvo;t0 rermo3io1omDeaueslt)s2uo(rpoudom e nesl(farra(monu4aleoifeildfm el(mp (0tltnio ia1lmDr nes s)teurio3no4ap elfvi s)s2tmxront1apx  iciasla2ulnvonu0artnxf3oy1lp e i s;t0t2tr(o3iu4omte ici t)arrax ont4tee iociys m uanvp (4 etnif ta1lmD lies;s0t2toxm oudoltn ictasfsrtrxmooo4olt  feiysfs2rm(mo () exoxf3totfp rauei;( t2xmxmpiu4amtnlictl(  Dtr(roou4tpenmf3tatlaDuau p;(4 rxoxf3oy1fmD au i;s sruoim3iy1lltemicsat)a2umurpno1aeeomiciat s ra(mpnu0arxrmf3oodomDeliei s srxr(m oodom n nei () rtmum ;u4tet io3ild aDua(vs;t0 lxrmocoodfmteaivi;t) rtoir3no1apeemfes tf Dtau  ;u0texoif3tyt m2elnmp u0trxrxfciytfa eluei;t0t2trio io4llee feil(fsDururp;u0alxn ietydlm em(mpnt0alermrciadopDeln o;t)srtmio nu4lmtnlfvs t  rrrumono4aeenmfeild aDulnvp;t4arxrmf iadfaD auvo;()teum(m3ny1op elfct tfa2tmx pnu0olx io3iltfmDrau ont4arxomo iotopt an ols) rur(m3nu4op nlfetltf Dta(rp;t4aleniociadlmDeaumo t4trtrmf3io1lp e n o;() 2xrirpoydome mnes (faDrmur oo1opxoiociyt a2ul(vont)tltomf3ootlpD ln sls)sexmirpiy1ame  fcs s)a2tmumpou1apenif3ild sDeauvo;u0 etomf oy1lp eanvi;( s2uoirpoydope mivilt)aDtmu  ;t0tlx miciatfm2uanvs;u0texnxf3iodlp  anes t0trtm(r3oy1lp nlneiasfaDtmumo;u0opeo ictydls emnmont4texoio oatlptrln il(0 rto(r oy1lmtn nvsa(  rtmu pnt4tpen ocilsfm rlnmp;t4 exriocoadfm e ies () 2tmxr3iy1lmtelici tf rtmxr nu0aetn feias sDumnmpnt) etomr oodoatr ueo (0s2uoim oodal elivsasf Dtrurp;o0tpenioeiltfs2ua(mont4tlxnir iotfpDraues;t0 rur(m iu4ll n nvi tfsrrmxrono0aexnmi3iysfm eaums;()alxoxocoy1oa eln i t)s2xo(m3ny1lp  mfci (fsrraxmpoo4tlx mieiyd m2uaumo t0 reniocoodlatr neo;t0 rur(r iy4lleemncsltfa2rau poo1tlxnifeilt a2elnmont4texnxf iadlp e ueil()seto(mpou1altn ivi (fa2uaur ot1aetnif3iaslmDrauvont0 lxrxrcoa1omte ivi;s tetr(opio1lp elfct ()arrrxm ot0oleomietls sDra(msnt)trxnxr ta1lmtrai ilt0 2trim nodop   nvi s  2rmxmpnu4optn o3iasfs2ranvo;(0 ltnxo oydlate neils) etoirpoudap elicsatf Drau o;u0opxn i3iatls um( snu) eenxf3tydopD anes (0setr(opoydll n ieiasfarrm( oot4opeomo3tysl
\ No newline at end of file
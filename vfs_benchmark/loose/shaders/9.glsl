@@ -0,0 +1 @@
+i o;s sexrxr3nudopt lfctat)s2tm(m nu0apx  feiydfs2ua( s;t)areoxocootlpt lu ilt0 exm(r nudape mnvtlsfaDtrxro;t1ole  octaslaDeanvs u4alxnmo tytlpDrlivsl(0teuoirpno1om n ict tf 2um( o;u4tpeoifeiadfs2um( onu) etnmo3iotoa r nei;t0 eumio3iydope mieilt s2umumpno1altnifctad a uanmpn(4trxrmrciy1fmt an i (0srxrxr3iy1lme mnvs ( a2taumont1tlenmo3ilt a emuvsnu)aexoxf oa1lmDelivslt0t2tmxopno1om emivsa(  2tmxmpno1teeomoctasfmDumuvo;()tlxoxf3oydomteai slt)t2xr(mpio1lm  mfcs sfsDraxr ;t4ale mfeils m ranvo u0texoifcio1om eln s ()t2urir3io4ap nlfes (  Duaurpoo1alt iociyt m2rm(mp;(0 etrmo3iydlmDelieils  eum(m3oodll nmfviat a2tmxr nt4ape if3iyslm2raumon(4 rtnxf3iytoaD luvol(0s2umio3io4ap nmnvt s)arraxrp;t1oeeo fciydfa ua(vp;()artrmf ootlpDe nvi (0 eumio3oudop n neiasfa2rr(mp;u1alen o3tytlsDelnvp t4 exrmf tytlate ieo;t)t2xr(mpio1ameelfvt t arrrumpno4oexniieilslmDeluvp;u)tetrmr iotoa elnvs;(0s2xr(rpno4lmenlnesatf Durum no1tlt ifeiadls2ua( p t0arxomocto1oa  aieo s) exoxo nydomte icsas aDtaxmpoo4aex ii3tytla rm(vpn(0teerxrctadfatrlneo;s)trtrio3io4amen fvtl(fsDrm(moot4aptnmoetatfm2uan on() eenmoctodlmD aueils)teuoir iu1om nmictl( aDuaxronu1aleomo3tadfm el(vp;(4arxnmo tytfatelneols  2xrir3nydll n fvt t  Dtaxm nt0texoiictltfsDum(vsnt0tltrir iatlpt au i;s0s2xmir3ny4aptn fvsa( a2tmum nu0apxoii3ils m rmnmp;t0teeoio3ootfa rln s ( truo(rpny1omt mnctlt)a2ta(r ;t1tleo ietadlsDrm( o u4tetnxo oy1lpDe ivolt) 2toxrpou4lmenmnetl(  rrm(  nu4oexn ietadla2um(mo t) ltrmr oatomDeau sl(0t2xo(m io1ome lfct ( a2taumpot4optomo3iyt a2elumpnu4aetrxfcto1oate n sl(0trtrxm3no4ol nmncia(  Dua(moou4tpenif3tltls2em( snu4alxrio iatlmD ai o s) rtr(rpnu1ome livt s a2rr( ont0alxo ieiat m2eanvsn()aetrmr3todoa rli s s texoxm3ou1om  lnei sf rtau p;u4aetoiictytfsDranms u) reomf3ootfmt ai slt t2um(rpou1oleemneia()srrm( o;t0tex  f3taslm2ua(vo;u0trtrir oytop   iei;s texoxopoy1om  micsas)s2rr(m ;t0tlt  feiaslmDrlnvo;t)aleomf3iytomDrluvil() 2urxr3oy4olt lneil( sDraxm nu0oexoiiciys s2uaumsn(0treoxo iodla rai i;t)sruoimpio1olenlivias) Dtmuro;o1olt ioctydls2emumo;u4 etoxf3io1op eaiei;t t2uoxopoo1ope livil(  rtru  ;t4oeen feiyt mDrlnmsn(4tetnxo iydlatrlnvi;() rxoxo io4lleelnvsa(f rurxm oo0tlx mi3iad mDraumo () rxrifciotlaD ln olt)truoxo3iudamen fvias)sDum(r ;u4oeto f3iadlm2uaump u4tltrxr oadomD aieolt srxm(m oodllenmietat)s2tm(moot1tptoii3iat m2eau s t4 reoifctytoa eli o;s0s2xmio iy1lmtnlfcslsfsrururont4tpxnmf3iad s uan ont0aetnxocia1lp eanvslt  rtoir iy4lp n fesa()s2rm( p;t1oltoii3iaslmDelu p u) eermr oytla e u o (0 rtr(r3iudlp  mictas s2tmumont1ope  oetaslsDem( o u)trermo oa1fm rlnei;t0s2xrxo3iu4lle  ivias) Dtaxront4tltnmi3iatlsDean snu)alerxf oydom ean s;s0 rtr(mpiy4op nmfcsas) Draxrpnt0tlt if3iadlaDrln o;t0arenmo3iydfpt  ueslt)sexo(mpoodlp nlfeilt  Drrx p;u1opeo feiytlaDemumo;()tlenxf3oadomte ieils trxrxmpno1lleemiet t artrx onu4tlx  iciytlm uan o (4tlermr3io1faD au i ( texr(rpou4al n fcs s)sDtax o;u4tpxn ictld sDumnvp t)aexomr3iadopDr iei;t)sexoirpiy1lp emnvtls)sDurxr no0opxo iciltfs2ra(ms;(0aeerxocoydlpDrlnvi t0s2tm(m3nydop emnvilt)srtau p;t0oeeomfeiadfm2elu on() rtoxf ootfpt lues;() 2toimpou4alen fesa(fs2uaum ;t0teeo feiytfm2elnvo t)trermrcoytfm rluvi (0trxo(o ou1lltnlnvt t) rra( o;u4teeo fctlsfm umnvsn(0 ltnmocoo1fp rluvs t0sexmiopou4llt  ivt () 2rmx  no1oexnif3iyslmDel(mpnu4texoifctadlateliei;()srto(opiydlpe  fvta(fa2trxrpnt4aex io3tat s2umu snt4aleomrcoatopD ai i s0srtr(o nydam  mivs s srraum nu1apxnif3ilt a ranms t4 etrio iodfa e u o t  2xo(o iy1op e ivt sfaDum( pnt0apxoiietldlsDrmn snu)texoirctodfmtrauvilt) 2trxm iu1al  mnctl() rrmxm no4tltn feiadfa2uanvs;t) exrmf3iy1lm  liei t0srtmxmpiy1ll  lnei t  Duaxr ou1aee mieiydfmDuanvo u4tetomociytlpD anei;s  rxoimpio1apeemnvtls s2tax  nt1tpxnmoeilslsDrm(mo;t0tltnmrctytfmt  ivs;()s2tmir nudomtnlnvsls)a2uau p;t0aexoif3tysfm ul(vont4aexoxfcta1opD li il(0trxr(mpiu4olte ietas srta(rpno4aet iieiytfs2rm(vpnt4 reomr iydomD  uei;()srxr(mpnudapt mict (f 2rmurpnu0tlenmo3iadfm2rluvp;t)alermrcoo1fp e uvilt)seuo(m3io1op   ictls arurxmpoo0opxoifctasfm2rm(mont0artnio oo1fpDeaueil(0t2xrxr3ny1optnmfvi sfaDumx pou1oex io3ilsfsDelnvo;t0trtrmo iy1fp rln o ( tetm(rpnodllee ivsl(  rumumpou4tlxo o3tldfsDrau s u0aleomoctodfa r iei t0seto(rpoo4olee fvsl( arururp;u0alxo fetyt a elu s t0artrxo3tydoa ranesl(  2uo(r iy1omtn neil(fsrtrur ;o4oeen ictlt sDel(ms u4 renxfctodlpDr u sls0srxo(o3oodlm nliciat)srtax  oo4alxomociydfm eau p;u4tetrio iotfpDrai o (0seumxmpoy4ap nmfct tfaDtr(r ot4aeeomociyt sDuauvpnu0aexrxo oa1la raieslt)setoiopnu4apee nesa(f Dta(ront1tee miciadfs2emnvo (0 etnxfcoo1fm rli ils0s2uriopiu1apte iet t) rtrur no0apt mietysfm2ulnms u) renmocto1lpt aieilt) 2xrxm3ny4ope lfci (fs2rr( ont0altomiciydfmDuln p;u4tetoxfciodoatrli olt) rxoxopoudlpt mieils  Dtr( o;u0alxniictydlsDrm( s;t0 exrmoctatfa   nvs s setmxo3oydlp nlfesa()a2rmump;u1alen ociytfm2umn s u0 renmocty1la elnesl()s2umio iy4lptemivta( sDrrxrp;o4optoiieiydfmDrau snt4 rxnio3iotfmt  ieo ( tetrxr3no1amtelfvs ()a2ra(m ;o4olxoio3iytlmDrlnvpnt4 lxnmr tytfa  ln o;() 2tr(opoo1apt  nei (f Drr(m nt1opeoio3tytfsDem(mont4trxnxr3ia1omD  uvsl(0s2xriopny1om n fvsl()arrr(mpnu4oex miciyt mDumu s (4 etnxo tadfm  ai o;s)srxrxo ny4ame mfciltf Drru  ;t0alenmf3tyd mDea(mp t)tetnxf3tytlaDrli i s)srtr(rpoodlmtelieta(f 2rr(r ou1ape iicilsfs ul(msn()aetnmrciy1late uvo t)srxoxrpou4lmte ivtl(f 2ur(m ot0opxomictltfa2rmn o;(4 reriocootfpte nes ( t2toio3oodap  miei sf 2trxrpot4ale mo3tatls um( pnt4aeeomfcoytfate uvo (0srtmiopnudap emnctls sDuaxrpou4ale ioctytfm2uln s u)texnmr totfateluei s0 rtoir io4op emnetasfaDua( ooo4altniociydfs2rmuvp;(4 eenmo iy1fm  luei;()texm(o3nudoptnlieslt artax o;t0ope  oeiasls2umnvp t0 lerir totop  aiei;s t2urxo3nu1lmtn neiasfsrrm(rpoo0alen fciad m2umuvp;u0alenif3iydoaDr n o;s sexmim ou1apee nesat)a2umxm oo1alt iieiysfa2rl(msnu4aeenmr3iydlat  i i;s)teum(r3oo1ome  ivtlsfsruaxrp;t4apenifciys sDrluvo t4 lxomf3to1fpDean ol()t2xo(m oudlmeelnvsas srtaxr nu0oeeomoeilsfs umu s u)artoxfcta1oatr u il(0 eurir3iodamenlncsls)aDrr(mo;o0tetnioctas a ua( pnu0trtrif iytlmDr u o;s0 exoxrpiodll e nei (fa2tmxrpoo0aleo fctas s2ranvont0 lxrxo ty1latr uvo ()srumim ou4altnlies t  rur( ono0oltnifciatls ea(mon(4alxnxf oytfm eluvi;s0 etoxr iy4aptemicsa(f 2urxrpno4alxnmfetlsla ra( pn() lxoxf3ta1lmtraiei s setr(o nu4am nmfci s) 2rmumo;u0opxomfctad sDrmu on() eenir oa1fmDrau olt0 exr(r3oy1op emfci (  Durum nt0oltomictls a2elumo u4 lerirciydlpDrai sls s2trimpio4lle lfcilsfsDumxmo;t1aetnio3iaslsDrm(mp (0teerir3totlmDelu s s)seurxrpiy1am elnvia(  Dumum nt1ale  i3iatfsDrmuvp;(0 rtnir3iodfatr u ilt)s2xoxr iudlleelfvi (faDtm(rpot1tpxo f3ildfs rmnvp;()arerxo3iatoaDrln il()srumim nu4apeelivt s  ruaxm ou1olenmociysfa rl(vs u0aetrxocoydlaDelu sl( sexoxo iy1lmee nctlsf rta(rpnu1olxnio3tytlm2el(mo u4aetrxo iadfmDr neolt0trurxm ny1ope mfetl()s2tmu  ;o4tlt mi3tat s2ua(mp t4arerxr3oatop r ieolt0trtm(r3ny4aptelfctas  rrr(mo;u0texo f3iytls uau snt4 eerio3ty1fat auvilt s2tr(rpnu4lle mfvsat srtmumpoo4opto ociyslsDrlumont4tlxoio3tydlp  lnvils t2xr(o3nudlm nlicsl( sDra(mont0tlx  ociasfs2uaumo;t4 rerir ia1la e ivs t0s2toxopoudole  feslt s2ua( pno4tltoioeiysfm2eaumo t4 eenmf iodom rluvi;s0srxoirpny4amtnlicsls s2rrum ;u1optn icils mDumu o;u)trxoxf totlaD aneol()texmxr3iodal   ics s) Dumum nt4olx ifeiad aDel(vp;u4tlxnmfcoy1fm  ai ilt)t2xo(o ou4lltelicia(f Dtrur ou4oltn oeiydlmDem(mp;u0 rxnxociodoa ranesls)seuoiopnydap emicsas sruaxrooo1tpe micilsls em(ms;u0aleoxf iytfaDrauvo s  eumxr3iu1ap emfeil()aDrru  ;o0texomociatlm ea( p;u0aleomf3ootoa e u ils0s2uoxmpnudlmt  iet t aDua(ro;t4tltomoeiydlmDean pn(4arxrif iy1faDelies ()t2xmxo ou1op   icta()s2tr(  ot1aexoiicilt m rmnms t0teeomr3ootopDeaneo () rxoxr io4lptelnvi s  2taumooo0tleomieildls eaumon()aexoxf3oytfmt li i t0 eurxo oo4lltemnesa(fsrtr(mp;o4olt  i3tysfm uau o u4 etomf oodfa eln o;t)setriopiudal nlicilt aDta(rpnt4aleoio3ils m2uanvs u4 lxoio totfa  lnvi;()t2trxopiydal  lfvt s)a2rru  nu1tptn fciadlm2um( p;t)aetnmo3tytfptran i s0 ruoxmpoo4lmt mivi s a2ua(rpou0tlt iociytls eluvon()aeenif3iytlmtraivs;t truo(rpiodopee fct s arumurpoo1oexnmfetysfs rlnvo;t4 exnxr oydfp e nes t) 2um(opnu4lptemivtas srurxmp;o1aex mf3iltfs elnvs;t4tltnirctotfptr uvols srxoir3nodomt lnesat  Dtmu o;u1tetnii3tld s2uau snt0artrircoo1laDelieils0 rxo(m3nydap  mnci t a2umuro;u0aeto o3iatfa2uan on(4tltrxr iatomD lneols)sruoiopoo4ap nlfesltfaDtmu p;u4aex mf3iltfaDeanmsnt0 ltnxf iotfp rlivo;t)seumxrpiodam   icia(f Dtm(root0apeoiiciydfmDrlnmpnu4 ltnmfcty1fmtelnvols) 2xoir nodomtn nvsatf rtax ont0opxnioeiytls2emumo () lxoxf3iytopD  ieols tetrxopoy4ol n fvt s) rurxroou0olen o3ils s uanmp;u4alenifcoydomD aueslt  rtrim iodalt  nviltfa2ur(r ot4aet io3iatfsDran p;t)tlenmo3io1opteau ilt s2umxr iodaptnlivtltfsDtm(rpoo4opt ioeiydfaDea(von(4arxomfcta1opDr n o (0seuoxopiydap elfeslt a2ra(r ;t4olxo f3tyt m2rln ont4altoxr3tytla   ivs s  2toir3io1amt lfcilsfa2rmx pot4tpe  ocildfm uau p;t)tlxoio3oa1fa rlivo s)t2tmim3oy1optemncia(  rumxr ou4optnioeildlm eaumpnu)tetomr iodfm rlnei;s0texoxopoodol elnvsasfsDta(ro;t1apeomf3iatla rluvp t4aeenmocty1fm rlues;()srxoiopnu1lmt  icsl( artrum ;u0altn fciaslm raumo;u4aeenxr tadfp rauvil()trtmxrpoo1am nlieiat) 2rrxr ;t1aex io3ildlm eauvo (4aetnxrcoadla e i s;(0 exmio3oo4ol  mivta( s2trx pnu0aptnioctysfsDra(mo;u4 exnxr tytlp   ieolt  rxo(m iodlpenmncs tf Dua( o;o1altoiiciysfa ua( onu4texoxo3iydop e n o t  eurxm3oy4apt  net s) rrr( p;t4tpxnmf3iydls2umu on(4alxrif3oodlaD an i (0teuoirpoudlmtnlfvs (fsDumuronu1tlxnmf3tlsfs2elnmsnu) rxnif todfmteaueo s0srtoirpnu4lltnmfeil( srrrxm ot0oleniictyslm2rmnvont4aetrmf3totla rlieslt0 2tmim nodamt lncsltfa2urump;u0open feiasfm2ra( o;(0arxnxf tytlptr uvi ()seuoxm iy4llenlfcsa(f ruaxrpot0aetomociysfa emu o t4alxrir tadfm e nvols)trxo(r io1ll elnvta()sDrru p;u0tle mf3iysfs2ulump u0alxoio3iytfmteauvo;t)s2xrimpiy1lp  mnvsa() rrrxr oo1tlen oetydls2ran p u) eeoxr3todlmtr ies t0texrio iudap nlneils)sruru o;u0aeeniieiad aDulumsnu0trxnxr to1fptrln i;() exmim3ou1lpt miesa(f rra(ro;o1tlxoif3iyt s ul(vpn(4 rxoxf tadlptrlivo ()tetmiopoydale livslt)aDrmurpnu0aeeoifctaslm rm(vs (0altoif3oatoa r ieols0sruoxm3oodop e fei (  ruaxr ot4openmociydla2rauvs t)trtrxocto1optelu s t  2toxm3iu1lltnlfvt t a2rmx poo4olxnifetlt sDemn o;t4teenxrcoatfm e nei;t) eumio3nydop elfctls) 2taumo;u4oltnioetysfa elnvont0aexnirciatom elnes s  2umim iydlmt lnvsa( a2rr(  nu0tpx mfciltfmDrm( o u)tetoio3iotomDeau o s  etoxm ou1amte ics s sDraump;t4aexoif3tydfa2uln sn() etoircoatfp eanvs t0truo(rpiudame micsas)arumu o;o0ape iieils sDeaums u)treoir tydoaD anvs t) rurir3oy1ap n iei s  rtmurp;o0texoiieiadfs2emuvo;t)alxnmocootomDe u i;t  rtrxrpio1apt  ietas a2tmx pot1optoiicils s eanvo u)areoxf3iotom  aivi s) 2xm(r3nudlptelicia()aDtaxm nt1opxomfciltfa2rmnvsnt4 lerir3ty1fm r ivsl() 2toxm3nu1apte fvtlt)sDrrxmont1tpxomieilt s uanmonu4tleoir totlmt auesls seto(opny4optnlfcilt aDtrxm ;u1alxnio3ilsfaDuaums (0arenmfcoadlpt  ivilt0srtoxr3no4ap   fcta() 2raxr ;u0opeoiictyslaDeau o;t0altrio iytfp eln o;t0 rxm(m3ou1om nlivsat a2tr( pot1aex  iciatfsDulump;u)tlenmrcoatomDelnei s0seuoxo nu4al elfesas)a2rrx  oo4aleomoeiys sDrmump (4aetrxfctatfmt aieo;() eumio iy4am nmneil(fsrurx pot4aee ioeiysla2em(msnu0 etriocto1omt  u o t)srxoir3oodap e fcsas arraxmonu4tet moetld a eanvs;t0 renir iodlmt lnvo;s) 2xmio oo1amtn fvsat sDua(  ou4texniociltla2ulu p (0alxnmr3iy1opteauei s0s2xr(o3nodll nmfciat  Drrump;o1oexo oetasls ulnvs;(0 eerxr3ia1laDrauvs (0srxoir no4ll emict sf Dra(r ;o1aptoioeiysla2elnmo u0arxomf3totopDrli s;( s2xrxopnydlme  nvt sfa2umx  ot0olxnmf3ilt a2ul(mont) rtoir3tatfaD lnvsls0s2umxmpiy1lp nmnctat  Drax  ot0tet  f3tysfmDuauvp (4 rtoxo iy1lp   ues t srxmxm3no1lleelfvtl()arrmuro;u4aleo f3ilsfm eauvp;t0tltnxfcoodlp elnesl(0teum(o3iu4openlivt ()srurum ou0tpeoiicildfaDuauvs;t)alxrioctotfmtelnvi t  rxo(o3nodape mnesas s2umumonu4tltniiciat aDemnms t)aeenmfciy1fmD auvi;(  rtm(r3no1lltnlics s)sruaxmont4aeeo f3tyt mDuauvs;t4 eenxr oo1faD ln ols  etoxr3oo4lltnlfvi t s2urxrp;t4aptoioetysfa2rmn p u)arxoxf oatomtrlivols trxoxmpiu1amtemivt tf Dumu ont0tpt  ieiytls rmu o;t)teenmo io1laDrauvi;(0sexoimpiy1al elnctat  Dta(m ;u0aeen o3tad m2emnmon()tltrxfcto1oaDeai i;s) 2tmxopny4am emfesls)s2umur no4opxn oetysfmDum(mp;() exnxr oy1lm  auvo ()t2ur(rpio1olen netl( a2tmxmono0apenmfciatfs2rmnmo ()alxrxo oatlp rlueo (0t2toimpiy1lptnliciat)s2umx oou0aetnmieiydfa em( p ()aeermrcoodoa rauvo;s)s2tr(o3oy1lpt lnvt s)aDtrur ;o0altoiiciytfm2elnvs;t4 rxoxfciodop e nes;s)setoim iodlpeemfvsls  ruaumono4alxo ociysla rmuvo t0tlerxo3oa1om   ies;t0s2uoxo nu1apeelfetat) 2rruro;o4openio3tyt mDrmnmp;(0 exrxo3oadfaD aues;s0seumxm3iu1om nmfcil(faDrmxmooo1tpto i3tltlsDelnmp u0tltoxo3ta1lp rlneo t) eurxm3oy4opee fesat srurx p;o1olxomfciyd a2rmnvs t4trxrmfcoodlateai slt0t2uo(o3iu1lpte ncia(fsrtaxro;u0apt  i3tlsfa rl(mp;()teermfcoodfaDranvi t) 2ur(opno1lltnmiei ()s2ra(r ou4opxn iciyd a uan sn(4 ltrir oadop eanes t) rto(o oo1lpen ivt s  2rmurp;t4ole mo3tydlmDua(vo t4tetomo3oytoate i i t)setmio3ny4alen iei t a2urur ;o0apxo o3iasfa2rlnmo u)artoxf3io1lmt  uvo;(0 etoio3nu1altnmfvtas arta(mpnu0oee ioetat s2umu pnt4trxrmf oytlm   nvi ()tetrio3ou1apt mfci s  2raxmo;u1open oeiytls2rlnmp;t) rxrir iy1lp eln i s  rtr(rpiu4opee feils)srumxr ot0apxn oeiatfmDum(msnt4 reoxf3iy1fpDeaivo;t  eum(m iudlm   fcs t)srrmu ont1olxn feiad sDem( p;t4 lxomfcia1lp rluvs s0srumxr oy4openlfes t)aDta(r no4opt iieiadfs2ranms;u4tetoif3oytlaD  ivslt)trtm(mpnodop   ieslt s2rax  oo4open ietytfaDrlnvo;(0arermr3iodomDe u o;t  2xoxm3ny1omenlfctatf 2ra(moot4opt mfciatlsDem(vsnu) lerif3tydlm elnvs (0 rtm(r3no1op nmfctat s2tru  ;t4tpxoii3ilsfs ea( sn(0aeeoxfcoo1lmtrliei;s) rtoxrpoydamenlivtlsfsDrau ono4tet mo3ilt a ra(mp t)tltoiocto1fmDelneo;s teumir3oydom nliet ( artrur ;o0oetnmf3iadfa elu o;(0alerxo3iy1opDeauvil( s2uo(opoo4ape lncsls) rraurpnu4opxn f3ilslmDumums t4 ltrxr3oy1omt  nvs;()t2uoir io1apee ietl( a2raxm ot4tex ioctlsfm2rau o (0 exnmo3tydlmtr i i s  2trimpoy1omt  neta( srraxm oo1ape iietltfaDum(mp;u4 lxnir3tatomteanvi;s0trxr(r no4lmt livtatfs2tmurpot0texn fciad mDeanms;t) eenif ootfaD aueo s seumimpnydll elieiat sDrrx o;t0opt moeiytfm umnmo;u) ltrio3totfa e u o;( tetr(rpno1amtemneil(fa2ur(mp;u0alt ii3tasfmDrlnms u0treoxf oytfa rli ilt0t2trirpnu1ll nlfvslt)aDtax o;u1olen fciydlm2ul(mont)teeomr oydlm raueol()s2xoiopnydapt mfei (faDrax  ;t1tpe ioctas mDuauvo;u4 lxnioctytfmDrlieolt tetoim oodoltnmivt ()s2urxronu1texoif3ilsfm2rmn s;u4arxnxo3iotop elu s (0 exmim iu1ope lfct t)s2rrxmp;o1olt mfciyslsDulums;t) exrmrcta1fm ean i;s0texoxo3ou1lltnlfvi sf 2uauro;o0aex mo3tlslaDean p;(4trxrir io1lptrau s (0srxrxopoo1al e fviat) 2rm(mo;t1tlxo ociad a2umnvsnt)texrxfctotoaD  nei;t)t2xrim ny4ap nlivi sfsDumu ooo4opx iietadlaDua( s t0aexnxf iadfmD  n sl( s2xoio3nudopt  ivs t)srur(rp;t1openmietldlm umu ont4tlxrxo3oydlateai i s  euoim3oy1omte nvs s)s2rr(r ;t0tltn fcildls2rl( snt4tltnmr3iadlptelnes t0s2tm(opno1lm nlivtl( arrrxrpou0oeeo fciyd sDelumont4 reoxo todfa r nei;s srtr(r ou1op n ivt tfa2ur(mpno0aee  ieils s2ea( s;u4 rermr oydla r n s;()seumxr3nydll nlfviltfsDtruro;u1oet  ieiad s ulnms t) ltnir3io1laDeluvsl()teuoxo3io4altemiet sfa2tmum nu0apxomictadfa el(von()altrmfcia1lmteliesl()s2tmxrpny4apen nvsa()a2ta(r oo0olenmieildlm umnmo (0arxrio io1fatraneolt0 2xrio oy1oleemivsas  2rm(mpot4oeeo fctls a rmu onu4altrxociatla rlu s s seuoxo iudlm nlnes s) rraumpot1teen i3iysls2ul(mont0tetrio tytlpDrau il(0tetmxr iu1amt licsat a2rrxm ;u4aeeoio3ildls2umnvo;u)artnxfciydfaD  n slt)t2tm(rpnu1oleelfei t)arrmx poo0tptnmo3iad a rlu s (4arxrirctydom   ues t)setrxr3oudom  mnesatf Dtrx  ot4alx  i3tad a2uanvs;u4alerxo3to1fmD li sl(0 rurxr3nu4oltelicias) rraumpnu4aeto f3iatla elnms t) exnxr3oatfmDrli slt0trtrxr ou1ameemietasf Dumx  ou1oltomfciysfa2umumsnt0aeerifctotom   ueo s  ruo(m3oydlm   nct ( a2trxr ;t4oeeo f3ilsfm uan snt4 ltriociytfpDraies s) exm(m3no1lp emivt t a2rm(rpnu4aexoioeiltfmDelnmo t4aetoxfcio1fp raneo (  2xmimpiy4am nmieia(  Durxmont0oetomf3iatfa uanvo;t4 lerxr3oydop r nvo t0trtm(rpiu1ope miciltfsDua(r ;u0oex mo3tls aDuan o;(4artoxrciodlmt auvi ( trxrio3iu4optnlnvias artrx pnt0texn feiydlm2uau sn(0alxrmo3oadlm eauvs;s)t2xrio oo1ol  mnviltfa2raxrp;u0tpt iiciat sDul(vont0alxrmf3iadomDe u o;s srtrio ny4oltnlfvs ()sDtr(m ;o0altn f3tas aDumn s;t4trermr3oy1lptelivol(0 rtoir3oodolen fcils  Drrxrpou1olxn ieiytlmDua(msn(4 exoxociotom   uvi;s)s2umiopiydlpee iciat)sDtmu  nt1oet mociydla rlu s t0 rxnmf3ta1fm   nvolt) rxr(o ou1op emfviatf 2raxr ot0tle mfetls mDumu s;() rtomf iydlp  livi;t0trxoim oudam nmfet t)sDtmumpoo1olx if3iltfa uln pnt0teeomf oodfp  luei;t0t2xm(m oodalt  ivt tf rtrxront4aeeo oetad a rmnvs t)areoxr3oy1oa rau ols)srxrir ny4lp  mfvtas s2trx oou4apx ifctyslm ra( p;t4 lxrxfcoatlmtr n i;t sruoimpoo4al elietlsfa2umxro;o0teenmoctytlsDrm(mpnt4aetrmo oatopteli s t0 etmxo3nudlpte fetatfaDuau onu1tlen ietlslm2rm(von(4aetoif iatfp rlivo;( seur(o oy4amt  fesl(  rtmxmpoo1tpx ii3ildfaDul(mo t4alxoio tadlaD  uvs;s0 euo(m nydol nlfvs t  Dtru  ou0texnmociatfm2rluvs;u0arxoiociytoaDrau sl()srtoxr3ny4amtnmies sf rtrx  ;t0tpxomo3iysfmDraump t4tlxnio oo1omDr neol( trtm(m nu4ap e neiat)aDur( ont4aptnmo3iyd s2rlu s t)teenmoctydlaD  neslt teumir oo1openlictas)sDtmur nt1alenii3taslsDua(vs;u4teerir oydoateln i t0s2tr(rpiy1apenlneilsfa2trump;t1ape if3iasfs2ulumo;()trerxrcoatoa e nvi ()setrxopny4llenmiei (fs2uru  nt1opto ieiys s2ul(mo;u)tetnxoctotoat  iei s)tetr(m iu1olt mfvta(  Drmurpnt1alx iietasfs2uln s;u4 eenmo3iytoa rlnes t)trtoiopiy4ale  nct s aDum(mooo4tleoifetad a ran onu0 eeoxr3oodoptelu i s) rtmxo iodomt  ivtas)a2ta(m ot4olxnmf3tls s rl( pnt0trerir3totlpDeauvs;(0srxoxrpoydame lnvs tf 2rrx pou4olxomfcilsls ran o;(4 renxo3ia1lmD  u o t0srxrxrpoo4opte ivt ( sDuau  ot1apeoiictadlaDelnvs u)alerio totlp   uvi t setrxrpoy1lpenlfvi (  Dtr(mo;u0olxo iciasla2rmnmp u0 lxrif iadomDranei;() rxm(o3oo1opte fet (fs2tm(ront4altomfeilsfm2rlump t4arerxf oa1fp  auei t)srtoxopoudlmtnlfvs sfaruau  oo0aee mi3tytfa rmnmpn()trerxfciy1lpDe n s s0 eto(r3iu1lme  iesasfsDtrumpou1aetnmo3iad a2ean p;t4 eermo3tatlp  ln o s t2tm(r ou1apen netasfs2taxm ;u1ole iictytfm2uanvo u4 etrxociadomDr neo;t) exoir3iydop emieia()srrr( o;t0tleoif3iytfm eauvpnu0aexoxr iodlptelnvi s0s2toir3ou1ole lnvsasfsDtau  ot0tlxnmiciatlm2rlumpn(4treoirctytlmt livo s0teurxo iudal emieilt) rtru pot1oleniociysfaDelu s t4 etrmocoodfpte nvsl(0 rumxm3no1ap n ictat)sDraxmonu1alx  feiydfs umums t)teeomocoatlmDr iei ( srtrio3oydlmtemfcta()a2rr(rp;t1tltn f3ildfsDrmu o;t)tlxomf3io1laD anvsl(0 etrio no4lp emivs (f 2ua( p;u4oex mi3tasla2ul( pnt4 eenxf iotlaDrlu ols0trxrxo no4lpenlnet t  ruau pou1tetn f3iatfmDrlu s;t0aeenxfciydfp   n i s) exr(m3ou1om  lfes ( s2trxrp;o4altniociyslm eau p u4 ltnxfcta1oaDe n olt)seur(m3oudoltemieils aDtmuroou0oltn oetldfs rmumsnt) lermr oatlaD li s;t0s2xmio io1lltemivs t srraumont1texn i3ildfs el(vonu0aleoir3tadoatr u o t0 rtmir3oydamtnmicia()a2tmu pou4oexn ocildlaDelnmo;(0texoif3iydfa r ivi ()t2xmiopoo1llt mfesas srtrumpoo1tltn f3tatls2eanvonu)trermr iatlm  lueslt)trurxo oudoltemnetat) rtrumpno1tpen i3tysfm2rlnmp t0 rtnxocoydla rlieo;t0srtmim nu4alee fvsa(  rtrx  nu0tet  icilslaDrlu o;u0 eerxrctadoa eaneo s trur(rpoo1apen iviat) rraxmoou0apxn i3tldls2emnmonu0 eeoxo oydoaDr neol( srtoim oy1omtemfes ()a2uax  nu0oex mieias m eauvs u4alxnio iatlate u sl(0 rxmimpiydoptnlicil(fa2ra(  oo1tpx iocildfm2eauvs;u4aeenmr3todom eanesl(0texm(r nudllt  ncia()sDrru pnt4apeoioetls a eln p t)texoir iatfm r iei t s2xo(rpiudome  ies tf rtmxr nu4oetnioctysfmDemumo t)tlerxfciodlaDe uvi;s)srum(opoy4lltnmnctl() rtaxmooo0tpt moeiatlm ua(vs;t)tlxrifcoytoaDr i slt)sexrir iodlp nlicsa(fa2uau  oo4ape  ieiyslm raumont4tlenxo3iadlpteaivi;t0srxoxo3iu4ameelfcslsfsrraur ;t0oeeomfeiltls2umn ont4 renioctytlmDraies;t) etrxr no1al  mnet tfsDtm(mpnt1tet ioeiat sDeln pnu)arerxo iydfmDrlieslt s2um(mpiodale mivs tfa2uaur oo4tptn o3iytls2uluvsnt4 reoxr3iadop rlnvs;s0texrir ny1amenmncil(  ruax o;t0ale  o3ildls2ea(ms u) exnmr tydfatraueils0 rtrio3iydopen fct ( srumxro;t0tptnmoetyslmDrau snu0artoxociadlmt  n i t) 2xrxr3oy4am nmfeias  rrrxmp;o4optnio3ildla2ulump;(4tltrio3iotlaDeluvi;( t2tmxr no1al nlivtas aDtaumpno4oetnmoctys m2elu s;u)aexrmocootopDeln i () exrir3no4om   feils) rtmxmono4optn o3iysls um( s;(0 rxrmocia1fatran ol( t2xmxr3iodapt  icilt artrx oou4oltoioctytlm uln p u4 rtrif3oatlatelnvo s0 2um(r3ou1amen ivils)arum( o;t1aexomfciytlmDul(mo u0texrio oatomDraueil()s2trir no1ap n ivsls artrur ou0oex  feiat mDeauvs u) lermr3ty1omt anvo;t teto(o oodapen ivt sfsrurumono1alen o3tatla em(vp (4trtrxf3iotlatelies t0 exmirpny1aptnmfei tfartrxmpnt0oeeomociltlmDeanvo;(0aetrmrcoo1fptrlivo;s) rxrim iu1ol emneslt)sDtrum nu0optomo3iyt m uanvs (0teerxo oa1fatraies;s0s2xmim3ny1apeemnetls srtm( poo1aptnmf3iad s elumpn()trermfcoytopt luvs s t2urxr iu1lptelici ( aDtr( ooo1aptnmi3tysfsDea(ms u4alxoxf iotom  ln s;() 2toir3nudlm   nvslt aDur( pno4tptnmf3tasfs2uln p (4 lxnir3iatlmDeaues t)srumio3no4lmt  ivsl( a2ra(ront0oetnifetld mDeau snt)aexoio oatom  an o;t0 2uoim no4alte fvt (fsDua(ronu4tlen fciat aDumuvp;t4 lxrxo3iotfa r i slt)sruoxr3nu1lm  lnctl()arrm( pnu4apeomfciytfsDum(vo;u) lermr oydom rln s ( trurxmpiu4op nlivsas)sDrmumpoo1optoiictlt s2rlums;() ltrmf oydop e n o s0 exm(m3ou4lpt mnvsa( s2um(mo;t0tle ioeiytfaDuanmp;() lxoxocoy1lpteluvo;s)seto(rpio1am  mfvsa(  2rm( pou4optn i3ilsfaDum(mp t4 exnifciodlat lues;( s2uo(m3ou1lp  mivsa( a2tmump;u0aee  feils a ul(vs t4teenmoctytlptean o;() 2xrxo iu4olt  nvs t)srtr(rpou4oetomoeiydls2rln sn() lxoif3oy1fmDrlivi t trur(o io4al elfvsl( aDraur no1alenmociltfs ra( p t)aeerxf3oydoate u o;( s2xoir3oo4olen nvta(fa2tmxrpou0openifctls s2rmnmo;t)altomr3oydomDe ivo t0seuoir3ou1ame lfct (faDtrur ot0tpenifctlt aDem(vo t)teeoxrctotoate ivi t t2urim3no4ame  icia(fsDtmumoot1tex  f3ild sDuan snt4 lxnmociodfpD lu s s s2toio3ou4om emieslsfarurumpoo1oltomieiat mDul( p;u0trxoif oatfp eai o;(0srumxmpiodlm   nesltf 2rmuro;o1aetn feiysfs umumo (4 etrmf3totlm r uvi s0srtrxrpoo4amt mfvtasf 2trx  no0aee moeiltlmDuau p t0alxoxocty1lpD luei t)t2um(m3iy4aptnlivs t)srurur no4aexo feilt s2rm( s t0alenxfciytfmDr ues;()s2urir ny1op emfvilt)s2umumooo4oltomoeilslaDea(vs (4artnif tadfm  aivol(0trxmxrpnodlptnmfvtat aDua(mpnu0oetomoetadfaDulu o (0tlxrxf iydoa   ies;(0t2umir oudlmenlfvs (faDrrump;u1optnifcildfs2uaumo;u)tlerxrcoa1fa rlnvs;( sexoxm iy4lp nlicilt sDraxm ;o0tleomfeiasls emnvp ()alermf oydfateaues;t  exrim3nydll emnct ( arrmumonu4tlx mi3taslm eanvpn(0aexnxo iytfmDrlivo s) 2to(rpoo4ole mfvsls)a2trumpot4oee io3tlslaDea(mpn(0tltoxo oa1fa e ues t) rxm(m oodal nmnei ()a2ur(mooo1oetomoeiad s rmnmp u4trtrxfciydoptranvi;t t2tm(m3nudom emncsls aDtaxmpnt0tpe  f3tytfs rau s;(0 lxoif3oytopDeluei t t2tmirpnodlm nmnesl(  Dumuroou1oetn oetad m2rluvsn(0alerir oodlpDe n s s0srxmxr ou1lmenlnet s)aDtm(rpnt0oeenioeilsfm um(vs u0 ltrmoctodomt  ues t t2umio3oy1lleelictl(f 2raxr ;u1tpt iicilslaDrl( snt0 ltrmr3ty1lmteai o;()texmim3iudlmeemiesa()sDtmx  nt1tpxo ieilsfa2umuvp (0tetnif ia1lp  livolt  2to(o io4openmnesas)arraum nt4teeoiociys mDemnms;u0alerircia1fpteliesl() rumimpio4omen nci s  rrr( pno4alenmfciadls2eanvs;u4teeoxfciadfmD anei (0t2xmxr iydlpenliei t) 2rrur no4tle mietls sDrm( snu) rtnxo3todlpDrli ol( texrxm oydll elnetls) 2umx  oo0apeoif3tytlsDem(mp;t0trxoirctodfm rlues;s) exoxr nu4ale lfcsasfa2rrumoot0tet micildla2eaumo ()tleoio iydlp eluvsls s2um(opoy1ope lietatfaruax oou4tpe iieilslmDrl(mo;t4texrmr3tydfpDrau i;s s2xr(m nudoltelfctas)arta(  nt1altnmfetadls2rm( p;u0tetoxrcto1oa   iei t)srtoim3oo1aptelics ( s2tr(ro;t4aetoii3taslsDuanms u4treoxocoy1lmDeanesls s2um(opiy4apt mictlt  rtr(r ;u0tlen fciltfa ua(vs t4trtomo iatom  li o;t0trxmir3ou1amtnlnvilt aDumxrpou1apxniieias a2em(vsnu4teenmr3iodfmDeauvi t texmxrpoodalt lics sfaDum(mp;t0tleniiciatfmDrmnvs u4tlxnmrciatfp   ivs s) rtm(r3oudlltnlfeia()sDuaxm ou0aptn octys a eln o (0 rxoxf iotla eauvolt0srumio3ou4lmen fetatfaDumu ooo1tltoii3ildlmDeau o t4alxoxo oydfm e uvs (0sexmim3iodam  mfetl()srrr(mo;u0teto o3tadlm eanms;t4arxrxo tytoa   ivol(0teuoim oy4opeelicsa(f Duaumont4tleniiciaslm2ea( o t0arermr3iydlpt  i olt0trxrim3oy4ll   fctat)aDtmumont0olxomi3tyt aDulnvp;t) rtrxo tatlpDe u sl()t2tmxopno4al nlncslt a2tax oou0tltn i3ias m2rl(vp;t) etnxo3oydfaDeai s s  rumim iy1al elfei (f 2rm(mo;u1apxnioctldls2ra( p;()alxoxocoadfm rlu ols0 etrim3ou4lm nlfetl( sDtruro;t1tpeo f3iat s2ua(vo (4tlxnxfcoatfpD aieo (  exr(rpnodopen nvsl(  rtr( pnt1apxnmi3tytla2em(mp;u)alxnmrctotfp ean i s)seur(opoodam eliviat) rumxro;t1oexn iciad m rlnmsnu0aeerio oa1lmt ln i;t0teto(o oudaltelfcslt  2um( pot4tpt mi3ils m rmu on(4alenxr ootom rli o;s0 2xoxo3no1omtn net t)a2umx p;u4oexn fcilt aDeanvs () lermfcoatfa r nvols0trtmxo3oo1om  lfciatfaruau  ot4aleomi3iyd s2eau s;(0tltrxociytfmDelnei (0 exmxo3nu4ameeliei (  Dra(mono1oetoif3ilt s2rl( snt4 rtrxfciatfaDr n ols)srxmxrpou1ll  mfviatf rrrx  nt1aptn oeiys mDra( pnt)trtrxr3oydlaDran o;s)trumxr iy4opte fvsas  Durx pno0tpe ii3tatfsDrmn o;u0trxnmociytopte nvs s t2xoxo3ou4om e nvs ()aruaum nt4tpt  ieilt a2eauvo (0alxrir iytlaDelneo;() 2toxr oydlmtnmnci (farumxro;t1oex  feiysfs rm( p ()aexoxfctadfa elnes;()t2xmxopny1lp  mneils)a2um(m no0aeeomietldlm2eau pn()arermr3ty1fp eanvils  rum(mpno1am elncsat)a2umu  ;t4oeeo f3tldlm ulump;t)aexrio3iatla  ai ol(0 etr(m3nodlpe lfvt s s2umx  ou1oleomieiadlaDuanvp;t0artrmocta1laDrlivilt trtrxr3io4lpenliei t artmurono0apto fcias a2ra(vs (0 eeoxf3iotfa   ieil(0trtmir oy4ol nlfvt sf 2uax pnt4oeenifctas a2rmn s;u) rerxrctotfp eau i;s0 exoirpio4ll  mies t) ruaxmpnt1tlenmi3iadlmDrmnmsnu)tetnmr3oatfa eli s;t t2tmxr3oudllenmfvil(farta(m nu4teenif3iat a2raump;t)alxnxrcia1oatranvs (0srum(m3io4amte ncsl()sDurx pnt0tlto i3tytfs2rm( pnu0 renif oadlm elieo;s srxoio iy1olenmfcsls artru ont0tleoio3iatfa ua(ms;t4aeerxfcoytlp rliei ( trtm(m3nodamtemfctls)arrmx pno0oltnmietytfa ea(vsn(0 rxnirciy1fmte uvo;s0sexoxm nu1lmee iesat)s2uaxroot1oet mfeiyd m2rln o;t0 ltoir iatopDrlnvi ()seum(mpnu1opte fcsa()sDua(rpnu4open feildlaDrauvo;(4 ltrxfctadopDelivo s)t2ur(mpny4ome mnesl( sDumumpnu4tptoifeilsfm rmn s t0 rxoio3tatfm  lnvols  rtoimpny4ape lnetas)aDtrumpot1aetn ieiys sDra( sn() exoio3oadlpteau slt trxr(m ou1lmtelfeilsfarurumpnt1tlen ictadlmDel( s u0aetoxociatfmteaieo (0 rtrxopoo1ome lncslt srra(rp;t1ole ii3iysfmDrmumpnu0teeoiociotoptr n i;t trxm(o nudapt lnesasfsDua(  ot1tleo fciysla umuvp;t0 leoircoytoa r u ils trto(r ou1lltemncil( s2uau pot0tpt ifetysfm2emnvo;t0alxomr3iotom r u o;t)trto(mpnudaleelnetasfsDum(mp;o0altniieiaslmDeanvont0texrxr iotfm ran s (0trtm(rpno1lp n icta() rumx  nu1aetomfctlsfmDel(mp t) rxrxo3tadlatranvo;(0 rtoxr iudopt  ivs ()aruau pot4olen oeias a2emnmp;t0aetrxf3iodlpDe uesls)trurio iydlptemfciatfs2ur(mpou1texoifcildls ul(vp (0aetomr3ta1fp  li i;()tetoxm3iudll  lfesa(f Dtrx  ;o4texoio3iytlmDulumpnt)aetoxrcoo1lateai sls)setmirpno4lleelicsas s2tmx oot4tex if3ilslm2emumsnt0trxrxf ta1laD aivslt0 2umxr ny1op  lfetat)s2ua(mo;t4optoifciysfmDra( o (0treoif3todfa r n o s0sexmxo oy1lm e fes tfartax oou0opeo iciytls2eluvs;() exoxf3oo1faDelnei;t) ruo(m3nydlpeemncsl(farrrurp;t1opt mo3tysfs2elnms;t) eeoif tatop rluvs t  2toir oydalee ieta()a2ua(  ;t1apt mf3iltls emums (0aetrmrcoy1fp eau o ()s2urxrpio1omee feias aDtrx o;t1tlx  oeils s um(mp u0aeenio oydomD aivo;()teurio ou1lp emnci t  Durx  nu4ale iieiysfs2ranvonu0teenio tytla   i i;t0srxoir no1am elncias)a2uax  ;t4tpenif3iysfmDra(ms;t0 etrmrctytfa  lu i s sexrxm no1altn ivtl(f Dumuront1oeeomieiytfm emuvsnt0trenmr3oo1op eln o;(  2tmxo3nodamtn ict (f rrrx p;t0tptnio3ias a2el(msnt)artnxf tadfm rau i s)texrxopiu4ame mncsat)a2tru  nt4oet mociat aDul(vp;t0 etomf oodopt lueo t0trur(opoudoptemnetl(fsDtaxmpot4aeenifciatls2eanvo;t)aetomfciytomDelueol( srtr(m3oy4aleelfeta(fartrxmp;u4open f3ildfaDuan p;u)tltrirctytlpDr uvilt)teuoxm iudlle mnvt sfs2umx  ;t4tleo feildlm rm(vont0 ltomf totoaDr n i;(  eurxr no4ll nlnesls)arrm(mpno1olxo i3tltfsDra(mp t4 renmf oo1optean i;t s2trxm3oudaptnlnvs sf 2rrurp;u4alt  fciad a2eauvsnt0altrmrciydoa r uvol(0texoxrpoy1om emnvsat  rrrurpot1oex mieiyt mDemnvo (4tltnifcto1optelu s s) ruo(m3oo1ome livsa(fsDumxmpnu1apxnmo3tydla um(ms (4trerxr3io1opDe iesls0t2xmio ou1lme  fvs () rraxr ot1olenmf3iydlmDul(monu)trxnif io1la eau sl()t2uo(mpou1amt lfctl(fa2ur(m no1tee ifeiasls rlu p;u4alxrir iodoa   u i (0tetoxo no1opt mivi t)sDrm( ono1oeeo ociltlm2eln o;t) etoio3oa1omteaueo s) rxmxmpoudlpe  fetas)s2taurpnt0tle io3ias m ulu p t0altniocia1lm ean s;(0teuoxr nudopenlics t)srta(r ot0tlx mieiatla2rl( s;t0aeeoifcoodlmDeau o;s) 2to(o3ny4lpe mfcsatfsrrrx oot4tleoioeiadfm rluvp u4teenio tytopDeaneols0t2tm(m3nu1lpt  nvtas) Durumpnt0tptnmf3tat a ea(mp;()tetnxocoatoaDeanvs;t)trxo(o nodll n nvilsf 2ra(mpno4oleo octldlm elu o t4 ltrxf totoa eaneo;t srxm(o iudame  fvtas arur(mo;t0aet mo3iyt s2ul(vonu)tleomfcoa1faDe uei;s) rumirpio1llen nvtatfsrrmum oo4tleomoeilslaDrmuvon(4aexniociydlmtrlnvil( s2xmio iodlm  lnvi ()artaurp;o4oleo oeils a ra(vp;()teerxo3oadfa  ai o;t)trxoxrpou4lmtemivil()sDtr(rono0tpxnmfetatlaDel( s t4 eeoxo io1la eanvi s0trxmir ou4opt mfvtl(fs2urxrono0tlxomieiad m ea( snt4 reomocta1lpDeau il(  euo(rpio4lpte fvi s artaxrooo1aetnmocildfsDrmuvs (0tetnir3oydlmt aneilt) rxoimpoy1op nmfcsasfaDrrxmp;t1aee ioctys s2uaumo u) rtnio oytfaDraues t)t2xmimpio1ap   iviltfartmxrp;t0teeomieiaslmDrlnvpn(4alxnio ootfm elneslt) 2xoio iy4lpt  fvia()srtrxr no1tptnioctytla2rl(vs ()trtrxrcoydlaD  nvo;(0teumxrpoodolenmncs sfarrrxr no1aexomfeiadlaDra(mo u)trxrio todomt ai s ()sruoimpio1op n ncta( s2urxr ;t0tle mo3iydlaDrauvp u4 rxrirciytfp e i s;t)trtrxm3ou4ome mictls arumum oo1ope mi3ild m2el( o;(0tltnir oydlmD  nes t)t2xoxopoy4lm emivtasf Dtaur nt1aexnmf3tldfs2ua( s;u) renifcoa1lmDeaieolt) exmio3iudopee fcs tf Dtmurp;t4aexomoeiat m2ra( s u4tlxnmr oy1optrlivsls0tetmim nu1olenmnvslsfa2ua(mp;o0alt mociyd aDean s t)texrif3oodom rlneo s trtr(r iu4lmt lfeslsf rrmumo;o1alxn f3iyd s2ua(vp (0teerioctadfpteanvs;t0 eto(m3oy4op e ivtlt  rur( pnu1apx  ociat sDrln snu)artnirctydlpDrai s;( trtr(m3iodoptn fvilsf Drr(  no1tex  feiyslm em( sn(0tlxrmr oy1fm elivilt sexmir nudlpeemiei s  2ur(r nu4aleomicildla umnmo;u0 etrmo oydoaD ln i t s2xmio nudaltnlfctl()a2rauro;u4tex mfcild mDrlu pnu0 rtoxo oatom elues;s  rxmir3iu1am nmfeiasfsDrr(rp;t1alxn i3iaslm umu sn(4tltomrcoatfp e nei t0sexr(o iydap   fciltfsrtrx oou1teeniiciytfaDrauvp u4aexomo3ootlm rliei s0seurio nydlle liet tfa2ur(r ot0tltnii3iasfs rmnvpnu)trxnxr3iytlmteli o (0s2xr(rpiodap  lfvtltfsDrax  ;u4alx  oeiatlm rlu o (0 etrxr iodlpD  u ol()s2uo(mpoydll elfct (fs2tr( o;o4tlxn ictytfs2umuvpnu) lxrmo iadla rauvs s)srxmiopny4apenlfetlsfaDrm( onu1ale moeias a2rln s u4aeeoxfctatla  aneo;s0 eur(opoydaptnlfeia(fsDrm(m ou1tlx mfeias mDuln s;u4 rerir iodom rauei;s0srumxmpou4lpee fcilsfa2rr(moot1ope mietat a2uaums;t4 renxf3oadfpte nvo s)s2ur(m iu4apeelici s)arrrx ono4alxn f3tasfa rlnms ()alxnmr3iadomDraues;()s2tmimpiu4olenmncsat a2ra(rpnu4apeo f3ildlsDelu p (4arenir3oytop  aieil() rur(opny1am  mfetls s2ra( ono0tpxoif3iatfm uauvs () eeoxf3ia1op   n ilt  rto(rpno1op n fet tfa2raxrp;u0apx  i3tat s2uauvs () lxnif3oydfpDr nes s) rumxr3no1ol e nvtl(fsrurumo;o0tlx  f3iat a2umnmp;t) renxf to1laDe u olt srumirpio1lltnmfvt sf Dta(mont0tpxnifeias sDum( onu) lxrxf3iydlaD  n s s)s2ur(mpoy1omtnmici () rtmxmpnt0tle  o3iydlm2uauvs ()texoxo io1late nvsls s2uoxmpiy1alt  ncta( s2umur ;t0oetomfeiydfaDranms;u4texrxo3ootoaD  uvs;t)s2uoxrpnu4al elncslsfsDum(mpnu4teenio3iadlm eanmo;t0 etrxr to1fpD livs t0t2um(r3oudamt licsat)s2ta(m nu0tpenio3tas m emuvp;u)altrmrctotopD aivi;t0 2xo(m3nu4olen ietlsfs2trur ;u1opx  oeilslmDemnvp;() etrmfcoy1fmDeauvsls) 2tr(m iu4am  mnet s s2urx o;u4olenifctadfaDemu o;t)trtnxr iotlm ranvs t s2xoim3ny4opte fcils  2rrumont4olt mo3iltfs2rm( snt4tleoif iodlpte ieil()setrio3nodlpeelfci (fs2ua(rpno0tex ioeiatfmDea(vo;u)arxnir to1fmt  n s;s) rxmxrpou4omtn fvil()a2tmurpnt0tex mf3ias a uau s;()alermfcoatlm rluvo;s0tetm(m iy1ol nmfetasfa2raum nu0oetnmfctasfsDumumonu4tltomo tydfptr i ilt0trxmxo iu4lle  ivia( srrmx  ;o1aeeomoeilsfs2emuvo t0 eenxr tadfptr ieo;( texoxr nu1op nlnet t)arrm(mont0ole ifctys mDrmuvpn()tltoxrctytfmDrlivslt tetr(m no4llenmnvs ( aDta(ronu0alxnmictatlm2ua(vpnt4trenxo iotomDraneo;( s2toir iu1amtnlivtat) 2rrxmpot4altomociyd a2ulnmpn(0aexnmf oo1fmt  ieo;s) rtm(r3oy4ole mnvilt  Durxmoot4olx ifetld a2rl(msn(4teeomr oytfpDelies s)s2umxr3nodal  mivtlsf 2ur(  ot1oetn ictadlmDumnmp;(0 ltnxfctotfp rlnvsl( srtmxo3nudlmeemfcs (  2uaxrpou1olt mociyt mDemn p t0 lerif3iatlpDean sl() exmxr3nodlm  mivtasfsDum(r ;t4oetnioeiydlm2eaums;(0 renxo ty1fmtr uvols0srtmir io1lm  mfctl(f rrm(r ou1opt ifciasfmDum(vont4arxoxfcoy1faDelies;s seuoir3oy1ol n nviat sDtr(mp;u1ape mi3iad m emnmo;t0 rxnxf3oy1lmDelu i s0s2tmxmpiydolt  fesls s2rm(  ;u0aptomicildfs umnms u)texomr3totomt  ueslt  etoir oodaptn fvil(fsrtau p;o0oltnmfeild s emumpn(0 ltnxf iotoaDelivi s)trxm(m oo4lmen fei t aDumu poo0tet  ietls s eanvo;u) rxoxociatlmD anvi (0 2xrxm iy1omtelfctls  2trur nt4aex  o3tldlm em(vp;t4tetoif3iydfpt lu ol()sexrio oo4lleelicsat srrm(  no0apto ieildfa2rlnvs u) lenmo iatop r u s (0setmxopoy1al n iesls)sDrm( poo1ape  o3ildfa ea(vp t) rtrif tatfmtraneil( t2tr(r iudapee ivias)artmurpno1apeo ociysfs2uau o () eeoioctadfa ean sls0teurxo nodaleelncias)sDtrur nu4tleomfeiydfaDrm(mpnt4 eenxrciatla eaieols0 ruoxo iy4om e feiltfa2rrurpnt0openmi3tys aDul(vo;(0 exrir3ty1fa   iei t s2xm(o3nodopeelfvtls  Duax pou0aeenioeiadfsDel(vs (0tlxnmfcoydlatrlues s0 etmir3ny4apt mnet () 2tm( onu0tpxo fetltfs umump;u0 exoio iydoa e nei s)s2umxrpiy4op  liet sfsDur( o;t1aeen i3iadfm rauvo;u4tltomf3tadop r ivi s0 exr(o3nudom e fcs s s2umx  ot0oetniictyt m2ulumont0tltrxr oytlp  ai i;s trto(m3oodap elnvsatfarrrxr ot4opt mo3iltlsDuan p t0tltoxrcta1oa rau s s0 rumxm nu4altelfet t  2ua( oot0tpt  feiat m2ra( p;u0 rxrirctotopt  i i;t  rtmxopoy1opt  neias) rtmxrp;u1aptomf3iadfs2eanvo () lxomf iytom  lues s0trtoimpoydomenmnetat  2ur(mpoo0ape ii3iadfaDrau o;(4trtrircia1oatr nes;s  2xmiopoudolt  icslt aDuax  nt4olt ifctaslm ran s u4tleoxo3iytlmtr ivo;t)trumirpoo4lp emnviat  Dumxrpnt0tlxnmociyslsDeluvo;t4altnxrcoo1om e uesl()s2umxrpoydape  ici s)a2tax o;u4oltn icildfm2rm( o;t)trxomrctadopteai il(0trurim iodoltn icils)s2rm(rpnt1olen fciatls2rm(mo t)trxoifcoydomD  n o t)sexrimpnu4optemietas)sDtr(  ou0aeenmfctlt m um(msnt4trxoxr oa1fmD an o s teurir iy4amtnmicilt)aDraxro;t0tpxo octydls2elumon(4areomo3ta1fmt  ueolt  2trxm nodamte nvsas aDrrx  ou1oetnmf3iltfs raums;u0 eeoirciytlm rlnvi t) 2xmxmpoo1olt mncslt s2rrx oou4olenmo3ild a uau p ()treriocio1fpD livo;t0teuoio3nu1lm nlnes () Durumont0aee  iciytlmDuluvp u4 etnir3iytopDr uvo;(  euoxr nu1op  lncta()srtaum ;o0tlx if3ias a2umn s;t0 lxoifctotomD ln sls teum(rpiydlmtnmfcsa( s2um(  ;t0tetoiieilsls2rmu s u0 ltrmr tatfmDe ueils t2urim ny4lltemivtl(  2uaumpno0tpxn feiadfaDumn o;(4tlenmfcta1fat li i (  eto(o nodll  licslt aDtmum no1tlenifciltla2ul(vp;() lxrxo to1lpt lieils)texr(o nydamtnmfci ()s2uax  ot0opxn f3iyd m2ua(vpnu4 lxnifcty1lpDeluvi;t)sexmxrpiy1al nlicsl( srrm( ono4tpxniieiytfsDul(msnu4 ltnxf3iy1lm  luvs t seuo(m iodaltemfvils)s2urum ;o4tlenmfeiyt mDemn sn(0arxrio3tytfm rlies;( sruoim3ny4oltelfvt tfs2tmu  ;t4oee ifetldfm2eanvs u4 rxomrctadoaDe nvs s0sexr(rpou4llte fvi t)sDumxr ou4oetomfeils aDra(vpnu0 eeoirctydfa e ues (0s2urim oo4lpe mnetatfa2ur(r ;u0tpen f3iadfm rmu pnu0 exoxo ia1laDraivs;s) etoxrpiodomte nctl(  rum( onu4olenifciyd a emn p;u0altrio3todlmDe nvs s0s2tm(opoy1ll nmnvsat)s2umxrpno1ope mfeiytls uauvs (4 rerir oydopDeli il( trxoim nu1lpee fci sf rrax p;t1oee moetysla2emnmon(0teermr3ty1fpDraieo;(0 etoio3ny4op nlfvi (  Dur(ro;u0tpt miciad sDea(mp t0tlxrxf oydopDe i i;( sexrxo3nudop nlnvsl( artaumont4oltnmiciadlsDra( on(4tlxrmr3oodop  anvi t trxoxopoydol emiciat a2uru oou4tlt iiciydfmDem( pn() leomocoodfpDe ivs ( trtrxo3oudom   fctas)a2tr( p;u1tet ii3iadlmDemnmo;u4tlxnmf io1opteai sls) 2um(opou1opeemfcia( a2rau o;t0oexo octyd s2ea( o t4 rtnxoctydlmDe uvs;t0 rxmxo3iydomeelfeil(faDtmxm ;u4tlxn ieiatfs eanvo;u)trermr oydfm elnes;s0trtrio3nodol nmiciatfaDtrx p;u1ape  ictyt mDum( o (0tlxnmf totopt  nvo;s0 exrxr3iu1al emiesa() rra(mp;o1ope iictad mDrlnvp;u) renmr iotomDeaivol(0t2tr(o nudomeemfvtas sDta(r no0alxoioetytls rau o (4altrmfciodlmDr iei s trur(opiu1lmt lnvsasfaDrmum nu4apeo feiasfaDelnmp;u0 rxoio3oydfpt  n s;s0setr(m3oy1aptnmfcsasfsrurumonu4oleomo3iyt a2umu s;()arenif oy1fptrlnvils)s2tm(o3oy4omt lfesls srua( pnt0apxomf3iyd m2rmn p u4treoxf iodlptr nvs s) etrxm3iydlmt mfet ( sDuaum ou4apeomfetldfm2eln o;t4 rtoif3oydfpD aivs;s tetoiopiu4amt lnetlt) 2rm(  ;t1altoifcilsfm2elnmpnt)teerio3tadomteanvslt)texrxm3oudap elneilsf 2rm(  no4teto fctytlm uauvp (4arxoiocoatlmt lu o;(0t2xmxo oodlptelfvslt)sDuau poo0teeniictadfa eluvp t4 rtomf oytfmD  i o;( tetm(r3iu1al n icils)s2rru p;u0tleniictadfsDelumsn(4 eeoxf3to1omDr u o;t s2xriopoy4ol  lictas)a2tm(mo;u0apeniietltla2elumo;t0texrxo3iotlptran sl() 2tmirpiudameemfvtat s2urum ou4aptn iciyt m elu p t4texoio iodomD anvi;t0 eumirpno1lm e nvias sDuaur nu0tpxomoeiyslmDul(mp u0trxnifciy1optelivi s0srtrxm3iy4ape mfci s  Dtru ono0opxn f3tas a elu s t4arxnmrctytfp r nvs;s s2toxmpnudaptnlfes s srta(mont0apxoifciyd a2ul( s u)teenxo tydfaD  uvs s0teumio3oy4lmte fcsa(fa2raur ot0aeeo f3iadlmDemnvs;(4aeenir ty1faD  nvsl( srurxr no1apeemnes s  rtax p;t0oeeo o3tltfa eauvo u4trxrxoctytfm  luvi;s)t2um(m oudap n ivi s) ruau  ;t4opt  oetasls2umu on(4teeoir3tadla elivslt) rur(o3oudopt  iet () rua(rpnu1oeenmicias mDemnvsnt4 rermfcoytfatrauei;t0s2uoirpno1omeemfvi t sDur(mooo0ale ifetytfm rlnvs t)trxrxo3io1fpDr uvi;s0 rxoxo3nu4lp  mfciatf 2rrxro;t1oeeoifetas a ra(msnt) eeoxr iodlm eluvo;(  2urimpnu1ll n iviatfaDurx pot1oeeomociyslmDel( p t0 exrirciadlatrauesl(0trurxr iodamenlnvt (f 2uru  nu1teenmfciyslm2rmn pnt0 eenirciotom  aivsl(  etoxr3io1op  lnvsasfsDuaxrpou1aetomfeiydlsDrl(ms;(0aexoxo3iy1op elnvils0s2xmio3oy1al   ieiat)a2rrxmooo0optnii3iatla2ua(mo;(0trxrmfcoytlm rauvo s  etrio3oydlmtnmfes s) rtr(m ;u4aptnmoeiydla2ea(mpnu0aexrif3iadoa  an s t0texm(o iy4llen icilsfaDrrurp;u4apxn o3iatfsDeau s u4 rtrifcta1opDrlnvsl( trurim iu1amen nesl(fsrumu pot4olen feiltlmDuanms (0aeeoxfciadfp e nvilt)t2umiopoydlp e fcias aDtrur oo0altomfeiasfmDea(monu0artnir oadoatelneo (0trumxm3io1am nlnesas)a2uaum ;t0oeto oeiatfs2rln snt0 lxrmrcoatoaDr uvs t teur(o3oydaptn nvi s  Dtrxrp;o4opeoifcilt a2rlu s;t)arxnxrctatlpDraiesls) rxm(mpoo4lme mfvslt)aDrax ooo1ale iiciyd m em( s u0 etrxr totlat li ols0srtr(opoy1omtnmiciltfaDrrxmpno1olt mi3tls mDul(vpn()tetnir oatlaDe neilt)s2tmir ny4lp nlici s) 2rr( o;u4teeomf3iatfa rmnvo;u0 ltnmocootlmDe ivsl(0 rtr(m oy4amenlfet s)a2tmx ont1aetn o3iatfmDum(ms;t) lxomrcto1fmtrlivsls srtmxm3no1lpenliet s)s2ua(  no0aexn oeiysfs2uau on(4aexomr iodlp   uesls) 2trim ou4oltelicil()sDrm(mpoo1olt  ictydlm rlumpnt) lxrxfciotla  anvs ( trur(o iu1amtn nvtl(  rtmxmoou0tleo fetls a ul( o;(0trtoir3oy1lp e nesl(0sexr(m3oo1lltnmfvtl( s2rr(mp;t1altoiocildfmDel(vont)trxrir iytlmDelu o (0t2tr(r3nu4ope  nci tfaDta(mooo1teeoioetltfaDua( s t)trxrir3iadoaD aiei;(0trumxr nydapt mict s)s2rax  ;o0tpe moeiad s rlnvo t4 etnxo tatlateaieil(0 eur(o3nudap e net sf rrmuroot1apenmoetatfaDeau s t0 exoxf iy1omtean ols0srtrxm3nudamt mnei ()aDrmxmo;o1apeoifciydlmDraumont)arxoxo tytfpt lues t0 rtoxm io1omenlfvsls) rrmxm ;u0tpeomf3iytfm2ranvo;(4 exnmf todlpt aues;t)srtmxopiy4om nlfcsltf Dtaxm ;t4apeo oeiyt s2ulump;u4 ltnmocia1fm raneil(0 2umimpoydalen feil() rrmxr ot1oee  ictyt m el(msnu4trxoxo3ty1fmDeau o;t0s2tmxrpoo1ameelfcs s)a2umxrp;o1oeeomfeiydfs2uln s t)teeoxo3iatlmDr ivi ( sruoim oydalenmict tfaDtmxrooo4ale mo3ias a ul(ms;(4arxnio3iy1lpDrln sls0t2urxm nu1lptnlfcs s  Dua( poo0texn oeiad m2ua(mont4trxriocoatlpt lneilt)t2xoxo3oy4ll elivtas)a2rmum oo0tpx ioetytfm rmu s;()trxnmf3oadoaD  n s;s s2umio oo4oltnmfes () Dtrumonu1oeenioeiydfaDul(mp t0altnif iotlptrliei;(0t2xrio3ny1alen ivia(  rumum ;t4aexo fetlsls rmuvpnu4tlxomocta1fatelieol()setrxo3ou4apee icta()a2umumo;t1ope iiciasls2uanvo;u)tlxrmr oa1opDrlivs;t trtoxrpiy1lmenlfetas sDta(rpot1apeoif3tyd s uaump;u0treoxf3to1lpDr n o;s) 2trir no1lm n ivilsfs2rru o;t0apxnifciys sDuln s;u0trxomoctatlaDe ivilt) eurxmpoy1lme  fesltf rra(m oo0tet miciyd sDrmums t4aleomr3tydla elu i ()teto(o3nu4am emiviltfsDumu o;u0oltniocilt m2ea(mo;(0altrir3oo1omtrauvi;t) rumirpno4omt livia(fs2umumoou0aptniociyslm2uau pnt4aeeomociytlm r nes;s)texmiopnu4amt lfvilsfs2rmu p;o0oleoifctysfm emnvp;(4aeeomr3io1op r i o () 2uoxo3no4lpe  nctat sDuaxroot1alxo o3iaslmDra(vsnu4alerio todop  aueo;( srum(r iy1lm  mfcsa() rum(mpnt0tlx io3ilslm ulumo t4tlerif3iadoa elieslt)srtriopno1omenmfetas sDra(rp;t0tle  o3iydla emnmo;t0alxrmo oy1opD lnvo s  exoxm nu1ap nmfci s  Draxmont1tle  iciydfaDeanmo ()arxnmf iy1oa  lneils0 etmxrpiy1lp  lfvia(f rtaxm nt0tlxo ieiys a2ua(vp;u0 etnxrcta1la   ivs t  2xrxm3iudlpen icsas) rtaxronu0open iciat s2el(mpn(0tetoifctatop elu slt) rtoio3oodalt  fcsas)a2rr( p;o1aptn octltfs ua(vp;u4alxnmrcoadfm  au i s) ruo(r3oudolt lieias)arrmumo;t4tetnmiciydfmDumums t)tlxnirctodfateanvsls setrxo nodol n fvi s  2rmuro;o0tlenmfeiytlsDrmu snt0aexriocoydfm e nes s0 2xmxr3oy1ll emictls sDuax o;o0apeoiociysfsDulnms u0treomfciy1fmt li i ()t2xm(r3nu4om e netltf rum(r ;o1aet  i3iytfa2rm(vsnt)teeomf3tadla rlnesl( s2to(opnu4apenlnet t s2urxmono1tpe  feiadlmDrm( pnt) rermo3ta1fatean o;s0setr(r3iy4lp nmivsas)srrr(mont0tlxn fetltls rmu s;t0 exrmf3oatlaDeli ol( s2tm(opiu1omeelncil()a2rmurp;u0tpe ifciysfsDra(vp u) eenmo iydfmtelieo;s  exrxr oy4lle lnvi ()sDtaurpnu4ale  oeiytfm umnmpn(4alxoio3iydopt auvs;t s2xm(o ny1omtnlfvtls)sDurx  oo1optn f3iasfaDra(vonu)alenif3oydomD aneils seur(r oodlm elfesls)a2tm( pno1alxoif3tatfa rmu s u0arxrif3oo1oaD anvs ()trxoxr3iudap   ies s)aDtmxro;u0tlx mictltfmDrmu o;u)aexrifcoydlaDeli ils0 etmxopno4lmt mieilsfarua(r nt0teeomiciltfm2rl( o;u) rtnif todfmt an sls0 2toimpoodlltemiciat) rtrxronu1olxoiieiaslsDrl(mp;u)tetnio oa1faD luvi s0srxoio oo4omtnlnetasfarurx  nt1apto oetytlm2elnmon(0 rtnifciodom r uvo;( s2tmxmpnodale  fvi ()a2rrxrono1tle miciytla2elnmpnu)aetomf3oodfm r uvo (0 exr(rpny1ol nmnvta(f rum(m ;o4ole  ieild aDean p t0 lxrxr oytla r uvo;() rxoxo iu1olee ivtls)srtaxrp;o1tlxniietltfsDran pnu4 lerirctodoaDr i s;(0t2tmxopoodalt mict ( srtaumpou1alt mo3ild s ea(mo u0alerxocoatlaDeluvs;( s2uo(r oydome lfvtlt) Dta(mo;t1tetoii3tysfa rln snt)arxomo3iadopDeanvi;s) exmim3io1lpt  ivs s  Drr(r nt0texn i3iltfa2el( s;(0texrmrctotop elu i t0 2tmxr ou1lpen nvsl() 2rmu oou0olx io3iltls2rmnvs (4 rtrircia1opD lu slt) exm(rpio1ape lfetl( s2um(mp;o4olxn o3iatfaDuanmont4aleomr3tatoaD lu s ()srxrim iu1al  lncs ()a2ra(mo;u4tlxn fciadfm ean s (4aexoio3iy1omD luvi;t)t2xrirpoodlpe  nei t)sDtmxr oo0olt mf3ils m elump;t)tlxoiocoatfa eaieo t)sruoiopny1lltelieta() rta( p;o0altnmfetldfmDrlnvp;() etnir3oatlmDe nvo t) rxrio iu1ome mfetat aDumx pnu0aetniictltfsDrlnvsnu0 lxnxfctatlaDe iei (0seuoxopiudaltnlfes t)sDrmuro;o4ope  o3ildlaDea( ont)tltomo3totom rlieo (0teumxr3nydoltnlietas  rurumpnu1opeoioeiydfa2rm( s;()alxrmr3oy1oate n olt) 2xoim3io1omt  fvsatf 2rm(r ;u4tptoiiciatfaDuanms (4 eeoxf3iadoat anes;s t2xm(mpiy4alee ies tfsrum(m nu1altn feilt s2ulnms ()trtnxf oadfpt lu ol(0 etrxr3iodame lfcia(  Duax oot4texnmietytlm umu p (4 rerxo iytoptrlivo t t2trimpio4omt  ict (fsDtrumono0tltomoetlsfm2rln o t0tlxoio3oodlm r ies s0trumimpno1lpe  netas) Dua(m nt1tpxn oeiys s2uluvp;u0tetnxocoytlm r iei;s) 2urxo oudol  mnetl(  rtm(moot4texomicilt s um( s (0altnxo3tydlpt lu i;() 2xo(rpoy4ll e fctas sDtr(mono1altomoetas aDrm( s t4tltoxrciadop  auvsls s2uoim iy4lmee fvsls sDrau p;t4apxnmi3iatlmDuauvs t4aeenif todfm  luvs (  exmirpno1lp n fct tfsDtrum nt1aetnio3ildfa2uanvp t) lerxocto1lpDranes;(  exrim3oo4lp n fcs (faDrm( o;u4oltn ietatla2rm(mpn(0 lenxoctydopDeai ols)texr(r oudolt mncslsfsrra(moou0olxnioeilsfmDemn s u4arenxr3oydlm eaieo s)texrxr oo1aleelfcsasfa2tmu o;o1texnifciad aDemnmp u0 ltnxo oa1omteluvi s0seuoxr oo1altnliciat aDrrxr ;o4olx  ieiat a eluvo;(4artrmrciadlptr n o t) 2tmxrpoo4omte ieias) rumum ;t0apxoifciyd a2rlnvp t0teeomfciydfm   uvs (0 exm(r nu1op n ncs (fa2taurono4tlxn ieiatfaDrauvsnu4tlxnxo iytlaD  n i s0t2xoir ny4lpt mfcs (  rua(mp;t1aexnmi3iad a ua(vp t)artnxo ta1optr ueol() rtm(mpnudlltemnvtat)s2ta(  nu0oetn oeiltfaDuln s u0artrir ia1om   ueo;s)trumimpnu4om  mfvtat a2rm( pno0aet  fetytfa em(vo u)treoxrctodfaDr uvsls) 2tr(r3nodlmtemfeias a2raxm ot1aeto fciasfsDum(vo;u4aleoir totla rln i t)trxo(mpou4ameemnvil()srurxm no0olenmf3iysfsDumums (4 exoxf3oodoaDeliesls0sexrxm3oy1ol elnet () rururoot1apxn fciytfs2rmn ont4artoifcty1oateln o s seuoir3nudal elncta(  Drmum nu4oleoii3iyd s2rlnvsn(4trxnmo totomDe i sls) exm(mpiu4al n ici s)srua(mpnt4tleniictyd a2umnvp;u) ltnioctotlp elieslt srxm(m iudom emnesas)artr(rpoo4texnmietlsfmDemnvs;u) rtoxrcoodlaDraies s)srxoimpnu4omt  fvsatfartaxrpno4tpen fctyd a2ulu o u4 exrxo3oytoaD aneo;(0seur(o no4lptn ncilt sDtmx  ;t0tex  i3tytfs2ulnvsnt4texrxr3todoate ueo s0texr(o3io4ole lfctlt s2uaur ;o0opxnifeiyt m2umumont4arxoxocto1fa  ai o t seumim3nydaleelfvta( srtmx ono1tlto i3iatls2ranvp;t0trerxr iodom e neo s texmxrpou1ap  mnci t) 2trxm oo0oeeoifeiydfm rmumo;()aexnmfcoodomte ieols0t2toim3ny4apeelfct t s2tr(  oo1oleo ieilsls2umuvs u4 lxoxrciodlaD ln i;( seto(m ny1alt  netas arrau  ot4alx  ociytls2rlump u) exnmfcto1lp  livo t) euoimpoy1om n fcil() 2taum no0tetoifeiydlsDumn o u0tetomrcoy1oaDrlu o ( srxo(mpiu4lmtn nvs s srtax o;o4aetomieiys m eln pnu4texoirctatlaDe uvs s teum(m iy1amee ietatfsrtaxmp;o1oet  oeiytlsDrmuvo u0trenxo oo1fmD anvo;()trtm(m oo4omt mfvslt) rtaxmonu0apxoiictasla rmn onu)trenxrctodla e neol( teto(rpiodal nmfei s sDtm(root4oeenmfciyslm2rlnvp;t) rtnio3oadoaDrluvs;(0sexoim ou1lm nlietls srrr(mp;u4alto oeiad m ua( s u0trtrifctydopDr u il()texmimpiu4am nlictas  Dtrxrpou4tpeniiciadla uluvp;t)alxnirctodomte ieslt)trxoir nydlm  lfvilt  Dtrx pnu1apxn f3tat mDrlnmsn()treoio3oytlptelu sls0 eurxm3no4ol nmivsa(fa2um(mpot1alx  feilsfa emums t) exomfciy1fm elnvs;( teur(r3iy1lm nlici tfa2urumoot1tle  icilslm emn p;u4trtrio3oo1op e uei;(0t2toim3oodomtn iviat) Dur( pno0oee ifctatfaDulu s;(4alxomociatfmt au o (  eur(mpiudlmen fetlsfsDtaxrpou1alxo fetltlmDuln o t4tltoioctotlmtrlies s0srurxrpiy4alee nvi tfsDrrxmooo4tlxn feiysfmDuanmo;u0trtomr3oo1lmtraueolt0srumxm nodalt lfetas aDta( o;u1ape iieilsfs rau pn(0aetnio3iodlat  uvo s seuoxm io4ol e fei (  2rmxmoot0texn ieiltla2umnvs (4arxrmf totlmD li i;t0s2ur(r no1omt  netasf 2tau pou1tpen o3tas s2elnvsnt0aeenxf3ia1lmtraueo;t)t2toxr oo1ll   ieia(faDrm(r no4apx mf3iltlsDemnvsnu0 etrxrcoytfmt lues (0 2uo(r3no1openlfvi sf 2rmx  ou1aptomo3iydlaDea(mp;u0aexrxr3ty1lmD li i s0teuoxrpiydom elncsasf 2tauro;t4aetn f3tasfs uan o;u4 rtnmo3iodfpDranesl(0s2urir iy1optn ncs s) Duaxr nu0opeoif3iatfs rluvp;t4 rerxr3oodfa  aneo;s) 2xo(opiydolte ict s  2tau ont0opt mfctasfa ean p;t4treoio oy1la raivo;(0 euo(mpiudap nmncilsf rua(mpno4opx if3ils aDulnvonu0 eermocoa1omt an o;s0t2xrir io1apt  iei t)srtm(rpou0tpe mf3iad mDrln o;() lenmf3tadom  anvi t)t2xoio oudlle mneilt s2umurp;t0teeniieild sDeau sn()arerir iydopt  ivo;s) etrxr3oy1omeelfctat  2rr(mont0tleomfcildlaDumnvsn(4arxnio3iy1opDe uvi;t  2xm(o3oy4alee icsa() rrmxronu1alxn fetatls el(vp (0aexrmfctydomtrli ol( trtr(rpnu1lptemnes (f Dta(mp;t1tptnmo3iydlsDrmnvs;u) exnxf totfpDr ivo;()t2trim iy4ll emivs s  rumxr ou4tet mi3iytfs2rluvpnt0artoio ia1fmtr uvsl( setrim iodalt lfeta(fsDum(r oo0ape mieiytls ua( p;t4aexoxr3to1fmDrln o;( s2uoimpny1omtelietas) Dtaurooo0aex  icildla2emump t)aetomociydopDeau o;( t2uoxm3iudlmt lnciat) Draxm no0aexomoeiltlm2em( o u0 leoif tytla rlnes;s)s2umxm ny1opt micias  rrmumpnu0tpto ocildls2ea(vo (0 rxrmr iotlmDeanvo t)srtr(rpoodopen ies t  2taumooo4oleoiociyslm2um(mp;t)tlxniocoy1om rauei;s0 2uoxr oo1lpenmnviltfsrumxro;t4apt mf3iltfaDea( s t)tltoxo3io1omtrai ols t2uoxo3oo1alee iet s) Drrurpou4olenmfetltfa eauvo;t0trtoio3iy1faD auvi s0setoimpno4ap   feil(fs2rm(rooo4ope ii3tyt m2rl(msnt0artrxr oatomDrlnvi;s) rxoio oo1alt mictl()sDuauroou1opxo oetlt a2elnvp (4aetomr to1fm elies t texr(o iodlle  ivsat)artm( oou0apxoioetytls2ean o ()arxoir3tadoaDrlies ()s2uoio oydam  lfcsa()sDuaurono1tet  ictytlaDrln onu0tlxrif3tytop   ieo;(0t2xrxr3no1olt mics (fsDrmx ooo1alenmfciyd s2ulu snu4trtnmr3tatfmDrlnei;(0t2xmxm iu4alt lnct (  2tmxmpnt1aetoiocildlaDumnms;(0alermoctadoptrliei t)s2xoir iy1op emnetlt) rtr(ro;t4aetnmoeiyt mDua(vs u0 rerxfcoatlat  ueil(0 ruoxmpiudapte fviasf rrmum ;t0tlxomfciytfsDumnvs;(0 rermoctadfmt lu s;t  etmimpio4op   nvta(fs2urxrp;u0alx iocild s rl(vo;u0 eerio oa1lm  luvs t)trtoxrpoodopeelfvilt aDtmxm ot0alx ioctasfm rm(vont0texoxrctatlat auvi ()teuoxo nu1lltnmict s)sDrrumonu1altn o3ias m2uan onu0aetrmf3iydlmD  ueo ( sexr(mpny4lle lnvs sfsDtr(m ;o1oee mi3tlt mDrauvonu0 rxrxr3iadoatrai s t truoxr iudomtemiesl()srtaurpot4texnmfctadfm2rlu s u4 etnirciodlmDe iei;s  ruoio nydlleemnvtas  rtmu pou4teenio3iytfm elu ont4trerxr oa1omDelivolt texrxo oydom  lfeslt sDtm(r no4tetomietldfmDeaumsn(0aetoif oadfmtr i slt)seuoimpnydol nmiciatf Dtru ont4olxn o3ilt a2rluvsnu4arxomr3tytlmt  n sl()t2urxm3oydlmt  ici sfs2rmurp;o4teen i3tas a2emn pn(4 eerxr3totfp e uvols  eurxmpnodom  lnvtas)s2ur(m ;o0teeo ietatfsDuauvont0aetrmf iydfmDeauesls s2tmir ny4ame livt sf Drrxrpou0aetoiocildfsDeluvpnu0 renir3iadfm rln i ( s2um(m nodol  liet tfsDrrurp;t4ope  fetldfsDrauvo u0 ltnir ootfm  aiei;s0 2toirpiydam emicia(fsrtrxr nu0aex miciydlm rm(vp (4tetrxo3to1lm rlieo s) ruoimpno4lltelivilt) 2umx o;u4openiociadfaDea(msnt0artomr iatfaD auei (  etm(m oydal   icil(f ruau  nu4oex  oeildfa ranmp ()treoxr iodoptrauvi;t0 rxoir3iu1lmte ncsasfa2urxr ;o0oexniieiydfs ran s;t0 rtrmr totomDe nvi;t0srxmim3ou4alee iviat sDtauro;t0opxo i3iat aDrluvs;(0arerio3oytfpt li ol() 2um(m3nydaltnmnei t  rua(moou0teeo feiydlm2rmumo;t) exoxr3tytfaDe neolt  exoxo iodllenlnct s s2ta( ono0oeto fciat a2el(msnu4 etrmo oadop e ivs (0trtr(r iy1llte net t) Drmx ono0tee mf3iytfa rm(vs t4alxoxr iy1om ran o;()trtoxm3oo4al elivi t)aDuaxr ;o1alxomiciadfm2ulu s u0tlerxrctodfa elivi;(0 ruriopoo1lpt mfciat arrauro;t1olxnmieiydla2el(mpnt0 rtnio oa1lmDean s;s0s2xm(opny4lmtnlici t)srrm(ro;t1apxomicildls2rmnmo t) ltrir oydom  lnes s)srxmio3iy1ll   nvtls)sDua(mp;u4tex iieiaslm ranvo;t4altnir oa1fa eanvols teurxrpoo1am   fct () Dtr(mpno4alxoiicils sDum( pnu) eeniocty1omteln sls0s2xmio3nudameelnctls)srtmxrp;u0oeenmfeilsfaDeaumpnu4 rxrio oydom rlnesls0s2umiopoydll  livtl(fa2rr(mpou4oeenifeiydlm2elnmon(4aetnmfcoa1optelueo t)setoxmpnodapte ici s arrr( pnu4tptnio3ildfsDulu p;u0arxoio3iy1opD luvils0 rxo(m3nodlpe lnvsat)sDra( o;u0tet  ietasls2eluvp u)tetnxr ia1fmt  i sl( trurxm3no1lmeelieslt)artmx ono0ole iieiytlm rl(mp t)trtnmrcty1oa ranvs;t0srxo(o nu1al nlfct s sDuaxm ot4tpe mi3iydlaDuanvo (0 ltomr3iadla eauvs;s sexo(o3iodop  lfvsls)sDurump;u0oeto oeiysls2ea( o;()artrmr oadoatr nvs t s2tmxm no4omenlictlt)artmum ou0alenmo3iatfaDuaumon(0aexoir3oo1fmt  i o;s)srtmir nu4lptemnct ( a2tauro;o1oeto oeiad mDumu p;(0aeerxr iotfateai ol() exoir3nu4lmee nci tf rraxmpou0olxnmfeiytfs2rmn sn(0trerif oo1laD  neo s teurim3iu4opt lfcsl( aDtaurpnu1ale mfctad s em( o t0 rtoif3ty1fa r neo;() 2uoimpiy1al  lfvsl(fa2rruront1apt mfctldlm2rlu o t0arxoxociy1fm elu i;( texmim oodlme  fvtl( a2tmurono0ole  fetydlmDul(ms;t4aetrmfcoatlate nvs;t  etmimpno1openmietatf Drmx  nu0alxomfcilsfa2ulnvo u0 etnmf iydlmDr uvo;s0 exmiopoodlm nlfvt s aDumu o;t4tpx iociyt aDelnmp ()aeeoxf3oadlpD livo;t0trto(opnydlmt mictlt  2urxrpot1apxnifeiyd s emumo;u)trxrmrctytfpt an i t0sexo(o3no4omee fcs sf rrr(  ;u1texomo3tatfa2rmnms t)tetomfcoy1omD ln sl() exm(mpoodopenmnet s)srrmxmpoo1ope mi3iat m ul( s;u) ltomo3totfa ranvs ( trxoxo oy4alenlictlsfaDurum ;t1aetnmiciadlaDuan s t4alxrxf to1lpDelivils) rxoxopoudamtelneslt a2uru o;o1olxnmoctydla2ea( on(4alenxo3oytfp eaies s s2xmim iu4omen ncilt sDua(  ot4oexoioeiytfsDeanvo t0 lxomr iatlmtrauvols)tetm(mpoo4ap  mneil(  Dumx p;u1aleoioeildfm2emnmp;t) ltrmr iotfptelnvi;(0 ruoxo3ny4ol nmnvtasfsrua(r oo1apxo iciydfs emu p;t) etrmf3tydlate ueol(0 2urxr oudalte fvsl( arrru o;u4olxomi3tatla2emums;u4trtnio tatfm   nvi ()s2trxm iudomtelfcilt)sDtaurpno1oex  fctatlaDul( o;t0 exoxf io1omDrlneo t srumxmpny4olenmfvsasf 2rr(r ;t0oexnmi3tyt s2eanms u4aeerxo3oytoaDr neo;() exr(r iydaltelictat srrr(mpou1alx  o3iad sDrlnvp t4 lerxr iotoate nvols0t2to(rpoudol  lnetat  Dtaxrp;o0apeo ictysla uanvp;t0trxomo iy1lp rlnes;t0 2toir3no1lltn nvias) rtr(mp;o1olxomoeilt m rmumpnt4tlxnir3oadfmDe nesls)srtmxopny1optelfeslt) ruaurpot4olxo o3tls aDel( p;t0 exrif iytlpt lu o;() 2tmirpny4lltnmfetat s2tmuroou0opxomictyslmDrau p;(4artoxr3tytfp eaivil(  rtoxr io1op nmfvilsf rtmxrpot0tlt if3iytlaDelnmpnt4areomfciotlp r ueils) 2trirpoy1ll nlnesat) rrm(rpno1tpeomictlsfa eau snu)aetrxfciydlmtrlu o;s0srur(r nydop n iet (fsrumurpot4oleo i3ildfmDrmnvo;(0 lerxo3todoateli ilt0trxoim iu1lm emnvtatfsDta(r ;u4alxomictldfmDeln ont4trtoxf3oy1fate uvs (  2trxm oudom e ieslt)s2rmx oou0tlxoioeils s ul( p;(4tltrif3io1fm  an s t srumxmpio1amenlfcta()s2ra(rpno1ale mfctld aDrl(vo;u4alenmr3oydomD li slt0sruoimpiu4oltn fviat)s2ua( o;t1tpxnmoctatfm2uau o;u) rerio3ty1opteanei;t0tetoxr3iy4oleelfet s)sDrax pnu0aleo fctydfa rl( o u)tltrif oo1fm eauvsls)srtoxmpoy1opee netls)aDtr(rpot4altnmfciytla ea(vpnt4aleomr3iodlmDrlneo;()setmxopny4alt  ieil( aDrmumpot0tlxo iciatlm2rlnvpnu0altrmocoadlpteli i;t)tetmxo3iy4ape  fes tfa2urur no4tex  ieiltfm eanvsn(0texoxo iatoa raneo (0s2xoim3io1apt livilsfs2umx  ;u1apt  oetyslm ua(ms (0texrxf oadla e ivo (0sexm(mpoodole lfvt ( s2ur(moou1tetnii3tydls2uau s (0aetoif todop elieil(0sexrim3no1llt lictls) rtmxr ot1optoiictad mDumu s;() ltrxr3iatopD  n o s srtm(opnu4lltn nct t  rtrumo;o0opxn f3tytfs2uau s u)texrmf oa1lmD aieilt)truoimpio1lm n fvia(fa2ur(rpnt0olxn f3iltfs2rau p;(0 lxnmr oadlaDeanvi s0srur(r3nu1lm   ncsa( aDtr( pot1tpxnmi3tatfm2emn s;u0 rxomocio1fatelu o;()texmir3ny4om n ivsl(fs2rr(m ot0ale ifeils mDeluvpnt) rtrmf iytop r ivo ( t2um(m3oo4apenlfeils)arumuroot4oexomieils sDum(mo t4tetrxrcoatlmt lu sls)srxo(o iu4omenmfei (f Drm( pnt1tpt mociyt s el(vs;(0teeomfcoatfat lneolt setmxo nu4am nlnvilsf Dua( pou1tlxn iciyt a2rmnmp u) exnmr3tatlat ln slt)teurxr io1omt mfeils s2uru  ot1oex  o3ilt sDrau s u0texoxf3oydlpDe ivolt0 2tmxm3oo4olte fvs s)sDtr(rpnt0oetn oeiadfsDeluvsnt)aeerifctatlpteaieo () rumio3iydlmt lieslsf Duauro;o4oltn ocildfs2rm( s;u) lerxocootom   uei;s)s2umiopoydome  fvtas) rtmxm nt4aptoiictlsfsDem( p;t4texoxocoo1fa e nvo;t)s2ur(r3ou4apt  neil(fsrurx  ou0tlen f3tlt m rmu p t0alxniociodlatrlivi t) 2xmxmpnydop  mfvtatfs2rrum oo1olenmo3iysla2umn snu4arermociotoa eauvs;(  2xmirpiy1lpen nvi tf Dtrur ;t0opeo ocildla2elu pnu4tlxoir3tydlmD lueo;( seur(mpiu4omt  fvsas  2rauro;o1altn i3ilslm umuvsnt0 lenir3oatoa rlnvo (0trum(opoo1apt liesl( srtr(ro;u0tet iicildfmDuluvs t0 rtrxocoatlatrauvo;(0t2um(rpiy4oleemnvsl() 2ua(mpnt0tpxomoeild s ean s;u4trerxo3iodomDraues t) ruoxrpio1am elnesltfs2rr( oou4oltnifeilsla2rlu s u0trxoifcoatom  lieol(0trtrxopio1ap elfvtlsfa2tmum nu0oet  f3tatfs rlnvo u)alenio oy1oa r u sls) 2um(m nudapee neia(fs2tauro;u1tpeo iciydfs emnmsn(0trtrircto1fa eauvs ( s2um(rpiy1altelneiasfsDurumpnu0tex mieiltls ean on(4trxrmfcootfpt anes t0 2xm(mpny4om emfciat srua(mpoo1aet ifeiyt mDulnmo;t0altrxrcto1oaD luvi;()t2tmimpiu1ll nmncta( a2rrx oot0altomictytls ua(mo u)tlxrmrcoadfptr neolt truo(r3no4optelnvi (f 2rm(  oo4tetnmfciasfs ulnvo u0aetrir oodlm e ieil(  etr(mpiudope  ieta(fsrumurpnu1texo i3tlslsDrlu o (4alerxf3oydlm e nvs;t)srtoiopnu4apt livil(  Draxrp;o1tpe  ociasls elumpnu0alenxf oy1om e ivi s0srxr(rpnodopt liviltf 2um( ono4oetomo3tldfa rmn p;(0aexomf3oatoaDe i il( trumim oy4lme mfvtasf 2rru  ;o0aexnmicilsfsDea(mo;()aetrif3iotoptr ueolt)t2xmiopny4altnmfviltf rtru o;u1oexo iciytfm2ra(vs u) rxnmrcoy1laDr i s s)truriopio4ap   ncta()arur(m nu0olto ietatla2emn o;t)aexrxr totlp rai s t) rxrxmpnodal elfcslt  rtru pnu1ape if3ilsla2rau ont) rxrio todoatelivo;s)s2toimpiodlme lfct (f 2tm(  ;t0teenmf3iydfa2umuvo;(0altrmr tadfpt li s s0t2umio nu4lp emfeilt) 2uaur nu1aetomi3tatfm2emumsnu0 lerif3iotomteaieolt0s2umir io4aleelivi s a2ururoot4tlx mf3iyt s ulnvs;u4 lxoxr ootlpDraivi t0t2umxo nudom  licilt)aDtrum ;o0apxomfeiltlmDelnvsn(4 ltoxf iydfm  lueo t0 2xo(o3oudlm n nesl(fa2trx pnt1tlen o3iasla2el(vpn(0 renmrcoatfpD livo;s0setm(o3ou4ol elfvs s) 2rruronu0apeomieiadfsDeanvp (0 reoxr3iytopDr neslt s2tmiopnudlpt  fvs t srrmxrpnu4tpt  octydfm2ulnvpnu0 eeoxocio1fmD au s;s)srumxo3oodale  ivil()srurxm ;o0apxniiciad a2eau sn(4treoxr iotoatrluvilt s2tmir nodomeelfes s) rtmu ono0oexoiictas a ea(vo;u0altrxo tadomt au i t  2xr(o3iy4ll elivils srtrx ont1oltomfetydls2umn snu0 rtoiocoydomDrlu ols0texo(r3iu1op emnci t sruaxm ;t1tlxnif3iydfm2ul(monu0arxniocoy1omDeluvs;t) rto(o nudlm  mfvs sfs2umxr ot1aeeoii3ilsfsDel(vs;() etomo3io1fm elu s;s0 rtmim3nudamen ncia( artrurpnt1apxo iciydfs2rmn p;(0 reoxo oytfaD auvsl(  rxmir nu4alenliei ()aDrmxrp;t4apx mo3tytlmDrmnmp;(4artoxo3tatop elnvo t0 eurxr3oo1lle mfeslt sDrax onu0oeenmictas aDel(vo () exrxf3to1om r u slt) rtrir3oodaptnlici (f Dtm( oou1tlx moetltlm eaumo t0alxoio oa1fptrlies ()srxmirpiu1lpte fvias  Duax  nt0opeoioetydfmDra( pn(4aetrif to1lptelues;s s2tmio3ny4op  mncslsfs2tau o;u4oetoii3iys a uaums u0aexrir ta1lmteanvs t)srtrxr iy4olt mici () 2tm(r oo0tlenifetydfsDrmnvont0 rtoio iy1op  aivo t)srtm(m3no4open iesa(  Dtm(m oo4opxn fctyt aDrm(mp t4aexnmo oydlaDrluesl(0srumxrpio1ol nlfcils aDraxroot1apen fctys sDeau o;t4trenxo3ta1oaD lues s)sruoxo io1om  lfvilsfsDrmu  oo1opeo oeiysls ra(mont4alxomf3tadfp  ln olt t2xo(rpiudopeelieil(fsruaxr ;u4aexnmf3ils a em( sn()tetrxo iytom  auvi ()truo(mpnu1lm   iesa()a2uru  ;t4aet  oetysfm ranvp;(4treomr3oodop elu i;t) 2toio iy4lmee fetas artm( pnu0oex  oeild s rmnvo;()aexnxocoodomDrluvi t setmio3iudlpen ivs (fa2rrur ou4tlxo i3iyd s ranvo (4tlxomf3oytlpDr neo t  2to(opnudomt  ivsas) rrm(mp;o1tltomociydfaDea(vs (0artoir3to1lmDeai i t)trxm(m3iu4lmtemiesas  Dtrxmont1tpe io3tlslsDrl( o;(4 rxrmf3oydfaDe uei t) rumxmpny4om  mivi tfsrraur nt0aee mfciysfs2eanmo;t4trenircto1lmD  ueolt) rurirpiu1am e nctas)a2ra(m no0tlto i3iadlsDeln p;t4 renio3tadoaDr u o;(0sexoxm ou1aleemfcsat  rraur nu1ope mieiad a ea(vont)aexrmo oy1omDe nei;t  ruoxr3iu1lpte nvi (fa2um(m ou1tpe io3iyt aDran on(0artriocta1oa  lneslt srtr(mpnu1op nmicias arrru  oo4tlx  i3iyd m emuvs;u0 ltoxrciodfpteaneo;t)t2toimpoy1alte fesasf rururp;o0tltn i3iyt aDum(vp;(4arerxf3ta1fa rai ol( setmirpnu4op  lfesasf rrr(root0tpx ifcilsfsDrmnvo u4aexrmf iytfp e ivsls t2urxrpoydom nmivi s sDra(m oo0olt  fcildfmDeanvp u4 ltnirctytlatr ieil( setmxr oudal n iesl(faDuax  nu1oleomieiyslm2umnvsnu)teeoxfctotlmt an sls  2trio iudlmtn fvi s  Dta(r ou0ale mieildfsDumnmp (0altoxo3iotfa rli i t seurim nodlleelnetas) Drmxrp;o0alx ioetadlm emnmp () rxrir oadlat  ieol()sexriopno1lltemnvta( sruax o;t4teenmfeiydla2rm(mo u4 rxoxociotop e ivils0 ruoxopiu4ol e fcs sf rtmump;t4tpt ioetatla2rmnvo;u0aexomo3oo1op   uvi;(0t2to(o3oy4lpte nvtasf 2uau p;t1tpxn feiyslm um( s t0trtnxrctodla elueo s0teur(o no4amt  nesa(  Dua(mpot4tlxnioeils a2ua(mp (0tltrmfctotomtelneo;( s2trxm ny1op e neta(f 2urx o;o0olen i3iasfsDuluvonu4altrio3iodoateauvslt srxrimpiy4lle lfcia()srra(  ;u0tlxnio3ild a2em( s (0 ltomf3iytfaDeai s (0srxoio3oudlmee ivtat)s2rrum ;o4texoif3iadls ea(mpnu4trermr3oatlmtrliesls t2uo(m3oy4omt mnvtlt) rraurp;t0aptnmoctls m2ra(msnu0 etoxrcoy1fp rauei s0trto(r ou4lpt lfeil( srraumo;o1opeoioeildfs2eanvp;t0arxomo3ty1faD aivsl() exrxr3no1lp  mncias)sDtmxmp;u0alt mocilslm2eluvpnu0tetoioctodfmteluvs;t)teur(m3nu4open ivsa(f 2uau  ot0tpxoio3iadlmDranms u0 exoxf oodla e ueslt  rtoim3oy4lp elncsasfsDrmx  oo1tpxnmociadlsDranvs;t4arxnir ia1lmDrlnes s)sexm(mpnu4lpt lfcias arumu  ou0tpt ifetatfm ea( s;(0trxrmr3ia1faDrluvo;()texmir oy1ale  ivia(farurx p;t0tlxo i3tadlmDea( o () lxrmo3to1om   n o;s) rxmio3ou4lle mncil()a2ua(m ;o4oeeo ieiadfm2umumon(4tltnir oatlm eln sl(0trur(opno1op  mfvta()s2urur oo0tlt moeiadla2umumon(4 lxnio3oadfm   nvi;s)t2ur(r nudlpte feia(  2tm( p;t4apeo o3iasfsDel( o t0aetrir3tytoptranvo s0t2tr(r oo4ll nmnvsa(farum( p;t1apxomfctyt a rmu s t0arxnmo3tadoa eaivols teurxm iu4llen ivi t)aruaurpnt4texnmoeildfs2uaumo;u4 rtomo iy1lat ln sls)setmxo3oydlpeelfeiasfa2ur(mpnt1ale  f3iysls el( onu)artrmr oydfm e nvilt0teurio iudlltnmnvslt)aDurxmoou4alt ii3tlsla ea(vsnt) etnxo3oy1fpteanvol( t2umxmpnydamt lfci ( a2trurpoo4opt moeiytfm2ean on(4tlxoifciadopteaieo;(0seuoio3iudomenlfetat  Draurp;u4aexnmieiytlmDemnmo;(4tltoifciotfmt anvo;t t2xrxr3ou1alenmnetl() rurxrpoo0oee ioeiyt mDua(vp () rtniociatom  luei t)seur(o oodopenlnvta(f Draxmpou0tlxomiciltfm eln pnu)tetrio3iy1oatrai s;s  rtrxmpnudlptn fvi sf 2umxmpno1tpt io3iat s umu p ()trtrxrcoo1lp rlnvsl(  2umxopnu1omtemivia(faruau o;u4alx if3tytlm el(msnu4artnmr iadop eau sls setoxo no1ape mici (  Dtmxm ou4opxn i3tatfs2uauvs () renio ta1omte uvsl(0srxo(opoy4omtnmfvs t) Drrxr nu1apxn feilsfs uaumonu0trxrmfciadlmt  iesl() 2xm(o3nudoltemnvtat)srrmxmpou4alxomo3iyt sDemu o t4altrxf3oa1fp e iei t  2urxm nudomtemnvt t arrmur ou0aptomf3ias aDem(mo u0tetnmr3oatfptelivs ()seumir3ny4op nlncs (fs2rrx oot1aexn oeildlm2eanvo;u) lenxf oy1fm rlivsl( seuoiopnudam elics t) rta( poo1tet mfeiyt m ul(vo;u4trxrmocoadlaD au o (0setoio oydam  livsls) 2raxr ;u0tpt  ieiadla ra(mo ()aexrxo3oy1om rlneo;t trxm(m oy4ll e nvt tf Dtmx p;o0tltomi3tlt a rmnmo t0teenxf ia1fp   neilt0seumxo3iu1optnliet t) rrm(ro;u1alxo iciysfs ra(mp t4altnifcoodfmDeau i s  exrio oudaptnlieslsf rrrxr ;t0olenii3iltfm emumpnu0aexnmf3oatfpD aueils  2trio3ny1optnlicsa( a2urur ou0tlt ii3ild m2eanmont4texomo iytfmDr n s;t  2xr(opoydlltnlnesas  Dtr(ro;t1aeeoif3iad s eaumo t0aeeomocty1om e iei t  eumio3nu1lp  lfcils  rtrum ou1ape  ieiltfa umnvsn(0tlxnio3tatfpt  uvi;s) rurxm iu4lme licsls)s2ra(mo;u0olt moetldfs ulump ()trenmo tytfa ranes;(0tetmxmpoy4olt lfeilt) Drrxm nt0apx  f3tldfaDul(mpnu0 etnxf iydlpteaueslt  exoxm3nu4oltn nvtas) Dumxm ;o1tlenii3tytlmDra(vp;t0texnxf3iy1fpteaues;()srtm(rpoodol n fcil()srrr(rpno0olt  fciatfs2eanms;()teeoxfctodlaDrai i;t)trumiopoy1aleemivsl(f Dtrxm ;t1olxoioeilsfs2uaums t0alxoxfctodfpt anvs;s) 2toir3iydalenlfvtasf Dtm(  ot4tee mfetas m2em( p t) rerio3totlate ueo;s t2xm(opny1lltemicsa()a2tmxm ot1tpx if3tatlm2raums t) leoif oy1lmDr n ols  rumxo ou4lmeemnci () rur( ono0apxomf3tltfs emnmsn(0tltnif oo1lm rlu i;( s2umimpno1amtnmiciatfaDuaumpno4ape mieiysla2ulumo ()texnmr iatfaDe uesls)trurxrpnu4al elietas) rrrxmo;t0opxn oeiltfaDrl( p;t)trxoxf iatoptr i sls s2xo(rpoydlpen neiat a2rrurpou4aptoif3iatfs2emnvsn(4tetomf totlpt lies;s)trumir3oy4lltelnctat aDurxront0openifctad sDrmuvsn(4 lermfcoy1oate ues;t  euoxr3nodopenmneil(faDrrxro;u0aexnmociadlaDem(mpn(0 lxrxo3todfp r ieo ()tetoxm3ny4llenlfciat  2uaumpot0tpeoif3tlsls2emu o;u4 lxnxf3oydlpDrli il(0teuoxo no4alenlnei t) Duru o;t0teto oetad sDul(monu4tetrmf3ty1lp r ueo (0 rxoiopiu4lmte fciatf rrmu  ot0olxoioctltfa emu pnu) rxoircta1fpDeln o;t  eumxm3iy1lme lfciat srtaxroot4olenmo3ias aDra(vp;(4 ltoxo3ta1laDr ivi;s0 exoio nudlltelnct ( aDrm( pnu1alxoioeiytfs ranmsnt)aeenxocootfmD aivi;s0 exr(m3nudam nmivi t) 2raur ;o0apeo ieiad s2eanvo t) etnircio1fmtr ivo;( tetriopiodll  lfcsas a2ta(r nu1texniociadfm2ul(mo;(4tltnmfcoadopDrlu sls0s2uo(o ny4lpt lnctlt)srrrumpno0apxomf3iatlsDra(mpn(0alxrxf3totfmte ivo;t s2umxr iu4al nmnctl(fa2ra(rpou0apx if3iyt m el(mo (0altrir3iodop eln s s0trurimpnydlltnlncslsfs2umx  ot4texn o3iadfmDua(ms t0 etrxfcootfate nvsls0tetoio oy1apeemfvs t)sDumx ooo1aex  iciydfa umn on(4 etnxf ty1lp rlieo () rtrxr3nydap nmncilsf Duax oou1aeenifcilslmDrmnmpnu)alxomo ia1faDe i il(  2xmirpnudllee ivta( sDurxrpoo4texomo3tlsfaDelu p;u4tlerio tatoptean s s)truoxr iy4olte ics ( sruaxrp;t0tlto f3iad sDuanmo;t0trenmf3io1omD  uei t)tetmxrpiy4ll  mietlt srumxr ;o1tlx  o3tyd mDulumo t) exrio oo1oa e ivs t s2tr(o oo1lmt mncias)sDum(r ;t1apeoii3tldla uaump t) lerxf3io1opDrlues s texmxr no1altnmfvslt)aDrrxm ou1tpt ifcilsfa2emnms (4tlxrmf ootoaDr ues;(0trtm(m3ou1omte fei () Drauronu4alx  feiatla2ra(vs;()aleoirctadfp elu il() 2umxmpnu4omeemfvtat)aDraxro;t0ape ioctltfm emnmsnu4trxnmo3iatom rln ols0s2trxm3iu4al emieias) rta(  no0tlxn i3iltfs ean o;u)alenio oytlatelivil(  etm(r oodaltemnvi (fsDtru p;u4opeomf3ias aDrau s;(4texoio3tadfmtraivo;s texoxm oudop elfvslt)s2rm(rpot4aeeoif3iadla rmnmp u0 eeoif iadoa r nesl( s2xr(opoy4am nlivil(fartmxro;o0aee ioeiydfsDrm( s t) eenif iotlm  lueo;s  2tmxo3oo4opeelicsl(  2ur(  no0tpenmoeiadfaDeaumo t4 etnir3iatfpDe nesl(0s2uo(m3oo1lpe  nvi ()sDrau ont0opxo fetltlmDuan snt4 rtnio todfpt  nes t s2tmimpoydoptemfvtatfsDtrx ooo1oexomo3iyslsDumuvpn() lerxr oadomtelnvil(0srtoir3no1op elivsls s2ra(mpot4alen ictytls2rl(mp;t) renxf3oa1fmDe i i s t2urxm io1al emfvilt  rrm( p;u4tpe mietydlm el(vo;u0alxnio iy1omDr uvo;t t2uriopnudole lfet tfarrax  ;t1tee miciat m2uln p u4 etomr3ia1opteau s s0teurxmpno1amtn nctltf Draxmoot0tlt ifciydls2ua(vsn() etoxfcia1fm e uvo (0 rxoio iy4llen neslt)a2umumonu4oeto fctatfa ul( o (4altrmf3tydoat ln i;(0 exrxo3nudapte fvia(  rrmxrp;u0optnifctasfm rmu p;(0teerxo3totfmtr n o s  2trim iydlm nmfvtlt aDtr(r ou4tpen ocildfs umu p (0trxrmo tatfpt lnvi;s0t2tmirpnu4am elicilsf rra(ront4opxn ietasls2rl(monu)altomrcio1fa ran il()tetrxr3iodll nmfetls)aDtm(rp;o1oex ii3ilsfs2ranmo;u)alxnif oadoatrauvi t0s2umxo3oodaltn fcsltfsDuaxr nt0tltnifciadls ean pn(4alxnio oatomDr uvs;s  rtmxrpoo1ap n fvil(  rtmu pno0apxnio3ils aDulnmp;t0 lxoir3iodomDeauvsl()texm(m3ou1ol e iet tfs2tmumpnu0aexoifeild m2eanmsnu0trtoif3oy1faD  neo;t)setrio iu4lme mnvtasfsrtr(r ;o0oleniieiasfaDran pnt0trtnio ia1latr uvi ()trto(r iudamtnlivslt a2rmurp;o1opx ifeiasfmDrmnmon(4aetnxo ty1op ranvil(0t2trxr oy4opeelivil(  2ra(m ou0aet io3iltlmDea(vs u)altoif3to1fa elivslt t2xr(m3iydlmen fctat)sDrru p;u1aee iocilsfa2uanms;u4 eeomrciytoa e u s t) eurxr nudop  liesas) Dtr(  oo1ope mi3iysla2uaump;(0alxnxoctotopD  i s s0teuo(m iy4lltnmnvt tfsrraxmpou4texn fcils a2eln sn(0texnirctadfmtelivo;t trxm(rpnu1lpenlictas srururont4olto o3tyt mDemump;u4alxrirctodlmDr n s;t0 etoio iu4aptemncta() 2urxm ou1opeoifctatfm ulumsn(4texoifctadopDr n s;t  rto(m iu1omt lfes t) Dum(rp;o0ape ioeilsfa2rl(mp (4tltrxfcoo1om rai o;s0srxr(o3iydlp n ies () Dum(m ;u4tleniociytfm2umnvpnu) eeoiociy1opDelivs t0seur(rpny4omee ici t a2uaumpnt0opxomf3taslmDranvs t) eenmo3tydopDelivi;()seur(o iu1al elivia() 2tru ont4tetnmi3iatls2uanvo t4 ltnxf3iotlm eai sls0srtrir3oo1amee nes () rumurp;o4oeenmfeiatfm2rlnvp;t)arxrmf iy1opDeai o t s2urxr iydomt mici (  rurxmp;t1aee ioeiatfs rm(msnu4aetrmo to1lp rlivi;s0srtm(opio4om elnvt () Drrur ;t4opxnif3tldls2uaumo;(0alxnio3iodoa raiei;(0texoirpno1lme mfvtl()aruau p;o1tex ioctldlaDrlnvo u)trtoxf oytfmte n o (0s2trxr3ou1am  lfei (fa2raur oo4apt  iciytlsDra(ms;t0teeomrcoatlmDr i ol(  rxrxr nu4lmeemict sfsrua(ront1aetnmicilsfa2rluvon(0aexoioctodfmt  nvsls)srtm(m3no4lpee fvsl()aDurxro;u1ope if3tadfa2uanvp;u4aexnmf3oadlpte i il(0 2umxm3nu1ale lnvtlsfaDta(m no0altnmfctltls2uluvs t) lerxr3tadfa rlivs;t)tetmxo iodame  feiltfsrururpou1ole  ociaslsDrln o t0 eenmo3io1fmteln s;t)s2umxopny1lp n neils a2uaxrono4aptnmoetytfs rmnvs u4texoxrcoo1fmDeai il()tetmxm3oy1om elietls)a2rrxmp;o1tlx  fciydla umumpn(0treomr tatfpD au s ( s2xr(opiydapt  nvi t)a2tm( ono0opeo fciltfa2rluvp;t) ltoif3tytfpt  nes;( srtrimpiu1lpenmnctlt)sDraxro;o1altoifetlslsDea( o;u0 rtnmrcia1fmtranvo;t)setoir3oy4ol emncsl(  2rau  nt4tet ifcild aDuln ont)arenio io1op  anvs s)sexoxr3oy4ap   fct tf 2urxr ou1tltnmfeiys s2el(mpnt) lxnif3to1fptr ies;()srxoxm io1opee ics sfartax ont0olen f3ilt a2rln p (4tlxoxr tadlmteluvi;(0s2xo(o oo1llt lnvtlt a2rru onu1altoifciydfm el(vs u4arerxf ty1lat  ueslt)t2tmim iy4lmen ncslsf Dumum oo0aleomfciad mDrluvo;()areoif3oo1lmDr uesl()s2xrimpnudlltnmieta( s2rrum ou1openmoeilslaDumuvp u4areoxr iatfmD lnvi (0 rtr(r iy1op nlneta(fsDuaurpou1oex  i3iat m umn p;t4aetniociy1oat anvs;()t2tr(rpoodlp emfvta()a2umuronu4olxniociad a ranvont0areoiociatfm   i olt0s2xr(o no1lpte feta( srrax  ou4olt mi3ildla2um(vs;t)trxoxo3iadomte nei;s0seumir3iudap elivtlsfsDrr(m no0opto o3tlsla umu snu0tlxnmfciydfmte u sls0 rumxo oudlme lnvta() 2raxm oo0apxn o3tyt m ulump;(4teerxfcootlptraues t0texmxr3oo1am e fesat sDtr( pot0tleo o3tas s el( o u0 etrmfcto1lpDeln s;t) rtmxopoydomte fct () 2rrumooo4ale  ociyslm2rau o;()artnmf3oodomDr ivo;t0sexo(r3nodlm nlfcsat) 2rm( pot0olt mf3iatfmDea(mont)altnxf3ty1lmD au sls0seur(rpio1lme lfes t)s2um(m oo1tlxo fctldls2rau p;(0 exoxo iytlateliei () exoim oy1opt miviasfsrrr(rpou0aetomfciltls eau s () etnxf iadlp eln sl( t2trim3oudomt miet (  Durx ooo0tetnmoetltlm uanvp (0aeeoxocoodomte i s;t) exoim3iy4altnmfvsa() Drr(moou4optnioeiydla elu s t0 etoxf3iydomtraivi;( sexmxm3nu1amen fcilt srrau onu1opxnmf3tls aDumuvo;()alxrmo3oo1lat lieilt sexoiopiy4openlivt t)aDrmurpnt0aeenmfeias mDrlu snu)alenio oa1lp rlnvo;( texrxmpnodlme  fctlt)aDrm(rpou4aeeoii3iyslsDuluvo (4aetnmr3oatlmtrai s;s srurxmpnodam   ncta(faDrau  nt1aeenifeiadfs ean onu4arxoxocoy1lp eluei;t0 eum(m oodaptelfvsl( a2uau o;t1tlenioeiadfs rmnvp;u0tlxrmo3oo1fpD aues s  rtrirpnudaltn ietl() Dtm( o;o4aetnii3ild s e
\ No newline at end of file
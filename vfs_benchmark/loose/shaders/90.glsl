@@ -0,0 +1 @@
+n o s0s2uo(mpoydopenmiciat) Dtmx  ;o0opx ioeiasfsDrau s u4 ltrio iytlpDr i s t)texmio iodapt  nvilt) Dururp;u0tex miciyd mDelu on(4 rtrmr iotlmDeaivo;s) 2tr(opiy1apee ict sfa2rr(rpot4tleo octyt s2eanmont0 renmr3iytlmDeaieo t  2xm(mpio1ope mnct ()artax pnt1altomfctasla2rauvs ()trxoxf3io1oatrai sl() rum(r ou1omt mfei ()a2tmxr no1alt ifciydls rlnmsnt0alenmr3iytfptrlivo t0 2uo(m3ou4aleemnciasf Duax  ou1apto ociatfm2eau sn(4tltrmf tytlmD lnei;(0 rurim3nu4apt lics sfaDta(mpnt4tpen feiys a2uau s;u4 lxrmfcta1fpt ai i ( setoxr oydomee ivi ()artrxm no1alxn fetld a2ua(vo;t) eenxr io1lp r n s ( trto(r3oy4apen ies () rtmurooo1oexoioetlslmDrmn o;()teenmo ta1la   iei s0t2uoio iydap elivtls)sDtru  ;o1alx  feilsfa ea( o u4artoxo iydfmt an o ()texo(r iydole lnctl(fs2rrxmp;t1optomieils s ul( o;u0 lxnmocio1omt luvilt trtrxr oodomenmieilt)aDtaumonu0ale ii3iadfs2uln o (4 rxrxr oytlmDeaieolt) eto(m3io4oleelnetls srtm(monu1optnmoeias m umuvont0artrxf ia1oatran i (0 ruoxopiydlm emietasfarumxmonu0tlx moeiad s ea(mpn(4 rerxo iydlm   uei;()seto(r oydlltemieias srrmxrpno4apxo ociaslsDumnms;(0 eenxrciatlpD lneils0texrir3iydaltnmfcsasfsrua(moot0tpe  fetat m2rmuvs;u4tlxrxrctydom ranes;(0 etoiopno1lltnmici (faDra(mp;u1olto f3iltfa2uluvo;t0 reoif3tytlptrlies;t srxoir3ou4lp nmncils  rra(mo;u4oet ii3iasfa2ra(vp;u)tlxrmrctytlaD au s;() exr(r3ou1alenlict t)aDrmx onu0oltomf3tldfsDuauvo;()aexomf3iotlp r ies;s)truoio3no1ll   net t) Dum(m ot4tpenii3iysla2um( pnu)artnmo iotop e uei;t0srxr(o3io4oltnmnetl( srrr(ro;u0olxomfetyd sDumu pn(4artoif3iydlate nvilt  2xrxr ny1lmeemfvi t  rrau  nu4oltoif3iatfs ul( ont) reoxo3tadfa rlivs ( sexo(r nu1amt mncslsf 2tr(  ot4aetn i3iyslsDumums;t)artomociy1lmte u ols teurio3io4lpenmivsl(fs2tmum nt0ape ifcias a2elump u4altnmf3oytlmD anvslt  eur(o3oy4lp n nviltfsrrmum nu4ope iicild m rm( o (0 lerxf oa1lpt aueo;s0 etoir3nodlmen nes s  2rrxr no0tle ii3tysfa uln s;(0trxrxrctatfa eaivs ( teuriopiu4lltemies s srrrx onu4tpx mocildlm eanmon() lxnmr3totfptrlu s t0srumxmpiu4al nmfesasf Durx  nt1tlenifciatls rmn snu)arxrxrcoy1fmDe ivi t0t2uoio ou4omenlnesat arrax p;o1aexnifetadls raums;t)aleomrciatomDelnvs;t0s2xmiopoo4optemnet sfartaxro;t0altnifciad mDuluvp;u4aetoirctytopt  u s s trxoxopiydam n ivil(fsrta( o;o4tee ifciytfsDum( on()tltnxf iy1op  auvil( trto(mpiu4ame mfeslsf 2tmur ot4tlt ifciadfa uln pnt4arxrif iy1faD  uvil()trxriopiy1lpeelnci tfsrta(mp;u4optoiictys m el(vs t0artnxr tytopDeaiesl()trxrxmpiy4lle lfvtl(  Dtm(monu4tlx  oeiyd a2um(mpnt)arermf3iydom   u i t0 rto(r io4opee nes (  Draumooo0texoifciydfsDrlnms;u0 rtoxr3ty1la eluei s t2uo(m no1lltnmnvt () rum( pnt0tltomo3tasls rln p t4altnif3ty1optrau olt  euoirpiu1lmen fct () Dtmx oou4oet mi3ilsfs2rlu on(4artoir ootfaD lneils) euo(rpou1ol elnvias a2umur ;t4alxomictydfm uanvp (0tleomfciotfmtr iei t sexmxr3iu1optemivsas s2ur(m oo1opxomietatfmDelump u4 exnxf3oydla raies;s  ruoxm3ou1lpt  ivi sfs2rrxmo;u4olxniieiys sDea(von(0tetrmocto1om  li o;t)srxr(rpoudameemfcias)srrrx  nt0oexn ictls a emumo;(4alenmr3todlpD lnes (0sexmxo io1op emfei t)aDtmu o;o4oex ifeild sDea( pn(4tlxoxf3io1omt ln s s s2xrim no1lltn ietatfarua(mo;u0tpe io3ils m2ean s;u)aexoxo iotfm   uvol()s2to(mpny1ap  lnvs sf rum(ronu0apenifetlsfm rmuvon(0 rtoxr3to1om  an s ()t2ur(opnudolt mici s)aDtmu  nt1tetn ieiyd a rm( snt4tlxoxo3oa1fatr nvo ()tetoxrpoo4al  lneslt) rumu pno1opx ifetldls rmn p u) etnif iydlpt  neo;t  etmimpiudll nlnvsa(fartaxm ou1olen octltfa ua(ms;u) leoio3iotlate i s () 2tr(m ou4am  lfesas  rrmxm ;o0altoifeiaslsDeaump;u0artrxo3tytfaDeau slt0s2xrxr iodol  lfvt (fsDrmxrpnu0tleomfeiytlm rln p;() lermf3oa1fm  anes;t t2trxm3no1ale  netat)srumump;o0apto o3iysls eauvp t) ltrxf3tydlmDe nvolt trxrxm nu4ape lfvil( aDumum oo1aex mfctadfa rau o t) rtoxrcootfmtr iei s0s2um(rpnu1amtnliesat) 2rm( oou4aex iieiatfmDua(ms;(4teenmr3iydoptrlnvilt)texoxo3oo1ope  ncia(f Duru o;o1alen feiltlm eau snu0 leoif tytlp raieols seur(rpoydaltelnctas)a2ua( poo0oeen o3iydla2elumonu0altoxfciadfaD auvs (0s2xmxm nodale lfci t) rraxroot0tpen ietld s2ea(vp t)tlxomf3totomt an s () 2umxo3ou1amtelfvta( aDrrx p;o0oexo feiad aDranvo;u)tlermf iytfmtrau ols s2um(r3iy4om  mivsas)srumxm ;u1ale mieiasla2eanvs (0alxnxo3ta1lpDeli i s) eurxo3iydam nlnvtl( sDrrxm nu1tlx mictlslmDea(vp;(4artnxfcoydomDeluvo t)t2uo(o iy1op e feias) Drr(  ;t1alx  fctlt s ran s u4tleoif oy1lp  ai i;t  etm(m3ny4altnmfvi sfa2rrxro;u1oexnif3tad a2emn p (4tlxomfcoy1fpD ai s;t0srum(m nodopt lnvilsfa2raumpno1tex ii3iltlmDumuvp t) etrmr3iotom eln i;()setrxrpou1om nmfesat a2rr(  ou4opxoifeiad mDean o ()alerirctytopD  iei;s) rtr(m3iodop n icsl(fsruaxro;u0tpxoiietysfsDrmumpnt4trtrmr oatlptraneo;t)s2um(o3ou1ameelfesas)sDtmx  ;u0tetomoetltfs em(msn(0tltnmf oa1lmDr ivs;( seurxm3no1om n nct t  rrm( poo0tet iociydfsDem(vp;(4aexnxocootfa e ivi;(0srxoxo3oo4olenlnct sfsrrau  ot0olxoifeiadla rlump u) reoxr totoateaivs;()teurxr3nydol   fctat  Drmumoot1aptoii3tyslmDea(mo ()trenio3iatlpD aues s0tetr(o3oy4op  mfesl(fsDum(rpou4oet mociltlm ul(mp;t0 etomr oy1lmt luvil(0sexoio iodll elivt ( arraur no1olenioeild aDul(vp ()arxnmf oatom e n i s srxmxo nydop nmivt t) Dta(mpoo1tlxnifcilt sDrm(vpnu4tetnxr oodomD au s;()srtoxm iudol  mieias s2rau p;t0optn oeiytfs2ul(vo;t4 lxrio ta1lpD livo;(  rumio oo1al e nviltfsDtaumo;u4opto o3ias m2ulnvpnu)alxrmo3io1la  luvi t)seuoxm nu4apen iesa(  rumxmp;u0alen ietysfmDel( o;t4 exomfciodlptr nvi t)t2tr(rpno4lle mfeiat)sDraxm nt1opt  f3iaslm2rluvo;t) lxrirctydlateanvi t)setmim iudlpt  fvsl()sDumu poo1alxniictas mDemu onu4trtomf3tydoptraneo t)trtoio oy4olt lfvsat sDurum nu4tlxo ietytlm2um( pn(4tlxrio tadlpt lnvs;s  etmio3nydlp nmnvil( aDta( pot0tet mieiaslmDul(monu4teermocty1lp elivi t0srtr(o3ou4apte ies s) 2tr(moot4tet ifeiat aDrmnmp (0tlxnif3tatfpteauvi;(0teum(r3ny4lmtnmfvias  Durx pno1apeo o3iysfs2rl(mo;u0teenxr iydlp eauvo t) exoxopoydlp  mfvi (fs2rmxm ;u1ale mocilsfmDra( o t0teenio tatfptrluei;s0 etrio io1lp nlict t)artmum nt4tlxo ociltfa emumonu0aeeoxr ootfpt aivsls)sexrxr io4ale  feia(fartm(mp;t0olen o3tas a ul( s t)aetriociytop r ues;()s2tmxopiu4olt mnvtlsf 2uru  ;o4tle  ietyt aDrl( p;u0arxoxr oodfa rauvo;t)trxoio3no1omtnmicia( srumumpot1alen oeildfa umnmp t) rtrxocoodfmteaivs;t  eumimpiodlptnlncias artrx pno4tex mi3tyslm emumo u0teermo totfpD lnes;s)truoir3no4olte nei ( sDur(  ;o4teeoioeiyd sDrl( o u) eeomf3totfmte iesl(0trurim3nodlpenmfvt t s2ta(mpnt0teen ictysfsDelnvp;t0artomf3tadfmt  ivs;s  rtrxo3nu1lp  licsat a2tr(  ;t4alto fetys a2rm(vo;u4 exomr iatopD  uei;() rxmxo iodolt mnct ( srrax poo0tpx mfctas mDea( s;u0aexnmr oytfa eluvils srxoxm nu4al e fvtl(  Dta( oot4oet ifciydfm ea(mo;(0aleomr3oatla eau o;(0s2urxm3iu1olenlfetlt a2urxmpnt4tltnifetatls umn p;u0 etrmo3tatopt ai s;s0setrxr3ou4omeelnei s arurxmpot1altomoeiad a ua(vpnu0alenmrcio1fpDraivo s0teum(m3oodomeemnvtat)s2tr(mono0oexo ocildfaDul( o u0 l
\ No newline at end of file
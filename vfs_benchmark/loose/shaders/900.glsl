@@ -0,0 +1 @@
+n sls t2xrxo no1ale mncsa() rtau  ;u4teenif3iyt s uln p;t0texnmo3tytfptranvo s0 2xoxm ny4lle  fctlt) Dumum no4alenmo3tasfm rl(ms u4aetrmfctadoaD an s;t0texr(m3ou4oleemictas a2rm( oot4tlt mf3tlt a ra(mp t)arxoxo iy1fat li i;t) etrxr oodop  lies t) rra(  ou4aetnmf3iysfa ua(ms () renxf ta1lm eau i (  rxrio iy4lp e nesls)s2trum no0tpto ieiytlsDumuvonu4tltnxoctadfatraivi ( seuoxm3nu4olt mnci ( sDururono4apxo ocild mDrluvp u4 reniociadlaD  ivsls0teuo(r ou1aptn ies t) rraum nu1aee  iciadla uauvo;t)texomf ia1om eanes;t texmxm3no1aptemfviasf 2ra(mp;u1tee mfctytlsDul( p;(0altrmo tytom   nvs;t0truoxrpnu1amte ieil( s2ur(mpno1opxnmi3tydfm2ra(vo;t) exoif iotlp eanei s) eto(opnydop   nvs t aDtrur ;o1oeenmi3tydlmDumu pnu4 ltniocia1fateaues;( tetrxo3oydlm nmivsatfsDtrxmpot0ale  oeiatlm2eauvo;u)artnmo oytlat  nvol(  2ur(r3iudameelivsa()aDtr(rpnu0tpt  o3tyd s2el( o;u4 etomrcoytlpDrluei;() exr(rpny1ap emneilt  rua( p;u1aeeomfeiadlmDra(vsnu0tlxomfcoatoa r ieo () eumio3oodlle livs (farrmurpnu1opxomfciydfs2rlu ont4tlerxociatlat luesl()s2xr(o nu1lm nlnvslsfaDra(mo;o0aet ifctaslaDul( s;t4arerir3oo1omDeauvols0trxm(m3io1lltnmfcslsf rra( oot0tlx  o3iadls2eau p;() eermrcio1fpteau o;() etmir3iu1omtemfvi tf 2rrxrpnt4alt  fctadfm um( s (0artoif3iy1omteanei;s0t2ur(opiudlmeelivsa(f Durxm oo4alt mfeiysla ean p;t4aeeriocty1opt  nvo t)s2trir iydlp emfetl(fa2umxrpnu0aexnif3tad s2ua( o t4 etrifcia1oa ranes s0 rtriopiu4op   ici ()arrm(moou1texnmi3iytfmDean p u0 lenio3iy1fpD an o;(  2uo(r iy1llt mnviltf 2ur(  ;u0tex ii3iltlm ranvp;()arxomr oodopDrau o;s  etrirpiu1am nlfvs s artmx p;t4olxn iciadls2rlu pnu0texnxo tatopD lueo;t0seuoxopiudllen ncsls)srtrxm oo0alt ifcild a emumpnu4 rtnxo3ia1omtrauei t0 eur(opno4alee icilt srtau  oo1tle  ieias m2emu o;t) etnxf io1oaD lieo;() ruoxm nydlp e fvtlt)a2umxmo;t4opxoifciyt s eln o u) rerif3todop rlueol(0 exr(r nu1ap elfes t  Dumxm oo1oltnif3iysfsDeln s t4tlxrmf3iydlm  anvo;t)srxm(r iu1alt lfct s)sDtru o;o0aee  fctatla ran o (4alxnirciadlmDraieilt) eurio3iydomeelfeils)a2umuro;o4tpt miciytfs2umumpn(4aeeomr3oytfpD au s t0 2xr(o oydomtnlfei t  2rrxm ;t4aee  ietlsls2rlump t0 etoir tatfa r uesl( truoiopou4ame mfvias  Durxm nt4aeto ietltla ran pn(0trxoiocoo1fmtelneo;(0trxr(o oodoltn fet (f Drrumoou4olxnio3iytlm2eln s u4 exoif oatfpDrauei;(0sexmxopoo4lpt mnvsl(  2urxmoou4texnmietadfa ean o u)altomr3oydlmD an s s0trtrimpiy4ol nmnvil( aDur(  ot1oltnmiciydfsDel( pn() leoif3iatoptraneo t0seuoim3oo1olen ies s s2rrxro;o1apto iciltla elnvp u)tltrxoctadlmDeln s;s0srxrxmpoo1ol e ics (f rur(  oo1tpxoioeils s ran o ()tltoxf3to1fmtrlu s;( srtrio iydlpte nei sfs2rrumo;t0tpe  fciltfm2um(ms () lerir oa1oaDelivs s trtoxo3nydopt liet t  rrru pot0oeto o3iad s2ra( o;t0arxrxfcoodfa e i ol(0s2xoir3iydam e ivtlt)srraxm ;o4tlxn fciat sDeanmp () exrxr3totlpD lieolt  rxr(opiudlpeemfcta(  2tmurpoo0olx moeiys s umums;t)tleriocootfatelivslt0 etr(m3io4omt mfctlt)s2tmumo;o0opxnmieiydfmDua(ms () reoifciydomDrai s;s  rtrxm3nydll nlivsltfa2uax oot1oeeo o3iydfsDrmu p (4texoxf ia1omD aues;t) rxmiopoydaleelncilt srtaxrpou1oeeniiciasfa2emuvp;u0 eenmr to1opDeaieo ( s2tmxrpny1lptemncilt sDtrumpoo4aet ifcils aDelnvp (0 lenio to1fa raiei t0trxmxmpny1altemfci (f 2trurp;u0apt io3tasfm2eauvpnt)arxrmo3iy1fate ueslt0trto(m3io4apt lncta(fartmxmo;t4alenmoeiat sDrmumsnt0areoxr3oodoptr uvol(0s2umxr io4amen nctl()srrmu  no4tlxomi3iysfm raumont4arenif3iy1oatrlivilt0 2tmxm oydlpenlivia( a2trump;t4oexn ieiasls ul(vp t0arxrio oydla  li ilt)texoxr3io4ol n ivi (  rum( ont4alx miciatla ua(vp u) ltomrciytoatelivo;s seum(mpnydoptn nei s a2rmumpot1optomietldfaDea( pnu)aetoxrcootla  luvi;( teurim3iodomee ies ()a2rm(mooo0apeo oeiat m emu s;(0arxomfciodfaDelneilt0s2xoxmpnu1lmenmnvta()a2rrxmpnu4ale miciasfsDeau o;()alxomf3oo1faD  uvs;s) rur(opnudop nmivt (  2umu p;t4apenmfciat sDumuvont)artrmrcty1omt  uvi t0trxoxm oy4optn netatf Dururpnu1opx mictld m em( on(4tetoifcoy1laDelu s;() rtmir3iudomtnlnvt t) Dtaxmooo4aetnmieiysfa2eau p;(0texnxf3oy1omDe n ilt0s2xoxr3oo1apenmfvsa()aDuax poo1ole ifeiltfa2rl( ont4 lxomrcoa1omtrlu sl(0setrxopoy1lm   fesls)aDuaur nt4tpx ifeild s2rl(vp u)altnxfcia1op rlu olt0 exoim3nydom e fvsl(farrmxmono1oetnmi3iytfs ua(mp;(0artnif oydfmtranvi s)trto(rpoy4lle lfci t)aDtmx p;u1alxn ictlsfs rauvp t4 reoxo3iadfatraneolt) 2xrxr3nydol emnvsa() Dta(m oo1tet miciltla ul(vo;u)trenir3iodop  lneo s0t2tr(o3iodlltemfctls  2ra(r no0aetomiciatlaDranmont) lenxrcio1fpDeanvo t0 exm(mpio1lltnmies s sDraxmoot0alx  i3iydla2ua(vo;u0aetrio3tatfa e neols) 2xr(opiu1lp n fvta(f Duau ont4olt  icilsla2uan o;t)arenmociatlatr nvi;s t2triopiu1am emfeiatfaDrmx oou0tlxoii3ildla ea( snt0 exomr ootop raneo;(0 euo(m3nydll nlnes sfaDtaxrp;u0openmi3tadlmDrmumo;t)altnmf3ia1faDrlnei t)s2toirpoodoltelnci t  2ur( p;t1apxnioctltls eln s;(0artnmrcoy1optelnvsl(0 eto(o3no4lle  ici ()a2uau pou1aleomo3tldfa rm(mpnt4texnir oydfaDr nvi ()t2umxopnu4aleemnct s)srtrxm no1tetnmietatlaDrmu s t4aeerxf tatfatrluvo (0sruo(m3no1lpe lneslsfsDtaxrp;u0oltn f3iyt m2eluvon()trxoxr3to1fmDelu il()teurxo3oudopenlivt ( srta(r ;t1aexnioctldfa ul( o t)arerxf oa1fmt  nvi s0texmxrpoy1ll nlnvias aDumum nu4tpenmf3ildfaDul(vont) lxoxo3tatla e ieo;t trxmir3oydamtnlivia()srur(mo;o1tlt mictyt s umn on()tleomr3oydlm r ivs;s0teur(r3io1amt  ict (f Drr(mooo4texomiciyd sDuauvs;t)trxoxocoy1lpt  n sls seto(opoydllee nvtl(f 2rrurp;t0olt mfetydfm2rau snt)trtoir3oytfpD lueo;t  etmxo3oy4opeemfeiltfs2urx pou1apx ii3tyt s ulums;u0 ltrxociodomDe ivs t s2uoxm iy1am e nvs tfsDrrump;t1tee moeilt a2umumo (4trtomf ootom  livi;s)t2xr(r3no1al   fvtatfa2ua(mpnt4opxo oeiaslm ea(ms;u4arxomocoy1lpDeaivsls trtmxopny4lltemncsas)sDrmx  no0tee moctlslaDea( s ()artnmrctydfpt aiei ()texr(o nu4omeelnesl(fa2tr(moou0tlt iieiaslsDemu snt) ltrxf3todomD  uvs s0trumio nudlm e ncia()srrrur ;t1tle io3iltlsDranms t)aeenifctydlm  lnvo;(0 eumimpoo1omtnmnvsa(  2ra( p;u0aptomoeilt a um(vo t4 exrxoctydomtr ueol(0 ruoxmpoy4amt livsls)arum(rp;o0tltoiiciat s umu s;u0 etrmo ootop r i o;t teuoiopou4om   neil(fsDrmumpnt4oetn ieiadlm2elnmsnt0tlenmo ootfpteluvi;()s2tm(r oydll e fei ( srumx poo0opt moeiysfsDumuvs;u4artnmf oadlp   u s;s0trxo(o3no1ll n ietlsfs2rrumoot0ape  ictydfsDem( s u4aexrio3oodlmte neols s2xrir ny1alee fcil( sDtrx  ot1olxnmf3iat aDumuvo t0alxrircty1om   i ils0tetoxo3iu4lpeemicslt a2rmumono1ole  fctlt m ul( o;(0trxoioctotom r ues;s0s2xr(opoodomte nvslt s2um(mpot1tpenmietldfmDrl(vs u4trxnxo io1fatr ivolt0t2toiopoudalte ivs tfarrm(m ;o1tlen f3tltla2ulumonu) renmr iotlptelivo ( s2tr(opnu1optemnesas)srtax pou4altnmicilsfa2raums u0 etoio oydlm r nvols0 exr(opny4lmen fet sf Dumxronu1tptn f3tldlaDul( o;()trxnxocootomDrauesls0trtm(o oo4aptelicsls  2trxm nu1altoioctat s2umu snu4arermf iy1optrluvi s0s2uoxopoodamenmfei s) rtmxmp;u4tle ii3iaslm umn s (0alenmf iytfaD  u s;( s2umir3oo1op nmnvt (fsrrau o;t1tpxnmf3tyt aDra( snu4arxrifcoadoa rauei;t)s2xoxrpny4ll n iei (fa2urxmono1tex miciyd mDran pnu4 rtoxrcoodfp  lneo s  2xmimpiy1optemnvsl(  Duru o;u0tetoioeiyt a umnvsnu0tleoio3ty1fmDrlneols  2xmxo no1ol nlfvs t) rtm(mpnt4opx  fetasfsDumnvo (0 leoif3oodfat anvs;s0 etrxrpiudolee fcils aDrm(r no0aet  oetlsla rmn snu4altnxrctatlptrlnvs t texo(o ny4olenlfei sfarra(mpot4apenmoetltfs rau s t)trtrxr3oy1laDe ueo;s0t2toim3iu1lpe  ncilt)s2ra(  ;u0aleomfeiat m2eanmpn()treoxf3iy1oa eaneolt0 exrim3no4ll n ici (fs2tau  ;t0olx mieildls2rmu p;t4 lxrmf iydlatr uvils0texrim nodlmenlfesasf 2tru ont4apxn oetydfa2ua(ms (0trenir oodfpt  uvi s s2uoio3iu1aleelfvt tfa2rmxmpnu1teeoioctad m2uauvp;t4 rxnmo3iodfpDeaieols tetmimpnodalenlict (f rumur ou0texnmieiat a uanmpnu4tlxnxo3iy1fa ean ilt) rtm(r3nu1lltn nctl()aDtmurp;t1aetnifcils aDulumo;u)trtnmr3tydlpDrlies t0trxr(r iy4ll elfvtl(fartmxmoou1aet ifctasfa2ean p u0trtrifciy1oateanes (0 rxrxr iydal n fvtls aDum(m ;t0tpx ifetytla2rl( p ()trtnmf iatfm eai i (  2umim oudolt mieiltf Drr(mo;u1teeoif3iltfa2uau s;t4 lxrio3ia1lmte u i;s)tetmim3no4amte ietas  Dta( ooo4tlxn f3iadla rm(mpnt0tleoir iy1lm eai ols0texoxm nudop n ncsl() 2tmurp;t0texnmiciyslsDeau s;(0aeenio oy1fa   ieo s)s2toxrpoo1alenmiei s) 2tmxmp;o0tltomoctyd m2uluvpn(4 leoxr3oatfpD aieol( t2xrimpny4altn ivs t)srrrxr ;u1tpx  feiydlaDrmuvp;u0 etomf oa1faDeai ils tetr(o ny4omtelfvta(fsDraxrpno4apeomictysfm uluvo ()aleomrcoatop  li i s t2triopio4oltnmnvta() Draurp;t0tpt  ietlt a ua(mpn(0aeerir3iatoa   ivol() exo(o oydap nmfei (  Drm(r ;o4aeenii3iytfaDea(mpn(0 renmrciydfa  lu o s) etr(rpiu1openmnvil()arua(m ou4tpe moctltfa2eanmonu4 rxnifcto1faDeli o;( s2trio ny4lmt  fetlsf rur(ro;t1olt  ieiasls2ulumo;u0aetoio3iotlmDr i i t) 2umxm iu4lmeemnci (fs2urumpno1oeenmieildfm2eanmo t4 rxnxf iadfpDrlnvs s0trurxmpoydopeelnvtlsfarra( o;t1apxnioctyslmDrl(vp (4texomrciy1lpDe nvo;t  rur(r3iy4lme  fvtls srrmxr no1teeoiictltlsDumump;u0arxoxf3oo1lmtelneo;(0s2urxmpoydamtnlncil( aDrrxrp;u1tle  o3ilsfsDea(vsnt)texoxf ty1om   u i;(0t2xoxr oudlpenmietlsf Draur ;u4tet  i3tls m ranmpnt4 rxomfcoadfpteanvs;s  exmxr no4ope lfes tf 2um(r ;o0tltn iciadls2emuvs;t)arxoir to1lmtr uei;t) rumxmpoydop   fcia(f 2ururonu1tltnifcild s2emu o t)arxnxf3ootla elnes s)srxoirpny1om  lnesa(fs2trx pnu1oexniieiatfa rmumonu) rxnxo oa1fatr neo s0seurir3no4am elnvs s sDrrurpnt0oleomieils aDemnmon()arxomoctotlpte nvo t0srurxm no1lpeemnciasf 2taumo;t4tpx  oetadfm2um(von(0 rtoxo3tatla  lu sl(0s2to(r nu1ome licsasfarrr(m ou4aee  octyd a umnmpnu)aetnmr3tadlm rln o () etr(r nu1open nvt s) 2rau oou4tex  feiatfaDrl(vs;u)tetnxf iytfatrlnes;t t2xoxmpio4al  mivs (f Dtrxr nt0oet mfeild s2rl(ms;t0artnif io1lmD lu olt srur(o3iu1ll  mncsl() Dtru p;o0openmf3iasfsDul(vo (0texoir3ty1fp ranvi;()t2tmim3iu4olee iet () rraxm ou1aeen ieiat a uluvont)tlxnxfcoa1oatrlivil(0 etoxr oodaptnlnci tfs2rru pnu4teeoifcilsfm2em(mp;(0tetrxf iytlaDelneo s)tetm(m3nudlmee fvs ( srtrxr no4olx iieiat m em(vp () eenxf iotfa elnvs;t seur(opiu4op emnvtas)srum(rooo0alt mf3iys s em(mo;t)tltoxf oy1laDrlues;t  etmxr3io1llen ieta( sDta( ont0aee iieiaslm rmnvont)tltnmfcootlmteliesl( srxrxm3oy1lpen ivs (fsrtaxmpot1tlxnmfeiad s2rl(vpnt)trxrmf3ty1lat ln s s0seurxm oydoltemfciasf 2ua(mpou4tltnifctys s rmnvo;u0 lxoxo ty1lmtean olt0t2to(o nu4al   ncsa(  2ra(  ;t4alx ifeild m2em(mo;(4trtoioctydfp e i s (0srtr(m nudal nlicslt  rtrx o;o4openiietysfs rmu o;(4arxrio totoa elueo t  rum(m nu4amen fetl(fsDua(m ;o0tpxoioeiytlsDuauvo (0alerir ty1op raueo;s)srxoirpny1ap   ncils)s2umurp;u1alx ioetytlm ulumsnt4 renifctotoate i sl() 2xoxmpiu1am emfvtls aruaxmp;o4opto ieils m2eluvo;t4 etoifcta1lpteliei;(  2xoxm3oo1amtelietat  rtrumont0tee  o3tlt sDelu p ()artrxf tydopD lnei;s)srxm(o io1apenmfes t)srurum ;t4tlx  fcild m rauvp (4aleoir3iotfp e ieo;t s2trir iu1oltemnes (fartrur oo4apeo fciys a2rm(mp;t4arxnxr tadlp rau s t) etm(r3ou4om nlivsls)srtmx onu4tlt mfeiyslmDrl(vont4 rtnio iytlpD lneo;()trumio iodome  nci (f 2urx oot4oex ifeiytfaDrmumsnu4 rerifcootfat  n s;s t2xrir io1ap n fei s s2ta(mpou4alto oetatls2umnms u)trxnxo3iatlp rauvils)truo(m3iydome livsasfs2taump;o1oetomieiltfa eau p;(0 eenio3iatopD auvs s0srxm(opou1lptemfesatfarrmxmoot4apt  i3tlslmDulu p t4tetrxocoodla   ivi t srtmim3oodop   fct (  rtrum ;t1ale iieiatfs2elumonu4 etoxr todomtr nvs s) exrir oo4amtn ivtat)a2ra(  nu1oet mo3iatfa rmnvp;t0 lermocia1fmtean i;( trtm(m iy1ll n nctls)s2tmxmp;o0tpen f3iytfaDeluvo t)tlxrmr3tadfatraneo;s s2urxr3oudlmen nciat  rraum oo4texnii3tydlaDea(mp u)arxomo tydfa e i ol()seuo(r iydome  fcsa( artm(mpoo0tlxoifeilt mDemumon(4arenmr oo1fp   uvo s0 rurim nu4al nlfvtat)a2rmur ;u1tlx mfeiltls2elnmonu0tetoxo ia1lm e i s;s0 rto(o3iu1ll emicsa( aDtaum ot1olxnio3iasfmDua( pnu)trtnmo ia1opt  ivi t0s2xr(m oo4lmtn fet s)srum(monu4texomo3iltls2rlnvsnu0trxnmoctotfaDeluvs s) euo(opou1llteliet t arrau p;u0opeo i3iysfs2rluvpnu4trtoio3oy1fm   ivi;()teurxmpny4al nmnesa()srtmump;u4oltnioeiydfaDea(mo;u0 rerxociytoaDeau s s0srumxopio4lp  lnes sfsrtruroou0teto f3tydla emnvp u4aeenmr3iodopDe ueol(  2tm(rpiu1altemfci ( aDraxronu1teeo ociaslsDelu o (4 rtrxociytlm  aueo;t trtr(mpoo1ale  nesa(f 2ra(rp;o4tpxniociydla eluvo ()treomrctodlmD  ieol(0trurio3ou4lp nlfeiat s2rrumoou4oeen feiadlmDranvs;u4trerir3oatlateaueo ( tetrxr nydol  mfvtas a2rru ooo1tee iieiytfa rau on(4alenmf3ty1lp rai ols)texo(r3iodop nlfcsat srtmxmpno0aexn oeilt a2rmnmp;t0artrmoctytfmDrluvo;(0setoimpny4omte ivt s)aruaumont1apx ifeils m um( s;() rtoif3oa1omDeaneslt0 2trxr iu1ol emivsa( srrmx pot1aexo ociad m2emu p ()tlxnxf oo1fp  an i;s0texmxr iy4omenlncil() Duau onu4oee  ictaslmDrmn on()aleoxo tadopDelivo () ruoir iodalenlicia(f Dtaxrp;o4oeeomf3tadls rl(vont)aexnircoa1lpDeliei;(0 etoir iy4am n ivtls sDtmu  nt0alx  ietydlmDul(vo u4arxnmo oydfa  au s ( s2xoimpoodapte fctl() rrru ont4tptoioetld m2ranmp;() exniocoo1lptrlneo s0t2xoxopno4aptn fesa( a2uaurpoo4oet  f3ils s2eln s;t4tetoif3oo1fpDe i i (0 rum(rpny1alt lfesa( aDtrumoot1open iciys s umnms t)altoif iotfm r neslt texrir oo1ameemfci tfa2tmu  ou4opxoifeiysfm rlums;u4 exrxo3iatop r ieol()t2xmim oydop  livtat  2tmump;t1aetnioeiydfm2rlumont0teeoio oy1fpDrlnei s0srxrxo ou4lp  mnci s srur(rp;u0tlen fciys a elnvont0aeenmf3iy1laD lnvo t)seurxo iodop  lics ( aDur( pnu0tpenmo3ildfs uan p;t4trxrmo ta1lpDeluvi t0 eurirpiu1op   ics t a2umxm no4opx mfciydfs uaumo t)aleomoctytlmDe u i (0texmio iudap nlfeil()artmum no0aleo i3tasfsDeanms;t4aetnmr tytfmtrlu o;()texo(opiu1lpt mncilt arua(m oo4tet iieiadfs rlums u)tetrmr tydlpD  ieslt)s2umxopiu1oltn ivi ()aDurumo;t1tlt io3iat a umumo;t)aleoif oo1omtrai ol(0trxmiopoydal nmfeta(faDtmur ou0apxnifctld m2elnvp;t)texoirctotla elnvi t  eto(m iy1amtn fctl(fa2umxmp;t0alx mieilt mDeanvp;u) rermr tatomt  uvs;s teurim3oo4ap emncs s)srrrxm ;u0apx  f3iys m rmu s u4trtnmo iy1lmDr uvilt)sruo(mpoy4am   fcil(f 2tru ooo0tpe iociatfm rmn pn(0arxrxrcoatfa   u sl(0sexo(opnu1apeelnct ()artaurpnt0aptnmieias s2uau snt)aexrmfciotfmtean i t0 rxoxmpoydolt  fvil( aDrmu o;t4tetnif3iysfs elnms;(4teermo iy1omD luvs;()setm(m oy1open nvtls) rtm(ro;t0altn ieild m2uanms t0 rxoxr to1fpt luvsl( texm(m nydap e fes t s2ra(m ;t4teenmo3iytla2rmnvs;u4 renircoodlp eln s t) etr(r oo1oleelietas) 2raum nu4aeen o3tadls ua(mp;(0alxrmfctydoa  li i ( t2uoirpnu4opee fvilsfa2ur(m ;u1tlt  i3iytfsDum(vpnt4 lxoxfcoo1fmtran s;()teuoxo ou4aleemfci s  ruaxmont4altn f3iad s2rm( pnu4 rerif3ootfmD liei t) rxrxo iy1lpt  nci t)artax  nu4olxo iciys m eanvo;u0 renmocoo1lmD lieo t)seuo(mpnu4al emiviat arra(ro;t0tptoiictltfm2ean snt4aeeniocoo1fat luvsl()setrim io1open fviat artr(m nt4tpx mieiyd m2umuvonu)trxrxocootfm ran o;s t2um(m3oudolenmncsl( aDum(mpno4aexn f3ils m2emumo (4tltnxf tadomDelu ilt srumimpoy1amt mietlsfs2umxm ;o0tptnif3tlt a2rau o t0 lxoiociy1lpDrlivo (0setmxmpoy1opeeliesltfsrraur ;u4apeomociadls rlums (0arxoirctotlpt  i o;()t2toim3iu4lp  lnci t aDtrum oo0tpxomoetas m2ul( sn() rtrxf iydlateluvo ()sexr(rpny4op  mfvtltfa2ua(  ;u4aeen ociltfaDrlnvp;() rtoxo iotom rai olt) etrir3nu4om nlnei t  Dra(r ;o4oltnmictls mDulu s;u)teerxfciotomtr u i s tetm(m iodlme  iet t sDur(moot4aex moetld aDrmuvsnt4trxomo oo1omDeaneil(  2xo(o3ou4lmeelnvias srta( o;t4tetoif3tatfa2rm(vs (0tlxrif3ty1omD an i t0srum(m ny4ame  fvt ()aDtmxrpou1texn octadfaDuau s t)aexnifcoodlmD lu i;t0 exrxo io1olen neslsfaDumumoot1olt  ietydls2rluvo t4tetnmo oy1fpt aueo;t0t2toxm io1om  lfet t)arrrump;t4tlt mi3iyslm2uau s;(0 rxnxfciydoat aieo s)s2trio oy4op elietlt  2rru  ;t0aleomictatfaDrl(vp t4 leoxrcoytfmD lueols)s2tr(rpoo4ole mfcilt srrmx  nt4alto oetydls2rm(mo t0artrxo3iadfmD luei;( s2tm(r3ou1ap nlies t a2ta(monu4optnmietls aDul( snu0trenxo tatoaDr nvi (  2xm(m3nydomenlivsasfs2rax pno4aeen ociyt sDemu s;u0 lxrir3oy1fmD ln o s)s2xmxrpio1op   nes ()s2ta(r ot1aee mieiysla rlnvp;()tlenio3iotomDeai i t)seuo(rpoy4alt  nvtls) rtr( pot1tpeo i3iadla um(mpnu0teeomf tytfa rlnvols0 exoxm3no4amenlietls  Duau o;u1aetoio3iysls2el(mo;t0 lenio3ta1fmt  ueils0srtrio oo4aptemfciasf ruaur ;o4apeomfeildlsDrm(mont)tlenmo3totfmD  u o t t2uo(o no4op nlivtasfaDur(mono0oetnio3iat m rl(von(0artrmr ia1fmDeauvolt0trtm(opio1lme mneiat  rta(mp;o0ope iociltls raums u0artniocia1omtr i ilt t2uoio oudapenlneia(  2ur(  nt1oleniieiydls um(ms () lxoio tadom  lnvo;(0s2xm(opnudom  lfvil(f ruau  no1oee  oetydlsDumums;t)texrifcio1om  luei t srur(o oodalt  netas aDra(  ;o0apx mfcilsla2el(vo u4aexrxo oatla rln i t  2xo(mpnu1opt lnvsls) Drm(  ot1optn fciltfs rmn p t4 etomo3tatfp   nvo s) eur(m3io4alenlies ()artr(mp;t0oexo feiasls uan s (4aetnmo iy1lp rlu o s tetrxo oy1ol nmfctas sDrru oot4oet  o3tydla2ra( onu) lenxr3ia1omD luei;(0 rxoirpnu4op nmfetl(faDrr(rpou1tet  feiatfm eln sn() renxrcoa1op e ieo s0 exmimpiu1opt mnvi sf Dumurp;t0aleomieiytfmDuan o;t0 lenmr iy1omtrlivo;(0 etmxm iudal  mici tf rua(mpno4tpto fciatlmDrlu onu0aetrxrctatomD lues;t)srxo(r ou4opeeliesl(fsDrm(mpou1oltoif3iyt sDraumo t)alermr tytom e nvi t) 2xrxr nudaptnmnet t)arrmumo;u4aetnii3iydlm2eanvs;t0arxrmr oatoatrlu ol()trtrxm3oodome mfesls  2urxmpnu4apxn oeiadla2um(vsnt4altomo oa1fmte n i ( sexrio oy4ale lnvs t srurum ot4tlt  feiys s2ul(mo (4altnmr iodomtr ies;s0 2xrir oy1opt mics (fs2tmxm ;u1oexo f3tyslm2el(vpnt) ltomo3oatlat ai s t0trxoir nodope liciltfaDraxr ;o0aet mociytlmDra( o;(0 eerio3oodfm eluvsls0t2tmirpoydll  mfetas)aDra(  nu0oeeoiocildls rmuvs;()texnxrctydlmtr uei;s0t2tmiopny4apenlfvtltfaDrau onu4aleo f3tyd sDuauvon()aeenir ta1lm r iesl()trumxrpio4ope lneiat srum(rpoo1alxoiicildfs rl( o;u)artrir tydlpD  uei ( teurxm3iu1ol  livsas a2tax p;u4tleoio3tldfm2um( p u4aetrmf3totlaDr ieols s2xmir3no4oltelneia(f 2umu oou4ole  oetltfaDuau p t4tetnxf iatfp   n o;t0s2xm(r ou4lle lnvt ()a2trum ;u4tlxomoeiasfa2uanmp u)alermociodlpD luei s) 2xo(rpno1oltemnvtas)sDrrum nu0oex ioetadfa2em(vs;u)aetoxo io1oatrln i s)setm(rpiydome  fei tfarrr(m nu1teen fetls m ul(mo u0 ltoxf oa1la raueol() rtoio iydlltnmfetl() Drm(mpoo0tle  f3iltla ea(vs u0aexrmocoydlmtrlu il( seuoxmpnu4am elnesasf rrmuroot4aetoiociasls eanvs;t0artnxr totlptelu s;() etmio3ny4lle lfei (  2tmuront0aptn oetas a2rmn pn(0 rerxr3oo1fptrau s t) ruoxo no1amt lfesl( arrau  ot4aptn ictyt m2rln on(0 lxoxr iy1fp e u olt seur(m oy4olte fct s arur( p;u4apxnmf3tasfs rlu p ()treomocoydomDrliei;(  2xmxm3oodlmee fct () rrruronu4opt moeils s rauvs ()alxoio3oydlpD  nei;( texmxo3oudlm n nvi t) rumxm ;o4tptn i3ildfs em(mp u)trermrcoydom eanesls0 rxrim iydap e fetat s2umu  no1tleo oeias m elnvs t)texoircoatfatrai ils0 etr(o3iy1oleemfes s a2taxmp;t0apt io3ilt a2em(msnu0artnmr3tytlateluvs;t) rxrxopoy4ol e icilt) rrr(mpoo4alxo ieiys s2ua(vsnu0trxnmo oydoa rai il()truoim3ou1alt mncsas) Dumx  nu4tltnmietadfsDel( p;(4tltrifctotfp e i s;(0 ruoxo oy4olt lnesas  rtm(mono1tpe mictltlm2rl(ms ()aetnmrciodfmDrai ols  2umir nodol  miesl(fa2ua( pnu0aex mfcils s2rmn pnt)tleoio3iy1opD ai ilt truoir oy1llenmiciatfa2tm(m ou0teeomi3tls s um(msn(0 reniocoodlmt au s;(0 2xrxm iudlmtemfvs t) Dtrumont4oex if3tldfa2uluvp;() lxoxo3iadopDr u ilt trxr(m3ny4lmte icsa() rrmx pnt1tpenmiciytfa el(vsnt) rtoiociodopDelnes (  rumxrpoodolt mfct ( aDrm(m ;u1oee ii3tatfm ean onu)aleoiociotfatran s;s) 2tmxr3iydol emnvs t)sruaxm ou4tltn ocias m2rmuvp t)tlxrif3oytoat aieils) 2urxo3nu4lmtemivsls)srrax pnu0aeen feiyd sDel(vsnu4trxnxr oy1lmDeai sl( seum(r ny1al  mictat)aruaumoot1oet mf3iad mDranvpnt0aleoir todlm eanes s)t2xoio3nu4olenmnctat)a2umxrpno0opxnioeiadfmDran s ()trxrmoctadopt lu ils0trtmxopoy4lmee ict ()a2urumonu0apxn feiys sDuau o;t0aetnmf oy1omtean o;t0srtoxr iu1lmeelieil()sDtrx o;t0tee  oeiyd m umnvs ()arerxo todlatr ivi () etoim nydlmtelfeiat) 2umxrp;t0tex mieiys m2ul(mon(0tlermfcootlaDe ieolt0s2to(o oo1oltn nci ()aDrmxront1opx mf3ilt s rmums;t)treoio3oy1fpD ai s;s)seto(m iy4olee fei s)srtrxmpnu0oexnio3tysla2ul(mo;t0trxrmrctodfat li ils) rumiopny4lltemieslt srrmxr ou4tex io3iytlm rl( s (4aeenmocoytlm eaivil(  rxoxm nu4oltelfet t  rra(r ;u4tlx mociytfaDrmu p;t0 eermoctotfatr uvilt  eumirpoy4lm e fvils)a2rm(mpoo0teeniieiydfsDranvp;u0tlxoircoa1oaD  uvils)sexr(opou1om n ncia( srrmu pot0aexoio3tasfs elnvo;(0 rxomfciy1fmt auei;( setrxr iy1lp emicsat)a2ta(r ;u0texo ieiaslm2rln s;(4 rerxf3oadoatrlneo s0 rxoim iydop emfvsatfs2rr(ro;o1opxnmfciydfmDul(vs t0 exnxo iytfaDrln ilt  rxmio iodamee fctas  rrrxr ou4aetnmictatla rlnmp (4tlxrxo3iotlmDrau slt seto(mpoydlmeelfeta( aruaxm ou1tpe  oetasfs ulu s;t)tlxoxrciy1fatrlivils)s2xm(m3iydaptelfcsa(fsrtm(mp;t0tpx  feiydlsDeanvo;() eerif3iydlptelnvo t0t2xm(o3iudlptemiesltf rrauro;u1aptnmietyt m rmnmsnt0 reoio3oydop ranvs t)s2tm(opio4lpenlnci sfs2rruro;o1apxn fciltfs2um( ont0trtnxo tytla elues t t2uoio oydlm emfctlt) 2raum nt0opeoif3tytfmDra( o;u4 exomr ty1fp  an s t) eur(m iodame  nvil(faDtrurp;o1apx mocild m2emnvs;u4treoxo3oydomDe nes;t0s2tr(r3oudal emnetat) rtrurono1aexomoeild s2emnvo;u) lxrifciodfa  aivolt0trto(m3oydlpenmiesa(fartr( p;t1apxnmiciytfsDuanms;()tetomo tydlp rai s;(0 ruoir nodole  ictlt  2urxm ou0texnmfcildfaDean o;u)texomo3ia1opteli s;t t2uoiopio4alt  iesltfs2uaurpou0oltnmociadfa um(vp;t4 exomrcio1faDr iesl( texoiopnu1optelnct ( sDuaxronu0aleo o3ild m2rm(mp (4arxnircoytla rlnes;t  2trio oudalt miei s  rtaxmono1ale  oeiadlsDumn s;u0alxomfcoo1oate ieo;s)srtrio3nu1lmte fesl(f Dra(mpnu0oeeo ictasfaDemn on(4 eeoiocoytfa raivols) 2umio3ny1omte nei s a2rmxm no4olxomo3tasfaDrau o;(4arenio iytop  liei t)truoirpiodol   ivsl() ruaum ;t4oetoifetadls ulumpn(0tltoxr3iodlpD au i t  rxmxopiodomenlict ()srtmuro;o1tpeoioeiytla2uau snt0 etoxoctadlmt liesls  exoio iy4om elfctatfarrmxr no1oleo fctyd a2uanmo t4arxoir iydlp   ueo;s t2uo(r3nu4lp  lnetas sDrmx  ot4oexoiocilsla rm(vsnt)trtomf ootomtr iesls)trtmxr io1oleemnvtat) rtr( p;u0openioeiaslmDrm(ms (0artomo ia1fpDe ivo s tetmxr nydom nlnvtl(fsDtrum ou4tleoiictldlsDea( pn()aetoir oytom  aies;s  2ur(r iu4ome mietlt srtru ont0tpeo oeiadlm ra( snu0trtoif3iodlmDeauvols0 2uoio3ou4am  lnvs () Dtm( p;o1tlenii3tlslm em( on(4arxnifctydlpt aiei s0truo(r nu1op n ies (fsrur( pno4texomiciatla2ranvo u0 lxnxo3iodomD  u sl()s2um(m3nu4lltnmfvs sf Drru p;u4tltnmfcilsfs rmuvs () exnmrcoytoateanvo t t2xrxr3iydolt  ivs ( aDuaxrono1aetomietyd sDumu s;u4trxoio3ootlmDe ues;( tetmir3ny1omt  iviat)arrm(moot4tlt if3tlt m2ranmp u) rxrxfcta1lp e ivs;t) 2xo(m3nu4alt livtl() Dumur ou0tpt ii3tas a rmu onu)aetrir iodom   uvs s)trxrxrpoo1lltelnvil( s2umxr ot4oeenmfciltlaDrlnmsn()alxoxocio1lm rli s;s0sexr(r3iy1altemfesas a2tmu  ;o0aetniieiadlm2eluvp;(4arerif tadopteln s t s2xmxmpou1lme miei s)sDtr(rono0apxoif3iysfm2eauvsn(0 exrmf oydoaDrai sls)tetmxopoy1apte icsl()srrmumpnt0apx  octlslaDrmnvsnt0tetnif3iotfa r nvilt0s2toxr3iy4omtn nvs sf Drrurp;o1tlt mfeildls2umums;u)tlenmo io1fmDr neilt0s2xmxm no1lptnlnetltfartru o;u0opxomfetltlm elnvo;t)texnxo iodla rln o;t0t2xm(opiy4lle  fei ()arrm(rpoo0tlenifctld aDrlums;u4 etrxfctodla e uvils  2umiopoudlme lfvilt arrrx p;u1oltn ieiys m el(vo u4 leomr3iy1op e n s s0setoxmpoy4alen fesas  ruaxmp;o1aleo ieiatlmDrmuvsnt) etomrctadfpt aueo;(  rxr(o iudal nmncsl() rrruront1tetniiciysfmDelnmont4trenif iodlp eaiei s s2xoimpiudlp nmictlt  2trx p;t1tleoiociadfmDuau s;(4 etrmo oatom   uei;t)s2xm(rpno1ameemnvias)s2tm( ooo0optomfeiadfa2ua(vpnu0artoioctydfp eai o s0s2xr(mpno4lpt lfei ()sDtmxm ou0aeen oeilt mDrmnvo t) leoif3to1oa  luvo t0 etoxo oydom e fvsa( s2tmu p;o1tptnio3tltfa2umums u4 lxoxr tatoate uesls0 2toxo3iy4amt lfei s) rtaxmpoo0aetomfcildfmDelu o;t0 eermo ty1lmte nvsl(0 etrimpoy4ope mivta(fs2um(rooo1tlxn ociat m rm(mo () ltomr tadoaDranvi;t) rtr(mpou4open netat)s2tru  nu0tex mfciys aDumu onu4 etrirctadoa eanvo;()trtrim3nu4lpeelfesl()a2ta(m ;o4olx if3iys m rm( s u0tetrir oadomD liei s0seur(o3io1am  livsa(farum(rooo4oltnif3iatfa ranmp u4tleoirctodoa  luvo;()s2um(o iodlp  lncilt)s2ur(  ;t0tpenmfctld mDulnms u0trtnir3ty1oa elies;(0t2trxm3nu1optemfctlt) 2taxro;u1oeto f3tytlsDua(vp u4tlxomocoydlm   nvo;(0s2trxm3iu4amen nciltf Drmxrp;o0tetnio3tatfmDuau p (0 lerxo3iydfpD  ivs;t0t2xoxo oo4op n ietls)sDuax  ;o1tpx  f3tysfs rlnvonu)tetrmf io1fat livo t0 eurio3no4lmt  nei t)srtm(m ;o1opto ieild m2uln o;u4trenxoctatfptr neils  2xoio3oodlpt lfcias srtm( ont0tlxo fciasla2rlnmo (4tleoif3iydlpD aueo s0trto(r3oodll nlfci sfa2rax pno4tlto oeiatlm2uau pnu0tltrxrcoo1lm  aueils) rtm(r oydlpt licilsf Duaurpnt1alxnmo3iat a eluvo t4trerioctatlaDr iesl() 2xmio oy4ol  lnvia() Dua(m nu0ape ioctysfs2el(vs u0tetrxr todfmt anesls0 eumxr3iy4apte ietatfsrtr(mpnt4apenmiciasfmDem(vp;t0 lxoir3tytlptrlueo;t)srtm(r nydopt lfvtlt  rrau  ;o1aexoioeiydfsDua(vonu0trtrmrciy1oaDr n s;( trto(r nydalt  nct sf 2rmx  ot0olt mictas m2emumon(0tleoxrciadfaDelu s;s0 exoxo3no4op  mncs t)a2umxmp;o4tlxoifctysfa2rl(mpnu4tltoxrcoydopD anvs s0tetm(o oy1alee fvtlt) Dum(r ou0oltoiieild sDemn p t4aexoir3iydla   i o t)t2tm(rpou1opt micia()aDurxrpno0tlenii3iydfm2rmuvs t0tleoio ootlm rlieo;t)t2umirpiu4opte nci ()srrr(mooo0ale  f3iydla2ea( p;t0tetomocootfmDe n i;(0texrim3iu4ameemfctl() Dtmxmpnu1alxoiictlsfs2eauvont)aleoif ta1lat  n i s teumir oydlp nmics tf 2raxmp;t1aee iociyd a2rau o t4teenio3oadfpt  uesls0 exrxopnodlp emncsltfs2ua( oou0altomictasfm rm(msn(0teeoxo oy1op eluvs t0tetoxo iu4lmtnlfvsl()aDtaxr no1olx mfciysfaDea( o;t) lerifciydoaDr nvo;() 2um(o3iu4lmtnlict ( srtaxroou4tlx mf3taslm eau p (4tetrif tytfa r n olt  euoxopny1lm n iei t sDrau pou0apeomo3iydlaDean o;t0tlerif3iatomt  u ols  rurir3ny1optn iciasfarumxr ou1oltnii3tytfmDean pn()areomrcoadfa rai ol() 2tmxo oy4opt mnci () rraumpnt0texo i3iysls eaumpn(0arxrmfcoydlaDelivslt0teuo(m3ou4lptelfetl( s2rrumoou4aee  o3iadfa2umums;(4aexnxf ty1fmt  nvols0seurio io1apeelfet tfsruau pno1alen ociydla2elumo t0 renxocoytlpDrau ols0trur(mpoodop elfct sf 2rr(rpnu4oexnmfctltfa2rmnmo (4trenxf todlpt auvs;(0texoxrpnodam  mneslt arrmx oot1olt mictyt m elu o;u0 renmr tadlmt li ils)tetrxm3oydap n nei t)sDtm( p;u1openmf3tadlm2emuvont)aexomf ootlmDraues;t0t2xrxr3iydopeelieil(f 2urxmono0aet ifctadla rlnvo u0texomo oatlat lnei;t0 exmim iydoltnmicsasf Drmxmpot1oexomocild a2umnmsnt)alxrirctodom e neols sexmim ny1lpenlfcsasfs2tmx o;t1oeenif3iatfaDelnmo (0 rtnxr iytfptrlueo;t  ruo(mpno1ll  lfcs s)s2rmu pnt1olxomieild aDean s u0artomo tytfm eai s t  2trio3oo1aptemnvslt) Dtax p;o0tetn ociydfs ean snu0 eeoxf3oydoateliei;s  exmxopoydlptn nctas sDtrx  oo1apen feiad m rmu o;u4 lenmr3iytom r uvi s)t2toxmpnu4ope lncsl( a2rm(roou1tlxn ociytfa2uluvsnu)altrir iodfaD aueo t) rxoxo nudap n fetltf rrm(mpoo0tpeomocild s ean o;t4 renio3oatlmDean i;( tetrxm oo4lptn nvt s sDrau  no0optoifctls a rl(msnu0aeenif totfa  luei t0sexriopou4optn netat)a2um(mo;t4texnmicilslsDrmn pnt0tleomr todoaD li sls0s2umirpio4lpt  fcilt)sDrmx oot4aeeoioctlslsDul(vsnt)alxnif oytop r ies t seum(opny4lltemivsat)aDrrxr ;t1tpt mi3iatlmDul( o u0 rxnmr3iodfpD auvs (0 2trim iudale lnvsa(  rtax p;t4oetomi3tls a2emump u)aeeoir3iatoatelneil(0sexrxo3iy1lptelfvils a2umur ot4opx  o3ildfmDeau on()trenmr3tydfmDr u i t0trtrir3io1ol  lfct t  2rax p;o1alxn oeilsls elnvpn(4tetomfcio1laDran sls)srxmimpnudaltelicsl(fa2rax onu4tpe mfetytfm rmnmpn(0 lxrxfciadlat  i s t) 2to(r iudapeemnesl(fs2trurpno0aee mf3taslsDeln s;(0 lxnxo3oatlm eli i;(0trtoirpnu4lpt  fetltfaDrax  ot0aee ii3tltls elu pnt4aeenxrcootlmt  uvo t)srxm(mpou4olt lneia(  2um(mpno0texnioeias m elu sn(4aeeoifciadomt aieo;t trxrimpoy1ol n nei t) rua(rpou4tpx mictys a2rau onu)tltoxr iadopDr i sls0 rxm(mpou4ol nliesa()a2rrumpou0aeenmociys s2uau s t4tetoio3tatfpDe uvi ()texr(o3oodolen nct t) Dra(rono4tle mf3iat s2emnmont) rtoxf tatlmDraivo;(0tetmxm iy1ap  lfvtlsf Dtaxront4tetniietlsfs2rm(vp t0arerio3oytlmtelnvi;(  exo(opiy1lle  ictasfsrta(  no1optnifctasls2emnms t)trtnxf3tadla elivs s)truo(opoy4apen nvta( aDraxrono4apxo o3ilslmDrm(vp t0tlerirciotomt aieo t0trtr(mpny4op  lfeslsfa2tmuront4alenmiciyt m2ulu snu)tlxnmf oytopt aieo ()s2xmxr3io4apte neia()sDrax p;t1texnmfciysls ua(mo;t) eeoxoctydomDraneol(  2xr(mpiu1ap nmivtls)s2tmxro;u4aexomieild s2ranmpn(4 lxoxr iytfpDr nvo ( t2uoio3io1lm  lfvs s  2rm(m ;t4opxnioeiat s2ran snt) lxnircoodfa   ies;s) 2tmim3iy1altn ncsls)artrx  oo4tleoiicildlaDrlumpnu4 renioctotfpteauvils)texo(m3oo4lpeemfctat srrrxrpot1olenioeiadlaDumuvon(0aexnmrctatomtrai i;(0t2xr(rpnu1op elfctls sDururp;t0tetnifciltfa2rm( s;u)aeeoxf ta1oa  lu i t trumimpnydaptnlfesasf 2umumpot1olenio3iasls2uluvs (0alxomocoa1op eanvolt  2um(mpiydllt  ietls)srurx pot0tex  ieilsfaDumn snu0 eermfctadop eanes s0srtoirpoy4llte nvi sfaruaumpot4tltnmfetysfm ul(vo u4aetrxo iy1fp   i olt)s2umxmpoy1lle  ieiat  rtaxro;o0oeenmoetyt m2umuvo t4tetrxfcoo1lmte uvi (0 etoxmpno1lmtnlnesat) 2taxrooo1opxnmoeiatfm rm(vpn(0tetnxrcty1fp  aivs;t) 2tmir io4alt  fciltfaruaur ;o1olx  iciatlm2umnvs;(0altnio3totlmtr neol(0 2xmxrpoudlmeelfetasfsDumxmpno0tpxnmi3iys aDelums;t0trtoxr3iadlm rlnvs;s  2tr(r oy4lmtnlfesa(f rtaxm ot1aleomi3iltfmDua(vs t4teeomo3todfmDeliesls)texr(o3no4amtnlfctl( arrrx poo0tpto ieiysls emu o u0trtnxociadlm r i s;(0s2xrxo3no4ope  ncs tf Draxmont1aee ii3tlsfa2emn o;t4 eerxfcta1fptraies;s0 2trxr iudap elnvta(fsruaxmpot0tleomi3iytfs rmuvonu)texoir3ootfpte ivslt0 etmimpiy4op  livilsfa2urum no4alt iietatfs2eanvsnt) rerifciatoptr ieils)srxm(m3iu4optnmnci t  2uax ont1oeenioetysfa ra(vsn()trxnxr3oadoatr nvi;t s2xoxr iy1lpt mfcil(fs2rau pno1aex io3tas m rmu o u)aetomo oo1opt an o;() 2xrio3iy1lme lnesa(fartrx o;o1olxnio3iys mDrmu p;u) rerxr tydoa eaivslt trtoimpoy1optnmnei s) 2trxr ;o1tetn ieils mDrlumsnt0alxnxf3oa1fpDe uvslt0trtrxm nydlpt  fcias arta( ono0altomi3tldfaDum(vont0aetrio tatoa  li ilt  rxm(opny4omtemfctas  Drmxrp;t4oexnmi3taslsDelumo;(4teeoxf ty1oatraneils0t2xoxr iu1ol elfci t arurxmo;t0tpx miciydls ua( s t) renmr ta1fmDrlu o t0 rxo(r3ou1omeelfcia(fsDum(mp;o1tltnifeiltla2ea( s t4aexrmrcoatom eluvs;(0sexo(r oo1apenmnctls)sDrr(m no4tpt mociatlm2rlu pnu4 leoxr3oy1fmDr u s;t)seurir ou1am elfcs t a2uau ono0aex mo3iaslm uaumpnt4texrxo3tadlp  luvo (0sexoxm3iy4lpt mfvsl( arurumpno4opx iociysfa uln on()aexoxrciytfa  ln ol( setoirpno1olenmncsa(  2tm(moot1aex moeiyd aDranmo u4trtnmr3tadoateln ol() eto(m3oy4alt lnci ( artaumo;t4oeeoioctad s ea(mo;t) lenxfciytopDe nvo;t sexm(m3iudapt lncs (f rtrumooo1olxo oetldlm el(vsnt4 rtnmo3oadlat  iei;( trxmim3nu4lmee fetas srurum ;t0alt  feiltlmDuanvo;u0tlxnxo ta1fmtrluvi t)sexr(mpou4al e fesa( aDuax  ou0oet  fctyslsDrl(mo;(4aetnmocoytop  anvi;t)srto(m iodolee ncias s2raurono1aet  ociyslsDemu p u) exnifciy1la   iei ()setoio3oodlp elnctlt)srtax poo4tet  ieias a2emn pnt0alxrxo3ty1fp e ueo;s)sexoxrpnodopt licsatfs2rmxr no0aexnmo3ilt s emn s;t4aeenmfcoo1lm r uvslt)tetrim oo4lpenmnci s a2rrurpot0texn i3tadfm2em(vsn(0 rtrxr3oadopDraues (  ruoxrpny4lm emiet t srrr(mpnt0olxoifeils a ua(vo;t)artomrcty1omtraivs;t0s2xrxo3io1apt  fes tf rtmurp;t1oexo i3iltlm2elu pnu4aetnir3todom eai s;s texmxo3no4omen netl(fsDrmu  nu4teen fciad s2emn ont4trtrmf3iodopteanes;()texmir iydal nlfci t  Durx pot1tetnmiciys s2uaumo ()trxrxfciytlp ran o t  rtrxm no4am n ivi sfa2umu  ;u1oeto fetltfa2ea(ms;t4aetnifcoa1lm rauvo;s)tetoxm3no1ameelicil(fsDrmump;u1aeen fcildfa2uluvs;() eermf ta1omteanvi;(0s2xo(m nodalenmicias arumum nt1apenifeiasfaDumump;() exniocta1lmDraneilt) 2xm(rpoy1aptnmnesa(f 2rau ono4apeo i3iydls ea(vs () rtomrcoadla eauei;s)trxr(r ny1lltelfci t) 2ur(root0aet moeiyt a2ra(von()tetrxr3to1lpDelu s;s)srxm(mpnu1apeemivsl()sDtmx  nt1tpt mi3ildfa uln p (0 leoxrcty1lmt  nvs;s0 eurxr3ny4ll elfvsa(f 2uaxm nu1optoioeiyd s rauvs (4 leoif tatla  lies;s0 2tmxm3iodopeelicsl( a2umur ou4olxnifciaslsDea(vs (4teeoxr3iy1oa elnes;t)srxoxm oudlmt lfctlt) rta(mo;t1oexomfetlsfaDelnvp () eerxf3oytfpDeln o s  rxm(o3oy1amt  neta()arrrxrooo4tet mociydfm ra( s t4alxnxocto1lat livo;(0trumiopnu1ol nmfvtas) rrru oot0aexnmoeiltfa2ea(vpnu)aexnxr3iydfp rlies ()trur(r ny1ll   fvils)aDur( pou4opt  ociadfs el(vo t4aexnxf3ia1omDrau i t0setrio3iodlme lncs t s2ur(ro;o0ape  ociytfs2ra(msn(0altnmr io1la   n o t s2xmxrpiy1lmtemiciat) 2ta( pnu0ole ii3tysfa rauvo;(0teeoxf iadopD ln i ()t2toir3nu1ape mivil(fa2um(mpno4tlxniociyd a2rl(mo t4 ltomrciadfpt anvilt  rxmirpiydomeemivi ( sDraxrp;t4tlt  icilsfm2rmnvs t)altnif3tydoa e uv
\ No newline at end of file
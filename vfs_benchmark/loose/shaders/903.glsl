@@ -0,0 +1 @@
+iei;s0srtmir3iu1apen ivt (faDrrxm ot1oleniieiatfmDra(vpn(4altoircoadoate ues t setr(opiodoltemnetl(  rtaumoou1aexnmf3iadfm2emuvp ()areoxo tatfpt  u o t) rtmimpnu4lpeemnvtas  Dua(rpnt1open fetatfa2eln s;t4 rtrxociatlm elivi;t) 2to(rpiydam  mfcia()a2ta(rp;t0ole  octas aDea(monu4alermrcta1op eli o ( trxrio nodom emfvias)sDrmur ;o0aptnmiciad s2emuvp;(0trxnmf oydfateli s (0teumxo3iy1ap emnesltfa2rmumpnu1tleo fetasfmDel(vs;u) ltomr tadfa r nvs t0 2xm(m3nu1llen ici (fa2trxm ;t1alxn fciasfaDrm(mo t4tleomo3tydlptelnvi (  rtmxopny1aptnlfeta(  2rru ooo0oeen f3iysfa emu onu0trtrmo ootoa raivo t trxmxopou1apenlfvslt) Drm(rpot4texo ictyt a rl( sn()tltomoctydoat aueils0sexrxo oy4ome lfvt t)aDra(mp;t4oltnmoctatfa2el(ms ()arermo oy1fatran s;t trur(r3nodam n fvs ()srumxro;o1oleoioetad a2rlnmont4 ltomf3io1omt lnvi;t trurim oodll emietat)s2rr(r no1oleo octysfaDran o;()altnifciotlat au i;()srxrim3iu4ol   fctl()srraum nu4apeoii3tyd sDrmnmp t0arenio ootlm   ivsl( seuriopoo4amtn nctat  rtmurpno0oex ioetadla elu p;(4trenxr iy1omtrluvo s) 2tmirpoudalen feil(  Dtmx oou4tlx iieiydfm2rmuvo (0alxoxrciotfmD  n ol(0t2trio oy1lptnlies sfs2rmx pno4oltomoctadla uanvonu)treoif3to1la e ivo ( seto(m nydal nmnvs (f rrr( ooo4oltoio3ilsfs2um(ms;(4aexomfcoatla   neol()teurio ny4lm e netat)srrmxrono1ale  iciytfm2uan p ()tetrifciytla raiei;(  ruoiopiu4lp elnet ()srtmx o;o4tet  i3iatlaDuln s u0 eeoif ootfaDrln o;s sruoxmpou1llenmnes () rtaum ;u4oetomiciytlm ea( o;t)texrmo oytfa   i o ( sexmxopny1am emnct tfaDrrx p;o1opeomi3ilt mDemu ont) rxoio3iadfatr ies;(0t2xmim iudlle lnct s)a2umx onu0aex mi3tytfs rm(vs;(4 lenio3tytlp e ieil() 2uo(m no4olte fes tf Drm(rp;o1apeoiictydfs ra(vsnt4 exrif3iodopD ln o;t trxrxmpnodlm  miesasfsrtaxrpot0tlxo i3tldfsDuaump;(0 eerxf3tydfp e n i;(0teur(opoy1lmen neta(f rur(m nt1apen fcilsls rl( pnt)aeeoio3oydlpte nvi s  2xr(mpoudllt lfci tf Drr(r nt0oet mfetys a2rmnvs;(0aeerifctydfa rluvsls0 etoxrpoydlp e ncsa(  Dua(  ;u0teen ieiatls emnvo;t4tetnif3tydlpDeanei;()sexmirpnudomtnlncs s)sDta( ono1tpeomieiad aDel(mp t0 eenif io1fmDean olt0texr(r oy4am emfci s aDraxro;u1aetnifetltfm2uln p t) lxrxfctodfmDr i ol( seumirpiudoptnmieiasf 2uaumpnu4teeomfcild s rm(ms u4alerir oydfa e uvo;t)sexoxm io4lmtnmieia()sDraumpou0optniictyd mDeaumonu4texomfcoodomteaivol()s2uo(opoy4aptelfetas)s2ua(  oo0opxomi3ild a2ea(mpnt)aeeoif3ta1lmt ln i;(  2xriopno4op nmncs tf rraumpno0texoif3ias mDraums u4aetnioctytfate iei;t0srtr(r3oy4lmt lneilt) rtr(mp;u4aet  fctatlaDelu o;t) etnmfctydla e nvs ( texoxr3oy4amee net s)s2tmur ot1aet mocild aDem( pn(4alerxo3oytoptr u ilt) rxm(rpiodapeelfcs sfsDrm(rooo1olxoiocildlmDuanvp u4aeenmo3oytlat liei;( teumir oy1ol   fcs ( sDurxmont4aeeomf3tatfm rau on(0tetrmo oytopDran s s0s2umxmpoy4amenmnct t arta(  nu4altn ietls s ul(mp u)altnmf iydomDeai il(0setm(o3ny4om n fcta(f 2rax p;t1apt  feias a elnmp;(0arerif tydfa eauei (0trxo(r io4omt mfeta(f rrm(r nu0tlt  o3tys m2rauvo t)aeenio todlmD lu i;( trtoxopno4lp  mies t) Durumo;u1apt  ieiydfm2eaump;(0aexnif iodopteaues t)s2umio ny1ameemfvils  2uau  nu0alt mfcildls2uanvs u)tlxoifcootomt lu s;(0trtrxm nu1lm  licil(fartmxmo;u4tpto iciyslaDel( o;t0alenir3oodfpte ieil(0srtoimpoy1op nmics t  Dtauronu4tle  ociasls ea( sn(4aetomfcoydlpD auvo;s0 2ur(o3ny4omen fetlt)artm( o;t0tltnifciltlmDemuvo;u4 rxoxfctodfa elnvs t0srxo(o iy1apenmfviltf 2ua( p;t4alxnioctltls rln pn(4aexomr iotfmtr n s;s0trurxm3iodalt mivi (  Drrumpno0aex  ociytfa2rlnvs t)tetrxo3tytomt ai o t)s2xmim oydap n fctas  Dum( pno1oexnii3tlt a rl( s;t)artoifctytfpt  i il() exoxo3oydlle  icslt a2urxmo;u0oeeo oeiys a2uanmont0altomo totoptrlneo;s0seuo(r nu1lmtnmncslsfarurx pnt1aeeniieiat m ul(mp u)tltrmf tytfpDrlieo;t0sexmxrpno4oltn fvi t  rtrx pnt4opxnmo3iltfmDrlumonu4trxnmrctatlpDeli i;( s2um(opiydlp   neta( aDuru  ou0tptomo3tat m2rlnvo;t) lxoxocty1fpD  nvi;(0t2to(o nudaleelnvtatf 2ra( p;o1tptn fciysfa uau o;(4trtnmrciy1lmDrluei;t0truo(mpno4oleemfcsls arrruront1aet mieils m2ua(mo;t0altnxf tydfmtelneols0 euoxopio1om elnvias)srtr(mpot0apt mf3iatfa2eaumpnu)altomf oadom raivo;t teurxm iy4llee ivsasfsrrmum nu0teto iciadfm uan s;t4 rtrxrcoydoa  ai i (0srxm(m3no4omeelnvtlt  2um(m oo1oltnif3iysfaDeln pn()artoif oatfa eli o;t) rxrxo3oo4amee feslt)sDur(r ot4aex mo3iadls2ra(ms ()tltrmfcta1fm ranvo ( teumir oydope mnvi s) 2rmxr no1apenmoetys s rlnvpnu4tlxnircoy1faD aneol() rxo(opou1am n ivtl(  rtau ont0optnioeiyt m2em( on(4tltomocoo1omD livols  exrxo3oudlpenlnesas aDtrx  ot0ole  ietyslsDem(mo u0aetrxf3totopt auvsls0 exr(rpio4ap   netlsfsDtm(m nu4opxoio3tyt mDuauvs u0treomociotomt aivi;() rxrio ny1ll  lnvilsfsDta( oou4tpen ociaslsDuanvon(4altnxo iatlp   nvils texoim oy1llenlietl(fsDtrxrp;u1opeomieiys a rlnvp u0aeenio ta1lm ranvs;s)trurxopoodal elfcta()s2rrxront4apxnmi3tasfm ul(vpnu0arermfcoa1fpDelnei;s0 exoxm io4lleelivsl()a2urur ;t1optnio3iytla ranms;t0aexnmo3iodom  livo t trto(r ou4ll   ivt s sDumu o;o1texnmoetysfs2eanvp u0tetomo3tydfaD livs s  2xrim iu1al nlivi s)s2trum ;o4ape mi3ilsfaDea(vsnu)trtriocoo1oat  u i s  2toio ny1ol nmfvta(f Duru  ;t0tlx iictasfa rmuvonu4areoxrcoytfm r uvs () 2xm(o3ny1altnliei s)arur(rpno0aex  ocias a2ul(vo;t0 renmr3ty1fmD au ils  2urir iodome mnes sf 2tm( o;o1texnmfcilt sDumuvsnu0aeerxo ta1oat li o;t seurxmpno1ll elfeta()artru onu1apt ioeiasfsDuaump (4trxrmf oytop  lnes () rtmxm ny4ope  neslsfsDtax p;u1oetnif3iyt a2ul(mp u0aexnif todomt an ils trumxrpou4ape  nci s)aDurxmo;u0opxnioctltfm2emu o;t)tetnmf iodoptr uei t s2tmir3oo1ope liciat a2ra(  oo1tpeomictyd s2raums;()arenmr3totop elueol(  rxr(o nu4ope  ivilsfsDur(  ;t1apxnifeiltfa rln p;t0trermr ootfa   uvolt0srxmxmpnu4al nmncil( arumuro;o0tlt mf3tatlm ulu snu4alxnmr3totla  lueols  2xm(r3nudlmtnlfcsl()arrmxront0tpxnmfciyslm2ranmpnu4 ltrio iodoptrlnes ( seurxrpoy4ll   icils)srta(mo;t4oeenif3iyd a umnmsn()alermrciatoat aieslt t2tmxopou4lltnmiesat) rtaum ;t0apxnmicilt mDuaump;()tlenmr3iadfm   uvol()t2uoxrpiy4omtnlnct ()arum(m ou0tpx  i3tlsfm2ulumpnt)alxoxo ta1faD livs ( srtm(rpiydaptelfvilt) rur(m nu0alxomf3iydlsDrmnvs;()teermr3to1oatraieo (0s2uo(o nu4lp  lieia(  Dtm( oot0alt iieiytlsDuau s u4arerir iytfpteai o;( t2tr(m iudlm n nvil( aDra(  nt4opxn feiaslmDul(mon(4texoif3iatfa   i o s texoxo no4ope  nvtl(fsDumumpou1opx  ieils m2rln onu)arermo3iy1fa rai il(  exmio3oydlmtnmnvs t  rurxm ot1opt if3ias m umn o u)trermrciy1fa rai sls) exrxm no1openmncs (farraxmoou4optomf3iysfa2rln s;()tltoxo iatomteliei;t)tetrirpiodap nmics () rra(r ;u4tetomociat a2rauvs;t4alenmr3tadlp rlieol(  2xmimpnodll n fcsa(fa2tr(mp;o0oltomf3ilsfsDul( p;t4tlenmr3oa1lp  auvo s)seurim3oydop  mnetas  2ra(  ;u4tetnmociltfs2rmnmo t0teenmo3oy1om   uvolt s2xmxm iydoptelfci () 2tm(  ;t0oex  fctldls2emnmo u4alxnif ty1fpDraiei s setoxo nodome  icil() 2ur(  ;u1oeenifeiyd a2uauvs;t4 reoxf oydoatr n s s0s2xrxm oy1ol emncilt  rrau  ;o1oeeoiietadfs ulump;() leoio iy1omDeaieil(0 2urim iy1ameelies sfaDrmu  ou0aeen ictatfs ulnvs u)arxoxrctatlate ivo (  rtm(opio4omee nesa( arua(mpot1oexo fctys a2rau snt0aexoxr todfpD  nesls)seur(rpoo1omenlfciatfaDurxm ;u1opxnifeiatfs2eanms;u) lxomocoytlaDr n s;(  euo(o iodopenlfciasf Dtmxrpot0tptn ietatfm2ulnvo;t4 lermrcio1lp   n i;t0t2urxm iydllt mfeilsfsDrrur nu1olxnmoetlt mDrm(mont) lerio3iydoatranvolt setmirpiy1apte icsat a2tru  ;t1apxoii3iasfm um(mp u)arxnifcoytlm e u i;t0srtoim iy4oleemnvtl() rurxm ot1apx mfeiydfs2rl(vsnt4teerxfcoodfa elnvs s  2xo(o iy1al elneiatfsDua(  nu0tltnifciytfaDua(vpnu4 lxoifcoatlptean ols  rxmir3oo4lm n fviat  rum( o;t1oet  ocilt s2eanvo;t0trxoxfcty1fa elu o (0 2trxopno4ll n nvsls)sDrru  nu4apxomi3iatlaDul( o u) etrir3ootla r ies () 2trim3iu1ape  ncils srrmxmoou1tltomo3tydls ul(vp u0tleoiociadoaDe uvs;s) 2tmxm iu1lp emncslt)sDtru pno0oleoiieiltlsDul(mp;u4 rxrmo3totfm  luvols0 2xm(mpoy4oltemncsls)aDur( o;u4aet micilslm emump;() lxrmo3io1fm r i i ()t2to(m nydll elfvt s a2taur ;o0tpxnmf3iys s ulnmp;t)texrircootlp  lieo;s)trto(o nudaleemfvs s  rrm(mpnu4opx io3iat s2um( p;(4trenxo3ia1omDr u sls s2xoir io1lm  mieiltfs2tm(ro;u4apeo ieiatfs2uaumont4 lenmf tydfa raivil(0s2urim oo1openlivs sf 2rmuroou1tptn icildfaDrm(vp ()tltrxrcty1lp elivi;s0sexoir io1lpe mnciasfarurxm oo1olenmo3iadfa emumsn(0trxriocta1fa eln i;( s2tmiopio4om emiet t)a2raxroou4texomietlsla rauvp t0trtrio3tatomtraivils0 rtrio ou4lme mfci (fa2rrumo;o1oleoifetysls um(vpnu4tetrir tadlmDrlu s s0trxm(m3iudomeeliet sf 2tmxmp;o4tltoioeiasfm um(mpnu) etomf tatlateluvi;(0srtmir3nu4al elnvtls  2rrumo;t4alxnifctlsla ulnvsnt4 ltoxfcootla   uvi s0s2xmxm no1ap  lfvsl() Drr( ont0apx moeilslmDra( s (4 lenmf3iodfm rauvol()texoio iodomen netatfs2rrumoou1tptn o3ilt a rlnvp;(4aexrxf3oy1lpDraiesls0 2tr(r3oo4llen ict ()a2umu o;u0aeeomfcilsfm2elump;t4 rxomrctytfmDelueo;t0setmxo oy1alt mfesls)aDtax  ou1tltn ietldls2emu o t0 rtnxo iotfmDrlnvo s  rtm(opnu1op n nvs s)artaxmp;t4optnifeiyt a rl(mpnt4trerxo tydla e i slt0 eur(o iu1op e nctat aDtaxrooo4ope  o3tytfs2ra( s u)arenmocto1op  lieils)teumio3io4apen ivi () 2um(m ot4oetoifctysfa2rlnmonu) leomf oodlateaueo t0 2uoxopiydam e ieiat)a2rmumpnt1opt micilslsDum(ms (0 eermr tadomDr u o t0srumio nodam e fes (f 2rr( ont4tlx  f3ias aDumn p;()tlxoxr totlpteln s;t  etrxm iu4amtelfci s) 2ururp;u1apen ocils m2ulnvpnt) eenxr iotfmtean i s trxoxopoo1al nlfeilt)sDrrx  no4alxnif3tysla2ea(mont0aleomo3oa1optrau i t seur(o3nu4op nlnvt (f 2umum ;u0tet  fctyt m um( o;t4aetrio tytom   uei t)trtmim3oy4lp nmfcs s)a2rr(m ;u1tlxn ieiad a ua(mo t4trxriocoo1lmDeaneils)sexo(m3iodole lfvi ()a2umx pnu0tleoifcils a2ra(mo;(4arxrioctydfatrlues;s) rtrxrpiodop elieslt)arrru o;o1tetnmietatfm em(mont)texrxo3oytoat  nvi;t) rxrimpno1op   iet sfa2tauroou0aexo ieilt m2ea( p ()teermf to1fmt  uvi s)trumxo3ny4open fvt ( arum(mpoo4tex  fciad a2rmu s;t)tleoifcoa1opD  iei;(0teur(r3ny1am e ieils  2ua(mpnu0oet mfeias sDemu p;(0 eerif to1lmDeau o s trxm(rpiu4opt mfcils sDrmxr ;t0apeo i3iadfs ua( p;t4artomf3iytfa r ueo;s) rxmxopoudol n fesl(farraxrpoo0teeo octasfa ean snt0aleomf oatfaDelieils)truo(r3oy4lmtemfvi ( sDrm(moot4aeenmoeiydls2rau sn(0 eenxfctydoateai i (0 rtoxo oo1lp n ivilt)arrmxrp;u4tet mfeiatls umump (0 reoio iy1omDelu i;(0teurxopio4lleemnetls)srra(  nu1oee mo3iydlm2rmnmsnt4 rtrmo tadfp   ivs;()trtr(opoudaptnlnvi t)aDrmxmooo0apx moetytfa elumsnu)texrmrcia1fpt  ivo t0 2xr(o3no1om nlncsls  Drm( pnt4tptomo3iytfm2eaumsnt0alxrmocoatoa rli i s  rtmxrpio4altelieil(  rtmu pot4olx mfctld a el(vo;t0 rxnmocoa1fpDrai i;(0 rxm(m3oudlmte nci sfaDtrx o;o4tpxn ociltfmDrl(ms;t4tltrxr3iotopD au o;() rto(r nudome lnciat  2taumoou1aexoio3tadfm umu sn(4 ltniocty1faD anvi;s  rxo(rpou1opeelnvsl(farrmurp;o0tlto fetys m emump;u4tlxoioctydla  aueslt sexrimpou4alt mfcslt aDtr( p;u1olx mfeiltfa2ea(vpn(4teerxfciotop ran ol(0t2xrxm3ny4ol elfetas)sDrru o;t0aptoioeias a rmuvpnt4arermrcto1oate u sl() eurxo ou1omt  ivt (fartru pnt0aetnii3iytfaDranvsn(4 lxnxocoy1fate u ol( truoim3oodll nliei t srrru poo1ole  fctld m2uluvo u4 etrxo ia1fa rliesls  exr(mpny1ame lfesls)a2ta(  ;u0opt ioeiatlm2emn o (0arxrmfcoydlpDeai i s)teto(r nydaleelneia()aDuaxm ;u4aetn ietadfa2rm(vs t)areoio3iadfm   iesl()t2xmxo3oudamte nvilt a2uaxrpoo1open ociadfm rmn snu4 rxnxrcoatfmtr i i t)t2xo(rpno4omtnlicsa()arum(r ;u0tptoiociad a2uluvonu)altnio iy1lp  lueo;t)srtm(mpoy1lpe liet tfsDta(r ;t1apxo ieiasfm2em( on(0trxrmr3io1fpDrlnes t0sexmxmpnu1apeelicsas a2ur(  oo1tpt  fctydfmDeaumonu) lenxf iotoa eaivi;()s2xrxo nudlmen ici (fs2uaur ;u1aetnioeiyd aDrlumo;() lxnmr ootoat au olt)s2xmxopio4opt lfvtat a2raurpot0aexomi3tatlsDemnms;u0arerio3oatlpt  n i;()s2xrio nudlmtn nvilt srtaxm ot4apx  iciltlm rln o;()tetrir ta1oa r ivs;()sexrirpoudamenmictlt s2tmxm ot1tptomociat m2ulnvonu0tlerxr oytfaD au s;t  rxr(m ou1ap elivt ( sDuaumpoo1alenifciytfm2rlnmp t0trenio oadfp ranvsls0trumxm3oy4lptn ietatfsrtmx o;t1tpx mi3iytfa2emu pnu) etoir3oadfate nes s) 2xmio oo1lm nlnvtl( srrrur ;u1oexo iciad m2emn on() exrmfciodopD  i i t0 exo(o iu4ll nmfet t sDuax  oo1tleoiiciadfmDemu pnu0tlxnmo3ta1fm eau i t) 2trxopny4lmen iesa()sDtax  ou1oltoiictyt s2ea(vo (4tlxnmoctytoatrlneil()seumimpoy1lltnlncs s  Durx  ;o1ape ioeils m2ranmsnt0 etomfciodlmtran i s)srto(o oudap nmnctas)aruaumono4tlen feiasfsDeauvp;t0altniocoy1lmtr ivs;t)seuo(o3io4om e nei tf rrr(m ;u4optniociytla um( p;(0trtomociydfmDrln o (  exoxr3oodaltnmncslt arrrxm ot1oleoiiciyt m2ea(mo u) rtnxfciadfmDrau o;s sruo(opoo1lmtnmfeta()srrau  oo4apx mociadfaDea( p t) leomf3oo1fpDeli i;s tetoirpoy1lmtemnetltf ruaum ;o1aeeo ieiadls ul(vp;u) eermfcoatlpt ai ils0 2xoiopnudalenlictat  2ur(r ;o1oet ioetys a umnmon(0tleoxf3oa1laD  uvi s0 etm(rpoo4lp emnesat)srtr( onu1apxniiciytfm2elumsn(4 ltnmfcoatlaD ln i;s  2xrxr3oo1altemnvsl( sDtru oou1tpxoioetltlaDrmn on(4arxrxfcty1oa r uvs;t) rtr(opno4al e nct ()aDuaur ;o4aet mfciasfs elu p;u4 ltnif oydoa e ivi (0 rxoir3io1lm nmici ()a2rmu pot1tlxniociltfm2em(vpnu4 leoif3tytfmDr i i;( s2tmxm3no4lmt livsat arumu pnu1opx ioeiad m2umuvo () etnxr3iadom r uvo t0tetm(opiu4lmeelies t arrm( oou0tleomociyt aDemnvsnt0alxrif3iydla   iei;s0srxmir iodaptnmncta( srur(mp;t4alt ioeilt s rmnvs (0aeenif io1opDelnvi t  rtr(m iu1alte ici ( s2rm(r ;t0olt iietydfmDeln o;u0alxrmfciotfa   u s t0sexoir3nu1omeemfcslsfsrua(m ou1ape mietydlsDuluvonu4tlxomocio1fp eli s t seurxmpnu4optnlici tfa2um( onu4tpeo o3iadlaDraumo;u4arxomo3tatopD  neils0t2xoxo3oy4alee feslsf rta(r ou4tex ii3ildla rl(mpnu4tlxoif tytoat  ivils  rurim3iodlmeelfvs sf rumxm nt1tpxomf3iyd mDrl(mo;u)alenmf3oatlpD an ils) etrxrpoudap  licta(f rra( p;o1tpe mo3tydfaDemuvo u4tlxoir oydfpDelies;() eurxm3iudlptnlfcta(fs2rmu p;t1tex mieildls uaums (4altnxf todlmtrln s;t t2umim iu1alt mieta(faDra(mp;u4aleoio3tas m rl(mp t4 etrio ta1lpD livi;s0s2urxopiudlltn ici sfa2ua(  nt1apeoif3tyt a2uln pnt)arxoxr tydlp  anvi t0trtrxmpoodolt lfvi t artr(mpnu4tltnmi3ilsfa2ulumo;u4trenxrciadoa   neo;s t2tm(rpiudop emfetas a2rr(m ;t0alxn ietysfmDean p t4 reniociadlm  lneslt sexoir iy4op  mnvs s arum(mooo0apxn fetys aDel( pnt0 lenifcoy1lpDr uvol(0srto(m nu1lmte fvsls)arum( poo4tptn fctydlsDemuvo;u0alxnmr io1fp   nei (0 2trxm iudlpe lnetlsfaruaxrpnu0tlenmo3iys s eanvsn()alxoio iydlmDe ivi (0 rtr(o3iydll   fviasf Drmu onu0oexomietyt m2rlnmp;()trxrmfcto1fa rlues s  rxoxr ou4opt miesatfsDtmxm nu4opxnmieiadfsDul( p;t0 lxoiocto1lpt  u i t teumio3oydaltnmnvia(f Duaumonu1alx iiciat a elnvsnu)tltnxo oytfa e ieo;( srurimpiu4lp  liei () rraum no1aex ifeilt m2elu sn(4alxnircoatomte uei;()s2xmxr3ny4al  lfetlt) rrrxmp;o4tlt io3ilt s el(vpnu0arerxf3iytlaD anvo;(0 2xmimpnudapen netas) 2ua(m nu1texn ieias s emu pnu)altrxrciatopt  uvi t) ruo(opnodomt  ictas)s2uaurp;u1tpx  ieilt s2em( s;t0arxnmfcta1oatrlivo t  rxoim nu4ope livsl()arumxr nt0apxoiociad m umuvsnt0tlxrmr3oy1fmDe n o (0trxrxmpoudll elfvt () Dtrxrpoo4tpxomoetysfm2el(vp;(4aexoxrcoy1lm eln s;t)setrxr oodopenmfeslsfs2rau pot1alen ociysla2uln pnu0tetnmr iodfa  lu i t0truoim iy4am nmivia(f rrm(r nt0oeto o3ilt s rl(vo;(4tetrmo tadoa eanvs;s)srumxrpny4aleemnvia()arur(roou0tpeoio3ild m ra( s t0 lxnircta1omte n sl() rxo(o3iydlm   nvtatf Dtaurpno1olt  f3iyslaDrmnvs ()tleomf3oodop rlies (0srurimpiu4aptnmneia( aDua( o;u1tee mociysfm2rlnmp;u4 rtoir ia1laD aivil( t2toxo oudom nlietlt arumu onu1tltnii3tlslm el(vp;u0 exomr oodlmD li sls)tetr(mpoodll emnetasfs2urx ono1oexo fciytfa2emnvp u)teenio iotlateanvils0texmxm3iudolenlfct (  2umxmpoo0olxoif3tas s ra(vsnt0 rerxocta1oa rln i;(0srxoxrpiy4alte fctls)aDumxrpou4tltnmfetyd s2ea( o;(0 rerio3oy1faDrauesls trxm(r ny4oltn nvtls sDta( pnt0apxo ieiytfaDelump t0altnxfctydfpD  u o ( t2tmir3iy4ap nmfesl()srrmur ;u4olt ioctys m2rmu s u0alenir oodfpDranes s)s2urim3ny1al elies t  rrrur nt1oltoii3iydla2em( onu0tlxomocto1opt  nvi ( trumirpiudol  lnvi tfaDtmxr ;o4aetniiciadfa uau o;u0aeerxf3tatlptelnvolt0t2umxr3ou4om nmivtat  2truroou1oeeoiietasfaDua( o u4teermr to1fmD anvolt) 2um(m iy1ol nmicsl()sDtmxro;u1oltomi3iydfm2emump (0trxoif io1faD  i o;t  2urxr3iy1lleelfcsl()aDraum nt4opxoii3iltfs rau o;u)texrmf3oydfp  ai i;t sruo(m nudlp nlnei sfarum(r nu4aexnmi3tlslm rauvsnt4tltrxr to1faDe ueo s tetrxr iy4lpte fvs sfs2tmum ou0opt if3tls sDra(vo;u)artnmf3tatlmt anvsl()srxrxm3iydalenmnvi () 2ua(mpoo4oee  o3tat a uauvs ()artrxr3iadla e uvi;s0 rtm(m nudlpt mics ( sruax o;t4alxn ieildlm umnvsnu0trxnmo oodlmD luvo (0t2tm(rpoudlm   ivils)sDurx pou1tetomi3iatfm ulu p;(4 leoxr3tytlaD  nei;( trtoxo3io4lpenlieil( aruaur ou1tlxn ietasfs rmumonu0trxoxo3oytfatranvi t) 2toir iydom nliesat aDurxrpnt1aet ifctydfs emu s;u0teeomrcio1opDe neolt s2um(opiydlpt  ncsa( sDua( o;u1alt  ietyslsDuanvs ()tltoif iodla  anvi;( t2xo(o3no4lmt  fcta(fsDrax pou4tlxn o3ils a2ul( p;t0aetnir3oatom  an s;t0srxrxr iudlmtnmiei ( s2ta(m ot0texomieils s eaump;(0aeerxo3todlm ean s ( t2xmxm iodal nlnvsa() rtr( pot4aex ioeiadls umnms;t0alerxrctytlmDeli slt)tetmio iy1om nliet ( aDum(monu1oltoiicils sDulu snu0alxoif to1op  aueilt s2toxopiy1lp   fviat)arrm( o;o1oetnmieiytfm rm(vont4trerxo iatlpt  uvo s trtrxr nodlmee nvilt sDtaurono4ape mieilt m emnmp u4 lerxf oadfmDraivils)sexoimpnu1opt mnvtatfsrrrxm ou0opt ioeias mDuaums () lenxfctydomtelieo ( s2trxopoo4apt  ivias) rurx oot1tet  ociatlm uln o;u)tetnio3tytfm e uei;t)t2xrxrpoodapeeliet tfs2trx onu4alxn iciydla rluvo t4 lxrxf3tydlpt auvo;t0s2trxopnodope lnei t)a2taxmpnu4olt mfciydls umu ont0altnif tatop eaivo;() 2tmxrpiu1al n nciat) Dur(m ;o4aptoioeiad a2umumont4trxoif3iydoa r ies;()t2xrim3nu4ope mfetas) Dtr(r no4oet mf3ilsfm2em(mpnt)aeeoxr3oodopDrluei t)trxoxrpou4lp elnvias)arta(m oo4tlxn ieiadlaDraums;() ltrmr oytfmDeaiei;(0seuoirpno1op emietlsfsDurxm no0tetoiieiytfm raums;u4alermr3totop eanvs s0 2xrir3nudomtn net t) 2ra(m oo0olt moctatla2em(mo;u)aetrxocoydlaDrlieo t)setmimpio1am nliesls) rrr(rp;t0aeeoifciydfm2em(vp;u)aetnio3tatfpte i i (  rtoir3ny4amenmnvs s)srtm(rpnt4tex ioeiadlm el(msn(4 lxrmo iy1lp raieils trurxo ou1ol   fvsat a2tm(mono1tee  ietytlaDeluvo (4artomo3iydlmt aivilt0 exrxopiydalenmfvt (fs2tau p;u4opxo ociadfs uan p;u4 rermf ia1lptr neo;s0sexm(r3io4lmeemfesls) Dumxrp;t4oeto ociys m rlumont)aexrioctydoatrlieo (0setoxo3nu1al   nct s  Dtru onu1tetnmoetltla el(ms u4 rermf ty1lat aieo;() 2uo(r iy1lltemfei ()a2tr( oou0opxn ociyt s ea(mp t)trxrmo oadoptrli ilt  2xr(o iodomtelnei ()aDrr(  oo4tetnifctasfs2ran s (4 rerxrcta1fpDrlneo t  rumir ou4lle liet ( s2uru pno4tpe  iciadfm uaumpnt)texoifciatomteanvil() 2uo(r3io1llt lfvsa(fsrururpou0opeo o3iltla rau sn()arenif3totomD lieo s) exoimpou4olee fesl( sDurx poo0tle miciatfa2el(vont) lxoio tytlptrliei;s0s2xr(m3oodlme miei tfa2trumonu1opx mictlt aDrau s;(0 reriociydfaDr uvs (0 rxrxo3no4apte neilt  2rrx  ;u1aleoio3tltlaDean pnt4tltoif3iydopt aivol(0 rtrim oo4openmnviat) rrmuro;t0optnii3iltfmDra(vsnu0teermr oodfaDe nvo ( s2xrir oo4altemicta(farrrxm ;t0apeoifciyslm el(ms;u0aetoio3tatlate i ilt)t2ur(o ou1ap  lics s sDrmu o;o4apxoioeiatfs2elnvo u0trtrif tytfpDe nes () rumio3ou4lpe mfvs t) rtr(mp;o0tlt iociltfaDem(mo;u0tlxrmr3iytomt ai o (  etoxm nydllt mfciat s2rau  ou0olx mocildfa2rauvp;u4teenmociydopt  n sl(0trxo(o3nu4amtelfvtls  Dra(rp;o0aptn f3ildls ra(mp t) rxrmr iatfmte n o (0trxm(opoy1olte nesasfs2rrx  oo4tetoii3tysls2umu o;u) exnxfciatoaD luvi;s)trtmir nudome mfviatf 2ua(mp;o1aeenmieild m rl( snu4tetrxrcoodlmt  nvol(0t2tmio3iudaleelfctl()srrm(mooo1tpe mi3iaslm2emnvpn(0trxoifcoy1omD lnvs;t)trurxr3nudlmeemicsa(f rum(mono4tptn o3tyt s um(vs (0tlxomr3tytfpteli o t)sexmir3nydlpeemivsa() Dtaxmpnt0ale  oeilslmDemnvo;t0trxnio3ty1optrlieolt  etrio3ny4ll  mncsls  2rmxr ;o1olenioetatfm2ea(mp u0aexoifciatlmDran i;(0sexrxm3oy1ol emfvsls) rua(mono4oeeo oeiadls el( snt0 eeoif3ty1lptelieo;() eur(m ny1omt  net s)a2rmur nu4oeeo feildfmDeau o t0 lxrio tytfmDe ivo t)sruoim3nu1lle mici () rrm( o;o0tpto o3tasfaDrau o t4artrif tadopD luvs;t)trumim iy4opt lncs s) Dtm(mpnu1opxnmictys s emnvp () etnmfctatoaDr n i;()tetoxm oo4lm  lfesa(fa2trx ono1tex mietltlm2ulu p;() rtrio tadlmt luvs s0 2xmio3oo1alenlivilsfs2ta(  oo0olxn feiys s rauvsn(0tltrio ta1oa eaueil( srtm(mpiy4amt  fvsltfa2uauroot0tpxo fciydls2emn p t4 rxoiocoo1fmDr ueo (  2trxr3io4al elfeta()a2rr(rpou4aexnmociysfa rlu pnu)tleoxoctadfatr n i (0teumirpio1lptelnei ( sDtmurp;o1oee ioctlsls ranvont0trerxo to1opDeai ol( srtmirpiudllenlicslt  Drmumpnu0teto fetatls um( o;(4alxoir3oytlpD  u s;t0texoimpnu1oltnlieias  rua(  oo0openmfeiydfm uanvsnu4 etrir totfpt au sl(0teumxo3oo1lmtnlnct ( artax  oo4apxnmf3ilsfs ranmonu0alxoxr3todfat liesls0s2urimpny1ll nmfciat)a2rr( ooo1tpen o3iytfa rlnvp;(0trxrio io1lmD auvslt) exrio no4openlfeia(f 2ra(r nu1tlx  oetysfmDrmumo u4aetnxrciadfatelu ol()tetmiopoodamt  ics s a2tmx onu4ole  ieild m2rl(mo (4tetrmr oodfmtr n s;()trxrxr3oy1lle  ncsl(fs2um( pnt4tltomi3iytfsDua( p;()trxoxfcoy1latr i sl()trur(r nu4opte ivtls)sDtmxr no1oeeniictlsfm ran s;t) rtoxf3iodomDe ivo;t0t2tmxr3oodomtemfci sf 2rau  ;o4oeeoiicildfm2rlu s t4 eeomf3tatopDean s;t0s2tmxr3iu1llenmiciat)a2rmu pnu1tet mfetatfs2ranmo (0 eeoxrcoytlatelnvsl(0truoimpoydal nlnvs s a2um(  nu4opeo ocilt a ea( p;t)aetnxo to1fpt  n s ()trumxmpnu1oltelfctls srraxmoou0aee mocildla2eanvo (0 etrmr oydlpDr ivol()s2xmxo3nu1ame  fvtas artm(rpot1tltnmocild a rlnmpnt)arxrmr3totfm rau s (0srxrxo iydalte fvtlt  Drm(mp;t0tetniictatfm ulu ont0texoifcta1opteaivs;t truo(m3ou4omtnmfvtlt)s2rm( o;u0ape mf3tlt mDrlumo u4arerir3tydomtrluei t) rtoxopiy1openlies s  Dum(r ou4tltoioeias sDrm(mp;t4tlerxr ia1fm eluvi;()srumim ou4lp e fctls  Dra( pou1aetnmoetlsfaDum(ms t0teeoxf3iy1fp e i ols)tetoxr3iydalte ivtl(fsDrmxrpou0tlxoiocils m emnvsnu)tlxnircty1oaDe iesl( texoirpno1omtemicil() Dtr(rpnt0apto ieiat s em(vpnt4trerxfciatlatr ies s)t2xrio iodlpte nvils sDrmum nt1alxoioeiys s2rl( o t0tetnxociatlatelneil( texoxmpio1amtelncs (fartmurpno4aptn f3iatfa2rauvo;t)aetnxf oo1omDe ueols setrxr3iydam e neil( s2ua(r ;u1olen i3iadfm2rmn s t0 exriociy1fate ies t)srtmir oodomte fesa()srrr(ronu4apen octatlsDumnmo u0alxnio3to1fpD auvi;s texoxmpoo4al e fesasfarumxroou0apeoiociadlm uan sn(0trxrif iy1faDr nvsls setrxo3ou1opt miet tfaDraum nt4opto o3ils m el( o (0aexrio3tatfa rli s t srxrir oodllenmietat)arraump;o0optnifeiatls2rln o;t) ltrxr ty1opDelnvs t)t2toxr3iu4lpt  nci t)sDtm(mpnu1ope mociydfa2ra( onu0altomf3iatfmt li ils0tetoiopoy1lpe mict ()arra( pnt1opt iicilt s2ua( sn(0alenmfcoa1lmtrln i t)texmim3ny1om emicslt arrrxr oo0olxnifeiatfaDul(mo;t4tlerifcio1fp r ies;(0srxoio3nudole lfeslt)s2tr( ont4ape miciydlaDran pn(0aetnxo3io1faDrluvols s2toirpno1lpe  nvslsfaDrau  nt0opeoif3ilsfm2umnvont0tlxrmo ta1lpD  ivs (0 rurim oy1op  mieilsf 2uau o;o0ape  f3ils mDul( p;u4 lenmf iytfa r nvils) eum(opny1ol nmnvia( sDur( pnt0texnif3tyslm2rlnvs t4altrmrcta1lpD lu s (0trtmimpoy4lm  lfvia(farumxrp;u0ope iieiat s ea(msnu4arenir totoaDe ues;s s2uo(rpoy4amen fcsas) Drm(r ou1oex iiciatfmDemuvp u)artomf iydoptr uesls0trtmimpiydamtn fcsas  ruau  ot1aeeomieiltfa2um(vo;(0 eenif3iotlp  ai i t)trxrirpiu4altemfvtlt) ruaxrpoo0aptnmoctltfs umuvp (4teeomf ty1lmtr ueil( trxrxmpoo1olteliesltfaDrmxmo;o1ale  ieilsfm ua(mo;t) eermo iytoaDeli i;t0 rtriopno4amt lies s sDurxro;o1aet mietad aDranmo;(4 rxoxfcoatfm ranes;s srxoiopou4lle mfeil(fs2tau oou4ale  oetas a2rmnms u4aexnmr oo1fatrauvi;()t2uoxopiu4olenlfvs s)sDrmxroou1oetnmociatfm umnvp;()arxrir io1fm   ivsl(0tetoio3oodam n fvs sf 2ua(rpnt1oexnioctadfm2umuvsnu0tetomo3iydop rln s s  eto(r3iodlptemnesls sDtmx  oo1tleo ieias s elu s u)tlenxr3tatlmDraueils0 rtriopnydomtn fesa(  2ra(m ;u0teenmf3iatfm rau snt)trermf iydoa e i ols0teurio3io4llenmiesat) rrr(mo;u1ope  o3iatlm ranvpnu)aetomo iadfm  luvo;s)srxo(r nydap  mnvi s)aDtmxmpot4aleoioctlslaDeanvs t4texrmo io1laDr ivo;t)srur(opou1ol   ncta(f Dtaxm ;u4ape  ieild m rlums t4 lxnmocoy1om  an i;( t2ur(mpnu1ll emfvil(farrrur ;t0ape if3tld s rauvont4trxrmr oadlm eau sl(  2xoxm3iu4ame lfctltf 2tmxr nt0tltoioetasfaDraumo;t)treoif3totfm r u s t0s2xm(m iy4lpe mnctltf rururoou1texnmfciydls2rlumpnt0 eermrciadoaDelivo ( trurxo3nodlpe lfeia()sDtaumpoo1tpt iietltlsDean o;()arxoxf3oatomDe u o;t0 rtoxo io4apenmfeta(  rtmxmpnt1tlx ii3ilsfaDumuvo (4 eenirciy1fm e ues t  eum(r nydopt  icta()aDtaxm nt1oee iietat s2ean s (0treoxoctytlat  neils) euo(m3oydoltnlfci tf Drrx o;o1tpxo fetysfa ea(msnu0alerircoytop e nvi ()tetrimpno1omt  nesl( s2rmur no4tee  octyt m ra(ms;u4tlerxr3tydlaD li i;s tetr(o iudaleelfetls  ruau onu4opt  feild a2ulump u4 reoxo3iotla  lnvol() eto(mpiu1llen icslt)aDrrxmo;u4optnif3ildlm2um( p u4 lxnmfcoytfateaivs s)srtoxm nu1lp nmiesa( srrruront0oetnmo3tldls2rm(vo;u0 lxrxo oytoaD  i s;t0 euoirpno1op  licta()sDumx pou0optomieiad a umu o u) rxoirctydomtr uvil() ruo(opou1ole lietasf ruax pnt1aexomo3iatfm2uau snt)aexoxf todfp r i ils srxr(r3ou1ape  fesasfsrtrurpno4optnifciydlm ulu o;u4aexnmfctotfp elivsl( t2xmxo3oydopenlnci s) rurxmono4tlt mfciydfsDrlnms;(4trtoxr3oy1faDrlivsl(0t2tm(r iodom   nvtasf rrmx  ;t0alxo o3tltfa2uanmpnt4 rxnir iatopt lu i t) exrirpoydlp elfciat)s2rru  no1aeto f3iytfsDem(monu)aeerxrcoytom elnvils0 2umxm iu1lle  ict s)sDtrxro;t0olx iieiasls rlnvp;u) lenir3iotopte u o t0 rtrir iudalt  fcilt)sDtm(mo;u0aeenmfctys mDraumo;t4trtnmr3oy1fpDrau i s0trxmxm iydap nmivslt s2umu  nu0opto ocildlmDuanmo t0 exrif3iotoatr neolt teur(opio1al  lietl( srtrxrpnt4tetn fctld m eluvsnt) lenmf io1oatraiei t0s2umimpoo1lmen nesatfartrxmpnt4aptnifetls mDem(vont4artrmrcoydopDe ieils0trxoxmpnodoltelivi ()s2tm(mo;u4openmf3iatfmDel(mo (0altrxf oa1oat auvolt0s2ur(m3nu1aptemnet ( aDrru pno0oetomfctydls2eanmp;t4aexoir3todopt  ivs s0tetoir3oo1ol e fctas  2raxm ou0alto i3iatls rmnvpnu0 ltrmf oytfpDeanes;s  2tm(mpnu1opeelneiasfsrtau  nt4tpt mi3iysls elumo;u0alenxrcoy1faDelivo ( trxrim iodomt lnvtl(  Dtrxr ou0tee  fetadls ul( s () rtoxr3todomDe u o;(0s2xmio ou1lptn ncs t  Dumx p;o0oexo feils mDeln s (4 eerio3oy1lp r ieo t) etr(r3iu4openlfcta(f ruaumo;t0tleo ictysls2um(vs;() eeomr ta1fm e u o s0s2um(o3ou4alenmnvtat s2trxr nu4tlenmoetyt sDumnmon(0 ltoxr3iydlpDeli o;s setrxr iy4llt livsatfartmxr ;u1alx  ictydfm2ea(msn(0tlenmrciotfptrli s;( t2xm(m oo1optnmfvilt arur(rono1apxnmieiatfsDelumo;t4tlxnmocootop rln o;(0srtoirpnodap  lncs t  rrmuro;t0opto feilt a2elnmo (0aexnmo totfp ranvsls0trtrxmpno1op nlfctlt aDraxmpnu4teeoioetadfs ranmp;(0 renxr3oo1fp   ivo (0s2tmxopoodllt  ivsltf rrr(mpot0aeeomoctydlaDemu s;() etnxfcta1lmDe nei;t teuo(o3nodam  lfcs ()sDtm(ro;t1openmieilsfaDelu p t4trermfctatomDrlieol(0s2uoiopiodol  mnvt sfs2umu pnt0oltn feilslm2uluvs;()alxnmo3tadoa  ln o (  rtm(o nodapt  nvsltfaDurxrpnu4apt mieilt aDumumsnt0 ltnmo iatopDrluvsls)srtmir3nu1olt  fvi s sDrrum nt0alx ifeiadlm2rlnmo;u)aeeoxf3oo1oate ueo;t0seuo(mpoo1apee ieils) Dtm(m ;u0tpeo ieiatfm uluvo u0artomr tydlm rauvi ()trurio oo1ap   ivt ()sDur(monu4apxo oeiltla um(vp;t) exoif iotfpD au o ( t2umirpny4ap emfetl(fsrrrxrpnt0tpxnifcilslaDraumo;u4trxomr3ia1laD an i;t)s2xmim3io1llee neslt) rua(m no4aexnmo3ias s2eanvs (4trtoifctydomtr uvs;t0 2xo(m ou1lmenlfvt () rrrurp;t4oeto iciat s ea( p (4aetnxo iy1fmDr uvslt srxmimpny1lme lfeilt  rum(rp;u1olt ifetlslsDem(vsnt)artnxoctodomDrlnesl( t2to(r oy4lptnmfeils)s2tau  nt0oex io3ils s rm(ms u)treoxfctodfmDeau i;s0 exrxm iu1lmtelfci t s2tmu  ;o4tlx  f3iatlmDum(mp u4alenxo oy1omD  nvo;()s2xmxr3nudole mnes t)aDumx oot4tpeo feils s ua(vp u4tlermocio1latraues t) exrxo3nu4omtn ncsas srrmxmoou1altoifeiyt s emnms u)alxnmo3ootlatelivo s0trumxo3oo1om elfcs t s2ua(m ;o1oleoifctyt a uan s ()teenmf3todfpt aueo ( trtr(o no4altnlict t  2ua(roou4tlenmi3ias a2elu p u)tlerxf3oy1op eanei s setmim3oo1amenlfvt t) 2umxmpnu0tpeo fctasfm rmumo u) eeriocta1lpt lnvsl(0srtm(mpnu1lm e fcs () Dtm(rp;u1tlto o3iad m eanmo;u) renifciytfaDe uesls tetrim nudlm  livilsfsrrmu  ;u1tpxnmfeias a ranmp;u4alxnmo3tytlpD  ivi;( t2xrxo3no4llen fvsa(fa2rr(root1aleo ieiytlmDuan snt0 lerxf3iatla raieolt srxrxopio4ame micils artmxr ;u1olxo f3iysfmDrm(vont4tetrio3oodoatr ivs t0sruo(r3iodlltn ietas  Duaump;o0aeeoiiciasla rmumo;u0tlxnxf oatfpD lnei t0s2xoiopou1op emfci s) Dtrum no1tetnioetat m2rl( p u4altoxf3oy1om rli slt) rtr(m3oo4ll  lnvils  rumx p;o0aetn ieils sDeauvs t4 ltoio oy1omtelivi;t)sexo(r oy1lmtemfesls)aDraumonu4ale iociytls emu o;u0 leoxo ty1laDr uvs t0 etrim nu4apt lncils)artmumoou4tetnmieiadfsDua( o (0tleoio3tytoaD luvils0 eum(mpiudapeemnvias) rrmxro;o4tptn ictad mDelnmo;t4tlxomo ootomDr ivo ()texriopoydlpee ivtlsfa2umum ou1tlt  i3tyt s2rauvo;u)trxnmocootfm r i i;s)s2urirpou4ole lietas sDurur ou0tet mietad mDeln pn()areomr3tytlmD au ols trtmim nydom nlneta() 2rrurpnu0tltnmo3tytfm2um( pnt0 rerxf3ootfp e ivolt0 rtoio3no4olen iesas s2rr(r nu4aex mo3ildfa eauvsnu) rtnxrcoytlmDelneol( srtr(r3oo4om elnvi s aDuru  nt1aet ifeiatlmDrau s;t4tlerxociytfm  an i s t2toio iy1al nlfci ( aDum(r ;u1apt mf3ilsfa uaump;u0trxrxo ootop rli s t)srxmxr no1ame lfct ( arumum ot0aleomociltla2ul( o;u4 lermfcoodlatrlnvo (0 2toio nydaptelfesasfsrua(rpoo0aleo oetatlm elnvs;() rxnif ootlptraies (0srxrxr3oodomt mnvtas)arumu oou1texnmf3tlslsDemnmo (0tlxomr ta1fp  auvs;(0srtoxrpoodol nmiciatfsDra(  ;t1opxoiociysfs ra(monu0 exrxo todfat  i i;t)s2ur(m iy4op   fcs tfaDra( o;t1tet iietatls uanmo ()trxrxrcoytomDrluesls  euoxopoo4ameemfcta()artmx pnu0altnmf3ildfa emump;u4 rxnmf3iadomD auesl(0trxrim3io1al  mneias) 2tmurpno0tltnmo3ilsla eanvs u)tlxoirctotla eln s s s2toio iodop  mivtat srurx p;o1aex mo3ildfmDrlnvs;t4alxnmo tatomD an i;s0t2to(m io1al  mfvilt  Drax o;t1tpto ictad a2umnmp (0 rtnxfciydoat aieils0sexo(r ou1lm emnvs t  Duaump;t0aet if3tat m2rlnvp;u)treoif oo1lpt livi;s sruo(o iy1ome mfet ()sDrmu  oo0tlen i3iys a rau p (4aexnif3ia1fatrlneo;t)s2uo(mpoo4ape mncta(f 2rrxr ;t0aexnif3ildls2uln o t) rxnir tytlp elivi t teurxo3ou4om nmfcsa(f Dtau  ;u4aetoif3iadls2rmnvo;u4 rerif3io1lat lnvo t0trtr(o3io4ll elicsas sDua(r ou4opt ioetadlmDrmumo (0arermf iatlm e iei s)setrio oo1ap emfvtlsf 2ururonu1apxn ictyt s2uln p;t4 ltnxr oo1oatrlieilt)t2tr(rpoydoleemfvsls)sDrmumpnt1aeen oeiysla2umnvp;u4aexnir3ia1optelnvi;t0sruoimpnodop n fcs t)s2rr(m ;o4openmoctysfa rm(vo t4artrircootopt luvo;s  exrxm3no1llen nctltfa2rmx  ot4tee mfeiytfs ua(ms;t4tetnmfctotlmtrlues (0 rumiopiydlltnlnctl() rum( ont1tptniociatla2umnvo;() ltrifciatfpteli i;t0 2umio3ou1opeelfvslt)a2tax pou4oeen i3iltfsDemump u4 renxo3tytoptr uvilt0tetrxo nodlltn ici s) Dtaxro;u4tlxn fetytfm rlnvpnu0trxnxf3tytfaDe n s () 2ur(m iu4ape lncil(  2ra(  ;o0tlt  ieiasfm2rmuvo ()trtoxo3ta1oaD  n s;s truoxm3oydolt licil() rtm(mp;u0tpxo o3tyt a rmu p () ltrmr iy1lateaneil()trumio iudlmtnlnvi t) rraumpot4alx ifctlsfmDumnvs u0aexrio tatlpt lnvo t0sexrxo iodom   fetlt sDtr(mpnt4oexomociyt s ua( o u0alxoir3oytomteai s t0 eto(opoy4amtn fvia(f 2ta(rooo1olt iictadfm ra( s u)trtoif3totlpDe nvols0srtmxr ou1lp  lfcslt)arrax o;u4texn feilsfa2eauvsn() exrmo oatlate nvil(0 2xoxr3nydoltemfei s)aDuru oot4oetn o3tldfa2el( ont4 etnxf oy1lateaiei ( tetr(m iy4lle lfvils) rtrx  nu1optnmi3tlsfa rl(vont)aexnifcia1la eli slt)sexo(opnydam nlfctlt) 2ta( o;o0opto fctad a2ua(msnu)arenxr io1la   nei ()trtm(o no1omenlnei sf rtmuro;t4aexnmocild m eanmsnt0 eeomocty1fpDrau sl( srxmio nu1lmtn netat) Duauront4tptoioeiad mDrlu snu) etnmocoa1oate ivi t s2to(o3iu1ale lneias)srrmurpnu1aexomi3iatfa2elnvo;t0aetrmo3iydfpDeaivol() etmimpiy1am   ivsas) rtrx ono1ale  ietldfm uluvsnt0aeenxocia1lpt  i o;t trtrxmpou1alenmfetas) 2rmu pot1apxo octltfm2uauvsnu0 rxoxf3tatomtrlieo;s0trxm(m3no1lptemfesat)aDtrumoot0tetomo3tas s ea(vs;()alermr3oadfat  i ilt)s2ur(r3oudaptn nviltf Dumurpou4tlxn oeiltls um( s u0texrio oy1laDelnvsl(  eur(r nu1altn ncil(faDraxmoot1tlxoiieiys s2ua(vs;(0trtrxo iodopt auvo;( texr(r3ou1lm nmfeilt)s2rrxr oo4aet mi3tadfm2rl( p;t4 lxrmo3tytfate n olt s2xr(o ou1amenlnesat)sDurxmp;o0aee if3ildfaDemnmsn() exomfcio1omt  u s (0 ruoxmpiy1ap emfetlt sDrrum oo4aeeoifeiytls ulnvon()tltomr tydfpDr n i (  eum(o io1ll  lfetl(fa2umur oo0aexn oeilsfm2el(vp u0 renxrctadomDelnei s t2xmio3nodole lfetl() Dum(mp;o1aeeomoeiadfs rm( p (4tleoirciadfmtraneils)s2urir ny1lltnmfei ()srua(mpnu1opeo feias s ea(mp;u4alerxf ia1opD  n s;t s2tmxm3oy1olenlfet () Dua(mp;t1altniicildfs2rlump t) ltrif3oadoa eanvs;t tetm(mpiy1amt  nvi s)a2taur ot1tpen f3iltla2uln onu)trxrxo3ootoptrai i;(0 rurimpnydll emfvsls  rrrx pot0apenifciatfa2um( p;(0artnmfcoodfp e uvs t seurio io4ol n ncsasfsrtaxrp;o0aex  ietad sDran s;()aleniocoodfmteluvi s0sexoxo nodomte fci sf 2tmxmpnu4ale  fetydlm eluvp;()trtnmrciodfm rlivilt  rtr(r oy4lp nmieias)s2uru oou0oeeniiciytlm2em(ms;(0 lxrmf3oa1omt ln il()sexrimpio1lltelnvtl(f 2tauront4aeeo fciat sDemnmpn(0trxrio3oa1fpt an s;t texmxr no1ll emneslt) 2tr( ono0tpt ifcilt a2um(vp;u) rtomf3iodfatraues;( trxmxr ou1ll nlivil(f 2tmum no1tltomoetydfmDel( s;t)aexnir ootlpt ln sl(  2xoxopoy4amtnlfcsl()aDuaur ;o1tpe mocias mDelnmsnu4 lxnxrcio1fmtraiei;s trtoxopno4om n ici tf rta(m ;u1tltnmieiyd mDumums u0tleoir oadop eln olt)texoimpou4optn ici sfsDumur no0tlx miciydlm2ulnmon()aetnmfctotlmtean s ( srxr(o iydomee icsatf 2tr(r ot0aeeniocild a2elums;t0aexoircoadoaD  nvs;s texo(o3iu1am   nes s arum(mo;o1altnmi3ildfm2el(vs u)artnmfciy1faD anvsls0 rxoxm io1apte fes s)arraurpnu1tetomi3ild m2rm( snu0tlxoxf3tatla  aivo;t  rxoiopiudlle  fctasfs2ra(mo;o1openmi3tlt s ul(mo;t4 eenir3ootfpDeanei t)setoxrpnydop emietl( aDtm(r ;t4aexn f3tydfsDrmu p t)altnmo oo1lpDe ivol( t2xrxm3nodlmee ivslsfartm(mp;u4olenmoeiytls2rmnvonu)texomo iatla  ln i t0 2xmxo3oo1lpee neilsfa2um(ronu0tpx mictat sDuan p () exrir3oy1oat lieils) 2xoir3oydaltemnvtltfaDrrur ;o4oeeoio3iasla rmumsn(0 ltnmfcto1fpDrau i;()setmxr oy1lmtnmfetls)s2ta( pot0apx mfeiydla elumsnt0teeoxr iytlpD lnvo;s)trumio3oo4lpenmiesas  Duaurpno0aeenmoctlt aDran o u)texnir3iadlaDe u s;(0 2urio iudopee neiatfs2tru  oo4ope  octlsfaDelnms;t0trxnxo oadoa ran ol()seurxr3nu1lp e netat) Drr(rp;t4tptniietldls2eanmsnt4altrirctatlmD  ueo s0 ruoxo3iu4lpt mnetlt)arurumo;t1ale  fctydfmDul(vp u)trxrifciotfm  auvo t0 2to(rpou4opeelneil( s2urxr ;o1tpxo o3tasls rmuvp;u0artomfciy1fatrlu i;s sruo(r ny1amenlncs s) Dtrx onu0texnmfeiltfs rmumo;(0tltrifctytomt lu o;t trxrim no4omtnliesls)a2taxroot1apeomo3iydlm rau o;t0aetnircoa1lmt  nes;t0t2xmxm ou1omtelnvt s srtr( pnt0olen f3tytfmDelump;t) eenxo3oa1fpt aieo;s s2uoxopoo1al  lfci s)arra(ronu4tlt  ictys a ulnmp;u4 eeoxo3oo1fpDeln i t  2urxmpiodape  iviat)srrm(mpnu0olt iiciat s rm( p t4trtomo3ootla   i o;() rxoim iy1lltemicsa( s2umurp;t1tlxoifciyt aDrmu s t0tltrir3tydomDelnesls srtrio oo4lle  ivs t s2rrum ;t0aeenmi3ias s uauvo;u0tetrxo3iytoaDran s;s0 rtmxr iudopeemnvtlt)sDtrx pnt1alx mi3tltlsDeanmsn(4tltnxf3iotfmDrau i ( trxoir nudom nlnctltfaruaumpoo1teto ietltfa2el(mp;()tlenmrciotlmtrln olt seurir3oy1ap   feilt srrm(m nu1texoifeild m2eluvp (4 rtoxo to1laDrli i s  eto(r iodop nmietlt) 2urx o;t1alx  i3tytfsDrmu pnu)artrxo3iotlp raieo t)srxrim3iodlmtnmfcsltfsDur(r oo1tpxoiieiydfs ulumsnu0trxnxf iatfaDeluvo;s)trur(o oydol nmivtasfs2uaumont1ape ii3ildls2uaumpnt0 rtomo ia1fm  anvo t) exm(mpiodoltn ies (fartaxmo;t4oex ifetytfaDra( s;(0alxomr io1omDr uesl(  etrxo oy4omte fct (fs2trxmpnt4alxn feiydlm2emnvo t0areoxr oodomDrlivs (0 rtmxopoo4oleemiviasfsDurumpno1tlenmiciat mDean s (0 etomo3oadlmt luvils  rtoio3iudlmtelncsl(  2raump;t4tlt ioeiatls ea( p u)artrio ootfmD  nvi s0 rtoio3ou1am e ivsls srtaxmoot1aleo feilt m2uanvon()tetoif3tytoat  neo s  rtm(r iodamtnlfvsltf Dtr( p;t4apeomoetld s2rm(vpnu4 eeomf iodfa eau i;t0srxmxo3iy1lp   fesasfaDrau pou4aee moctatla elnmo (0teerir iy1oaD anvi;t0trumim3iydop emfci tfsDrrx  ;u4aeeomf3tytfs ulnvp ()aetrmrctytfmt  ieolt) 2xrxmpiu4altnmnet sfaDumurpou4tetn ictltla uauvont4trermr iadlaD lueslt seurio3ny4amtelnctl()aDrruront0olx  o3iyd a rmn o;u)aeenmf3oadlp e n s (  rumxr oo1ol  lfvi sfaDtmumpnu4oetomietltfa2rln onu4 rtrxrcoodomDelivo t  rxrxmpnydll emncsatfaDtaxrp;o4tpeniociydla um(mp t0altrxfcoa1oatraivo ()tetr(opoo4omtelnet (fa2uau  no4opxniociat a2rauvsnu) leoirciatfmDr neolt)teuoxopiu4ll e fviat) 2rmxrpnu4olt if3iadfa rlums (4arxoxf oo1opDr neo s texmir3nudame miet ( aDrax o;o4tet iociytlaDeaumo;t0 ltrmo to1laDe u slt) exm(r nu1apeemfcta()arumxrono4aee mietas s rau p;u0 lxrifcta1lpDeai o s)trxmxmpoy1apee icilsfaDta(rpno4tlxnifcildls2el( sn(0 rtrxrcia1fmteaueo s s2toio3iodlptnmiet (faDrrumoot4ole mo3tlt sDraums t)altrxr3tadfp r ues;s t2to(opoudomee fcsls  rtrxr ;u1tltomf3iatfsDemn pn()aeenxo3iotomtrlivo t  rum(r ny1al  mfvi tfsrrm(r nu4ale  ietydfm2uau s;t)altrxf3ta1fmtrlneo;(0 exo(r3io4op   icsa()artm(m ;o0tptnmf3tyt aDrlnvp t0 lxrifcto1fm e n i s0 2xoxo oy4opte iesl(fs2rr(m ;u1altoifetasfaDeanmo u0 etoxf oatfmt lieol(0t2xoim nodamee nvtat)s2tm( pnt0apto fctys aDrmn on(4aeenmr3todlmt liei;(0sruoxr iudlme  icia()aDuax o;t0aptnifciasfm rln sn()tetrif tadlpDrlnvo t0tetrim no1alenmfvilsfa2umu o;o0opxnmo3iytfmDrlumont4 rtrxr3iodfaDeln il( s2uoim3nu4amt lfetlt) Dum(mpnu4altomo3iltfa2um(vont)texrir3to1lpDrli i;t)srxrxr oy4ape mncs (faDrax o;t4olt mfciadfm ul(ms;t4artrxfcty1lm rai i s0 ruoxopio1aptemivilsfs2ua(r ;o0oeeomi3iasfa2rmuvp;(0alxoxf3ootlmtr uvslt)t2umxo oudlmenmivtlsfsrtm(  ot4aeen ieilsfs eaums (0artrmr tatoa eli ols  exmio iydop nmfei t s2raxrpnt0olx iieiyd a2rm(mp t) etnxfciy1lp r uvi s)s2xm(r oy4olt mnesa(  Dumxro;t0opxomictatfs uan snt)trtrio3io1op  au i s sexrxm3iy4alenlfei s)aDur(m ;o0apxnifctyd s ua(ms;t4tlxnxo3tatomtraivs ( seum(o3nydopeemnvtlsfs2rrurp;t4olx iietad a2ul(vp;u4aeeoxrcoo1faDr n i ()seum(m3oy4ape  ieilt)srum(rooo1optnmoetas a rau snt)trtoxo3tytfmDeli o;t seumxr nu4ale  iet sfartmur ;t4alen fetltfa eaump;u0tetrxo iatfm e ivs () 2toimpiy1aptnlfvta()sDtaxroot4tptoiiciysfmDra(vp u0 lxrxo3oatfpt  ies s)t2xrir3iudamt  ics t) ruax p;u1openiieiatfmDemnvo;(4aleomo oatfp ean s (  eto(r ou1aleemnetltfsrtr(r oo4apx  f3ilsla2uln pn(4trtoio oatoptraivslt  rtrio3no1llt  fci sfsDrr(mo;t0tptoifeiydlm rl(mp;u4texoircto1lpDelues ()s2toim no1ol nmfcias) rtaxm nu1aexn f3iyslm um(vsnt4arxrxr oa1lmtrlivsls  2tmxr no4omtnmnvils) 2tm(mont1aetn feiatla2umnmo u)texoxr3oydfmDe i s t)t2umxo3iy1amtemnei s) 2rrx  ou4tlxnifetytfa2ul( on(0trxrmociy1optrlu il(0setm(mpny4apen fvt sfa2um(mpot4oetoio3iysfm ea(vs;t)trxnmo3oytop e nvils trto(o ou1ame  feias arrrumont4tptnio3tadfa2ra(mo (4aetnif3to1laDelneo;( srtmim oy1lp  lfcsltfa2rrxm ;u4oleoiieiltfsDuauvsnt4areoxr3totfptr nvi;t srtoxopoydllt  nvt sf Drrx p;o0open iciytfs2rlnvo (0 lxnmf3iatfa elueols0t2tr(opny1openmivsa(farumur ou0texn ocild s emnmp t0altomr oo1op  ai sl()teumxr iydomee netl()a2tru ont0alxniiciyd s uluvp (0tltoio3tydop raieil(0sexr(r3ou4op nlfct t)s2um( ont0ape mociytlsDem( sn(0 eeoir ty1omt  nvs;s) rumirpiu4om nmiet t) 2urxmooo1oeeoifctas s2emnvpnt4altomf3oadlm rlnvsl()setrxm3ou1aptnlfvsatfs2ua(mono4tle iieiytlm ul(mp;(4altnif tatoa  auvslt trumim3oodlm nmict (fs2tm( oou4opx mietls sDrlnvsnu0 rxoxr3iotfmDr nes;s0seumxo3iu4opt lieia()a2urxm no1ape  o3iyd s2elnvp u4 rxoifcio1op raueils)srtm(m nodomte icta() 2ua( pou1ole  i3tyslaDuluvo t4arxoxo totfmtr n i s0 etrxm3ny1al  lfeslsf 2raxr no0ole io3iytfsDrlu s;u)teeoircoatoaDeau sl(0tetmxm3iu1ole  ncs s sDuaum ou1tex ii3iadfm em(vs;u4trenifcta1lp raiei;s) eto(rpoydol nlnesls  Drmumpoo4teto feils m eauvp;t0 ltnmf3iatfpt liei;s0 rtmio3oudll  mfetltf rtm(  ;u0tle  o3ias m2ua(vp;t) lerifcoadfatean o;t0setrxmpny1ll nlnvtls)sDra(m nt4oex  oeiaslm2uln pnt)tlxnircoo1lmDran o;s)srtoxrpoo4al nmfvs sfs2tau  oo1oetniictldfmDrlumont0trtrxrcia1opD anei;()teumirpiy4lmtnlnesas) Dtr( p;t4aptnmi3tltlmDel(monu0trxnmf oytoptraueil(  eurxopnu4ap elneilt) rtrur no4ope  fctyt aDraumpn(4 ltrmfctydfp rlivi;s)seurio ou1alenmnvslt a2rmxmoot0openioeiadls2ranms;u4trxnmrcta1lpDraneslt  2xm(r3nydlpt mfes s)srrmurpno4aeeoiieiaslsDrlnvont0arxnir3iatlm elivol( s2xm(mpou1lme lieslt  Durxroou1tlenioeilsfmDra(vs;t4texrxo ty1opDe n i ()s2xmiopnodop   fvi t)srtr(mooo4aexomfeiydlm2um(vo;u0arermociotfm e ivs;t s2xmio iu1opt livs (  2ra(m ou4tpeo f3ildfa2umnmont4tltnif ootoaDran i;s) rto(o nodoptemncia( srum(rp;o1olt  ieiasfm rl(ms t0trermf oatop rluvi s  rur(opno1lmenmivtat a2tmu pnt0aexoioeils s el( p t0 eenircoodlm e u i;t0s2urxr no4lp  lnvil( sDum( ono0alxo i3iatls em(msnu)arxomr3tytfmt  uvi ()teuoio3nydaltnmfvi () rumurpnu1olx mfeiaslm2uanvo t4texnmo3todlp r uvi () rxmxmpoodaleelnei sf Durur nu4apxo oeiydfaDel( p (4altoxo iy1opteai ol()t2xmxm io4alen ncil() rta(ronu1oet  iciytfa uln pnu4 rtrxf iydom  ln s s t2xr(o nudom e feiltfsDrmxrpot4olx  ieiaslm2rlnmo;t0 exoxr iatfmt lu o ( s2tmxr oydlm elfesat arrrur ;t4opt if3iatfm eaumo (4tlerif3ty1la r n i;(0setr(mpny4olenlieilsfa2tax o;t0tpxnmo3iytfaDel(mpnu0 rtrmf iadopDr i s s)srxmiopno4omt lnvsas)sDuau  ;t1tle ifetlt aDrlu pnt)arermo oy1fmtrluvi;s0s2xr(m no1ap e fcs (  2ra(rp;u1tlxomfciys aDulumpnu4 etnmocoo1op rauei;s)trxo(m3oy1lleeliviat) 2umu  ou4olenioctytlaDumuvpn(4 eerxfciodop   u i (0 rxrim3nudal   fetltf Dtmxrp;o4alen ietasla2rmuvp;u4tetrifcoydfmteaivols trto(m nodapte fesa(farurx  ;t0tlxoifciyt a umnmp (0 lxrmr oatlp e iei;t srxrxo3oy4optelfcsa(fs2rr(m ;u0teto fciydfmDea( p;t0tlermrcoy1fpt livsls0trtm(o3iu1am emnci (f Dtr(moou0ope mi3ild aDuan pnu4 rxrifcia1omt ai o;t)t2toim iy4lmtnlictl()s2taxmpoo4olxnioctad sDuaumo ()teerifcoatfa ranvils0 rtrim3no1om emfcsl(farur(mo;o1tex mocils m2umn o t4aetnmf todlpDe neols)t2toimpoudamen nctat)s2trxm nu4olxomietyd s elumont4 renmo3oatfmt  n s;t0sruo(m3oy4om  lnet sf Drmumooo0tpxn f3iadla uanvp;()altoir oydom   n s t  2xoxo nodapt mncs (faDrau  ou1olxomietys a2ul(mo u4trtomo3ty1fmt lnvi () exm(m io4lmtelfvia()srta(mo;o1oltnmf3tys aDemumsnt)teermr oydlaDraueslt t2xrim3nu4omtnlnei t artrur no4ale mo3tltfs2ua(vs;u4 eeoxfciytopD lneilt)texmim oydlmtnmieias) 2rmur nu4ole  iciytfm2ra(vo;(4 eermrcoa1lpt ln sl(0 rtoim no1opt mfvs s)sDtmx pou0texnifeiadlsDelump u0arxomf ia1op elivil( seurir3oodlpee nciltfaDtmump;o0ope moeiat m rmn snt4trtnxr tadfaDeaivol()trtm(m3oudapt micsls) rur( p;t0alx io3ilsfa elu onu4 rxoxr3tatopD  u s;t)srurio oo1amt lnvta(  Dra(ront4oexniiciytls ra(mp (4arxnxf3iatfm raieo;s  euo(o3no1oltn iviat)s2tm( oot4aexo ietydlm2rl( s;t4tltnmfcoatlmt lues;s) etr(o nu1alt  fcs (f rrru  ou1tetn ocild m um(mont4artrxr to1laDr u ils0setrxopou4ale  fvsasfaDra( oot1tpenmoeiatfa2rmnms (4 eeomf iy1fatelivi;( s2xrir3io4ol e nctas)aruaur ;u4olenif3iytfs2rluvsn(0arenxocoy1oaDran i ()teumxo nu1am emfvias  ruau pou0aee ii3tydfa2emumon(0 etoxr3iatlpD lnvo ()srto(m3nodap emfetlt  Dtruro;t4tpeo ieiadfs2rm( p;t4teerxrciodom  luvs s  rur(o3ny1lpeelnvt t)sDta(moou0opt if3iadlm ua( p;t) exrif3to1lp e nesl() etr(r3nodale micilt srumumoot1teeo icias mDra( o (0tltnif tydfp eaivsl( t2xm(r3ou4ap emfesat  Dra(  ou1apxnifciydfaDem(vs;(4texrxf3tatla e ieo t) exm(o3ou1lptelfvs t sDur( pot4texn ieiatfs ranmo u0 lenir to1fatelues;t)t2tmxo3ny1alenlnetl() Dtax o;u0aet  ociyslm emnmo;u0trtrxo iytfmDrlneol(0t2umir3nu1omtemnvt s aDuru o;u1aexo ieiys sDra(von(0trerxfciytfpt  nvils teuoio oo4oltemicilt sDtr( oou0olx ifeiyt a2emnmpnu0tetrxfcoadlm e ieolt0 2urxo ny4al   ivsls) rtruro;t1alenmociasls2ra(vp (0texnxf oadfmteli ols truoxrpnydlme mies s aDuau  oo4openmfcilslaDul(monu4 leoxr io1omDean o (0trxrxmpno1lp n nvtl() 2ta(mp;o4teenioeiyt s2em(vp u4 eenmr io1oaDr i o;s0tetoimpiu4ol nlfcsasfa2trx o;u0oee mi3tasfaDeaums t4alxrircootla rlueol(0truo(mpoo4ope lneta()artmx p;o4olenmfetldla ua(vsnt)alenir iatlm eln o;t seuoimpiu1oltnmnvs (f 2ra( poo1olx  f3iad mDrmnvo;u) etoxf3tytlmt au o;s  exmxr nu4ll  lnviltf rtmxm ;u4oleo i3tydla2um( s;u0artnif3ty1faDeauei s trtrxo ny4op n nvtl( sDrmu pou1tpx miciyd m ul(mo u4artnxf iadlat au s t t2trimpnu1lm nmfei (fsrum( pnu1olt mi3iatlaDemnvpn(0teeoxfcty1lmt luvo (0 eum(m3oo4ope mncsa(fsDuaur nu0opx  oeiytfa um(von(0aetnmoctatoaDe ieols0sruo(m3no1ole  neilsf rrmurpoo4apx mo3iydlaDumnms t)artrxr tytfa raieil(0 rur(mpoudom elivt tfsDtmu  no4tpenmociad s emu o ()aexnxo3iytfp eaueo;() 2toxo3oodolt mfeiatfsDtmump;t4tptnmietadls2um(vsnu4texrxo oodfmteanvilt0tetrimpiydole  nvta()artrxr nu1tpto iciyslm em( o;u0altnif3tydopD  nvs;s0tetrxo3no1lpeelncia( aDumx oot4tpeoifeiadls2em(mpnu0teeomr oodfpt luvslt0 2um(r oy1am n fciat)aDra(m nu1tltomi3iys a ea( o u) ltoif3iadfp  auvo;(0setrir iu1aleelici s) 2tmur ot4tee mfetldfa2umuvp t) rerxoctydoate ivo ( texmxo oydap n ics sfsDtm(moot0opx  ocilt m ra( p;u0arenif tydfp   nei;s0teum(m3no1optelfesatf Dtru  ou0opt mocilt sDulnmon()trtrxocoodlat li i;t)t2toxmpiy1llee ncil(  rtr(mp;t1oexniicild s rlnmont0tlxrxoctodfmD lneilt) 2ur(opoy4om elfvs s  rtrx pot0apxnifcildfaDea(ms t0aexoir oadoa   nvols0t2xoxo oy4opte ivsas)aDra(rpoo1oetomiciyt s2uanmp t) rtrmo iotop  aiesl(0sexr(o3oo1op nlfvs () 2tr(ront4apx ii3tltfa2ea(vont4artrio3oytfp elnesl(0seurirpiy4ome mfesls aDururo;o0apx io3tat aDum( on(0 rxrmf oydfmtran s;( setmxrpou4ol elivtl(fartaumpno4tee ifetadfm rlnvs;t0artnir3iydomtelivsls0 etrirpoo4lpt lncs t)arra(m ot4aetnmo3iysls2rmnvs;t)tleniocta1oatelnvo t  rur(m3io1ll   ieilt srur(r no0teeo feiytfs2ra(mpnt4texoio3tydfpDrluvi;t)t2xr(r3iy4opee ictasfaDtmxrpnt1apto f3iltls ua( pn(4arerif3oodom eaivi t  2um(o3oudlpeelncs ( s2rru pnu0altnmoeilsfmDeaumo u4aleomoctydlate i slt0sexmxopoodol nmfciat  rtaxmont1aeeo iciaslm2el(mo u0aexomr3ia1fpt lu ol(0trxo(o ou1lltemnes t a2rmx  nt0apeo o3iatfs2elnvo;u0arxrmfcoydomtrluei;t0 2xmxr3iy1alte fcsl(fa2rr(rpot0tetoioctytls2umu o;(4trenxo oy1lmtraues (0trxriopiodomtn nes tf Dtmurpnt0tlxo ociltlmDulnms t4teerio3to1lm rlieols)t2ur(rpoydlltnmicslt)srtaumpou0ape moctytls2rauvpnu)artnxo oydomt  u s;s s2xmimpoy4ol   neia(faDtau pnt0oeeoifciltlm2uau onu)altrir ia1lm  anei;s trumir3nydal elncs tfa2taxm nu1tpe  feiydla2rlnvs;t4 exnmr oatoa r nvo;()trxm(mpiodamenliesa() Drmurono1ole  f3ils mDum(vsnt0 ltnif3iytfa   ieo t0 etriopiydlmtemfvsas)sDtr(r nt4altoioetydfaDuanvpn(4 renxfcto1fmte nvs;s) exm(r oydamen ivi s)a2tax onu0tlxnifetysfa2umn pnu) exnmo3ty1lm eau ils0s2xrir ou1ll e fes (  Drm( pnt0tlx  ieils mDrauvpnu0tltoxr3iy1fpDean s;s trtm(r ny4op e ncils aDtaxro;u4tlxnmfciltfm ul(vs u0trenxo ia1lmDrlies;t0truoxm3iu1omeemnvil() 2ua(mpoo1tlx  iciadlaDemumo;u4tetrxf3io1faDr uvi s)t2xm(o3iydamt mfcta( sDtru  ;t0apxomo3iysfm uln s;t)alenmr3iydlaD  ies ()trtrir3iydom e netlsfaDuaxr ;o4tpt  f3iltfmDelnvsnt)treomo oadlmDrluvsls seuo(o nydalt mietat)aDtaxmpnu0aee mi3iysls2rlu s t)aetnmr3oa1fm eliei;t)seurim3iy1altemfvias) 2tm(ro;t4tpenmi3iat m ulnvo;()aetrir3iadlmDeli ols) 2xoxr3iy4aptemivs ( s2umu ono0oetnifetlsfs umnmo (0alxoxfciotfaDraiei t0trumxr3no1alt mnvi (faDra(rpnt1tet mf3iat mDelums (4tltomo oy1la ranes ()teum(r3iydoltn ncs s) 2rmu onu0tlenmictysfm rmums;u0aeerxr iy1omD lnei;s) 2xo(r3no4ap   ivtasfartrxr nu0aptniociytfm rm(vs ()tltoxo3ootfm rlu s t) rtm(m3iodolt mnviat)artr(root0ope ifctlslm2rmuvs;t)tetnmf tydfp   i i s t2xo(m3nodlmeemnvilsf Dtmu  nt1alt miciatla2el( snu0tltomf tatomD lieils0trtmio oudllee fvtatfartrxmpno4apeo ieiltla uanvo t) rerif tydlpt liei (0srxrxopoo4am eliciat)s2taxmpnt1oetomfcildlmDranvo (4arerxo oo1fptrlivo t0 2umio3ny4op nmneilsf rrm(mp;t1alt  f3ias a2el(vo;t0 rxnio iotlptr uvs s0s2to(m3iu4om elnvi ()arrrxmp;u1opeomiciatls rmumo;() exrir io1lat lnes t s2tm(o oy1omeeliei t arrax ooo4olen o3iys m uanms t4 leoxr3iydlatelivslt)trxmir iydll nlncslt  rumu  ou0tlx ifeiyt s ulnmp u)aleomo3iydlm raivi s0 2umimpnydlltnlnvi s aDtmu oou4alt mietyt a2uaumo () rxnmfctotoptrlieolt) etriopiu1lp emncia(  ruax poo4altnifcias sDem(mpnu4 rxomo totomD lueo s s2uo(m3iu1oltemies sfsDtmxr no0aex ioeiltfa umn s u0trtomf oy1fpDr i i;s) exoio3nydoptn nvsatfsDtmu poo4optniieiadfsDelums;(0 rerifcia1laDraivslt0 euoxrpoy1lpte iviatf 2ra( p;o0tptnif3tydls2rlnvo;u) renif iytfmtr i i (0t2toiopiu4olee iesl( sDumxmo;o1olt  fciydfmDulnmo;(0trxrio oa1la r i s;t  etmxo3oudllt  ncsl(  2tmu o;u1alxomo3iytfs2el(mo (4 rtrmrctodfmte uesls0 rto(mpny4oltn iei s)a2umx  ;o1tpeo octldfs rluvo t4tltrir iodlmt  i s;t0 2to(rpnodopen ietl()aDtrxr oo4teenioeiltfa ranvpnt)tetnircoy1la eauvolt srxoio no4oltn icsls)s2um(rpnu1apxomictad a ulu sn(0 eenmo tadfmtrauvo s0 rum(r3iy4oleemneia(  Duaumoou4alx  o3ilslm2ua(vs (4 lenmfcta1opDrai olt)teuriopiu4apeemnct t) rraur no1tet ii3ils s2ua(vpnu)altoxfcoydfptraies t0s2trxo nudapenmnctl(f Dur(ront1tlxoiietltfs2uanvo;t0aleoxr3iydfpD aivi t0t2xmxr3nu4omeemfcias  2tm( ont0aeenmfcilslaDem(mo;u4 exrmr3ta1optr n sls) rum(opnu1omtnlfvsas) 2tauro;t1opx  f3tys a elnvs;(4 lxnmo3oy1faDelies;t0 rumimpiu4lle lnctat) Dtrum ;o4oeeo fctyslaDran o;()tlxrmo iadfaD  ivsl()t2uoxrpno1lptnlfcs ()srurx o;t1tex mfeildfa2rlumpnu4alxoif3oodop   n s;s)texrxo3no4ll n nei s  2taxrpoo0tpenmo3ildls em( s;t0tetnif3totlm r ies s0s2trir iu1apt mnvs t  rraxrpnt4tetomi3iatfaDelumo u0 rerxr3oatfpDrai olt0 exrio3ny1lp e ivtlt aDur(m ;o4aexnmocilsfa2em(vp u)trtnif3iadlaDe u o t  2urxopoo4ol elneiltf rtrx  ou4apeo oeiatfa ea(vo;u0 etrio iytlptrlneilt0 rxm(o iu4ol emneiatf rraumo;o0opxomfetlt mDranvon()treoxo oydlpDe nvi (  etrio oo4amt lfeta()a2rmxmoou4teto ociasfs elu s (0 rxrxrcoytlaDr i o s) ruoir3io1opte ietls  Drau pnu4opxnif3iydfmDea(vp ()trerir ia1fpDe neslt)srxmxopio4lm nmivs sfsDta(ro;t4apx  ieilsfaDua(vs t4 etrmo3oatlmtr ies ( seum(opio4lptemnvils) rur(mpot1tptnmociad m rmuvp ()arxnmrcto1la  lu olt0teumirpnudopt mivsatfsDuax ont1tltnmociat s rm(vonu)aeerxrcootomtelnvols0 eum(rpiy4oltnmietat)aruaxr oo0oleniictat mDum(vs (0 rxnir3tadlaDraivs s  2tmim3oo4amte ivil( arrmu  nt1tlxomi3iydfm uanvon(0 renifciydfm raueol() rum(rpny4op  mneias)a2rau oou1alen fctad a em(vpnt)aexnifcoatfp r nvo t0t2xmxm iy4lltelfvsl()s2ur( p;t1altoifetatfsDea(vo;t4tlenmf oydlp  livslt0 rxoxr ny4altnmnvi ( a2tax onu0opxnmo3tyslaDranmp;u0aeenmf3ootfpDelueolt0 rxmim3nu4lpe mfctlt)aDrrxmp;t0tpe mf3ilsfa2umuvpnt0 eenxocoydlpDrlu i t0srxrxrpoydomte nesa(fs2rrumooo4alto fetadlmDeanmo;()altrxfcto1omtr neils0 rumiopou4om elicsa(f 2rm(mp;u0aexnmieiat m ua( pnt)tlenio oy1opteln o;(0srto(o3no1aptnlfvsls)s2rrurooo1oltomieild s2uluvsn(0tltnmf iatfp elneilt) exrir iu4amtnlivsat srrmuro;o4tet mfeiad aDuanms;u4teerxr3to1fmDelueo;s s2xm(m oodam emfet sfa2rru  nt1alx io3tltfsDea(vs u)trxnxf totlat au ol(0 rxrio3oy1lm nmiciat s2tru p;o0ale mi3iydfm eau p;u0tlermfciy1faD anei s0setmim nodop elfes ()srtax  ot1oetnii3tadlsDea( p;t4aexoifcoy1lmD  ies ()trtr(m oodlp nmiei sfsrtaxmoot1oetomoetld mDul( p u4aetrif iy1lpDelnei;t0srur(r iydomte icia(fsrra(mp;t4olto oeiytfs2em(mp (4artrif todop  aneo;()teto(r3no4altnmfvt tf rtm(mpno4opx mf3tld s eanmon(4 lxomr totfa elneil(0s2umxopnu4amt  nciat)s2raxmono4oetomfciydfa2ea(mo (0 rermf3tatlatrln s;() ruo(r oudomee fctatf Dua(m ;u4ape ii3ilsfaDeluvp;t4 renif3oy1oaD  neolt)t2to(mpoy4om   ncsat a2umxmp;t4aptnioetasfs2ra( onu0 eeoif3oydoa rau ol( srxmxm nodolt  ncias srrauront1tlx  i3iasfa rmu pnu0aeenmo iy1op e ieo t0trxrxrpiy1op n fct tfa2tau o;u0tltomfetlt s2rau sn()trtnxf io1om  lies s sexrxo nodlp elici t) 2raumpou4aeeomoetysfa rl( s;t0tlxnmfcio1lmD aivs () exoxr3iydll n fet s)srurx  ;o0tpx iicilsfm rlumpnu4alermo oodfpte ivols tetmiopiy1alenmfcs tf Dumxr nt1teeomictyd mDrauvsnt4 lenxr iytfat  ueolt0sruoio iu4om   net tfa2urxr no0olxo octasfaDuanvp;t0areoxo3totlp raivsls0seto(o oy4ll  lieilt)a2umumooo1oet  octatfs rln snu)trxnxfcootla eluvs t)t2toim3io4ape lfcslt aDra(root0oet iieiltla2emnvo;() rermf io1op rlivs;s) 2uoimpio1omenlietatfsDtmxmoou0olx  fctytla2rmu pnu4aeenmo3oydlmDrlnvol( sexoio io4op e nciasfs2urxront1oexnif3tatfsDranvo t) rxoxrctytom ran o ()trxmim3oy1alenlietat) Dumxm no4aleoiicias s2elnmsnt)aetrmo iy1la rlies;t)t2uo(mpou4altn ivsasf 2raxrpnu4opx  fctatls2rl(vp;t4 rtoiociytlmt anvi ()s2xm(r oydolee fei sfaDrr(root0tlt mo3tytfs rm(ms;u0trtrif3tadfm elueo s  2xr(mpiodlltelnvt sfa2tru  nt4ole if3iyt m rmumonu) lxnio totfatrauvo;t s2tmxopiy1apeemics tfa2umur nu1oet iieiydlsDeluvo u) lxnif tytfp e ivo;s  exr(o nydlp nmieils  Dtr(mp;u4oet  i3tasfs umnvp;()aetnir3io1laD lueo s teto(o3iy1oleelies (f rurump;o1tle mf3tysfs ea(ms t)tetriociydoatr ieslt0s2urir oudole lnvtlsfsDraur nu0apto iciyslaDuan o;t)areoxf iytlm   i ols)trto(m3nydol   nvilt)artrxrpoo1tlto o3tadfs um( pn(4 exoir3oydom eauvo;s) exoir3iy1am  mfvsltfsrumxmpnt1aetoiietlsfaDea( pnt)alxomo3tatoat  n ol(0t2toxr oydolenlneslsfaDta( pnt4alx miciadlmDea(mp;u0areomr3iatop eauei;s)t2xrimpny1lptemnvs t)a2rrxmonu0tex  fciat m2rl(vs;t)tetnmf iodop elivil( t2xrxr3nudope lnei t)s2tr(ront4aeenioetytls2umn o (0aeeomo oytlpDrln sl( setoim no4lm emfci t)a2uaur no0oeen ieildfaDrm(von()artoxf io1fmDrluvs s  2xrxopnu1oleeliesltfa2ta(mpot4texomf3ias sDrl(vo;()tltrmrciotfmDeanes s sexo(opio1lmeemfvt ( aDtr(r nu0opt mi3ils aDrlnvs u)tlxomf oytlp e uei;s0srum(opiodamee feils  Drmxr ot4tle  ociasfa rau p;t) renxrcootlmDr iei t  2xoxm3ou1ol  mnctlt)srtaumpot0oex mi3tadlaDua(vs;t)tetoxo3tydoat  uvi (0sexm(m3nodaleemfvia() 2raum nu4ale  feiytfsDraums ()alxrircoa1lpDelivo (  2to(r3oy1omenlnet sfsrtrum no1olxnmiciatlmDeln p t4alxrxo io1lpteln sls0texo(mpou4apte ieslsf Drmum ;t0apenmietydfa2uauvs () rtnmr3oa1lateau i;t0srtoxm oo4amt mfcs t artaum ;u1openifctysfaDrm( o;u4 rxnmf3ia1lm rauvils)s2xrio oo1ale  fvtl( a2rr(m ot1teeo fctltlsDua(vs;(0texomrcoytfpt aueils0 eumio ny1lm n icil(fsrrmurp;u4openioeild sDrau pnt4trerxrcia1la r i ols tetrir iy1oleelivia(farumx  ;o4altn feiyt s2rlumpn(0 lxoir oo1lpD lu o s0tetoimpno1alenmfvt ( aDtrxmont4olt if3tldfs em( p;u0 rxnmf iatoptrlnvi (0tetm(mpoodlltemieta( sDrmx poo4alx  oeiydfm rmums;()trxoir to1lpte u slt  exrio3iodll   ivil(fsrur( ono0alxnmf3ilsfm rmuvo;()tlermf tatlp ranvi;s)tetrim3ny4lptnmnet (  rrr(ronu4altnmf3iat m emnms (4tetnxfcoodoa  au o;t sexoim3nu1lptnlfes ()arurx p;o1apt mociysfm2rm( s t)arxnio3oo1lpDr ues t0srtrxo iy4lpte fesa(  2rrur ;u0tlxn fcildlmDuluvp;u0trxoir tatlate n s;t0s2tm(o iudlpt mivsls)srtmu ono1tlt mociydlsDea(vo t0 reomocoy1fm  auesls)tetm(r3ny4om nmicsat) Drru  nt4opxomi3iyd m2rlu o;(4 lxoir3io1fm   ueo;(0 rxoiopiy4lle mfeslsfartmu  nu4optniietys sDel( snt)trxrio iodlmt li o;t  rtmir3nodameemicil( aDum( ont0olx  fciyd m2eau s t)aexrxfcty1lm eauvolt s2trxm3io1om emnciasf Duaxmp;u1tpen iciltfs2umn p u0aetnxr iadfaDeln s t)t2ur(m iy4op nlnvtls a2rax o;u4oeto iciaslaDrm(ms;t4 rerifctodlp  aivs;s)srur(mpoo4ll n ncia()s2raur oo0alxnmoetyt aDeln onu4 ltrirctadfpte ieols trtoxr3nydol  mfciltfsrrm( pno4olxoifctyslsDrm(vp;u0teenir todoptrln s t srurio oudame liei t)arurum ;t0tex ii3tas s2uluvs;u4arxnxfcoa1oa r nes s setmirpiu1omen nvt (fs2rrum ot4opt ii3tldfmDrm(vs;()trxomocoytop r i s ( texmimpio4alte ieta(f 2rm(mo;o0apxomietytls rmuvp;u4 ltriociytla rlu i t0 etrxm3oudamenlivt ( s2ua(rp;u1apt moetltlm2ra(vp;u0aeerir tatfpDr u s;t0trto(o3iodalee neia(  rurum nu4tlxnmfeildlm rmuvp t0 lenmfcoytlaDrau i (0teuoxm nodomenmfvsl()aDta( p;t4tee mfciatlsDelnmont0altrmr ootop eliei s sexmxm oodale  fesat srrau  ;o4tetoifcilsla2el(mo t0aleoxr3tydfmD ai s s)srtmxr nu4lmt  nctasf rraurpou1tlenmieias aDua(vo;u0trtrxr3ia1lat  nesl() 2xr(mpoydlm e fetat)a2taxmpot1tpt  ieiad aDelnmp ()tlxnmf iodfp rlnvo t0 2xrxm oo1ll e ivslt)srumx ont1tpenioeiadls eluvo (0tltnxrctatomDr iei t  exmxopou1opt  nct sf rua(rpoo4tpeoifctadlmDrmn o (0 etnmf iotfat lnesl(0t2tr(rpoydlpeelici () rtaxmooo0tetnmicias mDumuvo;t0 rxoxo3ty1opt li o;s)srxr(opiy1apeelivslsf Drmxrp;o1aptn oeilsfaDrm(vs;(4 lermr3oo1oa  luvsl()s2umxopoodlmtnmnetltf rtmx ont4apenmoctatfm uluvs t0alxomf iy1lpD  neslt0trurxr3iudome mfcsat  Drrumpnt4tptomiciadfa2ranvo u)arerio ta1omte neo;( srxmxm ou1om n ncilt artaumpnt1alt  f3ilt a ra(mp;(0 eeoir3iy1lmtraivolt  exo(o3nu1om   fct t)sDra(rooo4tle mocilt m2em(mp u)tltnir io1fmDrlu olt  etoxrpoo1ll nmfcs sfs2uaxroot4oexnmf3iatls eanvo (4 rtoiocty1omtrlieilt0trtrirpnu1lpenmncia(farra( ooo0tleoifcildfaDrluvon()aexomf ta1op eluei;s t2umxrpoy1aptelfcs t)srrrxr ot0tpe  iciaslaDum(msn()aetomf3ty1om rln ols0 rumxr ny4ol n icil( aDrrxr ;u0tpt mf3tat a2umump;t4tetrxfcoa1fa raneo;t)srxmxopno4oltn nvi sfaDtmxmpou0oet if3iytfm umn s;u) renxf3iotfaDelueo s)srum(m3oudlmtnliesls)arrau o;u4teen feiad aDrl( s t4trxnxo3iytfat  ies t0 rurxo3iy4oltnlfvtls srumurpno0aetn i3iadla2emnvp (0 lenirciydlaD li ol(0 2toio3oo1omtn ies s)aDuauro;o4tpenio3iad aDul(mont0texoxr3iadfmDranes;t t2xmio ou1om elfeiat s2truronu4optoif3ild s2el( p (4altrir3tatlpDeau i t srtrxr3oydolen ictat srrau  nu4opt io3iatfs2umuvsnt4 etomrciotlmD anvi;t)s2uoir no1ll elfct tfa2tm(rp;t4opxo i3iasfm2uln o;(4alxoxociadfa eli sls)srum(o3oy4ameemncsas) rtaxm ot1tlxnmieilt mDemnmo;(4texrmr iotlp rlueo;s)sexoir nydoleelfci s sDumurp;o4altnio3iys a ran s;u4tetrio ia1opDe ieols0trxoiopnodolt  fcil()aruau  ;o0alx moeiytlmDum(mo;(0 lxrif iadoptrlieolt)setoxo3iodopeemicilsf Drrum nu0oee ioctlsfm ul( s (4texrmociatlp r ivs s)srtrir3io1omt  netat  Dtrxm ot1aeto ieild a2umu s u0texoif3ta1lmD lu s;( trxrxo oy1ll nlivi t  2tmxmo;o4alt ioeildlmDelu p (0aexoxoctodlmDranvi;s0setoxr3oy1optemnct (faDtax  oo4apeo ociysfm2eau o;(4aexomrcty1oat lnei t)s2urir nydap e netls)srrrxm ;o1aee  octasfs2um( ont4tltrifcoy1oaDe u s ()t2toxo3no4lptnmiei s sDtrxro;u0apt  oetys m2rmnvs (4trtrxo3oy1lm ranei;s trurio ou4llenlieias)sDtrx  ;o1oeeoio3tydls2rl( ont0arxoxf3ootopD auvi;s)texrim3ny1om eliet (  Dtrx ont4oexn oeias mDulu s u4tlxnmo ia1oatrlivo s trurxo io4al n icias)s2taumont1apt  feiydfa2ra( s;t)aeerirctatomtrlies t t2umxopiodom  lncta(f Dtmurpnt0tee mi3iad a2elnvp;(0 lxoiociydfptrlivs;(  rxo(opnydaptemfvt ()srumxm ;t4tet  i3tatls el(vo u0 etoxrctotlpDeanei t)s2tr(mpny1lmte nctas)artrxmo;u0tlxoioeild m2ran pn(4 etrif3oadfpD lnes s0 rxoxmpiu4ll elncs s s2rmx oou0apxoifeiydlaDumumo;u0tleoxo tydfmtelnei s)s2xmio nu1aptnlfcilt)a2tr(rpoo4aeeoiicilsfm2ulumon(0 etnio3io1fpteli o;t  rum(m3oo1lptelncias a2rmx o;u0tpeoiiciyt m2em(vs t4artrifctadlmte nei;s)s2xrxo3nu4lp nlfeta(fsDurum ;t0aet ifciltlaDem(vsn() exrifciatop eau ol(  rtm(rpnydaptnlfetlt  2ua(m ;u4tltnmieiydfsDea( pnu0tlxomrctydlp eln s;t0teto(o oudale mietl(fsrrr(rpno4oetnmo3tadla elums;u)alenir3iotlat  n ol(  rxo(m3nydlptn fctls)arurx  ot1aex  o3tltlm2emuvonu0 lxrxf to1oaDrli ilt0 rtmir3no4alt  nctat) Dtrxrpnu0oeeniocias m2um( p;(4tlxoxf3iotom r neo t  rtmio3no1altemicil(f rurx  ;t0optoifetldfmDrauvsnt4aetoxrciytomDeai o;t0t2umir oudlmt  ivs (  2rmur ;t0aexnii3tlt s rlnms t0trxomr3ty1fatelieol(  eumxopiudam  mfesa(f Duaxmp;u4tpeo ictas s2rln o;() rerxo3oodlmDeanvil()trxmio iy1ap  lnctas)s2umx o;t4aetnmfetld a2rlu s;()texrxo to1oaD  uei t srumim3oo1open ieilt)artmu ont0aexnmfetldfmDuau o t4 exrir oytlm eliei t srurxm3iudll nmfciasfa2tr(rpno4openioeiatlm2uan s () etriocoo1fp  lneo s s2tr(o io4ope lncs sfa2tmumpnu4ope ii3iatfa2rl(mp;(4 lermrcoytfm rluvi;t  2xo(o iy4alt mnvt ( aDrruro;o1aeto ociysfs rlnmp;t4 rtrxo3ty1lpD ai o;s)seurxm3iydlm n ivi (f Dtru o;u1apxn feils sDulnvs;t0 eermo io1lptr nvi;()srurir iy1lme lfetlsfaDtrx  ;t4tleoio3iyd a2em(mo;t4 etrmociy1faD  iesls0texoim3nu4lme  icsatfsrtaur ;o4oexoiociytfm2emnmo;(0 leoio iytfpD lnei;t srxoxm ou1ap nlivia(farum(  ;u1texnmfciltlm elnmpn(0tlxomo oadfat aiesl( s2tmir3ny1ol n ieiasfa2rr(mono4teto o3ildfs uanms;u) rtrmfctytfmDrlivo;(0t2tmio iydaltn icias a2trum nu4olx  feiys aDumnmsnu4teenxo iydfpDrauvo;s teumxopou1al n fcsltfaDum(mont1apt ioeiltls2emnvp t4trtrmf tatom  lues (0seuo(r oydam  mivta(faDrrxm no4aeeomfcildlmDuluvp (4 rtoxociotlp  ln slt0 etoim oo4openmicilsfaDurur ot1tpenmoctltfm rl(mon(0trtrxociy1latraies;s t2uoio3ou1am e nes (fa2rru ooo4oltn o3ilsfs elnvp (4aleoircoo1faD  ivo t sexm(mpiu1aptn fviat sDurxmpnt1tleoifciltla2ua(mo u4 etomfcoatfmtrlies;t) eurir oy4lltn net s  Draumpnu0aexoiictld mDuaump;u0 lenxf iy1lm  aues ( t2tm(m iy1lpee nesl(farrrurono0apt ifcildla ua( o t0arermo3ty1la r i ols)t2xmio3oydll n nvi s srtaxmpoo4texo octaslmDumnmo;(4 ltomr3ty1oa  li sls t2uoxm oudom  lieta( srumxmont1ole ioctasla2rmnmo;()trtoxrciotfa rauvi t)seto(rpiudlmt  ici (  rumxmpno1tlx  feiydlm2eln s t)arenio3io1oaDraueolt sexo(r3ny1apt  nvt (fs2ur( pno1olenif3iltfs rlu pnt0trenxr oo1opD an o;s0teumio iodap e icslsfs2tmxmont0tpx mfcilsfs um(vs u4arxnio tytlpD  uvsls tetr(r ou1lpenmivta()a2rmxm ou1tlxn ocildlm2elnmpnt) reoiocoatlmD anvs;(0srur(m ny1apt mnesls  Dtrxmpot0oetnmf3tyd a ulumsn(4 lxoxrcoy1lp eauvil(0t2xrxo iodlpe mfes s srrrxront0aex  iciyslmDumnmonu)tltrircootfpt an ols s2tmxopny4op  lnesls)sDtm(ro;t1apxomfcildlm2ul(vonu4tleoxf ootfp elivi s0 2tmxr3iu4al eliciasfsDtrxrp;o0tlenmfctlt aDrmn p;(4 rtoxo3iydfm  au slt)srtrxm nu1aptnlivsltfarrmx p;o0tlxomiciasls2rm(vp t0alxomocoo1laDe nvi;()trum(o3iudolenlfvt ( sDtrumo;o4opt iictyd a ran s;() lxnxr oa1la r u o;t0 eumio3oudamtnmneias a2tau oot4apxn ietlsfs rlu o;u4artrmr3tatfpDeauvils0 2tr(r3ou4alee net s)arumxrpno1opxomocias s2ul( o u0 exomo3oo1fatrlu o (0teurim3ou1aptn fcsl( aDuaxmpot0tex  fciytls uau p;t0tltomrcia1omte uvo;s) etrirpno4amtnmneilsfs2rmuroou1oltoiiciad a rl(vsn() etrio totlm   i s (0trtr(mpnu4omt mict (  rumx pnt0alx ioeiyd s2rlnvsnu) eerxf ty1fpt  n i;(  exoimpou1ameelfctat) Dra(mp;u0alen ietad aDum(mo;u4texnmr oytfa rluvol(0 2uoir io1optelneslsf rraum ot1opxnii3iytls eluvon(4alxrmf tatfmDe uvi;t0texoimpoo4al e iesls)sDtm( pnu4tpxo f3tytlsDrl(monu4teenxrctodoate n sls)srurim iy4ll  lfviat srrm(r ;u1tee mfetys m2elnmp (4trxrxo3oy1fpt  ues s) etmio3nudlp n feiasfs2ta(ro;u1aee mi3iytls rau p;t0trerxr3oadlm e i ilt)s2xo(m nodoleelnesl(f Dtmxr ;u4oltn octls s2rm(vp;u0alenir3iytlm rauvi (0trxr(r3oodaptnmnvi (fsrtrurp;u0apxoiictytla2em(mpnt0aeerxf3ty1opt auvo s) 2xmxm iy4omenlfei ()a2ur( poo4alx  ociyslm2ran pnu4teeoxf ootfmteaivs;s  rum(opno1omenmiei t)s2tmu  ;t0ape mieiatlsDua( sn()tetomociotoaD  ies s0sexr(mpoodame  ict s) 2raxr ;o0ope miciys s uau p u4 eenmr oo1omt au olt0t2xrxo no1lleeliei s) Dra(rpoo4teeo ieilsfa uln pnt)alxrmo tytlaDr iei;s tetoxm oo1alte nvt s s2uaxmp;o0tle  octadfa umums ()arxrmo3tadop ean il(0srtoimpny1omtelfvil()a2rr(rooo0ape ioeiasla rluvo u)tlxoxo3oadla eliesl(  exoxm3oodapee net tf 2tau ont0oexn o3tls m umumon()tlermo oa1om e i s;t teurxm3iu4omt lfeslsfaDta(  nu1aexnioeild aDrm(mp u0 ltrio3ta1fptranvol()sexrio3iydop e ies ()srrax  ;o0tptnmi3iytfm ra( o;u4tlxriociatlpD aivo s  rum(o nu1oltemnctatfartaum ;u0opeo iciltls ran onu)aetrmf oy1fmD  u ilt0t2uoxopiydlmtemfvsl() rum(rpnu4aptoifetltfs rl( o;(4 lenmo oadoa rli s t0s2uo(opiy1llt  ieslt aDrmurpou0tlto o3iyd sDemuvs t4teerxrcto1lpt aueslt)srto(r3iudom nlietas)s2raumpnt4optomociasfm2umnms;t0trxrio ootoaDrlivo;s t2toir oydol  livt (fs2rru p;u0ope mfctyslm2ua( snt0alxrio io1lmt  u sls0seumxm3iodaltnlnes (fsDraxm nt1tptnifeiyslsDrlnvp;u0aleoxociotfaD aneo s) 2xmio ou1aptn ieta() rtrumooo0alxoiicilsls2ulnvsnu4tetrxf3io1fatrln i;t) 2tmxm3oy4omeelietlt aDtrxrpno1tptomociydfa ulums;t0arenxrcoatfa e ues s0 rumxrpnudom n fctat)artr(r ot1tee ioetasfa2em(vo u0 exoxr3tydfmteluvi s t2urxmpnu4lpt  iesa() rra(  ;t1oeeniietld aDelnvsnt)arxnxr3iy1lpDelnvs (0 2xmxrpnudlp  mnei tfsDrm(rpno1ole  octadfs uanvs;u4trxrxf3iy1lptr i i;s  rtmiopiu1lle  iei s  2trxmpoo4tpt  i3iltfa ranvpnu) lxnxo3oodfpD an o;s  eum(m ou1altemfcslt a2trur nt1aexomo3iltlm2ean s;()teerifciatoa rai slt  2urir io1omt livtlt aDraxmont1opto o3iytla2uanvs u4 rxnmr tatfm rlivs (0 etrxopno4ap  lieta(fs2rmxmpnt1optomoctysfa2rlnmo ()aeermr iy1fa e ivils)truoim nodlm nmicsa(fsrta(mp;o0tetniociat m2ulump t0 rerxf3oo1fpD lues t0 etoxmpny4lle mies () rrmu pou0aexoio3iltls2eau p t0arenxo3iodop rli s;s) 2urir3oydlmenlncslt srum(  oo1oet mfeiadfs2ra( pn(0tlxnmf3oydfmt lu s;( trxr(opiudlmt licsa()srtrurono0alxoioeils m2ulnvo u4altomrciytfmDran i;t0 rtmio iy4lm emneils)s2trxr nt0aptnifeildfm2rm( s;t) exoir3ia1omtelies s seumxo ou4lpt licilt)s2ur(mp;t1tpxoii3iysfa2umn sn(0aeeomocoy1fp raivs s) 2tr(o3oo4openmicsas)aDuaxr nu4alx ifctltfaDua(mont0treomrcootomtrai o s)teumirpnydopt  nesl()srrm(mono4tpe  o3iysls2emnms t) leomr3oadlatrlu s s srurxmpiu4aleelnvsl(fa2tmu pno1tee  oeiadls ean pn(4altrio3oatomtrluvolt srur(o3oo1lltnmicia(  2trump;t4oexomieiasls uan on()altrmrcoadlmDr iei t)t2toxopiy4lm nmfeiat)aDumxmpoo1tpx moeiyd aDeln snt0aeermr iodlpDrlies;s s2um(r ny4ope lfctas)s2ur(m no4tlxnio3ilt m2umumo;(4 rerxo3oydfp  ln i;s trtrio nu1altemfvtat) 2ra(mpnu4tpe  o3tytfs uanmo t)arxrir oytlatelnei;t srxo(o iy1omtemfct t aDtrurp;o4apeomfciysfm ra( sn(4 rxoir3io1laD lnei;(0srxrxopiy4ol n ivias s2taum nt4apx  ociltfm2eluvo t4tlxnio3ty1fm  livsl()s2xm(o3nu4op   feslsfaDur(m no1optomo3tadfaDumnvp t) rermo oa1op eanvo s  2toxm oo4lle  nctas) rtru pnu4tptomictydla2uanmp;t4 exnir iydfaD  u olt0srxm(o oodlleelfvi sf 2rr(  nt1tltnmiciat s rl(mo;u)aeerxf iatopD lnvo s)s2umxm3nodape  nctatfa2taxmp;t1tlenmi3tadla2uau p;(0trtnir io1fptr u sl(0trurir3nydam nlnvilt sDtm( p;t1texn fciyt a2emnmp (4arxoio3oytop  au i;s srumxmpiodllt livslt  rurx pnt4aexo f3tytfsDrmumsnt)tlxrxo3oydlaDeln s;(0srumxm nydlptnmfcsatfa2tm(m ;u4tpe mociytfaDuan o;t0trtrmrctadomDrluvo;(0t2ur(opoy4apenlfctl(fs2truro;o0tleomf3iysfs emn pnt)arenxrcta1opt  iei (0t2xmir3ou4am eliciat)s2trxmpou0tlenio3iadfs2eln snt0tltoxocoodoaDranei;( setrxrpoo4lltnlnetas  rumuront4tlenifciatfa2emu p t0teerxo iydfaD  nes (  2urir iy1ol e fei ( aDuax oou0oee io3tyt mDrlumpnt0aleoxf oa1fateluvo;(0srum(o iy1lm   ncs t) rur(r ;u0apeo ictltfm2emnms;t4 leoir todlpD aues t) 2tm(r3oydopeelnvtltf rta( oou4oexo ietldlaDelnmsn()aeenirctydomD lu ol( tetr(r ou1lmen nvils) rtaur ;u1tlxo fciadlmDumnmp;t0 rerir ta1oat an i;s  rtm(r no4lm nmnet t) rtr( pno0olxnmfctldfm2el( pnt0arxnir oytfpte nei;( srtrxopiy1am emictat)a2uru p;u4tltnmocildls em( on(0tltrir3iatlaD  ivolt seum(rpiy4apee nvslt  2rr(moou4tltomo3iltfm2eau pn(0 lenir3iy1fa e nei;t0s2uoim3no4oltn ivt s)sDururpnt4oetoifciadfs eaumont)areoifcoy1fateaies s)srxmio iydoltelnvi (fsDtrx o;u4opxniiciyslmDrmumonu) lenmr ta1fmDe ivo ()trxo(mpno4llenmnet ( srururoot4teen i3iys mDelumo;(0tetrxo oadlmtrluesls0t2xrxr no4ap elfcta(fsDtr(rpou1opx  oeiyslm ulums;u) eerxo3ta1lpte nvil()trtrxmpoy1omen fcsas)aDtrxront0oexo fetadlm elu ont0altomr oatfa r nesl()sexo(mpnu1ameemnesltfarrmumpou1tpenmf3ilsls rm(msn()tlxrifcootop e uvi;t)trum(opiydoltelnes sfs2um(rp;t0tlx ii3ildls2rlu o;t4tlermr3ootfateau o s srtm(m3io1lltnmivtat)srurum nu1tpt mf3iydla uauvo t) eeomrcoo1opDr uvo t) rxmxr3ny4op   ivt ( aDraxm nt4apeo f3iadfm2rl( p;u0alenir ootlmt liei;s) 2xrxmpoudaptemfet t)a2uaxm oo0apxomfeiltfs2uaumpnt) lxomfcty1fpD anvi;s)seumim3nudoltn ietat s2rmx  nu0tee mietldla ra( p;(0trtrmf io1fpteanvs t)texrxo nu4apt lnvs () Dur(rp;t0aleniociyt s ra(mpnu)texrmr tadlpDrlnvi;s0truoxm io4lpenlnctls) Duaumpoo4opxn octltlm ulumo u0 etnmf tadlatelnes;s0s2tr(rpiy4opt  fvsasfa2rm( pno4tpx
\ No newline at end of file
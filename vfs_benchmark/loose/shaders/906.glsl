@@ -0,0 +1 @@
+n o;s)seuoxo3io4ome lfvtat)s2ra(ront4tetoiieilt a2rmnvont)alxrmf iydfa rauvils  etmxo ny1lmt lnvi t srrax pot0ale iieiatla2rlumo;t0artrxrciytfmDr neil( s2xr(m3nudopen nci t)s2rrxm ot0tle  feils sDrmu s;(0trtnxf oytlpD au i;t srxrxo3iydlm emicsl(fsruax o;u0texnioeiytlmDrlnmpn(0 leoxr oytoaDe ueslt)sexrirpoo4lmenliet s)aDumx oot1olxnmo3iyt sDea( pnt)texrxocoy1omDeaies;s t2toio3iydllt lfes t s2uax  no1opx  icias s2um(vp ()trxomocootoateai ils0 2xo(rpoy1opeemnes sf rrax o;o4ale  feiatla em(mpnt)aleoif tatlpD luei;s)t2umio no4lleelnviatf 2rm(  nu0tpt moctyd aDra(vo ()alxnio3to1fa  anvsls0srumiopnodamee icia() ruax o;t0oltomiciad m emuvp;(4 eenifciodopt lu o (  eumir oudamenmivt sfaDumu ooo4apto fciytfm el(mont0tltnif iodomt ai il()sexoxo3iydlm n ivsa( artm(rono4apxo i3tat m2rmn o t)aetoir todla r nvo s0s2urirpno1lltn fviatfs2rrxmonu1oee mi3iyd s ulums u)alxoxf oatfaDrau i;t0trtm(r oudol  livta()aDtmum oo1tpe io3iasfmDul(mp;t4arxrir oadla  luei t0truoim iu4ameelfei tfa2rauro;o0texnmoeils mDuan on(0arxnif3to1lmt lieolt0s2uoir iydlpte fet (farrmxr nu1alxn fetat a umnmp t0 rxrxfctytfat  iei;t0srto(o iudlp  lfes sfs2taxmp;o1tlenmo3iltfs em( o;(0trtoxr iadfpDrai il()t2tmim nu4ap  lfctat aDumx onu1aee  oetasfm2rlnms;t) rxoirctatfpte u s;t) eur(rpno1lpeemnet tfa2ta(moou4aleo oeildlsDra(msnt0trtnxocoo1lm  aueo t)t2xoimpoodalenmics sfaDta( poo4tlx  ieiat sDulnms;u)aetomf3tadfm rli s;s)t2tr(o io1opee fcias) Dum(  oo0aetomicilt sDelu pn(4trtnmo ootlatr ueolt sexriopoodlmte nei (f rrmxr nt1oeenmfciadla2eau p;(4tetnxrciadlptelneolt)texm(r nudalenmfvtltf 2ta( pou0altomoeild aDra( s;t0tltoxf3ia1fpt  ivi t) etmxo oydomenmictlsfsDuaurono0oeeniieiys aDea(ms t0 eermocoytfpteanvol()seuoio3oy1aptelfvt tfarum(ro;u0oetnii3tys a2eanvs ()trxrir oy1la   i s ( s2tmirpiu1lme mfvs (fsrrrxroot0oexnmieiyt m2ea( o t0 lxrif3tatlmtrluvils  exmxo3oodol eliesa(faDtr( p;u1apeomi3tlsfm2emnvo;u0tetoirciydoptrlivi;t) etrxr ou4ame livt sf 2ur(rpoo4tpxomictytfa eln p u0trtnmr3io1oaDe uvs;s0 rurxr3nu4optn ics (fs2umur ;o0oltomf3iytlsDrmn s t4 etnmociytfmt  nvol(0texo(r3oo1lm elnvil( aDtmu oou0apeomicils m2ulumo;u0tlenxf3iy1fmDrluvsls)seto(o3iydam emfvi s)srumu ont4tleomi3tasfm2rlu ont0alenxfcia1omD aneo;(0 2trxrpny1amee nvil()sDrru pnt4aetn oetlslmDumumpnt4 lxnxociodlmt  iesls srxm(o iu1amenlnvi t) rtr(mp;u4tpx mf3ilslaDel(vsnu4aeerir3iytlptean i ()texmimpiu4lpenlfci sfs2tmx ooo4apt ifetltlsDul(vonu) lerxr3tadop raieslt)seur(m3no4omeemfetat sDtrurpou0teeomiciyslaDranms;t)alxnifctatla  ai i;(  2xoimpoo1lpeemneslsf 2tr(mo;u4tptniictas mDrl(mp (0 exnir3oodoatr ieslt)trxmir3iu4lle  feia( artmurp;t1tptnmictlsls uan p (0aeenmr iatlmt lneslt) eurxmpoo4ll elnciat) Dtmu poo0apenifeilsls emnvp (0altrmf totomDranei;t) rurir3iodopee icsatf 2um(m no0olto fetltfa2uanvp;()alerircoo1fm e nei t tetoiopny4lpe mnesasf ruaurpnt1oexomo3tyd a2elu p t4 ltnxfcta1fateln ols)trum(o io1olte nctlt)arur(mp;t4oetoii3ils a uan s t4tlxomf iadlaDeln il()texoxr3nu4llenmnvi tf Dtr(rpnt0tpxnmo3ilsls2uluvpnu0 ltrmo oa1op r n i (  rtoxo oo4al e fctatfa2ua(r ;u4olt mictytfmDean s;u0 eenio3iotop  ln s;(  rtm(opnodapt mivi t s2rax ooo4tee ii3tltfs eanms t0aexomf tatfa r nvil()trxoxr3no1ol  miei tf rrau p;u4opxn fetldls2ulnvsnt4alxrxo3oadfm eaivs;t) 2toxm iodop e fci ()srrrxmo;t1aleoioetytfmDumn o;(0alenxfciy1fm  lieo;t)srumxo nydlme mnesl(fs2urxm ot1ape moeiltfm rm(vs ()teerifcootlp  ai o ( t2tmxopoodlp nlicsltfsrrm(  ;o1aex mi3ilt aDulnmsnt)arermr oy1fmD  i ils)sruo(r iy1omt lnci sfartm(ront0aeto feiyt a2uaumpn()tlerxr oodopt an s;s0 2toir no1lpte ncsls) rtm(r nu1olto ictasls ea( p;()aetnxr tadoatr u o;( s2xoxo ny1amtemnctlsf 2tax  ;u1tle  o3ilsfaDran s;t) rxrxf to1fp rauei;() eurxr iy1amt lfeslsf 2rm(moou4aetoiictyt mDul(vpnu0treoxo3totoptrli o t)srtm(m nu1lm n feslt) rtr(m nu4aleo f3iasfs2ean o;t4tltoxf iotlptr uvo t  exr(o3no1open fet tf rurxm nt1alto fctld a elump;(0 ltoif todfptr u slt t2um(m3iu1lmenmfeia()srta(ro;u4optoii3tatlaDeau o;(0aeenxr3iy1fatean o s trumio3oydlmt mnet sfsDraumont1olxn o3iysfs2eau pnu4alxrxr iadlate i o;s0teur(rpoudal elncsasf Dum(  no1apen i3ildfa2uaumon(4aexrmocoa1omDranes s)texoim oudam  lncils s2urxmpoo0olxo ociltfa rmu ont4trxoxfcia1lpDraiei;s)srxm(opoo1ll nmncsa(f Dtr(  oo1oltn o3ilsls2rmn s t0texoir3oydoaD  i s ()trtm(opoy1am  mfeia()srurum ;o1altnmo3iatfs umnvonu)trtnio3oy1laDrlnvsls0sexmxr oydll  lfesa( artaur ;u1aeto octadfm2el(msn(4texnmoctadlm raivols srxoio3oydapee ncsasfsDumxmono1openmo3tydlmDemumsn(0teermr tatfmDr neolt t2um(r nu4lmtnlicil(f Dtrur nt0aet  o3iytls elu p;u)arxoir3iytlp rluesls)trur(opou1alee feilsfa2uaxr ou1oex ioeild aDuan s t4 lxnxocoy1latrli i s)t2xr(m oodll  lfcilt) Dumur ou1olt iiciadfa uaumsnt)trenxo3oo1opte i o s0teto(opiodop emnetl(fs2tr( o;t4altn o3iadla2rmnvp;(0 leomf totfmDeluvi;s0t2xmim3ou1aptnmfviasfaDtmu pot0apxniociytla2eauvo;u0 rtnxfciadfat lneo;s srurxo3no4amen ict t)sDtr(  ;u1opto iciatlmDum(vp t4alxnxf ty1faDraneo t)srtmim3nodlm   netat  2taum nu0aeenmfciad m2rmn o;u4teerxo3tytlmt lu sl()s2to(r3no4am  mnet ()s2um( pou1aex iociyt mDeanmp;t4 rtnxf3oadfa elueilt0 eum(m io1ol emfct (faDuaxmpno4oet ifeiytfa emnvpn(4teenmf3tytomt aivslt s2tmim3nydamenlnet t  rum(mp;o1aexnifeiyt s ulnvo (0arxnxr3oydlmtraivi;t0s2urxr no1amtn icia( srra(  ou4open o3iydlm2emuvonu0alxomocoodlm eai s;s)s2xoiopnu4amenmivta(fs2ta(r ;t0opxn i3tatlmDelnmpnt4arxrmf3oodomD ln i ( teumxr3nodapenlnvia()sDtrxro;t1ole  iciydfs2eluvpnu0alxoxo3ootfm  aivil( s2xrxr3io4ol elnesat)srururont1tltn o3ilsfsDrluvpnt0 eenmrcto1omD ai sls srtrxr3iy1apenmnvsasfsDtrumpot1opeomieilsfs2rlu o u0trtrif3oa1lpD  ueo s t2tm(o3iydome  iesa(f 2uax pno4opt if3tytfaDrmnmo u)aeeoio totfpte n s (  2xoxmpoy1aptemies s)aDurx  no4oeeniieilslm2el(vo;u0tltnmociotopteln sls  2uo(o3nydlmt lnvias srrru  ;t4tpe  fetltlmDul(vp;u4 lerirctadoa  auesl()tetm(r3oy1om  mncils) rtm(mo;u1tpxo ietytfa umnmp t) lenio3oy1fmD  ues;s0 2tmxo3iydapee neia( s2tr( p;t0oexnmfctyt a eaumont)artnio iotomtean s (0s2xr(m3nu1olt  fvsat) Dtr( pou0oex iieiltls2uauvp;u) lenxf iatlpD  ieol( sruoxm3io4ol  mfes s  Dumum ;u1tet io3iltfaDeauvo;u)aexnxfcoodop eaueo (0s2xo(r3oy1lmeemivt tfaruru p;t4altomfcild sDrl( p;u0artnmo ia1fmtr ies;t0t2trir oo1omee ictat aDuaxrpot0olxoiociys mDelnmp;t0alenxr3to1lpD livolt0tetm(o no1omen fvi t)s2raurp;t1aptomfciadfmDel(mpn(0aetrif oadoptelnei s  exoxr3no1ome mncsatfs2raurooo0apen oetatlm ea( s;t0tltnircoy1omt aivi (0t2uo(rpio1op nmfeiatfaDtaxm ou0aexnifciyt s2elumpn()tltrxr3oadfm   u ilt  exoxm3iu1lp  mnvs t) Dua(mpou4tex iociltfa2umuvs u4teenif3oydlmD li s;()srxmiopno1oltnlfeilt) 2um(mp;t0optoio3iatfsDum(ms u0arxnioctatfpt aies (0s2tm(m3nodalenmfeilsfs2rauro;o1altoioeiasfm ulumpnt4tltrif totoa r uei;t)trurir3oo1amtn fcs t) Dua(  nt0texnif3iat m2um(vo u)tetomo3oy1fpt lnvs;s) 2xoxo oo1am  lnes (  ruaxmooo1alx ioetydlmDuluvs;t4teeoxo3tytlmDrlivi;t)trtoxo3no1op nlieia()srrax oot0aeeomi3iysla2um(mpn() eeoio iytfp  auei;(  rurxopoy4optnlieiatfs2ua( o;o0tlenif3tat a2rl(vpnu0trtrir3ty1omDr u ols0s2toxrpoo4al n fesas aDrmurpou4oex mieiat s2eau p () ltomrcta1op rlnes s0trum(r nydopte ieta( s2umu pnt4opxnmf3tltlm rmnvs u)trtrif tytlatrli o t0tetmxo oydlpt livil(  2raxmpnu0opxnioeiaslm2uln on(0aeenmrciy1late ieilt0 exrxmpoodamtemiei ()sDumuro;u0ope  octldlmDran snu) rxoifciodopt lueols) rxrio oo1omtn nct ()sDra(mo;t0alt  feiyd m2eauvpnt) exnmo ootlm   ueil(0trum(o3no4ameelfci t)s2tm(ronu1tleoif3ilsfm uaump ()arenxf3tydlpt ai s;s0tetmxm ny4om nmics t)s2rm(mont4alxomfetyt a rlu s;(0tltnmf3tadoateliesls0 rumio3iodolte fes (  2uaxm oo1tleoiicilsla2emnvp;u4alxrmr3iydfm   i s s) 2um(r ny1apt liesa()a2tmu pno0tlen i3iytla uanvs ()aetnxo3ty1faD lies s0srurxopou4ap e ncsls aDurum ou0aeto oetadfa2rlu onu4aetrxf3oytomDr ivi;( s2xmxopnodlle mivsl( sDrmxrp;o4tetnmf3tadfa2uanmp;t0alermoctodfmteai ils setrir3iy1al nliet () 2rr(rono0oetomo3iadfs2ua(vo u)artoxo3io1lmDeln o;( t2urimpnu1llenmnctlt)a2trxrpoo4tlxnifctadlaDrluvo;(4 reomo3ia1faDranvo;s0sruoxm nu4ol emfvsatfsDrrxmooo1apt moctlt m2rmnvs u)altomr3oytop rlies;(0t2tmimpnudolte nvt s  2rrxmo;t0oltnii3ildfa ra(vpn(0 rermo3to1laDelueo;t)srurim3nydam e neils srtru oou1tltoii3iatfa2eauvp (0trxnxf3tatoaD  ieo t0t2xo(r3no4llenlieil(fsrtaxm nt4oetniieiys sDem(msnt0tltrmo tydlm e nei t) etoxopno1llteliet sfs2ua(ro;t0olenmfeiys aDemn snu0 lerxr3oy1lat  uvi t0t2xr(r3iudlle  fcs s a2urxm ou0tptnii3iadfaDea(vo ()teerxo3oytlatran i;s) rxmxm iodlpte nct t s2rr(mono0alto ocild a eanvonu4trtrmr3todfm r ieo;s seuo(m no1ameemfetlsf 2ta(m no0tpeo ictadlm uau s;(0 lerxo3iodlmD  nvi s)s2uoxopnydomen ivsat  2tr( pot1olxoifciytlmDem(ms u4teenmr iy1fmD aues s)setm(rpnodlpee nvsat sDua(root1aexo fetydfs umnms;u0artnmocootfmtr uvols) eto(rpnydamenlivias  Dra( o;o1aet mo3iat s ulnmsnt4 rtnxr to1lp  auvol( t2tmim3oy1op  lfeslt)s2ur(m nt0ope if3ilt a2emnmo;u)aeeoxf todopteaivils trxmxr3iy4omee nvt s) Duaumpno0tptoiictltla2em(mp t4altrxf3tatom eanes (0 2tmir oudal nmnetls)s2tm( pnu1aeenmoeias m2uaumpnt0altomociodlmte ies s0seum(o3oydaptelnei tfa2trur nt4ale  fciaslm2rauvo (4 rxrxociotom r i i;(  etoirpoudlmt miviat arumx pnu0oex  feiydfsDeau o;t0alermo iadoa eau o t)t2umxr3iydope mncsasfsDurx p;o0apxnio3ias m2el( p;()trenmf3oodomtrlueo t)s2uoirpoodol elfct s)aDta(r ;o4olt iieiyt sDua(ms;(4 eermr3oo1op r nvilt0s2umim oy4ameelfcsl() Dtrxroou1tptnii3iadfa2uln p ()alerif oo1lat ln s;s) exmio ou1lpe  net (  2rax  oo1tpto i3ildfs2rl(mp ()aexriociodlp  an i;t0 rtm(o iy1op nmfvil(  ruaumpot0aee  fetatlmDel(vo;(4texoif3oo1lmtelnei s srxoxr3iy1alenmnesatfs2rmur oo0oltoioeiyslmDrauvp t0aeenxociy1omDeanvi s0setoio nu1lp nlfcsl(fsrrm(monu1oexo i3ildlaDrm(ms;t0tetrxr3oodlp rlneils trtoim iu4op elieslt) Dtaxmpnu0olenifcilsfs2el( s;() ltrmf iatoatrai i;(0teur(o3ou4omt  net s sDtrumpno4tlxn oeiad sDem(vo;t) eeomr iadlmtrlnvsl() 2toimpnu4lmeemnetls sruau pnt0opxoiietat aDean o t0trerxr3oatfaDeli o s)truo(r nu4aptnmies tfs2umx onu1optomi3iatlsDrl(vsnt0arxnifcoytopDr ues;t0 etm(r3oydapt  ivtat a2rmumooo1tpxoio3tytla2ea(vp u4 rxnio3tatopD  ieo t0trtr(rpnodaltn ietlt) 2uaxroot4oexo i3iadla ulu pnu0artomr3iy1fpDeai slt)trxr(r3oy1oltemfcs (f 2ta( pnu4opt mi3iydfa2ul(vo;()aetnir3tydoatrln i;t0s2xmxr3iy4lm   ncias)a2umxmp;o1tetniieiltlaDrl(vpnt4trenmr ia1lm e nvols0tetm(m oudllen nctatf Drrx  ot1tle mfciyd m um(mp;u)aetomrcoytomt  nei (0 euo(r iy1ale  ictas)s2ta(rono1aetn i3iadfa rm( o;(0trxoxo3oa1laD anei (0 2uo(r3iy4apt lfvsls  Dururp;t4oexnifciyd m ul(mp t) reoxf totlpDeai il(  rurxo iu4lp emici (fa2rr( ono1teeomi3iyt mDuluvo t4aexrmr todoate nvils)trumimpnodlm n ictlsf Dumurp;u1oleomo3iat aDea(vs;u)tlenmo oadfmDrauvi s)srumir oudal nlnct (  2ta( p;o0olen o3ilsls rm(vs;u4 rxoxo oo1fmtraivo () 2toxo3oo4ole lfvt s)aDtax ont0altoiicildfmDua(ms t4 ltrif3oo1omtrlu slt0 rtr(rpoo4alt licsat srrmum nu4ape mietltfm2ea( p t0 ltrio3tatla raueilt0 exmir3ou4llee nctls)aDraumoot0tpe io3tlslm2ulnmonu4aetnir iotoa   uvs;t s2xmxo ou1lltnlfei ( srrau p;t4tpto ietatlsDran o;u0 rtrirctotomDeaneo;s0setoirpoy1ap nlnvs t s2tr(rono4apxo fctyt s2el(vo u) rxnif ootla r i ilt0t2um(r3oy4ll e ivtlt)aDta(mo;o4tee io3tldlm umu s t) eerir oo1fpteaneol(0 rxrxr ny4llee iet s sruru o;o4oltomi3tytfa ua( pnt0 exnmo oodlp ranvo t0 rxr(mpno1al emncta()a2tau poo1tlxomietyslaDeau o;u)trtnmr oo1fmtelieil( s2xmxm oy1ap n fcsat)srumumpou4oeenmfciyt sDrlnmpnu4 leomrcio1oateliei s0 ruoxo oo1amenmncsls)s2tau o;o0tpeomo3tlsfsDrl(vp t0trtrxr iadoptr ieils0srumxr3oodolt lfcsls)s2tmxmono1tpe mfctadlaDul(vpn(0aetomo3tydlateluvi t)setmiopny4om n neil() 2urx onu4alxomfciysla2rmu s;t0 rxoifciatfmDraivi;t0 2toio iy1al e fctas) Draurpnu0oet iocias mDrlnmo ()trxrxf tydopDe ies;s) rumir3nydapteliciat) 2rm(r nu0openmocildlaDea(vo;u4 eeoif3oytfa r uvs t0 eto(o3iydlleelfei () rtaur ;u4olx iictatfs2rmuvont0alenxoctydlm e i olt0 exr(r3ou1om n ivi t)aDtrx pou1tet ii3tadfs2ulnms;(4tlxomrctodfmtrau s;t0teurxmpio4lp emnes t) 2tax p;t4tetomf3iyd s2rl(vo (4tetrxoctydfmDrlieo;s)tetoim iy1ole liet t s2rmxrooo4altnio3tytfs rmn p t)aeerxrcootopDeaues;() rur(o3oydoptn nvt tfsrurxro;u0opx io3tasfa2umumsnt0aexnio oytopDrluvslt)sexmirpou4ap  mncs t  Dtrxmpoo4tleoifciatla rm( s;t4aeeoircoadfat auei;t teur(r3nodome livsls) 2uau oot4tltn oetasfs2eanvs t4 renxf oo1fp eluvolt0srur(mpno1aptn fciltfaDrmumonu4olx  oeiytlsDumumo;u0texnxocto1oat aneo t s2xmxo iydoltn ivsls  Dra(  ;o4aex mociydls ran pnu4aexnxrcoytfm ean o;()srtmir3io1om emncs (  Dtaxrpou4oetoio3ildla2ea(ms ()aexrxr3iadlmtran ils0 2urxrpiodomenmfvtl(fsDtau pnu4opt  oeiyd a2rlnvsnu0artoxr iadlmtr n o t)sexrxr iy4lmte ici sf rrmxr oo4opt mieiyt s2rlu snt0aeermf oa1lm rauvil() rtoim io4amenmfcil(f 2trxm nu1tptomoeiltfaDul(vonu4 exrio oodomt  uei;t s2uoxr3nu4lm   ictat  rumur ;t0optn iciadfs2elnvs;t)arxoxo3ia1fptrlnvi;t0seuoio oodam nmnvils) rraxrpoo0tpt mfciytlsDrm( o u0 eerifcoy1la e uvols s2trxr iudaptn ivsa(  2uaumo;u0tlx  fetltfs2rmn p;(4aexrxo oadlpt li s s t2xmim iydaleemnvi () 2ta(mpnu4tpxniiciysfm umn onu0arenmf3ootfmD an o;s) rxr(r iydop e nctat arra(moot4aex mociydls rm(vo;(0arxomr3iatfateaneols0 rum(m oy4omt lnvtls) rrr(rp;o1olxn ieiltfm2rmnvo;u)tlxoxfcoodlm   ueo () etr(opoy4lltnmfctl()aruauro;u0aee moeiysls2uauvs t)areomo3iodfpDr iei s0 exo(o3oudom nmietlt)s2tmu  nt0aeen ieias sDulumo (4alxoxrctydom elivslt s2umio ou4apt  nvt t srra(  oo4olx iicildfa2rluvsn(4 lxrxrcio1optrlneo () eurir3ny4apt miet t a2rr(mo;t4apxo fctadla2rmumsnu0aeermr ty1oaDran s;s  euoim iy4oltemfvia(f ruaurpnt4tltomictyt s ulnvo;t0teerifciodopteauvslt0trxm(rpiy4lme  ictlt sDuax ono1olenmo3tasfm ul(mo;(4 rtnio oytlmt aivol( trtmxo oy4lpe  iciatfs2rmu ooo4tle  i3tlslmDrmn s u0altnif3oytla  aneo t0 exm(mpnu4opee ietasfsDurxr nt4tlto i3tas mDuan sn(4texrmr3todfm eli il( tetoxm iudlpee ietltfsrrrxr oo1oee  oeiydfm eln p;t4tltniocto1faDe u o;s srurim ny4op e ncs tfa2trxm no4tpeoioeiyd mDea(vs u)texoifcia1la  li i t0t2uoim3ny4lme mfvt t srumxmont1alen iciatfs2ul( p;u)texrir oo1lmtelu i;s0s2tr(mpoy4amt  fcslt  Duaumpno4tpen f3tls m uauvo;() ltoxr iytopt au sls) 2xo(r3ny1amtnlnvs s)arrau  nt1oleomo3iadlmDul( onu)trermf ootla elivsls0trtrxm3ny1ale liet s)srrax  ou1tpt  f3ild sDrmnmsnt)teermf3ta1lm eln i s texrxopno4ome mnvtas)sDtmurooo0tee iieiydlsDra( p;u4alxomocoydfmtr n i;(0 ruoxopoo4olenmnvi t)a2ra(ro;t4olenmfetatlm rmnvs u4altnif3tydlat livi;s)seuoimpno4lmee fvt s)s2rru ont0tet  f3tasfs2ulnmo u) rtoxoctydlm rli o t  rumxo3iudlpen ict tf 2trx ont1ope ifeils m rmn p u)tltrmf ty1fa r neo;s0teur(r nydale lnctas)srtrurpot1tpeo oeiadfa2um(mo t4texoxocoatfp  aneo;t s2uoio io1ame  ncsl(fs2taxm ot1apt ioeiatls rm(vs u)tleoxf iydoa ran sls  exr(rpoudlmt lfes ( aDtrur oo1apen ociytlsDul(vo;t4texrxf tatomt lu o t)srtrxm3ny1lptn iesat) 2ururpou0altnmfctysla2ra( ont4 exnmf tytoaDelueo;()t2xmxmpiu1am  lnei t srrmu onu0opx mieiad a2rmnvpnu0texomr3ty1opt li ilt) eur(opiudapte nctlt  2uauronu0aetnmiciltla rm(msn()trtrxr3ty1lm elivo;t0trto(mpiodlm elicta() rua(rooo4alxomfetldfmDua(msnt4altomf3tytomt auei s0 2tr(rpny1ll e ivilt) rua(rono4tpxo oeiysfm uanvp;(0aeeoif3iytfpD  uvi s)srxrio no4lm n ncsat s2rrxroot1oexomf3tadfs2el(vsnt4alxnxf3tytfm rlnei;( t2xmxo iudlpt licsat a2rau p;o4tptoiicild sDrlnvo (0 lxrio3ta1lmt li o t)t2umxr3iu1lmte nvilt a2umxmpot4ole mictyd sDuaums t0texnxf3tytfaDelueo t) eumio nodlpee nvt sfaDtru pou0apto f3iat aDemums;u)tlerio iytopD aivo s0trurim3iu4llenmnviat)a2rrx p;t4oltniieildfs umnmont)altoxfcia1fpDeauei;(0 rxmim nu1opt mfvt s)aDraxrono0aetnif3ilsfa2umu o u0artnio3oatfmtrai sl(0teurim3oy4lp  livsatfarum( ono1altnmoctyd sDelums (4 rtoir totomDe ieils texrirpiodam nmnesa( s2umxmpot1tetn octys m eau o;u0tlenmo tydop ean slt) rur(mpoudol e ictl() ruax ooo4tex mfeiat sDraumo;t0teenirctytlp eaueslt trxo(opnydalen fvtatf Drmu  ;u4ape mfetysfs ra( sn()arxrxo iadlpDrai o t  exo(m nodlp nmfvs sf rrr( pnu1tle  oetls sDeaumsnt) exoir3iatomDrau s;() eumio3no1lltnlfvs () 2rr(mo;u1tlx  ictlsfsDumu p t0artrmf3tatfpD lueil(  etmirpou4ll n net (fa2ta(ront4apxomf3tltfa rl( s;t)texoxr tadfpt  ieo;s0trurxopnydlm  mictatf 2tm(rp;u1ole iiciyt aDrlnvo (0 leoioctadopDeau i s t2tmxopiu1alenmivtls) 2tm(r nt0aetomi3tasfmDulumon()alxoxf3oodlmD anes;t0t2ur(m nodomtnmfvias)artmxr ;u1oex mi3iat mDelump (4trtriocty1fpDranei;t sexoio nydll n fcslt)srumx ooo1opxnmi3tadlsDuanvp;u0 rxoxfctydoa   uvi s0texrxo ny1apen ictltf rrm(mo;t0oetomocilt s2rmnvs u)trxrmo3oydla   i ols srxr(rpio4ap nmncs sfs2ta(ronu4tetnmo3tatla2raump ()trenmf oytlat luei t  rxr(m iy4op nlivilt) rrrxmpno4tptoiietyd mDrm( p;(4tlerxfciatomDr i o;() eum(o3oo4amtemicil(  Draurono4aexoiocilsfs em( pn(4aleoxfciatfaD  uvil( sexoir oo1alt  iet s)arra(roou1aptnmoeiyslsDulnms t) rerxfcoatfmDeauvslt srtmxopnu1oltn ietas  Drmx pnu0olt ii3tls aDum(mpnu4 renif3iy1oa  auei;()setmim3oy1ll  lietltf Drmxmp;o1oet mieild s2eanmp u0 lenxf3iy1oaD au s;t  2xr(m3io1ameelnctltf Dra(ront4tlx  f3ildfs2ean snt4aetoif3iydfpDrlieilt seumimpio4alenliet tf rrmxmpot0tlxn octlsls2ul( on(4 rtomrcoo1lp r ueo ()s2tmim3ny4amtnmietlt arurxrpnu0opt ii3iysls2el( s u) rxrxocio1op eluei ()s2xmxo iudam emivil(  rur(  ou1aeto i3tlt mDumu p t4 etoio oatoaDrai ils trxmio iu4altnmfvi () Drmxmpnu4apeoii3iasla2ean s u) rtomocoadlpDr n i;t)texrxm3iy4llt  iciatf 2urxm ou0oeeomiciaslm2umu p (0aetrmoctadlatr n sl(  exmio3nydal nmfvi s)artax o;o1oeeo feiydfm2rlnvp t)arerir3todfmD auei t)srtmxr3io1aleemneils  2tm(mo;u0tpt  oeiatlm2rlu s;() eenif3oatla ranvols0t2ur(r3ou4ol emfcsa() 2tm(m nt0aleniictldfaDemu s;t0aexrmfctydfmD ln i;() etoirpou4am n nct t srrauronu4oexnmoctat aDemnmsnt0 etoir iy1oaDranes t0 etmim oy4ap   nciltfsDur(mp;t0teeo i3ilsfmDua( s;u0texoir3todla   ueo;()s2toir oo4lpenlnvt () rra(mpnt1oleoifciytlaDrmuvsnt0 rxomr3oo1fa rluvs;()srtrxm3iodal nlivtltf Drauroou0olx  i3tys m2uau s;t)treoxf iadfatelivslt tetmxmpoudaptemicias)srta( p;u4aetniiciydlsDran o;u0teermrcoatlm ranvsls0 2umir3oo1al n ict sfarrmx p;o4tlxn oeiyd aDel( snt4tleoif iytlaD aieslt  ruoxm3nu4am e iesat)srraxr ot4tee miciatlmDel(mp;t4aleoio ta1omD auvol( texm(m3no1lp nliei t)aDtaxm ;u1texo f3iysfs eauvs;u0 exoxocoatom r nei;s0s2urim3oodlp n nvtasf rua(r no4tpxoiietadlmDeluvpnt4arxniocio1fpte i ilt0srtoxmpoydllt mnesls)aDtauro;t0aetoiieiydfa2rlnmo;t)arxnmfcia1fm  lnvols setrxopiodomt lnvias srurxrpno1aet miciydls ulnvsnu4 rtnxf3oa1faD liei;(0texrir3oy4openlfvt sfarrmumpou1tlx io3iasfsDea( ont0trxoxf io1fpDelnvo s0 2trxm3oodlmtelfeta(f Dtrum ou4apxn ictltfaDrmu s t0tetrxrciy1lmDrluvs (0 rum(opou1apt mivtls) Drr(  no4tleomo3tasla rmnvp t) reomf3io1oaDeliesl()t2xmio3ou4alen ncilt arurx o;o4oee io3iltfm2eluvon()trtnxo3iodfm   ivi (0t2xoim oy1ll e fcs (faDtmur ;o4olxnif3iyd sDumnmsn(4trerxo oo1faDraivs s)tetrxr oodlltnmici s sDraump;o4tpxnifeiydfs2um( p;u4tetomf3iatlpDr n s;s)s2trimpoodamenlfei s s2rmu  oo4tlt iictytlm2ea( o ()alxrxr iadlpDelu s ( tetrio nu1amtn fvsls)s2ur(r ot0tltnioetasfaDrmumo u)altnxrctatopt aieo;s)tetrir no1lme lncils a2rm(mpnu0tleomoetydla2elu p u0artomr3oy1fmtr ueo;s) rxmiopiydoleelicsat  rrmxrpot1aexn oeildfaDeauvp ()altnxr io1optrauvils  rxoxm iu1lptn ics s)s2rr( o;o0tpx iocilsfa el(vo;t0altomf3totoa e nes;s0 eto(mpiy4amt mfvias s2tax  oo0olxoioctadlm rmums;(4 exrmf iadlatr uei t)t2uoxr3iu1am  livtlsf rrmur oo4altomf3tas a2emn onu4tlxoxo3iodoaDrlnvsls  exoxm oy4llenlieilsfartr( pnu4opt mfcilsfa ea( p u0aleoio iy1oaDeaneo;t s2uoio oodaptnmnvil() Durxrpnt1oetniociysfa uaumpnt)aexomf iatfmteai olt)trtmir oy1amt mieil(faDrm(  ;t1tex mfcias a rlu p u0 ltrmoctotop  aivi (0 rtm(o3io1lmtemnvtas  Dtrur ou0oexoii3tldfsDrauvs;t0 lenir3todfpD  i i s t2xmxo3oo1lp e iesa(fa2rr(ro;o1opxnmf3tltlaDean o u4texnxr3iodoptran s;() 2trxopoy4al n fetasfarur( ono1oexo feils a2uauvs t0aexnmf tadfmDr n ols) 2ur(m3iu4lmt  nvtlt) rta( oou4aeenmfciatlm eauvs t0 rxomo3to1faDrlu il()srtrxrpio1ap nmiei (fsDrm( o;t4aetomoeiatfm2elump u4 exoiocoa1oaDe neol(0 2um(o3nu4llt lfctas) Dtmx oou1aetoiietyd sDuln s;(0altnmrcto1lm elu o;s srxo(o ou1ape lnetl(  2raur no1aexnioctytla umn pn(4 rtrif oadlpte nvil( setmio3iy4amee ies t) rtmxrp;t0aptnmociyd m rm( p u4 eenmrciydfa  auvi s  2xo(o3nu4ol n ict sf ruaxr nu1apx mi3ilsfa um(vo ()altnif iatlpte n i t seuo(r3oy4omen fvsls)artr(mo;t1apeomfeildfs eluvpnt0alxnxr tatopD liei ()srtoxrpoy4lp elfeiatfs2uaxmo;u4opxoifeiyt s emnmp;(0alerifciydfa  anei;t) ruoim3iodll n fvs ()sDumumpno0oex iociydls rm( s (4tetnxrctatla e nvilt0srur(m3iudlpee ivslsfs2ur(r ;t4tptnif3ils s2rlnvs t0treoif3todoatrln sl() rtmxopoo4lpeelnvsa( arra(r nu0aptoifcilsls eaumon(4aexnxr3iotfpDeauvs;(0srtr(rpoydalee fcsls)sDrmuro;t0ale mf3iytfa2uan s;(0tlxomf oa1fat au o;() 2xrio oudapte fvi tfsDtrxm nt4alxoiictlsfm2rm( p;t0trtnir oo1opteauvi;t)t2xr(m3iydopt lici sfsDuax pou4ope mfeiaslsDul(vs t4arxoir3tadlp   i o s0teumxrpoo4op nlnvi sf 2tau o;u4olxniociadfsDum( snu) eermf oy1lpt aieil( s2umxm iy1lpee neil(f Dta(  nu4oet if3ilsla uaums u0altrxrcoytlaDelnvo;t0 exo(m3ny4amtemfvil()s2umxm oo1oeeomfciytls emnmont4artnmfciadomDrlnvs s trtrir iu4op  lfvsat)sDrr(rpot4ope  fctatfa rau snu)teeoxr oa1lmtrlies;s texo(rpiy4lltnlnetatfs2umum no1tleomo3iyt aDumu snt0alenio iatfaDe i i t0 2ur(mpnudoltelictasf 2ur( ono1optniieiadla2uaumsnt)tltnxrcoadlmDraiei;s)texmxrpny4amt mfctasf 2um(mpno4apt mf3iytla2rm(ms;u4arxrio iy1fatrlu s t  2uoir nydameelfct ()sDta(mp;u1alx iictldfm2uau o u4 exomr3tadfmtraivs;() exoxo3no4olenlivs t arururont4alx moeilt s umu snu)trenxo iatfa ranvols0t2xmio no1aptelfcils) 2rmx  nt4teen o3ilsla rau on(4 rtrxfcoatlaDr n sl( t2umxopno4lp nlncils  2trxmpnt4aetniietls a rlnmpnt0 etnxocoytfpDelnei t)s2tmiopiodamen ivtltfa2rr(m no1aeenmociydfa ea( p (4artoxr3io1la rlu i;t)t2tr(opnu1am nlnesl( arur(r nt4oleomoeiltlm2ulnmo u)trxoxf oatopt aivo;()texr(m iudolt mnci t srurxr ;u4tee ii3tldlsDrlnmo t) rxrxr oadfa e ivo s sexmxmpoy1lm  miei (  rtaxmpot0aetoiieiltlm umnvonu0areoxf oodlp elueil(  euo(m3ou4ol nmfeiat)s2rr(mp;o1aeeoiocild a ra(mp (0 lerir io1oaDrlueo t0teuo(o3io4lltnlieil()srtrumpou4olxnif3iltfs2ea(mpnt4 eermocoadfm rln ils teuoxmpoydoltnmnvtl()a2raum ;o4tee iociltfm eau p u0 leoxocta1fmDeaivi;t texmio3no4am nlfvt ()a2rr(rpnt0oee io3tls sDuaumsnu0tlenif oatfa eaiei s  eumxm oo4lm emnctls)aDtaumono0ole  o3iyd m rl(msn(4arermf3oydoaD  u s (  euoxmpou4alt lnvtls a2tr(m ;t1tlx io3iat s2ea( o u)tleomf3oydom r nvo;(0srtmim oudalee iet s  2tru poo4oee iietyd mDranvpnt0tlenxr iydlm   u o;()texmxmpnu1op nlnvsl( aDta( o;o4aptnmieildfm2uanvs t4 rtnifciadop eli i;t tetmxo iodale lfes ()sDtr(  nt0opxoio3iad aDemumont)aetnmf3tatla r uvi t0trtmio oydal  lnei () 2ua( onu4tptomoctlslsDean sn()trtrxf iatlpD lieil( trurio3nudlptemnci ( sDrr(mp;t4oee ii3tltfm emn onu4tlxnio ia1fa e uesl(0 eumirpny1al  lictl()sDur(  ;o0tpxo i3iadfsDeluvpnu0tlenxfciy1lp rlivi;t seumxo3oo1lp nlfct sf 2uaur ot4ape  feils s2ea(mo;(0aeeoxr io1faDeai il()t2tmxo3nodop  mfci ( aDtm(moot4tpxoiietlslm2ul(mpnu0alenio tatomDrau il()seur(o3io1ap n fvilsfaDurx  ;u4alx  i3ilt sDrl( o () lxriociotlm r nvi;s) 2uo(opnudlptn icil( s2ururpot4opx mf3ils m2uluvs (4arxoio3oytfp   ueo;t0texmxopno4ll e fcsasf ruaxr no1olxnio3iys aDum( p;u)altomf3oydla elneo t teto(m no4aptnlnet (farrrx  nt0tleniociad m eaumo;u4 lxoxr3to1laDeaivi s)teurio3iu1amtnmfct s sDtmxmpnu4tex  oeiydlm2rauvs;u4teerxocia1lm e ivo ()srxm(mpnudlltemfeil()aDrr(ront0teeoiieils a2rm( s u0altrmo ta1omDr ieo;()truoio nu4aptn feilt a2ur(mp;u4olxnmiciyt aDumums (4 rxnmocoodoa r nvo (0 etm(m3ou4lmenmfcias aDtrxrpnt1optn ieiasfaDemu o u0altoif iydlateaivslt0 exm(o3oy1opee iet s) rtrumpno0tlxn o3ilt mDua(vo;()artoxr3oatlmte iei;() 2umxm nudale lfcias)aDtmuro;u0apxnifciys aDeluvo;t) renmrctadfptraivo;s) 2tmim nodopee ietatfa2ra( pot1tee mfeiltls2em( o (4aetomf3iatfm  ai ol()teum(opiu4lle lnvsl() 2tr(mpnu1aleomo3iat aDumuvont) ltomf tadlp raivs;( t2xo(o io4llen ivi t  rurxm ;t1optnii3tadfaDrm( s;u4aexrxf3oa1fm elnvs;s)trtoxr nu4oltn ivta()arrauront4aee ioctydfmDea(ms;u4aeeomrcoo1fpD  n i s0srtr(o oydol nlivi t sDtru  ;t1oeeo ociys a rau onu0 lxrmrciodlmt lu ols0s2tmxopoydomen nvil()aruau  nt4tlxniocils s2rl( sn(4 ltrir oodfm rai s;t s2tmirpnu4am nlfvt t) Dra(ront4alenmietltla rmuvp t) lenifciodomD  iei;t teto(m3nydomte icsat)s2umxrpnu1oetn ocilsfa rmnvs;t4 exoxr io1faD  uvsl()t2umir io1aptemfvsl(fsDurumonu0aeenifctlsfa2rlnmp;t)aexomo3iydlat auvi;s srtmxopio4lm nmics sfa2rmxm ot4ole mieiltfaDrmnvpnu)texrxrcoytoat ln il(0trxmim3oodop n fciatfs2rmu  oo0tlxo f3iys sDuau o t4treoxf3oydop ean sl(0s2tm(m3nydlptn fvtlt s2rm( pnt1teen feilsfs2ua( p;(4alxomr tadlmtraneols)trtoxopiy1olt livslt) Drm( ooo0alx ifciysfm2uau snt4 reoir3todop r i slt0 2tm(mpio4omee icia( arua(r nu1alxnioeiys sDua( sn(4trxrifcoatopDelivilt tetrxopio4al nlfcs s srraxmono0tpxoif3iatfa rlnvo;u0trtoxfcoy1late uvi;t0setr(m iu4opee fvs t)srum( p;u4ale  oetlslmDumnmsnu4 ltrir iy1fmt  nei ()setrxo nodoptn feil(  Dtaumo;u1olt  i3iys s rlnvp;u4tlerir oo1fpDrai s;s srtoxr3oydom emivsl(f Drauroou0alto ieiadfsDran s t4alenmrcty1om  li o;(0 exr(o io1lmt mnvslsfs2tax  ;u1tetomfetldla umnmp;u0aeerxocia1lpDr n s s sruoio oodlltelneilt)arraum nt0opx  oeiatfsDrmuvo;(0trenxr oodom r nvsls) euoxr3oy1omeemfcsls artax pnu4tlx io3tldfs ulnvo u4tltnxf iotlp  auvsl( texm(m3io4oleelivsltfsDraurpnt4altnmoetatlsDra( o;(4tltnirciodlmDeauei;t0teto(o oodap   iviat a2umxm ;u4tptoio3ilt mDrmu p;()aeerifciydlaDeanvs;t  rxr(rpoodllt lictat aDtmuro;u4ope  fctat s eaumsnt) rxnir oadom  luvo t0 2xmim iy4oleelics (  2tm(rp;t4aetoii3iytfm2ea( p t0tlxrioctadla eli o;s  2trxmpoydlpen nesa()s2tm(ro;u4oetnmfciaslsDea(vpnt4alxrxfcoytoaDrlivsls) rumxopoo1ome lfcsa(  2rrxmp;o0oltnioeilsfm2uaump ()aetrxr3iotoa rai s;s)s2triopiu4oltnliviat s2umxrp;o1optnmo3tatls2ran o () eeoxfctadfa   u sls  2ur(o nudomtn fvsl()srtmumpou1tlxoifciatfm2emuvsnu)tltoio3ty1lpt  i i s  rxo(mpnydole  fctlt)s2umumono1apx io3iyd a ua(vo t)alenmr oodfmDeauvo;s)t2trir3ny4ame lneil(  Drr(  ;u4alx  f3iytlm2eanmp u4 etnxfcoy1omt aivo ( srum(r3iydal   iesl(fartr(r oo0tet if3iytfmDean p;(4 eeomr ootfaDrlivo s0trtmxm oy4ol e nvta() rum( p;t4opt  ociysfmDrmuvonu4aetrxocty1omDrlues t sexo(opny4alenmnci s artmumpou1apt moctytlaDel(mp ()tetnmf3iadlpDelnei;t0 etm(opiu1aptn fvsas) rur(ronu1tle  fetas m2rm(vsnu4arxoxfciytlp rlivslt  rtrxm iydll  lfes tfarraxm oo1opx ioetasfs rlnvp;u4altrxf oodoat anvslt0s2xoirpoudaltnmnvias) 2umumoot1alxoifctat m um( sn(4 rtrxf3tydlpD lnvo;t)tetoxo oo1omenmfcia()srra(r nt4opt  fcild a el(ms (0trxnmfcoydoat  i s t) exr(o3no1am nlnctltfsrrru poo0tetnmi3tasfs2um(mpnu4teeomf3iy1opDraiei ()tetmim3io4lm emicsat sDra(rpot1teenioeiatfs ua(mont) lxnir oytopDe u o;t sexm(m3oy4llt lictlt srtru  ot1open octlsfs rln o t0 eerxf ty1opD luvs () rxoir3oy1lpenmfcil( sDtm(r ot1apx ioeildlm rl( o;t4trxnmfcia1lp  aieolt) 2tr(o iy1am   nci s)arrmu  nu0oeenmoeiasfsDranms (0 rtoxr oydlpt an o;( s2urxm3nodop e ivi ( srraumono4oexo i3tatlm2uanmont0alerio oy1lm rln s;t) 2xoio nu4olenlnetl() 2ta(m oo1oee  fetas m2el(vpnu) reoircto1fmDrlu o (  rumim nodllteliei ()s2rr(m ;t1tlenmiciat mDuluvp;(4arxomrcto1lpD luvols  2uoxo3iu1ap nmncsl( s2rr(m ;o1tltn feiydla2emumont)tltrircoodlaD ai o () euriopny1amee fctl()s2rmxmono1tpen ociytfm2eau s;u0 etoif3tatlp ranvolt)trtrxr ny1al e fvslt artau  ou4tpeo ociltfm2emnvo ()trerxr tadlptraieol( t2tmim iydame livta() Dua(mo;t0olxo i3ild mDulu s;t0 rtoxr todlpDe n o;(  eurxm iudlme lfciat  2urump;t0apxnmicias mDea(vo;u0trxrxfcoo1opDrlnvs;t t2urir3oy4opt lfctlt)arumu  ou1tpto oeiat aDemn pn(0 eerir iodop rli ol()seurim3ny1ol nlfeilt  Dtm( p;t4alxnmfeiasfm2umuvs;u0 lenmo3tatoate ivi s0 etmxr3no1lp  mfes ( sDur(mpnt4apeo feias a2ul(mp u0 eerxoctatfa  lueols)sexrim3oo1aleemics tf rrax  ;u4ole ifciydla rm( p () ltnxo iotlmDe i o s0 2xrir oy4aptemivsl(fs2ra(mpnu0tlx  fctasfs2eaumo;u)areoxocta1fat  uei;t0 2urxm iodlmeemietls)a2raxronu1teeo ociatla2elump;(0aeerxo iytlp  auvslt seurxopiu1lmen neta( sDtrx oot1tlxnmfciasfa2rmnmo t4 ltomfctatlp e n olt0srxoxm3io4lmtemics s  Durxrp;t0ape moeilslsDrauvp u4 rtrmoctodlatelnvslt)s2to(r3oodomenlfetlsf rtm( oot1oeenmoeiydfm ua( s;()trtoxrcia1oaD  i s;s0texrio nu4lltnmictatfaruaxrp;t1tpxomf3iydla2ra(vs;t)aetomrcoo1fm   nvilt) exmxo3no1ape  ivils  2rax ooo1tetnmf3iysfs2emn p;t)aeenio tytfmDelies s0t2umxr3oudomt mnctat)arrrur ;u0aexniocildfaDemuvs;u)trerxoctotoa rluvo t0 exoxm3nydllenlivsltf Dua( pou1altn o3iadlaDeauvp t0trtnmocio1lp eaivi s setm(opoo1openlicsa(f Dtmu pou1aleniiciatfa2emn s;u4tleoxrcoytom  ln sl( srurxm3no4ol e feta(f 2rax  oo0tex  o3iys m ulump;(4 rtrxf iy1lmtrli ils) exrim oo1olt mfvsas)sDtmu oot0teenmoeiatlm emnvs u4tlxrxfcoydoat aivilt)trtmxr iudopen ivsl(fsDrmum ou1altn octlt mDean o ()trenmf totfp   uvo;()t2tm(o3oo4aptnmfeils  rtrxroou1aetnmfeiydfm umu o;(4trtnmfcio1lmDrlivi;t0 rtrxo3iu4alenlicsasf Dua(ro;u0oltomociysfmDum(vpnu4tltrmf3io1oaDeauei s0t2tr(r3nu1ll  lfctl(faDtm(mono1tpxnmf3iyd sDrmuvs t)tlxomf iy1lpteanvi s  2to(o3oudopen ies s srrru p;u1aet ifeiltlm umu o t) ltrxr ootlat  ivs;s)sexoxr iu1ome  ivs (farrm(rpnu1aetn octydlm uln s;t0arxnmocio1lpD aueo;s)teur(o iydlp nmfct tfarum( pot0aetniietytfm rlumsnt)alenifciatlat anvols)sexrirpoodlltnlfcs tfaDum( pno4alxnii3tad mDrmn snu4altoirciydlaDr n i () rtoim3iudlle  ncs (f ruax o;u1alt  ociyd m ulu s;t4 lxnifcoadfmD lueslt) rxoxopnu4lmtn fcil() 2rmuroou0tex  feiltlm ulumsnt) ltrxrciydla  anvols0t2xm(rpny1amt lfet t)sDuaump;o4oeeomfcildfm2emuvo t4tetoxoctytlaDrluvo;t)setoim iydlp   ivsa(fsDuaxmpoo0opxniociytfa rl(mo;t0trtomfcoatlateanvil(0teto(m3iu4amen ictls sDtm(root1olxomf3iadfm eluvsnt4artrxr io1faD  u s s0sexmio3iy1om nmnvsls aDtmu pot4tpeo fciyt m ranmo t4aetrmf ia1lpt anei;( teur(r3iodlmtn ivs t s2tmurp;o0apeo iciydfm2ea(mon(4teermfcty1fm elu i;s)srxrimpny1omt  ivs (f 2rm(mont4optniociysfs em( o;() lxnxfciodomDe n o t0s2urxmpoo4lpe lfei tf 2umurpot0tpeomoetytls rlnvpnt4 lxnir3oydla ean i;t0trumim3oydome  ncslt)sDtaxrpno1aet io3iadfs el(vp u)artnxo totfaDraivolt tetoiopnydopte ics (fsrtrum ;u1apx  octatfs2ran o t0 rerir tatlptelnvi;s)t2xrxm nu1ap elnvsl()sDta( pnu4oexnmf3iaslmDumnvonu)aeeoif oo1omteanvo ( s2tmim oy1omt lneilsfs2rr(ro;u1tlen ociaslmDelnvp;t4teeoxr iydoa eluvi t0 2xmxm3no1ll e nvs t  Dtmumont4teenii3iadlm ua(mp;t0aeenmo3todfmDeaiesls)s2ur(rpiy1olt lfet t)sDurx pno0altnmoeiltla2um(mp;u) lerir oadoa  au olt)srxrio3oudopte fctls) rta(mpoo4tltnioctysla2rau s;t0tlxrir3oytfp r iesls  eumxm3ny1alenlicslt a2umxr oo4tleo o3iad s em( o;()arxrmr3iytfpteauvi;t0 rurxm nu1lltelnei t s2rmx p;t4ole mi3tld a2umnmpnt4tlxrxocoodoa  lnes (0setr(rpnu1oleemnvsat srtaump;o4apt ii3iydfa2rmnmo t4arerxrctatlmtelu i t seum(o3iu1lm emnvsa()sDur(rpno4alt ioeilsfsDuaumpnu0 exoxrctydfptrlivol()seur(opiudllte nvilsfaDtmx  ;o0aex mieiatlsDelnms;t0texoif3iytfa rlu ol( texoio3nudlm nmnvs t) rtaumoot4aexniictls m2umnms t0tetomfcto1opDrluesl(0texo(o oodlptemnvs t aDrmu ont0opx mfcildfm2elu p;(0 ltrmo3tytop rai i s t2toir3iy1ap emnet t s2rm(ro;u4altoiociad m umuvs (0texomo3ootlp  ai ilt0t2um(opiudlmt  ivtl()s2ururoou4tlt  feild aDea( o t)aetoir iodfa eai i;( trxrxr nu4am n ncsl(f rurx o;t4olt iictlt mDem(msn() rtnifcoy1fa eaneo;s  2xriopno1llt lfeiltfarrmxrpnt0aee ii3ild m ea( snt) eerif3iytoat  uvs s  euoxo3nu4openmiesa(farrr(rpnt0oexnmociadfa2em( o;u4tltrmr tydlm rluvo ()s2ur(mpnudlp  micsltfsDtmx ont1teeo fciasls ranvp;t)artomf iy1op  li o ()teum(o3no4apt lfetlsfs2raxmonu0tpe  octld s eau p;u4 etrmo3oadopDeaieo;() etmir3oo1amenmfesl(farta(r ;o4olxoiocildfm2umnvpnt0alerifcty1fmDraueo;t0t2umxm io1am nmfvslt sDrax o;u0altomfetysfmDemn o u4tleomo totla r u s s sexrxm oudaptn neslsfarrr(  ot4oeto oeiad aDran s;u4alxrio iytop ranvolt0s2toio3iudole  fvta(  Dtr(mo;u1texnifeils s2ul(vp u4altrxo3tatfmDranvo;t0t2trio3iu4ol  lnvtat srra(rp;o0ale  i3iltfm uln s t4areomr iytfat an s;()t2xoio3ny1lmeelnvsas)srtmxmono1oex mfetatfmDrau s;(4tleoxr iatlat  u o;( t2toxr3nu1lm emicta()sDtau  nu1aet mo3tls s rmnvp;(4texrmr3oodlmteaues s)texrxo iu1opt  ncs sf 2ta( o;o0tetnmf3ildlm uanvont0tetrxf oodlmt liei () 2trir iu1omtnliesltf Drmx  ;o4tptnmiciadla2um( p;u0 lxomo3iotopt auvi;t0seuoio3io1lptemneia(fa2trum ot0oee  iciltfa uan s;(0tltrxrciydoatranvi (0truo(r oo4altn fcsas arumur oo4aex  ocils a2uln o;u)altrxr tytla  an s;()seurir3iydlmt  iesls  2rm(mono0olx  f3iys s2ra(vsnt4aexnio3iatfpDr iei ()truo(r3oodlp e fvtatfs2taxr ot0teeoifetldfmDuanvp u0 ltrmf3io1fat luvo;t t2tmxmpiy4amt lncs sfarua(rpno4apto oeild a rlu o u4treoir iadom rln o;t)srtrxm3nu1ome mfvi t artmuronu4ape moetltla uanms;t0tetrir3ia1opt  nei t0srtoxr iudalenlici () Dtr(rpnu4olxniieiyd m um(vonu4arxnmociatfpDrlueols)s2umxr3no4opeelies s a2rrxmono0optn fcildfm2rl(mo u) rtnxrctadlm  anesl( s2tmiopnodomtnlivsatfs2uaxrp;t4oeeo fciadls ranvont0tlxrio3iydoaD  uvi;s)trxoir nodlpt lfvt () 2tmumpnt1oeeomi3iad mDrmuvp;(0 rxomf tatfmDranvsl(0 rtoxm3io1op  mfet (f rtrumpou0oexn oeiyt m rmu s;(0 rxnmo totoat lnei (0t2xmxm oodamt mivtas a2uaxr nu1opeoiiciat s eanmsnu)arxnmo3todoaDe i sls0t2tmimpoy1om   fci s) 2taxrp;o0tpeo ictadls rluvo t) leoxfcto1om   ieo ()srtm(rpiy4alee ivia( arum(  ;o1teenmicildfa2ea(vs u)arenif io1faD lieilt sexr(mpnu4ope livils) rumxr ou4tltomietltfa2em( o t4trxnmr oo1la eanvi s0 exrxo3ou4lp emiesl(  Dur(rpot1olx io3iadfm2ua(vs;t4aeeomocoatoatraivsl( srxoir3oo1al  mfct (f 2rm( ono1opt mfeils aDean o;() etoioctydfate ivsls0 rurxopno1ap e nes t sDur(m ot0tex mociytfa2rl(mp;t0 eeoxr3iodfmt livo;()t2trim oudlmenlivslt)sDtrx o;o0tpt  ictatlmDemums;u4 rxnmfctytopDeai o t0trxrimpny1optnmieias srraxrono0tpxomoeiadfsDel(mo u0altoiociatlat  ivi;(0setr(mpoy4lpenliet ( srrmump;o4olt  fcilsla2um(ms (0tlxoif oytfaDr uvs t)t2urxm no1llenmfeslsf Drrx  ;u1opt iocild m rlnmo;(0arxrmrctydlmD livilt  etr(opnydll  lnvias) 2ua( o;o4tltniicilslm ea(vp () rxomfciy1lm eluvols0s2uoiopoydamt lneias  rtm(ront0optnmfetls a el(vp;t)trerxr3tatoptrlueo;s trumir iu1lp elivtatf ruaxm ou4oex iociydla rl( ont4tltoxr oa1omDrlnvs;(0t2umxr iy1opt mnet tf rta(ro;o0tpxomfeiys s emnmp;u)alxoxr3iodlateauvi;s0trxrxopiu4alte fet (faDtrxro;o4tpxoioeilsls2rau pnu)arerxo3io1oaD livols0trxr(o no1lme lncia()a2trur ;u1opeomo3iltfsDelumo t) eenmfcoatomDrln ilt0 eur(mpnodolee nctlt)srta(mpno0teeo f3iatlm2emn o ()trxnxr iatfp rluvils)sexo(m nu1omte fcil(fs2rmu ooo1apeomociat m ua( p;() etrxo3oytomteai o;s0teto(m3oy1altnmneiat s2urx pnt0tltniiciadlaDua(mo (0aleoircoytoaDr i slt)t2umxrpny1al  livta( sDtru p;o4aptnmoeildlsDul( p t0arxrif3oydla eluvil()trxmxo3iudome lfcsa(f rta(rooo4apxo fctyd sDraumo u)trxoir oadfpD aieo s sexoxo oo4lpte ieslt) 2rr(m ou1aleomo3iasls el(mpn()arenmf ia1optelnvs;( trxm(m iodlpeemncs t)sruau  ou4tlxn o3iys m2rm( sn(0trxrxocty1lp r n sls s2xr(r nudlm emfvs s a2um(mp;u4tpe if3tat a2umnvp;u)texrifcoatlpD ln i;t0t2tmimpny1ame lfcsa()artau  nu0opxniocilsfm eaums t4 rxnxf iotoa eaneils0t2tmirpio1aptnmfctas) rta( oou4opxoio3iadls2elu p;t4tlenxr3iy1fmDr n ol()s2um(o ou1omt  ivtat artmxmonu4tltnmi3iad sDelu s (4alxrio oadfmte ivi t0 rxr(mpoo1opee icta()arrmu  ;o4openmi3tlt a2eau snu)tetnmo3oatla  li slt0s2xm(opoodam e nvtltfsDtmurono0tptnmf3tytlm ulnvs (4altoxo3tatlaDe i s;t  ruo(r3iu1lpenmfvtas aDumxm ;u0tpxnmfciltla2ra(vs ()areoxo iydomD ln sl( t2urxm oodaltnmncias) 2tru ono1tlen oetysla2ulnvo;t4 leoxr3tydoa eaueils0 2umxm3io1aleelivias srtr(root0apx mi3iltlaDrlums (4aeeomrctotlmtelueo (0teto(r ny4altn nvtasfaDrmur nt4oetnmociatlm2um(vsn() rxoxr iy1om e nvo s  etrxm3ou1omtnlfvi tfa2tr(mp;t0tee  f3iasfmDem(vo t) etrmfciotlm eli ol(  2uoirpou4lpe mivi s  rtm( p;u0ole mociatlaDrmnvp;t0alxrxr3to1om r nvs;(  2toio oydlm  licsls srur( ont4tlt  fetys a2rmn s ()tetoifciatoatrai s s t2xo(m3oudlleemfvt s) 2tr(r ;u0optoif3tydls2eauvs;u)tltnmrcoodfaDrln i;(0sruoir no4lmt  fct ( a2umurono4aptnmi3ias a2ea( p t)tltrxrciy1fpt li sl( s2umimpiy1ol emfcsl()s2uaxmo;t4aleomf3ias m raumo u4trxrxfciotomtrlu s t) rumirpio4amtelnvtas srtauro;o0openmoeiyd mDemuvo;u4 exrmf iydom   ivsls0trto(mpnu1amtemivsa( s2rm(rooo1tlt  f3iytfsDem(vp t)tetrio3ia1lpD auvo;(0trtmxo oo4lmenlivs ( arurum ot4olxn ietlslaDrmuvo;u)aeerifcoa1oat an i (  ruo(o3iu4lp emics (f 2raurpno4tpx micildfs rl(mo;(4artnxociydlaDeai s;s0srto(rpiy1op nlictlt sDrru pot0alt miciadlmDum(vpn(0tetoxo oodlaD ln sls0 ruo(mpny1llenlnvs t)srtr(rp;o0olxniocilt sDulnvonu0artnxr tytlm rln s (  exrir3oodapte ieil( s2umuro;t4tleomo3tytfs2uan p u)aeeoio todlateaieolt)s2to(o3ny1lmeeliciasfs2uaurpot0tpt mociyt sDumnvs u)treoxo ta1fa rauvol() exo(r ny4ol   nci tfa2rmum no0aeenmo3tysfmDumn s u)alxomrctotfp   ieo;( t2tmimpiu4omeelfciltfaDtau o;u4tlt iocildfa2rl( s u4 lxrio3oadopt  i i t) rxoimpio1lpte ivi sfarumumont0texo fctltfaDul( s () renmf3oo1fmD ai s s s2xmimpoy4ame mieilsfs2tmx onu1apxo ietldfm2rl( p;(0arxomf3ootlpte uvols) 2tmir3oy1lmenmfvsl( srtau  oo4teto ictas s2el( o;t0aexoir3oytlp r uvslt t2toxm3iu4lme lnes s) Duaxm nu4texomo3tadlaDrlnmo;u)tleoiocoatfm raieo (0 2urxm iudomtnlnvs s)srurxrooo1apxn i3ilsfm2ea(vo;(0artrmr totlaD  ivi;s0t2tmimpnu1lm  lieslt) rrr(mont4tet mfciytlmDelumon(0tltnmo3oadlaD au ol()s2xmxo no1lm elnvia()srta(rpoo4tpxo f3iadlm2em(monu) exomf tatop elnesls)t2tmim iu4lmt mnvslt)arrrumoot0oeeomfciysfm2umump t)alenif3iodlpDr neslt tetr(r3nudll n ictltf 2ua(m no0oex io3tldlmDua(vpn(0 ltrif3ty1omDeai s;s)texoir iu4lltnlncs (fsDtrxr ;t1tet  fctas aDum(mo (0 lxnxf3iydopDr nesl()t2xrxmpoy4olt  nvil()srrmx  no0aex mi3taslm2ua(vo;u)teerxr3oydlate ivo;t) 2tmio oo4omeelfvsatfs2rau p;t4tlxo oeiasfa2umuvo;() etoiocoadlp  livo t0trxr(opiydlpt lfeiat  rurxrpoo4aex mfciysfs2ua(vs ()teeoxf oydlmD  uesls)s2uoxo iydlmte fcs tfsrtm(m no0tee mfctad aDrm( o (0tetrxfctotfpDeli i;t s2um(r3iudlmtnmfvtltfarrmxmp;o0alx ifeias sDrmums t4 rxrxfcto1omtelivs s)teuo(opnydlpe mietltfaDraxmpoo4tlt mfetls m2rl(vp u4 lerxoctotlatraneo (  rtoimpoo4amen fctat a2ua(  ;o1olt  ociltla uluvsn(0tetoirciy1fate n s;t seurio3ou4om e fvt tfa2rauro;t4olx iiciasls2eanmo u0 etrir3tadopteanvs t0trxrio nudam nmfetltfartmurp;o0aexomf3tytfs rl( o;t)altoxo tatlm eau i;s)s2xrxm3oy4lm nlfes s) rraxr ;u1ole io3iad m rluvpn() renifctodfm r n i;()setoim iydomtemivia( sDumxrpot0aeeo ieils mDum(mpnt4tltnxf ootlmteaues t sexo(mpoo4ame  ncilt) Duru p;u0altoiictasfsDea(vont0trxoif3oa1fp eanvo (0truoirpno4aleelfciat aDra(r ;t4tlxoifetldfs2ea(mont4 lerif3ty1lpt ln o;s)trxoim3iy1lpee ictlt  Drmur ;t4oex mictydlm rlnvp;u4 ltrioctotfptrauvs ( texrir iodaptnlfctasfarrau  ot4ape  feiytfa2umu pnt4aetnxo3to1fm   ueils0 etrxm nudlleelnct t srtax oot0apx  i3tyslmDrl(vo;(0 lxrxocoydlpDr n o t sexoxo3iy1ope mfvi () 2tr(moou4openmf3iytfs el( s ()trerxr iydfateaivi;t0setm(r3nu4llte icia(farraxronu0tlxn fetydfa2ranvp;()artrir3ia1lat ai o t0setoxo iy1al elnctatfaDumuront4opto fciyd a uanvs u) etnxo3tydfmt  n i ()trtrio3nu4omt  fetlt) Drrx o;u0altn o3iadfsDulnvsn() rerxr3oadlm e i o;() rxoim3iy1lmenliesas) rur(root0olt iiciat a rm(vo;u0aeermfcoy1oat auvs;s)s2umxr3oo1al elfeia(  Dta(monu4oetniociysfa ran p;t0altomo3oy1fatelues;t t2uo(m3oo4op n nviasfs2urxro;t0apeomfcildla2ea(mo;(0 reriocoadlp r n o;t) rumio3ny4lpt mnctlt artr(moou0tlt  octydfs2umn sn(0 ltnxo3iytfptrlivs;s) exmiopiu4lmtnmiviat)sDrmxro;u1alxo ictltla2ulu pnu4aexoif3iytomD  i i () rxmio3iodom   ivtl() rtaxr ;u4tpto i3ild mDrau onu0tlxnioctodlpDr ues;t  eumxmpio1ap n nvils)sDurxmo;o1ole  o3iadfm rm(vp;t4texomo3todfmteli ol(0t2toxmpny1lle  ictatf Dumx  ;o4opxoioctytfa ua( o t)tlxomrcoo1fpte ivi;(  rto(o3iodom n fei t aDrr(mo;u4aex  iciasfa2umu s;(4tlerxr oodomt an s s)truoimpny4am nmfctatf Dtaumpot0oeenmiciydlsDemnmo;() ltomr3totlm  ai o;(0trtm(o3oo4lmen fei (fs2ra(rpoo0tpeomiciatfaDumu p t) lxomoctytfaDeluvo s)sexm(r3nodal  mfct s sDtr(mont0olxniieiltfm rmump u)tetrxrctatopD luvolt  rto(opoo1lmeemfvi sfsrua(r ;u0oeenmi3tldfa ulu o;u)trenmoctydoateluvi;(0t2toirpou4lp elfctasfa2rmxro;o0tleomfeiatfaDrl(vonu0 lxrircoy1fa  au olt) rtmxr iy4altnmiesls)s2rmxr ;u4tleomoctls m rm(vp;u0 ltoif iydfmD  n ol()trxoim nodoptnmicsl(  Dtaumont4tet ifctasfs2em(msn(4artnxf ta1opDelnei;t)srurimpiudape micil( s2um(mpnt1oleo i3iyd a rl(ms;u0 exoircoadfmD livolt seur(opio4aptemivsat  2tmurono1olxomf3iatfa ean s;t4 ltnmr3oo1fmt li ils)srxo(r nydlm  lnesatfaDua( poo0tee moetysfsDumnvonu0aexnifctatlaDelu s;t)s2xoxm3oo4lmte ivs t a2umxr ou1tltomf3ilsfm rm( on()tltnmf3oodom r nvi;s0 etoim ou1ale lietls)srtr(m nt1tle iieiatfsDulnvs (4 eenircoydfatranes;t)trxo(rpny4oltnmnetat a2rr(  no0tle  i3iltls um(mo;t4tlxnmf3tydlpt au s () rxr(o ou1olen fvil(f Dtaur nt0tpeoiieiltfsDrm(mo;u)trerxocty1lmD livils)trto(r3nu4ap emnci sfs2rruronu4alen oeilsfa emnmp t0trerxr tadlp   n ils)srtr(m ou1lmenlnvtlsfaDur(ro;o4tee  icilsfa el(ms;u4trtnmrcoadla ean o t srxmxrpiudamtelneta(farraumpot4oet ifeils a um(vo t0 rerif iodlpDrlnes;t  etrimpou1aleelics tfa2tmx pot4oet mf3iltlaDra(vo;u)tleoxo3oadlmDeai ils0trxmir iydap elncils  2tr( ono1alt ii3iyt m emn o t4tlxoxr3oa1opDeaivo s  euoxm iodape lieiatf Drmumonu4tle ioeiysfsDrauvs t0aetrxf3iotomD lu olt0t2xoxm oydaltemieslt s2tm(m oo0aleoifeias s um(vp u4tlxoif oodlm eli il(0 euoiopoo4amt mivia( sDtmu pno4opt mf3tysls rlnmp;t0trerircootlmtrluei;(  etoxo ny4am nlicilsf rtm( onu4aetomi3iadls eanvon(4 exrmo ia1laDelnesl()tetrxr no4amte neta()arum(r ot1aetnioctadfm2emuvo;u0aleoxfciotla eaivo;t0setmir iy4opt mfeilsfarumx  ou4opt  feiatfmDrlnmpn(0tltrif oa1fpDelueo;s s2toxm iu1lme mnesa(f Duauro;o1alenioctytfs2ulumo (4 lxnir oy1op elies ( s2ur(mpnu1op nlict tfsDtaum nt1alxo fctlsfa eanvs;t4 rerxr io1fmt  uvi t)sexrxo3oo1ap elivias) Dtmxmp;u4tptn octytlaDranvon(0teeoxr io1faDeauei t0s2xmxopno1aleemfcta()aDra( oou1ope  oeiadlm emu s;(0trerxrcty1oaD  iei;s  2umir nu4llte fcslt)arumx  ou1tee mi3iatfmDulnvo;(0artrmr3oy1op e n s;s  rto(r oy4al e nvia( a2umurp;t0tltoifeiyt mDem( s t4artoxocoodomDeli i;( seumxm3oy4op emfvtl()srrrurooo1opt io3tyt m2em(mpnt4 ltoio3totfa  anes;(0sruoimpno1lltelivtat sDuaxr ou4optnmoeiatfm2emumo u4aleoircootlate u o (0s2xmxopny4amenmietas aDtm(  ;t1oexoiocild a2umnvs t0 rermr3oo1op e u s;t) rxm(opou1llt  nvi ( sDrruroot4alxomf3tldfm2elu pnu0arxnxr tydopD lieil(0 etoirpiu1oltelneiatfsrrax ooo1opx ifciydlmDrmump;t) etnmr tydfa  ln il( t2uoxm3nudop   iviat a2ur(roou1openmi3tysla eau o (4aexrifcio1lmteaivi s)srto(rpio1lmte ncilt srrrur ;t4teenmfeiytfm emnvs (4aexrirciytlat  u s;s t2trxm oydapt mfvsa()srur(rpot4tet ioetasla rmnmo t)aexoir oo1lpDeaies;(  2xo(r oy1lpt mivsa(fa2rm(mp;o0tlxoifeildfmDrmu s;() lxomr iotla elueols) 2umirpny1llt liesls  Dtax p;o1aleo ietld s2rl(mo;u4 exnxocta1omD lieo;t t2xmirpno1op   ict (fsDtmxrpot4aeeo oeils s2elnvsn(4alxomr totoa eluvs ( s2xoirpou1llenmfvi t) rum(ro;o1tlxomoeiadfsDrl( p;t)texnio3tatomtranes s0srum(m3nudam emivsltf Dua(ront1aetoiicils aDemnmp;t) rermo3iotfpDeai olt0t2tm(o no1optnlietas)srumxmooo4tlxn i3iysfaDrlump t0tlerif3ty1lm  lieslt)tetr(r oudam emfcils srtr(mpnt1opt ifeiadfsDrauvp;()arxomo iytfpDelnvi;s)s2tmim iy1amtemfci s srum(m nt0opxnmfeiatfmDua(vs;u4 rxrxr3iy1fm rlueols)texoxr3nu4olt  nctlsfsrrrum ;t0tleomo3tlsfa2eanmpnu)teermoctotlpDeaieolt0 ruoxo3oy4lmt mfctlsfsDrmurpno4olt  fcilsla2rmnmp;u4 etomf tadoptrauei;t0tetoxo3nudom  mfeiat) rtrurpou0oee  fetyd m rm(vs;t0arxrxoctytfpDrauvsls setm(mpoodlmtnlicta(faruaurpot0alto feiatfm ulu s t0 rtnxf ty1optrai o ( s2tmio iy4al n ictl(fa2rr(rp;o1tpx ifeiat a emumpnu4alenxfcio1om  lues;s)s2toxr3io4op e nvt s) 2ta(r ;u0olt iietlsls2um(msnt0arxrio oodfpD aivo;t trur(rpiydapt lfctl( aDur(  ot4aexn f3tytla2umn pnt0 renxr oa1om  anvs;t)setoxopou4ome liviltfsDur(rp;t1aptnmfciadfmDrmnmont)aeerxr iytoat  u s;( tetoio3iu1am  livilsf rrax  ot0aet mieilsfs um( o;u0arerxo tytfpDr neilt) 2xm(r ou4aptelivsa(fa2urx poo4opx mocildfa em(ms ()trxrif3iytfpD lieo;t0trxmxr3iy1al   nvs s) Dtaumpno4tpxnioeild a rl( p u0trxrio3ta1fpDelu i t s2trxr3oo1om n ietlt sDrrxrpou1oleomi3ilslmDulu p;u4artnir todomtrlivsls srtrxmpoodol n nct ()arrmxr ;t4aleomoetldfm rmn pn()arenifcio1laD  n o;s  2xmir nu1lmenmnesa( a2urx o;u4aexniocildlsDrm( ont)artrxociytfa rlu i;(0 eum(r oo1lme lnvi t  Duru pot1tet mfciat mDrm(mpnu) rtnir3tydomt  ivo;s  rxmxopny4amenlfvt t)s2raxm nu4tltnioeiyd m2umumonu4 etomociytomDr n s;(0 rurio3nu1op nmict t)aDum( pnu1tpeo f3iltfa ul(mo t0 lerxo oo1fp  ln sl()texrxr iy1amtnmietas  rurur ot4tltniieilsfsDel(mo () exnmo3oytfm  liei;t setr(rpiu1openlfcta( srtaxr no1oeeomietysfs emuvp;u)treoir3ootom e ivo t)t2toim nydam  mnciat sDtrx pot1oee mieiyt s um(vsn()trenxr todomteaivs;t srxr(mpnu4lp nlfeslsfsDumxmo;o1oltnio3iatla2ua( s u4 lermr oo1la e i s;t)srxoxmpny4amenliei s a2raxmoou0ole miciydfa ul( o u4artrxfcoadlptelneo;(0sexmxmpiy1ll  lnei ( artmur no1tlenmo3tasfaDemn o u4tltoxocio1opDe ieslt setoio oodal  lfvtl( a2rax p;u4tee moeiydfm eanmo;()trtriociotfa eli i;()sexoimpny4am  mivi (f rumxm nu0oet mo3tadfa2rmuvon() rtomrcootopD an o s) rxmir3no1lm n fcias)s2rau  oo4aleo octysfm2umn o;(4 leoifciadlmtranei t  eum(m3oy4llee fci tfsrum(mp;o0oee io3ildlm2ean pnu4areoxfcoa1omD  uvi (0s2xo(m3iydam  mfcilt s2umxmooo0tetnioeils s eanvs;(0tltoxrciatlm ean i s  euo(r io1olee fvi (faDurxr ;o0tlx ioeiytla uau onu4trxnircoydfp  anesl(  ruo(r nydome  ici sfa2raxrono1olt iociasfa ulnvo;(4tlenmrciadfat  i s s)srum(o3iydapeelfeslt)arrr(m nu1aeeo o3iad m2ea( snt4trtrxf3tadopD  ieolt  rtrxo iudap e iet tfsDraur ot1apxo feiltfs ul(vs t0teerir3ta1lat ln i;s)trxm(o3iydapee fcilsfsrtau  nu4oexnmfetasla rau p u) exnxociatop eai o s) 2tmim ou1ole  nvt t) 2rru oou1aptn f3iytls em(mont4aetoxf tadoa rauvi t0sexmxo iu1op   iei sf 2ua( pno1alenmf3iatla2el(vo;(4aetnxoctatomtrai i s t2tmio io1openlfctls) rumxr no1oeen ietasfa eaums u)areoxfctytfmD li s s0srtr(m oodop elicslt srur(moot0aeeo o3iatls rmumont)tleomoctatopD  uvolt)seum(rpnodome liesat) ruaxm ot4ape io3iytls2eluvs t)altrmr iadfmtraueo s texoirpiodlm   fcs t a2tm(  no4tpen oeilt aDul(vpnu4 lxrxo3tydfmDr ies ()texoiopno4llt  ietltfsDtax  nt0opx  ietls sDrln o u)tlxrmr iytfa   u s () 2toio iydamte fvs (  rrrum nt4tlto i3iadfmDeanvo;t4 exnirciydlmD lueol( trxmxr io4ope mietl(fs2ra( ono0tpenii3ilt aDum( pn(0 lxnmfcoytlp rlnvo t s2tmimpny1aptnmivtas)aDtmxmo;u0teeo feilt m ea(vonu)trxnio tatoa elnvi (0seurio ou1ope  ncta(  ruaurpou0aetnioeildla rln pn(4alermo3ia1faD  ieo t0sexm(rpny1op  mfetl(f 2tru poo4opto oetadlsDrmu p;(0arxnxo oydfa ean ilt s2tr(opoo4al nliei ( arum(ro;o4alxoii3iat a2um(msnt0trtnifctodlmD auvi s  rtrim oy4amtnmieias) Durxrpno0aexnmf3tyd m2rlumo (0aexnxr io1fa elivo;t)srxrirpiudop elfetasfarra(mpoo4tpxo o3tltfa2ua( p ()teeoxo3tadfmtelnes;s)s2um(mpoo4ole  fviasfsDurxr ;u1oee  ociltlmDemn p u0alenmocoydla r ivs s0 2ur(r3ny4altn netlt  Duaxm nu1ope if3tytfmDra( s t) eeoxf tydlpt  ivi;()t2xoxopnodoltn nci sfsDtax  no0teen i3tyt a el(vp;u)trxoir3iadom  auvils t2trxopiy1ol elfvilt) rtm( pou0alxo fciat m2eau sn(0 exrxrcia1lmt aueslt0seurxm iodlmee iviat)a2ururo;t4alxomieils m2umnvs u) lxrio oadlatr nvs ( t2urxrpoydoltn ncs s srua(mo;t1opeoio3iatlm rmn o;u4treoifctodlpt lueol(  rxm(r3no4lpe mnctls  2tmu  ot4teeoioctatfm rmnvpn()tetoio3iydoaDelivo s) eurio io4lpe mivt t) 2umurpou0ale mo3iydlmDemuvp;t4aexoxr to1omDraivilt0 rurxr iu4lpt mfesa( srtaurpou1teeo feiys a emumo () etnxr3tydfaD  i i t) 2toxm3no1opt mietlsfs2uax pno4tet  f3tldlm2elu p (0 eenxo totlaDeaieols)seurxm3iudlm nlnvi t) 2ta(r nu0oltn i3ild sDemuvonu0trxnmrcio1fm elu i;(0 ruoxmpnydom   nes sfa2rm( p;u1tlxnmfetltfs emn s t4texoxfciotlp   uei (0tetr(rpoydol emiesl( s2urx p;u1altn o3iatfm elu p;u)tlxrmfcoydop e uvsl( teto(r oy4apen ivt s  2ta(moou0tlxomi3tat m rau onu4 rxoxf oydlm eaies t0 rur(o nu1optemncia(  Durxro;u0tlx  oeilsfm ea(vpnu)texrxf3oytfmD aneolt) 2toxopno4omtnlnciatf 2rr(r no4alt if3ilsls2emums;u)arenxocoytfat luvo;s) 2um(mpiudole livi sfsrtrurp;u0tpx  iciatfs2em(ms;u) rerir oydomt aues s0srurxr3nu4lpe  nei ()aruau  ;o0tle  fcilsfs rmnmo;t0arxrxo3oatfpDr nvs t0srxmiopou4llenlicils  2umxmont0apx if3iadlm ea(vo;u0tleoir oy1fatraivs;( srtmxr iudomt lfvs sfsrrrur ;u1tlto o3iadlm ran p u0arxoxf3oadfm ean s;()t2um(o oodaleelivs ()a2tr(m ou0tlt  f3iytfsDumu on()alxnmf3iytlp elueo;t s2ur(mpno1apenlfvsl( sDurx  nt0tlto ietaslaDel(vs (4 ltoir tydfaDelnvo;t)srxrxr3oodlm nlfeiat sDum(  no1oee mictysfmDrmnvp;u)altoio iydfpte uesls0 exoxr io1oleelnvtasfsDraxm ot0teenmoctyt m2eanvp u4 ltoxfcta1fmDe nvi;( srxoxr3iodom elfvtl(farta(ro;u1tpt if3tas s rlnvp u4artnxr3oytfaDeliei;t0 rumxo3ny4ap nlncsl(fs2uaxmp;o1alt iieiytla rau o (4aeeomf3oo1faDeaneil(0s2to(o3ny4ome lfvtls  rumxroou4opxn oeild a eaums;()tleoxo3oatfate ueol() rtmir3ny4llt lfcil()srra(mpou0oetomoeilsfm rmuvs;(4artrmrciotfpD  uei s0 rxoiopoydalenmfesatfs2rmumoot4tlt  ociatlsDem(vo (4aexoio oatfa  aivs;t s2xoxr3nu1optnmfci s a2umum ;u4ape iictat m raumpnu)tleoircoydoateanei t tetoio3nu4apte fci tfaDraxmooo4tpen i3tadls2uanmont4arermr3ia1fpDeauei;t) eto(m no4aptelivil(fs2ur(r no0ole  i3tytfs2ea(mont0tltnmrciotlpDeluvo;t)s2xr(o3iydapt mnvs ( artru o;u4aee mociaslmDra( o u)tleoifcoodlm ran s;(0 rtoir oodopee nvt ()aDumur ;t4oeenmietyd sDumu o;(0trxoiociytfpDrauvi t seto(mpoudlpenlivtlsfaDum( p;o4aex miciys m2uan s t0 eeniocio1oaDrau slt)s2umxopiu4lp  mneslsfa2rau oou1ope iicils s emumo (4 etnif3totlmD auesl(0 rtmxm3no1lle mncias arta(moot4oeto fcilsfs rlu ont0 rtrxfcio1fp rln ils srtrim nu1opte ietas srrrur no4tptomfeilt s2ua(vpnu)trxrif3oadfm   nei;s trtm(mpiudomee ictas artmur nt4apxnifeild m2ul( pnu0 rxrio tytomtranvi;s0tetr(m3iu1lmtn iesat) Dua(mont1teto oeilt a2umu o u4areoxrctotfmtr ues t0 2tr(opnudlp elfcia()s2umu oou4olxomi3iltls umnms;t4 ltniociotfat ln ilt)trtr(r3ny4lp emfvil(f 2trurpno1aptoiicild aDem(vp t)tlxrif3tatlmDrlues;() rurxo iodoltn nctat a2uauronu4opxnii3tadfm el( p u4texnxocta1laDelnei t srxoxr oo4ale lnctl(f rur(r ot1tpt if3iatfa rmumpn(0 rtomr oydlpDelivo;t)s2tmxrpnodapte nvi s arrru  nt0alt miciadlm el(vp (0 etrxocoatfatr nvi ( t2tr(r3oydlm e nvt t aDra(  ou1aexnmiciadfsDrauvo t) renifciadlaDeluvs s)s2xrxmpnydal   nes (fa2urumoou1tlx  i3tad a raums;(0 lermrcoatoaDelneo;(0 2xmxr oodap  mfesat) 2tr(r oo1tptnmfetltlsDran p t4trtoxoctydoaDrlivs;() 2urxr3ny4ol  lnctas) rtrxmont0alt ioeiydfsDumu onu0artnxo ootlmtranes ()s2xrir oy1altnlivsltfs2uau o;t4opeomo3tas sDuan pnt0trxomf ia1fat auvslt)sexrxm iydamenmfvt s) 2trx  nu0tpenmietaslmDum( p;t) lxrmrcoy1lpDe ues;()srto(o3nodlptemfvt t  rta(mpnt0tltoiiciltfa eau s;u0aetnmr3iodfpD lu il(  rtmxo iy1llt lncsas srtr( p;t4oet moetlsla2umnms;u0aetrircoy1lpD  n ilt trtmio3ny4ale  fvt tf Dumu o;t0aee mf3iatls2ulnmo;t4 rxnif oy1om eluvo;()t2xmxr no4ap nmfet sf 2tmum nt1tlt mictasfa2eanvo;(0 eeoir tydomtrlivs;s0trxrimpoo1aleemfei tfaDum(r ot4aetn o3tls m2rl( p;u0 renxf3ia1lpDe nei t0trumxo nodllt  ict t a2rmump;t4oexomoeiytla2emnmsnt0 exrmo oatfpD  i ilt) ruo(m3oy4lp nmfesltfsDuaxrpot1oetoifeiadfm ran o (0trtoxr tadoa  lies s0trxr(rpno1om n neiasf Dum( ooo0olxnii3iys a umnvp;u4aetrio ta1oaD  n s (0teurxo3iudameelfesa(fartr(moot4tpenmfeildfsDumn sn()aexrxf ia1oate i i;( srtr(mpio1ll elieias)aDtr(mpoo1opto o3iysls rlu onu0 etomo3iytfp r nvs (0 2umirpnydopte ivt t sDurxm ;u1opxniiciydlm2eauvpn(4aleomf3iatomDeli i s)srxr(m io4lm nlicils)sDrr(r nt1texn f3ild s uanvon(4 rxnifcta1fpDr uvs;t t2xrio oodol n nvs t  rra(m ;u1apxn f3ildlsDrm(msnt0altomo iytla rluei t0srtmirpiudlp nmfvtas sDra( o;o0opxomieiysfm2ea(vsn(4tlxrmrcoytlmteauei ( srur(m iydoleemncs (fsDrmu oot1aeeoif3tad aDranvont0trtnifcoa1oat auesls)sruoxrpnydapenmfvtl(fsDrmu pno1aex  o3iat s2ul(vo;t4tleomr3tydlp eauvs;( s2xmio3io1lpe mnvils  2ur( poo1oltnmociltlmDulu o (0 exoir oodfmD anvi ( trurirpny1apt lnvtl() 2tr(m ;o0alx mo3iyd sDemuvs;u)tetoxf3iodfmtrlneo;(0s2uoxrpio1aleemfcils) 2ta(  oo0oet io3tltfaDeanmpn()trxoxo to1fm ranvolt0 etm(m3oo1ap   feiat) Dtmxm no1tex ii3ilsfmDum(vo;u)tlxnmf iydlmteaies t srxmxo nu1llenlnesls s2urumonu1aeenio3ild m2emnvs;t4texnifcoytfmD aneol()trtmirpiu1lmenmfesatfs2rmum ;o1oetn ocildfs eanvp t0aleoxrcoydfptr iei (0 euoir3iu1lpe  ncsls)a2ua(rpoo1opto ocilt m2umu p;t)aexrmfctodfp r uvolt0srurxopio4am   fvta(fsrra(mo;o0oex mfetasfmDumuvp u0 ltoirciatlaDranvi s trtr(r iy1omtnlnct sfs2rmurpno0tpxniietydfmDea( sn(0arxoxf3to1laD anvilt0truoiopiu4olt  fes t srumu o;u4tltniictysfm2ulu p;u) rxrxfciy1oaDrlivi;t) 2uoiopiydlm  mnesas)srrmx poo0aeeomoeiasls umnvo;()tlenmfciatoa  aueils)sexm(m oodome livilt srrrxr no0teeo iciltlaDeluvo;u4teeoif3oy1fmDeli ol( trtoirpiodam n nes s  Dra(rp;t1opxo i3iaslm emu o;t0alenxr todfpt lnvs t  eumxo3iodlm   fesl()a2um(moot4tlx iieilslaDeaumsnu4 reoxf3oa1opt ai s;t0sexm(mpiu1llenmicsa(f 2rr( p;o0apxniociltfm ua(vp;() etoxocootfpD lnvol(0s2tmxr3oy4llt lfvi t  Drmxrooo1tet if3iasfs rm(vp t4artoif3ty1oateaivo;t)t2trir3nudal e ieias)aruau pou1tee  o3tltfa emnmpnu0 rtrir3iatlmDrln ilt)s2xo(rpiu4amtelnvsls)arta(m nt4apenmiciyt s2rlnvo ()alxoxfcoa1lptrlnvi t)srtrxm iodamen nvtl(  rrm(r no0tetnmoetad s2rlu o t4areoxo iydfpDeau o s)trumxm3iodolt mncilsf Drmuront1aet mo3tldfs umnvs;t) ltomf tatlm  lu ols) 2uoxr nu1lltelncil(faDtmx p;t0aleniociyt aDrmuvs;u) rermrciotoptr ieo ( s2xmiopiudaltnlfvi () Drm(roou1tpe mociyslm2eauvo u4 rxoxr3oo1oa r uvilt)texo(r no4ol e iei sfa2rrx ont4tpxn oeildlmDrlnvp;u4 exnmf3iytlm rlnes () rurir iudaleemnvs (fs2raumpnu1alt if3iys m ul( p;u) eenmr tadoat lues;s  exrxopoo1amtelfvils arra(r ;o0opx  ociys sDulu pn(4trenxo tadoaDr ies;s0t2trxm3oo4omtnmncta( aDrm(  ou1alen fetlsfm rl( pnt0 exrmf3oy1omt lu s;t0t2toiopny4ll nlictls) 2rmxmpou4aeto ocils aDelnvs u4trxrifctatlmDrlivs;(0tetmio3iy1amt  ictl() rta(r no1aex moetas a2em( onu0tltniocia1fptraies ( t2xr(opnu1ome lfetat)sDta(mono1oeeomfciadlm ra(vs;(4teenmrciotoptean o;(0srtrxr no4ome  ictl(faDrrxront0oexniicilslsDuau pn(0arenmf iodop elu s;t)s2toir3iu4lptemieta( arrr(mo;t1teenii3iasfs2rm( pn(0arxoio tatom ran s;(0texoirpoo1amte feilt)sDtaxroou1tpx mf3taslm2el(vp;(0texrmo todlpDraiei;s)sexrxo oodomeemncsa()arum(mo;u4olt mocias s2rmnvo () rtoif3tytopDr ivslt teum(mpno1optn ivt t  Dtrur oo0apxoifetadlmDra(mp t4 eermf iodlmD  nvolt)s2uoxr iu4omt  ieiat  2rmxrpno1aexn o3iydfs umnms t0tlxrio iotfmteaues;(0s2toim3oo4altelfcsl(f 2tmxr ou0optnifeiydfs2rmu o (0 etoifciadfptr u s;(0 exrxr oy4omeemncias aruaurpot4aet  f3iltlm rlnmo;t4 lxrxf ta1fmteanvo;t0 rto(o3ou1alenlfvtl() 2urump;o1altomfctldfs2rl(monu4 eenxo3tytfa elneslt)srurxmpnu1ap elfvt ()s2ur(m ;u1tpenmiciasfmDemuvont4arerxo3oo1omDelueo;s setr(o ou4ll nlnviat srtrum ou4olenmiciyt m2rm( s;t)areoxr3oy1lmt livil()trxm(m3ou1ll n nctls) rtmu  nt1aptn i3iyslm elu snt)trtoioctydfmt  n o s0tetoir nu4opt licta(f rrr(m nt0tlx mfetldfmDrl(mpn(4 lenmrcoydlp raneils0s2xmxm3nu1lmte nvs tfsDum(m ou1tpxomfctls aDeau snt)alerxr3ty1opDr i i;t  2ur(m3iudllee netl( aDraxr ;u4aptnif3ildlm2rlu s;u0 eermocoydfatr uvs (0tetrxrpoodlp nmiviatfa2rmu pou4altn i3tlsla eaumo;(0 etoircoydlaDraies;t truoim oy4ome mnvtl()s2tmum ;u0apx ioctytlm uauvo;u0 etrmf3iotlateln sls0 2xrio oy1amtelfvs tf rtr(m ;u4apeoifciadlm ul(vsnu0alxrxfcty1lmteaivs;(0s2tmxo oo4lle mfctlt aDtaxro;u1altomoctydfa eln pn(0arenxrctatlp  luvs;t  exrxo oo4lmte icil(fa2umxr ;o1tpeoio3ils mDeluvp (4tlxnxo3oy1lpt livol( t2tmxm iudop elneiltf rta( poo4tlto oetltfsDumnms;t)arxomf3todom rln i ( s2ur(o3oo1ll e icsat artmxmpoo1apt ii3iys m2ra(vpnu4artrmr3iodfmDrau i (  eto(m3oo4optemnct t) rraxront4opt  f3ilt m em(mp;u4 exnmfciadfa  an ils) exm(o iy1alt  feil(fa2urxr no4aetnii3iysla emnvo;u4aeeomr todoaD an sls0trumxo nu1olenmfvtltf 2umuro;t1alx  i3ild m umnvpnt4 
\ No newline at end of file
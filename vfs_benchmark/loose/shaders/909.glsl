@@ -0,0 +1 @@
+nvi (0sexmxm oudoptnlfetls)artmur ot0oee iietat mDelnmont0teermr3oa1fat  nvil(  euo(o3oodaptelnesas) Drru o;u0apto i3ildls2ulnmo;t4trtomr3totopDe uvi (0 etmxopno1ll  lfcta()arrrx  no0aexnif3iltlsDelumsn(0 exoif tadom  lnvo;(  rxoxopoydame lnvsls srumxrpou1teenmfeiytls umnms;()tlerir oa1oat  ueilt0seumim3iy1ameelfvtas)arumxr ou1tpeoifctysfsDraump u)trxomocta1faD  nvsls t2uoxo3io4ale lfcs ()sDra(mo;t1ale  fetadlm2ra(mp u4altnxo tytlaDe ieo () rtmxm3iodopen ictat)a2tmxro;t1tpeomietysfa2rau o;() leoif3to1laDr u o t)t2urim3nodoleelfvsas a2rrurp;t4aeenmi3iat m2ra( o t)artomf3tytomte nvolt srurxm nudameelietl()sDrru  ;t1tptomieiasfm eln o t4 ltnmrciotoaDeluvslt) euoir nu4oltelieslsfsrum(  ;t0aeeo ocild m2elnvp t4aexomo3oytfpte ues ()trtm(r iydlp nmicta( srra(ro;u0alxnii3iyslsDem(vp;() exnio ia1oaD auvsl(  rxm(rpny1opeemnvi (fsrrrx ono4tetn o3ias a2eln p ()tlxrir oatlaDraivi;t0trtoirpiy1alenlieia( arrm(mpoo1oetnmi3tadfm rmuvo;u) etrmf3oytfmtraiei s trtrir3oy1lpee fct (fa2tmxmpno4olt mf3ildla umu s;u0 exomfcty1lmD ln o t trtmxm nu1op  mivsls) 2tm(rpoo4tee ifetltls2ulnmo;(0 lxnio3oodfaD lueils trum(opoydal nmnvt t) rrmx pou4opxomo3iad m2elu p u4tlxrmfciodoa   nes;s)srtoiopou4am   nvi t) rrm(m nt4aetomoetlt s emnmsnu0alxrmocto1fptran i;s)teur(o ny1optnliesas)artrumono0ale moetys s2eln p (0texoif3tytfa  an i (0trtr(rpiy4lptnlivi () Duaxmoou0altomf3iltfm2el( onu) exnxo oydoate nei;t)setmxmpnu4lmt lnet s)artrxr ou4oeenmo3iasfa2el( snu0tltoxf3ty1om  auvols0 rxm(opiydap nlfvia(fsrrrx  no1aeto fctytfa2rl(ms u0 rxoircoa1lm ean s;(  ruoiopiy4omee nes t) rurumoot4oeenmictydlaDrm(mp (4 rtnxf ty1omt aues;(0 2xrxopio1lpe mfcs ()s2uau  nu1tltomo3iydlm2ul( pn()tltomocia1lp  ln i ( teto(rpiydomte netlt) Dur(r nt0aetn oetadls ul(vp t4teenxf3tytla   uvi s  ruo(mpiy1ll emfcsat)s2tauro;u4alxnmfeiadlsDuln o;(0 etrxf3iotfm  anvo;() 2uo(mpoo1lmt livi ( artru pno0aeeniictadlmDuauvp;t4alxnxfciadlmt li i;( trto(o ou1op nmnvtl()sDrm(m nu0tpxoifctat mDrmump t)trenxo3iydfpDr i slt)s2tm(r oo4op n ivs (fa2tm( oot0tlxo fciad s um( s (4 lxrmrctodfatrlivi s0trurimpoy4ap e fvtl(farrrx pno1alenmoeildfa2em( pnu)aexrxf tatlpD aueo t0sexr(o3no1amen iet ( aDua( oou1tpt ifeiadls elu s t)alenmr3ootlmDrln ols  eum(m3iydlltemfeiatf Dua(  oo4olxomfciatfs ul( p () renmo3ia1fateln i s0tetoxr3nudlmen fei ( a2uax  ot1tptoioetaslm2emnvp u4 lenio oa1oa   ivs;t0setoim3nu1om elfctltfaDtaurpnu0alenmo3tatla um(mo t)alxnmo3oadlpt aies t0s2trxopoodll nmics s)aDrmu pnu4oleniociltls2uanmp;(4 eenmf ootfa eaueo t s2xmimpnu4ll n neta(f Dtau onu0tpxnifeiasfm2umn p t)arerio3todlpt an o;s t2trirpnu1lp  mfvsa()a2rrxmooo0tptnif3ildlsDrl( s t4trxnxrcty1lp r ivsls)t2xo(r iy4apte ieils)s2umx p;u1oee mfciltfs2rln o;(4texoxoctydoat au i s  etr(m3iydom  lfct tf rtm(root0openif3iadfa2em( pn()tltoxf tytfa eanvslt  2xrxr oo4amenlnvi s a2tm(m nu1aetoioctatls rmu snu0artoifcoydfm eanvsl(  rtoirpiy4llt lietls  Drr(rpnu1tpe iociyt m2ra( o (4arxomo3ia1opt aies;t trxo(m oudape mnviltfa2rrxroou4aptoiiciyt m2uan p;t)alxomrctotopte n s ( s2to(mpny4om emiei ()a2um(mpnt4aleo icilt m2el(vpnt4teenmfctatoa raies t)t2xoxm3iy1lm n nei () Duax  ot1aexn i3iasfa2uanvs u)arenmo3ia1fm  ai s;t0t2urxrpiy4amenlneslt)srtrxm ;u4oex  octaslm umnvo;u4alermf todfa  lnvs s)srxm(mpnodoptemnvsa(  2urum ;o4tlx if3iat s2emump ()alxrmo oodomDelueil( t2uoim3ou4lpe miesls)aDuaxr nu4aex mi3ildfaDuluvp (4 ltrmocoydfpDeln o s)t2toxr oy4olteliesa( s2uax p;u4aptnmf3iatlm emuvp (4 reoxoctatlmt lnvo;t  2tmio iu1ap elncs t arta(rono0aptoifciad aDrau p t0alenir oy1oatranvo t0 rumir iu1am elfcsltf 2rrxmo;o4opx iocilsfsDum(mp u0 reoxrciatfp r i sls tetmxr3oy4om emfviasfs2ua(r ou4optomfeildlsDeauvpnu4 ltoif3oatlp r ues;s0srurxmpoy4lmtn ietlt  Dtax p;o4tetoifetat s ua(msnu4trxnxrctadlmtraivs;s0 2xmxrpoudape lfetatf Dtr(root4oleo f3iatla2ul(mp (0altrxfcia1faDeli o t0 rxmio3nydoleelieilt sDtauronu4apxoiietad m ulums u)altomf3tatfmt aieo s0srxoxr3iu1omtelicsa(farrrurpno4optnifeiatlm rauvp t) eerxf oy1fpt aueo t0 2uo(m3io1olee nvtl() 2rrxmont1tltnio3tasfm2ul(vsnu4 exnmoctatopD  nes (0trtoxr3io1ol elnei s)arua( o;o4tltn ieild mDel(msnu4 ltrxfciytlm  ai i;t)t2toiopio4ll e nesa()sDtrum ou1tetn fcilsfa um(vp;u)tltniocoydfpt lies s s2xrimpiy1altelnesl( s2rrumpot4tlx  ieiyd aDranmsnt4artoxo ty1faD  u i s)trtrxmpiudoltn icsatfarum(rp;t4alxomieiydlm2rl( o u4aeerxf tydfp  anei t s2ur(rpoudop elivs t  2trur oo1altn f3iyd a rmnms;u4 lxrxfciotlmD auvs;s0 2xr(mpnu4lmeemict t)s2trx p;u1tpe  oeiysfsDumu s u0 etnircoo1fm  lnes;s0t2xmimpio4ope mnvsls)srtm( oou1texo f3ilslsDumnms;(0trxrxo ia1lmDean s;t  etoxr3no4amtelfeslsf Drrumonu4aleoii3tltlmDulnmpnt)artrmf3oydlp eli sl(0t2umirpoodal e ics ()aDtrumo;u0ole  o3tysla2rau snt)tetnif oy1fmt lnvo t s2trxrpnu4amt  nviat  2rau poo0olen oeiadlm2el(mpnt)arenxo oa1lat li i s)teumxopno1olen nvsl( srrrx  nu4opxn i3tlsla rl( ont4 lenmf3oadlmteluvils trtmxmpoy4ap n ics s)srtmxroot4open ieiasfa elums t0tltomf3ootfateaneol()s2tm(mpnydlp  mnci sf rrr(mp;u1aetnmfetat aDrauvo;() lenmf3ootfm eln i;(  rxrxmpoodll nlicsasfa2rrxm ;o4tlt mf3iydfm2raumo;t)trtnmo3iotfmtrlnvsls) 2tmio oydlp nmfvt t sDtmxm ou0tpto o3iytlsDumnmp;u4 rxoir3oo1fm r n ols trxoxr nydam emfetlt)srrmx poo0tleoiictyd s2um(vo t) eenmo oytoatrluvs;(0 rtriopoo1ome mivtl(  Dumxmp;o4tlxomfeilsfmDrlumsn(4aeenxf iydfa  ai o;s0t2uoim nudllee iviatfarra(mo;t0opxo ieildfm el(msnu)arxomrcoa1fmt an s;s0 rtm(rpoodlmtemfetlt)sDtmumpnu4tpx  feildls eanmo u)tltnmo3tydfa r ivo;t0setmim3ou1llee neils)s2trumoou4olt  ociad a umn o;(4aleomocoa1faD li i s  etrir iu1ap  lfci s) 2tmuro;u1alt mi3tytlm raumont4trtrmr todfm rluei;s0s2xrxrpiudap  lfesl(farra(  ;o4ale ifctad m eau pn(0tlxoio totfptr uvs;s)texmir ou4lpt mnviat a2raxm no1olenmoctad a2emn o;(0texomo3iodlaDe nvo ()srurxopiu1lpe mici (faDuaurpou1olen fetltfaDeanvo t4arermf3ta1omt ln ols0 2toxo iudap  lfvtl() rum( p;o4tlx mfciatlaDem(vp;(4 ltrxrctydfa   ues s)t2xmxrpiudap  livsas) Dua(  nu1opx  i3iasfsDrmn o t4trtnmoctotfaDeau o;s)tetmir3nu4ome mfes ( srrr(rono4tpxn i3iyd aDua(vo t0 eerxocoytlmDeli o;( teur(o3iu4lp  micilt sDra(m ;o4olt ioeiatls emnvp;u4 exrifciadopt  neils0srxrim iudopeelnviltf 2umum oo4oetoii3tlsfaDem(vp;u)altoif tytopD an ols) rxo(r3io4olenlfeias sDua(m no4tlto f3tas m elnmp u4trxniocoy1om e i s t)s2uoim iy4ll   nci tfsrtrur no1olxoifciyd sDumn p;u4 rxnxf iotomt lu i;(0sexoio3oodlpe  fvsls  Drrur ou1olxnifcilsfs elnvpn(0 etnir3tydlmteai i;( texm(m oy4lltnlnvi (fsrrr(m ot4opxoio3iatfs2ulnmo t0 ltoif3iydfp e neils t2uoio oy1llen feilt s2tmxmonu4oet  iciatfs um(vs t4trtnmf3oytlptrauei ()t2trxm3iodop nmnvilt aDtmxr ;t0optnmi3ils s eln sn(0 rxomr ty1lateanvsl(0 euo(m3ou4lmtnmfvi ()sruau  ;t4tetn i3tad s ulnmpn()aexnir3oo1lmtrlivol(  2xmio3ou1lpe  nvtlt)arra(r ;u4alxomoeiltfs2rl(vont)tltnif3ootfp e iei (0sexmxr3iu4ame lfeiatfsDraum nt0oexnii3iysla el( p () exoirciodlpDeli o;s)s2trxm3iy1amte fvsls  Dtmur ot4apeo i3iytlaDul(vs;u)tetrmr iytfpD aivs t0setm(o ou4lle  fvi s aDrrxr ;o0open ocilsfs2emumon(0teermrctydfp  anei;( truoiopny4lp  mncias  2urumoot1oltoifeildfmDumnvs u4 exrxo3oatfp e nvsl(  2urir oy4lme  iciltfaDra(  no1aexomi3ilt m rl(mo;()trenmocta1om e ueilt)t2tr(o3oy4ol   fci (f 2rmu ono1tptnmo3iydfa umn s t4 ltoxr iy1omtr ueils) rtr(o ou4lme mici (fsrrm( pnt4tltn feiys a umnms u4tltrircia1fmD  n s ( srum(opoudomtnmneiat)sDrmxm oo1opx ii3iydlm2rmu s;(4areniocoodfmDeanei;()s2umxr oy1al elneiatf 2urxrpoo1oetoif3iatls emuvo;(4 ltnxo tadom  lu i s)s2to(opnu1om elicsas sDrmx  nu0tex  i3ildls2uanvp;t)trtoif iadlm e nei;s)srtoir ou1op   netlsfaDtru pnu4oetnmicias sDuauvon() reoxf3oydlaDelivi s t2xoxopno1ole lfvi t) 2taxr nu4oleo ociltfm rmnvo;u0 lxomr3tydfa   ies t)sexrxrpnudale  iciasf rta( pnu1oexo fctyd m2rln s;u0 etnmf oo1lp   iesl(0s2toxr3oudlmtnlies s)sDumu o;u0ole moetyd sDrau p u4 etnxfcoatfmD lu il(0trtmxmpiodamenlfvs s)sDurxrpou4oexoioetysla2rmuvo t)arxnif3iadfatraueo s)t2urir3oudoptnliesas) rur( ooo4alenmfetas mDulnvo t4tetnmociytlpDeau i;( setr(r iu4am nlfcslt) rraxmp;o0olenio3iysfaDra(vo u0 rtnxrcty1opDelivils)texo(opou4ole lnvil(f Dum(rpoo0aeen i3ilt mDum(vsnt0tetoir iatfp rau i;t s2um(o3nudaltnlneils sruaxrpnu1tlxn ocilsfm2um( o;(0tlxrxociytfpDrlneo ( srxmim3iydomtnmnct s)sDrmumpot0tlto feiysfsDulnmont)trtnmrciadomD  i ols)tetr(r ou1amt  nct ( aDtmx p;u1aet  o3iadfa raump;()altrxfcoytfpte ivo;s0 rur(r3iy1om nmnvsasfsrtaxrpoo1open o3tys a ulumonu0tlxomociy1fmt luvi;t  rtrirpiy4om e nvsa()artr( p;t4tleomf3iat a2rmuvs;()altnircoa1opte neslt)t2xoimpno1lmt lfvils a2rrx p;t0tpeoiictytlm2emu s;u4alxoiociytlmD ai i;s trumxr iu1oleelivta()aruaump;u0opeomoeiytla2rln p ()tleomf ootfmD lu sls s2trxrpoy1open nvtat sDururo;o4teenifeias m2rmn p u4 lxoiocoy1fpt auvo s)trum(m3oy4lmt lfcs (faDuru  ;o1oexoif3iatfs eaumpnt)aeeomr oytfaDeln slt srxr(opiodoltnmneil()a2rm( pot0teeo i3iyd s2ul(vs u0texnio iydfatrluvi;t srtmxr ny1ap  micta() 2tmu pno0opxnifeiydfs ulnvpnu4aeenmr3ootop  auvs;t0s2umir3io1apee nvtas)artaxm ou1tee mfctyt aDeluvo;()arxoxociadlmtelu i;s texm(mpny1alte fcsas)a2taxmo;t0teen ieiys m rauvont0arxrioctodlpD  i o;s) etrxm oudap emncsa(  2uru oou4oex mociad aDean s t)tlxoxrcootoatr ivi;( s2to(o3oy1llee fvsl( aDrr(ronu1aptnmoeils mDuan onu)arxrxfcto1fa r ueslt sruoimpno1aptemnes sfaDraurp;t0apeoifciytfsDulnmsnt)tleoir tytlm e iei ( setr(rpoo1ale  fesa( s2ra(mooo0tlxnif3tasfa2eaumsn()alerir ootop e n o;s)srxoxr nu4ome lfvtasf 2ua(rono4tleo feiatla2ea(vs;u4alerirciatoa r nvs s teto(r oodolt mnvs () rurumpot4tlenif3iatfmDrmumsn(4artnmr iytlateanes s  exo(m no1lm  mivt s  rraurpou4opxn oeild m rm(msn(4aeenxr totlmt  nvi;t0s2xm(opoo4lm  mnvi t)sDtax pnt4olxomieiasfm ul(mo u4tlxoxo3tydlpD ln olt seto(rpnydome liesls arrmurpno1tpe mo3tlslm rlumo;(4trtnmocty1fmtrluvils)trto(m oo4ame  ncta() 2tax  ;t4aeeoifciyt sDumuvs;u0artomocoy1fpDr ivo t)srtr(o oudlmee nvi () Durxrp;u0openioctys a ea( o ()tetoir3iatfmD  ies s  exoxo oy1openmfesltfsrraumo;o1opeo fcilsfa ul(vont) rxomrciydfm  lneil() 2xo(opny4altemnvs (fa2rau ont0aexn ociasfs rm( p u4texoxo3tydla   nvolt  rtmxo3ny1apt lfetls s2ra(  ;t4oetomf3iltfsDel(vp u0trtrir iydlpDe ueols  etr(o3nodoltnmnvtl(  2taum ;o0texniieiatls2raumsnt0artoxoctatop   n o;s)setrim ny4lpe lnciat) 2ur(m ;u4tlxn i3iatlaDrmumo (0tetnir tydfp  an s;( teuoxmpiy1omenmics ( s2rr(rono4ope iociys m2uauvp t4tlxoif iotfa  lu o (  eur(m oy4olt  ivtatf Drmxmoou4tlxo iciyd m elu s;t) etnxr3oydomtr uvs s0sexm(m3oodlp emncia(fs2tr(r ;u4apx ifciytls rluvsnu4artrio3todlate nvilt0 eurxrpnydlp  mfcsas)arraxr ;o0oee ioeilt aDulums;(0 exnxf3oa1fa eanvs;t0trurxr3nu1apte fvtas a2tr(mp;u0opeo fetlsfs rlu sn()tetoxo3tadfmDean o s texoxm ou1ale  fei t) Dta( onu1ope  fctadla2ua(mo u)tltrxf3iydlmD auvilt  eumiopny4oltn fvslsfa2uaxrp;o1opto ocias a2emnvsnu)altnir iotoa eliesls) 2umxmpoy1lmeemnvia() Drrurono0alxnio3tytfm uauvpn(0 rtomo ootomt ai s s trtrirpno1omenlncs (  Dtauronu0oetnifeiadfaDranmp u) rxnmocoytlpDrluvs;()srtoir ou1apenlivt ( s2urxmont0alt ifciydfa ua(vo ()artnirctytoa elneo s0tetoio oodlltemfvslt s2um(ront1alx ifetas m2rmn p u4artomo to1lptrlivs;( t2um(opny4om emiviltfaDur(mooo1aleomfeiyd s elnvonu0 ltoir3iydomt li slt0srtmiopnodopee ivtl(  Drrumpou0optnmfeildla ul(vsn() lxoircoadla   ivilt)srtmxo3io4opt lfeiasfsrrau pou0aeto feiydfm eau p;u) rtrmr3ia1lpDeauvo ( srxrxo3ou4oltemiet s)sDtrxroot1oltoiicils mDean pnt)texomr totlmDrli i ()setoxmpoo4llt  nvsa(fs2trx o;o1tlx io3iytfa2uln sn(4 eeoxr3to1opD lies s)seur(m3oodom emfciatfsDrrur nu1oeto fcildfm eln o;(0 exrifciotoatrlivsl() 2xoirpoudlp nmnci s sDrr(  nt0aetnifcilsfsDrauvs;u0texoxo tadopD li s;()s2uoxo3iu1ap nmnctls) 2tmx pou1alt  ieiltlmDumumsn()trxnir ta1fmDelu ol(  2umxm3iu4lme  ivt tf rtm(m ou4aee  ietas m2em( sn()artomo3oy1la eauvs;t s2trirpnu1oltn nvt tfsrraum nt0altoiociysls emn o;t4 ltnifciatoaDelnvs s0sexmxmpoodopt  ictl(f rraurono4tetoifeilt s ea(vs t)trtrmf3totopDrai o ( t2xoir iy4llte ivta()aDtau pnu4tptoif3iad m ran p u) etnxf3ta1opt ai o ( s2tmxr3iu4ll   fvsa(f 2rax  ou1tee miciat a2el( p (4aexrmo oo1omtr ueils0sexmxopiudlpte iesltfsrrr(m nt4altomi3tys mDrl( pn() lxnif oydfatelu slt  rxmxm3iy4al nlnvtls sDraxmp;t1tpt mocilt m rlu snu0 rermr3ta1op   u o;s0 eur(r iydame lfesls  Durumooo0aetnmfeiyt a umu o t0altriociy1lpD  ivo;s  rxo(o3no4amt  fcslt  Dua(mpou0olxomfctat a2eln s u0artomo3iytlmDelnei;t0 rurxm3ou1opt lnvsa(farurump;u4apxomo3iasfm2emuvo;t4aeenmociydlmDeln s ( t2umio nu4lp n nvs (fsDtaxront0optomi3iatfm um(mon(0arxnir oadoptean sl(0trxoim oy1oltn ieiat)artmx  ;u0aexo o3iadlm2ranmo () lxnxo3oa1op eaieilt s2tmxmpnu1ape mnctl()s2rm(rono1teenifctlslm2eanmo t4 rxrmr ty1oa  anvo t0 2toim3no1apte ivtls) rrr(rpno1tex  f3tldlaDum( p;t0 reoir ty1fpt aivs (0 2trxo no1om  mfes (  Drmumpou4tet mfetyslm2eluvonu0aetrio oadfptrlnes;s0 euoxopnudop elics t) rua(m ;t0aleniieiadls rmnmsn(4trtrmrciodlm  an o ( trumxr3iudlme lnvtas)s2rmurp;u4oetnmfetldfsDem(vs (4teeomf iydfpDrlueo t t2tmiopoo4omtemnetas)sDta(mo;t1tleoii3iytfa rmn s;t4artnir3io1op   ueil( srtm(r3nudopt lict tf 2rmur nt1tpt  iciasfm eanmo u4aexrxf oadfmtrlneo s s2umxm3io1lmen fesl(fsDtaumoot0alen feiad a rmuvp;u)altriocoa1opDelues (0teuo(rpno4om  lfcs t  2rmx pno1tpx iietldfa2ranvo;(4artnxf3oodfpt  nvi s) euoirpoo4lptnmicils aDua( pnt1aeenmicilsfa2emuvs t)tetomr3totlm rlieils srtoio io1omtnlies sfs2ua(moou0oexnif3iyt sDemumo (4trxnio3oydoa  aneil() rtrir iodap elnci ()s2uaumpnu0oexomi3ilt s rmuvpnu0aeeomrciydoa rlivsls0trtr(o3nodamt mfeiat)sDtrxrpnt4olx mietydfm2rlu p;t4altoxoctatlat aueilt)t2umirpnydaptnmics s)srrr(root4oexnmi3tld s2rmn p;u)teeomo tydoaDr iei t)teumxm3io1lmtelfcta()srtrxmoou0aeenmiciydlm um(mo (0artomocta1la r uvi s) rtrxmpiy4op  mnet ( arta(m ;o4oee mocildlm2elnvp;(4 exoiociytlpte u s;t0srxo(o3oo1oltemfvilt)s2umx o;u1texo iciatfm2eluvpn() lxniocoadlmt aivs s0srxrxo nu4lpeelneils sDtmxrpno1aexnmiciltlm em(msnu0tltrmf iotomD  iei ()s2trxmpiu1omtnlfctatf 2taurp;u0ole mi3iatfs raump;t4alerxf ta1fpDe neo () eur(mpiudapeemfcs sf 2rr( pnt1ape  f3iltla2umnvs u4 ltriocta1lmDeaiei s) 2xoio3oo1oltemicsa(f 2urxr ;t4tltnmfctys s rauvs u) lxoircootfp raivi;t)trxm(m ny1om  lfvtlt)srua(rpnt4aptnmo3ias sDrmnms;u)arenifctotomDe u sls) rto(r3ou4lpeemfetas)a2rm(m ot1aetoiietldfm rl(vs u)tlxnxf oytomt lieo t)srtm(o3nydopeemnvi s aDtrx  ;o4oleo icilslm rmumo ()altrmo iydop rli o;( texrxopoydoltelnctlt) 2umur ot0apx mfeiasfa ua(vo;u)aexoif3ootoptean ils teumxm iy4ll nlnvsat arta(mpot4olxo ictltlaDuaump;u4tlxrif iodopDelnes t0setrxr oo1opt  ncsl()s2trx  ot1opeomi3iytfaDrlump;(4trtnxr totop raneo ( tetmiopny4lpe mfci tfsDrru  nt4aet ifciyslsDulumpnt4teeoio3oadlatrliei ()srur(o nodap e netas arrrxm nu1aeeo i3iasls2ean o ()aetoxociytfmD  nvs t)t2tr(mpou4optnlfvt tfsrtmu oot0oleoifeiyd s2ranms;(4 lenxr ta1lm  anvi t)srur(mpoodol e ieilsfarurumpoo0ale  fetltfmDul(vsn(0tetriocoo1omtelueilt) exrirpny4lmenmncsl( a2rr(r nt0aeen i3iyt m emu o u0 lxnir3iy1fatr uvo s srtrxr3nydamt mfciat a2tmur oo1opt iiciltls ua( snt0tlenxf oatfa ean i;t0trtoir3oo1apt lieslt)sDrm(mpot1aeenmfctasfsDraumsnt0trxrxo ia1omD aivol( srxmim3iudlmte netl()aDuaxr ;o1tlx  ieiydfm2rmn pnt)tltoio iy1op   n sls)t2xo(rpou4al nlivia()arumxro;t1opto iciytfsDelums;t4tlxnif oodoat  nvs ()t2uoxr3ny4op  lfcta() 2urxr ot0aex  ieiadfmDrmu on() eenmrcto1laD  uvi;()s2umxo3nu1omenmnvslt)aDum(r oo1aeeo fetasla2el( p;u4tlxrmr3oy1lp ran s s0setoxo3oydllt lfvias a2rau  oo0tlx ifciatls rauvp;(4 etnif3oydopt li i;s) eurim3no1amtemncil(fs2urxr ot1tlxnmiciydfaDra(mo;()altoir tydfa raivs ( teumim oydap e nctltf 2raxm ;u1tex mfciyslsDrmu ont0 rerxr3iadfm r n sls) exo(opoudame  ietl(  2umxmp;t0olx ioetldfs2uau pnt)artnmociydfa  lnvsl( t2uoxrpiy1ale micil(f Dtmxmpoo0aee mf3ild mDel( p;(4 exrxfcoy1fptelnesl(  rto(m io4lmee fesa()aDumx ooo0tex moctyd s ean s;() lermo3totfmt lieilt0t2uo(m3oydllen ivs sfsrraurpot0tlt ioeiltfa el( s;u4 etriociy1omD aneo s  2um(mpoodomenlfeslsfartr( oot4teeo oeiyt a ua(mo;() rxnmfcoy1laDeaneo;s)t2toxr iu4opt lfvt ( srtrxrono1olxnmo3iyslaDrlums;(0treomf tytfmtr u s t)t2umxr3ou1am nlfeiat  rta( onu1aeeoioeiltls eanmo t4tleoir3to1laDraivi (0s2to(r nu4ome  nesl()arua( onu0alxomfetyt m2ul(mont) etomo3iadla eauei;t0seurim oy1altnmicslt sDtmur nu0oet  icilslaDea(mpn(4aetoxf oydlpDrln o;(0s2ur(m iu4am   ncils  2taumooo4ole  fcildfsDem( p;u4trenmocoatlatran i t)texmxr3iodomtn ncsas)artrxr nu1openmoeiys a2rl( snu0alxrircoatomtelivi;( seuo(o nu1lmt miesas)sruaxrp;t1texnmfetlslmDel( pn(4arerir to1fpteli i;s)sruoxm iudol elneias srrmu pnt0oex mieiltfmDuaums u0alxrmo3totomt  i s;s0 rxrir ny1op nmici (f Dtmu  ;u1ope mfeiysfm2rm(von()arxrxfctydfaD liei;t seur(m nydameemivtat  Dumxr no4altnif3iys aDrlump (4arerir iytlp raivi;t sexoir oydllte ieilt a2tr(  ;u4oeeoio3iltla2emnmo;(0aleoio3ootlptrau o (0 2trxrpio4aleelfcilt)arum(r ;o1olx  i3iatla ra(ms;(4tleoxo3oytlmD livo;t0 2trxmpiodlmt lnei t)aDtax oou1tltomf3iadls2umn o t4artnmo ia1lmDrai ol()trxr(m3nydll  lfvil( s2uax  no1alt  fciatls ranvo;(4trtoio3io1fp  lieo () etm(rpou1opte fctls  2ta(  nu1tpx  o3tat sDua(vo;u4aleoifciatfmteauvilt)trxr(o iudopte ivsa(f ruaxm ;o1oeen fciadlm2el(vp;u) ltnmocio1fat  ivs;(0srtmxmpnodomeemfetl( arra( o;t1tle mfeiltlsDeaumo t0artrif tytlptr uvs s)sexoir3ou1optn ieiatf Durumpnu1alenmf3iadls ran o;u0areoir3todfmDraieilt)srurio no4olt lfeias  Dtm(mpno1aleoifciydlaDea( s (4trtoxf3ty1fpDeaues;t)srxmirpiu1oltn ncsas) rtru pou0oexoiieias a uanvs t4 lerxr iatopDelues t) rxo(rpio1oleelnvias aDumu poo0opt mfeiadlsDrm( p;u0tetrmo3tydfatrlu i;t)srxm(m oudlpt  ncia()srrrurpot1aeeoio3iyslaDrmnms;t0tleoio iotomDraneol(  etmxm3iu4apteliesasfaDra(root0oee  ociyslsDem(vpn()aetrif3tydoa elivo;t)teuo(m oy4ll elfviltfsDua(r oo0olx mieiyd sDumnmp () rxoxfciy1latean s;(0 2um(o oy4lp nlnetas aDtau ono4aleomi3iytfmDemuvonu)tltrir ootlpD auvs s)truo(opoodapenmncsa(  2ur(r ;u0tlxniiciasfa2ea(mp () rxomr tytfpD lnvslt truoio iy1lpenlies tf 2rmu  ;o1tle ioeildfs rlums u0tetnif3iodfpD  nei s)teuo(r ny1altnlfcsls) rrmumo;o0oexomfctys sDeanvonu4 rxomo3oytopD lies (0 exrir iydlmtnmncilt artmumont1oetomo3iyd a2ranmsn()trtoir3oa1fat livi ()setm(m3iudapeemneta( srrax pnu0opx mo3ildlaDeln o;u0teeoxocty1lm e ivo;( srumio ny1ap nlneil(faDurumpnu1tlto fciaslm ua(ms t0aeermo ootlptraivslt sexm(o iudllenmnct (fartax pnt4opx io3tldlm umnmonu)texoxo tydlmt lu sl( trxrirpny4omtelivtat srtax ooo0optomo3iysfs2emums;t0tlxrmr iy1lpteaies s0t2uo(o3nydaptnmivsas a2trxrpot1tltniieiadls ea(vo;u)teermo oodfaDelivols)t2umio oy1am  mfci ()aDtr( o;t0oeenioctyt mDra( s t0areoio iotopt  nvi (0 rxmxm3nydlp  mnetltfartrx  nt0optnmieiysfa2eln onu4texoiocoytoateanvo;( trtrio3oodape lfct ()a2uaxronu1aetomfeiltfm2eaump;u4arerif oa1fpD  uvolt) eto(r oy1lm nmivtlsfaDtrx  no4oet  iciat s2emums;()alxnxr totfmDr ieo (0trumxr3iu4lpt livslsfaDtmu pou4apt  ictld s eaumon(4altrio3tydlmDe ies;t)srum(opoy4ll nlncslt  Dum(m nt1tlxnmf3tls m rlnvont) renirctydomD auvils0teumio iodom e fvta()srtr(r oo1apenmfetltfm ua(mp;u0teermr oatlpD  n ils0s2uo(rpnodlpe lnesas sDtmur ;o0tpeo feiasls2ean s u)texrif oydlmt  ivils)teum(o3nodopen nes tfaDumurpot4tlt mfeiasfm eluvp;u0tlxomr oatop r nvil(0 2uoxopiudol nmnciat)sDuaumpnt4tee  iciadla emuvo t0alxrir3tydfpDelies t0sexoimpno1om nlnctlt  Drm( onu4alt  ieiltlm2umnmp u4 renirciytfatrliei;t  rtm(m3nu4alt mnvias)srtmumont1oet mfcilt m2ulnmo (0aleomfcootlpteaues s0 rxo(rpiodlmenlnvil(f 2tmxr nt4oet  f3ilsls uluvsnt)tltrir ta1lmDrai i s  eur(mpiy4aptnmfes sf Draxmp;o4apenmoetytla rmnmp;t4 rxnxr3ty1la r ivi () etmxr oydlleemieia()srrmurpou4tee  oeiytlaDrauvo ()alenmfcta1oaD lues;() rxr(o3oo4ale mnct (  rta(mpou4apeoio3tad a2ulnmont4 leomr oa1fm rai o ()srxmxr3nu1amtnlfvsa() rur(m oo4oeen fciyd a elu s u)tetnio oy1lmtrau i;t s2tmim io4opeemieta()sDtmum ;u4tet mfeilt sDulumo u) eeoif ta1laD  u sl(0 rxrir3oo4al nlnciasf Drmur ;o1aexomieiysfm2eln snt)teeoxr oatfat  nvo (  exm(m oo1alee ics (f 2trxr no0tee mo3tatlm2rlnmp t4alxnmrcootfate ivo;t)s2xrio oudom n netas)srtru ono1ale ioetldfa2emnmo;(0altnxr3tydlaDr nesl( setrim iu1amtnlfvs t) rraum oo1aee mociyd s el(mp u) exrioctadfmDr nvi;s  rtmimpiodap nmivtls sDua(ro;u4altnmfciatlm emuvo;u4aetnmr oo1fat auvi s texoiopny4ol nlici t)s2tmxront1teeoiieildla2eanvo;(0tetrmf3tytomteln o;s) rtmimpio4lmte nct t) rta(rono4tleo f3iatlm2rl(von(0aetrxrctotlaDelies;(  rurxo3iu1ame  ivs t) Dumx  ou0alt micils m2ulnvp;t4 ltnir io1fptrlnvo t)srtmim3nudom e fvsls) rur( pnt4ape moeiydlaDum(monu)alxoifcia1fatrlivi;s s2xm(o nodamtelieia( sDtrxmpnt1tlt if3tldla ulnmpnt0 eenmoctytfm raivsl(  etrxmpny4apenlfei ( arumxm nu4tpeo f3iyslm um( on(4aexrirctodlateaivi (0 2trxr3oydlme livias) rtm(roou4oexo oetasfa2eln ont4aeeoxocoydlatr n i s seumio ny4ll nmivi ()sDur( oot1oetoif3iydlmDel( s (0alxnio3tydlatrlnei;t0 rumio iy1ope livt (  rrmu pnt1tpxoif3iysfa2rmuvs ()aexnif oadom r ivi t) eur(m3iy4lpt  nvias)sDta(ro;o1aptn ocils aDrlumon() eermf iodlmtrli i t s2urxr3io4amte neilsfsrur(m ot0alen f3tytlsDranvpnu0altoxr3iatfpD li i;( setr(m nodopte ivi tf rrm(monu1tet  o3ils mDemuvp;() ltoxr oatfpt  ueolt srxo(opnu1lleemivilt) rua(rpou4opt mf3iatfaDulnvonu0texrir3oadfmDraivolt texrxm3oo4alenlfcsl() rtm(rp;u4oetnio3iltlaDrmnvs (4tetniocoadoa ranei t  rxmxo3oydolte fcia()arur(monu0tex  fctlsfm raumo (0tetrmo iy1lpD  u o (0 2um(rpny4lpe  fes (fa2rru o;t0teenmoeiydfs2ul(ms;u) reomrciytoa r n s;t) rurio iy1ole mfcilt) 2tmxr ;u1ape if3tyd m2rmumo;()altrmrciatfm raivs ( s2xoxmpoodlpee ivs t)artr(r nt0olxoiieiasfaDrmnmp;(4arerxfcoo1oa eaiei;s)trtmxmpny4lptelfesa( artmxrpnt0apeomo3ilt m2uanmp (4altrmfcoa1fmt lu o;(0sexo(o3io4al nlnctas  Drrumono4olto oeilt a2em( p u0trtrmf oadfmD anvo;t0texoiopnydoptelfesat srurxrp;t0tptoiiciyd a2rmu p t0trxomo ta1fatraueols0 etrxm ny1lp  mieias a2tm(r ot0tee iietlslsDul(mon(4arxoxo ia1omt  n i;() eumir3iy4lmen ncs s)srumx pno0aetoioeiadlm2elumo;u4altnmf3oa1lptranvsl(0 etmxm3ny1apee nvtas)a2uau o;o4alxoioeiat m2eanvo;t0tltoioctydfm eau i t0 rumir oydom nlies (faDum(  ;o4alx  iciytla eauvp;u0 etnioctotopte ivilt0 rurim no1lptemiesltf Dtau  ot4aetniociadlaDrmnmo;(0alerxfcoadoatrlu ils)srum(m3io4lpen iesls arra(r nu4aexn oetatfa ranms;u)trxoioctadom e uvi;() 2ur(o oo1alenlneiasf 2tru oot0olxoiocilsfaDuauvpnu0trxoio tatfmD livols0s2tr(o3oydlm e netat  2um(  ;t1ope mocild s2ul( pnt4alxnxf oo1fm r ueo s sexo(mpoodom  lncsa(fs2ua(mont4apt io3tltlm2emums (0 rxoxf3io1om elivi t)teumir3nodll   icsatfa2rrx p;o1texomo3tas mDeaumo ()alxnmo3oy1fm  anvo s  exrir iu4ol nlfvsas) rrmxmo;u0alen o3ilslmDeanmpnt0trxnmo tydlat lnei t0t2xrimpio1lm nmiesat)sDua(mo;u4olxnifeiaslm2el(vp u0aeermrcio1fa e u s ()trxmirpiudomt lici tf 2uru  ;o1oexn fciysfs emumont)tetnmrcoytlmDelnes (0t2xo(rpou4amtnmfctlt srrmxmooo0oexomoetas s rl(vsn()tltomrcootopDeluvs s0srxm(opno1ameelies s  Dua(m ;u1oet mo3iytlaDrl(msnu)tltomrciodla r iesl()trtmiopiu1llee ivi t  rtmxr ;o0tpt mo3ils a em( o (4texnmrctydlat lues (0tetr(m nudlp   ivtl()s2ua( onu1oee  ieiasls uluvp;(0trtrio todlaD aueo (  euoim oo4ll e ics (fsrurx pno4texoifetld m2rl(ms u) renio io1fa elivo;()sexm(o io1ol  mfvsa(f 2uaxrpno0opxn i3iad a2ulnvs (0trtoir oo1omtean s s trxo(m3iodopt mieil( artrxroou4apto o3iyt a uauvs t4arenio oadoaDe n ilt t2xrxrpny4optemfctlt)aDrmu  no1oetoioetasfs ranmo (0areomrcoydlmt  nvs;s s2xmxopoudal nmfvsas)arrrx onu0tptnmoeiatfa2ulnvo;u0 lerxocoytlat aueols0 rxo(mpiydapt  ictasfa2tauroou0aeto ieias m2rm( s;u0 rtrioctytlaDrau s t0teuoxrpou1lm elfetlsfaDrm( poo0tptomf3tlt m em( onu0alxnir tytoptrln s;(0 rxriopiu4al   nesas) 2uax ont0tpxn ieiydla ea(mo t)alxnxr ta1fm eanes;t) etmimpou1altnmivtl(farrrxmp;u1opeoiocilt sDrauvp u4teenmf3todfmtelnvo;t)t2xoiopoy4al  mnviatfarururo;o0aeeo oeilslm rmn o u4texnio3tytfmt aivo t0setrim oo1omtnmieiat s2trum ou4oee  fctldlm rmn p u) etnif3oodoa raieilt0teto(rpiydomt lnetatf 2rrx  ;t4ole  i3iytfs2rluvs (0 ltrxrciodopD  uvo;s) rtoiopio4al  mfctatfa2urx o;u4aleomfetlsfs rm(mon() eenxocootomtrluvi t) 2xm(m3iy4lpen nci t)arumum ;u4optoifctlt s2uaums;u0 eeoiocio1la  li s;s srxo(opoo4lpenlfcilt)sDrau ooo1opx  icild sDel(mp t4 leoio ia1lpD  uvs;(0srtmim3ou4op emfcsas srumx oot0ope mfetas mDemump (0trxrxfcootfat anvo s0t2xo(r io4ame lfes t)aruaxmp;u1texnif3iadla2eln o u4texoxo3totfaD ai il(0trxo(o oo1lmtnmieils) 2rmxr ;t4aexnioeils s2emu pnu4 exnmo oodfatrlnei s0 2xo(m nu1om e fetat)srurxr ;t0oltnmo3iyslaDea( s t0treomo3ootlp raieils0 2xm(r oy4am  mfes s a2ra(mo;u1oleomieiltfa2rmnvp u0 leomfcoodlaDe nvs;(0t2xrxo nu1apt mies tf rur(ro;t4tlen fetydfaDrmnmp;u4tetnxrciadfate u olt0srumxr oy1olt lfesat  rtr(rono4aetomocias mDrluvo u0 ltrxo oytlm rlnvi s0setoir3ou1ap e fcsa(fs2taxm ot1olxnmiciaslmDrmumsnt)areoifciotfptr u s;s) rto(m3no4ll nlietl(f 2uauronu0altomo3iysfa2rmnmp u4texnxrcoatop r ivils s2xo(rpio1ap elieta( s2raxmooo4olx miciyslm2raump t4 reoir3tatla eaivs;s0seto(r3nodllt  nct s)s2tm(mono4tleo icildlsDrlu s;(0tetrxf iodfmtraivi;s s2xmio nu4amee ietl(  Dtrxmp;t0olt mociltfmDea(mp;t4tltrxociy1opD  nvo s  rxr(r3iudolt  ieias  Drmurpot4aexnifciatla2um(vs;t0trxoxr oytlp e ueo;s t2um(r no4alenlfeiat srrr(  nu4teenmociad m uau pnu0 lxnir3iodfmD lueo;s  rxrxm iodllt mfct sfa2taxro;o0ale ioeiysla rmu ont)aexrif3iadopD  ieo (0 rum(o3iu4aptelivtat srrax  ;t1apeomicils m2rm(vo;u0areomf3totfm   nvo;s)teto(r3ou1altnlneta(  2ra(rpnt0aex  feiadla2umu onu4trerif3tytlatelneolt s2uoio3iodom nlnctas)arraump;t4oeenii3iadlsDemuvpnt4 etomr iadlpte ueilt0setoio3io4llte ivs s)aDuru  ;t1olt mf3tysfaDum(vp u0 etriociytlp r i ol(  euoirpiu1opeemivtlt  2rr(mo;u4tle mfeiaslaDemnvs u0alenir iotop elieo;t0tetoxr oy4ap emnctlt aDtaum no0olxo i3iyd a ulu pn(0aeeomr ty1latranei;() rxmxopiodomtelfesa(fa2trump;o1ape micildfsDem(mo t)tetnmr3totopDrauvilt0 rtmio3oo1amte fvt t srrmxm nu4alx  oeiltls rmnms;u4artoircootlm rlnvi;t0setriopny1lpte ncils)srurxrp;t4texomoeilt s2ea(vpn() rxnirciytlat  u o;t0seumxo3io4lm  miesl() rumum ot0tpe  iciytlaDea( s t0tleniocoytopD  n i;s) eur(m oodome lfetasfs2rrx pot4tle mictlt m2elnvonu)texnmf oytfmD  ivols setr(r3oodlp nlfct s) 2ra( poo0texn ieiltlaDumuvo;(4 rtrir3ty1opDelnei s0t2uo(r io4ale  fvil(fsDra(mont4aee mictasfa um(vs;u4 rxoif totfaDrln ols0srxoim3oydolte nvs (fa2ta(mp;u1tptnmictlslmDrmuvont0teeomr iodomtrau o s) rtmir oy1olenmfcsl()a2ua(m ;t1oexnmoctytls2eluvs;(0trenioctytlpDe ivilt)trur(o3iudamt  nei (  2urumoou4alx miciysls2rmuvs u) etrxfciodlmD anvi ( s2umxo3iu1ome mivi t)aDrmx pot0oltoifetydla2uanvs;u4trtnxo3tytoaDeauvs;()srumim3no1apeelnctl( aDra(m nt0opx iocilsls ea(mo;u0tleoxf oodoaDrluvi (0seur(r3no4lptn ivs sfsrrrx o;o4aetniocildls2em( p (0aetoxf3oo1lp eauvsls) euoim3iu1lm emnvtlt)s2rr(roou1aptomi3iyt mDulu pnu)trxoxf3oatfpD ln s t) 2xo(r3oy4opt  fvsltfaDrmx  nt4tle  octyd a eanmon(4tlxrircta1op rlnes s)seumio3ou1am n fct (fs2taxmo;o0opeomoctldfs ran p;t0teerir3oydom   i o;s)s2trxo io4ale lfviat)sruaxr nu4tlen f3iydlsDra(ms;t)aeermr3tytlm e neols s2uoio3ou4opee ictls) Duaumpno4oeto feiatfsDem( p u) lerir3tydfp rln i s)s2xrxmpio4aleelicsat) 2umxm ;o0open fctasfs ul(vsnu0 rxnircootomD  ivo t)tetrirpnudapte iet s sDuau p;t4oexo o3iltfaDelnvon()tlxrmo oa1fp r iei () 2tr(m3iodolt lnesat  2raxmp;u0tet mo3tasla2rln p;u0alxrxfcta1opDeli i t)seuoxr oodal nmfvia( srrm(ro;u0tptn ieiytlm2ranvont4alenmrctatfmD  i s t)sruriopiodalenmfvi (  rrm(rono1aexo oeiysfmDua(mon(4tlxnxf3ty1laD lu s s)t2xoxo iy4ale  ncta()sDur( oot1tltomfeiys s el( o;()trtnio3iatlmDrli i t trxrim3no4lp e nvt s)aDua( oou0oltn ictldfa2rmuvo;u0trxomf3oo1fa  aivs;
\ No newline at end of file
@@ -0,0 +1 @@
+nvo;s0 rxoxopno1lp  lneia(fa2ra(moot1apx ifctltfmDumu s u0arerio3oadfa rluvi (0t2tmxm3oydoptnlfeil( srumumo;o0tee  ictlt aDelu p u0areomo3iydla  lues;()sexrxo3oydllenmfvt sf Dumx poo4tpxnmoctlt aDranvsnt)tltnxr3totom rlu s (0trumiopnu4lp nmfctas arraurp;t4alx moeiysls2el( s (4 exrmr oo1om eai i t  ruo(mpiy1omtelnvsat  2raum no4openmociad s2em(msnt4artnxo3oodfmDran o;t  euoxmpoy4om  mneilsfsruaum ou1aptn o3tltla2rm( o;(0areoxf tydfa elnvo s srxm(m3no1opeelivi t a2trx oot1olt  ieiadfsDrauvs (4trtnmo3ty1lmDrluvil(0 rtoir iu1olen fesat) rum( pot0oetnmf3iydlm eaumo u0artrif oodla  lu sl()srtoxm3iy4alenmfvi tf 2umxr no4tptoioetlsls elnvs u)altnio tydlpD aues;s0t2uo(m3oodlmtemnctls s2rrum ou1oeeo feiltlm ulump (4alxoifctatfptr i s (0s2um(o no1amtnmfviat srum(m ;t0tlenio3iadfsDrlump;(4tlxoxo ty1om elivo s) rur(m3no4am e ncias)s2rmu  no0aleo oeildlsDumnmo;t4 rtomr3iydfa r ivs s trtm(m3iodaleelivtlt aDrmxmpou4alt  f3iaslaDum( pnt0trermo3iodoaDelueilt t2xmimpiu4op emies s a2ur(  nt4optoif3iatla2eln o;u4alenioctotlmDraivo;s)s2xo(r ny1amte nvtlsfarua( pno1alt ioeiatls el(vsnu0tlenircto1fa e n s;s srur(o3io4lptnmivtl( sDtaur no1tlenmfcilsfm rl(ms;t4teenmf iytfatr ivo t) exoxopny1amtn iei (fsrtr(root4alt mociys a rm( pn()treoxr3totlat lneils) exoir3nodom  mfvilt) Duau poo0ole mfciatfa ranmp;()aetriocio1oateaivs;t sexrim3iydlpen ieiasfs2rrxr oo0ole mf3ilslmDrmumpnt4 exnxr to1om eluvils0trtrxr iudapeelivil()arrmur ;t0olxnmf3tls aDrmnmo u0 rerio3iy1fp eluvils)t2xmxo nu1aleelnctls)aDuaumo;o4oleoio3iytlm2ul( onu0tetnif3iodlpD li o s0srxrir3nu4lme  nes s) ruauro;t0olxomfetyd aDrlumon(0 rxrir3oydoaDeanvi;(0 2tmir3oy4optelivil()s2rrur nu1oeen o3tadlmDua( p t0teenxo ty1fp rli slt)s2xmxo iy1oltemnvs s s2urumpot1tpto ictys a2emu o;u)tltnio tytfpt livi t t2xm(o nu4lltnmiesas)a2rmxro;o4alx io3iydla2rl(vp (0aeeomr3oatom rlnei;t  exo(mpny1lmtemfvta() rumxrpoo0aet mfeiadls rlu p;u)tlerio3ta1omtrlneilt0sexoxm oo1lmeemiei t artr(  ou1optnmi3iad mDumump t)trxrmfciy1oa  ln sl(0s2xoxmpiy4apee neslt)srta( ont4aeenmfeiyt mDem(ms;(4tlerio oydfpt luvsl(0teur(r iodaltnmnei t  Dtm(rpou0teeoifetydls2emn sn()alxrmr3io1omD  ueil(0setoxr3oo1ap elnct tfs2rrxm ot1tptomf3iasfaDua(mo (0 etnmr3oytlm eli s;s)t2urxmpnu4am nmiet (  Dtrxmo;u0teen ictas s uln s;(0arxnmo3tatfateluvo t0 rtrim iy4omtnlfctls s2rmx o;o4tpt ifeilt aDemuvp;(4 etoio tydoat liei t)srtoxrpiy4al elncsls)arrau o;u1oltn oetytls2uauvo u4 lerxr3iotfa rlies;t teurxopoo4llenmfeilsfs2ua(m no0tpxomf3tasfsDeauvont)trermo3iatoaD  n olt)trxoiopoy1op nmncilt s2tau pou4ole iiciyt m rlnvo ()altoxo ia1omteaiei;t)s2toimpoudopeelnesat  2ua(  nt1oex mfciaslm2el(vs;u4 lerifctydlaDrlnei;() euo(opou1ap emnvt s)artmumono4opx if3iysfs elnmo;t0 rxnio oy1fpte ivols0texrxopiu1amtelfvtat s2uru o;u0aetomieiyd mDrlums;t4arxnifctatfpDe neil(0trumxr3iy1lmt  fvi t a2tr(rp;o4aee moeildls elnvo u4tltnmf oodoaDe neo (0sexr(r3iu1op elicsas)a2tr(roou4opt mi3iasfa rl(ms;t0 etnmrciotla   uvs;(  rxoir oudlmeemfvtlt)a2ta( o;o1oleo f3iltlaDrlu o;(0trenio oatlmDe nei;()srum(r io1amtn fvsat srtaumont1tetn o3ildfs ul( o t) rxriocoytlaDeanvslt)t2xm(mpiodol nmnvsl(f rur(  ;u4opeomoeiydfm2elnvs;()teenxo3tydom elu o t trtrimpoy4oleemietl()srtmur ot1opt ifeiadfmDuaums (0aeeoio3oa1fptrai i;(0trtoxr3oy1amte iet t)a2rmu poo0olxo feildlm2elu s;t) rxnmf3iodla  auvi ( srtoim3nydoltnmicsa(f Duauront1aex iiciasfs2ua(ms;(4 lxnio tadlp  lu s;t)srum(opou1altnmiesatf Drmx poo1oexnmi3iad m2rl(mo t)aeenmfcto1omDe u o t  rxmimpno1lm elfvtl( aDtax pot0ole  o3iytfs uaump;u0tltrio tadlmt au slt)s2xmxm io1lmenlies ()aDum(r no0opxn o3tasls elnmp;t) lenio3oodlm r ues t0 2ur(o3no1op nmnctasfsruaxmoou0tpe ioeiltlm2umn o (0aleoxrctydomD aieo;t0texoim ny4ap n feia()s2rr(root1tlt mictaslsDua(vs u4altrir iy1omteln i t)t2tr(r ny4aptn ietltfsrraumpou0optoifcilt sDra( p t4artnir3todoa e ivo (0t2xmxo iy1amtemfet s)arua(  oo4olenmoeiasfa el(vpnu4tetrxf iotoa elnvilt srum(m3nu1lpenmieiatf rua(mpno1aexoifciytfa ulumo;u4artrxfcoo1fpD li ol(0 2toir iu4amtnlnvtltf rumu  nt1tlxoio3iadls2ra(mp;t4 lerifcoydlm   uvs;s) 2toim ou1altnlfet ()srurxm no4apeomictldlsDea(vp t) eeoir3ty1lp elneilt  2urxo3nodolt  fvsas)s2urxmoou4ape ioeiytfs uauvonu4aeerxo oadlat luvslt0seur(o3iodol  lnei sf rtm(mont4apeo ictat sDrauvo;u4aetnxo3oy1fa   uvs (0setmxrpnodlp   iesls) rtrxmono0altn o3tad m2ulnmsnt4alermf tadlaD anes (0srumirpno1am   fcs ( arrr(  nu1apt moeiltfaDranmp;u4arxomr iotoaD  ies;(0trxoxrpiydapt liviltfs2tr(rp;u0ale  i3tadla rlnms () rxnxfcoytfat  uvols0 exo(r nu4llenmnctas)s2uaurono1aeeniociasfs uanmpn() eenif ty1lmtr ueils0srtoxo3ny4ap nmici s) rumur ot1opxo ictysla raumon()tlxomr3oy1fa elueils)t2tmxm iodlltemivsl(f rum(r nt0aetnmoeilslmDulumo t0 exrmo to1fp   i i;s0s2tmxo3ny4apenlicsat) rta(r ot4oleo i3iadfs rlumpn()tleoxf todoptelieo s  2tr(r nudal  mnvias)srrax  ;u1opxomicilt s2umums;u4tltnmo3oydlpt  u il(0 2xr(o3ny1altemiviasfsrua(r ot1tet mf3ilt s ran o t)tltrmr ta1fat  i i;s0seurim3ny4lpe lies t srum(ront0apt mf3tytlm ra(msnt4 lxrmrctadfpt  ies t) rtrim3oy1lmte nviatfartmu poo1apto o3tyt sDul(mo (4 lenxf ia1la   neils)srum(m3oy1ll  mnvi sf Dur(mpot0tee micilsfs emnvo;u0areriociodfp eli i (0setrxrpoudlleelfetasfa2urxr ;t4tlt  f3iatlmDeluvo (0 lerirciatom rai i;s0trxrxr3ny1lm e ncsltf 2uaxmonu0aet moetyt aDulnmp;(0alerir3iytop rauvslt0t2toir3iu4omenmfctl(f Dumx poo0tlt mfcilsfm2el(msn() ltnxf3oydlmDeai i s srtm(r ou1op e feiasfsrrmx  ou0aptnmfeiltlaDul( s;u0aexrmf3todlaDeluvi s)srxmxmpiy1lpenlictl(fsDrrxr nt1aleoiiciyt mDrl( p;t4 eerio oodfmteluvi t0trxo(m nu4lp n fviltf 2um(ront4oeeoio3ildlm ua(mp;u0aeeoxocoadfmteliei s)s2xoir3iudaptelfcil( sDraurpnu1oexnifciadlm ranms;t0aetoxr3iy1faD luvs ( seurxmpnydomtemivtlt)aDrmur oo0tetnmfctat s umn snt0trxrircoa1lp  lnvi s0 rtm(o iodalenmnei ()arumumpnu0tleoiictytfs rm( s;t4altoxo iotfmD auesls)trtr(r3ny1ol e fviatfa2rax oou0oexnmfeiatfm2el( s u) rermfciatfate uvo (0 euoio3io1al e fcsa()sDum(m oo0oexoifctls sDemnmonu4 rtrxfcta1fmt luvsl(  2xr(o3oydapee netasfa2ta(rpot4alxnioeildfm2ra( s u4trxrir3oy1lmteai ils truo(r iydomenlicta(f Drmum ;u4olxn f3ilt s umuvon(0aeenxr todlpDraneo;()seumiopiy1llenmietatfs2ua(mooo4opxn oetls mDul( p () ltoxf oa1lmt lu i t)texoxmpoydlp  lfcs t)s2uaxroot0tpxnmo3tys a2rm(monu0artnio3tatoaDe neo t  eumxr3iy1olenlict tfsrraxro;u1altnio3tys aDulnvp t) exniocia1lptr uvi;(0seto(mpno1llee ictl( aruaurp;u1tlt iieiltlm rlump;(0alxrircto1lmt anvi s0srxrir nodlleelnvi sf rrmx onu1alenmo3tldfm ra(mp;t) lerio3oa1omt  n i t  eumir nudlpe mictlsf 2tm(m ;u4alt  f3tld s2rmump;t) rtnmo3ootlaDrlivils0setmim oy1ale lneiltfaDum(  ou1oleoifcils aDran o t4 lenmf3oo1fm  aues t) euo(m3oodoltelneils srrrxrooo1oetomieiytls eln p;t4tlxnmf oa1lpt ai i;(0teum(opiudlmte ncias)a2rmxmpno1tpto oetldlaDem(vonu0 lxoifcto1oa  aieils0srxoxr no4omte nvtasf rtmx pnu0tlen i3iasfa2rlu s;(0teeoio io1la   neo;t0t2xm(m3iydal nlfvsat a2rm(ro;u1ole  fetltfaDulnvon(4 rxoircoy1omtr n s s s2uo(r no4lme mfct ( aDrmx  ou0tptnifeiys aDumumpnu4arxnmf3iy1oatelnvi;s) 2trimpiy4am n ncta(fsDta(mpno4ope ii3iltlaDrlnvon() leomrcty1fp elueslt)seum(m3iu4openmietltf 2rrurp;u4olenifetatla rmnvs;u4tleoxf tytfate uvol( setr(opoudom  lfetls)sruru p;u1ape mo3iytfm2uanvo;u4 rerxoctotfpDe uvi;(0seurxmpnodam  lfesl(fsrtaurpou0apxo i3iad mDemnvpnt0aetrmo3oy1faD  ueil(0srumxm3iy1lm nmfvt tfsrraum ot0teto fciad sDumn p u)texnmf oytlaDe uvo;(  exo(r3ou4al   ivsls  2rrxrp;t1oexo f3iydfs ran o u) reoifcoytfm   ueol()trurir ny4amtn ncs t) 2ra(ro;u1tetn i3tldlsDumuvonu) lenmo3oy1lm r nei;s)srumxmpnu4apen nvi s) ruax ooo1alt mfeiltfmDra(ms (0tlenxf iatoaD  ivs;t) 2ur(r3nydamt mics sf Drm(mpoo0aleoio3tltfsDrln s;(4 rtnxfciadopD luesl(0seuo(opou4lmeemietat)a2tmxmo;o0oleomiciydlm2umu o t0 renmrcty1oatrau i t)texrim3oydopte fct t)srtruroou0olt iietatfa2em(mpnu4tlxomrciatfat livi s0 etrxmpou4ope  iciasfarurxrp;t0aptnmfetydlm uauvo;t4aexoxocta1oat  uvs (0s2xr(m oo4lmen iesasfartrxmpnu0tptoiiciltlmDumump u0trxoir3oodopD luesl()srxoio3iu4altnmietlsfsrtmu o;t0tlxoiietas mDeln s;()aexomocto1fmD ai s;()srum(opnydaptelietas)aDurxm nu1opt ifciysfm rmump t4 rtrmo3ty1fa  aiesls)s2xr(o3nu1lltnmivslt)srta(mo;o4oeeomo3iytls rlumpn(0tlxnmo3ta1fa ranei;()tetrir iu1ole mivsas) Dtmur nt1tptniietytlm2ua(mp;u4artnxrcootom   i olt)teuoxr3no1ol elnetl(fsDururo;t0olxnmieiasfm2ul(mo;u4arxomf oo1fpteaies t0t2xoxrpoodomtelfvslsfarrmumpno1opxn fcildla uanvp u0 leoio3todoatrauvo;(0texrio3nu4lp  lfctat)s2umu onu4olt mociadlsDel( s t)tlxrio3oodlpDr ueo t0texr(r ny4ape livsltfarurum oo0optnif3iadlmDumuvpnu) rxrif oodla  luesls0t2xr(o3oy1ol  mieta(fa2um(mono1alxnmi3tasla2ul(vpnt4aetrir3ty1lpDe ieo;t  rtm(mpnu1op nlies () rua(mo;o1optnifctat aDemnmp ()tleoifcia1fat livi (0s2xrxm ny4alte nvi t a2urxrpot1tlxn fetad m2uaump ()artrmo oodop eaiei s) 2ur(o3ou4llt  nci ()sDrmx pou1altn ociyt s2ea(vo;u0tlxrircoytfptr ueo t)teuoxopno4lm nmnvt t s2ur( ont4tlxn ociysfm2ulu p;u0teermf iatfa eln o;s trxrxr nu1op e iviltfartm(r ;u1opx  f3ild m emuvo;t4 reoifcoytop eaivo;(0s2to(r ny1al nlivtls  Dua(mp;t1oet  ietldlmDrlnmp t0tlxrio3oa1opDe uvo t) euoxo3iodlm n fvsas sruaurpot4alto icilsfsDuluvon()aexomf3tatopte n i ()seurxm nu1lpt  ieiltfarur(ront4ope  f3iadfsDrmnvo u4arxnmfcoy1lpDrauei;t t2xmir io4olt  ieta( sDuru  nu1ape mfcilsfsDranvp;u4aexoir tatoate ivi (  2xr(r3nydll n nvilsfs2rrum ou1tpxoio3tltls uluvo t0alxoxrciotlatr nvols0t2tm(rpoy4omeemnesltfa2uaxm oo4teto oeiaslm ra(vs;t4artrxf totlpDelu o;t) ruoimpio4omt lfvsas a2ua(mo;u0olx  oeiatfa rau p ()trxoif3iatlpt lueilt0tetr(m nudoltemfvilt)sDua(mo;t0aleo i3iltlm2elnvp t0 exrmfctodlpt lu o ()s2umxm3ou1ap nmnesa( arum(r ;o4tpxo f3tadla ea(vs;u4texoircio1la e ies;t  2xmirpoo4lm   ictlt s2rmu o;t1tex  i3ild m umumsnt0 exnirctatlm elies t)teurim oodol emietlsf ruaxr ;o0tlenif3tlsfmDrlu p t) rxomfcoy1opte uvo s0sexoir oudlme  neslt) rtmumoou1olx mo3ilt s2rlu s u4 rxnxrciy1omteaueolt)sexmxr iu1ll  mfctltf Drrurono4oeto octytfs2um( pnu0tetnmr oadfm rauesl()srtoio io1amtnmfesltfsrtmx ont4opto ieildfa2eau o () renif3oydfpteluvsl( seto(opio1ame  iesls)arrm(mo;o1aptoii3ilsfs umnms;u)artrmrciydoatrlu i (0tetoio io1optnmivsltfs2tax  ;o1alx mfciyslm umuvsn(4arerxr3oatoatrliesl( t2urio3io4omte fct sf 2um(r no0oex mi3iyd m em(mon(0tltoio todfm rlnvs;s t2tmxo3iodam emnei t s2rau pou0alxomf3iyt a2rlumsnu)tltoxo3oydopDeli s s)s2toir3iodolt mivs tfs2rm(  nu1aet mociyd a rau o;t) eerxr3tatfmD  nvil()s2ur(r no1omtemnvils) rra(rpno1oeeoioctysfsDrlu p u) lxrmo3oodomteai sl(0 2umxmpiodale  fcsat a2tru p;o0aexomfctltfs2umnmonu)tltnmr3iydfaDeaueo;()teurxopny4lptn fcsat srrax pno4olxoiieiaslm2rlump u0trermf3ia1omDrln o t srto(m3oy1lptnlfviltf rtmuro;u1oetoifeiysfm rmn pnu0 etrmrciodlmtrlnvo (0 rumiopiu1lle mfctl() Dtm(rpoo1apx iieiys mDrmn pnt) etrircta1oat  nvo t0 2xoxm ou4aptnmfciat s2rrx pno0tpxoiietat aDrl(vo;(0texrmrciytlmtelueils trtoxo iy1alenmnes s)aDtmxrooo0tet  iciltfs2rluvo;()alxoxo tytopteaueo s0s2trirpny4ol nlfei s a2umx p;t4texn fctat s ea( s;t0 etnxociodfmtrauei;()srtm(o3oy1am n ivsls)a2uauro;o4tleo f3ildlaDeanvont4 renxf ootomD ln s;t)teurio3ou1openlnctlsfsDumxm ou0tptomfctatfaDrl(mp t)alerxr tadoaDrlieo;(0trum(mpiy4amtnlici (fa2rrx  nu0olenmiciytls em( o;t0 etnxociydfatr ivs;( t2xrxm no4lmtemivias) rtm( p;t1tpx moetas aDel(ms;(0trerir3oodla r u ols sexm(m3iudopte nvsl()s2rax pnt0aeeniietys sDem(mp;u)trxrmo3oo1lpDrliei s) exr(o3iydlmeemfeslt srraxmono1alto oetatfm2uln onu4trxrxo3io1opD aivi (0texo(m oydal nlnvtltfsDrru p;u4olenifciydls uan onu)altoif ootopD an i t0s2trirpny1olte nvtlt)s2rm( p;u0teenifetldfs el(mpn(4 exnmfctytoa  luvolt srxrimpoy1lm nmnvsls  Duru pnt0alxnif3iydls umuvonu)aetoir ta1faDrlu s t)texr(r3nudlm n ieias)s2tax o;o0tlenmiciatla2ranmo u) rtrir oa1laD  n ilt srurxr nydamenlnvilt) rurxrpoo0tlto ociat
\ No newline at end of file
@@ -0,0 +1 @@
+nes ()srxr(m3ou4omtnmfvi s) 2uaxrpnu4alx mo3iltfs um(vont0 lxrxfcto1opDranvsls)trxmirpoo1oltelnvsat) Dtmxrpnt1oeenmfcilsfa2emu p;u4 exrif ia1omD aneo t0 2xrim3iudom n iesl()sDrau oot4apto ociysfmDel( p u) exoif todoat lneo s t2tmxrpiu4ameelivsltfsDraxroou1tetn oetls m el(ms;(4alxnmocoatop  auesl() ruo(r nudlm n ict ()a2ua(mpot1apxnio3ildls rluvo;t)aexomo3oydom r iei ( srtmir nu1amtnlfcils)arurx pno0ope mfciltfsDelnvo;(4aexrxo3tytoaDrlues t  rum(opoo1lme mfeil()aDtmxrono1olxnioeild a emu pnt4 rermo oy1fpDelu ols0tetoim3ny1olte fvtl() 2um(rp;u4tetomfciyd mDranvp () eeoirciydfptr i ilt s2to(o3oo1ope  fvilsfsDrax pnt4tetnmociaslm2eln s (4tleoxf3iadoa elu ol()setoxr3io4optnlfei () Dur(ronu0apxomfetls a uanvonu4arenmf3tadoa rlueol( srtmir3no1amt mncs sfarumumonu4apxnioeiltfm eanvon()trxoio3tatfpt aiei ( sruoxmpio4lptnmiviat)a2rrx  ot1tpto feiatlaDeanmont0arenio3oadlpteau o;s  2ur(o3iy4lm  lfvias sDua( p;o1tlto oetydlm eauvon(4 etrxr tytfmtrlueols0 2uoxm3oodomeelnesls sDrauro;u4tle  i3tat aDea(vp u4 rxoxrcia1fptrln sls  rxo(m iu4lptn nvias) 2um(rpnt1texoiiciyslaDul( p (0arxoir oatlaD lueo s0trxrxrpnodap nlfcsl( a2tau pou4aptomo3iasfa rlnvon(0aexrio oatlaDeluei ()t2to(mpnudom nmfesl()sDtmx pot0opeomf3iytfa rm( p;(0tlerxrctadoa elnvolt0trtrimpiu4llte fvtlt  Dumx  oo0tetnifctyd a2emnvp u4arxoiocto1laD auvo;() eur(rpiydlm elncilsfarur(moot1texo ieiytla2rmuvo;t0 rtnxrciy1lmtr ues s0t2tr(mpiy1ome lnci sfsDtax p;o4aexomfciydla2umu o t0 rxrmrcto1fm ranvs;s)s2urxr3no1optelivsls)aDtm(mp;o0tpxn o3iydfa eauvp u) rermf tatfa e ivol(0t2xmxm oo4ale  ncsls)srta(moou1opxnii3iat m um(mo;(4alxoxo3ta1lateaivo s)t2toir3iodalt mict ( sDrr(r ;t0tex  ietasfsDel(vo (0 etniocia1fmt au i;s) 2toxopny4lm nlnvtlt s2ururoot1opxnmfcilt mDulu p;u4 lxnio iy1om  lnei;(0trxrio3ny1alt  nvsasfaDumxmpnt4teen f3iytfs2emu pn(0arxrmo tytlpt luvs;s)trtmxm oydlm emnct ()a2trx  ot0oexo oeiad s2uauvsn()alxnxo3iydlaDe neo;( texmir3iydameemiviasf 2tm(rpot4opeo i3iadfs2uanvpn(0 ltrmfctodlpDeauei t0 2toir oy1alen nvt () Dumxr ot4apx miciydfs2rmump;(4tetoxf iy1oaDe i s (0srxrim3no1olte ncs sfs2raurp;u0openmo3iydfm2rmumon() leoxr oadlpDe ieo t0teumxrpnodome mncia()a2tm(rono4tetomo3tldfa eauvon(0 rerxocootfpte nvo ()t2tmxr oy4lp nmictlt  Drrum nt4tpxo f3tas s2ua(mo;t4 leomfcoa1la elnvs;t teum(m oy1lm emivt ()srtr(ront4altnmf3tadfa2eanvo (4tleomr iydlatr uvils  2um(m ny1olenmneiltfaDumum ot4aeen ieiatfm ea( o ()areoio3oy1lptraieol(  exrxrpnu1amt  ivilsf Dtmum ;t4aee mf3iydlsDrluvo u)aeerio3iadomD au ils0 2trirpiydopte ies () Dtmxr nt0apxnioetyt mDrl(vp t0 renir to1latrli i;t0 rtr(rpoo1olt mnvilt) 2rrx oot4tpx  o3iydla rlump t)teermo3ia1fmteauvo t tetoir3iu4lle mnciatfaDurum oo0aptnmi3tytfa2rlnmp;(4 ltniocio1fmtranei;t0teum(rpnydlp emfviat)artaxm nu1oet mf3ilsla umnvsn(0 renxo3tadoaDeaieils0t2uo(o oo4alte ivi (fsDtm(mo;u1aleomi3tyt a ulnmo t0arerxfciy1lmt  iei (0t2xrxr iy1ope micias)a2trxmoou0apeomietas m2ranmo;u4aexomrcoatfmt  iesl(0srto(o3no4oltnlieia() Drrxrooo0tpto ictytfs ua(vo t)aeeoxf tytfa ean i t0teur(r oodomen fciat)aDum(r ;t1tet mocild a2ranmpnu)arermf oytlp ranesl(  2xoxmpou4om e ivsas)sDua(rp;o4tee if3tadlm elnms;u)tltnmr iodfmt au s;()trum(o io4op nmfvtasfarrmxmpot4apxomietls aDul(vpnt) etnxo iodopDeanvils0s2umim3io1ap emivta(fsruaumont1tpt ifeiat s rmums t)tetnmrciydoate ues (  2xr(r3oo4lmeelnvia(fsDraxr nu4apxoioeiasls2ul(vs;u) etniocoa1opDrln s (  2umim ou4lp elietls)aDtrx ooo4ape ioetldlmDra( pnt) eenxo3todlm  anes () 2urxo ou4ape mfeiat)a2tru  oo0tptnmf3iysla ua(mp t0altnxr oo1optraneo t0s2xoimpiy1alt lfvsls arrau pnu0open ieias m eanvsn()tlenxoctytoa   ieo;s0s2xoxr iu4ll   fesa()sDrruroot1tpxn ociysfs umums () lxoxo ta1fp   ues;s trumimpiu4lptnlfesasf rrr(m ;u1tpe  o3tat mDean o;(4aetrmr3tadfm elnesl(0s2xmxr nu1op nlivs (  Dur(r ou1aexomfciydlm2rmn p;t4trtrmo iadop eln o;s  rxr(r oo1lptn nesltfa2uau p;u4aetn ietatfa uanvs t) eerirctodfpDrluesls)tetoxr iydll  lies tfsDumxrooo4oeeomiciadfa eluvont4 ltomocoatopteanvi s srxr(o ou1amtnlicsltfaruax p;u4tlenifeiytla2uauvpnt)tlxomf oydfa raies;()t2urxr3nu4amt lnvia(  2um(m ot4opeoif3iad aDra( p;()artomo3oadop eauei;t)trxrir iy4ape mfeils aDuaxrpou4apeomi3iysfmDum(vp;u0aeenircia1om   nei s0 rxmxm3nu1omeelfvilt)srurum ;o0tlto fciyt m2uln p;(4 etnif3tadoaD  neo;(0s2urxm oudap e netl() 2raurp;t4altoiociltfm elu p u) exnifciytlaDr i olt0trumxmpou1oltelivtas  rururoou1opxomictys s2emumo;(4alenmf ia1fmt auvils) 2um(opoy4omtnlnvsas a2um(mo;u1oleoio3iltls2rm( p (0 ltomfcia1lmtr ivil(  etoxo oy1amtnmivs tf 2rmu oot0oexoiieiydls2umnmpn(0trenxo iydoatraneilt sruoxopnydlmt  nvtls)aDra(m ;u1oex mfcilsla2uan p u4 reomo iytfaD  ivi (0setr(mpio1lp nlies t  2rmxmo;o0tlxnio3iys s um( s;t)aeeomf3tydomtelivil(0sexoxm oy1ap e ictls) 2rm(ronu0tltnmictasfsDemnms;u4 leoxf iy1lmD  ieolt  2ur(opiu1am nlfvs s  2tr(m ;u1aee mociydfm rlu s u0aeeoxo iytomte nvs;s)trxoiopou4alee nviasfarua(mpoo4texoifeiadlm2uanvp (0 exoxrcia1lm ranvi;(0 exrim3oydole  ivils sDtrx poo0oltoii3tatfsDrmuvo t)aleomocoatom r n i t0t2toxr3iu4ame mnvt (f rrmump;u4texoifctldls ra( o;t0alermfcoadfmtranvol(0t2toim io4lp elics t) rrruroot0aet ii3tyt m2uanms ()aexnmfctotfptraues;s0srxmxopiy1lptelfes sf rur(mont0aeeomo3tls a uanmsnu4trxrmr3todlp   neo;t) 2xoim3io1ap  mnvia( a2uauroou1ope ifetld aDrmnvo t0alxoxrctadfate ies () rxoirpno1llenlfci (fa2ur(rpot1oee  f3tld a2ea( p;t)aeermociy1fp  auvi t0s2toiopou1lm elfvs s sDrax pnt4texn fciys mDua(msnt)artnif iy1lmt aueo t)seto(r nydol elics ( aDrrxront1tpt mieiad a umnmsn()texnio todopDeau i;s teurxo oy4am   ivt tf rrau oot
\ No newline at end of file
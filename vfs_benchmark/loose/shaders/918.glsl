@@ -0,0 +1 @@
+i s t0 2xrio3iy4alenmnctatfarum(mono4altoioeiydlsDuaump u)trxrmo oodfm r ivo;()trtrxr3ny1lmen fci (fsDtm(monu4aeenmoetyt m rmn s;t0 ltnif iytomD au s ()s2xr(m nodale  fesas)s2urum ou0aexo oeiatfa2rmu onu4trtrxr oa1oateau o (0 rtm(m oo1opee nesls)srrmxmpno0oee  o3tlsfaDul(vs;u4 lxoir io1oatrlnei () 2tr(opio1op nlivtltf 2umxmonu0olx iiciadfaDea(vp;(4artrxr3io1lmDeaivi (0teurxmpio1oleemietlsfa2umx pou1ope mfciad a2rau p t) rtoircty1op  an o t)seum(r ny1lleelivtlt  Dumxmp;o4oexnii3ilslsDeanvs;(4tlerif3to1laD lnvs s)seurir3iodop n feias)srua( pot4tltnifetldla em(vpnt0trenxrcta1fpt li s t) rxrxr oy4optemnvils arraurp;t0tpe mieiadfm2elu snu)aexnxf3iotlm elivols  exrxrpiu1al   iet (  rumumpoo0olto icils a2rmnvonu4 etrmrcta1lp  aueo t  rtrxm oy4ale lnvia(f Duaum nu4aeto o3tad mDem(mpnu)alxrxo oa1lmDr ivi t t2ur(m iu4apen fet s)sruaxrp;t0tpt  ieilsfs rl(vs t4 etoxoctotom e uvo ( srum(o nu1llte ivias) Durxmonu1apt  ietydfs2rmuvp;t4arerir3ty1lmtr ivs t  2urxo oo4optnmnctltfs2tm(r nu1oetnmocild a umu o;t4trerir3todop eanes;s srtrxm3iydllte iei ( a2ururoot0tle  ociytls2eaumpnu0arerifcty1lptrlueolt) 2trio oo4olte fct t a2urumono4ape moetls m2uanmo;u)arxnmr3iotop raueolt0teuoxm3nudop n fetat)srra(mono4teeoif3tldfsDua(vpnu4 rtnxociodfp e uvs t trtr(opiu4ome mfes ()sDtrum ou4apeo ocild a ea(vo u4arxrmr iotfptelnvi;() rxoxr oo1opte feslsf 2ra(m oo1apxn i3ils sDemumon() exrmfciy1laDraueo ()teurxr3no1oltnmnvsl() 2ua(mpou1oexomoctys m ea( s;u4 rxrircoodoa ranei;t)tetoxrpiy4opeemnesas)aDtmxr ;o4apeniieiytfaDemnvp;(4 renif3todfaDe u sl()truoxm3oudal n fvs s)a2tmuro;u1oexo ieiysla2raums t4aeeomfcoa1omD  u ilt)s2xmxopiydale mivtls  2uaxmpoo4tlt ioetat a rm( p t0aexnif3io1lmDrlieo (  eto(opiudlpen nesat)sDtm(m nt1texn oeiad mDulums;t4tltrmfciadfmt aies t) exo(r3io1am  mnetlt a2trxr ;t0texniictatlsDelnvs t0trtoio3oatfa eli ol(0trxo(r3oodomte ieilt)aruaxr nt1apeoii3tyt s2rm( o;u)teeoif3oodfmDeln sl() rxrir ny1am nlfcia()aruaxm ;u1tlenmo3iad m2ea(vsnt0 rxnxociodom   ivo ( srtmxm3iy1al  mnct s) rumurpnu1texoifciyslsDrlu p;() ltniociatoaDrli i;(0srxoxr3oo4am nlneils)aDraurono1apt if3iasls rmn p t)teerio to1fat  ivol()teuoxmpoydolt mnetl(fsrurumooo1olt mfeiatlaDumn snt4alxrmr ta1fpDraneo;s)t2umxo3ou1ol e iesatfsDrmu ooo0teenif3ildla eau o;(4 lerif3oa1lp rlnvi;t0s2xr(o iydaptn fcias sDtrx  nu4olt mieiysfm ran o u4tlxrmf3tydfm eanvol() 2xm(m oudlpenmneia(fa2ra(m ;t1aexoiiciyt s2rm( onu4alxnxf oa1fptelnvsls  2umxm nu4lp emfcilsf Dtrx ooo1teto ocilsls2rm(vp;()tleoxrcoadop elnvil(  2xrir no1amtnmieslt  Duaumpoo0tpx io3iadls rauvo;t4treoxfctotomD  ivols  rxmxo3io1lpeelfcsa( s2tmumoot1opxnioeiydls uaumon()alxnif io1fptean o ( truoxopnydlp nlfeiat)s2rrxrpnt1tet  f3tls s rlu onu4 reoxo oatlaDeanvi;()srumxrpoudaltn net (  Dur(rp;u0oexomf3ias sDua(vo;u0trxrifciydfpDrauei;( sexrir oodoleemiviasf Dumu o;o4teeoiietls sDranmp u0 etomf3oy1fatraieo t0teurio ny1om elnes (  2ta(root4oeeo f3iadls2uaums;u)trxnmfcoydla  li ils) 2xo(m iodlmtelfesasfaDtrxm ;u0aleoiietaslm umumo;t) eeoio3io1lmte ieolt  rtrxr3io4llt  nctlt) Durump;o1tpxoiietydfs ea( o t0alenmf3to1fat lnvi s  exm(r iydoltemivil()aDrau ont4open o3tat mDuau ont4tlermo oodlp e iei t)trxmio iudamtnlfeia(fsruaxrooo1optoifeiasfaDrlums;(4trxnmf3ootlmDr ues;s) rxmxm3io4opt mfet (f rrr(m ou1apto ietas m rmnvp;u4texrioctatlpDrlueil()trtrxopiy1omenmncs s) Dur(monu4texomieias m uln s u)teenmocio1la  ln i;t0teurim3io1om   icsasf 2tax pot4olt ifeild a ul( o t)aexoxoctadomD  ivo;t)srtrio iu4lltelieta()a2rmx pot1tee iiciys m rmnmp;u) eenxfcoa1lmtrln slt)teuo(r3iy4ole mfvsl( sDtrxr ;o0alxoiociadfa el( pnt4aeermo oadfmtean slt) 2xoio iudlp elfvt t  Duaxm ou0opto ociydla2elnvo (0trxrio iadop e n o;s) exr(m3oo1ol   fctl(farum(m ;t0olxn iciys s ea(mon(0 rtrxr io1oaD  ueo t trurxr io4lptemfvia(f Dra(mp;t0teeomo3ilt aDrlnmp t0alenir tytlmDranvil(0teumxm3nu1opt lneils  rtau  ot1tlxnmi3tasfsDel( snt4aeeniocootoatelnes;(0s2tr(rpno4ol   ieslt) rurxrono1apenmiciydfmDem(vp t)tlenif ootoa e nes;(0 ruoim3iu1lmtn nvils) rta(mono1optoif3tltfmDemnmp t0altnio3ootlpDeluei;()s2ur(opou4op  mieslt) 2ururpno0teenmf3iadls em(ms t4 rtoif3iodfm  lu i;s)trum(m ny4lmen fetasfs2rm(moot4optnifciat a ua(vsnt0trxrxo iodfp rlneslt0srxmxopoodolt lnctlsfaDurur ;t4aptoifcild m umn p (4aetoxo3oa1oatr nvi;t s2umxm3io4optelieslt a2tr(mpno0opxn fcild s2rlnvp (4tlxomocoo1omD aues (0seurxm3oo1openlfcils aDtax onu1alx  octlslm2ra(vo ()treoxf io1fmt  u ilt trtoimpnodlpee nvi tfsrumum no0oltoifcilsla2rmums u0aetrif3iydlpDeanvilt0 rxmiopno1ol nmici sf ruax  ;u1altnifciat sDrlu o ()areoxo3ia1faDe ueslt0t2umir3ny1op e ncia() rrr( pou4alxnmi3tad s eauvon(4 rxrir3oo1op r uvs t srxmimpoo4lp   fvsl()aDumxmpnt0aetoiictlsfs2el(ms;t0tlxoxo iatlmDraieolt0trtrxm ou4lmt  ncia(  rum(mp;t1tpeomfeiadfsDemumpn(4texoio3io1oat ai il( trxrxo oudol e ivtls)a2urx  ;o4oexo ieiyt sDrmums u0texomo3ta1lat li o s0srto(mpiydoptnlivtls) Drrxro;t0oex mo3iad m uanmo;t4 eeoxo3iatlpte n i s)seumxr3oudopte ncsa(fsrta(mp;o1olxnmieiyd sDumuvp;t4aexnxrctotomt an s;s t2uoxr iudom  lnvtl()aDtmxmo;u1ole mf3tat aDrl(vp;()aeeoircty1lpD  neolt) rtr(r3iu1lpee ncs s a2ra(  ou4olt mictldlm um(vs;(0texoxo iotfaDrli o ( setmiopiudame  netas  Drmu oot1teen fciadls2rmu s;u4 ltnxf3to1lp e i i;t)tetm(o ny1ope  icslsf rtau ono1aleo feilsfs elu s;(0arerio iotfmteauvi s srtrxopno4am   fei ()a2tr(  ;t0texnmieildfm uaump;u0teeomoctatlpDrlueilt  2um(r3oy4lmeelfvil(fa2tmur ot1tlxn f3tadlsDuaumonu0aetnmo iatfat lies s)t2tmiopnu4omte ivs (f Drm(rpou0tetniietldfm2em(ms t) rxrmo3todoaDrlivi s0 rurirpoydom e iviasfa2uau o;u4tpeo o3iadfa2elnmo;t4 lxnircoa1opDrlu o;s0texr(m3nu1op e nvta( a2rmu p;o1tpx mfeils sDem(vpn(4 rxoif tydfaD auvslt0srtoir nu4olen fvsat artmumpoo1oexo fcils sDem(vonu4 rxoxr todfaD luvols srxoirpiy4al  mnei () Dtax  no1olt  o3iyd a2emn p t4aexoxo iadomt  i sls0s2ur(o3oo1lp elict sfaDuau pnt0tex  oeild m2rmnvo u4 renmr totlpDrlies s0 rxrio io4opeemfvs sfarur(rpoo1oltomictldla rauvon(4aexoxf ia1latraneil( s2xmim3oy4aleelivta(f 2ua(mp;u0apxnmietldfsDelnvsn(4tetrxr3iotomD  uvs;( s2trimpiy1ap  lfctl(  2ra( p;o4oltn ictatlaDuau s t4 eenxf oodoat  nei (  eur(o3iydllenmneta( s2rr( p;t1ope moeiysfaDuanmp;(4 eenmr iydom eli s t0 2xm(o3nydal nmfesl(fartmu  ou4aptnmietysfa2rmuvsn(4 rermr oydlmDraivo (  rurio3iy1ame liesltfs2umur oo4apxoiieiasfs2rmn p;t) ltnxfctytoaDraneolt0t2trxr nudlmte nes ( s2ta(m oo1apxnif3tadfmDrmnvon() lxnir3iy1fatrau olt)s2xrxrpny4omt miesltfsDra(mpnt4alxnmo3ild m emuvo u0aeeoxr3iatoatrlu ilt0 etmio oodlm  lfeia( artmxrp;o0tee io3ils m rmuvp t)alerifcta1lptr nvi;t) exmio nu1ol eliesa(  Dtrumono4aetnio3iat m2eanvo (0 eeoir tadfp   u s (0setm(r3iy4lme  nvtatf rrm(rp;o1oetnii3ilslaDumn p;t4aleoir iatlmtean i t) ruo(m3nodom  mfviat s2uaxrpou1ape  i3iysfsDeaump t)tleoiocio1opDeauvs;(0texriopnu4lpte fcsa()s2rr( ono0apenmfcilt m2rm(von()teenxf ootop   u ils)trxm(opio4al elnetat aDrrxr ;t1tpen o3iadls2ranmon()alenxf iydfmDrlu s;s)t2uoxrpnydam   fetlt)srrrx pnt4apt ifctytfsDeanvo t4aeermoctydfp eli olt  rtm(m3iu4optn nvsat)aDtr(mpot0tetnif3iysfaDrmums;u4trtniocoatfmDeaivil( t2trxo3iydll emfctas) 2tr(m ;u0opt if3ilt aDumuvonu)trxoif3to1laDeluesl(  2urxo ny4opee ietat)srrau  no0tptn o3tyt a2uan o (4 rtrxr tadfpDr neil() 2uo(r io1lpee ivil(  rtr( ono1tpt mfetys a rmn pnu0 ltnxo todlp  ai o;s) eurxm3no1lp nlivsls)srrm( o;u0alt ifeils m rmnmo t4 reoxociydfmt  i o t0sexoiopiy4lpenmnvia(  rur( o;o4tptomocildfs ulumo;t0aeermf iotomDe nvi t0s2tr(o oudlle  netlsf rumur no4alenmf3ilsfm rm(mon(4trtnmr oy1fpte n sls  etm(opou1om   netlsf rururp;t0tptomf3iltlm emn o;u)aeenifciytfa eliei;s  etrio iodlmtn nvsls sDumur nu1altnmiciysla2ulnvo t0treoxf iotom elu s;s)trxrir3nudom nmnetas arrmu onu1tet  fetyd s rlumo;t) rxrxoctatlpt  i o t texmxm ny4lme  neta() rtrumo;t4tpe  ieiatlaDul( pn(4 exoiocoadfm rlieo;t  rxmio oudlp n ncs (f rum(r no1apeoifeilslm2emumpnt0altnxrctadfaDrlieil( t2xmxm3oydom e fcils sruaumpnu1olxn oeiydfs um(mp;t0trerxo3todlaDraieo ()t2uo(o3ny4ol  mncsas  2urx pnt4tlenifcilt m2eluvo;()artnxr3iatfpD lies (0 rtrio3oy1olen nesat)aDrmxm ;t4aeenio3ilslsDran s u4tetnmf3iadop e neilt0seuo(m oy4ap  lfctl( aDtrum ot0aptnifeiytfs2eln snu) rerxf3iytfpDrlu s;(  euoio oy4omt mfvtls s2uaur no0aeeomictys mDumnvont0aetrxo3oydlpDeluvils)t2xo(o3nu4lmenlfciatfsDuru  nu0olxoiieiyslsDrmump u) etrxr3iydom r n sls) 2urxm3iodoptn neil( sDuaum nt4aet io3iatfsDeln snt0aeenir3ta1fmtr uei s) 2tm(rpiy4apt mieslt)a2taxr ot0aleoio3iadls2ul(vo;t4tlxomr iydfpte ieil(0seurio3iodlmtemnvi s srtrxr no4texomo3iad sDumnvont0 lxoif tatfatr u i;s s2xo(m3oy4ope lici sfarua(roou0texo ieiltlaDuluvo;u0 exrxf tatfp  lnes;s0 rxoxo oy4lm  micsat sDra(mpou4aet  oeiadla emu p u4teenmf3tydop ran s (0srto(o no4lm e fcsat  2ururp;u1oetoifctytfs2ulu p t)alxrxocia1lptr ivo;s s2toim no4om nlfcil(f ruru o;u4oexo iciytlsDul( p;u) rerxr3iydlpD auvo t t2xmiopnudlpeelnes s arrrumo;u1tetn iciltlm uanms ()aetrmr iatlm  aues;t)t2xo(mpou4optn fet () rrrxrono0altomo3tatla2rlums;t4 etomrciodlpte u sl( s2uoim iodlltn fes tf 2rr(r nu1alxomiciydfs eln s u4aetoxf3iatlpDeai o;s0sruo(r3oodlpee ivi sf 2ur(r no1tltoii3ilslsDel( pn(0aeerio tatfm rlneo s0t2toim3iy4alt mivtas)sDtrurp;t0teeoioetatfmDua(vs;t4 eeoioctotomDeaivs t  rxmxr3nodlp e icsl()aDrmu pnu4oexo o3iys mDrm(mp t)tetnmo ta1fpD li i (0 rxo(r3nu4lltelnvs (f 2urxro;t1oleo ieiytfmDulnmpn(4tetoif3tydfptranvs;s)sexm(mpnudopte fvia(f rtmx pot4tlxnmi3iltfmDuauvs ()teerir ootlaDrau il(0sruoxr3iy4lptn ncslsf Dumxr ;o1opx  oeiyd m2el(ms u0aleoio oa1fa   i s;t0srxmxm nydam  lici t  2tr(rp;o1olenmieiadfs2rmnmsn()texnmo3iydfmDeliei;t)seuoir ou4lmen ietls s2ra(mpoo1ope  oetasfmDumuvp;u0 rerif3tytfp  ai ilt0t2trxrpou1alte nesl(farrr(ro;t1oeeo iciysfa ul(mo (0arxoif iydomt anvo ()seuo(o3oy1olenmicilsf 2ua( ont0aet ifeiydfm2uau onu0areoif3iatlatr u sl( s2tmxrpnu4alenmfesls)s2urur ;o1aex ifctls sDeanmp t4altoxr todoat an s;t0s2toimpiu4opt lnes t)arta(r ou1oleoiieilt m2rmumpnu0arxnxf3iotfpDelnvi;(0t2tmxr oo1apee ics ()a2rm( pnu0tetniietydfm umnms u4arxrmf3tydomDraivilt  rurxr iudllt  ivils)artmx pou4open oeiltfa2umnmp t4aexrirciy1lp  lieo;t0sruoxo iydlltemicsasf 2rm( onu4tex if3tad sDrmnmsn()alenmrcoadfm   nvolt)trumir ou4lpt mncil()aruru  ;o0tltomietys aDuau on(4aexnmo ootlptrauvo t0 rtoxm oy1ape lnvsas)s2tmxmo;t1ape  oeils mDel(vo () lenmrciotomteaivs t  2tm(m3iu4lm emiei s)aruax  ot1opeoiiciasfm ua(vont0trenxo3todfpD li ol( s2xr(o oy4lmen nviatf rtau p;u0tptn fetldfm2emump u4 rtrmr3iytoa   u ols0srxr(o3ny4amee ivi s  rrr(mo;t1opeomoeiatlaDemump;u0aleomf tydoa rlneslt)s2xoxopoy4ol e nesasfs2uaxmpnt0tle  i3tadlmDranvsn(4aexrir3tatoptrlu slt seurxm ny1amt lfesls)arua(r ;u0aleoiieiysfa2rluvont) eeoio3iydom   i o;s  rxrio3oudlltnmieslsfs2rmur no4aex  oetlslm2rlnvp;(0 rtrmociydfaDe u olt s2tr(o3iy4am  mfvs t aDum(ro;o4tpeomfciad a2ua( p;u4texrmf3oydomteai olt0trxrir3nudaltnmfvslt arta(ront1openmoeiydlsDean on(0tlxrio to1fpDe uvi;s) 2uo(opiu1olenmnci sf 2uaxrooo1teen fciytfm ean snt0 ltrmr3iatomD lu il(0 etmio3io4lmt lfet sfs2umxroot0oleo oetys mDranvpnt4 rxnxo iodoa  lneils  rumio oy1aptnlnvs s)sDrrx  nu4olt ioeiad s2rl(vp;u)alenmocoatlpteanvo;(0t2xr(o3oudap  mietat) rtrur nt0tex iietat m2uaump;u4tetomf tadoptr ivol(0seumxr3ou4omenmivias) Duax pot0oltoiietat a rm(ms t) rtoxf ootomDelieol()s2urxo3oydopee icil()s2tmxr no1tee  fetydlm ua(vp t4 ltrmr ty1lm e ueo t tetm(m3oodapen fesat) 2tmu pnt1aeeo feiadfaDuanmsn(0trxoxf oytoaDr n o;t)trumxrpiu1lme livil()a2ta(r ;t4opeomf3iysfm2ulump t0 renxo oatomDranvsl(  exoio no4om emneils)a2tm(rpou0apenifetatls ra( s t0areomf todfpD aieo s  etm(r oy4amte fcsl(  rrrumpnu4texomfeiasfsDran p t0tlxoio3ta1faDrlnvilt t2xmxm3nodoleelfet s  rtmxrono4tetnifeias s2umuvo t0tltoxo3oydoa raneols0 2urir io4lm nlnci tf rua( pnu4tpxnmicild sDumnvpnu)trerirciydom eluvolt)s2toiopoydlpte iet s aDumur nt1aptn oeiysls2ea(monu) etrmf3ta1fa eaues;() rtmim3io4lmeemfeta(fa2trxrpno1oee io3ilslm2ul(mo t)arxoxo ia1fmDeanvs t s2urxmpiydlmenlnvsat)aDumxmp;u4tpxoiiciat m emump;(0aexnxr ty1oaDelu s t0 2to(r3no4ol nlnvsls artax onu1alt mi3ilsfa umnmp t4 lxomf oo1lm e ivo t)t2xo(m no1omen iei sfa2ta(mont1aee mieiyt a rm(vo;(0alxoiocty1faDean s;t)srtr(r nu4ope lfeia() 2uau  ot1apxo i3tas s rmump t)tltnxfcio1lateaivsl() etr(r io1omtelfvsa(  Dtrumo;o0tex  f3ias a2rl( s u0arxoirciodfatrln ils)t2to(m3iydllt mics (f Drrxr ot4aee iieiytlmDrmump;()alerir3oy1laDeaiesls0 etr(m oy4optnmfci sfs2umurono4tpeoio3iytls rmnvsnu4trtnifcoodlatelu s (0s2uo(rpiy4lptemneslt s2rr(rpnt4tet mictat s el( snt4altnxfciotfptrluvsls srtmir iudlmtn nci (farra(  nu0tex iietadfsDulnvp;u) rerxfcoo1oa   ivo;t t2xm(opio4aleelfvsl(fs2trurooo4tpxo oeils a elnvs;u4trenio oodfmtr ivsls) euoxr3oudom nlfcs ( a2rrx o;u0opt iictlt s eluvp () rtnmf tytom rlieo () 2toiopiu4oltnlnct t)arrau pnt0apxnif3iad aDra( o;u) exnif oo1oa eau s t)sexoirpnydom nlneia() rrru poo0tlt mi3iat a rl(vs;u4tlenmf oytlat  i ils0 rxmim oudom nlfes t) Dumum ;u4optn o3ias aDrlu p;t) etnirctotoaDeauei;s0 exoio iu4amte ivi ( aruax  ;u4tpx  o3iydls2elnms;(4aeerif ty1oatrlieo (0 2toxr3iu4am   nvtltfsrtr( oot0alt  fetldlm2raumo () ltoir3to1laD  nvs s) etrxrpiydlmte nvtl(fsDumump;t0aeenmi3iysla2eanmp u4aexomr3ia1fmD  ies t)t2umxm3oodap  mfeia(  2rau poo0texo oeildlsDemuvs;u4 exoxr3ootoaDe ivs;t  eurir3nodale mnvta()s2trurpot0tleoifeiyslm ea( s;t4tleoir todfpD au o;s)s2to(rpoydopte iei sfs2tmur oo1tpenmoctysfa rm(mp;u)texomo tadlp ranes t  2um(rpoy1oltemfcsl( s2tmxm oo4olt mieiytfsDra(vp;t4 renir3iatopte nes s)srxrxo oo1am elfes s)s2ururpnu1tltoioctldls uanmpnu4altoxr oytlatraiei (0srxo(o3iy1alen ivsa(f Dra(m ;u0opx iietatfm2umu p;t)tlxnxrciodlpt ai s;s srtm(opoy1al  lnctas)srtax  nu1tetnmf3iytlmDrmuvo u)texrxociatfaDr nvo;()s2toio io1oltn net t)aDrr(mpnt4oeenmo3tytls2emnmp;(4teermo3tydom elu s t t2tmxm iydap  mneias  ruru o;o4aee  ictlsfmDum(vsn(4aeerirctydlp   n o t0s2ur(mpoo1ape miesl( artmx poo0aexomfeiat sDemnvp;t0areoxr tadfa  auei;s teumxopiy4lp  mncs ( s2urxrooo1aee moctlsfs rlu s u) lerxoctatfmtranvo;t0s2tmio io1ale lncs ( a2tm( pno1oex  f3tasfs2ua( p;u0tetnxocoy1fa raueol()seumxo iu1lp elivslsfs2um(  ot0tpeoif3iasfa ulnms;(4 ltnxfctatlpteaues ()seum(r3nu1am emies ()s2tr(r nu0aexnmo3iyslm el( p;(4 leomo3ta1lptraieo;t)texoio iy4lmenmiei (fartr(ro;u0opx io3iysls2eln pn()aeenmfcoatfpte n i;t0t2um(r ou1op e iesa(f 2urxm nu4opxomfciytlm2rlums;u0arxrir oo1lm  aueo t s2xo(mpiodole mneslt)sruau  ot0apenmoeiytfaDemums;(0tltnmfcootomDrlnvo ( seur(r3nu4ol elfes ()srrm( ooo1tet mi3iad a2ua(ms;() rxoif iatfate neo t sexoiopiu1apenlnei s  2ua(rp;o0tpeoii3iadfa2ulu o t) rtoxrciodoptraueo ( seuo(opoodom nmnvtl()aDtr(mooo0tee ioctasls2uaums (0 rxnmr3ta1oat luvols) etrim iu1llte fes ( srraurpou0apx  octltls2uan s;()tltrxociatopDr i i;()s2trim3nu4alenmivtl(f rumumoot1altnmo3tydfsDrlnmo (4 exnxr3io1omtelieils0srxrir iy4ope  fvi s arta(root4tptoifctydlmDumnmp;u4alxoif ia1faDr neolt0 2xmxrpnu1ameemfet ()srurxrp;t4tlen icias s rm( o;u0aeerxocoydopDr nvo;t srumio3iodlme  ict ( a2taur ;o1alxo i3tytfm ean snt0alenxrciatfatran o t t2tm(r oydaltnmfcs t)sDtm( oot4tptnmiciysla umnmpnt0aeeoif3oydopDeaies;t0 2tm(m3iy4lp n ieta(  rtmumpno1aleomfcils a rlnvs;t0 lxnmfcia1lmDr nvilt0trxrir iu4amtemivsl()s2ra(moot4tptniictatfs2uan snu0aeeoxo3tydlmt an i;(0 2tr(o3nu1apt mnci (faDurx  ;t0oee mfetysfm uauvpn() ltoxo3iatlp rau i;s srtmir3oydalen fes tfartmurpou1alxnii3iydlm elnvsn(4trtoif3iy1la ranvo t0 rumxr oy4alt lneiasf rurxrpou0opxnmo3tydls em( p () etoxo iodop  ai o ( t2uoir3ny4om nmfvslsf Drmu ooo0oee  octls a emu p;u4aetoxr oydopD livs;t0 rum(m3nudole  nct () rtaxroou4tle  octaslmDrlump u)aexoxf ia1op ean s;s0 2urxrpio4omenlfvt (fs2ra(m ;o4teeo fciyd s2rmu s (0tetoxf3iadoaDelieo (0t2umim oy4optnmfcilsfsrraur oo1tltnmfetls a elnmo;u) rerxo ia1lateaivo t0 2xoirpoo4lleemies ( sDur(ro;t0oltnmiciysfa2uan snu)tlenmf tadfmD livslt0s2um(m iu4ape mfci s) 2raurpot0tetoiietldfaDelumpnu)tlxomf3ta1la r n ils  etoxr3iodomtelnvt s sDumxm no0opx  ictat m rmumsnu4altnirciy1lmtrai il(0texrxr ou4optn fvtltfa2rmuronu0tltomieiydlmDrln o;u) ltomociadfmDelivil(0 2um(o ou4al   neias) 2uaurp;o4opto ieildfm el( s;()alxnmfcio1oa rli i;t t2uo(r3iudlle  ict s srtmx pnt0oet  ociatfaDuauvs;u) lerxf3tytoateluvi ( srtm(m nudal nlicslsf 2rmumoou0aeenmi3tltlm2uau pn(4 lxoir3iodfa ean i;(0s2urxm oo1aptelnctl(f 2tmur nt4opxnmf3iadfsDua(vo;t0trtnxf3oa1fa eln i;() etmim3ny4lp   nvias arrax pou0oexoio3iltfsDrm( onu0trtnif3oadla  auvs t seuo(rpiu4ol   ivsat)s2tm(mont1tetniicias mDumnvs;()arenmf ia1fmt  ivilt  eumxo oy4ame lnesls  rtrx pnt0tpt  oeiltfa2umnmp t4tlerxr3oydlp r ivi;t)seumio no4ap emivsl(faDtau poo1aexnifetas a um(vs t) lxrmrciy1omDeaivil( srxm(mpoodal  mfcs t)aDrrxmpnt1tpenmiciatlm em(ms;(4trtoirciy1lptrln o;s0t2to(o io1oltemfeta(farur( oou4tleoif3iatlmDeaump t) eerxfcto1fptelnvo;t) etoir3oy1lpeelicilt) Drr(mp;u0aexo i3ilt s eln pnu)tetomo3iy1fmDeli s;s  exr(r iu4opt  fvtas s2rax pnt1opx  ictadfs uaumonu)texnmf oodoatr ivils0srxr(o3ny4ol nmivils a2rrx  oo1alxomfeilsfsDeanmonu4aeermrciodfmtean o s) 2to(opiy1lp  livia(  rraxmpno4tpxnif3tadla em(vp;t0aetniocto1fm eli ols0t2uo(r no1ap e ivia()sDra(r oo4tpxo oeiydlmDem(mont0 etrirciadfaDr uvil(0 2xo(rpou1omenlfvtltf Drrum ;u0oleoii3tlsls2ea(ms t0 eermoctytlpt li s t) rum(rpnydlltnlieil() rraxm ;t4aeen f3iat a rm(mpnt)tlxnifcoydlp rai ols0trtrxr3iu4op  lnctls  rrruronu1olx iiciytlmDrm(ms;t) rtrif3tadom e uei;(0texoir iu4lmtnlncsas)a2rm(mpno1apeoiictyt m emnvp;() eeoxr io1laDelnvolt) rxmxr nu1lm emfvsas  Dur(mp;o0oexnii3iyd aDulnmo;t0altomo oa1lmDraiei s srumxrpiu4ope  fctat)srrmump;o0oeeomfeiaslm2emnvo u0aexnmrcoodlpDe neo s t2tr(r3nydalenlfci s)aDrrurooo4aexomoeiydlm2um(vp t)alermocoa1op r u olt srur(o nodameelfesat  Durx ono0ope moeiatfa2uau o;u) rxnir3totlmtrln o;t0 2toio3iy4lmeelnetatf rtmxrono1tlt  feiltlm2ul(msnt4tlxoifcootfate u o;s0sexoxm3ou1ol elnvtas  2umu p;u0tpeoif3ilslmDrmu snt0artomo3iodfm   ieolt) rtm(r oy4ale mnct s)a2ta(m ou1optoioetadfa ran o;t0 eeniocta1laD  uvs;s)s2uo(r3ou4ape lfetlsf Drmumonu0apxoiieild m2ranvp t4tltnxo oytlatrauvi;s)sruoim nodlp   fci s)srrm( o;o1olxnmoetyslsDrmuvs;t)aeeomfctodoaDrlneilt)srxrxo3io4lptn ictlt)sDtrxr no1aptoioctad a2rau onu4arenxocoatoptran i t0srxo(r3oy4al  lfctat)srrrxmo;t1tptnio3tyd m ran s;t) exoxr tatop e n s;s)setmxm3ou1llt lnctlt)s2um(ro;u0tltniiciytlm2umu p (0teeoif oy1omDr nes;( s2to(r nudame mnvil(fsrraur no4ape mocild m rmn on(4artoxfciadla rlnvs s) etm(o ny4al n nvslsfartmxr nt0aexnmfciydlsDeanvs u0artnmf3todomtr i s;()s2tm(r oo1al  mfeil()srtrx onu4apeoifcilt aDeanmp t4aleriocootoatean ils t2urimpoodom  mfctatf 2rru  ot1tpxoifciys a2umuvs;t4teerxrciy1lmD ln i s s2xmxr3ou1ll n feil() 2umx pno0tlxomieiad s2ulums u4aexrxf oytoatrluvs;t0trum(m ny4llee fvias s2rmur nt4oet ioetys sDraums t)aetnmf3to1opt ai i;s  2xmxr ny1ll e nci ()sDuaxrpnt0oltnioctls a uau p;u4 etoxr3ootop  luvi;s0t2urim3nodomt  feilt  2ra( pot0apeo f3tldlm2ul( s;u4 rxnif3oatomtr u i s0t2umxr iy4lptelieslt)aDtaumpou0tex mfctyt aDeaump;(0aetomf3iy1opDraiesls0texrirpoydlm e nvsa( a2urumpno0tpt io3tldfa2uaumo;u)aetnif ia1omt  n i;s0 rtrxopnu4alenmicta(f 2tr(mooo0opx ifetat sDemnvon(0 ltrmf to1om elueil(0 euoir3ou4lpen feiat) rtm(m ;u1ole mi3ildfsDranmsnt0texnxr3iatlat aieols)texo(o3iu1ll nmiviltf 2ra( oou0olt  fciys sDul( p;t4alerxf3ia1oa  anvil( t2uoiopoydamtnmfcil() 2urur ;o4aeenio3iadfmDumn snt0 eenxf oy1laDranvs;t)sexmim3iu4aleelnetlt  Dta( pno0tetomiciadlm rm(vs;u)tlxnxo tytfat  nvslt srxm(o no4lltelnci t s2ra(r ;t4oet  i3tadfsDel(vo (4 lermf oydlm   u i s0trumxrpiu4lpee feil( a2ua(r nt4aleomoeiltlm ranvonu0 eenxociatla raieilt  2tmxm3iu1lm n ies tfsrtmu pot0aeenioeiytls rmnmo (0 lenio oo1fmD au i;s0s2trxopnu4apen ivtls)a2rru p;u1alto i3tadfa rau sn(0aetnir ia1omDr ueo t t2xr(m3oy1op nlnctl(  rumum ou1tee mi3tysfs elump t4aeeoxoctodlaDe neils)texoim nydlp n icils)s2rm(mpno1aex mieild a rau pn()aeeomf oo1optr neol()s2tm(opnu1oleemnvtl(  Dtmxmp;u1aet moctltfa2rauvsnt0 etnxo3iadfate n ols0s2xmxrpiydlp nmnvta() rtmu p;o4oltn iciysfs elump;t0 rxrmr3iatlmte uvo;t0trurxm3iu4apt mfctltf 2tr( o;u4aexn octadfs2ulumon(0 lxnmo oy1lm ean il() rtmxopoy4ll eliet sfsDrrum oo0aex  f3iyslm2eau p;(0tleoxo3ty1fpDeluvil()s2umxo ny4lpe lfei t)s2uaxr ou4aetomoctlsls2el(mpnu) ltrio iydopDraivo;t t2to(o oudap  lfesa() 2rm(mono4tlxomf3tydlmDrlnmo;u) eeoxr iotlaDelnvo;s0tetoxo3ou4amee fvi ()arumx  ot0alx  i3tldla uanvsn(0 rxrxf oadla e n i ()setrim3io4ap nliei t)a2ta(m oo1alxo ieild mDulnvo;t0 eerio3io1lmDelueo t0s2xoirpiu1lmtelicsa( a2umu  no4oexomfeiatlm2ran on(4aeermr io1fat aueo;(  rum(mpnydalte ivt sfsrur(mo;o1tlxnmfeiasfm emnvs u4alenxf to1fp  ai slt  2xrir nu4op nlnvta(f Drm(ro;t0aee mo3iadls2ea(msnu4artrmr3ty1omDeli ilt0t2tm(m3oy4ll  mieil( s2trurpoo4opx  o3iyt s2emump (0 etrmf tadfaDr ivo s0trtoxo iu4altnmnvsat  ruaur nu1tpxo ictlsfa ua( snu4 lxnmf tadlmD anvsl( trxmir nudame mfci (f 2rau pot1olxo oeiltlm elnms;t)trxnmr3tadlptrliesls)teuoxmpou1amtnmfvt t srrax  no1tle ifeiasfa2umnmp () ltoif tatoat ln s t) etmir3iy4alee ieil()sDraxmpnt4apt moeiydfm2emnvp;u)teeoxf3oadfptr u o s)teto(m3oodol elfvsa()aDtmx  oo0aeenmi3tydlaDum( p t4alxrmfcoadlaDeaies t) eto(r3iu4lpt livsa( a2umumono1tetoioeilt a umnmont4 renir oa1fa   uei s  2uoxm3ny4ale mictl( s2urx p;t4teeomoetatlm eau p t)alxnmr iotfm r ueils) etoim3ny1lle  fcsat  rrrxmooo1alxn icias m ea(vs u0teeoxr oytfpDeau slt) 2xrxopnu4al  mnetas) Dum(mp;u1aexo feilsfsDemn p u4altnio ty1lptelieo s  rtr(m3iu1alen fci s)arurx pou1tptnmfeiydls umnmont)trtnmf ia1opt lnvo;s0s2um(rpiydome  ncilt)aDtmumoot0texomiciydfa2ulu p u0artrif3tadfmDr uvs;s0trxo(opnodomenlfci sf rurxm nu1tlxomfeilsls2rmuvp (4 rtniociadlpD ln sls  2tr(r ny1alt lncs tfsrtax  ou4tex mieiltls2rlnvo;t4 rtnmoctotfaDelueo t)srxmxm iodam   ieils) 2umum ;u0tpeo i3iltfsDemu onu)tlxomfcootfmD  nvs (  2trir3nodopt  fvtat)arrrxrpnt1opt iocild a rmums t) lenir3io1la  lu i s)t2urimpou1am  liciat arumu  no0ale  f3tydls rmumpn(4 ltoio oy1fa e uvi s0setoim3iu4aptn fcsl()aDtrx ont1apxnmiciysfm ua(mp;u)tlxrir oodlmtraneolt texmxmpnydlme  fviatfaDtr(r no4opx ifeilt mDrlnmpn(0tetnmfciy1opteanvo t  rxo(o3nodlme  ictl()sDrr(  nt1oex  i3iasfmDea(vp t0aexnmr tadoa r uvo s0seuriopno1ope mnci sf 2tmx ont1apxnmoctldfmDrmumsn(0 rxomo iy1fmDraues s s2tmio nydol  lfcsat srtr(rp;o4tee ifciadlsDul(mo (0altrxr oo1oa  lu sl(  2umxrpiodam emfet t srurump;u0openmi3iatls rl(mpn(4aexoxfcoo1opDeai ilt t2tmim3nodal emnvsat sDur( pot1oet  f3iaslm2umums;(4 rxomf3oytfmD liei s  2tr(rpoy1ope lfvtlt)aDrrx onu1oex mfctysfa2emu p (4teerxo3oydlm e u o;s0srxrir3oydam n ietl() 2uau oou1tlx  feiadfm emums;u0trxoifcoodopteln o;()s2toxr oo4llt lnetatfsDrm(roou1olt ii3ildla emu p;()arermoctadopt anes s0 2trxopio1ameemncslt) ruaurono0olxniocils s2elums u0texoif iydom e nvs t texoim nydoltn ict s)a2urx  ;o4opxomietydfsDeanmpn() exrmrciydfmt lues s0 rtr(r nodol e ivsa(f Dtrxr oo1oex mi3tlsfmDemumo u0 exnif iatfp rlneo;s trtrir nudame lfvil(fa2rmu p;t1teenmietadls2rmuvs ()texoifcoadlmDraueslt) rxrio no1lmee icsat) 2trxmpoo0aeen oeiadla2ul(vo () renmrctadlmtr u i;(0s2xmir3oudapen fesat)arrr(rono0tetn o3tlt m el( p;u0trenmociydlp r ueolt) ruoxr io1ale  fctls s2uru o;u4teenioeiatlm2umu snt)artoio3iadfa  au i s)seurim3iu4lle  nvi () Duaumonu0tle moetytlsDrl( ont)texrxocta1lmtrlneilt0sexm(o iu4llenlici ( srur(  ;t4opeo icils s2ul(msnt)aexnxf3oydopDrliesl() euo(o nydlmtnmfvs t  2ururpot4olto ieiyslaDrlumpnu0aeerifcoodoa e n s s0srtmxopio1olenmnctatf Draur no0apxn ietatfa ulumo u0aetoif ootlmDe i s;s s2xo(r3oy1apt  feias sDra(mooo0tlenifeildlaDuanmo;(4 exrir tytoaDelnes t0 rtm(m oudom  lictasf rtr(roou0openii3iyslaDumu pn() rxoio ia1lmt  nvo;() rxrir nu4olt mnvtls) Dumurpno4apx mf3ils a2eanms (4texomr iatfmt  nvi;t)srurxopny4ame mneta( arrmxro;u0alen oeilsla ea(vp t0tltoio3oa1om elieo s0trtm(opnydome lfesat)sDrmx  ot1tpeoiiciydls rm(mont0aetrmo3tatlptr uvs s s2ur(rpoo1lmenmies tfaDuaxrpou1opto i3ils a2rm(mpn(4texoircoatlaDrlues ( seurxmpoy1llt mfvta(farta( o;o4aexoii3iaslsDrln s ()alenmf oy1fatelneo;() rxmim3nu4omtnlieia( sDrr(r no4olx ioeilt mDul( snu4 exomo3oadoa e nvilt setrxm iy1ol  lnvias)a2trxr ;u0texnmfcils aDumnvs;t4alerxrcoatfaD li s;()s2tr(mpiu1olt  fetl(fs2trxrp;u1tpxn ictld s eln o t4 etnxo iy1laDe u i s s2tr(opoo1ap emnvia(faDtaxr ot0aetomieiyd aDea(msnu4 eenmf tadomD anei s0sexrir3oodlp   nesat)arrmurpot1tleoiieilt a2rln s t)trxnxocoy1laD anvi s) 2to(r3iodol nlfvtatfa2rm(mp;u0oeeo i3tydfs ea( s () lxoio3ty1laDraues ( s2tmxo3ny4amtnlfesa( aDtrx pno4ape mfeias mDua( s;u)alxrxrcty1omt luvi;( seurxopno1lmt lncs tfs2ta(m ot0tet if3tat aDrl( o t4 lxrio3iotoate i i () rurirpoodllt  fetat  Dtrumpou0apxnmi3tadlaDeluvs (0 eerxocoadfateaueo;s0tetmxo3iydam emnvtlt arrm( pnt4aetnmictld a2um( ont)trtoxr3ia1fpDrlu sls)t2to(mpny1omeemies s) rra(mp;t0olxnifeiyslsDulnvo;(0tltnmf totomt  u i;t) etoim no1om elfcta()arrax o;u1optoiicilsls2el( p u)aleoxr oytoatrli o;() exoiopiy4al nmfvtltfsrraxmont4apt mi3iadfm el(ms t0aeenir totlptelueo;t) exrxo3nydlleemfcta( a2tm(  nu1alxnifctlt sDumuvs u) ltrmf ia1lat lu i;t0tetr(o io1altn neils  2tmxr ;o1apxnmf3tasfs2rlu p;u4aexoioctatlm rlivi t0t2xoxrpiodalenmnesl(farrmu  no0aleo fciat s eln s;t0aeermf ty1omDrli ilt0srtr(m3iodopenmivs ()sDum(  no4alx mi3iys sDum( pn(0tlxrxocoy1fmDrauvo;s)s2xmxr3iu4ol emnviat s2tm(mo;t1alen ieiysfm2uau o;u4teenif tatomtrlu s;t s2urxrpny4lmtemfci tfs2taur ;t4tlxoii3tltlmDrmn o (0 renmr io1fmt  u sls tetoxmpiydlmt mneiasf rtmxmpnu4oeeoifctld a2umuvont) rtnio ia1lpte n s;t0s2xoxopoy1opee nvsas) rurx  ;t4oltomoeiydfsDuanvsnt)texoircoy1oa e uvils trxoio no4amen nesat aDrmu oot1tpeo fciyt s2ra(vs t0tetrmfcta1fm eaivs;t)srxmiopoodamtn icslt artrxmoot0olx if3iltfa2uauvs t0aetnxocoadop rau o;s trtrxr3nu1omtnmiesltfs2tr(roou1apxo oeilt s uaumont0 rtrxfctatlaD  u o s s2toxrpou1lpenmnvil()artau  no1tlt if3tltla umn p;(0alermo3oytlat au ols)texrxm3no1opt mivt tfa2ua(rpnu0teeomoetltfm umu o (4tlxomoctodfmtran s s)s2to(m ou4ole lfeia( aDrrxr no1olt  i3tas s2em(mont)tetrxr oo1om  luvs;t) rxrirpoy4lmte fvsl()srraxm oo1openiietadla2ua(vpn()aeeomociatlm eanvi t0t2xo(r iu4lmt mnci t)artr(  no4aeenio3iydlsDulnms t)alermrcoytfpDranei s) eum(mpiy4oltn nvs tfaDtmxrpno0tptomo3tldlsDumuvs ()artoxf ty1faDe nei;s)t2trim oudlpeemncsas)a2uauront4aexnii3tyt m uanvsnt4aexniocoa1lateauvol(0trxoimpio4op nmicia( a2rrurono0alt ifctldlm eaumpnt4tltnif3oytop raues;() etrir3iy4am e fet (f rua( pnt4oltomf3iyd sDuln s () rxnif iydfaDran o t t2um(o nydalenmnetltfaDraumo;t0tleniiciyt m2rmumonu0 lenmocia1om eauesl(0t2umxo nodlmenlfcsas a2rau  ot4aex  i3iysfaDrmums t4tlxoiocoy1oaDeli sls trxoio3nydam   ncslsfsDrrurpno1opeomi3tlslm uanms;(4teeomr ootfaDrlueo (0 2xrir3ny4apt lictl( s2uax p;t1apt ii3tas mDea(mp t4artrio iotla eaivi s0trxoxm3nudlmtnlfvils) Dumu o;u0texo o3iad sDumuvsn(4 lxomo iotoatelies t0t2to(o3oo1lp nliei ( sDrrxr no4tex  fciatla uanmpnu)tltrxfcootlpDeai ols tetmir no1llen icsls  rua(mono4tleniietas aDel( p t)aexrio3to1om e nvil(0s2trirpoy1al e nei (faDumxr ou1aetoifcilt a eau p;(0trtomrctotfpDraivi;s sexmim3oo4lptemiesls arumumoot1alen f3iytfa em(vp;u4tltnmo3oy1opDrlnvols  eum(o3oy4llt lietls) 2tmxmono4tptn ocilsls ul( s;(4 etriocoadlp rlieil()s2xmxm iydapeemnci s)sDuaxroot0oexn iciltlm2ra(mp;t4trtrio tytom elueo s)s2xmxm iydlpen neias  rrm(  ;o1opeo fcilsfsDrmums () rtomf3iy1lpteaneo;t teur(r nu1optn ncs t srraxr ou1aeeo oeildla2emn s (4 ltnmr oadlpD auvo s)setoxm nu1olee feils  Dumxm ;t4tpx  f3tyt a2uluvo u) renmf totfpD  nei;() ruoio io4lmt  fcsl(f rrm( poo0aee  i3iyslaDrlu s (4 ltrmr io1opD  uvslt)srxrxrpoo4op  lnct s)s2urump;t0tlx mfciltlm em(vo () rtnxfctotom   u ol()trxo(rpou4lmtn icsls  ruaxrpno1apxn feildlmDea( snt)artnirciodopD aies;()sexr(rpiu1opee ivtat s2rau ont1ale mfciltfs2rlu o;t0arxoir3ta1fm elivol() exrxr3io1opt mncia()a2ur(mont0apxo o3ilsfaDumumonu4trxnxo3io1omtraivi;s0t2to(r io1altn ietas s2rmurp;o4optoii3ildfa2uluvpn(4 rxomo ootfa rlueols0t2tr(o no1lmtemneilt) rta(mpnt1opxo feias s rlnvp u0 leomr iadomDr i ilt)setrim3io1lmtelneias) Dtr(ro;o1teen fetltlm rl( p;t0 rxrif3oadfmD luei;t  etm(m no4am elnctl( a2ta(mooo0alt mf3iysls elnvo;t4 rtomf ta1oateaiei;(0srtmxr3oodape mfcsltfa2umump;t1aet  iciasfa rlnms u4aexoxr oatomtr uvslt  2tm(m no4opt  nctat artau  oo1oeeoiociad m2rm( o t0 eerxr oydlmt an o ( s2trxm3no1altemfvt t a2tau poo1alt mfetld a elums (0areoio3oo1oaDr n ils0t2toir3iodalte ivsatf 2uau ont1alxoioeilt m2rlu ont0 lxrxo3ootomD au i;t  rur(m3iu4lm n ivtls s2rm(rono0oee iictls mDeau s;(0tlxrifcoodfat  ieo;( srtmxr3ny1lpeelncia() rumx p;o1tlenmfcias m rmuvpnu)tetoxo io1oa e i i ( tetmio oo1om e fcs t)arra(m ;t4ape iociysfa rlnmsn(4 ltnxociodlpDr iei;( setrir3no4aptnlicsa( aDrmxmoot4tpx moeiatlm eln s;t4trtrmr tadlaD ai o;s texrir nudapenlnci t)s2tmxm ot4alt  icildfm umu o;t)aetnxfcoadfp  auvo s0s2uo(r3no4lp emiciasfs2tmxrono0olt mfctydfs em( o (4artrxrcoatom rlneolt0s2xmxo3iodapen ncsa(f Drm( p;o0tlxoii3tlslm2ea(msn(4aleoxf iatomtranvo;(  rtoxr oy1olt  fcsls)a2ua(roou0aet  ictldfa ea( s;t)alxoxfciotfmDeaueo;s0teurir3oo4opt  icslt  rur(r nu0tee ifeiasla2uaums t4 lxrxociotfaDeai il() exm(mpno1lpen ict (fsrrm(m ou1aeto fcilsfa2ea( p;u4trtrmfcootfm  lueols0srumiopou1lp e nesasf 2tmx  ;u1aptoiieild sDrmnmpn(4arxnifciatlm e u i;( srtmxm iu1lm   ieias) Dum( pno0olxoiiciydfaDrmn p;t)altnif iydoatr nvsl( srxrxm iodoltnlfes t)aDuaumo;o1tpeomfetat mDemnvon()altrxr oydomDrlues t  rurxm3iydol nmfctatf 2taxr ;t0tptnmfetydfa2ranvo u0tltrmr oa1fm r nvsl()sexo(m nu4omtn nvils)srtrumpno0alxo f3ilslsDelnvonu)tlxoiocta1fm  lueo;t)trxoimpiodllt  nctls aDur(r ou0tet mf3iasfaDrmu o;t0 rtomrcoy1laD livo s s2uoxr ny4openliei (f 2rmu p;t1oeeo i3tldfa2elnmpnu4 eeomr3tatopDrauvo;t0t2xrxo3iydaltn ivt (farumum ;t1aeeo ietas s2ra(vsnt0tlerif ia1lp eaivsl(  etoxr ny4lmt lncs sfsDrm(m ;t4apx  i3tysfaDrmnvsnt0texnxrcootomDeli i;t srtr(mpoodamtelfcia()a2raur ou4aleomociytlsDumnvo;() lxrifcoadla  liesl() 2xoxo oy4ol nlieias a2trxr ;t4apxoiociat s umumsnu4altnxrciatfa  aies;t)t2xoir3nu4am  mivtlsf rur(ronu0alt mf3tasfsDemnvo;t0tlenmrcio1lmteli o t  etr(o3oy1op nmietlt) Dtmuro;o0oeeo feiyd aDul(von()aleomf tadfp eaivi;s0s2xoirpoo1ap  mfei ()a2rmxroou0texo feild aDuaums;u4 renxfciatfmteaues s0sexmio3ny1ap  miesl()srurur ;o0alx  f3tysfaDraumo;t)altrio3totomt  iesls)s2tm(r io4lpe lfesatfaDtruronu1olxnii3iysfaDemnvs u0aetrir oy1fmte n slt0 rtoiopny1amen fvtas)s2tm(mo;u1aexnif3tytfsDuan p;u0aeermo iydomDean il( setrio3oo4lpeelicias sDtaur ot4texnioctadls2uan o;()alenxrctytlptrli o t) exoimpoy1openlnctls)a2tm(  ot0oleo ieiydfsDemu s;u4 ltrir3ia1fmt  u ol()s2xmim3no1lm emivilt  rtmxmpoo1oetn i3iad m2rm(mpnu)trxnir tatfpD  u slt0sexrir oudope mnvils)srrr(  no1olenmi3tldfa2elnvo t0artoxo3tydop r uvs t)t2xo(mpiy4lmee ivi tfartaxmooo1oexoif3ilt a2uan o t4 ltomo3iotfa  livs;()sruoxo iy1lptnlnei s)s2trx  ou0tlxoif3tadfaDra( pnu4 rtrxo oy1laD aies t)srur(o oodomtelfvtls srtrumpno4aetnmfcilsfs2ua( o;u4altoxr3tydlpt au o;s t2toxr3no4lp  lnvtat) Drrur ou1alx ii3ildls2ran s;u4 ltoxr oytom  anvo;t0 etm(m3oudap eliesltf 2tr(m ;o1olenmieiat m2elump;(0 etomfcoydfaDelnei;t s2uo(opou1om n feiat aDuaxmono0aeen o3iyt aDrm( p;t0trxnxociadoat lueils)srtr(r ny4ap  miciat)srtru  ou0aptn oeilsfm2rmnvp (4arxnir tydfpDe n slt0sruoio iodamtnmfvsas s2raxm ot0alxoioctatfm2ul(mp u0 rtomf3iytla eaneo ( sruoio nu1lpenlfctasfs2ta(mp;o1apxn iciadlmDrl(vo;()artrxfciydomt auvolt0truoxr3nodolen ietltfsDra(r ;o0tex mictatlsDul(vo u)trtrmr3iotfpDeluvo;t0 2xm(o oo1aptnlfctas s2raxm ot4alxnmf3iadfaDeaumo;()tlxnxrcoodfa e ueo s srtrxo oy1ap elfetatfsrrm(rpno0alt mfcias s2rm( ont0tetoxfcoatlaD  n ol(  exmim3io4lptn fvs t sDuaum ;t1oeenif3ils m2ulnmsnt0aetoxf iodlptrlivols srxr(m3nu1ol e feia()sDta(  ;t0tptomf3tys s rlnvon(4altrmfcootla r i i;(0 rtr(r3no4lm  mfvsltfa2urxm oo4tex  fetydlmDum(msnt)tlxrmrcty1lmtranvsl() rumim iu1aptnlnvs t) rtr(m nt4opxn fciadfsDumu o;t4aeenxo io1fmDrlnesls0 2tr(r3ou1ale mivil(faDtr(  nt1aptoifeiys m2eauvo t4teermociatfpt  uvs (  rum(r3ou4lme lnvs tfsDururonu1ape mfctydfm ean o;u)trxrxfcoa1oaDe ieils)t2xoir3oydol elneil(faDrrurpnt1alen fctldfs eanvsn(4texnmf oodoa e iei;t0 exo(rpny4am   nct sfarrau ont4aet  o3iydlmDrmn p;()aexomr3ia1lp rlu i s0teuoimpiy1lm elnetlsfsrtmxmpou4alx iictlt m2em(mp t4 rerxr3io1oateaues s0tetr(r iodopenmiet s) Drrumont1apeomoctas a2ran onu4 renmf3tadopDeluvols) 2trxrpoo1lmtemicslt  Drm(mono1ale ioeiasfm2umnmp u0aetoxf to1op  auvi;s trxoxr io4aptn icsasf Dta(  ou1oex if3ias a2ran sn()arerxocty1laD au il(0 2urirpnodlptelivtat)a2tr( onu4tetnmieiydfaDea(mp;t) reoif3totfaD lnvs;s  eumim3iodlmtn feia() 2tauro;o4olen ietysfaDua(vp;()artomr3oa1lmteli i s s2tr(opnu1amte nesa(fsDtr(monu0opx  f3iltlm2rauvp u0tlxnmfctotlatelnvols0 rurir nudlp  liei ( srtr(moot1tlxomicils a ra( o ()trenxo oy1faD ln i;t) etrim3no4lltelfvs s a2rmx p;u0altnmi3iyd sDeaumpnu0arxrif tytfpt auvi (0 2xrxr io1ome lfvtat aDtm( onu0tleoifetydlaDrlnmont)aleoio3oadla rluvo (0sexoio oo1llenmfctls) 2rrxmo;o1optomieiydlm ua(mo;u)trxrir3iadfpte ieo s0 rtr(opnydll nlfctltf rrau pou0aptnmictyt m2eau s;(4trtoifciatlpD li s s trtr(m3ou1lm   ncils s2ur(r ;t0alt mictasfsDean o;u0 lxoifcoodomt  iei ( srtrirpny1open nes s srrrxmp;u0tpeoif3iasfaDel(mo () lxrirctatop ran o;(0 rxo(rpoydopenlnctltfa2rmu  no4oltnmi3ias s rlnvs;(0aetoifcto1oatrlu o t)s2umxm3oo1olenmncils)s2rrum oo0alx ioeildfm eaumsnt4arxrmrciodfateaues;t0trtmxr iu1am nmfes (  2uax  ;u1olxoiociat m eanms (4 rxrmfctotlaD luvolt0srumir iy1op n fcs tfsrrrx pou0tet mf3tysfmDrlumsnu0artnxr3oa1lpt  ieol( trto(mpno1llenmnesas s2urur nu1tpt mfciatlaDuau s;u4arxrmf3oodfate neo () 2um(m io1lle lnetat)sDrmxmoot4aptnmocias s2eluvpn(0arxoxrcoa1lpteai o t trxm(r ou1om nlieilt) rumxrp;u4tltomieiydla el(msnt0artomo3todfpDeluvs;s0srurxr3oy4lpenlfctl(fs2tm(  ;u1tleo ieiysfm2rlumpnu)alxomo3tadfp eli i;t)s2xmxo oo1lm  lfetas s2rruro;t0alen fciatfa2uln o;t)tlxomf ootfmtrlnesl( s2urim3oydlleeliet tfs2taum ot4apx mi3iydla ul(ms;u) eerxrciodop  auvo;s seurio3ny1olenmnvtat)s2urxmono0tlxoifeilsfa2ulu sn(4aleoxr totoaDr nvolt srurxrpiydaptelnet sf Duaur no4tetnmietasfaDemu o (4alxoio3oytoa e uvs s  exmxo3iu4lltnlictlt sDuaumono0aetnmoeilsfmDrmuvo u0trerxfcio1fpDrluvolt)s2trio3no1al nmnes s)aDtruront4apeoii3ilslsDuln o u0tetoxo oodlm ean o;t  2urxr3oo1omtnlfctl()sDumur ot0altoiieiltfmDumu snu0aexrmo3tydfm rlneo s  rxo(opnudope  icils  2tmxrpnt4tpto fciaslm uanvp;u0tltnio iytopt luvs t)srxoir iy1om  lict s)srrmx  no4ope  i3iys a umnmont4 rtnxf3oadfm  lues;s  eumir3iu4om e ivt sfaDumum ;u1tpt ifctltlm2uluvo;t4 rxnmrctytlpD aivsl(0t2uoio3io1am  mncslt  Dta(r no4oetoifeiyslaDeauvonu)aeerxfcio1fp eaueo t0 etm(o3nydlm   neil(faDum( ooo4alxnmietatfmDul(vsnu0teerxo iotlaDrlu s;()tetr(m3oodlmtnlnvi ( aDrm(mpnu4olxo o3tatfa ua(vs;t4 etoxo3ty1op  aneil()t2um(m3nu4ap  mfeta(fsrta(rpno0opxniicild s2umnvs (0teenxo3tatlp rluvi;() 2to(m3iy1apt  ncsa( a2umxrpou4apt moctydla2emnmonu4aeenircoy1op  an slt0trumio3nodlp elfei s) rtmu pot0ale ii3ias a2ua( p t0 lxrifciodfat aivs;t t2xmxr oy1ameelnvils arra(rpnt4tpeomf3iadlsDrl( o u)tlxrmf3iydfaDr ueslt0teumxrpio1lmeelfei sfsrtm(rpoo0aexoio3iatfm ua(vsnu0 reoif3tydlpt liei;s)s2tmxopnudopen nes sfa2uax  no0openmi3iad a rmump;u4aeenxociadopDe ivol() etrim3iodoleelfcs s aDrmx ono4tlenmociltfs2rmnmp t0tltrxfcoatlatrauesl( teumxm3iodale mietl(f rtr(mpnu4opxoiociatfs rmumsn() leomfciotfmDe u ilt s2uo(r3oo4ll nmivsat) ruaur ;u4oltoiiciasfaDumn s u4trxoxo3oatfaDe ues;()t2umir3ou1lpeemfcsas  rrmx p;o4olt ii3iyt s umnvp;u) etoxfcta1lpDrauvo;t)srtmir iu1altemnct t  Duru  nt4oexoioeias s raums () ltrmrcto1fatrluvo (  exr(m3io4al nmnetl( aDtaxmont1tleo fciys sDulnmsn()altnmrciytop   ueo () etmim oo4lmt mict tfsrra(rpnt4oexomi3iysfa2rmnmon(0tlenmr3oatom raivolt)sexmir3iudolte fvsas)srrmu pot0opxn ocias aDea( s t)aeerxr oodfa   iei s0srtrxopnu4omeelivta( arrm(root4oex  ociadlmDumn s;()tltrmf3iadoa ean i ()srurir io4lmtemnetasfs2urxmooo0texnmo3iys s2eau o;(0aeeomr oa1fa r ivils0 2trxopoudlpte ivs s) Dumxr ;o1tpeomo3ild s2uauvsn(4 etrmociytlmte i s ( srxriopnodal nlneslt)sruaxm ;u1aexo o3iydla2uan p;u4arxoxr3ootfateauei;t) 2xrir3oy1lmte iesa(  2trxmpnt0opx ifeiydfa uluvs u0 eenif tytlp eaivs;t0setriopiydole  ies s) 2tm(mpnt4altomo3ils aDrm(vo u0artrxfciy1lptelneo t t2to(m3oy4lmeelivsl(  2rmxr ou4aetomfcils s ulu s;t0trtomr oatlpD  nesl() exmir3iydll elfcsl( srurxro;u1tpx  oeiytla uau p;()altomo tadfpDrauvo;t)tetmxopoy1omt mfvt t s2uau oot0aptoio3tydfaDrmu o;u0tetrxfciatfateli il()s2trxm3oo4openmiet ( arra( ont1texo oeiytfa2rmumo;()arxrmociodfpteai s;t0 eumio3nodolte fvs ()a2ur(rooo0tetoiietatfaDuln pnt4 rtrif iydlat luvi;s  2urxmpno4ap elictasfaDur(mono4apxo octasfs2ea(vo;(4 ltnif tatop  ln i;t0 2xrio oo4am nmfes tfsrrmu p;u0tptnmo3iydlmDulnvp;()tlxnxfciy1omtr ueolt)srxm(mpiy1am e ieiasf Drax  no0oetomo3iatlm emu snt4trtrxocty1lptrau o ( t2xr(mpiy4apeemfcs t)arumu onu1oexomfciyt s2elu p t) exoiocoytopte ivsls)srxr(m oo4altemfes t)arur(ro;o1ale  oeiatfmDrlnmp ()texoio iodoa e n o t)texoir iu4ll  lfvsls) Dua(  no0oleoiietltlaDel( s;u0 eerio iotlpteau o t) exm(rpoudlpe  ncsa(  Drr(r oo0texomo3ildfm2ua(vpnt0areoifciytlpD auvsls0setoxo io1al  mncsltfs2rr(m nu1tetnmfciytfs em(vpn(4tetrmrcootfmDraiei;(0s2ur(r3nu4lpe lfcsls srrmx  ot0oeeomo3iatfa2el( onu0trtoircoo1oa ranvi;s0 etm(o3oo1al  miesl(f 2rmx  ;t4tleo o3iatfsDem(mpnt)teerirctotom   neils0t2ur(rpiu4ll  lfctl( s2trxrono4olto ieiad a2eln snu4artrxr oydfpteanvils) exmxm nu1om emncsl(faruaxm ou4tpxoifcildlm2ul( on(4altnircty1op rai s s t2xrxmpno4lltelfcs t aDuau o;t1aptnmoctydls2rl(vsnt)aexnir3iotfatrlivi s t2tm(o3oo4alt micslt sDrmx ooo1teen feiadfm ulnvpn(0trxomo3tytlp eli s;( texoimpoodol  mfet ()srurx pno0aexn i3iyd mDemnmo;t) rtrmociytfmD anvol()srtr(mpoy1lmt mnvs ( s2taumoot1opto ietydla ea(vo t) etrio tydom eluvols s2trxr iy1olte fesls a2ur(rp;u1tpenmoeilt mDran s (0alenir3tatfmt  ivi;(0t2xrxrpiy1aptn fctas  Dur(monu1alxoio3ias s2ea( o u0 rtrxf iodoptraneo s t2xm(o ny1op emfvsat)sDumx  ;o0aee mociyt aDrlnvs u) lenmociodom   i s;() rur(o3ou4ll eliet s) rtau pno1tlx  i3iadlsDem(ms t0 leomo iatop   nvo;s)t2xm(r iu4op nlivilt arumuronu1oetnmoeiysfaDeanvp;t4 exnio3tydlat auvo t)trtrxm nodamtelncsat)sruru oot0tltnmfeiadfs2rln pnu4alxrxf iatom r i s s)srtrir3ny1amt lneils)sDurum nu4ope iiciltlm ra(vo t4trxoxocoy1omDeluvilt) 2to(r oo4openlfcs s srrrxmp;t0aeeniociyd a2eauvp u4tleoxf3oydfp   nvsl(0setrio no1ap elfes tf 2rm(  ;o0olt  oeiadfs em(mpn(0 lermociytom e u o;s0 2toir3oo1altemfci sf rrmxmpno4olxo fciyt a rlnmont4 lxnxf tytfaD lneo (  etoirpiy4alt mfeslsfaDrmur no0oex if3iyslm2rmumo (0alxoirctadoaDean olt  eurxr nudll elfvtltf rurxro;o1oltnmi3tld s2rl( s;t0tlermf3ty1fat ln o s0teum(opiudol emnviat)a2trumpoo0tpxniietasfsDua( o;(0 rxomr3ty1fm elu i;s) exm(m nu1lpe  ieta() Dua(m ou4tlxnmocilslmDeanmo t)aetrmr3tadoatrlnvsl(0t2urxopiudoltnlfet () rur(  no4ape mf3iyslm ulnmp;t)alxrif iytlpD au s;t texrirpoudlptn net s)sDrm( pou1tptnmo3iltfs2umump (0 leoxr todoa   ies;t teumxm3iu1ap  lnvs s srra(mpnt1opeoif3tlt a2umumpnu)altrircoy1oaDr ies;s  exoiopio1llt  nctasfs2urxrpnt1olx ifeilsfa ranvpnt0 etoif3oodfm rau i;t0 etrxm3ny4olenlncta(f Durxr ou4ape  ieildfs2rlnvp (0 rtrxr io1lpD auvsls0s2urxmpiy4ll e nvsl(fa2rrxm nu4apenif3tydla2ea(mo;t) etoxociatlmDr u ilt  exmio3iu1ole  nesa(fsrrrumo;o1oeen f3iydfs2rluvp t0 lerifctotlaDelnei s0t2tmxo3iu1lpe lfvi (f ruaur nu0olen ociasfa rlnmonu0aleomr oa1fp rliei ( setmio3oo1alen ict (  2tr(  ot0oex ifctyd sDrmnvo u0tltrxociy1fmDr u s;( s2xr(mpiy4omenmfei (fartmu  ou1ale mieildfmDel(vo ()arenxf3totop ean s s  exrio3oodllen ict (fs2rru  ;t4tlenioeilsfs2rm(mo u0 renmf oytla rluvs s teur(m oy1lltnlnvilt  2tm(m oo1tpx ioeiydls2uanmp;u)trtnifcootoaD  nvol(0 rtoxo ou4omee fcsat)aDrrxrono0optomictyd s rluvo () ltrir oadlaD ai ols)seumim3nodlmenmiciatf rra( o;o4tetnmfeild m2rm( onu4tetoxrciotopDean ol(0trxriopiu1amt  nesltfs2ur(m nt0oet ii3ild mDulu p (4treoif ty1fpt  ivslt)t2xmir3oy1lmtemivt s) 2ta(m ot1tpxn fctyd mDumn pn(0 rtniociydlp eauesl(0 etrimpoodom n icsas arrmxmp;t1aexnmi3tadfsDeanvo u4artrio3totlatrlnesl( t2xrio iodapte ivils aDum(rp;t4tle mociasla2rlumpn(0 exnmr ta1laDraieo;s0seuo(r nodomenlici s sDtax  oo0texnmoeiysls elu p u0 exrmo3iy1faDrlnes;s) rto(m ny1lptn fvia()a2rmxmpou1aetoio3tasfa2ulump t4 lxnmo iodlp elies t) rtrir3nu4al n ieta()aDrruro;o0tee  iciyd m elumsnt4trxrmo io1oa rlu s t) exo(mpnodol emici ( a2ra(r nt0tex ifcilslsDua( p;u0 etoxfcoydopDraueol()s2urio3iu1op elies s aDrru pnu4tpt mf3ildlm rl( o;(0trtomfcia1laD an o s0s2xrio3io1ameemivs ( a2tm( oot0oeeomiciatfaDeau s;t) eeomf3iy1fm eaivi;()seurim nydapt lfvsls) Dta( p;o4olx  f3iad a2eauvo;(4texnxo oo1lmt li ols)s2uo(o3nydopenmnet tfaDraxmpou0tpe  f3iydfaDrau s;u)aexrir3ootopte ivi;(0srtrxr oy1lp emicsl( arumx pnu0tpen oeilt a ra(mp;t0 eeoxocoatfp  lieo;(  rurio ou4openmictas) rra(mpoo1altn fctltlsDemu s;u0arxnif oa1lmDraieo;s  rtrim nudap nlfvi tfsrrmxmo;t0opeomfcils m2rlump ()artoxf ty1laDrai slt)texrim3iudolenmnvil(farrm( p;u0aex  iciat m2umn o;u)aexnmr3ta1fpt aivs s s2umir oy1op e iet ()sDumxm oo1aptnifciltfaDulu onu0trerxo3io1opD lnvil(0s2um(opoydlltnmfct s) 2rmumoot1aexnmfciasfsDel(mon(0tetoxfcoo1op   i s;t srtoxmpoy1amte fvtas)arurxr ot1apx moctydlaDrmump u) etoir iotlpD lnvo ( sexmxo3oy1lm   ncsas s2ra( pot4tet ifctydfa eau s () etomo ia1fmD li o s) 2tmir3iydll n nvi tf Dtrur nu1aexniocild aDemu o t4aleoxo3iytfp elieilt0texoxo iu4ll nliviat  2rr( oou0alenifctyt a rluvsnt4 rermf to1omDr u s (0seurxr3nu1optelfviat  rtau o;o0texo oeildlm elums u0aeeniociy1fmDraiei (0teum(rpnudopen fviltfsruaxrpno0tet  oeiydlsDua( pnt0 lermociydlm   ivslt0 2xm(opoy4lp nlfet (f 2tax pnu0apt  f3iytlaDranmont4 eerio iydlmtr i i ( t2toxo no4amtnlfcsl( s2trxr ot4tetomoetatlmDuaump;(0artnxr totop elu i;t)s2xmirpny1olt  fctlt) 2taxmp;t0teen i3tadfm2ulu s t0alerxr tytlmt luvi t) exo(rpou1amee ivtas) Dtmumpou0altoiociat s ul( s;t4alxnmf3tatfpDrlnes;(0 euoio ny1omt mictls sDtaxmo;u0alt ifeiltfm2emuvp u0tltrxr3tytoatelieo (0tetmxopiu1aptn fcil(  Drmumono4apeo fetld mDua(ms t0trxrmr3todop r ivi s)trxrimpou1ll emfes ( sDraxro;o1ope moeiysfaDel(mpnu) exnmr3iatfaDe nes s0t2to(m ou1lleelict t) 2ta( p;t0apxomocilsfs2eanmpnt4 rtoiocoodlpt aies;(0 eurimpno4om emfvs tfa2urum nu4oetnmfetlsfmDrl(vo;u4 rxrmocoatlmt  nes;s)srxmxo3oodoltn iesa() 2uaxrono0tlxnioctaslsDrm(vs (0arxrxoctadoaDr nvils) etr(r3ny4op elfctlt) Dururo;u1opt ioctytlm rl(msnt0arerif3tadopte n il()setoimpoydapteliesat s2rmu oot0alxnmietysfm2rm(vonu0 renio3oa1fmDranvil()trtrio3iu4alee fes t  rrrxmo;o4tetomfciysfa rl( s;t) eenif oadopDelnvils0srxmio3oodlltelnvtlt sDrr( o;u1oltomi3tysfm rm(vo u0 rxrir iytfpDrauei;(0 rxoxrpou1ape  ieiat  rrr(r oo1alx mociadla2elnmonu0 rtnifcoo1omD au i;t) etmxm3io1lpee fet ()a2uau ooo1tpxomiciasfa2ea(mon()trtnxr3oy1fa r uei;t)t2tr(opny4ape mivsa(fsDtmx  no0teenmoeiatlaDelums;t)trtrifctadfmDrlnei;s)seuoxo ny4lptnlict t  2raumpnt0olx ioctydfm emump;u0 exrxo3tytfp e n sl()trtoxr iy1al elncsls  rumxmo;t1oeenmiciatfa eln pnt) eeomf3iatfmDr i o;(0srxr(opnu1lm   icias a2ta(  nu4apxoif3tys s2rau pnt4aetoioctytoa   nvo;( tetmxo oy4alenmfetls)aDrax p;o1aptnioctlslm2ra(msnt4 lxrif3oa1oaD  nvs s tetoxm3nu4lle  ics s) 2tax o;o4oltnmfeilt sDul( s (4tlenxrciydfmt livols0 2to(m3ny4lp e fvsa(f Dumxr nt4openifciytla2ua( s ()trtoxf tatfmD lnvi;s) exmxm iy4lle mfci () Dur(rpno4tle if3tlsla2ulnvs;t0artnxo tydlp raivs (0 exm(opiudlmtnlivta()a2uaum nu1aeeoio3iadla eauvp;()artnxo todfp rln s;s0sexrio3ny1openlivi t)sruru pot0tpenifciytfaDeln p (0 etomo3oy1lmDrlies;()t2to(o iydlptn ncta(  2uaum ;o1tltnmoetasfm ea( s;u) etnir3iy1lmt lnvi s)texmxmpiodlme licil(fsDuru p;o0altnmo3iatfa eluvpnu0 leoxo3oatlateluvo s) 2xmio3nydole  nvtltfsDurx p;t1alxnii3iasfm2uanmsnu)aexrmfciotoateluvs (0trxmxm oy4llte nesa(farurum ;u1tltnio3tas sDemnmonu4 eeoxr tadfa  li ol( trtmxm iu1omeemiei (farrr( p;u0tptnmoeiydla eln s;u4tlenif3iadoat an o;()sruoio iy1llenmnctls aruauro;t4aeeo fciltls2ra( pnt)aleoir iatfa  li i t0trxrxrpno4ome mivs sfs2rm(mpnu4aeenmi3ils a2rmn o;(0aleomr3tadop   uvols s2toxopnu1om  lietat)a2um(m oo0teeoiocias aDrmuvp;() rxnmo3tadlp rlieo;t) euo(r3oo1apt lietl(f rurx  oo4opeomi3ias mDeluvp;(0 renio3iy1faDr neo;(0t2urim oydopt micsl(fsrtmxrpou4alenmfetyt a eanms u)trtrirciotlm e uvo t  rxr(o3nodlpeelnct s)a2rmu p;t4tpxoifetldfs rl(vp (0tetoxrcia1fmtr n s;() 2tmim nydame lfvias) rurx p;o4tlxoii3iysls rm(mo () lenmocoodfa eaivol() euoirpnudllen fci tf ruaxrp;o1opeoioeiydlm2ua(ms u) rxrifcoydlp ranes s trxo(r3nydopt lfvsls  rrrxmpno0oeenioctyt mDulnvo (4teenmr3to1oatr i s;t) exoxm3iy4ll nmfetas  2tru  ou4oeenii3iysfs ra(ms (4artoxfciodoate u i;s0s2uo(m3nu4lpt mfeta(  2rrur ;t0opxoiociydfaDea( snu)teeoxocoadla  aiesls0 etr(r3iy4lme mivsa(fs2taurpnt1aexn feiyd s rlnmp;(4alxoxfciodlmDe iesl() 2tmirpoodopte ietas s2rr(mooo1opxniictadfs2elumont0 rxomf3ootfptrlivs;t  rtoxm3ou1al  lfvsat) Drauront1opxn fciat s2uln o (0 rtnifctadlmte n o t trumxo3oodoltelivsat)s2rax ont1ape mociyt a umnms;t0alxoirciodlpt luvolt  exrirpoo4ll nmfcia( arum(moou1tpxomoctlt m em(mpnt) rxnmo iodoatr neo t)trumimpnodapt lnetls arur( oou4opxo f3iydls elnvs;()alxrmr oodfm e uvi;s)s2uoxr iodam n nvil( s2rrurpnt4texniietldfm eauvo;t4trxrmf todfpt lues s)t2uoxr nu1ameemnvsl() 2rm(m nu1tee moeildlm2ean snu4alxnmo3oytlatraivols srto(o iy4amtnlfesl() Drmurpnt0opxo feias m2uluvp;t0alxrif oa1oatraivols) 2tm(m3oo1optn nvsatfs2urump;t4tpeomf3tatfs2rmuvo;()trenxfcia1fa  lu o;s0tetmxm3oodalenlicias) 2ur(ront4tlto oetyd sDua(msn(0texoirctytlpDrlneolt0sexrio iy1openlncsa() Dtaxroou1apxn ietltfm rl( s ()arxoxr3iy1lpD ai s;t)srxmim3nu4am nmncias) 2tr(mpoo1oeenmieiltfaDuan p u0texnxo3iytlmD an i (  2tmir nodlmen netl() 2umxmpot1olx iociydfs ean o u)tleoif tatfmD lnes s0t2tr(m nodap  mfci tfartrurono4tlxoiietysls elu o;t4 rtrio io1om  livo t0 rxr(mpoo1am  lieils)arrrur no1alx mf3iltfaDeanvs;() etoxr iotoaDelnvi t sruoirpnydlltemiviatfsrrrur ;t1teto o3ildla ua( pn()trxomo ootopDrauei;( seum(r3oy4alee iciatfarum(mo;t0opeoif3iad s2ra( snt4 renxf3iatlpDe i s;s seur(m io1al nmies ()srurumonu1oexomf3iat m2ulnvont)alxrmocoadlpD  n sls0seumxo io4amtn fvi ( s2raurono0teeomfciadls rl(mp ()arxrmo3tydomteai o;(  euoxo3ny4amenmics s) 2raxmooo1aptnmo3tatlmDrmu o t)artrif oa1lp e nei ( texmir3oo4aptemfviasfarurxrooo1aexomictad m em( o t)tltrxfcty1fmD liei;t)srumxr nodaltelneslt  2ur(r oo1tptn fciaslm2el( s;t0tlxnifcoodopDelnvo;s)trtmir3iu4ale lietls aDumxro;o1tlxomf3iat s em(mo u4 etoxf3iadoaD lu s s) 2trirpoo4lpt lieilt) 2taump;t4teeomo3iys m rmnmo u0texnmr3oa1lmD  i i;s) 2tr(o3iodlmtelnetlt) rurx  nu4tpen ieiltfaDel( p t0 lermo ty1fpt lneilt0setoir oy1lptelnetatfaDtru p;t0aexnioeiyd s umnms;u0 rxnxo3totfmDraies;(0sexrxm3iu4apeemfvi s)arurxr ot4ole mfeiaslm eanmpnt4arenxfcootlpD aues t0t2tmir iodame mnvias sDtr(mp;u4olt  i3iasls2ranvs;t0 exrxo totop  ln ols0sexoir no4aptemicias s2ur(rp;o4apeniociad m emnmsn(0treoxfctytomt an o;(  2ur(m3iu4olenlictlt sDururpno4tpxoifciatlaDem( o (0 rtoiocoatfat lieo;( s2xrxopoudolt  nvta(fa2urur ot4tee mfetatfs eluvp;u0trtrxo io1fat lu slt) rxoiopiudlle lfctl( srururoot1olxn oeiad s2rm( p t0trtrif3oo1lptraieo s0s2to(r ou4lpt  fvsat) Dtm(m ot4aleo o3iyslm um(monu) lxrmf ta1fm r uvo;( s2uoio nudll nmnct (  2tmum oo4oee  feiltls2eau o;(0aetomoctadlmt au sls0trtrxo3io1lm emnctas  2uau o;u1apxo ietls m em(vont4 lerxf oa1laDe uvs s t2ur(r3iudoptelneil( srtru  ;t0olx mf3iyd a ul(vsn(0 lxoxfciodlatraivi (0trxo(r nodopte ictatfs2ta(r ;u0apx  o3iat s rmu s;t4 rerif3io1op e ieil(0s2tmxo oy1op  lfvilsf Durxr ;t4oex  ociysfm el( snt4 ltrif ootlmD li sl() exmxr3iu1ope  fct ()s2tmxrp;t0tpe  ocils mDem(vo () etnmf3oydfmD  ueo (0 exoxr3ou4olee ict s)srtmxmpot1opt mociatfmDulnvs t)texoir3oa1omt lnes (0t2ur(o3nu4lptemfvias) rua( onu4tltoif3ils s2rm(mo;u0 ltrxrctadoa  lu o t seto(o iy1lp nmieia(fsDraxm ;o0tptnif3ildlm2rln snt4 etrxo iodlaD li s;s  euo(o3iu1alt  neilt a2rau  nu1aeenmfetytfm emnvp;()artoifcoydopD  i il( trto(o3iu4opt  nvi t) 2um(r oo4apeoiiciltfs2elnvs u) etoxo totlm  auvilt)tetr(mpiu1amt lnvs (f 2rrump;t4oeeo iciyslaDuln snu0 rxnio3totfatrauvo t)srtoxr iy1lpenmict s)s2ur(  ;u0oexn feiydfm2em(msnu0artnif3iydfmteauei;s)srxr(o nodomee fvilt)a2rrum ot4apto f3ils aDrlums;u4treoifcoytfmteaieils  eumim3iodameelies s)srrmx  ot0tpen ocilt m ea( o u4alxnio oytfaD  i sl(  etr(m iu1amtnliei ( s2raump;t4tlx  i3tat aDranmont0trtnmf oo1laDrlivi s0s2urio3nodamtnlies (fsrrax oou1alx mf3iltls2el(ms;t)aeenioctydlaDe nesl( seuriopio1lp   feta() Dta(  ot0tpto ietlsfm2em( s;u) renxrctotom raues s  rxmxmpno4amenlnvtl(  2tm(ro;t4apt iiciat s rmump;()tetrxrciatoa raiei;( s2uoim oy1lmen nci () 2ua(rp;u1tlxo f3iysfmDemnmp () etnmf oy1lpDeauvi;t) 2toir3iudamtn fctlt  rua(mpno4tet mfeiatfs2rm( pnt0 rxnmf totoaD lies s)trxrxo3io4apt miciltf rtr(r oo0ope  fciltfs em(ms (0tlxomr oodfptraivo t)s2xm(r3nodomtemics () 2umx oou1oexomociaslsDum( p t4trtoxf3tydopt aivo t t2urir oy4llenmneta(  rrrx o;u0ope moetytls2eaums (4trerxr oodomD liei t0 rtrxmpoy4oltnmfes (f 2ua(ro;u0apt  iciasla2ua(mp;t)trtoxo iodlp rlnvilt) rxoio3nodape lnei tfs2um(mp;t0ale mieils aDrmnmon(4 lxnif io1lmtelueo;t0 rxoxopiydoleemnvta( srra(root0tle moetatfs2uau p ()artrmr ia1lp r neols0 exo(m oy4ll emfvta( srtaum ;o1alto feiat mDrauvont)aetrxr3iotlm ranvo;(  rtriopnu4lmtemictlsfs2ta(r oo1apeomi3iaslm2ran pnu) exnmf3ta1oaD  uei s  eurirpnodlpe miesa(  2tm(rono0olxomfcilt mDrln sn(4arerxociadop e ieo;(0 eurim3iudlpe lictat) Drmu poo0apxomictltlm2eln p t) ltrir ty1oaDe nvolt seuoir iydalenmfetl() 2rrxr nt4tlxnmfeils mDul(vo u0tlenir3ta1fmDe uvs;t t2uoxm ou4olenlfes s srrrxm ;u0tltn feilt a2uan p;u4tetomoctytfate i o;s0trumxo iy1lp nmfcs (  2uau  ;u0optnmi3iydfs2elumon(0trtoio3oydfmD livi;(  rxrxo ou4oltelncilt s2tmxrp;t4tlx iictatfm2elnmp (4artnio ty1fp  lues s)trxr(m3io1altnmnvt s a2ta(rp;u4open fciytlm2ean p u4 etrmr oatfpt  ueo;s) etoxopno1lpt lnetatfarraxr ;o0oeenifetysla emu pnt4aeermr3oytfpDelu sls)srurxm3iudlpe  ietasfsDta(m no1alt moeiadlm ean on(4aetnir iatoa   n ol(0t2toxm iu1ame mnvt ()s2rmu o;t1aet  i3ildfa2uan snu) rtrmr3oo1lp elnvols s2xmxrpnydomenlfeiasf Dra(rpno0aexnifciasfa2eanvo (4altnxr3iodfptelu i ( s2um(m nudomeelfesas sDrrxmont0oetn feiatfaDum(vp;u0trtnir3oadfa rlu s;s0 2xmxmpoudoptemivi t) 2tau ono4aeenioctytfaDrl(monu0artnxf3oodlmt  neo ( truo(m nydope mnvsa(fs2rmx pot0aptnifeiadlm2uanmo;u0teenifcta1la   n o;( sexmxm3ny4lpte fvsls) rtm(mp;o4apxnif3ias aDea(vp (0aeenxf to1la  au o ( srum(opiy4al nlieta(fsDum( pnt1teen f3tasfa2ua( onu0teenxr tadlmDr n o ( tetmxo iy4alt miesasfs2trx  ;o4tpxo i3iyd s ulums (0 rxrio3ootlat  neo t0 rtm(opnudoptnmfesatf rurx  nt0oltoioctlt mDrmumpnt0 rxoxf iotfatraues t  exm(rpnodaltnmicsasfa2rm(mpnu0tleoifcilt sDrl(vs;(4aeenmf oatlp eliei ( seurxopnu1ol nmieil(fa2rmur ;u4aee  o3tatls ua( o u4teenif oytfmDelu o (0sexm(r3iudoptnlfesatf Dtrum nu1tlx mo3ilsfa rmnmp (4treoir3totoaDe uei;s0trtm(mpnu4al   feiatfsDurx  oo0oleo i3ilt sDrmu o t4tetoxrcio1oateai ilt0 rxoxo3iodlmt lfvs t)s2uau onu0aptoii3ias a2ra(vsn(0 etoif3tadomteauvs;t0 exrxm3ny1amtn net tfa2taxr ;u4aee  oeiyd aDum( ont) rtrxfcoy1omt an i s)trxo(m io4lm elnetat  rua( ont0apx iiciadls2uanmo;t0 ltnmrctydfa r uvs t  ruoir3ou4ope  nci t  rrm(  nu1aetn ietysla ua( p;u0 reoxo3iatlate ieol()seum(o3io4omenlnesatfa2rrxrooo4oexomiciatls ulu o t4aetrxfctodfmt au i;s0seuo(opoy4amtemfeiat  2rm(rp;u1oexnmi3tlsfs ulnmon(0tlxrio oo1fm eaiei t s2xoxmpoydll nlfetltf rumu p;u0tpxomoetydfmDuanmp;t4tetrxfctytomtr n sl() euo(m3oudol  lnei s)a2trxr ;u0olt  i3iyd s emumsn(0alxrmf iydlmt li olt s2uoxo ou1lpt lfci t  rtrx ooo1apen ociltfm rln p u)teenmo3ta1oa raies;s0 2xm(r ny1lp  licsls)aDururpou4aet ii3tls m elnvp;()aetrxocoodoatrauei t0srtmxm3nydlp elfes sf 2rmurpnu4tlenioeiyslmDran s;u4aetnmoctotomt livi (0teto(r no4altelfvsltfaDrru  ot4aet mfciatfs2rm(ms;t0tlermo3iydoateli sls)teuoimpny4ap n fvtas)s2tmur ;u0tltn oetaslsDrau s t0trtrmrctytlat aneo;t0 rxrir3oudomtelict (f Drmxrpou1tptniociltlmDea(ms;u4 exomf3iotfmteli sl( trxr(o ny4ame  nvtat) rtm(rpoo0olt moetyd s2ran pn() leomrctatoatrlueo;t tetoxm iudamte nvi () rra(r ;o1tlenif3ias mDrlu s u)teeomf3oatom e uei;t0 rumio nu1ol nlncia(faDua(mpot4opxoif3iltfmDra( p t4 lxrircoatlmDe n s (0s2toxrpiy1amt lfcsatfsrrm( pot0teen fciyslaDulnvo t0trenmr oadfmtrai s;t srxmxmpiu1aleelnvi tfsrrax o;t0apx moctlslaDelnvs u) rxomf ootlm eauvo ()srxo(rpno4am nmfvtl() Durxrp;u0tpxomf3iydls rluvo;(4aeeoxr3totfaD  ueil(0seurxrpnydopenmfeil(fsrur(  nu0tpxnio3tad mDranvs;()altrxr iodfpDean s;s0setrxr oo4am nlfct t)aDta(mpnt0olxnio3iasfs uauvs;(0 etomo oodlm eli i;s srtr(mpoodopenlfvtat)sDum(mpoo4tpe moeiydlsDel(vs;t4alermf ia1oa r ies;s trxmxr3nu4op elfcsatf ruru  ;o4oexomfciyd a eau pn(0artoio3tadfat auvilt) 2xrxo oodoptemnvtlt) 2taxr no0opt  fctadfs2ra(vpnt0arxnmoctotoa r ieo (0 exoirpoy1op n nctls)a2trxr no0alxomoeildfm2um(vo u0alxrir oadlp  aivs s0teurxrpno1omtnmnesas)arur(root1apxn ieias m ea(mont0aetrmr totlatranvs;t)sexrirpiu4omtnmfetat)a2tm(mpno0oeeo o3tydfaDumu pnu0areoxo tytopte u s s  2urxopnu1lpe  ictat)arrax  ;u4tpxniiciyd a ean pn(0 rxoioctodoat  n slt0t2xoxmpoy4altnmivsasfs2trxmoot4opt if3iat m ranmpnt0tlxnifciy1oateau o;( setoirpoy4amtnlivsls  2raxr ;u1aex  i3iatfaDumumo (0trxnxr3iy1faD ln il()tetrxr3iudam elict (fa2trxmo;o0aexoifciadlmDrmnmo;t) renmo oo1fpDeau i s  etm(rpiodaleelicsas aDtaurpot1ole ifeild mDea(mp;()altnmf iydfp raneil(  2xo(r oudap emfesa()sDtruro;o4tet  octas m2emnvsnt) lxrioctadfm  au i;s)s2xm(r3oo1ope lfeiltfarumu  ;o4tpe  fciysla ul(mont0 exoxf3oo1la  aieo;t)srxr(r3iodap e nvsat  rururpnu4olx  f3iltla ul( onu) eeomoctodfatrlnvs s)setmim nu4ap   nciasfarurur ;t1tpxoii3ilslaDulums;()aeerio3iodlp  luvi ()texo(m ou4al  lfcs () Duax pot4alxo icilsfsDuanmp ()texrxrctadfaD  u o;(0setrir oudaptelfvt (fsDtm(mpnt1aexoifetydfs2eanmp (4teenmr3todlm e n olt  exoirpny1lm  mieslsfs2ua(  ;o1oltomoeiatfs2um(m
\ No newline at end of file
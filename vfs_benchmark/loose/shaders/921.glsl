@@ -0,0 +1 @@
+nei t teuo(m iu4ol e iesa( s2rmum ;o1openif3iad a emnvs;u)aetrir oadfm eli ils  rurxo io4al e netlsf 2rrurpno0apx mf3iyslmDrluvon(4alxrmf tydomtrlu o;s)texoimpou1ole mfvi (f rraur nu4tetn o3iltfs uln s;(0 leoio iodlmD aueil()s2um(m io1olte ietl(fa2rrx  ;u4oetnmoeiyt m rlnvo;u0 etoxr oodfmD  nes s0 rur(rpny1ap n nesasfa2rmur oo0optniieiysfmDemn snt0aetoifcty1oaDrlnesl( seurirpnu1lpte fvs (farraum nt4teeoii3tls aDul( s t0trxomf3todoa eauvi;()t2ur(r3ny4aptnmiviatfsDumxm oo0tpx io3tydfaDel(mp;u)alxrxr totomDraiei t t2xoir3oy1olenlieta()aDurx oou1oeen ociasfmDumnvpnt4altoio3iodfmDelneol(0t2ur(o3ou1lmenlfcta(faDurx  ;t0apen o3tytfm2rln onu0tlenmo iytomt  nvo;s srtoxopnudll emicslt  Dua(root4oet mi3tas sDrlnms t4teerio iytomDraieo;s) 2xoirpio1opt lfvt (f 2rrumooo0opeo oeilt s2eaump t4aexnxo3oatfmte ies;( srtmir3oo1lmtnmfei t  rtax p;t0ope if3iltlmDrauvo (0tleniocoy1lpDelueslt0s2urim3iy1am emfvs tf rtrxr ;t0tpe iictaslmDra(vo ()trxnir3iotla  aueslt  rtmim oy1lltemneia()a2rm(r ;t0olx ii3ilsfa2elu pn()aexrmr oo1oaDeauvil() etmxopiodlltn fviasfs2rruront1tlx  iciad s2elu ont)aetoxrctatfpDe ieo;t  rxoxrpio1amenlieiasfarum(ro;u1aet iociasls eanvsnt4aetnmr3iotomt  ieo;s0tetrir3no1om nmnvilt a2tr( pot0opxomo3ils mDrl(vont)teerxf3ta1opDrln s;t)t2umxmpno4lptelnctat  Dra(m ;t1texomfcilsfsDemuvp;t) ltomrciodomte nvsl( s2toxm ou1omeelfvs tfsrua( pno1olxnio3iysfsDel( snt0alxrmr3ootlm e neo ()trxmxr3iy4lmenlivslt)a2um(  ;o1olxnio3tldfaDumn s () etrio3iy1lat  ues;(0s2tmxo no1ol  mivsatfsrraumo;t0alto ieiatls rau p;u)trxomo iotlpD aues;t s2umiopnydop e ictl(f Dumu pno1opx  oeiad m2rlump;t0tltomr3ta1lpD ln s t0srurxo io1ll nmfcs t  rur(m ;t0oexnmfciyslaDea( o t)artrmrciydopt li sl(0seum(m io4ll eliei t s2uaumpnu4teen o3tytfs2ea(mont) eerio3oydfat aivo t0setmxmpnu4am e fvs s) Dur(root0alto ociysfmDem(vs;t0treoir ia1lpDrau i;t0trxmxopiy1om e fet t)a2ra( pnt4altnmoetad sDelumo;t) exomr3iy1fatr uvo;s0seuoir3io4lp e ncs ( a2uaump;t0tpen fetat sDea(vo;u0trtrmo3iydfm e ueolt srtrio3iy4op   fesas)s2rmum nt0tlt  feilsla2umu p;t4 rxnxo3oydfpt lu o s0seurim oy4ap  mnvsat) 2rm(r ou0alx  ictls s2eanms;u0tetrmo3tytfatrlueo;(  2xm(o oodlp nmivsa( arumurpoo4aleomieiytfs2umump t0tlermf3iy1opD aivi;s) etrxo nydamenmneta( s2uru p;o0tle  o3iyslaDrluvo;(4texrifcoy1fpteai o;( texoxo3iu4ll  livs ()sDuau onu1tlxoioctasls eau o;u0aeeomocoa1faDeanvi t)srxrimpoo1aptemfvi t  2uru onu0alxo ieildla2emu onu0teenxr3oadop eaues ()truoxm3ny4oleelneiat s2tmumpoo4tpeomo3iasfaDrmump u4tleoxf tadlaD aiesls0seuoio3iudlp n fctat)sDtrxm nu4opt ii3iysfs2rluvo u4tetnxo3iytfmDr iei;s  exoiopnodope  fesa() 2rrx oot1tlen oeiad m2emn ont0 ltnif ootlpDeln ols) rxm(mpoy1lmtemfcils)s2umum ;u0ale iietyt s rmnvsn()trenio3oydlpDe i s;s)sexoxopou4amt  fvi sfaDtaxroot1alxnmictytfsDra(mp t4tlerif io1op eaivs;s0 etoir iudomtnlivias)s2tm(  ;o0tlt ioeiad aDumnvon() lxoxociydfptraueols tetoxmpno4omtn fvsltfaDum(ro;o0olxn fciltlsDelumo;(0trxoio oadla e uvsls)s2tmirpnydlpeelfes s)srtr(rpnt4texn f3iat aDra(vp;t0 eenmfctodla rau s;t)texmxm oydoltnmnvt sf Dum(rpot1tlxomoetydla2uauvsn() rtoio iadlptrai ils srtr(o oudlp n ieil( arrmxr ;u0oexn f3iad aDeauvon() lenmociodfmt aiei;()seurxrpoo4optemivsat) Drr( p;o0tptnmociltls2eaumo u0tleomr3iodoptrauei;s)t2uoxo oo4am nmfvsl( sDtr(ro;o4aptnmo3tlsfs2ua(mp;u0tetomrciadfm rlu i (0srxriopiy4am elfeil()a2umx  ot4tetniictat a2emuvo t0 lxoxfctadla  lueslt0 2tr(o3ny4amtnmfvsa(  ruaurooo0alto f3iltfa eaumo;(4 rerxf3ta1oa e ivs t) euriopio1am  mivsas sDtmxro;t4tex  i3tlsls ean pnu0trtomr3tydlmDr uei ( tetmir oo1opt lnvi t)srtr(m ;t4aexomf3tld m emnmp;u0areoxo iy1oa e n s t)srtrimpiy4ol nmnctat)aDrm(ronu1alt  ociatfs elnvsnt)trxniocoo1lpDelu i;t sruoim3no1lp emfct (f Dtau ono4olenmociytfs2rln s;(0 ltoif3io1fm eaieo ( setmxo io4aptemfcias  2rru  ou4aexn ieildfsDrlumo t0areoif iytlaDeanei;s  rxrxr iudllee feta(f 2rm( pot1oetniiciatlmDrm(mp;u0tltomoctadfa  anvsls0t2uo(opoy1ap n fet t)aDrmxrp;u4oltoioeilsls2uluvp;(4tleoxr3iy1lmtr nei;()trtoio3iodolt mfci sf 2tmu oou4ole  i3ils m el(mpn()tlerxf iadom rauvols0 rtm(o3iodlmeelfctat artmump;o4tpeomfeiat a2elnvo;u0 lxnmoctadoaD  nei;() 2umxr3ny1ol emiet () Drrxmp;u0tpe ifeiytlsDrmu o;u4 rtnxr3io1omDeanvs ( sexrxr oo4optnlnvs tfsDtmxr nu1ole  fetlt s ulnvs;()aeenxo iatoaDr nvi;() rumio nudapenmnei ( a2uaxr ;o4teenmoeiatlm ea( sn(0alxnmf oytfp  ln s;(  euoio nu1omtnliei t  rrrx oot4tpenmociys sDemumon(4 lenmo3iy1fp eaneilt0t2uo(m3oy1openmiet ( arumx  ot0opxnmf3tatfsDel(mp;u0aetrmr oytfm raieslt)srtmir iodopt  ici t a2rrx p;o4alto fctlt aDeln on(0altnxr3ootopDran s;s sexoxo3no1optn iei s sDtau p;u0open ictaslaDuan s;t0tleoir iy1latrlivs;s)sexmxr3oudomt  fci tfsrra(m oo0tlx ifctyd aDraumpnt) leoir3tydlat  ueo;(  2trxm iudomeelfvsat  2rru  ot4olt moctyd a uanmo;(4arxnif oo1fpt  i s s0sexr(mpou1al nmnvs ()aDtrxr no4alxomoeiysfm eauvo;t0 lermfctodoaDe nei (  2tmxmpiu4ameelfvsl()artr(mp;t0tptnio3iysfm2ea(vsn() rtomo oadop raivi;s)s2toir ny1omtnmnvslt) rtm( pnu4aleomo3tld aDrlumpnu) etnmrciadfmD aueo s)trumxm oydlltn fvsas srua(mpou4tlxn o3iad m2rl(msnt4trenxfctatla elieil( s2toxm3oo4al nmfcta( s2uau o;t0aptomo3iysfm umnvon(0 rxnmr ty1lp rauvsls) rumxrpoodop   nvs ( aDtr(  ou0aleo ietldls2rmnvs u)texoxo3ootlaDeaivils srxo(m no4lm emivia() 2rru ont1aex mfetltfm2elu pnu) rtomr3ty1la e n s;() rxm(opnodlptnlivi s)a2ua(mo;u4ole mfeiasfm2em( s;u0tleomf3to1lmD aiei t)t2xr(r3iodllenlics s  ruaurpoo1oeen f3iysls elnms t4 etnirciodfa r n ols t2toxmpoo4am n ivi ( sDtmxm ;t1oexomoeiatfmDemums ()aeerxo3ootopDrln s ( trtmim nydomenlnvsl(f Drax  no0apxnioeiydls2rlnmsn(4trxoir oadfpDranvols0s2xoim3iudame mfciat  2raur ;u0oeenioeiasfsDul( sn(4tltnxo3oo1lpDr n o;s0sexoim3iy4omt  fet (  2raxrpou4ale moetadfs eaumo;u0tltrxf3iytoaDrlieils)teurxr3nu1ll nlfvils srua(mpoo0oltnmfcild m rmn pnt0arxrmf iy1fpD  nvs t texoxopiy1am e ictas)a2umxm ;t0aee mfeiad sDeanmp (4altomr3ta1opD livs ()truoim no4om  lici s)a2rrx pnu1optnmi3iadls ra(mpn(0altoiocootlpD  n ilt0 rto(m iu1ap n nvi ( a2ururpno4oleo i3iatfs2el(vo (4 reomfcoy1lpt ai slt0sexoxmpoudll  lnvtas sDraxmpno4alen o3ild a2eanms u4trerxo3iotop rai ol(  euo(m3no1ope  fci () 2taxmono0tetomoctld mDrlumo (0tltrxr totomDr ivslt)teurim oo1ome mfvt (  Dua(r oo0tltnmieiydfsDrlnmo;u4artoxf3tatfp  li i;() 2ur(opnu1lm elnetlt arrm(r ;u4tpt ioctlt sDulu o (4 renxr totfpDeaivi s0seuoxrpiy1al   ici s s2ra( o;o4opxo ietadls eau s;t)aexnxrctadfat li s;t0teumimpiy1lltelfcil( sDra( pnt0teeomiciasls2ranmp;u0trerxrciydoa   nvo t s2xoxo3ny4lmt lnetatfa2uaur nu1tpx mo3iad a rmuvo (4 rxrxf iytfmt luvi t0t2to(mpiy4ame  iet s s2tmx p;u4tlxnmoetad m2elnmp;(0texomfcoy1lmD aieilt)seuoxopio4ape lncslt)aDum(m nt4ole mi3tls a2elumpnu0trxnxo iotlate ieo t) rurir3nydamen ncs t)aDua(monu1tetnifeiydlm el(vonu0tltoxo iotfmtran i;s)t2toxmpno1amt lfcias) Dumur ou4tpeoii3tyd m emu o (0artrxocoytlm ranvi;()teur(r3nydlm e fvtasfsrrmur nu1olxniicildfsDum(mp t)arxomr3iydlmte ueil(  exoxr3io4lptnlfet tfa2ta(mpno4olt iieild aDumuvp;t0tetnxfcoytla rli i;() rumxmpiy1apt  ivilt)aDtmurpnu0opt iociyslmDum(vo;t4teermo oydla e n s;t0 2toxm3oo4lm emnes sfs2uru o;t0aexn ociatfs uanmp;t4alxoif iy1lm   ues s) eurir3nu1ale lfct s)srtmurpnu4opeoiicild m rmnvo (4 ltrxf3totfaD lu s ( setr(rpio1lmt  fes sfs2tmu ooo1optnio3iys a ra( p t0trxrxf oadom   i ols s2xm(m nudoltnlfvsa()a2taxrono1apx ifciys a rm(vp;()trxomf3tadlat luvo;s  exm(r3io1optelnesasfsrtrxr nu0tpxn iciytlm2emnvo ()aetoif oo1omDr u s;()seum(r nydap  licsatfsDtrur ot4olt  fcilslm2um( s;u0 eenif3iy1lm  lneo s tetoxmpno4ame  nesltfaDtru oot0aee  ociasfm eanvpnu0tltoiociydomtrauei;t0 rxm(rpno4ale lnvt s srrmx p;t0opxnio3tydlaDumuvon(4tltoif3totop rauvsl(0srxoxo nu1amenlneilsfaDrau pnt0tetn fctasfs2eluvs ()arxomf3iy1fmDraieo;t  rumim3nydlmtnmnvsas sruax  nt1optn ictas a eanmp t4alxoircoadlaDe nvol(  2urir oo1optelnetl()aDtr(mo;t4tltnmf3iasfm2rau p t0alxnir3tydfmD  ueol( t2trim iudopte nes ()arur(r ;t0opt  octytlsDum(mp u4 lenmo totlp rau s;(0 rtrxm3nu4lm nmici sfa2tmxmpot0tpx miciysfs ea( o u4 etnio ia1oa  lnvo;()setr(rpio4ol   fcslt) rrrur ;u0opeo oeiadfmDua(vo u4aexrmfctatomD  ivs;(0s2uoxm iudlme mncsat  rur(  nt1apt if3tysfmDumuvpnt0aexnmo iy1laDeauvs;t  etr(m3nydale lncil(fa2raxmpno1openmoctld aDrlums;(4aleomo to1faDeai i;t0srto(r3io1ape lnvs ( artax pno1tetniocilt sDemuvon()trxnmr oo1lptrai i t srxrxo ou1lltn ietasf 2rrxr ;t1olen oeiytfmDum(vs;u)tetoio3io1fpDrln ol(0trtoimpny1aptnlfeta(  Drrumpot1oltomi3ils a2rlu o () ltnxr oy1latrliei;t  rtriopoy1olt lieilt) rumu  ;u0tlt mo3iydfaDel(mon(4 reoxo3oydlm raivi;t0sexmir ou1lmenlnet (f 2rmurpou4oexoii3tld s ua(vonu4tltrif3oy1fpDe uvo ( srurxr3iydomtn nes s)sDrmxrpno4opt  i3tldlmDrmu p t0altnio oy1faD  nvol(0 eumxm nodap emicsat)s2ururoot1tex ifetytla ua(mo;u) renio io1opteaivs t  exo(opou1ale lfvsat)aDrmxmont1aptnmoeiyd s2emnmsnt) eermr3ty1lpt  i slt)s2tmimpnodop  mfcslt)sDrau poo0tleoii3ilsfsDemnvp (4treoir oy1late u ol()s2umxopiy1omtelfcsat)aDrmxr ;u0tlxo feiytfs eluvp t4 etnifciytlm rlieo s0trtmio iydole  ivt (fsDta( pot4olto oeiyt aDumn p t0 rtrif3tydfm   i o;()seumiopno1am emncs s) Dururpno0ape mo3iadlm2em(mo t4 eerio3ootlmtraieil(  rur(o nydamtn fctl() 2taur ;t1oexo ieiyt a2uauvsnu0 rxriocoatlmDe n sls0texoir oy4oleemfvi sf ruau ont4alxn ictaslmDrm(ms;u0 exniociytomDranvi ( srtrim nydlmenlfcs tf rumx  oo4tlxnmi3tldlaDem( s;t4aexnmo3oadfatran o;(0trxmxr3nodape  ici s aDrm(m ;o1tlxniietldlmDulu s (4treoxrciytla raneols)t2xmim3no1llee fvil() rra( pnu4alx ifciatfsDuaums (4 lerxr3iytom rluvils srurxopiu4amen fvsa()sDur(m no1olto fciyslm2ulu s;(0altrxr3totoptran s s tetoxo ny1om nlnei s s2urxmo;o4tetomi3ildfa2uaumonu4aexomfciodfmDeauvs t)tetmiopny1omenmnctl()a2um(rpnu1apeo fciasfsDrmu s ()aetnxf3iy1omDe u i;s)t2tm(m nu1amt lnesa(f rta( ont4tptniicildls umnvsn(4tltomr3iotla elu o;(  rtm(r3ny1om  lfvil()sruaur ot0tpxniociadlm2umuvo t)aexnmf3totfptr nei;( trxm(rpio1amenlfeslsfsDtm(roou0tlxn i3iatfsDuanmpnu4 rtrxoctotoateli i t) eto(m iu4apt liviat)aDumxmpoo4oleoio3iasls2ranmo (4teenio iytfaD aueo t s2xrimpiy1lleelicsa( srrax  nt0tlxnmo3tyd a2ulnmp;(4 leoxrcoatomDe ivo t  exoir3io1ll  mfeslt sDurxroot4optomociytfa2ra(msnu0alxoir oo1fpD anvi t sruo(o3iy1lpee iet ( s2tm(rp;t4ale mfeiltlm2em(mp;t4teermr3iatlmtr i s s trxrirpiy1ol e fetls) rtaxmono1olt mietys m rmnms t4tltoir oodfa e n s t)s2uoxr3nodol  lnci ( s2umum ot1aeenmo3iyt s rlnvs;u4tetrif oodoa  anvi ()t2xmim no1lmeemnvtls aDuaum nu1opxoiieiyslaDemu o t4 ltrmo to1latrlnvs;s  2toxo3iudapt mivs (  2urum ;t1aleo oeiasfsDrln pnt4artnxf tydfmtr uvs t)t2xmim oy1lptemfetls  Duru o;u1oee mo3iltla2em( o (4trxomr tatfmD aivil(  etoxo3oydlpt lfctlt)s2rrxrono1opxn ocildfa rlumont)arxomf3oy1lmD livols  rxm(m nodlmtn fvil(f 2um( oou1aleo oeilsfsDulnmo;u) ltrirciotop e ivo t)t2xmxopiu1am nmnvi t s2um( oot4aptn f3tydfm2um(monu4treomfcta1lmD  n o ( teuo(mpiodam n fvt t)srrr(rp;u4aet  fcilt a2uau sn()alxoio iotlp  lu o (  2xmio oudaltn fcs ( sDurum oo4oex mietysfsDumump;(4trxoxo3oydlpD aueo t0 etmxopny4opeelnvi s) rumxro;u4opto oeiys sDuanmpnu)tetrxrciy1opD  ivslt srxoxm iu4lm e fvtl()sDuru pou1tpenmf3ilsla2rlnvsnu0aeerxociatop  li s;s  rumir3ny1ale mfci (faDumx oot0aexnmi3tldlmDemuvp u) etrmocoodlaDean i t0setrir3ny4opt mietas sDta(r ;o1tpe if3tlsls ea(mp;(4aeenif tytfmDrlnei t s2urxr no1ope  nvils)sDrru p;u4ope ioeiltlaDelnvs;(4 reoxfcia1oa  aueslt)srurio3iy4ameemfet ( arrm(root0apenmfetysfs uln pn()artoif iadlaD lnvo;s)trxoxm no4lpenlncsa()aruaur ;t0altn o3tlslaDrlnvont4 eerir3iydlatr ieo;t) 2trim3iu4ole lnvsas)aDrr( pno0tpxn ietltfa2uauvp;u)alxoxr3iy1fpDe nvols0sexm(m nodam   nesat)s2tmu pnu4tpxnmfciysfsDulu s u)alxnxr oytomt auvo t s2xmio3oydolte nvtls  2uaum nu0aex mfciasls2ulu p;(4 renirciotlp   u olt trtr(o3oy4lptn ieiat  rrmurpou1tlxniiciydfm um(mo t4tetnxo oa1omDr ivi;t)tetm(r3io1al elfetlsfarrr(mp;o0opt ioeiyd s2ranmsnu)altnio3oatfm e n s s0s2uoim3iu1olenmfvtas) rtmumpnt4aetnifeiydfs ran o;(4tetomo totoaDelu i;() eum(o oo1lmt  ncsat a2tmu  oo4aptn oetaslm2uanvp t0alxomo iytfp e nvo s) etr(opoy4altelnciat arrmumpno0optnmf3iadlaDrmnvo (4arxnmr3totfpt lnei s0sexmim iydope  fci () Drmurp;t1apeomietyd a2ul( o;(4tleoxocta1lmDe ues;s)t2xm(m io4lp   iesls)s2rr( p;o0opeoiieiatlaDem( o;()arxrmf tytlpD livo ()trur(o oy1olee iet t)srtrxmp;o4open o3iytfmDra( pnu0 exoio tadop  liei t)t2um(r no1lmtnlivi t aDtaxrp;u0oee  f3iatfsDrmu p t0arerir tadoaDraneslt0 etrxo3no1amte fvils)aDraxr ;t0ale micildfmDumumo (0tlxrmoctatlptrauvi;()teumimpoo4apee fctls)aDumuro;t4aexo i3ias sDemnmo;()alerxo3iy1lpDr nes s)s2xmxrpny4lmeemfcsas) 2ra(mpnu0tpeomieildla rlu p u0 lxoif todlateanvils0 2xm(r3oo4lmt mnesls)arrau  nu0olt iietld s2ean s () eerxf3oy1fpD auvo;s)srumxm io4lmeelneias)aDua(ro;o4tpt moeiatlm2rl( s u0trermf3oo1fp  anvi t)srxoimpoodlmtnlictlsfsrtrum ot4optnmo3iyt m2elu s;u) rtrxf io1om  luvs ( s2xoio no4ape lnctlt) rua(ronu0tptoif3ildfs2uln o u) ltniocoy1la r ivo;t srxr(m3oo1lmtn nei tfarumxmo;o4texomoeildfs2el(mpnt)aetomo3tytomteau i;()srtoimpnydam  lnvtas)aDtr(rpoo0tet  o3iytlaDem(ms (4teerxocoytfpt lueolt)srto(rpnu1lltnlfvsls srur(rpnt0opto f3ils s ulnms;t4teerxo3oa1fm  auei;t0 rtrxo3no1ap emicsl() 2umur nt1aexoif3iyt m2rauvo;(4aexrir3iodop  livilt0 rxmxr3oo4altn fviasfsDururo;u0oeeoifctltfsDul( s t)artoxfciy1lp elu s s0 rxm(o oy4omee fei sf ruaum ;t1tpxnmociasfs ul(mp t0tetomocto1lp  lnvo;()srto(opoo1optn fctas)sDuru  oo1optnio3tyd s2rmnvp u0artoxr oodfp elnes ( truo(o3ou1alenlicsatfa2tax  nu1olxnmietltfs uauvo ()trxnxr3oodfmt  uvs s setrxr iy1lmenmictltfs2rr(  ;o4oeeo o3iatls ulnmo (0alerio3oadfaDr ueilt seurio io4openlnes ( aDumxmpnu0tlt mfeiydfm em( snt)trxnmfcoadfm raneo () 2xo(m3iy4lptelnvs ()srtm(ro;o4ale  feils a rlums (4alerxr3io1oa eau s t0t2xmim iy4ale  nvtat a2raxmoou1altoioeiysls ul(mp;(4 ltomfcootlateau i t0srxmirpny1lpt lics t a2uaum nt0olx mf3ilsfa rm( o;t0alxrmf3ia1faD livs;s0srxm(mpnodaptelneia()arurum ot0olenmietydlm2umnvo;(0teenif3tytlmtr nes;()s2xmxo oy1oleemfeslt a2ra(m ;t1aet  ictls a umnvp u4 renir tadlaD aieslt teum(rpoudlpte ivi s a2raum ot4ope mietlsfs emu o ()artnxf iytfaD aivo;()srxoir oudlpen nei s)sDtr(r ;t0tpx ifeildlm elnmp;t4texniociatomDrlivi;()setrir ou4lleemfctlsfsDraump;o1ale iociltlsDranvp;t4tlxnxf totom rlu s ()setm(r iy1lptelnetat a2umxrpnt4oet mf3tldfa2rau o ()altoio3iotfat  n o () rtr(rpiu1lpee ncsatfaDtrx oou0oltomf3ils a2ulumon(0 rxrif ta1lmD  ues (0sruoiopiu1lpeemfvtasf Dtmx ooo1olto o3tas mDrlumo (4teerir tydop eliei t texmir io1lpeemncs tf rua(m nt0apx ifeiadfa2rauvsnt4 exoifctotoaD lu i ( srxo(m oudlmen nvt ( aDuaur ;o1opx mfctas s rl( p u4trxrxoctatfpteln ils0teur(m3iu1am nlncs (faDumxmo;u4optnmi3ilsls rmu p u0tltnmrciadomt luvo;t0trxoxm nu1lmtn nvs sf 2uaurooo4tptniociytfsDul( s;(0aexoxfctadomDelnes (0s2umxrpnudllt lfcsasf Dtrxro;t0opxn o3ilt s uln ont4tetrif ootla ranes;(0s2tmir ny1ap  mnvia( a2rr(mpnu4tlxnmfctydfmDelumsnt)aetriocia1fa  liesls  2xoir iy1optn ieslt  2rrumonu1apx  iciytfs ea( p t4 lenxfctatfmte n o;(0 rtmxm no4altn ict s)arrmx  ot4tpxomfctadls2elumo (0alenmrcta1omDraneo;t t2xrxr3iy1amt  nesa( a2rrurono0aeto octadla rau s u) reoir3oo1fp eln s;s0srxrxrpiy1omtnlics s  2tau  nu0opt  fciyslsDrlnvpnu4altnxf oodlmteli ils0 2tm(mpnydomeemnvils  2trumo;u4altn o3iysfs uanmon(4teenmr3oa1fmteauei;t t2tmxo3iydomenlfvsas)aDumuro;o4aetniiciysfa2rmuvo;()alxomr oo1oaD anvs t)tetrxopnu1lle micsas  2ra(roou4tptnioeiat s uan p t) exoxrciydlpDean s;t)trur(rpnodlltnliciltf Dtr(mpot0tex ioctatfm ul(vp;t0tltomo3ta1faDe iei;s) eum(o iu4lm  lnvil(farrmx  ;o4ope  ieiltla rlnvp t)aleoio iadopD auvils) 2uo(r no1alen fcsl( arrm( ont1tlxomi3tydlmDeanms;t4 ltnxr oytfmDelnvo s  rtmxopny1lpeelnvia() 2tr( pot0optoifetld aDrl(vs u0 lenxrcio1lm rluvo t0 rxoim3iodaptemnvilt sDrax  no1ole  iciydfm2emnmp () ltrxf todomt lieilt sexm(mpiydlmtn nvsatf rrmx  ot0tlxnii3tydlmDrl(vs () eeoir oydopDranvs s)t2uoxo oudopenlfvilt  Dtau  ot1oeen f3ias a um(mo u)aexnmo tatopt lu s;(0 2xrxo3ny4ol e fvilt arrr(r oo4aleomfeiyd s2uanvo;(4artrir ia1la rli o ( s2xriopoo4lm  lfei sf 2taxrooo4apx moeiyslmDumn onu0arxrmf totfatrln s;s)trumxo3ou1lle lictas)s2tmx  nu1opt  f3iadfs2umn p t)teeoxf to1om elueolt tetm(m3nu4ap n fvtasf Drrx o;o1oeto oeildfm2em( pnt0 rtrxf3iy1la r u ils0srxrxrpoydam e netat srur(ront1aeeniietyslmDeau o;()arxnxrcoytla  anvo s)t2xoxmpnu4op elfcsls  rrau pnt0aeeo o3tlsla2um(mo (4 ltoxo3iydfm elneo (0trxrxr3oodlptemiesl() Dur(m ot0tex mi3iltlmDel(vo;u4aetrmf3todlpD auvo s0t2xr(opou4lmee ncta() rrrx pnt4aexn ociasfs ea( snt4 ltnxo oo1fmDe iei t t2xr(o iodaltnlnvtls  Dtaurpno4opt  o3iys s2elu snt)aeerio oytlmDelu i;t)srumimpnydll nlnci (faDtau  ot0altoiocildlm2um(vsn(4aleomrciadlp e ieslt t2tmxrpiydapenlfesatf 2rm(r ;o0oetomictls a uluvs;t4 eeomr ootfatraivi;( t2toiopiodomen fcil(f Draump;u0tpenif3iys m2emnmp t)alxnmr3iy1opDrlues s t2urim nu4optnlivil(f Durxr ou1olt moetldlm2uln onu4tlxnmo3iy1fpD lnvsls)trtoio iydol  livtas)s2urxmpnu1olxo fciytfaDraumsn(4texrxo3oy1fm  au o;s t2tmxm3iu1amtnlfetls aDta(moot4apeomf3iltlmDua( o (4alxoir3oodopte uvsls  rtmxm3iudll emneslt) Dumu oou1tpxnmo3ilt a2eanvs t)artomf3iadfm r uvslt0 2uo(opiy1lmtelfet tfarraumo;o4tltoiicils sDrluvs;u0aetomo3to1fa  aivil(0s2xmir io1openmfvtatfsDrax  ou1optoiociasfs2eanvo;()artrio3oa1lm  luvilt0t2tmxmpoo4opte ncs (f 2rr(rpot4oexnmo3iydlsDeln p u)artrxr3oo1fat lies;t)s2uo(mpnu1al   fcsat srtrum nt0tltn ociatfa2el(msnu4 exoxo3iydopDelu o;s)tetoxopnodamen nvt (  rra(roou1aetomictydfa elnmp;u0tlenmf3oytlpte ivo s0setm(o iu4omenlfvsas  rum(m ou0olenmieias a el(vs;(4altoirctydoatraivolt)sexrio iudop elicia(  ruaumpou4ale  fetad m elnmont4 exomr3tatlptrlnvi t0trtoxmpoudlme  fvslt aDrrx  nu4oetn feiasla umu s t0aexrifcio1fpteaieol(  rum(rpoodol emfetl( s2rau  no0aex mictlsfmDulnmo (0aexoif oydlatr n ilt0sexr(opny1llen ncsl(fs2ur( pnu4olt ifcias m2ea(vp () ltnmr ootfaDe ies;s  rxrir oo1amtemics tf 2rrxrp;o4tex micils mDemums;u0 ltnircta1fpt lu i;(0 2uo(r3no4ol  lnvt s) Dua(mpno1tlen o3iadfaDrlumo (4aeeoiociy1opD  n slt srtm(r iudlmenmivs t  rraurpnt1tpe ifetys a emn o t4texnio3tadoa e ieo (0trtm(rpoo4amt licia(  2rrumpnu0oexoif3tydlaDrl( o t)tltnif iytfateli s s)srurim iu1altn net (f Dumxrpno0tltn oeiys mDemuvo u) etoifcootoatr n i;( s2xmiopnu1ll emnvsl()a2tm(ro;t0teeo oetadlaDulnvo;u4 exoio3io1la e ueo;s s2uoxo nu1lp  lfvsl()srrmumonu0opt mfetlsfm2rln s t4aexnxo3oodomDe n i;t) 2tmimpiodopeemnvtat a2tmu  ;u4tpxnmfcildfaDuluvpnt)tlxnxo iydfp eln slt)srtmim3ny1al n nctlt)a2taxrpot0tpxn ociyt aDrlumo t4alxoif3iodop rlues t)texm(opno4apen fvtlt  2trx  ;u4aetnmoeildlsDrlumpn()arerxf3iadlp  aivs t)t2trxm iodlpen ictls srraurpot0oeen i3iys mDemnvsn(0 leoxr iatopDeln sl(  rxrxm3no1ol  miet s)aDraur ot0olx mfetatfsDrln on()aeenxo todop   ieo;( s2xriopoodaltelieta() Drax ont1oleoioeilsfa2emuvpn()alxnxo iatoat auvo;s0texrxr iu1alee ivsas) Drr(monu1teeoifciltlsDem(mp u4teermfciadlat  nvo;t)setoir iu1lmtnmnvslsfa2rrxm ;o4opxo i3tyd m2rluvs;u4tleoifciydfpD lneo;(0 eumxo ny1ol e nci tf 2rrxm oo4apx mo3tlt a raumpnu4 rxnxr io1la   ies;t srxoxopnudap  lietat s2taum ou4ole iiciaslsDraumpnt) lxoioctatoaDrlu i t0texmxr io1ap nliesatf rtm(r no1opxo ociadfa2ul( onu4alxrmo oytomtelu o;t) rum(o no4ale lfetls  2trum oo1aleomf3iad a ua(mon() rerxr oytfmtelivslt) 2xm(m oodomte ieiatfa2raxr nu1aetnmo3iadla2umu s ()trtrmo3oytla rlu i;() 2urir ou4opt mnctl( aDtrxm ;t1aet ioeiyd s2el(vs t) lxrifcoo1lpD  ivsls)teurxopoy1ap eliesa()srraxrpno1aexniocilsfm2um(vo;u4 rtnmo oytop raivs;s  2to(m io4amtnlnct s a2taum ;u0tpeomf3tld m2eanmp t) rxrmf3todlmteaneolt  rtm(mpoydlleemfei tfsrtmx  ou4aptn f3tytlsDrlnmon(4 reoif3oy1oaDe uvi s)setmio iodlme  ieilt)s2tmu o;o0oltoif3iyt m el(vonu4aetomociy1laDeluei (  etmim3ny1om emnvta(fsDtmurpnu0oetnii3tydfs2rm( p;t0arerxociytlaD an s;( s2uoio oy1lm nlfei ( a2rr( poo0texoioeiyt sDel(vpn()tetoxrcia1lptraies;s0 2umxmpiu4lmt lfei ()sruaxmpot0olxnmi3tltfs rm( s ()aeenmo oadlmD li i ( t2urim iy1lmtnlfciltfs2tmuro;u0tee if3ias s2eanvs;(0 exoir oadfp r ivsls0 2trim no1aptelfciatf Dur(m ;u4altn oeiadla2rlu s;(0 etnmf3tydopDeanes;t t2toio ny4om emfesl(  Drrur oo4tpe  feiadls raumon(4 lenmo3iadfp   ieo;t) rtr(opno1altelfcs s)aDur(mono0apxniietysfm umnvo;t0 etomrcootfm e i ol()s2to(m3ny4oltelnetl( arua(m ;o4teenif3tlsls ean p t0teerif oydfpDe neo ( teurim3oydlmt mnvtat arrmum ;u0oex mociadfs uaumo (4arenircoo1fm  lneo;t) exm(mpoy4ameelfviat s2taxronu1aetnmi3iytfm2ranmp ()aleoxf3to1fa rlivils s2xr(r3ny4ll emnet () Duau ono4tetomi3iad m2uanvs (4arenxfcio1omtrluei;s)s2xmirpnodom nliciasf ruru p;u0tltoiicildla2ea( ont)trtnifctatoa r nvsls) ruoir3iy4alt lnvi s)s2ta(mo;u1aex mieils sDrmuvp (0tlxnxo3tatomDrlnvi;( t2tmir no1opt  fetls)aDur(rono4oex iieiatfaDea(msnu)texoio3iatlmDeln s ()s2to(opno1omt lfvilsfarrmx pou1ope mictat s2elnmont4texnmr3oydfpDr u i;s0s2umimpiy4ale  fvtltf Drru pot4tptnio3iltls2eau s (0 rerxrcoadfateluvolt0t2xm(m nodol  lfvias a2umxm ;t0alto fetasla2eaumpnu4teerxr iotopD aies;s0 eto(o3oy1am elivi s) Duau pot4tpx  ietytfm ua(mo u)aetnmf ootoatran sls0t2toirpnu4lmtnmfcsl( srum(  ;o1oex  ieias sDrlumsn(0 rxnxociotfaDr uvo;s s2toxrpno1ll nmnesls) rtrxronu0tpt mieiat s2ra( onu)arxrmocty1lpte i s s0t2uoxrpnudllt lnctasf 2um(rp;t4aex  ieiatfaDuanmpnt0aexrio3oy1fptrluvo s0 2urxm3iy1aptemncsl()artmx  ;o0tetnif3iydlsDrlums t4tetoiocia1fpt  uei (  2xoir3io4optelivsat)aDta(roou0alxomiciadfa el(mp;u0arxomfctotop rlu olt0trtrio3iy4ll  mnvsl() 2tr(mpno1tpt iociydfa2eaumpnu4texomr oydla rlnvi;s)s2tmim ou4llenmnvi t)srurxrpnu1tpt mfetytfaDeln p t4 eeoxo iytoptraneilt  eumxopny4lmtnmivt s) Dum(mont0opt mo3tlsls rln snu)altnxf3to1lp rlieolt  2urirpnudllt lnei () rurum nt1aeen fcildfmDelnvp t4treomo iotop r u i;() 2tm(opou1ll nmfci () rurxr oo4ope iieilsfs2rauvpnu4alxrxocoa1fmDeanei s)tetmxmpiy4lmtnmfct ( a2uaumpot1aexomi3iydlm umums;u4aexrmf3iy1oatean s;t0 rxmio ou4ame  ictls)sDtm(monu1oetoio3iyslsDemu s;(4 rxoir3ta1op elnvs;s  rum(mpny4op e fvtltfarumu o;u4teeomi3tysfa2ulu snu) eeoxf3iytom ranvs;t) eur(rpoodolee fvt tfarrrumo;u0tex  ociytfa2em(vs;u4 rermf oydfm  aueo (0 etmxrpoy4lmtn fetat)a2uau o;u1tetnmo3tas a2em(vp t4artrxf3tytfp rln slt0 etoxrpoy4olenmncslt sDrr(m ot1olenio3ilsfm2rmnvo;u4arermrcoydfatrlieo t)tetrir3nydlm e icsl(  rtrx o;t4oexnifetls m2rmn p t)tltomf3ia1latrliei;s0 rtmxr iu1amtemfct t  2rru poo0oeeoioeilt a ul( o;(4alxoirciy1lmtrlneols  euo(m3iy1lptnlfvilsf 2ta( ooo4aeto i3tld m rlums t0artnif iy1omt li i;t  rxrxo3nudopt  fvt (f rraxm no1tptnifcild m2eanmpnt4trxnmf oodfat luei;s seurimpoodoltn fvtl(fa2rmu  ;t4opxnmf3iyslm rlums;t0tltnif3oytlmt  u o (  rxrio iodllenlneil(  rur(rp;t4tpx  octldla ulu o u4 etrxr3oa1om eanvi;()trur(o3nu1aleelieilsfaDrm(mpot1aet mieiad a2ea( o () rtnxfciodfpDe nvo t trxo(r3nu1al  lfesls)s2raum ;t4olx moctat a uau p (4aexnmr oo1fpDr ivo;t)srxmio3iy1ol elieslt)a2um(  ;u0oexnif3tld m ua(ms t0tltnxo iytfaD  ueo ( s2uoxr iy4llte ivta( aDta( oou0oeto ietltfm2uln p u4aeeoir iytoat  ues s0trurio3io1apeemfvtlsfsDua(m ;o4aexnmociydfs emuvsn(0aetrif iodlmtr u o t0trxrimpio4om  licils arrru pnt1alt moctydfmDea(vo;(0 eeoxfcoodoateanvi s)t2uoxr3iydalenlfvsltf rrrx p;u4tltn oeiltfaDemnvp;(4aetrxo oa1fpD aieil(0 exmimpoydomtnmnvt t)arumur nt4opt mociadlm elump t0arxnmociotlm rlnei t texrxo3ou1lmtemfeslt  2raxmpoo0ape if3tyt s emn s;(4alerxr3iydoat li ol(0trxo(m iu1op  lncta(f 2rax o;t0aeenmieiatlaDrmnvonu4 rerir oa1faDrln slt0teumxo iy1lp   fviasfs2raxmpnu0apxoifctlt aDeanvs ()teenmo oo1fateln i;t)s2um(m3nudlm   fci tfa2umx  ot0ale mieiatls2umuvp ()tetnifciadfmD an ols0teurxm nu1ope mfvt (  Drru ont0ape  oeilt s ranmo t4tetriocia1oaD li i s0seurxo3io1am  mivi s)s2umumonu4apt  ietytls2elu p t0 rtoxrcta1lp eanes s0 etrxopio1alt lfetatfa2um(rpot1tlxnioeiad m eaums t0tlxoxr3iy1om rau i ( srumio nu4ll nmnctlt)s2ur(ront0tlxn oetydla2uan p u0alerxfcoadlmDeln s ()srurirpnydlleelnet (farra(r nu0tex miciys m2rmuvp;(4 etrxf oadlpteanvo;t0teuo(o3nu4lle mfvia()aDrr(m nu0tet  fcias s rmnmsn(0teeomo tytomD  ivi;()t2to(m3iudomenlfvtl(faDrr(  nt0tle ii3iydfm ul(vo u)tlxrmocty1lat lieo;s)s2urirpoy4alt lietl(  2ur( p;o4olxomf3iytlmDrmu pn(0altoir3iotlmte nei t)teuo(mpnudalt  fvsasfaDumxrp;u1aet ioeiyd m ean s t0teenircoytfpDrli o ()s2to(opoy1opee ivi s srurxro;t1opxo fetad m2ea(vo;t0 ltniociydlpD  ivs;( trto(rpnodopen fvtat aDua(r nt1aleo ociysfs2emuvo (0aeenmf iatoaDe nvi;t0t2toxrpny1oltn feiltfs2tmurpoo1tetomoeiyd m2rlu s;u4 rxomr to1lmtelieo t)trtmxm3iu1al  mneilt  Durur ot4oeto f3tatlmDumn s;t4 lxrxr3iatoaDe nvsl(0texoxo nu1lm nmfvs sfsDtaumo;t0optniociat s2eanmsn()trxrmr iydlpt aueolt)seurimpny4om nmfvtlsfsrrm(rono4tltomf3tas aDrmuvp;()artnir3iodom eln ol(0 rto(o3oodape mictat  Dum( poo4tleo oeildls umums;u0areomf iatlatrlu ols) 2xr(m3io1am  lnctlt  2um( oou1oet moctld sDumuvp;t) etrir3oadoa  an ol()s2trxo3ou4am   ics ()a2uau ont0oexo ociyt s el(vp t4 eenir ta1fm  li o;s)trxm(m io1lm n ncsl( arurx p;o4altn o3iysfaDrl(mp;(4 lxrio tydla r nvils0sexrxo3ny1aleemict t)srtr(m nu1olx mictydls uauvpnt0 exoir3tatlatelivi;s0seumio3iodame mfvsat)srrr(rono1opt mfetytlm2uan p;(0altnmf ootfmDe iei;s0 2xrxo3oy4lm  lnciasf 2rmxm nt4alt ifctltfaDuluvs;(4aexrmr ty1lmDr u o (0 rtrxr3no4ll e nvs sfa2ra( ooo0oleo ociad aDrln s;u4aetnmocoytlp eln i (0t2tm(o3ou1optn ivtl()a2tmu ont1aetn o3ild a emnmsnu0tlerxf3to1om  lieo ( seumim iydamenlnesas) rrmx  oo4apenioeiyt sDum( ont0 rxrxr3io1opDrlu i;(0t2xo(m no1ameemfeta()s2taxmpoo0aleomociytlaDrau o (4 eenmf iytom  ln i (0trtrxr iodolt  nvia( aDum(rpou0tlxo o3iyt s uan p;() lerif to1lmtelivs;t0trxm(mpno4amte nctatf ruaur ;o4tpeomi3ilslm rmuvp;(4trerio iotoa e i i;t) 2uoim3oydlm emfct s)a2ur(m ;t0opto ieiad aDea(vonu4aeeriocoatopt  u s;t sexo(m3oy1llen ics s s2urumpnu1oee  f3tytls rluvo u)treniociydoa rlu s;s s2xrio3no1ame  nviat a2urum no4alx ifciyt s2eauvs;t0tlxrircoytlpD  u o;()s2umio3ou4lmtn ivtls)srtm(mo;o4alenif3iyslsDrauvon()arxnxo oytfmtraueolt) 2toxmpoo1ame mfvi s aDtaxrooo1tlxnmoeiyd sDranvo (4alxoxfcoytfp eanvi t0sexrirpoo4altemnvta( sDta(rp;u1teeomoeiyt s2ulu s u0altomf iatopD luvsls0 euoiopnu4om emnctat)aDrrxro;u1openio3iysfs ul(von(0aexoif ootlpteliei;t0 rxo(mpoudlp e fet ()a2ta( p;o4aeeomiciaslm ul( on(4tlenxf oy1fmtelivo s0trtr(opiy4apte ncilt)sDtrxrooo4apeoiociys a umnvo;()tltnif tadlpDrli o;t  rtmxo iu1al  lnci s)a2umumpno1texoiieiat aDul(vsnt4artrxo3ty1oa eauvo;()t2xmxmpoydlmee ncil()sDuaxmp;o0oleoifciad m2elnvp;(0alxrxr3oodoaDe u i s)truo(o ny1ale  fctlt) Drrumont4aleoiieiydla2ranmpn(4aetrio ty1omD anei;t seurim3oy4ap elict s)sDtrx  ou1tex  o3iltfs eau on(4tetnxfciodlmDrln s;s t2umio3oydomenmictl(fa2um( o;o0aeenmfetytfa2el(vo;()trxrmrciodlat  ivi (0s2xoir3nydom  lici t  2ua( poo4apen ietlsla rlu onu0aeerif3iy1fpte ivo;s s2xmim nu1omt mncslsfsrur(r ot0oetoio3iatlaDumu o;t0alenif oo1optrauvi t  exoxopnodlmenmicias)sDra(m ;u1tlxn o3iytfm uaumo;t4artnxo io1op e u o s s2xmxo iu4ol n ivt s s2raumpot0oet  fctlsfs ra( snt) rermf3tydfaD lnvo;s  2umir3oy4lle mnei s)aDumuroot4tetnmfctyt sDrmnmp;t0aetrmf3iatfmDran s (0s2xr(opno4omtelivi s sDrrum oo1oexoioeiysfaDea(von(4teerxr3iatfmDeauvi;t tetr(r3oy1lmtnlfvt s)s2trxmooo1tpxomieilsls rl(mp;t)teenxr tatfa eaueslt srxrxr nudolee icsa(fsrrmxr ou1tetnio3iad a2ulnvpnt)arxrxr3oytlp rlneils t2toxo3nu1aptemivil(  Duaxrp;t1tptnio3iytlaDul( o t)aetnmociodfmte i s (0t2tmimpiudam nmfcias  rumx  ou4altn ociltfa emnvs;()tleomociotopD ai i t)s2to(opiudoleemnvtlt)arrmum ;t1apx io3iat aDrlnmo (0 rxnmo iadlat  u sls  2umimpiydoptelictls aDta(  nt0apxomietysfsDuaumon(4texnmf iadfpt livi t trtmxm3iu4am n ncsltfs2ur(  ;t1teenmi3ilsls rmu p t) eerxf3io1fpDeaivs;() 2um(r no1alenlivi ( sDrr(ro;u4aptnioctatfs2emnmo t4arerxr3oy1om r ivsls0srtm(m3oo1op  mict t  2rmurpnu1olxomocildfaDemn pnt4altomf3oo1op  au slt tetmim io4lp  lncsl() Draum ;o4tlx ifciydls2eanvp;u0 rxrmf3ia1fatrauvsls0setoirpnodlme  fvtls) Drax p;o1aeeoiieiat a eln s;u0altnxf3oodfm eaiei s srxo(rpiy1omtelicsls)srtmxrono1opeo f3ilt a2el(mp;u4 rxnif oytlate ueo;() eto(r3iudlltemfctl(faDrrxm ;o4oex mociyd s2rlnmonu)tlxrio tytom e ueo s  2to(mpoudlm emiviat s2raur no4alt  oetas aDua(mo u)arenmr3tadlmDe n o;s0 eumir no1ol n fet s  Dua(ronu0tet  ociltlsDemuvs t0 exoif3tatfp r nei;(0 rxrim nu4lpte nct (fsDtaxmpno4tlenmi3iltfm eln pnt0trtnifciadopte n il()s2urimpiu1olt lfvt s aDraxr ;u4opto fetls aDem(mpnt0trtnxo totlaDe i o t t2tm(rpiu1ap emfvtas aruru  no0aexn ietyslm2em( p t0 eerxr oy1fpteau s s s2tmxr3iu1llt mfetatf 2taxro;o1altomieiydls2rmn p;t4areoxr oo1lmD an s;s0seuoxm oudopenmiei s srtr(rooo0opt mociydfaDrau pnu4texoxo tytom rai o;t  2uoirpiy1lm emiesat  2uax o;o0aeenmfetls s ea( s t0tltoxf3io1fat  nvs;s)trtrxr3iudaltelfeia(faDumx  ;u4olt  f3tytlm2rlu ont4 etoir iydlp   n s (  2tr(o3oo1amte fctlt)a2uaum nu0oee  oetydfa rau p;(0trenmoctadfaD  neo t sruriopiy4aptn ivils aDrm(r ;u1altnmfciaslmDua( s () reomo ootfaDeaieo;s) rtrimpno4ll elncs s)sDta(  ot1oetnifctas m2rmumo u0aeenxrcoatomDeaueo;t)seumio ny1al nmfcs s  Dta( pot0oetomo3ildfm emu s;t0tlxrmociodop elneo (0srum(opiy4al   nes s) 2um(m nu4texoioeiadlsDrmnms ()aexrxo oytom eauvo;s0 rtoim ny1opeelfcs tfsrrrx pot1oet mfctydlm rmu ont0 exnxfciodlm ranvo;t t2uoirpnydaptnmfvi t)aDumurpot4oetn o3tlslmDeauvp u0aeeomrcoodfptr u i;s sexmim3oydom e ieiatfaDta(r nu4tlxo feiydfm emnmo;u) exrxf totfa e ueo;s) 2toxmpno1opt  netltf 2ur( ono1aetnio3iasfa uluvont) lxnio ia1lmDeaivils0 2xrxmpny4lltemict s  Drmumoot0optnmieiyslmDemump;u0 lxoir iydfm eaivi;()tetoxm3iu4omt  ivils sDrrxroou0tpe iietls a rl(vo;t)teeomfciy1oate nvo;t t2tmio3iu1lp nmnvtlt aDrru ont0tlt ioetls sDem( s (0 eeoioctadlmD lnvi;t)sexriopnu4ape  ivs sfarrmxrp;o0texoifctlsfsDemnvo u4trenxr3tatom  ln ilt srtriopiydal n fctlt)s2urur oo1apx  fciydfaDran snt0arxrxfcoo1fp e i i;s)truoxo ou1oltnlicilt)a2um( pnt0tpx moeiyd sDulums t0alxomo3tytlpteluvolt) 2uoxm ou4lm   ivil(fsrraurpou0aeto i3iltfm2umnvsn(0 etoxo tytfpDr iei t0 2xm(mpny1lmenlnctas  Dtr(mpoo4aex if3iltfm el(mp;u4 lxnxf iydomteauei t s2urxopoudal n iei s  Dtax  ;u4tex iocilsfa2ranmo;u0teeoxfcio1omtr nes;s0 2to(mpnu1apenmnci t)s2rrxmont1tlt miciys aDeaums;t0tetnmrctodoateau sl()srxm(r iu1ll emfctls  Dra(  ;o0oexnif3ildfm um( s t4altoxr3iodlm eai ols) exr(m3oodlme micsa( a2taxmp;u0tlxoioetlsfa emn p;(4altomfctytfmtr uvsls setmim iu1ll n fvtl( sDtmu ono4alenmietytla2rm(vo t) rerir iydlpDelieolt0s2xoxm iy1op elici ()a2rax pnu1olxo o3ildlsDraumo;t0trxomo3ia1oaDr nvilt t2tmio oy1ol  mnvils  Dua(m nu0aet io3iys aDeau p (4altnio3oytoat anvo s)s2xmxopio1optnmfeta() 2rm( poo1olen fciysls2rmu s;t4arxoiocoy1oatelivols0 rtmim oydam nmici tfsDrrx  no1tlxo icilsfm2rmuvp u0 rxoxo oodfaDean o;t truo(r3oo1optelnvi t) Dururpot1oee mociyd sDua( o (0 lxrifcio1fatr n ils)seuoim iudole  fvilsfs2taur nu1tle  f3tytfa2rmumonu0 rxnmr tytfp r nvo t setrir iy1ame lfeias  2umum ou4tet ioetldfaDulnvp;(4 rxnxo oydopD anes;s) 2to(r3io1ll nmnctl()s2rr( pnt4opt iieilsfaDelnvp u)aeerxocta1lmDeli s ()sruoirpoydomeemfci sfsrta(  nu1oexn fctydls em( ont4tetrir3ootoat ln s t t2xr(o3oo1lptnlict ( sDtaxrpot0tptnio3iad mDemums;u0texnif oy1fm eaieo (  2xm(r3ny4om n nct (fs2ra(m ;t4ape ifeiadlaDumn on(0altoioctodlmt  u s;()t2xr(rpnu1opeemnviatf 2tmxrpnu4tlxn ietydfs ea( s;t0tetnxfctodoa rli i;t)s2ur(rpny4ole  fes ( sDrmu onu4tpxoifctlt a2rlnms;(4 rtrir iatfpt  n olt srur(m3ny1lm e nctltfa2ra(rooo1oex  fetyslm uauvp t4aeeoxo3oydlatelieols) 2xmir3oudlp nmnvtls)srtaum nt4alt ifeiltfm rl(mo u0 eermo3tytlp eau ils)teuoir iydlptn fet (f rtmumpnu4tee ii3iydfmDrm(vs () exoif3oydla ranvi ( t2trxm3nu4olt lieil(faDra( pnu1apeomi3tadfm2ul(monu4 leniociatlmDe ivi;t s2toxm iu1ll  lfvi ( aDrm(rpou4aex mfcildfm eau s u) etnmociatfpteanei;(0 ruoio3nydomtnlfei tfa2rru oot1aptomietlsfaDuauvs;t0artnioctotfmDeauvol(0 exo(o nu1al emieiat a2trxm ;o0tpt  iciasla ulnvp u0 renio3tydfat lneo;(0 rxrxm3iy1ol  lieiltfsrtaxmpou0tlt ifeilslm rlnvo (0teenircia1fa   neolt0srxoirpno4amtnlici s)srumurpnt1tlenmo3tyd a emnvo;t0aetrmocty1opte uvil(  etmio iu1lmenliet tfsrumu o;t1oet mi3ilsfs el(mont4tetrxr3oytoptelneo;t sexo(m3nydlm  mncsls)srrau p;o4tlx mieild m ulnvp t4 lenmr oadfmtean slt)seur(o3no4lleelnes () 2tru  ou1tpt mo3iydfs umn o t) reoxr3ta1fa r nes t srtoxr3ou1om   ncs t) 2tm(mo;u4ape io3ilt sDelumo;(4 eermo3tytoat  n i;t)s2toirpio1amtn fcta(f 2uax pot4oetoioctydlaDul( o u) exrmo iy1fpDranvol() 2tm(r3oy4ll elfvsls)sDurur no0aptnifciydfa ua(vp;u) lenmr3oa1fpDeln i;(0 eumxrpnu1lmtn nvtlsfsDta( p;u0texomociatfm ea( ont0 lxoxo tytla eauvsl()trxoxr io1op e neias arrm(r no1tptoio3tadls uln p;t4 etrifcoodopt livo s) 2xoxm iodamenlict ( aDraxrp;u1tex miciatlm2ranmp;u4artrxf tadlpDraivs ( trtmxmpno1llt  ieil(fsDuaurpnt0aex mfciytfm2emuvp (4trtrxo oo1fat  ies ( s2trio iy1lmeemivs s s2rmu ono0tex iietlt s2ulu ont4tetnxf tytfp raneo;( trxr(o3ny4aptelics ( arrrur ;o4optnii3iatlaDulnmp u) eerxocoodoaD  n slt)sexmio no1apee fetl(fsDtr(moot4alxomociadfa eanvs u0artrxr3oa1om   n s s) exrxo iudlp emivt s  Dtm( pot1texo fctatfa2rlnms;t)artoio3oydfmt aivs;s)t2xmir3ou1amt  icsl(  rtmxmpot4oex io3iyslaDeaumo;t0tlxrmocto1op r iesls)trtrimpoy1lp nlnvt (faDum(rooo0alt io3tadfmDrlnvp t4 leomocoytlateli s t  euoio3oydalte ncs t) Drau ont1aeeoiictys a emnmp;t4texrxo3oodomtraueo;() 2tm(mpou4olen iviatfa2tmx  ;t4olt miciadla2rlumo u) lerir3totfp   i o;(0setmxmpou4am nmnetlt s2urur oo0teto fetat m2emnvp;() leoxo oatom eai ol() euo(rpoo4opeemnci sfsrrr(mono1tle  fciatfmDrmn s;t0 rtnircoytoaDr n s;t setrxr oudolenmfet s s2rr(mo;t0apeoio3ias s ra(vpnu)alxnxrcto1optrai slt  2ur(m nodlptnlicil( aDumu  ot0olto f3iasfsDemnvp;t)artomo iy1lm elneo;s t2tmim3no4lptn fes (f Drmumo;u1apxo f3ildfs eauvpnt) exrir3to1op r ivo ()t2tr(o nu1alt  fviltf 2ur(m ot0oeeo fctlsla2ranmonu4tleoir3iadoat li s ()s2toiopnu1ap n fvi s aDta(  ot1optoioeiyt m2rl(mp;u4texnmf iy1om   uvs;t  2urxo nudoptn neslt)srumumo;t1opxomo3iys a2rlums;u0aetoif3tatlmtelu o t s2urio iudll nlnvtas)srrm(monu1teto fcildfa2el(ms (0aeenmr3oo1fmDe i o ( t2tmir3oy1ap n ietl(fa2tau o;t4aexomo3tldfs eau p u4trtoxf3oodlateanvi s trurim no4al nlfcias s2rruro;u4olt iieiatfs2em(mo u) eeoxf3io1lat ln i ( t2xrxrpiu4ll elnvs t aDuax oot4alxo feildla2eaumsnt) lxomr iotlmtrlnvi t seumimpnodlptnmfeslsf rtrx onu4aee mociyd m ul( pn()tetoxr oodlatraueo;( texmimpnu1apen nct t)sDtrx pou1aeeniiciatls2el(mp;(0aeerio3iotopDrluvilt0 rtmxopou4lmtnlivil(f 2ur(  oo1oexnioetytfaDumu onu4trxrxrctotlpDrlueils) 2umxrpoy4omenliesl() Durxm nu4tpx ifeiydfs2rm( snu0 exnif3tatom rlneols) rtoxm oo4llenlivsa(faDuru o;o4alen fcild s2emnmp t0aexrio3iodlptrlues (0srtmxm iudlptn fetl()srrrur oo1tltn fcildlmDeau p t4tlxoxocty1fpt li i (0srxrirpny1lpeemfctas  2uax pnu0aetomocilsfm2uanvonu) eenxf oo1lmt lnvs t)trum(m oydapt mfei s)sDtr(rp;t0oeen i3iadlsDrmuvo;t0treoio tydfpteaiesl( t2uoxm3ou1lmtemivil( aDra(ro;o4opxnifeiasfm elnmp;u4trxrifciydopt lieo ()t2trxm ny4amen nct (f 2uau ont4apxn fetydlaDuln p t)arenir3to1lat aueils trtrxr3io4ape  ivilt s2rax poo4alxo octldfaDea(ms;()artomr io1lpD aies t)s2tr(m3iy4ap   ivsl(fsDrmumooo4tleoii3iysfa ra(vs;u4texoio tydlpDean o t) etr(rpnu1op emncilt s2um( pnt1tlx mi3tyd s elu o ()aexrmfcoodlmtr uvo (0t2umim nodllte ncsasfaDumxr ot4tpto octad s el(vonu)arerxr3to1oa eln o t0trumxr3ny1ope  ncil(faDurumpnt0olt io3iadfm2uan snt4alxomr oo1omtrluvi ( teuoxo3nydapeelfet s s2umxr nt4tltnifctyslm2emnvo ()trxomr3iy1oaDraivs;t)teur(m3nu1lltnlfviltf rtm( p;o0tlx ii3ild aDean pn(4treomf oydop eai s;t)seuoxm iudlmt lfetl( a2trx  no1apeo i3ilsfsDra(vo t) reoir oo1lp  li s s seum(o nodamtelivias  Dur(  ou1aptomi3taslm ea( on(0aleoio3oatfa r ueo;t0trtoxr3oo4lpe mfvsa()sDrrxronu1opt mfeild mDulumsnt)tetrirciadoa  ln o;()srxm(o3nu4lle lnei t  2tmump;o4alt mo3iadfs ulnms;t)arenmo3iadoa  aiei s)setm(m3oo1apenmiciltf Dtau o;t1alxniieild m rmuvpn(4 lenxo3oodlatr n i ()srxmiopou1am nmnvtat  Dur(rp;u1ale ifetltlm2em(vo;t0 leriociy1lpteluvs;t trur(o3iu4lmen ics ( srtruronu1tet iocildls2rluvont4aexnio oy1fm  li o;()t2xmiopiydlle mietls  rrmumoou1opto oetaslmDuanvpnt4artrmr totomDeanei;t)t2xrir3oo1olt  nvsl(  2trxmonu1oet  ocildfm uanvo;u0teeomo3tadla  aivo;(0t2xrxr oo1lptn ivt () Drax  ou4olen o3tadls2ean onu0artomo oo1oa rluvo;s srtmxm3io4lpen iet tf rraxmpnt0tlxomf3iatlaDua(vsn(0 rtoxo oytomDrlu s s)s2tm(mpnu1llee nesl(  2urxm ;t4optniieiasfaDuauvp u)aetrxf3oo1fm ranvols)tetr(r3nydop  lnvt s  Dtrumonu0oexoif3iyt s raums;u4trtrmo oytfat  nvo s)texoir3nydlpen fetatfa2raxrpot4aleomfeildlmDumu s;t0trxrirciy1om  luei;s0 exoimpnu4ame mivtas  rtmx pnt0tpxnmi3iasla emnvo;u4 etrxfctytfpD auvs;t) 2tm(o3iy4amtelietlt a2tr(rp;o1tetomoeiydfmDulnmo t)tlenmo3ty1laDrlues;s0srtm(rpoy4op elictls a2rrurpnu0oeto feiadlm elnvpnt0tlxrircoytlmD  i i s  rxr(rpnudapenliei s) 2uaxmoot1aeenioetatls2rlnvonu4 ltnxr3tatlaD livi;s)srumiopiy4ap   ici (fs2rr(rp;u4oetnii3tas s ea(mon() etnircoodfa  luvi;( srur(opnodal   netlt)sruru poo0teeoio3tydfaDrmn pnt)texrio iytoaD  neils srum(opiudlmt lnesatfa2taxr ;o1tee  octatfs2emuvp t0 reomr oa1fmD anvo s0 rxm(r nu4ll n nvtas)a2rrxm ot1tlxoiieiasfm2eaump (0areoirciadfa rlieil(0texmxo3nudamenlfcsat) 2umxm ou1tptomicilt a elu s u)arxriocoy1opte ivo t  exrxr nu1op elfetas)aDua(roou4aetomictaslaDuanvsn()arxoifcoo1fp r nes;t)s2xmio oo4op e ieiat)aruaump;u4aleoif3tlslaDum(vs u)teenxocoadfatrlies;s t2um(m nodlmte iesas  2trx  ou1tpx mietaslmDuan s;t4areomrcio1fm raneo;( s2xm(m nydlm  lieiat)a2trxr nt1tpeniieiydlsDrl(vs;u) etnxociy1op   ivi () ruoio3io4oltnmnctltfs2uaur oo1tlenmociysls um(ms t4arxrmfcto1laDrli s;t0 eum(m3no4amtnlneiat)a2trxro;t0opt  icias aDul( o;() rtrio oytopDeaueo s trxrim3iu4lmtelieia()a2rr(m no4tltnmoeiys sDeanmo;t4 rxnxo3oadla  li i (0 euoim ny1lptn icias) 2raumo;u1oexo ictadla2rm(ms ()trxriocoydfp   ivi;s  2xr(o nydlm  lfvta(fsDrm( ono1ole  octysfs2umn p ()artrmo3tadfaDe ies t) ruoxm3oydam e ietls) ruaurpou4tptnioeildfaDua(mon(0 eerir3tatom e i i s) etoxm oodop  lncslt)s2umx p;o4aee mietaslm2ul(mo;t4 rxomf io1fp rlies s0sexrxrpnudlleemivtatfaruaumpot1oexo fctyd m el(vs;(4tltrxoctytfa  an slt srxoio oy4aptnlfvt (f 2tax pot1tpxnif3ias a ua(mon()arxnxr totfmDe nvs s0s2trxm3oy1alenmnei t  2raxmpnu0tee mociysfmDraumsn(0tlenmr3iatomtean ol()trurxm3nudlmtelfct t)sDrm(monu0aetnmieiyd s2umnvp;(0 rtnmo3oytomD  ueol()t2xr(o3oydame  nct t)s2tr(m ou0aetnmfetatla2emu o u0tltrmr3ty1optrlies;(0srxoir ny4lpte fvtltfaDurx  oo1tetnmoctasfa2ra( o;u4trerxf tadfp rln s s trum(o oo4omen fet tfa2tmxroou1tptnif3tyt s umnms u4 ltrxfciytom  au i;s texo(m no1lpt mivsa()aruaxr ;o0opxnifeiys m2ua(vo ()artoircio1omtrlu i ( s2toir3oo1altn ncs s)a2urxrpoo0oltn f3tldlsDra(vo;t4 eenmrcty1opDeau s t) ruoxopio4ape liesltfaDururont4olxnioetldfm2rln s t0altniocoydop   u i;s)seto(m3ny1amen fes t) rrrxm ;o0altnmieiytfa um(vs (4tetnxoctydlp  li ils) 2urxopno1alt  ict ()a2tr(  nu4alenmictlt s um(vp t0alxnxocia1lmDeauvi;(0 exrxm3iydol  lfeiltf 2tmxr ;o4aptomo3ias a2emuvo;(0aexoxrcoo1opt aieo;t) 2xrim3ou4ope mnvia( arrmx oot4alxnifetytfaDul(von()altrir3ta1fat auei (0texr(o3ny1amt  nvsl(fsDurxrpot0alx  i3tls s ul( ont) rxoxociodop eaivi;s0setoim no1lmt mncta( aDuaxmpou4altnio3tyd mDea(vp t0 etrmrciytlptr nes;s0trto(o iudolt  icsa(farrr(ro;t4aetn octatfsDea(mp;t4 ltrir3oy1lpDrauvs;(0t2trxm3oudaptnlfci tfaDtaurpou4ole  fetad a2eanvp t0trxnmr3iy1oa   ies;t0 2xrim3nodlltnlieilsfs2uru p;t4alxnio3tls m rlnmonu0tetrxo3ia1opDr uvo;( s2xr(opou1amenlicta(faDua(r oo4apeoii3tldfaDrmuvp;t)aexomr iotoate nvi;t  rur(opiy4ale  fvsl( aDumur ot1tpx mi3tytla2ea(vs;t) exomr iotomD  n s (0 rumio nydlmenmfcs () Duax  ;t4olx if3ias sDuanvo t0trxnmrciy1fa e u slt0 ruoxo no4lme lietlt s2uax  no0aet mi3tys sDrmnvpnt)altniociodfm eai i;t) rur(m nu1amee iesas) rurxm nt1aet iieiyt aDemnmp u) ltomrctytlpDe uvi;t sexo(rpio4lme lfes (  rumumoou1apx mf3iyt m uau snu4aetrif3ta1laDeln i (0 rtrim oydome  ict s artrxrp;o4ale  oeilsfa2uln s;t4tlxnmf ia1om r nvol(0 2xmiopno1lm elfesat  Dtm(m oo1apenifeiltlmDemnmpn() lermrcia1fmDrlueo s0s2xrxo nu4amtnmfcsas s2raxrooo4tpxnmo3iadfaDrlums ()alermr ta1fm ean sl( trumir3ny1ameemfvi t sDrmump;o1aee io3tltfa rl(mo;(4tetnio3totfp elivo s) exoir3iydope liviltfaDtmum ou0alx  ieildfa rln s () leoio3oa1om eanvs t0 rumio nu1lm e nes t s2trxmonu4oee iieiad aDra(vo () etrmo3oydfm  aneol(0t2xo(o oo1ap n nvsas arra(rp;o4tptn i3iadfs emuvs;()tltrmfciatfp rlu s;t) exoiopoydam nmnvilt)arur(  nt0tlen fciad s uauvs u0 etoiocoydoaDran ilt)seuoimpnydomtelnctl(f 2rrumpnu0aexo iciys s2ran p u0 rerxo3tatfa r n ol(0 rtoxo3no4amte ici t)s2ur(mp;u1aptoii3tytlaDua( o t0tetnirciodfaD  i o () 2urir3iu4al nlies tf rur( o;t4oet  fetysfm um(vsnu)trtrxr3iadoaD lueo s)trurxr3oo1olte iet ()a2ur(mo;u0oeeoio3ilsfs ulu p;u)tetnmf io1opDe ivols0trtmxo3ou1ll  miet tf Drr(rpnt1oexnioeiyd m eauvp;() lerio3iydfmtr uvo;t)teuoxopnudllt mfcsat)s2rr(m no4aexn iciadls rln p (4 exnio oydlpte u i s)sexr(r3oudllenlicsa(f Dtaum ot4texn o3iltlsDumn pnt4 etrxrcty1om eluei;t srxrio oo1am emiei sf rrr(r ot4alxnmi3tad m rl(vo;t0 lxnxr tydlate ies;t)texr(m oy4lp elictlsfs2rax oou4aee ifetadfa2ulnms;(4artnxr3iatfmDeau s;s0trtr(opnudope livil(faDum(rp;t1tet moeildlsDemump;u4 rxrio oa1optr iesl() rumio3oydamenlfesa( arua(mont1oleo ieiadlsDum(vsnt0aleomociadomtrlues;s  rtrxm no4lmt mnvsls)s2rrxr ;o0aeenmieiyd a2rau p u4tlxnir tytop rlueo;(0 rxriopio1altnmfeias)aruaumpnu4tpxn oetadla2emnmo t0altnif oy1lp  aiei;()texo(m io1lm n fvia(farum(  no0oexo f3tld m2ranmont)arxoif3oadopt aies;t0trxrxrpnodapt  ictl( aDrmxmoot4oeeoif3tyd s2rmu s u)texnio3totoa r n o;()sruoio3iydlpe mnvtasfaDtaurp;u4opx moetasls2em(vs (0trxomr ia1faDrluvo;t)seuo(r3oo1aptemncs t aDumumpoo1tpeomocilslaDemnmon()tlxniocoydlat auvsl()t2tmio iy4amtnmivta(fsDtrum ou4texomf3iltfsDuanvpnu0alxoir3iodlat  n o s  etoim3oydlpt lfcil()aruau p;o1tptomf3iltfs2ua(ms;t4aeermo oy1lmtrauvi t0 euoxr io1lpenmnvtas a2trx o;u0tpe  oetld sDumumsnt) eerxocta1fmt  ueol(0trxr(r nu4lp emfcils  Drr( pnu4aeto fctytlsDuanvp t) etrmrciydoaDraieol()trum(r oydam  mfvsltfs2trxmpou4opxn ocias m rl(mo;u0arxrxoctydopt lu ols  etr(o3iu1om  livi s  2rmxmoot0tltomo3tat mDumnvs (4arxniociadlp  livs s0s2xo(r3iy1lltnlfes s s2tm( ooo4optoifetatls2rlnvo;u4 rxrxrctodomtrlnvo;s srtr(r iodale lfvslsfartr( p;t1oetnii3tltlaDum(vp;()arenif3ty1lp   n sl(0srtr(o ou1alee iet tf Dtaxrpnt0tpto ictls m2raumpnu)trenmocia1fptrln o;s0 etm(r nu4open fvt sfsDrm( oou4ope iociltfa2ra(vpnu4altrmf3oytom r ieils)t2xr(r3oydlptn fvsas) Duru ooo0tpto f3iatlm rlnvo t)artoif3iotfmD anvs;s0sruo(m3io4lptn nvs s artru o;t0apeomiciytlm ra( pnt)tlenio iadlp  ai s s t2xmxr3no4al emici ()sDuaurp;o4tpt io3iatfm ua(mpn(0trtnmrctodlat  nvslt t2to(o3iudomtelnes s arrax onu4aet moeildfa elu sn(4 eerxf3iodomDrlueo;(  rumim iudol nlicilsf rtrxr nu4tltn i3tadfm emn o t) lxnxf oy1lp eauvs s  rxmxmpnydol   ietls)aDurxro;u4apto feiytla elnmo;t4arenxfcoodopD  iei t0trxo(opou4ol e fes t sruaxro;u4aeto fcilt s umuvp ()tetnxo iadla r i ols0texoxm3iu4llee fvia() Dum(mo;t1aexoiictytfm rlnvs (4aexoxrcta1omD  i o;t t2tm(mpoydlmenlneias  rurum oo1tetoio3ilsfm emu o;u)trxomfcoa1op e uei;s)sexoimpio4lmtemfvi tfsDtmurp;t1tex if3tlt aDrl( on()alenif oo1lm  auei;s)texm(o ny1olt  ncsa(  Dur(mooo4opxniociysfm2eaums () exrifcoytomt lueols)srxr(m iu1lm  mfvt s) Dtrumpot4oeeomicils aDrl(ms;u0aeeoif3totfat aueo;t)srxo(o3iu1lm e fesat)arumurp;o0opxomietld aDumnvo;()treomr3tadla eaues (  rumxm oo1optnmieias) Drmx poo1tlxnii3iaslaDuanmp u0tltoxo ootfmteauvol(  eum(r nodllt  fvt (fsrum(rp;t4olx mietyt aDeln s u4 etrif oydlpDrlu o;()setrxo3oudomt mfesa()s2tru p;o0tpto fctlt aDean s u0 lenxr oodlmt liei s0 euo(mpno4olt licsl(  2uaxmo;o0apx  ieiltlm raump;(0trxoio3oodfm eli i;()seumim3oo4ame lnciatfs2ur( o;o4aleo ietldfm eau o (4 exomo oodopDr i o s)sexoir3ny4optnmnvs ()aDtax oot1olxn i3iadfa2el(vo (0tltoioctatoa elivo;s  ruoim3oy4lmtemnvs sfsDtmu pno4alx io3iyt a2ean s t0tlerir tatlmDrlnvi;( sruoxo no4lptn ivsas)aDrm(rono4ole  fctad s ul( p;u) rxoifctodfmte ieil()trxo(o3nu1omt lfeia() Duaurpnu1texnmo3tldla2rm( snt)tlxrmr tatfaDeli o;t)srxr(rpny4altemivtat  Dra(r ;u4tpenmfetlslmDrl(mpnu)altrmfcoydlpt  n o ( t2uriopio1al e fctatf Dumu ooo4oeen ieildlm rlnvp;u0teeoiocoo1fpDeauvolt)s2toio3io1ole mnei () 2raxroot1alx mi3iadfm uluvp;t4aleomfctytom  an s;()s2toxm3iu4am n ivt ( a2ur(ro;t1olxo oetltlm2ulnmo u4 lxrifciy1latelueo;( s2xrio3nu1ole  ncil( a2tm(rpot1alto o3tadfaDulnvpnt4 reoir oo1opD ai o s srtmxmpno1lle mfcs ( sDuaxrpot1tlx moeils s eanmp u0aexnmfciytfptraivs s)srur(r no4amt  icil() Dtrum ;o4aex iictyt m em(mp (0arxrxo3tadfmDe uvs;( trum(opoy1apee fvi (fsrrmu pnt0oex mfciasla2rm( pn()alxnmr io1oa rlu sl(0s2xm(r3oodllenlfvi t) rum(r ;t4tlt if3iatfaDrlnvo (4tetrif tatopt lu slt0t2umxm iydlp   ivt tfsDururpnt1aex  oetadfs2emnvp t4tltnxocoadfmtraivols)teurio nudllenlivi ()aDrax pnt4openii3iyt aDem(vpnu4 etoxo3oy1faDeluesl()t2xrxo3no1ol nlietl(f 2rr(  nu1aexnmfetysla2rmn pn(0arxrmo3iodopte uvs;s s2toxo3oo1omte fcs tf rrmumoou1ope ii3tydla uanvsnt) lenmrcoodlptr ivolt)trxrxmpno1oleelnctlt aDta(mpot4tpenmfciytlm rmumonu)artnmo totlptr nei s) eurxopiudlptnlivi t)srur(mo;u4tpxoioctydfsDrlu o t4 exrmocoatfmtr u i;s0srtm(o iudam n netat sruaxrpnu4tlx mi3iadlaDuanvsnt4 lermf tatfm   ies t0srur(rpoy4lptnlivs ( artauro;t0aeeomfciys m2rmnmo;t0 rxnxo3tytlm rlnvols) 2xoxopoodope lncias)srta(rpou1ole  fciydfa rlnvo;t0tltoxfctadfatranvi t0trtrxo3ou1lp e iciat s2tru o;t4apxnmfeiadlmDum( on(0tlenxf tadoatraivo t)setmir3io4lle mnesat artm(m nt0altn o3tatlm2eau s;u0 rxnif ootop  ai s ( setm(m3io4ll nlivias arumx pno4oeeniicias m2ulu s;(0alenmfctydla e nvs t)s2xoxrpio1ap  lfctls  2ta(mpno4texoio3iysfm ulnvo ()tlxrio iadlm rln s;(  etm(m ou4lmt  fetat)srtmxrpou4alxnifeiat s eau s t)tltnxoctydlateanvi t srtoxm3iu1ap nlfcs t s2ur(ro;t1tltnifeildlm2raumsn(0 rtrmrcoatlp r nvi ( srtmxrpno4lp elfeta(fsDtaxroot0tlenmoctlsla2rlu o (0altomr3io1lpt  i sls)texmir3oo4lp  lnei tfartm( onu4tle  fctadlm rmums;u4trermf iadfmD luesls)srtoio3no4ape licia() rtr(mooo1aptn i3taslmDrl( p (4tlerircoytlp  livs;(0sruoir3oo4apeelfciltfa2trx  ;t4teto f3iydfaDem(mp;u)aetnmocoatlm  luvi () rxmxmpiydom nlivsa(f Dua(rpou1aex iieiytfa2rlnmonu0 rxnmo ty1fptrluvi s0tetrxr ou1lmenlivtl()s2uaxrpoo4oleomoetlsfs uau p (4trtrxrcoodlaD aivils) 2to(r io4ll   ict ()artr(m nu1ope mf3tadlm2umn p t) etrxo3iadoa  aivils)tetrxo3oo1ap nmnvsltfa2rax  nu0oeenmi3tys m2el(mp;t0 rxoxo3tytlmD livi;s  euoxo3iydal nlfvtlt) rtr(m ot0aet ifetad a ea(vpnu0 ltnif iytfmtr uei (0teurxrpno4lp emfvsa( srrru ooo1olenio3ilsfaDrmnvont)teenxoctydlm  aueo s0srto(m3nydale mfcslt sDuaxrp;u4open o3iyt s2emnmp;t0 rtrmo3ootlm rlu o t0setr(r nu4lpen nvs ( aDurx ono1tptn f3iadlm2uau ont4 rxnxfcio1oatr n s t) rxr(opny4lpt miciasfs2ta( pnu1oet ioeiadfm2ea( pnt)tlenmo3totfm ranvo s0 2urirpnodomee ietas s2trx p;t4tpto f3iadfsDulumpn()texoifciodla  livs;s)seumir3oo4aleelfcilsf rrmx p;u0tpeo i3ils aDulu on(4 etoxo to1lpDrlnesl(  2uoio3iodop e ivi ( srtrxrp;u4tptoif3tasfsDeluvo (0 ltnmr3ia1la  an o t0t2um(opiy1am  lfvi ()a2rm(r nu0oee iociatlaDel( o u4alxnif ootlmt  ieilt trtmio iudolenmfesasfsrtaumono0tlx mfcilt mDea(msnu0texnmr3oy1omt ai s s) 2xriopoy4lme lieiatfarraur nu4tle if3tatls emnms u)aleriocoodop eauvslt s2trxm iydlp   ies t)s2uaumpnu4tlt mociydls2umu snu4 ltoir3oatfmt lnes (0srtoir3no4op nmnvil(f 2trumo;u4aee mfciysla umumsnt4tetomf ty1fa raies;s trum(m3oo1lmtn ics ( aDurxm ;o4tpeo o3iat m emuvs ()tlerxf3oodlmDraiei;s)t2urim iydapen fvsls) rtrx ono4tee  f3iasls um(mp;(4 etoxo oytlpDelnvs s)trtr(rpoy1lpee ivtltfs2tr(mpoo4apxo fetldla el(vp;u)aexrxociadfpteaivs s0tetm(mpnudoptemfetlsfaDtm(r nt4oexoii3tytlmDulnvp u0altoxr ta1faDr uvsl()sruoxo oo1olt lnvi ()arraumoou4tpeniociasfm ra( s;t0 exomo3iydfaDraueo s)teuoimpnudam  lfvil(faDur(mo;t4oleoioeiydlm2rl(vp t4altrmo3todlaD lnesls  rur(r iy4lpee fet t s2urx pou4opt  icils a2umn snt4tlxniociotlp  livols)seuo(opoy4lm nlies sfaDrmxmooo4tet mo3tadfm ea( p t)tltrxo tadoatelies;s sexoxrpiy1omtemfeil(fs2tm(moot0olenmoctytlsDeaumsnt) eeoiociytlptraneslt0truoir3nodlmtnlfei t)sDrm(mo;o0tlenmictlslaDuan o;u0 leomf to1lpDr uei ( seum(o3oy4apenmfvtas  Drr(  nu1texnii3ilt mDrlu s u4areoirciotfpt auvol(0seum(m3io1amtn fes (fsDtrxmoot1tpt  fetls sDulnms (0trxrir tydla  aieslt0setm(mpiu4omtn fcia(fa2rr(moou4aetn ocildfm2rauvs;t4 exomocta1oaDeluvs (0 2xmirpoy1lmtelnvias) rrmumpot0apx  feiyslm2umnvsnu0teeoir tadoatraneilt0 2um(mpou1lmt  fvt () 2rr(root1aptn fctlt sDrm(vp;u0arenxrcoytlmt  ivi;t seuoxm3ny1aleelieslt aDumx  nt1tlxnmi3tldfs2em(vsnt)alxrircoatlp r n o s0setoxo3iy4omtemivtlt s2tm(mono0aleo i3ildla2ua(vo t)arxnxfcto1lm eai s t)seumxmpio1olenlici s) 2rrxrooo1tltomoeiyslaDrmn s;u)aexoir iytfpDelnvsl(0srtmxo oy1opeemfcia()srrax pnu4tlxo iciytfmDuauvp t0 etnxf3iydop r ivi (  exrxopiydlptelfciatf 2trurp;u1teeomoeiaslaDraumsn() ltnir oodomDe ues (0truoim3iu1oltemicsltfsDrm(mono0aeeomieiltlm2um( pn(0texnxo3iatlmtr uvsls)texmio iodlptnlict ()arrrxmp;t4opt  f3tls aDumnmpn() ltnxoctodoa rlu o;s0srum(opno1amtn nct s) rrruront1oexoiieiltla ua( o;()trxoxfctatlaDr uvi (0 2urxo oo1altelncsat)artrxr ;o4tlt  feiasfa em(mp (0 rerifcta1lptraneol(0srxoxo3iy4ol  mncsas  rtmxr no1aet if3ilsfm2raums u) lenxo3iodlmDrauvo ()setmir nydlpt mfes sfaDua(rpnu0aleomfciytlsDea(mo ()tlxrmr3oytomD luvo t0 rxmim nudam  lfvsa()arrmxmp;u4texniiciyd mDra(mp;()arenir3oa1oateanei;()s2ur(o oydaltn ieilt)sDtrx p;o0oet  i3ias s2uaump;t)trxrir to1faD aieil()sexoir3iu1lpenmnvsa() rta(rpou1tpt  fciysfa rmump;u0tleoxf3iodlp   ies;s t2ur(r iy1aleemietlt aDrr(root1tex mf3tls s2ra( s () exoxr3oydfmtrli o s0trtrim oydlpe  ncs sfsDrm(ront1aexnmfciytfs ranvs;(0 renxoctodfmDrai il(  rtoio oudolt  ictl(  rtaumo;t1tlxomiciatfmDeanvpn(4texrxo3ootfpteli s;t0t2uoxm oo1oleemfesa( sruaxmoou1tlxoiiciatfmDrm(vs u)alxnmo3iatom eauvslt0 eurio3oudomte ieil( s2tmx pno4olx iiciasls rlnms t0alerxfcoo1omtraivs;s)trtmxr oy1oltnlnvs (f Dtmxrpou0tpxo ociasfa2el(mp (0tetnif3iatlpD lu ilt)setr(mpoy4apeelfesltfarururpot1tpt  ociydls2uan o t) lxrir3iotfpD lneils) 2umir iydlm e nctl(fsDtrxmo;o0tptomoetadlmDeanmsn()tetomfcoydfa  an ol(0teuo(rpiu4amtnlncs t aDurump;o1aetomf3ils s emn s t4arxrmr tydla e neolt)srtoxopnodope mfeiat)s2ra( poo4tpe if3tysfsDumuvsnt) rtoir3iytlpte nvs t  rxrxm iodomee nvsls)s2rm(m ;u4opxnifciysfm ua( ont) eerxr3totomt  iesls  exrxm no4omtemiet tf rrm(mpnu4oet  i3ildfs2ulnmpnt)tetrxf3oa1lmt  i i;t)s2xmirpiodomenmfei (faDumurp;o1open ieiltfm umu o;(4alxrio oodfatr nvs (0texoxrpnudlpenmicil( a2tr( pou0olt  oetld a ul(mo (0areoxr3oa1fmte u o;()setoxm nydoptnlfct tfaDrr(rpno1tex iictld s ra(mo;t4teeoioctatomt auvilt0 exr(m3iodaleelfcsat  rtrx o;u1tpxnmoeilt a2ra( o u)aeenxr oo1lmDeanvs;( s2xo(r oydapte ictas)sDtmxm ;u0ale mietas aDel(mon(0 rxoir oa1fp rluvo t sexoxm oudap nmivi t s2trxmpou4tpxoii3iatfmDrmuvo (4artrxo3oydoaDrlnes s)s2um(r oydapte iesasfarurum nt0olt iiciltfa uanmp;u4tlenio3iytoatelivo ()sexm(m3io1lmen fvi (f 2umuront1optnmociltls em(mo;u0areoxfcoatlmt lues;s)srtmxo oo4ap  mics tf 2raurp;o1tetoioetytlsDel(vp (0aetomocto1optr ies (  rur(r io4om nlfvtasfa2tmxmono1tlenmieiaslm2rmnvo;u4 eerif3ia1lmt auvil()texmim3iudopt mfciat artaxroot0olx  f3iasfsDel(mpnu0artnif3to1fmtr uesl( t2xoxr3ou1alee fciatf Dur( pou1tptomocilsls rl(vont)tlenmf io1lp  aiei;(0t2xoxr io4ll nlnvt s aDta(m ;o1tex  octadfaDean snt0trerircootoa   u s s0s2uoxopnu4omeelivsl(faDtr(r nu4alt  o3ilt sDumu o (4aetrxo3tydfpte uvo;t0sruoxrpiu1op n fet s artaump;u1alxoio3ias s2eluvpnu4 lxrxr3io1omtrau s;s t2urim no4ap nmfvil() 2urumo;t0optoifeiyslm ranmp t4aetrmo3oadomte u ils t2ur(o ny4lmtemiciat  Dtr(  ou1texn fetasls em( o;u4 lermf todlm eln s;s tetrxr3oydal  licsa()sDua(r ot0tpeniocilt m2uau p;(4 rtnxocoy1fa  auvo (0srxoir iy4amen ivsasfarrrumpoo4tleniocilsfs eauvon() ltomr3oytomt aneo;() eumxopiu4lpt miciltf Dua(mpno1tpxnifeiltla2rln s t0arerxo iydopt lnvo;t0trtmim oudam emfcias  2uax oou0opxn icild a2ean pn(0 ltoircoa1laDeli o;t)trtoxmpiydol  mfes t sDtaxrono4oltomoeias m2elnvs;u0 exnif3iy1op elneo;()trur(r3iydlp emfvtls)arrrur ;t1apxn fciyt m rlnms;t) exoir3oydlaDe ieo ()s2tmir oy4lpt miesl( srrmu onu1tleo o3ildla eau s u0altrmr3oydfpt aiesls0t2to(m iy1lltn fcsat arurxr nu4texomfetatfaDraump (0 rxrxrcoydfpt aueo () eumxopoo1lm nlnvsltf 2rm(ronu1tpxo f3ias s eanvpnu0 exoxr3oadomDe u s;(0teum(rpnudom nmieils  2tmxmont1ape mi3tytlmDraums (4 lxoxo iadlat lnes;t) 2urio3iu1op e fcil( arumxmono4tptn ieiltls em(vp;() reomfcta1fpD  ivils0t2xm(opiodoltn ietltf Dra(rono4alenmfetysfs2um( p;u0arermf iodlaDeaieo s)trurim3oydlmeelivt () Drruroou1texoioctasls umn ont0aexrxfciodlmDrlivs (  2xmxm3iydop n fcsls)aDrmxm ot0aee  fciytla2rauvs (0texoxf3todfpD aivi () 2urxo3oo1lpenlnvia(f Drrumo;o4oexoifcilsfs2raums (0artnmr3tydlaDeau s (  eum(opoudol   nvtlt artm(mp;o4opx  o3ildlaDuluvo u) lxrxo 
\ No newline at end of file
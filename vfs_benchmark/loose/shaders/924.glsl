@@ -0,0 +1 @@
+n o;t0 exr(o nodllenlnetatfa2umuroot0oee  ietls a ea( o t4trxrmfciatlaD  uvol() rxo(m3no1omte iesas s2trurpoo1olenmf3iltfaDrm(vp;u) ltrxf tatfm   u o;()sexoimpiu4apenlnviat) rta(ro;o4tlx mietat a eluvpnt4alxrmo3oodfaDranei t)s2umxr nu4apt  nei (  2taxr nt0oeenmo3ias sDraump u)tlerxo iotfmtrlivslt s2toxm3ou1lp   netlt)aDum(mo;t0oltoioctlsls rm( s u0aleoir3iadfptr u o t0s2tm(o3no4ap   ncsatfsrumx  ;o1aex mictatfm ranvs;u) rxrxoctodlp eli i;s) 2urim io1lptelfciat) rrrurp;o4tltnioeild m uan s (0teenxo3iotlpD anvs s0s2xriopiy4amtnlicilt) rumuro;t0aptnio3tldlm2rm(vp t)tlenxf iy1om   uvils)s2urir iudoptnmfvs t) rtmxr oo4tlxoioeiad a2elums;t)tetrifcoytoaDr ues;() 2xrxr oydlm e nvs s) rra(ro;o0oetomi3iadfs rluvp;()aetrxr oytfaDr uvs (0trxrirpiy4ape mfvta( s2tau p;u0tptn ociadfm emn p;t)texnmr3tydfate uvslt  exmio3io4ll  lfes (f Dtaxrp;o4tpxomociltfm um(msnt) lxnif3iytoa eaivi t) etoim3iy4alee ivsa()arrrumooo0aet  ictat a ra( s u0 eenir oo1fpD aues;( texr(m3io4lleemfctl( s2rmump;o0texo fetasfm2eanms (4arxnio ta1faDeai il( srxmxrpoo4lm elfct tfarta( o;o0aee iiciat a2uanvsn(0 rxomr iydlm r ivsl( tetoim nudaleelfcs ()a2uaur oo4olx  oeils mDra( pnu)altnif iadlmDeanei;()srtoir ny1ol  mfvias  2tau ont0apxoifeilsfaDelumo u4teerxrciytoateau ilt0seumxm3nudlltnmnes tfarrmurono0aleniociatlaDeauvo;t0tltoif3oydoaDranei;s0tetm(o3oy4om emiet tfa2tr(  ;u4oltoifciad aDrln s;u4 exnmo3oadla  anvs s)seto(r nydlmtnlnes s)a2umxmpno4tetomieiltfa rmn s t0arerxo oydla e nvils sruoimpio1oltelnesa(  rrmxm no1opxnmiciydla2rluvs;t0 lenircoo1oa   uvi t srxmxo3no4lptelietls) 2ta( ooo0tpx  ietaslm eluvon() rtnmoctadlmDraueo ( t2toir3oudll emieias  2ra(  no1oeeomociadlm rm( snu0 rxoxo to1fp   nvsl( texmir3nudomeemicta()sDur(r ;o1oeen feiytfsDra( ont) exnir3oa1fmt auei;( srtrio iydalenmieia()a2um(ronu4opxo i3iydlm2ran o u0trtrxf iytlpDranvslt sruriopiudalee nci s artrxm ;t4ape  o3iltfm um(vp u)arermfcootlpteanvi s truoiopnudalt lnvta() 2rr(rpno4ole iieias m2ea(mo;(4 ltrxfcio1lp ran sl(  2xmio3nu1al n fcsatfsDrruront4alt  ieildfs rmump u0alxnxrcta1fp  an s;s0 exrim3oydam  mnvt tf rua( pou1opeo oetat mDra(vo;t4arenmrcio1faD  nes;(0 ruoxr no1olee ncil()srta(  ;t1tpeoifeildfsDum(vsnt0altoxf3tytla elnvol( teurxo3nu4llenmfcsltf Dra(  ;u1tet  ocils m2em(vs;u0altrio ia1fatrlnvo;s  2uoir3oudoltnlivtatfs2rmurpoo0teeomo3iyslsDrlnvs t)aeeoxr oatlat ln sl() rtoim iodlltn fvsl(faDraxro;u1oee mi3ildls ea(vpnu4aeeomo to1lptrauvi;s0teum(opny1ap n fcs ( a2uru ono1apenioeiadfa2rauvp;t0 renmfcoadfpte ivolt0s2um(opiydaltnlfviasf rra(rpoo0ole ioeiysfsDum( onu)artoxfctadlp r ues t0trumir3oo4lleelici (faDraxrp;t0aetoioetyslmDrmu p;t4 rermr tadomt  i ilt setriopiu1lpenmivs t aDur(roou4apt  fcias sDem(mpn() leoxf iytfaDraivs;s s2ur(r3nodoleemicil() Drmxmo;t0aeeo fctatlaDulnvpnt4 rtnio oo1la e iei;() eum(m3nydll nliet tf Drau poo1tpto ietyt a eau s u0aexrmo3oa1op ranei;t s2xm(r3iudapt mnvtat)sDrrxrp;u1tltomi3iys aDranvs;t) reomfcta1laDelnvsls0srtmio3ny4olen nvs t)srtr(m ot1oeen f3iysfs um( s t4texrio3tydlaD anvi (0setrxo ou4llenmnctl() Dum(mpnt4tpe  fctytfm eauvo;t4tlxrir iodfa ean s s  etm(m3iy4ame mnei s) 2tm(  no4tltomfciat sDelumsnu4 rxomrcoo1opDrlneo;t0 exm(r3no1ome  ncs s s2rm(mpot4opxnioetlsfm2em(vsnt)arenio to1lat livs;(0trtoxr iodlm e nct tfa2ra(mpno0oexo iciysfm2rmu on(0 eenirciadlmte ivslt)sruo(r3iu4amee fct (  2trxmonu0opeoifciasfa rmnvpn()areoxo oydlaD lu s;(0 2xm(o3oo1lp e nctlsfarrm(rpoo1tet ioeias s2ua(vonu0 leoifcoytfpDe uvs;( sexrir3nydllt mfctlt arrr(m nt0olx  ieias a2ua(vp;(0 lerxocoodfp e ivo;t sexr(r3no1omee ieta()sDrmu  nt0tpe mieiasfa2ranmp t4 rtnio3oytfpD  n s;s  2toxrpnu4omtnmfvtat)sDtmx  ;u4apx  ocildfm el(ms t4 rxnif3io1lpDe ueo s0 etoiopio4lpe lnes t)s2rru  oo0olxnmo3tldlaDranmp u) etnifcoo1oa e i o;(0texmxr oudlleelnesa()srrau ont0tpen i3iysla el(mp;t0 exoxo3tytlaD li i;t teurxm iydopeelfvi ( aruaumpoo4optnmfeildlm2ul( p t) rtomf3oy1laDrlnvilt s2uo(rpou1llen nvil(f rrm(r ;u4oet ifeiyslmDul( pnu)arermf3ty1lmD  ivo (  rtmxo io4lltemfvslsfaDtr( onu4oetnifetydlaDeaumo t) eeomr3oa1optelnvo;s)srurio nydape mnes t sDuru pno0oltnif3ilsls2ean snu0alxrmocio1opD  i slt0trurxmpnu4omt  fvtlt srumxmont0oee  fetasfsDum(von()alerxr oadla rlnvols trtm(m3iu4ol  mncsl( a2ua(  ;t0aetoioeiyslaDemump ()tetriociy1laDeln o;(0srumimpoo4om   neia(fsDtrxm nt4optnmi3tytla2eluvs () lxnio oy1fmDraivi () eum(r ou4ll   fvtlsfsrrrum oo0tee mo3iatlaDeluvs;()aetoir ta1oatrli ol( truoim oo4lpe mivi t) rrr(  ou0tltoif3ilt m ua(mo t0alxomf tydlm  aueolt)srxrirpiy4amtn neia(fa2rr( ooo1teeo oetydla2uauvsn() renircta1omDran o (0 2trirpiodlmtnlies sfa2rm(m ;u0tpxomociadfs ean o;u4tlxrxf3ty1lat lnvo;() 2tmxopno4omt lfesas) Drmx  ;o1aeeniiciyt a eluvonu4tleomf iydoaD lnes;t) 2toio3no4om   nctlt)arur( o;u1apt  feiydlm2rmu p (0aetrmr tytfpD lu o s tetrio oudlpte netlsfs2rrxmoot0apt iietydla rlums ()artrxf3tadfatranvs (  rxr(o3iy1lptemivslt  rtrurpnt4altnioeildfsDemu pnt)trermo iotom elivsls0trumir oo4ol  mfvi s aDta(r nu4aleomfciyt m2rl(vs;(0 reoirciadlmtrluvi;t) rum(m3iy4omtemics t)sDur(mont0apeoio3iys m umuvont4 rerxo tadoat  n i t srtr(mpnu4lpe mfctas  2uax ooo0tptomfctld a2em(mpnu4alxnxf3iodfp   nes;()seto(opno1ape  fcia( srumur nt1aeto ietld m rm(vsnt0aleoirciatop   n o;s) 2tm(rpoudapeelncia(fsDraur nu4tlxniieiltla2rl(ms ()artoxrctotfat lu o s0 2xmirpnudlme lictls a2ta(mp;t4tpxomicilslsDean ont0altrifcoatlpD  n sl(0 ruoirpiydop  lictas)a2umxronu4teeomictysfaDean p t) exomo iydfaD livs t)s2toxr3ou4alenmfctlsfsrtrumo;u1aeenifciytla2uanmp;(4aeermr3oatoat au s;()s2uriopno1olt  nesa( s2rr(mpnu4texoiocilslm2emumsnu0trtnxf ia1fmD  i i;t0s2urirpou1ol  mncs ()sDrr(m ou1optnio3tlt a2ean snt0 reoif3oo1optrai ilt0s2uoxm3io4omtn ncilsf 2tmxr nu0tpen fctldlmDel(ms (0 rxnif3iytop rlnei (  2tmxm3oo1omtelnetls sDrmxm oo1olen ictlsfsDemnmont4altoxr3iotfpt lu o ()t2toxrpoy4ol  miviasf rtrx  ;t0tpen ictlslm2ulnvo;u0 lenif3iydfm e ivi ( srur(rpoo4am elfvt (fsrrau  ot4olxn ietyslm2rm(mp (0trxnmf3totoa eaneils)srtoxmpoo4op n ncsl(  Drmxr ;u1aexnio3iadlsDrl( s;u0aexoiociodoatraieo;s seuoiopno1aptn fcslt) rta(ront1aeeoifeildfsDum(vp;t4texnio3tydfa eauvo;s0setoxm3ny1lpteliesatfsDta(rpnu4opeo feildlm2elu pnt4aeermo3oo1opDr ieolt)srurxm3iydlp nmivtasfs2raumoot1aptnmi3ildfs2ran o t4tetoxf oadoptr u ols0sexoxm nu4alt lfcta(fa2tm(rpno1opxn feiytlsDrlu o;()alxrxo3iatop  lu i;(0t2tm(r iy1olt lieilsfs2raxrpou0olenif3iat a rm( snt4 ltoxociodfptrlnvo t seto(o3nudomeelnctat)srum(mpot4alxnmi3iasfsDrluvsnu)aexoio3oodlmD luei t0 exm(opoudlp emfctlt) rra(mpoo1olt  o3tld s em(mo;()tlxrifcia1op  lu olt)t2xrxr oo4ap elfct sfartaumoou0oeeniieiad m em( pn()teeoifctodfpt aivsls0 2um(o nodaltn ncsasf Dtr(root1oexo iciad a uluvpnt0aeenir3tatlateaivi ()sexo(mpiy1omtemici t)sDtrurpnu1teto fctadls eaumo;()arxrxf oa1lpDrlneo;s texo(opoydop elictls)s2tmurooo0openioetad aDra(mont0 eeoiocto1opDelu sl( s2umimpou4lpenmfcias) 2rr(m no1apxomfeiatlm2eluvs (0altoif to1lat auvs s t2xm(mpio1am  mivt (  Duru ooo1olenmocilt m uaump;t)alxrirciy1fmDeauvs t)teur(opno4am nlfvsl(  Dtr(rpou4apxo o3tydls2uaumont) rxnmr3oatopDran s s)t2umim no4olee fet t) rum(ront0optoii3tyd mDulu p t0altoxr iodfmDr nei t0sexo(r oydoltemnet s)a2rrx o;t1opeomi3tyslmDum(msnt0tltnif ootlaD  nvsl(0texr(m3ny1om nmncsatf 2rr(mo;u4tee ifciatfaDranmo u4 lxoir ia1omte n slt t2ur(o3nodlleelfvsas  rur(mpou0oee  f3iyt s2rlnms u)trxnif oadomteln s s seumir3oo4ale  nctls)artmx pnu0opt  ieilsfa emumo;(4tetrxf3oydom   ueol(0 2trxmpnydll elfvsatfsDtm(r ou0tlen f3tlslm2uau snt4 etoxr iytom rai o t0t2xriopno4al   nvt s) rta(r no1tex moeiadfa2eanmpnt4trtoio3totlatranvi;s  ruoxr3oo4aptelfvt sf rtmurpot1tptn ietasfsDelnms () reoio ta1lpDr uvo;s  rxmirpio1ope mivs ( a2uru  nu0ole mf3iatfs ra( pn(0arxnxfcoytoa e uesl(0texo(mpiu1llee nesls sDrmxr nu0ole ifciat sDeauvp u0tleoxocia1laD luei (0t2urio io1opt mnesat aDraxmoou0alxnmicias mDeaumo;u0 reoxf oytla rli s;s s2urxo nu4opeemics sf Dtm(ro;t1apeoiieiad aDul(vs;t4teermrcty1fm rauvilt s2trxm3oudom elnesa() Dum(  ot1opx  ociltlaDum(mo;(0alxrir iydlpt livols0 etmio io4opee nciat)arurum no0oltnifeiyt m2ranmo;u0 rerir3iytom ran i;( seuo(m oy1ope lnet sf Draxmono1tpenii3tadls eanmo (4arxnircoo1lpte u ol(  2xrio3ny4amtnlnctlt)srtrxrooo0tet  f3tls a2rau on() eeomf3ootlmtrluvo;( t2uo(r3oydlm nmfes s  rua(mpou0aee ii3iltla ua( p u0altrmrcoytomDrau o;t0 2um(r3iydomtnmici tfsDuru ono1oetomoetasla ul( ont0tleoxr3tadlatelnvi () 2xrxrpny4lme  fvi tfsDumur oo0optniietatlaDrlu sn()tlxnifcoatlmteliei s0s2umir iu1opt mnvta()aDrrurpou4ope if3tad a2rm( snu0 rxnmrcootomDr iesl(  rxoxo io1olenlneil() 2rmxm ;u0tex ii3taslm emuvo u0tetnxf tytfa elivo;(0 etrir iy4lp nmnei t sDrru  oo4tptnio3ildlm rl( s;(4 etrxo oatomtelies;()trtmxm3oodllen net (  2tmxr ou0ape ii3tad m umu s t0alenmf oo1fpDe ieo;s0truoxopio1op n neia( s2ur(rpnu4openmiciytfa2ea( p t) lerir3io1fa  luei;t) exmxmpoy1omeelfesa( srur(m ;u4oeenii3tytlmDem(vo t4aexoif3tatfaDeln ol()srtoirpnodllenlfvtlt) 2ra(rpoo0apenmfciytfaDemuvs () etoxfcty1fa eai i ()sexmir3ou1lp nmfcs (  2trxr nu4alxn icias mDrau pn()alenmf3tatfa eai o;( t2tm(r3oodll nlfvsl(  Dtmur ;t4tpen oeiasfsDemnvp u4texoir3ta1fatr i s;( s2xm(rpnu4optnmiesa()srrrur ;o0alx  i3iyd m2emuvs;u0 rtrmr3tadlp elu o;()t2toxo3ou1lm elfctasf 2ra(r no4tpenmf3iydls ra( pn()tlxoxo3ty1opDraies;s)t2tmio3oo1aptelfct ()s2um(rpoo4tlx  f3tyd mDrlnmsnt4arermo iatlpDr ies (0 etmir oy4lltnlfctat aDumxmoot4oexoioeiytlm2elump (4aexoioctydfpt ln i s)t2xoirpiodlpt  netat)srtm(mooo4tpt moeiltlm emn onu4teeoir3oa1fatrai i (0trxrxr oodlmt  fcilt a2ta(mp;u1aetomfeiad m umn p;u4aexoir oy1op elnvs t)trur(rpio4omte nctat) Dtrxr ;u4oetnmfetltlmDuln snt4texnxrcoytomtr ivo;(  2xmio3ou1apt lnesas)aDta(moou1aee mo3tat sDrlnvo () lermr3io1omtrai o (0s2uo(m3oy4lpee fet ( arur( p;u1tet  i3tlsfa uau o u)texrio iy1fp  an ol( sexmio iydap nlivt ()aDrmu  ;t1alen oeiyt mDea( snt0 ltrmf iy1oa e uvils t2trxm io1lpte fctasf rtrur nt0apto fcild aDelnmsnt4tltrir3oodlp eauei;()s2trir no1ol nmnctatf rrmxm no0olxo oetasfsDul(vs u0 rtnxf3iotfpDr ieils)s2xriopno4ame  ivilt)s2ra(mpnt4tlenii3iat s eauvo;u0aeeoirctytopDr ivo (0teumxr iu4om   ncils aDrr(  nu1oeen iciltfmDumnmp;t)texoxocoa1opDeaieils0sexrxr3iu4ap  lies t s2tm(roou1aet  fciltfaDrmnvs t4 ltnmo iotfp elneo;s) rxmxr3ny4om e ietlt a2raxmooo0aptomfcildla rl( o;u0 rxnmoctadlpD luvs;s  2to(o3ny4om   netatf 2tr(r ;t0tpt iicilslmDul( o;u0texrif iadlm e n s t0trtm(opoo1omtelfvs ( aruaump;o4alx mf3iaslm ranmo;(4 renxrctydfmD auvo;()setoim nu1ope lneiltfs2rm(mpot1altoiictyt aDrluvp;u0alxnmo iytlp   neslt0t2um(opnydlptn iciasf 2rmum ou4aexomf3tat m ra( s;t0alxnxrcoodoa eai ilt)sexr(r nu1lmtnlfvils)aDtr(moot1oltomoeiltfa2eln o;(0tlenxo3oadfpt luvolt0setr(rpnydol n nctas)sDtm(monu0olenmociadfa2um(msn() ltrifciytom rlu i (0 eum(rpio4alenmfcslsfsrraum oo0aleomicilsfaDel(mo;t)trxoxf ootoatean i;t0srxrxm ou1opee fci t aDtaxrp;t1tetomfciys m2ra( o t4arenmocio1fmDr uvils  rtr(opou1lpt  fvia(fsDrm( p;u0aptnmoctys aDrmumo (0 ltoxr3oa1lm e neils) exmio nudlmen fvslt a2ur(m ;o1aptn ieildlm um( onu4tetomf3iodopDraues s  rtrxm3iudop e fci s  2taxm ;o1olt io3iysfa2rlu ont) rtnxo3oy1latelnei;s  rtoio3oy1opte fet tf 2taxm oo4tee ifeildls ea( p;u0 lermf iydoaDran sls) exmir3nodopee ivsl(fsrta( pou0altoifeiadls umumsn(4tetnif iodoaD  nvi t0 rto(opoo4lmtemfci s  2tru pot0apeoifetldfm rmuvsnu4 renmf3iy1opDr iei ( tetoimpio4ole lici s)arrmumooo0tex  iciysfm ea( o;(0trtoxo3ootlp  an ilt0 rurxr3oo4llenlnvilsfsDrr( pnu4texo ietydfa ulu o;u0tltrxrciytlpDeauvi ()seurxo3iodomtnmneiat sDum(m no0olen oeiad m2um(vo;u4trtrxf3iodfp rlies;() 2xm(m ou4lltnlnci s  2tru  ou0tptomf3iyt s uaump;()arxomo iydlpt ai sl(0srtmxm3iydllenmivsls artmu o;o0oet iicildfs2ul( onu)teeoxrcoo1lat an slt0 rxoxm3oodamtnmfetatf Duau  ot1ope ifetatlm emnvp t4 lenif3ia1fp r u i s0truoirpio1ll  miei ( sDrrxmo;t4aleoiiciyd m2ua(mo u0 rtomf3oydla ran s;(  etr(rpiu1lmtn iesa()srrau o;t4apt moetydfaDrl( pnu0 eerir3totomtrau ols t2xmxrpnydameelfeiatf Dururp;u1oetnmf3iatls emu o u4artrifcia1fmtraivi;t)tetoxmpoodom elfcsls a2uaxrpnu0tex  octyt m2ulnvo;() rtrir3to1lmt aivo;(0 eumir nu1al emfesasfs2rrur ou1opxoifeilt a rm(ms;u)texrxfcta1oaD  uvilt0srtmim3no4lpt lfeslsf Drmu p;u1tpxnmfciyd a eaumo u0trtnio3oa1lpDe ies (0trtoio3no1lm  lnctasfs2ua(moot4opxoiietldla2ulu o;u)aeenmo3tydfm r u i;t)t2xoim io4ll emncs (f 2ururpnu4aptnifeiyt aDrln sn(4artoxf3ootoateaieil()seuoir3iudlptemfvs (  rururo;t4olxnif3tld mDumnvo;t0altnmocoy1oate n i (  2tr(opno4op eliet sfs2rrxront4opx  feiadfmDrl(vs;u0altnxfcoatom rlu il(0tetoiopiu4lp n ietas sDtrx  ;u1oee ioetadlaDra(vo u)trenioctydfaD  neolt0 etm(mpou1lmtelnctls sDrmurp;u1alxoioctad a rlnmo t)trxnmfcoo1fmDe u s ( t2tmiopnodlp nmnet tfaDrmurp;t1oltnmo3tatlm uauvonu4alerif3ta1fpD  uvi;()teumxopoodlmenlictat) rur(  nu0tlto i3iyt sDrl( s;()tleoio oa1fpDrlnvs t0teumiopiy1ll emneslt)s2trx o;u4olen f3tlt sDrauvp;(4tetoir3ta1lat  ues;()trxmxo no4omeemnvsat)srrmxmo;o4alxniociaslmDrluvo () exrif oo1la  lueols0tetrxr iu1olte fes s) rtmx  nu0tltn f3tydfs2ul(mo t0 eeomrcoa1fmD  ueo;() etmim iodlmt  fvslt a2um(  ;u0opeomoetatfm ulnvp;t4 ltoxo iadfpt  iei t)teumirpiu1amtemivi tf rrm(mp;u1tpx mo3tydla ua( o;u4 reoif3iotoatrln i;s s2xm(r iu1am emieslt)sDuau oot1tlx if3ildls ra(vpnu)tlxnmo ty1fa eln il( s2tm(r ou4lpte fes s)srum(mpot4tex  fciasfsDel(mpnt0aexrif tytlpt li s;(0trur(o3ny4ole mfvi sfaDuru ooo0ole iiciadfsDraumo (4 etomo oo1fatr nvs ( trum(r3no4lp  lieias)srumurono0olen fetltla rm( pn()aetrif todom ranvilt  rtoxmpiy4omenmnes sf rurum ;u4oet ioetyt m2el( on(4 eeoxf oodlpteau i t tetrxr oy4aleelnet () rtrxmoot4ope  i3tasfa uan snu0tetrxo3iytfatr iei s0 eurirpiu4apen nvi s)srrrum no1apeoioetadlaDuluvsnu)tlermrciotfm  aies;s)s2triopno4ale livsa(fs2rr( p;u1aet mi3ilsfsDrmuvpn(4aeenxr oodfm r nvils) ruo(r3iu1alenmfci s) ruaumo;u0apx  o3ild m2rluvs;u) lxnmocoadoaDelu s;(0s2tmiopny1lm nmivs t s2trumpnt0oeeoii3iltfm2rlumo;u) lerio3oatfptraies t  etoio oydll   fvs t a2tm(r nu4oltnmiciadlm2emu ont0 leoxo3iotomt au o () 2xr(m iodap  mnei s)aDtr( o;u4tlen ociys s rlnvo;t4teeomfctodoaD ai i;()texoxo nu4ape mics () 2ra(mont0oet mieiatlm umnmsnu4 lxomfctotlptrlivs ( srxo(m oo4om e fet t)a2uaxro;t1aeto fciys sDelnvpnt4tltoio3oatfmte nei s0srtr(rpoy1lltemfvs s srrrur ;t0tex ifciytfa ra( s;(0arxoxo oydlmDrln s;t) rur(r3oo1alenlfvtatfsDtmxmooo0oexnifetlslmDuln s (0aexomfcty1fmDeaueils  rum(o3ou1lpeemfcsl(  2uau pot1tpxo f3iatlm ranvpnt)trxnxociotla  ln s;t  rtrxo3no1olt lnviat aDuaxrpoo0apx mo3tyt s ua(vo;t)aetoxo3oo1opDe i o;s)t2uoxm iu4lmee icilt  2urxm ;t1aleo fetls m2ua(vpn(0 etnir3oo1fpDr uvols)setm(rpoodolt  fvsl() 2ta(  nt1opxoifcilt aDrlnms u4aetnmfctydla elivs t)sexoxr3oy1olenlfcsa( arurumo;u0apen feilt m ra(vo u0altrxfctatfpt lnvs s srxriopoudaltnlnvilt)srraumono0olxniietls m uanmp;u0trxoxf3iotlptr uei;t0t2urxo3iu1omen fviltfaDtmxrp;u0olx ifeiad m2umnmo;t) rxoxo totoate neo ( setr(o3iudlm nmncil(  Drmxmpoo0tlen ietlsfaDulu snu0arenmf tatoa rauesl()teuoxrpnu4omenmfct (  rtmum oo4aetoif3tlt m ua(ms;u0arenmrciydlmt  i s ( texrir3oy1lpe  iet s) Dum(r no0alt  i3iytlaDum( s;u0tlxoircoo1fptr ivo;(0s2tmxopou1llenmnvilt s2rau  ;t4ope mictas m rlu s (0aeenmfciytlpDelieo;t srtmirpou4om nlfei sfsDtmu p;t1olt ifcils sDeluvs;u)alenmo ootlmDraiei;t)tetmxr oodlpe lnciltf Dur(r ;t1texnmf3tlt m2rmnvo t4 lerif3iytlatrauei ()t2to(m3oo1ame miei sf 2tmx  ou4oetomfeilsfsDuaumon(4treoxo3iotlpDr i slt s2trxm iu4llen net (fa2rru  ou0teen ocilsfa2ulnmo;t0artomr iytfm  lnei;s0 2xrir iy4opte ncsatfartrxrooo4tpx  oetatla2emn p;t0 etrxo iatfmtr uvils0srtrxm iodolee ivi s)aDuru  no1alxnmiciysfs2emumpnu0texoxociadlatr nvs;t)teumim3oy1ol nlnvsat)aDua(r nt1tpx ifeilsls emnmo u4artrxo3iadoa  anvi;s  exr(o3ny4amtnmfet t)s2raump;t4olxo o3ildfa2rmnvs ()alxrxr oa1opDranvi;s0s2uoirpiydaltemiesl(faDtmx  ;u0opeo iciaslmDemuvpn(4aetrmr3totom e uesls  2xrxrpnu4opteliesl( srrmurpou4alxo f3ild a rl(mp u4alxomrctatfmD aues () rtoxo nudlmt lncias sDur(rpnu0tpx if3ias sDrlu snu0aexrifcoydfmtraneo;t s2xrxr3oy4ll elnvi (f Dtmumpoo4aex  i3tldfa ua(vpnu0 eeoir3iotlpDe n olt)teumio3oo4ol   ivs tfsrrru poo4oltoif3iyd aDea( s ()trtrif oatoatraivslt)texo(rpoy4alee net s) 2uauroot1opt iiciydfmDul( pn(4aeenxo oo1laDe neo ( s2toirpoy4op nmfetat a2rmx  ;t4oeeomi3iyt a2umump;u0 etnmfcootfp   u ilt)tetoxr3oo4lp   ivilt arum(m ou1tlxoii3ilsls um( snt0 rtrxf3iytomt lnvs s) etmim3iodlltnlfvtas)s2ua(rp;t1aee  o3iyd s2rmums u) lenxf tatfp rlnvo;s0srxrxopoy4ole mfvta( s2tm(mp;t4tpxnioetad mDulnmonu4texnio3iytfpt lneil()sexoir no1ape  iet tfsDua( p;u1teenmfeilsfa ra(mon()treoxr3iy1omDe n o;()t2tmio3no4op  lnci (f 2rrxm no1apt  octasla uluvp t)aexnmo todlpDrlu ols setrxopiudapeelivs t) Dtax oot0teenii3iad s2uln p;u4aeerio tadopD  u i s)sexoim ny1aptemfctlsfarua(moou0olxomoctytla2rmu s;u4tleoxocty1lpD  ivsl()teuriopoy1ole  iei ( srtr( oot1tptoiociasfaDuanvp;t4 exrio3oadomDe u ilt0srum(m3nydlp   fvt s)arrruro;t0texoiiciatfs2rlu s u0 etrmf3ootlpteau o s0s2uo(rpoo1apen fes (fsDrm(m ;o0oexomicilt m2emn o t4alenif3iotfm eauvils)tetrxmpoy1ll  mics s) 2taxm no0oexo octysfaDraumpn(0alxomr todfa eai ol() rtrio no1alte fcta( arrrump;o0oeeo o3tytfm2rm( p (0trxrxoctadoaD au sls trxr(m no1omtnmfvilt)sDum( pot1optnmfeiasfa rau onu)aeenmr iytlpD lieo t)trumxm3iu1olenmfvi (f rtaxrooo0tltomicias a uau snt) rxnxf totfa elnvsls s2um(r3ou1apen ivtatfsDurxro;u4alt  f3ildls2ea(vp u)tltomo tatlmt aivol( truo(m3nydap elnesls aDtr(  nu1oee  f3iydls eluvp;u0arxriociatfmDrlu s;t)t2trir3nudolt  nesat) rtr(mp;t0ole mictat s2eanmo;t)aetoxocoadlat  ivilt)srtoio3io1omte fcils  rrrur oo0oeeomicild m2rmuvp t) lxoxrcoytlaDr neilt) 2xo(o3ou1lpenlnei tfsDraxronu4aex mociysfa eluvp;()aetoiocta1fa   ivi t)srxoxmpno4lmeelfetat)sruaxrooo1tlxomiciys a2ean p t)aexniociadfaD aueo;s0trum(m3io1op n ivilt)sruaurpoo4aetoio3tatfa2ea( pn(4 rxrif iodlaDrlnvi (0 2xmiopnydlmenmfcslt)sDrr(  ;t4tlxn i3tldlm uaump () rtnmr3totopt auvols0srxmxr3oo4amtn fet ()sDrrxm ;t4oex ifciat mDel( s u)artnif iytop  an s t)t2xmir3no4ap e ivsls)sDtmuro;t1oeeniieiysls rm( p u0tlxoir oodlaDrluvols s2tm(m3oy1apee fctl()aDurxr ou4opx  ieiydfa2el( onu0tltrxrctydlmD lu s;s0t2tr(m3oy1optnlnvtl(faDtm(ro;o0apeo oeildls2rmn pnu0tetnmf iatlptr u o s teuoir ou1omtnlnvslsfaDtau  ou4olx mfciasfm2eanmpnt4 etnmf3oytfmDean i;s0t2tr(m no1ll emneiasfsrtrxmono4oleo icils sDuau p ()alxoir ta1fatraiei s)trto(mpnu1ap emnetas)srumurpnt1optnioctydfa2uauvs;u4 rtnirctadla rauei;s0srxmxmpoodlmen nvta(  rurum nu0oltniietld sDumnvpn(0alxrxf3totlm eaies t srtrxr no1al emietls)a2rru  ;u4aleniietlsfm2rmnmpnu)aetnmr oo1fpDe i s t0teuo(o iy1ape mfcslsfarta(  ;t4aeto oeildfaDrmnvo;(4 lxrir3ia1la e i slt  2trir3ny1lptnmnvtat) rua(r no0aleo ociytfaDua(vo ()artrxf iatoaD  ies;t texrxr3nudlptn fvi s sruaxr ;u4openioeiytfm raums (4tltnir io1fp e uvi;t t2trxm3nydllen nei t sDurx ont4altniictydfaDumuvont4tltoxo3iodom   uvo s0srxrirpiudape lfei ( arum(mpnu0opxo iciytlmDrmn pnt4trxomf3oydfatrlieslt) 2xmxo iudomtnlnet (fa2rmxr ;u4opx mieildfmDemumo u0alenir iy1fatr ues s)s2xrirpio4am n ictasfarta(mpou4oetnmf3iys aDrau o;(4 exrmr iy1fmDe uvi;t texoio3ou1ll nlicsa() ruau pno4tpe iociytlmDrl( s;t4altrmo ootlatrai olt0 2xrim3iudopt lnvsl()aDurxrpot0teen oetasfa elnvsn(0artrmr ty1lmt anvo;s0 rumxr3oy1ape lncil( a2trum ;u4olxnif3iltfa2ulnvs;t0texoxf3iadfp eauvo s)srumirpou4ll n ncs sf 2ur(  ot0opxomoeiatla eluvs (0 rxnmo3oadfp raivi;(0texoxo3io4llt lfvilsfsDraumoot4tpxnii3tydls rmuvonu) lxoirciy1fa eai s t0 exm(r oy4ap nlici tf Drrxrp;t4alt  i3iys sDrmums;u) exrxr3iydlaD luvo t) 2tm(r3oudll elivi t  2raxmpoo0oltnmo3tyslm uanmp (4trermr ta1lm elivs;s0 rxm(m3nydolt  ieils)sDrrumpno4tlt mf3iltlmDrauvonu0 leomo iotlmDelu slt0s2uoxr nu1om e fcta(  2rau pot1aex  octat s uaumo u0 renxr3io1omt auei s teuoxmpio4lmtn fcsls srumurpnu1aex iieiydlsDumums () rxnxfcoa1lmD ln i;t s2to(mpno4ol emiviasf 2ur(rpot1tpx mociad a em(vpn(4trermo3oy1opt lu o t0tetrxo ou1llenlfcsls)s2umump;t0tlx  i3tlsfm2emn pnu4 leoio oa1fa rai s ()teto(rpnydoltemici s srtm( p;o1alt io3iytlm2uau p;() reoxo3ty1fmtelnes s)trto(o3ny4om e fcil(  2ta(m nt4apxnif3tytfsDea( ont0areomr ia1op  aiei;s  rumxm3oydlm nlivil() rtmumonu0openmfctltfmDel(mon(0 lxomo oytlaD anvs t0s2urim ny4ale  nvilsfsrumuro;u0aetn o3tyslaDemnmsnt0trxnxo oodlmte ues ( teum(mpoodomenmici t)sDtr( p;o1tetn fctltfm ranvp t4arxnxo3oydfmte ueols trxoxmpiodlptemfcias srrax pou4tpxomfeildlaDuau s;u0 etoir oadlmDrln sl() exoxm io4omt lneia( srrm(ro;o0tltoif3tltls emu s (4texrmo oadopDelies (0s2xrio3nudam e fvslt sDtmumonu1ope  oetysfa2em( snu) rxnif3ty1laDr neo;t0 euoir iudoleelnvsat)srurx o;o4tetomf3iys a2rm( pn()tetomocta1faDrli o t  etrxmpoudam n nvslt)sruax pou1olxo ictad m emn p (4treomfctatom eln i t0 rxmxm iu1am  lieia(fs2ra(  oo4tpeomfeils a2em(vpnt0 exoifciydoatr nes;t0 rurio3io1am  mneiat)a2taur no1oleo ociyd a2umuvo (0 exoxrcty1fpDelieo;t0seuo(m3iy1omteliei sfs2raumpnu0aptnifciysfa2ua(mpnu)texoxf to1fa eaieilt0texrxo3ny4lp  lfctat)sDtmxro;u4tptn ieils s um(vp;t4alxomr oytomt  ivo;t) rurxo iodap elfeslt  2ra( pot0aeen icildfs ranvpn()aeeoxf iytla  lnvs s seuo(r3iudalenlnvs (  rtru pot0olxn fciytfs2umu o t)trxoxocoo1lp  lnvs;()srur(mpiydlpen fvs t)sDtmxro;o0teenmiciasla ul(ms t4trtoxr3ty1lat  ivslt s2xr(o ou4optnmiviat  2raump;t4tet io3iysfsDeaump;(4alxnirctodlpDeauvilt) 2xoxopiudopt  iesa(faDurumpoo0tpenmietlsfm2rluvpnu4aexrif3iadlptraieil( s2uoxo3iudop n netatf rtmu  ;o1tee moeilsfa2ua(mpnt) lxoxf oytop   i o (0seto(m3oudlpenmnctl()artmxroou4aptnmf3tytls2ra(vo (4tlxnxo oydopDraivsls t2umxm3oo4open fcias)aruax  oo0tpxomf3iasfaDuanmo;u)aeermfctodoaDr neo () 2tr(r oo4al nlictl(f Drmumpoo0texnii3tysfs2el(vp;u)areoif ootlaDrai ilt) 2xm(o nodome micsl(fa2tmxmo;t4texniieildfs ea(vp t0altnxf totomtr ivo ( t2uoiopoy1op nlnet () Dtrurpou1aptniieildfm2ua(von(4aetrxr io1op e i sls0tetmim ny4opeelfctl()s2raxr ;t0alxomf3tad aDuan on() rtnxo ty1laD luvo t0 exmim ou4lltnlncs t)aDtmxmpou0altoii3iydfa2em( o;u0arenirciadlm  luei;s0setr(m no4lm n ivi s a2uau  oo4tle  iciyt a2rl( ont) rtrxf tadlm ranes;t  eurio nu4om emfvs sf 2tau p;t0altnioctls a ra(vp;(0aleoxo3oytfaDeluvils  eumxo3oy1ape  iet sfarurxrpno1alxnif3tld sDeluvo;t)trtrmf3oadlat livsls  2xm(m3nydlm n ieil(f rra(  nu1tpt ioctldla rl(mo;u)aeeoxo tydopt  nei s0trumxopiy1am nmncsasf rta(mp;u4optnmiciadfaDumnmpnu0 leoxo3tadopD  ieilt  rurxm iu4amtnlncta(  Dumxmpoo0olen oetas s ean s u) exomo3iytfatrau i t)trtoxopiy1lpeelfvtl(faDur(mpno0aet  fctadls2ulnvs u0 etoif iadfpDelneil() 2xoir3iodom n iviltfsrrm(mp;u4opx mf3iltfaDranmo;t4 rtnmf iy1oaDran sl()setmxmpio4lptn iciat aDrrur ;u4oeto feiadla emnmo t4 ltrmoctatla  luvi t teuoxrpnu4lmeelnvta(f 2taumoot1oexn f3iadlm2rmnvpn() lxoioctadlat  nvolt)trxoxm3oy4amt micils aDta( p;o4opxniociyt s ulumpn()trerxfctytomtrlnvil() etr(r3no1aleemfvsat arururont1aeeo ociadlaDua(vont)texomo tydfp r u sls)trxoxm3iudlm  mnvil(faDtrx ont1tpxnmictadfaDuau snt0texrmf3io1omtr uvo;s)s2uoxo3oydope  ncs ()aDua(mp;u4aexn icias s um(vs u0aeerir oadla r nvs s0 etr(r3oo4llte fviat)a2tm( pnu1tleoiicias m2ua(mp u4 rxomr3io1op eaiesl(0 rur(m3io4olee nes s) Dtmxmp;t0opxnmfetatfaDeaums;t)tlxoxocoa1fpD  uvs () rxoir oy1ll  liet (  Dtmu  ;t1alxnmictytls ea(mp t4artrxo3oy1fat lnvs;t)trtmxmpnodol   ies s srrm(r ot1tptnmo3iat m2rauvp;u)tlxrmf3tatlm ranvs t0 rtoir io4ameemncia( srtrurp;t0aeeoifciadfmDea( sn()artnmo oytop   nvi;t srtrir3oo1lptnlictas) 2ta(mo;t0alx iieiyt m rmu p t0 exnif3iadfa eanvo t srto(rpiy1amte nct sfarrauroot4oetn f3iys aDran p t0tltoxrcootom r nvo s  euoxr nydom  mfctas)artm(r ot1tpe ii3iatlsDrl( on(0tlxnmfctydoptr nvi;(0tetoirpnudlm e nvs (fa2trxmpnu4ole mi3iyt s2ulnvo;t)aetrxrctotop e ieilt0teto(opoodamtn iet s  2tm(mpot4tpxnifciltfaDrln p u0 reoxf3iytoa raivi t  etmio ou4omte ictl( aDtau  ot4oeeniociydlaDrmu s t4trxnir ty1omteaues s texr(o oydlptnmiei ()aDrrxr ot1tlxoif3iytfsDrm( s;()tltomociy1lp rln o s) rxoxr3io1omtn nvsasfa2rax oot0oetn octldls2ean p;t0teeoifctydlp e uvil(0sruoio oodome  nvtlt)sDtmu p;t1opeomoctyd m em(vs t4alerif iydfat auvo (0seumxm3io1amtnmicil(  2rrxmoou1teenio3tadls uanmp;u4treoxf iodom rluvs;t0 etoio iu1oltelfvtlsfa2ua(mo;u4tltoif3iyt sDea(msnt4tleoio3todlp   u s t0s2xo(r3nudomen ncs sfarrrurpot1alen fciyslm rl(mont4teerxo iodfatraues ()s2to(m3iu4apenliviasf Dtm(m nu0ope mfctld s rlu s t4alxomf iy1fmteaneo s0 eur(m3no1lleelnetasf Durumpou4optoiieiatlm ra(ms;u0 lxnio3iy1omDrlu s (  rur(opoy1alenmici sfa2urump;t4opxnii3iytfa2ea(mpnt0 renxrciadfmD ai ol()seurimpny1om e fctatf rtaum nu1ope iociytfm eln on(4tlenircio1faDrlivol()t2uo(opoudope mfes sfarrm(mo;t1aptoioeilsla uanmpnt4aeerir3oa1la ranvo;(  euoir3iodaptnmnciatf 2um(mp;t1texo ieiydls uanmp;t0 etomr3iadfatrlu i;t s2uo(mpiy4am elncilt sDrrur nu0aeenmociatfm2um(mon()altrxr tydopt lnes s trtr(o3iydoptelfctl(faDrru ono4optnii3tasfs2umn s t4 rxrmrciadlmD  ivsls t2uo(r oodlle mfvtatf Dtm( pnt0alxnif3iyd m uan s (0 ltomo iatfm eau s;t0trxr(mpiu4op emivtasfsDrau  ot0oee ii3iaslm ul(mp;()treoxrctytlpt an i;t0s2umirpoodapee fet s srtmxm ;o1oeenmictlsls rau s (0 rxrir3ty1optranes () exo(r nu1lp  lneta()a2rr(mo;t1apeoioetadla2ra(mo;u)trxrif oy1fmte u i;t trtrxopnu4ll nmivil(f rtmum no0opeomi3tld a2rln o t0 reoircootla  lues t tetoxm iudlmt lnetat  Duaur nt0tex ifeils m2rl( s;()arxoif oy1lmDrlies s0seuoxr iodll elfcsltfs2raxr oo1tet iociyd m2el(vpn(4altoxrcto1lmt lneslt)t2uoir3ny1llt lfvtl(farraxrp;u0oeen i3iasfa rm(ms;u4arxnxr todfa  aivils t2trim no1amt mfcil()sDum(  ot4tpenmieiatlsDumuvp u0trxnmo iotlmteln i s) rumxmpoydllt  nvsat)s2umx onu1tlx io3ilsfs2emu s;t0altrxfciy1fmDelieils)seum(o3ny4ame  ivi (  rrr(mo;t1texnifciadfm2rmuvsnt4tlermo to1fa   ueslt) euoim io4open ictlt)s2raxr ;o4alto o3ilt m2emuvs;(4aexoiocoatfmD livs s) rxmio3oydll nlfcsasfsrur(ronu0tpenmfctatfm raump u4 rtrifcty1optean o;t) exoir iy4lpeelfesltf Dtmurpnt1opto o3iatlsDuan on(0 eermrcoydfm rluvi (0 2xmxm nu1oltnmiei (fsDrmur ;u1oeen ociltlsDrm(vpnt0tltrir3iytom e ivs;( s2xrim3ny1ameemfvilt)s2um(r oo1teeniociyd sDuauvp;t)alxoifcty1oatrlu i s)setmir3iy4ole lieil(  2taxmooo4alen i3ild mDeluvo;(4tltrxf3io1fmt li o (  2trim nudlpe lnet tfaruax ono0tpe mietaslm2rmu s;t0arxrmo3iodoat  ivi s s2tmir iydamt miesat sDurxrpno1teeoii3iadls2ul(ms;u4 lxrifcootoaDeai slt0s2urir ny4ame lnvt () 2umumonu4tpeo oeils a rm(vo;t4tlxrmfciotla rau i s trtrio nudole  ietat arurxr nt0aee  o3iydfm uauvont) etomrcoytfpt auvo ()trum(r io1lleemnvsl() rra(mp;t4tpenmf3iasfs2ua(msnu) etoir oy1faDelnvo;s t2tmxmpou4open ivt s)srrm(m no0olt micilt s rm(von(4 etrxr oo1op  livs t  rto(mpiudomt  fvil(f rtmu pno0aexnmfeildls rm(vs;t) ltoio iadfat lieo;t0teuoxr3iu4aptelivt sf rraxrp;u0opt  f3tydfm rlnvs t0 lxnmo tatlm elu olt)texoirpoy1ap nmncta(f rrrx onu4apxomi3iat m2em(vpnu)aeeoxf ia1lateau ilt)texrxr ou4al e nesas) Draur ou1opxnmfeilt aDrmu onu) lenxf oydoaDe nesls) 2toxo no4om nmnei ()s2rau  ou0apen feiaslsDua(mo ()aeeomfctytla  luvsls0t2xm(opiodlm elieslt a2ururooo1oltn feils s2um(vsnt4tleomo ia1lp elu ils0teumxo3iudamee feils)artaum ;t0aet ifeiasfa2el( pnu)altoio tydlptrln o () etr(opno4ame  nes ()arrr(r oo4tlxniociltla2ul( s (0 leomfcoadlptelnvo s setrxm3oodll e fcsa(faDra(monu4olx ifciysfs el( pnu)aetnmfcty1laDrauesls) exmim3iu4lmt micsl()aDtrx  ot1ole ii3iyd sDea( sn(0 rtoxfctodfmDe neo;s) rxrxm3nu4optnliet t  2um(mpou0aetomi3iat a rmn s;t0tetomfcoydfa  lneilt) 2uoio iydlmee fesl() Drmuroou4texoif3ilt mDemnmpn() lxoir3io1faD  n s;s  2tr(mpoo4lpee ictlt s2trxrpoo4opto fcildfs2rmu ont0alxrmr3oodfp  lues s0 2triopiu1lltelfetlsfsrtrumooo4opx  fetatfa ra( p;(4 eeriocoodoat luvo;t seur(r3iu4op   ietl(fs2ra( ont4apx iictatfs2rlnmp t0 leoio oytlp rlnvi;t t2trim nodaltelics s)s2ra(  ou4ale  o3iltlmDra(vpnu4trenxociodoaD ai s s)srur(r3iu4llt  fei t) rtruro;o0tpenio3iltfsDulnvp;(4 etrxo iytlpt ln sl()seurxo oy1lptnmfeia() rrrxrooo1tltnmfeiytfmDra(mp u)arxomr3iydlpD aies t)srum(mpiu4opt licsltfartrurp;t1oeenmieiydlm eanmpnt4alenif totopDrlu i ( trxrxrpoudame mieiatfsruaxrp;t1apeomfetltfmDrl(mon()alenirciadfaDelnei;s)sexm(opoo4ll n fvi s) rrr(m ;t0olt ifeiyt s um(vo (4altoir iodfatr i ils srto(r3nudlmtnmivtl( sDtax pnu0tpxo icilslaDea(vp t0arxoif3ia1opte u il( trtoxr iodame  icsls sDra(r ;o4aleo ociydls2ua(ms;(4 rxoxo oytfm  lnes (0srxr(o3iodllenlictlsf Dta(rono4oex mfeiadlaDulnvp t4texrmr tydoa rlivs s) exo(rpny1lpenlfesat arrmu  nu1tee  f3iatlaDra(ms u) rtoxfciydlateluvil()s2tmim3nudlm nmfviltfaDua(mpnt1oleoii3tlt a rmuvs;(0aeeomo3ty1lpD livo t) eur(rpiy1opt  ietatfaDtm( ooo1aet mfetadfmDrmnmo;(4arxrxrcty1om r u o s trxoio3ou4optn ivi ()sDtr(monu0tlxo o3tltfa rl( o;u) ltrmocto1lmtran o s0 etr(r nu1lme mfcil(  2rrurpno0tlxomfciys s em( o (4trermf to1laD luvs t trxoxr io4lpe  neils)s2tr(moou1opeo i3iadfm rm( pn() lxrxf3ty1faDeaies;s0trtm(mpoydlle livi (f 2rrur ot4aetomf3iatlm2umu p;u) etnir tadla  aiei (  2toxo iodolt mnvtl( srurumo;u0tlenmi3ildla2rmnvon(4trtnmf3oadlmDrauvo;t0t2xoiopno4lltemiei (  Drru p;t0apxoiociytfsDum( s;u4 reoir oadlm   ieslt) ruriopno4lmt  nctl(faDtrxmpou4ope miciltlm umu o;t) ltomf3tydfatelivil(  etrxopnydolen fei ()sDtmur oo0tex ioctysfs eau o (0 etrmrciatfp rluvilt0t2xr(r3oo4am  mfct tf Dra(m ot0tet iieiltlaDeau o;t0alenxf3oo1lpDrlivils sexm(m3iydam  lfetls aDtm(rpou4apx ioeiysla2emu s u0tlenxo oydfaD lu olt)s2xmxo3oo4omen nvi sfa2tmx  ;o4olxoioetldla2eln s;t)tlenxf tydlaD au s (0trtoxm3nu4alenmfcsas)artrum ou0aet  i3tyslm uanmp;u4altnif oydom  aivsl(  2trxo3nodol   fctlsfs2urx  ou4aexoiieiyt sDrmnvs t0 rtoio oytfmDraueils  rxmxr iy4optelfcsls)sDuauroot1tpxnmoctlt a2elnvo;u)artnxo ootfmDrlues;s0 eumxo oo1ap n ncilt srtaxmo;t1oexn i3tys s2emuvpnu0aeerifciadopD anes;()seuo(m3io4lleemfesat)aDtmx  oo1olxo ieils a2eluvp u4aexrxocty1oateau sl( s2xr(rpio1al  mivt s)srtmxr nu1oexn o3iytlmDeln s u) eenmo todom r uvo;s)s2xoim ny4op  mietas sDuau p;t1tlxn oetldfa ul(vs t)arxrmrctatoptr ueilt s2xoir3nu1am emietls s2rr(r ou0oltn fciytls2rm( sn() reomr oodomD  u i (0 2urim3oo1al eliet t) 2umur ;u4tpxomoctyd m umump;t4 ltomocoodomD ln s t0 exo(opoo1ole lfvtas  Dumurono1olx mf3iadlm2um(mo;(0tlxoxrcoa1om e ivo ( srxoxr3oydlle  net t)arrr(root0oexnmi3iltlmDrmn o;()arxnif3oytopDr i s s)texoxo oo1ap nmfes tfarraxr nt1olt ioeiydls um( snt)tlermoctatfaDrauesls)texrim oy4alt lfcs t sDumx  ;o1tlxnmictysfmDelnmp u)tetoxrciatoaDe n i t)srxm(rpoydom nmivt s arum(mp;u1apt mocilt s rlums;t)alxoifciy1fat au i;()t2trxm oo1am nmivi ( s2um(m ;t1oeen i3tysfm emnvpnu0 renif3tatlp rauvils0seur(m oodomte fvt t sDrax  nu0tltoifcildfsDel(mont)tetrxfcia1lpD luvs;( texo(o io1olenmfesa(fs2trxr nt4oltomociytfsDemnvo;t4alxrmf3oo1fm  an s s  exo(m io4llt miei t)s2rr( o;o1openiictat aDrluvs (0aleoio oa1fpDr n i s0s2tr(rpio4ll nmneia()a2rmx pou4tlxnmieiyt aDelnvo;u4arxnxf3ia1fpDe ies;s)teto(o iu4lm   ivia(fartrxm oo1openii3ils m ranvonu)tetnio3oytfa raivo s s2uoxm3ny4amen feilsfsDrmxrooo0oeenmi3iysla2em(vp;t)trtrmf iadfmDraivi t)trxr(opiy1om nmnci ()aDrru o;o1tetoiocildfs2ranvp;u4arxrmrciydfmt anvi;t s2toirpnydlptnmnct ()aDtax ont1oeeo octls a2rl(vpn(0aexnmf3tatop e ivo;(0s2toxopno4lpenlfet sfa2raumpoo0opt ifeiyt m umnvs t4artrirctadlat lnvs;s0sexoio3oy4lptnlies ()artrx  nt4olenmi3iatfs2elnvonu4tlxnio tytfatrauvi;t) exoxmpou4om emnet sfsrrrumo;t0aex  feilt m rmnmsnt0 ltrxo3oytoaDe i sls0srxrxrpiy4lmenliesl() ruaxmonu4tpx  f3iytls rau s;(4alxrmf iytopD  ieolt0s2xmxr3oodlm nmfvilt)s2raum ;u0olxo feiys s2el( s;u)texnmf3iodfaDr ues;s0trtm(opno1amt  nci ()srrm( p;t1apt moctlslsDrmn s u4aetrirctotfm raivo;s setr(m3iodalt  icta()aDur(  nu1olen oeiyt a2rlnvpnt)trtnmr oodfmtrluvolt t2umxo3nydomtemiesat  Drrxmpot0aexnmfciasfm2ea(von(0 rxrmo3tadfp r ivo t teuoxrpiydlptn fvsa( aDtmurp;t4tlto o3tasfm2ea(vo;(0teenxf3ta1opt  i i (0sexrxm3oudlmtelieslt)srurumont0ole moctasla2ean o;()alxoif tatlp r ueo;t0seurxm ou4lp elfesatfsDrm(mp;t1aleo feiltfs rau onu4 reoxo3oadfpt ln o t0trtoirpiu4alt mieiatf rtrx onu0aee  f3iatfa rl(vpnu)alxrmfcoodoa  an o (0 2ur(rpoudlpe mnvil(fsDtmur ;u1tlto o3tys m2ulu snt0 reoxr3tytlpteaueo t) rto(m3oo1ame  fet sf rtrurono0tltoiietydla eaump () lxrxf3iy1lpDrliei;t sexmim3oy4ole  ict sfsrtmum nu1tpx mo3iadfm2rlumo () renioctadlpte u ils0srxr(o3nudop  mnvtas)aDur(rono1apt iictltla2rmn s;t4arxrmocta1fpDeaies (0 2xo(mpoudamt lnct sfarua( poo0aptoiictad m rlu s ()arxrmo oa1opt  ieols0 rxoiopou1amt mfvi s) Drmuroot4olx iieiydfmDuanmsn(0alenmfctadopD li i;( srxo(mpoo1al nmfciatf rum( p;t1teeo ieils mDum(vp u0 lxnifcoatlatr ivo;s  rtoio3oy4optnlicta(fsDtmxm no4opt  f3tld a2eauvo;(0 ltnio3ootoat auvi s sexoirpoo4amtn fcslsfs2raum ot4alto fciyt mDrl(mo u0trxnxocia1fm elnvi t) eur(opno1om elfes sf rra(r ou0opxn feils a um(mo u0texoifctatlm e ieilt)setmim iu4olee fcs sfa2tr( pnu4ape iieiyslm emn o t0aleoiocio1fmD luvsls)t2xo(o ou1openlfvilt  2tmxm nu1altn fciaslaDemnms;u0artrxf ty1fpD  ieslt0 rtm(rpou4op   netlt s2tr(mpno4apt iieiysfm2emnvo;u0 rxomrctatfmtr i ilt) etoxr ou4lpt lncsl()aDuaum nu4openmiciaslm um(vont4 exnio3tatoat aiesl(0 rto(opiu1lp  mnvilt a2uaxmo;u4oetnioeiasla umumon(0tetrmo3iadlpDeli ols)s2xrxo nu4ll  mneils  Dtau  ;o4olxnmfciys m rluvsn(0 rtniocootlm r ivs (0s2uoxr ou4oleemicsa( sDta(mpot4apt  oetydfs2ua(vsnu0 ltoifctadoptean olt0 etoio nudlm emictasfarumxr nt1opt ioctysls raumo;t4 lxrifcia1oa elnvsl() 2xmiopiy4omtelieslsfsDraxmp;u1ope  o3ils a2rl( s;() lermf oadlm rlnei;t)setr(o3iodll e ivsls) 2tmx  no4tee iiciadlm2rl( p t4aexomr3iadoa eau ilt srxo(r iudlme livt (fa2raur ;o4tlxn oeiydlmDemnmonu4 ltnxf ty1fmtrli slt) rxoio nu4oleelies () rtmxro;o0tlxo oeilslm2ean pnt) exoir to1fpteaues;t)t2xm(mpoy4oleelfetlt aDtru pnt1ole  f3iadfa rm(vs;(0 etnio3oa1oaDeli i;() 2xoxm nu4al nmfcsl( arumxm nt4aeenio3iadfs um(vs;u4 ltnxrcio1lpDrliei s0trtmxrpiydame lfcia( a2uaur ;u4aeeoiocildfaDulump;t4trxnxfcoodoat aneo;()trxrxm nodomeemfvt s  Drr(  no4texo oeiasls2ranms;u0alxoifcto1laD  uvilt)texr(m nu4lle mnet sfarum( o;t0aeeoiieiadfm2rlu s () renmf3io1opD anvs t) ruoirpoo4opt mfeia(f ruaxmp;u4apx  fcias m2rmn s ()artnxrciadfa ran s;s sexo(mpoy1ameelfct (f 2uaxrpoo4aexnmictadls2ul( s (0texnmr oodlp   nvo;t0 eto(m nu1lm elietlsf rtaum nu4apen i3iatlmDrm(vo t0alerxf3iatlmDr nvs;(0srtoio nydlpte ivi t  2trumoot0tltomo3ilt mDea(vs;u0alxomfctodlateanvs;(0trtm(m3oy4llte iei (fsDrau pnu4alx miciadlsDrlnvs u)tleoxo ia1lp   nes t t2trir3iu4oleemnvtlt sDua(mp;t0apeoiietadla2em(vp;u0 ltnxo oodlmtrlues s0s2umimpiodll elfvt t)a2rrum nu1tpto fctat mDraums;t0aetnir3oa1la  lneo;s trxrio no1op  livsls  rtmxmpno1tetoifciydlmDem( p t)trenxrctodoate ivsl( t2uoxm3io1ome  nvia() 2ur(m ;u1tle  iciasfm2rlnms;u0altnir3oytfpDelnvils  2xr(mpou4lpenmnci s)arurur no0tpxniieiadfs2uan onu) lenifciy1latr ivs;() rtrxrpoo4llenmfvsat  2ra(mo;o4opto ociadlaDeaump u) rerir tytfatranes s t2ur(mpnu1lltnlieias)artm(roou0aetn f3iasla2em( s;(4 rtnxoctatlmD aivi;s srxmir3no1am e fviat) 2rax onu0tee  oetld a2emnvsn()trtomo3iotomDean s s0s2xo(o no1ame mfetltfs2raurpno1altoif3iat aDrl( p;u4 lxrxr3io1fmtelnvs;() 2tmxrpnodll   ivs t) 2taxmonu0aptomo3iatlaDulnvs;u4tltoio3ia1fmt ai i t)t2urir3oo1omenlicsa( sDrr(r nt0olxoiociytfa2el( sn(4 exomf3iydomtrluvi;t srxoim nu1amee feia(  Dum(moou4oetomi3iytfa2ea( s;u) ltrmr3oatlp e uvo;t)trumirpiy1ome mfeiltf 2trxr ou0alxn f3iys s eaums;(4tltomoctydfa elivslt0t2xoxr3nodom e icsat sDrru p;u4aee mfeilslm rmump;u0 reomr3io1lpDrau s;s trurio3io1am emfctltfartrump;t0tetnifeild m2rm(monu0texoxf3tydlaD  iei;t)seur(m3no4om   nvi ()s2ra(rpot0oeen f3iytfmDrlnvp;(4 eenmfcoatfmD  u i s teurir3ou4llenlfci t a2umur oo4optoioeiadfs2ulumo ()alxnifcoadoa  aueo;(0 2umxr ou1ape lnvtat) Drax pnt0oexoif3tadla2uau on(4alxoif oadoaD aivs;t)sexoxmpoudamen nvi tf rtaur nt4olen ieild a2umnvo t0 etnxo ta1omDeln s t seuo(rpny1lptn ncsas s2tr(  nt0tlt iictlsfmDumn s;u0 exoiocoa1lmD  i s (0 2triopnu4al eliciat)a2rmx onu4tle mieiadlm2eluvs t0arerio3iodlmt ln sls t2tr(o3oodoptnmivsl()arrm(ro;t1olt moeias mDumu s;u0texrmr to1lpDe ieilt0srxm(opnu1om  lfvias srrrumpot4aleniietad sDea(vp;u0texoxf iatfmtr nei t  exm(m oodol nlnvtl() Drmx  ou4teenmoctls m rl(ms;(4 rxoxf3oydlatrln i;t trxo(rpnodll nlietas)srur(m oo0tpen f3tytlsDeauvo ()aexnifcoa1lpteauei;s)srxoxr io4olenmnvia()arraxrooo0tetn o3iad m2rau pnt) rxomo3iytom elneo s0seur(r3nudlpenlnvs s)a2uru poo1aetomiciltlm rauvp t0 rtnir iy1lpt luvs;s0 exmir nodopen fct tf Dur(  ;t4tpt ifciltls ra( s ()artrxfctotoptr i o;(0 2to(mpny4alenmfciltf Dra( o;t1tpeomf3iltfm emu p;t4trxrifcootoat liesl( trurim3oo1ll emnei tf 2taxmo;t0aex  fctlt s2uluvpn(4trxnifciadlaDeluvo;()t2um(opoo1oltnlncsl()arrm( pot4tex moctadfa2ul( p;(0 etoirciy1fa r ues;s srtrxo3oydlmee iei sfsrraum ou4olxo fctlt a ran snt)trxoxr todom rlues ( teurxo oydll elfes ( arrm(rp;u1oeeoiociyslm2umuvpn()texnio3ootlp  livols s2xmxm3oudapt lietlsfsrum(m nu4aptnmiciltlm emnvp;u4texnxo iadoaDrauvs;()srumxr oydopt livs tf Durxrpnu1tpt  f3iatla2ranvsn() lxomr iy1fatr n ols tetr(mpoy4llee iet t) 2um(rp;t1tpx ifetls s el( pnt)aetrxociadom rau i;()tetmiopiudom emicil()aDtrxrooo1apeoioctasfm2uau on(0altoifcoydop  ln i;( seurir oy4am nlfviat srum(moot0olt iieiyslaDuanmo;(0trtrmf iodlpDe i o;t0s2xo(opou1ll n nvt (fa2rru o;u1alt  f3iyt a ul( s u0aetnxf3oy1lpteauvi;(0texr(o nu4alenmiei sfs2ur( p;t1aleo f3ildla2rlu s;u4 renmfctadlaDeau i t0 rurio oodale mfvs t)aDumxm nu0alxnmo3iad aDum( p;u4alxrxocoo1lpD lnvs () 2tm(opiydape  fesas)sDrrx oou4aetn f3iasls rmnvs;u) eenxr oy1op e i o (0trtrxrpiodlmt mici sf Dtrxmpnu0apxnii3tysfm2em( o u4arxnif3to1opt anei;t0 rumxm3iu1lp  lfciltfartmu p;u1tpt ifciydfs2rmu s;u0alenmf iytfm  luvo t  rxr(o3oydaptnlictl(fa2um( pnu1tee  o3tat m rm( p u4 lxrirctydfp r ueo t) exmxo3iy1lp eliei t) rtrumpot0oexn f3tyt m rlnmonu4aexnxoctadopDranesls0srurir3iodop elnesat)arururooo0aeeo ietlt mDrl( o u)arxomo tydfp eaieo s)srxriopnu4ame  nviat)aDtrx  nt0olen oeiad m2umumon(0altoxf iodoaD aueo;t trtrio oydameelici () Dtru  ;o4oeto i3iysfa2uan p;u)tlxoxo iydop elieo t)srtmxr ny4omeelfvtas) 2rmxmonu0apen ictad s2rm(mo u0tlerxrcoa1lmDelneilt)srtrirpio1lle lfcs s s2umxroot4olxnmf3iltls ulnvs (4 exoifcoydlptr uvi t  rum(m iudaptemfeslsf 2trurpnu1oltomociatlsDuluvo;() rtnmfcty1fatrln i (0teumxm ny4am emnviasfaDurxmp;u4alx  f3tasfs2ea( p;t)alenmf iydlmDe nes ( texr(r3ny4alt lfei (farrmumo;o0altoiietasfs2el(mo (4arxoxocio1lat livo;t0t2trxo ou4ol elfetltfsDur(mpno0oleomoeiltfm rmuvs (0artoxr iatfmt aneo t) 2tmxo oodol nlnct sfsDraxrp;u1tpt io3tytla2rl(mpnt4trerirciydoa  aueolt) 2xriopnydlmtemiciat a2tmur ;u4aptn f3iltlaDeaumon(0alxnxf3oadfa   neils  2tr(mpoo1ome  nesat) Dta( ont0oexnioeils a ua(ms;()texrxf3oo1oaDrau sl( seurim3iudopt mfctlsfaDtaump;o4apxnii3iltfm2rmnmont4 rermfcoadoa eai ils texrio3nydll nmicsa( aruaurpnt1tlx ii3iltfaDelnvs;u0tlxnmo3io1oatr uvs;s0s2xoxm3oy4omee ivs ()aDumu  ou1apxomfctys sDumn p (4altrxrciodlmDrliei s s2toxmpoo4omee fesasfartr(r ot4oleo i3iasfsDra( p;(0 rtnmf3ootop r u o;t0t2xm(m3iudlp e icias)arumur nu0olxnmiciysfa2eau sn()teeoxrcty1fa  lnvs;t trtr(m3ou1opte feias srtaumoou4olxo ieiadfmDea( p t4 rtrif iodfmDeaivo s) rurxm3nu1lme  ncsls s2rmx p;t4alto i3iadfa2umnvsnt4alerif tydoa  aivi t0trxoir3nu4apt miesat a2taxm nt4tleomoctld a2uluvon()altnmf iytfmteaivols) exoirpnu1ll e nvt t  Dumxmonu0ope  fciyd m rm(mp;t) rxoif todoateanvo s setr(r iudaleelfei s sDta( pou0apenmfeiyd a emu o u0 rxnxo iotfm   nes t)trxo(opoy4optn nctas) 2tax pno0tptnmi3ildls rlu s (4tleomo tadoatraueo;(  2xm(rpnudlm   fviltfs2rmxm ;t4apx  ociatlsDuln p;u4 etrxr3totla  anvi t)t2xmxm no1om n nvias) Dta(m no1alx  octat m ran pn()tetnir3iytlm eluvs;( sruoir iy1lp nmici sfa2uru oot1tltn fcilsfaDumuvo (0 lxrio iy1lp ean s ( s2trxo ou4lme mnvi sfsDrmum ;u0alenifeiad aDumnmo;t) rtnir3tatlpDr nes;t0seuo(r3oydomenlncs (  rur(ro;u0tleo i3iatla2uln o u0aexnmociy1fm raues;() ruoxmpio1am  mnetl()srrrx  nu1tex  f3iytfm2rauvo (4altoxo to1lm r ivols) 2xr(o3iu1olte fvslsfs2umxmooo4oeenmfctltlaDuanmp;t0alxoifcta1fat ai s s tetrxo3nodolte ieilt  rtaurp;o0olxoioctyd s2rl(mp;(0alermo iotomtrai ils)s2xrim nydoleemfetat s2tru  ou1tlxomietaslaDrlnvo u)altoxr iotlp   ues s)texmio3oodom e iesl()s2urxmo;o4altomfctyd a2rlu p;t0 lenmo iytfmt aivol(0trurimpoodlpe  ivta(fa2um( o;t4aetn f3tytlmDrlnms;u) exrmo3iy1fm rln il()sexrirpnudlmenmfviasfarra(mpou1aeenifctysfmDuln pn(4aetnmrcio1fm  lueo;s)srur(m3ny4lle mnci sf 2trxronu1aeenioctyd m ra( p u)aetnxf iotla   u s;t0 eumiopnydlpeelfeia(fa2rmxrpnu4oeeo i3iydfm uaumo;t) lenxo3ta1op elnei;()srtrxr3ou1ameemneiat a2ur( oou4tlxnmfctltlmDeanvo;u4 lxnir oy1opte uvo t)s2umir3oy1oltelfctas arrm( p;t0tet  o3iasfa rau o;u0tltrmo io1omt li ols0tetrxm3oy1omte fctat)arum(rono1aet  i3iasfmDemn p;t)arxrir3tydfm eaieil()s2xr(mpiu1ame mnctas srrmxm oo4ape  o3tld mDelnmo;u0arxoxrcty1lm eaivo s0t2xoirpio1llte nvslt) 2trx onu4oee ifcild mDrmu pnu4tetnxo iadfpDelieol()t2ur(rpou4ll nmfvs s)sDurxrp;o1aexo oeiat s rm(monu0aeerxf oatlaDelnes t0seum(mpoo1lmtn ietlt  rua(rp;t1optomf3iytfm2rmuvpn(4altnmfcoydfat auvi (0teumxmpoo1optn nvi (faDua( o;o1aeenmieiysfaDrauvonu)aleriociotopDranvil(0sexoxopio4ll   nciltf Draump;t0oeeomoeild aDrmn snu)tetnmo iadlmte u o;s0trtr(rpiodopeemfetas srurxmpnt4opx mfciydfsDemu s u4alenxfciotopDelivo;(0srtoir3iu1lp  lfcsl( s2ta(  oo4aeeoiocild m rlnmsnu0 reniocoy1lmD ln i t0s2uoio oy4op n net s) rumx o;o1oeeo ieild a uluvs;u4aeeoio3iatfptelneo s0srtoxr oydlmee ies t srtrx oot0apxoif3ilt a umuvp u0 rtomrcoadlp r ueo s) euo(o iu1opeemncs (  2rrx oou1oeeo i3iydlm2ranvsnu4trtoxr3oo1lmDrlu sl(  etmim iydalen fvias arrr(r ;u0aet if3iyslaDumnvp () rerxo ta1om elnvsl()t2uoim ou4omeelfci t) rtaxmp;u4optn fetasfa2eauvs;()tltnxociy1oaD aieo s srumxr oodape licta(  rrrxmp;o1aleoio3iadla em( o u0aetnmo totopDran o s setoiopno4am e ictlsfaDrr(  nu1alxoiicias mDrm(mont4aeenxo iydla eai il( s2umirpiy1ame mnvsls  2urxroou1teto o3tltla2uln snt4 ltrio ootopD auvs;s) rumxm nudom   ivta(f rtr(rooo1tlt ii3ild m2uluvo u0texoirctodlmt luvo ( t2xm(opoo4lpeelfvils)s2tr(r nu0apxnmf3iltlaDul(mp u4tlxomr io1lp rai o;t)t2uoxo3nudalt lfvi (fsrrr(r ou0olto fciytfm2ra(vo;t4alxnmf tadlmtraueo (0t2umim no1llenmnetlt  2uau p;u0oee mo3iltls rlu o;t4arermo3oo1fmtr i i () eto(opio4open fcias)a2trxr ;t1teto f3tydla emnvo t0treoxr oadlpD lneo;(0srtr(mpny4optnliei s)sDur(  ;t0opto fciadfmDrln o (4tlxnir oydopt au sls)sexr(o iy4al e fctl() 2trxrooo0opeo ieild s umu p t4 lxoif iotlmtrauei s trtmio nodome  nct t)sDrmxrpou4aex if3iys aDean snt)arxnxr3ty1fa eli i;(0srtr(r iy4optnmfvsatfaDra( onu4oltoifeiydla2rluvo (4tlxrio tydlmD an s t0 rtm(m oy4ol e ncia( srrm(r ;u1apeoifciltlmDuluvs (4alxrxo io1fa  aieo;( sexmxm no1llteliesa(farrr( p;t0aexo ietls sDean s;t)aleomr to1opD  ueilt0 eto(r3iu1al n neiltf ruaxm ;o1olxoifeiys aDelnvs;u0aexomr3tytfm e u s s0 ruo(r oodlm   fctltfs2rrur nt4tpxnmo3ildfs uaumsn(0texrir iotfaDr ueilt)tetm(opoy4alt livsa( sDraum nu1ape io3iytfm ean o (0 rxrmrcto1omD livsls texo(r3nudolen ieslt aDrau onu1texn oeiad sDum(mo;(4arxomr3iadlmD lneo;(  exriopoudope  neslsf rtru  ot4tpeomoetys s rmn o u) rxnxo3iydlp r ivi;()srxrim no1ape lfcs tfaDtaxm no1alt iieiatfs2umnmon() rtoxr to1opD  ivi;t)trurio oodapee fvi t aDrrurpno0teen i3iytfaDeanvs t)trxrirciodlat ln s;s)t2uoir iu1lmtemfvs t a2tmxrpou4tlx ifetyd m umuvs u0 rtrmrctatlaD  ivo;t0seuo(m iu4apte nvtas) rra(r no4tlxnif3iysfa2rl( snt0alxoif iodoa elivs t0setrxr io4ll  lfvsas arur(mont1aexnmociadla2ulnvp;()alxrir ty1lmt  ivi;s sruriopiy4am nmfes sfsDra(m no0tetoio3iys m2umu o;u4 rxoxf3ta
\ No newline at end of file
@@ -0,0 +1 @@
+ieo;t) rxr(o iudlp  mnvsltfa2ra(r nu4apxnmo3ils a2umnvpn(4 etnio3oodlpDe ies s)setmxr3nudoltelneias sDtax o;o0oleomf3iyd s2ra(mpnt4teeoxr ia1la rai s t  rxo(rpny4lptelnetlt)srurxro;u0aptoifeiyslm ulnvo;(4 eerxr ta1oa e ueo;s)sexoxm iy4opt mfeia( a2trumoou4oex  oetytla um( snt) lxrmr3ootom   ivo;s0s2xmiopio1ll  mici t)a2tr( pot1tex io3ias aDrln pn(4tltnmrcootoa  li i t texriopoydlp elfvtas  rra(r ou4apxnmociys sDumu s;u)alenioctytoaDeaueil()tetr(m3ou1amtn fcsasf 2rm(m oo1tpen i3iasls2raumo;t4artnmr3oytomDeai s t  etmxrpiudalt  ncsat aDrmxr nu0oex iieiad m2ra(vp (0altnif todlmD  ieo;t0 2xr(r nu1lptemnct s a2urumo;u4aetomi3ildfm2rau snu0aexriocty1fa r n slt t2xmxm oy4llte nes tf Durxro;u4tpe  ieiytfs2um( p ()arenxo ty1lmDe iesls) euo(m3nodlp nmncs s arumxrp;t1ole  oeiyd sDel(mont) renircoo1omte ivs s) 2xm(r3nudole  netasf Dumurono4aexo oeildls2rmn p;t0tltoircta1lp ean o;t t2to(o iy4lmeemnetl()srtaxr no0aleoioeiad sDumnvs t4tlenxr3tatla   ivo;t) 2umio iy1lleelnci (fs2rr(r ou1olx ioeiaslmDul(msn() lxnmf3io1laD an i s)teurir nydalenlnviat) 2tmu pou0ape iociltla umn s (4 ltnxrcto1fa e neol() 2trir3iudale mnviat artmum nu1tlt io3iysfsDraump u0arxoxf tadlp  aiei;t0 etr(m3iu4oltelnetas sDuaumpno0aetomi3iad m2rauvon(0 etnio tydfaDrlies t s2trxmpnudapenlfetatfaDua(rpnt0tltn oeilsfs2rm(ms;(4artnmo oydoatrlnei t)trtm(o iydomte nct t arra(r ;t1optnmicilsfm emu pnu0 ltnirciytfp r n s t0s2tm(o nu4olenmivi (fa2rm(r ;u4oltnioctldfsDelnvp;(4 exomf oy1lp eaieilt tetrxr3io4lptemict ( a2tmxro;u0aeeo f3iat m emuvp;u)aleoio oatfaDeaneo ()seurxo3ny1lm n nesa(fs2tmurp;u4opxoifetydfs ea( s ()aexnmfctotoa  lueo;s  eurimpnodamt  nctasfsrur( p;u4aptnmocias m2em(mp;(4artoxo iy1opDeln sls  rtmxmpoo4llte ietls)s2trur ;t0olenio3iaslm el(ms;t) exnxr iy1laDrln o;( tetoxopiu4al nmnet tfsDtmur oo1oeenii3ilsls2ul( o;t4aetriocoytfp eauvs;(0t2xr(r3ny4apeelfeiasfa2ur(mpot0tlxomi3iytfsDrmnvont0aexnxo3oy1fat  n s t) rtm(m ny4ame lnetl(faDurum nu4aexomf3tlslmDra( p u)alenmr3io1lpt  i ilt)s2trim oy4lm   nctl(faDta(ro;t0aexn iciltfa2ua(vo (4 lxrmr tadom rln s;t)truriopoo4lm emneta( srtmu  ou0tltoiicild m ul(mont)altrircoatlpDrln o t  rtr(m3oo4lmtn iet sfsrtax  ;u1opx  feiydfs2ra(mo;() exomoctotoat  nvo t s2trxm3oy4am elfcsatf 2tmx ont0tle mfctat sDeauvp ()texnxfctodopD li o;( trur(o iy4op  mfesa(  Drmxro;t1olx  octad s2el( pnu)alermrcio1lpDraneo t  2trimpno4lmtnmici (  rtaxm ot4optnifctadla um(mp u0 rerxfcoo1lmt lu o;() rxr(r iy1ap  lnes tf 2rrxrpou0opxomo3iysfaDrmuvonu0alxrif3tatfptelnvo;t0s2xrimpnu1lp  mfetat arua( ont4tex  fetytlm2uluvs;t4trtrxo tadfaDrauvo () 2xm(m3nu4al nmfvils) Dtr( pnu1tet if3tasfs2rm(mpn(4tltnmociydlmteaies s  etoiopiy1lptnmfcsas)aDur(monu0oetnmfciasls eau pnu)areomr3iadomtrai i;t0 rxrxmpiy1apt mici tfa2um(r ot0tptoif3iltfa2rmu s;() exnxocoydfat livi s0 ruo(o oodlltemfvs (fs2rr( o;o4oeen octadfmDum( ont4arxoxf3ia1fp ranvols0trxrxo3iydlpenlfesa(f Dur( pnt0opxnmictlslsDea(vs u4 etoxrctadfpt  ivil(0srxrxmpno1altnliesasfsDur(r ;t1alxn octydfm2um(vonu0 etnir3iadlm raivsls0 rtmim3no1opt lneil(fsrrmumpou0alto feiad a eln p;()tetnxf3iatfpD aivi;t trtmxr3iu4alte fvs t  2rruroou4opt mieiyt s ulnvs t0tlxoxo3oodomD lneo;(0 etmir3oo1lmen nesat)aDuaurpot1apenif3tytla2rlnmont)alxoio3oo1lm rluvo;t0t2trxm3iodalt mivi sf rtaur ou1tet  ociltfsDrau sn()aexoxociydop e uvslt0trurxopio4lm nlics ( srtru ont0tlxoiiciytlm2emn o (4arxnif to1fpt  n s;t)srumim3ny4ame lnes t) Dta( oou0tltoioetlsla2uanvo () rtrif todfpD li i;t0truo(m3nu1lme  fct s)aDumu ono4apt mfctatfs2em( p u)tlenxociatfm r nvil( trto(opny4apt lnei (  ruau  ot0oetn fctlsfmDumnmp t)arenxr3oadomte ivs t0 2tmxr3no1omeelnct () Drrur nu1olt io3iytls emn p;()tltnmf ty1laDran s;t)trtmim3nydlltemfei ( sDtau  nu4tpenmoeildfsDemuvs () exrif3oodlp  an o t0t2uo(r nodlp  lieil(fa2rmu oou0oexoifctasfs2eanms;u0trtoifciatoptrlu il(  rtrim iodape livilt sDuax  ;u0aexoii3tydla2rluvo;u)alxrir3oy1omte u o ()trxo(o3oo1lmee nvilt) Dua(ro;u4alx mo3ils s ra(mp;u)aeeoxr3oo1fm rlnvi (0 2tr(o3nodlmtnmivtas sDurxronu0opx iocild a emuvsn() rxnmo ootlp rlueil(0trxoim nodlpeelnvt ()a2ur(r nt1altniieiaslsDeanms t) exrxoctatoaD lu i;t  euoxmpiodamenlfvslt)srra(r ou1tptn ietadls2uaump u4artnif oytfpt au o;()srtmxrpnu4op e fctlsfa2rmx p;o0tltnmociadlaDeaums t4 rxomr3ootlaDeai s t0 2umxopio1ap  mfcs t)a2rrx p;u0teto icilslmDua(vsnt0alxnxrcty1omD  i i s0srxoxr3oodalenmivtas arur(moou4aetoiicilsls uanvo () ltrir3tatopDr nei;s  exr(o3oudomen ivsat) 2taumpno0alxoiictldla um(ms u0tetomociotlm  au ilt0 euo(rpiudomee feslsf rurxrpou1opeo f3iltfsDran snu4tetrxo3iatomDr uvil(0s2uoxopiy1omeemnciltfs2tm(roou4tet ii3ilsla ulnvp;(0arxnxo3oodopDeau o;t)trurim3iu4omenlivi sf rurumpot1ape  feiytlm raump t0arermo3iydlpteaivils  rxm(m3nu4llenmfvt t  Draumpnt0tlx iocilt m el( o;t4arenifcoydfp   iei;t0 rxo(m3iu1opeelnvs t srtru p;u4aexomf3tytlmDranvo;(0 eerir ia1fm r n olt)trxo(o iy4optnlfci (fa2uaxmp;u1aet iicildla emnvs;t0aexnxr iadfat ln ols0 rtoxmpiudlleelnvilsfsDrru pou0oee  feiyt s2emnvsn(4trtnxfcta1fmtrau il(0teur(opnu1ape mici sfsrumum ;u0tptnifctadlaDeln p u) eenio3tydlm r i s s) ruoxrpoydam   fciltfs2tr( pou4teto f3tyt m ua(msnt4 eenxo iy1laD luei;s) eumxm3iudomenlfetas  2raxm ;o4apenmo3iyd a emuvo u)trenir3oytomt aues s  2tmim oo1llt mivsas  rta(r oo0alx mi3tasfa ea(ms u4 lenmr3to1lp rai o t0s2ur(o3oodalt mncta( s2rr( oou4aptnmoeiadls2elu s;(0aleomfcoytoat  n ols setmxm3ny1lle mictlt) 2tax onu1tpe mi3tat s rau pnu)aetnir3todomD auvi ( seum(mpnu1lme lnviatf rtm(mpnt4tlxoiieiasla2ul(vsnu) ltnxr3iodfatr nesls trxr(m3io1lltnlieilsfaDrm( onu0tpe mociydla rl( p t0tetoif3io1lmtr i s;t)texmxm nu4oltnlici t) Dtmxm ;t4oexnmictltfa2ranmp () exnif3iytopDeaueol(0texm(r3oydlpe lnctls  2rmx  nt1apxnmietld sDrln s u4artrir ty1la  ai o t trxrxopno1ame lieta()a2rrxmpot1oex if3ilt m umnmo;u4trxnmr3ta1lp rluei;t0 etmiopiy4op   fvsa()s2rm( ont0apenifciatlmDrm(vonu)arenxf3iotoa eaies ( setrir3iydll  lfcil( aDrrurpno1tlxn o3tad m elnvo;u4arxrir iodfmDrai ilt0 exrxr3oo4al  lfcsa(  2trxmoot1aeeo fcils m em(monu)trxoxo tydlat  iei t0 rxrirpiy1lme  feta(f Dua(rooo4ale iocildla um( pn(0artrmo3oatlp r nvs;s0t2umirpoodlpenmivilsfa2rru  nt4tlenmoeiltlsDuanvsnt4alerio3iodlmt  uvs ()t2xm(mpny1omeemneilsfsDua(mo;u4alenmi3tldfs el( snu4trtnmr oadomDrliei (0teuoxmpny1ome lfctlt a2uaxmont1tlxniictltlaDran s;(0altoxo3iatfpteaieil(0 rum(mpiydom n fci t) 2rmumpoo1olxn oeiaslm2emump;t)arenmoctatla  ln s s  etmxmpoo4lp  mieil() rrm(rp;u1tltn f3iytla ra( snt)teeoifciatfa   u ilt  etrxrpoo1ap  lietas  Durxront0apt iociytls uanvo;(4 eerio3iytfatrlu i;t  rtm(r io4omtnlfesa(fa2tmxrono4tleoif3ilt m emn s (4 lenmf iotlatrln s;(  2tr(r3nu1open fctl( aDtrxmonu1oexomfeiys a uan ont4arxnmocoytoptraneo t t2xoim io1oleelncs sfaDua( pno1tlxnmiciys sDua( o u) exrifcootopt  ivslt  eurimpoo1lpe  nci s)s2rrurpot0texomieiydls2rlnvp u)trxoxf iy1fpDranvo;t srurim3nu4llt mnvils) Dtr(m ;t1tpeo o3iytlmDum(mo;u4 rxrxo tadoatrluvol(  etm(opno4lme mfcsl(f Durxmont0opx io3tltfmDel( o (0trxrmfciatfmtrlies t) 2tm(mpiu1ol  lncs () Dumxmpoo1tpxn o3iatfaDelnmpnt0arerir tatfa e n olt  2xoxr oudlp nmfciatfsruaurpnu4oexomietltls2rmuvo (0arxnxfcio1oa eluvs s s2tr(r ny4apee ivt sfartaxmo;o0aptoii3ildla2rmnvpnt4artnmrciotlptelneols0seurio oo4apeemieia(fs2ra(m nt0tlxo feiasls2um(vp (0alenmo ta1la  luvi;t) 2tm(o io1apee fet ( arrr(rpoo1oetn f3iatlm2ua(mo (4 lxomf iytfatr uvi;t0seumir oy1om  lfcta(  rurxmo;t1opxnmfciadlsDeaumonu)aexoio todlmtrli i;s setmxo3oydamtn nei sf Drr( pnu0aetn oeiasls2eln snu) rtoif3tytfp  au sl(0trurxmpoy4lpenmfet (f Dtmxrpot1apx mociydfsDem(mp u0aexrmo3oatfatr nvils)t2xrio3oy1om n ncias srtm( p;o4tptn fctat m2rl(vs u) eerir iy1lp ranvs;t teuriopiydop e ivsa( aDra(  oo1oleoiietlsfm2ra(mon(0tltoif3iy1optrli i;t)trxoir iu4lpenlivi s)aDrr(mp;o4apt  f3tld a uau s;(4 lxrxrctodlpteanvsls s2trim io4lp   fci s)srumxronu4oltnmocilslsDrm(ms u0alxomrcootlat au i s0 2xoxm oydop nlnvsas aDrax pnt4aeeoioctltfsDranmp;t)alenxf iadfatr nvolt0srtmir iudlmte ivs sfs2rr(rpnu0altnif3iltfa2raumo;(0aexomoctotfat li s;s setrxo3ou4ame lfciltfarua( p;o4aeeo feiydfm2ul(mp t) rxnirciy1opD lnvilt0t2umir3oodllenmnes (fsrua( pnu4tle mieiys aDeau sn(4altrircoa1fm  auei s0trur(m ny1apeelfcsat)arumxm ;o1tpt  i3iytfs2ua( o (4tetoio3oatopDrluvols s2xmxm3oo4lmenmiei ()aDtr(rpno0oleo fctys a ul(vsnu4treoxr oadlmteluesls)trumxopiydal  lieil()artmx o;u0oeeo f3iyt a2ulu p u0 reoir3oo1oa rlnvslt0tetrim3oy1alee fct s)artau pnu1oeto octydfa2umnmsnu4arxrxo3totfat lues t  rumxm ou1lm n fvi tf rrrur oo1ope mf3tydla2elnvo t)alermfcoadfmD  nvo s)texrxmpoy1llte nviat sDtr( o;t1alt ifeiadfs rl(von(4arerxr3tytopD  n ils0 exr(m3iodlmte fctatf 2uau p;t1tlt  oeilsls rmuvp;u)tetnmo to1lm eaivslt)t2uo(mpiy1lmt  fcta() rum(ront1apxnii3ilsfs em( p;u)artnmr3totla r u i;t t2xmiopno1apeemneiasf Dtrx pot4tpxomocilsfm rm(ms u4 rxnmf tatfaD aieol(0 rxmir no1lltnlicils)s2rax pnu4alxn oeiasls rlnmpnt)trxrxo3tadfpDr ivo;s  2urxm3iu1aptnmnvs () 2raurpoo4apx micilsfa emn s;(4texrmo iatfpt au o t)sexoimpoudlme lfeia( arrax pot4teen oetys aDranvs;(4 ltnxoctadlpDraies;t)srum(m3no1oltn fvsas s2rrurp;t1tetnioctldlm emnmo t0trtoxr oo1oa r n o t0srurio iy1ll e ivsa() 2tru ont0oee iieiadla2el(vs (4 rerif3ta1fatelnes (  2xoirpoy1am n ivsa( aDuax pnu0tle mieildlmDum(vsnt)aetoif3ta1fm rlu slt0seto(rpnydap e ncsat sDururonu0aexoiieiys a ulump;(0 eeomfcoadfm rlnvo s) etmxr3ny1lpen net s)s2urx  ;u0apt iieiad a2ran s u) lxoxr iatop ranvs;( sexoxrpiydomtelivs (f rumu poo0altn o3tysls ranvs;t4 ltnxo3ta1lptr neo t)trxmxmpoydoltnmiet t)srum(  ;u1tlt mf3iltfsDeauvonu0aeermf oydlpD aues;t0 rxm(o oo4op e nctls aDuaxrooo4ope mieilslmDumnvs t4tltomfcia1lmtr n olt)setoxmpoudopeemivs ()artm(rpou1oet moeiyt s2uanvo;t4 eeomoctodomtrluvi;s  eurim io1oltelfcsat) 2tmuro;u4teenmi3tadfaDemuvs;() rtrmo todlmD  nvs s0trumio3iydom   ics (  2uax oou0aeto i3ilt s2rl(vs;(4 eermf3oa1fateaiei;(0s2ur(r nydome mncils aDrrur nu0olx ioeiadla rl( pnt0 lxrmfcta1opteln s s srtm(m iydapte ncslt)aDrmxr ;o0oex  i3tad aDrmnvs u)tlxomf ia1latr i i s0seuo(rpoydllt  nei tf 2urxrpot4teeoiiciatlmDranvp;u0 rerio3oy1oateaueslt0texo(opny4om nlncilt) rrax ono1optnioeiysfs eauvsnu) eenxrctydfm  li sls0srxrirpoo1omee ivslt  2ta(m ;o1tpe  o3iadla2rluvont0 ltrxr3oadlmt livi;t0s2tmxm3io4ope  nvta()a2trxro;t1tpeomf3tytfa ulu ont0aeeomf3oodoaD lnvi;( t2trxo3ny1lpen nct ()srrr(  ;t1apeomfctltfsDeanvonu)tltoxoctodfmteaues s  rxo(o ou4alte ivil()aDum(rp;o1tpeoif3iytla ulu snt4tlerif3oydfpD lueol() eumxm ou4apenmfcslsfsDrr(monu0aetnio3iltfs elnvpnt0arxnif3oytfpDrlnesls0t2umxm oy1ol emici t)aDumx pno1oleo o3iys m rmnmpnu)trenxfciodlmDeaivi;t0s2uoio3iodoptelfvias  2trxmp;u0oee iocils a2ra( s;t4tlenmf3iydlm eaivi;s0trxoim nudlmenmnei (f rraum ;u0tet  iciyt sDuln ont4aeerircio1oat ln i;()trurxr3no1om emnvsa( srrrx pnt1tltnio3tytla emnvsn(4 lenxr oodlpDeln i t)srto(opnu4ome lfetlt) rua(mpou1olt  oeils a umnmpn()aexrif3iatfmtrlnvi () exoxopou1ap n ics tf Drmum nu1tlt mfeiltlm em(vp (4trtnmo3oy1fateln i t teumio3ny1lmenmnvils)srurxro;o4texomf3iat s2el( sn(0teenxoctatoaDrluvs;s0s2umxopoo1ol nmnvs t aDrrxrpno0tlxnii3tlsla ea(monu0trxoxrctadop elueol() 2xrxm3io1lltnlnciat) 2tmur ou1apenmociaslm2eauvp t4areoxrcta1oatranvo;t srtoxm3io1olt mfeia()arumumoou4tex mi3ildlaDuan s ()arxrxo oatoat  uvs (  eurio iy1lpenmfct t a2tau  nt4opxomf3iytfaDuanmpn(0 lermf todfa  luvs s) 2uoio nu1op   ivs ()sDrru p;u1tlxo ictysfm2uaumpnt)tltnxo3oytlmt ln s;s)trxr(o3ny1lmee ivslsfsDrmuront0tlxniictltla2uluvsn() lxoir iadomDe i s s0 rumxr io1ap n ivi sf 2urx o;u0olxnmf3iyt mDul(ms;u) rxrxr3oodomtranvs s  2toir3no1llenmfcs (f rtrx pno4tltomoeiydfmDemnmp u4tetoiociy1fm  ai ilt0srurir io1amtemiet ( aDrrum no4oltnmfcias m2uauvo;(4texnircia1omtrlu s (0 2uo(r iudll emivsls)srrmur oo4ope ioeiytfa uluvp u4 etrmf iadom  luvs t  2toxrpiudom  lfei (fa2tauroou1aee ifciytlsDrmnmp t0 rtnir3tytfp  lu o (0t2xr(o3iudopeemics (f Durxr nu1tlxnmfetyt m2rmnmsnu4trtnio3oo1lat auei;s srto(r3oo1omtnlncilt srtr(  ;o1olxn ictltfm rmnvo u4areomo ootomD lneo;s)teumio nudamtnlfvil()aDtm( ont1aex mf3ilt a ran p (4 lxoxo ty1lmtr ues;t0s2tm(m nu4ape mict tfa2urxmo;t1apt  feiys m elnvp t4tlxoxoctatlmtr nei;t0s2uoxrpnudopte ncils) 2ua(rono1tpen fetytfaDul(monu4 etrmf3iadom rlieo;s0t2tr(r iy1lpen nciasf rur(mont4alxnmfctaslmDum(vpn(4artniocoytfa  anvo;t0 rur(o oo1omeemncsls) Drr(rpot1tex moetasls ua(mpnt)tltoif3iatla r n o;(  2um(rpny4lpee nct sf Dta(r ;t4aex miciaslaDea(vo () rxrmf3ty1oa eanei;t0seumirpnudom nlivs sfarur(r ;u4apxnifcilslsDemnmp;(0tltrir3todla  lues;(0teurxrpiodllenmfviltfsDua(root0tpxo ieilt a2uaumont4trxoioctotfm  lnei;t trxm(o3iydaptelivt ( artr(moou4tlxo f3tydfmDemn s u)tlenxo3iotopD luei s0s2xr(opoydlmenliet (  Dtruro;u4opxnmi3iasfmDrlnvs;u4 etrir ty1oaDrluvs;t0 2uoimpio1ll nlfvtatfsrtm( ono0tpeomfctldfa em(mon(4 rxrxr oo1op  anvs;s)tetr(mpno4om e ics sfarrru poo1tlt ii3tydls2uln ont0 reoxr3todop eluvi;t0trtoiopoo4ap nlfes t)sDrr(m ou4tlen oeiys s raumpnu4 reoxoctydlat  i o ()setm(o3iu1lptemnvsat)aDrrx  nt4alt io3tadlm2rln pn(0texrxr todfat  iesls s2umxopnodolt  fvs sfaDtr( oou4oeen fciltlm emu s;t0 ltrio ootopteaneols0setrim3iodolee nesltfaDrru pou0apx mf3tld aDrmnvp;(0aexoif3oatlatrlivo;( trxm(mpoy4lpen fciasfa2rr(ro;o1tpx mi3iad mDean snt4tleomo3tytlmt aueslt)srxmir3iy4lmeemfcsltfa2umu  ot1tleniociydfm2rlnvpnu0tlxrmfciytlaDe ies ( trxm(mpnudom   ivslsfsrtauront1texoifciydlsDraump t) eeoxo3oytoa eaies t sexr(o3iu4alenlnciasf 2rm(mo;o1tltoiociyd s umumo;t4alxrxr3oy1fa rlnvil()s2xoim no1ll e nvtlsfaruau pno0optn ociadls eau onu0alenircoytfa rluei;s0 euoio3oo4lpe mnvt tf rrrumpou1aexomf3iadfs ua(msnu4trenxfcto1latr u sl(0 euoirpoo4lmenmfvi sfs2trxmp;u1alt  o3tldlaDua(vo ()trxrxfctydla elu s s)s2xrxo nudome  iei ( srtm( pno0tlt  o3iad a uln o u4aexniociatfpt ln i (  rtr(o3io1om  micilsfarrm(  nt4aptoifeiytfaDeanvs;u4 rtoif3oadop eai s;t0s2tmimpiodameemfvtas s2trx p;u0tle  ociasfmDuluvo (4texomo3oo1lp eaueilt t2uo(m oydalt mfvs ( s2rmxr ;u1tpxomociatfa2el(vs ()texnxf oy1lpDeln i;s0 2xoxrpnu4al nmfcsat)arurxroot1alenmo3tadfs2rlu o;()trxrxoctytfp elivils s2ur(o ny1apt mfct s) 2tauront4texo i3iatla2ul(mo;() exoifcty1fp rli ols0trto(r3oudlme lict ( srtrurpnt1optomo3iat m uaums;t)aetrmf oydfmt  nei;s0 2tr(m3iy4opee icils) 2umxm no0tlx  ociaslaDra(vsn() etoir iytfa e ueo s s2trio nudam nlncil()a2taumpno4oee  feiyd mDrluvsnt0tltoxf3oatlm eli s t  rtoxo io1am emfctlt srtmxmo;t0teenmfeiltfa ul( o;t0alxnmo3tytomDelivi;s)tetoim3ou1ale mict t) 2tmuro;t4ape mf3iad s2emu onu) etrxf3iatoptrli s;(0t2xo(mpiudam nmnvs t s2umum nu1tet  oetls s rm(vs t4trtrmrctatlm r nvo;t0trxoim3no1lpenmies s sruau  ;t1aexnmociadfm2uau p;(4aetoxf ta1lp rlnei t srtrim io1ope  nviatfsDrr(rooo0optomi3iadlm2eauvon(0teenxfciy1latr nes;(0s2uoxm3oudamenliei ( a2ta(r ot4tpx if3ils a2rlump u) ltrxfcoo1fmte ivo;t  etr(opou1llen fvs sfaDrrxr ;t0tpxnmi3iys a2ul(mp t) eermr oytfm r i i ( t2xm(m3oudopenlnesltf 2taum oo4tle  fcild a ulump u4 etnxfcoadom r neil()seumirpnu1ame  fetl(f rum( pnu1oetnmietadls ua(monu0artrxf3ia1lptrai i;t)t2uoim nydol elnvia( sDrmumono1apt mf3tatlm2el( o;()trtrxfcta1lp   ivo (0 etmxrpny1ll nmnvi (  2uaumoou0apxoii3iadlmDum(vs u)aexnxo io1oa elnvsl()trtoxm3oodolee fcsas s2taumpoo0apenmfciytfs2uaumo;(0areoif iatlm eanes s sruoimpoydape mfcta( srurxmp;t1alt moctls s2um(von() eenxo oytoaDraieilt)srxrim iy4om emietl(fsruaxronu1oeenmoctat mDea(von(4 lxoxr3iytop rlivo;s0srxo(mpoo4lmeemivsas)a2ua(ro;t4apeniieiat s2umums;t) exoir3iodopDrlnvs;s0srumirpou1oltn neilsfsDtau  ou1aet mo3iysla2um( p t0 ltoioctotlmDeaueils)texmim iu4ale  ivi t s2taurpnt1alxnmoeildla2ua(mp;t)trtnmrcoodomt luvilt0 2ur(m3no1ap emncs s  rua(rooo0tee  ociydfa el(mp;u4arerir oadlaD aues;(0 2tmio3nodlmen nvt (  2umurpot1oltn feilsfmDranmo u0tlenxoctydfptrln ilt)trum(r oydlmen netasfartmxm ;u4oeenii3iyt aDrmu sn(4aetnmf3todoptean s;() rtm(rpnudol nlivtas  Dta(ro;u4tle io3iad a2ul(vp (4artrifcoodoaD  u o s)trtrxr nu4optemfctltf 2uaurono4tet ifetatlsDemuvp;u0arxoxf3tadfm elu i (0srumio iodlm nmieslsf rtru pot1tleo f3iytla ean p;()texnmf oy1oa   i ol( s2xm(o3iy1lpenmictasfarrr(ro;u0openmo3iys a rl( onu4teeniocootomDe nvo ( t2xmxrpiy4ll  mncsl( s2tax  ;t4tpenmictasla2rmu s t) etoxr3io1oa e nvsl(0s2tr(o3oo4ol nmnes (fsDuaxrp;u4texo f3tyt sDem(mpn()trtoif iy1fptr u sl(0s2xrirpnydlpe mfeia(faDtaump;t4tleoioetlslsDraumpnu4tlxomr3ty1fpt ln ols t2xo(rpno1lmeelncsa(fa2urx o;t4tlt mictltfaDua(ms;u0trtrmo3oo1opDraies;s)seto(opou1opt liesas  rumxr nu1optoiieiat s uan sn(4tetrio3to1oa   neo;()s2uoim no4ol nmnvsa(fs2urumo;o4ape miciasfsDuan sn(0texrio ootlmD lueils setoim oydlp  lfvt sfsrumxrooo1aexo o3iadls elu p t) leoir3ta1op elneol(  2toxmpnydop  mfesl(fsrtru ooo4aetniictad aDemump;u) lxnifciatopDraues t0 2xmim3oo1lp n fvs tfsDur( p;t0alt mfeiatlaDeln s u0texoirciydfaDeau ol()s2tr(m iy1lm n ieil()s2uru pot1ope mfeildfa um(mp t0texoxocia1fp r u s () rurir io1lpt mieias  rur(r ;t0tpx  o3tydlmDuauvo ()aexnmo3tatoatraivs;t) eurxrpnu4ol e fes sfsDta( o;u4olen o3tld a2umnms;t0 rtnifciytfm rai sls)tetoir io1op nmfetlt) ruaumoou0aex  oetad a2rmnmo;t4aetrmo3io1oa  ln ol( t2xrxo ou1alenmnvtatfsDurxmoou4opt ii3iatfmDrl(mp u4texnxocoytoaDe uvo;t) exrxm3nudlmtelfetas) Dtrxmpou1texnii3ildfa2rmnvp u4aetomo3totlmtrlivo;( setoio3iudal e fcs ( s2ra(mo;u4opxn fetlt s ua(msn() exoxf iadfm elu o s t2tmim3iudlpee fct ( srrrurp;o0apxn oeiltfa2rlnvs;u)alxnmf3tadlm ean s s0srxmxr no1opt  iet tfs2trurpnt1aetomf3tytfs eau sn(4texnmr iydfm eaivo s0texmirpiudale lnvs sf 2umx pnt0oleo ociysla emnmpn()artoxociodfa r ueil()srtr(o3nudolt mfcilsfs2trxroot4aeen feils m2eanvsnt4alxrxo oy1lmD  ueo ()texm(m3iydlptemnet tfartru p;u1tlto ieiatlsDemumo ()teenxo3iytfpt  neo ()s2xrir nodol elivtlt srurxmonu0tlxn ieiasfm rln onu4trxrxo3oo1oa r ieo t)s2tmxrpno4am  lici (fsDtmurpnt1tlx ifeildla ul(vs;(0trxoxf3iy1lmDrauvs;t s2xoxrpnydopee ivs t sDtaxro;o0teen fciys s2ran o u) etnmf iotop elivsls srumirpiydll nlfes tf 2urur ;t1apxnioetysls2rmu s (4teenmo3ootlatelu il( t2xm(opoy1lm e ieia()aDtmu  oo1alxnif3iyt s2rm(vsn(4tetoxo3ootfatrlieo;t)t2toxm oodll nlfetl()artrxrpno4aeenifeiyslm ra(msnt4aexomo oadoatr neo;( teuoio3nudolt  nvt t)arrmxrpnu4tpx mf3tadfsDrl(mont4tetoiocoytlmt ai o;s0trum(m3oo1lmeemfet tf rtm( ono4tee mi3tydfa2rln onu4arerxo3iy1fmtraivs s0t2urir3oy4aleelnes t srtr(rpnu1tex  fcilsls uanms;t)alxnxfcoa1opD an i;s)trxr(opou4ap e nvias s2ur(rono4ope  fciyt s uan snu)altnxr oadlm   u ols)srxoim3oy1om nmivs (fsrtr( pnu4aptnifciys m uauvs;u0texnxr3ta1fatraneo;(  2umxr oy4lmtnmfvtl()srur( pou1oetn oetaslsDelump (4altrifcto1lmD anei;()sexm(m ny1lmen ietltfsDtax oot4tee mieias aDelu p;u)tlenxo3ta1lpt  i i;( srtmim io4openmfctls)a2rmx oot1aetnmoctad a2rlumpnu)altomf iydlmDe nvi s0trxmxr nudapeemicsl(fsDrau p;t1aetnifcildlm2ul(vo u0aexnxo3ootom   uei;t texoim nu1aptemivsls)sDua(  oo1ole moeiydlmDra(mont0teenxoctotfpD auei;( trtoxrpnudomtelivs ( a2ua( onu0oexoiiciytfm2uauvp;u4 leomf3iadomDrlivi ( tetmim3oy1al e icta( srumxmpnu4optn feiyd m um(ms t)texoxfciatoaDrau o s) rxoxm oudalen nvslt)s2tmumo;u0aetniociysfs ul( ont4aexrmr ia1fmDe ieo ( s2urirpnydlp   neias)s2tr( ont0aet  oeiyd a2rmn p t0treomrctadoaDe i ol()s2trirpnydlpt  netlsfsrrr(mo;t1apeniictltls2ulumo;(0alxrio3oa1lmtelneo ()texmir3iodapenlncsas) 2rax oot4tex moeiltfsDrmnmp () exnio3to1oatelnvils0 2umxm iy1omee feiat sDtaum oo1tex mfeiadls ra( o;() ltnmr3oytla  aies;s texr(o oy1lmee feiat  2trurp;o4oexn octytfmDumn o () eeoxocoo1fm rau i;t0sexm(o3nu4omenlfcia()srua( o;o4aet  ietadls eau s u4tetnxf3iotla ranvol()setmio3iy4llte ivslt)srrmumpnu1alt mo3ilt m2rmuvo;t)arerir oytlm  lneilt t2urxrpio4lm nmnvsls arrmu  nu4tltniietat s2rlnvs;t0 rerxr totomDe ieo;t0t2tm(rpnodam   fvtlt)srtax pnu4ope ifctls s rauvsnt0aexoxfcoadfa raies;()s2tr(o ou1lltemfei s)sDumx pnu1tpeo icias s um( pn()aexnmocoa1lat anes;t)t2to(m nodlp emict t a2rmumoot1alt mictyd s uluvon()tleoir3iotlpD anvs s teuo(o3io4lltn nei sf Dtmxroot4oetoiicias mDum( pnu4artrmocoa1oa e u o s0srurimpno4lmt  nesa( s2trum ;o0ale  ictld a2emuvp u) lxnif ty1opt lnvs (0tetmxr3nu4op e netls srrrx  ot0aee  f3iasfmDrlump ()tltoxo3totoa rluvs s s2urirpou4lp e fcs ()sDur( pnu4tleniietas aDea(ms u)alenxfcta1fmte u ilt t2toio iydamenliet (f Drmu  nu1tlxnif3iyt m ulnmo;t)aetnmfctotfat lnes;t) etoxopoudlle lnvi t s2tmum oo0tet mf3iydfaDelums t0tlxrxr tytfaDe nei s setm(r3io1ape  fei sfa2um( pno0tex  iciytfaDem(mp;()arxnxf ootfmDe n il()s2tmiopny1oltnmfcs t  rua(m nt0aptoifeiltfs2eanvs;(0trerxo3oodfptr u s;t0t2tmxo3iydal  lfvsa( a2tmum no1tptn i3tldls2ulu s;t0 exoir3totom eauvo (0seuriopnudop n fetlt  2ra(m ;t1texo ieiyt a rm(mp () ltnxr iatfm eauvs (  euoxo3iu1oltnmieils)arrmump;o1aeenioeiltfm eau o u0altoxr io1oaDranei s)s2xo(o oo4optnmnetls a2uaum ot0apxn fciytls emump;t4alermr oo1fptran olt  exrimpno4oltn ivil()srra(rooo4oeeoiietasls elumsn(0tltnmr3iodlatelieo;() rxr(opno4ame  iciasf Dumx  ;t0opeo ieiatlm rm(vo u4alxrir tadop  luvo s)setrio oy1amtnlnvsls)sDurxmonu4oltoif3tltfa2ean pn(4 lerio3iydomD  ues s)s2uoxm oydal  lnesa() rumur ou4alto ocildlsDemump t0arenxf3tydoatran s ( s2tmxopny4llte icsatfsruru p;o1opto ieiasls umu o;t) rxomocoo1lateauei;t0 2xoxm ou4ll  lfetas  Dua(  ;o0oee iiciasfs2emu o;(4alxnxfcoo1lpDelnes s)tetmxm3nu1oltemfet t)srrrxmonu0alxn ociad sDuaump u0arenio io1omtraies;s srumxrpnydopenlfciatfaDtau onu1oltn oetlsfa emumsn(0 rxoirctadla r n slt) rxmxo nodapee feiat  2rm(rp;u1opto fciatfm2elumont0teenif tytoa  ai o;s)tetm(mpiydlle  fetasfsDrmu pno4apxo octlslmDrmu p;() ltomf oydlpDeaneolt0 2uoim3oo4omt lnvtl( a2tmx onu1alxniiciat s rauvpnt4 leoxr tadfm e i ols0t2xm(r3iu1lpe mnvsl(f 2umu o;t0openiieiydlmDrl( s u4 eeomfcia1faD  i sls)s2uoir3oo1omtemies (fsDururpno4aptomi3tldlmDul( s u0 lxrxo3ta1oa r ivsl() 2tm(m3oudlmee icilsf rrm(mpno1alxoioetatfs umuvsnu0altrxocoodoatrli i;t0trurxr3nu4lp  mnvi ()artau ooo4texniieiltfs2elums;t4alenxoctydla   ieolt0tetoiopiy1om nmfvi s)arrrxrpnt0tlx mociytlmDumn o ()alxnxr3oa1lm raues;(  2trim3nodlmtnmnvi s)artaurpoo1oee  ocildlm2rlnvo;u4alxoxf3oydfa e i ol( s2toir ou4opeelfcsat  rtmx  nt4tlxnmoetytla2rmnms;t4alxoxr3io1lat aies;(0 euoxo oy1omtemfei s)artaumpno0opx  fciytfa rm( p;u4alermfctodlate nvs t0sexmir3oy4am emivi sf 2tmxm nt4oetoiiciltfa2raumont4tlxnmo ia1laDrlnvs s0 ruoio nydapee icsls aDtmxm ou0altniieils m rau o t) lxoif3iadfmt  i i;s0t2tmio3nu4amt miviatf rtaxrpou0tpe ifetadlm rlnvs (0artrirctotlmDrlivi;s t2urio oo4altnmnesatfaDtr(mp;t4apxn f3ilslaDem( p;() rtnif3oodfaDrlu s;()s2xmxm iy1lmtemfvtat  2tm(  ;o1olto i3ild s ra(vs;(4 etoxrctydoa rai s;(  etrxmpiy1op  mnciasfa2rm( pnu1ope  fciyd sDulnvp (0aeerxr ta1fmD  uvo;( texm(opiydamte fviltfarrm(rpnt4tlxn icildfaDranvs;() lxrxo oytfm  aivilt)trxoxopnydapeelivi s srta(r ;o0tpeoifciydfaDrmnmo (4 etoxfciadoaDeluvil(  rtrim ou4llenmnes s) rraumpnu1oleoiictadlsDuanvs;(0 lxrxr ty1optran o;t)s2xm(r io1lpen ncs ()sDrrum no4tptomf3ilsfm2elu p;() rtrmf3oytomtraivilt0 rtr(mpnu4lmee fetl()aDrr(mpnt4openmi3iatls2raums (4artrio ta1fa ran s s0tetmim nydlmt  fci ( s2rmum nu4tlxnioctytfa2eau p t0 rxnmo3tatlatrlnvol(  ruoiopio4ol elfetl()srtmxro;t1alxomociatlmDrlnvpn(4trxniocoy1latr ivs s t2tmir io4ol emfviat) Dtaurpot1ape moeiydla2emuvo (0teerif3iatfp ranes;t trtmio3nydapt lfesat)s2ua(rp;o0oex ioeilsfsDraums (0teeoxocoatoat livo;t0trxmxr3oo4amtnmfcs tf rrau poo0teeomieiaslmDelnvs;t4alermrciotlpteluvi ()texriopnu4lmen fvtas arta(m ou1opx mieiatfm ul( o;u0trtoir3iytlm r ues ()seur(m iudal emneil()a2raxroot1tlxomfctatfs emn o;t)artoxr3tydopte u s s0tetrxo3io1al emnvia(  rra(rpnt0oetnmfciysfs2ea(mpn(4 exnmf3oa1fatrlu s;t0trtr(r iu1ale mnvsltf ruaxmo;u1aee  oetadlm2rau o u)tltoifcoo1lmDrln i;s trto(opiu4optelncs t sDurx pou4tlxn oetydfaDrlnms;t)aeeoiocoadlaDeluei;s0seuoimpou4lle lfvils  Duaum ;o0aetoifciysla2eluvo u0aexoir3iy1fpt lnvs;s0 2tm(o3oy1lp n fcils sDtrxrpnt4oltomo3iasla2elu snu4tlxnxr3todfa   n s;(0t2tmiopiu4olt mivs s artru pot0teeomoetltfm2eau p u4trtrmr oatlpD ln il()sexm(r3nu1ape lfei s)s2raumpot0teto ictysls ranvsnu4teerxo tadop rauvi;(0sexmim no4ap nlneilt)sDrrumpou0tpxoiiciysfs ua(vs;(0trxrxf iadfm r u sl(0texoxr iodope licslt  rrr(mo;o1teto fcild s2rlu s () lxrmf3iodoaDr ivo;( trxoir3oodop nlfet sfsrtm(  no0olxnmoctatfaDum( s t)trermfciytfmtelues;t0 rumxm3no1lptnmfvsl(farrr(ront1opeoifeiytfs2um(msnu0 rermo todoaD lnes;t  2umim no4omtelfet (  Drau pot1oltomociyt a rlnmo u4aleoifcootlpDeaues;s)texm(opio4lm elictlt)aDtmu poo1opxnmfctatlsDean snu4arxoxo oo1oa elneo t)setm(o3iydlle mfes t) Draum no1olx ioeiatla rmnmpnt0aetrxf tytopDr uei;()trumxrpio4apt lieia(faDtaxr ot0ole mfeiadlaDumnvs (0altrif3tadfa  aues;s) euo(r oydom e fvtls)aDuru  ot0oexomfciytfa2um(mp t0alxnmo oatlat lnesls0seum(m3iy4omtnmncil(  rtaur oo0tleomo3iat s2rl( pnt)arxnmr todlmDran s;()srum(mpno4am emivta(fsrrru  ;u0alenmfcilt mDum(vont0 etrif3oatoaDelivolt)t2toir3ny1am n fctlsf Durxmp;u4apxn feiad aDuanvs t4tltomo oodlp  lu il(0 2umxmpno1lltn ieia(fs2tm(  ;o0tptomfeiat sDrauvs (4aexrxrcia1faD livslt sexr(r oy4lmtnmivi s  2ra( o;t4aeenmfctls a rl(vp u)alxnxr3iytlmtr n s ()sexmxmpoydal nmnes t srrmur nt1teenifetysfa emnms;u)trtoio3oy1optran ol(  exoir iu1ole licsa()arurxmpnu0oltoif3iltla rmuvsnt4tlerxfctatlp rlnvo t0t2tr(r3iudap  mncsl(f rtmu ont0optoiiciltfm2rln p u4texnir oo1fmt aivi;(0tetr(m3iodop emfcia() 2rrurono1oet  icildfm2rmuvpnu0trerioctadoaDe ivi;( seto(rpio1lpenlieslt) rua(m oo0olx mfeils s2rlnvonu0aeermo3oydfaDrlnvo;s s2xr(r io4omt lnct s sDraurpou4oetnmiciadfm2rmn o;(0aleomf todopt  uvo s0sexoim3io4omt lfct (  2ur( p;u4tet iieiadfs eau s (4aetnmr3tydfaD  i o;(0s2uo(r ny1optn nvs () Dtax p;o1opt ifeiyd m ea(mo;u) eenxf3oatlpDeaies;t sexr(o iy4lm   nvsa(fa2ua( oot4alt mictlsfs elnvonu4trxniocta1omtr u s t0setr(mpnu4opt mies sfaDurxmpoo0oee mfetyd a2em(vp;u4 etoiocia1lmte ies s0trxrim3oydolenlnvs (fs2tmxrpnu1oetoifctls m2rm(mon(4tltrxfcoadlmDr n i;t)srxoio3iu1omtn iesas)aDtaxroou0apt iieiytls ulu on(0 exomo iydfpDeanes () rxm(m ny4ap nmncs t  Dtm( o;t1aeto f3ilt a rluvo ()aeenxr ootfpDeai sl( trxmir3oudol nlici t)s2rm(  nt0tptoif3iltfmDelnvs (0texoir ia1fmD ln o (0teuo(opoudoltn iciat  Dtm(rp;u4aex mociyslaDulnvo;u)aleoxrciadoaDeluvs;t0 exrxr3iu1amen ieias) 2ua(  ;t0tleo feilslm ua(vs;t4 lxoio3iydlm rlieols0setmxr nu4ap n ivia() 2umum oo0apx moetasfm2uln p (4 lerio todoptrlneils)t2xrir oydolenlfct s a2tmxrp;u1tpe  ieiatfs2uauvsnt)trenxrcty1om ranvi;s sexoir3ny4lleelfvslt)srta( pno0tet ii3tasfa um(ms;t4trenir3iy1om eluvo;(  2xo(o3nydoltemfcs () rum(ro;t1aex mfciysls2eanmp;t)tltnxf3tadoa eanei s0seur(opoo4aptemfvt sf Durxrpnu0ape mo3iatlm2um( o;()texrio tydlmDrlies;s) etrir3nydaltnlietls) 2raxm ou4tltn feiatfmDean s (4aexrxf to1lptelivols  ruo(o3ny1llt  net t)srur(r ;o4oltnmi3tlslm em( ont)tltnmr to1oa e uvolt trtrxrpny1lptn icsa(fs2uaxmp;t4oexnmfcilt s2um( sn()aexoif3tadlatrln sl(0srxm(opou1ol nlnvt t sDta( pnu0alx mfciyd aDumumo ()trenif oa1oaD auvsl(  euriopiu1ale mfvt s sDur(rpot0tltn fctydfa2rmuvs;t4 reoxo3oydomD  i o;(0 2xmir3oudole lnetl( a2rrx ont1tet ioeiys sDua( pn()aexrxo tatoa   ues s0 2toir nydomee fcia(farurur ;t0ale ifeiltls2rauvo;u4teenio3iytop elnes s t2xr(o3iu1optnmieta( s2rrum nu1tptnmictltfmDrm( o;t)trtoxfcio1oat lnes ( teum(mpou1om   ietl( sDrrx ooo1oeen o3tld aDulump;t0alenxr iytfmDeaueo;s0srxo(o3iudlm elicta() 2tmxm ;t0tpx  f3ildfs2emn s;(0 ltnxf oytfa  aiei;t0trurio nudope livtlsfsruru pnu4aeenioeiydla em( p u4trtnif3iotlmDrln sl() exo(m3oy1lp n fvt t) 2rau p;u0tee if3iyt m2rlu s;(0 rtomrcoydopDeauvs s trumim oydap emies s  2taum ou1oexn octltfaDua(vp (4alxoxo3tatlpt anesls tetm(o3iy1llee ivtatfs2umxr nu1tlto ictys sDrauvpn(4 ltoifcoodlpDraneolt)tetoxo3nodlpe mnetlt)arra(rpot1ope mfciysfaDuluvsn(4trerxo3tadfptrluvi t0tetrio ny1olenmnes ()aDtru pou1opxnmicild s2elu p (0 rtrxf iytfaD ln o s  rxo(o oudop emfcs (f 2taxm nt1oleo o3iatla rl( p;t) etoio3iadlpt liei () 2tmir iu4al   nctlsfaDtm(mpot1alx  fcils a2emumpnt0arenxrctydoatelu o s)s2ur(r3oo4ope mivsat)a2ur(moou4tleo octydls um(vsnu0aetrmfcio1optr uei t0s2xmxmpiodlme lictas)sDtmum ot4texn ictydls2emumpnt4 rtrif3iadomtr n ils)seto(o io1alte ict ()aDrruroot4tpx if3ildlm um( s (0trenmf3oa1faDeln o t seumxmpny1op elfvtl(  2ta(monu4tpenifeildlmDrmn o t) eeoif oytoateai o;(0srxmim3iu4ape lfvtat  2urxmonu0alxo ocilt sDrlnmp () leoxo3ta1faDrauvols)tetmxm3ny4lm   icils)s2uaxroot1aetnmiciltlaDem(vp t0aetnxo tydla  li i;t0 eumim3ou4alenlfetl()aDtmum ot0olx moetytlm ra(vp;t0teeoir oydfaD au o t  etrxm nodamtelfvsa()srraxm ;t1tlx  iciytfaDemu s t0 etoxoctotfa elueslt0 2xmxr nodlltnmncilt)s2tmxr ;t1apxomictltla el(vo u4 etnif3iadop   u o s)t2urimpou4oltemnvi s srtmurp;o4tex ioctltfs2eau s u) lxrif iadom  lueil(  etrxo3nu4ol n fvsl(  rrm(rono1oetomi3iatla ea(vonu0 rxoxfciotopt luesls0srtriopiodome  ncsls srtrumpnu1alxnif3iatfs2eauvo (0tltnifciatom eluvo ()t2xo(mpiy1omt mivs (fs2uax o;t4aex if3iad m2em( p u0 rxnxo oatfaDrli o;(0srtmxopny1ap emfet tf 2urxmpno1oexoio3iadfmDeaums u0aeeoxo3ootlmte uei s  exr(r3nydopenlneslt  2ua( poo1aeto oeiadlm2elnvpnu0 lxrmf3iodlmt auei;s  eumir oo4optnlieil()s2rr(r ;o4oetoiietas s2ulnmsn()altoxo oadoa  anvolt tetoio3io4lmtn fvt sf Drm( onu0teenmoetld m um(vo;t4altrmrcty1omt lnesl(  rtrxrpiy4ape lictasfsDrmur ;t0aetnif3iyt s2rlump u4 rxoxocoo1om eaueo;s tetmxm oy4om  lfvsatfs2um(monu4aptomfcild aDulnmo t4aetnxr tadfpt  uvsl( trtmxrpnudaltnmnvta(f 2ta( ono1opeoio3tadlaDua(vp;t) etrmr ty1lat  ivil(  rxo(m nudlptemfvsa() Dra(  ou1tet iictyt a uln p (0 lenir3iy1optelnvs t0 2toxmpoy4ol n nesatf rrmx  ou1tpeo octltlm2ua(msnu0alxomo to1laD  ieslt)truoim3nu4olee nvtatfs2uaxmp;o4alxniiciltls uan pnt0trxrxrciatlmDelies s)sexoxm3iydomee nes s)sDtau pnu1aptoio3taslm2rlnvp;t)tlxrif3iotoatean i t) 2tm(m3iy4al nmfvtat) rrrxro;o4texnmieiydfmDem(mo;(4aeeoxo3oo1fm raneo ( t2xoxo3io1lp  lnet s) rurxront1ape mocias s2raums u) ltoxr3tatoa ranvo s tetrim no1alt lies s aDtau  nu1aptoii3iytfaDumu snt4arenxr3oy1lpDrlnvo;t) rtr(m3iy4ol n fcsa(fs2rruro;t0oet ioctat m2ra(vpnt) exrxf tadlptr ueols trxoxopio1lpen nvs ( s2tm(m ;o1aetnmi3iatlm elnvs;t)tlxoioctadlat anvslt srurim ou4openmncilt a2rr( o;t1tptniiciad m emnmp (4arxoxrcia1omtraieslt0srtmiopoudom emfcilt)sDumx pot0oeen ietls a2um(vs () etrxocoatlpt  ueo s) 2xrxm no1olenlivia(  rum(mp;o1tet  iciasfaDel(vonu) exrmoctydfm elivs s)tetoxm3oudlmtn fvsatfarrax  ;o1tlxomoctltls ua( o;(0tetrmf iy1fa eaieil( trtm(r iudlp n ieiat a2ta(rono4alxnifctlsls ul( s;t)altnxf3to1lm   uvo;(0s2trio3iy1ap emfcilt)srtm(ronu0tptomf3iytfs rmn ont) renmocty1lpDeln sls0sruoxmpoydole lfvsat)arumxr oo1aetomfeiysla ra(mpnt4 etrxfcootlpD aieslt setmxmpiu4ame lnviat) 2tau ont1tle iociydfm rl( pn(4tlerio3totfatelnvo t t2xoxo3nu4llt  iei sfsDtax oou0oee if3tytfmDem(vsn()tlerxr3iatla  au s s) 2toim3iydam elnvils)arra( ooo4aexnmocildfm ranvp t4tetnir to1opt aneil(0trxmir oo1amtnmfet t  rrr( pot4oet  f3iytlm emuvp (4trtnmfcoydfa raivs;(  ruoiopiodale  ieiat aDrrum ;t4apenii3iyt a2el(mp u4 eenmrctatlmDrlneo (0tetrxr3no1ole  fcs (  2taxm nu1alt iieiatls rl(mo;(0texrxfciy1lmtr nes (0t2xo(m3iu4ll   fctl() rraur ;t4opxn i3tls a2um(mo;(4teerxf totlpteli s s)srxoiopiy1omeelnesat srraxrpnu0tpx  iciadlm2em( sn(4 rtnmoctydfpDe i il( tetmim iudlpee ncsat)srraxmo;o0apxnii3iltfa2ra(vs;()arxoxf oydopD aneilt  2urim iy4ape licia( s2umu  ;t4apen oeils a2em( s;u4arxoxf oo1fmDe ieo;s) 2toxr iudlmeeliet s srra(r oo0tex  iciltla emn p;u4texnxf todfaD  nesls  exmirpiy4ome mfvsat  rraxmo;o0apx  f3iadfa eaumpnt0texnxo3oo1omtrli sls0srxrxo nu1ol emicil( sDrmu pnt0oexn f3iydfsDuanmp;t0tltnmr3ootlmtr ueo;s t2urim nudape mnes tf Drmu o;t4altoifetydlmDuln s u)aeermr3tatfateaivi t srtriopiudole mfeiat  Dra( ono1tpe  fetytlm eau s t0 eenmr3oatfmDr nes;( texm(opoydale  fvslsfaruaurpot4apeomociasfsDua( p;(0 rtnmrciodfmte nvi s s2uoxmpiu4alt lneta()a2rrurono0tlxn oeiytfs ul( pn(0tetrxf3tytoaDrauvsls0teuo(mpiudlpt mfvil(  Duax p;o4teeoio3iydfs2rmu p;(0aexnmrciotomtean o ( trxrirpiydalen fvtas)s2ur(mo;u1texomieiytlm2ul( o;u0alenmrcoodlpteaies;()s2xoio3oy1olenlivta( sDur( pnt4oeeo oeiasfs ean sn(0 lenmr3tydfptranes;t)t2tmxo ny1apee nesl() ruaxrooo4alt ioctltlsDuau o t)texoxf tytfa ran ol(0s2xmirpiudlpte neils  2rmu o;u0olenmictltfm rln snt)tltnxf3to1omte u ils s2tmio3no4am  lfvia(  Dtrx poo0tleo feiytls ra(vo;()trxrifcoadomtelieslt s2uoimpou4ll nmfes t  2ta(m oo1apx  fciatlm2rlump (0 rxnmr3oatopDelu s;t srxmxmpou1opt  nvtls  2raumo;o0oeen f3iaslm2ua(ms t)tlerir io1lpD auvi;(0s2um(mpoudoptemfcsl(faDtr(  ot0tptnmfeilsfa rlnms;(4altnio ootomDrlnei t0srur(rpio4omtemies t) 2rr(m nt0oleniictad a eaums u4aexoxf to1om e uvils0trtmxo iodoptnlnvtlt)a2rmx poo0aex  fciyslmDrl(vs;u0 eenmf3tadlatrln i s)tetmxopnu4ale  ivt (fsDtaxm nu4oeeoioeiydla2rlu p;(0alerif3tydlp eluvs;t0 eum(r oodlm nmncs s a2rm( o;t1aetniictltfsDua(vo;u0 rxnxr3tatfp r i slt0t2xoir3oydamte ivtlsfarrrxrpno4oee moetad m2rln p ()teenxf3oatfat luei s)seur(rpou1oltnmfvt (faDur(r ou1ape  fctldlm ran o;()tetomr3oatomD lu s t0trtmxr nu4oltelies s)arrr(mont4optnifctydls uau o ()alxomrcta1lmDrlnei (0s2trxo3oydlmte nesls  2rmx  no0ale mo3iad s2eau o;u0teerxr3iodlatr ueo s t2um(r3iy4opee fet tfaruaxrp;t0olx  fetldfaDrm( s u0 renxf ia1fa  ai ols s2to(m3oo4lm n fvsl(fs2tr(mooo0tpt ii3tls mDumn o t)trtnio oodfaD lneo;s  2trxr iy4lp elfvt sfs2ur(rp;t0oee mi3iasfm uanmp u0tltnxr3iatfaDrlnei;s0s2umim3no1ll   netlt)sDtmu  no0teeoiiciytlsDem(vsnu4 eenxo iadoaDelneol()t2to(m3oy4apt mfei ()a2um(  ot0oeenii3ildfa eau p;(4texnxr to1fm ean o;() 2umxopoo4llenmfctl() Dtrum ;u4alxnmoeils a2um(ms;(0 reomr3iadoat auei;()sexo(o3iudol emfvi sf Drmurpnu0tlx mfcilt a2um(vs t) rtrmf3iotom eaivi ( trtm(r nu4op  mncta(f Dtax p;u4tlxnmfciadla2eanvs;()aetnifcoytfmD liesls0s2xm(rpiy4ap nmictl( s2tmu ooo0tpxn oeiat mDem(mp;u4arerif tydoaDraiei;s) rtoir3oy4lmenlfeils sDtrxrp;u4apxn i3iatls2ulnvpnt)tetomfciytoa  ai o s0 euoxm3iy1llt  ncs t sDurur nt1tetnmo3iaslm2ul( pnu4 rtrmfcio1fp   i i;t  eurxr no1op emfvtlt)a2rr( o;u1tlx if3tytls2ulnmo;(4 etoxo3iytoa   ieo t  etm(o ou1lpe lfvsl()aDtr(root4tpto f3iysls2rlnmont0altnmfciotfaDeauei t)teum(m iu1opte nvi s)a2tr(r oo1olto ictatfs2ra(monu4 eeriocoy1fa   iesls0trurxr3oy1lltnlici s) 2ta(mo;o1aee mf3tlt a2rlu pnu0teerxr oytlmt auvs (0 rto(rpiydlm n fcta(  rrru o;u4olxoio3iys s ulnmpnu0arxoiocto1faD  u i;t srxr(rpio4lle mnvils) Duaur ;u1oeeniictys mDrm(vo;(4texrmfcoy1omD luvo t) etrxr ny1lptelfcils) 2trx oou4alenio3iyd aDumnmpnt4 exomo3oodfmDe u s;( seumxo3ou1al emict ()arra(  ;o4olt  iciydfaDrlnmpn(4trtoif3oadfmt li ilt sexoiopno1omeelnetlt) Dtrxmo;t0tltnioeiydlmDea( ont4trtrxocia1fmt  nvsls) 2xo(opoudame lnvia( sDtrx o;o0tle io3tldlsDua( s t0aeeomo3iatomD anes;s)s2toio3iudoptnmfcs s  ruaxmooo1tpxnmietlslaDuau s;(0 ltnmfctydoa  li i;(0t2xmir3oo4amt  fvs ()aDrrxmono0tpxniictlsfsDumu o u4tetnmoctatomt an i;( srxmimpoydaltnmfes (  rta(r nt0tleomo3iytlmDelnvs t4trtomo3totla  au i t0 2toir oy4omeelfvtlt)a2raxrp;u4oexomf3tldfs2rluvsnu0trxoio3io1lmDeli i;s trum(m iodllt micias)sDrau ont1tpxomo3tls aDrm(vs;u0tltnmo3iodlm  lueslt) etoxrpiu4ll  liesls)aDtmum ;o4tpxnioeias m2emnvs;t)tleomf oytomtr ivo (  2xr(r nu1oltnmnvsa(fsrtrxr oo1oltoiociydlm ra(vpnt)tltnif oytomDelueol()trtrirpnu4apeemncsatfs2rr(m nu4alx  fctlsfs2ea( ont0arxniociydomt anvil( sexm(o ou4lmeemnvtl(f rra(roou0tlxnmoetysfaDulnvont)texnmfciy1oaD lueslt tetmxr iydlmenmfcil()srumx  ;o1tlx mfctydfs2el( o;u0arxrxocty1fmtrli il(0 rumim3oy1apenlncias srur( oou4oeeoiietld a rmumsnt) eeoio ta1fpt  n s;t) rum(r3oy4amtn iesltfartaumpnt0tpto oeiydfaDem(mp (4 lxoiocoydfmDrluei;( t2xo(m3io4olee fcilsfa2rm( poo0aleomoeiytfaDrluvon() eeomo io1fate n o s t2tmxr nudlp elnctl( aDrm(m nu1openmf3tadfs umnvonu0 etniocio1optranvol()srxoxr3iy1om elfes (  2trum ou0oeeomoetatfaDrm(vpnt4areoxo3iydlmD ai o ( trtoiopny4alt lneslt)aDtmx pnt0tpxoii3iadls emnvo;t0trxrxr3todomt aues;t) 2xmir3iodomen iesltfsDtrx ont0alt  feiat sDeaums t4 eenxf3io1lmDe nvs s  2umir iy4am  mnctatfaDrrxrpno0altnifeiysls2uan pn() rtoio3oydoat livo s)s2uoxmpiydamtelncsl(  Drau oou4oetoii3tadfsDraumpnu4 lenxocta1lmtran ils0texrim3nu4openlfesas)arua( p;t1optoioctadlaDrl(vs u)arermrcoydfa rlivi;()trtrxopoo4lle mfvtls)srraxm ;u4olx io3iysfa2um(msn(0 rtomo iodomteaueo (0 rxmir iu4optemneil(  rua( ont4tpeoifeiltfs2el( pnt0 leoirciydlmDe uvo t  etmir ny4ope lnvi s a2ur(m ;o1tpx  fetyt mDuau s () rtrxf oydlpD aues (  rtrxm iydom nmnci tfs2ur(r ;u1teenif3iat a2emnvs ()tlxnxrcoodfp r iesls) 2trxrpiy1llen ics t)sDrm( ont0texnifetls m rm(vs t0alermo3tatfa r nvo s  rur(m3no4amtnlieslt)a2trx pno0opeoif3tydlaDrmnvo;(0artnio oy1optr uvilt t2xmxo oy4lmt  ieia(fsrrmxr nt1oexoiietaslaDrlums;()aleoxf oatom raneolt0setrim iodolen nvt t) rra(  ot0tltnmiciasls2ua(mp;u4treoio3ty1lpt ln o;t0t2xmirpoydol emnct t) 2umu  nt4altoifetld aDemuvsn() rxnioctadfp  lnvs;s0s2tmxo io4lme mivtltfsruaumo;t0olx mfeiysfaDul(ms t4 etomr3iotfm r n i;s0t2tmxo oo1apt lnesls) rtmxrpou1tptomfciltfmDrm(mp t)teeoxo3iodoaD lieo;t) exrxo3oudlptnlfcsa(faDua(r nu0oexnifeiltfa2rl(mp u0 rermo3ia1fmte ues;t) rxm(m no1lptelnesls) rtm(r oo0olx ifeiltfm2elu s;t4aexomf3oodlp   nvi;(0seumio3nodape mfesltfs2rrx p;t4teto fctat m2eauvs;t4 rtrmrciytop e u i ( t2xr(mpoy4ll elfcia(f rrm(roou0tptoiietadfm2um(vp (4 lxnmrctatlpt aueil( teumim3iu1alt lfct () 2ta(rp;u4tpeomoetldla elnmpn()tleomr3tytomt  ieo t setrio iy4ap n nci ( aDta(rp;o4tptn ieilsfa2umnvp;u0alxomf iy1omDraneo;s)seur(o nu1oltelivt t) 2rrx  oo0alenifciat m2emn s u4 rerir iydlm raiei;()texrxrpnudop nmfvsltfaDrmumpoo4opx  octasla2rm(msn() rxrxr3oodoa r u i t0t2xo(o oy4olt  iesatfsruru p;o0aee  icild s2ulums u)tetrmf3oydlm  luei;s0srtrim iu1lmtnlnvsat sruaump;o4oee ifeildfs ul( o (0teerif3oo1oaD lues;t)s2xm(mpiodaltnmfct sfartru o;u0tpt  ieiatlmDra( ont4 ltnxf tatfat auvolt)t2xm(m3oudop e ivtls)artmu  oo1optoiiciatlm2rm(vs;(0alxrxr iytfa elivi t) 2um(opoy1aptnlncsa(fsDumxm ;t4aeeoifctldfaDea(vo () etrxociydomt aneils texoir nudlpe mnetas) 2uaum ;u4aleniietyd m2umu pnt0 eerircoadfp eln s;t0 rxoim iudop  liviatfa2trxr no1aetoifeiatfm rm(vo t)tleoiociydlatrau i;s0 rtoiopnudol  lnvi s  Drr(m ;o1tlt ifetad mDulnvo t0 rtrir3iytfa eauvs t)s2xm(o3iu4omeemneil( sDrr( poo0oee ifciyt m2em( s;t4texomo3iydomDelu i;(0 etmiopiydomt mfeia()aDurum ;o0tle mo3iatfm el( on() lxomo oatom   i o;t) 2xoio3oy1op e fvs t) Drmu  nt1apeomi3tlsfs2rau s;u)trxomr3oo1la   i ol(0srxrim3iydomte fvilsf Drmu ono1apxomf3iatfa rauvp;u4trtnmoctadoateaueo t  rumim oy1lleemncs sf 2tmu oot4optnmoeiatls ua( s;(4 renxr iy1op  lnvo (0sruoir oodaptnlicia( srtmu pou4altniiciltfmDrl(msnu) eenmf ta1op e nvs;()t2ur(mpnu4omtelnei t)s2ur(r oo4ape  ieiasfs2emums t)artoxo oo1lmtelu i;( texmxm iudaleelieiat srrm(r nt0texnmociat sDem(ms u) lenxf iy1fatrlieo s) exrim iy1lp   fvtat)s2urxmoou0tlto i3iatls el(mon(4aexrifctadfmtr n i;t0s2xm(opoudamt mneil() Durxrp;t1apen icils aDulu pnt0 rtrxo3iatfa eauvi;(0srxoxm3ny1al  mfesls)s2tr(mont0texnmoetadfa um(vo ()arerif3iatlaDe nvolt trxr(m3nu4ale  ieil(f rtm(mpnu4tle mictatfa rmnmpn()aexoxocoo1lmt  ivs ()t2um(m3ou1al emieils) Dum(rpou4oetoio3tyslmDumu p ()arxrxo3oadfmt au ol(  2xmimpiodaptelncsa()a2tru  nu1opx mo3ildls eauvo u4texrmf3ia1oate nvi t)trur(m nu1lle licsa( s2raxrono4opxniociydlsDrmn s t0teeoxo tydlatr ieo s sruoir oo1aleemncsa()artmxmpot4oexoiociasls eanmo t4tleoioctytfm eai ilt0srxrxo3oydolee icias  Dum(mo;u4olxn f3tas s umnmont4trxrio ty1lmt auvs s0sruoxr3oudlltn iei s)aDuaumo;o4apxo oeiadlsDul(vs;(0 lenmr3tytlmD  uei;(0 exoxm oudalte fcs tfs2rau pno1tetn octltfaDemnvpnu)trenmo3to1fa eauvi;t)trxrim3ny4om emfetat)s2tr(  ou0altoiociadfs2eaumonu4 rtrir oy1oateluvi;s)tetoxr iodamtelfctas sDumu  ;u4oleniocild a2ra(von() rxnir tydoat luei;t0 rtoio3ny4ll  mnvt t)arra(moou0opxnmf3taslaDrmuvp;u0tltomf to1lp e n s;(0teuoxr3oudamt mieias sruaxrpou4aex ifeiysfa em(mp;u)aexnxf oodopD aieils s2tm(m oydaltn nvsa()srur(mpnt1tlx micils mDeanvo;u0arerxf3tadlm raieo () rxr(m3oudlp nmfcta()sruaurpot1apen feiytls2uau o;t4alxomo tatfat auvi s)trxmirpny4olt lfci t)srtmu  nt1aeeoifeias sDua(mp;u) renmr3tadoa elu i t0t2uoxopiydomenmicsl( arrrxr nt4altomfeilslaDrmnmp;(4 exnmfciytlpt  ivs;()tetr(m iydomtn icias srra(mo;u0aexoifciltfm2ea(ms t0 renir3ia1omDelueo (  2xoir3nu4ol emncsas arur(  ot1tex  f3iad mDemnmpnt4artrmrciydop e i o t) exrir3oodoltn fviat)srrru o;u0altoio3iatlsDrmumo u4 rtnxr oatlat  u o (  rxrio3nodapt livtls)sDrmumont4ope moetlslsDra(ms;t)tlerif3iytfpDeaues;s srurxr3nodamee ivs t)a2um( p;t4apt mfcilsfmDrl(ms t)altoxr3oa1opt lu slt  rurir iodll e nvs ()sDuru  ou1apxnmo3tls m2uanvs;u0altrmrcoytomtr ueo t0trumxr iy4amtn iesls)srtmx ooo1aptnmicils a2ua( o t4texnxf todlm   ieil()trxo(mpoo1olt lncil()srtmu ono1tpxomictas s2eaums;() exnir to1lmDeli s t0 rxrxrpno4apt mfvtat aDtmumpot1alxn feils a2ua(mp;u)teenxf3oatlptraieol( s2xr(mpiu1om n ics (  2tau oou1tee mietat m rau o u4artrmociytfatr n o;s) 2xoxo3io1lle  ncil(fa2tm(mo;o0alxnio3ild m um(mo t0 etoif oadfmteli s ()t2uoxopny4omtn ivtasf 2ur( o;u0ale  f3tltlmDelnmo (0aeenmfctadla e nei s0teumir3nydlle mfvsl( arrax  ;o1tle moeiysfmDulnmp u)altrirciydfptrlivs;s0t2toir nudomenmnciat)sDtrumoou4oltnmietlsfs2emnvo;t4trxnxf3ia1oaD lueo s0tetrxo3oodopeelfct sfarta(  oo1tle  oeilt m2ua(mp;u)trxomf iydop  lues s t2uoxr3oo1altn nct sf rtm(m oo4aleo f3iltfaDuau p (4 rxrmo3tydfatean sls0trumim io4ole livsls) Dua( p;o4oexoif3iadfmDumn o t0 lxrifcta1omt lieols)srxm(o3no4optelfcsl(  2rm(r ;t4alen fetaslmDea(ms ()trxrir totoatraieols0t2urxr nodoptemneias)a2taxm ;t0oeeomieiadlaDem(mpn()arxrmo totop e neolt) 2trirpnu4lle  nviatfa2rmum ;u1tpxnmfctad m2rmn pnt)trerxr ootlatelies t texmxm3no4lme lnes ( sDua( o;t1alt mf3iydla rm(ms;() lxrmo to1laDe iei;s0 2tmir oudaltn neslsfa2uru  nt1alx iietytfs ra(vp;t) exrxf3totom e u i;s0trumxo nydlmenlfvsls a2rmx ont0ope  fciydfa el(mo t) exomo oy1lmt an s;t  rtm(opiy1lp   nvtas)arraxm no1tex io3tls aDra( snu) etomf tydfmD luvsls)srxo(o3nu4oleemfcils) rumxm oo4tet ioeias aDran o t0tetrir totlpt  ues (0 2tmxo3iydoptelfctlsfarum(  nt4oexn ieildfa2uaumpnt4teermo tadlpDeanei () 2triopoodlltn nvs () 2urxr ;o0alen f3ias a2uau p;t0aexoio iodfaDeln i ()srtr(o3oudoltnlivsl(fa2tmxmpnt0opx  fetld mDuauvo (0 reomo3tytoa eanes;s)seuoxr3ny4alenlnct ( sDtaxmoou1aex ifcilt sDemnvs;u0 ltoircoodoaDraieo;(0 2trimpoodomenmfvsatf Dua(r nu1tle  oeiys aDuanmpnt0alermociytopD lu o s0sruoir3ou1omt  fet t s2uru p;t1tlenifciydfs2emnvsnt)tltrmr todoptraivo;s0trur(o oo1apee ivi tfa2tax  ot4opeo iciadfs um(vs u0tetnmf oodlate i i;()s2toiopoy1om n ncsas aDtr( ooo4opxnmfciltfaDrlnvo u)aeenmr3ta1lp eai s t0 exmir iu4lpee fci sf 2raumpnu4oeenmoeild sDrlu o u)tlxrmf iydla e nesl() etrio3io4alenlictl(fartrurooo4tpenif3iltfs eanmonu0tltnxf3iotlpDelieol(0sexr(o ou1al   fetls)aDumu  nu1aet micias a rmu p (4aleoio ta1lm ran i;()t2trirpoy1om elnci sf Dtaum ;o1tpe  f3iyslm2el( on(0 eeoif3iydfpD aivsls tetm(m ny4lpt  fctat srra(m nt1apen ociysfs rlumo (4tlxoxo3iatoptr uvs;s  rtoxo iu1ll e ivs s aDua(  ot4tlxomi3tydlmDrl(vo;(0 renxo3oo1fa elueils0srxrir iy4aptelncilt)arurxmp;o4opeoiictls s umn p;u4tlxrio3oy1laD  nvs;t) 2ur(r ou4aptelfciltfsrraum no0alt io3tas m2eau p;u0 rerio oa1lmD  nes;t)trto(r3io4am   fctas)s2ur(rp;o1opxniietld m ulumo u4aetnir3tadfateau s;()t2toxo3oy4llte ivil(fsDrm(moou4apeo i3iltlaDeanmsn(0 eermf3tatoaD an ols)t2xrxr3iodam  lici s) rua(m nt0tetn feiltfs ea( o;u0 rxrif ty1fpDr i s;(0trxrxr3ny4oltelictatfarrrxr oo1aptnmiciadla2eanvs u0arermf iadfpD  uvi;( s2tmxo nodopt mfeiatfsDrm(mpot0tet mfetat a2emnvp;u4texnmf3todfmD anes t  2xr(r3oo4opt liesa(fsDurxmoot1tltnif3tlsfs eanmsn(4altomocoydlp  an o;s  eumirpno4lle  ivias)sDumx  ou1tpxoif3tyt a2rlumsnu4treoio3ta1omtr uvs;s  eum(opoo1amtnlfviltfsrtmx pnu4olt moctadla2rlnmp;t)arxniocoo1om eauesls  eum(o3oo4apt lfcia()srtax pno4tpe ioetltls2rauvont)texnmr iadlaDrln olt0t2uoio3oo1omt mictlsfa2rm(r nt1aptnif3tydfs umuvo () reoxf3tatomte uvo ()t2umio oodolenlncs ( sDuau poo0tpt io3iltfmDul(vo t4texrir oydfmte neols trxoxrpny1om  mfvsatfsrur(m ;o1apeoifciasla2rmumo ()trtrxr3oy1opDr u slt0 euoxopoy1ol   icia(  Dtrumono1aee if3tldfs2umnvp;t)tltomrcta1op  li i s)s2tmxm3oo4al  livtl(f 2rr(  ou1tpx io3iys m2eau o;(0areoxrciatfm  lieo (  exo(o3oy4op  livt t sDrau p;t0opxn ictld aDulumsnt4 leriocoadlmDrluvs;t)trxoxr3io4lpt mncsa(f rtmu oou1oetn ieiysls umnms u)trxoifctotlmtr n slt)seumir3iy4apt  neiat a2rm(mp;t0tltomo3tlsfaDul( pn()tltoxfcoodla elueols  rxo(m3iudlleelict (fsDra(m oo4tpxn o3tlsls2eauvonu)aexomr iadomtr nes ()sexmiopiudal e nvt () Dtaxmoou1oexoiictlsls rl( s u0treomociy1lp ran s t0sexmirpoydap  mivtl() rum(m ot1oeeoioetad aDumnvo u4 rtrxo oa1fptelivs;t0 2xr(m3iy1apenlieia(f rtr( p;u4apx ifeiaslaDranmo u) eerxrctodfmt aies;t)seumxo iu1lltnlfes ( s2tr(rpoo4oexn ieiaslaDrmu p t0aleomo3ta1fa elu o;s) 2tmxrpio1lmeelnvs sfaDrrumono4tlen iciatfs um(mp u)tetrxfcoytomt anes;s)tetrim io4lmtnlfet s)srrmu  nu0altomieiaslm2uau s;t) reoxr iodlat auvi;() euo(o iu1alte nei (fs2ua(r ou0texoiociytfs rm( p;(4 rxrmr ty1om elivilt)s2xoir3oo1omt  ivil(  Drr(rp;o1olx iietydlm2ul( s;t4alxnxrcoo1fa rlneo;t) exrxr3nu4ale lfvslt sDurxmp;t0apx mfciysla ua(vs;u4areoif oatfmD ai i ()sexmir iy1omt lnvt tfsDrmum no0teeomi3iytla2ul(mont)tlenmf tydlptr nvsl(  2to(o3ou4am   fvilsfsDrr(m ou1alenmfciltfm2uanvont0 exrirctydoaDelies t  eto(opoydap   icslt  rur(rp;t1alenioetydfs2rm( snt) lxrmf3iy1op ran sls srum(m oy1amenmnct s)arumxrpno0opx moetysls2emnmo;u4teermocoydfat luei s0trurir iy1llenlivs (f rraxroot4opxo fciltlmDumnvsnu4 ltrmf3oa1omDr i o t  rxmxmpiodomtelncsl(faDta(mpoo4optnioctas m em( on()texomf iytla r nvol()t2xo(o iy1lm e ivt tfa2uaxr oo4altoif3taslaDrmuvo;u0aexrmf3iydopte nvils0t2xrim3oy4aptemictltf Dumx  ;o1opxo fctydlmDul( snt0 lxnmf3oy1fa rlivsls)s2tr(r oodalteliet (  Drm(mpoo1aexn f3iad aDeanmo u0aetomf3tytlaDelu ol(0t2uoxo iu1ol  mivsatfsDtaum nu1olx  oeiat m ulu on() rxoifciytoa rln slt)srxm(rpny4lleemictat)sDrruront1oltoioeiytfm2rau s;u)artrio oydfmDe ueils)trxrxmpoy4al nlics s)a2rr(  ou1apto f3tlsfm rl(vo t0 lerio tytlpt anvi s texmir3iu1ol   ncsa()sDrrur ou4tlto icilslm2ea(mont4 exnmfcoatfp   u s s) 2urxr nodoptn icsa() rtr(r ot0tltnmieilsla2ranvp;(0alxrxrciytoa  an i t0 rxr(r oydlp n nvtat srrr(rp;o0oltnmfeilsls ul(vs;u4aleoxf3tadlpDr ueslt  eurxopou4amenmfvt sf 2tm( oot0aptnmociydfmDum(msnu0aeerxo3iydom   neols0t2xo(rpiy1lpt lfesls)sDum( ooo4alxniieiydfsDum( s;t4teerxfctadlpt  ieo () etoxr3nudom  mnvsas  Dur(m nu4olto feiadfs2rm(ms;u4areoxf oo1opD  u o;t) 2um(o iu1lltemivt sfsrua(r ;o1tleomf3tadfm umnms u)tltomrctodoat  iesls) eur(o oo1llen fesat)s2rr(m oo4optomi3ias s2rl(msnu)aetnio ty1omtr ieslt teumio iy1op nmici (fa2tr( pno1oetnmfeiyslm2el(vp t4tleoif3totlp  liei ()srxoio nu1altn fvsltfa2tau o;o4tlenifciasfsDumnmsnu0 eeoxrciatlm r uvs ()sexoio oo4ome lnvs (fartm(  ou1alen o3ilsls rlnvp t4alermocoa1oat lnvol(  2toiopoy4ol n fesa( s2trx oou1texnmieils sDrauvo;t0altrxf oa1omD an sls0 2ur(r nodomenlicsl( a2rm( o;o0altoiietadfs2uau o t4aexoxf iodop raivsl() rtmiopnodap  mict t)aDurxmpoo0apxnioeild mDeanvo;t) rxnifcoodomDrlieslt seuoim nodol elfeiltf 2rmu onu1tpxnif3tadlsDrluvs u4 renxocty1fpteauvo ( t2uo(rpnudale lfvsatfaDraumo;o4apeomiciydlmDelnms;u0arenirctatlp ean o t0t2xrxopnu4amenlnct (f 2taur ot0aleoioeildlmDea(von(4trtrmf3tytopt lu olt)texo(r nudopte feils) rtau  oo1oexn f3ilslmDum( pnu4aexnir3iodfmD lueo s)s2xo(m3oy1lle mnet s) 2urxmp;o0altoifetldlm2raumsn(4tlxrmf3oodfpD  ieo s t2trxm iu4op  mictas)aDrm(rpno0ape ifcilsfm2rlnvs ()tltnxociy1fmDeli i s)trtoxo3ou4amtemfet (  rtru  ou4ape mi3iaslmDelnvon(0texrxf ta1lpD luei;s0 rxriopno1ope mivsas  Dtaxro;t4aetomf3ilt aDua( s;t)texoir3oytla   uvo (0 2xmxo3ou1olen ietlsf 2rau ooo4teeniieilslm umnmpnu4tltrif tydfm   u i s0srxm(o3nu1lmt lnvil()sDtmur ;t1apt if3ilt mDem(vsnu) exrxrciadoptr ies s)s2urxm3oo1ll   ncsasf 2rau pot0tltnmi3ildls ulumo ()arxnmrcoa1oaD anvi;t  2trxr nydllt livias artrumooo0aee  feilslm emums t)treoxf oydomD ai s;t  2trxo nydapt mnei t sruru poo4oleoioctydlm uanvo;(0arerxo3oodom  an o s)srtmiopno1am   nesl( sDuaumpoo4ole if3tltfsDrl(vp;(0 lxnmfciadfpDr nvs;t texrimpny4lpt  nvi () Duaxmp;o0tet ioetysfs2rauvs ()artnmocoadlmte ueol(0 2tr(o nodll e ivilt)aDrmurp;o1oltoio3tysls ranvo;t0aexrmr oy1oatr uei t)srxo(mpoo4llte nei tfarrrum ;o1alx moctat m emn s;(0artoxr3to1fp   n sl()setmxm oudlm nmnei sfaDrau ooo0tex mocildfs2emn onu0artnmf iytfmDelueo;(  rxmxrpny1lptnlnvsltfaDta(rpnt4tpxo o3iydlmDea( s u4tltrirctydlmDeauesls0seuoimpoy4omtnlncsl(fsrurumonu1aexo fciltlm el(mo;u0altomrciodla   i s (0seto(o3ny4op   nesat) Drmx p;u4tlenifcild s2ulnmpn() lxrxf3iydfm  luvs s s2xoxm oy1ame mfvi tf 2uauronu0aptniociydfaDrlnvs u)tlxrxr3iatomDr nvo s)trtm(o3iu4oltnlnesltf Drmxrp;o4aptoii3iydla2em(ms u0trtomr3oodlm  anesl()srtm(o3iy1op elivi s) 2tm(r ot4tpen feilsfa2eaumon() lxomociytopDrliei (0trurim3nodope livtat srrm(  ot4aetnmfetldfsDulu s t0trenif ty1oaDr n s;(0teuo(opou1llte nvsl(fsDum( pnu0oeeo fetas a ulnvo;(4teenio iydlmDelues;s teto(o ou1alee ivsltfartr(  ;o4alxo octys s ran pnt4 exrmf3iodlp r i i ()trxo(o no4ap nlfcslsf 2ta(m oo0ole iietys m rm(vp;u4trtnmf3ta1lpt livo;s0trtoio3nydlleelnvt t s2rrxmp;u1oeenmieildla emn s (0texnmf3oa1fpD  uvols)sexm(o iu4ole mfet tf 2rrxmo;u1aexo ietysfm uln o t0aexoirctytoptelnvo;s0srur(o ou4omtemieilsf Drrur oo1oetnioeiytls ranmonu0tleomo tytoptr i i t0 2uo(m3nydap e fvilsfartaurpoo0olxn oeiydls2umumsnt)texrioctotfp e nvi s seum(o iy4amte netat artaump;o1tleoioetls sDumn p;u0 rerifctodop e i o ()t2xm(mpnydolenlnvia()a2rmu o;u1tee  icildfm2um(vp ()arxoio3todfpD  nvsls0 2xmio3oodoltn fci t)a2um(m ;t4tetomfctaslm2uanmp;t) rxnxo ia1lmt anvo;s0 eto(opno4apte icta() rumxmp;u0oeto oeilslm rmuvp t)tlenmo to1oaD au o;s)teurirpoo1omeemnvil()srrr(mono1tpxoioctltfs umuvonu) ltnmociatlaDrlivs t  2urxr3iudlm nlfcslt sDta(moou4olt if3ilt s2umump (4 lxrircio1omteanes s  rum(m oy1ale  fvt (  rtr(  ot4teenio3tatla2umnmo;u)artoifctodoat auei;()sexrxmpoo1al   fcs t) 2tmu onu0opxo ocildlm emu snu0aeenioctodlaDeln s;(  eum(o nodlm nlnetl(  Dtmu  oo0tlx mf3tyt mDrm(mp t)alxnxrcia1opDrli i (  2trirpoy4aptemicsl()arraum ;t4tlenifetyt sDum(mpnu0teenir3oatfpteaieol(  rxrio oy1op  lfeia(  Drm(mp;u1oexnioctad a em( pn(0 etoiocoatla r n ols  exoxm iy1lleelivsas sDra(mp;o0alx  ietas s2rauvo t4texnir oy1lmD  n o;t) euoio3oodameelivtasfsDtr( pnt1alxo ocilsfmDran pn(0tlermrciotoa  an i t trxmir3iydolee fci ()s2tmx  no0ape mieilsls rm( pn()tlermo ta1oaD  i olt) 2ur(m oudom nmnct ( s2ua(r nu1alenmictldfa umnvsn()tlxrifcoodoa  aiei;( texrxmpoo1lm   net (fsDrmur nu1altnmfciatfa2uln s t)artrmf3tatfateaivilt)trxr(r3oy1am  mfeia(  Drrxmont4tpxnmo3iltls ua(vsnt)alxnir oytlaDelieilt)t2trir oy1omeemneilt  Dra( ono1tle if3ias a umnvpnt4texoxfctodoaDelu o;s0t2ur(r oy1ol  lnei (f rtax  ;t1texnmf3tlt m2rmumpn(0tltnmf iodlmDelnvs s0 rtr(m oo1aptnmfei tfaDrmurpou4apt mi3ils mDrlnvp;(0trermf oadlmD ai i;()tetmxo3ny4ol  mfeiat sDtmu  oo1apeniicilslsDra(vo;() lenmf iodlm raivsls)s2tmir3iy4amt miet s) Drrxmpot1oexnmietydfs2rl(mp;t0 ltrxo ootomDe ivs;s0 exrxrpno4ameelfvt () Duau o;o0opxoiicild mDran pnu4 eeoxf3oytfaD auvo;s)t2to(m io4amenmnetasfsDumxmont1tpe mi3iysls2rl(vs;t)tlenmo ootoa e u o s t2toim3ny1lpenmietlt arurur ;t0oet mi3iltfs2rmu o (0artnir3ty1fat aivi (0srtr(m nodolt mfvil(f Durxmo;t1tle mi3tlsfm ean p u0altomrcoa1lpD  ivi (0sexrxo3oodlpee icsls srrmxr ;u0oetn oetldfm ra( o t)artrxf oatfpt lieo t texmiopno4amte nctat aDtmur nt1ole iictyt m el( pnu4alxnxrcoytoptrauvslt  rtoir ou1aptnmfvt sf rrm(ro;t0teeomf3iydfsDea(vsnu) rxnxf oodoa ranvols)seuo(opoydome lfvtltfarrrxroot4aet  i3tydfsDeaumpn(0 renio todop   nvo t0seumxrpiy1ole  nctat artrxmpou1alto octat mDeln o;(4aleoxr ty1faD  uvi s t2uoir3nu4oltelfvtasfartaump;o4oeeoif3iasla rauvo;()altnmf oadomt aueil( s2uoxo iu4olt mict sfaDta(mono0oleo i3tasfsDelnmonu4altrxrcio1fp  ai s s0t2umim oudlp emncia( s2tmurpoo1aptn ieiyd mDeauvont) lxrxo3ty1opDrlnvi;s0t2trxr iu4op nlicta(fsrrmur ot4apen octysfmDra(ms;(4 rxrxo3oo1omDeln o;t)s2xoxr3nu1apen nct t  2tmx o;u1aexoifetyd a rmn o;(4arxoifciatfp rai i s sexm(r3nydopenmfvslt)a2ta( onu4optoioeiaslmDemnmo;t)alerio iodfmteluei;t s2xrirpoo1ame mici s a2rrum ou1tlen oeilt a2um(mo u0altnio iytopD luvilt trxrimpio1lpeemnctlt) 2rm(rono4aptnifciyt mDrlnmont0altoir3ty1lp  luei s t2trirpny1lp e nesas) rtau o;t0aleomo3iydlsDua(vs;t0tltrxf3oytfat anvsl() 2tmimpnudlpeemiesltfa2tm( onu0tpxnifciydfa2rlumo u0 etomr3iy1lm   n i;(0t2xr(r ny4ol e nvias artmxr ou4aetnmoeiatls ranvo (4 etrifctotom r ues;t srxoxopnudllt licia(fsrrmxrpoo1oeenmiciat a rlumont0arerircoa1oatelnvs;t) exr(o iu1amenmnesltfs2rmur oo0ope io3iadfaDrmnvo;t4trxrxrcia1fpt li slt srto(opiudlme mics t)s2umur ;u0olxomo3tlslm rln snt)tleoxo to1opt lnvo;s  euoim3io4lpen neiasfsDrau o;t1oee iietas s2rau on(0artrmfcoy1omtr u s (0trtm(r io4apen nesatfs2rmxmo;u1tpto fctaslaDuauvsn(0trxnxf iadomDrlnvs t)t2xoim3iudape  ivi t  Dua(rooo4apxn ictyt a2emu p t)trtrio oadfpDeaneils0 2tr(r3no4lp  lics s artr( oot4opxnif3ilsls rlnvon(0artoxr3iytfa rlnes;s teur(r3nodol nlncsa()srumx pnt0aptoif3iytlm uau sn()texrmo3ta1opt  i o (0trtrir3nudaptnmivi t  Dtmxro;t1tlt miciltlsDuan s;()trerir iatop e i olt0 2to(o3ny1ol n fcsls)aDua(m no0apxn ietad m2emnvs;t) lerxfciydfmDrauei;()srum(r iy4lmtnlict t)a2uru o;o1olxnif3iydfs rluvp t4 rtrxf oatfm eluvsls)seur(r3nydamte fetlsf ruaxm ;t0tetnmiciat m2emnvo t)tlxnio3tytla r n o t)setoirpoo1omeelnvsa(  2rr(r ;u1altniiciyt a2emn onu4altnif3tadlat anesl()t2to(o3nodoptelict sf rra(r nt1olen o3iadfmDean p u0trtnmfcoytlat  ueols t2xoxr3io4lpeelictl(fsDtm(r nu0aleniocilsfm ul(vpnt4alermo3iytfp rai sls teur(o3iu1lme lietas  2umxm ou1tle mo3ildls2elump (4arenio todlp  livo (  exrxm3oy4lpe lnctlt aDtmxronu1tpenifetldfm2ulumpnu)arxomr oa1opDr n o;s trum(r oodlptelnctat)a2ta(  no1olxo i3iysfmDelums (0 ltnxr oytla rau sls0truoxo3nydol nmivi sf 2ua(  ot1alt iieias a ul( o;u) eermociytfpDe ueo s s2xmir3ny4optnmnvtls) Drrxmo;u4aetn ociadlm2rmnmsnt0texoxr3iy1lptr i i;(0sruo(o3io1lpenmnes tfaDumuro;t1tleo icildla emump;u0 rtnxrciadlmD  n s;t0 2umir3io4am   fvi (fa2rax pnu0aeeo iciydfa2um(mp;u) exrxrciodoa  lnei (0tetrim io1lpeelfcsls srtaurp;t1altn f3tysla2ranms u0alxrif3ootlmDr i s;() euriopnodlmte iei (f Draxmono4texoio3tytfm2ranmpnt0teeoifctadlp r ies (0 etrir3iy4oleelfcsls)aDumx  ;o1aleo ocildls rauvsnt) exrmf oydop r uvi;( s2uoimpoy1lmeelnvt ( s2taxm ou0olt  fciadfs eln onu)aexoir oa1om   ieols0t2xrim iy1lle livtasfsDumu p;u4alt mf3iadfs rluvp;(4tltoircty1omDelieo t0 rurxmpoodalt  nesat)arrrxmonu4alxnii3tatfaDumnvsnu) reoxf3tydlpDeln sls t2ur(r nudlptnmfviat s2raxrp;t4tlt  f3iaslaDrm( o u0altnircto1fpDr nei (0 2toxo3io4amtnmivsas)aDurxm ;o0apeomociydlmDuluvp;(4tetnmo3iatomDr neil(0sexoxo3nydamtnmiesas sDum(  nu1oeenmf3iltfm2em(vont) rerio3oo1fmDrauei (0 rtrxm3iy1alt mfei s) Dra(mp;o0alxnmfetat s eluvs;u0tlerio3iydlm e neilt  2xoxm iu1ol   netlt)aDururoot4oeenifctysfa um(vs;(4 renir3iodlatrauei;t trtmio3ny1op nmnvsltfaDuax oou4alxoiieiydlm2rauvs;u)aexnmrcoa1lmD livolt)trurim iu4ome lfvilsfsrurxm ;u1aex mietat s ulu
\ No newline at end of file
@@ -0,0 +1 @@
+u i () exoxopoy4apeelnesls arraumono1ape mi3iydlaDranmsn()tleoirctadlaDraivo;t)srur(r iu1lpe  nei sf 2tmu o;o1alxomf3ildls2el(mo t)tlermo totlpD  ies;t0s2xmxr3ou4ameelfvs tfs2rmum no4oee mi3iaslaDrmumpnu4trerxrcoadfat lieils0 rxo(rpno4alte fvsl()aDtax p;o0tee mo3iytls2ua(mp;t4arerio3iy1op e n sls)s2tr(opoodlme  nci ( sDrrx pnu4tpe  iciatls2umnmo u4teenio3oytfa raiei;t0 2umxr io4al  mfvtas)a2trxrono4tleomictldlm2eauvo;u4aetnio tytopt aiei;()srtr(opio1altemicil(farrrumpnt1oeenmoeiadla ua(von(4 lxrmociotfmt an i ()sexmir io1openlnvia() 2tr(m ;u1optnmoeiasla2rm( s u)trermrctydfaDrln sls)srurimpoudop e neta( aDtaxm oo1teto o3tytla umuvp;(4 eenmr to1fa e ieilt)t2to(mpoydaltnlnci t sDra( oou4oet  f3tatfm el( s;t0 etnmf3tatlat luei;()srtoim nudameelfeiat)arrmxr nu0tlen ocils m rmumo;(0aeerxr3ootomD lneo t0truo(o3oo1opt lfvsat aDur(root1olt mfetlt a2ul(mo;() reoifcoatom e ieols0seumxm3iu4am eliei (fa2truronu0aex  octysla ulnvpnt)aetnxf3oydfmt aivs;t0 euoxr io4llt lnei tf Dta(ro;t4apenmictad s2ua( p (4texomo oadlmtranvilt0trtrxr io4lp  mnctl(fa2rr(  no1oee ioetytlsDumnvo;() ltrxr3ia1fa eln slt  rtrxm nudaptnlieslt  2rmx  ;u4tlx mictadfsDumu o t)aeeoxrcta1opDean i t)trurio3iy1alt lieil( s2tm(r no0oetn iciyslsDumn p u0 lerxrcoatop eaivs;()srxmir3iodllen feil(fs2uaurpot1tlxn i3ils m2ulu s;t4trxrxfcty1fp eau ils trxoio3nudolee ivia(f 2ua(moot4opt  f3tadls ulumpn(4aeenio3ty1oateau olt)texrxr3iu4op  lnetl(  Draumonu1tpxo ictysls2ulnvsnt0 rxomocta1fmDr n s s  rxoxr ny1optn net tfsrrrur oo0apx io3iadfmDrmnvp u)aexomfcoy1optr nvo s0 2tmim ny1am  mfvt t a2ra(ro;o4tetn fetls s2um(vo;(4texnircoytlat  ivol()s2xo(r3oudopenlivs t) rua( pnu1oeto f3tyt s ulu sn() lxoirctodfat  uei;t teuoio3io4lle  fvslt)aDumx oot4tee iiciaslaDua( pnt4trtnif3oadfaDrlu il( sexr(m3oo1openmieslt  Dtmx oot0altoio3ilt a uau p;()arenxo tydfa  li s s)t2tmxr io1opee fcilt) rtrur oo1oetoiictltfsDuanvp (4trenmf3tadlptrlivs s0tetm(r3nu4al  lnetlsfsrrrxronu0ape mfciytls rln pnt) ltrmfcoa1laDelivslt)truriopoy4aptn fct (f rtaxrpno4olenioetlsfs2em(vonu0areoifciytopDrlu o (0srxmio ny4amt lnei ( srrmu  ;t0aex  iciatfsDuauvp;u4tltnxrctodlaDelivols  2tmxm3ou1omtelicslsf Dtaxm ;o0apx  feiys a2umuvo (4tlxrifciytfm r nei;s seur(rpnu1lptelfei (  Dur(  nu4aeen f3tat a rm(vp () rxnxo oa1fpteluvi (0 rxoim3oo1am emietatf rtaum ot1aexnio3ilsfs ra(msn() eeomrciydfpDe uei t srxmxo3nu1omte nci t  2umu poo0openifciys sDrmu sn(0texomrcootoaD  u olt0s2umirpiudlpe lnet tf 2umxr ;u0opx iiciydla ulump;t4 rxrir3oa1oat li s s0t2xmxr3iy1am   fvsatfsrtaump;u4ope io3tlsfaDelnmp;t0 renmociadlate nvolt0 2xmim3io1opt  nvsa( s2tm(ro;u0aetn icild s emnvon(4tlxnif oy1lpDr i s;(0 etoir ou1optelivt ( aDrauronu4opx moeiat mDemu snu)tlxomfctotop raiei s)setmxr3iu4omeemfct s srur(  ;u1opxoioctasfs uln o;t0 etrifciy1fpDrlies;t tetm(r3nydap  mfesa()s2trur ;u4aee ifcilslsDrmnvo ()trtnmociy1lpt aues s)sexoxr3iodome lncsat)sDra(  oo1olxniociadlmDumuvp (4tltoxr3io1fateln i;( s2trimpoo1al emfctl()aDtax o;o0aptnioctytfm2em(vp;t)altrif ta1lm r uvslt)s2tr(m3io4omt livslt)sDurx o;o1tlx miciatfmDuau pnt) etoxfciatfp   ivsls  2uoxr no1openlnet ( aDtax p;o0alxn i3tytfsDelu p t0 exriocootlmt an s;t0t2xmxr ny4lme licia(fsDtmxr ou4altn ociltfaDeanvpnu) exrmo ta1latr ies;s) exmxmpoo1am   fes t) rta(rpno0alt mociadlsDel( pn(4tlxnif oy1lmtraiei s0tetriopoo1ale mnvsasfartrumoot4oetnii3iaslm ulnvp;(4altoio iy1la eaueo ( srxriopio4aleelnvil(f 2raxr nt4aee mieiat m umums;(4 ltoifctytop rlu s s0truoirpou1ol  miet tfarurx  ;o4apt ioeildls eanvp;t)altrxf3io1fm eaies s  eur(opny1llenmfct sf 2rrxmpoo0opxnmi3tytfmDum(mo u)arxrif3ty1omDr ivs (  2xr(m3oudapte ncilt sDtm(root0tlxnmoeildlsDrlnmo;(0trxnif3tydomt  ivo t teurim3nu4al  lnvsat) ruau oot1ole  oetyd m2uln snt4 ltrio3ia1fpDrli sl()t2xr(mpou1oltn ieils  2raur nu1oeeomoeilslm2eaumsnu) rermrciydfm eai sls  rtoio3nydllt  nct (f 2umumpno4tetomi3ilt mDrmn s (4aexrxoctadfp r n i;( seuoxm ny1llt lnciltfa2rm(m nt4opt  fetyslsDum( sn() exrxrcto1omDrlnvilt  rtmxo iodole mivtat  Dumx p;u1alxnmo3iys a rm(vs (4altrxocoadoa rlnvi;()s2umxo3no1am emnvtltf Dumx p;u4aeto f3iys sDeanmsnu4 rxoircta1oa eln i s) exoxr oo1altn netlsfsrumu ono1aleoii3iasfaDelumsnu)altoif3iodlp rai o s0seuo(o iydoptelicil( a2rax p;o0opeoif3tltfmDran s t0alxrmf3oa1latrauvols) 2xriopiu4amen nvsat)srrrxmo;o1oleoif3iadlmDuau pnt)tltrxf iodfa  li s t) 2tr(r3iu4op  mfetls)sDta(  ;u0aexn i3tasla2eluvp (0 renifcoodfmt li o;(0t2uoiopio1lpe mivsa() rum(r oo0olxoiiciasfmDelums t0 eerirciodlatranvi t)texm(rpiy1lltn fes t)aDtmu ono4aexnmf3iasfsDrmn pn() leoircoodfmt liei;( s2tmim3ny4ome mieia(f 2trur ot0teeomi3tytlm2rm(monu0artriocoydom  li s;s0tetoxrpiu4op  mfvt t) rraxmonu4aptomo3tldls uluvs t)trtrmr3io1oaDelu s;() rxoxo ou4ape  nvt sfa2tax pou4opxo fciadfa2rlu o t0texrxo3oodomDe u o;s)setr(m nudal e ieils  rrmxmpot1texoifciat aDrmump;u0 leniocto1fpD  i i t0texoim3oydlmt mfctlt  2rmur nt4olenif3ilsfm2elnmo;u)trxoxf to1la eaivo t s2trir nu4llenlfvtl()a2urur nt0olto octld sDrlu pnu0altoio iatfat ln il(0tetmim3io1omtnlfctlsf 2uau  ;o1tle mf3ils m emumo;(0tetoxocoodla eln i;(0s2xr(mpoy1om  mietl()sDtmxm ou0tpe ii3tad a em(mpn() etoxf3oadfaD  n ils)trto(m no1ll   nvtasfarra( p;t1teto oeiasfsDemu o;t0tlxnmo iodom eln s (0seum(r3iu4om nmivs ( aDtmxr no4oeeomfeiltlm el(vs;t0altrif3ty1op e nvs s) etr(r iu4olenlfcslsfsrrm(monu0aptn fetatla ean s;u4artoifctydlp   neo t  etm(opou4apenmivs t srtm(rpnu4aexo oeildla2um(mo;t0 lenir iydlaDe uesl(0 2urxr oodaptnmnetltfsrtmxmo;u1tlxoifciyd a rm(mo;t0 ltrmr3oo1lpt an s;()seum(m3ny1amte iesl(f Dur(mo;t4apen octyt sDeanvpnu)trenxo3iotlaDrau ols s2xrim3ou4lm  lieils  rtr( o;u0oetomf3ilslaDum(vpn() etnmf ta1om   n o (  2trxm iydoptnmieiat aDraur ;t4tet mi3tydfmDuluvon(4tltnxr oo1fmDeaies;s0truo(m no4lptelfcta( arurxm nu0olx mi3tltls2ulumsnt0aetnio3oy1omD  nvi t0setmxm3iodlp  mici t)arrm(mp;o1tet mietatls2uanvsn() exrmfcoatlatranei;s srto(m io4apeemncsas)aDtmxmpnt1opeomi3ilslmDum(vo (0alxomf ia1fmDraneil(0trtrio iydllen ieia( srtmurpnu4oeeoiictyt s rmuvpn(4 exomr iatlaDelu o;s0t2xriopnu1aptelnct ()srrr(r nt1ope ii3ilsfa el(vo u0trxoxo3oy1fa rauvs s0s2toir3io4oltnmnet s)srraxmo;t1tpt mictydfsDranvp;t4 lxrxociodoa   n i t0 rtrxo no4opt lfvtlt a2rmu o;u0oeenifciysfsDeln p (0arerir oy1fmDraies;(  rtm(rpoy4ol   nes s  2uaump;t0opxoifeildlaDrmumsnu0 lerioctotomt anvo s)s2umxrpiy4amte fciasf rrax  ;u4teenmf3iyt a2rlnvs;()trxnio3oydfptrluvils t2umxo3ou4lpt mivs t srtm(m no4olxo f3ilsla2ulumont4 leoxf ta1latelnei;( s2tm(rpny4apenmfvtl(fsrtm(m ;t0apto o3iytfs rl(vo;(4artnmo3ta1optrlivsl() rtm(r3ny1aleemnctls)srtrum ;t4oexnmociydla2ranvsn(4 lermfcoatoptrai i s)s2urio ny4ol n iet () Dta(mont0apeomi3ildla uanvpnt) eeoio iotfmtelivils  euoxm io1lm elnesa(f Drr(moot1tlt  oetasfm eauvo;(0 rerxociatoat  ivi;t s2um(m3ou1apeelfvi ( aDum(mpoo1tle mietydfm2eaumpn(4arxrir oa1fpD lnesl()texmir no1apt lieil() Durx ono1tpxnioetasfm umnvo ()alermfciotlateaies;(0tetrxr nydoleemivi ( sDumxm ot4tleomfetldlmDul( o;()trxoio iatfmDeai ols t2toimpio1omeemncs sfa2umum oo1opt ifeiys m uanmp ()aexrir3tytoa eli i t  eto(m iydll n fcsatf rtrx ont4ope  o3iatla uauvpnt0texnio3iytfmD an i () 2tmir3io4lm  lnvs (faDrrx onu0aptomiciat aDuauvp u)aetnmf3oo1lpDe ieolt0s2xo(m oy1olt  icta(f Dra(ro;t1tetn o3iydlsDua( p t0treomr iatlmteau ilt0sexoimpiodlpt mici ()aDum(r ou4alenmocils a ua(vp u0trxomrctatomtelnvo;t) eumxr3nu1al   fetlt  rrmxr ot1openiicildfs rln o;t4trtrxf tytfp eaueol(  rtr(o3nydlltemfvtls) rrmx o;u1opto ieiad a ra(vo u4 lxoxo3ty1faDelnes;s0t2xm(mpnydlp nlfvta(  Dtrx  ou0alenif3tadfsDum(vo t0 eenmr3oo1oaD  ueilt s2xm(o no1lpen ivilsf Dtmx oot1alxn ictyd a2el( s;t)trenir ty1fpD lieo;s  2xr(o3iudalt mneia()arrrxmo;u4aexn oeiys s2rauvp t0tlxrxo iadfmDeln i s tetrimpnydop n ncils sDum(mooo4ale mo3iatlm2rmumsnt0tlxrxrcoydfaDe ivs;(0trxmir oodalt  ictlt  rta(rpot0apxomfctasfs2umn s;u0treomrciatfmteaies;()texrirpoo4aptnlivsat a2trurpno1apeo i3tydfaDuau p t4tlxrmo totfpDraiesl()setmim iy4amee netl(  Durxro;u4alx iiciat a eln on(4trerxocta1fpte i ols0 rum(r3nudomen iet ()arra(  nt0tlt mieiat aDranvpn() exoirctatom rauei;s0s2uoim oy1altnmneia(fs2rmx pno0alx  oeiatls2rmnvpnt4 lxrxo oydlate iei;(0 2toxo oydapeemivilt)aDtaum ;u1oetomicilt a2rluvp u4altoir3oa1fa  an i;()s2toir nu1oleemfvtl(fs2umx p;o0opeomi3iltfa2eln s u4 eerir iotfate nei;()srxoxm oo1ome mfcs s  2umum ot1ape  f3ilt sDemn s;t4teeoxfcoa1fmt an sls) 2ur(o3no4lp nmneias)sDra(mpoo1oetomiciyslsDeanvs;()trtrmfciotoa  au s t0srxm(m oy1am elnesat a2trurp;o1tpxomf3tldlaDran s;(0texrxo3tytfaDelueslt0texo(rpou4optnlnvtat) Dta(m nt4olt  oetytlm2eanmo;t4tleoir3iatlmDran sl( srxmio nodale lnesas aruaum no1apeoif3iltfsDelu s u)aetnmf3oo1lm eluvslt t2xrxm3iydlmen ivt sfsrua(ronu0texn feiyd aDrmn s;u)tleoircoy1fpte ieolt) rxrio3oy1al n nvilt  Dum(m nt1aptniieils mDuanvp t) ltoxrctytfmte u o (  rtriopiu4lmte fvias srrax  no1olx  ociyd s ua( s () lxrio3totop raneo;s  eumxrpoodal nlictlsfsrraur ;o1tltoiiciasfa2rl(mp;(4 lerio oo1lmDr n i;t teumirpiy1apee fcsas  rua(rpot4opeo o3ilsfaDumn p () ltoxfcoytopt  neo;t)tetr(r3io4om emict t)s2uaumooo1oleo f3iysfm2ra( p () etnmf3tatomD  ies;s0s2xoirpoudllte fci t)s2ur(mpot1tpe  ociadla ranms ()tltnxf oodfp elu i;()setrxrpou4al nmivtltfaDrru  ou1oleo f3iydlm2rmnvs;(4trtrmrciytfp r i o t tetrxo no1olt  fctl(  2ur(mpou0tet mocils a2ra(mo;t0trxnif iy1lmteai s;( t2xoxr iy1opt mfctlt aDtm(monu0tet mfetas a raumon() lenif3tydlmteln sl(  rtmxm iy1ll nmfcs ()aDtmxm nu0optnifciad sDeau pnt0arxnmr3iadfate uesls)t2urir oodlpe  nesl(fs2urxrono1teto ictas aDea( p t0aetomo tatla elu o s0teto(mpou1lpen fcsltfa2rmxmono0oexomoetlslm emnmp;()alxnxf3oytfaDrlu o s0s2toxmpnydameemivil( aruau o;u4optn icildla2umn p (4trtoxocoydlpDeaneil( texm(rpoy1llenmnciat sDra(  ot1apxnii3ilslmDrluvs;u4tetnmrcta1fa  li i s  rxm(o iy4apt lnct ()a2ur(rp;u0oeeo iciytlsDua(mpnu)teermr tatlmD lues (  2xo(m nu1lpe  ies tf rra(  ou4tleo ieiaslm rlums;u)aleoxr iotlatrlu s;s)srtrxrpou1oleemfes (fsrrrxmpou4tlt  i3ilt s2ul( s;()aetoir iadfpt  u i;t s2xrir3oy4lpe  fesasf 2rmxmpoo0tltn o3ilsfsDrlnvp () exrxfcoytfmDe uei;t trxmio iudol  mictatfsDumx p;u0aetn icias m um(mo;u)altrmocoatoa raiei ( s2tm(m3iu1lleelneiat a2truront4optomfciad s ua(vp;(4 etrif oodlpD lueols t2xrxo3iy1om  lneslt  rra(mont4opxn fetat m2eanmo;u)altomrcio1lmtr ies;t0 etrio io1lp  lictl()s2rmumo;o1tpe mi3iytfm2emuvpnt0 rxrxf oa1lmte ueol(0seum(opno1llenlivtl(f Dra(m ;u1oex mieild aDemu on(4trenio oy1lmD  ies;s) 2uoxr iodlle  nvs sfa2rmurpno4aetoio3ildla em(mo (4tltnircia1lptrauvo s0 2tmxr3nu4optnmfeils arrmumono4tee ifctad a ran o;u0 lxoif oadopt aueils srtrir3oy4lptn fcta(faDta( pnu0altn feiadls2rlnmonu4 rerir to1fatr i i ( t2uoim3oo4al  lictatfa2tmxroot4olto ocilsfa2eluvo (4 etrmo3iatomD  n olt truoir iodole mnctlt)s2trxro;u4tlto feiytlsDrmuvsn(0trtnmrctatfp eau s t0seto(rpou4lptemietlt)srtaxro;o1tptnmo3iadla2ean snt4 ltrmo tatfpteluvilt teto(rpnodlpenmivta(  Dtaum no0olx mfciydfm el( onu) renmrciadop r u o;t)trumir3nu4lmt lfcs ( aDtrxmp;u4tetn octasls2ul(mo;u4areomf3iatfpDe neols srtoir3iy4lp  livtat arurxr nt4alenmf3ild s2ra(mp u4trermf iatfatrlivi t0teuo(rpny4llenmicil()s2um(r ou1tlxo iciys m umnmo t0altnif3iotfmD li i s0t2xrxopnu4lp n neils)sDrmuroot1tet  ocild s ra(von(4trtrmr3oydlp   u s ( srxmir3iydomee fci s) Duaur no0alxoii3iyt a2ua( s t0aleoxf3oatfaDrlnvils)srxoim nodlle  fci () rurum ;t0tetniieiadla raumsnt4alxnmo3iy1lmDr n i;t  rtm(r oudapeelfvta(fsrrmuro;u4oee mi3iat aDumnvsnt4alxoifciatop e u ol(0 2xmxo oy4alenliesatfaruaxm nu0tpt moeils a2emn p (0teerxf totfa r i ols0trxm(o3iydameelfci s) rra( p;t1oex  fetaslmDemuvo;(4texnir3tadlmD aueo;t0srumxo3nu4am emnvi t a2umu pnu0aptnmo3tyt m2emuvs t0artnmr3tadlateluvsl()seumimpoo4ameemfci () 2raxm no1tlto ocias mDrmuvs;u0aeenxo3tatlptrai ils s2uoxm iy1lptelnes ()s2uau pnt4opto o3iat m2ulums;u0 eeoxf todlaDr n ol(0t2umxm iu1op   nvs tf 2rr(m oo0apt mf3tldfa2umu s u) rxnio oodlp r ies;s s2tmio3io4alenliei s aDumump;o4altoiieilt aDuanvpnu)treniociytom elues;t0s2xriopoy4amenmfesl( srrr(ro;t0aptnmoeiasla umu sn(4 ltoir3oo1opD lnei;t)t2xmimpiydam nlivt s) 2tmx p;t1aet ifciltfmDem(vo;(0 rtoio todopDraivi s) rum(o iydll  lieia(fs2urumoot4aet  ociytla ra(mp;u)tleoxo oydfp rlivo;t0 eurio iu1omte icils) 2raump;u1optn f3iatlsDeanvs;(4tetomo io1lp  liesls0s2trio nodlpt liei ()aDuaumpoo1tptnmoeiltfa2rau onu0 renir iotfaDr i slt0tetm(opiu4aptn feiltfsrraum oo4oexoif3tatfm2emn o t0teeoir oatlaDeli sl(0t2tm(o nu4ol  miciltf 2ta(  ;t4aetnmi3tltls2ua(ms;u0 eeomr ta1laDeanvols0texmimpoy1ol  lietat)srtrxrpno4alenmfeiytfs2ua(vp;u4trerxf3oy1lm   nvs ()sexoxmpnudllt lfetlt) Dumurono1olxn i3iasfsDuaumo;t0artrif oo1om raneo () eumir3nodlp nmnvil(fa2ra(mont1apeo o3tls m uanmo u4 ltrxr3tydlp raieilt) rxr(rpou4opt miviatfaDrrum no1olto ieiysfa ra( onu4arxoxfcoatlmD  neilt)texoxm ou1amtn iesa(farua( p;o0tpe mfcilslmDelu onu) rermocty1fpteai s t  etmxr3ou4lp  lnvilt aDraumo;t1oeeoioetadfs ulnmo;u4trerifciydfa rluei ()t2uoxm3oo1lmtnmncilt)srtau pnt0opxoifeiytfs2ea(vo t4aexrxf3oatfp  lu i;t t2xrio3iydlmtn fvs (fsDtru  ;t0tee  ieilsla emu pn(0 ltrxr oytoaDeanvo;( srurim3no4am nlicsls)aDtrx ooo0oetn fctys m2rm(mpnu)trxomr3oydomt au s ( s2trxr3ny1ol emivsltfsDtmxmoou0alx moetlt aDuan p;u4 lxnmoctotoatr i s t) rtmxmpny4lle licsat  rrr(mp;o4ole  iciatfa em(mont)artnmrcoatoa rai ilt0sexm(m3iodamt mfvtltfa2rrurpno4oltomi3iat a2ra(ms u) lenxr3tadoa r nvsls)texoirpoodol n nctat arumur no0tetn fciasfa umu sn(4treoiocoytfaDr ivs t srurim3iudomt  iet (faDtrx  ;t4texnmoeiyd a eanvs;u4tlxrxr ty1fptr uvo;()texoxrpny1lmeelieiatf 2taurp;t4apx mi3iatfsDrl(von(4 eenmf ootlp raivs;() 2trio oydope mnes t)a2tr( oou4oexomfcilt aDeanmp (0altoxo3ia1lateai ilt)trtrxr3ou1ol elneias) 2ta( o;t0alt iiciatfm2ulums (0altrmf3oo1oa ranes;s t2xoxr iy1amt  ivs ( aDra(r ou4apxomieiytfs2rauvsnt4aexrxociydlaDeluvsls0srumxo iy1lp elfcs s artaxrp;o4texo ietasfa2emuvs (0aetrxfcta1faD  nvi t trxo(opno4lm nmfvtasfa2uru  ;u1tpe  f3iad a el( p;t0aexrmo3totoa elnvs;()tetr(m oy1lpee nct tf rtaxm ;t0texomf3tydfa2ul(vo () etrxr tadfmDrau s s texoir oy1al  mnesat a2rmu o;u4oeeomf3iltla2rl(vo ()trxnir tatomDraies;( tetrxmpio1opeemfciasfsDtmurooo1olxnmociat mDulump;t0 lxrifciadlmteanvils) rxo(r3nu1amen fctas s2tr(m ou1apenmf3iadls2eln o u0tlenmo todlmtr ivslt)srtmio nodlptnmivilt)arrmxmooo1oeeo i3iatfs2eauvp t) rxoxf to1lmDe neil(0s2xoxopio1lm   fcia(  ruaxmonu4optnifeils mDumumo (0artoir oadlp elnei (  rxoxopny4omte nct s)aDrr(roou0altn iciyslm2ul( pnu0texrirctydoateauvs;(  2uoxmpnu1ame mnvi s) rtr(mpnu1opx mieiatls2emuvp;t)tlerircoadlaDraies;(0tetr(opou4opt livi (  2umxm ou0aptn o3tltfs um( p u0aexnmo3io1oa eauvi;() etmio3oo4al nmfvs (fsDtmu o;t0opx iictad s uan o;t4teenmr3to1opDrluvsls)trumxm ny1omtn fcsls  Dtaxrpno0tlt mieiat s2eluvonu0 rtnxo oodlp r iei;(0 2xrio iu1apte fetas)artmum ;t1oex mf3iyt m uan s;(4 lxrmf3to1fpte u i;t) rtoio3no1optn nei t) 2rm(m oo1aexomieilt m2uau onu4 ltnmf3iytlaDrluvs ( teurxmpno4aleelici (farurx ooo4oltomi3tasla2ua(mpnt0aexnmf oydfmtrlivsl( trxmir iu1lptelnvsl(fsrtrx ono4olx  i3iat aDumnmp;u)texnio tydoaDe uvo;s0 rxm(opoo4lpe mici ()sDrmumoou0alxn oeildlm2eln p;() lxrxf3iydlmDr n sl(  euoxr iu1amte nctasf Dumuront1tpxnifeiys s ulnvo;(0 lxoioctydomDrauvs;s)trtoimpio1lm nmfvsat  2urumpno0apen fcilt m uanmp;u0 eeoxfciatomteauesls seurir nudomt lfvs t a2rmu  ;t0aptnifeiyd s2uau s (4aetnxf3oatfp e i il()s2urio oydalte nesa( sDtrxr nt4tpen f3iad a2ul( s;t4 lxomrciadom rln ol(0srxr(r3iy4al  lici s sDrau o;o0aeeoiiciasfm ua(mon(0trenxo oa1lpD  nvi;t0 eurxmpiydom nmfvi (  rtmumono4oleomieiasls rmnvpnu4altoio ta1fpt luvi;s  etoxo3iu4lpt miciltf rraum ou0alt  ieildfa2uanvo;t4trtrif3iatfa elieo s0s2xrim3ou1amt  ietat  2ua(ro;u1oetn fciadfsDrl(mo;t0trxoircia1latr i o;t0 rxmio iodop nmfes s srrru  ;o4teeo feiasfa um(vo (0aeerif oytlatrln ols0t2trxopno4opeelfvt sf 2rr(ront4ope if3tld a2ua(vp u)tltoio oytlpDr i il(  2trim oo1lltemivtas) Dtru pno0optnmfciatfaDrmuvs;t) lxrmf3iydlmD lu s t)s2tmxo3iodlmtnmfct s) rrmurpoo4aptn iciasfm2rlums u4tetnio iodoa  ai o;s0 rxr(m ny4omt  ietat srtau p;o0tlxnmoetat m2rlnms;t0aexomfcoadlm elnvi t0setoirpoo4amtelncsat  Draxrp;o1texoioetatfa2ea(ms u0aeeomf iytlpteaivs s)setm(m3ny1opt mnesat  2ra(m nu1ole  ocildla em(mp u0tetnxr tytomDr ivo t)srxrir iy4opt mfvt sfarrrxmont4opx iociydlmDrm( s;t4treoio3todoatrau s;(0tetoio oo4opeemnvt ()arua( oou4apt mfeilt a2uaumsn()trxrio oy1laDr ivi;s0 exo(m iydllee iciat)srrrur nu0ape  fctadfa2rln pn(0tlxnxr io1omt anei t)srxo(r3nu1om n fcsatf Dtm(rp;u4apx moeiyd a emuvp;u)tleoxr ia1oa  aiesl( trxoim3nydlpee neilsfa2tmxmpno4alxomoeiys sDrauvsnt) rerxoctytlmt  uvs s  exm(r3iy4oltelictat srrrxmpnu4alto ieiydfs emnmo;t0artnxr iatfp eauvilt) 2xm(m3no4altelnvi s aDumx p;u4apxoii3ildfmDraums;()aexnio3iadop rau ils tetm(m3no1lmt mivtl( a2tmxr ;o0teenifeiyd a rmnvs;u0 exoir todopDelivs;t  rum(o3iy1open iesa( a2ua(m ;o4olt ifetytfm2uau o t)aetnmo3oatfat auvolt)sexr(o3io1lptn fvsa(  2rrumo;o0olxo feildfaDem( o u4 ltnmf to1fmD auvils0 eumxopou1amtemies () rur(  ou1tpx  ieiytlm2rmuvont4 ltnmr3oo1opD  uesls) 2ur(m ou4amtemnvil(  2tax  no4tptnif3tlslsDrl(vsn() etrxo3ia1oaDranvi;t)t2xoim3nudll emfviat srtr(rpnt4altnmf3iltlaDeanvs u0tltrxf iadom eai slt)seurio3ou4ap   nct () Dur(  nu0oex  ocilsfm eanvo;(0 etnif iy1fm e u s s  rxrxmpoy1lp  livi t) rtruro;u4alenmo3tysfmDraumo;u)aexoxo to1laDeln i t0 2xrxopoydop  lneta(  2tmxm no4olenii3iyslmDul(vo u) exrir3ty1lpD lneol(0trtmir iudlpenmivsl(f 2taxm nt4tle io3iysls rl( s (0tlenxfciatfaD auvs t texrir3ou1ope lnvsls) Dumx oou1aeeo i3tys a2ul( o;u)aeeoirctadfat ai o;s0 2tmim nydol emnvt t)srurumo;t0olxo icilt a rm(ms u) lenmfcoodlmDeai o;s0sexr(m oydaptemies (fsrum(r ot0tptoifetyd m2eaums ()alxnxr iadomDe ivolt0tetoio3oodop  lfeiat)srrauronu1tleo ictyt s2ea( s u4treoif iadomt anvi;t teum(r3nu1lpt lncs (f rtru onu4altnmi3iysls2um(vo (0alxrif iatfa eaivs (0trtrxmpou4opt mfvsat  2tmum ;t1opt  oetadla2rmu o (4aeenmr3ty1fmtelu s (0 etr(r nudopen ivtasfaDuax ono0opxnmo3iyslm umu pnu0 rtoir3ootfm  lueo;(0t2umxr nydlltnmnvsas artmuroou0oeeo feiltfs2el(vsnu)tlermr iatlaDrau s (0 rtrim3iydome lnci t  Dum(  nu4tpxomf3iyslmDemnms ()trenmocoytla eln i s0trxm(o iy4alenmivil(f Dur(mpnu0alen o3iadlm2uau s;t0trtoiociodoatean s t0t2xoir oodolte ivsl(farrauro;u0teeo i3tld sDum( s ()aeerxoctadla  luvolt)texoxo3oodamtemnesl(fa2umxmo;t1opeomi3tas mDeauvpnu0 renmo iatlaD lueo (0 2tr(mpoodape mnvsltf 2rr( p;u1olt mociytfm2rl(mo;()tleoif3oydlpt aieolt t2umir3ou1om n nvi tfa2taxmp;t0tleoif3iysls2emu o (0areoxociodlaDeau sl()s2trirpoo4aleemfvtl( aDta( p;u4aleomi3tysfa2eau pnt0tltnxrciotoa   nvs t0t2uoxo oo4lm emfet ()a2um(rpnu4apeoio3ild a2emu o;t)tleomr iodopDean o (0 rtoxmpnodll nlnvil(  Drrxm ;o4apxn ociltlaDulu s (0areoiocoadomD aies;s0sexmxmpny4ape mnes t s2rmx o;o1tex mo3iltla umu pnt)trenmr3ta1omtr nvo;(0t2toio3nodllt mict (fsrrm( oou1opx ioeilsla uln p;t0trtrxfciotoa  luvs s tetm(r3nudlptnmivilt)sDur( o;t0oex mieiltlm2elu s;u)trtomf3iatfaD auei;()seuoimpiu1ap n feiatfsDtm(  ;t1altoii3iydfa2ra(msn(4aexomf3oydfa  lueslt0srtr(mpoo4llenmfet s sDua( ono1tpeomicilsfs eau o;u4 lxoxf3to1oa  ln i (0s2umio3iy1amtnlfesa(f Dum(mp;u0tpto o3ilt m ean on() leomocio1lm elueo;t) eto(o3nu1ll elnvtasf 2trumooo1teeo oeiytfsDumn snu)tlermr todomDr nvo;t s2toxopno4lpenmfcsatf Dur(m ;o1tle ifcilslm ea(vo;u4 ltrmf tytomD lu il() 2tmxo3iu4lmt livt (  rurxrpot4tptomieiyslaDemumo (0 etrmr3io1oatranvs t0srtr(rpiydlm nmfvs sf 2tax pnu4opeo f3iytfaDrmnvp u)arxnxf3ootoaD  uvi;( texr(m no1lp  liviasfsrraxmpno0alt  fciltfa2rm( pnt0alxnxr iytlaDeluvo;( setm(o3ou4lleelncsl( srtaum nu1aptn oetlsfaDrl(vs u4teenxrcio1fm  lueol()t2tm(mpiodlltemfci (  rtm( oou0tptoiiciad aDemn pnu0teerxf oo1fpt ln o;s0srxoxr nu4lpe lfeiat sDrr( ono4tpeoioeiat s uauvs;(0tetomrciatfpDeaueol( srur(rpoudom elies (fs2ta(m ;u1aptoifctadfsDrmuvont0aleriociatomt luei;t)tetr(rpoo1amtelivslt) 2taxm ;o0alt io3tadfa el(mo u4tetoxf iatfaDr i ol() rur(o3iydamee ictas)srum(ronu0oeen i3iatla2eanvs u4arxoif3oadlm ranes (0 rto(o3oy4amtemivi t  2tru pot1tet  i3iysfsDrl(vsnu4trtnxo oadlaDe iei;(0seuriopiu4ol emiet ( aDtm(rpot0oeeoiociaslaDelumsnu4 rxomo3ta1fptr nvo s) rtmim3nu1op nlicil(farrax pou1ape io3iyt a uanmo;u)aeenmr ta1lp rauei s0t2tmio ny4am  mnci ( a2rmxront1olxomieias s2rlnvo t0 reoio iatlm elu o t)setrir ny1oltelfcs t)srrau onu4apto ieiysla umuvs;()trtomfctadla rauvs;t)srur(opnu4apenmnct t aDua(mpnt1opt  o3iat s2el( o u) leoxf3iydfpDr i s ()t2xo(r nu1opee fvta()a2tmum ;t1aleo octysfmDrm( o t4trerio3oytoateli s t)t2triopio1ap e nei () Dtr(rp;u0tex  i3ilsfsDrmums u0trxomf oydlp   n s;t0 rtrir ou1aptnlnesatfaDtaurp;o0aetnmocilt sDemuvsnt4teenmocoytfm e ueo t0 rtmim3io4alenmnctls)arua(m ;u0alxoiieiyd m2ean pn(0alxnir oytfpt  ivi (0 rxm(opnydlp n fcsasfsDrm( oou0tet ifciytls rmn sn()arxrxrcoa1lmtrlnvols t2uriopiu4am  mnciasf rtm(mpno4olx  ociydfsDulu on(4texrif3oy1lm e nei;( s2tr(m iodapte fesatf Drmu  no1opx  fctyt m ulums u4trxnif3iotopt lnvs t)sruo(opnydlmt mivs tf rrm(  nu1oleomf3tad m2umnms;(0 exoxrcoytlpDr ivo ()setm(m nu4al elfctlt) Dum(mont4tptnmicildfaDuauvp;t4alerxocootoa rli sls0 rtr(r iu4lm elnctltfaDua(ro;u0tltnioeils mDrlums;t4aeerxo3iodomD anvo s0sexmio3oydlp  mfeta(faDrrxr nu4tee iociys a2ul(vp (4artrmo ty1lmD aneo;t) 2trio nu1ape mfctls) 2urxrpou4tpe mf3ilslsDuaums;(0tltoifciytfa r ues;s srurio3ou4lmtnlivslsf 2uax o;o4teen i3tas s2em(vo;u) lxrmr3iodoa  ai olt)seur(opiy1olenmnvsa(f rtmxr ou1tlx  ieilsfa rauvp (4alxnmo ia1lpte nvsls  rxoxo iu1lm nmfeia()artm(mp;o4tlxomfctlsfs2em(mo;u) eerxocoodoptrlneslt)s2xrxrpiy4altnmnes tfaDtaxr ;t1altnmieilt a2um(vo;u0tetnmrctodopte neol()srxo(rpiu4lme  fct t  2rax onu4tptoiictatls2rmumpn(4 lenxo3iotomDe i sl() rxrxopoodllen nct sfaDum(ront4oet mietatfs2ul(mo (0artrxo iadlpD luvi t)trtr(o iy1om  lfesas aDrmx o;o0tpto ictytfmDrauvp ()artnmrciydlptr neo s0srxoir ny4alen ictat  rur(r oo1alt  o3iasfa2um( s t4aexrmocty1lp  lues s0tetmxo3ou4om  mncil()arur(rp;t4tlx ifctlsla uluvs t)tlerif iydlp  livs;t)teum(o iu1al   ictas)aDrmxmoot4alx mf3iydlm emn p (0teenxrcoa1omD auesl( srxmxr3iu1ll n fvsas aDumumoot4oeenmfcilt m2rmnmpnu4tetrxr oy1fm e i slt srxr(r3oy1apeelnei s)aDururonu4aleomocils m uluvp;(4 renifciotfpD  n s (  2umxr no1lpe licta()srum( oot1texnifeiysfm2elumsnu4trtoxo3iytopD  n ilt)srum(mpiodlle licia(farrmu  ;o4olx miciasfs ean on(0teerif oytlmDe ueo;t trum(mpiy4llt  fctasf ruaumooo1aeenmoctad s eaumsnu4 exoxo io1op eluvi s) exoimpiy1ol n nvtas) 2rm(rp;u4altoif3ias m2eauvs;(4aeenio oy1fptr n ilt0sruriopou1am nmnvtas a2tax  ;u4tpt  ictydla raumsnt) lermf tydfm ranvsl(0seuoxrpny4apt lnei (fsrum(ront0alxo f3iysfs ul(mo;(0 etrmr iy1faDrlu o t)t2xr(mpnu1amtnlfesa() 2rrurp;u1olx ii3tatlsDum( pnt0tlxnxocoatfpt  n sl() etr(m3oy4olt  feta(f 2rau  oo1tle mietydfsDraums;t)aetrmf3oytlm eaieol(  2urxr ny4ame mfvsatfa2urxmp;t0tlxo feiat aDuanvp;t0 lxnxrcoytfmDe ivols0sexmio3iu4ape lncs sf rtmxrpoo1aee micilsla2rau o;u)altomr io1faDe neol()trurim3oo1llen nvta(fsrtax  ;o0ole  o3iydfmDea( onu4tetomfcty1la ranvsl( srtm(mpoy4ol  mncslsfa2tmxmp;t1tlt mieild a ulnms u4texomf3ta1om e ies ( srxrxrpnodol nmivt (farrm(ro;t4apto fetasls2rl(mp;(4altrmrciytfptraivo (0 euoxrpiu4olt lncil(faDurx o;u0aetnio3iasfaDel( onu0aexrxf iatfm rauvo;(0s2xm(o no1ol  lnvsa( s2trxm ot1tptnif3ildls rau o;(0 eermf ootopt  i s s trtrxrpny4apen iesasfaDuaxm no1tpe if3iysla2um( p t4 lxrmo3oodfptr n i;s0trtoxm3nu1lp nmnciatfa2rm(rp;o4tpxnmociat s2eluvp;t4 ltoir oadoatelnvi t) rxrxr oudop emfvtltf ruaxmp;o0opxn i3iyslsDrm(mp u0trtnxf3iatoa raues t0teurxr iy4aptn nvt t sDurumpou1aet iietysls emuvonu) rtnmr3oo1omDr ueils s2tmxm3oo1lmtemnvtat)srua(mont1ope ioctydlm2rmuvs;(0 reoio3oatfpt  ivsls  2xrxmpiudamtnmfcsa(f rum(mpoo0tltnmiciasfa2elu pn(0arxnmo iydop eauei;t s2xrimpoo1opte ncsl(  2trumpot0tetoiieilt s2ua(mpnu4alenxo3tadlp e i i ( trtrxrpiudll e ncilt)srumu pnt1alt  fctlsla2emnvs;u4 rtnif oadomDe u o;t0srxmiopno4lpenlnet s)s2ta(mo;t1oexnifeiasfm2ua(mp t4 exoxrctodoaD aivo t  exr(rpoydome liciltfsDurx p;u0tee mietldla ua( pnu0 lxoir iotlp e ues;( srtrim3oo1amenliei t)aDtmumo;o0alxniieiytls ua( onu)aeerio3oa1fat  ieils trxrir no1oltnlfcia(f Draxrp;o0olt io3ild a rmnmsn(0tlxomfctodlatelneo;s) 2toxm3iodlmen fcs s) Drrxro;t0olx  fctasfs elnmpnu4 eeoxr3oadoaDe ueo;(0setmio io1optelfvi (faDtmu pnu1tlt iieiydfm rmuvs;(4tlenmociodlpt  ieo ( setmxo oydoltemnctls) Dtm(m nt1apxomfetysfsDul(mp (4 rtomfctodomDr iesl()trur(rpiy1opee fes ( s2rrxrpoo4optnmietlt m uluvp (0arenircoydfat lueo t)s2xm(o iydlm  mfct t arur(  ;t0tpe  fciatfm um(msnt) renxf3iotopDr neo;s0 etmim iudlltnmieia( srumxroou0oleomfctldlaDrmn o;() lerif tytomtrlnvs ( srxoxmpio1ap nlfesl()srtm( pnt4aeeoii3iydfsDulu snt)tetrmfcio1faDelies t) rum(opoo4amtnmici ( a2uaxronu0aetniociat s2ran p t)alxnmrctydopDe uei s0t2xm(r3io4ol  mnvs tf Duaxr nt0tlen o3tasfa2eluvp u4tltrmr3oy1fpteluvils0 etrim3iu4omt mnvtltfarur(m ;t4oet mf3iydfm2uaumsnt4treoir3iodfpD ai ilt sexr(o3nodam   feslt)srtaxmonu1oeto f3tytlm rm(mp u4texrmrctotoate ues ()srxr(r3io4ol   fei s)sDurx p;o0oltomoctydls2ulnvp () ltomf3oodom  lu o;s0srur(mpiu1optnliesasfartmxmpot1tleomoeils m ua(ms;t0texnxocio1oa elnvs (  rtmxrpno4ape  ieilsfarrax ono0tpe  octltlm2uanvp u4 rtrxo3oytfa ranes (0s2umim3iydol n fci t) Draxrp;t4opxoifeiyt m2ulnvp t)teerxfcia1fmteanvs;s0trtr(opny4am  micta()srrr(rp;u4alxn iciys m2ulums;(0 exomrciydlatr uvi;t)srtoxr3iy4lme miviatf Drrumo;u0oltomoetltls rl(mp u0aeenxf iytopte u o ()srxm(m oy4aleelfvsa( aDrmurpno0tetomieiadfsDel( pnt0arerir3oo1oa raivo;s)sexoxo oo4aleemfeiat) Drmxm nu4tpxnmi3iyslmDulums t)altnir oodomt anvs;( setoxo iy4llt  fetat) rra(rono4tptn i3ilsfa ran s;t4aexomo3ootlaD lieo;s srxmxo nu4ape mivi s) Dumum oo4tlxoiociatfs uaumo;t0tleomf3io1fmt li i t) 2umxo iy1ll emict s)a2rrxr ;t4oeenmociatlaDum(monu4teenmf todlmt auvol()truo(r3nodap  mfvils s2ta( pou4tpeo feiltlsDeluvp;t0artoif3oodopte i o s texm(rpio4amenmics t)sDtmxrpoo1ape io3iysfm2ulumsnt0teermo oatfmte i ils s2xo(rpno4lpt lnvs s) rrrxr ;o0aeeomf3ilslsDum(mont4 rxrmo3oo1lp elnvols) eur(o3iy1apeelncils  Dtm(  ;t1alxomf3tlsla2uaumpnu)tlxrxfciodopD  i i;t)trtr(mpio4alenlivi tf rrm(mont0ape mf3tltfsDel(vo u0aeeriociatfmtrau o t)trxoim ny4ope  ncsasfaDuax  ou0oexomicild sDuanms;t0aleoxr tatlmD li i s)texr(r oy1lmenmfeilt)a2tmu  ;u0oeenio3ils s2ulu snu0aetnmrcootomD an ilt)srtriopno1lleemneils  Drr( pnt4oet mieiys mDrmn p;t4altrircoa1fat  i i s setoxmpoy1ll   nctl() 2trurp;t1tpeomfeiatfmDuau o;t)aetnxocoytlpt li s ()s2uoir3ou4omenlics t) 2uau  ot4alx  f3tydfm2rluvpn()tleomfctytfm  lieo t)s2tmxo oudaltn nvs sfsDrr(  oo4ape mo3tydlmDrl(mont0tleniocoytla r uvils  2xr(r iy4ameelnvtat)srur(m no4apxniiciyt sDrm(vp;t0aetrmf oa1fpD anvs;t  rto(rpoo1lmtelnvi t)srurur ot0tpxoioctadfa2ul(vo;u)alxoifcta1fm e uvi;s0t2xr(o nudale lies s  2tmur no1tpen feiatfs2el( o;t0 ltoiocoadoaD li o;(0seuo(r iodap  lncils)aruru pou0aeeo ieild mDuanvo;u0trtriocta1opteaivilt)srxm(m3oodlp nlivsat s2tm(  ot4olx moeiydfaDul(vp;t4trxnxo tatlpD ai s (  etoxrpio4lmeemicslt s2rrumpnu4aexoiociatlaDrmums u0trxrxr iodfaD  u o s0srurim3no1optnmieil(  rurxront0aleo fciytfs ea(vont) lxrxocoadlm  au ils)trtmir io1ap e ictl()a2rrurp;u4tleoifciytfm2rm( ont4 exnmo ia1omD aivo;(0seuo(m3iu1omtnmici sfs2taur ou1aptnio3ias m2uaumo;t4trtrmr3iytlaDrlieilt)tetmxr3nydop   nviasf Dumurooo4oexn i3tlt s umn pn(4 etnxf3tatlp  auei;t) 2tm(opoodlmtnlnet t arrm( pot1alxn f3ildlmDra(vp (4trenifctatfmDe uei t0t2umim3iodaleelivtatfartrxr oo1tlxo fciyt m2ul( s;t) rxnioctotlpt livs;s)truo(r3oo4apt lncil()sDtaxront0tltn i3tytfa2uan p;t)tlerxr3oydfp eliei ()s2uo(r nodam  micsl(f rur(m no1opxoiietad s2ean s t4 reoif3oy1op rau sl(  ruoim ny1ll   icsa()srumur ;o1alt  fciyd m2uauvp ()teenmr oytlat  n i;(0texrir nu4ame mfct t) rrax oot0alxn o3iadfa2el( o (4tetoifcoy1opt ai o;(0s2tm(m3iu1oltnlivt s  rurur ;t0olt  i3iytfa2rlumsnu)tlxrxr oatfate nvsls0s2xmio ny4lm   nvsas  2rm(  oo1optoii3iasfaDranmp (0 ltnxrcta1op e uvi;(0 rxoxo3oudolt mivia(fsrumu p;u4tex ifetadfm2rm(ms;u4teeomf tatlpteaieilt0trxoirpiodll elfci sf rrrum ot4tpxomictldfa2emu snu4trtrxr3ootopteau i;(0sexoxr oudlp elfvtlsf Drau  ou1tpxomfetadfm2emu ont4tetrxfcta1fptrln slt)trxmxmpny1olt mnciat) rtaxrp;o4aetoiictyd a emn s t4 etrmocoodomD ln ols truoxm iodal  micilt sruau  nt4oet  o3tadfa2rlumont4arxrxociydfatr n s;() etoim nodapt  net (faruru  ot0ole ioetat s2rm( o;(4aexoxr oodopD aieilt0 etrxrpnydomenmnvs sfarta( p;t4tlxomietyt m2rmnvsnu)treoio3oa1oa ran i t  2umir iy4ale  icsl() Dra(rono4tle ifeiyt m2rmuvo t4 rxrifcia1fmtelu i;s  etmir nu4apt  ivtls  2urxroot1aleomfeilt a rmumpnu0 leniociotlateaivi;t0s2ur(m oudaltnmfctl( aDua(mp;t4aeeomf3iasfs el(vo;(4tlerxf3oatoatr nei;t  etrxm3oo1op elfvilt)s2tm( pno0tlxoifctasfaDrl(vo;t4aexomrciotop  livo;()trumxm3iudam emietls) rtaxm ;u1optoifctldlaDuan s;u4altnmfcty1op   uvolt) euoxrpou4apt mict tfsrra(mooo4aeeoio3iys m uanvs;u0aeermoctadfm   nvsl()tetrim3iudapt  ivsl( a2rrxm nt4teen i3tydfm2rau p u)artomf3todlmD auvo;() rurxr3iu1omt lfciatfa2ururpot1tetn f3iysla2ulnvp;u)alermfciydoat aies;() 2tm(opoo4apeeliviatfarrm(ront1tpeoiietldla uau p;u0alxrioctatoatelivs;(0s2uoiopno1op emiciat aDrrxrpnu4opxoioeiltla2eanvsn(4trerxoctytlmte n o t)sexr(m nudll   nei s a2rr( pou4aptoioeiys m2ulumon()trerir iodopteauei;t)srtrxrpny1omenmnei () rrrum ot4oee mi3iasla em(vs;u) ltoif3oy1laDelieo;s0 etmim3nodoptn ies (fa2umumpnt0tltn f3tatfaDua(von(4tlerxr totoat lueo;() 2xo(r iu4am elivi (fsrururpoo4tex moeiadlmDranmp u0aeeoxrcia1oatr n i (0s2toiopoy4alenmfvils  rtrx oou1open oetls s ea(msnt)trerxr iotlm e i o;t0trtrirpnudomtn netat)sDta(moou1teeo ociysla umu p;t0alxrmrcoydfm ean ils teumir3iy4lptnlicils)s2ur( ono4opeoioetad a ua(vs;(4artrxfcoa1lpt livslt)s2xrio3no4op nmnviat srur(m nu0tpt io3tatfs ea(mpnu4 eenmf3iotlm eaivs;()seuoimpnu1al elfvsas  rrrxmpnu4aexo octysla ulnvpnu)aetoxocoadlaDe nvi ( trxr(rpiy1lptnlnci s a2rau  no1olenioeilt sDrmnms (4 leomr ia1fatranes ()t2umio3oo4lpe mneils)sDra(mpou1altn iciatlm ulnvsnu4 rerifciy1lp rluei t0t2xmio oy1llee icsa()sDumxm ;u0tptniieiat sDumu p t4 rxoif iodla   uvo (  etmiopio1lpe lfet ( aDua(mpoo4olxnmfciad s2el( p;u) rermf3ia1fmtrlneo;s)srtrxmpny1al  mictl()srtaumooo4aptomfctlt a2emnvp;u0teenxrcoytfpDr uvo t srurxo oy1alenlieil(fsDumumo;o1opx mfciysla um(ms t)trtoxfcoa1lmDrli o t0 etoim3ny4ol   ici sf Drrxmp;t1alxnmi3tls s eluvp u)teeomfcoodfmDelu s;s0t2umim iydom elncsasfarurum ;u1oltn o3tytfa eanvo;u)alxniocoytfp e ivi;t)t2uoirpoydolt mncsas a2uru  nt1optn iciytlm2elump;u4aeermociydop eaues;(0s2ur(mpnu1lm elfet tf 2urx  ou1tltoifctysfaDeanms;(4texnxr ia1lat  ies ( truoxr3oo1ll e ietlt sDta(r ;u0tet  ietlt s uanmo;t0trenxo3oa1lmD livols teuoio io4al nmieiatf 2rr( p;u1optniiciydfs2el(vs u)alerxr3iotfmDeluesl(0sexo(opoudopeelict s)aDtrxmoot4alen f3tltlm umums;(4 reoxf3todlate i s ( srxoio3nodapte ies t  2um(m ;o1aex  i3iyt mDeanvs;t4 rtrxr3tytop   uvi s s2ur(rpnudlm  lncs (fsrurxront0aex  ietls sDeln s;t) lxriociatopt luesls) 2tmim oudalee fvils)arrr(m ou4tex mociytls2ua(mp u4 etnxr3tytfp  aiei s  ruoir io1lm  micsl()sDtr( onu1oleo iciyd m eau p (4 rtrxo tatla   i i;s0s2xmxm iu1ale lics (  Dum( oou0ope io3ilt sDelump t0artrxo3oytoatrlnvo;( t2xo(m3iodomeemict ()a2uaxmo;t1aee  ictys a ranms;(4areomo3to1fa eauvsls0seuo(rpny1lptnmnetlsfaDurx  ;o4alxnmieilsfs2rlu sn() etnioctydopDe nei;t0 2to(opiodoptn icia() rur( pnt0aleomo3tltfmDrl( p;u0alenifcto1omteln s;s trxrxo3nudlptnmfvsa() rrrurpot0oet mo3tyt a2ra(vo t4 renir3iotlmDe i i;s)trxo(o3nu1lmee nes tfs2raxrp;o4aeto fetydla umn pnu)arerif3oydlptrluvslt0tetr(mpio4lp n fviat)sDuax p;t0olx  oeilt s2ran s t4 eeoiocio1fmDraieol()s2tmim ny1amtn neslt srrmxroot4texnioctydfmDemums;u0tlxomrcty1lmDe i o;s)tetm(o oo1opeelieta()a2taxmp;u1ale mociltfa ul(vo ()texomfciatoaDean olt0 2to(mpou1al n ivslsfarumxroot4alenmo3tat m ul( onu) rtrio todoa e nes;()tetm(m iy4omtnmfvsasfsrua(  ot4alt  fctas a2rauvs t4 rxrioctadfp r neo t0 2xr(r3iy4ol e ivs t  Dra(  ;u0tpxoiiciltlm umnmsnu) eenmo oa1lp raueolt teuoio iy1ape licta(  2tm(mpoo4alto i3ild m umuvo (4areoxocia1oat  nes s t2trio oy4lp n ivsl() Dtrxroot4tltnmoetadlm umuvp;t4alenmr ia1fpD  nvsl(  eum(rpiodalen nvsl(  Dua(m oo0apt  feias sDem( p t0aetnxf3oodlpt lueslt0s2uo(m3oy4omen fctas  2umur nt1tlxoif3iyt aDumnmonu0 rtrio3oatoaDrlieo (0t2trirpiydop  lnvslsf rtmum ou0tpt  i3tldfs2uau p ()tlenmoctodfmt anvi;(0s2tmxrpiudam nlieta(  Dtmur ;u0oeeomfeiydfa2eaums (4 ltnir3ty1laD  iei;s0setoxo oydalen nvta(f Drax o;t1oee io3tlsfm2rluvs t4 rxrxo ootfmteau i;s seuoir oudlp  mfvsas sDtmur ;o1aeto fciys m ea(vpnu4 lxrxf3ty1fat  iesls) rurxopny1ameelfeta(f rurum nu0tpto i3ildfs rmumo (4tetrxr3oatoa   ivs s srtmir oodlmeemfcils  2trurooo4oltomfciydfaDrm(mp u)teeomfctytlaDrli i t s2trir iy1lptnlnvil( sruaxmp;o4olxomfctatfaDranvo;t4 rxoirctadlmt aivo s)t2xm(mpou1lm elnctat)srumx  ou1aleo o3tltfs ulnvo;t4tlxoxrcoa1oate uvo (0 rtr(r oo1olee icslt aDumx p;t1oetoioeiasfmDemn snt)tetnmf iydlp rai o t) 2to(r iy4ol   ivtl(faDraxm ;o0tle  ietytlm um(mp;(4 eeoxrcty1opDelues t0tetoio3oo1ll  mnvsasfartr(m ;t4olxnmoeiltfm2uaumonu0 ltrmo3iotoaD lu sls texo(rpoo1lle mietl() Durum nt1apx if3iatfm rlums;t0 lxrir to1omtrluvs;t) rtr(o3oo4apenlncsa(f Dumxmoou1texoio3ildlaDrmuvp t0arenmr3tytfmDr uvo (0tetrim oodam emics t  2rau o;o0tet  o3iad sDuln o (0arxnio3ia1fptraiei;(0 2tmio no1olte nvtlsfarumxm ot1apt  i3tydlsDua( snu)alxoiocta1lm  anes s)s2uoxmpio4ll emfcs s aDrrxm ou4optn octlslm ra(vpnu0trerxr3ia1laDrlnei (0 etmir3ny4al e ivsls sDtr( ono4aee  ieiys sDelu p;t0aexnxo3ootop elivo;s) 2uo(r oo4op   icsa(fs2rr(mpnu0ale  fctlt m2elumonu4 exoxo oa1omte neo;()trtr(r3oydaptnmfctas  rrr(rp;t1tee mfetyd m emnvsnu0artrio oatfa eln olt0srumxm oydoleelnvta(  Drmxmpnt0tptomi3iyt s2uan o u0 rxrxr todop e ivol()t2xoxr nu4lme  netlt s2rmumoot0tetn ieiyslaDeanms;u) ltnio3iytla raieols trumxrpiy1omtnmics (fa2rm(mo;u1oex  feiysls uan on(4alxrmr ia1oateauei;(0truoio nu4omenmfeia( s2rmumo;t1alx  octyd a eluvo;()teenxr3oodomt  n s t  rtoim oy4ame lfvtasfaDtrxrpnu4alx  o3iadfm rau snu)altoxo3todlaDeanvs;(  rxmirpiydoleemnctas a2trump;o0teenmoctysfs2rlnmpnt0arenmf3oo1fatraivs t0s2tm(rpoudol elnes t) rrr( o;o1tpxnmoeild a2emnvp;u0 eenmo tytfatrluei s0 rtoxopoodom emnvt s)aDumxmpot4olx mi3tltfs2eanms ()trxoxr tytla  luvi t)sexrxo3nydap e nvtls s2tmumonu0tetn ieils sDua( p;t4trxrif oo1faDe uvi s0sruoirpou1altemiesa()sDtmxmpnt4aexnmietltfsDrmu o;u) renmfcoytoaD lieol() 2xmxo no4ap nlfvta()a2urx  ;t1alx  f3iltls2ra(vs;(4alxniocto1lp  aivsl()setm(mpnudlpeelfetasf Dtmur no4opx if3iyd mDemuvo (4altoxf3ta1lm rlnvs ()s2tr(mpou1apte ictas) Dtrx ooo0aex  fctydla rmumpnt0 eermoctydfp rlivolt0srxo(m no1lm nlfctas srrmur ;o0tpe mieildfaDrm(vp;u0 leomfciadfate ues;t)srumxr3iodoptnlfvi s) rrau  ot1ale  i3ias a2rmuvs;u0tltomo oydlpD  u i;t)trumxr3ny1lptelict t) Dur(mpot1oleomfctydfs eanmon() eenio totfaDraieo (  2urxm3nydlleemfet tf Drmx pnu4tet  o3iatfa2elumpnt4 leoxf iydfpD aivi;t t2tm(m3no1amt mnvia( s2rrxr ;u0alxn o3iatls ea(vs;t)arxomo oa1latrlnvi s0 rtr(r nudlm nmfvils)aDua(monu4tpxn oeild s2rlnms;(0artrif3ta1fpteaivo t0 euo(o oy4alte nvsl( sDtaumono4oee ioetydfaDrl(vsnu)aexnmfciotlatean o t0 rtrxr iudaptnlfvtat sruau ont4texo ieiytlsDumnmp u4altrmocoy1laD  ieo t0s2xoxo iu4lpe lfeilsfartaumpnu0opxomieiydlm ulnmo;t0tetrxrcoydomDrli i;(0srurir ou1apeelietatfaDra(rpot1aexnifeiadlsDuln ont)arerif3oo1fmDr ieslt)t2tmim3oudol nliesatfsrumu p;t0olx ifctatla2umn p (4trtrmr oy1fa eanvs s t2trxo no4lmt livtatf rtm(ro;o0aptomictldfaDuau o;t)tltnxf tadfm  anvslt)t2ur(mpoodapee fvi sfaDtm(moot1opx if3iytla eln s u4 lxnxo3iydlm  li i t0srxrio oo1lptnlictls) Drax  no1tpenii3tld a2rmnvs;t0trerxr3iydfaD lu i;s)srtmirpoo4op e fvt tfarurxm nt1opeo feiytfa2rl( s;()tltnif oy1fmD  uvo;t0s2toim ny1lme mieslt s2taxr oo0altnmoetyt s2umumpnt4aeeoxfciy1faD aneo t0 exoxm io1op e neias)arrmx  ou4aet io3tyd a ra( p (0 reomocoa1faDeluvs s0texoir oo4oltn ivta(f Dra(m nu0aex iieiyslm2eauvp t) rerxf io1optelivs t0texo(o3nydam nmicsl( a2raur nt4ape  oeiasfs raums u0teenmf3tydopDrlneol()trxrir nydom e ivsls)aDta(mpoo4oeeo iciytlm rmnvs;u4tleoxo ia1op e nvi;(0trtrimpny1lptnmietls sDrmu o;o1tle ioctatfm2elnms (0 rtoxo iadlmD ln s;t) rtmxo3nodom e netas  2urx o;o4aeeniocild m umnmonu4arenifcoo1la  livo t srtmir oudlpeemnvtl() 2rmu ont0olt moeiydla umn s;t)tlxnio3iadop rln o ( s2toio ny1op nlnetat srurxm ;u4olx  fctadfaDrmnms;t)aeenifctydlpteaivo ( teurxopiudope  ivil(f 2rru  ou1oeen f3iatfs2ulump;u) exoio ta1lmtrluvo t teuoirpiodap nlnvsltfarurx  ;u4tpeo f3iltlm ranvsn(4aleoxfcio1fmDrlu i;t0t2uo(rpoo4lpt  icsls  Durumpot4oexomoeildfa eau on(4aexrmocoatlat an s;t teumimpiu4omtnlietlsf Dra( o;o0apxnmi3ilslaDuanms u0 eeomf tatomt li sls0seuoio iy1omt lfci tfaDtm(  ou1aleomf3iatlaDel(mp;t)artnio3ta1omtranvi;(  rxrimpno4lpte ict sf rtr(mp;u1tlxomfetat m2rau pn(4teeoxfcoadom eaivo (  2ur(opiy1lltnmnetlt)aDumxrp;t1oltnmictytfaDulu o;()arermr3oadlmtran i s0 2xrxrpiy1opee ieta()arrr(ronu4altnmiciysfs rmuvon(4artoxocoytlpDean olt teto(rpiy4om  mictat)s2trurp;t1alen fetyt m2uauvo t0trxoif3iydom  aivilt trxr(rpoy1om emnesltf rrrx onu4aexoiictydla2rl(msn()trerircoatopte ieo;s s2xoxr oo4llt mnetl(fsDtaxroot0altn fciyd m uaump;t)alxrir to1omte nvi;t t2tm(o ny4omt mnvtat)srraxmonu1aex mfciydls el( s;t4artrxf3iotla elivils  ruo(opiydope  icilt) ruaumpnt1ole  ieiasfmDelumonu4aeeoif iydopt an s;() rumim iydoptnlnvi t sDrrumpou4oexoiictas mDemnmo u0 etrircoydopt luei;s t2xo(r iodolte fvils)srua(  oo4aee mieiytla2elnmo (4 leomr3oo1fatrln sl(0t2tr(r iy1ll  mfviat aDum(roou4olto ictld m ea( s;t0tleomr iotla  ln o;s)srxmxo oodamenlicslsfartax pno1teen octytls umuvsnu)trxrxrciotlmD  uvs;s0 2umxr3nudoptn ict t)artm(ro;u0apto ociasls2eaumo u4 etrxo3oadlmD  i ol(0 rxrir3nodal nmnvta(f 2tmumooo4alt if3tat a2eluvp u0alerxo oatlaD li ilt0srxr(mpoodoptnmnctlt) rtm(ro;o0tpx ioeiyt s elnmo;t0tlxnifciytlm  ai sls0 2uo(m no1lp nlfctl(f 2taurpno0tetn ictatfa rl( s t)aexrif3todop   n s (0texmiopiudalt  nvsat aDtmumont1tptoifetysfsDrln sn(0tleoxocoodomte ueols0s2xoxo3io4opeelfcs t)arrr( ono4aet  f3iatlmDra(vs (0artoxrcoo1optrlies (0texoxm3oy1ll emfctat)artmxront4tex ifetysfs2um(mp t0tlxnxr3ia1fpt  u o s t2umxrpoo4alte ivi t) rtmx o;t1tpx ioeiytls ranvo t0 rxomf oadoa   i o;()truoxm oodop  lnvt (fsrumxmpoo1oetnmfciltla eauvsnu) lxomociytfp rlu ils) rum(m io1am nlietl( arumxm ;o1optnmieiyd a ra(vo;u)alxrir3iytlaDranei;s)setrio3oudoltelict (f 2ua( o;o0opxnmoeiysla2um(vonu) etnio ootfaDelieo;()trxoxm3iy1lme  fvilsf rtmx  no4tpx ioetltls2ulu p u)alxnif io1om r ivi;s setoio3nu4alt  ieilt) 2umxr nt4oeeomieiydfmDranvo (0alenmrcio1fmDrau o s trumxmpnudopee fvs t srrr(  no0aeeomfetydfaDel( pnu0 eeoxr3tydfmD  i i;t seto(mpoodllen fci () Dtr( o;u0alto fcilslmDul( snu4tltoio oadfm  lnvsls0teumxr nodole mnctls) Dtr(r ;o0optnifeiydlm rlumont4tleoircoy1laDrln o t0setr(o nu4op n fct t arrmu oou4ape ii3tytlm2umn snt4 eenxf3ootoa  lu o;()s2toxr3iu4omenmnet tfs2rr(  ou4opx ioctysfsDra(vs;u4 exomr3oatlaDeaueo t0srxr(rpiy1al e iet ()aDtax  nu0tpt mi3iad a raums;u0artomf iydlp rli o s trxrio3nydal   fei tfa2uaum no0ale ioeiyslaDemnvo;u0 rxnxr3ootfa rlivi ()sruo(r3nu4olen nctat) 2rmxr ot0aleomo3iytfaDul(vo;t0tlxrmrcto1fptrln i t0trtrxr oudam e fvsls)s2raxm ;t0alxo i3iltfmDeau o;(4altnxf to1laDrlieslt)sexr(m iodomte nesa() 2rr(mooo0aee iociltfs ra( o ()tlerir iytlmtraies (0texmxo oo1al  mivslt  rtax pot0olxniictytfa ua( o (4alxomr oodlmt auvo;s0 exrxm no1lp emncslt)artaur no0tltomietld mDrlu p;u0 lerifcta1lmt auvs s truoiopiydolee fcsl()srtau o;u0aetniociyslm2rm( s;()tetoxrcia1la r i o s) eto(m3nu4lle mfvtl(fsrtru o;u1ole  ietlt a2eanms u) rxrxo iy1latr nvs;(  etoxm3oy4al nmics () Drau  ;u0opto ieiatlaDrlnvs (4trtrifcty1lpD auvolt0 2uoimpoydop e nvs t)artaxrp;t1opeoiieilslm2emn p u4altrxf3oodfpD lu o t0s2xmir nu1lmte ict s  rumu p;u1optnioctat a elumpnt4 exomfctytopDraieslt0 rum(r iydamtelfcs tf Drax pnu0oetomfeiaslaDel( p (0 lxoxr oa1laDeaues;s tetm(opoy4olen ncs tfa2ra(rono4olenmoetysfa2um(vo;u0texrxfciadfm  au ol( t2tmxr3nodapt  icsltfarta(m ;t4tee miciasfsDelumo;t0aexnmf todlmt  n ol( truo(o iu4olt mfeias)aruau p;o0oltoiociys m2rl(ms;t0 lenmf iodfp rlnei (0 rxr(mpnydapt lnvtatf Dtm(  ot0oltn fciysfaDrl(vonu) rtnmfctodopte u ilt0setrim3oydol emnvsltfa2urxm nu1tpt moctydlm2ranvpnt)alenmf oadlaD aivs ()s2um(m nudole lfcsas s2raum no0tpeo fctltfaDra(mpnu) eenir3oadlaD lnvo;(  2toxmpny1lm nmfeilt) rua(rono4tlto ociasfs2ea(vpnu4artrxrctatlpDrli o;s)sruoir ou4lle mnvt (fs2rmu pot0apxo iciltfm um(vs;(0 lenmf3oy1la elivo s s2xm(r3ou1am elncsl()srtaumo;u0alxo o3ildlmDul(mo t) etoio3oa1fp r ivol() rxm(m3oo1om  mfctl()aDur( o;t4apxniictyd mDua(mp (4 rtnmfcoodfpteln s t)t2xr(m3nu4lmtnlfvias s2taxro;o1apeoiiciydfm rmnvp;t0 lerif ia1fpD lu s;t0 etoxmpny4apee ivtat a2tmxm nt4tetoif3iysfs em(mp u0tetrmf tydoptr uei;t0t2umiopno1olte fctlt)aruax pnt1tpxn ictadfs2em(mp u0tltrxf ty1op rauvo;s)sexmxo3no4apee nesls)aDraum ;t4oltn f3iltlsDrauvp;u)alxomo iytfm  ln i ( trurir3oy4lpen ieilt) rtmx pot4olto o3tytfaDrlu p t4tltrxr3iy1lm  lieol(0srxrirpoy1apt mfvtltfsrrr(rpnt4openmf3iyt m eln o;u4 rtnmo3tytla e ivs;(0s2uriopiy4altnlnesasf 2um(rpno1oexnioeiadfmDuln o;(0 ltrxo3iodopDraieo;s0t2urim nydoptnmfetasfsDrr(rpoo1alt mfciltfmDuln p;t0areoxfcoydoaD luvs;s) rxoirpio1ll emieilt  rtax  no4apxo fetldla em(vs t0tleomf iotlaDraueo;s  eumim no1lpt lnvsas  rrrxmo;t4aleo ieiasfa2ranmo;(4tlxnxo ty1opDrln s;t)srur(m oudapenmieia( s2tm(m no4apxomoeiydlm2um( p u0altrio3to1la r ieo s0s2xrir iy4alt lfei (fs2rmu  ;o0teen ietas m eln s;(0aeeniociodlp eaiesls seur(rpou1ape miesl( aDum(mo;u0tpenif3tat mDelnvo;u) rtoxfcoy1lpteanei;(0s2tm(m nydapeelfcias) rraxr nu4ole iociadfm rl(mon(4arxrifcio1fpteaueol(0 rxmimpnodamt  ictl( s2umx pot0olto ieilt m2uanvp ()tltnirctotom eau o t sexoxopny4lptnlfeil(f rua( pnt4tpt mictatfm2ua(mo (4 rxoxr iatlpt lueil() 2tmxmpiodamtn fcsa(fsDurxm nt1olenmi3ilslm uanvo;(4trtnif3oadomDean slt) 2xm(r no1am n icta(  2tmxmp;o0alt  octas s elnvs;t0altrxf iytomtr uvs t) rxoim io4oltnlies ( sDumu ooo1oexo ieiydfm2rmnvp;t)aetnio oatopDean i;s)s2xmxm3nudoleemncil(fs2tmur ou0tetoifetadls ua(vpnt0 lxoxo3iytfaD lnes s0srxoxr3iu4op   ncsat) rum(mo;t4apeoiieiydfaDeau p (4tltnmr3tatfatelnvolt srto(mpoy1openlnctatf Duax  ;t0ale if3iatfm rlnmp;u4 rxnxr oodlpDeaneslt) etrir no1ol emfvi () rumx pno1texo oeilt aDua(vont0altnmf iydoateaneo s0t2uo(r3ou4altn icsls)aDrru  ou0tlxoio3tldfm rmnvs u0 renmr3tydfatelnvolt t2tmir3oudal nlfvslt)aDuax o;t1aeen iciydfaDem( ont4tlerxrciodfa elnvs;s sruo(m3nu1apenmfctasfsDtm(mo;t1oltomoetltla emnmpnu0tleoio tatlate i i;t)tetm(opiydlltnmivias arrr(r ;t4alenmfciyd a emn o (0tltoiociodfatraivo t0 eurio3no1aptelivtlsfarurxrono4aetn iciytls ua( s t)tetomr3oy1fa e nvs t setr(m iy1alen neiatf 2uax  no1tleoiociysfm ua(vo;t0arxrxf iadlmteaies;s0t2trxopiu4lm   nesa(fsDtm(  ;u1apx io3iat a rmnvo ()tlxrmrciotfmtrln ol() eurimpoy1omeemietasfsrurxr no1aexn ieild s2uan p;t4trermociy1omteanes;s)trxoxmpoo1ame mfei tf rraxmoou4texoiiciadfm2umn ont)tlerxr3oodfpDe nvs t0sruoir3iy4ol n fvt sfs2rmumono1tptn ietld s rlumo;t4aetnif oo1fm rli o;s0t2xriopoydomeelivia( aDtmxr ;u0oex iociysla2rmuvo;t0teeniocoydlp r uvil(0s2urirpiy4llt mfes () Dra(rpou0alenmi3iydlmDeluvo;t4trerxfciatopteanei t s2tr(opou4al elnvils)srrr( pot4oet  f3iysfs rl( sn()trxriocia1fpDr n s t0srtrxm3nodaltnmnct ()a2rmur ;u4apxomi3tls m rl(vpnt0arerxfctotoa  au ils  etoxo nu1apt mfct (fa2rau  nu1tlenifeildfs2ra(msnu4tltnifctodfa  auei;s trtm(opoudoltnmncsls) rra(m nt0oetomfeilsla2umump (4 etnxr to1fmtraieolt) exrxm iudomt lieia( sDtmxrpou4optomfeiysfm2ranvs;t) lermo3totlateau i;t0 rtr(opou1opte nvi t a2raxronu4oee mieiysfsDemumpn(4trenif oo1la eluvols t2xoxopnu4amtn fci t)a2rmxrp;u0texo ociasfsDeluvpn(0 etomrcoodomD  u il()t2xm(r3iu1optnlnvilt srrm( pot0opxnif3tysfa2eln pn(4alxomf3tytlmD lues;s)tetrir oo1ol elieiat s2umu oou1tetnmf3iyd m rlu onu) etnmoctotfpDe neo;s s2xmxr3iodalen ivsl(faDum(mo;o1apto feiydfa2ua(ms;t)trxnmo iydlaDelnei;s0seuriopny1lle mfvi (f 2uax  ;u4aet  oeils m uluvp (0aetrmo to1fatr uvslt)s2xm(r oudll emivtas)srrau o;t4tlenif3iydfsDumu s (0 rxoxo todfptr uvs s  exrxmpoo1amenmfcs (f 2tr(r ;t1texnio3iltfsDemuvs ()areomf3tadoateanesls0setrxm ou1omtn fetl(f rrr( pnu4aexo f3ilslaDrluvsnt) etnif oa1oaDr n ol( t2trir3io1lm emfeias)srua(mo;u4aetniociltlm2eau p;(0tlenir oytlp raues s  rtoio nudlpee ietlsfsDtru  nu4texnii3tld mDrm(von() etnmr oo1faD  ivil(  rumim no4lmeemfvsasfsrua(  oo0tetomo3iatlaDea( on()trxnir iotla  ln i t0trtmxrpoy1omt miviltfaDurxrooo4aeeomietytlaDul( o;t0 leoxo todoptelu il() rtoxm ny4lpt lfesa() Dtrxront4olenmiciasls el( snu4 lxoif ia1lpDran o;t0 2urirpoy4olen fetas sDtm(mp;u0oexn fetaslaDrmu p u4 rtnmf oadomtrlivilt)sexmiopny4ap nmiei t) 2umxrpou0altnifeiltfaDulump t4 eeoiocia1lp  lu s;t0trtrxopnu1opt lfvsa()arur( ono1teeomfcilt mDul(mpnt)altomf3iy1lp  lnvi;(0setr(r nodol  licil() 2rrxmooo0teenmo3iaslaDel(mpn()arermr3ta1omt aivi t)texrir oo1olenmicsasf 2rmurp;o4apxn iciltlsDrmnvpnu0texomr3io1fmtrauei s0 eur(r3ou4ameemictatfa2uru oot1tetn feiysfmDumumo;t)artrxo io1fp  an sl(  rtr(o3ou4lme liei ()s2raxm ;t0altoiietas m2eluvo () reomr3tydfpt ai i;t  etrxo oy4apeemfvtas) Dtm(rpot1texnifetlt a uanmsn(0trxnxr oy1opt lueol()s2uoxr3nodam n nvsa(f 2rrurp;o1olt  ieiasfmDeanmpnu4trxnir3oodopD ln o s tetmir oo4omtnlies (fartr(rooo4tlxoio3iadfmDulumpn(0arerio iadlmte i s;s0trtmio3io4lp nliet sf 2uru oot0tpeo octldla um(mp;t0 eenxo oydlaDrlnei;t)s2xr(r3nu1lltelfetasfs2ur(r ot0tpxnmicilsfm eluvs;(0 rxoir3ia1laD anvs;s0t2urxopiydaptelnei s) rua( ont1opx mieiadfaDra(vo;() ltrxf todoatrln s;s  rtoim no1ll  lfcsltf 2ua( pot0oetnifciltfa2umu s ()tetoif3oa1oa e uvo;()teum(o iy4om emfvia( srta(mpoo0apeoii3iat a2ul(msnu)trtrxocta1oat aivsls)srurxm3iydap  mivsa(f 2tm(mpnu0apxnio3ilsfmDra( s t0aleomfcoa1omt  uvslt)tetm(rpio1ol  licsl(fa2ur( p;t1apeoif3tad m um(vp u0aleoir tadfmteln ol( texoir3oo4apenlicilsf 2tmump;o0tlxnmo3ildfa2rmnms t4artrxfctatoa r iei;s sexrir3ou1lm   ieta() 2rmum ou1tex ifctatla2uau s;() rxoio tadopt ln s () euoxm oo1lme mics s)arrrxmpnt1tptoifetltlm2uanmo;()alenxf todfa  lies;s s2toxm3iodopt mnetat)aDumxrpnu1oetn octatls uanms;(0trtoxo3tytfateaieils0seurir3ny1lm e ivtas  2um(mp;t4aleoiietyd sDuaums;t4alxnxo oodlpte nvi s)seum(m3oodom e ncs ()sDuau poo4tetnioctyt sDelnmpnu)areomocto1fmte i i (0s2xrxr3oodal  lnei s)sDtaumonu1tpx mi3iadlsDem( s ()aexoxr3ta1opt au o;(0 2to(r oo1optn fvil()srtm( ont1oeen f3tydfmDumu o;(0tlenmo3oydfp e uei;s0seuoxopiu4llen icta( sDrmx  nu1altomfciasfm ua( snt0aexnxr3oa1fp raiei;t) exrimpio4ope mnet s artaumpou0tex mictlsfs2rl(mo (4 reoxo iydlptraivi t) 2uoxo nodlpe mfetltfs2rru  no1apeoioeiadfm ul(vs t0 ltnxf3io1lpteaueols0t2toxrpio1ome  nvsa(farrmxmo;o4tpxn oetydlmDulnvo t0 ltoxfcoa1la   n s;t0 exmimpiudoptelictlt  2taxr no4opto oeiysfs2rlnvp u)arxoio iatoa e nvo;(0t2urirpny4apenlfetat  2urx  ot0olxomietytfs2ean o u4 etrmr iotoptean i;(0texmir nu1ap e fesl(fa2uru poo4oee ii3iatlmDulu p u)alxomf3iodfp r uei;(0s2xr(o3nudlp  mfciat srtm(rp;o1tptomfetyd a rmnms ()tltnmo oy1oaDelues ()sexr(rpiudopt mnctl()srumumo;t1apeoifctad mDrlump;t) lxrmocoadom   ivi s0texmir3no1amtnlieia( arrr(mpou0tex moeiysfs raums;t0arerxrcoodfa raueo;t0s2uo(mpny4aptnlicils)srumxrpno0opt  i3iltls2rau pnu0texoir3iytfp elueilt  eurirpio1alee feta()aDrm(ro;t0oeeo fciatls2rau s;(0arxrmf tadfp r i o;(0 2to(r iu1amen fetlt a2raxmo;t4teenmiciadfs rlumo t)trtrxocta1op r u s;t0sexmxr iudlptn nct s arrmu poo0altomocildfs2uanmo ()altnxo iotlat ln il( srxrxo iy1lm nmivt (fsruax ont1tpt mf3iys m ean o;() etnxo iatoa   iei;() 2xmxmpoo1lmt lncia() 2tm(rpnt4opxnifciydfs uauvont)tlerxr3todoptrluvi;s texmxmpno1oleemnvsa(f 2taurpnt4apenif3tltls eanvs;t) exomo iotlmD  nei (0t2to(r oy4ame mnvslt)a2taxmpno4tpx ii3ildls elump;u4arxrmfcia1lm e neilt)teuoxopny4oltn ivt sf 2umxro;o1olx ifetls sDrmumpnu0 rxnmr3todfptr uei;(0trtr(r oo1open ivs ()aDua( p;t1alx moetasfaDrluvp u)tleomocta1fp  livi s0 rto(opiu1lle  fvias) 2rm(  nt1alen o3iydla2el( o (4trtrxf3oytfmte n i;()t2tmio3ny4oltn nesl(  2ur(mont0texnmictld sDrlnmo;t4altrxr iydfp e nesl(0seuo(m3nodamtnmictat aDra(mont0alxo i3ilslm2umu p t4arxrir oo1fmDrai o t tetoim3oodlmt lnctat) 2ururoou0tptn fciyd s rm(mo t0 leoiocoydfm   nvolt0texmxr3iu1lleemiesa(farur(rpnu4tpe mfctat mDemuvs;u0trxrxf3iotoa e uvo;()setoim3iy1ope mnct tfa2umx  oo1oltnmictld m uan o;t4tltrir3todfm eauvo ()tetm(opoodomtemietlt)s2umx  ;o0oexnmicilsfa2ul(von(0 lerxr3iodfmD livo t0s2urxr no1lm elietltf Dtm(root0tpxn ociatla2elnmp;t)trxoxocoadom eau il() etmim3oy1ameemncia( s2rrxr ;u0teto o3ildla eaumpnt0aexoir3iodfp e n s;( srtm(mpiodap e ies t  rua( pnu4oetn oeiltfs umnmpnt0teenmo3ootomD aneo ( srxr(mpoydlp e ivta(  ruaxm ;u4tptnifeiydfs rau s u) etrmfcta1fptrlnvil()trxo(opny4al emnei sfa2umumoou0teeoiociyd m2uanvo;u0alerircty1latelu olt)setmxrpny4om e ncilt s2urx pno4ole iiciatlmDrmnvs;t4arxomrcoo1opDraiei (0t2uoir3no1ome  fvilt arrrx pno4tltomieiatls2eanms;(0 ltrmr ootoatr nvo ( t2trxm oy1aptnlieils a2rmu onu1opto i3iys s2ra(mon() rtomo iotfm  livs t)trxmiopny4apenmiesa(fa2tmxmoot4oltomoetyt m el( s () lxoifctodlmt  neol( t2ur(r3oo4lmenlnci () rururpou4teenif3iadfmDra(mont4artoxfcoydfpDeau s;s s2xoir ny1al nlfvil( s2umu p;o0apx mf3ildfs2emn s () rermo iy1lpD livo ( srtmir3oy4lpt mfciat a2trxmo;t4oeeniociat a2ul(mont4arxrxfciodoaDeanvs s)texr(r nu1altn neilt  Dtm(mooo0alt ioetat mDum( p;t) renmo iadomDeluvslt)s2ur(m oo1lme mneiasfaDuaxr no0olt  ieild m2eauvpn(0 ltrif tatlptrlivo;t)t2tmio3nodal  mnetat  rtrx  ot1aee mf3iadfm ranvo (4trtrxr3oo1fmDeli o s0trtmxmpny4al  mnvt sf Drm(mo;u0altoio3ilsfsDuau p t) rxomfciydla  aivo;s0trxoim3ny4omt  ici s a2rax pnt4apen oeiyslm2ra(msnt)trtrxr3iodfpDe ieils setmir3oy1aptnlfet tfs2tauro;o4oex  o3tadfa umn p u)teeoif oytlmD ai i ()trtm(o iodamt  ivta(fsrtm(r oo4aexniicilslmDumnms;u) exnmf tytla ean i;t t2uo(o3iudopte ies sfaDtmumoot1aexoiiciat a2ul(vp;t)trtrmo3oytlpteai o s s2um(opou1ap nlics s) ruaur ot4olxomf3ias sDemn o t4aeeomf3iotoatean il( s2xo(r3oudoltn nvtls sDta(mpnu1tetoio3ias m2ulnmpnu0trenxrcta1lm   nesl() 2tr(mpoudlm  mfciltfs2rmu pno1tleomfetytlaDuln s;t0arxoif3tatoateaivslt0 ruo(r3iu1ape lfct ( sruax  nu4ale  fciyd m um( snu0 eermo3iy1late ieilt)texoxm iudamt  fci t  2umum nt1aex iietydla2emuvo;t4arermf3todoaD  nes;(  eur(mpiy4lpeelfesltf Dumum ;t4opt  iciyd a2ulnmonu0 ltnmf iotlaD lnvi;s0 eurxmpio4ll nmfesat) Dtr(  ou4tlt io3iasfs2umn snu0aeermf3oadomD  iei;( sexo(m io1lmtelnvt (  rrmx onu0oltomo3iytls2em( p (4 exrio ty1laDrli o;(0s2urxrpnu4lptelnvsls aDrm(moou4openmieiadls umuvp (4 rtnmo tytfmDr ivo;t)trtrxr no4ol  lnvs s a2uaumpno4oetoiietad a2umnvp;u)trenxr3tatfmD lu s;t0 rtrxm3iydome lfct tf 2um(rpno1aleoii3iyd aDumnmo (0artoxf3tadfatr i i t0trxrxm3io4llen fvsltfa2rmxm ;o4apxo i3tls sDrl(mp u) lerxo3oadoat  ieo;(  ruo(r3oy1omtemfvsat  ruau  ou1oee iieiytlm uaumsnu0areoif3oy1omt an o t)trxmxm nodlpe liei ( sDurx o;t4texomociaslm2uanvs;() lerxo3oodlat  ieslt0trurim3io1lptelivtlt  2rmxmp;u4oee ifeilt m2rl(mpn() lxoxr3oo1lm r u i;s0 rxmim io4lpeelies ()sDrrum nu0tee  fcias sDulnms u4 ltoir3iydfa   uvs (0s2to(o3iydlmenlfvtl()sDuaxrpnt0apx iictyd m2rmu s (0 lerifcootlateln ilt0 2urir3ny1ope liei s a2ta(  oo4texnii3iyt s2elnvonu) lxnmr ty1oatrai ol( texmxm io4aleelnvils) rum( o;t0apt  o3ilt a ranvp t0tlxnxr tatoateai sl( s2uriopou4altnlicsas)sDrmumonu4oltoiieilt sDrmuvs u)tetnmf iodlptean il()s2trxm3io1ameemfctls)s2um( pot4apxnifciys m2emnmon(0artnir oatom r i o t t2ur(rpoo1op  mfet (  rraxroot4tpx mfciltfaDua(mo u)aetnxr3iy1fpD lieo s t2toxm3oudope mfvilt sDur(mp;t4tpenif3tasfm2elu pnu) ltriocoadfmD  i ilt0s2tmio oo4omeelictatfa2ta(r oo0oeen icildfa emnvo;t0 ltnxrctatlm e i s t) rum(m oo1alenmnvslt)aDurumonu0opx mi3ias s rluvs u4altrif3iydlp eaueo t)teurxo nudlp  lfvilt  Dtauro;u4oex  ociatfs rm(vpn() etrifciadfpD  nei t) 2urirpnodapt  fci s s2tmx pot0optnmictys sDrm(mon(0arxrxr3ty1opt  nvilt setr(r no1ome lfvil( artmxr nu1opxniocildlmDulumo (0artoio3io1om rlueo t0srxrio ny4lltelicia() 2tax pot1ole mf3tydfaDeluvsn()teenmr iytfpD lneo;()setmirpoy4lptn fetl(  2uaxm nt1apeo feiasfs ua( s t4aetrmf3iy1oaDraieol() eto(r3iy4altemiesa(faDum(r ;u4tleo ieiad m2emu p t4areomfciodfpD li s;(0trtmio3no4ap emivtl(farrrx o;o1aeeo feiadlm rmn p;t4 etoxocoadlaDr ies;(0seuo(o3oydlpeemnctl(f 2raurpno0oleomi3iyt m emnmo t)aeerxocoatfptrauvs ( srto(o iy1al nmncsls arua(moou4opt mf3iatfsDea( o;u4arermo3oa1oatrlu s;()t2ur(r oudole  nct sf 2umum ou0texomi3ildfa2ran o;t4texomfciadfmDelnvo (0 exm(m3oy4aleelnvi (faDur(ronu0tlx  o3ildlm2uaumsn(0 renxr ta1lpDr nei ( setm(mpny1op  mivias) rtr(rpno0teeniietltls el(vpnu4aeenif ootlpt aneo;s)t2umim3oy1lp n icias sDrmxrpnt1oeenmieilsfm rmnmp;(4 etoxr oydoaDraneo;t0tetm(m nudaptnlicsl(fs2uaxront0opeoio3iyd aDrmn p (4trtnxr3iodfm rai o;t) eto(o no1op e fei (faDum(  ot1optnmictasfs2ea(vpnu4 etnmr oatlm  aieols0seumxr iudlm emnvsat) Drmxm ;u1ale mf3ilt aDuauvo;u)tltrmfciodfpD li ilt0trtm(rpoudomt liesl(f 2umxr oo0oeen oetad a2uanvsnt)aeermo todlmtr ueol(0seto(opoo4ll   ieil( aruau pnt1tptnmi3iltlsDeanmon(0treomf3iotfp e n s t s2tr(o iu1ol elics t  2rmxmp;u4alx  ociatla2ua( sn(0 reoif tadop  lu sl(0 2xo(mpnydll  mnvtlsfa2rmu  oo0aetomoctld s eluvo;t)alenxf ootoptrlnvi (0sexm(opiodop emics tfa2trum ;o0tlto o3tysfa2ul( o;t0 ltriociodom elu o;s0seuo(o ou1oltn fvsl(  Dtrxmooo1tpenif3tyd m2emumsnt)tlenmr ia1om r nvslt s2xoim io1lltnlfes t artrx p;u4opxnioeiatfs2rm( o u0arxoio3oo1fmteaneo s sexr(m nu1ope mfvt t)srur( onu4oexoiietasfs rau pn(4 exoxrcoo1lpDe ivo;t) exoxm3ny1altnlivt s)s2um(m ;u0teeoiictat sDea(vsnt)tlenircoodlatrli o s t2tm(mpno4alenlfvt tfsDrrum oo1tpxn ieiltfsDulnmpn()aetomo3ootomt luvol(  exrxopnu1lp nmnes s)s2ur(moou4alxnmo3ilsfmDuau on(4 leoio3iydlmD aneolt)sexo(o oo4amtemicsl(f rumxrpoo4tlxnmieiyd m umumo ()trtnxo3iy1oa   nvs;(  rur(rpio4lm e fcsls)arurxm nu0texo ieildlaDelnvpn() ltoxf3oo1laD  ivslt0srtoio oy4al   netl( s2uaumonu4opxoiietltlm uanmpnu0 eerio3ta1laDelueil(0teurio3ny1lpt mietat)s2ur(m ;u0aeeomfeiltfm2elnmp;(0alenxrctotfmDe i s;t0seumxm oo4alt lfvtatf Dtaur ou0teeniocildlm2ra( s (4tlermf3iodlmDrluvi t0srtmio3iu4olt mnei t sDururono4aex mfeiltfs2emn o u4trtoxrcoy1lm elu il(0 exrxm iu1llenmivsa()s2rm(  ;u1opeoifciyslsDra(vont) leoxo ia1laD au i ( setrirpio4altemfvslsfsDurumpno4olt mo3tadlm2uaums;t)arenxr3oytlp r i o t) 2um(m nu4op elfeia() 2tm( o;t4olen feiys mDuanvonu4 lxoxfcoodfp elivi;t  eurxrpiu4amenmfet sf Dtmx  ou4oexoifcilslm el(vsnu0 lenxr3oodfmtelnvi s0trxmio3no1amenmfcsat) 2tmu p;u4optomiciysls rmuvo (0 exoxfcoa1fpDraneo t  2xo(opou1altemfci s  rra(m ot4apxomi3iatfmDumu p (0trxnir ootfaDraivs;t)tetrxm nodlp elnvsls) 2raxmpno1aexo fcils mDranmp () etomociadfm r ivslt0srtrxo3oydapeemnviltfs2ua(mp;t0apt  f3taslmDran s ()artnmo iy1fp e n o;s)teuo(r iodomenmfct (f Dumum nt4optoii3iys sDea( snt4 rerifcia1fmtr uvs t0 rurxr3nu4altelfctl()arrrx pot4texo fciysfa em( s t4teenxf3todfa r ies;s srurir iu4apenmietat s2rmxr ;o1tptn fetld aDuaums u4 lermo3tadlmt au i;(0 exrxm io1aptn ivsat srua(mooo0opx  iciyt sDumu s (0artomrcta1lmD li ols0sexm(o3nudop  mneiat)arta(mpnt4aetnmiciatfm rm( s;t4arxoxocoy1fpDrai o;(  exmir3iu4ole  icilt)s2um(rpnu0opeoio3tls a elu onu0aeeoiociodopteauvi (  ruo(m iu4lp  liesls s2rm(mpou4tlx miciyslm2uanmp;t0aeenxoctadfmDeaues (  2xr(o iu4ap nlnvsa(  2trumo;u1oexo octydlm rl(mo;() eeoxocta1oateli sls0 exmio3iu1lm nlneiat aDrrx  oo1aeto fciat m2emnms (4treomf3iadopDeli i s  2xmxm oydomenliei ()aDua(mpnu0tlto feilslaDel(vsn(4trxrmf3iotfmtraieo;s  rtrio3oo1lp emieil( a2rmum ot4alt  i3iydfm ranvpnu0arxrmr iadom r nvil(0 rxoxr io4lpe lnes s) Dtau o;o1apxoifeias a2ua(vo () lxnmf3oytfmt  nvi;s0srtoir3iy4lm elnvilt srtrxrono1aex mfctatfm rm(mo t0tleoiocty1oaDr u olt)s2toxo ou1llee nvia(f rraxmont1altoioctat sDrl( p;u0tltoxo3to1lptr uvo;s) 2trxr3no1al emncilsf 2rmx pot0tpen f3tlt m2rlumont0 lxomr3iotom ranei;t0tetmir ny1ol  mnct ( srrm(ro;o1apx  octlt a eauvo u0areoircoatfmt livi t0s2uoxr iy4ope lnvs s arurum ou1tpxnioetld s ulumont)aetnir3oodfatrau s t t2xm(mpoo4lp  li
\ No newline at end of file
@@ -0,0 +1 @@
+u i;t  rtoir oy1oleelnci s  rurxr oo4aexo ietltlm rlu o ()arenio iodlmt lneo ()srurio oy4amt lfvt s)sDrm(mpou0oltnifcilsla2em(vo u)alxomf tydlmD livslt) etmxm no4aptnlnetl() Drrxmooo4oee mi3ils s rmuvs;u) eenmr oo1opDrlivi s)t2ur(rpiu4ole mneslt srrru  nu1tee iictytlm ranvs u4texrir iatfp rau s;t srxrxopnu4op nmicsl( sDuaump;o0apxnmoeiytfm eluvp (4altnmr oydla eanes;t)srum(r oudapt  fvs (fa2tm(mpou1tlxomo3iltfs elu o;u4 etrif tytlatrlivils sruoiopnu1op elivtas srtmxro;o0texoiieild s2ul(ms;t) etrxocty1lm eli o t  2uo(m oodop  mietl() Drmx  nt4oetn f3tltlmDem(mo t4tlermrciy1fptr nesl()texm(opiy4ll nmfvsa()aDtr( onu0tle moetydlsDem(mpnt4 reoir iotla elivs s)trtmir3iydoleemiet (fs2ua(ront0ole mi3tyd aDeau o;(0trtnmf iydlp rluei (  2urxm3iudop   nviatfsrrmur no0texo iciad m uluvs (4aetrxf ta1op r uvsls0t2xo(rpoo1op  mfcia(  rrrum ;o4tlen f3tytlsDranmpn(0 rxomociotfmDr i slt)teto(o3oudomeemfvs () 2rrx ono0alto icilt sDrmnvp t)arxnxocootlpte ieils  rtrxo3oydomt  ictlt)a2rruro;t1apeomf3ilsls2umnvs;t0aexrmfcoo1fate iei t)srxoiopny4alenmnei s) Drrur nu1alx if3iadfmDraumsnu4aeerxo3iadoaDelu sls)trtoxr3nudlme  fes () rurum ;u0teen oeiytfmDuan snt0 lxnif oatomt lu i ( seur(o nu1ap emiet s)sDtaur ou4tptn i3tat mDrmnvo;t0teeoxf3tydfmD lnvs;() etmir3nu1omen ies sf 2trumpot1tptoif3iyd s2ulnvo u0 lenxrctytoatrlu olt  rxm(opou4lm  lnei s srrmx poo0apxn fciyd aDum(mp;u0trxrxfctadlmDeaieilt trxrxopiy1lpe  ivt (faruaxmpnt4opx ifcils m2uanvp t0 eenir oadom   uvols0 rtmir oy1ope lnvtas  rur(m oo1tetnmfeiadfaDumu ont4arxoiocoytfa  ln i;t0srumxopny1olenlietlsfaDrrum nt4teen i3tltls2uauvs;t) ltoio oadoatr uei s)t2tm(r3iy4amee fvslt) 2rmxmpnu1aeenif3iyt a2elums;u) exnmr oadoptr nvo t)t2uoxr oo4ll nmnct s aDur(m no4opt  feild s2rl(vo;u) exnmrctotfmDeaueil() 2tmiopnu1ap  lfcsl(faDumur ot1aptn iciadfm umnvp t4 ltrxf3tatfmtr nvi;s0t2toxrpio4olte ieils arur(r oo4aetn ietyt a2elu s;u0trerifctydlmDe ivi;(  eumxopoo4omeemnci (f Duau  ;u4ope io3iad a umu o u0tetrio oytomtr ivs t) etrimpiu4llt mivslsf Draxmonu4aptniictatls2rlnvs t4 ltnxr3ta1fm r n o ()srxoxrpno1lpe  ivias aDrr( pnu4open oeildlmDuanvon(0alxrxf3iotopDe iesls srur(r ny1lmen nct t  rraumono4aee io3tys sDea(mp () ltnir iy1fpD luvi;()tetmxm iu4omt  fetlt) Dumx  oo0ape iieiysla ranmo;u) lerir oodopt luvs;t  2toiopny4ap emnvtat  Drrxr ou1ole io3iatfmDrlnvo;u)texoxoctodlm r nes;s srtrxopou1lmenlnesltfsrrmurpou0oexn f3iydls el(vo;u)tlxrif oatop e nvil()s2xmim3oodam n nctatf Dtm( oou1tle iictyt s raums t4 exoxo3ootlp  livi;(0s2tr(m3ny4om   nci t)aruaum ;o0olxoiieildfs ul(ms;u4arerir tytlaDr i ol()t2uoimpny1ll   fvia(  rur(  ou1tptnmo3iasla rln pnu4tltoxo3oa1la eln olt0teum(r oy1lmenmnvt ( srua(rpoo4optn f3iysls umnvs u) lenmr tydom  au ol(0teuo(m ou1lpee feias sruaumpnt1opx if3iyt a2ua( o ()alxoxfciodoa eaivols0trxrxo oy4ap nmietls aDrrxmpnt4olxomoeiyslmDumn o () leoxo totfpD li ils  2xmimpoy1omtelfvil() 2rr(r no4aptoio3ild mDrmnmp;(4trxrmf3ootop e nes t0teuoxr3oo1ole mnctas  Dtaur no1teeoio3ild aDua( snu0texnmo iatfatranvils)trtmimpoo1lpen neia(fa2tmxmpou0aexoiieiysfm emnvo;(0 etrxf iotfp r u s s  rxr(rpno1ameelfvi t s2trxronu1altn feilsla emumsnu) etnmo3oo1lpD  i ols)srtmxr3oy4opeelivta() 2tm(r ou1alt  iciyslm eln pnt4alenir tadoaDeanes;()truoiopoudapenlies t)aDur(rp;o0opxnmfeiadlm2emn snt4trtomoctytlmtrai o;s s2uo(rpio4olt mivt (f rrm( p;t0alxomoeiydfm2rlu p (0texrxr tatoa r nei t0 2xoxm iu1lm nlivsa()aDururp;t1tetnmfeiytfa elumon(4arxrmo tatomtelu il(0 rum(o3io1omte feil()artrxmoou4oex iieiasfm2rm(vsnt4trenxf3oo1fpD  ies (0s2uoxm3iu4ol  mfct ()a2ur( pot4tpx ifciyd m ulu s (0teermo3iydlm eln s (  rxrxopoy4al   ivs s) 2umxrooo4oetoifetltla eluvont)altoif ta1oatrauvi ()s2trirpiy4llen iviat) 2rmur oo1opxomo3iydfs2emnvs (0alxrio iydlaDrluvs ()texoxo no1lm  livtatfs2rrumono1tee mo3iadfs uluvo;()arxrmrciadfp rai o;s)srtm(m ou1alee iesltfsDtm(m oo4aeen ociytlaDul( p (0 etoifcoydfaD anes;t  rxo(rpiu4lmee ict (faDraxmo;t4aleomi3tydfa em(vs;u)arerio iotopt lu o s0 2xr(opnu4olen nci sf Dtrum ;t4alxo icild s rlnmp ()tlerir oo1lmDraieo t) rxm(rpio4llt  nes tfsDur( onu4optnmieiatfs2uauvo (0aexrif iytfptrai sl()t2umimpoy4opee icsa() rrax  ot1aet  f3tytls ean p;t4artoir3iatfm rau i;()t2umimpio4ap nlnci t)sDrm( oou0aleniocilsfa2umums;() leoir3io1fpDrlu i;s0sexrimpoo4altnmnes ()s2rm(mpot1oexoifciytfs2umn s u)trxoif totlaDeli s ( srto(mpoy1alte nct t sDurxr ot1tltnioetytfaDrm(mpn(4artoif tydlm  aieo (0trxrimpnudlpee ietat a2trxmpoo4opeoioetlsla uanvsn(4tlenif3ia1fmD lu o;()s2xmirpnudoltnlnviatfs2rrxr nt0tleomieilt a2rl(mp (4tltnio3oy1faDr i i s)srtrimpoo1am  mfcsatfsDra(mpno1opx iictytfa uluvont4altoir oatfaDe n il(0t2um(m iu4ll emfvs s) Dtmxmpnt0opt ioctasfs2ulu p t4tetomo3io1lpDeanvo t0trumxo3iy4ll  liesltf Dur( ono0apt mieiyd aDrmu pn(4 lxoxr3todopDeau sl(  rxmir oy4amt  netat) Duau p;t1tee micilsfaDea( pn(4aleomf3tadfp e neo (0teur(m iu4lm  lfvt t)srrrumonu0apt  iciltfaDra(vp u4 exrircoo1fpDeai o s  etr(rpio4opeelnci tfsrtrum ;t4tetn o3iyt s2rauvs;t4 lenif3oa1lm  aueo s  eto(rpnu4openlfeil( arua( p;o4tltomiciyd aDran s;u0 lxoxf3to1laDe ieilt0t2umxopoodamenlicilt)a2ur(  ou4apeoiicildlm2uaums u0 etomf3iodlmt luvi s0srumxm oodale  fcsatf rrax p;o4tpt  fctadfaDemnvo;u)trxnif3todlptrau o ( t2tm(mpiu1lme livilt a2rrumonu0ape mfctls m ea( onu4trtrmrciotoate u o;s srumiopny4amt lics t  rrr(ronu1oeto oeiyt mDea(vo (0 rtoif3oytfmDe nei (0setmxo3no1amtnlics ( sDumxm ou0tlxomo3ilt mDrauvpnt4artrxfcty1fmt an o () 2trimpoo1omt  ncs ( srur(rp;u1aet mf3iaslmDrlnmpn()teermf oytfpD li s;t)srxoxrpoo4lmeelfvia(f Dra(  ;o0optnmociadla umn o;t)teenxfctodfatr neslt)s2toxm no4lptnlfvil()s2rax  nu1teeomo3tydfs2eanmo t4trermrctodfpteai o s  2xmimpnu4oleemncil(f Drr(r ou0apto ocilslm uaumont0trerif iy1fmDeluesls0 2umxo3ny1ameemivsat)arurumoou4tpe iietydfm elnvsn(4aexnxo oa1lp eaivils0teuoxo oy4ol   nviat)aDtax ooo0tpt iieils s2umums;t) lxoif io1fpD livsl(0trtrxmpio1lmte neiasfsrurx poo4optn feiat s2ea(mp;(4texoxo ia1lpDr n s t)s2tmxm oydalen nctlt  rtm(r ;u0tleomieils a rln onu)altnxf3tytopD  nei s0sruo(opoo4om nmfctas  rurxm nu1alxo oetyt m em(vo;u4aetrmr to1oa eau o;(0t2toir nu1optelnvsa() 2tmumpnt4aptn i3tltlm2uau pnt4 eeoxf totlp  au i ()trurxr io4aptelnetas)aDra( oou4tlen ictatfm eaums t)tleoxr3iodfmDelies;()srtmxmpoy4lpt lictlsf rumu pno0olx ifctadlm2rlu p;u)tlxrir totla   iei;()t2trim oy4omt mfes ( arumurono4teeomfeiasla rmn sn()altrmocto1fm  luvo;t)trxoxr3ny1al n net s s2tm(monu0oet mieiasfs ra(vsnu0arxoir oy1laD lieo;(0truo(o iydal  mnvt ()a2rrx  nt0opxnmfetasla ulnvp;t4alenmf oytlpD ln ol() 2urio iu1altemicils)sDtrur ;o1openmfctyd mDrluvpnu4aetnxf oydfm rli s (0srxr(mpio4lmt mnesa()s2uaxmono0aleomfeiadfs2el( ont)trtniociydoptrln i;s)t2umir nydopee neiltf Draumoou0alenmoeiasfmDua( p u)texoio oytfm elnvo s)setoir iy4altemfvias)a2ta( poo4alx io3tadfs el( ont0 ltnxo oo1la  aivi s0s2xrir3oodlm elnvi t) 2uaxro;t4apt mfciys s2eaumsnu) etrxoctytlatraies;()srxmir nodlltnmfcsl()aDrm(r nt4oeeomiciasfmDua(vpnt)aexoxo oatlp elues s) rxr(rpnu4apeemfes (fa2raur ;t0aet if3iat m ulnvp t)areoio to1oa   n s s0srxrxmpio1am  mivsa(fs2taurono1oetnmo3tlt m2elnvont4 rxnir oatom rau ols tetoimpiydll elivsasfs2tr(mpot4oexo ictldfm eauvp u)alxomfctodfa eaieil(0seumxr3oy4op  mfctlt  Dtm(monu4alen i3iysfmDulu pn(4 etoxfcoatlaD lu slt0teuoio3iy4apenmnvsasf 2tmurpoo1tpt iictyt a rmu s u4 etoif to1oaDeanvo ()tetr(rpiu1lmenmivtlsf 2uauro;t1tpxo ieiytfs emu ont)treomfciy1laDranvo s) 2tmim io4am e ncsa(  2uax pot1opx if3iaslm rmu p ()tlenxo3oydfatelueol( t2xrxmpiu1openmfei t) Dtaumpou4apx moetyd mDrmu o;(0tlenxf iytlmtrlivols  ruoiopiu4am n nei s a2umum ot4olenmi3tltlsDel( o ()artnif ia1la eln o;t0 exo(r nydaptnlneslt srtmump;u1olx ifetasfa rlnvs;u)tetrir3totlm   neo s  rur(o3oo1om nmfcias) 2raxmoot4tetoio3iytls emumo;u4tetomociodlat an o t  etmio nudomen nesat arurum no4oexn ociltls rmn p;t4aeenmociadoatelivsl() 2uoxm3iy4lme  fvsl(faDrm(  ou1open ociasfsDum( onu4alerxf3to1faDe n o t sexrxrpoudopenmnci t)srrm( pnu4olxn f3iys s2umuvs;u4aetrif3tatfm  anes s0seur(rpiu4lpe lfcs t)aDurxm nu4alenmoctld m raumo;(0aetoxrciy1oa eln o ( srum(r iu1altemici t  Duax  ;u1teenmieiasfsDul( s ()aetrircio1fpteliesls0 2to(o iodop emfctas s2rr(m ;u4tpxn i3ils s rmn sn(4texnmf3to1op r uvo s)sexr(mpiu1om  mfvsat  rra(mooo4tlenif3iat sDrm(vp;(4trerxrctydomtr ivi;t0tetrirpnudll  mnvsls a2tax  ot4tptomi3iatfsDrln p u0alxomo3todlp rln ilt) euoxm nodamenlfvs s)sDrr(r nu1texoio3iatfs2uauvo (0 exnir todlpt anvo t) rxm(rpno4lmtnlnes (fartr(ronu4oltn oetltlmDelnms;u0 lxrifcia1fm eaivils0 rur(m nu1ol elnctas)sDrrxmpou0tpxnmoeiys m2el(ms;u0 lxrir tydfp e n ol()s2umiopny4omtnmfci (fs2um(m ;t1tlen f3ias mDelu on(0aleoio3oytfpDraieo s  euo(rpiu1al   neiat artmx pno1oleoiiciytfsDrl(ms u4aetoifcoadopD lies () 2xoxm iy4omt lies () rrmx pno0teeo oeiad s2uan o t)altnmo ty1op e uvil()texr(m iu4apte nvt ( aDtau  ;u0tltnmoeildfmDemnvp (0artrxr3tydfaD anei;() ruoir iudlmenmici (fsDrm(ronu4ape ioeildfa umuvo u4arenmfcoadoat auvs s0trxoir3ou1lpeelnei tf rrax  oo0ale  octysla2umnms (0 lxrxo3iatop e ivi;t  eumxrpiy1lpt  iei ( a2rm(  ot1optomf3iadlsDumuvp u)arxnmr ta1oatrln i;t t2xmimpiy4aptnlfcsat srumx oot0apxnmf3tltfmDrmumsnt4aeerif tydfp eanvo;(0s2urxr3oo4aleemici () 2rr(rpnt4tle ioctytls emn pnt)trtnmo iytlpDe iesls0teuoxopio4olt mfctas aDrm(  nt1aetnmo3ils a2eau pn()aeermr3tytfaD lnvilt)t2xr(o oudomt  fvi t  2tau  no4oee iociytfsDum(monu0altomrctydlat ai s;t0t2toir3ny1apeeliesls aDrruronu1aexomfeiasfm2ulnvp t0tetrif iytfa  aies t)seuoxrpiydameelfct sf rrmu pnt0oeen feiydls2eaums;u)trxomociatlmtrlnes s setmio3ou4olt lfei t a2ra(r nt0ale mf3iyd mDrm(vo;(4texrio tydoateanvols)trtm(rpio4ameelietls)s2rmu pot0aptoifciatfmDum(vonu4 exnxf iydomD anei t)s2xmxm ou4lme  ietasfs2ur(m oo1texo f3iydfmDelnvs;u) lxnifcto1opDean ol() exmiopnu1altn ncilsfa2tmu pnu1oex mfciys a emu p t4 ltnxfctytomt lnvs s0srtmxm oo1al elfetl( s2rru ono1apeoiociytlm2ranmsnt4alenmr oy1lpD lu i s t2tmio ny4alt mfvslt)a2raur oo1aptoiieiysfm ulnvo;(0areoir iotop   ueils t2xmir3nydopeelivtl(f rra(mp;o1oexo feiydlaDuau snu4trenmf oydlatr u o;(  2umxo iy4apte ivi s)a2tau  nu4ope mociad m2rmumsnt4teenmocoodlp ran o;s0srur(rpoo4aleelnvta()arrmxmo;o0texniociatls raums t4trermo oo1laD  u i;( sexmimpiy1ol   ivils srraumpno1tpeo ictydfsDel( sn()alxoir3oytomD  ivo;t  2trxo iy1ll nmivs t) rtau p;u4opxnmicilsls raump u4tlxnmocoy1omt livi s s2um(r oodamt lfviltf Drm(r ou4apt io3iydfmDrlu s;u4tetnio oytlaDeluvsls)srtm(rpoy1ame lncsat sDtax poo1tptoii3iltlaDua(mo u0texnmo3to1lptrlieo s t2tmirpnodlmtnlfci ( arrmxm ;u0alxnifciytlm rm(msn(4tltrxo3oodlmtrai ol( seuoir3ou4am elfvtas srtm( pnu1tetomfciltlm uln pnu4texnxf3oodlaDrau slt)setrxr3ou1olt lies t a2umump;o4apxn fetlt s2eau p;u4altrmr3tatlm eanesls0 rtoim io4ol emfvtl(fsrraum no0olt  iciydfs ea(vs;u0 rtnio oa1lm eaivols)seuo(o ou1olenlfctl( artaxmonu4oltnmfeilslm em(mp ()trenmf oatlm eau o;s0 rxmxm nu4omee ncs sfsrtrxmo;t1ale mo3tasls2ea( p u)arermf3ty1la e neo;t  2trxrpnudlpe livsasfa2rmx  ot1optoifcildlmDuanmo u4 lerxrcto1fm elnvsl( sexmxr3oudlm   nci sf Duaurpnu0openifctyt sDelnmp u4tetomrctotfmtraivi;(0sruoirpou4lltemicsltfsDra(rp;o4openioetydfaDra( o;t)trtoxfcoo1fpDrln o;s  2xmirpiu4llee feilsf 2tm(mpot1apeo ieilt sDrl(vo;(0tlermr3oodfmt  iesls) etm(r3iodoltelicslsfsDurumpno0alt mo3iatla2emn s () lxrxr3ta1fpt lues (0 eurim iy4lptnmicta(fs2tmx  nt1optnioeild aDran s;() exnxfcio1oa  li o;t) 2trxo iodlm  mnvs ( srurumpou4tleomfciasfaDumnmsn()arerxr3totla rlnesls texmxrpnudoltemivsls  2rmx oot1apx  i3iysfaDulump t0 eeomr3iydomDe i ils)s2tmir nodlltelncilt)sDrru p;o4oleniictad s rmuvo u) eeomr oa1opDeau slt)t2umir ny1lp   ivia(fsDtaxrpou1tpxnioeilsfmDua(vs;(4tetrircoatlm r n ils0tetoxr ny1amt mnvtatfa2rm(moot4tleo oeiysfa elnvo;(0 reoif3iydfa r i ilt0s2urxr3oo1lmtemiet ()sDraum ;u1tleo ociat m uln pnu4 ltniociadlp rln ils  rtm(r nodol  mncias) Drax oou0tpeoifeilsfsDumnvpn() etnxr3iy1lpDrluvolt  etr(r3ny4omeelneiat)aDum( pno1apx ifciadfs elnmont0aeenmfcoodoa r ivs t srur(r ny4ol   ivi t) rrmx p;u1oeenio3iat m rln p t4 lerxo3iodfaD aneo;()truoir iydlmt lfeia() 2um( poo4tex moeildls2um(mpn(0texoxfcoatfpDeauvo t s2tmio3oodlme mfetat) Drmump;t4tlxnmfeiytls2eau s (4tlxrmfciodoptraueo;t) rtrio oy4apee ictatfarraumo;u4tpe  f3tytfs ulnvs u)teenmf3oo1fp rln i t)sexrxm3nydal emics t aruau oot1tle  o3tatls2rmumpnu) rxrmo3oatomtelueo;t0truoim oo1ap e fvtl()arur(r nu1apxnioeild mDelu snu4 exniocoydop e uei s)seumxm3nydal nlnei t  2tmxr ;t1olt  fciys aDraums (4artnxf3todopt  i o;t0srur(o oy1ap nmictat  rtmx oot1aee  ieiyd m2umu p u)trxrmr3iatopt  nvs;s0t2trxmpnydol   iesas  Drrurpnt1olenio3tadfa ranmo u0tlxnirciadoa eauvo;( trtoxm3iu4altnlfcsls)aDtau p;o1tpxnif3iat m eauvo (0aetnmo iotfmteau s (0 exm(mpoodap nlfvs tf rumx pnu4tetomieiyt m2rln p;t0tetnxr oatopDeaivolt  2umxrpny1ame licslt)arua(rpoo4oex  ietatls rmnvp;u4 etomf iadfpDraueo;s0trxo(o nodlmtn nvs (faDtmumono0aleniictadfs umnmp;()aleoxf3oy1fmtrlivols)srxo(rpoo1al  lfcia(fsDumxrpnt4olx ifciltlsDelu snt4 ltoxf3ta1latrlnvs;s0trtmxrpoo1oleemieiasfs2tmxmpnt4oltn oetldfaDumnmpnt) rermo iytopDe ivsls sexrim3io4lp n ncta(  2urumono1oeeoii3iydfs ra(mp;u4 eenxfctadlaDeaivils seurir3oy4omee iet s)aDtmxmoou1tpxnmoeiaslmDumuvpnu4aeenir3ootoptrlivs (0srtmxo3iy1opeelfviat)a2rmumoou1apx mfciysfsDeanvs ()trxnio ia1fp  liei t) 2xrxm nudoptnmncta(fsruaxmont4oleomo3iltfs el(mo () exomfcia1fm   ivs;( t2xo(opiu4amtnmietls)a2uru  nt1opx  ieilslsDra(mpn(0altnmo oodoa ranei s srtoirpnu4apee ics ( sDua(mpnu4tle ioctad s2elnmo;()trerir3tadlptean ilt)teum(o3iudome  feia(faDrrur ;u4tpto f3iytla2um( o;(0aeerif oo1la   n olt s2urimpiudame lnes sfsrra(mpno0optoifctas m2umuvs u4arermo3iatfpDelnvsl( texrim nu1lpe lnesl(faDtaxrp;u1aee mfciadls2umuvs;(0tltoxr3oadlpDrlnvo;t srxoxr3oo4ol n nct s) Dra(rpnu1opto fctatla2elumont4arenmfcio1fa raivi;t)t2xmxmpiu4op   fvs () rtmxmoou0olx  fciad m2ulumont)altoxf oytlat aivo;() 2umirpou4ome mfvsa(fsDrax pou0opxniocildfs em(vo t4alenio3iytfm   nei;()texmir3nu4lpenmictat) Drmxmooo0alxoif3ildfm ua( pn(4 rxnxr oo1fat  nvslt)seuoxm3iu1ll  lncs sfaDrm(r nt1oleoiieilt a2ranvo t0aeenxrcootomD  ies ( t2trim3ny4olte fcta(  2rm(m ;u1oexn ieilslmDrln pnt)artoifctatlmDr nvi;(0 rtr(mpnu1lptelfetas)sDtrxmonu1aptnmociadls2raumpn()alxrxrciotla  luvs (0 2xoxr iu4ol e fvs sfa2rr(  ;o4tlxnif3iysfm2elnms u)alxoxf oy1lmDe i ol( s2trio iu4op nmfvt ( sDraumpnt0tpx io3iatfa2ea(vsnu4 ltoxf oatlpDraues;t  2urxm3iydllenlfctls  2ur(mpnt0ope io3tyd s2rm( sn(4 reomo3tadla  lieo;t)s2tm(rpoodaptemfvtl()a2ur(rono1tleniociltla2rauvsnt4 eerxf ia1lmDrliei;s) 2xriopno4apeelfeiat  Dtmur ;t0teto octadlm2rmumo t4arxnif3iatfmtrln ol()t2xrxr3oodomtemnvilsf rua( p;t1olenif3iydla umuvs;(0areomr oo1fmt anvslt setoimpio1aleemfct tfaDtruro;o4aetn fetltfs2eaump u4aeeoio tydfm rlu s;s)sexm(o3oo4omee nesl()aDrmxro;o0tpe mictat a uan s u0 lxnircoydla eanvsls) 2to(o nydap e ieia(fa2rm( pnt1aetnifciyt sDrl(msnt4tetnmr3oy1lp  aivo (0sexo(r ou1llenlncsa(farumu pno4apxoiieiydla uln o t4artrxfcoydoa r ueo ()s2um(o3no1oltemnvtl( sDua(r no4tpt mo3iadfsDra( s;(0tlerxoctodla  luvsls srxmim iudlltnmfctat sDrmu  ot0opxn ieils s elumsnu) etnmf3ta1lpD lneol()sexrxr3ou1omt mnetat  2ur(  nt4tlx moctys sDea( o u) ltoxrcoodfpDrauei ( t2uoxr3iu4lp n fetlt)srrmumoou0ope ifciyd mDum( s;t4 eeoir3oydoatean i t0tetrio3iu4opt mfctat aDta(r no4tltoiictldfs2umnms ()altnio iadoaDrli i;t) eur(o3oodlmee iesl(f 2umxront0altniietatlm2eaump;t0tetnif3iotop rlnvslt0 2urxrpiodolt  fciat)a2raum ou4aee if3tydfs rm( s;t0areoxo3oa1lptelueo;t  rurxmpoudoltnlnvil(fa2rmu o;u4oexnifetat m2rluvp;(0 ltnmf3iy1op rlu o s0setmim nu1olenlnvsa(f rra(mono4tpx mo3iadlm2el(vpn(4 lxrmr oatlat luvs;() rxoio3iu4olee icilt aDtmur ;u4aee mi3tlsla2rln o;(4altrxf3to1fa elneo;t0 2toio3ou1ame  iesl(fsDur(ro;o4texomiciydfmDemuvsnt4 renxr oatom eaues s  2umxm nodop elicil(  Dtrumo;o4aleo fctytfm2ean p t4trxoxr ia1fp   u i (0t2urxrpnu1op emfeil(f 2ra(mpou4olxo icilt m2rau o;t)arxrif3oadomtrluvi;()srtmim oydlm nmivtls) 2ua(rp;t4teeoifeildfs ul( p u4alenmr tytfatraivo;()t2xrxm3nu1llte nvslt a2umxm ;o1ale iicilt m2emu sn(0 eeoio iy1lat auvsl( srtm(r no4lmtnlicsatfa2tmxrpnu0oexo oetldls rm(mo t0 rtriociytlat livi s0srxr(m io1lptemncsasfsrtmumpnu1teenifcild m2umnvs u0aexoif3iatfa  luvo t  2trxmpou4ap n fctls)aDumumpno0tlxoiocias sDum(mont4aexrxr3ta1fa e u s () rumxo iydlptelfvta(fa2trxront0tptnmocilslm rl( pnt)trtnmo3oydlpt luvols0teumxrpoo1oltn ieslt a2trx ooo1tee  ieias s emu snu4tetrxr ta1op eluvolt)truoxo iu4al  mfvil( srtm( onu4opeomfciasls2em(mpn(4altniociadlat aiei t) rxoir3no4apeelictltf 2urxm ;u1opt mi3iatfmDrm( p u0aexoir oodomDr uvo t0tetoio iudlp n nvtltfaDra(mont0aexn f3iytfs2uauvo () eeomoctodoaDe uvil( teumxo3oudop   nvs s) 2rrurpnu4alxoioeildfm rl(vpnt0treoio iotfp eaiei;(0seurim ou4omte fet (fa2tmxr ;u4opxo octaslmDeluvp (4arxoif3io1omtelnvo s srxm(m3oo4al elnvilt)srtmump;u4openmo3iltls um(mo;()teenxfcoytfpt livo ( teto(rpou1llt mnviatfarua( o;o1opxn icilsls2ea(mp u4 leoxociydfmte ueo;t trtmxr nodop n fvils srra(m ;t1tlxo ietyt sDul( s t0 rtoxocio1lpDrli o;t  2xrirpno1amtnlfcsl() 2ua( ooo1optomfetad m ra( o ()tltrmfcoo1fmDr i i s)texo(m3oy1lm elncs s)s2uauroou1altnifeiasfmDeln pn(4 eerif3oadfpDeanvolt)srumxo iu4lm   nvsltfa2taxront4aetnioctasfmDrm(vo () ltrmrctatoaDrluvs;(0 etoirpny4ame lfvtat  Drm(  ou1tpeoifciatfa2rm(mpnu) rtrmf ta1laDrluvs t  rxoxo oo4op  lnetltfsDuau  nt1optn o3ilsfm2eaump;t0alxrio3oo1fptr ueo () 2xo(r no1lptnmnctls)arrmumono0altoifciys a umn s t4trtnmf io1fp   uvols s2uoimpnu1ll nlies s) Drrxmono4apxoifciyt a2rlumsnt) lxrxocoatopDelnvsls srxmimpiy1omtn ict t)sDumu  no0ale  fciydlsDem(vs;(0 lerif3iy1lm elies t  rtoio3iudlpt  ivsls) Duaxrpoo0oee  oeiad s emnvsn(4trtrxo oa1op  auvs ()t2ur(m3nudlmte fvtas a2tau o;u4alt  oetyslaDrlu s;t4arenxf ia1lmtrlnvs (0t2ur(mpiodopt lfes ( a2uaurono4oltniicildfa em(ms t4 leoir iytfmteau ols s2xo(mpiy4aleelneilt aDur(ro;o4tee if3iasfm2umums u4altoxr tydfmD luesls0 etmiopoy1op elfeilt) 2rmxr oo0alto fctltla2ulnvs u)alxoxociatfmteai i;s  exr(rpiy1ale lnvta(farumxmpnt1alxo oeildlsDra(ms;() lenifctodomt anvi ( teuo(r no4lpenlnvs s) Dumumo;u1tltoiocilsfmDuan ont4 lxoif3tytlmtrluvo;(  2xr(mpnydalte fvil( srurumoou4alto oeiadlmDul(vsn(0 rxnir todlptrlueslt0 rtmxrpny1lmtnmictltfs2raxro;t4teeoiieiydfaDelu o u)trxoxr oytlmDr neil()teto(m3iy4lptn ics s  Drmxmpoo4tlx  icilt aDulumpnu4trxoxrciytopDean i;s)s2xr(mpny4alenlivsas)sDrr(  ;o0opxnio3tys aDrl(vsnu0arermfciatlmtr uvi;t)t2tm(r3ou1lp elfvtlt arrax  ot1aetnioetyslsDua(vs;() rxnxocoydom eluvs s srurio io1om emicsl( aDrr(mp;o1aet ifctyt s2ea(vp (0tltnxr3oytlptraieil()trto(o3nu4om n iet tf 2tr(r ot1tpxn ociatfmDemnmp u)trenifcia1lp eaneo s)texoim iu1lm emnvia()srtaur ;u0opt if3ils a rlnvo;u)trxoxf ta1fm e i o;t tetmiopiy4lm elicta()s2rau o;o4teeo o3tadfa2ea(vont0tleomr3iodopteanes;t seto(o ou1am   fcias  rrau pnt1tetnmoeiytfm2el(vp;u0alxrifctatlp r neol()srxr(o no1ll emnvtas) Dtr(m ;o1opx  ictydla ea(vsn(0 rxoif3io1faDeanvi t  rtmim oudam e fvilt)srrru  oo0oexnii3iatfm2rluvpnu) ltomr3tatopD auvi;s0trtoio oodolte netat srua(rpnt0oexo ocilsfmDra( p;(0 rxoxr oa1op r ieo;(0seuo(r io1ll nmfctatfaDtr( pnu4alx ifeiatlm um(mp (0teerir3tytoateluvilt)t2xr(m3iodamen fei (fsrrrxrpnu1tpenmocilslm2um(mp;(0tetnxo iadfpte neo;s0 2xmir3oo4am nmnci t) Drrum nt4tpen o3iydls2ea(msnt4aeenmf3todfptr uei s0 2uo(m oydlle micil(fs2ta(r ;u0aptn icils m rmump;(4alxnxrcio1fmD lueilt)sexo(r iy1alee ivsas  Dtrumoou0opt  ictatlm2ra(vp;t4aexrxr3tatlptrau ilt0seumir3iu4lle liet (  2taurpot4tetomfeildlm2umn p u0 rerir iodla e uvi (0t2umxr oy1lltnmieslt) 2tmu  no4oexn oetltfmDeln snu4 ltnmfcoatop rln s s)seur(opoy4aptemfci t  2urxroot4altnmictasla2rluvsn()altnmf ia1omteaueo;t0t2uo(rpio1lleelfcils arumxmpnt4oex ifetldlmDran sn()tleoxo tydopD ai o;t  euoir3oodllee ici t)a2tmum ;t4texoio3tltlsDuauvs (4 lenio3iydop r i s () etmio3oy1openlnvil(fsrtau onu0aptnmfciytla2rlnms;t4aexnmociotlp rlnvo;s sexrxm ny1lleemncsls  Dtaxr ot0oee if3iyt sDrmuvp;t4 lxoxo3ia1fmt lneilt)trur(rpno1op elfvsasfsruax  ot4oetnif3ilt a2rm(ms () rtoir to1la rau s t trxmir3oo1llt lnvs t)srrax poo1oexomfcildfm2elnvsnu0arerifctadop  an ilt)t2xrir iy1ap e ietas)srrm(root0olx moeilslaDeanmp;t0texoircio1laD  nvslt  exmir3nodale mfviasfs2tru pot0tlxnmf3tlt s2elnvo;(4tlxnmo iodfmDrln o t) 2urxm oodope  neil()sDum(ro;u1tex iietyd a2eaums;() lxnif3todlatraieo;t s2trir3oo1al nmnvsl(fsrtaumo;u1aee mo3iltla emu o;t)tltoxrctodfpt luvils0 rxoio oo1lmte nvtltfsrtrx pot0tlenmieild s2rlu pnu4trtomrctodop   n o;s  exoxr3ny1lptn fvsatf 2tru o;u1alxomfeiyd s2rlnmp u4 lxnifcootop  auvils0 eumim iy1apenmfvia(fa2rm(ronu0oetoifctydlm2ea(vo t)tlxrifciytoa   ivs;() exr(r3ny4llt miesasfaDrm(ro;u1tpe moetltlsDranvs;t4 rerxf tytlpD  ivsls) exmxm oodop  mivtls) Duaxrpoo0apxn ociys aDumnmo t0altrxo3todlpDeaneolt)srumxopou4aleelfcilt  rtmur ;o4aeto f3tlsla2elu s;(0tetrmf3oy1lp e neo;()s2ur(r iy4apte fvtat a2trx oou1tlt  feias a rauvp u0tltnxocia1lpD lnvi t srtmim io4llenmnvt s) ruaurpnt1tlx iieiysfm ulnvon(4 leomo3oadlp elueo s s2xr(rpou1amtnmivtl(f Dta(rpou4alx  o3iys mDrau p;() leoxo3ty1oa rli i ()t2xoimpnydolt micsl() 2um(m ;t4alxnmf3tydfs2umn snt)artnxo io1fmD  neilt0truoiopoodlle  fvtas)s2tmxront0aex ifetltlaDrl(von(4trerirctodoa   ieo s0t2trxm3nu4lpenlictat arum(m no1aee  ieiadla2rauvon(4 rxoio3tadoaD lnvs t)tetoimpiy4lpenlnvsa( sDuaur nu1open i3ils aDul(vo t) ltomo iydlmtraneo t)t2xo(r iu1ope lfctat a2tmum ;t1teenio3ild m2rau on(4tleomf iadlaDe nvolt srurxm3iydole mnvs t) rra(  ;u0ope mi3iyd m ua(vsnt4trtoif oatfmDe ivsls t2umxm nodlm elfeia() 2tr(  ot0aee mfciyd m2uaump u0teenioctotfp r nvi;()trtr(mpou1ll  lfvtl( arurumono1tle moctyd a2ul(mont0teermo3iotoatrln sl(  exrim iy4al   fviltf 2um(mp;u0olenmieiadlmDra( p;t4 rtrir3oytlpDelu s t trxr(m no1lpt  fcsls)s2um(mo;o4ape  i3iysfm ean p;t4teenif oo1oa rli ils)s2uriopnydope mnctasfarraumo;o0aleomicildlmDel( p u0arxnxo3iy1oaDr i i (0texr(m3nu4lmte fctlsfs2rrxrono4oex moeiatlaDuauvp u0tlxnmrctytomDeai s;s)srurxr3iu1ll  lnei t) Dtaxmpno1tlenifctatlsDrlu p (0trxoifcoodop rlu s ()s2tmio iy1lmenmfvta( a2rm(r ;u0opxn o3iasfs2rl(vp;t) rtomr3to1fm raivilt  rtr(r3ny4lp   ivs s artru onu1olen f3iytfaDeau s;u4artnif oytopD  i o;()seurimpnu4altelfetls aDtmx  ;t0tlxniieiys aDum(vp u0 rtnmf3iytoaD au i;( trxmxm ou4olee neslsf rrax o;t1tee io3iysfm rmuvont)tetrmo3ootoaDr n o () 2tmxm iudllt  fvi t s2urx ont0tpto ieils a eanmon(0 lxnif tatlmDelneo;t  2xoimpny4al e iesas)s2taxmpno4tpt iieiadlm2rm( p;(4alxomoctadfmtelnvilt srur(o no1ol  mfcsa() rururpno0alx iocilt m rm(vsn(0tlxoxr iatoatrau i s  euo(o3oy4amenmics sfsrtaxrpoo4apeo ociad sDua(vs u)aexomo3oy1oat luei t  2xmxo oo1lp e nesl()s2rm( o;o1oetnii3tas m2el(ms t)treoifcta1lpteanvsls  ruoir ny4olte nesl(farraum no0oleoiiciydlm elnvo ()trerxo oytfm elnvo;t  eurim no1op   neils)a2urxro;u1tlen feiadla ranmpnu)alxnxfcto1om eai sl( sruoim3iodlm e ies s)sDururo;u1aleoiieiyd a emnmo;t4texniociytlp rli slt0t2umxm nydap emivilt)srtrur nt1apxn fetat sDemnvs;u4 ltrmrctadlaDeauesl()tetr(r ou1llenmfci sf 2uru o;t1texomo3ilsfm2ra(mp u0aeenxrciadfp rluvo s teumxopou1aptelfvta()artmumonu1tlenioeiasfaDea(ms u0tltrxrciytlmtr u o;s trurir3ou4ol nmfvtls aDtrx poo1oetnmo3tytlm2ulnvo;(4alerxrctytlaDelies s0 eurio ny1lltelnvs tfs2rmxm ;o4olxnmoeiysfsDrmu o u) reoiocia1lpteaivo ()t2xoim3io4lp n fesat a2uaum ;u1tpeomoctldfs umu p u4 ltniocoydlateluvi;s srtmimpoy4al e neil(f 2taxro;u0aleomieiadla rluvp;(4arxnmf3iotfm rau o t t2uo(m3io4amee ivi s  Dururpoo4tlxo fciltfa2rm(vp t4areoir iodopDrlu s;t  rxmimpoy1ll nmfvsa()aDtmurpoo4opeomietaslsDra( p;()aetoxo3iatlpD aieo s tetmim ny4llee fei t  rrm(mpnu4olxomoetas s2em( s;t4 rtnio3ia1lmteanes s s2urim oo1lpe  neslt arumxm ;t1tpe mociadfsDulnmon(4 reoxocoydlmDranvo t0s2tm(m3ou1opt mivi (  Duaum ot0alxnmieiatlm2ra(vs (0tlxnxoctytlp  lu s s0sexm(o3ou1ap n iet (fsDtr(moot0ale iociat m rauvp t0 exrxo oy1fmD aneo t0srxoio oydlmee ivilsf Dtru pot4tetomi3ildfm rl(vo;(4texoxr3ta1oatraiei t)s2xoxo3oy1ome  fei (faDrrurono1aptomoetyd m ul( p u4 rerxf oydoatelieo;s)s2xm(rpiy4ll  mictas) rtaum oo1aptoio3iat sDrm(mp;u0teenio ootlaDelnvi;t0 rtm(r3nodop n fcias)a2rmxmoou4oeeniieiltfs2ua(ms u0aexrxo3tydlpt  i o;s s2um(mpiodlltemnei tf rua(mpou0aptn oetytfa2ea(mp t)teenmocia1fatr i o;( sruo(mpny1am e fvsat)aDuax o;o0tpen oetysfsDuln s u)arxomfciodlmDrauvs s) rur(mpou4ap n ici (fsrururoou4oeenifeiatfm uaump u0aeeoxfcto1opDelnvslt  2xrxmpoodlpt  ieiat sDra(r ou4olx mfciydlm2rmuvonu0 eermo3iadfa   ivi;(  2tr(r oudap   fvslt) Dta(m ;u1olt ii3ild aDemnvp;u) exnxfctodom rau i;s  etmio oudlle  feil(fsruax pou0aptoifciyd aDuanms (0aleomf iadlmteau o;t t2xo(mpoy4lleelivtas  2ra(moot4aex moeiltlaDumnvo () eenxr3oo1oa  ln slt0s2tm(m nodlpe lncs t)arumumo;u1apxnmfetat m2rauvp;t)trxoio ia1opt luvs;s  eur(r3no1lmenlnvils artr(r ;o1tleo oeiatlsDrluvs;t4 rxnir3iydfaD  ueo;t  rxr(mpoo1lp emfetl()arumurp;t4alxnmoctasfa em(mp;t)texomf tytfatr u s ( s2xrim nu4amt livsa( aDtaum ;u1oexn o3iasla rl(mp t0altrxf3iytfmDeauei (0 2toir ou4altnlneia()s2tm(rpou4tlt  o3iat sDranmp t)aexomo ia1lpt  nvil()t2xmxopio4al  mfcs sf Dtau  ot0apt  fciatla el(vsnu0 ltrxo ootopt lies;t0s2uoir ny1ll   ics t srrau ont0optnifetysfa rlump;()alenmr ia1om r uvi;t0srurio iu1optnlfetas)sDrmxmp;u4tpe ifeiadlaDran snu4 etnxfciy1opt anvo;s  exmir3no1lpte iet (faruaurpnu0oexnii3tysls2emn o u0tetomocoy1opDeaivs ()tetm(o oy4lm eliei s)aruax  no4tleniociltlm rlumsnu0 eeomf ta1lm elnei;t srxoim3nydap  lnetlsfaDrrxm oo1opt io3tltlmDrmnvpnt0 rtoxr oatfpDraieo t) rxmimpou4al elnci ( s2taxrpno1tlt ii3iydfa2rmu s u)areoxfcootop  lnvols)teurxm3io4am nmici sf rumxmpot4tpe iociltfsDeln onu)tltoirciadfmtr nvs;( setmio ou4ole mieils) Dtrxm no1aee iieiat mDeln on(0artnmrcio1lptr u i;(0t2tm(o3nu1ol nlfvsa()s2um(m ;u1optnioetysfa2ua( p (0 etrxr3oy1op  lu o;t)teum(opiydam  miviat a2raxr ot1aetomieiyt m2rmuvp u4 rxrxo3oadomDe ieolt)s2tr(rpoo4al n ict tfsrrr(rpnu0texo ieildlm2rluvs t0trenmf todlpt livi (0s2um(rpiydap nmfet s aDur(  ;o0alx mi3ild a eauvs (4aexomociatlaD livil() rur(r iydlpee ivsa( s2taxmpot1apxniictlsfsDua(vpnu0aexnir3oo1oa rln ols) rxr(m iudlltnmfvilt  rtruro;t1aexnmoeiysfm2umn ont) rermoctydlpt  uvs;()t2xrxrpoydome  iciat) rra(r nu4opxo oeiydlm emnvp ()altnifcoytoaDelivolt)sexmim ny1apt mfvsa( aDururo;t4opxn ieiat m2ua( p;u)trxnxo3ta1opDr i s;t0srtr(o iu1ape liei t  Dumu poo4tlxnmocias mDemn s;u) lxnmrctydoaDeluesls0 2uo(opou1om emieiat) 2umumo;o0apxnmieilsls2umnmont4 renxr tytlate neils sruoimpny4alenlfcsl( sDur(m ;u1alen ieild aDemnmo u)teenif iy1fmte neols texrxo oy4omenmfcia() Dtaur nt0aet  ieiad a2uln p;(4 etomf3iytfa  auei;(0t2xo(mpny1openlnes () rtr(rp;u1oeto i3ildfmDelump;u0trtrmfciodomtranes s t2xr(mpnodolt lncia()arrmu onu1tptniieilslmDelnms u4 lxoifctatfaD  uvo ()seto(opiydlpen nvsas)arurxm oo0tetnii3tat m rlnms;t) exnxfctytom eln sls0srtoxm no1lptnlfvt (faDtau ooo0aet mi3tadls ul(mp () eerircia1omteai s;(  euo(mpou1aptn fetas)s2rm(  ;o4olen ieiyt sDulnmo;u4 renio iotlaDrlnei;t0 etr(m3iodamtn feil( a2rru  nt0altoioetatlm ea(msnt) lenir iotop   nes ( sexoim nodllt mfcsa(  2rm(ronu1opxniieiadfm2rlumonu4arxrxf iytfp  luei;() 2xrio iudllt lfetlt s2tmxmont4tetoii3ilsla ulnms t0 etoxf iydfmt li s;s)s2xm(o oodlm  mfctl( artr(rooo0tlt mi3ildlmDum( snt4 etomfciodfpt  i o s)s2urxr3nydap nlieta()srurum no4oleoiiciatlm2umnvpnu4trtnmo3tadoa eaiei;s)texmxmpiu1omee iviasfsrrrum ot4aet ifciadlm rm(vsn() eeoxf iadfpD ai o (0 eurxm3iodal eliesls)aDumxm ;o4tpeomoeiytfsDrmnmpn(0alenmociytoaDelueo;( t2uo(r3nu1am e icia() 2rmuro;o1aleomf3iys m2uanmont)alerir oatlate ivo;( s2to(o3nu1ope mics t  rumu pot1tlto ieiyd s2rmnvs;u0areoif oydfm e ies s0 2tm(m nu4amt lfvtas)a2rmum ;o4opxo f3tas aDeluvpnu)arenio tadfmD  n s;s)s2uoiopnu4amtemnciat) 2tm(m nu4oetniocilsfs2ra( ont4altniociotomte nvi t trtrim iu4aptelfesas) rur(  nt0aeeomictasfm elnvon()aexrxfciy1fa  ai sl( t2xo(o nu1omtn ieias)aDraum no0tetoiocilsls rmu s t0 rtoifciy1oaDelieo;t)seurxo3no4op  mnetat s2um( onu0opto o3ias m eaums t0 rerxo3ootlm rli s ()sexoiopny4lm elies ()s2urx ont4texoii3iasfa ranvs;(4aetnmo3tadopte nvs t  2tmxr no1am  mfvia()aDrru pot4tpxo f3iltla2emumo;t) lermf oydfaDe uvo;s0seurirpou4alt lfctltfs2ra(roou4apt mieiyt m2emu ont) reoirciotlat lueolt)texrimpny4ole  fcilsf rrrx ono1oltn fetyt m2eln s u4tlxnmo oytom   u s;s srtm(m iu1aptelfct ()s2umx ont4tpeniietytfs emnmp;(4 rtnif3iatlpDr n o;(0s2uo(rpiu1ale livilt)artau oot0oexnif3tatfs ea( p (4 rerxo3ia1fmDr ies t)t2xr(m oy4om emncil(fsDrax pnu4oetoifeiadfsDem(vpn(0 lxnio3oo1optrlieo s)trxrxr nu1om nlfciat)a2rmx p;t1aeeniieiltla uluvsn() ltnir3iatfmD ln o s0 rur(rpiudomenmfcias  2umumpnu4alxnioeiydlm2um( pn(4trxnir ty1fm raieils texoxm3iydap n ietl(fsDuau pou4tptniiciad s ra(vp;(0aetomocoydlpt aiei;s  exo(m3oudapt mncs ()a2urumpnt1tltn iciasfmDrlnmsnt0 eeoio3iydla   ues s0truoxo iu1aleelict tfs2ua(ro;u0aptnmf3ilt m2em(mpnu4arxnir3tydfpDr uvo ()teumimpoo1omtn icslsfs2tr(r ;t4oee  oeiytfm2em(vo;u0texrif oa1lm elu slt srxr(r oodaltnlnvtas) 2ua(ront0aptoii3tlsfa rau p t4 lxomrctadop rli ils  2umxm no1al n fvilt) 2ua(r no1tlxn ieildlsDea(mo u0tetomf ia1lmtran sls0seumxo3nodaptnlnvtlt arumump;o4tlxnif3tytfm2rlnmo;u0arxoir oydlm eauvs ( t2urxm3nu1lpee ncsasfarur(  oo0tet mi3iyslm elumo;t0 rtnifcto1fm r ieo t0trtmim oy4omenmfvt s)sDrax p;t4tle  fciydls2emuvp u4 etoxr oo1opteau slt0trtrir iu1lm e netasfsrtax ono0oexn o3tydla2uauvs;t4 exrirciatfp e n o (0t2uo(o3nudopeelies ()sDtm(mpou1tpenmoeiaslm ul(mo;(0 rerir3iadlmt li slt0truoim3iy4lpeelnesasf 2tr(rpot4ole moetls sDrm( p u) rxrxf oytfpt lneo;(0 rurxo nodll nlnesls srtau o;o1aptn o3tatfa emn s t)tltrifcty1opDrauvs t)teumim iudlme  ivt (  Dtru o;u0alen feiydls rmnvp;() eeoxfcoytlp  lnvs ( t2xoio3nudale  ieia(  rtm( pnt0aptnif3ildlaDulums u4 eeoir tatfaD lueo t teuoim ny1oleemfes t)a2rrx p;t0aeeomietyt m2rmuvpn(0trerio3iatfmtrau s s0texmir iu1am n netlt a2rrx  ou0ope mfetldfs2ul(mpn(4 lenmo oy1om  lnvo (0 2umxrpiydalee iesatfsDrau  nt1tpe ifcild a rl(vonu0 rerio3iadlp e i ols) 2tmirpoo4olee nvslt) 2umu  ou1aetoifciltfaDea( pnu0 eeomr tytlmDr ues;s0texm(o oydap nmnvsas  2ur( o;t4opx ii3iydfa2uanvo;() eeoir to1om   nvi;s)trxr(m3oy1lmeelnetls srtrxrpnu0tlen ictytfmDra(vpnu4trxnmf tydfmDranvs;s0srtmimpnu4omtn ietasfartrxrp;u1oltnifeiyslm2eauvo t0aeenxf tydop   i i ()t2to(m3nodopee ivta() 2raurpot1oee mf3tysfsDrln o;()areomr ty1lmte ivi;(0 2trir3ou4am  livs s aDur( ooo0texomictaslmDrl(ms t4 renxf3iytfp e uvs;t) eto(opiodal nmnetat) rur(m ;u4tle mf3ias aDrauvp (4trermrcio1fa raiei;s0srtrxo io1ol  livtls aDrauro;o1oexn i3iytfa eanvs;t0teeoxf3tydlm  lnvils trtmxm3oy4alte fvtl(  Drrx  ou1tpeoiietytlm2umnmo;t)aeenxo3io1oaDeanesl(0 2uoir3oy4al   icil()sDur(mp;o0openmoeiat sDuan p u4 renmrcio1fptranei s trxmiopoo1am  liesa()srururp;u0tee mictad m2ua( pnt)texoxfcoydfa eaneil()truo(o3ny1alt lnct sfsDraxmpnt1olx  icildla2uanms;()aeerif oadlpD  nesls  rtrxm ou4lltn nes t a2tau  no0teenif3iys m2ean ont0 etnif3iy1fp  au s s srxrxopoydllt mnciat)aruaumpnt1tee ifciyd sDrln p;()trtnxfctatlmtrau o;(0srxoim3nu1ale  nvils) rrau oot1oexoiociytlmDeln o;()altrif ootfp e uvs t)trtrio iu1ol emiet t  rrm(m oo4tpx micilt mDrmnvo;t0tlenxoctodoaDrlu slt)srxoxr3oo1ape lfvsl() Drmxrpot0aptoio3tls m elnvon(4aexnmr3iotlatr ivsls  eumio ny1lmenmfvta( aDrr(mo;u0tex  fetlt mDrlu o;u)teenmo3io1lp e uvo;s  2ur(r3oudal nmiciatfarrmxm ou0aleoifeilt m uluvo (4 leoif3iydlmD  uvsls0s2toxrpnodol emici sf Dtm(m nu1olt moetadlm2umn o u4aeeoiocoytomD au ol() rxmimpoy1opt  neiat  rua(mp;t4oex mfctas a2ul(mpn(0trtoxf tytfmD an o;(0 2um(r nu4om  mfvt s aDua(m no4aet iictldfs eauvpnt4teermr iydom  ai slt0srurim3io1alt lict t  Drr(r no0aee moeiasfa2em(ms u4 eerxocto1la  anvo;s) rurxm3ny4amtn nes t  Dumum oo4opxomf3iadfs um(mp u0altrxf3to1fmt ln sl(0 rxr(m ou4lpe lieias s2tax o;o1tltomo3tyt s2ranms t4 ltrio iodlpDelnes;(0 rtoxmpoodlme mfcslsfsDtax onu4tetomf3ildlsDum(vpnu0 renif3to1lpteli s (  exrxm3nydaltnlivsas  rrau  ;u0tpeo o3iyd s ulump;u4 etoxr oydlp  aieo;s trxr(mpou4lltnmfvta( aDraumpnt4ope mi3tyslm rmnms;(0aetrxrctotfa  an ols trxo(m3ny4amtemnvs t) 2urx ooo1aet ii3ilsfa rm(vs;u4tlxoio iotfpt aneo;()t2xrir3nodapenlncs sfartrxmp;t0oexo ociltla2ul(msn(0tlxrif3iatoptraneilt) eto(o no4apen fetl()sDurum ;t0tlxomfctasfaDea(vsn(4artoirciydfmD  iei t) exm(o3io4om  mfcilt s2tr( o;u1aleomi3tat m ea(vs t0 lxnio3io1op raueo;( sexoiopoo1ap n ivsatf rrmurooo0optn f3ils sDel(msn(4tleoio3iytfm  au o s0 rurio3oydolt mnetlt)srtaxr nu0tpx moetytla rmnmo (4alxomo3iydfpD lu sls0texoxo oy1lp emivi t)artmxront4tleoio3iltfa2uauvp t0trxnirctotfptelues;t0trurxrpnudomenmfet ()sDua(rpou1olt io3ilslaDrmu pnt0trtnmrcia1opDeai i t0 eurxo3iy1ap  micsa( sDtrx  ;o4texnifetadlsDumnmp;t4trxoir3oodoate n il( t2xoxmpnu1lme lnesatf Drm(  ot4tpeoii3iadls2umuvo (0tlxrmocia1opDrlnvs;()t2urxr3no1lm elics () rur(mooo0tpen fctat sDel(vp;(4 etrio ty1oatrlneolt t2xr(m iy4lp emnci (f 2rmx  ;u0olx iocilslsDrmnmo t4arenir iy1fa eai o t0 rto(m ny4om   neslsfa2ua(ront1tetnmiciys mDrlnms u4 rtoxf3tydlptrli il()srurxr nydal elics t  Drru pot0aexnmi3iysfs2ra(vp u0altrir ty1fa elnvi t0 2urirpno1apeemietls srtaum ou0olt mi3tytls um(vo;t4alxomr oodfatr neo s0tetoimpno4aptelicilt)s2ra(mont4tlt ifeiyd a eanvp;u) rtrmociodfat lneols)s2uo(r ou4lp n iet t)sDuaum oo4aexnmfciat mDemnmpn() rtoxr3oatlmDrlieilt tetm(o3iudal elnesa(fsDtr(ro;u4olt ifeild a rauvo;u0texnif oodlpt  i o;s  rurxr3ny1am n fci t)a2uau  oo1aex  ocilt sDelu s;t4altnxr3tatoa eliesls  2xoio io4ameemnct s)srurxmono0ape  f3tyt m2ulnvp;u0 ltrio3oadfp rlues t0setr(o iodapee fei s aDumu  ;u1apenmieiadlm rlnvo () ltrifcty1omDeau s;s)trxrxrpnu4omte nctas)sruaxrpou0olxnmoeiat m uaumo;u)treoifcoo1lm rlnvs ( srxo(rpiy1lptelfct s s2raum ou4tetoio3iyt sDuanms;u4areniociytopt  i slt teuoio3ou1ame lfctltf 2tm(moou1olxo fciysfa2emnvo;u4 ltoio3tatlm  ai s t) rtr(m oy4ale lictl()artaum nu0texomf3tltla emnmsn()artomf3tydfm eau o;(0seumxrpiy1lpenmfciasf Duaxm ou4opeoifcias aDua(vo;(0areoioctotopt ln i t)sexr(r iy1ape  iei t s2ra(rooo1aetnmiciasfsDeaump (0 lermo3oadomteluei t) 2tmxr3oy4lp n nes sf Drmuront0aexniictld a2rln p (0arxoir3tydlpte ueil(0 exrxrpiy4opt lfvils  rumuroou0apt  f3ild m rauvs ()texoif3oa1laDrli ols)sexr(mpiy4lpt mfviltfsDrrxrp;t1apx  i3tlsla2eaump;u4alxoxo3iodfaDrlu slt0trurim3nodoptn icias  rtmumo;o4ale ifcilt m2emums;t0aexnmrcoy1lp rau i;t)setmirpiy4amen neias  2ra(  ot4tpeo fciys mDumu p;(4artnmo3to1omD lies;s0 exmxmpnu4ap e nei t)sruax o;t4tpe mi3tld aDulu o u)arxoif ta1fmt  ivi s) exr(o3no1alenlictl(f rrrumo;u1tee mo3iytlmDel(ms;t0 ltniocootlatran o;() 2uo(r oudlltn fvia(  rum(moou1aet  feiydfs raumo u4alxrmociydlm e nes t0s2xo(o oudlm   neil()sDraur ;t4olxniieiytla umnmsn(4 ltrif3oadomteaiei;( trxmxrpny1ole liet t  2rrxmp;o4aexn iciat s2rm( o t0arxnxr iytoa e neo t0 eumxopnudomtemfetatfarrmu oot1tlx  o3iltlsDeanmp () rtomr3tytlat auvs;s  rxmiopoudlpt  icias)s2tmum nu0apxoiiciasla emuvo;t)altrxr3oadfpt  u o t  2toxr oy1oltn ietatfs2ururo;o1aeto iciad m el(vp t)tltoxr iydlat aivslt0 2ur(mpnydal nlfes s) 2ta( pou0tleomfeiatlmDrl( s;()aetrxo3ootlp rlu i;t)teum(o3oydllenmfeias)aruru onu4tpeomi3ilsls ra(vpn(0arxnifcoadfpD aneo;t s2xmir no1ameelivslsf ruax ooo1tlxn i3tltfs uan sn() rtoxf3ootfat  uvil(0 2toio3ou4op e ivsls) Drau  ou1aetnifciyt s rl(mp u4 eeoxfcoa1lmDeluvi () 2xrimpiydomtnmici s) 2ur(rpnu0aex mo3tydfmDraumo u4tleoxrcoo1op rln s s s2xoxo3iodome mnvta( sDrmump;o4apeniociasfm uanvo (0texnxo3tatlptrlivsl(  exrxm3iydalenlnvtatfartr(rp;u1aet  feias s ra(mp ()aexrxr tydla eln slt s2xm(mpoo1lme lfvt s  Dumumoou0aeen iciatfaDrmu p;u0alxoxr3oatomD  ivslt) ruo(o3iy4aptn neils sDrr(mp;o0tpxomieiadfs2ul(vo;()aexrxr ia1la eauvo t)texr(mpiy4lpee neta(f rumx o;t4alt  iciasls2ulnmo (4 ltnxrcoy1lat au o;t)sexmir ou1olt  fvtat s2trump;t4oleoifeiad sDrmn pnt)aetnxr3ta1fpDr u slt srtmxr3oudlm emiei () 2uaxm nt0oexnifeildla2uln onu0areoif3oo1oat  n o (0s2tmxopou1aptnlnvilt  rrmum no1opxoifeild m umump;u4tlenmo oytlmtr ies;t)setoxr3io4lpe mnci tfartrxront0opx  i3iltlm rmnvs (4alxoifcoydlaDeau s;(  2tmxm3nudlpt mieta(fa2ur(  nt1aeeo ociadlm um(vs u0aexrxr oo1lmtrauvsls0t2xrxo3no1llen fes s s2rmxm ot1aeeniociytfm2ua( ont4tlenxfcoadfmD aivsl(0seur(r3oudamtnmfesl(fsrtm(roou0alxoii3tldfm uaump;(4tltoirctotop  lu olt) etr(m3io1olte fes s sDraump;u4aexo i3iad s2um(vp;u)aexomf3iodoaD aivi;t0setrio3ny4llenmnctas)sDtmurpnu1aetomietys a em( s;t4 rtrmo tatom   uvolt0t2xoir io4lpe  ncsa(  2rau pou4aeenmfciysfaDra(mp t4 exoio3iotomt li i s sexmim nydolee iviatfa2umx pot4apeo fciatfa2rlumsnt4alenxfctytla   nvi;t0trtmio3ou1lmt  ncil() Drauro;t4olxomoeiyd m rau p u4arenmo tatlaDrliei s0srum(r3nudam nlicils arum(rpoo0tpto i3iydfa2rlnvo;(0alerxr3iy1opDrli s s0 exrxo3nydoptnlnciat)aDrrxrooo0tetnmf3iat sDeanms (0 rtoxr3oydfaDr iei s)seumxm3no1oltemivta( arrrx oou0opxomiciat mDelu p u4trermr3iodlmteluvs ( seuoim3iy1aptemiciatf rrrxmo;o1ape ifctad s em( o u4 leomr ia1lat  ueo (0 2to(rpiydam  mncs sf 2trx  nu0olx moctydls2rlums (4tlxomociatlmD  iei;s)s2tm(o3nu1lp emnvt t)a2rauroot0oex ifeiysla rlumsnu4 reomfcoytlp rau sl( sruo(opoo1apt  fesa()sDra(r no4oexn fetas sDelnmsn(4tltoxf oadom  anvolt)t2toir io1lpee nvsltfartm(  ;u0apeniictls sDulnmont0texnxo3oodfaD aieo;s0s2uo(r3iydope  ietat a2um( ono1tptnio3ils s2rmums u4tltomfctodopt lueil()srxmiopiu1lm eliesls  Dum(  ou1tlx mictlt sDul( pnt0aetrxo iytfaDeai i;s) 2tmirpno1op nlivsasfsrrr(m nt4aeen feias sDrm(vpn(0trtoio3todfpteaneo;s0 euriopnydamenmncils) rum(rpou1tptoif3iysfs ulnmo;t) reriocoadfa r ieolt)s2to(opoodal e iviat s2taumo;u4alx iiciydfm ua( s;t4artoif oa1oatrai s;s texrxo ou1alt micsl( s2uaxmpno4alxnmf3tasfsDrau o (4arxnio oodoptr uvi (0 etmim iu1op e nei tf Durxmp;u4opto octld s2umums u)teenif iy1lmD lueo t  euoxmpoydalt mivs s  rtmxr nu1texn oeilsfmDrl(vp;(4 rxrxf oydfa  aneo s0sexrxr ny4ol n iesa(fsDua(root4tet  o3iadfa uluvo;t) rerif3oydop raneo;s0seurxopiydlpt liei ( sDraxm nu1oex mi3iatls uluvp u)trxnif todlmDr i s ()t2urxrpnu1al   nesat)s2tmumo;t0tptoiocias aDrm( pnt0 rtrxrctytomt lnvi t)t2umim ou1altemiviatfa2ra(mpnu4ope  i3iat s uln s t) eenir oatlp ean s;(  etr(r3nudlmte ics (f Draxmpou4ole  ieils aDulums;u0trtrio3oadfmDr uvi s)s2uo(o iudaptn fetasfsDrm(r ;t0tpxoif3iyt mDea(vs;u4 rxrmrciydlpteauvs ( srxm(o3ny1oleemncsas  ruaurp;o4opeo f3iytfm2um(vs;()tltoio3iodfptelues ()srxm(mpny1lpt  ncils) rtrumpou4tptoiociatfs ua(vp (0arermo oo1fpt livo s0 eum(opiy4apt  fcsa()aDum(m ;u1tlen ocias m rau p;t0tltnxo3ia1op   n o;( tetrxrpoydlmte nvslt) 2tm(rp;t0aee ii3taslm2rl( s t) rxoxo tadomD aieo t seum(r io4lle lfvia( arrm(r oo1alxoifeiad a eanvs;(4 rxrxfcoytfmDr uvilt)srxo(o3nudlm nlivtlsf 2uau p;t4apt mietat sDeau s (0tetomr3iadoaD auvils0srtmxopoudll nlnei (f 2uaxmont4olx iieiadlmDelu o u) rtrirciotfp e ueslt) rtr(o oo1omeemnvtl()arumump;t0tlx  o3ilt s2umn ont4 lxrmoctytoptrlivi s trtrxrpnudamt  fesl(faDtm(  ;u4tleo ietldfaDuln pn(0teeomo3iadlpD  u s;t0tetmiopny4apenlfeilt sruax onu4apeomoeils s ulumo;u) reomfcoodfp   ieils) 2ur(m iy4lme mncia(f 2trx  ;u4tpxnifeiydlmDulu p u4 rxnif ootfp eluei t)trurxr iu4opt mivs s s2tmxmoou0alxn ictaslsDumnvonu0tltomocta1laDeaivsls) rurxrpoodlleelfcsasf rtaumpoo1texo fctyd m2ua(von() exoif totomt aueols0setoir oy1lmtelnvia(  ruaumpoo1altnmo3iytlmDum(vo;(0trermo iydoatrlies;s)srtm(o oo1lmenmnvsa()sDurx o;t1tpxnio3iytlaDeluvsnt)tlxoxr3iadoatrlivi;s)s2uo(o ou1lpe lietas sDrmur ;t4aptomictaslmDem(vo;u0 reomf3tydlm e u ols) rtmxrpoydoltnmnviltf 2ur(rpoo1aptnmf3iatfa2ra(vsnu0aexnmoctytfpDeln i () 2xm(r iy1altnlnvt tfsDuru  ou0aex  ociydfa2ul( s ()aetoio iodomD  ivs t) rtrxr iu4lmtn icta(fs2trx pou4oeto oeiatfs2rlumon(4 leoxf tatfa  luvo t s2tmio3oy1lp e nvt sfaruax p;o4aee mieiasfaDranmp t) etomo ty1fp r u s (0sexmio3oodomtn ivtlt)sDrmx pou0aex mfetadlaDum(mo (0tlenmf3to1lateaueolt0texoio ou4lpee fct (  Dtmxrpnu0opto f3tldfm rl( o (0 lxnio ta1lmDelueils teumxo io1lpenlfes t  Draxmp;o1tlenmieils sDelums;() lxrmrcio1optrau s;s s2xoxrpno4openmfvs t)arrrx ooo0olen f3tld sDua(vo t4arxnmf ta1lpDe ivsl( setrxo3oy4lltemnes tfaDraxroou1opeo fetyt sDumu on()areoxo todoaDran o (0setr(m no4lpe  ncias)aDumum ;o4aeenmocild aDua(mp (0tetoxr3to1fm   uvs (  rtoxrpio1lm   feilsfs2rm(r oo4aeenio3tys s uanmpnu0 lxnirctytomtelivi s0t2xrxopoy4lm nmfvtl(  Dtmur ;u0tlxniietas s2ul( pnt)tetnmo3tydfmt luvo t0sruoxm iu4llenlnvils s2raur ot0oetn o3iys a2rmnvsn()teenir tytla elies;t setmimpoo4opeelietls) rraum ;o1aeeomfeiasfm el(vs (0areoio3iy1oate nvi;s0 rxm(r3iu1lp nlivs (fsDumuroou0optnmi3iadla2uln p;()trxnmf ootlmDr n s s0 rtr(m ou1om e ncslt sDur(r ;t4tlxnmieiadfmDeln p;t0alenir3ta1faD lu s ( setmxm oo1ll nlivt s)sDtr(rp;t4aleo fciad a2emuvp u4arerif3iy1oa   ieol(  2trxm iy1llteliviat  2rm(r ot4oeeo ociydlm2rmumo;u4tetrxrcoa1lpteai o;(0 eum(m io1lltemicslt  ruax p;u0ape iociaslmDran s t0tetomo3oadlmt anei;(  exoxrpnu4ol n ict s) 2urxmono4tpenmoctasfs ua( o (0tltrmfcta1omtranesls  2uoxopno1op nlivsl( aDuax  no0tlenmietys sDeau p (4arxrmo3oytoa rliei;(0 rxmim iu1lleemnct s aDra(rpno1olt iictytfm rl( p;(0 eeomfciotlpDelu s t texmxm3iudol n nvt s)s2uax pou1altn oeiydfm rl(vp t0 lxnmo io1fa  auvils s2xmir nu4lpenlivil( arra( onu0teeo ietyt sDemn pn(0arxnif totfpt lueo;s0seurxmpou4om emfetlt  Dta(  ou1opx ifctat a rmu p;u4tltomr3ta1fpDraueslt) 2xmimpny4lpt  neta(fs2rmu o;u0aptnmf3ilslaDrmnms;t0 rtnmo ootfaD  neslt  rtrirpiodlpt  ncta(f rur(ro;t4oltomfeiatlaDeau p;u0treomo3iatomD anesl() rumxm3no4lmtn fctls s2ua( pnt1tpxniieiad a2eanmpnu4 lxrmoctydfp  anes () euoir3oo1lpeemicsl(  rrrxrono4oee mictad s2rmuvp (4artnircoodlmt anei;s  eurxr3ou1lmeelictat)srurumooo4olx  ocils aDranvs;t0trerxfcta1oaDeaueil(0 rxoxo iodlltelfvils  rta(  ;t4altnmo3tltlmDrmuvs t4arxrxrctydomtr uvsls)trurxmpiy4ale liciat arur(rpno1texo oetad m eaumon(0 ltrxr tadoatran i t)teurxm ny1am nliei s)aDua( pou4tee ioeiasfsDuan s;u4tetnmf oytom eau ils trtrxrpoydomtnmiesat  2um(ro;t4tlt  feiydfaDeauvpnt0 exoiocoytlmDrlueslt truoxo3oydlpe mfcsasf rur(r ;t4apen feiad sDem( o (4 exnmf3iy1latraivo;s0s2umim3no4lmtnlfei tf Dra(mpnt0ale iictlsls rl( s;t0artnir totfptrai ol()t2trxm oo4lm n fvslt)srta(rpnu4tpxo i3tat s rl(mo;(0aetrio3iytfpt an s s  exrir3ou1lltn fesatf 2rmum nt4olto f3tld s ul( snu4tlenmr oodfpt an ils t2um(rpiu4lle  nei s)s2rr(r no0tpx if3iadfa emump;(0treomo3iadfp eluei s0t2xo(r3no1ap  mnet t)aDtrxmo;u4ape  i3iatfs2ranvo t4tleomrcoydoatr i s s teurim3ou1aleemnvtat s2rm(  ;t0tle ifeiysfs emu o;(4aetrif iatlpDr i o t trxm(r3oy4amt lfetlsf 2ra(rpnu0alenio3iasfm2ulump;u4trerif3iadfpD aueo () rxmirpoo4ol nmivia( sDtauronu0tltoiociat m ulu pnt0 eermo oa1oatrluvolt0teuo(o iudlmtn ncilt sDtm( p;u0tet iieils m2ulu s t4arxoif3oadlptr nvi;s t2toim no4lle  ivs s)s2ua(r ;t4apeomf3iltls2um( sn(4aeerxf tatom   n s;(  exr(opou4openmfeils  Drr(ro;t4oeeniieiys m2ean p u4tlxrircta1oa r u s;(0s2tmirpiudllee netat arur( pnu4oetomociytla2el( o;(4 lxrio3tatlmDe i sl(0 exmim oudlm elnct s sDtaxront1opx iiciadls2eauvs t0teeoxr iy1lm elu o;t0t2tmirpno4alt lfci ( srtau p;o0ole miciytfmDemuvpn(4treoiociy1lmtranvo;() rxrxm nu1lmtn ici ()s2ta(m nt0opeoioctadfa rauvont0trtnxo3iodfmte ies t0 euoxr3nydalee nesatf 2trumpnu1tptnioeiyd mDel(mont) rtomrciy1latraues;() 2trxr3io1omeelict tfaDuaumo;t4olxo i3tys m raumsnu)alxnxf oy1la   uvo () eur(rpio1op nmnvias  2tru o;u1alenmfctasls eanvo;t0alxoifcoytfpteauei s0texrxr oy1lm elnet sf Drm(r ;o0tpe  fctydla uanmp;t)aleoxrctytopte nvs s)sexm(m iu4omte ieilt)aDra(rooo4altnif3tydfsDeauvs;u0tlxoxocoo1fat ln o (0 rtm(r io4apte ies (  rtrx oot1aex  fciyt a rln s t0aeeoio iotlmDrli i;t0truo(o3nodap nlnet s)arum(m no4alxo ociadla2rluvo t4alenio iatop  luei;t0sexmiopno4lp nliesatfsDrr(  nt4apenio3tatfs rlnvpnu4arxnmf3iydfaDrauvi s0tetmxmpoy1optelfcslt)aDuaxmpnu4oex iociytls umnvp;u)trtrmf oo1omt an il(0 2xmio3oydap nlfvslt)srumxmpoo1tpt miciltlm eaump u0tlxnircoadla  aueslt)sexrxr3iodlm elfcs ()aDta(rpno0opeo feias m2uan sn()arenmr oatfpDr ivs;t0 rxrio oo4oltnlfesas  Dtau p;t1opeo i3iyslm2um(monu0tlermf tydop e uesls)srtmxr nu1lmtelnvtas)a2raumpou1opto fciydfmDelumo;u0 lxrxfcia1fp   nvi t)seur(opou4apte iet s) ruaxmonu4oetnmfeiysla2em(mon(0tleoxo3tydfp   uei s  2xrxopou1llt mnesa()s2tm(rp;o1apt  icils aDrmuvp u4trxrxocoo1lp eli i;t)s2trxo iy4llt lict (f Durx onu0optn i3ildls2rlnmo;t)alxomo3ty1opte uei s)trtmxrpoudale  iei (f rtmu  ;t1oleomf3iasls umnms;t0tlxnxf3ty1op raneo t0trxmir3iy4lmtn fet () Dtax  ;t4optn fctysfa rmn s t)trxnxr3tatoaD  ieo;s0srxr(m3oo1om  mnvtasfaDumx o;u0ope if3iadlaDuln o;u4altrxoctydfmteauei () rxr(m oy1omt mfetas) Dum(root0altnmo3tyd aDelu o;t4alenxo3oo1fateauvslt)srtrxmpio4ol elivi tfartmx ono1tlt mfcildls rmumo;u4artoxo to1lpt  nesl(0 rumim3oodlp nmnet tfaDtrxr ot1apxnmieiasfs2rmn snu4altnmfcoodlm  livi;t texmim3oydome  fvilt)sDtr(rpnu4tex io3iltfm2el( o;u)aexnxo oatfateau i;t0trxm(m3nudamt lfcias sDtmumpoo1ope ii3tls m2eanmo (4aetoir iydfaD aieilt0srtoxo nu1ap nlfesl() 2uaxmpou0tee mf3tadfm2el( o t4tetrmr3tadfm elnvo t) rxrxrpiu1lle lfci t)a2uau pnt0texo fciatfmDemuvpn(4 reoxocia1la   ues s0seto(m3nudapenlfvs ( sruaum oo1oetnmocilt a eanvs t)tltoirctatfat aivs t0t2xo(opiy4omeemncsat sDra(m oo0oexoiieildls el(mo;(4tlerir tatopD luvi (0 2urir oudapen nvtat)srrm(root0olt if3tadfmDuanvp;t)teeoxoctydlm elneo;( trumimpiu1om emies tfsDurxrpnt1oee  oeild aDeau snu0tlxrio3oadopDelieslt)s2toxr oy1aptnmicsltf Drrxr oo0tpx  fetysls ran on(4 etnmo todfateai o;( s2xoim3nydlle  nvsat sDtrurpou0tpeo oetyd s2ranvon(4 renio3oa1fmDraiei;s0t2uoimpou1apen nvt (f Draxmoou4oex mieildla raumo;u0aexnifciadfp rln s;s)setm(r oo1lmee nvtat aDtmxm ;u1oltomoetad aDelums;u)aetrxfcoytlaDrauvilt)sruo(r3nu4llt licils)sDtrx  ot0aleomo3iat m rm( s (0aetoxfciydfpteluvs () 2toimpoudlm nlfvs tf 2tax ono0alx  f3ild a ra(vsnt4aetrif tatoaDraivslt0truoirpiu1optemiesat)artruro;o0aexoiiciadls2rmump;(0aeeoiocoodoatr ieilt s2xr(opnu4lmt mnct ()sDtmur ou4tle io3iadfaDraumo ()tleriocoydfatrliei;()trumxo3iy4lpe  netltfsrurxro;o1tetn fetys s ranvpnt)trtoxrcto1omD ln i ( srxrio3no1lptelivslsfs2taumont1opt ioeiltfm uanvs;t4 ltomocoodopDrlneolt  euo(opiodopte fcil(faDtmu  ;u4oex mf3tadfm rm(vsnt4aetrxo3oadfate nvo;(  2umirpou4omeemfei s)sDurxm oo0tpx mietlslsDrm(vp;() rxnxf3to1lpt  i o s  euoiopou4op  lfvsa()s2raxro;o4olxnmo3ilt m2ulu ont)texnmrciydfmDr uvil()srurir iy1lmen ics sfaDrau ont0aleniociatfs2ul( s;u0 reoir3tadfmDrai olt0 eurxr3oo1am elfcils srumxmp;t0tetn f3iyslm emumo;t)tetoir3oatla eai slt0 exmxmpiodam n fvt (  2tmxmp;u0tpeoio3tydla2ua( p ()aeeoir tadopDr nvslt) exr(m nudopee ncsa(fsrur(m nu0opt mfetysla2ea(vonu4 lxrmf3ty1fate i o s  etmir nu4om n ncsls) rtaum ;u0oleoioctaslmDulnvsn(4altrxfciy1optr uvs;( srum(m nudom elnvs () rum( o;t0aleomoetydfs2ul( s;t4aeenif todoateai s ()trxoxm3iudop nlnct t sDur(m ou0apxoii3tytfaDraump;u0arenxrcootfaDrlueilt t2um(o oy1amtelfcsasf 2trx oou1apxo fetysfa2rmnms;u4artrxo tytlpDranvi;t0 rxo(rpnodoptelictlt a2umxmooo1alt mi3iad a rl(vo;(4arxrmr ia1oaD  i slt) eumirpoo4amee fesas) rurx pno0oltomoeiydlmDua( o u)tetomo iotopDraivi (0t2xrirpiu1ame  ici t srraxr ot4alenifeils s2em(vo;t0 eeoifcoy1lp  lu s ()trumxr3ou1aptnlnei s) 2uaxronu1oet  icilsls rl(vp (4trtoxr ootla eauvi;s0texm(r ny1lm emnctltfs2uaxmp;t4tet mietyslaDuau ont0 reoxf iatlmDelieo;t)sexo(o3nu1lm  mfet t  Drrur no0apx  fciasfm2ulump u)altrmr3tydfptr ieilt0trtr(m iydolenlnesat srumx o;t4aeenmoeiat a2ra( ont)tlxomr3oodoaD  n o (0s2xmir nydal   feslsfs2rr( onu4tpt ii3iyd mDra( s;u)arerxo3oatoaD  n i;s)tetrxo ou4ole mncsat s2taurono1oex moctldlmDuauvp t4aexrxoctytfmte uvilt  rto(rpno4lpt lnetl( artmumont0oet mf3tlslsDrlumo (4tlenir3tydomDelues s0texmim3io4op nlnci ( srumu o;u1apenmfcilslsDul( o;u)tlxnxf3ootoa eliei (  2xmim ny1lpt  fvt t) Drm( pnu4tlen o3iydfa ua(vo t)trerxfctydomDranei s  2tmxm oo1am nlnesa(  Dra(  oo0aeto ictls s elums ()altrifcoytomDr uei;t sexrxmpnudlpee fes sfarurxm no1tlxnmf3iatlsDumuvp ()aeermo oa1lm   ues;s  eum(r3nydopenmnctltfaDum(m nu4oex iocils m rmu pnt0 rtnircoatfmDe i sls s2xoxmpiu1al  lncslt s2umxrooo1tltnmictldfa rauvo;t4 eenir iy1fat  nesl(  rxm(r iudole lfvta(f rta(rpou4tpen ieiytls2ran s;(4altoircoytfatrai ils) rxmiopoodomtnlncsatfarrrumpoo0oltoiieiad a2umn p;u0artoxo3to1op   nvi s0sruoxr3iu4ap e ivt t a2rm(ro;t4aexniieiadfa2elnvo;u4artnif3io1oatean i (0s2tm(o no4lp elfet s)aruax p;u0aex io3tytfaDrmuvs t4 rxoifcoy1faD  ieo s)srxo(r3io4ame  ictas) rtrum ;u1tlenioctat sDrmuvsnt0 exnxo3to1op r n i (0srumxo3oudomeelfetls srrmxmoou0apenmieiysfsDemu on(0trxrmr3ty1fmtrlneo;s0t2ur(r3ou1op nmivtlsfsruax ont4tetomfciyslm uanvsnt0teerxr iodopt liei;t0 2xo(m3oodaptn iet (f Dtru p;t0tlt ii3ias s rlnmp t0areoifcoa1fmDe i s;s s2uoim3nodlmeelfcs s)sDtmur nu0oexomo3tadla elumsnu0tlxoio iotlpD anei s0t2xr(m3iu1lp n icslsfa2uaxmpno1oexoiieiat m2umumpnt)areoxf oy1oat lnvs;s)s2tmir iy4openlietas sDur(mono1apxniiciatls em( p;t0artrxf iy1fp r neolt0trurim no1lpen fvta(f rtax  ;o1opxnmieiyslm2eau o u4alerifctotlat lues ()teuoio nodopee nci (fsrrm(  nt0tee  i3iatla eau o;(0tltnmo todlatr nvs;s trxr(mpoo4aptnlietl(  2uaum oo0ale ifciltfa2ra(vont4 lxrmr iotlm e uvol(0 exrir3nodome mnvi t a2rmx oot0teeoioctlslaDemuvp t)artrmocio1fm eaneol()texmxo3oo1lpeemnvsatf rtrx  oo4olxnmoeilt a rmumonu0trtrmf iatoaDeaies;s) 2urxo oydome mivils)a2uau oou1ole mi3tlt a2ra(mp;t0tlxrir ta1oat anesl(0seuo(r ny1lpee ncslsfsruax  ;u1oltn icilsfm ranmp;(0trxrmo iatop rlneol( s2umim oo1lmtn nctasfaDur(mpnu4altoioeilsfm ulu s (4trenmrcty1faDrai ols0srxmim nudlp   net s artru  nu4texn ieiatfsDumnvo;(4tlxnmo3tytomtr ivi;s)teto(m io1lpenmicils)aDtax p;u1aptomi3tldlsDra( sn(0tlxnmf3iotoatelieolt) rxmio3no4lpe lfvsa(fsDururpoo1tlenmfciatfa ea(vsnt0tlerir tatlm r u s;t)trtm(o iy4lmenmfctls)s2tr(mo;o1aeen ietasfm2rmuvonu0aeeomrciotlmtranesl( t2xriopoy1apenmfvs ( sDum(roou1apto i3ias sDulu on()arxomf ty1lp  an s (  2tm(o3iudop   ivtl(fartm( oot0oltoiietatls ea(mo t) lxomo io1fpDe ivi;()teuoiopoodome livil(fs2trxrpou0tptoioeiad s ra(vp t)artrmrcoa1fm r n olt0teto(rpny4ope mnvsas  rumxmpno4tlxnifctyt mDumuvon()arxoif3ta1fp ran s;( t2trxo3iu1om nlnei tf 2rmumoot1tltn oeildfsDel(mp u4tlerif3oo1lat aivils)t2xmir iy4amee fesat  Drr(ronu0optnii3iyt m2ea(mp t0 rermf3oatfmtrlnvs;t0s2tmxmpnu1altemieia( aDua(  no0tleo fetys sDua( pnu0 lxoxo totfp   u i;( s2xr(opoydale lictlt  Dtr(  oo1tex mfcilslsDrluvs (0 rtrmociotoa  aivs t seumiopnu1lm nlnetl(fsDurum ou4opxoii3iyt m eau pnu) exomrcia1oa  lnvi (0 etm(o3oydol nmfvsls srua(mpot1opx  i3iatfsDum( snu4 exrir3tadom rlnei;s0t2xrimpnodam n feil()aDtr(ro;u4texomo3iatfmDrmumo (0artoxr iy1laD  nes ( texo(m3iydlp n ncia()aDta( ono1apt  oeiasfmDrm(mo ()trtrio3iy1faD ai o;t trum(opno4al nliviat)sDurxront0tee moetlsfa2eau onu4 rxrmoctodopDraivs s0t2um(r ny1lp nlncsls)sDrmu ont4aex mfetadla2eluvo;t4 ltomocty1laDe uvo;s0 2uoxm3ny4ol  mfeia( artmurooo1oexn o3ilsfaDelnmp;u4 renxr3to1fpteaues s)trurir3oy1al elfctls a2urxm nu1tpe mfctldlm rln on()aexnxf tatfatr nvo (  2umim iudomee fet t)aDrmu  ;u1tetomf3tytfs2ulnvp;(4trtnmocto1om elivo t0t2ur(o nu4op elicsl(  rrmxrpnt1oeenio3ils aDel(ms;t4 lxrir tydlm raueols)setoiopoudamt  ivil( arrm(m ou1teeniocilsfa2rlumsn() lxrmfciotomt  ivo s)texm(o3oo1lmtemnvsas arurx onu4texn o3iytfm el(vsnt4altoxr3iodlpD an ols0s2xrxo3ou4amee nvt s s2tr(roou1apeomi3iasfaDem(ms;u0trxnmr3ta1lat luei s0 exrio3nodal emicsls) rumx oot0olenmi3tltfm rl( sn(4arxoif3iadop r nvil(0 2xr(r3oydaltelfci tf rraxm nu4oee  ietadfs2emu s u)tltrxf3oy1oaD ln ol()srxmxo iydlmtemnviltf Durx pnt1opt if3ilt sDul(vpn(4areriocoytfmD ai s s0 2tm(rpoudlle mnei ()sDtrx pnu4tetomf3ilslsDem(vont)artnxo3totfpDe u i;( srxo(m3iu1ameelivtltfa2raurpot0tltniictadfsDum(vp;u0 etrircta1lpt lies;(0srumxmpnudamtemfcil()srtaxmont4oex  oeiadfm2uanvsnu0texnxfctodom r u ilt) eum(m3iy4ll n nctl() rrrxrpnt0tpe iictldfs ra( pnt)aetnmf tatoaDeauei;s0seumxo3oy1lmenmics (f Dumx  ou4altoif3iad a2ranmsnt)tltoircoodfpDelu s;( trum(m3oy1lm  mneilt)a2tr(ro;u4oltnif3iyt m2ea(vp;u4tlxnmfciy1om   nvs s) etmir ou4oleemiesasfsDuaurooo4alxoio3iytfsDemumon(4artrmfciydlat  u olt seto(r3iudlptn fvsl(fa2uaumonu1alxomoeias m ulnmsnt0texnxr oo1omtrlnvi s t2um(r ou1omee fvils  2rru pnt1tpx iietad s2emuvpn()trxnmrcta1laD livil()sexriopoo1apt  nes ()srtrxr oo1optn fcilsla2em(vont0aeeomo3iodoat lueolt0s2umxm oo1ll   fetltf Duaum ;u4tleoii3ias s ra( s (4teerxrcoadfaDrln i;()trtoxopoodlp e nvtlt)sDra(mpot1tleo iciad m um(msnu0 ltrif iotfpDe ies t) 2xrio oo4lp nlnetlt arumurpnu0teeomi3ilt a umnvs t4 rtrio oadlpDeaneo;( srxmir3iy4omt  iet ( sDtmxr ;o1tee  ietlt aDel( sn(0altriociodlaDr nvsl()teumim3oodope mfvs tfa2tm(moot1oet moctldls emu p (0areoxrciatomt livo;s0 2xr(rpnodalt  nvtat)s2rau o;t1opeo f3tlt m ea(vp t)aleomoctodomteanvi t0 rxrxo iudlmte ivt t)s2rrumo;t1tpxn oetasls2emuvsnt)tetnir ootlm ran s t  exoxo nu4optnlfviat  Dumx pot1tpx  o3iysfm2rmnms;u) rxoio iodopt liei ()srxrio3iu1opt mivslt s2rmxront4aetn oetatfm2ean pn(0 eerirctadlm   u sl( s2trxr3oo1olenlfes t) Durxrpou0oltoifeiys s umn o t)aeerif3iydom rauvs (  2um(opiu1amt lfes sfa2tau pot0apxn oeiysfm ul( s u4tetoxr3iy1om e neol()sexr(o ou4apeelneil()a2raurp;u0apeoifciatls ean s (0 lxoxociadfmteanvi;s  2xrxmpoy1openlivsl(f Dur(mo;t1ale mociltfm rlnmsnu0trxrir3ta1lp  lies;(0 euoim oodap e nvtlt aDurx  ou1tptn o3tysfm um( sn()alermfciodlm e u s;t0srtm(opnudlptnlivsat  rrmx pnu1apxnifetydfa2eln o ()trtoxrcoytopD au ols0t2uoimpiydap n nesatf Dtrx pnt0tetn fctasfsDuan p;u0trtrmf iytfa  anvi;t) exrir iodamtnmfvt (  rrm(m nt0ape moeiad aDum(vp;()aetomo3oo1fat au i;s s2tm(o3nu1apeelfvilsfs2tr(r oo4tlx  o3tas aDrmu o;(4 etrio iydomte uvo;t t2trio iudomee ncslsfs2taxmpou0oltniieilslaDemuvp;(4aeenif ty1laD  i i;s0 rurxo3ny1om e icsls arrmxm oo4ole mietydfa2rluvo;t4aexoxfcoy1op raueslt) rum(opio4amenmfcta()sDrrxmo;u1oetomfetydlm2rmnmp t)altrxf3iadomDr u s;t0sruriopio1ame lncsl(  Dtaxmoou4opt  i3iydfa ua( o;t)aetriociytopte nvo;() 2um(m3ny4ameemfcsl( arrrxmonu1tlenifetys sDrlnmo;u4tltrmr oatfm elu o t tetmir3iu1apt  ivi t) 2urumo;o0tlxomoctasla rauvp;(4 lenir iodfp r n i;t0t2xoxo no1aleelfvil(  2ra( poo0oex  oeiasfmDrmnvsnu4texoxf3iadlp r ivsls  2uo(r3no1opte fvi (fs2rmx pnt4oexoifciadfa rlu p u4arerir ta1oaDeaies;s  2tmxm no4amee fcsa(fa2ur(m no4tpe mf3ilt m em( o t0teerif ta1op e uvsls0setrir oydomtnmici t  2taxro;t4teeo i3iydfaDrlnvo;u4artoirciatoptelneo s trxmimpnodlmt mnctltfarumum no4tlt mf3iyd sDul(vs (0 rxrxf3tadoaDeai s;s s2tmxmpnydlm nlici s  rrr(r oo1aetn fctytla emn o;t0teeoif3oatfatelnesl(0texrxr3oydlm nmicil(f rtm(  nt4oexnio3ilsfsDeanmp u)aetrxf3iodomt  ieo;s0tetr(r ny1olenmnci (fsDtmum ;t4olx  ieiatlmDuanvs;u4aeeomo3oytomt luvolt t2xm(r3oy1ole lfeil()sDumx p;o0opxomi3ilsls2elnvs t)tlxomrctotoaD lnei s texoim iy4omt  nvtas)s2tmump;o0tpto iciatla2emnms t4 renxo iotoptean ol( sruoxm oodal emivt ( s2uaxmp;u4apeomi3tydfaDrl(mo t4aeeoxo oydfatrln i (0trtr(m3oo4lm nlnvtas aDrmxrono4aleo ictld s2rmn o u)aeermrctytlpt lies;t) etr(m3nydape  feta()sDrrxrp;t4altomoetasls2eluvs;u)tlxrir ty1optean ils)trumim ou4omeemnvt sfa2truroot4tex  i3tyd mDua(mp t)tleoir3oatlpt lneilt  rxmxr3iy1omenmivtlsf rua(rp;t1tlxoii3iadfs ulump t)tetoxfcoodlp elnei;s  2uoxr ny4om   ncils s2tau ono4altnmiciysfmDrmnvpnt4aeeoir ta1lmt  u o;s0 etoxm no1op emivs s s2rrum ;t0oeenmiciytfsDemu snt) ltomf io1fpD lieo;(0 2to(m nu1llen fvi ( aDrmx  ;u4apt  fciltfa2ulu o;t4texomr3oodfa eaneil(0seumxm nodoltnmfci t)sDuaump;u4opeomiciadfs2rlump;u4aetrif oydlp   i ols) 2trxmpnodom   fcilt)sDrrurpnu1tpeomfctatlsDul(mpn(0tltrxo ta1oaD ln sls)s2xmir3no4lp n fvta( srurx  ou4tpe ifcils aDrl(vpnu)aexomf oo1omDrli i () euoxmpio1alt miei ()srrax  nu0apx ifeiadfsDrmu s t4tlxoxfcto1lp rlues s teurio3iu1ape  ictas)a2tm(mo;t0apt mfeiydfa2um(vp;u4artrmo3oytop   n sls0setmxmpoudope  ictasfsDumx o;o4oexnmo3tatls2rau o;t0aexoxo tadfpDeaiei;(0 ruo(mpoy4omenmfet ( a2ra(r no1alx iociltfmDrluvon(4 rxrmfctytfa  lnvs;(0teurxr3iu4ll nmicsatf 2umumonu1tlxnmfeiadfs2eaumo;u0 lxoiocoa1lmDraueol(0 2um(rpny1ale lfcsls sDumxmo;t1alxnmfeiatlmDulnvont0tltnxr3ootomD anei s0sexr(m ou1altnmnvsa()sDraxrp;o0oeeo fciytla eln sn() rtrir iy1omDr nvs;s seuoxrpnydlmtemnvtl(fa2urxmpnu1aptoiieias sDumump u4teerirctotlm   uvslt t2umir3iy4lmen iciasfs2tr( o;t1optomictls m2uanvo;(0 lxrmfctydop e ueslt) rtrxr oy1ome  ncilsfsDum( pot1alxomf3iyt a2rau p u4aeeoxf3tytoa e n i;t seurxo3ou1optn ics tf Dta(rpoo1oee mf3iltla rm(mp () exrif iodlpDe u ilt0 etmir oy4lpenlnctlt)sDur( o;t4aex io3ild sDem( o (0 lxrxf oytlate ues ()truoxm no1lp elivs (f Duaxmpnt0tpxomf3ildfaDra( o t4altrir oo1oa eli sl(  rurxo nudll emfcsls sDuaxroou1tle io3iytfs2ul( p t4aexrxo oo1lm  li s ( sexoxrpnu1ll nlnesat) 2rau o;u4alx mfetlsls2em( on(0 lenxrctatlatrlnvo s)seuo(o ny4lmteliesls)a2rax oot0ope mociydfaDrmu s;t0trxnir3iodlpDr ies s0 2xmim3io4oltemfeta( a2um(roou1tpxomoetysls2rm(mpnt4aexrxocoo1lmteaivilt0srxoxm3no1lmtn ieils  rtrxmooo1optomictlslsDean onu)tltoxo3ootfaDe u olt)truo(m nudaptemnvils)aDurumpoo1opto fciadls2ran s;() etrifcio1fptelues;t t2urxo3ny4al  mfei s)srrmxm nt0tex  iciys aDrmuvp ()artrxrciodopt  i i;s  2xoxo3nydoleelivilt)a2rr( poo4apxnmfetydfsDulnmo;(4 etnxr iy1fptrlneols srxo(m ny1lmte fet t)a2rmu pnt1altnmociat mDuau o;u0aleriocoo1opD  nei;t)seuo(o3nudlmenmnci sfsrum(mpnu1tpxoiiciaslmDua( pnu4tlerif3iydfaDrlu i;s t2tm(rpiydom emiei s artaxm ;t0oee moctytfa2rm(mp t4aexnxr3oadoptean olt0 2xm(m3iudal  mfvtat  Draumpot0openioeiytlsDel(mo;t4 rxrmfctadfat au ols0texmimpio1apenlivils) 2trum nt0opxniociydfs2rlnmonu4artnmo3oy1omtr ieo;s  2umim3iydapt  ict sf 2ur(ro;t1tlto f3iadfsDrl(vo;u4trtrmo3tatoptrlivi;s) 2tm(mpno4optn fvsl(f Drmu ont1texomfciat a2ran s;(4arenirciatfp r u olt seum(rpno1lpeemicsls) 2rmumoot1tex mo3ilt a ea( onu0tetomfcta1omDeau i;t0 2xmxopiodlm  mfctls) 2uru  nt1alxnio3iydfaDem(vsn(0tlenmf3ta1om  ai il(  rtm(r iodlmtn ict tf Dtaur nu0optnioeilslsDrl(vo (4tlenmr3oo1optrlivslt teuo(o3iu4lp elivilt) 2rm(ro;u4tlxnmfcias m2umnmp;(0trxoxo3iytfaD  i i;s)s2umxr3iydal  mncs sfsrum(r ot0opxoio3ilt aDumu s t)trtrmf3iy1op  lueil()s2urxopnu1ap elfei sfa2rm(rpoo4optniietadfs2ran o (4 lermfcto1lpDe ivi;( t2tmxr oy1al emivia( sDrm( pot1oeeniieilt sDranvs t4 rtrxf iotom eau o t)seumimpiy4ap nlfcsls sDrru pnt0tptnifetadfm rl(mpnu) reoio ta1fpDelivo s)t2toxm3nodlm  lfctl()a2tmumo;u0alxnmfeiyt sDrau s;u)alxnxrciytoatraiei s0s2xr(opno4altelnvtlsfsDurxr no4teto o3iasls el(vs;u4 etrxr3oo1la eli s s0t2xr(rpny4ol e fvilsfsrrm(m nt0olxoifcild s2uau s t0tleoir iadoat anei;s)t2xoxopno4ol  lnvi tfsrrr(r nt0olx ifctldfa rm( s;(4altomf3to1oatr u s ()teumxm ou1om n fvt t aDrmumoot4aleo f3tld sDelnvs;u0 etrif3ia1fatrlneo;t)seuo(o nudomtnmnvs t)a2tmu  ;t0oeeo feiadlmDumu o u)aetrif3todoatrauvi;s s2xm(m no1ole  ivt t  2rrxmonu0tpx  ieiasfa emumpn(0artoioctatlaD aies (0texm(m3iu4alenmfcsls)artrumont0oleoifctyslm2elu p;t4 rxrmo iytopD aivi s)sruoxo ny1oltemfeiasf 2raumpot4opxo feiyd m2umnms;u)altnmociotlm  lu sls sexmirpoy4ome mivt (f 2tmumoou4alt iictasfmDulu p t4aetomf3todlat  u i ( s2xm(mpiu1op nmfet ( aDurum ;o1oltoifeiad a2emnmo;t4altrxrciadoa ean s (0s2xrio3iudameelnei (f rrmu  oo1olxn iciytls2ulnvp;t)aeerxocio1lmDrlnvs;t) 2trxo3io1al nmnesl( sDur(m oo1optnmo3ils aDeanmo t0tetnif oa1fpteln s t)trto(o3iu4apeemfetl(f 2tr( o;o0tpxnmoeildfm2umums;u0tltoif ta1lmD lneo;() etmirpnu1lmeemfct (fsrrmxr oo1oltnmoeilt a2umn p;u0alenio3oy1lpD aivi;t)sexrxm nodlmen ict t) Dum( ono0oex mfeiaslsDeanmont)artomf3oadomDrauvsls0trtrxr iy1am emfci sfaDrmxmp;t0alxomietld sDrmnvp;t0trxrxr3ia1oaD aueilt) 2toxm nydlptelfesl()srraumo;t4oex io3ilsls ua(vp;t) rtomfctadlpDeaivs;s  2toim3iudlm nmfctasf ruru o;o1tet mi3tltlsDumu s;t4 lxrir ootfmtran slt)s2xoirpio4lpeemicslsfa2urx  no4aleomoeildfmDea(mont0trxrioctytlmt  nvs (0srtrir nu1omtnmfesltf 2tm( oou4aet mfetydfs eanvpn()alxoxr3tatlmteauvolt  rtmxr3iydoptnlfctat s2r
\ No newline at end of file
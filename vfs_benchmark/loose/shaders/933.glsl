@@ -0,0 +1 @@
+uvs;s)teurxo iudamt lnciltfsDumxr oo4oetoifciad aDeln s t4 ltoxf3oodopDeau slt sexr(r nu1omen fvt tfsrur(mo;o0ope ioctys m uanmp;u0aexnxf3io1fat luesl(0 rtrxo3iudllt liet (f 2tm(  ;t0olxnii3iys sDrlu snu4teeoxfcoytoate u i s) exmxr3nydame liesas)aruaxr ;o0aptomiciltfa2emn p;u0 etoifctadlmD ai o;()trxoir oo1lpenmncsa(fsrrruro;o1oexomo3tltlsDrlnms t4tlxrifciy1fp e neo s setmxm3iudlptnmnviasf Durxmp;u4tptoioctldfsDeanmsnu4 reoxr3ty1la rlneo t  2xm(rpou1amt liei sf Drm(rpot0oeen o3iytfa2el( s;t0 lenmo3oatomDrauvils)srtrim3iu1op nmfcs sfaDtmurpou4oleoio3iasfs rlumo;t)tetoirctydfptraneo;(0sexr(rpnu1apeemicta()sDuauro;t1optnmieiysla2em( pn(4arxnir ootfa r u s ()trtm(m3nodaptemnvtl()aDumxrono0aex iicils mDel(vo t)tlenxr3iadfpDr ies s0trxrimpoy4ame liviltf 2trurpnu1ole  f3ilt a rm(mpnu0 rtnxrcoytlp elu o;t t2xmim3oy4apee ivils aDtmxro;u0tleo fetysfa uan o;(0 rxoifcoy1faDe ivi t0 rtmxm io1om e feta(farrrur ou4tlx  iciat m uanvo;(4tltrmo oodopDr nvo;s teuoxr ny1om elfvtatfsrrmx pnu4alxo f3tatls emuvo t0 exrmr3tydfp  lues s srxr(m3iy4llenlnci t  Dur(  ot1aeeoioctad a2umnmpnt4 lenmoctytfaDeaies;() ruoxm nodope mivi sfarrm(mo;o1alx iietltfs rm(mpnu)tleoxr iotlmDr ivo t0 rtmxrpiy1lltn iet s aDrr(mpnt4olxomiciyslmDeanvon(4alenmr ta1opt ai i ( trtoim3io4oltnlfeil(  Durum oo1oetn ieilt s umuvsn() ltoif tytfaD aneslt) 2umim3iodap nlivs ( s2ur( pnt1oet ioetasfaDrm(monu4trtrxr ootlm ran i;s0 2trir3iy1lpen ivsatfaDurxm nu1tpx mfcild s emnvpnu4aeeoxo3io1fa   nei;(0sexo(r no4amenmnvtls  Dua(  ot1aetomf3iytfa el( p;(0 lxrir iydlm  lnes s)s2xoxr no4al  mietlsfaDrrx pnt0opxo i3iltlmDra(vs u0 reoxf3oo1oaDe u s;t trxmimpiy1lp   fet t)aDtrxm oo4aeeomfctaslm uluvs;(4 leomr tydfmteanvs t) rurxo ou4omeemnesa() Dur(rpnu0alen ictyd mDea( s;() etrio oydlmteaues s0 rxmio ny1ope mfci t srtau  ;o0aptniieildfsDrmums;u4artrmrcoytoa   u il()srto(m oo4apenmieiat  2umx  no0tpen iciltfm2el(vo;(4altnif3oadfa eluvsls tetm(m3iu1apee nesat arurump;o0apt moctys m2rmnmsnt4tleoxr3tatomtraieil() etmxr io4lltnlfvtl(f ruaxrooo4tpxnifetyslm uan p;(0aexoif iotla eai o s0srxmxm3iodoltemnvtltf Drru p;o0tltomfetadlmDrlums t)arerxfcoadfa elu i t)teur(r3oo1llenlivi s)sDrrxr ot4olx  ieiys s rm(mpnt)arxrif tytlaDeluvo;t  ruo(rpnydlleelnvtls srtru  ot1tlxnii3ildlaDelnvs;u4tlenmf3ty1opD au ils0t2tmio3no4al  lnctlsfa2uau  ;t4optnmf3iltfm ra( on() ltoxociytfaD ai i t) rtoio3ou4ol n feil(  Dtm( ooo0alxnio3tls m2ra(vo;(0tleomo tytlm   ivslt trtmxr3nodamt mics s) 2urx o;o4aptomfctltls emnvp;u4 rerirciy1oateau s;t t2urxrpio4lltn nvtltfs2um( oot1teen f3ias s elumo (4 exomfcta1fa r i i s0t2trirpoy1ole mfci ( a2rrum oo0tpx  fetydlmDrlnmsnu4aetnmoctydoa rau olt s2to(rpoodol eliesl(fsDur( pou1aleo fcilt s ea(vs;u4 lenif3oy1laD aueo s  2xrxr3oo1al  lnvsls)aDtru poo4tpxnmicildls2elump u0alerxrcoytomDeluvo t0s2xmxrpio4alen nviat)a2ta(mpot4tpto fciasfs emu p t0aeeomfcoy1oaD lnvs;t)trtr(opiudamee ies t)a2uaxm ;u1tet  ietatlmDranvo t)altnxr iadomD  uvo;s teumxmpoo4op elfvsl(fartr(r no0tpxnmfetldlm umumpn(0alenircoadop  luvs () ruoio nydlleemfesls  rum( ono1apt mfeildfm2rmump;u) reoio tadlmtelivi;s srto(o3no4omtemfvt sfa2rmxm ;o1aexo ietlslm ua(vpnt0aexrmo oo1opDelivils srtm(m nu1lm nlfvsl(fs2ra(m oo4apt moeildls ulu o;(4trxomr3oy1fmD  ues s sexoxm3nudal e ncilsf 2taxroou0aptnmicils a rm(vp ()tetnmr3oadfm elu sls0 rxo(mpnu1openmnctas arrr(m ot4olt  oeiltla2uluvp t4 ltrmr tadom r nvs s0sexoirpoydomee icsa(  ruax p;o0olt  ieilslsDeauvo;()aexoxfctotfpt lu o;t0 2xo(opnudomtnlici t)srrmxm ;t1ole mieiyslm el(mp t)trxnxfcoadlmt  n sl()t2umxm nydolenlncsa( sDtmurono1tltniiciatla ea(mo;(0tetrxfctotfmDeluvi (0s2xm(o nu4olenmnvtl(faDrauroou1tetnmfetls a2emnmont0aexomf oa1oaDrauvs ()t2umxmpiu4lpe micia(fsrrauront1tptoiictydfa elu pn(0 lxoxo tydoaD aues ( t2toxo iudame mfes t)arraum ;u1oeenio3iysfa2ul( o t)trtoxociodlpteaueo s)trto(o3oodoltn nvtlt) Drax  ou1tpeoio3iad sDuaums;(0 rxoio3oy1op rlivols) euo(opiudope  fcs ()s2tr(r ;u1aeeomoctlt a2raump u4arenir3todfm r nvo t  2umxr iu4lm   iesl() 2umxr oo0oexomi3ilsla rl( s;u) rermrciadlmDr uei;(0t2uo(opoydlp  lnet s)a2taumpou4aleo i3iltls2em( o;u4aexrmo3tydoaDraivi s0 ruoxm iy4am  mfetlt)aDrm(moot0tptnmf3iatfaDumnms;u0aeerio iotlateli ilt)t2xm(r3oy4openmnvt ()a2rrx  ot4oeeo feiyt a2rlnmp u)altrir tytfm  lues t0trtm(r nu1lm nmnetltfsDtaur no4tleoifciasla ranvp;t4aeeoxoctytfaDe i s;t  rxrir3oo4op nmncia()aDumuro;t0tpx  i3iad m2ua( p;()aexrxr totop eluvo;s tetrxm3nu1lltemnvs (fsDrm(ro;u1tlenmfciyd m2umu s;u4tlenxr oy1fm rauvi t teur(m nu1amtemnciasf 2rru  ;o4aee miciad aDea(vo;t0altrxf totla eau o;s)trxoxm3oo4olt  fvsa(f Drr(r ou4olxn ieiys m2ulumo;t4 rxnxr oodomte uvs;s trtr(m3ou1lme mivs ( arum(  ;o0tee  fciaslmDraumo;t0 rtnir oatoat aneo s0tetrxm oydale mfetat aDrrx  nu1texomicilt s2ulu sn()altrio tadomDrluei;s0s2xmio oodapen nvtls)a2taumpnu0opxn i3ildfm el(vs;() rtnif3oodfp e nes t0 2uoio oydape  nciatf 2rr(  ;o4oexnif3tlsfmDuanms (0 exoxo iadop ranvslt  etmio ou1oltemivs ( a2tmxmo;o4teeomietyd s eanvo;u0tetrxr iytlpte ivo;() 2toiopiydamtn netasfsDtrur ;t0texnif3tysfs2emn s u4 etrir3tytfmD  n o;( teto(m ny1altemics s aDraumo;o0aexo ociytls uau pnu0 rtriocoytfmDrlu ols)s2umimpou4om   fetltf 2rr(mo;u1tlxniieiltla ulnmp (0tlxnmf ta1optrauvols)sexr(mpoy4op n fvt t)srtrxmpot0tpxnifciyt s2eaumsnt0artrmo oatoatrau il(  exm(rpno4op  mnctas) rrrxmpnt4tpxnioeiat sDrln onu)tlerxfcoydlpD lueo s0 2xoxopoudamt mncil()a2uau ont4oltniieils m ranvo (4 exnir ootlat  u il(0texoxo3nodap nmfct sfarra(rp;u4opto f3tys s raums (4 exrmf3tatlp rauei () etm(o nudam n fesasfaDurx ont4texn fciat aDran pnu0 etrif3iytomt aues (0 etm(r iodlmt  fciltf rraum nu4aet moeildls2ulnmon(4aetoifciy1fat li i;s0seto(o3iu1amtemfcslt)a2umxrp;u1aetomoctld a uanvsn()trtomr iydoa r neol() exoiopou1lmt lfvta(faDuaurp;u0oeenmociadfaDemnvo;t) etomf iadlpDrlu i;s  rto(o3oodllt  ncslt)sDra( pot4apx  i3tat a ua(vo u0 renif3oo1oatrluvsls0 rtm(opoodop elict t) Drrx  ;o4tet  i3tldfm um(mpnu0teenxocto1fmD  i i;(  2uoxo ny4open netlt) rta(r oo4apen i3iydfsDulnmp;t0teenif tadlateli o;s0 rxrim oodop nlieilt)srua(r nu4aee  fetatls rm(vs;u)trxoir3iodlp   n sl()texo(mpiy1op emfet s srtmxront1ope iictld m2ean p () lxomr tytla eai ol()t2tmiopnydlmte iesa( sDum(r ou0openii3iasfs emn p u4aexnmfcto1omD  nes;s  2to(o oydameelfvtat  ruaxmooo1aex mf3iyslmDuau s u4 lerxo3oodomDrluvolt0trxoxm io1amt lietatfsDtaxm oo4ale  ocild mDrl( p;()texoif3tytfptr nvslt t2to(o3oudapeemnvilsfartmxro;u4teeo iciytlsDemuvsnu4tlermfcto1la ean sls0tetoirpnudllenmfcias)a2urumpno4tlx iociasfaDeauvs (0texomf tadlpD luvs s setr(mpiydlmeemncilsfsruaxmooo0tltnmfetltfaDel(vs;(4artoxf3oa1la r nvi;t)tetoir io4al nlietatfarrm(  ;t4tpen ieildla umu s;(0 etnxr tadlmDr nes;t0teum(mpio1opt  ietatf Drmump;t0tee mociasfmDua( pn(0teerxoctatfa   ueo t)s2urio3nu4olenlfetl()s2rm(  ou0aetnii3taslmDrlnvo;(0trxniocoodomt aivi s0 2urxrpou4lm nlnciat)sDtmxmpoo4oee  o3iydfsDrmn o;t0 exrmr tytfpt livs;()setmio io4ome lict (  2raumpoo4tltnmociadlaDrau o u4trxoxo oo1opD an i;()seuoio3iodapt mieiat)sDtmump;t0apxn ictldfmDrmn p t) etrif tydfp  au s;()seumxopoo1opt  fet t)s2uaump;t1olxnmieiaslaDua( p;t)altomoctodomDe i olt)setrxr oodlpen fvs s s2um(rp;u1tlxniietlsla umu ont)tlenmo3oy1fpDeaiesl(0 rtr(o nu1ll  mfet sfsDta(m ou0alxnif3tlt a2ul(vp;u4tlerir3tadlaDelies;t0 euoxrpou1lpte iei t) Dtaur ou4oexo oeiltfm2rl(msnt)trxomfcto1oatrlneo;t  2to(r3ou4lmtelieslt)a2tmxr ;t0opx ifeiyt sDrl( o (0teerxf ia1fpteau olt sruoio3io4alen fctas)aDrrumono1olxoii3tytfm umnvp u)arxomf iydopt  neolt0srurxmpiydlpt mivsas s2umurp;u1tlt ioetydfm eauvsnu0 etrmf iy1fat lnvil(  eumxmpiu1am  micta(  2raxroou0olenmoetadls el(vo;t) leomr3to1omD aneols)t2urimpoodalenmnetls  rtrum nt0olen fcild a2elnvs;u0tlxrxf3iodfm ranvi;s)trxr(o io4alte fvs ( aDurumo;t1olen fetld aDemu s;u4tleomo tydopD an s;s)trtr(opoo1al e net sfs2uru  oo0oeenii3iysfa uanmo u)teenif3iy1laDr ivil(0s2xrxm oo4alte fctl(f rtr( onu0oexomfeilsfm ulnvs;u)trxoif3oytfaDraues;s seurirpno1om n icslsfs2uru ont1tlxn fctltfsDranvon(4teenmr todomDeai s;s) rto(m3ou4alt mfesat)aDurxmoot0opeo fciadlmDrmuvs;u4alxoifcootfpDr ivolt setrxrpiudlpenlietas)srtrxrpno0tee mfciltfa2ul(mp;() leomocoa1fpDeluei;t trtoir3oydlleelnetltfsrumxr ;u1apx mf3tadlmDua( o t4tlxrxo oa1oa eauvo;t0 rxoiopoo4amen nvs ()srum(mpno1olt  f3iyt m2ua( p;t0alerif3ta1omDrauei s  rtr(m3io1al  mieilsfsDtax ont4teenmfciyd m el(vp (0artrmf3oytfpte u sls)srxrxr io1lmeelnviatfsrum(r ;u1tex  fetat m em( s;() rxnir tatlmtrluvo ()teuo(m oodlptelfet tfsDurxmp;o0alx mf3tad sDemu pnt4 exrif to1fpDrai i s) exmxmpoo1lm  mnctltfarrrurpno1tlt  fciys s elumpn()texrxr3iadlmteau olt0teuoxo3oudlmeemieil(faDrm(r no1aeeoioeiyt m2ea( p;t)aexomf ootlpDe uei t t2xoim3oo4omenmfet t  Dumx pou4tptoifcilsfa ra( o (4trxoxrctydfat aivol(  etrimpiy1optnlnviat) 2umurono4opeomietyslaDelu s u0 ltnxo3oytla e ivs;(  eurimpoydlmtelnetat)arumur ot0apenioeiat s2uanvp;u0texrmo oadlmDe ies t)tetrxmpnudom   ivt t)sDtmur ou0teenii3iadfm rmuvp u4 exnmfcoy1la e n sl(0srtoir3nodole  fetls aDta(ro;u0texn f3iysla2umn p t) rxoxo3iadlatr i s;s) 2umirpoy1ol emnesat  Dum(r oo0oex mo3tat m emu o;(4tlermoctadfatr n s t trxrxr3nu4lm  mnetasfsDurxr ;t1oex mfciad m2rlnmo u0 etomfcoydom  aneo s seumxr oodlp   fvs s) 2uaxm ;t1tpxniietasla uaumpnt0arxnxf3oa1lmD lneo s0seumir nu4omenmnvslt sDrm(  nu1alt ioetyt m ua(mpnt0 rtnif ta1optr n i;()seurxr ou4omeemfvtlsfs2rm(r oo1olx iictaslaDumnmo t0 lermocoy1fpteaies ( s2ur(r3ou4llt  fet (  Dur( o;o4tpxnmi3tlsfaDem( on()texnircoydop r uvil(  euriopno4oleelfes sfs2um(ro;u4aleomociasla rm( o u0 ltoifctadoate nvo;s)texoirpnydome lnvi (f 2tmxrp;t1tet  iciatla2ra(mo;(4tleoio3oytlm eau slt) exm(o nudoptemiesat) 2uru oou0opxomieildlm2um(vs (4tetoircty1lat anvo (0s2toio ou1omtnlnctls) 2rmum ;o1ape mfctysla em( s;() eenxf3iydomtrauvo;s t2urxr3ou1ap emnet t) rtax p;u1alt  ieiyt aDemn o (0 renir ootoat aueol()srur(r3oudam  lnetls  Dta(  ot1alxnmieilt sDuanmo (0alxrmo ia1om r i ils)trtmir3oudll emfesa()srurumpnt0oex ii3ilsls ra( s t0 exrmrctotoa eanvs;(0sexo(mpiy4ol n fcslt  Dumxrp;t4oeenmo3iyt m2rmnmp u4 ltoir3iotoaDelueo t0srxrxr oodopee nvi s)a2uaxroou1aleomf3iysfm2uanms u)trerxf3oodomteauvo;s)seto(o oy1lm emfvsls)sDurx p;o0tetomociysfsDum( o;t) exrir oydom  ln ils) 2ur(o3ny1omenmies t a2raxmont0tpxniictltfaDumumonu0teermf3iodlm   n i;t)sexoxo nudaleemncsa( arrmxr nu0aetoiictlslmDrlnvonu) reomf3oodfpte uvs;t)t2umim oo1am e nvs t  2rmx  ou4teeoiiciysls2rau ont0alxoxr iadlatraieo;t0 2umir3iu1lmt lnvi ( aDurx o;t1tlxoif3iydls el( o t0arxoir iatoaD livilt0srtm(m3oodolenmfctatf Dtaxr no1teen ociys a ra( s;u)texrxr tytom r n sl()seur(r3iu4alte fesl()s2rrxmo;u0oet ifciydlm2ulnvo;u4tlenxr tadomtr i s;s0tetr(opoo4ameemfetlt a2ur(ro;u4tee ioetlsfm2ul(vs (4 lxnxf3totlaDeaivi;(0 exrirpoy1altnlneils)aDuau pnt0oltomfctytlm eln s;t4 leomr3oytomteanes;t) 2uoxm iydop   ietasf 2taxmp;o1aexoiieiytlsDran p;t4 rtniocoadfm e ivo;(0 rxo(m iy4apenlfcsa( srtmu pnt1olxn i3iadla2rm( p t0aetomf3oydopt au s;(0s2umxr3oy4openmnes t  Drr(  ;u1aet mfctld s em(vo u4arermfcoytfp r ivs;t teumxopoydaptemivi tf 2taurpno4aeeo f3iasfs2ra(mo;t4teenxf3iatoptraies t srxmxopiu1aptnmici s sDrax o;t1teeoiiciyt m2ua(vo;() reomr ootfmDrauvo (  2ur(r nu1am n feslsfa2uaxr ou1optomfctat sDra(mo;u4altnmr oa1oa eauvo t srtrxm3iudom  mfctl(fs2uau o;u4tlx mo3tysla2emnvsn(0trtoxfcootfa  lneilt0 ruo(rpiudlptelnvta(fsrrauro;o0opxniictlsla2emn o (4aetnxocoydfm r ivi t0t2toxr nu4lpeelfcsasf Drr(moot0apt  i3iydfa rln p u0aleoxr iotopteaieo s0s2tmirpno1om  liesltfsrra( pno4alto fciatlm2emuvpn(4 ltnif3tadfmDe ies (  eumio iu1ape liesl()aDraxrpot4opt ifetlslmDumnvo u)trxrir to1la r ies;s setoir oodolenmfeils)sDumxr ;o0oetnmoeiysfaDul(ms;u)trxoio3oy1lmtraneo;(0 eumim oodlm nmivsasfa2rm( o;t1apx miciys mDrmnms t)tleoio3oydlmDe neo t)texoxrpio4lm  lncias)aDtr(rpot1opxnmociytfmDea(vp;u0artomf3iadfatrlnvo ()s2tr(o nydap  mict s  2tr(rpnu0tleomoctlsfm rauvp;u0tlenxrctadopte i il() exoir3iu4ome  ivta() Durum ot0tee  ieilt s2el(vsnt4tlxoxo oydfpD  nvo;()trxmir3ou4ome lfeta(  rurxmpnt0tpxo ociytlm emuvo;t)arxoxo tydoptraieols)texrirpnudoptemneil()srua(rp;o4tlt  f3tyd m ua(vpnt0arxoxr iatom rlneslt srum(rpno4ap  mnvia(f 2rru pnt1openifctysla umnvpnt4 rxnmo3tatfp  lneolt  2xrxmpiu4aptnlict s aDrr(mp;u1teto oeiasla2ra( p u)teeoiociadfa elivo s0t2urxm nudamtn nes () rrm(m nt1apeomf3tatlsDul(vs;t0tetoxfciotop rai o;t t2tmim3nudlm e ict sfa2tmx  ot4aeeoii3iyslm ua( o;(4trtniocootlaDe ivo;s) eurxo3iudomenlicsasfarra( ont4apt  o3tysfs ra(vsn(4treoxr iydfmt anvolt0trurimpny1apeemfetat sDtau ont1alx  i3tydla2umuvont0 leoio iadlaDeln ils seumir iodamen ietasfsDrmu p;t4tet mictlsfa2em(vsnt4tlenifcoy1opDean ilt srtoxopoodomeelivtl( srtr(r ;o0alen fciyd m ranvs (4aeenmfcoo1fmte i ils0truoxr3oydlmtn ictlt)a2rmxm ;t4aeeo f3iadlm2rmnvp;(4teeoxo3tadla e nvolt0trxrxr nu1ame  nei ( artmurpou0apxnmfeiadfa2uanmsn(0arxnxo3todlm  lneol( s2xmirpiudamtelncta(fs2ra(rono1apen fciyd m uanvonu)aexrirciatoaDrluei t s2uoxo3ny1aptnmnesatfs2rr(rpoo1tptn oeiltlmDumu sn(4altrxr iatlpteaneslt setrir iu1ol nlfesasfarua(ronu4tltoiieiatlm2rm(mon(0tlxomr3oodlat an o t0 rxmxopiudopt  fcta(faruaxm nt0apxomfetlt s raump ()alxnmfcoa1fptrlueo ( trtrio io4ap emfciltfa2um(roou0aleomfeiys a el( onu0 etoxr oo1om e uvs;s)setrim3iy4ll   ivsl(f rrm( p;t4apenmictadla rln s (4tlxoxr tydoa eauvils)s2tm(opny1altn fetl(farum(rooo0apt io3tltla rl(vs t)aeenmo3oodlaDelnvsl()srurxm3nu4om  liesls a2ua(r ;u0oexnmoeiatla eluvp;u4trxrxf3iodomtrlies t0s2xrxo3oy4apt miei s)a2rmx pnt1apx  oeiadlm emnmsnt4trerxf iy1lm   neo s) ruoir3iudlp n ncia(  2uaxm ;u0aetoioeiasfaDeau s t) ltoxocoy1lmt anvsls)setoxr oo4lmee feta()arua(  ot0tlt  fcildfs rlu s u0aleomf oodfp elu i s srtmxm io4lmtemfei s) 2ra(m no0olxomoeiysfa rlnms;u0texrxo iydoa elu i s) exrio3iu1ap  livt s)s2rrurpnu0olt micilsfaDelumo;t)alxoio iadoa eauvi;s)teuo(opio4oltnlfctltf 2trxmp;o0olx iictatlmDranms;() etrmrctytoa r neol()t2xo(r ou1lmeelnetl() Drrumo;t1aet mfeiad sDea( onu)trtoircoytoptr ies;s0 rumim3oy1ome  fvtas s2ur(  ot4tlx mf3iltlmDelu s;(0altnio3tadfp  luvil()tetr(mpiu1lltelnvslt)aDumx onu4alxnioeiasfa2emnvs;t4 lenmfctadoa  ln s s0tetmirpnydlmeemict t aDua(rp;u1aptn feiadfs rmuvpnu0 rxrmocoydlate u s;s setrxm3oo4optnmieslsf 2taxmont0ape  f3ias m ea( pnu0tlxnmrctadomDeluvs (  2umxmpou1apenmfvsa(fa2trxm no4oeeo ociatfm2eauvonu0altrmr io1lm elieil(0srto(m oydame lnvsl()aDumur oo0oeeoiietysls um(vp (4 etnmocia1omt  ieols)s2trxrpou4altnmietas)a2rm(rpou0alenii3iad a ulnmont4altomo3tatlaDraiei;()teuriopoo1ole mivtls arraurpno1tpen feiat aDeanmsnt0 rtrmoctydfpte uvslt0 2xoxopoodaptn ncsls s2taum ;u4oetoif3iydlm2ul( s t4alxnxf3io1fmDr nvo (0t2umim oudolenlivsls sDurxm ;u0opt iictatfs2uanmp;()artnirciytfmt livi s srtrxo iodap n iesa( a2rax  oo4tetnmi3tldfs2rmumsnt0areoircoy1fmt lieo t texo(m ou4lptnmieil(fa2umxrpnt4ale  oetltfaDeau p t) rtomf oatomtelu o t) rxoxo nydlltnlivt t aDuru o;t4teeo i3iyd s elump (0altomf3oydfm eaies;s  rxrxo iu1oltnlfvi t artrxrpot0alxnmoctytls2em( s t0arermf3ia1omtrlu i () rur(r3iu1ameemnei sf Drmxm nt4tlxnifctydls ul( o;(0 rxrmo iydlm   nei;( sexmiopiu1apte nesl()s2uru  ;t1oeeo ictasfa2um(mp (0artnxfctodlmteauvil( srtr(r3iu1optn fcil(  ruaumo;u1tlto fetldls rlnmo t0 exrxf io1om  auvi;t  exmxm oo1ome  ivsl() Dua(  nu1apeomfciltfmDemu o;t) rxrirciodoa   ivi;s0 2ur(m iudlpenlieiatfs2umx pnu0apxn ociyd s ra(vsnu0 lxrmrciy1oaD lnes t0setmio3no1apeelfvia()srtmum nu0tetomicildlaDulnmpn(0tlenxr3totfmDeai s s  rtoir3oodam emivias a2urxrpnu1apt miciltlsDuluvonu4treoircoadlaD luvi (  2xo(r nu4al   ncslt s2tmumo;u4alxnmi3tlsfa ul(vp t)tlxrxf io1fate u o;s sexoxm3oodll  lncsat)sruaxm nu0aeen ocild a2emu s u)aeermociatlateaivolt0s2xrxo3io4oltelnvilsf Draxro;u4tlx mociysla ua(ms u) etrxrciadfpDrlnvolt)s2tm(mpoy4opee fvtas  Dtaum nu4aet  i3ild m em(vo;(0alxnxrcoodlaDr nvsl( trxoxopnydolenmivtasfaDrm(m nu1tlxn oeiyd m2ran s;u)teenir ta1oaDranei;s0 rumio iu4lme mfvsa( aDtmu  nu4ole  oeilt a uluvs;u0artnif3oodlpt luei;( trum(o nydlp  lfetl(  Drmu  no1tlxoio3tas sDrmnmp;t4arxrio tatlatrli s;s) rxoxm oy1oleemicta() Dtmu pnu0tetnmiciyslm2emuvp t) rxrxr oa1opt  n s;t0texr(o ou1aptelnvia()arrau p;u4ole mictyt s rlnvp t4teenxfcio1fpt lueo;t setoim3ou4ameelnesa(fsDurum ot0oex  ietytlm2elums;t4altoxf iatfm  ln il( s2urir iudop nmfes sfsruaxrpou0tlenif3ilt s uanvsn(4 lerio3iy1opte ivo t) etmirpno1amee fvslsf 2raurpoo4oex mf3ilslsDeau on()altoxrctodlaD  neols trum(o3iy1alt lnei (fs2umxro;u0aleomociadlmDem( o;u)trtnio3oatfa ranei s) exoim io1omeeliei tf 2umxm ;o1aptomoeilsfa2eluvsn(0arxoxfciy1lm rauvo;( teuo(m3iu1optn nvtlsf rumxrpou4oltoif3tldls el(mo t)altomocty1lmt an i s)s2to(mpiudale licils)sDtmxrpno4tet iiciytla rmnvonu0trxomfctotomtr u o;s srxoio3oo4apenmfesl(fsrumx  ;u1optnmfctlsfmDumnmp t)alenxfcoatlmDelueo;(0s2to(opoo1amt  ieias)aDtr(mpot1ape  f3iydfs2rm(vs (0arxrmoctodomDeauvs t  rxr(r3oodomt mnvt tfaDrm(mpou0oet mfciasfmDuan p t)areomo3iytomDrli olt0 rumir3io4ameemfcta() 2um(  no0tpeo octytfsDranvs;u0aexomr todomte n s ()teumxm3oy1olee icsls)arraurpot1teeomociyt m rlnmsnt4alxriociy1oa eln o s texriopiu4al   nctas s2rmx pot4apeoii3tasfa2ranvo;(4alxomrcto1oaD li sls  rtm(r ou1ale lnctl()sDurxmpoo0oeto i3tad s ra(mp;(0 rxnxr oadlmtrluvi ( trxoir3iu4omt lncs (fs2uru pno1aet mfctlslsDra(vsnt0 etnir iy1lp r uvsl()t2xrio iudlmeelicia( srtr(mpou4opeoifciytfa2rm( pn(4 reoio3to1lpD li ilt  2tmxo nodlle licta(fartmumooo0tee ifeiatfaDrmumpn()trerio3tatomt livo;() rxrirpio4ll elnvtas) 2ua(rpnt4tex mi3ils mDelnvsn(0aeerio iydla  auvols seumiopiy4lpte nvsa(fsDrrxrp;t1olx  i3iad s ua( sn(0trtoio ta1fm  anei s0t2xoxm ny4ope mfeiat arrmu oou4aet  i3tltfm2ra(mp;t4arenxr oadomteaneo t0trxoiopoo1optnmfeilt  Dra(r nt0oet iieiyt s umnvp ()trtriocty1lpDeluvi s t2uoxm3oy4omtelfvi s)s2rmxm no0teenmieiltla2ua( p u0teeomfcoa1opD livi ( t2umxr oydole  ivia()srtmuro;o1altnioeiadla2raumpnu0arxnxo iodomtrli i t)srxrxopio1ap n ivi s srur(mp;t1aex  oetadfa2ra( o;t)trtrxocoy1la elnvo;t0setm(r io1lm e fes sfsDum(  ;t0tet  i3tydla2ran o;u0aetnxrcoodfpteluei t0t2xoir3oydomtemncsl(fsDur(monu0tpeo o3iltfm rln s t4aexnirctadopDr uvsls)tetmxrpou1omt mieiat) rtaxmpou4aee  fctas sDeanvpnu)tlenirctydfaDran ilt  2tr(o3oy1ope mict s)srtrumpot4optnio3ils mDrl(vo;t0teenxr3todop   ueo;t) rxo(opny1olee ivi t)s2tau  ;u4aleo ieildfm2rm(mp u)tleoiociotlmDeluvol( teumimpiu1omtelfvt (fsrtrx onu0alxomicias mDrmnmonu4tlenxr tadfaDe ivolt) rtm(r3iy1op nmnei (fs2tmxr nu4aexomfctytfm2elump;t0 lxnxfcoydfpD  u o t t2um(mpnodllt lnct t  Durx pou4oexniocildfm2um( o;(4treoxr tatom r ivslt0 2xrim3iydopee fcils arra(r ;o4aexn ociatlm rmu o u4arxrif to1oa eliei (0t2um(mpou1llt lnei t) 2tr(r no1ape  fciydla el(mo;(0teenif3iotfat auvs ( s2tmio oy4aptn ieiat)arrmxmp;u0opxnmfciydlmDelums;t4 exnmfcoytla raieils0trumimpno4lm elncia()srra( p;u4oee  f3iad m2rluvo t4arxoio oadfmteauvi s  2um(m nudaptnmivil(faDtrumpnu0tleoiicilt m2emu p t4arenmociodoate ivi;( trumxr3oy1omt lieta(  2rmu p;o1apen feiadlm emn pnu0treomrciatoaDelneol()trxmxmpnydlp n ncilt) 2umx  nt1tpe mietatlm2rluvpnt) lenxr3tatfate n o ()trtoim oy1om e fcslt)a2rmu  ;t1aptn ieiydfmDeauvsn(4tltnxo3oadfpD ln s;() etr(rpoudop n ncsatfaDrmu  oo4tlt  i3ilt sDemnms t0trerir iotlpD lieols srxoio iy4ol emicsa() 2ra(roou0open iciasfs2umnvont4 lenifcta1omtranes;(0trxoxm ny4am  lnci t s2tmu ont0teen fctysla2elump;u4 leoxf3iatoat ai i t0trur(m3iu1om  mfvsls) rtm(rooo1olen i3ilsfa ra(vp;u4alxrmo3oatomtraueo;s seumimpiudam nmncs s)aDtaxm ;o1oeeo iciys m2uanmo u0trenxr oodfmtrai olt0t2xo(mpou1lmee fes t) Drrxrpot0tetn fciaslm2eluvs;u)altoxocoodfptrlieslt  rtoio iy1aptnlfvi sfarrr(m oo0opxnif3iat m2rmnmo;u4trtnio oy1oaD  uvo t  etoirpny4lleemnci t arraxr ot4aet moetasfa2rm(mpnt0aetrmo oadopDrln slt0 rtoiopiu4llen iviat)s2rmxrp;t4oetnmfciytls2elu s;u0altnir iy1fp  aivo s0srtoirpno1lmte iesl(  rrm(  oo4ole moetys m2uluvo u0 lxoxo iydfpDe uvo s0 2uo(m3io4al elfvsatfaDtrumo;o1apeomi3tlslm2elu o (4 exrmr ta1op  lu s t  etrxm ou1am e fctatfaDrmum oo1tlt mieiadlm2umums t)arxrmf oadfaD  i il() 2tm(m3iu1optnlnesl() 2tmu o;o0aeto fctltfa emu s;(0 etoxocoy1lptrlueo;s0s2xm(m3iu4omtnlnetltf 2umum no4alxnioetysfaDelnvp;(4 leoxo iytfaDran o;s0t2toim3no4ape lfei sfsDtrurooo1oeeo ociyt m umums t4 reoifciy1oaDr nes;s setoxm no1lm  mfci s srtaump;t1aptnmfeilt m2ulnvonu0altomr totoa ran i t srurxo nu4optnlnci (f Dtr(mp;t0alxnio3ildfmDuanms;u4aeermo iatlmtr ues s) 2tr(o nodlpe mncia(f rum(  ;t0alxn ieiytfmDumu sn(4 rxoxr tydlptr i slt)texrimpny1amtemnciltfs2tr(rpnt4oetoifeiadlm rlu ont)aeeoir oo1fpDrlneils0 2toio ou1aleelietlt)aDta( oou4oltomoetld mDrmn s;u0tlxrxocio1fmDeaivi s)trtoxrpoodapt lies t) rum(mo;o0ale mi3ilslaDemuvp t0 lxrio3iydlmDrlnesls0s2tmxr oodomtn ncil( srtmx ooo0olx micilt a2el(vpnu4trxomfciatoa raivs;()s2uriopoy1am  mfei s) Dtrxrpno1tptnioeiyslmDranvsn()aeermocta1la r nvs s sexm(mpoydlpeemnctltfsDurx poo1tpx  fciadfm rmn s t0altnmo3oadopt  u o t)trur(r nu1om elfvsltfarrrurooo0oeen ieils m2em(vs (4arenifciatoaDeanvi s trumio3nu1amte nvs (f 2rrur ;o0opxnmoctld m2uluvsnu)alenmo iatfpDr ieo t trxrxmpoo1ameemict sf 2taurpnt1tlt mf3tyt s uau s u) leriocta1om rlieilt)teurim oodapt mfcsls  Drau o;t4tleoiictadfsDelums;u4 exoxr3ta1lpD  nvo s  2toio3oo1ame  fvta()a2tax  nu4olxn fciysls2emnmp u) rxnxr iatlmDr neslt0 rtmio3nudop  mncsa(f Dumu oot0aleoiictytfaDeln onu)tlenxrcoatlatean sls0 2tr(rpoo4am emfcsls) 2umu pou4apeo fetld a ul( o u0artrxo iadlp r nvol( s2xrio ny4lmen nvsa(f Drru p;o4aptomoeiatlm2ranmsn(0 lxoif3oadoaDe nvi t0t2urxr ou4amtn nvtltfarumxm ot4tetomf3iys m2elnmpnu)areoir3iydfmDeaivilt  rtoxr nudomeelivta( a2um( pnu1ale mf3iyd s2rlnvsnt4teenmr oatop 
\ No newline at end of file
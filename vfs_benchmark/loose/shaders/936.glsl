@@ -0,0 +1 @@
+uvo t trum(o io4lmt mfctat  ruau o;t0aetnifetldlm2rauvsnt4 ltnmocoydop   uvs;() euoir iodlme  fci (fsrrru pou4apt  ietltfmDumums;(4 rtrmo3iy1oatraieol(0teuo(m ou4op  mfct t) Dua( o;t0tltomf3iatlmDuan p (0 lenmrctytoatelneol(0sexrxr nudapt licias)a2tmu  oo0tpt  o3tys a rmn s;(0tltnmrctatoatrlivo;t0 rumxmpny1lpeelnvs ()aDra(mpou1opx iociyd m2emu s t4arerxrciotoatrlivi (0seurirpou4ll nlfvs ( s2rmxrpnt4ape  i3ilslmDrlnvs ()aexrxr3ty1lat ai ols)t2urim3oy1ll nlfetl()s2ta(  nu4aex moctysfm ran s;(0trermf3iy1fm  aieilt)trtrxm iu4al eliesas)s2urum ot0aexnmfetadfm ulnvp t4 eenir3ootla  aueo;s)srxo(r no1open fvils)arrrx onu0opxoiieiys s eanvsnu4 reoif3ootlmDraueo;s)srxmxm3iodol emfciltfa2tm(m nt1alxoifciasla2ua(mo (0 renxrciatopDr neol()s2tr(m3oodlmte iviat)sDrr(  no4oltomf3iat a um(mp;t)tlxoxoctatla raivils)t2to(r3oudamtnlnesas)sDraurpnt1tet mietydfa umumo;u4tltoif oatomtrli s ()sexo(m iy4lmtelfci t)sDrmump;u4tex  ieiatfsDea(vo;t)arxnif3oodlmteau sls)trurxrpnudomte fcsl(faDra(  oo0tleoifeiadfmDemnvo;u4tlxnmocoadfmD  nvs;s0 rtoir3oy1opeemnctas s2rmur ot1oeto i3tydla um(vo t0texoxocto1latrlu o t seuoxr3oy4ape  nct (fsrrm( ono4aptn fciadlsDrlnvo (0tetnmf3iodoptelivo t) 2uoirpou4apenlfetl(f Draxmp;o4oexo oetasfmDulnvonu0tltrxocoadfpDrauei;s0 eumxr3ny1oltnmnei ( a2trx oou1olx mf3ildfa2emnvp;(0 eermo3tadfmt  nei;t)s2to(m3nudlm n ivi sf Dtrx  nt1texoiociyslsDemums;t) exrmfctatoa eaivo;( t2xrio iudlltelfvslt) rraum no1apx iieiatfm ulnms;t)texrir io1lmDran ol(0seto(m no4altemfeta(f 2raumooo1aexnmoeiasfm2ulnms;()trxnmo3oadlaDr n olt seuo(m3no1lmtnlncsl(  Drax o;o4aexnmo3iyd sDrm(vs u)aeermf3iatfmDelnvi (0setrim ou1ap nlfvsas aDua( o;u1oltomi3iydlmDem( ont)teenxf3to1oatrai olt srurirpoy4ameemfvias)s2uaum ou4aptnifeilt a em(von(0tltnxfciy1late u sls teur(r iu4lmeelnvsls arumu pnu0apt  fciytlaDem( s ()arxoir3to1fpDe ivi ()seto(o iy1am emfvsls) Drru poo4tpeomiciyslaDuauvo;(4teenxoctatoatrlnvs s)trxr(mpny1ap nlicsatfartru pnt1opeomfciys s2rluvp (4altoif3tydlm  lneil(0t2tm(o3io4lmenmnvi (fartmx pnu4alenmi3ildlaDrm(vo () etrmr3tytopt  u slt)setmxr oo4al n ieslt)a2tru oou1tpto o3iysls2ulums t)areoirciytlaDean o t0texm(o iodapen fvsat)srua(mp;t4oee ii3tasla2umn s u)aexnxf3totfatrauei ()truo(m3ou4ameelnvt t) rrmumpnu1olto ictyslmDrmumo t) ltnioctotlmDeai i ( t2xoxm3nudape  ici s) Durump;o4oex mieilsfmDeluvsn(4 lenifcoy1fateluvo;t0trxrimpno1alen ietls)aDrmumono0tpxnmiciytlm2ea(vp;u)altrmf oadomDelnvs;s)t2toim nu1opee nct ( a2ua(  no1oexoifeiadfmDrm( pn(0 rxnircootfpt aivslt trurimpiodllt mneils srtrurp;u0tpenmf3iydfm ulnvp u4 rxrirciytop  li ols)seuo(o iudapt  nvt ()s2uru  ot4ale mo3tls s2ulnvs;u4tlxomo3iytfmtr uvo t trurir iu1ol nmnvia()aDuaxmpot4aeen oeiadfa ranvo u)tlerircio1omD ai s;( tetm(m3iydole mnetat srumu p;t4tpx io3iltls2em( o;u4 rxnmo3iodoaDeauvi;()sexrxo ou4lpte fvtltfa2umumpou1tpxnmo3tysfa2emnmo u0 ltomociytlpt lu olt0trum(o3oo1omtelneiltfs2ur(  ou1texnmieiasfs rauvo;t0tetnif iytlpDeai o;( s2toxo3io4lpen icta(faDrmxrono4apen i3tyd sDua( onu0 rtrifciodomt anei;t)trur(o3ny1opee fes () rrrum oo0aptnifeiatls rln s;(0alxoxfcoo1op rlivs;t0sexoxrpno4lptnmfctat srtauro;t1oetnmf3tasfa2umnmpn(4tetrxo3oadlm raneo;( seuoxm3oodlp nlnei s  Dtmxr ;t0tlenio3ils sDelumo u)aetrxo totom e ivo (0 rxmxr nydaltn nes sfsrumumpot0aptoifeildfs2eaums;(4 leomr tadfm r nvo t t2uo(m3ou4oltelnciasf Dtaur oo0altomfciat sDel(vpnu0arxrioctadomteanvi s0 2uo(r3nydol  miei sf Dtrump;t1texoifetys a umnmp;t4 lxrio3iadopDrlieo s)srtoxo nudllte nct t  Dumx oou0tpenmi3tld aDrln p u)alermrcoydlaDelieo;t s2uo(rpou4aptelfeias)aDrmxrp;u0opxnmociltlmDemn o t)aetomo iatlaD lueo;s trum(o oodlptn fvsas  Dur(mo;t1tpxo o3iysls2eauvsn(0tltnxfctotla rau ols  2trxr3no4omtelncsasfaDumxro;t1oltnmieilt m2rl( p (0 renmrciatlm rli i t)t2xoxr3nu1lmt lnvs ( srua(mp;u1aexn i3ildfaDumu pnt0tetnio3tatopteanvi t)trurir nu4op nlicslsfsrraxrooo4tee  i3iatla emuvp;u4 rtnmf3iydomDrau ils0t2uo(o3io4ope miviat)a2trum nt4tlen fetlt s em(ms;u)trerio3oydlateaivs;t0teuoxo3ou1ll  liesls)s2uau  ;o4aleo ieildfsDrm(mo (0 lenxocoatfa  luvi (0 2umir iodop nlncslsfa2rmu onu1olxoio3tasfsDrl( pnt4areriocia1la eanvol(  etrxmpoy4ap n ivsatfartmuro;o4tpxnii3tysls2rl( p u0 ltnmo3iotfatraiei t0s2urxmpou1olee iet s artaur ;u4aptn o3iad sDemu o u4arxomfcoatom e uei ( trtmirpou4omtnlfes (faDrm(mont1aet  o3iltla2rmnms;u4aexrio tadfa eaieo (  2tmio3iy4optelncta(f Dtrur ;o4aeenmoeiasfa2elnvpn(4 reomf iatlpDraivi s)seuriopio4lpen nei tfs2rrxr oo0aet mfeiad mDean o u0arxomfcia1lpDeaiesls t2toxr3iudlp emietat) Dtmurp;t1aetnmi3ilt m ua(vsn(4tetnmoctodlmDelivs;t0s2xmxo3no4lp n fcs t)aDuax  nu0tltnifcils a rau snu)tlerxf3ty1lmDrluvi;t seto(m iy4amt lict t s2raumonu1tpt ifetat m eaumonu4 ltrxf3iodfp ranvi;()sexrxo3no1om n fei (f Drr(mpot0altoifctyt aDeau o t4tltrir oadomtrau o;t texmim iu1opeelnet t)arumxrpou4aeto i3iydfs2elu s;u0tlermf3iatoa   u i s)trtmxrpiy1amte fesat)a2rruro;u4alt iietatfsDrmump;u)trxnxf ia1faDelnvi (0 2uoir3oy1lp n ncsatfsDtmx oot4teenmicildfsDrm(vs u)tlermrcoodfa  lnvilt) etmio3oy4altnmivsas)aDuru poo1texnmoeils s umu o u4tetoxo3totom rln il()srur(m iy4llte iei t  rur(ronu0optn fctatlaDuauvs;(0 rxrxf todla r nvo;() rum(rpnu4ol e ivilt a2umu o;o4oexniieiatfaDra( ont0aetomo to1laDeau o;t truoxr oydolt lfcs t aDururpnu0ape ifeiys s ul(vs;t4 rtoio3oo1faDeaivo s)t2umimpnu4ll emfet s s2ur(mono0oee  ietat a2rauvonu4treomf io1fpteaieo t) rtmxmpoydolenlfetlt)arrr(mo;o0aleo iciysfm2um( pnu)tetrxo iytlatr uvs;s0 2tr(rpny1omeeliviasf 2urxmoou1aexnmi3iys s2emuvp u)alxnxo iy1omtrauvo;(0srxmir oodom nmfvils  2rrurp;u1oleo ocildlsDulnmp t4tetrmf iadla r ieol(0 eur(o iy4lptnmfvta()srtm(rooo1tpx mo3tltls2eau s u4teeoif to1fate nvi;s0s2xo(o nu1lpeelfeta() Durx p;u1oex ifciyd m2emnvs t4trtnmo oo1laDrli o t)tetrim3io4am nmies s)a2rau p;u0oex mo3tydfsDem( o;u) lenircoadop e ueo ()teuoxrpio4om eliesl()arrm( p;t1opxn i3iyd a umnvonu0 lxrmr3oy1fmD  ivs s)t2tmxo iudopeemnvsl(fsruax p;u1oex mfciyslm2rmuvsnt4texrio to1fa   u o;s trtoio3nu1lpe  neia( aDum( pno4texo i3iydfa2uan s;t) lenmf oydfm r ieslt0t2xoxo3iudam  mfvslsf rrmxr ot4ole  ictydfs umumo t0 etoxo3oydopD  ivolt0s2tr(r3iy4lmee iet ()srtmu onu0tleo i3tatfm uln p;t0 ltrmo3ia1optr ivs t)seuoim io1ol nmnvtat)srumur nu4oleomieiytfsDrlump t)aexnio3oatfaD  nvs;t srxoiopiy4opte ncia(  Duau oou4opx ioctas m uaumont0teenioctatlmtrauesls)s2trxopnu1ol emnvs sf rta(rpot1tex ioctadla2rl(vp;t4tltrxrciytfat aivol(  rtoxr3nudolen icia( srrrx pot1tpx  fciadlm um(vp;u)arermr ia1fmDr uvols0 2uo(o3iu1ome  fvsa(f rtau o;u0optn f3tatla2rm( ont4 exomf3oatop  aueil() 2tmxopiy4llte nvtat aDtrumpoo4teeoio3iyslsDra(vp t0 rxrmf3iy1lptrluvol(0truoimpnu4op nmiei t s2ua( pnt1alx mociadls2ea(msnu0aleoiociy1latr i ols0 2xmxm3nudapteliet (fsruaurpnt4ole io3iadfm2uln p;(0 lxnxf totlaDe u sls0srumiopnu1alt lnet t aDurum ;u1oeto ieiydlaDrmumpnu) etrmf3oodfpD anvs;(0 exoxo3iy4lp nlivs (  2rr(r ;t1oeeo fciysfa2eau snu0arxnmr3oy1fatrai ilt teur(o3io4lmen fct (f rumxrpot1optn oeiasfs2umuvsnt)tetrifcoo1omDeanvi;t setm(mpiodop nmneta(  rurxroou4oetnmfcild aDean pnu4trtrxr iadfmDrln slt) etr(rpiu4altn netas aDtaxr nu0tetomoetytfa rmnmpnt)artoiocootla  auei t0 rxmxr oy1ap nmicsas)s2ta(monu1ape  i3ildlsDemu snu)aetrmoctotfm eai olt) rurxo3iu1ol emfcia(fsDtrumo;o4opxomiciyslaDran o;u)treoxo3oytopD lnvo;t0tetmxopnodamt mfcil(  2uau  nt1tpx ii3iatlm ranvs;t4aexomo oatlaDeaues t)t2tm(m3oo4llt lfei t) 2rm(mooo1aexomfciasla2eanvpn()texnxocoadlptean s;s t2xoxo3nodlmeemnesl() 2rrxr nu0alxoifetys a rmnmo (4 rtoxocoodopDrlu ils)s2ur(rpno4lptnmnei t srumxmpnt4tlenifetydla ul( o;u4 ltnxrctytlm  livo s0trxmir3io4al elicsls)srtrurpnu4alx mfeilslm eluvs (4 exrmoctodoa elnvs s0t2trxopiudamtemfeiat)sruau p;o1tet  i3ils m uanmo;t0treoxf3ta1fmDr u olt  rxr(mpnydop  licta()arur(moot0tee miciat aDum(vs;u0tltnxr3iatfatrlnvo;t trxrxm nu4am e ncsl(faDrmxmpou0tle  o3iaslsDrmuvo t0aleriocoy1op   nvs s trto(o iu1op  mies ( srrax  ;t4ape  feias aDuau o (4artrmf3oy1fptelu i;s0tetr(r3ou4open fctatfsrtru  no1apxniictldfm2elnvpnt0altomfcoo1lm  anvi t)sexoxrpnu1apt lnctltfaDumu  ;u1oltnii3tys mDeanvpn(0 lermr oo1fp rlivo;t0 2tm(r oudam elfcsa()aDtm( o;u0olto fetat m2emnmo;(4 ltnif oydopD li sls)trxrio3ny1om nmici (  rrmump;o0openifctytlm2ulu p;u4altoircoadoa ranes;(0srur(o oydoptnmnei t)sruaur no4ape ioetydla eanvo (0tlenmf todfatrau i;s sexo(r3no1ll nmnetl(fartaumpno4tetnifeilt aDrm( s;u0trtomrctodlp  an slt sruoim3nydaptemneslt) Dtr(rooo0ole iictas a2rmuvs u4 eeoio ootomtranei;s)srtoir3iy1opte fctat srtaxm no1tlenmoctatla emu pn(0trenif io1la rln s t)t2to(o3ny1al n iet ( s2raxro;o4tex iociyd aDem( sn()tlenxr3iodlpDr ivs s0trurim ny1op  lfciat  2rm(ronu0teeomfetlsfm2emnvp;u0 eermo to1fpD livil(0s2toiopnu4am nmfeslsfsDrm(m ot0alt ifctadfm eluvs () exrmo3iodfmD au o;t)s2trxm oo4ll emnctas)a2rmxmooo1tle mfeiyt m2rmnvs;u4arerio ta1fm rai il(  rumimpnu4apeemfesa( srrmurp;o1oltoif3iyd sDeanvp t)arerxr3oatlm  anes s seurxmpno1aptnlieil(fs2urxmp;o0altn fetatla2ea(mo (4aexoio oodfate ivo;t  2urxm iy1lmtn ietat  Dtruro;t4oex  f3iatlaDumnvsn(4arxrmrciodoa   iei;( seuoimpiy1apt  fctlt)sDumur ;o1aeenmf3iysfs2umnms;(4 etrir3oy1fmDr uesl(0tetm(r oo1ll   ncils a2rax  ot4apx if3iad mDeluvsnt) exoxr3iadlatraneilt s2xrxr nudole mnctlt)sDrmumpou4tleomo3ils a uluvpnt0 
\ No newline at end of file
@@ -0,0 +1 @@
+nvil() rxoiopiudaltnliesatf 2taumoou1tlxomf3iasfm rlumo (4alenxocootlmDr nvsl(0teumir iydomtnlfvsat aDrrurp;u4ale miciasfsDul(mo t4 lerxr3oo1fmD lueilt) 2trir3oudlleemfvtl( a2ra(mp;u1apxo fctad a rm(vo;u)tlenxfcoa1lpte nvo;t)t2to(mpoudlmtnmicil( sDra(  ou4apxnmieiltla ea( pnt) exrif tatlm e i i;s0tetrxr3io4oltelfctasfartmu ooo4oee ioctys mDulnvont0arermr iodfa   nvi;()setmxo3oy1ope  ict tfartrum no0aet iietasfs umuvsn()trtnmrcty1la rli ols0tetmxr ou4apen feil() 2tr(mp;u1teen f3iat s ulnmp ()alxomf3tydfpDrluvilt seurirpiodom e fcslt aDra( oou4olxomf3ildfs2ul(vs t)tltnxo to1om  livs (0s2tm(o oydamenlicsls)a2ra(rpnt4olx mo3tyd a2em(mp (4 leoir iatfaDeauvi;t)t2to(opiodal n nes s srtr(  ;u1oeeo icildfs elu s;u) lenxr oatopDeauvi (0 rxo(mpnydameemnvsls a2trxrp;o4ale  feiltla2eln snt4 ltrio3tydlaDrlu s ( trxrxo3ou4om   fvt ( sDrm(mono4tex mieiysfmDeauvpnt)alxomr3ia1fpDraies;s srxoirpoy1omte ici s s2tr(  ou0alt io3tlslm2ul(mo u0trxoircoatfpDrluvo;s srumxrpnudape  iviltf rta(moot0alx  i3tasfa emnms;u)arerif tatoaDrauvo;s)t2urxo oo1opee ncs t)sDtaum ;u1tpxoiictatfa rln o;()aexoio oatla raneo s0setrxo iy1lptnmfct s) 2rrxr oo0apxomi3ilsls um(vs;t) etnir3iotlp rlnesls0s2xr(r iy4lme lnvia()srta(mpnt1apen i3iydlaDem(vpnt0artrir3iytoa rluvi s  eto(rpou1altnlfciltfs2um(mo;t1alt  oetyslm rl(vo;t4treoirctydoaDr nei t)teum(r oy4llenmfetas srtau pou0olt  ociatls2rmu p;()alerxf ta1oaD aueols0srxoimpnydll emnei (f Dtmx  ou1tpeomoetasfa eanvp u4texnmrcoadoa r ues;(  2xoxmpiydoptemfes t sDtmu ont4apeniociasfa raumsn()tltrio3oy1lp r n ol()truo(m iydlm   fvi (f 2umu oou0aptomi3tatla2rlu p t4trxoxrcto1lpD lies ()s2uo(m3iy4op nmnet ()s2uru ooo1oex mociasfm rm( snu4 rtrir3tydom e nvs;(  rxoir3iu1ome  ictasfarrm(mpno4tex ifeiyd sDrm(vpn(0 rxnio3totla eln s t)teum(rpnudll nmfcs (fartm(rpnt1apeo fciat a2el(msn(4aeenmrcto1omte ueslt)seum(r3io4lmeemics (  Dum( ono4texnii3iydfm umn s;u)alxnir todomDr nei s0 rto(mpoo1alee nvt tfaDtmum nt1tpxoif3iat a2ranms;u0tetrmr tytoaD aieols  2um(m3iydol nmfctlsfarurxr ;o1tlxnif3iadls2uau p ()tetnxoctytoptrauei;t)trxrim oudop elnesas  rraxmoou4tpt iociytfa uau onu0 eeomf iatla r u il(0trxrimpnu4op   nctlt  2taumo;u1apto iciydfaDem( s t0arxomo iodlm eaiesls0 exmir oy4llte nvtl(  rur( p;o4altn feiltlsDulu ont4altnif ta1fpD aieslt seurxr ou4lm  lnet s) Duaurpnt1aexn ieiadls2ul(ms u0teeomf3ty1omDean i s0s2xmimpoudamee iesls aDuaxmpnt1tle ioctld s2ul(mo;t)trerir iatfmDe neo s0trtrxopnu1aptelfcsls)s2ur(mp;t0oeeomociasfs rmuvo;(4 rtrmfciytfat  uvs ()trtm(m3iy1olt  fes s) Dtaxm no1tltoio3ildlaDrmums;(0texoio oa1fmt au o t0 rxmxm iodlptemfcilsfarrmu ono1alx  ietytfs ra(vo u) rxrifcootoaD li i;s  2uo(rpnodaptnmneslt) Dumu  ;o4teenmfciat sDemumo t0alxnio todlmDeaneols0 etrirpny4lp nmiesl(  Duaxrp;t4oeenmf3ildfs2uanmpnt0 ltomrctatoaDe neols0s2trio3iodlm  mfci sfs2urumoot1altomo3ildfmDem( s u4 eeomfcty1lm  ln i;(0trxrimpnodlp nlicsas)a2ua(m oo1tlxnmfetls s ea( o (4 lenif ty1fpDrauei t0 euo(opiydaltn fvs t) Dtm(rooo4tpen iciasfs rau sn(0tetrifciodlp  luvi ( srto(r iy1lp nlicsltfs2tr(root4tet  fciatls2emnms;(4trtoxociadlat  ies s0texmimpiy1optelfcil() Dtax pnu0texo iciyd m2eau sn(4 rxoxf io1fmtrauvi (  eumio3ny4am  lncsltfaDumu oot0tpe mo3ildfs el( o;u4tltnxo ootfptr ivs ()tetoxo3ny4ale  iviatf 2rr( pno4tpx  ieiadls emnmo u0 exnmrctodlmtrlu olt)setm(rpoy1lm nlnetl(  2urxrp;u1aex ifciad s2rl(mp t0tlxrmfcoydlpDr nes ()trtmxr3iudlptnlfci s s2tmumoou0opx mictldlaDem(mp;() exoircoadfaDeli o;(0srxr(rpoy1am  lfvilt sDtru pou1olen feiyslmDrmnvsnt)aetomfciodopDr uvs s0t2ur(r3oo4ape  iesltf 2umxronu1aex mi3iaslmDraumsnu)teeoxfcia1fpD lu olt0 2to(opou1lpte nctas)arurumpot0alxoiieiysfs2ua(vs;()tlxrifciytfa   i o;(0seum(o3no4ame mnctatf 2rm(r ;u0teto i3tltlm rm(vo (4trxnxo ia1lm rluvols0 exo(mpoy4lptnliet t) 2ururont4aeeniieiytfmDeln o u)texoifcta1op  livol(  rumir3iu4omt  fcias arumxm ot0tpenifeiad m umnvp t4tetnxfcoytlp e nvi;s0trurim nu4omte ics t)s2rm(root0aet mictatla2uauvp u)alxomf3oa1fpDeau ilt0trtoxm3oydll   ieta( aDrauro;u4oltomociat a umnmpnu)trtrxo3ta1lptelnes t)t2uoxopoy4lm  lnvsa(  2rm(mpou4opx if3iadlm rl(mo (4alerxfcoy1op e nvo;(0 rtoirpny1ap e nvsa(  Drm(mp;t1tleo fciadla2rlnvp;t4artnmr3iadfmtr nvo;s) eumxopnu1aptelfci tfa2rmu onu4opx  fctad mDea(mo (4alenmo oodfa rln o ()s2trir ou4lp eliesl(  rtm( pnt0opeo oeiadlmDemnvs;u)artrif to1fmD  n i;t)t2tmxmpiydalte icsat) 2ra(r no1oex mfctadfm rmn o;t4trenxociytfaD  i sls0 2xoxrpiu1open ncil()srumuront4olx mf3iatfm ra(vs;t)trxoxrciatla eli o;s0 rtm(m no1altn fvsl( sDtmx p;o0olenif3iasla2rlu p;t4 lerxo ta1fmtrli o s0texrir iudomenlfvtl(  rur( p;o1texniocilsfm eauvp;()tlenxo oo1lm  livol(0 rtr(m3nydll  mfvsat  Dtmu onu0oeto iciyt a2ra( p t4tlxrif iy1oateluvi () 2tmiopny4ll   fviasfsrrrxrpno4opt  ictad aDel(vo t)tetnxfciy1lm rai s;s) euoxo3oo1ale  ivi sfartr(mpot1aptnmf3iadfsDeluvs u4texrxocto1laDelu i;s0sexrxm iy1alen ivilsf Dtmx ont0oet ioeiaslsDumnmo;u)aeerif3oatfa rau i (0seumxr3iy1omtn ivsas) 2tmurpou0oeeoifctadlm2uln snu4aetrxr iodfm e ivi t t2trxm iu1ole lietatfsDtr(mooo4oeeo fciad a2ua( on()tltnmfciadop  ln i t srtrxrpiydaptelncsasfsrrax  no1apt  fcilsls2uau p;t)alxoxo oy1opD auvo;s) 2tr(mpnodlmt mfctl()a2urxrpnt1tlt iociysfaDemuvs;t)trenmo3tatla elueslt)texrir3nudomtemfei ( aDrru  ;t1apxomoeiasls umnvp u4tltrioctytfpDranvs;( s2uoio oy4lpe liet sfarum(  no4olenmf3iat aDra( o;u)tltomfctytoatrluei s0trxoxopiydlpt mneiltfs2ta(mpnu4aet  ictls mDrmnmo t4alxnmfctydfp   uei;(0t2um(m iy4om  lnvsl(fa2raxmonu0tlxomociltls2rmn p t4aleoir3tatfp rli o;t  rxmiopiudole mfvs t  rrmumoou4optn fciyd m umnmo (4aetnxo totfaDeanvil(  2umim iodlp  mietasf rraur nu1tpt ii3tlsla2ulnvpnt4aeenmr3iodopD anvil(0trtoxr3io4apt mfvsl(farrrum no4tpeomfciyslsDrlump;u0 ltnio3to1fpt an s t)trto(o3iu4ope mfciltfs2uaxrpno1aetoifeildlm2rmumo () etnxf tadomDeau ol(0s2toir3oo4al n nei (  Duaum ou4teto f3iyt a rm( o;(4 etomrcto1opDrlu olt  rxrim3iudam n fetl(fa2uru  nu0tee mieiad m2eluvont) exrmf3iytlmDeaivilt0 etoimpnu1al   fvi s  rrm(mpnt0tex  ociatfs ua(vp;u0 lenxf3ty1fa rlieo;(0t2xmim3iu4olenmnesa(  2trumonu4olxniiciyt a elnmo;()aetomrciodom r ueo t0 exr(mpiy4alt lfeslsfarrau  ot1olt ii3iatla rl(vs;t4 ltrir oa1lpD anvo ( setmiopiy4lmeelfcslsfs2uaxmo;t0opx  o3tltlsDumnvon()treoiocta1opDe nvils) 2xoio iy4lmt  iesat sDua(  nu0oetniociltfaDua( p;t4alxoxf3ia1fa eaieo t) 2toim oy1al emivsl()aDtaur ou1tex mo3iyt s ulu pnt)tlerircoa1oa rln slt setm(r oydopte iesl(fsDrau  ;t0oetomo3iad sDrlnmo u0trxnmf3iy1lateli s;s) 2tmxmpoudal e ivi ()s2rrxrp;o1oetoiieiatlaDua( s;t0tetrmfcto1laD aueolt)sruoxmpnodop n ietat aDrru  ;o4tpt if3iad mDem(msnt4altrxfciatopte n ol() rtm(m iu1aleemiviltf 2ta(mp;u1oetoifciatfm2eaumsnu4texnio3ootoa r i o;( trtmxopiy4op  liviasfartrxmp;t4olxo fetld a2ranvs;t4 eerxociodoa   nvo;(0trxmir iu4lpee ivi tf 2trum no4ole if3iad a ra(mpnt)trxomr iadfmt anvi;s)srxmir oy1al eliesl()artr(roou1olt  ocilsla ulnmont) lermrcio1laD lnes (0 eumim oo1apt lfesls s2taur nt0aexnifciys s2uln o;(0trerif3iy1oateanvs;( srumim oo4alenlfvslt) Durx  ;o0opxomociltlaDrlu s (4aetomr3iytfpteln ols0 exoxr3no1ol e fvil(fsrumxmo;o0oee ioeilsfaDumuvsnt4aexomo oydomDelueslt)trxm(o3iodamt livt s  2rmxr ;u4aptoii3ilslm2em(vonu)tltrxf3ia1omtrlneolt)t2umxr3iu1al e icia()s2uaxm oo4apt io3tasla ea(mo;t4altnxo3iotfptr n o t) exm(m iydaleelnes t s2tm( ont0alxnio3tldlaDeanms;(4alxnmfctotfmt auvs s  etmxm iydop emncs (  Dra(mont4aleo iciltlaDrmu s;t)aleoio3iodoat  ieo;t0seumxr3nydlmenmfcilt) 2tru o;o1aex  oeiyt a eluvp t0texoxf iodlm e u i s  2um(rpnu1omtemics t) Dra(mo;t4altnif3ildlsDua(mpnu0 etrmrcoodfpt ai sl(  rtm(rpiy4omt lnvta(f Dra(mp;u1tpt  iciytfsDumu p t4altnio oytfa   nvs s srxrxr3oodlp n fcil(fs2rru ono1tltn octat a emums t)altnir3oatfaDrau s (0t2uriopnu1apeemnvta() 2uaxrp;t4apx mi3tydlmDul(vo;t4tltrio3iotlptrlivs t0setr(opny1lpenmnetatfsDta(  ;o1oex mfctatls2rmnvo;u)aeeomfcio1opDr ueo;t setoxr3oudlpenlietlt)arra( pnt1aetomoeild a ra( o;t)trxrio3iytfatr nes;s srxmxr nudamtnlieslt arrau  nt1tlxn fetltfa em(mo;(0texrxo3oadopDr i sl( seuo(opny1ap   nvsl( s2urum oo1tlxnif3ias m2uanvs t4trenmr3iatop raivi t t2tr(m iy1oltelfeilsfarrrxmooo4alt mietyt m2umnmo;t0 rtomo oa1laDelnvi;() exm(opiu1ol nlncilt) ruaxmpoo1tpxo o3iytla rmn onu4 etomfcta1fp elieo ()s2uoxr oy1altn ivils  2tm(m ;o1olx  iciys sDra( pnu)arxomo3oytopt lnvs t setoir nydolenmieia( a2raxm ot1ale mfeilt a emn p;t)teenxf3oa1lpDeli s;( texr(mpiodlp n netatfartru ooo0tleo ictydfaDraumonu4 eerxr3ia1opD lu sl( s2xrxrpiy1lpt lncsasfsrumxrpnu0oeeomfciatla2el( o ()altrmf oytfpte nes t  rumir3nudoleelnvsat a2trxmo;u4alx mi3tas mDrl( ont0 renmocia1omDrli s;s s2to(r3iy4op  livtls sDtmumonu1apx  i3tad m2ea( onu4 ltoifctatom eaueo t0truoxmpou4ll n feta()arta( pot1tltomociltlmDeauvp;t)altnmo3to1opDelnvs;s0 rxoim iy1ope mictltfaDrm(rpoo4apto fciys mDuluvpnt4areomf oydlaDe ivilt0t2toir nodam nmneia()s2tr( pot1apeniieiytlaDul(vs;t4altomrcoodomt auvil() eurxo3io4ape  fet sfaDtrx o;t4aleoioeiaslsDul(vp;t4treoif io1lateli sls0t2xrxm3iudlm  micsas artmu pnu4opeo o3ild a raump;u4aetrxociytop  lieslt  etoimpnu1al nlivsl(f Dra(  ;t4apxomiciytfm2umnms;u4trtomo oatlptr neo;s)tetmir io1alee ictl( arrrx pno0tle mociyd s2rmuvsnt0altomfciadlmtr i o;s) rxm(o3nudlpen ncil()arurxro;u1aeen ocilsfs ean s;u4tlerir todop eanvsl(  rxrio3oo4ole lfes t) 2ur(r oo4olx  fctasfmDrlums (4 ltrmf iy1fmt  nes s  rur(mpoy1am emiei ()a2rmumoot4tleoifciys m umuvs;t0alenmr3totla e u i t0setrim ou4ol emfcsl(f rtr(rpno1aetnii3tld s2elnvsnt4arxnmf oadoaD an ils0 rum(r iu4optnmfvils sDraur oo4aetn ieiys aDeluvo;u)arenmr ia1lmDe u o (  2umxo ny1op e feias)aDrru p;t4tle ifciyslmDuan o t4alenmfctydlpt  n o s) rtr(mpio4apeemncslsfsDtax o;u1teen ietld a rl(vpnt)aeerif3iytomte u s t seurirpiu1opt mivta(fsDumxm nu1aeeo oeildfa2elu o;u0 ltnif3ty1oaDelnvs;( s2xo(m3nu1lpeemfvias aDtaurpno4olt ii3ias m elnvsnt0 exriociy1lp r i s s0 euoio3oodlm emneslsfsrtmurpnu4tee ifciadfa um(mo;t)tlxrxr ta1oat an i;s0trumiopiy1amt lietas)aDur(moot1tetniociyt sDrmnmp;t0treoiocoy1omt li sls srxm(rpiu1om nmicta(f Dtau pno1tptoifcias aDrluvp;()teerioctadomte i sl(  exo(mpiydllt mncsl()s2uau  no1olto f3iatlmDumu pn(0alxnmr to1fa e n ils  exmio iodamen nvt sfa2taum oo0oltniociltls2ul(mo u0aetoiocootfmDrlnvs s s2tmim ou4llte fvias)srra( pnt4olen oeilsfaDem(vo;(0alenmr3iatlpD lnvs s  2trxr oo1lmt lncslsf 2rau pot4openiieiysfa ulu onu0artoxocootfmt livi;(  rxoio oy1alt lfvsasf rtrum ;u0olxn ictytfm rm(mp u4arxnxf iytlmte uei;t0s2uo(rpiudale livil(f rtrxmo;o4olt iieiydfs ranvs t4 lenxr3iotom e ivo () rurio3oydaleemneiat a2ra(m ;u0tet ifcilslmDrl(vo;u0 lerxf iatop elues () etrir3iu1lmtnlnct ()sDumum ;u1tlen oeiysls eaump;u0areriocty1lpt auvs;()t2xoxm3iodaptemnvsas) Dur(rpot0alt if3iltfa2eln s u0tlenmo totopte ues;s0trtoxmpoy4lle lfesa()srrru oou0alt mfcild m2ulnvo u)trtrxf todfptr ies;t) eur(r3oodope mnetl( arum(mpot1ole io3iysfmDrlu p t)trerxrcootfatr uei (0sexo(m3iodoleemictas) Dtaxr ot0tle mfciatla rlnmon()trxoxr oadoa  auei ()s2xr(o iu1ol  mivilsf 2tmxmo;o4altnmf3iyt s elnmsn()alenmf3ia1oat lnei;s0 rxo(m iu4optn fctlt  2rax p;t0tptn f3tad sDul(vs (4alxrir3ootlmD lneil(0t2toiopio4llen ivtl(fs2urumooo4tpen ieiad sDumnmp;t)trxnmrcoa1omD lnei ( srtr(m3nudolen ieiat) Drrumo;o1aleo fctlt sDel(mo;(4artoir3iytlp eluvi s0 rxoxmpno4open netl()arua( oou4alt  octlt aDra(mpnt)trxrxf3tadlpt an i s)texrxmpny1op e ivt s  Dum(m ot4oltoiieild a rau o;t)texrmfcoadop elivilt0trtr(m nydal nlicils)a2uaumpno0apeomieiytfa2emnms t)trxnmo3oo1omDeauvo;t  2urimpnudaleemfetl() 2rrur ot1alt mocilt s eaumsnt)alxrif ia1fmtrliesls s2umxm3oo4alenmfcsat)artmxr ;t0apx io3tlt m2ra(vo;t0 eerir totomt  neo;(0texmimpnydll   fes t  rtr( p;t1aleo o3tytlm2umump;u)treomo oatfa  lu olt0 exrir no4altelfetas)srtr(r ot0apxnmi3ils a2uauvo t4 etrxo oa1fate u i;( trur(o3nudaptnmfvta() 2umump;t1apen f3tas s umnvo;t)tltomoctytfa  au o s) 2xoirpnu4ap   ncsls artmu onu0oetnmf3iaslsDeanvsnt)trxnxr oydlmt anei;s0trxmim ou4lltnlnei () rum(r ot0opeomf3ias mDeau p ()trxoio3oadfa   u s t)s2tm(opnu4lm nlnei s)a2tau o;u4tpeo iciysfsDulnmp;()trtoxr ta1omt lueo s0t2uriopnu4ame lieil(faDurumo;u0olx  fciys aDel(mp;()tlenmr3oatfa e nesl(  rtrxr3nydap emneta(  Dtr( oot1alxoiociat s2rauvo;u0tleoifctatfm   ies;(0s2xmxr oo4llt mfctl()srrrxr ou0oltoifeils m2ul(vs u0 ltnioctatomtelneo ( t2xmir iydlmeeliviltf rur(m nu4oetn o3iys a2em( o;u0 lxoif3iotlmte u o t0sexmxo iy4aptelfcsat)artr( p;o4apx mf3iasla2ua(vo u4 leoir tydfp  au s;t0srxo(rpno4ameemicilsfa2ua(r no0oee iocildfs ra( pn(0tleoir3oa1lptr nvs;() exrxopno4ape liesasfs2raumpnt4oet  i3iysls ra( p;u0teenir3tadfpDe neil( srtmxm3no4ope lfes () 2uaur ot1tpxnmf3iasla2el(mo;u4aetrxf tydopt livs ()s2trxm iodlp  lnvs s aDumu o;o0tlt mocils m ra(ms;(4tetrmo3todlm  ai slt teuo(r nu4llt lfet tf Dtaxrpou0aee mieiatla2rau pnt0tetrxo3ta1om r n s s) 2urxm3iodap  lnct ( s2tm(r ou1aet ii3ildla em( s (4texrxr3tytomteai i;s  rxmir3nu4amtemict s a2rm( p;u4oeenioeiat m em(vo u0 renmr oo1fa eaivilt  rxo(m3nu1olt  neilt)a2ururo;u0texo iciad m ua( p;u4aexomocoytfa eanvs;t s2xrxr3no4lptnmfcsasfa2rmx pno1optoiociydla2umu p t0aetrxf iodfmDelivi ()texrir oy1ap e fes t  rra(rp;t1tpenio3iys a ran ont)tleriocio1lpDeaivo t0seurxm io4ale  fvsa()arumx ont1apto ictat a umnvpnt4alxrmf todom r i o s0s2toxopoo1lm nmfvsls srtrur ;o4opeo ociys a uan s u)texoxr iy1oa e i o;()t2xoiopny4opee icia(fsDurx p;u0tpe  fcils sDrl(vp u4altrir ty1lptraiei;s)s2tmirpiudoltn ncs (fs2rm(m ;t1apeoifcild m2ua(msnu0tlxomo iatfpt au o s seto(r iu4apeelneilt sDrr( p;o1oet  octlt a2ea( s;u4artnmr3tytlpD  nvo t0trtoio nu1lm   ivias aDtr(rp;o4oeeoif3tysfm2emu sn(4 rtnmo3iytlmDeaieil() euo(r3ny4lltnlieia( sDuauro;u1aee mfciadla ulnvpn(0tlenmf3oydlmt lu ils) 2tmio3iu1omeelfcsl()srrrxrpou1tleniictysfa rlnmo;u4tleoxfctatoaDeauvilt  2umxmpio4omtnlfvtlsfa2um( ooo1tex  f3tltfs2rlu s;(0alxnxr iatfat aies;t srtmxr3oy1al  licsls)aDumu pnu4aexnmfctldfmDeanms (0treomocoydfmDeln i;s)seumio3oo4oltnlfcs t) Drrur ;u1tpxo ieiyd s2rauvs;(0 ltoircoydfmtranvs s) rtrxmpnu1lpe licsatf 2tr(  nt4ape miciydlsDel(vo ()trermfctodfmD ln slt) 2xoio3oy4alenmfviasfaDrru  no1tpxoioetaslm ulnvo;(4aexomocootla   nes () 2toxo3ou4apt  neiasfsDrrxronu0opt mi3iasfm eanmsnu0 renmr oodfm rau s s  rto(o3oydamee nvsa( aDua(m ;o4oee  fciatls2eaums u4altnmf3oa1omtraneols) 2umir3oydal elfvtl(fsDtmump;o4tpt mocias aDuan o u)tleoio oodlp raues;s) ruoxm oo4olt mietat sDumx poo4apen i3iyt a um(vp u0alxrmo tadfat liei t)trto(o no4al nlfvsltfsDtax p;u1tpe  ieias s ul( pn()aexnxr3ta1fpteli o;()t2to(mpio1apeelfesasf Drmurooo0opxniiciyd aDrmuvpnu4altoxo iodlmt ai s;s)t2ur(o3io1al n ies t aDur( pnt4tex  ieiytfaDrmnmsnu)trenifcoo1oaDeli o () euoxmpnydal   fcsatfs2urxr ;t0tlenio3iytla ulump (0texrifctatfp ran s t0 2umim3io1olenlfetas) Duaurpot1apenmietadfaDrlu snt0 rxnircootoat  ieil(  rumirpoydam n feil(fs2raxmono1tleniiciasfa2ean onu)texnxr iodlm e nvo;s srur(rpnydlp nlicslt srrmx  ;t0tptoif3tyt a2uan p;(0teenif iatlmtranvo s) exrxrpny4lmenlivtat  rrmumo;o0tlt ioctaslsDemums;u4 rtrmfcoo1fpD  ieol(0t2xrxmpoo4lm  lncs s)s2uaxrp;u1oetomi3ias s ea(vs;(4 lenxf3iadlpDraivs;(  2uo(r3ny4lptemics ( sDurumpot1oexn oetydfs ulums;() lerir oodomD anei;s teumxr3nodol nmfetas sDrrxr oo0ole  o3tlt sDuan s ()tlermr3tadlmD ai o s) 2to(r nodal nlietat  Drmur nu4tltnmieiadfsDemu on(4tetomrciodfpDr nvi s0 2xrio oo1lpe mieia(  2rmxmo;u4tpx mo3iat aDumu p;u0arerxo3iadlp r ivi;s  exoxr3oodaltn ieils a2ra(mp;u0tpxnif3ilt m2rlumon()tlxoxf totla rau o s0 rtrio3ny1amtnmnes s)a2ur(rpno0apt mieilt s2el(vont)trtoio iodop e ivs s0srum(m oo4llenlivsas  rrau poo4opeo oetldla2ranvs u4 lermf todlpt aues;( teumxm3nu4apt  ici (  Drr(monu1alen ociatfsDrl(vp (4 renmocoo1oat au s;t0 exmxm3io1amt mncil(f rtm(ronu4aptoioetytlsDemnvo (0tetnio3iotfm e u il()trxrim3io4optelivi s aDtmxr nt1tpt iociysfs2eaumpnt4tlxrxo ta1fa eauvs (0 2xmxo no1oleelietasf Duru pnu0opxoii3iad mDeanmo;t) rtnxr3iodfmDeanei s0srtmxo3io1amtemfci s  2tr(m nu0opxniieiysfm rm( p;u) renif iydomD lues;(0setrxopoy1oltemietl()srurxr ou0ape ifcilt sDem(vs;()altnio3tydfptean ils) etmio iy4lp n iviasfsDtmxrpnu4olxn i3ias m um(vs;u)treniociytopteluei;(0truo(r iydlp n netl( srurx poo1opeomoctysla2el(msnu) lxoiocoatlmDeauei;s  euo(o3oy1ll  mics t)a2rmxm ;u4tetoiieiydfmDrm( o;t)aetrxociatfpDrai o s0sexmio3iy4amt lics sfsDraumono4tetomieiadfm ua(vsnt4arxrxf3iodopD aueo s)t2xr(o oudoleemfei s  2ua(mo;t0tpxoio3tldlm ra( s;t)artoxociodlmDrauvo;( t2tmxm iodolt mnvt ()a2um( o;u1oleo oetat a2el(vpnu0 lenxrcoatlpte ieo (0s2xm(rpiudom nmfvt t)sDtruronu0tlxo fctatla2em(vs;t)trtoxr3iatop e n o s0t2um(o oodom  mivtl( arrm(  ;t0aetoiiciltls ulnvo t)alxrxfciatom eluesl(0teum(o3ny1opt  ivias arrmx poo1olxn feiadlsDem(vp (4tltnif3iatom e i ils tetmxo iy1amtnmictlsf ruax pot4oeenmiciydla2rmnmo;t) rxrxocoo1fa rluvo;t) rtrxopiu1ope  fct ( arum(rpnt4ole iiciatlmDel( s;t)teeoxo3iotfpDrau i;(  rtr(r iudop   fvs ( a2tmx p;t1aptn o3ilsls2ul(mo;u)aexrxf3oatfaD anvo;(  rxmir3iydaltelivs s a2taumoot1tpxoiieiyt aDranvsnu0tetrif3oo1omtr uvi s)trum(r oy4ll nlics t  2um(rpnu0olxnmiciys a elnvpnu4aetoio ty1om   neo;s)sexoxmpiudapeeliesas aDta(rpou1aet  icildlaDuanmo u)aleoxo oatlp e nei;s)t2trir3io1apenlfetat srrrxmpoo4alxo f3tyd mDrmuvonu)aexoxr3oadfp  lnei s)tetoxo oo1ape lnvsls)sDtm(roou1opxomf3iytls ulnvs u0aetoxo3io1fp   n i t0 exr(o3ou1aptn ncil(  2taumo;t1apxomoeiltfa rmnvp;u)aleoxf3oo1opDrluvils trxo(r3no4am n ies ()arrax  ;u4tlx ii3iatfm ul(monu)tlxnxo iydlpD  uvs;t)texoimpio1ap nmfctlt arrmu pou1oexoifeiat s2eau pnt4 renmociy1la e ivo ( trxm(m3oo1al elicia() 2umxmoot0tptn ictydfs2uln pnu)altnif oytoa eaieil()trur(mpiydole  fcs s)s2rmxm nt4oetnioeiad a rmumpn(0 rxoxr to1oatelivs;s0t2um(o nu1ap emneta()a2taumpnt0apeo i3iytfs2rmn snt0altnxrcoodlmt lnei t)tetmxr3io1apee neilt sDtmu oou4oexn fetldlsDum(mp u)tltoxo3to1lpDe ieslt0 2umxr3nudlmt  nvsas) Dum(  oo4tet mfeiadfm rl(vpn(0teeoxo3oa1omDeaneslt)t2tmir3oy4lpte ivsas arrax  ;o4open ociyslm uau s (0 eenxo3to1fmDrlies t) exmio3ou4amen ictat aDrru o;o4tpenif3iltla emu pn()trtoifciadlpDelivilt  rumir3iudlme mfeias) Dtrumooo4alt mfeiltfa2ra( p;(4arerio3iydlp rau i () 2tm(m3iu1lpe  ieslt  rumum ou4tpeniieild aDeaumsnu4 eeoxfcoa1lmDr n sls srtr(r ou1ll  lfeslsfaDuau  ;t0optomoctadfm2emu snt0alenio tydlpDrlnes;s)sexr(o3oy4lm  mfeils aDrrxm nu1tltn oeiys s em(vp u4aeenir3oodoateluvsls)sexo(m3io4om emnvtlsfsDtaumono0olxoioetldla2ua(msn(0artoxoctytlpt anvo t0 rxm(m ou1ol emiei ()sDrmxm ;t4aee  o3iltlmDeanmo;()altnir iy1la  auei;(0t2urxr3iodoleelfcils srtm(  ;u4tlenio3iyd sDum(msnt)tetrmfcoadom ran o;t0sruoim3oudal nlicsasf 2uaxrpno1olt ioctls s2uaumsnu4alenir to1lateanvo s) 2tr(m no1olenlnvslt aDururono1tetnmieiysfs2ul(vs;u4trtrxf3to1fmtrln i s) rto(m ou4alee nes tfa2uaxmonu4tlxnifciatfa uaumsn(4 rerxrcoa1op eln o (0 rur(m3oydlm e ics tfarrmxmpot0alx mfeilsfaDrmn pnu)arxoxocto1omtrlnvolt srtr(opno4openmfet t) Dumu pnt1optomociytlm eau pnu) etnmocty1oateaiei;s0 rxr(mpoy1ol  mfesa(  2um(r ;t1texo feiasfs ul(msnt4trxnxr tadfate ueil( t2tmxm3io4ol e nvt (fa2trur ot4apt mi3tasls uauvonu4 lxoirciy1omDean sl()teurxo nu4ame lictasfa2ta(rono1tleoifeilsls2uan pnu0aetrircoodlmDranvo (0 rtoxopnudope mneta(faDurx  ;u1olx ii3iydlm2ua( snu4tetnio3to1faD anvo (0 rtm(o3ou4optemfeias)arrrump;o0opxo o3iytfmDeaumpnt4 lerirciatop  ln o (  2uo(m3oo1oltnmiciasf Durxrpnt1aleoii3iatlm2ul( o;t0aleoxr3iydla raiesls truoir io1op e fcsl() 2rr(  nt4oeeoiieiytfa rmu pnu4 eenmf oydfm raivs t teuoxo3oudome mfviat)a2urx o;o4tlxnmictytfs2emnvp (0aeermocoatlpteauvolt) rxrim3iodamt  iei (f 2tru o;t1alxnifetatfsDrl(ms (0aetomr3totoa raivs;(0 2xo(m iy4ap nlnetl()sDrm( pnu0oetnmoeiatla2ra(monu0trtnmocia1fmt au s (0 2to(o iy4op  lfet ( a2um(r oo0tet iocils m eanmp;(4arxrmo ootlmteaivi;(0teumxrpnudalte nvsasfs2rrxmo;o4aet micildfsDranms;u4tltnmf3oy1lmt  i i;s)srxmxm oy4lmtelfesas)srurum no4oee ii3tltlaDulnvpn(0 eenxr oatoa  lu sl()srto(rpoydlme lfviasf Dta(moot4oee ii3iltfm2ulump t)alxrxrcto1om e ues;t0t2xr(m oy4llt mfvils  Dtax  ou4apeomfciydfs emnvs t4tltrio oadlmDraivo t) eum(opoudomtnlictat sDuaurpnt0oet mi3tasla ran sn() ltnmrcoy1om  au ilt0setrim nu4lp  mnviat)s2tmxrp;o1tltniieiydfs uluvs ()tlxnmf3iotla eai i t0trtmimpnodope  icsas)aruaur ;o0oltoii3ils sDea(mpnu4altrmr iytomte nvi t) rxmxm3nudlmt mnci ( aDuaump;t1teen ocild a2umnmsnu4aleoxrciytfpD aueo t s2ur(m iu1amenlncils  rtm(rpno4opt  oetasfsDum(vpnu4tlenio3oodomD lues t0trxrir3nodamte fcs sfaDrmu  ou1opx iieiytfm2rlnmp;u)tltrxr oadomDrauvsls)srurxmpno4al e iei (fa2ua( p;u4tlt  fciysls2rmuvont)tetrio iotfpD  n slt  rtm(o io1altnmncta(  Dtm(mo;t0tet moeilsfa ul(mp (0 lxrxr tytlptrlieo s)setmiopio4olt  ivtas arrm(  ;t0aexomoeiydfsDrm( o;u) lenmociytfat  i s;s  etmio3iu1omtnmivt (  rrmxm ;u1aptomf3tadla rmuvs;(4aetnir iadom raivs;s)srurio ny1lpeelfctl()s2umu  nu1apx  oetltls ea( p t4teenmr oodopDrlieil(  2tmim3oydlltnlivtlt sruaumooo1oex  fctadlaDua(vs () rxoxr3tadfmtrluvsl()s2toimpnu4am e fvsls arum( ont4ole mo3iydfm2uanmo;t4 rxnxo to1opDr ueils  2uoxo3iudol   icslt)srtaxrooo0oetomf3iydlm2umu o;(4artnxoctadlmDeaueo;s) 2uoxo io4al  mfctas  2tmx  ;t0apt  i3iyt a uau p;(0 etnir iydfpDe ueo;s truoiopoy1am n fctat sDrmum oo1openmietadlm uauvpnt4 ltoioctatfat aiei s texr(m3nu1al nlnetatf rur(mo;u0opxn iciasls2em(mp;u0 etrif3totoatrli sls  rurimpnodap e fvilsf rum(rp;o1olx iicild s um(vp;t0tlenmr3iy1optr i s;t  rtr(mpoy4lmeelfcsas)aDuax  ou1tee mo3ils a rmuvp u0arxoif iy1fateaiesls trxoxm3nu4al n nvil()arurumpot4olxnifeiysfmDean s t4tleomf tatoa  an s t trxmxm no4lmt mfvilsf rrmxmont4alx if3tyt aDrl(mp;u)trxomoctytfaD  i o;s  etm(o3nu1lp elfet t aDumurpou4aleoioeiatfaDumn p t0 ltrir tadopteluvol()srumir3nodome lnct t)aDrmxmp;t0tlxoifcild s2uan sn()teeoxo3io1opteaneils)seumiopiy1ap   ncil()srrrxr oo4openifciad a eanmo;u) rxnxo3oytom   n s;s)s2tm(m oudapeemicilt) Dumxmooo4olxomieiytfaDrm( snt)aetnxociodop elues;( texoxopoodomte nvilt sDtrumoou1olxn ieiadla2rl(mo (4aexoir3iotfpt aivs s setmir3iu1optnlietlt  2rauro;o4tlxnioctyt mDel( pnt4 ltoxfciatfmtr uvi;t)srumxm3iy1amen net sf Draxm oo0alxnioeiatfaDrluvs t)arxnircoytom  ln s ( srto(r3oo1lle  icia(fartaxm ou1opxn feiyslaDeanmp;t4 rtomf3iy1fm  aivols0srurio3nydaltelfcsas  rrm(m ;o0aetomfeiys sDuanmo;t)tlenxociytlp  aiesls  ruriopnodom n ncsl(fa2ua(ro;t4tex io3iatfs ranmon(4tlenifcoytlm raivo;s trxoirpiu4olte ietlt  2raumpnt4aexnmf3ils a2emuvs;t0teeomf3oo1fptrlnvsl( trxr(o oo4ap e icilt)s2rrxmpoo4teenii3ias m2rm(monu)alxnxo3ia1opt luvi;(  exrirpiy1lltemnci sfsDrau pou4optniieiatlsDelump ()aetnxoctotfmtelieil(0texo(m3iodllenlnetltf rrrx  ;t4tpxoiieiyslm2uaumo ()arxnxocoydoat au o t)srtriopoo1lpeelnei (f 2rr( ooo1oet ifciytfaDrm(vpn()tlxoio iytfaD lieil() etmxopoo4lmtnlivt ()srumx  ot4optnio3iltla2uauvsn(4tlxrxf3iydopDeau olt0 2xm(m nu1lptn nvta(  2uaxrp;t4ole  oeias m ra( p u0trxrmf iotfmD anvo ()srtmiopoudlm nlieta()s2rru  no4oexniieiydla2rlnvs;u4alxnxfcoatfmDran s;s setmir ou4lpenmfvs (fa2um(r ;t4tpxomoeild m ulnvsnu0aexnxo3oodlmDean ols teumiopiodlmtemivia( s2ururont0tee mi3tldfm2rmumon(0trerxo oa1op eau o;t0 rxmxopnu1oltnmfvtat)srra(mp;t0apxniicils aDulnvs () renxrciy1oatr ieo;(  rtmxopoo1lme lietlt sruaumont4tptomi3tls mDel(vs;(0artrmf to1omDe n s s)teur(mpoy1ope mietls)s2tmu ont0alen iciysfs2rluvpnu4aexoxr3oadlpDelues t0s2urxr no1lp   icta(faDrrxr oo0opxomfeiltfa2uln s;t4alxoir3iydfaD  i o;s0sexmiopny1apt mfesa(  rtr(m no1tpe ii3ilsfa2rluvo (0altnif3iotlaDrai s;t srtm(o iu1ap  lnetlsfaDta(mpnu0apxomoeiytlm2rm( s;() rtomo oytop r ivo;t0t2xrio iodomtn nvi () 2tmxmo;u4alt  o3iysfm rm( o t0 exrmocoa1lpD  i ol()t2umxmpiodopte fctatfa2rrur ou4tpto ieiltlmDrl(vsnu)teeoir iy1faDelu i;t0 2tmxo iy1apenmieia(f rurx pnu4aee iictasfs umumont4trtrmo tadfmDe uvi;( setrio ou4aptelfcs ()sDtr(mp;o0tlto feiyd aDum(msnu4 etrxo ootlpt  u o s) 2urxo3oydomtn ietls  2umxmpou4aleo fctatfs2el(vsn(4teerifctadfp  an slt0 rum(m oodamtnlfei t)aDtax oot1apeniicils sDraums (0arxnmfciytlmt  nvs t srumiopno4ap nlfcsls)sDtrx o;t0alt ii3tyt m2rlu o;(4altnif iodom   ueolt0setr(opou1altn ncs t sDtm(mont1ape mfciad m2em(mpnt0 rtomr3tydla eaueol( seur(r ou1optnmnctlsfsDuau  oo0aexo oeias sDumnvs u0tlxrmociotlaDr ueolt setrxmpnu1llt lncta()aDumu ooo0oltomo3iadla2rmu o;u)teerio iatlaDr uei;(0srtr(opou4omeemfeils srraxm no0altomfetldlsDrmu p ()altoir to1lptranei;(0 2umim iodaptnlicsas)a2uaurp;o1tpeoiictysfmDraums (0 rtomociotlmtrau o;s0 rtrio3oodope  nes ()sDra(  oo4tpxo f3iydlm ea(vont) exnmo oatfm e uvi;t0s2to(rpiodopen nvsas) Dtm( o;t4tlt  f3tldls uau s;u0altomo iatfm eln s;t  2to(mpnu1lptemiesltfaDrmuro;u4opxn f3ils m2elums;u4 lxnmo3iodlpte nei t0setmxmpno1omtemncil(f rta(  no4alt ifeiadfsDrmnvpnt4tltnmf3totlaDrlueslt0seuoxo3ny4amee ict ( arrrump;u4olxnmociatfs2rmu p ()arxomfcoodoa r i i s)srur(m oy4omtn iesltfsDtrum ou1oexn f3iatfmDumuvp;()tlxomfcoytop e ueilt)t2uoiopnydlp nlfeilt arumx  ;u4alenmietasfmDrau pnu4trxrifctotlatraieo (0 etmimpiy1lm nmictat a2tmur ;u0ole  fctls mDeauvp;u4altnif3to1omD anvolt trtrim nu4omtnlieias) rtaxm no1ole  o3ils a ulnvs t4tlxoxrcoydfpt ai i t  eumxo iy4op  lnci s a2rrxr nt1apen iciadlm2el(mp (0 rxoxr3oy1laDelueol( t2toir3oudaptnmnes (f Drrxmpnt1openmoeiytfa2el( o u0texnmr3oatla  lnvs t truoxo3iodomeelfcs tfs2umu  no4tlt mfctysfs2rlnvp (0trerxf tatlpDrlu i;(0trxoim3nu1lpte nct s)aDrmur ;u1aexn o3iys aDrlnvo u0 lxnir3totomDrlieo;s)tetrxmpny4am elnvs ( srraxm no1tlxomfciyt sDrlnmp (4 eenxocoa1lmtelu ils0 etmirpiu1al n ncsat) 2tmumonu4teen fcilsfmDeauvs t4aetrxociodlpt  i o;t trum(o3iydlpe lnvtlt)a2um(m ;u1alenifeiyd aDrln pnu4trxrmo to1lm  lues;(0 2xoim3iy4omtn nviltf 2uaurp;u0aptnmociyd m2el( snu)tetnmo totopDrlnes (0sruoxopiudolt micsls sDtax  nt1tpe mfciyslm2uln snu0teermr3tadfm  lieo t0sruo(r3nudolenlfeilt  2umx o;t0tlt  ictlsls rl( s;t)altrxr iadlaDeluvsl( s2xoxrpio4ap n nvta(farurxm ot4tltniieild a uanmo;u4texrmr3oatoa rlu i s0srxmio oydalt lfetat)a2taur ;t1opx  ieiydfa emums u4alxnmo3oodoaD  nvs s sruo(r no4alenlivtlt  rum(rp;t0tlen i3ildls2eln o t0 exrmr3oodfmD  ieilt  2uo(m3nodomee fei ()s2uax pno0olenio3iltls2umump t4arenxociydfmteauesls srxm(rpiy1olenlfcta()aDrm(m ;u1aexoiiciad aDrmnms;u4 etnxr oo1omtr i i;s)sexm(opio1llenmfeils  2rrx  ou1tpto ocildfaDumn pnt) renir3iatoa  auvsl() 2uo(o3oudaleemiesas) rrm(root1tltnifciytfm2rau p;t)aleoxf io1oat  i s t  rurio3iudapen fvtls sDraxmpnu0altomo3iltfaDea( onu4 reoxrcoa1fm   ies;s)trxo(mpiydap nliet t) 2urxmpot4aet io3ild sDemn p;t0trxrif3iotoatrau i t t2trxmpoydamte ivi () rtmu p;t1tlto oeiltfm uauvo;u4 rxnifciadla  li o (0 2tr(r3nu1omeelivtltf rrmurono1apxnmociytfm2rm(vo (0altrmr oydfa   n ils0 rxo(r3iodlleemfvil(  2tm(mpno1altnif3tyslmDumn s;t0 eeomf3oy1la r n ilt t2xoiopnu1ol elfvsl()s2uaum oo0tptoiiciadlaDra(vsnu4 lxrxf todomt ai o s) exrxrpnudlpt lfviasf rtm(r ;u0oetnmfeiys s ranms (0aexnif3oatlaDelnesl(  2umio io1openlnvsasf Drrx ont0opt moeiasfa2ul(mpnu)tlxnmrcty1op elneo s0 euoio iydaltn netlt)artmx  nt0apeoiictyslaDra( o t0aetomf oadfa eluvol( srurxr3iu4omte ietasfa2rm(m nt4apt mfetasfaDuln snt)altrxf iatfm r n o () rtoirpnu1omee nvtas)s2urxrpot0tptomf3tydfm uln snt4aeerir ia1lmteaieolt) rxmxr oudal   nvtlt) Dra(rpou1tetnmo3tas a rl( s;t4alxoioctydlm r i i s) 2uoxmpiydllt mictatf ruaxroot4oee if3ild m2ra(ms u0 lxnifcoatfmDe u i;s0texoio3ny4lpen fvta(faDraum no1altnii3iydfa ul(vs;(0 etoxo to1opD au i s0texrxo3iudoltnlieta(  rum( o;o0tptnifetadlm2em( pnu4aeerir3tadfmte i s t0trxmxrpiydlp n fvs sfsrrm(mp;o4tetoii3iatfa2umnvp (4 rxrmr oadlmtrau il( seuoxo3iudol n netlt  2rrxmpot4aetn fciysls2rm(vpnu4aetnxr oytop  anei;( srtmxm3iydop nmiciatfaruau p;u4ale if3ildla2ra( s;u4 exnir oy1fa  an s s0 2tmirpiu4ol  lnvt (  Duau  nt0tlx  fctat s rlnvon(4aexnmocoo1laDr n o;s0seurim3iu1lpee ncslt aDtauro;t0olto ieild aDeanmo;(4 lerxocootom raivs s0teto(m oodop   ieias artm(monu4tptniociydlsDrm( ont4alenxr3ty1op e uvil( t2toiopiu1om elfes ()aDua(r ;u1oex mo3tasls um(mo u0 ltrxo3iy1lpte i sls0srxr(m3nu4omt mnes tf Drrum ;o1optomfcilt m ulnvon() lxnir3oo1lat aues;()t2xoim3no1lpe mnciat artrx ono4oex ioeiaslm2el(vs;t4aexrxocoydlmDeli i t)t2ur(r3ou1llt mict () rrr( ono4optomietls s emnmo;() leomr3iotlp e neo s)truoxr3oo4am   fvsas arrmxrp;u0alxnmfetldlm2ulu o;u0 eerio to1op rlneo;s0s2umxm no1opeemicsas)srumum ou0oltn ociasfmDeluvo u4tlerircty1oatr ies s t2trio3io4opte ieiat)sDum(mpnu1teen iciadlaDra( s;(4texoxr3iotlaD aieil(  rxr(r nodlp  lici (f Drrumpot4alenmocias s ul( snu4 lxrirctytlmtelueilt0t2xmxrpio1open ivt (f 2umx  ot1tetn fciyd m2uanmo ()alxomoctatfmD  uvol()s2uriopoo4amt lnesls) rua(m ot0tpxniiciasfa2uauvs;t)altoxf3iy1fateluesl(0 exrxm oodlpee feia() rtmu  ;o4oet  i3tat m rmumo t)teeoxf iodfa r ivo s) rtoxr io1lltn neta(faDrru pot1tleo ieias mDelnvpnt4 rtrmrcoa1oa  lu o;(0 2umxo3no4ol  lfcsl( sDraump;t4oetomo3ildlaDemnmp u0arerio ta1oaDeaiesls  eto(o oydaleemnvsl(f 2umxrono0ope  ictltlm ul( o u0 eerir3ta1om elnvi () 2tr(rpoy1alt lnet tfaDrm(mpot4tptn ictasfm2rmnvo t) lxnifcia1fpD  nvi s)s2uoiopiy1amen ivtlt) Drau  nu0oet iocils aDrmu s;t0aexrif iydomDr uvol( trxr(r oo1amt mietls aDrrum ;t4oeto feiydfs rmuvsn(4tlxnmo oo1lmt au i;( t2toxr iydolte fvtas  Dtau ont4oeto fciyt sDelnvsnt4aexoio3iadfm r nei;( t2trir3nudal   icsltfsrraxrp;u4tlt ifeiyd mDrauvonu0arerif3totopte iei t)t2tmim iudlltnmieta()srrrxmpou1ape  ietytlmDea( sn(4trxoio3todla raieslt s2tr(o3ny4optn fctas sDumxm no0tlxnii3tydfs umuvsnt0treomoctadfp eaivo (0t2toxm iy1amtn ivi s)arrm(r ou0ope ioetydfa2elump;t0 etomo ootfmtraueo;s0setmxmpnudom   fvsa(fa2raxmooo1aptomoeiysls2emn snt)teermf3tadfaD liei;t)t2triopnodale  ieil()a2umxmpnu4tlenifciaslsDemumo t4tltoif ta1fa eanvilt)srtm(r3no1lp elicil(faDumx p;u1tet  f3ilt aDea(mpnt0tlenmfciydlmDrluei;s) ruoir nodlpe  nesas)a2uaum ou4optn ictytfa elnvo;t0trxnxoctytoa rliesls)srtrim3io1lltn icils  2ra(mpot4tpenmf3ils aDeauvsnt)arerxo3iytlp  an ilt0s2umxm3oudlltelnvia(faDrr(  ;u1aee  o3iat mDel( s;t4 leoxf3oo1faDelnvolt0trxmim oudope mnctlt  2trump;t1alxoiocildls2ulu o;u) rxrxf3oodfptr ivil(  rtoimpio4ape mnetlsf Dtaxmpou4olxo fciysfs2ra( on() rxnmrctydlptraivs s0s2tr(opny4am  lfvtatf Dta(rooo1oexoioctldlsDua(mont) eeomr3iydlat luvsl( sexoir3iudoltnlncsl(faDra(r ot1ope  oeiydfm uaumpn(0tleoircoa1lateanvols tetrxrpiydlm nmietlt sDua(  nt4tlxomo3iytfsDeln s (0artoir totomt  nvo t0 rxmio iydapt  ivias  Drau pnt4optomf3ildfsDumu o (4trxrmf oydoat aivi t  rxm(rpoy4omtnlfcsa( srtr(rooo1teto o3tltls2eauvs;u0teenxr3todlatrlu o;s)seurxmpiodllenmfvtlsfs2tm(mpno0ale if3tatfsDem(mpnu)altrir iotop  aneo;(0teum(m3no4omeelivtl(  Drr(  ot4tle  i3ias a2rmnms u0aetoir3iadoatrlieils  ruo(opiydlpenlieta()aDtmxmpnt1tlt mi3tytla2rau ont0 renxf ty1fmD aues;s0trxriopny1lpe  feiltf 2ur( ono0texnmf3tldls uanmonu4 lerxr oodlmtrln s;()t2to(o iydomen feil(  2tmu  oo0aeen f3iys s2elumpn(4trtrxfcto1laD luvsl(0 rumio3iudlmenlnetl(f ruaxmpou0oeeomfetydls ran snt4arxoif3oa1lpt anes s) etm(r iy1lltnlivsl(  rur(ronu4apx  octaslmDum(mo;t4arenio oydfp e ies t) etoxrpnodam n neiatf 2taxmo;o4ole  fciysfs2uln o;(4tleoir3totlmteau sls  etrxm iu4lp elictl() Duaum ;u4apxniietytfm2rluvonu4altrxf3iatfmD aies ()srtmio oy4oltelfcsltfarrrx pnt4apt ioeildfs2umuvpn(0 exnxoctodfmt luvslt)trtr(opoydolee ietlsf Durxmp;t0tpenii3iasls2uluvs;t4 ltrmr3iadfaDelieolt)t2xoimpoo1lpenmnes sfsDua(r ;u1tpxo iciltfmDrmump;t4texnmr tytoaD aivo t trxoxr3oy4lle  nvtasf 2uaumpno1aex  o3iltfa eaumo (0tetomrctotlaDeli ol( s2xoxo3oo1al n nvs sfa2rmurpnu1tleoifeilsfm2eanvsnt) rtnmrcta1omtr i i ()srtm(m oydlltelfeiatfsDtrum no0optnioeild m umn o;t0 exnmo tydop r uei s0s2uoim3iy1apenlneil(f Dtauroou4tet  f3tydla2ra(vsnt0alxrmo3to1fpDeli o;(  etriopou4op   fcs (  2ta(mooo4apxn ictyd m ra(vo;(0 lxnxfcoa1fm eanvo;t trtrxopiudapeemfesls)sDta(ro;u4aexn oetldfaDrmnmsn(4aexnio3iydoaDraies s0 rur(r3ou4altnmfesatf 2tau pno0oexn fctyd a em(vo;() rtnmo3tydoa  lnvolt  exrxr oo1alen fetl( srur(  no4optn fciatlsDulnmp;u0trxoxo iytomteaieols)teuo(o oy1altnmies t) 2uaxm no4oee micilsfaDul(mp;(0trerif io1opt  i o s) 2tm(opiudoltn ivtat)sDtau pno0opt mi3iysfsDrmu pnt)aeerir iotla  lneil()t2xoio nu4ome  nvt sfa2raxmo;u4aptomieiat sDuln p;(0 eerio iotlatrln il() 2toim3nydlmtemicslt s2tax onu1teen icils a2uluvpnu)arenxf3oatoaDe uvsls0 2tr(opno4lmte ivsl() 2umuro;u1olxn iciadfsDeau s (0aetrmo3tytlaD  nvols0trxrxm nydam n feils) Duaxmp;u1opx  o3tlt m rauvo;(4 renir tytopDrlies;(0srxoxr iu1ole mivs s) rta(m ;u0opt  ieiytlm2ra(mp;u)aetrxocoo1fmDrliei;s) 2xrxrpny4om  mnvslsfsrum(r ou4aet mietadfaDumnvp t0tlxrxociotlpteln i;s setmxrpou1omeelicils  rtmurono0olxo fctytfm rlump ()texoxo ta1lateaues s0teum(r nudop n fes ()sDrm(m oo4alxnmo3iltlsDrln o;(4 ltnirciydlaD lnvi (0 2tmir3oy1amenmnvsl(  Durxrpoo1apenmieias mDemnvs (4 lxoxo oo1lpD livi ( t2trim oudlmtnmfvi s)s2rr(ronu1aleoifciyslm2rmnvp;u)alxrxocoatop  lies;t)trto(rpny4oleemfesat) Dtmxmpnt1oexoioetysfa2rlums u0trxoxfcio1omDrlneol() 2xm(o3oy4ame  fvtltfartr(ro;u4alt iieiyslmDrln s t)tlerxr to1fa raues;s) rxmir nydol  lietls)a2uru  ou1ale  ieils m2el( p t0tetnxr3oodlat lnvi t texr(o nydlm e fcsl(faDra( o;t4oexoifctyd aDua(ms;u4 rtrir3iodlm eai i;t0srxo(o3oodap n nvi s)srtax  ;o0oee io3tyslmDem(mo;t0tltrxo3oo1lmDrlivs;t0 euoio3iodlpe  icta( srum( o;t1aptnmoctldla rau p;u) lxnxr3totlmD aivi s srxmxmpio1lmen ictls srururono0tptoioeiadfaDrl( pn(0aexoif tydfmD  nei t trumirpnu4lme  icilt srtm(mp;o1oeeoioeiysfm ua( pnu4 exnmo3iadopt  n o;t0srumio3oo1lmeemfviltf 2rm(  ;t1altoii3taslm ulnvp;()alerifcto1fmtrluvsl()seto(r3oy1lmeemivtas arurx pnu1aeeoiieiat a el(ms;t0 rtrmrcoodlmDeai o;t)t2uo(mpou1olenmnvsltfs2urumo;t4oltnmfeiatlmDrl( s u)aexrircoytoat  uei s)texr(o iudlme  nvs () 2ur(  ;t4teto o3tlsfm eluvo;(4 eeomr3tytfpDrln slt)texoxmpno1altnmnvsl(f rtmu poo4tleoifcils m2eanvp (0aetoif3iytlm eli ils0s2xm(mpoudomtnlieslt  rtru pno0aexnioctldla2eaumonu)trermocia1om  luvilt0t2xr(r3io1lpeemfvil()srumumoou0apxn oeiad s2rmumo u4aleoioctotoa ean i;s) 2xoim3iodopenmfvsat) 2tm(  nu1tpxomoeiydfaDuau p;u4alxnmocoy1lat  uvil(0 2tr(o iy1opeelivs sfarta(rp;t0optoiietysfm eaump u0aleoir3todfa   uvs;() etoim oo1ll nlncs t  2trur ;t4oetniiciadfs2rlumpnu4tlxrmo iatfaDranvi;( s2trim3ny1lpen nvs t a2rmxrp;u4tlxoioeiysfmDuln p;(4aetrxf3oytfm eanvo;s0s2xoim3oodoltnmncsls) ruax onu4tpenioctaslmDeanmp;()aexnxo iadlmDraies;( t2trxr3oodome mici tf 2tm(mono4apeo ieiys m2elnvpnu) ltomf oydlm eaivs ( trxr(rpou4lm emnvi tf Drmx  ;t4olxniieias a2em( pn(0arenxo tytlmDrlu slt0t2uoirpnu4al   fvsas)a2ua( o;o4apenii3iat mDumn s t0texnmf ta1lmtr uvs s tetmim3io1omtnmfvtl( s2tau p;t0oexn icilsls el( s;u4 eeoxo oadlateai s;t0srto(m iu1am n fct s  Durump;o4tlx mo3tasfa2umnvsnu)areomociy1lp e uvil( trurxmpnu1ll e ieslt)a2ur(r ;t0teto ieiys a ua(vsnu0areomf3ootlatraneo;(0srxr(m iu1apt mnvi ( aDua(rp;t0ope  ietyslm ulnms;u) eeoif3iotfp  ln sls sruoxm ny4amtn icta(farua(r ;o4oex mictytlm2ulu onu4aetnmfciotfmtrlieo ( s2xoxrpnydlpte fctlt)sruax o;u1apxo iciat s rmuvsnu)tlxrxr totfmtrauvs;s s2urxo nu1omtnmneil( srtrx p;t1oee  fcildfs ran pn(0aeeriocoa1oateai ilt0trtr(rpoudomtemnvs tfaDtau  ou1tptn ictldfa2ea(ms u0teenmo tytom  aieolt  2trxr oy1lltemfeia( sDtr(rpou4alenioeilsls2ua(ms;u)trenxocoadfpDrai i;t0setm(m3nu4altn fcia() Drrumpnu0teeomfeildla rlu p u0tlxnxr3oydla   ieo;t)teumiopnudlp  mnei s aDtaurp;o1tltn i3tysla2el( o u4alenircoa1fmDr uvslt0s2xr(m3nu4al n nci s) Dumumpou1olenmiciyt sDumn s u4teenircto1oat  uei;()trur(m io4amt lfei (faDrrx  ;t0tpto f3iad s2rlnmo t) rtrmf oa1lpDrlivo s) exo(r oodal   fvi s)srtr(mpnu4altoifcilt m ulumo;(4 rtnif iydlmteli s;()setrxo3oodalee fesl( s2uaxmont0olxomoeiatla emumsnt4 leomf iodom elnvs;t0srtr(o3oudoptnmfvsltfsrumu poo1opt mociadla2rau p (0trtrifcoydfmD lnei t  rum(o3iodolee fvt s) rrrxmoou0tlt mo3iatlmDrmnvo (4 rtrxr3iotfmtr ueilt)srumxr oudol nmfet tfaDtax o;o4tee io3iysfs2um(vp;t0tlxnmrctatlm e i i;s)trxr(o3iydoltn ivs t s2ur( o;u0opeo f3ildla ea( p u4alxrmoctytlp  aueo;(0 2toir io4aptnlivsl()srtaurp;u0ape mf3tldfs2rl( ont4 lermo ty1omt aiei s) rtriopoudopt lfcsatfsDtrxmpnt1open feiadfm2eaumo (0aeermfciadomtrlivo;(  rxmim oy1omenmivi sf 2umx o;u0alenif3ild s emu pnt4altnif3tytlmDraies;()srtoxmpnudom  lfcsl(f 2uaumpoo4tlx  feias s2ran o u0alxoiocty1opD li s s t2trio ou4al nmiesls a2rr(  nu0tlt  iciyt a2uln s;(4aexoir3tadfate nvsl( setoio ou4al elieilsf Drmumo;t4oex io3ilt mDulumont0aeeomf iytlp eau ols0s2xrim iodam elnetat aDrm(mo;o4tlenmfeilsls2emn on()trenmo iatfmtr n il(  euoxm ny4lm emfvt tf rrm( ooo0aee  f3tlslmDelums u) rxnmo ty1optrlueo;s)sexoim oy1optnlfvtlt  2umu o;t0apeoii3ilt a2ul(mp;u) rxrmfctotlpD  ivs;(0srtoir ny1al  miciasf Dumu  ou0opxnmoetys s2ul(mpnu4trtrmo ootopte i o;()texrim no1amenlictl(farururpot0tpeoiociyt m ulnms;t) etomo ty1fa rlu o s) exm(mpou1om  licta( srtrxr ot1oleoioeiad s2ua( on() rxomf oy1lpD lieil() 2umim nudop nmivsatfsrua(mpnt0aex  f3iydla rm( o;u) ltnxf3oydfateai slt) rxm(mpiy1amtnmnvtlt  2uaxmo;t1alx mo3iatla2ulu p t) eerif3to1fa   ies s t2toir iu1lm n fvilt)sDur(mpno4oetoiicilt m2ra( p;u)aeerirctodlate uvils)t2uo(opnu1llen nvtlsfartmx ont0ole  ieiasls emuvo;t)arxnmf tadfp ran o t srxr(m oydol n fvs t) rrr(mo;t1oetnmfeiad m emn p t)tltoircoatop   uvolt  2xm(rpiy1llte iet t arrrxmo;t1teenifeiat s2um( o;t)teeriocoodlmtr n o t0t2uoxm3ou4omtnlfvil() Dtr(m ot4apxo o3iasfm rm(mp;t) rxomf3oa1lmtrluvs;s0 2xmxr3oy1lp e icia(faDtr(ro;t1tlxnio3iadlm2el(mp (4altoxr iatfp raneolt s2trxr3ou1ameelfei tf Dtrur ;t1aexomo3iltls2ua(vp u0aeenmrcootoaDrlu o;s0s2umxopoydaptnlies (f rtaum ;o0tlx ii3iyslaDran sn(0tltoxr3oa1op r i s (0 exo(rpiy4lmenmicsltfarur( oou0tetnio3iytfa elu s u4tltrxr3ootoaDean s;t  etoxmpiodlmeemiet s  2uaxmpoo4aetoiicias sDua( s;u4tlenifciydlaD an i;t0 euoio3oo4opee nvslt sDraxm ot1tpx  iciad s2rmnmo;t)aexrxf ia1laDe uvols0sexrir ou4am e nvt t) rrrur ;o0apxnmietysfa ran pnt)texnmo3iytom rli s;()t2umxo ou4lp nlivsat s2trurpoo4apxo i3iadlsDulums;t4 rxoircoydlpD  i ols)sexoxr3nu1opeelnvsl(fsDrrxr nu1aptnii3iasfs uluvs;u4 eenif3totfate n s (0t2trim oo4ol   fcslt)arurum ;t0oexnmictytfm umnmo;u4altniociy1lm   u slt  rtrimpno1lptnmnes ( a2ua(rooo1oeto i3tat m2ranvp;t)trxnmfcty1opDran ols  2toiopoodlle mfeta()aDum(ro;t1apen f3tldla rmn pn(4alxnmr3tatfm  lieilt  2xoir3io1alte nci t srraum ot1olt  f3tldfm2ul(msnu4tetomo3todomtrln sl( s2uo(o iudamte ics (  2uaurpou1aex  oeilsfsDrm(vont)aleomfctadla eaiei;t)t2toim iudame  fesatfa2ta(r ot0tlt  f3ias sDra(vs u0tlxoirctadfa   ieils  etmxrpiu4omtnlneiatfarur(mpot1ope ioeildla rmu s;u0 rerirciytom  ln i;t srtmio oydll nlfcta()sDta(m oo4aeeomo3tldfs2umnvs u4 ltnmf3oytla elu i s teuo(o oy1am n ieias  2taumoou0apxoifciydls2rau ont) eermo iatla  lueil(0tetmxo iu1ol n nci (fa2um( o;o0oetn f3iydfm eanvs;u0 rxomrcoydoatrln ils tetrirpno4lm elfct tfsrumumooo0alxnmfeiatfmDeau pnt0 rerxfctodfaD aies;( s2um(m iy4alee fci tfsDuaxr nt1tlx ioetytfm eau p t4texnirciatfaDranei ( srurio3nydop emfeil() rraxrpnt4apeoiieiaslmDran s (0arxrirciytfaDeaiei;s)tetoxopno4olt mics (  Duaxm oo4apeoif3ildfs ua(mon(0trtoifciydfpteluvs;(0srtm(m3ou4am n neta()arumxmoou1aptomfciydlaDumumo;() lerir3tatlat  ueo t)trurimpny1ole lfvsl(fa2urumono0tlenifeiadfs rau o;()alxoxf3to1fat an sl(  rxmimpou1optnmfci t  2ua(  ou1alt iocilsfm umnvs;(0trtoxr3iy1lpDelivsls)trum(opno4ap   ivt (farta(m ou4aet  ieiasla rmu p (4arerio3iotlmDe iesls  rtmim3nu4aptnmieta(farrax ooo4tle mi3iatfa ean on() renmr3to1fp   n sl(  2uo(o3nu1ol emfci tfa2tmxmont0opx if3ilsfm2emu s (0tetomfcta1la e neo t srxrxrpiu4al emicilsfsDur(rp;u4teeomicilsfaDel( o ()texrxf3iotfm rlnvsls) etmio ou1lleelfcs s srrmumono0tpe ifetysla uauvpn()alenxocoatoa   neo;s0trum(o oy1amtnlfctls srraxr ou1tpx ifeiysls2emuvs;t4aeerio ta1optr ieolt s2xm(mpiu4apt mictlsfartauroou0altoifeiltlmDumuvp;(4 rermf oydlate ieols) 2xoim nudomeelnei ( s2ur(ronu4tlenmo3iydls2eln o t4 lenmo3iatfatr ieo s) 2uoxr nu1am   ncils)artmxm ;u1alen ictyslsDemnvp u)altrmr iotla  lues t setrxr nu1ape mneslsfs2rr(ronu0olto feiadfaDelnvo (4trtoif3tydfpt livi;t0 rxrir3nudlpe  fviatfaDtm(m no0olenioetld a elumsnt)aeeoxo iytfmDr n o s  ruo(r3iu4ap n nci t s2tm(root0oleoifeilsfaDeluvp;() reoifcta1fpDe ivo t0 2xoxo iydalen fvt ()sDra(  oo0tlt io3iaslm uau pn(4 rerif3iodfpt  uei s)seto(mpoo1om  lieiat) 2urxrono0aetn fetadfm umn s t4texrio oytlp eau ols)texmxrpiu1omenlnvt s  ruru oot4aexomociasls ra( p;u4teenmr3ta1op eaiei ( srurxm3oo1ame lict s)arumx  ;u4alxoiicias m2eau s;u0alerifcoo1lp rli s;t) rumxo3iydaptnmfes t)s2rau p;u4apeomoctaslmDelnvs t4aexoifcta1lpt auvil(0s2xo(rpio4lm   nvs s)srrrxrpno0tlenmieias m ra(ms;u0 ltnirctatlateln o t0 ruoxo oudolenmici s)sDtmu p;u1ale ifctys s2ran snu0areoxr3ta1omtranvs;() rurxopoodol  micsat) Durum ;u4ale ifetysfs elnvpnt4alenmf oo1om rlues s  exrio iy1amtnlieta( srumxm ;t0tetnmfciltfa2uau p u0aetoxo3todopD aieo;s  rxrxm oudape  ictls aDrmxmp;u4oltn icilt m em(mpnt)alxoxfctotoa rln i t)t2uoxmpnydaleelneslt)srrmx oou1alxnmi3tytla2elnmpnu)altnif ootom e ivo ()t2uoxm ny4aleelnvi s)srtmump;u4teeoiictasfs2ra( o;u4altoircoytop raivolt)s2xmirpio4amtn neia()artrxrpoo4open fetadfaDemnvsnu0artrxr3io1oaDrauvols) euoim3ou1altnmfes t)sDumumpou4tlen f3iasls uauvs u0aetoxociodfp  aivi;( srxo(opiudolt lncsls aDrru poo4tlxoioetysla2rmuvp;u4 etnxf3iotlmtelu ils0tetr(o no1om nlivsl() Dumx oou1opxo i3iasla rmnvo;t)trxrxo3oadla rlnes;(0s2um(o oo1ale mfvi (fs2um(ro;o1aetniiciad a2emuvon(4tleomo oo1omDr i ols0t2xo(o no1olenmici tfa2rmuro;o4ape mociad mDrm( p;(0 lxnio3iodlmD aies;( texo(o ou4om elfvs (  Dua(r ot0tptoifcilsls ul(mpnt4 reomo3iadoatelnvo;(0 eto(rpnudame  ncsat  Drmxr ou0alxo feiyslm ea(vsn(4tlenifcoydfa  liesls  2xmimpio1ll n fvt ( aDtm(m ;o0tleoifctad m ul(ms;u0 leriocty1lateluvo;(0 2xoir3nodamee ivtls) 2um(r ot0altomfeiad mDel(vo (0tetoif3oy1lpDr u s s)sexr(r oodolen netlsfartmxr ot4aet ioctad s2el(vsnu4tlxomfctotlpDrln s;s t2uoxr3no4aptnlncsas)aDtm(rooo1oex iiciyd aDeln o;(4 etrif3iatlat lu s s0sexrxrpou1ope  neias)artmxmo;u0opxnmieiasfa2eauvo t) lxoifciy1oa   nei t0texriopoo4lmeelieias)srrr(m no4tetoifcilslaDel(mo;u4 rxnif iotomD  n s;() exmxm3ny1lpee fesa(fsrrr(m no1tle  feiasla elnvo;(4tleoxo3tatfaDrai sl( srtr(r3ny1llt  icsls) Duaxm ou0tleo f3iad aDemnvsnt0teeoifctotom  lnvs;s)s2uoxr oo1op elnesl( s2ua(r nu1tltniietlt s2ulu o;u0 ltrio3oydfmDr nvo;t)sruoxm nu1amtnlivsa()aDtaxr no0ape  ocilt s2ulumsnt4 rtoxociytlpt ai s t)s2xo(m ou4opt lfvsas) Drru o;u0oeeo fciydlaDra( s t) lxoxrcoodomtelieo () euo(o iodalenmiei () 2rm(m ;t1altnmfctad sDrl(ms (0 rxomociodopteln i;( sexm(opoo1om e nctlt srta(m ;u0aee moetldfa uluvo;u0 ltoirciatop eauvs;(0 exmxmpio4ol  lnct ()aDtrx  no1ole iictyd aDrln s;u0altrxo3tatfmt auvi t)srtm(r nydaltnmneiat) 2rmxrpoo1tpxnmoetys s2rm( snu4 ltrifciydop raiesls sruoxrpoo4lmen netlsf Drmx pot1alenmfeiyt mDulnmsn(0alxrxf3iadomt aivi ()trur(r3oydom  lictl(f 2uaxro;o0tpenmietad aDra(ms;u0tetoif3todfa  anvi;s  rtm(o3oo4amtnlivt s sDra( p;t4aetnmf3iyd s2um(vs u) renxociodlpDelieols srurxmpiu1llenmicslsfsDuaxroot4tlxnii3iyt m emu o t)texrir iodfmt  iesls) eto(m no4omen netlt)sDuaxm ;o0tlx mo3tytfsDelnvo;(0 ltoxr io1oa  lnei;t truo(m iy1omen ici t)sDtaxrpnt1oexn f3ilsfaDem( o u4tlxnxf tydfpDeauvs;( seurxr3oy1omtemfcils)s2rmur nu1opeomieild m2um( o u0 eeoir3iodlpte ies;s) ruoxo nu4optnlietlsf Dtrxm nt1tleo o3iysls umn pnu)tleoir3iotfpDrli o;t) 2to(m3oy4llt livtl( srrr(  ;u4apeoiiciysfaDeauvs;() etnxr3oa1op r nvo t0srxrir3io1olen feslsfaDrmxroou1tlenifcildlm umn snt4tetrmr tadfptrai i;(0tetmir oy4omt mncsa(faDrmxmonu0aeeo ieiaslmDul(vp u4artrmfciatlaD lu o ( srtm(r nydole livia(  Dtru  nt4ope  oeiydlsDum(vp;t)aexrmo tadoptrauei t)sruoim ou4altnlnviatf rta(rpot1apxoioeiytfs ran s;t0arermo3iatfaD lu o;(0setr(m oy4om   nci t) 2rm(mono0tee  octyslsDemnvpnu4aeermo ty1lpD livs s  rxo(o iy1ope  ics s) 2um(mpnt4olt if3iytlsDuluvo t) etoxf oo1oatranei;s  exrxo oo1lmt liesl()sDum(mpoo4opx mietydlaDumnmsnt4 rxnxr3iydlp r ieil() eurio nu1omt lfcsl() rrmuronu0tltomoeiyt s uln o;(0trtoircoadfp rluvo s s2tm(o3no1ap  lnvt (fs2trumoot4opxo icild m2ea(mo;t)tetnxo iy1op e nvslt) euo(m3iy4opeelfctl() 2tmu pnu0texnmocils a ulu pnt4 exoxr oodop eanvils t2uo(o3oo4lpenlfviasf rrr(r no0aetomiciltfm2em(mo;(0trxnmo iodlatrai o;s s2xoxo3iy4amtelnvils  rua(roou1oetoifeiatfaDum(msn() eenmo todlaDean ilt srur(o oo4lmt mnvs s aDrrumo;u0olen feiadfm rluvon() eenmf iydfaDrln o t)t2tr(o ou4omtemietas aDtr(rpnu0tee  o3ias s rauvp;u0 renif3iatfm r uvsl(0t2xmxm oo4ape lies t  2tmurpou4oee ifciatlmDum( ont0arenmr3ia1lat  iei (0 rxrxr oodomtelfetat s2uaxm nu0ope i
\ No newline at end of file
@@ -0,0 +1 @@
+u ils0tetrir3ou4lm e nvt ()a2tau ono1aet  ieiatfa2rl(vpnu0 lenxf oatfa ranei t s2tm(m ou4al emfvt (  rtmump;o1aleomociysfa rl(mp;(4aexrio3ootlm   n ils  rurxm3no1apt miesl() 2rrxmpnu4tlenifeiltfm rmnmp (0 leoxrctytlptr ivo;s)s2xr(m iydop n fcsas s2tax  ou4opx  ieiytfm um( p (4 ltoio3tydomDr nvols) 2xoxm ou4op   fvt sfa2uru  ;u4olxnio3tytfs2umuvs;u4aeermf3oadfaD  ieo (0srtmxmpoudomtn icia()s2raxronu1aptnmicilslm em(mo;t4texnmrcoo1opDelneilt  exmxmpoo1ap nliet tfaDumum ou4texo f3tydla2umnvo;t)trxoioctytlateaueo;s)teuo(m ou1lmenmfesatf 2ra( poo4teeomfcild m ul(mp;u)alenxfciadfpDr neo;s sexm(m iudam emncil(f Drr(m nt1oetomi3ild m2ul( o;(4texnxr3iytlmDrauvi ( tetoxm oo1am e fvs ( aDra(  ;u4tlt  fcildla eauvs;t) rtnxr3tydfptrau sls0setoxr oo1llte ivi () 2uaxm ou4tpenioeiydlmDuaumo;(0alxomf3iatlpDeau i t trtoxrpiudomeemivs tf Durxmonu4oexomieiytlaDel( s (0trtrir io1opDelnvo;s srur(m nodaltn fviasf Durxrp;t0oexomocild s ua(vp t4 leoxo iatfp   nvs (0teto(opiy4ole mfcia(f Dumum ;u0apen ieils sDeauvsnt4alxrxfcoytlpD an i (  rurir3oy1llt livt t s2uaumpot4olt mi3iydlmDrmn pnu) rtrifcoydoptelnvils t2tm(o3nodlltelfvs t)a2rmurp;u1teeniociys a ulnms u) rtoxo totlateluvi;t texo(rpiydalte iet s  2trumpou1altn fciad mDuln pn(0arenxr3iadfm  auvs t  exoiopoo1op  mieslsfa2rrurpnu0alxn ictas s ul(msn() lxoxocta1oaDe u i (0texm(opno4lle  fvia(f Dum(m oo4oetn fetadfa uluvp;u0tetoifcia1oa e n o;s trxo(o ny1oltnlfetl() Draurpno1opeomi3iltlaDemn o;t4 lerxoctotlaD aueo t srxmim3oy4omt lieslt a2trum ;o4tetoiicilt s elumo u0 rxrio iatomteau s;( t2xmxmpoo1om n fcia(f rtrum no1texniieiatlmDrm( sn(4 lenxr3totfmtr ueols tetoio iu4lpenmnvtasf Dtm( p;o0alx miciasfm2uauvp;t0tetrmf iotfptr u ilt0 exoimpoy4ale  fvtasfs2rmu ono4aleoifeiatls el(vs;u) rxoxociydfp rluvo;()texm(o3iydope  fct ( arrru oot1tpx  f3iyslaDumumsnt0tetrir3iatoa r i i;t0srtm(opiu4lltemneiat) 2rmxr nu1tlt moetyslm2eln o;t0trerirctydla   ueo t0t2uoiopoudoptnmnciasfs2trx p;u0tpen fctld s ulumonu0trxomf3iotlm eli s;()trtmxrpiu4omtn feiat) 2umumont0aptn fctydls rau pnu4 exomrcoa1fpt an i;(0trurxo iu1lpeemnes (f Dumxmoot4oee miciydfsDrlu sn()artoxrctatfatean s;(0t2uoirpnudlp  mieia(  2raxm ou4apt iictaslm ea( o () ltnxf3to1fa raieo;()s2uoxo3iy1altemnetlt)srrrxmonu4teeomoetyd a emuvp;u0 etoifcoytomtranvo;t truo(r3oo1omee feias  Dta(ro;o4tpx mfciys s2ranmpnu0trermf totlpDr nvol(0sruoirpnydam  lfet sf Duau  ;t0oetn ieiytla2el(vs () rxnmrcio1laDrlu o t  rum(o nodomen nctl() 2ua(ro;t0tpeomicildla2ra(ms u4 rtrirctatfmDe uvo s0 rtmxm3oudomtn ietat sDrm( onu1olxoifeilslmDeln pnu4trxoirctatfaDrliei;() 2xrxr oodolt mietasf 2rrxronu1tee ii3tatfs rm(mo;u)aexrxocoy1fmt lies;s  rurxopoodlltn fei s  rraxro;o4opto ietadfs2elumo (0aleoio tydopt lueo;s0seur(mpiu1lpeelnct tfsrumu o;u4oetnmoeiltls2uluvs ()aexnir3tatlpDrlu s t srtrirpiy4ll  lici sfsDraxmoou4tleo fcilslaDumnmo t) etoir io1fmDrau ols)setr(m ny4ap nmies (  Dta(rp;o1opeo i3iltfs2ul(vp u)aeenifciadomD luvs;(0teurio io4ame lncta(f Duaumooo0aexn fciytfs ulumonu0altrmf3oo1omDr u s;()srxrio3io1lmtemnvs tfaDrr(m ;o1optomieiydla2emnvsnu4texnirciodopt  ivol( s2to(r3nudalt mictl()sDur(rpot4tet moeiatla2um( o;(0 lenifciydlpD luvo t trto(rpnodapt  neilsfs2rrxm ;u1tlen ietysfaDem( s t4trtomf iytlm ranvo s0 2tmio3oy4omtelfesls)aDurxmo;o1texo f3ias aDum(von(0artrxf tadlaD ln s t  eum(mpno1om nlnct (f Duax pno4tpeomicias a2umn s;(4 exomf3iy1oa rlies t0 rumirpiy1al nlnet (  2ururoot4oexnifetysla2umnmp (0tlxnifcto1opt  ueslt) 2xoxrpno1olen ivs t)aDururo;t0optomiciydfmDuanvp;u4 etomf3tytlmDeluvo ()srumim iu4ole  ivt () rtmxmooo0ale  oeiytfm2umu p () rtrmrcio1opt  ieil() 2xmir3nydal  mies t) 2ta(ronu1alenmfetls s eau s (0tlxnioctatopD ai olt)tetmirpnudapte ncsat)s2rmx p;o4tltomi3tytlm rmn p t4tltnmf3ia1fa   ieo;(  2tmio3oo1lpe lfeilsfsruru  nu0texo fcias mDuluvo t4alenio3iatfm   n o;t)setmxrpoy1ole mnviat a2tmuronu1apeniietys mDrlu snu) rxnifcio1fmtr uvols t2xoxm iu4apeemiciasfa2urx  ot0opxoio3tytfmDumuvpn()trtrxo3to1fa eai sl(0seur(m3oodlmt mivtasf Dtm(r ot4tex  fciyt s2emums t0 eeoxfctodomtrlnei;s  euo(opio4opt mictat arumx p;o4tlxoiieiytla ulu pnt4 exoxf iytlmD lnei;t  2urim3nu1amenmiciat  Draumonu1tlx miciytls raumon()tlxrmr ootlaDr uvo s t2ur(r ny1am emivsasfs2umu pou1oeen f3tltfaDrlnmpn() rxrxf oytlate u olt seto(m3no1llenlnvslt a2umx ooo4oltnmfcilt mDrl( p t4 ltnxrctotoptr uei t) 2xmio oy1al n ivslt arum(rp;o1olxo f3ild mDelump ()trtoxociadfaDr nes;() rtmxopnodlp e nvia(  Dua( pot4apeoio3iydfa rlums u)texrmr3ia1oa r nvo (  2umiopoo1ome lnct s s2uau  ;u0tetn fcildfmDrmnvs () etnxo iadlpD  nvi ()s2toimpiy4ol nlicsasfaDra(m ot4oltnmietasfs uau pn(4 lenmfcta1om rlu i;t  2trimpio1alenmici (fsDtrx pnu0texn oeiltlsDrm( onu) eeoif3iodfat anvi;() eumxr oy1lltnmfcsls  rumu o;t0ope mfciad sDea(ms;u)alenifciotoaD luvo;t) rxo(mpiu1lpeemfctls)arta(m oo0texo f3iadfa2umuvpnu4 rerxf totfptrli o;s t2tmirpiudlmen ivia(fs2rm(m ;t0tle  oeiyslsDea(vs;t)altrif iotfatrln s;(0teur(opnu1lm emfvtltf rrmu p;u1tlxoii3ils m um(mpn(0trxrif3ty1fa  lu o;(0s2trirpnu4lmenlfes s)arrm(r ou4aeenmieiydls2ranvpnu)tlxrxo3oodlm ran ols) rxmxr3oo4oltemici sfs2umx p;o0alt if3ildla rmu onu4 exoxrctodoat li s s0trxo(rpio4al  mictasfs2umu pou1oltn f3tltla2ea( p;u) rtoir3ty1lateau i t)trtr(o iydameelnes s)srrrx oot4tptoifciytfaDumu s;t)tetoxf3iotopD lueo;s0s2xoxrpnu4al n ictas)srrmxm ou0apxoiocild s2raumsnu0 rtoif oytlmD  ieslt)trxmir io1lmt  iei s a2tm( pnu0tlen ietadfm2rmnmo t4trenif ootfmDrauesl(0srxoim3iu1omenmfeia(fsDrrxrp;u0apt mi3tltlmDua( p (0alenmr iodla  lies;t)s2tm(rpoodap nlict s) 2rrxmp;t4oetoiieiadlsDraumpnt4 rxnio oodfm  aueol(  exrxm iy4ome mnvsa(farrmxrpot0oltomoeiytls2umumsnt4arxoioctytom   u s (0 exmxo3iudlltnlnvtasfaDtrur ou0aexomoeildls el( on(0tlxnxf3ia1lmteaueo;t)truoir oy1ame livias sDrmx oou4aexomoeild aDumnvp () eeoxociodfm  au s ( sexmxr oy1lp   ivs s)aDumxmont4openmi3ildfmDea(vpn(4tetrmo3iodoa   u sl( t2xrxm oy4al e ivtlt sruaxrpno4aeeomfeiys m2elumsnu4aleriocty1faDelnvols) rtrxm ou1am nlnesatf Dumxr ;o0oex iiciadfs2eanvonu4 etoircoydopDrlu o;s0teuoio no4olenlfeilt s2uau oou0ape  o3ildfm rmu ont)areomfcoydfatraies t  rtrxo3iy4am  lictatf rrm(m ot1tltnmociad s emuvp;(0aleomocoatlm eli s t) eumiopiu1am   ietlt) rrax  ou4aexn ictatlsDel(mpnu)alxoif iatop eauvols0trto(rpoo1amtelfeiat  2uaxmp;t4oexnmoctad m2elumo;u4 ltrmr3iatfm rluvo s0seumxo3oy1apee fes tf 2raur ot0opeomi3tltlaDul( s (0aetoir3oadlpDrlnvslt0setr(o iudlptn fetat  2rru o;o0oee iiciadls el(vpn() etoxf3iytop   u i (0 2to(m3iy4altnmict ()a2rmum nu0apxnifctytfaDra(vont) rxrxr oadfmtr u i s) 2umio io1ll emnvs tfaDuaxm ou0openifeils a ulu pnt0 rerircia1fp ean i;t0 2umirpoo4op n neiasfaDtrxm no0aptn iciasla ea(vs;(0alxoiocoadfpte neslt)s2uoir nudlltemictls sruau  oo4apto ociad s2uanvp;u)alxrxf tydlpt ai s t srtmio3iydamt mnvslt) Dum(mono0opt iictys a2eauvp;t4texomoctotlpDeaneols0teumxmpio4am nmieta()sDtmxrp;o4tpx ioetatla2em(mo;u4 rtriocoodfmDrlneilt0 rxrxrpiu1lmte ivs ()s2rru pno1texnmieilt sDemu sn(4 lxrioctydomte n il(0 2xm(o oy4ap nlfvsltf Durxm nu4openif3ias sDem( s;u0altomoctytlmD au i;() etrir3oy4lmtnmncslsfaDra(ront4olx moetatlsDumumonu) etrmf3iodoptran ol()seum(rpiu1om  mnvsas)srtr(mp;o1oexnmociltfs rln on(4alermrcoydfaDr ivsl( s2tm(m3oo1lm  mfet s)a2rmxmoot1optnii3tadfm2rluvo;t)aeermr iytopDrlnei;(0trtrir ou1lmee nvta() Durxr ;u1alx  o3tls aDumump (0tetnmr ty1oaDe ieslt0trtoxr3ou4omt  fvil()s2umu pnu1ope mfcias a2ran p t)tetoio3oytla   u ils seto(m3ou1llt mfei ( srrrur nt0apxnmieiysla2emumpnt) lxrxo ty1fatraivs;s  rxrxrpnudop  mnetls  rrrxro;o4olxnmo3tasfmDuauvs u)trxoio oa1om r ivo;t0t2xr(o3iudol  mfeslt)a2tm(r nu1oleomf3tlsfmDumnmpn()tlxrifciotfaDrlnes;t texoxm3iudapee nvsls arurxrp;u1oee io3iasls elnvp u4 rerxfciy1la  luvs;s) etmirpoydlp  mnvs ( sDuaum oo0altnifeiydfmDemump;u)alxoirctydlaD anvsl()t2trxm3nodlle lfetlsf 2ta(mpot1open f3tldlsDeluvs t4 rermf iatla  anei ( t2xrxo oy1lltnmfcil(  2tr(mont1aleomocias mDuanvo u)aeenmf oadop  livs ()s2tmir3oy1lmtemncsa(fs2raurooo4ape mf3ilsfmDra(vp (4tetomo iytop raivolt0 exrimpoy4om emncsltfa2uauro;o1teto oetadla ra(mp u0alerircoy1oaDran ols  etm(m3ou4omt mfctatfsrrr(r ou4teen icilsfa umnmp u)aetnif3ta1oaDr ivi;t)truo(opoy1apenmiciat)sDrrxmpnu0aet  ociadfsDeauvs;(4alxnxo3to1oaDe uei s truoio3oy4omt  ivtat) rtrxrpnt1oleo f3iatfmDra(vo u4 rxomocoatomtr ieo;s)trxo(opoy1lptnlnvs s)arrmx p;o0tpt  oeild mDumu snu0trtoircta1fptrlnes s)trumxo3oudamtemncils a2ta(r nt1aexnmieilsfs rmnvs;u)tlenif3iydlpD  n i;()trtmxr3ou4ol nmnvtas)srumurpou4apt ii3iytls2uln o;t0trenifctytfm   n o s) etmxo3iy4olte ivi s)sDua(m nu4ape ii3iatlaDelu s t4trtomf ia1la   uvi ()t2xmxo3io4lm  liesat arum( o;o0aex ioeiyslsDrmuvo;t0altnmo3oa1om ean s;t  etoio oo1alte neias)s2raurpou4optnmf3iydfs rl(vp;t4 reomf iatomt  nvs;()srtm(r3no1oleemiviat  Dtrum nt0olxnifciad s2emump;u) exrxf iodopDeauvi;s s2tmxr nydlpe lfeta( a2tr(moot4tlto o3ildfaDum(vo;u)tltrmocootoaDe i i;(  etoxmpiu1lp  mivt t aDraum nu1alt micias m2rmu pnu)artoxf3iotlaD lu i;s0t2tmxrpno4al emiesl() 2trump;u0tee  iciasls2rm(vpn(0 lenio ia1fmDelu i s) 2tmxo oo4lpen nct t) rrr( poo0oetnif3ilsfs um(mpn(0tetnxr3todfptelivols0texm(m iodomte icias aDtrxr nu4olen oeiasla ulu s;t0 etrmo3iytlm e n slt t2trxo3nu4lp n fctat) Dtr(mont0opeo fcilsfa ul(mo u0tetnxr oy1fp eluvo s teum(m ou4alee neilsfsDtaurpot0tpx mi3tlsla ua(msnu0altrif oy1oaDr ues t0 rtrio3ou1amen icsat sDrrx  no1optniociasfa el( o;u4tlenmr tydoptelneil()sexmxopno1ame mictls)aDurxm ;t4olx  fctyt s elnvp;u0aeerio ootom e nvsls0s2xm(r oy1altnmnctatfartm( oot4aet ioetls s ra( s;u0aeenir3to1oat luvo;t)s2xoxo ou4olt mneslsfarrmum nu4ole  ietytfa2ua(vpn(4 lxnio tytfa eai sls0t2ur(r nudal elnetat) Dumxmono1aexomf3iatfaDrmuvp t)arenxf3ty1faDraivi s0 2xm(r3iy1amenlfei sfa2urur nu4opxo feilt s emnvont)tetrmfcio1opt li olt) 2um(m3oo4opee ncs (  Dtmxro;t1aleo octatls ean p t0texrmociydoateaivi t0sexoio oo1ol  lnvsa(fsrtrumpou0oltniociytfa2umuvon(4altnmfcoa1op   ivi s  2xo(opoydap  mnvs (fs2taxmoot1alxnii3ias a ra(vo;t4teenif todlm e nvs ()t2xrim3nodlm  micia()srurxm ;o4alx if3ildlm elu o t0 ltrifctatlaDean s (0srxm(mpnu1ale mncs t)sDtaumoou0tpxnmfctlslm ulump t0aetrir3tytfmt aivil( setoxo nudll elivil( aDtrurpno1teenmfeiydfsDrl(msnt0aeenifcoytfpteaueolt0teuo(rpnodolenmicsat  rumurpot0opto oetys a2emums ()teeoircio1fmDeai ol( trumxmpiu4am   ncs sf 2tm(r ot4olenmiciasfs rlumont4tetoxo iytfate ueol()trto(mpnu1lm   feta( sDtrxrpou1tlt mf3tlsfm2uluvp u0trxrio3oy1fm e ieols  2umim io4lpe lfei ()srtaxmp;o1tptoioeiat m2rmnvs;t0 etoxoctatlatrln s t  ruoio3oydllt mfciat)s2rr(  oo1aeenmociyt a2rmnmsn()teenio3tytopte ivo;t)seur(mpiy1lmt  fctas srtmu  ;u1optoif3iyt m2ua(mon(0treoiociadlm r uvilt)tetrir3iy4opeelnviatfs2tr(mpnt4aet  fciys m2umump;() rtnir oadomtrli s;( truo(o3nydam emics t  Drr(ro;u4aee  oetatfm2umu pnt4 reoxo oo1op  an o;( s2xr(opou4op  mncs tfsrtmxr ;o4tptomfetydfs2eau o;t4arxoxr tydlmtr iei;t0trtr(o3nudlltemnviat)aDrr(mooo4oltnifeiasfm ea(vp;t4arxoio tatomtran o t0 rxoxm3iudll eliesa( a2uau  nu0tptomfeiyt sDemuvp (4 renxocoadfpDe i o;s)t2uoir3oodlme  fcs sfa2ra(rpoo0olen f3ilsfa2uln ont0tlxrmr oodoaDr uvs;() etmio io4olee netas) Dumx  oo0apxo i3iat s emnmp t4tltomrcoa1laDrlnei s0 rum(opou4ap   nctasfartr(  nt4oee  ieiatls2rl(ms u0aetrirciy1oa e ivo t0 eurirpno1lpt livslsf Dtr(mp;o0tpt mi3iltlmDrm( s;t0 rtnmfciadfpteauvo;s s2xmimpiu4al   ics ()srtmu onu0aexnmfeiltfm eaumpnu4arxrif3ty1la eluvs s teumiopiy4omenlietlt  Draur oo4apx if3iasfaDemu o (4tltoirctotlmt auvilt t2tr(m iu4omenmnvs (  rrm(rpnu4tpeniociyt a ranvp;t4tlenxrcta1fpteauvo;(0 exmxr3iydom e nesat)arrau  ot4optnifeias aDrmnvpn()alxrmo oydlp  aieolt0 rxmxm3oy1lpe  fvt tfaDtaxm ;u4opeoiietldfm2umu o t0texoif3ta1oatr i o s srtm(rpoodol   fetatfaDra(rp;o4aetnifetad a2rmnvs (4texomocoo1fpt  i i ()sexm(r iu1optnlivsa(  2trurp;u0aex moeiys s2ean sn() exrircty1fat luvo (0teumim iodom   nct t  rta(rp;t4apenmi3iyd m2rau sn(0 rxoioctadfm  luei;(0 2xo(mpoo4aptnmfctas)artrxrp;o0olxn o3iltfaDua(monu4trtnmr tydlat  uvi;t srurxopiudalt mfvtlt) rum(r ;t0tet ii3iasfm2uln s t0tlxnxrcoy1fatr i i s) 2xrir3oudlpen ivtl()a2um(rono4ope mo3ils a2uauvs u) eeomo iytlmD an olt0srurxm3nudam n icia( aruaurpot4aexoif3tld s2rluvp t) lenmo3oodopt luvi () 2xrxrpnu4omt mivi s)s2ta( p;u1oexnio3iys a rlu s;t4 ltoif totlat  ivi s0trxmirpno4lpe mfvslsfs2tmxront4oleomo3ildfa ea( s u0 etnxr3todomDeanei;( s2tm(o no4alte fviltf 2tmxrooo1oeto oetysfmDelu p;t0artomf3iy1lp e uvolt0s2to(r3iy4llte ivtl()a2tax o;t0oex mictas m2ea(vo u) rermfctadfa elivi t0 rxrxm3oy4amtn icsls)s2ta(moou0texomo3ildfsDrmnvsnt)altoircoa1optran s;s0teumxr3nodal nlfcsl(f 2rrx  oo1aptnifetadlmDumu pnu4alerxo to1op  au o s sexoxm nu1lpe mneia()s2uau pou0tpxn o3ilt aDel(vp;t0 lenmf tytop rlnvo;t texm(rpny4lpt mfeiltfs2rm(  ou4oeeomi3ilsfs2rm( o u) leoxf3iy1fm elivolt)t2xrxmpnu4am elfvi (  rraumooo4opeoif3tad aDel(vo (4arerxrctodfatrlnes t0 2umxopiudame lfctlsfa2tr(r ou4oexomoetltla umn pnu) ltrmf io1fpDe uvo t0seumxmpiodoptnmnci s  2trxrpno0alx  f3tytfsDua(von(4alxoif3oodla r ies s0 2uoxopoydlmte nesa() rtrx poo0alx mfctydla2el( o;t0aeenmf oy1fmt an o t0 2tr(r3ny4ale  ivt (f Drrurp;u0tpxnmfeiat s2elnvonu) rtoxr3oo1oaDe iesls)s2toxrpio4amtnmfvs sfsrrmx pot0tlt  ietat s rlu p u4tltomf3tytopD aues t)t2um(opnodap emfesltfaDrr(r ;t1texn f3ils s em(mp;u0aeeomfcty1fmtr nvilt)tetoxopno1olen iesat aDurxrpno4tlxomoetatfaDuaumpnt)aeerir3ia1oat  nes;t0 eurxopio1omt  fvt s)arrmx o;u1teeoifeiatlm2eaump u) rtrxf iatlatr u i ( sexm(mpio4lme lfeta(  Dtmxr no1ape moctls m2ua(monu)altnxoctatfmtr neol()tetr(opny1oltn ictlt  rtaur ot0aetnifeiyt a2el( s;u0altnxrcoodlat  ies;t) rur(rpno1ale lncsltfsDrrxmooo0tltoif3ilt a2el(ms t4trtnmociotfpDeanvs ( trxo(o3iydopenmfet (  rtax ono4ape ii3tldfm2ean s;u)texoif tydfpt aieo t truoxo3oo1open nes tf 2umurpno1tlxn o3tldfsDrlnvo;u0tetoxf3tadoa e ieol(  rtrir3nudamee ivtas) 2rrumooo0aptomo3iytfa rmuvonu) ltriocoy1lm e u o () exriopiy1lmt livslsfa2ra(mp;u0ape  i3tasls emuvsnt4tlenmr3iy1lmD  iei t0trtmimpou1lmeemneiatfaDumurooo0teenifciadfaDelnvs;(4aeenmo oodla   i ols setoxm iy4lmenmfci t srrm(m nu0aexomictlsfa rlumpnt0 lxoir iytlaDeaneil(0srxoir3nodlpe  netas  Drm(ro;t4oetn o3iyslaDrln snu4texomfcio1lat lnvi;t trtmxopny4opt  icsasfarrm(mpot1tltnmieiad s emu p u0 exnircoatop  anvi s) 2xr(m no1amt lfeilt s2tr(m ou0tleomictltfm umn p ()teermo3oytlpDe neo;(0s2xo(r3iudop nlicslt) 2uru p;t0aeenmoetyt sDrlu p;()aexnmo3iatlmte nesl(0s2urxm ny4lmee nvtl(f ruaxrp;u4tlt  o3tas s2rmumon(4trtrirctotlpDeliesl(0srtm(r3iudlltn nct ()srurx o;o0texoiieiytfaDuan s t4aexrxrciotopt lnei;t) rxm(opnudlmtelics t  2urxrpnt4tpx io3iys aDemump (4aexnmrcio1oa e uvi s0srtrim3iudlp nmfvtls)s2umxrpou0oeenifctlsfs rluvsnu)alerxfcia1la r nvsl()seur(r3oydome  fcia(fsDumu ooo0tpx moetltfa rlnvs;u4 exnio3oatfmtr i s;t0s2trxopoy1lmtemnvsl() 2uau pou4altoiicias aDrm(mo t0 eeoxo tydfpD aneil( s2xoxm iu4am  lici (  ruaur nt0optomf3tatfm rmn o;u4teeomo todfp  aiei (0trxmim3oudlp e nvsasfsDtaum nt4tltn o3ilslaDeanmon(4trtrif iytoat livi;( t2xoxrpoy4lmt mics t) rtaumoou4oeen octltfa uluvs;t0tltoio3ootopt lu i;t) 2to(mpou4om emieiasfsrrm(moou0tpeomieiydlsDumu s;t) etrmf tydomt  nvols)trum(m3iydolenmfctat) rrrump;t1tltnioetlsls2emuvpnu0trxrxr tadfmDe ivs s) 2tr(r no4ale  feiatfs2rr(rpnu0tpx  f3iltla2ra(mp;(0 lxnio3totomtraueols)texoxrpnu1apeemicsl(  2uaxmo;u4ope  i3ilsfa ea(mp;t0trxoxocoydfaD auvs;(0texr(r3oy1lmee ies (  rtrx ono1olxn o3iyt sDrl(vo;u0tltrir tadfpt  nei ()sexoxrpiu1ole mncsls arrrum nu1alxo i3iasfaDrau s (4arxomrcia1lmtelueo () rto(opiu4alt lieta(faDurx pou0oltnmf3tls m2umuvp u4aeenmr3iy1optr n ol( setmirpoodop nmfctls aDraurpno1texnio3iaslm2eauvpnt4altrxf3oydfp eluvsls seurio3iy4lmtn fctatf Dtm(rp;o4oltoii3iadfm uanmo u4teeniocta1fp  aivo t sexo(opoy4omt micsas)sDur(  nu0olt mfciltla2uluvpnt)alxrir iydfatr iesl()srtrirpiu1ome mivtlt)arrrxr ot1tpeomfeiys aDrlnvs ()artrxr oodopte nvi;t teur(rpio4oltn neslsfarrrur no4oleomo3iltls2uluvp;t0 ltomo iatfpte i s;s)s2trxo oodal   fesat)arur(rooo0olxnmo3iat m2elums (4aeeomf ty1omtrluvi t0tetmirpio4amee nvil()sDrru pot1aeenmo3tlt s ea(vp;u4trxrif oa1laDe ieslt)s2xoio nu1apt lneta(f ruax  ou0aeeomfeiad m rln o t0 rtnif3oodfmtr ies;() 2xr(mpnu4ap nlicil()a2urxmono0tlen fcils m ranmp;t4trenio ia1fp   nvil()t2xr(rpoy4am nlfvsat artrxr ;t0tpeoiociatlsDem(vpnu4artrxo3tatfp elueo s) 2toxmpoydlme lictat artrx  ;o1apxo feiyt a uanvp;u0 etrir3oatfm eaiei s0 2toxo io1lm e nvta() 2rrx pot4aet iiciys mDum( p u0tetoxo3to1fp ranvol(0 etr(m oo1llenmnci tfartau  ot1oltniieildfs2el(ms;t4alxoxr3iatfp  lneo;() rxoir3iy1alt lnvs tf 2raxmo;t1oee mfctlslaDrl(vo (4tlxrxf3io1oa   n sl( setmirpiydlmeelfvsl(  2ta(ro;t1aeenmo3iat m rmnvp u0tleoxrctadlpDrau s t0 exoiopiydal nmnvtat)sDta(rono1tlxoifciatfsDea(vs u4 exoir tadfm r uvo (0t2xrxr ny1op e fvilt) 2um(mo;o0olen ictadls em(vs (0 rtnxrctodfat  u o;(0srum(mpoo4omeelnesls  2urump;t1aleomociatlm2rau o;t4 etoxf3oo1fa eluvil(  2xmirpiy4ome  nvi (f Dra(  ou0tpeomociatfm2um(vs u0texomo iydfate ies;s)sruoxr oodlptn nci sfsDta(  ;o0tlxomoeiadfaDra( ont4aexrmfcty1lmD  n ilt) 2xoio oy4lle lfvia(fsDtmx  nu4apxoioctasfa elnmpn(4tlxnxrcoo1oateluei ( srurirpoy4amenlfviat)aDtrxmpnu4oexn o3ils s2uaumo;() exnmf todfpteliei t  rtmxr3iydom   netlt  rtm( pnu4tleomo3iatfaDran p ()teeomfctodoateaieolt t2xmiopnu1lmen ivsltf Draxr ot0apxoiieiasfs2eau pnu)altoxrcoodla   ivo (0srxrxopiodapt mict ()a2uaxmpoo1tex mf3iydfs eln s;u)trenirciotoat auvils trurimpoo4apt
\ No newline at end of file
@@ -0,0 +1 @@
+n s s)trtm(opiy1om emfvt tf Dtaxr nu4altomf3iysla2rm( s;u4tlenmf3oy1lpt aieo t0srtoxm oy4op n net sfs2uax onu1openmietls s2emnvp;()tleoio3iadfpt  nei s truo(rpoo1lmt lnct s)sDtru pou0opt iiciydfmDraums t4aeerif3tydfpteaiei;()srtoxopoo4ol nmicslsfsrtrx pno1tee mf3tyt s em(mp;()artrxfcoadlaDrli il(0s2uoxmpiodaltemfctl(fa2rrxr no0tpxoifctlslm um( pn(4alxnircoytla raieo s)s2trxopoo1op  mici t s2tmxro;u0olenmi3tls m ra( ont4 rerif3todopt luvo s0sexrxopiu1omtnlnvsat srtmurp;o0tpeo ociasfm2uln o (0altoir totlmDelieslt  2xm(o3ou4lpenlnvsa()aDtmxm ot1tpx miciatls2emnvs;u)texomfcoo1omtelneslt0 eurim iy1lpeelneias srta(monu1oetnioeiat a2rau snu) ltomf todfa  au s s) etmxo ny1llte icilt  rurxm nt0olt mf3iasla2el(vs u4artrmo oodomtr i i t0 etoir iydameelici (  rtrxmont0tlt  oeils aDrmuvp;t)aexrxrciotfp   nei ( s2umiopiy4aptn nctl( arrrur ;u1apt mf3tas aDrau p u0 rerxo3oydoptrlivi t0t2uoxr io4ll nlnvsl()srururoou4aetnio3iadfa2ul(vp;(0trermf3ta1opD ln olt0 2xm(mpny4lp   fesatfa2uaxr ot4alxomictydfs rl(vp t0 lxniocootoaDranvi ( trxrxmpio4lp nlietat)srtaurpno1tetn o3ias aDrm(ms;u)tleoxr3tadopDran sls)t2tmim3nu1om n ict (fa2rax  ou1alt mfeiasls2rmump t4areoirciadomD  uvslt0setrim nodlpe licta()artmurp;o1alxoifeildfs rlnvon(4tltnir oadomtranvo s0 2toxr3iodlp nmfvta(  2tm(  no0open fciytfs2eanvs;(0aexnmr oytomtranvi;t0teumim ou1lmt lfvtasfsrumu pou0aexoifctys sDranms;u4trtnxo iodoptr iei t)srur(m3iu4apeelfes s)aDrm(rpot1tlxoiocildla2eluvon(0trtomr oydoa eanvsls0seurirpnydll nmfvi t srtmxm nu1oex mo3tld s um(mo;u4aeeoif oy1lmDrlnvi;t truoxrpiu4lpt lnvs tfsrrrump;t1tpxnmoeiyd s2ea( s u4teeomf3iadlp r u o;s0t2urxr3iydopeelncils arumx  ;t4aex  fcilt m rmn p u)trerxr oatlate u o;s0texm(opiudale  ici t)a2tm(mono1texn oeild m el( p;t0 eenif3iydfa  lueol(  2toirpiu4al elnvsl()s2tmu  no0altomoetadfs2rmu s;(4aeerxf3to1lp  aneo t  2tm(o oy4lleelivtl() rumx p;u0tle ifctlt m2ra(vonu)trxrxf3iydoatelu ils)srxmiopnu4apt mfvsas  rtrur ;u4aeeoio3tyt s2el(mpnu4trtrif oodlm e n s s0 rurxm iy1amen nvils  Dumu o;u1aetomfciyd sDea( onu) lenxrcty1oate neo (0sexmxr3iodal  mfei t arra(m ;t1tlxn icilsls2elnmo u0alxoio oodfmDrau s;t t2tmxm io4ame mncslt  rra(rp;o1aeeo ocildlaDranvs (4artrmr3ta1omteaivils  exr(r iudaptemncsasfarra(rpno1tltomi3iltlsDra(vp;(4 rtnmf todoaDrlnes;()t2xo(m iudoltnlictlt  Dtrurpnu1tpxomietlsfsDrlu snu4 lxrmociotlmDe n o;t0t2toim oudaleelnvias artm(rp;t0teeomicilt a rauvsnt4 etoifciy1fm rlivi;t0srto(o no4omen ictatfs2umum ;u4aee mfetltfa ua( pnu0altrxr iotlmDe ieo t0trtm(rpiudopte nvi s a2tax o;u1aeeomociys mDelnvpnt0texrmf3oytom elu s;t t2uoxmpiy4op  lnvtlt  Dtaur nt4oet ioeilsls em(mp t4 reoifcoy1la rln s;s s2ur(rpou1lleemfcsa(  Drmu pot0aexnmietatfa2elumpn() rtomo ootom r nei;()t2tmir nodlltnlfvi sfsDrmum oo0opxo f3ils sDranmo t4 etrmf3ta1op e ivsls  exoxo3oudalee nvs tfartmx ont1tptnmociasfm2el(vsn(0tetoiocoytlptrlnvsl(  eurxmpiy1altemies t)aruaxrp;t0oetomietyt aDeanmo;u4tetrmf iy1oatrau s;s0s2xo(r3ny1apt  fctas)arrrur ot0apeo oetyt mDrmnvp;t)aexnxr3ootfp elneils0tetrirpny1am elncias) rtrxmont1oetomfciad sDua(mont4alxrir ootfp  an sls teumxopno4lpt  ivilsf rurx oou1oexn oeiysfs2eau p (4trxomfcoydopD  ivi s)texrxopoy4apt mfcta() Drm(  no4opt  ociytfm ua(mo;(4tetnxr3totfp rai ils0truoim3ny4al  mfeilsf Drrump;o0olxo o3ilsls2um( onu)tleoxo3iadlpDelnvs;t teumim ny1lpenmivs t)a2umxrpnt4tptomf3ils a2emnmpn(4aexrxfcio1opte u i (0sruoim oo4apeelfesltfa2uru  ou0tetnmfeiasfs2emump u0 exomo oodlpD  uvi;t)sexmim ny4ole mivtat)s2uaxmont0teto f3tltfm2emu s ()tlxomoctydop   nes ( srtr(r ou4llen nct (fs2ur(m no1tleomoetltfs eln onu)alxoif3tytlmD lu s s srxmirpoo4alt  fvs t) Dtm( pot4alenmo3ildlm2ran onu) renmr3iotoa  lnvs s0 2xoio3ou1amte fcs s)a2rmxm no4tpenio3tad s2ranvsnu4 leomf3oo1fm eai s;( setoxrpio1apen nvs s) rtrxm nu4aexo ieild mDrlums t4alxrxf3oodfp   nei;(0s2uoxr ou1ap elncsa() Drau ono0apxoii3iydls2umnvp;(4aeenirciotlp  lueolt0 rxoxm iu4om  lnvilsf rumur ;u4oltnmieilsfs umu snu) ltrxociytlaD  n ilt)setmio3io1opt mnvils sDur(m oo4tpt  fctldfa2uluvo;u)aleomfctodfpD lneols) etmirpiodam elfetas s2taxr ;o4tpto oeiat mDemumpnu4tlxoxfctydfatelnvsls)s2xmio iy1olenlneia(fsDtaur ou4oexn o3tasfa2em(vsnt0areomf3oytfp  an i t  eur(o oudamt mfvtltfsDtrx pnu1optnifcild a2ua(mp () lenxf3ia1om elnei s0 rxmxopiodlpenlfctat)s2umu oou0tleoioeiatfsDra(mp;u)aeeoxrcoo1fpDrlneil( s2umxm3iy4omtnlnvtl()s2raxrono1ale  ieias a eaumpnu) rtnmfcoy1fp eaneo;t) rum(o3oodlmeemivtlsfa2rmx  ;t4oex mfciys s um(mo t) leoif tadlaDeai i;()truoxmpno4lmtelfvt () 2ua(rp;u4aeen oeiatfm uluvont)areoircta1fmt lies (0 etm(m3nudopen fcsl(  2uaxmpno4aptnio3iytlm ea(von() exnxocoadfp r i il()srumiopoy1lpenlnvsat  2urx pno1olx mo3iltfs2ea(vo t4trxrxf3tydoat an s t0t2tr(mpou4am n fci t  rumurp;o1tpenif3ildlaDraump;()aeeoxfcoytfp r ues (0texm(r iudom elneias srta(rpnt0alx mfeiad s ul(ms;t0 rxnio iy1la r ivi t trurxr iodopenmfvias  rraur ;o1teeo ictltfsDean o;()alermf3tydlpt  nvs t) 2xr(opiudol elnei (f rra(r ;o4tee  feiydla2uln p;t4aexnxo oa1lpDe n i;t srtr(m oo4alt  fcta( arumxm ;t4apxniietyslmDua( o;u) lxoxfcootfaDe nvils0srtoxr ny1lmt lfvi s)artmur ;u1aet mociyt mDra(vp;u) lermo iydom  anei;s teuoim3nudlpen feiatfarua(mo;o0ope iociadla ulnmp;t4aetnif tadlaD an s;t)srtrirpnydomenlnvi t)arurum ;t0oet  ictadfm ul(msnt0texnxr to1fp eai i t srxo(o3oo1omtelfetlsfarur(m ;t0olt  i3tydfa2umnms;u4trtomo iodla e ivo;t t2xrio no4al nmfvia(fsrur(root4oltnmietatlm elumpnu4trtnmfcoadoat  uvi () exr(opiu4amenmfcs s)s2uaurp;u0opxnioctlsfs elnvo u0 ltnifciadfmD  ivo;t) eum(m3ou1ol nmfvs () rrm(m ;u1altnioctldlaDelnms;(0 exnif3oa1fm rauvils setmxopoo1lltemietls)arur(m ;t0oltnmoctaslaDel(ms;(0teerirctotlaDrluvsls) eumxm io1llt  nvtl() 2uaxrpoo0altoifciytlsDemumpn(4tltomfciadfaD  uvi;( s2xmxrpiodaltnlfvsas)aDtmu o;u1tpeo ocildls em( o;t) reniocootfatr ieils)srxoxm iy1lm  liet s) Dtrxmp;u4opt mfetytfm2raump;t0 exrio3iytfa   ieo;t0texoxm iy4openmfcs (faDuaxm oo1opt moeiytfm2ua(ms u0teeomocoatlmtran o s0tetoirpno1ll  mnci t s2umx p;t1alxn fciyslmDrmnvs;u0trtoxfcoodfp r i sls0trur(m ny1lme lfvtl( arraxronu0tlenmfeiadlm2uluvp;(0arenmo3tatfpD au o;s)seto(r no1amtemfeil(farrru  ou1tlxomictlt s uau p t0aeenir3iatlaDrluvs s0setrxmpoy1op e ivil(f 2taur ou0opxnmiciyslaDrl(vp ()tlxrmr todop r uvil( trxrxm3oo1op   ivi () 2urxrpnu1alxnmociyt s2ranvon(0 exomf iy1opDrau ils)texoxr3ny1oltn iei sfaruru ooo1alx if3iys sDul(vp u4alxnxfciytfpD lneo;(0sexrio3iydom elics t a2rrxr nt1tlxomictys s2rlu pnt4 exnxr3ty1oaD lu s;s)srtmim nydamtnlfet (f Dtmuront4opeo f3tlt aDumu onu)trtrxociy1opt lnvo (0s2tmir3oo1omte ietatf 2um(r ot1oexn oeiyt a em( o u4 rxrmf3io1laDranvs;t  euoir ou4ll nlnetltfs2umx  ;u0tpxoifciat sDra(mo;t) exnmrctytlatrln sl( srxo(o iu1lpenmfvils) Dur(moot4aee  octldls uln pnu4altrmo3iydopDe iei;t0 2xrxopoy1am  mnvs s)a2rrumo;t4texn oeilsla2ua(mo u0aexomrctytlmteluvi s)seurxopou4olen fcils) rum( pou0tlen f3iytfmDul( o;(4texnioctytfm ranesls t2urir3ny4ll  mnet s srua( p;t4apeoio3iatfs2em( on()tlxrxr3iotfpDrau il(0 exriopoo4oltnlfci s) Drax  ;o4tptoifctldfa eanvo t0tltoif tydlmtrlivi ( t2urimpiydlp  micslt sDtm( onu1tpeniictysfs rmn snt0trerifctodlaDrai s;s  rumiopnudame lncs t  2uaxr oo4opeomf3iadfm2elumonu0aetnmo3iydfpt li s;(0trxrxmpio4amtemieslsf Dtaxmont4opeo o3ildfs ul(vo () rtoif tydoatranesl() rxoxr3oo4al n fet ( arumum ou0apt mieiysla2rl(mpnu) eeoxocia1lm r nei t) rtrxr iu4lpeemnes ()s2ua(m ou4oleomfciydlm2rau o;u)alermo3oo1fatelueol( t2xrimpiu4llt lnei t)srraumpou0tltomf3ils s2rmnmp;(4aeeoir3ty1fmDrau sls trxmxrpnodam e icsatfs2rau  no1tleoiieiydlsDelnmsnu)teeomo3oadom eanvo ()srumirpoydole  fet t)s2ur(mpno0aexo ociadls2elnvo;u0altoxocoydfp rauvo;t0sexo(m3ny1lme lfct t a2ur(mo;u1tlx iiciysfa rmumpnu0teenxoctatop rlnvo (0 2xm(m3iudlmenlivs s srrrum no1openii3tadfsDelu o t)aeerxf3tytfptraivilt)trxr(o3io4op n nvs tfaDra(r ;u4aleomiciys mDumuvpnu0teenmfcoodlptr uvo s  2to(m3no4llee nctl(fsDrrx pnu4tpxnmf3iad s2ulnvs;u4trtoxr tadlpD  uvsl() 2ur(mpoo4om elnct s)arrm(rp;u0tlt  o3iadlm uau on(4alxoio3ia1faDr u s;( srtrxm3oodlm nmfcia(fsDtm( p;o1oexnii3iytla um( p;u4alxomf oa1fpDrln olt0 ruoiopiodomenmieiasf ruax p;u4oleomieiad sDemnvo;u4aetnxf tydlmtrluvols)trto(opiy4amte nctlt sDur( o;t0tetniictytfa ea(vp;(4alxrif3oo1oat ai olt0trurirpno1llen fcs s sDrrxmpot0oeto fciad mDumumonu)trxoifciotfa eaivo t texrxr oudolt lietl(fa2urx  ;t4tltoiicild a ulu p;()aeerirciatomDrlu il(  etrir oo1am n ncs (  Dtmx o;t0oleomfciysfm2el( p t4arenir3iy1fm rlnei t0texmxm3nu4alte ivtlt srrau p;o0tptnmoeiydlmDelumonu4artnio3tatoa r nei s)setmio3io4lmeelfctas  2rmx oou1oexnmietyt sDeaumpn() eerxr oo1lmDe neolt srumxopno4lme mncia( a2tmu onu1apxnmo3ilsfs rlu sn() rxomf3iodfpD auvil(  2trim ou4opt liesl(  2rrxrpnu1tlto oeiytlm2uluvs (4treoir tadfaD  nei;t teuo(r3no4optnlnci s)a2um( pot4tetnio3iys s ea(msnt0alxnio oa1late ivi;(  rur(o3nu1op  lieiat)a2tr(mono4tpx iiciltlm2rln o ()tlenifctatfat  neilt0setrxmpoodap nmict t srrru ooo0olt mi3tldfm2ua( p u4alermf iatlpD li s;s t2tmio nu1op  mnei (  Dtrxmont1olxnii3tlsfsDumums;u4 etnmf3oatlp rlivs;(  exmxm3iydamt lict t arrmuro;t0tle  o3iydls2elump u4 rxoir to1fm eanvol( trxo(m iu4apenmfesa( artaurpnu1oleomf3tysla rlnmsn() ltoirctadfa rlnvs t)sruoxmpnydlltnmict sfaDtrumoou4apxn oetytfa2rluvp t0 lenmo iadlp e ueo s0t2xmxrpny1om   netl( s2rmx  ou1olxo fctat m2eln p t4tltoxfciatfp raueilt)tetmirpiydoltelncsasf 2rmxm ;o0olx mociaslaDeanvsn(4tlxoio ootfptelu sls t2tmir no4lpe liviat)aDra(r ou0apx  ociydfaDran o;u) ltoio3iy1om  auvs s  exrimpnodal  mieias a2ta( ono4aetnmietyt a2rl( p u4alxoxo3totla  aneo s trxrxopoy1oltnlnvsl(f Drr( poo0oltoif3tysfa2rmnvs t4 ltnxr tadfa   n ils)teuo(opio1apenliet s  2urumont4openiictldls eauvs (4 rtomfcta1opD aivols0 2xrim iudamte ies tfa2uaxm oo1tetnio3iytla eln o t0 lxoircoo1fmDrlnvilt0s2xrimpiodlmenmiesat)aDrmxmont0apx mieiydfs em(vs;u0alerir ootfm elieo (0 exm(mpiu4amee icsl()aDuau o;u0aet  fciyt aDrlnmpnu) etrxo3iadfmD anvi;s seur(rpoudomtnlfvtasfsrtrxmooo0tet if3ilslm rmu s (4areoxr oo1om  anvsl(0 etr(r iu4ol nmfvi s  Drrxr no4tlxoio3ildls2umuvs u0aeerxf todfmtr i s;( texoxo3nudolt mnvs sfsrrauronu0texomociysfm2ua( o;u0trtnmo oadfmt  nvils seto(o oodom emnei () Dtmxrp;u4aptn o3ilt s2rluvp u)arxnxfctatfa   ies;t tetmxrpou1lmt mnvsls) 2tmxroou4oetnmoeiltlmDumu s u)altrir tatop  luvils) exr(r3oy1ol nmfeiat) Duaxmpot0tex ifeildla2ra( onu0aexrir to1lp r uvo t s2toio no4amte fetlt aDrmxrono4ole iieiyt m elnvon(4 eerxr ta1lptrlieslt) 2tm(o3ny4lpe  iviltf 2trurpno0opx mf3ias aDeluvpnt)tltrmocoadoa   uei ()t2tm(mpny1lp nlfetl()aDum(  ;u0olt ioeilt s ran ont4arermf3io1omD anes ()trxr(m io4al emnvt t) 2umxronu1tlxomiciltls uluvpnu0 exomociodfpte ies;(0trto(r3nudom  lfesatfs2rm( p;t4tlxoiietldlm el(mpnu4tlerxf3todopt aneo (0setr(m iudolenlfvs ( arrrxmpoo0aetn ietytla2emn p u) lenio3tadopD auvs t s2xm(r iudol elfcia()aDrax p;o1teeomo3iat a2rlums;t4tlermo iotopDe n s t0srumxm iu4aleemnetl(fsDumu p;o1alt miciasfs2rln pnt0 lxoxr3tadoaDe nes () exo(mpiu4ap n icta( s2urx  nt1teto ociydfa2rmnmont) eeomo iytlpt ai sl()sexo(r3oudam  lncias) 2uaumpoo4olxomieiyt aDrmu pn(4arxrmociy1fm elu o s0 2xmio io1ll nlivtlt)sDurx p;u4aetniociysfmDranmp t) rtomr3oadlptrlivil( t2to(opio4lpeelies s  2trxr nt4tlt mfctytls2rmuvpnt4aexoioctydom r n i;t trxmxmpoy1lltnlnvias artm(m oo1apeomoeiltfmDum(vpnu0arerxo3iytopDean sls)s2xm(o3iodamtemfvilt)s2trx ooo1aexo o3tlslaDulnmo t4 etnmr3oy1lateli s;s)setrim3oo1lpt lfvsl()sDraxrpou1ole miciysfa2ea(ms;t4tlxrir3iodopDrln s;t0s2xrxrpiu4lmenlfvsl(faDra(mo;o0tet  i3iltlsDel( p;u4 etrmo3oytopte ueslt0 eto(mpnodop nlncta( sDra(r ot0apx mictyt a ua(vo t)trxrirciytlat  ivs;s0t2xo(m no4lltnlnvsa()aDrr(ront1teenioeiytfs2emu pnu4 reomr iydlaDeauvolt) 2trxm3no4lpenlnci t)s2umu  ou0opt  f3ilslaDel( p;u0trenmo oodfa rai slt  rto(mpnodap   fvs ( a2urxrp;u4tltoiictytlm eanmo;()texnio3oodfmtr ueils0teur(opnodoltn ict sfsrtmxrooo0tpe iociad a rlnvp u)texrmoctadfpte uvi;t srurxr3oo4oltemicsasf Drr(m ot4opxn feias sDelums;t0 renxf to1omtr ivo t0t2ur(opiodopenmnvsls srrrxrono0olxnmo3iyd m2uau p ()teermr3io1la eauvs (  rurxo3ny1lme  ict sfsrrrurp;u4alt mf3tys sDeluvs (4artoio oo1opDe ivolt0 etoxm3nudom emiesasfs2taumpou1apxnmfeiydlmDuaump;t4 eerxf oa1lpDe ies;s0 2uoimpnu4omtemnvsa( a2ra( poo4tee  iciadlsDul( on(0tlxoxf ia1la rlivs s0s2uoim nu4ale lfciat  rtrxm nt1ope ioeiadfsDulnvsnu4artnmociodop   nvs ()trtrimpnydllee feta(fs2ra(r nu4aptnii3iad mDumu o;t4 etnxr3oydlpDelueol( trxrir iodomenmfet ()aDuaumo;o4aexoiociytls2emu o;t0 lenir3tatopD  nvi s) 2uo(opou4omen nvia()s2tm(ront0alen oetydls rm( p;u0 eeoxr oy1fp elivo t t2trxmpou4olt livsa( sDtrx pno0altnifciysla um( p;(0 rxoxr3tytlpDeaueo;s)s2tm(r oudam e fetas)srtr(moou1tetoifeilslm emu p;(4artrir3oy1oa  li ilt0 eur(m oy1am nmiesat srtmuro;t4tle mo3iyd a eluvpnt4 renio tydlaD lies;t0 rxrir3oy1am e ivtls)arta( o;t4apx ifeiltlm umuvs u4artnxr iotop e iei (0sexo(r iy4ap  mnvsls  Drmum ;t1ope moeils a2ranvp t4artrxociydopteluvs;()s2tmxo3oy1alt mfvt tf rum(m nu4opeo oeildfs ulnvp;u)altnir3to1laDelues;s truoimpio4omee neilt srrm( o;t4tpt iicilt s uauvs t)artrmrciydfateli o s) 2tm(m3oudomtelfci sf Drrurpno4opeo ociytfs2eauvp (4 renmoctytlm r u sls)sexrxrpou1ll   icsls a2umurono4tlxnmf3iat m2ea(vo;u)aeeoio ty1oaDeluesls  2tr(r3no4ape  neiat) 2tr( oot1aex  i3tldlsDeanvs t)aeeoif todlp e ueo ()sexoio3nu4lmtemnvs (f Drm(r no4tetn fetys m2emuvp u) lerio totfmtrau s s0srxoio3nu4al elncsa(faDuaxm ou4tetomictlt aDua(mont0aetnif3oa1op rln sls s2xm(o3iy4olee neil( s2umxrpnt1alt  iciltfm um(mp;t)aetrmr3tydop  an o t)t2trir3iydalen ivsa(fsDtmurono1aee io3iltfs um(vp u) rerio3oatfatr nvi t)s2xr(m oy4op nmieia( aDrr(moou0tle mo3iatlm eanvs u4 reoifctatfpDr u s;t)tetmxm nudapeelfeta( s2ra( oot4apeo i3ias mDraumpnt0teenmo3ta1fmtr i o s0 rtmio3oy4ape lnetltfsrrr( ooo0oetoioeiadfmDrmu snu)alxrmfcoy1oa   uei t0seumxr3oodopt  ivil()aDumxront1optomoeiltfa2rmnvsnt0 leomr oy1fmD  u s t0t2uoim3oodamenlfei sfaruau p;t4oeeoio3iatlsDul( snu)tlenmo iatopD aieo t  rxoxrpny4ap n ics ( sDtau oot4open iciatfs uanvp;(0tlxoxoctotomDr nvi;t0 rtmim3oy4optelfcil(f Dum(mo;u0tle mociysfsDuau pnt4aexrxf3todoate ueslt0 rurir iy1oltemies s)srra(r ;o4apt iiciatlm2ranmon(4 rxomrcoydoaD luvo;s)t2tr(m iy4lptnlivta()aDtr(rpnu4alx  f3iatfsDrau o t0altoxo iotfp  luvil() exmxr3oo1amtemnet t) 2ur(  ;u4texoii3tlt a2rau o (0trxomo3iotlmtrai i;s  rtrim3oy4amtelfeta(fsrrrur no1olxn f3ild aDranvo;t) lxoxo tatfmDr ieo;s0trtrim iydlltemfct sf rtmxmooo4aetnif3taslm2eaumonu) leoxfcto1oa rln ol( texrir3iu1alen ivt tfaDtm(ront4apt iiciydlm rlu o;t)texrio3oy1laD li o t  rxmim io4ol  lnctls) ruaxr ;u1tptnmo3iysfm ulu ont) rxnxrctadlp elieil()srxmim iudome lictls)aDumx p;o0olxo ieiasfs elumo u4artnxociatla  an ol( setrimpiu1lmeemfctlsfs2rau  nu1aeeo feilsfa ua(vpnt4aexoifcoodlaDr uvo s0t2um(r nydlleelfesls srrm(m ou4apx mo3iydlm2rlnmpnt) etrxociy1fmD au ols0 rtr(m iy4op elici s)a2ur(r nt0opt mf3iysfa eluvon(4trtrmoctodlatr u o (0sexo(m io4omen fvsatfsrrau onu0tex  octat a2rau o;t4 eermfcoadfpDeluvs t0 rumio nydame lfeia(f rraxmono4oexomietydla2um( s (4aleriocoo1fmtelivslt  exmir3oo4lmt  ncs t artr(r ;o0olx iieildfsDel(mp;u)trermf3iodla ran olt trtrim iodal elfeiatfsDuau ooo1oeto iciadla eanmo;t4trxnir3ia1oatrlu o;(0sexoirpno4ap   ivilsfarrrxrpnu4oexoiictadlaDuaumont)tetoiocto1fatrlnvi;s)srxmxm oo4al   neilt arurxm ;o0tee ioeiltlmDrmuvs;u0texnio3iy1lm  luvs (0 2tmxr3nu1am  livta(fsrtau oot4tpxnif3iytlm2ulumpnt0tleoxr iadfa rauvol(  rxo(r oydlpenmfvsl(f 2rmxmpnu0olxoio3iyslsDrm(mp (0 exoioctotlat livslt0sexr(r oy1op  lfvia()s2rmx  nt1altomi3ildfmDulumonu4trxrir iodom eau i;t  2uoir3iudolte nei (f Dtrxmoou4opx mociatlsDuau o;u)altomf totla rln i (0trumxo3io4olee fcilsfsrrr( pot1optnmfciltla ulnmo t0teeomo tatfa e uei;s)s2toxr3nu1ale mivtls)a2taxmooo0teenifctasfs2rm( pn(4tetomo3todoat  i s;s0 exrim io1optnmfeia(f 2tau  ot4open fciltfaDumuvo t0aeeoxociy1faDe nei;( setoir3ou1lltn ncs s)srrmur ot0aet  f3tysfaDumuvo t)tltrir oatlateli o;(0setrxm3nu4alen ics s  Drmxrpnt1tpen oeils a2ea(mo;u0trtnxr oydfaDelu s ( sexmio3ny4om nmivia(fs2raurp;u4ope mieiasfs2ean p;u4teermo3io1omD an s;s) rur(opiudoleeliet s artmxrono0tee mfciysls2rmu snu)artomf iodlpteluei;s  rxo(m3nydapenmici t sDuau o;o1opxomietaslaDulnvo;u4tlerir3oa1fmD lnei;(  exrxm3no4omenmivsas)a2ta(rpoo1teeomoeiytlsDelumo u4aeerxf3oy1fm eln ilt0srur(mpnu1ol nmnesat) 2tmxr nu0tpen ieildls rlump (0alxnmr totfaD livsls0t2umio3nu1lpe mfeslt aruaxm ou4aleomoetydfmDumuvs ()tlxnifcta1fmD auvsl( teuoxo ou1lmt lietlt srurx pno4aex moeiad m ul(mpnu) lxnir3iatfpteli o t) rur(opou4olee iesl()artr(rp;u1optn f3tlslm2umnvonu)tetnircta1laDelu il()s2xrim nudlmenlncs tfa2tmxmpot0tee  octls mDul(mo;u0 eerif oodopDe nvo ( s2tmxopnodalt mfeia( a2tax  ou0oetniicildls umuvo (0 eenxr oydopt  i o s0srxoxm oodlmeelfvta() 2ua(m ;o1aetomfciyslm2emu snu) rtnif ty1opDraneo (0trtoxm3oo1opee fctat)sDur(r ou1tpxn fetld m em(vsnt0 ltnmr3totfmDran s;(0setrio nudal e fei sfa2raur nu4oet  octldlm rmn o u4 exrxr tytfpDe nvo;( srtoxm3ou4ame mfvs sfsrurxro;u0tpxnioctydla ua(mpnu4 rtrxo3oytom elivi;( trxmxm3oo1lmenlfvsa(  rtaxr ;t0olenmfciatls2uauvpnu4texoiociytlpD  nvi;s) euoxr io1opte iciat aDua(mp;u1olx  iciltla2ulu p;() lxoir3iadlmD ai ol()s2trim3iy4lleelnetas artr(m ;o0opx  o3iadfaDrl(mp;u)tlxnirciadoatranei;t) rumim io4lpeemncsatfaDtrurp;t0olto fciyd sDum( s u)treoxrctodlmt  n o t)seumxmpiu1omt miesa() 2um(m nt0oexoiieias m rmu p u4 lxnmo iotfmtr ivi;t0t2umxr iy4alenmicils)sDua(roou4texo o3tas m2eanvo t4 rtnif3iadlm   ivi s trxmir oy4ap n fct (f 2tm(mp;u0opxo o3tltfm ra(vsn(0 etrircta1lmtr n s;s0 exmirpnu1al elieilt) 2tmu  ou4tpe mf3tyd m2rl(ms;t4 etoxo3tytfa  lies;t)s2xoxo ny4olenlnctlt sDtau onu4alxnmiciltfmDumn pnt4 exrxrcoadlpD auei;( teum(o ou1lmtnmfctatfsDtm(mooo0aleo ieiasla ranvs;u)arxomr3todlmD lnei t0seurio3nu4ll  mncs tfsrrrxrpoo1opxn f3tytlmDrau on()altrmociydlp rlnvi s) ruoirpnudlpt  ivs ( srtr(mpnu1aee micilsfaDrm( on() etrircio1fa elneo s)t2umxo3io4apee ncsatf 2tmu  nu4olt iictldfm2elnmp t4tleoir3iodlp  ln ilt0teuo(rpny4ape lfctas)arua( ono4tpenmfctysla rlu o t4alxnir ta1lp rauvil(0setrirpoy1lp   nct ( a2rrx poo4optnifciasfm2umn s t4 ltomf3tatomDe i il(0t2umxrpiudlpenlfeia()sDurur ;t0tpt iiciad sDemnvp;u0 eerxf oa1oa  an o;t) rurxr3nydaltemfvsls) rtmu  ;u0tpxoioetasfmDemnmsnu0artnxfcta1omD  ivi;t0 rurxmpoudam nmicsl( a2uaxm no4oet  ociysla2elnmp;t4trenmf ootfa eluvo s teumirpio1altelnvils aruax  ;t1apt iiciad s em(vp u0 rtrmr io1optelnvo s)teurio3iodll  lfes s)aDtauronu1aptnifciys a umuvp t4aeeoxocoytlateauvil(  2xrxr3nudllen ictlt)s2rm( pnu1openiieilsla2uanvp;() exrxrctydfatr ivols0t2tmxo3nodlmte fetlt sDrm( onu0optnif3ils s umn pn()arxnmf totfa e u s;(  rurim nudlltnlfcslt)arurxmpot0tptoiieiatlaDel( s ()arxoxociodlm r uvi s0trxo(m3nu1alenmictlt aDurur no4oleomf3tltlmDuln p u)alxomrctatlptr ueol( srtm(m3oydlme mnci s)s2tr( oot1oltnmictas m2ulumo ()arxrmo tatlmDr u i;s0trur(o nu1al  mfvtl()arrax  ;o0ole iieiatfs rlnvs;() etrmf3oatfaD luvi t0 rxrim3nudole mfetls)srta( ono0opxn feilsfm rluvonu0 eeoxo3oydfpD lueo;s  rxrir oydlltnmnvia( a2rm(  ;u4oexomo3ilsls2ua( o (4tlenmr iodlp   ivilt0tetm(o iu1ll nlivias s2rrxmoot1olen fetyd a rmnmp (4 rxrmr ty1oaDelu s;()texrxo3nudol emivt tf rurxr ;o4oleo i3tls mDeluvp;u0 lerxr3iy1omDelnvs;t  eurxmpoy4lp   nesl(f 2tmxr ;o4tpxomietadla2eanms;u4alenxoctydla  lu ils)setoxopnodalt lnct ( a2ra(  no4oex mfctytla ul( o;t)altomo oo1lmte ies;t) rxoxo3nudap emfeils sDrmuronu4aptoif3iysfa uaump u)tlerioctotoaD aieo s)teumxmpoydol  mfesas  2rru ont4tltoif3iatlsDuaumsnt) reoxo iy1oa e neolt t2tmim3oo1op emneiatfsDtruroou0texo oeild mDrm(vs u4texoxf3oodfmtran ilt0t2toio3oudomt mnvs ()artau  ;t4tpto feils s umnmpnu0trtnir iy1fmD ln i t0s2xo(m3no1ale lfct ( srumur no4aleoio3ias s rmnmp;()teeomfcia1faDr n ils) etrxm3iu4op nmnci s aDuaum ;o1tpenifctat mDulumsnu4 lxoxr iadlpDelu i;s)s2xo(rpiy4olt licsl(  2tr(  ot1oexnmi3iys aDum(mpnu4 rtoif3totfaD ln sl(0 rtriopoodoltnmnetlsfsrum(r nu4tle  iciasfs ra(vo (0 rxnmf iotopt lneils trxr(o3oydop emiviat)sDtru ooo4olxnmfciasls2ranmsnt)teerioctytlaDr ivsl( t2tm(r3ou1alee ictl( a2tm(mp;u1apt moetad sDeau snu) ltrmr oytlm rauvo (0seum(opny1al nlies ()aDrr(m ot0aet  o3tls s ra( o (0alerir iy1lpDraueo;t) ruoimpoodomte feta(f rraump;u4aetnmictysla2uluvp;u) rxoif oy1omtr ivs s  2toir3oydop nlncsltfsrtr( oou1oexomoeiasfsDra(mp ()teenio3oatfat au s () exrxo oudll  lfvsasfsrtrur nu1oex  o3tltlsDul(ms u4 leoirctytlmt  uvi;() etrimpoudalen fcs ( a2tr(ro;t4aet ioctatla ua( snt)arxrmf3ia1omDeanes;s0trur(m ny1lm  lnei ( aDur(rpou4oee ioeiad s2ean onu0 rtoxf3iotlatr nvil(0sexo(mpou1omtemict (fsDta(m nu1oetomoctadlm rmuvp;(0aetomo ootlaD  ues;t0 rxmim nu4om   ivsa()srraxmo;t4apxnio3iytlm uanvp;t0tlxoiocoy1lmtrauvi s0t2xriopnodam nmfvtlt) 2taxmooo0oexoio3iadfaDrmn on()arxnmo oodoa  lnvs s0 eur(m oydalt lfvt (fa2urump;t1opeomociytlsDrmnvpnt4aetoif tadfm   ivs;()t2to(r no1lme mfvtatfs2rmurpno0alx mf3iys aDeanvon(0aeeriocoodop eluvilt srxmxopoo4lleelnvt (f 2rm(mpno1texomocilsls el(ms;u4teenxf3iotom eaneslt s2xoxr nudop elict t)a2rmump;o0texn ieils s ua(vo t0trerir iodopteaies t0 2trxmpnydoptelietlt sDtaumo;o1olx mfctaslm2elu o;u)treoxo oa1lm r ieilt0t2uo(rpnu1apt  fctlsf 2ua(moou0olto ieiydfa rm(vp;()trtrxo3oadomDe neo;( t2tr(m nydapt lnetlt a2tauronu0apxnioetltfs2em(vpnu)artnmo tadoateaivsl( srur(o iy4ol  lnei t  Durx o;u0tpe mfcias a2um( sn() rxnio to1lm e ivsls texr(r iy4apeelfvi t srtrxm oo4optnmieiaslsDrmu p;u0 rxnifcto1lpDeanvo;(0setmio3ou4lmtn ici s srum( ont1aee  o3tltfs rau o;t4 etoxfciydfp  lnes;t)seur(r3iodoleelnesas a2rax  no0ole  oeiasfmDrlnvpn()altnmf3todomt  ivslt)seur(o oodomt  fetat)s2urx oou1oeenmfeiysfsDem(vs ()teerir ootlatrauvol(0trxm(o nu1amenlivtl()s2um( pnt4olt  fcilslm rmnvpnt0altnxoctydopte ueo s) rum(opou4am nlfvtlt  Duau o;u1openif3iadfa rl( sn(0tltnir3tytop e ues (0t2uoxm3io1op   ictatfsrur( p;u0oexomfetatfs ul( p ()alxrif ty1om rauvsl(  exrir no1al   feils)a2tm(m ;u4opxo ociltlm rmuvp t)texoiociodfmD auei;(0 2um(r nydomeelnct ( a2tr( p;o4olx mfeiltfs emumpnu4 rtnmr oytfp r ueo;(0trumim3nu4aleemietls  Durxrp;u0tleoifetls s elnvonu) lenir oadomtrlu o t)texm(rpno1omtemiesa(fsrrmu  nu0tlenii3tadlm2ulnmsn(4teeoio3ootfa e nvs;t0sexrxrpou4lp nlivs s srtr( ont4olxoif3ias m emu p;()tetomr3oytlat auvs s  rur(m iy4lp nlfvs tf 2tr(r nt1tetnif3ild sDeauvsnu0altrxo iotfa eai o;t) exmio no1amenlicia() 2ta( ono0oexomietlt aDrmnvpnu) rtrio iytoatrau i;( s2tmxrpnu1lme lfvs (fartaumo;t4tpeo fciydlm2eau snt4 ltoxfctodom rau o;t  2uoxo3iu1ll nlfvsas  Drmxroot0optn ociatla2rau s u4aeeoxf3oatfat  uvs;(0texo(opou1amt livtatfaDrm( o;u4olx mieiyslm emuvo;u) rxrxr io1optrlnesls0srur(mpiy4omt lfcils  Dra( o;o1apxomocils a eau s u)altrmociytfp raueolt srtmxr3io4op  mnetlt) rrr(rpno1olenmietltlm2ranvpn(0 lxrifcto1lm eaues;(  exo(r io4opt mncta(  2rrurp;u0tltoiiciatfsDel(vo;(0 ltrir3todoate n ol(0 rxmio3oudlptemncs s)sDraur ot4alxo o3iadlsDeaumpnu0alxnio tadomD auei (  rurxrpiy4altemiesatf 2ur(ro;t4tlx iictasls eln pn(4alxnmrcia1fa ean ilt trtm(rpoo1lmtemnetls) 2taxr nu0altoio3iatfm el(mo;u4trxrxfcoadlptran o;(0s2um(m3oo4lle  nvt s sDtmur ;u1aet ifciasfm2uaumpnu0trtrxrciatoaDrai s;s0 exrim3io1ap elnctlt s2ta(mpnu4oexomfetas m2rlnmsn(0 reoxrcto1oaDelneo ()s2urxo oudap nlfetasfsrur(ro;u4oetoiieiltfmDemu s;t4altrmf iadfm eauvi s0t2xrimpio1lltn ietl()s2raum ;t0alx miciytfa umnmp;(0teeoxrcta1lat  uvol(0 rtrir oudomen ieilt s2uaxm oo0tpeoif3iadfmDrl(vsnu) rtomr3ta1latrlnes t0 euoim iodomt  fei (  rtaxmpnu1tpx miciasfsDemnvp t0tlxrxfcta1oa  liei;s)trxmxm3ny4opt mnesl(  2uaumo;o4oeeo oeiaslaDumn s;u0arxnxr3tytfp ranvolt0setrio3iu1opeeliesls arrmu o;o0oeeo fcildlm2el(vo;(0aetrifctodoa  aies;(0t2to(m oodamee fesas) 2rmxrpoo4oeen fetydlsDem( s t)alenxf3oa1fmtrai o (0 eurxopoy1ll   ieil()s2taxr ;t0tpx  icilsla2rmums;(0 etrmo3iotfa  ln s t)t2tm(r no4ale  neta() 2tax ono4tpe mietyt s rlnvp;t4aetnxf io1fmteaiei t0 rxoir nydap n nci s sDtrxr ;t1aexomfeiydfa2eau onu)texnmrcty1fa e ivsl() rtm(o3no1omt lfvtls  2urxrpoo4apxo feiydls el(mo;t0artoio tatlmD aueolt t2tr(rpoy4altn fvia()arrrxr nu4oexoiietlslm ul(ms;t0 rtomo todlp   n o t)trurxr nydalt mnvt sfsDrrumo;u4olxn octytfm2rmnms;()tetnxf3iatlp rlieol()seurio3iydaptn ivsas)a2rrur ou1opto fciydfa uanmp t0tetrmf tydlm r u s;(0s2umirpnudlp eliet tfsrta(r nt4tlenioeiltlm rmnmon(0 rxnirciatlatrauei;s) 2tr(rpiodol e fet t) Dtaur ot0olt  i3iytfa2um(vs t0aeenirctatfp  luvol()trtmir3iy1lptelfvi s a2tauront0tpeoio3tadls2rlnvs u)tltnxf3ootlmt lneo t srtrim3ou1ale mncslt  Dtauro;o1alt mf3iydlm2eanms ()texrio3oytoptelivi s)srurirpoy4ale  ncia( a2rm( p;t0aexnmoeiatfsDuaumo;u0tlxnxo tytfmt au o;(  rxr(mpiu4lltnmfeilsfsDuax  ot1tetn fciyt m2rln o;t4tlerxo3tydla   nes;(  eto(r nydame micils)arraum nu1tpxn f3iadla rmu onu4 lxomf3oa1la  ai s t) 2xriopoydop elies t  2raurono4olt  icias s el(vp (0 reomfciodlate uvo ( s2uoio ou4lpee fvsls  rtau p;o1tleo f3tydfsDrm(mpnt4 etnio3oytlp   i i;s seumimpnu4apt  fcs tf 2rr(m ot1tpxoioeiadfa2emnmpn(4 reoxf ty1faD ln il(0truriopnydoptn iei s)aDumxmpnu1tlxoioctasfs2rlnvon()aeeomocoo1omtraivi;t0 2umxm3nodlm   ivi ()s2rmxr ;u4aee ioetydfm2eaump;u0 lxomo3totfp e neo t teum(o3iy4lpen nvsls arraxmpoo1tlenifeild mDrm( p;(0trtnmfcoatopt lueo t0trumim3oydame  feias  2umur ou0teenio3iatlsDranms t4tetoir3ta1fatr uei s)s2trio nydop  livi sfa2um(r ;o4texniiciltfm2ua(vsnu0tlenircoo1lp   ues t  2urir io1ame lfciat)aDtau pot1aexnioeiltla eluvp t) rxnir3oadlpt lueo (  2uo(m no1op   fci tf Dumxm oo4alxniieild s2ean p;()aeenmf3iadla e nes;s0srtmio3oo1al nmfcia(farrau oou4alenmf3iaslaDrlu pnu4aeenxr oytopt  ivi ( texoio oy4omee nes tfartrxr nu0tpt mietad aDem(vo;(4 rxnmr oodlmDrauei;s0 exoxrpiu1apeelfvtls srra( poo4opx mietydlaDelnvo;u4trtrmo iodop ran s s  2xr(m3oodam nmivta( srrax  ;t1tlt io3ildlm2ra(vo u0trtrxfciadfm eau s;t) eur(r iudllt mnct s)s2tm( pou0tle  ietltfsDrauvp;t0aexrir3tydopDrlivils0 rxmio3io1lmte fcsa( artru p;o4oex moctasfm2rl(monu0trerxo3tatomDranvo;( s2tmxo iu4lmtn nvtl( a2uauro;o1oee  oetyslm ul( o ()trtrxoctadomteaivo (0s2xr(m iodalt lietasfarumur ou0aptomfctysfs uanmp;u4teenxf iydlatrlivil( srurxrpno1llen ncias  2urx pou4oee iiciadfs2uaumsnt4artnif3tadlp r ivil(0t2uoio3iydlp n fesl(faDta(mo;u4oltn ociytla rm(msn(0texoio3totfmteli ilt) ruoxo3io1lle liesasfa2rmu  ;u4ale iietadfmDrm(vo;t0artnif oy1op  anvo;()s2trxr3oudaltelfetas)s2ta(r oo1aeenioetysfaDrauvs u) rxoif iotlmt  ivs s0sexrxr nodoptnlietas  Dtrxr ;t0oeenmf3iydfm2rmums ()aexnifctodla rai o;()s2xr(rpiu1om emies t) 2rmur ot0oetnif3iysfa2ulnvs t)tetrxfcta1om e nvo;s)t2xmxr iudlp  lfct t  2tm(mo;u0ole mociyt aDumnmp u0 exnmf3oodoa  ai i;t0t2xoxm3oudopeelfvs (  rrrxro;t0optniictaslm2ua(vo u0artrxo ootlmt lies;s)t2uoxrpnu4am emfvils  rumu  nu4tpeniiciys aDul(mo;()areomfcoytlpteau s ( seuoim iydome lnei sfsDrm(mono1opx iictaslaDraumpnt) lxrif oatlaD aivs s  euoxo3oydalt mnvsatf 2rrxmooo0tpen i3ildfa2el(vsnu0 lenxoctatfaDelu ols trumxr3oy1altnlieilt) rur(r nt0aex iiciyd aDua(von(0alxnmf3iydomD anei;t0srxm(mpiu1op nmivil()sruauroou1tle ioetyt a rmuvp;() reoif oadlpt li slt) etr(opiu4lm nmivsl(  2raumo;u0tpeoii3iyslmDumn o;t4teenif3iodoa r ueo t) rtm(m3no4llt  fvt tfa2tax  ot1tpxoiietydfm2umumpnu4tetrmr tydlat  nvolt0trumxm3iy1lp nlnci sfs2rmxmoot4aeenmi3tas a raums;t0areomo3ta1fp r n slt0trurxo ou4op elivils a2ta( pot4tlto oeiysls2ul(mon(4 ltomfciotlmt auvo;s t2uriopnudlmee feiatfsDtmxr nt1tlxnmociltla2ulnvpnt4aexomr iatom rli i t)trtr(r oodoptemfvtlt)srtmx  ;u4aeen o3tlsfs2elnvo (0aetnio oadopt anvi (0t2uo(m oudop  lici tf rrm(m ;t0alxo ieiatlmDem( p u0 eeoxfcto1opDe uei s texmio ou1altn neia(fsDtr(rp;u0tleoioetldlm2ulums u4tlxriocootfmD aieol( teum(r oudop emfeias  Dua( o;t1tltnmf3ias a2rlnmp (0alxoxrciodoptelneo;t0 rxoxopou1olen ictltf 2um(mo;t4tpenmietlslm uluvo (4 rtnir3oy1faD anvi;s0t2xmio3nudlpenmictasfa2tm(r nt1oeenifciasfa2uau p () exnmrcoo1fa  aieilt0 rxm(o iudal e ivs ( s2umumo;u1tlenii3ild m el(mp u0teerxf3tydoa rlnei;(0tetrxrpoy4am  mnvsa(fs2raxr ou0apenifciydlsDrlnvpnu4areomr tatfmt  ies t srumxmpio1ol elfvsasfs2raxr ou4oleomo3tlt a2ra(vs t0 lxomf tatlpt  ueo s)trxoxmpoudamt lfvslt srra(rpou1opx iieiytfa emnms;u0 eenmr iatomt  ieolt) rto(m oudamtnlieils)s2tm(m ot1tex iicild a uaumsn(4aetoir iy1lpt au o t)seumir ny1ol elict t) rurump;t4oex mo3iydfmDeaums (0trtoif iatfmte uvols0 rto(o oo4altnlict ()sDurx ooo1aetn f3ils mDrlumsnu0 leoxr ootfpDelu ilt0s2xr(o3oudapee fvs s s2um( oot1olxoio3ils s elu s;u0arxniocty1faDe nvo;s0s2to(r nodamtn neiltfs2uaxrpot0optn ietltla2umuvo;(0 ltrxr ootom r nvils)sexmxmpno1om  mieiatfsrumu o;t0teeoifciadfm emn o;t)aetnxrcoy1oaD  n o;() exrim3iydopeelnvs tfsrrrx p;o1oet  i3iltfm2eln o;u0 rtnif3ta1fm elnesls  2tmxmpno4llt liesa(fsrtr(rpot4tetn octas sDulums t4texnxr oo1lpDrln i s0t2urxo oy1om emnetas) rumum ;t4optnmf3tatlsDelu p t4alxrxfciytfpDe u o ()t2um(rpnodap  lfvtlt)aDuaxmpot0oltn f3iyt s rmnvp (0trtnxrciytlp rluvo t) 2tr(o3ou1lmeelfes (  Dtaurpnt1optoii3tydlaDea(vo;u0 ltnmf tatfp eai o;(0 exmimpoudaltnmfvilsfs2ur(r nt4aexomo3iadls um( p u)tltrmfcto1optr uvils  etrim oy1am nmfvslsfsrtmum ;o4altoiiciasfa umn p;u0trtrmoctytomteau s;( s2tm(r3oo1opeemncslt srrru p;t1apeo i3iytls2uluvsn(4artnxf3ty1fmDrlivo () exr(o iodom e fci s srum(  no1apt  i3tldfm2elnms (4alerxo3todlm  lu i;t0texmxrpou4om  mncia( aDumxrooo4open i3iltlsDrm(ms;() leoxfctatoat ln o t) rumxr3nudom n nvs tfsrurx o;u4tlto ietytfaDrlnmp u4arxoxo3iatlm  lues;s)t2tmxmpio1aptelfvtas  rrm( o;o0aeen ieilt s2ulnvp;u4aexrxf oydfa eli s;t)texoxr3iu1altelfcilsfaDrrx ont1tptnif3iaslm2em( o t)alxoio tydlmDeau s;(0sruoxm iu4am  mfcs (faDurxrp;u4open oetad mDranms (4teenmoctytlptrauvs;()teuoim3ou1lp nmfvs tf rrrxm ;u0tpxo iciatfs ua( o u4tleoxf oodfpDrauvs (0trur(m no4llen neta(fsrtmur ;t1tptoif3iyt sDrl( s () eeoxf ootla  lnvi;t0 rtoim iu1ope  iciasfsrumumo;t4altn ictatfm rauvon() rtoxf ootfp rlu ol(0 2uriopoy4lpe lnviat aDtru  ot0opx ifeils sDulumsn()aeeoxf3ia1lmDrli o;()srtrirpiy4om nmict () 2uru ono0oeen ociatls rmnvo u4 eenmf to1la r uvolt s2xmimpiydapt  fcsas aDtmx o;u1oex  fciadfs2ua( snt0arxnir ootop  aneols)srxrio ou4lpt mfeils) rua( onu1aptn iciltls2umnmp;u) lenmo3oy1fa  aivslt s2ur(o3nodop   ics (  rtm(ronu0opeomietytlsDea( on(0tlxrmo3oytop   nvsls0 exriopiy4alen ivt ()s2tru poo1alxnmoctat m em( onu4aeeomr3iatlateau i t  2xm(o3oudll nmfcslt srra(m ou4altomoctltfa ra(ms (4trerxo3totoa eln s t0 2tr(r ou1op   nvs sfa2umxr nu1tee mociys s2rmump t)texrifciadomtrauvi ( srxm(mpio4omee iviatfs2rrxrpou0opeoif3tas mDumuvo;t4aeerio3tadom  anvol(  euo(m3io1alt mfctas  rurxr ou0teeo i3ild m2ranmonu4 etrmociadfp elies s0 rtrim nu1ame  nvta()a2ur(ront0aexn ieiydlmDranvp () ltomf ia1op   iei t  eurxm3iy4ll  mfcslsf rta(m oo4oex mfciysfmDranvs;()treoir iytfpDrln i;s) rto(m no1ol  mfctl() Dtm( pot0aet  i3ildlaDrl( s u0aleoxf iotfptelivs () 2um(m oy4ll nmfciasfs2tm(m ou4olenmi3iatfa rmuvonu)arxnxr3oadop eanvi s  etr(opou1lm nlfcias aDuaxr nt1oeeomo3iltfa2eln s u0 ltrmr3totlpDeliesl( tetm(rpiodll   ieia() Dur(root1opx iieiytfm2um(vs;t0texrmr3todfmteaieilt t2xrxr nodll emfeia() Durx p;o0oetoif3tls m2emums u0 reoio iydfpDr n slt0sexmim oy1lp emnvtlt)sruru pnu0texo i3ilsfaDul(vp;(0texrmr tydlaD aieo ()sexmxr3iy1ole lieils s2rax p;o4alto o3tyslm2rmnmsnt)arxrir iatomtelnvs;t sexm(r3oo1alee icilt) rumuro;o0teeoifciadlm ua(mp t4 rtrmfctatfaDeluvilt)truoiopnu4ap n fesasfsDtmum nu0tlt  oetad s uauvpn(0treoio3oytfa raies;(0teuoiopiu4al elieiat) rtau  ou1aeeomoeiytlm2ua(vp t0trtoxr3iodlatr i ol( texmiopiydope  nvtat arra(rpnt1aet mictat m rmu o t4tlermo3todomDraneils0t2xmim3no4altelnvtltfa2taumpou0apt  fcilsls rlu s;(4teerxo iatoptraivil(  2tr(m oudomeelncslt)sDtmu ooo0olxoiieiytlm um(mp;u0 rxoir3ia1oaD luvs;s)t2xo(o3ny1lmtn netlt arumu pou1tpeo fcils m eauvpnu0trtrxo ia1oaDr ieols) 2urio nudopte ictat a2tru  no0oleomoeiltlaDea(mp;(0 lxoxo iadomt aueolt)srtrxmpou4altn ieias)s2rrur ou4oee mo3iad s2rl( o ()aexrxo todlmD  ues t  rumimpoo4op nmnvtlt)artr(rp;o1oltomfcildfa2el(mpn()trerxr3iy1op r uvs (0 2xmxm3iudamtnlics t  2umumpou1apt ifciydfmDeau pnu)tlenircoa1omtr ues;(  eumiopny4aleelnesatfs2rru  ot0alx mociadfs2umn o u) rtrif oadlm  ai i;t srtoir3iu4amee icsa(fs2ua(  nt0tpeomocildfs2elu o;u) rtoir iotop eanvo (0t2xriopoy1amen nesls)srrm( pot4ape miciltlm2rlnmp;u)altrxr oodlmDrau olt) exmxm3oo1ale lfvia(faruaxmo;o0oeen feilt a ra(msnt0 rxnxfciy1fmDrauvsls)sruoio oy4apenlivt s srrmur ;t0aexn fciad aDel(vs;() rtoxf3oadlaDr ivo;t0 2xmxrpoodom e feil(  rtax ono4alx if3ildfs um(ms ()aeerxr iadfat aiei s0 rxmim iy4ape lfcs t  2urxrp;o4teenioctls s2emn s u)arxomr3tadfpt auvolt sruoiopiu1lpt  fcsas)s2ta(m nt0olenifciytla rmnvp;u4 rtrmrctydfptrlueo ()trtoir3iy1lm n fvtat a2ur(  no4olenmfetys s2eln o;(4 lenif3ty1lp rlnvo;t texmio no4opeemivs ()srur( pot0aetn icilsfm ea(ms;t)aeeomr iadlat ln s ()trxrio no4omeemfei t aruru ont4apx  ociysfa2rlu s t4tleoxo3todoa  aues;t texrio ou1optnlnvta( artr( ono0tet  feild m2uanmp t4 ltrmociy1lpDrau sl( tetoxm3ny4altnlnvilt  2tr(m oo0oexo i3tat m2ul( s (0trtomo oo1fmtr nes ( trxrxr iu1lmenmnesa(faDtmum ou0texo ieilsfs2rl( pnt0alxnmf3tatfa elueo ( s2ur(m3ny1lptemnes (fa2rax  ;t4oeeo feiytls um(vp (4alxrxrctatlm  livslt)seuoxo3oo1ome lfes ( a2ua(r ot1aetnmfeiatlaDrln o;t0artnirciodfptranei;t)seumiopiu1opeemfcsl(f rurur nt0oeenmo3ilt m emnmp t0artrxf3ta1oa rlneilt0texoirpno1apeelfesas aDtrx ont4oeenmi3iyslsDelnvp;t4altrxf io1oa r nvs ()srtr(o3iodllt  netl( srra(r nu4oeeo icilslaDean pn() lxrxrcoodfaDrlivs;s trxmir3nu1ol elivi t  ruaurpno1tlto f3ilsla ua(vp;t0tlermr iadlaDeai s s setm(rpnu1lm e ivs s  rtmumpnt4tpx iieilsfs ulnmsnu)alxoio ia1la e iei ()t2xrimpnodlle lnvs s) Drmumooo0aexn oetatfaDul(ms t)teeoxocootom rln s;(0 2urxrpio4am n icslsfsDta(rp;o0aptomfeiys m ra(vo t)arxrmo iatlp   uvo;(0 ruo(m3oy1al nlnet ()sruau  oo0texn f3tldls2eln pnt)altnmr to1omDelueils0seur(r3oydolenlici t sDua( oot4tptnmocias mDeau s u)artnmo3oodlat anvol(0 2uoir3iydole livtl()s2rmur ou1tpt ifctydfmDua(vo;(0areomr iodfmt  ueol(0s2xoim3ou1ope lics sfa2tm(rpot4alt ioctlslm2ua(vpn(0aeeoxfctatom ranvslt0seurimpno4omt  icias arrrxmont1aet  ieiyslm2rlu o;u4alenio3todlpt  ivsls srtoxo iu1apen fesasf Dtm( oou4teeoiociysfa2eanmp;u0altnmr3io1omDeaieilt)setmiopnydlptnlfesltf ruau  ou1tpe  oeiyd s rl( o t)arxnmo3todomte uvilt0srtr(m3oy4ll nmfeil(f rumu oou1altniocilt sDemumpn(0 rxoirctotlatr nes (0setriopny4om nlnvsl( arrmx pou1aexn o3tasfa2rmu ont0aleoxf iodoa  au o t0srto(o3oo1optn nvils artmurpou0optoif3iydfs2rl(mpnu0arermfciytfa  aies;s  etr(mpou1ame lnetl(f Dtr(m oo0opxnifetas a uanmpnt)alxrxr3iatlm  aneo;t setoir iodopenlfesa(f Drmumpou4tee  o3tatls em( p;t0altrmr3tadfm  aieolt)teuoxr3ou4omen ivt ()aDuaxr ;t1alx ifciydlsDuan s () rxoxf iatlmte uei s)trxo(r oudom e feiltfs2ua(mp;t1opx ifcilsfmDelums;t4tlerxo3iy1lpD aivo ()srtmxo3nodlmt  ietlt)a2tm(rpnt0alxn ietldla elnmo u)aeerir oa1fmte nes s0 rtoxrpio1lltnliesa() rtaxmp;t1aetomo3iadfs2umnms;(4aeenifciy1optrauvol(  2tm(m3oy1alt mici sfs2rau o;u4aleo iciad s ulump t0aeerir ootoptraneo;t0 2xmim nodol nlfesa( s2taurpoo1tetnmfciatla elnmp;u0arenifciatoat anvsl() 2xoxm3ou4lptnmfvt sfsDtmurono0ale  fciytfaDrln pnu4aeermfcto1fa eluvi (0t2tr(o iydam elfvslsf rrr(ro;o0olen ietad s ea(monu) rtnmo3ootlate n o s0s2tm(opiy4ale  fesas)s2tmurpnt0aet mietyslm2em(vs;u) rtrircia1fmD au o;t)trto(mpou1lm e ivtlt sDrr(ro;o4aex  o3tytla rlu snt)altnxf3oydfmDe u ils t2xr(m3oo4olt  ncsas)aDrmxmpoo1aet mfeiadfm2rlnmo;(4 ltrio ia1oaDe i sls)srtm(r3iu4ol e ivta(fs2rr(r nu1oltnio3ias aDea(vp u)tltnxfcoydoat auvi;s s2xoirpoydal   neia( aDtruro;o0ope  i3tadla2uanms t) etrirciytfpDran sl(0srumxmpoy4al nlfei t s2trxm ;o1tlt ii3iys sDra( p;u)altrmfcoadla   n s;(  2xr(o3iy4lmenmnvsl()a2tax onu0olt iiciysfmDrlnvs;u0 rtoio iy1fa   ivs ( truriopnudam elncsls  Dua(mp;o0olt ifeiytfsDuaumsnu0teenxr3ta1lptr ues;()srtmxr3ou1ap nlivilsf Dtaurpnu0teeoii3tys m2ra(m
\ No newline at end of file
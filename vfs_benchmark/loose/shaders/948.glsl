@@ -0,0 +1 @@
+i s t0trxoiopnydlmtn ietas)s2tm( p;o1oltomfeiysfm elnvp;u) etnmocio1fatr ieils) etr(m iu1omeelnvsa(f Drmxm no4teeomo3iaslaDra(mp u0alenxfcoytopD  uei;() exr(o ny1op n ncilt) rum(mpnt4teenmi3tydfm2rm(ms;t0aeerif3iodoptelnvi;t t2to(rpoy4lme mnvt t)a2rm(ro;o4aee  fcildfmDeanvsnt4aetnxfcoydlmtraueslt  2trxrpnu1altemneilsfs2rax oou0aeeo fciydfa2uanvpn(0altoif iadomteluvols)tetrim oudoltnmfcsls) Drr(rpno4aet iietydfm2ea( o u0 ltriocia1fm  anvi () 2uoimpiu4aleelici t)srumu pnt1oltoifeiyt aDemump;t4tleomr oodlpDraies s0srurimpny4lmen feia(  2tru  oo1altnmi3iydls2rmuvs;t4tlermfcia1omt aneo;s0t2xoio iy4omt livias  Duaum ;o4apx ioetltls2umnvo;t)arxnxr ta1fa  lueo t)srxr(o3oudlm   icsl(f Drax  nu0oexnmo3ilsfmDemnvpnu4 etoio iydop r nvo;( setrxopny4lmtnlfeil( aDta(mpou1aeeniiciltfa2ea(vs t0teenxf3oytlpD auei;(0teumio3no4om nlfet s  2tm(ro;o0tex  fciytla2rmuvsnu0aetrifcoodlmtrlneo s  etrir iydlpt  ietlt) Drr(mont4oltnmieiytlaDranms;(4 leoxf3iytlpte ieo;(0 exrxr3nu1amtnlneils) Draurpnt4tlx miciydlmDumn pnt4teeoircoytfp   ivilt) rtm(o oo4opt  ivt ( arumum ;t0alxo ociltls2ul( on() etrir3tydlaDrluvo;t)trxm(r3nydaptn ici sf 2rmxr ot1tee mfciadfs2rm( s;u)tlxrmr tydla  livols) rtrxopnu4op nlfvsa(faDtmumpno0tle mocild m2em(ms;u0tetrircia1oa elueo;s0 2tmimpno4amenlfesasfsrrm(root4tpeoii3tasfs uluvp;u4 exoio iotlm rli s ( sruoim oy4ap e ict t s2umx onu0aptn ociatla umnvs;t4arxoxf3tytfmteau o ()teurxrpiy1al emnvtls)sDta(mp;t1aexo ictys sDem(vonu0artrmf3iadopDelneo;(0srxm(rpou1lle lieiltfa2um(mpou1aexniictldla em(vont) lenmrctotfa e ueils)tetoir ny4open ivt t arur(r ;u0tptnifetat s umuvs;() rxnmo tatop  aivo;t) 2xr(r no1lme  fctas)srraxm ;u0alenmfeilsfa ulu pnu4alxnmo oytomD aivi;s)setm(m ny4al emfvt tfarrmxro;t1optoiietys m2rl(von(4aetnmfctadfa   nei s  2ur(o3ny4al nlnes s a2rr( p;u1texnmi3iys a ul(vs t4 rtrmf3tytlaD aivo t)s2tmxrpiudapee fvsls artaum ;u4olxnio3iydlm em( p (4trxnif3iy1lmt auvi s0t2tmirpou1ll nlfcta(  2ua(rooo0altn i3iatls umnvp;u4tleomr iydoa   uvolt t2xoxopnydlpe  fcsa(fsrrrxmp;u0tpenif3tyt a umu on(4 ltnio oatopD  u sls)srxmim io4op emivsat)a2tr( p;t1tlxnio3tytfs emnvon()altomr3ootlm  anvs t) rtr(r3ny4alee nci t)aDtm(rp;t1tpxomfeilt m2ulnvs;u) ltnir3totfa rlu s t0 rur(o oo1olenlfcs tf Drm( pno4teenio3iltfm2um(mpn()aeenxociydfm  auvs;(0tetrxr3ou4lmtnmict ( s2rauro;o1tetnii3tyt s2umumo;u0arxrxocio1fa ranei t t2xrxrpny1lle  fesl() rtrxront4tlx ioeilsfs em(mont4 rxnxfctatoateauei;s)teum(m3iudop e ivtl()artrumont1oeeoioeiatlsDeanmp (0 rxomr oodfaD li o;t0 euoir iydlm nmnvt (f Dra(r ;t4teen oeiltlm2ul(monu4 lxrmo totla   n s;t s2trir3iu1omenlfctas arrru pnt4texnifeilsla ul( sn() lxnmr iatomteli i s0s2tr(rpiy1ome lnvtas  Durum nu4tpe  ieils mDra( snu0 etrio3oodlptrlueo;s0 exm(rpno1alteliesas) rtmxmp;o4oeto iciyt mDumu p u)trxnmf iytlpDelueilt0s2uo(opno1apt lfvilsfaDra(m nt4aex  feiytfmDra(mo;t0tltomf3to1fa  au o;s  2trxrpoo1lmenmneiatfa2rr(ront0open i3iat a2ul(msn() exnxo ta1om ranvil(0 rtoimpno1amt  iciasf rurx ooo1apeo oeiydls eanms;t)tlxrxocoadfmt lnvols)t2uoxmpiu4oltnmnviasfsrtmumpot0aeen oeildls ulnvp t0 lxomf iydlaD luvslt0srurimpiydop  mics sfsruax o;o4tlt moetyt sDrmnmp;()arxrxf iydfpD aneo ( sexoir3oudapt  fvtas a2uaxro;t4olxo o3iasfa2emuvs ()alenmr oatoaD li i;t teumxr iydal  mivi tfs2ur(root1tpeniiciyt a2um(vp;u4arenir iodlaD auvils)teumxrpnu4ameemfesa( arua(r ou1aex  ieilslsDean p t0teerxo3tatopD ln sls0trumxo3oo1omtn nci (f Dra(ront0oeto f3tls sDemumo;u4aetrir3io1fpDeln i;t  etrxopoo1alenmivsat) 2rmurp;u4aetnmi3tadlsDumnvp t0areoircta1latraues t0 euoio ou1ole  ict sfsDtax p;o0apt mi3tasla um(mpnt)arerif3ta1opt  u sls0 2xrio3no4altn fvsl(f Drau pou1alx iociysfaDuanvonu4trxrxr oodlpteaivi s) 2xoio3nydoptelies tfaDtm(moot1aleomieiltfs ul(mp (0 renif iatopteanvil(0seuoxm3oy1apt licia(f 2rmum ;u4apt mociadfmDrluvsnt4 eeoifcto1op rlnvo ( srur(o iy4lptelfet tf Dtmx  ;o1olt mfctyd sDul(ms;u) rxnxrctydlm  lnvs;s  rxrxr oo4opt lfes sfsrtr(m nu4olxo oeiyd m eanvs u) rxnxoctydomDeluvs t0 2umir3no4lltnlieils  Dta( p;u1oee  ietlsla2eauvs (0 etnmrcio1fptrau o;s0trxr(o3iu4am elfet s)srrmum nu0tetoiieiadlm eanvsnt)arxoxr3tytfmt aivi t) 2xrxm3ny1ol nlfvtas) Dtrxm nu1oeeo i3tysfa2emuvs (0tlenif3tytop rlivi;t0trtm(m3oo1alen nvi t) 2umx oou0teen feiytla em( p;t4aetnxf totfatrli o;( sexmio3iu4altnlnetas)sDrauroou0olxnmociyd a2rmnms;()tlxrioctatfa elnvo s truoir oy1lpenmfci sfs2ra(  oo4aetn f3tatlaDrm(vo;t0 etoir iydlpDe u olt)t2xr(m3nydapeelnvsa( sDurump;o4oleomfctltlmDum(monu0trtomf tytfmt  i o;t) rur(o3nu1ol e nvta(f ruauronu4tet iieiasfa ul(mpnt)tetomfctotfm eaies s0t2xo(o3iu1olee ivs s) 2taxm ;o4oee ii3tytfm2ean pnt) rtrxf3totfaDeaies;s teuoio3iu1lp  lnvtat)srtmx o;o0oltoifctadfm rlnvo;(0areoifcoo1fmDelnes;( sexrim no4lm nlicsa(fsrtru poo4ale  fcildls um(ms (0 etoxr3oy1lpDr i s t  ruoirpno1om   icta()arta( ono1alen fciydls eanmo;t)alenmr totfm ranes s)tetoimpoy1opt  iet ()sDtaxroou0tpxnio3tyt sDum( pn(4altoio oytlmtr u s t0 ruo(m3ny1opt mnvsas) rumu pnu1opeomfeiadlaDrmn o u4tetrmfctatfpt  neol(  eto(m ou1apt  nvias s2um( pnt4tetoii3tlsls2emumo t)aexomrcio1optrliesls)texmimpnu1al  mnvi s)a2rr(r nt1olenmfciytfmDumumon(4texrifcoodlmDrau o;(0 2tm(o iu4om  liciat sDtmxmpot0tpxn fciydfa eaump u)tltnir iodom eln i;s0srurim nydaptemfei t)aDurx onu0apeo ocils m2uanvs u4trxrir iy1omDrluvo;( tetrxm3nu1lmenmnvils artrx  ot0tptnmo3iadlaDrl(vsn(4arxrmr oo1lptran s;s)trumxr ou4lp e ictlt aDrm(mpnu0tetoioeiadla2rmnmont) exoir3oo1optraues (  2xm(r3ou1ap  mfciatfsrraxro;o4apx mo3ils m2em(vsnu0 ltrmf3tadoaDe nei;s) exoir oudam e netlsfartaxm no1teeo fctadlmDra(vs u4trerif3oa1lptranvo;s s2xrxm3nudom e nvsa( arumx o;t4ale mociltfa2rmumsnt0trtrmr ta1lp eauvs;t seumirpoy4ap n nctatfs2tm(r nt1ope  oetlslsDrlumo;t) etrmo oatfpD aivo;t s2xo(r io4lpt mfvt s  2urum no1aetn ieilsfaDemnmsnt)arenxo tytlpteaueolt)t2urxr3iodapee fvta( arumur ;t4olenioetytfm elnvp t0teenioctytfm raueol(0srxr(mpoy4lp emfvilt  rtaumpou1oexoiietldfm umn p u0 eenxo3ta1laDe ieolt)sruoimpiy1am   nvslsf 2tmurpnt4oetnmf3iyt s2ua(msnu)tltrmr ty1fpteanvi s0t2umxrpno4ap   icsatfarurxroot1aeeoiociat m el( o (4tlerxr todfateln i t) etrim ny1oltnlfei tf Drrx ont4aee  oeiaslaDulnvp (0 leniociatoaD luvs;s0trtoxr3ny4al nlnvsat s2tmumo;o0ape mictldfs rl( p;u4artnxf io1lmDeauvslt)s2uoim nu4al   nesl() Drmxmoou4alx mfetys sDra( onu4aeenxociadfm rlu o ( s2umxm oodomenmfesas) Drau p;o4olen ietadlm2rlump ()arxrxfcoadlp   iei t)srurxmpno1lle lncslt)srrmu pnt1olxn fciatlmDrlums t4alxnmoctodomtelneo t setm(m oudll nlictat  2urx  ou0ole mieiltls uau sn()artnif3iatlm  lnei;( s2uoxm nu1apeemfcslsf Drm(rp;o4tpenioeildls2rluvont0tlerio3iodfmDe nvo;(  rxriopiy1aleemfctas srtm( ooo0tpx moetysls ulu s;t) rxrxr3to1fmtr uvolt0seurxopoudllenmfet s)a2raum ;u1tlxnifeiytfm2uaumo;t) rxnmr3iotfate n ils)setoir3oodopt  fvsl(f Drrurp;u0aex ii3ild sDeaumsn(4 rxnxocty1faDean i t  2xoirpiodll n fes t sDraxm ou0oetoio3iad sDuan s;(4teenio oo1fa raieils) ruoxm3nydalt  nvtl(  Dtmxmonu0alxoiicildls2ul( pnt)trermrctytfm  aueils truoimpou1lm emncsas artmxrpot0altoifciadfm2um(vs u0aetrio3iytlmDelies t teuoimpno1ameelivia() 2tmx pou1tpxnif3iasfm ua( s u0 rtnxo3io1lp elnvs;(  exo(m3nudole lfcs s) rrr( oot1olx ioctldlaDuanvs t4alxoxf3ta1om  an ol(0t2um(opio4optemnvt t aruax ooo1oeeomoetyt a em(vp (4teeoirciytfa   i s ()t2toio3iy1lmt lfeiat)s2rru ono1opto oeiydfm2eluvont4 rerircta1lptrau ilt0s2trxopny1lpte ncil()a2tmur ;o4alt if3tad a eaumo;()texoxociydoaDraies;t  2xoxmpnu4lmeelies s aDra(m no4tpxomieiat a2um(von(4aleoircia1fa   nvs;t0t2uoxr3ny1amtnmivs t)sDrm(  ou0opt iietasfs2el(vp;u0aetrif3oodfaDrluvi;() 2xoimpiy4aptemivtl()sDrmurpot0oeeomoetadfa2elnmon(4arxrmo oatfmDrauvi;() etmxr oo1ope mnct sfarrmu o;o1apt if3iat s umnms;u4alenxf3iy1faDrli s s) 2toim nydlpt  netatfaDtrxrpoo0texn octasla2uaumpnu0 exoio3oo1op   nvsl(  2toimpiydolenmfvilt sDrmx poo4optomoeiytfaDrluvs;(0texnxr ia1oa r n s t)seum(m3oo1ame  fcsa()arrmuro;t0openiocildla elnmo u0 ltrir3oadfat  nvo s)t2umio nu4alenlnetls)artmurono1apeomfeias m ua( p;() ltrir ootomD livo;t t2tm(m3iydalenlncsat) 2um(ront1oleoiociltfs2uau o t4 exoxr3tydlpD ln o;s s2xm(m3nu1amenliciasf Dumxmont1apt  f3iasfsDrlnmp () rxrmo tatfpD ai sl()srur(opno1aptn nvtas)s2ta( pnt4apxoif3iysla2emnvpnu4aexoir3iy1lptean i (0 2xoxrpno1ll   iviltfsDra(m no1tpen ietyt m2umu o (0aetoiocoa1oa rau s (0setr(o3oo4opeeliciatfsDrau p;o1oltomfcias s rmumsnu)trerxr3ia1opt  i il(0sexm(opio4lme mncsltfsrtax  ot4oexo f3tatfa emnvsn(0 rerircoydlpt au o;t sexr(m3ou1alen fes s sDurxmo;o4olxn ociys aDeanvo;(0teenmf iatomDrluvi () exo(m ny1om elfesas a2urxmpot4tltnii3iltfs umn o u4tltoxocoodop e u o t texr(mpoudomeemfvsas aDumur ;t4aetn fetlt a rl(vs t0aeeoirctatoa elneo t)s2xo(o iydlme mnesa()srtr(moou0aeenmf3ilslmDranmp;u4texoxr tytfate ues;s0 exrio nodame mfcilt) rtm(m nt1apx ifcias a2uaump t0alenxfcta1optrliesl(0srxmio no1ole  nvs s arrm(ro;u4aleoiociadfaDelnms (4alxoxf3oy1lmtrlieo t0truoxm iudapt mncsas s2um(m ;o4texniiciat a emn o (0 rerio3iatlmtrlueslt0sexoxm3ny1opt mfcs t)arrmu onu0oeen ociydla2emnmp;()tetoxfciytfaD li o t setoio3oo4amenmivt tf rtau  no4tltomiciltfa ea(vo;(0trxoir oa1latr u o;s0 rtrxm nudapen neilt) rraumooo0aptn i3tyd sDeanvs t4aexnxf to1optelies;t)trxo(r nu1lp e ivil( srur( ooo0tlen f3ils m2um( pn(4 eeoir3oy1om r ivi s srtm(m iydol nlfeil()sDum(moot0apxoif3tlsfs2ra(vo (0trxomfciodfmDraivi t)trtoxr oodamenlfviat)srtru o;u1tet mf3tytlaDeau s t4 rerxf oo1fmD liesl(0 2uoimpoo4llt liesl(fsDrrumpnu1oeeomfeilslaDua(vp (0alerxrctytfm ranes t)t2xoio io1ope mneilsf Dumxrpnu1tex io3iat s2uln p;t4tleomf ia1lmteauvi;s)truoxr nu1olenlneiat  2taxrp;u0altnmocild aDel( pn()alxnxfcto1fm rlnvslt  2to(m3oudol n ieilt  Drmumpno4oexoiicild m elump t4treoxocoodfpDrlnvo;()srtr(o iy1ame  fvt tfa2tmu  nt0aeeo ocildlmDrl(vsnu0trtnxrcoatoa e ies;() rtmxr3oy1lltnlfetl()srum( oot0teeniieiatlsDulnvs t0 exrxo3iy1fat lieo ( t2xmio3ou1am  mnet s sDrax p;t4ape mfciyslsDrmnmp;()tltnmo3iytom e neo (  2umxopiu4ap nlfcsa(fsrtauro;t4tetoifciasfaDea(vp;()trxomf3oydopteauvs;t)t2trxo iu4ameemics ()arraurooo1olxnmi3iatlaDea( o;t4areoif oytlaDeanvs;s)srxo(mpnu4am n fctl( aDua(m no0oetn ietld s ea( pn(0tltnif3oadlmDelnvolt0trtrxr oo4lpee ivtls aDtaumo;t1optn feiat aDemu o;t)altoif iatfatrluvils s2to(m nodlp elfcsa( arra(  ot4opx ifeiytfsDelnvon()aeeoio3tytfmte u il()sexoir3ny4ap e fcil(f rururono0tptn fctlslm eanvpnu4teerxf3oadfm rln o;s) etr(m iudol nmnvt s)s2trumo;o0opeo i3iltfm2uau s;(0arenio3iytoa  aivsl( teurxopoydapenmnes (  2ta(r nu4texn oetytlsDumn s u0arxomf oytfmt  nei;t sexm(o nu1om e fet t)srrrurp;u1oexo feildlmDem(vp;() rxoxf3iydoaD anvi;t0 rxmir3oodlptnmfvta( a2uax p;o0oet ifcils mDrlnvp t)teerir3todomt auvi;(0teurir nu1omeelfvs t  2raum ;u4alt ifeiltfm2rlu pnu0arxrir3oa1fat an ilt0 rtm(m3no4op n ietl() Dtrxmp;t4aeeomieiasfs2rluvo;t) eenmocoodoa e n s;s t2umxo iu4lme  netatf rrm(m ;o1oet  i3iatfs rau s;() exnio tydlptelu sl(0 2xm(r3io1lptnmnvsas) rrm( o;t0openio3iatlmDul(mpnt0 etrxf tatfmt luvi;s0 rxoxm nu4amenlfei tfaDurxr nu4oetomfctld m2um(mp;(4tlenxrciytla  lnvi;s setrxm3nu4lpen fcsa(  rtmx pou4oexomfciatla2elumonu) exnxrcoytop  lu i;t trxr(opoy4olt  nes ()aDrr(rpou4texnmfetas a2raumo t)arxnioctotoa r nesls0t2tmim3nydom   ietatfa2umx  no1tltoii3tatfm rmnmp (0tltnmfciydlmDean slt0t2umxo oy1ameelnesat  rra(rpou4olxnmociyt m umnvp;u0 lenmrctytfpDelivs s0 2ur(opoodlpte nctlt)s2taur nt0tlen ietytlm em(vo;t0artnxo todfa rauvo;t0sexm(o3iudap nmiesls)a2rruro;o0apx mfctatlm rmumpnu) etnif oa1fmDeanei;t srurxo iy4aleelfctl( sruau o;u4tlxomf3iltfs2um(vs (0aetrxf3oodfmDeaieo;t)srumim3iodamte neiat  rtax o;t0aet micilslmDelums;t4tetrxfcoydomt au o;s t2tr(m oydolte nciltfs2rrxroot4oltnii3tatlaDelums (0teeoiociy1lm r uvils0t2urxm ny4ll n feilt a2ta(  nt1tetnmiciys sDrlu snt4trerxo ta1opDeluei t)texrxrpiu1amenmfes (f Dtmum no0opeomociltla2uluvo;u0altoxo oytfmDr i ilt0texrxo iu4lptnmict sfsDtax  ;t1olxomo3iaslmDelnvsnt0artrmoctodfp ranvs t0 rxrxr3no4oltelfcsltfa2trxmono0apto ociatls uauvsnt)trermr3oydlmDrlnvol( trxmiopoydll   fvsa(fsDuaxmoot4tpeomfctltls2rlnvp u0artrio3todfate nvsl( trtrxmpoodamen ncs sf 2rm(moot0tpx io3iydfsDrmums t4 rermfcoa1oaDran o (0teur(r nudaptnlivs tfaDta( pou4olxoiieiysfm2ulnvont)tlerxrcoy1op e nvi ( t2uo(rpno4lmenmicsasf Dta(r ot0tetn o3tadls elnmon() renxrciydfp rlneols)sexr(r io1alt mfvi s s2tru pno1ope mi3iatfmDean p;u4alenir ootfmDeluvo t)srxmim3iydlp   icsltfartax ont1texniiciys s2rln sn()arxrxo ty1oa rlies;s0s2xo(mpnu1am nmies t s2rru p;t0olto f3tlslsDua( p;u4 lxoxoctydfa elneo;t)s2uoxm3iydamenmfcsl( s2tmxm ;t0teenmi3ilt s2elnmp;t)aetrxocia1opDeaivi;()trumio iudal nlfci (  rurxm ou1oex  o3tadfs2ra( s;u4aeenmfctydfat  n o;( texmxopoo4llte nesat)arrau pnu0texnmfciys aDranmp u) exnif tytfptr ivi s srxrxo no1optnlfctlt srrmxr ;o4oexo iciyd mDrlnmo (0aetrmf io1optr i s s)srum(mpnu4opt mieil(  ruaurooo4tlxnmoeiadlsDem( p u0arenxo ty1lpt auesl(0 2to(o oo1ale lnei ()sDum(rpot4aptoiicilt aDelu p;u4 lxrxfcootop  aivo;s sruriopou1lmeelnvs tfsrurumooo1tpenmfeias aDrauvsnu4aeerir3oodoa eaieils  eurio oo1apen netas)s2ta(rp;u0aeeo o3iyd s eau o;(4 etnxociadlm ran s (0 exo(m no1ol n ncs t) 2rau  oo0apxn ieils a2ranms;()aexnmociy1lpteau s;(0t2trxopnudllenmnvi s s2uaum ;u1teto icilsfm2rmumpn(0 etrmrciatlp e n i;() etr(rpio4al e ivslsfaDumx oot1aex  icilslm ulnvo u4tltomr3ia1oatr nvo s)s2ur(o iu4ole mfesat)a2ta(  ot0aexniiciatfsDel(msn(0alerxf3totlp  anei;t trum(r ou4lle lfvils) Dtr(mpou0aex iictltls emuvp;() rtoif tydfaDraueil( seurxr no1ole lics ( a2rr( onu4olxn fctlslmDel( o (4arxrmfcoatopDr nes;s s2umxmpoydalee nci (faDtmxr nu1oet io3iad sDem(vsnu4 rtnmr3ty1lpDr ies;t) rxoxo3iu4ll n iei t)aDraum ot0oeeo feild m2uanmp;()trenmf tytoa rlu s;s) 2triopou1alee ncs s)arraxmpoo0oee mfctytlsDuau o u)tleoir tadlm r i o t  rxmxm3oo4opeelncsat sDtmx pnt4aetnmi3tldlm ran pnu) rxrxfcoa1opte u sls0srxm(opoo1lpen iesltfa2ta(ro;t4aptn octltfmDemn pnt0altrxo ty1fmtranvi s sruoimpoo1amt lict ( s2rm( onu1ape mfctasfmDraums;u) renmo3todop rluvils0tetr(r no1al nmiei tf rra(m nu1tlt ifctatlaDumums u0arerxf iydomDelues;t)teuo(r nudapeelncsas srta(r oo4aexoioeildlsDrau o;(4 etnxr iadlatr n olt0sruoio3oydlpen fcsa()s2urx  ;o0tptn ictaslaDra(mp;(4aexrio3iotlm r i o;() euo(r3oydam n fctls)arrmxrpot0aeen i3iatfaDul(mo;t)aetrmfciotfpt lnvsls sexrio3nu4lm  mnvsas  2rmurp;u0opx mfeiydlm ea(vo u0 lxnxf totoa r u s;t  ruoir3io1al emnvt tfaDrr(r ot4opt  oeiatfaDrmuvsnt4 exnxo oo1op eanvi s0seurxopny1lptemicilsfs2tmxrono0aexomociyt aDeanvsn(0tltrxo to1om e i i;t teto(m oodole mfet ( aDtaump;o0tpe ifeiat aDua(mp;t0alerifcoydlmD  nvi s  rtrxo3nu4ll e ncsl(farurumpno1altn f3tltls2emumo t4areomr3totomD luvi (0 rtmirpiudome  ivt t) 2tm( ont0oleo fciaslmDelumon(0areomo oo1opDr uvils teumxm3io1altn fciatfa2um(m ;o0olxniieils m2ulu pn(0tleoir io1op e uvslt) euo(m ou4llenlnvi t srraxrp;t1oet  fciysla2el( snu)teeoxfctytlp   nes ( teurxmpiu1oltn nei sf 2tmumooo0teen f3ilt mDuauvs t0 etomf3tytoateli o;s0teumio3ou4amt mfcs s  2ta(r ot1aet ioetaslsDrlnmp u)treoxf iytla  aieo;s s2xrim ou4am nlietlsfsDuru onu1alxnmoeiad sDemu p;t0 lxrmo oy1lpDr nei ()sexoimpou1apeelivta()a2uaum ou0oex  ictadfmDrmumpnu)trxoifcoy1fmteaueo ()s2umxm iodam  mnctas  Dta( p;u0opxn fetltfm2uluvs;t)aexoif io1op r nvo s0 2ur(r nu4op n netlt) Dtmumoou0tlx iictad m umu s (4arenio oytlate ivsls0 rtrxo3oo4lleemfvilt)srtaumpoo1tpto iciydfs2uanvs t4alxnmr iodlpD  nvslt0 exr(m3ou4apen fes t)a2ur( pot1tleomiciatlm2eanvo u0artomf tydfm   nvs t tetoxopoodlpte feils  Dtr(monu4apt ioetltla ulu p (0tetnir3oy1lpt  ueils0teurim3io4lle mnvsl(fa2trx  no4oexnmo3iatfsDra( s u0aetrxf iytfmt auvs t0s2to(r io4ap nlnesls aDurx p;t4apt mfctlslm2rm(vpnu4 lxoxrctadlaDelu olt teumir3oodll  mnctls aDtmxroot4opxoiietasla elump;u0 rtrmr oodfptrln ols)srxmimpnodlme mnvsl()srua( ono0alto icilsla ea(mo;t)tlxrmo3to1fmDeln o;t texmio3oydaleemicilsfs2ra( oou1alt mfeiat s rlnvs t4 reomr3ootla  livsl()seum(r iy4ll elictl()arumx  ;o4alx if3iyd m2rlnvo t)trxnif ty1fate i s;s0teuoxrpno1omee nvia() rtru oou0tltniicilslsDeluvon(4aetnirctatlaD  ivs;t) 2tr(o3io1al nmfvt t aDua(m ;t1oexoifctaslm uluvonu)artrircoatfaDr i s;t  2xoir3ou1om  mfcsl( s2raxro;u1apenmoeias s rluvs u)alxoif iy1lat  u i;(0srumim3io1lpe  nesas)sDrrxrpot4tpxniieiydlm2ulu p t4tltnmfciodop rauvi;s srur(r3iydlpeemfciat a2umu  nt1apenioetatlmDrln snu4tetomf3tatfa   n olt)t2xmim3oydomeemfeiasfaDta( pou1alto oeiat sDumu o;u0areoifcty1oaD  uvo (0 2xrxopiy1apte nciatf 2ra(r ou0aeen ocils s rm( o;u)artnxo3oo1lmt an s t) 2trir3iu1lp nlncsa() Dtax oou1tlenif3tltla2elu s;(0aeenmf3oatlmtrluvo;s0texoiopoo4omeelnetasfs2tau  ou4tlen i3ilsfaDrluvo t) exnmrciytlmte ieo ()s2tmxrpoodopte ivi (farrrxrpoo1opt ioeiatlmDuluvs t4 ltnxrcootfat  uei s)s2xrir ny4op  mnvs s  2rrurp;t0olto fciydlm ea( p u0arerio iy1oaD lieols seto(o nu1om emfvta()s2ururoot4tex  o3iltla rln ont0texnmo3oy1late uei t0 rxm(r3ny1lp elivi tfaDumxro;u1tpx miciytfa rlu onu4 lxnmf oy1fp rln o;t0srumiopiudlmt  fetls) Drax pno1olt mo3tls m umnvon()arermf oatlmtranvo t trxm(m nydoptnmicsatf 2uax p;t1ope  feilsfm rlnvo;u4aleoif oytomt lu s s)seuo(m iy4ll n neta()arrru pou0tptn ietas aDemuvpnu4 eerxr oadomDe uvs;s0trxrxr3nudome livilt s2uru oou1aptnmfctldls ul(vp;u)altrircoo1lm  au s;t)t2umxopoo1lmeemnctasfaDta(mont4tlen i3tytfa rmu s t0aetnmo3oodomD  ivils0 euo(o3io1om  mnvi sfa2uaur ot4aptomociyt sDemu o t0tlerxr oodlaDr i o;s t2uo(o3nudom  lfeia( s2rrurpnt1openioetld mDua(vp u)alenmociotfa   u s;t s2uo(mpiu1lpe  fcil()arraumont4opxnmfetltlm2el( p;u) ltnir3ootfpD aues;t  rtr(o iydol elivt t  rur( oot1ope mietydfaDemn p t)arerif3oadlaD li s;t  eur(o iu4lltn iciat s2umumpnu1oexnmiciad s rmn o;u4texnxrctytfaDeluvs t0s2umir nu4aptemneilt)sDtrx pou1opto oeiad s emnvp u)aetomfctotoptranvs () rto(r3nydomee ivtls  Dtm(roou0ape ii3tydls rlnvonu0alenxrctydfpteauvs (0 2xrir oo4llee ietlt srtau p;o1apeoiictasfm ul(vp;t) lenmfctotlpt luvs t)trto(rpny1amtnlnetls s2rrur ot1tet ifciytlm2raump t)altrmr oadopte uvs t srxoxm3oudole  ivsls  2rmumo;u1oee mf3ils a2rlnvpnu0aleoiocoy1fmD  nvi ( trxoimpoudoltnlici ( srtmu  no1tpt ioetydfs ra(mo;(4 rtnio3iytoaDrlies;(0seumir3nudlpt  nvt t a2ua( pou1oeto fetasls2rmn o;u0arxnxf3todfmt anvs;()setr(mpnu4om n nci s)s2trx poo1aeenif3iydfm2ra(mo t0alerxr todfa rlnvslt trxoir3ou4om elictl(fsrururpou0altnifctas aDumumon() exnxfciatlm eli olt teuoio3iy1amtemfvs s sDrax  no1optnmociad a eaums t)aeeomf3oa1fmtr n o;s)s2ur(m no1ome  ivtlsf 2urx oot1tltomi3tat s2rln p;(4 eenmrcoo1la   u olt0teuoxmpoodom  mnesa(fa2rr(m ;o0aee iociydlsDelump;u4arenmrctatfpDelnvo;t) eur(rpnydaltemivs t) Dur(mp;u0oetomieiatfsDra(vsn(4altoxrciy1oa r ivi s0srxmiopoo4llt mictls a2trum nu0aexomociltfa eauvp;(0 leomf oadfaDrlneilt) etmirpiydaptelicsl(f ruax pnt0olt ioetldfa ra(mp;() lerio tatomD ai o;s0t2xoir nydop nliet ( srum(m nu0tleoiiciys a elu pnt0 lenxf todfmDeli i;( teto(o3nu1op nmfctat) 2ururo;o1tex  fcild m2ranmo;t4tlxoir3tytomDe neilt t2xoxm3oo1ol n fei (  2ra(mo;u4tlen ociltfa eanvsnt0trtrio3ootopDraivs t0 ruoimpoo4lmenmnes tf 2trurpot0apt mi3iad s ua(vo t)teeoxr3iatlmD ln olt)truoxmpou4omeelivsasfs2tmu p;t1texn i3tydfmDrln s u0 rtoxfcootlp ranvols trtrxopny4op eliesatfaDrrumonu0aeeoifeiyslaDel( onu0 exnmo3oadom   uei (0sexr(opnu4amt mfeil(fsDum(mp;o4apeo oetadlm emuvs t4 rermf3tydlm eaies;t0 2xrir nodol nmictat srtax o;o4apx  iciyt m rlnvonu4altnmo iodlm eaivs;(0trtmxrpnodaleeliesa() Drau ont4aleomiciyslm rluvon(4trtoxf3oadoat  uei t srxmio iydam emieiasfsrtm(rp;u4teeoiociytfmDum(vs;u)aeenmfcoatfat lneo;( tetoirpio1lleemicta(f Drr(  nu1oex mf3iat m eanvpn(4artrxrctydfmDrlivi ( t2tmxo oy1olenlfcsat) 2rr( oou0apxn ocilsfa rmnvont4artrxf iydlpDrlieo;(0s2uoimpoo1olen neta(f 2rrxr ;t4teeniictys sDranvp;() ltrxr3ia1lm e uei;t)texmxm iudlltn ncsat) 2uax  ;o0ape iietysfa ean s;(4alxrmfciatfate nei;s sexoxr3oudoptemnvt s) 2ra( p;o1tpen oeiaslm ra(vs;u) leoif oydomDr ies;t0teur(r no4op emiviat)aruaxrp;u4tlt  ociltfm ulnvp;u0 etoif oo1lm e u ol( setr(opnodop emfvsa(f rurx  ;t1tee  oetatls2ea(mo t0tetnmo3ta1fp   ueol()s2trxr3nydopeelfci s sDtax  nt4olenio3tltlm2ulnmo t0tltomr3to1fmt aivi t  exmxr3no1amt liet t s2tru  no4oetnmociatfsDua( snt0trxoxrcoy1lp eaueo s)seumxm3nu1al n ieiat  2ururonu0olx iietysfaDemu o;(4tltrir oydlp r u ilt sexm(o ou4ll nlncta(f Drmx ont4aeeo feildfaDel( onu0 ltrxr oo1latrlieo s) rumxrpoudapeelfei t arurx  ;t1olt iociysfa emnms u)alxnxo oodopt lnvo;( s2xmxr no1lm nlivtlt srrax pnu0opeomocils s2eluvp u4teeoircoatlp   nvs;s)setr(opoudole  ncsas s2uaxr ;u1openifciytlmDuaumpn(0texnir oo1oaDrlivo t trxo(r nu1lme mnetlsfarua(r oo4opeomfciysls rl( p;(0tlenmocia1fmD  nes ()srxrxm nudop emies s)aDururpou1olxnioctltls ul(vp;(4tltnxrciadfa elues (0t2tmim3nu1oltelics (fsDrmxr ;u4tpe ifeiasfa2rm(vsnt4aexnmf3iytlmDe nvi;( s2uoxm no1alenmfcsa()srrrx p;u4ope mietld aDuanvo;(4tetrmo3ia1latr ivi t0 eumxr3io1amt  ici ()arrr(  nu0oexnmfciatfmDean onu4aexnifctatfpt auesl()t2to(o no1aptnlfvsa( artm(r oo1oee mfciysfa umu s;t)arenmf3iotfptr ivs;t sruo(mpiodlm  lnci sfsDuaxmpou1tpen o3iytfm2rlu s;t0trxoir tatopDe nvi t) rxmir3oy4ap  mfvs ( a2ra(m no0opeo i3tyd sDumuvo;u0aetoxo3oy1la ean s;s) rtmiopiu1opt  fvs ( artaxr ot4texoiieiltlmDumuvp t4tetrxo oatlaDr n ils srtm(o oy1al nmncil(  2ra(  ;u4apx mf3tyt m2elu snt)texrxrcoodfatean i;s  2toxm iu1altn ieslt) rraumpno0ope iicildfaDulums (0 lerio3ootfmDeaies;s) rum(mpny1lp e ietlt)sDtrxmoot4tet  o3iysla2ran o (4 renxfctadop   nes;t setr(o3oy1lp  lneias aDrmum ou1tetnmictatls2rm( s u4 rtrxfciatlat lneols) 2uoxr oodlm emivtlsf 2raumpnu0olxnmi3iyt mDra(vo u4 exriociatopD lieil(0tetmimpoydol elfvilsfa2trxmpoo4apx iociytfa eanvo (4trxrmo oytoaDr i s;s  2uoir nodlpt lfcsas arurxr ou1olt iociys a rauvpnt0 rxnxocio1fpteauvolt teurxmpou4lltelici s)sDua(m ;o0tpxoifctysfs rluvp;(0tlenxf totopt aneo;s0srxo(m3nudam  mnvt s)aDur(r nu1oltnio3tlsfa rlu s t4altomociodlate uvs t s2xmirpiydope miesat s2rrxrp;o1tpxomf3iytfa ranmpn(4areoxo io1fmtraivilt0seuoio nudomt licsatfaruaur ;t4tetnmo3tadfmDumu o;(0 rxomfciodfp   uei (  2tmxrpoo4ap eliciat)sDum( ono0oexnmfeiatfa2ua(vpnt)aeeoxrciytfmtraues s0trumirpnudame mfes tfa2tmxr ot4alenmo3ildfs raumo;t4aeenxf3oa1fat aivi;s0 2xoimpnu4ap nlies t aDum(m nu4tetoioctad m umuvpnt0tetrir3todfmDran i;(0t2toim3iudole miviltfsrtmx o;u0tpe moeiyt s2ua( pnt) lermoctadlaDe nvs;(0texoxm3nydapeelncsasfaDrmum no1tpeoio3iadla eaumpn(0 leniociatfpDrluvil( s2xo(rpny1oleelfcia()srra(m ou1opxo fctatlsDemump (0aeerir oa1fmD  u i;( setoiopny1ol   fvi tfs2ur( pou1tlxn iciat m2rmnvo u4 rxnmocootfaDr n o t0trxmxo3io4lme mnctls) 2um(r oo0tpxoiietys m2ul(vo;(0tetnio3ty1omDr nvo;s  exrim3oudalt mfvia()srrrumpoo1apeomfciltls2emumpnt4trtrxo3oytfmDr iei t  rtmxopoo1lpt mfvsls)artmumo;u0oeeoioeiysfa2eaums u) ltnif3oydomt anes;t0 rtm(m3nu1opt licta(faDtrur oo0altn feilslm2rau o () lxnmocoa1opD  uvo t0srtrxo iy4aleemfes t)sDuaur no0texniiciytla2ea(msnu4tleoircoytfaDr ieil()sruo(m no4al   ivsat  rua(rpnt1tetoiietyslm raumonu0artnifcoa1lat lues (  rtoxopnodapt mfeils)sDua(rp;t4opx  oetydfmDeauvsnu0trxoxrcoa1oaDeau s;s0t2xmxopny4lpe mfci t  2tmu ooo4tlxo i3tytlaDeanvo;()alxrxrcoy1fatelnvi s)trxoiopoo1lmee fvt ( s2uaum ou4tlxnmoeiytfa2rl( s ()arerio io1oa r uesl( srur(mpoudol nliei t  Durxroot0ale mfctldfsDea(mo;(4alerxfciy1fpDelivo s trtm(rpnodolt lfviatfa2ua(m ou1alxniociytla ea(mo;u)arxomo oytoatrlnes t)t2trxm3nydom elnctat s2uauro;u1texoioeiatlsDrlump;t4 rtnif3oy1lpD ai ols0srtmxo ny1al nmivt s)sDuaur no1opx mfctas m2em( ont4trtoxfctatoa  aiei;t0trtr(rpoudoptelncsat artmu onu4tpe mfeiltla2rmu s;() rxrir3iotopD aies;t t2umxm oo4ll  lfet t sDum(mont1altnioeiltfs2ulnvs t)texrxoctadoat lieols0setoxo iydaltn nci tfa2ur(ro;o1tpe  f3tytfmDumnvs;(4arerxfcoatfaD au s;s0sexoxo3oodopeelnvt t srrrx oou4oetnifciad a2uauvpn() etrmr iytomt  i s;( setoxr ou4om   iesasfarur( p;u0ape ioetat mDranvo;(0tlxomoctatfpDrliei s  2uo(o oo1opt  fvtl( sDraumoot0oltn ieilsla2rlu s;u0tltrmf3oytfpDrlivi;(0trxoxm3ou1ameemnciltf Drr(rpnu0tlto f3tys a2ran p;t0 lerio3io1lm  lnvi () 2xoio3no4olt mnvtls arrru poo0aee mictasfsDua(mpnt4tlxnio3tatfmtr ivs;(  2xrim oo1alee ncsasfs2ta(m ;u1alto fctatfm2rauvo;(0arxoxf todfp  liei (0t2umxm3iu1lme  ncs ()arta(m no4opeoifetasfmDrmuvs u)tetnmr3iadfa rli ol(0s2xm(opio4oltnmictls)arum( o;u0apeniieiatfs2emnmp t0tltoif3oa1omDrluesl()trur(r3ou1lmenlfcs t)s2rm(m ot4aleomictadfs2el(mpn()texoxrcty1fp   ieol( t2toio3oydome mfcsatf Dtm(m nt1opxomociyt m2ul(mpnt4tltrmr3todfpD ai ol( tetoim nudam   ncia( srrrx o;u4tpeo fctls s2rau s t4aeenmr tatfm  lu i s t2uoxo3nudapt lfvilsfsDur(mpoo0tpxnioeiydfs2rm( s t)tltomo3iy1lm  aieols)trtm(r oy1altnlieils) 2tr( p;t0tpxn ieildlsDel(mp;t) exoif oatoat luvi;t)trtrxr iudoltnlfeta( a2rr(m ;o0apeomoeiltls emn s;t)artnxr iodomD aueo;s  exmxrpio4lp nlnvt ( a2rmurpot1tpen fcilslaDrmnvo;u4 rxrxf ootomt aiei;s0 exoio3nu4ome lncilt aDtmx pno4oeenmfctlsfm2ul(mp;u4arenif3to1op r nvs;t0s2toir3oudllenlici s  rtru pnu1ope  i3tadfaDelnvo (0trtrmoctydomDeanes;s0seuoio3nudll elfeta() Dtrxmo;t0alxomociytlm umumpnu0aeeoxf ootoate uvs;() 2uo(r3nu4lmt mnesa( s2rmxr ou0oetnmiciyt a uan p;(0trenmf io1opteai s;()trxr(r3oydop e nvsltfa2tr(ro;u1olen f3iasla rmn p;(0teermfcoy1opte iei;s)tetr(opou1llenmfcsasf Duaxrpot1oexomfeiydlaDua(ms;(0 exoir3io1la elivi;s  rum(m nu1lptnmnctatfa2rmumpnu0oeeoif3tadlaDumnmp t) lenir3ia1fp rlueols seto(m3iu4op  mnvi ( arrru oot1aetoifciadlm ranvp;(0 rxnircoadoatrauvo s  rtrim3oo1lmte neil(f Drru  ot4tlt  ieilt sDrlnvp () rtoif tatfmD anei;s0 rxr(m oo1lp nmnct t  Drau pou4openioctyd m um(vont0tltnio3iydfptrauvs s)setoxo iodapt miesltfarrauro;t4oetn ocild s2em( snu)tltrxf iotfm raivi ()s2umxmpny1al nlnvi sfa2tr( o;o1texomo3tytlm rl(vs t0 eeomo3iotfmDrln sls  rurxopiydll elfetltf rta(ro;u1olx ii3tls aDrlnvp t0tlerioctadlat ai s (0 2toxo3nydal   ict t) rraum nu0tpx  ociltlaDumuvsnu)alerxrcoodlpDraieo t setoxmpiu1altnlicsat sDraum nu1aet  i3tas m2rm(mp;t)alenmrctydoptrai o ( s2trxo3iy4ape micsa()s2umxront1olenii3tat m elnmont4teerir iatomtelneolt0 2uoir nydamt  ivilt)a2rmxroou0apenii3iysls2emnmp t) eenxocto1lp eliei s t2xr(r oo1omt  ivt t)s2tmum ot4aexn iciydla2ean o;(0alxoxf iodomDraueil(0 2trxrpiy1omt  neia(fa2umxm ;u0tpe mfciltls2rm( pn(0tlxnio oo1faDr ivi;t srtm(o oy1am n neilsf rtmxrpnu1texniictad a rlnmsnt4aetomo tydfm eli o s  exriopoo4lmt mfes s s2urxrpoo1tpxo feiytlm ul( s u0 ltomrciotfaDeliei;s) 2xrim3iodopt  fctas s2uru  nt4tpe  fciadfs2rm(vp u0altomoctytomtrliei t)texmir3no4lmte icil( arrrx poo4opx  fctys s2uaums;t4trtoxf3oy1fatr nvs s s2xoim ny4lm n iesa()arua(ronu4oexoifeiatla ul(vo u0altomfctotop rlneo t seum(r3nu4ap n nci t)srua(  ou4oltn f3tatfa2ua( s;(4 eeomf oodlm  auvs;(0texmiopio1lp  livi (f 2rru  ;u1tlx ioeiad mDul( p;u4 eeomfciatopt  uvilt0 ruoxo3iydapeelivtltfa2uaxmooo1aee iociyt a ul(ms (0alxnxo iodfmte nvs;s)trtoxmpiy1lltemncs ( aDua(m oo4oee iictytfmDrmnmpnt)arerir3totomDrluvo ()trtoir oudolte nvias) 2tmu ont0tpe ii3tatfs elu on(0trtoirctadomt au o (  rxm(r oo4oltemneia()srum(rp;t4tlxnii3iad a2el(vs;u) exoio3iodop eai s;s0 2toir3iy4op   nvta()aDum(rp;t1tpxomi3iydla uan o;u0arxrxfciadoat  uvo;t0s2xo(mpoo1lpt mnetltf rrm(mono4ope io3iatfm2emump ()aexrmocoadlpD ln i (0srum(o3nu1ale mfvtls) Drrurooo1tlt  fcias sDem(mpn(0 eeomr oatoa   ieolt t2um(m3oodol e fvs s sDraxmpoo0olt  iciatfm el( p u) lenmrcoo1fateaueil()texmxmpnu1amt  ictlt) rtru pnt4olt moetls s2ulump;t0texrxf3iadfaD  ivs ( t2tm(m3oy4lpenmict s) 2taxro;t0apxomoeiys s2ea(von(0 exoxfctytla elieslt)s2xmimpiy4oltn nctl()a2ta(rono4tlxoif3tlsfa2em(vsnu) exoifctodfm rlivo;( tetm(m nu4ll nmnetlsf Duru ono1tpt  ociasfs ua(vo (0 rtrxo3oa1lptrln o s)trumxr ou1lm  mfes tfaDtmx ooo4aptnif3iasla el(mp (0texnir iydom eauei;( srxrxrpiy1apee fctltf Dtrxmont4tltoifetlslaDel(vont)tetnmf totfat lnvol(0s2uoxrpnu4llt mfesat)s2rax  ;o4tpx mfeiytfs2umn s ()areoxf oatoa r uei;s  rum(m oy4aptn nvias arua(ro;u4aleo i3ildlmDelnvs ()alerio tadomDrlnesls0tetrimpiudalenmfvt s aDurx pou4aet ii3ild s eanmo;t)alenmfcoytfaD  i i s tetmir iydopee ivtlsfa2tax  ;o0oet  i3tltls rlump;t0 rxrxo3iytoa   uei;s  eurirpno1al nlieias sDtaumpno0opt mfeils m2umump;t)aexrxf3oadfpteaivi s)trtrxmpnudlpt  ieta(f rta(  ;t1alx mf3tyt s uluvsnu0tlenxrctatla   i i s0t2xrim oy1lmenlicsl(fa2trxmp;o0olxo f3ildfs ean on(0 exrmr3tytoaDe ues;t  exo(o3oo4lm  lnvil( aDra( o;t0tltn f3iysfm ua( snu0tlenxr3tydoatraieil(0t2xrxm oy4lmt lfcsl()aDta(roou1teenioetytfm2em(mp;u4 lxrxr3oadfp eaueo;(0 exoxrpno1opeelictlt  2tmurpot1openmf3ildfa2rmn pnu4 rtomo tatoa eauei;t) 2urxm oudap n ict t)aruaur ;o0ape  ocilsfa2ulnmo () reoio3iydfmDr i o ( texmxo3io1al  liesls)srrm( p;u4oleo ieiyt mDuln p;(4tltnmocoa1optrlieo;()s2xrxm ny1amtemicilt)sDum( onu1opxnio3tydlsDeanms t)arxnif3tytomt aivils0seuoxmpio1lltemnesls sruaumooo4tlt  ocildfs2rm(vsn(4 ltriocoa1lp e iei t0 ruoxrpnu1olt lietl(  ruaxrpnt1tle  fcias mDeanvpn()tlxomo3ia1lat lnvils s2tm(o3no1lmtelivi s  2uru p;o4ape if3taslsDrmn p u4aleoxrciodlp rau slt texr(m3iydaptelnvsat aDum(  ;o0tex io3ils mDumn p;t)treoio3oa1omDr i s t0 euoirpiu4am e fetlsfarrmu  oo1tpxoioctytfm2uanvp;() lxnircio1opt livs;t)tetrxrpiudamtemnvt sfarua( pou0olxnmoetyt m2emn o () eerxr ta1oaDr neo (0srxmxm3io1lle miesat sDum(r ;u1alen f3tltlsDemuvp;(0alxnmf3ia1lmDrlnei;t  rtm(mpiu4ol  mfvsas) Duru ooo1olto i3iysfsDem(vsnu4alxnmr3iodoa  ln il( trxoxr3oy1ameemfcsltfa2uaum oo4opx  f3iad aDel(mp;t)arxnmfciytfmteaiei s)t2trirpio1amen fcias)s2rrx ono0oltnmicildla uanms ()tetoxf3tadfateli i;t) eurir3nudapee iei s)s2tmxm ;u1alxnmo3ilsla2elnvs (0 etrmo3iadopteluvolt)t2xoim nodameemivia(f 2urx  nt0olt if3ilsfs em(mpnu0areoxf3ta1fm e i o;s0 2xoio3no4ome lnvsas) rrmxro;t1oetniictadla rm( pnt0 etoif ta1fa  lu s () rurir oy4lm e iesat aDtmumpoo1aetnmoeilsfm emu p u4alxrmfcoy1fatr nvslt)tetr(m ou1optnlfeiatf rtmur oo0aet ifetyslsDeauvo u0tetomr3iadfpDrai i ()t2tmxrpnu1lm  lietls sDurx  ;u1aexo iciatfs rmuvo t4artrmo tydoatr n ilt tetrxo3oydam elnvi t arua( ont1apxo o3iad s2rlnms (0 exniocoodlm eauvo ()s2toio oy1optelfes tf 2rruro;u1tet iietlslsDeanvo ()tetoir3tadfpte u olt0sexr(r oo1ap nliet (fsDuaxro;u0tpeo o3tysfaDemu o u)trtnir ootoaDran sl(0srxrxr3iydoptn fcs ( s2taxrpnt1aee  octytla2eauvpnu0aexnxo io1fpt au slt)t2toxm iy1omtn fvt t sDrmx  ;u0teenmfetldfaDeanmo;t4arenxfcty1fm eluei t0 rtr(mpiydol e neil( artaur ot4alxo i3iadfsDul( p t4trenxrcio1opDranvols0seur(m io1amt lies sfa2rmumono1aptomi3iysfm eanvs;(0teerxrcta1oaDrlneslt0 rum(opoy4oltemnesl(  2tr(  ot0aptn i3iyt a uanvs (0artnmf3oytlp rlneols t2xo(o3nydapt mnctls)a2umxr nu4oltomociytfmDemu s (0altomocoo1om r u s s0 2tr(m no4apenmfvsas  rtaxr nt4opeoif3iltla ea(mpnt4teerxf iatfptrauvo ()t2trio3iydopenliesatfarrm(monu1tpx  fciadls umnvont0 eerxf3oydfatrliei;()truriopiudoptemnesa(  2taur nt0altoifctyt s ran o;t0tlenmf3to1fmD  nvo s t2xoxopio4am  mnes tfsrrrumont0oee  f3tyslmDemn o () exrxo3tatomt livo;s trumiopiydap  lfcs (fa2ra(rono1apen oeiydfm uanvo ()altoxr oydfptr uvo;s0 eum(o3ou1alt licsl(f Drr(ronu0olenii3iysla uanmonu4 rxnmr3ootlp r nvs;(0texr(r oo4am elivil()a2ra(mo;o4altniociyt m ulu p;()treoifcoydoa eaiei;( teumxm no1amen fvilsf rta( o;u4open ieiltfa uanvo (4aeenxr3oatfa e i s;s)srxrxr3oudomen ici t s2rau oot0aexo ocildls eau s u)texomf tytomD livslt)srxr(r nu1opt mictlt)aDtru  nt1oeeo ictat m elnms;t0 rxrmo iy1fmtranvs s0texmxo iodam nlnctas)a2raxmonu4texo feiytlm eaumonu4artoxo ia1lptr uei;( trurimpou1llen nvilt)s2trxro;o1tpeoii3tldfm rlnmsnt)altoif3iotlateanvols0 rtmiopoudlle lnes (fartrurpou0apto fetad s el(vo;t)altrmf3oy1opt  n sls t2xoxm nydlme lfciatf rtruro;u1ale ifctatfa2uauvo () rtrxf3io1lp e n s s)setrxrpno4lm nlictls)sDrru  oo1oet  o3ilslsDrm( p (0alxrmf io1fpD  u sl(0sexoxr iudlptemnesas) 2rau ont0aetnifeias sDeau o;u0alerxocoo1lmtrli ils0sexrxm3iy1apt  ici s  rumurpnu4tetniieiyslaDrluvo (4 rxoxfciatfpt aieo ( s2xriopnudape mietat)aDtmum ;t4aetomi3tls aDumnmp;u4alxnmfctotoaDrlieol()t2toxo oo4apee fvsas)srtax pou1aptomo3iasls rmnmsnu) ltoxr oadopDe ueolt)t2trio oydlmtnlics t aDtruro;o1aexnioeiytlaDua( pn(4 rtrmf3iy1op e i s;t0 2tmxmpny4al emfesl( s2uaump;o1olto i3tysfs uau p;t) etoxr io1lmt lieo;s)trtrxo ny4ap nmfet t  Dra(moou1teeomieiysla ulnmp;t4tltomoctytla eli i ()seurxmpoo4olt  fci ()srurx pnt4aexn o3iyd mDem( s;(4 ltrif3ty1oateauvsls) eumir iydale lnvsa( a2tm(ro;o4tee mf3iydls elnmo u)alermf3totopt au i s s2xmir oo1om  mfcslt aDtaump;o0tpen icildfa ul(vo;t0tlenifciytlpDr u o t0t2to(mpoy4lmee fvs s)sDuau pou4alx iicias mDuan p;t4tlenxf3io1omDe ieil(  rtrxm iy1omt mivsat  rrr(r no4alxnmi3tlslmDum(vpnt0 lxoif3oodfp rlnvi;t0 rtm(r3oudlmenlictl() Dumxmp;o4tlt  i3tldlm umnmo () rxnxf oatlp  livslt0 rxmir3ou4op emfvt () rur( p;o4tptomfetytfs2ua(vs u0trxnir iodomDelnei ( s2uoxopiydopte ivt t)sDtm(mp;o1aex  oeiytls2rmnmont)trtomrctotfaD  n o;t0trtrxo io1altemneilt) 2taur nt1tlenifciltfs2ulnvo;(0tltomo3oa1oa r ivo s)teto(rpou1alenmiet tfsrurxmo;o0alxnmfciyt mDrlu p;t0 rxnif3ta1fm  ln o;(0t2tr(m iu1al  miet s sDtrumpno1aexo fctyt s em(mpnu0aleoiocoy1fmtraues;s  rxo(o iudlptelfcia() rtrumono0tle mo3ild s raums u)trtomocia1latrluei;t0trxoxrpoydapt  fctlt)srum(r ;u4tlen f3tat s2rmuvo t0 exrxr3oydlpDrln s s0srur(m nydopeelfctasfsrurumoot4opt  feias sDrmu s (4tlxniociodoate u i;s0srxoxopnu4ol  mfci t)s2tau ont0texo ietadlaDuluvpnu)aleoirciytop e i s;(0s2xrxo3oudam emivt s sDrmxr oo4tpenif3ils sDem(mp u4trxnmo totoa raneols)s2uoxm oo4am elivi ()artrurpnt1oexoif3iyd m2eanms;(4tltnmrciodlat anvs;t0 rurir3oo4al nlnei s  rtm(  ;o4aexo ieiysla eaumpn(0 eenmo3tadfm  lueol(0trtoio no1lltnmnvs t)sDrmurooo1oexomieilt s raump u0alxnmo io1omte n slt0teuo(m3oudoptnmieta(fa2ua( p;u1aetoio3tlt s ul(vsnu4trxnxo3to1om rlueo;s s2uoiopoy1lltnlnet sfarurxro;t1texn ictad aDrlnmp;(0altomo3ta1lpDrlieslt0 2xrxopiudolt lfesatf Drrumpou0tex  i3iysfa uau o;(4 exoif iodlpDrai s s s2xoio iydolenmies () Dum(rono4aeen fciys m2eau o;()tlerxocoydlat aues () 2urio nudap  mnctat s2trxro;u0tex  i3iyslaDemnvp (4texnmoctydfpDrln i ()srxoim nu4ape mfct t)sDua(  nu1aex  oetatfs2ea(vpnt4 eermfcto1lpDrauvi;()srtmim io1lptelfeils aDrm(mono0olx  ictadfm ul(vo;u0 renxr oa1lat  ueols  euo(o3oodap e fesat s2rrxr ;t4tleoifctlsls2rlnmonu4 exrmr3tadop ranei;s)trxmxopno1ol nmieias) 2ua(m ou1opxnmfciyt sDumnvpn()teerxf iadla  an olt0s2xmxr3ny4lmen fes tfarra( p;o1oltoiietldfa ulums u4arenmo3oo1omt anvo;(0seur(r iodolte feta(  Durur no0aptnmietasls umuvs t4tetrxo3oydopDrlnvol()s2uoirpou1oltelfviatfa2ra(r ;t0optnmfctatfm2ranvsnt0trxoioctotom r ivo;s  2tr(opiu1lptemnvias  rrr(  ;t0tpx iieiyd s em( s t) lerxr oy1opDrli sls0 2xrir iy1olenlfvs t) 2tmxmont4apt iocilsfs2ea(vont)tlxnxfcty1faD lneslt)setmirpno4lpe mfes sfaDraumo;u0tet io3iytls2rmnvon()trxrifcoatomD  ieo;( sexrim nodlptnlivsat)sDtrxrp;o0tle mociasla2ranvo;u0trenif3oytomD lnvo t)trxrxr oy1lpeeliesatf 2umur ;u1aexo oeiytfs2eln p () eenmf3oatlm eluvi;(0 rxmim nu1ome  fci (  rtr(mp;u4olxnioeiatlm2uanvsnt) eenxfciy1la e nvo;() rumxo3ou1amtn iesas)a2ra(m ;u4tee  ieiyd m2eau pnu0 lxoxf iydfp e nvo t)setrxopoy1lmee ivtas)a2raur ;u0tpe miciytla2elu s t4teeoir3oy1lm  lnvs t setrimpiu1amtemictl()aDtru pnu4aetomociysfsDrl( o (4 ltrmf3iadoa eaieo () exmirpnydaltemfct tfaruru  ou1opt io3tydfs ul(mo u0aeermo ta1faD  ieo t s2urxo3nodale  fvils) Dumx oot0tpxn ociad sDrmnvp;u) leomfciodoptrlnvo ()seurxr3oo1aptn nci t) Draxrpno0tet iicilsfa2emn on(0teermr3oy1laD  ieol(0setr(opio1altemfvilt sDumxr ou4aexnmicils mDum( p t0teermo iadlm e ieo;()teuo(r3ou4omtn icsl(  rra(r no1aexn o3ilsfsDuau on() reoif totfm eau sls)trum(opoodol   fcias) rurx pnt1ope iieilt a2emnmo u0altnmo3oo1opD ln il( truoxm ny1ope mfvs sf Dur(  nu1olxn feiat m rl(vs;t) etnmfciytfp r i o;s srxo(mpoo4ol  lfctat) rrmx  nu4tpeoio3tldfmDumumo;u0arxoxf3oodfmDeaueils)srumiopoo4lpenlnctl(f Dum(mpou1tetomocild sDuau s (4artomf ta1laDelnvilt)s2xrxr iy4aptelfvtlt) rtrxm oo0oleo o3tysfsDulumo;u4tlermo tydomDr nvi (0 2xo(rpoy4altemfvi t)a2taumonu4ope  feiysfa2rlumsnu4artrxr iytfmD  nes t)s2umxo oy1am elfci s sDum(ront4apt ifctatlm uanvo;t) lerxfcta1fmte uvs;t setrxmpoodlpe mfcsasfaDrm( ono4tpeomociyslaDraums (0 rxrmo oy1lpt ln i s  2toiopoo1amte fesasfaDum(r ou4tex mfctasfm2ranmo;(4 rtnxo ty1la rluvols0srtrxr3io1lme mfvs t s2ua(  ou4aptnmi3tatfs2elu o (0aexrxf iy1fpt luvi s)s2um(o oo4lmt  ivsl( a2uaumo;o1opxniietltfs rlumo ()areomf io1la rli sls sexrxr ou4oltn nviatfsruaurooo1opxnio3ilsfs2ulnvo;u4tetnmrcoodfa  livo s) 2uoxopno4omenmneils s2taxro;o1oex mfeiat m2ra(vp t0 exoir oo1fpte i s s tetmxrpoo4ap e nes t  rrau poo0oexnmfctldlm2ran pnu0 ltnmoctadla e ues;(0s2xmimpnudolen ncilsf Drmump;t0optomi3tlt aDul(vont4trenmocoy1lpD  uvi;( trxm(r oodlle  fctl(faDrm( o;u0altniieiltls2rmnvs;u4tetriociydfatrauvol(0tetm(mpoudoptnmivta() 2uauroou4oeeomfciytlsDeanmpnt0aetoxfcoatoatraues;t0 euoio3nydom e nvsat aDrm(ro;o4tpe  f3iasla2elu sn()trtoxocoydfp rlieils0seuo(m oo1opeelnvsls a2rmx pnt4tpt mo3tltlm rmn pnt4alenmf3iotopDeaiei () 2xm(r3oo1om nlfctls) Drmuro;u4aetomocild s rauvont4arenmo tytopDeluvs;(0seuoxo3oodap  lfciatfsDumur ;u0opx  fciadfm rl(vp;t)alxnxf3oodla eauvo (0s2xm(m3iudll nmfcsa(fs2tmumpnu0opxomocildfa2rmn s u4 lxnifciydom  anvi t)sexrio3iu4llt  nei () 2ra(rpno1oetoif3tyt m eluvonu)aexrxr3iotlm e u s t0s2tmio iy4ale  ieiasfsDtaur ;t4tpx iicilsfaDemuvo u0 leoxrctotoa  ai i;(  2uo(m3nydllte nes t)a2ra(r no0tetomocilsfm rl(mon(0altnir3iy1lm rluei t0 2tm(m ou1llt mietasfaDta(m ot0olxomf3iad m2em( o;()tltnif todlmt an sls) rurirpiudlpen fcsat s2rr( pou4alxoii3iltlaDrmu s t)tlerxf oo1latrluvs () 2tr(r3iy4opt lfcslt) rrmu pnt4opt micilsfsDea(mp t) rtomo3tadfpteluei;() exo(rpnu4ome lneil()s2um(mo;u0tptomfctytfs uanvs (0tltrio3oatfm r ieo;( srumxrpoo1apeelfcs ()aDtmxmont1olxo octltfmDul(mpn(0 etoifcoodlaDe u ilt0tetriopiu1opee fct (  Drr( oot4altniictydls2ea(vp (4trxnir oatfm rlu i;t0trtrimpoo1ol  mnes t)a2umx  ot0ole io3iltfa eauvo t)tleoxo iodop  anvol(  rurirpno1ol elfcslsf Drr(mooo0tlx  octlsls rln snt)trxrmrciydoaD  n s;s)srxr(rpou1opt mnvtl()arua(mono4olxn feiys s ua( pnt0tetrmr ta1fpteauvi;s  exrimpnu1al emnei s srtm(ront1aptnioeilslaDelums;u0 eenif iatfp eaneil( texmxm nudoleelneilt s2rmxmpno1openmf3iasla rluvo t)teeomfctytfpDe ues (  2xo(rpnu4am n ict t) 2tmx p;u0oeen ieias aDelums;t4 eerio3io1lpD liei ()trxo(mpno1omt mfci ()srtaumont4opx mietas a2el(mp;(4arerif3oodla elivilt)s2tmxm3no4ol n fvtas srtax  ;t4oexo feiad aDean pnu0alermr iadfpDr uei;( seuoxm iu4ame  nciltfartrxrpot4opxnmo3ilslaDuln pnu4 etrif iodlateaieo t)srtoir nudopenlfci tfa2umxmp;t4oltn fetytfa2rlnvo;u0tlerxo oodfm r iei;t)teuoxopoodal emiei tfaDtm( onu4texoioetyslmDra( onu4arxnmo3iadfa eau i;(0srtoirpio1amtelfei t  rumxront1aexoioeiad m el(vp ()treomo tydfaD aieslt)sexrio iudlp n fcsat)a2ta(m oo4tpen o3tls sDrl( snu)aexoxr to1fp rli slt0trur(mpio4lpenmnciatf rumum ;o1oet  ietasla2umn o ()artriocootfmtraueol(0t2to(o io4aleemfei s)srurxro;o0oltoioctydla2ulumont) rxrifctydomDrlnvi t)texrio3ou4om emictatfaDtauroou4ape  ietyslm uanmo u)alxnxo iytfaD lneo;(0 2tmio3ou1llt livslt a2uax  ;u1ape mi3taslaDul(vp t)arxnmf3oa1lmt aneo;( teur(r iudomt mivias a2trxr no0aeeomfctldfa2em(vo;u4aexoif3tadfpDr ivs;s texmxm3ny1opee icsls  rurumpot1alto fciltlaDuanms t4trxrifcty1opDelnei;(  rxrxopoudalt  net t a2rmumooo1oltoifciltlmDea(vpnt0 lerxo3oytoaD lieo t0t2xrxr ou4llt livtas)arrrx  no4oleo ieiasfmDemu p u4arermo3oy1om  auvo () exmxr iy4olt  ietatf Dtr(rp;t4opeo i3ias a eln p (0trenifcia1omt aueil( sruoxmpnu4amtelici (faDta(rpoo1oexomfeiaslsDrlumo t)texoio totlaDeaivs;s)s2toir ny4am elfet s) 2uaxrpnu4tetoiieiytlsDemnmo (0 lxnif ootfm r nesl() rtoimpio4lmt liei tfarrr( ono0tex mf3iasfs el(von(4arxnirctadfpD  ieil( trxrir3ou4oleelnesas  rra( pnt0tex iictatfa2rmu pn()artnxo3iodlmD auesls srtrxm io1optelneils) 2tax p;o0oexn o3tasla ea(ms;t0artrio3oydlpDeln olt0trtm(m io4omeelnvtas sDrax ono0oleo fcilt a2uanvs t)texniociatopD  ieo t sexoxr3oudalt mnetasf Dra(mp;u1ale mi3iasfm2ua( o u4tlxoirciy1fpt aueolt) ruo(r nydlle mfci sfa2rr(r ;t0ape ifctls s emnms ()trtrirciydlaDeauvs;s0srxrxo no4ame  fet tf 2uaxmoou4alt  ocildfs2eln pnu) lxnircty1fpD anei;(0 rxoim3no1opte ncta(  2uau  ot1teeoifetad s el(mo;t4aetoxf iatfaDraieslt0 rtrxr iy4amenlnci s) Duaxmpnt1optniietas mDem( ont)areomf tydlaD li s;() etoio3iu4ale  ncsa(f ruaxrpnu4tpxn oeiytfs2rlnmp (4aexoxr3iatfa  lu s;t0 2ur(r nodlmee fesa() Durxmonu1aee mi3iyt s em(vpn()aetrxo3todopDr n s;t) etm(o io4olenlfct () 2um(  ou4opt ifctas a2uau s () rerxrcoo1oaD lu sls0trurxrpoodaltn iesat  Dtau pot4alen o3tlt mDrluvonu0 reriocio1la  ln i;s) rto(r iudoltemnviltf 2ta(m oo0apt  ieiasfaDel( on(4tetnxrctodlptrlu i;( teuoxr iydopt  fct sfaDta( onu1aexnmieiyd a rlumo;()areoxr3tytfmtr ivo t  2xoir3iudol emfetlsfs2ua(roou1altoii3iad a2ua( o u)teeoxr3tatfp rlnes s)trtoxmpio4ape mnes (f 2raxmpot4opt  i3iltlaDulumo;() rtniociatla e neslt0s2umim iy4om e icta( sDurxr oo1tlx mfciad m2rlu onu)arxrxf ootomte ueils  rxoxr iu1oltemicslsfs2ur(  ;u4tpeoii3tat m2ranvsnt0altrif iotfpDe ivolt0tetr(mpnudame  nvsasf 2trxmp;t0tpxn f3ildlm2elnvpn(4arxrxoctydlpDr uesl()setoim nudlltn fvsas)a2rmxmo;u4tpe mieiatlm rlnvs t0aexnmr tydfpDr i sls)srtmxr oo4am elics t)s2rau ooo0oeeoif3iadfm2um(ms;u4texomf3iodlmDr nvol(0sruoim3nodlm nlnvslt)a2trxrp;t4aexomictldlm2rmnms;(0 eenxo iydfp eanei;t tetrim iy1lp emfei t  2ra(mo;o4olx mfeiyt m2rmuvo t0 leoio to1fpD  uvols0s2xrxmpoodomt mneias arurxmo;u4teen f3tydfm ran s;t4 lermr3tadfp r u s (0 2tr(opnydlptn fet (fartaxm nt4tlxomfeiadfa uanmp;(4 exoxo oydfp eauvi;s)t2xm(m3iy4lle  neia(farumxm ou4ape  iciyslmDranvp (0areoif oa1om r i s s0 rtmxr3ou1oltelictl() 2tm(m ou1aex mi3iasfs2rmn o;t4teeoxr3tydopD lieo;t0 rxrxr iy1ll   feilt  Drrxmp;u1tet ii3iyslsDrm( p;(4artomo3oadfp   iei (0 rumimpnudll  lieil()sDumu p;o4olx  ociydla2rl( s;t4aexnmf3tytlatraneil() 2tr(m3iu4ol  mieil()arurxmoot0tptomfcias s um(vp;u4treoif3oatla   n o t s2xrxr3iu4lpt  nvs (fsDua( oot1tet if3tat s emnmp (0tlxrmr3ootfaDeln ols)s2xr(m3nodlmeelict s)a2urxronu0tetoif3tyslsDeluvsnt) etoio3ootfm r n s;( srurxo iy1lpt mnvtltf 2urx  ;u4tleo octytls elu o;t4tlxrio3ta1omt li ol(  rtrir iudlm emivi sf Drm(  nt1aleoiocildlsDra(mo u) eeomr3iydla rau i;t) exoim nydoltelfvs ( srrmur nu1altn oeiatfmDrm(mp;t)arxnxocoytlp e nes s)s2to(o oydal  livsas) 2rrum oo1olt ifeildlm2ulu s;()aetrmfcoydfmte u ilt) etoxo iu1lleemivs s a2rrum nu4oet ioctadlm2ulnvo t)teeoxf3io1fm  li ols) etr(r3oodll e ieia(f 2rr( p;u1aetoifetatlm2em(mpnt)trxoxo3oydoptelues;s)t2xmio3ny4om e iesltf rtm( pnt0tptomo3tydfaDumump;t0aeeoxo3tatopD au i () euoirpio4ap n ictl(farumum ou0tle  ieilsls ua(vpnt0tetnif3iadlpDe uvs;()sexoio3oudapen fesl(fsDrm( p;t1olxn iciysfm2ran p (0 rtomociytlaDr i slt0t2to(opny1lpt lnvs t) 2uru pnt0alx ioetadfm emnvpn(4 ltnmr3tytfmD lu s t)truoir nudlpeemfcs s aDrmx  ou4alt  ieiltfmDrl(msn(4trtnif iotomD anvs s0 2ur(m3iy4al nmivtas  rtaxmono4alto ociasla2el( s;u0 lxoiociatop ran ols)setmxmpnu1lp  mnvil( srtrxmpot0texoifciyt s2ul(msn()alxnxrctotoateaues t s2xoxo3iu4ap elietat s2umurpno1ale  feilt sDeluvs u4teeoxf iytlpD au ols s2uo(rpno4lpee nvi t  rrmxrpnt0ole mfeiaslm2rmump;u)altnxociotlm  lneol(0seum(o3oodamee fcsatfartm( pnt0oex iocildfsDrln s ()aeerio3iatfatraneo;t seumxo3oudll n fviat  rraxr no0ape ioeiydfm ea( s (4 reniocoadfa  lu i;s  exmxrpiydape mfetas) 2umxm oo0tlen f3iyd a eanvp;(0tleoxr3io1oaDean sl( tetr(m ou4llen ieia(  2umxr nt4apenio3tlt mDea( s;u) renircoo1lmDeluvs;s) 2xmxr iodalenlnvtas srrm( p;t1oeeniicild mDulums t0 renxo oo1op  lnvs s) rxriopiudlpte ivt sfaDrax  ;t4oleomoetyd s uau p () renxf totoaD au sl(0teto(rpoydam emfct s)sDrrxmont1aex ioeiltfm2rmumo;t)altnmf ootfpD  ueils)s2xoxopny4olee ivs (f rtmx p;t0olxoifetld a umu o u)aexomf3tytlptraivo;()s2umxr3iu4ll n fciat)a2um(m oo1aexomo3tldfm2rmnmpn()artnxrcoydom eaues s0t2xoiopny1lme lncsas aDum(m nt1aetoioeias s ul(mp;()aexoir3oy1la r n i;t trxoimpnodol e fcsa()a2taum no4tlen fctldlmDrlnmsnu) renioctotlatranvi;t0 rtoir3oudlme lfcsl() 2ua(rpou4tex  f3tatfm ulnmo;(4tlxnxfctadfpDeau s;t) rumxm3oudom n ncs tfaDta(r ou0alen fciatfm2rluvp t0trermrcoodfptrln il()s2xoxm oy4apen ncilt)aruru  no4teenif3ilsfs ea(vp;t0aeermr3oy1fmt aneo () rxrim nydamenmiei s)arururoou4olxn iciatfmDrm(vs (0tlxrxr3ia1fpDr i s s) rur(r io4apte icsasfsDtmumo;o0opeomociytfs2el(vo;u4tetoxrcoydfm rlu i ()t2tmxopou1opee nviasfsDtmxrooo1oeeniicild s2ulumon(0 rtnxo3tadlate ivo;s  rum(r3oy4ol nmivsasfsDtr(m ou4altoiietydlmDrlu o;(4trxnxociydoa r n o;t0 rumio ou1ll  lfcsa() 2rm(rpoo1tpxnmieilsfa2rluvsnu4 lerxf3oatfp rluvi ( seur(o3nu1lp elnvtat)a2rrurono0ope  o3tydfaDeaums;t0 rxrmo ty1latrai i s0srto(m3oy4altemnvsat)srurx  nt1tlenmo3tatlaDuau p;u) renxrcoatlp rai s;t)sexoio3iu1opt mfcsa(fs2taxrp;u1apxnmf3iysfa2um(vo (0 rxrmfctytopDelieo;t) rxmim nu4op n ics t a2urx pou0tlt iocild sDua(ms;u4 rxomrcoa1lat  ieo;( t2urim iu4optn fvias  2ur(mpot1ale mictadls elnvo (0 rxrxr3iotfateln ol(  etr(m nydlpen fes () rrmumono4tlx  ieiaslsDulnvs ()tlxrxrctytfa r uvo;t)srto(r nudaleelict ( aDur(mpnt1tptn fctas m rlnvp;u0treomr3ia1om 
\ No newline at end of file
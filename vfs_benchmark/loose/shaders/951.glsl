@@ -0,0 +1 @@
+n s ( trto(m3iodapenlfvi ( arra(ronu1oltoii3tys a uln s t0tltrmo oo1lat  ues (0 etm(rpny1om emfvi (faDrruronu1olenii3tytls2uan p (0 lxomfctydlatraieils)t2tmxo io4ll  mnetls  rrruroou1aetniiciytls2ranvs u4artoxf3iodomt lu s;( sexo(m oudlm elnet ()s2umur ;t1aex moetatlm2elnvo (4aexrif3tytfmt  u i ()teto(mpiu1ome lieiltfsDurum nu1altniiciat m2elums;()arenxr3ootop e neil(0 exrxr3ou4op nlfet s arrmumpnu4apeomf3tlslmDeauvo () rxomf iytfp  lnei s0setm(o iu1ap emnvsas)arrm(mont1tlto f3ils a um(vs u4 renir3ootfaDrln s (  2umimpnudomee ietlsf Drm(mo;t1oex miciyslm rlnmo;(0tetoxf3to1la  aiei;()s2uoir3iudlpeemnvtl(  rum(  ;o1alx iociat aDean s;t0aetrioctodoaDeli s;s0trxmxopno4olenmieta()sDum(mo;t1teeo fetadlm2ul(mo;(4arenmo3oo1lpt lneils)trxmiopoo1olen icilsf 2umxmp;u0oetnmf3ild a ulnvs;u4texoxf3io1fm  aneo t s2xo(r nudaleelfet ( arua( onu4texo f3iadlm2umn o u0arxrxf3oy1fpDraies;t)t2xoimpnu4aptelncsltfsrtrxmpnu0apt mfeiltlm2elu o;(0aeeoxo3totom r nei;s)setrxrpoy4ap   fctlt)a2ra( ont0olxo ieiadlaDumump;t4 eenmfcto1lpteauei s) 2xoir3iu1al nlnvi sfs2ua( pno4oet mo3iydfa2rl(vpn(0trtoio oydlpt  u ols t2toirpiu4lm  lnvsas  2urur ou1optn octasls2uln s;(4tltnxrcoodopDe n o;(0 2xrxr3ny4olt mfeia()s2trxm nu1aexomf3iyd sDel(mont0tlxoxociodoaD au s ( srxo(opoo1lmt liesltfsDtrumono1aeeoiiciytfmDem( pn(4alenmfcoatfaDelnvslt0s2umio3iu1lmeemncs () rumurpnt0texn iciys m rl( s;u4 leoirctatoaDelu s t0tetoxm3iu4lm nmies s aDtrxmpnt1aetn fciat s2rlnmp;t4 eenxo3io1lpD lu s;t trxmirpiodamtemfcs tfs2ua(  ;u4alto o3tls sDeln p t)arxrxr3oy1fm e uvs t0sexriopiu4ome mfviat a2tau  ot0tetoifeiytla eluvo;(4 ltoifcia1op raivslt srurxr io1alenmivil(faDtaxr nt1aex mociltla2emnms;t)tlxrmr3ta1op eluvs;t setmxo3oydal elictlsf 2taxrpnu0aptoio3iatfm umnvpn()aeeoxo ia1fmDrauvsl() 2um(r3oudolt  neiat a2raxr ;u4tpenmfciys s em(vp;u)arxomo3iodlmtrauvs;s s2toxo3nydamenliet t a2rmumpou1oeen o3tysfa rlumpnt4 lerif3tatlat aneil()trxmxrpou4omtnmnvt ()srrrum ou1olxomieiad s2uln p;u0artnxo ty1omDrau i t  2xr(mpiu1lltnlfviat)s2umuronu4alto oeils sDuan o u0tetrmfcoadfmt aies;t t2xr(r3iu4omeelnet tfaDrr(mpou1opx io3iyt a2rl(vonu)texnxocoodom r uvo ( sexo(rpou1amte ncta(f rra(r ;u4alxoiiciltlsDum( p;t4tlxnif oodfmtrli o;s0t2tmim3nydlpeemnesat a2rr(  no1tle  fciatls um(vpnu4aetrmr totfpt  n ols0 rtmim oydomtnlfesat) Dtru  oo0ale ifciad s el(vonu0 renmf3oadom  ai il( s2urxm io1olte fvi t srtruronu0opxnioeiydfs uanmo ()aeenmr3tatfaDrai s t)s2ur(o no4om elncia( sDraur ;o4alxn feiysfs ulu on(4 lxomo3iytop  anvo (0t2toxmpno1alenmnciasfsDua(mp;u1teeomfcilsla uluvs () ltnxfcootfa  aieo;t tetrxo3iy4lpen nci t)sDrr(r ot1alt iocias s rmnvo;u) lxrmr3oa1fmD  neil(  exmio ou4op  micias) Dur(roou4optnmieias s uau p;u)trtnxociotfatraies (0 exmirpiy4lpenlfct ( aDuaxmo;t4tpenmf3iaslm2umnvpnt0alxrifcoa1opte i s;t srum(m iudap nmnes tf 2tmxrp;u4apxomiciltfsDea(mo;(0tleoio3oatoaD au i t0 exmxo3oodom   nvias  Dra(rp;t4tptoifetys m2rm( o t) etoxo oodfmteanvi;s) 2tm(o3io1omee fvs t) Drmx onu0texo iciltls ua(vo;u4tltnir tytopDrlieo;() rxo(rpoudll elncs t)sDtaxm nu4tpxoii3iasls rm(msnt)arenmr3todfa rln s;(0sruoim3no4olt micil( aDtr( p;o0tpe  f3iyt a2eanvs t0tltrxr3totfm e u ilt0 2xoir iu1apenmnvslsfsrtmurpou0apxo fciat aDelums u0texomf ta1opDe uei t) rto(o3oy1omeemnviatf rra(mpot1oee if3iyt m2ean s;t)aeeomfcty1omtranesls)trum(m3nu4amt lfeilt  rraum ot4aptnmo3tyslm2ra(vp t4aleriocoo1omDeli o;(0trtmxo3oudapeemfvsl()srrm(mo;t0oexomietysfa2ul(vs;t0trerxo3oytoptrauesl(0truoxm3ou1olee fes (faDrmxm nu4texo ieiaslaDuan onu4tlenmf ia1opDrlies t0 eurxmpiu4ale mnvsa(farumump;o4oetoioeiytlm rl( p u0trtnxf oydfm  auei;s0t2umxo3oudal n nct (f Drmurpno0tpxnifciadfm2rmn snt)artnmr3oo1la eln s;s0tetoiopoudaltnmiesas)srurxronu4apxnmieiadlm ua( pnu0trxoir3oy1lmt  i o;()teur(o oo4lltnmfvs s sDtaump;u0opxomi3iad a eanmp;u4 eermocio1laD lneil()srxo(o3oudamtnmfcsat  rta(mo;t4aet ioctyt a umuvo (4 eermrciodlaD  ueo;() rtmxr3no4amtnmfcsasfsDuaur nt4aetn iciyt m umn p;(4tltnmoctatfatr uesls) rxo(opnu4amen fvsas sDur(moou0aptoifcild mDelumo;(0tetrmf ia1fmt  ieo t  exo(o no4lle licsat sDtaxroot1oleoio3iytlsDumu s () rxnif3totoa rai ils)teumim3iu4open iesa( a2rr(  ;t1oltnmo3tas m ea(vp;u4 ltnircto1fm eai o s0 exrir3ny1omt lnvi s a2taur oo1olxomfeild a umuvsn()tetnio3io1fatr nvslt0seuriopny1op e nvsl() rua(rpnt1tlen o3tatlmDrmu p (0 leoxf todom rliei (  2urir ou4lltn fcslt aDua(  ;u0oltnmictlslaDuanvpn(4 exrio tatoaDeaivolt0seumir no1alen netltf rumxronu4opx mfetydfm2um(mp t) etnxo to1faD anesl(  etoir3oydamt mictas)srtmum oo4aexomoctlsfmDelnms (0aleoxf3oa1om rln ols0trxr(r3oudam elfeils) ruauroou4tetn ocilsfa ea(mp u0 reoir ootfateaieo;() etmxmpoo4lltn fcs ( aruru  ;u4tlen fciyd sDrlums u)aexrmo to1opt luei;(0trxmxrpiu1lp  lneia() rtm(rp;o1altoiietytfs uaump u) rerxr3tatoptr ivolt)seum(o oo4lp n nctat  Dtmuro;o1tleo ociad mDrmn onu)altrmo3iy1fpDr ivi s0s2xmirpny4lp nmncs t)aDtmxrp;u0alxnmicildlm em(ms t)alxnir oodlp ean o;s0texm(opoo1ol nmnei t) Dumuro;u1aleoiietydlmDrauvpnt0 lenmf3iy1om elneslt0truriopiodop   fetas) rtmurp;o4tlx  fctad sDean p;t)trerxr oatlpDr ieo (0t2umir3iudlm  lnet ()sDrr(r no0ale  fciyd a ulu s;t4 lermf oydfpt auesls) etm(r io1am nmncia( aDrr( p;t4tlenmieiydlaDulu p;u) reoxo3iatfa eanes (  exm(m oo4lmtnlict t) 2taum nt0aetoifeiat m2rauvont) rxrmoctadfa   ivi t  exmxo nydol nmfet ( aDurxmpnt4tptomi3tad a2ua( o;(0 rtomo ty1fmD  i slt0teuoxrpoydop  lfes s aDurumpnu4olen i3tydlsDemu p (4 lerxr oy1fmDeauvo;t0setrimpoo4llt  fcta()srrr(ronu0ale ioeiydfaDem(msn() leoif3oa1fpDeln i;s srum(o3oydlme lfei sfartmum ;t0aexnioeiltfm2emuvs;(4 exrirctotlpD  n s;(0 2xoxr oy4alt  nciltfarrr(rpnu1tle if3iltlm rmnvp u4 rtomo3iy1oaDrau o t0 rurim io4al emnetat srtaumont4tpto i3tytlmDumn s t)trtoxr tytfa  lnvs (0teum(rpou1amee ivi tf rrrxmonu0oleo i3iyd a2rau p;(0arenmr tytfpt  neslt s2tr(o3iy4am  mies (  2tmumoot0oeeomfctat aDuan p;(4 eeoio3totoatraues;t)seuo(m3ou1altelnciatfa2taxm no0tlt ifciadls ua(vont0 renxrcia1fmte nvsl( sexoirpoy4om emfvsls)arrru o;t0teeomieiad s2el( p t0 exrxrcoadoatrln s;s0 euoim nu1apen fvias)aDua(r ou1tex miciyslaDel(ms;t0artnmf3iytoat anvs;t teurir3ny4am nlfvtl(fsDra(mont1oexnifetyt sDulnmp;(0trerxr ia1laD luvi s) etm(o3iy1ale liet s  ruaurp;o4aexnii3ilsfs2umn s t0arxnmf3to1fm  ln i;(0s2uo(opnu4omtnmncta(f Duau p;o1tpen i3tadla rmu s u)arxoxfctadoat  ivslt)trtr(o3no1ol  mivs () rrm(  nt4tpeomi3tldfs em( p t0tlerxr tatfa eluvs s0t2um(mpnu4lpenmfvtasf 2urxr oo1tltoif3iytfmDuluvsn(4areomr3oadfmtrlivs;t)srtr(r3iy1lltemfesas aDuaurpno0alt mo3iyt m2rlu o ()altomo3tadlaDrlueo (0 exr(opou4lpt mnvs () Dtrx onu1tlxo f3iadlsDrau s t0alxnio3io1oa raneo;(  2umxmpiy4am n icil( srta( onu4opto fciytfa2ea( s;u4texomo3totlaD aneo t0 2umxo3io1lle  ivtls  Duaxr ot0tltn fetlsls2ul(vp u)trxoio3oydlmtrluei;(0 exoir3iu1omeelnci ( srtmx p;u1altnioeiysfa umnvpn(4arxomo oydoa  anvils  2xmxr ny1olen ici s)sDtrumono4aptnmictldls elnmpnt)teenio ootoptelnvol(0setr(mpoodop elicils) 2raumo;o0olxn o3iasls rl(mont0artomfctadlpte uvo t tetr(rpnudalenmfei t) Drmx pnt0texomo3ildlsDeluvon()aeenxr3ty1fm r nvo (0 2tm(r3iy4llenlietasfsDtru  no1oltnmoetydfa2um( s (4trtoxf oydfmD  i ol(0 rumxrpio1ol n iviat a2rmur oo4aee io3tltfm rl( p;(0alxnmo3oodlmDelnvils0 2trio3ou4omeelfvias)sDuax o;t4opx if3iatfmDua( sn()trxnir3tytopD lu i t)t2tmimpio4op emieiltfaruaumooo0apx  f3tyd aDum(mon(0 lxrxf3iatfmD luvs s t2tmxopno1om nlieilsfarumurpot0opx io3iasla rmu o;()alxoircia1laDeau s;s seuoxr3no4lle  nesasfa2rr(moou1texniietltlmDean s (4tltnxr3iy1lateluei s0srumxo nu4ameeliei sfa2rrxmp;o1oexomoeiysla2rlu s;t) etoxrctytoa   u i;(0trtoio no4lpenlfesls srtmxrono1oex ioeiat a2ua(mpnt) lerxf ia1lm eln i;t seuoirpno1lmt lfctlt srraum ;o0olx mo3tad m2rm( p;u) ltoxrcoatfaDe ivs;t0texoxr iu4llte fcsls)aDtmxrono1teen ietldla eauvp;t0aeenir3oatfm eauei;s) 2uoxopoydlmt mnvs ()aDtr(r ou1apen ieiydfs2elnmpnu) rxrxfcoydoatrlivil()texo(m oy4aleemnvsl( arua( pot4aetomfeilt m elumpnt0areoxr3iadopte n il(0 rtoxrpiy4alee nvtasf rtm(ronu0apxnmoctls aDua( o;t0 ltnio ty1fm eauei (0t2umio oodll emfeta(  rtmu pnu0opt mfeildla2eau o u0tlenifcoa1omte nei;t) rxmxopnudolt  nvsas artr(m nu0apt mfcils a2ran ont4 rxnxf3iy1oat lnei;()srxr(opiy1ope lfcsa(fs2rr( p;t1oltnmiciatlaDrmnvs u4aexnif3todoa e iei;s)seuoxm ny4llen nctlt aDtaxm ;o4tet mfeiadlsDuau pn(4 lenmfciodoa   i o (0 2um(o no4omen nci s)artau p;t0olxo ietasfs2rauvp (4 rxoxr ta1lptelieolt0s2xmir3oo4lp n ivtlsfarur(r oo1alx if3ilt s ra(vo u4 lenio totla   iei ( s2um(opio1ol   nesl(  rtr( pno4opxomfeiydlsDrmnms;t0 lenif3iadfpDrau ilt)texmio iu4opte nes (fsDtm(ro;o4oltnmf3iltla elnmp;t0trxrifctodlm rau i;s teuo(o nu1ll  lnvi t)a2rauronu4aet ioeiysfs ran pn(4aetrifciatlaDr ieo s)t2xoirpou4am emici tf rtmxm ou4tpx  feiydfa umnmp;t) etnxociydoatrluvo;s) etoxmpio4ll emnesa()a2uaumo;u0opxo ociys mDea(vs t)texoifciytla rlivils0srtmimpiodapenliesl() Drmuroou0tptoiicildlm ra( o;t)tlxrif3oy1lmteauvi s)sexrxr iu4op n feslt)s2rmxmp;o0aexo ieilslmDem(mo (4tltomo3tytfpDrliei t0 2xrimpoydlpenmivtlsf rumxm ;o0oleo o3ilsfs2em(mon(0altnxfcoatfm  auvolt0 2xm(o3nu4ope liesa() 2uax  ;u0ole mociytls rl( sn(4 ltnmf3tadlmtrai i;(0t2uo(opny1ale lneta()a2tm(rp;u0aee  i3tat m rmumo t4tltrmf3iy1lmteanvo ( seumim iy1omeemfeias a2ta(  nt4alx io3iad s2rl(msnt)aexnxo3iy1lptean i t t2urxm ou4ole miet s)sDtrumont0apen o3iadfa ua( p;t0 rxnxrciy1oatr ues t0sexoir iy4lpeemfesat)sDumxr ou4tetomf3ias m ranms u) rermo3ty1oaD luvs s0 etoir3iodll n fvslt sDuau  oo4ole mo3tyt s2umn s;u4arxomf3ta1laD  nvs;(0s2to(m nu1lmtnmnvia(faruaxrp;o1opxniociydlaDumnvp;t)aexrmf3oydlatraivi s0seurxm3no4lmtnlfes sf 2ur( o;t0oex moetadla2em(mo;u4 lenmoctatfa   ieslt)sruo(m3oudoltemnvi t) 2tmum ot1oet  ocils sDul(vp (4aetoxo3iatoaDeluvsl(0texr(r3oo4lmee fcs s sDur(m ;u0tpx io3iasfs2rl( o (4 exrxo iytoa  auvi;s trtr(m iu4lp emicils  rumumo;t0alxomociatla eanmo u)altnxr todom e nvo;s)seto(rpny4apeelics ( s2uau ont0olx ifeiltfa2rmump;t4aexnmf3io1fp  li s;s0 2xrxo3oydol nmfvi () rtaxr ;o0oet  oeilsfa ean s t)alerxrcty1fmDr n o (0seurio3iu4altnmiesas  rumuro;u4altnifciltlaDrmuvsn()altoio ootoptrai s s)t2um(o oo4ap n ieiat s2ta(ro;o4tetomocias m2el(mp () etnxfcio1fmte ueil(  2tm(rpiodolt mfcsas)a2tmu  no4tex  i3tadlmDrluvo u0aexnmrciotop eauvilt  etrxo3nu1ol  miei ( a2ra(  nt1alx  ieilsls rmumo t)artrmfciadlmDraues;t sexrxm3ny4ol emieiat srumurp;o0tpto ociatfsDemn ont0teenxr oatoaDrlnei t)srxrim3iu1optemfet sf 2urxroou4olto ictldfm2rau snt0aetoxr iotlmtran i;t0 2xm(r nudomenmieslt artmur nu0aeto feildla uln s (4 rtrio ty1lm r ieo t  eumir io1amtemfct () Drmxrpot1tle ioetls s2rmn o (4 eenmrcootoaD anvi s)seum(r ny1openlfeia( artrum ;o4opt mfeilsla emn on()tltrif tytfpDrlu sls0s2umxr3ny1ame mfct sf Drr(m no4opxoiictltls ea( o;t4teeoxrctytfpDraivs t) 2urxr3io4alenmivi sfsrtmu pot0tpxniieildlm2ul(mpn() eenmoctatfaDeanvi;t) 2uoxm3iydop  lietl(  2uaump;u0oexn ictad s2rmumont4alenircoydfpD an o;s0 exrimpoydap e ivslt aruax oot1ole mfeiysla2ranmo t4tltnmf3oa1om rlivs s srtr(m iydal elfctatf Dta(rpoo4tex  ieilsfa rm(msn() eenxoctytfate nes;t) 2xriopnodal e fetlsfs2rr(ro;t1opxnmociydfmDem( p;u4alenxfctydlpDeau s s  rurxm3ou4lmt mneiasfa2umu pot0alenifcilt m2ulnmo;u4alermfctotfmDe n s;s setoxm ou1lle  fvtltf rtaxmoot4oee if3ildfs2emnmo;(0altrmociodomtrlnvs;s s2to(r nodop elnvi sfa2rmx  ;t1alx mfctas m2elnvpnt4 lxnmf3io1lmDrlneilt s2xoxm3iydalen ivtls artaxmont0tleo oetltfm2ul(vp u0 etomf iodoaDrauvo;t t2urim3iudolenlnvsatfsrtaumpot4oltoif3iyd aDem(vo;u4trenmf iytom rlneo t)t2umxopno1openlnvslt  2ua( o;o0apx mo3tlslmDum(mon(4aeeoxo tatoatelies t0sexoio3io1lpeemncs (f Dtrur ou4oex if3iatls2umn on(4aetrio oadfaD  neo s0 rtm(r3nu4oltnmivilsf Dtm( oou0tpx ii3ild s rm(vpn()aeeoxrctotom rln s;t)s2toxm3oydlp nlfcsls srur(  oo0tpe mietysfmDrln o t0alenircoadlaDrau s t0t2trim3iydam nlncia(fa2um(rp;u1alenmi3tyd m rm( p;(4aeerirciodfmDranei;(  2tr(m oodaptnmieiltfs2tmu poo0aeeomf3tatfm rmu s t4arenxf3iatlpt luvi;(0tetrir3nodlptnlfvi s s2ta(r no4tltn ictlsfm ea(msnu0treomfciy1oaDr ivilt)teurim3no4omtemfcil(  Drm(mooo4oleoifeilsfa2ua( snt)artoxr3iadoa ean sl( s2xr(m3nu4lpe mfvilsfsruaxrpnu4alxniociadls uan o t) eeoxo3ta1la  anvsls)s2umim oydalt  nes s artr(r ;t0opt ioetysla rauvp;t)aeenmfcoatfat lneo () 2xrio3io1ame lfcslsfs2umurpnu1aleo o3iatfa2eluvs;() etnmf3iytlmtrai i;(0trxm(m oy1llt mfvtls)s2urx pnt1tpxomi3tltls2rau on(4aexoif3iatfm ran i;(  etrxr3iodope micta()sDrru  ;t4openmiciys sDemnvp u0alermf oadlpteauvs;() 2ur(r ny1amee fvtlt)srtm( pnt4tlt mfetyslaDuanmpnu4arenio oadlpD livo t  exr(r3no1amen nesas  2trx  ;u0oexoioctas sDel( o () ltoxfciydfm   nvils t2to(o3nu1om nmfvi ( srum( oou1alt ifeiysfaDum( o;t0altoxf3ootfa  luvi t)srtr(r oy4ol n nes sfsDumuront1tlxnmo3iadfa ra(vo;u4tleoiociatlpDeluvi;t  eum(o no4op elicsltfsDuaxm nu1tex ioeiysls eauvo u)trxoxfcty1laDrlnvo;( t2um(o3nudlp n nvtl()aruau  no0tptnmfeiyslm2ra( p t) ltnir3iy1opt an i;(0t2trxo oodop elfci () rum(r no0tltoiiciydlm rlnmsn()trxrir3ootlp  ai o (0tetmxr3oodopenlfvtas)sDur(m nt1aptnmfctasfs2ean p u)alxoircoytfat aues t0 2xrimpoodalee fesa(fa2ua(mpnu0opeo ieiydls2ulnvs;t4tlxomf3ty1fmt anvi;() rxo(o3nodoltemfcsls)aDuaump;t0olx  fciys sDumumont) rermf tydlm e n s s)texm(r3oo1omeemnvs s srta(ronu1teenmf3tydls umu s t)aetomo3iadfmtrauvs s  2urim iu4altemnet () 2rrx ont4apen ieiaslsDrmuvo t0alxrir3iotomDr uei s0sexriopnu4apee fvilt a2uauro;o0tex  feilt a raump u0 reoxr3tadfaD  n o t)srtmxr ou1lm elfvia()srraurpnu1tlxo i3tltfa rm(vsnu0alxnmr ta1lpDr i s t0t2trim nudomtn nvils) 2tr(  oo0aexo fetls mDrauvo (0 reoxrctytlptean s;(0 exmimpou1am e ncs tfs2rmxmooo4oleoio3tydfmDuauvont) rtomr ta1faDeluei s)trtr(m3oy1lltn iet s) rraumooo4oetnio3iasfm rmums;t4arxomocoo1la r uvs;t t2tm(o io1lleelnciat)sDuaxr ou4alxnmfctlt s2rl(vont) ltnmociatfptelneils)sexo(o3oydom eliesa() rrau poo1tlxnmicilsla2ul(vpnu4artrxr iotoa elnvo;()srxrxm3ou4lmt  nesa(  2rmxr ;u4aeen f3ias mDrm(mo t)trtomr oy1om raneils)tetr(o iodoltn fetls a2tmumo;t4openif3iadlsDeau p t0altoircoy1lpt  iesl() 2xrxmpiu1lleemivtat  Duaxm ou0teenmi3iytls2ulnvont0aexrif iatlp eaies t0t2trxo oodop nmncs sfaDtrx  ;o4tetomociytfs2um(mp;(0arxoxr3iy1lmDr uvilt texmimpio1ol nmfciat  rum(r no1tptoio3iyslmDrmu on(0 rxoio3oa1latr uvil() etm(m3oydopt lfes ( artru  ot0oltn o3tytla2rau s (0texnio3oy1lm rln i s s2trio iu4om  lnct s a2tax o;t1aleoii3tatfaDrlnvs u4 lenifcoo1fp eaivo;s t2tr(m3oodapt lnci tfaDtr( p;o4aeto f3ild s ra(vo;(4arerxf3oadlpDrai sl(  2uoxo no4om  lfvtls aDra(mont4apeomi3ildfs2ean p;()aeeoxf oodfm   ivs;t)tetm(r oo4ome  nvsa()sDtmu  ;t4oeenmi3iltfs2uanvp;t0 rxomr iotfptelu ols) rxmxr nu4apeemicsl(f Dtmur ;t4oexnioeiat aDua(vo;u0trxomrctatfm ranes;t srto(o3no1lm  lnciltfsrrax o;t0tpenmiciyt mDeluvonu) reoirciytfaDr nvi s0teurxrpiydlpt  ivtas arra(  ;o1aexn fciyd m2raumon(4trerir oodop ranvi;s)texm(r oydol   ncia(  Dururoou1opxoiicias mDumnvs;(4altnmf3ia1omD anvo t0s2trim ou4opeelfvt tfaruax pot4opxo f3iasfa2emu pnt4 rxoifciydoaDelies;()srxmio nodlltn fet (faDrmxr ;o4aeeo ocilsls el(vs;t) rtrmo ia1lm  lueo t  rtm(r3nydlp elivias)a2tmxrpou4oeeo feiatfa ul(ms;u)trxomrcty1omtrlieslt t2urxopny4op emfct ( aDta( ooo4alxnifctadfs2ranmpnu4 exnirciadfm   uvi t0t2xmxm3io1aptelfesat s2raxmpnt4aet moetyd s2emn s t)artrmrciy1faDean s t)t2um(m oy4alen fcta( sDtaur oo4opxnioetls s elnms;(0 rxoircoy1fp  ai sls0tetoxmpoydalee fvsls  Dtr(moou1tee mf3iat a uan p (4 lxnmr oo1omt lu o;s)sexmim no1am emnvt (  2um( o;t1altoifeiytlm2um(mp u)texnifctodlpt  uvols) rtrir iodll e icslt)srrmxmono0oeenio3iytlsDua( o u0 rtoif ty1fp eaieol(0seuoir3oo1alenlfvsasfartrxm nt1ape ifctydfmDrmu on(0tltniocoa1op   ivslt0teurirpny4amtnmici t) 2urxmpnt4aeen o3tlsfa um(vs u0teerxf oy1la eln o ()t2trxmpou4lptemfvi t  rua(rpot1tpeoif3iyt s2rlnmpnt0aexoio oodlmD  uvi;( trtmim iudolee ivi tf 2trump;u4aptniieiad m uanvp;u) exnxf3io1fa  anvol(0srur(m ou4llee fvt t)a2rru  oo4opeoif3tldlm eauvp t0tltrmr3oa1oa rluei s)sexmxr3io4lleelfesatf Dumum ;o4tptn feilt m ul( snu0tlxnio3iytoa elivi;s0teto(r oy1lpenlfcslt sDtau pnt1tlt  iciatlm ua(ms;u4alenmf3ia1omt lnei;s)s2um(m io1llenmivt t)aDurxmpoo1aexoif3iltfa rlnms;(0tetnxf3ty1fpte uvolt0t2umxm3ny4alenmivs (fsDtrxrp;u0apeoif3iltfm uanvpnu0trermfctydfpt lueilt  etmxopnodome lictat)arumu ont0tet  f3tltfm rmn o (0aetoxf oytfpD aueslt srur(m ny4open fcs (fartrx  no1alto octysfm2eluvsnt0artomfcoo1lm e u ol()srto(o nydap n ivsasfsDurxm nu4aeeomociatla umu o;u4trenif oadlm rlu slt  2xm(m ny1ll nmnvia() rrmu ono4tpx  ictydfa2rlu on(4 rtrirctodlp   u s;t0trurxm3iudaptelietls) Dtm(moot1aet  oeils s2rl( s t4areoxf3oo1opDelues s  exoiopio1optelfcsasf 2rmuronu1tle iictad s rmumsn(4trtrio3totfmtraueolt0 2uoxm io1am n nct (f 2ururooo0aptnif3tys m emu s (4tlermo oa1omt ai s;(0teumxm no4lpenmnctas) Drr(moot0tle mf3iad mDrl(vs t0alenircoa1fptelivo;s) 2umim nudlmt lnvil(fa2rrx oou1tex ioeiasls2umnvsn(0tlxoifciatlateli i;s0 exrxo oudapte ics s) rraxm ou0tlxnif3tldfs ea(vsnt)alermfciodlatraues;(  2tmxm oodole lncsa( sDtr( p;o4tpe ioctytlaDuanmo u0aexrif3ootoaD luei () exrimpiu1alenlicil( srrrum ;t4aeen i3iasls2em( o;(4teenif3tytlmt  u i;s  rurxrpiydlpe lictat) Durx onu0alenifciytfs ulnms;(4alxnxf3iatop rln i s) rur(mpnydlptnmnvi t) 2umxm nt0tpe  feiaslsDel(vo;t4aexrif3totomtrlivi s)s2to(o3nudame miet ()sDrr(  ot0apx ifctat aDrl( o (4 lenmf3tadfmtrlu sl(0 etoir3oo1apenlnesa()sDtaxr nt0aexomfeiatfm2emn sn(0tlermf oytoaDeai slt s2toimpny1om n ieiat) Drau pot0oexn ietltfs2uau onu0 rxoxocio1oaDran i () rtrir oydol nmiciat)aDrrumo;o0tex mfetatfaDua(msn(0artrxfcia1fm rluei;t0s2xoirpiudll  miesl(fa2urx p;o4tle mfciyslmDuluvs (4tlerxociotom eaneslt0s2xm(o iu4op e icsasfs2rmumpnu1olx mf3tatlaDumu pnt) etnio iy1op raies t srum(r iydamtelicsat)sDta( o;t1tpt if3iltlaDrmnmpn()trxrmf iodop eluvol(0srto(o oo4lp nmfcsa(fs2um(rpnu0ole io3iltfa ulu o u)trtoxf3ty1om r nvs s) rtr(m3oydlptnmfcsas)sDur(  nu1oexn oeiytla umu s;u)altrxrctytla  an sl( sexr(mpnu1olenlneta( a2urx p;o0opt ifetat a rmnvo u)tetrircoa1fmDrlueo;(0srurir oy1omtelncsl(f 2ua( p;t4altniieiyt m ra(vpnu)tleomf3ty1oate uvils seuoim3iu4lm  lnvs (f rrrxmo;t0aet if3iat sDumn s t4 lxnmf3iotlaDe n i;s0 ruo(r nu1ap  mfvsas) rtmumo;o4aexniociltlsDrlu o u)aexoxr ty1omDran o s0trtoiopoodop emivtl(f 2raxrooo0tptomo3iad a rau o u) lerxrcoytfmt livols  rxrxrpnu1lmtemfcsl()a2rmxm ;o0oee mf3iasfs uluvs t)aexrio3iotoaDelu s;s t2xoim3oy4lpen ies (f 2tr(r ;u1oexo ictadlm eanmpn()tlenxo3tatomDe uvslt trtr(o no4olt liesatf Dtmxr ;o4tlxnmfetysfa2uln p;()tlxniocoa1lp ranes ( trumir3oodapen nesas)a2uaumo;u0aet moeiyt m el( on() exnxo3ta1opD  uvil(0tetrio3iudol e nctatf Duau  ;t0tpeomicias aDeau o;t0aexoxr tytfmDelues;()texoir3io1apeelici s srtaurpot0tetnif3taslm2umnmp;t4aeenxr3iydfatr n i;s0srtoio3no1lptn feil( sDurx  oo4tle moctlsfsDel(ms;(4trxomo iatfm e u o t0t2xoio nodapt mivtasfs2raxm ;t1opxomfciys s2ra(ms;t4aetnmo3oodlp elies (0trxmxopiodap nlfcsltfsDur( o;t0tpt moetydfs2uanmon(0 etoiocty1oa e nvo t  rumimpiy1am  mivtl(fsDua(  nt4tee moeiasfaDumn o (4aexoxf ootlptrai s;s0srtr(o3oy4amtelivsas) Durxrpot0opeomiciyt sDelumpnt0trenmr3iotop e ues;t0t2xoxopno4lle  fcsa(fs2uax p;u1apxn o3iad a2um( s u) rtrif3todfpD an s;(0 eurxmpiudlpeemivtat)a2urxrpoo4apen oeiyd sDea(ms;t4texnmo oy1om  an ils srxr(r oudlleemneiatf rtrxmoot4aexniieildfm uau pnt0 etoir3iytlpt  ieo s trtoimpnydal e ies (faDtm( onu4olen icildlmDuanms t)alermfcoytoa r neo s texoxr iu4amtemfvta( aDtm(mpoo4oleomfetlsls emu onu4tlxoxo3oytlmteluei;s0srurxo oodlm nlfcsat  Dtm(mp;o0opt io3ilsls rmums u4aetnxfctatopDrlnvilt) eurio3iu4opt mivs t  2ta(r ou4openio3tydlaDumn o;u)trtrio3ta1lmt an o t) eumxmpnu4om  mivsat a2rm(rpnu0alxnmi3ils a2ea(vonu0aetrmr3ia1latrln ol(0srxrir3iudlp n fvt t)a2tmu ooo4apxnmociyd sDeauvs u0aetoio to1omtelivils)t2xoimpny1op   nei t  rurxmpou1oexomi3tatfa2um(monu)alxrmf ootlaDelu olt)texrxmpou1ole micsls) Duaxr ;t4ale mfciyt m2rl( s;u4arxomocto1om eanvi t  2tm(opou1open fvilt)arrr(  oo0tpxn fciatlmDum(mo;t4 eenmf3ta1oa rlu i;(  eurimpoo4lpee netlt)s2ta(  ;u4oexn i3iltfa2rmnmon(0 exnxf3todlatrlnvo s) eurir3nu1lp elfvsas) rtau  ;t1ole if3tysla2rln s;u)altoir iatfm raieo s s2uoxo oudom nmietat)aDrau ono0aleo oetydla2umu snu)trenir3iotlmtrluvo;( tetoir iu1omenlfetl( s2tru  ot0aet if3ildlm rm( snu4tetnxf3totfmD lneslt0t2xrxmpoudlmtnlieia(  Duaxm nu0alxn ieiysfsDel(ms (4aetomf3iytopD au s (0 rxrxmpoo4apt  neias a2rrxmont0tet  oetadfm eaumo ()artoxrciydoptr ivs;t  2xrxm3nodomtelfvslt srrmu  ot4ole  o3iyslaDulums u4alenir oa1oaDr ivs;s t2xm(r3iu1ole  ivsltfarraxrpnt1tptoio3tasla uauvsnu4tleoir tydoptr i o;t t2urxr3ou4op nmfeia()sruaxrp;u0tlx  f3tytlsDem( p t0trtomocoadlpDeanvol()s2tmxmpiudamtn feiat) 2umurpnu4alt  feilt s2emnmon(4aexoio3oatfp eli i;(0 2to(r ou1olen fes ()sDrmumoou1ale  fciyd sDuln s u0 rermocty1fpDrlueolt0 rxmim oo1opeemicta(  ruaumpno4aex mociad m umu o u)teermfcoo1fmtrlnvi;s  euoio3ou4al elfet t) rtau pnu4tpxn octydfm2uaumpnu)texnio tadom  ln ol() 2urirpny4lptn nviltfsrum(mooo0aet  o3iadlm2um(vs;(4alenir3oatla rauvo s  exm(r oy1ap e netat) rum(mpnu4ape  ieiltlm ea( s t)tlxrifctatoptraues t0s2xoxr3nu4op nliesl(fsruaum ;t4opx mocild s2umnvs;t0 lxrxr3tadom e ivs t)trtoxo3io1lptnmivtlsf rtau  ot1tpto oeiytfa2ran p;t0 rxoio3totlpteai o t0srxm(o3no1opee nvs s aDtrxmooo1olt mfeiydla ul(vp;t0texoxr3todlmtelnvs;( trxo(r3iu1ol nmncils  Drrumooo4alxnmoeilsfm ulump;u)aetoifciadlatrlieols setoir3ny1al   nct t)a2tr( pou4tetn fetldfm el(vs t4alxrio tydomD lnei t)trurxo3ny4aleemfcsls)srtrur no4tleniiciyslm2rmnmon(4 rerxrcoa1lp r ues s0 2tm(m iodlpt livtl( a2um(moou0olen fciatfa2umnvo;() etnmo iatlaD lieolt srumim3nu4ap nmfcia(fs2uaurpou0tleomieils a2eln s ()trxrmr oo1om eln s s)teuoim oy1ap  mics tfa2rmx p;u1olt  ictydfs2rmuvp u4aeenxociodlaDeluei;s t2trxmpio1apt mneiltfarra( o;o1oeeoifciat s rl( p ()teeoif ta1fm elivslt t2xoxm3oy1llte icsl(fa2raump;o1ale  oeias a ra( o;t4 ltnioctatlmDrlnvs ( srtoxr iy1ole lfvt tf 2trxr oo1tlxnmo3iatls2raums;t0 etnirctotla e ieo s setrirpnydaltemfvi ()s2raur nu4aexomictltfm el(mont)arenxr io1fpDeanei;s0srxmir oodaptn nes t aDta(r no1aexo ieiat a2rlnvpnu0teerir iy1fmD  neo s) 2uo(r3no1lmee iesl( aDtrxrpnu1apen f3iydfa emu on(0 rxrxo tadom e nvs;(0 2xm(o no1lm  mfvia( sDtmxmp;u0aetnioeiydfaDel( p;t)aexrmr3todoptraues;t teur(r3nydopte fvi s)s2urum nt1opx mictls sDrau s;()treoio3totoaDelnvi t0 2to(m3nu1aptnmfvta( aDtr(mpnt4texnmf3iltlmDrmnvo;(4tetrmfcoa1laDrlies;()texoxm3ou4al e nesl()a2rru p;o1apxn f3iysls2ea(von(4trtrifciytfa   nes s0 rxoxm iy4lmt  nvil(fs2taurp;o4oltnmoctld a2eanvp;(4arermf iotlpDraiei;(  rxo(o3nodlmen ivt t)a2uaxm ;t1aeenifciat a eauvs u0 leoif3oodfm r nvo (0t2umxmpiudlptn fvil()srtax pnt0oexomf3tld aDul( s;()alerxf3oytfaD lnes (0 etmxrpiy4lm elfctat srtauronu4tpxomfciysfsDrmn o (0alxrmr ta1opt  uei (0tetoxm oy1op nmivil(f 2tmuro;u1teeoiiciysfa em(msnt)teenirciytoaDr nvils)s2xr(r iy4lmtemfeia()s2uauronu0oltniieild aDua(mon(4teenxrctydlmDean sls t2trim oo4aptnmnvi s) 2tr(mp;t1tet mfeiltlsDrmnvpnu0alxrmr3oydlp r i s;s trxmim3oydamt  ieias  Dtrx pou1apeomiciydfa2raumo (4 lenxocto1fm  li s;s)tetmim3nydom nmfvsas)sDraumoou1alxn oeilslaDrm( s;(0 renio3iodopt aneo;() rto(o iudaleelietls)sDrmurpoo1apxomiciadla rau ont) eeomo ootla raivs t  2xmxo oydom e fvs s)sDrrxrp;u4tlx ii3iltfa2ul( pn(4 rxnmocto1fmt livs s)srtm(mpou1ap nmnvs ()sDrmxroot1opto icilsla2em(mo;u)tltoxr3iydlpt li o t)trtmir3iy1lp   ncilt aDtrxm oo1oexo f3iasfaDem(mp u4tetnir3iatomte i o;(0t2tr(r3nudopen fvtls)a2ra( pno4tle mfctys a um(vs;u0treoxr3to1omtrlu i t)srur(m nudal   fesltf 2uau  ou4olxoioetltfa2eauvs u)aeerxfcty1fm  auvi;t0 2to(rpny1apt lnesas)sDra(r ;t4openii3tlslsDum(mo;t0treoxfcoodop rlivslt s2tr(m iy1lpen ivsat sDta( oou4aexniiciad a rln p (4aeenif iotfa elnes t t2urxr oydapeemiei () 2ua(  ot4aptnmf3tyt m rmnmsnt4arxrmo3to1lmDeaneo t0 2xr(m iy1lme  ivsasfarraxrp;u1aexnif3ias a rm(mo t0aexrio3ootfa r n o;s  2toir3no4apeemnvtl()s2umu ono4aet ioetasfaDuauvs;u0teeomrciadlaD lnvo ( srumxr3iudap  lnvs s) rtr(m ot0tpt  oeiydla ran ont4texnmr oydlpDrluvilt  rtrxr nu4apenmivias  rta(rpot0tetnmictls m umu p t0aeenmr3iatla rau i s0t2toxo nodoptemfes tfsDumu  nt1tleo feildlm elnms;u0tlxnircoa1fpD an i;t trtrxopou1opeeliet ( aDtaump;t0tltnmo3ilsfmDul( o t) rxrio3ia1latrlueols)teurxopoy4lpe lneiat  rtax pno1aetn iciysfs2rm(msnu)artrircto1fptrlnvo ()texoxmpno4aptnlfvtat)s2tr( pou1oexnif3iltfs2ra(mpnt4tlerxo3oatfa  luvo;s) 2toiopno1ol nmneia(f 2uax pot1optnio3tysfm uau p;()tlxnmrciydoat lieo;t srxm(rpnu4al  lics t)arua( poo1oexnmoeiadfm2em(vs;t)tlerir3iy1fmDeluvsl(0t2tmimpou1lp   ieilsf 2rrxm ot0alxnmoeilt m2el(mpnt4tltoxr3iydoaD  nvol(  exmxm3iu4optemncs ()aruaxmono4alen ieilsla2ul(monu0alxnxf iytlm   nvs;t trtrxm nu4amt mfvsltf rrrx pou4texoiieiatlsDua(vo u) rxnif3oy1oa   n o;s)tetrirpio4aptemfesat  2umxro;o1ale ifetytls2em(mp;t0aeenmo3oydlp rlieslt0s2urimpoo1op e icia()a2raumo;o4aleoiietaslm2elnvo t)aetoir3to1opDe nei s trtrxmpny4ll elict s) rtrxr ;t0alxnioctatfmDeanmo u4arxnxo3ta1faDr ieo s0t2tm(r no1lm  mict ( a2um(rpou4oex ioeilt aDea(vo;t0trenxf3iatlp raies s)s2toxmpoydaptelivs ()sDtr(  oo4oeen o3tld a2ranmonu0trtoircoa1opD aieo;s t2tr(r no1ole  nvta()aDra(m ;t1tleo octydfsDrl(vp;(4alerxrctotlatrlnvs t seuoim3oodlltnlivil( srrrxmpou4tpenioeiyd aDea( s u4aeenxf3iodfateln i s) eur(r oo4amt mnct ( aDurump;o0tlenio3iytfm2umuvo u4 ltnmo iy1faD aueilt0tetr(r iy4omenmfet sf rtmum nu0alt  ieiytfs uauvo;u)artoiocoodfmtrlueo t0t2tmirpnodlm   nei s srtaur ;t0olx miciasfmDea(msnt0 etnio3oatfp rlueo ()srxrxr3oo1om nmietl(farua(m nt1aetn ocilslmDemn s u0alenmo3todoaDeliei;s)t2xoxo iy4lltnlnes sfsDrrxmp;u4oex io3iydlmDua( pnu4tltomf3to1laDr u sl(0texoio3iu1omeelnvi (faDurxrp;t1tpeoif3tytfaDrau p u)trtnmr tydoaDr u ilt)t2xo(rpoo1ap n ictas srtm( ooo1tee mf3iasfa ean p;u0aeerio oa1oa rlivo;s texo(r3nydlme lfvs s s2tm( ono4tptn ieiad s2um(von(0alenxr ty1oaDeaueols0trumirpnu1ale  icil(faDtr(rp;t1ole if3iasla eanvo (4trtnmr iadfp rli s;t0s2tmiopio4omenlnvt sfaDumu  ;t4tpxnif3iydfa rauvp u4tetoir io1la  anvi t)srto(mpnodlm elfesat  Drm( ont1oetoiociyt m ul(vs t) reoxfcoatomDe u o;(0 rxmxm io4lp nliciltfsrrm(mpoo4ale mo3iysfm umu s u)arerio to1lm eau ilt0sruoir3oydlltn iesatf 2ra( ont1tpe iieils m eau p u0tleoxrcty1fate n o;t)trum(r nydope  fcs sfaDumur no1tex ifeiysfsDuln p t)aetrmr3iodoa r ueo;t0srtrimpio1om emfes tfsruau  nu1aee mictasfa umu onu0 lxomr oodfm rauvil(0srtmxr no1oleelfvsl(faDra(  ;t1openif3tas mDrmuvo;t4 eenmr3oydfaD aivi;t0 etoxr3iy4lp   nesls srtm( o;o1olt io3iat m2elnms;t0tetrxr iy1fmD lnei s0s2um(m ou4ole  net ( srrrur oo1tlx  fciadls rlnmpnt0aexnmf3tydlp   nvs s0t2uoxo nydomtnmieia()arumumont4apxniicilsfsDrm( p;() exnmo3oa1lmDelieils trtrxm no1llenlnet tfs2ta(m nt1alx mieiadlm um( snt0aexrmr3oy1oaDr n o (  rtoim oodom  mivsa()a2tmx onu4optnmo3iatlaDean o t4 lenxr3oytopD lnvilt tetm(o3oudllt lfetls)s2ua( p;o4optn oeiatlsDuan p;u4treomrcio1fmtelnes s)teto(o3nudome mieslsfa2umumo;u4tpx ifeiytfaDrm(vs ()tltrmfcio1fmDelueo t)sruo(o3oodomt mnvt (fa2urxmo;u0aee  o3iyt sDel(ms u)aeenmo3oatfa  lieilt0trxm(r3io1omt lncsa() Dtmumpnt1tlxnii3tysfaDuanvp;u) rtnxrciytomDr nvo;()sexoxo iodap e iei s)s2raur nu1tetnmociydlaDemn snt)arerir3todlmt au s;s tetrxm oy1apenlietl() rua(mpnt1texn f3iyt a elu pnu4areoxociydlp rlivo t0srxoxm oo4omte nesatf rua( ooo0tltn f3iydls uan o u4 lerxr to1lpt lnvs s0s2urxo3iu1altemneiatfa2trx pno1apx io3ildfa uln o t4 lenxf3ia1fp eli i;() 2xrio iydopt  ivtls)aDumxmpou4oltnmocilt a2ranvs;u)trenio io1fmD lnvols0t2uoxm3iy1apen ivsat arrmur ;o1apxnifeildfa2el( o;t)tltoio3to1oaD aivi ( setrio3iydlmtemfesa()sDururont1aexoiiciatlm2ran o;u4trxnmr ootfm eai i;s0texmxm3oy1op nmfvt ()a2rrxr nt1tlxn feildfmDeau snu)trtrmocoytopteln i t setrir3oodap elivs (  2trx p;t1oee  fciatfm2emuvp;() lxrifciy1lptean il( seurir3io1lpee fei s)artmxmpoo1texomfcild aDua( p (0arerirciodlp ranvol(0 rxm(o ny4lmeemnctas) 2umx pou0opxo o3tatfa elu o;t4tlxnxo ia1op elneo;(0teumirpnydapte nctl()sDtrumont1oleomietad s uau ont)tltrxrctydlptr nvslt0srxmxr3oydlpte nvtl(faDrm(moot0opt  ocildfm2uanvo t4tltoxf3iydop  livolt0 rumxrpno1ap emneils s2ua( p;u4ape mfciad s2emnvs;(0aetnif todlaD anvol()srtoxr oy4amt lnvtas sDtmuront4teenmicildlsDea(mo;(0 rxnxr iodfat lnvo ( sexmim oodal   nvil()arrrx o;o0openmfeiyd aDemums (4texnxf oodoatrai o ( t2xoim3nu1lmen fci tfs2rau  nu4tpenmoctyt s el(mpnu0 rtnxociadlm eln slt0trum(opiodop  mnet sfsDua(mooo4oltniietld m2um(ms;t0tlxrxr3tydlpt livi;s trtm(rpny4lptn icilsf 2raurpot1aetomfciltlm2rln o;(4tetomr oo1oat au i;(  eumim3oy1amenmfeta(f 2urxmoot1tle  fciysfaDul( pn(0arxnifciytlateln slt)srum(m iy4ape mnvs tfa2trxmoou1tltomoeildls eluvsnt4tlermocoo1fmD luvi;s) euoxo oy4lmtn nvia( sDumx  oo0aptomictlslm2ulu p;(0tlermfctydlmte ivslt0 exoxmpny1alenliei t)sDtrxmp;o0tpxoioeiyt a ulumon(0teeomf3oadla eaivsl( s2toxrpiu1ol elncslt)srrru  ;t1tlto ictatls2eluvpn(0 lxrxr3tytlpDr nvs;(0teur(r3no4lmtemncsls) Duru  ;o0tpt if3iatla rmnmo;()tlxomrcoodopD lneo t0sexmir iudamtn fvt t  rtaxront4oexnii3ias aDuan p;u) lermo iydoptr uvo () 2tm(mpoy1op  lfeil( srurur ;u1aetnmiciltfs2ra(mp u0tetoxo ootlm eln ol( s2trio oy1om emfvia()a2rm(  nu1oetniictls sDrlumpnt0altrif3iadoaD  ivslt0s2tm(opiudomtemfvsls  2umxro;t1aexomf3tasfaDuluvs u4 rxrmr oytlmDe n i (  2xmim iodaltnmncilt)sDumxr ;o4aptnmf3tydfa rl(mp u)areomr3oa1omDrlues;( sexriopnu4olt liei t s2rmu  ;t1opxn ictlsla ea(vonu)tltoif oy1fmDeanes t0 rxo(opnudope mieta(f Dua(  ;o0tetnmiciltlmDua(mo t)tltnxfcia1omtr ivs;t0t2xrimpoudlmeelncias sDum(monu0opeoifciytfaDumu o u0 etomfcoydfmtraues t)texrir oy1op  lfeias) rtm(mpou0apx  i3tldfa2ranmp u)tltnif oodla  ln i s sexoim3oo1lm emfvt ( arta(monu4tle iieiysfaDuan s;() renxf tadfptelneolt) etoio3no4oltemieiatfa2rrurpno1tlt mfciltlaDeanmon()trtnmfcoytfateanvolt0truo(o no1op nlncia()s2ur(m ot1opt mictydla elumsnt4altnxo3oa1omte uvol(0s2uo(r io4ll nlfvsl() Dtr( ooo0tlxn oeilslm ua(mp;t0alxoiocty1fmt auvi;t)setm(opoo1lme lfesat)sDraxrpno4aetnmieiyt mDem( p u)aeeoir oydlpDraiei;()seuoir oy4amt mivsls s2um(r ou0oexomieildlm emnmp;(4aexrioctydfat  n o t0sexr(o3ny1alee ietasfa2uau p;t1oet io3tydlmDrau s t)trxomr3iadfp   neils)s2toimpnu4opt  fcs s  rtax  oo0tpxnmfctls mDemuvp (0trxomr ta1lpDrlieil( texmxr3iy4olenlncsatfaDtrxr ot4oeeoifetatfm2el(vsnu)arerio iatfpD livolt)seum(m iodap nmfes sf rtmxmont4tlt iicildlaDrlnvp;u0 renxo3oytfaDeauvi;s0s2urxmpiy1aptnlncils) Dua( ono0apto f3tas m2el( o;(0altnifcto1lptranei ()srtmxopou4omenlicilt)aDur(mono0texnmociltlsDemn s ()aetrxrciydfm e ivil() etoir no1lmeelfvi sfarraum ;u1olxnmietyt m2eaump u)teerxr ta1op  auvslt) rxoim3nudomtemnctl( arrr(rp;u0alx  oetatls eanmp;(4 lenmfcto1lpD lu i ( seto(r3no4lleemnvtls s2ua(rpnt4tlxoio3iyd aDemump (4artrxrcia1oat li ol( t2uoim3iu1lmee nvs s)s2umx pou1tee io3iyd s emnmpnu4tlxomrcty1fp raueol()s2xoxmpio1ameemnvilt  rrrxr no0aptn ietydfsDeanms;t0 rtnxo iytopt li o;s  etm(rpno4ap elivsatf Dtmxro;u4alxoioeiatlm ul(vs;u) ltrmf iy1lmDrauvi;()srxoxm3ny1ap e fvilsfaDraxm nu0tpen i3iadfaDrl(vpn(0trerxf3oytoa e ueo t trtoim oy1lmtn iesls)srtaum nt1tlxomo3ildls2rl(vpnt4tleomfctytla r n s s sexoir nu4lm e icta(fs2umurpnt4opx ioeildla um(vo;(0 rtomr oytlaDrauvs s0 eumxm oy1apeemieiasf rua(ro;u0oltnif3tatfa2rmnms;t0arermfctatfptranvi s0srtrxm nu1lmtn fcsl(farrmx o;t1tetnmi3ilsfm2eauvsn(0aexnio ty1omD ai i;t s2xo(m oy1am elivt t aDra(mpnt1ope  i3ilt aDrlnvs;t) eeomr3oy1fptelu ols seur(mpnudaltnmiei t artrx pot1tpenmfeiasfmDea( o;t4artnmf3ta1oa r ivo;s  euo(o3iu4lptn fcs ( a2rrumpou1tpxn octyd aDrauvo;t)trtoio3oydfmtrln sls sexo(m3oy1apeelivsa() rrrumpou4oetomfciasfs emnms;t0trerirctatlpDrln slt srxrxr nodom  lncslt)sDraxrpnt4alxoioctyd s2um(mp;(0texrxf oytlpte nes t  exoir3oo1lm n nesa()sDum(mpoo4opeoii3iat mDrm(vsnu)tetnirctydfm rlivil()s2tr(m3ou1ll n iesas)aDtru pno4tleo o3iadfsDumn s u)teenmociytlmDr u s t)srxrim io1lp nmfes t  rtmu p;o1tlx iocilsla2ua(vs u) ltriociodfaDe neol(0s2xm(opnydoptnmivilt)aDrrxmono4aexomfetydfm2el(ms t0arermr todomDeauei s0 2xmirpny1lp   fet s)s2rrx pnt4teenmoeilt a2umu o t4arenmf3tydlmDe nei;t  rxoio3iy4ll  mnet ()s2rmx o;o0alx  i3tadlmDul(vp;(0 rxoxr3iatfaDrlu il(0 exrxo3no1am nmfet sf Dum(m ou0tltoif3tadla ra( p (4 leoxf oy1faDeluvs;s0setmxm oy1am elnes ( s2umxmonu0optoifetld sDemu s;u) rtnio3oodlpDrau o;(  2trim nodlmt  ncsa() Drmur oo4oeen icilt a2rau ont0trtriociytomDrauvi s) exoxo3iu1lm elfvs sf rrmu onu1olen fetldlaDraums ()aeenxf iydfpteli ols teurio oudolt  nvi t)aruaumpou4tlxnifciltfm2em( o;u4arxnio3iatopte ieslt) 2xo(o iu1alenmicsltfs2rm( pno4tleniocild a2um(ms u)alxrircoatom rlieo s texm(mpno1lp emicslsf 2rm(rpot4alxnmoctyt a2eln s (4alxrifcoa1faD lnvol( s2um(m3nydlme lfvs tf rtmur nt1oltnmoetasfa2ra(mpnt0arxomfciotoatranei (0 eurxm3iu4lme lnvt ( sDraumpnt1oltnio3iytfm2elnmo;t)artrio iydfm r n i s)teuoim3nu1alte nct tf Dra( p;t1oexn i3tatla2rmnmon(0arxoxo ty1fat luvi;( t2toim3iu1olee neias) Drm(mo;t1tleomo3iydfs2ea(vpnu0 rxoxf iadfatelnvil() rtmiopno1apen nvslsfsDua( p;o1tle  i3iad s rmu s t)alermo3oy1fp  li o;(0t2xmir no4aptemnesa(farrrx  no0tle iieils mDeanmo;u0aeenxo3iytfa  lieo;s) eto(rpiy1am  mfvtatfa2urumont0aex  f3iltfa2rl(mon(0tltoxrcoydlp   nesls)srxmxm3nu1oltnlfci t)s2ra(mooo4ape  i3iltfa elnvp u4 exnmo tydfm r nvo s t2xmxm3iydap nlnvt t srraump;u0alxnmoeiydlaDrln s;t0 exrmociotlmtranei s)s2trimpiy1lpt miciatfsrrr(rpnu0tltomi3tltfa um(mo t)trtnmr3iydoateli i;s  rtmim3iudapte ivtas)arrrurpnu4altomfctldfm2raump t)tleniocio1omDean sl(0 rxrim3iy4op e iviltfsDrr(rpot1tpxniictldlm rlumo;(4trermo tytlptelu s;(0 eurxo3iu4apt lnvt t  Dtmu ooo0alxniociadls2um( o;u4aetnxf iytfmDrlnvo;(0 2to(m3nudlmtelnetl( sDrrxmo;u0tpt  i3tldfm2ranvs t)aleoircoytopDrau o;s0t2xmir3iu4al elivtls arrmu o;u1aeenmi3iat a2emn s;t)tlxnxf iatfpD lnei (0s2xrxo3oy1al  mncs (f 2umuront0olen fctytlm ulnvsn(4tleoxf oydlp e ivols0t2xm(r3oy1amt licil() ruaxr ;t0aexn ictadla em( o;t4aleoxfcoatoatrlu o;t0teuoxr oodalt licias) 2tmxr ;o1opt  ieilt a2rl(mpnu0 rermfctydla eaueils)sruo(m iudlm  micsltfs2tr(m ;u4teeomoetlsfaDuan p;t)arxnxo iodoaDrli sl(0seuoirpiy4ap n feia( artaurp;u4oexo i3iytfa2el(mp u4tetnmo oadfptrlivols  2xr(o ny1lm nmfeil(faDuaurpot1apxo o3iys a2eauvs t0aeeoxo oydopDe i s t trumxr3oy4lptemnvsls sDta( ont4ope  fctysla2el(vpnu4aeenxociadlmtrlu ils)t2trir3nu1ole  ieta() Dra(  ot4oeto f3iadla2rmnmsn()teenmf3ty1la  ln i;s srxo(m3nu1omee nci t arurxro;o0tpxoifeiyt a2ulu s;t4 rxoxf oadoa  luvolt) eur(m nu1ap nmncsas)a2rmxmpno1ole ifciytlm emnvs;u)aeermf3tytfp e n o ( trurxo3ny1oltemfvtas a2ur( ont0opeoifctatls rlu o;t)altomr3tytfmDrlues () eto(r3iydamtnmieia(  Dtr(m no1tlxoifeils m um(mo;t)alxnif3oa1optrluei t texm(opou1lp  mnet s)sDuau p;t1oeto ociydfm rm(vp;(4 renircoy1la e ueils0 rxm(m ny4lmtnmfvs (f Dum(m oo0tetnii3tyt aDumu pn(4tetoio iy1faD  nvs;(  eurxr3ny1am  mivta() rrmxr oo0optomieilslm2raumsnu) eeoxo3totoaDraivo;()seuo(m oo1lltn iet sf 2rmu  ot0tlx moctaslmDul(mp (4 rxnif iytomDeai o;()sexrir3oy4alt mfct ( aDrmxmo;o4apenioctyt m2ulums;() ltomfctotlm ean ol()srtoxopnu4lmeelfcils  2ua(mpoo1optomo3iysfaDemuvs (0altoxr oo1fm rlueils0teuoxm3io1lmt  ncsa() 2uaurp;t1tetnmiciydlsDemnvs;t0tlermf3oo1fmDrli s;t t2urxm3ou1lme lnciat arumu pnu1aexnmfcilsls2eluvp;u) rxrmf ia1opDrlu i t texo(opnu1op nmnvt tfarta(rono1alxomociad m2rl( pn(0 lxrxr oadfp eli i t)sexr(rpno1lmt mnvta(  rrmxr nu4tlxnifciydfaDrmump t) rtoif3oy1op eaneil(0 eum(r3iy1lm  mncta(  2ua( ont4oleo i3tltls2emnvsnu)trxomf oy1omteaues s0t2urxmpiu4ole lnetas  2taxrooo4tlt ioeiytlm rl( p;u4 ltnifcto1oatean i ( srxm(rpou4ameelnvtl(  Dtr(ro;u1alxn ieiaslm2ranms u0 reoircoodla ran s;( teurim3nudll nmivias) Duau oot4oeeomi3tatlm rlumpnt) rtnxociytlaDelnes;s truoxr nodoptemncsat) Dta( o;t1opxomo3tysfaDea(vp;u4tlxoir iy1omDeanvo;(  rxmimpio1oleemfctltfartmumonu1apt ii3iadfmDulnms;u0treomr3iadlmDrlnvs;s  rur(r3oodoleelfcs t sDur(rp;u4oetnmfctlt s ua(vo;u)trxoxr3oodom eauvo;s t2trxo3oo4om  mnetat  Dra(rpot0alt mf3ilslm2ranvp;t)trxrmociadoaDeau ol( setmiopiu1oleelneta(fa2taxrp;o4tpxnmoctlt m el(mo (0 etnxociodlmtrlu i s0 rxmxmpiu4ap   ieiat aDra(rpou0opxnmfeiasfa2rmu on()aeerir ootoate ueo ( s2uoimpoo1oltn icias)s2ra(mono4texoioctys a2emums u0 lenmo3iytfpDr neo t) rurir3oydope mivsl() Dtr( oou4aeeniieiasfaDuaums;(0tltnmf3oo1omD lnvi;() rum(opiy4optelfei (  2rax  ;u0tpe moctys aDua( p;t0artrxo tydfmD aivslt)tetrxm no4op  mfetls  Drru  no1tpxoifctyt mDea( o;t)trtoxo3oytoat  nes;(0 2um(rpou4aleelnvsatfarua(rpot0oeenmociatlm2el(mo;t)aleomo tadoatelieo;t0trxm(o nodaptelict t)srrrumooo4aptn feiytfm rmuvonu0tleriociytfat anvo t0sexr(opoodllt  fvs (fsrrm(rooo1tee io3ildfa ranvp t)aexnmr oodfpDrli s t)seuoxr nu4apeemfvi () 2tmumpno1tlto ociat sDrlums;u)altoxr tadlptrlnes;t seumxopou1ll n nvilt  2tmxmo;o4alto ieiasfm raumsnt) etnmf3to1fatr ivsls0s2xoim nodape licta(  rtmxr ot1aptomf3tysfsDel(msnu)altrxociodfa  aneo;t t2xm(o nodoptnlncia(faDrr(rpno1opx mieiydlaDrl( pn(4tltnxf3oodom  aieo;t0tetm(mpiodamt lnvsasfsruaurpnu4tetnmi3iyt m2ua( o;u) exrio iatom  auei;t0t2xo(opio4op  mnvia()arua(  nt1oex moeildfs2ean s;u) rxrmo3iodlpD  ivil()setr(m iu4oltelfvi t sDra( pno1aet mi3iatla rluvp t4alxoiociytomt ln i;t0s2to(rpoydomen neil(fa2ua( ooo0tlenmi3tlsfa ranmon(4 rxnmfctatfm raues;t)trtrxrpoy4al emietls)a2urx poo4aexn octls s2um(vont4tlxoxo3oadlmtrln s s) 2xoiopny4lpee ivsas aDtr(r ;o1apeo ociltfsDum( p u0texnmf iatomteli s (0 exrxo3iodam  mncsl( s2rmumoou0oet ii3iysls elnmp;t4aeeoxr io1fmte nvsls  etr(m io4opeemnct s aDra(r ou1alxomocils s emnmp;() etnmrcoytom ranvsl(0 2xoiopnu1ap nlnvsatfs2raxmpnt0tpenifciyt aDrauvonu4aeeoxrcio1lmt anvi;()texmxo3iu4ll emnvt (farumu  ;u0texnii3iltls rmu s;u0alenif3oo1fateai i;(  2uo(mpno4ap   fcsas sDrmu  nu4tlx mi3iatfmDeau sn(0texoxociydfmDe uvilt0srtoxo ny1lmeemfvilt)sDtr(r ;u4opx  ieiltfm rlump;t0 etoxr to1omte ivsls s2xoim3nodolt lfeta(fs2raxmono0aee  ieias s umn on(4 eerxfciydfmDean s;s trxmirpny1amtn nvi t  Drrx  ;u4alt iiciltfaDranmp;(0aetrxo totfaDeai o s)trxo(r3no1ol  mnviatfaDta(r no4oltoii3iad a2em( sn(4aexoxr iy1fmt lies t  eum(m3iy4lptn nesa(fs2uaxm nt0alx  fetltfsDemnms;t0trtnio3tadfa e ivi;s0 2xmirpou4ol  micil( aDur(monu1teeniociad m2eanmo t0aexoiocio1lpt  ueo;s0t2uoxo3iy4lpeelietat aDrrxr ;u1opt if3iasfs umnvo (4aeeoxr tadfmt auvi;s0teuo(mpoy4lle  feia(f rra(m ;t4alx mi3iad m ua(vs (4alermo3totfpDr u olt  2xm(o nodlpte iet (faDtrum nt1oleo f3ils m rmn p u)trtoxfctatlp eai i t teto(r3io1lmtelfvsl( sDrruronu0tptnmo3tyslm rl(vsnu0 rtrmo iadfp  auvsls t2urirpio1omtelieia( s2umxm ;t4apen i3ilsla rlu s u) lenif tatlmD anvo;(0 rurir nudol   ncslt sDuru oou0oee mietydla elnvs;(4aetrxf3to1opD lu s t seuoxmpnodolt  icsasfarum(mo;t4oetniocias m ra( s t4artomrciydopDe i olt)t2urxopoudomtelncilt)a2ta(r no4oeen ieiad m emuvo;u4trxoif3ty1la   n i;s0t2xr(o ou4op   iesat)aDur(ro;t4tlxomfctadfm emuvp;(0alenxocoo1fpDrluvs;t sexo(r iydap nmici (fsDrmx ono4olt  o3ildfs2rmuvonu0treoxocta1laDr ieils t2xr(r oo1lm n fesa(faDtr(mont0tpxnmfeias m2uauvsn()aeermfciotlptraies s0trur(o3nodapenmneiatfs2ur(m oo0opeoioeiasfa2elnmo;t) rtrmr oa1omtraueo t teuriopnydop nmfcs (faDua(m ou0alxoifcild sDel(ms t4arxnif3ia1lp raueols  2trxo3io4om n fvt s  2tmur oo0tltn o3ild s2rmnvsn(4 lxnxf3tytfpt an o;t trumxr3iydoltnmivtas sruru pno4aleo i3ilt a uau s;u) rtnif oytfm elieslt)sexo(opiodop elivtls  Dumxmp;t0opeomieiasfmDelnmo (4 rtoxr3iy1oa rluvs ()s2tmir3iy4ll nlfet sf rrrxm ot1oleo fctytfmDulnmo;u0aexoxo oadfpteanvslt texm(m3io1ll  mfesas  2urxro;t1alx ifeiatfmDrluvp (0arerxoctadfpD au s ( sexr(r3ny4omeelnvsa()a2rrxmono0olxomfciatfm2rmuvont0aeenifciodomtrauvo t)srtrxmpno1llenliei () Dtauronu4olt  iciad a2ra( s (4 rxomr3iatfaD li s;s) rumxrpiudome micilt a2rrxmoou1tetoiieiaslaDul( sn()aeeomo tadfaDrli i;t0seumirpou1lleelies ( a2tr(m ;u4tex iietytla2raump;u0trenif3ty1fmD liesl(0tetm(r no1om elnci ()a2uaxrp;t1alx iociltla2ua(vp;(4texomo ia1lmD anes;s)trtmxo3ny1lpe mieiat  2ua(m nu1olx moetyt s2uluvsnt)aetoifctydlaDr i ilt)srumimpoo4omtnlivias  rra( o;o4apxn iciydlaDraumo;(4 rxrmr iadfa e ivi;t  exm(mpoydam nmivt sfarur(rpoo4tleo o3iatfmDran s;u0alxrir io1fpDr ueo t  exrxo iy1ope mivsat  Dur(rooo4opxn i3tytlaDul( on(0 etomf3iadomtrlu il( srtrim3ny1lltn nvil(f 2uaum nt0tlt mfetas aDemn pn(4 rxrmr tadlat luei s) exo(m iydll e nvi () Dur(rpnu0aeenmoctld mDrmumpnu0trerif3tydom eanvilt0 rumxr iu1lle lnci () rtm(  ;o0olto fciasls2ul(vsn() eerif3iadlaDe n s ( seurir io4ome mivilsfa2tmxmp;o4tlx ifciytlmDumuvpnu0aexrio ty1omD aivs;t setrimpoy1aleelnetat) Dtaxrpou0oexn oeiys m ulu p;t4 lxnxr3oadoat lues s s2urio3nodomeemfviat)a2umu ont1tetn octltlm ea(mo;u0aetoxf iodop raneil(0srtm(o ou1olenlnet (  Dumx  nt1olt mfciaslaDrlnms;()aeenmr iydopD  i o;()srxrim3nu1amt  fctl(farururoot4tle mi3iaslaDuaums;u4 eeomfcoo1omDeli s t trtrim3iy1lptemnct tf rumurpoo4apeoifciatfa2eauvo ()altrio todlmD  iei s  2xr(o no4al e nct ( artm(r nt0oltnioctytfm rmums;u0tlerir3oadop eluvol( t2xmimpiy4op   nesa( srtmx ont1aexomociatls emu o (4trtrio tydlpte iei s t2trxr no1am n nvsl()srrax oot0tlxnio3iydlsDulu p u)aeenmo ta1fm e n il()teto(m3no4ope lieta() Drau pnt0tlenmoetydfa um( o u4aexnmf totlp  li o;(0 2xoxo3oy1ome  fci tfa2tr(mp;t4tee  fetat a elump (4arerir3iatlm   n ols  etoim ny4lm e nes t)aDur(rp;o1opxnmfctldfa rl( o (0artrifciy1fm rluvo;(0 exrirpoo1lle mivt s  Dumum nu0apx  iciadfmDumnvsn(4trxnioctatfmDrlivo;s) 2xo(rpnodoltnlfetls)s2tmxr ot4altnifeiytlm2rluvs;u)artrxfcoa1lm  luei t)s2xoxo3ny1am e nctlt  Drrxroou4apt mo3iyt s ean snu) rtrir oy1lp ranesls texoim3iodom nmici s) rrru o;o0oee moetasfsDra(vsnt) rerxf3io1fpDrli il( srurxr oy4optnlicsat) Drmu  no4apxnii3iadlm2umn pnt0tltnmocoo1om raiei;t trtmxm3ny1optnlivtlt  Dtax pnt1alxoioetys a2um( s u) ltnxr3ia1laDelu ol(0 ruoxopnu1ale lnetas aDurxmo;u1aex iocias m eln sn(0teermf todoa elu ol( sruo(m3no1lmt mici tf 2rmuro;t0tex  ocias s emuvpnt0 eerio iatfpDelnesl(  2xrxrpiu4lme liesatfaruru  ;t0alt ioetlslm2elu p (4altoifcoydfa  ai i (0 2umxm3oo4altn ict tfaDtau  ou0apenio3tatfsDraumsnt0trtoxfcootlaDeaieils srxrxo no4ol n ieilt)sDrrur oo1alenmf3ilsfmDuau p u0tlxnif3oy1fmteauvol(0 2xoxo3io4amenlivsatfsrtrx pnu4tleomfcilsfmDrmuvs (0 exoio iadlp rlieo t s2um(opiudalt mnct t)arur(mpoo0tpxoioctatfa2rm(mp u4 renio ia1lm rluvo;t  etoxo3oy1optnmfvtltfsDum(  nt4oeeo o3iytfmDem(ms t4altoircty1fptr i s;(0tetrxmpiy1alen icsls) 2uaurpot1tlx mi3tadfa2umuvo;t)alxnircoydom  an i t)srxoxo iydlmenlfvtls) rtau  nt1aetomociltlmDrauvonu4arxrmf oydoa elnvols)srum(opou4opeelivt tfs2raxr ot1texo fetls s emn snu)tetoiocia1om elu i t  2to(mpny4lme mncil( sDrm(moou0aetn oeiatlm eanmo;(4 exrif iytomDr uvo;s) rxo(o3no1altn feilsfa2ua(  ou4oeenmieiysls2emumpn(0 etoio tydfp raiei;t0 rxo(m3oy4alen nei tf Drmxrp;u1tpxnmfeiys aDelnvs;(4 eenifcty1faD au s;t)srxo(opnydlle lfvta(f rtm(ro;o0apto i3ils aDrmnvs u)arxnxr tatopDrlivo s trxmio oodll   ivslsfa2tru pot1tee iictyd s ua(mpn()arxnxf oytom eln s (0 2xm(rpiodam n ieiat) rua( o;u4oex ifciyslm2eaums u)aexoif3iydfmte ivi;t tetrir3no1llt lfeil(fs2ur(m ;o4tle mo3tadfsDem(ms;u0texrxo3oodfa  aues;( seuoim iodam e ivil(fartmxm ou4olt  oeildfa2rm( p () rerio3io1fp  aivi s0 rtrio3nodopee ics s arumu p;t4tee ifeiltlm2rlnvs;u)tlerxr3ta1lpt lu i;s s2urxo3iu1ol  miesa()artau  ot1alxn fctatfm2umums t)arermf3iytfaD aivs;(0sruo(o no1op n ivt ( sDrrx pnt4tpe mociasfm eanmsnu)aetomr oytoaD au sls trtm(m ny4llee ncia(farua(mp;t1oet  fcias a eln s u)trtoxfcta1fa e u o s truo(mpoodolen nvil( arrr(mpoo1oee iietadlmDemn p u4 ltoxrcootoptr ues s)truoxrpnu1lpt mnct sf rrmx  no1tetn f3iydlmDran s;(0alxnirciodfpDrau olt0trtm(m3ny1llee fes (f rur( onu0ole  ociydls2ranvo;t0 rerir iatoa e ieo t  2tr(opnu1omenlnvsltf 2ur(mo;u4tpt iieiat m2rln p;(4aeenircootfpD  i o;s)t2trim3nydamee fct t srtmx pnt0altoif3iadfs uln o;(4 exnxo iytla eauvi;t0 eurxmpnu1optelnctas)artaxrpno4olen iciysfa2eauvp;t0 exniocoy1fa ran s;(0t2toxr oo1oltnmiciasf Dta(ront1texn oetadls uauvon(0altoxr tatoat  ivs;t0setrir3iodale mnesltfs2tmurp;o4opt  f3tlsfm eauvp;t0tleomrcta1faDelneilt) 2xrxr3oodalee fvs ( artrur ;t0tpen icils a2el(vsnu) reoiocoy1fp  luvo (0seum(r3oydol   ivi s)s2tr(m ou0opxomfetltlm raums u4aeeriocia1lp  anvs s)t2xrxr3oy1lmeemfvtl(f 2raurp;o0opt mi3iysls rln o;t4aetnmf oadoa eln s;s s2um(r3oydlm e nvia(  2uax  no4opxo o3iadlm2um( p (0trermf oodlaD  n i t)sruo(r ny1aleelfvsltfs2rm(rpot0altoioctad a2uau s;t) eeoif3tydoaDrln s (0tetrir iu4lmtelicsltf 2rrumono4opeo ociys a elumo;t)tlxomo3tadfa e neils0srumim3iudameemivs s)srrm(  ;u0aetnmictytfs ra( ont0 etrmrcta1oaDelueo;() 2uoirpoydllt lnetltf 2trx p;o1aptomiciatfm el( s;t)artrxr3oy1fm r uvs;t0srxo(o oo1omtnmfvia() Dra(monu1apxn iciatfm2eaums t0 etomocta1lmDr nvi;()s2uoxm io4am n ivil(fsDtmxro;u1aet iieildls rmn o;u4arxnxo3iadfmtrlueilt0setmirpou4omee ncil(f 2tr(mpno1opt mf3tas a rmn p u)aeerir totoaDe n il( sruoio3nu4lm  mictlsfsDtau  nt1oeeomietls sDuanmsnu0 ltoxr iy1lpt  ueolt) exmimpiy1llenlici tf 2rrxmono0olx miciyd s2uan pnu)trxrxr oydla elieo;t)trumxopio1omeemncsls s2ta(  ;t0aexn fcildfs2eanmo;u0tltrio oatfpD  nvilt sexm(o ny1ap nmfvil(f rumumpot0tee moeiytls uau p t0aeermocoa1omtr i i s srumxr3oy4lmtnmnet s)a2um(r ou1tltn ieiltlsDrlumsn()aleomo3oydoatelivs (0 2um(r iudlp  lnct tf Dtmxm nt1tlxomo3iytls rlnmpn() exrmf3iadlmDe u o t0texoim3nydalt  iei () rtr(rpoo1oleo oetltfa2rmnvonu4alxoir oadla elneilt0s2xr(o iudom e ics s) rraxmo;u1olt  o3ias aDel(vsnu0 lxnir3oa1optrauvi;( trxrir io4omte ieil(  Draurpot0aeto ietadls2ra( pn(4artriocoatoptrlivsls0 exrio no1alee fcils) Dtaumpnt4oleomo3iys a2rauvs;t4artnmo3iadom rauei t  exmxr3iy1amte iesat arrrx  ;u4oetomfeiaslmDrmnvp;t0aetrmf oadlaDe ivs t trtoio oy1apte icils) 2tmurp;o0aptnifcilsfa el(mont)arenmr ty1fmtrauvs;t) rur(mpiu1al  micta(  2rm(mp;u1alx  o3ilslm2ea(vo ()trenir totopt li o t) etmir iy1lm nmfcta()srrrx p;u0oleo ietasls2eaumo t4 rerir iodlp r u i;t0 rxrimpoy4lm n nvslt)sDtru p;t0apeoif3tltfm2rl( o u0trxoir3ty1fa eanes ()texo(o oodol nmnci tfs2raum nt4tleoioetadfaDum(vsnt4arxrxoctadfptran s ( setr(m3nodopenlfct s)srua(mpot1tlxniietys a eln pnt0 reriociytla eaivo;t)srtoxm3no1om emncilsf 2rrum ot1ale  fciys aDuluvo;t)artrio3io1fpt aivs t) eum(r3nydapt  ictl(  2ur(mp;t4apen o3tadls ulump;t0 rxrxo oytla r ivo;( trxoimpny1ap nlietlsfsrtmx ont4oexn feilsfa ul(vp u0 eeoio io1oa  auvi t)t2umxopoy4apt lfes s a2tmxmpot1ale  o3iytfaDrm( s t0 rxnirctadfmteluvol( t2tmxm3iudlltn fviasfartr(  ou0oeenmfciaslm2umn p u4 eerxf3ootfaD aiei (0 ruo(o3oy1lm   fes s arraxr ;o1teto ieiat mDulu o;u)treomfctadoptr nvsl() rxoxo ou4oltnlivtat artaxroot0tpe  ictatfmDrlnmonu0 rtrio3oa1faDe iei;( sexo(r ou4oleelnvslsfs2um(roou0tlxnmfeiadla rm(vpnu4 reoxf3oytfat lnvi s s2umxrpno1lp e netat)srrax  nu4opxniiciatls um(vont)tetrxfcoodop   ivs ()setoiopoudolee icil()arum(rp;o0aptn fciasls2umumon(4artnmr oa1lp  aueols)s2trio3io1ole  ietl( a2rrx poo1teeoif3iys a rln o;t)aexrmr tydfptranvo s)tetmxopnodlmtnlics ( aDuaurp;u1opto oetlsfs2ea(vs u4alenmo todoaDr i s;s s2uo(o3oo1am e ietl(fsrrmurpoo4tlx mfetldfsDean s;t4altoxf totlpDrluvi;t sexrim3oo4lptn icsatf rumx  ot0tptniiciltlm2umnvp;t0 lxnxocoytlmteaivilt)seurir3iydlme licta(  2umurpno0aet if3iatfsDrlnmo;t)artnir3totfm ranvi s0trurxr3oydamtnmneilt arurxro;u4tlenio3tydlm em(vs u0 rxnircoatlmDelu i s0 exm(opou4amtnlfcsat)s2ra( ono1opx  oeils m emuvp t) renmocoadlp eau ilt) 2xoxmpiy1lp e nct s  Dtau p;t1apen oeiytlmDrlnms t)aexoif3oatop   ivs s tetmxr iy4apee fctl( aDtrxmpoo4oexoifctydfs emn pn(4 ltnmocto1latr i sl(0 2trim3ou1ol e iet (  rum(mpnu4oeen f3iadls2umuvs;()artomr io1opDr uvsl(0 rxrirpiodom   ivsat  rrr(r ;u4alt mo3iadfaDulu s t) etnio3todlpt lieo t0srtoirpnu4om e nvt (f 2uax oot0aptoif3iydfa rmnvpnt)trxrir3oadlmte ieo;t tetm(r no1lm nlicia()aDtruronu4tex  ocias a2rl(ms t)trerxf3oytfpt  nvi s t2xmxrpiu1omeemietat  2trx  oo1tlxnifetysfa emu onu) rtomo3ta1lp   u ol(0 euoim nu4omeelfvsa()srrmxm nt0aexn i3tldfm ulnvp;(4 rxoxrcoy1op  au olt)t2tmio3nydomte fci s)sDtru  ot1tex ifetad a2ul( s u4 renxfcoadlateluesl(0trumxr3oy4alenmfvsas  Dta(  ;t0ole  ietas aDrm(vpn(0altomocoy1fp elu ilt sexo(m3oo1omenmicsls) 2raxmo;t1aetnioeils m2ranvp;t4trxrifcoodopDrlneo t0seum(o oo4am nlictls srrru pnu1aee miciad mDumnmonu0trenif iytfatrlies (0seto(m iodlpeemnet s aDuaxmo;o0apx moetatlsDean s;()teerir iadomtraneo (0tetmirpny1lme mnct s a2ra(ront4aexo fctad m elu s;t4treoxfcto1fpDrln s;s teurxrpoydlp emnvs t a2rm( o;t0apx mfeiyt aDrl(vs;(0aexnio tytlp  ln ols) 2trxrpio4ape lnvi ( a2um(monu0aexo fciad s2raumo (4 reomrctadom eaneslt)texoxmpnudlm n fvt s  rrmum ;u1oetoif3iys m emnms;u0tetriocta1fptranvo;s) ruo(m3oo1ome licia( s2rmum nu4alto iciytlmDrlums;u)tetrmr3oadomDeln s;( setriopio1ope livtltf 2um( pou4oeto octat m eau s t)teermf3oatfm ran s;() etoio no4altnlfcs t arumumooo1aleoifetytfaDrl(ms;(0aeerxr oo1opt auei;(  rum(rpno4apee nct s)sDrr(mp;u4tet  ociltla um(ms;()arxnxf oydlmtrau olt) 2tr(r3oo4am  licsa( a2tax p;o4tpxnio3iyslm2raumpnu)trerxr3tydfpD lu s (0 euoxr3iy4al e ieilt) Dtrxro;u4ole mf3tyslm umn p;()teenxr oodfa rlneslt) rtoxr nodol nmics s sDrau  nt1oetnio3ias aDem( o u0trenir tytfpDr ieils)srto(mpoy4lpenmfeils) 2urump;u1olen i3tas mDuanvp ()tltrio3oatlmt anvi () 2xm(mpoudop nlieil(fs2umxroot1oexoif3iytfs rmuvs;(0trxomrcoodfpte ivsls) rxoiopiy1am   ncsatfartrum ot0ale  iciatlm2ulnvs;t4 rtnir oa1opDrlues t0trumimpnydll nlieslsfaDra( ont4tpenifciytla2ul( o ()treomocootfa  lieo;t  exo(m3iudalenmivtl(farta(mp;o4tee iieiadlm2ea(mp t)altnif3ootomDrai i ( teurir3ou1ale  nciasfartaxm nu1tpenifeiyt a2rluvp () rxriociodla eanes s)seum(opny1am n fet sf Dum( ont0openmociasfaDemumont)aexomo3tytfpteanvi;( t2xoxo3nu4lpenlici () rurx ooo1tleo fciat mDrm( ont4 rxrxf3iytfptr neilt) 2xm(m io4optn ieslt)aDtaxmo;u1ale iieilt sDelnvp;t)artrifctytoaDeai olt tetmxmpiy1am  liesa( srurumont1tpxoifeiaslmDem(ms t)trerir3iy1fp eanvs ()texrxr3oo1olen fctls) 2rru pot1aexoioeildla emnvs;t) exnmrciytlm   ivo;( texo(o3oydamen ietat)srurx poo0aetnifeiltfa rl(vp;()altrif3to1om rluvolt0truoir3iodaleelnetat)sDrrxrp;o1tetomiciadlaDel( s;t4tetnmr3iadoaD  ivs s) exmxo3iydalenmicilt arurum ou1oltn oeiltfm emnms u4artrif iy1lpteaivs (0s2tmio oo4al  mfciat)aruax oou1texo o3iltfm rlu s;t0altrxo iy1oatr ueilt) eumxmpnu4altelfvtlsfa2tm(rpoo1oex ifciaslsDrlnvo;t4 lxrio3oydomt  u o;s t2tm(rpoy4lp elicils)srur(mp;o0olxn oeiytfa ea(vp;t4arxomf totopD aivi t)tetoxm3oudomt  fesa(fa2ta(mpnt1aptniiciysla2ua(vont4 exnxf3oy1lpt li o s truoimpoodoleelfeia()a2rm(r nt1tetnioetlsfs2ra( p ()aetrmr tatlat  nei;(0s2tm(r iudopt mivs s)srtaum no1tpenifetltlmDea(vp () renmr todom raneo (0 2trxr3nydole mnvtl() 2ra(rpoo1teeomf3iytls uaump;t0tetrxr oatfmD lueo ()srtmiopoy4am  lncsas aDrrxmooo0aet  feiyt mDemnvp;t4areomr3io1oateaneslt0tetoir3oo4olee feiltfsDrru pou0oeenii3iytlm eanmpnt) ltrxfcoodlptr neo t) 2tm(rpoydom e ncsas) rumx  ;o0oexnii3tasfm2rmn snu0 rxrxr oadfm rli i t0 2trio nydlp nlnetlt  2tmxrp;t0oltn f3iasla ua(vsnu0 lenio3iy1omDrlues;s)s2umimpio1lm  mneils s2tm( p;u4tltomf3iaslm ul(ms;t0aetnxo3tydlpDr n i;t srumio ny4am  lnesls s2tauro;t1tex  ieiyd s eanms;u0tetnmo tatoa  luvilt t2urxrpoudolee fei t)s2raxrp;t4alt mfeiadfs2rl(mp t4aeenxr3oa1fm rlivol()srtoxr nu4ol e feilt)sDrruroou4apt  icils sDeanmp u0 etrifcoy1fm  aivsls0trum(m3nudolen fctls)sruaurpnt1tex iictaslm ul(vs;u4alxniociatlpD  nesls0 2uoxm3iu1am elneiat) 2rrx pnt0tltn ietasfsDeluvpnu4tlerxfcio1fpD  neo;s s2tr(m3iudamtnlfeiltf 2urx poo4alxnmocilsfm eanmp;u4alxrxr iatlp rluvi s)sruo(rpno4apen ivsls srrmuro;u0olxoii3ildlsDem(vpn(0aleomr3todfm  au ilt0trum(m3oy1apt  ivta(fa2rrxm ;u4aleoiictad sDel( snt)trxnmf3tatlptraiei;(0 2tmimpoydame mici (f rtrxmp;o1opxnmiciadla2elu sn(4teenir iy1lm  lnvol(0srurxo3iu1altn ncsatf Durxront4tle  oetlt aDul(vsn(0texoxf tytfmtelies;()t2xr(o3ou4amte ictl(fs2raumo;t4alxo ietys sDrlu on(0alxomo3oo1fpDrlnvi s) rxrir iodoptn ict tf rrmxm ou4tltn oeiydfs2eauvpnu0texnirciytomDe n s;s  2xm(r ou4lpt lici sfaDraxrpno0aee  fcildla rln o (0alenir3oatlaDeauvil(0setoxm oo1al e nci s)aDrm(ro;t4apx ifeiat s2em( p;u) rxoifcty1omD  n olt)s2umxo3io1lleelfeslt  Dtaxmpnt1tlxnmociysfa ua(msnt0 rxrxrcoytoa r uei;(0s2urio nu4omt lnetl( s2rmxmpot1oexnifciytlaDrm(vonu)aetoxo3iatfa rlu i t)trtmir3nu4ll nmfcs (  2ua( pnu1tlen f3tas s el(mp (0 etrxocoy1fpt  neo s)truoio3ou1lmeelietat srrru p;t0opt moetad aDrl(vp (4 ltnmrcoydlat aivsl() etmio3oodlptn ivias)a2uaxmo;u1ole mictadfaDean s;t4tetnmr iotlaDeluvolt)teurim iudlpt mfcs t s2ua(rpnu4teeoio3ilslaDraumont4 ltnmf3iy1omt lnvo s0 2xoxmpio4llenlnciasfa2um(m ;t1tex ioetas sDelums t)tlxnmr3todopte uvo t)s2toir3nudlm  mivi s) 2rm(mp;o4alt  ieiad s2elnvo;t0altnxf3oodomDr ueo;(0 rxm(rpou1ap n ncs t)aDraxrono4tpeomoctad a el(mont4 lxomr tytlmDeaueslt  rum(r3io4lm e neslsfaDrm(r ;u4aee io3tasfa ranmpn()alerio3ta1lp r n o s trtmir oydole mfvi (fsrrrxr ou0oex mictytla rm(vsnu)teeomrcoatlp raues;t trurxopoo1ap nmfcs t)a2um(mono0tlx ifetatfs ea(vont0tetnxf3oodfp  lu o s s2xoir ny4apeelfcs sfs2raxmp;o0oeeoiiciyd a2uanvo;u)tltnmrciodomtrln o t) eumiopoudop n nct () Dra(m nt4aexomocias mDrm( p;u)arenmfcia1lateauvi t sexoim oo1omt  fcia(f Duaxmpnu4aex mieild a2el(ms u4 eeomrctotoatrai o;t0truoxrpoy4lp  mnesl(f 2rmx ono1ole mictysfsDel( snt4tlenioctadoaDelu olt0 2trxm iudolen fcsls)srrmu p;o0optomieiyslmDumn s;(0 ltrio3iy1lm   neil( setmxmpnudope lfeslsf Duaur no1aexniocild a2em(vsnu4aetomrcia1fp rauvo (  2uoxm3iydap  mfci (fa2taur ou0aee mi3iys sDeaumsn() exrxo3totoaD  nei s0t2to(r3iodalte nei t) 2rmur ;t1ale mictlslaDuan onu) rtoirciatlatrau i;(  etr(o ou1omen netas  rrax p;t4apt  fetldla2rl(mpnu)alxrmr iotfm  au ilt  etm(m ny1lp emnetls  2rrx pnu4tpx  fciatfmDrl(vo;u4 rermf ootopt li i;t s2urxopny1altelivs s)aDtm( o;u0tee  f3ils s ranms u)aexrif3iy1fmDr ivsl(0seurirpoo1al  mnvtasfarrru pno0teen o3tlsfm uaump (0trxnio3tytlpte ivs t s2xrir3iy1am emfetas aDrrur ;t0oee mo3tydfaDrm(vo;(4aexoxf oy1op   nvslt0t2xoxo3iu1al  livsasfsrtmxm oo0tlxn oetas aDemnmon(0 lermf ty1lptrlu o;t t2xm(rpnudllen ivs s sDtrur ou0aleniictltfsDrmu p;u0areoxo to1fmteau i;s)seuoio3nodalte ivi (f Dtrxmpnt4tetnifciltfa2ua(vp t4 ltoirciodopDranvils teurxo io1lmt  nci tf rraum no4opxo i3iydls2rmump t)alenir3tytlpteaivol()t2trirpnydap  lict ( a2um(  nu0ope mfctysfmDrl(vs;t4trtoir3ootop   uvo;(  2xo(mpoydlp emfctlt srraur ou0texoifctydfsDemn p;u)altoxfctotoaDeauvi;t0 ruoxr3ny4lp elfesatf rrrxmoot0aeeo f3ilsfs emuvs;t4arermr3io1lp  auesl( texoxm3nu1lmtnmfvtltfarta(  nt4oetnifctltfmDuanmp t) leomocoatlpteaies s  rtr(rpiu4amtn ivs t s2ururp;o0aexo fcilt s2ea(mp;t0 rxoir3ia1fmDe uvs ()texr(m3oo4ll nmnvi sf 2rru oou0aet  iciaslsDrl(mp t4tltnmf3io1opt  ueil(0 2xrxo3iudalee fct ( arurxm ou0oeenmo3tldfm ea(mont0alermo3oa1om   nvi;s0 2urxmpiydlltnmnes s  ruru  nu4aetomoctys m2rlumo;u0tltomr3tydfa eaivs;t) etrxopoo1ol  micsls)s2rmumoot4aee  oeildfaDrl(mpn(0texomrcoo1lptrlues s0s2umxopnu1lltnlicslt  2trxrpot0aptnioeiasfm2ea(vsn(4tlenmfcio1om eai s t t2uoxmpiydole mncta()a2ta(m ot0openifeiadfs ulums t0tlxnioctadlptr i sls)t2tm(o3io1am e fes t srrmx  nu1apt moeils aDuaumo t)trerxo3ia1lmt anvo s) etr(o iy4amtemivtl(fsrta(r ;t4apeomfeiyd s rl(mon()trenxrciotlaDe uvo s)texr(r oodlp n fetlsfsrrmxmpno4optoiietldfs emn on(0 lxrxr tydlpD lu o s0 rumio nydapt lies t  2umumpnu1teenio3tldfaDeau o;t4 etnifcio1lmD lnei t) rxm(r3nu1lltnlivsa( aDrr(m ;o1aexnifctas aDumu s;u0 exrif3todlpDeai i s texmiopoy1optnmics sf rumxmpnu1aetnii3iyt a2ul( s u)artrxo oatfmDe ivi;t0trtmio oo1ale mfviatfa2ra(r ot4aeeomo3tyd aDelu p t0 eenio oydlpt livsls)s2uoxo3iodlmt lnetasfarrmx poo4aptnmi3iadla uluvsn(4aeermf3oo1oaDeanei ()trtr(r3oodomeelneiatfsDrrxm oo0tptn o3ilt s um(ms;u)tlerxr oytfaD  nes;t0srurxm io1apenmnesl( aDraxmp;o0aeeomfetasfm2ra(vp t4 exnxrcia1laD livo (0 eto(o3iu4lp  lictlsfs2ta(rpoo4aex  ociatfa eaums t4tlermr iodfaD  ies;(0seum(m iy1lle lieia()aDtau pnu4opto iciysfsDrmn ont)alxoxfctotlmDr ieol( trxr(o nodll  miesa() Dta(mpou1ale mfetldfm eanmp;t0alenxo io1fat  ues;s  2uoiopou4opt  net s) Dumumpnt1teeniieiysfmDea(vs u0arermr3oydfmDeau i t)setm(m oy4altn nctas)s2rr( poo4oleomoeiltfa2el( s u)arxnio3iy1la e neo;()sexrimpnudamtelics t srur( onu4oex ioctlsfmDrl(vo t0aleoxo ia1oatelnes;t) eto(o3oo1llen ivsa(fsrrmurpnt0apt  i3tysfaDuluvo;u)tltnxr iytop eaieo s)tetmxrpny4aptemietltfs2ur( pnt0tpen o3iat s2uan snt0trtoircoodlmDraues;s)seto(r3iu1am  mfcil(f Dumum ot4tpx iietat m eluvsnt)areoxrcoytop rli i t0srurxr iydlle mfvtlt a2urxmpnu4tlto o3tyd m2ran s ()aeerif tytoaDrlieo;t0 2xmxmpou4omenmicslt)a2tmxrpnt1texomocilt sDuanvsnu0 rtoxo3ia1fp elueo s0 2uoirpou4altnlnvi (  2tm(rpnu0olt ifeild aDua(mp (0 exoxo ty1lpDe i s s)texrxrpiydamtnmncsat) Drmu pnt4aet iieiadfa2um(vo;()tleoir3oodlmt aies;t)t2umirpnu4lmt mnvt (farrmxmpot0tltn ieiadfa uau s;u0alenxr iodfmtran s s setrim3oo1ope mfei () 2raurpou1aptomi3taslmDrl(vont4aeeomo oadoaDrau s;t)sexmxo3iu1lltnmnetat aDta(mpnu1alxo oetytfmDrm(mp u0 rtoxo3oydlpD lneols s2ur(m3iu1op n fcilsf ruaxmo;u1oex ifetltfmDuanvs;u)tltrio3iytfpte nvs t)s2umxr oo1lmenlnvs () Dtmx  ;u1ape mi3iydlsDum( p ()tleomf3iy1opt ai o;t) 2to(o3no4am  mnetas) 2rax poo0oeenii3iysfaDrmnvp t)alxnif io1op rlu i;s0 exmir3nydope  fciltf rtm( ooo0aeeoifeildfs rmuvont0trxoiocoa1oa e u s t) euo(rpou4lmt  fvslsfsDra(r nt1tpen oetys m2um(ms u0texrmfciytlateai ilt t2ur(opio4lm   ictl(  2uax  nu4tpe  o3ilsfs2ra(mp;t0 rxnio3iydfpDe n il() exrxo3ou4opt  ivs t)sDtmxroou0oexnmieiydla2rmnvs u0 lenmf3tydfa eauesls0t2xr(rpou4al  mics s  Dtm(mo;u0aptoio3iyd s ua( p (0tlxomrcta1laDeaivs s0trxm(o3oodoptemfetls)a2uru pnt1oet  ociltfs umuvs u4artnmoctadfmt li ils0trur(o iy4al n fvs s sDur(moot1oleoiociyd m2rau ont4teeoxr io1omD luvsls srxoir3oydap emfet tf 2ta(rooo4oetomiciasls umn pnt) eeoif oatlaDe uvil(0 etmir3oodolenmfes tfaDurum ;o1oltomicildla ulu p;u0arxnxociadfp  ln o;t)setrxopiu1alt  ietltfs2trxrp;u0tpxniociysfaDuauvs;t0 lxrif3ty1oaD  u ol(0s2xoirpno4olenmnvtls s2trxmo;t1teeo feiltlm2eanmpnt)teenmfcty1fatranvi;(0tetr(mpiudlm elivt sfaDtmu  nu4optnmfetytlsDrmn o () exnxo totlmDrauei t0s2toim nudape  ncsls artru  nu0aptomoctlslsDulumpnu0 eerxociadom  aieolt)sexmxo3ou1alt micils) Dta(  oo4apenmfciytls elumo;u)aexrxf ia1lp eaivi t  2ur(o3iy4oltnlncsl(f 2rr(  nu1oex mfcildfmDrln pnt0 renmr3iytom rai i;s t2xr(opny1ll nlivs () Dtr(  ;u0teenifcilsls eau p t0 eeoxf io1op rlies;t s2toiopoo1omee ncsltfs2rrx  nu1apeniociyd sDuaumsnt) ltriocty1omt lu i;s)setmio iu4lp n fvi () rum(  no4tlx ifctyd m2rlumo;t4trtriociy1fm  anvo;t)sexoimpoodlmtnmiesl(faruaxmp;t1aexn o3iadfa rlu o ()artnxr3tydopte neo s)srtm(r ou4apt mietlsf 2trxrp;u4tex  fciatfaDrlu o u4tetoxf3ootfa eanvo t) etoim3nydll nlfes t) rum(m ot1oexnif3ildlsDuauvo t0aexomo3ty1lpD li s t)t2umim iudam n fcsatfsDrrx pnt4aee mfetaslsDuanvs ()tltomrctydlp eaues;(  euo(o3ou1lpee iesas) rrmxro;u4aeenioeiys mDrl(vp;(0arxomociodfpD lu i;s)trtr(mpiu4om nmnciasfarumurpnu1alxn i3tad s2rmnvp u4arxnmo3tadfp rau o s0trxm(o io4op elfvi sfarurx  nt1texoifciytfs2rmnvpn(4trxrxo3oydlmtrliei () 2uoxr3ou1am elies () rrmxmooo1alenmi3tys a rluvs u)tltrmoctatfmD aies t srtmxrpny4opt mivsa()a2raxmpoo0aleo ociatlsDem(ms ()tlxrxrcootfate ieo;s0srtoir iu4lptemnci s s2trur ;u0oleomociltlaDra(vonu) eerxf iydfmDe neo;s)s2trim io1lmt mnvilt srum(  ;t0aptnio3tlsfsDrauvpnu0 rerircty1lpt li i;( s2umir iy1ole  fcilt) 2uaxmp;u4alenmociyt s2elnvs u0altoif3oo1la eau il( srxo(m iudapenmfvsas  rururpnt1ope  iciys sDrauvp u4altomo tadfpDrln s s  rxmio3iu1aptnlnvsa( a2tm(ro;t0openiietyt s2el(vp;(4alenircoodfpD lnvs;(0tetm(o iu4ap emneiasfa2ur(m ou0oexnmfeild m ulump ()trxoxfciytla eliesls0trxmxm3iudale lnvi t srtrur ;u0tleo oeils m2ul(msnt)teeoifctatom elies;(0s2trxr3oo4amenmnet ()aDrrxrpot0oexo i3ias a2ra( pnt4tltnio io1oa  au o;t0srtr(r iy4alenmnvt ( srtrxro;u0ape  ieildla eauvs u0tlerxf tatfmteluvo;( trxmim3iu1apeemictls)s2um( oou4tlxo fctasls2elnmp;u0artoxoctydfmDrlnvil(0sexoxr3oy1ame  ictatf 2trxrp;u0texoioeiasfs emumsn(4altoxo tydfmD  i s;() rtmir no4op nlneiatfartmx pou4tltomociys a em( s u4aleniocto1fmtrln o ( t2tm(o iu4lmen fcilsf rrr(r nt4aex ifciadfa2um(mon(0aexnxr3oodlp rli s ()trtmir ny1aleemici t srtaxrpnu0oexn o3iys sDelnmo;u4aeerir ty1fpt aneols srumxr3no1apee nctlt aDua( pnt4aeto ieild sDea( snt) lenmo todlp raueo ( teumir3ou1omtn nesatfsrrrxmo;o4aexnmo3tasfm2emuvon()aetrmr3tytfpDr ues s0setr(mpno4amen netl(fsrrr( pot4ale ifciytlsDul(vpnt4teerxr3oytlp rlieo (0 eumimpiy1ape  ncslsfsDrrumono1tpx mf3tad mDrmuvs t0 lermr iydopt auvi s  eurxrpno4ap  lieias)srtrumo;o1oleoio3tasfs2uanmpnu4artnxf iadlp  li s (0setmxr3ou1opeelfei sfa2ta(r ou0oetnmi3tls sDemn s;(4aeenmoctytfp rauvo t) exrimpiodal emnvt s) rua( onu4ole ioeias aDean pnt4trxrir3iadfm eliei;()sruo(mpoudal elivsa( sDtaur ;u1tptn ociydla el(vs (4altoxf oy1laD lnvs t  eumxopiu1lmtelfvi sfarrrxr oo0tleomi3iys m emuvpn()tetnxo3oadfaD livo t0teuoxrpoydam  miesls)s2urumpno0aex mieiatfm2umn p;u) etrxo oatfaDr ieol(0t2xriopiy4alenmnvsl(fa2ra(  ot4opxn fciad mDrm(mp;u) eenxocio1laDrluvs;t)srumim3iu4lmt mictatfaDtm( pnu4tpxo oeiltfa uan on(4teeoxo oy1oaDrai s t srxrimpio1lpt  iviltf Drm(ro;o4opx  f3iasfaDemnmo t0artomrctodfptr uvslt) rumxr3nydlptn nctas s2ta( ono1tle mi3tatfm2ranmo;t0tlenmr3io1la  au o;s0seur(r no4lpenmfeias)s2rrum no1aptomieiasls2ran s t)arxomo oydfpDe u ols0 rxrio ny4olt  ncs s  Dtr(mpot1oet mociatlmDrln s;u)tetrxfctydlpD livi s0 2tm(o3no1lpenlfvtlt aDur(  ou0opxnmi3tat aDem(vonu0alerxr totop  ai sl() euo(r iydole  ncilt srrrxr ou1tptomicilsla uluvsn() rtrio3ia1latrluvol()s2to(m3io4lmtnmfeil(fsrumxrpnu4tpt iociysfsDel(vonu)aleoif3iodlmD auvsls)srxr(r3iudlpe lnci s)sDrrxmp;u4olenio3iysfs em(vs;u0 rtnxrciodla r ieil()srtoir io4optn net t) 2uaurp;u4altnii3iatfs rlumsn(0alxomo ia1fm elnvil(0tetrirpiu1alte ivsls)sDta( p;t1oetoii3tadfs2rlnmpnt4artoxocty1omDr uvil( s2xm(mpoydll nmnvtat)artaxroot1tlxnifeiysla rln s;()treomr ta1fmtraues t t2toimpiu4olt mivia(  rrmx  nu1oexomf3iysls2eaumsnu)aetnmo iadlmDrau s;t)t2tr(o iy1lpe  ncsa( sruaur nu4aexo oetys aDrmumpnu0 ltnxo oadfaDr ieo ( s2trxo3iydlp emieiatf 2umur oo0opxo i3tytfsDrmump;t4aetrmr3ty1op  ai o;t) 2urxmpnu1altelfvta(  2rrump;o4tltniieiysfmDuanmsn(0 reoxf ty1lmt  n i;s0setrir nodol nlnvils) Dra(ro;u4altomfeiydls2ean snu0trtoxr totla raueilt)trtoirpno1amenliet ()s2uaur ;u1alen ieilsls um( snu0 reoir tatlaDe n i;(0 rxmir no1ape mnci t) Drrxro;o0oeen i3tltla2umumo;(0altnmo3oydfpD luei;t)s2toir3iydom nmivi s srumx pnt1texniieiydfs rl(mpn(4 eenxr3oy1lmD aneils  rxmio3nudlptnmict s) 2taxmpou4opto oeild s umums t4tltomo3iotoaDr nvsl()srxmxm oudoltnmfetl()arua(rono4ape  ietld a ra(mp (4arenxociotopDelieo t)setrirpiudomte nct ()arur( p;o0ale if3iytls2rlnmp;u0 lxomfctydlaDr uvol( teurxr3oy1ap e icia()sDrrum nu0ape mfeias a2em( s u0arerifciy1fm  lnes;t srur(r oodap emivt s aDrau  ;u1oet  i3ild s uln o u)trxrxr3oadlpte uvo;t)srtrio oudop elfcsatfsruax onu1tet moeiydfsDrln s;u0 etrir3totlmD  u s ( s2xoimpoodamtnmfvsat s2ur(r ;o0apx if3iltfa ran p;u)aetrirctydlmtelueo s) eurim3oo1lp emfvta(fartaxront0tltnifeils a2rlump;(0aexrir to1fat aueo;( trtr(o3iodolt  ncsls sDuau o;t0apx iieias s rl(vs;u4 eeoio3to1lpDe i o;t) etm(m3nu4altelfvtl(  rtaxmp;u0opeoii3tatla2ul(vp;(4arerircia1fmDraivsls)t2xm(m ny4apeelfvtas srur(mpno4oee mo3ildlaDeln s;(0 lenxo3iatoatelnes s  exo(r3no1lle  fetasfsDrmxmp;o0apeo oeiatfsDrlump (4 renmf3todfptraneilt) rtrio3oodlptn net s) Dum(mpnt1aetn feiatlmDua( o;t0aeenmfciy1oaD lu sls) eurirpiudam
\ No newline at end of file
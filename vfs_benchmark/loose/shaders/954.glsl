@@ -0,0 +1 @@
+nes;( t2xrir3io4ap   ict s aDrrxmooo0aetniociydls2ulums t) rxomf3ty1fp eanvi t0 etoio iodllt miesls srtm( pot1altnio3tytfa2eanmo;t)artoio3io1oat  n i ( sexrio3iy1ll nlfetls)artrxrp;t4alxnmi3iydlm ulu p t0 exrif3tytlm elnvi s0 rxo(o iudame  iei () Drrum oo1tlx ii3ias aDel( pnu0teenif3oa1fpD liei s0t2ur(r ou4ale  iesl()sDtmxroot0tltoioeiytfm2rm( s t)tetrxr3iotfat ln s t)tetmir iy1apenmfeilsf Dtmu ono1oleo fctltlm2ul(mo () eenmo oo1oat lnvi;s0s2toxopiu1lmt lfeiasfarur(r nt4tpx  ieiysfa2rau o ()aetnir iatlmtrlnei (0texm(m3iu4lmtemivsat)a2rax ono1open icilsla eanvp t4tlxnxoctotfpD lneo;s0t2um(r nodom  mfeilsfa2rrumpot4opx iiciad aDuln s u)texnircoodlmtr nvi t0t2umim no1lme livsasf rumxmont4texoiiciadfs2elnmpnu4 eeomociodopDelivo;(0t2urio ou1lptelnctat)a2ur(ro;o4tetn octatla rlu p (0aexomo iotlp r ieols trtrxo iodlm   fct sf Draxmpnt1teto i3ilsfa2eauvp;()teenmr oydlm  anvs t) etoxm3no1llenlfcslt a2raxmp;t0aexnmi3tysls2emnvo;t4 ltrmfctatlp e u ol()s2ur(mpoudll n nvtasfsDua(rooo4ole mo3iydfs2ra(vp;() reomr3oodoaD au sl( t2trio3nu4optn nctl()s2uru oot4ole io3iysfsDrauvs;u4 rtrmo3oy1fptranei;t0trurxopou1ope mnvi ()aDrmxmpoo1aex mfciatfsDeanvs;u)tlenxfcoodoptr n s;s  2xoim3iudlm n net sfsDumxmono4tlx moeiytfa ra(ms;()tlxnmo3iodlmD  uvi t  2ur(r oo4llee nvtas) rtmum ;o4tpe iieilt mDrl(mpnu) lxnmo3iatlp rlnvol(  etr(mpiu4op n fvi s sDurxr ;u1tlen fetad mDrlums;(0texoxf3oatlaD  i ilt)srumxo3oudol elfct sfa2ur(r ;t0altomo3iyd a2rmuvs;u0tetnxf3tytfpt ln s;(  2tmxmpiudapte ivs s)sDtru ono0alxn ietlt a2uau o;t4texnio3iodfptrluvolt) rxoxrpno1al e fet t  2trxm nt0tlxomfctydfaDuauvon(4aleomrciatfmtr iei t) 2xmirpnu4lm elfctl(f Duaumpou4opt  o3iys sDrmnmpnu4trerio tadfmt lu s;s0 2urxm iodoltelfes tfarua( poo1altnmfeiat m2ranvp;t0artnif3oytlatr ieo ()trxrxr3no1lpe mfcsa(fa2um( pno0tee mo3tas a ea(ms t0alerxrcia1lmte ivils)srxrir3oudll  mneslt) rra(  ou1aeeo o3iltla2raums t4aexoxrctytom ean o s) ruo(mpoy1ome  netlt)s2uax pno0tltomi3tls s2emumo;t) ltnio3iatfpDrluvols  2xmxm3nu4lp n fcsatfarumxmo;u0oltn fetlt sDeanmsnt0artrxf3oodlat au ol(0t2xmxopnydlpt liciatfs2taxr nu1apenioetasls2ulumpn(0arxnmocoytfmDr u s;s0sexr(o ny1am   feilt)srtrxro;t1opt  ictlsla2ean o t0tlxnxr3oo1fmD anvols0t2ur(o3oydlpe lnvsatfa2um(  ;o1tex iociyt a2uln onu)trxnxfciatoaDran o t0tetmiopoo4openmncilt a2umxmpou0altnmociydfaDrlu ont0tlxrmo oa1fmtranes;()s2xoxo3iydape lnetat  2rm(r ou1tlt mieiyt s2emnvo;u)trenmrctadfpte uesl(0 etrxo3iudlleemfcsa( sDtau  no4apeo i3iytfs rmnmp t)tetoxf3iodlaD aiei s  2umxr oy1apt lfet ()aDur(mo;t1apxoiiciyd sDelu s u)tleomfcta1fpDelneslt)tetm(mpiudll e iei t)sDtaumpoo1tlxn i3tldfsDel( s;u)aleoxf3tadfptr n i (0texrir3nydamtn iet s  2rm(rp;t0tpxoiociytla2umnmp u4texomr3ty1omDeli o;t sexr(o3no4alt mfct s srrm( ont0tee  feiatfm uan pnu) renio3iytfp elu i;(0sexrxr oy4olt livils srtax  ;u0tex mieiyd m um(vp;(4teeoio3oytlp   nvsl( srum(mpoudame mivs t s2ur(  ;t4aexomoeiasls2rau on(4alxrmf3iadfpD  nes t)sruo(mpoudole lneil( sDuaxro;o1olt mocilsls uanvo;t)arxomocty1opt  u il(0trxmxr iy4alt mfetatf ruax p;o1alenioctlslaDum( snt0alxomf tatopDrlivil( s2urim3oudll n fvsl() Drmu p;o4tpe moeils aDumn p;t0alerxr iodlmD aivi t t2xm(r nodope lfvtat) rtrumpnt1tetnmoetlslsDumumsnu0alenxf3iydfp  lieo s)trxmimpny4lm e nvia( sDrmuroot4apxo o3tadfa2um( pnt0aeeoif3iatfm r i s;(0setmxm iu4aptnlfcsat)arrmxr ot0apt  i3iysfs eluvo;t4tlxnxr ta1fmDe ieo;t srxo(mpiudop   neiasfa2tmxmp;t4olxn ociyd sDrlump;t) exoif3oa1fa eaivolt)teto(o3io4lmtnmnci s) rur(r ;u4teto oeilt a umu s;(4 eeomrciatoateln s;(0t2to(o iodlmeemnvt ()a2tmu p;o1tltnmi3iltfa2rl(mo;u)aexnmo oytfpD lu i;s0 eurxm nu1ome mfct (f 2umx o;u4tlxnii3tlsls2rm( s (0tetomoctytfa rli o;t)srumim3oydoltn ies t aDrrxmp;u4aeto ictldlmDelumpn(0 rxomfcia1opDe ieo;()trxrir3oo1omtn fvs (fsrraumpnt4tltniietad a ulnvpnt)altriocta1omt livs t0 eumxmpoodlltemfvtlt srtr(m ;t0tpenmieilt s um(vpnu) rxrir3iatopt livs;t  eurxr3io4llen ivilsfa2raurp;t4aeeo oetas m2rl(mpnt) renxr3iodfmDe uvo (0srxoim3oy4amee ncta( sruaumonu1apx  ictydls uln o t4aeeomr ta1fmtraivs s)truoiopny4lmt lnvtat  2rmu poo1tpxnmfetyslaDelnvp;t)aetrmociy1omDrlues;s) rumir iy4omtn fcslt aDrrur ou4alt if3tysls rmn sn(0tlxoxr3oa1lpte uesl()teum(m3oudom emnvtat  rra(mo;o4opx if3iytfm2ua( s ()tlxrxf tydopte i ilt)s2toxr oudap elict (fa2tm( pnt1ope  f3iatfm ea(vs;u)trxoxfcoydla   ivs;s) etmxm3ou1lmee fvi (faDtmu  ;o0oeeo f3ilt aDrl(mp;t0 eerxrcty1lpDrliei;t0 2umim3iu1amen ivsat  rtaurpot4opx  ieiatfmDemu o u0 ltoioctotomDeaiei;t)texriopiy1ll n ictltfaDtrur ;u1tet iietltfsDrmn pnt)trtnmr oatlmtraneo s  2tr(o3oo4optnmfci (fsrurxmo;t4tpt mietyt s2ea(mp;u0tltrif oadop rai o;t0s2xr(m3oy1ame  nvt t  Dtrxro;t0tpe  fetasla eanvp t0altrmrciatlpDe i o t) etrimpiy4lpt  neiasfarumumonu0tpx io3iysla2ua(msn(0 lxoxr oatfat  ivi (0sruoxopno1om emietl()arua(rpnu0oeeoif3iytfaDumnmp;()tlxrxr oo1lm   ies;s trtoir nudlptnmietasfaDurxrpot1ope  i3iasfs2eluvs u4texnif3oydlp r i ilt) 2urim3iu1lmtnlnvt (fsrta(r no0tlto feilsfmDulu o;t)artoxr iytom raies;t)s2xm(m3iu1opt lfet ( artm( o;o1tetnmfciys s ul(mp u)artnio oodfp elieo;t) rxmim3oydlm n ici tfs2um( p;t1tlxo icilslmDulnmpnt4arxrmfctadop r iei s0t2xoir3iydol nlics tfs2tmxrp;o1teeo fctlt aDum(mo t4areoif io1lmtrai s;(0truoxm oodol emncs s)arumu p;o0oetnmo3tls m2rlu snu4treomf iotlaD li i;(  2xoim3no4ope lfesl(  2ta( ono0opxnii3iydls rmnvs;(0teermrctodlaD  ieo;t)teuoxo iy4ap elicta()arur(m nt4alenioeiytla2umu p;u4trxomocoodoaD  nvslt  exoxo iodopenlfvta()aDtmur nu4olen fctlt s umnmo (0alxrircoa1lm  lnesls0t2xrxr oy1opeemivi t artrxroot4tltnmieiytlsDra(mon(0tlxoio3io1laDraivol(  rxrim nu4om nlivi () rur(m ;t1teto fcild aDem(mpnu4 exrif3iatfpDrlivi;t sruoio iodap nmneilt)aDumu p;t0opx ifeildls2ul(vpn(0 rxrxr ia1lmDran s;(0tetoirpiu4alt  nvslt)sruaxrp;o0tpeoio3ild a ua(msnu) etrif ta1lpDe i i s)trurxr oy4altemnvsat) 2trur no0oee moeiyd aDum(vs;t)aexrio3ia1fpDe i s;t0 rxrxo3nu1lltnmict (f 2rr(r ;u0tptoifeiatls2rlums;t4 etrif3tatfmDrlies ()srxmxo3iy4olee ivilt srurxm ;t1alxoioctad a rm(mont4teeomf3to1lmtrai o;(0 2uoirpio1op  livil(fa2um(m no1alxn oetld m um(vo;u4 rtrxf todomteai slt0srxrxm3oo1op emicsl() rum(rpot4oeto oeiad s2eanmo u4trenif3oadlm r ieo;()t2umxo3nu4opt livs sfs2uax  ;t1tpxnmictltls rmnmsnt4tlenxfcty1laDrli s;s s2tm(r io4ll nlnctatf rur(ro;o4tlt if3iydfm rmnvs t0areomr3oy1omDraiei s0srto(mpoo4op e fvs t sDta( p;t1tpt  feiytla2rluvs;()trtrxf ia1omDeai slt  2xoiopiu4ale lfeils srtrum oo1tlenmociyt sDemnms;(0alxnif3ootlm r ies;t0 etr(m3nydlp  mnvsat srumx oot1apeo i3tltlaDra(mo;t0trermf3iytomt  ivo t t2tmio no4am  lfcta()s2tmx  no0oltnio3iytlsDrmnvo;u0 rxomrcta1fpt lnvi s0t2toxr3no1lmenmieil()arua(ronu0oltoii3iatlm2ulu s ()texrircoydfpt ai sls)srur(r3ou4oleelneilt)a2umur nt0oee  feiyslsDea( p t4trxoioctytla r u sls) 2um(m nydamt  ietlt)srua(ronu0oeen ociadlm rlnvo;(0artrio3oodlmteauvils)s2toxrpoydalenmnvia( sDrmxr nt1oleomietad m2rmuvp;t0arxoifciydoaDe neo s) 2urxo no4optn feil()aDtr( oot1tltnmfciytlm em(mp t)aeerio iy1lpDrlneil()s2tr(r3io4omenlnvs s)s2uaxr ;t0aee  f3tlslm2rm(msnt)arxnmf iadlp   u s s) 2xrir oo1ll elnvta( s2trxmonu0aptn f3iys m2emnvpnt)altrxrcoa1fat lnvo t  etrxrpiu1ll  mfctls a2tau  nu1tlxn octytls2uauvs (0 ltnxf iydfa elu s;t seuoxm3iy4lmenliviat)arraxmo;u4tlx mietysla elums;t0aleoxfcootfa  li o;s0s2xr(opiu4opt  ivsls  2uau oot4tex ioetasfs uanvpnt4teerxf oatoa e uvi ()t2trimpny4alt mivs sf rumxront4altoii3tad m2ea(ms;t4aetrio3iytlpDe nvs;t) euriopio4lmenlfvtat a2rau pot0aet iieiysla2ea(ms t)trtniociatop rlu slt0 rumimpnu1om n neil()aDta( onu0apeomo3ilsls2ua( p;(4 rtoxf oa1fpDraiei;s  2umir3iudaptemict sfsDtmx  ;u1oexn octat a2ul(ms;t4aexrmo3iydopD  i sls) etr(rpno4lptn nct s s2trx pnu0tleo o3iyt s rmump t) rtrmo oytfptr uvsl( t2xrim3iy4ol nmfet s sDtm(rpoo0alt iociydfs eau onu)tlxomo3iodfm rlu s t0tetrio3nudoptn ivilt sDtrxm nt1tlxo i3tysfm2emn snt4trxnxrcoatfatr n olt0tetrirpny1oltnmivias  rtaxmpot4altoioctlslm rl(msn(0tlxoxr3io1fmD ln o;(0sexr(opnodameelnvs (fa2uaxmp;t1teeniociasfaDua(ms;u) rerxf iytfaDeai o;(0t2tmir iudal elfvtl()a2ta(r ot4aee mieildla ul(mon()teerioctadoptraiei ()teuo(o3iy1amtnmfvsltf 2rmumpnt4opto f3ilsfmDul(vp (4tetoio3ty1fa   i s ()t2xmim nudome mieias  Drmumpnt0apxomoctyslm umumo t)tltoio ia1faDr n s;t teur(o no1ol emnes sfaDraurpou1tlenmo3ias m uan o u4 lxnmoctatlaD aiesl()trtrir io4lle lncia(f 2tmur ou4opxn i3iasla2rmn p u0aexrmf iatfpteaneol( t2tmiopiu1ol elicias)sDrmu oot0apeniicildlm2uanvp;(0altriocootfm  lieols sexrxo3nydamenmivi s a2trxmp;t1olxnioctlslm2uanvs;u)treoir io1oatr uvi s  2xrio oo4om   ivtlt  2tmum ;t0opxn fctldla emn p;u4 eenmfcia1lm elu o s0 2umxo3iy4ale mfctlt)arur(mp;o0ale  i3iytfaDrluvo;u4 eenmfcoa1fp e u o;s0t2uo(rpnudlmte ictl(faDur( ont0aptnifeiltfm elnmp (4texrmo3ty1la elivo;s  exrxr3no1ole lnctlsfs2uaum nt4tpxnmfciltfa eau pnt0trenio3ty1la  au ol(  rxmxo3oudaptemfetls)sDtru ono0alx  feiys m umnmsnt4 exoxf3iotla e n sls seumxm3nydopenlnei tf Dum(  ;o4tex mf3iaslaDrlu pnt4artoio3oatfmDe nvo;s0t2urim3iy4lm n fei (  Dur( onu1ape iociltlmDumnvs t)texniociotoptrliei s t2uoxm nudllte iet t srraurpnt0opx mieiydlaDrmnms t4aleoxf3iadlmt lueo;t t2uo(o3iy4lle  nvta(  rurxm ou4oexo oeiydfsDran p u) etrxo3to1fmDeau s;t)t2uo(m3nodaptemicslt srtau oot0tlxnmfeiatfaDranmsn()alenmr3totopDr nvil( sexoirpnodll n nesls)aDua(mo;t1tptnmfeiyd m emuvs;u4alxomrctodfpDeau ol( texriopnodlm  lies (farrrxm nu0tpxnmf3iasla uauvp;u4 lxnif ootoaDr ivols)sexmim no1ameemfeilt sDtaumpnu1ape mi3ilsfs2rmn snt)aeenmfcty1oaD  ivil(0trxmim nydoptelnesl(fsDua( oot1tpeo feiysls2umump (0aetrmo3oadfpt  nvsl( teumxo no4lmen ivsl() 2uaxm ;t4apxn f3tat a um( o u)trtrmr ootlate ies;s)texm(o nu4ol  mnvta()arum(rpou4oltn fcias s2el(vont)artrif oydfmD  nvs;s sexrxr3nudameelics t aDtaxro;o1tlto ietadls umu s;(0arermoctodfpDrauesl()setmxm3nydal emneils)srrmur ou4oltoifeilsfm2elnms () rxnir oodlaDean o s srumxr ny4ol elicils aDrrxr oo0ape  feild sDul(vont0aetrmocta1faDe ivsls t2xm(mpiy1apte nesasf ruaxront4oexomfeiytfmDrmumo u) ltrmfciotfmtrli s;t0trxmxm3nodalenlnvsas srraxm nt0tpto fciltfmDrmnms (4tlxoxrcootfm  aieilt t2xrim ny1opt  ivt s)a2uaxmpoo0opto ictatfaDem( pn(0 exrif3iatop rau sls trxrio3iudopenlfcsl() Drmump;t4tpxniiciasfaDrmump;u4tetrxr3iy1fpD ln olt tetrxo3iodllee netlsf ruau oou4aleo feiydla2um( p ()texrif ia1lmtrlies s0truoxopnodlm emnet s sruaxrp;u4aeto fctyt a2el(vpnt4tetoiocoydlp rauvi (  eum(rpio4llte nvt (f Dta(m ot4texniociydfs ea(vo;t)teenxo3iytlmt aiesls) euoirpiu1op  mfvs t)srraxro;t0tlx mfctldfsDuan p u0 rtnmfcto1laD anvo s trumirpou4lp n icil()s2tm(  ou0tetomfciadfm um(ms (4 ltnmr tydlpt  n s s)srurim3oy4aptemfctasfs2rm(m ;t1tleoioeias m ulnvs t4texrio totlp e ivs s) eumim3ou4lp emnet s a2tmur ot0texomietls s2emnvsnu)areomf oa1latraivils)s2xrio3ny4llee fes s sDumxmpnu0alt ifcilt aDeau snt)tltnxf3io1fateaivols0srxmir3io1lm nmfcia() rtm(ronu0tleomfetadlm rmums;u) lermf to1optraiei t s2uo(r iydome  fvtlt)s2umx pnu1texomfeiltlmDraums;t0tltnxrcta1fp e ivo t tetrim3oy4lle lneia( aruaxro;o1tltnmiciatfs2ranms (0texrxfctotoatr ues t)s2uoxmpoo4alen fvs ( a2tm(mooo4oee mfciytla emnms;() exnifciatop  aueo;t  exoxm3oy4amtnmnctlt s2urumpot0aptnmocias m2ea(vo;(4altoircto1oat luei (0s2uo(o iy4lp  lnvt t aDum(mp;o4aexomiciydls rluvp t0trtnif oadfatean s s) 2tr(opiodom  lietlsfs2umuro;u1tex  oetytfmDulnmpnu) eeriociadoa elivi;t0 2urxm3iy4ll  mfct (f 2tr( o;u1olx mo3iadfm2rln o;(4aetoxoctytom r uei (  eurim oy1omee nvi tfsrurur ;o1olto ociys aDrlnvs u4trxomo tadomtr nes;(  2toxm3no4lmtnmnesls) rtm(root1aetn icilsla ean p t4aexoxrciytfaDrai i ( t2tm(m3oo4omeemicsat)artrxmpnt1tet iietasfm el(mp t)aleomr3iotopDrluesl(0trtmxrpoy1alenmfvtl(f 2tax onu4tlen ictldlm emn o u4trermo3oatfptrlieo s) etoxmpoo1lpenmiet s)artmumpou4opxomf3iys m elu s u0 eerxo3ta1fate nvs s)t2toxm oy4omeemnetl() Dtmxmo;o1texoifctldfm2ul(ms;t0trtoio3iotom rlnvi;s srxoiopiudll  lfci s) 2rau o;o0aex  f3iydfm2eaumont4trtoxfctotfp r n i;s sexrirpiy4oleemnvta(fsDta(moou1olx ioctysfa2ran p () exnif ia1lmtelu i s0teumxrpoodlpeemnci sf Dtm(mpot1tex  f3iasfs emumo t4 etnmrcoydla   uvo;()seur(o iydoltnlnvtls)sDrm(moou4tpxoioeiydlm ulnvsnu4aeeoxo iytfpteau o;s trtr(m iudome lictat sDtmxmpot0optomo3tytlsDrm(vo u)aeenmocoa1omtraueo ( seurxo3iy4omtnmfvia()srrr( oou1tptomi3iydfs2elumsnu0teerif totomDeai i s0seuo(r3iu4alte nciat  rurx  ;o4apx  oeiyt sDulu o t4 eenxoctotlpteli s;t)sexrxopou4lmtnmnesasfa2uru pou4tptnmo3ilslaDuluvs t4trtrir todlpteaies s srxo(rpno1alt lfviat) Drrxrpoo1ape io3iat sDumnmo t4 ltrmrciatlpteaivi ( t2tmxr3nudomt  nes (fs2taum ;u4opeomfctys s ua(mp;t0arermf iadfp  aivols)s2urir3nodal  lfvsat  rraum nu0aptnii3iad aDulnvpnt4 eerio oadfmDr u s;t)trxrxrpny1open nvtltfsDrmxroou0aleo o3iatls2rmnms t4aexomo3iadopt  nvil( s2umxmpnodlme lfcils) 2umx  ;u1texn o3iasla rmnvs;()alxrmr3oa1fpDran i (0srxoimpny1opt liei s) 2um(  nu4oeenifcilsfs2uau pnt4altnir3iadfateaueols)trum(o3no4lm n fcsatfsDurx  nu4alxoioctas m rmuvp u4 ltnmrciotla rlivils0 ruo(rpno1omtn icsasfa2rmx pnt4oltn i3tatls uluvpnt4trtnxr iodoa  aivi s) ruo(mpnu1lmenmfeilt) Drmxr ;o0aee mf3iatfs eau p u)tltrmr3oo1oatrlnei () 2tmim3oo1op nlivtat) Dururpnu0texoif3tld sDrauvonu) eeoxo totfm raueilt)seum(mpnydoptnlivt (f Dtaumoou4aptniociyt mDumu o u)arxrxo oa1oaDelivo;(0 rumxmpoo4omt micsat aDra(root4olxo octltfsDuln on()tlenio oadfmtrlieo;(0sexm(opiudlpenlieil()srrrx pnt4ope ioeiat mDum(vpn()arenxr totlm  anes;( teur(mpou4amtemfvias)s2rrx  nu1aetnmo3iltls2elnms u)aetnio3ia1opDr n s s)t2xrxm3iudlltnmietas)artr(m nu0tlxoio3iadlsDrmu s;()aeeomocoydfpte uvi;t  2uoxo iu1lmenmnet s aDtmxront4apeomictydlm rlumsnu0aeenir tadoaDrauvolt0 eurio3no1optnlfvias  Drmum nu1tltnif3iytfa2ul(ms t4tleoxr to1opDrli i ( teumxopoudolenlict (f 2rax o;o1altnifctysfm2eanmsnt4arerxocoatlat ln o;t0 rurirpno1ap e nci ()aDtmu pnt0optomieias a emn on() lxoio iadfaDrlueo;s0texrir3io1lp nmfcsasf Dur(  ;u0opt mf3tytls ulums;(0tetrio3oytfpDe nvo t s2trxo3oy1openlnci ()s2umxr no0tle ioctasfs2ul(vs (0texrxr3iatlaD an ils0s2xmio3ny4lmte fci t)aDtrxmoou1oetnmieiatfa2uauvsn(4alxnxo todlmtr u i (  2uoxopoudopee ivi ()s2tmumpno4teeomo3iytfaDem(mo;()teerifciotlpDeauvolt)sexmxmpnudllt mnesa(fsrrrxmp;o0texoio3tys s2umu o;t4tlxoxf to1fm r n ol( srum(mpno4ape livils arrr(mo;o0opxoifcilsla ean pn(0arxomrciodoatelu s;(  2xoirpiy4amtelnesa( srtm(  oo0tleoifcilt a2el( p t4 lxomfciy1lptrli i t0 rurxo io4olte ivs t) rur(r no1teen i3iatfaDrm(vp ()trenir3ootop eaieo t) etr(r3nu1olenmfci (  rraxmp;u1oetniociyt a2rlu o t4texomrciotopDrluvs s0s2umxr3oudalen nvia(farumumoot0tlx mictlt aDeaumsnt4 lenxr oytlpDe u slt  2xoxopio1lpenmici s  2uaxmooo1aetnmociat sDeaumo t)tltomo to1omDrlues t trurio3iu4om  mneias)sDua(r nu0oltomi3iyd a ean s t)aeeoxo3iotfmtr n ils  2to(rpiodap  mfci t  Drrxm ;o4opeoifeiyslm eanmonu)alxrif3oodfaD anvs;s) exm(mpnu4omee ivs s) 2urx  ot0tetn f3tlt a2ulnmpnt0 leoir oadfp  lu o;( srxmim3ny1optelnvt ( aDuax pnt0tlt  feiyd s2eau p;u4tetoiocta1oat  i s s0seumimpiy1opeelncta()aruaxmono0oltomociytls2em(vp;t4trtnxr3iotoaDeli o ( s2uoxr3oy1am emfvt (  2uaurpou4aptoiiciltfs el(mpnt4 reomrciydla   uesls0teumxm oydamen fetat) 2rr(r ;t0opx if3iat sDrm(vp u4 lenmo iatlm eaies;t0t2urxm ou1apen fvilt)s2taumpnt0oee  oetlt a umumsn()alenxr iydoptr ieil(  rxrxo oo4omtnlncsat  2tm(rp;t4oeenmo3ilsla2umump;(0tlenxr oydlm  liesl( texr(o oudlp  livt ( srraxront0aetn ietys a emnmp u4 lxrir tatfaDr n o;s)trxo(r ny1alt  fvsatfa2umuront1tetn ictadfa2umu s u4trxrircoo1opteaivs;(  eurim nydoltnliciltf Dra(  ;t4tpeomo3ildlsDrmuvo u4aexnmf ia1om r ieo t0srxmim3ny4ome mncsltfarururpnu1aeeomiciysls um(mp t4 lxoio3oo1fmDr n s (  2xmxopiydaltemnet t a2rr(m ot4texn ictyt aDel(vo;(4tltnmocia1la r u slt0t2um(o ou4op  mfcs () Dtr(mono0tleoio3ildls2ulu o u0 ltomfcoydfmteanvi;() eum(rpiudale  nctl() 2rmumooo0aeto iciasfm2eau onu4 rtnir oo1fmDeaueols0t2xrxrpoy1omtnlnvt s  Duaxro;o0teen iciytfsDrlnvo ()arxoxo ta1la  ai o t0truoir3oo1ap  lfeiltfarrau ont4ole  icias a2rau s t4alxnifcty1lp r ues;t0sruo(m no4apenmneia()arururont1altomi3tydlaDemnvo u) lxrmr oytfmt livo s sexr(o3ny4ap  mncia( srraumoot0tex  o3ilt s2rmnvs;t4texoxrctodfat  ivo;s  2tmxm oodamtemneils)aruaxront0alto ietytfsDrln p t4 eerxf3oydoa eanesls)srtmimpny1lmenlncs tf rtr( pno4teenmo3ildlmDem( p;t)teermocto1lmteaies;(0 2tmimpiodolee fei tfarrr(mpoo4openmoeiat s2eanmp;(0alxnio totlm rau ils tetoio3iodolenlivt sfsrra(  ot1oeeomoeildfm uanvs ()altomo ia1fmDe n o s t2urim3no1alt lfciat) 2ta(m oo1oeen oeiad a2ranmp;t4aexrirciadlm r ivo;t tetrxr io1ll  lfctls  Duau  nt1apt  f3iltfaDrl( s (4tlxnio tatfpteaiesls0 exrxm3ny1olen ivt sfaDrmu ont1aex if3ilsfa2rl( o t)aexrmoctadfateluvil() etrxm io4alte fcias)s2rr(mo;o4aee  ieiyslsDemu o;u) rtrif3iotom rluvi s)tetoir3oo1lltnmfviasfsDrmx ooo4tlenmfciltlsDeln o;(4aleoxo oo1fm ran slt) rto(o oo1ap nlfeiat)a2rm(mpno0olxomoeiytfmDrm(mo;t0altriocoa1lptr neolt) 2tm(r3oo4olenmict s)arururpnu4apt  f3iyt m rm(vs;t4 exnxo3oa1lp e n ils  exrxm oydlmeemieils a2ur(mpot0oetn feiytla eanvs (0teenif3tydlat aneo t0s2tm(r3nu4lpt  neil(farta( oot1teenii3iadls2rl( o;u)aeenxf3iotfmte ivo;(0t2toio3iy1ol n fctl( aDrrx  oo4alxoifciyt mDel( p;t4 rxoio3to1oa eai il(0 2xrxrpoodlmee ivt t  rta(rooo4oltnif3ils sDrln o;(0 rxnxr oa1oa rluvs;s)srtoirpnu4lpe  fcsl() 2tm(r nt4tpenmieild s ulu o u0texomociydlateln i s trtmimpiu4al elfesat)s2tmu onu1oexomociyd s raumsnt4 ltnxf3ta1fpte neils  exm(r3io4ameelivs ( aDrr(  ;u1aetniocildfsDul(vo t4arermociy1lm e nvo (  2tmxo3iy1ape  fvt () 2trumo;t0aeeo fcild aDemu p;(0 rxoxfciydlmDeau s;()setoio3iy4optelivsls  2urump;t4tpeo feiatlmDrmu p;t0 renif3ootlmDrliei (0trxmxo3iu4olee fcta( s2ra(  ;o4optniieiyt m em(mo t) rxnmf3oa1laD li s t0trxmio io4lp elfviltfs2taxro;t4tptniiciltlsDranmo u)tleoxo oydlpt  u ilt0 ruoxo io1op e ieiat) Drr( ont1tpenii3tydlmDulnmsnt)arerir3oy1fatelnvs t  2ur(rpnudopeemictls)s2urxrp;u1tleoifeiys mDrmumo u0trenifctatoaDeln o;() eumxopiodam  micsl() Duau  ;u1optn i3iydfmDelnvp;(0tltrmrciytfpte i sl() etrir3nu1omtelicta(  Dtmurp;t1oeeoif3tydfmDean sn(4 rxoifctadfpD ln ols0t2xoir3iu1alee fet ( aDum( o;o4opxnioeiyd a uln s u)tlenmf3tatoptrluvilt0srumim nydlptnmivtl()a2ra(m nu1apeoiieiydlsDrmu onu4tltrxo3oatoat  ueol()teum(r io4al   iesl( srra( ono4tee mf3ildfaDul(mo u0 etoifcoo1fa  aues s0teur(o oudlmenlfci tf Dtauro;u1apxomieilsfs2rlnvon(0 eenxfcoadfp   i ils) rxmimpno1alenmfeil(fartm(m ;t4oee  feils s eauvs u0trxnxr oodoa eaiei ()tetoxr3nudlm  liesatfsDrax o;t0tet  o3tydfa rm(vp;u4 lxnmf oa1omtranvilt)trumirpoo1omeelnvtls) 2uax  ot1oleo iciydfm2umnvp t0aetnxfciatomD  ivs s)seur(mpnydapeelfeils sDra(  nu1ole iieiatla2rm(mon(0aexrir3iy1lm r uesl() etmxm iy1ll n fesl( sDuauro;u4oetnifciydfa2ea( o (4teerxfcia1omt an o;t trxrxrpiu4apeemfcils) Duax oou4olt miciytfs rmnmp u)teeomo3ootlatraueo s sexrxo3oydlpeemfvsl(fa2rmx  no4ope  fctad m2ea(mo t4 rxnif3totfm rlnei;t s2tr(r3nodaltnmfesltfa2tmxrp;t4apeoioeiltfa2ra( o;() rtrio3iotlaD  ivo t0seuo(o oy1lptnmivtls sruaur ;u0oetomi3tys m2ran pnu) rtomo oydlpDrlu slt)srtm(o3oy1lleelfes sfa2rrxrp;t4oeeo oeils s elums (4artrxf3oydlptrlivs (0 etr(o nydllenlics s)srtru oot1optoii3ildfs2rlnvon(4areomo ty1lp  li s;t0 rxoio nydlle  ietls s2urumo;u1opxn feias m rmnmo u4alxoxociatlm e nvs t t2toir3io1om n fvi tfaDua(monu4texn f3tlsfs2rl(msnt)aexrxrctatlp rau sl(0 rxrxopoo1opeemivs ( s2uaum no1tpxnmfciytfaDrln pnt0 ltrif3tydomDranvs ()s2umxrpiy4am e ivias) Dtm(ro;t1aetn icildlm2umu snt) exnxf3ta1omt lu o;s)srxrim3nu1lpe  feiatf 2rrumoou4tpxoif3iat s rm(vs t)aetoxo oadop eln o;()sexoio3iudlme mnetlt) 2trump;o1ale mi3iat aDelnvs;t0aexnmr oatlpDrli i (0seuoimpiudal elfciat  rtr(m ot0open o3iydfmDrlnms ()aetoxoctytoatr u s;(  rum(rpou1opeelivsas)srrm(rp;t0apt moctltla2uanvo (0 reoircoytopDranvs;(0t2xrxr3io1om nmfviat s2ururo;u1tltnmfeiaslm rau p;u)artrxf tydfm r i o s  ruoir nu1ale lnes sf 2tr(m ot1opeoiociadlaDranvs;t0 eermr3io1fmtr nei;(0trum(m ou4lp nmieta( aDtrx onu0oetn f3iltls rl(mpnu)artnmf oa1fmDeai i s)trurio3iu1ome  fcs tfarrrur oo4altomi3tlt sDrau s;(0trtnxr3oodfa   uei;s t2xr(m3iy1amenmfetas)artaxmoou1tpeoioeils mDuauvo;(4areoif tydfmDr uvs t)srxo(r nu1lp emfeias arta(mpnt1opeomf3tadla2emnmo t)tetrirciadfptr n s;s0 rtmxo3iy4lpenmfci tfa2tauroot4oeeoio3ias mDrm( o u)tetrif3to1fmD anvolt trurxrpiu4ale miviasfaDtmxrpoo0teenmfeiatlm umnvs;(4alxrmr3oy1lp  au s;() etoiopiy4lpeemfciatf rrru pot1ope  ietltfa2rm(mon()altrmr3iodfa eaues;( sruoirpnydapte ivtlsfs2urx o;t4olto f3tlslmDra(vsnu0aleoxocoodfptraieolt)srurio3oo4om elfet s a2tr( pnt1opeomietld aDul(vo t0 etoir3ia1om eaiei;t0trxo(o3oo4amt licil()srrax p;o0aexoiociasfaDrl( sn(0 rxnircoo1lm rlnei ( t2xoxm3iudlpeelnvias) Dum(rpou0opt iociytfmDel(vs;t4aexoxo3tydfat  i slt  2xmxo iu1aleelfesat a2ua(moot0oexo ieiaslmDrauvon(0aeeoio iadlmDrliesl(0 2urxr3io4op n fctlsfaDrauronu1tpx io3tyt m eauvpn(0alxrmrciytopD luvo (0 2umir oo1lpe  ieilsf rraumpnu1oltoiiciydfaDra(vo;u0 eeoxr iytom  li o (  etmxo3ny4om nlncils aDtr(mono4aptomo3iydfsDem(vp;u)trtrir oytlpDean s;(0 2toxr iy1opt  iesls aDtr(ro;u4openmoctlslsDrl(vo t0 exrmo3tytfaDelieols0 eum(opoydape  netas sDuax oot1tptoiieiytfsDeanvp (0tetnxf tydopD aues;()trxmim3io1lle  ict s)sDtmxrpoo1alxo ieiydlaDeln s u)tltnifciydoaD lnvo ()trtr(r3iu1amtnlfctlt) 2uauro;u4tpeo ieiysfsDuaumon(0tlerif oatlp r ivi;t s2trxm3io4aptelneias arrrx o;o4aexoiieiydfa rmn pn() lxrmo iy1om ean i ( t2umiopoy4al   icils a2tm(rp;u0aetnioeildlaDuan ont0 rxrmf oo1fpDeau s t) 2uoimpoy4am e ieia(  2uaur nu4opeoiieiltfs2uanmpnu0trtnio ty1lp  ai i (  rum(o oy4olt  ietat aruaum ;o4aet mieild a2rl( o u4areomr3totlmDraieols  ruo(o3no4ope lfvs tf Drm( ono4alx mfeiatlm rlums;t0 etrxfcoodfp rauvo t)srxmxr oo1om elfcsasfa2rau pno4apx iieiad aDumnvs;(0 rtrmociadlp  aivol()tetoio iu4amenmfvsa( srua(rooo1tlt iieiatfsDul( p u4teenxo3todopteaiesls0sruoiopiydopt mfcta() Drmurp;u0oleoifetat s eln pnu4alxrif io1fa rluvs;t t2toir oy4ome  ies ( sDur( ont1tlenmfetytfa2umu s t0aeenxr todlaDe uvi;(0tetriopnu1altnmnvslt)s2trumoot0optn ieiydlmDrau s;u)texrxfctydfmt lneo;()sruoio3nydlpe  ieta(fsrurxm ;o1alxn oeiyd m2rlnmon(0alxnxo tadfmteaies;s  2xoio oodlm e fci t) Dtrum ;u0aet mfetlsfa umnvp u) etrmo iatfpD li i;s srumir3oo1altnlfvsa( sDtmxr ;u0tex mf3tatla2umuvo;u) rermfciodfaDr nvs;t  2urio iy1omee nctls)s2tmxmono0ope mfctldlm2ulnvpnt4trxnmf oadfmtrlu s;( srxoim oy1lpenlict (  2umxmooo0tetn i3iysla ea( s (4arenxociytfm   ies ()s2uo(opiudlptemivs s srrr(r ;t1alenmfcildla rl(vp;(4areoxrctotlaDr uei t0trumxrpio4ale lncsas)sDrmxm ;t0aexo f3tasla rlnvo;t0 lenio iadop r ivs;t)trtrim3nu4altelicsat arum(r ot0tptnmoetltfs2rm(vo;(4arxomrcta1lmDrai ils tetmxrpno1apt  fcsat)s2rmurpno4oetn ieiaslaDrluvo;t0tltrir tatlmtrln ol(0 2trxm ny1ap nmnvilt)a2rmx ooo4ape io3tas s rlumo;(4 etomo to1fp raivols)t2um(m3oo1opee fcsa() Drmxr ;t1opxomictld sDul( o;t4arermocoodfmteanes;t0setr(m ou4omen iei (fa2umxmp;t4tlenii3tydlmDul( s;u)trerifciytlpt  ivil()teurirpio1lpt licta(faDtrxrp;u1tet iociadfsDumn o u4altrxr io1opt  ies t) exm(m3io1lmee ict t)a2uaxmoot0tpeomf3ils aDelnmp;t0 ltrif3oydomtr ieil( s2xm(o iu1amenlfcia()s2ra(mp;u1oee  ietadfmDuauvs ()aetnio tytlp rluvils) rxo(o3iu4op  mfeslt)s2taurooo4olxniiciasfs2ea( s () rxomf3oytlmte ieo;s0 euoxrpoy4ll   nvsasf 2rrumpnu1alto o3tls s rm(vs ()aetnxo oodfpDe u o;(0t2xmxm nu4om e ivia( aDtmx ooo0tex  ietls sDranmont)teenxf tatfatr iei;t)s2tm(r oo4lp  livias  rtaxrpoo4optniociytlaDemnvp;t0alerif to1oaDraies s0s2tm(o3ny1lltelncsatfsDrauroou1alxnmo3iad a2ea( s;t0arxoir io1fate i ol(0t2um(m3iy4lpeelieia()aDtmuro;t4apeo ictydfmDeaums;u0aleomfciydlpDrluvi t)teumir3no4om elfvslt) Dua(m ot0tpxo o3ild sDrm(mp;t)texrmr3oydfaDr ivi;s srtrxmpoudll nlfetatfarraxmonu0oeeomictls a elnvon()tetrmo3tadoa e iei;s)trtrxrpny1amt  ncs t) rraxro;t1apx mf3tas m2eanmon() etnir3iytomD lies t)seum(m oo4aptnmfct s s2taumonu1apx  ietlt m2uln ont4tlenxfciadlmtr ieilt) rxmiopio1ale mnet sf 2um(rp;o4opto o3tyd m2emn snu0altoio ta1oatrln i;t)setr(o3no4ll nlfcsls sruaurp;t4tpe mociatla em(vp u4trenxo3iydlat au o;t0sruoim3oydll n ieilt)s2uaxr ;o1opxn oeiysfm rl(vo;(4 etomfciatfmt lueolt0teuo(r io4openmiesasfa2rr(rpot0oexo oetadlaDrmu pnu0aleoirciodlat ln i t s2xo(r iudome  ivsl( aDtax  nu4oexn fciyt sDea(vs;u0trxoxocoatla elieo ()t2xr(m oy1al nlict ()s2ur( pou4oltnmi3ildfsDuanmon()trenxr iadlateaiei;( texm(rpnydoptelfcs s) Drmxmoot0tleoifeiasls rlumon()trermocia1oat  ivs;s) ruoxr io1lme  fesat)a2trxr ou1oetnmi3iadfsDulnms;u) rxomocoo1om r ues s tetrxmpiy4omenmfvs ( aDtmxrpot1apxomfeilt sDumumo;u0alxrio3oodlatr uvilt  eurxo io4amee icslt  2raxr ;u1alxn i3iyt s2um(msnu0artoio oatfaD lieol() exrxo oydlpenlnvsatfsDta( o;u1altomictltfaDumuvo u)teenmr oa1fmDr ivi;t0t2tmimpou4lm n icsat srurum oo4oeen iciatla2ulumo t)trxnir oytfp e uvi t  rxr(m nudopen ncia(  2urxm no4tet io3iys m2rmnms;u) eermrctodfmDelivil( sexo(m oodameemnetls  rtaxmp;u1tetnio3iadfs ra(von()tlenir ia1faDrlivs;s  2tm(m3io1omtelnetls sDrr(mpnt0oet mocildla rmu s;u0arenircoa1fmD  n ols tetoim nu1amt livtlt)aDuaxmoot4olxn iciyd m rln pnt4 reoircio1fatrlivo t)tetm(rpnu4lltelnct t)a2umxront4tpe ifciyd s2rmu onu4aleomrciadom r uvi s0 etrxr ny4am nlies t)sruru pnt4olxomoeiasls emnvp;u0 eenmf3ia1laD aueo t0t2xoxr3iodol  lfvil()a2um(roou0tptomi3tytlm2ul(vpnt4texoxf3to1fate neo;s0setrio ou1lmt  fvsasf Drr(mpnt0aptomfctydlaDulnvo u4alxnxf3iotlpteliei;t) eum(o3iy4lpe lfcta( artrxr no1tetnmieiyt aDeln o;u0texoir tydlmtrai o (  rtoio io1al emicsl( artmxrpnt0opxnioetydlmDrl(vsnt) rxrxf iotoaDelies (0 rum(o3io1ll n nct () 2tmumont4aptoifeilslm2rln o u4tltrmfcoadlaDe n olt)truoxr no1lmtelnet tfa2umxr ot1tptniietldfm2eanvo t)aexoxrcio1lmt  nvs;t) exrir oy4omtelfvtl(f 2rmum no1oeeo f3iyd m2ua(ms;(0tltoxfcoodlm ran s;s0tetrimpnodlpenlnet sfs2tmumpno0tpx  o3iatfsDeau p t)trxnmo ootfaDranes;t t2xoxopny1ope lnes ()sruaur no4aexo ieiysfmDemumpn(4aeeomf3tydoate ies s0s2xmio oudome mieiat artm(rpnt4aex miciys s uauvpn(0arxomf tatlm ranvo;t s2xoio3iy4ap  mneiat) rtaxr ;o0apeomieilt mDelums u4aetrxf ootopDr nes t0t2uo(r3oydlm nlfvils srtrxm nu0tleo fctytfaDea( sn(4 exnmf oo1oateanes s  exo(rpou1oleemfeilt srtm(  nt0optoio3tasfa emuvp;t)trtoxfctydfmte i s t) 2ur(o3ou1apeemfvta( a2uax p;o4apxo ieilslmDem(vp;u0aexrmo3ootlatelu s;t)trxm(o oo1omenmfei tfsrrru pou1opxn octld aDemnms;(4tetrmr oytfpD lnvi s sruoim oodom e nvsl()a2ta(  no4tltomi3ias m um(vpn()texoifctytfa rlneols0t2uo(mpiudap n ietlt  Dtrx ooo0tleoiociydls eluvont) ltoxo io1oatelivi s  etoxmpio1optnmnesas aDumu onu4alxn o3tydfaDrm(mo t) ltoifciy1om  lnvo s0 rxmim3nudolte net t)srrrurpou1tleomfctydls rlu s t4treomo3tydoaD ln i;( trurirpoydllenlfcsatfsDrrxmp;u0tee  i3tydls umumsnu0altoif3oo1fpt anvo;s  2toxr3ou4op   netls)sDtr(mooo4oleo feiaslsDrauvp u)trenxf iytfat lnvslt0 rum(m oudal emivi ()srtr(m ;o4aleomf3ilt m2ea(msn(4teerifcoydfp r ieo ()setrxmpoydll emnctl(  Dur(r ;t4tlto i3iat mDrmumpnt4 rxnir iadfpt lu ilt0s2xr(r no1lle mfcia()sDrm(rp;o1tex mociatfa ulnvp;()aleomrcta1omDr u sls0teurxmpoodll  lfcsls sDra(m ou4alxnmoetatfm2rl(vs t) etrxrcoy1opDeluvs;( srurimpiydole mivsltf Drmu  ;u4oet mieiatlaDrmnvo;u0trxrxr3iodoaD livi;s  2urir iudlm n net t s2rr(mpoo4tlt moctas a el( p;(4 leoxrciytomtrln ils0tetmxopoodll elivslt s2ururpoo0oee mf3iysla ran o (4teenmr iy1lm  lu o (0t2xmio ou1ll  mivi ()sDrru o;u4optnmi3iytls emuvont)tlxnir3ootfpt aies t t2trxm3no1opt micsls sDur(mpno1oex iieiytfm ulnmo;(4tetnxo oy1lmDrliei s0tetm(m ny4om n fetas)aDta(rono0tleoii3tas m2ran sn(4tltomo3iydfpDrluei;t0teumxmpoo4lpenmnesa(fartm(roou0oetnmo3tydlmDumn pnu)alerxo3iy1faD ai ol()sexrxo3ou4ome  fvilsfa2rr(r ou0alenmo3tld a rlumon(4teenxociydfpDeaiesls0trtrxo3nudop nlivtat aDumxrpnu1aeeo iciysfm uau s u4artoxrcoydfpDranei s)seto(r iodalenlivtl()aDuaumpoo4ope mf3iad a emuvo (0 renmf3oodfp r i o;s0 eurirpny4apee netlt) rtmxmpnu4aee  feiyslm2rlu s;() etnxrcoytlaD livs s) etmim3iudomtnmfctlt)s2rmumpou1tptnmi3ilsfa2ranvs t0 etoircoy1fpte nvol()trto(m3iy1ope mivsat a2trx oot1oltnii3tas s2eaums;t0aeeoir tytfmD luvo;t t2toim oodamenmfes sfaDrrumo;t0alenii3iltfa2rmnmpn(0aeerxfcoydfat luvol(0srtoirpnu4al nlfei ()aDtaxr oo1tpx mo3iadlsDemumon()aexrmr3io1opteanvs;s0tetoir nydllenlivs ()s2rmxrp;t0alxo oeiydfm uanmont)teenio oa1opD aivils)sruoirpio4llen nvtl(  rraump;t1aet mi3tldfsDeau o;t)altrmr to1oat aueil()t2xoir nu4op emnet (fs2tmu o;u1tltomi3iasfa emu p t) rxoxf3oo1fptr neils  2xoir3io4lp e net ()srrmx oou4oetoiiciytfm2elump;()trtomo ia1fptran sl( s2uo(o ny1opee fvtl()srtru p;o0tet mo3tatlaDelnmp;u) exomr oa1oatrlueo (0s2xo(r ou1lp  mfet t aDtax o;o4apeo octltlm umn o t)trxomfcto1opteaivils0t2xoiopno4lle lfesas) Dtm(r no1aptn f3iydfa2ulu s (4 eeomr3oydoaDeanvsls) euoim3nu4ap  livslt arrax pno1teeo fctyslmDuaums;t0trxnmfcoatoaDe n sls0s2urir iu1aleemnvil()aDurxro;o0olt  feiys s2rlu o u4aetnxf ootoaDe u ils  2uoxr oo1lme  ncslsfaDtaxm ;t0oltnifeilsfm ua(mon(0aleoxfciytom  lu slt)s2umxopny4ome lfcsas  2tmxrooo4tetomoeiydfs2rauvp;u4 ltrif iydlm  li s;t  2xrxopiodom  lfeslsf Dtaxmpot1alen iciytfs2ul(vp;t) lxoxo3oy1fpDranvi t)s2ur(o nu1lltnmfetls srrm( ono0tex  ieiadlm2elu p t0areomf3oy1laDr u i;s0s2to(r io4opee nes t) rrm( pou0olx mictltfm2ul( snt4 renxo todfat  ueol( t2xriopiu4ll nmfet () 2rauront4texniieiyslmDel(vo;(0trerirctotfmtrlueol(0 rxoio3iudop emfcsas aDtmxr no0teeniieiasfs2ulnmsn(4 rtrmo3iy1optean s t0s2urxr3oodolt  nctl( a2tmu  oo0tlxnif3iyd a2uln o;t0artrxo3ta1omDeluvol(0seuoimpiydlp n fcils) rraxmooo4tlxnif3ildfmDrmuvp;(0tltrxo oy1faDrlu o;s trxmir nu1lm   icsls)a2urumpoo1aeeoiietysla2ea(ms;u) lenio3tydfm rlueols)seumir3iudome lnvs ( artmxmpnt4optnifciydls ra(mo (0arxrxr3iy1fpD li slt0seto(r no4apeemieslt aDtru pou0apx  i3tldfs2ulnvo u0tleoxo3tytfp rlu s;()s2ur(opiudame miet s) ruau  ;o1aeeniiciat sDeluvpnu)arermr3tadfm eluei s0seurxr3oo1altnlivtasfsDtaxr ot0oeto ietldfm2em( pnu4 rxnif to1fa e uvi;() rum(rpny4ope mivtat  rtrur ;u0aee moetas sDua(vp () rtomr oy1fp elueo t0texrxm nu4lpt mfvt t)aDtmx oou1alt ifciytla elnmpn(0 ltnxf3io1opDrlivo (0 exo(o iodoleelnvsa( sDrrxmono0aexnmfciysfm2rm(mo;u0 etrio tadla  ai s;s0srtmxr oy4ll nmiesls)s2tauro;u0ope iietlsfmDrau sn(0alxnif3oytomte ivi s setrxrpnudolenlnvt s  Draxrpoo4olxn ictys s uanvsnu4 leoiocoy1lpt  nvi;t  rxo(rpnu1llenmfet s)arrmx  ;u4aetnmfciltfm eln p;t4treomfciy1lmD  ues (  exrimpio1openlfet (f 2tmurooo1oexomfeildfs ean onu4 eermo3totlm e nvs;(0 2tm(o iudlm   nvslt)aDtau  ;o0tpxoii3ild s rlnvo t0texrxf3tatomte i sl(  exoxmpoo4opt micsas) rumxmoot1tptniietldlmDelnms () lxnmr3oydopte n s t)s2to(opoo1lmenmies sfa2tr( pot4aetomfctlsfs um(mont0 rerxr3totlatran s;t)tetrxm3oy1ap n ieils)aDtau  ot1tpenmfctasfa2ranvo u0 rtomo iadlaD luei;t)s2ur(o3no4openlfeilsfs2um(m nt0alenif3ils a ea(msnu)trxoir ty1oa e iei;(0s2umiopiudapee fei sfarta(mp;o4oleomociytlm uanvp (4trxriociotfaDraivsl() 2xriopny4lleemneil( aDrm(mo;t0apxo f3iad m rl( p t4trxnxo ty1oaDrlivo;s0s2urxrpiu1lp nmiet s  rtmu pou4aexo i3ild s2elnvsnu)tlxoifcia1fm   i o;s)t2tm(rpny4lle  fvtls)srtmu o;o0aexnii3ildfsDrlumsnu0 etriocty1om r uvolt seuoiopoo1am  mncsl()a2ur(mpnu1oex mieiatlsDua(vs;(0treoif oy1laDelivi;t)trtm(r iudope  feiasf rtm(rpnt0apto o3iytfs um( s;(0 eerxf3iadlmDeauvs s0trtr(r3oodom  mfctlt)a2rm(root1optomi3tytfm2elnmsn(4trtnmo3iodlptr nvil()s2trir oo1lpe mfeilt sDrmu  no0apeo f3tysfaDea(vs t4arenio3iotoptr ivo s setoimpnydamtemfvsls)arrmu  ;o0tex moctydfs rmnvp t)teeoif tydfaDeln slt  rumxr oy4lp   ivt ()s2rr(r nt1tlenifciydfs uln s;(0tlxnxo todfp rli o s s2tmxr3iy1lm nmieia(farur(rp;t4olxoii3iadls umn on()aleoxfcta1lmDraivol(0 exm(r iudole lieil() Dtr(  nt0olxoifetasfm rm(msnt4 rxnmr3tytlaD  ivo s setm(rpny1lp nmivsa( a2urxm no4aetnioeiasfa ra(vs (4texnxfcia1op  anvils)s2umim oudll nmfctls arra(r ot4alxn f3tlsfm elums;(4altnmfcio1omDelnes (0tetoxopiy1omeelivsl()arrrx oot1teen oeiltfm2rlumo (0trxoif3oytopt aivo;t0s2xr(m3iodal e fctasf Dumx ono4apenmfeiys s2em(vp;u) rtoxfciotoaDeauvi;(0srxoir3nudapeelfctat  2ta(r ;t4aeenmfciad m2eaump;u)areoxfcty1omDr nvs;( srum(m iodop  mictlsfsDurumpnt4aet mieiytfmDumnvonu) leoifciatfaDe i i;s)srtoxr no4al   nci t)a2ua( ont0aptn f3iyslsDranmo;t4aetrifcoy1faDe ieol(0 2xoim no1olenlfcta(  2uau  nt0tlx ioeiad m2rmumo (0arxrirciytfm  anvo t)texrxr nudamte nvsl(f Dumx o;u4teto o3iatfmDulums;u)trxnmfcty1fm e uvs t  eurxrpny1opt  ictls) 2ur(rpou4tle iociasfm umnvo;u) rxoif oy1fptr i i t  exr(o3nydll e fes tfsrtaurp;t4ole iieiys m2elnmo (4tlxnmfcootlmDr nvi;t)srumxm iy4ll elfvtlsf rtmurpnt0tpt  octldfm2rmuvs ()tleoxr iotfp rai o;t  2umimpnu1omeelfvtl(fsDurxmp;u0olxoiocilsls ulnvp t0aexnxr3oodoa ran olt)t2toxo3iydop  mfviltf 2ua(ro;o0tpxoifcilsfa2umn pnu0tlxoif3ty1op raueo ( s2tmxo nodal elnvilsfa2umxrp;t
\ No newline at end of file
@@ -0,0 +1 @@
+nvol() exo(m no1lmtn ncslsf 2ua(rpnt1alxnmictydfm2uau on() reomr3oa1fpt au s s)srtmxo3ny1llee nvs tf Drrxrp;u0alxn f3tasfmDran pnt)tetnxf3ia1fmteaueo s)t2xmxrpnydaltnlfei s)srta(rpnt4oleoifcild m2elumo;u)artnmo oytlpDeanei s0 eumxr3oodol emfcs s a2raxrp;t4tpenifeiatfa ulums;u0aexoir3todlpt aneslt)t2xrxr3ny1optnmfetat)sDrm(roou1tltnmicildfm2rlump u0 lxomf3ty1lmteln s;t) rtmxm3oodaptn net s arurumonu0tptoio3iysfsDemn p;t0trermociytoaDeli i;s0 eto(r3nodam nlivsas a2ra( pnu0aexn fciat sDra( s;u4tltnxfctatfp   i i;s s2toirpiudlle  ies t) Durumoou4tpt io3iytfs rl( s ()tlxrxocoa1oa  livs t0 2uoxm3io4lmtelicias)s2ta(  no0olxoii3iltfs2el( o;t4texrmo io1lm  luvs s) rtmiopiy1optnmfvil( sDururo;t1tlt  ociytls2emn s;t0altnir3tatlp raieo s0 etoim3nodaptnmicsls  2ua( o;t0tlxoiieilsls2emn o;u) rtrio tatlmDe ieol(0 rxmxr iy4optemnes (fs2ua(  oo4tlxomfeiasls ra(vo;(0 etnircootfaDelueolt  rtmio3ou4lmenmfcils arta(m nu0opx  oeild s eln o u)trenmrcty1opDrluvs s0s2tm(rpnu1lp  lieslt)a2urxm nt4altoioctlt a2rau p;(4 rxoxf3totfa e ivsls)teumxr3ou4lmenlfesasfaDrmu  ;u4apxo o3iys s2rauvp (0trxnifciadlmDean il( s2xoir iy1ome mivslsf Drau  nt4altn fciadfa2ulu snt) lenmo iotlmDe u ol( trtr(m oodlmtemfetas s2trumo;t0tpe io3ils sDrlu pnu4tltrxo3totfptelieo;s0t2triopou1apeemncsasfsrrrurpnt4tex ii3iatfa rl( p t4 etomo iydlm rlivs s0t2uoxr iydlm n feia(f 2rrxr ot0oet if3iasfs2um( ont0 lerxrcoy1lmDeauei t) rtrxr oudlltnmfcsltf ruaxmo;o4altoiociasfsDel(mont4teerirciotop rlu i ()srtoxmpnudlm nlieia(  Drrxmo;o0ope  fctydfs ea(mo (0 rtnxocoo1om eanvi;t0sexmxm3oo1olt  fcslsfartaxrpno4teeoii3iyd m elumon()tlerxo3iatom eauvol(0teuoio3ou1amt lfvtl()a2ua(mpoo0olxnmociyslmDeluvsnu) ltrif3tadoaDrau ils0setmiopno4ap nmieias)s2uaxrp;o1aetnmoeiydla2elu p t4teenmrcty1fateaiesls0 exr(rpoodllte fvsa()sDtmx pno4tpxn o3ias s eanvo;t)alxnio3io1la ranvo t0trtmxm3nodlltemnes t) 2trx ooo0opt iieildlmDelnvo;t)trxoif3oadfpt au i t0 rxm(rpnu1ap  livtat)a2rau pno0aetn ociaslm uanmo;u0tlxnmo tadom rln s s  2to(m3oo4lptemieiltfa2tmxr no4tlxo fctld mDrmn s;t)tltomocty1oatr uvs;t0t2tmirpio1oleemncia(faDur(r no4oeenioeildls ranmo t0texrmrcoytfpDelueo t)seuoxmpnodope mfetat  Dtm( p;t0tlx moetadfaDumnmp t4arermo tytlatraiei t)t2xrxr3iudoltnlfeslsfarraur ;u4opeomoeildlmDrau s (4trtrxf iodoatelnvs;( t2tr(mpio4alee neilt s2taurpot0tex  fctasfm ulnvsnu4tetomo3iydlmtran ilt trtrxr3no1olenlfvs ( a2uaxrpno1oexoiicildlmDranvo (0 eeoxo3to1la  anvs s)trtoxr3nu1opt miet t)a2rrxm ot4apx  ietltfsDulnmo t) eerxfciadfmteau sls0srurxm3nydop  lnvsa()aDurxmo;t4aet  feiadfsDua(vp;(4treomr tatfateaiei;s) exo(opoodll  mfeils aDumurp;o1tpeniiciatlm uanmp;u) leoif oytfmD lnvo;s trto(r3no1lpt mivia() rrmx oou1teenioctydlm ran pn(0aleoxo iodlat aneol(0s2trim no1ol  mfvsltfarrrxrpnt0tlen oeiad s rlu snu0trxnmrcoydfatrlu s s t2uoxo3nudlltelfcs sf 2uru pnt1aetnmfciadlm ea( o;u)trerxoctydfp eau slt0s2to(m3nodoleemfeslsfaruaxr ;t0tlx iociysfm el( pnu0treoxr3oodomDr iei;(0srurio ou1am  mfcs sfsDtaxmpot4tpeo fctyd a2uanms u)teermo3iytom  lnvil(0texm(o3ou1ol  mneta()sDtrum ;u0tpeoiiciyt a2elnmpnt)tltrmo oa1fm rln s;( t2urxm3iudop  mnvi t  2rr(rpot1tpxoif3iyd s2rl(mont0 lxoxr3oo1lmDr ies;s teurim3nudape lfvsa(faDumum ;t0tex mociat mDulumo;t4aetnxoctytlpteai s t t2tmir io4lm elicta(f 2rrx p;t0aeeo i3iyd a2ea( s (4teerxoctadlmt an o s)srtmxr nu4llenmnctatfarrrx onu1tltn oeiydlaDrm(mo;(0 etrxociotlatr uvs ( setr(m no4ol  mict (fs2um(r ;u1alxomoeiys s2rm(ms t)trerxr tydfmDraieolt0teuoim iu1am nmfcsa()aDrrx pnu4tlx mietasfmDranvs u)alxnxf ootfptr i o s srto(mpnudlp e fctatfaDtmurp;u0aee ioeiasfs2rlu s;t0teeomf tytfp  lieo s t2xmim nydlp nlfvsa()s2tm(moou1oeto fciad m2eau p u4 etomo ta1oatr n il( seuo(o nodlpe lies t)arum( pno0tet iociys sDeau s t)trenxrcootfatr u ols0t2uoxm3ou4am  mieta(fsrtaxm nu4apeoio3iaslaDumuvo t)tlxnxrctadop r i ols t2uriopiy1op  lfctasfsrtrxmo;o4oleniociydlmDelu s;u4tlenio3todopt luesls)t2tmim3no1ol nmnvsl( s2ua(mpnt4oetnmf3tydls2rmnmon(0texrxr iydfpt lueslt)srxoirpiodaleelivi s  2umxmont1teto ieild sDumuvp (0tlenmrcoadfpt  nei;()trurirpoy4am  lfvilt  rtmuront4oexnmi3ildlsDrmumont4aetnxr3tadfp rliei s0srtoxm oo1ol elnvsls  Dra(r oo0ale mictysfs emnms;t) rtomo tydfmtrauvi;(0teur(rpio1apt mnet (faDumxm ot4altoioctadlmDemu ont4alenmo3iadfatr uvslt)trumir oodlm  mfct tfa2ta(rpno4oetnmociat s2ean pnu0aeeoio3tadomtrlueo ( s2xrxmpoo4aleemict (f Drr(roou4alxomoctldlmDrlnms;u)teerxocia1la rai ol() rtrxmpoodol nliciatfarta(mo;t0tlxn octys sDea( pnu4tlxrio3tatlm eliei t0trur(opiu1optnmnci ( arrax p;t1aptoioetasfsDelumsnt0teeoxo todlp eln ols s2xoxmpnudamtn nciat) rrm( poo4teeo iciatfaDea(ms u) reoir3to1fa rli olt0trtriopoudomte ivt (faDrm(rpot4oleoiictyt a2rauvp;u4trxrif iodfp  anvi;(0srumimpny1lme lies sfsDumur ;o1optn ocilsfm ua(vs (4 rermfcoa1om eau ilt) rurim nu1amt mneta() 2tr(moot4ape ioetldla2rlnvp;()aexomf ootlaD  ieo t0 eur(m ny1amtnlnesls  2umx p;u4aptoioetasfs2ul( s;(4treomr iy1lp rln i;()seumirpnu1oltn fcta(faruaxm nu4tpt  ictys mDumumpnt4texrmrcoydop rln o;(0trumxm3oy1ap elfvsl(f rurxrono1tpt mf3ils m elu pnt)arxrxr oydopDraieo;( sexo(o3oo4lmen ietat  Drm(mp;t0oeeomi3ilsfs2eanms u) lxomfctydoptrli i ()t2xmim io4omtnmfvtlsf Dta(  ou4oltnifeiadla emn on(0aeeoxr iy1lmDr neils0 rurio3nudllt miet s s2umuro;o0aptnifcildlmDrl(ms (0 exoxociytfa eai slt  exm(opoo4amtn nvtltfs2rrxmont4tlx mfetyt m raumo ()tlxrxrctatfate n ilt setoimpno4aleemnvtasfsDtau pno4alx mictysfmDrl( s;(4artrio3tytlm eau o t)srxoxopou1lme  nvt t)sDrmxr ;o4oetomietasfm ul(vo;u0areoio3oatfmt  nei (0t2umxr3iodole mfctat)aDtr(mont1oex mo3iydfm emnvs;t) eerxrcty1lateanvi s0s2um(m iodol elneta(  rururoou0altnmo3ildls2ul(vp (4 lermo iotlp eliesls)trumxo3ou1lm nlnvilt)aruaxroou4tlxniicild s umu s u4 lxoxocoatoptrau s () rurxmpoy1lpeelfcta() rtm(rpou0tptomi3ils mDea(vs;t) rxrxrcoytlpDran s;(0t2toxr oo4am nlncsl(  Duaum ;o1olt mo3ilsfs2el(vo u4arermo oatfm elues t)texoio no1lm e ivslt aDrrx  nu1tpxn o3iatla2rl(mo ()tlerio to1oaD ai ols trxo(o iudol nlnei t  Dua(rp;o4aet  f3iatlaDuaumonu0aleomo3iadlaDe ueilt sruoxmpou1op  lfet t) Dtaum nt0aeenmfctasla2emn s (0arenmociydlaDeai i s)t2xoxmpoo1apenlnvtl()a2urump;t0oee  i3tysfa2ranvp;(0 leomocoatlp eli s;t0srtoxrpno1lle  ncsa(farurx  ;t1aetn fciat aDemnvpnu4 reomr3oadop  anei;(0trtrxr3nu4ame mivtlsfaDrax  nt1aeeomfcias m ua(msnt0aetoxo oa1lmtelivs;() 2umxopnudllt  iet tfs2tmumpoo1tpxoiieiys sDul( on(0 rxrxr oadfmD  nvo t)t2ur(r iydaptnmnctat) Dtax  no4opeomictltlm2rau onu0trenxr3oodfptr ueo;t  ruoxm iudlptnmnei sf Durxro;o1opxo f3tlsfa2ul(ms u)aexnif3oo1op rlneo t s2trxmpou1lm  mnet t) rum( p;t1oex  f3tydfm ul( p;t4texomociydfmD  u ol() exmxmpiy1ol   ics s) rraxrp;u0oet mi3iatfa rl(vs;(4arenircoytlpDrlnvols)srxoir3ou4om  lfesls)aDra(mp;o1tlxoifeiatfm2emn p;t4tetrio3tydfm  auvi;( teuoir nudlpen iei t)sDraxr nt0aeeniictld a2rmnmo;u0 lxnxo tatla rlivs;(0t2umxm iudlm e fet sfarum(mo;o1oeenmfciadls rl(vs;t4trtoif3tadopte n o (  rxm(o oydlltn fvtat)aDra( o;t0tetoif3iasfm2ranmsnt0texnxr tydla r nvo;()t2toio3oy1amtnmfetatfaDraur nt1apen ieilslsDrln p;(4texoir oydfa   ueo;s seurxm oydlm e net t sDtaurpoo1alxomfeiatfmDuau snt4tetnircootop rli slt setmxopoo1alen neilsfartm(m ;o0aeeo fctyt s elumon(4alermf3ia1lm ean ols)s2tm(r3iydopte ivtat aDururp;t1tlx if3tas m elnvo;t4aeeomo3ty1fatrln o s0texrio oodame mfvsas artmurpou0alx  o3iytfm ra(mo;u)tltnmoctodomt  i i t) euo(r ou1lm n fvt (  2rr(m no0tpenmo3tasla2rluvs t0teenmf3tytfat aueils t2umxr oodomtnlivslt  ruaurp;t0oex ifetyt m eau p;(4tlxoirctotlaDeaivo t0trumio iu4ape lnetat)sruaxrpnt0tltnmfetld a el(mpn() ltoxr ootop elues;t t2uoir3oodomtelnvi sfarta(mpou0tetoiieiyt s eanvo (0aexnxo3oo1fa   u il() exoirpiydlm   ncsatfsruaur no4optn f3iysfs2um(ms;(0altnxo tatfmD aieo;()s2urir3iy1lmtnmiei t)a2raump;u0tltomi3ilsfsDum( s u) exriociadlmteaiei;t)setrxm ny4ol  mnet t) Draum ot0apt ifctydlmDeaump u) etnmociy1op  aivi;(0srto(m iy1apen ncsls srrmu o;o1oex  feiatfm2ranvs;u4artnxfctatop eaivo s)srxr(r ou1ap e fet s sDtmu pno0apt ifeils sDra( s u)artomocoadla elies t texm(opoo1olt  ivi tfaDtrumpoo0altnmo3iadfsDum(mo;(0 etoir iatlaD livi s  2xrxr iy4opt mfvsasfa2uru  ;o0olx  ictld a2emnmsnt)aleoif oo1fptrln ol(0truoxopiydlptnmicils  Dtm(r ;o1opx micils aDua( p u)trxoif tadopDr ueols texm(r3iudol elfetat aDtr(rp;o0tlx mo3iadfmDemn o (4aeenir3iotlp rau sl( srxoxr3iodopt mieiat)aDrrxmpou0oltomictys m elums;(4tltniocta1faDr nes;s) rur(m nodal e ncsatfarraurpnt0ale  oetysfs ran ont)altnxo3tydlmDelieils)s2xriopoo1altemnctl(fsDtr(r ;u4opxo oetyd m2emnms;t0tlxoif iydopteaivi;t0srxoiopoo1openliciat) rrax  no0aptnifeiatlaDrln p;t) renircoodfmD aueslt)sruoxm ou1omtemnvsa()sDur( pnt1altnioctydls2eaumo u4 exrmo3oadlmD lies t)s2tmimpiy1lle mnci t)s2raxr oo4aetniictyd m2uaumo t)tltrmr3tydoate ueils)trumxo3oodlle lfetat s2rrurp;o4tpenmictld m2emnmpnu0trtrxo iy1oa r u o t)s2ur(opoy1lp  liviltfaDur(mo;o1oetnii3ilsla2rlnmpnt4 etnxf oatopD  nes;t)t2um(opny4ol nlfvia( s2raxmp;o0tet iieias a rmump;()texnmrcoadfatrau o t s2um(opnu1opeelfvi () 2rrx o;o4olx ifciys a2ua(vo;(4aeenmrcootoptelieils)texr(o ny4lptelncil() 2tm( ont1texo f3iys m2ea( o (4tlenir3oadla e n olt) eurxm nu4lmt livta() 2taur ot1texn i3ils aDeauvo u4arxoxo iatoateauvil( trtoxr oodome  nvils)arraumont4olt moeiytlm rm( onu4aetnmfciy1fpt ln i;( srxmxmpou1apt lfesl(fa2uaxr ;o0apx mo3iysfa2emuvpnu4tlxrmf oatoaD  uvol(0 exm(m3nu1ap nlivt ()a2tm(r ;u1oee  i3iyt a ul(mp;u)tleoxo oa1lmD au i;(0truoim3ny1al nlfcsltfs2taxmpoo1teeoiiciltfm2uan s;(0 exomf3to1lp eaues;t)texrim3iy4op emnes (  2rmxrooo1tpen oetysls emnvp;t4trxomf3oo1oa rauvs;s0t2xrxr3no4omtnlies t)aDrau pnt0tpxnii3tysfmDemnms;(0tlxnmr3ia1fate ivi ( setoirpio1lpe  fvt s)arrm( ono4openiieildfm2ranmo (4tltrmo oydfp e uvi t  rtmxopoy1lp nlici ( sDrr(roou0openii3iysfmDrlnmp u)trenxociodfp eauvo;()sexmirpiodam n nci t)srrm(m oo4tlx mf3tat s emn snt4treomocoodfpDe nvs;t)teurxm ou1lltnlivil()srum( poo4alenio3ildlmDeaums;u)aetomocoatop  aneslt)s2uoxmpiydameemicsltfs2umumo;u1opt iietat s2rauvs;u)tetoxf3ootlpDeli i (  2ur(m iu1lle lnct s)aDra(r nu4tltnii3tlsfmDumnvs;t)arenxocia1faD  u o t  etm(m3oo1ol   fct t sDrm( pnu0oeen icild aDrmnvon(0trxrir3oydlpDr uesl()trur(r3iu1am   fvilsfaDtrxroou4teen oeiyt a2ranmpnu)texoxrcoatlat livo s  euoir3io4op emnesas) Drmu ono0aexnioeils m ra( o ()aexomr3io1lpt  n i;s0t2umxrpno4lltnlict sfaDtrx  no4tpto iciytlmDua(vont)alxoiocio1fm e ueils) rxrxrpiydlm  mneil( srumur ;u0tpe iieildls ua(mon(0alenmr iy1faDr ivs s0s2xmxm3oodll nmnvt (  Dua(rpnt1apxoifeildfmDeauvs;u4 eeoxr3iotlmteai o;t0trtr(r iy1omenlncsatfs2rr( oou0opeomf3iltla ea(msnt0arxnxo3oatomt anvslt setoiopoydlm nlnvsa()sDua( ono1apxnmf3ildlsDrmnms;t0tltnxr ootfate n o;s  2trxm3oodal nmivt tf Dtmxrp;o1aetnif3iasfs uanvpn(4 exnio oy1omDranvi;s t2xmirpiy1lp n fcilt srua(ro;u4aeenmf3iltlsDumu sn(4 lxrmrciytopD auei;t0 2um(r oodame lncta(  2trurpnu0oee iietatfaDumuvp;t0 ltrxocty1omte ieo;( s2trxrpnydamtemiesl(f rraur ;u1aexn oeiydls2rmuvp;t0 eeomfcoodfm r ieol(  euoir3ou1ll emnvsltfsrua(mp;o4oexnmociatlaDulu s;t)tlxomr3iytfa eanvo s srumxo3oo1lpee ies t)arta(  no4opt ii3tytlaDem( p;(4 renxf3oydomt an ols) exoxo ou4oltemicsas)srrm( ooo4aex  feiaslm ua(vp (0aexrmfcoadlmDe i il()t2uoxmpio4amtnlnciasf Dumumpnu1olx  ociatfs rm(vo;u) rxrxr3tadla  auvi;s)trtrir nudaltemicslt) Dtrumpou0apto f3ild mDrlnvpnt4altrxr iatlpt aivolt  etrxrpnydoptnmnvs s)arumx ono0open i3iad m emumsnt) eenir iy1op e ivs;s0s2trxr iy1lp  mietltfs2rmum oo0oee  o3tld a um(vs;u4areoiocoodlmDe n i;( seumio nudlp e ici t) 2ta( o;o1optoiieiltla ea( s;()aexomocoadla r u s;(0 2umimpnu4alenmncsl(  rtmump;u0texo i3tytfm ra( s;u4artnmfctydomte u o;s0sexmxo no4lp elfctatfarum(mo;t1tpxo f3iasfm elnmp;t4 eenmoctatfa r n ols)srto(rpnu1lmeemnvslt)a2rr(rpno1oltomfcilt sDel(ms u0arenif3iatoateaueo;t  euoim3iy1lpeelivtl( a2rau pou4apeomf3iydfm ra( o;t) exrxf3tatla e n s;s0sruoim ny4ol   ictl(fsrraxm ;t4tpe miciydfs2umu s u0tlenmfcto1fmD  ies ( trtr(rpno4apenlfvi ( sDrm( ooo4alenmoetys mDeau s t4altoxr tytfaD lueo () exrim3ny1alt mnvs ()srtmx oou0ale mf3iyslmDel(vp;t4texrxocia1la  lu olt0teum(opnodal  mivs s)a2umx poo0oltn fcias m eauvs u0 lerif3to1fat  n sls tetoxr io1lpte ietat) 2trx  ;o0aptomoeilsfm raumont0 lenmo3ty1lpDelnvol(0 eurir3nodoltelicsatfaDua(ro;t4aetomieias m2uan snu4tlxnmf3tydoaDrluesls)s2xmxr3nu4lltn nctat  Dtmurono1olxn fciltfs2umumpn(0 eenif oytomDr i ils  exr(o iy4alt lfeia(fa2ur(mpnt4altomfciadls umumpnt4 rermf ty1oa e nvilt)t2toirpoudllt  ncsl() Drrx pou0tex mfctld a2rmn s (0altrir3ia1fptrln o s0 etoio3oy4opt  nvs tfarrmurpnu0tlxn i3iat m rl(vpnu0 rtrxr3oadom   n o;(0s2toxm3nu4optelivsat s2rau  ;o4oltn oeilslaDul( s;t0aexnmo3ia1oateau o t s2tm(r iudomtn fcil()srra( ono0optoii3tltfm uauvo u4trerxf3ootfm eauvi (0sexrxm io4open fcias)aDtaur ou4tlenii3iydlm rl( p;u0areoifcia1lpt auvs;t)seurxm3nydlpt  ivtlsfsruaur ou1tlxo ieiys aDuln o;u4 lxoio iodop  ai i t0 eurxrpiodam nmfet ()artmu ono1aexnmf3iyt sDrmnmsn() rtnxo3iy1fpDeaivslt)teum(opiy1altelnviasfarurumont0teenmoctadlm ua( sn(4 ltnmo oytla e i sl( srumxmpoydllt lncsa(f 2umum nt4tpx iiciltlm2elnvont)tltoxf3oodoatr u o;s trurio3no4am   ietasf rum(mpoo4texn fctasfsDel(vo u0teenxrctotfmteluei t) eum(o3ny1om e ivs t sDtm(rpot1optomf3ild sDulums;u0trxnmrcoodlpD auvo;t tetr(o3ny4omtn ict s a2tr(m nu4olxoifeiatla ran snt0 renir oatomDe i s ( teur(o io4am  lnei tf rrmumonu1tetoifetadfm2rlnmp () lxrxf3oo1om eli s s teuo(o3oy1ol nlfvs (fa2tmum ;o1olenmf3tad aDuauvp u0alxnmfciytfpD  n o (  etoir nu4alt lfeils)a2urumpno4ole ii3tlsfa eaumsnu0 lxrmf oatoa e ivo;(0t2umimpnudopte nvtlt aDrrx  ;o4aeto octatfa uan p t0treomf todfa  luvolt0 eurir3iodapt  ici t) 2tmxm nu4ape  f3iltfm elnmo u0 rtrxo3oy1opt  n ils0sexrxr3ou4lpte iciatfs2rrxmoou0altnifeiltla rmnms (4tleoxr ootom  aueslt srxr(o3oydomeeliviat) ruaxmp;u0tpx mietasfmDranmp () rermf3iydfptr uvs;t truo(rpnudlm  lnesat aDtrxro;o1ole mieiys s2em( p ()aetrif3ootlatelnvo;( teum(rpou4lpte netas  2ur( ono4olenii3tasls2ranvpnu4 lxnxr tadlmDeli olt  2um(r ny1apeelnci t artr(mo;o0tpxnii3tydlmDeaums (4 lenxrctadlpDeaueo;t0 eto(m3iydlle  iei sf Dtaxro;t4apxn oeiatfa2uanvpnt4aeerio3ty1fmDe nvs;t t2xrxrpnu1lpe  ietas sDuru  ot1aptniieiydfs ulumo t0 etrmo3ty1oaD  i s;t)setmirpou1ol nlfeta()srrmxront0oeeniietldls2rm( o u4texrxf iytop eaivs;s0s2toiopio4amenmnesa( sDrmx ont4opx iictldla umn o (0 rtoxf tatlmDrlnvo s)trurim3nudalt mnct ()artau  ;o4tptn f3tldla rl( s;(0 lxnmf3oytfm  auvi ()s2ur(mpoydale lies (f rraxrpnt1olxomictlsfsDulump t4aleoir oadoa r nes;() rxmirpoo1olt  fcs ( aDurxmpou0teeoio3tyt sDea(mp () etnmrcoy1laD luvo;s  2tmxm oy4lp  lfvsltf Dra( o;o1tptniociytlm2um(msnt)teerir3oatlptrau o;s)setrio iu4op   ictasfs2uaxr ot0tpenioeils m rln o u0 eeoif3oodlmDrauvs s) rtmxmpiydameemivtat) 2ua(rpno0tpxnif3tasfa ul( snu)altoxf oy1lpte ieo;()srxoir nu4altnmiesls  rurxr ;t1oeeoifctlt s2rmu p;u0alxrir3iotoa eln o t truoirpnu1am e fesas)a2uaurono1aee mietytfs2eln pnt4 lerxfciatoateai s s)t2xoir3no1aptnmfcia( arrr(m nt1alt ifciytls2ul(vp ()tlerxfciy1lmD livi s0texrir iodll n nctl(  Duru pnt0oetoiiciyslm2rlnvs;u4trerxrciodlpDe n o;t0teuoxo no1omeelfvt s) Drmu pou0oltomoctltfsDrluvo (4tltrmr3iodlpDraueolt  2xoxrpio1op nmfvi sfaDtmuro;u1tlx  oeiadla eauvpn(0trtnmr iydomD ln o t) 2to(rpoy1lm  lnet ( arra(ront0tlxomf3iyt mDeluvp;u) rermr ta1omte nvi (0tetr(r3no1olenlfesasfaDumu ooo1apx  ictat s2ulumpnu0aeermfciatfaDeauvols) rxmiopno1aleelnvias arumu  nu4aptomfciatfm2eauvp;t) lxnir3oo1la   ieo;() 2xrir iudlptelietat) 2um(m ;o4ole mi3iysfmDem(vo;t0artnmfciy1lp rau i s)sruo(r3nu1ol e nes t)sDur(  ;u1tet  i3ilsfs2rlnms;t)teenxf3tydop raivi;s s2tm(r oodom e ivtlt)aruaum oo0tet  iciat m2rmumsnt)tetnirctadlp ranvi () euriopnydlp   fcilt artr(  nt0ole if3iatls2uluvs () ltnxo oytlmt luesls) eto(r3nudamenlics ( s2tmuro;u4aexnmfeiadfa2umn pnt4 ltnxo3oatom  aneo;s0 rtriopoy1lmtn ncia(  Dta( pnu1oeenio3tadfs2rlu pnt)altrir oa1fptranvo;s) rtrxo3iydlme  ivtas  rrrxmpnu1opeo oeiyslaDrln p;t4 lxnmo3iy1om   n il( srxo(m nudaleeliet ()arum(  ot4oeeomoeilsfmDrm(ms;u4tltrxfctodlp rlnei;s0 rtrim ny4oleemncs t)aDua(rp;u1oexoifcilt sDumnmp u)trtomr oa1fm raues s) eurim io4alt  ncia(f rtmu  ot1ape  icilslmDrmu s;u4 eeriocta1opte nes (0 etoxr3nudlm  lneil(f 2ua(  ;t0texomo3ilslm el( s;t4tleomf oa1lmtr ueslt0t2urio oy4om nlnvtl(f Drmxr oo0tle ifeias a2ua(mo;u4tetrmr3iodom   ivsl( trur(r3iu1am elies sfsrumu ont4tpto ocilsls rmums u4 etnmf3iotfpDrlnvolt)srto(m3oy4ol   icsls arumur ;o4oetoifeiatfsDelumo ()arxomo io1lpt aies;t0 rxm(opou4lp e iet t  rtaxmonu4tpe mieiatla2ran sn()tlxnir3iy1lat  ivils t2xmxo nodalenlfeias arua(r ;t0aexnmo3tldls2ea(vs u0tltrxf ta1op r i o t  eum(m3oudolt mieiat  rumxrooo1opx  o3iys s rln s u) ltrmf ty1om rau slt0t2toio3oy4ameelieiat  2rmxm ot1aetniictadfsDul( p u)teeoxr iatopt  ies ( t2xmxr iydlme mfctl() rrax onu4ale iietas s2ra(vo t0aleoio ta1oa raieo ( seurxr3oy1om e fct (f Dtmum oo1aleomociltfsDran p;t)arenio totfpD anvol()seto(m3oo4op e ivtls) rurxrpou0olx  octysfaDraums;(4 rermf3oatlpteluei;() euo(m3iu1al  mnvils  2rm(r ;u1tpe mieiytfs2eanmp t0 ltoxf oo1omtelnvs;t)srum(m oo4omenlfetas) 2rmx pou1opxnmoeiys aDrln sn(4 lenxoctytfate uei;s) etoxo3ou1aleelieiat sDtax p;t4ole  fciydfs2ulu o;(4 lxnio3oo1oat ln s;s) 2umir oudal nlnvt sf rrrur ;t1apen ictad aDean p;t4treoxocoa1fa eau o;s)t2xrio3oy1ol nlfeia( sDtm(  oo1tpe mfctysfm2emnvp;t4 rtoio3oydlpD ln i;s0 2tmxrpiu4ap  lncs tfsrtm(r ;t0alt mi3tlt m2raumo t)aexrifctodoa  lneo;t  2xoxmpoodopt mnctat) rta(r nu0teen fctad a ran o t)teermfcoodfpt  ieo s trtm(m3iydopenmneta(fsrta(ronu0tptniociltls2emumo;(0 rtrmocoa1lm rln i;(0 2tr(r3oo4lpeemfvil()aDururpot1tle  ieiltfmDua( pnt0alxoxfcoa1lp e ivilt)t2toio ny1ap  mfvia()srrr(ro;o0oetn iciyslaDean pn(4tleoxr iytopDeln s s0srtr(mpiudop nmnet (  2rr(rpoo1tlenmieiasfs2ea( o u) rxoifctadomtr uvo s)trxriopnodamenlivsas) 2trurpnu0ale ii3iytfaDemnvp;t4alxnxr iy1fmtr u o;( teto(m3nydap e fetlsf Drrurpno1apx mf3tydlmDuau p t0trxrxr3oodfpDranvols0 2tmim no4amte fvsat arua(moou4tlt ifciyslmDeaumo;t)teeoio tadlatrau i;(0 rurxopnudlp   ivtlt  ruau o;t1oetnmf3iys a rmnvp u0aleoif oatlpD  uvs;( sexm(m no4amenlfvi s) rrau oou4oexnifeiadla uluvon(4trtoio oytlp   i o;t) 2to(r3io1olen nvsat)artrxmp;t0apxnmoeildfm2emnmp;u)areniocoy1lp  auvols0tetoxo iydapeemfci ( s2umuro;o1oltomfeiad m2eluvo;t0tlerxfctydlmt  u s t0s2xr(m oudlptelfvias  Duaxroot0olto feiadfm2um( p t4 exrif3ia1opt  u s;() rxrxr3nydlpte fct t sDtr(ro;t4aeenmo3tasla emu s u0aetnir3iodlptrlu i;t trtoim iu4om emnvsl()aDua(m ;t4tee mfciytla2ea(vs (0altnxociatfp rlueo t) rtmxr3nodal e ivslt a2rrumo;u1oeeomiciysfs em( o (0trerif todlp ean s (  exmirpio1opee fet (  Draurpno1aexo fciysfmDem(vp t0trenmf iodop r nvo;s0s2toimpno1llenlfesltf 2umumpoo4tle  ocilsfmDuaump;()altnifciodlatr iei;(0 ruo(r iydaptemfctas srrrurpot0oexnmiciys s el( s;t) rxnxr oa1latelnvo;(0 eumxr iu1optn iei (f 2taurp;o0alxnmf3iys a elnmpnu)alenirctatop rauesl() 2xoxmpiy4amtnmnvtlsfsrtm( ooo4texn ieiadfm2ea(vsn()arermrcoytfp rauvi;t) exr(rpiodaleemies sfaDurxr ou4oet io3tytfsDua(msnu4 exrmocta1fmtrai olt0srum(m3nu1amt lfcta(fsrrmxm no4olxnii3tadfs2em( s (0trermo3iydlmt ai il( trtoim oodapt micsls)arumu onu4apto o3tldfa2um(ms u4 rtrmf tatlp r iei;t0 2umim nydap nmfcsatf Drm(mo;t1tptniietldfm2emumsn(0tlxnif oydoatrlivsls0 etrxo oo4am elfeslsf rumu  ;o1apxoii3tysfa emu pn()aetnmociy1late i sl()teurirpou4al  lictat artmxmpot1texo fciysla2rlumon()treoir3tytfm rau i t  2trxr3oudlpeelfvil(  2ua(r ;o1tpx  feiltlm rmuvo;(4texrif3oytopt  iesls) eto(r3oo1am nmncsatf rrmx  ou1apenmfctadls2ul( o u)arxrmrcoy1fmtrlneils0texrxrpiu4ll  lnctl(  2raurpno1aeto icilsfsDeluvon(4trtoircty1oaDr ues t setmim iu1om n nctl(f rrau p;t0opeo f3tlsls ua(vonu0treoif3oodoptrlneilt tetr(r iu1ap e ivtl(fartmx ooo4olx  oeils s2eanmpn(0 rxrmoctydfptelnei;() eumir3oo1om n iei s s2uau pou1alxo fcildfsDea(vo (4 exoxf totfpDrln o (0sruoir3nu4ap nmiei t a2ra(ront0aetomo3iysfaDea( p;u0trxrio oy1laDrlnvslt trxrxo ou1aptn nvs s aDra(rono0alto oeiytfaDul(vo;u0artnxf iydomD aiesl(0 rtrimpiu1opt licsasfa2tmxmooo1aet  o3iysfs elu o t4tetnmf3tadom   nei s0 eumir nu4lleelnetatfaDumur ;t4openio3iytfa2el( o u)trxnxr oytlaD  ieo (0s2trim3nudale mnesl() Dta( p;t0oex ifetldfs emn s;t4 exrmfciatlmte ivo ()setmim3nodopee nctas)aDrau pno0oet  o3tytlaDemn pnt)alenxr3iatlp r ies;s  2um(rpny1op n nei (f Drmumo;u4aeeo o3tldfaDemn p;u)tlenxr3iatop e uvo;t)trxoir nydlm nmfviat  Dtrurpnt0olxo fetysfs2emn s;(4 ltnirciadfp rai s (  2xo(rpoy4lmt liet t  rum( o;t1ale ii3ias s2rl(vp t0 etrmo io1lm   ivs ()t2uoio nu1aptnliesl(faDtr(r ;u4opx miciysfsDulu onu)teerxo3tytlatr n ilt) rxrim3ny4llenmnvi t) rurx onu1tptomiciltlm2ulu sn(0texnxoctotfp raivo;t  etmxopiydlm   iet s a2rrumpno0apxoii3iysfsDea(ms u4alxoxrctotfa   uvols srxr(m3no4lmeeliei s)aruau pno1oleoifciltfsDrmums t) eerxo3oydfp eluei s) 2tm(o3oo1apenlfcia(f 2um( onu4opt  f3iadla2ul( o (4treoifcta1lp  anvs ( sruoimpnu1am  mieslsf Dtaxmo;o4aet mi3ild a elnmp u) rtrmrcoodfa eli o;( s2umir ny4lmt  neta(  Drrurpot1tle iicild a emu s t0tlxomfciytomte u s ( s2tm(m ou4opt mnesas a2taxmp;u4aet ii3ilt s2umuvon(0artnif3tatfmteau o;(0 2trio3oodole  fci tfs2tm(mo;t0tpxnmietyt s umn o;t4altoxo3oydfpt  ivi;s0s2urxo iodolen net ()aDrax  nu0opeo ociat a ranms;(0 etnxocoo1oa rlneo;s  eumxo ou4al emfes t)arrm(mpnu0tlt  oeiydfaDulnmpn()alxoio3iatoaD lu ils0trxr(o oy4ameemietl(fartruronu1apxo ietatla ea(vpn(4teenif totfptelieo () 2tmim oodale  net sfs2ur(mp;t4oetn fciatfm2emnmsnt0alxnmr3ootlm  livo s0srumir3nu4lmtelneslt) 2rr(mpot1oee if3iyt aDeauvpn(4arxomo3oatlptelueslt0 rxoio3no1op nliei t) 2taxmonu1olt ioctys a2ulump;t0tltnif3io1lptr u s t0 2um(o nu4lp n ivia()aDrrur oo0apt mo3tadla2ranvsnt0texnmo iatom ran ols0t2xr(rpiy4ale licia()aDtaxmo;u4optoiieiltfs2rmu snu) lxomf3oydfaD  nvs;t sexrxm ou4olt lfeiat sDuau ont1apxn f3ildls rlump;u0tltnio3ty1lptr ivi s)srtrir3ou1lmtn iviatf rur(  ;t4oexomfctadfmDrmn o;(4tetomr3tadlpt aneo;t tetrxmpny1optemicil() 2tm(r ou1optn o3iad a ua( p;u)altomo oytfpt aueilt s2tm(r iydoptnlict sfaDrmurpnu4apenmieildlm2ean p;u4trxriocoydlaDeau o t0truoxrpiu1lmt  ivslsfsrrm(mono4tle  ieiyslaDelnvs u4arenmf totoaDe n o;s0 ruo(m iy4lltelfcslt) Dtm(r ot1tleo ietadfm2eaump;t0 exoirctytlmtraies;( teuoxo3iu4amt  ieils)sDuaumooo1tpxoiieiyt m2rl(msnu4 rxoir3tydom eli s t setoxr iodapenlnesl(f rta( ono0opt  fciat m eau p;t0tlxrif iadlpDr uvil(0 2xmxm no1llt  ics ()sDrru o;t0tptoio3iydls umuvs;u0alxrxocoatlpDeli slt tetr(m3ou1ap nlnvi t aDumum nt4oexnmi3iad s2uaumo;()tlxoif oo1lmDrlueilt) exr(rpnu4amt mfet t aDtrxmo;u1tet  fciatlm umums u0altnxf oa1optrauvsl( t2urxmpiy1ol nlici sfsDraump;u4tleo oeiad sDem(vont4aleomr3tadoaDeaieols)t2umimpiy4aptelivias)arrr( oou4oleo ietasfa rau s u0altrmo iadfatran sls0t2xmiopnodol nmfvtlsf Dtmxmpnt4aeeomiciat m2ua(vs;t0 lxrir iatom e nvslt0s2tmio nydlpt  nei tfa2tmxro;u0tltn ocildfs el(mon(4 rtrmrcoy1fmD  neilt) rxrio3nu1omen nvilt)aDuax ono0apt ifciys s uln snt) lenirctodlmteli slt  euoxm3iodom n ivta(  Dtaxrp;u0aeto iciytlm2rlnmsnu0trxomo oadomDelneo;(0s2xrio3iy1al nmies tfaDrax pou1opt io3tat a2ulnmo;(0aleomf3iodfa  lu slt)trurimpnodoltnlnvi s)srrm(r oo1alxniiciydla2rlnvo u)trxoxociytoate ivs;t trxmiopiydlp n fvs ()a2rm(  ;t4apeomiciys m ua(mo u4texrxrctatfa e ivol(  rxoxo iu1omen fvsltfaDrr(mo;o0altnioeiltlsDrl(mp u0tlenxo tatlmte ivo;()s2toir io1lpt  netat  Dumur ;u0oet mi3ias m2umnmo;u0tetoifcty1fp e nes;t sruoxm iy4ll   fvsl( artrump;u4texomo3iadlm ul( o t)aeenircty1fpt aues;s)srxo(o3oy4am n iet ()srtmuro;u0alxoiieiat a2uau pn(4artrif3iotlmt anesls) 2xrio3nu4ame lics t srtaur ;o4aeto octytlm em( s;u0tlenmf3oy1lm rluvo;s  euoim oudolteliesls  rrrxm ot1alxoii3iydfa raums;u0 lxoxrcta1op r ueolt) rum(opoy1oltnmivil()sDur(  ot1aetnifciatfsDel(vs t0texoif oytfm r n s;(0s2tm(m iy1op elfetl(  rtm(mont0tltomiciad a rm( o;(4 etrmf3iotlp   nvs;s0sexo(mpio1om n iei tf rur(m ot4ole mi3iyt s um(mp;u4alxoxo3totom  lnvil()srumxrpno1lp nliviat)artaxm ot4apto iciaslm2emu o ()alerxr3oy1oa e nesls)t2xrirpoy1ome mivtas) 2truront0apxoiieiytls2rmnvsnt) renxr3iytlpt auvo;( s2toxo iodap e iei tfa2tr( pnu1tet moeiaslm2eaumo;(0areomr3tydomtelu o ()tetoiopou4lmtelfesa( aDuau onu1oltnioctytfm ua(vo;u4 lenif oa1lmtrliei;(0 rurxopoodaptnlivtasf rurur ou4oet mo3iyd s ea( o (4trxnmr3iy1fat  nvs;t  rurir3ny1ll  mneiltfsrraxm oo1opx  ietldfs ul(mo u4tlxoxrciodomDeai o t0srum(o nudoleelicsat  Drm(r ;u4oetn ieiadfa2eln snt)altrmocta1fatran i s0srtm(mpny1lltemiet t) 2umumono1teen oetld m rmnvo;u0aetnmf3todlmtrlnes;s s2tmirpou4ll elietlt)aDrrxroot1optoioeiysfa umnmp;t0 lermrcta1fpD anvil( s2xmimpnudop nmivil(  ruru pou4tee io3tad s2raump u0 rxniocoy1fatrlivo;t0 exm(o3ou1altelncsas)sDrrxmono4ale iieiyt mDeanmsnu)tetrmf3ty1la r ieol()tetmxr3oydam n ncta(fs2raxm oo1olen ociys s2emn ont4tltoxo oa1lpD  ivol(  exm(o nydal e fctl( srur(m ou0apx mietydla2ra( s t4texnxrctytoat auvi;s sruo(m iodap elnvil(fa2rru o;o1oexo ieias s2raums;(0teeoifciotfmtelueo;t0 2xrxo iy1ap  lncilsf Dururpot1apxnmoeiysfs2ulu o t4 reomo oadlmte nvolt0texmiopny1lp elnci (  Drmurp;o4ale  ieiydls em(vs u) ltnxfciydopDeauvs;(0t2to(r3oo4lme  ivta(farua(r nu4tpeo ieiltfa ranvo;u)trtrmf3oydomte uvs;s0setr(mpou4optnlnvta() 2tm(  ;u4alxomieiydfmDemnmp t) rxnif3to1fm  auvils0seur(r3oudapenmiviat)sDur(rpno4olt  fcias sDumn snu0 rermfcoatoa rlieslt)s2trxr no1optelicsa( a2ra(moou4alenmicilt m2uln s t4 exoxf oatfat an o;(0trxr(r3io4ll n feia(fa2tmxmpnt0teen oeild a el( s t)aexoif3oa1fmt  nei;(0texrxopoodole micslt)s2rm(mpnt4tpxn o3tls a2rluvonu0 rxoif3oy1oaDeaneo;(  exmxm oydape lfeslt srua(monu4tptoiiciatfsDel(mont0 exrircoadlp r neolt0 eto(o no4openlicilt srrmum ;u1olto f3ilsfm elu pnu0 exrir ia1opt  i olt  2urxm3iudol  livs t  Dtrxr nu0olxn oeiyt s rluvp;t0 ltnirciatopDeluvolt texoimpno1lptnmneia(farumumpot1ole mfetltfmDrau ont0tetomr iydoateaneilt)trxmxrpoudll  miciatf Dur(moou4alenmiciydfsDra(mp u0aexnioctatfp rlieols0 rtoxrpnydlle  fcs t)artmump;u4olxn feias s eaumsn(0aeenxfcoatomtrlueslt seumxr iu1lm  mfvslt  Dur(rpnu0aeeomi3ild s eanvs u4tltnif iytla rlivs;s0srtm(m nu1lltelicsas)sDtaump;t0tlt ioeilt sDelump;t)alxrio3iatoaD  ues;s)t2toxo3iu1lmen fctlsfa2umum ;t1optoioeiydls2emnmp;t)tltnxo totlpD aiesl() 2tmim3iy1lpe mivtlt) 2rmxmpou1alxomieild m elump;t4tltnxfctytfmDeauvs;t) euoxopny4lp emfctlsfaDtaumo;t1opxo ociys a2ea(mpn(4 etrxr3oydopDe ieo t)srurir oy4ole mivsas) Drrx pou4aeenmo3iat a2rluvs;(4alerxrcty1optranvi s0s2xm(opnodomenlnci s)aDrmxmpot4tltnmfeiydfs em(mpn()aexrxf todopDrauvols  2urxr3ny4lpee fesls aDrmu p;u1optoif3iaslaDuaump;u)tltrmo io1lpDe uvs t)trurir iydlp nmictls a2uaur ;u0texoif3tat s2em( o u4trermo3ia1lmDeauvs t0 rtmxo iudoltnmnciltfartax p;t4aeeomfcilt s2emnms u)altnmf3tatoate uvolt t2tm(o3io1lptn neilt srua(rpnt0opx  i3ildlm2ua(mp u4aleoio ta1omtelnvo;s) etrio oo1al nlnvs s sDraxm ;t0apxnmiciadls2rm(mp u)texrxfciytfmDe ueolt)seur(opnudlm nmivtasfsrrm(rp;u4aetomi3ildlm um(vp (4arxnio3iytlp eauvs;s) eumirpiy4om  mictls aDrrx p;t4apxn octydfa2em( on() ltnio oy1om e ieo;t)t2toim3iu4amenmivia(  2ra( pnt0tpxnio3iyslaDea(vpnu4teenxf3iadoaDr nvils)srum(o3io1amee fctl(  2tmxmo;o1tle mi3tasla ul(mo u0teerxo oatfp rluvo s)setmxmpoodamtemivia()a2rau oot4oltoiictysls2ean p;u4 leomo tadlatraies;t  rxm(mpiu4ol nlivt t) rum( o;u4teto f3tyslsDulumonu0 lxrmocoo1op raiesl(0s2toxr3oo4ome micslsfs2ua(r ;u0tetnio3iadfsDrau s u0 lxnif3oa1omD  uvs t)t2trimpoodll nlfct t a2rrx pnu0optoiiciydfmDuanvp;t) lxnxrctatlaDr uvi;t)sruo(opou1al emivsa( a2urumpoo1opxnmi3iyt m raumo;t)arxniocto1lpteaiesls0 etrio iu4alt mncs t) 2rmuro;u0alxomi3tydlsDuluvsnu4aeerircootfpD luvs;s0trxm(opnudopen fvsl(fs2raxmp;o1optomociytfa rmuvp;u)teenir oadfp   ies t)seuoim3iy1oleelfciasf Dtaur nu0ole  oeiytfsDuan o (0 ltrir3iy1lp rlnvs s)t2ur(r nu4al e nvt t srtmx  oo0tlto o3iytls2uln pnt4texrmrciadopDrlnes s)setoxopoudlltemfvslt  2ra(mpoo1aex io3iadfmDulnmpnu) eenmr iotlp e n i;t)t2umio3oodlp nmnes t) 2rm( pnt0tpxo oetls s2rauvo;t0teeomr tatlpte nvi;t  etmiopiodlmtnmici t s2tr(m ou0aetniieiltfsDua( s;t0 exomf3oo1latr nes t0srxmxo nydop  mnesl( arrm( pno4tpx mo3tytla rmnmonu4 exrifcia1op eaueils setr(opnu1op nmivt ( sDua(r ;u0apxn oeiyd m rlu s ()aeerif tatop   nvo;(  euoxrpoy4lp  mfvi tfa2rrur ;u4tlxomfeiad s emnvs t) exnmr to1fp  ai s;s)s2toxm3oydlltn fetasfa2raxr nt1alxnmi3iyd sDem( p;u0alerir3oytfmD li il(0 2to(r nodolee nciat)sDtm( oot1ale ioetasfmDeaumo t4altnxf oodlat ln s t)trtrio3iydome lfvilsfartr(rp;o1ape mi3iyt m2ulu s;() eenmoctadlpt  n o (0 rtoim3oudll   ici t  Dtax  no4altomfciadla elu pnu4 ltoxociadfmteln slt0 rtrio3no4amtnmieils)srrmxmp;t4oeenioetytfa2elump;(4trxrmociadomDeai o s sexoir oodapenlivi sfa2um(rpnu4apeomfetatls2rm(mp u4trtrxf oy1fatrlnes;t s2to(opoodam   nvs sf Dua(  nt4aetoiieilsla elumo;(4arxoifctadfa e ueol() rxrir3oydlm  mnct t aDua(mpnt1tee ifeiytls umnvs;u4teenmr ootlmtrluvs;(0s2ur(o3nu1am e iei t  rtm(r ou4oltnmfciyt s uln s u4 rxoxr3iotfmtr n i;()sexoxr io1omenlfcsasfsDtru  ;u1olxomfeildfm2eau p u0 ltnmfcoytlpDeln o;s  2xr(mpou1lle  fvta() rraxro;u4aeen fciltla ea(mp;u)alxrxr3to1lpt lnei s0t2tmxo no1lleelieia( a2tau  ;o0aexoio3iyslm2el(mo (4tetnifctodfpDean o (  2xr(o3iu1am  licta(fsDur(r oo1apenmi3iasfs uluvpnt0trenir3oa1omD ln s;s t2tm(m3nudlp nlnetls)aDtau ooo4opxniiciatlsDrlu s () eerirciydfaDraivolt) etoxo ny1ap  micslt) Dtaurpnt4apen o3iyd m2rmu p;u)tetnif totfmt ai s t truoxmpoo4opeemnes (fa2taxmpnt0aptnmoeiys m2uauvs t)teeniocio1optelnvsls)t2toim nu1lltn nvt ()a2tm(mpnu1aptoii3tlt s emuvs t0 lenmoctytfm eai i;(0s2tmio no4op  mnct tf rtrx pnu1apto i3ilslsDuanvp u4 rtoxf3tytlatrln sls tetm(rpno1altelici s)sDua( pou0apeo ociys m ul(mp;()aleoxrciotoatr n i ( sexo(o iy4lp nlnvtlt)s2ra(mo;t0olen fcilsla elnvo u4 rxrmfctytlp rlnvs;s)t2uriopoo4llee ivt sfs2uaurp;t0apt  ociatfaDuanmo (0aeeomfcoytfm rauvo;s tetoiopio1lp nmfvslt)aDtru p;t4alt  oeiatls ea(mont0 eeoiocootlp ran s () ruoxr3iu1amtnmncsltfsrtaumpot0tltoifcils m2uln s;(4tlermf3iotfptraivi ()s2xrir3no4ol   fetl(fsrurx p;t0tpeomieiysfa2ranvo;t4 etrmfcoytlp r u o;s)s2uoiopnu4lpt lnct tfa2tmx o;o4aetomo3ild s2umnmp;u4altniocia1lmD  ueilt0s2uo(mpoudoptn nesltfarrr(mpoo0ale  fcilt s2ul( o;u4 reoxf iadla rlivs;t0s2xmirpiydoltn net ( a2ur( pno4texo feiltls uau pnt) lerxr totlpteanvols0truoim3io4amtnlnvia(  ruru  ;o1apt  fetasfmDrau p u)aexrmr3oatlpteauvi t0s2uo(o3oudlme lnet s) 2umx  ;t1optn fcildfaDelnvpnu) eenircoodomt  nvs ()trtriopou1lptnmieils)srrmuroou1aetoifeilslaDelu sn(0arxnmr3tadlaD li i;s srxr(o3nodlp nlivtl()s2raum ou4olxnmfeilsla2uln pnt0 rxomf3tydfmt  ivils srto(m3nodoptelicsat)srta( pno1oexo icilt aDeau on(0aetrmr3iadlmt luesls) euoxm ny4ame mnctls artaxr ou0tptn ociltla2umnmp;(0aetrmrcoo1lm eanei;s) 2uoim ou1lpeelieiatfaDta(r ou0opxn ociydlaDumnvs t)arxomr totlaDeaieols0t2toxm iu4amtelnci t arum(r ;u1opxoifeiyslsDemn o u) etnifcoa1oa  lues ()srtriopou1apte fvilt sDtrx o;o4tptnmf3tas sDra( p u0 exrifctotoa eai sl( trtm(r3io4amtemfei t) 2tmur no4oleoioeiltfa eanmp (4tlxoxfctydlp r n i;s truoirpoy1apte fesa(  rtr(r nu1openiocilsfs ean on(0teeomociadlpteluvsl( s2tmimpou1ll  lnei s)a2uaur ou1alt micildfs2emuvp t0arxnmrcto1fa e ies ( trxrio3iy1alt  neslt  Drmu  ou0oltoifeiatlsDemnvo (4tetrio3oy1fat  u o;t  2xr(o oo1amtemies tf Draxront0aeenmieiatfm2rln o u4altnif oatfa   nvo;s setoxm3ou1ll n nctat) rrmurpoo1optoifetltfa2emnvsnt)aeeomo oa1fp r ueslt0 rtmxm3ou4ole mict tf 2rmxm oo4tlxn f3tydlm2umu o;(4 ltnmociotlpD li i (  rxoir iy4aptnmnes sf Dra(r no4tlxnifciasfmDem(mpn(0trtrxo oo1opD auvolt  exmir ou1amee fvtasf Dtm(m ;u4tpx mictld sDrm( s;t4artnir3iatfm e n s;s trxm(mpnudapt  fvi s) rurxmpou1olxo iciysfs elu s u4 rxoif totop elnvi;s texoim3iu4lpe mfesat) rtm(rooo1tlxnio3iadls uan pnu0aeermoctytlpteauvs t t2xmxr3nu1omteliciat)sDtmumo;t0tpt  f3tasla2ra(vo u0tleomfcta1la e u ol( t2toxrpiudllte nctls s2rmuront0aptnmf3iyd s2um( o;()tlenxfciodlaDr nes;()texm(mpio1oleemivs ()sDuaxm ;u0alt  icils m2em( s;t)trtnmf oy1lmtr u i s)tetoiopoy4lmtn ics ()aruaxmooo0ape  ieiatlsDuluvpnt) rermfcia1lat aneols) 2toxmpou1lleelfes s)aDtrxrooo4opxnmi3iydfsDelnmp t0 exrxo3todopt  nvols0texmir3no1altn icta()aDra(m ;u0aeto icildls2ranmp u0 rerxo3tadfp rluvils0srurxm3iodomtnmnvs tfaDum( ono1oexoifeiyslm rm( s ()tetoircty1fmDeauvsl()s2umxo ou1am  livtat  2ua(rpnu4tleo f3tydfa um( o (0 ltrmo3tatfm  aneo;(0t2uoio no1ll elicils s2rru ooo4teen o3tytfs2umnms t)tlerio3oo1fa  lieil()t2xo(o3oy4oltnlnvi (f rua(m ;t1oexnmoeiasfm2em( snt0tlermocoatfat  n s s) 2tm(m3oo1lmte fvi t artm(rpnt1oeeo f3tldfm emnmo u0 leomo tytlm e uei;t  ruoxm nudomee ivt ()aDtru  ot1alxnifetytlaDemu onu4altoxo3iy1omDr i s;s seurxo3oydllenmnvia()aDtmxr ou0oeen o3tldfs eln o t0 renif ta1lptrai s;s)trumxo oy4lp n ivtl(fsDumx o;u0opxnmf3iyslm2rluvo u4areomf oatfmDr nei;(0 2toxrpio4apte nvsa(f rtrxr nu4oleomoetlsla2uln p t0arxrirctotlmDe uvi;s setmio oo1oltn net t)s2urxm nt0tpe  oetydfs2ran s;t4tleoxo tadlatr n i t)s2toxo ny4optemicil()s2tmxrp;t4tlto f3iatlm ulnvo;(0tltoxo3ia1oa ranvs;t tetm(opny1ameelici tf ruru pot1olenii3tytfa rm(mp ()teenmfcio1la  aueils s2trxm3io4ll emivtlt)aDrr(mono1tlxoioetldfa eln onu0tlermo3oytopDraueolt sexm(o oy4amee nvsa()a2uau pot4olenifeiyslaDemumo;() eenmf3io1lm ean s;s  etoir iy1al   nvslsf Drau oot0apeoiocilsla2rmn pnt0tltrxf3iatlp elueo;() rtmxopno1lp  lfcs sf Dtaumooo0optoio3tldla uauvs;u) lenxrcia1fa  lneolt  ruoiopno4ope mivtl(faDrm(mpot0texn oeildfa em(mon(4altnxocoadomDr neo s t2um(rpoy4oltn nct tf 2uru pno0tltnmieild aDulnms t4aetrxo3iydfm e uvs;t  rxoxr3ou4ol emfei sfsDum(m ;u1opxnmo3iaslm el(vp;t) rtniociatlat  ieo (  2uoim3ou1apte ici tf rtaxr oo1oltn o3iat mDemn pn(0aetnmociatfp r n s;t0sexmxo3iu1ol  lfvia(farua(mp;u4ope  fciydla ua(vs;(0 lxomr iydoptr neslt0teurxrpny1al nmfci t) ruau ono0opxo i3iytfaDrmumsn(4 lxnir3oatlm r n s;s s2toirpoy1lp emivsls) 2urx poo0apeomi3tyd sDraumpnu0 rtrmo iatfa rlivs s)s2toxrpio4amtemieia()artrx pou4opeomoctatlaDeanvo;(4alenmo io1omDeli s;t) rurio oo4ope mivs t) Drmxmo;o1opt io3tydlsDemnms;u0tetomo oatfp  auvo (0 rtmir io1omenlfvs t)srtm(rp;o1apeomoeiyt aDem(vo u0tltoxrcoodoat  i s;t seuo(r oydopt livilt  rrr(rono4altnmieiad aDrau pn(4texrxo3iatopD  u i t  rxrim iodame  fvt t) 2rau pnt4tlxnmieiyt m ul( s t0aexrxf ta1fp  ln olt)sexr(mpoy4omt  netlt) 2uru onu4olxn ociadfs uaumpnt4tleoxfcia1op rauvo () rtmxm3oo1ome  icias) rum( pno1ope  oeiydls uan p ()artrxo oodop  ln slt tetoxm3oudapt mfci s)arua(mont4tptoiietydfmDranmsn(4tetnxfctodoaDeau olt) 2xr(opiudomtelncsls  2rr(  nt1oltoif3ilt mDrmn on(4 rxnif3iadlpD  n slt0 euriopio4lm nlncs ()aDraxr ;u4opto fcilslmDem( s;() lenmf3tatomD  ues () exo(mpio1lmenlfetl(fsDtauro;t1tptoiietysfsDrm(ms ()altoir ty1omDeli i;s)s2trxmpno4omt mietlt) rtr(ront1tltn fctlt a2um(vp;(0 rxrxf io1fp rlu s;t setrio oy1lmt miet tf rrmxmoot0opeomociadlaDuluvs;u0altnir3iytla   ueo t) rtmxo3nudoptn ncsat arurx oot0olxnmictltfsDrau o;t0 rermo3ta1oaDrlueols0 2xm(m3ny1ll  lneias)s2tau o;t1tleo oeils a ranmp t)trxriocto1opD lu s;s  rum(o3nydal n ivt () 2rrur nu4opxo ociytls2uan sn(0alxoxo3tadopD ln i;t0srxoiopnodalenlfcsasfs2rmxmp;o4tlt ii3ild sDra( o t4 exoxo oy1faDelnes;s  rtmxr3no4al nmnvi (  rrrxmp;t4altoiieiytfaDuau s;()arxomocoa1lm e n s t t2umio io1ale mnvtl()sDtmx  ;o1ale mfeiltla2rm(vo t0alenxf ootoaDrlnvs t) rtoxrpnudolenmnvilt)arurxr ot0aptnii3iad mDuanvo;() rtnmo3tydoatr n o t srtrim3iu1om e nvt ( a2rmur ;t4alx ii3iyd s uln s;t)trxrifciatlmtrau o;t trxmxr ou1lmtnmfvtls  Drr(m ;u4alxo oetldfs el( s () eermfciotomt aivs ( t2xo(o3oo1optnmfcias) rtrum nt4aee ioctatfm2el(vsnu0tetnmfciodop elnvs;( s2uoirpnu4oltemfvs t  2uau  ;o4oexnmo3ilsfaDrm(mpn()tlenmf ty1omD  ivs;s0t2umxrpiu1am nlici (f rtmum nt4tle mictasls2umumpnt) ltoxo3oo1fm  luvolt0s2xr(m3nu4alt mici t)arta(mp;u4alx  icilsfs2rmnmsn(0teeoif3totfpDr ieo t0 rum(rpno4lpe mfeslt srumxmo;o0tlxo oeiydla raumont)tlxrxr todfmD au i;s  exm(r no1lp   ivi tf rurxrpot4oleoioeiys a2ul(mpn(0alenmf3totlp  li s (0t2uoimpoodlptemfcilt arrmumpot4oltnmfciatfaDra(vpn(4arenifcoo1la  livs t0trxrir3oo4lpe  ncilsfa2tmur no1ope mfctltfs2umn o t) etrmrcoa1fp r ivi t0 2uoim ny4omtnlieiat  2ra(rpou4tpxn f3iyt aDrlump (4trtrirctotoate nvol( setmir iu4lm   fct s  ruru pnu1alx mo3tytls eauvs (4 rtrxfciydomDrluvi s) rtrxmpiy1lltn nvt (  2rrxmpnu1oltomietas s2em(vsnu)texoiociatomD anvs () rtrxr oy4openlivs t arrmxmoou1tle iiciyd m uaums;t4artrmr3oo1la e nvols) eurirpiy4lmee nviat) rtrx pnt0oltn iciltfa2umuvsnu4aeeomocoa1fmt an o;t0trur(r iodllt  nvsat sDrmx pou4tetoiietad s rmumsnu0treoif ootomt au o s  2tr(mpoudamtemivtltfarumu o;o0aexn f3tas mDrl(vp t0alerxf tytopteli ilt0 ruo(m ny1al  lnvs (f Dtrx p;t1olxo i3ias mDemn o t0 eeomo tadfp rlneo;s  rxr(o3iodlp nliei tf 2tax  no4ale mietlsls2uln onu)artomocio1oa   n o;s)s2umxrpoydlp   ncsa(fs2tmx ont0teeoiieilt a2rm(vo (4areomo ia1fmD lnes (0 2umiopoy4apen ivsa(fa2raxr ;o1tlt ioetaslmDrmnms (0 leoxf totlp  ln i;( s2umxmpiu4apeelfeias aruau ono4olx  oeild m2rmn ont4arxnxfctytoptelivs ()t2trxrpou1olenmfctas srtrxmpnt1opxnifeiytlaDumuvpn(0texrxrcto1lpDrai ol(0t2uoxm nu1ol emfcsat arrmur nt1oltn ietlsfa uau p;t0trtomf3iodfm rluvi s s2urirpoy1om n fvtl( aDtrur ;t4apeo octyd m2rmumsn(0teerxr3ty1fateauei s)t2umxm oydapenmnesls a2taxrpot1tetoioeiat s rluvo ()aexrircta1lpteluvi () 2xrio3oodlptemict (faDrr( pou0tlxo o3ilsfsDeaumo;(4altrmr tytoaD aneo;() 2xoxmpny4ll  lneta( srumumo;o1aexn iciydfm em( o u) exrircto1lmDraneol(0 exmiopoy4omtnmivtasf Duau pnt0oexo i3iydlsDuaums;u0alermocoadlaDrln olt  2umxo3oydlmtelncta( artau  oo1oet ioetydlsDum(msnu)trxrxfcoodomDelnei;s seuo(m nudap nlivia()s2umumpnt4tlt  fciltfm2rl( p t0 exrif oodfm e u o;s0 etmirpiy4omtnmncta()aDtr( p;u0aptomiciysfa2umnmo t)trerir iytfpte ies;s0s2toxopno1lp  lfes s)aDur( poo1alen iciaslm2uanvs t0arermr3oatomtr nvsls)trto(o3io4apt  iet ( aDrr(mo;t4tpto i3tyd mDuln s;t4 rxoxrciy1fmDeaieol( srurxm iodope  fvs s aDrrxm nu1opxnmfciyslaDul( s;(0 eerio ty1laDeaieilt)sexr(m3oo4llee nesa(f rrrx p;o0apeomfciltfaDrlnvs u)tleoxr oadom r i ol(0srurxopoy1alen fvs (  Drr(r ;t0oeen oeiytlsDra(vs;t0arxrir3oa1fa eluei;s teurxo io1lp elnesl( a2umxr ;u1tpeoiiciatlm2rlnvp;(4alxnmf ty1oaD livo (0 exmxm iudap   fvsl( aDumum ;u1oexomi3iadfs um(ms u0arerxr3iadop eaueilt sexmim3oodolee nes (  rtru pno4ape mfeild a uanvsnt0 etnxr ia1lmD au i;s)s2xoxr3oy4oltemneilsfs2um(ro;t1teenifcild mDel(monu)teerxr3oadlp r u ilt teuoxopoo1ope mnvt s)arrmur ou1aetnifctaslmDeauvonu) leriocoo1lmDr ivslt0 2tm(m oo1lpenlnvt () Dtrxrpno0aptnmf3iytfmDea(ms t4trtnir iatomDean i;s)t2xoxr oudol e ivias)s2ta(mpnu4altnioctldfs2ea(ms t0arermocoydoate ueo;t  ruoxrpnudop elfvtls) rtrxro;o0tltnmo3iasfm eanvs t0altrir3iotomDrlneo;t) rumxopiy1omenmnvi (  2umxmo;u1tltoio3tys sDuaumont)tetnxo iy1op ean o;t0t2urxm3iu4ole lnci s) Dtrx  ;t0ale  fciys m2raums u0areomo ta1fp e nvs;(0trtrio no4lltelnci tfa2trx ono1aleo ieiaslmDeau pnu4aexomf3todfaDeluvsl(0trtriopny4llt  ncil()aDtm(m ;t0oeeomfeilsfa ua(mpnu)alxniocootom ean i;( t2tmxopou1lmt miesat  Drrur ;o0teto fcils s2em(vp (0trxomf iydoatelueil( sruriopoodaptemnviasfa2tr(mpot1teeomiciyslmDum(msnu)tetrio3tadfa  lieols trxr(rpoo1altemfvtl()a2urxmp;u0tpeoifeiat sDum( o ()tetomf3oydlate neo;t0srtoir iu1lltemivsl() Draxmpnt4olxo feiysls rl(vs u4trtoif3oy1fpt an sls)setoxo nodoptemnes ()arrm( pnt4ale mfeiat sDem(ms t0arxrio3iotlaDranes () etoio oy1om nmfvs s) 2tru pno4texnmociat s rmumonu4 eeomr3iotlm r ues s srur(m3oudapeemivtlt  rtaurono0aptomf3tat s2rauvsnt)trtrxrcoo1op r uvsls0trtmxm ny1altnmivtl()s2rmx o;o4alto f3iytla emnms u)tlenir oodfaDraivolt  2umxr3nu1aptelfci (fsDtmxronu4altomf3ilsfa2ul(ms u4tlxrio oa1fpteluei;s)srtr(m oodapenmfeta()arraurpno4olenmiciltfs uan s t0trtrio iytfa   u o;s0tetoxo3iy4op emiesas arta( p;o1olx ifetadfsDra( s;u)aetrmf3tytlmt  ivo ( trtoim3iu4alen fvsasf Drr(  nt0tpx mfciad a rmumo u0trerxr3oy1fa ranvi ( sexoim3no4om e fcs s)sDrr(mo;u0aleo o3tadlm2el(mo (0tltrifciytlmt  nei;s)t2uoxo iodopee ietl()a2tmx o;t4aee mf3iatfa rmnvp;(0altnxf oo1lm rlivi;t0trumim iudapt mictls) rraxmont1altnif3iys mDumnvo t)aeeomr oo1lpteli sls truoxopio1lmte ivi t arur(mo;t1aex mieiyt a rm( p (4arenircio1la  ai sls0 exoim3nodoptnlncs t)aDrr( pno4olx if3iadlm2eau pn()altrmr3iadfpt luvs t0srto(r ou1olenlneiat)sDum(m ot0oex  ociltfm rluvs;u)trtnifcoy1om rlieil(0t2trxr3iodom e ncil( arrmx  ou1tet  fcilslmDeanvp u0trxrmrcia1lm eliei;()t2xoxrpio1oleemnvilt  rum(  no0apt ioeiasfs el(mo;()aeeomr3iytopDeauvs;t)setm(m3ou1lm nlncil()s2rmx oou0apto o3iyd mDelnmpnu0tetrif3ootlpte u i t)srur(rpnodalt  fvias aruaxmpoo4oleniictysla ulnms;u0tlxrifcoytlpDrli s;t)teuo(m nydapenlnvt s)sDuaur ;o4texo i3tatlm umnmo u) lerircta1lpDr ivs (0trumxrpio1op   fvi tf 2uaxr ou4tpxoifctyd a uauvsnt)aetoif3ty1fpD lueols)seuoimpiodlm   icsat arrm(  ;u4tex iieias a uln s u)aexoxr oadfaDrluvs;s)t2ur(o iu1am nliesl( s2rr(m oo0apt iictltfs2ranvsn(4 leomf oa1om eauei t0 rxm(r nodalenlneil( aDtax oou4oltnifctadlmDum( ont0 lxnmrcoytopt lueslt seum(m3ou1apte iesls)a2um(r ;t0oet  oetltfmDul( s u) rxnir3io1lmD  nvilt0trurxm3ou4ope  netat)a2raxrooo1oeeoifeiltla2rlumo;() rxoxr3iytfa rliesl( t2to(mpoo4altnlfesl(f Dta(mono4aetniieilt s2eanvo;u4aetomocoodoatelu i;t setm(o3iydlle  fvsls) Dtrxro;o1alxnmi3iyt s eau pnt)tlxrxr ta1lmtrlnvi t0trxmxm io1lmt lfctlsfs2umumo;t4oexnioetydfmDemnmsnt)tetomo3iy1fpteauei s0t2trim3nydoltn fes s sDumur ot1ape mo3ias aDua(vo;u4altnmfctadlpD lneo ()sexrio no4al elieia()a2umxmpoo0ape  ieiad s el( pnu)texrif3totlpD auei;s0sexoxr3nudlpe  iet t) rtrxmp;t4ale  ociatfs eauvont0tltomr3ta1faDelieo;(  rxr(o ou4lp   fciltf 2rmu poo4optoif3iyt sDua( sn()aeeomr3oo1fa rau i;s) eur(rpou1ame mict t aDrax p;u1tpx ii3ilslmDuaump;() etnmo io1late uvolt0texmxr3io4ale  ict sf ruru  ou0oleoifeiadfaDranvp t)alenxr ta1lm eai s t srur(m nydal nmivsat) 2umx o;o0open feilsfaDel(ms (0aetnxf oadoa ranei;s) 2xoxmpio4lpeelicsat  rtax oou1aexo ociadfmDumnmo;t0trenmf ia1fp  lu slt0s2tm(mpiy4llt mivt s  Dtrxrp;o1oex miciysfaDuaumo u)arenmf3iatlm elneo s t2tm(r iy4lmt  fvilt) 2ra(rpot4tpxn o3iadlm emuvs;u)areoif iydomDraiei;s)srxrimpiodllenliesa()a2ta(m ;u1aet io3iysla emu pn(0 ltrmo3oa1oaDr neslt0srxo(opoudapeelnct t) 2rmxr ot0alx mociydlm um( s t)aeerif tadfat  u s s)teumxo iy1ol n ietas)arrrur ou4ole if3tatfm emumo;(4trtomr3oytfat an s s)seuoir oudoleelfvtasf 2urumo;o0aexnii3iltfm rmn onu) etrio3iytopD aieilt  exm(r3io1amtn netatfsDrr(r ;t4oex mf3tld mDrmuvsn(0altomr to1lp r uei;t texrir nu4lmtemfetat) rurx o;u4aptn ieiysfaDrmu pn() reoxr3todlm e ieo ()srumxopnudopt mfci ()srururonu1oltomociatls uanmonu4 rxnxoctotfmDeli il()seur(rpoy1oleelfei sfarrm(m ;u4tpx  fciasla2eanmonu4trxnmf3oytfpDelivi s  eurirpio1lp nlnvtltf Dtr(rpnt1aeeo i3tas s uan p ()alxrio3oatfmt an slt)s2xm(r3oy1lmt mncsa()a2tr(m oo0olx  f3tydlmDemumo () lenmo oa1oa  aues;( texrio nydoltnmneslt) Dtax pot1tlt  fctls s em(vo u)trxnio3tydlpDr n ils  2xrxm nu4lp e ncils)s2ur(ro;u4oetnmiciadfa2ea(mp;t0trerxf3iotoat an s;(  2uoir nu4lmtnmnvtl(fsrrr(  ;u0aeen i3iyd a ua(mont)tetnmf io1oa r n ol()tetr(mpoodomen nci ()a2tru o;u4aleo iciltlsDelnvs;u0artoxr3oa1lmtr nei s t2trxr io1aptnmfcia()artaxmono1oexoifctlslaDemn onu0trtomrctydlaDe n i ( teuoxrpou4ap emnes s s2tm(r ;u4tleoii3ilt a eluvo;(4 renio iy1oaDe u ils)trxm(opnodlm elivi t)arumxr no4aptn feiatfa ul(mo u4 exrxrciytlp   ieol( t2tmir3oydapt  fcta()srrmxroot1alxnmfciydfsDul( s;t0tetomr oodfaDr i o;t0sexmxm3nudll nmfctls  rrm(mo;u4tlxo o3iasfa rmuvont0tltoifctodfa  lneo t) 2tm(mpio1olt  nci () 2uaurono4tptniicias s emump;t0altoxf3oatoaDe n o;s)t2toxopnu1oleelieilt a2uaurono1aex mfetydfsDrl(vs u0texrxo ootfmtran o ()seum(m iydlm e ivi t aruaxmoou4olen o3tltlm2emn p (4aeenmrctotlpD  nvs () exm(o oy1apeelieils  rrmu o;o4olxomo3ils a umn s;t) rxrxfcoatoateauvils texmio oydlle  ict sfsDrau  ;u1ope mictyd s ul(msn() ltoircoo1fpteaueo () exoio3iy4al n icslsf rur(m oo4opt mfcilt sDrln o;()aexnxf oatoa   uvil( srxo(m nodlpt  nesa()sDtm(r ou0teeomoeiadla2um(mo u)arxoxo to1lp r nvs;s setrxm3iudomen feil()arumxr ou4oee  oeiasls emnvp t0 lxrmocto1fm   i o s0 rxrxm ny1ap   nvsltfarrruroot0oleo feiyt m ul(vsnt4 rxrmr oo1omtrln il( srxmim3nodapt lfviltfa2ra(m nt1aeto i3tls sDemnmont0trxrir io1faD an i;t s2urxm3nodol nmietlt)arum(m nu4ope mo3ilslsDrm(vo;u4altoio3tydfpD li s;s)setrim3ou1al  livslt s2ua( p;u0alx mf3iltfsDrauvp;(4 exrxociy1faDrlneil( trxmir no4aptnliviat aDrmum oo4tpenii3ild m uaums;t0alxomfcoydom r nvi;( srtmxr oy1lpee fvtlsfa2urumpnu1alx ioeiasls2ua(ms t)altnif oadom rlneol( srxoxo no4optnlncta( s2raum ;t4aeenmoctadfm em(mp ()tltomoctatlmD aneo;t0 exoimpiydlpt lnci s s2rrurpoo0oeeniociydfaDem(vp;(0trenio iy1lp r ueolt  eumir oodopee fvtat sDtru oou4oeeomf3tatfsDemuvs (4artrxfcootlp   nei;t)setrxm oo1lm  miciat aDururont4optniietytfs emn pnt0tlermr3ty1fmDraieo t)trto(o3oo4lp elfvs ()a2umuro;u1apxomi3iyd a2elnmp u4 ltrmo3tatom elu sl(0truoio3oudalenlics sf Dtm(rp;t0teenmo3iyslaDrmn s (0aetrxoctydlptelies;t)s2xoio3iudlpenlncsas a2raump;o0oetomictlt sDumnms u4artrmfcto1faD  iei;t) etriopiydaptemnei s sDua(  ;t4tptnmietltls2ua( pnt) lxrio3oo1fmDelivsls0 rtmim ou1lpe  ivta()srurxrpou0opxo f3tlt s uau onu4 rxoif to1fpt  ies s)t2xoio iu1al e iviasfsruau  ;o4oexniociys mDuauvs;u) rtrxr iotfp  aneolt0s2uoxr3nu4omte fvtatfarrmu  nu0ape micilsfm2emump u0 etrmf oadfaDrlieo s srumxo nu1optnlnesatf 2rmxmpou1texnifeiatfa2ul(msnu4altnifctotfmt ai ols s2um(r oo1lmenlietltf 2uaxr oo0tpeo oeiadla elu s t0trermf ty1lmteai i ()truoir no1omtnmnvt t) 2tmxro;t4optomo3iasfm2em( o;t) leriocoodfaDrli ols  rxoio3oy1al elivslt srtr(ro;t4tptn o3tyd aDeln onu0trenxf3io1lpt aivi;s) 2xrimpio1lm   fvil( s2rrumoot1aetoif3iadla eanvont0 eerif3oodopDrliesls) eumxm ou4ape lnci s  Dum(  ot4ole  feiltfs2rmn o;u0tltrxf tytfaDeauvils0trurirpoy4ole mieia(fs2tr(rp;o1apxoiictytla2ea(monu)trxomoctodop  au o;t teurxm3iydalt lnctl()a2umurp;t1olxomi3tad sDrmn p;u0 lxrxf3oatlmDeanvi;() rxoim3oy4lmee fvsas  rtax p;u4tlxnmoeils s rl( o;t) lerir3oydoate nvs s trurxmpoo1lme mfvi sf rua(mp;o0olen o3iatls raumo;u4aexrio3to1oat livi s0trum(opou1alenmfesl( arum(rp;t0oet mfctatfa rluvpn(4trerir3oatfmt  i s t sexrxr3iu1lm elfcia() rum(m ;o0opxomieildfs umnmpnt0altrmfctotfpD ai ils) rum(r3iu4llen ics s  Dta(m ou1apt  feiatlm2rmums (4tlermoctodoat  ueo s) eumxo ou4ap nmics s) Dtrx p;t0tle  ocildfa2um(msnt4artomf oodfa elueilt  2xmim3nydopeelnvta( aruaumoot0texoiieiydfs ua(vs t)teenmrctadfp r nes s)setrxo3iu4omt  fvslt aDrmxmoou0teeoiictltlsDulums;(0texrxf3io1om rluvi;s s2um(rpnu1omtelieslt artau  ou4tlxo oeiatla2emuvpn()texrxr3ootfa eau s;(  rxrxo3oodal nmnvsatfsrrr(  no0aexnii3iasfm uau pnt)altrxo3iotoptr nvil( trxmxm3nudamtelfvs t)sDumu p;t1tpt if3iltls ulnvo u) ltrifcoatopD li i t  euo(m3no1ap nlicsltfsDraum ou1tlen i3iyslsDumnvsnu) lenxo tadopt  neolt)trtmim3oudap nmnesl(  Draxr ;t1tlxoio3iatfa um(mon(4 ltriocto1la e nvsls  rum(opoudop nmnesas arua(mooo1aexnmiciat m2eau pnu0aetrxrctadfatrlueo ()trxrxrpou1al nlici sf rur(  ou1aee moeildla el( p t0aetnif ia1oatrauvo t0 rtrxr oydlpe  fvtl(fsDua( o;o0apeniicildlm uau s ()alxrmrcoo1oa raies ( t2xrxmpnydlltnlics t)s2uaxm ;o0oleniiciysfmDrl(mp t0tleomocto1fm elueslt0trtoxr3ou4op nmivt sfsDrrur ;u4openmf3ias mDraumo u0 leoxr iatlmDrlnvi;t setoio3io4omeemfesl(f rua(mo;o0oexoiieildfm uan o;u) rtniocoodlmDe n il(0trxoxrpoy1lp  mneslsfsDtruront1tpto feiadfa elnmo t)artoir oydom e i ol(0 rxrirpoudam  miesl( s2tru  ou4opt mietas a2el( o;t)arxrxrctytfmDeanvs;t  eum(o3oo1opt mnctat sDumxm ou4tpxniicildfaDuanvonu) exomfctytfa rlu s t trxoxr3oo4oltelfvi sfs2rmx  ;o1altomietltlsDraumpnt)alenmr oadfm rluvol(0 exriopno4lmeemnvils)sDumx  ;o0texn ieias aDrmnms;u0trtnmr3iytfat au ilt  2xoxrpou4ap nmnvilt)sDua(root1ape moeiyt a2ra( s ()teenxf3ootomD lu i;t) rtr(o3iu1am nmnvsat s2uax p;o0aee mi3tlsfa2rmums;t)aetnifcootfpDeaiei;s0 eumxr nu1al n fvsatf 2ur(rpot1oexnmf3tlt m eauvsn(0 rtnmrcta1laDrli il( teuoxr3oo4lp n nvsltf 2ua( onu0oeeomo3iasfaDraumsn(0 eerifcoytop eauei;() rurir3ou4aptelieia( s2ua( pnu1alenmictadfm eln p;() ltnxo todomtr u i;t  rurxr oo4op nlfvsasf rrm(mooo1olxoifeiyd mDrl(mpnu)aleoxo3io1opDeaivs t)srxmiopoydlpenlnetl( srua(mpot4tpenmf3iys a rl(vp (4 etoir to1fm  lu olt)t2to(o oy1ol nlnci sfarumx o;t4alen o3iat aDrmu s t4teenif oytlpDr nvsls0 rum(o ny1optemnvtlt aDur(m no1tetoii3tlslmDrau snt)arxrio3oy1optr ivo;(  rtm(rpny4ll elieils)aDtr(m ot1teenii3iydfaDrlnmo;u0teeoio3ty1opteaiesls0 eurxmpiudlm elnvil(  rtrumo;o1tpt ioeiysls rmnvsnu)trxoxo3oo1lmDeaieil( t2toxr3ou1lp e ivt t artaxr ;u1tpxnmoeildlaDumnmo;(0alxrif3tadopt anei;s0texr(m3io1alenmneia(fartr( poo0olt  iciad s umnvs;u4 rtnio3tatoatrlieil(0 euoir oudome  neia( sDtm(mo;o0opx mocias s2elumon(0aetoxo oydopDe i slt0 rtrxr3nu4aptnlfvsl()aDrax p;o0tex  octltlm2umu pnt0aeeoxo ia1omtr uvo s tetrio nydomeelncs ()sDrrumoou4alen oeiltlm emnmp ()aexrxfcto1oaDrauvsls0s2ur(m iy1amtnlfciasfartrx pnu4olxn octadlsDrau p t4aeeriocoytoate n i;s0s2tm(mpny4lm   fvia()s2tmuronu4ale  oeiysfsDuau pn(0 lxnxo totla rai s (0 2um(opoo1ale mnctls) 2rruroou0aetn i3tatfa2rmumsnt4arerxociy1lp  li i ()trum(opio4lmtemieiat)srra(m nt4aexn f3ildfm ul(vpn(4 lxomr3iy1fp rln slt)srxm(mpny1optn iciasfa2uau p;u0aee iieiasfa ea( p;u)aeenxf ootfmDrlnvsls  euoxm oo1om nlicils aDumu pnu0opeoio3iadlaDul(vpnu4teerxfcia1fptelnvs t)texo(rpiu4omtnlieia(faDrrxrpoo0opt  fciltls ua(von(0trtnxo oo1oa   u o t) exo(rpoy1aptelnvta()aDrr(rpnt4olt ifciltfs uanvo;()teeriocoytoat li s;s)srumimpou1opt  fvia()s2rr(moot4oleoioeiyt m2rl(vo;u)artrmr io1faD  n o;s s2toiopiy4alee neia(  Draxmpnt4opeo ieiaslaDemnvo;u0 reoxr3to1lpte u i;s0s2uoim iydlp  lnvt ( sDtmxmo;t0apen ociltfm ra(mo t4arxrirctotoa e ieo;( srtr(r3ou1al n iet t aDrrx oou1olenmicils m uanvon()areomr io1opDraues t)setr(mpnydlleemfci sfsDrr( pot0apxomfciyt s elump;u4teerxf3iytfatr u s;s s2ur(mpnudopeelfviatfs2trumo;o1tptn ictldfaDrl( s (4texnmo3iotfmteluvol()srxr(m3oy4lp eliesat)a2ta(  ou0teenmo3iyslm ea(vo;t4tetnmocio1faDrau o s s2tr(o3iudope livtas) Duax o;o1opxo fetyd s rmuvo;() ltnxfcoodlpteaneo;s0s2xo(mpiudaltemnvils) rrmxrp;t0opeo ictysfs ulu snt0 rtrirciodlpteauei s0 eumxopiu1omen icias) Duax pno0oltn o3iysfa2rlnmont0 rtomf3tadop raieil()s2urim oy1omeelfvs () 2tr(  ou4aptnmieils s rln s u4teenmfciytopt au i;(0srtoirpno4ap elnvsat  2umxrpnt4teto f3iadfm eau pnu)aeerircta1fa e nvo;t  eurxmpno4lmeelnvsltfsDumurpot1ale io3ias sDulums t4areoio oo1opD aueo;() 2umimpoodaleemneslsfsDumumpnt0olx moeilsfaDrl(vont0teermfciotopt  i ils)t2xmir iy1amtemnet sfsDra(  nt4ale mf3iydfm uluvs u0tltrifcia1lpDeauvols0setrxmpoodoltnlnvtatf 2urxmpou4tleoiociatlsDel(mont4tlxoxo3io1fpD lneo (0s2tr(m3nudlm emfvtl( s2uau ono0apenioeils a2umums;t4tltnmf3tadlate ues;t) 2umxrpou1aptemfcsls s2tmx oou1alt mfctltlaDul(vo u4alxrxfcoy1fatraueols)trxoir iudal emietas aDra( ont1aeenii3tldlaDum( pn(4tetnmo iotfat  uvsls) rxm(rpoy4omee ivsls srra(ronu0teeomfeildfs2el( on(4arxoioctotoptr iei;( setrxm3nydalt mnviasfarurxm no1olxomf3iatlsDelu s;t4 ltnio3oa1lp  livo t0 exmxm3io1lp n ncs (  Dtr( p;u1alt if3iltla ulumo;(4aeenxr oo1om eaneol(0trxmxm3oo4am  lfvtat  2rm(  no4tlt ifciad mDraums;()tleoxo iodoaDeaueo s0t2tr(opnu4omtnlicsls aDra( pno0opt mo3ias a em(mp;(0 etrir3oytlate ivs;s trtmxrpno1lmen fes ()a2taxmpno1olx mictatfsDrauvp () ltrxocta1fa  aues;t seumio no1am   nctas sDrmu p;u4aet  i3tytlaDul(mo;(0teenxf3iytlaDeanes;s0setoxm iu4lmee icilt)a2trxm ot0ape mi3iatlsDem( s;(0alxnmr3iodlateauvo t0 etmirpio4alenlfetlt) 2tmumpot4tpx mf3iyd s umu o u4 renxociytlate ivi;t0s2urxo oudom emncs (  rua(rp;t4tptoif3iatfs2emnmo (4tlxnmo iadlp eln ols) rum(r3oy1ol e fcs s aruau  ot1alx ifeiltfaDrm(mp (0aetoxf oodfmtean i;t0s2trir3oo4opt lfesltfartrx ono1tpe ifctys mDrmnvp;u0 etrmr ootlateauei;t  2xo(r iudolt liei s) 2uau  nt4oexn f3iat m ua(vsn(4 etnxo3iytlmt ai o;(0trumxr3nu4open ivt tf rua(mo;u4aeenmietas m umu p u)alermr iodfm r uvs s)tetoxm ny4opte fesa() rrrxro;t4oeto fctadfaDran p ()artoxocta1omt auvil(0 rtm(mpnu1lme  ieiatf rrrum ;u4tpeoii3iytfmDulu ont)trxnxo3iadlaDeau i;( trxoxopnu1optn iciasfa2tax pno4apeo o3tlsfaDuluvs (4altoircta1fmtrli ols s2xrxr3iydapt  feta( sDtm(r ot4alen ieiatls rlnms;t0alxnmr3oydlmtelueo (0 rxm(m oo1ame  ivsas  rraxmpnu0tpeo i3iydfaDua( o;t)tltoifcta1fpD lu s s0 rxoir3oydlp  mnet s  2rrx pou1alxo ociytfs raumsn() lenmrciytfatrauvo ( setmio3oo4opeemfvia() Dua( pot0aleomictatlaDuluvo;u4trermf3oa1fmtrai i (0tetoxo3no4ol  mnvsltfartau  ot1alxo oeiatfaDrmn ont)tlxrio3io1faDrlnei s) rurxopny4lmtnlfcs t srur( pou1aetnmo3tysla rm(vo;u0aetrioctadfmtr n o s  euoiopoudamtnmicslsfsDumx  ;t0oex mi3tldlsDea(vo;t4teeoircoo1lpteai ilt0 rumxo iu4ap emfviltfaDur(roou1apenmf3ilsls2elnvo t4 lxrir3oytlat an i s) 2trir3iy4amtn net s s2umxrpou1tltn ictydfa rmu o t0arxoxf ty1lptrlu s t  rxr(rpio1om   ics s)sDuaump;u1aet mi3iytlsDuluvpn()aeenxr oydlmteauvils0srxoxm3no4amee ies ( arumxm ;t4oexomiciyt a2um( pn()trenmr3oadfa eaivil() eurxrpnydlmt mfvilt) Durx onu0oeenioeiadfmDumn p;()tltrmr3iotfa e uvi t0texrir oudapte fvs s) 2ta(moot4apt io3tas m2ean o;u0teenxf oa1fp e uvols srtmxr iu4lle  fetls) ruau pou0apto fctldlaDrau s;t0teermr3oadoatrln i t  rtrirpno1oltemnesa()arta(rono1tleoioeildls eaumo u4 etoxo iydopte u i;s setm(m no1lm e ncsls)sDraumoot1oee mociys a2ran on()areoio ty1lmtr i i s)texm(m oy1ol   ics s)aruru ono1teenmoetatla uln ont0aleoir oa1op rln o;(0 rur(r3iy4lp e netls)aDumxront4oet mfeilsfs2rauvpnu)teermr ootla  ai sl( sruoxm iy4llt  fct t)a2tmurpnu4oeenio3ildfs emnmpn(4tetoifctydfmDraieo s)t2tmxr oo1olee fcsltfs2tmumpot1apxo ieilsfm rmuvs;u) leoxr3tydfate ivs;( trur(mpny1ame miciatfa2rrx ont1tetomiciydla2eanvp;()artriociydfpD aueo t truoiopio1openlnvsat)sDraumonu0aeen ociaslmDum(msnt4tlenxf ia1laDe nesl(0 rxm(rpnu4llen fct s)sruax ont4aexnmi3iytfm ea(mp;u) ltrif3iy1lmD aivilt0setmxr nu1alt lieiat aDuaxr ;u0oleoifeiatla uaumpnt0arxomo3oadlmDe i ilt0 2trxmpoo1lmee ivta(fs2urur nu0oexoifctls sDemn onu4 rtnifcto1fmD luvi (  rxoxm3iudameelivs tf rtrur no4tee io3iytfa ulnmo u0altoxr iytfaDelu o (0s2um(o no4lpt  fcta(  2ra(mpnu0tptnmictatls2rlumon()aexomfctydfat anei ()texoimpnodlmen fei t)srur( ooo1ole iocilsla2eauvp;t)tetrmf3iy1la elu s s)srurio3nu1ape lfciatf rtm(  nt0olx io3tadlm2rau s;t0aexnxfciatlmt aivi () eumio iydlpenlfcsl( s2rmurp;t0teeoiietat m2rl( o;t4alerxo3to1fm raiei s srtm(rpno1omtnmncilt)arrru o;u0teen f3iat aDel( o t)arenxr oy1lm eanvi;(0sexo(mpiu1altelfciatfsrtaumoou0tpxnifetyd sDrm( o;(0teeoirciodop   n o;t0trxrxo3no4lmen fvsas s2tax  nu0tpxniocias a2uanvs;t4texoxr3ootlate u ols0t2tr(m oy4ll e ieil(faDrr(mpno1tetniictadlm2umnmp u)tlxrmf oa1oatrlu i;s  euriopnu1lm emnctatfsDrm(  ;o0tle miciltlm uauvs u0 lermo3iy1lptran s;s)seumxr3nodol n ivt s)srururo;u1tpx moctldla emumpn(4aetnio oy1omtrli ols  rtrim3iydam e ivs t sDur(m ;u4tetniocils a ra(vo t) exomo to1oa ean sl() exrxr oudoptelnctlt)s2urx  ;o0oet if3tlsfa2uanvp;(4arenio3oydfaDran s;t) etrxr3no1ope  ivilt aDrmx oou1tlx iociydfaDrlu s;t4arxoif iotop  anvi (0t2xo(r3no4omte nvias s2tmurpoo1optnifcils a2rmn o u4tlxrmo3oa1fmDe nes t  eumim ou4omte fvsltfaDtmum ;u0tpe  o3ils s2ea(vp t0areomocoodoat lnvil( srtmimpny1lm e fes (f Duaum ;o1aptomociltfs eauvp u0 rtniocoa1fat  uvo ( seur(o no1ap n nvtas)srur(m oo4optnmiciyd s emuvo;t4aleoxfcoy1fpDrli o;s sexmxo nodlmtemnvta(fartm( poo4aeeo iciysfm2emn s u0tetrxr3oodoaD aivi t)sexo(rpiydlp e nes t)srumxmpot1oexomo3iadla ua(mo;u4altoxr3iytlp rlivi t  2umir oudoltelncilt aDurx  ;o0alenmo3tyd a2rluvp (0aetrxrciodfa rauvs;s trxmiopoy4ope mnetat)aDurumont1alt iiciasfs2ea(vp (0 exriocoy1lpDe neols0s2xrir nydoptnmfvs (f 2ra(moot0opx mieiyd s uan p u)teeoir3oydlpte nvs t0 2umxo3io4am e ncsa(  2um( ont4aexn ieiad a2ua( s ()alxnmrcty1lm rluvo;(0seumxm iy1ame mnvi s) 2raump;o0olt mi3iytls ul(mp;u0artoif iodlpDe nvs t seuo(r3iy1ame mnvt s)sruax  ;o1oexo ictls a2ranvp t) rxrxf3iy1fmDranvo;( trurxo oo1omee fetl()srurx o;u1aeenmi3iydfa2ua( p;(0aexrif3oo1oa  ln i;s0setoxmpoy1op e nvt s  Drm(r ot1tlxnmfciydlmDrmump u4altomfciatlptean ol(0trxriopoodape  ies t)srtm(mooo1tle ifeiytlm2rl(ms u4tlermf iatlaD au i t)s2xmxm nydomen fetls a2taurono1tpxnif3iyslmDrm(mp;t)artoif oydlatr u o;t)t2toim3ny1ol nmnvtlt)a2uaumo;t4apt ifciyslm ean o t4texnmfciydoaD ai s s0trtrir nu4lp nlfcsas a2umx oou4aexomo3iadfa rl( s ()arxnio3ty1fmDr neo;t seuoio iy4lme lnct s) Dtmuro;o1altomiciltfsDuaump;() ltrirciadfpD  i s;t)t2xoimpnodlptemici (fsrrrx o;t1openmo3ildfsDrmnmp;t0 lenif3ootfatrauvilt  2trim iodop   icsas a2rr(mo;t4teeo feiat a2eau pnt) ltoir3ta1lmt lieslt) etoxr ny4lltnmnct sfa2rmu poo4tltoiictldlm2ulnmp u4alxnir3oytfateaneil(0t2umir oo4alen ivsl(  rrru pot1olxnmoeiatfm eanvo (4alxrif3tadoateauvo ( s2urio3oydol  mnei (f 2rr(m ;o1opeoiietytfa2eauvp;u) exrmfctotla rlnvs;s0texo(mpoy1am  mfvias  2rrx  ;t0aleo f3iatfm2um(vs;(0 etrircoo1laD auvo;s)srxoim3ou1lptelnvsl() rtru pnu4oeenmieiatlm2um(mo t)altrir3ootoa  aneils) 2tm(m io4lpeemictl()s2urum ot4aee ioctltfaDrlnvs;(0 ltrir3iatop e neils0sexr(o nudam n ncta( s2um(mpou0olxomieias s2rm( ont4 rtnmocta1fateli slt)s2trirpoydoleemncsl(  rtr(m oo1oeen feild a emnvs;(0aeerif3ia1fpt aies s) rumim3nu1omtnmiesa(fsDururonu1teeniicias sDrauvp;t)tltoioctadfa   ivsls trumxmpnydal   ivtat aDur( ono4oeenmociad sDua( s;(4trtoio3totlmtran i;s teumim3nu1lp nlicsl(  2urur nt1opxnmiciyt a2el(mon(4 rxoir oa1lpte u o;s trurxm3ny1lp  lfctl(f 2uaxrpoo1teeoioctyd s ua(vont4aeerir ootfm e nvi ( srxmirpnodomtn ncsas) Dra(rpot0tpxomfetatls raumsnu4aetrif3to1oaDrau o;()t2toxm3ou1altnmnes (f Durum nt1alxnmi3ils m2rlums u) eerxr3iatfptr i s s)trxrxm nydlm elnvil( sDtm(r oo4aeeo fciat a2rm( pn(4arxnir3ty1om  luvs;s)srumxopnydamte fvs t)aDrm(mo;o1apeoii3iysfs2rmnvpnu) lenmr oadom e ivo;s) eurxr3iu1al elfet s)s2ra( oot0tltn ieilsla rln p;(4 lxoifcoodlpte iei;t0 rtrir nu1optn neils)sDrrxm no1tpx mi3iasfm2rlu pnt) lxrxf iy1lp r u o ()seto(r ou1olt lfcias)arrmx  ou0tetoioeild s2ulu o;t0teerif iatfp  aivo;t)srum(o iudam n fctlt) Dtaur ;u1opeo fctldfmDran p t4 rtomfcootlatr neo;t  rtrio3iudalteliesls  Dra(m oo0tpenmfciadlmDeanvo;t0 etrifcto1lptraies;() rtmxmpiydamenlfvia( sDuru oou1tlt  fctlsfsDulnmp t4texoxo iotoa rauvil(0t2toiopiu1lle lictls sDra(mooo4olen i3tldlm ua(msnu4aleomo oadfpD auvil()trumxr iodllen neia() 2ua(moou0opxn iciytfmDulnvpn(4trerxrctatoate iesls)s2trxrpoo1lmt  feilt  2rrxmo;o0tpe mi3tytfm rlu s (4 etoiocto1fpDe uei;() 2xmirpoodlpte ncs (fa2urxm ;o1oex mi3tlt s2rauvs u)aetrif3ta1lp  lneo;t)srurxm iydamte ics tfsDrr(mp;u1alxomicias a2ua(ms t) ltnmr3iytfaDrliei;s)srxrxo iy4lltnmfesls)aDrm(rpno0ape  ociytfm2rmnmp u)alxrmrctodomt aivi;s)t2tmio3iodomt lici t)s2rax  oo1apxnmoeiaslsDrmuvonu0teeomfctytoa  li o s t2xm(m3nu1apenmictls  rta(mo;t1tlxoifeildfm2ua(mpnt0 reniociydlmtraivs () 2xo(mpoodomtelictlt)arumxmo;t0aeen i3ilslmDul( o t4 eermf to1lpte nesl()s2uoim no1ol nmnvi t  2rr( o;u0tet mo3iytlm2rlumon(4altrxr todlmDean il(0trxoio no1lle mnvi s s2ra(monu0opeoio3iydfs elnmon(0tlxomocootomtraies (0 etmim iy1ll nliei t) Drax pno0tex mf3iyd m2umn s;t4 lxoxf3tatfateli o;t0 2trim3no4ll   ictl(faDrmxr ;o1tleomfeiysfa2rm( sn()tetrxo3io1fate n i;t  rtoxm3iu1lp elfvt t)aDrru p;u0tle  oetlslm rauvs t4 leomf3oytfaD liei;s0setmxmpio4openlneiltfarurx pnu1teenmi3ils a2em(vpnu)trxoxfcoo1lp r nvi;t0 etrxr3io4llee nvt s)sDuaurpno4oetomf3ilt s2rln s;u)aeenmr3tydfpD au ols0seurio io1am e ncs t)s2rrx  oo1apt ii3iat sDem( p;u4 rtnio oytlat ln i;()truo(o ou1lmeemnvtasfaDrm(rp;u1tlenmoetad aDrlnmp (4teeniocoytlp rauvi s sruo(o io4ll elfctl(f Drauro;t4tle iietltlm rmnmp;u0trtnxf3iatfm  lnei;t t2tmxm oy4omeelfci s)sDurumpou1optn feiltfm emnms;t4tlxrmo ty1lmD lnvo ( truo(mpnydam  lfctat)a2taxmpno0opxo i3ilt a2elnmont4tlxnmo3oy1oaD aieols)trumxrpiu4amenmnes ()sDrau poo4apto fciat s2umnmp;(4 leoirctodlp r i s (  rurirpiydop nlnvi t)aDtrum nt4oexomi3iytfa2ulnvs;u0 lerxociotlmtelnvo;s seuoxm3io1ll   fes s)sDtaum ;u0tleoifciysfa rln s;u4teerxoctatopD auvs;s0tetm(o3oudlmtnlfet sfsrtm( oou4aleomfeiatfm uan ont4 ltomf3oy1fp   i o;()setmiopno4omee ietlsfa2ur(mpnt1aeeomi3ild a emnvs t)aexrxr oydfaDrau olt trtoxm3ou4lmtelneiat s2trxront1aptn oeiys s2rmn snt0arenmocootfmDrau i;t s2tm(o3oodoptemivt t)aDua(moou1aetoio3tldfmDua(mpnu4aetrxo iadlaD  ues s)tetrir ny1lmeemfci s sDuax o;t4aee mo3tyd a2eanms u0altoio3tytoat aueo;(0 2tmio3iy1lptn fvtl( srta(mp;u4aeeomo3tysls2ranmsn(0aetomf3oadfmD luvo s0texrxr nu1alt  nci t  Durxrpnu1teto ieiytlsDul(ms;u0alxrif iytfm raues s0srurirpoo1om  mfvsltfsDrr( oot0ale  fcilsfsDuluvsn(4 ltnmrcoy1lp eai s;s0teto(mpoy1am elfeslsfs2rmurp;t4opeo f3iydlm um(vp;t0teenio tadomtr u o (0texmirpou1altemnctls)aDuauro;o4apeoio3tasls rm(vo;()arermrcia1op elieil(0 rumxrpoy4om  lfcs sfsrua(mp;t1altomf3tltlm ulnmp;u)tleoir3oodfmD luvi s t2xmim iydam n fetltfsDta(  no0apxnifcildlsDua(mo;u0aleoxocia1lmte uvo;t0 rxoxmpiu1oltn fes s srtmx ono4olxnioeils m2ulu s u0 reoifctytopD  i s;( teuoirpny1olte fvslt)a2taur nu4olen f3iydlm2rln pn() ltrxo3ty1fmteaueols) 2tmir oo1op  lfciasfaDum(root4tptnmo3tydlaDua( on() lxrio iy1oat auvo s0 2trim oydalt  ici (fsDrm(mp;o4oeenmociltlaDemuvpnt0aeenirctytla rau s s0 2tm(r iodll  lnvi s)aDtr(m ;t0apxn ieiltls rauvs;u) exoif3iotoa raivo;s0 exmxo ou1ll nmncsls s2tmurpno0oetniociyt s2uan pnu)arxoxfcoytoaD aieo (0srtrim3nodlptnmnet ( srtr(  ;t0ape mo3iyslsDrm( o;(0 eenmr to1fa e ieol( t2urio ou1open ncias  2ra(rp;o4tltoif3iltls rl(vp (0trenio oadfpDraivo;t)srtrxr3oo4ap nmfvt t s2uau  ou4tpx miciatfm eaums t4 eeoif oodfp rlnvi;s)sexoir oydoptn fvs (fs2ra( pnu0altn oetysfmDul(vs t0aetoxoctytlmtelneo t0 2xmxrpoy1ll elnei t) Dtr(rpoo0oexnio3ildfsDrauvp (4alxrmfctodlmt  n o;s0truo(o oydlpe mict sfaDrrumoou0tlxnmfeiysfaDel(mo () rxniocoatomt auvo;s)srtmimpiy1opt  fct s  2ra( ooo0tlx if3ilt a uau s u) rxrxo3oadlaDrluvsls0trtrxrpny4aptn iesl()s2um(  oo4aeen i3iatfm2ra( ont4 ltoxo todfpt lnes t sruoxopiodaltelivia(f 2tm(rpnu0olto ieiltla2emnmo (0tetomr3tytlmtean s s0t2tm(m3nu4opte fet s) 2ra(rp;u4teeoiictyt s2ul(vpnu0aexomrctytlm  ln i;t0s2xo(rpiy1lmeelivtl( srrmumo;o4aet moctls m2uau on(4aetrxfcootlp  aueolt)sexr(m ny4lpt licsls) Dumu  ot1aeenifeils sDra( o;(0aleoifcoa1fpt ln i t t2uriopou1opeelivil(  rrmx p;o1oetoiictldla ulnvp;(0arxnmo3ia1fmD ai il(0 exrxmpno1omee fes (fa2raxmono4tet mfciltla raums t4tlenxfcoytlaDe ieil() eto(mpno1lptemneils  Drrum nu1teenio3tldfsDea(mp;()aetnxo oo1op raivi ()srtrio oy4op nmfcta(f Draum ot4tpxn feiysfm ul(monu)trtrxf3iatlmt au i t trumirpny4oltemneslt artmxrpno4tetn ieiyd m2uan ont4aeeomo tatfmDeaivilt srtrio oy4ll emivt t srtr(ro;u0oltomictatfsDrln s;u0tlxrxo io1lmtrlnvi;s0sexo(mpoodlm emncil( sDtrxr ;t4opxoiicilsla eanms ()tlxnirciydlaDelivi t srxm(opoy1olt  fcils)srua(  ot1apt miciat m rmn o u4 lenxocoo1la rlnes;()setmimpnudaptelietas)aruaxmo;t1ope moetasfaDean s;(4tetoxf ia1opt  nvo;t) rtmxopio1al nlieilt) Drmum no1aexn o3iydls2rln s;t) eeoxr ia1fat lies s)s2uoxrpoo4ol   nesls  2rrxmpot0apen ociasfa uanvp;u0 eeomo totlatelnvi;t s2xrxo iu4lptemivs s  ruaxmpnt0oexoioeiytfm ea( snt0areoxr3oy1fm e uei;s0 2uoxm3iu1ap nlnes t)s2trxm nt4ope  octasfaDrmu on() ltoif3iadfatelneo;()sexoxrpnu1aleemfvs sfaDrmumpno0tlenmf3iadfs uanvs (4 lerxrctodlaD  i i;s)trurxopiydolt  ncilsfa2tm(m oo0aptoio3iltlm2ra(monu0 lxoxrciy1oaD aueo s) 2xmxo iu1lmte ies (  Drm( pot4apt mocilt mDrmumon() leoxrcoo1fmt  ieolt0t2toxm ou1am elnetas arua(r ou0opx moctydla2rl(mpnu0aexrxf3oatfa raieils0 2xoim3oudll   ncs (f rua(r oo0tpt iietasls ea(mo;(4tetoxrciotfmtelueo (0 2xoxr oydom n iciat)aDrmur ;u0oexomo3iadlmDeaumo u4areoxo3to1fpDeanvslt0 2uo(rpno1lmt  net (fartm(  ;u1tpx  feils m rlnvpnu)arxomf ta1la  li s t t2urxm3iu1llen ncsl()sDum(m nu0opt  ietadfsDelnvpn()arxrmociadlmtrlivo t)texmio ou1opeelnvia(f 2tm( ono4oeenifeiatls2ra(msnu4tlerxf iytoaDe nvolt)s2xrim3iy1lltnlncsa( artmu  ot4apt mo3iytfm2ea( sn()tltrmf3ta1omDrlnvs s)teuoio3oodom e fvils sDtr(r ;o4aeeo f3tlt mDumn pnt4tlxoircoatlpD an o;t0s2toiopiu1lle mfvtls sDtr(m ;t0oet mo3tyd a ra(vsn(4 exnxfcto1fp e neo s0 eumxopio4lme  fesa(  Dumx p;o4oee  i3iatfa2ra(vp u)trxoiocty1latrlieo t sexr(m iy1lpt lfctl(fsrumx  nt1tpxniieils mDuln o u0trxomrcty1op r nvo;t0 ruoirpoudam  lfcs t)aDtruro;t4apxoiociad s2emu o;t4artrxfciatlmDr ueo;t0seuoim3ou1lmee ncil(fartr(  no1apxn i3tydlm emums;(0aleomf oadop eai s;()t2tmxo iodlp   ies tfs2umxmonu0aex  i3tatls rm(vp;t0teenxrciydfmt  nvi;( teum(m no1omtelivtas)sDrr( p;t4ale mi3iatfsDeau o (4aexnifctatop raieol()s2tmio iodape lfctatfsDta(r nu4aptoio3iat mDemumonu4 ltoxo3totfmDeaivol() exoxm3iu1omtnlietlt aDumu pno4tlx  fciyd a rmu s t4altoxo3to1lp  auvo s tetr(o3io4ole livilt a2rau p;u0oexnifeiytls uan p u)teermfciatomDraueslt seurxm nodlpe  fviat  rtmu pnt1apto ietadfs eau pnt)trtomr ty1fpDr u o;s srxrxo3ny4lltemfcs tfsrtaur ot1apx  fctldfsDelnms;t4 rxoircio1la   n sls)t2trxm3oo4oleemivilsfs2ua(mpot0texoifciltfm2uanvpnu0tetrifctadlmteau o;s trxrxo no4ole livs t) rur(rp;u1aetnmietldfm2ran s ()arxoif3iy1op e uvil(0 eto(m3oodlpe mfvtasfarra(mo;u0tlxnioetlsls umu s;()trtrif oytlm e u o ()srxoxo3io4ap elnct ( srtax o;t0optnii3iyslm2el(vp;() etnmocto1lateaneol()t2uoxm3iu1olee fesa( a2rm( p;t0texnmo3iydfm rlu p;(4alxrmfctadfaDelivilt)texoxr3nu1ole  ncsls) 2tr( o;o4tleoiictytls rlu on()treomf3oydlpDeli o ()srxoxm no4ol nlfetlt)s2tm(rpot1teeomoctysfm2ra(vsnt4 renxrciy1fmt aneo t t2umirpnydop emiet s)a2tmum ;t0tlxo octad s2ranms;t4trxrircoodfpt  ues;(0 rtmirpoy4op  mfvs sfaDur(ro;u0tpt ioeiysfs2rmump;t) rxoxo tytoaD  nvo ()srxrio ou4lpt mfeias aDtm( o;u0aleoio3iyd s el(mo;t0 leoxoctadfp e uei;( srumio oodlpenlnvtas aDrmur ;t4opxoio3iydla2emuvp;()tetoxrciatopt  ivs ( teur(opiydlptemietls)aDuaur ;u4opxniictld aDrl(vo;t0trtrmfctadopt aues s)tetoxmpny1alte neil()srraum ;o4tleomicilslm em(vpn(0 renif to1opDeau i () 2xoiopoo1lp  mfeilt a2ra( p;u0oet mf3iytlmDea(mp u)arxomrciadlptranvo;s0 rxmimpoy1lptnlfei t s2umu p;o1texoif3tld sDraums;(4tlenio iodfa   uvo t)s2xoxr nodal nlfcta( arrrurpnt4ope ifciasfsDem(vo u) reomf3ty1opteau o t0 2uoiopoydomtnlfetls)a2ur( pnt4tlenmociltfa umu snt0trerxfcoo1fmDelnvols sruoim3oo4llee fcilsfaDrr( pnt0aeen f3iatfsDra(vs;t) rxomr3tadoatr ieils0 2ur(mpiodlmenlnetas) 2rm(rpno4apt ioeildls2ra(vo;t0 exoio3tadla r neo;() exoir iodlmeelies (fa2urxm ot4tpxoii3iysfm elums;(4 rxrmrcoodlptraueols) rxmxr iu4am emnvs (fartrxrpou0olxn fetysfa2eanmo;u4altomrcoatom elivi;s  ruoio3iu4amt  netlsfa2tax pou4opxn feiasfsDuanvs u) lermrciadlmt lnvs ()teto(m io4altnmnci t)aDrrx ono4tptomi3tld aDrluvpnu)teeoif3totopDr i ils0t2xr(m nu4altnlfvt s)arrmxm ;o4tptniietadls2umnmonu4trxrircoy1omtr uvsls0trum(o3iu1alenlieta( a2tmumonu4oexnmi3tadfa rmnvo u0alxnif3iy1fptrlivs;s  2tmxmpou4lp nlfesat arta(rp;t4tex ioeiat a2elums (4 etoxf3totomDelivol()srxoim nydop elncilsfaDuauront1aetnio3iat a rln s;(4 lerxf iodfmDeaieo;s)srum(r iy4op   fesltfs2urx oot4tpeomfcias s2rau o ()trtrio iy1omDrln o;(0s2xrimpou1ome  nvi tfsrtmuro;u0alto i3ildfs eauvs;t0aexnmr tadoptr uvols0tetrir3oydal nmivia(fsDtrx p;o1oexomfctas m elu s u) rtrmf3todfaDelueo;t0s2uoim3iydalenmicsat sruaxronu1tltnii3iltfa2ul(mo;() rtrio iatoa e ueo;(0s2uoxm ny4om  mncslsf 2rm( p;t1opto fetydfm2rlumsn() etnio iatlaDeau i;(0t2ur(r nu4ame  icsa(  2rm(r oo0optomfetldlmDumnvo (4trtrxo tadla  ln olt)texrim oudomtnmnct t) 2ua( onu0opeomf3iatfm2rluvs t)trtrmo3oodomt  iesl( texoio3ny1lm e fct (faDrau o;o4aetomo3tad m2ean pn(4tltrmf iytop eau o s tetrir3no1am   ncs (  Drrxmono4olt io3iytfm2rau ont)alermrcto1fpD  ivslt0 2uo(o3no4am nlivtl()a2uaxrpoo0oetomociltfmDuaumpnu0trxrmr3iydlaDrlnvs t) rto(r no4lp   nvsl(farraur ot1opxn f3taslmDul(vpn(0tltoxfcta1lmteli i (  ruo(r3nydoptemivil( s2rm( pou4alx  fctys a rlu o t)artnmr iy1oa   uvslt0srxrxm iy1alenmiesls  2rr(mpoo0oee mi3tldls emnvo t4altomfctytomDe ivs t trum(mpoo1opt  iciatfa2taumont0apx ifctytlm um(vp t0 leomfcoytlp eau i;s  2tm(r3no1amtn fetl() rrm(m ou1olt mo3tytlm2ua(mp t4 rermf totfp rlu o;t  2uoxopoydol n nvtl( sDuaxro;o1aetnioctytfa2emn o;(0 etrmf tatfmte nvo t0setmirpny4al emicsls)arurxr ot1ole  iciytfm rm(mont4teenxfcoytlm elnvs;(0seurxm nodlpt mivta()a2ur( pou4apx mf3iat a eaums;t)tlxomf3oy1op  li s t0t2to(m3ny1lme miei ()a2raxm oo1alen i3iatls rl( s;t) leoif3iadfp e neo;(0sexrxr3ny4opt  nviltfarrmumpoo0teenifeildfa rluvonu)tleoxf3iytlmt  iei;(0seurxr oo1lpenmnvt s)s2tmu ont0aptn i3iydls2raumo t4trtoxo ta1la  li sls0 2umxrpoydopeemfcslt)arrmurpno0opxomfcild a2rluvs;u) ltniocoodlpteau slt)trumio3iy4lmenmfeiltfs2uaumoot0ole if3tydfaDelnvo;u)alxnxo3totlatrlneo;()srxrimpno4alee feta()s2urur ;o0oleniieiydfaDua( s;u0altrir oydlptean s;t)setm(rpiy1llee ics (  2rmx  nu0aexo fctlslaDeln s;u4alxoxo iy1lpD aivsls)s2um(opno4ol e feslsf 2ta(rpnu4alenii3ildfm2um( pnt) leomr oy1fp  auvi t) exrxr3oy1om elfvsasfa2umuro;u4alx  icilslmDran o u)arxnxf3to1fmteln slt0s2xrxo3io4amtelictl(fsDur(mpnt4alt mfetld m rl(vp t0tleoxocta1fa eluvi (0teuoxr3oudolt mnesl() Drr(m no4teenioctltlm ul( p t0tlxrxr oa1fp eln sl(0 eumim nu1lpt  nvtat)s2ta(mooo4aptnmo3tytfm ulnvpnt)texnmr3oy1faD  n o s)t2toxopou4am nmnciat) 2umx oou1oeeomo3tlt s ulnvo (0 ltnmr3iy1fmte ivo s trtmxopnydlleemnet tfsrtm(mpno1oeeomo3ilsfsDea(mp t4 eerxocty1omt lies;s)s2xo(o ny4lltemnci t)srrrx  oo0apx mociyt sDuaumsnu)trxrmf iatlaDrli slt0srtrxmpio1op e ivslt aDtrx pou4ale  o3tasls2em(msn()alxoxr tatfmteli o ()s
\ No newline at end of file
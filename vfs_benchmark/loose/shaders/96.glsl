@@ -0,0 +1 @@
+uvilt) 2toir iodll nmieils) 2trumpoo1oexo f3tldla2ul(vonu0tltrxo ia1lm r ues;()setr(opiydomtnmieta(fartax o;t0opxn ieilt m um(vonu0tleomo tatfaDelueolt0trxr(rpoudaltemfei t)sDrr(rono0tlen i3tas sDrm( snu4tlxoxf3iy1fpteauei s)srum(o no1omeelivt () rurumo;o0alxnif3tyslm ul(vp;(4 etrir3iotlmDraneslt) 2xrirpiydlm   ieiltf Drrxmpnt0ole io3iyd s2rluvpnu)arxrir oo1om  an o s0 eur(r io1ope lieiat  Dumxmpno1ale mfctytlmDeauvp;(0tetnxo3tytoa elies s)seurxm io1lpeelfesl()s2ur(  ;t0oexoioctldfmDumnms;u0artrmo3tadfmD luvs;( setrxo io4ope  fctls  rraumonu4apto i3iad aDra(vs t)trxrxf3iytfa e ivils  rxrxm3no1amtnlfctas  2ta( o;o1tet ifeilt m uan s;u)texoxf3iodfm eau ils)tetm(o3nudopt mnvi t sDta(mpnt0tltn f3iydlm rmu pn(0trtrmfciy1opt ln i t  etmio io4lle lncsa(f rurum oo0oexnii3ils m2rm(vo ()areomf3io1op r nvs;( s2xoxo3oodomee ietas) Dumu  no0aexo icils s2ua(mp;t4 leomr totoaD  i o t  rtr(m ou1llte nci s)sDtau pou0tet mi3tat m2um(monu) exnxo3oo1fa ranvils)sexmirpoudam  mfei tf rrrx poo1tpxn o3ilsfa elums;(0areoircootoaDean o (  euoir3io4al elnctlsf rtmu p;t1aex mi3iytfa2el(ms;t0altoxf oydfm eauvo;s0 rum(o3ou1lmenmfci ()s2rru  ;o1opx  o3tysls2ran p u0tlxnir totfm eln s t) exmiopoo1lltnlies sfa2raxr ou0tex  o3iat s2rm(vonu0 ltnmo3oytlmDe nvi;t trtrxm3ou1om  lfvsa(fsrtrumono0aexo feild sDulnmpn(0arxoxr3iy1omDeluvo ( s2tmxr3oudome  fcsls aDta(  oo1oexnifeiytfa um(vont)alxrxf3oydlpDrln o;t0trurir3ny1om elnvs tfs2ua(m no1apenmieiytfm ulumo (0trtnifcoatomDeluvils0s2ur(o oydamee netas)sDtru  ;t0oltoiieiatla2uan ont4artoxr3iatfaD livs;s  rxoxo iu4ap nmnciat s2rmxmpot4oex  f3ildfm uau s (0trtomrcio1fpDrlivs ( sexoiopoydop n fetas)srraumooo1olx  ictas aDelnms t4artrmf3oo1faD lueo;t  ruo(m3oy4lle lfvsas sDrrx ono4apenii3iysfsDuanmo u4 ltrir3totfptranvs;t)t2xmimpnu1openmnesa(fs2uax  ot0tetoiieiysfsDulu o;t0 exnxf3oytla   ivo;s0srumxrpnu1oltelfvsatfsDurxmonu0tptnii3taslsDuanmsnu0 rtrmfciodlp rauvil(0teur(r3oo4lp  mictl( a2rmxmpou1apx  ictltfa uanvpn(4 lxnmr iodoa e neo s  eto(m io4lpt  fvils)sDra( ono1oleoioctat a uan pn(0alenir todfaD ln i;s0 etr(mpny1lm n nesas) ruru  nu1tex moctadls rmuvs (4tlxomo3oa1lmDr i slt seuoxopoy1ome  ietlt  2umumpoo0aex iociytfm2el(vpnu) ltrmf3oadfptelnes t0t2umxr iydlle mncslsfsrra(mpou1altoif3tydfaDelnvo t4altriociy1laD  nvi;(0 rumio3iudom emivsl(fs2rmu p;o0oex  fctyslm umnmo;(0alxrio tatlmDeanvslt srxmxrpiudalt lnei ()sDua( o;u1apeomfciatlm2ra(vp u) rxnmociytlp eaivsl(  rxrir3no1alt mivt sfsDtr(mpno1tetnmoctytfa rmu s ()artoxrcio1oa r u s t) etm(o iodlp emicsa() rrm(r ;t1olxnmiciadfm eanvs;u)artoif to1oaDe i o;()trtr(r3oudale lnct ( s2umx oot1aeeoiictyd mDraums;t4aexomocta1lpt  iei s0srtr(rpiy1ol   ieta() ruau o;u4ale  iciad sDrm(vo u0 exoxr tatlmD  nvs s  rtoxr3oydaltn nvtls)a2raum oo0ope ifetyslm2rmnmo;()alxoir to1omDe iesl() 2uoxm3iu1ol e nvsl() rtau o;t4texo ociyd a uanms t)aexoxr ty1late i i s0trtmiopoy4lmtelicsl(fa2rrxr no4tltomi3tltfm raump;t)teerir iatom r n s s)t2xm(r ny1llenmfcsls  Dtr(mpot1aetoio3iytfmDel( p;()teeriocoadop   ueilt0trurio3oo4omee iei (f 2rax  oo4opxniiciyslm2eauvs;u4 lxnio3oytfmte n ilt)t2uo(o3oy4oltnlfvtl( aDrax onu0tet if3tydlaDum( o;t) lxrxo iy1fmDean s;s)s2xoiopno1al emietltf rur( p;t0oltn f3iatla rlnvsn() rtrxr tatfm r ueslt)sexrxmpiy1lmtnmnvi s) 2rr( oou0tlxomf3ilt aDumnmp;t4aleomf3oa1fpDelnei;( trxmxr3nydal e nvi (  rta( poo0ope mfeild m umuvsnu4aeerir ta1optrli sls) eumio3iydlm n fet t)artr(roou0oeenmociatlm rlnvon(0aeenmocoydlpDean o;( trtoxo io1ap emnet t)sDrmx pot0apxn f3tldfa2umnms (4trxnmo tadfa eai ol() 2xmir3iy4lm n feslsf 2raur nt4aexo oetls a2emums;u4alxrio3oydopD auei t)s2uoxmpoo1op  mfes t sDrmxmooo0optn oetltfaDrl(mo;u0 etoir io1lpDr neolt)seum(opiudomeemici ( srumumo;u4texn fctytfaDuau ont4 renif3tadom elivslt)teurxm3oo4lpenlnetas a2raxr nu0olx  oeils aDran o t4teerif3ta1opt aivi t)trtoxo3oy4ome lnviat)arumu p;t0tpeomfcildla eanvs u4 eermfctotlptean s;t trxrio3iu1lm elnei t s2rr( pno1tet  oeiltlm2rmuvon(4arxrmf iotomt li s t)s2xm(mpoo1lp  lnvta(farua(r ot4oltn fciydfs2umnvs ()alxnxo oo1lpD lneo t0srtrxrpiy1ol  lnvtl(fs2umu ont0opxoiiciatlm eanmonu4arxnio ootfmte nesl( s2tr(o io4altn fvslt  2rmumpot0oetnmo3ildfaDua(mp t)trtnmrcty1lm eliei (0texrxr3oy1apeelfvils) rtaurpnt1tltnifeilsfs2em(mon(4trtnxoctydop eluei;(0texmxr no1op n fviatfa2rr( pot0tpe  ietad a2ul(vo t4 lxnxrctotlaD  u i;s)srtr(r io4om nlfvsl(  Dumxrp;u1aexnmietls s2ua(mpnu)trerircty1fp  luvo;t s2umim3nu1oltemiei () Dururpnu1tltoifeiadfsDum( ont4trxrmf3ta1lptr ivs;t)s2toirpnu4amtemnvils aDra(roou1oltomictat mDumump;(4tetrir3oa1lp   ivs t0seumirpoy4lltnmnvs s srra( pnu0tptomoctydfsDumu p;u)tleoir3tadlp rln s;(0 etm(m3nodomte ncsasfs2um(  ou1tee mfcilt s2uau o;()arenif3iatfmtelues t0 rxm(m3iu4aptemfeia( srrmxront0ape  fctatls ra(mp;t4 ltrircta1oa r nvil(0 euoxmpnu1alte nciatfa2umxro;o1tltoii3iyt mDranmo u4texnif3tytfm elies;s trtmio3nu1ale  nvsat)srtax  nt1aptoif3ils mDelumsnu4aexrifcoy1la eau s;t  etoxm3no1ap  lnesls)srtaumo;t1oleo iciasls rmnvo (4aeerxfcty1fmDe uvo s0setmio ou1ap e fcsls sDrru oou1tlt mi3ilt m ran o;(0 eenxo3iatfa  auvi s)t2xmir io4ll nlivs s sDrm(m ;t1altoiicilslmDeluvs;(4 ltnio3tydomteanvs;s trtoxmpio4lm n fcslt) Dtru onu1tpxniietysfa uanms t)arenxrcoatom   i o;(0seuo(r nu1ol nlfcslt artrxr ou0aexn i3iys s2uluvon(0altrif3oytlmDe nvo (0trtrirpoy1ale liet (  Drrxrpnu4aexo feildfmDul(vo;t0 etnmoctadfa  livilt  exm(opnudol nmnct tfs2tmu pou4tpenifciysfa rl(ms (0texoxr3oadoaDeanvi s0t2urxr3ny4omen fvtlt) rraxr ;u4apeoif3tytfm ua( s;()tlenmoctadlatr n i;s)trtrxo3io4olee iet () rrmur oo0tlen f3iasfa ul(msn(4 exnif3iatoatrlivo (0 rxm(r3ny4ol nlfct t aDrrurpnu1opxoiociydls2ua(vpnu)teerxo3iotlmDranvols0s2tr(m3iu1ll e iciltfa2uaumont0texniictltfsDem( pnt) etrio tatfmDrlu o;(  ruoim3ny4am   netat)a2tmumonu1oleoio3iad s2rl(vs;(0tlxnif3oy1opDe ivol(  rurir3ny4alee neta(  rrmu oou4tpen feiasfa2rln p u)trxomf3oy1fmD aueils0texrxr3oo1ap nmietasf rtax oou1oetoioctld a2ranms;(0 rxrxrciadfp rlivi (0trurxo3no4llt mivi tfaDrr( p;o4tetomo3iltlm2el( s;t4aexnxr3totoa eai i (0 2trxrpiu1lm nmnvtatf Dua(m ;t0tpt mietyd sDeau s;()arxnxf oydla  lu sls0s2ur(r oo1am nmicta( arraurp;o4aeenioeiatlm ea(vp t4altrirciydlm e ueo;()srtoxr3ou1lmeelfvi s a2um(mono4aex mf3iadfmDum( o u4tetrmr ta1opD lues t)teumxo iy4olt mies sf 2uau oou0olxn i3tlsfaDua(vo t) lermr oodfpD aivo t)setoir iy1ope mici (fsDrrx  ou0aptnii3iltfm umumo;()aetoifctatlaDe ueols  2um(o ny4omee nct t)a2uru o;u4oetn i3tyt sDumuvonu0arxnio oatoate n s t trum(o3nudom e iviat a2urxm no0tex if3ias s uauvo (0artrxo todfaD lieils)trxr(mpno4lmt lnesls aDuax  ;o4tpxo i3ilsla elumont4tltrxr3iytom   u s s s2umir oy1optn fvia() Dra(m nt4optniietydla eauvp;u0tltnioctatlmtranvs ()texoxopnu4apee nvsas  rta(ro;u4tpeo oeiltlsDrmnvsnu)aeenmo ta1fmtr nvil(  etr(opno4op elfeias)a2tmx ono4tpx  o3tltfs um(ms t0aeenir3oydomDeliei ( texrir iy4open ncilt a2rmu pno4tpeo octatlmDeauvs;t)tltrifcootlateluei s tetrir3ou4openlfeils) Dtru  oo1tetn oetasla2eauvpn(0teerxfciytlmte u s;s0sexrxopou4lpeelics s)sruau pno1tee miciyt s eanvs;t4aetrxrcoadfa rau ol(  2uo(m3iu4om  lnetatfaDrr(rpnt0opt if3ilslaDel(mo;(4tlxomr3iytlpDrai i t0trumxm3iudam  mietl( aDtaxmont1oetnmfeiydla2uauvon()tltoio3to1oaD  i s ( s2umimpiodalt  fvtls  2ta(mo;o4opxoif3tas mDumu onu)alxrir oy1oaD lnvilt t2trimpou4ape lietls)aDtmx  no4tlxo octytfa2uan o (4arenmfcoadopte uvil() rtoxr3oy4llenmfet s) Dtaxmp;u0tptn f3tadfm ra(von() rxoxocoytop  aneo;s0trxoim3oo1ap  lnvsat)a2um(rpnt4apt ifcildfa2eanmon(4aeenio3oy1oa  li s;t t2xoio ou4lm nliet (  rrrurpoo0alxnmoctydfaDrlump;() exnio3iatopteai ils)seuo(r3oo1omeemnctl(f 2ta(  ;t1opxomictadfsDum(vsn(0 lxnifcta1op r uvi (0seuoxr oo1amt mfetas) 2rr(mp;u1opxomf3ildlsDum( p;() rxrxr3io1fat  i o (  rtrio nodlltn ncs sf Drrxm ou4opxn o3iys a2uan snt0 rxomo oo1fm eln o;( s2tr(r ou4omtelnctls) Dtrump;u1olen f3ilsla eanvp;()tltrxr3ootlmDeaivi s) rxmio3no1omtnlnviatfs2tauroou0tlen octytlm2rln p t4alxnmr3ootfaD aneils sexm(r3no4lpe  ics t)artm( ooo4alxnmo3tytfs2ua( ont4altoif tydfp  anvi s) exoirpnydlptelfvt t a2ua(r nu1tetnmocildla2emuvo;t4aleoxf oatfaDr ies;()t2xm(mpno1lmtnmfct t)srtmum no0tex mfeiatlsDelnvpn(4arxnmfcio1fp eanvo t)trxr(m oydome  ieil(f Dtaxm oo1teeoioeilsfs2el( o (4aexrmo3tytomDeaivi s)trtoxo3nydlm nmicsat)artau pno1aleoiieiatfs emumo;t0tltrmr3iydopD luvo;(0srxmxr3nu4lmtn ies ( a2ua(  oo1aptoii3ilt aDeau snt0aexomf tadfptr nvsl()setmxrpoudolen ies t  Drru o;o4tpe  fetydfa uau s;t0tetomfcty1lpDe neo;s)srumxm3oo4aleelncta( arumxr oo4tee iociaslmDra( snt)arerxo to1faDr nvi;s0trxoxo3oydlm emivilsf 2tax o;u1tptnio3tyd a ea(mp (4teeomf3ia1fmDeanesl(0 2urir no4omt mivsas aruaum ou4olxoii3iyd m uauvsn(0texoxr3io1oaDraivs ( srtoxopiu4ap   ivilsfs2raurono0aet  i3iyslm em(vonu4tlxnxociadop   n slt0texoirpoudlme  nctl() 2tmx oot1oltoifeiad s2ua(monu4arxoifctotfpDrluesl( t2xrirpoo4lltelncta(  2rru p;o0oexoio3iadfaDrmums;(0altrmr3iydom eau sl(0trumxo iydaptnlnei s a2taum ou1tlx mictys mDem(mpn(4 rxrxr iydopt luvsl(0 rtr(o3iy4ale mictltf 2tmump;o0tpeomfctldfs um( s;u0 lxrir oadomt lieilt)s2to(m nu1lltnlics tfs2urxmp;o0opeomoetytfa elnvp t4alxrmo tatlp  lnvilt sexmimpio4lme lfviasf rtauroot0tle mocilslaDrl( o u0 rxnir3to1fateanvi;s trur(o3ou4ope lfetasfaDtr(  ;t4oet io3tlslm ea( p u4 eerifcoatlpteaiesl( sexoio3ny4omtelivtas)arumurpoo0tle mf3tyslm2rlu p u)arenio ta1fp r nvols srxmxr ny4ole lnvsa( a2trumont4texo oeiysfaDuauvsnt4tetnxf3iatfaD  ivsl(0sexrio3iy1lmte fvi (fsDtr(roou1apto ictlsfs2ea(vp;u4 renxr iy1optr i i t setrxr3oo4opee fvs t arumxmpnt4apenmfciltfsDuauvpn()altoxf3ootlate uvs;s  2tmxo3ny1lpe  ncsl( s2rm(r ot1tlen fcilt s rm( o t4 exomo oy1fa raneils0teuoiopiy1llt mieia( s2ra( pno4tpx mo3ildlm rmnmo u)tltnxf3totom r neslt) rxmio no1ap elfctat)s2ta(r nu1tetnmieiadlm2ea(vp;(0 leomr3oatla rlnvi;(0t2urim iy4lle  fvilt) 2rr(  ot4tpxn iciysls2ea( p;u0 reoifcoy1faD li o s0teur(r3oy4lltn iesl(  2uaxr no4tlxnmo3ilt m2rmn p u)tltnircoydom e ueols0trtoxo3ou1ol   fcs tfaDurxmpno0texnmoeias a rmnvs u) leoxo oa1lpDr nei ()teum(rpnu4optelivt t)aDuaxrpnt4teenmo3iydlmDulnms;t0trtrif3todfatran sl(0 2toxopoodap emnvt t)srraxmoot4oltoioetltlsDeanms;(4tleoxoctadfmt lnesls0 2tmxopoudomt micias s2tru  no1oltnifeiyt s el(vo t0tlxnmoctytom elnvi s  exrxr3iodole lnvilt srtmxrp;o0tpto fctatfa2ul( o u0trerxf3todomt lu s ( t2uoxm oo1op nmncsas  2tmuronu1aleoifeias a umuvo t4tlxnmf oodfpD lneslt) 2tmir ny1lm  mfcs t  rtau pnt1tpxoioeiadfs2em( pn() rtnxo3oodfmD  ies;s0t2xmxmpiodll elfcsat artrx  nu0aetomi3tysla rm(mp;u)altoir tytlp   ieols)srurio3oy1amtelics s)srtaurp;t4tpt mfciyd m2ranvp t4tlxrir3oo1fpD aiei;(0s2xmxm nydlptn nes t)arrr(  ;t4tpxomfetysfm2ulnmon()aexoir3iytomt  i i;(  2uo(r3oo4omtelfcsls) 2uau p;t1tlt ioctys aDrmnvsnt4 lxrif oo1fm  luvol(0 exm(rpoo4altelnei s  ruax  no4aetnmictydfm eau o t) rxrircta1oa ean i;s0 2to(rpou4am elicsl() 2rr(mooo1aleomf3ils m rmnvp u)teeomo oadomt  i o t0tetoxmpnudaleelfeiasfs2urx  ;u1tpxoiiciydls2ua( snt)trtrmrcoa1fmDelnvs t0srum(mpoo4olen ies t arta(mono0tpxomo3tysfm2elumpn()tltomf3to1fa eau o t)trxo(o iodaltnmfei tf Dra(mpno1olx  ociasla2rlnvp u4 leoio tydfptr uvo;(  2uoxr nodlp  mnvi ()artaxrpno0apxomiciltfmDranmon(0 rtrirctatfmDelu s t s2uo(m3oo4omenmfcia( a2rr(rpnu1oex mfciyd sDean s;()tltnxr3iadom rln ilt0 rtmxopnodalen fcs t)aDrm(mpnu0aeeomfciytfm2elu snu) eeriocty1fmteln sl()t2xr(mpiu1op e ietat sDrrum ;t4alx mf3tldfa ean p t0 ltnmfcoa1oa eluei;t0t2to(r nudal  lfei t)srur(r no4altoio3tldfa2uanvpnt0texrmf iytlptr i s;() rtrxr nodol emnctl()s2taumoot1optn f3iyd sDuaumo;(0tltnxr ty1fmtran ol()trxm(opoodam  lieslt  Durx o;o4tpeomociad m rau sn() etoio tytfm e u ilt)seum(r3iy1lleemfcs t)srrm(r nu0oltnmieiltfa rm( s;t0trermoctadlptraivs;(0texrxm ou4ameemivt sfsrrrx pnt4apeomoeias m2ua(ms u4artrmr3oadlp raieo ( trumio ny1lmee fes sfaDrmumo;o1oetnmo3iydlm rmuvs t0arxoxrcoatfat  ivi (  rxrxm3no1opt lfctat sDrmu pot0oex  feiadfs2rmu s t)alerxr iy1optrliei;(0t2uoxopny1lptelict s  rrmum ;t4aeeomoeiatfs2eanmp t0alxnxr todlateanvils  2tmir3oodolt  iet t  2urxmoou1aeeo oeiatlsDem( o;t0aleoxo ty1omD au s;(0 rxmim ou4amen nei ()sDta( p;t0texomieiydfa2ua(ms;u4tlermfcoydlaDrluvsl()t2xo(mpoudomt mncias)a2uax ooo1aeen feiltlsDumnvo t0alxrmo oytlateai sls)srto(o oy4om   iei () rum(mpnu1tetoifctldlaDum( p;(0altnxo oydfmteauvi;s) 2uoxo oodapeelfcs ()s2tmxr nu0oee iietltfaDuanvp (4trxomf iy1omt anvo ()sexoim iy4lltnmfcta(  rumuro;u1tpeo ociydfs2rm(mpn(4alxrmf todlpt auvo t0sexrio3oo4olenlfctls)srta(mo;o1tet  feiydla2uau on()aeenxfciytfat aivo s0t2ur(r3iudlm  mfctltf 2tr(m oo4aetn i3iysls rm(mo t) rtnir tytlmtrln i;s)setoir oo4apeelfetasfsDumu  ;o0apenii3ilsla elu pnt4tlxnmr3ia1fat  nei t s2urxmpnu1olen fvt s artaumoot1alenmoeiytfaDrl(mo;t0aexnmfciydfptr iesls t2trxm3oydoptelict sfarurumo;o0opx io3iatfs2raump u0teenir3oodlmtrluvols tetr(r nodlltelncsatfs2rmxmpoo4apeoio3ildlaDemn p (4 lenxfcty1lmt anvo s0trxo(o nodopee fvt s s2rax ont4alxoifeils a umn p;t) reoir iytoaDr ieo ( tetrxr iu4apt liciatf rurum oo0olenmo3iatlm2rlu pn()trenxr oa1oat aneo;s) rumio nu1lp  livt ( artaur ou1oleomoctldlsDrmn snu4alxnmf iatfmD luvs;(0trtoxmpnudolte fetls sDrau pnt4opxomfetysla2rl(vs;u0 etrmo3ta1oat  nes;(0texrxr nudlmtnlnesltfsDtr(ro;t4aeeomfeiltfm ulnvs t) exrxf todomt auei (  2xm(m oodame  nviatfsDumu  no4oexomf3tadfm ul(von(4 ltrmrcto1opDeanvol( setoxo nydop e fesa( a2raxmpnu0texomi3iltfa2eluvpn(4 lxomf tadfptean s;t tetmimpiu1ole  fvtl(farrax  ou1oeto ocildls ra(vp;u4trerxf3oa1faD  uvs;(0seumirpiudll nlnvtl( a2uax  oo1olxo oeilsfmDem(vs t0 exnio iodoa e ies s setoxo3oydlm elfeil(faDrax oot1aleo fetatls ulu s;t) eenio3to1fpt ln s;t0trumxm3no4opt  ncilt)sDtau  ;u0ale  oetldls2rlnvonu0tlermrciydlat liei s) 2trxmpou4lm e nvtlt s2umur nu0oleo fciys s2ulu s;(4trenmf oatoat  ivilt)t2ur(r3iodam  lfei s) 2uau onu1aetomieiltfs el(mo t)aetnxoctadomtelivi s)srur(o iu1lp nlnet (  ruaur ;t4ope mfeildfa rauvpn(0aetnmf oytfa rln ils) rtm(r3iy1oleelfvtlsf Dtaxrpnu0tex ifciad sDeauvpn()tetnio3iydlaDeliesls)trxm(opoy1ap emieil() 2trurpnt1tlen oeildfsDemuvs u)artoirciadla eln sl(0 2xoimpoo4lpeelivi ( s2ta(  ;u4tee  fetaslm2umnmsn(4 ltoxr3oydla e u i;(0teuo(m3oy1amte nci t) rua( p;u4tlx mieiys mDuluvs u4aetnio ty1lat aies;t tetrimpiodom  mnvtltf ruaum oo1tltnmi3tyd aDuln sn(4 rxnmf oadopD ln o s seuoim3nu4lmt mnvta()arrmx p;t0alxnifciatla2em(mo (4 lerxo3oadlatelivo s)s2toio io4al   fcsltf 2tax ooo1tpeomoetatfaDranvo;t0trerxfcoa1fa rauvs;()s2xrxm3ou4lpe lfetls)a2rr(moot0optnmoeiat mDuanvs ()trtoio iadfatrlieilt0trxo(r oo1apte nes t srtmumo;o1apx  fctasfmDeanmpnt) etrmocoo1lmtrluvi;(  etmxr3ny1lmeelictl(fa2ra(mooo0aee  i3iytlm2rau s;()aetoircta1fmtr u olt0trxmim oodomte fviasf Dumu oou4olx io3ildfa ua(mont4trenircoo1fptraivs;s  exo(o oo1al elfesa(fa2umur ;u4oexoioeildfm2rmuvsnu)trtrif3oydfpt auvs ( srxoxmpiy1alt lnetl(fsDurump;o0olx ioetysfaDulnvp;(4aeeoxf3io1om elivi;(0trtrio3ou1lmtnlfvi t a2taxmo;o1opxnioetasfmDrl(vpnu4trenxf iadfp eli ol(  exo(m oudamt lictl()sDtaxrpnt4aetn octlsfs2rm( snu4aexrif oo1lm  lueo;(0 rtmxrpoy4oltemiciat sDtru p;u0apxoio3iyd a2eanvpn(0 exrxfctadlmt luvi t) eumxo no1oltemfvil() Dumxr ou1aexnmieiatla2ulnmp t)aexnxr oodoa  aieo;s)tetrio nu4lpeemivtls a2tax p;o4tleomictydfm2ulnmo;()aleomf iadfp rliei;( srurxopno4ol n fetas) 2tmu o;t0tet ioeiadla2ua(vp ()trtoio oa1lpD aueil(0 euo(m3oydop e icsat)srrm(mo;o4altoii3tld s2eanvpn() rxnmf3iadlate ivi t t2tm(r3oodomenlicsl(fs2rrxm ;o4tleoifctlsfaDea( o u4altnxo3oo1op   ieils)trtr(o oy4lmt mics t  2tr(rpou0oeen iciydfaDrauvs;t) rxnxrctotfmDean o s)teum(m iu4lm nmnvsas) rraur ou4opxnmfeiyt a2rmnmont) renif3oatfm elu s;(0trtr(rpoudomtnmnci ( a2uaxrpno0tpx  oetydfs2ua( onu0aeenmf tydlmDeluei;t)s2xm(mpno4ame mnesl()s2rauro;t4alen fetadlm em( snt4 ltoir3ootfa elieolt s2urxopou4alenmivslt aDrm(m ;o1oex  ieiatlmDeauvo;u)trxnxr iadfmt lieils0t2xoimpiodolte ivtat)aDurum no1texnmfcils s2uanmp;u0tltnifciy1opDr nvo;s)t2tmxr nydapt mneilt s2tr(mo;t0ale  oetadlaDum(vpn()aeenmr3oodfmt lnesl( t2xrio3no4amt  ieilsf 2tm(mp;t4opto f3iad a umumpn(4 rtnmrctotfa rauvs t0trumxm3iu4oltemfcta(faDtau pnt1tpen oeildla2ra(vonu0 etrir3ia1faD liesls0trxrxo ou1aptn fcilsfarrm( o;t4olxnmi3iyslm2el( p;t0aetnmrcoa1op elieo s s2uo(opny4lm nlictl() rtr(mp;u1oee io3tas sDean o u4treomo3iodlaDran o;( s2tmxr nudlpe lnctls)s2raxm ;t1alxomoetas aDra(vo;u0tlxoirciadomt  ivols0 2xo(m iodalte fvs () rtaxrpou4tleniictld aDuauvp;u)altnmociy1faDr uvs;t0sexmxmpno1llee fcs t  Duaxmp;o4olx iociltls el( o;(4aexnxf oadfpDranvils0 rtmxo nudlpt lnet () 2rm(m ;t0oee iociasfsDumumsnu) ltnxr3oa1fmte uvs ()s2xriopiy4lleemivs ()s2tm( ooo1opxomietld mDrau snt0trtrxr3ty1laDe nvi;t0t2xmxo3oy1lm nmiei s) 2rmxmpnt0opeoio3iyslm um(vsn(0teenxf iatfm rli s;()seur(r nu1lpeelfei sfs2ur(roou1texo o3iysla2ranvo (0alxrmo iotlaDelivi;t)trtmir oy4olt  nvias aDtmumooo1tetnmociatls2rmu p () rxnio iytom rlnes t0t2umxopny4am  mfcia() 2tax  oo0teen fctyt aDrmuvp;u)tleoxo3ty1oa r ivo t)trxo(mpnu4lmt lics sf Dtaxroou4opx  ietys m rlu snu) exrmrctytop e u o (0trxoxopiudop n fvi t)srumum ot4oetnif3ilslmDulu p t4tleoirctadoaDe ueo s) rxrio3iu4lmt mics s  Durur no4tex  oetadfa2rlumsnt)trtnmocoo1op  aivilt) etrxrpno4om n ieias)a2tmxmono4tlto i3iatla2ulnmpnt4aleoxr iy1oa   neslt sruoim ou1ome lfvs ( s2raur ou4apxn f3tyd aDua( snu)aleomfcto1fmDrau i;s)s2tr(m ny4am nmnesl( arur(r no1opxnmf3tat m eaums t)tetrxo todla r ies t  rxrim no4lptn nes s) rtrurpnu1oetoif3tldla umumonu4 ltrmrctytoat luvilt)sruoiopoy4lptn neiasfa2ua(m ou0tpt iictadfsDuanmon() rermf3oa1om rau ilt)tetm(opny1al e nvtl(fsDra( p;t0alenmoetlt s2ranvsn(0 lenircio1lp  auvol(0 etoxo oo1lmee icsltfaDtrum no1oeeo o3iatlmDran o;t) etnmrctadfp rln s (  rtmxr3nydlleemfvsas  Dta(m nu0olxnmi3iysfa uaump (4tltnmrctydoaD au sl(0t2um(o io1opt  ivta( a2rr(ro;t0alx mfctasfm emu s t4alxnmrcoa1fmteaneo;t0 rxoim3no1ll elncs s artaxr ot4apx  ieilsls2rau s (4 leoxfcoy1laDelieilt s2xrio ou1omtnlivia(fa2ur(r nt4oetn ocias m um(von(0trtomo3iotop  an i;s seumirpou1lpt lnei sfaDurxront0tex iieilsfm2eanmp (0aetomo oydop elivilt0s2xrxrpoydllt lnesas sruaump;o0oltoifciyt s ulnmp u4 renir oodopt  ieo (0tetr(m3oodlm   nci t) Dtm(mpnt4ale ii3iytlsDem(ms t0areoxr tadfp   nvo;t texrxm nu4opt mfesa()aDum(rp;t0tlxn ieiltfa2emn p u4 ltnxf3io1lat  ueo s0srumir nu4altnlfcilsf Drrur ;u1ale mo3tydls2um( p u4aetomfcta1fpD aueo t0texoxr iu1opt lnvt t)artm(m nu4tetnmf3ild s ua( p;u4texniocia1fm rlivi ( t2umim iy4ap emnct t sDtaxm ;o0apto ociadlm2el( o u0alxrmr3ia1lm e uvols)tetrxmpou4om nlfct s aDururpou1tlxn icilt s ul(vp t0 eerxo3iatfp  aneo;(  rtrir3oy1op e nvil(f 2um(r nu4tle mo3iydls um(vpnt0 exnxrciydlp r nesl( t2uo(r nodol elivtas) rrmxmp;t4tle iictyt mDuanvp;(0 exoxf iy1fmDrluvi t) 2umio no4lp  lfci tfartr( pnu4tlto fciyd a ua(vo u4trtrmo ootop eln o;s0seuo(m3no4am  lnvi (  Dua( pou1tetnmfeiytlsDumu o;u4altnxfciy1omtrau o;t t2tr(r3iydom emnesat) Dumx pou1apto f3iydfa2ea( s (0areoxr iadfmD  ues;s  rtoxopiy1lptnliviat) 2tm( poo1tpx moeiytfa ra( snt) lxrmo3ootopt au i;t teur(m3iy1lm emici s  Dtrxmpnt1ope ifciys s rlnms ()artrxf3iodlatr ues;s0 2urxopou1lm e nvia( srur( ont4oexnmo3tlsla2emumo;t)treomfcoytop eau i;s0 euo(rpio4ole lfcta() rraump;u4tpx mfcildlm rmnvo t)tlxrmfcto1lateluvs;s teuoio3oy4ame  fvil(f rtm(roou0olenioetadla umu snt0artoir3iadfpte uvils)t2urxo oydlmeemncslt)a2tmxrono0tlt if3tas aDulnvont0arxnmfcoadfa  lu o (0srxr(o oo1al n nesl(fsrtaxmono0aptnmfctyt m2em( p;() ltoxr oydla  auvo t0 exrxr3oy4omt mfes t)s2raxmpoo0alt io3iysfaDem( pn(4texrmr iy1fatelnes;() etmirpoudaptnlfci tfs2tau ono1texn ictat sDrm(vs;t4trerxo todlptelivilt srurim3ny1lmt mfcsl() Drax pno0apeo feilsfaDumu o ()tlxrmr3tytlpDe u o;s) etmxm3nu1amtnlfvsls)sDtax ooo1aeeniicilt m2um(mp () rxoxrctatfa r u i t0 2xr(r iydoltnlnvta() Dumxmo;t0apeo fcildlm rlumsnu4aexnmr3iytfmteanei;()trxm(m3iydopeelnci (fsrrm(rp;o0tpxnifetad mDulumsnu0trxnxrciytomteaneol(0 2uoxm iu1lp emnei tfs2ta(r ot4olenio3iyslmDrmn o;t4alenmrcoodlp e ueo (  2trxo ny4ol e fei s)a2umurono0tpxomi3ilsfm2emnvs u0tetnxo3oa1faD  nei s s2to(o3iodaptelfeiasfsDua( ono0ole ioetysla elnmo t4artrio3oadopt  nes;s) rtmxm3oo4llt lieiatfaDuax ooo4aetn o3ildlm ua(vpn(0 eermfcty1faD li ol(0tetrxo iu1aptemnes ()aDtmurpot4optniieiadfaDumuvo ()tlenxr oadoptr ivsls t2uoirpiy4amtemieilt s2urx  nt4opto fciyt a emu s t4altoxr to1fm e uvols)srtoxr3oydlmt  iei t aDtmxr ;u0apto fciys m2ul( s;u0 etoxrcty1fp e nvolt0trxmxm oydolt mivsas aDrmx pnt1teenmieildfm2umnvon(4 eeoio oy1fmD lies t s2uoxmpou1op elfetas arumum ot4tleoioeiadlm rl(mp;t0aeerxrcia1omtean i;t t2uoxmpnudale mnesl(f Drm(  ot0apeoiiciyslaDumnvont) lxnxrciodla rai slt t2to(mpnu4ol emiciatfaDuax pot1alx moctys sDemu o (4trxrircoy1lat  neolt sexmxo nu4lmenlicias)sDra(mooo4tleomo3ilt aDelu o;(0tlxnmfcto1fpD lnvo (0 2tm(opny4amenmicsls)s2rrur ;t1tptoioeiys s elnms;t) lerxrciatfat lneols0trxmim3iydlp  lfes t)sDum(ro;u0tle mf3ias m2umnms u4 etrif oadfa   ueslt) eum(m iu4ope lncil( a2tau pnu0texnmieias sDulu pnu0aetnirctodomt lu s;s)trto(m ou1al   fesas sDraum ot1olx moctltfs ulu o t0arxnif ia1oat  ues s sexo(o iu1lltn ivtasfartmx p;u4apt mieils a emn on(4arxnxfciytfpDrli s;t) eto(rpoy4apeemncs t arua(m nt0alenmoetatlmDeln on() lxrmr3oodoatrln s t0t2umxopnydap e icsls)arrrxmoou4alxn iciyd sDumuvp u0aexrif3totfm rlnvo (0srtmxm iydal e iesatf Drrx pou4apen ietadfa eanmonu)tlerxo to1fmD ai o;s) rxm(o3oudop elietas)srraum ;t4oet mfeiatla ulu p;(4altomo3ootoatraneo;()t2xoxr iu4om elncsas sDrrxrp;u0oltoifeiadfsDea( o;t) exomfctodlatelu o;(0 rumxrpnu4lmenliesa()s2rrx  oo0tpxn oeiydla rmnmsn(0 rxoio ta1oa elu o s  rxm(o3iodom  mfes s)a2uaxmp;t1apx  ociytfa ua(mon()altrxf3oytfa  aieilt)sruoimpiu1om  livi ( arraurpnu0apt io3ildfaDemuvp;()tltnmr todoa elivols0setm(m oy1op nlivilt  2uaum ;u0alxoifeiadlmDelnvont0arerxo3iotlmDr ues t0 rtmio oo4am n ieil() rurxr nu4opt mieiyslmDrluvo u0altnmf oydopD anvslt) eur(o io4omtelivtls)aDtruro;o1openmo3ilt a2el(vs t0alenircoodopte u ilt0t2trir3iy1lm emfvilsfs2uau pnu0apenif3iysla eaumo t0aeeoxr oo1oaDeln s s setrio3iu1oltn nvt tf rtmurpou1oet  ieildls2ea(vp;u4artoxo3totoa rli o t0tetrxr3nydapte icsatf rraumpnu4apxnmoeiydlm rlnvs (4trermr todfatr nei;t truoxr iudopte nesa(f rumu  nu0tlx mo3ilsfsDrl(mpnt4arenmo iodopDraiei;t texmxr3nydap nlfct (fs2rmu  nt1optnmieiytls2uln sn()alxoxocootoaD aues t sexriopny1lm n neslsf Duax pou0alxoifciasfmDrmnvo;(0altnxr3tatom e nvs;(0s2urir3io4openlicilt) ruaxm nt1altnmf3iadla2rlnmon(4tetoxr3iodoat li o t) rur(r3no1ll elfes ()aDraumoot0opx iociydlm2um(mp;t4artnif3ia1lmtrlivolt)t2toxopoo1optn fvtlt)srra(  ;u0tpxoiictltfsDrmuvpnu0tltoif3tadfatrlnes ()setrxo3iy1lm n fes t) rtmurp;o4oexn iciys a rlnmo;u) renmo oadomDraieo t0 exm(r3oudll n fcilt  Durxmp;o0tpx mfctytfm2rl(ms t)tltnifcoy1fpDrlies ()sruoxm3oodlltn icsas)a2uru ont1opt  fcilsfmDrlump;t4tltoxo to1lm ran o;t0s2uoxo3nu1oltnlivi tfartr(  ;u0aptnifetld aDuau pn()tlxnmr3todlpDeaivo t) euoxmpiudoltnmfvt (  Duax  ot1oetn f3ils a rlums;(0teermf ty1fpt lneils s2xm(rpoy4omeelfvilt)aruaumpot0aee  iciyslaDemn p u)artrir iodlaDelu slt)teuoim3ou4oleelncsatf 2rm( pno1olxoifciasfm2rln snu0tlxnmr iydlm eauvs s teuo(mpou4am n iciltfsDrr(ro;t1teeoiieiyt s2emn onu)alxrir iatlm r i s;t0 rtrxr3iydam e nes t) Dtrxm ou1oexomoeiad s eanvs;()tlxrxrcio1latr i ol(0 rxoxo3iu4ap emfvsas  rrru pnt4aptoifetltla elump t0trxomrctotfpD anvils)s2tr(m3no1alen ieiatfsrrau  no1optnmo3tyt s rmnvpnt4tetnxf3tatfmtr u slt0teto(r3io1oltelfeiatf 2tmxmpnt4oexoio3tatlaDrl(vs t4trtoifctodopD  u ilt trtr(o3no4aleelncsa( s2rmx oot0alxn oetatlm2el( p u4texrmf oatom r ivo s  ruo(o iu1optemncsl(  Dururoou1oet  feiytlmDrmnmpn(4 leoxociydfpt  ueol( seumimpoodam n fet s artax  no1oetnmo3tatlmDrm( pnu0tlxnmr3tydfmtranvi ( t2uo(mpny1lmt mncslsfaDtaxmpnt4alt moctat s uau p;u4alenirctotfpDr u ilt srxrxo oy1llt licsas) 2taumpot1apen i3iasfsDumn snu4trenxo ty1fa rlu i;()s2tmiopnodolt lneias)srrrxm ot0aet mi3iydls um(vsn()tlxnir3tadomte i il( srumxmpiydap   ivtatf Drrxm nu4tpxoii3tldfs rln o;u)altomf ta1fa  auesl()s2toirpoo4opeemici (faDur(mpou4oeen fctltfsDrl(vpnu4trxrxf3tytopDrli olt)t2toxm ny1altemncta( sDta(r ot4aetn i3iydls eln sn()tetnmf3iydom rlivi;(0t2toio3iy4apenlies t a2tm(ro;t0apen fctyt mDemnvpn(4aeenxfcoadlaDeau o;s0 exo(m3iy1lpee fcsas) rua(rpnu4tlt mociaslsDulnvo t)tlxrxf ta1latr n o;t)setoxm3nodoleelfci sfsDua(ro;u0apeomo3iasfmDuan s;u4trxomr todoate ivi;t)seuoxo3io4lmt  icils  Drr( poo4openmf3ilt a2elu p;(4 rxnmocoatop eau ol()texo(m3ny4lltemivtlsf 2umum oo0apxoii3iydlm emnmo;u)areoir todoaDr n s;s)srxoim io4amee ivs t) rtrx o;t4aeto iciltlmDemnvs t)tltoifcoo1oa   u o s)seuoir iydalen netat  rtaxmpnu4tpeo ieiltlsDra(vont) rxrifcta1fateln ils) rxm(r iu4ame  fetls)srumur oo1teenmociat sDraumsn()aetoio3tatfate ueil(0srtmxopoy1ame miciasfa2um(rp;u4tlx mf3tyslaDemn o t0 lxoir ia1fatrlneo;( s2tm(m3oydlp e feias) rtm(mo;t4tlxoioctas s2ea(mp t) eermr3tytomDrlnei (0t2uoxm3oydlpenlnes ( arumurpno0ape mocild a elnvo;t)texnxf3tadop   u s;s)srurxo iudlmen fcs (f Drau pno4tpenmoctys s elumsn(4 exomf tytlpte neols)teuoirpoo4lpenlivi s)aDrm(m ;t1opx ii3tldlmDumump;(4arxnmr oatlm   neo;(0t2xm(o3ny1lmt lici s)artmxmooo1olxoio3iys m2rmn o;u0trtnxoctytom r i ils)texrim io1apeemfvs t) rrrx p;o1oexnmoeild a uanmsnu4tetoxf3oo1op e iei (  exoxo ny1olenmfcsas)srumx  nu1opx iieils m rl(mont4 eenmf oy1lp  lu slt0 rum(r3no1am  mnviat)arurxr ;o4opto i3iytfa2ul( p t4aexnir to1om r ieils0t2umio3iy1ol n fcils) 2raum nt0tpxn f3iat a2em( o;u0 rerxf iytlmDe neslt0 etoxopou4ol e ivi tfartrurono0tpenif3iasls emu p;() exnifciy1omD lnvi;(0 2toio3oudol   fvtat)s2urxmonu0tleoiieiysls2uanvs;t0arxnxo tatfa e iei (  2to(m ny1lpt  feiat) Drrxm ot4tpx ifciltfmDelu o;u0aeerxo3oo1op rlieo;s) euo(mpnu1alt  ivtasf 2umxmpoo4tlxnmieiyd mDemuvsnu4trtnifcoatfmDrlneo;( srxmxo iy4amtnlfvi s)arrauro;t0oetoifctltlaDean o;u0 eenifcty1lmt  ivols)s2um(opnydlpee ict tfartrum ;t1olx  iciyd m2ul( s u) ltrmo3iy1oaDr ivs;t s2to(r no4amtemnvsltf rraumo;u1tptomo3iydfsDrmnvpnt0trerifctatlat au slt t2tmxopou4ope micils  2rrumo;t0oltoif3tys m ul(ms;u0 rxrmr3tydomDraieo () rxoxrpnu4apt mfeta( sDtaxmo;o1openmoeils mDeau o;u) ltrif oatoate ueo ( seuo(o3nudapt lfcilsfs2uax ono0opx mi3tysla2eluvo;(0trxrmf3oa1lp rlnvi;()sexrim3ny4ameemfvia()aDta( p;u4optn o3tysfs umnvon(0altoiocio1lp eai i;s0srxrxrpoo4lmeelict ( a2rmumoou0teenmiciadfm raums;u4altnirctytlate i o;t  rtoxo3iu4om emicsls)a2ra(m nu4apxomo3ilsfaDua(vo;t0 rtoxr tatopD au i t  exoxr3oo1ome  feilt)aDtrxrpou4aeeomo3tls a rl(vo (4 exoio todlateli il()s2umxo ou1aptemivias)s2tm(r ou0aexnmo3ias a ua( p;t0aexomf oytlaD luvs t0seur(m iudlme lncs ()sruaxm ot4tet  fctydfm2el( s;t4areoir ia1fmD  n i t0 rxmir nu1lpen ivt s) 2rmxm ou1tptomfciytfa2rmumo t4texnmf3ootom   uvs;()srto(m3oodale  icsas)aDtaur ou1olxoifetltla2uln s;t) rxrxfctytfmtr uei t) 2tmxm3ou1ope  nct t)aDraxmoou1olxoiiciadfm2eaumpnu4tltoxr iadlat ln ils  2ur(r3io4apee ivt (  2rrxrpot1alxo fciytla ea(mp ()texoio3oatfm r ues s  rtr(o3ou1lptnmiciat)s2ta(  ;o4aee if3iat aDelumo;() rtoxo3ta1lmt livsl(0seum(m3nu4omee fesl(f Dumur ;o1tlxomieiydlsDeanvpnu4 lxnmf3ootfatr nvo ()t2urxr iodlptnlfes t) rraxr nt0oetomi3iadfm rmnvo;u0texnirctadfat aueo t t2xrir3iy1lle  fvta( srtaur ou0tlx  i3iltlm ul(vsnu0tlerxr3todlpDe i ols0t2xmxm iudalt  fctl(f 2rmum ot0aexoiieildlaDeau onu) rxrmf3iydlmt aieo (0s2uo(r3oo1lm   ivi s) 2tm(rooo1oexn ieilsfsDrmnvo u0 leomfctadomt aivolt0 exo(rpiu1lpt mnvi (  Dta( poo1alenifeiytfsDel(mo;(0trtnmrciytfmD anvsl(0s2um(r3nydlpenlnvta()s2taumooo4aexomfetadlm em(ms (4arerio3totfmD  n o;t trtoiopoo4llt  fei t)arur(r ou0aetnmieiyslm2ua(vs u) etoxo ty1fmt ln i ( seuoiopno4am elicsls)a2tauro;o1tee mocils mDrmnmp u)aeerio tydfat li o t0t2tm(o3nydale mivilt srtr(m ;t1olxoif3iytla rau on(0aexnio3oy1oatranvs t) etoxm3oy1apee neta(fsDtm( oot0tptnio3iys aDrm(vsn(0alxnio oytlmD livo (0srxrxm no1lpte icsl()srurx  oo4aetniieildfs rauvsnu)tltrxrcootfm  lnvsl(0 2trxr oy4lmeelivia(farua( ooo0aexoifctyd s emnvo u0artomrctatop elnvs s  eurxr3ny4ll nmnesl( a2tr(  ot4oex  fcils s2ulnmo;(4alenmf io1opte neo t0t2tmxmpiydalt mnctl(fsrua( oou1alx  f3iydfa elu ont0aeermr3iadfaDe i sl()srur(m no4amtemfei tf Dum(roou0tlxomoctadla2rmn p;t) ltrmo tydop e nei t)setr(opiy1optnmfvs tfsDua(r ot1tle mf3tytls2em( s;(0teenxo ty1fm ran o s  exmxm nu1lm nmfvtatfaDtm(m ;t1tpen ietlsfs rmnvp;u4altnmr3ia1lateluvi s) 2urir3iodap  livsas  rtmx o;o4opxoifetaslmDemuvpnu4 lenmf3io1lmtelueo (0 2xoir oy4altemfviat  2tmur ou1opxoiieilsfm2ranmsnu4alxrxo3tadlpDr nes;t0 2uo(r3no1apteliciat srtr( pnt4oexo ieiys s2umuvp;t0 exnmr3to1lmtean slt tetm(rpiu1openlneia()s2tm( pnt4tptnmfeiytfa rmn pn(0trtnif iatfaDr n ilt) exm(rpnu1ol   nei sf Duaxmpou4oexn o3tad sDuanmsnt4aexrmr iytopDrlnes ( trxrim3ou1ape  ictl() Dtaxmo;t4oee mfciysfaDea( o t0aexnmocoy1lp eanvs;t0t2umimpoy4om e ies sfaDua(monu1tee miciad a2ua( p t0arxoxo todoa  ai s;s0t2toxrpno4ap nmncs s  rrrx o;u0oexnmoctytfaDrlnvp;t0tlerxf tytfa ran i;(  2xoim3io1lp emnci t  Dtrur ot4aetn oeiyt mDuanmo u0 lxnifcta1oa  luvsl(0t2um(o3nudome mfcias)s2ua( ono1olxniociydls rln p t4texoxo iy1fpDe uei ( seur(r3nudaleemiet tfarta(  ;u4ope mf3ilsfa ulums;(0 eenif todop  au o s0 2ur(rpoodolenliesa(  2tmu o;t0oeto oeiltfaDeln s;t4 ltnxf3oa1oaD li s s) etoiopnudom elictlsfa2urumpnt4texn feiltlm2rauvpnt0aeeomf iadfpDrlu ols  exrxrpou4ape  neiatf Dumxmpoo1tex mfciyt mDra( onu0 rxomr oy1fa  lu o;t0 rtr(r3oy4altemicsat) Dumxrono4tpxoiociasfs ean onu4trermr iadomD au i t texo(rpnu1lme  nvtasfa2raum no0openii3iysfm2umu p (0aexrxfciadop rln o;s  rur(o oy1lpee fvi t)s2tru pou0apx  icilt a2ul(ms u0trtoxrciy1fp   ieils0s2xoxr oo4omeelfvi t  Drmumpno0tlxnmociltlaDrm(mp u)aetnxo3ta1la elu s;( seumiopiy1am   ivtl(  2taum no4apx iocilsfs2rlu ont4arerir iodfmD ln i;(  2trxo oydllenmiesat aDtaxmpou0ope moeilslaDel(vp;u4trxnxr3tadlmteli o;( s2uoxr no1altn nei s sDua( ono0aexniieiytfaDelnmp;(0texnxoctatoa rlnei;(0srxoxr3iy1llt mfesas  Dumx o;u1aeeoiieiydfs umnmo;t4 exnirciy1optr uvo s0trur(opiy1lm   nvi sf 2rm(  nu0aleo f3iltls eau o u0altnmf tadlateanvo t trxrir3no4apt mivtas)srrr(mooo1oexoio3iytfs ranvont0tltrxf3io1opDeaieo;s0 exrir oo1lmeemfci s arua(mo;t0texoiiciatls uauvs t)trenxoctytla rauvo;t) etrirpiudom  mieiltfsDrr( ooo1tlxnmociyslaDum(vp;u0 etnxr oytop rai ilt) 2to(r nu1alt lfci () Dtmu pot1oetn ocild a uanvo u0 rxnmr iatfate ieol(0tetrir ou1olee nvsa( s2um(rpou0apx  o3iysfsDumuvo;u4trtniocoodfmD lueo t) 2uo(r3oudopee ivi s)s2urur no4ope iociydfa2em(vo (4tltoxr3tytoat lieo;t trxmir3ou1ope liviatfaDuaxr ;t1ole mo3ildfa2eln o;u0altoifcoadfpteaueolt0s2xrio nu1lmt mici (  Dua(r oo1teenio3tat s2uaumo u) renxr3iytlmtelivi;s0setm(r oudopt mies ( aruaxrpnt1oet ioeiltfaDea(ms () exomf iy1latraiesl()trtmxm nudam   fcilt a2rr(  oo4aee mo3iytlmDeaums;(0trtoif tytomDelivols  2ur(m3ny4olte nctls)a2truro;t1tpto fciltlm2eanmsnu) exomr oatopDraivo t0t2xrir ny1optn fvt sf Dtaxmo;u1aee  ieiadlm2uau o;u0trtrxo iytlpD  neo;s0srtr(o oo4om n fvt sf rtr(mpot1tpxniictatlm2el( p (4 ltnio3iatoa   nvi;( t2umxo3iy4ol e ivtas)a2trxmonu0aleo f3tad s2emums;(0 exnmr3oo1omtrli olt) 2umiopnodlmtelfvslt  rum(moou4apenioctytls2elumsnt4trenxr3tytlmD  nvolt  eurim3oo4lle lfcilt aDrr(rpot4oex iociyd s2elums t4treoir ta1oa  anvo t  etrimpoo1olteliesl( arrau  ;u1apxo i3iydla eau o;t4 rtoirctadoptr i i s0 ruo(r3ny1om emivsas  rurxrpot4ape mo3tytfs rlnmsn()texrxo totomDeli i ()seuo(o iy1lltnmiviasfsrtrxrpou4oltn ictysla2rauvo;(4alenxr3todomDr n ilt)seur(rpiydamtnlnet tf rumxro;o4alen ietydfsDel(vsnt0 eerxfctydlpD  nvolt srumxr iu4lpeemnvtl()a2rax  ;t0alx iiciad s2rlnms u) rxrio oa1fm r ieo (0seumxo3ou1omt  fet tfa2tm(r ;o4apeoiiciadlmDeaumo;u0 exrmr3ty1opt  nes s)srumiopiydopenmnet s  rtaur no1oleniietldla umnvsnu0alenio oa1lp  liei t)tetrio ou1opte fvs ( arta(rp;t0oleniieiydfm umu p;(0texnirciodom raieo s s2urxopnydlpe  nvs sf Dum( poo0tlxnmfciyd mDeln snt0tlxnxrctotoatrauei;t)t2tmio nu4omenmfeilsf Duax poo4opxnifctadls2ul( s u4aexrmocoa1faDr i i (0t2tmxmpnu4apte neiasfa2tmum oo1optomicilslaDrm(monu)arxnif iydfaDranvi;s0t2trim3ny1altnlfeil() rumu  no1ale mieildla ra(mo t4aexrxocoo1fmtrln o s) rtmxo3iy1optelneiatf rtax  nt1tlt  o3iysfm em( pnu)alxnmf oo1fmDeaivol( s2tmxo3ny1amtnmfetat)s2rm(rpnu1opto o3iytfs2ul(vp;(4tlxoircoy1opte ueols setrxo3no1omt  ivs sfsDraumonu1tpeomi3tyt aDrm(mo;t0trerxf iodop eauvolt0trtmirpiu1amt miciat aDraum ;o0tex mfeiatla ul( p (0aleoiocta1lat li s s)s2tmxopoo4lp emfctasfs2umxrp;u1alxoiicils a2uln o (0 lenmociadopt anei t t2xoiopou1am emnci sf 2ur(ront1alxn o3iadla2ea(vpnt0texrxf3oodoat  nvil(  rtrxopiy4ll elnvs t a2rr(  ot4ope miciat s uanmp t0tlxoiocio1lpDe n o;() eum(r3io4ole lnvs s  rtmur ou1apeo ictls a2eanmo t)aetrircio1omt livi;()trtr(o iu4apte iesls)a2tmu pnt1apx micild a2um(ms () eenxo totlaD lnvi t trumxr3oudlpen iei (fs2rr(m oo4aet moctyt aDuanvo;u)aleoir oydoa elivs (0seumxrpiodap n fvt (  rtmumonu1tpt mo3iltfmDuluvpn() ltoxf iydfmtr u s ( srtrxm oo1aptemfct t)srrmxmp;u1tlto ieiatfa rl(ms t0trerxfcoytfpD  ivolt  rumxm3no4lptemneiatfarrmurp;o4tpx  oeiltfa2rmump u0tlenmfctadom eli ils)srxm(r nodllee fcias)srtax  ot4aeto oeiltfsDrm( ont)alenifcia1fm rlneslt truoiopiu1op elivi s  2urxm ;o1tex  oetltlmDra( p;(0trenxo3iatla rlu olt trto(r3oydlpt lfctasf Drrxr nu4oeto fcilsfsDrmn s;u0tltoir3oadfa rauei;s) rxr(r iy4ol   ietlsf 2taxrp;t1oeeomfetat m rmuvp u0trxnir tydfm raneolt)seumxm3oo4ope lfcslt  rrauro;o1opx  oeiatfaDua( on(4alxrif oodla  aies;( teur(mpoo1op  lneta() Dtmxr ou4tle  fciatfa uan sn()aexoxocoa1fa rlneilt0sexmxm oydam n fctltfaDtruroou1aptoiietys aDra(vs;t)arerxf oydlp rauvsl(0t2xm(m3no1ameemnesa()a2rrxmpou4alt ii3iydfm ul(mo u) rxrxociatfmtrlneo t0 exo(opio1op e ivia(f Dua( pou0tpxnmi3ilsfs rl( p t4tlermf3io1laD  i i (  etrim oudlmte ncta()aDumumont0apeniieiadfm2um(mp (0texnio iotlm  ai ols0 rtrio ou4op eliviat sDtrxmpno4aet iietas aDranvsnt4tetoif iadoa rlieils  etmxo ny1ome lnvilt) Dtax  ;t1aexnifeiatfaDrm( p (0treomocto1fp rlnvolt  2trio io4al emivil()sDrr(mo;u1aeeomfeiat m2umn snu4 lenmf iytoptelueo s srxoimpou1apee ieta() 2rm(mono0tee iocilt m ean s;(0 reomo3iotop elneol( t2toir3oydome  ietat)sDraxr nu1aet mociyslaDelnmo (0 lxnxr iodopDrlnesls) 2xm(o iodlleemnvtls)a2um(mono0aet  f3tytlm rl( o;t)aeenxo3iotfaDrlivi;s teumiopnydopenlnesls  2trurpnu0tpt  i3tas sDelumo;(0alermociydlatrlnei;() rurxm3iodomt  iesls a2rmx  ot0opxo i3tlsfmDumuvs;u0aeeoir io1fmDeai i t) 2umxmpio1alenmivil(f 2tmxm nu1oetoiocilslm2ea( p;(0 lermr3iadla   ieilt0 exm(r no4apt mict s) Dtmxrpnu1opxnmfeiltlaDumn snu0 etoiocoa1lpD  ies s) rurio no1am n nvi ( s2tm( p;t0teeniictlsfs2rl( snu4aeenifciadop r ieslt  ruoir oy1lpenmneta(fsDuaxm ot0tlx mociysla2eluvp t) reoircoy1lpteanvi;t0srxr(o io1apee nvsls aruau  nu0tltomieiytfm uauvp t4 exnxf ty1opteluvolt)tetm(r3iudom nlfvtas)sDuaumont1tlx mfeiysla2uluvpnt0trxrmfcto1lmtelnvi;t) rtoxm3ou1ll elivtas sDraxm no0tee  fciasls em(mo;u0tltnmrctydlpDrauei;( t2toir3iudap elfcslt) rta(  no4alt ioeiadlm2uau o (0tlxomr3ia1opt  iei;t s2tmir iudap  mivilsf Dtmum ;o1aexnioctys aDumnvs;u0tleoxr tytomtrauvi;t) exoio3oudlme  neil()a2uaxrpoo0tlxn o3iysfaDum( o;()arxriocootoptrlu o ( srxrim3no4al  lfct tfs2urum ;t1tetomo3iydla2rm( p u4arerxocoydoaD lnvo;(  2xrir3iu4ale mncta(f rrmxmpnt4texnioctatfa2emump u)areoxo3oadla raueo;(0 rxmxrpiu4olen nvt s) 2rrxmpnu4oetoiicilt m eln s;()trxoxocootlat  ueo s s2xr(m oo4alenmieia(  ruauroou0aexomfetysla2rau o;(4 eerio iodfpt anei s  rtmxmpny1lmte fvilt)aDur( p;t4oexoii3tltfa ulump t0artrxo ia1lmD li sls  etrirpnu1am emict t  rraxr nt0tleomicildls2ean pnt)aexnxo3iy1lp rauei;()texm(opny1alt  ivt sf Drrxmo;u4tet mi3iytls ua(msnt)altoxo iydfp ean o;( teumxopnu1lmenmfesa() 2taxmo;u0teto i3iasfsDem(ms;u4aexnmo oydlpDrlivs;s0teurio oy4aptn iciatfartax  nu4tpe iicias mDrmuvo;u4 rtrxrcoy1fptraivi;(0s2xoxm iudlmte fcs ( sDtrxm ;o1tlt iictytla2ea(vs u) eenio3tadoaDr neo ( trto(o ny1olt  nctasfs2rmxmo;o0aeen iciytfm2ulumpnu4tltnxf oatlpD luvo t0 exm(rpiy1om emfvi tfsDumxr ou4aetn i3tysfs2ra( s u0 etoxrciodfatraivsls0 rtoxm iu1opt  fvtl(  Dua(mpnu4tet moetlsls2emn o;u)trenmo to1laDr i i;s0 exoxr3nu1am   fct s)aDtmxm nt0ole  f3tyslm ean o u4 rtoif3ta1fpDeliei ()t2toim3iu1om e feilsfs2rrumono0opxnmoeiyt m2uan o;t4 etoifctodlpt aivils0seurxm iudlpe  fet t)a2tr( p;u1tpt mieiys m emn o t4artrxrcoy1fmtrlu ols0trxrir ou1apenmfciasfsDuau o;t0apeoiocildlmDulnvp t0 reomrciadlmDeliei;(0s2ur(m iu1ll  lfcs ()artaurp;u4opt ioeildlm ra(vpn(0arxrxrctodlmDe uei s0trtoio3iydomenlfciltfsrua(  oo1oeto iciadfm ulnvp t4trxrmrcto1la   n o s)setm(m oydap nmiviat  Dtm( o;t0open ociltfm eanmonu)tleoxr iotoat au s;() rtmim3oudap  livt tfsrtm(  ;u0oee moctls m2rluvo t4aetomo oo1oaDeluvo s) exo(rpnu4olenlfeta(fsDuru poo4ale  i3iad s ulnms;t)tlxrifcoa1lmteanes;s sexmio3ny4ameemiciatfartaxronu4oltoio3iytfs ulnvs (4texrmo3oa1lpDe ies;s sexr(o iu1omtnmncs ( s2ta( pot0open o3iatla el(mpnt) lxoxf iadfaDe nvolt0 2xrxopou1olte nvi s) rraxm nt0alx if3iad a2ra(ms u)artrxociytop eau s t) rtmirpnu4lp  lfct sfs2umxr nu4aptnmf3iydfsDeanmo (4 rerxf3tydopt lnvi t s2uoxo3iy4ome mfctltfarraur no0tpeoioeilslmDrlu pnt0aetomo3io1fpt  n ilt  rxriopoydomen fcsl( sruau oot0oetniietat mDrl(vs;()tetoir3io1fpt auvilt) etrio3iudal elfvi (fa2ua(r no4alt ii3iytlaDumnmo;u)tltomo ty1oatr ueolt0 rtrim nydlltemfci (fs2trxm ot1aptomfctls a2em(vs ()tlenmrciodopD au o;s0 rtrxo nu1optelnviat)a2truroot0olt ioeiysfm rln o;t)aexnir iadoatr ieols)teurim3ou4lltnlncs sf Drrxrono1openifetldla rlump;t0 ltrio oadoat lnvols trur(rpny4ll elfcsl(f rumxmpno1teeoiietat aDeau s u0alxrio3iy1fmD lu i ()t2tr(rpno1omeelfcs sfaDurxm oo1alxnioeiatfs ulu p;t0 lxomr tydfaD  ies s)tetmxr iodal  mfct t  Dumurpno4alt mociydlsDemnvs (0aetoxrcoo1fptr u o;t0 2xo(rpio4apt livt sfs2uaumonu0tpe mi3iys a eluvo (0 etrmo3iadom  ai olt)setrxr oo4om e feilsf Dumu  ;o1aptn o3tatlsDelums;u0aeeoxr iatlmDeaies t) 2tm(m ny1al n fet s srua(rp;u0alxomf3ils a2emn p (0 exoiocoydlpD  n o s) 2xoio3ou4ame lfvi ()arrrurpno4tpx  i3ilsla2em( o;t)tlermocoytlmtr i o s0teto(r iu1ol e fvs s) 2rrum ;o4tex  iciyd s2eauvsnu)tlxnxr tatlatr neil(0 exoio3oo1olen feilsf rtmx o;u1aetoioeilt aDrl(vsnu4arermociadoa r uvil(0texmir3nodllt lnciasf 2ra(r ;u0apxnmi3iysfs ranmpn(0 rermf tatlmtrlu il(0 eurimpiydaptnmfvtl(fa2tax  ou0ale mi3tlt a2rmums u4tlerxrcto1omteli s s)s2xr(opno1lle mfcsas artm(r nu4tetn oetysfaDrmn p;t4tltrifcoo1faDe ivo;s) rtr(rpiydlmeemfcias) rraumo;t0oetnii3iydfsDeanvsnu)alxrmo3oo1oatr i slt texm(r no1ome lies s)s2umx pot4oee mi3tys m elu onu4texrxf oatoatrlivsls) 2tm(r3iu4ap emivta( arrrxrooo1aexnio3iat a2rlnms t4aetnxf3oytlpDrlu ilt)seuoxm3nydllte fei s)sDrmxmono0alxoifciytfm2rln pnu4texnmf3tydlm  lneols)sexrxr3iodoptelnci s sDraur nt4aee  i3iatfm umnvs;t)aetoif3to1lm   nvs;t) euoio3nu4amee nes (  rrmu poo0oltniociysfs emuvp t4aeerxf iy1fmtean o;(0tetmxrpnu4ol e fcs t aDtrxr ;o0oetomfctadfs2rm( s;()trtoio iytoptelivi;(0srxoxr nu1aleelies tf 2tm(rooo1aleoifeild m2el(msnt)tltoif oytfptraneols  2uoxr oo1om  mici () Duru o;o4optomi3ildls2rm(vs t0 renxo to1fmD au s;t)t2uoimpoo1llt livi tf rur(m oo0tet  i3iadfaDem(mo;u0altomf iy1lm ran i;s)sruoim oydaptnmicsl() 2rr( oot0tpe  f3tlsfa rmums t4altrifcoytfm eauvo s s2xo(o3ny1omt  fvtat) rtrurp;u0tle  ieildfs uan sn()artrxrcto1om rauvo s)s2xo(m3iodal nlfei tfaDrru  nu4olenmf3iydls2ulump u4tlerxfcoo1opte uvi t srtm(r ou4amtelfei t)s2rmu oot4opto o3iltla2ua( p u)trtoxocta1lpD ai o ()seuo(rpoy4ll nlivtlt)arrmur nu1ope  f3ild a uaumonu)trtrif3ty1fmte nes s0sexo(rpiu1aptnlnvsatfaDtrum ot4tltnio3iys mDrmums u) lxomr oatfaDr n slt  exmim nodalee fctl()s2ra(mo;o4aeenmi3iys a2umuvs;u0tetomf3oatop rlu ils)srxr(m oudllt  fcslt) 2uaumpot1apxn ieiyt aDeauvs;(0aexrxo tatoaD luvol( s2xmim3oydlpe mivil(fsrrrxrpno0oet ifeiltla2uauvp u) etniociydfaDrlivo s seum(o3no4lptemnei sfs2rr(ro;u0opxoiocilsfa2emn sn()alxomocoo1lmD  ieilt) rtrxm oodoptn ncils)srumxrpot1opto oeias a el( p;u4 eenmf3iatfp   ivi (0srtrim no1ap   ivsat) 2uax ont1tpeoiictyd sDemnvpn()tetoxf totop e ieols sruoiopoudap e fctlt sDrm( o;u4optoioeiadfa2eln s (0 lerxf3iytlpt lneo;(0t2uo(r3iu1olt miciatf rtmxm ;o4tex iociydfmDrlums () etoir tydlm e uvilt0 euoxm io1lmenmnvsa( s2rmxr ;o4apeomfciytls2rm(vonu) reriocty1la  aieil(0 etr(m3nu1om   nvsat arumuroot4tpxoif3iydfm2umuvs;t0 renmo3iytomte uvsls trurirpiydlme mivt sfarrrxrooo1aeeoif3iatlmDuanmp;t0trtomf iadom eanes;s0 rtmxr iu4lpte icil()sDuru  ;u4tex io3ildls uanmo;t)aexomf iy1lp eluesl(0t2tmxrpoy4lp n iesat srurx p;t1oleoifetlt s ulumsnu) eerxr3oodfp   iei s  2xrirpnu4om   nvta( arrm( pot4ape iiciat s emnvont4 etnif oytopDelnvsl(0 rxoxo nu4ap   icsl(fartauroou4alt ifeiyslsDea(msnt4 rtnir3tydlat au s;s) ruoimpoy4op e fetls) 2ua(  nu4apx mf3ildlmDuaumo (4 exnxf io1lpDr ueo;s tetr(m no1lptnmieias) Dra(mono0tpx mocilsfa ua(vs;(0alenxfcootom eanvo;s)t2xrimpiu4omtnlnes (fsrrm(rp;u0ole  ieiydlm2ul(msnu4trtomf3oatoate ies t)s2toio oo4lmtelfviltfsDtmum ot0tle mi3iys sDumuvp;t)aetnxr oa1fmt lnes t0srtm(mpoy4aptnlietltf 2raxm nu1teeo feiltfs2ra(vp u)alxrxociytoa e nvi t setr(m iydap nmfciat sDrrxro;t4tltnmi3tysfs ran p (4tetoxr oadfpt aueils0trumirpnudomt  ieils srrr( oou4tltomfctatls2rlnvon(0 exnir3ta1lmt  u o;s  etmiopou1al elfctatfsDrruro;o1alt ii3ilslm2el(ms;t0tltnmo ia1lp e ieo ( srxmio3oo1oltemfesat  Duau p;u0olx ifcias s2rmu p (4 rerxr oo1laDraivs;(  eur(m3ny4openmfviat) rraxroot0aeto oeiysfs uauvo u0trtnif tydopDeluvilt)s2xrxopiydolee fctl() Drmur no4tpxomi3iyd a2rlu s u4 etnxrcoa1optraivs t0s2ur(m oy1al  mici t sDrax o;t4opx mi3iadfm2em(msn()aeeoircoo1lm e uei s  etoio iu1ol  lics t)s2rru  ;o1ape moetld s2rm( pnu4 leoxo io1fatrln s;s)teur(opno1lpee iei (farrmxm ;t0olt mfetytfa rm( p;u0 ltnxf tytopte ivi;()seuoimpnydalt mnetatf rtrurpnu1opxnmi3tld a2rmu s;u)aexrmo3iytom  aiesls0setmxmpiu1lmtnlneias aDra( o;o0tle moctasls2elnvp u) ltnmociodfpDeai i;t) ruo(m3iu4lmeemfet t)aDuau poo1apt mo3ildlm um(mo () lxoif3totfpDeaieo;s)srurxrpno1olt lfeslsfsrtr(  ou0tleoif3iadfa umu p u4tlxnif iadopteluvo;(0teuoir oy4ol nmivslt s2ur(ro;t1alxoifeilt sDranvp;u) ltrxf tatfaD lnvi ()srto(mpiydapt  fvsls)srrax pnu0tlx mfcils s rl(mp u4trxnirciy1fmD an slt)trtmiopoydll nlies ( a2umuront1alx mociys a2rlnvp ()trxoir3tydfpteaivo t t2um(o ou1alenmivt s)arta( ooo4aeto iciyd m rl(mp;t) lerxr totfm   nvol( tetrio nu1alee fciasfa2ua(r oo4alxoioctltla eln o t4alxrmociadopt aivs t tetoxo iu4altn nvi (f rrr( oot4alx mfeiyd a2rl(mo u)aeeoiocio1fptraivs s  2tmxm3ou1lm nmfvs ()a2tr( pno0optn o3iad m umnmsnu4 etoxfctodfa rlnvi;t)s2xrxm3iudlm n ivsl( arta(mp;t4olt iociytfa2umnvo;(0treriocoo1oaDraies;t) 2uo(m ou4lm nmfeslsfsrtaxr nu4opt ioctytfsDel(mp t4aeeomoctadla elivs;s)s2to(rpny4ap e ieia()a2taur nu0optnif3tasfmDumnvs;t0 reoxf iadomDelneilt)t2uo(mpoo1ome  ics sfsDtru  ;u4opt ioctatfa2ulu o;u)artnmf3iy1omD luei s)trxoxopiy1oltnmicsatfsrtruronu0aetnii3tlslm2el(vp () lxrio3iatfa r ivi;s  2urxmpio4al emnvi ()s2taxrono4tpxoifeiaslm rauvonu0areoio3tydfpDeluvs;(  rxm(opnydlltnlnvsa( srumxr ;t1apx  fciatlsDuanvo () lxrio3oa1lm e nesl(  exr(r3iy1lmtemnesat) Drm(m ;t0oetnio3iltla2ea(msnu4 lenmfcoatlpte nvo ()srxm(r3oo1opt mncs s a2rmxro;o0ape ii3iltfa uln o t)altoir3iytlmtr uvi s)truo(mpou4am emfctlt  Drmxmp;u1oltnmi3iydlsDua( pnt4tlenxr iotfpt lu ol()srxm(o3no4al nmnet sf rtrxrono1tpxn ieiasfa umn s t)texnmociy1latrlivilt0seuoirpoo4lleelfvtl()s2ra( onu1tpxo fcilsfs2ulnmon(4 rtnxf3iodomDraneils srto(rpny1amt mnvils s2ua( p;t0tptniieiatfa uln o ()trtnifciadfm eai ol(0tetrxm nu4ol  lics s)a2tmur oo0oetnmf3ilslm2ul(von(0tetrir3oytfp  auesl()s2xo(m3nydolt  netat srrmu oot4olxomoetydlm elumo u)trxrxocoadlpDe ieols0srtm(opoy1omtelict ()s2tax o;u4tlto fciatfmDrl(ms t0tlxoxf3oytlpDe nes s0texo(mpio4lmenlietl(fsDrmu p;u4alx mietls m ua( pn(0aexrmrcta1latrli ol()t2toiopiudalen ncil( s2taxmont0apto octadla rm( p u4 ltrxfciy1lateluvslt t2ur(mpny1optn fesat  rtrxm nu4tlxn ieiys a2umumonu0aetoxrciodoptraneo s  2xr(r io4lmtelnciasfs2ra(mo;t4alt if3iytfa2ranvp;t)alenio3tytoatrlu s;s trxr(o3oydale  iesas)s2tm(r ;t0alt  ietytlm umu snt) eermr ia1fmt au s;t  rxmxr iy1op n netas)srrmum oo4tltnifciytfa2ea(mo;t0alxrif3oatom  luvo s  eto(opnydam nmnvias)sDtrumo;o1apeo oeiysls2rlnmp t)aleoxo iy1oaD  neo;t sruo(o3iu1lp nlfvsls)a2rmuroot0aee moctadlsDrm(von(4 ltrxf ta1oat anvi () exmio iu4olt lnct tfa2tau  oo1aexoiiciltfaDel(mp;t4texrxf3oytfpDe u sl(0 etriopou1am nlfct ( artmumono0aeenmi3tlsfmDra( p;u)arermr3oa1lat ai ilt  exmirpio1lp nlnes t) Dumurpnt1ale iiciatla em(vs;(0aeenxo iadoateln s;t0s2umirpno1ol  mivt (fa2umur ot0aleniieiltfa2elu ont0texnxf tydlmDrau i t0 rtm(o3no4ol nlfct tf 2trx  nt1oexoioetytfm rl(mp ()trenmfcoodfa rauvilt texmiopiy4ll nlnviatfsrtrx p;t4tlxn oeiydlsDumump (0tlxrifctotfm  au ils0t2xmiopno4lltelfcs tfa2ua(mooo4altnifctatlm emums t) lermf iadfpt  i ils)t2toxm iy1ome  feslt)a2uaxr nu1apxnmi3tadfmDumumsnu4teerir3oo1lmt aiei s seumxm ou4lpte ncs s)s2rmxm ;t1altoifetytlm rau o u4 exoio3oodomtelnvilt0 2umxm3nodlle lncias aDurxm ;t4aetoio3tatfaDra(vs u4alerxr oodfa r n o;() etr(o3no1lpe lfcta(  rraurp;o1opxo feiyt s ul(msn()teeomf3iydlmDran o (0srumim3no1lptelnvt s)s2urum ;u4openmociyd m ra(msn(0aexoxr iodfpD aneslt0s2xr(mpiu4alee ivs tfa2ra( p;u0tptniieiltlm uauvs;(0arxrxr ty1fatelnesl(0texo(r oo4ll n ictl(  2raxrp;t4oltnifctaslm um( o u0 lerxf3iydlpt anvilt) exoxm iydllen ictl()aDtm( p;o4ale  o3ilsfs2ranmp;u4 lxrmf3iydop  livs;s0trxmxm3io1ol e fctlt aDtmu pou0alxomieils aDemnmpn(0 lxnxf oo1lat  ues;t teuoiopiu4llt lncias  2ta( o;o0tlxnio3ild aDraumsnu0 leniocoodfmtelnvolt) etmio iudolt  fvia()arum(r ou4apx io3ias s2ul(vo (4trxrifcoy1faD auvo;(  rxo(m ou1omt mnvsls)aDrrx p;u4teen ictas aDeln p (0 lenxocia1fpD anesls) 2trxr iu4lpe  ivs t a2rr(rpoo1ope iociyd sDulu p t0tltoxr3iydlaD livslt  eumimpoudllenmivilt a2tm(mo;o1oexo f3iydla2rl(vpnt4trxoxr3iytop rlivo () rxm(o3no1ome  neslsfsDur( o;o0opxoii3iyt sDrm( p () eenxf tadlat lneols0s2xoxr3oy1llenlivtls)arrrumpno4tptn ocias aDean s;t4aeerirctytopDe nei t trxr(mpnu1ll  mics t sDtaurpou4oet moeiaslaDem( p t4arxnmf3oytoateluvols  rumxo no4apen nei ()aDtmxmpou1olx ii3iatls2rau p;(4 lxomrcio1lpD lues;( teuoxr3oy1optelfct ()sDtrxroot1texomfcilt mDelu onu0aexrmr3iodop r i ils)srxr(rpou1omenmnvsls)aDrr(r ot4tex io3iatlsDum(vo;t) rtnif totlpD livi;t s2to(r3iodop  micias) 2ur( poo0olt  oetltlm2ua(vp (4aexoxociy1faDranvs;s)s2uo(m ny1al elivi (fsDuru pnt1aeenmo3tytlaDelumo;u0tetrir3iotoptr uvsls)t2xmir3iy4apenmietls) Drr(  nu0open fctytfs2ra( s () rerxo tytoa e u ol(  rxoir3oo1op   fcils srtm(  oo0opxnmo3tyt a uanms;(4tetnircoydom eanes (0 rtrir3iydap   ict s)arta(rpot0aexomiciatlm2ua( o;u4 ltomr oatopDe u s (0tetmxrpoodape mnvslt) Dtr(monu1alt if3tatlsDuanmsnu4 eenir oa1lp elu i;s) rurxr3no4am e fvtlsfarrmum no4oex ifctld sDuauvs u0tlermo oodoaDe ueslt sruoir oo4am e fesa(fsDuru  ou0alt  ictydlaDrl(vs t)arenxrciotomD lueols)srtoio3nudlltnlivtls a2umum no4olxn ociyslm2rm( s;(0arxoxr ta1fm rlieils  exriopnu4amenmictat  2trxr ;t4tpen oeiytla rmnvs;u)tetnmf iotfm rlieo s) exm(r3no1am  lfvslt) ruaumoot1opeomi3iasfmDel(mo;u4 lxriocia1oatrau o;(0sexrxopoodlm nlneil(  2rr(ro;t1oeenmi3tysla ul(von(0alenmf3tatoatelivi s0trur(o3io4alenlfei sfa2ua(mpnt0aptnioeildfs rau p;u0 etrio3iodopD liei ()setrxrpoudlle  nvtasfaDrr(rono0ale  i3tatfsDum( p (4treoiociytop   n i s sruo(o3oo1lltnmfvsl(f 2ra(mpnt1tltn octltla2ulu o (0aeeoircio1oatrluesl( texo(m3nydolee nes ()s2uaxrooo4apto icilsfm2el(mp t0 ltnmfcio1oat  u i s) 2xr(o3iy1ole  nesa(  2umxrp;o0altnifeiys m ulump (4 lxriocty1la elu s t  2xm(m3iy4al emivsa( a2ta(ro;u0tex  f3iys mDeanmo;u0texoif iotlpt  n s t0s2ur(o ny1om emicsl(faDrr(rpot0ale mo3iyt a eaump t4teerifctadlp e ivs ()teuoiopoo1lmtemfeslt)srraumonu0tlt mieiydfsDea( pn() rxrxo3iytomD aivi;s) eumxo ou1ap  lnetas sDrrxrpot4aleo oeiaslsDra(ms t4 eeoir3oodfate nei ( s2xrio3iy4aptemnciat arta( ono1tptn ietltfa em(msn(4tetnmf3totlptr n s;s0sexmxm3oodale mnet (fs2tmxmooo4oeeomf3iltlsDeau snt4treoif3to1la e n i;t s2uo(opny4omeemfviat s2ua( p;o0aetnifcilsls emn o;()arxnxr3oo1lat luvo;s s2tr(opoydlme mncia()sDtr(moou4tpx micildfa rl( s (4arenxrcta1opt li i ( s2tmxmpoudoltemiet s)srtaumo;u0oeenmieild mDrlnms;t0 rxoxo oy1fm r ivi s)teumiopiydamt  ivtls  2tmxmpou1teeo ieiat aDulnmpnu0 exoxf todlmD  nvsls0s2umio3no4aptnmivs tf Durumpoo4oex io3ildla2ul(mo u4teenmf3oydfpt livs;s s2xr(r iu4optemies (faDururo;o4oeeo i3tatla rlu o t4artrxrctotomDrau i;(0s2urio3io1oltelieil( s2urx ooo0opeomfctat m2eanvo t)arxnmr3oy1fm  ai s (  exmxm no1lltn nctl() rur(mooo4aexo f3iytfsDranvs;t4texomf3iotoatr nvs s)t2urir3nu1aleemfeias  Dtmxmp;t4tle moeiaslm2umnvsnu0alxrio3ia1fp eluei;s0s2xmir ou4olenlncias)s2tmx  nu1opx  feiltlsDelu snt) ltnmf ootoate i i;t)texmir3iu1aleemiei (fsDrmx  ;u4tpxo octld sDrau o;u4 rxoifciydoa  livs;s)setrxo oy1op  mneil(  2tr(r nt1ope mi3iys a2em(vpnt4alenmr tytfa e ueils0srtmxo3nodam n fctat s2taump;u0tlenmiciysfs2rmumo (4 leomf oo1lmt  ieilt0 eto(m3iy1oltnliciat)sDua(rpou4oeeomo3iat s2ul(vp;u)arerxocta1oaDr neslt)sexoxrpnydop e nciatfsrumx poo0oleomo3tld s elumo (4 rxrmo tatlpte ivil(0 2tmio3ou4lm emiei (fs2ua( p;u0oexo oeilt a ra(vo;u)tlxoir3ty1fpDrluvi ()srxrxr iu4aleelfetl() rrmump;o1tlxnif3tydlm uln snu0trtoxrcoa1omDrlies;( srurxopoo1ame mnvt ( srrrurpou4tpx iietyt a um(vo;u)tlxoifcoodomD liei (0 rxm(o3oo1openmivil()sDrr(mpnt0apx iictyd sDeluvp;(4trtrmr oydfa   u i s) etr(m iu1op elies (  rrmuroot1optnifcildlsDumumo (0 lxnir todfa rauei;(0 etoxm nudame mncs sf 2ur(  ot4openmi3tatlm rmnvs ()aexoir3oa1oate ues;s)t2xoir3no1aptnlnctasfaDta(ro;u0tpeoioetatfsDra(vo t0 renxf3iytfatrau o;s0t2xr(rpou4ll   fetltfsrtmu poo4aleo i3ilslm uanvo;(4trenmfcoatfa rlu olt) rxrxo3oy4apee ies (fs2taxm nu4aex  ociltlm el(mo;()alxoifcia1oaDrli o (  2xmio3oo4op   nvi s) rtrurono1aleo feiys a emnvs u4teenif3iodfpteanvo;t  exmxo nu1om  lnvsl( arrmum no1tpeo oetys m2rln p;u)aexrxrctodfpt lnvs;t sruoxo no4ll nlivslsfa2rmx ont1tlxn ieiyslmDem(mo u)teeoio oydlp eaueo;t0s2um(m iu4apt mfviasf 2ta(m ;t0olx  iciydla el(vsn(0altnirctotoptr n o s  etrxr iy1om emneiltfa2ur(rp;u1tlt moctas m2eln snu4aetoir iotfatr i o;s0 2tr(o3iodll  mneias  Duaumoot1ope io3ildfa2umnmsn(0texnif ia1fpt lieol(  rtmxr io4om   fei tfsrur(  ;u1aee moeiydfmDran o (0tetrmr iadfpteaivsls t2xmio3oo1lmeelnci s)artm(r ;u1tpxo o3tasla eauvo u0aexoxocta1fmDrli olt)s2urxo3io1lmt lfvtlsfa2rmumpou1oeenii3iltfsDea(mp t)areoxfcia1la  lueo;(0 rxr(o3oudlpt  nvil() rtm(  nu0aetoii3tys s elu pnu0tetnmf3ta1la r ivo;s)srumirpnudom elict s s2urx ono4apenmfciaslsDra( s u)teeomfctotopDeaueols  exmir3oodlm   ictls aDua(mpou0alenifciatfa uan onu4 lermfcia1omtelivsl()t2tr(mpny4ol n iet tfaDrru pou0aeeomf3iltfa eanmo;u0tltniocootfpt lnvs;s)setmxmpiy1alenmict () Dumur ot1apt ifetas s2emuvont0 rermo3totop e nvo t)trtrio iydom emiesasf rumu o;t4tleo oeiltfaDrlnms;t0 ltnmfctodfpteauei;s0s2xmir3oodomtelictl(  2rmu pnu1oetomiciaslm rln s t)arxoiocoa1fp eluvol(0t2trio3no4apt livs s arta(r ot0optnmfeiat s emn snu4arxniociadlpD auvs t0 rxrim iy4lltemfvtas srtm(mo;u0tpt ioeildlsDrmuvpnt) eeoxf3oytlm rai s;s) exmir io1lm n icslt) rumx oot4apx mfciytfs rmnvo;u0treoir io1omD  uvs s0trto(mpoydapenmict ()a2tmxm ;o0tpe mfeias m uanmp u0alxnmf3ty1fpDeln o t0truoirpno4lm nlfvt t a2rm(m nt4apt mictldfsDelnvp;u4 lxnxrciotomtrlues t0 ruo(m3iudomenmnvsat  2umxmpnt0aee mfeiatla el(vs;u4 rtriocoodlate n s;t) rxoim iy1oleelfctlt) rurum nu4apto f3tys mDran snt)tltrir iodlmDr i slt0srtm(o3iu4lleeliesl()a2um(r ou1alenifciyd mDem( p;u)teenmo3oy1oatrln o;s)s2tr(rpoy4lp emneta(farrm(rp;t0apto f3iatfm2rm(vp;t0texoir tadfa rlnes;()s2um(opoudol  lnctlt artr(  no1ale iociadfs rmnmsn() etoxr oadlm rliei;s) rtoir3nu1omtnmncta(  2umxmono1olen oeiasfmDemnmo t4treomf3tatom   i sls  etrim3iy1am nlivs t) 2trx  nu0tltnmi3iadls ra(vont4aexrxr oytla eluvolt) exoxr3iudoleemncta( arumump;o4aet  o3tlt aDrau snu4 rxrmo3ootom eanvilt s2xoxm ny4omen ivs sf 2urxm nt4opxnifetad m eluvp;() exnir iatoatrlneol()teuoir oo4omtnmfcsl(farumuroou0aeto f3iltlsDemuvs;u)tleoxr tytomteluesl(  2xrxr3oo1lmtnmncs (fsDrmu o;u1olen o3iadlmDel( s t) ltomo3oa1fpt anvs;()trxoir nydlle mivilt aDtr( oot4tltnio3iad a2ra(mo;u)trenmr iydlpDe u s (  ruo(opoy1op nlfctls  2tmxro;t0opxo iciad sDrau snu4treoircoydlp  aues s0srtrimpnu1ll n nvtltfsrrr(rpno1tpx mf3tadfaDumnmsnu0tlxoxf io1fa e ivs s t2tr(rpou4amenlictas) 2umxrpnt0apenmociytlm umuvp;()tetnxf3ta1fmDelnvsls sruo(mpiu1ll  liesat)srumurpno4tpen f3tydfaDrlumsn()arxomf3ta1opDr ieol(0s2trim ou1omenlfei tfs2tmum ;o0ole iieildls umu snt0aetnxo iydfptr uvo;s0 2tr(mpiu4llt  nci tfsDuax ooo1olx ioetatfmDumu pnt4 lxrir io1lm e ivi (  ruoxrpoo4lmt lnvtlsfaDtm(  ;o0optniiciyd m uan o t4 leoxo iadfateluvilt) 2xmimpoodamteliei s) Drmxm ou0aetnmf3iydlsDuanms t)teerio iotlpDe ivo ()s2xm(o3io4ome mnvta(f 2ta( o;o4tlt  oetlt m2em( onu4artrmf3tadopDeauesls  ruo(o3iodape mncils aDumx ont1tlxn octytfa2ulumonu0aetrio iotoaDr i ils  rxmxopoydoptemfvtat)sDtmuro;u4apenio3ildlsDrlnvp u0arxoxo3totfpD lieilt  ruoxo ny1amee iei t) 2rr(rpoo0oleo fciytls rm( p u4trxrif iytfpD  u i s)seto(rpiodome  nvi sfarra(mpou0tlxo feiydlm umuvs u4arerxrciy1fmtrauvi s) etoio iudlpe micsas  rur(ro;o0tlxnif3tld m2rm(mp;t0 etnxr todopteanvols) rumxm3oy1lle lfviat)s2rau  nt4alenifeiyt mDea(ms;u0teeoio tydfaDeaivi;(  etmxr ny4lp emivs t) rum(mpoo1tleomo3iysfmDuaumo t4altoif oytoa  luvi ()t2umxopoo1lmee nvt t  Duaumpno4tee mo3tadla uluvpnt4tltnxo iatlptrau s t seumimpoy1ap emics t)srumxmo;o1oex mfctldfmDeanvo;u)arxoxfcia1lp eaneo ( srtrir io4aptnmicil() Dtau  ot4tpxnio3tysfmDuaump t) etrxocta1lp elieo;()trxr(o ny4llt mfvt (fsDtr(moot4oee iieildls2el( snu) ltnio iydfaDeluei;s trurxo iudal  lfetlsfsrrr( ont4aeeoiietltfmDuanvpnt4 eeoxr3ia1la r nvi t sexr(o3io1ap n fviltfarrrx  no1alxoioetysfsDemnmp;t) lxniocoo1oa rlivo;( seurim iu4olee fvilt)a2umu ont0teenmi3tatfa2rlnmsnu) renio3oo1oateln o s)texmimpny1omeelicil(faDuru ono0oleomiciysfa2ean pnt4 etrif3totlmDeauvol()setoim3oo4ol   nvi t sDrmur ;o4aetnmociltlsDum( s (4alxnio iadopDrluei;s texoirpoo1lm elieslsf 2tax p;t4ale  ociad sDea( s t4treomrcoatoatraivo;(0t2umxrpou4am nmieslt) 2umxro;u4aeen oetysls ul(msnt0aexomfcta1fmtelueo;(  rxm(rpoydlm n nvtat) Dumum ot1aetomfetldlmDem(ms;(4 exoxo totomte ivo;t  2xr(rpiy4alen ivil(  2umu pou1oltnmoetlslsDel( p;() exoiocty1lmt  ivs t teurirpiydomtelies t s2rr( ono4oetnii3tadfs2um(msnu4tltnxr3totfmteaueo t0 rxoir nydomtelictlt)aDurxro;o0tlx ioeild m2ran s (4trenio3todomtran sl( s2xoxopnudope mfvil() 2rm(mo;o1openmieildfs2emumonu) ltrxr3tytop eluvsl(0t2xm(mpou1apeemicils)a2umx p;t1teto feiytfm eln s;t4 rerxr oatfmDraiesl( s2toim oo4lm e fctls)srur( poo0oexo i3iyd s ua(mo;t0tleoxoctytfp eanvi (0srto(o iodlp  lfci sfsDrau pnu4tlxnmiciltfm ea( s u0 exrmf3tadom  anei (  rtr(rpio1lmtn ncil(fa2tau  ;t4alx mictltfs2uaump t)aexrmr iadlmDrli ilt  rxo(rpno4olte ivi ( a2tru  ou0alen i3ilt s rmnvp;(0teerxfciy1faDraivi;t0 ruoxo iydalt  nesas s2rrx  ot0tpenif3tytfs rau pnt4tlenif3ta1fpt au ol(0 2xr(m3ny1lmtelfes (fsruaum nu0tet if3iys mDrlumo (4 rxnir3oo1oa rlies;t)s2to(r3ny1openmnvs (  rtmur ou1tetniociat m2ranvo ()tlxrmo3tadfaDr i olt s2urxm nydopte ivia( artrumpnt0oleoii3ildlsDul(vs t) etnmfcoo1omD  nvolt0s2umir ou1aptelnvsasfaDta(m no0alxomi3ils mDelumo;t) rtoxr oadomDeln i;(0t2xm(o3ou1ope lietas)arurxr oo4tltnmf3ilsfs elumo t4 ltoir ty1fp elu sls) 2urir3ou4lmte ict s) Dumuront1oexnmo3iatls eln o;t)tetoio oatoaD anvils)s2uoxrpno1ap elfvs s s2umxmp;t4opeomi3tas a2rl( o;()artoxo3oytoatraivo s0t2xoxm io4lp elicil(fa2rmx p;u1aexo o3iltfa eaumsn()texoir tatfptelivol(0sruoxr3oy1ll emivils)sruaurooo0aetnmiciysfm ra( p;u4texoioctatopD lnvs;s)trxmxm3oudapte nvi t s2uaum ot0aleo feiltlm rlums;u) rxoifciydopDe i i;s)setr(m iu1ope lfcs () 2urum no4texo ociaslaDulu o ()alenio3ta1fm ranes;s srurxo nodopeelieta(fs2um( p;u1tlx iocias a2em( snt) etnmf oytfp eaueo;( s2xmio3nydol nlieiasf 2um(mo;o1tpe  ociltlm rlnvp t4 rxnmf3tydlpD  uvi t s2urir3ny1lm  mnvias) ruru pot0oee mo3tad a rmnvp;u0texrxr3totop   ues t)trtmxrpoy4lmeelicsl(fa2ua(rpoo1apx if3iltlm ra( s u4aetnirctadlaD li ilt0seuo(o3iy1llt  ictlt)aDraum nu4aeeo oeiytlmDrlnvs;t4texrmfcty1fatelieilt0 rtrim iy4lleelfesatf Drmxm nu4oltn ieiadfm2rmnvo (0tetnifcta1la elivils)s2tmim3iy1amtemnvsas arumu oot0aeenmo3iytfs uanvs;u)aleoxo3oadopDe u il(0 exoir3io4olenlnetlt  Drr(rpou1tpe mi3iasla rm(vsn(4 rxoio3iadom   nvo;t0truoxr3oo1ol nmietl() Dua(m ;u0alxoiieilslaDeln s;t)tlxoxocoydoa rlueo;s) rtr(m3ou4opt mici s aDua( p;u1apen i3ild sDulumo u4 lxnmfcoytlaDe nvo s) 2urxo3nu4ap e feias s2ur(root0opxomfctls mDua( on() exrxociy1laDeluvil( tetr(r3ou4al  mfvsa(  Dtrx oou0optn fciltfs2uan p t4 lenxr3oydlaDrlueo s0 exrimpoo4lpee nci () 2um(root4ale  ictlsfa2eauvp t) eeomf3tydoaDeliei;t0trtr(r iu1alt lnct s  Dtmx pno1tlt  ocilsla2eaumsnu0trtnmr iotfmDran s t  rxmim3iy4opt lncs s aDtr(r nt4ope  ieiat a2ul(mpn(4aexrxrcoodlaD lnvils0t2xrxo oy1lme mivi tf Dum(  oo1oetnmo3tasla em(vo u4 lxrxfctadoa   n ols  rxmir3oy4om n nvia(f rurxr ;u1olx  ieiasfmDemnvon(0tlxnxf3totla   ieol()t2xr(r3oy4omen icil( arrmur ;t1aet ioctat sDelnmo;()trtnif iy1omtelnvi;t0 eur(m iu4om nmnvsl() 2ta(mp;u0ale mi3tasfs2rmu o (4 lenir tytlmtrlies s)setr(mpio4ole lfesl( sDrmu p;o1tetn oeiytfa2elnms;t)tltoir3oo1lpteaies;t) rtrxr no4lpt lietas a2taxm ot4oexniiciasfm um(mp (4alxrmf oadfaDean s;t0sexo(o no4am  mietltfarumx o;t1optnifcias a ulu pn(0 ltoircootfmDraiei;s0srtr(opno4opee ivta()srtrumonu4apt ioctldla rlnvsnu4tlxomf3oy1fpDrai o;t  exrir ny4omte nesls srrr(rooo0opeomfciyd aDemnms u4tetrif3iodoa  lnes s)t2xmir3nodomtn fvsatf rua(  nt4alto oeiad a2ean on(4 rtnxo3io1oate uei s) euo(r3iu1amtnlncias sDumxr ;u1tltomfciydlm2ranmp;() etoxr iy1fmDraieol( setrxr iu4ll nmicsa(fsDur( ono0tee mfciatla2eau s;u4artoircoydfaDrlu slt texoxr ou1optnmiei ( sDua(ro;u1aet moeiat m eluvo;t0tlxomf ia1om rai o ()seurxopnu4amt  nviasf rumxmp;t0teeniociatfm umnvs;u0texomrcoa1fpDelu s t)truo(opou1lmen nvtlsfarrm(m oo4altn iciydlsDrlu snt) eeomrctadop e ueo;t0srxm(o3nu4ll n fcs t a2uru poo1opxniociydfa2emuvo (0alxrif3io1op rauvo s t2xr(m3ny1olt mivilsfsrtmur nu4oexnii3tltla ranvo (4artnirciadfmD auvs ( trtmim3iu1opeelfcia(fsrtrurpot4aex mfctls m2elnmpnt0altoio totlm rln o ( trxmir3ny4opeemnes ( aDumumonu0opx  fctadfm rm( o ()aeerxfcty1fmtelnei t0 ruoim nodlm   fes s)srta(mpou0apenmi3iydfs rmnmp;(4aeeoxo3iydom eli ols0 rtrio ou4oltemfvsltfsDraumo;o0aptoioetltla2umu pnu0alxrmocto1op  an s;s  rxrxr3ny4al n fvt t)srrr(moou0tetnmo3tatlmDuln o;t4 rtnxfcoy1fa e neo t0 2toim3oo1lm emfvsls s2tmu ono0tet  ictadfm2um( o;t) lermrcoatomteanvi ()trtrxr3iodlp  miet s)a2tmxrpou0oeeomocilt s elnvp;u0 eeomo3oadom ranes;t trxmirpnu4llt  fctat  Dtaxronu0aet ifeilsls rlnmo t) ltrmocoodop rlnvi () rxm(mpoydomeelnvt t  Dtax pnt4aeenii3iadlm2ra(vp;u) reoxo3totfa  ai o s  rxrirpio1op nmiciatfsDrr(mpot4tlx  feiyd aDelump;t4trermo3iydlpt ln i s  2xmxm3nu1ole mfei ( aDum(ronu4tpt ifciadfsDelnms (4tlxnxf3oo1omtraieo;() rtr(m iodlpt micsl(  2rrxr nu1tee  oeiltlmDranmonu4tlenmf3oodlateanvi s s2ur(o nu4ol e ncils s2rrurpot0apto f3iyt a em(vp t4texnmfctodoa   n o;(0srxoim3oudapte ietl(f 2taumooo0teeo ociydlsDrmnmo;(0tetnmr oadlmD lnvi s0 eurio no4lmt  fvslt  Drrxrpnt1optnmieils m2em(mon()arerio tytoptr n ils)srxrxm oodameemici t s2ra(root1tltn iciytla2rmnmo;u) rxrmfcoo1oa rai i;s)s2um(r ou4olenmfvt tfsrtr(r ;u4tet miciysfa2rl( p;u0texnifciytfmt  i sls s2xmio no1ole  fctlsfa2tau  ot0tpt miciys sDeau o;t4 reomf ta1faDelueils  rxo(mpiy1opeemfcs ()s2umurpnt0aet  o3iysfaDemn p u4trtnio3ta1fmtrauesls0teumim ny1ll   fctas aDrru  ;t1tlxnmfeiltla emu sn(4teermo3to1omte uvi;(0 etoim io4lm emnct () 2tr( ono0texnmoctysls2emnmo u0 lenxf3tadlpteluvs t)teum(o3ou1lm   fcslt aDrm(m ;o1tpt  ociatfm emnmo (4aeerir3ta1latraies ()sexoxr3iydlleemfeia(  rrru o;o1tpe mi3tydlsDum(vsn(0tetnmf oytfat lneol()t2uoiopnydale lncilt)s2tmx oou0aptnio3iasls2rln p;u0trtoxf3oatfm ran o s)setriopny4lm nlnvslt a2urxmpot4teeoiieiasfs rau onu4trtnioctatlmDe nes;t texoir3nodal nmfesl(  Draumpnu1alen oeiys a2rau p;t0tlenmr io1fpt livs s)seum(m oy1alt  nvt t srua(m ou4aet mociydlsDeluvp;()trxnxf ta1fa e n i;t t2xo(rpiy1apte fviltfaruauront1olxnmf3iytfs2rluvo;t4 lerir tydomt luvi t  etr(o3oudal   ieilt)s2umurono0apxo o3iydlsDuanmo u0teerio3iytlaDeaivs t0t2tr(rpiy1amtn ics s sDtmump;o4teeoio3iatla ranvsnu)aetoxoctadomteaivo ()srtr(m3iu1am elfvil(fsrrr( o;o0aetnmo3tytfs ul(vo;(4trermo oo1opteau o;t0 2uo(opoy1ape  fci ()a2ur(ro;t0oltn oeilslm eauvpnt4areomf3oa1lpDeaivi (0 rtrio iodaptemiciatfa2rrx pnt4openmoeias m2el(mont0arxoir3ia1lmteanvi;(0texoio3no1openlivs s)sDrm(m ;t0tlx iiciatla ean o t0aleoif tatfmtraues ( trtr(m iy1ame  nci tfaDuaumpoo1oltn fciatfaDrlnms t0tltrmf3ta1oaDr uei t) rto(o3oydomtnmncsl()a2tau  ot1tptomociltls emump (0 rtrif iy1omte ueo;t)sexr(r oodlpe lneiat s2ur(mp;o1ole io3tls sDrln p;u0aeerifcia1la elu o t) 2urim io4lmtnlfvslt)s2rmum oo4olen fcias a2ra(vsnt4 reoxr iatoaDean ilt  2umxo iu4amtnmfes t) rtmumoot4tptoioetat m2eln s;() leoir ootopte u o;s)trxoiopiu1op  mnvi sfsDrmx oou0texn ictlt a ulu pnu4aeerircoadlm  ln s;s trumxopoydop   fvils) Drm(rpnu0oee  fetyd aDemuvo () eenif3oadlmt  nei t)seto(rpou4oltnlnesl(fsDrm(monu1ape if3iaslmDum(vp;t0trxrxfcta1oa rlu s;t)s2toimpou1alt  nvt (fsDraumo;t1oexnii3tat m ra(mon(4alxrif iy1faD  u i s)tetoxr3nydlpee ncslt a2uax  no0tltnmoetytlm2elnvonu4 eermoctytoa rauvslt sruoir iydop eliesat artr(ro;t0ope  i3iydls umn o t)tlxnir oydfmDrli s t0tetmxopno4omtnmncsa(faruax ono4olenmietad m2rmu s;t0 rxnifciodfmD luvilt s2toxr iy4lpeelfvtl(  Drrum ;o0aexnio3tysfa rln s;(4texnif oo1lp  an sl(0 ruoirpny4apeemneiatf Dumxronu0aeto iciytlm um( on(0altrxo todom raivils s2xoxr3nu1ame mncil()aDtru pnu0olt moeiaslmDuanvsnu0trtrxrcoytoaDr u ols) etrxr3io4lmt mnvtltf Dtaum ;o1oet moctlt aDemu pn(0arxrif ootfate n s t) exrxmpno1ol n fciasfsDrmx pou1tleoiictaslaDua( o ()tlxnmr3iydfm  ln s s)srxrimpny4ole  icslt) ruau  ou1aetomoeiysfm emuvsn(0aleomocoadfa  lieils)t2urxr3iydlpen icslt)sDumu pnt4optn feiltfsDraump;t)trtrio oadop r uvo;( trtrio3no4lptn fes (  Drmu pot1altoiociytfa uln p;t4aetnmo io1oaDeanvilt) 2xm(m io4oltemfesls aDrm( poo0tpxomf3iytlaDeanmont)aetniociodfa  livi;t srur(r3oo1lpe micils s2ua(m nt0oetomociyt s uanvo;(4 etrmo3tadomDe u ils0 rtoxo ou4lm  mivtat)aDum(mooo0tlenmieiadfaDrauvp;u4arxoif3iotla e neol(0truo(opoudlpeelnvs t)arra(moou1olto oeiat a ranvsnt4 lxrxo3tatoatr n sls)s2tm(mpnodopenmfei t)srtr( oot1tle miciytfm2rmnmp;u0aexoxfcoo1la   ueo;(0t2tm(o nu4ameelfvtat) Dtr(ro;t4olxomf3iys m ulump;u0tltrxr iatfpDrli s;t0t2urim oo4lme lfcslt) Drru onu0tleoiietlsls ra(vs;(0 lxnio3totop e uvo t trumxmpiydalenmnvias)sDurxrpno4tlx  fciyslm2rm(mon(4trenmr iadop   i slt)seuoxrpny4oltnmnei sfarumu  ;o1opeo oeiyd a2uauvp;(4arerxrctatomtraueol(0 2urir3oodllte fvtasf rtruronu4tleomfctys a ulnmo t4teenxrcoatfm rlnvo (0srtr(r3ou1alenmfet s) Dtax pno4aleoio3tysla2uauvp;t)texnmf oo1oaDraieslt) 2trxr oo1ap n nvias srrax  ;u4tptomieiasfaDrm( onu0trenir tadlm ranvs t  rxr(opoydlp e fcia(  rtmum nu0apto f3iaslaDranvon() rtnxf3ia1opD aiei;( sexm(opiu4omenlnvt s sDtm(rooo0tpt  ieiltls
\ No newline at end of file
@@ -0,0 +1 @@
+neo (0 2xrxmpny1lpeemnct t s2ururp;o4oltomfctydfm emumpnu0 ltnircoy1lp rlnes;( t2trio3oo1amt  ncta() Dtau  ;o1tle  icildla ulu o u4tleoxfctatfptranes s) ruoxr3ou1altemnes t a2trxr oo0olxnif3tls s2elnvpn(4 lxoxr3tatomtr ueo;(0t2urxm3iu1ol elfvta(farrm(rooo1oltomfeildfm eau on()aeeoir io1lp rlu i;(0 exmio ny4omtemfviasfa2uru ont4apeniieiltfa uan p t4tlxrmo3tatomtelieil( trxoirpoo4altnmfctat) rtmx pnu1tpxniieiysfa elnvpnu)arerxrciytopt livi;( s2umxopno1omt micsl()a2ta(m nt4oleoio3iysla emump;(0tlxrmo iotlm   u olt t2tmio nodaptelfcias) rraxmpot0teto f3iyd aDum( s t4 renxoctotlm eanvs;s0t2uoxm3oydom elfet t aDuaumont1ale  ictys m uluvp u0altnxf3todlat ln sls texoxr no4al   ivtat aDuru  no0altoiictat sDeanmsnt)trtriocoytlp eaivo ()tetoxr iydape lnesa( aDtrurono4tle  oeilt a2elu p;u0texrmr3tadfpDe u il(0srtm(o iy1ol  livsat aDraurp;u1aee miciys mDua( p;u4teerioctytoptrliei;s) rto(opou4amt liei s  rtax o;o1aet  o3tlsfs2umn p u)artnio iytlaD lnei;s) etrxo3oo4lpt  icsa( srum(m ot0tpto ictys a2rlums t0trxniocty1latr n i s srur(m iydol elieia() rum(ront0apt moeiasla eauvs (4 exrmr oatlptrauvi ( teuoxr3no4lm elfeta( sDtm(r ;u0opt mietat mDulu sn(0areoxrciytfmtrluei s tetr(mpnudomee ieia() Durumpoo0aexoifctltls ul( s;(0 rtrmr ty1fp   n sl( trxr(rpny1ap e nvtl() 2ua(  ;o1alen o3tysfsDrmuvs;u0altoxo io1latrauvs (0 2tmio oo1amen ieiat)a2rrxmo;u4aeeoioctytlm2em( s t) lerxocoy1opteluei;()trtriopoydlpt licsas)artmxmo;u4oetnmi3ildlmDumnvo;t4 rtnio ia1fmDrau slt)s2xm(o3ou4olenmfcsls)aDtr( pno1tleo feilslmDrau snt)altriocoydoaDr i ilt)texm(m3nu4llt lfcta(fs2ur(moot0tpeoioetydls2ulnmo u)alxrioctadfa eln il()trtm(r iudaltnmivi s sDua(  ;t0oleomiciad a2rmn p u4teermf oydomt  ies;t0srxm(mpnu1al  lfeslt  2rm(  nt4aeenmfctydls emn ont) ltnifctytom  lu sl(0t2xrxrpno4olt livil(  Drr(mp;o1oexnmfciyt a2uau s;t0arerxr3iadfmDr uesl(  ruoim3io4ll nmneiatfaDtaxr ;o4tpenioctatfm2rmu o u4arerxr tatlaD ai i;( teuo(m3oy1lmt lfvta(faDtaxmp;t4oetoioeiaslsDua(vp ()tlerxfcoo1latrau slt t2xoxr3iy4oleelicsl(faDtrur nt1tpt ifetytla el(vs;u4 rxrif oatfm rlnes;t)s2xr(m oydapenmfciatfs2ta(moot4alxnifciyt s2ra(vp;u4aetomfcty1oaDr ivs t)texoxm3iudomtnmncsl() Dururpnt0tpeo ieiyd s emnmo t)aexoxr3to1fmDrauvo;s0tetmxrpiu1op eliesat  ruaum ;o1tpenmieiyd a ulu o;t) etnmoctodfmt  nvolt t2to(mpiy4am emictas  Durxmonu0aetnio3iyd s2uluvs;t4 rtrxo3ty1lp   neo;()teuo(opoo4lp elnetasfa2rauro;u0ale  oetls m elnvsn(4aeenxr3tytom eaneo;t)seurirpnodome mncil() 2um(  no4oex mf3tls a rl( s;u0alxnxf oytoat an i;s  2toxm nu4lpe lnct ( a2taur no0alenmi3tasla2em( on(4 reomr tatlat aneils s2toim3nodop  lietlt s2uaxm ;o1altoifctadfa ranmsnt4trxoxrciotomtrliei;s)s2tmxm oo4ome mncs (  Duax pou1opx io3tlt aDel(mo t4aexnmo3oodoa  aieo t0srxo(m iy4lmtnlicta()aDur(mooo4oltoio3iysla rluvo;(0tltomf3iydoaD  u i s0trxmio io1omtelfesasfarum(m ;u0tptnio3tas sDrau o;(4 etomrcia1faDelnes s  2uoiopou1lmee icta(faruau pou4alxnioetad s rlnmsnt)tltrif oadfmDelneols s2to(o nodol e nesl()a2umurpot0aet ifctysfmDeln s u)artnxf3tadfmtr u ol(0texoxm3oudam nlicsl()s2tr(mo;t4optomi3iydls uln p;u) ltrmo iytlm   uvo t)trxoim iy4lp nmnvils) Dtmxmo;t1oleniicildlm2rmump u4 renxfcta1fmDrlnvslt) exrxm3ou4omeelicias  Drmu pno0tlt ioctls m2eluvs;()arermf3ty1lp rln ils) 2xoxmpio1omenlfes ()sDrr(m nu0ale  oeilt m2umnvpnt4aleoif tydlaD  uei;(  2xmirpny4omtelicsas) Dtmx  oo1oeenifeias a el( s u)aleoxo totfpDr neol()texo(m3nydalt  nvi sfsDrm(ro;t1aeenmfeiatlm2emu s t4arxnir oatoptraieo t)t2xrir3ou1lmtnlfvs sfa2ururo;u4tlenifeilt m ran s;t)tlxrxo ia1lmD li ilt0t2xo(r3io4ope lfvta(f Dtmx o;o1tex ii3tldfa2rm( s t4 renircto1omt anesls)setrxr io1olenmnvsa( sDua(mo;t1oex io3iat m rl(mpn(4alerxr iadfmteluei;(  exmxm3iu1omte neias)arrmx o;t1aeeoifeiydla2umn p u0aetrircoa1lp elu il( s2tm(mpiydlmt  ivs ( srua(m ou4aexo o3tldla ran p (0tltoir oadomt lues t0t2to(opnodlp  mfvsa( aruru o;t4tlen ieiysfsDuanvsnu0trtrircoadlatr nes s setmiopiu4lmte feilt)a2rr(m no0opx mociytfsDul(mpnt0tlerxo to1fmDeliei;t s2um(r3ny1ap n neils srtaum ;o4apxo o3tlt sDeanmp;t4trtrmf io1fatrlu i s)s2trxrpiu4am   ivtasf 2rr(  nu0opxnmociltfm uanvonu)tltrmo3iydlmDe u o;s)t2xrirpiydapeelnviat) Dtm( p;t4aeto i3iyt aDulnmsnu0 etrmr tydfp eluvo;s0s2tmxr ny1omt micia(fa2uaxmpou0tlt iicild sDrl( o;(0altrircootlaDrauvs t texmim3oy1lle lnes s s2uau o;t4tlenmi3iadfm2raums t)aleoxrcoo1laD  ueil()seuoio oodop  livsltfa2tr( onu1aetn ietyd sDra( p;(4 ltnmocio1oate uei t0 2um(opny4apt  iciat s2tmu pot1oetomieiasfsDumumo (0 lxnmo ia1lm   ies;( t2toim3nu4amt  ietls)sDur(r ;u1ole io3ild m eaumsnt) lxrmr3to1om  lnei s  2trim iodap elfviatfsDrmxrono0tpeoiiciaslm2ea(msn(0arerxrcty1fmDeau sls)seurxo3nu1lmen fvt (fsDrru  oo1optniociad a2umnvon(0tleoircto1lpte uesl() rtoim3iydomtnmncs ( a2ur(rpou4tex ii3iydlsDul(mo t)tlenxr oytoptelivolt0trxoir no4lp e fvs ()a2ta(r ;t1ole ioeias s2ra( s (0teenio oa1fa   ueo;t srto(o iy1opeemfcs t sDur(mo;t1aexnii3tlt s elums;t) lxoircoytfmtr uvols0 rtoim iu1ale liviat  2umurpou0oexoifeiydlm ul( s (0 exnxr3todoa rlivi s0srur(rpio4lptnliesas)sruax pno4alen fetlslm2emu pnt0 etoxocoatopDe i s ( s2trxm iu4ap  mfes sf 2rmxmpoo1tpx mfciydfa2eanms u0altrxrctydoatr nvs (0s2trir3iy1lmtemivtatf 2rr(m ou4olxo fctas s uanvs t0texoxo3tadfm eaies ( srtrxr iydlm  lfvs ( s2umump;t4tetomociasla2emnvs;u)arxrxo iodlpDeluvilt0 rxmim iydom e ictat)s2trur nt0alx moetasfa2ean o (0alerirctodfaDrlues;t0 2umim3oodome  nci t arraxroot4openioeils s emuvs u4artoxf3ia1optraivols) ruoxopio4lpt  fvils sDua(mp;o0tptoifciltla rauvs;t0arermfcta1fptrluvi;( seumxr io4omtn fvtlt arrrum ;o1altniietat aDulnmo;() lxrir3tatfpDr ieolt0 rtmio3iu1ale lnviat sDrrxmpnu4aex  ictys s2eluvo;t)tleoif iotfpte ueil( t2uoxm3oodlleelnet s  Durxrono1alxomoctyslsDem(monu4trenifcoodfpD lueo;( t2urim3nu1lp nlietltfartmxm ou0opxomoeiasfa ua(mpn() rxrxoctydfp r neo (0 rumir oo4amenmivias) 2raurpoo4apen i3tas m uanvp u4tlxnmr tytlm e ivol(  eurxm no1amenlics () 2tru  ;t4apxoioctld sDean pnt0texrmrctatfm e ies (  etm(o3nodal elivt sfs2ta( o;o1aeto i3iad m rmn sn(4 ltoxr3iydoateliei;(  eto(r3nydale mfesl() Drau  oo1aeto fciasla umnmp;(0aeermfctydlp eli o t0t2trxmpiy1opt liesls) 2tm(r ou0aexnmfetyslm2ua( o;(0alxrxfctotfmDe nvs;s)srurim3oodaptnmfviltfaruaumpot1tptnmf3tld aDel(ms;u4 ltrxf oatfatelues ( t2ur(o iodameemncs ()srumur no0oeeo octyslmDra(vo u) rxrirciydom rauvs;(0 rxrxr ny4omtn nvias)a2taurp;u4oeeo fctydlm2eau o;u)arermfciatlat  neils s2tmim iu4optnmfeilsf 2rmxmpoo1tpt miciadfs2uanvs u4aeeoiocia1latelivo ()texrim3oydalenmfvsa()a2umxm nt4olxo icildla2ean p u)trxnir3oa1laDelivi;s0 rtoxopnydlptemnvi ( sDtmx  nu0olx mo3iytfs uaumsnt0tltrxr3ootlp eauvs ( s2uo(o3oo4lptn nvia(f 2umx p;u0openmoetad aDumn ont0tlxrif oa1op  auvo t0 exoxm3oo4amtemiesltfarrmu p;u1apx  ociysls2um(mpnu0 renmo3iodoa  ln ol(  ruoxmpio4omee ncias)s2rrxr ;t0oeeoiociadla rm(mp t4aexomrcto1lp   n o;s0trurxmpio1am elfcsls)a2tm(rp;o0olx ioeiytls umn o;() leomo3tatfmteauesls)teurimpiydoleemics t) Durxrpou1alxo oeiys m rlnmsn(4 lenirctadop eaueslt) 2umimpio1op  lfesa(f rrrxmont1tetniicildls2ra(vs;u4tltrir3iadoptrai ils  exoxr3ou4lmee ics (farrr(mooo4tex  o3iltfa el( p;()tlxnxf oytoatraues;(0 eto(r iu1llt mfet t arra(ronu4tpt mictldfm2ranvsnu) etoxrcia1optr ivsl( srum(r3oy4lpeelnctas  2uau oou1oex mfciyt a ul( p;(4areoir iydfptrln i;s)s2xoxo3iu4aptemivtasfsrtrxmont1oeeomocils s rau p;(4 leoxr oytfa  ai sls) 2tr(rpno4ol  miei tf Drr(rp;t1aetoifetlsfs rl(ms;u)texrxfcoy1laDranei;() rumxopiu1al nlnvi s) Dtaxrpno4tltnio3iytfmDumnmsn()tlerxr iydfatrlivi (0 rxrim no1apt lfvils)s2rmx o;u0tpt mietad mDeau s;u4tltnir ootfmte nes;s0 etmio3nodom nlnet (  rrau ono1alx  o3ils m ul(ms;(4tltomocoatlpDrau s;s srurir3iodamt lncil( aDuau  ou1tlx moeiat a2eln p;()trxrmfcootlpt  uvslt)sruo(r3ny1alenlnet t)sDrrxmp;t1teeoiiciysfsDuluvp;(4 eeoif3oa1op   n olt seur(mpoo1lptemfvta()artruro;o0aexn fetas m uauvp;t0arxomrctotoatrai i (0s2umxm oydomt lncias)aDur(r ;u4opxo i3iys m2eauvpnu) rtomocoo1lm  anvo;s)t2toimpiudlp  mivia() Dtmxmonu1tlenmfeiad m eanmsnt4teermf3totop e u i;s0setmxmpnydop elfeslt arur(mp;u0oee ii3iatfs uau o;(0 lxomfciotfmt  nvo;s)texrxm3nydomt lfetas s2umurp;o4alxniictatla2em(mo;t4teermf iy1fa elues t sruoxo3ou1ap   fctat arrmx o;t4tlxo o3tysfm2ranms u0 lxoirciadfm rauvi ( srurirpiy4alt lietas) rtrxrpno1olxn i3tldlsDulump;t)trtnmf3tadoaDe n o s0tetm(r3iydapt mnvilt arraxm no0aleomf3tasfm rmu pn(4altnxo3oo1omDrauvi t)srxoimpoy1amtn ivi ( arra(m ou1olxn fcilsfs rmnvs ()arxoxr iotfpDeli s;t teurxr oudaleelicilt)a2ta(mpnu1tetn oeiad aDumnvon(0 lxnmo tatlaDe nvs t)seurxr3oy4ope  fcs ()artrumoot1altnio3ildfaDumums;u)alxoxf tatoaD li olt tetmxrpno4apee ictl(fa2rr(mo;u4tlt  fctytfmDem( s;t4arxrmr3oodoaDe n o;(  etoiopiydlmt mivt s) rrau  ou1tex io3iadlsDua(mp t0 lermf oadfatrlivi ( srtrim3nu1lle livtlt) Dtm(r ;u4tlxn o3tyd m2rln s ()aeenxr tytfa  au s;t0t2xrxm3io4opt mnvt s aDrmxmpou4alt  ictyt m2eanmpn(0teerxociatop   uvo;t) exoxm3oodom emnvsl(f 2rrur oo0tlx iociatfa eanmsn(4tleoif ty1lmDeaneo;t0truo(r3oy4olenmictls  2rmxrooo0tlxnii3iltlaDrln snu)texnir ta1opDran s;(  etoxo oo4apenlfesl()aDrr( pot4oexnmoetydlaDrln pnt0texrmr totfaDran o;s t2umxr no1apeemivtls arrauront0altnio3tysfa rmnmo;u) rxniociadoptrauvsls  etoxm3io4ll e fcia(f Durx oou0apxnmo3iasfa2rmumpn(4 eeomf3ta1fpt au ols0 etrxm nu4lmen ncs s)a2rru o;u4apt mieiadlm rmnvs;u4tetrmrcoatlpDeauvo;s)t2toir3oo4open ictls) 2uru pou1texoif3iytfaDrm(mp ()alxoif3to1optelivsls trtoiopoo1lmeemncta() rrmuro;t0tlto o3tasfa umu p;()aexomo3iytoa r u ol()srum(o3oy4lle  fcil( s2raxmoot0tpe  o3tys a rau onu4trenioctotfm   nvi;(0srxoxr ou1lptn iviltfarrauront0apt iieils m ul(vsnu0 ltomocoatfp  anei t0trtr(o3nudoleemies (  rrr(r oo0teeoiiciytfm2ran ont4texrmf iy1lmt lu i (0 rxoimpio4ol nlicsl(fa2uaum no0olxn i3iltfsDemnvont4 eenxo3oydfa  ln s;t srtrir3oudomen nvta(f Dtr(ront4ole  icilsfa2ra(ms (0trerxr iotfatr uvsls0 rxoxr oodoptelnciltf 2tmumpou1tlxn o3ias a ulnmp;(4texrmr3ta1lmteaivi s0srtoxmpno4lm nlfcta()sDumu pno1altoiictatfa2raumpnu) eeriocoo1fm   nvi;t  2urir3nodol   ics sfsDua(mp;o1oexo o3iltla ul(ms t0arxomocoadoa  an s;(0s2xoxm oy4lmt lfet s aDtmx pnu0opxomfetyd m2um(mp;u0artnif3to1laDeanvo (0 etmxo3io1ome mnes t  rumu  ;u1apx  o3iat s eluvsnt4 exomrctatfm rlnvs;( s2toxm iudol e nei sf Dtrxmpnt1tpxnioeiltlm um(ms u4aeeoxocoadfpD  uesl( t2umxrpnydolt lfcsl(  2raur ot1aeeoiociltfm ulump (4 ltrxfciadla elu ol( trxrir ou4amtemiet tfa2rm(  oo0aptniieiysls2eanvo;t) lxoif iytfaDe u s;t)srurxr3oudllt lnvta( srum( ono1tpt  feiys s rmn o t0areoxo3tytoaDe i o s tetmirpno4lpte nviltf rtru pnu1aeenif3iadla2ulums (4aexomocoodfa elu i s)s2tm(r iodal   neia(fa2ra(rpoo4oeeo fetltla2em(mo;t)treoiocto1opt aivo;()srurim io4lmte feil(f Dtrxmpnu1oeeomieildlaDelnmp;(4 rxnxociodoaD  ivo;t t2xmxo no1lm   ietlt sruaxro;t0oee  ieilsfaDem(mpnu) ltnxrciytoaD livsl(0 rtoxrpny4oltnmietl( arraumpno0optomfciyd m2rmn snu0 renxoctadfpDeau sl(0sexoxmpny1lmt  fcs sf rrru ooo0apt  i3iydfm2uan o (4 leriocoatlaDelneols setrio io1lm eliesa()aDur(moou4tpx ioetasfaDrmn s;t0trermo3tatfptrli il()setmim ny4opt  ivi t  Dta(rooo1alxnmictld s emumo () lxrif ty1fmDeln o s t2umxm ny1ap  mfvs ()s2ua(ronu0alxn fciadfsDrmnmp t0 rxnif iytlpD  ueo t) rurimpnydlmt  nvias)sDta(  nu4aleomfciytfm eaumpnt0arenmoctotlpDrauvols  exmir iy4olt  ietltfaDrrx p;t1tpx ioetydfmDra(vs u0areomrcia1fpt  ueo;(0s2trxr3oo4amtn fct s sDum(  ot0opxomo3ilslm2rlnvpn() rxrir3iy1fm  lueo;s trto(o iy4omee netlt)aDrrx pnt0olto feiytls2emnmo u0 eerio3oodfm e nvo (0 rtoxmpny4oltnlivias sDrmx o;t1tpx mieiaslm emuvs;u)alermfcto1lpDeanvols0srurir3oudap  lnct () rtm(m ;o4oexnio3ild s rmuvo;t4 lerxo3iydfp eli s;t)srxm(m3iu1olenlfesl()aDrrurpot4tpx  iciysfs2eauvpnu4 eerxocta1lpDran s (  rxo(r3ny1lmenlneilsf Duru  ;u0alt  iciysfs2ranvs;(4tltnir3oydlmt  uvi;() rur(o3oy4lm e fciatf rua(  no4aexnmfciltls2umu s (4aeeomr3tydoaDrluvo;t0s2umxo3iy1lpenlfesl(f Dua(rpnt1tpto i3iatla2ea( snu4aexomocoadlat  nvsl(0 2toim3io1apte fvsl( s2tm(monu4ope ifeiadlm2rl( o t)artnmr3iatlat  i i t) exmxr nodal nlfvtat)srrm(moot0aptn ictydfaDrm(vo u0teenmf oadla rlies;t)tetoim3nudlpe  fvt s)s2rm(mpoo0aptomoctlt s raumpn(0 rxoxo3iadlat  n sls) etmxm3iu4apenlfctltf Durxm nu1texn ieiad s rl(vp u0tleniocto1oat auvs;(0 etrxr3iu1lpe mnes t)arraxroot4teenmi3tys s rlumpnt0 rxrmo iytlm   u i;t0 euoio nodam emnctasfaDuaur no0tpeo oeils aDea( s u4aetoxfctatlmDrli i t  etrirpno4aptelnvtasfarrr(ro;t1tet  oeiad sDua( o;t4tlxnxf tatlmteluvs ( texo(m3nodolee nvias)arraxm nt1altoifetlt s umu o;t0alxomf iodom e ivi t0srtoxmpio1ale  fesl()aDtaxmp;t1tlt mf3tldfs2ranmpnu0aeeniocio1fpDelieo;t)sruo(r no4alenlfvsas) Dtmum ;t0opxomo3iytfaDrauvonu)tleomo3oatfatrlues s0teto(o3oy1lle lnvs s) rtrumoot4olxn i3iyt sDel(vs t4trxrxfctytlm eaneo;t0s2toir3oy4lm  lfetlt) Duax  ot4tex ifetytlmDulump t0 lxnmrcoatlpD aneil(0 2umir ny1op emncsl()a2umump;u1tlx mocias s2emumo u4artomocoatopDelnvo t)teur(r3iodale mictlt)sruau o;o1teen i3iatfm ul(vo;u0aexomocoodlpDranvs;t  rtr(r oo1lpenmfvsl(farumur no0opx  ociasla2ran s t4tlermf oadopte neo t0 rtrir no1lm  mnciatf Dtrxm ;u0tpen fetydls2ulnmonu4 rxomocoadfa elueo t) ruoim iy4ameemnctatf Dum(mont0alto f3tlt m rlnvon()trtrmoctatfp   i o ()srto(rpoudamtn ncsat arrau pno4oeeomo3ils m em( p;(0tetrir3oy1op ean ils)tetrxr oy1aleelfci t)s2urxmpno1aexoiocilsfm2elu s;u0 exoifcto1lmt  uvi s) eto(m3oo4ale mies s)artau  oo1aet mfcild m2ua(mont) rxnxo3oatfa eaneol()s2tm(rpnydom nlivi s)aruaur ou1tltn ociytfsDrau on(4altoxfctytfp eluvs;()srumxo3oo4ome  ncs sf Durxr nu1opx mo3taslm2ulu s;(4arxrxfciotlp ean il() eto(r3oy1amtemneta() ruax  nt0tptn fetasfa2umu s;t4artomr3iadfpteauvilt srxr(rpnydamtemicia( srtm(mo;t4tetoifeiyt mDemnvs ()aexoir3iodfmte nvilt srxr(mpiy4lpe livi (  Duaxmoou4oex ifcils aDelumonu4tlxrio3todfptr nvolt0t2uoxmpoudal   fes t)a2tmxmont1oex ifeiadfm2ra(vpnt4alerir3iodop rau i;()srxmxmpoudal nmfeilt s2raum no4aptnmicilslaDel(vs u0 rxrxocoatoa  li i t) 2xmir3io1oleemiesl(faDtmx o;u1optnio3iadlaDea(mpn(0altnxociytlpt au i t)s2uoxr oodamee ivsa( a2umump;u1tee mfctld m ranmo u4teerirctadoat lueslt)setm(o iudal elfet (  Dur(  nt1tlto fctat sDua(mon(0trtoirciytomte ivs;t0texmir3ou1lptn nciat s2rm(ront4apenmociysls uaump (0arxrxf tatlateauvsl( srxm(m ou4oleelieil(  2um(rp;o0tleoif3iasla rmuvs t4 eermf oodlpD  uvi;(0 2tr(opnydoltelncsa(fa2rrx p;u4oetn ociysfmDuan pnu0 rermo3oatopDr iei t)trtmio3ou4al n ies sfs2rmxronu1tltniietytfa umnms (4alxrxf3oo1fp eaivilt0trtmxopno1lle  fvtlsf rururo;u0tlt if3iasfmDelumont) rtomr3tytfp   nvsl(0 2xm(o3iy4am   iet s  2raur ;o1ole ifetysfs rluvo ()aeeoio oodfmDe uvi;s)trxm(m nu4llen nvi (faDum(r oo0tlxn o3iltfm2ua( p;(4trxnmo iatlpt ln sls)t2tr(m nu1lpt lfcta(  Drm( pno4tetn ictlt s uln on(0 lerxrctadlp  livo;t)trur(m3ou1ome mneils) 2urxmpot1openmietltfsDuanmo;t)aeerifciatfaDeluvolt t2tmim3oy4lltelivta(  Dumu  nu0oltoifetytfmDemn s u0 etoxo iotfpte u ilt0trumio oy1aptnlfes ()sDtrxro;u4oltn oeiatfm2rmuvo;(4 ltnmr3ty1faDe i s t  2to(r no4ll   fvi tfartrurpou4oeen ociatfs2ua(msnt0 ltnir3oydoa eaiesls trumim3nudlpt  ics sfa2rrxro;o0tet miciltlaDuan p u) eenmf oadoa ranes ()srxoirpoodlle  fcs sf Durxronu1tpeniociytfm emnvont) renxo to1oa rauei;s t2toimpiu1lptelfci ()aDtrxr ou0oeeomoeiysla um(vonu4 eenmo3iotlp elivil( sexr(o nodlpe lnvs sfsrtaxrp;u4tlen oetaslaDelu o u) lerxfciytfa r iei;s0teumxr oodomte fvil( aDum(r oo0tlto f3iasla2eluvp t)tlerif3tadoatelieo;() 2trxr3ny4amt lnvta()a2taxronu4tpenmiciyslm2ulnvs u0tlerxr tytfptr nvs ()s2umio oudameemnvi (  Drmurpoo4ole  feias s eanvpnu4 etnmo tatlaDe u sls) etrirpoodll e iciat)artr(monu0texo o3tldfm2umn s;t)tetnif3iy1fpt  u olt0s2xoio io1omeemncias  Drrxm ;t1aex  o3iad aDuaums u4areoir oytlpDe ues t  2xrirpoo1om elfvtlt  Drr(m ;o1tet mociysfa2umnmpnt4artomrcoatoaD  i ils trxm(rpoo4olte neias srtm( onu4texnifeiytfaDeluvp;u0 exnxf tydlm e uvs t0 2xr(mpiy1ame mnesa(faDtmu pno0tlx  feiydfs2rmumo;(0teenifciodopDr iei t)srumxmpoo1lpenliciasfa2um(  no0tlx mociasfaDemumo;t4tlxrircootfpteaiesls setoim3ny4omtemfciatf Dtaumonu0altn fetlsla ra(msn(0aeerioctydoa r nvslt)s2urxopny1ape mieslt  Dtrxm ou0olxniieilsfa2ua(mp u) exoxf3iytlp r neo;s setoir iu1am  mnct tf 2urx  nt0tee  oeiasfa2umnms t4 rtrmociy1opte n o;t0sexrir no4al emfetasfaDurxrpnu1tpeoiictys s rlnmsn()alxoio oadlmt liesls texmxopoo1op nmivtlsfa2rmxr oo4oeenmfeiys aDra(vsnu4 lxrircta1fpD an sls  2xo(o ou4omee icils)sDrr(rpoo1aeeo oetlt sDuln sn(0 exnxf3ia1lmDelieo;t0texmxm3nu1olt  nesltf Dua(mp;u1opxn o3iydls2ua(ms () lenxr3io1oaDeanvol() exmxrpoodam elfct t)artaumpoo4aleo oetls m uan pn(4aexrxo3tatfp e ivs t)trumxm3io4ol nmictat)a2uau ooo0ape ifetyd s2rluvpn(4aleomrcoy1oat  uvo s0 etmxm iu4om emnctls  2ra(rp;t0tlx  f3iysfaDuauvonu0 exrmf3oy1oatrauvi;s0trto(r nydomenlics (f rtaxrooo1tex mfctadla elumsn(4tleoxf3iodla  ln ol(0s2umim oo1ope lfvsl()sDur(r ;t0opeoio3iytfsDuaumo;u4tetoxfcoo1fa elieolt0seto(opnudape  nct (faDtr(m ot0tleoioeiyslm umuvp;(0aetrirciatfpte i ols) 2xoxm3io1omtn fcs ()sDua(roou1oetoio3ild mDrlumpn(4arenxo todom r ivs;t  rtmxm3no1amt  nesl() 2ra( onu4olx  i3tyd a ra(mpnt4artnmf3tadoa  an o;( srxoxmpoy4ll nmivs tfa2tr(rp;t4tpt  iciydlsDrmnvs u)trtrmf3ta1fpt  uvo (0seto(r3io4ll  mfvilt)s2ta(m ;t0aee  feiydfa ul( o;(0aexoircootom  lnvsls) rurxm3no4apen ivi ( arrr(rp;o1apenmietat m2rlu o t4 ltrir3todla eaieo;(0trur(r3io4lptemieta(f 2uax  no4apeomictat s2uan p u) etomocto1opD auvs;s0tetr(m3no1amtnlici (f Dra( o;u4tpen i3ild aDelnmsn(0artrir iydfaDe uvo (0 2urir ny1alee fvs (f 2tmu pou1oex  i3iydla2umuvs u4 etnxf3iadlatr i i;( s2um(o3oy1ap  micsltfa2trxrpnt4alxomo3iaslsDrmnmo t4areomf3oytfpDr ues;( seto(o3oy4op   ncta()a2tmxroou1tlto f3iasla2ul( s t4aleoif3oytfat  nei;s0trum(o iy4ape lfcia( arumxrpot4apto ietysfa2elnvo t0arxrif iy1op  lnvo t srxr(m oy4omtn nvt sfs2trxrpot4aexnio3tatfa umnvsnu0trxrxo3iy1fpt auei s0sexr(mpnodlmenmfvils srtaxmpoo0aexo oetadfs2rl(mo (0 lerxoctotomD luei;s)s2trxmpiydapenmfctas)srra(mono4texoiociadfsDumnvsnt) rxrxr3tatoaD livs t)trum(o ou1op n iei s sDrm(mooo1opt mi3iat s rl(ms (0 ltoxf3ia1faDrlnvi;(0 2tr(o3io1lle lfct s)arumu onu0tle mfeilsfs ea(vo (0 rxnmfcta1om e n o;s0 eurimpiu1amee ictls)aDrm(r ;u1aetoifciytlmDeau sn(4 lenxf iydomtelnes;() rxm(mpnydlltn ivtlt  2taum ou0apt  oetytfm uaumpn() ltrmfcoa1om raivslt trxoxm io1alt mivs t) 2ta(ro;o4oexo ieiytla rmnmsnt4aetnmf3tadomtraiei;s0 2tmxm io1al  lncils) 2umurp;o1optoiiciadfm2uanvs t0 ltrmr3ty1om eauvo t trtoxm3nu4openlicsa(fa2urumpnt4aleniociytla2elumo;t0areoxo3oodopteanvo;(  eur(m nodll  micsl(fsDtmx  ;u0teenmi3iytlm rl(vs (4aexnmf oatomD  ueo s0 rtmir3oy4altnlfes s)sDumu  oo1alxnmf3ils a rmums;u)tlerxr oytlpt aivi;() rxr(o3io4om n ncia()aDur(mp;t4aee  ocild a ulu ont0tltrmoctydfat  n slt)t2tr(opiudoltnlnciasfsDuax poo0alen o3tasfs rlu o;()aetnif3tydfa  ai o;(0s2xoir no1oltemieia( arrr(rp;u4tptomf3iyslaDeanvp;u4altrxf3iodop   iesl()teurxr3io1lp   ieta(fsDrm( pnt1tpxoii3tytfaDum(mo (4areoifctodoa  auvolt)s2xrxm nodlmt mncsltfa2rmu  ;u0tetomiciltfa rl(vs u4 ltrxr io1lm  lies;s0s2tm(mpoy1amenlnvilt sDua(roou4aeenmocias s rau sn(0trxomf3tatlpt lu i ( srurxm no4lm nmnvslt arum(roou0tle  icils a rau o;u4alxnxrcio1latelu ols0 euoxm no1om nmivt t  2ta( oou4olt  ociatfm rluvo (4 etomrcoo1omD li olt0 2xoirpny1am n iesa(f 2rru ont1opeo o3ild s2eln snu4 exomfciotoaDranvs s0 2uoimpnu4lmee nvsa()sDtm( ooo1opt miciyt s2rluvpnt0teenircoodomDelnvi;t s2urir oo1optemncsl(f Dua( oou1opeoiociaslaDem(mon(4 eenmociadlmD luvsl(0setrxm ny1alt lnesltf rurxrp;o4apto ietad s rmums;t0 rxoio3tadomD ln il( s2xoim oy4ole mfeiat)aDuaxr ;t4alxnifciad aDran p;(0tltnirciy1fmteluvi;( srxoxrpiu4ap emicilt)sruru o;t4oeeoifetatla um( o;u)aexrxo3ia1fptrli il(0trxoxm3nu4alenmivs s)srrr(r ;o4oee ioctytlsDrl( s t0trtoircoa1lmD anvs;t0trto(mpiu4lltnlfctl() Dtax pno4tex iieiat m ulu o;(0artnmrcta1fptraiesls0 rurirpiudlp  livia( s2uru  ;t4oeenio3ilt sDemu o () eeomfciydfmD aies s)srtr(m3iodom emivtltfsDtm( pot1apt ii3tys m umn s;u) eerxrcia1lat au i t0 2trxo3ny4olee fcias)aDtax  ot0tlx mociyslaDelnvpnt)texomf3iodoaDeaivs s0 2xmxm iudomenmfvsltfsrtmxm ;u4oltnio3iysfs2ea( s t4 rtomo oadlaDr ueo;()seurxm oo4opt mnvtatfs2uaumpoo0alx  ictysfa rlu s;u4tlxrmrciy1omDe n s;(0srum(o3nydlme mfvi sf Duax  ;o4oee  oeiysfm elnmo;u0 exnxf3tadfmDrluvi;( srtmio3oo1openlncilt arrax  ;u4teen iciytfmDrmnvo;()aeenmr tytla e ueils0teurio oo4ap  licta(f Draumpou1tptnmi3iltfa umump;(4 ltoio oadfa r nei;s)t2trxmpoo4oltnmnetltfs2uaxrpnt4olxn icils s umnmo (4altomo todomtrli il( sexmim ny4lle mfesl(f 2tmxmp;o1opx ifeils a rmu sn(0alxrmrciy1laDrluvils0 rxoxmpoo4ll elncilt  rtrxm ;o4opt  feiltla2emnmpnu4 lxomo3totfmDr u o t0 2toirpoy4ol  mfvs s)aDra(r no4texn octyt aDrluvo t4arxrmr ty1fa r ueolt truoir oodll   feil(  rurxrono1tetnmieiys m2rl( snt0areoxocta1om rai o;s setr(mpno1apt mivs (fa2rmurpno1olx  oeiatfmDrm( sn(0trtrmo io1lpDrlnvi ( t2umir oudlmtemfci s)s2ua(m ;t1tpt moeilt m ulump;(0 lxrxrcoydfpDelnei;s0trumxopoy4op   ncil( s2tm(mpou1tptn oeiatls uanvs;u) exoxf3oy1fp eanei;t) exrio3oy1olen iviltfs2rrum nt1aexomociat sDuluvo u4aeerxr3tydoaDelu i;s)srxrirpiodopen ietatf Dumxmont1tleomoeiadfa raump t4tltrxfciotla rln sl() exoxr ou1amee ivsa()s2rmx pno1tlt mieiadlaDelnmsnu0 lenmo iy1om rlu ol(0 2xrxo3iudlmt mfviat  Durxrono0apxniociadlsDulnvs (0trerifcootlmD luvo s)s2ur(m nodll nlnvt tfa2trumo;t1tpenmietls s2rlu s;u4 rtrxfcoa1laDe n i (0tetmxopou1ameelfcs tf 2umuro;t1tlxnifctlsfa2uln o;(0 ltoxocoadomDelivi s)trxoim3iudlme mnctls aruru  nt4olt  ocildlaDrmn ont0trermo3iadfm raieo (0setmiopno4lltelfesasf rta(mp;t4apxomfciat a ul(mp;u4tlxnxrcia1omtrlies;t) 2uo(r nudlme mfvtl( aDtrx pno1alxn o3iadla2emnmo;(4altrxrcia1lmte n ils0 rumxm3oy1lpe lfeiltfarumum ot1texn iciadfa el(mp;t4trenxfcty1omDeluvi s) euoxo nydam nmfctl( aDraumonu1teeomoetatfmDuau p t0tleomr totfa r ues;s)srur(opno1al nmnvilt)s2tr(moot4tptoiociysfsDua(mp;t0 exrxfcootop   uvo;s0 2urxm io4am nlfvsasf rtm(mo;o4tpe ifeiatls ranmo;u0 reomf tytfa  luvi;s0 etm(rpiudap nmfcs t)arrrx  nu4ape ifctls a ea( s;u)alerxrciatlm eaivsl( s2xr(r3no4aleemiesat a2urxm nu0opx mfetyd a2uluvsnu)alenifcta1op   ies;( t2toxr3io4lpte ietl() Dtax ono4aexn icilt s2um(mp;u4tlxoif oydlptran sl(0srto(mpiy4omte feils) Dtrur nu0tltn fetasfsDuanvs;u4teenif3iydfmD lnei s0setoxm oydome mncta(  Dtm( pot4alx  feiltfmDeln p;u0tltrmf3oatlaDelnvo;s)trtr(r oudom elnvi s) rururooo4aeeoiictaslm ra( p t0alxomo io1omtr ivs;s)srxo(o3nu4lptnlictltfa2tm(rono0olto iciat m2rlu s;u4texrmr ty1laDranvs;s0t2xr(m3nodaptnlnvi ( s2tru pnt0apxo ictysla rln o t)aexoio tadfp e n il(0t2xoiopoydap elfcia(fsDrr(m oo4altn o3iadfs ra(monu) rerxocoydoatranvs t texm(r3iydom n fvil() 2taumont1optn iciatla eanms;u0teeoircoadfate n s;s s2xoxm nudop nlncslt  2ua(rooo0tltnmieiys a2rluvo;u)artomo tadoat aivi;t0 ruoxm oy1optnlietls sDuax  ot4ole mietldfm2eauvo (0trtoxr oatopDe i ilt) etmimpiodlptnmicsl(fa2ua(moou4tptoiieild m ranvsnt0 lxoio3oodlmteaies () 2to(rpnydal elivias  2ra(rp;o0oleoifeiasfm2elu ont0 leoxo ty1lat anei;(0srxoxr3oo1lp nlfvt tfsrtrxrpou0aet  ieiltla ran s t4artnirciy1fpDeli i;(0t2xrxm no4omt miei t  rtmx  ;t1oee ioctldlm2ean s;t)aleomf3iatop rluvs s0trumir3no1lleemivi sfa2ua(mont4tpeomo3iydfs2eanvo;u4 rtomo iy1fpt au il() 2urimpoydlmt lnet ()sDrm(rpoo4apto ictadfmDumn pnt)areoxr ty1omtranvs;(0tetoxo no4lm n nvta( a2ta(mpot0alenmociydlm elnmsnu0arenio3oadfmtr n s;(  2xr(opnu4om  lfvtls)sDrm( o;u0oeeoiociatfs2rm(mpnu4trenxf3iy1om e u o;()teurimpnu1omtn ies sfa2trum ou4tlx io3iydlm emn pnu0 etnmf3tadoptean s t0 exm(opnodomt mieiat)srum(rpnt1aptnmoeiadfm raumo;u4tlxomr to1fatr i ilt srtoxm io1ope lfcs t aDua(r ;u1tltomoeiaslaDeln p;u) rerif iytlmDrai slt0t2xoiopio1op  mfcils srraurpot4altoioeiys m uanmp;t)aeeoxr3iatomDelieo;t0 rtm(o iydaptemics sfsDtrum ;t4olx iieilsfm ulnvo;t4aexnxr iy1lpte u o;t t2urim3iu1ameemiet sfa2taump;u0opeoifctaslm umnmonu4 ltnxf3oy1oaDeli i;t t2xrxrpoo1ll  lncils)artr(  nt1apxn ociysfsDrmuvo;t0 rxrif iadop  ai o s)setoio3ou4altelicsat) Dumu ono4tetomf3iadfa2rmn sn(4 lenmf ia1la r nvol()srxr(m3iydope  nvtls  Duru  no4apto ict
\ No newline at end of file
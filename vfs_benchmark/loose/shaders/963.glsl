@@ -0,0 +1 @@
+iei;()s2ur(o3iudlm  mivil(fsrrrx pnt1oeto oeiatfsDuluvonu0 lxnio3iatfaDr ieols sruo(r3io1lmtnliciasf Drmumo;u4oeenif3iatfm rlnvonu4 reomo3totom rlnei;(  2tmirpiu1lptelfvsa(  Dtaurono4tpxoiietysfaDraump;t)texnioctytoaD  i il(0 exoir3io1ol nmfesatfsrtm(roou1tpx mf3iadlaDelnmonu)aeenxociatlm   u s;t) exm(o3nodlltemietlt)sDum(r nu1tpen o3iysfs ul( s u)treoxrcto1laD  uvils0t2toxr3iu4amtelivilt)aruax  ot4oetomi3ilslaDumn o u) etrxr tydlm rli o t)t2tmim nodapenmivtl(fa2tmxr oo1apt mo3iytlm umn snu4altrircoydlaDe nvo t0 2umxo oo1oleemivsas aDtau p;u0apxnmictasfs2ranmp;(4alerxo tadfp eli o s)setrxopnu1lltnmncs t sDrrx ono0alto ieiyd m2ea( s;()texrir oo1fm e neolt)t2xrxmpnu1lp e fvtl( aDurx  nu0tpx ii3taslsDem(vs;u0trxnmo tatlmte ivs;s  rxoxo iy1ll  mnvtat)a2ta( onu1tex ioeiyd s uau pnt4arxrmocoytlp r uei (0t2tmim nydame mnes (f 2tm( ooo1alt iociysfa ulnmp;u4alxrmo oodom raueils0s2xmxr ny1lptelivs t  rua(r ;o0aexoii3ilsla2uluvp;(4 rtnxo3iy1fat  nvslt0trtm(m nu1ll n ncia(faDururp;u0aetnmoeiltlmDulu o u0tetnio3oa1optean o;s)srxoim3nydlmtn iei t srtm(  ou4ole ioctas sDem( p (0 rxoxf3to1omDeai ilt0t2xo(rpny4lltemieta( s2rrxr oo0aexnii3ilslm rau p;u4aeerifciodfp rluei s0 ruriopoydam elivt ()arraxm ot1olt iieias s ra(vpn(4alxnir3oodfaD  ivs t)srxmim nydlltelivsl(fartmu onu4oleomo3iatls rmu p u4aexrxr3tatoaDean o t seumirpiu1lme mncsat)s2um(moou1apxn i3iadls2ra(mpn()tltrxocto1lm   nvi s trtoxopoo4lmt livsa(fa2ra(m ou1aex ii3ilsfsDuluvp (0tlxoxo oo1lm r i i s0t2uoxo3no1lp emfvi t)s2uau pot0teen ieiatlm emn s;u0 reomr3iydfpte nvsls) rur(rpoudlmtn neiatfa2ur(moou4oeenif3ild a eanvon(4tltrifcoo1lm   n ilt srumirpnodapenlivia(  Dtrxmp;t0aptoiieild sDrm( pn(0 rerxo oatfmDr i s;s) exr(o3no1om nmfeilt aDum(mpnt4oeeoio3iasfaDelu p u)alxnmociadopDrlues;s0t2tm(m3oy4opt lnesas)srtrxro;o4aetnioetydlmDuaums;t4 lxrirctatfp   n o;t s2tr(mpnydope mfeiatf 2ra( pou0tlto ieiatla ulu s t) lenio ty1omDrluvs t  rtoxo3ou4open ieil(  2tm(  nt1optoifeiytlm2emuvont0 lxoxr oatfa eauvo s0 eurxopiu1lm  livt s)s2tmu ont1tle ioctysla rmn sn()aexrifcto1omDrlu i;s0s2xm(o3ny1altelivt sf 2umxmonu4oeenifcildls ra(vpn()tlermrcty1faDrlies;s)srurxm nudoltnlfeiltfaDta( ono4opx  fcildfsDrm(vp;u4aleoxo3ia1oaDeaieol( s2urxm3iy4lp e ncsa(  rurxmoot4ole  ietas a2el(vo;(4trtoif oytomDelneo;s)tetr(opiu4ll elnctasfsrum(  ;o1oleniictltfaDuaumo;t) eeomr3oy1lat lnvo t)trto(rpnodlmt mfvias arurur no0ole io3ias mDul(mp u)trxnmo oodomteaueil(0setm(m ny4am elfvias srrr( o;u0tpxn fcildls2ean p t)tlxrmr ia1faD auvil( seum(o nudlpe lfetltfsDrr(root1olx miciltlmDrlnmont0trxnmf3tytfm   neo s0 2um(r iu1lm emneias  rtrxmo;o1oee  oeiaslm ua(ms () lxnxrciydopDeli i ( seum(r3io4ale lietl() rrau o;o4alenmf3iytfmDranms;t) renio oo1omDrai ols  2tr(r3nu1lp   ieta() Duaumo;u0oltoiocild a2eluvs (4 ltrif3todoptrlivo;s  exoxmpoudamtn nci ( arraumpoo1alto o3iysfaDrmnvp;u)aetrmf3totop eln o;t) rxrxopnu4apenmfctlt) Dtaumonu0oexnmf3tldfaDranmsnt0aetnmo3to1fmt ln o (0trxr(m3iy1ale lnci (f rtaumoou4texoii3iadla el( p;t) lxrmr oatfmt aieilt)s2tm(m oo1lle miesl( srtax pnu1alxnmociat m rm( o;u0 rerxociydom  lneil(0 2toir3ny4ap nmfvia( srrmxro;t1tpeoii3iad a emnms;u4 ltnmo3oo1lm elivo t0t2xr(opiu4omtnlnesas a2rmxr nt1tpxnioeildlm uanmp;u4altrmr iadomD luvslt t2xmio3nu4optnliesl(faDraxm no0apx miciltlm uau p (4 rerxocoytlpt anei s0 2um(r3ou4lptelivtl(farraump;o1tlenif3iys mDranvsn(4aleoxociytopDrlneslt0s2uo(mpio4lmen icta(fs2rmxmpoo1tle iieiydfm2uanmp;u) rerir3iodfateaueo ()srur(mpiodop  miei t) rumurono0tlxnif3tld aDelumpn() eenmrcoa1optranvs;t)trtrio3io4lptnmnvil( aDum(ronu4tpe ifeildfaDemums;u4 lxrmf3tytfmtrlneolt0t2tr(rpny1aptnmncsa()sDumxrp;o4aexoifciys s2uln p t4tlenmf io1om  au o s)teumxmpny4lmen feil(  2uax o;u0aee mfciytfm2rl(mp;u0 rxnioctatoaDr i sl( s2xm(r iu1ol   ncils sDtrxro;u4tpeo fctysla rl(vo u) ltrircia1lptrauvi;t0 etm(opiu1am nlnvs ()sDumu oot1oee miciltlm umuvsnu) exriocio1optelu sls) rxr(mpiu4am e fesat)aDrmxmoot1olxniieilsfa umu p;(0 rtnxo totopt aivsl()s2uoim iu4lleelfctl( s2ta(mo;u1aeenif3tatlmDrluvs;u0texrir iydfa rlnvo t)tetoxo no4lpt mnetas)a2um(  ;t1apenmfetysfm2rl( o;t0arenmfctytlatelueol(  2xmxr no1om emict (  rra(r oo1tle ifctltlmDemums;t0aetrif3oo1oat  u sls0s2xo(m nu1llt lfcil(fs2ur(mpou0optnioeiltfa2ulu on(4aeeoxo tydfmDrlivi;t) rurxmpnydol n fvt sf ruaxmp;o0tlxomoeiysls2rmn o;u4alenmf oatoaDrlieo;s0t2tmiopno4ll e ict s)a2rax pnu4apeniiciysfmDrln o ()treomr3to1omDran ils) 2tmim3oudamtemneiatf Duaxr nt4tet  fciytlmDea(vp;t)aetoircoytoa e uvo;s0t2um(mpoydoptemfetasfaruax p;t4tle  i3tys s2uaumo;(0tetrmo3iatfmD lu ol() rxmim oudalenlfcil(fsrurur ou0tpx  fciydla uluvo;u0 lxrifcoydfateluvs;s0 rxo(r oudalen nvs s)arumxr ot4aeenmociltla emnvs t) lxomocoo1optrluvi (  euoxo ny1apeelics tfa2uaurono1alt  ictlsls ea( s (0tetnio oatlat  u i;s)trxr(o nydaptnmfci ()s2trxrono4tpeo ociytls ua(vp u4tetnmf iytfp  livslt seur(r ou1opt  nvt () 2rmxmoot4tpt mictyd s rm(vp u4trxoif todlpD  iei (0srtm(mpiy4ameemicsls  Drau pou1opto ieiytfm2ul(mp;t0 ltrmf iadlat  nei s0 rtm(opiodom   fcs s) rrrur ;u0aex io3ilt s uanvon(0artomfcty1opDrluvs;s) etriopoo4amenmfcsas)s2urumpno0opeo oeilsfm2em( p;t4alenmrctotlmtelues;(0srur(mpiy4apen nctasf rrr( o;t4alxnmfeiydlmDua(mpnt4altrio3tadfaDe ivo t trto(rpny4alt  nvils)aDuauro;t4oltniietydfmDrmumo u4aetoxocoa1laDeln o ()trxmirpno1lpe  iesat a2tmurpot1olx iicilt mDrlnvon()trermr3ty1lmDeai s;s0sruoxo nudllt mnesa( arrruronu0oeeo o3iyd a umn o;u)teeoir3oodfmD  u i ( s2to(m nydole mncs ( aDurxmoot4tpx mf3iat aDran pn()aetriocootlmD lu ols0setm(o3nu4lp e nci ( aDtmu pnu1oex iieiaslaDelnms;(0tltrxocoatopD auvs (  2xoim3oodlp emfcsat  Dtr(r ;t0aeeomfetldfa ranmo;u0texnif3iydoa e neolt) exrxm3ou4lpenmnes tf 2rmuroou4tet ioetldfaDeanvont)tleoxrciotop e nvo t s2xoxr oodlm nlnetls  2ta(mooo0tex iicildfsDeluvsn(0 eenio iy1oa  lneilt)texoxo iu4lmt mfctltf 2taxrooo1olxniietlsls rlu pnt4teermr3oa1lpDean sl(0 eumio3no4op e iviat srra(r ;o4tpxnmiciysfm raumpnt4trtnmr3iydfmtrlieo;(0t2xoim io1lm n fvtlt)sDrr(r ;t0tlxomo3tlsfaDra(vpnt0trtomo ia1op e i ilt) etmio3iy4lm n fvslt srrmur no1texnioetldlsDem( s;(4 eenmrcoydoa rlieolt0 2toiopiudal elieia(fs2uax  no0oexn o3tas m2ea(vpn()tlenmr3iatoa r ieo s0s2tmio3iu1altn nvi (fsrtmxm no4oltomieiatls ea( o u0trxoio3iydfp r uei t0 2uriopio4op elietl( arra(rono1olxn i3iysfm em( p;t0aeeoxr3iytfp e uvol(0s2xo(m3nydol   fvsa(faDuru  nu4ape mociltla rau p;()tetoircty1faDrlivo;t srurxm oydom n fvtl() Drru pou0olx io3tydfs2rlnvsnu4altnmf oo1lpt  i i;s0 2tmxm iy4al nmfvt t s2uru pou4aeeo fciyt a ean o u0artoxf oa1fp   uvo t)srxmxo oydole  iesl() rtmx  ot0oeeo icild mDrluvs t)aetoxoctydopDeaieo s0 2xrxm iy4opte fcsasfsDtrum nt0tlxnmiciydlaDrlu p;(4aexnxf3oo1late ieils0trxoxm3iodap nlfesa()arra(rpot1ale miciad m2ua( s;()aeeoxr iy1lpDe ueils  etr(r ou1lm emivi s sDuau oot4alt mi3iat s emuvpnt0artoirctadlaDe n i t srxoio3nu4optnmncsatfarurumooo0oexnmociyt mDul(ms t4 exrir3oatfpt lnvils)srxoxo no1ame mfvsl()srrau  no4oleomietas sDrmn pn(0artoxo3to1omteln i;(0t2umxr3nu1openmics s)aDumurpou4tex mictad m2eluvo;t0aexnxrcoy1optrlivsls)texr(o ou1oltn fet tf rrr(rpou1olx mfcildla rln o;t) exrmf3oydfp ranvilt)s2xmxopoy1lme mnet s)aDtr(moot0olto iciat m emnvsnu0 exnio3ootfp eln o;( trxr(opio1alte nvtlsfsrrr(rp;o0ape mf3iat m uln pnu)altoxociy1fmt  nvo;t0s2to(r nudllee ncs tfaDtru oou4olenio3ilsls2rmu s;t0 eerirctotopDrluvs;s truo(m3nudll nlies sfsDumum nt1open o3tydlmDrl( p u0tltoiocoodfmteanes s0 exo(o iu1aptn nci tf ruax pno1tpeo ociydlm2ra( on(4 rtrif iy1lpDrai i t0texrir ny4ll e nvi sfsDuaumpnu1texnioeiyslaDeaumo;t)artrxo oodlmtrlivs t0 eurxm oydopenlfct (fs2uaur nu4olx mf3iadla um( s t) exrxrciytoaD  neo;( setoio ny4amenmncta(f Dtrxrooo0aet moctas s rm( o (4 etnmo iatlmDrli s;s setmim3iy1omte ivi t srrrxroou1optniociltfm2rm(vo u)aleoxo iodoa ran o (0 etm(r iudol   ics s)a2ta(m no4teeoii3ildlsDelnmpn()alenxr iodfmD an s;t0srumiopio1lm   nvtlt sDur(ront0olx mi3tls mDeaumsnu0 eerir3tydlaDe neil(  rxmxopiodop elfvil( artmumo;t4aeto i3iytlm umn p t4texrxr3iatfpD aivs ( texoxr3iy4om nlivta()artmu pnu4oexnmiciltls ra(von(0trtoif3iytopD  uvi;t sexmxmpio4ol  mfctl(f 2uru o;u4opeoifciat m emn snu)areniociytfatelieo;s s2ur(o ou1lpenmnvt tfarrm(r nt1olt mocildfaDrmnvo t0aexrmf oodop elieol(  2urxmpio4oltnlfvtas aDrrumo;o0tpt if3tltla rau ont)tetrxr oydomDraivi s0trxrxr3iy4ape micil(fa2rru o;u1aetomo3iytlmDemu pnu)altomocootoa rau ils0 exo(m3iydlmt lieiasfaruau pou1opt moeiydlm rmn p u0 exnmfcoa1fp raieil( t2umxrpiu1al  mfvsat) rraurp;u1apx mfeiyd m el(vo;t4 eenir iytomtelivo;(0t2xo(mpiu1lp   fesa(fartax  oo4tpt iicild aDranmo (0aetnmf3iotom   u i;(  rxrirpou1ope mfvslt)s2tmumoou1oeenmfcild a2rmnvp;t0trtrif3oa1oateluvi;t)truo(o oudlp elnviltf 2rm(m nt1tpenmocilsfm2rmnvp u) ltnioctodfmD  iei;t) exoxopio1lle mnetl()a2tru  nu0tex ifeiadfaDulnmsn() leoif ootfpt  nvi;(0 eum(m3ou1lm nmfctas aDtmxr nu0tptnmieilsfsDua( pnu4 ltomf tadomte nvo;() rxr(opiodameemfes (  rurxrp;o4olx if3ilsfs2uanvont4arxrmr3to1fpD au s t seurxrpoy1ope  fcsa( a2tmx  ;t0opeomo3iys s uanvon(4trxrifciy1lmtranei;(  rtr(r oydomt  nvil(faruru  ;t1optn iciyd sDra( o;t)trermr3ty1opt an i ( setoxrpnu1lmtelnvil() 2umxmpou0tpxnmieildla2ul( snt0 lermf oy1latrlieo (0 rxo(m nudamtn fvtl()srtaxmpot0aex if3tlsfaDrm(mo;(0tltoio ia1laDr i o t  2uoxmpou4am n nvtatfsrrau pno4tpx  f3iad m2rm(vo;t0tlxoif tatom r ivils0setmxm3ny1ol emfcs (fsDraurooo0oltn oeiytfs2um(vsnu0 lxrmfciadoaDelnesls t2tmxo3oy4aptnmnvsa( sDumxmooo4tetnii3ilslmDulnmsnu) etnxo iodfpteaieils) exmir iu4aptemivs t srtrxr ;o1aetomociyt m2rmn snu) lerircoadoa  aueo ()srxo(opou1apte fvslt)arrmxmp;o4oetnmfeiytla2ua(vo t0aeenxf3ty1oaD au s t s2tmio io4lp e nviatfaDtrxmo;t0apeomfeiyt aDrlnms;(0trtnxo oatoatrlivi t  2urxm3iy4lmeelfcs t s2trum no0tle mo3tld s2rmn ont)alxnif3iy1oaDrlnvsls)s2toiopiudopt lnesl() 2ta(mono0apt mo3tls m ean s;(4aexoxo3iydfa raivo;s s2trxmpiodomeemfcsatf Dur( ooo0oetoifeiadlsDuluvo;u0arxoio3tydlpDrlnvo;(  2xm(m iy1ameemnctasfsrrmuronu1teenioeiatlmDum(vp;()trtnio iydomtrauvs;()seum(m ou4ope micsasf 2tax o;t0aee miciltfm elu snu0 eenio3iodfmDrlnei;( s2uo(o3iu1aleelnetl(faDra(m no4alt ioeilsfa uln s (0tlxnxfcoatfpDelu ils) 2xm(opnydamee fcs t  rrm( ont0aeeo fciad m emu sn(0 ltoir3ia1omDrln s s teum(mpnydomtnliei ()sDurx  no1tltnmocilsfmDemn o;t4 eenmocoo1fpt lu i s)s2xmxopnu4apen nes t sruau ono1alx ii3ilslaDrlnvp u)artoxf oo1laDelivo;( t2xr(o3iu4aleemnctl( aDuau ono4opxn ieiatla2emuvo;u4 eerxo oadoatraneo;t  2xrxr3no4lp nmncta( s2tax pnt4teenmo3tyt aDrl(mpnu0tetrxr3tydlp rauei (0s2xoimpio1am  miei sfa2rrxmpot4optoiieilslmDuanmo u4 rxoxr3oy1omD li ilt) rtoim iu4lmeemnvtatf Draxronu4tptnmi3tydfs eau on(4alxoirciytfpte n s ()t2umxmpou1lm nlnvsasfaDrau o;t4opx mociytfa2rmn p;t) etnir oytfpteli o t)seuoimpoy4lmt  fct s)srra(mpno1apx iociaslmDuau s;t)aexoifcoy1omteanvo t  2umimpnydolen ics s)srumum ou1aeto fctydfs2umumsnt4aetrxf oodlaDrli o t s2tm(mpnodlmeemfct t) rrmxm no0tex ifetaslm eanms;(0tetoxfcoydoate iei;s0srxmxm nodlp nmiviasf rrm( oot4oet iociltfs2rmnvp;u)tltnifcoytlp rlu s s)srtoio nodlptemivi tfarua(ro;u0tlt iociydfaDemums u4aexnif oatlmD ln ilt0 rumxm nodaltnlnvtas) ruaxm oo0altnioctldlsDra( o t)arxnmf3tadlpteau i;(0s2to(r3io1lle  nviatf 2tax  ;t1optnifctadlsDemnvon(0arxnircoo1lpteanes;(  2tmimpiudal nlfctat) rrrum no0tpt ii3ild a2eluvp;u4 rtnif3oatla   nvo ( teuo(mpnu1lpe mnvtlsfa2taxrp;u1tet ii3ildfm2uau s;(4aetrxo3tadlpt ai o ( trxmxm3nu4lp  miesls a2tmumpnt4oet  o3iyt a ua( o;(4 lenircta1laD  uvil()trto(o3nu1omtn fcsa(fsDtaurp;u4alxnmfctltfs uanvo t4 lermo totla  ln i;t trtm(m io4open ivslt) rur(mpoo4oexomf3ils a rlnmp;(4alxoio3oytfaDe iei s) rumxo iy4lmenmivtlt  Drmumooo1teeomieiat sDeanmo;(4tlenxo3ia1lpDr i o s  etmir3iu1lle  ictltf 2tr( oou4ole  o3ias aDua( onu) rtnxo3iy1lm  luei;(0seur(opnydalt  iviasfs2taxm ou4oexnmocildfaDeln s t0aexrmf oy1fp raivo s s2uoxr iy4am nlivias)sDrmurpoo0aetn fctldlmDuanmo u4 lxrif3oytopD anvo ( truoim3oydop  livi t) Draxmp;o1oetnmictltfs rlums;(0texnxr ootlate uei t)teurxrpio1lp emivi (faDumxm nu1apeoioeiydlmDemn s;t) lxnmf oy1lm   uvo (0seum(m3io1lpt livia(f rtmum ;u1apxn ociysls ulumpnt0 rxomfcta1lpDelnvs (0 2xmirpiudlptn nct ( s2rmxm ou0aexn feiad m2emn snt)tlenmocoatfa  anes;(0t2umiopnudlmee fvta(fs2rr(ronu4olxn ictytlm2raums;u0 etrmfcta1op eaivs;s  2xmir oudoltelncslt sDra(  nu4olxnmictadla um(vp;u4aexnxr to1lmt  ivsl(0t2urimpiu1lle lfetatfa2uau p;t1olx ii3iaslm rl(vo;t)artoir3tatlpDeaivsls)s2tmio3iudlmen nvi () Duaumpot4oet ii3iytlm2rl(vpnu0teeoir3tydoaDr nei;(  etmiopno4lpenmnvt () Dua(m ;u1alt mfeiyd s uauvp;() lxnxr3tytoat ai s;t)srxmiopiodal emnciatf Durxront1alxo feiad sDrl(mp;(0tltnmocoadla r n i;s teum(rpnodlpe  ici ()sDtrxrp;u0tlxn ieiytfs2ulu p t0aeerxociatlmDraueo (0 rurxr io1opt mfeiltfsrumu pno0tee ii3ildlm uaumonu0 lermr3iodom eaivo ()srum(o3oy1ale  fct (  Dumxm nt1tpx mi3iyt s rln p;t) leriocto1fat li ils)t2urxmpio1ope mnvi t)artrur ou1olx mfeiadla2el(mo t4 rtrmo tydfat livolt srxo(o3oy4lmen fvsl() rrmu  ot0tpxn i3iysfa2rau o t0trxnmo ta1oa  anvil( srtr(o3oo4lme livilsfsDumuro;t1olxomfeiat mDemnms u0 rerxrciy1fat anesl( trtoiopio1ol  mivt s)sDumu  no0apxomfciys a2rmumpn(4 eerxf3oo1fm rlieo t) exmirpiy1lltnlfeilt) 2ta( onu4tpto i3iltls em(msn(4tltnxfctadlpt lu slt)trur(mpiu4lmtelivsls)s2rr(mpoo1teto f3ils m2elnmo u)altomfcoo1lmDranvo;t0trurxr oo4ll nmictl()a2rr(rpoo4ope iietydlm2emums t)trxrxfcootfatr i s;s)setrio3nudol nlivsls) Dtrxrpou0oeen i3ilt s2ulnmon(4texrmf tatom r i o () 2tr(rpoy4lp nmies t) rtmxrono1opx  ictld s eanvp;t4trtoxo iotoptr neo;()srxrir3iu1openmiesl()a2tau pou0apx  f3tys a2eluvp t)alxoxfcoodfp eaivs t srtmir3oydalt lnvsls  Dumumpoo4ale  ietad m eanmo;u0areomo3tadop eau s t0 exoio3nodopee fet (  rum(root1tle mietytla2ea( sn(0 rxoircoydfmte uvo;(  rtm(mpio1ll nmfvtls)aDtau pnt4teenmfetltfa rmu pn(0 rtomrcia1omt anes;t) rumim3ou4ameelnei s srrauro;o4ole  fctytfs rm(vs;u4artriocto1op eau ols  exmxrpnydom   iei (  2tr(monu0openif3tyt s eanmo;t) eeoir oodlm e ieilt0s2xmim3oodopte fei () ruaur ou0aex mieilsla uln ont0areomrcto1fptelueo;s  2tmxopou4alen net (fa2urur ou0tex mfctlt a uanmp;t) eeoio3iotoa rln o ( seumim iy1lpeemnes () Dtmxr ot1tptnmo3iysfa umnvp;(4tetnmr oydfat  u o;t trtmxr3ou4aptn ivil()a2rrxroot4altn fetyt m el(mo;t4trtnio3oydfmt li s s) rxr(mpiu1om n nvtlsf Duau o;o0alxnmfeiydfs2ea( o () rtoircto1lm  aivs;t0 2tmxr3iu4omte iei () Drmxm no4oexnmociys m emnms;u)tltnifcoo1lpD  n o s)srur(o3nudam e fcta()srtrx o;t0tpx mo3tlsfsDem(vonu) rxrmrcto1lm r ieslt0 rtoirpiu1ope mietls)sDtau ooo0oexomfciatfs umuvs;(4alenmr3ty1lpD auvols)t2triopnu1altnmfetas s2raxr ;t1opeomo3iysls2ulnvp u4 rxnxf3oadfp raieo s0trtoxr iodaltemicsat  2trx  nu1alt io3ils m rm( p;u0teenif3iytfpt  uei s)truoimpiy1altnlnvilt s2trx ono0tleomicilsfsDel(vo;u)trermociydlpte ueo;t sexo(mpiudlm nmivt tfs2urx pnt0olt iietltls ra(vp (4 exnif3iydfm e ivslt srxo(o nudol n ivs tf Dur(moot1optoifeiytfa ea( snu0 leoio totlpDrluvo t0t2uo(rpoydam  lnciltfarra(ro;t0oeenmfetad s rmuvp;()aexoir iydom  aivi;(0s2xm(mpoy4lmen neil(f 2raxm nt1tet  ictyd a rmumo u0tlxrmocoydlpte ueols) etoir oudlptnmieiat sDtaxmpnt0aeenioctat s rauvonu4trtnif iytfptr uvo;s t2tmim iydolee nci sf 2tru poo4aex ifetatfm2ua( o t4 exrmr3iydoate n slt0trtmxm nydamt  net sfsrraurpoo4oltnmi3tytlaDran snu0tlxrxoctodlaDelneil() rurim3iydlm nmncil() 2ur(r ;o1tleomoctadlmDrln o u) eenxfciy1fptrlueo;t0t2toxo oydamt mnes tf rtm(  ot1tptomi3iatla2rmuvs t4aexomrcta1oateln o t)tetoxr nodomtemictatfsrur( pou0oleoio3iyt a ua( p u0trtrmf iodfpt ai olt)t2xrxo3oy1olenlfet ( aDtax  oo1tetn o3iatlm uanmpnt4 ltnxr tatfat anvs t texo(mpiu1llt mnetlt)srurumooo0olx ii3taslsDum( o (0alenif iy1om  livo t trtrxr3oy4lp  lncsl()s2urx onu4aeto ociatlsDemn s u)arenxf3tadfmtrlnes ( truo(rpny4omtnlnviasf 2umx p;u1alenmi3iatfm emn p;u0aleomo3iatfm elieo;(0truo(o3oy4altnmfeslsf Drmu o;o4optnioeilsfsDum( pnt)trermf iytlp e ivs t0s2xrimpio4ol   netls sruru  ;u1texnmfcils s umn ont) etrmociydlmDeaneols)srxmxo ny1alen neia( srta( p;o0tpt mf3iasfsDra(mo t)aleomrcoydlp elu i;t)seumxo iy4om  mnciat)srrm(rooo0tpen ociadla2umu p u)texoir tatfaDr uei;()tetrio iy4alt lfesatfarra(m ou0aetn oetldlm ea(mpn()texrmr3oodfmDeanei (0t2trimpoodopt  fci (fa2rmurpot0opx mictltls2ea(vo t0aetoxfcoo1lmD  u i () 2xrxopou4ale  nvs (fs2tm(mono1tle  ieiysfa2ulumon() ltomfctadoat  nvols) eurxopnu4omte icilt) 2rr(mpno1tpe  ietatlm2elnvont4artnmfctodlaD  ivo;t0trxm(r3no1lpt mietl() rrmurpnu1opt mi3tltla2uanvo u)artoxfctytfpDranvo t  rur(rpnudal  licsl()arrrumoot4olxniieiadlsDrauvsnu0altoif3oytlpDraieo;s) 2xrim3iy1amtn ieia(f 2tr(ronu4alxo fciytfs rl(msn() exnxr3todfm r ieil( s2urxr iydopte nvslt a2ta( pnt1olt  ietytfm2rluvpnu) lxomf3oydfmtrln s;t srxrxmpno4lmenmfcils)a2umx  ;t0apeomfcils s umnmo;(4tltrmo3iydlp raivo;(0 2to(r3oy4ope lfes sfaDur(m no4tptomieiadla ra(vp ()texnmo3ty1fa  lies;(0 rtmim3iy4oltemfeilt)artm(mo;o0tleo oeilt m emnvo;u4arxoir iatom r neo;s)t2xmxm io4opt  nvia(f rtr(mp;o0ole if3iltlm um( s t)aetrmr tatomt  uvi t0 2xmir no4om  livilt  rumur nu4apeoioeilt m eanvo t0 ltomo iydomt lu i t t2trxm nodomtemfeils sDrmuroot4aleo octltfsDranmsnu0 etnmo iytopt anvi t0trur(r3iydome  fvi (fa2rau p;o0oeeomoetls m2el(ms t) eerifctotopDrlnvslt srtm(opiydolee ivt t) 2rr(mont0tet ifeiytls2umn pnu) lermo3oatfm raueo;( s2xm(o3no4altelfes ()sDrm(r nu0oex iietat m2eaump;() lxoxo3tydfat aivo (  eum(m no4aptelicsasfaDumxmo;u0tpe  f3iaslaDelnmpnu4tltoxrcoadfmtrlivs t)trxo(r3iy1lpenlivs sfaDuaur ;o4oltn f3tadfs2uan p;t)artnir iatop e nvs s0srtrxopoudlmenmnesas)s2ra(mo;t4tetnif3tlslm uan o u4 rtnxr oatlp eauesl( trumxr nu1omt liei tfsrumuronu0tlt  iciys aDrmn s;u)teenio ootfm   i o t0trxo(r ny1ll e fcilt)sDtm(moou0openif3tlt m em(mo;(0 rermocoy1oaDeai s;s)trxo(r3nu1lm  liviat)arrrx ooo4oltomfctlt m em(mo t0 leoif tadfaDr i ils0 2uoimpiy1lptnlfcsa() rrm( poo4teeo fciltfsDrau sn(4alerio3iatlatr ues;( t2xrirpnydoptn ncta()aDrr(  ;o4alt moetldlmDum(vp;u4alxrxr iytfptrai i;(0s2xrxmpno1llt mnvia( aDrrum ;u0apen ociyt a2ulnmp;()teeoio3iy1lpD aivs s0srtmirpiu1lpe lfvias aDrm(m ;t4alt iieiatlsDelnmo;t)aexnxo ty1faD ai i;t)srxo(m3nu4amteliesls) 2rax o;t1apenmfeildlm rmn o;(4altnmo3iotlaDelnvols0setrxr iu4lmeemncsas a2tmxr ot0oltomi3ilt aDulu p;()alenmfctodlptelivolt  rtrio3oo4opee icsasf Dumuronu1tpx iiciat s em(vp t4aleomfciadla   n o;t)t2uoirpnodol e fct tfa2um(mpno0opxn fcild a2rlnvo;u4alxoifctodfpteaiei t) exo(rpnudal  mnetltfsrururoot1alxnmfeiasls el( s;() reoxocoadfpte i i;t s2toim3iudoltelivsl(faDraur ot1olxniietldfsDrauvpnt)altomr3oydlmDeanei;t)texm(r3iu4oltn nciatfsDtr(rpot4apxomi3iat sDem( o;t) rxnio3iydoaD  i o;()srtoxm3oodlp nlfvilt sDuaxroot4opto o3iyd m eanmo;u0tetomo todlm e i s ( texrio ou4lm emneiat srrmu  ;t4aetomfetas s2ulu s;()arerxo tydlat  uei t sruoxmpoy1opte nvi t  2tmuront0altnii3ilslaDrmumpnu4 rxnifctydopt  neilt teuoxr3ou4oltelictas s2umxmonu4tleo ociadfa2ulu s t4alxomf3iatlmDeln i;t0 euoxo oudol elnvt tfsDtm(mo;u4aeeo ieilslmDem( o u) etoxo3iydfatr uvs;s0 rtmxrpoy1opeemfeiasfa2tm(rooo1tlt moeias a ran s t4alxoir tytomDranvo ( teurir nu1lptemivtl(  2umx  ou0aet mf3tys a umnmpnu)aetnxrcoytlpteaneslt0t2xo(r nudam e fviat)aDumxronu0alx  i3iltla2el(ms;t)altrioctodfmt  ies s0texoim3iy1aptemnet tf rumu o;t0tleomiciltlm ra(vp;(0texnircoadom  livilt)s2xo(m3iodaptemics ()sDrmx oot4olx iieiydla2em(vpnt4alxoxo iotfaD aneo s)t2xmiopiydole lfetat s2rr(  nu0texn o3iatfs2rau p t0trxrio oo1omtean slt) 2tm(m3iydoltelivtlt)a2rmu pot1olxn f3tasfm umuvp t0tetrxfctytla  lu o;( sruriopnudlm   fvs t s2um(m ou4tpxnmfciyd a2uanmp (0altrmr oy1lateaies;s0 2urxopnydal nlfesl(fsrtrumo;t4aptomf3iyslm ul( s (0 lxnmo oa1fpte ivs t0tetoio3oydllt lfesa( aDumuro;u4alto ieiytfm ulnvp u0artrxr ty1lmte ivsls teurxr3oydlltn fvtatfaDrmx pnu4oeeomociasfs2eaumont4trxoxr3todlate nvo t)t2xmxo3iy1lpenlnes t sDtr(m no0ope mfciydfa2ua(vonu0arxnxf oodlpDr ies s)srtmxrpoodamenmnesa()arrrxr ;o1oetoifeiasfsDea(vo;(0trxrio iatlateaues t) ruoxo3ny4al  livs t) Dtaump;u0aptoifetltfa2emuvpnt4trtoxf3tydomtranei;( setmio3iy4lm n nviat artaxmpnu4olt iociydls eluvs u0tlxnxr ta1oa  au ol( t2urxm3nu4ame  ivi (fsDrm( o;o1tltomfcildfs2rl( s t0 eeomociatlmteauei s)setmirpnudamt mnvs ( sDumxm nu4tpen ieils a eaums;t)trxnmrcoydfmteau o s sruoir io1lmenmnvtas sDraump;u4oleomf3ilsfs ulnvp;()arxomf3tydlp eaiei t0s2xm(m3oudop nlivs t)aDraum ;u4tpe  o3iysla2em( o;() eermfcia1fmD li o;s)t2tm(m3iydlpe  fcsasfa2ta( oou1openiictad sDeaums;t0aeeoxr iadoaDrln o (  2xoio oo1ole  netasf Durumpoo1optnmo3iadlsDeaumpn()aexnmr ty1oat  uvils sexrxrpoo1am n icsls  ruau p;t1tetomiciasfsDulnmp u) eeoif ty1la elieil(0texm(mpnu4llteliet tfsrur( ono4texo feils a eanmp t0areoif iotlat li i t)seurio iydapt  neil()a2ra(m ;t1oeenmoetys s ulu s;t) lxrxo tydfptrli i;t)truoxopnu4lp  mnciatf rtmx  no4teeo feiaslm ul(mo (0arenxo3oytfatranvil( trxrxr nudlpte ivt ()a2urx  nt4oeto oeiatlaDea( o t4tltoio oa1oat ai i t)srtrim ou1alee fcia(fsrtmurpnu4tpenmiciatlm2rlumpn(4 rxniociytlat li o;s)s2tmim io4om elncs t  Drau  nu4tee iictltlm umums;(0teeomo iatomDelnvi;( s2ur(rpou1lmtnlieslsfarrrxm no0ole mfctad sDrm(vo;(4altoio totfm  aueo s0 rtoimpiy4olt mfvsls)sDta(rpnt1oetoif3ias a2eauvp;()aetnmo3ootlmtrlueil(  exr(r ny4lpt  fetls)artru pou1apxomoeiyslm emnvo ()arxoxr tatfpD aiei t0 rum(mpiy4amtemnvt sfsrumxmp;o0opxniieiltfs2emnms u0tltnif3iatlatrluvols)s2xo(r3iy4lme  ictls)srrm(r ;u0texn o3ilt sDuanvs;()texnxr oytom rlneslt)trxoio3oo4amtelici s) rrrxm no4aet mf3iatls umn pnt0tlxoxoctadfmt  u o t0seurirpiy1oleemnctl( aDtrumo;u4tpxoif3ils mDua( s (0texnmo totoaDeli sl(0 etrim3iydal   fcsas  2urxm ;o0oeeomf3iadfm2rmuvp u4 lxrxf oo1fa eaueo;t  2toim oy4ome mfvt ( sDur(  ou0alto ieils aDrmnmpnt) eerio todlat  uvilt trtoim iu1optn fes s)sDrax pnt1oetoifciltfmDul( p u4aexnxf io1fm r nvslt)s2uo(mpnydale  iviatfs2ua( oou4olxoio3ild a2rmuvo;u4 rxrxr oydomDeln s;s)trto(o3iy4apeeliesl(fsDrmxmo;o0aeeo oeiydfa2ua(vp;t0altnxrcoydla  livi;s t2xmirpio4llte fcia() rrax o;o0aee iociytlm2emu o u)alxnifcoy1om elnvi ( sruoxr3oy4alt  fvtas)sDra(roou4oee mo3iytls2rlu s ()aeeomfciadlpt lueilt0trxrio ou1omtn feiatfartaxm oo4aetn octadlm2el( s;u4arerxo oodlat lies s)trtmimpno4ameelnvt (  2umurp;o0tpe ii3iytfmDranvpnt4trtoxr oydfaDrauvi;()tetrxr3no4op  lfvsltfaDrmu onu4apt if3ild m2elnvo (4 renmrctydom  an o;s0 exm(o oodomtemivt (farrmumo;t0tpe if3iyt s rl( o u0tlerio tadfa r u o;s)teuoim iudol e nesas srtru o;u4aex miciyt s2rm(mp;(4 leriocoytfpDeli i;s) etmimpnydlm nlivs s)s2urum nu0tptn oeildlm2rluvo ()trenxr3iotfm elivs s s2xm(r nu1am nlnctatf 2rax poo4apxnii3iltls2umnmo;(0arerxo tatoateaiei;t0s2urim3nu4open fcsas)artmxmonu0ape  ictls s2uauvsnu0artoxo3ia1fp elu o;s)sexmxm3oudapenmicilt sDtru o;u0oetoiictlsfs2eluvs (0aexrxf oa1omtelu i s sexmim3nu1amee iciat  2urumo;u4oee io3tysfm2rlnmsn(4alxriocoa1op e n olt)srxmim iu4ap emicslt s2rm(ront4aptnmfcildla rm(vp u0artoxf3oa1optranvs (0s2tmxopou4op nmies () rta(  ;u4ale moeiys m emnms (4 ltnif3totlaD aivsls srxr(m oo4optnliet tfaDuru pno4teto oetldlmDuan o (4alerio3oo1oat lues ( srtmio3iu4lme  ivils) 2tmu pnu1aexniicildfs2eaumonu0teenif oo1opD lnei ( sexoir nu1al  mfci (f Dum(r ;t1tetn feilsfm2emu on(4alerir tadlmteln olt)sexmir3iu4lmtn nvsatf rurxmpou4tlxo ieiasfs2uln snu0areomo ty1fmt liei;t)t2uoim3oodom e fvs sfsDtmu p;u1tpx io3iad a rmuvp;u0 etoxf3totla r nvo s  2umxm iydol elfetltfs2rmxmont0opxn oeiltlmDraums;(0artomfctodoatean o ( t2tm(r oy1lltn nci t) 2tauronu0teeoio3ild m uanms;t0teeniocoydfpDranvo;s0sruoxr nudamt mfvt (fsrtmuro;u4ale mf3iaslsDrl( onu)trermr ia1fat au i s trxoxr3nydolte nvia( srrmx p;u0aetomf3tys s2elnvp;t) rerifcoy1omD ai s s0t2tm(rpiodop emnviltfsDtrxmpot1tpt mociyd aDem( pn(4tlxnxo oatfmD livs;( srxo(m iy1lpeemiciltfa2umxront1ape  o3ilsfs2eluvo u0 lxrir3totopte n i;t0 etmxr io4openmnct s  rua(rooo4ope iictydfs2umuvo (4texoxocoy1omDeaieo s0trum(m oo4lm nlivtas) 2tr( poo0teenmieiydlsDrau p u0aeermfciytomD aivs;t0sexoirpnydopenmfcsa()srrr(  ot0aetoifctysfmDuan s () renmfciotla r n olt0s2tmxm oo4op elivtlsf rrrxmpou1tpt mo3tldls2umnmsnt0altoifctodfm   nvols)seuoimpny1amtn fcsltfa2ra(mo;o0optnif3iad sDelnmpn()teenio oo1lmt  ivil()sexoim3oy4llt mfvsl(  2tmxr ou0aee  oetydfsDea( s (0trtrxf oa1latrln o;s0srtmxr3nydlme lfcta()aDurx oot0optomf3iytfa umnmsn(4alxoif oytlaD lneo t sruo(o oo1ol nlivi s)s2tmu  nu0tptomoeiaslsDuanvp (4alxoio oodfp eanvs;(  2trim3oodaltn ieilsf Dumx oou4ope iietlt a2umn on()teeomf ta1laDeau i (  2uo(m3nu1op nmfct t)srua(mp;u1tlxomoeilsfaDel(vs t0tltoxociy1lmD anvol(0setm(r3ny4omenlivsls)arta(m ou1opx  oeiad mDrmums u0aexoxf3oadoptrlnei s)trtmxr nudame  icslt)srtm(m nt1apt mictad s uanvp t) eerif3todfpDeauei;(  euoxopiydlp  mnvil(fa2um(m ou4tle ii3tytlsDeau p;t)altrxrcto1lm  lu o;t)trum(o no4lm  liei ( sDtmu pou1apenif3tls m2ra( p;u4teenmo oo1laDraies;s)texmxrpno1apeelictls srra(  ou0oeto i3iydls el( p;t4altomf tadoa rlneslt0 2tmirpoydlpe  fvs sfarta(rpnu0oee ii3ias a rmnvo;t4 etnircoodlat lnesls0tetm(m nydlme  nvsl(f rumur ;t1apt  oeiydla2ul( on(4arerifcoo1lpDelieo (0trtrimpnu4ol  lnvt s)sDum(m no4openio3tytfs2ulu on(4trerxr3iodlp elnvo;(0 2toiopno4alte nctat)s2tr(  oo1tpxn i3iysfs rl(vp t0aexrmo3io1fp rln sl(0s2to(o3iu4lpte ieta(farta( oot1alt  oeildlm2elnmp u)tleoxocoodlmD luvi (  rxoimpio4om emnvta(fsDtaxmpot1tpeo oetas s umump;(4tetomr tydfpteauvs;s  rurio oy1lltemivs (fs2trxmp;u1apenifeiatfs2rauvs;u0alxrmo3oydfaDe nvo;( tetrxo3oydolte feta()a2rax onu0olt  feiytfs2ua( p;u0tleoxf oa1fpDeaieolt0s2toxr3oodol nmieil( s2taxr ;u4aexo fctaslmDemums;u4tetoio3ta1omtraueo;t0s2tr(o3oodop e icia(  rrmu onu1apx  octldfm emuvp;t4 rerio iadfmt aneo t) eto(o3nu1ol e nctlt) Dtr(r oo4oleoiietysfaDraumo u0trxnio3oodfmDeauvsl( trtmxr3ny4lmte nesat)artaum nu4opt mf3ildlm2uanvs;t0alerxr iy1opte ivi t)tetmim3ou4oltn neiltfa2rax o;u1tlt  ieiysfs ranmon(4artnmf3tatopt livils0seuoxm iodomtemivt s)artm(mooo0alx  f3iydlsDuluvon(4aleoio3iydlp  ln ils srtrxopoy4lp   ncsl()sDrrx o;o1apxnmfciydlaDea(ms (0 exoio ia1om eli s () rtrimpiy4lm   icia( s2rmu oou4aetoio3ilsla2ulumo;u0tetnxo3ty1lpDraiei () rxrir3ou4llt mfcs (fs2rrxmpoo0tptomoctysfs2eln p u0tetnio3ia1oat auvslt  ruo(mpny1apenlnvilt aDtru ooo0open ociadfm uanvp u0 leomf tytoa rlneils0tetmxm oo4om nliesltf 2raxmp;o1openifciad aDeaumo;(4trxrif tadlmt au o;(0srto(o no1optnmivs tf rua( o;t1apxn oetas mDranmp t4alenmr tatomtrlivo ( s2toxmpno1amt  nesas srur(  ot1tltnmociysfa2el(mo t) ltoxo oo1oa rluvilt0 euo(opiydolee nci (fa2rmx pno1tpeoio3ias mDumnvon(0 eermo oo1fp eluei;s teur(r3nu4lmen fvi s)a2rr( pno1ole iociyt s2ulnvpn(4 rerir ta1fmDr i i s0 ruoxr3iu1opeemicsas)aDrmumoou0opxnif3iytlm2uln s t0aetoxfcoa1opt ai i;s0trtr(opou1omt lfetl(faDtauronu0aex ioctldfs2ea(msnu4 rtrmo io1fmD anvo s0t2xo(rpnydolt  nvia( arur(mpnt1alt mf3tls sDua(mon(4 exnmocoodopD  ieslt0setmio iy1omte nvilt srra(mp;u4oex  oeiltlm uaumont) leoxr oo1la e u olt0 etoxm3nydlm   fes () Dtaxmpoo1optniiciatla emn s;(0tltoif iy1lmDe ivo ()teuoirpiodlp e neia(fartau  oo4alen ietadfaDuauvp u4teenxo3ootlpDrau i t seum(r oodoptnlnei sfs2rrxrpot1olx  oeildfsDranmpnu4teenif oy1laDeaivols0 2tm(opiydoptemfviat) rrm(mp;u0ape  oeilsla emn p (0aeeoxrcio1oaDrai o;()t2tm(rpiudlmt  fvtatfsrrr( pou4apen fetldlsDul(mp u4tltrxrciytopDeauvs t trxoim3iudaltemfcia()arrru poo1teenmf3ias a2emu o;u0tleoio3totlpteln ils t2xmxo3iu1om nlnvils)s2taurpoo1texo f3tydfm ua(mp;t4aexrxf3to1laD an o;t  rxrio oo4opt  ici t  Dum(mp;t0opt  fciasfaDrmu p (4aexnxoctadoa  anvi;s texrxm3nu1lpte nesat) Dtm(rp;u4alxnifctas s el( s t)arxomfcta1fmDrai s;()srumio iu4lmen fctas) Duru pno0tetomfeiat s ranmsnu4aetoxr iydlmt  ueol(0srumimpiodlmtn feias  ruauroot4opxoiociyt aDrlnvs;(0aexrmr oo1fpD aies;(0 rxr(rpnydom n fetl()a2trump;t0tpeo oetlt m2elnvont4texrif ia1oaDrln i t0sexr(o3ny4ll elfvs sfsDra(mo;o4oex ifeiadfs2uau pn() lenxo ia1lm eanei s0 2xoirpny4lp  lfctltfsrtaur oo0teenmi3iydlaDua( o;t4aexrmocootoat  u i;()s2trim3nu1am nlfctlt)srrrxmoot1tpxomoeiysfs em(vsnu) ltrmo tatlm ranvslt0 rtmxrpiu4llt lfvtl( arraxm ;t4alen f3iasfm2ranmpnt)trxriocty1opD lueo;( setoxopno4om nlfesa(  Dur(mp;u0altnmfetld mDelnmp;u4aeeoxo3todop rluvs (0s2toxr3iydamt mfvia() rumumono1aleoifeiatlsDeanvo () lxrif3ia1lmte ivslt trum(r oy4lpe  fvt ()artmxm oo4tpxnii3ildfm2emnvs;t4arxrmf3totfp r i ol(  2tm(o3ou4llte icsltfsDuaxr nu1alxo feilt m emumont4 lxnmfcoadlpDe n s t0 2urimpny1lm e feilt)artr(mpnt4oee mfciasfm2ulnvp;u) exoxo io1lm rauvslt)trurxo oydam n fesatfs2raxrpou0olt mf3tas a2rm(mpn(0 exoifciotfmDran i;t)t2toio iu1lpenmict sfs2ururpno0alx mo3iatls2emuvont0 lenxocia1opt lu olt)t2xm(m
\ No newline at end of file
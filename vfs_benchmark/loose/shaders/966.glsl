@@ -0,0 +1 @@
+neo (0seto(r io1ll n nvsat srtm(mo;t1olxn o3tydls em(mp u)texnmoctodfm  luei (  rumxr ny4lptemicil()srrr( pot1tleoioctysfs ran s;t) lenio3iydoate u ilt  ruo(opiydamee nes s)a2rmum ou4oleo ietys aDem( o (0 eeoxr tatlat lu ols  exoxo io1lmt  fcil(fa2trxroou4oeen ieiatfmDuau onu4altomo oo1fmt  nvo;( t2uoxr iu4aptemfcsatf Dtm(  ou1openifeiasfa uan o;u4 rxnxr3tadom eauvo (  2xriopny1op   nvil(fs2rmx ooo0aptn i3ildlm2eanms;t) exrmf3oo1opte i s;t0seurxo ny1lleelncs sfa2uauroou0aexnmo3iaslmDem( o (0 ltoxr3oytfmD luesl()s2toiopny4lp   iesl( s2tau oou4oet moctysfa2emums;(4aeeoio3totlmte ivi t0 2uoxo3oydapen fviltfarur(r nu4tlxnmo3iytfs raumsnu)arerxfctadlmt lneols0 exr(r oo1op nmiviat a2raxro;t0apeomfcildls rlu onu4trtrmrcoy1fa  aneils0trurio3iu1aleemfvtls a2uax  no1opx  icilsls2rm(vp;t4 rtrxfcoatoaDr nei;s  rumxmpiu1om  miet t) Dtaumoot1tle ifeiadlaDrlu o;u) ltrmocto1fmD an ilt0s2xmxmpoo1alen nvsltf Dtru oot1openiociydlm rmumsn(0artnmrctatfa eli s s) euo(m nu4ame livt (fsDuau ono0tpen o3iyt a uauvo u4trtomf3tadfmDeln s;t) etmim3oy1aptn iei tfarur( o;o1altn ieilt a2ulu pn(4trtnxo iydlm eauvi t0srxr(o nudaptnlnci s) 2ra(roou1tptomf3iltfa2ean pnt)artomf ootla   ieo t s2xo(o3nodap  lnvs (f rumxmpnt0apen feiltls ea( on() rtrxf totop rluei s0sexoxmpou1omenmivsa( srraxmp;u1aex miciyt aDul(mp;(0areomf3tadomt aneo;t0setrir3oy4lpenliesa( srum( o;u1aleomiciyd a uauvo t4aetoxo3oodfptraivo (0t2xm(o3iu4am   nvtasfaDuaxroot4oleoif3tat m umnmp u0tlxnxrctytopt  uei;() exo(m ny4lm elnvs ( a2uaxroou4tlx mfetasfmDeanvon() ltrir3oytomteaivs () 2to(rpiy1ol n fci ()sDtax ono0apxomfeiydfs ulnvs;t) rtnxo io1fmDeaneo (  2toxopnodlp nmnctat arurx  ;o1olxo feilt aDrauvsnu0tltoif tydfa  au o;s s2urxm iu4omt  net t a2ua( pou4tptoioeiytlsDrl( s;() rtrxrcio1lp eaueo;()srtoxrpoodaltnlfetls  rtmuroou4tee iiciatls uau s t4texnmfcoatlmteln ols)trxr(r3oydom emfvtls  rtru o;u1alxnio3iad m2uan s t0aetoxf3ta1lmDeli o;(0trur(o3no1lptnlivtat srtm(r nu1ale mo3tydlm2em(msnt)trxrifcoatlmt aiesls)truoim3io1am emfeil() 2umump;o4olxoioeiasla umu p;u0aleoxfciotopt au s;t) rto(opoy4lptnlneias)a2rr( p;u1tltomiciysfa emump;(4trxnifctytfat lnvs;t) rtoxo oy1opeelfeias) rurumpot4tpx  ociysfm elu s;t4tltrxf3oytlpD lnvolt seto(m iudal  lncsa(fsDrax ooo0openmi3ilt m eaumpn(0 reoif3tadlate nes;(  2trirpnudamteliciltfsDuau o;o1aee  f3iltlm ea(vo;u4tetrir tydom e uvol(0t2tmim3iu1am elict (fa2tm(mpoo0tltn octatfm rl( ont0aleomfctydfa r ueo t)srumxmpoy1opt mfctas  2rrx  no1ape miciadfsDelnmont0aetnxo3to1lp r neo;s)s2uoxm3nydllt  nei ( s2rmxro;o4oltnmi3iytla ea(mo t)trtrxr iodlmDe uvols)t2tm(r ou4olee iciasfa2rau onu1oexo oetatfm2umnmo;()aeerxo3ia1fat auvsls setriopiu1olen nesa(fsrrmu pno1opxnif3ilt a rlu o t0alxoxf3todoatelnes;t0 rxoim3oo1am   nes ( s2tr(ront4tetnmfetasfaDrmn p t)artrxfctytlate nvi;s0teum(r nu4al  licta()sDrm(  nu4tleo ictatlmDuln p;(0arxoio3tadomDrai o ()srtoim3iodom e ncsas)srum( p;t1tlt  i3tydfm2rmnvs (4aeenir tydopteauei;s0 2xmir iydlmee ivilt arrrxmp;t0alxn ieias aDeaump u)artnir3ia1opDr nes;s0s2to(opiodllenlivi t)sDum(moou0oex  ietys a2um(msn(4tlxoxo todopt au o t srxrxmpnu4lm nmncs s)aDur(m oo4aet mieiadfaDuau o (0 rtoxociatoat  uvs s s2toim oy4lme mfesls a2tau ono4tetnmo3tatfaDul(vo;t4aexoio to1opD aivi s0s2uo(o3iy4ap  licil()aDtmu  ;o1oleo f3iydfsDeluvp u)alxnxf3tadlmDrlneo s0 eum(r oo4lltnmivslsfa2trumonu0oee mfeiadlm ranvs ()teeomrcta1fmDrlues t0 2xmir3iy4al nmietlt s2raur nt0opx miciyd sDrluvsn(4 rxriocio1fpt  i i s setm(m oy1omtemictlt)aDuaxm ou4tpt miciatls2ea( p (0areoxf3oytopte n i s)tetoimpnu4amt mici s arua(r ;t1tle mf3tls m2uluvs;u4trxnxr3iydfpDrluvilt s2uoxo nodamt mict ( arrrur ;t0tptnmi3tadfm eanmo;u)alerxr ia1opt  u s s)s2uoxo iodapeelfcsat aDumxm ;o1aleo i3iysfs el(vp;t0tlenifcio1lp e i i s t2xr(m3oy4ap nmnei t) 2tau o;u0apenmo3ildls eauvonu0 etnmocoadlmDe uvi;t)truoxm3no4aleemieiasfaDrr( p;u1tptnifciadfa el( s t)tlenxf tadlaD aivs s trxm(r3oy1ole miei (fartax o;u4openmiciyslaDrl(ms;u4 lerif3oa1fpt  ues;s) exmirpiy1ope lnet s)aruru pnt1olen o3iys sDelumont0 lxnif3iodoptelieo t)texrxm ou4omtelfct (f rraumo;o0tle  f3iys m2el( onu0tleomfcoatfmt  n ol()s2urim3nudam   ncias) 2tax pnu1alxomoeiad mDrlumo (4alxoir3ty1om eaueslt  2tr(m ny1openlfcsls aDrrumpnu4texnmfetat mDulump;u)trtoir iotfmt auei;( srxoir3oy4ope  iei () 2ua(mooo4oetnmo3tydlm um( p;u4artnxr3oatfmteluesls0 2urir3nudomt  ncilt)aDtm( oot0tle if3iyt sDea( o;() rtrmo oodlpt  nvsl(0teumirpoudom emivi t  rua(  nu1tleo feiyd aDranmsnt4tleoio3oo1oa r uvi;t s2urxo3iy1ap  lncia(f 2tmxrpou4apen feiadlm2ra( o (0 exrir3oa1omtraieslt)s2xr(o3oy1op  lici t)a2tmur ;o1altoifetad sDem(vp;(4arxrir3tydfateli s;t s2xrxrpiu4ol e netltfsDrm(mo;u1tet ii3iatlmDem( s u4trtnio3totom  livs;t)srtmxr3nudlpen fvia(f ruaxro;t4aeeoio3ild mDemu snu0aexomo totlm eai sls)srxr(o no4op nmietls a2umu  nt4aleo i3iysfs2ulu o;t4trerxo tydfmDeanvil()s2urio iudoltnliviasfsruau  ;o1ape iictas s uanvs;(0aeermr3tytfp r ueo s) rtr(o3io1llt mivslt  2rr(m ot0oltn ictlslm2umnvs;t0aleoxo3iytfpDrln i t  etmxm3oy4omen icsa( srrrum ;o0tetniocilslm rlnvo t)treoxrciydfmDeln o;(0 exr(o3io1ll n icils)aDuauro;u0oetn ieilsls ranmo;u4aexoio iy1lmDeanvilt) rxoxo3oy4ol  mnei s  Duau  ou4tpto o3iadfmDumnvont0aeeoifcoy1fpt aiesls)trtoir3iydllte ics ()a2uru o;u1teenio3iydfa ranmo u)aexoir tytlaDeauvslt sruoim ny4lltemnci t) rtmxrooo4tpen fctadfaDrmuvs;u0aleomociadom eanvil(0s2xoxr3oy4apee ies sfaDrmx  ;u4oex mieiaslsDulnvs;t4texrio ta1lpD lnvsls)sexoxr ny4ll elnctl()a2ur( pnu1oex  f3tld a2ua(vonu)treoioctotomDr i o s) 2tm(m3nydap elnetatfsDur(rp;t0aexo ocilslm2uluvp t4alermf3iodomDe ieol()sexmxr oy1lptn nei ()s2rrurpnt1tpenmfetyd sDrm( p;u4 eenio iotfmteaieo;() exmxmpou1ame  nvtat) Dta(  ot1olt ifeils aDul(vsnu)trtnio ty1lpt  u o;s0 2uoirpou4ape lncs sf Dtax poo4oexoifeiydlm2emuvo u0trtrxr oy1fmDr nvs t)sexmxmpiudome mnct (fa2ur( pnu4aeen i3iysls2rluvont4trtrir3iy1omD liesls)seuo(r no4ol emicil()a2taum no1oeeomo3iyd s rlnvsnt4teeomfctotomtrlivsls0sexmimpou1ll n fvsa(fs2ra(r ot4tlx ifcild sDuau s;u)arxoxr3oatfm   i ils0 rxoxopoy1ll  livia(  Drrxm ;u4tetniociyslmDeluvp u0trtrif iadlmD luvs;t t2urxm3oy4lpeemnei (farrrump;t4oetniieiadfa2umu pn(0trtnxo oatomD auei;t)s2ur(o iu1ome lies tf 2ur(m nu1tlxomociydlm rl(mo u0aetoif oadlmte u o t0seurxm3nu4lltn fvilsfartrur oo4apt ifctlsfm2umnvp t)trxoio3iy1fp ranvolt t2umxr ou4lpe  icia( srrrxmpnu4oet ioeiyslmDul(vsn(0tltoxf3oodfpDe n sls t2xmxm nudap   nvt sfarra(  ;t4openifcias a raump;u4 etoxfcty1om rlues t0 rurio3iudopt  nvi (  Dtr(  oo0opxo o3iat aDrm( s t)areoifctotoptran sls0 rtr(opiu4aptelfeiatf rtrx  nt1oeenii3iat a2um(vont0aeerif totlatelu o t0srxr(o io1op   ici t) rtr(m ;t1oetnmfcildls2ul( p u) ltrxo ty1om  lnei s teurxm io1ol  lfvs (fsrua(mo;o4tpeo iciyd m rau p ()tltnxocoo1omDe ues;t  etm(m no1olt miesa(  2rmu poo0olenii3tyt sDrlums u)trxomo iydfa rai slt)trtrio ny4lp  mnvsasfs2um(mpou1olenii3iasfmDumump;t)aeeomr tatlmDranei ( setoxmpiu4omte icias)sDumur ou1tlx iictadlmDem( s;u0 rxnircio1oa r u sls0s2xm(opoo4ameemnvsas)srtmxrp;o0aex  o3iaslmDel( pnt0 rtnmo3iotlmDraueo s0s2xrxrpnydomt mnei t)sDuauronu0aexomietyt a emump (4tltnmrciydlm  anvilt0seuoxm no1opee ivta( s2rr(  ou1alxo o3tydla umnmp u0tetrxrcoadlaDe iei t0 rumxo oodlm e nvtat  Drm(m no1alx iictat s2umu s u4 lerifcoa1oa eanvo;s) 2um(o3oudom  mnesas)s2ta(  nt4aex  feiaslm2el(vs;(4 etomr ty1lp elnvil(0sexoxopnu4lp nlnesasfaDrmx poo1tleo i3tadlsDumumont)trxnxociatlate ivi;s0 2um(r ou1opee fvia(faDum(r ot4olen ieiatls2rl(vo () rtnmr tadlpteaneolt0t2tmxr3io4lltemnvtls  Drr(m ou1tetnmo3iysla umu snt0texnmr3ta1faDr ivs;()s2tm(r io1om nlici s aDua(r oo0tleoifciltfsDemu snu0tltrmr iydfatraues s) 2trio nodlm   fes s)sDtau pot1oeenioctlsfa ra(mp;(0tlenmr todopt  ues s setm(r nudolen ieslsf Dum(ront4tpeniictyt a rmn pn(4 lenxr oo1lm elnvs () rum(r3ou4lme lfvi s  2raxrono1apenmfciytla2rlu pnt0tetnxf3iatlm r ies t)s2xr(o nu4op elfvt (farumumpot0tltoifcias m2rl( pnt) ltoxoctatlmteaueo;s0trxmio oudomt  fesat)aruau oot0oee if3tydlm eluvs;(4 rtoif3tadfa rauvols0 etrio iudamenlfetl()s2raxmont1ale  oeils s2eaump;t)artnirciodopDrlueo;(  2tr(o nu4apeemfeiat) rtrxmpot1aetn oeiytfmDran s;t0alxoir to1fmteluei;t0setmiopnu1ale mietltf rrrxro;o4tex mf3tys a rluvp () rerxr3oy1oatrlu ils s2toxo3nydalen nvtl( a2tmxrpoo4olxnmieiysla2uluvp t0arermf3tatom  lnvsls s2xr(r3iu1al nlfei tf rrrumpot4alxoif3tydlaDumumo ()artnxocta1om e neslt0srxo(opno4lptnlivtls  rrmumpnt4olt  feilt mDulu p;()trermociy1lptelu s;t  eurir3iy4lpe lieias)a2tr( pno1oexo feiyt a2ulnvs (4alxomo3oodfmDeaneslt0srtr(rpoo1alt lfci sfsrta( ono4tpenmictlslm2rlnvs (4tetnir iy1lp rlivo;s) rto(m3iodopt mivilt) rtmx o;u1aleomietltfa rl(mon(0aetnmf oo1fpDr u i t0s2xrimpoo1lpenlivt ( a2uaur ot4tlxnmictys s2emumo;(4trenmo todoa elnes t srxmiopny1op  lfviasfsDtr(rpoo4altnio3tytlmDeluvs;u0 rtoifcoy1fmt aivs t) eumxr3iydolee netlt aDrmumoou1oee io3iytfm2elump t4tltnir3iytop e ieols texmio3oy4lme lnei (  2ra( pnt1aetn f3ildlmDrau p;u)trxomo iadoa  aieils) rxmxr3oy4omt mfctat)a2urum ;t1oltn fctlt s2emnvo () renmrcoatopDr nvs s) rxr(m3nydale mivias) 2urum ou0altnifeiyd m uauvpn(4 etoxo3iadfpteanes s)texmxopoudlpee fcta(f 2uaur no0aee  f3tld a2rluvp;t4 exoxr3iy1oaDrlnvsl( seurxm3oudole lfcs ()sDtm( o;t4oetniictyd a2ulnmonu)trtnif3iotla elnvo;s)seuoxmpiy1ameemnesasfa2tr(rono0oeeoif3ias a2ea(ms u0trenif3oa1fpt ln o s) rxrir nu1ome lnesa(  2tm(  nu4tlxomictyslmDuanvp (4areomrctodom  aieilt)tetmiopnu1lm  lnvs s)aDrmumoou0olenmiciys sDea(vp u0trtoifcoo1om r n sls0trtoim3oo1ll   nvta(  rrrur ;u4oltniociasls rm(vp u) eerio oodfp eluesl(0 rtmir3iodomte ici t a2uru ont1tlto o3ils a2emn snu) ltrif3iadlpDr i i ()setm(m3iu4lmeelnvtasfaDrmumo;t1olxomfctltfmDemu onu0trerxr iy1fpt lnvs;t  etrirpiu1al n fvi tfaDraumooo4tee mfeilt a2rmuvp;() etrir3oy1fate n o s)texrir3iu4om  mfcsa()a2rau onu0tpe  i3tatfmDulumon(4tltnxrcio1fpt  n s s trxr(r3oydlmtnmfvslt  Dra(moot1opx ioctydfm2el(vs;(4 lermocoydfa  aivslt0tetoimpou4altnmfctat) rrmu pnt0tex if3tlsfs eluvsnu4arxomr oo1lm eaivi ()t2xoxo3ou4apeemivs () rtax  no4oleomf3iydlmDrmnvp () rtomo3oo1opDean i s  2urxm3no4ape  icsasf 2ururoot4oet ifetydfmDrmu s (0 etrmocootfatr ieo;()sexrim3ny4ol n iei t) 2tmxrpno1oeeo i3iatlmDeau s ()tlxoif3oatlptranvo;t  2tr(r io4lmtemics tfsruru  ou1tpt  ieiltfs2ran o;()tltomr ootlp r iei s) 2um(opoy4am n nvi s) 2uaxm ;t0ope ifeiltlsDemn onu4aeeomr oa1fa  an sls) rtoimpno4lm  lnvia(  rtr( oot4tlenif3tas aDra( o () exrmf iadlpt  i slt  etrir3iodol   fvia()s2umx  ;t1tpenif3iysfm emn p;u0 rxnmr3ty1lat aueols srxrxm3iy4ope livta( aDrru ono1texomociltlsDua( p t4arxrxo3oatoat ln s t) exm(m ou4lmt  ietlt a2tmump;u0tpxomi3tltla rau s;u) rtrmf3oytfmteanes s) eur(opno1lpt lfet sfs2tau onu0tlxo ieiytfm rm(vs t) ltrioctatlpt  nvo;() exoimpoydoltn iei t)s2taxmoou4tpx ioctys m em( p;(4alenxf tytlptr iei;s  etoxrpiu1ope lnvilsfaDurxr no1olxo octld mDrmuvo t)altomr3oydom  lueo ()s2xm(m3nodomt  ncs s)srtru  oo1aet  f3iatlsDulumpnt4areomf3oadoaDeanei;s)teuoxr oodal nmfcta( a2taxm ;o0opxomictld s2ulump;t4arermf3totlpt anvi t0trtrxo3nu1openmneiltfs2tr( oot0tee  ictad s el( pnt4 leoxf iytfmtr ivs t)s2xoio nu1om elfvt s)srum(r no1tlxn o3iyslaDua( p t4aexnmocoo1fm ranes (0seuoxmpiy1amtemicil(  2raum ot1oetn oetas mDem(mp u)teerxf3tydlat aues ( sruoimpio1lleelnvils)sDtmum ;o0olxn ietltfaDemn p u0alxrmo3oodfmteaieo ()srtoir3ny1al  mnvs ( srrru ont1tetoiociysfm2rl(msnt)aexrif oatlpt anes s0trtm(r no4open nci s  rurur nt1tetn fetat aDul( o (4 rtoio3oatla e uei ()t2toio3iodllt mncias)a2rax p;o0tee iociltlm ulnmsnt4 etomf3todfm eliesl(0trxmxo3nodlpt  iet t aDraxro;u4tleo oeiad s ulnvo u0 leoxf3oy1latrai s s0seuoim3oudale mfesas sDuaxm nu1oltnmociysls eanvonu)tetoxo ootlaDean i;(  eurim nydape mfes sfsDrrxrpno4oex io3tltfsDelnms;t4 exomociodlmD  u sl( teumimpou1alenmfcil(  2tm(ront1oltn ocilsfm2ul(vp u4arermr3iatfp  aneilt0 2ur(o iodalteliei tf 2rmu oot1optnmoeiadfa eau sn() etrxr io1fptrlu o;t0s2xo(o3ny1openmfvtltf 2ta(mpot4apto feiyslaDrmu p;(4teeoifciodfm r ieol( seum(o iu4lpee feias s2tmurpno4aeto f3iadla ul(vpn(4tlenir oy1latelueil() ruo(m3ny1olen fcsat) 2umxm ou1tpenmociadlmDulu o t)tlxnmr3ty1la   nvs;t  etmim nodlmtn fes t)srtmx o;t0tpt mfciad s2rmn s (0trxnxf oo1lpD lueo;s)tetm(m3iudlptnlfvtasfs2tau  ot4tltnmictltlm umumsn(0tltoxr3tadfateanvo s0sexm(m iodlpen nes (fa2raxm ;t0tetomietatlm umn s;(4arenmr3oy1fpDeli i s0 exr(r ny1lp nmnes sfa2uauroot4opxo ociatfm2ea( onu4trtnxfctodoa elieo;t0 etoxopoy1alen ncslt)sDumu pnu0aleomfeiytls2rmnvsnt4aleomr tadfmDr ivslt0t2ur(o oodapt lfeslt  2um(mo;o4tpx ii3ild m emnvsn() renxf io1fp elu sl() 2xm(r3oudlmtelncsl() Dumxmpnu0alxoii3iyt m ra(ms u4 etrif3to1omt luvo s s2to(o oodalte ietat) Dtax pou4tlxomietatfa rmnmonu0teenxo oytlmtr uvols)t2toxrpny4om   nesa(fsDrm(m nt4tleoii3iad s uaumpnt)teenmociydlmt lues;t teuo(m nudaptemfvsl() 2rmx  ;u1oeto ieiytlmDrm(msn(0tleoxo3oodom  aneil() 2uoio3ny1amt mncil( a2tmx p;t0tlxn fciys s2el(mon() rxomf3oydfptean il(0 2xrimpnudomtemneilt sDrm(rpot4tex  ieilt s2uan sn()areoio3oodfaDe neilt0s2um(rpoo4ome  nctl() rur(  ou0oltoiieiydfa2emu s u4 lerxr3oytfaD  uvi s trxoirpio4am nmfviatf 2tru pnu0texomfeilsfs2rm( p;u4alxrifciadfpD an il(0trxr(mpno4lle lfvsatfs2urumono1open fciyd aDemnmp;(0aetomr oo1omteaivil() rtrio oy4llt mfviltfa2ta(r ;t1aetomoeiltfs rmn snt0 lermo3iytlpD aivi;t0 rto(m nu1omen fctl( arum(  ou0tpt ifcilsla ulums u4altnmf3ootop   i i s) rtrxmpoo1ameelnvtl(f Dum(r ou1opx iocias aDumuvsn(0trtomf oa1lp  lnvo t0 rxrxo oy1alt lnctat) rrmxm no1alxn iciyt m um(vs u)aexrxr oodfatr uvo t s2xmim3nu4opte ivt s)aDrmu  ;u1oeeoifciysla2umuvpnt4trxriociydopDelnvo s) 2tm(rpoy1lm nlicsas aDrax  no1tpeo fctysls umuvsnt4arxrmo iodfatrluvs;()srxoxmpnydalenmnesasf rua(rooo1apxo ieiltfmDrlumonu0 rxomf oa1laDrlu slt0 etoim3iy1al nlfviltfa2tr(r no4alx mf3tas sDeaump t) reomfciotfpt  ieilt)s2toxm no1lpt mfvsls srum( oou4oltnmo3ilsla ra(mpn(0 etrxo tytlatelu o s0srtr(m oydolt  ncsl()sDrrum nt0olto i3iytfm2emn ont)teerio3ootfmDrlnei;( teur(opiu4amen ietat) rraumo;t0alenifetltlaDra(ms (0 lxrio ta1oaDelnvi;s srtoimpiu4op e netls) 2rrxmpnt1opx  o3ild mDuauvsnu0alerxf ootfp eauvs;s0trtmirpnudapt lneil(fsDrrx  ;t1apeo fetasls2ea(msn(0 eeoxfctodopDr i o;s0tetr(opoodolee nvsls  Dum(mont1oetn ietlslm ulu o u0treoif todfa e u sls)srxmxm3ou1ame lfet sf rumxmpnt1apxnifctls a em( on(4 renxfcoo1la rauei s  rur(o3iudamtnliesls  rtax pnt1apxoioeildlm ra(mo;(4 exnif3oatopt auvi t  2tm(rpoo1apenmivtat sDtr(  nt0aeeomictytla rau s;u)aexnmr3oadfp r iesls0tetr(r3oudoltn iciasfsrrr(r nt0oltomoctltfs ul( p t) reoiociodfmD  u o (0 2uo(r iu4llenmnvsa() rrm(r nt0opxnii3iyd m2rmnmont) renxocoo1oa  lu ilt  2xmimpoy4alt mici ()s2urum no0oltomfeiytfa ranvo (4 rxrxr3iy1fmt lu ols texrio3nudameemnetl() 2rr(ro;t0tleoifctat s2el(mo u0trxoir3iydfmt  uvi;(  exr(opny1om e ivs tfsDra( o;u4tpxn fctydla rauvp t4texomr ootlaDeau s;t0s2uo(r no4am  lnvsas a2trump;t4altoio3iyd a ean o;(0artrif3ta1oaDrau il() exoir3ou4aptn fvsl(farrax pou0oexoif3iltfsDemnvsnu0 eenifcta1fpDrlnvols0srtrxo iudape lfei (fa2rmx p;t4tpt ii3iasfa rmnmsn() exnifcoodfptelnesl(0texoim3iydll n iviltfs2ta( ont0oltnifetldfs2eau p t) leoio oydla eanvol(  rxoir nudllenmnvtlsf Durxroot1ale mociysfs elu snt4tlenio iadop  ln s;s0t2xmxo nu1aleelfviat)s2tmurpno4teen oetytfmDrm(ms;(4tetnircty1fpD lu olt0tetmxo3no1ope miesasfaDumumonu0aexnmfcild s rln snt)alxrir iotlaD  u o;s0t2uoir nodom emnct t aDum(rpou0tee ifciyt a emnvo u0arxrxo oatop elnvs ( seumxo no4ame lfvsas)arrmxr nu1olxo f3iadla2ran o t0 exrircoy1la ranei s)t2uo(o oy1ame lieilt srtmum nu0altn f3iltfmDrln pnu0 rxoif iotlp  lneo;s0 etr(o3ou1llt lfvtlt sDrau pot4alx  o3tasfsDranvp;(4 reoxrctydlpteaneo ( trxrxr nydome mivia()arraumo;o4apxnmictat a2rlu sn()aeerxrciydomtrlu sl(0srtrxo3nydol nmfci s) 2tmxmp;t4aexo o3ildls rmums;u0 exoiociotom  aivil( s2trir ny4olte fet s artrxronu1tptoiiciydfs rmn o (4 exrxo oydfa e neo;t sexrxr nodal   ncsas s2um(rpno4altn fciltlaDrluvsn() renmfciotoa   ueol() euoxo3nodolenmiet ( s2taump;t4oeeoii3ils s ra(vs (4aexoxo3todfpteln o ()sexmio3ny1am  lnctas)sDrm(  oo1ale ifeils mDumnvonu)trxrif oatfaDr nvil()setoim ou1lm e fvtat) Dtmxmoot1opeo ieiytfsDraums;u0aeerxr3oa1lm r u ols  ruoir3ny4omen fvs ( sDur(moou1tleo ocildfm rln snu) lxrxo ootom  auvi t0setoxo3nydale miesls sDtr(mo;o0texnmicilsfaDuau ont) ltomrciadomt luvo t0 rxr(mpoo1omtelfct (fa2rrurp;t4tetnioeiasfm2rmuvo;(0 exomfctatlaDranvs (  rumxm no4ame lnetasf 2rrx o;o1oexnifciydls emu snt4 leoiocoodoat liei t0seumio iu1apeelfesat arrr( ooo4alxomo3tytlaDrauvont) leoir iytlm elnvil() rtm(m oo1lleelfvsas arra( oot4alxomoeiytfm eanmo;u0trtoif iy1oat lnvi t srxoxo3oy4lpen icta( arra(m ;o4tleo o3tys m ua(vp;(0arerir3iydlateluei;s0teuoxm3ou4amte nvia()s2rmx pnu1tpx if3tydls eluvp;t) ltniocoodlmtr uvo;t) 2xmxr3iu4amtnlieias)aDuax onu4alxn fciytla2ul(ms;t0tetniocoytopDrli o s seumirpoy4al  lncta(f 2taum ;t1oee miciydfa2rauvont0 lxrmo3to1lmt aieils t2xo(o3oo4apte ics t)s2tm(mpnt0tlxn fciyt a2rl( p t4trxoxfcoo1fmDrln o ()srxo(r ou1om elnvs s)aDum(r ot0tpenif3ildfa eauvp (4aexnifcta1oatelnei;s0 exrim iu4ll  miet t aDtaxrp;o4tpe  o3iyslm2um(ms;u)aexriocia1lmD  u sl( tetr(o oo1amtemnci ()srumxm nt4oltomfciasfs2rm(ms;u4artrmo3ty1fatelnvsls0trxrio3iy4lm elieiat srrr(m ou0aex mo3iyt mDelumo (4 lenif3oodoatrli s ()s2to(r3oydlm emivta()sDum(mp;o1oexn ocildla2ean o u0aleoiocta1laDe ivi s)srxm(r iy4olee ivtlt aDumxmpot1apen fctlslaDumnvonu4trermrcoydfa r uvi t t2xrxm3oydlpt mfvi tfsDtrump;o1oetoioctysfs ranmon(0trtoxrcio1fatraieo (0 2tr(o iu4ll nlics tfaDtm( pnt0olt ii3tat s2umuvp;t)tlermfcoydoatelivs ( tetr(m3io1ol  lnvi s) rurx p;t4openio3tlslsDemnvp u0 eerio3oo1omDrlnvi;s trurio nydlmt micsa(  Drrx oou4oltniietadfs ea(mp t4 ltrmr3iotoaDe n olt)srxoimpoudol n icta() 2rmu pno0aeeomictldfa rmnmp () reoircta1omt luei ( tetmim oudomt livta(f 2tm(rpnt4olxnmi3iad s elnvs (0artnio3iotop elivs t trxoxrpnydlm e iesa() 2ur(  ;o1aee ifciytfm2uauvpnt) rxomf3todomDelnes s0s2tr(m nu1oltelfetlt)sDtm(mo;t0opt  feiys mDrmnmo;u4arxrifcoo1oatr n i ( srxr(opny1omeemfvsa( a2ra(ronu4oetnmfciadfs2eauvs (4trermocoodlaDeau ol()s2xoio3iudoltn fvs sf 2ra( ont4optn o3tytfs rl(ms;t4 rtoxrciatla elieils s2uoirpiudol elfctas aruaumo;u1aetn o3iytlm rm(vpnu)altrxo iodfpD luei t trtoio iy1om elfvt t sDta(mpnu1apxn ieiyd a2rlnvp;t)trxrio oy1lmteau i;( texo(mpio4amt  nci (f rraum no1opxnmf3iad sDemuvpnt4arxnxfciadfmDeaivi;s0t2xm(m3nydaltnmfvta(fsrum( p;u4aet  o3ilt a ulu s t)artoxrcoytlm r ivol()sexrxr iy4ope lict tfs2rmxmo;u1aee ifctys a2ulnvs (0tlermfcoadlmDe i o ()s2trio ou1amtnlivils aDumum ot1tet  i3tldlsDelnmpnt) rxnxf3iytlpDrlu sls0texo(m3iy1aptnlivi s)s2rr(r oo0apeo f3ilt s2eauvs;()tlxrif3oa1lp e nvo;s) etrxopnu1lltemiesat  Dra( o;t1ape ii3iysls2uan p t4tltrmo iadlmD  u i (0trtoxrpoo4openmfvilt  rrau pot4optn ietltfs2ran ont4tlxomo oadfatelnvi s0 2to(r3oodlmtnmnvtls)aDurx ooo1aexo fcilsla um( pnu4aetnifcoydfa e ivo;s0srtmxm3no4omt  iesls srurxr no0tpxnifetat mDum(mo (4areoif3iodfm e n s s0s2ur(rpny1lmtnlnesls sDtmx oou0ape mf3iytfs2ranvp;u0arxomr todla eau slt t2tr(opio4apt mies tfsDrrx oot1texnif3iasfaDrmnvs ()artrmfcoatoat  u s s0s2uo(o io4lp e neia(f ruaur ot1aptnii3tldla eaums;t4tltoir3oadoaDr nei s0seuoxr3iy4lleelnctl()sDrr(r no0aexnmoetlt aDea(vp;t) lerircoytfm r ues s0truo(rpno4lpt lnei tfs2taumpnu1alt iieildla2ua( o;(0 reomrcoy1lm eau o t trtoxrpnu1lpenmiesl()arumx p;o4apto feiad a2ra(ms;u)alenxr3iodomteauvs;s  eurxm3iodlmt lfeil()aDrrxm no0tlx  feilt m2ulu o;t0 lxrmf ootfm ranvi;t)s2xoxr no1opt lfei ( arrr( p;o0tpeomo3iytfa2raumon()trtnmf3tydla  lu o s t2tmio oy1ole mnesltfa2rm(mo;t0olt mfeiltla rlumon(0 rtomf3ty1fm rauvi;() 2umxr ny4lp  lfcsls)a2ta(mono0tee mfeiyt s2ulums t0 exnxr3iytlmD  ivslt0 etm(m3oy4lpenmfcilt srtr( onu4oltoioctasla2elnvo ()aetomf tatfptraivsls0 2xoxo3io4al   neiasf rrmxrpnt4opt  o3iytfm2ulu s;t4aeeomrctadlp rli o;t0 rxm(m iudal emict t)s2ua(  ot4oee moetysfa ul( pnt) rermf3iytopDeauvsl() eumim io4alenmfeia( aDuauroou0tlxn ietldfaDrlu o;t0texoir io1laDeanesls0seumxo3iydal  liesltfsrtm(ro;u0apx moctydls2ean s;u4 reoxo3tatlpt  ivs (0s2xr(mpou4altemivtlsf 2rmxm no0optomicilsfm2umu snt)areoxf3ty1lpDelivi t t2xrio3iydll  mivtat) rraxm ;u4teeo f3ilsfa em( o;u4teenxf3tydoatr n o;t0trumim iydlp nmict () Draxmo;u0apenmoeildfsDrlu snt4 rxoxr3todfpt  uvi;t0srtrxr iu4oltnmfviasf rrmur oo4opeo f3tldfs2eluvp (4alxrmr3tytoaDrluvolt seumxopnydlptelfviasf rtmxroou4tpeoii3tlsfaDum( pn(0aetoxr3oatlm rai ols srtoir io4om nlnet sfa2uaxr nu4tpt  iciasls2rlumpnt) exrio3ta1omD an i;(0s2umxrpoodolee nctlt  ruax  no1oexomicils m2umums (0 exoxr3totlatrau s;s0 rumxr3oo4lmenmieilt  rtr(  nu1oexn f3iatfs rl(vsn(4 exrir oytlmtrlnei t) etrxm3nu4altnmfcias) rum(m ou4oetn feild aDumnmo (0altrif ta1om e ivs;(0trxo(o oudomt mieslsfa2trx  nu0alen o3iasfa uauvp u4 exrir3ta1omt aieo t)tetoimpiy1ll n feil(f rrm(  no4aee mi3iaslm eln s;()tltnmo oytfmtelivs;( trumxm io4amtemietlsf Dururp;t0apeomi3tytfa emn on(0texrxfcta1oaD  ivi t0 2trxo3iodlp emieias) 2taxmoou4oeenii3ias a ranmp (4aeenxr3oa1lmD  ivi t) exrxm nydoptnmfvs t sDurxmpno1teto ictyslsDeanvs ()tltoio3ia1fp rln o;s0 rxr(opoodamtnlfvia() Drmurp;t1olt ioeilt s2ulu on(0teerxo3ty1op elnvo;( s2toiopoo4ap n ivsasfa2urxmo;u0tetnmiciytfm2elu p (4 etrmo ty1omte u s;t0teuoxmpoy1lm n iesa()arumuroou0tlto ociat m umn s () ltniociy1fpDr nvo (0 etoimpnudom elnes t a2rrxrpot1ole iiciyd m2emnvon(4teenirctytomtr uvi;s) rtrxr3iy4lpe miciat)arua(ro;o1opx  oetas m ea( o (0arenir3iy1omD an i;t0sexoxr3nodllte fcsatfsDrr(r nt1opxo f3iyd s rm(vp t4 eeoir3ia1faDelivo s sexmiopiu1alt  icilt  2tmumoot1opxn i3iysfa uln p;t0tltrifctodfpDrln i;s)srxr(r io1lm   net (farraxrpno0apxn ictlslm uluvo;(0artoiociatfp r nvi s) etoxm3nudoltemfvt s arurumpnu4aleoiieiatfmDemnmp u4trerxocta1lpt  n i s0seurxm nudome  nesatfarua( p;t1tlxoifeiltfs uan pnu4teeomfcoy1lpDeanvo;t) etoio ny4ol n ivtlt)aDta(r ;o4tptn ietadlaDeaumo;t) rxnxfcoodoaDe uvo () rxoim3ny1lpe  ictl()arta( o;u0ole ioetld s2uauvp;u4alermoctytlpD  ivo s0 euoio3oodop nlncil(farrmu  nu4oetniieiytlm eluvo t)tetomfcia1opDrln ils trto(rpnydaptemicslt  rumxr ;o0texnmieiytla elu pn()alermr3oodlpD lues;s  rurir3nudome mnvilt)aruaxrpnt4ape  fcild a rm( p ()tlxoif3iy1om eai o t sexmir3iy1ll e fesl() 2tr(rpnu1apeo ociyt sDuan s;u) ltnxo io1lmDrliei;t)t2uoxrpnu4omenlnvs sfs2tm( o;u4oexn octldfa elump t4 ltoxocoo1la rli i;t0 eumio oy4ol nlfcs s arrmuroou1tleniociyt m2ulu o;t0 eenmf iadomt lueols0 exmxrpoodop nmicsl( srrrxr nu1tpenifetasfaDel( o;u0 eerxfcoo1fmD lu s;t)sexoxm oudomtn nei t  rrrur ou4tet mictatlm2ul(mpnt) rtnxf3oydfateln sls0 etmiopnudol n icil(f rtmu pnt4tle  oeiatfaDulu p;() lxnxr3tatfmt aieols0s2tmio3nudll  livslt a2trurpot4tlxomieilt a2rmump u0tltnio ia1fpt auvils)sexr(r oo4lme micsa()a2tr(rp;t0tetn iciasfa uaumont) exrif3todfa rlneils) etr(r3nu4alte fvs (fa2ur(  nt1texn f3iyt a rauvont0aeeoxfciydopD auvo s0s2urim3ou4llt mnvi sfartmumpnt4oex mocils m ua(mo (4trerxfcoatfa r ivi t) etm(o nu4ap nmnvtlt)a2rmxmonu4alen oetyd s2rauvp;t0teenmr oa1opt au o;(0 exoio3iodapen netl( srrm(  oo0openifeiyslm2ran s;u4 eeomr3ta1laDrli o;s)seur(r no1alt  fes (fsrrmump;u4ope mfeiat sDuluvsn(0tetnmrciotomtelies s0t2urxr iy1al emfvia( sDrmxrono4alxo ietlsls rlump;t4treoif ia1lpt  uvi;s t2ur(m3iydom nmnesl() Drau  nt4optnmieiad mDea(vsn(4teeoif iy1omtraueols) eur(r no1amtnmivt tfarua(r ;u4oleomf3tlsfaDrl( p;u0 rtnxr3tadfateluvo t  ruriopoo1aptnlivils artmu  nu0apxnii3ias m2ea( pnu)trtomfcoo1opt  nvs;s)s2um(o io1ope mfetasfsDtmxr nu1opt ioeiad m2ulnvp;t) exomf todomD lueslt t2xrirpny1lle mfes tfa2uauronu0olxniieiad sDrmnvon(0 eerio3ootlptranesls)tetrirpno4al n ics ()s2rm( pou0tpen feiasls elnvs;t0arerir iatom  livols  2xm(r3oo4ll nmnviatf Duauro;t1apxoii3iytfm2el( p;(0teermoctydlmteai i;t0 exoim nydaleemiesas aDtr(  ot1aeto ictatfa rln ont0tlenif3iy1laDr ivsl()t2umxr3nudape licilt)sDum( oot0optomo3ils sDelu p;(0altoxociotlmD  i ol()t2tm(m oy1ol  mictasfarumum ;u1aex  iciyd aDumnvo (0aeeomr3tydlmD livs;s s2umim3ou4ape mfet s) rua( pno4apeo ieilsfs2elumpnt4 etnxocto1om rlieo;s) rtr(m no4ll e fvtat)srtr(rpnt4tpt mf3tltfs2ra(vs (4 reoxfciytlmDr i ol(0seuoxo ny4am emiei () Dumxmoou1tpt  oetatls2ean snt4trenir3iytomt  n s ( srtrio ny1lmen nvilt)a2ur(mpou4tlt ifctytfs2rlnmp t4 eermo3totomteaivilt)srtrim nudap n nctlt  2urumoou1optn feiyslm2um(mp () rtoxf iodlm  anvo;t) rurimpoudlpe mici t)aDrauronu1tet  fctytfs2ul( s u)tetniocto1fmtr n i s seumxr3oydlptnmnesa() rra(m ;o1tlx if3iyd sDuan p;t4 rerxf3iodlaD auvs t  exmxm oo4lptnlivsls aDrrxmo;t0alxomfeiltlm2elnmpnu4 lxoif oy1la   u o;s t2xrxopny4lmtn feiasf Dur( o;t4oexo fctytfm2eln o t4texrmr io1latraiesls)tetmio ou1op nlies ()artaxr ;u4oet mi3iysfm el(msnt0alxoif todfmDelnei;s0 etmir oo4am elieilt a2rauro;o1oexomfctysfm2uaumonu) ltrio to1laD an sls)s2xrio3oo4lp   ict t)s2rmxm ;t4alen ietldfa2eln pnu0arermr tytlate uei s0 etmimpoy4alen fcta(farur(m no1olxoif3tltls el(mp u4tlxomf iotop  ln s;(  etrxrpoo1altnlnci sfaDuau  no1aetomietlsls2uanms t4altomfciodomt luvsls sruoxmpiu4op n feia()aruau pot1oetniociltla2ulnmont)aeenmo3iotfaDelieil()truoxm oudap  lnctlt)aDrrx pnt0texn ictls m eaump;u4trxrmrciy1oate nes s  etr(m3oodamenlfvs s)s2rau o;t0oetoioeiatlaDumu p () lxnmr tatfp elneilt trxoxr3oydame lictls)a2taxrono0tpxoifciltla2ea( o (0treoifcootfpt  ieo;(  2xoir3oy1ol nmncsltf 2tax o;o4ole  oeildlmDrln s;t)aetnir oodopD  ueil()setm(m3oo4op emncsa(f ruaxmono1alenmieiytla2emn on(0artomr3ty1om   iei t srtoxmpnudol  mfesa( aDtrxr ;t0oltnii3ils m ea(mp u) lxoxrcoa1lpt  n o t  2tmxo ny1ap emfcsatf rrmx ooo4alxomo3iytfs ran p;t)tlxnmocta1op rluei;s0 rtmxopnudomee ictatf 2raumpnt1opxoifciltla uan p;t4 rxoircoadlpt anesl(0trtrxmpiy4omtnlnvtas)srurxmoot4alxo fetltfmDrm(msn()trerxr oa1fm elueo;s0 etoimpiu4aptn fvs s)sDumu poo0tpt ioetadfsDem( p;u)trxrircoatfmte n o;t0teto(opoy1om elicilt sDumu  ;t0tex iieils a2elnvs u0 reoxo todlmDelu o;s setrxo nudlltelivtl(faDtr(r nu0tltn f3tysfm2rlump;(0aleoxfcty1fpD aues;t0s2tmxopnodll e ivs ()s2trx ooo4olt iicias a2rauvonu)trxrmrctodfm rliei;()srxoxm3oy1om  lneiatfsDtmuro;u4alx ifciys a2um(mp (0artrmf3iy1lmtrauvsl()truoio io1omtnlfcias arrruro;u1tlxomieils sDeau s;() ltoif3ty1om eaiei t  exoxopiu1optemneils) 2urxm ;o0oetnmoetys m2ulumo;t4aeermrcoadla elivs () etoir nudlleelictls  Dua(r ;u1apeoii3iytls ua( o;t)aeeoif oydfmt  iei (0 etoirpoo1omt miet t)a2rmurooo1texn ociyt mDel(ms u) ltoio to1lm eai o s0s2xoxo3io1omenlnvs ( aDrax p;u1oexn f3iad m2um(mo (4 eeoxfciodlatelies;t0t2xr(m3nu4ll   nci s  2rrxmp;o0texo octysfs2ulu s;t) rxnmf ty1omD lies s setm(o ny4apeemies ( aruru ont1tee mietyslsDeln pnu)aetrmr oo1fpDeai ils0texo(o oo1am   fetlt  2tr( o;u4aeenif3iytls2eln p (4 rtniociytfpDeau s;s0 2uoim nu4altn ivsasfaDrr(m nu0tlt ifetlsfaDumuvp () rxoif3tytlat lnvsl(0srtmio ou1optelfei s arra(mp;u0olen ociydls2rluvo t4aetnmf3oatlatrluesl(  rxrxo io4ol  licia(f Drax p;t0texn fciys a rl( snu4 ltnioctatoaD aueols0srumir io1ope lfvs s)srrmu  nt4oexo fetldls uaump;u4aeeomf ta1opDrai s;t0srxriopoo1al elnvt s)sDtaurpnt0tlx ii3iytfsDeauvs u0 ltrmr iydfpDrauvs;s) eurir3oodaptnmnvt (f 2rm(mpot0apxnmo3iytfsDel( s;u0tlenxo3ty1lmt  u i;t trumxr3iy4optnmnvs t) Drm(m ;u4teeomo3iyt aDel(vp (4tlxnmrcty1lp r u olt s2xo(o oo1apee fvsasf ruru pot0oleomoctadlmDelu o (4 lenio3oodlm e uei t)s2toir3oodalt livs s srrrumont0tptnmi3tasfs2el(vsnu) etnxr iydlmD  u s;s) rtmimpou1optn feiat a2rrxmpno0alx  o3ils sDelumo;(0 lxoif oy1omDeanvilt)srto(o3iy4ll n ivtat srurxm ou0olt moetadfaDrlnvs t4trxoir3oo1lm rau ols sexoio3ny4om   fet s a2umu p;o0aex mi3tysla2rlu pnt)tlxnxocta1fm  auvi;(  etrxrpoodlm  mfcsat sDurumoou4opeomfeildlsDrm(msnu0trxrif3ia1fmt ai o;s0tetmim no4altnmneilsfsrrrumpoo0alt mi3ils mDua(vp;t)aeenmocty1lmteanes () 2xriopiy1llte ncslsf Dtax  ;t4tpto f3ilslm2ua( snt4 etrmo3oadomDeaivol(0srurxo3oy1lle lfesas aDurx p;o1alxnifeiatfmDelu o;u0aeermr3iotoaDelu i t0sexrio oy4opt mfci (  Dtaxmo;t4oetn oeiyslsDemums u) eenxf3oa1oat ln s (  rxmim3oudlp nlictl( a2rrumono1alen ietld mDumuvs;u0tltnmr3ootlpDrlieo;t s2xoirpnu4op nmfcs t  Dtmxmo;u4oleomieias mDrl(msnu4alerxr tadlm e iesl( s2trio3oodlmtnmncs s)arum(m ou0tpto fciysls2rluvsnu0 etoif3oodomDe ivslt0t2xmxopiy4ome mfetl(  Dumxmpou1oeto fciyt m2emums;t0teerir3iodlat auvs;s0setoxrpoo4aleemicsat sDumxmpno1tpenio3iydfaDrmu o;() lxoxocoa1fp  anvols0srtm(rpiydomee neia(f rrmxmooo1aet iieiasfs rm(mont4 lxrio iadlpDrai i t0 rto(m3io1ameemncia(fs2rr(rp;u1apxo i3iad s2el( o;u)areoxf tytoat  ieo;t srur(m3ou4om n net ()aDuaxmpno4teen feildfs uauvp;t)arxnir3iodfm   uvi t0 2toxr oudomee neiat aDtmu  nu1opx  f3iydls ulump;()trerifciotlmD  ies s0 rxoxm no4ome  ictlt)arua(mpno1aet mi3tydfa rlnvo;t0trtomocio1fm  an slt)t2xrxmpiydlm e fvias sDuax oot1aet ifctytlmDum( p;()tetomf3oa1laDelnvols)trurir oodopeemfesas sDrax p;u1apt ifeild mDelu o;(4 leomr oytoa rauvs t srtmir3oo4om   nvta(fs2ta(  ot0olenif3iysfs2ra( s u4 etrif iadomD anesls texr(o3oodop elnctls aDrauro;u1tex mfctytfsDuanms t4 etoif to1opt au il( t2umxopiu1lmeelivsat) Dtrxrpou0oeeomfctltlsDeanmo;t0arxoxr3ty1lp e ueils)seuoim3ou1om   fcs ()arumxm ;u4optnmfctatlmDrmn s;u) rtrmf3tydom  au s;( s2xoxr oodlmeelfci t)arum(r ot0openmfeiyslm2umumo;t0 ltoxfcto1oaDrluesls)trxoiopny1ol emicil()aDur(m ou0aptnmoetatls ua(vpn(0 lenxocoadfaD  ueo;s s2xrio no1ape mncilt s2tm(m ot4altoiictytfa rmu o;u)tltrxfctodopDe i i s)srxrir3nodope livsa(f Dtmuro;o0opxnifctadla2rlnmpnu4 lxnxo3ty1optr ueo t texmxm3ny1alt  iei s  Dtm(m oo4aleniicildfs emnmo (4aetnxf tytlaDranvols0 euoxo oy1lmee nes s) Durum ;o4tetn ietasla ra(vs;(4trerir3tadla  lu ils0 rto(o nudalenlfes sfartruro;u1alx mfeiadfs ran p;(0 rermfctadopDeaivs s) 2um(opny1op nmfvslt)sDtm( pno0olx mieildla2ranvs u0tetrxr3io1fm eauei;t seurxo iudllenmfet s)srururpoo0texomoeiys m2rln on(0texnmrctadfmtrai o t0tetm(rpny1al nlivtatfsruax pnt4texnio3iyslmDrmuvs u)altrircia1fa  aivi (0t2trio no1lmt lneil(  Drau  ;t0tex mo3tatfsDrm(vs t4 renxfcoy1opte ivo (  exrxr3oodom e fciat srra(  nu1oetomictytlaDemnmp (0trxoxf3totoate i i t tetm(o3nodoltelnetat s2trxr ou1tetoioeiyd mDrluvs;(4aexomr3iotomDrlivo;t)setr(rpiy4lmtnlieias)a2ua( p;u1oex miciyslmDem(ms u4altrmo3iotfaDr n i ( t2trxr iy4lmtemncsa() rtau p;u0tptoiictatfs2emnvo t4tlxomoctytop rli ol(0 etoim nodlpe licsatf 2ta(r oo1alxomiciyd s rln p;t0aexrif to1opDe ues t)srumxo iydapeelnvta()a2rr(ro;t4aptomicilt s2ra(mp;t)teeoxocoo1omteli o;( t2umimpno1lpeelfeil()aDrm(  nt0tlen iciytla ea(mo t)treoif tatop  anes;(0srxr(r3oy4alt liciasfsrtrum ;t1apenifctad a2ulu s (0texnxrciatoa  au s ( seurxr3nu4om   feiat s2trxmpou1aeeo iciyslm rl(mo;(0 eenxr3iotfp elivsls s2trir nu1lm   fvtasfaDrmu  no1aeeniocils a rmums;u4 exrmr to1oatrlu ols0 etr(m3io1llenlfcs t  2tau onu4oeenmo3iat m2ul( p (0 ltoxf3oatlp   u i;t0trtm(r ou
\ No newline at end of file
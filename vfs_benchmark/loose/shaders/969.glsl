@@ -0,0 +1 @@
+ueo;s0 exoxo3iy4lptn nes tfsDrr(m oo4aex mfeiasfa2emnmp t) rxoxo ia1opD anei;s teurxo3ny4lp n ietatfs2rr(rpnu0altnmociytfs el(vo;u)aleoif iytfm raivil(0sexoxmpou4aptemnet (fs2ua(m nu4ale iicilt s2ran o t4texrmo3oy1fa rauvols)seto(opnu4alenlnci sf 2trx oot4tetn ieilt s ra(vp;t4arxnxf3to1lm eli s t0 rum(mpio1alt livtl()artax  ot4aleoii3iysfm rauvs u4arerxr iadopte iei;s s2xo(m3nu1llt mneia(f Dtmu ooo1aexniieiatlm el( o t4alxrmf ootlptelneils0truoio oudlp n ncias sruax pno1aptomiciat s emump ()arxnxocoy1oaDe nvs s0texoim ny1aptelnetasf rta(  oo1opxnmiciydfmDelu s;(0arerxo iytlat luvi;s0t2trxm3iy4apt mictls aDuaumoou4teeo iciasla2ua( o t)artrif3ty1fatrlivo t0t2urxm3oy1lmtnmict ( s2rm(r nt1alenmf3tlsla2ean pn()alermrctatomtr ues s)teurxo iydaltnlnvtlt  rtaxrpno4oltoif3ilslm umuvsnu) reoifctadop  lneolt trxmxo nu1omt  ietl( sDum(m ;t1alx ioeildfaDulnvs;u)trxniocoadfp   nvi (0s2xrxopoo1ap emiesl( a2tmu  no4tlt  f3iyt m rmn o;(0 ltoxociodlaDr ueo s)trumxm3nodlme  ietlt arumum ou1oetn oeildfmDrluvp t0trtrif3tytopteaieil(  2xo(o ou4ol emfctatfsrumu  ou4oee  octyslmDum( o;u4 lerio ty1fptelies;( t2uoxr ou4omenlnesa()s2rr(  ;u4oeenii3iydlsDemu s u4 lerxoctatfpDrli slt0sexoir io4llenmncsat)sDuax p;t1ole mi3tad m2ra(msnu4tetnirciodla  luvi;s  2tr(o3nu1al n iviat) rrau p;o1aexoiiciys a emn snu)artnif tytfateaues;s)srxrir nudap n fci sf 2trurp;o4aex mf3tlsfa2ranmpnt)tlenio3iodlaDeln ilt0 2tm(rpnydopee nvsat) 2ururo;t1optoiietldls rm(vp;u4tlxoirctytfat luvolt  exmiopiy1lm elnct s)artru  ;o0alxo f3ildfa emn o t0 lxnmrctadfaDraneslt0teuoxm nu4lmtnlieta(  2tmx pnu0opxomfetytlm2rau s u0trerif iotla e ies () rxm(rpnodalee ncias sDtmxro;u4aetnmicils s rlu o t)treoxf3iytlate n ils)t2uoxmpiy4om emictls)sDrr(r nt4olxomietyd sDrln p t4trtoifcty1fpt aneo;()t2uriopou1ll  micil(fsDuru p;t4teen i3ilt s2rlnvonu)tlxnmo3ty1omteluei;t0 rxoir3nu1omt livsas  Drrxronu0opx iieiadfsDean pnu) lxoxf tydoa  lueols)t2umxm oydlle livs (  rtrx  ;o4tptn oeiysls2umnmp;t)aetrio ia1oaDrlneo;(0trto(r3ou1lleelfvi ()aDtmum oo0tleoifeiydfm2umnms;(4 lxnif iodfmD  nei;() 2urio3oy4lle  ieiatfarrmxmpou0tlxnmf3ilsls2em( p;t4aexrir3oytlm  lu s;t) 2xrimpoy1amt lfvt s) rurumpnu4tpxo f3ias sDrlnmp t4 rxrir3iytoa eluei;()truoimpoudame  ict ()sDtr( pou1teeo f3tldfmDrmnvo u4tlenir oy1oaDrlu s s0 2triopny1lmee iciltfa2tm(mo;u0olto i3iatls elu p t4 lxnifctadfptrlnesl(0truoim3nudlptnmivil(fsrrmur ou1texnmfetltfmDelnmon(4teenxf iydlmDr i s ()srxoim3nu1alenlieta(fartr(mo;o0tpx mi3iysls em(vo t)tlenmf iatlmtelueslt) 2xmxo ou4ol nmiet sfa2ra(root0texo o3tasfm2rm(vs;u)aeenxocoy1lpD  ueolt  rtr(m oo1lleelnct ()srtm(mp;t4aptoiieiaslm rl( p u) exoxo3oodopD an i (0srxoim3iu1om emnctls)a2ra(mpno0opx mfciasla um( pnt4arenxo3ia1oaDr u o t  rxrxr3ny1lmtemfvtas s2ra( ono1tpxniieiad sDrl( s;(4 etoxo ty1oa elneils)texoxr iudap elivil(f 2tmurpou4opxoiietasfaDeanvs;t0 lenmo iadfp  aiei;s) rtr(r3oudlmt lfei () Drmurp;t0tpxo oeiys m2rm(msn() rxoir3iy1fmt livs t)texr(r3iu4ol elnvias)aDrax pnu1oleo iciys a ran s t)arxrxr3tydlmDrlues s  exmir io4apeemnvtas  rta( ooo4aexnifcils s rln pnt) etrmocoydoa e u i s0 exoimpoudopte icsat) Dur(rpnu4apxn o3tls a elnvpn(0arxrif totlmt ai olt) 2uoxmpiydaptnlnvt sfaDra(ront4oleoifctyd a2el( p;(0texnmocto1oaD  n il(0sruoxm3ny1amtelfciltfsDtrxm no4oexo ietadlm2eaums;u4 eeoirctatopDrlueols  exoxr3oudlptnlivs s)arumxm ;o0oeeo ictyd mDumn s;(4alxoir3oodlmDean sls sexoir3no1ll nliet tfarraxr no0aetnmietydfs elnmo (4aetnmr iodfm rliei (0t2to(o no1ol nmnvs ( arraxront1oetoif3tlsls em( o t0aexrmo3iodlmtrli s (0seum(m3ou4amenlfvtltf rrmum ;u1tpen ictltfa2ulums;t) renifctodfpDeau olt0s2tm(o oy1apee net ( aDrrx  nt0oeto fetls m ra(vpn() rtoio3oy1laD ln o (0 2umxm3iodole mfct (f rua(m ;o1olxo i3iat s uanms;(4treoir3tydomt  nvo t seurirpoydlmtnlivilsfsrrax  ;u4altnifeiadfsDrl(mo t)teeoxf3oatlptrlies;s)trumimpiu1am  lfctas)s2rrxrp;o0olen fctysfsDum(ms;() eermf3ty1fm raivs;t  2xoim3iodam   net tfaDrmxmo;t0apx ifcilsfa2ra(mo;t0 ltoxrcoytfaDeli sl(0tetoxrpou1al  lieils artm(  ou1opxoiiciadfaDumu sn(4 exoif3iydopte ues;s  2uoir3iu1ol   ictls) Dtrumpnt0apenmf3tasla2uan on(0alermocoodoatraieo;(  rtoxo3iy1lpe lfvt sfaDtaum oo0oeen i3iyd a elu pn(4aexomo3iytlmt lnvo;( tetm(o3ny1al elnvtltfa2tmxr ;t0olt mociatla2ean o;t0arerxrcta1fmtrauvolt0truoio3ny1lm nlfcilt  Dtr(  no0olxnmictasfaDea(mp (4 rxrir3oydoaDr u ol()srxoxr3iy1amt  ieil(fsDtaxr ;u4ope  oeiyd mDua(vo t)aeerxr oatfat lieo;( srtmxm nydomeelfesls  Dtr( pot4optnifeilsls2umnmp (0trenmf3oatlpD anvsl(0s2um(r3oo1ame mfvs ()srrmxroot0oexoioetadlm umuvp ()trenif iadopD  uvs;t  eumxr3nudll  mncta()s2rrxro;u1aet mfciat aDrlumpnu)altrxf3iodoate u ol()trxmiopiy4ap  lnetls)srraxront0apx ioeiydlmDeln s;u)tlxnxo3io1fm   nes s0srxrimpiy4ame mfvil(f 2raump;t0oex  ieiytlmDrm(mpn(0 eeoxfcto1lp e n s s) rur(opiudamt mivt tf Dtruro;u1alxnif3ias s2ul(mo t0 rerircootlpD luvi;t) rtr(r3io1am emnctltfs2ur( o;u1tptn feiltfa eanmo;()treoxocia1lpDeau s s)t2xm(rpiy1lmte fctlt) 2raxmo;t0olxn iciyslm umnmp t0arerxrciy1laD  nes s srtr(rpny1ap  miesls)srtm(r ou1altomictyt m ea(msnt)tetnirctytfp eauvi;t)trtmiopoy4ol e fesat sDra( p;u0tlx moctasfs2emuvs u0tltrmf oadfmDr i o;t0texrxm oo4alt mncsa( sDrmurp;u1tleo fcilsls rm( p;u0 eerxociodoa r ieilt0 2xo(rpiy1opt mnvsas) rtaxrp;u0opxoioeiydfa rmu s u0aetnirctatlaD lies t texoxopno4ale  fcia(f 2tax  nt1olenmfctaslm uluvo;t0 rtrio ta1omt lnei t)t2umxm3iydlmt  nvsasfsrur(mpoo0oeeomoctadls2umnvpnu4 eeoxfctodfpDe ueilt)sexoxm3nu4lp n fvta( srua(rooo1aee ifeiyt aDrmnvs t0artoxociy1omte i s;t)trxoxmpno4optn neiat)a2tax  nt0olt mf3ilsls el( s u0aexrxo3oytoa   n o (0 etrim3oy4lpen feil( s2ra( o;t1aleomi3iaslmDem( p t)tlerirctytlm elueslt  exo(m3no4lme  fvtltfa2uaum ou1opxo ociltfm umnvs (4 etoxo3iotfa raivi t0 etrxm nu4opt mfvia(fsrrm(mooo0tltoifeiydfa2eanmpn()altnir3oo1om r ueo;()s2xoimpio4amtnlnei tf rumxr ;o1opxo f3iadfs elnmo (0tlenir oatfmt auei s  ruoxmpiy4olte ict ( s2ururo;u4tpt mietyt s2em(vsn(0aexrmociytoa eauvil(0 2tm(opiu4oltnlfetls srtmxmp;o4opxnifetlt s2um(mo t0 eenxocoydfpteliei;t teum(m iydlm emfcs t srtmu pno1alen f3ilt a eauvs () ltrmr io1fpDeaueols0t2xr(r3io4ome mfciasfaDrrx  nu0oetnmf3iys s rmnvp;(0alxrifcootoa rlnvs s  rtm(o3iudllenlfetltfsDua(mp;u1tptnmo3iltfs el( o;t) rxnir iydlm   i i s)s2um(o io1lp elictl(fsrtru pnu0tlxomfctltfm umumont4trenmo3oatfm r ueo;s) 2uoxo3ny1lpeelnes (  rrm(  nt4tleomociat s2uanvo;(4tlerir oytlp e i s s trxmim iy4amenmivs sfs2uru o;o1tptn icilsfa2rauvs;t0aetrxr tydfmDean slt0s2tmxr3iy4omen ivsasfs2rru pnt4altnmietasls2rmn o u0alermfctotlp raneils s2xmim nydalt liet s)srrmu  ou4opxn feiltls umnmp;(4 lxrmfcoy1om r uvols)sruoirpno4ale  nvil()s2umx ono4tpx  o3ias s rauvo (0tltnmf3iatfmte neils0s2xr(o nu4amtnmictlt  Durur ;o0tlenmieildlmDea(vont)teerxr iadoateanvi;(0 eto(mpno1aptemncils s2rr( o;t4aee ifciasfs2eauvo t4tltrmr3totla rli i;s  rxoio nodope livi s)s2rr(r nu4altomo3ilsfm emnmsnu)tetnmocootlpDrauvi s) exr(m3iu4lle  ivi tfsrrmxro;t0oee ifeilsfa rlnvo;u0artnmoctydoat lnvsl(0 ruo(m3iy4ol n nvia(fa2ra(rpnt0tee  fciys m2umu s;(0 lerircty1fpDeaivo;t  rurio3iy1lmenlivsa()a2uau  ;u4olenmieiasla umu onu4texnmr3todfmDelivi;t  2xr(r nu1ap   fet t)sDrax  ;u4texoii3ilsfa um( pn(0teerxf tytlp eaivi;s trtr(o3io1ll  mnei ( aDta( o;t0oltn feiadfm ulnvs t)trerio3tytfa eanvi ( texoio3no4ol nmicia()sDrrxmp;u1texnmoetasfaDrm(vo;()altoxfcoodoate i o;()t2tr(opoy1apt mfei ( srrau p;t0oleomictltfm ua(vs;t0aetoif3oadfpDe uvs t)s2trir3oo1ll nlfcsa() 2ra(rpnt1alx  ieiyt s2um(vpn(0 eerxr3todop r nvo;t0 2toirpnu1amenmneil( sDuau  ;t4olxomieiaslsDrm(mp t4tetrif iadlpDeluvo;t  rtoxo no4olt livtl() Dumxmo;u1opt io3tyd a umumsnt)texnir3iotlmt livil()teuoir3nu4ol   icta( srrmx p;u0tlen ieiaslaDem( onu0 lxoir tytla r nvi t  rxrim nodlmeemfcsls)s2urx pnt1opt  i3tyt a ea(monu0artomrcoy1latelivs;s0t2xoirpoydopeemfcsat) rurxronu1tpxn oeildfs2emnms;(4 renifcoadfm eln sls)texm(m ny4ole mfctlsfsDtru ooo1opeomf3tysfsDumnmpn(4teenmo totfa rauei;s)setoir3iudole mnvs t)srrr(rp;t0alxn ieils s rln on(0trxrmf ia1om   i s;s0s2to(opnudaltn nvtatf rtmur ;o4aet  feias mDranvo t4 rtrircoa1omD lneols0teumxm iodolt  ieia(fsrta(rpnt1optomfctltfm em(mp (0arxrmr ia1fp eanvi;s trurio3ou1lmtnlivias artrump;o0apxoiietad sDelnmo t4teenmf iatlm e u ils0texmxmpnu4ap e feias aDrrump;t0apen o3iatfa uauvo;(0artrir3ta1optrlnvolt0srurir iy1alen fvil()s2rrurpnu0aexn i3tlslaDemu p (0 rtomfcoytfmtr uvi;(0trxrio no4ape mncsls)a2rruront4teen ieildlsDuanmp;u4 rermo todomDrli sl(0 rxrirpoy1al emicil( s2rmxmoou1tpxo i3tydls em(mon()aeeoir3iydfpDe i o t sexrxo3nudame  fet s)arra(rpno1alxnmfciys s2ul(vp;t4arxrifcoytoat ai s (0tetmir3iodoltnlnetls s2rrxr ;t0apeoio3tytls umn o;(0alxniociotlpteluvil()trtoxm io1lpte nci s)aDtmu ono4alenmfcildla2eanmpnu4trtrxocoatlptrlnvs t0teum(r ny1aptemfetlsfs2rrx onu0opeomfctyd aDuluvpn(0alenxr3oydopt anvsls)trxo(m3nydlltnmnciltfs2taxmp;u0teeo fctydfm uauvsnu4trxrxf iatoa r iesl(0srxr(mpiy1optnmiet ()artr(  oo1olt  o3iysfsDumnvo;(0 renifcoo1fatraieil(0t2tr(rpoudlpee ies t aDra(mpno0optomictlt a2emnvp t4alxrxf tatfat  ivolt)texm(m oo1ll   feias)srra(rp;o0oltniieils aDumn p;t)aetnmf3iodlmDrlieo;()seuo(o oy1ope mfei sf Drmxro;o4oltnmietydfa2rlumsn() exnmr iydopte ueo;t tetrir iu4alt mnvi (fsDra(m ;o0teeomi3iytfm ul(mp t0 etoxocoatopDelneo ()setmio oodamen ictasfarta(mo;t1oex  f3ilsls ra(vs u0trxnxf3tytfaD li o;t)trumirpiydoltelicsl() 2tauroou4olx  ictlsls2umuvon()arenmr todomte ues;s0srumimpoo1om   nvt ()srrm(r ou1olen octysfa em( p u)artnmo oadfp r ieo s) eur(mpnudll   ictasfsruau poo0oetomociasla ra(vp;t0 ltoircoy1lp rlivils  2uo(m3oy1amtelfeslt  Dtm(r oo0oltnifciad m ra( onu)tltnmocio1fmt lneslt) ruoxo3iydom nmfcil( aruaump;t1apt iieiydfmDuau p u4aexnmfciy1fm e i s t0 2xoxmpnu4ape lics t)artmuro;t1oltn feiysfaDulu p t4 reoio tatlptr neo;s0 2uo(m3nodolen ncsas) 2rrx oou0oexnmoeild a2uaump ()trtnmr oa1la elivs s0t2xo(opio4ope lnct s)sDtaurpou1opxn f3iydla rlu p t0 lermf3iy1oaD aues s teumxr nu4ole mics tfa2raxroou1apxn ociysfsDuaumsnu)alxnio3oydfpt anvo (0sruoxr nudlmen iviat)s2trxrpnt0olxn ocild sDrln o;t)teenxo3tytlaDe ies;s0srxr(o3io4lptnlieias)s2um(  nu0ale iietadlm um( o t4tetoif3iydlp ranvolt) 2tm(r3io4ll   ivsas)srumxmonu1opt io3tyslm2eanvs t)arenxf3tytfmD  u s (0 etrio3ou1omeelnctat a2rau pot4tlx mfcilsfsDrl(vs;t0 lxnmfcia1fpDr i olt) rxoir3ny1ameemneilt)arur(r oo1olt iiciltfm2ea( s;()tltomfciadom raieo t0srumimpno1ll nmieslt)aDtaxrpno4tex ifcils m2rmnms;(0 ltrmrcio1fm rlivo;s) eumiopio4omt lfeils  rtm( pno1olt  ieildlaDemuvont)tlenxrctatfpteaues (0texo(r3io4lmenlfct tfarta(r nu4ole  octysla2emn onu) etnxr3oatlmt  iei;t) 2uoirpoy1amtnlieiltfs2rmuront4altnmf3iltfsDrl(von(0 rermfcio1lmt auei;t srtrir ou4omtemnvslt) rtrump;t1olxoiietadfm2elnvpnu)tetrmrctydoaD liesls0s2toxrpiudll  lfesltf 2uru  no4tpx miciyslm2elumo t4 rtoifcto1lmDelivo;s)s2tm(opiu1ale micilsfartmxr oo1aeen octyd aDua(von() lxoio3oo1om r uvi s sexrirpiy1oltnlfcsas  rtau ont4oetoifetytfm um( p ()trerif3oo1lp eauvs (0trtmxm3no4omt  fei sfsruaxmo;u4tex  fcilsfs emu sn()aeenio ootoa   n o s0trum(r nodaltnlfesl()arrau  ;u1optn oeilslm2ua(mpnu)arxoifcoa1omDr neo t  euo(m3iudalenmnvtls sruau poo1tpxn feiltlaDeau p t) etnxocoadopD  neo;( srtr(o iy4omtnlfvsl(fs2uru  no1olxn oeiatfs umumpnu0 etnxfcootlatelnvolt0s2xoxm ou4olenmivias)s2rmu  ;o4tpenifeiltfaDrmu p;(0tltoxf3to1fp eaieo s)s2tmxm3oy1om elncs sfsDrm(  ;t4oetnioctldlm2ua(monu0alxoir3tydla  an s s srum(opiy4oltelfvsatf Durxrpou4aee  oetydlsDua(mont0 lxomo3io1optrauvsls)srtoxopiydamtnlncs (fa2trxmp;t0oet mf3tltfm rlnvs () reomf3oo1lp e nes;s  2xr(r iydol emfes s sDuaumpot0apeomoeiydla2rm(vs;(0texrmf3iadomDrai i t0 2trir3io1ll n fctl() 2ra(rpnt1tpt iociatlm2em(msn(4tlermfcoytlp r u o s)s2tmiopiudape  fvt (f Duaxro;o0opx ifetysfm2emnvsnu)tlenxo ia1faD lieo;t) rxr(o oo4ole lneiat) rtrurp;o0olxomfctyt a2uluvo;()trxnmf to1fpt lnvsls)tetoiopny4apenlnvs s sDurx onu0apt if3ilt sDrmnms;() reoxr3oydfpD  i i;s) rxm(m iu1lm elfei tf Dtmxront0tltnmietad sDum(msnt)alxrio3tatfmtran o t0sexmimpoy1lme lncta(fa2umu  oo4oleoiieiatlaDran pnt)trtrmf totlpte i i;(0srxm(m ny4lltemietlsfsrrax pnu0teeoif3iat mDrlnmo u)treoxocto1fpD auvi s)s2ur(r3ou1alenlfci ()a2rmxmp;u4aeenmociasls em(ms;t)areomf3oatlaD  nvs;s sruo(mpoy4lp emfctlt)s2rmx pou0oexo fetat s2rm(vp;u0 lxnxfcoatomD  i s (0srxoxo iu1ol elfetl(f Drmxr nt0apeomoetltfa2rmnvs t)trxrxf3oytlpD  uvs;t0 2toir3nodlltnlnci t) 2urx onu4alxoiiciadfa2rluvp;t4trxnir3iy1laDelu i s)s2uoim3ou1lme mfctl() 2umum ;u1aexniociyt m2ranvs u0altrmf3iytoatr neslt t2xmxo nu1ale lfeias srum(mpou1apen fetas s rlums;(0teerio ootoa rau o (0t2xm(m3nu4altn ieslsf rrm(  ;u4oee mf3iysla rm(msnt0teermoctytoa rli slt0srxm(r iy4op  mfvtlsfarrmumpnt4tpt mfciad sDra(ms ()trerxr iy1fmDr neilt0 eum(rpnodol n fes t)s2rmxrpno0aeeniiciltls ranvo u) rtrifciydop eli olt0 etmxm3ou1optemfcsat)a2tmxmp;u1oetnmi3tat aDran p;u4trxnio3todlpDraneo s trumir3iy4op e icilsf 2rr(rp;o0oet mfcildfmDemnvs t)tltrio oy1faDr ivs s0s2xrimpiu1omtnliciatf ruaumpnu1tetoio3tytls2ulumpn()artrircoydfm rliei;t0 etoxopiu1lpe lfci tfs2trxr ou1tltn feilt a2umumon(4 exrxo oatfaDelu il() rtmxr nu1ap  licsat)aDurx o;u4ale mociatlm2eanvp t4 rxnif totopDr i ol()seum(r3oy4op emies t  rur(monu4apt  o3ilsfaDrlnvs t) leoxr3oytfmDran s;(  2trxr iy4omenmivil( arumurpnt4aeeoiieilt sDumu onu4tleoxo3oytlptran slt0t2ur(o iy1opeelnvi s  Drmxm ;t4altomietydls2umuvp u)altrmr totfp elivolt) 2to(o3nodol e icslsf Drr(m ou1aptoii3iadfm2rl( onu4 lxnirctodoptrln o s0sruo(r ou4llen nei t)artm( ont4ape moetadlsDelu s t)aexnmf io1fp  ln s t0 rxoim ny4aptelncsa()aDuau  nt1tet mi3tld a umnvp;(4 rtnmr tytomDr i o ( t2trir iu4lptnmncs t) 2raxrono1aet moeiatla ra(vpn()alxrioctotop eluvo s0s2tr(r3io1lpeemfesat)sDtau  ;t4tpe  o3iys aDumnvo t0trxoxr ty1lp eaneol( seurio3ou4omenmnvsa(f rtax pno1ope  oeiydls2eauvo;t)tltrirctydom  li s s  2xmir ou1alen iei s) rrmxr ;o1tex  octldlm2ra(vs;(0teeomo tytlm r uesl(0 2umxmpoy4optnlfvt tf 2ra( pnt4ape ioetytlm2rluvon()altrxf3todfp  anvs s t2toio3nu4ll nmicsatfsDumxrp;t0oetn f3ias m2rmuvpnt) exrxf ia1oa r u s t)seur(rpoudame mics ( sDtru onu0olxnioeiadfs rmump (0tltoxf3io1fpD  nvilt t2xr(r oydlpenmfvt (  Draxront1oet  fetytls2ul( p;t4arermf oydomt  u o (  rurxo3iydoleemnvsasf rtmxm ou1oee if3taslsDrln pnu0arxoiocio1lpDrluvo t0 eur(m3nodlpenlivil( artrump;u1tpeniieiytfs rmnvp () exoxf3iadlaD lies;t0truoxr nodaptn fetlsf rumurp;t4tleoifctld s eluvp;()altrmo oo1lp   uei t0s2to(opnu1ap e feiasfaDtr(monu0apt iietysla2rauvsn(4teerio oytfpD aieil( tetrirpoudoleemfct tfa2trx oot4tptnmo3iyt aDemu s (0 renxo3oadfmDeln i;() 2tmim3nudlme  fvsas)sDrmxro;t0oetoio3iyt a2rm(vs t4aexoxocoatfaDrlnes (0seuo(m oy4ap elnvtlt) rrm( pnt0oetn iciys aDrau s ()tleomo tytfmteln o;t0tetm(m3iodomen ivtas  2tru  ;o1tleomoeiytfaDua(mo;u4altoxo oytlat anei;( trxmir iy1lmtn fcsat  rta(mo;u4teenioeiyt a rmumon(0 rxrmr3tadfp elnvi t0setoxo3ou4am  lfeil() 2uru  ot1altoifetytfsDrmu p t4aexoif ty1oatraiei;s trxrxo oodam n iviat sDtax oot0oeeo octyt s2rl(mo;u4 exnirciadfaDranes;()t2xr(mpiudap nmfetlt  ruaxmpot1oeen ietyd mDea( snt4tltnifctydfate ieo ()t2uoxm3oodoltelici s arra(mpnu0olt  oetatfmDua(vp t)alxnif oa1fa  lnvs (0seumimpoy1lp  miei (f Durxr ;t1aexnmietat sDrln pnt4artoxfcoa1lmt aneo ( sexrxrpnu4lpeemnvtltfartr(rpot4apt mictytfs el( ont0 etoxo oydlp   ues;s0 rtoxm3oudamenmnet s arrmum ;t0tex iicildfm ulumo t)artnxfcoo1omDeai ols0 etmim nodamt mnvtat)a2urx p;u1openmfciydlaDeauvsnt0artomocoatlmDraueils)srtrir oy1am  mnetat) Durxmo;o1alxoioeildfa umu s;()arxoxoctotlp  luvolt s2trxo3oodlleelictas)sDrrurpoo0oexo oetysla ranmo t4arerif3to1lpDr ivo;()srtoxr3nudapenmnviat)s2ta(mp;t0alx  octyt mDelnvp;u) lxnif3ty1laD li o;( texoxo3io4apenmivil( srum( oot1aee mo3tltfmDum(mp;() rtoif3oatfmt  u i t)seuoio oy1ame mfetasfsrum(mp;t4opx  ociat m uan pn(0aetnir iodlm  ln o;t teto(m iudalt  fvsl() rtr(mp;u4tlx mfcils m ra(vp;t4arxnmf3tatfpDeln o;s) rtm(m3no1lleemnesa(  rurxmonu4ale  o3tat s raumon()areniocoo1fm rliei s0t2trxmpnu1lmte feilt aDtrxmonu1tlxn fcilt a ua(msnt0trxnif3oo1omtelu s;s0texmio iy4ol  lnviatfsDur(  no4apx  fciadlmDemnmo;(4aeermfcta1lpD livs;t0seurxm3ny4llt mfcil(fsruaxm ;u1alt io3iytfa2rm( p;(4 lxomf io1lptrauei s0s2toim3oo1ameelfcilt) ruax  ou0aex miciyd sDemu s;(4trtnxrctodomD ln i t sruoim io4ope mfet sfa2ua(monu1tetomo3iysfs2rl( on(0aleomr iatopt ai i ( seto(m no1apenlnvtlt sDururpot4tlenif3ilt mDranmpnt0 etomociy1lpt anvi;( setr(r iodomen nvsls  2rr(mpou4alxnmoctldfa rln s (0trxrmf3oydom  ai il()seto(mpiudapeemnvt sf rta(m oo4tpx  i3iad m ranvs u4teeoifciydfatrlivo;( s2urxo no4om elfesltfa2ra(m ou0apeomicils a2ua( o;t4aeenircoadfp   ieo;s)srxmir3oy1lpt mfvs tfsrta(  ;u1tlxn ieiytls2emnvo (4tetnmrciytlateanvil(  rtrio iudop e ncia( a2rmx p;u0apxnmociysls emn s;()aetnmr oadlm  au s ( trto(o ou4aleemneias  Dtrxr ;o1tpenmfcildfsDeaumsn(4alermr ootlptrli s t)t2uo(mpoo1open ietatfa2tmumo;u0alxoifeiatlm eanvp;u4 lxnxo3io1lpDe u s t trurxr nydlpen fct t) 2taumoot0teen oeildlm uluvo;() reoif3iydlpt livslt  rtmim3iu1lmte fcsas)aDtrxrpot4tet  f3iad s um(vp;(0 rxrxr oydfp  lu s s0 exr(o nu4ame mncsas srtrx ono0tetnmo3iydfsDul( ont)artrmr oadlmtrln s;() 2xmxo no4op nmneia()aDrrx oot4tex mietys a eluvs ()treoiociytfmtelivols0srtmio3nu4omtnlnesa()sDuaxmo;o1apt  fctysla um(mpn(0tlxnxr3iydfm  livo s0teuoxmpio4lpte ivilt arumuro;t0aeenmo3iyt m2rluvsnt0tltnifcoytom   uei s s2to(rpnu1al emfcs () 2tax  nu4opto f3ildfsDum( snt4aexnifcio1oatr uvi;(0trtoimpio4ame mnetls  rur(  no4tlxo f3iytls rlumo;(0arxoio iotlateauvols  ruo(o iy1omtelnesls  rumu o;o0apxn fciytlm rlnvpnu) rxoif3tytfpD aneils)trumiopoo4ap   iciat)a2rru  ;t4optnii3tyd s umn o;u4 lerif oodomtrai o s0srtoio3ou1op n nvslt srtmum nu1oleoio3iat aDea(mo;(4arerifcoytfa eluei s seuo(o nudomtelnet t artrumpoo1apxn i3iydls rauvonu4tetoio3oy1fptranvs;t) etrxo oydlp n nvi s)sruru poo1tleomfetltlm um( pn()trtoxr3tadlmtraivi s0setrim3nu1op n icslt s2uaumoot1oex ii3ilsfs eauvpnt0 exrif3tydoa  livsls0s2xr(m ou4ap emfes sfsDrrx pnu4aex if3iytla uau pnt)tltomf io1opDeliei ()trtr(mpoudoleelncs s srrrumpoo0apxn ieiytfsDra( pn() lerio3todlptraues s0 2tr(mpiu4omt mnesa(  Dtaxmp;o0tetnmfciatlaDuln s u) rtnxrcoydlpDrliei;t)s2xoxr3oydom elfcsat  rtrxr nu1alx  f3tltfmDuauvs ()tltoxf3tadfpt an o;s) rtmir3oodopt lfci t sDumu pnt4tpeoioeiydlaDul(ms;(0 etoxf3oo1oa  auei;(0trtmxmpnudlm   ietas  2rrxm no0aetoioetltfmDumu o u0aeenxf3tadop r nvi s)truoir3iu1oltemivsls sDrrxmoot4tlx ioetlsfm2umn s t)trenir3ta1fpt  u s;s  2um(rpoo4llt licil(  rrau  oo1optoifetltfs rm(vs u4tlxoif oadlp r uvo;(0 eumxmpou4lmt mfvsa( srraxm oo0altoifciatlsDumu pnu)alxnxr iotop e nvi ()texoim3nodol e fet t) rraur no1aeto o3ilt a ulu o u0 rxomr oatlpDe ieo;t  etoxm3ou1aleemicia( s2umxr ou0tpe mo3ilsfaDuluvp t0tetrmf to1opDelu sls0 2um(opiudale lfvtl( srur( ont4olxo i3ildfs2ea(mpnt4texomfcoydoa elneo s)setrxm nu4omenlfesa( s2taum ;t0opxomocilt m2uan s u0altrir oatlptranei ()srxoxr iydolte fcils s2rr(mpot4oex ii3tls sDrl( o t)alenmr3tydom  lnvo;t) rtmxo iy4olen nci sfa2urxmpnu0olxnmf3ils sDrmnms;(0 eerxr3oatoa e u ols  rumiopou1ol n fesa() Dumxr nt1aex mi3ils mDuaums;(0 exoio iatoaDrlu o s0setriopno1alte nei t)aDtm(  ou1olxnmociyd sDulnvo u)arxnmr oo1fp r ieo ( srtrir oydale mnes tfaDum(mont1tpto iciadfm em( snt) lxoxo3ta1fpDraivo s srxmxm iudom emicsat artaxronu1tee mo3ilsfm elu o u)tltnif3oa1omtrlnei (0texoir oy1amee nesas)sDrr( poo0teenmoetyd sDrmn p t) etnxfciadlaDe uei (0 2uo(o3nydop emfvs sf rtm(mpno1olt moctlslaDem(ms;u) leoxf totlptean o s) eurxmpoo1altemiet s aDuaump;u0apx iiciad s rm(vsn(0 lerxr3totomDelueo;() exr(m no4om emnes sf ruaxmpou0teenmo3iytfa eau s;t4aeerio tydoptelues;s0t2um(r3iodol   ivtlt  Drmxmoot0aeenmi3iasls2umn s;u0 exnir3oodfptelnvsls  etrimpnudameelnvtlt aDraum nt4oexomf3ilslm uau on(4alermo3totom elueolt0s2xoxo ny1oltnlivilt) 2rmuroot0olxoio3iadls umnvo;u) lenmf3oydoaDrai o;(  exrirpou1oleemicta(f rtau onu0aptoif3tatfm2emn o ()aeenmf3ia1oaD  nvo;t teuo(o3iudaptnmfeta(faDtrx  ou1tpxo feiat s2ulnvpnu0areoio3iytop  auvo;t0t2xriopio4olt livta(f 2ta(r ;u0alxoiiciadfmDra( s (0tlenir iatla  aies;s)srtr(o3nodamt mnvtl()srururono0apxoifciatlm2ua(vp;t0 reoifctytlat  i il(  rxo(m3ny1lmtemncias srrrur no0aeenifciat a eanmo;()aeenmf3ootoa eai o s0srumxo3oo4omtn fcils)s2tm(ro;u4tpx mi3iatfmDrl(vp u) rtrxr tydlp rlieols0 rtrxo ny4amtnlnvsls) 2uaxront4teeomoctytlm el( pnu4 etrir totlpDe uvi t) rumio nu1omenlnet s) rrr(mo;u1oex mi3tyt s ra( s ()tetrio tatfpDr nvs;t0 rtoxm3oo4lltelfeil(f 2uaur nt4olxomf3iatla uanmp (4 eermf3tatfpDr n slt0 rtr(m nudlp  mnvi sf 2uaxrpnu4tle  ocias mDum( p;t0trxoxfcoa1la   uvi;( srtr(o3iy4ome mictl(farrrxm nu1oexomfciyslaDem( p;u0trerxf3oo1oate n i;s sexoxrpnydamtnlnes (fa2ta( onu4olenmi3tlsls emumo;u4tetrmf iotlmDrlu i;t0teto(r iudllenmnctat s2rax p;o4alen o3ild a ea( ont0 lxnxrcia1omDrlnvols0t2uoxrpno4lpen fvias  Drr( ooo4opxoiiciyt sDel(ms (0arxnxr iadopDrlnes (0s2toxmpno1lp nmictlt)srtmuro;u1optnmfeiydls raumsnu)altrif3ootlpDeli s;s) exr(o no4al   ies (  rumxmo;o0olto feiatls2umnvs ()tetnmrcoa1omteau ilt  rtmxo oy1olte ivtlt srua(rpoo0olt ifctadfmDuau pn()arxrif3oatla r ieo t  etm(r3oo4lme  fvt t  rtm(m no0texo octysfm2elu pnt4 eeoxf3ootlmte n s;()texr(o iudlmtemfcs t)srta(  nt0tee mo3ilsla rlnvs;t4trtrirciodopD  n i (0trto(o oudal  mncilt aDtm(  ;o1altn ocilt s2emuvon() rxrio to1laDr ivsls0 exriopny1om e fvtlsfarumxront4olx  fciatfsDea(vp u4 rxomf3iotfaDe i s;t setr(r ou4olte ivia(  rumxmpou1ale mo3iltls rl(mpnt)aexnif ia1omDr uvs;s) 2trxrpnu4oltnmnei t) Duax oou0apto f3iyslsDean onu0teerxr io1om eanei t)trxoxr3iu4optnlfvilt  2tmx onu1apeomf3tasfs2el(vsnu)teermf3ia1fat  uvo t sexoxopoy4ameeliei ()aDtm(ronu0tpx  fcias m2rln o ()areoio iotlmDr ueo t0s2tr(m3iy1lp elivs ( srtaxrpnt4tle  f3iysfsDemu p;(4aetrmf iy1omtr ueols)srxr(mpiodam n fvslt  Dtax pot0olxnioctydlsDua( snu)altriociadfpD auvi ()s2tmir3iu1alte ivt s aDtau  ;o4optnmictyd a em(vp u) lxoir3tadlmDrlneil(  2um(r no1lp  lieiltfa2uaxrpot4ope miciytfm2ranvonu0 lenxo iatlpDrli o;(0 eto(r oo4omenlicils)s2umuroot4opxnmicildfs2rm(vp (4alxrmociodlpt  i o;t)sexm(m3oo1ameemivsa(faDtm(moou1oet iociadfs umn p ()alenmf tytfmD aueolt)texoxo3oo4opeelfct ( a2tmxro;o4olxn fciat sDulu s;t) exrmociatomD li o;s s2uriopnu4lpeemfciltfsDum(root0aexn ietat aDumu ont)aeenmf ty1oa rln s;t)sruo(m3no4aleelnvias a2ururpot0altnmictld s2ul( o u0 exoxo oydlmDeaivs t truoimpnydam elnet t arumu  no0oltnmo3ias s2rm(vp t0texoxociadlp  aneils) rtmxo no4lptnlfciat s2ururont4aetoii3iat a rmump;t0aetnxfciotlpDrlnei (  euoiopnu1opt licslt srta(m no4tpx io3tlslmDrm(vp;()aeerio3iydfpDe n o;s)trtmxm nydlltnlneiasfs2uax pou4tlx mfctys m rmu p u0arxoif3iydlp eauvs;(  eum(o oo1al nmncils a2ua(mp;o0apt  fciydla2uanvpnt4texnmo3iydfp eli ols0s2urxrpoo1om  miesl()a2tru  nu0apxoiociasla rlnmpnt0 renir oydlmDraivolt0 ruoimpoo4ole livtl( a2taurpot4tetomoetldlaDul( ont0trxrmf oy1lptrai olt)seuo(rpoudalt mfvi (f rua(ront0oetoii3ilt sDrl(mo;(0texoifcoytla raues;t t2umirpiu4ap n fvia()srurxmoou1apto oetys s2uan pn()trxrxfciydfat lnvolt teur(rpiydapteliciltf rrmumo;t0tpx ioeiys mDua( p;(0arxrio ty1fptelu o t)setrir iydapte ncs t arrm(r ;t4oee mociltfsDum( p (0texnif ty1fpDr neo t0 rum(r3oy1omenmnvilt)s2taxm ou4tltn i3iadla2ea(ms;(0 eenxociodlptr n s;() exo(r iydam nmici s)sDtrxr ;t0opxomfeiyd mDumuvp t0texoxr oadfpDr uvsls0t2to(o3nydlp nmnesa()aDuax p;t1tee mietytls eln pnu0arxrxo ootfmD  u ol()sruo(r ny4ome licta(fsrua( p;o4tpxoioeiydfaDea(mpnt4 lxomocoodopDelueol(0trxoxopoodlmt lfci (  2rrxrpnu1altoiiciys a rlu s t4aexnmr3iatoaDeanvi t) 2tmxopoy1ome licia( aDurum oo0aexoii3tad a2ulnms;u4alenif3to1fa eai sls  exm(mpnudol  mnvsl(  2rrxr ot0tex iieiydfa rln snt4artoir oa1oaD  nvs () 2xr(o3oo4altelfvsas) Dum(  ;u4tpeoifciad a2ul(vp;u0artrif3iytfaDrlivilt)trumim no1lmeemiei s  2rr( ooo4aexoifeiltls2eluvonu0alermrcoy1fmte neolt)srtmiopoy1am elfvi (  ruau  oo1ape moeild s2rluvp t0arerif3tatlm  auei t0trto(mpiudopenmiet t)s2taxrono1oetoii3iadfm rln s;u0alxrmr3todlmD ai s;t0 etm(rpou1lle mfesasfa2rrxmo;u0aexn oeiasfm rm(msnu0arenxocio1fmDeaues t0srxmim oy4lmtelnctlsfartmu pno1aexn oeiltls2rlnmsnu4artomo3oydoa raneslt0 eto(o3no4olenmivi sfa2ta(mp;t0oeto octydls rm(vp;t0tlxnir to1fmD  u sls) rtmiopno1lptelivs t)sDua( oot0optomf3iat m2ean o u4 lxrxr3oa1omDrauvils0s2tm(r3oudlpeemfct tf 2rrumont4opxnmieiytls2rl( snt0texrmo3ta1fatr u ols0 ruo(rpoo1lmtnlnet s sruaurp;o1tlxnmfciydlaDran pnu)altnif oatfpteanei t0 eumxr3io1lpe livi (fs2umxmo;t1tpt  i3iydlmDeaumo (4teeoxo3iodop rlivolt) exoxm iydome mfeils sDtaxmono1aexo oeiytlsDelnvpnu4 rtomf3iydoatr nvo;()teuo(m nu1omenmicsat s2uaumpot4aexnmoeiadfs2ra(vo u)arxrmocoydop r ivol() rurxo ny1amt lnvsls  rra(rpnu4teen ietytfsDranms u4 eeomo3tadoate uvs s)sexo(m nydlltn ictlt)s2umu pnt0tpenmoeiasfm2umn snu) etrif ootlaDeliei t t2umxo oo1ap nlnviat s2tru onu1teeo oetat m ul(ms t4treoifciodfp eanei;(0 2xoio3oydll  lietat  Dtmur ;t0altn fetyt a2rluvp u4tlenmr3oo1lpteln sls)s2xrxo no1lle mivi s arurxro;t4aet mfciydfa2umuvp;u4tetrxr tydfpDraueils  exrxmpoy4lmte nct sfsDua(m oo1tpeo o3ilslsDeluvsnu4 rtrifciydla e nvi;t)teurxm iu4om  lfeta( sDurx pot1oetn octydfm2um( o;(0arermr oytfpDe u o (0s2trio oo1lp emfvtatf rtaumpot1alxo f3iys aDum(vsnt)trerirciy1fa eli sl()trurxo3ou4amen fetls a2rru  ot0teenmociydls ulumo u0tltnxfcio1oat aieo;(0 rxrir3oy1lm   netas arrr(rpot1tleoiietyslaDrmnvo ()tlxrmf iodfmDe ieo;() eumio3no1llenmfvilsfs2raxmp;u0teeomo3iytfs emu p;t4trxrxo iodfmDr n s;t0teumio ou1llt mfvsls a2rr(rpou0oetomo3tysfa ua(mo;()alxomrcoytfpt  nvol(  2xm(r iu4lm e ncsltf 2rm( o;t4texoifeilsls um( s;u0trermr3ty1lptr n ilt  rtrxrpiy1optnlncsa()srur(m ;u1altn ieiadfmDuluvo;()alxoif3ty1op raieo s0 2toxm3iudam   ncilt)aDtrxmp;u1ope  i3ildfm2rmnvo () etoio3iy1lp  aneol(0trtm(opiudapeeliesat  Dtmxr oo1apen oeiasfaDel( o;u4treoirctadfptrlues t)teur(mpiydameemict () Dum( p;t0opxniictlt aDrm(vo t) lxrir tytomDrauvo;t)texo(m3iy4amt mivsatf Dtmur ou4optnifeiad a rm(mp;u0 rtnxrciy1oat aivs s) 2xoirpno4alenlietas)sDrrxr ;o0oetniiciysfs eau o t0alxoxrciotomD aueo ( t2urxr ny4al emneiat) Dtr(m nu1opeoiieiytlaDrmuvs u4 eeoxf3tytfat li s (0seuoxm no4lpt miei s)aDra( pno1tpenmictltfs2um(mpnu0 exrmociadoa  liesl()trur(mpio4lp   ivs s)s2rrxronu0ape mi3iad mDemuvpn()altrxr ootlat  neo;s teuoxm iu1aptnlfvs (  ruaxrpot0olxo ociyt aDemnms;t4 rxnif io1optelivi (0trumirpoodame lietls) 2uaurp;t4tpenioetatla2ul( ont)artoir tydom e u i (  rxrxr3nudlltnlivtlt srrrxmpot1tetomictys m rauvs ()tetrxocty1oa  anvils0texrxo3iy1lpe  nct t srrm(ro;o0tetnmi3tlsfs2emnvp (0aexomr3oatlatraivi;t teurim no4lp nmfcs tfaDrrumoou4optomo3iysfaDran p;t4 rxnir todlat aivils t2uoxr oy4optemfeiasfs2trx p;u4aetnmoctatfs rlu s;t4 renmr3tadomt li ils trto(mpoo1lmtnmfvsls  Dtr(mont0tlxo o3iydfa2rm(mpnt)tltrir oy1oaDe ues s)s2xm(opio4llen fet s  rra(r nt4opxoioctadlmDea(mo;t0alenio iy1faDeai s (0sexr(mpny4omtelnvta(fa2rmxrpnt0oltnmf3iydla ul(mp u0 rtomo ootop r ieolt) rtoxr3ou4oleemfctlsfs2ra(rpou4oetnmociaslsDrmnvont0 etnxo oatlmtrlivi s setrxopnu1omt  fcs t)srtr(rpoo1tlxnmo3iys a elump;u4altomocio1opt ai o s texrio oydopenmfvtls  rua(rp;t1tpx  oeiltls umuvo;()tltnio ta1lp eai ils)truoio3nudlpte nes ( a2tmu  nu0ape  ociyd s2ranvs;()altnmfcoo1lp r ivs;s)texo(mpiodapen fvt tf ruru oou1alto octls s emn o (4tlenif oy1opDe nesl()s2xo(rpoo1ll nmictl( s2trxmo;o1tee  f3ias m2rmuvsn(0texomo tadlpDrluvslt0 eto(opiu4oleemfetlt  2urx pou4apx  i3iasls2rmuvonu)trenmo3iodfateanvi t0srxrxo iy4lltnlnvt (fa2urx  nt0tptomo3tat mDuau o u0tltrmo io1fat au s;t s2trxr ou1oleemfvsas)sDur(m nu1olxoii3iltlaDrauvs;(0 eerxr todom e ueol( setmiopnu4lpee icsa(f rtau  ot4olto fciltlsDra(vp (4 lxnif ia1oatrai slt srurxo iy1ap  liesat)a2rmum nt4alxn o3iad mDemumo u4trxnmf3iy1oat  u o ( s2tmxo3nu4lpe  feiat)sDur( onu1tpenmfciysfm el(mpnt0 lxrmf3oytlp elieo s trtr(opnydalenlnvi sfa2ra(m ou1tlt micilt m2uaumonu4 ltnxf oodom eanes s  rtrir no1lpt lfetatfaDta( pnt0tet  ieilsfa2rl( o;t4 rxoxo tadlmDr nes;t s2tm(rpoo4om n nct ( aDum( onu4oee  ociyt sDeanmonu4trxrif io1oatrli ilt)sexr(mpou4ll e nvsasf 2tmurp;u4tex  fetytfa2um(msn()tetnir ta1late n o;s0 rxoxr nydam nmicsat) rtruro;t4oeeoiocilslmDuln p t0artnmo3iydomDeaivils s2xr(m ny1ope lnetl()aDrr(  no1tpxo o3tlsfa2eanvs;u0 exoifcoo1latelieol(0 exm(rpio4apenlictl(  2uau o;o0aleoifeiasfa em(ms u4aexrxf tydoptrlieolt0 2xm(r3oy4opeelfetltfs2rrxmpou4ope iocild m ra(vonu0alxnxf3tydfpt  nvo t  exo(o nudllt  neta() Drmu pnt4oex  ieiadfa2umuvsnt)aetrirciy1la rln i t)trxmxr3iydaptemfet ( srtaum ot0ole ioeiydfs2emu s;t0tlxrif3oodomDeliei;( trtm(m3ny1aptemict (  Draxr ou4tpx ifetad s2rmnms;(4 rtnxr iadla rliei t trtoimpnu1aptnmfeta()sDumxr ot1apeo i3iad aDrmu s t) eenxo3to1lmtranvilt)trtrxr nydopte fet s)s2umxr ot1oltn o3tydlaDraumsnu) leoircoa1optelivsls) exr(m oudopt  fes ( srta( oot0texnmociyd m ul(vo;t)trxrmo to1op rlneol()sexm(m3oodamt mncsat) 2urumo;t1aeeoif3tasfa rmnvo;u0 exomr3todfpD  uvo s  2xoxo iydlmeelnvt tfsDumumpou1apto f3iysfs2uan o;u0aexrxfciy1omD  uvs ()s2xmxo nodll e fcsltfs2tr(mpot4tpe  oeilslaDrlump;u) rtrmr3totoaDe nes s) eum(o3iudopt lnvta() rtru pou4tpxoio3iydla2elnmo u0 renxrcoadlp   i o s seumxm3oo1lme  ietl(  2tm(rpnt4oeto iciasfm umnmo ()artrmf iodfmteaueslt0 etrir oydlm  lfvsl()arumxmp;u4oeto fciatfaDraumo (4tetoxf3ta1opD luei ( s2urirpny1apt  nct s sDrrump;o1apeniocias m2rmumo;(0 rxoxocoytlat  n s;( t2tr(o3oo1ome mfesasfarua( poo4aleomoetatls umn p (0tlxomf tatfaDraueols)t2xm(m oo4altnlici (faDrrxmoot4ope if3tysfm emnmo;t)aetoio tytoaDr i ol() 2tmxrpnu4ol elfctl()aDtaumoou0teen fciydls eanvo;u4arxomr3tytoa raneil(0tetmir3iu1alt  nvia()artmxr no0olxo ociytlm2eau o;t4 rtnmo3iadfaD lueo;(0s2uoxm3iydam emfcsltfarrr( onu0tpx iociasla emumo (4aexrmrcio1oaDeli sls)trxr(rpio4amt lictl(  Drrx p;o0oeenmfeiys a ra(mo u0 eenmf iydfpt auvil()truo(rpiy1ape  ivtl() Dtmur ;t1tpen oetldlmDrmnvo;u) eerxr3ia1opteaies t) exr(r nodlme lfeiasfarraur oo4aet iociatlmDemuvont0teeoxociodfm   nvolt0trtrir nudameemnvs (  Dtauro;t4aleomieiytlaDrmuvpnu0 eenxrcoadla elnvilt0sruoxo nydap elies tf Dumum ou4alto octydfm elnvont4 etomr ootomDeliei;t) 2umir3ny1amt lfes t aDtru pnt0opxnif3iydlm2ean on(0 rerif3oydom  anvo t0srumio3io1lpeemfct ( aDtau  ;o4open oeildls emums t4trenxr3to1fat lnvolt0trto(o oudll   ncsa()s2taumpou1ape  feiatla el(vo u0 renmrcoytomtrau s (0truoxm oudopen ivt s) 2rau  ;u0tpen fciadlmDrlumon()alxomrctodlmDeanvsls) exmio3iudlle  nvia() Dur( o;o1aeeoiociys m elu p;t0tlxrxr3tytfpteau o;t  2tr(m3nudam n ivtat)sDum( oot0apenioeiadlm2rlumo;u)alxnxf oytoateli i;t0s2ur(o ou4lmtnmictltf rrr( oot0oeenmieiad sDumumpnu)arenio oytopD lneo (  rurxopnydal nmneil()srraxm ot1aexn ociltfmDran ont)arxrmf iodla rlnvols) etoir io4ll emietls) Dtr( o;o0aex ifciydfs2rmums;(4trtnxoctodfpt lu i;() rtoxm ny4ome  ietls)aDrmxr ;u1tlt ifeiysls umumon()alenio3to1lmteai s;t) 2xr(opnu1lpt mivtlsfa2rm( o;o0optomfeils mDrmuvs u)tlxoxfcoatfat  n i;s) rxmxr3iu4apenlncsltfa2tmu p;o1olx  fciysfmDuluvp;t4altnir tadop e ueol(0 etoxopoy4ol nmfet t  Durumoou0opxo f3iasls ean p;t) eermocootlmtrlnvo;s  2trirpoudalenlfvtls s2rmurpot4tex  ociatfa rauvsnu0 rxrxo tytfmtrlu o s t2um(r3nu4al e nvsltfa2um(mont1aptnii3tydls uluvp;u)aeenir oo1op elnvi s) exo(m3iudlmtemnvt (f 2um(mpnu0apto ocilsfaDul(vont)aexnir iatfm elueslt0 rxmxr3oy4ole lfcsas s2tmu o;t1tpen fciytls umn s u) etnio3oytlpte nes s0 2xr(r3io1llte nvsatfarurumpou1tpxomfetldls2uan p;()alenmr oodlm   ieol()tetmxo3io4opeeliet t  rum(  ;o0aleo ictadfsDuauvsn()arxriocoodlp  auvi;t0s2xr(o3oy4lm  mnctls  2rr(rp;u1tpt miciadfs2rluvsn(0arerif oydfp eluesls  ruoiopou4aptelfeiatf Dtr(roou0tpeoifetysfm emn pn(4 rxnio oodfp rau o;(  etrxopoy1amtnmfcsl() rumxro;u0apeomfeiad a uauvs;t0 etrxo3tatfp  livs t0t2xmim nu1lpe lfvsl()s2urx poo1aetnmf3tld aDrln snu0tlxomr3iy1op  lieol()setm(m3io1lmen ieia( arurxrp;u0optoiociasfa uauvo;t0 rxoir iotomteaivilt0t2trxm3ou4lpen ncsasfsrumxrpnu0teto oeildfa2rln o;t0aexnmfciatomD ln s (0 2tr(mpiy4lltnmiesls) rua(rpou4olx  fciltla2rmu pn(4 ltoxrctotfp  livol(0s2tr(m nu4lmtnlfet t) rraxrooo0optoiociatfaDelnvo;u0 rxnif3iydoatrln s s)s2xm(r3oudaltnlictls)a2rmxrooo1apeo iciysla2em( o;(4texrmo tatlptraneils) exm(opnudape mnvsa(  rtaxm ou4aetoii3tad m em( s t) rermf3oy1lpDrlivi t)s2toim iodoptn ics t  Dumum nt0alx  fctat aDelnvp u) reomr3oydoaD luesl(0 etoirpoudlmt  neia()a2trx pot0aptnmiciytfaDuluvo;t4aeerxfcia1omte n ilt0texo(r nudapt livt s) Dumxmonu0aptnifciatfm2eluvp (0trtnir3tadfptrai ils)t2xm(m ou4lmt licta( sDuau p;o0olt ioetasfaDumumo u4 rxoif iodoateli s;s)sexoxopiu1ll  mivt sfsrraxm oo0opt mo3tas mDeaumo;u4tlxrxrciotomDrln o;(0 2xoir iy4lpenmicsat s2rmxmoou0tptoiocilslm rl( snu0altrmf3iodfateluei;s)t2toio3no1om elicia() 2tr(rpoo4aexn ocilsfm ul( o;u)teenmr tadlmDranvo t srxmxr nydlptnmfeiatfaDta( p;o0opx mietld s2raums u4 etoxrciatop rluvi s0s2uoxo3nodlm  lfcs sf Dtmur ou4tex ifcildfm2eanvon(0trtnxr iotopte ueo;s s2xoimpiy4oltelnesatfs2tm(mp;t1alen o3ildfsDelumpnu4 lenifciydoa e n o;s  eto(mpnudoltnmnvtl(fa2taxm nu4teeo f3tlsfmDulumo (0teerio3tytoa eaueilt)setmim io1ale  ivt (fa2rr( o;u0oltnioeiadfmDean o u4 lxomrcoo1om r ieolt texrxmpoo4lleemfesas)aDurxm ;u1alxoio3tlt m eluvs t0 rxoxo3io1faDrlu o;(0 euo(mpnodamt lfvt s  Durumoot0tlxn i3ilsfm umn p;(4treoxrciotlmDrauei;s  2trirpny4optemict ( sDrm(  nt0aee io3ildlmDum(vpnu)aetrio3oytlp ean ol()texr(o3oo4ale mnesa( srua( pnt0oleoifetatfmDum( p t0 lxrmfctadlp r u s;(0srxm(m ou4lme mnes (fs2trumpou1tetnmf3tas a2rmnvpnt0alxnmo iodlmD auvi (0 2toxo3iy4lleemncta() Duaxmp;t1aptomfciadlm2um(vpnt0 eerxf to1oatraieols0t2ur(m3ou1ap n fci ()aDrmxrpnu1olen iciadlaDuanvp ()aetoir oatlmt anvo s0sruoio3oy4lp eliesl(f 2rrxr no0apenmictatfsDeauvp;t0alxoxfcty1lpte ivo;( t2toxrpnodlp nmfvsl(fa2umx oot0alxomociyd a el(ms;t0tetoxrciodlmtraivo;t0srxo(m3iydllt lneias)srrrx  no1tlenmoeiys s2emuvpn(0 renmo tatfptraivi ( s2ur(mpiudam emnesls)srtaxro;o1opxnii3tls a2eaumsnt4tlxriocto1la  aneo (0 rumxmpiu4ole  fvt ()sDum(mono4oee iiciysfmDrlu s;t0alxrmocio1oa eaivsls  rxrir iu1ome lfvsl(farrrxm ;o0tpx mo3tldfm ea(mp;u4 reniociatlpDr ues;s)seto(m oo4optelivia(f ruru  no1tee mieiatla2rm( s;()aexnxociatfmt  uei t)t2xoxo3no4al   ictlt s2rrxrp;u1aetnmieiyt s2umuvo u4alxoiocoo1oaDran o;s)s2trxo no1ole  ncs tfsDur(mp;t1oexnmfciasfa ean s (4 ltoiocia1laD lu s () rtmxrpno4al  licils a2taur ;u4opeoiictys a rmnms ()tetoxo iytom e ivo;t trumim iu4ol   fei (f 2umu oou1apx  ociat m2eanvsnt4arxrmfcta1om  au ilt)s2tm(r ou4op nmncsat)arum(m ;t4opt  fciatfs eaums u0treoxrcoytlmDelu olt0 eum(opnu1ale lneiasfa2tmumpnu0aptoio3ils s2eau sn() eermf3io1faDr iei;( s2uo(m io4ll  mfcta( s2rm(rpnu1optniieiatfsDuan s;t4 etriociotopDrai o;()tetmxopnu4op n fviat)a2tax  ou4oexomf3iysfm2emnmsn()aleoifciatlatrli o t)t2tr(m iodamtnmfeia( srua(mpnt0optomoetlslm2elnmp u0aetrmf tatom raueo;s0t2tmir3oo1aptnmncsl() 2rr( poo0tex mi3iltla ra( p;t4 lxomfctatlpDe nvil(0 2trxmpny1amee ict (f 2tax  ;o4opxomfciyt m ranmon(4alxnxrcoytlatraiei t seto(r3io1lmt  nvtat  2tr(  oo4teen ociat sDum( onu4tlxnif3oydlm r ivil(0t2xo(rpoudamenmivslsfs2rrur ;o0ope mo3iydla2eau on(4 lxoxfcoa1fmteln o;t) 2urim iu4ope lnesls)a2taxroou1aexomoctad aDrmuvpnu) rerxrcoo1omte ueol()trum(o3iodaltnlfcs sf rtrxrp;u4oltoioctytfa2em( onu0alenmfcoy1fm r nvsl(  etrxm io1olte ictas arurxroot1oltniicilsls ulu snu) lerxfctytoa ranes;s) exmirpiu4lpt lnct t a2tru pou4tlxn oeildla2emnvont4tltrir3iatoatrau olt0 2tmirpiydopen ivsltfsrrrxmpot1oeenmo3tltlaDum(vsnu0 exrxf iy1lpDe nvs (0teto(rpou1al e iesa( sDtmu  ;o0texomo3tlsls rauvs;(0 eermf3tydlmD ln s t0texrxr3ou4amt lnvil(f rtr(rp;u0aex  ieilslsDelnvo t)arerifcoa1opDrai i () 2uoxo ny1lp   nci sfsDumx pno0tetniictldfmDuln s t4alerif iatfaDr nesl(0seurxm3ny1ap elnvs ()aDta(monu0teeoii3tldfaDrlumo;t4tlenmr oa1opte ivil( t2toir3no4llte ictls s2trx  ;t0tetomfeilsfs2eauvpnt0 rtnmf3oa1lm  li ols sruriopiy1amtn fciatfartaxr ou4opt iiciysfsDeanmo;t4altoir3oodfm  livi t0trumxopny1lmenliciat)s2tr(m ot4tptn oeiytfs2el(ms t) eermr totlpDr ivilt  2xm(o oo4olt lfci sf rtmur nu4oetnii3tas sDrlu p u4aexrirctotlpDe i o;t0srtrio3ny4om nmieils  rtaumoou1altn iciydfaDrm( o (4aetrxo ootoa rauei;s trtoxo3iy4lme  netas)s2taur ;u0tpxoiociydfsDumuvp;u0artrxr3ta1lpD  neol( seumxo oydap n fctatfs2uaxro;o0teenifeiatlsDum(mont4 etrxf3oadfaDraieo s tetoir no4am  lnvt t) rtruro;o0alx  f3iadfs eanvo;(0 rxrmr3to1omt lnvsl(0 rxm(opnu1am emies ( aDtr(mp;t4opx ifetlsls2rlnms;t) exoif3oy1oat lu i;(0seum(m3oudaptnmiei t)a2taur oo4aetn f3iatlm rm(ms u4tlxoir oy1oatean sl( srxmxo ny1am nlfvi t) Dtmum no0tpt mociytfs2rauvont4tltrmfcoodomDr ivo;t0 2xrxm no1aptelnvsls  rtr( o;u0tle ifcilslaDraumo;u)aleoiocto1fa rlu o;s s2ur(mpoudomen ieils)a2trx oot0apxnmo3tat s rl( p;t4tlxoioctotfate nvolt0 rtoiopny1optnlicia(fs2uaxrpou1oeeo ocild aDum( sn(0 lxrxo3oodom  anes;t t2uoim3nodap elnctat srrr(mooo0opx iieiys a2uan s;() eeoxf3oatlmD an s;s0 2tmxr3oy1am  mfct ()aDtaxmpou4aptomi3tydfsDemnvs;u)teenio3tydom rluesl(  rxrim3iodoptnlici (fa2urxrpoo1tlx ii3iasfa ulnvp u4trtnxfcoodlp eliesls  exo(r no4omtn ncsat)s2rr(r nu1apx ioetlsfm2elnms (0 lxoxr ia1lp   n s;()teuo(o nu1ll  mieilt)arurx p;o1olt  fciaslaDulu s;(4arxomo iotomtran s;t  ruoio3io4lltemfvslsfs2uax o;t1olxomictadfa em( sn(4 rerif3tydlpte uei;( srxoxopoy1omee fvi (  rraxront1apt  f3ilsfsDulumsnt0alxoio3totlptrlnvs;( srtm(m3ny1olenmnetl( a2rmxr no1opt  oeilt s uaums t4tlxrioctodom  aivol()srxoim3no1lmtnmfetatfaDtmu oot4aet moeildfaDrmu p u)tetrir totop rlies;s  rtm(opoo4ape  icsat s2tax ono1altn ieiys m ra(vo (4 rtrxo iotfat auvolt0 2tmiopno4om e icsa() rtrxrpot4opxoio3iadfsDul( p;t) rxomocoodoaDe ivslt0setrio oo4al  mnei s)s2rm(r ou1altnmietyt s elums (0trtnmf iydoa raivi ()s2xoio oy1alt mfet ( s2tr(  nu1openmfeiasfs2ulumsn(0 eenmfcto1lp  liesl()s2xo(r3oo4ape livsat)a2tau p;o1tlx mi3iyt a ran onu0tlenif totlpD aieilt  2trxmpiy1om elnvias) Dtau pot1aet  i3tyd m2rm(monu0tlenmo3ootfatranes;s0texmim3ou1amtnlnctl(  2rru onu0apxnmfetltfa2em(mo;(0tlxnxfcoa1oa e nvo s0 euoiopny4lm n nvtat)a2trur ou0alt mo3iys m ua(mo ()areoxrcoydfp  aueo;(0t2um(o nudam e fcia(fa2ua(m nt0tlx miciatla emnvp (4alermf3todfmDraivo (  2uoio no4altnmics t) 2umurooo0aet  fctas s elu snt4artrmf3tytfatr i s;t) rxrxr3no1ll nlnciat aDumxmono4oltoiiciydfs2ean o;t4tltnmr tydfaD livs;s0srxm(o3io4op  mneilt)s2urxmpnt4tlx  i3iad m umn s;t0 lxrircta1oaDe iesl()trum(m3io4lm e ieia()sDtmx  no4tetomictas aDeanvsnu) rxrir3tatlp rlieols) exo(m iudapt mnctl(  Dtmx p;t1tle iociad a ulumsnu0aexrxo iadla rln s t)sexoim3ny4optelictlt aDrmur ;o1aeenif3tatla emn s;t4 lxrxo ia1lateaivils srum(m3oudoltnlnetas s2taurp;u1tlenioeiydfa2umuvon(4arxoif3oydlpt lnvs t)srtrim oydlp elicsl( arrm(mooo0tleoiociltlmDra( pnt4altrir3tadfptr ivo;s) exmxo3iy4amtelfetltfsrrrum nu4apxnmf3iat sDeanmo t0 lxrxf tytlaDe nvo t0setrir no1al e nesa()srtrum nt0apx  o3tys a2rm(vs u0 lxoxrcoy1lm r n o;t0trxrir oudol emnctlt  Dtrx p;o1tpenmoeild aDul( pnt4tlerio3oodlptrli o;t) ruoxo oo1lmtnmics s) Dtmum ot0alx mociat aDeanmo;(4trtoifcoytlpD  nvo s)srxoio iy1lm nlivi sfsDumxrono0tptnif3iadls2rlnvpnu0artnmfcootlpt li o s texo(rpiudopenmfvsa(fa2raxroou0tpeomfeildfa2rlu o u0 lerio3to1oaDeanvs s)srxo(r io1alt  feiltfsDrrx pou1ape ioeiyd aDumnvonu)altrmf iydomtranvi s0teumimpiy1ol   iei s  Duaurpou0optnmi3iadfsDeaumo;u0tltrifciatomteanvils)texr(opiydlptnlneias)a2rrxroou0alenmociat s2rmnmsnt0teerxr3tydlmDrlieo;t tetrxrpoudop e ieilt artmx p;o1aexnii3tlslm2ra(vp () eeomo3tydlm  lueils)s2to(m nodomen fvta()a2tmurpno4oetn oetatlm2ul(vs;t4 exoxr oa1lpD ln i (0teurir oy1altelics () rrrxmp;t1olen ociysfs rm( p;u)aetnxocoo1oat  iei t)trxo(r3io1apee net t srtaxm ou0tlt  oetldfm2rl(vpn(4tlxomo3iadoateai ol(  ruo(r ny1ol n ncil(  2ta(rpot0olt mo3iasla el( p;(0alxoifciadlaDe nvol()t2xrxrpiy4lpt mncia(fs2ur(m ot1aeeomiciytfsDua(mp;u) lenir todfatr ies s teuoimpou4amtnmiciat  2ua(ro;t4oetomoctas s2uluvs;t0 eerif iotoat  i o;s0setr(opoydaptelnct (fs2tm(mpnt4apeomoeiaslaDeanvo (0tlenxf oytfmD an s t sexrxo3oudlm nlivsas  2raurp;t1apxo iciyd sDrmu o u0tlenmociy1fpDeli i;t) 2xm(r iodopeemnvt (fa2rr( ono4teeoif3iltfa2ea(vp;u4arxnmociydlp rlueslt0 ruo(mpou1lltn ncsl()aruru o;o4tlto f3iat m rmn o;(4teerxr totlmtrln s;t0s2xoxr io4omt mfct ( arrmxm no4tlxnifctadlaDea( o;u4 rtomr3oo1opDe u o;s  rtmimpiy4lm e fcil()sDtaxmoou4oexniieiltla2ulu p;u0tetrmfctydfmtrau s () 2urim3io1omee fvt s  ruaxro;t4tpe  oeiltfsDuluvon(0 reoircta1laDe u olt)s2uoxmpnu4apen icsl(  Dtm(mp;o1tlxn fciasfs eaumpn()teeoxrciydom eaivolt) rxrim nydapeemncsas sDtm(mp;t0oet ifetytfa rm(vo;u0trxoir oodoa r n s;t0 rxmxmpno4oltemfvilt srtrum nu1tlxoio3tydfmDrl( o;t0 lxnmf3oy1fa  livs t  2uo(m3iu4lp emnctatfa2tauronu4opxomicilt m umn o u)texnmr3iy1oa e u s s  2xmxr3oy4omenlncia( a2rm(mpoo4oeenmfcildlm uluvpnt4tetrioctadopD lnvs;(0 2tmxopoo1lltn iesl(f rrmxrono1opxnifeildls2ul( p u)alenirctotom r n o ( tetm(m iu4lmeemnvsat)s2uaurpoo0oexoifeiadfm rm( snt4 renmfctatfaD luvo;s teumxm iydol   iet tf Dtru  ;u0tlt  ociltlm ua( s u4tlenmoctotfpD au i;()t2ur(m iu4lmenmnvsa() 2tau o;u4oee mocils m2eaumo u0 rtnmf oo1lmtr i sl(0tetrir3no4llt  iviat  rtau  ;t4alenifetad m2elnvont4 ltnxr oytoat livs;(0 rxo(m ou1omenlnct (f Drr( p;o0oetomociatls2ua(vpnt0 etnmf3oadfpD ln i;() 2uoimpiu1ope lfei t s2tr(r nt4oexnifeiadlm2rlumo;u)tetrxr iydom  lnvo s seur(opnu1ll n fctas)sDtr( p;u0aetn o3tysfm2rlnmp;(0 etnif iytlaD  n sl( tetmxm3oydamtelfvtasfaDrmumoot0tpt micilt m2ranms t)aeerioctytopt luei ()setm(r nydameemnvilt  rra(rooo0opto i3iltlm ra(vs t)trtoio tytfat anvo s) eurim3nodomt miesls s2rr(ront0open ieild aDemu o;(4trxrxr iy1lpte ieo s  rtmirpoy1amen nctltfsrtrur ;t0opxoifeiytlmDraums;u0 eeoioctatlpDe nvo;(0sruoir3oy4olenmfet tf 2um(mo;o0tpt iiciadlsDem(vo;t4aleoxrctotfpDranei ()t2xmim nydap nlivs s arra( oot4alxo oeiat aDraumpnt)texrif3ootomt  uvi t  rumio3oy1lptnlnvilsf rrr(rp;t4optomiciad mDrmuvpnu0teenmo iydomt anvs;s)s2urir3nu1op  lncslt  rtmur ;t4olen ietasfm2eanvpnu4 rerxf iadfm ranes;s0texoxm oo4ap e nciasf ruau pnt0oeeo i3iyslaDeln ont4aetoxrcoa1fpt lieols)teto(o3oo4llte ieia(  Durx oou1tlx moeiltfs umn snt4 eeoxo io1fmtrlnes (0texrxmpny1ape mfetasfsDrmx  ;u1ope  icilt s eln on(4tlxoirciydfmD  uvs;t  exo(o3iudam elivtasfaDuaxmo;o1olx mfctysla ra( s t4 eeoio3oydlm r nei s sexmim nydapenmfvta() Dta( p;o4tee mfcils a ran on(0artnmfcoadfatrlnvs t)seumxr io1altnlnvilt artmumpnu0apen feiasfsDemnms (0 exrxfciatfmteai o;s)s2xo(o3iydlpenlivias)arur(mp;o1tex ifctadlaDrl(vp (4 rtoxr o
\ No newline at end of file
@@ -0,0 +1 @@
+iei t0srtoxr3nodomtnmivsa(  2tru ooo4tpxomoeiydfaDea(mont) reomo tydlateaies t texoxm3nodllt lfcslt) Drmx  ;u0oeeoifciytfmDrm(mp;(4trtnxf iytoa r u ilt)srto(rpiudlpenlfvi t a2rm(rp;t0tpxnifeiasfs uln snt)alxrxr3oodlp rlu o s s2xr(r oo1omeemics ( aDra(r ot1aexo oeiat aDeln o;()tlxriocootomD  i o s)texoio oodlle mivslsf rrr(mpou4oexo icilsfsDran p t)tlerif ia1oa raiei;t0 eto(r oy4om nmiet (fartmxm oo1oeeomo3iydfmDeauvont4artoir ia1fat aneil()tetmxo3iodal emncils)sDta(m no0aleomietltfmDum(mp;() lxnmf3oatopDeaueo t)s2xoxrpoy4alee fct ( a2ur(mono0aexn fetlslm2emu p (0aexrmr todlatraiesl( trtoxrpiy1openlnctlt) 2trxm ;o4tee if3tlsfm rmn p;(4aeeniocto1faDeluvs t)srxr(opno4lmtelfvslt artmur no4alx  oeildfs2el( onu0trxnio tatop r i s;(0truoxm3iy1altn fcias)sDrrxmo;u4apeoii3tld m uluvpn(0tltrxrcio1la eaueil(0 2toxm3no4am eliei ()s2tau  no1texnmictysfa ul(vp;u4artoxociydfaD li i;()teumio3nudlleelneilt) Dumu ooo1tlx  feiytfs umu snu4areoxrciytfmD  ueo;s0trtmxmpio4optnlivt t  Dua(mo;o4opx miciatlsDranvpn(0 lxrxocia1la e n s;()trtr(r ou1lmenmivtl( s2um( p;t0apeniieias s rau p;u4 etrif3ia1fpDrlnvs s0teuoiopiu4al n fvt t  2rrxmo;o4aetnifciytfsDul(msn(0alxnmr tytfpD auvsl(0trtm(m ou1lp  mnvia(f 2tr(  ;u4apt moeiltlmDrau o;u)areomrcoatlmDeluvs s)seur(opiy4olt mfvt tfsDuaum nt0tetnmoeiyslmDea(vsnu0 exomr3tadom eauvil(0texo(m3iu4alt mivsls) rrrx ooo1aptnmocildlmDeanmo;()arerxr3iytlptelivs (0t2tmxm3no1omte ncilt)sDtm(m no0tlen oetytlsDran s;(0altoif tatoaD auvs (0trtriopno1lmeelicilt)artrum nt0oeto f3iltfs2umnvsn(0aexoxrcia1fa eaues s0 eumxopnudlltemneia()sDtmxm ot4aeto i3iydfm uanvsn(0 rermr3oytlptrauvo;t)seuoxopiodapenmfctltf Duax o;u0aexo fetlsla ua(mp (4tltnmf3iotfmDrlu ilt)srxrimpoydolenlfctat)s2um(r ot1tlxo ociatfaDem(vont4texrxfciydlmDr uesl( seuoxm3nu1am e nes s s2tau pnt4tpxniietadla rl( p u0alxnxf iytopD anvo;()srtr(opnu1ame lies ()aDtmx  ;o4openmfeilt s2rm(vpn(4aleoif tatfaDeai i () 2tr(mpiudam  mnet () Dum(m oo1alx ioetadfm2rl(mp;t4 rxoxf3io1faDe uvo s s2uo(o iodalee iet tfaruaxrp;u0apeoioetldlm2elnvo t)texomr3oa1lpD lu s;t0srxrirpnudapee ncs (f 2urxr oo0tlxoifetysfm ean o (4 eenxo3oodoat  nvs ( t2xoir3nudalee fcs sfs2uax  ;o1ape mociadfaDumums (0aexrir3oydlmt  u sl( sexo(o ny1al e fetas aDrr(r ;o4opxoifcilsls2elump;t)tltnmo3oydfaDran i;()trxm(o3nydal  lnctat)srtr(mpou0texnif3tytfs emumsnt4aexoxo tadfaDranvs t0 rtr(o io1amtelnesls) rurxrpno0alt mfciasfm2uanmp;()alerxrcoatfat ai il(0s2uoxmpno4lm  mfesasfsrra( ooo4apenmoetysfsDrln sn(0artnircoodlmDraivs t srtm(rpoy4lptelfcil(fa2raxmooo0alt mietldfs2rl(monu) rtnif3oy1lpDrau i (0sexmxm nu1omen fetls) 2trxrpno4tlto iciatfmDemuvonu4 lenmr3iadfptrln sls s2xrir ny4am n net tfaDur(  ot1tlxomoetlslaDrauvsn(0 eenmf todomDeliei;(0t2xo(r3oo1ll n fcs sf 2uax oot0oexo oeiatfmDean snt4trerifctydla  anvo (0seurxr3nu4lp nmncslt)a2urxm nu4aleo i3iltlmDrlums;u4 leoxo ia1fmtrai i;s0 rxr(m iudole mnvsls aruau onu4tpx micils s umnmo t0texrmrcoadoatr nes;t)t2umxmpiodameelncta()srrr( pno1apen ictaslm rm(msnu0 exomocoy1lpt anvi;s srxr(r3nu4apenmnet tfsrrrxro;u1tltn f3iys sDumnvo t0teermr io1opteauvolt)texo(m3ou4amt  fviasf 2ua(r ;t1tpxnmieiasfmDea(vo;()tetnxr3totomtranei;s trtrxm nu4lmtn fvi ( srtm(m no0optn oetas a2ea(vo;t0 lenxrcta1fpt lneo ()t2xoxm oo4opte fvsl()aruaxmo;u4texnmfeiatfs2rluvpn()texnmfcoadoaDe iei t) exrimpiudomtemivtl()srrru oou4tltomo3ils m em( onu0trtrmrctotopD ai s t)seuo(o oy1ome mfetat a2umuroou4aexomfciltlaDul(mp;u4teerxf oadopt anvi s0texo(opiudomenlncsat)sDraumoot4olto fcilsls rlnvp;t4artnif3oatopt lnvil(  rto(m ny1omtn icsat a2ra(rpot4oexnifeiasfa2eluvo ()tlxomf3ootomtean o t)s2urimpnodalt mnvta(faDurx ono4tlxomfetasls um(vp u)trxnir3ta1fa elivo;(0srxmiopiydomt lfeias  Dtrump;t4olx mo3iasla eanmo t0arxrmf3oodopDelu o t)setmio iydll elfet (fsrtr(monu0olx moctyd m ea(vs t)trxnircto1oa e ivil( s2xoir iu1lm   fviltf 2tm(  nt4altnmfcild aDel( pnu4alxrioctydoat lnvslt0srtriopnu4am e nviat srrmxmo;t4oet iieiasfmDemums;t4aeerif oytla rlivs s s2um(m iodamt  fcsl( a2umxmono1open fetadfmDrmnvo;() eeomf3ty1opDelues (0texrxr nudol n fviatfsrtmx o;t4tlxoii3iyslaDemnvo;(0areomf3totlpD lneo;( trxoxopiy4open ivt s)arumx  nt4oexoioctyslm eauvo u0 lerxf oa1laDrlies s setoxm3ny4am n neilt)aDua(rp;o4oex mictydlm ranms t) lenmf iydfaDraues;()trtr(r ny4lm elfet ()srtmumpnt1altnifeildlm2eluvo;u4aetoxf oatfa r i s;t0trtm(r nudom  lnctl(  ruru o;t4ope  ocildfa ulnmsnt0tetnxo3tytlp elivi;(0 etr(opoodomt  ivtlt)aDumxmpoo4aex io3ilt a el(ms;() rtomf3ootoat  nvs;s0sexo(r3ny1olte fvilsfarrr(mpot4altomfeiyt a ulu sn(0artrirctadlmtrln o ()trtoxr3oy1ameelncils s2rmxrpnu1tltn f3iysfm2emn p u)alenxo3oadomDrauvi t  rurirpny4olte nvsas a2trump;t4optoif3iasla ulnmpn()aetnmf3iadom   uvs;( s2tmimpiy1amtn ivsat) 2ra(mono0teeomoctldla2ul( o;u0 reoxfciotfa rlnes ( seurir3oy4ap nmfeiat  2uau  ;t1tpxoifeias a2elums;u)tleoifctatlateaieo;()t2uoxo ny1oleelnetlt)aDumur ot1apx  i3tytla ua(mpnt)altriocootoa   uvslt srxm(m oodomeelfvi t sDra( p;o0alxomfciyd a2ean p (0 rerio ootfm eaneo;( trto(rpiu1alt liei (f 2tmx pno0tltnmoeiasls2eluvo t0 reomrciydfmt aivs;()texrirpiy4amt micilt arrm(moot4apenifeild aDel(mp;()texnmfctadlaD  n ol( s2umio iydaleelivt t  Drm(mooo4alt  ictatfsDumu onu) exomf3io1opDr i ilt sruoxmpoy4lp nlfvtl(faDumu  ot0tpt mieias m eln o t0artrxociatfmt  nvs ( setmir ny1amen ict t sDtaum ;t1aetniictltfa emn pnu4altomrctotlpD li ols0 rxrimpnu4omtn feslt a2tmur nt1olxn ieiyt a emnvon(0alenmf3ty1oa  livo t)trtrxopio4ap e neiltf 2rmxm nu1oeen f3tltlaDrluvsnt4 reomr oadla  lnvsls  rxrirpoudap n ncsltf rtm( o;t4opt mfcilsfs2ran pnu)teermf3tatfa ranvi t0 euoxr3oodoltemfeias)sDra(mpnu0aeenmoeild s2emnvs () rtnxocoo1fp rln s;s texrxm3io1al nlfvtltf 2rm(moou1opx miciysla2ran o u4 rxnxo3todfa  an ol(0s2xrxo3oy4apenmncils aDurxrpot0aeenif3tydla uau p ()tltoif iytla elueo s  rurxmpiudop   ictl()srua( pou1tpe  o3tasls2rmu p u)aexoxr3tatlm rlieol(0sexm(o ny4ome mivtlt a2ta(  ;o4tpxoif3ias a uau o t0aleomocootfm raneol( sruo(o3oo4ap elies t  rumxm oo0tpe if3tytfsDelnvp;t)trtomf3io1laD aivsl( srtmxo oydamenliesa()a2tmxrp;t1olto o3ilt s em(ms u0 exrmr todfptelnvo s) etrxm iydopeemivilsfsDumum ;u1oeto feiadfa ra(vp t4 leoir oo1oaDrluvi (0trxr(o ou1olenliei tfsDrmx  no0olxnif3tls sDuaums () lxoxo iotlpD lnvslt)trto(r oo4opt mnvsls sDururpnu0tpx moeiltlm2rmumon(0 etoxr iydlmDeaivo t)trtrxr io4am n ieia(  2tmurpnt0tex iieiydlm eaumo t4 rtnmrctatlmD  uvo;t0 2xm(mpio4omee nct t)aDumu pou4tetomo3iad a uan o;t) exoirctydfp elivol()srxm(m oydlptnmivsltfaDtaxm nt1aeeomfeiadfm um( p;u)tleomo tadfmD aieo ( trxm(m3nudole  fvi (fs2raurp;o1tee mi3ilsfm ul(vp (4 rtrmo oytfp   nvols0setmim3ou1omenlnct t  2tau  nt4oex ifetld m eanvo;(4 reoxr3totomtr ueo t)trxm(r io1ll   ncia(f 2ra(rpno4tpxoiieiad a2emnmonu0trerxr iy1oatrai sls t2urxr3iu4am elfviat  rtrur oo1tpxomfctld m2ran s u4aetrxo3tydlmDran i;s0 rtmxrpny4omtelivsas)s2tru  ;t1ole mictatfm2eanvs;() ltniociy1fa  aivi;t0t2xm(m iy4omtn ncsltfsrtrur oo1aleo iciaslaDumu pn(0alxrmrcoodoaDraues;t t2xr(mpiy4omtn icsatf rtr(m ;u0alxnioeiatfs2ea( snu0tltrmf iytfaDeluvol( s2urir nodlptelnvsls) 2rmuro;t0ape ii3iydls2rm( s t0trxrmf iodopt  nvils0texmirpnudom nlfvilt  rtax  ;o4tltnmf3tlt mDemn s;()tlermf3oa1fpDe nvs;t trurio oo1op emneilsfsrumxmp;t4tptn o3iadfsDeanms;t0 rxoxr3iatfmt lies t0srtrxmpny4lmtnmietl(fsrrrxmono0tlxoio3taslm ea( p;(4 ltoir3ootopDeln s;()trumxr3ou1ol  lnesl(f Dtaumpnt4openmocilslm rm(vs;()aexnxf to1opteli i;( t2umiopiu1ol  mnci tf Dum(  no1tlen f3tat s2rm( pnt0tlxoirctodopD luesl( seuriopoo1om   ncil(f 2uaurpoo4ape mietytla eau s;t0trxoxoctatomtrlivi (0 2tm(m3oydll  mfvil( aruaur ;t1tptoifctysfsDrl(mp;u4teeomf3oytlp  aneo;s  2ur(rpio4amtn fci s srtaur no4aee io3iltla rm(vo;(4 eeoif tadlmte n i;()s2uo(r ny4lm nmnctat) rrru p;o4tlto f3ias aDumnmp;t)tlxrmocoo1fmt lnvs (0 rxoxm oydom nmnei tfa2ua(moot4oleo ocilslsDel( o u0tlxomr iodlateluvo;t)sexm(m nydopt livt s  Dum( oou0opx mi3iadlsDeauvs;u0trerir iadlat aneo;t)s2umxmpnodaltnlnvsa() Drmxr ;u0aexo fctatfmDumums u4aeeomf3iotoaDrlnvils) exrirpny4ol elfci ()s2taxmont4tpt io3ias a uanms;u4alxnifctodlp  ai sls0teum(r3iydomeemncsltf rtruro;t1tlenmocils aDrlumpn()tltrxo ootla e u i s0sexoxo nu4ope mivs (faDtaur no4tpxn ociasfa2ul(vp;u)tlerio3oatfateai o t tetmxo iu1ll e nvtas  2umxmp;t1tex mi3ildfs umuvo t)tlxrif ia1omD  uei ()srumxo iydop emnvsa(fsDrrum ;u0aex mfetys m2rlnmpnt)arxnmfctotopD lnvil(0trtmxopoydlp emics t)a2urxronu4apenifeilsls rl(mo;u4aexrxf3ia1la rlneols0trumim iodll  lfvt t) rtr( o;o4tlen f3iyt aDemu snu4 eeoiocoytlat auvol(0t2umxr3ou4olte ivt t)arumum no0oetnmoetls aDeluvp u4trtrxf iy1lat aiei;( setrim3iu4olt mnesls)a2rm(rpot4oet ioctld mDelnvsnu0tetniocoytfa elivo;t) 2xoim iydlmt lfvi () rtr(  ;o4aptoifcilslm2uanvo;u0 leoxr to1latrln ils trxoxm3oo1ame lictl(fa2rrumpnu4alxn ocils m rau p (4aeeoxr3tatomtr i i;s setrxmpno1lpe mivtltfsrta(mp;o1tltniictas a2umuvsnt4 ltoio iodfm raieol() rto(mpno4amee nvs s  rrm( oot0opxomi3iys a2elumpnt4trenmfcoytfat ln il(0 rxo(mpoodlltnmfeil( a2uaur ;u0opxnmociadlsDuanvpnu4arxrio3oo1fa   ivi t  exr(o nudal nlfesa()arraxmpoo1tptoioeiasfm2rl(von(4 etrmr iytfaDelueo (0s2xm(r3no4omen ieias)a2tmu o;t1oltniieiyd s ulnvp;u0 rerxociadoaD luvi s  2to(m iu1om nmivil( a2ua(rpno1olt moetysfm umn p u0 etomr3iydfa  lies (  exm(m ou1alt lfcs () 2rr( o;u0aptn f3iydfm2elums u) lxomr tytoaD  ivslt t2xoir oo1lltelnvs ( s2rrum no0tptnifeiydla2eanmp (4tlermf oodfmt  ueilt srxrxmpnydll nmivilt)sDrmxront4ope  f3iatlmDeln s ()aetnio iy1lmte n o;t)teto(m iu4ol nlictas)aDra(ro;t0oex iicildls ea(vp;()aexrxf3tatom r ues ( sexm(rpny4ll  lietatfartrum ;o1tpenio3iasfa ulumont0trerxfcoy1fmtrlues;s0 2umirpio1lltemivilt srrrum ;o1olx iociytla ean on(0tlxrif oydomDeanes;(0trxo(m3nodlpt lnvtas srrm(r ou1oet ifcils sDemnmo (0alenir iatfm e n sl()t2umxo ou1lm  lncsltf Drm(rpoo0tlxo i3iltla eaumonu4altrmoctatlmte ieo ( t2toim io1om  lfvia()sDum(rpno0apxomfctadla2eln o;(0texrif ia1lpDr nes ( tetr(o3nu1lmt mivta(fartr( p;u4tpt moetysfs2uanvo;u4 leoxocto1lmDrluei;t trtoio ou4op nmnetlsf 2ua(m nu0aee mociydfaDelnmont0 leoif3ty1fpDeau slt0t2um(rpoodoptn feils  Dum(m ou0aex mfeiltfs2el(msn() etnir3oo1lpD lieils) 2toxo3ou1ll  lfvsls)artau onu0open i3tls m2elnvo (0 leoxocto1om eanes t sexrirpoo4omtnmiesas) rrrxr oo0oleomi3ias a2ea( p u0tetoifcty1oat liei ( s2xmxrpnydame mfcsa()arrmx o;u1opxn ieiydfm2eau pnt4 rxrif oa1fpD anvs t)seto(m3nydlmtnlfes (  2tmur ot1altomieils sDea(vp;u0 leoxf ootom   u i t0t2xrxr3oo1lme  fctltfa2taxroot4ole mo3tld a2rm(mo;u4 eeomr oytlp r neo;t)tetr(o3iu4altnlivsas)sDrmxrpno4opx  i3tlsla2umu s u0 etnio oodfpD lnvi;(0s2um(o3nudam e ietls)aDtmu pnu0tlx iieiad a ua(mo u0aetnif3oodlpteluvi;s0s2urim3oydomt  ivs t  Duaxmpnt1aeeoif3ils m rmumo u) ltnxf to1lp r n sl() rxmim oy1omt  ivsls)s2taump;o4tpxnmiciydfmDrl(mo;u4 eenif oy1op elnes;( s2umio3iodlmtnmncilt s2uaxmono1alen ocildls2uaumo;u4 rtomo oadfptrlnvo;t0s2xoxo3ou4lpe livilt aDraurpno4opxnmfetydlm2rln pn(0trtnmo oa1lpD luvol( sexrxmpoodomte nvsls  2tax o;u1tpxnio3ils a2rm(mpn(4 exnxocoo1fmtrlnei;s)teum(mpiodop nlfvt (f 2tr(mo;t4texoifciyd aDrau s t4trxomo to1la rlieo t0 2xm(rpou1al e ies s) rta(mpno4oexoio3ilsls2ua( snu)aetrio ta1fm rlieols0tetriopoo1optelics t  2taur ;u0oeeoii3ias s2ra(vpn(4tltnircoadfa  li o;t  exr(opny1lptemict () Dtmum ;u1oex ifciad s rlums t0texnir3oo1op e i sl(0 rxoim io4ole  fesl(fa2uaur ;t0tet  iciasfmDua(vsnt4areoxr oatop rlivols)sexm(mpio4ome mictasfarrmu ont1oet mf3iysfa2eln p (4 leomo iy1lm r ueo;(0 eum(m iydopen fei ( s2ta( pnu0tlt io3iat mDemu onu0 etrmf iodfpt lu s s0t2xo(m3iudopenmfvi ()a2ta(ro;o0openiiciyt aDuan s;t)alxrifcoytoa raueo ( texoio3nudap   fcslt)s2tm(m ;t0tlxnmfcias m elu ont)tlxrxr iytomDeai i () 2to(r nodlme lfvslt  2tax o;o4olenmo3ildfmDua(vp;t)texnxf iydopDe u o;s)sruoxr iu1alenmnet s s2rm( poo0tleoio3ias sDemums;t0aeeoxoctadla eaivi;t s2xoxmpiudame  ictltf 2trx oou4optn ieiatfs2emnvsnu0areoir3tatfaD  uei s t2xo(r nu4olee neslt) Draxm ot0opx iictydlm2ua(vo (0aeenxo3oa1fm   n o;t0srtoxm ny4oltemfvsls srtaxrpou0oexnmo3iat m ran o t) rtoxo tatfmteaieo;s0teum(rpio1ole lici tf rrmxmo;t0olt mi3iyt mDum(msn(0texrxfcoo1lpD au i;(0sexrxrpou4aptnlicia( a2umurpot1tptoiociad aDrauvs u0trtrirctadlptr nvi;()t2umimpno4ap  mnci (f rur(r ou1apt mf3iys m rmu pnt) ltrxrcio1la  lieo;s0t2to(r3iudoleemivt tfarua(  nu1optnmiciysla2ranmp t4aetoxo3ootfatr uvo;t)truoxm ny1altelnvs (faruaxm ;t4opxo fciatfaDeluvont0tlxoxr3iy1fpte ivi;( s2uriopnudal  mnvtltfsrtr(rpou1opto ocilslsDumnmont0 exoif3ootfpD lueils) etr(r oo1ole  fesls a2tmx o;t0oee mf3iys sDrm( p (4 etrmo3iotopD  ivils0 rxrio no1aptnmfeil()s2uaxmp;o1tpeo oetadfs eln pnt)trtoxrctytfatran s;t trurxo3iydaltelivils) rum(mpnt4tet ifeiyt a2umu o;u0alenmrcoo1opte ieols) rtmimpiy4apenmictas arrmurono1olxn o3iyt aDelnmon(0arenxo3iy1opteluvil(  rxrxrpnydolte nei ( srrmur ;t0tpxomociatfaDuln snt)tetomr3io1late nei ( teto(m3io4llenmivil()artrur ou1tleoif3tydfmDeanvon(0arxoioctytop  anes;t) rtmim iodale licil(fsrra(r ot0apenmfciyd a2uanvpnt0 rerif3totfpDean o t) eurxo ny1omeelnci ( s2urxr ot0tlx if3tysfs umums;t0trenxo3ty1lp e nvo ()t2trxr oo1omt mfvta(fsDtmumono0aexo iciyt m uan s t4arxomfciotom  li i (0trum(r iodam  mivt sf Dtrx p;u1ope  f3iyd aDrlumo t4aetoir3iytomD anvo;s)t2toir oo4om e feslt)sDraumo;u1tltoiieiysfa rl(vonu0 exnxo3iodlm rlivo;t) 2uoxm3nu1ale  fctltf rtmu  ot1opeo fciat sDran ont0areoif to1lm   neo;t) rum(r3oo1am elfctl()s2ur(  no0alx mfeiltfmDeau snu0arenxr3ootfm rln i s0s2uriopio4opeelnci s  Dtm( p;u4tlenioctasla2ean s t4arxnmociydom rlnvsl(0 exoim3ny1lltnmivilsf Dtmum ot0opt mfctls mDem(ms;u)aeeomocto1lmt  i s s)texoxrpoo1lltnlfet (f Dra(monu4opx miciyslsDuln o;t)aetomrctydoa  luvslt srxmio io4opt  nvsasfaDraxmpot1oeeomoctld s2ea(vo;u4aetoirctatlmDrlnes;t sexr(r oo4ale  fcs t  2rm(rpno0tltnmf3iatla2ra(vs;t0 lxnio iydomDr i sl(0texoirpny1llt mfeslsfa2rrxmp;t0oltn ociaslsDelump;u)teerxo iytlp rai o (  rtrxr3oo1lp   ncils)srum(r ou4aetnmoetyd s2umnvpn(4tltoxo3oadoatranei;(0 2uriopoo4lm  mies s  Dur(mono1aexn ictltlm2eanmsnt0trenifciotlmDraues;(  2toiopoodopeelnvt tfs2ur( pot1tle ifetyslm2rlnvsnu0alxnmfciadopt auvi t)srxriopiudomtelivi s) 2rr(rpou1tltomieiytls2el( pnu) renxf3oo1lmtrlu olt) 2to(m oudol e nvsl(f Durx o;o1tex mo3tld mDulnmonu4teeomfcoa1fat auvo s0srxoim ou4om e ics tfsDumu  ;u1alt if3tltls2rmnmp;t4trtnmocio1optr ivils0 rxmxr3oydomt mieilt  2urur ;o0tpxoifeiytfa2ulnmo;u0trerxocoodopDeluvo;t)trurio io1aptnlfesls a2um(m ;o1tpxn fcilsfsDumnmo u4trxnirciydlpt  uvs s0t2trxm iu4lmeelfei sfsrrmx  ;t1apenmieilsfa rl(vo;(4 leoxr3iy1lp  lnvi;(0t2to(r nodap elfvsasf rrauront4aexn o3tldfmDeauvp;u)trxomo3ta1fmDrlneolt)seuriopou4ol   fcta( srrrx  ;o1ole  f3tlt m2rl(vs;(4tetoiocoodfm   n s;s trxrxopnu1lpe liviat)aruaxr ;o1opxo ieildfs ua( ont4aetnio3ty1faDr u sls  eurimpny1lmtn fvta()artmum nu4tle mictysfm eluvp (4artnifctytoateai i;() rxr(m3iodolee ncs ( s2rrxm ;t4opxn i3iltla elu p u0altnmf todlptelueol()trtoxo iudomte nes t  2rm(m ;o0teeo fciad mDeaump u4aexnmfctotfa e uvslt)texrxr nu1ol e ncslt a2uax  ot4olxoio3iatla2rmums;u)trxnif3tatfaDeai s s s2xrir ny4lmte nvtas srururo;o1aee  oeiatfs2eanvsnu)altomrcia1omDrlues;( srtrimpoo4lpen nctas  Dtaxmpou0apx  ieilt mDrlu p (4tlxoir oatoatr u il()trxmir3oy1apenmiei sfsrtmx  nt0tpenii3iydlaDra(vp;u4arxrmf iydfmDelieil(0t2tr(rpny1lm  mncs s aDrmu  ;t0aptnmoetadfaDrlump u)teerxo3iatlptr i s;s0t2xoxm no4apt
\ No newline at end of file
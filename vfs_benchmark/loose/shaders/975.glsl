@@ -0,0 +1 @@
+i s ()t2xr(opou1opt mictat)sDtmx p;t4tpxomfctlsfs2rl(mo;u)alenxo3ty1latelnvi s)srurir iodoptnlivsas)aruru pot4texoif3iyt m ea(vo u) etomrctadlmDrln s;t)s2xm(m3ny1amee nvs sf Dtmx  ;o1aexnmo3iasfs2elu s u4 rtoifciytoaDrai s t) rurxo no1opeemnesl(  rraxmooo0ole ioctlt m2elnmo;t0 leoxfcia1oaDeaivs;t) rxmiopoo4lltemnvsat srrm(mpou0oeto f3tadfa2emn o;t)trtrir iytoa   uvo s)trxr(m nodame lictatf ruaxmpno1olx  ieiatfs umumo t) etnmfcoadfpDr uei;s)texm(opnydapte fvil() Drmx  ou1apxniociatfmDrl(vs;u)aetrio3tytoaD lu o;() rumir3iy4ome  iciat)a2trxr ou0aexnmf3tyd a elnmpnu4trxnxf iatfmtrli s (  2um(m3nudlp   fct sfsrta( p;o0tltomfeiadla2el(vs;t4 eerxocoydoaDeaivs;() exrir iu1ol  mncsas arta(rpnu0tptnmiciyd s eanmont)teeoxf3iotlpte u s;s0tetmxrpnu1am elivs t)sDum(  ;o4tpeomfcilt a el(ms u) ltnxfctadoaDrlivs ()teto(o3iy1opt lfcsls sDrruro;o1tltomf3iatfaDelnvp;t4 eenxr3totfa   ueo;s)srurxo oydapte nei tfs2umu ont0teto icild m2um( s;t0trenxf3tydfmt livi;t)seuoxr3oo1am e neilt)aDum( oou0tlto o3iatfmDra(von() eeoif3iadla elnvols  rumxm iu1ll n nvtlt)sDtmxmo;o1tpx  octlsfs rl(vsn() ltoio3iy1fm e ieslt)sexmxm3no1om  mfesasfartmxronu0tee ifctasla um(ms;(0 lxoircoa1fpt lieo;()seumio oy4opte ncs t)aDraxmpou0tpx iictatfsDemn o t0 lermf iytfaD  uvs t s2umxrpoy1ome  netl()arum(monu1oeeomfcilsfmDeanms t4trtomr oodoaDrli o t)tetmir3ny1llenlncsat)s2tr(rp;u1aleo fcild m2ulumon(0altrio3iotfmtrli ol()srxoim iydom elfvtlsf Duaxmono4teenmieiatlm ra(vp t4trenir to1fmDr uvi t) exrir iy4lleelnvsasfa2tmuroou0oet  ictysfa2ua(mo;()aexrxr oytlaDeauvslt) etm(r oy1llt lfvtlt) Dtm(rpou0oeto i3iasls2uaumpnu4arxoif3oydfat auvol()s2urxopoo1lltelfvil(f rrax pnu4openif3tas s rau s t4trtrmf oo1fmD luvs;t0s2tmim iodaptnlnciltfa2uaxro;u1alt  ieiadls emnvont0trtrxf3oydlp r ueo;() rxrxopoydapte fvil()s2taxr ;o4aexomf3ildlaDemuvo;t4 rtnmo oadopt luvsls) 2xrxo nydllen ics (fsDtrxr no0alx mfciysfs2uan o (0arenif oodoa   ueo;t)srtm(m3io1alte nesas)s2tm(m ou0tle iiciyd s2rm( p;t0 exoxrcoytlptr n sl( teuoxo3iodlmen feil( a2urxr no4oexomfeiydlmDrluvsnt)altrmr iotom ean sl(  rtm(opiudoltemfctl( aDtrxr oo4tlx mociys a2eau s u)tleomo iotlmteanvi;t s2tm(r ny4oleelfvs tfaDrmx p;t1olx io3tydfa ulnms (0 lxrif ta1lmte ieils t2trxo3no1lp  mnetas aDrmuront4aet moeiyt s2ranvo u4 lerxf3to1optelivi t) rurir3iodop nmfctatf 2trxro;u1oeeoifctadfaDranvsnu0alxomo tatfa  auei (0trxrxr3iu1lm nmneia(  Dta(r ;t0tet ii3tydfa umnvonu)aeerio3iytoa  ln o s0s2xrimpou1amen iesls a2tau oou0optomociat mDuluvp;u)teerif3todopt auvo s  etoir nu1aleelfci tfsDrmum nt4alenifciysfs2rlu p t)aleoir oydlm ean il()s2xrim3oo4ol n iciat srrmum ot1alxnmfciysfaDua(vo;(0texoir iydlmtrai i t)s2xoxopnu4lm   neils)srraxm ot1alt moctad sDel( s;u0alxnmr iy1fatelnvo;s0teum(m iu4al n ivs s) rrmurpno0oexo o3tytfs uauvp u0 eenxo3iatop eanes;( t2tr(mpnydopenlncsl() Drm(r ot0tet  fciytla2elumo;t0trtnxrciytomteai ilt0 rxmiopou4omtelnes s s2rm(rpoo4oex  o3iat mDeauvp;u4 reoxo3io1lpt  i s (0 exr(m iu4lp   nvt (farrr(  ot1alxoifciatfaDrlumon(0 eerxr3ta1laD  ivo s)setmxm iodape mfesat) rrr(mono0apxnifciysfm uanvsnu) etnir3oytomt anvo;t)seuo(o ny4opee nvt ()sDraur oo4texo iciydla ul(vp t4 etniocty1fp eauvs (  rxo(rpno1lmee feiasfs2rm(mp;t1apenifeilsfm2umuvp;u4tltnmfciytom elivo;t0 eur(m iy1ape  nctls)aDta(r no0tptoiietatlm2um( s;(4aexoxo3iytopDraieol(0trtmimpny4lmt mnvta(f 2ua(rp;t1tpto i3tat m ea(vo u4artrioctodop  ai s s) rxrir3nydaptemivilsfs2taumono1aetoio3ias m2emn o;(0 ltomr3iytlpDe uvi;(0t2umxm3iudlpeelnvtls) rtrxm ;t0teto ietasfaDuanmp;(0texoxf3ta1lm rli i ()trxmxo io1alte ncta( aDtruro;o4tpt ifeils sDul(mo u)altrifcia1la raieol()trtoimpiodoptelfvt sf Dtmur ot4altoifcias mDumnmp u4aleomrctodlaDrau ols truo(m iydol  mncsas  2rm(r ;u1aexomo3ild aDrm( p ()altnio3oodlaDrluvs;(0s2um(o3ou4lme lneta( artaxm nu1olt mo3ilslm uauvsnt0 leomocoatopDr neo t  rxoxrpnodap  lnvt t)sDrr( o;o4tltnmo3iyd sDul( s u0arenmocia1fate nvs s0texoirpoudam  lnvi sfs2uaur oo0tlx if3tld s rauvsnt) rtomf3iotoaDe i sl( sexmxm iu1olen ivs ( sDtmxr ot1oleomictysfs2ea(vp u4trtnxf3io1op  ai i t) ruo(mpnudom nmnvta(fsDum(rpot0tleoii3tld m eln snt4teenir3ia1omDr n o;t)s2trxm oodlm  lfeil(f rrmu  oo4tleo ociyt a ulnvp t4tltomr3ty1omtr uvslt)s2xo(o3iu1ap nmfvi (f rrrx pnu4oet  i3tysfaDumumo;u4 renxo3to1fm raies;s)t2tm(mpoo1olenmictlt)a2ra(r nu0oltn iciyd a eau p;(0trxrir3oa1fatrliei;( s2toxm no4opt mnciat)artmxroot1opt mo3iadla2ul(mo;(4 rxrmo iy1la  aueil( t2um(m nu1lle lnvsls) rtm(mpoo1aetn ietysfm2umumo;t0trtrxf ta1omtr uvs s  rxmxopno1alt mfvs t) 2um(  no0tlt iieiltla eanmont4alerxfcto1lpte ues;() exrxm ny1lpen nei tfaruaxm ;t4alto oeildls emumpnt) rtrmf3iotfmt  nvols s2xmxm no4olee ncta( artmxro;u4opx  fetadlmDuluvo t4tetnif io1fmDrauvs;()trxo(r3nydol nlfvs tfartmxrp;u0aptomiciydls2eluvs;u0texrir totfptraueo;(0trxrxm3nu1lp   ncil( aDumxr ;u4tlenif3iasfm2ua(mpnt4tleomf io1fptr ueil(  2toxo3oo4ome liet s artm( ooo1ale ifeils sDrluvo;(0trtriociydfmt  ies;t tetoxo3iy4ole mics t s2rr(m ;u0oet  f3iysfm umump;()areoifcootlaDe neol( s2uoimpoydomtelnet t)arrr(  no4tet miciysfm2ua(vp t)tetomfcoy1optrlieol(0 rxo(rpoy4ap  mfesls) Dtm(ronu1tleomf3tys a uanmp;(0altoxr ootlp e nvo t0srxo(opoydol   nci () rtmxrp;u1tptnif3iasfs raumo u4alxnmo3iytomDrau ols) rtrxo3oudam nmivsas)arua( pno1tleoif3iasfs2elnvpnt)tetrmfcoa1oaD aivo t  rxoxopno1aptnmnvslsfaDuaum nt4oeto fetydfs rau s u)tltoioctytopDr ueo;()trtm(r oy1optelnci (f Dumx onu0tpxnmietyd a2ua(mp u4tleomr3iy1fp eauvs ( s2uo(m3no1ap nmfeils)s2tmxm nt0opxomo3iadls2umumon(0texrmf3tatomtelu slt)srtmio io1apt lieiat aDuaxrono4texnifetas aDrmnmp t0trxnmr to1oaDr nvs t)t2trxo3ou1lp nlnvt s)a2uau o;o0tpeoio3tlsfaDua(msn(4aetrifctodlp raneols0sexoxopiy1alt mfesa(fa2tr(  ;t1tlenio3tatls em(mp u4 rxrxf oy1fp e ueol(  2toxm3no1ol eliet sf rur(r ;o1openio3ias a emu o t)trtniociotoaD  nvo (0sexr(mpoy4lpee nctas)sDta( onu4aexnmi3iysfmDrl(vp;u4artrxo oodoat ln sl()sruoir ou4al  mnvilsfaDtr(  nu0tpe ifeiaslaDuanmpn(0treoxo iadlm eaiei s seuo(m3oydamenlivias)srtru onu4oleomfeiyt a2elu sn(4arerir3iotlptelnvslt)texmio no4am nmnetls s2rrx  oo1oet mo3ils s2uanms (0 ltoxrcia1lm rlu i;t0 etm(m iu4ll nlnvsa(fsDtm(r ;u4apxo ictadlmDuluvon(0tlenir3tytlaD  iesls)srtrir oudapee ivs t  2ta( o;o1oee mf3ilt m rmu snt4teenir3iy1om eaieols0trtoio ny4lm emnvs s)sDtm(r ot4opx ifeias s ulnms () ltoircoatla rluvo;s0s2toir3oo4optnlncils) 2tr(root0tpxnioctys aDem(mo t4 rtrircoodlptean sl(0texr(r3oo1aptnlnesl( srra( pnu1opx ioeiadfmDrlu o () rxomo iadomtrlnvsl(0teur(o oydomen ivs ()aDuaxm no0aetn oeiadfa2em( s;(4 leoio3totfa elieo;t) 2urio3iudlpe lnci () Duaxmono0oeenmo3iadla rlu s (4aexoifctydfat lies (  rumxo nydlmtn ivtlsf 2tax o;u1apx  feiatlm rmn sn() etoio totlmteli slt  etrio3oydolt mnci s)sDra(rpno0alxnioeiadfs2ea( pn(4 rxrxociydlmtrluesl() ruo(opoy1amen fcsa(  Dumu o;u4tpenifetltfm2raump u)tlxnif oo1omDe u i t texmimpiy4optnmieils  2urx p;o4aex  ictysfa umu o;u0 renxo ta1oaDrlies (0texmxopou1lm n fvi tf 2ur(mo;u4tlto ocilsfm2elums;()trxrxr to1fm elu i () rxmir oo1lpee nvtas)a2uau onu0alenmfeiltlmDemnvs u)artnxr iatlaD  uei s)srur(r3iydaltnmivt ()sDta( oou4olxnio3iydfmDumnmp;(4 lxoio3tatlpD ai ol( srxr(mpoo1lp  miviatfsDurxr ;u4texomi3iasfs emumsnt) ltnxf3tytlmt aneslt trtoxr3oo4olt mfci ()sDurxmp;o1apxnioeias s2eanvsnu0alermfctatoaD  nvs;s  2ur(opnu1omtelfctls)sDtrurpoo0tle ifetyd aDelu s;u4 exoxociydlp  lieo t0srxoiopoy4lle mfvia( aDurxm ou0tpeo fciad mDuau s (0 lerioctatlaDr nes t srtoim3ou4llt mfeilsf Dumum oo4alx moeiydfa2emumpnu)tltomo3ta1oa   ivslt) rxmiopoy4opte ictls  2rmu  ;o4tet mfetyd s2ulu s t0trtnxoctytlp r iesls  eum(mpno1ll   ici t  Dumx p;u4tex ifctltlm2ulu o;(0 ltoxo to1om eanvils0 rurxm oo4lmee nvtat)srtrx oou1oetnmiciydla raumo t0alxrxo3totom e i il()teumxrpoy1ame livia(fsDtruro;t4olxomieiad s2rluvp (4aeermo3iydfmD  nvs;s)texoxm3nydlpt lnvs s)a2raxmpnu0apx mieias a eanvp u0 rxnmo oy1opt lies (0tetr(o iy4ameemfvtls  2rrx p;o4oleo octat mDrmn s;()aetomo3iotla ran s;s0sexr(r iodame  fcilt arrmxmpou1alx miciyd s ranmont)artoxrcoy1fp eau o;t)s2uoxmpoudam n fesat  2urx o;o4apeo ieiyd s rau pnt0artrir iydfm  aieo t0trurio iy1apeemfvtat srtmumono1oexn ieildfs el( s;u)aetomoctydlm r nvol( s2trxo3ou4op e fct sfaDumx  ;o1apeo oeiytfaDrlumpnu)tltnxo oodfa  aies;t truo(mpio1lle  ictl(fsrururono1aetoio3tatfm ulnms () etrxociy1oa r nei;s)sexoxrpny4omen ies (f rtm(rp;t4apeoii3iadfs2ulnmo u4aexomfctytlmDeln o ( s2xrxo3oo1apeelici ( srraxm ;u4tpxnio3iaslm rlnms;(0trtnmf oodlpD lies;t s2toir nodapt mncils)s2ua(mpno4oltoio3ilt m ulums;u)trenir3iytfpDrlivo;t  rtoxo3io4openlictlsfsDtm( ono0tpxoif3iydla2rm(mp u)tltnxr ty1opt lu ils s2umimpnodlmtnmfci s sDururonu1tetn oetydfm rlnmp t4 rxoxrciydlat  ieslt0 2xmxopoy4lpt lfei ( sDrrx poo0alx  f3ildla rmumo;(4alxrmf3tadopt  u o t0 2xmxopiu1omen feias)s2rrxrpno0aex iictad m2uln on()alxomo3oo1op r i il(0 ruoir3nu4lmtnlfesa(f rrm(  ;t4tee ifcild a rmnmpnu4texnmr iy1latrln i t) exrir ny1lm  lfetasfs2rru o;t0tex mfctydlsDrauvp (4arxnxf todfm eaiesls)s2urir3ny1ap n fcsltfartrum nt0texn oeiatfm ra(vsnu0 lxrir3iydfp elieolt truo(r iydole miviat srurx pnu0tltoifcilsfs2eau snt)tlxrxr3tytfatr neolt s2xoxrpnodlme lnvi sf 2rmxmpoo0olt  iciytlaDrmu p;()tleomf oydlmt  neils)sexr(r3iy4lltemnei sfaDuaxmpou0tpt  octltls emu pnu4 rerir3oa1fm   uvi (0 exo(mpou4lltnmnciat srumxr no4olt  f3tad s2rmumpn() exrxf3ty1latraivo t0sexrim iu4apee nci (fa2ururoot4texnifeiltfm2umu p u4tltnir iatopt auvs t0 rxmxrpiydame mnet s) 2trxmp;t0tpt moctadlaDem( p t) rxnmf oa1opD  nvo;s) 2xoxm iodomen neslsfartmum ;t4aet mfeilt m emu ont0 lenmo oatomDe uvsls  exo(r nydll   nvi s)srtaumpou0alxo ieiatls umn s (4aexnxr3ia1lp eaiesls0 exm(m3iydlm nmnciasf rrm( oou1olx  f3iatfs rl(mp (0 eerif iadla   ivi;t0sexm(o ou4lp  miesl( aDurx  ou1apt miciys sDea( s;t4 rxoio3oadfp r u s;(  etrirpoy1alen iesat arrm(m ot4apxo feiad m rluvpnu4texnir oadop rlnvi;t0teuoio iu1olenlfei ()a2urxrp;t4oetoifciytfs2el( p t4aexrxrcoo1fa rauvo () 2uoir io1aptelictls) 2trxr nu4aptnifetlslm eanmp t0arxnir oytlat  ues;(0s2to(m oo4lme micsls a2umxrpou1oltnioetldls uanmsn(4 lxnxo3todlpD livol() exoxr oodlmt  feiat a2ta(moot1tptn iciltla ul( o;u4aeeomo todfpDelneslt)s2tr(opiu1lmtemnvils aDuax ooo1aexnmo3iat s2emnvo u0tltoxfcoy1fmt  n s s  2xm(rpny1omen neilsf Drr(rpot1oexo oeilt aDrm(vo;()trxnmr3oytlpt au ils setmim3nudlme mivilsf 2trum oo0oeen ieilt m umnvp t4artrifcoytfmD  uvs;()trto(m3iy1ll nmici sfa2tru ont0apeo ietatfm2rmn p;t4aleomfcoadlpD  uvols0tetoimpiodlmen ivtl()a2tm(ront0alt  o3tasfmDemn s;u) etrio3iadomDr iesls)t2toimpoy4oleemnvilsfsDtru  ;u4tetomf3iysfsDel(ms u)tleoxfciatomDr nvi t texrxm3oo4am  mnvs t) rtr(  ;u1ape  oeiyd s2rauvo u) lenir3iodfa  ln s;s seum(r oudalt lictasfsDrm(mo;t4alx  ieiatla ulnvs (0texoircio1fp e i ol() 2tm(m io4am  mietl()sDrrurpnt4oexo o3tyt aDemn p;u4 eermf3oydla eln s;()texrxo ny1ale  fcta()s2um(roou1optomoctyt s ean sn(0aetrxrcoadfpD  uvol( teurxo nu1lpe lnci t)arua(mp;o1aee iieils m uluvs;t4 rxnxr totfa  luvs;t  eurxmpio4amtnlnctatfaDtmur ;t4tetn feiytfsDul(vp;()artriocoadfpD lnvs ()s2trxo3nu1lmenmietls  ruru o;o0olt mfctysfs2ean pn() reoxf3oatopte neo s)trxmxo3no1al  lieta() rrax o;o1optomo3ils m2rluvp t)tltnmf to1fa   ues;t0setrxm3oo4lmtnmfvia()a2ua( p;t0tpenmf3iydfaDeanmsnu) rxomfcoydlmDrauvi;( trxmio iudopen fesltfa2ta(  ;u0tet mi3tas m2umnmp;()tlxnmr3oadfateluei s)t2trim iu4opeemici s)srtaump;o4tptomfeiasfaDumuvs t)aexrmf3oytom rli i (0 rxmim3no1lm   feslt  Dtrxrp;t0tex  f3iatfa2ea(vpnu)tetomr tydfateau i t  2umio oudalteliei t)arua(moot1open o3iysfaDrlnmpnt4alxomf3iatfaDelu i s0srxrxmpno4amt lnvtas)arra(r no1opxo f3iasls uln pnt)altnif iatomDelnes;t0s2tm(m oo4lp nlnvtl(fsDraur ou1altomoetlt sDeau s ()tetnxf to1faDeln o ()s2tmirpiydlpe mnvtas) 2rrur oo1alxnioetydfa2em(vo;u0tlermrciodopDrai sls0t2umxr iu4alenmncslt)srraur nt1tpx if3tat mDulumpnu)trxrxoctodoa elneslt)t2uo(r oo4lle  nci s)s2urxm ou4oee mi3ias s eanmon(4areoxrciatoaDe uvi s)t2xm(r iodap nmfvtatfsDrmuroou0alxniocilslsDem(ms;t0tlxoir iy1oaDeanes;(0trxo(r iudlpee iciatf Dtrur ;t1tpenmocias a2emnmpn(4aexriociatla  aivslt)srumim3iu4olen fes (f Drmumpot0tlt mi3tatls umnvo t4texrio3oatopte n s;s) 2tr(mpou4ale lnet ( aDraxmpnu4oltn i3ildfs ean s;()tlxnxocoydlmtrluvo t) 2xrir3oudolt  ivia(fs2umu o;o4aee ifctadfaDem( p;()arxnif iydoaDeanvo;() rtmxopny4lmtn fvtasfa2uru pou4tltnifetyd mDuan pn(0alenio3ty1la r n i s) 2xm(r oudaptemfet tfartru  nu1aee  ictlslm rl(vo () eeomrcoatoa  lueo;(0sruo(r3nudlltnmfvs sfaDtaxro;t4tlt mf3iadla rlnvs u) rxrxr3iotoa eaneo t0teumimpnudopt mneils) rrrxm ;t0olenmf3tytla ul( p (4 reoxo3oadfaDrli i s0s2xrxmpny1alen ncsa(fsrtr(m ot1ape mfeilsls2rl(vs u0teermo3tytopt ai o s s2xr(opiu1lp   ieil(f 2umx  nu4apt if3ils m ea( p t)teerirciadfmDrlivi;t0texoio oo4alenlnvtlt)srtau p;t1apxo fctasfm umn s (0aetrxfciotfat lu s (0t2to(opiy4lmtemnetat arta( pnt4aeto ieiydls2ea(vs u4tltnio ty1fp   u slt) 2umio3iydll  lieils)sruaxm ;t4alenii3ildfa2ulnvp t)tetomf iytfmDraivo s0setoim oydap  mfet t)srtr(ront1oeeoifcildfaDranmont4altnmo3iatlm   uvo;s0sexoir oodop  lfetl()srrmxrpnu0aex ifctytfmDrlump;t0 rerxf oadoat an il()trurir3iu1openmfesls s2tmx o;o1openio3iytfa2el( pn(4 rtrio oo1fat luei ( t2umir nydop e ies (f Dtmx  ot4tpe moeils s ea( o t4teeoxociytfmte uvs s sexrxr3oudll e nvsat sruauro;t1teeomoeiltfaDelnvpn(4aexrifcoodlp eli olt)truo(mpnudlm e ivil(farrm(mpou0tpe  fetyd m2ran o u)artrxr oatfm eln o;t) rurio3oy1op  mnctat srtaur ;t1oeen iciad sDrmumonu0 eeoiocoatomteauesl( t2xmim3io4amtelfvsa(fs2tmxrp;t4teenio3tltlaDea(vp;() etnxr3iotfm eln s s) 2xrxmpoodamtemietat  Drmx ooo4olt  feiytla2rmumonu0 rxoifciydfp eau i;t seumiopiodll  mictl()s2urx  ;t1olto feiytlm rl( on()trenmo3iodlmt livs;t0srtrimpnodlm  lneiltf 2rax o;o1aptn octls m2ul(ms t0teenif oy1lpteaies s  euoim no4ll nlfes sfarururpot4alx  fciasfa2uluvo u0 reoxf3oytfpte i il(0 eto(o3io4aptnmnvias  rumxmonu1opeo i3iadfm2ra(mp t)alxnmrcoo1fpDeluei;() rtoxo no1amenlnvilt)s2raxr oo0opeoioeilsfs emums;(4 ltoir ia1lpDe ieils  rtm(r nu4alte nvsl(fsDuaxro;u4alto fctlsls rmu s u0 rerxr3iotomt auvilt s2uo(m io1olen nesas aDtrx p;o4tle ii3iytfs2umn pnu0alenmfcoydla e u i;t)s2xoxo iydalen icia(fartrxrooo4oetnifctas aDea(vs;t0 rxnxrcoo1omtrliei (0 euoxrpnodlltnmnet (fa2rau o;t1oetoiociatls2rlnvon(4aeenio ty1lpD  uei;() 2to(mpoudomte fcs s s2uau  ;t0opt  i3ils a ulums t4 lxnmrciodlatr ivils)trur(mpoo1lm  mfvsatf 2ra(mp;u0aleo f3iydlaDul(mp u4tlxrif3iotfpt ai s;s0t2xrir3ou4ll n nctlsfa2rrxronu0tpx  oetyslm2ulu o;(0 exrircoo1op e n o t)setrxm3nodom nmictat)artmu  ;u4tlxoifetytlm2rm( on()tleoirciodlm elu i t0 etmio oodlltelnci (farurumpoo0tptoiictytfm rau snt)aeerio oodlaD ai o;(0srumim3iudop e nvt (f rraxronu0tlxomo3tltfa2rm(vp;()teenmr oydoatr u s ( tetoxo io1lpte ncs sfsDtr( p;u4opxo ieild m2umu p;t0 eermf3iy1optelieo t) exoimpou4aptn fet ()aDtaump;u4tpxoii3ildls2rm( o t0 exomrcia1fateaivs t0trtmiopio1lle lneils) 2rmumpnu1oltn fciydfsDeau pnu4tlxnmoctytomDelneo t)trur(mpou4olt mivsls srurxroot4oleomieias m rm(ms (4altoxf iy1lmt  n s;(  eurxm oy4ol  livilsfaDum(mpot1aeenii3tldls ean p;u0 lxoioctadfp  lnes;(0 exoxrpnydlptn nvslsfaDrm( p;o4aeenmfeiydlm ulnms;(0alxomociytlatelues;s0t2xoio oudaptnlivilt) rtmum nu0oeenii3iysfmDrmn s ()trerxoctatlmDelivsls  2tmxr iu4alenmict s) Duru  nu1apxnif3tyt s el(vsnu0altrir io1lp   ieol(0s2tmxopnydapeemfvtls)artmump;t1opxnmieiltfs2umnvsnt0 exnirciatlaDr u slt0truo(m ou4lpenlneiat)s2ta(ronu4oexnifciasls2ran s u) eeoiociodomD au o s)setrxr3oudamteliesatf rumxm ;o4olt miciysfsDeau o t0arenmo io1la eaieo (0trur(rpou1lptn fcsls)sDrmumooo0opx iiciydls2rl(vpnu0alermf tytoat liei;(0 rtmxm3iu1lptnlies ( aDtmuront0oeen oeiltla2em( s t) lerircoo1fp  an s t)trtoimpnu1lpenlietasfsDuaxmpou4tptn feiatlm ulu s;t)texnir iodfmDeaieo;s setoir nydapenmiviltfs2uaxm ;t0oee mfctysla2ulnms;u4tetoio oo1op  aivslt texr(rpoudll n ncs s)arraxmpou0aptnmiciyt a2elums (0tetrmrciy1oateli i (0s2xm(rpoo4omtnlnes s)s2umxr ou1olxoif3iadla ean s;()arxomo tadop eauei;s setoim oudole mnetlt)a2taumpnt4tleoioeilsfmDemn s;u4 eeoiocoa1om  lu s;s)srtrir3ou1llee nctas sDrrxrpnu4aexo fciyd mDean sn(0tetnio oy1fatraiei ()trumim iodape  netl()aruau  ;o1apxomoeiytlmDem(von() rxrmf3iotfaDr ueol( s2ur(rpny4ope  fct sfaDtaxrpoo1oet  f3iadfs2rm( sn(0artrio3oytoat lnesls seuoim3iu1openlfei ()sDrmump;t0aet  octlt m el( p;t)aeerir3oatla rlu s;t0 rtrim io4amtnlnvs t)sDrrx pno0aeenmieildfa2elums (0 lxomf iodfmte ies;t s2urxr3no1omen ivi sf rrrxrp;t0oetniieiasfmDuluvp;(0areomociodom  anvo;t trtoim oodale mnei s) ruaxmpou0aexomf3tyd m2elnmp;t)alenmo oo1omDrlivi;t)sexrir oo4om nmfeta(  2tmur ot1tle  iciadla2ra( p t0 ltrio to1lmte n slt trumxrpnu4lp elfvia() 2ur(mono1alx  ocild s umuvonu0artomf3oa1fa e uesl()texrim nu1opee netls)s2urxroot4tltn i3iat a rlnvp t4arxrxrcoadlate ieils s2xoio iu1am nmfviat  rumxmonu1tetnmo3iysfa2eaumsnt0aetoir tatoat an o t0sexm(o3ou4olt lnvilsfsrtrx oou1alt  oeiat s2emn p (4tetrir io1fa rlneo;t)seuoir oydalee iesl()a2tr(mpou4oetn ociyd aDuan s;() exnif iatfpD  neo ()trxm(o iydalt lnvt ( aruru pnu0texnifetyd s el( o;t) rxomfcty1op r ueol()setmxr ou4omee nvta( s2trxr ;o4tpx miciat s2ranmp u0tlerxo oadfpt  nes;(0seurir3nu1altemfvs s s2urum ;u1oet ii3tltla emu p t0 rtomr iatopD ai ilt  euo(rpoodopenmnet t sDraur ;u4optnmf3tadla emuvo ()altoxo oytlpDeaivo;t0 rtoxo3iy1am nliei tfa2urxr no4alen fciltls ulnmsnt0 eeoxr ia1fmte iesls0 exrio ny4lmenmnvsas) rta(rp;o4tleniieiltlsDrl(vs u4tetrmf iotopD  neils0 ruoxo3iu4om emivilsfa2umuro;t1oleo fciadlm ulumo u0aeerxfciotfaDe n i;(0tetm(rpio1om  mfvtl()s2rmurpnu0texnmoeiydfm rmnvonu4 lxnxrcoydomte i s t0 2to(mpnodam n ivi t  rua(  oo1apxoioctadfm2eanvp u4trxnxr3todfaD  n slt0trur(m iy1ame  fvtlt sDtrum oo0tlt io3ild mDuanvs;(0 lerxr3ia1fa   n ils)texoxmpny4amenlfcil()sDumxmp;t1aetoif3iydfs2rlnvo;t4 eenmr iatla e u i t)s2xrim io1ol elfeiltfsDtaumoot0oltomfcilslmDrmumo (0treoxf tatlm  ai ilt t2tmxm3ny4apt mnvil()s2ururoot0oee mi3iadfs2uln s;t4trenmf iodfmtr uvo;t)srxo(opio1ol emncil(  Draxmpnt0ale iicils a2el(mp ()arxomfciatlp e n s;s) etmxmpoy1am   ieias sDtmumo;u0oet  o3ildls eaums;t0artrmfciotoa r nvs;t0seuoim3oodllenlfcs () 2uau ono0oex ifctls m eluvp u4tlenxocio1om eau slt0seurxm3no4ll e ivta() Duaur ;o4apxniociatfa eln snu4aetrxrcta1fa  anvi;s0truo(r3oydoptnmiesl(farumumpno4oeeniictysls2em(vsn(0 rxnir ty1laDr n s;s)teuoxm iy1lm nlnei t arra(m oo1alenmoctld sDumn snu0texnmfciytfmte u o s)s2umxrpno1lp  mfcsl(f 2tm(  oo4oeeo f3ild sDemnms t)tltrirctytfa eluei;t0s2urxr oudolt  nvias) Drr(mo;t4ape mietyd s2el( s;(0arerxr3todlmDr neo;( t2uo(m ny4ll elnct tfa2trxronu1alenmi3tydla2rl(monu4areoirciotop eln o s0 exo(r3nydll n feslsfs2rrumpou4oexoiociad sDea(ms;(0aetnxo3io1fmteaiei;(0 eur(o3nu4olen fcils s2rr(root1tpeniictas s2eanmo () etrxo3iydlaDelueols trtmxm3nydamee ncil(farrr(m nu1tetnif3iyt s emuvpnt0tetnxf iytfpDelieo;s) exm(o3nu1lpt  nvs t s2rrxr ou1tlxoifeiydlm eanmpnu)altrir3tytomD aivolt)trxrimpiy1omeemfctlsfsrrm( pou4apeomictyd m ua(mpn(0tltrxo oo1faDr u slt)t2xr(opnu4olt lnct t)arrr( o;t1teenii3iad s2rmu o u0aexnmo to1fmtrluvsls0 eumxopiy4omt  ictatf rumur ot4oeeoioeiyt sDumuvp;u4trxoiocto1oat aneils)trtm(m3no4lmt mies (fa2urx p;u1opeoifeiasfmDemuvs;t4artrxf3tydoaD luvs t0 exrxr io4omteliesa(f Dra( pnu1tltoifeiyt mDuan p;()trtrif3iodomtrluvs (  eumxo3nu4altemfvsas  rraxrpoo4tpenmieild s2ua(vpnu0teenmfcoa1omteli i;()trtmxo3io1lpt mfet s)aDrr( pnu4ole iieiys s ulump;u) lxnmociotlaDr ies;t0teurxrpnodaltelnesat) Dumurpot1ope mictls aDuln o;u0texnir ta1lpteai i t0setr(rpno4oltemici s  Duax o;o0teen o3tatfa rlu o;t)artrmr io1opDeauvol()srxm(rpou1altemfei t) rrmxmont4optn feiad aDuanvs t0treomoctotlatraues;s trurimpnudllte neslsfartru p;u1aeenmfeiad m uanvpnu4teerxo tatlmDr i i;t) eurir3iu4lleeliesa() 2raumpot1oee mfetlt aDumn p (4arerir totlpt  nvi t0srtoim3nodol  lfvsasfsDurxm ;t1optoifciydfa emnmp (0arenxr3oatfm ran i;() rto(o io4lm emnei sf Drax p;u1alx if3iasfm emumo (4 rtoiocoo1omteluvsl()srxrxm3ou1altemfciatfaDrmx p;o0tle  ietas s eanvpnu4 rerir3to1op ranvo;s sexmxrpoy4am  livil()arrrurpnu1opx  fciysfa ul( s t0 etoif oodfa eaies;s)trur(r iu1lmen ivtatfarrmx  ;o0teenifcilsls el( o (4trtoxrcoy1fm e nes;s tetrxmpny1amee nct t sDrr(mpnu0aetomicildls rl(ms (0 rtrioctatfaDeai o (0tetrimpiu1lmenmivtasfsrtrumpou4opeoiieiadfm rauvs;()aexnirciy1fpDeai i (0s2urxmpio4lleemnetlsf rrmumo;o4teto f3tys sDuanvo t0 renxf3iydlaD aivo t setmio oydam emnvtl()sDrm( onu1tex  ictysla2rmuvpnt)teenmrcia1lmteauvsl( s2tmio3nydope  nvsls)srumumo;t0tpe  oeiadlaDelu s;t) rtnmfcootlm elu s s) eumimpou4omenlnvtlt)s2ra(mpnt0tptoiocildlaDuaumsnt4teenio todlatrluvs (0 2toxr3iudol e ncil()aDtm(ro;u4optoiocildlm eauvsn(4trtnmf3iotoa eauvs (0 rtm(r3nudam nlfet tf 2taxmo;o1optnmi3iytls elnvs;t4 reriocoa1lmDeli i t) rtmir3no1lp nmfvsat) Dtaxmp;t0openii3iadls2ea(mon(0 rtrif3tadlp   uvs (0sexm(r oudamtn feils)aDuaumonu4tet moctlsla2rmn o;()areoir oy1lat ai ols)trum(opiudlmtn netltf Dtrxm no1tlen fcias mDel( pnt4tetnxr3to1lm   neo t trtmxm oy1amenmfvsltfs2urumpoo4oexnifetyd a2rmumon(0aeeoxf ia1oat  ieols setmim iu4amtnmncsa()sDtaurpnu0teeomfeiytls rmnmp;u) renxf tydoa eaivi;(0texmimpou1ape mnvtat  2taxmp;u4tptnmieild sDrmn p;u0tleoirctadfmt aues t)setm(m nudlle micsls artmu ont1teeoii3tltfm uanms (0arxrmf3tatfp  aivo;s)t2tmxmpio4lp nmfetatfsrumuro;t4aptn i3iadfa2um(ms;t4trermrciydoaDe u o s)t2uoxmpou4ol nmfct s  Dtmxmpno1alx mi3iaslm rmnmo;u) lxoxf3tatlpt  ies;() 2um(o3oo4ape lfvtas)arurx ont4tpt mf3iatls2uanvont0arxrir3oa1faDeluvi t) eumxm3nu4apeemfeta( srtr(  oo1tlx mietls mDumuvo;(0 etnio totlp rlu ol( t2umxrpoy4olee ncsls)sDua(r oo0oexnifetlsfs umumpnu4trtniocio1lmt livs t)srtr(o3no1oleelnct tfa2rr( ooo4aleoioctydfmDuln o;u4trenxo iytlp r i ols0srum(r3no4lltnlncsat sDtmuro;t4opx mfciydlsDrau p;(4 rtnmfcoy1lp eai ils0 2xmio3ou4lpenmfvia(f Dta(r no1ope  octasls2uauvp u0trerir3io1lp  lnei;s  rtoim3nydaltelictatfaDtrxrpnu1texomi3ilsfaDulums;u)trtrir iodfpteaivo ()sruoir3ny4op nlfet t)sDum( ooo4ole  ietld a2emumpnt0aeenxo3tytfmtelueo t s2xrirpnodll nmnct ()a2rr(mpoo1alxo fcias m eauvs;t) exrmf oo1oatrli slt0srxriopoy4lm  mfvtat sDrr(m ou0optn ietytfm2uaumsn()alenxr iotfmDe i o;(  2toxo3nu4ome mnesa()aDumxrooo0tlto fctytfsDrln pn(4 exnifctydfa e uvi (0s2xr(o nodopt  ieil()srtr( pnu4ole  o3ild a um(mo;t0 exoio3iy1fa eluvs s0tetoirpiodol e ieia( a2ur(mpou4apxniictlt sDrm(vs;t4aeenifciotoptelu s ( t2xoxo3iu4apt mivt t)sruru o;u1aee mfetls m rluvp;() etnxrcoatlmteai il(0 2toxm nydoltnlfeia( srrm(r oo4oetn i3tlsfs ulnmp;()aeermfciatlmt an ol(0setrirpoudlp n net t)aDtmxr ;u1oee  i3iytfmDrl(vpn()artoxfcoodlm rau slt0 exoio no1lleemncsatfs2ua( ont1ole ioeild aDrmuvo;t)altrmfciydoa   neols)srxmxo oy1lpe lnetltf rur(r no1aeen oetasfs rmu s ()trxnif oatoateai ils s2xoimpoy1lmenlncsat)sDtm(moou4openioeiyd s ulump;(4aeerir3iydom elivs t0texr(m iu4amtelfvtas)s2raxmpno1apeomociadfa2ra( pnu) etnio oy1lpte u s;( srtmiopno4lptn fei (fa2ur(m no1tex mfcilsls2umn o;u0tlerir3totoat livolt)t2xm(r3nydam n feias)a2rmur ou4oltomociatfaDrlnvs;t4tetrxf3iadoaDeln slt)srto(r iodlme mncslt aDuax oot4oeeo f3tldls emn s;(4tlerifciydom elu s t t2uo(o iy4lltnmfvt sf rum(mpnu0ape if3ildla2elumon()artrif3tatomtrau o s trur(o ou4ll nmnvs (fsrtau pno1tptnmictys sDuanmon(0teenxrciodfptelnvo;t0 etmio3iodape  netasfa2rrumpot1alx  oeilt s2rlu pnu)treoif3oo1faDeaneo;(0s2to(m oudalte ivsas  Dtr(mp;u1aee mfcilt a2rmnvp t0altoxo3iytlaDr ieilt)t2um(r iydapenmnesatf Dra( oou4optoio3ils sDua( s ()tlerirctatlmD anvils tetm(mpoudlme miesls)s2rax p;t1olen iciltls em( sn(0 leomf iatomD aneo (0t2uriopny4oleelfcils arrmxmo;o1aexomociatls2rln o;(4 eenmf iatfpteaiei;t truoirpoudal   ict s sDtaurp;t0aptomocilt sDem(mp (0 eerio3iodfaDeluvo;t0s2to(mpoodoleemfcslt)sDtrx o;u1tpt io3iltfs2ul( s (4tleoxfcoadomtelnei;() 2xrxr3iu1amtn neias a2ur(mont0oetn fciysfa2ua( p;t4 ltnmo tadlatean ol()seto(r3oy1llt lnviasfa2umxm no1alx moeiltfs2uanmp;t0tlerif3iotfm eluei s0sruoxo nydomt  ivs sfa2ua(r ou1tlx if3taslaDrauvpnt)teerir io1la r iesls)t2trir nudal elfcsat)aDurx oou4aetnifciytfmDemnms u4 rermfctodfp  lnvs t) ruoxm nu4ap nlfct sf 2uax oou0aetnifcils mDumums t)trtrmr to1fa ranvs s)sruo(mpou1amtnlfcsat)a2raxr ;t0altomi3tlt m eln o;t0arermo3oodfpDr i o;t tetrxr ny1aleemivtasfarua(mpnt1teeoioctlslmDraums;u)arenxoctadlpt luvi;s s2tm(r3nudlptelfet sfsDrmump;u0apxoifctytls el( on(4tlxnif iydfpte uvil(  2to(rpoydap elicilt)aruax  oo0oltn fciysfm em(monu0treoxocto1omtr nvo t) 2to(opny4lpte nvsas aDrrx oot1tee  f3ias a2rauvonu) etomf ta1lptrln o t)s2triopiudolee ivsa()sDtmu  nt4oltn f3iadfm2rm( o t0alxrmfciatfaDelnvsls0setoim oudlpe  nciltf Draur ot4aee  oetldla2eanvs t)teermf3tydomt anvs s0srtr(m iydomenlfvt tfaDtau  ;u0tle  fciad aDul(ms;u)altoxoctatopt li ilt0texoxo ou1ale  fvtl()srrr( ooo1tlxomietytls elump;u0trenmr totoa  auvi;t srumxmpnudlptemnvsa()arurx  nt1tetnmictyt m umu p;(4treomocoy1fmDeanvsls0sexrimpiu4ale  nvil() rrr(rooo4tpx  i3iatfs2eln o u) rxoxr3oodfa ean i;s  eumxo3ou1lm n fetlt)arua( pnt4ope if3iaslsDranms () lenmfctodoa elies;(  rtrxm io1amen icta(fsrrmxmont4tetoioeiad m2rmuvs u) ltnmo to1lpt lnvs t)teuoxo nodomtnmfcsls  Durx o;u1olxomo3iysla2rl(ms;(4teeomo3oadomtrlneolt0setmxm oo1lmen fes s  rumuronu0opto feiaslm elnmo ()artrxf ootoptr nvo;t)teuoimpoy4lme livs tf Dta( ooo1aet  oeiyt sDrm( s;t)trtomrcoytoaDeau ilt) 2umxo oodamt lnvi (f rra(rp;u0olt if3tydlsDraump;(4artoiociodlm r ieo;( s2uoxo3oy4lm nlfvs sfartr(mpoo4aleniictad s ran o;u4aexoir3ia1fatranes (0sexmir nydope mivtl()aDrr(ro;t1ope io3ilt s em( pnu0 rxnmo ia1fpt aivolt0teuoxopno1oltn fctls)aDtr(  nt0tlt ioetld m el(mo (4 lxrmfcia1fate uvs (0truo(o3oudll n nei tfaDum( ooo4apxo o3tlsfm rmnmp;u0 etoxo3iadoate ieil(0trxmxm3oodop  lics () Dur( pou0tlx mf3iyd a2elnvs t0 rermo3oy1omD  nvs (  rur(opio1ole mivia( a2ra(r ;t4tlt mociys mDeanmonu4artrmr3ootom  lies (0 exrxrpou4ap elnct sf Dtr(  ou4tet  fetldfa ul(mo t4arenmr oy1fpD  i ols tetrxo3oo4amt  iei () 2rmur nu1alxn ieiltfa ran s;t4aetnifciodom raieo s0trxrxr oo4llenlfvi (  rtru o;u4open fctytla2emnvp t0 etomocio1lateau s;t  etoim oodapee fviasfs2ua(r ;t1oeeoioctytls em(von(0 exnmrcio1oat anesl()t2uoxrpoudamtnlfei tfsDrru  ;t4tpx mfetltfs2ran o;t0artoio iadop  lnei;s s2trirpnodope  fesas a2rmxrono1tex ioeiasfaDeanvpnu0tlenmr todoat luesls0srxrim3iudomee fcs t)a2urxroou1olt ii3iydlaDrm(ms;(0teerircoytfaDeli o t) etm(opnydlmtemfvsatfs2tr(mo;u4olt mo3iasfs2ua(mo t4alxoxrcoodfatean i s srxmim3nu1om e fci t)arumu o;t0opt if3ildlmDrln snt4 exoiocoo1fmt li il( truoio3ny1ol emnvi t)s2tru o;t4oex  fctydls2ranmo;(0tetnircoydopD  ueol() rtmio iydomeelnvs s) Durx ont4tpe  ociltlsDul(vs;t0teermrcoo1faDe nvi s s2xrio iy1lmt mici s) Dtm(rp;t0tpe  iciasfm ra(vonu)trtnmfcoadopD aueol()srxrxmpou1lmenmfvi s a2tmxmpou0oet  i3tadfa2rmnvs u0tleoxo oatfa r nvi t) eur(mpno4llen fvia()arrrxmo;o1tpx ifctlsls2umuvsnt)aetrif ta1fm e uvi t0s2tmxmpno1oltnlnctl( sDta(r no0aet  i3tltls ra( pnt)aexoxocoodlaD anvi;s0 etrxopiodope  iet t) 2raxmpot1tle ioetld mDeanvpn(0tltnmo ootfat luvi s0s2xo(mpio4openlncs ()aDtm( o;o4tpeomoctltfm2ranmsnt0 lxrxr ootoatelnvs;( s2tmxm iu1ap   neilsf rum( p;t1aet moeilsfa2rmnvs;(0 rxrxo oadfp e n o;( srxrxo iydlp   fei sfaDraxmoot0aptoio3ilslm2eauvp;(4altoxo3iodfpDe ivolt seuoxm nudapeelnvil()aDrrx ont1alen oetatfaDumuvo;t4 lxomf tytlmt au ils0 2xm(m iu1ol elfet ( s2rmu o;u4tpe  oeildfs2uau pn()areomr3ia1oateluvols0t2umiopnu4lltn ici ()srtax  ou1olxnioctydfa2eanmsnt0tltrxo oatopt lnei ()sexoxo iu1openmivtas)s2rrur ot1tpxnmociatfsDranvsnu4trtrmr3ta1fa  aueo;s teur(m nu4lm nmfvt s  2rrxm nu1olxnifeilsls uanmo u0trxrmo3oa1oaDr iesl(0teumiopny4lmeelivtl(farurump;t0opto fcild sDrau snt0altrxfcia1lp r ueslt0 rumir3nydlptnmnct s) Drm(rpnt1tlxomociltfs2elump;t) lermrctodfat anvs;s0s2uo(rpny4amenmnvt (f rurumoou1apeoioeiydfm2uauvsnt4arxnif3tadla  anesls trtmxm iy1lpe  ieilt) rur(mp;o4optomo3tytfaDum(vsn()aetrmrctytfptraues;t)sruo(mpnudlpeelnvt t  Dtm(monu0texn ieiatlm2uln ont0 lxnmf3tytfp r ivs;( srxrxmpio1apte ncil(fsrrau p;u0opeo fciyslaDum(ms;t) rxrif3oa1lp r n o;t  rtmxr3ou4lptn icilt s2rm(rp;t1tetomi3iltla ran s t) exomoctatla   ivo () 2uoxr3io1llt  fvsls s2trx  ;t0oetomo3iadfs2rmuvp;t)tltnxrctydfatrai s t) rum(opiudomee fci t  2uaxr nt1openiietldlm2ulu sn()artnmr iydlmtr ueo s) eur(mpnu1ole livils) 2uru  nt4alxn fetlsfs2um( s ()artnxr3ootfate ueilt  2uoxm nu4olt lnvtasf Dtax  ;t4opxo oeiltfaDuaumpnt)trermocoytoate n sls)s2xo(r3oodlp  lfesls aDumxmpnu0oltnmo3tld sDuau o u0tlenmr tytomDrluvs t0seto(r ou1al n ivta() Duaxm ou1tle mictltla umuvo (4teerxociadlp  ai i s0 rxmxr3iydamt mictlt sDumurpot0aptomocild aDran p t0tetrmf io1lmt  uvi t sexoxm iydlm   fcil( arraxronu1oexoioetydls2uanvs;u0trtnxo ty1fpDranvils0teto(r oo4oltemicia(fsDtr( ont1opxn oetys a2umnmp;(0 rxrxrcoodfm   nvslt0 2xo(rpoudom eliesatfartmx o;o0aeto i3iltfsDum(monu0tlerxr3oytfmt  nei s setr(o3ny1alenmncta()arum(mono0oee  f3ilt a2el(mo;(0alxrxrcoadlmDeaiei ()trtm(r3iy1om elfetl(  rtaumpot0opeo oeiydla2rm(vont0artriocoodlatrli s () 2um(o ny4ll emicslt)a2raump;o1tpen iciatfs2emnvp t4tlenif3tydoat lueils texm(rpiy1lme  ictl(f rrm(mpou4aptniieilsfsDumu sn()artomf todopD  n s;t) 2xm(mpiudam e feslsfaDrrx  nu1alxoii3iasls2em( pn(4tlxnxr iadfmDran s;(0 exo(rpno4amt mfvsat sDrru poo4oeeoioetydls2ul( o u)texrmo3iadlmDe uvo;t srur(opiu4ap eliei (f Draumo;u1aptoif3tatla2uaumo u4artrxrciytom elueol(0t2to(opny4ap elnvias)a2tmu o;o0oexoii3iatfmDum(ms;t)tltnmocoydla e u slt0 etoxrpnydlmeelieslsf 2ur(rpoo0oltn o3iltla2uanvonu)artrif3tadoat li olt) 2ur(r3iu1alt mnei ()s2um(m no4oleoio3iat sDemnvon()aetnxrcoodop rlivols t2urxo oo4ol nlncs ()a2taxr oo4oet if3tas a rluvon()areoio ta1lat li s;s0srxr(o iudllenlfvs t)arrmxrp;u4oex  fcilt m uanmp;()alenir tadfmDrlies;s0 exo(r ny1ol nmfes t)arta( onu0ole ifetyd m rm(mp;u0 lxnir3todfp eaieolt teuoio oudlp   iciasf Drr( ont4texoioctatls2uanmp;(4alerxr3iytfa elnvs;()srum(r no1altemfcta(fsrtrx  ou4apxniieilt m2rmumo;(0tlxnxf3iy1fmtelnei (0 2tr(m oo1lme mfcta()arum(ro;o4texnmfciadfaDul(mo;u)tleoir3ta1fm eaivi;s0t2xoio oudal  lnei t)aDum(mpno0aetniictys m2uluvsnu)texrxo ia1lmt an o;(0trumim3iy1ome mnes (  2tmum ;o4tptoio3tyt s2rl( onu0 rtoxrcia1omtranes;t tetoxm3oudll nmiciltf Duau oot0tetomfctltfm2uaums u)alenxr3iadlmtrlivo s)sexrirpio1lme miesa()srur(moou0oetomfeiasfs2ranvpnu) rtrxr oa1fa ranei;t  2xoxo3iudop  mici t sDuaurono1teen i3tatlsDumnvpn(4altoircoodfpD  i o t)trumiopny1altelfet t)aDrru pot4aetoioeiltfa2rlu o t)alenmo iotla ranvil() etrxr ny1lpe lieslsfa2rrum ou4alenioeias mDrauvo;t0alenxfciotla r nei;() rto(m ou1oleelnci t  Dtm( o;o1tltnio3tyd m umumsn()aeenir tadoa rlu ilt)texr(m3io4omtemicsa()arrr(mo;t4optoifeiysfs el(monu0arxrxo3oadfpte uvs;s0t2tm(rpnudomtn fei s  rra(mp;t1optomictadfa2umu pnt4 lerxo to1oa rau olt)t2xmxopiodaptn fvt s sDtr(rp;t0aptn o3iat a2um( o;t4tlxrmf3io1fa ranvo;( s2xrio oo4oltemfetat)arrmxmp;t1tpx  o3iytlm elnvs u4altoiocoo1faD an s (0tetr(opny1lmen iet s)s2um(mpot1tptn oeiydls ea( p () lxrmociy1lptr ies s0sexmxm oodlltemnviat  rrmx o;u0ope ii3tysfaDul( p;u0texrxf3oadfp eauei;() exoxm iu1lpt mnvsas arta(roou0opxomoetysls em(vp u4 etomr oo1lp   n o s)srxrxo3ou4ll elfcsasfsDta( p;o1aetn f3iltfs eauvsnt4trtnxo3tadfmtr u o t0t2ur(mpnodomtnlnvsat a2rmu  no4tpxo ociadfs2eaums;(0aexrmo iatomt lnei;s0teurxmpiu1lle  ietatfsDrrxr ou0apx moctydfm emu s;t)trxoxr iytlpDrlivi ( tetoirpiu1lm e iei t)s2trurpno1tlxn feiysla ean onu4aeerif iadfpte nvs;s0 2umir3iudlmtnliei (f 2tmu ont4oex  o3ild mDrmn p;()teermf io1fa eluvi s  rtmxm3io1am emncs t srta(  ;o1tlen ieiatla ulums t0altnxrcoy1fmDeanesls s2xoxr iu1llt  feilt sruau ont4apxnii3iltfsDrm(vs;(0alenxf ta1fptr n il() rumxo3io4amte ictl( srtr(rooo0olxnmoeiadlm2rmn s;u0artoio totfpt  u i;t t2to(o3oo1lme mfcsl(  2ta(  ;u1altnio3tydfa umu p;u0teerif iatfpt auvslt)trxr(r iy1altemivias a2rax poo0aetnmieiatla umuvp u)aexrmo3iytlateluvo;t0trxo(m3iy1opeemnci t s2tmxrpnt4oeeniieiydla ea(vsn(4alxrxo totlp  anes t s2ur(m nu4om emfeiat a2tmumo;o0aeeniociatlm2um(vo;t)aeeoxr3io1lmDelivi;s0trto(o3oodalte icsls sDrr( pnu0alt  o3tyd a ul(ms;(0tlerif3iadop  aueslt) euoir3oo4lmtnmfvsls)a2rau oot4tpeoioctydla em(vo u4 ltnxr3oa1la  li olt0 rtrirpoo4ope micsasf rrmur nu0oeenifcilsla uln p u0teerxf3ia1lat aieo;t)sexmimpoodlm n nes sfaDrr(mp;u1aptomoeiydfmDuauvsnt)tlermo3oodlat aiei;s) exoxrpou1am nmfcta()artm(ronu0oetoifciytlaDra(vo;t)aexoif3ootop rlneo s0teuoio3oodolenmici (farumum ;u1oex mf3iytls2rmu s;(0tleomo tydfmD luei;s)teuo(mpnudom nmfct s)s2urum ot4optnioeiyd s rmuvp u0areoxf3oodomDrlu i ()s2trim3nu4lme  iesls) rumx oot4texomoetltfa emuvsnt)tltrxo oodopDelues s)srtmxr nydam   fctatfaDraxm no1opx moeiadfs2eluvp;u0tleoxo to1lpDr u o s0 etrxo3iu1llee ictat)srurx onu1apenmfctasfs2rau sn() ltnir todom e n o ()setr(r nu1ap   ivs t)arum(ronu1tpe io3iadfm umu o ()aetomr3ootlmDr n sl(0 etoxmpou4lle livilt)srtr(moot0tlt if3iltfmDuan on()arxrxr oydopDeaueolt)trumiopnu1ap emfcsls)aDtax o;u0teeomfciltfa2umuvpnu4alxnmr ia1lmDeluvi t0seum(o no1lpte fet s s2uaurpno0tpt ioeiaslm um( snt0trerif3oatoaDe nvol()sexr(r nu4ope  nci tfsDum(rpnu0openmfetyd a2el(mo t4alxoxrctotfm e ieols)trxm(o3nodome lnvilt)sruau  ;o0alxnif3iydlm ulnmo;()texnmf iotlp  luei s)setrxmpno4ll e nvt s)aDtm(mo;o4apx mocilt s2em( p u0trxrmf oodopDeauvols0truoir3nodope  ncilt a2taxrp;o4aexnmoeiaslm um(mpn(4artomf oydfp r u s;t) euoxm3io4ome lies s)srrrx poo0aeenmf3iatfs2eau p t0tlxrir ty1lmDeluvsl(0 2xo(o ny4lpe lnvsl(f 2tr(mp;t1aee  ieiydfmDea(mp (0tltnmo to1fm  lu s t)tetr(o iydlptn ivs (fs2raum ou0tpe  ieiyd a umums u0 exrxf iatfa rlueo;s trtm(m iy1omtn ivt ( srrr( poo4tltnmf3iasfm ua(vo u0 renxo oydoaD lnes;s0s2urirpnydapeemicilt srra(mooo4teeo o3ildfaDea(vo;() lxoif3to1fmDelnei t) etm(rpiy1lm elfctls  rumu poo4tleomieildlaDranmo;u4treoxo3ootop  aiei t0seurim3ny4ll  mnctltfaDrau p;t4tltnmociyd sDumn snu)aeerxr3ty1fmt luei s0 exoxm iy4ome mfvt t)arur(rooo0aeen ictltls elump;u4 rtoirciytopteau i t0 2xrirpoo1ame  netltfaDurxmonu4oee  ociys m2uauvpnt4 rxoif oy1oa raieolt truoxo oy1amtemfvslt)artaurpot0olenmfciytlm2rluvp ()alxnxf oytfm r nvilt trxmxm3iu4lmeemics ( s2uaxm ;t1texomf3tld mDrm( p (4 rtnxo io1lpt  u o s)seuoirpiy4lptemivs t)artm( pno4tpxoif3tlsls uauvonu4 rxnxr iytomDeau o;t0t2tmxrpnu1omte nviat aDtaxm ou0oltn icildla em(mon() lxomf oodopt  neo;t0tetr(r oydom n iesa(f rrm(  ;u1apenmfeiytfa2rmu ont4 eerif ia1oatr ivi t0s2umio oudamt lfcs t)s2taxm nu1teen ociysla2eanmp;t4arxomrcoatlptranesls0trurxm3oy4lpee fcilsfs2taxrpnt1tee moeilsfaDraumo;u4 rxoif oatlpDeauvi t  exmxopoo1lm   fvs s  rtr(mooo1apt  o3tldfmDrlnvo;(0trxoxrciotfpDe ieslt0 2trxm oo1om  lfvt () Dtrxm ot1oltoioctldls2ran pnt4 lenxf3oatomDean i ( t2uoir3iu4amtelfcilt) rurx p;t0tex ifciat a ea( s;t)trtrxf3tytlm  lnei t0t2xoirpio4lleelivia(fsrrrxronu1tetomf3iatfsDuln o ()aeenxrctotlmte i o ( srxm(opno4lpt  ict sfs2raxm nt0openmi3iatfa2ranvs;(0 ltoir3tadopDeaieo s)t2uoxo nydoltnlictl(fsrum(  ;t0tpeomo3tytlaDulnms t0aetnio3iadfptrlnvsl(0trum(rpiu1oltnlnctatf 2rmxr nu0ole ifetydfa2raumpnu4trxoxo iatopt lnvo s0 etr(r nu4al emicsat)a2urur ;t0tlenifeias a em(vp;(0 ltomf3oadoaD  nes ( s2xrxr3no1lpte fviasfarta( p;o1tex mfciltls2ra(vs;(0aeenxfcia1la rau slt0 etoxo oydap n icsat  rtmu ont1tlxnifeiasfa rlnmp t4 rxnxf iadlp e neolt)setm(o nodlp   fct ( s2urxr no1texn iciyslmDumumsnt0tlxnioctotop eaivslt texrxrpiy4alt micslt s2trxmpot4oex ioctls a2elnvsn(4aexrxo3oytlpDrlnvi;() 2tm(o3iu4apt miviatf rurx o;u1aexnmociydla2emuvo;(0altoir3to1fm r ivs;()trtr(rpoo4omeemfviat a2taxr ;t0teeoiiciadfs2em(von()aexrmociadlptrli o s0 rtm(mpiy1am   ict t  2uaurpoo1tlto fetysfm em( o;u0aeerxr3todoaDr nesls texmxmpnu1apt  ici (fa2umxrp;t1apxo o3iyt sDua(vs u4aeerxo3iydfpDr ies;(0t2xoxm iy1ope lnvia( sDurxmoot4oleo octyd m em(vpnu4alenif3todlmt li ilt)truriopoudape  fes t aDtaurp;u4aetn o3tat m2ulnvon() rerxf3oadlmteaivs;() 2xriopoo1lmeelfvs t srurxmp;t4texnioetyd s ranms (4trtrxfciydfmDe u sl()trtoir ou4altnlivilsfsDum(moot1oeeo fctadfmDuan ont0 etrmf todomDe uvs;s teur(o3nydlpe mncsasf 2umu  nt4aptnmictyd sDelnmont)alenmfciatlaD au i s0trxrxo nudop  lictl(  2raxmp;o4tptomocils m eln onu)texoif3iy1lpDrauvsl(0 rtrxmpiu1lpenlfvil()a2uru ont1aptoif3tyd a elums;t4 renxf3oy1fp eanes ( s2uoir oydlm eliesltfs2ua(ro;u1aetoif3tld s ea(vo u4 etoif tatlm  lues;t0 ruoxm3nodlpe lfctltfsDtau  ;t4altnmf3tadfm2emumsn(0teerir oy1lmte i ol(0trxrxr oydlp n ieslt) Dtaxrp;o4ope moetldlmDra( p t)arxrir oo1om rai o;t) 2xm(m oo4alt mnvi tfs2ua( ooo0tltnif3tld a ranvpnu) lxomr tatlmteau il( t2xoxrpiudolenlfeia(  2ta(r ;u0olen fetldfm2em(mpn()tlermrcoa1laDrlueo (0s2xm(o3nu4ame mfesas srur(rpnt4tpeo feiatfmDumu s;t4trxoirctydlpD ai ilt)s2tm(opoodlpe lfes t)arrau pnu1olt ifctat a2raump t0 exnxo3iydfaDr ivi ()trtmxo3iu1amt mivilt arumurp;o4tlt iieild mDum( o;(0 rtoio oatoaDelieo;t  rumimpoodol  mneilt)aDtmump;u1oetnmfeiadlsDrm(mo;u0 rxnxfcoadlmt  ues t  rxo(o3oydlmeemici s)s2um(m nu0altnmo3tytls um(von() lxoxr3todop   ivo;t0texmim iydlltnmivsat)sDtru o;u0ape ifctat a2el(mo;(0 eeomf3iatlp  luei;s) rxr(rpiu4omt livtlt)a2tax onu0tetn iciydlaDeauvpnu)texrxf3to1fpt  u olt teurim3io4lptelneiat  Dum(r no4oexnmoctyd m2ean p;(4aexomo3todlm r ivo (0srtr(rpiodlpe livsa(faDumu ono4oexomoeiyt mDem( p;t0 etrir3tydlatelivo;(0trxo(r oy1lpeemnvils) 2rrxr nt0ale iociysfsDul(msnu0alermfciy1lpteliei t0 eumirpny4ameelivt ()srur(m ou0alxniietatfaDumump;t4areomo3iytlmt auesls) rurirpiydom n ieils a2rru pno0oltomf3tyt a ulums u4 renxf ia1lpteanvi;t  rtr(o3ou4lmeelnvs tfsDrax  no1aeen i3iltlmDrlnmo t0texrifcto1opDrlnvolt) exmirpno1lptemiesltfaDua(  ;t4apeo ieiytlmDranms;(4 eerif3iatla elivo;t s2trirpoy1lp n fvsat  rum(mo;o0oeto i
\ No newline at end of file
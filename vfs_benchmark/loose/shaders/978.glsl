@@ -0,0 +1 @@
+n s;t tetrimpoy1lmt  fctasfa2ur(m ;u4optnifcilslaDumumo u4tltrirctodla eauvo t teuoio3iydaleelnvslt)s2ur(m nt0oexoioetlt s rauvs;t0artnmr ty1lmteau ilt tetmio3oo4lp e ncil( s2trur ot0tlxnmiciydla rlnvo ()teenxfctatlp  lnei s trtrxm3nodoltnliesls arurxm ;o4alxniicildfm2umums;t)alxomo ty1opDe nes;( teum(m3oydopee nviltfaDtr(r oo4alenioetld a2umn s t0tlxrmo3ty1faDrauvs;t tetm(rpoo4amtn ictat sDtrx p;u0alt  feiltfs2ua(vs;t4aexoxrcoa1lm rliei t)tetoimpnydopee iesa() Dtrx pot0oexnmo3iat m em( s ()tetnio oydfa ranei;()t2tmxr3nydomt lnet s  ruaur ;o0alxniicildlsDranvo u)arerxocoodlateaiei;s seumxm io4llt mics ()artr(r nt1aetnmf3iat a2rl( snu0alxoxrcoydfm ran i (0 2urxmpiy4am emieta() 2trxrpot4tee ii3iasls2rl(vp t0 rtoircto1lmD lneilt)trurxo3oo1am elncil(  2trx pnt4oexn f3tadfm2ra( p u0 etrir3tydfmD lnei ()setr(rpoo4lltn iesat s2tmuro;u0alt  i3iysla ea( sn(4trtnmr iytla rai o t texoxopny1ol nmnvils) rtmx ono0tet mictltla ea(ms;(4teenxf3to1latranvsl(0srxm(opny1al elict (farua(ro;t1ape ifciys m rl(vpnu4arxrmrctytlaD  u il(0 rxr(r3oodaptn fvils)s2umxr no4tlxnmoeiyslaDeln pnu0texnircoy1fp elivs;( seur(r3iudop  lieiat  2raxmoou4tlxoii3ilsfs ua( p;u)aexnio3to1omte ies;s)s2umir3iudom nlnciatf 2tm(mp;u4tetnmf3iyt aDelnmsnt4tltomfcoodfpt li s ()srxoir oudap   fcta(fa2rm( ooo1alt miciys s em( p u0aeerif tatoa  livo;s  exo(m iudolt  ies t)aDurx o;t0aexnmi3iydfmDelnmp;()tlxnxr iydopte ivil()teur(r3nudolt  fvsl(fsrrru  ;o4aeeomietld sDeau snu4alxomo ootoa   ues;t)srur(o3iydop   nvsls  2rmump;u0teeoio3iydla2eanms u0tlxniocta1fmDelnvo s0 eur(o3oy1lltelfei s)aDrrxrp;t0oexnmociysla2uau p;t4tlerif3ia1lpDe n i s)seumxo ou1llenmfeslt srtrxmoot1tle  ocildfm2rm(vsnu) ltomfcootoat an o s0t2trirpio4apte ietatf rra(m oo4aex mo3iaslsDemn o u)aleomf3ty1lmDe iei;(0seuoio3iu4ll e iet (  2ta(m ;t0tpx mfctasfs um(ms t0tetrio iotlaDrlu s (0trurxm3ou1ol nmivt tfaruaxr ;o4teeniiciltfm2elumpn(0tlenxf3tadom eaivi t) 2tmim no1ll   icta(fa2ta( o;u0optniieiatfm eln o;()tetrmo3ty1omt lu o;t  eurxo3oy1aptelivi ( s2rrxr oo4aex  oeiasfa eau s;(0 eeomocta1fmDe nes s) rurirpnydomeelfvt ()srur(mpnu0apeoifeias mDeln s;u0texrxrcootlmtraivo;t0 rxr(r3no1aptnmfesa( a2taurpno1opto feiasfm elnvs;u4 eenxr oatomteai sls s2xmxr3ou1oltnmiei t  ruaumooo1alto oeiasfm2emnmo;t0 rtrxrctydlaDraneslt0seuo(o3nodapee iesa()aDumur ;u1tex mieiyt m2emu pnu4arenmr3tytlmte uei s s2uoxrpou4ol  mivt (fsrrm(m no0apx ifctat m2uanms t0tlerircoytop  auei s)tetrxr oo4am elfvsl(  Dua(mp;o1tpx mieiytfaDrlnvs;t0 rtrmr3iy1fmteaneilt)sruo(m3nydlpe  iet tfs2trxmp;u0aexn fciysfaDua(mp;t4arenmr tydfm rai o;t  2xo(r iudop emneilt aDumumpnt0oetnifctld sDeln pn(0 ltnmr oodlatraieo (0trtm(o3nu4omenmneiat) 2rrum ;t4opxnio3iltfs2ulnms u4artoxfctydop r uvs s  rurir3oodlme lfvilsf Dtmur ;u1tleo oetadls ua(vo;u4texnir ia1faDelnes;()srxoiopio4aptn fcia(  Duaxmooo4tetomfeiydfaDel(ms;u0 rxrxr ty1oaD aieo;s0 2trio ny4amt lfvtat srrrum ot1tltoii3iyt s ua(vp;t)arerxo tatlat livi (0 rtrio oo1aptnliei ( a2uaxrpoo0alto fctyd a2uln ont4 renxo3tadlmD lneo s srtrxo ou4aptnmivsasf rtmxm ;o1aetoiiciydlsDuauvo (0tltoio totfmD lues;t)sruo(rpiu1olte ivsasfarrmumonu4apenmfetat s2rlumont0 lxnmrcta1lmte n o;s0texr(m3iydoptelfct s  2ra( o;o4oetnmfeiat a umnmont0 renmf3iytomDelneo t0tetmirpoydlpeemfeils a2umurpnu0oltomi3tldfa rlu o;u)arenxf tadfaDeaies t srtr(r oy1om nlfci sfsDraurpou1opxoioeiysla uaumpn() lenifctydfm  au olt0 eumxm oodlptemnes s s2rrxr nt1tetnmociltlaDum( pnt)tltrifctadoa  auvs;t)t2xo(r nu1ll nlieilt)sDrmxrpot1oex ii3tatlm rlu s;(0alermf oodoa eanvilt  2ur(r3io1ll  mivsls a2taumoot0tltoiieiyd m rl(vp;t) rtrio3todlaD  neils0teuoxo ny4opeelfes tfarrauroot4aleo fciat aDuanvpnt0tltrxo oa1oateanvo s)s2toxr ny4op e fctat aDta(  ot1alt iiciatla rmu o;(4altoircto1oate ueo;s) etr(m3oy4ole  fcs sfsDtm(mpno0tle io3tadlmDuau ont0alenif oadlp eaies t0s2xrxmpiy1opeemiet tfarrr(rpot1ale mi3iydfaDua( ont4teeoif oydlp e n o ( texr(o3nydomenmnvt tfaDtr(mp;u0tpxoii3tytfaDulnmpnu4altnmocoatlptrauvol(0t2tm(rpiodaptnmfetl(fs2umx onu0oleoiictls s2uaumsnu0teenmo3todoa  ai ils0 rtoim iu4lm nlfvs t s2rrxront4alxoiieiys a2ea(vsnt4alxnxr ia1oa eanei;()t2toxopiu4aptnlivi () rtr(ront4alt  i3ilslm2um(ms;u4tlxriocty1om elneils) rtmxm oydlme  ivt sfarta( o;t4altn oeiysfm eluvo;t)areoircoy1lm e nvs;s0trxm(mpoy1alt  ncilt) 2rru pnt0olx mfetlslm2ul( pnt0trtrmo tytoaDelues t)s2toxopnydlmen ics t)artmxmpno1aexoii3iaslm ua(ms;u)trtoif3ia1om raies t)texrxopoy4lp   nvsl(fa2tmum no1tpx  oeiydlm2rm( pnu)alxomf3iydfmDrli il(  rtmim no1op  mnvsas s2taumpou0tex mfctytfs emnmont)aexoxr3ta1lmt aieil()trurio oy4aptnlicils srtru p;o0aeen iciatls2emu p;u)aeeoifciydomt aivi;t0 rumimpno4om emnci ()srtr(rpou0oexo iciydfm uanvp u4 ltomf iy1lptranei;()sruoxo3oy1op n nvi t) rtmumpnt4tee if3iysfa2ea(vp u)aleomfciytfa rln sls0t2xoxr3oodlpt lfei tfs2uru p;t4opxomietadlm rm( o u4artrif3oa1lmteauvilt seurxr nodop   iei tfarrrxmono4tle  oeiat s uanmo;t4 rxnmo3oodlpte i s;(0 2umir3iu1lm e nesat srrmx poo4opeomociysfm2ra(vo;u0 ltoxr oadomte uvo;()srtr(o3iy1apt lnes s  rrru  ;o1tle if3taslmDul( p;u0aexoxr3to1omD auei;( seto(o3ny1omeemfctasfa2rr(mo;t1oex mfcildfs2ulnmsnu0texrxo3tadop e nvi t0t2xoio iy1ap n icilt)s2umum oo1apxomfetydfm ea(msn(0trxoxrcoytom  au ilt)trxmxopiudlpt  ici (farraumo;u1tle io3ilt m2rl( pnt4alenirciatfmDrluvslt0 2trxr ny1amtemneiatfaDtmxr ou0alxnmfciat mDemumo;t0 etoxo3ootfp rlivo (0tetoxr3ou4ap   fvi s aDtrum ;o1alxoioeiysls2el( ont)teermo iy1oa   i i s teumxm ou4ope  ivslt  rur(mont1tetnmietld m rluvs;t)trxnxo3ta1oat luei s  rxm(r nodop elfcs tf 2tm(ro;t0alxoiictltlsDua(vs;t0 lxnmr oa1fp r n o t  ruoirpny4ale lnesls sDuau ont0oet mi3iaslm ulnmpnu4arxrxocoatla eluvilt0 etr(opnu1lmeelietl( s2uaur ou0oeenio3iltlm uluvpnu) rxomo ta1om eau s t s2tr(o ny1am e nvsl( s2ua(m nt4teenioetadfmDemn o;t)aeeoir totoaD auei;t0srtm(o3iudlpee fes t)arrm(rp;t4olxnii3iltfm rm(msn(0trxrif oa1fm eai i (0sexm(mpoo1om nliciat)arrrxrpnu0oex  iciydfmDul( pnt0artnxr oy1lm r ueo;(0sruo(opno4al nmfvia(fs2tm(r ;t1alx mietasls ran snu)altoifcoodla  lneolt0t2toiopno1lpt  fciltfa2ta(  ;t1tltomo3ilsls2ul(mp;()trxomf iadlp e neo;()t2xmiopnu4omenmfcsa( arrm(root0alt iictyt a emums (4aetnif3iatomteau i;()sexmim3no1om n ivs t) rtm(ro;u1aetoio3ilslaDran pnt0arxnmf3oatoa rluvilt0srtrio3oy4omee nesl(  2tmu p;u1teeomietydlmDra(vo t4 rermf iadlat lneo;t)t2trim oo1omte neia( srumxrp;o4tpe  fctys a rl( snu0trtnircio1lm rlnvslt)srxriopnodale mfct s s2umx pot0opx  ociytlaDrl(vo t4tlxrio ootopDeanvo;(  etoir iy1lp  lfctls aDtrx pnt0open f3iyt s2ranmsnt) ltomr ty1fa rli s t0sexoim3iy4al nlnvt (  2uaur ;t0teeomoeilsfa2ra( s (4trtrmr3iydfate n ol( t2xrxr iudapt  fei t) Dtax  ;t4olxomieildlmDua( pnt)arenio oo1fatrluvslt  rum(mpiy4am  mfcsa()aDtaxrpnu4alxo i3ilt m um(mp (0texomr ootfpt aueil( s2xrirpoo1om elfcs ()arrmur no0aex ii3iysfs ulnms;(0trtomrctodfmtr uvsl()s2xo(o iu4lp elics s sDrm(root4opx io3tld sDumumsnt) exoxo iytfmD lues s sexoim iy4ole lncia(  2umxroot1openiictaslm rlnvo;t0aexoxo oadlatrli slt  2trirpiudal nmneils  Dtau oot4tptnioeiltlm2um(mp;u) rxnxociatfm e ivolt) rxmxo no1ll nmnvsat arumurp;t0aeenmietld a eln ont)teerxo tatoateaneils0srtmir3io4op nmnci s  Dta(mooo0oex  ictlsfmDuanmpn()tlxoif tydfm   iei;( teur(opiy4omt  nvt s artmurpou4apenif3iys m rm(mo;() rxoxo tytoaD livs t s2ur(mpnudapee ivil()srurxr ;t0tleoif3iyd a2uaumon(4 ltomoctatfmt  i il(0 exmxo3oodal emics s) rtmx ono1alxo icildla ea( o;(4trtoxf3ty1fm  lnvslt  etmxr nudll  livi s aDurxront4opxo ietldlaDum( s t0tleoir3oatomtr uesl( trum(r oydllen iet t)aDtrxrp;o4tltniieilsfm2uanvp t) etrxf3oo1lmt livo;t)t2tmir3iu1lmtemiet ( aDuaxmo;t0tlx mf3iatlm2uln sn()tlxnmrciytfa r u s;s0tetrir3ou4ll elivilt)arrau pou1aetnifctatfa2ean pn(4 etrxo3oytlmt  ivsls  euoirpoo4am nmfvi sf 2rmx  ot0tet io3ildfa2rln on() rtoirctadfmDraues t  ruo(rpoydaptnmivs tf 2truroot4altn feiysfmDumuvo (0altrmrcoa1omD  u s s0srtrirpoo1olte fvi (f rtaur ou0olxnmoctadla rln pn(0alerio3iydfat auvi t0t2um(m3nydamt mnvilt)s2ra(  ;o0alxomf3iat mDua( on()artnmfcto1lp eanei (0sruoxmpny1apee ieilt  Dtm(rp;t4aptn ictls m rm(mo () rerxfcto1lpt an ols0t2trir oydam  lnctls)sDurxr ot0alenif3iatfsDelnmp t0 etoxr iytlaD aivsl( t2uoio3iy4om emfvt s)a2rru onu4ole mfeiytfmDeaums;() lermo oytoatrluvs t s2xoxrpnydalee ict t)srraxm ;o0aee iociad s2ul(mp (0aexrmo3oy1lp e uvi;(0 etm(o3iu1oltemnet s)srtaxro;o0tptn o3iadla2eaumsn(0treoxo todlmte nvi;s0trtrimpio4lpee iviat srumx ono0tlt  octld aDrauvo u0 lerxr3oytfaDean s;t) euoio iydomt lncsas srrmxmp;o1olen fctadlm rmuvp t0 etomr iytfpt an ol(0 ruoxm oo4lp  lics s  Dtr( oot1opxnmoctydlaDul( s;u4trtrircoo1faDr ivs ( s2tmxopiu1opeelnvsat)arurxmp;u4aptnioeilsla2ran o;u0tlxoiociytlmDrauvils)t2xriopno1olen icta(fa2taxrpot0tee ifetadfaDelnmo;t0 ltoirctytopt lueols0s2tm(mpou1lmtemfcs (f rta(r no0apeomf3ildls2el(ms (0aetrxr3ty1fpt aivs t) ruoxm3oo4amee fcsl(f 2ur(monu0oetn i3iatfs2ea(vp t4trermr to1faDe ivs;t) euo(o3ny4ll emfetlt)a2rrxm ;o0aexn f3iat mDrm(mont4 ltomf3oytfaDeauvs;t) etoxo ou1ll nlneils aDrr(ront1aptomociad aDemu s;t4tltoxocootla e ivs s0 2xm(rpno1lmt lnvslt)a2rru onu4tptn i3ilsfm2emnvp;(4 lxrmr oy1la rli s;s0teumim3nudal  lfcs tf 2trxm no1tltn fciad sDra(monu0teerif3oadla  aivo;(0srurio3iy1alenlicsatf rraxm ou0teto oeiltlm2ranvo;() reomrciotfp  aueils)s2umirpoydoptnlfeslt)s2raxr ;o0ale if3ias m2elu pn(4tltrmrcto1oatr nvi;t tetmir iy4lpe  ieiasfsruaxrpou1oltnif3iadla2rl(vp (4 eeoxf3iadoaD an ils0t2tmxo nodal n ivtat a2rrxrpou1tltomfctys a2ra(mo;(4tleomocoa1fpDeluvs;() rtmim3iydlleemivtl(f rrau ono0oexn icils aDrmu s u)alermf3iodoa eau s t0seuoxr3nodlp n nei (fartruro;u0oleo o3tadfsDeanvp;t0trxnxfctydlmDe n o s0trum(r3no1ole  icils a2um( o;t0oeeo feildlaDrl(vp;(0 rxnir3ootop   n ils) rxrir3nydlmte ietl( aDrrxmpot1oet mfctlt s ra( o t)artrxfcoatom r ues t truriopiudlpee fci (farraxmoot4tlxomfctatla2em(vs;u0trxnxociatlm   i ols0t2uoir3ou4om   ncsa( sDtr(mpoo0teeoif3iatlm uanmo t)teenxr iy1fptr nvo s)s2xm(opoydaptnmnct ( sDuaxr ;t1tpen o3iadlmDeauvp;t0 rxomoctadfmD lu o (0 2tmimpnu1al elnvt () Dumx o;o4optniociysfm rln s;t0texomfciotfmtrli o s s2tmir nu4op emnvtas)aDrrxrono0apto i3iat aDuluvs t4treomrctotfmt  uvo;t0sexr(o oudolt livilsfsruaum oo0olxnio3tltfa2umu p;u)trxnmo3oodlmDran s;s0 2urim3no1lm  livsl()s2urxmo;u4opxo fciytls2ranvp ()aeenmociadopD  nes;()srtmio oudlmtnlicta(farrmu  ;u0tpx  oeiasfsDuauvo ()alxnif3ia1omDr nvil(0setm(o iy1apt mnvtls sDrrx  nu0olx ii3ildfaDumu o;(4aetomo oadoatrlueolt0t2urxr3oodamte fctl( arrr( o;o4oetoioctatfmDumumsnu) ltomr oydlpDr i i;s)t2toxmpny1lpt  nviasf rua(mp;o4oexo iciytlmDrlu o;t0 rtrxo iatlatelnvo t) exo(rpno1amenlfcsatf 2trurpno4oexomociadfm2eanvs t0aexoxfcoydfa elieols)tetrxmpiy1lpenlivtat) rrm(r no0teenmo3ild a2ulu s (0tltnxfctytlat auvi ()seuo(rpiu4ap emfvtlsf 2rruro;u1tptoifctlsfs2ea(monu)trermo3oo1lmD  neo s seurxopiu4lp emneia(f rumur ;o0oeenii3ilt a2ea(vsn(4texrif oydlmtrlivi (0trurxopio4lltemivslsfsrtrur ou1tltnmf3iys a2rlnmo t0 rtrxo oa1fateanvs s0srxmxr oy1ale  ivias)aDtru  no0tle mo3ias a2uluvpn(4treoxocoodlmDrlues;t  eto(mpio4omtn fcsls  Dtm(m oo1oex  ociltfsDrmnms;u4aexomf oytoaDr n s;s t2xoxm no1omenliciat) 2rmxrpnu4aexnmfeiysla rmnmonu4aeenif iatomDeanvs s)srum(r3io1apee ncslsfarrau  nt0oet  ieiydfsDeanvp;u0 lxrxfctotlm eauvi s0 etrir3iydaltemfcslt  2taxr ;t1ale mictyslmDul(ms;u0aetoif3tatoatranvo;()trtrxr3iodlm elneia(faruax onu1tpt mfeiyd a2rmuvs () ltomf iytoat au ilt0s2tmxopoodap   iesas  Dur( o;u0oeen ociatlaDeln p (0teenxf ta1lp  liei;(0 exo(o3oo4opee nesasfs2uaumpot0opeo f3iadlsDumnmo t)tetomf tydopte uei;t srxmxopnu1lme  fvsa() Dtm(monu4tlx  f3tysls2rlnvs u)tetnmoctadfaD lues s seum(r3nu1olee neilt sDrr( poo0aeeo ieiadlsDumnvpnt) rtnmr ootlp ean s;( setmim ou4opt liciat a2tmur ot0oleoio3iyt a elnmont4 rtnmrcoadfa   ies s t2urxopiodapenmnei sfsDtmu  ou4alen oeiltfm emnvpnu)aeeoif tytla  ai o t0 2xrxm3ny4optelictl(f 2rmuroot0oeto ieiydls ulnmo;()aetomf ia1fpDeli ils  rumxr3oy1am  mnetatfa2ur(  nu0aeeo ictltfsDuanvp t4trerirciydopteai i;t)s2umirpiy1ameelfviat  rtaxro;t1altomfciltfm ea(vs (4teeoxo3tytlp r nvsls0t2trxrpoydom e neta(  rraur ot1tpxo ietasfa ra(mo;t)tltomf3totlm   ies;s trxrir oydamtelivtat aDrmu poo1tpenmo3iysfm2rlump u0 ltoiocty1omtr ivo ( trto(o3io4lp e fvt s)artr(rpoo0optoiictadls2emuvs t)aetrxf3oo1fatrauvi;() rtrxr iy1alte ivslt)sDrmxmpou4tpxn fciysfa ra(mp;()alxoirctydoat  u o;s) rtm(r io4ll nlfes (f rraxrp;o0tptoio3iatfs2elnmo;(0tlxnmfcta1op  auei (0t2urir3nu1llenmivs s)sruax p;u0tlenioetls a em(mont)tleriocto1lm rlivilt)t2tr(mpoodopt  fctat)s2trxrooo1apxnmoeilt a uauvpnt)tltrmr3oa1fm  ai il(  2toxo3iodol  mnetat  rumumpou0olenioeiltfs2uln snt0texrxo tadoa e i s;t  2tmxrpiu1op nmieilsfsrumxrono4olenmf3tlsla2el(vs (4trxnif3ty1lpDraivs;t  2uoxmpiudal emfvt sfsrrax p;u4tex mo3tydfmDel(mon() renmfcty1fm elivs (0texmxo3nu1omenmnvtl(  rrm(ront4tlxnmociatla uauvsnu4trtoir todfptr neolt0tetoxr iu1ap e nei sfsDrrxrp;o1alenifcias s2uanvont)aexrxrctadfaDelues;(0 rxm(opiy1omeelnctl()arraum no4opt moeiydls2rmuvsnt4trenir oodfatelnvo s0 2ur(o3io4ol emnctls sDtrxmpnt1apenmiciadfm el(mo (4aeenxf iydopDr neo;(0srxmim iodal emfei (  Dtrxr ou0alxnmo3iydfa2rlums;t4arenio3ty1om rau s t)setr(r3iu1amtelnet t)s2ta(roou1opx mieildfs elnvs u0texnxf oytfmtranei;s) rtm(r3io1op elfvta( sDrmx  ;o4ape ioetadlm ra(vs u)trtomf ootlaDeaneol()sruoxopnudllt miet (  2ra( o;t4optn fciysfa ul( p u4tetoircoytfa  li s;t0 etm(r io4ap   neiltfsrta(m ;u0tle moetytla umnmsn(0 lerxo iy1fpteluvils0tetmxrpnodlpt lnetas  2rrur oo4olx ifeiadla emnmo;u0artrxo oytlpD  nvsls0 2xoim3iu1ope mnvil(farurx p;t0apeoiieiys m2ra(vo u0 eeomf3iy1fat  u i (0sexrim oodlpen fetlsfarrru ooo4texnmocilslmDumuvp (0 lxomr iadomt lnes (0 etrxo3ny1lmenmnvsatfaDtauro;t1tptnmfeiydlsDumuvont)areoxfcoydfaDe uvi s0teurio3iy4om n fvil( a2tm(ront1tet ifetydlaDranms;(0altrmrctotfpDrluvols) 2toxrpny1lmt lnctasf 2raumpou1apt ii3tlt aDrluvo;u0aeenmrcoodla  li ilt  2uoim ny1am emncsatf Dtrx oot4tltoiieiyd m2rlnvp;t)tetoxrciy1fa  aies;s) 2trio ou1lp nlivtasfsrrrum nt4ope mieiytfa rlnmp u4trtnxo iotfpte ivolt seto(mpiu1llen icil()aDtm(  ou1tpeomictadla2rmumpnt4texoirciotlp eluvols0s2uo(opiodole micia(faDrrumpnu1olen octytfa2ulnvo t4 etrir3iadoa  au i;t0trtr(o oodom nlnctl( sDuau oou4oet mf3iatla uaums (4tltrmf tytfmDe ieo t)t2umir3no4ameemneiatfsrrrxronu4alxnmfeilt a2uaums u0arxnio tadfptr nvi () rxrxr3iudolen ivil() rrm( oou4tpe iictys a uauvon() rxrircty1om raivol()seurimpio1lm nlnvs t)srrrumpou1alx  fcils a2emn s;u0tlxrirctytopteaues;t)s2ur(rpou1alt lfctat)aruaur ;o1ole mietltla2rl( pnt4trxrif tytlptrlnvs ()tetm(rpny1apeelies s)sDtrxmoou1aleoio3iat a2rluvsnt4 lxnif iy1lp ran sls) 2tmxr oydlp elnvsas)a2umu  oo1aet  oeiys sDel(ms;u)teeoirctotlp eln i;t0truoxopiy1omeelfetl()a2tmx o;u4tpto octatlm2rluvs;t) etomocoadlmDelu i;s0 exmxmpiu1lltnmncsa()aDum(  ;t0apx  f3ildlmDeluvs;t0aexoir3io1lat  ueo t0 2xo(o ny1omen fesl(f Drau pot1optnmfctyd sDeanmonu)texnmf oy1latrlivo;s srtmxopnodamte fvi tfarrm(  no0tpeo ociadfm2rmnmp;()arxrir3tatlmDeluvs (0 rtmim ny1omenlfcsls) rtax ont0tee mfetadfsDelums (4aexrircootfa e uvi;s0s2trxrpou4lpte iviat  2urxm oo4tpt  feiytlm2rlums u) lxnmoctotlp r u il(  2xrir3nu4lmee nvslt srum(m ot0opx  oetat aDeau o;t)treoio3tydlm   ivsl(  2xoxo ou4al emneia(f rurxronu0oet ifetytfm umnvsnu4tltnxfcty1laDrluvi t0 2ur(r3io4omtnlnctlt srtrurp;u1oeeomfeildfsDelu pn(0 rtnmfctytlaDelues;(0 rtoxo3oo1am emnvil()a2rmx  ou4oltniieild a rm(mp t) renxociy1omt  nes s0teuo(m3ou1ap  livta( s2uaur nu1opto i3iys sDulu s (4tltomo3iotlm eau s (0t2tmim3oodapenlfvtl(f 2urxmp;o0oeenif3iasfa2ulnmo u)aeerxr iotfm r nei;() eto(m3nydal  mfcslsfa2ua(  no0oeto ieilsls2emumo t)trtoxf3to1lpDran o;t) 2umio no4lptnmfcsat a2uaurooo4opxoioeiltlmDuan p (0 ltomocoytfp  lneo ( trxm(r3iudol   fcsas srtmx pnu0oeeomf3tydlm emump t0 rxoiocootlat  ivs (0s2xm(m3ou4lpt mneslt aDum(rpno1tltoiiciatfs2uau s u) reoifciatlp  lueo (0truo(o nu1aptemivt s)sDururpnt4tpxo o3iydfs2uluvp u) rtoir3tatlm  liesl(  rxrxr3io1lm n ivs tf 2rm( poo4altoiictyd aDumnmsnu)teerxr3ootlmt anvsl(0s2xmimpiy4alenmicsatfa2trur ;o0olxo ieiydlaDemnmo (0 eermfcia1om raueils0s2xoir oydal n feta(f Draxro;t0tpxo iciytfa ulu p u0trtoif3tydfpDe nvol(  2xrim3nu1ole  fct sfarumxro;t4tpe  i3ildlm ranmo;u)aeermf3ia1fp e neo;s0s2xrxm3oy4ame  nvsltfa2uru p;u1aee ii3iadlm2ulnvsn(0aetoifciatom rluvo;( truo(o3ou1apenlfcs t srur(rp;t0tpx  oeiltfm2ea(mp () rxrio todfa  aiei s  euo(o3no1lp e fcils a2urxroou0tlx  ieilsfaDea(vs t0texnir3oadlp e ueol( seumxr iodlmeelnviat aruaumpno0tpen ieiatfs eanmont0arxoif iydlm rauvs;s) exr(mpoydoltemfeta( a2tr( pnu0tet iicias mDuluvo () lxriociy1lmD  nvils)texrir ou4optnlneia(fa2rrurono4openmi3tld mDeluvs;t) leoif3tatfaD lnes;( tetm(r nodlm nlicsatf rtr(rooo1tleomoeilsfsDean o;() renxo3oatoaDrlivs t tetr(rpno1optn nctat) rur( poo1alxnmoetysfaDra(vp;t4artnxfciadfa elu ils)sruoxr3iydol nlnei tf Dta(m ou1tleoiieiytfmDraums;u4arxomoctydlmtranei;() rto(opiudopeemfviatfsDtrumoot0tpeomo3tls sDrl(mp;u4trtrxo3iodoa rauvo;s trur(r oy1omeemivtat a2rax  ot4aptoioctysfm2rau p t) rxnxr3tydfp rlivs;( s2tmxr3ny4op e ncslt)aDrmxm ;t1tpxomi3tadlm2raump;u4 lermr oatlp elivol()sruoxm3iu1apt mfci (f 2umuront0oeenif3ias mDua(mon() rtomf3oydlptrlivs;s0 eumir3iu4apeemietasf Dtaxr ot0oeeomocilsls2emu p ()teermf3iadfpt aneslt t2xmiopiodlleelict ( sDua(  nu4apeomi3tyt a emn pn(4tlxoircoo1la e ues;t)sruo(o io4olenmfcil(fa2rrxro;o0aee  o3iad mDea(vo u0aetrio3iy1fp e uvo;t)t2uoim3nudom  micil( sDtr(r ot1texn ieild mDul( pnu4tlxrmo3totoatrln ol()t2tmirpoy4omenmncslt sDraumont1openii3iyd mDrmnmpnt)tltrirciatlptr ieolt)truoir3oy4lpe mnct tfaDur(m ;t0aexoioeiatlmDrl(vs;t4tlermfctodom eaueo s0 2xoio3ou4lmtnmnesa()a2tmum oo1alxn oeiadlsDul(mp (4treomrctadfm raneil() exrio3nu4ol nmiesls) 2ua(m no1olto iciltfm rmnmo (0alermr3oydfmDrlivi;t texriopnu4lltnlivia( artmxr no4tpenmietysfs2umuvs t0 etoxf3io1laD anvs;t)trtr(m nu4optemicsl( sDururo;u0aex  f3tad a umnms u)areoxr3iadopDeau o ( seumxr3ny1olt mfvslt)aDururpno0olx mi3iaslmDuaumpnu4 rxnmo ta1faDeauvs s)teuriopoodomenlnesas sDtaxm no4tet mf3ilt sDraums t4 rtoxf3iy1fmDr u o;()srum(r oo4opt  nvt t a2uax ono0ape io3iydla2emn on(0 renmrciytoa e nvo;s0 eur(m3io4lltn ncslt)srrruronu4olenmietadfm2uaumpn() etoxo tatlptelnei;( s2urirpiu4ol n fvta(f 2ra( pot1aeeoio3tysfsDulnmpnu4texomf3oo1lm r ivs t)srto(o nudlp nmfcs s sDumx p;u1alx ifeiadfa elu o;()tlxoif iydopDr ieilt)srtrxrpoy1optnmfvsls arumx pnu0optn octadfs2ran pn(4arerxf3io1lm  lueilt  eurxr iu4omee nes (  rrruro;u0oee ifeiad s2emu p t) eeoif iadfm rlnvo (0truoiopny4ol  lfvt (fa2tax ono1olt  oeild s uanvon(0aetnmfcoatop  an o t)teto(o3iu1ap emnvilt a2rm(m nt0opx mociytlm2rm(ms (4aexnmr3oydoaD au o (0setrio3ny4am n ictltfartm(  ot0tltomfciyt m rlnvo;t4texnxf oydla  auei;( trtoxr oudamenmivia(fsDurxro;t1opxnmi3iyd a ra(mp;(0altnmr3iadfpte ivi;s  2xr(o oo1lltnmiet sfsrtru  ;t1tpxomfctltlaDulu o;t) lxnio iatfpDrln o;(0s2xoiopnudap n neslt)srtrxrp;t0ale mo3ild sDulnmo t0altoxr iydomDe ivsls  2tm(m iudameelneta( sDtrumono0olto fciadfaDemuvs u0 lermr iydoate u i;(  rxmxm3io4op e nvil()arrmu p;u1apxn oeils m2rmnmsn(0aeeoxr3tydfp eaivo;t)seumxmpnu4lpt  icilsfsrtmxroot0apxnmietltla2uauvsn(0teermr tytfaDeluvs;t0 etmiopoo1apenmnvtas  rur(ro;o4olxnmictytfs rlump t0 eenxf3oadfateluvs;(  rur(mpio1altnmiesa(  rtrxmo;u0tlxn octadls eaumo;(0 lxnxrcoo1fpte i o t0teumiopnu4lmeelieias  2ua( pnt4alenioetltls uanms u) lxoiocty1omDe ivi;t t2xrxm3ny4alenmfesa( sDuru ont1aexnii3tadlmDrl(mp;u) ltoirciy1omD ln i ()seurxmpnu4olee ieiat a2tmumpot0alxn o3iys a ul(mp;u0tlxnmrciodomt  i s () 2toxm3iy1ll n ivtasfs2raumpnt0tpx ifctydfsDrmnms;(0trtoxf oodomtrln olt0trtrxmpio4lp e fvilsfa2umxr nu1oeen o3iat m2emnms (0 etoircto1oate uvo;t)trum(r3nudll nlnciat a2rm(rpoo0aee  fetlt s ean o;t) eenif todfpDrlivo s)t2xrio nu4ame  ivt ()sDrrx o;o0tlt mieilsfm2ea(vs;(4tetrmfctytfatr n i;t0srtoimpiu4lm  liviat) Drmu  ;u1optoiieiad sDrln o;()trxrmocta1opDe ueo (0s2umxm iy4om n fesa( a2rrump;t1tpt ioctldfs2ulump;t) ltnxrcty1fatraues t)texo(mpoy4lltn feslt sDtmurpnu1aexo ieiytfaDea(vo;t)alxnmo ty1la elneo;t)s2umxm3nu1lm emics tf 2ta(m ;t4oexniociatfa2rm(ms;u) rtoir todfp elivi ()s2urxr3ny1ap elfvil(  2um(m ;o0aleo f3tldlm2um( pn() etoio3totfmDraivi s)seuoir nodopenlncs s  2rmu pnt4olx  iciatls2ea(vp;t) eermociydopD ai slt) 2tm(mpiodalt  fetls) rurxro;o0oex  fctlslsDrauvo ()trxrifcoytlpt lu i s0 2urxm3ny1om e fvt t)a2rrum nt4tpe mf3ildls uanvonu0 renmo oadlm   n s;t0trtoim iudlmt  netat sDrmumoot0texnifetytfa2ua( s u0aexnircoadlmD auesl() rtmxo no4lp   ivs t) rtm( p;o0alxo ociltfmDel( ont4texrxr tydoa rliesls0setmiopio1op emicias)aruaxr oo0tltn oeildlm el( s;u0aexoxo tadlp elnvs t)tetmiopnodamtemfcilt  rrrxm oo4tpxniieildlm2emu pnu4teerxrctatfaDelues s0t2urim3ou4olee nctls  2tmxr ;u0openiieiytfs emnmon(0aeeoxr3oytlm eaieil(  exmxo io4op nmfvi ( s2rr(m ot1alxoii3iltlm ra(mon(0 lermr tydoa   i s t0s2uoim oudll  mfvi sf rumxm ou4olt  i3iytfs2elnms;u)aeeoxrctydfp r ieil(  rumxm io1ap  livilt s2rmu  nu1olto o3iyt s uluvsnu4treriocoydomDraneo;(0s2xoir oo4ol  miesat a2ta(r ;u4tptnmo3iltfmDrmn s u0tetrxf3iadfmD  ueo;s)t2um(rpoodole lfci () rtm( pnt0alxn ietadfa2uanmpnt)arxoxoctytopteai ilt0srtr(m3oo4oltelncs (fs2um(moot1aeeomfetys sDuau o t0 lenxo3oatlp elu s s0t2tmiopiy1amt  ics s) 2ua( oot1oltomfcildlm2eau onu0 lxrir oatfmteai sl( sexrxo3oy1lm emfcilt) 2rmu  ou4tlxnmoctlt a ua( s u)alxrifciotlmD li sl( trxoir3iudlme  fvi tfarra( pot1optn i3ildfs ulnmo;t4tetnmrctytfpD ai o t0s2xmirpou4omee ncilt s2tmumpno0tlenii3tatlmDul( snt0areoifctydlpDeanvs;s0tetm(opio4amenlnvsa(farta(r nt0apxomociysfaDrau o u4aetoxfciytoatelneil()trumimpoy1lm elictlsf Dua(moot1tlt ioetlsfaDumu s t0 lxrio3iy1oa   ieo;(  eurxm3oodll nmnetl(f rumx onu1texn i3iytlm em( o u) leoio3to1fm r n ilt t2to(r3iy4alenlivi (f Dtr(  ;u4apeomi3tys m rmnmp;u0texoxr iy1lmDeanvo;t) eto(opiu4amtelnei tfaDtrum no4tlenmfeias m rlu o t)trtomocoy1oaD  ivslt tetmio io4olen ici t sDtmx  no0apx moeilsfmDrau p (0teenxo oydlmD liei;()s2umxopny4ol nmncs t arrmxroot4apx mfetlsfmDuaumsnu)tlxomr3tytlpD  iei;t trxr(o oudome livta(f 2tr(mpou0opx  ictls m ra( o (4 rerif oydlm r n o;t)s2toirpnydlpen fvta()arurx poo1optnmfeiltlm rmums;(0 exoiociydop rlu i;s0s2uoxm no1lp elnetltf Dtmu ont4tptomf3tytfa uauvs t0aetnifciatfpDrauvols)t2urxrpio4lltemnet ( arurxmo;o0aeto fctys sDrmnvsn()tetnmr3tytfpD ai olt0 2toir iu1apenmfeiat  rtmxr nt0olxo o3iytfsDuln p;u4aetnir iytomDean i;(0t2uoxm3no1al  lfvsa(fartmxmp;t1alxoif3tydfs2rm(mp;(0 rxnircoydom  anvo;(  exo(r3oo4olte nctl()sruru ont0tlxoifctat aDranmo;(0tlxomo3ty1laD lneilt  etrir io1lmt  fet ()s2tmxrono0olto oeiyt mDuluvp;t0aetrir iydlmtrluvi;t)srur(o iu4llen ivs ()sDtmxrono0oet miciaslm2umn p;u0trtnxocty1op eli s;s)s2umim3oydapenmfeia()s2rmxm ;o0olxoifeiyd mDraums (4 etrxf3oodfpDelu o;(0 2xrxr3nodal  mfvta( s2rax p;u0ape mocildlmDeln on()aeenmr3iodfmD aieo;s)srtoxm3iu4ll  mivs s  rurur nu4tpeoii3tatfs2ulnvonu0 rxnmo io1om e u o t0t2xm(o3oodapee nvtlsf rtm(  ;t1ole io3iadfm emn p u0aleomfcoa1laD  ieo s) ruo(o3ny4ol emivs t arrm(rp;o4aleoiictltfm emumpnt0trtrxrcootfmDe iesl()srurxmpny1ape micsls  rra(r nu0tpen feiyt m em(vo u0 rtoif io1lp rlu i () rur(mpoydaleelivt t)aDtaum nt1alxniiciys s ua(vs u0tlxnxf tydopD lneol() 2toxrpoo1ape lfvtl( sDum(  ot4apeoii3tadfm2ua(vo (4teenif tadoaDe u o s) 2uoio iu4apenlicta()sDtmuronu0opt iieias a umnmsnu)tetoxocto1fpDr neo s0s2tmimpnu4alee nctasfsDrax  nt4tpx moeilsfsDea( o t0areoxr3to1fp rlnvi;t0teumxo ou1llte ncils) 2um(monu0oexoii3iytfm2el(mo;()trxrxo io1omteau sl()t2xoim iydoltnmicsa(fsrtr( ont0tpeomo3tls mDumuvo (0aetomr3tatfmDran ol(  2trxo3nu1apee iviat  rum(r ;o4tetnifciyd m2ea(mont)tlxnio3iatlm e uvi ()tetrxo iydal elncsat)a2raurooo0olx mietasla umu sn(0artnxo iy1fat luvo t t2xoxm nu4op elictlsfsrrmx poo4aetomo3ias sDel(vpn(0aetoxo3iydfat li o;t sexr(m nu4optelicilsf 2rmxr no1oltomo3tysfm2eaumont) lxoircty1laD lneo t srxoio oudol  lici s) Dumx pno4texomfeils sDel(vp;u4tlxrir to1fp eluvs (0s2umirpiy1ap  mfes tf Durxmont4oex  o3tld s2elnmo t0trtomf3oatlpDelu s ( srtrxo3oo1ol   iet ( srtmu pot1aetn f3iltls uluvp;()texrxr3todlm e uei s seumxr iu4lptemfvt tf Dtr(m ;t4alx  feias aDrlu p;u0aexoir3ty1faDelu s t)sruriopiudomee ivsl(f Durx  oo0tee  f3tatfaDuanmo;u0 rtrio3ty1omDe uvs t0tetoio3io4om nmfet tf rrrxr ;u1tltoiietas a umu o t)trtrmocoa1laDeln i;s)trtoio io1ope mfvil( a2tmu poo0aexoif3iatfaDrmnmo u4aeeoxfctotlmDrli s;t0t2umxr3iudllte ieils)arrau ono1apt mieiltls2em(ms (4aleomfcio1lptrai ilt) euoxm ny4ome mnvt sfarrrurpnt4apt mo3ildfm2eau s;u)tlxrmf3iodfmt aieols0 2xmio3nudop elnvtls)srurumpnu4tex mieiat aDrlumpnt4tetrxo oadlmtraues t0 euoxm3ou1apeemnci tfa2uaumonu0teenifctad a uluvs u)trenmf3oytopD aies;t0s2xm(r3iy1ope lfetasfsDum(ro;u0ape ifctatlm2ulnvs t)alxnifcia1fptelues s0sruoxr oudop   nesl(faDtru o;t1optomociytfa2rlnmo;t4tlxnmocoadomDrlneolt0seur(m iy1lp elnvsl()artaumoou0aetnii3iyt a2uau pnu)tlxrmr oo1latrau ilt)trxoxopny1ameemnct s sDrmumpnt4aexnioctatla el(mp () eenxf3ia1fp r ieo;(0 eurxm nu4op elfviat)sDtrx  ;o4olt mfetltla2um( s (4artnmr3oodfm  aiei s0t2tr(r3oy4lpe mncilsfs2tmur ;o4aleo octadla2uluvonu4tlxrmf3oa1fp rau i (0trxrxo3oydap eliet ()s2rmxmo;u0oexnmo3tat m2rl(vsnu0trtnxr3todlptelieilt)srxr(r3oy1lmee ict ()arrruro;u0olxnmo3tytfm2ua(vp (4teeniocoa1lp rlieols)s2urio3nydomt  ict t)srum(rp;t0tltnmociasls2eanmo;u)teerxo tatoa eanes s)trurxo3io4openmnvt t sDrm( ont4alxniociltfm em(msn(4tetrmf ty1omt aneo (0trurxrpoy1llte ict () 2urumpou1oee ifctyt s ra( p t4texrmr3tytfm r nvo t texoio oo4aptn fvsl(f 2trump;u0apeo fciyslm2umnvsnu0trenxr oo1faDraues s) 2uoxo iu1llee fcsasf 2rmumpot1tptnio3ils a eln p;u0artrxf3iotfa   n s t  rtoxm nu4aptnlfetl( arraurp;o1tleoiicilsfa2uaumo;u4trtnmr3iy1oaDr ues;t0trtrim3nu4ame mneils)sDraum nu0oleoiictldfaDrmnvo (4tlxnio tatfp rau o s)srxoxr3oy1am   fvt s)aDum( pou1tpenmf3tadls2eau s u0tleomr3tadfa raies s) euoxr iy4omenlivta(fs2rrx o;u0olt  oeiydls ua(von()tltrmr3oa1omtrliesl()teurxr oodap nmivtls)arumxr ot1oleomoctlslmDumums;t0aeenircoatfp rauesl()trtmxm iy4optnmnci ( arrru  ou0oee  ocias aDeanms u4 rerxo ta1fmDrlueslt0teto(mpou4am nmneiatfsrrm(ro;u0tleomoeildlaDemnmsnu) lxnmo3totoptr ies s)texmir3iy4am  lfetatfa2rmum ;o1optnmfetlsfa elnvp;(4aexnircio1laD li s ( t2uo(m ny4aptemict tfa2raumpot1alxnii3iltfs rluvpnt4trxoirciotlatraues t s2ur(mpiydomee nctasf Dumuro;u0aexoif3iad m rlnvsnt0aeerir io1lmDe nvi;s)trurio3oo4am emnet s srraumpoo0oee  icilslm2rm(ms;t0arerxf todfm  ai s s) rtrirpou4am emfctas srrax  ;t0ope if3iatfmDeauvs;t0aexnmr3oy1lmteaivols0trxm(r ou4op e fvsl()srra(mpou4aetn ieiasfsDeluvp;u)trxnirciydfmDr ivsl()srxmiopoudopee fcta(fs2rrxmp;u4tptnmi3iaslm um(vo;t)tleoir3tatoatr u ilt0s2um(mpoudlltnlnvta( arur(mpoo4tptniicildls2em( p (4 exoxf3oytlaDrlnesl( srurxo3iydomtemicslt  rrrurpnt4optoiiciatlmDeluvo;t0aeenmf3iytoaD  i s t0 exmxo3ou1apeelfet s aDrmxrpnu4olxomi3iysls ean s;t4teenxo oydfm  aivi t)sexr(m3nudop e fvt s)arraxm nt0aetnmo3tatla elu o;(0 lxnio to1lpteliesl( sexr(rpnu4om n ivs sfarrm( onu1ale iociydlaDran p t0trtnirctadlmteai sls)texmxo iudlm n ics t)aDtm(ro;t0olen fetat m2uln o (4arerif3oo1oaDran ilt0trxo(opiodlltn fvtlt)a2um(rp;o4tptoif3tydfa2em(mo u4alxnxf3tadomDeanesls0s2tm(o oo1am  mfvt t)a2tm( poo4aetomfeilt a umn snt0arenxo3iotfaDr uei;()t2urxm oudamtemfvtl()s2rr(mono0ope mf3tldlaDeanms;u4 exoir iy1fmteaieol()seumim3iy1lp e ictl( sDumumoot4oex moetad s2rmn snu4trtoiociotfpD  n s;s)t2umir oo4lp nlfct (f Drmumooo4openifctasfm2ra(ms;u4aetoxf oadla rli i t  rxrxr oydapt lictl( s2tmx onu0teenmietls mDua(vo u)tltnxo tydlpDeaneo;( s2xrimpoydalt mfciasfarraum ou1oee  ieiasfs rmuvo u)arxnir3iodfmtr u s t)srumxo iu4oltemici t artr(ro;u4aexomietyslm2uln on()aeenir3oadfmDeli ols) etoim3nu4altemnetatf rur(  ou0opxo fctysla raumpn(4arenxf oo1omDrau s;t  2trxo no4amtnmivtatfa2rmu ooo1tpeoifeiyt m2ra( pnu4 leoxo3to1oaDrli s (  rxmirpny1amt licia(  rur(rpnt0tee mfetatlmDrmn s t0aetnxr oytfaDrliei;t)srtrimpno1ameelfci t)srurxrp;u4texnifcilslsDrmumo () exrxfcta1lp   uesl()s2ur(rpoodoltemnesas)s2rau o;o1opxoifcils m rmuvs;(4 ltnifctadoa r u i;(0tetoio oy1op  lict s  rrrxmpot1ape  icilslaDuauvsnu0artomf ty1lptrauvs (0 2tmxr3oy1altnlnct ()s2uaxm nu0aeeo o3tyd s um(ms t0artrif3ia1faD  nvi ()sexoimpou4apt lnvtat a2raum ;u1tptoioeiyslaDeau pnt0aeeomo iodfpt livols0 2umirpiy1ole  fesls sDum(rpoo4olxn f3tlsfa2el(vpnt0aetoxr oatop ranvi (  etm(r3iodam elnvt ( sDumxr nu1tle  fctlt m2rmu pn()artoxr iytomte ivo s srxoiopou4om emicsas)aDrm(rp;t4oeenii3iltfmDemnmo t4 exnxo3iatomD aueols0s2xoxm io1op e ivtls)aDta( poo0olx iietltfa2ul( o t) rxomo tydla r ueo ( trumxmpnudoptnmnes tf 2rr(  no0alto oetlsfa ranmp ()aeenio3iydfpt au sl()srtoxo3oo4apte ici ( artaxm ;o4tpenioetasfs2ra(mpn(4trxnxf3io1fpDrau o ()setmxo ny4ol n iviat)a2umumo;t1optnmietlsfa eanvs u0trtrxfcoa1fpD livo s)sexoim iu1ll elfet (fsDrru  ;u0oleoioetasla2ua( pnt) lxnxo ia1faD anei;s  eumxmpno4ole  nvsltf Dumum ;u0tlen icildlm elu p;(0 exrmo totlaDe neils seuoxo3ou1lp   ies sf rra( pno4tpxomfeiysls rmnvsn(0trtomo to1oa eluvs s  rurxr3oy1alenlfeslsf rtrx o;o1ope  i3iat sDuluvon(0 etrif3iadfmDe ieilt0setrim no1ameemfvs tf 2taxmo;o4oetnmietatfs2umumonu4 exrmo3tadfateau o;() 2ur(mpiu1ameelfvsl( s2uauronu1tltomieiatls elnms;t4trerir3io1faD  n ils)trxr(r iu4lptnlfet () rumxrpno0aexnmfcildla2rm(mo (4aexomfciadfat li sls0 rxm(opoo4ole  iei t  Dtmu  nt1tlto ociadfaDrl(vo (4 rerif3totla r u ols0 rum(opoy1alenmfet tfartrurpno0oexn ociys aDuanmsn()arenir3tatoatr neo t  euo(o3ny4omenmnvslt arua(  ;o0opxn f3tatla ra(vp;t)tetniociytomDelivo;() rtrio ou1lmt mnvtlsfsrtmx o;t4ale micildfa2uan s;t)trxrmo to1fp eai o s) 2urxr3ny1am   ncsas a2ra(ro;o4optomiciasla ra(msnt4aexnxf3oo1fpD  ieo (  exm(m3iodoptelnei sf 2um(ro;o4openmfeiasfs rm(von()alxoxocoo1lpD auvsls tetmirpiudamt lfci tfaDurxr oo0aeenmo3tys m rmuvs t)arxomocto1oa eluvi s0srtrxm3iu1lmeemncilsfsrra(m ot1teeniictytfa2ranvp;(0 exoxrctatopDraueslt) rto(o no4lmenmictl() 2umxr nu0oetnio3iatla2uauvp u0 etnir iatfp  aivils t2urxr oy1amtnlfetls)sDtm(m nu4tpxnio3tld s2el(ms u0 ltrmrciadfaDrlnvslt0setrirpoodlleelneta(farrr(ront0optnmfciadfsDrl(monu4 rerir io1lm e u s s)t2ur(m nu1lptn nci s)aDtmxmp;o4apenifeiad aDelums () lxnxfcto1fmt an sls)tetoim3oo4omt miviat)a2ua(rpnt4tpxnifetltfa2um( o u0arerxr3oytoa r ivo;(0setoir nu4am emfvta() 2tmump;t1optoioetydlm2ea(mpnu0tlxniociy1fa eaneo t  2xm(rpno4optemnviatf rumxm no4texomoctadls2ulnvp u4 etnxoctotlpDe i i;s  exmir oo1optnmfcs ( a2rmur ;t4aex  fciyt a2ean p u)tetnmrcto1lm e i sl( truoxr3io1apenlfetas)arta(ro;o0ope io3iyslm2emnms;(4aetoxfciydlatrluei s) rtm(rpiy1am  mieils s2tru  ;t1tetn ocils s ra(vp u4artriocia1lm rauei;t)s2trxm ny1ol  micsltfaDuaur ;t4apxnmfctydlmDrmnvont4aexrxr tadop   ivolt0tetmirpou1alte neiasfsrrax ont0oexomieiltlm emn o;u)tleoxr oy1late u o;t seumxopny1lme liet sfa2urxmo;o4aetn iciad a eanvs t0 lxnmo3iadopDe ivilt)s2xoio3iu4omenlfcs s) 2rm(roou0oeenmi3tat m uanvs;u) rtoxo tadop elu sls) 2xmxopoo4ll  liciatfa2ua(mp;t1tpen oeiatls ua(vs;(0aexrmr3tatoat  n olt) 2ur(rpny1opee nvsl( sruaurp;u1apeomiciatfmDranmsnu4 lermfctotfa   ueo;t  etoxr3oy4op eliei (fsDrm(  nu1apto fetys a2rlumo u0trxnifciydop eanvol(0seum(opiu1amen ietls  2umumpno4opeo f3iadlmDuan s u0 rxnirctodfmDran s;t  etr(m oydopenlnciatfsDur(  oo1tpenmo3tas s rln p u0 etrir3io1fpt lneslt0s2xoir oo4lmtnmfesatfs2um(moot1oetn fciltfaDuauvo;(0aetrio3oatoaDr uesls) rxmio3iudaptelfes s)artmumooo4oeenmieiys m raumo t4tlxrmr3oy1oa e ivilt)t2tm(o3io1oltemfeilt) Dtr( pnt0oee ifetadls rlnvo t4teeomf ootop rluvil()srurir oo1apt  icias) 2ur(root4apenmiciadlaDel( p;u4texoxo ootoate ivi t  etrxr no4optemnvslsfa2rmx ont0alenmfctytlaDuau pnu4 exnmfciy1fat  nvo ()t2um(opiudoptnlfvi t  rurxrp;o0opt  oetytlmDuau s;u0 ltnmocty1lm  auvslt  rxoio ny4omtn nvtasf rur(  nu4aet mietyt m2eanvsn() lxomo oy1lmte n s (0 rxr(o iy1lltelncilsf Dur( oou4aleo oetyt aDulnms u4alxoxf3oodlm r ivols teurim nydlm nlfeil( srrmu  ou4tltn o3iyt s elnvo;u)trxrir3oy1lmD ln i;( trxrxopoy1oleeliesa(f 2urx  no4aetnmoetls mDemnms t)alerir3oytfmDrln s;s trxmxo io1omt mici t arrr(r oo4olx ifctadla2um(ms;u4trerircty1fp  lnes s0seumim nydamtnlfvi ( arrm( o;o4aptn o3tysfs rmnmsnt)arxnxo3oydlmte nesl(0trumim3io4ome lies ()sDtr( o;u1texn f3iadfm em(msnt4trtrmrciy1fmD auvs t0 rumim3oudolee neilsfsrrau oot1tetnioetys s2rl(vont) ltnxfciadlmt luvil(0 exo(r iu4ole licia(faDumx  ou1altnio3iydlm2rm( p (0 lxrio3ty1lp  anvs (0 etmim nu4op elnvs sfaDumx pno1tee ii3iad sDumuvon(4trxoio3tydlp  liesl() rtoio oudalt lici t aDra(root4alx  i3iadfmDrl(mo;t4tleoif3todopD  ieslt)srumxrpoo4alte nct sfs2trx pno1tpen f3tytfa2ua( o;u)tlermf tatoate uvi t)texoxo nu1olt  fci s sruauro;o4olt mo3iydla rau s;t4 etrmo totlpDe nes;( trtoir oydlmenmncsl() rrmu ono4olto icias sDrmump;u)tlxnio3oy1lmte i i;s sexmir3oy1al emies ( a2rr( onu0oex  f3ils a raumo;t4 reoifcoo1oateliei;t0 rxoxm iy1lm   fetl(f Dtr( oou0apt mieildlsDuln o;u)tltrxf todlmt lueil(0 2uoxo oo4ap  lieta( arrmxronu1tleniociyd s elumo;t4tlxoir3tydoa r i ils tetm(o3oy4ll n ivslt aDurumo;u4alxomieiydlm2rmuvp t)trxnxfcoadoaDean i (0s2uoxr3oudlm elfesas s2umxmont0tlxniieilsfa ulnmsnu) lt
\ No newline at end of file
@@ -0,0 +1 @@
+u ol()srxrxopiu1lltemnciat)s2umum ou1texoiicildfm2rl(mpnu) etomf3tatoateaies;s0t2to(o3ny4om   fvs t) rurx p;u4oltnmi3tysfs2em( on(4 rxrio iytlmteau o t  2trimpiudlleelneias)sDumxrono4tet mfciys mDuln p u0tltomociydfp r neo ()sexoxrpou4op n fvia(  Dtmxrpno1texn iciat m ea(mp (0 ltomf tatopD  n o;t s2xr(m oodoltelnvtl()arur(rp;t0opx mf3iatla uan o;(0 leomocto1faDrluvi;(  rum(o iy1lpte nvsls) Drr(  oo0tet mo3tyd m2eanmpnt)aleoxf3iy1op ean ol(0 2xrim3iudam nmnesas) Drrxr ;t0aexniicils mDemump t0 lxrmf3oo1fm eau o;t0 2xoxr iodaltelfvta(fsrrrxmpno0aeeo iciasla um( s;(0 lxrif3ta1faDe neol( tetoxo iy4al  mnvtatfsrur(r nu0apen ieiyd aDrmump;(4artrmr iadlmtelnvsl(0t2xrxrpoo4openlfcs () Dra(r nu0opt ifeiydla uaump;u)arxrif oa1oaD anvs () exrxr io1apeelictls  2ta( p;o4teenifeiydfaDemn s t0alxnio3iy1fatrai slt) rxoxo iodomtemiesl(f Dtrxr ;o1oetn oeiydfs umu p;(4aeerxrcto1lp elnvi;s0 euo(r3iu1lptemfeias)sDtmxrp;u4tee miciyd aDel( s t)aeerif3oatfpt ai s () rxm(m3oy1ap n fvta() Duaurpnu4texn ictltlmDum( o;u4 ltrmr3ta1opD  nvols)t2xmim iu4opt lncsatfartrx o;t1tetnmictadla emu snu4 rermf3totfmD luvils)tetm(o ny4olt mivtlt sDur(m ;t0tpt  oeiydlmDuaumpn(4 exoir iotoaDrlu i s t2tmio3iu4lp  lnvt ()a2umumpnu0tle ii3tydfsDrlums u0 lxrio3ty1fpDeln olt0 rumxr3oydll emicsas)aDurxr ;o4texoiieiys s2elnvo (0aetoio3tadfmDran i;t srto(r3oodllenmiesat) 2um(r no0tlx io3tytfs rmuvs t4 eerio3iatomteai o;(0srxr(opiodol elfvslt  rtruro;o1olenifeiasfa uluvs;t0alxrxf3iy1oate i slt0 rum(mpny4ope lietat aDrr(mp;t0aet  f3iys aDua(mo t4 eerxf3iotlpteauvs (0trtrimpnudole mnvta( aDua(ront0aet  f3tlslaDuaump ()artrxf3tatfp elu o;(0 2uoxopiudlp elfetatfaDrmx ont4tptnmo3iydlm ul( s u0alxomo oydfaD li s s0 rxo(m ou1am e nvsl()s2tmumpnt0ope ifciaslsDra(msn(4trtrifctatlat ai i s)trto(r3nydap  mietls)s2rru o;u1opx mieild s umu p;(4aeenmo totoat  u il( setr(opiydlmenlicsat)srrr(mpnt1tpxo i3ils a ul(ms u) rxnif iy1lm rlu il() rxmxr3iu4ol nlnci t aDumx o;o0aexomociysfmDul( s t) rtnmoctytfpte i i;( s2to(rpoodomtelfeil(f rtmuronu4aptnmfetyt m eanvpnu0arenio3iy1lmD aivi t0teuoxmpnu4ll  liei s srraxroou0oetn feiyd s2eauvonu0aeermo3oytfmt  ivo s0trurxo3oo4ll  miesa()srurxmp;u0oleomfetatlm2uanms (4tetomr ootom  luesls) 2urxm3oydal nlicil()s2ra( poo0apx mf3iysfaDumuvo;() exrio iotlaDraies s texrxm3no4om emfesltfaDumxm ;u0texoiictls s2ul(vo;t)teenifcio1oa r u sls  2xo(o iu1ole  fct sfarur(rooo0olx iieiydfm2ranvp t)alxnmo io1latranvol( texrxrpnydalen fvtat  Drrumpnu4alt ioeiytlmDrl(vonu4tlxrir3tydlm e nvs t) exmxopiy1om elnvta() Dtmxmp;u1tleomf3iytls em(vs;(0 lerxoctydfaD livil(  exm(rpnu1lme  neiatfaDtau ooo1alen ieiadlsDea(mont4tetnircto1lptr n o;( t2trir iodll   iet s)arrr(m nu4tetomo3tls aDumnms;t)artnxr3oy1lpt li il(0 2trxo iu1al nlictl(farrmur oo4tpxnmfctas a emuvo;t0altrxf3oo1fmDe n i ( s2toxr oy4ale lncslt  rtrum oo0aleomoeiydlsDrmnms;(0 lerxocoy1faD aivs;()s2xr(opoodlm e ictls)arua(  ;u1apenioctadfs2rl( p t0texrmr iatfp r ieolt  eurxrpiu1alt lnct tfaDraxmp;u0optnif3iytfsDraums u4tetomr iytoa   neils0s2uoxm oy4lm emfesltf Dtru ont4apeoiociat m eluvont4texnmf tydopDr n o;(  rtr(m iy1amtelfciltf 2tm(mpnu4open i3iyt s ulnvo u) etnxrciytfa  liesls) exr(o iodop nlici t  rrrx  nt1alenmo3iadfsDranvont)alxnir3oa1lat  nvs;( t2urxopny1op  lfeiltf Duaum no0olen oeilsfm rau p (4 exoxf3oa1lpD aueolt) eurim3iydaptn icsasf rur( pou1texnmi3ils sDum( o u) lenirciydomD aies s) ruo(m3oudamtemfvil()sDtmu ont0apenmf3iyd m uanvs;u0tlermf3iotoat aueil() rxmim3no1ap nlncs t srtr( ooo1apx ifciadfa ulnmo (0areoircty1fa eau s;t)s2urir nu1llte ivia()srtmxrpnt1apxoiietysfaDem(mp;u0tleoiocta1oaDeli o;t0s2xm(mpoodamenlncsa(fsDta(m ot1oee iocild s2uanmsnu) eeriocoo1omt aivo;s)trum(r ou4lpt mfciat)a2ua( oot4apx  f3iydfmDrmn o;u0 renxfcoo1omtrlnvo;t0t2trxrpiudalt lnvi s)a2taumo;t4apxoiietyt s2umump;u0arerxfctatlmtraivs t)tetmim3no4al nlnvtasfarumxm ot1oex  o3tyt m2ua( o;u4arxoio3iatlptean s t0 euoir oo4lp e netlt sDrrurpot1tlx iietas m2emn s u0 exomfcta1omtr i slt  rur(r3nydomte feil()aDua(m ;o4aptn i3iadfmDrm(von(0 rxnxf3oa1lp elivilt)s2umiopio1lp  mivtat) rrrxr oo4opxnii3tyt a ra(vo (0trtnif iy1op e nes;s0s2xm(o no4am elieias  2taump;t4ole io3iyslm eanvs u)aeerxrcta1oate u o ( sexoirpoo4lm emietasfsDrrxr ;u4aexo i3tasfa rlu p;()trxrxr tadoptr ies;t)trumimpou4ameemfvt s)a2uau  ;o0tlxo ocilt m ra(monu0aetnif3oydlm rlieslt  euo(rpiu1om nlivsatfs2ua(mono1opxo fctydla rm(vo u0tetrxf3oodfp e nvs t0 exoio3oudap   nvtls)aDrru onu1olt mfctldfa2rmnvs t)alxoxfcoatopt  iei;s srtmxopny1ale  fvs t)sDrru ono1altnmi3tysfa eluvs;(0 exrmr3totfpt aivsls)srtrxm ou4apt lnctlt artrxrpoo0tlt  o3iydlsDemnvo;t)tlenircta1fpDeluvs;s  rxoxr3oodal   ivta(  Drrxmp;t4oee  feiasls el(vsn()teerirciatfmtranes;s)t2trim3oy4ame mnctl( arurxroot1oeenmfctyt aDra(mp t)tetomr oy1laD lnvs;s teumir3oudlm  mics t)s2uau  ;u4alxnmieiad s2eanmo;u0 rtoxf3oytfptean i;s0texm(r iu4amee fcs ()a2um(ro;u0ope  i3ilt mDemnmp t4trerxfctatlmDrlies;()t2tr(r3iu4lp  lnciatfsrtmx pnu4aexoiiciysls2rmums (0aetoifcoa1fa  lieo;s0srtr(r oudopee fetls)sDrrxrpot4aetoifeiadfaDrmuvp;t4altnio3oodlmtr nes t0 exr(r3no1oltemfvsas a2rm(rp;u1tlxnif3iydfa2rlump (0tetrmf3iatomteaieil(0teuoirpny4ll nmfvsatf Drrx pou0oex ioetyslm um(mp;(4 eeomrctadopD  ies;()srxoxrpiu1olt  ieiat)a2rr(r oo0tle  o3iadfm rm(ms u4 renir3oo1oaDrlnvs;t)t2to(r3nudol e nvsa(fartru  ;o1olxnmociadla umn o t)alxnir3tydfaDelieols)s2uoir iy1op elneils) rrrxrpot0apto f3iytlm2rlnvo t)trenmo3to1fptelueol( t2toxm ou1lm  mivt s) Drm(r ;t1tlt  ieiad sDean s;(4texrxf3iadfp  lnes (0t2uoxrpio4lmenmfci s artmx onu4aeenifeias a uln s;t0altrxr3io1faD aivo;t) rurir3iy4olen iei tf 2uaxront4aet  feiad a2eluvonu0aleomf oy1oate u s () 2xm(opnudlle  ncilt) rrrxmonu1oleo octlslmDua(vo;u) etoxrcoodomDr u i;t)seurir iudlmeemiei ()sDuax  ot4tee mfctasfm2ulnmo t0 ltoxo totlp  lieo;s0 rxoxo3nydamt lnvta( s2tr( pnt1tetoifeiadlaDemn o t)aeenif tydlm rauvi t)t2umirpoydol elnvtls)s2rax ont4aet ifcild a2rm(mon()trxnmoctodlat  neo t) rtoxm3iodale  nctlt) 2rrxmo;t0aptoiociytlmDemnvp ()tlenio3ootopDr ueo s sexmxopiu4ll nmncil( sDur( p;o4aeeoifeiyd aDrmnmonu4arerif3oatoat lnvolt t2um(rpnu1llte nviasf rur(r oo0tlxo f3iadfs umnms;t0altnif iydop e ues t  rur(opiudlpen fcils a2rmxrp;u0tpe  ieiasfmDrl(vonu4tleniocoydlpDeanvil()trur(opiudopt mfvsas a2tax pno0tee  oeild a2umu pn()artoxfctytfaD livsls0setoim nudome mneilsfsrtmum no1apx iictltlsDeluvs;(0 etoxo oytoatr ivo;t)trumio oudlmeelieiat)s2uauro;u0tee mictydfsDeaumpnt0alxnir3oadom eaivol(0s2xoimpoydlmt  fcslt) Dur(mono1oltoiieiysfsDrau pnu) eeomrciotfp e i s;s0 etrxo ny4opee ivta(fartrumo;u0aeeomfciat s2emnmpnt4 rxnmocoo1omDeanes;t0 2tm(mpnudaptnlfeilt srrr( o;u1aeen feiysla2ra(
\ No newline at end of file
@@ -0,0 +1 @@
+u slt0setmirpny4apen ivi ( s2tax ooo0openmf3tadfmDean ont4tltrxfcoy1omteluvo s0 etrxopou1amee nei ( a2uaxmont0aeenifetat s eauvp t) exriocoy1la  lies s0t2xmiopny1lmee fcsl() 2umxmpou0apeomictld sDemn s;u)trtniocoy1op r uvo s)texmxmpoy4oleemfcil(  2tau  no0tleo oetadls rmnvp ()alxrircto1oa raieol() euoir3iy4alt lfci sfsrrrx pou4altn i3ilsfsDua( o;() ltomr3iotfptraues (0t2uo(o ou4opt mivtas s2rau oou4apxomo3tys a2rluvs u4 rxoif3iadop  li slt) rxm(r oudlp emiesas s2rm(mp;u1oeeomfetld mDelnvon(4 exoir ta1laD lueil(0 euo(o ou4omeelfesl()srrrxm nt1aleoioeilsla2ra(vs;u4 renif3iotfp elivi;s trxmxr oo4optnlfci (fa2trxr ;o4opt moetlsfs umnmo t0tltoif3tydla e u o;s)tetoio3iu1lmt lncta()s2raumpnt4opxn o3ils s ua(mpnu)tlxrmf ty1omD lieils0 euoxm3oy4lpt liesl(fartaur ot1texnifeiadfaDelumsn(0tlxoxo3oodopteln ils)sexmxmpoo4llt  icslt  Dta(mont0aetomfciasfa2ua(msn(4alxnmf3oadlp rlivs;s seuoir oy1llt mietat a2ta(rpou4opeoifciyt mDrm(vonu4trtnmf to1faDrai s;s)srtoiopou1omt lics tfaDrru ont1alenifeiltfaDra(mo (0 rxrirciodop   uvo;s  2uoio3iu4lpe lnvtls sDtaxront0altniocilsla elumpnu)aeermf iatfatr ieol(0trxoiopiu4olee fvsat)sDtrumoot4tpt  fctyslm2rmu s () etoxo3iy1faDe n i;t  exrxr3ou4ome mfcsls aDtaum oo4aex iocildlm2uaumsnu4 lxomfcoa1fm  ai o s s2urirpiy1al e iet t aDrm(rp;o4tpeniociydlaDum( s;() rerxf oodlmt au il() rtmxm ou1oltnmfeils  Dtrum oo1alenifciysfm ul(mp (0 eermr3oydfa  lieo;s sexoir io1am   nei tf rtrx pot4tex ifcildfs2eauvonu)alerir3iydoat lnvs s  eurimpoo4lm   ivs s)sDrrur ou1alx mf3iydlm2emn o;u0trxoif oadlp raivils trxmimpoo1lptnlivi s)arur(ro;u4tle moeiadlm2rm(msn(4 rermr iodlaDr ieolt) exmim3oo1omtn fvi s aDuaurp;t4texomf3iyd s2umn on(0alxoir iadla r n s s0 2trxo ou1lm nmnci t a2urx p;t4tetomf3tas m2em( p ()tlerxfcoatlm   u s;s srxoxm iu4llee ivs s arum( oou4oet mf3tlsfs emnvsnt0areomocio1lmt auvils) rtriopno4ole  fvtls srrr(mpno0oexnmfeiydfm2ua(vont)trerxfcia1fmt ai o t)trto(r3oo4omee ncils arrm(ro;o4teeo fetyt s2rauvsn(0tltrmf ootomDraieslt t2to(r3oy4lpen fetat)arrrxm ou4opeoiiciadla emu s;(0 ltrio tydopD aueol( teuo(m3ou1lp   ietl(fa2trxroou4oeeomi3iyslm2ua(mpnu4 rtoioctotoaDr n ils) 2uoir ny4oltnliet t)a2tmx p;t0alto ociyslmDemuvs t0 ltoxo to1fptelu i t)texrxr3ny4lpenlnei ( aDumx  nt1oleo ictadfaDrmumsn(4artnxr iadfa eanvi;s sexoio3oodll e nciltfarur(monu1teto iciadfm rl(mo t)arermrcty1opt au i;s s2xrxo3no1ol   ncslsf rua(rpou0oetomf3iytfs2em(vp u4aexoif iodoptraivsls0t2tm(o3iydap   icsa() Dtrumpot4tee  ociaslm rmu s t4trxrxfciytomtrlu i t) etr(r ny1lmee fcilsfartrumpoo4tlxnio3iasfsDra(vp (4alxoio3iytom r ues;(  rurxrpoodam nlnvsat)s2uaxroot4oleniiciaslmDuaums (0trxnmf iatoat aieo;t)t2tr(opiy1lp elneils)a2umumoou1apxomietysla2ranvpn(0 eerxo3to1fm r uei ( trto(m oydll n iviltf Dtrum no4aeeomo3ils a2raumo;u4trxrxr oodfpDrln i;s trumim oo4lpeemfvs ()s2tmxmo;t0alenmieild sDranvp;t0 reoxf todfp rlu o t s2tmxm3iodol emivtl()arurxrp;u0teeoifciad sDrm(mo;u)teeomo tatlat lieo (0trxo(opio4om  lnes t)arumur nu0opxnioeildlm um(msnu) etnio3oatfm elu i;t) eurimpio1llenmnvi t) Drmu o;o1aee mi3iytfs2rluvonu0 etnif iadfp eaneolt)trxoimpiudomte ivia(  2tr(mooo4olxnii3iadfmDrluvs u)aeenif3oytfpDr u il() rxr(opnu4altemicsl(fa2ua(moou0tle ifetys aDemumon()trenxo oa1lat  nvs (0s2urio3oodlpee ivs ()artm(  ;t1aeeo f3iyt a ea(msnu)tltnio3oodlaD an s s) rxr(o3io4lp nmnesatf Drrxmpoo1oexnioeilsla2rm(vp u0tlxnxfcoatom e ivo;t seuoir ou1altelfet t srurxrpno4oeen octat a uln s u)trtrifcoy1fateaiei t  2tr(opou4am nlnvt sfa2tmxmpou4tpx ii3iltlm elums;t) eenioctodlm  aivs t)t2toxm3iydomtnlfctls  2ta(r ;o0altnmfetldfm2umnmo;t)arxomo3iytoptrauei;s s2xoxrpoo1omenlics t  Drmx p;t1tpxnio3tytls eau s;u) lxoio tatomteluvi;()tetr(m3oodopt  fesat srtau p;t4apxnioeiydls2el( s (0 leoif3ootfm e uvil( texo(m3io1aptemfvsls)srtr(mpot4oexn icils mDelnvonu4aexoxr oo1op  ln i;t  rxrxr nydoltemfvslt)s2rrumoot4olen fcildfaDrlnvp t0 exrxf tytfp eauvs (0setm(opoodomtemnvsl() rrm( poo1olx mo3iysla ea(ms;u) rxnircta1om  aivilt) ruoxmpio4llen ivtlt) Dta(monu1oeenio3tld m2rm( p;() rxoxrctydopt  u ol( t2toxm iy4ol  lfci sf rrau ont0aeen feiytls rm(mo (4trtnmfcta1om e i o ( texoxmpiu4al elnci sf 2tmurp;u1aexnmieiltfm2ulumont0aexrmrctydom   nvs (0t2trirpio1amt mivs t  rrr( oot1optnioeiydfs rluvo;u)teenmr to1fa   ues t0s2xrxm3no1omt micilt) Drmx  ;o0aeenio3iltfm2ua( p;(4 renxoctodlmDrai i s) eurim ou4om  mnet ()aDtaum oo4opx iieildlm2ua(monu)aetoirctodfaDrlueo;() rxrim ou1lptelicta(fsDtrum ;t4apxo ociatls2rl(vo;(0artriocoytopt lnei;(0trxrirpoodlltnlnvsat)s2rrumpoo0tpt iietydfa ra(vp () renifciadfa   nvi;t0seuo(mpiy1am n fvsa()s2trx ono0tpxomi3tatfa rl(mo t4 lxnmociodoaD anvs t0 2to(m3oo1lmtnlfesls arraurpoo4tptn f3iadfsDeln o ()aetnmoctytla rlnvo t) etm(m3nu4amtelics t)a2rmx oou0tleoio3ils mDua(mo t) etriocoy1faDe n sl( tetoxmpoydopenmivtas s2ur(mpou1tlenii3iasla2ulnmont)texoxociy1fm e ies (0s2tm(o oo1ll   ivsls  2ta(mpno1ole  octlsfsDelu pnt)arxnif iy1opDrli il()s2urxr3iydame  iesl( sDum( o;t4tetoio3iydfm2umu s;u)trtnmr3iatom raivi t)setmio3oydaleemivsls)aDurur ;t0texomfetls aDum(vs;(0 reoxfciotomD  uei s0 rurimpnu1omt mivilt) Dumuront4tpe  icild sDrau pnt4artrxrcoytfaDrli ils)t2xrxrpiu1lleemfvsas  2ur(mpot4tlxo oeiad aDemn o;u4 rermr tadlptean olt0teurxopoodlp nlncil()srumxmoot1oltnii3ilslaDuauvs;u4aeenmoctadfp eaueilt t2trxopiudlm nlnesasfsrumx o;o4aptnifeiyt a eanvo t0 rxoir oydomtelneslt  rumio3iydll e fciasfsruaxront4apx ifeils sDran s u0alxoif oa1lm r nvi;t texr(o oodlltnmfci ( sDrmu pno1tltnmo3tad aDrmuvo (0 rtrmr3io1omDrlnvslt) euoio nu1alen fvta(f 2tr(rp;u0altn octatla rau o;() exnxfcoy1fa eaieo;(0t2um(mpno1lmenlfvslt)srrmumpoo4tlxomiciltfsDel(mo (4tltrmocto1laDeau i s teurim3ou1ome lfvsls)arurxrono0oexnii3iytla um(monu0trxnmf iadfmtranvils0 rxm(o3nodll   ncsl() 2rrxront1alt mfetatla uau p;t)trxnxr3ta1optr ivs;()t2xoxr no4olenmiesls)a2um(mpot4oex ifctldla emnvs;t0trenxo3oytoat anei;s) eurir ou1lle mfvils) 2taum nu4opxn ieildfa2rln o;(0texrmo3iydlmD anvi s  2tmxo oodaptnmietasfaDumxmooo4aleoioeiatfa uauvo t)artoxo oa1fpDeaies t) 2uo(r oodam emnet s)srtmum ou4olt  oetlslmDrmnmo u0altrmr iy1opD  nvi;( setmim oudame lieslt)s2urxmono0teeomo3tldlsDrm( pn(0 rtnxo totfaDe uvs;t0 2urxopiy4lltn neils)a2ur(mono0tle iicildla eanmsnt) lenxo iydoatrlnvo;(0seur(r3iu1lltelnctls) Dra(r ;o1olxn oeias a2ra( pn()trtomrcty1fm r u o;() 2uoiopoo4lpt mnetl( s2rax  no4tpxn f3iys mDem(msnt4artnmociadoa rli o;t)t2xm(r iu1ameelivs (f Dur(r oo1opxniictas m2umuvs t) eeoiociytlatranvolt sexrio oo4altemietat a2ur(r ;u1olt mfeiadfaDulu snu4tlerxoctadlateaneo t)seum(o3oodap elnctl(f rur(rooo1tpx micils m elnvp t) renmrciadlpte uvi;s0 exmxopou4olt mivtls  Draxrooo4oltomo3iadfaDran p t) ltnxr3iydfmDe u s t  2ur(m no1aleelfvs sfa2rmuroot4tlxomfeiydfm2eln s t4tlenif3oydfmD aues;s0 etrir3nydlpen fctlsf Dta(r ot0tetn f3iasfsDuan o;u4tltnirctodomtrluei t t2umxm3oo4lp  lfvslsf rrax pnu1tlt micilt s2rlnmpnt0teenxrcia1opDeai o;s0srtr(opiydoltemnciasfarua(monu0opeomi3iad a rlumsn()artrxocoa1laD lnes s)sexrxm3oodale lfeta()aruru  ;o0opxnifeiltfm2el(vsnu4 reomo iodop raneils0teuoio3iy1omte ivt ( sDta(  ou4teen oeiys s ulums t0 rxnif iydfp ranvs s)t2xmim3oo1ole mfctas  ruaumonu0altnmi3tlt aDrlnmo;(4tlxoxociydfp   ieo t0 rtriopnu1opt mnct ( sDtrxmpno0oetnmociytfaDrmumonu4 lxrmoctotfp rlnvi;(0 rxo(opny4al elfvsat srtrx oot0tpe if3iasfs um(ms u4trxoxo3iadfpD  iesls0 2uoxmpny4amtn icia( aDumxrp;o4alt  fcilsfsDrluvpn(4artnif3oo1omtr ueil(0s2toxr ou1lpe micsl( a2rr(rpnu0tex  iciysfaDel(vo;u4tleomf3tydom  li i;s  rtr(m iydlmee nviatf Dtrum ot1aexomfetld a2rlu pnu) lxnxrcto1lp eau s ( seum(opio4omenlfcs sfsrum(mp;u1olen icildfaDrlu s;(4alerxo3oydfaD an s t) rurxrpou4lm  mfet ( s2uaurp;o0olxnif3tadfs2ea( pnu0 ltnmrcta1fp   u ilt)t2xoiopoy4oltnlfci s  Dra(ro;u1aeen octaslmDum( s;t4aexnxfctotoa eai sl(  2tm(o3ou4om  mnetlsfaDrax pnu1teenmiciadfmDrluvo t4treoxr oa1oa  luesls truo(m3io1ll nmfct t)arrmu  ;t0tlx iociasfmDeln p t0aetrxo tydfaDraueolt teurxm3iodlpeelnvsl()sruaxro;u0tee mieiydls2rl( snu0tlenxrctatom   ieo;s  2xmim3iy4alt lfcta(f Drrurp;t0ape  iciysfa2rlnmo;(0 rtomr3ty1omDeln slt setr(r nu1lmee ici () rtr(ront1oltnifciad s emu pnu4trenio3oodoaDrlivol()seumxr oy1lpe  nvt t  Duaxront1openif3ilt m2uluvsnt4 ltoxfciy1fpt aiesl(  etrxo io1amte ncia( a2taxmpot4oetn ieiys a2eanmp;t0teerir3to1latrlues ()truo(rpoydlmt mnetlt) Durxm no0altoif3iltfm elu s u)aexrxf3todfp raueolt  eto(m oodol nmnvsas)sDraur no4olxo fciys s em(vpnt)arenio3ty1fat luvolt)setoio no1lmte nes ()aDtaurpou4oeeomf3iad a rlnvo;t) lxoio oy1op raivs s)setrxm nu1optelnvt (  2trxr ;u0oex iociysfm2ranvs;(4aetrxfciytlp e i o s0 etoxr ny4lpenlfeias  2rau pou0optoio3iyt a umnvont) exrif ia1lpt luvilt0s2toxo ou1ol  mfviat sDra(ront1tltnmiciytfaDeluvon() lxnmfcoadfate ivi ( s2xo(mpiudlpee ivta(fa2umxrp;u0oexnmoctad m emuvo;() lxoio tydfmte n s t)s2xo(opnodlptnlnetas  2ta(mooo1ole moetys m2emumsn()artnxf3io1optelnes;t) euoim nu4oltnlnci ()a2ta(ronu0tleo i3iytfsDumu p t) lxnmr oytoat aivsls seurxrpnudlm nlfvia(fa2tru  ;u1apxomoetld s2em(mpn(4treomo iy1op raivs (0s2xoxo3oy1amtnmnctas  Durxmont1oet iieiad s2elnvo;() ltrxr tadomt ln o s0srtrxr oy1oltnmfet ( srtmxrpno1alen ieils a2rau snt) lermr ootfaDeai i;()t2toimpiy4lm  mfvs t)aDtruro;t1alt ii3iytfsDum(mpnt0aeenirctatfmtrlivsls0t2um(m3nu4lpen iei s a2tau ont1texnioeiytlmDraums t0texrxociotfmt  uesl( s2uoim io4ll  lnvslsfarrmxrp;u1optnif3iyt a um( p;t)trxoiocoo1omteluvslt0 eurxr iodomtnmfcsas  2rauroou1oltnmieildfs rauvpn(4 lenif3tytlp rlnes ( texoxopny1lm e ncs sfs2umxmpoo1alto iciltfmDrlu p t)tleoioctatlpD anei t) rxo(r oydlp nmiesltfsDuaxro;u4oeeniietltfsDelnmpnt4treomo3iydfatrlu i;s s2tm(rpnudlm emnetas)sDra(mpoo1tpt mictydla2ulu s;(0aeerxfctadoatrlu olt)srxoxm3oy4alen fctlt)s2rax  ou4openiietls m2ul(vpnt4alenmo3tydom eaiei;s)srtoirpnudopen fvtas  rum( pot4aetomoctls a rauvsn(0aleoxf iydlp r neol( srumxrpny4openmivtl( a2tmu ont0apxnio3iatlm2elnvo u4aleoxo3iadlmDeluvo;(0srxm(r nu1om e iviatfaDtm(  nt0oetn i3tasla2ulu s t4aexrif3tadop rlies s) rumxm no4ll   ivsat)aruaxr nt4apxoioeiatlaDrm(msnt4artoxo oytfaD  u i;(  2xoxm oy4apee fvta( srrrum ot0teeniicildls rau s;()alxrxo3tadfpD  n i ()srxm(r3oy4alenlfcsa( srrau oou0tpeo i3tytfa rm(vsnu0 leomo3iy1lmDe i i t0teuoxm oydop nlnvsatf Drm(  oo1aexn oeiadfmDea(ms;(4teenxfcia1late i s ( sruo(o iydll  lfcs s aDtr( ont1ole  fcilt s2rm( o;u)aeenirctodlm eluvi;s)setr(m nu4alt  fesasfsrurx  ;u0tpenmfctltfaDeau p (4 lxoifcia1fptrau ils texm(r3iydomtelnet s  Dtr( pnu4tlto o3iadfa2eanmp () lenmrciotfpDe neo t0s2xoxr nodoleemnet t) rur(  no4tlxomo3iydla2rau onu)arermr oytla r ivo (0srur(o3oy4op   ictas)sDumxrpno4tleomieiltla umu s;(4 lenxocty1la  au olt tetmim no4lmte ivtas sDur(mpot1texo ictld m2ua(von()tltnxr oadlaDelu sl(0 ruoxrpoo1al emnviatfaDra(  nt4apt ii3iltlm2rm(mp;u) eermr3oo1fa  luvilt)s2to(r3ny1lmt  fetl()a2uaum ;t0apeniictys a uauvo (0arenifcoo1fpDeaneo t  rtoim3ny1lle  ieslsf rrmur nu4oee if3iydlm uanvo;t0teenxociytlm   u sl(0srxoim iu4lmtemiciltf Dtm(  nt0aetnmfetltfs ul( p t4aeermocoytfpDrlies s) ruoxmpiu4lptnlicsl()aDumu pnt1tpx mf3iatfmDran o;t)arenmocoadoatrln il(0 2urxmpnudaptnlfei sfs2taxmp;u4apeo fciltlm2rm(mont) exoifctytomt lu ilt  rxr(rpiu4lle  fesat)sDrrumoou4olen ictldfa2ra( onu4trxomo iy1la e ieo t srtoxrpnu4al   fvs (fa2rau  oo1oeenif3iyt m ra( p;t4 rtnir3iodlptr nei t0 euoir3iodalt  icilsfsDumu pot4tpx mieiytfa2rl( pn(4arenif3io1lpD ln s;s)setmxr3nu1am emncils) 2tm(ro;o4oeto ictlsla rl(vp;()aleomocto1opD ai s t sruoim nodlpte ncia() rur(roou1oeen fciatfmDemn s;() leoxf ty1la e n s s0 rtr(m ou4lmtn nvt (farua(mont1olxn o3tatfa2umn pnu0tlenio iy1oatr nvol(0 rxrxopiy4lptnmnetas aruax  ;u1tee mi3ild aDrlump;t) rxnmo3oatoptelnei s) 2trio3iudamtelivtasfa2rru  oo4optniieild mDum( s u) rxrio3to1fmt luei;s0srtrimpny4al nlfctl(fsDtrxr no4aptn oetltla el(ms;u4 leoirciy1lateanesls)teuoxopou4am elnvilt)s2rrumo;u0ole ifcilt m2umn s t)arxoxo3ty1fmDr ieil( tetrxopny4altemfvt sfs2urx  nt0oleo octaslmDemnmo t4altnxrciytomt  i ols  rtr(r iydol nlict t) rraxmpnu1tee mo3tatla umnmp u) exnmfctytom e u ils)srurirpiu4am n fvilt  2um(r nu1olxnif3tytlmDrmumsn()altrio iytlmD lnei ()srtoxo iudomt lfcias s2trx ono1altn o3iysfm2elnmo (0tltnio iy1lp eln ils) rtmim iydopt lnctas) 2tmx o;u0olx iieiat m2umumpnt0tltoif3ta1faD lneil(0s2trxopio4oleemfvs s)a2tmum no1tlx if3iydla rm(msnu4 renmo3iy1fm eln olt)t2uoiopiydapt licslt  rraumooo0tpenmictyt s2raump;u4trtnir3oytomteauvs ( trur(m iydameemnvilt)srrru ooo0olenii3iatlaDuanvon()treoir tadfm rlu i t) ruoiopou1omt lfeilt  2rr(mono0aetnmfeiatfa2emuvs;(0 rermrcoytfaDr neols)sexo(m3nu4olee ivsasfs2raumooo0tpe  ietld mDrlu s;t)aetoif iytfaDelneol()t2tmir3iodom emneiasf Duaxrpno1optn ietydlmDum(vpn() etnmfciodfmt  neils sexmxr3oy4lleemnvtls  rua(m oo0tlxnmictas m emuvs u4 etnmr3oytfa   uvi;s0texmxmpou1altnmicsa(faDrrx onu1oee  ietat a rau s t4altrxocoa1laDe iesls  rum(r3ny4oltnlfvi tfa2ua(r ;o0tltnioeiytlm2emu s u)alxnmo io1fm raueol(  2uriopny4ol e fvil(  2trur nu0olxn fctasfs2rl( o u) rtomf iydlp  lnvols0 2xoimpoodomen ncs ( arumx poo4texo oetyslaDrlnmp t)trxriocto1latrlieo t0tetoxm oy1open ivtl( arurxrpoo4oeenif3ilt s2ulnvp;(0artomocoydfmDrlueslt sexrxo3io1opee fvsls s2rru  nu0tlxniieiasfs2ran snt0tetnir tatop e ues (  eto(r no1lle mncil() rraurooo1tltnmfeiys sDelnvp;t) rerxf3oa1fa  lueil(0t2toxo no1ol e nes ()a2ta(  nu0aetoiiciatfm ulu s;u0alxnio3io1fpDelivs;(0 exo(m oodol   nvi s srraxmont1opxnifetydla raums;u0trxnifcoodoa  livs;(0t2umxr3iodap elnesa( sDtau onu0apxn i3tldfaDranvp u0alxrmo3oadlaD  n i t0 rxr(o3nu1olenmfesas  2rmurpoo1tltoii3iltlaDua(vs;t4 etoirciadfmDean o t0srtm(m3iy4llt  nesls)arrauront4tptomfetasfm um(mpnu4 rxnir oodlptrlneilt) etrxm ou1ale  icsls s2umxrono4tle mi3tldla2rm( s u)teerio oatlp elies t0 rxmxo3oo1ope  nviat)a2uaxmpnu1tex  fciasla eln o (0 exoxo3iatoaDeanes ()s2xmimpiydlmenliesls) 2urum no4oeeoiietad m rmn pnt0altrmrcoydlaDeai ols seuoir3oo4lmenmnes t) rrr(rpnu4tpe io3tydfa2rmu onu) etrif io1fmt aiesl(0 2xoxo3io1lp  mnvi s aDurur oo0tlt  iciydlaDrauvo t) etoif3tydoate nvilt0 euo(r iu4lleelfvilt a2rr(moot4olx moctltls ranvp;(0aetoir tydfa rai s;s  exoio no1lmenmfvi s  Duax  ;o0tetomfctyt sDeau onu)aeeoxocio1oaDrlieils0s2urirpou1openmiesl() 2rmxmpot0ape mi3iadlm eau s (4 lermrcootop elueo;s) 2xoimpou1alte ivtls arta(rp;o4tltn oeiytlsDraums (4 rxrif3totoaDrln i;()t2uo(o iodome  ivsl( srtmu p;t0alxoif3iltlmDelnvs;t)texnio3oadom   i s;s setmiopiu4olt mfetat)sDrax  ;t4altnifctysfm2umuvpnt) eeoif oy1lp ranes t texr(mpou1op nlieil(fa2rm(rpno1tleomoctytla2rl(vs;t4 ltnmf3oy1lateanvslt sexmxo3oudlpe  ictlt a2uaum nu1tlenio3iatfs2umnmo;u4 rxoxrcty1omDraivo s) etriopiy4ope lnvtl()a2ta(mooo1tpxomfcilt m el(mp;u0 ltomr3ootfm eli s s)srtr(r ou1al elfet tf 2tmumo;o4tpe  f3iys sDrmn pn(0 eenmfciadoptr u o;t  ruoxmpoudom elicilt)sDumxmp;t0aleoio3iaslmDumu on()aetoiocoatlpt  n s;t  exrim ou4lme mfvsls) rua(rpoo1altoiieiyt m2uan p t0tetoxociotoaDrai s;()srtrxmpiy1ol  mncs ( a2rmu p;u1texnmoetas sDea( o;u0trxomo iotlaD  ivs;t0t2ur(o nudlptn ietltfarrr(  ot0teenifeiyd a rlums;t) rermf3to1om eauei t) rumim ou4aptnmfei t srra( ono1opxo oeiydfa eaumsn(0aetoir3iy1fpDeaivilt)sexr(r3iy1omtelivi sfaDuax p;t4alxomfeiasfs umuvpnt)texrxrcootopDeau o;s) euoirpnu1op  mivsas)s2ua(mo;o1tex  iciys m2eaump;(0 exomrcoo1lp e nvo t t2urio3io1omeemncslt) ruax ont0oltomo3tad mDrmums u4tltnmr tytfmt  ueolt  rum(o3oy4amtnmict s)arra(rpou4opx  o3ias mDuaumo;(0 rxnmr iodlateau ol(0trum(rpoo1om  mfcs (f 2umx p;o0oee mi3ilt m emn p;t)tetrxo tadlmDeluei (  rum(m ny4ol  lietas  2rrxm nt0opxo ieiytla umuvon()artrmr3iodopt  ueil(0trxm(m ou1om n nvt t aDtr(r ;t4oltoiocilsls2ua(mo;(4 eerifciodfpte ueils0 rtr(m ou4open ictl(fa2um(root4aexnmfciltlaDra( sn(0arenxo3totomte i olt0srxoiopoo1opt mfeta(f 2taxm no1tee ii3iat m rln o;u0 lxnif3tadfm  aueo;t)s2urxo3ny1ap emfetl() Duax ono1alxomfeiysfmDraumo;(4 ltoxfciotfpt li i;s)teuo(m3iy1om n fct sf rtaum no4tetn fetad a ra( pnt4texrmo iodoatelieolt)s2ur(mpny4am nlnci t) ruaurpot4ope  ietld a2ul( o u4 lxnxo ty1latr n o;s0trxrxm ny4lmt lnvsat arrrur ou4optnmfeiaslm2rmn on()tlxrmo io1oatraivo t0t2tmxm3iodal nlnvs (fartau pou1tpe  ieiyd m umu p t0tetnir3oodomt  ues t sexm(r3iu1lpee iesa( s2ur(mont0optnmo3ias sDrl(ms;()tlxnxf oydfp  ai i;s0 ruo(m iydalenlfci tf rtmx o;o4tetnmi3iatfm2ea(vs;u4trtniocoadoa  aies;(0seurirpno1oltn ieil(f Duaumpot1tpe  i3tasla eauvsnu0trtnxo3tydoaDe ieolt)teur(opno4aleemfctlt  2raxrpno4ape ioeiyslsDuluvsnu) lenxr oy1fp r nvi s0 eurirpoo4amt  fvta() 2rmxr ;u1apen iciadla2uaumsn(0 rtoio3oy1fpDe ieo (  rxoiopnu1opee fcslsfaDtr(  oo4tlx mfeias sDranms t4trxrxrcoydlm rlies;t)s2uo(r3nu4altnlfei tfa2tax poo1aee mo3tltlmDeluvont4teeoir ia1laDe u i s)tetm(o nu4al  mfct sfaDrm( o;t0tlxnifetldlmDemu o u)tlxrmrctytoa eaneilt  eumirpou1omeelivsatfa2tmx  nt1tpxomi3ias s eau p u) etoxo ty1fa   u ols0srumim3io1opt lieilsfaDrmxmonu4tet mfetls sDrlnvs u4alxrifcia1oa r nvs (0t2toim ny1ll emfvtas)srurx o;t4opxn ocias a um(mo;t4 rtnxf oytlptrauvi (0 ruoio nydlptn neia(fs2truroot4opx mietysla2ua(ms;u)altrxocoy1oa   n i;()tetmxm nodomtn fct (f 2rmxmp;u1aptn feiad sDrmu o;(4alerir oy1omtelu i;s  eum(o3ny1omt mfvt t a2umur nt4oexomfctad a ranvo;(0 etoircoodfateaueslt0 rumxmpoy4al nlfei sf 2tr(roou0optomo3tltls2ran p;u0 leoir3iotfptrlivo;t t2uo(m3no1al e ivia(fa2rr(rono0apto fetyd mDrmuvo u)trermo to1la e i s ( s2um(m iu1lpeelivtas a2trx p;u0oeeniiciysfsDua(vo;t) rtoifciotlaD  i o;t)srxrxm3oy4lle mfvslt) 2rrx pnt4tltoii3tadfsDrlump;()alenio tydla elu olt)trurxr iy4al  livtltfs2uaxro;u0texo oetld s2umnmont)areoiocoa1optrau ols)seto(o3no4altn ieilsfarrrurp;u1apeomicildlmDelu snu0 leriociy1fp elu sls srur(mpiu1lptemict sfa2tmxmo;o1alxnifciatfm em( p (4 lerio3iodlpteauei;( srxrxr no4op nlieiat  rum( pnt0altomociyslmDrlu sn(0 rerif3todfp   uei;( s2uoim3oo1lpe lnei tfartmu o;o4aexn fetydls eln s;t)trerif oadlaDeaieo;(  rurxmpiy1al emnvil(fsrtaumpot1tet moctydlm umu pn(0 ltrxo oatfat au s;s0srtm(o ny1aptn nctat  rtaurpou1alenmoeiadfsDem( s;u4 leoxrcoa1opDraues;s) rtr(r3oo4lm emfeia()artmxr ot4open o3tldls2ulnms t0tleoxociadlm   uvols0trumxo no4amen fvil()srtax  nu1oltn i3ils m2rlnmp (4tleomf3to1fmt au o;s0setmir3no1omt licsat aDtm(rpno1apeoioeilsfs2ra(vont4 eenmr oy1lptran ol()tetrxr oydlpt lfvi s)srrax p;u1alen ietytfm2uau p;t4trtniociadopDrluvilt)srxo(o oo4openlnes ( sDur(rp;t0aexo ieils aDul(vp (0 ltrmr3todomteai i;s teumio iydolt lncs t) 2ua( pno0oee  i3iysfa eanms (4aeenmo iatla raivs s0tetmir ny4amt lictlt sDta(ro;o0opxn o3ildfmDemnms t0 rtoxo iodomtrlies t)s2xoir3nu4apee nes (faDurxrpou0aptoiietydls2eanmsnu0aexoxocoo1fp   nei;()trurxrpiu4lme  fcsat) rrau o;u4texoio3taslm2ulump;u)tltoif oydlp elivil() rxrxo3oodolenmivtls a2rax pot0oexniictlsls2ranvpn(4 reomrcoytoa elneolt  etmim no1al e ictas a2um(r nt4teeo ocils a2eluvo;(4arxnmocoa1laD  ivo s)truoxopiy1llt lncia(fsDumu o;t4tetnmfciys sDul( snu4tleoxr iotlaDraivol(  eurio oy1ol nmncs s aDtrxm ot0opx mf3iadls rmu p;() eeomf3tydlaDr ivi t trxoimpoodom emnviat  2uaxroou4apxn ieiytla ulums t4altrmf3ootom  aueols) ruo(o nudapenlivt s) rtruronu0tlt if3ild m ulu sn()texnxo3totfm  au ils texoxm3iu4am n ivtat)sDuaxmont0aexnioeiysla2ua( p;()tlxrmr3iy1fpDrauvo;t0tetmimpoy4om elnet s artrxrooo1aeen o3tyt s rl(vs;u0 rxomrctydomtrlnvs (0t2xrxrpno4ale  nci ()aDur( oot0aeeo ociltlmDua(von(4 rerxrcta1om eauvol(0texm(opno4am emnetl(faDtm(rpoo0aexniicildfaDuln p u0alerxo3oodopD lieo t)setoiopoudlpenliei ()s2um(mp;u4oex  i3ilt s rluvo;u0alermf3to1lp  luei () etoxmpiy1am nlnesl(fsDuaum ou1aetn f3tasls rm(mpn(4alerirctydomtraneols trtrxopoodam emicsat  2rmx pou0tlxomf3tlt aDemnmon(4 rxrmrcoa1fmt an ils t2tmxmpio1lpee ietl( s2rmum oo4tptoioeiyt a uau p;t)tetrxo iatfp elu olt)s2um(opno4lptn fctlsfsrtr( pot1teeoioeiysls2rlu s u)texoir3iotfa rli o s) 2xrxrpoydomtn nvtat  Dumx onu0olt if3tlt aDulums (4teenio iydfpt liei;t trxrir ou1aptn ici tfaDrax pnt0openifcilsfm rmnmont)artrmf tatfpt anei;s)tetr(m io1ome mnvi t srrr(mpnt1oex mfeiydlmDrlnvo u4 rtoxo ia1laD aivils) eto(r3io1omtnmnci t s2tmuro;o0ole  f3tat a2umums t)altoio3oo1lmt lueo;s s2to(mpiydam e fct t) rumurpnu1tleo i3iys m2ea( p;u4arxriocoatlp   i s;t)seurxo3iodlme lncs sfsrrrxronu4tlenmictlslmDelnvs;t4trtrxfcoydomtelnes;s)trxrio3iu1oltemict (fsrur(rp;t4oetomoetasls elu s;u4 rxoio iytlp   nvo (0 rumxm3iydamtelivs s s2tmx  ou1olto o3tldfs2umnmp;u) lxnif3iy1fptrlivsls)texoxm3nu1lleelfvs ()srrax  oo0ape  feilsfaDrm(vp;t0 ltrmr oatfa r n ils)tetrirpnodomen fcsl()s2uaxro;o1tex if3tls aDeauvpn() rxnio iadfpD aies ( sruoxmpio4om   iei s a2ur( pot1aleo ociat a2ranvo;u) exoiocta1faD  ivolt)t2xoim oodlptnmnvsl(f rrrumoot4aee moeiytfs2emnmp u) rxnmocoydfmt li o;()setoxopiy1ll nmfciat) Dtrur ;t4aptnifcias s eauvonu)alxnmocty1lmtr i i t)srtoxr ny1llenmivi (  rrax  ;o1ole mf3iysla2elnms;u4 lxrxfcoatomte ueol(0 rtriopiodom emictl(  Drmx o;t1open oetldla2ua(vsnu)artnif3oodlmDrlivi;t) 2umxm iy1lle  net sfartm( o;t1texnmoeiat a uauvp;u0artnxf3iydfmtr i s;t0t2tmim3nydlp nmnviltfsDraxmpou1opeo iciaslaDum(vo;t)arenxf3tadfpt  nvslt  rum(m3nydolenmnvi tfsrtmxro;t4tltnmo3iasls2ulu sn(4altnmf ty1fpDrlneo;()s2to(rpnydlle lici s  Dtaurpoo0opx mf3tysfm rauvsnt0 ltnmr3iotomtraivo s0 2tm(o nydamee nct ( sDtaur oo1tptnio3tlsfmDrau p ()trtrmfcta1op e n o t t2umxr ny1apt liciasf rum(m ;o1oee moeiydls umu p;u)trtnmo iadla  lueo ()srxoio3oudaltnmfcias)aDrrurooo1tptnmfcilsfs el(ms u0 rtrmo3tytlatraivo;s  ruo(r3iy4ol  lfci t  Dtmu p;t4opeoii3ils mDel( s t0aexnif oatfa  liesls0 exmxr io1lp n ivsl(f ruau pno4optomieiltlm2ua( p;(4aleoif3ty1la  lneo s  exoio3oudapeemivtlt aDurxr ot0oexo fciydfaDem(mo t0 rtrxo tatopt lneslt) exr(mpoudllt lnvtas) 2tmuro;o1olt mf3iydlaDum( o;()tetrmf3tydlmt  i i;(0 2xoim3nu1op  mfcilt  rta(r ;u0alxn fciysls umu s t4tetoifcto1fmDrli s;s) etm(o3ou4omtelnci ( a2rmx onu1oet moctltfm2ra(ms;u4 rtnio oatfmt auesl() rxoim3nodoltn icsatf 2tau ooo4alxomocild m ulu o ()aeeomr3oadoa rauvs;s) 2umxo oodlpe lfvil( aDrmu pnu0tlxn fcilslmDraumpn(4texoxo3oa1lp e uvsls0srumxm3nodlpe micslt)arururp;t4opt mocilsfm rm( s (0alxrmrcia1fpt  n sls)s2xoir3no4opt mfcil( sDraxmono0tptnioeiltfaDulump;u4areoir3oa1fm ranvs (0s2toxr3io1llen fvi sfs2raxronu1teeo ietydlaDrm(vp;u4teermociydoaDrau o;s  rtm(mpoydopenlnct t aDta(mp;u1aetomieilt s em(vs;t) exniocoatopte ieo;(  rxmir oo1lpenmnvtas)s2truront4olt mfcildlsDrmnvs u) rtnif3ta1fpDr uvo s0srumiopoydlpt micsat aDuauroou1teto f3iadfa rluvp;u0 rxoio ia1opDr neo;()setoim ny4olt mneil(fa2raum oo0alenioeiyd m2umnvo u0 etoircto1faDran ol() exmxr3ny4lm e ict s  rum(m oo4altnmicildfa ulnms;u4aexnxoctatlpDeai s;t srumir3nodap  lnctatf Drm(ro;o0aexniiciadfa2ra(vsnt)aeenmrcoytop r neo s  exo(m ny1am   nvsatfsDraur nt0ape mieilslm rmnmp;u0altrmociotfmDe u o t  2ur(o3no1apee ivs ()a2ra(moou1aex mo3iadfmDeau p t) ltoxocoytfpD aivi (0 2uoio io1amte fcilt  2uaur ;t1teeoiiciltla um(mo;t) eeoir3oo1lpDeaueil() 2trxr nu1omte ictl( srraxro;t4aet if3iytlsDrluvsn(4tltoxr3to1fa e ivilt0sruo(m iy4lp  lfctas artaxmoou4alxnifciltfmDrm(vo u0artrio iydfmtelivs s0trum(m3nu1ame lnetl()s2ua(ro;u4aet iociat mDeauvs;u0tlenmr oo1opDrlivo t srtrxr nydaptemfcils  2uaurpot1oetnmi3tyt m umuvp;u4tltrio3iodlm  aivil( tetrxr3iodoleemnei t) rtaxrpnt4oeto fetydla ulnmp u4arxnif3oadfm  li o t0 eurir oo1ap  liviasf 2tm(rpno0aexnioetldlm2eln s ()trxnif oa1fateli olt0 2xoxr oy1olee neia() Dtaxro;u1tptoifetysfs2uanvpn()alenmr3iadoatranvi ( teumxm3iudom  lneils  Dum(rp;t0tee micild sDemn p t0aeenircty1fpteai i t setrxr3nydlpenlnciltfs2rmumoot0oeeoiocilt a elu pnt0 rtrxociotfat lu ilt0s2uoxm3oo4llenmncilsf 2tmu  nt0apx  ietadlmDeanmont)artnxf3oatomt aues s0texoirpio1ol n ivtltfs2umuro;u4oeeomi3tls aDemu p;t0trxnmf3oodfmtr neilt trum(opoo4omeelicias)srrr(mpot1texnioctys m rmumo;t4tlerircio1lp  aneo t texrir3oy1opeemnvs ( arrm(r ot4optniictlt a rl(mp (0arxoxr tatlm   iei s) exm(m no1lmenmfci (f 2ua(m nu4alxo o3tldlsDrmumpnt)tlxomoctodomDe n o t  etmxo ou1lm   nvt sf ruaxmonu1tex  iciltlmDulu s;t4 eenxr3tydlpt  ivsls  exoim3oo4lmeelnetls)a2rm(mono1aetoio3iasfm ean p (4tetrxo3iodom ean o (0srtrxo3iu4ap   fcsa() 2urx pnu1aetnioetas s ulu sn(0 exnmfcty1fp   iei;s)sexmim3oudlpt mfvt tfsDrau  ;t4tee mieild mDelumo u4aexrmr3ta1omDe nvsls)t2tm(m no1opt  ncs ()a2rrxrp;t4aetomieiys aDra(mo ()tetoxr oa1fa  au s s0srxr(rpny1omt  iei sfaDururono1tpenmfctadfaDelu s;t0arxrxocoytfpt aueo (  2xrxm iu4lp elictatfaDumu ono0tpeo fctaslaDulump;u)trtnio oydop ean o () 2xoxm ny4olt  fvi ( artrx  nt1texoii3ias s2umumo;() lenxr3ootoaDeauvo;()seurir nodlmtemfet t)arua( p;t0tptniietyt aDem(mo;t) rxoxfcia1lp  anvol()setriopny1am  miviltfsDum(mo;u1oetnmfetldfmDelnvp t4artniocoo1om rlivs s)t2to(r iudop n neiat)aDuax  no0tetnmf3iydlm2ea(vo;(4treoxfcta1lmtrlu sls0 2xmirpou4lleelfci t) 2ta(rpnt0optnif3ilsfa2ea(ms;u)artoxrcoodlp  lnes ( texoiopoy1ame mnet ()a2trx poo0oex ioetytfs rl(ms;(4 lxnxf3tytomt luvslt0srumxrpiy1ap emfvia()aDuaxronu0olx  ictatfmDuanvs (4artoir3iadfaDeaieilt) rxm(r nodlpenlivs (  Dtrur nu4oet if3ildfa2um(ms t4areomrcio1lmtrlu sl( teuoiopoy1om elfvsl(fsruaxmpnt4aee  ociltfaDrlnvp u0aexnmocoa1lpt livi s0 2xmxr3io4lmtemfvias srua(  ou4openif3iydlsDelnmp;t4areoif3tatopDelu slt) 2tmxopiu1om n ncia(fa2trxrpot0oleoiiciyt a2emu snt4 exnxo oadlaDe u i;t) 2trxmpny4lleemneil(fsrtmx  ;o0tleoifcias m em(mp;t4 reomf3tytom eaivi;t)t2uoio3iu4ll   fei t) rrmxrp;u1olxoif3tltfs2uan s t)aexoxrctotlpDeln s;t) 2toxopoodlmeelfvtas artrur ;o4aee mfctatls ra(vp (0trtnmocoatopteluei;s)setrio3oo4openmnviat sDtaumono0oexn iciadfsDemums;t0artoifcoadfate i s;t srto(m ny4altnmnct ( artrxrpou0openifciatfmDemumo;(4 exrif oy1op elnei t0s2urxopno1ol  miciltfsrrru oou4opx ifciydlm2ua(msnt0tlxnmo3oodlmDrli s (0 ruoxrpnudapeemicsl()srta(r ;t4oexnioctyd a ea(mpnu)aeeomo io1opDr ieo s)s2trir iodlpee fviltfarumurpnu4oetnif3ilsfaDuluvs;t4tltrio3iy1lp eaies;t)t2uo(mpoo4omte fct ()arurxmonu4tlenioetlsfmDemnvon(0 exrxr totlpt lies (0srxrxm3io4om elnetlt) rurum nt1aetnmieildlaDulu ont0trtomociytfmtr u sl( teumxmpny1altn nvilt) ruru oou0tpe  ietatls rmnvo;t0teerxocoa1lmDe ies;(0s2xr(r nu1opeemivia( a2rm(mpnt1apxomfetaslm rl(vs t4aeenif3tydoaDean ils0sexoimpnodameemfvtl(  2rr(  nu4apt ifctlt mDrln p;u4texrxf tytlmte ueo;( texmim ou1olenlfvsltfaDtaxmpoo4teenmoctlsfm eaumon() leoxf3tatop  lneslt0srxmio3iudll  lncs t) Drmxmo;u4apt mi3tyslsDea(vs;u4aetrmo tadlmt lueil( teumir ou4lme mnvsa(f rur(m ;o4apxn oetysfa2rlnms (4teerxr3to1fmteanvs ( trurxo3iudomtnmncs (fa2tm(m ;t4alen ietlt m el( p;t)aetrxo3oatfm  anvilt  rtrirpou4ame  ietat) rraumpno0tle iiciat s2el(mo u) rxoxf3iadom  ai s;s  exo(m3ny1lpe livtas a2trxrpoo4tleo o3tas m emuvs;u0tetomf oytomDeanvs s teumio io4altnmivsa() 2rru ooo1alx  iciat a2uauvp u4aeerxo iotop   u s t0 rxo(mpoo1lme mnctasfarra(r ;t0oet iicilt aDemu p (4teeriocoo1laD auvi ()texrxm iu4omee nvsls)srtru  ou1opxnif3tatlaDean o;u) eerxoctatfm e n s;(0 2umxo iy4lm elivia()a2truro;u0tpeomociyd m um(mon(0trtrmo oa1fm rliei ()srtrxmpou1optnlfcs (  ruaxronu1tltoio3ils s ran onu0alxriociatomD lueo;(0 etoxo3oo1omen ivtl(  2tmur ;u0alt mo3ildfa2emu onu)aexrif oytoatrliei s0s2xm(opoudapeeliesat sruaxm ;o1alt  fctldfm uau pnt4trerxf3oydlaDeaueils)sexm(r oy1ll  licsls a2ur( pnu1ale mf3ils mDrau s (4texrif3to1omDr uvs s trto(m nydap nmnetas  Draurpnu4olx ifciytla2ra(ms t) rxnxrcia1latrlueol()srtmxm3ou1lm elfvsl( artm(m ou0tlxo ociad aDulnmont0 eermf tatom rlnvo ( s2xmirpno1lmenlfcs (fsDtm(ro;u4oeeomieiad mDul(ms u0altoxf3tytfm r n s s)trtr(m iu4lmenlietl( a2trurpnt4alxniieiyt a2umuvs;t0 exnmr3iadfpDeli ols0s2umxo nu1ol elfvil(faDtaumonu4aexomoctyt m ulnmo;t0artnxr to1lmte ueo;(0t2um(r3oo1lp  mies t)aDtrxrpnt4apt mocilslmDeau p u)trtnmr3tytomt  neo t0s2uo(rpio1lptn iei ()sDrmu  no1tlenioeils aDrlnvo;u0 renmrcta1om e n ilt0sexm(r3iy4lpeelnviat) Durxro;t1alx if3iysfs2eaumpnt0alxnir tatomtelu s;(  rurio oo1lptnmicslt srrm(m ;u4tpt ii3ild m2em(mp t)teenxfctytlmDe ivs;() etriopoudlltelnvsa(fsrrrxmpnu0oeto feiadla ulumsnt) eenif ootfatelu i;s0 2xrxo3nodll   ncsat)aDraxro;t4altnmfctlsfm rmumo t4 eeomr3oatlmDeaivsls0trtmxrpou1op e ietas)aDumu  no0tlx if3iatfm2rmnvsnt4artrir3ootfmtrln i s0srtrxr3oy4omee icils)aDum(rpou1opxnif3iadls2emnmo u4aetnxf3to1opte iesls)teumxopio4amtelivsatf 2ur(ro;u0aetnifeiad m2um( on(0trermocoo1la e ieols0trxrio io4altnlnvsa() Dua(m ;t1olt  octysfa uluvon()trtnxocty1faDr u s;()sexr(r3iu4altelicta(fsDrm(monu0oeeo ieiad a uluvp (4aexrmo ta1oaDeauvo;s sexrir3iu1olt mfcs s sruru o;o1olx mieiadfaDrm(mpnt0artnxf ty1opte ivolt t2uoim iodamee ies sf 2tmuro;o0oexoio3tltfm2um( s t4 rxoxo3ia1fm  aueol() exoio3nu1ame mfetls s2rrxm nt1tpeomfetadlsDum(vpnt0artomfciotop rlieo;() etmxopnudopte ncta()srurxmoot1olx  ictyslmDum(mp;t4alxoxr oodomt lies t setmio3iy1lleelfeilsf Dtm(rpot4tleo i3tls a2uluvs;(0altrxr iodfpD  i i s0 eto(opnodlp n ncil(fsrururp;o1apxo ieilslmDua( onu0altnmr3oodlmtrlnvo;t s2uoir nydaltnlieta( srrmx  nu4oltn fciytfmDem( sn(0 lerio iotomtrauvo;()s2to(r3ny1omtelfci s s2ta(  oo4tlenmf3ild m2umuvpn(0 ltnir oydop elnes s trxoxo oudap e ivtls srtaump;t0olx  feiydfs2rmn sn(0 rxnif3io1fpt  ueo;s)s2uoxr3iodaltemncsa()sDrr(mpot1tpt mfetadfm rmnmsnu)aexnifcia1fmtr ivi s teum(rpiudll emfeiltf 2rmu pou0tleniociyt s eaumo;u)tltoiocia1fp eln i;s) 2tm(m3iu4omtemietas a2tmxront1apto octydlm elu p;(4 ltrir3tytomtrli sl() rxrxr oo1om e ieiltfsrrmur no4oex ioctasfm eluvsn(4aetnxo3tadfatran s t0 etr(mpoo4amtn feil( sruau ono1open ociytfm2rmuvs u4aeermr3tatoaDeanei ()s2xmxo3iu1alt lneiasfsDur(rpnu4tpt  f3ias mDumuvp u)arerif iadfpDrluvo t)trumirpnydaltnlnci ()sDtaum no4oexo oetltls2ranmsn(4 leoxf tydoat livs ( t2umim no4ap n fetlt)aDta( ooo0aeeomictad a emnms;() rxomf3todlp eluvo;(0 2um(o no4amt  ivs ()srur( oot1oetnmiciltfmDuauvon() ltoxrcoodlpte u o;t) 2uo(r3oy1ap emnvtlt)srrrxroot4tleo feiat m2ranmo;t0altrio3iotfa eaueo t0texmxrpiudlp e fet (farrm( pou4opeomfeiytlmDem(vp;u4tlxomf oytfat aieo;s seur(r ny4aleelnvias)a2tr( pnu0texoifcilsfaDua(vp;t) lxrif3iatlmDeaneol()srxrir3iu4lmt mnvta(fs2urxmono0oexnmoeiytfa uanms;t0aexrir oydla rli slt) exr(r3iudalt lfes (fsDurxm nu1apxoiociadlaDuluvonu0trenmr3iotfat lnei (0t2xrio3oo4aleemnesat sDtm(mp;u4olxnii3tltls2ua( s (0trerxo3ia1omt  nvslt)t2xrxo3iudaleelieil()sruaum ot1tleoioeiat m2eanms;()teeoiocoadlpDeauvs t  2xrxm nu4aleemfvsls srurxrp;t0opxnif3iysfm2rmuvsn(0 rxrifctodfmD luei t) euo(r3nydlmtn ncs (farrrx pnu0olxnmfetltfa uanmsnu)trenxrcoo1fat auesl(0trto(m no1om elfesls  Drrxmono4aex mfetyslm2umuvsn() renxr totfpt anvolt0sruo(m no1ope lncias sDtmu o;t1oleo f3tatfsDeaump;t0 rerxo iytfm elnvs t0 ruo(r3ou4apee fciat s2tax p;o0tpeomoctytfa2rmnvs;u0 exoxo io1lm e ueo s)s2uoio3oo1ame mivtl(f Draum ;o1tee ioetltfaDem( o;() exomo3oytopt anes;t)texoxr ou1lle lfcta( aDuru  ot1openmfctysfs ua(mpnu4tltoiociatfmDe n slt srtr(r3ny1alt  ivsat)aDtau oou4ope miciatla2um(vo (4 rxrxf todlmteluvols)seurxo no4opt  icsls)sDuau ono4olt  o3iyslsDra( o;u0 rxnif ia1omDrlnei;t s2xrxo io4aptemictl(fartm(ro;u1aet  octydlmDulump;() eeomf3oytom  lueolt)t2tmiopiu4oleemfeslt)srua(r no1aptn fcilt s ulnms (0trenxfciydlpDeln o s0 2uoio nodoptelnetlt)a2umumo;u4olt ifeiltfs2rmnvp;()altrif tatlp eanes (  eto(r3iy4olen nvt sfaruaur ;u0aetn o3iyslaDum(mpnt0altrircoydlm eluei t trurxo3ou1opte ietl(faDrau oot4apxo fciad a2ra( s t)teeoio iytomtrlues;()s2xoxo3nydamt mfei (fs2tm(rp;t1apx iictadla rm(monu4 lenxf3oo1lm ranvs (  eurio3oo4amtemfctlsfsrumxmpoo0oetoiicilt a2ua(mp t0aetrif3ta1lat lu sls)sexrxrpoy1olt lnvslt sDtauro;t0aptn fciysfsDrmn snt4areoiocoadfaD  n slt) euoio3nudomee nci (fsDumxr nu1tptn ieiyd s2ul( pn(0 lenifcoadop elu s t  rxr(r nudomtnlfvi (faDurx  no0olxnii3ils a ulnvsnu4tltnmr3oo1fat  i i t0 2xmxr io1altnmicia()s2um(rpno1aee  ictyd s ranms t) etoifcta1optean s (0sexrxo3nu1optemneslt)aDrrx poo0alt mfctat s ulnvsn()tlerio todlatraiei;() 2tr(o io1ome livsl()sDta(m ;o0tptnmfciltfs2rm(vs (0trtriocoadlmDean il(0sexrimpiodlmtn nvi sfsDurxmpoo0oexoiocilsfsDea(vs (0tetoxr3iytlpDr ueols  etoim3no4altnlieta(  2tmx  ;o1tpeomf3iadla2ea( s t4alxrmr3iatlaD  uvo (  2xoim no1altnlivs ()aDuax poo1aleomf3iys s rlu p t0altnio3totomtranes;s sexoxr oodapen ivsas) Dtru  oo4aleoifciad a2um( pn(0 leoxf3oadomDe ivs;s  rurirpoo4lleemnvilt)s2ta(r oo4apx ioeiytfm2emump ()texoifcio1lmt ln sl(0s2uoim iu4amen neil(fsrra(monu4tpeomicils s2rl(vo t0tleomr oo1lm rlivilt0trxmxmpiudop e fesat) Dtrur no1apeoio3ilslm rm( o;(0teerxo3tytomt aneo;s trumxr iu4amte ncilt arrm( pou1aeen fciyd m2rlu p;t4tltnioctatlpD anvols0t2tmxrpiy4apt mfcs t)s2tm( ooo0oleo feiasla uln snt) lerxr3oytlateluvi;t)t2xoxrpnu1lm e ies (fsrum(mo;t4tlto f3tld a2rlump u0 ltnxf3oy1fate ivs t0sexmimpoudam elnvta( aDrrumooo1teeoiictysfa ra(vp;u)tetrxr3oy1omtr u s () 2tr(m nu1lpe licsatfartrxroou1tpxn ociat s2umuvs;t4 lxoxo3to1faDe neo s)trxmxm3nu1ol nmici () 2um(r ou4aetoif3iysfa ran s;u) rermf3ootlpD lnvsls)t2xm(o iydlptn fctlsfa2tm( ooo0ape  f3iytls rlu p t)trenir oatlp rlneo;t  eumiopny1alt  fcsasfaDrm( o;u1tltnmfcildlsDeanvs u4texrioctodfaDeau slt0trtoio3iydomee ieilsf Dumu ooo0ape mo3ildls2rl( snt)tltoif3ia1omtrlivo;s0srtm(m3iodolt lfei t) 2tr(m oo1oleomociadfm2ean on(0alenmr3oydlaD  uesls  rur(o iydopenlnct t)s2ua(m nt1opxomi3tysfs2rmuvs;u) exnirciadop  au i t)teumxm nu1ole  nesat aDtaxmont1tetomi3iltfa elumo;(0teeomf iatomtrlivo;( setmimpiy1amtelnvils)srrmum ;u1alxnmi3iytlm2rl(von(4aetomf3iadfat  ivils) 2urimpny1altnmfeia() 2tau p;t4tltn fcildfm uanmont4 lxnmr iadfatelivilt)trtrim iydom  mnvs ( arurump;o0tltoiiciysfs2rmn pn() rxriocio1fmt an sls)s2toio iodome  fetl( sDuaxr nt1tptomociatfsDrmnvonu0 rxnir tatomteli ils  euoxr oy4al  mneiltfsrrax  ;u4aexomo3iatfaDeauvs;t0 rtnmf3ta1op rau o;( trur(mpio4om nlictat sDtm(r nu1oeeoifeilt a rlu o t4tetomo3oo1op   u i ( s2to(r3iu1al elfes tfaDtru o;u1oet mociadfa rln s;u0trxrmf3oatoatr ivi t0s2ur(rpoydolenlfei t)sruax pnu1aexo fetadfa raumpnu0tlenxr3todfp elu sls  etmxm3ou4olee ieta() 2urumpou0tltoioctatfaDrmuvo t0trenmf iatlmDrau i () 2tmio3iu1lmtelfvt s  2rr(roou4oeeo i3iydlaDea(msn(0alxoxr3iy1lp r uvo s)setm(rpnu4alee ici t) 2rr(  nu0opxn oeiydfa ulu on(4trtomf3ia1lpte i s s)seurir3iydamen nes t srtrum no0oexomi3iysfa2emumsnt4trtomrcoo1oa e ivols0 2xrim3oy4amenlfei s) 2rrxmpnt1olxnmfeils mDrmu p u)alerxf3iotlmD aivs;t0t2urimpiu4am n fetltfsDraump;u0tlt iietydfa uanmp u)arxrmo tytfaDelueo t  rxmim nu1apeemict (fs2rmxrpnt4teeoio3iytlm2uauvo;t)alerxo3oo1faDranvi;t0 2xmxm3iu1opeelneiasfsrrmx p;u4oexn i3iysfm2emnms;(4texoio3tytfa eau i;t) rtoxm nodoltnmfvtasfa2tmumpou0alt  o3tyd m2ul( s u0arerxocoydfm  luei;( seuoim3iu1omtnmnciat) Dtmumo;t0alenii3iyt m2rm(mpnt4tlxnif3tytoptrlues;()s2xoiopiy1lpt  fct ( arta(mp;t0tlt mo3iys s2el( s t4tetnio todom eaneil(0t2uo(m ny1omtemncs t)arra(  ot0alxnmfciydfa rlnmon(0 lxnxrcoytlaDr i ils s2xmxr iydoptnlfcilt  Durxr ot1oeeo ieilslm2uanvs u4tlxnxr oadom rlieils) exrimpny1lp elivilt)srrru o;o1opxniietlt m2el(vsnt)treoir3iatfa rauvs s) rum(r nu1ome mivs ( s2um(mo;u1tpenifcilsla2em( o;t0aetnxr tatfmt lieo s tetoimpiu4al n ict t) 2ra(r no4tlto octyt mDeanmo u0 ltnif3ty1faDrai sls s2tm(o3nydllt  fcs s sDrrx ooo0opto fetld s rlu o;t0aeeomr oadomteanei s)s2to(mpny4oltelics t s2rrum oo4aetnmietad sDelumpnt4trxrxo3ty1fat  uvsl(0 etmxo3no1lltnmiesat  rrmx  no4tltnifeilt aDeanmpn()tetoxfcoatlaD  ies;()seuoxo nu4ap   nvs () 2rr(mpou1optn ieild a el(mo;(4trerxr iotomDe nei;()texoxr3nu4op e netls srtaur ;o1tpt ifctltfaDrm( o ()trxrmf tadlpteanvol() 2uo(mpiu4lpte fcsasfa2ra(m ;t0tetoio3tyslm rlnms;(4 rtnmo oadoptr uvolt s2xoxr3oudlmtnlncsas)srrrxm oo0olxnioeilsfsDemn snu)alxoifctodlpteln ols0srtoxo3iodomtn fvsa(  rum(m nt0opxnio3iys sDea(vo u)trxomrctydom   i s t  2uoxopiydop  lfvias  rumu  ;u1aet if3iydfaDraumsnt) etomfciy1omtrln s t  ruo(r nodaltemnes t)srtmurpnu1aeeo ocildfm2ean s;(4aexnir3iotlm  lnvs t t2xmirpnydlmee ivtls aDrm(mpot0texomi3iat mDelumpnt4 eerif3todla  livs t)t2xoxm oodope  ict s) Drax  ou1opxoifciad a2eanvp u)tlxomf3oydop rai o () eto(o3ny1ol e fesas)aDrauroou1alt mietas s2em(ms u)texrxf oodop eaieo;s) 2umir ny1lpte ncta()aDraurpnt1tpxnii3ias a2rm(mp t4 rxomo3to1oa raivo s0seuoir3ny1lpee ictl(fa2umxmpnt1oeeoiicils a em( sn(0 etnxf3oo1opD  ues t texoiopnu1am emfcta()s2rrxr nu4aet  o3iysls ea(mp;t0aleoxr todoaD livils)t2xr(mpoodllt lfctltfsrtaxr ;t0aeto ociysla2elumo;() lermr oatlmteanvo;( trxr(o3oy4opt lfctltfaDtru  nu4tpxnmoetytfa2eluvs;u0aetrif3oadomt aivi;s srxr(opny1apeelfvtatfaruaumont1tptnmo3iat m2rau s;(4 rtrif3tydlp e u olt)trtrim3iy4aleemiei t srtaxr nu4tlenmo3iysla um( s;(4tlxoio tatopD lu s;( srxmiopiy4alte fesas)sDrr(root4ope  ictysls2rmu s u) lxomo3iatoat lnvslt0s2trir3no1aptnmietl()a2tmx  ;o1apt  ieiat m2umnmo;t)trxoxr3iadlp r iesl(0 rto(m3oo4optnmivsat)a2trxm ou0oleomi3tldla rm(mo ()arenxo tatlmD aneo ()seuoio3nu4am  mfct sfarra(rpnt0tpx moetyt sDrlnms;()aeeoir3iatlpt liei ( srto(opoy1apenlnviasf 2rmu poo0oex ioetydfa2rau s t0aleoir3iotoptr uvi;t srxo(opnodlmenmfesat srrrur ;t4oetoifcils a2rm( s (0 rxoxo3ia1oa e nvil() 2toim oydape lfei tf 2urxrp;o4tltnmo3ildlmDra( pnt0 eenir oy1opDeauvo t)srxoxo3nu4lleelivtlt)s2rau o;u1ope  f3tld m2elnmsn(0 ltrxo3oa1opDe u il() 2tmiopoy4lp  micta(  Drru pnt4oexnii3iydfmDrmnmo u4texnio oydopt auvslt0 rxmxm nu1ol  lnesls) Drmx pou1oeto f3iltla2umuvp t4tleriociy1oateliei;t teto(opoudol elictlt  Dua(mono0olx  ieild aDrln p t4aexoxociy1fp  aueilt trxoio iudope lfci t)arrrumpnt1tetomi3tls aDran s u)trtomr to1fat anvolt) rxm(o3ou1oltnmietls  rtrx  ;t4tex  ictydlsDel(msn(4aleoir to1fa r u i s0trtm(m oy4lltnlnesat aDrr(mp;o1openif3iys aDran o u4aetoxocta1faD auvs;(0 2tr(r3oy4opeelfei ()arumu pou1apenmi3tld s emnvpn(4tetrmr3tytomtelieo;s trto(opou4lpeemfvia(faDtr( p;t1teeoioeils sDumnmo;t4trtnio tadfa elueils0srtm(opoy1alen ncsat) rrmxr nt4olxnmoeiadls2ul(vs;()alxnmo iydfp raieslt0 exr(r oodame  nciat s2ua(r nu4apen i3tadls umu s (4 exomo io1lm  anvil(0sruriopnu1optemnctatfsrurx o;u1apxomfeildfmDuaump u4tlerir oy1fpDr ueo (0 rtmio3nu1apte ici tfa2rm(root0tptnii3tasls2uluvs u0 ltnif oatfp e nvols  2xo(m3nudalenmictlt) 2um(mpnt4tlxo oeiysfs rmnvo t0alerif oy1fm elnvolt)trxrxr3nodlpt lnetl( sDrau ono1tex ifeias m2emn o u)tleoiocoy1omDeaneilt)t2xrio iy1alen ncsl()arum( ont4tpx ifeiytfa ul( snt) rtoifciadfmDelueo t)trto(m3nu1lpen ics t srur(rpou1aeeoioctltfmDea(vp;u4artoxo3oodlpD an o;s trxr(rpoy1om  lnetat sDrmu  nt0oet  f3tasfs2emums;()altrio3totla raieols)s2xoxr3iy1lpenmfci (faruaxmpnu0aetnioeilsla2rm(vsnt0 leriociotlmD  ivsl(0trtrxmpio4lmee nctl( aDrau pnt1apxomo3ildls2uaums t4aeermrctytfa r uvolt)sexr(m3io1lptelnctat)aDtr( ono0alt  feiyd s2ulu p u4 ltnmr3iotop r u s s t2xrxo oodop e fviatfs2rr( pno0ole mociat s2rau p;u0aleniocto1la   iesl( s2xrxm3iy1lp e nvs tfsDta( p;t1tlt iociat sDrm(vo t4 rtnmrciytfaD ai ils) 2toxm ou4ole  nesa() 2tauro;u0oeeo fctadlmDrl(vo;u0 eeoxr3tatom e uvslt0 rxrir3iydlme lfvt t a2uaxmoou0tpt iociyd aDemump;u0artnxr iadfaDe ivi;t) exrir ou1omt lieias)aruax o;o4tptnii3iydls rl(mp;u4arxnio3iytlm elu sl( trtrxr3oo1ole liviat  ruax pnu1oex  ocils s ranmp;u0 rtoxr3io1fm eluvi;s0t2umio nudllee fvias srrrxmpoo1aee  f3tyslmDrmuvonu0 rxoxfctytlpt  u sl( srum(mpio4ll elncsls) 2urumonu1tpxomoeiasfs2ra(ms;t0treoxocoydfptr neol(0t2xr(r3iodom nmfci t) 2rr(m ;u1ope micilt a2rln p;t)trtnmr3iatfpteau il( trum(opiydol   nvt s)arra(r ou1tptn fctatfm2el(vp (4arenxf3io1latrlueo s0 rtrxr oy4olen nesat  2ra( pot0tetniiciyt a2umnmo;u4arxrio3tatla  ln s t teuoxr3iy4lpee nvsa(fartmxronu0tpen i3iysls ran on(4 renif3oadfpDrlivo;() exo(o nu1ale  fcilt  rtm(mooo1aee ioeiysls rmnms (0 exrxrctotlaDeau i;s0 2xmir3nudol  mnctatfa2rrx  nt4tle mi3iyd aDelnmo t0trxomf3tydlaDrlnesls seto(opiydapt  fct ( srurxmp;u0aetn f3iltlaDraums;u0aleoio iytlatrauvo ( srto(o3oy1apt mfcia( s2raxront4alx  fetys mDuau p t4 lermr ia1fm elueolt  2xo(m3iodlp e nei t)sDtmxrono1teto fciat m2umn o (0altnmf iydopte ieolt  rtoio3nudope mfviatfs2tmx  nt1teenifctyd m2el(vs;()altrio3to1lm rlnei t0t2tm(opoodam emieia( arurxrp;o1aleomiciat sDuluvp t0 leomr3tadla   i olt) 2xmirpio4lp nmneia(fa2ururpnu0tex mi3tadfs rau snu4areoxrctotlatr uvs;()tetm(m3oy1al  miet (fsrrrx  oo1aetnmoetytlmDuau pnu0 exnmo3tadoaDrluei;t)trumxr3no4al elnetlt)arrax  oo4opx ifcilsfs2rlumo;u4alxnir oa1oa ranvilt) rxmim iy4ll nlnesas)aruax onu4openmf3tltlmDumn s;t0 ltnmo totom raivo;()texmxm3iu4apeemivt s)aDurx pnu4opxo fetys sDemuvs;u4aexnxf3iadfmteai s;() 2um(m3ou1amt  ici t aDtrx pnu0tle mf3ildfa2uaump t4 renmf3oydoptrluvsls)seto(m oodol nmnctlsf Dtrurooo1teenii3iasfm uln ont0 lxnxf todlmDelnvi;( setm(r oudlp nmnesl(farra( o;o1olx micildfa umump t) etrxf3ootom e uvo;(0srxm(o3ou4ome miet tf rraur nu4altomf3iasfs emn o;u) leoxf3iodoa  ai ols t2ur(r ny1lpe lfciatfartmxrpot0tee  fcilt sDuauvsnt0texoxr oydla elivsl( t2xo(opiodalte icias s2um(mpnt1tptn i3tlsfa2emnmont)treoxfcty1fmtr ies ()s2uoio3ny1llt mncilsfsrtmxrpou1tetniiciatlm ean p t4trerxo ootoatrln i;s teum(o3nodalen ncsat arurxr ou0ape miciltls2rln onu0 exrmrciy1fpte uvil(0 2toxm3io4am nmietat  rtr(r ;t4apx ifeildlmDem(vo;u0tlxnxo tadfmDe neolt)trtmimpoo4ap emnvsl(fa2umu oot1oet ifciadfm em(vp;(0 rtnxf tytlp rai i;t0 etrim ny4ap   fvias) Durxr ot4tpxnio3iltls um(vsnt4alerif3ta1fmDrlnvsl(  exoxo nydapt  netlt)a2ra(mp;t1alxn f3tltfs2umu sn(4 exoxrcoa1fmDe uvslt0s2umir ou1am n nvt ( a2ur( ooo1oetnmoeilsfm2uanms u)altrmrcoatfptr i o;t)s2tr(m iudlpe  net tfa2urxrpnu1apeo i3iysfm raumon(0 rxoioctydoaDe uei t)srtmxo iu1omtnliei s)aDuaxmoou4tltn fctld s uauvon(0tetnir3tadfatr uvolt srxm(mpoodlp n fesas arra(m ou0tptn oetytfmDrln o (4arerifcia1om eliei;s)sexmxo ny4oltemnvtlt  Drmu ono0teen oetadfa2rauvo;t0tltnifciy1lm r n s;s0 rum(m oo4lm  mnvt (  rtaur ot4alto oetltfsDemumo (0 etrmr todlpt livi;s)s2urxr3iu4ameelfcia(fartrxm nu0alx mfetydlm2uluvo;u)trxnmo3totfate iei ( srumir ou1ol nmfeia( arra( o;t4ole moeiytfsDemn p;u4treoircoa1lpte u s;s  rtrir3iudal  lictlt s2taumoot1oeeomfciadla ulnmo;u)texoxr3to1fm  aieo;t)t2xmxm3iy4apt  nes tfsDtr(rpno1oexoiieiyt aDeauvo;()altnmf3oodfatrauesl(  etr(m iu1open nvtl(fsrumxrpno4ope  iciat aDran sn() rxnmf iy1fpDe i o ( t2tmio oo1apt livil()srtrumo;o0aetomfctydls2ulnvsnt4tlxrxoctydlp  liei (0seumxopou4op n nvilt  rtr(rp;o4texnmoeilslmDra( snt4arxrircoo1lp  anei;t0setrxrpio1apee nei t)sDuau pno4alenmf3iatfm um( o u4trxnio tydopt anvslt) euoxm oo1ll emiei ( srua(rp;o1teto f3iytfm2rmnms;t4 lermr3tadlmDrli sls  2to(m3no1ap nlfci ( artaumpou0apeoif3tat m eauvonu4 rxrxf oydlaDeai s t) euo(opno1alte ietat  rtm(rpot1tlt if3tls m ua(vo () lxoxrcty1fptrlnei;( s2uoiopoydoptnlfcta(f Drm(mo;u0aleo f3ildfsDuluvo;()alxnxf3oodlaDr uvi;() 2ur(rpiudomtelnctat artmxmo;u4tle iociad m eanmp;u)alxnif oo1faD ai s;() ruo(o3iy1llenlneilt) 2rrxmpno0opeomo3iasla rmu p;u)teeoiocta1optelieolt0 rxmimpou4am elicsl()aDua(m nt4alen f3tls aDum(mo ()tetoxrcootfptrluei;s)srtm(opoydome lfct ( a2ur(m nu1tpen f3tys aDea(vsnt4 lxrmr3oadoaDelnvil()sruoxo io4alt  fesl()sDtaxmpot1texniieiltfa2rmu s u) etoxf oytfmtrli i;(  2xo(rpnu4ol nlnet t) 2rrurp;o0tptomo3iysfaDumnvpnt0 rtnxr3iytfaDrlueolt0seuoxmpoo4am nlnvils s2tmuroou1texniictad mDelu p;t) lxomo3iadfp elueo t)srumim3oy1oltn nciat) 2um(root4apt io3tad s2uanvo u)altomfciydfpDe u o;(0tetmim nu4omtemivs ()a2tmur nu1oeenmo3tysla rlnvo;u) etnif3tatoa e nvs;s  etr(r3oo1lpenlict t a2tr(rono4alxomieiasfa2elu sn(0artrxo iytfmDe ueo;t) rto(o nudamtnlivsls)srtm(rp;u4aex mi3iys s2rl(vp t4aexrmr to1lmDeanesls)setmxm iy4amt mivsl(f Dur(r nt1ope  f3ils a2eanvs;u4alxrir3oydlm elivi ()truriopnu1omtnlnvtltfaDtaxr ;u4oltnifeiytlm2uanvs u0 lxrio ia1oa e n i () 2trim iu1aleelnctat  ruru onu4opt mieilsla rau pnt4texnmfcoa1laDr ivo t)trtrxmpoydal  miet ()a2rax o;t4tlenmfciadla2rau o (4treomo oodfp rai i t0t2trxrpoudal emncils)s2urxrp;o4oexomfetat m ulnvo;u)tlxoxr oodom eauvslt0 rxoio3ou4lpe mfvils  rtmxmonu4tpt ii3ilsfmDulumpnu) exniocta1fa e i ol(0 2trxo3oudll nlnvt tf 2ur(m oo4altoioeils mDeauvpnu4teenxo oy1oatrauvo t  2umxo oy1omt mnetas)srtm(m nt0alx ii3iat s2rmn s;u0 lxomf3iodfmt au o ()trxo(r3nu4lpt mfvt t  2urxr ;o4ope mfeilsfs2umumont)alxrxf ta1optr ivil(0srxrxr3oo4oltemnct s)a2ua(r ou4tet ii3iyt m rlnmo u4altomf3iotlptr neols0trurxm nudlmtemfeil(f rurxmpou0oleomi3iasfs emuvs;() eerxf iy1faDr ues s0truoio oudop emncslt aDta(ronu0oetn fciltfa2umuvs;()tlenio ty1om eln s;(0s2tr(m3ou4alee fet t) 2uaum ;u4oexo i3tlsfm2elumo (4tlxoxf io1fp e ivsls  eto(rpnu4ap nmnctl() rumuront0oleo f3ils a2umuvpnt)areoxocoatla elnvi;s0s2um(mpny4open ietltfs2rau ono1apen ietas aDem(mo ()alxriocoy1omt livsls) 2xo(r3nu1lmt mivsa(farraum nt1apen fcias m2ua(vo t0tltoio ootlm elivo;(  euoio3no4ameelfcta(fa2urx ont1tee ioetadlm2rl(vp (0 ltoio3oatoatranvs;()teum(opnudlptn ivsl(fa2trum ou1tetoif3tltfs2elnvon(4trenxfctytlatrlivo (0s2xrio3oydll  mfes (  2umx p;t0texn fciat a2raump;t0 lenio3iytlpt  ies;t  ruoxmpnydape lnvt t)a2tr(ront4tpxo oetltlm2rln o;u) rxoxr3oadoa elnvi t0texmiopiodlm nlict ()s2raxrono1olx  oetysfsDrlnvo;(0 reoxf todfmDeaivi ()seumxrpnudlpe mnei sfa2urx poo0tetn o3iydlm2ul( snt)teenmf3ty1omD lu olt s2to(o3io1lpt lictlt a2umx  no1oee mfciasfa rau s;t0 eerir3iydfm rau ols s2xrxr io1om  mfvilt) Durumpou1oltnmo3iyt m2rl(msnu4altoxo oytlp  aieolt)t2xr(mpny4lm n fes ( s2ra(mooo1tlxnifcildfmDeln sn()altnxocootlaD ln s;t0trxo(m3nydlpt mict sf 2ta(r nt1ale  ociytlsDrluvo;t)arxrxociatopte n i s0s2to(m nu4lpe  ieias)srtr(rp;u1optnifeilt s ra(vpn(4tetomo oy1fp  ln il( texmir ny4openlietat)a2ra( pnu0optnmo3tldfa ulu sn(0tltomf3iodlm elnvo t) exr(o3iydome mnvtl( aDrax pou4apxnioetlsfa2emn pnt) eeomo3iadlate nes;s trtr(r iudll   icil(faDtrxm oo4tleoii3iadlm2em(mp (0 etrmfctytfa eluvs t0 rxoio3no1optnlnvtat)arurxronu0tpx mi3tatla umumon()arxoxo3ia1fmDeln i;( t2tmxrpiu1alte icias  rrm( ono0alt iocild sDemnvo t0trenxo oodomtraivo;t0srtmir no1lleelncsl(faDrmumpnu4optnifcildla2emnvo;u4teenxfciy1faD  nvo;() rurimpoo4ope mieta(fa2rr( pou4aleo ocils a2emu o t0tlxnir3oa1op eaieols t2urxopnodlp  lici (fa2umxront4ole  icias sDrmnmo;u)texnmoctotomD  nes;()trurio oodomenlici t s2rrx pnt4tpt mf3iyd s ulu o;(0tlxrxrcia1oaDraiesl()srxoxm3nu4aptnmfetls)srrrur ou0oleomieiat s rmnvo;u) lerio3oy1opte ues s0s2umim oodlltnmivi ( srurxronu0oltn f3ildlmDranvs;(4tleomo tatomteauvo;s)srur(r3oudopt miviltfaruauroou0open feiadlaDra(ms;(0 rerirctotla elivi (0setrxm3no1ap nlieias)arrrx  nt1tltnmictls a2eluvpnt4trtrmf3oytfm  anvol()seumxo io1am   ics (fsrtrurpnt4oleoiieiytfm2ul( s;() exrif3oatlpt au o;s0 exoir ou4op  mfvsa()a2ra(rono1apen f3tytla2umnmpn() rtnxf oydfm eli il()t2uoxrpoo1op elfeslsfaDrru  ou0texomieiaslm ra(von(4 exrmf3tatlatr i i;t)teurirpiodaleelnvils s2raxm ;u1apto fetadlmDuanvp;(4 eeoxr3totfp  aues;t0 eurirpoydomee fcs s  2tmur ;o1opx micilslsDrlumpnt)teermr3ty1om rluvi s) rxr(opiy1op   ivtasf rtmu oou1tlxomieiytfs2elu p;(4 lerxfciy1fat an ols tetr(r3oydameemiei tfsrum(r oo0aex ifctytlsDrmnvs;u0alermf3oodlmD au ol()trumir iu1ol   ncsasfsrurxrp;u0tpe  ietldfm2umuvs (0aexomf iodopteaiesls setmxmpou1alenlnvtlt)arum(m oo4opxn oetad mDrm(mp ()areoxr oydfate nei;s0seurim iu4oltn fcs t)sDururont4aexnmi3tasfsDelu on(0 rtrxf3ty1faDeln ol( srumxr nu1al n iciat) ruaumo;o4oeen f3iasls2rln p;t4 lxoxf io1la elnei;s0 etrir3oydolenlivi tf 2ua( onu0olenmi3iasla eau sn(0altoxfciadom e n s t sexoxmpiydoltn fcs ()aDtrx pnu4alxn ieiyt a rm(vonu4tlenmrciydfpDr u o t0sexoio oudlpen nvias arrr(rooo4olenmoeild a ulu s (4 lxrio3oadfmDeln i (0 2tmirpno4ole  fcs ()s2ururo;o4oex iocildfm umn s;u0 rxrxrciotfpDr i i;s seto(rpnudom nlnvia(f Draxrpnt0open i3ildfm2ra(mp;t0 lerxr3ootfmtrlu o t) exoxo no1op n fvtl(fartaxr ;o0opt io3iydlmDua(vs;t)alxomr3ia1fm e i ols0sexm(r io4ome lnei t srtru pnu4tee moeiltfa ua(ms;t4 lxoio oo1faD liei;t texrxrpnydopt  netat s2tr(rp;o0apx  ieiytfa rmumpnt0texoif tadlat ai olt0seuoimpiodal emnct (  rtaxm ;o1texnmoetydla uau s (0artrmr3iadom r i s ()s2urxmpoodll n fci tfa2taxmpou0aleo iciytfsDulnms;u0trtomo3ty1opt auvilt0texr(rpiu1ol e ivi (f Drm(  oo4aex miciadla2rm(monu0 lxoirctytlm rlueilt0s2xoxo iydalee ici t)sDrrxm oo0tex ifciys m rmn p u0 lxnmr iydlpDe n s;t texo(r ou1ome mfcslt)arrmumo;u1tlxomo3ildlm2emu s (4 etnmr oatfaDrlnvo;t  rto(o nudlp elfeiat)sDrmu oou4tltn oeils aDemnmo;t4aeerxr tadfmt  uvol(0tetoio nu4lleemfctatf Drm( ono4olx mfeiad m2rmn s;t4tlxomf3oo1fa  ln o (  2urio3ny1al   nviat)arrmxr ;o0ope  oetltlsDeau p;t0teenmrcio1omDr nei;t)t2toxrpoy1lme  ivsltfsDtmu ont0aleniiciasfa el(vp;u0 eenxr iydlaDeaivols sexr(m ny4omeelivsatfs2rrxrpno4tlx iietatla eau o;(0 exomrciatopt liei s t2tm(rpiu1al n nvil(fsDua(ronu0apeoif3ilt mDrauvsnt4arxoifciodfptraueslt trxr(r3nydalt miet ( s2tmxmono0oetomo3iaslm umu s t)areoxr oydfat  ueil() 2xrir3oy4am elfvslsfs2rmx  ou1apx moctatlm2ra(vpnu0aexoifctatlaDe nvo;t tetrxm nydlme mfet s  2ra( o;o1ale  ieiydfs2umu s u0 lxrxrctydoa elu o (0 eumxrpou1llte fvt ( a2umurp;o1aptnmoctadfsDum( s;t0altnmf iatlpt aivs;s s2uoxmpio4ap emncsas)sDur(m oo0tlxomf3iad sDrl(vo t0tltnmociodlpt aivi;s  2xo(r oydalen nctls) 2um(m ;t4ope mo3ildlaDraump u0 exrmr3tadfptean i () etmxm3ou1omtn ncs sf 2ur(r ou4oexomi3tydls rmnmp;u0 eeriociadlp eln i (  2umxopiudamtnlfet s)a2urump;o0altn oeilslm umumo;u0tlenmo iatlm elivi s0s2triopou1ameemnvsat s2ta(m ou1aexomoeiltla emn o t)alenio iotfat  iesl() exo(mpiy1lmee ietlsfa2uaur ot4oleomoeiatfm rmn s;u)alxnmr3iatlmt aieo;(  etmxr oudoleelivias)sDrauroot4optoii3iadlm2ran p;t0teerir3tatfm e nei t)t2xo(opoy1open fvsls  rumx o;o4alen fctas a2rmnvs;(0 ltrxo3ootla   u sls texrxm oydapee nvsl(fsDuaxmp;o1alxoifcilt mDuln onu0alxoxo3oydoaDrlivo;s) 2xoxrpnydap e nvil(  ruaurpoo4altomieiyt a eluvp u) lxrmocto1lm  li i;s0srxoir iodope mnvs ( srrr(mo;u0ale mi3iat sDra(vpnt4 lermo oytla r u i t0t2um(r nu4ape  iesl()s2raur ;u1texo fetytfm ea(ms t)trtnmrcio1lpDrlnvil() 2xmir3iu4llt mietasf rrr(ro;u0tpxnif3ild s ea( o;t) rtnircto1la e n s;() 2umiopiudlpt lfcsl( a2raxmonu1tlto o3iat s rl(vo t0 renmo3totop elieol(0t2to(mpny1am e ncil(fsDraxm nu0oex  fciad aDea(mo ()artomocoy1lpD an i;()sexrio ou1lpt  ictltfsDrm(m ;u0tetn fctydlaDrmn s;(4tltoir to1omt aivo t0 rurxmpnudam eliei t)s2tm(  ;u0aexnifetlsfa2rmuvs ()trxrmo ty1lmDr ueo;(0 etmio ny4opee icias s2umur ;o1oeenif3ild mDemnmpnu0tlermfctotfa elueil()sruoxrpnudol nmiesas s2umu pnt1tptoifctydfm2umu p;t0 renxf ta1oaDraivs s)trurim no4ap  lfcslt srurx pou4opx mfciasla2uanvsnt0 leriocoydlaDelneils)s2umim3iu4amt mnetas s2umx  no0tpt mfetytls2ulnmp u4 etrmr3ty1laDe nvsls  rxmxr oodol nmnctlsfaDua(mp;u0alt if3iadfa2rmnmp (0tltoxfciotoat  u i;s s2uo(rpoydapee ncslt)aDraurpno4alxoioetys a rlu o t) rxoxoctodoat livs (0t2xoio3oydllenlivi t) rur(roou0olxniietadlm2um(mo;(0tltomociytfpD aivs ( teumir3oo4lp  lietls  Dtr(  ou4ape mfeias m emuvsnt0teermr3oodlpD livo;()seum(o3iu1lmtelict sf 2uru o;u4altoifetys s umnmp;t)tltrir3oydlmt  i ol( s2xr(mpny1amtelnct t arrmx oou4apeo o3tydfs2elu snu4 lxrxo iotlm eanvol() exr(m3nu1ll  mici tf 2urum ;u4olto fciadfm2eaump t4 exnxfcty1omDeauesls teumir3oy1ap   ivi s)aDtrx o;t0apt mfciytlsDuln snu)treoxr3to1fp eai ils trxr(r3ou4oltnlicia(fsDtmum nt4altomf3iadfmDelnvs (0trtrxf3totopD luvi;t)setoir3nu4lm  mics t s2urumpoo0apxnmieiyt s elumo;(0alxoiociydfpDe u o;()teum(r io4llen nvsa(farur(mpou0alxoiieild aDua(mont) rtnmf iotoptrauei;(0trtmim oydlpt  ivtasfsDra(m oo1alxn iciytfaDea(mp;u0arxrxo ia1fp   ueo s  exo(
\ No newline at end of file
@@ -0,0 +1 @@
+nvi;s teum(rpny4lm  liet t)artmuro;u4tpto o3iasfa ulu s;u4 exrmr todfa r n o s)sexoxm3nodamt liesl( srrruro;t1open ietadfaDuanvs;t4aexoxr3iotlp   nei s0sexmiopiu1openmnei tf 2ua( o;t4aexomiciytlmDulnmp u0 rtnmrctytfaDe ueils0 rxm(r oudllt lfeias aDuru  ot0apen oetad aDraums;t0areoxr ty1fpt aueil()setoio3ou4optnmicsls  2tmurooo4altnmieiyslm ul(vsnu4trxoxociotomD  n s s) etrimpiu4apee fvi s a2um( pnu0tet iiciaslsDrmnvs;u0 lenmrcio1omD aieo s  etm(opoy1lleemnctlt) rtr(  ou4olenmfciatlsDraums t4trxomr3ty1fpteanes;s) 2xmxo3nodaltelics sfs2tm(ro;u4alx io3iydlm elums (0 exnxr oo1laD luvo;()t2xmiopoy4lp elneils)srtr(m ;t1tetomoetlt a um(ms;t)trtrio3oo1la rauei t  rtm(o nodop e iesltfs2tm(rp;t4openmictltls eanmon()tltnmrcty1oaDelneols)srtmir ny1ap elneia()a2ra(r ;t0tlxoifctatfm2ulnmo u4 rxrmo3ia1lptr ies;t0 rxm(m3iu1ll  mfvslt  2ta( onu0olxomfctlt m2ulnvo;t4tltoxf3oodomDeau ils t2umxr oo1ome  fvt ()srrax pnu0ape mfeiltlsDuln s;t4treomf3iy1oatr nvo ( texrxrpio1lme mfcsls aDuaxmpoo4apxn o3iasls2uau s () rtrif3ia1fpDraivsls) 2tmir ny1altemiesat)arur(ront1olx io3ilt s um(mpnt)trenmf3oatlpDraies;t0trtr(opiodome mfeias) 2tmumo;o1aeenmiciysfa2rmu snu0 renmo3iodom eaueo t0s2xo(mpoy1lp  livtat)arum(m ot1tpx  fctatfm2em(ms t)trtnmr ty1lmtrli il()srtmxopiydamen nvs sf Dum(  no0alxnif3iytfa2uaumsnu4texrxr ta1opD  nei;s)trtoxr nydomtemfvtl( aDua(mpnu4tpx  oeild a2emn o (0tltoir3iadfa r ueilt) rurio oydol nlictlt)artau ono4tleomf3iasfm rauvp (0trtoif3tytlmDr neslt t2trir oy4apenmivsl( aDurxmoou1teen fciad m2el( pnu4 rxoio3iydoptrln il(0trxo(mpnudaptnlietat srumx pou4optnioeiysfs rm(vs;u4altoxf oydfp  aiei ()truo(rpnu1omte ics sfaDtm( o;o0oexnmfeilt aDea( o t0arenxr ia1fpD lues s) ruo(m3iydom   ivsls srrmu ont0oexomfciadfs elumont)teenio3ootoa rlu s;t  2uoxmpny4lm elicta(f rtmxrpot4aet  fetltlm2emn p t4texnmrctatlpD  n s;s)tetoim3oodopt mnet t) Dur(rpou1apeomo3iytfa2ean s;u0tleoxo ta1fmD luvi s0texm(opou1lpt  nvia(fa2taxm ou4apx moetadlmDean snt)tleoif oytlaDran s t teur(m iy4lleelnvs sfsrum(m no4apxomfeiyd sDemn on(0 exnifcoodfm eluvo s0s2xoimpiu4omt mncias) Dra(rpoo0apto ictlt m2rmuvo u0 ltrmocto1faDr nvol(  eumxo nu1amt licta( a2taxmp;u4aeeoiocildla2ua(monu4tlxnxo3iadfat li s s0truoio nodlptemfvsl(  Dua(m no4tlenif3tld sDrau o;u0aleomf3iodla  li ils t2xmim3io1lleemfciltfaDrrur ;o4aetnioctltls2elnmonu) lenxo ia1la ranvsl() 2xrxrpny1alte ieiat a2trxrpot1olx ifetysls2umuvp;u0 rxnmo iadoaDrlnvols teuoxrpoo4omtemfci (fsDtrurpou1ape  fetasfs elnms ()trtomf oodla  lu sl(0s2toxmpoydam   fcilsfarrm(  ot4aptomf3tld a rmnmo;t4tetnxr3iodopDrluvi t0sexoirpno4al   ivsltf 2ua(monu0alt mieiatfm umuvp;u4alxrxo3oa1om r ieil(0t2trxr3io4am nlfes t sruau  oo4aex ifciyt mDemn on() rxoxfctatlpte ies t) 2umxrpoydapte fcilt) Drrumpoo1oltomo3iatlm2umuvonu)alxnxr oydoa  lneo s  etm(rpou1om  lncilsfa2rrump;t0oeeo o3tydfa2rm(vpnt4tltoif3oatlptr nei;t0 rurimpou4lp   nvtltf Dur(monu4apeoifciytfs2umu pnt) lxnircoatop e nvi;t0setriopno4lmen fcil( aDta(rpot4tptnmfeiadlm eanvpnt4 eermr3tydlatelivi ( sruoxmpoo4lpenmfetl()arra( pno1oet mfeiadlm umnvo t)trxniociatfptr u slt0trxr(m3nu1ale mfetl( artrxrpnt1oleo ietytls umumo t4trenio oydfp  anvs;s t2xr(mpnodopenmfci s  rtmumooo0altoii3tat m2eluvont4teenxo3ty1fate ueol(0seto(m iydop nlici ( sDra(  ou4tpe  oetatfm2rm(vpn() ltrio tatfmte ueo;(0 2xoiopio1lmtnlieta(farraxr ;u4alxn fctldlmDrlnvo;t4teeoxf3todomDr ueo;( teuoirpoo1ll  lict t)srtaurp;u0tlxnmoeiadfm2rm(vo (4arxoxr iydfmDrlu i ()trtmirpoo1lmtnmncs () rrax pnu0aex  octyslmDuanvonu)artnxf3to1opDrlieslt0teur(mpoydllt  ictasf 2tmuro;o1aeeoifciat m em(vp;(4aexoxrcty1laDr i ilt0texoxrpnudalee iesl(  Drmumpoo1aptn feildfs eau on(4aleoxr3to1fa eau slt  etr(o iu1ol elfcsat sDtr(rpnu0olxnmf3tydfs ulnmo;u0tetomo3oodoptr neol(0trum(o3iy1al elfcilt)s2uaxmonu0openii3iytfs ran o;(0 lxnmfciatlmtelnes;t)sexo(mpno1apenliet sf 2umxrp;u1tlto ieils m um(mp t0arxoifcto1omtelneo t  2uo(opou4ome  iet t sDurxr nu1apeo feiytfmDea( s (0 exomo3iotom raiei;t setrxm3iu4lmtnlictl(fs2um(rpou4tpe mfctls m rlums;t) ltrifcto1fmtr nvsl( srtr(o iodlleemivt sfaDua(rp;u1aleoif3iysfa eaums;u4artnxrcoodoa elivo ()s2xmxrpou4llt mfct ( aruaumonu1texnifetlsfmDrm(vs;t0arenmf3ootlatrlneslt)texm(mpio4ll n ici (fa2ur(mono0aptnifciadfmDel(vp t) rtomr todlmDelnvsls)srtm(o3ny4lm  mfes t) Drrxmonu1tpx if3tadla rm(von()trtoxr totfmDrlieols tetrxopny1om elicsl( s2ra(ro;u4tleomf3iltls um(vo t)tlenmf io1omDrlneo s0t2trimpoo1lmtn nvtls)a2urxrooo1aee  o3tlsfs2rlu pn(4texnxr tatom r i sls0 rtoxo3ny4omtnmiesat sDrmur nt4aet mo3ils m2ulnmo t)aexnmoctydoa eluei;()teuo(r3oo4ap nmnvsas) Drm(mont4aeeniieiatlm ua(msnu0 reomo oy1la eli ol()s2xo(o3iodam elicslt aDta( pno1oexnmiciadfs uan s;u4areoif iydfmtran ols  exmimpnu1lpe lfetas aDrrxm no0teto o3iltls emuvo;t)aetrio io1lm ranes ( s2trxm ou4am nmnvi ()s2umxmpnt0oeenif3tltfa2ra( pnu0 rermrciytomDelnvo;s) rtrxr3ou1ameelfvsls)artmurpou4tlxo fciadls rln o;t4aetrircio1oa rai il()srtr(opnu4lptelivt (f rta(r oo0opxomieiys s2eau on() lxrxo iydoatr ieslt) exrim iu1ope mieiatf Dtmx  ;o4opto ociatfa2uaumsnt0tetoif3todoaDeaivo;s0srur(opoy4omtemneias  Duaur nt0olx ioctydlsDrmn s t0 renio3tytopt aueolt0trxoim3no1lmtnlfvtas)s2urxroot4olx  iciad m uau o u0 rxrmo iytlmDeauvi;s) 2umio3iydapeemfeiat aDua(mpnu0alx  fciydlmDulu sn(0 exrmrctydfaD  n ils) exoxrpoydamt  iesat sDtaxmoou0opeoiociatfa umuvpnt4trenio oa1faDelieo t) etoxrpiy1lltnmnct sfartaxrpnt0teen i3tlsfaDumnmon(0 etrmf todlaDr n ilt trxoio3ou1amtemiet s aDtmu  ;u1apenmi3ilt m2eauvp t4artrxfcoodfm r n ils0srxoiopny1op  lietl()s2tmurpot0alt iiciydls2rau s u4tetnir3to1omD an ol(  exr(rpny4lmeelfetas a2urx  ot4oleoiiciytls2eln p;()tetnxrcoydoateln s t setmxo iy1ame mncils  rtrumoou0oeto feiltla2em(ms t)arenxfciytfm ran i;(0seuo(r3iodlptnmnvs s sDraum oo0aptniiciasla2ea(vsnt) ltomrctytopDr u i;( sexmxm io4lltnmnes ( sDtmurp;t4aet  fciytlm rl( o;t) lxnmocta1optrliesl(0 exrxm no1optemfcslt  rtax p;t1tptomfciaslaDrln s t4arxriocio1lat luvi s t2urir no1ape livsl()sDrmxm ot4oetomocilsfs elumonu)texriocoodomDeau slt setmxopiy1opt lfes t)artrurono4tptomf3tyt m2rmu o u) rtrif todlmtelnvi t0seuriopoo1lltelnetlsfaDtaurp;o4oetnmfeiyt sDumnvo;t) ltnio tatfp r ues s0 eum(r3iu4oleemfvil(fs2rr(mono1aet  icilt a emnms (0tleomfcty1op rlnei;s  2tmxmpnu1lp   nctasfsrur(mpno1oet  f3iadfm2eanvp;t4 exnircoydoateanvols)teur(m3nu4ape  feta( aDumxm nu4opxo i3ilt m2ul(von(4teeomo oytfat lnei t)tetrxr3oo4lptn nctltf Dtrxrp;t1tlxnmo3tasla2elnmo (0 exnxf ootfat lnei s0texoiopiy1altn fvsls) Dur(monu0aptn o3iytfsDrmnmp;(0treoir todlm eau ols t2xoxr oy4ap  lnesas sDtr( o;o1teeomi3iadls2rluvo (0tlenifctotfaDean i t teurir3oo4oltnlies s sDrmx  ;t0apxn iciltla emnvo () rermf3oytlmtrlu s s s2umir3iodlpeelnes (fsDtrx pou0opxomoetytla2raums;()altomo oadlmD aneil()srtm(m oo4om elnvt ( s2tm(rp;o1alxnmieiydfaDrl( o;() eerirciydfpt  ieil(0 etoxo ou1ame mncslsfsDta(rpou0tee mi3iad a ean p;u)texrmo3oadfpDeai i;t srumxopoy4ol nmfes sf 2tm(ront4aetn f3iltlaDum( pnt)alxoxr3totopt  u i s0srxmim3oo4ll nlict s sDraxmoou4tpe mi3iadlsDrmnms;() ltrxo3iytopDe uvi s0teurxopiu4olenlfeslt)a2urx  ;o1tex  fctasfs uluvo t0 etrxr totopD  ivo s0 exo(r3nydal  lics ()a2tm(rono1tpe  f3tytfaDea(vonu)aeerxrctydoatraivils0 rur(r3oydom  lfci t) 2trumo;o0olt iiciatfs2umnmsn(0altrmfcoytoaDeaies t0 ruoxr3oo4ol emieias  2tau  ou1tlx mi3iatls2em(mont4trenxo oo1opteau sls0 rtrim3io4lpeemfvilt a2urxmooo1alenif3iyd s em(ms;u)texnmf3oadfpDrauvol(0 exmiopiodal elfetat)srraurpnt4optoioctlsla em(mpn(4tlxrxr iatfmtr ivolt  2tmir3ou1al elieslt)sDrru p;o1olxniociydfa2rmn pn(4tlerxocootfpt auvs;s)t2tr(opno1llenmivilsf Draxm oo1tet mociatlm2um(vo u)trxrif iydfpD ai o s0 2xr(rpou4omen nvi sfartrx pnt1ole mfciytfmDuanvo t)aleomo tatfate uvsl(0teuo(o3iodlleemfcs ( a2urxronu0aeenioeildls rl( o t4aetoir3io1fmD auvs;()setmxm iodal n ivi t arurumpou1tpe mi3iytfs2ea(vonu4alxomr3iotlmte i i;( setmxo oydole lfet tfsruaxrp;u0aexnmoetadfa umump t0trxoxocio1lm e uvs;t seurim oydom nlnvt t)a2rmumo;t0oet  ieild s ea(vo;u0 ltrirctodop  livi;t0 exr(rpiu1am n nvsls)arraxmont1alx  fciatfm ea(ms u4alermrcoy1lmDr nvo t)s2to(o3oo1lltemiet t s2ururp;t0oltomoetydfa uanmo u4aetrmo3tytopDeanvsls teuoirpnu1ll n ietltfs2ra(ronu1ole  fetasfsDrl(vont) etnir iytla eliesls0t2xoim3iy1lleelivtltf Durur oo0apxomfcild m raums;u4aetomr iotlpDe n i t t2uoxrpoo1om e fet () Dtaxm no0tee iietytlmDemnvp t4aetoif tytopt ai s s seuo(opiodam   ies (fsDrruro;u0apt  icildfm2ul(mo t4 lxoxfciotfmDrau ils0 etr(o3iy4lp nlnvslt a2trxmpot4altn fciltfs2uaumo;u4tleoircta1fmteaues;()t2um(r3ou1apenmneslt sDumxroot0ape  i3tlslm elnvo;(4arenxrctytopD luvslt) 2xo(m nodll emncs ()aDtrumpnt1oltomociad sDea(vs;t) ltnmoctydoaDr i i;t0t2urxm3oo4lleemietat) 2tmxmp;t4tetnii3ias aDranvp u0texnir3oatomtelnvilt s2to(mpnu1amtnlfcsa()aDuauro;u1tlx miciltls2el(msn()altnio3oodop eanes;t t2tr(m oy1ame  neils)arrrx  ot4apt iicild a ua( o (4 ltoio3iydopte ueolt srxm(opou4om n fvslt  rrmu pot4tpe  ictldfaDua(vsn()tlenifctatfmtrai o;s0srtoim3iu1lpe mivsa(f Dua(  ;o4aptoio3tatlm2uanms;()teeoxo3ootlp e nvs s) 2urxm ny4apee fet ()srrrurp;t4apeo fciltfsDrmuvp;(0 renxocta1fmte uvs;(0 rxmxm io4am   ieilsfs2rmu p;o0oeeoif3iasls2umu s u4trenxfcootfmtr nvi;t0trtrxmpiodlmtemfcilt sDtm(rooo4oex io3iatfsDranms u4tleomocoydfaDeanei t0trxrxrpno4opeemivsl()sDrr(rpnu4aeen feils s emumpn(0 eerxo3iytfa e ueo s0s2toio3no4opee fcsl( srtaum nt1aexn fctytfmDrlumon(0areoxrcty1faD  ieols) 2to(m oo1llenliet (  rrrump;t0tpen ieiaslm um(vo;(0aexoir3oodoa  aivs t0s2tmxm3ny4lm  mici (f 2tau oou0aeen o3iytlaDrmn o () lxoif iodlaDr nei;() eurir3iodal  mnetltfaDrrumpnt0olto i3iltfs2rmuvpnt0altoifcoy1oaDeai sls0 2xrxm3iu4om  mfeta(fsrtmx o;u0aet ifciasfs2em(mont0trtoxr3oytfm eluvils teumxo nu4omeemiet s) rtmxmonu0tpx moeilt a2ea( snu)arxoxf oydoa eauei;t)trxrirpoy1lptnlfcia(fa2rmxr ot1oex  ictltfa umu s u0aeermr3iotfmD li s (  2tr(r3iydoleemivtlt) Dur( o;u4opx io3iatfa2em(mo (0 eermf3oytfatrai ols)t2um(r3nu1lpeemivtat) rtmum ou4aeeomiciad m emnvpnt4 eermrctadoa rln s;s0t2trir3oydomt mnes ( s2rrx  ;o1tee mo3iltfmDrlu p;u0texoxo3iadomtraiei (0 rurim3oo1lp emivtl() rumx o;u1alxn i3ilt m eanms;u4trtoxf oadomtraues;s)sexr(mpnudlmtnmfci ()aDtmx p;o4aee mi3ildfs2uln s (4tetnir3ia1fp   u o s0 rtmio3oodalen ieiatf Duauroou0tleomoeiyd a um(msnt4tltomo3tydoaDeaies;(  2trio3oo1al nlnviltfsrumx  nu0olxomi3iasfm2uaums;u) etnmocootfmDeaivolt  rurio3no1optemnci (fsrtaxmonu1tlxnioeiltfs2ua(ms;(0 lxrxo3iotfaDelneils0t2xrimpiu4op emict s  ruaxrpoo0optn ociadfmDuau ont0tltrxo oy1lpteli i;t0truoxr no4oleelnvtls)artax ooo0tpt if3iydfa2em(vs;(4tltnif tatfmDeli s s0s2uo(m3oudlm  lnetasfa2tmu poo0optn ietldlsDeau pn(4trtnmo totfa  auvo () etmir io1alt lieilt artr(m ot0tleomoeiadfa2uauvont0tetoxf todfpDraies t)srxrxr nodopeelictasfsDuau  ou4oexoifeiasfaDeanmo;()tetrif3oo1omD ai sls0setrio3no4aleemfvsasfartaxr ;t4apxoiietadfs rau onu0aleoif3to1fpt li ils texoio no4opt  ietat) rua( p;t0tptnmfeiytlm2elnvs () etrio3todlpt lnvils  2xmxm3oo1lmtnmicsas)aDtr(r ou4optn fciyt s2rm(vs;(0arenioctatlp  li sl(0trum(r no4alenmfetls sDumur ;t1tleo iciadls2um( s;u0alxnmrcoadoaD au o ( t2toiopiy1olt mivtat)sruru ono0openmieils m2rmnvp;u4trtrio3todlpDelneilt seur(o iodllt  ivsa(fa2rm(rpno0oeto ieiytfa eaums;(4tetoif ootoa rlu s;t)setmxopnudal  livsls)s2rmu onu4tlx iieiltlsDrmnvo;t0aetnxr3to1fmtelneils)truoir oo1ome lncilsfsrumx o;o4oexnif3tad a rmumo;u) exomr3oo1fp eaiei t0s2toir iy1apee ncilt arrrxmono4olxn ieild mDrauvs;u0arermf oa1lp ranvslt) 2tmim3oodaptnlnvia( sDumx o;u0aetoiiciysla2rmn o;t4 eenxr oytfpDrluvi;t0trum(o nu1lm n netls)arrrx o;t1ape mi3tas aDrmnvs;t4 rtrmr tytfaDelieo t)setmxopoudaltn nctlt)aDraumpot1texoiieilsfm rmnmpn(4aeeoxr3oytlpDe i ols) 2xmimpnu1lp emncs () rurum nt1oltniietat mDrm(mp u0 lxnir ootomDe i sl(0 exrxo3iy4ape mfvs tfsrurxrp;t1teeomfciadla2umump t4altnmo3iadom   nvsl(0t2xmxm ny1aptelnctlsf 2rmuroot0ole ii3tlslm ul(vs;u4artoxf3tydlpDelieo;(0setrxr3oo1om e ivtls)s2tr( p;t4aexnmi3tltfmDrm(von(0 exnirctatlat  n ol( trurir no1opeelnctls  rrmx o;u1tltoifetytla2ul(mon() lenxfcoa1oaD lues;s) 2tmim oy1om elivtatf 2ua(mo;t4tpt  oeilsfmDeanmon() leoiociodfmDrln i (  rxrxo iodom emnvsl(fa2trx  ;o4altn fetlt mDrm(mont0aeeoxf iotopt ai sls texmxm3iu4op   ieta( arrax pnt1oetoifcildlmDulums;u)trtnxociatlm  lu i;(0trto(rpnu1ope livi tfsDuaxmpnu1oltomieiytfm umu pnu4trermfctotfatean s;s  rxr(m3iu1optn nvt s artm(  ;u4aptnmfeiydlmDuln o u0trtrmf3oydopteaivo;()seum(m ou1oleelivia( arta(  ot4oee ioeild aDrau p ()tltnmocta1laDeln s;s s2xoxm3iy1ome  fvi t arurumo;u4optoifetadls ua( p;u0alxrio3oa1lm   ivi s0 2tm(opno4oltn ncsa()s2taxrono1ope  fctld s rmumo;t0trerxf tadfat aivs ()s2um(mpoudlltelivs ( arumxmp;o1olenmiciys m rlums u)tlxnifcoadlmteaies s)t2trirpno4olenlfcsatf rumx o;t4olxo ieiys mDelnvs;(0aeeoio iadfa elnei;s trumir3ny1altn fvias)aDtrx o;t4tetoiociytls um(mo ()alxomociatfm  lneolt s2to(mpny4lltnlfci (fsrrmxro;o0ale ifeiatfm ea( o ()teerxfciodla  lneo s s2urxm oudomen fet s  Dum( o;o1optnmo3tys a2eln snt)tleomo3iotlmD  ivi t0s2tm(o3no1omenlnciltfartmur oo1aeto oeiaslm emnmo (4 lxnircoodfat au s s0 rxoxo no4lm e fct tf Dtmxrpno0teenioeiydfs umu on()trenmrctytlat lnes;s) 2urxr no4alteliei (fa2uax pno1tptnmictatlmDeauvo () rtoio3oy1fm rlnvil(0t2ur(r3io4apte iciasf 2rmum no0open o3tydfm2emu o (0alxnmo io1la e ivi;t0 etmir oo4lpe mncsas arrrur ot4opeo i3iydlsDrau sn(0alxoio3totoptr nei t0 eumxopnodap elicsas  rtrxmpnt1olx  fciat mDumuvon(4 etnxo3oydlpDr n i;()sexm(m3nydapee nvt ()s2rrx onu0apeoifeiasls2ua(vsnu4aetoio ta1oa rauvol( tetrxm3oy1oltnlicils  2tm(m oo1open f3iltfmDem(mo;(0tltrxf3tydfaD au ilt sexmim iydal e ivtls)aDrrurpnt4texn fciatfm em(mo;t0altnioctotfp rauvolt0texmxm3oo1opte nesl(  rtrxrp;u4oleoifctltls eau o;u0arermrcootfmt ln ilt  rxrir oudll  lfvsasfa2uax pnt4tptoiietatfs2elumsnt)trxoif to1fpD  nes ( trtrxopno1altemnvtat)srta(roou0openmo3iat s2raumsnt)trtrxrcoatop r uvi;t) rxm(rpiy4open fvilt) Drmxr ot4apx  fcilt s2uln s;(0alxnxf3oadoa r uvils0sexmim oydlle  feslt) Dtrx ono0tetn ieiad s2elumonu0tetnxo3iatfmDr ueils0trurxo3ou4llee fcilsfs2tmx  nu4olt miciyt sDul(von()texomr oy1fpt auvs t0 eto(o3oy4ll  lfvils aDtmurpoo0tpeniictat s rmnvp;t0tetoxocoy1lat ai s t) rtrir io1lp nmiciasfsDtmxr ou1aptoif3ils a2um( o;t0 lxnir iy1lpDrlieo t) 2tmxo io1lme lnvt sf 2tmurp;u1oeen fctas aDem(vo (0aexoxfcio1om rlies;s0t2tmxo3oy1omtemieiatf Dtm(r oo1aptn icildfsDemnvo;t)altrircty1oaD ln o;t0 2um(mpiy1op n nci () rtaxrp;o0apt io3tlsfa2ra(monu4tltnmf3totopDe ivol() exo(m3iy1ame lnctat)s2rrxm ;t4aetoioetyd aDuauvo t4tetnxo3tatoa  an s;(0texrxm io1am  lfctas  Dtmx o;t1texomiciydla rm(mp;u4alxrxf3iatlptelueil( srxm(m oy1op n nci sfaDrmum ;t0teenio3tatfs eau p;(0arxrxo3tadoatr nvol()srtrxo oo1al emfcils)srrr(m ;t4aleo fetlsfmDea(vp;() etnir iatoaDe uvi t)s2trir3nudal nmfeta( s2trurp;t4altomi3iydfa2ulnvont4 ltoxr3iy1op  luvi s srxmxrpio1lpenmnes s)arur(rpnt0olen o3iyt a rau s u4 exoxr oatlaDrai s;s0t2xmirpiy1olenmneiltfaDumxrpou0optomo3tytfa eanvo;(4tetnmf3tydfmD  neils0teurxr oy1ap elieilt)sDrm(  ;o1tptomiciasfa ranvsnu)arermr3tydlaDelnvo t) 2urir oodap nlictasfs2umxro;u4opeoifetas a ua(vo;t4 exrxr ootla rluvo s  2um(m nu4lpt  ivilt  2umxrooo0tetoifcildfs2eluvs;()arxnxf3tytop e uesls0 rto(m ny1oleemnesa(farrm(mo;o1tex if3iadfs um(vs;(4aexrxo to1omDrli ilt)srxm(o ny4lm  lneiatfa2rru  ot0apt mocildla2rmu o;t)altoxr3iatoatrlu s s t2to(opny4alenlfct s  2urxroou0apeomoctadfm2ea( on(4tlxnxocto1opDr i i s trtoxopnydope livta( srra( ont1olx  i3tat s eau o;u4teermr ta1op e ivi t) 2tmir iydal elict sf 2rm(mpno0alx mocilsls2umn s ()tlxnmr tatlm eln ols t2um(r oo4optelfciat sDuaur no1opeomieilsfm2elnmp t0arxnxfciydomtranes;s  rxrio3nu1ll   nes t s2ur( o;u0texomo3tydfs2eau snt4arenif3io1laDrlu o;(  2tmio3oo4lptn nvs ()s2um( ono1aetomietaslaDem(vs (0tltrir to1lpt liesl( s2xoim nu4om nmivil( srumurpoo0ole io3iys a2elumo (4teeoxfcta1op elnvi;( t2uo(m iy1altemneil( a2urxr ot0apxo fciasfa2ean o u4arenir oydlm elivsl(0 rxr(o ny4lltemnvtasf 2tmx pno1tetnmietasls rmn p;u4tleomo tadoa r n slt)sexo(o3oodom  mnvs s)s2rmxmo;u4tpenii3tltls2rlnmsnt)alxoir3oytom eaueolt  2xoxo3no4ameeliei s sDrrxr ot0oee mfctadls ua(ms;(4 eermocoo1lpDeanvilt0 rxmxo oudol elncsasfa2tr(ro;u0tex ifcias m el(mpn() rtoxo3oodoate u s;t0sruo(mpiy4oltemneiat artr( pot1tpxn i3ilsfa ra(vp;u)tetoir todfmDeli i;s  2uoxo ou4ol emivsls) Dtru  ;u4aetoiieiyslsDrm(vo;t4alxnio3ty1lmD lieil() rxrxrpnudaltemnvtl() rtr(r ;u4aex io3iltlm elu s u0aetrio3iy1fp ean s (0trur(m3oodope mictls) rta(mpot0aex mf3tas aDem( p u0trerir oadomtr i il(0 exm(m3iu1lle lfcslt)s2tmxroot1tltnii3tasfm2ua( ont0 rxrir3io1omDeluei s  2xo(r3iudlpe miesls) Drr(m nt1open oeils mDul(vs t) rxnxf tytomDr nei s srxm(o ny1lp n iei (fsDrmx pno4tlto f3ildlm2ea(vp;(0tlxrxocoytfpD lnvi;s0 etoim3ou1apt miesas  Dtrum ;t0tleo fcildfs ulnvs t0 rxoir3tytomD lueo t t2urxmpiy1ameemfvsa()aDta( o;o1tpxo ieiatlsDemn s;() exrxr3iytlpteaivo;t s2tmxmpnodlmtnmfciat a2tru oou1aexoii3iytfa ul(mpn(0 rtrmr oa1lp rlies t  eumxr3oy4al nmfcias) 2tm(m no4oeeoifctltlmDrluvpnu0trtrxrctydlatrln olt0 2ur(m iydlle livt t)s2rmxrpoo4alen fciyslaDeluvs (0altnir3oadom ean s t)s2ur(r nu4ope mict s)srrmumpot0altnmi3ils sDemnmsnu4 leoirctytlpte uvi t) 2ur(r3oy1omtn nciltfs2rmxr nt1openmo3ildfa2ulnvp t) rxrxo iodlm   i slt)sruoim3nodope mfvilt  rur(mpoo1alt  ociltfm2ul(vs;(0alenmo oytlm eli o;s s2trirpno1aleelnviatfsrua( pot1opx mo3iatfm rl(vo;(4 reomr3oa1lp rlueo s  eto(r ou1optelnvtlsfsDtax pnu4apt  oeiydfmDum(vs (4 rerif oodfatelieilt  eumxm3iy1lm nlivsa(  Drrx  nt4olx ifcilsla umuvo (0tlenif3oy1opt  u i;t0srumxopoodlleelieilsf 2rmur ;t4olto oetadlmDeanmo u0 rxnioctodoaD aivolt trur(o3iu4lptnlfcta( a2ua(r ou4tpen oeiytla em(mp u4 ltrmfciytlp   uvs t srxo(mpou1opte ivilt)sDuaxmpno4tetnmietlt mDulu o t0trxnir3oo1la rlues;s)tetmxo3oo1amt lfvilt aDua( pnt1oex mieiydlsDelnmo;u4altrmf tydlmDrli o;s  ruoim ou4olte iet sf 2urxr ;u1opxniieilslmDea(ms ()texrmrcoatfaDe ivo (0seumxm nu1lm emies tfarrru  nt0opeo f3tltfa emu o t0altrir iydoa e ueol(  2xr(rpoy4lp  mnesas)s2tm(ro;o4oleo o3iysls raumo t)alxomocto1lpt  n s;t)trtrxmpoy1ap  livtatfs2trurpoo1oex ii3iytlsDeln p t4arxnir3ty1la  ai sl(0tetoirpiu4opt  neiatfs2taxr ;t1aet  icilt m rl(ms;t4teeomrciydoa  luvo t s2trxopiydap nlnctat) Duaxmpou4tpe mf3iltfs em( s ()artnmf3iytlpD luvo;s0trtr(m no4opeelivsl(fsDrrxr nu0apxo fctysfa2el(mp;u)trtoxo ootlp e nvo;t) 2trio io4al  lnvil( a2trurpot1ole  fciltlm ea(vo;u0 reriociatfm rauei;t) rxrxopiy4llt  ivilt  rrrx  ;t1tetnmfcils a2ulu p () rxoxr oatomt  u slt  rxoir3no4altn iciasf 2uaxmpnt0tleo ieiat m eau o t4 lxoxo oy1om e ueo;(0s2tmim oy4am  lfvias a2ta( onu0olx ii3iysfm eln s;t) etoxo oy1fp   u slt srtm(o3nudlmee icsl( srua(m ;u0oeeoiieilt a rm( s ()treoxr3ootoat  ivo t0t2trxm oudlltelfes sfsDuau onu4tlx  f3tltfm um( snt0 eeoxr3oadomD  n i t)srxoxo3nu4amt licsas)aDuax pnt1apenmf3ilsfs rm(mo;u4trtnmo3ta1fmDeaneo;t0 2xrxrpnodalt lfci s)artmxroot0apen ieiadfa2rl(mo;u0 rerircoo1fm   u sl()s2tmxm oydopeemnctl(  Dtrxro;o1alto f3ils a el(mo u0areoxrctodlaDe n i s sexrxm ou4ome mivi t srtmxrpnu4aeenii3ilt s2uan pnu4aexnxf3oa1fpt aiei (0teur(m3nu1omeelnctatfaDuru  no0tlx moetaslaDrmu s u0trtoxo3oa1oa  aneilt)seum(o iudalenlnvilt)arumx pou1tlto ictltla ul(vsnt4areoir3oodlptranes;t t2uoxm3ny1opeemfeia(farurum ou1tpxnifeils sDul(vsn(0aexrio3tytfatrai s;s0setm(o3oy4omtn ietls aDtrxroot0aet  iciyt a rm( ont4tleoxfciydlm eaivi;(0setrim iu4am e fcsls  rtm(m oo0tpen oeiad a ul(msn()aexnifcoatla rau ol( t2tm(o3iy1op emncsl() Dra(m no4tetnmiciyt s2rlnmpnu)tetomr3oodfaDrlues;s sruoxopiy1ll n fet t) Dtaxmpot4ape  ieiytlaDum(vs;(4 exnio3totfa r ies;(0 2tmimpno1omtemivias)sDumum ;t4ape iociytfm2rlu pn()treoxrctadlpteau i;s0s2urxm3oudal nmfci (farrru ont4tetoioeild a ulump ()alxoxo3iotfm ranvs;t0t2tmir3iy4om  lfcsas) Dtmxront4oet miciltfs2uan pnu0 etomf3iy1omteaies;s  euoxr3ny1ll elfetltfaDtm( oot4oet moctysfmDea(mpnu)trermo ootlaDrlieo s t2xriopou4al e ivtlsf 2uru oou1tetnifctat aDem(vs u0aeeoifcia1fp  ai o s teum(r3iydlp  lfciat  2urx p;t0texo octls s ra(vs;u4altrxf tytfpt  u o;t0texoxopoydlpen ncsat)s2rruronu0open ieiaslaDuauvpnt4 ltrxocoydfmte nesl()t2uoir nu4op emivtls srrmx  oo4ale ioetldfa rm(mp t0 lerif3oodop e uei s  2tr(o iu1lmeelfvias srrrxmp;t1aeeomfetat s rmnms (0tlerxociotomtean o t0s2uoxo oo1alee nvsa(f rum(mo;t4apxnmfeiydlm uan p;t4teenxo3iydla   ieils srumio nudopenlnciasfsDrax  oo1tlxn f3iatlm rl( p u)tetoxf iy1lm elu ol(  rtrimpno4lp e fvi (fs2rmxront0aetn f3tlsls uau o;t4 rtnmf3oodlp elu s ()seur(mpnudlle  ieil()s2umx ooo1apx  fctltfsDraump;u0alxrxr to1fpt an o;t) exr(rpio1ameemieia(fsrtax p;u0tex mo3tls aDuluvo;t4arxnxr oy1fmt  uvs (0s2xoim nu4olt  nct t artru o;t0tex  octydlaDua(vp (4 renxo3ootfpD  ivo s teurio3oy1ol n iesls) Dtmxrpot1apt ifeiltla uau p;(0arxoifcoadlpteli slt)sexrxr3oodlle  icsa(  2trxro;o0aexoiiciad s ua(ms t) lerio todlmt an sls  rxr(r iudopt  fesa() rra(m ot1tltnif3iatla2elnmp u)tetoircio1lmtr nvi;s0trur(m io1alenlfcil() Dtmx pno4teeoifcias aDuan pnu4 reoircto1lp   uvs;t0s2urir ou4lp nlict (faDtaxroot1optoioeiatfa2rmn o t0 ltrxf ootlm   n i;()seuoxopou4amt lfcs t s2tm( pou1ape mf3iyt a uln s u0trenmfctadlmt lies;t setoiopoo4ole mnvilsf 2rr( ont1oleomf3ilslaDraums;u0artnmr tydoat aneilt) etmirpiu4omtemivsls) 2umxrp;o1tex  feiltla elumont0arxrmoctadfa r u i;t0 exm(o3nodap nmneils srurum ;t4oet mfcilsfm2elnmp u)areoxr oy1omtr u i s)srtrimpoo4olt mictas)sDtaxm no1tpxnmieiys s2rmnvsnt)texrxr oytfmDeanvols  exmxrpno4opt  ietas) rta( pnu1olto fciyt a2umumon() rtrxf3oy1latrlneo;() eur(r3iy1ap nlfci s)arrmx ono4olenmfctas a uluvp;t) rerxo3oydfa rlies;( srumio3oodlltelfvsasfarrru oot0opxoii3iatfaDulu sn(4trxnmo3oo1lpt  u s;t  2uoxopio1oleelfcsatfsDtrurp;o4opeo f3tlsfa em(vo;u4 rerir3oodoa  luei;s)t2uo(r nudal nlfes s)arua(rpnt1alx mfcildlm2rl(vsnu0alermo todfmte nesl( srxrio io1ame mnvs ()sDtmxrpoo0aet  feildfm eluvs;()arenmo3ty1laDe ieolt0t2to(rpnodalt miet ()sDtax poo4oeeomo3tytfaDrau snu0tlxrxr ia1latrln i t)srxm(rpoy4al  mfeia(fartmu oot1opxn o3iat mDem(vs u0aetoxfciy1fm  aneol(0truo(r nodlpenlnvsa() 2tmxrpnu0ole  o3iatla2rln s;(4tlermf ta1lpDrlu i;()t2xmimpny4amt liciat)a2urx p;u1optoifeiadfsDrlu s () etnxoctadopDean i;t seum(r iy4amenlicils aDrmu p;o0apto oeilt s2u
\ No newline at end of file
@@ -0,0 +1 @@
+u ols trtoim oo4lm nlfcslt  2rr(ro;u0aleniiciasla umuvp t0 etrmr3ootlmteluvils t2tmxr3nu4omte ivsas)s2umur ;u0alxnmieiatls emn ont)aetnmr3iodfaDe uei () exrxmpny4op e feiasfa2tmxro;u4oet  feiys a2uan p u0 lenmr3oadlmtrlu olt sexoim3ny4olte fcil(fsDua(mont4alxomo3iadfm rl(vpn()tltoxr to1omtrauei s t2tr(o oo4al emieslt)a2ur( o;u1tpeoiieiasfs2rm(vs t4arxnmf iodoa rlu s ( texoxr iu1oltnmfesas srua( pnu0oex moeiad a emumo u0 rtomr3iodfa eau s;(0s2xr(o3io1am elnesls srrm(mo;u0tet  ociyd mDea(vsnt4tetrxfcoatfmDeaivi t srxr(o nodapenmfvtl(fa2uaxmoot1olxn f3iydlaDrlump (0texomo io1lp e uei s)srurxm3nu1om elncs (fsrtr(  ;t1alx  i3iadfa2ra(vonu0texnioctydfaD  nei t teuo(o3ny4ape mivtlsfsDrax o;t4aex mieildfaDuaumo;t0arxnxf iodfp  anvol()trtmxmpnydalt lfcslt  2tmxrp;u0aeeoif3ilsfaDum(mo t0aeeoxfcoytfate ues;() 2xrirpoo4llee icsl( arrm(ro;t4oltn ocias aDem(mpn(0 exoif3ta1fmD lnvsls)texrxo3nudome lici t  rta(  nt4opeo f3tydlaDrmnvo t0 rtnxociydfm r uvs;(0trxriopiudomt mnvs s a2ua(r nt1tex mietyd s2rm(vs;(4aexrxf3iotfpDraueo;t0 rtm(o3ny1omtn ics ( srurxrp;u0tleo octadlsDuan pnt4tltoxrcia1oaDeaivslt) etr(mpno1lleemnvs t srrrx ooo0oetomi3iatfa2ul( pnt)arxnxf oadop elivilt0seuoio ny1olt lnctlsfsrtrxrp;t1aex  iciaslaDumn ont0trtomoctadfm r uvo t)t2tr(opnu4alenmfcsat)aDtm(mo;u0aeenmi3tasfa uan on() ltrmf3ta1fmtrai slt t2trim ou1ameemncsa(f rumu oot0oltomf3iatla eln pn(0arermo iotomteai slt trxr(r3ny1altelies s) rrrum ou1alen octyslm ul(mp (4teeoxocoa1la eai ol( srxrxm oodol nmiei ()arrr(mpoo4tlx moctls s2ua( s;(4tetnxf iatomteanvi () euoxr3iy1altnlfctatf 2rmu poo1alt iietldfs2el( snu0texoxfcoydoatrluvols0srumxo3nu4aptn fvta()srum( oot1tpeomfeiys s uanvp;(0tetoxocia1fm  au s s trtoio3iy1olte ivsa(f rurumont1oleniocias a rmuvs (0teeoxfctytlp r ivsls  2trimpoy4omtnlnvsa()a2tr( pnu1apen oeiys m uan pnu0tlxnxf todlaDelieils  exoio nu1alee nesas  rrr( p;u4tptomoetltls rluvont4 lxomr iodomteli il(0 2trxr nu4open iesa(fsrur(ro;t4oet  feiasfs ea(vp (4tlxrmo3iy1fm e uei ( trxoio iu1ol  lnet s)s2umur ;o1olxnmfeiytfm ulu on(4aetomr3oadfmDeauvsl() 2umio3oodome lfvsl( srrmu ooo1tlto oeiasfs rln pnt4trtoxf3iotlpDrai ils seuoxopno1omenmiviat  rtmu  ;t4tlto octatla el( snt) etoxo tatfmDeaies t0 2toio3ny4amtelnes (fsDuax pnt0tlx  octldfmDuanms;u0artnifctatfmt  uvols0setoxo io4aptnlnvils) 2umx  ou1oet mfcias m2rau p;(4trxomf tatoa  auvolt)t2to(rpiu1lltnmneilsf Dtrxrpnu0tpxnifctlsfs2rau on(0areoxr to1oaDeaneolt0 ruo(m3oydapeemfet ()aDur(rpoo0aptnifciatlm ranmo;u) lermocoy1fat  nvs;t0s2tmxo no4llenmfesls  Dtau  ot4apenii3tld sDra( o t4 etoxf iy1lpDe nvolt trurirpnu1lp   ivtl( aDrmx pnt0oet  fetysfm2ulump (4tltriociytlmD lueols) 2xoirpno1openmneil( a2ua( o;u0tetn octadls2ul(vp;()tetriociytomtrauvol( srxo(mpoydolen fctls  rta( p;t0tpenio3ils m2ua(vs (4 lxrxfctodomteluvi t)tetm(mpou4lpen ietltf Dtaxmonu1oetoiietasfm umnmp;u0 lxrif3iydfp eluei t0t2xm(opiu1lm e nei (fsDum( ont0apxnmieiatfm ran ont) rtomr3tydoa r u ilt s2xm(o ny4alenlicil(fa2urx ooo0oet iictatlm ulnvsnu0trxoxr oy1lm eauvolt) 2xrxrpoy4al n nvilt)sDtrxr nu4tlt ii3iatfs ra(vo (0trtrmfctodlm   nvs (  eum(r oo4ol elncsl(fsrum(rp;o1opxn i3tatfm rlums t4tleomo3to1fmDeaiei;t) 2to(r nodom  mfvtlsfa2umx  ou0olxomi3iasfmDuauvonu0tlxrio3oadlmDrauvols0sexrxo3no1lm  lncsls srta(m ;o1aeen ietltfs2elumsnu0 rxoirciadlpteaues s0setmxmpny4amenmnesltfaruru  ou0aee iieiytfsDem( pn(4aeenmf3iytomD  n i;s0 2uoxmpoo1llt mfcsatf rururpou4tleo ieilt a ra( p;()alxnxr3oytfm rauvo t)sexoim3iu1lme lietas)aDrmxrpnt1openif3iatls2rm(vo;u0tltoiocoydoatrln o s  etm(m ou1apt micilt)a2rmu p;u0optoiiciadls2emnmo t)areriocio1fp  ai o;s0srum(o oodlm elfet sfarrr(m nt0alxniociytlaDuan o u4teeoxo3todlaDr u i s  eum(opoy4alt lnct (f rtaur ot0aexoii3iydla2emu s t)areriocootlpt ai ilt0tetmim nodllt mfvil(f Drm(r nt4altnii3iadla ea(vpnt)aexrifctytoaD  ivs t)trur(rpou4oleemivta() Dta(m nt1tet mfeiltlmDrlu p;u)arxoxrcoodlaDeauvils)t2xoimpou4ol e nvil( a2ua( pou4tltnmf3iyslm rl( p t4trtnxfcoadfp  aues t0t2toxr oy4ol  lnetls) Dumxroou0tleomictldlm ean o u4aeerir3iotla eln o;t0seumxopio1lmeemnet ( srum(root1tpx  i3tls a ean o;t)aetnxfctatfpte u sl(  ruo(rpiu1al elnesas) 2ur( pnu0oltn ocilt mDelumpn(0aexoif3oy1omt  uvo (0s2xoir oy4lp emicsa(  rurumpnt0olxnmfeilslm2em(mp t4trxrmrctytoat  n olt  2xrxr3nodopt lnvt sfsrua(m nu0opto iciasfsDel(mp;u4tlxrmo iadlaD lu s;(  euoxrpoydomen nci t a2truronu0oee iociadfsDuanvo u0aetnif oadoaDean o;t0t2toiopiy4ll nlivta()artaumo;o1ole iictysls2ulu s;(0tltnmo3ta1lptelivsl()setmxo3iydom emncilt) rtmu pnt1tptnifeiatfsDuan snu4 rerio tatlpDraies s) 2uoimpoo1lmeelivtls)aDtrxmp;u0aeen fetyslm2ulu snu)aexoif io1omtran i;()sexo(m3no4ol nmnvsat a2rmx  oo1oleoifctyslaDemums;() rxoxrciadlpt lieil()teumim3nodaptn fet t  2rm(rp;t1tetn iciadfaDran snt4 rtnmrcty1fpDranes;t0tetmxmpio4olt mietlsfaDumxroot1apxnioeiyt m rau s t0 eeomoctatfmD aueilt) 2tr(o ny4oltnlnes tf 2rrxmo;t0olxnifcils a um( p u0teeomf tytfp  ln i () rxmxmpoy4amtelfci sf 2tm(r nt4tpeomictldfa em( s (0 exomo iy1lptraues t0 rtoio iudopeelivt s) 2rr(mo;t0alxnmieiyslmDranmo t0arxrxf io1oateaueo;() 2uo(m iu1am  lfesl()sDrru onu1alt  o3iytfaDrauvo;()alerxf iadoaDran o s  2umxo3ny4ap  lfet () 2rmu pno1alx  octlsfmDum(mpnt0arxnxo3oa1fat aiei;s) 2xr(m oy1om n iet tfsrrrxrp;u1tex iicils m ean o t) etrircoadlp  livs t tetm(m3oo1om   fctl()sDumum oo4opt  iciys aDuanmo;t4tleomr3tytomDr iei;( s2umirpnu4ame mneia( s2urum ou0tlt mictltls ulumsn(0tetnif oodop eln i;t)setmiopno4op elfcia() rta( o;o1oee  ieiysfaDrauvp;u) rtrxr3ia1laDeaivi t) 2ur(opiodolt  nvta()arua(ro;t4alxoiiciydfaDean p t) lerir3iytop r ivol()teurxm io1op e fesasfaruax ono1tpto oetadfaDranvp;t)trtrxoctytfaDelivi;(  2ur(m3ou1al emicia( artrx oot4oeeomicildfs elnvp (0trenmr tatlateauvi s0srtr(o3nodlp nmfes (  Durx onu0ole  i3iysls ea(mp ()artnxfciytoaDeln s;()srtoxm3iydoltnlnet t) ruaum ;u0olxo ieiydlm2rm(vs ()aexoxr iy1fat livsl(0srurimpoodome lici ( a2raxr nt1alxnio3ilslsDrmnmp;(0arxnmo3tatlpDr nei;s0s2urxopoydape lfvil( a2umumpoo1apeniociat a eln s;u)trxomrcty1lmDe i i;t) rumiopiy1al nmietlt)aDuau ono1oexnmfeiltfs rm(vo t0tlenio3oy1faDeln s () etoimpno1op nmfvia( sDtm(  ;t1opxn ictas s2emn snt4aeeoir3ia1faDean s;t srxmxm3ny1ll  mietls)sDrmu pot4opxomoctltfs um( s ()trxrircoytfpteluvi ()s2uoxm3nydom e ies ( aDuax  nt0tptnmo3tytlaDrlnms (0alxrxo tatlmtelieo;s0srur(rpnu4op  lncias) rra( o;o4aet ii3ildlm umn p;u)texrmoctydopDeauesl(0truoim iy1op  livs (f 2taxm ;u4olxnii3ils a eau snt)aexnmo3oydfm rauvo ( t2toxmpoy4ame  fet t)artr( pot4olt  i3tyt s eaumont4aetomrctatlmDr n sl() rxoxr3nu4lm emictat)s2rm(  nu1apx  ocildla2elnms t0 lerir todlmD ln olt  euoxopoydome mfctl(faDuaxm oo1tlxo f3ildfs2ra(mp;t)alenmf3tadopDr ivi s)setrxrpny4op e fesls sDrm(m ot0ape ioctlsfs eanvs;t0arxomo oa1fm e nes (  euo(o3iu4altn ies s)a2rruroot0aex  ictldfm2em(vo t4 exoxrctotfp rluvi t)s2toxo3oodolenlicsl(f rrrxrpnt0ope iiciad s2rlumo t) lenxr oodfmtr uvo t0s2to(o oodomeemnvias)arraumo;t0apenioeiadla ulu s u0trtoxf oy1faD ai sl()s2to(rpny4lle mfetl()aDur(  nu1texo oeiys m2umu pnu0aetrmo3tytlatrai o s  etoxopoy1lptelfvs s)arraxmp;u0tle iicilt a eluvpnt0 etrmocoatoaDeaneo;t)srxm(mpiy1aptemiesl( aDumumpoo4alx iociaslm2el( s t) reomr3todla  lu o t  eumimpio4amtemivils)sDrr(r ;u0apt if3tldfaDua( ont4artnif3iytfm r nvo;s teumxr3iu1ap nlivtlt) rrm(mpot4tle ifeiydfm eau p;(0aexoxrcoa1laDrai sls)s2xriopno4op emieil(fa2tax pnt0aptnmoeiysls uan p;(4aexomf oatlp  ai ilt texm(opnu4amtnmieils  2rrxm ot1apen f3iltfs2el(vsn(0 reoir3ty1oaDrluesl( texrio3oo1lmt lfvt s aDumuroou0opx if3ias a2raumo;u0 eerirctatfmDe iei;(0 2trxr3nu1om nmfvi ()aDrmumo;u4aex  iciadla2emnvonu4 ltomocoo1fpt  u s;( s2trxo3nydlle lfvslt sDumu oou1tet moetydls umump t0 lxoxfciytomD anes;t sexmxo3iodlmt  fcsas) Drmur no0tpxomiciad m eau o;u)arxoio totoptean o;s)s2xoxo3iy1lpeelnvsa(  2ta(root4ole iieiyd mDuauvo;u4arermr oytop rlu sls0setmiopoodllen fvias) Dumump;o1oexn o3tatla ra(vp;t) lxrmr oa1fp  lies;( s2umxm3nudam  miei sfsrtm(r ;o1aexomiciatls emu s t4 rtoir ootlpD  u o;()texrir3ny4apt lnes tfaDrrumont4oetomi3iydfs2umums;u4artomo3todoa e uvols0srxoxm iu1lmenmfcsa()arrm(mpoo1opeomf3iltfm emump ()trtrxo3totfm rauvs;(0 rtmio iodopenlneiltf Drm(mo;o4tpx  i3tydlaDeanmpnu0tetrxoctytla r nvo;s0srxrio nu4opt  ictas a2uru  nu1aeenmi3iasfs rl( p (0 exnxr iotlat an o ( srurim oy4omtemietls sDtaur nu1alenifciltfsDuluvo u0 lxnxf iydfaD  n i () 2tm(rpnu1llenmncsatf Drruro;u4altnmfeiatfs ul(mo;()trenmf3oadfm   i i;t) rtm(o nu4al nlics t)aDtrx pno0oeeomi3iydlmDean s;(4aetnxr oytomteau sl()sexrxr3iy1alenmicilt)a2rrxmoot1oeeoiicildlm ea(mp (0artoifctydfpDr neol( t2xrxm iy1op nmnciat)artm(r ;u1optnio3ilt m emnvp;u4treoxf3ta1omt lieo () 2urxrpiodlltnliciltfaDumur oo0opxomiciatls2ulnvo ()tlenxf tadlp elu il(0teur(opno1amt  fvsl()sDtru p;u0tpx  icilsfs2eauvs t) lenmf tatlmDe i i;t)t2um(rpnu4ope  nci () Dua( p;o0tlx ioeiydlm2uauvon(4aleoxr3oytlaDeai s () eto(opnodome lnesas  rta(rp;o0tlx mf3ildlm ua(mp;() lxrir3tytfat  ieils) euoxrpoy4al   iei ( aDrrumono4tle mi3ildls ean snu) lxoir3totfmD  ieo s t2toir iu4ame mfvsltfsDtrxm ;o0apxnmoeiys sDul( p () rxomr3io1om  auvi;( srumirpio1ap emfet (f rur( pot1tpenmieiasla rl( ont0teenmocoadfmDrlivols)t2xmxmpno4ame mfviasfaDuax  ;t4aptnmf3tys aDra( o u0 lerxocio1oaDrauesl(0 etrxm iy1lpte fet (fa2trurp;t4tlxnmoctydfsDea(von(4aeermfciadla r nei;s0seurxr3io1op  mies s srtmxmpnu0tleomi3iyslmDra( s;t0tltomr iadomte uei t)s2to(rpoodal nmfcsatf Dtax o;o4tlxomfetld mDum(vsn(4artnmr3iydoat lnvs;t teto(mpiudole mivils)s2tr(r ;u4opeomf3tldfa uanmpnt0 rtoioctadoa ranei;t)seumxopio4lme  nvia(f Dururo;t0tpxoiociadfs eau o t) etrxr3iadlatelies;(0setrxr3oydlmee ictas)sDraur ;t0aeenmo3tydls2umnvsn(4aetoircoy1laDelu o;s)teuo(m nu1ale  iesl(fs2trxrpot0aetnmoeiydla2rluvp;u4arerir3ta1lm e nei;(  etoxr iy4ol e fesasf Duax oot0oee mf3tydlm2ranms;u0altoxrcty1lmDeanvi;t s2xoxr3iodopte icil( sDua(roou4optn f3ilsfa2rmnmo u4tltoir todoaD auvsls0teumir iudlp nlivil()artm(rono0aet ii3iad a2umumpnt4arenmocia1fa  lies t0 rxoir3oy1al  liesatf rtm(rp;o0alto ieiysla2rlnvo;(0 lermo tatlmDe ueo t) rumim no1lm   ivtas)srumxr ot4tlxn ocilt s2ranms;u0 rermrcia1fmDe nes s  etm(o oy1lpe lnet sf rrr(moot4aeeomfciydfa uanvpnt0arenio3ta1fmtelueilt  etrimpou4amt lfeia(f Dururoou0ole  i3iyt m2raumonu4 exnxf oydlpDean ols)t2tmxm3nodol nmncslsfs2urxmp;o1aet ioeiasla el( o;(4arxnmr3oy1fmt auvo t0trumxr3no1om nlncilt  Dur(  ot4aeen iciatls rm( o;u)tltrifcty1oa   ieol(0trumim3nudape  nviat arumx  nu4tpt mieiytfmDuau s t0teenxo3iydlmtelu o (0 2xoxrpiydaleelfciasf Drau pnu0ape ioeildfs uanms u4 rtoxr iodlp  liei t0seurxm3iodal emfeiat srtaump;t1tpxnioeiat m2uan pnu4tlxrmo3ty1lmtraueols  eumxr iu4ol  livtlt  rurx  oo0aee iociyslmDrl(ms u4altoiocoydfptelu ilt)trtrir io4op nmfes s srur(r ;t1ape moeiatlm uln p;(4 eermocootfat lueols0s2xmxo3iu4lmen ncsat)a2rm(r ot4ope  oetydls2rmums;t0trtnir to1oaD auvi;t0s2uoxr3iy4lmt mies tfarurx  nt4tpeomoeilsfm ua(mo;t)trxnif3oytoateln s;( sexrio oodapee fctlsfaDurxrono4oeto iciad s emn p () lxrmociatfm  liei t)sruo(mpiodom nmfvt ()aDraxr ot0oexn fetld a elnvo t0 rtnxf3totfpDelnvo s)t2trim3nodlpen feta()s2rr(  ot4optoiociadlm2rlu ont)tltoxr3tatfp e ues;t) euo(o oodllenliesltfarumu oot0olxn fciadla eauvo;(0trermfciytom r ivo s0 2umxrpnodlmt licsl(  rtaxmoou1opeomociydfmDumump;t0 exomr ootfptranvsls s2trxmpoodal  lfvt s  Dtrxmpnt4ape mociaslaDemumsnt4aexrir ty1faDeauvi;t0texr(mpou1ap e fesasfarrrum ;u0opx  oetysfs2emnmsnt0trtnxo oydlp eluvil( teurxo3iydlleemncil(fartm( onu4teeomoctltlm2rmnvpn(4aexrxociytfatrai o s0 etoio nodol  micta(fsDrrxmo;o1oltoio3iatfa eanmonu)alxomocoytlpDeauei;s)seurxr3iudamt mici t) rumxm ;t0oltomicild a em( on(4 rtrmfcoy1opD  nvol()truo(rpiudlm e ieias srrrum ;u1optnmi3tlsfa rlnvs (0tetoioctydoatrli ols  2xrirpno1lltnlieil(f 2umxrpou0optoifciydls2ulnmpn(0 rtrmfctotfa raneil() rtrxr ou4ap n nvs (f rrr(rp;u0alxn i3iat aDean o t4trtoioctydopte i il(0 rxm(r oydam   fcia(  rtau poo1optoioeilt m2el(vs u4 lerxr3todla rluei;t0s2xoxo3iu4amee icia(fsDrrumono0oeeo oeiat m rlumo;()tleomrcootfaDr uvi t seum(m3oy4amtemfetltfa2rmu oou0tlx ioctas m ulu snt0 ltoio iytfatelies (  2xoxm3oy1am  mfci t a2ur(monu0oex mi3ilt mDumu s;u4 leoxo3todfaDelnvo;(0seuoimpiydolt  feilt) rumxronu0aptoiietatlaDra(von(0trxoif3iotlaDran sl()srxo(m ny4olee fvias) 2tau  ;o4oeeniieiyd a2rlnvsnu)artnio3to1fpDr uvols0t2xo(m iudolen ivtlt) Dumur ;t1aptnmfciltfa2rl(vp;t)alerio tytfmt luvo ()sruo(m oy4alenlivt () 2umxrp;t4alxnmicilt mDuln s t4 eenmo3io1laD auvs;s  rtrio3ny4om nlnct s aDumx o;u0tex  oeils m el(mo;u) ltrirciydlmD  ueo t)t2tmxrpnu1ll emici (  rtr(rpoo0optnmo3iatls2rlump u)treomo iatlptraneilt t2xo(o oy1lp  lfvi sfarraum ;u0ale mfcildfs2emuvont) eeoif ia1oa  lnvils)texoimpou4ll nmics (f rurum ;o1apxniociys a2uau pnt0tleoio iy1oaDe n ol( trxrxo nudopt  nvslt sDrrxmp;t1alxo f3iyd m2el(vsn(0 leomr3iotfateai i;(  etm(opiodoltnlieil( arraum ou0apxoioeiysfm ulu o u) rtoxf tydlat lnes t) etmimpiodlleemnvt s)artaxm ot0olxnmfciyd a em(mont4altomocto1fa  liei;()t2trio3oo4ole  icias) 2rr( o;o4ole  fctadlaDrau s t4tlxrir3io1fp  aivi s)trxriopio4aptn net t sDumu oot1opto f3ildla2elnmo;() lenxrciytfpteai ols srtmir3ny1am emfctas)srra( ono1tex mi3ilsfm2rmuvs;u0aeerxociytlpt aueo t  etoxo3iodop  lfeiat)sDurxrpnu0alenii3iyslmDea(vo;t4alxoxr oy1op rluvsl( sexm(m io4amtelnvtl()aDuru oot1tltomi3iysfm2umu p u)teeoifcoadoaDe uvil(  2xmim3oy1am n fct s)sDraxrpnu0tlt  feiltfsDrluvs;u0arenmf3oodlpDr nei (0 eto(o3iu1lp n feil()a2trxronu1tex mi3tyslm2elums u4tlxnio oa1lp rau i;t)trtm(m3io4om e icsasfaDtr(mo;u1alto i3ilsfmDuluvpn(4artrmrcoatlm e uvol(  exoxrpno4apt mivt t)arurxr no1olx  ietltlm2umnvp;t) renif tytoat lu o t0t2urxr iodameelnvia( s2ur(mpot0aetnmi3iadfaDumums;() rtnmr oydfm e iei s) 2uo(m3ou1ameelivtltfaDrmu  nu1apxnmoeilt m raump u0aexnxocoy1fpteaneil(  rxmir3no1op n nciat  Drmx o;u0olen icils s ean o;(4tlxrmoctytopD aues ()trum(o3iy1opt  fes ()sDrrur ou1oltnmo3iatfm2uanvonu0 leoifcootfa r uvol(0sruoir3nydoltnmnci t)srtr( o;t1optnmi3ilsfa2rmnmo;t4 renmr3tatfatrai ols)sexrio io4ame lfciasf rum(m no1aet iieiytfa umnvo;t4tlxrir3oodlmtr i o;t  rxm(opoodam n ncia() 2rm( onu4tptoiietld sDem( s;t)aeeomrcia1oat aieil()s2tr(m iydam  mnet tfaDtaxmp;u1alxnmo3tys a2ulnvsn()arxnmr ootop  ai ilt0seto(rpnu4apen fes t)a2ra(  ;t0tlxn ictlsfa em(mo;()alxrmocty1lm rlieil(  rxmim oy1lpee fcsls aDumu o;t0aeeomoctysfs2rmu sn()altnxf ty1opte ivo ( srum(r3nu4lme mneils aDta(ro;u0opt  i3iytlsDel(mpn(0artrmo oo1lp e ivo ()trtoxrpiodlpte neias) 2tmumont4apxoifeiydfsDemn p t0 lxoiocio1omDeauvslt0 rurxo oy1oltelfeiltfaDrau  nu4opxomo3tasla el( o;t) rerxocootlptrluvo;(0 2xoxmpnu1llen ncsa(farrm(rooo0opx  icilsfm rlnmsn()artnifcoy1lp   ivi (0teurxopnu4amte nvtasf rtmu p;u4tleomiciyd sDrauvo u0tlxrifcty1opD anei;s)setr(opiu4lpt lfvi (fsDta(mo;t4tlx mi3tadfaDuaumon(4 etnmo3totomtrlieo;t0tetoir oydlptemnviltf 2tax  nt1tle ioeiys mDulumon()aeerifcio1lptrai ilt0trtrimpoo4op   nvsa()a2tau ooo1olen iciltla2emn p;u) rxoxr oytfa eai s;(0sexrxr3ny1alenmnctl( a2umumpou0tleoioetldlmDuau s t)tlxnmocio1fp raues;t teurio oo1amte nei (fartrumpot0oetnmociat m2eaumsn(4tetoif3iy1lmte uvol()t2xrxo iodaleemnetlt arrm(  ;o1olxnii3iydls umu o;u0tlxrxrcootomDr uesl() ruoxrpiu1lm  mfctltfarra(r ot4oet  octad aDranvsnu4artoio io1oaDr ivs t0seto(mpno4omt mfvil(fsrtmumpnt4apxo oeiasfmDumnmpnu4 lxrmo iotfmt  ieolt  rxrxm iu4oleemies ()srrrxr nt0aeeo fetys sDel( p;() lerif oodfm rau i;s0seum(o iu4lme mnci t artmurpnu0apto ieiyd sDranmpn(4 rerxo oytop rlivo (0trxm(o3iodamtn iei () Dtrxr ou0optnmoetld aDeau s;(0aetoir3oydlpD aivs;s) rtmiopiodop   ivtls)sDurx ont0oltoiiciytlaDelnmsnt0aetoiocoa1oate ieo;s seurxr oydom nmnes t)aDrrum ;o4opx iieilt mDem(mon(4 etomf3iy1lptranvols s2xoio3oy4aptemivtltfsDrrumpnt1tlenio3ilslm eanvo t)texnxf tydlpD ln ol() etoio3ou4alt mnet ()aDrrxr no0tetniieiyslmDrln on(4 rxrifciotlmD lues;t) eumir iu1lltemivsltfsDua(root0olto f3iat s2eaump u4 rtrxfctadomtr n o;s seumir3nudlp e fvia( srtmx  ;u1oeto i3ilsfa umnvs t4tetrxo to1fpDelu sls)srxoxr3oy1llen ieias) rum(  nt1oeenifcias a2rmnvo () lxnmfcto1laD  nvolt) ruoxmpnudalenlicta( aDtrx o;t4opx iiciyt m2eaumo;(4aeenxrciatlaDe n sls0t2uo(r3iu4lmtelnetlt sDra(r ;o1tee mi3tytla uanmo u0areniociydfpteauvs;s)truoimpny4lptemfciat)sDur(mp;o4opeomoeiyt sDrmums ()tltoif3ootlpD  nvilt)trxo(m iudllen feta(fa2tr(mo;t1altomieild mDranvpnu)altomo iotfmte neo;t0setoxopio4lp nlfeslt aDta(mpot4tlxnifctytls ea(mpn()arxoio3iydfpt ln ols0s2um(r3io1omenlicsatfs2uau p;o1alxoifctytfm2umn pn(0 ltoxrctatomt  i o;(0 euoxo ny4altnlnvtltf 2trumpno4oeto fcias m uanmo t0aetomfctotfpD  u o;t0srxr(o3no1amt  fcsas arrrxm ;o0oee iictadfmDumn s;() rtrmo3tadlm   ivs (0t2uo(m3iu1optelnci tfaruaum ;o1openmi3tydfs eauvp u4artrmr3oadfa   i ils0 2xr(o iy1lm emncs ()arraxm no1alx  ietasfs2rlnmpnt0 ltnio ia1lm e ueilt0trur(mpoy4opt mfcilt  2rmxmpou0aet  f3tasfmDemu o t4arxrirciodfm rlnvol(  rurxm3nydolen iesl() Dur(mooo1oltomi3iltlsDrm(vo;u)teeomfcoadlmtrlu o;(  exr(r3ny4op  lnvia(farraumpnt0oexoiociasla2ul(vp;()tlxrio io1om  livo t) rumim3nudllt lfct tfs2ua(m nt1aexoiieiysfm elnms u)tltnmrcoydlate nvs (0 2ur(o3oydam n fvsl(fsrurx  ;u1tetniictysfa2emnms t0texrxo oy1omD aueols)t2tmxmpoy4op  lfetltfartmu  nt1aet  fetad m2ua( s;u)aetnir tadomDe nvolt0trtmirpnodop n fetlsfarrr(mooo0apt  icilt a2ul(msnt4 ltrio3oytfa elieol( sexoim3ou4lle mneiat aDra( ooo0tpxomi3iydfa2ul(mo;u4aetomo tadlm   ivo t0setoio ou4lpee iei t)aruru pnu1ole  ictysla rmumo;(4 etoxrcoatlmtraivi;t sexr(o iu4llenmnviltf Dtaxmp;o4aex ifciysfaDua(mpnt0tlxrxr3ta1lpD livi;( truoirpny4aleemnvs () rrru p;o1tpt mieiatlsDrluvonu0alxoxr3to1lp rluvo;t seumxrpiydlpeemnvtas artaurpno4tlto oeiyt m um(mp;u) exrmr iytlptranvsl(0s2xm(o nodapt  fesa() rrmxmono1tet  iciydlsDrmump;()tltnxr iytla eluvo t seurxr iu4lpeemfcsat) rtru oot4tpeo oeiytlmDeaumsnt)alxomf3iodlpD  neolt0 eumiopoodapenlnvs s artaum ;o0opeo f3tat mDumnvs ()altrmf iy1om rlnei;t)t2tm(m3oo4omen fctatf rur(rpoo4tlx mietls sDum(vo t)aexrxfcio1faDelu ils0trtoxmpiu1op n fcta()arumum ;u1apxnii3iltfa2ea( snu)arenxfciodom e uvilt0t2umxo3nu1lm e ivtasfsDum(mp;t4teeo fciat sDranmsn() rxrifciotopt ai i s  ruo(rpno1lptnlivslt  rra(rpnu1tee ifeiytfs2um( on(0alxrxoctatoptrauvi;t s2tr(m3nodole  nvs s sDtrx  ot4ole  ietadlm2ran o u4tlxomr3oydfa e ivo s s2uo(rpiu1altnmfcil(fsrrrxroot1opeo iciltlsDranmo;t0aetrmo to1fptelnvi s0 2trimpiodlp elnei sfa2uax ont0ale mieiasfa2emumsn(0 exnxo iadlpteanvo s trto(m3oudllen ncs t) rtaxm ;t1aptnmf3tas s eln ont) exrir3ia1oatrlneolt  rtrirpnu4am nlfvt s s2rau p;u0tleniociydlaDeauvs;() renxo tatfpt  n s;(  etm(r ou1ol nlfes s) Dtr(mpnu4tetomf3tldlsDrmums u4tetrir oo1oaDeanes;( sruoxm nydol nlictls  Draur ;o0ole mictls m2rlump;u4 ltrifctydlptran i (  exo(r nudlpt  ncil(f rrrxmo;t1aleo icils m rm(vp;t) ltnmrciodlmteai ilt0 rurxm3oy4lp nmnvt sf rtm(rpnt1altniiciytla2rmnmpn(0 eerxf3ia1laDelneo;s) eurxr no4apt  nci s)s2ua(m ;t4tlxnmfetatfmDeln s;(0 ltoio3iotomtelneils srxmxopoo1lm   icsat)sDumur ;t1tle  fcildfa uan p;() rerxo3ty1lpDe nvo;( trum(m3oo4lm emfeia()a2umurp;t4tlxo oeiasfs uan o;t)alxrmo3tydfp   ueo;t srtmxmpoo4lleemfcilt)a2uax pno0apeoif3iltfmDrm( s t4aexomociatfmDraueo;(0trtm(o oy4lm nlieta(fa2taxmooo1aleo iciasfs2rm(monu4arerircoytoa  auvol()t2xrio nodaltemietlt)sDuru pnu4tle mf3ildfm eanmont)trxnio3tatopD  ivs s setmxmpio1am n ietatfartm(mpou0opx ifcilsfm el(mo t) leoxf3oodlaDr n il()srxr(opiu1op e ivi ( aDtr(r ot1tltomi3iyt sDel(mpnt4aetnioctadom  ai o t) euo(r iu4omee fes t  2umump;t0olxn fetat m ea(vsn(4altoirctatfa elnes ()srxoxo3iodome miesltf 2tax o;u0tlxnmo3tydfm2eanvo u0texnmf3totfmtrlivil( seto(o nydop emncsa(fsrrau  ;u0tltnio3ias a2elump () rxrmfcia1fm rliei (0trtrxr iu4lmte fctat artrxrp;u1tpenioeiltlaDra( p;u0 lxoxociodomD anvi;t  eum(o3oy4ap   nvilt  Drm(rpnu1aex  iciydls2uln pn(0 rxrir iy1fmt lu o t0 etmio nodalte icsasf Duaumont1olt mictldla2uln s () lerir3oa1lp elneslt0srtriopoo1ale mict ( a2taurp;u0aptniictyt s2ua( pn()tetomo oodoaD  nes;s  2trir3iodale mnvi ( srur(moot4texnmiciyt a uau pnt0 exnmr3iytomDelu o s s2xrxr oydomenlnvt t) 2ra(m nt1apenmi3tydfm2ulu s;u4aeenir3ty1laDeli ilt)srto(m3io1lltnlfctl()srrmuronu0aleoif3iatfa em(vpn(0treoircoatfpDr u s s texr(r3oy1lmt  ncs ( s2tmu oou4altnio3iysla2rlu s;(4tlenmr oa1lm rlueils)t2xriopoo4am   netlt sDtru ont4tlxo iciatfm2ulnms;t4artoxr3ty1om eaieil( texmxrpny1lmtnmivt ( srtaur no4aex mi3tys m uau p (0tleomo3iatom rauvi t t2trio3io4am elfetlt) Drmur ou0aexniociytfmDra(vs u0tetnxo3iy1la rlnesls0sexm(o3iy4lpe mnctasfsrrrxroou4texn icilslaDeau o;u4arxnmfctytoateli il(0 2uo(m ou4amtemfvilt)sDurxmo;o4tptnioctytfm rauvo;t0 rxrmr iytfat aivi;s0 etoxr3nu1omt mnei s)aDumx o;o1aleomiciytls ean o (0 exoif totfpDr uvols0trtr(r nydlptemncsl( s2rmxm ;u0oltnmoctld mDeluvonu)trxoir3oatla   i o s texm(opnodal eliviatfaDur(root0aptnii3iltla2ul( s;(4 exoioctytfptrai sls)s2xrxmpnydome micsas srta(ronu0alxniictldfm emn s u4 eermr tadoa   ivo;t0 exr(o oy1op  liesa(  rtaumonu0aetomietls m ulumo u4arxrio oydopDean ilt trxo(r oodlm n nvt () rrrxro;u0apxomo3iaslm2uau o u)teerxr io1op r ieo;()s2umxmpiy4altemfvtasfaDrax  nu4oltoii3ilsfsDrm(vpn(0texrifcoodopDr ueo;s0t2uoxmpiy1altnmictls)sDum(ronu1texn oeiad m rauvp;(0 lenmo3iydfpt  iei (0srxmxm io1ome mies s)sDur( o;t1oeeo f3iysfs rm(mp;u0 rtnif oy1optr neo;s0 2urir nodlmt lnvtls a2tm(r ;o0tlxnmiciytfa rm( pnu0 exoxr oy1om   ivi;s  2xmio3ou1ale  fes t)s2urx p;o4aeenmf3ildlaDea(vp ()alxomocoadoateanvs;s texrxrpno4am eliesls)a2um(mono1alxnmfeiadlmDuanmo u0 lerxo3ty1lat aivo;(0 2xoxo3ou4omeemietas)srrmuro;u4ape  ociytfaDeau sn(0teenxo3oadoat an s ( texm(m iu1am elfvt s s2rru pot0tex ii3tysfaDum(msnt)aexnio3iydfp  luvi s)s2xmirpoo1optn nctlsf 2ra(rpoo1aetoio3ias a uluvs;u)aeenmr3ootlate n s t)srtrxr3ou1llt  fctat)sDrru o;u1tlxoifctld s uanvp u4aeenmo tadlpteai sl()texrxrpoy4apt  fct tfaDumur ;t1ole mi3ias a2rlumpn()altoxo io1fa r nvsl( t2xoimpou1ol emfeiltf 2urum ;u0olt  oetys s2ra(mpnu)alxnircoa1op  au i;() eurim nydaltemivias  rrmu ono4oee micilsla2eln o u4 exrxr io1oa raueo;s0trtmxm io4ll nlivtl(faDtm(rp;u1oltnmieiytfsDeaumsn(4alxnxr ootoaDrlivs;s0t2xr(m ou4olenmieiltfarum(mo;o0olx miciysfmDrauvp u0aexrxfciy1faDr ues s s2tmxo nu4ap e fetat sDtaxr ot1tlt io3tlt s2um(mp ()texomrciodlmt  u ols)s2ur(m nu1alen ncil()aDrr(  oo0altnioetasla2rm(vp;(4 ltomr3ia1oa e uvi ( s2toio3nu1amtn ict s)s2rm(mono0tetoii3iydlmDem(monu)tlenircoytom eai sls)seur(o3nudoptnmivsa() 2tmu  ;u0oexniieiydlm2el(vs;t4trerxr oodomtrauvs;() rtr(rpiy1omtelnvt t s2trx pnu0aleomo3ildfaDem( o u)arermf oytfpDeaivil(  rumxm io1op n fcsltf Durxrpoo4oexoio3tltlm2elnvs;t4texnmf3tadfaD an ilt) 2xmirpou1ol emnei t arum( p;t4texomf3tlsfa rauvo (4altnmf3oy1fmt ln slt  etm(o oo1omeemfvsls  2urxmonu4ope  oetasls em( p;u0 etrxf ia1omt  ueo t0texrxopnudlleelics t) Dta(r oo4tptomieiydlsDemumont4 eenxf tytlp  anes t srxm(mpiy1al emietls aDtru ono1oleomi3tas aDumuvonu)alxoxr tytfa rlnei;(0tetoxo3oy1lme mnvias sruaxmoou4opeomoctas m2eauvpnt)alxrio oydoa eaueols s2tmxm3iodalt  ictl(fsrumx  nt0tle mi3ils a elnvo;(4 ltnxocoadomD livsls0 rur(r3ou4al elieiat srtrumpoo0tpeo feiatlmDra(mon(0tlxnif oytfm e i ols0 2tr(m iodlp emfet (fsDrru ono0alx  ieiydls2el(vsnu)teerir oo1lm eai o t texoxm io1lptnlfcsls a2uaxmpou0tle ifciytla umn p;t)arxrxocio1fmtr nvs s  rxrxr3iydoleemfetls)sDum(mpoo1tlxo octydla2uan p t0alxrmo oo1faD  ivi;s0 etoxr io1llenlivs t srumx o;u4tpxnifctytfs ul(mo;()trxrmf3ta1fm eluvi s) ruoxopno4omt lfctlt) rtr( ont4tpxniicilt a2em(mo t) rtrxf oo1lmD  uvi t0teumimpnodalenlncia(fsDraxmpnu4olen ietytlm2rluvpnu4aetomf iydlatelivo;()t2uoim3iy1oltn fes sfaDumumpno4tle iieiad sDrmuvont)arenxo3iydfat li i () 2uo(m3nodamtnlfcs t)aDuau ono1opt mfcilsfmDeln on(0 rtoifciydfpDelneol( srxo(o nu4olte icsls  rtrxmono4altn ictldla2ulumont0artnmocia1lp rlu s;s0 rumxr iudlm e ncilsfsrrmx  ;o4tptoioctas s2emnvpn(4 ltnmo3iodfptr nvo;t)trxmiopio1altn ies tfaDta( p;u4tet  feilt sDua( s (0 exri
\ No newline at end of file
@@ -0,0 +1 @@
+nvol(0 rxoxo oy1llt mnvtas s2tauronu0ape if3ilslm2rmnvo;u) reomf3ootla rliei s0 2xmxm oodam emfeiat)a2taxmpno0tlt  ieild s uan s (0alxrif3iotfpD luesls0teuo(opnu4ap e neilt s2uaxroot4olt  fciytlaDrlnvs;u)texnxr io1omDraivo;(0 rtr(r oydoleemivt s)sDumu o;t1alen fciyt a2elu o;t)tetoxfcto1fm ranvi t)trxoimpno4op   nvs t sDta( ooo1aee iiciltla umn on(0 rxomocoatfm eau i;t)s2uo(r3iudam e nvilsfarraurp;u1aet  oeilsfs eau o ()tltnxo3oatop e i ilt)s2trxrpou1lptemnctls)srraum ot4oexo iciyt s ua(vo u4aexrmr oadopD  i ols0t2tm(opiu1ll nmfcsatfsDrm(m ;u0tpeoioeiytfm ra(vs u0aeeomocoodoa eln o;s0 etrio3io4lltemfesa() 2ra(r nu1tpx  iciltls umn p;(0arxrmocootlatr u s;t t2umxo no1olee feias) 2uaumoot4ale mocild s2umnmon(0 rtnxr oodfatr nesl()tetoiopoy4ll n ies (  Duaxmpot4texomo3ilslaDuauvs;(0 lxrmo oydlmDrai ils  rurxo iu1lmtn fvi tf Drm(mo;o1aeeomoetaslm uaumo;(4trxnifctadfpD an i;t0sexmiopio4op n nvsasfsDum(mpno0oeenmo3tadla eaumont4tltnioctytfpt li s;t)srurxr3iu1oltnmfet ( arua(r nt0alen octadls2ea( o t)altnmfciydoaD liesls0s2ur(r3iy4lmtnmnei sfs2raumpno1tex ioctat mDeanmsnt0teeoir3oadfptr nvo s s2toir3ny4lp emfes tfaDuax o;t4oex ii3ildlm emn p t) lermo3tatoa eaivol( t2xm(o oy4lptemfei s)arra(rooo1texomfeiat aDua(ms;() rtnmr3oo1fa r u s;s0 2xoxr iy1altemnci t  rtr( ont4tlen i3tytlm2rlnmo u0trtrifcia1la e ueolt srxoimpiu4om nlncias) 2urur oo4tee  f3tadlmDuauvp;(0alxrxf3tadlpte nvo;(0trtr(m3oy4omtn nvi s)sDumx ono1opxoiietldlaDemnvs t)alxrmf oatlmD ln i () rtr(rpoo1lm  mfesltfa2umu pno0tlxoifciyslm umn s u) lenmr3oatfa   i o t t2trir3oodlp e icsa(fsrum( ont1texnif3iltfaDum(mo (0trtnxr3oatop ean o s srum(r nu1lp   ietas a2rax pot1alt mfeild m rmnvp u4 exrxo3ty1fa rauvols teumxm nodalen ivt s  rra(mooo0oetn oeils a emuvp;u0tleoxo3iydoaDr u i;s)srxmxr3iy1lpt lnet t  2tmx onu1altoio3ias s2ulnvo;u4arxrif tydopDe u olt0sexmir iy4ap e fcsat)aruax pno0ape ii3iysla2ea(ms;u0tltnif totfmDe nei ( s2tmxrpnodomtn ietasfs2rm(m nu0teenmoeiatls2em(mo;(4 eerxo tytomD aieolt) 2xo(r oo1op elicsatfsrra(ronu4tpenif3tltla um(vs u0 exoxfcta1opDr ieo;t) 2xoio3iydomenmivtlt s2uru  ;o4tpen oeiysfaDrl(ms u0alenxo3oodlptrlieols) exoim3nodoltnlfet (  rrmuro;u4opxo octaslaDul( p;u4 ltomo io1omt livolt)sexr(m no1lme mnvilt)srtmx pou4tpe io3iat aDuanmo;u)altrxr3iytfp  anvs;(  2trio oo4lpenlivils  ruaxm ;t1aetoiictytfa ea( s;() etrmrcoadoa elueol(0t2trxm3oodll e fesas)s2umu  no0tpxoif3ias aDrm(vo u)trxnxoctydomtrln ilt)srurxr nu1ap  mictat)sDrru  ;t0aetn ieiysfmDem(vo;t) lxnmo3oatomDeau sls0setmxo nydame  fvtltfaDrrxroot4texoifciadfsDemu p;(0alxomr ty1lmDeluei s srur(mpiy1amtelies s  2tmxm ;t4aeeo ietytfa2elu p;t4 etoxo oytfmt  u i s srtr(mpnu1llee ieta(fs2taur oo0aetoioetyslsDra( ont)aetrir oatlmD an s;t0 rxoxm3oudameelnvil( s2rrxr nt4aetnii3tysla2ul(vs;(4arxrir oy1laD au o (0 rxrio3nudop nmfet tfs2ra(mo;o1opeomoctldlm2rl(vp t4 exnxr3iytfmDeanes;(0srur(m nudll  mics () rtrxm oo4aexnioctydlaDemump;() ltomrctatoaDe i o (0 rxoxmpnu4omtn fetltfsrtmu pnt0aex moetyt sDrl(ms;u4aexrxo iadomteluvi;s0trxo(opny4ll n fviat)a2umx pou4tpto f3iadla2rm(mo u4aeermfcia1lmD  nesls)sexrio no1op n ietlsf 2urumpou1oeenmfciadfa2ul(vs ()tlenxoctatoateanvi s  eurxo3ou1op  livt (f 2uaxm oo0alx  f3iytfs eln ont4artnxf io1lptr neilt0 exrirpnodapen ivtl(f Dur(m ot0tptn octls s2ea(ms t4arxoio oy1lmDrli o (0teurim iy1alt mncil(fs2rr(rp;u1alenioctadfa eaumo t)tleomf3totfpDrlu slt0 ruoxo ny1optelfet sfs2urum ;t1ale io3ias m2rmu p;u0trtoxfcty1fptrluvsls)trtr(r3ou4ale lnvsa(f 2tm(  oo0teen oeiysfa ean pnt0tlxrif3iytfmDr uvi ()s2tmir iy1alt mnctas  2uaxrp;o0tpen ociltls2uau o u4tlxnio totfmt auvolt)sruoir3oy1ll nmivilt)arra(rp;t0tlx if3iasls2ean p t)teeniocoydlaD luvs s0 exr(mpnu4amen nvsl( a2ua(ro;o0oexoiiciat s2rauvo;()aetrio3oa1lpD  u i ( t2xoxm iu1llt mies (  2taxmpno4apto ietad a2umu p;t)aetrxrciytfmt auvi;(0 2xrxr3oy4opt  nviltfs2ur(mpou1aexniietytfa2uluvo u4tltnxr ootoateluvi s0s2xmxo oo4amtnlnei s)a2rmur ot1aptnmi3tldls2ra(vo ()alermr3iytlpt aiei t0 2uoiopnudlp   fcslt)s2ua(mpoo4tetnioeilt s eau o;(4 etrxf oadfp raneo (0s2xoxo3oo1lmtnmiesas)arrr(m nt4openmfciys aDua(ms;(4tetomf3oatomtraieilt  rtr(opny1amt mivsa()sDtrx ont4opxn ictlt sDeau s u0 rtnmf3tatomteln i ()t2toio io4am n nvi t sDtrxm ou0apxn ociasfm rl( s u0 leomociy1omt ln il( t2xm(r iudap nlfes s a2urxrono1aptn ictatls2rlu onu)trxnifcoytlmDe ivi t) rtr(opoy1lme lfvtls)srrm( o;o1aetoifctatls2rmumpnt) exnmociydomDr uvo;s  2xm(opnodlmeemfcsls) rurxmpoo4oetoio3tydla emnmo t)teenxfcoytomte n i;s  rurxr3nydomtn fciatfsrum(r ou0olxn fciadla rmn p t4 eenif ty1lp raiei;s t2tmiopny4ol  lnvslt srum(mo;o4tptoioeilt s el(vonu4tlxrxrcoo1omD aueilt  rtm(r3oo4ol  micsa(  rrr(mo;t0opx  f3iytlmDrmu s t) etnirctodfm eln olt0t2xr(r nydamtelneta()s2ra(m ;o1ape iiciyd s umnvs;t0 eenmoctotomtraiei ( s2ur(o3iy1om nlnvtatf rra(  ou0opx io3ias a uln s (0 exrif oa1fmte uvi t s2urxm iy4lltnlncsl()aruru ont1aptn ociasla ua(ms;t4aetrmocoo1fa rlu s;()texoxopiudaptnmfetl()a2rr( p;u1tlen ietad m2rmn pn(4artrmf oa1fatrlieo t)srtriopoy4opt  iciltf 2tmu ont1optnifeiydfa ra(vo (4trtnio3iadlaD au s;s0 2trxo3iy1lmt  nvias  2rr(m ;o0tlxoiietydlmDrlnms;u4aexrxf oa1lp  lies () 2xrio3ou1ole  iei s)aDrr(root1oex ioeils mDrmnmo (4trtnxf todfa r nvol()trtrio oo4amtemfcs t  Dtax  nt0oeto o3iadfm em( on(4 etnmfctodlaD lieo t)tetrxmpnydol emnct s a2uaxm ;o0tlenmiciadlmDelu sn() lxnir3oytomt aivs;t srxm(m ou4aptemicia(  Dtaxr ;t0aptomieiatfs ulnvp;u4 exomr3iydoa eai o;()trtoio3iu4ap  mnctl() 2rmum ot1tpxnif3tldlaDumumon(4aetnif ty1fmte u i (0teumirpoy4opeemnvt s  rurump;o1tptnmoetld mDem(mo (4alerxf iatoa   nvsl(  rur(rpiy4ome  nviasfaDrmuront0aexoifctyd mDrlu o u)trtnmf3iotfaDrlieilt0 rxrxr3iu4al n icsls sDraurp;o0tptnioetatfa rln s;t0artnmrciodfmDrlnvs;(0sruo(r io1al nlncia(f rtrx  no4aptoiieiys aDrl(vonu0 rxnio oytlm  aueo;s0 2umxo3oydlm e ieias)srrm(ro;t1optn feiytfm2umn p ()alenxocty1fmD livs ( t2umxm oo4lmtnlfvi sfsDrrurooo0teen fetad a uln snt4tlxnmr iodomtrau s;s s2uo(r ou1ll nlfvsa( srtax p;o4teeomi3tltfa2ra(ms;t4arxoiocto1lat auvs;s teur(mpiy1alt lfvt tf Durx p;o4apeo i3tyd m2uauvsn(0alxniocoydom  au s t0srurxm iu4lm e fet s) Durum nt0olx mociyd sDem(mont0trxoio3iotfpDrlu o;t0t2to(opnu1amt  fvtatfs2rmurpot1opxoio3tytfm2emuvo;(0trtrxoctadoa  lu i t  exo(rpiu1opt  ivsas  2trx pou1oeen f3ilsfm rln s;t4 exnif3oadfm eli i ( setr(r3no4lpe  neslt  Durx p;u0tee  ociydfmDranvp t4 etrmf3to1lm raieo;( trumxopiy4ole  neil() rurump;u0tpe iocildlaDua(ms u4 leoifctytfm  livi;s)teurio oodlptnlivslt a2tmxro;o0tlto oetasfmDua(vs u4 rxoxfciadomDe uei;(  2trxrpio4lptn ivs ( s2raur nu4oeenio3iad a2ean s;t0 lermr3oodfaD  nes;t setoxrpnu4lltelnvtatf 2uaxrpou4aexoifciaslm rauvs u)aeeomr3tadomDrlivi t0texmxr io4apte nes sf 2rauroou1tltniiciysls2emuvo t0tltoxr3iodomtranvo s)srurimpnudom  licslt  2rm(r ou1olt mfcilt aDrl(vpnu4aetnxrcootlp rlneil(0sruo(o iydlmenmnetat)a2rr(  ou0olxnifciat a rl(vp;u4aexoif3ootom   i s;t) 2tmim oo4alenlnvias artrxmpno1tpx  o3iyd a2elnmon()aexoio oytfm eai ilt s2ur(m3iy1aptnmfesat)arrmxm ot4ole  oeiatlaDelnvsn(4treoiociadlpD livo;(0tetrxm nudomt lict tfaDum(  oo4tlxomieiysla2eluvpn(4 lxnmr iatoaDe i o ( trxoxopoy1aptelfesltf 2rmur ou4apeo ietadfa2rmn snt0 ltoxocoatlptrlies;( trurim3oo1ameelieia( sDtaur ;u1alxo fetasfs ean onu0 ltrmf3iatoaD aneo s0tetmxo3ny4ap  mnvsls aDrax  nu0opxnio3tlt a2elumpnu)trxrmf ta1fp e u i t0trxmim iu1lpeelnct s sDrru  ;t1aetniociydfa2rmums;t4 ltnmfcoadfat  u s (0 2xrio ou4ame  feil() 2umxmoou0apto f3iyd sDua( p (0aeenmfcoydlp e neilt0trtr(rpoydlpe  ictlt a2tau o;u4oexnif3iytfaDranms t)texomfciodomtrlivs;( s2xmxopoudalenmfvslt aDrm(mpnt0tle  iciatfaDuanvs u)trxnxrctotlmt auvsl( t2urir nu4om emncs (  rum( pnt0apt mo3iytfs uln s u)teerif3ia1omteauei;( srtoxm3iudomtnmfvt s a2ra( o;t4oexo ictltla2rmump t0 exomrciotfmtrln ols)trtoirpiodlpe mfesltfs2um(mont4apeo oeiytlmDel(vo u0 ltrircio1la eai ilt) 2toxo oo1ol nmivtl( aDtmxmoou1aetnmieiytfm2ean pn() exomo3iodlpt  u o s texr(r3oudol nmivsa()arta(r no0tlen i3iyslm rmn p;t) exrioctotfm raivols seurxo iu4am  lieslt  2rrxrpou4oexo i3iysla rmnvp;()trenir3tydlmD  ueil(0trxrir3nu4oltn fcilt arrmuroou1tpt ii3tasfmDeanmon()aetoxf3oytla e nvols t2uoxrpiodaltnmies t artm(mp;u1tlt ifeilsla2el( o (4trerxr3oadlat  uesls0seurxopnudomt  nesat) rtmu pot4texnmieiyslm2rl(von()aexoifciotlatrauvo t)texmim nu4lle  ivtlt)srrm(mp;u4tltnmietyt sDrm(vs t0tleoif3oydfate i o;()seuoxopiu1ol  mict s s2taumooo0aeeo oety
\ No newline at end of file
@@ -0,0 +1 @@
+u o;t)t2to(rpnu4alenmivta(faDrau onu0optnmociydfa ulu p;t) lxoxoctodfp   ivi t trtrim3nodolenmfcils)aruauro;u0apenifeias m emnmsn(4trtomfcoadlaDr u ols0setr(m3nydlptnlncslt)aDrax o;t4aex iieiatfmDuln s (4 exrif3tydoa elueil( s2uoir3no1lm nlnvtl()artmur ot1alxniociydfs2eluvs;(4artomo oydfpt au i s)trxmir oo1olee fesl(fs2urxmoou1aetnmiciytlmDrl( ont0 ltoxf oa1lp  lnvsls  rxoimpoy4ap  mfvilt)aDurxr nu1tpxniociltlm ranvs t0 lenxr todfpDeaivs t)tetm(r3nodllee ivsatfsDtr( pno1oleo f3iytfs2uaump;t) etomrciydfa  aueols0truoxopiydal  mnesl() Drr(mo;u1ole moctadlm2umump u0 lxnif3oodlatraivsls  rum(r iy1olt lfcsatfa2taxrpno1aetnioeiad m ul(mp t0tltrxf3tydlaD li i;s)setrxr3no4lpe micsl(  2ta( pou1aexoifetlt a2em(msn()tltomf3oy1laD aivi;s) 2trim3oo4amenlneia(f rtmxmpnt4apenifeiytlmDelu onu4tetoxr3iytfm elu i;t  2urxo3nudlpee fci tfsDuaxm ;u0aleomoeiaslm umnmp u)aeenxf iotop eaiei s0s2urir3iu1lmtnmfeias) rurx p;t4tpt mieiytfsDuaumo u)trtoio3ta1fp  anes;t tetmxopiudlmen nvia() 2tm( ono4aetnmocilslm2emumo;t4aeeoir ia1opteai ils)sruoxopio1openmnvslt)s2taxmpot1apt mictatls2rluvpnu4aetrif3oodlaD an o t trxrio3ou1amt miciat) Drmump;u0aexnioeiydfsDrm(vpnu0alenxfciatfp   uvi ()srxm(m nodaltnlfvtas)sDtm(moou1tetnmieiydfm rmn s ()aetomo oa1lmte i o s0s2xmir3nydlpt lictasf 2uaurooo4tee ifciytlsDuanmo t0alxrxr3iydlatelneo ( texoir no4lpen ncsasfa2ra(  nu1opeomiciasfaDrmuvpn(0 eeomf io1om  luvo (0tetmxrpiu1ll elnci s)aDta(r ot1olxnmi3iys m emu s;u) exrxo3oadfa  liesls)sexrxrpnodaptemicsa(f 2urumo;u4tpeomoeiyd mDul(vo;t)alxnir tadlpD lnvo t  rtrio nu1llte nviat)srumur ou1aeto ieils m em(vonu0artnio totla raivs s srto(mpiu1ol   nvsa(  rrmxr nu0opto fcildlm elnvo;()trtoir oodlp elneo t0srtm(o oydam nmfei (f Dumu  ;t0tlt mf3iytfm umump (4aeerxo oodoaD  ivi;t)s2to(r ny1lm   ieilt sDraxmonu4oet ioctatfs2el( s (0 leoxo3oytfptelivilt0 eumir3oy4lmt lnci (faDrr( p;t4tetn f3iadlm rlu onu0texrirciy1optraivs t)t2ur(rpou4ll nlnes () Dtru  no4openifciltlm2ea( s;u4alxrxrctodop raivsl(0s2uo(opno1om   ivs s)a2uru  ;t4oleo f3iydlaDrluvp (4 rxnio3ty1fm rauvo s  eurxrpiodopee ict s)a2trur nt1alxomoeiytfaDulu s (0 rtrxo3oodfmt lu o;s srtoio3nodom nlieslsfsrtau ono0tpxnmieiasfs ua( on() etoio3iytlptraivolt0seumxo oo1lptemfvtl() 2tr( ono4opx moctltfsDulnvs;t0 lxoxfcty1latr neo ()seuo(o3io4open nvtat srrr(monu1oetnmociyt m2ra( s;t)tlxrmfciadlaD aivi t truo(opnu1op   fcsl( aDtr(ro;t0olx mocild s elump;t)trxrmfctotomD auvs t0 2xmiopoo1lleemnvtatfsDtax  nu0aptn ieiaslm2emu snu0aleomrcto1lpte n il( texrxm oy1oltemnvsatfsrrmx  ;t1tpe mf3iatfm ul( p (4aetnir3ty1laD luvs s sruoxopiy1lmtelnvsat a2umx pnu1tet mfeildlaDua(mo;t4trtrir ootlp ean s s) exrxm3ny1oleemfvs (faDrm(mpou4apxniociasfa eaumo;(0texomr3iodla eluvi;t) etm(r3nu1om   fetlt  2tau oot1tle mi3tldlsDea(ms (0 etrir totlpD lnes;t0setmxr3nydom elivt s  rrax pot1tptomoeilsla2emn p;u)trtrio3oadlmDean s;( setm(m3oo1aleemnvi s a2rrxm ;t0oleoioetytlaDuau p t)tetnifcty1fmD anvs s0t2um(o3iy4alt lncia()a2rmxrooo0aetnmo3iaslm rmuvo;u4trtrio oadfaD aivslt  eumir3no4llt lfeils) Dua( onu1tetoii3iad a umumsnt4 rerxfciotlmt au s;t) rxo(m oy4lptemnesas  2tau  ;o4alt iictysfsDrm( p t)teerio3iotfmD aieo;s) rumxm3io4oltelnctls)arumu  ;u1olenioctldlm rlnmp t4aexrxf oy1fpD luvs s setmxr3oy1om e fvilt)sDrm(mo;u1apt moeiyt s em( p t0 etoif3tytfatean o;s  exrxmpoy1lmeelivsas aDra(r oo4oleo ociat mDumnvo;()treomf3oydomDrlu ols)tetmxo iydapt mfet ()srurxrp;u4tpe iiciydfm2elnms (4aleoxoctodlmteau o t0sexrxo3ny1alt lnet t) rum(mo;o1teen icildlaDumnmo;t) renmr oydlp eauvs;t) exr(m3io4ole mncils srrauront0oetn i3ilt mDrmu s;t0tetoxo iadfat luvi;( setm(mpoy4lmee fvs sfsrraum ot0tee iietatfmDum(mp;(0 exnioctadfaDeanvolt) eurir3oydal n ncils  2umur ou4tltn ietad aDra( on(0 ltnifciy1fmD livi t0teurxr oy1ll emnvsl(  Dumxmoot1oetomieiyd s2rm(vo t4 lxnxo3ta1op elieslt0sexrxm nu1al e icsasfs2taxr oo4olt mociyt a rmu o t4 rxomo tatfpDr nes t) exriopno1lm elncsl(fsrtr(m ou0aptnmicild aDemnvo (4 lxnxrctodfmD  ies;t)t2xo(r3no4ap   fctl( artm(  ;u1oex  octydfaDum(msnt4 rermf3tydfmte ueo t) rtmxo3ou4ap elict t)sDrmx  nt1opt ii3iydfaDra(vonu0arerxociotfaDeaueols0 rtoxm3no4ape mncs (f Durum nu0tlxn feiysla2um(mont4 etoxo3todoptranei;t0s2tmxmpiydlme lfctls)sDtm(rp;u4apeomfciyd a ul(ms;(0trxomf3oydfaD  iesls) 2xoxr3nodomtnmieslt arrmx pnt0ape  fciyd sDelumo u0trerif3tatomte nei;s  2trir3nu4lmtnlivt tf 2ra(root1olxnmoeils sDrauvs;t)aexoxr ty1la  lnes s seuo(mpnudlmtn ivia(  2urxronu0alxnifeiysla2umu pnt0arxnmo tatoa r i i s t2uo(opio4ape lnct s) Dtmu o;u4aeen i3iytfa uluvo (0aleoio oatfptelu i;( srxoir iydll  mnct s a2rrx p;t1oee  fcilt m rlnvont4 renmrctytfm r nei;s  etoio3oudolee nctlt  2raumpnu4teto o3tydfmDul( o;u0texoif3iytop  aivs;s t2urimpio1lmenmnct ( aDua(mpot1ale iietlt mDra(msnu0tleoiociy1fpD li o;()t2urxmpno1al  micsl( aDtm(ro;o4olenifcilsfaDel(vont0 etomr iytfp r n ilt) eum(rpiy1lm e neiat)aDrm( oot4tetn o3tadfa2uanms (4texrxfciotfa eliei (0 2tmxr3oudopen ivt sfaDta(  nu4tltomfciysls2raumpnu0tleoif3oo1fateanesl(  2xrirpny4lptnlieilt  Dra(r ;o4alxnifciasls rm(ms;u)aexrxocia1lat lueo () exoxopno4llenmict t aDraxm nt1tptn fctyt mDua(ms u) etrmf3tytfpDraieo;()srur(rpiudamtnmies sfa2umxro;o4tptnii3ild aDuan snu) ltrir3iatlpDraieilt0 ruo(m3oydole  fcsls)sDtaxro;t1apeoio3tysfaDum( p;t0 etnxrcoa1oatrlnvilt sexr(o3iodom   fci tf Drauroou4apeo f3tyd a eaumont0arxnio oodlmDr i s;( s2xoiopou1al emncsa(  rtaum ;u1olx  iciyt a2emu s;u0aeenmr3iadlp  aieo s0s2toxr iy4lptnmfeta()s2rax  ou1alxomocias m eau p;(0alxnxfcio1lpD  n s;( trxoxo no1ol e fcsasf rra( ooo1aptomf3tad sDemnms;t0artrxocto1fm r nvs;s)srtmirpno1lp nliesls sDumurono4teenifeiatfa rln pnt0alxnif3iadopt  uvils  etmxr3ou4lm e fetatf Dumx o;o4oleomfciat m2raumpn() rtomo iydlmD lieol() ruoxo nodap nmfvi t  ruru  oo0oeto fctydlm um(mp u)tlxnxr3io1omtrlnei;t0s2tmxr3iy1am   netltfsrum( pnu0oleoiociyt s eaump;t)trenio3to1lp rli s s0 eto(rpiudalt mnvt ( sDurxroou4oltnmoeilslaDemump;u)arxrmf3ta1omD  nvs;t)s2xmxopoydllt  iviatfs2umxrp;t0tpe mocilsfa2um(vpn(0tlerir iotlmD auvilt0trtmxopou1ole mfeils  Draurono0apxnmoetasfaDrmn s u0 etnif3tatlaDrlueo t)srxmxrpoodlp   ivi (fa2uaum ;o1tltniieiltfsDel(mont4 etnmfcia1fm  lnvsls truo(o3iy4lpe  iet (fsDrmxmp;t1tptnifcils mDumnmpnt)aexnirctadfateln i;(0teto(opou1lltemncilt  rtmumpnu0aexo icildfsDel(vp u0tlermr iytlp ran o;s  2umim ou1aptn ietasf 2rrump;o0aeenmictlsfa2eaumo;()altoir3iadoaDrliesls) 2tr(o3oy1am   fcsls aDraumoou1open oetldlaDulnvs u4 rxnxocoytlmD lu s s setm(r iodlm n nesa( srtrx onu0apx miciyd mDuanmsnt0 renifctytfaDeli o () exoxo nydllenlict s) 2rr(  ;t1tlx  ociaslsDumu s u0tlxriociadlateanvsl(0 2tr(o3nu4lp elnci t)aDrr(mo;u4tlxn oeiydls2eln onu0artnmfcoa1oatelu sls)t2urio iy1apen nvslsf Dur( ono1oleomi3tatfa2umuvp t) ltoxo3ty1omtrai olt sruo(rpio4apte ivtas  2tau  ;u0alxnmi3iat aDrauvp (4treoio3oa1op raieo ()trtrxr iudomeelictas)sDtr(m ou0alx  f3tydfsDemnvs u0tetoxfcia1op raivol(0srtmxo3oo1ap nlicsl(  Dururpot1tpeomfeiltfaDelumpnu0 ltomf3oa1lm eln i;(0trtmxm3ou4aptemivs ( srtaxm ;u4oexn ieiysla2um(mo t0tetomo3ty1oatrai o;( s2xm(r nu1lp   nciatfa2tru o;t1apt  icils s2rm( ont0artrxo3oa1fateaieo;()s2urim iu4olenlncias)sDtax ono0optn oeildlm eln s;u0altrxrcoadlmDeli i s) rurim iu1ale lfei (  Duaumooo0opxomoctltlmDrmu p u0 lermo ty1oaDrauvs;s)texrio3iu4apen ivtltfa2rax ooo1apxn o3iyt aDuauvs;(4trtoir ia1omteaieols0t2tmxmpnu4om   ieias artmxrpnt0olx mfcilsfm2ra(vp;()tetrif3tydfatr i o;(0t2trir oydlm   fct ()aDtmurp;t0oltn icildla rlumo;u4aeeomociotoaDr n sls) etmio3nudlpt lfci sfaDrr(  ;o4tlt  oetls mDumumsnt)tetomrcoo1lpDrlu o s)teuoxm3nodllee nvt tfa2tm(r no4apeomoetyslsDuauvon(4texoif iy1lmteau i () 2umxrpoodllt lictl( aDrmump;u0olx  fetldfsDelnvpnu)aexrio3totfp  ln i;s)s2um(o oodaltnmncsatfaDrr(moot0oexn i3tatlm2emu o;t4tlenmfciytfmt ai i;t)trxr(r3nu1am  livils  2ua(r ou4ope ii3tys sDemnmpn(0 eenmocto1latrlnvslt0srtrim3no4oltnlfcia(fsrrru poo1tee mi3tyslsDel(mp (4trxoircoadfp rau slt)trurxr oudlltelfcs sf 2uaum ot1olto ictytfa ran o (4aexnxf3oa1laDeai il( teumxmpio4lmt lieilsf Durx p;t0apx mfctldla2elnmo;(0tltrir tadoaDe uvi t0t2uriopoo4amtnmncs t a2rrxm ou0aee mocilslmDranvpnt4teeoir tydomteauvols s2toio iudalt  fcils)s2trxr no0texomfciadla rlumo;t4arxrmf tytom eluesl(0s2uo(m3iodamtelivt t artr(m ;o1aeeo icias aDemu s;t) eenif3tatlptr u o t0srxm(opou4al elfet s aDur(rp;t4apx  oeiat s rln onu)aetrmrctatfp eauvil()s2umxr3nydlpte nei ( a2trxrooo1olx  f3iyslmDum(vo;u0 rtomoctotfp eaivs (0t2uoxr3iy1ameemfei tfa2rmu o;t4oltn o3ilsfs2rl(vs t0trtnxo tatlmtean s;t  2tmxr3nu4om  lies s)sDrmxm oo4tle ii3iyd aDul(vsn() exrif oa1lm  aueo;( s2tr(rpiodap   ivsls  rrr(  oo0tpx  fctyd sDuan sn(4 ltrio3tydlmDr i sl()s2xmxm nodlpe  fcia( arurumpot0tee  ictas a2ul(msnt)tlxnmr ia1lpD ai o;( sexmxr3no4op  mfci ()aDra(m ;o1olenioeilslsDrl( o (0 ltomo oodla  aieo s t2ur(opnu4ap emnvi s)a2uaurooo0teen iciytlm2rluvsn(4arxnmr3ty1fp  livo;s)t2xrir nu4lp   ieia( aDtm(moou4optn f3ias m rm(vp;t)aexomr totomteaivi;(0s2um(o3oodlp   fct s  2ur(mpno1optn fetlt sDrl(vo;(0tetrio3oo1oa e ies;(0t2uoim nu1lpe lfvta(fs2rrx p;t1tlx if3iysfs2um( s t) ltrif ootfa eanvi;s  exr(mpiy1lme liciat  rurx pno0texo feiltlsDea(vpnu0 renxo oy1omt luei;() rxo(o3iu4om elfcs t sDta(ro;o0olxniiciys mDemnmo;t0teerirciadfmDrauvs t  rur(opnydllt licia(fsrra(rp;t4olxn ociyd s eanmsnt0altnmr3tatfpDe nes (  2tmxmpno1lmen nvi t  rraxmo;o1tpxnmoctltfm2rlump u0 etnxf ia1fptranes;s)sexo(r3nodape lfviatfs2tr( o;u4aetn i3iltlaDeanvp;() lxnirciytlptrlueilt0tetrxr3io1omte ivi s)sDraxr no1aexo fetlsls eaumo (0aleoxr oa1opt lueslt  euoxr ou1llen fvta() rur(mpot1olxniociysfsDum(mo;t0 etrmf ootfatelivol()s2xmiopnudlp  mfesls a2raump;o1aexomicils s2ua(vs u0artrir oodop eaneo ( t2tmxo no1alen ivsl(  2raum ;o4apenmietyt sDrln p t)aexomoctadfm eanvsl() 2urxm3iu4olenlfes s  rur(roou4tltn f3iytfa2ra(vpn(0 lxomr oo1lpD aieo ()seumiopno1lme lfci t aDtr(m ;u0oex iietldfmDrm(vp;t) reomo iy1oaD an ol( s2umirpno1om emieia(fsrrm(rpot1tpxoiieilt s umu s;(0trenxrcta1la elnvols) 2xoxm oodam   ics t)s2urxrpnu0aexoif3tatlm rln o;t4tetrmo iotlm e iei;( truoio iodaptelnvt (f rururp;t0oee ioeiytlaDeanvs t)tetoircty1om rlu s;s0tetmxm io4al nlfvs (fartmxr ;t0altoifeiat aDea( o;u)tlxrmfctadom  auvilt)srumiopou4omee fcslt aDtrur ot0tle ifcilsfs ua(mp u4 lerifctadlpt li s;( trur(mpio1lm e ncslt) rtm(r ;t0optoifctat a2rl(ms;(0teeoxo iy1oaDrli i;( trtmimpoy4op elivi ( aDtrxr no1tlt  fciyt a ua(mpn() lxrifcto1fa   nes s)seum(rpoo4om elivi t artrx o;t1aex  f3iydfsDul(msnt4aexnif oo1laD  uvs;t) rumiopiu4lm   ieils aDuaxro;t0apeo oeiyd mDumu s;u)aetoxrcio1lptrlivs;s0 rxr(m io1lpte ictl(fa2rmxr no4olxomf3iat m2ra(vo;u0tetnxf3iatlp  ai s;() 2urxo no1opee nvi ( sDrmx pnu0tex  iciytfm2rl( onu0tlxomr3oy1omDe ueil()s2toir3oodlpt miciatfs2taum ;u4oeto oeilt sDelnvpn()trxrifcoo1fp rlueils)t2xm(mpou4ol   nct ()aDuaxrpnt4ape mi3iyslmDrl( s;(0trtrxf io1fa rluvi;() euo(o3iodap  livs t  rta( pnu1olenif3iad s eaumpnt0artnif oy1fp  livi s trxoxm3iydam   fcsasfsDta(  nu0tlxo f3iatfs rmnvs;t0 exnmfciy1om eau olt)s2xmxo io1lpe  ivs ( sDrau ooo0open ictls m umuvs;t4 lxnmf3oytlmDraueo;(0 2tmxr iu4opeemivtlsfartm( ooo1teeo i3tld a2elumpnu0tlermf3tadopD anvo t)t2toxmpoodlltnlfet ( s2urxro;t1oltoiictas aDum(vpnt4alxrxr oo1fmtrlnvolt  2toio3io1lpte ncslt)sDra(  ;u1ale mfciydfmDeaums;t) renxf3todlpDean o;t)truo(rpiy1llenmnvslsf Dtaxr ot0ale  i3iysfm2rmuvs;(0trtrif tydlmtrlivs t setmio3ou4ll elfvsls)a2taxrono4apt moeiys aDeln p t4tetoxr iydfaDr iei;t)s2xoio3iy4olt miesa(faDta(rpno4aptomoctaslm2uanmp t0 etrxfcoydfaDeauvo;( t2toirpnudlpt mieil( a2umur ;u1tpx mociydfaDuln s () rxoircoatfa e n s (0 etmiopiydam nmfeias  2umu  ;u0alto o3tyt s2ul( onu)tltnir tatfaD aiei t trtoir3iy1omenmfviltf 2uru ooo0teeo f3iadla eau o;(0 lxrir todlmDelies () ruoxrpoo4oltnlncil(  Drrxm ;u4apxnmo3ildfsDrauvp;t4trtnxfciytlat aivslt  exoirpnu1aptelfvias s2umu  nu0tpxo o3iyslm2em(ms;u0trxrifctotla rlnei s0t2xoimpiu4ol nlfvsat)sDraur nt4oeeoio3tasla ul( o t0altoxo oo1fmD  ieo;s t2uoxopio4apeelnvi sf 2umxmo;u0open fetlsls emumo (0 ltomo tytopt ai i;s)t2ur(m no4amt lfetltfa2ta(  ;t4aeeomoeildfs uau o;(4trxomf oatlmDrlnei s)s2tr(r3oo4altemfct (  Drm(mpou1optoioetaslsDuanvs t4 lenxf3iatfa r nvsl(  rtoirpiu1lltelnvi () Dra( o;o4ope if3ils m uluvpn(0altoxr3oydlat lu o t) euoim3oudamenlfesa()s2tmx  ;t4teeomo3tadfs ra( s;t4tlerxf3iydlp e nei s)sexoim3nu1amt liesls  rtaurpou1tlto o3ilsfmDua( s;(4 lenmf oatlaDe neo;t  rtrxo3iydamenlivi tfarrax  nt0tlto oeiadfaDul(mpnt)texoxfcoo1lmDeli o;t)tetr(rpiy4apen fcs t s2uauroou1tpxn ocias a ra( p;(0 eeoxrciy1lpD aivi ()seuo(m3oydlp  lfct s  rtrump;o0oex  i3tad m2ra( o;(4alenir tydfa e ues t seurxr oo4ame mnvt s)a2ta(  ;u1oeen iciytls2umnvp;u0tlermociytfmte n sl(0sruo(m3no4lptnlfvtltfs2taxm nu1tltnifciat mDua( s;u0aeermf tatlmDraivils)t2uoirpny4op nmnetlsfsDtmuront1aleomo3tas a2ea( p u4aexoio3oo1omD aieil()trxm(opoy1lmen fes t a2tmum no1tpxnifciat m2umuvo () rxrmf oodomD lu i;s) rumxr3no4ap n fei s a2tmuro;t0tpto i3tlt m2ua(vo ()tlenmo3iytlp  lnvi (  exmio3oy1ameemfet sf rtrxm nt4aptomieiat a ul( p;(0arermocto1fp  anei (0 rxmim iudamtelfviltf ruru p;t1tle mfeiatlm rl( s t4 lermf oatlat ai s;t0texm(opoy4llee fcil()a2tmumoot1tltnmfeilslmDel(vsn() leomo oa1oa  lu il()texr(o3iudalte iei t) 2rmx  nu0tle ioeiat m eanms;(4artrif3oatoat lueolt0 exr(opiy4lp  lfcs (f 2taxr nu4oex io3iatls ra(msnt) leoxrctatoat ai s t)sexm(r io1ol n fes t a2ur(mont1tpx  f3iadlm um( o;t0tleoircty1omD  i ils)t2xoio3io4lmenmncias)aDrmur ;u0aetn oeiad aDeanmo;u) ltrxo3tatop  li s;s) exrir ny1aleelnei t)a2rax pnt1tee iociatfs2ulnmp;() rerxr3ootla   u s;(0s2xo(rpno1op e fei s s2uaumpou0aexnmi3iasla2umnvs (4aeeomfcoadfm eanvo;() etoxopiy1amee nes s srrmu pnu4opt  o3iydlm ranvsnu4 eeomociytlptr ivi;t t2ur(mpiy1am nmfci ()sDtau p;u1aeeomf3ilslaDea(vo (0aeeomo3tytfa rluvs () rxmirpno4ame  fei t  2rr( pnu0tet  feiyd sDrl(mo (4arerio3ta1op  livsls0setrxr3nydlltemfetasfs2tau  nu1oetnmoetldlaDra(mp t4trtoif3ootomDr nvo;()teuoim ou4omen iet ()a2tm(mp;u4olto fctadlm umnms u0trtnir3iydfpte neilt)sexrimpoy1olt lnvs (  2uru p;t4aleo fciat a2ulnvo;t0 exrxo oytfa rlues t0 eto(r iu1al nlicias) rumxmp;u0optomfctydlsDrmnmp t) lxrxo3oydfmD luvi;s) rxmxo oydlpeelictlsf Durumpou0tltn iciydlm2ul(msnt4artoxf oytop eanes;t) 2trio3iudlm  lnetl( s2rm(r ou0tlenmoctldfm2rl(vp u0 lxoir3oadlaDrlnvi t) etrxrpou4oltnmfcta(f 2raxmpno0apxnioetltla umnmo (0tleriociy1la   ivo t0texoir3nudaltnlfesa(f 2tr( pnu4tpx  ictyt a2rmnmsn(4areoircoadlm rluvo t0srtrio3oodol elfet t a2rrx oot4optn feiatfm rl(ms u)arermr3totomteaueolt0 rxoxopiy4lp  lfeta(f 2urum nu1aeeomietat m umumsnt) rxomrciydfaDr ivil()tetmxr nudapeemnvilt) 2rm(monu1aeto oeiyt mDranmp (4aleomr3tadoptr u ol(  rxoxrpoydopt mncil(  Dua(r oo4oeen fciad m2el(monu0 leoxf3io1lm  aueil( setrxr3no1omt mnes s)aruax ono1ope  fetydlaDeauvo (4 rxnxf3oo1lmt aieo t  2to(r3oo1lptnmivslt s2raumpot0alx ioctlt aDuaumsnu4 lenxo iytfp   i s s s2umxo3nu1al n iei sfsrrru p;t4olxomi3ild s rau o (4 ltoxf oadoate ueilt  exoim3ou1ap n nvtas) 2rmx pnu0opx  ieildlmDeau pnu)aetnmr tydoa   nvolt)sruriopio4lle lnvia(f rra(rp;u0oee  i3tltla emump;(0teeoir3iadfatr nvi (  2umxopio4ole  iesa()srraxmono4oet io3tad aDemnmpnu)aetrxr3oadlmt  neo t)s2tm(rpny4lpen netat a2trur ;o4tlxnioctytfs ulu o u4trxnxrcoa1oa r uvsl( srxm(mpiy1apt  nvias arrax p;t4tpt mfetysfs2emn p;(4texnxfcto1lat aivi ()seuoxr io1lm  lnct ( srtaumpnu1tee  fetat sDelnvp;u4treoxocootoate ieo ( t2urimpou4open ivtasf rtaum ot4aeeoif3tlsfm ranmo ()teermr iytopDelues;t t2xmxm oudapeelncilt sDraxm ;u0tetnmf3iasfs2ul( o u4 rermo3oytom e ueo s)sexo(mpnudlp e ncsa(fsDrrxro;o0tpx io3tysfmDra(vo;() rxrmf3oy1lpDr nvols trxrxr3oo1lpt lfct (f 2raum ;t0oetoifctasfa elnmsnu0 ltoxo ta1fp r i s;t) euoxo oodomen icilsf Dur(rpnu1ape iiciydla umn pn()texrifcoo1om  au i s0s2trxo3ny4ame mfesls) Dtmx pot1tltnmo3ilt a2emuvonu)alxoxrciodlpt aivol() 2trxopou4op   fctat aDtmxrp;o0oetomocilsfaDuluvs (0 etnxrcoatlmte uvs;t) rtr(r oy1ol nlfci tf 2um(m oo0olt iieiys a2umnvsnu4 rxrxoctydlmDe neil(0t2xmxmpiodam   neilt)a2rrxro;u4oee  i3iadfaDranvsnt) etoxrcoo1lm r ueils  rurxm3oy4ll n ieias)aDtm( pnt0tlt ioeilsfs um(vs;t0 lenircoatfa r iei;s0teto(m3iodlmtnmieilsfsDtrxm ;u0aptnmi3iysfa2rm(von(4alxoxf3oatomt  uvsls  euo(opio1ap e fetl(f Dumx ont4tet ifctls s ranmsnu)artnxfcootoaDe iesls  rtm(o3no4optnmfvtatfsruru  oo0texo fetadls umumo u4texnxo todopD  nvo;(0tetmxr3nudolee neiasfs2uaxmp;u1tex  i3tys m2rmu snt0 rtoxfcoatomDe neol( texoirpou4olt  fct (f Drax ono0tlto ocild a emn onu4tltrxfcoa1la eluei;( s2uo(rpiudopee nci s)srrmur ;o1aee  octatfs umumsn(4 eeomr3iadfm  liei (  2xmio iy4lm e ivs tfa2urxm ;o4tpxniicilsls2rmumont4altnmf3oatoa   nesls) rxoir3oo4ole lnctls artrxmo;t1opeo iciasfmDrln o;u0alenmrctadoa r n o t tetoimpoydamtn fciatf rrmum ;u0alx moeilslm2ulnms (0 exoif3tytomte nvolt)srumxmpny4omtnmneilt)s2um(r ;t1optoifeilt a emuvpnt) exoxocta1lmD luvi s0sruoxo3nydoptn nvsl(fsDtm(monu1tpt iictlsfsDemn onu0 ltoirctodlaD lnvo s s2tmxm3iudal e ncs t)sDtmxm no4aet  f3iysfm ulnmp t) rxnir3to1fmD auvi s0setrxo3iy4lm  mfvi () 2rrxmpot1opt if3tyd s2umump;(4tleomrcoy1om  ai ol(  rxm(mpiydap elnct t)s2trur nu4apx mietydfa ranmp;u)artnio tydomDeli i t)truo(o3nudamt  ncsatfarurxmont1tex micild s el( p (4tltrxr3totfaD auvsls t2tmxrpio1lmenlnvilsfartrxmooo0ope  i3tydlsDul(vo u)tetrifciytlp   uvilt t2tr(opny4llenmfet s)aDrr(mo;o4optomoeiasfm rln pn()artrmo3ootfp ranvslt0sruoiopoo1opt mivs sfa2uaumpou0tltnmfeiat mDrluvo (4trxomf3tatlm rai s;t0srur(opnu1amt mivtls)aDuru  ;u0olt  oetldla2uan ont4trxomr ia1fptr neo;( t2xmxr ou1lm  lnviasfsrra(m ou4tlx mo3tadla um( snu0teerxf3tytomtraueo s)trxoxr nydamt lnct ( sDtrum ;t0aeeoii3ilsfm2em( s;u4 etrxr3oa1omDrli il( srtrxr ny1am nmfeslt)srrau pnt4oeenmfctytlaDeanmp u4 ltomo3ia1latrlu il( trtmiopio4omt mieilt sDrmu o;t0tee  feiytfaDrmnvp (4 renxr tatfa  luvi;s texoio iy1olenlfet ()srrm(rono4teen o3iysfaDulnmo (4arerio tatlmD  uvo;(0setrxr3io1op  mivi t  Dururont1texo f3iysls2rmnmpnu4tetoxo3totoptelu o;(0texr(m3iydlptnmfctas)s2rmuro;t1tpx mieiadlsDrm(mo t) lxoifcoy1latr ueo;t0 ruoxrpnu1am   ivtlt  Dtrur no0oeenmf3ilt a rau pn(4tetnmo3iy1faDr uvs () etmir3oy4alt  ivias) Dra(ro;t1tlenioeiyt m2umu o;u0 rermf oadoatranvi t0tetm(rpoo1ll nlfcs t)s2raump;u0aexnifeiydfs rlnvs t) leoxf ootfmt  nvols)srtoxrpiydopenmncil( arrm(rooo4opxnioctasfmDeanmp u)trtomf iy1omtrluvo t0 rtmxr3io1omte ies t)srtauroou1tptniieias aDra(vonu0trtnir3iotlpt aies s setrxmpiudlm  lncsl( arurxroot0oet iociad s2eln p;u4 eenxrcootoaD lu il()setr(m ny4lpte ieilt  2uaum oo0oeen icilt sDrauvo;u)alerxr oadlp r i s;() rtr(o3io4amtemneil(  Dua(  ot1tltnmfctldlm ulnmpnt0tlxnxocta1omte i slt0 etoxo ou1al  mfvsl()arua(root0tltomfctlt s umn sn(0trxomo3iy1la  livo;t) 2um(m3ny1ol nmncslt  2ta( ono1ope moeiatls emu p;()aetrir3iotfptr uvo t)t2trxrpoy1ol n iesa()s2tau  nu0openifciadfm elnvsnt0 rtomr oo1fp rlnvo;t truoio3oy1lmtnmfetl(f 2ur( ono1aexn feiytls2rmnvsnt0 exomfcoy1lmDr ivs;s srxoiopiydap  miesa(faDtmxmpot4tle iieias s2eln p;(4trenmf totlatr neols0t2uoiopny4op e nvias)a2urxmo;u4alenmf3iatlm2uanvs;()trxnio3iodomDran o ( truoxo3no1op e fvs ( aDtrxm ot1opx mi3tadls rau p (4alxoirciadomDrai il(0seurxm3nodomtnmfcsat  rtruro;u0optomietlsfa ulu s;u4 eenxf3oodfm e ivils  etmxo oy4op elivsa()srua(mp;t1tet  icild m rln on(4tlermoctodoa   n ils0teumxmpou4aptnlfctl(fsDtaumo;t0oet iocilsfa emn s;(0treoir oatfa e iesls)trtoxrpiu1ap e neias)sDuru pnu4optoiociys a ulump u0 lermf io1oa ran slt) etoxmpiu4omt lfcs sfaDtaxrpou4tpe  fciydfa eauvo t0 lenxr3oadfa  auvolt)texmxr no4op  mivs (fartru oot0apenmo3iaslm2eaumo;() eenmrciotfmt luvi;t)t2xr(rpio1lpt mfvsat s2trxmpnt4tlxoioeiyd mDelu p t0tetnmf3iodlmtelivols truoimpou1oleemfvtasfa2ua(r nt0tpxo feils a2um(mont4alxnxf iotfpD aneo;(0 2um(rpiy1op elivsls srrm( o;t1alx mi3iltlmDuanvs t0arxnmr ty1fmD  nvi;t0 eto(m3oy4lm e netlsf Dtaxm ot1ape mietlt a emnvsn(0 etomr totopt  ies ( srxoxm iu4ol nmnet ( artmxrpno4tetoii3ildfs rl(mp (4aeeomr3tydomtraivi;(0trur(rpoodam e netlt  rra(ro;o1aexnmi3iys m ulumonu0 etrmf iatom   u i t)s2ur(rpoodope livs sfsDrrumont4tlenmoeiytfm2uau pnt0texnxo3iodoatelnei (0t2um(o3io1lpt  fes (  2umx oou4aee iociatlaDean o;() exoxr3iytoaD livo s s2xrir ny1aptnmfeslt arrmur ot4olxn ictad s emuvsnt4arxrxrctotoaDelivolt) 2xmim3nu4apt  ncsls) 2raurp;o4oetnioeiatfsDumuvpn(0aetrifcoodlpt lu o s0texoxm nydam n ieiat arum( p;o4tpxo o3iydlaDrl(mo (4trtoioctatoaDe nvilt  rurio oodap e fet () Dtaxmo;u0optomfciltlm ea(mo;(4tlerxoctodfpteau o;t)srxo(m3oy4olt  iesas)a2trxrono4tpt ii3iasfmDrmump (0artnio3iatfmtelu s s)t2tr(opoodoptnlnvt t)a2ta(mpnu1apenmo3iydla2rau p u) eeoxrciadlm rlivo s  rtrim iudal  mivsl( sDum( ont1oex  fciatlaDeluvo (0aeeoxr3oydfp e nvo;()s2uoimpny1altnmivt t)aDraumpnt4aee iociltla umnms;t4 etnio ta1late ueolt seuoim iodamenlieslt s2umxr ;u1tpeniociytls uauvs;u0 ltrircty1fpDr ivi t0teuoim ny1omenmivsa(fa2rr(r ;u0tetoioctyd a uan onu0 rtrxf3oytlp eln ilt0t2uoimpoudlpen fctasfaruau pot0tlto f3iadlmDuauvs;(4tleomo3oatopt  u s s  2xr(m iudlpeemici sfaDtax pot0tpenmo3iys mDrl(mo t0 rtrxf iadfa elu s;()seuoxo iydol   fvsasfs2tauronu0olx  ieiasla el(vo u4 eeoifciotomt livo;t0 rxmir3io1omt mnvtlt  Draum oo1tptnii3iytfsDuauvonu) lerxocia1fatrlnvo ( t2xmxr3oudopen fetas a2rr( p;o1apto o3tytlmDulu s;() rerifcoa1lpDean s;()teumxr iu1al nmfctat) rta( o;u4oetoif3ildlm2rl( o u4aetomf oodoptelnvil(  exmim oudlpenmicil(  rrm(r no4opeoioeild sDul(mpnt4tltnxf3iadopteaieolt s2xrxr nodlle  fciltfaDrax o;u0tpen f3tlsls2ua(mpn()aetomr oo1fate n i (0seur(mpio1openlncsa( a2tm(rooo0opeoif3iasfa umn s u4 rtrmfcoadla  li ol()t2xrirpnu4lm  mici ( s2umxmpou4tpeomociyt s ea( p;()aexomocoo1la   ieo;s) exoiopoydalee ncsa( aDtmxmpou1olxoiiciasla2ul(von(0tltrmocta1faDrai slt0teum(m no4amt lfetltfaDra(rpnu1aetomicild m umnmonu0 etnxo3to1om  ai s;( seuoir iudam elnvi tfsrtrur ou4alenmoeiysfm2elump;u4trxoxo3oo1fm  aieo;s t2trir3iu4al emnvilt) Dtrum ;o1oeenmfciyt aDra(ms;u0aexnio3oodoa   i s ()seuo(r no1lle lfvs s arrrumont0ope if3iltfs ulu o;t4 lxoir iy1fp r neo;t) euo(o nodlleemnvt ( aruaurpot0tlx iociys a ranmo (0trxrxrcoadfmDraivol( trur(m oy4opeemnvsl(farraur ot1oltniiciys s2raump;t4 exoxrcoy1fp eaivi () rum(rpny4om  lfcsas  Dtau pou0opeoifciydls rm( s;t0 rtoxo3oatop  lu s t s2toxrpnodalenmiviat  2ua(mpou1optnmi3iysfaDemuvo (4alerif ty1latranvs (0s2uoim3oy1lpeemieiat  Dururono0oee moctldfa2rl( o t) exnir3oydfmtr nei;s0 etoxm oy4lmtelnvsa()aDumx onu0aeeo f3iytlaDelnvs (0aeerif3oa1fp raivols0srur(mpiydap n fesltf 2rr(rp;o0tltnmocildfm2rmumo u0alerif oadop  lu ols)s2urirpiodamte ieslsfsrta(  nu0tee  o3iydls2rl(vs;() lxnmrctodlmte i s;()srxrxmpou1op   ict tf rraumono4tet iiciaslsDem(vp (4trenir io1la   n o s0sexo(r3nu4op   ics ()s2rrxrooo1tpt  fciysfa2rmuvpnu)tleoif3ia1lp eai i () eur(mpnu4ol e ies t) Dum(m nu0alxnio3ilt aDea(vp u4treoxr3ta1opt  i ilt sexmim3nodlptelics tfsDur(mp;o1aee ii3iyt m2eln o t4alxoxrciodfmt  nes s)s2xr(m3oy1lpen iciat) Duax p;u4tpto ietatfa2ul( p;(0trerircty1oa  lu ol() eumxm3io1lpen iesas)s2raum no1alx  f3iys mDem( p;u4tltnxf3io1omD auvi s seurxo3io1alte fvil() rtru p;u1tlxo ieiasfm2ran pnt)trerxocoa1lmDr uvo;s trxrimpnodlpen nes t)aDrmumonu1oeeo fciasfm2eanvo u0tlxrmrctatfa e nvs;t) rxrxm3nu1ap n nvsl()aDuaxmont4tlxnmocildla2rln p;u) rtnmr tadomD lnvo () rxmir3io4ale lfvt t) Dum(mpno0ole ifctlsla2eanvs;t0 exrif3totlmtelnei;( t2um(r3oydlmtn nctltf rtrxm ;t0tlto ociytfa eauvs;u0teenxf3oodopDr n o;s s2trxm3iy4ap  mivi ( a2ra(moot1alx iietytlm rl(vsnt0arxrirctotlpte uei ()trtoim nydlpeelivil()a2umur nu1aptnii3iydfs ulu snt)tltrxo3tytfpt aues;t)teto(r3nu1altnmnvt s  2tm( pnu1optoiocilsls2ea( s;t4trxoxr3oydfaDeanes t0t2uoim3oudameeliei ( sDurxr no4texoif3iyt aDumu pn(0 etnmo todlmD aneo;s srurim oy4alenlnei t) 2uaumpno1olxn octyslsDeau pnu4 lerio3tydlpD li s;s trxoxr3nudoleemicsa( srrauroot0tltnmocildlm ea( p u0artrxo3ta1oaD aivol( s2urxo3ny1apenlics () 2urxrp;o0aptomfcilsfs eauvo ()aeenmocto1lp eln s t  exo(opiy4ol  lfvs sfarra(m ot1aetnmietyt sDulnvs u0artomr3todfpt anvils0texoxrpoy1lp  mieta(  2rmumo;o0apx  iciys sDrlnmpnu4 rerxr todop  lnvsl( t2xm(r iudlltn ieias)sDua(mono4tltn i3tldfa ul( pn()trtoxf3ta1oaDe i o t)s2xo(mpio1alenlfctatf 2rax p;u1tetn feilt sDulnmo;t)aetnmf todfmteluvi (0 euoxrpoo1om elnei t arrr(moou0oltomo3ilt aDraump u0 lenmociotfpDr nvols)seumir3oo1openmivs t artmu pou0oet  o3iltfs2elu sn(4tlermr oa1la eli i s0texrirpoodll n nesl() rrm(moou0tlxoifeiyslm ra( s t)tltnxrcia1lm r neo;t  euoxm io4am emncsasfs2raxm ot1tltnio3tlslsDrlums (0treoxo iodlp ran i s sruo(o iydap  lfvs tfs2ra(  ;u1tlt moetys sDeanmonu0alxrmr3oa1fat  u o ()srtrxm ou1altelfctltfarraxro;t1open feiatla ulnmp;t) etrxr3tytfatr ivo s0t2xm(m3oydale mncia(f 2tr( ono1ape  i3iytfm2elu p;t4trtrxoctadfa e u i;() rxrimpnu4olenlnct t srtmur ;u0oetnmfeiat sDumu p u) eenir3oa1lpDe i slt0srxr(o ny4lmtnmfvt t) rrmxrp;u1tetn o3tldlaDulump t0texnmr ia1lm rlu o ( t2tr(rpno4ome  ivi t a2trx ont1opxomoetyd m rmn s;t0altoir iodlmt livsl(0 etm(o oodoptnlicsl(f 2rm(m ;t4ape miciyt aDuanmpnt0 lxoif3ty1latrlieo;( srxo(rpny4aptnmfetl(fa2uaxrp;o1apen fetysls2elu s (0aeeoifciydopDran i;( t2xmxm3oy4ame  ivtls aDta( pno1aeto fetat sDea(vo;(0trxnircoydla   ueslt0teuoxo nu4lmte ieta()aDrm(moot0oexnmociydfs2ulnmo (0aexnxfctadfpte ues s)trxmio iy4opte nctat a2tmur ;o0alxo i3tysfs2ulumo t4trxrmf3iadfm ran ilt t2trim3ny4lm nlnvtltf rrrx p;t0apt ioctydlmDea(vp u4tleoif3ootoptr uvs (0 2trir iy4lm n netas  Drmuro;o1alt iictls m2ulu pnu4 exoxo3ootfm  auvolt)teur(m iudopenlieilt)srtmump;u4oleomi3ilsls2rmnvs;t)alxoif3oy1lptr uesl()teum(r oodaltelivslt) rrau o;o4oetomfeiltfa2eluvon()aeeoxf3iadlmDeaivol(0setmio3oudomtemfctls)s2ra( oou4opxo ocias a elnvsnt4aeerircoodop  lnesl( tetmiopoy1altemfctat)sruru  ;u4ale ii3ils m2ua(mont4texnir3tydfa rlieo () 2trio iy1amtemict () 2uru pnu1apen i3iys aDuaump;(0aleomo oy1lmD  nes s0 etmxr nudom   ivsl(f Dta( ont1aet ifeiatls2umn o;t4 lxrmrciytlptrlivolt  exr(r nydoptelivt sfs2rmxrpno1optoiiciatls2em(vo;t)treoxr iodfptelnvi t0srxr(m3nodolee ivta( s2tmum oo1ale mictlslmDumnvs;t0 rtoxr iytoptran olt s2xrirpoodllt lictat) rraxrp;o1oltn i3tlt mDran pn(4 renmf iodfatrli ilt)seuoxopiodal n fviat srumxrpou0apxn ietytla2rlu p t4aexnxf tatopt  ivol(0 2umxo nydoltelieiatfsrrmxr ;t0alto iciatls2eaump t0trxnmrcto1oa ran o;(0srtmim3ny4lm nmfcsas  2raxro;t1aetn ieias s2umnvs;(4alxrxo3ty1lp  lues;s0 rxm(mpio1ole  nviasfsDur(ront0aptomo3tlsfaDra( snt4 eerxfciatlat  n o t  exr(r iu1lmenmieil(fa2rrurono0tpen o3iyt a emu on()artoio3ty1oat anvslt0seuoir iudope mnvsatfs2rr(moot4aexn feildfm rl(mo;t)teerio3iotopD livi;t)texr(opiu4ome mfeils) 2rmur ot4aee ioeiytla2rmnmo u)aexrxf3iodfpt  nvil()teuoxr no4aptnlies tfs2um( poo4alenifeiytfm2ran o (4 exrxr oodopDraneolt)teumxopiydap emfcsls  Dtaur nt1tlx ioetlt m2rmnmp ()tetomrciodfmtrlnvs ()t2uoxm3nu1ameemncs ( sDtaxr ot0olto o3iadfm2ranvpn(0trtoir3oodom r ivsls)trxm(o oy4al nmnvtat  rtr(mooo0tlx iieiytls2ea(ms;()trtnir3oatfaDe ueo (0trumxm3oy4lm elics t) rtrumoou1olt moeiasfmDul(vpn()tlenif3oy1opDrlieo t t2xoxmpnodol n net s)arrr(rpnt0apenmfeiyd s2rmn p;u4 lxrir3oydfm   u ols)trumxo3io4ol   fcsls) 2urxm ;t4tpxo ociyd a ean pnu0 ltnmfciadoaDeanvs;( s2tmxr3io1op nmneilsf Dumxmo;u4tleo fctadlmDum(vs;t4tltoif3iytfaDeanvo;s seurirpnodalt  fvia( s2rmx o;o1aeeoioctasls2uau pnt)texrmo ty1oaDe i o;t) ruoxr3iy4lptn fet sfsDum( o;u0tpeoioeiltfs ea( o u4texoxrcoy1omD ln s s setrxopnudam  lneslsf ruru o;o1aet  o3tyd mDrauvs t)tlxomr3oadfmDrlueo;t)s2toio nu1ap nlfctas  Dtmu  ot4opx  oeiydls2el(ms;(0teenio3ty1la raueol() 2trim3nu1op  lfci (fs2umumpot4openmfctytlmDem(von(4 leoxfcoytlmDeaneo;t0t2xm(m3iodap  lfvias)sDra( poo1altoiociad m emuvp;(0tlxoir oytfat lnvo;s trumxr io4opee nvias  rtmumont4aex moeiadfs2umu p t0 rtoxr3oy1optean s;(0t2tr(o iy4alt lnciatfs2rr(m ou4oleoiictyd s ul(mon(0 ltrxo3ta1omteaivo;t0 ruo(r oy1al elicsa(f Dua(  ot4aeeomfcildfaDranvp;t) etrircoytopD lnvslt tetrir ou4op nlieiat artau p;t0apxomo3ildfa2rmu on() ltrmf tytlmD au s;s  rtoim oy1lptelfcil(fsDrru p;u4apt miciasfa2rm(vpnt) exnio3ia1oat anei;(0trtm(m3oydap nmnvt s) rtauro;t4olto oeildfa emn o;t)tetnmo oodlptelnei t) rxmx
\ No newline at end of file
@@ -0,0 +1 @@
+uvi s s2toir3iy1al  micsls)srtaxro;o0aleo ocilsfs ulnvpnu) rtrxrcoa1faD li i;( s2umxo iydam n feil()a2tm( onu4olto feiydfsDrau p;() lerxr oytopte ivs s  exrxopno4ope mfcs (fa2uaxmpot0alxnmi3iatla2uau s t0alerir3ootfat luvs t seuoimpno4al n ivilt srur(rpnt0ape ifciysfa2ran p (4aetrxf3oa1lm elnes s0truoio nu4lmtnmfei t)a2rru p;u0opx mfeild sDulnvonu4altnmrcia1omD lieolt)srum(o iydlpt lnei (fsDrr(mpoo0openmocildla rmuvp;u)arenxo3ootop  auvs ( srxr(opoy1omtemicsasfaDtmxmp;u4tltniietydlaDul(vo (4aexoifcta1fa r nei;s0srtmxo3nodlme lfviatfsDurx poo4tpeniiciadlm emn o;u)tleoir3iodfatraivilt)sexoim ny1alenlnvi s sDur(r ot0apxnii3ildlm2emu p (0 exrxo3ta1opt li ol() 2tmxo3oy4lpt  nci ( a2ra(rp;t4tlxo f3iydfs ulumont)tetrxo oadlm ean s s)trurir3oy1lp  mfvias aDrr(r no4oltnmoctatfsDua(monu)alxnioctytla raneo t trumxm3oy4om  lnei sfsDrr( pno4opx moeiad s emn o;u0aetrmfcta1lm raiei s)s2trxr3oodopt licsas a2tr(m ot1apeo iciyd s2umnvo;()altrircoadfptr nei t t2xoirpiy1lpeelfcias aruaxronu1oeeomfetys a2rlumpnt)aeeoxrcio1opDeluesl(0srum(rpiodlmt  ncs ()s2uaum ot0tpx ifcilt m2rmnmo t4 ltnmocoydfatr n i;s srumimpnodamtelfei s srurumoou4oex  ieiyslsDulu p (0 rerxociytfat luei (0 2xr(mpiydaptn fcs t s2rau oot0tpe  fciat mDumuvp (0 eermo3ty1omt aiei (0 etrxopoo1ap nlncslsf Drrxro;t4tltomieiyd s rauvp u0trxnmf totopteau s;t0 exmxopiy4aptemicsa(fsDrm(m ot0tlxo ieiad a ul(mpn()tltnxfciatfa e nes s0texoir3oodop nmfvias)a2umurp;o1apx mf3ildfa2ua( s;u4arenif tadoa elnei s)setoxopoy4lltnlnet tfs2umx pnu4aee  o3iadlm ea( s t)artomocoydlaDraueo t t2xoxo ou4am  lncsa( sDrm(  oo4oet  ociadfa emumo u0arxrxo oytoaDraieil(0s2umxmpiu4lpe mfvslt s2rau  nu4tlenifctltfs ra(ms;t0tltrxo ia1lpDrai olt t2urxmpou4amte ieil() Drau  ou4tpe ii3iad a ea( onu4arxrxr3oadla e ivo;t) exmimpiudlp nmnvtlt  2tm(mpno0apxomfetadla2rlnvp (4trxnxr3ty1fmDelu s t0 2uoir3oo1altnmfvt ()s2umuroot1apxn oeiydfaDumu o ()teeoxfcoy1lpte i olt0t2xrxo3iudop n ncslt)srrrurp;t1aet iieildfm uln p;t0 etnir3iydlpDeluvi;t0tetmxr no1oleemfcia(f rraxm nt4opx  feils m2umu s;u)tltrxo3io1omD aueolt trxrxo3nydal  lnet sfaruax  ot0oex iieiytfs2umums (0aetomrcoa1om raivi;s)setmxm3ou1lp e feia(fs2ta( oou1aexnioctld m2ulnmsnu0artrmf3oydfa rlivolt0 ruoirpnu1al e fei s) 2umu  ;o1opx micilslaDrmuvs;t0teermr iotomDr iei t s2tm(r3nydlpeemfeta()s2trumpoo4apxo o3tadlsDrlu o t)trxomf3iodopDeluesls t2xrxopoy1op  lnet s  Drrx  ;o4ale mo3tas aDran p;()trtrxociy1fa r uvol( sruo(o3iu1lmtnmicsatfs2rrumpnu4ole ii3iydfa uau p;(4arxoifciodfatelu s;( t2ur(o3oo1am n ivi t arumu ont0opxnioeiytfsDrau p;(0 eenioctatopD  ivils texm(mpiudomtemfei s  rua( ont1aptn ieiyt a elnmpnu4altrmo iytoa  aneols t2urimpou4al emnesas  Drrxrpoo0ole ii3iydfs emnvpnt0aleoxrcta1fm   iei t)trxm(m3nydome lfvs s  2rrxmoot0alxo ictydlm ra( pn(4 exoxr3totlmtelnei;t truoxopiy1amt lnvsas)artrx pnu1ope mfetydlm ua(vo u0tlerxrciadomte u o;s  2tmiopiudlme mfeslt) rraxrpou4altoifctys mDel(vp;u0tltrxrcta1fp  anvi s0 2toxmpou1lpeelivsl(fsrra(r ;u0aeenmfeiadfm uln pnt4aeeomf ia1op rlu s;(0trtm(r oy1oltnmnesas) Dra(mpoo4alen feildfm ulu on(0aetomociodfmDeli s s0teum(r ny1ol  mnei tf Drr(r oo1aexn o3tys m elnvs;t0tetnxo oa1omte i i;t sexmxo oudop elncil( a2tr(ront4olt ioctydlsDean p;t4 exoxo3oa1opDelnei;s0teumxm iy4apenmncs s) 2tmurono4aexomociysls2eauvsn()aeenmo ootlm ran o;t) exmxo ou4opte fctls) rumxm ;o1teeoioeiydlmDrmn pnt0 ltomrcty1latr i s;s0srtmxm3nodlp nmivsl() 2trur ;o1oltomociatlmDumnmont) rerxr3iy1fate nvi t)srxm(rpno4alenlnvtl() Dtru ooo1aetomfciadfm rl( o ()aeeomf3oo1oa   nes;(0t2xo(mpio4aleelnvs s)s2ua(mpot4ale  ietldfs2rlnms u4 etoio3io1lm eaneo t0srtrio3iudlpeemfcs (faDtm( pno0aleoifctasls2ra(mp;t)trxnxf oydlaDe uvols0tetoio3iu1open nctatfaDtaxmo;u0tex if3iydla2el(mp;(0trxoif3totlp rlu o t0srxrir3ny4ap n ietl(fs2raxm nu1oetoioetas mDemnmo;u) lxnxr3iydomDe u i t)trum(o3iudope  fvsatf Dur( p;o0texo ocildlm umu p t0aeeoifcia1omteauvsls  rxmim nudaltn nvi tf 2uaxrp;o4tlxnmietasfsDul(mp (4aeenxfcootfmt aivo t)t2xmxmpoydaptn net ( a2umxrp;u4tpto oeiydfm ulnvp;t)arxomo3tytoaD li ol( seuriopnudllte icslt)sDur( p;u0oltnmieiltfmDrm(vont4aeenxr3iodlm e ieols) 2um(opoy4lmtelnvs t  Dra(rpnt0aexo o3tlslaDra( o t0 exnmf todfa eaieils)t2trim iy4amenmietls sDtau pot4tpenmictadlmDuauvp t)trxrio3oodoat lu o ( srxmimpnudamtnmictl( srtrumoou0teenifeiadfs eau o t4 ltrifcoa1optelieol(0texm(rpiy1ol e nesltf rrr(mpou1alenii3tasfm ul( onu0alxrxf todfpDr ivo s  etm(m nu1alen nesltfarumxmo;o1opeo oeils mDemnvpnu0alerircoydop  ln s;(0trxmxm3oo4ol  mics t)srta(rpno1oleo i3tlslsDel( p;() ltnif tytoa  auvilt)t2xoxo3nu1opt mneta()s2um( o;u4alt iiciytlm emumpnt4artnmf3oy1opDelies;( trurirpiy1om nmfeia()aDua(moou1aeeomiciatfmDumump u)arxomo oatfmDeaiei ( trto(opno1aptelnvt ()aDra(r nt0opto oeils sDrm(vp ()treoif3iytomtrluei s0t2umxm ny1om  lfcsasfaDta(mono0tptnmieiydfmDulnvo;t0 ltoxf3tatfa r ieilt) euo(m ny1oltnmfvi t arraum ;t0alenmieilsfa2el(ms u) rtomr ia1oaDrlivsls0s2tm(opio4lltelncilsfa2tau o;o1oetoifeiaslmDeanvpnu0tltrmfcootoa  livo s)trur(m3oudap elfetat)aDtrxrpnt1tleo fciatfs eanvs;(0 ltomr oatlp eliei s s2xmxo3no4optn nvia( sDra(mooo0oex mo3iyslsDemnvo;(0alxoxo3tatfpte n s t0srto(o iy4omtn fciat)s2rr(moou4apt iieiat sDeln s t) rerxocootlm eanei ( teuoxr oodlptemfei ( srrau  no0opxnmocildfa2ea(vo;u)areoirciotoaD aivol( setoxo3nodamtnmfes () rtm(m oo0texniietysfs elumpnu)teeomo oydfmDeli o;t) etrxrpiydoleemivsasfarumum nu4aeenmo3iadlmDumnvsnu4 eeriociy1fpDr nvi;(0teur(m3oudam  micsat)a2rmxrooo4tlx ii3tad a2ulu p;u0 exrif tydlmDe ueo;(0 rxm(r iodape  icsl( sDur(mo;o0tpt miciltls2elnmo;()alxrmo3iydfaDr nei s)trxr(o oo1lltnlfctltf Dra(mo;o0altniieildlaDeluvo;u4aeenxf3ootopt li i;t)texoio oy4alee ici (  Dtau p;o4apeoifeils m2rluvpnt4texnxrciotoaD ln o s0trto(m3nodol nlivta(f rta( pno0oeeoiieilt a rlums u)areomr iotfm  livs;t0texrxr3oy1lpeemict t  2trur nt1olto feiasls2rlnvpnu0tltrxf totomDe ivi;t0s2xoio3no4lptnlnesa( a2tm(mpoo4altoioctys s2umn o;t0 lerxr ootlmD ai o;t t2tm(r iudalenlnvia() 2tr(r no1oexnmocilsfm ranmon()alerxr oy1la  ln il(0 2um(m nu1ape lfvsasf 2tm(mpou0tlxn oetydfs2rlumon(4altrmrcia1oaDeluvo ()seto(o no4alenmncias)arrrxmpnt1tltnio3tltfa2ran pnt4 rxrxfcty1oatraieilt trtrxm iu4lpt mfvtatfarrmu pno0tleo f3iadfsDeau s (4alxrxr3tydop  luei s) 2to(r3no4op  lnes t) Dtrxr ;u0optoiociydls2umumo;()texnmfctydopDe i i (  etmir3no1alenlfes t  rtr(  no0oexnmo3ils m2rmnms;(0arxrmr3iadoaDr u sls tetriopnu1alt  fet ( srra(m ;u4tetnifeiydlm ra( s;u)treoio iy1oaDraueils  rtmimpiudapte net (  Dumum ;t1tpxn f3ilslm emnms;u4aetnxo iatlp   uvs t  ruo(r3iy1ope  ies (fs2raurpou1alx  feiatfsDuaumo;u)trxrxr3tytfmtr n o;(0t2toim nudlm emfeils)s2raxrpnt4tetomf3ias a2umnmo u)aetoxr oatopt li s;(0s2toio3no4llte nci (fsrtrx ono0tpx  ocias m um( snt4 ltnmf oy1laDrluvs;s0sexrxrpoydll e ivs (  rua(mpot1aetniiciytla emumpnt0treomocta1fmDeau ol(  rxrir nydalenmieslt s2tr(rpoo0altnii3ildlsDul( s;() rxoifcootoa elnvi;s0 etrir3nodom  mictat srur(  nt4tlxo ietys m umumsnu0 exrmrcia1opD ln i;()sexmir3iydop elfvtl()aDurxro;u4olt iictlt m2uauvs u4 rtomrcoodla e uvslt0sruo(opoo1lmt  netl(fa2um(r no4oleoio3iadla2eanmpnt0tltnxf3iadomD  ies;()t2trir3iodlp  mivi t sDurxmo;u4oetn fciys s2emuvp;t0 rxrir3tytfp  aieo t)s2xm(r3iy1lmte fvtatf Duaxmp;u0alxnioeiydfs rlu p;u0arxnxo ootoa   nvils0teum(mpiu1lpe lnctls arrmu o;u1opx mf3tld a2rl( o;(4tltrxf iodfp eau i;t) ruoio iu4ol nmfvs ( arumxrp;t4tpto iciyt m2ea( o u0treoxf3ty1omt luei s0setm(o oy1apt mnetlt) rrrxmpoo4aeenifeiasla ua( s ()areoxr3iydfaDeau o;( tetoio iodlmee icslsfsrurx  nu0tlenioeiyt s rmnvsnu) rtnifcoatoa e ueo s0s2trxr3oo4lme lfvi t)s2tmx o;u1olxo f3tadfsDua(vsn(0 exomf tatlaDr u i s) euoim oo1lleelfvs tfarua( onu0oex iociydla elnvp;u0 exrifciatoptrlivi;(0 rxr(r3iu4lmt mnciat a2tmxmpnu0aetomfetysfm2eluvpn(4alenxo ootlaDraneo t0srur(opnudom  mnci ( sDta( poo0oltnmf3ild s2umuvo;t0trtnir todfpteauvi;t  exmxm nodam nmnet (  Duaxr oo4tlenmf3tldfa rmnvpnt) lxoxf iadoptraneils  rurio ny1om e feiat)aDrm( ono0tlxo feiyt a2em(ms;(4 lxrmocoytfmtrli s s) exmxopnu4ame licsls) rur(mp;o1apenmocilt s ranmsnu0trxnxf3ta1oa r n sl()s2xm(r3iy4opeemfvs s)aDra(  no4apxnmiciasfa uaump;u)altrir3ootom r nvo s  exm(m oy1lmtn iei s) Dumxr ot0alenio3tas s2rlnvs;t4trenio iy1laDeluvol() 2uoiopoo4lltemfeta()aDumum oo1optn ocilsls rm( o;u4aeerxfcty1fm  au o t0 2uo(r3io1opeemfviasfsDta(r oo4tetnmieiydlm2emu s ()tltrxrcoy1fp  ai s;s) 2xrxm oydolenlfcilsfa2tmx oot4tptn iciydls2umnms (4trxoirciydfmDeaieils) rtm(opno4ap n fctltfaDur(rooo4texn i3tlsfaDua(vonu4 lxoxr todfa raies (0 rumim3nodolte nci sfsDtaum ;t0tpen feiad s2umumsn()aeerir3io1fm eliei ()setmimpiodap emncta()srtm(ro;u0oltnmoctas s uau p;(0areoxo3iytlmD ai i t  rtm(o3iodome  fvias srumu  nu4tptnmf3tlt mDrluvo (4trxrir iadfpteaiesls0 rtrxmpnodope  nvtl(fsDtaum no4apxo fctyt m2rlu o u4 rermo oa1fpDeai slt  rxoiopoudap e fetas) Drmu  ;u1ape mieiadls ean s;(0arermfcoytfa  luvilt0s2xm(o nudome lfctas  rtmumpou0teenioetltfmDelu s;u0aetoxrciadlpD an s;s srxr(r oudome lnet t aDuax  ;o0tpx ii3tat aDumn o u4texomrctytfmte nvs;t)t2tmir iy1al nmivt () rtrum ;o0tpt mictytla ulu pnu)tetoif iatla r neslt  2tmxm oydll e fei t) 2um(mpou1tpxo ociydla eau o t0aetomociatfpte n i;t)srtmim3iydom emfesas)s2rmx pot4aex if3tld a rmn o;(0trxrxf3todlp  livo (0setm(o oy1om  lnci ( aDum( pou0tee mfeiyt mDul( pnu) eeoxrcio1fm e ivi;t t2urxmpiy1ol  mncs s)artaxr ;o1ale mictldlmDeau p u4alxoxrcoo1lmte ivo;(0srtoio ny4ol nlivtls a2rmxro;u0oet ioctydfaDemu p t)aetnmfciodfpD au ilt0trxr(r io1apeemieil(farrru oou0ape ifeilsfsDea(vs ()alxrio3oa1oaD  i olt)tetmiopiy1ll  lfvia()aDua(rooo4optn oeiadfm2rauvpnu) exoif3totlatraieo s0 etm(m oy4al e ncs t) 2urum no1oetnioetasla rmnvo;u)trxrmf ootfmD li sl(0t2tmir no4lptemfesas) 2rmxroot4texn o3tyd m2ulumo u4 exrifctydlaD luvi t tetr(o3io4apt lnvi t s2uru  nt4aetoii3iysfsDraump;u0texoxfciotlpD au ils  rum(r3ny4om elncsatf Durumpno4aeto ictadfm el(ms;(0 renxo oodfa  aueil(0s2tmxo3ny1op  lnctls) rurxrooo4altoifetysfa2rau o t4treoxrcoydoa rauvslt srur(r3io1oltemies sf 2urumpnu4optn i3tyd a ua( s;(4areoircoy1lpt li i;t0 eto(r3ny1lmte ivi t s2tauro;o0opt mfeiatfa2uauvonu)trtnir iatla e nvs;t0 eumxmpiudapt mietl( srrr(rpoo1oltoifciytla ea(vsnt0tlenif ootfpD  u s;() etmxr3oudamtnmfvsas  2ra(mooo4oltniocildfa2rln o;(0trtrxo3oo1fptranvi t truoir oy4ll  lnci (fs2rr(r ot4ape mietyslm2ua( onu0tlermr3oodomDe u o t)s2toxo ou4lp elfciltfsrrmumo;u0tex  i3ildlm ea(mp u) etoxo3oodop rlnvi;t  2urirpnudlmen fcsat) 2rrxr ;t1alxomi3tyt a ra(mpnt0areoxrctytomDrlivilt trxm(r3nodolenmictat  Dtr(  ou0apt mieiltfsDumnmp () exrxfctadfa raies s0s2urxm oy1ol  micil(f 2urxm ;o1aetn o3ilt s2raumsnt0altoif oydoptrlneol() 2xo(o oy4llen nesas) rtmu ono1oexnioeiytfm2um(msn(4 lxrxr tatfmDe i ils srtm(o3io1omenlivsasfsrraump;t0oexn oeiadls2ranvp;(0 rtnmf3tydoaDeaieils0 rum(o3ny1op  mfvia(  Drrx oot4opx ioctatfm umums;t0tlxoir3ta1lmD auesl()tetoxo oo1ap elfct sfarrau oou0tlx mocildfa emuvp t4alenmf3oadlp  aiei (  2trxmpnudllt mivsl()aDrmuront4alxnifcildla2umnmsn(4aexrxf ty1fate i i;s trxrio3oodamen fcilt  2rrxmpou4apx  o3tadlm rau p;u)tltrmoctotomDr ivi s0 exrir iydlm e neiasfa2tr(roou0aptoioctad s2rmumsn()trtnmr3tytom   ivi;()teur(rpoy1olee feta(f 2ur(m ;o0ole mieiadlm2elnmsnt0arenio3oa1lpDrln i (0seumir oodolt lietlt) rtmuro;u4oexomietltfaDrln p;u4 rtoio3oodlmDeau s s) 2um(m3ou4op e nvsat  Dtrurpno0tex mo3tasla eaumo;u)trerifcoatop   uvs t teto(mpoy1ol nmnvsat)arraxm no4apt  o3tltla2um(vpn(4aexoxo oodfmDrluvol()t2umxr nodameemneils srum(  nu0aeeoii3tydlm ranmpn() ltoif3oo1omDelu o t0 2xrirpiudap emfvi s) rrr(monu4tlxn ociltfs eau s (0 lxnxr oodfaDeaies t)s2xmxm iy4ll elnctat)aruau oou1tpe moeildlsDrm( p (0 exnmf iadfm rlnesls)srxrir3iy4ap nmnciltf Duau p;t4aetnmf3ilt m2ra(mont) rtnio ty1laD aieo;()setr(o3nodol  lfctl(f Dururonu1tleoifciadfm ranmsnu0teerxf3tadlmDrli o;()trum(r3nudal nlfcilt aDra(rpnt4tex iictltfm2uan snu0 rtnxf iatfmteluvol(0t2umirpnudll elivslt aDtax o;u1altomietydla em(mo;u4tlxnxr3ia1fmte nvsl(0 exoirpnu4om n nvs ()aDra( pot0tee  f3tlsfsDean s;t0 rtoxo tytoa   ivolt)teuoim oy4alt lfcsltf 2uaxm nt1ope mo3iyd aDeanms;u4 reoxf oadfateaneo;(0s2to(opoo4ale  fesas)arrrx  nu1aet ifcilsfaDrlnvp ()artrxo3oodlmDelu olt0 rtoxm oy1al e ieil(  Dtau  ;u4alt iociat s2ua( o u4areoxfctatfm  lueo;()tetmxo3nydlmtelfvtas)sDtmurpou1apto f3iyt mDrlnms;u) rtnmr oadlptr i ols0 euoio ou1lptnlfvtls sDum( ont4oeenmoctyt sDum(vsnu0 lxoio3tytomDeaneo (0s2umir no1ll nlncs s)s2umxmo;t4apt mfeiyslm2rlu o;t4teerio tadopDe i i;t)setoio3nu4amte nesl( sDurumont1openmo3iys m2em(mpnu0tltnmr3tatfatelivol( trxmxm nu4altemiviasfsDuru p;t0tetnmf3tldfa um( o u4 lxrmr3oo1oa  au s;(0s2tm(r3no4ame mivsas s2tmxmpno1aetnmi3iys m rmnmp t4areniocty1oa eaueol(0 2xmio3iu1lpt miesatf rtau poo1alt iiciytfm2eaums;t4 leomo3oatlpDr i i s0texmxm oodll nlicsa()aDumu  nt0olxnmi3ildlm uan o ()aetoifctatlaDelnes;s)trxmxm ou4omt lfesls  Dta( onu1alt ifeias sDel(mo;(4alxomo oatfp rauvs t0 eumimpny1olee fei (  rrr(  nt1aet ioetatfs em(vp;u4aetnmfcoatoa r uvi t  rtmio iodomt mfvslt s2trum oo4alt moeilsfa uln p t4teerifctadfa   ueo;t)trtmxm iydomtelfci (f rrr(m ot1tlenio3tadfs2rl( p (0 rtnircoydlaDeln s t0 etrxo iu1lmt lfci (  2trumpou4tltoii3iat a emuvpnu)aetrxo io1opt ln i;t0 2toxr3nudllt mfetas a2uaurpnt4tlxoii3tadfs2umnvp t0 rtnmo oo1fm rlnvi;()sexmxrpny4ol nmivsa(f 2rmxrp;o0tleomfetatla2umumsn(0 leomo tytlmt an s;t0srur(opou1oleelneta(fs2rm(moou1oex mfctltlmDrlu o (0tetnxr to1fat  nvo;t0s2xoxmpnydlpt  neiltfaruru onu4tleniietlsfs ean on()tltriociadop eluvol(0srtr(r3nu1am  mfvilsfaruaump;u0tetnmfeiadfaDuaumsn(0 etnmrcoadlaD  neo (0s2xrxrpiu1omenmictls a2rmxmpnt4altoiociydfa ea(vo u)trxrmf oytfmtr n il( trtmir oy4amtemfcia(  2um(rooo0oltnii3tltlsDelumo;t4artrmo todlptrauvi s0seuoirpnydlpee ncslt)sDrmxro;o1oet ioetas mDeanmont4artniocoy1fp e uvs;s) exoxrpiu4ol nmfetlt) 2trxmp;t1aexoio3tatlmDea(von(4trtoxfcoatfptrauvils0teum(opiudomtn nesa() 2rau oot1tet mf3iltlsDelnmo ()trxoxr3tatom  liei t sexr(m nu1alt mfet t arrr(r oo1apt miciltlm2uauvpnu)artomoctydfptrauvs t) etoim3oo1lp  mncsas)srumuro;u4tpe  f3ilt a2el( o t4alxomfcoatopDraivo t s2xoiopny1am   ics t)sDraumpot0tpxoii3tls s ranmpn(4trtoir3iydfpDean o;s seuriopoy4apte feil() ruaumoou0tlto ociysfmDrlu o;u4 lxrio io1faD au o;t0texrim3oo4lmenmnvta() 2raxrpnt1oetnmf3iytlm rauvs;u)tlxomf3tydom   u i (0 euoio ny4apeemnvtatfaDuaxro;t1oleoioctld sDelnmont0treoif3oytoaDrlneo;(0sexrxrpny1ape mies sfaDurump;t4oleoioetltfsDrl(vp;t4 ltrxo tatlp  ln ols0trtrxm3iu4omtnmnvslsf Dumu  ou0tlto iciysfs ra(mo u4 etnxo totlmtranvi s0s2um(o3nu1ll  mnvia( aDrau oou4tlx mfctld m ulumsn(0teermo3oodfa  lu sl( srumiopoy4lmtelfetlsfs2tmx p;u1aet mfetlt s emu on(0 lxoifcoatopDe n s t0trxm(o oy1ole mnctltfarta(mpot0apxoii3tydlaDum(vont0 etnmo oy1fpD liesls0s2umio nudlme lfcsas a2ua(mp;t1tlxoifciltla2rmuvsnu0texrmocto1fpDelu slt0s2urxm iu1lp e fvsa()sDuaurp;o1apenmo3ildfaDra(vs;(4 etnmo oytlmDean s t0setm(mpou4amtemivsas aDuaxrpnt1teeniociadls rluvp;u) reoif3oadlpD lieols0srxoxr3iydol elfvi s) rtm(  nt4tltn octadfs2em( p;(4teenxo3totfpD  i o;s)trtoimpny4ole mieils  Dtru o;t4aex mi3iadlm2rmu o;t)aeeoxo iadfmDeaivi;t) 2xo(r ny1lme  icil()aDrr( o;t0oetnioctyt sDrm(vo u4teerio oytla  lnvils) 2xrxmpoy1alee ieia( s2rmurpot4tetoif3iatla2rau pn()aexoxr tytfpDrli i;() exrimpoo4lptelivtat srumu  ou4tlxomietldfmDulu o u4 rtnxf3tadfa  livs ()trumxm3iodaptnlnvia(  2umx o;u0oet mf3iyt a2rl( ont) rtrmf3iytom r ieo () rur(mpiudal nmiesltfa2tmumpnu4alt mo3iysfmDumn p ()tltomf iy1op   ues;t) euoxm ny4ame lfvi tfaDuaxrp;o1aetomf3tltfmDeln snt) ltnxo tydlpDeai s s sexmxr oudlm elnvsa(faDuaumooo1tlenmictadlm umn pn(0tlermr oy1fa e ueo ()texoxopou4lp e fctas)arrr(  ot0tlxn ociyd s ul(ms;u)altrircoy1la elieol( trumio oy1ol emneta(fsrtm(moot1teenmieiltfa ea( s;(0tlxnir iatfp eln s (0 exmxopoo4lpeemfesls aDtaum nt1texnmieilsfa um(vp t)alerio ta1fmt aueils) 2toir iy4ap elfeil(fa2ta( pot4oltnmoeiytfs2umn o;t0texnxocto1laDr nes ( seumxr3ou1alte nctl()a2raur ;u0openiieiys a uauvp;u) rtoif iodlatelivi s)trxm(opnudll elnvsat)artrumpnt0aee  oetltfm rlnmp;(0artoif3ootlp rlnes;() 2umxrpno1ale lfvsas  Durxmp;o1olx mfciltfa umnmpnt0trxoxr oa1fa  anvi s) rtr(m iu1apen fesas) 2tmuroou4olxomi3tldfaDemnms (0 rtnmr3oydla rlu s s seurxopiy1aptemfcsa(f 2rmum ;t1optomfeiadfa ulu pnt0artnio3oa1latrlivi;()s2xrxopou1lmt  ies t srra(r ;o1oetoifeildfs ul( s u4 etrxo3ta1fm r uvs;s  rtoxm3oudlm  lnvi t) rur( ont4ale  fciadlmDelnvpnu0 rxrxrciodlp rlnvi;(0srxmimpiy4optemictas)a2raxr ou0oet micias m2ul(vo;u)areomf3tydlaDe nei;()srxo(m3oudole lfetlt)arrmu oot1aleoifcildla2ea(vp t)artnxr totop ran s (  2uo(o oydlptemnvsa() 2tmu  nt0tee mo3tlt m rl(vp (0trenmr oatomt li ols)srxoio no4om  mnetls) Drr(mo;u1tlt if3ilsls um(ms (0aleriociodlm rauvi;s0srur(o iu4al elfctl( sDtrxm oo1alt mfeilsfs2umuvo;(0alenmocia1opDean sl(0trxmio iy4lpen ivt s sDtm(m oo1aee ioeiydlaDeaumonu4 exnmf oydomD aueo ( seum(opiy1lp n nvils s2rm(ront0openmiciatlm emump;t0tleomr oytlmDe ieilt)t2toio io4ol   ncs (fsDur(mono0aptoiociytlm rl(vp;u4teerxo iotfpDr ues;t  2xr(opny4om emnei t arta(rpnt0tet  fciys s rl( p;u4texnifctatfp raieil() euoxrpny4alenlivtls)sDrrx  ;o0oee moctlslaDemnmp;t4 exoif3oatoaDrauesl(0srxoxo oodlpee ncsl() 2tm(mpoo0oet  ociyt a rau o (0arxoxo3ia1oa eanei s  eto(o3ny1omenmfcia(f rurump;t1tlenmfetadfsDuluvo u0artrifctodlatrlueo t)t2xrxr oudapte ict ( srtmxr no4aptomocilsfa elnvp u0arxriociadla   ueolt)t2tmxrpoodamt mfvtas  Draxmonu4alxomoeilslmDeln s u4tltomf iadoate u i;s)truoim iydalte ietasfsDtaumpno1oee ioctytfa2rm(vp;t)trxrmrcoodfat lneo;t0srxoxmpnu4ol  mies () rtaxrp;o1oee  o3iatfsDem( snu0areomo tatop e nes t t2toxopiy4lmenmfctl(  Dua(rpot1aexo iciaslaDuaumsnu)altrmo3iydlmt au o;s0sruoxm3no4amtnmictls) 2rmum ;o1oexoiiciad m ea( o t)altrmf3iotlmt aieilt0 etmim ny1olt  ieiasfarua( onu4teto oeiatfmDranvs t4aetnir tadfmtr n s (0 2xm(rpiydope licsasf 2uaxrooo0alx  i3tys sDemu pn(0alenxrctydla elivs s srxmimpio4lmtnlicils)artm( pno1alx mocild m2rlu ont0 lxoxfctytomDeli i () 2um(o3iudapt  nei tf Dum(mo;t0aee if3ildfm umnmon(4 exomf3iy1fp raneolt0 exoio3oudlm e ieslt)aDraur ;u1tltn oeiat m um( on()trxnio3iydlaDr u i;t)t2xm(r oodom elfcia(  Dumum no1opt if3iytfa2um( s;(0 reoir3oo1lpt  uvo s0setrxr ny1ap e fes (fsrrau  ot0aptoifctlslaDeln s () exnxf tytfa rlu il(0trtrirpoydoptelfetat)sDrrumoot0oex ifeiyd m2ul(mp;(0 ltrif tadla e ivi;s) rur(o3no1om n fetl(fa2tr(m no1ape iietasfm ra( s u0tetnif iytomDelnvs s0 2xr(r nu1am elfct t  rrrum ou0oeeomfciasfa2ulnvs;u)arxoio3todoaDr n i;s)trto(opny4llte iei tf 2rmxront1tltoio3tlsfmDrmn s;t4trxrmoctatopDeluvs (  rxm(opoodomenmfvta(  2um(rpoo0aetoii3iatfmDran ont0alxrmo iatlm rauei;s) rtoim3iu4llenlnct s a2trxr ;o0oetoifeilsfmDulnmo;(4trtoirciadfp   nvi s  eumimpio1omtn nvia()srtrur ;u1apx  ictldfs2eanmsnt0 rermocoa1fm e ieo;( s2toxr iy1lm  mfcilt arraumooo4aptn iciysls rlnmsn(0trerifciatop rai slt  etmxm3iy1apeelfeiatfa2taxrp;u1alx moeiltfaDuauvp u)aetoio oytlmtraiesl( t2tmxrpnu4ape  ies (fs2umxmonu1opxoiictyt a2ra(mo ()arenmf to1op eauvols t2trxopiu4optemncia(fsDuau  ;u1oex mo3iyt sDrmuvpn(0 lenmfcoatoa e n i t0s2tmim3iu4opeemiesltf 2rm(  nt1apt moeiytlm ea(mo t)aeeoxf3totlpDrli s (0srum(o iydopeemnviat  Drr(m oo1aeeoiieiyt sDuauvsnu)tetoio3oo1omD lieolt t2tmir3ou4am  mfeia()srtm(  no1ope ii3iydfm emu p;t)tleoxf3oydlm eluvs s  2xoxopiydlmeelnei s) 2rr(m no4aptomfetldfa rlu s;t)alenxr3tadlaDeluvs;s  exm(o3iydaltnlfeia(farra( pot1tpxnif3tasfa2ua(vo () rtnif3oadlaD  nvi t s2uoio io1alee nvil()arua(ro;u0ope  iciadfa2elu p t4aleomo3oy1laDe i ol() rtoiopou4lltnlfcsatfsDraum nt0tetn o3iytla rlnvs u)aexnif iadfp elues ()sexrxo3oodopt licilsf rrr(m no0tltnmictydfaDum(msnt0texoxoctytoa rauvs;s0setoim oo4om nlivtat)artrxrp;u4tltnio3tlsfs rmn p;u)trermrcoadlmte ueo;s  rurxr oy4lp  lietatf rtm(  no4aetnmi3ilsfm2rmuvsnt)areoifciatlpte i o t)tetm(mpio4apee fvil()srumx p;o1alxn o3tltfs eln p;t4aexomr iadfp ran sls0srxmirpiu1altelfcta(  Dta(r ;o4tex iiciltfa2ra(vp u4artnif3oodlpD lues t)sexm(r iy1aptemivt () Dtaurp;u1opxo i3iasfm em( o u0texomf iotfp elnvo ()setrirpio1ole lnctl(  2rmxm ou1tleniocils a2rm(mp u)tetrmf iotoat  ues;t srxrirpiu1ll  licsat sDraxmpno1olxoioetydfa2umu p u4trtnif oodfa eanes t0t2xoxrpoodomt livi s) rrr(mooo1tle mociys m eanvp;u) eenmo todoa e u ilt)s2umxm3ou1amtnmnvtas  rtr(mpot0ale ifciydfm rlu p;t0tetnxociotopteln i;()trtrio3io4om  mfvtls aDra(root4oex  f3ildla eauvonu)tetoxr iytla rli i;t) exm(r3iudlpenlieslsfaDraumonu4tlen i3iatfa2rln p t4arenmo3iydfaDelies;( t2xoiopoy4altemivia(fs2rr(  ;t1tle mi3iltls emnvo;u0alxoxr to1fp elueo s) rtriopiudalt  ivi ( aDrrx  oo0aexn ictyt m eaumsnt0trxrxo iytfpt an s (0srxrxm iu4openmnci t artaumont1apxnmfctasla eluvo t0altnmo iydoatrliei () 2xrxopny4omeelnctlt) 2ua(m ou0opt ioctat aDelnvo;u0 exoiociotoa  lnes s truo(r iy1lm emivtls s2umxmo;o1aptoifctad s ua(mo u0areoxo iydom ean sls0 exrxm3oodoltnlicsat) 2urumpnt4tptnifeiyd a em(vont0 lenxf io1faDr ueolt trtr(rpio4lltn ici s)sruaur nu4tpe  o3tlt m2ra(vpnu4trerxrctydfp raieo t0trxm(o3iudopteliesl( aruru  ;o4tpeoii3iysla el(mo;u4aetrxocoytfp elnvo s0texr(m oodap e icsatfsrur( o;o1alt  fetldfsDrln ont4tltrxf ty1laD li o (0 2xm(r iodlmtnmneiat)s2ra( o;o1oltn o3ildls2rl(mo u0arenmociytomteau o;t)trtr(o nu1lp   fvsat  Dumxroot1texniociys mDuanvp t4 rtrir oatlm rlnvs;s trtoir iudom  lfetls a2rrx onu1olxnmociasls ulumo;t4 etrmf3iatfaD li ilt) rxoxr oudlm nlnesatfsDtru  ou1olto fciysfa rl(vsnu0tlermr totfpDe n sl( texm(m3oo4lleelfesl(fa2tmxmpnu1optnmictls a rlnvo;u0 etrmoctodfmtraivo (  euoir3iydopeelivt tfartm(mp;o1altoif3tldla2rau on(4arxrmfciadfm  li ils tetm(m3iy1lp emfeslsfsrur( poo4tpeo iciysfsDuau p;t4 rtomo ia1op  au ils0s2toxmpno1ome  fes t) rtaum ot1alxn f3iydfs2eauvs u4altoircoodlptraneolt0 rum(r oo4ol n fei s) 2rmur oo4texomicildla uln snt)altnxr ta1opDran ilt0setrxo3nu4ol  micil()s2tau  nu4ale io3tyslsDrmuvon(4tlxnxf tatlpDranei;t  exr(m iodaleelnvi (f Dra(m ;u4aeeoioeiysfmDum( snt) lxrxf3oatfpte ies;t0trurxrpiu1olt micil()arum(root4ope  ictad mDul(mp;u4arxoxrciydop elues;(0srurxopoy1aptnmici s  Drr(moou1tpe ioctad m eanvpnu0areoircoatfa raivols  rxoxrpoodol  lict sf Drau  no1tpen oeiatfaDemn o u4aetnir iydlpt luvs s)srto(opiydlpee ieilsf 2uax pnu0tltomf3iydfa ulnvs;()aexoifctotfp rlnvs (0s2urxrpnydlmeemietlsf rua(m no0oexo o3iaslm ra(mo u0 lxrio3oydom r u sl(0s2um(r oy1lltn fei ( a2tmump;t4oex  oetys mDua(vs () exnxo tydop rli olt srtrxo3ny1ol   icsa(f rua(moou4tpenmo3iysfaDra(mp (4teerxr3iydfpt  nvo;t t2uo(rpoy1olte net t s2rmxm oo0tee miciys sDemnmp u4aeerxo tatlp   u ils0t2urio iu1lmeemivi t  Dtm(monu0texnifciydfaDrmnvp u4artoxf totfaDe ieol(0seur(r3nodlptemfcs tfaDraurp;t0teen i3iydlm uaumonu0 lenir tatom elneo (0seumir3oy4ap e fvi t) Dumx  ;t4alto fctldlmDuln s;u)aetrif tytfaDe u il(0seuoxm iy4amt lnvs ( sDrr(m ;t4aptoioeiys sDemumo (0 rtrif iodomt lu s t)srxmirpny1ope  net ( a2rax  oo0tetoio3tlslmDuluvs u0 rerxr3iatlm e ieo;s0trxrio oy4opte nei sfarrau pnu4oet mfcildfaDeanvp u) exomo iotop r ies;s0teur(r no4lm n nvs tfaDtmuroou0tet  ociydfs emn o t4aeerxfctotfmtelivs;()s2umio3oo1opt liet (f rtax ont0oeeniictyd a ea( pnt)tlermfcia1oa  livo ()texm(rpio1omeemnvs s  Draxmpnu1ale mfeiydlm em( s (4 rtoxf oodfm e ivolt)s2toxo3ou4omt lneia() 2um(r ou0tpeoiociltfs2uan sn()aleoxf tadfmD auesl(0t2um(mpoodlmtemiesa(f Dtr(  ;t0ale  o3tatfs2umnvonu0aexomr oydopD aivs s)s2tr(r nodlmenmivsas sDrrumono1aeeomo3iltfa umnvs (4 exomoctodopt anvi;t) rtrxm nydllte nviat sDuaur ;t4open feiatls2uanmp u4 etrmoctotlmDeau s t) 2toxm3ou4omt lnvs t aDraumpot0apeoii3tytfaDean p;t4trerxfciy1lpDr i s;() 2xrir3iy4lme mfcslt  rua( pnu0tlt ifctasfmDuanvp;t4 etnxo tadomtelieol( trtr(r3oodlltnlnvs s)a2urxmpoo4oee moetlsfsDea(vpnt)altnxr todfmD  uvilt)t2xo(r3iu4ape  fetl(  2trumo;u1tltnifeiasfaDelu s;() etnifcio1lm eai o s seumxrpoydll emivt sfsDtmx pno4alt  feiadfaDrm( p u)texrxf oo1om r ues;t0 2umirpiudoptemnes ()aDraum no0aetnmfetyt a um( snu0 ltoiocoy1lpt ai i;s)t2xm(mpio4altn ncsasfs2ua(rpnt0opx mf3iad aDrmumpnu)trxoio oytfatrln s;(  2toio nydalt lnetltf Duru pnu4tpx ifeiytls2emuvo;(4 lxrxr ia1omt li i () rxrxm oydal nmnvs s a2tr( ooo1tpeomiciltfs2ulnmpnu0 lenmr3tatomDr uvo;t0trtr(m3nu4lleelnvsat)a2rr( oot1oexoioctasfa ulu on(4 eenif3tydfpDe uvil(0sruoxo3no4aptnliciasfsDtm(  ot1aetoiieiatfa ul(vs t)arxomfctotfaD li s;()teum(o3io4aleemici t a2tr(m no1oltnmfeiadfs2rl(vo (0 rtomr iy1lptr n ol( s2trxm ny4omen fvsa(  2rrx pot0opt io3iasfs uan p t4alxrxo io1fatean o;t) 2xmio3iydal elies tf rraurpnu1oexoioctatfa2rm(msn()trtnif3iatoa r ues;(  rxoim3iu1omtelivt s) 2rmu onu4apen iciydlaDuln s;t)artrio3ty1op raues;t0trxrxo nu1ol n iviasf rta(m nu4opeo iciydfsDul(ms;(4aexnxociytlmDeaneols) eto(r nydapt  iei sfartrx pnu0oeen iciltlm2rl( p (4aetomo3tatopD  ieo;() rum(o no4lmtelnci tfsrrrx  ot4tlxomoeiasfaDrm(mo u)alxoxo iy1fatelueo;t)t2xmxmpnu4lmenlicil(  2rru  no4apxomoetydfa2rlnmp u0alxnmf iydlat livols)tetr(m ou1amenlnetls  Dum(mpoo0tpxnmi3tadfs2umumpnu4trermrctadla e nvo ( seumim iu1alenmfvtl(  rtrum ;o1tptoiociatfaDel(mpnt4altnxoctotoa e uvo;() rtmimpoy4olenmfeils)arrrx  no1apxoio3ilsfmDrlu o;t4teenmf tydfpD  ueo;t texoirpiy4omtn icsa()sDurumoot0aee mf3iydls2ea( s u0 exrir io1fpD livols)tetmxrpny4lptnmnvia()srtm(m nt1opt ioctlsla eaump (0 ltoxo iy1oat aueo (0tetrxrpoy1ap elicsls a2rru pno0oleoioetadlm2ra( ont4 exrmf3ty1fpDe i s ( trxoxo nu1lp e ivt (faDtrurpnu1tlxnii3iatfs2emu s;u0tltrxf3tatfatranvo;s  2uoxopoo4apt mfci tfaDrmu pou4oeto iciltfm2eau p;t4 etrmr3tadfm eliei (0seurxrpoodll elfvt t)aDtmxrpoo4tpenmo3iyt a2ean ont0arerxo3oy1oatelieo;(0 2xrxm ou1am n ivslt)aDrmx oot4olxo f3tadfs ea(ms t)tltnir ootlaDeaiei;()t2trim3ny1olee nvtat aDrau p;t0altomietasfa eau onu0arxrmf3to1fa elieo;t0trto(o iy1olee icslt artrxm no1oetomoetltfaDul( p;() rxnxo3oytlp e nvo;t0 eurxmpoydal   fvt ()aruaumooo0opxniietld a2raumo t4 eerio3iy1fm r ies s0 rxm(r no4aptnmfeta(  Dtaum ot4aet ifetytls2rmnvo u)areoio3ty1fa r u i;( texm(opiy4ome lnvt t a2tm(mp;o0ape  oeiltfs el( o u)tetoif ty1opte n i;s0teuo(r nydlle lnvtl()sDrrumpnt1tpenmoeiasla umn o (4 exoxr3tydfm r nes;(0s2uoxm3nydome lies (  Drruro;u1aeenmieiltfm2um( o;t4 rtoxr3io1optrlieils0t2trio3io4lmenlnciat)s2umumoot0oet mo3tat m umu s;t4aetnifciadlmDraues;(0 rxrxm io4lpt mieiat  Dtau  nu1teen i3iltfaDrln snu0tlenif iy1fmDeaueil(  exrim ny4am  lfct s  Dururpou1oetnmfciadfmDumumo;t)trtnmf oytlaDraies;( s2to(r3ou4omt lici t) 2rau o;u4aeenmieilt mDuln s;u) lenxf3oo1lpDe u o;()t2uoxo oo4altemnvia()s2tmx ooo1tpen ieildlsDemuvsn(4areoxr iadlmt li i s  2um(r no4apt liei t  2urumoou0apx io3iyt sDemnvs;() eenxr iydfat  i s t) rxmirpno1olee ncias) rtr(mp;o0aexoiiciasfaDem( s;t4trxnxocoa1lpDe uvo s0seurxm3iy4optnlnvi tfs2uau p;t0altoioctaslsDua( snt0treoxo3iodfa rln o (0srxrxmpiu1lle mnvtlt a2umumooo0apt mf3iatls eauvs t)areomf3oodom ranvo (0trxm(m3ny1opt lncsatfs2rrx p;t0tpx mf3tytls2uan s;(4 reomf oadopDranes;(0sexoxr3nudoltemicta(fa2rruront0oetn oeiyslmDulu o;() eeoxrcoatfmD aivs t0 2xoimpiu4olt  fci s)aDtaurooo4aleomoeiytfaDeanvs;u) rxnxo3iy1fatranes;t) etoim3oo1llen feiat s2tmump;u0ole mi3tyd a ulump;u)tltrxo io1lmD aivi t s2uoxmpoo1lpe mfetl()aDumum no4optnmf3tysfm umuvp u4 eeoxf tadlat li slt0teuoxr nu1ope mnvs t a2rmxrpnu4opxnmicils a el(msnu)tlxnio3oytopt ai ol( srurim3ny1ale mnvtat)a2tr(m ou1tptoioeiaslsDranvsnu4 lenmocio1op eanesl( teurimpnodlp emnetltfa2rrx  nt4aex  iciatlm emu s u)tetrif to1fmDraivo;t  etoxm3iydlpe miesat  Dumxr ;t4opxnmfeiydla eln pn(0aetnxf iy1omt lu o s)s2uoxopoudap  mfeslt  2rr(ro;o1apeomieiasfaDumnvp;t) reomrciatopDrlivo ()teuoir3no1ope mivtat)aDta(r no0tpxomo3iad s ul( s u4 etnmo tytom e neo ( s2um(r iu1apt mfvsls arta( pnu4alt  fetysfs2uaumpn(0 exomr3tydfm  lnvo s)srxo(opno4lmt mivs s  Duaxm nt0oex mi3iydls2uaumpn(0altomoctydfateaues ()srumxm iudamtelfesatf Drr( ono0tltoiiciasfa2ulnvpnu4 eenio ia1fa   neo (  etoxmpio4olte ivtas) 2raxr oo1aet mf3tldlm2rm(vp (4altrmr oo1omDe nvilt)t2umxm iy1altnlivtltf rrmumonu1alto fetaslmDrmnmp (4 ltomo iotfmt  u s s  rxm(rpno4opt lncilt)srrrx p;u4olt  ictlsfs2ua(vs;t)tltrmrcia1omD  nes t)tetm(m3oo4omtn iciat  rtmurp;u0aleoiieiydfaDrmumo;u4texnif3ty1omD lnvilt0 etrxm3oudlptnlivi t a2rrum ;o1aleo ociltlsDemn p;t0 exoif oatoaDr neo;() etoxo io4omtn icsl(  2tm( poo0tpto ociydls umump (4arxrxo3oo1lmte n i (0sexoxm io1amenmfctat aDtrxmpoo4opt mietasfm emuvont4arermr3to1optr u i (0trxr(o3oy4optemnes s  rtmxmp;t1tpxnmfcias m2umnms;u0trtrxfcio1om rauvo t0srxoir3ny1lltnmncs ( srrau  ot1ope ifcilsls2rlu p (0 ltnmo3iadfmt  i i s  exo(mpiudopenmivtatfsDtrurpot1olenmoetytfs2elnvp;(4trtnifcta1fp  aues;t0teto(mpoy4apte fvsltf 2rmur ;o0opx mfeiyt sDuauvo t0aexnmr3iodlat  ivilt)teuo(mpnodamtemivt () 2urxmo;o0tpt moctytlsDel( o;u0tltnio3totlmDelnvs;( t2tr(r3ou4omtelnet ( sDrr(  nt4tpeoii3tlsfa uan p u0trxrxrctadopDr ivs;t srtrir no1oltnlnctat) 2tmxm ot1alxniiciatfs uln p t)trxnmrctotoa raues;(  2tm(opou1lme mnvils s2rmuront0aetn o3tls sDelu ont4aexrxf3oatfmt liesl()trxm(m3no1lmeemfei t)srur(moot4aet mictyslm2ua(mo;(0tlenif tatomDeli i s trxrxmpoo1om  micsl( sDraxmo;u1texoif3ild m rm(ms (4tltomo todomt  nes;t  rtmimpnudopt  fctas)sDtaxmoot1opxnmieiatfm2rm(vs;u4 exrir3iadop  li il()s2to(m3oo4optelict s  rta(m ;t0altn ietld m2rm(vs;u4aeerxf3tadop eauvols)trurio oy4ope mivt t srtrxr ;o0alx iicilslmDra(ms u) renircio1latran i ()trtmxopoo1omen fcslt)srua(rp;u0tleo ociysfs2rauvsnu4 etnxr tatomtelu i () rtrirpio4op e ivsls) 2rax pnu0tlenmfciytla2eanmon(4 eenir oadlmt  uvol( setmim io4optnmnciatfsDumur oo1tlenii3tltlaDumnvsnt0 rxomr tatfpDeli o;s0trur(r nu1ame lncsas) rraurpno0opx mfetas sDrm(mont4 etoircoatop rlueo;t0trxo(r nudome  nct ()sDtrxronu4ape ifetld s uau o;t) etrxo iotoatr n s t)s2xmxrpnudaptnmici ( a2rrx  nt0aptomfeiysfs ea( pnu4 etnxf3tatfmtranes t0seumim oy1lmeemicta()srrmuront0teeoiieiys a elnvo t0 reniociy1lptr ieo;t0tetm(o3iodap n nvi () rtr(m oo4oet mfciytfm ul( on(0 ltoxr3iotlmtr nvo;(0texoio ny1aptn fvilt arua( pnt1aeto ietltfa2emuvpnt4 ltoir3ia1fatr ues;( teurim no1ome  ieia(fa2rmumoot1tpxnmf3iltlm2umnvs t0 renxfcio1fp  livs;s0s2tr(m3iudapenmieiat  Durxm nt4apeomocias a ra(ms;(4artrmrctatlmte n i;(0setrim3ny4altnlfvtatfsrurx  ;u0tlxn oetltlmDua( pnu)tetoxoctatfmDrlivi;()s2xoxo3oy4omee nvilt  rta(mp;o1aptomo3ias sDeanvp;(4trenxrctadfmD anei;()t2umxm iy4llt miesas aDtrx pou4olxnmf3tld aDul( p;(0alxomo iodomDr u ils s2ur(m nodomenlnes (fa2ra(mpnt0aexniicild aDelu onu0artnxo iytoatraies;s  eumim3io4aleemfcsas) 2urx p;u1oex ifciysfaDua( pn(0 exnmf3iatlm r nvilt0trxmxm3iu4lm  mfeslt)aDta(mpou1texnmi3tlslaDulu pnu4 lermfcoodfat aivilt)texrxm io4lmtn nvtatfs2trurp;t4aeeo octys mDrln p t)tlermr3todfmtrlu i;(0t2to(opiy4omt  fetatfsrtax  nt4tleomoeildfa uan o;t)tetnmo3to1fmDelueils s2tmxm iydale  fes s sDumu  ot0tpe iociltfsDea(mo;u)trtnxo3oo1lp  ai i t s2ur(r iydll emnctl( sDuaumpno1altn i3tytfa rl( o;t4tltrmf3oo1fptr ieo t0 2tmio oo4opte ncias)a2tru oot4tetoiieild m2umnmo;t)artnio oa1opD luvo t)tetrir3oo1am emiesas  2umump;u0ope moetlsls2emnmp;u)texomo3oy1lmtrluvolt)srxr(r oy4lp e fct sf Dum(m no1tltnio3tas a2emu s t)trxomf todlmt  u i;s)srtoxr3iy4ome  ncslt  Dtrxmpoo4tex iocils aDrm(vo;()tlxrif tydopt au s ( t2xoim no1om eliviat)a2tmx pot0tlx ii3iysfaDumnmont0teenxociy1lptrluei;t  rxrir iydop emnctat)aDrau pot4tee io3tad m2um(mont0 lxrmr3tydfp   nvi;s trum(o iu1lleelneils a2umumpnu4ope mo3ilsfaDumu p;u0 lenmf3iadfa r n ils0s2trxr ou1aleemnvilt a2rm(m ;u1oltomocias s2ulums;(4 rxnxf ia1om rluvo (0seuoio3ny1lp  lnetat)a2tm(ro;o0tpenmictysfm emuvpn(4arxnio3iytlaDe neol(0trumiopio1olenmnvil(f rrrxmoot4oee  ieiadfa2ea(mont) eerioctydlp  anvi;( srumiopnydomt  feils  rrru  ou0oleniocias s2ran p u) rxoifcia1fp rauvi;s  2xoxrpoodaleelnct s  rtr( oot4opx mfeiyslm2ul( p;u4trxoxo3oydfm  aues;s s2xmir iudalen ivi s  2tmxmo;o0apxomfeiytla ua(vs u0 lxomr3iadfpD liei s seuo(mpny1lmt lfvia()a2ta(m nt1texnmoetltls
\ No newline at end of file
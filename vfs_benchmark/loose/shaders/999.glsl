@@ -0,0 +1 @@
+n o ()truo(o oydol nmfeil()s2urxr ot4teenmictydfs rlumo;(0 lxoxo3oadoat  ueo;t  eumimpny4lle lfvt (  rrrxmono1aptnifctadfsDemuvs;(0 reomr3iotlpteaiei t t2xmxopoydaltemfei s) rumxr nt0tlx  feildfmDul(ms;u4 ltnxo3ia1fp   nes;s s2triopno1al nlnctls)arrau pou0tex  ietas a2rm( s u4tltoir oa1oatranvols0t2umirpio1alen nvta(fsrtrxmp;o1teenioeiyt m eau snu4arxrir ty1oa  lieo;( sruoxo3ou4ale micils) rtr( o;t4tle ifetltfm2um(vsnt4 reoxr iytlmD anes s)t2umio3nu4lmtn nctl() 2tax  ;t4tex  ictldlm emn s;()trermoctytlatelueols  rxr(r io4lmeelivsltf Dua(m no4optn f3tlt m ra( s u)arxrmfciotfatrln o ()trumxm3io1lleelnvslt sruru o;u0texnmf3tysls rl( p ()trxomr3to1fp  au s;t)setrir nu4ll e fesas)arra( oou4oetnmf3tas a2uau o t0aexrirctatlaDeai sl()s2uriopnodopee ics sfaDta( oou4oex if3tysfm2elnvs;u4aetnmr3todlpt aies t) etoxm3iu1opeeliet sfs2uaxrpoo4alx mfeiaslaDelnvp;() ltnmfctytopDelieol() rxmio iy4ol nlnvsa(fs2rmu pno0tptoif3iys mDelumsnt4aeenmr iydfat anvo;() rxo(o nydomeemnetlt)sDumu oot4tpen feias s2ua(vsn(4 etoiocoodlaD aiesl(0srto(o3oo4ap  mfvils) Duaur ot1oet mo3iltfsDua(vpn() exoxr tydfat aieols srto(r3iydlmeelfesls aDumxmoot4apenifctys m raumo () rxomfcio1oaDeluvs;()srxo(m ou1omenmivtas  2tax pnu0olenmociysfm rl( p;u4 rxnmr3ootlpD  n s t sruoxr iu4lmt lnvsltf 2um( ono1tee iicilsls2elnvsnu4alxnmf oytlmteaneo t t2to(r3nu4aleelnesat)artmu oot0olenioctaslaDemn o;()aetrxo3oydfpD lneil(0texrir3ny4lpeemfciasfa2ua(m no1tetoifetld mDumums;u0alenxo3iadlpt livi;s0trxrxm oo4al  lncsa()srtr(m oo1aetoif3tls sDuanmo;()treomfciodfpt auvs (0 etoxr ou4openmneils)aruaumpoo4apenmictytlmDelu p;t0 rxnirciydlmDraieolt  exmxopou1openlnvtl(fsDtau pnu1aexo i3iltfa2eanmp (0alxoxrcto1fa eauei ( teto(r nudapt lnvia()aDraxmonu4aexnmf3iaslm2emnvs u4 rtrmociytfp  aivs;( s2tmir oydolenmivsatfs2urx onu4ape mi3tad mDum(vpn(4 rxrxfcoadopDean i (0srtr(m oydap emivt tfartr(rpnu0alxo o3iytlm ea( p () rtrir ta1oaD aneo;(0s2tr(r3iu1lp   nvils)s2uau pno4teen feilsfaDrluvp t4 eeoir tadlmDeanvi;() rumxm3ou1alen fvs sfa2urx p;u0alt ii3iadlm2ua(mp u) ltoirciadlpDeau olt s2to(r3oy1altn ietls artmxm ;t0tpen o3tatfs eau o t)aeeoio oodlpDrau s;s  exrir iodlp elfviasfs2uau  oo1aetoii3ild a eanmont4 lerxo3oytfpteanvi (  2trir iodome lietl(f 2tax pno0tetnmfetyslm rauvp;u4artoir totfpte nei ()t2umiopnudolenlfetls)a2ta( pnu1olxomociltls2uauvp u)trxnxfcoo1lmtrluvi;()s2um(m3ny4open nct (f Drmur ;o1alxoif3tyt aDrauvpn(0artrxr3iodfa e ivo () 2xmxrpoo1om nlicsa(faDtmur nt1oleo ociltfs emuvs;u)aexrif ia1fat lnvi;t)teurxm ny4lpe  icslsfaDtrx  oo0tltomoeilsfm ulnmp (0teerifcoo1fa r i s;s s2xmim oydaltn ict sfsDtaurp;o0tpx io3ilsla ulnmpnt)altrmoctodfptrlnvi ()srxrxm3io4al nmiviasf 2trumpot0alx mietls a2uln s t4aeeoifctotfpDe uvo s0texm(r3oydll emfctas) rrr( o;o0tet iieildls2uauvonu0trxriocoydfm  luvol(0texrxrpoy1ll   iesls)aDum(mo;o4opx  ociadfs2elnvont4 lxomo3oa1fp   uvo;t0s2ur(m oy4amt mnvi (  rtm(  nt1alenifciytfsDrmuvo (0treoxf oo1lpDranes (0texm(o iydlmtnlneta()arrrxm ot4tpxoifeiatfs2rlnmpn(0trxnirciy1laD auesls0truo(m3no4lme  icsltf 2tr(  ot4aet  fetys s elumo;u0aexoxo3iatlpteanvi ()teurxrpou4lp  liei tfs2ua(ronu0tltnmi3iad a uau pnt0 lenif3iy1fat auvs;s)s2tm(m oudomeelivils)a2taump;u1tle ii3iydla rlnvs;t0aetoxr3todlmDraivols trtoxr iudamt  nvta(  2ra(  ot4tptn feiyd mDeanms t)arxrmr iatoatrlneo;s sruo(m3nu1llte neta( aDtm(mp;u1alxomfeiltfm rluvs;(0aeenxf3ootfpteaues t) exoir3oydlpe lfeil() 2urxm oo1tlen fctlsfaDulumpn(4 ltniocia1omteaueo;s0texm(m3iy1apenmfvtltf ruaum nu4aexnii3iad m2umn s;u)altrio3ootlmDr neol()t2xm(m iy4om e nct sf 2taumpnt4tlxn f3iasfa2ua( o t4tetrmo oodlptrlnvsl(0 ruoxmpoy1alt lfvsltfs2umurp;u1alxoiicildfmDuln on() exnmfctodoaD auesls0sexoir io4omt licsas arta(monu0aex ioeiydfsDul(vo;t)aetrxr oo1laD livo;t  ruo(r3oodalteliesl(fsDrmxr oo1tleoiieiydla2ulumsnt)aeeriocoydfp  aueols)t2uoxr3iy1lmeemieiat)aDtrurp;u0aeeo fetyd m elnmo;t)tetoif ta1omtrauvi (0srurxmpiy1om n fcias) rtmx pot4tpto ociadlm2ul( p u)arxnifcoytomtr nes;s srtmxr3no1ap nmieilsfa2rruro;o4oeeoioeiysfa emnvo u4artrif3iydoaDrai olt0tetmio3nydlm emncsl( srrrx pnu4alt mo3iydfs2ua( p;u)texomo oytlpD ai il( teumxmpou4lme  feias)s2tmu poo1aexoio3tatfmDean snt0arxomr iy1fp eaueil() eto(r nudlpt lnvt tf 2rrx o;u4altomo3iysfmDuanms u4 ltomf oa1fp eaues;(0trtrxo iodope  fci ()srua(ront1oleomoeiydfm2ea(mp;t) lxoio3iadfptrln s s) 2tr(rpiu4amt  nesl(f 2uaxmp;o0aleoiicildlm2rlnms t)tetrxo to1opDr i slt0t2xoxopno4om e fesas s2ta(r ou0tpen o3iydlsDrluvs;(4 rerif iy1lmDelnei;t0s2to(rpiodol nlnct (farta(r no0aee  ieiad s2ea( o () rtrir3oodfatelnei t seurxo3nu4am elncil( a2uru  nt1tlxoiieiyt m umums u4 reoio3oytfpt ai o;() eto(o3oo4ll  mfei s a2taxro;u4alt moeiatlm2um(vo t4tetnir ootop elieils0t2xr(opnu1op n fvslt)srtm(monu0alen f3tadfmDrauvp t0 rtnxr3iodfp elieo t0 2umxo iudal  mfcsa() rurumo;u0alto ocildlmDean o;() eenmocta1oa r ieo t0seumxrpnu1ap nmfeiat)s2rmx pou4apenif3ildfsDranvsnu)aeeoircoatoaD li s;s0trum(m no1lltnmfesl( a2uaxmoou0aptnii3tas m2uaumo t) rtoxfcoatlm  ai o s srtrxo3no4omenlicta()arur(mooo4aeeniictldfm rmnmo;()teeoxfcia1fpD aiesls  2xoiopoy4lp nmnctls  2ra(m oo1tlxnmi3ias mDul(mont0aexrxo3todoptrln s;t)tetm(mpou1lm   fvta(fa2uaur ;t4apeoifeiaslsDrmnms;t0tlxnmf oadlmt aies s)tetrir oy1om  lies t aDra(  no4tpeoif3ilt m2ran o;() reoioctydlmtraivi;()s2tmio3nu1ole mfvtls)srrm(r ;o0tltomfeils mDrl( s;t)aeerir3iotlaD auvs s0 exriopiodlpe licsls)arrm(  nu4tltnif3tytfa2eaump t4 lenif3tadfm e ueslt) 2um(opiu1lm e icsltfaDtrxrono4opt moeiytlmDul( snt4tetnxr3iatfptranvilt0 etrir iudoptn ncs t)aDua(  nt1olen iciyt m emu o;(0tleomf to1omtelu s;s)seum(mpnodape  nct s) 2raxr ;t0opxo octytlmDuaumo;(0texomf tatopDeaivo;() eurxm3oy1ome mfeils sDraxrooo4aleo f3iltfs2el( s;u0tltnxf3ty1oatran ol(  exr(mpny1amen ivtatfarrmx p;o1apt  ietyd sDrlu pnt0tetnmo3iydoatrli il() rtoxrpoo4al n ieiatf 2rrx o;t4tleoiieiysls2eau p t0alxomf iy1fpDe nvs s  exoxo oodalenlnvtls)aDrmxrono1oet  f3ilsfs umnmsnt)treoio3iytfm   n ols  rxo(r3oo1alt  fvs s srtrx p;u1olenmictls m um( p t0arxrif tydopt luesl( trtoxo iydapt mfvs t)s2urxmonu0tee  ietysfm ua(vsnt4trxrxf3tytoa e ivs t0trumim no4op n feslt)a2ur(m no0aexoio3iatfsDumuvs u4tlenxr todla elivo s0 2to(m ou1lptn fesatfsDuax pou1teen oeiltfmDuan pnu0 ltrif ty1lmteluvs (0srxrimpnodlpt lfvi t aDuaxmooo1aptnifctlt s eaump;() exnmr3ty1fpt aivs;s0 rurim io1lp  licsl()aDta(ront0apx mociysfaDem( sn() lxnxo ia1lmte ivo;(0 eumxr no1ol  mivtat)arum(ro;t4oeto feildlm rm(mont0 etoio to1fa   i i s0t2to(o3nydlm  lncs sfs2uax p;u0apxo feiltfs2ra( pnu0aeerio oo1fat  n o (0 exoxopiy4lpenlfetlsfs2urumonu1tlx  feild m2ranmpn() leomo oo1oat li o;s0 2xm(rpiy1lme micsas) 2trx  ou1tpx io3iyd s uaumont4alxoio tadoptelieo t srtmxm3ny1llee iet ()s2rrx  oo1aptnioctlsls ulu s t)alenir3oadfm  au o ()texrio iy1lp nmfctas sDurumooo1tee iiciltlmDumnvo u0alxomfciatfpt livslt  rxoxrpiodaltelicsl(  Dtrumpno4tptn ietls mDumnvsnt4arenmr tytfaDe neo;s seurimpou4opeelicslt aDrr(  ;u0tlxoiociysfmDrm(vs;(0aetoxf3iatlmte uei s)t2uo(r iydol  mict s artmxrpnt4tpxnmf3tyd aDrauvsn()tleoir oadoaD aneo;s0srxo(m3nu1ll e ncta()srrrxrpoo0olxn icild s rmn pnu4 rxnmo tytomDr nesls0s2umir3oudlm   nci tfsDtm(rpot4tle  oeiydfa rl( s;t0 rxoifcta1la   i i;s)srtrxmpoy1oltelnvi ( a2rrx o;t0oeeomieiad a um(vp t4artnifcta1fp  aivo t0s2uoxr iy1ol elfeias)a2trx pot4aeenmfciltfaDrm(vo;t4 rxomf3todfpDeai slt  2umio ou4ap nlnesls)sDrr(r ou4tlxn oeiytla rm( p u0tltoxf3oo1fptr nesl(  eurimpnydap nlfetlt aDrmxr nt4teeo ictysls emnvp u0aeenxo3oytlpDrau i;t0t2to(r ou1lle lfcs ( srrr(r ;t4opxnifctaslm2el(vont0 exniocoodfmDeln sls) rxmxopny4ap nlncils  rumxrp;u4opxnifcild aDumuvon(0trtnmo tydopt  i ols t2xmxo3iy1olenmfctlt sDtrx  ou4tptoiieiatfsDea(vp;()tetrir ta1om  lu i;t sexrxopou1lp nlfvt tf Dtmumpnu1opx iiciatfm2uau pn(4 ltrif iadfmt ln s;()seur(r3oudape  nvsat)sDrm(rpou0alt  ociyd a2rauvs (0artnxociatfp r nei;t0t2um(r io1lmt  netls)arraumpou0opx ifeiyd m umu on(4teeniocoytfmDeaneo;t  2xmim3ny1omeelieiatfs2umx o;o0tpenmoetatfm ulumont0alenxo iadop rlueils0sruriopno4omtnlivi s aDrax p;o1olx if3tydfa2elnvonu0 ltrio3oodfpDrai o;( sexrirpiy1op e fviasfsDrmu oot1oeenio3tytfaDuaump () etrio3iatlp  livol( t2trio io1omtnmietl() 2ur(  ot0teeniociytla rmuvpn(0 lxrir oytfmDe neo;(0s2umxr oudapt  ivsls)s2trumonu1teenifciad mDel(msnt4 etriocoatfp  luvo;(0t2xr(m3no1ll   nvs s)aDrm(ronu1apxnii3ildls rln o;(4trtrio3iodopD  iei;t0 ruoiopoudlm nmfeia(fsrtaurp;o4aptn o3iyd s2umuvo;(4alerifcootla e u il(0 exo(opoy1lleemfeta(  rurxr ou4open ictadlm2ra(vs () ltnio3todop rau s;()t2xm(r3iu1lmtnlicil(  Dumu o;t4olxn ieiadfaDumnmo;u)aeenxr ootoat auei t0 2xrir3iu1ame mnet (  rrrxmp;o4tee mi3iasfs rauvsnt0 lenircoodfm   ueo;(0 2umxmpno1lp  mnvia() Dtmxm ot4aptnioeiydls rl( p (0altrir3ootoaD ln i;(0 2um(r3ou4lme mfetatf rrrurpnt0oexo feiad s2ulnmp t4 rermf3tatlm rlnvo;s0 rtrimpoudole  fvs sf Dururoou0opx miciyslm2rluvp u) etrio iodopDr uvs;s t2xrxopou1am   fviltfaDra(ro;t1oleo oetytlm ulnvs;u)tlxriocoo1fm e uei s)tetoirpiudlp nlnes s) 2ua(m ot0teenif3ilt a2uaumo;t)tltnmr3io1omt anvo t0 exr(o3iy1lpe lict sfa2urumo;t4oeenmietysls2ea( p () rtomfciotlaDrau slt  rxoxo3iy1omenlneilsfs2ta(rp;u4oet mfeiysls2uau snt4tleoxf oytom   u o t)t2urio iodaleeliesasf rrmu pno0opxoio3tyd s ra(mp t4 etoxo to1lmtr uei (0sexm(o3nu4amtelfvslt)srtauro;o4optn fciaslm rlnmsnt4 eenxr tytoptrlivs (0 rurxr iy1ole mfesasfsDra(root0aeeo o3ild a umnvpnu4trtrxr to1lpDranvslt truo(o3oodlme mnvi t) rumumo;t1opxoio3ildlmDuan p (0alerio oytfm   ivs (  eum(r3iydoptnmfct s arrau ono0altnmoeildfa2emn snt4trtrxfcia1omDrli s;(0srxo(mpiudom elict ()aDtm(m nu4tpeo o3iytfaDemnvo;t4 reoirciotfmDe uvo s) etr(o3ou4lmtemictls  Dtrumoot1oexniociytlm ul(mp t4 lxoiocoytlpte n sl(0trxrxr3ny1ameemfvil(  rrau pou1tlx io3tld m2rl(mo;()aeenmo3oydfatraies (0setrir3io4op  lfci t srta(rpnu4altomfetldfa rmnms;u4 eenmr iydlmtraivs;s  rurxopny1aleelicta(  2raxrpou0tptoif3ildls2rm(vpnu0 etoifcoydfa  lu sl() rxr(m3iodal  liesas a2ur(ro;u1tptnifctydlaDemnvsnt4tlenifciy1lmDraneo s)s2uoxo3oy4ol emfes ( sDrru  ;u0tle  ociys aDrmnvs;()trxnmrcio1faDrauvs t srurxo3nu1lltnmnetlt) 2rrxmp;u4aeeomfeiasla umuvo (0tltomf3iatfm e ieols)trumxo iudope  fvil()arrrxm nt4apt  f3iytlmDrlu p t) lerxf3oytomt anes;s0 2tr(r3oydamtemncsas s2ur( p;t1oexo fciytfs rmu o u0aeenifcty1faDr nes s0s2xoxrpoy1lp   nvi t)s2rmxrooo0tpenmieiyt mDeln sn()tlerir3oatoatrlnvs (0texmimpiy4olen nei s a2tr( ono4oetomo3ildlsDumumsnu4aexrio iodoat  nvo;s0s2xo(o3nodom nmfvi sfsDua(m nu0opx ifciat mDeaumpn(4teeomfcoytomtelivo;t srxoir3ou1al elivslt)srtax o;u1olxomfetysfs uluvpnt) ltnxf iotomt  n s;t srtmim io4llen nesltfsrua( p;t1oltoifciydfs uluvpnt)alermf3iadoatr u o;(0trur(m iy1amee icils  Dtr(ront1alenio3iysfsDemnvp ()tleoxr3iydopDeaueil( trtoxopny4lmenliet tf 2umumpno4teeo fetyt aDel( p () rerxrcoy1oaD  uesl(0trur(r3iodlmtn iviasfsDurxrpnu4apen i3iatfs el(vpn(4trtrmf tatoaDe iesl(  2toxo iodal  mivi s aDurxmont0alt ioetytfa2rluvs u)teenxr3iy1op e uvs s0srumim3ny1om  mnci ( aruau  ;t0aptn oetltlm ranvonu)tetnxf3iadomte nei;s0 exr(o oo4lp  lfvia()srrau o;o0aptnioetls mDemump (0teenxr iatfm e uei (0 euoxo3iy1ole lneia( aDra(monu4oex moetad m uanmp t0aexnmf3totlatrlu i;t) rxmxr3nudlpen fcsl()s2rr( ooo1alxo i3iysfa umuvsn(0arxnmo iodlaDeli s ( sruoxmpoydoptn fes ( s2tru pou0opxn oeiytfsDelums (0texniociodlmteaues ()seto(rpiudaleelneia( sDraxro;o1tet mfeils sDumu on() exrir to1lateliesls) 2toxmpio1llt lnvilt aDrmxmp;u1optnmfciydlmDul(vo u0alerxoctatfa raues;(0teuo(m iodapeemfctas artmx  oo0opx mfetltfa2rl( s;()arerxr tytom rlivo;t)t2umxo3iu4alt  iesl()aDraur oo4aetnmieiat aDul(vpnu)alenxrctytopDraneils)s2tmxo oo4ame  nesat)sDurumo;o0altniociasls rl(vpn(0 lxnxf oytfat li ol(0 rxmio no1omee ncil()artru  nu0texn icilt m um(vp;t4alxrir3tatlpt aies ( t2toim3iy1optn neslsf 2uaxmont4tlxo fciaslm rmn o;t0artrxr3tatfmt luvi (0srumim nudlm emfct () 2rmxro;u0aee mi3iatfs2emuvs;u4teermr3iy1fp eai i;( t2uo(mpiodamee iet ( arururont4teeomieiytlmDrm(mpnu4 renmrcoydfa  anvs;s texmxm3nydal   fcs s srrrxmonu0apeo i3iys s2rm( p t0arenmo oytom ranesl() 2tmxo3oo1ole mict t)a2taxrpnt0olxnmoeiydlaDrmu s (0arxrifcoydlpt anvo;t s2um(mpou1omtnmivtas  rtrxm ;t1aexoif3tatfa2rl(mont0tlxomociy1fpt  neo;s0 2tm(m nydapee ivi ()srtr(rpnu0olxnmoetad sDel( p;(0trxrmr3oytomDelies s)trxrim3nu1oleemfcslsf 2uaxmont4alx ioeiys s2umn onu) leoioctydlpDr i ols sexrir3io1al nmfcil()aDum(rpnt4tpt moeiadfm emnmo;(0trxomf oy1fatr nes (  etmxmpoo1llenlivt s)aDtr(rp;o0aetomoeiyt mDulu o;t)aeerifciodoaDeauvi t)tetmxo nu4lleelfciatfartmx pou0tlx iocildfs emump () etoxrctodlmDe nes;s0sruo(m3oudlm n fctlsfaDtru p;t1oexniieiatfs2rmuvp;t) renirctatomtelueo (  exmim oo4altn fet (  Dtm( o;u1ole iictatls rlump t)arxomf tatoatelueol( teumiopoudomtnmneias  rum(r ;t1tpx micilt aDuanvs u0tlerircio1lmtrluvs s)t2xmxm3ou4omte ivtatfsrra(mpot4tetn i3iydfsDuanvp t4 exrmf ta1lmtr nvils)trtoim3ou1al n iesa(fartmxmp;t0olt  feiaslaDelnvo;(4arxrxf3ta1fm  an i s0 2xo(rpnodlmtemfcta(fsrrm(  nt0oetn iciytfs2emnmpnu)artoif oy1lpt  n i t0 rxrirpiu1apen feias sDrr(m oo1ape ii3iatlm elu sn()tlerifcoydlp eanvils0teurxrpnodape  ivtls)s2raur ou0aet  feild a rmnmp (0artoir3to1laD ln i;s t2xrirpio4openlivi t  Draump;t1teenmoctytfs2rluvp (0texoio3totfa   i o t truoxr3oo4al emnvs sf 2urx pot1tptniiciyd s uan p;t0alxnif oo1oate ivo t  exmiopnydopenlivs ( a2taxm ot4aetn icild sDua( p t0 rxrif ta1fptr neo t srxoir iydomtelnetls) Duax  nt1alxomi3tytfsDrm(mo u)texnir tatoptr ieol( texm(r3no1al  lncia()sDrru  nt0apxn feiadfm2eluvs;t4 rxnmf io1omDranes;(0 ruoxo iudlm nmnei (fa2rrxmpou4tpxnmoeiltfa2rmnms;(0treomf tadoateln i t t2tmio iodolee feiat sDua(rpno4opeoiictatlm2raumo u4texoircoytfpDr uvs;( teurxrpoo1lltelnesa() Dur(m ou0aet ioeiltfsDumuvsn()aeeniocoatfatr ivslt)t2tmir3oy1lm  mnvtl( a2tmxr ;t1apto feiadfa2umn snt)altnio3iy1lmte iei ()texrxopny1am e nvtltfsDtr( ont1olt  i3tls s2ulu s;u) etoif iadopD ln i s0 exr(r iu4lmt mnesatfaDrr(ronu0tpt  f3iasfsDrm(mpn(4alxnmr3iydfaDelneo;t0trxrio3iu4lmenlics s s2tmxm no1apeo ociysfa rm( pnu4arxoxocta1laD  ieols0t2xoxr3nudome lics tfs2rr(roou4tlto iciat sDeau s;u0trtrxocoa1lpDrlivil(  2xoxm3ou1lme lnvtasfaDum(rp;u0tlxnmieilsfa umnmont4teerxrcoydlmt  ivil(0teumimpoodlptn neslt)aDtrx  oo1opxnifciysla um(vp;t4artnmr tytfptrlu s (0truoio oy1apeemfcs (  2tm(m no4alxo o3iatlaDranms (0 etrxociadfp elneolt0texm(rpio1alte ivta( a2tm(r ;o0opeoifcias a2raumpn(4 ltrmr tadopte ieilt)trtrxopny4ap  lfetas  rrmu poo4aexn iciydlsDrmuvp t)alxoio oy1lat  uvi;(0 rtoim3oy4lm n ivsltf Drm( oot4oee  oeiyslmDrl( o;u4altrif3iadop elivol()trxoio no4omte ncs s  2rrxrpnu1tle io3iltla2eauvo;(0teenmo oadfmteanei ( teumiopiu1lm nlnvta(fsrtrxrpou0aexomo3tld s uln o;u)aexrir ta1lpteliesls  rto(rpio4om e fcs sfsrua(mpno4optniieilsfm ua(ms;(0trtnif3oa1lmteaivs;t sruo(r3nodlmen fvi t arrmx  ;o0oexnii3iys a emums u) renmrctadfpD  u o s)teurxr iu1ll  miesatfsDtaum no1texnifctadlmDem(ms;u4 ltoif3totfatelnvs;t0teurio iy4ll n fvsa(f 2ur(r ;o1tlxo ieiytfa2emnmp () lxnio oa1opteln s t s2urxm3iudll elfei tfa2raur ou4tptoio3tys a2rl(vp;(4 eeoxfctydlaDelieo;t0 etmim nydolen iei s srtrx  nt1tee moetasfs2rmnvo;t)arxrmo oa1oa e uvo;t0s2xrio3no1lltelfvsl(fsrtrur nt0oeenmoctaslm em(vo u4 ltrmr3iodfpD ai il(  eur(m iu4ll  lncsas  rtrum oo0tpxnmf3iasfsDumnvpnu4 ltnxf iatfm r n s ()trtr(opnodlm nmfetatfarumx  ;u0ale  ictlsfa ranvp;(0tlenmrcoo1fpD  ivo;s)srtoim nu1apeemiet ( sruaxrpnt4aet mieilsfmDrl(vp;t4tetomo3ootopt lneo (0srxr(r3iy4alee nctls aDrmxm ;u0tet mfctltfm rmu ont4alxnio3iatlatrlueols  exrxm nu1ap  lfetls s2trxrp;o4oleomociad sDrlu pnt4 lxrio ia1fpD lues;s)trumio3nydome lfvias)sDraxmpot0aexo fcilt m2ra( pnt0trermr iodlat luvsl(0srxmio3oy4olt mncia(fartaxm oo4tlto ictlsfa2uln p (4arxomfciytfmteau ol()srtmim3iydam  mict s  Duax  nt0olen i3tlsfs2elnvo;t0tlerxr iotop elu o () 2tmxr iu1ope  feil( a2tr( onu4tlen o3tltlm rm(vo;(4trerio3iytoa ean s ( trxm(mpiu4ome  neilsfa2raurpno0teen fcias sDeauvo u)tleoxocoatlmD li i;s0 ruoim3oy4lm  lici sf rrauro;o4tpeoifctls m elump;t0 rxoio3iatfpt livi s  2um(m3iu1apte fctat arrrxmpoo0tee mfctaslmDelu p;()arxrifcoatoaDelneol()srurir no1apenlfcta(f rumur ;u0oeen ieiadfs2uaumont)altoirctodomteauei s0trum(mpiudop nmncsa(fsDurumpou0aet ioeiadla2uau o u) exoif3iotfmDeln o t trtmxrpiu1ll emnct tfaruaxm ou1tet mfcilslm2ean p;(4trxnif3iadfpD  uvi (0s2uoxopiudop nlfetlt arumum ;o1tlt iietasfs ea(vp (0 ltriociodfmt ln ils) rtmir iydllenmfviltfartru  ;u4apen feils a2em(vo;u)trxomf3ty1omtrluvsl( t2toxm3nudap   ieilt a2urxm ;u4olxn ietytlsDrlnmp;u4alxoxr oa1lp   u slt0truoxr oudape mfcsl( sDtaump;o0tltn oeiatlm ra(monu4treriocty1omtraueolt0trtr(o oo4altelivs ()s2ua(mpoo0texo o3ild aDrl( o;()aexnxociytop eai i;s) exoxr io1op  mfcsa( s2umu p;u4tlxo fctldla2rl(vs;u)aexoxr oadfmt aivi t0s2xrxrpiu1omeemneta()arumur ot1olx iieiatla rmnvp u4aleoxf3iytomtrauei;s0s2ur(opiu1lptelfetas sDtrxmo;t4oleo iciydfaDeluvo;(0alenif3ty1lmteaues;(0trxoxm3oydap nlict tf rururpou1texomf3tyslaDeauvsnu)aeeomfctytlatranvsls0t2xmxm ny1amte neilsf Drrurp;t1alxniieildls ean o;u0trerir iydfpteanvi;t t2xoxm oo1llt lnviatfs2rmur ;o4tex ii3iyt a umumo;(4tlenxo iotlm rai o;t)seum(o3oydomtn fet (fsrtmu p;o1teenmo3iaslmDrlumon()treoifciadomt ln i (0trtmxo oudamenmfvs s sruaxmo;o4tleomietysfm2uanvp;t4 rxriocta1oaDeli ols0 2xmirpio1opt mieil() 2rr(moou1apto oeiys sDrmu on(0 ltnmf3tadfpDran i;t)setrxo iydlm  mnvtls a2rr(moot0openifciydlm2ulumsn()alxnmo iotopD lu o;() eumxm oodlm nmfvslsf 2rruront4oet mfctld s2eluvo;u0aexoio ia1fpDeauei s0s2xrimpoodopte ietatf 2urumpnu1aleo iciydfmDulu snt0 exrio3oa1op ran i (  rxrirpoo4oltnmivsltfartmu ont0tex ioeiysfa2emn o (0 lxrxr ootfa  lu slt0s2xo(m3nydom nmictas)sruax pou1aex mf3iadfmDrlnmpn() exoirctadfa e neils) rtmiopio4al e fctls) Duru oot0teenioeiatlsDulumsn(0 eenmfciy1lmDeai s;s)s2uoxm nudlp nlici tf Duaur ou4tpt miciatls eln on(0texnxo oo1fa rluei s)s2xoio3ny1am eliesl( aDur( ono0open octldls emnms t0aexoxo3iodfp rlivo;t)sexmio iydlle mfvta( s2raurooo4ope  oeilsfmDuanmo;()aexrxocia1omt luvo;t t2toimpny1am nmiesa( aDumx p;u0apeo fciyt a2em(vo;u) rtoir3ia1oa eluvi t  2xmirpiy1apeemietatfarta(m ;u4tltoioeiad m ulu p t4trxoif iodlm rlnesls  etr(opnodlme lieias  rrru oou1aexniiciys m2el( p;u0altomo oatla  aneo s trxmio nydamtnlivs s  rururoou1opxnmieiyt m ran p;(4tlerifctydla r nvs;t)s2ur(r3iu4olt lnesat)a2urump;u1tlx miciysfa2umuvsn() ltoir tadomDr ivi s0 euoxo3oydlptnmicsat arumu pou0alxoif3ilt s2ra(vo;t4 eerxrciadom elivs;(0t2umir iodlme mnes s sDuaur nt4altomfeiydlm ranmp t0alerio oa1lp  anvo t) etm(o3nydomtelfcs (f 2tru oot0tlt  f3tysfa2el(vp;u)arermo iodfm  an ols trtr(r nodlptemict (  rumxm nt0alenii3ils m2ea(vp;t4 lxomr3io1oatrlneilt0 eum(r3oy1lpe lfeil(farrrxr nu0oexnmoetlslaDem( s (0trerxrciytom ran i s  2trxopiy4om   fetas) 2tr(m nu1aexo i3iadlaDeau sn() exnir iydoat  nvs;t  2to(m oo1om nlfvsa(f 2umxr nu0oexoii3iasfaDuan o;t)tltrxo3iotlaDeauvi;s t2uoirpoodap elfesa() 2raxroou0optn oeiltls2rm( s () etnxfcio1oa   ies;s)t2ur(rpiu1lp nmivsltfaDrrxmo;u1oetomoctysfmDul(von() rtomr3ia1opD li ol() rtrim iodope mivtasf rrr( pnt4apt mieiltla2rmnms;u4arenio iytopt  neo t  exmxr iodapeemies ( s2rrurooo1opxnmicilsfs2emnmo u0 rtnmo3totoa  lneils)t2to(o3no1al  mfvt s)a2umump;t0aetoif3iyd aDea(vpnu4aexoir3iy1lpDranvi t s2tmxo iu4lme  ivi t)arrmx p;u1tltnifetyd aDuluvpn(4tetrxf ty1lm  an o;t t2trxrpoy4am e fvi s)a2raxm nt1tpxo ieils sDrlnmo u)trxnio3oy1fmDelu olt0 ruoxr3oudlltnlnvils srtmu ont1tpxnmi3tat s ran snt4tlxnmf oodom   nvi s0teumxr iydll elivs sfsDrmxr ot0optomocils a2eanvo t)arxoifcoatoat  i il( srxrim3oo4olt lfvsls a2uau oou4aeen feiatlaDumumo (0teenmf3ty1omt aivils)srurim3oudomt  nvta(fsDtaumono0apt iieiatfm emuvo;u)altnir3oadoptraiesl(0trtoim3oudope mictlt aDuaumpno1apt io3iytlmDrlnmpn(4trxnxfciadfa elnvslt srxmim oudlmt  ietltfsDrmx p;u1oexn ictatfmDuauvsnt0teeomfciy1fatr u s;t0s2tmxmpno1llee ies t)sDtax  ;t4ole moeiydfm2emn p;u0texrifctatoa   u s;()s2xoxo3iydopee nesls)aDurxm ;t4tleoii3ildfs rmnvp;u4arerxo oy1lpt li olt0srxm(m3no4omee ieslt) Dua(  ;u1tptomoetaslm2rl( s;(4alxrxf tatfpDr i o ()srtm(o iu1ame lfei s aruaurpot1tpeomf3iyt m2ea(vo t) ltomo3to1lmtelues;s)trurir3nudapee ncsa(  2tm(mpoo4ope miciadfmDua(vp;(4aleoir3totla e uvi t) 2umiopno1omenlfci (fs2ur(mpno0ole mictatlm ea( s t0trtoir3oy1lmteln i;s0trxoio3oo1am  miei s a2trxr ou0tee ii3tlsls eanvp;u) rermrctydlptr neolt trtr(r3ou1al  mfes (f 2ta(r no0oet ifetatfm2ulnmp;u)texrifciydfaDeliei;s)truoxr3nu4al  mfctl()sDuaum ot0aeen ieiat s2emums u) rxomocoa1fpDeaieilt)setrxm nu4lme  nvtat srurxmpnu0optoii3iaslsDum(msnt0aexoxf totfatrlivils0 exoimpio4amenliesat srrru  nt0texnmiciltlmDemumo u0texnifctytlpDeln o;(0texr(r3oodomenlncsat  rurumpnu0apt iieilslaDuaumpnu0trerxr3iodoaDrli s;t)s2xrxm nudamtnmfvsa() 2tax pno1alx moeildla rmn pnt)teerxf3oa1fmteaueo;t) 2xmim ou4lmen ncta(  2raur ;u0opxn f3tysfa2ulnmpnu4artrxrciadlpteaneolt0 exoxrpno4apt mict s arurum ou4alenif3ildfm rm(mp;t0altoxo oo1fp eaiei s0 2xrxr3iy1optnmfeias) Drrurpnt1apeo oeiadfsDelnvo;t0 lenxf3iatlmDr nvi;(0 etriopoy4lptnlfes ( sDtmx o;o1alxo octad a ua(mo (4texnxf totfmDeaneol()setmxr3nodoltnlnvi (f 2rr( ooo0aptnmictlsfs elnmo;(4tetrir3iodla raivsl() 2uo(r3iy4amtnlieta(f 2tm(r ;u4teeo fcildfm2em( s;()alxriocoydom ranvils)trur(o3oodoltemfvsas) rtau onu0tee ii3iaslsDrlums u0aeerxrciydfat anes;s srurxo3iu4oltnlfvta(faDurxmoot0tpxoioctlsla uluvpn(0trerif oadlptr nes;t  eumir3oy1op nmnetlt) Drm(mo;u1oexnifeild m umuvs u0arenxfcoytla rln s;t) rumxm oodap  lfvi s  rumu  oo1tetn fctaslsDem( p t) renxoctotfpD  uvsls teuriopno4lm   netat a2umu o;t4oexnmi3iltfm2emumsnu) etomfcoatla  lueol( truo(mpoodll  mfvil(fsrtm(r ;u1tee mo3iat s2rl(ms u0aeeoir3ty1opt lu i t)texmiopiy1alt  ivil(  Dumxront4altnmfciyt aDul(ms u)arxnxrcia1fatrlnvo t) 2ur(m iodaleelncils)srrmx o;t1aexn i3iyslmDrau sn(4 lxrmf ty1opDr ieo t trtoirpiudlpt lnvilsf 2raurpot4opto o3iad a2ra(vpnu4texomo to1la rlieo s s2ur(o3oy4optn ivslt)a2ra(rpnu1oltomoctld s2ua(mo u) exnmr tadlmte ivilt0srurir3ou4op  lnetatfarumur oo1apxnmiciadlsDeanmp;t4aeenxf iodom eaivs t  2uoxrpoy1olenmicil(fs2rmx o;o4altoiociydlaDemn p (0trxoir oytfptr ueol(0sexr(o3oo4olte nvil(  2taum no1apeoio3tytfa2eaump u4 lxrxo iydopD ai ols t2toio3iy4lpe lnvsa( a2rrxr ;o0ale  fciltfs2ua(mo;u4arermf3tatoat  u o s0 eumirpno1ap  licsat a2rm(rpno1ape mo3ilt a eln pn(0 eeomr iadfpDraueols) etmio oo4optnlncsl(fs2rr( o;t0oltn o3iad aDemums u)tlxrxo iytopte n o s0trum(m iu4ap emnetlsfsrumx  ou0alto feildfmDumn snt0tltoxf ty1fpte ieol(  rtmxm iu1oleelnct sfaDrru  nt0alxomi3ilsfaDraumo t4 lxnxf3oydfmt  ivi t srxmir oudlpe lieilt aDtmx oot4tpe ioeiydlm2rm( p;t)tlerxf3oodlpDe uvo s s2uoiopnu4lp  mivsatfsruaxrpno1aexn f3tas s eanvp t0arerxo3oatlpteli il(0 eur(m iudaptelfeta() Draurp;o1oltniiciyd m2uau s;(0tlenmo3oadoaDelivi;t srxrxm3iy4lptnlnvslsfa2uau  nu4aeenmoeiysfa uan s;t4tltrxf3io1lptrlivilt srxmxo3oo1ameemfvi ( aDuaxmoou1tltn fctasfsDrau snu4trxnxr3oa1fatraivs t setm(r3nodomte fei t)srtru pnt0alx mfeiadlsDul(monu0 rxnxr3oydlm ean ol(  2urxm ou1altnmncsls sruaumo;t0aptomi3iadfm ul(mpn(0tltnmfciydfaDelu i t0 etoxo3oy4llt livs ()sDtaumpnt0tet mi3tytfm ranvo;() reoxo3tatlmD aieils teumxr3ny4amt livslsfsrtr(rpou0alen oeiltla uan o;(0 rxrif tadfmtrlnvsls) eurxmpno1llt lfvia() Duru p;o4olenif3ilt m2rmu o (0arxomr oydlmt aueslt trtmimpoudopeelnctas)sDta(m ;o0apxoifctltfmDelu snu)trxrir3oa1laDeli o;s trxmxmpiy1llt  iesltfsrtaxmont4tpt ioeiytla2ea(ms () lxrmf3tadlmte ues ( srurxr3ny1am nlfeta(fs2rmu o;u1opt ifeiyd s eln p;t4trtrxf3oo1opteluei s)t2uoim3oudape  fet t)a2umurp;o4tlxo f3ilslm2ea(mp t4treoxf tydlpDeauvo ()truoxm3ou1oltnlnes (farrm(rpoo4tpeoio3iys a ra(mpnu4tlerxr ta1omtrlnvi;(  2uo(rpiudlm emnvs s aDtr(  no0opxo ociyt a2em( o;(0 exrxrcio1oatran ol() exoir3ny4apenmnet tfaDrm(rp;u4tptnmiciat sDumn sn()artniocoa1fa   nvo;t0seumxmpoo4lltelivilt) 2tau pnt4texoiieiasfm2ua( s (4aetrirctytoate ivs s)truoir3iodam nmnes t)aDurx oou4alx mi3iadfs ua(vo;(4 ltrxr3ootfa elnvs;( s2tmxmpio1ap nmnvsls)artaumpnt4tleomfctytfs2el( s t0 rtoxocoatlat li s s trtm(opoy1amtemnei s s2trx o;o4optomf3tytfm2um(msnu) exoxf iodop  aivo;()teur(r3ou4ol nmncsltfsDrm(m nt0aptn oeiyd sDel(mpnu)tltrif3iodla eau sl(  rtrirpiy4ape miviat  rrr(ro;u1teenmi3tldls2ran o;t0 rtnxr3iy1oa r nei;() 2xrir oy1ome lnvs s) rtru pnu1tlxn o3iysfa ra( s u0teeoio iodfm   nei t texoxo3nydlpe  ivt s sDrru oou1openiociltfa2uanmo ()aetoxo oodlpteaiei s srtoir no4omenlfeta(farra(m ou0ole mfeiltls2ulnvs (4arxnir iadfa rauvi s0srxrio3iodllte nciasfa2tru  oo4tpeoifciydlm raumo;()arxomrctodfm e nvi;( trtrxo io4lm nmietlt)s2ra( ooo1tpeoioeild m umuvp ()trtomociytoaDraies;t0truoiopoy4om nmici ()sDta(r ou0teeo ictat m2ra( s (0tleoir ty1fpDe ies;t trxr(m iy1omee netas sDtrxm ;u1tpeo i3tld s emn s;(4trerxr oatlp r i ilt  rxmxmpoudam  lnctl(fa2rmu p;o0oetn fctasfsDemnvo t4 etoioctydlaD  n ols0s2ur(rpnu4apt  ict s) Dur(moou1tpeniicilsfs2rm(ms u0 rxrmfcia1opte i i s sexo(r3ny1am   icilsfaDta(mont1tee ifetlslaDum(vonu) rtomrcoy1fa eluei ( s2xo(o no4lltn fctasfartr(m nu1aex iieiydfs rm( snt4teermociodfa  anvo s s2ur(m3iu4altnmivtltfa2ra(  no4optnmfetatlm rl( o;(4arxoxo3tatlaD  ueo ()tetmiopoy1omenlfet t s2rr(rpnt0opxoii3iytlsDeanmp;u4arenif oytfmtrlueo;t  rto(r iu4lpe lnvtlt)arrmurooo1olxo f3iyd aDelnmp u0aeenxo iytlmDrau ol(0 exrxm nu4apenlfci ( a2umx pou0tlenmiciydfm uluvsnu) ltrxfctadfa eaivo;(0 exmimpoy1aptelfvil( a2tr(m nt4olt  oeiat sDelu ont)teenmo3oa1la  lnvi;s)setr(r3oodoleelfvs (farumurpno1aptnmoctas m eanvpnt0arenxo iatoatr u s;t t2um(o3ou4ape  nvi t sDtaumpoo1opx iictat m rmn s u) reomociy1fp   u s () eurxrpoy4al  lict ()aDua(m ;t4tex  i3iad a ra( on(0arxnmf3to1omD lueo ()t2xoiopoodal nlnvsltfsDta(r ou0oexnmoctltfm uauvs (4arxrmocoytfmtrln sls0 2toiopnydol n ivs (fsDumu p;o0apxn octydla2umuvp t0 lenmf tadlmD  n o;(0 rum(m oodomtnlnes () Durumpoo1oeeo o3tyt m2ulu on()alxoxf oodfa   nvs s srxmir3oy1aleemict sfaDurur ;u0olx iietltls2el( s t4 reoio3ta1opDrluvil(  etoio iy1ap  mnetls  2tax p;u1openmf3tlsfmDuau snu0 rtrirctytlatrlu olt0s2ur(m oo1ol elnei sf 2rmu pnu0opxo feiys m um(mo ()altrmrcoo1lmteai ols0texrxr3nydomeemfci s  Dtaxmpnu0optomfciasfaDranvpn(4teeriociatom rlueil( seumxm3no1optnlfeils  ruru o;t1tpxnmf3tltls ra( snt4treomo3iodomDelivi t0 exrxopiydlmt mfesl(fsrtrxmpno1oet  o3tydls uluvp;t) rxniociytlpDe uvo ()seuoxm3ny1opte ictls sDrmxm no1tptomoeiydlmDua(msnu0aeermf oo1om   i s t0trtr(r iy1apt mivtat aruaxr ;t0teeo fctldla um(vsn(4 eenxo3oa1lp r n ilt)t2urimpio4ol elfctas arur(mp;t0tpxn oetysfa em(mo;t4alxoir3oa1lp rlnvsl( trxrxopnodllt lncs ()srur(m ;t1aex  ocils m2rlnvs u4 eeomr3tytop  aneils)truoim io1altnlnci tfarrm(  oo0aet  fciasla2ua( p u4tlxrmo3tytlpt  uei;s s2trxrpoydlp e ici (fsrua(m ;u0apt  oetatlmDul(ms;u) exnmf3oytoptr ueolt0 2xr(r io1ol   net (f 2raxroot4olx mictys a eln o;u)arxoxf tatomtrau i;(0 rtmim3iydamtelics tfsDraum ;t4apxomociatfa2eau o;t4trtomr3todoa rai i;s)srxo(m3iu1olenmies tfs2tmxr ou4alen i3tasfs elnvo;u4alxrmr3totlm   n i s0sexo(rpoydlpeemfetas sDra(  ;u4altn f3tlsla ua(mo t)aexrif3iadla rln s t  exoir oo4amtemieslsf rumu pnt4optnmfetyd sDeluvo u)artoxr3ty1faDrlnvi;t0trtr(o3iudam n ivtas)a2tau ono4tlxniietld a eanvo;()altrio oydoa rlivolt  euo(r ny4op nlivt sf 2umx p;o4opxn oeiltlm2ul(vsnu4 renif3ta1lptrlues;() etr(rpoodlpee iet tfa2rr(m ;t0optn ieils s ra( snu0teenxoctadlpDr nei t0 eumio3oo4aptnlfet t  2rrx p;o4alt mfeiatls2rm(vont0tlxoirciydlaD aieol( trxmxo3iu1alt  ies sfs2ra(rpnu1tlto octlsfs2el(vs;t4areoir oydomt  uvo;s)trurxr3iy4am  lnes (f 2um(mp;u1altnmf3iys m2um(mp;(4aetrmocoy1faDr uvo (0t2xoiopoodapeemietat)arrm(mpnu1tltnio3ias m emn snu)tltrxr tatfmD  nei;s0s2urirpoodlpee fetas)srta(rp;u0oex  ociadfa ra(vp t)trtrmrciadlatrau olt s2trio3nu1lmen fvtat) Drm(rpot4tle  oeils aDulnms t0texrmr3iodlmtraueslt)t2xoio io4openmnei s)sDurx oot1tlen fciytlsDulnvont4 etrirctydfp  anvsls srxmimpnudlp  livtas  2uaurpno1tleo feiytfa2ulnmp;() reoxr3tadomt  ivsls0trtrxm3nydap nmfes ()srra(moot1tptoiieiydlaDulnvp;u0 ltnmfciotop elu o;() 2umxmpiy1ape miet tf 2rm(monu1oexn octat aDea(vs (4arxnxfcty1lm e ies (0trurimpoy1alenlfvs t srrm( p;o4tptnio3iaslaDul(mpn(4tltnifciodlpDrlu o (0srxrio iu4omeelivilsfartm( onu0tltn o3tysfm rm(vpnu4 leoiocta1lat ai s (0teuoim oy4optn iciltfsDtr( ooo1oet  o3iys s el(vsn(4 rxnmr iatfmDr i i t) rto(m ny4lp e net s  2uaum ;t0tpeo feiasfa2rmuvo;(0 etnxo3ia1oaD lnvs;()srur(mpnu1olen nvt s  2tmurpnu0tltn o3ildfa rmuvpnu) eenxr ia1fatraieslt s2tmim3nudlpt licilsfa2trumono0tlxomieils m rl(msnt)aeerifcootoa rli i;t0tetoio io1alt  fvslt)aDumurpnu1apxniictatfmDelnmp;u)aeerxrcoytopDeaies s)teurirpoo4ape mics tfsDrau poo0oleomfciytfs uanvo;(0tlxoircty1fp  lnvo;t0 rxoxr3nodlpt mfesa(f Drr(rpot4texnmiciydlsDuaump;(0 rxrifcoatlm e ueil(  etrxmpio1op  mivias aDuauro;o0tee io3iasfmDrmump u) etoxf ta1op e neils0 rto(o3oo1apen nctltfarua(r nt4tetn o3tydfs2em(mo (0trtomr3oadfa  an il()s2uoir3oudapt lneils  2tru p;u0olx mfcildla2ean s;(0texnio oatoa elnvol()srtmxrpiy1ap nlici sfarua(r no0tetoioetltfaDuanms;() exomrciytoa  lnvi s)sexmxm3iy4olenmfct sfa2tmxrp;t0tpt  octys mDrlnvs;()artoxr ta1lmDrluvs;( teuriopou1ap  liei tfs2uru pnt0olen oeiyd m2ra(ms u4trtrxr3iadfpDelnei;t)s2trxrpoo4llenlicils)a2raumo;u4tleomoetytfm eanvs (0treoircootfm r ivo;t) 2xm(m3oy4lp  miet tf Dtm(m ;o0apeoiieiad m2rmnmp u0artrmocoydomDeaiei;t)trumirpiy1oltnmfet s  Dta(rpot0teeo feiytfa eauvo u)aetoif3oodfpDe u i;s  rxrim oo1olenmfcsatfsDumx o;u4opeomi3ildlm rlnvp () lxnmfctatomDeai sls)teum(m3ny1lmtnlicia()sDrmxmoot0tle mi3iytlaDelu pnu4 lxrmfcio1la rli ols)srtm(r3no1am n nvsasfa2uaumpou1aeeoiociltfs rmnmo (0aetoif to1fmteaivi ()srumxr3io1ap elivsls)srurx  ;u4olt if3iadlmDel( onu0 lenifctatomDean il(0 rxmim ou1ol   ivsl(  2tm(rpoo1teenmicilt s um( s t4 rxrxf3ootoa rlnes;t) rxmxm3nudoltemnes s)artmuroot0opxnmieiad mDel( pnu)alxrmr iydlp e i olt0 2toim3io1lm  mncil(fa2tmum ;u4tetomieias s rm(vo u0 etomr3iy1optrlivi t0trtrxr3nudapt mivils  Dtmu oot0opeoifcilsfa2ul(msnt)aeenxr oodfateli o s  rtr(r ny1olt lnesas)s2ua(moot1altnmictas sDrlums ()artnxrcto1la  luei s srtoir oo1ape mfviatfsrtmurono0opxn i3iadfa2rlnvonu4 rtrxo3oydlaDrluvs s  ruoim3oy1om elneil(  rtrxrpoo0oleo octltfa2rmu o;u)aexomf3ia1lp   ieo;()trtrirpiydome lnvsls)a2rmu  oo4apt mfeiyt s2ua( snt0teeoif iytfm e i i s  2uoxmpiudamtn fvil( srumu  ;u0aex ioeilslm2um(vsnt4trtoxfcoy1op  lies t0trxoio oy1lpte nvi (fa2rauroot0aleoio3iadls2emu s;t4 lenif3iadlp  anvilt  rurir3oy4al e fesltfsDrm(r nt4aexoiietasfs2rluvp (0 eerxrcoy1lpD  nvs;t0s2xrim3oo4lle mics ( srtr( pot1ole  icildfm emuvp;u4 eenio iytlp  au s t0 rum(r3oodalen nci s arumu  ;u0tltniocildfs2umn o;(4 leoxf iatlm  lneo;t0 rtoimpno1lptn fvs ( sDurumo;o1tlx  f3ilsfmDranmo u4 rermrciatfpDe i o (  rxm(r oo4am e iet t  rua( pot1teen i3ildfs2em( s t4trtrircoadfmt lnvols  etmxm oudal  mfctas)arur(rpot4opt  ietad sDumu snt0alenir oatlmD  ivi;s)truo(opnu1ameelnvt tfaDua(rpou4optn fciltlmDul( o u4alerxf tadfpDeaiei ( truoxr3nu4openmfvsl()s2tru o;o0opeomfetad aDem(vp;(0areoxf tydoaDe nvol() rurir no4alte ivsat)aDtrxmp;o4oee iietls s2em(von(0texnir ia1laDran i;()s2uoxrpno1ap  lfes sfsDrmxrpou4optnmi3iyd sDuln ont0tetoxo3oatfpt luei;t) eumxr iy4amtelnvi (f Drm(r ;u0tlxn fetatfa2ulumo;u) rxrmo iotfp  ai i t  eumirpiodal e nvtasfarum(r ot4tet io3iat aDel(mo;(4arxnmr3iy1lm ean il(0 exmxr3iydamen nvilsfsrrrxm ou1tlx moeiad mDelu s t4arxoifciy1faD ai s t)setoio iy4ap  lfvs (f rraur nu0aetnmiciat m rmnvp (4teeomr3totlmt an olt0trtoiopiudamenmnesa(fa2rmxrooo1opxn oeilsfs2emnvpn(0 leoirctotoa r i ils)srtoio ny1ol  mncs s sDuaum ot0aetnmiciytfa rl(vp;u0artoxrctatoaDr ues t0srxoio3oo4llt lietat)sDrmxmpnu4ope mfctls a2rlnmo ()arerxoctatlptrauei;s0 etrxo3nydlmtelicslt  Draumooo1tpe ioeiytfa2emnmsnt)arenioctodfpt anvs;s)seumio3no4ll  mies t a2tax pot0altomi3iydlm2rluvs u)trenxo oydopteaivilt) exmxm ny1lptnlieiasfsrtru poo1oleoif3tyt a2uauvpn() rerxo iadfmD  ivo;t)srxmio iu1llee ncsa( artax ono1oeeo ictadfaDrln sn()alxrio3iodfp  aivol()seumxrpoudomenmfviltf 2urxm ot4aeeomfeiadlm2uanmp (0alxnmr3oydla  aiei ( tetr(mpoodam elfcta(fs2ra(m no4oet  ietltfmDrln s;t0aexnmr oatla r uvs s0s2um(rpny1lmte fctatf 2umxrpoo1aptn fctltfm rmu on()aetnircta1omD  i ol() 2xr(o iy1lp  lfvtl()sruaxm oo4opeo fctytlaDuanmsn(4altrxoctotfmte u o s t2to(opiudame mnvtlt sDuau  nt0tetn i3tlsfa eanvonu)aexnirctatop  luei (0trxoxo oudamtnlnvtl()arrm( ooo1tpt ii3iyd a ul(mo;()alerxr totfpt li o t) 2tmxopiodopeemfcs t aDraxm nt4tleomfctad a2ea( s u)tetrxo3tadfat lueo (0 2um(opny4ap  lici () Drm(m ou0aex  o3iltfm emuvo;(4tlxrif3oodfpD auesl(0t2tmxo iy4lltnlivi t aDra(r ;t4opxnmieildla2ua(vsn(4 rxrmr iadlp rlu o;s) exrir iu4lpeemncsatf Dua(moot4tlt  i3ildfm2um(mo;u)trtnmr3tytfmt liei;s)seuo(r3ou4omt lfvta(f ruaxronu1opxnif3tatfaDuauvpn(0tlxnxr3io1lp   n s;s) 2umxm3iy1oltn fctatfaDuax pnu0tpen iciys sDuanms;(0 rxnxo ty1faD lueolt trto(m oo4oltelfci s a2rmx  ;u0aleoioeiydls ulnvo (0 eenifciotoat li i;()tetrxo3io1olt lieiatfs2ururpno0tltniociydfsDeanmpn(0aetriociodomt li s;()srtoio3ou1ol nlivs s artr(mp;t0optnmfcilsfs ranmsn(0 lenir iytlp  anvslt)t2uoxo iu1ol nmneslsf rrru p;t4oetoif3tls s elnvpn(4trenxfcoydfm rau o;() 2urio oo4opeemfcs sf Duru  ;o4alto ieiyd a um(mo;t4trerxfcoodfaDean s t0srxr(rpou1lle mfctlsf rra(m nu0aee  i3tld m rln s u)arermf3oo1fmDeluvo;(0srtoxo3io1ap  mieiat)aDum( o;u0tlx ifeiat mDumu s;(0 eerio iatfp   ivs s0srumir3ny1ol nmnet s  rtaum ot1aee  fciys s2em(mp t4alxnxfcoytlat luvo t0 rtrxr ny1optnlfcs () Dtaurp;u1aptn fctas m umnmo;(0 lermo iodopDe ivol()trtrir3oy1ll n ivsat srumum no0tpx mfctydfm umuvpn(4tlerifcoy1lmt liei;s  rxoxo3iu4amt  fvs (  2tmxrpoo1ale  fcildfa2umu p t4aeerxo3iytlp rli o t)srto(r ny1alt lncsa() Drm(  nu4apen i3iad a rauvo t) etrio3iodlateai il()sexoio3iydlpt lietlt  2uaxrp;o0oet  i3tydls eanvs t0 renmo3todomDelieolt) 2xmxopnu1apee nvsat)srra( pot4tpx ifeiydfm rmuvo;t4 reomf3tydop rlies;()tetr(r oo1lp emnesl()a2rrum ;o4tpt io3tadlmDean snu) lenxo3oa1lpt livi;(0 2xrxr iy1omtelicilt srtmurpnt4aeenio3tas a eau p (4tlxnir3to1lmDeaieolt t2toir oodoptnmnctls)sDurxm ;u4tptnmieildfs2emn snu4aexrxf tydlm rlnvsl(0 2uo(o nu4lp nmici s)aDtmx o;o4oeenio3tas m2rl(vo;t)teerxrciy1om rluvs (0t2uoir no1apenmnvtat  Dtr(mpot0tetn icildfa eanmp;u4teenmfcoatfm rau s;(  ruoxrpou4ameelncta(fsDurxrp;t0aetnmo3tyslm rlu onu4alxrif todoaDr ivi;s t2tm(mpno1apt lfvta(f rtrxroou0tetoiietyd sDuanvo;t0 eerir oodomD  ueo s0 exoim3oudalt  nci sfarum( p;o1tex  feild mDra( p t0trxrir3oytoaDe neils0sexr(o3iy4al n fvsl(  2rmxm ;u0opt  icils aDelu o;t0arermrcoadfaDr nvi;(  2xrir io4om nmnvtas)aDum( onu0tltomietltls2em( snt0teerif oytopteli o t sexrirpiydalenlicias)a2rmu oou1opt  ieiydlaDelumont0 renmr ty1lpt  i s s s2to(o ny1lptnmivs s aDumu pno1oetn ietyt a2ul( sn(0altrmrciodfaD li s (0s2urim3oo4apt  fesas  Dtm( oou1tpt mf3tas a2emn o;(4texoiocoy1opDrlu o s trxmirpnodlptn fesat aDraxrooo1olenioeilt aDulumpn(0aeeoxr3iytfpDelivi;s0trtm(m3nodapenmfvils)a2rau  ;u1aexn ictadlaDua(vp;u0trtnir oytomtrluvo t0teur(o oodlme  nesatfsrra(ro;o0aleoiieias aDrm( snt0arxomo3tydlpDrlnei t  eurxr io1ale lieils)a2rmurpnt1openif3ild m elump;u0tlerirciadla  aueo ( texmxmpoydoltelfei s) Durxroot0tpenmociad m eanvo;t0 renmfcoytlat au o s teumxrpoo4apt mivtas) ruru pou1tex iietaslaDum( pnt4artomr iytom eanvs;t)t2trim3oy4ole  neiatfaDurx p;o1aexoii3tas s2ra(ms u4 etrmr to1omt auvs;t  etrio3iu4ol   ncsa(  Dtrxmpot1tpxomf3ilt aDulnmsnu4trxomfctatoptrli o t seumxopiu4amtemiesas)srta(rpot4tltnmoctlslsDrln s u)aleomfcoo1opD  ivil(0 rxmxmpio4oltemfeia( sruau  oo0tptnmictytfaDem(vs;(0 lerxr3iadfmte nesls  euoxmpiu1amt  icsat  rua(m oo1tpeoifciyd a2eln o;t4 lxrif3ia1omDe i sl( tetr(o3nydlltnlfvil( a2raumpnu1apeomfetlsls2uan s ()teerif totlpDe ueils tetoimpny1ameemicils s2umurp;t4olt moctysfs2ea(msnu0trtrxr3oydfm rlivilt0trtmxo io1lp  mfctatfsrraxro;u0tltnioeilsls rmumo;(4teermr3oy1lmD  ieils)trtr(mpoodlmt lnesl() 2trurooo1oetomoeiytfmDrl(vs;u)trxrmr3oadlateaies;(0 etrim io4al e nesl(fartmx p;u1apx iieild a2rmump u) etnxocta1op rauvsls)srumio3nu1ap nlietas aDraxmo;t4apto oetyt m2ulnmo t)treomrcoatomt ln s s srtmxm iu1apt lncsa(faDua(rp;o0aex  iciat aDem(mo;u4 renir3oy1omD aues;() euoio oydamtelnesas  2uauront4oexomfetyslm ulnms;() ltnxrcoy1fpD livs;t0 2xmxr oydomtelfcsas srua(mpnu0apenmo3iydls2uauvo;t0trtomf3iatlmDe nvil(0seumxm3io1amen ivil(  rrmxm ot0optomictadlm2elu o;u0 eeoif3oy1lp rlivs;(0seuo(rpny4lpe mnctas) 2tmu pnu4alt micias s rlnmp;t)alxnxr to1opDr nei t t2triopou1lltelfvsat)a2tr(r ou0texomf3iydfs ranvo;(0aexrxr3oodfpt  i i t0s2ur(o3nu4al  mfvs (f Drmxm ou4opt io3iys mDelnmon(4areoio ia1oat  n ilt0 2toxm3oo1lm e neslt srumur ou0aptomieiadfs2rl(vo (4 lenxr ia1la r ivs;s)trumxr nu1om nmict tfsDta(m ;u1opx mf3tldfa ulumpnt0aexnxrctadfaD ln ols) eurxr no4aptnmivil(fsrtaumoou1opxo ociyd a ra(vs;(4alxnmfcty1oa eluvo;s)tetmimpno1ol  lietas)aDrmu pnt1tltn o3iytfs2el(vs u0arerifctydomt  i ilt setrxr3oodop nlfctltfaDuax  nu4ale iictys s2uluvp t4arxoxo3oytlptr ies;t)truo(m nudomtemneilt)sDtm(r ;u0oetnmfcias s2ran snu4treoircoydfm   ieil( srtmxopno4alt  fes sf rrmu pno1tlxo oeiadla ra(vs (0 etnxo tatomDraivils) eto(r oodameelieslsfarua(rpot4tptn i3ilsfsDeauvs;t0 etnxo3oa1lmteai sl()srtr(mpiu4omtnlnvslsfs2umurpnt0tlx mo3iatfsDemn p u4tetnifctotlaD  neol() exmir nu1oleelfvs (faruauro;t1olxo f3tadlmDrlnvo t4tleomrctadoptr ivo (0srtoim io4om  lncslt s2urx ont1tlt moctldfm ul(mp;u)tetoio ta1omD luvo t)srurio3oy1amee fci ()aDta(rono4aetoifeildlsDranvp u0 rermocoadfm rau ol() rtm(r iu1lm n ictlt)srtax  oo4oee if3iasfm2em( pnt) lxomocio1lptr ivs;s  2xr(m iodomtelivsl( sruaxro;t1ope ifctasla2ea(vs;t0tlenir iodlmt an s t) eu
\ No newline at end of file